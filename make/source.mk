@@ -69,6 +69,7 @@ COMMON_SRC = \
             msp/msp_box.c \
             msp/msp_serial.c \
             scheduler/scheduler.c \
+            scheduler/scheduler_trace.c \
             sensors/adcinternal.c \
             sensors/battery.c \
             sensors/current.c \
@@ -85,6 +86,7 @@ COMMON_SRC = \
             drivers/rx/rx_pwm.c \
             drivers/serial_softserial.c \
             fc/core.c \
+            fc/latency_trace.c \
             fc/rc.c \
             fc/rc_adjustments.c \
             fc/rc_controls.c \
@@ -134,10 +136,14 @@ COMMON_SRC = \
             sensors/compass.c \
             sensors/gyro.c \
             sensors/gyro_init.c \
+            sensors/gyro_ring.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
+            blackbox/blackbox_block.c \
             blackbox/blackbox_encoding.c \
+            blackbox/blackbox_gyro_capture.c \
             blackbox/blackbox_io.c \
+            blackbox/blackbox_predictor.c \
             cms/cms.c \
             cms/cms_menu_blackbox.c \
             cms/cms_menu_failsafe.c \
@@ -276,9 +282,12 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             rx/xbus.c \
             rx/fport.c \
             scheduler/scheduler.c \
+            scheduler/scheduler_trace.c \
             sensors/acceleration.c \
             sensors/boardalignment.c \
             sensors/gyro.c \
+            sensors/gyro_ring.c \
+            blackbox/blackbox_gyro_capture.c \
             $(CMSIS_SRC) \
             $(DEVICE_STDPERIPH_SRC) \
 
@@ -0,0 +1,5502 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`}\fM+"
+	.string	"v\357\264EP\036V\007\211\031\334JZ\212p8\340\205\027{S\035\263\034\252\340"
+	.string	"~\212\t\302b\257\"\307\023W\225\230\240'\342\230\250Q\300\0061CW\312N.\224\375P\2648\230\265\001k\364\316\223\257m\345\336{\313\264e\223"
+	.string	"\237"
+	.string	"\250"
+	.string	"f\312\226\212J\303\037\366\017\342h\334h\263I\234L\217g\023$\243\370a\341\013\207\204\036@\320\367\007z\240\340\367)\036\325\t\220\241p\210?\217c#V\312\234BA@\377\272\357\327\017\374\376\277\207\337\367\275\207\037~&\340\2374\347\227\240\333\353i\317\240b\300\237\257\327y\\~9\376\375\375;\357\347\347=\374\372\365\363\347/\277\374G\276\270\252\036\255\034\303|\214\235\224\272w\317\321*\335\365\343\207\337\177\177\377\376\327\357\276\376 |\306I\266\325_\332\027\026O%\365Z\3527\374SB>\235\202}\342\240\001\203\005FcQ^\343#\013D\201\213\245\032f\214\311\203P\243}\274\336\264\247\224,\313\227Ku\307\234\362\325\"\304\232&\331\205\354\337\215o\374 \020I\035\037\347\261w)\001\017\357\243"
+	.ascii	"\337?\352\373C}\377\247\376N\273\211\351\373\356}\357\275\227"
+	.ascii	"\212\017+\375+\364;\351;\322\321\357\241\321\367\337\323\307"
+	.ascii	"\226\201\332EA\275t\013\205\372\004\023\277?\361\205\304\037"
+	.ascii	">\257\350\213\210~\210t\311\320P\343\234\336\252\025\262\263"
+	.ascii	"&\331\213\2228Z\246\267M6$\256\256xm\346\340\2112B\204\360\263"
+	.ascii	"l\271\342#\304\376\2759<m\006\021\003\361\001~8\346~\256cK< "
+	.ascii	"\037\371\307?\306\307\343F\276>\276\326nt\226\323\244N\221\016"
+	.ascii	"\0344\227\346*\002\317\234Y\321\276\276\317\231\241\233\333\220"
+	.ascii	"\340_\004\257\017\374\226\201\002\004\220~\2538\340\267\220\377"
+	.ascii	"\306\344\356\217\206\254\036\277\313\223\304I\006\fZ\257\305"
+	.ascii	"_\353u\377,\013T\240\322\013\374\261\276?V\277\372\237\034m*"
+	.ascii	"9R\201\302\004\376<\336\257\3761e\271:\035`$D\260z\253\252\252"
+	.ascii	"\337V\257\337*\037\033\364\207\037\b\017\250\002z\216V\351\256"
+	.ascii	"\256X\257M\255\016\353B\237H\2258e\356S\277&\316po\220\270\271"
+	.ascii	"9~6\243\323\304\272M\031\356j\275\303\361\260\235\324\210\332"
+	.ascii	"\215\357\2211{nm\324\220_f>\223\371\3603\275\336\013\354\307"
+	.ascii	"\303-\372Fc\357\261\323\0267C\026s\267%\215\214\016\267'I\227"
+	.ascii	"\030?\253\311J\337`\350=\244\315\215\310\013\"\271\271\266es"
+	.ascii	"\261\374\345\362\307\327\254\\\354\264P\276R9\313\320\255T\216"
+	.ascii	"E\362\223\237\214\247j\323\265\025]O\304\357\344\001C'\354\235"
+	.ascii	"\022\203\026\007\246\342\267\234\02768)\342wf\363EO\031\024'"
+	.ascii	"L\224\b\201c\250\26191#S\222$)Lc\341\004N2\345\334\025\017\022"
+	.ascii	"\240\324\025\313\244\210fD\024\227\244 \365(\r\007\027\016\264"
+	.ascii	"\210\324\277\335\273\253PH\022\013W'\331=a\322\034\031\n\346"
+	.ascii	"P\243\205\036\023H\017\3167\2328\337\272\0365??\235M\300\271"
+	.ascii	"\235V5n^\210\313\256\245\275\322\211\237\374\300\276t1e\310\305"
+	.ascii	"\271L\023\330\331\2163/\345\230\312\223\315\227R\t\213\321\035"
+	.ascii	"\3540\024\270!\210Mt\245\004\200\373\250A\336 \334\022\264\262"
+	.ascii	"Lr~\315\023p\"\022\334\360\263\3760\373s\277\235\001\313\350"
+	.ascii	"\244\021f\223\"\261\377\2414j\037\334!4\351\005\231\373!\007"
+	.ascii	"\217e\013\225\271\361\311\034e\364\226F\200\027\212\002\314\272"
+	.ascii	"\207\314\210\251\356qE\225\n\n\342\265&\021p\266w\362\353D\302"
+	.ascii	"Y\347\322,\202\246Q7\365\375\341Ut%\007\366\315\036\357\004\275"
+	.ascii	"\247\365\355\2774f8\036\273\020\2043\001>\227\007;=\265\304\363"
+	.ascii	"V\022\267?m\245\263\003\363=\242\236\341\327\225)\234\025\035"
+	.ascii	"\366\357\235\335\271\253+\371\230\312\260>\027\030\364\314\376"
+	.ascii	";)\206\341\034\262`\215\343]\216)\270j'T\356\317\"X\227\327\314"
+	.ascii	"\\\277\"\007XKr\215\275\274\234\230YCG\034\t\352{\350N4\335\302"
+	.ascii	"\350\3456Js\017\337e\330\241\342J\371\374\250\274}l\230\212\177"
+	.ascii	")vQ\036U^\\\370<\211\371\241x\250u\262\236o<\337f^H\345p\202"
+	.ascii	"\016\n=\347 -/\b3u\307D\233\027\322\313\267+\350zxR\004\267x"
+	.ascii	"\274\303\236c\367\340\210F\241Q<\321\177\220\362\324\021>\227"
+	.ascii	"}\227\006\244\207\216\306;\251\235\034\314Z]\337i\020\201l\305"
+	.ascii	"*\260#N\240\376\265\265\355\307z\210\fw\370\360\\\341mY\300\364"
+	.ascii	".\3065\374$\374n\327\236\216\315\241\233\033\370\333\013W\216"
+	.ascii	"\377\354`\250\377\355#C\272\332\332\252\345\336N\247|\007\336"
+	.ascii	"\202\035\026\331'?\236[:\233\270\323 \034\362\333\013\270pc0"
+	.ascii	"1\245\361\355\021W\350n\227\362\202\344\203\f\374\374\247[\r"
+	.ascii	"x\021\316\254\022E\214:\307\313\005\177\017\032\336\252Q\\Z\211"
+	.ascii	"[.\024\337K\212\266v\371j\205\020!\002,2\254\2257\317m\270\343"
+	.ascii	"\260\267\016\345%\314\0302B\226a\361\317U\024{\rr\255\005\361"
+	.ascii	"\r\267_\356b\245\335\356dE\303#k\226\270B?\252\024\246\303\""
+	.ascii	"\277\314\221'+\"/\242h\214\236\266=\216 \003"
+	.text
+	.section	.gnu.lto_.ipa_sra.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\321\003u\n"
+	.string	"\222\n\037%PU\n\215\00103333+[\310BI\017\223e7\362\235\016l\306\210\245\330}\215W\357\026A\215\354-Sww\231\372\324\224\212ROv{3\271\334\250\320V\262$;REB\202|x\334\261\206\343\r\215\214\215q\261\026\257Hq\226\335\004\355\262yF\213Y\022\021!\036\356\320\300\360\205+\320\264&|=\240\207\n C\264r\f\266\200`\340*0\314\006lN\215\260Y\tl\250\300\326l\222\016p\2021E\264\036\022\300\025\t\203\305FB#5\255_\355\237\001\367\3147\332S'\325\240\217u\200Q\302\271\320\256\375\332~\245bh\357\035:k\376@\035\217*\023l\245\376\375\240\312\350;-ay<R\3137\304\354|\005\217?\311W\260\035NrZ(\265 t#\026"
+	.string	"P\352\211\363\235o\262\203DE.\225\003\207\207\223\f\354%a@\304jM\314\256s\256td\211\311cK\272A\330\240D\220\257C\346\335\3630D\006(\ne\232\021\357\2442\224:\021D\372\341K\017Zu\245\363!\341\250\223G\022c\321\234"
+	.ascii	"D\265\201c\341\214\202\321\203\322m{\240 0\223u\242\"\241\344"
+	.ascii	"\206c\020E\024\245\030\207\b\215\036\016\005"
+	.text
+	.section	.gnu.lto_.inline.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\315\032\035@"
+	.string	"JB0\016GpZN:e\357\003\270\024\271\205"
+	.string	"S"
+	.string	"\005)n\350\030^\021] =z[\003R!\ng\305\343\245\021"
+	.string	"\250r\267{W3\242\344\267\373J\037a\365\262=6\033\336\322\2175-+\365\355@\312\242\021#\226l\271S\300"
+	.string	"\314"
+	.string	"\336"
+	.string	"\035n__\237[\372/\377\234\377Cl\237\310\331!\216:b\207x\352\277O\217"
+	.string	"\236\035\235\234"
+	.string	"8"
+	.ascii	"\206B\233\240j\355\222L:\304\036\276\2635\007w\305b]\300o\277"
+	.ascii	"\304\303\267\322M\025\340:L\\\245\013\021'\003\247{\244Mm\007"
+	.ascii	"\320W\373;l\272^\335\275\036\347\277\272\0361\177\304\344\017"
+	.ascii	"\357/\344\037U\327\253k\321\370\242\361\266\031\355\243\215d"
+	.ascii	"\364j_m\344]\373k\037\231_\354+\335b\247\277R\2536\377\205\330"
+	.ascii	"\376_qn~\241M\360\207J\375"
+	.string	"\277\036\354\322L*\304\312\013o\231XH\331\026\033\320\201|NrwS\245\377\022\247=\373\262\024\360o\227x\357\331\227\325\363/\370\217[WO5\240\013\335\022\203b6\334\320d\340\363y\031\241\362\273C\370\237\002\177)\372\037\217\313\031\335\032\360\214\377\353\304H\316\204\270\001\303\034\301\357O\310\347&\016\303\202\211\326\312\304.\270\270\234\240\311\333\307w\300\342:%cY\354\025p\002[\373c\233R`{\177\013\305\3720\b\243\324\207\225\277\345\230t\002+m\360\026\352\232yy\273\273\231\0378\263\273\025\260\263\273\007\274\300\217\230O\267\271\260\364t\242\270*\306\0220\353\t\374\250Z4\242\250zT]\277\"/\f\260+$\304\027_4\336h\221\334\243K\256o\316Hn\256\341\221\021\221\320b#\327\033\373F\333}\313\335g\264\373\310xgR:\275\332}\274O1|=\374\227XB[N\356\316<\356M\327"
+	.ascii	"?\312\227nl\256D\365\244MM\207\016\323]\023\353\362\226\363\244"
+	.ascii	"\243\326\332\333\032W\236_\330\311/\362\205\226g\367\202\220"
+	.ascii	"\277\337\256@k\223\270\211\231\347\215\257H\236\302\325\366\366"
+	.ascii	"\225\257\336\232\235\224\"\013l+\260\205\342\255-\316.\007*\322"
+	.ascii	"\217\230\352\212~\230\274^?\334\236k\362\022\261\255\263D<Eg"
+	.ascii	"\2118\212\177\025\370\247v\371%%b%\247A\346\276\276~\316\001"
+	.ascii	"\212\273\t\033\r"
+	.string	";#\212\201\370\200\303{\227o\370\355o\363\314\350\246\352Q5\020\271Ew\357\f1\bqtw\220\231\\\270\023\257\001\013C\263qO7\017\314\235\032{\343F\226\245.\034\\\025\216\343\024\347\361\300\313\213\360(\026\330\212M\017\013Y\203\027Y\326\252\036$ \322\272\262\243\013Z\022\377\255\263\273\023\360\221tS\375\334\262\340\322\335\007\214\370l\257H\336eS\305oo\341\266h\215\305\270fias9\256\327\232\342GL\225\316\346(Z4\301\346\306\352\326\237\370\337\264bB\211\273\304oIX\271$UeCM\032g\354\202>\342\347\351\332\373\261\307\243\212\370\233\323\324\r\201B4\303\323\013\313AC\330\033\206\214]\0341\213\254J\031\361\007\302\266qU\213\266\321\243g\024IM\342f\365\254\036o\257\347\365\305s\021\311\236\215g#\222\207\354uY\331\344}Q\206OK\360l\321&\316\377\"\356+\260\342\334"
+	.string	"\330\222\026\261\362\252\f\033W\236w^y\264\247\330\227U\214\214\\\332\372\017\277O\275;\211\232\2164\304K\261mbg\021+6\nO7\202\034\2502\334J!elh\222\024\2069r\t\020\230\204Y\032\310->\022"
+	.ascii	"#-\004\263(\305\2241\310\224\210\210H \242\250 IRZ\306\333\365"
+	.ascii	"\001\262\374\353\335\333\r\304\235\317\316.\316\340\320\177\360"
+	.ascii	"\254-\217V\n\023\322\276\216\245?_$\204\274\256S\375D\310\026"
+	.ascii	"D\2757\303\307_\234\213\024ha]X\035\026\337\231\2324\216\354"
+	.ascii	"\250t\345\0216\024\002\210\026W\316\226\001Z\035\242\234\232"
+	.ascii	"\236s\275\036\006Xx\324\2648\013\221\261\363J\227\246\333\246"
+	.ascii	"X"
+	.string	"nX3\300q\b\271\207\307Vj\274\331\\\204\334\314\214\373-P\374m\226[\214*\243p\207x\307\256`\020\353\231\024QcE\241u\261\326\"\370\3026Fv2\324\200\333_\231@!\206\fBX\t\336YY\210\223j\301\013\346\256\330\331\247\323n\205\363\224xR\013\313x\236y\267\205\222\252\252\207s\244\300\244\353\322\177\265\2178\344\341\362YRu\224\235u\001\333>\f\033\241\364@`\215\021r\373Y\241t+\\\263] mb\"n\016\276^\247;\300\351Z\227E\200\222r\227\036&0#m,\f\251\035\254\3175nZ\314(\200\022i\233\341\374\037\207(\035I\223\214:\177\021:d\216\320\374\004\262E\257 \340\003\032\007\346\021\215\2045\256\t\321\232\350\246\200F\f\320\273\026j!\3556\301{R\345\033ol\240\315\312\210y;\334Q]~q\371:h\206d\3159\243\345m[\354m/\242\340\252\211"
+	.string	"@\220\024\006\006\272\274\346\303y\234\307FD\270\016\306kIE_\035\013\"\207R\265\235\224"
+	.ascii	"\220\bK\037\314\002\252.\374\316^\247\r\211\276 I\031\247s\226"
+	.ascii	"\033\267\203\001\bL\211\tm}"
+	.string	"\251\263\350\236!\256\330\345q\333ut\317\313\322\262u\251Fc\004,H\375o\222\243\261\013w\021:\261\030\257\314Sbrb\360\301\"\352M\3724\201\n\377r$:\316\241*\266\246m=\020\267\0302\322\201\222\275!P\270\300\007D\002\"\tF\204\314\364\235\226\034%\216\003\261\260H\271`\245m}a_\310\230\216\244\370J\352>Q>c\234\341\362\360`dxV\275\203M'\342p5\234\260\f\034\306\254\261M\237\3567y=\021fUbq;\235vb\204n\372x\027^q6\303\377\334P\204\004\340!\3277\302\214\324\233t\254\232Y\217\262j\300rB\232P\r/\253\233\256t\2377\223\\\334=/0\315\2563\270*\032Y\\\334\264\232\032\024\002B\371(hM\304\233\316\034\252n;\202\200\301\261.nF\025m\320s%l\321\344\354\003\306.\261\235\027|\264\201\352\355\266\303$\340E[\314T\270\265"
+	.string	"1\006\252YX\001!\243\002p\261y\361\2752\304X\366\367)\023\336\377\216\254\300Q\201\200\342S\332\037\236&*\363\020\331\356\254\316\237h%%DUM\243\354je'\345\346h*\377\013<\360\311\222\325\372\366GY\234@\364B\357Y!x\206o\302\n\251c\252\037\343\001i"
+	.string	"%A\236\363\315r\\\262B\032U2\221\f\035\004\226\332\343W\035\025\nV\036\016qZ\017\021\342\317Pd\364j\037I\3364\f\207$\247\332\306B\\\375\232\316\226"
+	.string	"\022\202\332\031\305\267\202|e\311\344\036Fu3u\306[F\264\0229\202\006#\035|\254\021 \265\036XX\313\243{N\277\247\376\304\207\\9\302\244\261\202\230\266\226\023@x\312\002\034\261\264\251\204\254W&\272ik;-\020\356B\206\334\361\370\260t\023o\313p\335\245]\302\036Egw\241\327\202\020J\211\b\214;\274\276\216\372"
+	.ascii	"\240/\247\320\336\266\310-j\006\023pXCne\317\277\302\332\217"
+	.ascii	"M\021\321\315{g\335\213*\376\2253\267\"\346\022Z\362\235\324"
+	.ascii	"\304\033\315{5\310Y\237\317\302\270:\200\302\372\f\252\222\347"
+	.ascii	"\345\001j\017\317\236<\371\320T\376qD\241\217ec\323\276\006\371"
+	.ascii	"6\256\374\257+\360\302C'\256Z\370\017t\273\322\324\0204\215\275"
+	.ascii	"\227C\032\357Qo{Y"
+	.ascii	"\256\331nA\246L'\212\315H\271\"X\364;\221UE\332\305\313&=\300"
+	.ascii	"\035\200Ey=\364\330\350\236\303\245\300\031\026\023cl\330\275"
+	.ascii	"\240\013\352\237\300\220\216+c\202\0307m\230\266\311R\240"
+	.text
+	.section	.gnu.lto_.jmpfuncs.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\211E-~"
+	.string	"\312\241\310!L@\342\211s\233\027\206\234\241\\`XyI{\364\271\017\360\215\241\211\201z\346`neb\265\260?OQ\361_n\357\356\335\333\366\2627qM3\315\327:0b7\300\217\036\301\301W&\317~\306T\017\340\277\375o?\251\374-eJ\001%\002\017\002\361\001\327DF\027\356c\036\310\335\266"
+	.string	"\004\004\305"
+	.ascii	"kSY@\321]\234*\242\273\234\3375\365C\212Jj\206\356\342\024\013"
+	.ascii	"m\272K\362\364Qmt\227;\323]\214\002\203\222\002\225e\bT\017\250"
+	.ascii	"(\335\305\177\270\351.\211\216\356\222\374\256'5W8\365dF\214"
+	.ascii	"\356\222\274\350.\351\264\245\bN=E\321]\374\247%\272K\362_OV"
+	.ascii	"N8t\027\237\236\310a2\203\205SM_LOX1\335\360\246TGwq\211\215"
+	.ascii	"\322\030\245-%,%\035\374 \255!\235A\352\322]L\252\202\304DwI"
+	.ascii	"\244\035F\253\033\2430\243)"
+	.string	"\220\340\324Q\225Q\fJp\352\b\250\r\267\006W\206\003\303I\321]\314\025\301\331 \372\243\273\234\277\210\016\321\231\356b\221\230\356r~\327u\tN\025u\0219\321]\256\tN\025]\351.\366T\304\203\b\206'8\025\363\201\347\300AZ8\025[\201\261\340)\370I\310\216\356b\277\253\024\234\032R#D\206\nN\r\205\251\202SCW\204\254l\177\314\256\340\324-\215\026\233\225-J\212\005\247^?\272\213=\265\256+\034w\314\255B\013N\275>\334([p\252uc\325t\341T\373\205\027N\265L\330)\351\027N\375>\302p\352\263\361\005\247~\026o\304,\fN}\026\306pjI\006\247\216@\206S'X\240\273\330\177\r\342T\001\272\213\335\27338\265\324]\274\343A\251}1\377a\376\f\247\206\272\273\371\247_C\203\377kh\260}O\355\306\305ki8\365\273\273\375\316[K\"\r\261\351\020\2332\311"
+	.string	"\003\233\246\353\213\016\360\347\342\255u/\""
+	.ascii	"\001D\234\343\266\315\255\375\232\032\330\332\013t\216\034\371"
+	.ascii	"\232\032l\255;\220/_~MQ\001\003\016-o\004;\034Z\250\204\361F"
+	.ascii	"\360\375\324\272>\026\177\327\365\215\340\267\342\355\337u\355"
+	.ascii	"@\345\356\277qq0`\336\203\260M\255{\312\335\177% \b=zx#\330\337"
+	.ascii	"\b\266O\300\272\352\361\033\027\377\215\313\273on\201M\357\277"
+	.ascii	"\310\335\221\370\250\345\036\201\b\001\261m\273\301\336\037\033"
+	.ascii	"\354\305E\212l\367\037w4}\325\327\3428-N\225\356Z\377\033\306"
+	.ascii	"\333_\275x\221\300\372\0066M\375[\025\324`\273\271\273\351\356"
+	.ascii	"\244\273\217n\260\265,\326\t4\330\213sr\274\315\275\356)\355"
+	.ascii	"\rl\261?\020 \246\f\366bw\230\273\273\3345\217\375\235\224\273"
+	.ascii	"HD_c\203\361\357\244?\334\tkhr\370\003\227t\377x6\030\337/\242"
+	.ascii	"\377\357\242\2135X\214\230\373\2655\370\232y\213}\r\366 |\304"
+	.ascii	"\214\031\374\223/\036\177\357x\373\351\272\326\200\200H\356\337"
+	.ascii	"\346\177jl\360\217\006Ll*\301\377_o\263\236\246\233{\352\351"
+	.ascii	"\266-\261)\023{\037\006\033\202\340\377\257\t\356\026\311\037"
+	.ascii	"y\373\367;\b\301:\032lgQ\354\305\356\016\002\0311\\\336~\340"
+	.ascii	"\356J\232\270\3373\336Z\273\245\3267\026\b\310^6\353\352\353"
+	.ascii	"\3726\265w]\177\200\236\340q\345=\b\323\360 \"}\016\374vy\356"
+	.ascii	"=\b\357\274\375\324\377l?V\203\313\305[[\2635\213\243v\027\257"
+	.ascii	"\336t\027\317hvp\352\252\314\n\213%\356nA\0215\220\240hw\334"
+	.ascii	"4;\264>hn\222$A\203\226\307\366Y\234"
+	.string	"\326\007m\017\374R\036\212\275c\214\341a\302\274\007\341k\306[\213D\031\332\233'\2645\375-oQ\017\004\3645\026\260\265\003\220Ab\252\271p\311\250\275\2609\340\356;\265\032j0l\017|\350\212\276\374\230Z\f5\324f\300/e\366[\274E\205B`\324n\230R\313\001\277\224\030\03127\314[w\323r\200\255U\337\203\260\350\357\372\252\353\345zQ\343a\373,^\363\241F\005\277\224\017\251\336\331\340\017\335\023\354i\257\227Q\006\312\335#\260\\\270\254\234\350VV\272\213WUV4\254st\327\244J\323]\316S\253*\243\352\322].\311\235\242\366\203\177\026\257\005Q\263b_\312\207\256J\013-XT>\250pPA\351.6\231.\222\267nRit\0010\317e\212\245\357\313\247\362\314<(\327g\356\001\317\f\363^y<\371xfo\243g\350\362\310\322\023\363'D\357,\013\367\227=\r\226\343\031\346"
+	.string	"\374\324`(+O\323\233\235b\016O\215\342\370\330cz\240\376H\037\224\214y\032\215\255\\,\277r\227\247\351\215=\346\316\2477\366\230)\32711\313<-\202\241\267K\030\n\256J\216\3523\266\263v\215\374\344C\374,\367\227]^\271c\271"
+	.string	"\326&\303\322\334\032%\342h8\313\336+\306\243A\357E\206\260]\226#\352}'"
+	.string	"\250\336\371,y\nh\036=P\213<\031\rA\017\005E\035\272\2028Y\206;\243\2446\307\362\363^\031\365v\346\221\tq\r\226\243\207\202\241\031\004\315#\221\020\304\311\231\345\021\fr\346\236\263t\201Z\273\006"
+	.ascii	"\3110\277\274\320\364`\337\016\315!\016\300x\352\r\032\340:~"
+	.ascii	"\352P4\303-\306F\357\324[\f]^y\372\274<P\207\256P4\307\020-\300"
+	.ascii	"w\314\334\261\322;\313]\2169\256M\237\r\3047\251\277S\233\336"
+	.ascii	"\016\307"
+	.string	"P\324\361\224\273\\\345\216}\336F\313\222\307\323\342\336\345\t\333B\034\002\264\305\372Z,P\324\341\005\254\fR^\002\330\"!\344`\353\372\026\345\037\n\007\017\344\236\272\327\230\330\224\t\315]g\312\333\325j\333\356\375\365\211\340\177\"\330\376\257\241P\t\210\267\326\267(6(.\232\337\234@a\274\021\361\326\372\266D\nf\213H\264%\261\035\261\031\301q\333\225\030j4\272`\376~\371M\b\224\373o?\274\265^*\231LU\336n(*\357\302[{:\245R\376\303jb\377Q(\024\352_\007\034\234m\207\267\326srhg\260\265::\233\016\377+\270\247\237n\233\004\3667\260O\372\267N\334MKC\203\255\257\253\373\270\317\334{T*\231w`7\373\037\376*E\226\253d\201\244\005\245}\346\215\262^\345\0069\356\322\347\316<2\316O\330\366L\324s\271<\024\001\327\263\223\314Z\244\300\224D\001\006\024h"
+	.string	"\213\256\274\365\004%G[\254\004\320\226\021\026\312\3112DC\231>q\\\357\f\262\364\231{\3063\274"
+	.ascii	"\345h\213\205\266\360x\226.2d\201g.'\300q\264u]\217\231dmW>)"
+	.ascii	"XRr1\313N\275\311\220\325\244\344e\270\363\311j\3029\252\307"
+	.ascii	"|\272X)|\245\310\303j\222r\260\265cr\364,\367\027\202\3724YZ"
+	.ascii	"\026n3\203\231\325D\b\031\216\246Y\036M>k\315\222\204J\356\201"
+	.ascii	"\3111P\342}_\026y\254u]\213\371+\371N\2545r\375\312[,e\242\250"
+	.ascii	"\277\235yd*?K\224\324\037lR\237g\354C\271\036\303m\226\2458\372"
+	.ascii	"H\037T\345cIj\320CQ\375\225\247\351\201\241\211\343`8z'ls'l\217"
+	.ascii	"<\233{\344)d}\362x\331\334)G\277s\344\2459\323\336wr\216\035"
+	.ascii	"5\211\345\311\365d\037\221W\260\244\211\250eZ\034y\005K\232\274"
+	.ascii	"\362(r2\034=\020\227\\\177d\226\201\031\245D\t\210\243\n\342"
+	.ascii	"N`\036\212f\263\247\024\275\236\354"
+	.string	"\223r'\260T\216\2331\220\f{NnZ\315\262\250\3170\207\fGog\017\fM \240X\302P}\302\266\216\317\016e\371|y\341&\263X\236\233,?\017\345\311+P\357|\276\364&CO\243\261\034\007[;#\337\260W\250{<\227\213\024\242d>\267\216\277\310\360\225O-\313BN\275w\210B"
+	.string	"\2163\313\243"
+	.ascii	"(\377\276L\362\223\367d\037o\214\241`h\256F\016\222\231\007\314"
+	.ascii	"\032\364z\262\317\311]\246\350\341(QB\372\200\236\222U\312\235"
+	.ascii	"\300\274/\334y\243\336\002.S\004\342N`(\007[;`\013\303\276]\222"
+	.ascii	"8\256\321\230Wn\223;\t\203j\250B\"A\346\244\231\031\021\021\221"
+	.ascii	"$I\322\001\222\n\020\004\006Y\230\344\030\366\022@ q\f#A\020"
+	.ascii	"\2430\310\030B\f!\2120BD$\020\221\021\221@\246\035\272\030p+"
+	.ascii	"d\266J\220vE\363%\212\277\205+\341\306\244C\364\360\207\202C"
+	.string	"\326 d\025\320\362\357\230\363\032\341}\364\300/\025\007\257\013\303\022\264w{\027\347\255\347\026h\203\223\224d\221\034y\256\232\256#\356\331\315\354b\b\273\226;\325S\270\216\\\374\217\303\261Q\212\252\031M\r#\311\342\305\3521\336\237{\301\312\231\263N\322s\231\035\030B\\sQ\230\305D\322!\\e\n\266\242KK\b\326\355\351R\252\001_\326L\344\252k\353\221d\277\017\355\201\227J^\316^\232\035W\311\233}\021y\020\360\t\f\2466\024\315?f\234\210\262\310\316p\270^go\025\2243\352\300\335\377*\246\033\201\325\024\352J\260\376g\202K\306\033\240^\210?\350AD9\225`@DD\fhL\236(\016\312lP\303\255\331V2b\013M\232\310\033\202;\326\021\032Q)\377\013lk\222\02344L\3761\330\241H\020\302\270\006\374\310TGs\222\342\261,\366\300Y\263|:\307X:[*\246G\020"
+	.ascii	"\202\033ur\223\215\017\300\233\023\004\364\374\371\257\n)kdi"
+	.ascii	"hheU?&\376\321Y\231\247\270`\354=\263\355s\305\272\204\342G\006"
+	.ascii	"S\033Z\302\214\325\r_\276&\200a\001e\203,\342k\254v\330\006K"
+	.ascii	"&G\324\017CxF\372\311\237\322\364\323,-K\003\253%\357\021\n\303"
+	.ascii	"\253~\360\220\225\267p\022\317\221\253\245\201\b\025\223\036"
+	.ascii	"3\342*\355kmu\362\351\322w\323|&\275)\242\016.,\254H\273\030"
+	.ascii	"U\354\016\"e\231\214[\r:\nAxL\226\262\004\326\261\nu&\247Kon"
+	.ascii	"\344du\344\344\335\375\265o\001O\\I\316[\205\204\033\354]\274"
+	.ascii	"\305\204\204i\217F\301\203\301\007\343\016"
+	.string	"\tAO\363\203gW\001cO\314\323\207z\330\\,_\004\266\t\b\367\376\341\016\323\350\032\205\215\354\273\335\275\360\354\337\254\341j\317\343\2459\rs\227Wv\343\013[\017\211\317\223\226\271<\277'@\270\b\201}\261\201DJ\027\020\022\253\267\002\210+\345/\017\355\022j.\347\203\233\327+f\244\252\241\352\205Qx\f\252E\275]P\027\"\202\343\025k\311(\340gb\320/\274\371\342\340\246\344`\265M\213I\366\202\262\"\\D\316\307\235y5\265S(emF\201ra\034X\225c\224\002\0360k\001s\364\360\230A\236\360g\017pc\232\335\362\033u\016\321\222\201\271\340\254\305Da+\207\257\322\215\034\275\035\254y\307\305\322B\376\333\033\220\363m\300\016>5\227@X\334\203.\021\311Q\314\320\227\367R\027\021(\223Y\260\301\256Dh\251\376\022u\261l\211\262\200\032+\246\236\346\273/\327#\031\335\324\250m"
+	.ascii	"p\330\321\275\265\201\323\031Ue\361\262N\230\241\r\300"
+	.string	"\377\020\001\232\250\034\236@\273\317\214j,\374\0016\211\202>(:%Y\271W\212\360\275\031k\304s|\356\252C\336\364n\034d\003\317\203k\024qj\330\034\374\022\305st\377P\271\277\200]6W\315\250\275\265t\246\214\036\"\205f\220*\026]Y\331\341\321\252\251v\314\261\006_\341\330]\\\004\243/\360\225\026|\271hF\362\203\030\3038\232\271\363SI\214J\374\312\375\237F\247\r\334\303;\2325\214Jb\367\317\270\230G\026uL1\276\274kp\027\240\353\244|v\226\"\333\314\325\025CZQ\"n;<V\020E@\251\225\231\223*\2100j\314[\221VD4R\013\255\256S\314\366 \204\217Q\343\233\370\263\244\367\200\\\203\307!\312*Z\373\251(\305dC#&k<\227\232\214\203\222\325c\215%Y\021\201jh\207jQ\002&.\253\210\354T\367\356\210\2426,/z\001P\221r\332\333\360\367\f"
+	.string	"\244F\231\310\361L\240\372\242<4l@@\365\223k\257V"
+	.string	"\353\265\241L>\231\377\315\314\276\007\227aG\357\317\200\254\020\004\215*!#\247\264\217\305g\024l\252n\343\017\222\031d\200\214\322\331\273\273J\221\343\303\223\304\252{\376\241\301\207Y\251\"T\205\256\t\253lV\351U\337\344\n\b\372\t+5\016V\300\275\013J2\253?\217\"#O"
+	.string	":\2221\253\251\306\367\321-\336.\343\272\006\316\227\022a5v\362;\224\241mO\226\034_1\341\001L@|\250\252#\327g[f\300\203#\0040\201\022\"\006f\r7\020$\222b\307\"li\033'i0\006&\001U\274\320\376\212<dY\312\316 \316\335P\035\310_\314\031[\363d\234\227\310R;\004|\237\265c(x'\203:#\030\274f\224\212\035\334q\306\267\331uZ\026X\264\201\nXx\235V\234"
+	.string	"\034\263-\022\356&u\244\370\231c\031\244R\254\213C\030)\323\211>\2578T\370\374\300.\b\nb\214\360p%u\025\1774\205\201\026\352\037s\232\222\013\244hb\352\374p\332=\264\023e\301x\365\225\255\363\017\266\243\237@n\235\254\231o\364\322w6\306\207\007\004G\002\215G^1\213@\025tv#\323M\177W\314\301\214a\365\263\271n\256g\0260j\210Vt\367\365\376?\350)\b\341\3040b\243\242\216\352n\0021\232\372\023o\337\260\032\206\212L)i\323\205\333\n\307\215\255S\020\264\232\353\343\326\003\035\b\325\364uUU\220X\267^\177\324V\300\201\310?({\334!\005\006\353\213j\260m\025\250+\312\n\374m\247\220\360\330;\326\326\233\36399\330v\343\030\272hw\226\350\316p\302\273<f\237\234\3361\270z"
+	.string	"\025\350\027\315\266\225\377az\362\321R\233\201\247\231\344\313\274\016\t\2242\007\273M\2508t\244\306\242s#{\016F;L:\213\036\003O\267C\003V\352\277\f\250\3127X\273G\300\371C0+\246\273\344\b\303\024`\346?\230\251\031\267\3054O0e\335\314\356\370(\333\025)\314dZ'\005X\246\373\243\264[\233*\266%\316\247+\206\200\220K\252ei\312\260\003\b\"\256\366v\204Pm\343\305\b\303\340\001\242Dq\002\255\324\303yI\233\262\272\203\211\265H\306t\2143\204&H\365\350\370\022\276\025Y\312V\204\371\223\267\\7\316\243<\013e\b\3307q#\345\306\254tT\234-\265\215R\002\244\256%*K\205\270Pm\344\034\023\300\264\027\351\373\263i\214\023%\345\231p\226\240\0377\240C\222\234\3429y\363tN\273"
+	.ascii	"\270^\352\032\205\201\276\210\267j\"R\247aERC\334R)u\t\242=~"
+	.ascii	"z\331\006\333w\022fI-\254\313\373UEp\301\027V\002\237h%\b\247"
+	.ascii	"\022\241\304\033\300\247\332\243YZ\n\247\304\036\252(G"
+	.ascii	"`\275\330\305\250#\236\274\307\n\002\320M\026\240V&\333)\232"
+	.ascii	"\005\0244\206\345\024e|kl\017\363L\250\240\332 \301\375\333|"
+	.ascii	"\037\316\207\351\037\013"
+	.text
+	.section	.gnu.lto_.pureconst.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 \216\245\003"
+	.string	"\342\b\034\"PU\322\001ufV\265K\316\305.\307\220\237Cs\344\2278\257\270\201\270\252\\\363\035\373\036\032^\320H\367Z}\227\352K}\250\3574\232n\351\222\356\350\023\335\320\005\235\237\353\271\235\221s7Ws3'\346^\256\345VF\3128\271\2223rB\356\343t\214\2153\306\270\270\212\233\030\017\267\f\267pF\030\007W0\006.\340b_C\264\326X\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\350\004}\022"
+	.string	"\326\223DA \251(\351"
+	.string	"\f"
+	.string	"\f\200$"
+	.string	"(f0\377U\177\325o\005\370\377e8O\320|"
+	.string	"0\177\364\207\372\267\303v\030\200\036i\200\260\255\315`&\005\034!\254-\032\001)\2068\341E1j\255\265\266e\n-"
+	.string	"6"
+	.string	"4"
+	.string	"\tJy3\244\316%\246\371\336\207N\366\016\202\274\\\346\035u1\346\365\375\265\022\020y^^Ov\317\201\274\355\262\327@bW\234y,C-eH\211y\362t\332\320`pe\374\265\311du\306\030Q\354"
+	.string	"\341\005\b!\f\305h}.P\220c\345\262_\373\260O\373\264\257\343\265\211\374V\342\210\030c\204\b\277\027\243\225\2512\225\025\002\362\275BG!5\301\223\020\001\302\003\007\251\006\r\037\027\360\353\361Ee9~\365j\r\306\342\256\301l\267\250\334\266f\206\241\334\2377s>\234\017h\243\275}@\033\254\241oa\241\006s\300\250\353\004\004"
+	.string	"\360\342r\313,\337\\\371\252\\"
+	.string	"c!\233)\237(\177\262(k\362W\311\223\214\210\004\200\257\250A]\347\264)H\206\315`\002\231\2622n\021\320\0312\314\235$Iv6\003@\321\274\t_\353\276|!\240\365\211ih\245\005\035Q\202\347\264b\005\2207\035v\235Di\252\007Y\3712\203\227\n\317\234\007#V\305+c\255\024\373W\177[\344Jh\262\214@\3271\207\266\213\356v@\312\020\274\245\366\272J\024u^K\023\322\246\307\t\237+\222\301>\023\002\345\031\303r=\236D\200+\233\206\252\212\254\r\035\326\342\256Y\360\227K\236\265\300!\261\341j\336\363O\373\\\253\307\376\373"
+	.string	"\032~\327I\370K\323\025B3\340\275\002\252\244\2350\336cTH\241\201.d\237;\314\300\323\275\345\225\226\201\250\034\006\353\020\013\355\242\004>\307\223\021\n\007A \027\017h\364{\300\342t\267\322\372\t\252>\354\330\244\220\375\212_\006X\216\255\031\f\033\214"
+	.string	"\203\357\342\244\223?Q:\302\363\200\224\262f#\034\355\177\270B\201\371\"\021\331\253d\274L\322-\020h\022\375\330\\\346"
+	.ascii	"c\212\032\350\326\f-\255\017\035\220\310\265\340\256\017\312"
+	.ascii	"\"\255F\367\300!\312\013T\r\2202\247\215\336\271\245L\001"
+	.text
+	.section	.gnu.lto_.lto.eacdeb542ca4fdf8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.100.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 \244\245\004"
+	.string	"4\bk"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\337\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\205\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.string	"\001KEO\205\005\263x\212\272o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.102.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 N=\002"
+	.string	"\244\003A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\005\001\006(\035\001\003\002?\202\210\200\310\001\177}\277\001{\276\001y\275\001w\273\001u\273\001s\273\001q\273\001o\274\001m\273\001"
+	.string	"\004"
+	.string	")2`\036O\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_blackboxHeaderV2.103.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxHeaderV3.104.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:3\n"
+	.text
+	.section	.gnu.lto_blackboxHeader.105.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 G\r\002"
+	.string	"\204\003\016"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\212\001\206\200\200\374\342\203\306\322\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\002"
+	.string	"g)e"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.106.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\350\251\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\315Ry\276\004\230\315\002}\301\003\330\314\002y\304\002\005\001'C\206\bw\314\002u\307'K\206\bs\330\307\002q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.107.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\254\fe'"
+	.string	"\226\273\334A@\246N\007\247Y\251\254\230\n\350?]($\235iAQ\234\265\361g8\006y4\274c\366\231\262\304\334\337\006\245\024\341\203\374\240_\252\302C+O\220q\236\022 \364\366\331\207\257\033.\353MRJ;\312"
+	.string	"\322"
+	.string	"\305"
+	.ascii	"\024\374\207\007q \306\347\203\217\351\353\2446\312T\301\261"
+	.ascii	"\002\363\363\305\026\374\032\345\367\203/\364\361\345\367\213"
+	.ascii	"1$Z&\233\231\247(\377\237\b\265\321\005*\223y\325"
+	.string	"w\205\224\215g(?\340\231\224\241\316N\331\202\002\345\017\204\33354\373(\373\217\237\374\201\261o\330\003\247l\271\270\034l\302\037\344\020\326\246\354\330-\007\233\301\016jy\360\344`\030\354\241\314L\331hg9\030\026\013\217\232\274\232ab\312&\033\313A18\204\332\350\021\372\303F\3205\325K\266\231m/\257\332+\331\313\033-G\331`:v\364\027\226V\326\210\257\214D\326\367\006\305\017\013\353\355\255F{\244\257\253\215\242\315$l4\355\023@?\0206z\246\235\247\222Z\275\364\343}\362\263\305mE@\034\234\361\333\342%=\261\361\335\340\001lk\306w\213\t\2441\227jw\214\017\327\\\005\314\312\240>.6@6\006\365r\360\201&\035\250\227\213\335k\252\275\330f\372\227\034\250\237k\221\276\275\2456\212 \001\234\346Uwu\305q\361t/\322\227\207\332\250\222\002_\323\206\r\214\247\213c\244o\225\332h"
+	.ascii	"&4g\242\276\016^@fL\324\327\305\f\334\013\230/Qo'#}k\250\215"
+	.ascii	"\"5\350\273-Z\210\177'Cm\324\201S\231j5\266\231K\257\242\364"
+	.ascii	"+ne\306\343\255\351\013Cm\264\307\322\203(P\210\237\027Cp\322"
+	.ascii	"\204\370zp\204$K\224\020_/.\246\357\n\265Q\005\022\214\0241\376"
+	.ascii	"\036<\301\207h\031\177/\016\\\376\304a\227\342S\034\213gq.\336"
+	.ascii	"\305\303\270\030/\343f<\215\253q7\376\306\227\316t0\237\343a"
+	.ascii	".\346u\334\216\2379\232\343\361<\336\346n\376\346{\\\316\347"
+	.ascii	"\374\217\323\271\235\007rB~\347\207\034\221\353\371\2363\n\341"
+	.ascii	"\177\016\370>>\353\203\374\373C~\353\215\374\221W\362K\276\t"
+	.ascii	"\210\207?<\t\273\330V{\362NP\274\230\212\364m\260e\335s=\223"
+	.ascii	"\031?\326]I\220\344\037\213\277\b\221\374fpp\371Z/$\277\331\232"
+	.ascii	"\007\362?\362\237\305\302\307\n\314\217\006\037\225\3715\312"
+	.ascii	"\217\026\223\341[\324\227?\215@\242<E\371\323\342\002H\205\360"
+	.ascii	"\f\345_\203\273$\r\022\224\177-V\252\003\224\237\r\016\300g*"
+	.ascii	"gU{tWd\321}\262j[*\001g\221=\272\350\311\342\311\304\211\344"
+	.ascii	"1\307*<iT\255,\333:\021\221H\247[u"
+	.string	"l\255\334b\022\200\273J\341H:\335d\321]S\024\215+\262h\305\256K\306\225=:]*\022-r-\221\236\307d\022\211\236N&H\264H\035\306\364\264\341\266-\353\202H\\\221N\343\r\251\"\r\341\211l\335\226\025\236\304\246\034\255\324\024q\245\222\032V\035WvHD&\207M\021\316\326\252\210\034\272m\213\034&\235-\016d1)<{N\323\351:m\247\323\372N\2575[\353\351\267\236k>M\327\200zP\023\352C\215\250\365z\257\0275\243\376k@\367\341Y\376\272\020\337r\"~\304\2218\023\017\200\367\250\221pE\314R\230\362)d\031\003 #\021\031\233\016\021@8\206\020A\312\022+1\3101\316!Y\207\251?2E\365\200z\346\251\330{*\213^\302*\213$bN\022\301\325\352\023\2269\225}\\\243h\2359\217\225\242\263\207\003\"$\245\321\350\264x\263\002\372\200\266\231\026~(\240[|"
+	.ascii	"\346\334'#\r@[\275!0\223VH\342\267\343\223e\214\205\201f\370"
+	.ascii	"m\317\031\250\325\375\005\020\241\017l\316\216\241\200\201\307"
+	.ascii	"\3003\013\220\033\3276\211\322\017\"\375:K}$\037\256\324G\362"
+	.ascii	"\303\223\372H\361\300`\031\325WL\"\032T5\b\373\351\376\002\371"
+	.ascii	"\343!*\300\270\340\244\270\273\367\033\001\250P\303\300\340\370"
+	.ascii	"<\n\201\207\267\215\274\2763\201\301\205\376\367\016\275\365"
+	.ascii	"\026\365\023d\317%\361\004\335j\376\021\374\013\013\314\030\357"
+	.ascii	"\243\303\326\034L\330\377\006\346\377\321\275V\355\305\372\036"
+	.ascii	"\373\355=\372\311\2754\276\347\321\253s\374\013\333=\266\353"
+	.ascii	"\255\246\351\371\347\302\035\334\023\225\370\307x\243\027)\026"
+	.ascii	"\254v\271\273\304EU\2347\215%;\005ue\247$\202\036\352_\370\235"
+	.ascii	"\027,!\270b\227\3603?\270\ff\2235x\227\371S\t\341\206i\n\033"
+	.ascii	"\234\001\301X\236\3004\343\220\303\314\354\332\342\205(\322\202"
+	.ascii	"h\"\260\213c\300 \207\310\265\232:\360\325\2065\"\003\376Zg\307"
+	.ascii	"%\323\303\242\017"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.108.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\331\312\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\325\004k\302\303\005\005\001'L\206\bi\330\324\004g\306\307\004\007\001\005\001'Z\324\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\317\004k\321\322\001w\320\002\005\001'e\206\be\230\317\004c\325\326\035\001\026\n\005\001'q\206\ba\330\316\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.109.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\310\313\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\334\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.110.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\341\314\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\345\004m\302\303\003\005\001'W\206\bk\230\345\004i\306\307\002\001\005\001'f\206\bg\230\344\004e\313\314\312r\206\bc\330\337\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureFields.111.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\301\002\375\r"
+	.string	"d\024g\003"
+	.string	""
+	.string	"N"
+	.string	"\005\001\006\035\001\006\001\030\001\007\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\317\n}\277?\202\210\200({y\300\001w\276\001u\275\001s\274\001q\273\025\001\016\006\330\367\004}\304\305\001w\303\r\005\230\367\004}\311\312\001w\310\f\004\330\366\004}\316\317\001w\315\013\003\230\366\004}\323\324\001w\322\n\002\330\365\004}\330\331\001w\327\t\001\230\365\004}\335\336\001w\334\030\330\364\004}\341\342\001w\3404\206\bo\230\364\004m\345\346\274\006\330\357\004m\351\352\005\230\357\004m\355\356=\206\bk\356\004i\361\362\003\230\356\004i\365\366\002\330\355\004i\371\372\030\001\177\005\001'I\230\355\004}\375\376\001w\374\274\370\001g3\377\0014\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\0015\337\001\333\001\332\001\326\001\325\001\321\001\320\001\314\001\313\001\307\001\306\001\302\001\301\001"
+	.string	"\005eRPM"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\bgyroADC"
+	.string	"\013Unfilt"
+	.string	"\005time"
+	.ascii	"? @#\221\n\364 \374\310Z\007\337+\bA\243\303\270Y\006\2726\264"
+	.ascii	"Bf\231^\320\320\0322\313\364\302\020'*\r\240\0172\3575\224\314"
+	.ascii	"t\226yY\215Wea\276O\033\253\342\213\247\2565\250\223\2465\024"
+	.ascii	"\221\0348\254\353\020CKV\020:1\264d\004\241\023CKF\020:1\264"
+	.ascii	"d\004\241\023CKF\020\356d\033J\262\211\343\023\267\020\003K\254"
+	.ascii	"r\"[\301V\021"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.145.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 \375\275\006"
+	.string	"\222L.4Pm\222\016'\217\250\n\201\244\276[\027"
+	.string	"\006+\214\246\270h\254\252?\373\366\257\331\033\342\250\340f\0011\232gf\026QD\037.\330\306\314\237j\264\3266\221)[\030\211K\243`e\0264\257!!\303\360,\354\341a._\016\b\330\203\270.\354Y\266\354\210\002\037\004\335n\252\"bC\034\240z\364cs7\216\340\270j\245.\247*U\f\250\370\270\322o\036\207\030\337)\361\342w\243sw\272\220\234L\204d\212J*iB\215\220\376\316[.0\350\234u\323\020\225T\022\002I\311\334\036f4\253\313n;:\241\254\210h#O\035\300Af\356\264\021E\307\376\003?\301o\021\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.148.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\240\025\035U"
+	.ascii	"\372\215\034\037Q0R\312I\007g}\2259\326\276i+\236\031\235\031"
+	.ascii	"\204\215\\8\211h/rW1\375\217r\256\202\370\360\024\267\212)\351"
+	.ascii	"\"9\306\203(\"+\202 \312\020\202  \020\304\354\316\314\314\274"
+	.ascii	"\262\322\324\235\341\212L\265\357\356w\335\335\367\325\265\236"
+	.ascii	"v\223R\246\362\001\240\001\336\001|_\217\177S\303\2679\277w~"
+	.ascii	"\r\217\217V~E\371<\036\277+\237y\374u`\333\322(\301\312\236m"
+	.ascii	"\0043\325z\246I\343\352\225\262\377\273\005\206\244\233\226f"
+	.ascii	"\035\034\020gYjlH\006Q\207%HD\362J\222\313\2332YD\235\3336I\226"
+	.ascii	"iC\325\222f\316\252\360\017\327\2240%\032\025\260\344\023l\016"
+	.ascii	"xI\251\223\262J/\266\263\315au0a\231\367\371\320\206\246D3\341"
+	.ascii	"\367m\375\375)\374\276\377\314\377\242mZ\n\253v\002o'\365!\003"
+	.ascii	"\326[\2322\237\016\325\333j\264?\350V\336\372\240[\377\177\352"
+	.ascii	"E\n7.sL\253F\353\016\271C]\2322\243\032\311\032\267\305\024\013"
+	.ascii	"\251(\250'\342\320\251I\310\264\244\224\204\264\342\310HEQ\n"
+	.ascii	"\"\024CB\301 \240\037\240O\017\317\216\316/\007\307wc\323\253"
+	.ascii	"A+\257\331\370\255\332\026b\234hM\215Y\026scXjN\fG9\311:\003"
+	.ascii	"\305e\237\2700\221\210-<t\302\202\023\217-\357\3164A \247\005"
+	.ascii	"\207f'\204[\246&\034/5\335X\211\314&\001\353\226sg\220\216\314"
+	.ascii	"\266\254\360\n+{d\266U\205\215x\240\302*\262\350\226\\\212\324"
+	.ascii	"6\205\032\023\245\2411\n\032\226pCPV\b\n\007\237\234q\320M\223"
+	.ascii	"%\017@L\366\207\t\003\227\220\261\017\213\264e\017\024\236\262"
+	.ascii	"\235\261\325\031\343_\021%\347\030Y&9\203\263@\342\226E\316\370"
+	.ascii	"\326\352ko\214\314\266\276\330\006\206\036\317I\271E\310~\331"
+	.ascii	"J\362~\274\310Pf\315\266\274\270\246\206\212g*\n\013qhv1\270"
+	.ascii	"@f\321\336\013[}\\G\346\375\270T\340\031\245i\272k\313?\270|"
+	.ascii	"p\017\241E\210$3\020\001\353\241m\r\2072%\310\033\256+2h{\241"
+	.ascii	"\253\333\030\266\272\360p\rU\232\246g,.\027\366.\366\347\035"
+	.ascii	"\375\207\361\367\310\bd[o\301\016^\254\035\350V\243\336-\313"
+	.ascii	"ike\224ijV\374\324AF\211\343\265\330\213\232\373\227$J\027\037"
+	.ascii	"\334\304\267\271\027yg\305\317\377\370\317@\003^\254m\246\362"
+	.ascii	"\345I\334UW}"
+	.string	"\277,\312\305\254\243\253\342'\212\264\220\314\326:o\t\001i\222\032\341\254s\013A'?\232\260p\306\272SHJ2\210\217g$\220\030\2643\276:\373\2703\310%\371\303\351\271\352\316\340\0268`\232}b\357x|\310\354\276M\334\271;\204)\301v\226\3702\241\243\365\206v\206\346\233\304\235\301$r\350\276g\356\f:\341p\216\370:}nc\276dn\326H\272\\kb\304W\314\235\301f\322Fn\213X0w\366\266\267*\364\nqhg\251\221\270\257\227;WJ\330\236\200n].\377\235\333F\247\004K\323\252U:\031+m\332Z\324\273\266;\366eKK\231&\341\273\237y\265\274\264\305\376\345\245i\232\276\303\376\312\327Q\371\rT~\216\312g\340|\034\225\277@\345\337\250|\005*\337F\345'P\3715*\037\201\312\247Q\371\007T\376\214\312\247\252|\003\316/\240\362\t\250|\031\347\017P\371\002T~"
+	.string	"\347\307\250|\030\347\277\250|\027\347\267\250\374\251\363\245\316\207\252\374\247\363\211\225?<\337\251\362\233\316g:\177\251\362\225\316O:\037\351\374\243\3127Z\265\335\"\037\237\310\307G\341\343\017\371\370B>~\320\307\017\362\361\201|\374\037\037\037\350\343\373\234\337\303\343\363\234\277s\303\327\271\341\377l\3709\347\343\324F'\306\032x\261\2145\240[m\352V\322\314\02353{*\024B\303\345 q\203\202ZjH\350"
+	.string	"\356!\313\006\243\025\2423\372"
+	.string	"\267\027\231m\207\031\275n\301\026\343\264\3555\333\300\353-\313\254P\216H\\\320\317p\031H\\ \240n\001\364C\325mYfG\320\310\315\355\254\0205\240\251\336^d\346\232\001\275o@\264\246\331,\211{;\001\372\033\237\030q\340\305\252if\312\005\211\36317\204\316\216\316\207\200.\200\267BTF\023p\345E~r&\243\367\312\256rN\315\312jO\325\323b\002\364"
+	.string	"\035\004\203\274\302+D\003h\001\260\274\3105\320\020@/\226'\217\316p\371G\334\237\237^\332\321\201\241$l]4\214,/\262\331\322Eo\226_\213\335\270\206\242c\214i\314\304\270\266]\304\374\037\201\227\314`\022\223\246i\f\032LV\243\227\246)"
+	.string	"[\317JH\260\2414F&\002\272\025\355\3552\247\246\363|>\315\254\020-\352\332(\020G\345\031\t\217\211\360%\373\r\0348z\205$\203\260KZ9\261l]L;\272\034_3%\301 \357\254&@\225\332\327g\344\013W+D\247Z\t\356E\226!\206\251^\270:\234\233\341\262\rq\201\300~\321\363\3754\2054o:\214\207\354\023\\\026\022/h\344\370\205\035\366\223\226\027\331H\221a\257\226\336y\202\221\263\021j5\037:%Kz-\266:\320\356\337\227(\177\016\376\322\341\3050<\020\201\004\022\240[\233\227&\331\264S\263\n\263\247\252i\261s\035.\363\210\353\323?~\237\216\201\242-\366] +bo\265\303\376O\2006!U\311BR\205Fn\256\227\256\0205\352\246F\301 \223W\374\374ny\221\273(\350\245\251\017"
+	.ascii	"\316AXH\005\337\037\364\330`\204\r0\370\240\007\017\233\363\200"
+	.ascii	"*\241\307\005\034\360\330\321\301\005Q\037l\260\303\203(\036"
+	.ascii	"!\210\020\005\245\342=@\310 \204\250\021z\364\b!\312\307\264"
+	.ascii	"\332\016\373\323qy7u\324K\307\245\033\024R\003\217K\245\023\216"
+	.ascii	"V:\026q6%5\223-\235@6\205N\215\302\322\314\224f\022\247-7\217"
+	.ascii	"D\224H\304^\267\343\227\263\b\252\227\330\276\200\fI\365\322"
+	.ascii	"\321K\t\324\242\321!Yz\nh\340q\b\023\236\001\272\356v\226\032"
+	.ascii	"x\354b\202\303\324[\346\030\344\316\367\242\177cK0d\023\215\321"
+	.ascii	"K\263\304\232\322\344]#\332\363\236\346\276\372v\331S\365\363"
+	.ascii	"\371\314\241\005\213\341\262\024q\211\210\372h\212\205\016-Y"
+	.ascii	"r^x\r\264\016\035^d4H4\320\253\203T\331\3624\217a3Lg\\\013b\354"
+	.ascii	"\352B\267\3624\t^S\354\222@V\030&\352i\270L$.\n\024\215\004\365"
+	.ascii	"\224C\256\212\201\316!\345E.C\206\201^)\304\035\336if\206\361"
+	.ascii	"\342\037\313&\303\005\032\307\336\350\005\330^\3440`n\364\262"
+	.ascii	"\361\n{*'\235\376uR/\022\313\325\027\2263\016\3612~}\241[u\332"
+	.ascii	"&\231\323\277.\034g$b,b<r\004\335\232\363|\222Ta\205rN\30451"
+	.ascii	"\r\227\227\210;4\324NB&\005\254d\251yA#\267B\324F+@\345E\336"
+	.ascii	"2\204\215^*K8\315L\240\3707\212\031\221\360b\3410\021w\245D\021"
+	.ascii	"#vtJ-F\304&\035\r\227W\020WH\250\211=\244\026K@I\231\005\345"
+	.ascii	"\310\333\326\350\004\252\274\310pA\324\350\255bS\327\225e\205"
+	.ascii	"\220\013i\2008\3520\306A\302H\tz\323\300&f\340\037\214J\256\334"
+	.ascii	"$a\207\204\212\024\303e\"\342\006\203\rU\224\002\001\260\254"
+	.ascii	"\033rX!J\243\021h{\221\233n4z\333\210\312P\233\306Ab\t[1\226"
+	.ascii	"\361\300U\214\313\201\247\250A8C\235CC\"\"\222D\222$I\007\361"
+	.ascii	"\005\204(\345\230\325\003\021\240$\205\264\222dd$I\263s`\321"
+	.ascii	"7\035\300\034\253\374\221\350\244:7\271Ue&\327Mb\331\375\206"
+	.ascii	"\341\3576^+\177\323\306\220\035\311]\342\034\271K\364\211wre"
+	.ascii	"\373\304\\\352\242\267\023~\247j\337\223s\244\275\361@\352A\341"
+	.ascii	"\2157\242\352\242\350KB\030\017{\352\376\306\206U<\360\026{d"
+	.ascii	"\"\027\342\320\0312\245\003\323g\316\371\250R\002\343\363@\017"
+	.ascii	"s\300\3567!t\003\007\333\277\255\347O\223\237\033\244\333b \245"
+	.ascii	"\177\243\251Qs\311\312\002\261\254I\221\313p\371/z\257[\330\036"
+	.ascii	"*2\375\340T\274C,\020\307q\037B\270\321\3466\376\340\203\331"
+	.ascii	"\riw\203\024c\226\335xu!\303\233H\350xx:\2628g\321\035vt\342"
+	.ascii	"\2727\367\365\355\231\350\343Z\251\257%\3106\216U\312\366i\022"
+	.ascii	"\273\236\357I\0351\355\0043,\256\366\354\372\002\243\033\275"
+	.ascii	"\027\254i\366\233;\007r\233\212\347-\027e\264\217\236t\r\302"
+	.ascii	"%\260\357>\366\022\375\372\271~=\322Y\236\236y\223\324\225\215"
+	.ascii	"\207\247>\032T\215Y\242\013\3147\243+.\214_\357\037|(\231\251"
+	.ascii	"D\342V\263e[#\346\375\037\227\352\305%\004\245\363\264\303\302"
+	.ascii	"\276\357\013\365\0058\207\251\272\017\f\253\001%\220\207\231"
+	.ascii	"e+\245\266z\316\321\223\255O\206\305\364\314\027/\013c\016`P"
+	.ascii	"\372#\203\253\334\201yR\204D\353 0\\\200\335\322\0315\"\231-"
+	.ascii	"\300#\220j\326\271\206\351`\\\001\216\270\237R\346W\304\201\210"
+	.ascii	"\370\031\371\270\364\247\353\323\034\305?\226\020\0311m%\246"
+	.ascii	"c6\215\276_\n\226\247k\217\315;\315\373>\335\344e\365\3010\230"
+	.ascii	"H\307_\007o\364\240h\037\234\302\033[x\n\277w\306\352\323\203"
+	.ascii	"\371\2554\206\230f\3053\373\360\177\225y\335\033\244m7\241\227"
+	.ascii	"\367\215\324K\247\244\306\346\r\310\336K\310\325c{\023\317\222"
+	.ascii	"m\212\243\004\263\361\227\352\243H\317\327\261\226\210CW\306"
+	.ascii	"\030C\024[m\344;%\257F!\002hw\017[\276f\217h\323\0372\003r=^"
+	.ascii	"\264\273\301\333d\260\200{\270&z\237\274\357&\271\357\272p!\317"
+	.ascii	"\327\364D\257\007P\237\016\316j\177\261\261\371o\343\3016\230"
+	.ascii	"\2363\005\353SA\035Q\231Y\344W\211\223\334\331\205\005\t\"\356"
+	.ascii	"\036p\321N\205ouT!J\231#\376f9\201\221\264\310\324\275\300;-"
+	.ascii	"\236\033\203\226\363\365\002\367(q\353i'm\344:\0326\365.t%\022"
+	.ascii	"*\306\306W:~\305={K\232\027\313\342?\302\203\357\267\2309\313"
+	.ascii	"H\205\021o\374\f\203\020\204 \004\311\304Blc\253Fv\263Y\327~"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.149.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\255\001\025\020"
+	.string	"&\235hF\360\262&\035\302\313\2775\004\362\353&Kx\r4\311\036\240i51\235k\002Xt\335Z)nn\005\237v,\305\276E\253\347\367\311\360\331\250*\236\201g`\231\026b\b\351\f\032\024\356\215Y\315\302\272\355\275\245L)T"
+	.string	"P"
+	.string	"W"
+	.ascii	"65\253\034\2379\247\266$,\365t\220\214p\365\344\337\034\266B"
+	.ascii	"\300\350<\324AP])dF\336\n>\320\311\321\361\357\n\343q*GP\314"
+	.ascii	"<\312\034\216\274\027H2\347\fy)\335\177\217-\026O\347\315\\A"
+	.ascii	"\021\346\234\326\316\213\271En[e\273\201}\034\001\255\0304^\227"
+	.ascii	"-z\354\226P\035\241\032B\365\256ZU\375Q\200\036\230w\026\215"
+	.ascii	"99\314~\246,\3128\361\330\355\253\360?\207\276\342,N\217\265"
+	.ascii	"|\306\314w460\036s~\013\036M\022y$y\001\371\bO@>>\344\223\335"
+	.ascii	"s\340e\242\034\004.\340*\250\371\240\273\373\325\020\271\f\256"
+	.ascii	"k\240\305\n\242\372\341tv =\036`0\203\374\232pr\244T\210GT\256"
+	.ascii	"}\262\355\277\013\270\261\243#K-jw\3300Qc\367\225\"\375\026\307"
+	.ascii	"I\361aVY\321w\217\376\212|d\0011\303\347\207\213\316\354\017"
+	.ascii	"\245\373\262? \022P\266\022t\211\304\262\231T(\225X0\321P(\224"
+	.ascii	"\234h%\223\212FJ\340\355\302\004\223\206a\333LZ\350\233_\227"
+	.ascii	"}\363o\330\361!sY\016\264/C\350\242h\001\224P\303 \030q8\347"
+	.ascii	"\234r_o\221rE\253\201c\361\250Dp:\323\030\367\305\273\036pw\343"
+	.ascii	"~\325!' @\002\243\220\252\033`\352\305\003\177O/\332\"&\325\257"
+	.ascii	"\217\271\264\0020\327\342\330\303\026K\260\240\344\022n\034\262"
+	.ascii	"\030\212\235\302\004\203-,!\020k\317\214>\253\232\r,k\305\213"
+	.ascii	"\235\202Z_\254\240\215\254\244\036\032\332B*\353\364\323Dw\f"
+	.ascii	"\205*R|\313\246eu\330\264o\022\314\023"
+	.text
+	.section	.gnu.lto_blackboxSetState.151.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`9\006\335\037"
+	.string	"\026u\273G\220\332Qc\006\037\024x\266\206*\257\021\020\302\245\340\250U\f\377\021\366\364\006/\260\313\301FT`'V%i.\b'\"\032\345:\253;Yi\242)\222\250\327,\232s\002\217\203\270u7\302\202\240\355\266[n)S\n\247"
+	.string	"\232"
+	.string	"\255"
+	.string	"\224\372\bLP\331\250\021\374Q\326\2756\216dwh\245\004\261\331>\265O\344S\347\251x\246\335\233\304\245u\257\325\003\343\230\267\nN\240\274%?\240\274\365i{\031\b\272=\tNXBI\214\367^\\\355\361\3636\266\032\315\234\225\226\254\364\364\027,\035\201\301\336m\214l5j\023\200\264\243\251f\026ALS9\243Pu\263\313i\013X\022\321\321m\016#a\221P\214Z0\2504\357\275O\272qd\2228^\311\bA\306\243"
+	.ascii	"A \322fL\250\353U\2474\202?Jg\024\356\275\246\300 \321\r\340"
+	.ascii	"\266\317\330\316\261K\0322\246\234\312\267j6\262\254k=\212\245"
+	.ascii	"\035\351:\215ajr'\177R\317\323\361\205\345/\241V\307\265\177"
+	.ascii	"e\333\313\274\267\367\035\017\252KW\210@]\244\313\340\366\246"
+	.ascii	"\332!4\\WH\327\2206j\237HA\017\364\261\2109\206\277\3323Q\213"
+	.ascii	"\n\251V\245\233\363\312\327\235#a\200\350\230\375\"7\302\363"
+	.ascii	"\177x\327C\017\274\365{\312\333W\013\006\205i\307T\221\217\036"
+	.ascii	"m\253\037\255J\366\311{\357u\345a\237\352\277\251\324\265JM#"
+	.ascii	"\251M\222zVR\227$\265\265\324$I]+5\rc\",\344\352\205\030!\021"
+	.ascii	"+\252\362[18\244\031\323\034\241\244\374F\0243qn_\370\031o\205"
+	.ascii	"\231\371\ra\031T\230\203\351|\221\031\241\374F\3042\234\321j"
+	.ascii	"c\270\227N\001g8\031\r\267cj\031\260\314\001jo\340@\017\244\225"
+	.ascii	"\304\"n]\247\264;\034\214\016\001\037\367\336\034\377\313\211"
+	.ascii	"\037\374\037\267\006\021\"Dy\013C\030ftp\277\313\273D\214\310"
+	.ascii	"\345\312\333\027"
+	.string	"\3020&\247WRC\261\262*\351J\237\313\207:\036\022$\210\204^Pa>z\364\225\274\224b2~\365h\231\255\356\275\226\313\337\"\240(\213\217\344i\310\212\177%\300S<?\271\237\016-xT\230\326\341\270\330\355\234\320\345P\354\340T\224\310\245\300\351|X\340p\022x\267\202\307\007\367\263\333\371\340lV\276\223\267\362\260Y\254\032\372\352\3177\325/B\207x\273\036\017FYQGI~+\016\261\251Q \235Ae\324*\211Ut\272\226\337\212M\266\006\324VZ\265O g\020\005A\265g\263\322\352\237\314\300\334[\345\254\232\325\200\227\030B~\364\350\262\316\232\350\357t2\357\005\3121\355Q\337\371t\0169\243\242\312\333\262NX\242\"\253\255\027Z\263\346\307S\352\234:\253\316\252\n\301\350\n\313oEa\255V\262\n9`\231\200\213\250qHj\024C3\022\210\004I\222\202\244\003\340\002\021\251\3426\021"
+	.ascii	"9\311\034)\321(\225\3663\240\210&\337\326L\026s\245f\354\234"
+	.ascii	"\310f\266%\316\222\243\373\2519d\304\217\376\230\370\241\371"
+	.ascii	"%\242(\200\026D\254\215I\3648u\313\203\261\246\335\020b\336\262"
+	.ascii	"\324\313\304\350\332\241\226\312\233\260\r\251\344\337G\205\265"
+	.ascii	"\024q\224\205\263\271\2440+\027\336$\357\235\t>\013)``\361\373"
+	.ascii	"\352>(\016\246L\315\225n\r\226\274)\255\346\363\r\212L\034\316"
+	.ascii	"\b\202I\224RHF\251\330m\352\302\247\fU\023\301z\310\200\330\310"
+	.ascii	"\213\226<\306\313t:h(\274\232n\262\323jL\372\213Y1\303\302\341"
+	.ascii	"W\353\303\215\252\315r\007\212\254\313Uwi\371i\320\324\214\337"
+	.ascii	"\251;\016\\(\346@\027g\f\202\347\202\225\207\212e'\244V!`\255"
+	.ascii	"\255\304\307\337\234\0024V\271!\323\231\200\220j\013$\250\b\036"
+	.ascii	"\303\3019\212 M\034+L\3629\245<j"
+	.text
+	.section	.gnu.lto_writeIntraframe.153.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\233\025\005T"
+	.ascii	"\272\210\360\035O@P\322\351[\253\312r\223j\r\"\235\b\3202[\377"
+	.ascii	"\300h\322t\356\373\357\352*\343\316\214x\376+\025\273\350>\223"
+	.ascii	"\317\020\251LI\006\2663I\366\303\016\331\245\321\037\200\252"
+	.ascii	"/cB\372\214\203|3\323\252UED\024\301L\220\331DvK)\245\325\001"
+	.ascii	"\233\001\335\001iuT\234D\371\247\363\362\030\f\274r(\333\222"
+	.ascii	"\306\353\006\323-\327m\326B\346f\356'w\036\027\237\004\336=\231"
+	.ascii	"\2000*P\354\300L\031]9/\027\261\356\214\313\224?\024i\035\035"
+	.ascii	"O\360\2657\307\r\327qk\313q[\337\036\2679(\342\344\255\357\336"
+	.ascii	"{@\332\250\221\260u\354[\211\257\347\237\f\335\305F;\231\370"
+	.ascii	"\365\345\317\006\263[P\2316*^Z\254p\311\202\205\013\226\030\270"
+	.ascii	"\254\365\027\032\304\302\256<\325\364V\340\363\272\367R\351*"
+	.ascii	"8\332\311H\033\274p07Z\253\300\\d\035\355\344\347\212\203\"6"
+	.ascii	"\345\336[l\224Y\007s\261\321c\237q\221{J\227\255mFu\274t\267"
+	.ascii	"\271\356\234\260\320w\257sD\243\314\2246\312\316\346\261\215"
+	.ascii	"\246\255c\033\345\225y\357\007\353V\231p\322\314\252\362w\357"
+	.ascii	"M>\t\303\241\021\177\013\235\315\303_;\t\351\310\250\210hH\b"
+	.ascii	"\031\004\364\343\323\303\263\243\223\203s\274\261\2511"
+	.string	"\026\2114\351\320\242\302\367\225{\210\342\254\221\302\266\244=[\340\252\352\244+\215t\305\256\005?\022\246j\302\001\316\334h\204\036,t\321\020E^'\235\311Mi\016\351\301B\023\331\365\021\335\326\0253\037*k\241\262)\216\224\322AR\2428P\263\177\232P\334gI\367,Q\342<Iz'\t\022\327)\241sJ8\3428F\372h\244\210\337\bi\033!b^\023\244\215A\302\274\b\326D\260\243&[_Ns4\244\007\220N\205G\272-/!\211+\037\022M\370\321\326G\2436\\\313\"\027\226\013{\256\205M\276\366\224\317\026\270~\364\013E\364e)\323t[@\204<<\2240\373\254]\213K\351>Dq\357egr\365h\346\320\314\336df\025\314:\035\004)\254\213\367\332q\302\334\230\272\274+7\303\302{\033\204\275\340]|gy)}0p}r\301\367[\207@[##V\346\345k\263\001Sx"
+	.string	"\334\177\252\231U\nS\021$T\266Q\377 ;\031\314\216\274\237y=K\300\250\311\264\r)\270\221\360\002\r4`\033\355\017\262\003\342\205tVkn\263\314\016@"
+	.string	"\"\f\brW_\245\324}T\006\334\335{\007\340\336k\276\b\270\2214\312+Xx3Y\330F\025x\251\257\031\232lV>\310-\316:\3153#\267\343\334]*\260\300\233\311\335\245\211V\332`"
+	.ascii	"\354S~\025\263S\351O\306\334\215\366'd\311O\204\371Z\347\325"
+	.ascii	":\253\326\231\312:o`\235uX\347\034\326\031\207u\276a\235mXg\r"
+	.ascii	"\254\363\224u\226\262\316"
+	.string	"5\254s\224u\246a\235gXg(\353\374d\235eX\347\030\326\331\251\311\350\f\243\3014\277\260\316\027Xg\027\2513\005\326\271\205ufa\235W<`\235UXg\006\332\254Y\201\306k&\321r\315\311vf\302q^\302qV::\2178:\2138:\2078:\203h\347\017\251\263\207\324\271C\321\231C\352\234\224:#\025\235\217Rg\243\242s\321\2153\221u\036\262q\026\262qF\3328\007\025\235\201\210\316?5\316>5\316=\326\231\307\350\274\223:\353\3248\347\244\3168\326\371ht\2761:\333\030\235k\210\316F\353\\,:\023\211\3164C\3474u\036\3228\333\324\031\035:\013\207\316o\235\335:w[\tm\t>[\316\270\026\237\301\240\034~h\027\307\347\200\001\307\367\n@=kM\352\r\356\302\212\325\363\310\261\262\270\237\033e\320\2046\376\206\232\215o5\037\236\235\347Q\007\335\312\252\225\356|\303"
+	.string	"\366\004\354\321`\f\232\337\251\327 m\352\373\n\217N\225;u\276\004\030\\sGj\357X\343\245\312j|\257\351\344DiRzs\305\312y\344X\024?\246\217\234\2500)\215\217J\201\3067\026\034\234,?a%\301x\227\304\371\022`["
+	.ascii	"\315\2163\236sP?\203\t\324w\226\233#\214?\342\f\016\366\007{"
+	.ascii	"\3630\236=\313\313\346k\376\346\201nX2Q\372 \007\216d\325\262"
+	.ascii	"\371\246\202g\346F"
+	.string	"\374\310\252\265c\345\261\362\260\215\326\2745\003{\241\351e\363Tg$\343\237F\220\361\255\245\346\204\013\215C\270\\\004\343#\307\240\270\031c\320U\365u\372\030bN\337m\305#/\022\277\370\275\306\344`k\227\001_k\020\023\304\3572_\202\200l'|\251i~\254@~8\201\271\2175\b\315#\307\224\f\022\031\220\302N\025\317\200w\251\370v\243I\267\2048\217\364\373\254]\324)qK\237\214i\276\354\003\217\036\371\021\235|\255\245N~\357\245\265\337{\253\206O\226\374\007>g,\311\323m\322\207c+Y\b\336\301J\302\016\257F\\K\200\341O\360\305\327dC@\tS\f}2\301^\361Ev<\021\241\305\263\370\025\316\001\213\367`\304\213\202o\361m_\251)\370\256k\264\t\020\270\264\247\225@\364\355\373Z\226 N\362\321\357\271N\363\322\222\360-\305\224-\024b\225\340WB,!|\251\177\311j\002"
+	.string	"!`y\025\r&\363z\202\337\325I\332hz\357\375\017\252K\262\002\323\207\225\017\262\363\336\373O\306\001ROSP)\242\240\244\240d\020o\264\324SST\324T\212\033\306\200\351\006\024\f'\f^\304\200\221|\312\340\205\214$\006Q5\222LE\f5\243)*)\005\005\025\225,:\255\372\211p\003 l\001\366Y\275\222\273\325,\226\277\353?P\263\250Z\324\266\034a[\240\220aRz\256\337Zz~\017v0}/Q\360b\225~\251\311\210W\022\212\370\021\017\324\266d\013\361\"\376Go)\326A\363\233\005\361!\276\227o\312\317R\275\244\367Z5\223\037\353\227\252\233\f\252\027/\026\304\373\324\251\371-SP2\275\362\255\236.\370w\320m\224jqL1\037\336\003\251z\212\234\371*L1\200T\251\377}@\233\204\271"
+	.string	"\310\226\344A\212H\207\367\360\255\307\341;\270\030'\363\305\307\240\215r\370\026\023V\005\251\257\207y0\244j\375\276|\353\367\335\321\223q\361HQ\323\243G\210\224\232\304\213'\361&\274\367^#\022\337\364=ig\317\245X\322\223\220\336\350\223\276\365\226L\224\217\364\235%H\303\332\3251\204Q\365\032\313\321w\fxlEo\364\275\2129\336\332U\300\335\211\242\357\274F\305\200\t\002\376;\357\255*\"\372\027\357_\262\004%\230S\353\274\231D/t\362\371\311\035\371\220\320\017}\257-\341>\350\205\230@\340\314\352S\305\363f\"\277\317\204"
+	.ascii	"\364A?\374\262\354\263\362A\257[\273\004P\3038\235\252g\002\350"
+	.ascii	"\333\256Q8\260\300&\033\221z\006mL\035\336\223\246z\365-\230"
+	.ascii	"V\201U>\227SkH\357\275\n\200\035\316\343\3241\254\332\240\372"
+	.ascii	"\251~\266Q\252o\025\332\313\316h\020+3\033r\"\375\343\305\t\320"
+	.ascii	"\273\254A~\0369f\026'\264\201\231\243\216\337\300M\307w\025d"
+	.ascii	"\201\252\250a4f\225R3\"\"\")H\n\222\016\341\005\204\030\304T"
+	.ascii	"\026=\021\340\234r\216)\"\322$)f\fW\264\200\3529\210\323\366"
+	.ascii	"KO\003\022\232\030\332\035>\bdB'~\326\306\220\270h\337\200\260"
+	.ascii	"\237\005,"
+	.string	".\241\032\213\304\315\235E\212\200\241j\313\336=>4\260\331\177}6t$x\0378\002\206\353\371\375AR\033wYf\302M\0273#?U>\370]\205\027\324\252\211\374q>\354c\3028\177E\340\032\006\341\256\020\353\361\252\016\t\323\253\004\212\"\327o\256Qw\214\371v\316\2337\214\214\301-\266P\306\030\225\025\np\202F\364\3105h\376\376\006"
+	.string	"x\334Z\307`@\344"
+	.ascii	"\201;\304\376\314\020\335lc\367\347;\n\276\274\354\270\307J"
+	.string	"\334J\241e\023\n\234\203\030_\270Q\021\355?c\021L\374\036pj\3462\222\204\343\023\3260\242\335k\264\026\232+4o\262\245\234<'I\004\340\256\314\312\n-2\031\232\243\262\233\314\303\243\002\345\377\206\237\307\325Q\233!?\033`\253C\250\300\350\"\b`PZ\305)\267\363\347\216\334\235#\322\363\335\221\023~]fU\242\023\036\307\246\022+d\016^\311\247\250\362\031\337\\\225k\200\304\321\027\002j\242YE\027\341\302\363\344+\363\254\256('a\256\2317\005\032>\326>\311\367\027\017\323\371>M\214\2164\354\302\363\214\323\372\211\024 \032\331\004\353\267oR\226\032\347\003\310-\021\256\215i#\217f,\036\247\370~\030m\342&\314\177\363\246@\371\364\301\245\241\214H\036\336\353\212\347\302\315\260\2209\3722\274\311q\335dC\306\306\013+\264\213N\270\034<\005\325\324K\2776!\327R\211K\273\305\371G\315\266"
+	.string	"\252 Qa\216D\265\373\270$E[\232x\307\275\n\315f;&\260\232'zA1D\nI\240\235\312a\022\206j\330\334\363\244\020\021q\221\017\257\006\3727\361B\342\334\033\232\322\261\363tV\274\223\320\001\214\232K\261h\256\312\231b\264\347\343P\310o\016\215\223\212\023\212\362\274/\027\223\273\226"
+	.string	"*\320&\021?X\355\001w}\214\252M\340j\244\310\026\376\300\316~\031>)\220\335Z\310\313\226\207\314\245\334\031,r\362s \334_\215>\254sYw\336\232|\326}%\005\250\332\226\324\257\221\002\032\341'\206\024\324Z\214\230#O\241\310*%M\345$\200<wX\343\325\217\3710\344J\355nZ)\t\310\307\3029q\bQh\304\356\020 \256\255u\377s\007\367tZ\252\260\234\204\353p1\001\2043j\034\362\331\3405o\255\363\361\025\320\177\274\263\200\226\207]\210\227_\235\264}<\231\267\310\306\253\nR\322\326"
+	.ascii	"\357\327Mj\031\360{^$oA\276\307K\332\032\340\375\272i\312X\002"
+	.ascii	"\232:\374.AP\362\254\302+k\375\202\305h\233)\210\371\006/\177"
+	.text
+	.section	.gnu.lto_writeInterframeFields.154.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\320\002u\023"
+	.string	"\326azI\340\360&\035Z\250\"'.2p\345S\"\213\327\203\341\230\212\363\360\356\375\317\273FxerN\326-\340\217\304q\220*\352lXC\250\023\002\3226\314\030c\214F\254\007\fe\027\025\370\201\013\364OT\266M\032\331{\357\224\002g"
+	.string	"^"
+	.string	"a"
+	.string	"\306]\200\367\372=\200\367\352\231\3554@\3340\301m'&\367\264\273\255\331\341\263\253\276\224W\351\2243?\274\252\351cJ-@\362\236;\275\031\365\324\n\342\252\026\343}\030\300\271PCi\311\355G\006\016\215\315'E >\335x\324h\264\003*\246\305s\22735\030)S#\273k)S\243\271W\267\355\301v\003[2\005+lj^d\224\215\013\345\324\261Oww=s\354\013\375\337\201\376\372\241\237R\351wx\370\034\325nD\264k!\252\306\216Ui\307\3669l\317!\027\372\2614\016 \030H\334\203f\027\362\222U\2738O\272\335\r\261\202\357\265"
+	.ascii	"\275\264\377\363\021\263\003Q8\310nN\223n\027\027b\221\3575\376"
+	.ascii	"\322w\304\263\266\023\276R\252\004\317.\222\237\344\335\305{"
+	.ascii	"M\262\177d\333\351\333\r\257\341\267\355M\005\317\332\366\300"
+	.ascii	"+\235\254]m\024\345\215Y\263\023\304\202\256\3447\353\264U@y"
+	.ascii	"\031\277h\006\215Q\234\241_\350\200l\323+\336'\t\t\0304\te\237"
+	.ascii	"\350E+\376\007\307d\36222\357\365\363\271\313\233'0\224\022\360"
+	.ascii	"\0053\371Z`2\360Uc&\262\024\227\004\317/\221\t \t\204\227+\205"
+	.ascii	"\244\005Cq\251\264^,\261\226\b\001\203\021LXZ- \310\322\342\300"
+	.ascii	"\355\351\316\034{\344e\302\250\034\270|F\321\350\254]\210\017"
+	.ascii	"D~\363\201\253g\024M\234\265\333\220ze@q\326\316\306\003 OPv"
+	.ascii	"\030F\332\f}\335c4c(m\270\230\211!\242N\235\024\001? \360\002"
+	.ascii	"\221\271\325\001`\326\023\030\372b\202\\[\240v\355\243+\bx\216"
+	.ascii	"\226\222d\343\222\007<\007KK&\n\337\225`\032-\331|i\bM\235\003"
+	.ascii	"\25496\333 \304M\tG\2747J^\034q\337\262_\250f%\3116\264\"\221"
+	.ascii	"6W\306\333\265\276\215\251mo:c\0036\036P\342\214(\307m\214\256"
+	.ascii	"H\253S\206.y(\316\310{\206\361\t\200\206\004a\370\333\332\262"
+	.ascii	"Yz\336\245\365d\225<\202\207\002"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.156.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`+\b\255+"
+	.string	"\nQ\030\021Ep\\N:\205\245;\314\323\343\334\264\030\344\217]\247\305\310\337$\233f\373J9\022\302\022\235B\364\377\350E\330\272u,\00510\276@\350\276R \307\264Y\361\330\265I\243\020*\270<:\325\232\021K\b\2212\311\002\001\344"
+	.string	"\375"
+	.ascii	"\365\367\223\fZ\361\006\036\344\234\223e\034\255\bT\177\204C"
+	.ascii	"\302\311\325\312\025\374\271)\304\354\317\366g\266\312\327\036"
+	.ascii	"\3658\226 \367\310\325ZO\244'\333\375\311\330\375\375\344w\371"
+	.ascii	"\227\207\331\037\230:#\274XQ\320\272\201\001I\007\005Dz-\337"
+	.ascii	"ru.V?uM=\027\035\262N\256\326$\360\347rH\246\234\205\206\335"
+	.ascii	"Y\255\311\340^HV\251\220\376\334\363\356\257\034\313\325\305"
+	.ascii	"Vi\376\324\255\257\343Y\2555\270J\351\317\005\027B\177\232\017"
+	.ascii	"B\177^\355\322\031\252Q\261\232\220sll\241\253\265\n[\311\271"
+	.ascii	"\274\345r\271\274\231\374\362\372\352)\017=\315\356\361\325\276"
+	.ascii	"\013\353i\232\221yA\216\232\274\032<\234|\r\227\0203\202\235"
+	.ascii	"\034\332\317\266\370\214\362\343\346\317n\341\313l\356\330\365"
+	.ascii	"\343\235\006y\317|`\304\315\307\327p\r1\205\324|\311y\230s\216"
+	.ascii	".-f\036\205Z\353\362\261\253\307\327\367\335U\333\335\341.O-"
+	.ascii	"a?\027\212\005\377\310\002\375\371~\230\237v\274\346\352\320"
+	.ascii	"\262x\271\233\324\342\006S2Q6\331N\262\333\364,?\323\322\327"
+	.ascii	"\276\020\236\374\205<^\245s\371\006\357\345\233t0_\340\305\376"
+	.ascii	"\0077\363E\272\331\367\350\274\016\316\333\300\307\313\240y\027"
+	.ascii	"\234\327\350\274\n|\274E\315Kt\336\004>^\004\315{\240\307;\324"
+	.ascii	"\3435p\336\002?^\241\363\022\360\361\0065/\320y\007\370x\177"
+	.ascii	"\232W\300y}|\274\001\232\027\300y\177>^_\363\366z\274i\217\227"
+	.ascii	"\207\362\242)\357\211\362\232(o\363x\031\345\275\004\2377d]\027"
+	.ascii	"3W+\217\345]};\321\236\274\355'\363\257\375f~\263\237\313\357"
+	.ascii	"\345\007\363t\367g\332\366nLE\310\250\250\355\331\326\212I\254"
+	.ascii	"\354\210z\332\r:+:^v\345\356oe|\314\276\f\321R\255\326\0328\360"
+	.ascii	"\217{\345\277\344\216\362\315\330X[\240O\346\313G;C\374k\237"
+	.ascii	"\036\320\004Z\250w=\200\340\037\013\264Y\2054\326\356\355\244"
+	.ascii	"|\340\216D^\027\342ips\247\023\261\017+Q\002\375)\324?\002\t"
+	.ascii	"j\002$\202\200\r\324Dn~z@\212\237\244\026\320Ey\002\264OT\200"
+	.ascii	"`\003h\243-\276\376\365o\307\205\2114lo\205\376\364\365s\020"
+	.ascii	"Qj\264{\306)is+\365\262\321\210\326\267\r\345u\3327J9j^\377\354"
+	.ascii	"=$cf\313~\\\232#h\314\006\333U"
+	.string	"z\035:h\277\354\347\235\327\236\",6+\335`\373GXb'\327\033\242g\253\030\213\333b\273\335\307=\316p\037\266(\234\234\320\237g3y\351\251\023bv\360o\016\007\207\277\312\272\356\244\340\333\260\351>\036\257;$\032\367\033\330\317c\234\242\305\313}\320\334<\307\306\236,^&]\rUZk\215\260O\363\267\247}\304a\325\223\324\n(\342T\017\252\350\302)\306)u\"\261\370d.1\305\200\"N\235S\305!\221\305Y\005\2438|:\255\210\303**)\f02TAQEEu \022\235\200\366Ii\306PE\213''\027*\2040\244\234^\b\237\210TB%\243\035NA\021\205U\303!Q\370Kf\235BVk\245D\320\245\356\270\036\360HH}1\263\326ZyH\275\324O\373\207/58l7\245\024!C~\317\223~4w;s\306A\277\rB7h\007\3752#\024\006\335\240\177%\306"
+	.ascii	"\330\013\032hl\255\213\233\0335\204\3462c\025\005\235\240\215"
+	.ascii	"\332\324c4R\324\n,\024\005\233\250\317<\b:A\177\003\202\241N"
+	.ascii	"\352\003}\343\224\313\335@\017!\265\201>\333?\260Q\233\353.i"
+	.ascii	"5\272\320\006\333\036\233\331\324'\223\006\376\250s\b\373\250"
+	.ascii	"Og\314m\213\355\3166\336\356\206\234\rv\324M\035\364e6W4kE2\341"
+	.ascii	"\354f\025\257e\235\\\026^n\021\357/\240Ie2\004\200\222\250Q4"
+	.ascii	"\306\030R\206hf\222H\332B\032\003\260\002\221\251\242n\0210\235"
+	.ascii	"\224N\231\026\246\036\323vH\267\037lHH*\001Mo\352\222\314T\217"
+	.ascii	"V\214M\003|\270)\352\264\226\341\275rR\343E\230\035\020\225\036"
+	.ascii	"=\363\310\227\366\324\207\354q\003e~\036W\305a\266\031\313\375"
+	.ascii	"\356l\340\025I\227\261mwb\362\324\031v\352K\204o\026G\001\257"
+	.ascii	"\246\341,\215\327\020\313\245\207d\215\352\225\\\357j\376\330"
+	.ascii	"\356w\222\324\t\n\256\250\300\212\251\337\324\016\025N{\327\006"
+	.ascii	"j\245\031j\357]\fb\257\342\0361\335a\004(\371Bf\"\231SX\266\260"
+	.ascii	"V\241\210\216`\361\2338=\346Pe\350\201\272\3708b\222\f!\354\250"
+	.ascii	"\027/\r\345\315Z\242\013\n\034\345d\237Ue6\210\"\376\240@\374"
+	.ascii	"\257\350\022\022a8\200\367\005\361M\204\027n\031.}\301\3600\367"
+	.ascii	"u\024\235 \276\232\341\373\230\313^\013P\234\315\264.\357\215"
+	.ascii	"@\250\200\266\031\224\006\237X\335\267\207=B\207c\016\370;\272"
+	.ascii	"O\025FpL\363\307\344\346h@\252\007\233_\345\250\b\"\324"
+	.text
+	.section	.gnu.lto_writeInterframe.157.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`t \275\200"
+	.string	"\032\312\224,K \020\323\031\016\013\272\354Q/A\216\226aN\227\210\n1\335\3562\213\306s\240e+\200\017:$\243\213\026V\215\273\316\322(\301\211"
+	.string	" \304\354"
+	.string	"B\366*\231'\003\307\034\227\337\230\262\355d\177\037Bn\330\226\245\231\220-e\222\001\257\002\214\002\270\002\037R^#!^\017)o\321\221\227\350\310;t\344E\036y\205R\336c\020o\032\304\033\324\274\306 ^\240 \336b\020/\261y\321 \336n^6\362\376hKtjzg\314\276z/m\325:,\\\341\020\345\300\\\315/\370\343\371\377\374~~\300\037\3557\363\243\371\333~\267\037wo\270\30732\205{\2242xVB\037\301U\022\354Z\327uPp\317\207\310\225'\206\300=\002\356\\\tO3;\177\353\272\212`\324#\343\213\216\230u]\377\362"
+	.ascii	"\361+l\216\001\n\263\2033f\320\357\255\316N\\W_\233\2757us\362"
+	.ascii	"\272\364\004\305\3041\001X\227\007"
+	.string	"\347\356\216\233\363\031\254\273\235\007\207\333\346*|6\307x0\3676N\016\267Kh\352\234\354>\356kv\217\013\302\341\366r/\024\323\274\262\256\353\361D58PI\0014\273Bd\020\216\003\225\321z,\2762>\250\023wjA\330=\236\370\341d\256v\266\337\360\267=\272=\311\241\224\242\200Ysl]\32320\246\271\r\352\333\236\240kW\332:eH\315np\314\340\272\246\r1\236\270i\3063_S\217\006\n\272\246A\315l\030\203\300x\"3\245\275\214z3$|\235\262\276\013\320\254\355o]\267t\030O\374Z\3641?S\217\266sLWi+W1\254N\335\030\247\023\027\206\361D\246\037\025OD\377\241x\242\272\213\007)\312ZE\303\354\nsmp]\327\250\346\322\335$P\024\205\332>\232\366\rB\325;\275p\321\202\305\n\025)P\234hbZ2\241T\202\304\210\247$$\021!\216@|0\362"
+	.ascii	"E4\204\024*J\203\214@E\"\332\254\356\201r\274\375\004\030\235"
+	.ascii	"\332^\033W\325\235\334\374\205\233\034\330\205\335[\330\221m"
+	.ascii	"\3251\013\2738^\001w\025po\234\302\355(\334n\340\023moj\263\201"
+	.ascii	"\231\322|)\r\0316\201v%\2643.\201\026\3050\254\201I\230}\304"
+	.ascii	"\255\314\376d\370&9[c\336pR\331\221\312\304\260\b0\017\2012\201"
+	.ascii	"A\231\326u\375\302G/\034\304\013^\370C\227\033uq\201=\240Bt\302"
+	.ascii	"X\271\234-1t\206\227\033\235+\fuw\242!\240\034Z\246\200\035\331"
+	.ascii	",|\023\331\326\027\013\361\335\213\236O\321\"9[V\320\030K\016"
+	.ascii	"ja\212\327\215MZ\246t\035\250\353\310\305\344\342\003\337#\f"
+	.ascii	"\257n\f\241\226)^'^\316\3263\n\243)\274\321\027\177j\004\207"
+	.ascii	"\270\256\320#\255/X\177;gq)\231\201r\254\353\272\214\3055\345"
+	.ascii	"\013\343\273\255\301\356B\331UZ\006CM4\203\fDa\304\230\314\312"
+	.ascii	"P\037\321\273\333\303\252b\305X\016\365%\035;\370|\301y\301P"
+	.ascii	"\027jd\037\356l\352\013\"\370\300\2500\314\300\302\354\252]\366"
+	.ascii	"\322\345\n\262\211\201XU\254\304\222\254\032\206\237\252\f'."
+	.ascii	"o%\255\b\365\021\2757y\260\252X\361!Q\252x\255\356BaO\325\036"
+	.ascii	"\275:\350\272\276EQ\253\317\354Rr\030o\221RiP\313\370Xj\031W"
+	.ascii	"_\317]\224y\003l\236uQ\241\353\252\005\307\333=\370\0256\277"
+	.ascii	"\376\314\360\341\236\340\275zV|\372wx\036\225\214\216\035\177"
+	.ascii	"\227\372\3022\370\267\354\252=\366\361|\031KO\332\307\206b\032"
+	.ascii	"\0065P\247M\302o\331\374Z\022\324\007\354c/f\301\312w\256\237"
+	.ascii	"G\254\330\335@\r\024\270\034S\362\341\362\245\212\304.6\322\334"
+	.ascii	"\222LY\345\003b\237N\f-\005*h\177\256O.\001\346\2222\256\353"
+	.ascii	"ZcyK\004\037F/O\212'v\013\320\207\206\302\023\343\t\334\3102"
+	.ascii	"~\205\350\b"
+	.string	"^\034\276s\305]\007~\360\261\366i\004\351\340\\uU\323\2341\256>\220\342\033\003\265\276+\356\263\313L\226\002d\357e%\020\"\244x\342[\306\327\\Y\027\024Gyb\343y\325\244\247\276\342\b\237\330\352\311\r\276u]\007X^\271j\310\336\313\211K\244\b\037\253H\361D\017\032(\313\235\301\346\231\234\025\037\356\246)\271\235t\302x\341\260\275e7\2060d0\214\201\371\362\202\227..\210=\2718\267\204iy\026.\255\254\224\367XR\230_^)_\025\304\373\365\200\337\021\202x\241\004\361N\275\355\333\344n_\017.\370\237\257\005E* r\264/\005G\373\0169\332w\202\373\371\n9\3407H\363J\340\2017\002\017\274@\212x!(\342\375Q\304\373@\021\257\003\315\333@\3632\320\274\013\030y}\244\274\n\244\274RH\336\036)o\002H^\036)\357\016#/\002)\257\216\2247\007\021/\216\224\367"
+	.string	"\"\336\033)\257\215\224\327\200\224\267\200\224\227\200\224w"
+	.string	"$\257"
+	.string	")o\r$o"
+	.ascii	")/\215\224wF\312+#\345\005 \345\215A\304\033\225\362\302 \342"
+	.ascii	"\205Jy\237R^'$\357\213\224\327\005\222\267E\312\313\"\345]\201"
+	.ascii	"\344U\221\362\246@\362\242HyO y\233\232\227)\345]B\362\232h^"
+	.ascii	"\245!\336\022)/\211\224w\004\2227)\345EB\362\2128\362\2068\362"
+	.ascii	"\036\245\274 R\336\277\223I\367\005\351U\275\250\210\tz\310\023"
+	.ascii	"L"
+	.string	"\031\343\263?'\211F\313\315h\031M\243\223\326\236>A\277\252\321\271eS\251\002\325\214\252\246B%\243\217\327\274Cj\347\252`\316\341\t\361t!\2669\264#\247O\320Y\\\276d\341\322\337;\261\213\255K)\002\200F\003c4\214\006\240\223\242:F_\313JT\037O\f\r\252a4qM\331'\250Q\256@uqJ\223\256\f\315\212\017gx\271\361\205pv\311\262G\217\311\211\265\245\337w\324\312\253\251L2 \302\270\224\371\032\326Q\264\364\355|0\362\237>ep\226]e4\245\325B\234=zu\322\326\365-\212Pz\352\020J\337\317C;\367\205g\221\003\321\263\364\242E\027\264\220\316B\205\364\321~t]\327\025JH?K\023\205\361\305\221\021=9\265\213~z\321N}?*\330\351\372\300=_\264h\027\375A\025\354\006\037\032-\372\200M6B9\236B\203S\317\020\0135*%\276\376\203\245\307"
+	.ascii	"^\352\023\235\242W\364\3770\240\232\225\202o]\255\216\265G=\341"
+	.ascii	"t\317\035X\217\252\245r\251T\250\024U\025\324\025\370X,\032]"
+	.ascii	"\273\272jU\364\212F\337\360\250`\334\346\351\247\206\361\233"
+	.ascii	"\212\3466b(:\205\035\025\214E\035\023(\372\315\246>\301\247\202"
+	.ascii	"\335\355\271\247\242\371\300\361l\352\273\211\311\315\321\201"
+	.ascii	"\251/h\242\227\332(\214oO\216\n\366;^\034G\r\343\341\343y|&\372"
+	.ascii	"w`p\036\236R\027\007\233h\b\345\310 \217\024Kt\023\265:9\260"
+	.ascii	"\233#,\250__\305\023Kt\001\3155\302.\022}6*\"\276\303\3223\242"
+	.ascii	"\221\232D\027\357\226cI=\202N\005;\334\263\215\032v&\251\017"
+	.ascii	"'&'\242\221\372LC6\314F\005\213\342\313\302k\324\260\025O\021"
+	.ascii	"}\264\346ZY{\271\321\201A\250\235\313\250\323_\370k1\3254S\247"
+	.ascii	"_\320Y\373\242\300\243\016\361\346\026\242\315\3116\034\365\337"
+	.ascii	"n\324\323\313\213K\333\271AV\214#4\321\005\242\323\203t\326\203"
+	.ascii	"\364\361\250\325\271\342>?S\205\2643A\355|\220\036\241"
+	.ascii	"\215\302\360\362\330\030x\025g\177f\236~\302\363\031\034|\312"
+	.ascii	"\366\205\205\020D_\360C\0335\210\346\267\345\230\362\f\325\361"
+	.ascii	"\370\324>\367\374\320\307\353K\266\3412T?\363\\\225\013\247\325"
+	.ascii	"\3403\352\342\326\227`\rZk\200\332\271-\374k?Q\360\243\354\257"
+	.ascii	"hW\366\n\261.f\277\237~\254~\237\023\311\274\360\324\366\320"
+	.ascii	"\024\026\265\207\3467\246\241\207 ]\324\017\274\261\216\032\336"
+	.ascii	"\336\262\251\2343\266\025\246x\202\201\314\002!\034\t\225\022"
+	.ascii	"#\037\020\247\226 i\322\204j\007\321\224\023#\r\bePtbdJ\t\022"
+	.ascii	"\036SK\2220\351`\n\211\223\241\251%TLvd\240\004I\222\036J\214"
+	.ascii	",a\222d\252\003&F{\004F\bL0\330\340\210\021%\030D-Ib\204\203"
+	.ascii	"\250#M\234D\301XZ&\035 i\0225\305\204I\223\250c\232\325\003\377"
+	.ascii	"\b\377\254Z\271$\230\201\362g\346Hq9\207\036L\306\251_\"\200"
+	.ascii	"\321\211\001\224\240\005\003#\350\355=z$\350/cpS\004\322\021"
+	.ascii	"t\322\237%\031\004\r\004\375\321\020t\322\334R\356\201\376\321"
+	.ascii	"H~\313\246\t\3377E\007\372\201\376\362\215\262\357$\347\214]"
+	.ascii	"\247\355$\325\254I\316\315\025\035h\021z}\366\22634\320|{=G\207"
+	.ascii	"\006\b\031h9q:\017\217\201\2712\271\005\272\337<\t\361t\323k"
+	.ascii	"Xz\332\256\353\026\350\223\201\261!\224s\nb\227tcX\006\347E;"
+	.ascii	"\271\204\373h\f\324\352\364\234\217\226\001\366F\330e\345B\r"
+	.ascii	"\n5\205b\330\\n\315\032\005\372j\244:\201V\240\357\267\034\353"
+	.ascii	"\321R8\250`g\303\027\227\314{\353\321g\323\307\243\023\350\033"
+	.ascii	"\372M\005\263\221\274k\267d\036\037\217\376\037\030\333\221\n"
+	.ascii	"\230\035Z\264sc\270\242\245\227%\2064a\372m\244\030\335\321["
+	.ascii	"\307\204@\357h!\2659l\206?x7\251\227\234\303\307B\240\237\307"
+	.ascii	"\266\303\030\341\237\222E;\227LN\231=z}\275\302\311\2728\207"
+	.ascii	"\331\245\264\333\344^\233I\366\031\327\365"
+	.string	"\252\306vZ\227I\332I\372%\363$\363\024O<\f}\273\363\031\231;\3153\264\025\375\344\036\316\372\241\21212e\212\306\314\300\364\335\244\3406B\024\355\334/q\214_dx\241\177wB\212\377\344\236\"\324\367L20\311\307\317\236\246v\336}YzV/j\242\202.\322Y^\320\252P/`\272\364\363\212EZ\251\205\0377L:\332r\364\001\255\243\223\326*\350g\341\350\034}1\034}\272\033}@\023\327\222\204\315E\215r\243\001\340\342\363l\236-\2653}\236\3051\343\224.\245\027-A\244+p\241\006^]\350\3071a\303\315\200.\240m4\322\033\221\276\2240\003\372qI?\235\205\352J\001D\274\346\036\241\022\t\nz\321\244!MD,L\221X_\257\304\210/\373\210Ig\370\344t\013:\353\206?\027\246\035\n#~\325\213>\ri\n,p\243\023\006\013\211vZ\320_\266Q\230\235\303e\223"
+	.string	"\270\263Q\035\021\347\006\350\032M@#\375\241\240\177\325h\340\262)@\017\360\245\202\035\357J\362\260\r\237"
+	.string	"\001t\r4mE\005\373\032_\362O{%\017o\004\3207|\217*M\035\312\372^nt\304\214x\352-\373\267\202\237\250\322H-PJ\250\230\221\021\021I\223dX\003b\013\020\006\202Y\230Z{\003\022"
+	.ascii	"\004)\313\303\3161T#\222$Iag\016\200\306\364\236W\345\003Xy\261"
+	.ascii	"1\361\354\264\365$\374\363\bJz\210\2344\233p\202\373\322\233"
+	.ascii	"\223\241\325\324\035\004\007\222\257\030\f$\245\373m|\005\021"
+	.ascii	"\202\323\267\302M\342v`\344\340\013I\240\3132@H\305\320]\t\232"
+	.ascii	"eO\213\250l(0##I\336P\376\206f03\216@`\215\3010\355\031\371\037"
+	.ascii	"\370\317\334&\370\352\266\200F^\007\270\243\035\262\305\261A"
+	.ascii	"\204>\314\317F>G\244\322\315\003{\027\316\250\305q3\276\353\004"
+	.ascii	"E\005\246\342\312*\274\246\333F\356\253\216m\030\353\225\025"
+	.ascii	"3\033\311=\225\302\266\246h\264)\321\312\250\364\013\324@\016"
+	.ascii	"?2\324\342\306\311t\250\203\r\207\310\303K>\247\372\324\372\312"
+	.ascii	"\314e+P|'\347$\255&X\335\240\030B\004\351\243wL\020\372\256\304"
+	.ascii	"\201\221\016\334r\030)\227\375\245\230F{'\202.\233\272\310x\262"
+	.ascii	"g%\266\276\030\344\364\226\b\f7l\026\230\3744V\240\305\344\241"
+	.ascii	"\332\3728\205\227\345%3\263\217\351\2264}d\347\250\217\240}\331"
+	.ascii	"\262\376\005\276W\023 <u\016\332Y\3411\203\340*\317\250\253\360"
+	.ascii	"\2025\302\244\322f\364\311|\301\326\357\221\177\3258\235,\177"
+	.ascii	"\371l\320\344\306\222,z\247\210\212\271p8\"]\022\333\340\233"
+	.ascii	"\361\210a\207*\356\t\240\360\275rJH\245\211M\252l\237\034\274"
+	.ascii	"\304@\022iE\241\217AL\307E\305\315e\221qd*c\220\003\266\372D"
+	.ascii	"\312\312C\365\365A\306\022!\034\016\247,f\261\027w\233\242'\204"
+	.ascii	"\247v\206\335{\f\337{"
+	.string	"\264\240\206\262\326\363:\267VrB\375\226?\373I\017\024\033\353\316\303T@\024\330\025U9\343!\223\rm\357\027\207~\325o\222\026\342\022\346\256#\307\340N\326\310\304@\034\217\322\030.U&\251x\277\272!\tLp\001\345\355\017\"@\262 \307t\260\245m\332\233\\9f\\\023\325\304\350I\211)9NQ\b\231\223\344\346\302IV\247\026\026\363\r\020bq\n\245\3400f\264 \323\3221\346\355<\037\330@\361\\u\242p\301\t\321\02388\314\213X\360\321\256\242\376\004\215\023|\274Q\225Q\003\276k\304\272x\335_\335=\013\001\3247\023\350\214$\022\223\273\255\243\017\257H\tO\262\226DhD}\211\300\314\233\247\3673JMTbR\300o7\326\253\374t\250\210\263\223\321\242\\\013\221:_\322\003\321C\326y\307-\013\351\f\207\377\023\001\366\376\322\270QF\t\260\230\267;\036\031\030VK\027\344\254#"
+	.string	"\306\332'p\251\344\002)\362\373\0178\n+I\b\302\024\307\321\026\252\221=\374\347\021\2504\264\244\260`Ps\201*\275\022\361\223%V\210\252\201\225\304\022\226\371\320\356u7%8\321:\317\247\013\253\17705E9\271\2360N\fX\366[\234\264\024=8VL\244Jf\301>+\255X\347\350\374\t\244\345\234\200\312.\227`\326\354\f,\f^\223\f\220+cY\302W\331\344\201'\301?K\312\330\3665^\347\215\255\226\222\320A\f \025\262\007\234\272\342\376)\275\276Q\034\005\003\227\323\2422\333I\026\212\032\364\312\351\016\304`\325\254\030\f\220\004\356\257\200G\366\347S\271\331`E\327\276\212\016\225\233\026\2422sR\f\203"
+	.ascii	"\230\272\033\233G\256\331\344W\016\362=\375\307 \206[1\254\267"
+	.ascii	"\314\316\202qp8\233{u9\241\352{n\330\255\236RP\220\330\322\227"
+	.ascii	"\034\2014\007(j\200\212\r9By\370\r(C\242\233c\237\317\212\251"
+	.ascii	"\241l\252\200\265\217\347'\023X\322?i<x\177>\364\020f}\\\364"
+	.ascii	"n\274\257\366<\332i?`]u\315\202\226\246L\f\240\325Wy\211\236"
+	.ascii	"\221\307\364\217\177\223\327A5\340\224ko}A\240JN\370%\361\254"
+	.ascii	"\305\027\300\331\333\312&qp\372\370\027`\302\360\nc4\277\335"
+	.ascii	"\305c\301\026$%\370\023\247~\245\006&\261Dn\353h\254\211c\276"
+	.ascii	"\220{c_2\245S8t[\202\333\365\322\2563\202\215\005\256\276\341"
+	.ascii	"y\036\335\377\017\305\321\235\355\3421\201\355D\317\005\311\301"
+	.ascii	"+l\001\357"
+	.ascii	"H\206\350\217\252\237I\005j\317q\3308\203\034\025kQ\220\267\361"
+	.ascii	"\nIKf\030/\206mN\204\2366.\371\001'&\363\205v?2\242\212\034\373"
+	.ascii	"\312\352\263\022fJ\"\266\223oj\222\026\311\364w\346\211\221\332"
+	.ascii	"\027\030\315\340No\021\351\2512\231\321\024\361:il\375\001\250"
+	.ascii	"\216\342{\320\365)b\241\032\244#\366Rz3!\213lTg\366t~\262-\363"
+	.ascii	"n\225d\235E\032xz6ze\244)\217\2436"
+	.text
+	.section	.gnu.lto_writeSlowFrame.158.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`9\002}\021"
+	.string	"\306\340qG\340\322&\035NT\276\371v\230$]~\212\200n\241\030i\313\360L\b\260\252!\017d \220\332\346\037\245\3218lc\305\255\36084z\020\340\032\215\317Nq\302\300\021\b_\220\340\362\334\317\332}\307&mo\"eJ\001X"
+	.string	"W"
+	.string	"`"
+	.string	"3\373\344\232\313<\002+:\035\3325\366\351\360\377|\362U<\250\365\230\r\267B\334\027\364\263\273\203rhTw\350\332K\342!\311\005\304C\267l\037\004>\254K\345K\241\303\002iw=-\361\326\263\345\377\273\351\305\343z\226\030\354\256\363\305\023\342\326\3336`[\305N\033\001$i\0327-\332/0\337Yl;HG9\352\262)\375\031kC\376\345\317>\322\2026d;\302Q\227-\303I%a\237\333\335\265\366\3300m\212\351\016\246K1\035a\032riN\323\312\245S\323/\t \304\210\347Cv\354\202\270\021\331\032\234q\342\261\337\276\277\342\001\245\224\250%\2154\b\247\315\324\210J\003\353\001\024\203j\033\301\277\026"
+	.ascii	"<vW\301\223^@8\205\372\b\2271\304)\r\314\310\246\251\252):El"
+	.ascii	"\t\2171\001F\352\177`:\200\006\344\325\246P\241@\216-\374\305"
+	.ascii	"\205nw\023\370..\224\362}\016\255Z\345_\207\376*\036^Or\020\305"
+	.ascii	"n\362\3463\253\0161)\017\321*\024\r\313\005F\225\212q\3612\274"
+	.ascii	"\2440x*\231\031\017ub\226\206\225\214\307\201\305\222\361N\262"
+	.ascii	"\233s\253=\335\355\253\335(\216m\270\335\021\013\036\373\217"
+	.ascii	"fy3\312\375\242\327Z|\037\267\276\025\177E\004\354\007\212 &"
+	.ascii	"y\331\277\006&&^6\213\203\0037\240\232Iq\344a\247&\215I\017N"
+	.ascii	"t\243\263\005, \260\002\021\232\344\006`\327\033CK\023\330\203"
+	.ascii	"r\317x\017\301W3z\317\242\\\215\304%\177[,!\213\211Z\205\031"
+	.ascii	"\213!E2\267[X&\310\031\260\207\t\277\\cN\310\256r\230\256\367"
+	.ascii	"s\302\002A\026\356MFL\203Ui\327#\215\220\360\256\300YF@\253\270"
+	.ascii	"\337\2711\234\007\355E\206\013\005\234y\321.2"
+	.text
+	.section	.gnu.lto_writeGyroCaptureFrames.159.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\033\b\025."
+	.string	"\332R\370\021C`\236N\007\233\b\r\205\320&\212\315\340&\256D&\337\317-\232G\331\037\336'\2606+\"\024\261\250\027\tjq2\231(\331\322B\251S\354\227\027X*\002a\204&[\307\020\025\265mk{K\271\223L)\r\001\371"
+	.ascii	"\021\001\031R\267k\317k\025\257\2259\216_\306,\244~\333\273\370"
+	.ascii	"]\267\3322\334\256\205i|\254\344\234U\277\3352\272U\277\247\303"
+	.ascii	"\371\234#[\345\342t\253\327\321\020\252\301\311\231\220\372\265"
+	.ascii	"\271@\234oY]\256FZ\007\016p\2313\331\203\324\357\307Uy\026\327"
+	.ascii	"\262\372\333\r\317f\331\307\366\300\345Y\346\234\241\374\366"
+	.ascii	"T\352\267\200\037a\277\247\027a\277k\267\234$\261\374E\005\007"
+	.ascii	"\007\007]\236\234\363\360\22389\005\323\024}?"
+	.string	"\343\274o\253w\365\037U\030L\201P\034t\317\267k\373S\016@c\331\227\377\fA\022\255\352\204\304L\210\013\203\200q\247(dg6\210N@b\006\304S\007\003\342@'*\326\303\211\257!#rV1\227I\337+ZT\b\345\207\343\364\207\007\235Bk\310\320N\005VGY\230\275P|\370\231\347g\224#\027\"\233\2732\037\376~\347\006\330\362dq3b&\304-:!\347\334\326Xf\346\r\300\273=Bw\203\350Fm\004\356;\220\315\275\300e\330\177U\035\231\313o\"\333~7\202\204uc\373\235\013\353\224{\201K\342\1775\366Vb\373O\357|\212hD\333l\177\373\216\243\217\223\3612Y\355LZk\313\272q\013\373\365\367\263\264=ng`\266\331\035G\264\277\326\355\230\331|\322\257\326M\265`\210mK\271\322;\312\337\274\237<\351\335\344z\336L\216\347\275\364c[I\265M@h{\200\320\266"
+	.string	"l;\351\332\016\200m#a\333G\330\266Q\320v\021\266M\024\264=\204m\013a\333"
+	.string	"\260\355\240\3246\020\266\375\223\332V\261m!\266\035Lm\247\3306\232\332\306\250\355\213\332>Q\333\217m\333k\333\035\030%aR\346}"
+	.ascii	"s\356\321\334\223\373n\362\211+\335\223\356z\356x\356o\356r\356"
+	.ascii	"u\216v\207i\027\243l\245\020X\221<\304\243\316\227\263\345\007"
+	.ascii	"0\311\036\035\366\364Zyf\273\n_v\264\005\3069FO\364H\217*\213"
+	.ascii	"mn\306\231\376\350\337\257\350\215\360\254U\234\357\316\212\305"
+	.ascii	"\225v\212\206\236\210\202\323Y\2534ps\344\212e\352o\350}\317"
+	.ascii	"o\230c\335#\307\210\225\341_k\017z\265V\331N\252\277l\017\345"
+	.ascii	"K\257\243\273-\22297a\226\351j\216\274\211\273Q\276\364T\217"
+	.ascii	"D7\206,\242\t\225\260c\234\023\364?/\3648N\261M\312\227\036\300"
+	.ascii	"[;E4\240\017ZZ\371\030@,\327;\312\001z\037\243D\375\0378V\303"
+	.ascii	"U\213#\261\020\034\325\367,G:\267\244\360\347V\270\243W\032\347"
+	.ascii	"\004\037}\341c\277b[\372\3016V\316w\374\303r/\177l\322w>%I\374"
+	.ascii	"h\005\367\263\232\372\3139Wu_9\022\353\351\350\027\277\347\371"
+	.ascii	"\275r\344\022\230\004\263\315\367#s\271w*\331\373\335\0270\024"
+	.ascii	"8\377\377\276\347\025\333\210k\332\373\\\r\215v&~[\303\206\r"
+	.ascii	"\357xJ\336\232\203#=\2449g\007\377\216\226\326t{;\262\235\354"
+	.ascii	"\016!\002\031Y$l\n\357\342z\301\305\342z\245\230\221un\255p\301"
+	.ascii	"\"\313\013{\341\027-`p]m\301X\221\025C\330ZS3\270L\250\320\312"
+	.ascii	"Zab\330\"E\026\213\241V\227\327p\252\251\271\\lu\r_pqu\r\325"
+	.ascii	"80\177\265\016\032\301\322\007\366\304\256!G\343\314\331\210"
+	.ascii	"\004\257s_\312\375\240\300J\177\345\006\312\272\235#7\244\335"
+	.ascii	"\353\222\265\211u\243\322{_3\260/\354\277$\034a\246\251u\336"
+	.ascii	"\336g\263#\375\232\035\363\002\205\277\326\352\225t\370\227\r"
+	.ascii	"\b\312\233\236\276\351]\316\034_\230e\006\177M\2177\375\360\221"
+	.ascii	"\374\306\232E\264\004V\352\t|\367\ne\225\002\241\210\330\177"
+	.ascii	"\365\200o\237[\251\0348\032\t\274\307)N9\275\317`\001?\340\275"
+	.ascii	"\030E\300;\030?B\203\243\017X\324K=\224\262X\247\351\237>\352"
+	.ascii	"]\214\247\200k9\220\3056b\n\364j\315\300\210\027\374e\013\202"
+	.ascii	"r\246\327\301\364I\177\225&\3142;\300'1\003\374S\2333\347\234"
+	.ascii	"Q\246_\360'\304\306\330 }8\343\004\200\236\250Q<\302\030SH\t"
+	.ascii	"\311\210\244-\2451\200\002\021\262\253m\020`W3M:\306B\002qJ\324"
+	.ascii	"9\315\030\177\207\305\214\326\211\004Dt\310@\235;\213#\207r\232"
+	.ascii	"\200\337\262\\k*\032\246A\006\246\224L-\333\332\275\314\030\345"
+	.ascii	"h\251,\033G<\205\031\020\362\354\221v\235\263\317\302\036\272"
+	.ascii	"\360\236\202\242\357\221\225\247\355\\\310RtW.\320D\013$\366"
+	.ascii	"\2550Y$\257l\225\354IM\371'ba\020\217\177\264+R\250N}V\376\033"
+	.ascii	"K!\250\205\341J\275\204\203\b\367D2\310\266,\207\322\354Y8I#"
+	.ascii	"\354h\276\325\022\031\373n1Z\204j\244\242\343\224A\257\274\303"
+	.ascii	"6#6@\033l\223i\263;\217n\022\"\361\201~\226\206\030\177\363z"
+	.ascii	"\270\271\350g\f\004\241Q\205v\226@O5\304\371\331B\013T\030\230"
+	.ascii	"\033\316Z\371\232C\264\205\352/M\227+ \232D\371\027S\312G\315"
+	.ascii	"\230\021\027\260\ta+\321\307\f.G\345\n1\211N\222LH\204@\344\340"
+	.ascii	"\373\016\237m\030zVk\017\305]\001\330D\262\337H\306\207\323\210"
+	.ascii	"\310\235\020\b\212\030\353\343t\237\033I\tL\342\253\255\243\031"
+	.ascii	"\317\\\376%\036\025"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureRequested.160.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\255\001-\017"
+	.string	"\226\332`E\020\221\223\016\033\234\302N\036\0053\250\233\300\340\360\256\216\370^e\363\336y7\004\243\367\005}Wk\207m\237\214#\274j\360:\t\370\032\252\206"
+	.string	"\324\034\351\r\344.XE\365W\316\210@\211\fY\262\t\331R\246\024M"
+	.string	"L"
+	.string	"L"
+	.string	"+\036\r\0042)\022\313\306\234\341\266\035\336=\223\330\025W;_~4`}2>\320{F\200\203\213\351\222\364\222\301\244\030\t\203^\245G\0168Z\321\005"
+	.ascii	"\216bg\316y\230+\013(R\225\037sN\353\007\272\334\233\333.\331"
+	.ascii	"^`\277\025r\005|\245\r43F\353\331\241\247\213\262\037\347\236"
+	.ascii	"l\2537W\335r\325q\325\253~\307\001\025\242\231\030\031\017\373"
+	.ascii	"\"\234-58\346\212+E\210\253~;\305\2071\347*\224\216\027\316\026"
+	.ascii	"\351\342C\241\322~\331\223\375r\002\005)\356\002\004\353\361"
+	.ascii	"]\026\355\273W\013\226\210\325\232\270\220j\215\300\256E\305"
+	.ascii	"\215{\352\260\257\276\254\374\022_u>\b\223p\372\357\227\317a"
+	.ascii	"\277\276\006`\230T\264\346:\347\364vQ>\n&\327\201\206\017,j\314"
+	.ascii	"\304\030\351\rK\325\036\302\354\n'\372/%\017$|LDNB\231?\036\013"
+	.ascii	"\\\310\310\007dB\310V\"\002B\262}@\241\3153\300\034\205\b\240"
+	.ascii	"\315\204\343@\033'\234\217sOV\251]1\217\307\315vTV\344\270\233"
+	.ascii	"=)G&\367\024s]\006'Ft!\244Z4\330\242\254Q{\201\257D\") \200\202"
+	.ascii	"\241\200\324\007\240\365\230\021\032\274H\360/\365\270\021\371"
+	.ascii	"\220l\224\302\205v6\346\200A\030\305.1\331\030\n\353&2=\331\253"
+	.ascii	"x\021q\013C\230\006\205\367\363\256C\024Dq'&Q\334\352r\027\026"
+	.ascii	".D\177H\360\362\276\327q\330F\221\257\222\241dV\343\356\312\255"
+	.ascii	"\257\253\323m\355\323\003"
+	.text
+	.section	.gnu.lto_loadSlowState.161.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`H\001E\r"
+	.string	"&\031YC"
+	.string	"\2216\035\233\303W\335|\366p\352\313\371\370\236Q\245\256\241\306\310^5\316\357\313\310\335\262`B\241%tP\204;\003+<\3248b\302\241\331\002\200\240\026k\002\220\327D\013\355\207\321\344\t\221\275\245L)D"
+	.string	"A"
+	.string	"H"
+	.string	">\313Gho)yg\3274\263b\367;\340O\365\350\357\036\352\261z"
+	.string	"\352\321\232-c\200\206\335\022\260`9y\261\261\273\226\202\270\366\324\374\223\370\206+m\317\216\005\273\353\344J(\267\336v\001\333\b\354\277\b\336?\314\202\201\225\335\321\271G_\244W!\325 }\030e\215\375m\251*\366\341\356\256\325d\307t\365\226\237\202\351\b\3230\323\252\351\314\364;\002D\304@9i\306\356\206\032\034{\2121!8\266\237\016\252v\204\247HUU\230\223\034\235\264'\200\362\\\252\312t\245\223\211n\276\332\327Q\200T\273\253\300?\221}"
+	.string	"\230\361J8\232\227\233"
+	.string	"\361=\207\2042D=^%\254\264\270\221R\251\357\222\215\370^\302H\271\313K`\360\003$\230\210\b\372\372d\300<B\027H\304\303\242\020\002\032\261\256Ld}\b\030\253\360\221Y\0270,\2638\337\036\256\232\274\351<\234Fj\342\2506\203\307@\230\006Q\241L\327\001\252\355\340*H\324\005G\343I\373\001\204<\007Uit\034\002\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.162.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\342\0025\025"
+	.string	"\226%\205H\3200i8\030\264\t\365\303\033\322\363\325u\027e#\034\304\262v\314`\007\3774\017\362\031R\227\252U\013o\204\254@\b\316\204\256\374\355P\215\017\343O/\270f\005\026\357<5\001\277\222\300O\261P\020\275\367\336{K\231dr"
+	.string	"k"
+	.string	"o"
+	.string	"\007\257\372\242\347\321\324u\261\017\363l\2320\247\201I\027rPE\306\203\272\200\301\213\306\016\300\230M\037CG2AO\335\247\212E<vr\024C\360\343\215\351\305\021\b07\243\232\315<y\363\361E\315\r\b\211\232\333\212!\b\216\315\355`\314\016f\277\r[\207s\207\215\366}t\367y\2763\266\331\2568\322\335\2725\233\315u\343\252\372AU\037\250\256S=3!\3272y\240\007a\320\357\350\n\313\276vP\317\022\036<s\320(\361\004\202\347&\333(\325\323\\\316\251\376k\016\241\352\361\255\222\327]E^e^]^\275"
+	.string	"\005A<%\240!$\206q6MT\215\356\201D#\376\363\353\276\252W}\217~\247)\275\317\317\227\377\270\274c\3726\247!\031L\3355\r\316\027\b\017\216\037\020\006\035K+n\324\242\337I\240\323\335\024\302\203$\2139\032\243\031\017\0079\247!g~\361b\320\026J\003\354x=\n\317{\021\321\212\265\2571\177\t7\243\027\303&\357\273r\254\355N\342Z|\034\373\236\247(\307n\331\211\243p\321\357\034T\223\262\f\017\252\236\244\354kz\023\270\242\036\215\315\355n\2239\3072!\034\317\005m\241t\371,\362U\310\004-\330\nF\322\342B!ii\251"
+	.string	"h\301\312W\204\n(,.\013+)e\211dp\225\234\260V(%*\225r\225\242b\275VT\"\b\324u\241\365R\301\\\256\227*u\366\307?\026\352'\036\351\036<\243\252\036\374\244\034\016=\031\317H\002\253*aB\216\2557cs\317ns|,\024\371\266\301'\251I\211\305\320\345\353\306q\360\237\237i\267QJ2\013\223\322\200N\267,? \200\202\031A\243\007\240\365<\005\004\303\226\221\200\373[Q\330J\234X\256\253\205\005\253\277\372b\266F_"
+	.ascii	"\271%\002\016\233-\035\263g\033p\t \232p\213m\230f`M\013\301"
+	.ascii	"i\2721\035#\205\316\270Wr \274*\037/\225 \026\025\212dI2\207"
+	.ascii	"\003\025'o\313\035\204\265F\305%\245\264\313\305\303G\306\263"
+	.ascii	"\207;P\020\247\001\033l\334\232\300\024\323\037\022\334t_z\034"
+	.ascii	"\270e\3201\036\221z\226[4\212\371\030V\270\261\367\266\326\350"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.163.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"}\013"
+	.string	"&\224IA \307*\0357\201%\003\020h\001\236#\023\361\344\351v\302\310\265\005A\343\026/\321X2r\356\250\3527Bv\270G\351\332\251\0042\300\004\b\001\360\004\002\035\271` \212\002"
+	.string	"\270d\215\354\275wJ\0015"
+	.string	"6"
+	.string	"6"
+	.string	"6\331\343\305\3262 \b\371"
+	.string	"@\333\335n\242\334t:\245\311?\354\ta\352;\315tF>Q\324aw\025R')3\235\335\265\fS\252\273\336\266\204m\b\373\244\213\212\360Y\036\343\360_\257&\225\344\303W\277\264\275~z\270\n\254\304@Y\263\305\223\234&\366\351N\226}\351\327\205\361\245\372\212\301\256H\255\301\316\352\201\024\333\327\004\013@Y\363\305\273\363I\007rw\277\351\007\270"
+	.string	"\217\\\202I\277\331`\374\030\217\234\201\177\263\275\332w\261=r\262\325\356w\022\031.\247)A\311\007\266Go\331@\330\006q:\274O\005\310c\361\3510(<\027\035H4\3528\r\3662&D\235\206\347\211:\215\b\236\356d\371\260\037\344D\301\f\234'\377\205\322\371\320F \364\320\332\335\001\207\275\252\270d\264\034"
+	.ascii	"`\2517\023\372\217b\2001\350\202v\273\017\266\304e\2361\203\366"
+	.ascii	"\336\031\311@\312f\342\006\025\030\f\003\352\262S\2157\205\025"
+	.ascii	"G\351R\030\214\021\370\342S\013\272\220\333\007\353/\343\212"
+	.ascii	"K\027\263\371\0261\272\254<\001"
+	.text
+	.section	.gnu.lto_blackboxLoadHeaderState.165.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`q\003-\030"
+	.string	"\246,\232H\300\030Q:\360\233\335\361_\375\237\2431\236I\0014x\277\241\207\332\210\013vim\0344\020\026\020\200S\350\267\306M\267\376\2521\242\241\357/\272\347\303T\b\034^\277y\260\266\377k\342\227\265_\274\375h\204\354\275\245L2\203"
+	.string	"|"
+	.string	"\207"
+	.ascii	"\323\210\215\367\376\335y\367\273\007\332\373z7\262\366T\361"
+	.ascii	"\212\n'\206\217\007\341\347\317[\323*` \373.\026#\372\352\016"
+	.ascii	"\315\321\210\262;\252\325\227\372\\U\370\271\262]*\006p\252\270"
+	.ascii	"\340\b\221M\350\250\326\272\352\031\227\275\024\202t\312f\331"
+	.ascii	"\376\343M|\351E\370\331\213\203OX\364\330\230\346\330x\272\270"
+	.ascii	"4\335p\270\003\334j2\246\326z\336Y\347Fc\006\037\324Z\227\307"
+	.ascii	"\033\317\027\300wW\306\356B\330\355X\002\276H\350\373\324\317"
+	.ascii	"1\242q\322\276\364;\001\027[\227\335\021\027\272y\025\032\265"
+	.ascii	"\326\032\354\203\316cf_\343sI\324\360\307\317}\r\375|\351\373"
+	.ascii	"N\301\212\217\021\022\320\214\2236\344\335\0236\374q\031\310"
+	.ascii	"\216\"$+\264\026w}4\356\334\356em\334\356w_T\363\236\336\373"
+	.ascii	"\276L\336R\363\206\222\027</=\357<\257\224\274-y\271yO\340\272"
+	.ascii	"\237\235\025<\207\321\243\326\235\244-\265(\275%\250n\236\037"
+	.ascii	"\216\030\274\236\263h\022V\006\327[\370t92\242Hb\032d\370c\001"
+	.ascii	"N}\003\335\345\340\201?\322\226Ef \025\325Z\334\331{\"/\022\373"
+	.ascii	" #C?\245\320\210%\354\331\247\263s\262e\3436\365SG\220Rc-\347"
+	.ascii	"Z\253\330\235\333\307\250l\030#DP\202\246\324X\313\356\017\320"
+	.ascii	"n\331\267"
+	.string	"\375h .\344&\f\322\375\237O\026\035@\334{\037\377\301\332\327\330\226\313E??b95\367yG\r\t,\020L3\303\242`\003s\211x\265\\\022`.\0214\257\001\333R\251x\205 \321b\321\204X\225\230a\325\254Z0\233\225\n\301\276L\270`+\024\257\027le\362\315\336\270\205\371\tw\202\005\007Q`~\300\255`\3418tC9j\315\371Xj\235\222nG\321\254i[\352}\223;Iq\001\003\006\372\331A7\244C\226:\267\264\371'%\350a\347\366o_\255\"\3308%\007;\002\023p\307\264s\3132\3656:rd#\352\004\017[g\350\2506\335\370\005D\250A4\307\224C\304\220\004\023L\220\024\246\031\003\200\002\021\272\353\001\020`W\244I: \344\274\320\253\367#\222\263\307i\312\342\344\323L\226\267\026j\320K\021G&j\244\200:\216Ka\243\335\345\216\333\"\350\262{\365\246N\334"
+	.ascii	"\b\265I\223k,\030\331\305\202[\026\215!\204\264i\205\314h\355"
+	.ascii	"\275\371\332 \016\352\003\033qeA\251\247\033b\264\305\026\277"
+	.ascii	"\360\203\030\234\241\306\261\371\177\225\233\266\301\225N*\343"
+	.ascii	"G\247 \005\310\253|M%]\3232\276\204\233v\312h\331\004\376\003"
+	.text
+	.section	.gnu.lto_blackboxStart.166.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\356\001\225\020"
+	.string	"&\035iG\340\262(\035RC\261(\362\205\243Xg\t\353\365\322\242`\236+?\352\353\307j62\265\234\331SK\345\232\331F\256$O\331\244\277P\354\366\213b\230a\316\2000\276\303\302ol#\253\0364\232y\327\310\336d\313\224\002V"
+	.string	"P"
+	.string	"S"
+	.ascii	"F\3316\002+\033\216\320^\030lx\354\356\027C\240\024\365nJ.*\312"
+	.ascii	"\357\300\360\335\007\346s\301\213Ge\243E\013\346\222K\340"
+	.string	"\342y\361Z\027\270\0014<\3408\315\225\245\265\242\\\007\276<\2568\003\273\013j\251T;pw\255\254\226\313\375\271\355\023\333\nlm\020)P|\022\227\246\220\242g]\372)\363r\306\307\216@\007\247\346\202\305Rz\263e*\215 \354\237\203\006\031\230\343\007;\252\247\252\017z\211\231\026\026\227\277zv[n?\266&uL\330\276\017{L\345(\fz\311\230\331]\357\322V\261\275\313{\001\376\r\027_\2320J\007D\354\356\213K\231\021;<v\244\364\346\327\334`\250@\2343\233\341\212\276\213\343\330\026\242E\356!\223\205?\263-\224\363\207\314\337<\346\333\330\266\205vbv\303\273\354\327\330\224\265!\257\303J\203\3701\233\256B\302gw\305\300\227=&\211T0\215LH\"\b\243/B\211\250\364\221N(\237H\001\233NHN\337\004\223\351\364y\262\324\301TTu\002\324v\360 \306\260\306\211\r1f"
+	.string	"\365E\323&\221\350Y\376\354\325S[\305p\244\026\223CZ\230\217\243\0257V\352\303"
+	.string	"\324.1\211\247\3713\260h\265\036:T1\f. p\002!\301\273\001`\250'\006\234ak\205\325\016Th/\240\013\351\0321PC\320Z\234D\207/Ldkc\2735@\246\275\214\032Q#\366\353\340\360\210\005\032\246[BP0\303\3027\023\035|x\310\274"
+	.string	";`\230z\234D\001\234\007\013"
+	.ascii	"\"7\320\260C\260\260\334\300\341\321\177\367\022\363\275\rg$"
+	.ascii	"Bo\257\027\243\313\360\023"
+	.text
+	.section	.gnu.lto_blackboxFinish.167.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`e\001\335\r"
+	.string	"\206\330XD"
+	.string	"\2216\035\257//\366\377\352\013\331\267\236\311\355\020\276\331\020P\277\030|b.\034\t"
+	.string	"\347\020\027\370Dl\266\031\005\035y\231\356:\211\261\225K\363\275\375\250\364{MV\222\234\030\322\207\210<Q\323&[\246\024A"
+	.string	"C"
+	.string	"G"
+	.ascii	"\237v\212}}\376r\307\026\037z\330\001\247\017\024^bv\027\223"
+	.ascii	"\035\336\371\254\244v\374\203\007\320y\333\247\307\253\214\207"
+	.ascii	"\341\362\303Y\036\237i%\343M\220\272\241\331]k\347\201n\353\266"
+	.ascii	"El\033\260\377\"\017/B\363G\216\200\242\357>}\024\353\363R\004"
+	.ascii	"5\022\271\204<:\332\341G%\007\373r\034G\031\226\033lU\177\343"
+	.ascii	"$\220\212\005\320C\234vU\306\031\233\232-H\266\357\273\274\224"
+	.ascii	"\362\026\037X\201\301\262\273W/]\303\311\315Gqk6\245\361\317"
+	.ascii	"\364\271\220\366YX\0049\205\004\\\263R\\\305WX\004A\205:\002"
+	.ascii	"\274\334\304OXT\024\bQ\206k\327\254O\355\366\343$l\213\034\273"
+	.ascii	"\333E\334\004aZXV\303~\024\340\264\206\035\336\204H\310H\026"
+	.ascii	"lF\030\220`\rJFL\260\r\347\004\013!\340\314A\002\016\006!\313"
+	.ascii	"8\330\025z^-\370W ]Hy\344\307/Q\315\016\265\025\224\310\021?"
+	.ascii	"x\0041R10j\372L\243*\243\276\211\365\361\231\345\227\036\234"
+	.ascii	"\350;\007$ `\202Q&\253\007`\324\023\n\rO\304\333\006p\230\360"
+	.ascii	"#\214\211\013\361\270\312\330\355\264\b*\274\336{\227\327{\231"
+	.ascii	",\336'\244\342\260v\b\354\312h\3644\320\360Jnc\326<\2664\244"
+	.ascii	"\365\205\206\022~\366\300\020\267+F\323\005\333\3312\016\257"
+	.ascii	"\"\263.\013d"
+	.text
+	.section	.gnu.lto_startInTestMode.169.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`g\001M\017"
+	.string	"\006\335hG\360\260(\035zc\354mZ\352B\246\337\337Z|a\365\f\353\333q\344\325\037\236\340k\r\303\214\271\365\324\332>\231\360k\031c\035\367\234|\34378C\344C\352m1\343\025K\355-K\021\322d\225\231h\262\211\334)\005X"
+	.string	"M"
+	.string	"T"
+	.string	"5BV\0336\220\231aI\221\263\273\236\206\370\351\334\334T\236\374"
+	.ascii	"bx\256\363\360\271\031`\331A\342C\\m\tr\302\030\217\270\"\267"
+	.ascii	"m\201\013M\207\217\253\r\004\006\b\034\217\250\222\352\021W6"
+	.ascii	"\004\273\373\330e\213\230\222\322\003\264\273\226,\321u{\334"
+	.ascii	"6\211\355\b\366"
+	.string	"E\004\262\017(\271c\217)\251/\373\333\356\256\365\305>\355\356TZ\245\364\001\0346\323jq]\326b\267\265\243cmf\f\354\264\333?\341\217\227}v:ME\300\306\330\2138246vG\006\237\376t\237\036\017\302}v'\300}\336\343\223\035\235~|\201\0330\0236+\r-\263j\225\330\364e}\211S\005k3TR\347,J\335\256\312\201\257\342+>\037\346\323\030L&\356Su\303\b\0329frwC\325\227S\270\253\250v\243\222:\366Q\274\226\342\3038\003\212<\353\323G\321\307\256\300U#\303%'\3407\301\304$A\244\344\001\004\021\022\030\262`\n\361\350\243\341\023\221\214B\027D^\311H\250\344\215@\223\3679\340\317\204\004z'\337\007z\236\021u}1\b\245)n\200\264)\204\344Y~\354\240\224\206w1\343\020N\025\256\323\211\252\301Q\273\371\220?\211\373\336/8\273\302\210<+\032"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\3442[\027\366"
+	.ascii	"\262\312\362\322\004p\367\252\020\272%\214\013*\374v\2252"
+	.text
+	.section	.gnu.lto_inMotorTestMode.171.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`y\001\235\017"
+	.string	"\326\334hG\340\262(\035\260\366\322#\271\033\233\013\273\b.\300\272?\315\326m\242#\276\206\016T\205NKQ\325V\023\375\353\321\332\215\003_\2340\221\003x\335\006f\230a\036F(D\2033\202\3621\375|\312\316s\354\336[\312\224\002Z"
+	.string	"K"
+	.string	"V"
+	.string	"v\210\025,p\261\252"
+	.string	"\314\212G\202\233\253\305\342\307\2343nE\\u\031\341\252\312_]\262\310l\264\310@\366b\006G\355\305\341\020\222"
+	.string	"\351\370\020q\225\360B^/\272P\244gF\307\350\005\003Ib26\334\346\032\363\352TE&sN\253\367\312p\213n;\3056\002\373;\0017\307\231\340\313\274\322\242\367\036\375\026\371\370\275\315G\202l\370\304n`,\375\354\331J\267\306\376~\337\367yil\253I\253\036Y-\202j\t\325\021\252!T\257\325\272\352\017\030\251\301P\361\036;s\272\276\241\311\023c\230P\275\355\0229\r*\230L\362QgxA\007.\374$w\341\256\220\205X\247\237\005\250\375"
+	.string	"E\357\355\352\317\t\024<\335\256\354\035+h\334\200*\251\253$h9\002\250\255\202\322{\272\367 \323\355\352\252#\324#\263[\343\227\344\b@\r\332\317\213\006\361_\222\337\321Z[\260\356\001>\225P@\235\244\234L\020N\270\b(&\025\356\224Z\341J\f\030%\301A\212cA\241R\334l~i|\237\033\210\226-\222\206n\037rl\360WI\321\306\330\026\255MX\333\3019\347\224r\343\222\366\255\0245\271\245\0210V\\\002.4"
+	.string	"\001\001Z\f8!:D\270~\213\007\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.172.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`r\001=\r"
+	.string	"v\326SD\020q\224\016\b\005\206\201T\322d\0076z&\310T+Q\204\257%p\027\324\024Iq\007\f\354P\341\250\021\262\177\244\227\325\334\366\353\017\262\255\277*\337\215\240\215@|\257\261>\270\002\274\300\372\276m\"eJ\001;"
+	.string	"?"
+	.string	"@"
+	.string	"\276\217\342\254\217\237\260\006L\311\036\355\017;{|f\225\255C\300\205\355\016\270D`0a\331]MA\\\365T\371'y\346\013\351\236"
+	.string	"\024\354\256\363\013\021\271\365\266\r\330\366\330\311\t\266\204\024\311\027p\320\300\262\002\242\235c\372,\n\026\362\237\317\272fE\013\245ee\245\235]\262J\375`\037[\035\2613\215eZ3\235\231~"
+	.string	"\016\tP\344-x\354fx\365X\225\030\216\260\003\212\343\333\341\345\353\205\013\325{"
+	.string	"m\264\244\347,NR;5:l\362jo\243\002 \332unB\302\354n\002?\305U\224|\360\321\246S\376{\364O\227\307k\207\206+\364\362eL\372\344n]\002\336>\0258\221i\013=\020i\020J\241\223\266\241R\332\207\200\271\b#\2246\201\343PZV\342\035[\035q\246\304\006\025OW\306\3245#\245%\003\273a\"T\rI\003B\230\301c\22469v\027\001\214\2434p"
+	.ascii	"\002]\036\003% \240\002\231\262s\f\240\353\215\b\255\241\030"
+	.ascii	"\206\0023\3674X\207\230qP\001T\343\332\030\"\330\360\b^\370W"
+	.ascii	"\bM\347\rK<\260\251\354\371\203}\023\037i\271\327\034\300\267"
+	.ascii	"C\352a\341^\202`S\001\255t\237;\374\212E\t\210\3558\362\346^"
+	.ascii	"x\272E\273\236"
+	.text
+	.section	.gnu.lto_writeGPSFrame.173.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\246\005m\036"
+	.string	"\366\364\272G\220\234M:'L\002s\305T\256\tB\325\345\005\037\340_\tE\373jP\235P\357W\241\322\rHo\213~\322{)\220@\246\327\022\241\247 \211\231\375m\367\232Q\035\353\034\177\327\027\007\230ig\272[#d\023)e\n\232"
+	.string	"\231"
+	.string	"\253"
+	.string	"\037'\177\216|q\362{\362Y\344\257\001"
+	.ascii	"[_5\366\253L\255Ugs\252\330\264b\344\373d\275R,\327\027\224k"
+	.ascii	"R\374\353d\273T,\327m%\231\333\316_\305\177\333\311\267\377\313"
+	.ascii	"\3776Y ]-\026\257\325\352\343+\254V.\242\027\321v\022X\335\270"
+	.ascii	"S\334\237q\347\351\257&@\213*e\304e\n\225\227\234Z\353\256\205"
+	.ascii	",]\261\231~wkk>+\251\025ml\213\t\204U\306pVS\242\256\252\210"
+	.ascii	"o\267\226cX\365\230I\b\265\326\263\317\252\306~\356\177\t\377"
+	.ascii	"\035\374c\200\213E&\f\353/\215C}uCI\0307c\316L1\331\271\326\272"
+	.ascii	"\007F\241\036\352\245\272\352\361\331\277Rv\312\322\267<\007"
+	.ascii	"&^\037\323\270S\250\327k\0218\001{\263\003x\305\343\263\343\370"
+	.ascii	"Q\366Y\306\337\311\303\326*\341\020\312\021N\265\324o\374\355"
+	.ascii	"\002\361\304\353\373v\255\r"
+	.string	"J\226\260\241\260\327R?W\217;\310\277bm \377\344\017M\276\320j\355\006\221|\035\311\007\032\371?\223\357C\343\367L>\017\215\237\233|\034\311\337!\371:$\377F\362m$\277F\362i$\237$9}K\203\346\214m\310\006\313\220\251\365\346(\343\374\264\0220\255\177J\204\032!{lZ\023]\301\216\241\300\007\301S$+\206f1\300\022\33304\tUB\177\3647\356$\373\201\031&\013\206\002\013\004O\267\366\013\222Pp\247\227\2617G96\f\342)\366l\"*3^\204\345\222\244e\267H\370\004%^\237R\357\215r\354'\006q\367O\241\002\001\356\240\356^0\027Gz\026\026\313\322\321\367\312\n\f\264\362\304\270\223{\275\314h\361\370\214h\253\234\240\325Z\033|\251lX\206o\271\363\0326l\030wn\2174\3127C+<>\013$08=}\270PB\204ST\224\211\246\2357\025\241\200\352"
+	.ascii	"\242\211)D\207\235\210\017LO\273\246(\022\273\242\001\207\032"
+	.ascii	"\341\024\265+\001\005\025\265\273q\361V\254\r\344\265\25421^"
+	.ascii	"\367\256#b+\032U`Cx\006\005\036\005e \031\005c\350z\273\224f"
+	.ascii	"C\240f\030\024(@\007\277\240Y\271 \325\364\362\265\3411\341\026"
+	.ascii	"\024x\204\305SHFX\334\003\352\335R\232\375\264~x\260TR.(\306"
+	.ascii	"\265\277\370\332\230%\225\375\224\371\364\264O\217%\033\366\f"
+	.ascii	"yr\315\363c\307h\020\032\234\334\234\037n\247q6\235\336\351\t"
+	.ascii	"\307\305\222\236\220eC\201\006\204HCktzw\224q\2067[\327\002q"
+	.ascii	"\250QD\344\024CN\215$\005E\005I\007\260\002\021\031+\333\020"
+	.ascii	"X53#\0055t`OB_\017\222\034\034\223\301\366\2513\f\224\272\356"
+	.ascii	"\353\276E=!#'V\261\363\371\2352O\2350@s\247\021R\312(\210\242"
+	.ascii	"{t2\302`\261\2451\202>9\224\275X\243\262e\024\342\027\264\213"
+	.ascii	"\027r7,%\244G\341\313\210\002\321\031\266\207z\213\3067o\270"
+	.ascii	"&'\2511P\006\216Xy>.\264\361\376\205#\2460\340\273H\252D\b\t"
+	.ascii	"\234T\302\330\222Y\370\262\304\234\247F\017B\366\241\277\261"
+	.ascii	"\336\2007bw\326@\007$\nF\235\033e\216,q&\3129,\027\035<\276'"
+	.ascii	"\346`\2410\201\232\311\377\007_\227\262R#Wy\037\365b:\006\022"
+	.ascii	"+*\2550\311\353\320\023\013\377bNS\214\2372\204\032"
+	.text
+	.section	.gnu.lto_loadMainState.174.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\210\r\375;"
+	.ascii	":gx\026?@\246N\007\005\r\332;\275\001\230\013B~D\204\211\246"
+	.ascii	":qn\360\305\237\244|zh\331\252\273\343\001\251]\300\275\350\221"
+	.ascii	"\266o\330r\240\243mC\300\222O\331F\037\345<!!{o\231RJ\001R\001"
+	.ascii	";\001W\001\001\340\230k]\347\320\272\"\t\224\264\356A\367\224"
+	.ascii	"\335\354v\323\335\246{M7^\367\262\033M\253\314\255\307\227\307"
+	.ascii	"d\332\261\261\253\232\017N\272-\235\206[\r\017\361X\316#\247"
+	.ascii	"\333\212`\243h\227\351;\036\232\3513\267\321\370pZ\373\254\255"
+	.ascii	"\326\347D\362\267\256\313\256e\260\241\322\345\217^\327\326\036"
+	.ascii	"\"\311Y\347o]W\255F9C\260Qfng\3561]w\333\016\b\013\327\025\216"
+	.ascii	"\251\267\256\313\007\f!\330hUK\245\215\332\206J\033\275\314\206"
+	.ascii	"\004\230\255c\024\234E\316\356\036\255\353\272\365V\230\203\301"
+	.ascii	"&k\355\360\377\203\326\332\224\277\355\262\331\246\267\211ML"
+	.ascii	"KC%aPuJ\321'\373~\271\357\332\036\373\350\030\325\306\232hU3"
+	.ascii	"$Z\272OZ\024{\001\322\337^\353A\361\246\267f\322k\353\344\213"
+	.ascii	"\203[{\353\245'ym%\227\346\304\207VU\326\334ZI\345\312k\353d"
+	.ascii	"\306\301\255\271\265\260\315F`\236yP\345\252\262\326\244\325"
+	.ascii	"&k\322Nv\t\020\027'\335'\ri'\2641\0015\0333O\225\342\2264\032"
+	.ascii	"\\\322O\326\251O\332\025\033\301\321\324\202\270\215K\322\337"
+	.ascii	"j\032=\362\3511\252%iW\271\326ue7\252\2555\003h\346\206\302\314"
+	.ascii	",\230\227\316\002\213@\264\"\365\203]\215\350\357\220\372L\013"
+	.string	"\205hB\350\247\"\332OP\037\332\244\263\200H\364\237\177[\242\375\364\341\363\337s\222yO;\177='\260\372\230Qt\036\025\215\032hc\242~\177\013($\317\212\276\303\315\n}\314\267K;[P@\362\265\035\027\374\002\206\267\021F\332h\377\234d\036\235\035\231\007~#!\375\351=Kx\346\030M\307+\270\256\253\005\3569\367\355k\n\231\305G\332(\217$\363\371\204\314\003\035t\034\037\032\372\326u\275\300\275\327pfpgi\224i\324\36066\312]#m4\302\213%\361\236{d\036\310\274\034\363?2\367\005$\244?~*\314%\272@t\340\352e\263\205\266\353\226\320h\232#t\263\271A\273if\320m\232\263zM\363\202\306k\306R\235\257\204\316\nP\347\004\250\263\225\320\271Ju\246J\235\021X\347\003Ag\003\252s\001\325\231@\352<\300:\013\260\316\001T\347\251\324Y\312:G\251\316P\2513"
+	.string	"\353\374\244:;Yg\242\352\334\224:3Y\347%\325y\230:+Yg!\352\034\264\316*\352\234Zg\024u\266\326\371Qg\267\316m\"\r\211\243\312\326\225LA\200\027 \267\301\231\257\331=\3636\006\370\276k)\2769%{\202\374\230\360\217\254\332QA\374\3739iuVV0\353A8\232\332\342O\256\022\013I\304\335.\233\324O\275e\024%\205\301\263\214\\$\336\306\250ofK\225\371\022\270\247\354\307T'\264\353\337\357I\253\027<\032\313I\027x\033\023\0202]\360]O<:\233P\277\344*\261\372\324\\\311e\003\360Po\001\237"
+	.ascii	"\310\371\0327\203\236\346jW\t\223\333\326\2266\372\364\315\246"
+	.ascii	"Q\271$\036\272\2759\364\217\334OO\205U;_\342\337\317\265\032"
+	.ascii	"\353\321\0364\326\267\335"
+	.string	"\031\2772\207\324|\246\fZ\332?b}\211'\036\371\364\by\013\342\201\354t\304\315\215\\.\304wz\373\007\215\233\024\240\270\361\3269\350\363!N\344F\221r\247LI\033%~\353%\347<\233\\\310U^!\217n\306\364Mo\377,19\0317\263\220V|\354\326Q\b\364\365^\271Xn\322\333x\223i\243K\337O\222r\350\366\206\017x\225Wq-\351rQ\372\341\333Bg\223\260\\\370\314w\356\322\245mT\372\252\262\037\343'7\263\256\230~t\353* \033\265\243K\206\231\203\007o\243\207\264Q\341\367[2\016\335^04Z\f\307WX\330\016\017D1\034;\300<\204\201\211\201\335P\322\241\342\353\006\215\024b8\276\302\302vx1\261\027\204\036`2jx\305\260!c\013\007\215\0307\266\274\302tlA\240b\260\034_a[b``a[\303\345\332O\205\205a\224\354!\373 |\365k\256\362"
+	.string	"\236\253)\036\232z@?\343i\320\370]\361\320\232b\2336i\243h\243W\223\236{\n\334x\231\307\323T\360/hNQ\2027n\367\214\214\211\212p|\314\t\017\343b\212r\350\024\371\370\322F\023|7I.z\332Y9\035\314\211B'\364\024\371x\033\255\336>\347\352\252\236\271\350\307\275\024\377L\2711&\032!\2508\310\333X\025\3057'\206\370G\026\3721q\375\373-iu\003\013\337\340\216mj\360\\\017u\207\247I\365rWIU,\344q\305C\b\236\352-\236\003\b\262\270\226,\236,\"***2*2J\033=\360\255\327\250\223d\241\307\243c\246\306d\340-|\003\236M\372\340\314\305g1\222\267\321"
+	.string	"\024\237\271\270%\245\016\377~B\255f\360h\316\244\031\f\031|\207'\036\357\004\022\362V\340\257\\%U_\021\320\221\227\315\342\321\342U\256\222\212\037/[1\360\216\215\245\215\026\370\316k\264K\022\320S\211"
+	.string	"\004\207\273J*)\227mj\300\023x+G\300\200\257*k\006\201\007\250A0$\031\203fDdD$I\222B\007\361\005\204\030\347X\231\007\021\020%u\016\315\204\231\024\224\244V\007!\246S\260F\002\001\320\343\213\201/,\216\210Y/\313t\353\2100H'5\350C\372H&\201E\321\220\252\013\203\362\325\235\223\350\2417\033\021\344HE\206\323\362\200\ts\376\275Y\312\257\\\217\240\002U\273\302\003}\245f\016\330\227\252 \370A B\377!\016zq\336\361\357"
+	.string	"\003\226dh\222\267\fD-\034\037g\026\330\037h]\220\372\n\204;;0)\370\272\230YY\0012\215O\r\330\342\336\300\027\215?\222V\222~\026,\264\240\234\214ik\326\303\334\346\242\270\202\246*\224!@b<\206"
+	.string	"\360u\264\225#\313S\"\026\316\230\247\353b\325&c\260\021\245g8z\323Z <\020\034\224\304\f\364\002E\204\177\307\300\300\005\366\340~\027\007\212\307\201\037n\257\211\207J\216@7\332g9\002\363\271jh\026\3164\023\313\204|)\334r/dd\211{\257\365\306\272B\252\263\260#\013P\177\221\243\030\340\217\346;\026\300{\335\273\337\236\321\275\257x\006\017\367\264Z\263\275\034[a\224\261\\\265f{9\026\257P\306r\325\232\355\005\307\376{\353\372\323\344\003\302b\305PlG\345\tJ\316\3455M\202\001j\261\030H\267\033D]\204\321\236\365:N\226= \370\370[\3767\253\200E\n\002\214|\b\375i<\244\360\220\"\217\317\355\006\303.*\030\224'\376\210j\f\243p\227\004B\344,\264%\0341U\003_4\335P"
+	.string	"gp\202\005\200\f\216v\021(5\b\227~c\222\3077"
+	.string	"\035I&\202\223\244\t\033\231"
+	.ascii	"\030\322\021\224\37518ikBD$X\261\006\005`\364L\335B\005"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.175.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\324\020=U"
+	.string	"\372\221H N \322\322\031\016\277\236\353\212\023\356t\335\360H\207\021\240\313\276\221\203\223:\342.\310\016\f\276\206\371bE\023\202\230\375\307c.\352\357\274\321\300\310(1\263X\005"
+	.string	"\ff\341\307+\021\030\227\253\207\016T\265\230\251Y7\004\214\2046\331R&\031\367\001\272\001\362\001k\221=\274\325\214o\256\371\272\277\207\177\313\337\345A\376\334\377\345\277\335\223\251\003\022d\332\211\263\322\001\017fO\267\301\036\262\340`\301\001\310\303\303\354\006W\353`\366\007\207\207\266l[\3275\250\265\033\274\257w\205\354\271\334\313w\370s\203_8(\256v\353\215\254\325M\211se.\2051\354m%\353\261\342&L\233\235)]\270\246\300\210,P\347\026\303\331\026.t-{[\215\374\206\270\211\323\246\342\276}\231\226-'\342\303\241\003\025\204\374\312\345\204\034\313>\227g]\315\326l\001\3573\242\017J\253l\020>\326\223\321P\267\026\247\002\224w\377\366\033\204\034n\2030*\256aq0tY\327\267\025\313\300\333\207\322\373\200\017J\235w1\232\337&\302\366\272.u\350\262\256\353\212\215\002\336\327B"
+	.ascii	"!\253\032\r\361\022\202E]3i\305\316\272\276I5\224Eb\365LKJI#"
+	.ascii	"\220\216\214\212\210\206\204\202\200~\212\304\241\320'\330\303"
+	.ascii	"\003\374\245>\264Y\335{\235\3517\325\023\245\f\020B\230\031\241"
+	.ascii	"\362%\347\225\234n\234\204\272\030bg\205\333)\235"
+	.string	"\250\317\235\244\017WS\266\361\210\333)mx.a\244\026\214L\371\321o\312\210\355EvJ\266\253)\233L\264\226\306CB0<\b}\212\343\205\210\333)\321\320\241\"ibWS\276\300@h\f\267\265\263\333)]@\033N\216\207\237\263\027\317\2420\221\314\233\354\224l\250q\210B\3750\203\222\333)\227hP\022-?\374\311\204\205<\345>+<\330\324\363\23323\242\302y\354\224J\2220\360_T\376+\013\222%9E\231\2360\271\033\222!Q#\235\231\344\351\336\244\246\244\302>\364i9\346\310\355\224+\240Cg\234\274\031\302\350\221\367\220\f\f5\256\353\372\347y\214,\214\3717\265\256\353\262\030\231\221\257\361\273\034\265\373\357\016\223\004\317J\201M\325\374D.\177\r\354_]R\217\004\247\275\253\272\251T\370b\277~\021M\302\332\313\203\003Q\003\270\256a\004\354\335\374\r\025\252\300\215\364b7\322\373\322\036"
+	.string	"\256\316\223\245\333\034\317\0324\265\264\231\033@\243\275\025W\006\307\331d\001\327\240}\272\243c\322\340\3349\277xOH\314\254\211\257\231\033\024#\245\321\247H\211r\020\263\344\364)\322"
+	.string	"z,\352\335>\342\330\3542p\037\366I\264\333\300\321\344\030\212\262\256+\2143\267s`\217v\337\352\340\301\027\343\221\336\327\035A\032\0346\347\027\332L\24585$\364EHkt\177\021\341$\256M\030\337Y\356)\032=\243\271G\244qS\007\371\226\321O\223\324\373\342\275\215\321\007\364\373\317\373\356\244\221\211SsE\n\030\357\355\276\201q3w\177@r\013\331\366\223]!o\225\220\027\003!\357\005=\232\227\307\277|w,\257\216c\371\033h^\034\315{\243ym\274\355W\340=|\251\356\374k|\313w\3528\3744\256\345\237\361._\031\207\373c\274\312\177@\363\276X^\027\257\373\266\370\3347"
+	.string	"!/\013!\257\224\2207\252yW4/T\221WE\363>5/"
+	.string	"\315\233\242yQ\374\360\236\020\362:5\257\t!\336\022C^\022B\336\246\34556/S\363.\025y\225\202x\223\202x\221\210\274GC^#!o\021\020/\321\017\357\220\217W\210\310\033D\344\005\"\362\3764o\261y\211\315;l^\341\220\327G\310\033,\362\3664/\217\220\027H\344\375\ry\323\346\365\ty\321\346m\037^\366\341\275\017\251:`h\252\324\261\265\232\267{\227+r&\213\020\f\206\372>\323]\025\005\025\t_l9\213S\316\332\221"
+	.ascii	"\206\205\240f.\227p\243\231\261\037h\216a+cj\322\242\227\232"
+	.ascii	"i\271\324<fykK\267\262\263$5\264\001\222\003\206\330\007\222"
+	.ascii	"2\215\311I+\366\350\026=&\304\225\372f-\224\232\2638w0\023\326"
+	.ascii	"^?I\335\243\237\324\363]\202\024\251\223\372G\215\324M\307\350"
+	.ascii	"\250\177\202\232\204\313`,#\031\001\214\252\002\007\351}F})M"
+	.ascii	"\035\330\276\204I\231%E6\362\242\276Y\034\033F\341HQ\237\314"
+	.ascii	"\3219M-w\316)T\2346\020\263\322\252fCbwF\016\2326\030\364\005"
+	.ascii	"]\325O\226\261\222\311\262\226\250L\230\244\367a\320'\316\312"
+	.ascii	"x\364\005}\242\206:\217~\230\373\324\222\340\r5Q7\233\320Ce\001"
+	.ascii	"\2106\324\037S\022\3244Z\250\177i\246\372\247\203\372\210\016"
+	.ascii	"R\r\214\347\302\020Y2|\007)\215n8\274f\034\033\240\216\321;\372"
+	.ascii	"@ i\220\321?\r\324Ii\220jO\375sc\256Y%N\215\234^\243q\003\207"
+	.ascii	"E\270bJ\025\">\315\\\356\261\321&r\250\323\343\271\321/z,]\026"
+	.ascii	"\3431\025Ku\342$\275\257GZ\336\332\234b\023\341$#\241N\354bw"
+	.ascii	"\036\2071\030\177\021;\2024\274;\347\260\367y\274^l\b\034-\354"
+	.ascii	"a\037\031\303\363"
+	.string	"\256\007d\217\266*S\205\302*\224\364>a3\235\225\251`\237~\321\037\363\"\324\027\200\353\212\274\230\n\003\020\3715(\324\246*\003_\fG\033\221\355\205\006\025h\033\334S\243o\364\337K-c<\375\2544\330\334B\034\2310\276\363\343u\210\360\351Vs6\367\305{s\344\004[\310W\235\266\245\2333u+K\001\330\314\013yQ\362\346\327Lu\206\264\247\267\342\33281O\r*\033_\254\247\215T\315\323?&\2342\301{\345\324k\301\225\023\005\2765\200\313\311h\345d4.@<j\355\340:v\201\340\303'\310\261\253\013k\013\202#\002Z;\270\266\252~X\02538^\365\326\361\252\352\370#xU<^amu\351(R\021{\272\202t\240E\325c\343*\210\226\325\221k\210+\210\026V\027V\020\254\f\216\t\\ip\304\312\240X\325\245\301\361j\270U\365\203\352\230U\265eC\270VQ\037h\371"
+	.string	"bU\245\201\017\251 XUYRV[\\RQL\253\265\301qK\252KKkK*\370\366\365~\262I.K:\332\2027rr?\206\362\323\235\007\255\216\214\034\027\037\227p\027.z\247\276\032\354\004\246f\262h\035\215>\223kc\350X\364\004M\"\226\232)\206\303\360pe\223\316\332\034\251~f\rE\371\362g\245Q-\325M\307K\026\260KT\357h\316\271s\302\340\236g\241\342e\205\026\365@R\250^\321G.\263@u\b\315 \356\312\342\230I*5sU4\337\211c\003u\025\375\"\207\"\314\334\305\tk\257\373\304X\321Kj\346\276\255\f\221$\027\244\247\366\365\230\257\215\220\324\271A\016\0326a|'\351\210\333\332\210fn\003\375\324\234\0267&\214\357\\\331g\321\032+9\210\326Ty\352\"6\316\037]\327uE\002"
+	.ascii	"n\2373n\310!\343-E\003\320Fy\354\334\347\fv\313!\243-\205\024"
+	.ascii	"\034^\223\236\263b\203\235#\024SF\31031\302\036\020y\275\023"
+	.ascii	"\215\242Y\007\032\270\006\225\005\251(\253z\261\024\025\354>"
+	.ascii	"\2505'Z\352l\216\270\267\267\267\367\254\264\251\235\332\212"
+	.ascii	"\231'\207\\\202\031\251`\023\3752<\203:\344D\224$\020y;"
+	.string	"k\034\322^[\242Mt\220\211\247f\261x9{S\324L\365\352XZ\242\257F\0027\325\261\022\275A3\315\235\263"
+	.ascii	"&QD%\343\213\255\0164\022\375\030\232>\034\321BG\207\250\311"
+	.ascii	"\205\263\246\376\231\345\341-\335\234Cj\332\202\007\315:;s\276"
+	.ascii	"8\201I\250\2018\245\224B\n\221\210\210$I\222\3461\005\304(&)"
+	.ascii	"4\017\02105TN\315HL\205\306\213\246$\0071\n\323Y8\205\370%4\001"
+	.ascii	"\341='\322\0251\221\212\247\"K\313\375\300\360\301a\361\211\324"
+	.ascii	"?\273\220W\247\2319U\244\277\311\037\312=\207\365X\270r\266N"
+	.ascii	"u\001A\013\322\357\324\2736J&\307e\342j\376j\277dv++pIb\224\362"
+	.ascii	"\031\007\337y\301\306\304}\352~;\342/Y\024Z}\b\357\304\213\030"
+	.ascii	"\346\230z\\o\"jP\223\360\250yo\231\206\232\341\304\370\327R\212"
+	.ascii	"\211\304T\367\374$\2614\275\334"
+	.string	"\245p\245\356\005\\2\226\261\221x)~\334\203Lo\013\312\240E\022\222\320\257\252\375k\350z\t\217d\226\337V,\333\201\242\3041\240B\331W\274\305wvbe9\f\020=O\255q\302\310YT\341)q\222G\300\363\355\326zmh\344M\214j^\334\250\fd3\361o\317f\222\245_\031\037\232\355\300\246<\234Y\347\324\244\314q\214\300e9\230ay\274#\360i\365\033gD\265\277f\241r\320\251\361\2517/'\334\003\321\2019\260\203T\256\350sB\233\315\234\315n\302\366LB\3528&\220\301r\340\001F\211n\033%\221\213\201B\\|\034\337\177\002\210?\300\231Y\006\304t\341\230\310f\217\276\2547y;\277\035\246\335Z\t\356\035\220i\314f\007M1\034\277\324l\006\353~\3465g\t\200s\351\374\254\037\207\335\337\322*\341$Jb\230\363\217\356\235P\n\302\373\023\306?\004\022\371\t\n\250\277v"
+	.ascii	"y\273\203\252\271S\020\224\277\327\254\037\362\370\264D$\367"
+	.ascii	"`\351\341<(\252b~\342\223`\356]\333\250\002_\376\221\376\364"
+	.ascii	"\302\211f\274\372\244_\204Nw\027\344\271\310P\212\340\027\354"
+	.ascii	"\237\240M5\004mP\321\357\232$\311\377\262\324h\243\271t\264O"
+	.ascii	"<\f\235\f\034r\272\304\375\3121W\246\246\346IY!wHW*b\274\306"
+	.ascii	"\231:P\b \203't\252\225zW\030&\251\341\025iq\025\032$\242<Th"
+	.ascii	"\002\241\205\260c\303\220\256\365\252A\346\216w\373\243\301\254"
+	.ascii	"'\343\370\350\324\316v-\331\316'\232L\337\324Mt\202\026\320|"
+	.ascii	"]\342\271M\307\030\322\"\304\340x\002\327\203\203\013\221P\307"
+	.ascii	"F\027\3540\267l`\246\324\343<\260\256\365u\241F\326S\372/\016"
+	.ascii	"\351h\336%F!wDX\276\314\302\262b\275L\222-\216\325"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.177.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`z\211\315\210\001\372\217\262\217R\020(Fi\215\001\037\356y\b\266\307\036G\304"
+	.string	""
+	.string	"\234\3407b|\307\254wZ\201z\274\235\363\342#\b\346HTWJ\360\200&\213\234\027T\022\3335\n"
+	.string	""
+	.ascii	"\340\360k\n\f\243{\336\220\360\324\022A-\021\250\033\033\264"
+	.ascii	"*\240X?!\"\243d\247\224R9\b\256\b?\tHg\357r\235]J\353\354Q\220"
+	.ascii	"\316\316\345:\373V\353\354ZHg\317r\235\035J\353\354XHg\277r\235"
+	.ascii	"\335\252u\366*\244\263S\271\316\376\244uv'Hgo\342:;\223\326\331"
+	.ascii	"\227 \235]\211\353\354IZg\237B:\273\224\353\354Q\255\263#A:\373"
+	.ascii	"\021\327\331kh\235\035\n\351\354T\243\263\033q\235\275H\353\354"
+	.ascii	"D\\g\037\322:\373\223\353\354BZg\017\342:\273S\353\354S\327\331"
+	.ascii	"\233Zggr\235\035H\353\354K\256\263\377h\235]\311u\366\244\326"
+	.ascii	"\331\221\214\316\356\303u\366\036\255\263\363p\235\375\210\306"
+	.ascii	"\331w\270\316nD\343\354:\\g/j\235]\352:{\216\326\331q\270\316"
+	.ascii	"~\243uv\"\327\331m\264\316^\303u\366\241\326\331\243\256\263"
+	.ascii	"\013\265\316N\303u\366\240\326\331g\270\316\016\324:;\324u\356"
+	.ascii	"A\242s\013\022\235;\320un@\032\347\036\343:\267\230\326\271\377"
+	.ascii	"\\\347\016C\343\334~\256s\203\241q\356>\327\271\277\3208\267"
+	.ascii	"\027\327\271\371h\234{\317u\356.4\316\255\347:w\266un.\256so"
+	.ascii	"\241q\356<\327\271\265\32087\236\353\334X\032\347\276s\235\333"
+	.ascii	"\256u\356:\327\271\351Z\347\236s\235;K\353\334X\\\347\226k\235"
+	.ascii	";\316un8\032\347~C:\267\233\353\334m4\316}\005\351\334l\256s"
+	.ascii	"\257\3218\267\032\322\271\323\\\347F\243q\3563\244s\233\271\316"
+	.ascii	"]\326:7\031\322\271\255\270\316=\326:\367\025\351\334b\256s\207"
+	.ascii	"\265\316]\005\351\334T\\\347\266\266\316\r\206t\356/\327\271"
+	.ascii	"\253\255s{!\235{\212\353\334]\255sKA:w\024\327\271\271h\234{"
+	.ascii	"\313un-\032\347\316r\235\033\n\215sc!\235\373\312un\253\326\271"
+	.ascii	"\253\220\316M\345:\367\223\326\271\235 \235\273\211\353\334L"
+	.ascii	"h\234{\t\322\271\225\270\316\235\204\306\271\247\220\316-\345"
+	.ascii	":wT\353\334H\220\316}\304u\356\032Z\347\206B:7\325un#\255s\027"
+	.ascii	"A:7\021\327\271\207\264\316\375\204tn!\256s\007i\235\333\t\351"
+	.ascii	"\334S\327\271\233Z\347fB:7\020\327\271\227h\234\373\007\322\271"
+	.ascii	"\225\\\347N\242qn$\244s"
+	.string	"\373p\235\273\007\215s\363@:\367\221\353\334;h\234\333\b\351\334:\\\347.j\235[\212t\356\034\256s\343\240q\356\033\256s\023\3218\267\r\244s\327p\235{\210\306\271\243H\347\026r\235\233F\353\334AH\347\236\341:7P\353\334P\244\363\353:?[g'\322\371\307u\366i\235e\270\3161Zg\032\\g\030\255\363\013\244\263\013\327\271\331:\367 \235\231\256\363\007Zg\036\327y\247u\326q\235sZg\034\244\263\007\\\347\016\264\316K\327\271E\353\314\302u^\321:+\221\3167\256\263M\353\254\302uN\266\316\034p\235kZ\347\r \2355\340:g\240u\306\200\353|\201\326\331\002\256s\005Zg\n \235'\340:K\200\3069\002\256\363\f4\316\020p\235\037@\343,\203\353\354\200\326\271\001\2563\003Z\347\005\270\316\nh\235\023\340:\307\320:#\300u\206\241u>\200\353l\200\326\371\005\327\271"
+	.string	"\2553\001\\\347\001\264\316)\\g\024\255\263\013\256s\0134\316'\\g\023\255s\t\327\231\205\326y\005\327Y\205\326\231\204\353,\200\3269\005\2433\n\256\363\t\033\234Mp\235K\330\340LB\007\347\021\256\263\b\032\347\021\\g\021h\234Cp\235A\240q\376\300\350\354\201\353\034\200\3269\204\353\334\001\2153\007\256\363\006\2563"
+	.ascii	"\214\316 \\g\rh\2343p\2351\240q\276\200\235-p\235+h\235)p\235"
+	.ascii	"?\270\316\022pp\366\340:G\260\301\031\002\327\031\311\301\271"
+	.ascii	"\203\353L\263\301\231\303\214\363\206\031\347\231\243\363\361"
+	.ascii	"\350l<:\273G\347\326\350\\t\235eZgb\321y(\343,$:\277\214\263"
+	.ascii	"\023\235\373\261'\336\272\346\246\354Y\375\035\027\264h\020\020"
+	.ascii	"*7,\233j\255n)\335S\372\231\233]t\225;L\325]\030(\024j\344\376"
+	.ascii	"j0f#\303"
+	.string	"\350*\017\275\204%i\202\002\205B\215=d\206\301l\354\2413;\271\267\272\253\275\3308%\206\020JM\261\207\225\344\001E\256\216\342l)1@\314\340\202\3520\016\335p\241\330C\032\347\206\322Y\316\326\362\021B\223\270\240;6|\341\220\203\022\006\n\345\022\241\207<\242\330C\346j\017\304\036\026\033\002b\017\371\004\0018\371\235@\bh\257\204\275\252!\2570P(\027\to\244\337n(\017\262 \0072 \217a1\374\307a\330\217\301p\037\177a/\314\307{\334\205\3658\313\\x\013\347\261\026\306c,\337\261\035\3271\035\317q\026\306\302r\034\307p\374\306n\334\306W\230\215\327X\215\323\030\215\317\330\214\313\230\214\255\360\030_Y\214\303\270\nSa+\203\361\027W\331\213\247p\027K\341(\314\205\302\205\026N\230(\301\302\n*\220\020@\n(\234`B\t$\214\0201\202\b!\200\360\201\007\001\b\321\001\007\033"
+	.string	""
+	.string	"\204\006\031`p\201\005\025P0\301\007\t<D"
+	.ascii	"\001\262\003\r\207\r3G\243\333\026e\210C\341\373\313\r\324\r"
+	.ascii	"%\001Em\356\216\212\321Q\363`Q\017\251\340\226\242#\301\300)"
+	.ascii	"EGY\300#\2701GW1\0366v\324\364\327"
+	.string	"7v$\rSd$\350Wd\224\005Sd\004\3277Xdt\375\342Ud\244\345e\314H\212\257\310\250i\217\203Q\264\313\240\240\236W\245\203\331l\t~\201Cc\\\002\267\214\311\346\215\3212F\no\214\017l\240t\214\364\356O\320\316\277\244\177pu\200\322\277+\335\237\326\034\235\364O\232E\354\352'\210E\316\017.\316\017\316O\353\355N\352'\345\346\327\324\326'\365\223^\351\313\262\365i\255\365I\3252\030\301o:4\226\026wE\3637i\234\324\331\2304Nj&XF\346g\3277+\322\267\246\2617\351u\213\264ML\332\006\027\006'm\273Vik\242\322\026\265\326I\331\004\301\330\262_\203W6\255j\366\312&\345\305\346c\212\340\225M\332\005\346\252&(E-\033\345\313UM\212\271\324\244(\340\\\370\"E\323j\301\357\212&u\002\255\311D\266\204\331\225\0053\255\025\314\244T0\223\222 \023\024"
+	.string	"\231]\n}w%\203C\201\354z\002\231\226\t\036'%\223\226\320w\335\312\222\260\345\272\0057\242\355\256[Z\"\266\244F\240\273f\t\212\320q\327,\270\020\262\244@\340r\305\022\374\300\373\256XW\017\364\256XM\001\3701\251U6\204\003^\255\264:\360A\251\025\007\357%\245\202\333\200\352\n"
+	.ascii	"\252' \352\256TR\032\320]\251\2322\240\222b\020&u\"x\001\332"
+	.ascii	"\325I\326\202\n\204(\b\205\001r\0243D\327Kt\\9\005\310A)\223"
+	.ascii	"\t>D Ag\3211%\345\036\256R%M\021p\271N\005!\260CN\323:t\200\273"
+	.ascii	"N\2574B\016\302\020\272\220\201\271@H\320\240\320C\221\024Q/"
+	.ascii	"\3211\365\rnR\246\353\314\225I\352\270\201\311\207\021M\312$"
+	.ascii	"u\323\244K\202\255\236t\t\256\330o\327%-\031G\223."
+	.ascii	"I\021\333\253\375G\007{lCc<\204<\r\366P0\020p\214\230\2770zY"
+	.ascii	".[\362\264\340a\343\340\336\334\332\256\260\255\215]\305\302"
+	.ascii	"\252P\261\202mieA\301\272\262\252\232\222\212Br\244\006(\352"
+	.ascii	"\264\211\t\310\322\017\245\244\"i\016\0347\210l\004\325\030\024"
+	.ascii	"\f\004\034#\346/\214^\226\313\226<-x\3308\2707\267\266+lkcW\261"
+	.ascii	"\260*T\254`[ZYP\260\254\252\242\220\034\251\001\212\332\304\004"
+	.ascii	"d\351\207\022\361\205<\260\026\242#i(J|!\017\3145\022\"\276\220"
+	.ascii	"\007\026\201\020\241\0320\2044Dj\364\0135\0302\375\333`DC\b\242"
+	.ascii	"Mn"
+	.string	"\250\275\332o\030\005\271\313\244\200B\241\354DF;\232\033\250\231\217D\230[\021\314M \001Q\305\241\336\260\213s\317\213\263\317\331G\354!\n\357\001jG\267\325\356M\316\202\022\376\204\357\352\220\313+\324\202\330\274\367\251\263oe\302\237\3407\304\336\231\360\016G\302\227\360\025\2749\377\206u\3161sC:g\240s\360\t\004D\354!\t\357\203x$\264\204*x\"\334\375\024\"\216\370\276\352\302\343g\320P\356)\0247b\b\304\352\254\210\002\020^\204\027\361]\035\276=\207PP\2376\212\321\237\032\266=o\210\300>s\024\243\337\224\364@<\302\213(\032\256\251\215\360\355\206\027\302\213`4D;\013\341{\020\352\203\007\341hXfeH\366\354\301HO%%b\017?\370\366j\0054Y]\255\264p4\247\230\300\203g~\217\f\257o\324_\261C\261&\342\223\353\342{\360&\320\242MA>\350\335D\n\350C"
+	.string	"\276\253\303*\357\264\001\251\326\327Fs\241\376\216\020\037\200\257@\354\2714\254\016\247\f\275\236LE(\024:}\006y\"\3660\304{\026O\202'\362\326/\364\355\325.\005d\016\310\313\034\bh\177@\374\240\177\241\357\241\244\240!\3270\312\033E\344i\304\b\261\207\037\364\r\326 D\021\373\322\224\225\3446<t\240\365NI`_\n\345\t\365<R\214~\224\203\357 jh\365\234j/\346\247\222a\325\223\t\n*\024\n%\321C\036>\031R=\235P=\255\254\210=\344\340\333\013J+\332m\265;\212"
+	.string	""
+	.string	"\277\301wu\330\344\025j\201\352\203K\370\234\3567p\273\007\300;\332\220\240\007\rB"
+	.ascii	"\342\273:\234zb\235\300>\263\212Q\3372\214zm\210\300\272\034"
+	.ascii	"\007\234\307\032\312\3544\240\320\031\0340?\243<\273\274\211"
+	.ascii	"@\274\004\234h<\020;\264\333:\027(\207\324\200Z\304,\203\327"
+	.ascii	"\300k\370$$\203\277\300\346\024\0350pz\247-4\275K\"\260\325\013"
+	.ascii	"\036\203w4~~\r\227b\f\225\206?\236\326*O11b\017/\370\366\352"
+	.ascii	"\003\\U\tZi\211iNAslF#z3\032QD\217\320]\035\366x\227\372\216"
+	.ascii	"\352VG\317\261\276b\237d\305\250\013\261\200\007T\351\201\232"
+	.ascii	"\271\202\232\327\264\270qx\"\334/\321\202\357'<\224\016\213^"
+	.ascii	"\263'\032\032\261\207\026\374\007\277\267\r\025|W\2078\336\251"
+	.ascii	"\013C\242\247\332\223\255\030\365\035\024|\005\303\350p\350\331"
+	.ascii	"\366\366\214\213#\366\220\202/l3O\364]\035\322x\247$\260\303"
+	.ascii	"\031O,\317\271b\324m\b\315~p\260\031\215\370\341\237\350\331"
+	.ascii	"\207\222\202|\220%\370\b\376\303w\364*\310\007\331\303K \350"
+	.ascii	"\341[\b>\002@\b\276\335\240\366\320\216H1a\002;<\362\213\260"
+	.ascii	"\357Yw\367\304\303#\366\260C\326\314H\363]\025\362\275\323\023"
+	.ascii	"\324\376\353\302%\372@\314\341i\276\207\004\267\b\271<\363\270"
+	.ascii	"\221\360\223\313S\317\237z\304\036r\310#sY\250\345\271\347M\304"
+	.ascii	"%\b\361\236^\270\221\364\220\237}O?o\242\273wz\202Z\367\332\020"
+	.ascii	"\201\245\275\032i\235\333\222\3036\247hg~C\226W\b\205\334\365"
+	.ascii	"o\303\203\bz &\2003?\003\237\203\336D3?\203S\320\003q\327a\025"
+	.ascii	"\215\177\374\256\n\333^\241\026\260_l\357\223\bj\025\210\241"
+	.ascii	"4\240\343Y\2201\013\225L\373\356wUX\366\nu\334P1\332J\254\274"
+	.ascii	"6\372\354F1\332D\256\357\023\nl\373\b{s\024\025\243\035$\204"
+	.ascii	"*=\220\325\350E\"6Q\017\335oYX\025~\275G\302F\302o\217\027\211"
+	.ascii	"\210D\354a\373\021\340%\315\360A\356\270n\353\234\0239\"\n\336"
+	.ascii	"U\341\224w\251\2470\025\243/\244\274\323\026\260A\212Q\246\007"
+	.ascii	"=\354\252\220\353}\022A\205B\243M\364\022)Fm<\350!\363k\344\205"
+	.ascii	"\362&\342\031\234\242\017\304\355\326\033\226t\204\351\002\344"
+	.ascii	"\201\314\\A\3559\222\340\206OD\b\205\205Y}T+\026^}\231>a!\225"
+	.ascii	"\227&&,l\302\367\307\224\204\205J\366\376\200D\261P\212\263'"
+	.ascii	"\302\326\272\324\300\302#\234=\021\246g\204\205\324l\321\020"
+	.ascii	"\026\022\341\"\r\302B![r4\261p\232\207c\211\205@\264\334Hb\241"
+	.ascii	"\022\036Q\017\026\372\300\332\330\301\302\243\273\277\032E,\324"
+	.ascii	"a7\230\004\007\013s\324\t&\201:\tm\260\220\210n\013\013\245J"
+	.ascii	"\030e\341\320\034^\022\250\2230\210\20548kB/\213\020\312B ,n"
+	.ascii	"\201\374\202rW\304\360\217\211c\363\343\017\003\267\226\004\352"
+	.ascii	"\364\205\277\357m,\t\324i\217\237\217\263&\354\326\334\262\374"
+	.ascii	"z\2345a\227\324"
+	.string	"\226\307\277\205\263&\352\256`\371\3618k\202\216\255\216\337n\315o+\t\324)\013\377\034gM\304%\251\305\361\313\255\245\271\361\277q\326\004\\\022\032\033\377\225\265\2634~5\316\232xK23\343?+\263\302O\306Y\023nIdb\374W\316\232P\263B\205\277\ngM\240\215}\361\203q\326\304Y\322u\n\277\027g\337\r\260\t\210X\024~)\234-!\030\246\305\277\305\331\022\201U\260\370\241p\266\004`\022\225*~\2535\253\023\376'\234-\341\227\004\266\204\237\tgK\364}M\361'Y\253\"\341\217\342l\211/I^P\3745p\266\204\336\224\"\374F\326\272\236\370\207p\266D6I\212\023\177\220(}l\317\304\337\304\265\366\203\177\t\305\030\022\177\222\013W\036\374=Z\250b\304\277\343\004\025)\177\221\t\353\r~\034%\300j\360\333`aK\210?\272\202\326\317\340\017R\341j\220\037J\242\n\220=P"
+	.string	"Q\177\354bR8\002\206\335\017\205\032\274\260\1779\001\252\013\373\236\tM\\\330\263%"
+	.string	"\321\302\236G\302\322\035;v\304\017:\366:\021IX\330\263\214P\004\307\036'\202\264\215\335-\204\034k\354l \340@cO\373\340F\031\273\231\007}5\306\330\255\004@0\214],D\240\225\235J\007c\252\354_\034\210\351b\237\262\201\036\027{\024"
+	.string	"p\311b\327\002\241\345\212\035K\2038*\366\252\f\334\232\260;\301\200M\t\373\222\013\256R\354S\026T9\302\216\244\0020*;\024\005YD\330\213L"
+	.ascii	"E\b\373\323\007\254)\273\223\004W@\330\231<X)\261\377\210\240"
+	.ascii	"\312\007;\022\004SI\240NG\354<\220RI\240N:\330\2158\313\302Y"
+	.ascii	"\207\034\354R\316\262p\245q\"\366\033\234e\241\232\304\301\207"
+	.ascii	"\330kl\360b\303i\260\013\315\f:\020\373\214\243\240 \367 gW\020"
+	.ascii	"4\216\341\006\344\354\n\202In\030\356\2776\333\307\r\246\270"
+	.ascii	"%\t\324\211\217\333\213\214\026=\356.D\274-\334\\\206X<n-\234"
+	.ascii	"]AoM\330o\024\261\207v\334w\3776\307M\347mr\334X\272\235\240"
+	.ascii	"{W\222@\235\336\270\3418[\3547\312\311\234m"
+	.ascii	"!\231\034`P\252\240P(\b=d\3566f\316\376Q\035\265\t\n\024\n\324"
+	.ascii	"M\354d\316:\021\024\n\205BA\350a\361%\340\n\n\343\202\314\374"
+	.ascii	"\036i\2667\252\b\205BIp\253\365\332;\305\215\244\207\374*y\231"
+	.ascii	"x\023\365\220\373eB\354a\3613P\265\305Jk\206\0172\361e^\246n"
+	.ascii	"Hp\206\0172\363\353\244\321^\252\"\024J\203\004\267Y\237\275"
+	.ascii	"V\334Hz\310/\326\233\345M\324C\3567\213\330C\342\023\001\253"
+	.ascii	"\356\376\264f\370 \203p\346\001\024\300\233\310\361~\204T\211"
+	.ascii	"\353\257K\320\0031s\005u\213\t2\b&|\"\314\334\375\201|w7\376"
+	.ascii	"\211033\267\001\210\303W\321\245\205\206\213\341\013\234\271"
+	.ascii	"\232\321\210\3141(\300\233h\370m\3152(G\343\201X\370n\367^7$"
+	.ascii	"8\303\007y\002\377g~\300\f\304&\022>\b\032\017\304\036\234\231"
+	.ascii	"\001\026\360&\372\037"
+	.string	"Z\263\374\311\005=\020\373;\335{\335\220\340\f\037\344\t\274\237\371\0013\020\233\310\037\004\215\007b\017\316L\001\013x\023\365\267W7\022)R\222\277.A\017\304\314\025\324B(\024\n\365'\302\334B(\024\n\345\037\302\354:?\221\321\371\205\214\316\037\324Z\315\216\327R\232\335\256\2474;\035;{\234\321\331\341\214\316\376\346:\273[\353\354mHg\277\342:;[\353\354kHgWs\235=\255uv4\327\331\317Zg7s\235\275\254uv2\244\263[q\235}\254u\366\253\353\354b\255\263\207\271\316^\245uv*Hg\267\272\316\016\326:\373\027\322\331\253\256\263{\265\316>%\321%A>\310\r\370\035\370\027\004F\273\214\371\006\374&\342\346\305\300s\265\374\030\201\3729r\204\330\303\036\363\355\325B\252'7\300\246\254\256\346\024\023\020\363]u\357\334:\243\322\337\267\230(7\013\226\277\252+A\256\346\024\022"
+	.string	"\363\035\346\273\352\306\275\031\243~\337a\246\334+l~\335\367\rF\211\253\026#\255\017\0061W\201Y\021\340\373\376r\366\n\271@u\313\\?/\337_\230\270cW/\337gx{\337|N\334\260*{W\256"
+	.string	"\255\256f\350b\375\312\242\367\335\205\312\235\322\245\347G\005\201l\224\2552.\337Y+\027\n\026\027?\253&\315)\036\240\345{\313w\325\265z\205P`\251\\\256\241\274\357-Xn\223\030L\362\276\323\240\360\276\265d\271J\222\340\301\320\345\252OIs\n\031\260\337UW\312E\342\036\271\373\306n\271P1\250wkW_\376\244\232S8\300\356\273\352\026q\207\270Ku\337vQ\334 Nu_\254\2164\247h"
+	.string	"\335w\325mr\201\2705\346\276\351\272\\%$7\351\307\353\353\307j%\366\260\347\316\256\364\250\315)\030\220\345\273\352\366p\217\304`\371\316R\305\325Q\324X\322\256\262\177D\232S,@\356\273\352\346x\247*\2707\332.q\337r\357h?bn\r7\352\016\375\214\375\220\375\230\375\230\021{\330qZWY+-!\315)\024"
+	.string	"\367]ui\2703Z\270\267o\270\037\264v\3609\365S}k\003\335\276\325\240~\332m\315c\222\200\266\357j;\246\375k\255\\\371n\373Qk\301\374\204]i\277\260}\243=\220nk\236\222\030\326\276\253-\337;=\321\245\365R\373^\373ak\271<\247~\312\324\332\274\264\357\261W\352\266\346M\021\200\366]m\361\332\273\366\311\3317Z[K\367\234Z;\313b\366\215\206\347\243\333\232\307\004C\331w\265\225{\247\035\006\367\363\366\023W\214\266?\310\276\313\260\264m?pdlV\276\351\376\250\333\232\207t\20015\264v\350\372=6\327\226\321]\255\210}\253\351\350a\200\260k\330\226*\337au\255UK\225/*9\216^\260z\275\323\016\353\372\271\373\301+F\213d`\337\326\274\226\253\013\230\326\327w\034Q\2675\317\250"
+	.string	"U(\324\253\347\230\210\342\225\327w\225KK\365l\373\001\343\325:\231\362\375\366C\203\004\350\372\256\266LZ%E!R\276\273~\364Z\251g\333\017\240\224\026I\224\247\0218"
+	.ascii	"(\337Z\337\\\337\325\266\206\347\320\211\226\372\263\367\343"
+	.ascii	"\245\030-\"\365\3267\027\221\347T\333QGh\2078\273\372\355)m\353"
+	.ascii	"\333\016*\353[+\310sJD\3534\315z\017\303\303\372\206\362\323"
+	.ascii	"\3272=\247<\333\002i\227\234DX\357Y\250V\351\352=\016\352\201"
+	.ascii	"\372RX}W[\244\266G1\250\352\333\352\307\257\335\241\243\252\325"
+	.ascii	"A%\270\207\342\311w\265\225\2668d\366\234|?\371\371km<\333|8"
+	.ascii	"i\207\232|\253\215is\201\311w\265\025j\203\340\226|3\371\031"
+	.ascii	"\323B\201,\021T\362\255\206\027F\255\205$\200\357\264\253X1?"
+	.ascii	"\201?\203\305\250Lu\352;\tP\321\3579%d\252O\352\033\016\252\017"
+	.ascii	"\355D\324w\265\350\345\235\366\024\352\236\f\023$\337QA\305,"
+	.ascii	"\025\311\226#\337jx|f&j\370\256\026\265\274\323\366\242b\235"
+	.ascii	"BC\305\250L\023\324w\r6\212uRPs\324o7<\275\254\022F\260\304\311"
+	.ascii	"\020\025\3716r\243\350\326\244\310\025\"\337nP[\254X\030\262"
+	.ascii	"\366NQ\2449s\024\025\243\3040O\337C\214\212fWOdB\276\325\360"
+	.ascii	"\250V\b\362]-\216\275\323\026\250b\357\233\347\364\035\344\250"
+	.ascii	"H\345\331\306\345\0046\375>\303\263s\242BS\365\235\2660\305\331"
+	.ascii	"\303\211T\214\022\337\230\276\233\224\212Q\236mU\246- \337hs"
+	.ascii	"JH,}W\213Y\357\264\247`9\227\234L\305(\321\372\343{iZ\254\n\373"
+	.ascii	"\361D\351\333Mn*\200\244&K\254\220\276\223\202\024\247\236Se"
+	.ascii	"HQ>\276\323\240\336\230R\350\361]-\036)B\021\241x|\367x*\026"
+	.ascii	"Y\3431\344\350;\355\312\022\n;\2048\021\217\214\276w\020)2\301"
+	.ascii	"\031\025\227t\250u[\265(\235P\364]-*\025\221\2103\244\337EF\212"
+	.ascii	"<\236mt\322\0359\276\323\360\316\220L \372\306\361]-\352x\205"
+	.ascii	"zJQ:\324\033\272\361\215\003\252x\3439\225\275\361\375\006\245"
+	.ascii	"e\343\233\350H\321F\326Fq\250\306{\225\254\333\252\305\250\204"
+	.ascii	"\241\357jQ\350\235\266\027\266\030\344\214rN\025\243C\266\350"
+	.ascii	"\367\220\222\"\3649\365%*(\364\375\006u\r$\201\306wU\006PF\314"
+	.ascii	"\020,\350\233\006\023\031?\247\230\240\276\031\337i^\245\333"
+	.ascii	"z7f\004\220\227w\352\002u\357}\022\201\035Z5\364\033\310\211"
+	.ascii	"L\026\332\320o\265\266\274\337hx`~\"\236Z\336\351\t\031\3540"
+	.ascii	"\312\371O*\231\272g[\221\b\370\214:\255\316o\265\346~\276\317"
+	.ascii	"\240\222\274\372F\200\3611\336\347\273*\203E&nXD\306\373\310"
+	.ascii	"\270=\333\332\255\355L\306\267\033\024\r\037C\206\355\331\326"
+	.ascii	"\200\324\265\376B\3037\340\213\207!\223\366ls7,\024\n]\201\331"
+	.ascii	"i%\203\346\304\342\341\264:\332\213w7\27423\027\357hPIR\272\255"
+	.ascii	"wq\"4\277\2532d\357\224\004v\254\251\347\233a\317\266~\223\261"
+	.ascii	"\312Tqv\365\031\225\037Nk_\205\315h\304\036\366|\277}1\277\257"
+	.ascii	"[m!\344\374\316\177\300\253\213\007\317\177\200kK\213G\347w\240"
+	.ascii	"`]5\240\316{\030\316\347T=\333\\o\204\f\225\263\313\353\236P"
+	.ascii	"\235V\217\303y\327k\342\201\3678(h \254\370\026\337\201%\317"
+	.ascii	"!\0222I\2068\226\337\201\250g[\323Q\2218\273Z\r{\004m\371M\307"
+	.ascii	"\342[@=\333\334\013Kuvu \325H\203a\361\356\205\247\374\025"
+	.ascii	"2D\236m~'3\304\331\345pOO\234VwS\276\337\005\271yw\263\332\372"
+	.ascii	"\240\346\223o3}\016\251\200"
+	.string	"ez\016\211\030\316P\3616?\236mmGUrv\265\0336)\215\252\342\333\216\003\237\364\361l\3630l\017gW\017Ry4 \007\336\303\3606\3605Qdv<\333\\O\204\214\221\263\313\353\260:\2468\255\036G\335\300\273\236\214T\003\357qPIO\254<\250\300_\3403\360]\225\301!C\364\207\201\317@\226\314\320\263\255\353\242\316\256v\023B\303\300w\235\005\376\002[2A\3176\377\222\231\341\354jA\031\240\366\263\300\373\027\005\276\002\316(\304\301g\233s\021tv9\035\225\235^\304@\347W\221\b\370,sZ\375\r\333\030 \366\220\002\357\\\240\264\210\177D1\030\250\342\024\023#\366p\002\357oxIL\230\004\340\001?\303K\300\3579\324\002\261O\270%\002/\001\276\030\315\005\273\347$\353\017^\256U]\364\"\360\315\005\017\002?\003\227\030\356\266\305I\346\020t]\253\362\264@\340\335\rJ\206\177"
+	.string	"6\306\177Q\307\210wN2\327\340\351ZeW'\303\377\027T\022\246\020\nx\006\274\003\346\236C$\260\274B\"\260\302\272\006\274\003\340^\252\246{;\272\"qkk\3007\035\324\002\236\001l/\225\207Q\327\216\256H\324\322\026\360\036\226\200W\300\331K\345_\260fD\263\247+\2222\262\004\274\177\301\213B\352\300"
+	.string	"\017\303\3070\366\034R\201*\346\206\200\217\201\312K\325uX+\223\253\023\330\027\002\276\353\016\3600x\275T~\235\322uu\352\222r\200\367+\324\013o"
+	.string	"\256\227\312\375\320\210[N6\267`\356\352\244\225\365\302\273\037TY\r\335\326;#\016P\374"
+	.string	"\276"
+	.string	"\337U\"\326sH\2052+0\002|\001F >y\251\332\316\211\223\255?t5aB\200o\273\024?"
+	.string	"\021D%/\225\217a\2238\331\274\303\334\224T\212\3671\274\262\031>\310.<\n\036\"\021\221\274T\036H\205Bi\254\300\354T#\036q\2629\006Gb_\2065@\271\360\036\bU\346F\272\255vc6h\341\273J4\362N]\300\022\211<\325D`\205U'\276\2056\242\220\030\375\241K\254K\020\247\023\337pC\376"
+	.string	"`\242\t\210T\2117\361FT\332\222\204T\"\210\037\b\026\276\253\304\036\304#\341\220\025\236\2058\242\21691l\221t\205o5\250\246>\rT\370\256\022q\274S\025\250D\242'\026\021X\341\022\211W\341\035\r\013q\350\245j\017fbtMP\240P\032$\232\n3\0171\352\234{\013\366\304\212\262P\240P\350\n=d\"\r\242\220\263\356\316\211\227G\354!\211\3574<\255%/\031\b\340\273J\234\361N{\n\021\372\346\020\201\375\271\024^"
+	.ascii	"\201N.\317\270\024\336\003TR\322\036\006c\336)\n\352_\231\004"
+	.ascii	"\274G\267\325.N\356\002\024\300\274S\025\260_\236C\"\260`\314"
+	.ascii	"N\275\341\336\033\274b\305N\323\205M\215\004\034\270\251\243"
+	.ascii	"\264a*y>D\260\263\301\007\016\230\251l\342,WL\320\302\246I\301"
+	.ascii	"\004\027x\340\201\340f\211d\246r\211\303\263l\342\270\310\251"
+	.ascii	"a*\233=\311\034\fzn\226<57\312\345\212%\016O\316\262\307C\217"
+	.ascii	"\216\222'g\307\246\206ER\002\366@O2\247\346F\211\243\"\331\263"
+	.ascii	"\274\251\351\271\301Q.Wx0r\317\222\206\344\004Me\017\006 6\330"
+	.ascii	"i\272H\326P\300,t\2266\314\031\356Q2]4\223\312\025-\013\027*"
+	.ascii	"\2247FV\272\300I\276\250Q\342\334,k\232;-zn:p`\234\035\233\235"
+	.ascii	"\346\016\223\247&\007\006O\r\004\234\003\203\247\346Fi\243\023"
+	.ascii	"\243G\307E\215\262\307E\007f*o\226/v\230<540q\222K\246\262G\331"
+	.ascii	"L\276X6m\2225\312\233\235\034\3462Y\001\3470\2235\315\036\346"
+	.ascii	"rE\215\316N\rN\322F\002\026\311\234\031N\252\330\30066\311\031"
+	.ascii	"\226\321\242f\005\217\221\225=.jv\232\307\r'\234\320!\002\016"
+	.ascii	"\274\202\007\247F\311L\302\270a&[ k`$c\314\360\215NR\305MRy\323"
+	.ascii	"v\340\034\027=7K\236\031\266\261In\340\032\032\2229\026p\263"
+	.ascii	"ggG\005\222\251l6\227\035`\3564m\222+jz*`\026:K\026I\246\362"
+	.ascii	"ER\202e\217N\222\331\254\271a&a0wV\334(\225+>(a\324\254X\341"
+	.ascii	"2\214d\214\232\033e3\311d\241l\352,k\224=. \250\351Q\221\354"
+	.ascii	"p\203\263\323\242G\311l\321\374\300\312\233\235\234\232\030\315"
+	.ascii	"\345\213$\223E\315\262\251\223D\326\350,sj\232\311\232\233%O"
+	.ascii	"\004K\b:0\rI\034%\363\310<.nt\2260\2263\274b\305N\323\205\r\004"
+	.ascii	",\243EM\013\233\346\216\016\007\226\321\242\246\247'\311\003"
+	.ascii	"c\007\247\006F2\006\207\023N\220\321\242F'\306\r\222e\264\250"
+	.ascii	"\261Y6\223\315\036\0175&\254\340\301\251\311a*\23374\254\264"
+	.ascii	"\321I\276\270In`\235e\222E\r\r\311\234\232\033#\353,sjn\210,"
+	.ascii	"\22298\312\027J\034\030\311\0302\374B\f2\264\260i.yZ~!\006\031"
+	.ascii	"ppv\230E\356i.s\2268G\242\r\263\330r\217\r\263\345\246\316r\207"
+	.ascii	"\307\003I%SEM\222\247\311\201\225\315$\263&\311\323ly"
+	.string	"\207\207\006e\r\263E\263\345\233eN\r\263E\263\310-F(q\226+v\230<5\312f\222\211\263\303l\352\354\330\220`\263\242\203\236\036\245\315\016\223\247\346f\311\203\344\234\035\035\345M\215\215N\f\032V\346,\233<;;8-3wzt\22434u\224L\246\013\233\r<\202\213\020-+Y$\2338;/pp\2246\315\244\212\0274\315\244\212\027Fv\021\342\031\006\023jll\2222L\344#\323\020\202\206\022\206\254\304I\332\364\324\3540c\2600\322\220\3149\262\022\247\331\334a\266h\352,s\216<\302M\210#\3670w\2326\313\033%\223\007\204\362\305\262\311\223\274I\202\220A\002\356Q\346$\231+@x\300f\007G\005\b\0318\360\316\262\231d\202\220\241(\203\221oB<\343$_0\225M\235%\210\030\214\254\314I\352\200h\256H2\013`d\235\235e3\231\303\334Y\241\263\004q\303L\356\020"
+	.string	"\311DV6\2237\\\302\b\024F\244@L6\225\0040rO\b\020 \364\204\370"
+	.string	"DO\b\020=!6\260\316\316\262g\371B\311Dr\263\005\213%\316\n\235\244\022\247"
+	.ascii	"G\356\t\361\254\344\211\321\004\241d&a\3440\227\007\330\320\324"
+	.ascii	"\211\001\306\316\002:4ubh\301b\211\200\246\013\236\246\013\007"
+	.ascii	"0w\232;9\310d3\371\002\013\235e\213\346\316N\316\f6L\016l3\202"
+	.ascii	"\206\035\025\036\260I\342\250 Ag\231\314!\301\206\331C\302\b"
+	.ascii	"\rx\207G\311$\241\271\263\303$\301\310\314\3145\343\207p#\371"
+	.ascii	";\3625&\354~\211\355\325E\300=\260\257\261\037\352h\217\373\033"
+	.ascii	"\314\354q\357\037\304}\2459\305\017\016\016\3425\324\341\376"
+	.ascii	"\372Fq\240\316\370\333;\334?Z\264)\350=2S\345\215*\316P\361\267"
+	.ascii	"\377\271\272\252\246\2540<\354\312^\267\357\352\f\030v\246\372"
+	.ascii	"\034\033AE\"y\333\273\333\373\233O\216\231\256g\233\f*\3366\023"
+	.ascii	"\305\257|\303\t\261\272\255|dOg\373\256\316l\315d=\325FP\221"
+	.ascii	"C\276\366\316\366\376\346S4s%\303\212\257\315T\271\232\260\252"
+	.ascii	"\333\312\267%\347L"
+	.ascii	"{\322D\017\355=\315hF\211\031]\230$Sh\337vxZN\272\255|Yr?~\366"
+	.ascii	"]\235\211\302\316\034q\n\215\240v\270b\366~\366\376v4C}\251\232"
+	.ascii	"\202'\272/3Ff\212\230}\327Ai-\301\362)\373\256\316\f\231\021"
+	.ascii	"\322\241J\366^\326cf*\003\216l\206\311\212p\252\333\312g%c\354"
+	.ascii	"\273:\263\204\235Q\362i\033A\355\360t}\037C\232\361\321\343\n"
+	.ascii	"\203\017(a\177H\232S\304\020\373\256\316\034\315\030\375\004"
+	.ascii	"\216\240v\270\341a\357b\357o>J3\322\231\034\036\006%\314J\013"
+	.ascii	"\2529\005\rU\276\25337\336i\243\315\330\360Yb*Fi\356\250\274"
+	.ascii	"W\231\316D\267P\231\241a\375\336Rd\n\003\354\273:3c\006z\365"
+	.ascii	"\257w\260\3677\237 \307@\031|\376u\034\343\325\3578(\341S\267"
+	.ascii	"\225\217\351\205{}W\217\177G?\037,#\2504M\246\274{=\035\277\310"
+	.ascii	"\b3\205\257\353;\016/I\350\324m\345[r!\245\0136\353\3435\202"
+	.ascii	"J\263\024\345]\n\221c\236\f\301(x\\\337qPIB\246n+\237Rs\353\273"
+	.ascii	"z\274\253\3631\002U\214r\020\324z\337:r\314BCK.\353\273\016\352"
+	.ascii	"G\267\225\017\251\007\n\234\033\007\254c\275Cy\177\363\211:\262"
+	.ascii	"\371\0209\326Q\315\257\276\337\204H\335V\276\036L\267\372\256"
+	.ascii	"\036\321\216f\316\245\021T\016gU\357VSG+:\252\256T\337nx<\216"
+	.ascii	">\360$\214J\024w\362\376\344\375\315G\311\361\313\307\207;9z"
+	.ascii	"y\223o7(\241Q\267\225\317\210\307\231|W\217]\307(o\216\021T\016"
+	.ascii	"R\276\344\235\311\373\233\017\223\243\226\017\020_r\204\342J"
+	.ascii	"\204\322\301\235$\337\325\343\325;\355+\365X\345#6\202\312A\307"
+	.ascii	"\324{\022'G'B\246\230H}\327\335\350\266\352\005\312\351D)\231"
+	.ascii	"rF\215\240\212A\362\036\365\376FuDBER\303\221\032}\274\016Z\371"
+	.ascii	"\353\222S\303w\365H=\026\3310\007\365^\203\217\325\361\351\331"
+	.ascii	"\346#\345P\307 N\375~\303\023\nu[\365\314p\334\310w\3658=2m\020"
+	.ascii	"\303:\3768&\035\225|\262\266|\242D!\366\320\215\350\tgx\240\310"
+	.ascii	"w\365\350\343\310cC\024\"\357E|\272\216F/U\177\b\202\353r\324"
+	.ascii	"q,\362A\253\016\f\311\361N\373\213z\303\307\353\253\030\335@"
+	.ascii	"}z\037b=\326x\372~\303\003t\262\024\362]=F\21746\020\005y\027"
+	.ascii	"R\345\b\024\344\217I\013\247\301w\332b\330@\037\261\261btf\313"
+	.ascii	"\364\335\211\314(\306\247\337tP`\224\260h\372\256\032\303\274"
+	.ascii	"\323\036\243\202\3611\363A+Fg\2520\2757\371\250\031\275\030\371"
+	.ascii	"d \361a+\372\020{\350L\337uxZ^\272\255zS\271\025@\276\253\306"
+	.ascii	".\357\264\317\250Y\2376\237\267bt\206\272\364\016$\316\230\247"
+	.ascii	"e\t\006\035Xv]\224?\276\253F\354;\355/;\037,>s\305\350\214T\351"
+	.ascii	"\375G\235q.\213\222\035\227\233$9\270\031(\322{\222\317\235\261"
+	.ascii	"\355\212#=\301\252\323b\343>\276\253\3065c\332\021\214\017\236"
+	.ascii	"\321\314'\217\314X\346\303\305G\317g\317g\217\330C\367Q\205E"
+	.ascii	"w\247\302{|W\215cF\261\243\026\036\357=\214T|\274<\343x<]\267"
+	.ascii	"5;(\227<\002\253\256\371\216\367#\237>c\227\024\337q\206\025"
+	.ascii	"g\205\205\003n\364]5r\031\265\216`:\336\215\374\214X1:\355\312"
+	.ascii	"g\260\317\254t\\\301\202\373\203kNQ\343E\337U#\225\321\311\261"
+	.ascii	"\211\364\275\350\317\270\344\245j7%>\203\235\226D\312\207\005"
+	.ascii	"\327\266\201\034\337U\243\324;E\201"
+	.string	"E\342t\n\301\361\236\303g\214\021\352\245j5,\373\004\032\251>\203\215F\205Bi(\031\215\340\200\303z\373[\323\300\r\"\357\264\247\030\237\216ED\3577\200\214NS\2427+\264\346\024\031p\033\337U#\223q\311\370\245\306\273\215 c\222\017#\322\217\320\320\217\r\0335\376\312\232S`\300\207\276\253F\036\306\035\306\267\350\373\320\rc\2211\207Q\372\223\243\350\307\310(\332\005\313\315j\354\002B\337U\343\r\243\2151\032\357BG\306\250\221\206Q\350\247\007\322\217\222\022\r+XjVa\026\b\372\256\032g\274S\027\214P#\227\317x\017Zr\003\307\270\200?L\323\237 A\210=\364\031iXh\326\n8\320\237\237q\311;\320;\332\223\373\345\245\362\342P7\254\263*\005\006\277\253\356\236\253g,\"\370=\370\216\026\205\033k\260\r\035\370-\370\035\211\214\250\324A\033\r)\030\372\032\204L\301\300\310H\302"
+	.string	"\022\303\033"
+	.string	""
+	.string	"\306q0K\241\325"
+	.string	"\024\200\0165n\220l4BB\241\316\343\030\312B\031J@\304\001\023'\2004BV\307\260\027\224\216\255:\3473^\347\377u\030\221'\225\022\031\237(\254U7\237\255y\235\234\022\374-\362\325\207\2551\377\214\013%\235\031\337\350\347O\243\264\315\232'\232Q\002u\f\251u\211B\250\324\304n\004g\3232\0306oi\353\240@s\332\200X\352\b\3118\033}C~N\206X\200g\341v`=o\203\324\227\363\023`eE\005ALk\300\370G\312\333\335\345\207\234\035q\336\024\306\334\230\205u#\234\375w]\245-\006n\257\276\204\360\220IA\351;\361\022\213\244!\303\306\355\214\0378Bn\037\340`@\370\324\343R\365\263M\3316F\202\006S\234.VE\326\037\0135\247\tY\321\245\\\342\206.G"
+	.ascii	"\214I\344b\037\306DV\202l3\221 \227\n\3527a\230\273\250\221Z"
+	.ascii	"J!\271\246\271\221\256\214\253\300\323\337\313\2166\034\307\220"
+	.ascii	"L\326#\266\025\231O\354\rB\217O\232\200\013D\345\203z\304\b("
+	.ascii	"\233\210F\265\220/ru\346\325\331a\272\330L\rKb\273\210QNN\255"
+	.ascii	".\221\322\233n\320I\225\341\304K\302\275\\\037\202\205E\321\273"
+	.ascii	"\306\352\033\375\021\253\002\314\250H\237D\353\025\020\361\225"
+	.ascii	"\344\277\373e:\3334)\307\274\316*&\354\3770D\357v\305z\246\177"
+	.ascii	"\275\376@\344\023\255~\"[\242\217\177\217\355\224\373dzO\351"
+	.ascii	"\342\004+\2211\335\266\026n\210\215\3513\003\224\377\016\020"
+	.ascii	"\333\243\026\265[\r\306\301E\007I\200@5\230e\217.\277\334 \250"
+	.ascii	"k\026\224\304\361sy\327U\312B\364\037u\316\266p\035 v\033\021"
+	.ascii	"\n\227\t\357\364\211\373{\026pH\335\254\377T8d!\205\365L\223"
+	.ascii	"\2517\232\233\351\231\210q\2530\032\210\321T\002C\005\302\211"
+	.ascii	"\346\030z\222\212|\260\320c6\037\025P\204\212\304v\214\236\242"
+	.ascii	"\204\312X\325$e\355j\316\250\b\177\370v\017\272\340!\267\336"
+	.ascii	"=\367\24573\365I\"\312|*\001\020yl\340\242X\b]\377\337\023@\323"
+	.ascii	"\372c3\225H\325]\262\363d\3235om\032\221s\247\344\351\007\243"
+	.ascii	"\032\317\005)\r\336\034\234\360\346\3745\302\260\340#cs?\025"
+	.ascii	":\216`B\002q\236\223;\345\265\370\373\374\312\\$>\303\341z\245"
+	.ascii	"\3156\216DF\026FM\020\250\324\277\004w\227v=@\241K\b!\260\207"
+	.ascii	"J\020\006Hq\210`\033\2576\376\312\331\201\251\027S\263\f$h\341"
+	.ascii	"*\223\257\\+\025\003\016\253\033\324\326\035\273DS\220\032\246"
+	.ascii	"\374\021\n\303\362\321\216\3173\002\311\347\n%\013_\325\224|"
+	.ascii	"\264.\271\273\314xU34C\b\345Ja\331\360,\337\267#\260%.\017\316"
+	.ascii	"\022\246*W\257?\316\275\024\2371\020\252\3677\204\270_Bh\372"
+	.ascii	"(\302i\222\021\357I\230"
+	.string	"\251$P&OO\017\241\247\326\3113\216\256\330[\336\r\"\307l\017\034|F\234\227@\237\250 %:h\300v\313Ql\206`\323\027PB\032^}\017\314\210\242g\274`.\241:\344]\\\243\375\306vs"
+	.string	"\f\256\016\362um\304Q9\013a\222\336\347Y\244\236U3\210\350\212\032_\257^>\344\340+\326l\006Tx\224\347\331\314X\202\213\025-\360hf\250e\262\007fq\313.\362\312\214\224\315'\235,\337\017\275\234\351(\246\365o\227\2748\007y\346\210\276\253~\347\350\227\305w#\r\f\206u\307\354\331\031\225\005;\213L\307]J?\031\2431\3404\314\030\304\342Z\216\244\006<\270\027\351\260\332@I\373\031s\244\224\252\202\253_\230\017"
+	.ascii	"\204\020\013\311\230\366\326m\005\347\317\f\222\357\026\206\260"
+	.ascii	"\230]L\032\\\264\231\013\364\016\007\346\252\356f(\344{\217P"
+	.ascii	"\266\321\3433#\367Y7:\257\007\177\375]\002k<\301\031b)\005\331"
+	.ascii	"\225\234W\273\211=N\002?\025\367\200\034\265\203\362\310Ao\265"
+	.ascii	"\223\233\266C\250\330\254\241\270\271\226w\n\332\n=q\214\366"
+	.ascii	"V(\023h\r\362SMapp\251\367&\357\206c\324h\027\026\245y\027\260"
+	.ascii	"\322Z\372\277\224Z\305g*VWHd\265c-\214\226\321\020\325\344\240"
+	.ascii	"\206\320\347N&S\244\312\314f\205B\2600\326l\277\261\350\354\317"
+	.ascii	"b\214M\271S\213\246\307\352\353\311n\303\346\260\204]\226\237"
+	.ascii	"\366\346E\301V|\244\216\205\332j !\023\220\rjt\"\230\210\220"
+	.ascii	"y\221\254\224\341d\332!Z\373\006F%\\&|\311$\303y\250\236\225"
+	.ascii	"t\256\273\335\260\345\031\302\261\334\355\232\323\3056C-E\367"
+	.ascii	"\222\323s\371\263\211\221\241\331!\251\333\377\326j\333\213\206"
+	.ascii	"\256\340\252\353"
+	.string	"x\345\250Z\226\317\334\241z\007\315\327\203\2376\272v\217a\004\255aB!+\342GnT\n\342\312\334YL\304\230=\330\253\231\245\217E`\224(+\226\272\207V\217a>\310\027p\373\032\3270\355\343\330&\017>\bK\367A\222\320j\311b\277\306T\370\f:\251\252\320\367\177\302\226\325{'\\\245\364u\232\033\332\034{pI\253W6\331J\210\332 Y='\320\f$\016w\216\361\324N\202Z\365\352\375M{(\005\214\261\347-\356s\232W\302\030\204\304\3218N\220o\235\224\350\t\177\306\332\030\375\232uA\266d\257\336\234X\332\203%A\207c\340\341\243\376\207\214\255i3\3405LPZ\200)\240\177\224_\335\024\303\320\013\212H\334\302\032)\nIz>\333F\034N3\313u\347hU\341\323\024\353^\004\205@'\033B\021\376\237\177\"\023\244J\006~\260\264f\212\214\2753<B\361\017E\376\260Pw"
+	.string	"\337\373\023\210 \003x#{\342\213\215\336\001\373\252\352\236e\335*\246M@\201\263\343\033\006K\005\214\347+\210\023\227\311\261\245\350\247\025\264Z\257bC\366\346>\247\3421H\343\002\317\206\243e\323:\376?\027\340\276\205;?\324H\213\334\365N7d\b\232\374_\220S\352\351%\265\f\"\005\2422\371\300"
+	.string	"\3516C\021g\304w\310\203\342\374\325\357h\2722a\245\340T\301:.\217`\350\377\302]\337\221R\300\230\313^\245Eo\350\206\251AM\031\277?\270\272\271\261B\307 \321\251S.\217\035\251Vp\313\336\3300X\374\276,!K\005\001\037g\310\022V\345\214*\345d\231RW\006\023\276I\363ypz\307E\t\323\267\277c\331\n\264\241\023\036.\241x.M\222\264\231\322\207\233`;\374\023\204l\337f\204\0179\225x\304W\334\23207\203\360*\247\013\242\032\371o\273\202\002\211\307\362DYr\265[\0027\356"
+	.string	"u\022B\373r2\234\007L\177]\273\301\017\331/\003\035\005)\367\263F\266\305"
+	.string	"94SF\275z\242f\n\312\207\037\203\215\207A,\352\316m<\242Ig\236`\360\252zT\215`\0035\013Nt\357\034\315\257\006^\235\375=l'\256\031\371-k\216m'\370s"
+	.string	"\256+\351\321\270R@gX\217\222qX\300-\300\221\3621=C\306\272\327y\211\223d\025\210\254c\370nQ\337\2437$\203\025+\241G/\"\355\254+a\337\017\324\362G1\223\207\270\377\304\242}\315p)\177\351%\342SWs\177{\266"
+	.ascii	"N\233\271\031S(.\020\354\02350\217\300\bq\264\365>%R\337\201"
+	.ascii	"n\237O\202`\303\222K\257\024\035kbL2\324\"\005\013\3103\241\233"
+	.ascii	"b\237lE9,\324\211\272/\245\324/--u\303\024\201\243Q\"[\225\333"
+	.ascii	"\270K\217\2652\220P-a\t HA\273\357{\252\222#\274\214r\274\351"
+	.ascii	":d\334j\f\273R\"Rem\275\251\277\361\307\306\220R"
+	.string	"\216\2709\247\234w\255\263)\362\350\375:s\275[\260i\342\304\2131\277\242\322\2630\302/N\324J\334\036\212\347\225ip\301\2003\302\034\200&\2134\266\270\256\215\301$E\f\314\274CP\245\\B\30175\2311b-+k\230\013\001\250 \343G\357=F\326v\244\340X\005\334Hi9\315\210\247(\365\222i\027\360]\210\215T\217~_(}}\356<\353L\232\272-0\230Xb\005\227\322\315\236g\2532\206\210\230\021\004\371\315\031z\331\337\352\363\b!h\f>\016\367\034\203Y\302N\273|7W\034X\267\330d\235\214\002\261\210R)\177\202K5\2038\3238r\306PUnS\255\f\357rR\0238\364+\002u\247xr:]\353\225p\200\323e\277x\244\\\002\037\220\235\274\363\236\215\211mf}d\356\026\225\034\305@@1\340>*\246A\255\247\334\335y\232v\325\335\0351\253\250s\232\276`7\347"
+	.string	"\002\270\315d<`tY/\235\342-wP_\335n\351+\217Y\302(\363Fid]\027i\036<\2472\303\222\221\210.<\220\372\b\253\201\237\3228U\323D\204>U\257G"
+	.string	"\276E\3011\342\350\332\332T\273\254~\006\002\215f\345*\331\217\277E\034v\212b\341\200\300\202\204\362wX\246\364\240;v\214\3436\206\034\225J\201\335N\356\254'\226\242\266\356\031\266\312\f\373U\211\321B\342\032\224\344\n\312@(ws\374S\216C\222l \257\270F\240\033Sq\023\217\361g\203\2766 T\266\nf-\206\003u\312\277\270\313\".?b\t\212b*lD%\032\226A\223$\224;,=\331\246\350BZZ\250AzE\217\245Ii\202\267b^2,\022\031\242]O\316\016\213\302\017\317\021M\f+%\340\331\365\033\322\265\210n\016\326=\250\224\213F\002\273\250\214\221\274\376\262'E\031"
+	.string	"\327\3062\275U\261]\254Nh\302}\215r\367\013\2756\205l\344V\036La^\352I\360:Lt"
+	.string	"\241\017`\037\016\366\215\234\212l\016\250\203\016SE\376\350T\177-\265\244y3\373\2049\333S<?\021Nm\035+\034~\3235,\314Wh \263*\036\335\"\340\352\364\020\357G\316\350o\2266\215(\352\031\255\335g\362\373\257\223\3069\2263\210\f*\241I-\272\351;\035\245e\242\325\222\251\"\0046R\224n\251Z\226\340|B\f\350\271Sp\004?\"p\376Bh?\270\313\204\306\261\257\2059t\312m\2029\3729\302r\200\210\237\302\217\017\250"
+	.ascii	"@\364\f \344\223\361\360\003\006\b\235\3745\001Bt\332\363\301"
+	.ascii	"\203\247\351\037\037t\013~\005\001q\f\2404\203\337_\024\266y"
+	.ascii	"$\371\354\313\3315\337"
+	.ascii	"V\231\267\306\335\025\266\255\271\267\302\233+\376\251\270z\002"
+	.ascii	"\n\315\3708\303F\t\032\317pQ\302\306)\024\232\261qB\306\023\f"
+	.ascii	"\2321\221\204\2102$\232b\242\204\216384g>\230\343\221\022\305"
+	.ascii	"\325P\244\243\261\022\304\253H\244#\021%\200\352`\244F\"%\214"
+	.ascii	"k\261HEcU\b\325\321X\005\343J\004\325\221\210\nDL\013\245\223"
+	.ascii	"\326hZzt\240\333O<'KT\272\215E1p\246\235!M@\267|\364\340\341"
+	.ascii	"\324\330\253\243@`\347.\005\220\250\007\240d\t`\004P\375A\332"
+	.ascii	"\b\276e(\222\367\305\254\021\235\216\305\\k\200\360\221\351h"
+	.ascii	"\215h\017\221\275\212\260\t\036x\301\324\0068Y2_Sc\n\232[Ky\376"
+	.ascii	"\\\376\313\364\370\274\007\270H\370\350`\261a\177\2719"
+	.string	"f\317\n\273\3300y\235\373\037\016=\255\230yIK.\030\335k\200\317[qm\031\315xN\377\273\372b\305\022\275:\352\025\201\030\211\016\305\364-B\004\3430\252s\034c\216\367\324\"\202\274\032\257\256\300\274\351T\366\325\304\300\021\2666E\244B\277\304\024S\035\346S\367\037\223\3737\263\025\266\374/\301ik1\216\270mT\305\267}\265/[\005\225y\302\0340\0137\364m\346\203\221\206\364\263V.\022\233\3203r\022\017Sh\362\0064\246\220\214\322\005W\265\244\275F\322\2617\226'Z\355\035\256\370\304\331\034X\006\003\017\017\244\314|?fG\007\027u3\310\203T\255\340{*O\342\317\202\232\347p\226\257\303\370\356\374<,\373\212\317\007\324\301\267i\372/L5\rQ}J\223\233O\256M\007\311.\257\212b@\347:&\001#s\326\205\366\235-\202\267\354\242\331S\006\253\341\3431\204Uo\t\312lM"
+	.string	"\210\356F7\307\025H\226\232\200\337S\201\016\030\037_M1\272bh\305\213\\\340\227\303WP0c[\210n:\n\202,\253Bi\363K\flZ\025\344\313Ncd\353\333\020\035~\202\223Y\032\233o\200\255A"
+	.ascii	"\253\230\001\b\\\353\007\236\355\235@\344Z\236q*\357\024\223"
+	.ascii	"Vq\214c\233\007$\016<\344u \344o\245\021M@\373\003"
+	.text
+	.section	.gnu.lto_blackboxWriteRuntimeSysinfo.178.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\251\007%,"
+	.string	"\212N<\021Gp\334Q:\313\017\"5:\326\b\250'6-OK\267.4\261\210\256d\361\262\200\222\244`OXR\264?\272\370\365\313\004!\001=\3750\313L\006\267\224\nJI\177\221\304\t\177\237\313tp\242\243\344I#\204\354\235d\376"
+	.string	"\354"
+	.string	"\007\001Y\236\202gv\352\325\206IR\031\354gi\235\225_\t\036\213\323\020q\231\207\254\324Sm\212\303\026\366T^\245[\3273\316\354\030J\267'9g\335\323\356\031\335\272\247\267\373\251/\345c\255[~\312\323\305j<\027\363\312\3464\323\314y\n\303\372\364\315\003W\036\354\351a6\320\\\265\314TAdfK%\204\247]\264>\355\345w\352\323\365\002\324\247=\201\302S\267\003\244\206s$8\315\214T\362\344\2744\302H\336^\307\346V\234\232\242\370\266\375\341u\025\300\264\024i\203\005\331\343\254\020\327\333\215\334\223\\N>s\326\0048\364A\223\013\236\247\231\272Bw<\226\034uH\343U?\366"
+	.string	"\025\214fjJ'\021\252\253\247VUE\026)\245\376\260\361\272:\221)\254\024=\021\353\030E`D\2103\b\031\205\016\221Q3~\3547\007\022\352^\234\206\234s\337#\222\352\375\363\356.\323\335_\33586m\026\334\252\362\374H}J\246\037\246\333,\340\251\272\230\356n\233"
+	.ascii	"6|\262\333\3561;x\212\261.\253x\373t\273\375H\275\030\343tM1"
+	.ascii	"\tu\237\335]\342_\216\326\234s\205\276\227\243\235\350s=m\024"
+	.ascii	")\356\217)\324\247\027?My\307\031F\274\317\016p\273y\275\373"
+	.ascii	"\343\016\027\361\b\222\235M\250\353\031\362\034C\361\221\343"
+	.ascii	"2\247"
+	.string	"\025\030\334>\365\030i\354M\324\325\323@\267\227o4\265\233\251\351\376x\254\343\fk\312\331\214\302\303\356%\324\305G\272\217\237\317\247[c#\335\353m\003\353\355\002\017{\357\372\266\320z;h\275\r\304\336\376ao\353r\267Y\366v.w{eo\343r\267U\366v\232\273\215\256\267\361z\373\342n_\301\0053\2505\246\363\f\267Yf\036\317=Y-\355\322\365\262?\354\027;\356~_\313\313\372f\255\013:!7\212\305\267\263\265\342\334\220K\\\361Ms\023\246b\034\276f\214}\210m\221\233\333$O\023\355\021.\033\352S\025c27ag\376+u\336\324\326\024\237y>\355\327\335\226\336Z$\217\303\266\265\026U\f\2418\3057\366!\272=O\233DI\333\325\245>E\361\321\266\016@L\310\025\356H5\200\273\222Q\246\324Y\033\312o\240\026\300\006\360\215U\247\363:G}\256n\233\264^\255\227\372\264"
+	.string	"~\225;\230Rf'\tVE\274\317~\031\225\350\356\330\344\264_\247\002e-\242`\360\364\314\307i\243\024i\345\\\374\261\005[\213\036\030\264R6\3708\013\262t6\213x\330Nh\316D24\305\356\263\017\224`f%\225g~\314\303\007\0207\315\224\232\024\0366\201\373\263\233\211(\033A\342\376\3307;\233\345\331\374\230\267\206\341\3453\241\310f+]\353\253\321\363vC\255\217\246\333V\347\237\225\235|\230\344,3\375\264\016\235D\204[\211\251\007T\222\321\343\321"
+	.ascii	"\016\350\bID\271\006\256\020\362b\004yKK\274\340\322\322O\350"
+	.ascii	"\344\343)\311h\022\372z\274 \317\007\\\320ND\270\227\224\200"
+	.ascii	"\302"
+	.string	"\036\222\214\265\203D\270\225^4\t\225\204\275\244!!\260'\f\0161\375B\b\020&\335%'$\334\023\366:0\301hZ!\374\375^\224\360\001\205\332WD\343\207\324\302\327s\201d\004\243\251\367\302\310\007\f\032\025!\350_\f%\240\221\360\367\003\032\351\226\304\243\031\033\351s\275\351 ;C\377V\375\330\327=\3161dg\270\337\252B8Gw\013\341\326@\304P]C\354M\2610h\016\302@\216\204\264~\374H\347G*\020\016\302\030\355\366\270T@\030\257\301Q&\301\254`Y\025a\177\246\332\257\223\261\335\311\335\321\"{\254\305c\371\2709\032m\307\3664\255\037\274K\363_\301\203\314\341p\016\353\360\231\027G\013\344_\330\254\326\342\221\327\330b\025i\005Y\213,\320\\\205\207\315\342\200\211\250a0\306\024cfh\002\021\021I\222$\035\220\002\031\251\252z\021P5d\214F\223\2442\214\001Tl(\304'"
+	.string	"'*\370\322\330Z&\201\243\244R\377\034\030\200\355f\"\214\030\254\006\226Y+\025\323\227\252\322f]d\226\2106h\3422\"\017H\017\214<sqBfH\002\036\bu\206\241\363\020\304c\236\316\220_y\034"
+	.string	"\361\336bY\007\221=\222\205\032\350\251(n\017N\372\2741\306\3422\346P\r\237p\234q\350\036\307Z+8\321y\352\216\314\325\034\220\330gcL\001\221bP\270\361\214\035\377\313<\200\021\t\235\003\342;\227\347\212\330\346\255\216\332\312\376?3t\253\260\250\203 I\002E\316\212\222\037\330\025%\213\177\272\001\265\371\264l\244~\be\340\223\362\300\177$>5xS\035)\326\210\231\345\373@\332\236$\360k\355\235\032/O\003\340/|\352\257\377L\202o\177\336\216p)P\007\306\342\247\031$\210\2051Q\243\n"
+	.ascii	"\332\246B\n\205\275\001\315\240\016I\005\204\317VW\315\372\343"
+	.ascii	"\0211\212\357\313\002\371t\216\316\022\373\243\"\342\372\003"
+	.text
+	.section	.gnu.lto_blackboxRenderHeaderImageLine.179.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\\\n51"
+	.ascii	"\332R\f\022F`^R\007\005B\023\372\212\317\324\200_\013\361r\230"
+	.ascii	"K\324\275\272\306\307b<\004+1\350\217\333}\254M\nwN\f\033\033"
+	.ascii	"o\034\007\336\022o\241_\256\205\334\030\"`\024\233\363P\337|"
+	.ascii	"\031d\265O\366\336[\246\224\002\002\001\005\001\022\001\035\240"
+	.ascii	"\277\203\372\033\300\372\r\264~\007\325o`\177\377\372\373\247"
+	.ascii	"\277}\375\335\353o^\177\373\364\367\256\277\327\376V\373;\355"
+	.ascii	"o4\375\276\350\367\337oG0a\3170M\313\034\327U[\346\034ut\271"
+	.ascii	"\231\222i\322\335\276\274lY\311+o=\354\311\331\356\245\261}%"
+	.ascii	"YO\273\237\272{\236~7\215\356^7x@\243\261\200(\241\035\006sK"
+	.ascii	"\212[\2349/\221\356\226c\017\002\177?\276\036\317g\267\252)z"
+	.ascii	"\037\267\013=\330f\t\\\223\212hd\354\363\227\374\2375\251x\266"
+	.ascii	"\306>}\253\231\223U\366\202<\317\241TY\275\217\223\2711;;\324"
+	.ascii	"A\224\363\312'W|\343P\252\220\277\376\216Dt(\347\334;\026_\315"
+	.ascii	"P,k\262O\":\220x\352PH\034]\223\300\034\rk\317\212\250y9\362"
+	.ascii	"\360+\004\353\312\211T\001\221\212\032\252\273\2343\357H\334"
+	.ascii	"\375\232\224s\3567\036ux\003y\267w\350"
+	.string	"\356\243n\2371\001\273\234\245\342\270\034\f\250sy\332\032\226\324%\2621\3573j\367\006\016\357F\364\032%\333\256\262\325\230;\230\363\230T\234<\323\253\245\305;\311\375\217L\271)Q\241\277\267\333\303\207!\342\025v\273\033O\223\001B\204\b\325\323{\033\264fO\344\337&\t7\276\265\2379Z\t\023LL\252\247\177=\331\232)\177\276;\205\212wc\373X\2366\315\341\025\266sq\240W\323\351&|=\275\3149\3375\355lT4'\232\3664)\332\222\375*\323n\006=k\222\265\217\271fk\354W\230v1\357Yy\316\212\023/\355_\274L\r\373\225\263\304\332\2734\333\316W\250\236z\324\312\306\215\375\352\366-\335\315v\333\336$\257r\026z\222\355\215\331\b\315@~O\267c\361,+\332\271\272E\323\273\261I\365\324\257\203\371\227\251#%\331\"\241\276\256{9\374\253\325\355h\276F\272\321\357\"\364\373"
+	.ascii	"\372M\204~\023\350\357\001\375\001t\276\222\352\032\004oY!\361"
+	.ascii	"\226\217\377\201\213h\341\255-1\336=J\302\321\365\256\326\017"
+	.ascii	"\275\b\356\312C\371\201[\024\246\343x\340z\030\357j\351q\037"
+	.ascii	":\367\301b\3723\225dO7\237\365\356n\214\026\316PM\354qx{\005"
+	.ascii	"\365\377\006\356\022\372)\347\3626p\327\356\213_\003'A\227\340"
+	.ascii	".\265K\3654\201w\227\365\036%\337X\265\035\276\355J\250De\311"
+	.ascii	"7!\\Z\034\342\313u0;\002\225\300%\272*\234\"r\370u\355\313\306"
+	.ascii	"M^\210\225\273\366\272\317\370I\343(\330\353\261\227\352)\201"
+	.ascii	"\353K\377\326\n\235d\0336\204U\365:e\221C|\2716\360\236\035+"
+	.ascii	"\325n\f\206\333w\243z=N\334\261I\004\343Fy\352\232*z\323\273"
+	.ascii	"n\225\265\025\255\206\336Y\227{*9\227#w^Py\304\341\251\320\241"
+	.ascii	"E\373j\013~G\211h-g\"\204V\340p\027\274\252Es\346L\214\340\351"
+	.ascii	"\033\003g\275m)h\255\216\263\371\226\265\234\245\202\336uX\237"
+	.ascii	"\263\024\315\264`F\323\211\025L&X\234@r\241\302D\013$&'\030H"
+	.ascii	"\013\nt\323\013\024NH1\232\232\234\220zK(G\3635\322OgE1\337\217"
+	.ascii	"\263\310\004\016\270O\314\242X\257w\237\344\024\305~AW(\2072"
+	.ascii	"\271\333]\317\232c\213\3144\335\321\315U\021c\242\356X\rp\247"
+	.ascii	"\272;\300\375;\354 \205\357\306Q\270\370n\034p\377J\234\235\346"
+	.ascii	"P\215?\263u\003\002\270Aw\255j\361d\001\272\316\276\025L%\024"
+	.ascii	"\346b\220\260\230\252\312\203a\033S\230\212\212\f\200\213\376"
+	.ascii	"\225\007/\320u\251$\360\006\257\027\367\274\327O\3019\216x\307"
+	.ascii	"\016\325S\340\r\321\342Q\"\177\277~(\037\005\343\036\370\307"
+	.ascii	"\017\325\323\337\225\320\336y\"\241\316\270Q\334\230\346\217"
+	.ascii	"\357\376\334\021m\333\343\360\264\t\306\nb\342Z\2700\226\222"
+	.ascii	"_\202\201\004\301XXe|\327(\031\307f+2\376L\260\345\323\315\307"
+	.ascii	"\273\275\313"
+	.string	"\333:\023\373#ZJ\016\346\350\215\340!\352U\221!\025B\264jN,\344\263\224\212^\b\036\342\3106\200\317\250Q4\345\240r\210dFJ\222\024\322\032\260\002\021)\032\253\003\021\020\245s\020\021\rI\322b`\377\213\3116\227\302\276\260\370g\"\201TB\222\005)au\b\256\365\307\372\2308\214\274{\334/\304\260\212\303\030\304\024\335\336Cb\2471\r9\215\371\233p\243\023\361\224B$\323:\333\001'\013f)\235\227hh\356E\263\\\243\t\033\213K*\370f\020S\304\261i\357j\320\200\234S\025nQ\244\016J>\005\242KR\3016J\232q\033\207\265m\270L\272x\311+\247o\037JD\305I1BU\377_[\206\326\237f&re\316\267\327(T5U4\333\351\370\234O\224\260O\206P\b\204S\246\312yKN\016\005\016\343\264\315Q\360\312/\271\337\252tf\002\340\3215\235\t\020\377\233\004\023"
+	.string	"\323\t\301\355\355 $\003d\001\246\275\0271x\022\350\236\020\261`\2578A\357R\b?\350W\034\205\227Y\350zT\237\227I\200\226\207r\032\211\200\320C\375\262\b\344\230\364~\307\226\335\346\347\006\375LJh\302\270N\200\177\301\r\321\200a\311\030\362\326\330^\247\272\236\3626\321<\214\332\250\362\261\"[\037\236\034\255<\242\310\201\217\347\016'q\352\030\025Oz\251_&%%\321\240\022q\365)+\022\277\221!\271B"
+	.string	"bO\265\2276\314\350"
+	.ascii	"\314\3461:\\\2259\357\263\335\271r\256P\365\342\350\374\310\351"
+	.ascii	"\260\2644\030\362\305\336\020lt\346\n=$\371\371\037\344]\251"
+	.ascii	"\203\235f^\001 \254\013\373\037"
+	.text
+	.section	.gnu.lto_blackboxUpdateHeaderImage.180.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\013\005E\037"
+	.string	"F7\303H\220\332M:f\364\340B}OcA[\245\245)\226\\sC\320\303B\341e?"
+	.string	"\332\305O\250\367]P\363\237_\353D\020Jk\316=KL\"\201@H\230\302\223\274^-\033\360\222\236\024+<\303o\333\244\355M\244L2\263"
+	.string	"\235"
+	.string	"\254"
+	.string	")^\227*\n\2633\037a\265\016\035\2247\362#\274\013U\350\370\2065h\373\002\0133\242\340sy\312O\235\337\320O\362\001\350\347\362v\311\fP\252H\r\316~LJ\212\265\326\\\3578\3577[\255\244\321I6\363\366\266 \322o;6/\340\323\201"
+	.string	"ip-\304Y\02139\232\236^\2229\240\223\251{\001g\220"
+	.ascii	"\312Pa91M\306).\310D\352\324Zo\301%\236d\202\032[`\340\202J\344"
+	.ascii	"M\227\0161\277\372\016\020\340\023\2230\336\244\216\026.&\\\320"
+	.ascii	"G\026\200\262Q\366\253\263\213`\217\231&\241\326\272\374\013"
+	.ascii	"6}k\276\273\304\335\205\260K\036\003:\020??\364\363M\302%Uc\335"
+	.ascii	"L&\331O\254\233^\031\237\270n\304qd\322\035\305\375\006\"\202"
+	.ascii	"\371\330\270\373$W\262\333\367\330 \241\271\027\242\237\3349"
+	.ascii	"\036NI|\334\033\357\2220\301\377\275\177\365SI\301\032\226\205"
+	.ascii	"\365\032iw\210\304\035\265{\2626\324\356\205\337\234\017\277"
+	.ascii	"8$/\216\344\265\231\2745\223\367V\362\332h\274\265\311[R^\032"
+	.ascii	"\345\245\223w\222\274d\363v\363r\363\376@\0040\275.I\316\\\364"
+	.ascii	"\327\260\2768\232U\256Ie\352\302\177x\336\375\221\374jo\f\034"
+	.ascii	"\360>\f<$\023\370\277\275\335Pj\244\255\365\336\253\007G\252"
+	.ascii	"\326\244\377\366\\\357\242`\241\247\207~\332\372KT5Z\227\275"
+	.ascii	"\200\366\016\353\215(\255\277\364\243\307\307\235M\373Li\266"
+	.ascii	"f\323h\b\253X\321x\276{\341ZVK\300bx\226\f\237X\016\024f\025"
+	.ascii	"\367;\272\253\341Uv7R\265"
+	.string	"\326\007\373\254km\330\367\370\\\016\035:\320\317\025\302\254*\005\337c\235\212\207\017>>\364\3631\204R\212cI|\2242\206M\241\035\265ONv\217\225\021\303\370\330\310Xd]8&\275\216\222\rD\344\342c\343F!;\002\224\031dG\351\350\276\311\235\004ACD\025N\004\035\031\225\"\216\204\206\202J\320\335\361\240 \002\"\261\373)\001\224\033\032\361c\"\267+2\312\361\024X\242\023AE\271#\"\242\242\334mXO\326\206\222\220\324\275\233\031\032\343\227\2521+/\356\316x)\216\341z\337\344d:\020?\277\216\3324N\314\246\017\024z\261r2\033\342\013bKAq\216D\260\232.\363\237XN\337\272\246\277T\2437\346\326+\204\\\312^\024\303\002L\255\274\216\202mU-\226\026W\210\224\035\265*hNw\217\354\213\270\305\307\306/\017\274)\237#\241\225\342\030\202 <!\374_Nw\227q\213\313"
+	.string	"\357\362\254xE\370?\234&\360Bk\312\016\227m\353\335e\250a0\351\fC\306d\002\241$I\222tp\002\221\2712z\020PV\244I\324\032`D\362\234H\311\241N8TH\274\022\360V\023\306\310\245\023\001\177"
+	.string	"\303\030\202\200\212\360\006\356\034\365\fzA4cx\t%\001\n\376\n\222\0212\217Qi9\027S#\342\305\027\241\367\206\255\240\301\237\226\342Y\310\326\263)\214\334\207\377\236|\317\372J 2=\311M\265\301)Z\310\203\003q\367:"
+	.ascii	"\363\003\215\007\334\353\027d4.H\205V\227e\337dU\371P\303G8\032"
+	.ascii	"fp\177\322\361\342\f\321.\273\200O\245\211\363:\270v\255`\336"
+	.ascii	"\324\364=\330?\241\312\304\306~7I\362C\205\345Mx\315\221\311"
+	.ascii	"\324\203\306h\321\324\362=\254\322!\246\377\361\356c\343\346"
+	.ascii	"\256$[KM\211K\r"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.181.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"=\f"
+	.string	"f\327SA \217\223\016`?s\234\004"
+	.string	"y\001\253\320\373\001\224P\201\030%\034\264M(\360\001\201\240eW\372\r\273\345A\277\343$\256\336\336\330"
+	.string	"\t\2006*\3101\306\017 \336\271\217Ti{b\311\336R\246\024A"
+	.string	"B"
+	.string	"@"
+	.ascii	"\357\003\246Cc\266\3129"
+	.string	"\020\253iY1\202\"cw+\375\200%\366\247\211\371\230M\364Ge\270\276\r\211\303\n\200-{\033,RF\336=I\266Q\346\245cw\235\332v\341\206\267\235\3006\002\373\n\002/\375\323K\247\246Om`\230`\370\013\027\273\026\342\214M\201*B\330~\306vr/\201\375d\202F\300\216:\222\003\324\2419\352i\177\304I`/Q\260\306\256\007\024)v9\003\346P\207\033'0\035\006,\035\342\t\325\022\3479\246\324N\327b\224,\016\020c\214q\216\351\232\372\n\033\262\243\334\004\004\337\304 !y-d:\274\276\373\023QRY\321 \222\321\346\262\324\022\373\032c\214V\222\375\223\377\022V\310Z\360B\037\237\b\037h\017G\302\325i\340\261\034t\252\017\006\226G\345\001\201T\234\215\257\007\037P\025\272.P\225\341D\376\256$\247fNm\013\270C\224-\177\273\273\017\223\027\235\324\366\270\362\232\241\212\036\025"
+	.ascii	"`\25173\b\320 P\004\002\263v\3144\003\254$\332\226\026\204\213"
+	.ascii	"\013'i(\f\023\032\272\006\024\303h \374\246\246\300\275`j\312"
+	.ascii	"\270\313M\265G\003S{"
+	.text
+	.section	.gnu.lto_blackboxLogPredictors.182.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\234\002\275\025"
+	.string	"\246*\222H\260\226Q:\342{l\t\250\026|\346\006\211\235'\341\225\226\036\3107\2410\332\335\205qn@\323\030\254\223V\373\247N\215\335|\266\211\277\272\334\007\336\031\374?n\353\354e\252\032\202o\030\003Tp\225\371\223}\262\267\224)\005\177"
+	.string	"v"
+	.string	"|"
+	.ascii	"F\035>\205&\312\026\362h\232\223\304\314\245iR.c\356\362]\312"
+	.ascii	"\013\370.\r\263\231\006x\230\261\004\241\016Z\016\336\234S\265"
+	.ascii	"C\226\217\271;*\354\247O\306U\230\217{\034\202\262\003k\261\237"
+	.ascii	"R\374\213/6\026NXjB\021\206H\022\355:\232\312\210B\362\361\203"
+	.ascii	"\245\346!*x\021\243\350\273k\210\332Lc\321\211\357w\227C=%\260"
+	.ascii	"v\342z\262\231sZ\301Z\211;\345\266U"
+	.string	"\330f`\353\214\227\337\357~\263\353)\001Q\3104\334}\021\304\004\210\335\233\235\233\351\332\220\210\222\360\2746\373\244^\371\324)\324\217\356(\325\033\325\272\352\267\2744\021a\342=!s\216\b{3I\002\201\361\243\337\350j\337~\316\337\341x\016\330\217\214\364Yb\376\003/\354\3214\347\254I\271\204\211\267q\235\2352\207\347\214\302)\361\346\234\251K\233\203\235\272\324\343\234\362i\274\006\354\001\023p\364 \316w\231\332\353\036c\03019Q!\323P\356\315\b\226\026\265\273\2443\217\033\302H_\334G\271\261\024\244O\036\347\2343\356\315\366\201\307E-k\327S\022Z1\323\320\273?(\024\250\261+\034\267rq1\347\\pyp\211\356n<B\213\"\323\320,\372\265[:zP\027&hc\366{l0\340\002\264\235\341<v^\004\311\234\263F\307w\360\370D\227\356q\351A\327\027?\030\\/\035\271\002Z9"
+	.string	"\362ieh\251\230E\243\301\225\303\303ZY\310Q\371\354\254zT\254\327\005\025\315\213]?\255\227\n\310\345z\251R9\331\327f\225\260(I\2663w\210s\266hp\243\037\367"
+	.string	"M:\177\b\223\202S\346\32261\205r\"\240\317\035\367\340\223\201S\342\0018\204\317\327\335D\320\203\226\033\263L\221\017>\276\275Y\037\363\255l\316\r#A\372\304-a\0302y\314\227\332\225\275\017\344A$\370D\016, P\202A\212l7`\352\215\001o>$5Z\004c\354$@\275\001\023"
+	.ascii	"\204G\222\262\254\330\262\271\215\036@\200\241c\317\302X3U\320"
+	.ascii	"`\207\177\203\306\233\337\351pNo\260\005\036\215$\236\325V\253"
+	.ascii	"a3\013\266\324\032\367x\200\202\302\256\235.\342q\305X\215\363"
+	.ascii	"\n\022\204\022\362e\206\210\354\300\230\260\226-)` \312\246\313"
+	.ascii	"<\001"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.183.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\374\001\215\021"
+	.string	"V rF\340\360&\035\376\215Q8\307>\304\264S\304~a/fc\327\317N\210t\344?iS\262\003L:\203\237i\335\352\271Z\3504\207\303\215m\342\020B\b\361\260\206/\346I\247cd\007\354\001\0325\307\262d\023)S\n\\"
+	.string	"W"
+	.string	"b"
+	.string	""
+	.string	"\016MN\302\035n\037\341\016\355\031\273;|\347\226}D\300f]\tb\021\016\221\216\335\365\224\304[\347\340\246\331\362\377\363\217\017\346:\027"
+	.string	"\346\341\260\303\267\020X\315i6\251\233IQ\r'\004v\263\225\354\204X\372\317\023\003\354\225yJ\331]\347\007\313\271O\267\275b{\201\235\016\002\321\247\264a(\344\277\353Y\304\240\332K]\266\354\225\312c\177[\335\2615\r\262\245;M\253\246S\323\027)\331\221\201\303\233l\354j\210<\266\006e\234\270\354\267\357\007\2356\363!#\210)\371\354nw \177v\241\307Z\227\311|s\366_O\274\201\264\273\341\300\241Q\002\333O8\020M\321j\210\304\030s\374\204\353\024D\177\003\342\225\321\276\213\277P\255TT\270\303NO\373\206B\350hI\307+\237\261\220\224\330]\005!8=`|I\252-6\242/I\365\263\017\210\021cg\022\021W\250\3628\365\232\242\031\325$\223\375\024W\301\342\367\270\205\005}\026w\230Z"
+	.ascii	"\207\016M\006\250\030T\203\030\227U\205\325\207U(\026X)\026\025"
+	.ascii	"JB\312sYA\265x\252\027\030\017\245\304\254\t\253\027/\206\305"
+	.ascii	"z\361:\031\315\177\376\013\221F\215F_\234\314\266;\202\301e\377"
+	.ascii	"\354\002\220\2062\316\260g\354\243\374\326\300\241S\\\331\004"
+	.ascii	"G\362C\237=\340\200bJ>\237\017\201\363i\021P\371\317\320L&>\030"
+	.ascii	"\005* P\2021\246\220\007`\365\004\001?\274\231\260r\001\347\330"
+	.ascii	";bo/{\370[\241\b\214\231\315M\027\027\262\252\205\306N\250\315"
+	.ascii	"\220d\024\023!pC\373p\256\367\004q\255i\211'\216X>g\232\342\260"
+	.ascii	"\030\357\017\304M4\bck\n\312\023\237\023V\2009x4\006\346H,\262"
+	.ascii	"\350}\033\345\002\316\305\273M\256f\017"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.184.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`x\002-\024"
+	.string	"\246\243}H\320\360(\035\372\031lG\325P\305A\345o\211\275XI\323\376\203\035\300\250\007\225Q\323\005\023\300\325\247\216\006\373\365\020\352\305k\253\024\277\372-\f\231\364\003\344\226:\267\034byM\025F\250\020\365\t&\n\335\366&{\247\024e"
+	.string	"a"
+	.string	"o"
+	.string	"\2738&\237>\371\370\364\355\"\364\363\343\003\350\247-c\177\237\377\034\263\227\n\320\254LAe\2621\341\264\273\240\374y\354tz2\306|T\nHX\223\235\246j\037>=\334\363FzD\344\b\251\315x$J;\233\353h\242\f\251\325x$\273\373\241\307\233\032-FT\312\356:\206\265\234\033u\333+\266\031\330\361(\363DG\361\372\330\235=\364O\334h\305\017\3724\313k\372/\n\313\020\037^>E\305\261\253\2212\373F\213\322\307\276\267\262\307\366\242?\032\235\232\321\324\213\2162\372!\bx\202t^\215v;\324\035\273\233H#~\373\355\373%\256\223y\316(\266\372\235\310\307\275\350\266\330o1\337\234}\016\211\252\243)\362\223\257\tAK:\214\t\024T\242\n\375L\311\242\245\244\0270\307\271\214b\253BT\272h\271\b"
+	.string	"\240\261\203\364\02609\226\027\b\264;\253@?\251\244?\225\351\006D\224\266\205\343X\"@\273\273\340\241\r\026,?(\312\343\356=\331z\b\355\314b\215\273+\223\322\307&\277\\\351j\314\304'\007\210\336\255DO\364#\227\212\257`\265\\.\372\252\027\225\203\227\226\326\206\026\210Y'\034`+\026\226\352\302\nlYQ\275@\226\213\006\360d\3040\f-\027\360\005\006s\001\277\333\354C\177\310\243\263\233I\032\215\361vy\032\340.\240)\027\253\214\245\030n\202O\247\310\"\217i >w\334\003Zd\253N\341\201C\240\276.\202\204\370\320S\312\314\003\247\316\360\244\217\343K\350'W\272\030\265\326\033/\241\251; @\002c\020:\356\240\352\t\006\304\260\005\302\312\r\350\336\336\310]0l\r\307\366\350\354\212\212"
+	.string	"\312@\023\022\"\333\201GZF\331\264%Y@\016\221\361\017\031\316UR\235\225k\244\3042\";"
+	.string	"\f\353\007!\006\021;<\313\030\016H\034P\223e\b|\361\223b\261\303"
+	.ascii	"Q\2036\215\024 \216\003\333\001\222\035\270C\351$\323e\266\301"
+	.ascii	":\321\"\212\2759\026=X?^#\354\004spmL\324\021\021\026n\317\226"
+	.ascii	"\332|s[\253\364"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.187.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\r\003\275\026"
+	.string	"Vi\221J\260\226Q:\024\fC\360r\253\343\310\245\234\004J\bl\264\376r\370\237Q\030\371z`\013\226\330\375\360\314=\304\007\277\374\013\026\370\312\203hu\031\037xg\224\3574\335\272\320E\036<\270\241\342\005P,\027pXB\366&R&\031~"
+	.string	"s"
+	.string	"\201"
+	.string	"6&\265\016\r\243\324 S\007\213\335\375\336\367\337\316\227v\304=\005]|\356\356\354\226\237\337\345\331-w\001\003\236\235\t"
+	.string	"\352Yb\340\266\242\326\324\244V`\253U|vr\244Sl\236\355{N\216B!\250%'E\270\334\307\032\323\002\265\326)\244D\256\274\001\261\370S\336\202\270\305"
+	.string	"S(\216\254n41\201.H\364\336Y\350\026\304<\312\324Z\227m7\334W\365\335\315\355.\314nC\bF~\370\211\023\214e\264\257\323\210\271\024\251\265\306\314x\323\r\007\034\034\372\311\315:Rp\0310\262\326\352`\017|\214\330\036\351se9|\333\347>\207~\276\337\273\313\256iI\347\323\341\303\303] \215\233\267\373\036\016\207\303\355\335.\345e\241\274\253\345]\021yK\221W\245yU\223\227\234\274c\363R\221w6\257\330\274\335\274\334\274o\341\242&C$\210\036\277\250$N\204\364\205\226\335Fv\370\027\252\322e\277\226\243\371\250\271\340R\351\373\020\346"
+	.ascii	"\f\t\221\314\346\255\252io`\022\222\255\342\017\240c\223\375"
+	.ascii	"\240\027\264\035\347\201!\003\r\r\375\034\273\301\321l\332\257"
+	.ascii	"M9\216\347\250\331#\255\006\027\337\346\242\237\263\217{\n*\345"
+	.ascii	"\036\230\2002Bl\336\212\335\335EQ\260"
+	.string	"\367(r#\366(#(\261\337C\bs\0335\272#\b\377$\233.H7o\271\3376L\001\373b\211\220\331\300^\256\0166-\0178\256X\353\245\003\242\305\"\260\262\0177:\255\0202\231N\253\004\372\\\254\275[\246\237:\317O=v\3539I\211\373\031}\357\244\224\233\222\223\324\370\317\350J\013\355\356J\257\214O\323V\254\265V\262y?\321\"\205\222\261w\022(\313\201\337.\251g\311\220\226z\004t\325,M\211\374\267\023\016\204\002Y\353O\314\376\307\203\025,\314\314\320\317U\377w\366\3018\242\363\005? \200\002\021\2723\007 \352u\034z\352&\240\221\340^\376j\216\0212\203\336\2743\034\036\r\317\200{\365\f\237\225\221-\022\215\357\223x\206\247\321\n\301\336\260\374\3405\272/%\304\200\035\223G\233a&JI\244\366\001\b^T\340\027\364\207\006\234(\033\373\223\357\347\b\013BB\343\033\301\236\350B"
+	.ascii	"H~\2667\027\021\343\310d\254\205RZ\013\2451G\034\262^\003\214"
+	.ascii	".\001\270\034\3755\323B'\2365\233\020\326\205\302\3617\035\307"
+	.ascii	"\252\004\263\007"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.188.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\001\002\275\017"
+	.string	"\246Z_D\020\221\223\016"
+	.string	"z\204X\227x\361Ad\177G\340\310\214T\253#\030G\341\261\025\004\317&\341\340\317\013\255\031_{\306|(:Z9\013\264\261\215\210P@ \n\273\322\240\320\016\275\341x#j\373{o)S\nK"
+	.string	"B"
+	.string	"P"
+	.ascii	"/\273\032r\340X\031\b\023\302\3661\233l\032\001.\354\t\001\327"
+	.ascii	"\251Zl\354n\246\037n:|\232&\277\003\244\263\342N\207\234\223"
+	.ascii	"\277\213;\271\002\340J\036\201\335\375\210g\006.\225\331\001"
+	.ascii	"\262\273\316\025\267\341\216\267\255\300\266\001;K\001\307\320"
+	.ascii	"!u\022/!\342\203\360\bI~u\350\223\304\303\353\325\315\250\260"
+	.ascii	"P\231\303^9\245\266\354\277\335]+\212\255i\217\246\261\247\257"
+	.ascii	"\227\356<\315\321t\3244\314\364\313\264>\235O\337\243\200\b\023"
+	.ascii	"\0167\t\252\255K9\nb\201Q\2227\334\321K\257\272A\275\234\305"
+	.ascii	"\203\217\246\305\303\216\n\220\301\342\350]T7Q]\336\022\212P"
+	.ascii	"c\212\253\bA\020\211\342!\324\003]\f\233\247(FQ\365\261\374\304"
+	.ascii	"(d\333\342\241j\202\231\030V\252\211\257j\374\"\361\232\032\326"
+	.ascii	">J\033h\244}\"\2002\t\242OH\246\221F\262\217\001\336&\204H\031"
+	.ascii	"\205m#e\330\312\376\255\242xP\221Ai\nz\244\275\200A~e\325\323"
+	.ascii	">m\265xL\003\013\335\214\224\032\217\276XqL=.\034`Z\352hlX\241"
+	.ascii	"\bS\241\243I\251\311\335=\0056 \320\002\0311\233\007\240\250"
+	.ascii	"'9t\252\f\370\330Q\342\273\227\313\332\217X%\020\032n\254&\n"
+	.ascii	"E\315\3220\313\2512K\300\243OR\210\323e\343\261\221\007\r\230"
+	.ascii	"\374\374\335\220\342F\317\352\254\205\263q\347by4\314bK\336\220"
+	.ascii	"\367f,v\224\250\251\221\305*\327\226\032\0200\334DG\335b+SfG"
+	.ascii	"a\224\205-\221,#.\006\013d\322\200\255\223\007\237\336ZQ\006"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.189.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\035\0075&"
+	.string	"\266\177\345Fp\236Q:s\276\353t\314J:\006X\n\241\204\352\226\317\213\2458W\260\237\355\311\r\316\246P\263\241\266\327\026b\322\035\253\324\346\f\244\200x\033]diA\023\345YL1.\272\245\300G\017\366K>!d\313$\003\315"
+	.string	"\310"
+	.string	"\324"
+	.ascii	"<\203Y\367\323\3241\363\233\371X~\264G\326`\334\275J\330\230"
+	.ascii	"\335\233d\300\r\322\237\275\037\241?\315\033\241?\3312\333\t"
+	.ascii	"\020u\203\017\212n\244\304\330\356\275\276\252u\373\"\036\321"
+	.ascii	"\320N(H\227\303\2457\3644k[\376\315\002n\252\030|\021\257\213"
+	.ascii	"\310<zsE"
+	.string	"\347h\304-S\201U\033\037Cf\217\215R\352h\304#\246\022\326\221\266{\021\271zw\263 d\345E4\322AEZ\327\025F\244sC\216\363\"\n\351\024\2158\304\354\335{/\366%/bU\337\226\224\360\350:\212F\354\262\321\347\217\233\273b\224\2568\354j\036Q9\231\332\025\245L\005w\306\354y\330\033GQ\330}\263p\357\345\236*\3628\033\235\371\037\230y\0023*\fkJa\r\362\332\220`\021\223\004\312+\202u\345\315\230\237\221(\301\304\204\376\344\325\217\275\221a_\215&\212\nJ\345\037\212T\253\260\254d\311\003'm\330}\230\017\346a~|&\334t\242?u\002\375\211T\377\345\007\342p\231cu\254\202\352%sR\3305\213\371u\271\\.\271b1\353\232\007\350\232\227r\315=\\3\322\221\277Q\256\231\207k\336\245\315\270\2649M\233oi3zk>o\315&\332\\\321\346F\233O\240"
+	.ascii	"\236\034>\276\303\313\275T\313?Wy\236=\341\227\375\313\213'\331"
+	.ascii	"\301\230\236"
+	.string	"\257\027^>\006\343I\336\300'\r\f.\027\223\361$K \353\302&\203\371Y\256e\306\223|,de\276\356\275\272\237\034]f$\243\f\252Y|\273\004\035\300\006K-\230\007N\032\321=\002t\251\016\250\250\034\251*a/\371Z\3306\271\232\255\222\336;\204\300\237\3634\373\204\317\344'\333(V\212\225\202\376\\\252\327\362>\206\321\261:\"u5k\315\333@\377\336VA\231-\230\275\322\237\352\332F3\3450g\217F+_a\377\2163)H\332\356\bk\020G\346=\2657\275J\201\253\314\361k+\255Yb\276\253Me\213\033\033vbW/\366\004C.S\254\216\027\214@0x0\376P\n\277\325\347\216\331-\203\207\245\021\364\t}\005nQKs5O\0328p@\177\276J\030[\202%5s\007\017}\305\206\324F\225\371C\210\262+>\312a\rF9\0014\263\210\021\375)\276\332UO!\232V\240"
+	.ascii	"\341\202E\023\020\370\342'\304\277\0061\234L\244\3701\2510\341"
+	.ascii	"c\201\202i\205\357\007|\3625Pb\247\026M@\237\013''\240O\227\204"
+	.ascii	"\272y+\026\347\264\212J\250*\024*0.\315{\357-ZK2\253\202\204"
+	.ascii	"\207\253)\203\226j\033\035\205\213jaCu0E\003f\352\021\323\204"
+	.ascii	"\350V\321z*\274\340K\253\243B\004f+\365@\366\006\004@\267Z\201"
+	.ascii	"\353\f\307\375X\035\006\266\330R\275\217-*m\375lC\353}\220\235"
+	.ascii	"iC\356\256\244A\031\252Y|V\263\036\331\343|\364|\217\375\021"
+	.ascii	"\304\n\021\202\376<\353\2034\"\317c\215\244\367^\b\374\265\343"
+	.ascii	"\261G\222\330\253\253J\203\354\f\030\022\252\227\002\214I\255"
+	.ascii	"\235\315:\223\244Uf4\243\024b#RG\250\326+\331\242\006\200\253"
+	.ascii	"\326\200\235\250\201(G\225RlDD\n\222\202\024\322\001\300\002"
+	.ascii	"\021\2519n\020H\246\210&I\032\003 \205f\225K\263\226\302"
+	.string	"\313'\nN\205\215\330\315\005\276\267@\343(O5\331\210\304$V6\"1\251\020\207#\207K\210\231\311\0057\200\232\222\251\356u\033\324\313\003_vE\336\017R\211?\234p\021x\267\032X`\345$\200r\026]\240\021C\304\372\255\212;}\n\017\225\352\266\333\026kF\355z9\n~?\247\275\026z\217\266\022Xgu#\007\300\350(\244F\300\204 u\332 \260\376\023#\275\006\"`\237\332\223\233;{b\264\351\253\247<s\250ZIL\224\\\234U\200\346+\211\306\321\212\357 J\331=\341\233\326\022\365<C\344,$\233=\302i\230\267\263\204\264\204\242\377\341\310}\232\007\266\225)g\025\320P\237\326\270\330J\246\313\243\376hZ\212\021\004l\026z\300\177\243)4\033b\331a#NJ,\360\233\362+@0\265\032\331}\377\026\027\233\366\224\205\231cf\231\357\262>Ho\211I\002j\216\001FK\2777W"
+	.ascii	"\275D\252\235\252\001"
+	.text
+	.section	.gnu.lto_blackboxUpdate.190.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\013,\025\242"
+	.string	"J\363$6L N\333\031\003\177\211)\251\025\340\n&\3004\016\257\242n\253I\264GL\351\036\337\032LXmd\205\233A\214HU\234e8\244\376\006&"
+	.ascii	"\300N\001PR\377\201A9\346^\177-\251D>\231\232M9\212\"n(y\271"
+	.ascii	"eJ)\005P\003\017\003X\003=\316<=\316\307\035g#\217\363\316\321"
+	.ascii	"\271xt\3269:\263Fg\242\321y5:\377\216\263\027\235\273\275\360"
+	.ascii	"xS\216iC\222\345\317H_#\3259o\037\221K\264\303t\177\351\336\322"
+	.ascii	":\2762\367\236\036/\315\255!\313\253b\303\304\033\354\322xB\032"
+	.ascii	"\f/\315\275\335yi;\267"
+	.string	"\277\004I\212\222\276UFD\340\266\234\025\276/U\216b\023YZl!V\bs\335\026\266\353\267\352m\"\177I\266\006\337\367M\321Df*f\351\201\341K\241\363l\256\235\032\222\275\357\033\327\323\022Z\312m\024\245\307U\002\363\033\003lX\357\373\262u\333\t-\345\343\ff\372N`\356+\215%\205\2262\321\313\032*\316\263\367}\217MdN\201\371\330\304\235#3\2673\367Y\243\271\235\366\304;\357\373L\333\362\276\322\025\314\242\330\304\244&b\233\270\266\020\333Dv\231\005[\312\365n@B7\325V\370\276\257\322;\221\366*m\376q\2679\f\3431\030\276\343/l\307^\270\013s\341:\336\302Z8\013\323\361\034\313\361\224\343\030\216\337\330\215\333\230\215\327\030\013_a\251\216\0348\230n,\331\250Ac\206\214\0300^\270h\241\304b\205\212\024H\024'L\224 1BD\b\020I\037\220<\034u\340\260\001"
+	.string	"\243\"\242!!\rA@?>\234\327\303s4\356\024uX\342\372\356r\207\310\362\246<3=\222l\016\203W\346\f\346\016K\324\371K\024g;/EO\345\023\347.P\276\234\271\220y\261D^v_CO\245\331s\235Y\363\0263.g-f[\316Y\272\326$\2473\335\334\272\344\251\\\342,7\315r\216\013\223\202\343\267\246\233\013F\234\333\212\236\312\026\234\331~4\335xm\350\331\244H3\226e\363\225\243\247\222\310^\257J\236\312\245\263\264\310\n\256\243H\325s\0346\216CCgj\026\272\\\211\271\261\244\323d#\016\325k\ba~\261yV\311i\032\205k|F\241\240\313(\f\364\030:MA$\230\316)-0\236Ui\372\005\210g\025`\273X?\300\260Em?\252\2775)\257o\252\361"
+	.string	"\275E\0324\256\224\206\317Y\254\330s\025)\216\362\034\211\002\317O\230\320\342%H\3504]mM\275\215\240\233s\021r\036\002D\234'\301\371\007\2444\367P\204\346G\0354\344\275\341"
+	.ascii	"Fe\346\033\374\250\2544\030U\231\003P\344GE\346FE+\214!\205K"
+	.ascii	"x\342L\221i0\252(N4\264\022\311\320DM\373Q=Y\221N=+(.\244\301"
+	.ascii	"\313\203\326\307\362v\307\204F\326\325`TN\007Z[+\"\355G\325\265"
+	.ascii	"\352H\246\201\323u\\\376\243\323\024C\325V\3734\324Vs^\321Si"
+	.ascii	"\305{\232\316st\022H\252SZ\214\355G\245\005F\225\345; \300\250"
+	.ascii	"\230^\\\255\236M\232\255\263\"\007\353\336\034=\225\315\225\310"
+	.ascii	"H\224\345\224\263J\232h<\242\244W\237#C\326\244\367}[\255\275"
+	.ascii	"\310\221(\177-&\026\013s\324\210\321\013\003&\313T\355,\372\265"
+	.ascii	"\244\237TX\306#J\366\231sf\206\236\312\346\220\3534\275\357\313"
+	.ascii	"\276<R\325|A3\353\25013\001\314#\346\004V\374\314U\016q\247\246"
+	.ascii	"\330&\362|\203M\275P\261n\370\361\231\335\"n\013I\306?\276\007"
+	.ascii	"N\035\016\275\361\273\256+\350\362z\233:\204\362\352ZC\032\230"
+	.ascii	"\304\347\241\334\275.\371\222\264\240]#\354\316\037\rgi\263\035"
+	.ascii	"\313\354\"q\223x/w\336\247^h=\017\345\342\263\357\264&\206L\273"
+	.ascii	"LV\347\213Ot#\345Tz\365\312\251\270L\022\314\256\226\207\271"
+	.ascii	"\315\021h\336\367\235\321D\366)\016\346nq?i\"\273/\270M\232\260"
+	.ascii	"M\324y\022\177i+\234\270]\336K\366\033\320\313\212\3735\365j"
+	.ascii	"\3765\322K\213\247\001\275\222\034;p\352\304\220\rc\316\031\211"
+	.ascii	"\337Ov/\377\352\300\205\342F\335(\333D\342\373\210;\244\356<"
+	.ascii	"\324c\350\325\2043\273an\025\357\345\372\r\350\004N\233i\244"
+	.ascii	"\0237}I7,\216p\267jf\267\314\265\262\327\027U,{\242\324\351\200"
+	.ascii	"\375w\002\341F\355\252\261\314\001\f\340\275\374w'a\372\242>"
+	.ascii	"\311\026\300\205x\200;1\353\340\314\013\354\360^r\003:)\353S"
+	.ascii	"~\222\307L\030\326\352\201m-\337j]l\263\006\030\345q\270\333"
+	.ascii	"\003\353\337Z\236}\nK\351Mw\366p\340\307\017\266\211\376$\304"
+	.ascii	"\005R{Lk\260\302\244p0\351\206\033\346\314H\371\207z\026\273"
+	.ascii	"\226\020\327\025;\226\006\246\025{\222 -\026\216\260W\001\t"
+	.string	"\272\300n\344G\255\b;\013>\314\255\025\330\211\364\034\016a\227\342)\224\342P\354\312c\030)U\366\327x\006wF6\207\333p\307\254\360\214\214\312\035\247xe\344\r7\034\235\350\340\031\031!\367\f\254\340 7\033\"\230@n\301\325\f\220;\315'i\341\f7\032o&I$q\244\274L\310p\227a\301b7\004Cv\232[\316\310\374\230Yp\r$s.y\337d;}\371\242X_(~\310\334|\335\007\001\367\023\226\200\002\357%\005l\023\373\037\310B\306\211\206\005\345Uf\251\262\327\367\241\314\275\276\017\003\363\216sk1:\367\234\3344\016\356M\203s\273\265\261\255\241\365\226\346\226\322\343\334\\G\347~\036\235;\253\323\272\203\364\226\346\037Eg\037Eg\007\212\316\r\030\235{\3548\3630:\3578:3Pt^\300\350\254\200\3219\001\2433\002F\347\003\216\316\006\034\235\0138:\023`t\036\240\307Y"
+	.string	"\243s"
+	.ascii	"G\347&\243\263\016\243s\016\2433\016\2433\223\321\371\206\321"
+	.ascii	"y\351\350l\303\350\\\243\350L\303\350<\303\350,\303\350\034\303"
+	.ascii	"\350\f\243\307\371E\217\263\213\035\347\026Fg%\2433\013\243\363"
+	.ascii	"\n\243\263\n\243s\n\2433\362\350\214\242\307\371\304\321\331"
+	.ascii	"\304\321\271\304\321\231D\220\363\210\037g\021=\316!\216\316"
+	.ascii	" \216\316IG\347\017=\316HGg\017G\347\243\243s\207\035g\016@\316"
+	.ascii	"\033|\234\001\370q6::\027\3718\023\0019\017\3718\013\3758k8:"
+	.ascii	"\007\3718\003\035\235\177\216\316>=\316=\001z;V{\203\3163\023"
+	.ascii	"0^|K?L\013\005\257\335\320\334\265P\354\376K\333\365\325B\201"
+	.ascii	"\302\005\306\257\037m\027\377\242\305\273h~]\217\350\017\177"
+	.ascii	"&\271\27526r\032\031\205\257\204\017\271\353\213\25267\337\323"
+	.ascii	"A0\002\005^%gG6\003\224WI\314\211\2026B\351\247\035Lq\243JO\264"
+	.ascii	"\322\233\301\211\206%\202\3053i\342[;\346\306\326\216a\371\265"
+	.ascii	"6\254J;6\326\205\305#A\315\350E\231R\330\310([!\250Q\256@\264"
+	.ascii	"\211\200\002\365k\233\236Ya\373\236&\255(#\033k\255\260K\304"
+	.ascii	"\250`\300$\307V\366a`\255\225\306\222k\233\302\352Di\257@\371"
+	.ascii	"j\257t\275W\213\246\326^\271\362\266\342\221\240~go\326W\325"
+	.ascii	"M#\277\f?\274\371\202\223D\252\352^;\203\246\375\221^\233k\362"
+	.ascii	"|~\317yP\361L\232\033\003\326\235\355\3337up\275V\373\366\314"
+	.ascii	"\317j\327\332\332\2677\266\211)\232\341T<\0224\355\214\257M#"
+	.ascii	"\277\366\216"
+	.ascii	"\250_^\330\351\013T\035\232Pm\315\222\220\303C\271\263\236\017"
+	.ascii	":v\205p\314\037\320\333'\330\254g\313Lau\026n\343\236\252\245"
+	.ascii	"{#h\337Y\332\321\324\3248\321\210^\244S\033RT\340\375vK\247\245"
+	.ascii	"\255\363^\246x\237~\001\200\214\300[\372E\226-a\317\255x\"\355"
+	.ascii	"\035\273d\205\227\302\200i\032X\310\255\335\017i\tM\240a\025"
+	.ascii	"\037\325\3365\326T\220\354}\243j\304ye\213\226\376\333\356\375"
+	.ascii	"p\035zU\n\2509P\352s\332\275\342\373J\305q9-\336\232\327\356"
+	.ascii	"\261{[\342Z\276V\006\357%\362\221\240bs\336\254O~\205\255i\344"
+	.ascii	"\327\024#\207\372\272Zc8\243\026\241x\023'\036\005\341\211o*"
+	.ascii	"\3232eX&\236\215\3134\032,\361$\336\204S\311\365%~u3u\b%\030"
+	.ascii	"H\342\215\272\322xx\210\037\361\314m\231\366\f\327w\223\311\220"
+	.ascii	"O\262\210g\007l\003\233\215\353}\241\320\370_\373\227\246\r\f"
+	.ascii	"d\2338\342W7RT\224\"\276\203!\210\017\361BqO\336\246\016\223"
+	.ascii	"\376\303\203x\342\236\224\0243.\263X&\351it\245!\375\2071\256"
+	.ascii	"r\215;\205\364-6%C\305\"\332\342\323\"\362\360\035\236\347\271"
+	.ascii	"&\306\253\364\321{\370\24322\270\314\326\353s\233}\307w\364\255"
+	.ascii	"\327\341\331+&\312Ov\030\027\274\206\036"
+	.string	"\312\337-!\313\201\271e\343y-a\361}\243f\260\343y\230\326M\013\247\245R\331&rx\024\246|\3244(\257\252i\244\227\320 \240\027^\203U9\324\240\2457|\203\255\375\361\330`\364D\017\300\257{Eo\344\245K\321\263\250#\"*\231\332Q\241\202\272\225\303\016\275\373e\231\240\225S|\337\267\237p\003a\2338\364]$K\303\003\275\320\353\320IQ\tz\r\337S\207PsrA\337m\177iPp\036\007\2445l\253m\225m\"\3203\375\375\2152h\222@\017e\032f>-\345u\274,H\321?\276\310X\377x\367k\246\275\265\253\237\237ws\231\255\206\253\255}\376\347\221\312$\035\213\313,^\361\371V\323\225\246\242\177|Ky\020\376\272\252=\257\326\3136n\273J\226\347{\276\245\234\001\033| $\310\006N,\007\035\004\202\r>\340\340\001\022@\330\300\311I\b\220\036\006\302\302\204\0204\350"
+	.string	"H\006\036h\240\004\002\007\031|\240\004\304)\210\022\213\017\034\202\b\0338)\221\020B\bNJG)T?\fK\263f\037\324+yek\253`:F\rz\362\341Q\340\343\373y\347\343U\2403\244b\255p\255\306\204:8\201\235\325\227acy\252\353\270(\341\016\024\255)A\317\275\006k\200\\\346\276\261\264\210*\276>'\332\221\025Z\225\b\034"
+	.string	"\334\342\300\033\b\272\354\030\353\322\247,\326E\325<\320\r\3205\360mE7\003\322\316\253\356G\217\357\247]\217\367\351\230\332\352\326>f\326\307v^v/\370x(\257q\274N=h\255o\354L\366\244\254m<\330\300\300`\022\345\207\314\374t\267\256\265\204+\026\036\277c%8\350DKs\340\241R*tj\220N=#\r\354\370~\246\355x\037tg\250cZ\354\005\215\254\331\203\201\1776\301&k\372\004\273\3003`\266\300/\321\225)\353j\265\332\307C\201\327"
+	.string	"O\201\357\251\230\341S^{\211\301\351S\312\320\334\364\325jU\272\303\216\201\004\336\311\241\t|\267\021\353\322\027\305l\244X\335\002\353\2246\313\022+S"
+	.string	"\201w\332C\340\033P\254\212\222F\212\205%\360P*\027\352'\031X\346\2471Oe\234WK\372\242\316\210i\365)\2214R\214\211"
+	.ascii	"\0311\252\277*\373\225\204:\340\200\3671Ks\300\353\204\271\001"
+	.ascii	"\006<\001\377\202kb\340\nx\003\376\250m\355r\231\375e\345r\233"
+	.ascii	"m\267:)\340\373\013\001\337\325\002\006h\".\3003?\255yb\343\275"
+	.ascii	"\034\340\223\002x\001\276\233<\021\006\360KsU\252F\206\355\021"
+	.ascii	"\020v7@\2300.y\035\004\030\246&\200^\347\231)\3748\315\275\027"
+	.ascii	"@a\267\334\303i\2715k\372\275\227'X\326\224\267*i\372\316\013"
+	.ascii	"\244r\323\232\3568\261\325*\356\273M\207\216wr\243\343\273M\330"
+	.ascii	"\224'8aZ9\236\250;\302\256\372\2248r\374\263\231\371\312\361"
+	.ascii	"F\344\254{\3136\236\"\307\257\200aH\372\242Zh$X\225\t\214z\343"
+	.ascii	"\241\3143,\271\300w\344k\202\261\201\343;\312\223!\216w?\260"
+	.ascii	"<\2434+\321\032+\200\335\271\013_I\032L\337\223&\365Te\372\336"
+	.ascii	"\353\362\0317\376\301>M\337\370f\303$\352\223-c\351\235Ve\007"
+	.ascii	"I7\272\364KsveX\276l$\230Z\214\016\312\035S0+0\202\254\357\373"
+	.ascii	"\3241\210\305\253\374\344A\246Z\"\016F\245\310]\007\001\202M"
+	.ascii	"1\024\302MI7|\201\2027\230\276k[h\243(2g\275\364\351\326\b\313"
+	.ascii	"\215\327\036i\221\020?\371Tb`.\340^\20351?\325j\225\260O\260"
+	.ascii	"p\377\246\337\276\361Z\004\2227A\222P\315\271Q\227\330\270\352"
+	.ascii	";\227I\264l\363l\276\215\313d\266ZZl\023m|\3375\261j\316\255"
+	.ascii	"E\333d\333M/\206g\222p\314\337\007\276`\333\334j_x\301\355\373"
+	.ascii	"\255M\220aC\343D\303R\252!T\343\033\020\354H_\324T#\243\206,"
+	.ascii	"h<\032\032\277$gH\305Z1\243\311\f7\036\325\310(\033\025\321<"
+	.ascii	"/B\346\rY\n\031P\031h\3211O62Z\005\t\025\335B\021\243u\022\343"
+	.ascii	"\0330\332\214&9ld\024\311\t9\001\203\252\250\"!-\016\263\022"
+	.ascii	"\321\210\210\210$I\222\345\202\013\020\204\002Q\226\326\322<"
+	.ascii	"\022\200C%\buT9\210F\223&\035 \232\304-\311<\370\033\262\240"
+	.ascii	":w\205\306\372\301\321\245\330@\352\265\235\362\\\373"
+	.string	"g\017\235\001\335\220\263xZ\227vt\320\361&R\036\226a\354\352s\225\243\363\303!\300#M\026\3340\366\232\205\270\243fJk\0254\021X\321$*\315T\360\234<ro\237\024\275\302\234\363\3653\t\001\243K\201\330\317a\354T\320\216\304\3474\247\333\245\034\325\324\321=\035\275\357\373\267\307$9\006\361\032A\260O\200\265|\230\n\"Q\270\315|\315<?q\362\335\313\037\364\006c_5\274B\312\325\344U\371\252\033\032\222\317\017\200\f\2346\366\277\204\035\274\312\212M\237I\n\340\22454\322\240\023\212+\275:\263\027\253\302\257\241l2rSQ\036\003\223bu\0242#5<\371\263\237\262\262\236\241g&afv\306\300t\257\357\375\007d\203\r=\266.$og\2163\n\274Z2\2338x:]eZ\352\203\257O\341\264\324\232\241\304\225\3771\031o\302\267\223\027\016\355JR\016\2024\271\327\360\323\230I"
+	.string	"p&\340\003\246\001\013"
+	.ascii	"\b\241\331\341\345\206\276\362\253\004U@(\370\236#x\r\024X2\252"
+	.ascii	"\342\252\334\231\240\035l\363M\203\261\255t\255p\350;D\335;%"
+	.ascii	"A\"\326\201\202\227O\237$0\317\242\300\206r\376I\252\335d3Zr"
+	.ascii	"H\006:\2240\017\340*\024\017\276x\027]L\034\031V\317\300\215"
+	.ascii	"\242P\213\t\377C\352tyd\316\360#@\177B\363\204\213.\305\324\250"
+	.ascii	"f=T\2039\344T\320\322\205 \017_\214i7\031\031\206S\216\247\t"
+	.ascii	"\311W\264\363+B\236\2354\234\322L\341,\262\272O\316\332\242B"
+	.ascii	"\002<\313\243p<\020\230\344$yf{2\210f\271\rge\244\245\235\022"
+	.ascii	"\237\301\344g^\004\032\322\204\301\034\265"
+	.string	"QLw\204\325\362%Y{\274\327]$p;751\201\273\213\225\207\375\270\245)\223\235P$'c\324\007\030\377\005"
+	.string	"\254h\232\2738\211\325BJ\217\262\322oR^\205\231\211~\013v\207QK\030\037\353\253\307e\220c\211\364\363\223\352\204p\254\254\317\027\b\001\345P\200(\337\030L|}\255\263+\240\341)\231I\nN&K\360B\274\215\324\345{5F\231 M\210\265d\2618\241${\002\352#\036I\232\245\312M \356qq\277f\227\334!h\317\005\362\020\267q\022\036a\300\242\021\354 \265\354\310\313\255\337\352\205L\341\217:\342i\003}\236\356-1\270\335l\211\202\246\020f\3216\241\3505I\311?5\342s\320U\202t\004y\326!\001,\264\250\252\033\024\b\204\022=\026\232w=\213'5\357\027P\025\200\326\206\211D^%\021\207K3\221\304\305I"
+	.string	"KJ\210(\314\347\2236[\341\213\370q\214\365\2235\353\221\024\367\265\333\306:#\203\263\250\372\027\261\371\013\313\305\221\232dE]%\270\322\f\022\233t\034u\377Ql\271\343\236XV\334\374\341\246"
+	.ascii	"\001\t\204\344\024D\032\n\250.Vd\310\021\370\340\023?}\250d\353"
+	.ascii	"Q\252\363Fu\001{_\212s\006l\034\375N\374\227E\013\251\233}\340"
+	.ascii	"wk\362MMK\026EX\256\020\253O_\034W#\323\317@\220\037\250!3\024"
+	.ascii	"l\334s\245\024\305\241>\323\323v\030 l3K\320Z\234\275jjS\220"
+	.ascii	"\243y\262\241\324Q\310\307Q\200\322\275\243\214Ug\322WqQ\004"
+	.ascii	"\334M\237\235\3571\351\352|\360\232.\214\022\210\243\326i\324"
+	.ascii	"\244n\2755\273Q\271;\026\201\275\232\232[o\202\307\006\332\227"
+	.ascii	"P\022S\013{\321\230\217\234\220\211_feL\212 \341\376U)\335\021"
+	.ascii	"H\227-x_\277i\353\333W?\030\353I*e\273\326\267#_MC\002\221\025"
+	.ascii	"\332\275H\2060\251x\206\351\252\260\344\301?\034\354z\023\017"
+	.ascii	"Y\366|16\206T(\267\364\0164XM\347\002\352mJ\024^b+\352\350\204"
+	.ascii	"A\024\311\252\214q\251ZBRZB\253\276S[k\243\247Y3\305\230\235"
+	.ascii	"\203\\\255\005@"
+	.string	"\017\344MzoB\376\346\036\007\340\024\322\211\024\220\211\006\007Ff\034@\031\351\f\255\261x\257\255z?[\261\013\033-0\270\"\t\225L\210\214\3756\265\253\362t!\267\232\340\331\324q\356\246\370\005\335\230Xi\242^cg\223YC\244\361\241v\326\353\331\341d\222n\\\0305\266Gp\327\217\330\305\343\021\322\320Sx\352\344\261\212\035s\377xF\204)\036<B\320\267C\241\345\026\346@\b\3307\260e\217\301l\366\016\247\032\324\236\301~A\"\353\251O\363\240>\325\030\212=@e\207a\272\356\334)\3132*\242\304\340d\263\345\303\320\256G\027B\312\340\336\033\263\231\350\210\337h0\222\016:\360\353\314\213H\322\017\033D\244\037\354\275\300\310\002\244\264\237\340\204L\033%rPZ\226\227\275\f8/\276\323\245e\305^VJ\025\315\270~\270\204\243D\025\035\332P\361V\020\3525Y\031\302\304\t\223G8:\260"
+	.string	"\251c\034\225\273\321g\025\032\br\016\251\334\346\324\241\2053^\357\240;\"\341\346\211\323\034\0169\377\364\365\252\303\310\326-\311\2168\252\007\240\311\225\267vO[\232B*\034\321\227\203a\003\344 v\207\003\202\352t\007\001\264r\347WTY\2618X\034\031\335\260\363\017T\225;3I\376F\351\0021\275\350CZ\276\214\370\316\"(7\342Nh\324\342\271Bu\035\361\361\257\224b\313\365\027\\\255+\026\343\024\324\f\222\3003\352\261\226q>g"
+	.string	"\223\224U\346\203\322\237\365\251\253E\003\306\362)k\326\177\202\371V{\257\035\343\273`f\270}\241V\224\321\025pa-\020P\204\253,\234i\330\006\364\301\023\004\263\366\245\324Q\035l\213a:\247aY\262e=\272N"
+	.string	"z0[7Z\277,\231\023\356T\2709\204[\301`\245\301\246E&+\3455\221\261[\027\\R\261\301\363\217T\343\347\244\300\253\234\273\243\340,\347\374a\f\350|\241\005\343"
+	.string	"\300\366j`\371\005\311\366\361\226O\032"
+	.ascii	"\336+jyUL,\033o1\226E\354x;z\372@\037\340\006/\022\201\235\304"
+	.ascii	"\313\264\362~\330\225\251\343\"S\374\037=\246b&\2023>\340$\367"
+	.ascii	"\305\336\0238\323&/\361H\352a\273\204\351|\325\270o\021\237\021"
+	.ascii	"\305\003\373\243\016\001"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.191.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\335\t"
+	.string	"\346\322C<0\305*\035\236\213'\323&\363\035\366\334ob\300&\341\355\205\323\304\f\214<\025\214\264\347ok\f>v\203\021\217\333E\357b!\213\224u\252\n\215\022\213\320\"\217\217\b\331D\312\224\0022"
+	.string	"1"
+	.string	"/"
+	.string	"vL\013=X\231\214\226\nV`w\273\3153\333\243v\202\355Q;\016>A\377&o\250\220\005X\261LONaw\235+\326\305\255\267]`;\301~&\177|Z\237\316L\337b\300A"
+	.string	"\3432\225]\213\231\201\035\020\001\204\330\006m\214\035\n@x\376\345\230/\273\032)+\273{`\216\345\321\266O\362\0220\232\252\372\224\b*g\276\246^u\340'G!\371 \236(\345W\245\355\361\252\371h\235rf\207\246\324\r\373\332\356\256\325e?\315=\374\267\277\002!O\004Z\270\204H\f\240Q\347\343\374\341Px\236\207O\007\302\323\211\034:\241\356\363It\034\215\275\b\320\327\215<\357\3530\341^[uq\2729)\312\233\252r\032a\251\221\030\020"
+	.string	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.v\rlB8`\016d\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.192.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"\262\f/4@o\222\016\233\365z\364fc:w\252F\334Y(_\344\343\226\332\261\211\375\266\351\330\021\005\025\312\257\337\3000<\236C\363\300F\340\355p\214?\233f7\221)S\233\214\252\003Aq\":o\342\201#\361(\253\342m\b\256(\034\254gQU\326\323hY$!\026\200P\343\"bC1=)\312\305-\215\341q\315:]\017@\247\242"
+	.string	"\b\310m\257a\016E\276\231\314\314\221\364\273\321\271\233A )}\224\305%\263c\203\311\225I\245\344\377\274f\205\205\317\327\300\006\326b0\032\205R^2\265\207#\275\352\256[\2236p\260l\231\b\253\013`\310\314]&\362\350\330\377\340O\370C\002\t"
+	.ascii	"`\251'\0230\2013\3348T\204\272\257\256)K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_blackboxGetPRatio.193.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\245\b"
+	.string	"\006\32096Po\322\001\203\276f\255\306\021\0054\332\201\246\323\021\372\336\306\330\275\307\0064B\322li\026?\273qDA\377,\221rcj$\374\265E\367\206a\t\331[\312\224\002)"
+	.string	"+"
+	.string	"'"
+	.string	".sr1\340\003\324\241^\200:\\\215cW\314\277\310\027NZX\266Rv\255\024\346\234\326\255tq\357m\033\330N\260\375\022\352j\325p\325\357\251w\325\252\352g\240\251\343+)sZt0S\005\242x\330\026\331\032\037\344!\"c\007\024Z\206`\332 \231\004\336}$/\361|\244\374\352\236\024\363\221s\021>\207A!\375v\350\207\250\303/"
+	.string	"\206\246\235\315e\272\031\366\337\334\223\355\2666\023\262\343\2618\016\235\370\320\300\371D\353\002\305\r\201%\004\303\025%\244\274\242\206\233\177sO\325\026h;2\334\352\255.\334W|\214\264\013\020"
+	.string	"`\251'\023\372\377\201\221\026\220\"\220\005\226"
+	.ascii	"\213M\223S\306\332\246\322D\250\366\\\310A`\006\263`d\270VL\302"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_blackboxCalculateSampleRate.194.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\205\002m\024"
+	.string	"v\350\207G\340\360&\035\255\231x\013\n\244\331!"
+	.string	"\345\036\031E\364\357\361\314\203\212\334\2513\201\217^\210\360\t\327Lz\364r \221\017\334rq\3422X\203\f\363#\004\r\321,\003\004>s\307o\322\033\246f\326\022\2627IR\246v"
+	.string	"e"
+	.string	"t"
+	.string	"MsN\330\345\230/\342\n \3335\266\312\366\327\326\020*\242F\205 8\316\231\001I\305\2348\024\247\200\032[\372\222\032W]R\243m\033@P\343\031\f\207fc"
+	.ascii	"\017\220m\b\307\234\270\3307\350Le\364\2763\353\247\002\302\220"
+	.ascii	"0\003\305M\207\246\262\202F\234p\275\035=K\247\346\235\3149u"
+	.ascii	"\204n\216\316\315\356\2472\347\364\336t(\250?\265-\263}\300^"
+	.ascii	"\026\001Z\002\306\332\3012\231\325\233F\253\314Q\026H\256\217"
+	.ascii	"J6\235\315\356l\034m\377c\2537\347\234\276\217\355u\211\n\251"
+	.ascii	"\222|\r\363zD\256E\344\372%\327!r\355\222k\220\270\376\210\353"
+	.ascii	"V\\{\3105+\256;\342z\025\327\252\270N\3055*\256\301\270\376\342"
+	.ascii	"Z\306u\364\326\236\267\276\267^o\255\001\"\017\b\215\021M\266"
+	.ascii	"\035V\352\252G\242\\\330\243\316I\324S\217DC\241\016v\360\250"
+	.ascii	"\237\306S\250\253\355\016&\377#\022\357\343\275u&\345\207\240"
+	.ascii	"\005u&G\236sB\301\353\r\031+\357?)\343h\272sN\332wj\027\022\274"
+	.ascii	"\246\250a\002\351f\235\374\035\374\213\221\374w\224\247xy\223"
+	.ascii	"\246\033\223\367x\223\234M\367\253\323T\030\351\035\300Q\030"
+	.ascii	"T\333\235\367\372_C\0175%\0212\027\232\025\0051\322-)\017d,/"
+	.ascii	"-+\fXb\r\\V`b-3\016b)\002,\213Y0\023\243\221\311fb*\334\324H"
+	.ascii	"@\277\026\034<\020V\362\023\233\327\254C*\362\222\353\353\"\207"
+	.ascii	"%\205\374\365\004F7\246\221\273\036\362_8\0029\353\256k\330\363"
+	.ascii	"q\220\326#|<\026)\025\251\307[\377\226raO\001E\335\343\337\322"
+	.ascii	"P\250\3538\353\261(g\323\255>\323\320\361cH\n\203T\365\325#Q"
+	.ascii	". p\2422Ww`\352\2411 \023\207q\0201\353\020:t\253\322\200o\""
+	.ascii	";\310\317\221\b.x\235\355\0238\247h\263\302\344\032-\217fc\267"
+	.ascii	"jw\266+\261\035R\372\003j\325\352\034\270\330\373L\262],TU2\200"
+	.ascii	"d\2665\312\206\377\301\t\b\327%\202\266\341^\2416\354\240\252"
+	.ascii	"\247\020\027\017T\231\345\213\031e5\266K\225\001"
+	.text
+	.section	.gnu.lto_blackboxInit.195.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`)\003]\025"
+	.string	"\366e\204I\320\360(\035GI<8\201W\213\021\002\314\233\365\217ix\206\372\340\361^ \025bSu\274\021\342\020\031\266\376\220^O\207pE}h\343\374\240_\202I\306\260i\246\325\nve(\263\024\006g\020\351\314Z#d\023)S\nl"
+	.string	"k"
+	.string	"q"
+	.string	"~"
+	.string	"\003:@2\267\0215g\207(\247\t\224B#l\337\347y\357\345;^\375\202'\346\234\254K\373\305f]\236e\232\215t\237\210\t"
+	.ascii	"D\017\347\2634\347lm\210\323>\2122\\\245\371\243\210*\247\203"
+	.ascii	"\3718sq\245\233\271\274m\320P\346\353\241\263\205\003\346\234"
+	.ascii	"\347]9\350j\252\243\310\234\323\232\323y\270S\267\355b\033\201"
+	.ascii	"\275\032\0029J\320\360\354@\356\003=\be\202\313\365\341&\270"
+	.ascii	"\364\003\373\b\356\276\342-Rf7EK*\242\257\342>*+,,\342\345G\321"
+	.ascii	"\3561\321\367=E\314\307\261\254E\237\273\364[\304\313\367^ )"
+	.ascii	"H\211fG)F\243l_M\327\306~8\267\306\226\352\016\251f\255z\025"
+	.ascii	"\252U\253N\211\352Q\252E\251\226\241:\\\365\252ZU\0030\2736N"
+	.ascii	"\355\356\253\207\310\246M\0367\265\0365p\260\300A\215\353\313"
+	.ascii	"\370\214\021\006$$\271$q\307\325'\271\007.\356\322\2709\205+"
+	.ascii	"\3678(\273\301c\224\244\346\264%\360\207\016\303\201\217s\351"
+	.ascii	"\007&&\342e\270\337\371\0311\365v}\241\277\200\020\341\344D\274"
+	.ascii	"\324\247\\\222\356\356\006\341\240\366M\3631Q\3677\235\232F\331"
+	.ascii	"ELB\313\367\274\203\004\003\206\205d\220\275X`.\n\257V\205\025"
+	.ascii	"W\254\005\233]h\205\b\260\314B\312\254\205A&\233\265X\276\230"
+	.ascii	"\207skV\274!`\314\326\334\261G(\264\034\227>7\357!\221\265\035"
+	.ascii	"\373\033\211\325\262\214V{\023?%\246\335h\345\365D\002\372\323"
+	.ascii	"xD\233\206B\201>\347\377\360x@\333\302\310\227\210\252}\365\034"
+	.ascii	"\331\013\016,R\355\354\207\224\323\013\327\306#\"\221\313\357"
+	.ascii	"\306\222\3169\003I\250A4\351\024B(\005\023(*m\241\305\300\002"
+	.ascii	"\0311\353\006\020pF%I:\340\222Fp\364\030\201-gH\376\267\271\277"
+	.ascii	"R\270)\345D9\2416\031\305\242\2242\345\261\026\276\225\0246\240"
+	.ascii	"\3168m\220\224\306Z\002\211\201\276\204C\246\241R\245\017\031"
+	.ascii	"\340\013\256}\277\372\262\f\237[\023H\bE\200\360@:\020\0374\367"
+	.ascii	"\024\202\250\204\004\200\356H\240~\017\323\353\262e\356_\330"
+	.ascii	"\237\221\215\025\217\025o\272?}\257\003\370S\261\243\221\352"
+	.ascii	"\275\235\205\217\221\223\0260\335\016\375\003"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.314.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\255\013"
+	.string	"\346\324J@ \213*\035H1\"\304\006A\030\310\022\230|\021~\227\301\f\353.$D$D\026\355\311c\231a+\035B\001\251\2651\320\336\031&\300\250\001,\344\020\016\332\245x\3563N\3401\215\310\336R\246\0247"
+	.string	"5"
+	.string	":"
+	.string	"[\272\360\276\024\354\302\356n\217j\340\244C\315H\362)\230\207\316+\035f\347\001\270Bx(H\261\273o=K\274Sf\304#\005\263\273v\bpk\267\235a\333\302~'*S\316RY\326x\270\272\2625\035a\032jZ3\235\231~%?\f\001\273&3\rK BP`\2775\262-\226\3077\260=\262cw\035\330\023\223\354\230\304H\250\314`\250Q\237\222\231`\177\300\361p\234\366\b\265\002\201J5a)Y\352\353\033\272\n\377G\273\246\236d\300)g\366\035\334\365\361\0238$\312w\217\276H{\274j|\0230\004\336\\@8\rg\223\351h\266\016\216\214g\333\200B\333e\302\234\307\006h\373\3408\320f\261\235\207\253+W\n0\220`\322\023T\226?\332\027\362QX`A\237\273[Re9\252\252\310+B\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.411.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`^\t\0252"
+	.ascii	"\372R@\022E`\236N\007s\301T\327C\034{\377\335\035nZ\342\026\036"
+	.ascii	"\345\347\367\022\270\026\263\254\361\022\321r\356\372\245\353"
+	.ascii	"0\305\032\006\316\030\314\361V\234\222D\301\307\231\330{\030"
+	.ascii	"W\304<(%\353=5\021\241M\366\3362\245\024\007\001\f\001\017\001"
+	.ascii	"d\2409?\215\256\366\223\375no\307\342\316\366\263\026\232\035"
+	.ascii	"\365\317\3223#\241\312<\013v-\235\3469\231}\0074\r//\347\f\344"
+	.ascii	"j\007\261\256\376\270\200\325\325\324{V\027\3631\277r\303\235"
+	.ascii	"\035d\216\211r\243;\207;[hEm\253\235\212?u\270\263C\264ia\205"
+	.ascii	"\345\234u\244\355bG\335B\241\253>\245\273\217\272\331\370S+C"
+	.ascii	"5\356fC\200)#EHc:\221As\316FWo\222N=}z\007\037\373P\030\004\262"
+	.ascii	"\277UM\357\023q{\020\211\344C+\027\246C\272/*7\003U\225B\230"
+	.ascii	"\332B\347g\216\200\t\324\324\007\221$\251\034\370\303p\346\352"
+	.ascii	"\222\013\032\326"
+	.string	"W$I\345,\202\"I\245\377\334\f\2242\375\3119\013\221N\2776\275\312Jy\232B`\202Z\r\3438\311\t\221L\177\323\006XmA\212\310\245T@\234\0215.\346\377\204T\372\347q\342\017C\316\271=\351\312\273\350\335\255\327\335\"\272\201\304yL5}J\005\337\215\301\360\024\006\315+\277\355|\016\305b\355[\215\251\b\275\037\205\334\216z\006\276;\303\206\373w\315(8\245\213\324\355{n\364\202<\017o\253l\215\2324u~g\367\336iktN\356\314\003\217\203\343k/\003\242\200\033\007#\233\267u\360\360\341\303\352\300\327@\f\320\3129ShWs2\"F\220 \261\272Zdj\342\035\245\222>\332=\357\343\315\266\002\271;]\314PQ+\347$0\036\246D\373\226\253mb\350\3758\264\242 z?\266\2139\220\t\007\256\351\"\375]\366%\336#t_S^\372\036\351&~\373\260\337=\301o\236"
+	.string	"\303o"
+	.ascii	";\300\357\242\360\233\b\374\036\006\277\205\302\357\340\357\033"
+	.ascii	"\030\374f\201\337?\366{e\277U\366;e\277\357\357\373\327o\227"
+	.ascii	"\220\252Y\355`\345\374#:'\017Q\301t\271\231\243\035\265\2154"
+	.ascii	"+\237Z\311\337\222\351%\f\232\227\236@\315\305\273\344h\033\004"
+	.ascii	"\236Z\311\240\324\324Z\313\256\262\243\324\235\332B\347\005\314"
+	.ascii	"\360\254\267|\253{\333\267\272\363\257X\274\335[\265r.<\325W"
+	.ascii	"\265t\332(FBZ\261\022f\372f\233\205\037\336\342\355\306<\360"
+	.ascii	"\323\017\323Ej\342-~\324Ka\037?0\022\271\272J\274@\245\360\016"
+	.ascii	"\243\326\340\025\336\007Nb\224>\n\344\2238\212\315yiB?\324#\261"
+	.ascii	"\020<\205\253\252VW\203\327\241\3147}N\326\207'\231xQ\366\256"
+	.ascii	"C\230\332b\367\273\313~\325\201\017\315\330\234)\220\377\356"
+	.ascii	"\323\n\274)\306\334\376\b\274\236d\262\001S\262\267\337\351w"
+	.ascii	"\274\270\302YY\253\253;dK\320\216z\277\313^w\252\223\364\321"
+	.ascii	"u\275*\023\221\365F\270\013Z\342$\357G\365\256qM(\327\177Luz"
+	.ascii	"\250\327[.\217a\245wy\357]\221\204\233JpWz\201\312\350g\334\\"
+	.ascii	"\202\273\272VW\357\365&\3145`\327\023\330\201q\335\273\354\237"
+	.ascii	"c\257\365\357M\216\301\033\273[\3728\335.\307\347`\257/\354\004"
+	.ascii	";\271\036\335b\206\215\"#\026j\023\005\341(J\361\202\b\005\214"
+	.ascii	"\024F\031.P\3040\022\031\321"
+	.string	"0\006\035\350\242\031*\214\2145\212\212\214\214\302\356~\277G\2721$]\245\341\320\277\267cdm\031\027\024\237\253E\013\356*\336)\261|\231\ng{\326ry\200\266\272\352s}\t\206\366Du\257\340\346\027\334u\347\216zm\230\036\317:\272\311}y@\336\377\374*m\232Z\273\266\266\272\352TJ\344\240N6!\006r\312\275\227\342anFJ\336\240bk;\337\203a\2617!\006o\312\275\346\372\0047\3338\334\365\364\005z\\\366\260\302\366~\376\253\255{\257g\322\236\231k\353\332\2727{\313\353\313kz\261.\271k\231\321({<\3156\r\316R\347\216z\034\276\307[\274\265\273m\323\272y?\362\\\027s\001m\232|pK\027Ix\227]\201\t\fp/\032\366I\335\271\227\315\030\232\353i\3169\007\357r\347\006\270Fd\\\321&\254\f\337\027\300\375iz#,\206v9\347\023_\244\225\343dD"
+	.string	"\\?s\r\001\200\325\250q$'\231B\206fdD\222\244i\r\200\002\2211#v\021 E\350\234h\223\024\206\375\fIT\017\211\254\370C\303\346\371\bI\354wF\205\245\354\351#\214!\321\375=\t\340\306\201\243\336\233\362\267\2749G\034\336y\372\300\247\346\364]@\275\203<h\365'\361\322\020\302$\264\262Z/\3424\021\215\226\216j\017@\"\210\003\307\247\264\016\224\366IK\373\321\202\243=\312X\272?\013\026\251\214{\250\226C\202.'ee'\340\006;\006>\0232j2\211a\007q)\355\345\023\251#\\\007\367E\224\332\016\342\022\016\311\357>"
+	.string	"c\332+\250)\377\t\206'\007\360M;\212\202"
+	.ascii	"\003I\207A\262w\210\241ck\216D\357Q\b\035\265\3225\263`\363`"
+	.ascii	"\302.J\202R\306\327q=\013\005_Y\200\240\201\2146\341\303N\245"
+	.ascii	"\034\222\300|\204\200\202F\340 K\337\235\206\342\230\223C.c\214"
+	.ascii	"\230\345W\026q\217/\026\\\036\232lc\020\334I]G\006\350\374W\364"
+	.ascii	"\206u\352t\204\324\032M\246\235\270\227\330;cY\273\224~\302\327"
+	.ascii	"\326?\2738\360\001\327G\004\346P\366%>\337\232CiB\3320B\350\022"
+	.ascii	"\232xia\202\320\007\206\t2a\203\371#k93\022\227D\f@\357\211\221"
+	.ascii	"=\325!R2`\fl;\330\230|7\036\002\206\201\240a'\270Mp'\020\\}\330"
+	.ascii	"\370\330\355\204\0368fu\304\025\214\306\335RQe)\177\030\202\327"
+	.ascii	"\312\321\224:\303\267\006T4A|\001O\333_\260\210\023\307\005\305"
+	.ascii	"\361\242!\222W\252\367\375\271\f?\213\361\037"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.413.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\"\001\335\f"
+	.string	"v\227UB O\225\016\204T\336\361h\242D\301\315\230o\261\025c\342\r\302@\210\246[Q\017\207\330\227\254\177\367;\372\030k\007o1\200A\361\374\370\002\001\031 }\300\\\217t\205\002\360A^Z\020\"\233\354\235R<"
+	.string	"B"
+	.string	"H"
+	.string	"\333I\1774\331]w\372\021\266Mv\310\353lY\026\355\020\212jO\th\037\025:j\273\353\235N\017\027?\345&\372\247O"
+	.string	"\255\f\227\003\276I.\273\353\311\353\246\267\215\300\266\003\373b\035\016\254\330@\001V\333\255\336\251\264\357s<\303\357p\267a\272\006IR\352\272X\037\375\215\372\022\3425H\002V\305\276\005BK!\262[+\247\266LN]_\200;\235\234"
+	.string	"w\352\3223\\a\361\261\033\334\351_\037\\\210h\201\222#\226H;\214 \277\362\307\377\202G\f\326\013\221\324<\311)\363\334\276\355\214\331\333F\003\t"
+	.string	"\333\3050\002c9P\024!\316q\023\036m\253\241\316\\\022\331XI\324vB\255\224<\232\026T\250\356\210\300\257A(d\260\001)X\260\341\200\230NH\261\306\"\341\313x4\030\b\031\017\364"
+	.string	"\363\3614`\350Y\f\370\013q@O\364}\240\327\331\226\2371_P35\247\354\036\316\367\370\t\217\017\302\237O~u\352\177\001\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\366g\002\004D\3010W\270.+\004\004A\211\0214\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.414.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\305\t\305+"
+	.string	"jI"
+	.string	"\020Cp\350Mc<\270"
+	.string	"(\211\211\221\"\272\002\263\320\363T\234\334$bK\"R\373\007\270\004\322H\003\341\250\271\021\026j)T\224E"
+	.string	"\342\340\230\301\234\321/G\204\367\244\343\017\366\020\021\021\332d\357-eJ\001\344"
+	.string	"\326"
+	.string	"\366"
+	.ascii	"~\261\312\346\361l\353\327\252\210\027\314by\226\364Zh\034\001"
+	.ascii	"oV\226\033\013\320\233&\242\265\236X\365!UI\274_^\256\325\376"
+	.ascii	"\225\253\245\037RYwo\031[\230{\211\007n\032\001z3\351F\347\315"
+	.ascii	"\362D\347M\373UlWy9\265\343N<\273G\3074\\k\200\356\275M7m\022"
+	.ascii	"\233/\211w\257\246\377\371z\274\235\016\315\235fi\253P\352\327"
+	.ascii	"\256/\253\377\204\276r\347\006\246\355o\274\304J\006hQ\322\336"
+	.ascii	"\366\001Q\274\204\324\036\022\260!\347\265\275L\242\245\225\201"
+	.ascii	"\r\371\256L\216\351\006\2409\250\\\231\364\306\013H\231t\357"
+	.ascii	"\345}q\3253\3552\253\222ie\016\252x4\316Q\320\23620\261[\"YA"
+	.ascii	"\264\302\266v_X'z\357}\231\227\030Z\207.\224\203\272\367\372"
+	.ascii	"Wc7\360\366\237l_\260u\t\002F(?c;\356\351\r\310\275V\027\263"
+	.ascii	"o\246v\335\245\233\267Hj8nXE\032X\255M\252\326\332\027O \356"
+	.ascii	"\016\027\362\252&\375\344\251\316\333j]\271\200`\325\244\201"
+	.ascii	"\325k\267\333iGI\025\257\341\215\bHO\226\265\262\257\372^N\240"
+	.ascii	"\250\357\362\275|\267\305-\214Q\017\226\265\252\326\314V\250"
+	.ascii	"\274\366\210\035\340\2546\322U\027\235\355&\312U\017\345\252"
+	.ascii	"\001\234\325\300\263ZHW\375\333U\373\316\352\236\256\232\247"
+	.ascii	"\253\336\241\325\272\\5\232\253\316\345\252\317\\\265\371\265"
+	.ascii	"\277<\253\255Y]"
+	.string	"O\374\317T\207MV\356\335\221\034t\311\3141O\316v\377\313\271\370m\346\331>[\225\223\262\300\330\355\027\354\336\306Y\022M\317\275\227\351\246\037\240E\277\313\275\3108\027\357\324\372\310\250\001i\251\224)u\207\333~:\322\241\322\231\317>\025\303\324\256z\226g{\366x\270\220\367\251\360\334Y\236=:n\211a\325$\225\332\225\n\031\330H\207H;{3\303-F\373\2345s\360\324\331\251,v\262j\240*u+\250\224^\251Z\351\260Hg\037d\270E\370\366%\344\217\023\225P\257&T+\n\250u\032j\221\363%\344\227\231\253p\3441g#$\303\216\352i\341\2010\334\230\341\264NjH#\236/\t2\226G\325\264\366\006\016v\207\377\361\320\263A\334O\b%\270{o\203>1D\370Lh\2347M\353\244v\024\252\241\371\005\361icU\217\2667\361\336k\255\231\315\307/\3438tO\322I\234\237G"
+	.string	"\236\343 ;\376\035`\235\2639>\035!95\336\370p~n\206\254\361\331\370\336\310\2227\240\\\262\273\224\306W\3438\364T'\032\364\354z\235\354\036\003>\021T\221d\"\230D\202\005\005^\013\030\301\251\023f\324\213(\022\345\013\026%b\2240-\205`FpD\n\251(\025#\232X\240\210Z\321$5\345\242\t\001\222\203-JL5\275\b\006\247\232x/\257=b\213\345\233\271\241\312\037\323\367@\250\347R\321\322\034\002\340\356\335zW\272\003\335z\"\360\225\362`\263\347/\376J\220o>kf\005h\274"
+	.string	"\326D\3331\235\310\336\250e'\262\325I\362\217\017\255\236\201\023\331"
+	.string	"\326D1\320\231-1,\243\"k\364\241\"I\205\r\034\330i\217j\226\3768\3404\254\036I\205 \025\331\267\335L3t3\216\251\303?>\264x\300jvA\222i\363:_B\212\331\r\021\251cb\251\221!\373\324\006`\254\n\361\320+R\203\244F\224\340"
+	.string	"X\247!\233\321\315\227\220B\335\201\nL\222*YR\177\244M|\244C\002p@\373\364\005\215\320\317\n\361"
+	.string	"\373}\021\242\005\252\317\332i\200\300\250a0\004\231SjDDD$I\222t\300\002\021\032\"\326\001\021\3408\307$\241!)L\222\3758 M\021w3)\0364H\032\351\316\212=\004K4\273\200\301\244\347(\302\221e=\013z\206)\003Hh\303F\307\320by\250\350\275\203\320\267y\222\363=QQ\356o'P\3746(\344\177\0021>\n\242#/\325\253\337\332\n\370\"\361\001X\314"
+	.string	"\364\036\006=fS\ffn\224\0249,\345e\304nS\210\260\201A"
+	.string	"\251T%d\032\344\t\231\247\020b\355b\035\371#\022L@j{\344\337L\205I*\022\271\tW\023\230\244\351I\271\353\006\243\t>$)\007\267&\20636+8\030x\002\275\237\337L\221\363:\344\374e\366\316)V\342\315\227\354\200\224a\270^1qP\013-%e\265\221\022R\013)#\271\026RFr-\244\214d\035!\341\031TY\224zD\003\376?\301\234v\003\235\306Q\327.\005n\020mh5CW\001\376K;]\257ez\307\261D\205\244\352\343\017s\t^\304\001\026\217]\351\264\205\361\317\212gh\314\025d\366*E+\366Q\346`q\t\203\004\256\250~)\313\331Q\226qu\375:\335\335A\352%\nt\201\324x\004`HY\254\\\003sZ\275`f=\303\307\001\320E\013(\2113\347{\r\2122\300\310\301"
+	.ascii	"<\213i\032"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.416.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"-\t"
+	.ascii	"\242\01667@\217\322\001\224\336XL\364\246\236\332\017b\360\327"
+	.ascii	"V\232\365s\272nW\340\034G\214 +Be\360pL\342\030\035\303p\303"
+	.ascii	"\n\016\254@\237\347\256\307 \276\265\275\345N)\306:\026\031\250"
+	.ascii	"\001\3738\200&\004\303\347ab\232\304\354\0308\213X\320\346D\226"
+	.ascii	"i\363\262\r\357\375\034(\322\207\241\031,\260\263G\325d;\003"
+	.ascii	"\007N\221\261+.\340;_uj}\032\312\251lJ\313\271\344\234X\037\007"
+	.ascii	"YPM\326\370\270\032bk\\\251\004@v;Z1[\222-(?\345\251\320Q\214"
+	.ascii	"P\342b\262\273\241\373\236\310\276\256\313\237\330\026yx\263"
+	.ascii	"_\236\032\331\202\025\311\306\n\314\356\316K\025\371v\205q\363"
+	.ascii	"\357\035\240\033q\327\200\021\351\220\340Q\343\331]o>ny\333\n"
+	.ascii	"\266\017\354'\004! p\202\241Du\244\3457\227\"\002Q\201\210\243"
+	.ascii	"\210\250\017n\001J\031\221\005*\026c\311\274\270\214!\212\006"
+	.ascii	"4\354E\310&\210z\230\021\316*qo\305\023\307\\O\214\032/\310P"
+	.ascii	"B\031y\233\026\200\355\305\344\024O\277\326\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`\221#mf"
+	.string	"\032\233D!U\200\314\345\244\003\013\346\254]1\323\373c!\"o\345\241)\366\035\261\272\336\r\323\372\037([?\263\376DT\323\375\003\333\377\377\377t\263\332\263\375\013\357v\203\206z\3711L\3679\f\323}\024D\335}\203\247\2622\be\227\003\007\r\310\201z\007\221\355&\366N2\360\001\364\001\n\002\034\224\300 \304\021\247;f\n8\240"
+	.ascii	"\004\007\026\224\260\200\304\004!6X\200o\266T#>\356\212\3725"
+	.ascii	"j\213:\265;\373E\242>\ra\237X\207\372WB\007\333\005\365\207@"
+	.ascii	"\375\250\271\372\3237b\321'\252A \225O?\247\247\255P\345\351"
+	.ascii	"[\355\364c\324\025\375\251\252\244f\244\252\350KU3E[\240\252"
+	.ascii	"\323w\201\342G\035N\264\375\251>(\236\254jN\277\250>\207\337"
+	.ascii	"p\030ys\234\235\315ov5m}*\r\307\315\364gt\220\351JUkL\215\252"
+	.ascii	"0\327Q_\372I|\204\342\341\252.\375\237\231\267\360\027\322WR"
+	.ascii	"m\351\263\250f\277\247\232\250/\2025\251\262T\027\025X\217\352"
+	.ascii	"j\213\035]=\217T\242\007\216\224n?\241\277T\227}!\314Y\224}\240"
+	.ascii	":W\201pN\304H\177H\356\301]\034'O\303H\220\313\223}\236j\363"
+	.ascii	"\030\236\262\216\351E\372A\025\216\353\344\376\326\177\252\310"
+	.ascii	"\313\270}\246\3555l}\030\225\004\267u\300 \260Z\363Z\220\323"
+	.ascii	"vk\267Q;MZ\037\252\242U\034\"5\347\254\332\230\325\232c\245\031"
+	.ascii	"Rg\322z\242\254\312\240\325\205\254\232B\252\211\261\032#VaL"
+	.ascii	"\250\301\260z\263A}\tr: ?\362\343'\370\370r\327\243\266\200\365"
+	.ascii	"\235\352\327\223<\030m\007\301\213\216\234{\365\231j\tl\326\305"
+	.ascii	"g\\Ld\307M\035Lg\354\267\250\030\210\272\216\276\325OQ\265\316"
+	.ascii	"\226\203\225Yw\303\361\264\033o\263"
+	.string	"\321\327\251Xw\271\177\251\321\027\252\305\272\202\306M\020\271\310\356\252\377\242\016\373J\325\35203\370\204*^R1\234\214c\305\340#S\354F\001\b\004\002/\325_Q\231\345QL\006\203\215@\361\334\023\313\355,\363M\340i\016\354p\247\n\265cf\0360\030\004\312`nf\0358\267uuuuo\352WUf\376\325\004KHE\367\302K\302\035\341\212p?\270\036\334\022\267\204I\342\274\003\303\226\fB\244\027\230\025\230\037L\016+T,\2073\205}\240\205i@9\301\340;M\356\216\21259yTl\tI/}\255\331\021\273\n\025\345P\035\216\367\250\330\247'T\354O\026*>*?*v\304\375\335\204\274\2108\277\373\201EwA\005\347\031G\227\013\265\017\347\257\263\025$y\235\237\345`\236\321\030\260\241\313\374\354\206\363\225\352jX\245\301\374\177\202\306~L\314\363\254vT\034\305\317\222\234\370\331\236y"
+	.string	"\316\224\236\236\342g{7'\305\"`@\212\225\340v-l\351\007\212\001V\2034\304\275A\261\033PL\033\024\013\342)7/\304\343\240\330_\315"
+	.string	"\326wS\223\022\0223\346\202\355\231\274\363?R\272q\235\346\302\005\373\233\271`\177o\306\370\254\207S"
+	.ascii	"\312\370\354\357\024\2003>\353;M\322\227\236\345\3353\321\245"
+	.ascii	"gA\234\315\270\206B\207\351Y\270\376\216\267~\027\262\317\303"
+	.ascii	"\255_B[\277\007[\337\307Z\377\207Z\037HZ?\bZ?\214H_\354\254o"
+	.ascii	"\202Y\177\354\330\0272\244\353N\332\225EY?\007\332U\212\254O"
+	.ascii	"&\244\1776\326?\212\365\207\230\320G\303\272\302\b\322u\tH\327"
+	.ascii	"\246\037]\231|tu\352\321\365\t\254k\321WW#\036\3752\257\256H"
+	.ascii	"%tU\352\352\372\303\325U\270\243k\220\216\256B\306\256C[]y\264"
+	.ascii	"\272\366\344\350\352\223\3255\005\216\256*ntEa\243\253\016V?"
+	.ascii	"\275}d\215\376[\261\377E\243\037G\354\033\271\352\313\r\373s"
+	.ascii	"V\375\272\031]\201U]Y\250\372J\031}\270\030\375\255\251~\021"
+	.ascii	"\251\276WT\337\fF\037\r\252\277\366\324Ws\352s5\365\263\230\372"
+	.ascii	"\306\245>\216\027}-\245\376M\352\3378\020\bd\346\200\324\267"
+	.ascii	"\361\352\202\321\035s\b$\002\301\036\237U\340\020>Z\234\341\020"
+	.ascii	"O\033\r\261\343]\030\255]I2\241\307`\324^J\n\252\370\022\024"
+	.ascii	"LH\026c\n\036'\t\311\2508VT\034!\002\375K\n\342\325\2434\034"
+	.ascii	"@u\343\3453\021\232\230SLfI\204,\306d\007\fi\312\271\f\223Y\r"
+	.ascii	"B\237\220\305x\354hcCb\217\3421\3333\215n\013\026\263<\023\212"
+	.ascii	"\305\3708\343\026\343J,\006\203\305l\005K\ff?\230L\ff9\334&\006"
+	.ascii	"\263)\346\006\034\006\263(\031R\247\363\344\211\301NF\2246UB"
+	.ascii	"b\3720\230\355\025_\211^\351_\024/<\013s\361\227%9\225\322\233"
+	.ascii	"\354\305^\354ey.\230\313\362\220\230+\211\271\b\270Y\222\361"
+	.ascii	"\300\274%\002\201,\217\301a\243%\241\301\371\303F;\"\025qC\234"
+	.ascii	"\027\230\037.\2073\305<\023\323\f''\206\"6Z\337\031\301\222\f"
+	.ascii	"\320c\322\336y&\032\261\321\362\314K\303F{S\206\215\326\303\021"
+	.ascii	"\033\355o\206\215\021\020)\203~\262\226\315\220\336\336\350\321"
+	.ascii	"\222\363\026\254ey4\247\fk\331\2333\254e}\247\311%\271\277P\f"
+	.ascii	"\352IU\234B\316b\300\345\350\342D\234eA\324x\017g\331\337\t\316"
+	.ascii	"\262%g\020c\331\222\340\ncY\222\364\265+I6t!\306\2627\207\030"
+	.ascii	"\313f\020\252\254\330\223\342-(_\322\337\212\365\025MJH\320\363"
+	.ascii	"\254L\274\375Vl\017h\305\362\320\337\212\345\231:+\366\301\224"
+	.ascii	"\025k\001-5\273\3072\364\274\032V\231S\251\324\205:\237\314\245"
+	.ascii	"4\351\"\235F&QjAx\353N:s\251\224\213\203{kcK;\321\314\216e\350"
+	.ascii	"\325\260\212jJ\n\3522-\245I\247Q\021Qj\205utK\245\334\031g\276"
+	.ascii	"\245m\227\355L3\315\322\343-;Qs\230R\335\251S\312|J\231\356\322"
+	.ascii	"\231d\032\245E\227\350\254B\223.]^\345)g\302\245o&[\232v\321"
+	.ascii	"N3\023M\257n\3259e>\245\001\\\",\t\366\036\264_\006/\200p\354"
+	.ascii	"\007\273\311\241\007\240\205\325\017\317\305\025_\241\213I\215"
+	.ascii	"\335\340\212C\214\266\241g\036V1~z\267\310v\022_#\rMC\273hE4"
+	.ascii	"\023\353^3a\217\2276\212\275\343y^\022K\3607\312\322\343"
+	.string	"\340\245\013zf]\t\207\350\2608\fN\335\034SB-^\302H\235Ph\221\223P\302\227\214\375\370\350\241G\031V1\r\360T|\265Ib\3511\335\232\245\342q)\310I\364I\302[\034\251'F\026\2455EB\242{-\242\240\220\263\204f\027;\250\222\222 \034A\204+B\360\203\242\007%Hh\200\236\002\0130\226^1\003\364\274\034C8#\212\177\233\f\234\210\023\b\375\205\b\236B\321\214\271\036/\t\b\032\363\271\221\2276\345|\005 6H\033\356\206\340\377\024E\347\273\177\200\270\226\3422\274\264&\367'\256\013/m\311\271\205\362\240x\266z:xYA\206\222\211\036/\013\330:6\275F\210\305K\313\013\362\032/-\034\241v\276\203\227\366AF\262\362\013\351K\211\343x\356H_H`\214\3449+A\217\343\354\t\rNj\340\232\022\362\005/\240\017\300\210\317\232\217\223\326D\310I[\002\204\222\025\025"
+	.ascii	"\n\323\351\005\213\240\fW\374\3417\324\310\311\036-7N\f\306I"
+	.ascii	"F\366\260\260\340/N\362\021\234\272\224\221\\\344\005\027\261"
+	.ascii	"\274\342Y\211"
+	.ascii	"\344\203\306H\206\373\301%\020\006cd$\277Y\017\267H^(bN\3447"
+	.ascii	"\244\365@\001\310;\315\336%9M\314\016\214\354\320\001i1\\\244"
+	.ascii	"=\311p\276^\305\251h\271\314e\244EI\317D\244=\372s\raX\230\215"
+	.ascii	"\335\270G\313M\323\207\354\306k\314fyB>\343\265\006\204\354\254"
+	.ascii	"\365x\315\376\336\212\327\354\357\267\211\317,/\230\302g\275"
+	.ascii	"\026:\232\017\231T\247/\275\345\331::\275\212\317,\2064\207\317"
+	.ascii	"\354\311\225\301g\026\305\374\f>\263\032\002\202\305\250\302"
+	.ascii	"\310d\221\205\314\314\220$I\222\341B\f\020\022&%dS\036\022`\323"
+	.ascii	"DJr@l\002\221@D\002\021\231\007\257\br2t\204\340 \024\206\312"
+	.ascii	"+\023\234_\207L\210\255 \223x\233\346\033\333+\032k\253\315\306"
+	.ascii	"YP`-s>g\333\256\254\2577\024\2569\207p\270J;\3642"
+	.string	"wJ\265[\032`\210N\252hM\231TP\214\365\024\336MKl\260\202\204\217S\\\n\262G\375\023\017\355\316\273\241\216C\263\234\322k \216G\254b\344\230J}\370\275\212\004\220\342l\313\305\004\276\034\t!xQ\364\377V\224%\350\320D\027}\317`7J\016\352V\314V.\275\016~\036\223N(\266@t\313\202\354\0051<.\206\245#I\272Q0\341\271\242\221D\252\376G\305\347\213\243e\023V\265\367i\343\227\020v\307\024\227<l\022\377\204\2726b\253:py\371=\255v?\350X\333\nZ\242\343^?\230\236z\300wC\240u\227At\276\004\001[\232\346zJ\245O\341\321\300\376\214\027\022\030A\245]^\025\307\3773\206Jo\275=p\257h\016\201\020 y\342\\\373Iq7\330\004\344{\223\331\354]\373\255\231\274\026\273\334\274@7\336\013 \270\0012jXs@\350\323\342\313>\333\004\372\256"
+	.string	"\202\343\034\"4\230\255\300VR\270]/,4;P\253\333\003 -S\272\307Z\036@\377C\004GU\247\250\326QC"
+	.string	"\230e\263\376}+W\035\374\224T\256\227\244\206*]< \320\207\276\340\236\250q\372\240\311\335g\251\220\217\255\354\320\312"
+	.string	"\326O\253\270\315\215\020\345\361\300_M#\3120\373\016a\221\320\237\230u\344U\272\032X3[\270\316\316\3227\355\321\236;\007\027\232\315\314\377\02714\036JF\340b\244\260I\240\361\004\303\327+\243u\2056\033\212\220\346\013\013\257\\4X\262\231\260Y\207\272\352\234EB\366l\0137\naK\200\235\267\t\377\311\004\024\305\220\363\375\026\0255\325\206\257p\224\215e\251\243\203\267!\326\272v\363\271'\024\271\037\312\217\341\r\302\364"
+	.string	"\270P\f\036\005T\376\t\232\245\031J7\034\344\337\2171i\306\203\305\223\334f\211\371\203x\367{\315\036\025'H&\245*y\276\306\336+2|\371\037\344\2218\334\303\277\216+\335d\267gyA\214\300\340\237\375k\2302S\372\017\206\220\347\374\337\336\347\177^P\303$\377\035\374JT\240Q\373R\321"
+	.string	"\343SO\205gc\207\266\211\317Q\007\237:\005\263\333\344V]s\207(z\376n\317\363\237\327\367y\337\323\026u\037\234&\340\377\366\336\377yfw\314q\343\253\212\270\255\352+\270\305\337\223A-\304B\004\021\002\236\332PL\254\223\251\332\004\201^\262\263t\240w\204\373\346\353o;N\203?\204^h\017&\232\224\3061\202\363>\377\017\013\002\367U\360Z[\264*\242(d/ADj\243x\342\2623ZP\217\312\243\217\353\241\377Dj.\337\303\217\274\261|\364b\3642>\356\326\024=\243\362\343\007\255K\206\342\302\231\241\3666\3725\226\262g\263\222}Y\353\311\313-\206\377\3462\362cW\343\037K\023x\372\345\360\325[G\336\334j\362h\352\303\017\253\033\277\332\333\350\307P\316\237\215J\006o"
+	.string	"\005,\233\313\241g\262\374`\310H\201w\205\035\211j\206\346\351\231Uk\237\372\373C\241\3746\331Q%%;\261\300\214\177\007ws\223\272\r\337\253\217X\371v^7\016\262\207\006W\277-\367\366J|z\0338\332CO\215\006Vw\307\r\316A\\\r\r\310D0\315\244\212\335\260\341\313\001\f\376\277\001'y\023OCp\005*\001\205G\214C\027\002\347\241\353\2600\\\215Z\237\277\007\224\022p"
+	.ascii	"f\037\215M\214\033\235\367\037\316\266\362\013\205\024\336\320"
+	.ascii	"\333\352!\0378]\233\255\271\372\253_\241\234\016[%j{ \3373<1"
+	.ascii	"\rV\216\355\016\261X.\227\313\305b\231\345X,\027\\\036N\306|"
+	.ascii	"<\373\360\377c\t\370`\341R\231o\032\017\n\025e\312\230r:\327"
+	.ascii	"\324\214@\217\306\340\234\013&\214\224\261{#\255Lj\365\215o\300"
+	.ascii	")\311\200\271\373\017\025\025\340\005\004RH\235\242\220\205\201"
+	.ascii	"\241\017BH:\3316\206>\311\330V"
+	.text
+	.section	.gnu.lto_.refs.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375`K\t\225-"
+	.string	"jf\310\021@p,'\215\001,#\340\345\016)\247\024A\230#\214$\313\244T\177\244\007\374U\213\272V\314\266k*\331vO\227\"qAj\261hX\221\241f\006\374V\373\246,\031a\326\022u\353\335\b\3312\005\356"
+	.string	"/\001\004\001{\225\373t\312\037\226o\341j\237p\365\022\310}\213|\005\345\0370\037x%U\376\217\334}\344\357\006\374Y~9\340o\345\327\312\255\242\252\250p\357U\321{\002\350P\302}\007|3\370O\272\335\251\267\347\202{\255~\005\356\264NUn3\367j\376\232;%\276\"2\251\237\320X\237\361\347\363\373\361t\325\037N\324\017\353W\210z\b\365\261\352\027\250oU\237\252~\224\357y\365q\001\276\326\241x\333z_y\273\310\033\200\270\025\335\253v/\200\356\302\335\007\351\016\334\275\324\356}\273\347\355\376\244o\356^G?\267{r\367\365|\321\374\351i\222\3567\272\327\366i\373\342\356T\017\332v\252r\207\252\317\323\375.\267\237\270\177*w]\271\347\312\275,\367[\271\333\310\275\336\366\265]\323\375T?G\373\333\3705\361i\364\307}J\177\367mOf\b\276"
+	.ascii	"\303\275G\356\347r\350\271\273\036G\336\265\327\206_\207;m\256"
+	.ascii	"\235\3165\006\363j8\364*\335\013{S\375\346\267\033z\200\372\356"
+	.ascii	"6\264\234\r\275&\374za\247\r\267\320{\344S\356cX\371#\236:]o"
+	.ascii	"\264~Tsf\f\204\037\277h\261B%J\223$D\200\370~\334\261\311\222"
+	.ascii	"\357EJ\365\3053\255\027\005\215\211\205Ux\021\217\324\213^r\340"
+	.ascii	"\260\301z\021M\031\n/\206\231\360\242\027\t/j\211\360\342\225"
+	.ascii	")[/Fq\302$\311\221!@x@xQ\307\246"
+	.string	"K\224 <=3{\360t\021\242Ac|\300\274\272\334\244\t\323\005K\025)O\226\034\021\342\303\3674G\246Jg\216\024\025\n\324G\317W\0346d\270T\201\342\373m\262D\211\021\"B~\364\330\241\365{C\023\246J\221\036\225i\375\211\034\374\206\032\374\202\030\374\201\030\210\355\321\023\365\203\331Y\360\3231\177\256\254\247\200\365[X\357 \370Y\3007\360{\002\343W\375\0368\376\224\002z/\301\363\020\374y\340M\003\217+\237,0\201\345\361c\177\374\210\355!\367\365\220\277\235\362\003_^\370\333\220\316N\243\235\3738\236\273(\236;\245\224\236\b~\212\273I\333\235h\257+G2\262\257}\314\255\211r\233\270\323~/\212\373\212\227\030'?th\337\rMB|\315\334\366-Cf\277\254\227.\\\266h9\367\315r\005\370\033\205I\375MR$H\030\2368\303\363)\234/!\370\002\314\337\231\217;\201OG"
+	.ascii	"\217z\020\235<\337\026\034O\021\365\005\036b\237\353@\277\233"
+	.ascii	"\001\375\326c\277\340??\265\237\207\272\317\357\262\336\251\301"
+	.ascii	"\343nu1\261\337s\020\271\311\303\366\332a\224Nq\277\271?\320"
+	.ascii	">s\273\256\264\035\026\366\342a{\250\213\347\371\035\354\016"
+	.ascii	"\3647\335\3665e\242\364\035\372\223$E:\367\317N\263~\315yc\376"
+	.ascii	"\320|\t\346k\231\217\205\300\374+\363\251\314\007`\376\315|\332"
+	.ascii	"_/\236s\360\235\265\327J\235\270\332^\277\2727\324~\232"
+	.string	"\316\347\314\037\3135\320\026\226{\260\334\201\303}j\370\277\257\016\272<h\245\273C\334\207\333{\343\237\365\315\337\256\373\355d\335\353\342xZn\037\305]\244\221}\355\346\310M\027\307{cm\320\367w\215}\307i\354\013\351Q#F\211\f\325\315\366\035\004\310\366\013\247\374]s\373\025\003\306\013\026\336\276R6\373\205\362\242_$\266\0352\331\230~uT\032\323N\372L\367\233\215i\277\254\367\242\337\320?T/4\240\372\237\365\324\357<g9q\312\013\345[\230P\376V\375\254\362\261\204o\240\374\002\302\037P\356U\345\013\311\035H>\224\242\0377\364\214\01326\006\f\372b\267\242\013\351\007wOE\177j\367\275\372N\277\317\211\342\217l\027\270z\031XY\031\245-\3525\333\323f\304h\026\3426\333 \272\202.n\266\n:\335lS\354c\335\267\216\202\236u\331\2165\330+\230\321\216 \267\037\020w\003\264\275"
+	.ascii	"\201\253\275\350\003x\273\325\213v\252\251(\340\275\341\016`"
+	.ascii	"\370\273\025\355Ns=\316\f\200\336\2501pE\0209\"\"\"\"2\222$\351"
+	.ascii	"\360\"\233\221\266\r\021P\327$\265Z\003\031\224\346m\353\327"
+	.ascii	"f\325\326_\002\316\361\212\313d\261+>8\245\226\b\313tbt\221 "
+	.ascii	"\234\367\034\234\222\261K\006xR\223D\310\312\201\217\217\001"
+	.ascii	"\002x\307>\327\027v\277\326\006\324\223;\324I\376\277H\020a\330"
+	.ascii	"\361\022\004ZHj$^\270\273\277\332\005\214\324q\030\004\3511\237"
+	.ascii	"\027\002\321\220,\315\030Y\006DS\020HQa\260\340\365&*3o\334\204"
+	.ascii	"\317\343 M\363:1y\376D>\302\373An\276\357\362\221\002\353G=\251"
+	.ascii	"\037/\355\341\231\322\304\264\225\303\254V\t]'\202\353\031/\024"
+	.ascii	"\351m\374d\311i\334\342\217\276\254\f\277\204\300\2235\007c8"
+	.ascii	"M\273GD\254\335\340R\270D\232\024\303Cb\200S\234\327\350'g\270"
+	.ascii	"\305sO-\274\017\332\241K\352\341\002\034\003V\300xhA\n3\244\016"
+	.ascii	"-xs\004\341\325(\254\3105!\033\0079\252\210\324\214\307\244g"
+	.ascii	"\204\231\203[\303\232\023<\326\\,\r\270\311B\025\344\361\331"
+	.ascii	"\242\024\\\314\201\t7\225\264\261v\340\204\024\"\216\037\304"
+	.ascii	"c\005\277P\254\002"
+	.text
+	.section	.gnu.lto_.decls.eacdeb542ca4fdf8,"e",@progbits
+	.string	"(\265/\375\240_F\001"
+	.string	"\255\004\005N\244\007(\033S\0200d%5\006\3739\354!VXa\300U\033\213{<\026PO\255\021c\220\034\216\261\361d\342n\371\030b]&\324\304\\Sd(V\374\271\251\302_\314\342\254\322\267\377\253\351/f\276O8L%\214\342ob\321\275o5\214l\263{\313\335\224M\356\024\226\027\265\033$\034m\373<g\373<Fn`\255C\370\216\230d}E6\005\357\006\026\245\254\317c\265\257\216\305\370y%\371\230\306q\334\003\254\001\234\001\254\002\332"
+	.ascii	"Z\001i\250R`\r\240\f\236\r\300\032\300) \f\025\256\212,\226r"
+	.ascii	"u\360\340\311`\243\021;R\332\372\007R\035"
+	.string	"X\205\206B\034\217e\211\355\332\262\356\3519\220J]\242'\335\222\365y\252\366-\360\355[p\263oan\377@)`\324\213$wjY\223\t\237\236|dA=\265G\246\310xi:\360\351\317A\200N@\030\302\241\022\232\021R\326\277X\325Y\263^\317\201Md\242\252\310`\002\302 \023\275r\203\001|!6\265\343\007\331X\034\307\305\266\212^\021\031.x\206f\366\272\274-\211\001*\255!\"\ts\242\227\365U/tj\030\"0\216\263\346\242g\3240*\\\227\004\306\316\220\321sh`\370\300\360\324\263\267\027S6\27385->0<\"\\T\264\rF|``f\036\020\206f\032\307dz\215\016\243\307\020\325\274,\265\265\201\341\003\303\003\223\223\352\254\360\201\201}\311I\353\027\030>0\274:)>0<\365\314\255\251K\227 L\370\300\360z\364\032\215\006M\b\037\030\336\0350\006\032\351=\215\247\333"
+	.ascii	"\217\364\033\255F\347i=`\221\346\003\"\351>`\222f\003l\241\335"
+	.ascii	"\250R\275FO\257\323h\273\353Ld\215FT=\323k4\034\373e\307\007"
+	.ascii	"\206\027\307dB\033a[\324`\240s\226\252\263\032@E\256\2670\266"
+	.ascii	"o\201\307\276\205\031\373;}\373;b\366w\266h\321e\206pTe\242d"
+	.ascii	"\375\035&\373;_ZNm\272\323a$\353\357\324\330bv\224\366u\332\354"
+	.ascii	"\353\224\331\327\301\262\257sd_\247k_gj?\207o?\247\314~N\333"
+	.ascii	"~N\331~\316\217\375\034\033\373\327[\264\026`\023\2660#\255\345"
+	.ascii	"?\243\031]\324\262h,gS}^Y\377\032\213\036\373\215\271\301'\225"
+	.ascii	"\265\027\226\263)\22181X/\316\2422\234\222L\203\264!!\002\247"
+	.ascii	"\203\007\221/]S\257(b\330\250\216\274\211.A3\355jRf*\343i\314"
+	.ascii	"\230\f\031^[ay\321.3/\3232\266\260\251\324Lt\214\036\373\t\371"
+	.ascii	"\r!\026\031\343\230\313E\027\331\231h\327\223.[cx\321 [\222L"
+	.ascii	"\263\256\254\242\332\206\326\322b:\326U~}:JS\321g\032K\033\321"
+	.ascii	"C\364\016\375D{i\032\032I\273\3207~ot\222N\242\241\264\224\006"
+	.ascii	"\242\221h!\332I\037\351\"m\244\231\350\250\236\241eh)\272J\037"
+	.ascii	"\321Nt\227^\242_\350,\035EKu\023\315CC\321[\332\354\307\247\311"
+	.ascii	"\264\225.\242\247\350)\215C_\351 \272\205\256\241\2314\f\235"
+	.ascii	"C_\321T\272\207V\242\277t\223.\323j\332\207~\322:t\230N\323h"
+	.ascii	"\232\210\266\242\271\364\017\035C/i0\255\244J\365\330/\357?\275"
+	.ascii	"\337\236R\024\"^zL\263\364\330O\353\327\365#\213\222\360\344"
+	.ascii	"i\212\367\264\205D/Z&*,\032\307d]P\332\210\200\271!Cj\fX\026"
+	.ascii	"\017\247\251WZZ\336\"\302\2654\26666\2351\346G\316\312\242\321"
+	.ascii	"\243\307~c~k~dT>$\331\310A\334\300\202hQ2\215c2&s\321-17Q\"a"
+	.ascii	"\256\246\276\242D\336~L\263\327\025(]ed\242?\244\026R\274\246"
+	.ascii	"\210Y\353RBW\243+\032\307dPc\304\272\240\211Q\313]gb\334~HI\\"
+	.ascii	"S\262\027\225)S\031T>\242`{\323 Y\226L\213\364E\1771\376\274"
+	.ascii	"e\204/\352%EE\323\301e"
+	.string	"\032\307d=lhL\343\230\354F\r\031MJ\262\260lD\211t\0012\315\352\361\363Rj\312T\177\016\302El\272\367g\257*R\242\331\313\212\216(\323\256$uS/4\270x\264\251\352q\223\344\024\215c2/=\366S3C\233fY]\311\250\352\341\342\317[_L?\246?o\005y\261\025\035\003\343\207\264\004\005\306\230%\271\313\211\230\267\250\f=\366\2631\346F4\216\311x\326#\031_T\252\227n\263T\235U\235R\221\353s\234\366\221}\373\310\271}d\333>\362l\377?2\377\255\371\177b~r\277;u\212\213\225\264\254\325\374\370^\244%\311\372H\351\376\377\233\376\352~i~t\252\364g\367;\363\374\301\234\224i\331\317\356\207\006\255\314\224\250\335\317\f\003\264\304\242`@\036Uvq\256>r\307>\362\306>\362j\037ic\037Ic\253Mz\376#\243s\260y\022\222\365\2212\266:Uu\326"
+	.ascii	"\250\310\365\310\244\375#\232\375\343\227\375\243\225\375\243"
+	.ascii	"t\377\030d\377x\265\177D\332\307\271\333\307\351\262\217s\266"
+	.ascii	"\217cd\037\207k\037g\306>N\322\276\361\314\276\361\313\2761\313"
+	.ascii	"\276\221l\337\370c\337h\265o\214\332/\356\355\027\321\354\027"
+	.ascii	"\337\366\213g\373E$\373\305\256\375\242\214\375\242\213}\342"
+	.ascii	"t\237\270\266Ot\262O\374\261O\264\261Ot\261?L\263?|\333\037\246"
+	.ascii	"\355\017\301\366\207Z\373C\250}\241\232}a\333\276\020\312\276"
+	.ascii	"\260\307\276\220j_h\264\037\244\373\r\371\263\217\274FE{~\321"
+	.ascii	"p\222\365\203d\366\203]\366\203j\373\301\261\375\363\361\373"
+	.ascii	"\241Jy~@\300\0349Ye\375`\221]\202X\345Y\337\247\362\254\017^"
+	.ascii	"\355\007\221\366\377\333\372\257\353\377\341P\313\374\270P\350"
+	.ascii	"!#\206\227\254\177:~;\376\343\372\345\210\177\\\036d\305\261"
+	.ascii	"\321\217\253\270\027\307FEU\035\200\252\016@\207m}EY\365\335"
+	.ascii	"\276\255\212\365\374\267U\214S[\343\225\365]5\273U\221\353]0"
+	.ascii	"\373\256\225}\227\311\276+d\337\265\332w\223\366\333\272\375"
+	.ascii	"6\313~+\266\337\362\330o\235\366w\336\376\236\333 \250:\3537"
+	.ascii	"\226\375\275d\177k\355\357\026\373\354\335>\013f\237\214\332"
+	.ascii	">\213d\037O\325Y\317^\355\263I\373+\230\375\025\312V\241~G?#"
+	.ascii	"\365K\334\022\"Y\377\317|\277\370W\224\373\362\033U\3723\312"
+	.ascii	"y\317zy\357\252\2276ay\r\033\261)^Nr\262\205\244\354NE#\026\221"
+	.ascii	"\305O\013 S3\006\266\341g\224\335\024\245\361\340H\254f\f/\216"
+	.ascii	"\311x\200tJ\330\304\204\032\003Ug\005\252\310\365k\326\376:c"
+	.ascii	"\1775\332\007\316\355\003\3336\217\252\263\036He\377YM\256c\363"
+	.ascii	"\300\336\276\352\362[&\363\223BM nn\332\206\246K\0273S\272\214"
+	.ascii	"&\247\311g\3624\333\251\322\\\227\313<\317e3\352Y\256\313\\\352"
+	.ascii	"\274\374\352\031\233\032\346\210.\332\226\353\262\333\231i\034"
+	.ascii	"\223\r\267\336\300)!j\225L\325YyT\344z\240\2221*\017)Q\262d}"
+	.ascii	"`t\377\317ar\\\026\243J\263\\\376\262\001\316m\f\314\226\\\366"
+	.ascii	"\242\2329\200\312\034\033\2608\216y2\310 \003\341\2251\273\253"
+	.ascii	"\255\017\224\261\017T\332\007\036\355\353\276}\255\267\257\325"
+	.ascii	"\354\3531\373\232m_g\331\327i\373\317kyK\027.?\326\262\336\362"
+	.ascii	"g\"YK\306\"l\201\324(\333\222u\216s\026,.\230\233\r-X\256x\t"
+	.ascii	"\322\304.k+<mYW\016\247\254"
+	.string	"\257\303\266\214\033m]<\246\310\250\312X\261\217\267\262(\224\034dH\006\"e\311V\223\234#s\021\215\2141\222\031\264\250W\223\374\225\261\210FQ\302\302\262p\250f>\326\242D\214\344#?)\324\007\037I\246M\262\230\0240\260\261\334$#\311G\210H\3068\366!\026\215\3438\007\021rF\226\325r\225\f%3\311S2\225,\315RrZ.\313h\371,;\311f9J~\242Js\223<\366\234$+\311YZR\324\246\271\253I\356\221\201\374\310\250\264J>\244L\263\214\334$/Q\303\020\215\310b(V\212\031\2457\2748&\373\035\205\321\2232\200\276.\2627\234\252\263\252L*r\275\306\261\257\255\366\265\324\276^\332\377\361\035\371s\021\265\213j\226\205T\366Z\314\310\372\277\273-T\221k\005s\373\277/\273\003.\373?+\373d?\236\201\234\021c\230\201\325\310:\373\350y\376\361"
+	.string	"\0379\302\262\376M\331\3779\331\247\262\343\231\353\371J\315\262P\\St&\227u\326\321\363\274#"
+	.string	"hY\252d\315\222\355\303\025\331\377\355\330\237\252\310\365?\254\375g\03232U\276R\263,\260RX\244V\262\3165\262\rUz![\331u\035Ee\375\337\214M\2028V/\254j_\237zaU\337z\236i\374\250hi\261\227\365\177O\273\003Ug]U\344\252\306y\212\202\"\331\214\246\0341`\34404x\304\310\372\317R\031\212M\302E\313\222\245\fC\205;\033\001\215\3274\216\343\3779*?\251\322\fuM\006\225\235\324)\032\3264\216\3112\340\311`h\306\207\033\330\252\377;\332/\236\005\310\217i\206\221]\250S\"\022Y\034\345\242\001Qz\303\313L\271I\225f\030/\273\020|c\022\206\267\352g\274\375L\267\237\317(%\211i\331:\313:'\345\214\224[<'\345\243k\370\340B\244\234\244\343\330HU\007@T\325\001"
+	.string	"\263"
+	.ascii	"1j\262\352g\271\375g\243\\\224V\204\025\225u.\312\261f\2225l"
+	.ascii	"\271\334@B\225\365\363\332\376\325\276\2741xS\360\262\276Z\366"
+	.ascii	"\367\\\315S\317\250\323\237\024j?i\362bZf\216)*F\316i\203]\334"
+	.ascii	"\022\033\265\215\272\247\272Q\337\250x*\237\272F\325S\245j\236"
+	.ascii	"\252\346\352\231z7e\f\231\246\350\230\031\025\355G\026e\237l"
+	.ascii	"\301\350\362\367\\\315S\341\3240?2*[\251\311\3234\216\311\256"
+	.ascii	"\266\271\305U}\360\367\344\251iT4\025\256*\376\305\271\2101\005"
+	.ascii	"\213c\262\f2\310 \003\236\f2\310 \203\f\204B\256\334\236\344"
+	.ascii	"h5Vu\326g\256\375lc?Om\025\215J\247J1P\353\310\212\255\234\232"
+	.ascii	"\253\263\254\237a\354\253\030\254E\f\326\253l\366\3254\373j\230"
+	.ascii	"\3753-\373T\230\354\257\251:\253\372E\005\243J/P\343\256\276"
+	.ascii	"\251^\0164\"\213\311\342\230\254\230}\274\201\322$\353\253H\366"
+	.ascii	"\325\013\326__\237z\301z\225\3076\252:kV\221\353\341T\235\365"
+	.ascii	"*\325\376T\325Y\177\225\r\203\241\033\271#0.\027\330#Un\354X"
+	.ascii	"\273`#]\2212\266\005K\360\210\230\265#Y\177\203\232\352\204\210"
+	.ascii	"d\214\221\244\324E\3438\376\206_=\3735|\240bQ\241\250h\304\""
+	.ascii	"c|d\306M4\216\311\376\253Y\324+\252\026U\252bQ\251\\\255\242"
+	.ascii	"Z\271&\213c\2448\216\257\216\375=X\3244\325\311O\n\025#5\311"
+	.ascii	"\022\201\242"
+	.string	"6O\216\340\305q\234A\006<\031\2541\224\310\375\330Z\315Ru\326\034\025\271\036\003\373&\354\217\260\325(\252\024UJ\201:\345\032>\370\257\210I<\026\307d\305!\037\022>\275\254\017\201}\225\202U\355S)X\257a\033U\344\372\253O\234\374\226\230\262\342\2638&\303)\341\305\013\272\254\1775\311U'\252Y\316\212-\004\277fd\241\313ZU\242.Q\245\317\2422\271\332D-{\213D\026\227\305q\\Tyl)\342\221u\005\252\316\252U\344\372\f\366U\262\037\265\342\017\236\367\2128\216c\365YV\266\257\257\257O}\226UC\317\325$\277*\246\216!W\250*\262\370,\216\343\342\n\206\005\207\233\254O\246\352\254[E\256\037\260\3771\205\277\rc\217?\033d\213\377\352e\225k\372]\247?\350\343_\313\374\353\230\225\314\317\032\377\365\314\277\246\371\331\341\277\252Y\363~V\370\257{k\037\016\233S\002{"
+	.ascii	"V\347\016\370\217&\216`A\256\026\203\003\3306$h\213\354\230\326"
+	.ascii	"\202\033\0026\214+\202?\330\343w\211\202<\360\314^\347\256\225"
+	.ascii	"01\344\202\340\017v\375n\036\006\027,\310\205D\341?^`A+\004\300"
+	.ascii	"\2771`'\370]^k\202\205\327Y\b\342\270\001\376\343\226\t\277\273"
+	.ascii	"\266\201\021\377\247\330\260\320\206\370\037\027\303\302\247"
+	.ascii	"4\361tP\372[\017Z\355\316\300\372]\033\256\325\037\274\241\365"
+	.ascii	"\2739~\227+\210\345\366h\241\266\003Z\013[C\220\306\325\317Z"
+	.ascii	"\260\272\375k\027\367\307^\301\216\271B~w\310\037\264\332O\262"
+	.ascii	"\213\262\327\271^\352\352\026\331\030\332\343\221\337ec'Pw\344"
+	.ascii	"\027\027D\340_\275\270j6\034\360\277\352?\252\360\273S\277\212"
+	.ascii	"\302\354X6\007\257\333\307\255EC\220\306\277\211\256\026\013"
+	.ascii	"U\177p\306\037\234j{\216>\355\360\330\026\177\267\214\005\255"
+	.ascii	"\360\377\316\177\274\360\277\316\302\361YxN\024\177U\033\005"
+	.ascii	" \345\346w\033\300\266a\325\270y\353\036\007\311\250\265\257"
+	.ascii	"\275\340\222@=\2337\330@\020\352g-\330?\313\376n\324\357J\375"
+	.ascii	"\301'6\356w\247l\360o5\370?\301\177\274\300\337^\240\203\301"
+	.ascii	"\261\002-\233\340\004\222\264z\177\273\367\007\235\376\215\026"
+	.ascii	"l\"\256F\314\370\376\266\357\0172\035\177\342\027\270\"\216\200"
+	.ascii	"\037Gi\257`\241\244v\b\254\f\252. _\377\337\250i\357\376 \214"
+	.ascii	"\177;\377\034\305:\371\331'P\202/^\267O\310A\027\371\305:b'\t"
+	.ascii	"\341\307\t\201\004\202K\353\003\376\265\303\277\206\360\257\024"
+	.ascii	"h\253\270\354\277.\203J\277\033\374\203-~W\370\007\223~\342\202"
+	.ascii	" \322\037\214"
+	.string	"W\037* \37488\376\214\374s\005?P\347\007\272\177\316?\360\303\0174\361\007K\220\007\360\347\006\374y\202?\177\370\203$P\373\376L\342W\371\376l\374\263\t\177\246\340\317\037\374Y\303\3777\300\342\037\034\301J\302\277F\340\017\212`\205\300\037\f\301\352!\270\302\317z\370W\235?\310b\305\371\201v\377:\301\016\013\256\310`\376\\\345\317Z\376\334\366\347/\177P\205\037\270\346_s\376m$\250\342\007B\371\267\220 \321\017l\362o\257 \374\003\257\376\335#\b\375\201E?\360\350\337;\202\317\037\350\341\007\222\360\003;\374@\f\374\300\023~\240\t?\260\002?\020\304\017\024\361\003E\370\201%\374\300\t\374[+\b\202\037h\200\037H\200\177c\005\207\376,\342\317\033\376\234\341\317\302?\350\314\033\374\231\347\317\277?\330\314\373\317\001\370\325=\265\356\3179\177\306\340\317\035\376\240P.\341\317\031\374\301\240<\342\317"
+	.string	"\310\036\3749\204\\\201?\230\302\317\206\360\347\343\237\331?\257\177\356\340\317\002\370s\373\347\b\374\301\017\344\005\374\331\202?\377\317\352\2379\374\252\220_E\363\253\323_\245\003\342\374A\346\017\314\371\201\307\037\270\363\007\201~ \362\007\032\177`\360\007\362\374\233\306\277k\004\177~ "
+	.ascii	"t\232\037\213\377\267\342\017\246\370wT\360\315I\177&\372\363"
+	.ascii	"\212\337\320\377\203\006\227\377\017\376\225\370\375\374?\024"
+	.ascii	"\332,\177\253\345"
+	.ascii	"\017\372\3749\356\317p\377V\n\242\b*[\266\277\345\022Da\307$"
+	.ascii	"\370\203\311\277\255\362\007=\360\263\037\bv \003\tA\220\003"
+	.ascii	"\177\373\345o\301\374\301\r\240Y\336B\273\366\347\027\033\bj"
+	.ascii	"\200\245\262W\250\r\370\215i\376\240\211\\\343\017\226\3106\376"
+	.ascii	"`\005\3766\354o\305\376 \211\\\365\347+um\215\264G\376\240\t"
+	.ascii	"\177\033\344o\205\004K\370\333)\177\213\366\007G|?\203\"T\241"
+	.ascii	"\005\026\303W~\261\201\227\271o\255\2247\367\220\b\277\361\313"
+	.ascii	"\257R`\265\342B`U\373\267\373o5\177\220\002-\233\337\r\341\017"
+	.ascii	"N\240\005\361\273\034\376`\210\235\346_m\354i{f\316%\341w?\374"
+	.ascii	"A\020\277*b\255Z\247\376\275\203\037~\313\177\257A\022\324\021"
+	.ascii	"\301\021\376v\356\017z\370\265\226?\227\371\267\016vX\233V\030"
+	.ascii	"+\323\377\262\365\305\277B\3553\377*\265\201\022\300\314\375"
+	.ascii	"\357\300\217\223\345\277\225\377X~u\350WSP}~\025\305\315\324"
+	.ascii	"%\b~\365\347W\205\330\276\240\bu\267\300}\323G\256\3417\376\374"
+	.ascii	"\317\302~\371\203\034nv''6\007\306\344\377:%7\305\247h\243\376"
+	.ascii	"U}l)p]\374\254\231\337}\361\007%\240\256\301\020\376\026\303"
+	.ascii	"\221\001\037\264\027\374,^\213\200?\270\236\370\037\231-rc\b"
+	.ascii	"\002\377M\324\242\352\366\370?\347?"
+	.string	"\036\300\r\3130v\b\256\233\353\355\355\023\371E\206:\301\b\344\377\224\f\205\341\373?B\377\235\301ek\300\357:\340\017\352\177\203\371\331\264\340\357e\301\374\377\304&\243\363\343Tq\013\360\257\"p\017\360\273Z\\\004\364\255Ga\\>\367\215\233\347\256H\277\360\343<iq\374,\002\\7.\236\252U\370\335\343\357\"\177\267\315\372\374\300\277\246\370W\241\225\371\253\024\270l\3765\350\327GT}\r\374\002\027\016\004\277\013\346\t\370qx\254F\326\026k\t\376U\004\353\b\376\225\004\377\247\254E\353\321\212t\342\002U\001\037\300\217\203\366o\002\270\035\370]6\325\202\335\367\263\005p\327\254Z\246j\007\f>\377\212\345N%A-\241j\026\303O\270o\353\225\177\315\362\267\371\177\006\376#\360\337n~\266\002W\315\357j\340w7\360\273v\254\233\233\346W1\250\353\364?\217\252U\023n\335\257O\370\003\360\037\325\337\025"
+	.string	"\217\033\342w7\370\335\f\277\213\346wM8\203\201c8\261\363\376#\177\2345m\256\231_\245@{\346o\353~w\356WM\370U\013T\t\374\352\004~u\304\257\206\360\253$~\265\204_\245\340WA\374*\207\377qn\231_\355\340b\370]\n~\227\314\257\212P?\374m\214\277\235\372\3351\352\b\277\352\341w-\374\256"
+	.string	"~W\356WC\374\252\002T\022\332+W\314ZK\365\267U\277\033f/\300\035@\215k\340\377\006\376cp\343xX\fk\013\027\314\357\302\375\356\233j\342\030\370q\200\374m\223\353\366\237\315\317R\371\024mT\205\277\032\374U\343\257\272\177\273\364\267.~\267\355W\211\377\353\266\005/\373\267\001\376\325\310&\300\316\340\262\335\202\237PO\301\177\r~\243\003\376-\202\313\345\177\235\273v\202\245\340\301\337\310C\033\267\216\n\304\335\362o\342\337v\375\256\226?\217\340w\263\374\371\350w\261\374[\204{\345ou\374\355\216\337\265\362\253t\377\247\374\252\232?k\360\253w\177v\300\277C\210`\223\340V\371\2337.\222\277\035\341o{\374.\225\363\374\267\360\347\345\237-\360\013\\\265\335a\001\277Q\351g'p\317\336.\340\353\177t\376,\324\207\177\261"
+	.ascii	"\356\223\237\035r\362\263\257\331q\376\342\006K?\373\342g[\374"
+	.ascii	",\214\237U\372\331\247b\007~\226\253\354gQd\375\354\215\237\305"
+	.ascii	"\361\263W?\253\365\263Xn\223\037\377b\005\\&\256X\006W\372\263"
+	.ascii	"=d\356\030;\366\263\322\237]\362\263b?K\366\263I~\226\311\317"
+	.ascii	"*\371Y'\277\273\344\317[\3771\374\305\250\177?\177W\311\317r"
+	.ascii	"\360\273I~\366\371\273c?\033\364\273b\277\312\365\277\375\215"
+	.ascii	"c\376\235\342w\303\376\347\337\210\344\337>\377\325\337\b\345"
+	.ascii	"\337>\377\325\337\210\366\177\315\1776\377\365\376\343\375\337"
+	.ascii	"\373\337\346\377\233\377w\377\363\376\266\003\377\335\377\230"
+	.ascii	"\344oE\360\267\361\337\226\340oG\360\267,\3766\004\177K\202\277"
+	.ascii	"5\372\367\205\277M\372]$\177\013\364\267+\376V\205\277\365\300"
+	.ascii	"\357\202\3757\376"
+	.string	"H\366w\217\374n\221\337\035\362\273^\277\373\343w{\374n\327\357\346\370]\255\337\315\372]\254\337\265\372\335\252\337\235\361\273S\277+\365\273N\277\373\342w\343\337%\301\357\212\340wU\374.\b~7\305\357.\177\267\003\277\273\201\337%\361\273!~\367\303\357v\370]\016\277\033\302\357B\340w\035\360\273\031~7\203\337=\300\357\026\340w\007\360\273\002\370]\n~\227\347w\221\277+\374\335\375\267}\177\273\367\267m\376\366\356o\353\376\026\315\337\316\375-\230\277u\373[\266\277\325\362\267V\376\026\355o\305\376\366\310\337\016\371\333\037\177\333\343o\273\376v\307\337j\375-\326\337\326\370\333\252\277\235\372[\250\277u\372[\027\177\233\364\267G\177\353\201\277\255\300\337\232\360\267#\3766\304\337\222\360\267\035\3766\002\177\353\200\277\305\340o=\370[\006\374\355\002\376\366\203\277\355\371[\016\376v\203\277\325\340o\021\360\267\030\376V"
+	.ascii	"\177K\301\337\036\377\366\302\337Z\370[\235\277E\376m\361o\205"
+	.ascii	"\177;\374\333\366o\327\277\325\177\233\377\366\377\316\373\367"
+	.ascii	"\335\277\325\374;\315\277\247\377\256\3737\335\277\317\374{\356"
+	.ascii	"\337d\376-\367\3570\377\216\373\267\333\277\327\376\255\345\337"
+	.ascii	"X\376m\345\337T\376\235\366\357'\3776\373w\223\177K\377\275\344"
+	.ascii	"\337I\376-\366\357#\377\036\362\357\257\177\373\3707\327\277"
+	.ascii	"\267\376}\343\3376\376-\343\3371\376-\365o\247\177\277\370\367"
+	.ascii	"\322\277\221\376m\364\357\370\337$\370\267\b\376\275\342\337"
+	.ascii	"*\376\r\375\367\320\277S\374{\371o\016\374[\003\377\306\300\277"
+	.ascii	"O\370\367\211\177\227\3707\211\177\217\370w\210\177\177\370w"
+	.ascii	"\207\177\207\360o\b\374\333\001\377f\300\277\027\360\357\017"
+	.ascii	"\376\275\341\337\034\374;\001\377\316\340\337\030\374\333\202"
+	.ascii	"\177\033\340\337\004\370w\005\377\246\340\337\027\376m\341\337"
+	.ascii	":\377>\376\333\370\357\342\317\346\374\252\005\377v\377\265\306"
+	.ascii	"\257&\340_\251\376\275\377\275\376[\377/\341_\243\376\365\350"
+	.ascii	"g\307\374+\005\376\235\377\375?_\375l\337\257\226\370\325\023"
+	.ascii	"~\325\375\325\342\257\352\237}\363\253\030~\026\356\177\331\177"
+	.ascii	"\263\237\325\373Y\274\237m\363\263w?k\346g\311\374l\230\237\375"
+	.ascii	"\362\263]~\226\355_\215\374l\332\317N\371\331\261\237u\362\263"
+	.ascii	"O~\026\312\317\236\375,\220\237\375\372Y\257\237\355\361\263"
+	.ascii	"Y\177\206\372\331\035?\313\365\263<~\266\353ge\374,\325\317\316"
+	.ascii	"\370Y\250\237\225\372\331\250\237%\301\317\216\340gC\360\263"
+	.ascii	"\320\237}\376\354\320\317:\1776\350\317[?\373\201\237\005\372"
+	.ascii	"\331\237\237}\177\225\353gQ\374,\n?\273\301\317v\340g5\360\263"
+	.ascii	"'\374\254\211\237-\341g'\360\263 ~\326\303\317\206\360\263\016"
+	.ascii	"\370Y\020~\326\203\237\355\371Y\016~6\303\317f\360\277\356g\021"
+	.ascii	"\360\353#\377\343~\326\202\237-\300\377\023?[\301\377\346\257"
+	.ascii	"\356\370Y\n~v\202\237\275\360\347\027?\313\363\263\026~v\347"
+	.ascii	"gu\376U\313\277b\371\365\t\377j\345_\253\374\253\215\177\245"
+	.ascii	"\361\257U\377:\343_\245\376\217\370\327\026\377\232"
+	.ascii	"\364\257H\377\n\375\327\347\2776\377u\371\257(\374k\t\377*\342"
+	.ascii	"_\001\360\257;?P\312\017,\373\2018~\240\322\017\324\300\017\304"
+	.ascii	"\340\007\002\340\327l\376_\b\376\037\374\377\230\177\036\363"
+	.ascii	"g\260?c\3759\352\317O\177\206\361\347\245?+\375\271\305\237O"
+	.ascii	"\370\263\211?\237\370U\243_}\376\252\211_\275\300\257\236\370"
+	.ascii	"U\344\257\036\177\025\347W\327_U\377\363\375\347\362\177\355"
+	.ascii	"\377\226\377Z\376;\371o\342W\341\377m\377\031\320\327\327\327"
+	.ascii	"\367_"
+	.string	"\240\177\021\342~7\240\372%\316\\\250R\342\013b\013\342\013\242\022q\t\303Q\034\033]\005\2432\330\340\341\251FB\340\256\264&.\375Y/\357\251h\252\324\026\255\257\254_B\311~\t\255\375\022T\373%\214\210FE\035Q\260\247\254_\0012\304X\225\022\213\206}\304\242,\346#\312n\231E\241i\375\n\244\355W\300l\357\265EsmK\262~\005x\354o`#\026u3\304\033\213\346\r\365T\351\320\315\260\315z%\3076f\325\257\300\215\375\n\034\355\223x\263O\302n\253\321lt\311\227\231\254O\202m\017\323\f\247f_\323\241\235*\035\246\031\326e6)stZ\237\304\225}\022b\373$\210\234\211\362\306G]\326'\0015,3$3\234\033\216Q\245C3C1qA)\271\340\f\031l\360\360\206f\206`\242D\315\f\303\250f\030\\\304\261\326U\020J\006\033\274\037\035\22140\\}\022-\366M"
+	.string	"\263o\002\227}\023\244\354\233"
+	.ascii	"\266o\202\216\355E\003\305\232T\335\310\372&\264\330\337\300"
+	.ascii	"E\235\352p\213\016\335\206m\3010\031l\360\272\f\337T\351\320"
+	.ascii	"m\3106|3\305\223Z\365K\240\262_B\220\375\022r\354\2270c\377\303"
+	.ascii	"-Z\324)sJQ-S\366\f\264\027K\262\f\261\020\217\276\362\314\260"
+	.ascii	"\250fq\036\033\247+\231\253OJ\212\225\247\025\221\360\364\334"
+	.ascii	"d\375\r\3034\240t(\005\303\321\222V\342&\337\310\213\216]\251"
+	.ascii	"f{\321\241\332\020mHeXE\225\016\323\206S\276\306\255a~H\303\264"
+	.ascii	"!\226j\366\001\233'5I\232:0W\277\204\247\035\205\215K\326\215"
+	.ascii	"\254_B\322\0362\001J\267\023\251\003L\311\240c\2037d-\332&\303"
+	.ascii	"\3100\t\206\243%\020w^\246C&C\"j\323!\223a\221\007\bI\313\342"
+	.ascii	"1\354\352\022u2T2l2\\2|2\224\016\311\206gC\263a\331\020\212*"
+	.ascii	"\0352\031\342\370\017ixc+\b\21056!\303/.\321\254\036\303/\fG"
+	.ascii	"K \264\270M\207L\206Y\303.\255\2361\031tl\360\342\230\314\255"
+	.ascii	"2Z\243\343\321b\303\261\2600Pfl\262\376\b'ba\303'm5\214\220|"
+	.ascii	"\030\306\246\305^\224\254\207`?/ov\030\035\371\337\016\225D\307"
+	.ascii	"h9\362\345\364\265&\353\217\030\333\037\341\265?B\307\376\b\253"
+	.ascii	"\375\0211\366G\300\330\037\2014\364\372!$I\226\214\254/\202\315"
+	.ascii	"\020\310\360\307\356\241\345\303\307\320\307\207?08\371\020\023"
+	.ascii	"\201f_\204\230!\227\020\306\322\236\233\254/B\313p\307PG&\262"
+	.ascii	"\246\n\3300\307\207:\262\0324\\t\303-\227\215T\227\233\341\326"
+	.ascii	"PK5\363%\f\336Pk\210C}bdt\224\365EL\331\027a\266[\021E\366Et"
+	.ascii	"\355\177h5\264\261\301\025 ;v|h\343jbjL\331Q#\003QQU\245\204"
+	.ascii	"F\225\322\2152/Y\017\253\256\226\267\2135o\362\250\2063\334\314"
+	.ascii	"\345H2\224\241J\2073\206S\303\031\271J\005\233\3222\0026\224"
+	.ascii	"\"\241\312\242\365Eh\355\177\030c(%\205K\315K\326C\251a\324]"
+	.ascii	"\221\"\262\254\241\366\027\031\027kY_\304\324\376?|1t\0322\r"
+	.ascii	"\233\2060T\351\360i\270\324\005\215\233\262\271\272h\031\274"
+	.ascii	"\350\317\314\325\210H\306\030\206\022]t\3704t\221\200>!b\321"
+	.ascii	"4Va\336\204\372\"\240\366E\030\355\177\250\224\217d\263\027F"
+	.ascii	"T-\206E}\323\255%\303\244!\022\331Z\334\224\254\207GRQX\326\262"
+	.ascii	">\005\350\366\260H\210\247N\211Qdq\024+\205o\030\013\337\b\371"
+	.ascii	"\204}C#U:,\022\272\021\352\251d\361\322\331\336\013\2457\274"
+	.ascii	"6}\321=6@\226\224\336\360\206E\30259\t\210\013\2457\033Z\276"
+	.ascii	"\272\204\372\024\310"
+	.string	"\373[\267K\033\032\321\254O\201*\373\024H\262O\001 \373\024\320\332\247\300\324>\005\216\366/\274\373q-\221\341\250H_S\230\250\261\343j\273\"%\315\205vW\3154\230\222\313Z8\355\2710M\376:kk\313zX'<\343j\271M1\312\3217\341\231\326H\013fFH'\234\023\242Q\245\3023\3022\327\033\204g\204r\3021*\\\227\2101/S\341\031!\231\214E4\"\213\213\3240\031F\334\300\202A\220\300\244\271\372\023\b\333\237\300\327\026\216Q\303\020\203t\271\322\222\365'\320c\377B1a\206\356\222\314\305]\030\206\013\00545\224\364\310Z\b\246\347\3028\"\222\242+\257\254)\020~\021r\031\342\304\215\352J\215,{V\254\246T\272\326`\251\342\"\324\302$\344\"\2542&C\b\025\260.B6\341\233\020N\350&\364\"lS\245B.\302-\027\256\251c~l\226X\231\032\265\253\"\327O"
+	.ascii	"i?D\337~\b7\373!\326\354\207\250\333\0171f?\204\227\375\020k"
+	.ascii	"\373\027\252\t\323\204iB\264)A5\034J]\262\226\342Ek\211*\353"
+	.ascii	"\207(\3332\256\272\b\235\bo\b{\374\244P%\266\332\246^B'B!\302"
+	.ascii	"!?)\324\004\266\244\310\300r\2132\021F\021>\021B\021J\205I\204"
+	.ascii	"fB2a\231p\211P\211\360L8&l\242J\205N\204`\027\"\021\206m\001"
+	.ascii	"Y\233~\245M\217@\221!\266\365&t\"\364\341\2456\215\242E\205N"
+	.ascii	"\204"
+	.string	"A\246L\267\234\b\177p\231\n\235\b\213\b\215`p1\345\024\363\b\227x=)\013\200~\b\256\275\221T\344\372\0201\366C\024m\241\221?{\t\211\270dGskY\037D\336\326\261\252\263\n\207\260k\231\217\251\214\227\254\017\242\314>\210+\373 \222\354\203\320\261\017\242i\377\303\233\375\017`\366?\250m\036sR8\033Y\377\303\220}u,kl*\304!6F\250C\270\225d\272C\330%\344\022\346P\245B\035B-\241\216v\275s\262\303ji\314mQ\271\372\037\276\366?\304\330\377\320\264\377\301\305\376\207x\237\0046\373$p\261\2521\314Q\305\310[\326\337 \254!\254R\247Q\f\300\233R\203\207'\264\241J\2055\2044\206[Y.\242h}\022~\354\223`\265\177!\225\360+\313\330\213\254\377\213\201%\257\f\334\226\266.Y\334h\301\023C\205/\312Em\354K\027\2671j\323\266\237\227\nW\365"
+	.ascii	"03S\"U\336D\257\350\215\361\242\206\361\022-\213k\233\2169\023"
+	.ascii	"\005/\330't\022B\t]\004\333\b\227\2043\204R\302(\341T\360N\370"
+	.ascii	"\024T#|!d\022\306\b\256\021*\te\b\233\202n\204-\202{\302#a\221"
+	.ascii	"\020F\360MP/\230'4\022&\005\371\202l\204\261*\025\"\005\247\017"
+	.ascii	"\246\t\332\211\341\"\306\f\360\211\024\2715!R\260n\211\020)\230"
+	.ascii	"\2664E\003\245\215\214\212\2266\r\3036-\203\326e\016\370d\n\030"
+	.ascii	"\267i\0204\027V\366\242t*\332\331T\210\024|[#\"D\n\262\251kS"
+	.ascii	"vQ\2608&\343\311\200\210f\316\356\016\204\376\221\251:+\b*r\375"
+	.ascii	"\bo\366Gh\263?\202\230\375\021\256\354"
+	.string	"\217p\266?\002\327\376\bN\373\036\366\366=\300\355{\270\262\357\341l\337\303\330\276\007#\373\036\200\354{\310\261\357!j\277\003\336~\2073\373\035\340\366;P\331\357\020\266\337\301k\277\203\325\276\b}\373\"x\331\027\201\311\276\b=\366Eh\332\347`f\237C\225}\016M\3669\f\331\347\220c\237\303\324\276\004\334\354K"
+	.ascii	"n\377\301)A)R\324\222T\005\241"
+	.string	"\004\243\250\322\240\224\340\031\331\223\252hPJ\320\211\020';,0\241X\222,/V}\tT\331\227\200\330\276\004x\354?hv\245\210\021V\326\377\240\210\031!tk\206\240\tRGd\203\021\025mN,8\026\f\013&\tJ\203M\202L\202d\301\262\340\022U\032T\022<\362 X\020I\024o\252$\350\345\362\251p] \330\344\005\225\004\267\202@T\270.\375\2467\215\241$\370\005|b7\245e\004/\216\311\200Gcg\300\354h5\252\352\254;*r}\bz\373!\240\331\017\001n?\004,\373!\230\355\207Pd?\204\035\373!\324\330\017\241i?\204\244\037\277$]\272\004\311\372\021P\263\377\007{\004y\250\322\240\217`\216\007\271z\320\005}\270]2\226\n\327\245\303\312\254C\324\250E\255\372\252\2273\321\035\301\256\240\016U\032\344B\023\3442:\200\226'6ax\031<\225\350\320\333\372\021\020\333\217"
+	.string	"\327\376\203ZA\2534{HHY_\035\003\243\314\024\352\311\351-\n\370\244-X\025\254\021\304\021\244\n\332\bb\005o\004\263\202W\301\031A\032\2524h\025\234zP\206\332\226\251\232\272\274"
+	.string	">\331\020\203K\324\005\360\211\231i\320*\310D&h\025\224\372\200\310\223\035\026^\034\223\001\263\206D\265\340\321D\025\271\036\002k\366!@f\037\002k\373\020\220\262\017\001\261}\b\364\330\207\200\325>\004^\354?@o\377\001u\373\017"
+	.string	"\263\377"
+	.string	",\373\017.\2519\013\343\224\365\325.\301$\327\315E\363#\243\262\323\266\260\246\301$\227\316\345\303\220\024\3079\304\3260&\261=\274\240R\260E\360(h\024DR\245\301\244`\321\224`R0&\002L\003\306$\266\207\027LrW#Lb{`\303..hV\204\372\017P\262\377\200!\373\017\330\361\346,J\213\254\260\254\377"
+	.string	"\250<WO\225\272{n]\227\fD\205\353\002\021\3266u\367\\8\327\215\n\327\005\202\317m\252\213\254Y\262f\325xY\370\002/I\326w"
+	.ascii	"\233\375\337e\343\336\271k\\5\252\324m\343\2469\263S\363\022"
+	.ascii	"\207\026\235\346\253\264h\033\367K\276\372\240\352I\311\324\205"
+	.ascii	"\026V\032W\337\001M\366\035\300\265\357\200\255}\0074\355; \351"
+	.ascii	"\314\005a\233\\\2248\3537 \315\236s\313\250R\327\214\353\005"
+	.ascii	"\316%\363#\243\262\325\266\232\246\256\031\267\213\373\266\305"
+	.ascii	"\024u\355z\324X\365\030\256\254\"7\262~\003\270\354\253^\342"
+	.ascii	"\226\242\256\234\033F\225\272b\\0\256\030\367\213\312\307$\266"
+	.ascii	"\007\226\301\317MY\227\351\252\337\200+\373\rX\262\337\200\260"
+	.ascii	"\375\006\f\331o\300\r\367\355J\315\212\343\262\030pehd\375\006"
+	.ascii	"\330\330o\300\322v\323\244TA\302\226\3657\034\311W:\350\246b"
+	.ascii	"sS#uH\314\316l c\371\334>\360Ac\b\021\365\314\253i\314\214L\221"
+	.ascii	"\274\351\231\213\305\215\3422q\253\270h.\024w\212\353\304\275"
+	.ascii	"\342Zq\325\3345\227\315-s\267\270"
+	.string	"O\\..\025\267\211k\346fq\245\270ZT\251\233\346J\273|)\301\210\216\005Y\232.i\213\376\250\232F\237\274\230\366\340\2521&\314\314\214z&$_\361)i\003C\023u\323\334$^\246\352Y\232\013\204\2105\224\312\340\241C\203>\003\364\366\031\300\266\317\200\263}\006\214\3553\240k\237\001S\373 \364\355\203 \267\017B\225}\020\300\366A\350\332\007\241\306>\b0\366\027\260\267\277\200\271\375\005l\331_\300\222\375\005\364\330_\200\214}\005\360\355+`\272\257\200.\373\np\262\257\200\034\373wy\270]A31\037b\\.w\207\233\303\325\341n\251R\267\313\325\272rs\262\303\302\303B\223e\346\306\031\267\313\305\201\305\311\016\013\214\215bd\f\016\241\376\007w\373\037\230\331\377\340m\377\203)\373\037\034\331\377@k\377\256\225k\243/\372U#\353\032\301\"K\3028\311\372\0378\355op\223\334\020q]"
+	.ascii	"\353\210E\306\030\351\350\311\3507\204\370\213c\243\275\350\336"
+	.ascii	"\213h\3147\355q\237Z\276\245\251\373\344\026\375\206\250pU:\354"
+	.ascii	"\3154\216c\367\251\315k\365~dT>4\201\321\366\365E\217\364\334"
+	.ascii	"*\367\205\333\344:\271R\356\f\027\206;\345F\2712\334\030.\225"
+	.ascii	"\013\3452\2714T\251\373\344\266\270\253\344.=\273a\232\272OM"
+	.ascii	"\\\244\274\250\213(\021\367\251\305\263r\032\223\305\365\344"
+	.ascii	"G\005\372\036x\3319\252\352\254\026\250\310\365\036H\331\367"
+	.ascii	"\240\311\276\007a\373\036|\355{\300\265\357A\326\276\0075\366"
+	.ascii	"=\210\332\367\300h\177\003\335\376\206-zj\030\265x\007$\357G"
+	.ascii	"\326\3370e\177C\331\376\206!\373o\333\2643\230\264\260\221u\216"
+	.ascii	"\276\305H\302\334\246eZ1\355\\\313\245\325\322\222i\335Z\270"
+	.ascii	"V\256}k\307\264f\332,\255\2276\256]\323~i\317\264k-]\333\245"
+	.ascii	"mk\325\264lm\230v\332\202i\267\264l\3324\255]\213\246\255S\245"
+	.ascii	"\355]k\345\355\225\026K\353\243\005\262\346\215Q\001\3425m\203"
+	.ascii	"\334\375\244P\023h\022\0064\263ji\372\232\302\023#\307V5}M\341"
+	.ascii	"\265U\324)\326\272\006&\216\205\373I\241J\330Z\233\306q\334\004"
+	.ascii	"\305\3620\372\301j\211\3277q\037\037\323\264\250\275c\221X\245"
+	.ascii	"$\354\035\023\232)[\304\276`\337\3267k\237\013\325\3645\005\326"
+	.ascii	"z\265Q6dF\300\2244}M\265wm\2236\255k\265\213\221|1\342\302H{"
+	.ascii	"\307\036ay\374\244P\0248\"3\205A7\035\303\316\261Ryo\311\256"
+	.ascii	"\351k\n\257\365\361\366\256\375\321\3660\352\261\362\265^_xM"
+	.ascii	"_SE\355\035k\304\356\201\t\203\325\3645\245\236\265w\255\332"
+	.ascii	":m\372\232\302c\213\332;\366HEk\372\232\302c\233\332;\266\007"
+	.ascii	"[\004K\323\327\024\njtE\036\364\325\220\251:+\021LE\256\337\360"
+	.ascii	"c\177\303\325\376\006\247\375\rIhC\252(j\336\344Ai\245\264Q\332"
+	.ascii	"3U\332Ni\237\274\225\266L\256\313\334\242f\352\264m\3323\245"
+	.ascii	"\035\322\222\251"
+	.string	"pg\032K\227vJ\353D\235\262E\203n\222P\251q\3655\324\355k\230\333\327 f_\203\333\276\206*\333\b\247\352\254\231\251-\362\226\354g\355Z!\355\222,\027\217I\312Z\t\033F%o/\353k(\023k\307Ti\233\244E\222\2445\322\202\251pg\036\306\320\246m\2226\314\312iH\025\336\357\212\027\253\270U_C\326\276\206\030\355\021\241\321\214\264/Y_\303\213}\rG\273%\322\363\266\b\237\033\030gY\027\365\266\261n\277'n\353\036)\373=K\266&S\221+\017M&F\021'Y\277G\310\376\337r\265;Ti\333\325\2728K\206-s\236\266\253}\321\352\370I\241(\020wc\332v\261\323v\t\204\026P\037\342\260\246Y\311S\034\220U\347`\033\303t\225\365{\262v\233\325\336\250\021\315j\233Z+\032\3236\253\275\002\026\255\321\246\257)\260v\253\325jq\250\3226\253\305:{\206EC"
+	.ascii	"*Q\262\255\337\003\265\337\001\337~\007y\255\325\337\302h\231"
+	.string	"Z\0339\253mI\025\225\254k\354\035\251\t\222\365;\260\333\337\020e\203\n\324\2138\246\030N\266\232\246cO-U;\325\316h\253Z\032\252\264\225\321J\2652Z')k\025\223\221;\274\fX,0kT\204\372\035\320\355w \267\337\201\227\375\016\326\366;\250\262\337A\224\375\016\234\354\037\234\252\263>@E\256\357 l\277\003 {M\261\216\314U\216\254\331;v\r\213\307\3621\205\t\301\373!9\001\347\260\230\302\204\340\271\330\323\2332\361\271\231\252q1\275\333mV(+\225\237\024\252\004\035KS\2757y\3218&\273\313c\361\306\342}\344e\272\333"
+	.string	"\245\333\211\021\017\266F\314\332\261LSk\233\253\375\244P;-\342\322\266\213\335f\277`\2150\205\t\001c\323 m\245\270\267i\020-\373m\t;\203)L\310\334\316\333o\332\243\326\250U\332f6\2336n\223\332\242\026i\333\355\276\355fO\367\231\255\267\321\354\273\235\246m\261\3676\337\246\333x[\315^\263\353T\351n\003Ts\226\216\255\273c\335"
+	.string	"\237\260yLaB\360\2506\2318(\233i7mqi\263:\35581v\212\325\003\342\261}=\330\351\2275n\267\311Q\340\334O\nEB\334\032\253\327f/\001\367~R\250-\345\250\313t\267\331Z2\365\332Ov\026\020Z@\2650\342\246l\027\273\315\206\221\261~dT>l\261M\267\2136\3007+\f\f.X\366\256\r\353BE\343c\315\3546\273\214\212v\345V\2514\232\244Y\362"
+	.ascii	"\375\016p\3541\317\"t8\262~\0070\344\266\230\036\3232\321\254"
+	.ascii	"\267\230\"3R\306|\331`\340\332\"2\240\234Y\363\005\256\225\033"
+	.ascii	"Kc\343\345\033\356\267\006k\007\020.K\252d\250e\275\273\250D"
+	.ascii	"\3648h\333n\273\215Er\303\344m\263}\267\251btqm\262\336k\233"
+	.ascii	"\313\216>\025%q\001\336\025\327\332\370jli\323\210\361\322\265"
+	.ascii	"EG\2204\261\254\317\001\332\226\362{\202\204d_Q\245\033\313>"
+	.ascii	"\343\331X6\224me\013\0015\232\364\260\bc\027n\252h\375o+\273"
+	.ascii	"\212\223\323t)\353M\245u\233\222\301%\353s\200\265\377\235\246"
+	.ascii	"J\267\032\035\0068\206He\3755\033\355\177\233\271\304\324\345"
+	.ascii	"e\275\247@\305Ohd-\205\245\213\002\303$\353s\300\264\243\354"
+	.ascii	"\263\214\303(LT\326\347\300\305~\2066\373\031\354\266\331\232"
+	.ascii	"E%\306\224\3653\310\355\032\233\006R\223\264\350\324\246\001"
+	.ascii	"\204\305j\252\203\302#\262\221`!\333c;\311^\262\233\354\262\255"
+	.ascii	"d3Q\245[\272\303\236\273\366\323\226n1/\323 [\272c\260F\232\352"
+	.ascii	"\240\360\244\333\306\036B\265\3625\325A\341I\355(,*\322\r\265"
+	.ascii	"\243\274\330\260\241]\216\351\220\243~\006\266\375\fi\373\337"
+	.ascii	"H\276\301H\250\273R\313\372\210\013\245i\2114\353g`\262\267\221"
+	.ascii	"]d"
+	.string	"\356EL\227\3653\030\331\317 $\272\205\354 \252t\0179\216\275\265\207l\035\333K\205\2532\306\361\026Xt\017\331V;+N\3114\216\343\013\031d\220\301o*\254\313\315\326^{GN\342\261\2765\325A}\355\037\033\210*\335^\333\007\322\366\332=`4\0012\365\332\\\233G\217\325\255\251\016\n/\207\261:sf\353g\340\261\237ak_\225\036\315\356:\235\366\3416#I\326\317\200\265\237\201j?\003\214\375\fJ\373\033\366\326\276\312\241J\367\326\326\372\3110\263\242\245\3657\340\333\337 \357\206*\335Y\033\353\032>\030\333Y\373\n\310\232\327T\007\245\2421S\004K\353o`e\177\203(\373\033H\36778\262\277At\357\252\252&-dY\177\203\254\275gl\031Gc\203H\245i\f\037\336\246R\245{\306yx2\231\25310Z?\001y\373\tP\263\237\2003\373\t\220\333\377\216\352\302t\224\365\023"
+	.ascii	"\267\201\t\330\262\237\200\262\255F\023\200d?\001@\266\232\200"
+	.ascii	"\255\244\335\342G\226\306\005L\326O\200\214\244\004\270\330F"
+	.ascii	"\301-1P\242z\273\250n\303\021\203Jj[R\262\276\006_\3665\300\262"
+	.ascii	"\257\201t\253\032\004\331\327`\213\r\333\246\b\347\245%-\353"
+	.ascii	"k0\305F\003\245\255\302\261\33196\263\237A\334\306\251R\221\253"
+	.ascii	"\236\242\"\327\f\265e\357\220\251:k&\243\"W6\032e\273PE\3663"
+	.ascii	"\340\332nV\024\234\227\234\245\246\266\004*\3537\035\034\243"
+	.ascii	"\265%)\353#\340\315f\331X'l\227\nw\246\327\360\246,\033\373\204"
+	.ascii	"E\313Q\307\262\261b\254\231\221\033.l\033\333\205uS\245,\033"
+	.ascii	"\233\306\262\261j\354\232\220\003\3345}M\341]\310@h\204\214Y"
+	.ascii	"\223\253\267h\340R4\332&\353#@\313\276\332e\t\333\030\025.\321"
+	.ascii	"\2615+jZ\330,,\026\366\212*e\255\260U\202I\310\274lq\365\021"
+	.ascii	"\020e\037\001M\366\021@d\037\001Y{\212\005\306(\241\312\372\b"
+	.ascii	"\230Z\222$\n\205M2&\205\215\242JY(\354Y\213\004\007X\213U\037"
+	.ascii	"\001K\373\030\270\331\307`\314.\013\2720C\365\226\3651h\333W"
+	.ascii	"\313\306\242D\223@\211\222\261K\244L\245l\023\226\211*e\311X"
+	.ascii	"%\232\247M\003\266\324c\353c\300e\037\003\264}\f\236\354c@\266"
+	.ascii	"\217A\220}\f\264v\020\003\247}\f\212\2660KE\256,\221\366I\223"
+	.ascii	"\034_\326\277`\312\016a\205\004\213\250QC\205"
+	.string	"\rrV\310\325\206co1\226\262f}\260\321\377m\321\310\314\033\031l\224\375bSV\025\226\265W\360\310\230\225\251\254\177\301\230\315\002a\177\b\225xh1\222\365/x\333_s\265\377\255Z$\rI\224\254\177A\224\355\304>\261]\277\037Qq^\262\346\"\222Aya\223\365/\020\333Th\246StQv\213\315b\261X-V\007{\305\342`w\260V\354\rU\312\346`k\020\261Q7\026C\t]\317\f4\321\2507\272)\r#h\244\324\250\026:\031W#\266q\274&F\205\315\301V]M\205;\213\223\244\020`c\312\343+\242\035\341B\332\321\277\240j\377\002\027\373\027\264\330\277\340h\377\202x\337\2027\373\026\344\355[\320f\337\202\273}\013\322\354[@\267o\301\227\315\222\251:\353\361T\344:\264\240\312\276\005O\366-@\262o\301\215}\013^\260-X70\302|\311\372\007\260c\223\016\020f\377"
+	.string	"[\366\017\200\266\211\007h\262\177\200!\373\007\320\332\304\350\272\267\352\271\321X\rn\315[\335\250\322Uo\305+c\223\257jDW\275\265M\276Z\2050\315Um\240\355\214\233U\337"
+	.string	"f\366\r f\337"
+	.string	"o\373_\327\254wIcvd\262VC\206\004c\206\336\233\254o"
+	.string	"\263\375\017\314\214E\317\210E\353V\2735\215*]\247+\032\244\351J\247\242]\255yLqXAe^8\266\276\001\244\366\013\340f\277"
+	.string	"u\373\005\370\262\377uN.\212\314\235\233\254W9\240\231\272\350*\007\224\256_0\034-\305q\024\003\334\230\304\366~H\253\034\260LN:\200\035\223\330\336\230U\314Zf%\243JW\271\025\314\327\2705\314*\227\277\200s*\334Y\034Gm0e\022\333\303\213\343x\350ez\005\206\253\335X\325Y\325,\025\271\276"
+	.ascii	"`\033\016xU\344MM\326/\300\327\276\352e\335\2622e,\fIqlt\345"
+	.ascii	"*a\n\023\202\327\205\207%\310J\265Z\205\271`LaB\360\200t\300"
+	.ascii	":\fGq\234u\345\272y\275Ya\374\244P\255\223Y\327t\275\272\032"
+	.ascii	"\006\027q\274f\3035\302\024&\004\257k"
+	.ascii	"\013\320\016\330\246\313\325\302\024&\004o\013\320\rp\017\203"
+	.ascii	"\2138\326\372\341Za\n\023\202Weu[\255\254ZV.\353\333\272\266"
+	.ascii	"\266\255^\326++\226\265\313\312\266fQ\245\353\226\365\351\300"
+	.ascii	"3@4\347I\223\2230\034\3051\026\rwm\313\232\265\236\201\320\002"
+	.ascii	"\212\002:hL\203lY\235\326\031 \264\200j\235\314\256\246^[\326"
+	.ascii	"&5\f\206\2448\316\302r\307\230\302\204\340m\255[\200\323"
+	.string	"\037\227\031\220\351\326\226\025\312J\005\211\373\306\024&d\210'\026\353\b\200V#\222D\2005h\252tM[\243\254i\253\224u\n\006\027qld\203\235b2r\207\247\332h;\362\242\365:\345\300\271L\245\214T\221\254O\200\265}\002\224\355\023\240\310^\237\\(\346\3402\022\223\365\t\240c\343Xs\374\310\242$\0349M\233\254N\3262U\272\232}5[u\254H@h\001e\302Q\323t5[\231\334\355G\026$\216sX\2557\230\276\260\\\310 \003\355\244\213\313\215\255?\200\271\375L\025\344\202\n\327%\001!R\312\214 \231\256H\326\035k\024\303\321\222\210\265)\323!\317Bl\343X\353\254H\030\021\fT\2703\017T\306\246qL\266\"Y\217<\213\027X\331\212d\025rA\205\353\212\215\212\016 \203\311\307\033\336\272d\225\256a\253\222ulM\262\222\255b\252tE\262\202\235\007\350\304\fO\357\250?"
+	.string	"\035\373\003\300\332\037\300\214\375\0018\355\017 i\277\002\276\375\n\330\354Wp\346\213'\027\325\201y\312\372\025\264\355\377\353\217\025\210*]\275\326.\256\265\007\261\b'\216s\240Y\275V\037k\017\fGK\261Q\216\r\2720mI\375\322\314\334\231\255\372\025\324\330\377\332\203G\220/\311\025\037\217\265\213\250\344\213)G\326\257\300h_"
+	.string	"z\373\002\270\333\027"
+	.string	"\232\375\257[_s\374+\326z\003\b\305E\233R\326\253V\317\327\255\244.&\251\254/\220\333\027\300\227\235\311T\235\025\003\025\271^"
+	.string	"Zj\2546hl b\254\260Hk\320\210;\213\311d\275\3228\335:W\244%/l\225\021coF\225\257\254/"
+	.string	"\035\373\252t\235Zc\240\021q1%\3535FN\022b\020\346\271\275Me\3755k\324\377\226(\247D\355J\326\377\032\265B\021\233\300\304Z+\324\372\324\262!\363F,\353\013\300j_"
+	.string	"2\366\005\340\264/"
+	.string	"\245\375\202\247\030\343\352\311R\326\017\200\335\376\006 \337Z\364\223B\355(\\_\323Uiu\241J\327\245\325h]Z\217\326\026*\334Yl\024\303"
+	.string	"m\216\330D\361\242\340\351\315X\365\232T\204\001D\311\007\221\025\211\307~"
+	.string	"\246\372\3268K\231\365\b\300R_"
+	.ascii	"\212\366)\240\003\352\305\261\311s\221\365)\360\002\314\243@"
+	.ascii	"\313>\005S\332\2609#\253\262\224\365\232\337\027\"6\266d}\n\230"
+	.ascii	"\354\377\252\024x\007T\023\363"
+	.string	"\254auGPY\237\002\260}\n\206\354S\260c\237\002\032\033Xw\025\r\205\330\002\016\033\324\215\254O\201\324\336d\252\316\252.\251\310\365\024$\001\347\256\226\263\2274XxY\037\203\0312rl_\230\314eMD\016\030\2667\035\003\024\003\f\003\374\002\214\003\202Q\245@9 \\&\213c$\"bzcyQ%xS\240\034P\n\364\242\302ui\267\272\251z\006\224\003&q\223w\344\bQ\037C\227\375\346\"\205\335\370\222\3651L\331\337\320\244\214\024\26722W\200Y\200]\200m@.@,@-@7\340\032p\013\320\212*\005\262\001\325\016\\\002$3\003\236\021\177q\234\303Kt\315\224\266\0364\266\275(]\3243&sl@(l@*\300**\\\025\21003=@6`Z\21486<\036\315tc\210\022\217\256\242\242\261C\372\234\354\262>\206\033\373\030\234\3661\024\355\003`\272\017\200\267}"
+	.string	"\250\355\003@\272\017\200\257\r<{\202\302\256Bb\232\2215\320\211\236\321E\207W\326\007"
+	.string	"\327>"
+	.ascii	"\262\366\001\340b\177\0027\373\023\200\331\237\340m\253TT\235"
+	.ascii	"u\002\025\271~\202'\373\023\210\355O\360\265?A\216\375\td\354"
+	.ascii	"\037\210$\210^\230]\326\337\340\303-\252c.\232E\027\345\"\263"
+	.ascii	"\267\243L\227\227(\2177\240\021\340\0270\n\004\002<\002$\002"
+	.ascii	",\002\034\002\024\002\364\002\202\251R`\020\340\017\365\307\244"
+	.ascii	"u\006\207\212F\374\3051\026\032`\020`\217.\323\036`\020\340\026"
+	.ascii	"0\007\261\210,.Z\321\206|\331\341e\300\306\341\220\253\343\321"
+	.ascii	"\2770\267\177\201m\377\302\331\376\205$\373\027\200\354_\240"
+	.ascii	"\332\277\340b\237\307n\347\370\217k]B\322\"\002f\237'l\215\033"
+	.ascii	"tS.\244\244\332\364\300\303\313\331S\225\314\320\343\003\033"
+	.ascii	"\362\270c\252\242\367\234\275#\226\242\036Y\347\344\345p\311"
+	.ascii	"Oc\264\204d\235\343\246(\206\b\343F\226\267\0210\251Q\223\303"
+	.ascii	"\346\302\024K\311\032^\260\305\025R\2225\317a\243\204uV$\353"
+	.ascii	"\234;\025m\3639\321@\312\372kr\322\013\251+Xyd\2363G&'\315ON"
+	.ascii	"%\213\253\262\212\3220@O\nC\372\005\315s\322<g\252\341\203\243"
+	.ascii	"\0013\"g\224uN]\016]\316\231\243\311D\3200\245\311:\307\314\263"
+	.ascii	"\b\253\306\340q\225i\255`\351\320\312\372l\0249\033\321\254/"
+	.ascii	"\00259r9r\306'\261,5c-\220n\200\361\342%'\214\253\205\311\310"
+	.ascii	"\335pN\313\005\226\270\347\204\231\341BK+\353\0340\303#E92E\202"
+	.ascii	"d\235\363ex\244\253\207\225\221\254s\340D\200\245K\027\343\327"
+	.ascii	"\035\226\2225)Gj\214\311\372\"Pb\345Vr\332x\262\212\322\034\200"
+	.ascii	"\312\f=>\242\2138);r\330\236\323\226\207x\331\361\224u\216\226"
+	.ascii	"\034.2\270\264\356r\270\344\254Y5\301A\206\215\354k\355L\326"
+	.ascii	"9[\212Y\216\320\2249\311:'\213jf\305\256hF\3269XT3\246\246+p"
+	.ascii	"Y\347\\Q\315\326'2\273\251\brH\221\222CE"
+	.string	"\265\303R\262\006\226a\b)\302\244\366\034*\3023Ti\256\262\316\231\222\223v3]\320\322\3206\220\201\022\235\213\342e\215\b\232\240@\311\361\222\372\245]Y\363%\353\207\200\215\231Y\316\023\325\213\025\261(\230\313\244\264\225\347\3449O\324\242$\351[\013\201\227\234&9M\240\324\214=9\341\341%\353\207 -G\232#=B\021\003\303\007Fv\367\324$\353\207\300H\316\222\234%\3106I\254\360\201\025\305\370!\226\365C\220#'IN\222#\224\032\304\031\352\230\0237o\262~\b\254r\242\317\031\222\023\315\021+.Y\255QA$sF\260\030y\216\330s\3024|\360,S\310D\273\262\316Ar\225\207\032'KY?\007\254\rrf\n_\3269G6\270\312\303\261\227uN\221\327\261U\301\263\221u\016\221\327\r\247H\273\254\220S~o[qGY\347\b\311\t\022\002\031?~\344x\361\360\3550(K\252"
+	.ascii	"y\216\227\231.k\254\360\t\331\b\331\344\364\340\301Z\3358\002"
+	.ascii	"Ut\312\301v\224\323#\207\207\333\233\333[\3269]&\b1\262\002\225"
+	.ascii	"\034\256\034\0359:\202lXqy`\332M\221\246\265\254\277\302X\316"
+	.ascii	"V\316\226\361\211'\253hM\320\r+.o/\255\211.\353\257\260\205\003"
+	.ascii	"\207\361\013\017K\311\032XF\3722\304)\353\257\360t\343FN\325"
+	.ascii	"X\264E\233).Y\237\305]N\215\234\0329WI\242.Y\220'4V\317\271\332"
+	.ascii	"O\336\360\206d\235cco\321[\332\252\304[rd"
+	.ascii	"\344\310\310\251\2720\005\264!\345B&\207\3529Ut\302\266\243\252"
+	.ascii	"\242\254sf\f\217\264l\204\334\361\22199\345\304P\335d\030q\323"
+	.ascii	"kg\302zH='\206\306\261\004#/'j(#\307\22769Q9PM^Je\3051t_\206"
+	.ascii	"\310\310y\022\226\301\261\326\364\326\365\342E\016\223\312$~"
+	.ascii	"bg\310\020B\005\354\227D\246\r\r\306s\2304\b\223*cA#\247(\247"
+	.ascii	"(g\211M\206\020*x\305,HsNr\224\236\263\004$\262\305)*\353\234"
+	.ascii	"\026H.g\300\234\210d\37559I\377[\013\024Y\263\222\223\224\203"
+	.ascii	"\364eM\225\251\254s\216\254\332\250\004\311\372,\234v\216\221"
+	.ascii	"p\213\276qE\265\226\365W\344\361\361!\373\206\f\371\262#&\275"
+	.ascii	"P\253\3227w\004\356K\214\233\337\rr\217g\307I\232\\Ms\224\033"
+	.ascii	"jb\275#\367~{cQ*Y#\363vT\227$6\226VXa\303\006\331\206\306:F%"
+	.ascii	"\007\366#R%%k\243\232%)\351B\222\365WH\323\244A\336\361d\025"
+	.ascii	"\255Y\247\246\324\340\341\t\227\344\201I\242\346\310;\244\335"
+	.ascii	"\212h]\035\022\215j$;\212\343\013\236m\001\003\226\365W`\235"
+	.ascii	"9\203D\263d\252fL\335\241\247\247\004\315\325\252|@e\375\025"
+	.ascii	"0\302\034I&\fr\216\305\302\303\003\251\207\305\307\006/^\262"
+	.ascii	"\302\340g\307\r\2672G\316\335m\3553\243\242\205\034\303\216\021"
+	.ascii	"\323\306$k\244\034\320F\f3D\304\374\255\260\313\355\315.\353"
+	.ascii	"\253\220e_\205\264\2677$\030\236\254\";\006D\261\364\356\326"
+	.ascii	"\273\230\314\007\030\344\027'\2759\265/H87N\244HRv\335\322W\036"
+	.ascii	"\322\213\020\214\350\306\205\364L\326W\201\313\315\r\311\206"
+	.ascii	"$\252\204\351\305\222\254\257B\r\344\032r\r\311\2462\211\237"
+	.ascii	"0\334a\265\331c\323\246k/\330\270LQ\275\341!\271\214`\304\206"
+	.ascii	"\231\254\257\342\f\026,H-<YEi0\260\303b3\206\3072\251\342BH\226"
+	.ascii	"#\265\250\323\026ag|Y\253\bSSCZ\341\231\2664`\b\031R\345H+`\304"
+	.ascii	"\356\256\262FR\001\302\330\202\202\006\245\002G\222#\233$A\242"
+	.ascii	"\025\317\3248\256\212\217\220b\254\033\023x\301\262#\202\027"
+	.ascii	"/Ua0D\253\201$\253\354H\264#\3174|\200\234\342\224E\213M\326"
+	.ascii	"H(\310(\252\364mH)'+\022\255(\2518\332W\337\266\226@}\333\212"
+	.ascii	"|rbU\027+\323\254\2174C:\371[w\210\216\262#Y\237Ho\177\003&3"
+	.ascii	"\242\242\220\322#\231\374mPI\226\026qY\237H\315F.9\222\354o\325"
+	.ascii	"\035Np`\262>\021\335\376\221J\376V\230\346\307\214\036Y\237\250"
+	.ascii	"\314>\021\030$H\220bkTr``wOd\354\205\035)\226\245\r\221\273\036"
+	.ascii	"Y\177M\361\210\036\f\271\254O\224V\244\b\362\210\312$~\312y\303"
+	.ascii	"\n#\222\327\225\205\017i\344\310#Y\236\332\346\222d} \214\341"
+	.ascii	"\330\327\230\267\254O\264\304\313\0139d\311J\204J\016\f\257}"
+	.ascii	"q\244\214\222\257#\207 \205\360H\332\321\22652\b\313\344\005"
+	.ascii	"%\316\372D8\220Q\242\370\307\0176*/+\274\237\217\031jqY\037\366"
+	.ascii	"\322\243\307\321\tOVQ\032\003\210\305j\306\326#WZ\326\262>\\"
+	.ascii	"\245\253\313\370\2442\211\237\2105\260\342\362."
+	.string	"\270\242\205\357G\216\034\310\035*\223\370\311\225\272\352\241\005\354\027\346B\356\206\216#w\f\327\230\301)\201sde!\265x\262\212\326\270cT^Vx\304\270\035/`\3408R\253xT\344\007\032\261\307\020\f\215\030\032Y\037\226\262\262Bb\301\302>)a\202\\\035\211\245\343\226\310\221\231\276=\355\345\345\325\250a\374b\203\245d\rL\310u$\315I\326\207Jg\314@V\251X\250\344\300\300\200iGb\274\250T)\262J\314\n\031\025t\210\224\024rJe\022?\251\300\n#\002\026\307U\0300@\307\235\232\030GNE\211\253~\230\375o\3272Dp(\335AA\031\277\376C\212\261\314D\343\270\n\003\342\021)\220'nH\030H\030H'\225I\374t\001\213\f#nm\025.\\bY\377\310\246#\235\322\304w\321\254\221L-X\230h\254F\005n\2619\243\226\365\237M\204T\204T\220.x\262\212\322 "
+	.ascii	"\nk\b\006\232+/\311\\\326H\027\310%74\262\336d\215TZ\352x\202"
+	.ascii	"%\353?o\354\037\231\204L*\362a`\214\221\342\360\250\304PU\032"
+	.ascii	"d\271\033H9\262\376\023\006\334\217cV\254\365\206*=\302!\217"
+	.ascii	"~KUq\214\f\342\226l/\250%lY#\215X\2431r\\\262>\b\370\366\325"
+	.ascii	"12\3072g\246\30793h\216u*\\\227\004\214x\231\356\253\035\205"
+	.ascii	"\341h\t\304\330\3344\216\311\216z\3074G\2744\274\351Q\357x\206"
+	.ascii	"\314\033d\0212>\362\035\363\216{\307>Uz\324;N\217zG3\305;\261"
+	.ascii	"'TF}$s4\030\216\226@(9\2669\272Q\245G\274\363\034\3616\224#\033"
+	.ascii	"\006\274a}\021\271\220\301\320.\f\031\033\253\376\217l\216k\246"
+	.ascii	"\220q\251\311\372xWE\325\226\224\365A\360\266\377\243\235*=\252"
+	.ascii	"9\335^\003VE\357h\266\364\330Z\333\007\201\224}\244\333b\246"
+	.ascii	"Wf\373 \220\356\203 l\037\004E\366APfG\225\261\335\275e}\020"
+	.ascii	"\374\330\3070G\271b\030\225\035R\262\376Q\314\377\266\204\036"
+	.ascii	"^\244d\255\343r\333W\264)\353\037\301\020\311xA\221f\375\343"
+	.ascii	"\227\377-PJ\337\035\215\254\211q\273\005\b\260.p\257\322n\330"
+	.ascii	"\310\372 hq\274\362c\227\343\225\343\233\226\222\305 \036A\261"
+	.ascii	"\322 O\305\035\241\312Z\007\305D\343\254\262>r9\266\035\335\376"
+	.ascii	"\266\275\302\024g\225\365\207\370\366\217l]`\200\024\311:\253"
+	.ascii	"\317\262\036\267\374\270\366\267\354\030\024\022\224\254?\344"
+	.ascii	"f\377\230\345\250\345o\177o\334\256\270\310\372Ci\366\217X\376"
+	.ascii	"\267%0\203\003I\326\3042\273\305\020\230\013\3329&h|d\375\241"
+	.ascii	"&U\252\030\277\366\205+%\032\213\253\254J\326\0372\262\377\243"
+	.ascii	"\232\232:\005\221e$u\200,ZbQ\242\225R\223^\326\037\312!E\312"
+	.ascii	"\021\355\013\310\005)\211\331q\312\217hqxe?\3240K\206T\355\310"
+	.ascii	"\372CKggG(e\256|\344&rX@\240\204q}H[\340\310\372N6ffG'9K\314"
+	.ascii	"\325\3254\256\252\302\240=\323\305\310\225\254\217N\312D\201"
+	.ascii	"%\371BFvl\002\"\326\271\252Z\312\340\201\205\311\217M\262\024"
+	.ascii	"\307\242P\304d}\224\262mo[7\236EF\025\261.Y\337\te\377\307$c"
+	.ascii	"G%D\033j,\025\253.\312\304P\233:\213\354;o\210\211\031\207\354"
+	.ascii	"X\215\201\246\364\006Fl\243\226\346)\353;\241\220 1~\355\"\236"
+	.ascii	"+M\302\266\254'A\262~\323\315>r\304\370\004\"V\277\274\344+o"
+	.ascii	"\342\336\262~3n\310\261\310\020\343\027\021\"\306\257-<\330\366"
+	.ascii	"\216\272\262~\023\313~S\3111\3101\210q\210\032\345E\351\r\214"
+	.ascii	"\307\327W]\264\t\003\b\220\276\266(\232\355\303\207\361\253\202"
+	.ascii	"8\216[\304+\356\372\240L\267\3408\362\300q\354:j\035\265\216"
+	.ascii	"]\273\210\347\r[\025\006\301\026gH\340\270~\354\342\241f\313"
+	.ascii	"-\353\343\016\"\227\313\244\026\306\355\250c\314\023\222-Y\377"
+	.ascii	"G\035\307\034@\206\234q1\265\273\254\240\3148n\021\221.h46p,"
+	.ascii	"\311\372BN\366\205\274n\334\310I<qQ\232\016\266\244\t\311\260"
+	.ascii	"q"
+	.string	"\274\262ae\345\301\2265\241\244\375 :\032G\0325\266\034\251\216TlJo`A\321\375\037e\034e\250\005QE\035cDIIy\220\245G\220\213\375\024\356\366\177|:>-\001\003\343\330\004\303\370\265\306\261J\226\365\004\305\304d\374Rc\250\017\242\316Rh\262\237\302\325~q\215z\\\3721\351\350B\235\352\370,6\222\362\200KU\n1\366SP\332\377\261\305\261\305"
+	.string	"\240\212l\214\\\371\310\372\037\320;\"\035\221\270<)\275\341\2319\032\035\215\214_bV\321\017\264\341\354\341\354\035c$h\242}?\306BrT\221\313\032\207\357YX\256%X\236d\215\363\246\216\255\205\026b\016\244\036<\226d\375\017\364\330l\330\340\344!\371rs\234<\366Ht\006]\3268x\353\230\027 <\262\306i\363,H5\254\\\301\001\244\214++\353\177`j\3779G\316\221\273\334\350\325\327t\003xGe\324\2501\302\200"
+	.string	"\337\223\035\226Z\244k\315*\3533\325\354?\363\310<\2066@d\305Q  !S3\306j\315\330\263\321#\367\310@0\3102\322\252`J\325w\027$\314\354hH\0362\254\322L\342\030\353\233\223\035\026\253\306(\215\r\272\253R\034:\243\013\020Yq\024\003\224Li\031q\271\264\f\251\333?\316\031U\212sf(\005\"+\226b@\026#\261(\227<\033c\366\334\234qH\033\023\0272d\214Oj*\250\322\306d\313\311\031\277\226\2101\207\354_\330F\330FE\373!\305X],\336U\017-xjM\250\202d\375\366\206\023WeL\351\r\017\007\314q\342\326\270\324\310e\37558_\246Dq\323\365\005\007N\212\027\256\252\341\221\266\372\221F.k/B7B\275?\226\332\242\363\222\365\231I\373\307aS\2458l8n\305\24678n\177\353\205\323\226\257\344\022Pr\004\311\272"
+	.ascii	"@i\366\217\263\206\263\246\004\310\013\016\316\007H\200\324\260"
+	.ascii	"`1~y\260\344\f\330\376q\254\340X\251\003\352A\205\212\361\251"
+	.ascii	"\0037i@N\373\307\201\"\305\201\202\223\006\302\030\307_Q\242"
+	.ascii	"1\024\224\0068i?N\024\034)*\032\nS7\344\260\262\306\231\322s"
+	.ascii	"\0344%cl4e\035B\237\212\\uL\366\223\267\177\234'8O\236\244L\177"
+	.ascii	"\340\314\314\324\251\373\205\366#\326\244\211\361\313\2037/~"
+	.ascii	"\2448\322\257\264\351\317\321\222%\306#M\026G\035\325\246\244"
+	.ascii	"0\203\223\004'\211\236\217\024h\373\307A\202\004G\fD\226Q\214"
+	.ascii	"\001\360M\251\301\263\023\333R\2245N\230^\177\f\021\003\313\372"
+	.ascii	")\222\354\247\350\332?N\221\253R\234\"8GZ\244\330\310\307Z5e"
+	.ascii	"\027\035\236\261a\304#k\034#\017\246\t\332i\251\261&L\326Oq\265"
+	.ascii	"\237\242i\3778Ap\202\340\f\371!\305Y_.\230\273\344\f\253\017"
+	.ascii	"G\310\223\037bb\262\376\313\267\377\316\355\037\007\310U)\016"
+	.ascii	"\020\234/\f\262\342\030\003\330\233\3222\242D\215K\232\254q\274"
+	.ascii	"\236\263\204\321c\313\372/\333\376k\266\177\034\036\252\024\207"
+	.ascii	"\007\216\017\f\262\342\030\bp{\262\333\021-c%k\234\036/\334\200"
+	.ascii	"$e\375w\310\376k\265\177\034\0358:p\270\200H\361\016%\253\225"
+	.ascii	"`\233\036\224\266\254q"
+	.string	"vd\225M\033%VY\377m\261\2774\203\003\007\316\026\020)6\002B\f\023\366=\245\345\310\032G+W\t\221\242\311\372\313\267\375\345\224\375\343\\\341\\\341\334\370!\305Fb\254\235\223\035\226\236^\t\213q\260p`a\311\372K$\373K\034\373\307\241R\2458T86\200H\261\321\330J\304i\214\020\274:\031E\216\340\330\370q\252ph\340\324P\307\270\310\261\006\257M\225\243\254\211aT\344\372e\321\376qd\340\310P\321:Pc\245(I5\246q\274\246\0010\317\212\326\230\254\357C\267\177\240\335U)\320\316\230\324\203\024\033\335p\2054}M\025\343nXM\311\372\307\201\302\201\302\221\312L\342\2505\214i\256\n,\216\2534p\233li\275\300\211\312D+X\274\244\311\372>Y\366}\216\354\037\207I\212\303\204\343\364C\212\215\240\260PLqX3\216`=\311\372\007R\035\307\3518M(\224M\315\325"
+	.string	"K\242\205L\326\367\231\332?\316\013\234\027F\245\337RV\034\305"
+	.ascii	"<&\261\275*.F5\262\276\017\324\376qZ\340\264\300Y\312L\342\242"
+	.ascii	"\240\232\23286-\257\244\247\254q\224z\240q\361\312\372>F\373"
+	.ascii	"(\352\220\220\324\206Q\240\350-\021cd\304&l\023\267A\323\266"
+	.ascii	"\177\234\030'6\026\2518Hq\216)\3218v\323\300\235C\363\021g}\024"
+	.ascii	"Q\366o\344\3433\026\375\226\262\214\266\020 e5d\f/\216\3354h"
+	.ascii	"\257t\034Ue}\024[yy\306=\225I\\\024\254\213\361e\267\272m\271"
+	.ascii	"\b\313\332\250W\207\204\246+\353\243\230\332G\021\343\341\031"
+	.ascii	"\237:H\003\2464\263\237\223T\343\232_\303\007\3064F69I\307Uq"
+	.ascii	"\221]\005]\306\224_\366\225Y\354T\251\321\316\250\006\004Y\\"
+	.ascii	"D4s\232\322\300X$\314rc\232j\313\372\31212d\214\323._Joxu7N\203"
+	.ascii	"IvuXY\033\351~\031`Cr\313\332\210\346\307U,\243\345L4k\343\031"
+	.ascii	"!\230\246)Y\2626\232y\235K'\225\342$k\343\334\263\374\232\034"
+	.ascii	"\231{\223\265\261\214P\316j.K\326_\003\224\372\337\006\267\272"
+	.ascii	"\204\351\222\365\225]rr\3060 \214q\274\225\027UR\275\251R\343"
+	.ascii	"\2331\314\021j\002b\226\200/\340\206\354\2502\202\2711\3567z"
+	.ascii	"1\302\251K\274\276T\311\332\370\245\347F05\\\364Me\3754\025\271"
+	.ascii	"j5\025\271^\331b_E\242\032\335\334\2000x\310b\251`\022S\0336"
+	.ascii	"\266\234\304>\275p[[S\321T\262\370\311mrC\341L\213\026\343\327"
+	.ascii	"\216\343\270\210,~2\241\206Btc\301b\374\342\201\302\224\025+"
+	.ascii	"*\032OV\221]\005vT}w\372M\235\034\217\254\237\234\356\033\323"
+	.ascii	"T#\025*?/4i\311\267}\365\347\265\376F)W\245F)F4\020Yq\214\n\206"
+	.ascii	"0\341\003\313b\332\242\240\311\3328\345\327\246\206C-\353'\323"
+	.ascii	"\366\223H\240@\321Xx\230\304R\305\257&_vxq\274\246\301/\255\311"
+	.ascii	"]Z\326Or\355\337h&5\232\031\237\360d\305R \034\231\252\031\003"
+	.ascii	"rA\032kctB\306L\256,\353'i\354'[l\251\324\330\344W\307\247\364"
+	.ascii	"\006fdrc\023(9\354\226\210X\3220IlY\337\003d\226,qBK\222$'=y"
+	.ascii	"`\310\026\0233>uP\245\313\0033\266*5\"1\306 \262\342\030\030"
+	.ascii	"li]\310\001A\313\372\036x\332\277\361\210\361H\336\002\202,."
+	.ascii	"*~-u\240\257H\021u\252\311\342(\027HX\007\310\354 A\214C\324"
+	.ascii	"\007p\221\0225\n\271q\bq,\313\324M\326_\323\202\375o\223Yz\340"
+	.ascii	"e\375\016\260m//\343\027\227/ \030\"^Q\262~\007\316~\374P\321"
+	.ascii	"x\342_]\225\322\033X\007|\354\337\330\243\207j\246\2151\022\220"
+	.ascii	"\265h\007`\354k\240\032\273\272T3\025jGiR\233\272\331\277q\207"
+	.ascii	"qG\206\342!\213\245\204\276\224\336\3608P\267\177c\216\034\252"
+	.ascii	"\031\210,#\251\001(\241\222\003s\200\364\353\310\376\215Z\277"
+	.ascii	"\206\017T\251Q+'\251d\361\023\333\304\345\306\276\021K5f\031"
+	.ascii	"\263\21064Y\034\025D\253\342@\324\276J\264\261\332\260a\274R"
+	.ascii	"\323x0\344\314hu\343U"
+	.string	"\222'4hY\177\r\321\306\377V\317\365\230\232\311\372\034\210\367o\244!5\322(\362\001\227b\243 \031\034-\251\322@e2\235\252\313\372\033\230\333\277\221\212J\rCb\277"
+	.ascii	"\002e\252e\337\030C5\312\220\221\257H\354\027MS\2461T\254\301"
+	.ascii	"7P\266\257\346\253\3657JI\215Rj\230L\026C\271@\316\3104\370\006"
+	.ascii	"\242\373W\325T5\325\t\210,#\255\n\256L\347\330\020\331\254\321"
+	.ascii	"\201$\353\033\231\214M7:\335\350d|j\3438\216\253\342\"5\003\210"
+	.ascii	"\002\242\364\206\027WAa`|\n2d\213)\353o@j\377W\237\37756\202"
+	.ascii	"\212\343X\nH\026C\035\t\327_\275\nTU\f\376\241\372S\t\360_\377"
+	.ascii	"\376\016\224\001\021\307^w9\3428V\357\366\0205#\033Y\377\257"
+	.ascii	" \266\020\307q\324\022R\\\244.\225iE-\225iA\341,\271iE\305HQ"
+	.ascii	"`HZY\352\022\222\026\024\024R\\\204\023\227iA-\305ZQ\306\270"
+	.ascii	",\246Z*3*R"
+	.string	"\227\220\342\2508\326\212\215\361\222QT\\F\006\205\263T\246\005\265T\246\025\205\263Tf\024\265\024g\305\306%\262\034P1\231V\021\016\2142\243\250\270,+\n'.\323\212r!\226$*C\035\031\035h\356\312\272tQ\253,!\305NMVFPF\270%\262\254\230L\034\253g-b\250\030.\216\t\020\307VYPd\214\250T*GpNGS\214\262T\2628\216/4\035me\305HpEj\f\267D$+\216\211\034\001\305Mq\034\307\036\024\221\301\305<T\270\242\034V1S\2138\236 &\213\343\2468.Rc\2708\216\213\3428f\241\254\310\342\270\206q)\332\324\024\307U<M\261UQ\225\026q\234\317\346\250D-\225me\365TqR\026\215\225\310\212\324%\246\2548\032\223\321\202\332eE\322\230)\216cU\315\216F\305\260\313\332\370\002\306\2132\033Y_\003r\333\270\364\204\345\352F\326\327"
+	.string	"\3346\266\310b6\375\312\372\032`\333F\244%\030Vfd}\r\\\331F#\030iG\236\262\276\006\220l\262\252%4%Y\027\373\262\222\251\026J\262\276\006\270v\361\315j\325\245\352K\326\327\300\214\274\242^\246\202!D*\353k\300E\236\233b\025\032\033KY\277\270F-\266\221\026\333\250S\025jG\001bc\032CQ\321\340\031@\263\257\252\323\365/\242AS\274\323Lb\251 \020\247*\r~3\230\310\\\311Z\215\2726\344L\\\326\317"
+	.ascii	"\334\376_L\243J\213vE\272\242]\261\2568][\357\250\274\254\212"
+	.ascii	"uT\\S\2728\235\346\246\035c\226\262~\006\244\373\031"
+	.string	" \262\237\201\033E3l`\254\331\222\3653\360b\027\347\212rrE24\212c\364U\025\267\242\254\217\001\272}\fh\331E-S\244\314\025\303\024\343\324)\037?\230\262>\006\224\354\277\350\345\252\264\350\245\370\005\003\262\270\210\210\306M\021\256,I\226\261\254\217\001\037\373\030\310\332\177\321M\225\026\335\212]@\220\305E\310'\030]^l\023f\235U\311*\222\3651\220\264\331\350\212\204Ye\375\013\224\331\305-\305+E,*\334\231\210\261\265\342\026\242\022\333ZQK\221\213*-n)f)n)R)Z\371@\310\f=>\240\030\273%\261\255\177\201\255]\3042=\222e\210\220\254\177\001\254\375\027\255\274X%\372\204\246%k\262 \025,(SY\377\002Q\373/\246I\213iC$\036\262X\252\330\224\247\364\206\027CAi\360\013Ly\021\355w\225\334%\2646\321\257\254\213Rz^\234\222\273x\031\335\310\372"
+	.string	"\305(gB:\034RpATi1H\361\354\bu\001\256\027O&\3001\025c\004\244\0313\212\274\350\344/\n)\016)\232y\360\005jF\326e\256\221&i\326\262\376\trbsS#x\3211H\320t9R'VfZ\006\351L\233\225\030\261\"\030]\222\"\223\"Yq\254(-*)6).Q\245E\261bX\006\253\214#_\226\216\372'<\331?A\311\376\tF\366O"
+	.string	"\262\177\202\216]$\322\363b\021\020\344\310\342\2215\007*r\355 Vu\3265V\221\353O\220\332\1771\352\365\203\342\202\013\354\207\264\370\243\350u\204\272"
+	.string	"\224/(a\226]]\215 j\222\027\201\024\235\204Y<`"
+	.ascii	"\271\222\365-\320G"
+	.string	"\226Su\304)\353\277\330\243k\315j\263\306\006\rUZ\244Q\354:Bi\240\214\025W\246\001\204\214\211I\226)\323\342\216?g\025k\024u\b\263\220tQ\311e\235\203h\025\345D,\353[\200m\355\250\213U\227h\034\223]\271]\251]\025\221\330\2468\212YE\255\"Vq\253xC\225\026\257\2126|\330-\221!\352[\200\312\276\005|l\326\002UU3r\225+1@\246Tiq\2528\003\2041\216y(\211\306PS\032@\3552!H\246rQF\321I\230\205fI\027\254\254o\201\244\375\027c\024\243T*\"b\236\324b\254J\213q1\352\bu\001(\\\2461\324\224\006P\300*\030<\234\b\307@\371\272\312\272\370\364\027\213\212FE'a\326Y]\013\254\254\233bV*/\t\222\254\177B\314\222\351\230\243\242\213\"\214\242R\221\251\270\244J\213/\212I\252\230\026R\246qLV|\001\234\002\302"
+	.ascii	"\241\005T\373B\207\222i\231\342\213\"\022\253\003\212\322\033"
+	.ascii	"^\216\221\266\366%\324?\361\266\177B\311\376\211\"\373'\200\354"
+	.ascii	"\342\211\030\033\370\002\2058F\002\336XSu\346\315U)\361\rQ\217"
+	.ascii	"g\307Hn\\\246q\\\245\201p\316\351\310\216\254\177\"\336?q\217"
+	.ascii	"\250\267DiJ\221\254\363\204I\246d\251\222\365M\330m\340\024Q"
+	.ascii	"\016-\332\206\350F\225\022\361\210k\256\022\361\210l\210rP\342"
+	.string	"\276\354\3602\310S\326\226xY\365M\310\355\233X\333\304\2733\342\033 0\274\330\235\250\346\317:~1\304\244\331ue\235g\364\234h\227d\307R\217\254\211i\246\334\230\262\001\206\356\304\351O\244B\254\373q\241\200\203\n\031Z\326\352\232\252\263\002\227\364\234H'TC\246\f\311\231\023\321\274\357\353\216)\353\037\216\236\023\317 ME\361\232;\321\314\255\204\344\320\2215\021H\317\211s4\332p\370 \2269\223\215\252\2721'\222\311@\232zD\311\232\210\326s\342\230VM\314K\2160'\312\375\3045\242\0308#F\344\262V\227T\235U=\35391\214\2336\025{\002sb\334/\234\376\230V\350{\323&\353\\\244\347D0oZ\246K\210p'~\371q\241\2607Fn+k\242\227\236\023\341\326\270\246Y\013\300\355\304\267_\b\206\330\345\307\205B\r2N8\262V\311\250:+\321J\317\211n@#3h"
+	.ascii	"\341rb\333OLBd\273\301\204IU\326*\224\252\263\022\327zN\344B"
+	.ascii	"\214Bb\026%k\234,'n\371\211C\210Z~\\(813\n\223\265\332\245\352"
+	.ascii	"\254j\225\236\023\263l>-N<\252\234\210\345'Z!^q\001\006o*k\025"
+	.ascii	"N\325Y1\250\310\225H\245\347\304*l\017\034I|d\r\200)'\252\375"
+	.ascii	"D4b\032\030\243\036=\262V\317T\235\365\202\212\\\363\\\317\211"
+	.ascii	"S\204W\244\230l\211r\242\224\037\027\nS\340\352\242\262&\036"
+	.ascii	"\35191\312\3162rd\313\311\211P~\342\023\342\231.\n\262e,\353"
+	.ascii	"\\\245\352\254\005P\221+\261I\317\211NX\2634]b&'\232\375\304"
+	.ascii	"&\304\262\037\027\njbc1"
+	.string	"\262\316P\252\316J"
+	.string	"\025\271\022\245='2\001\316\315\251\211\313z"
+	.ascii	"JN$\373\211a\304%?.\031\261V\213\254\325*Ug%&\3519QI\013%o\307"
+	.ascii	"\226\254\217b'\216\235\310\246c\213S\326\304\260\236\023\305"
+	.ascii	"\202R\332\336|e\2154r\"\222\237x\204\b\366\343B\241\307TZ\233"
+	.ascii	"\254U0Ug\265\240\"\327 X\317\211F\206]?\214\250\0219\261\310"
+	.ascii	"\203R/{H\262&\016\3519\221H\361\312\253\250*k\035b\220\023\205"
+	.ascii	"\374-\221\237\2136.qzY\007e\364\234\030d\367\365]\341\221\243"
+	.ascii	"i]\314v|yI\237b\020!\3768\321\353'\002Q\305h`\342\301\225uPE"
+	.ascii	"\256\302\265\236\023\177,\351\205eM\364\361\343\322:\260\346"
+	.ascii	"nd\335E\344\321f\325hbD\245\353\rY\025V\326;\210:f\034\035\305"
+	.ascii	"Y\337\204tk\021\267\\,qwqY\337D\327&j\t\323d\231r\226u\026\361"
+	.ascii	"\006\220nH\322R\3267\021\265\235\264\005Q\313\232xE\264j\211"
+	.ascii	"\314\260b\223\365K\270\331D\264/Z\270\324p#\246\241Jr\2431t\223"
+	.ascii	"q|\211\333\253*R\247\276\236$Q\235\370\342\n_\227,\304\031D\031"
+	.ascii	"1\372\370bd=\345\266\330Q\206+\353\227\b\263\237\210ID\246\037"
+	.ascii	"Y\264\204\016\274)\037\361H\214\031\342\323\360\313\020\315O"
+	.ascii	"\nu\202\016\272\265!\334O\n\325\306H\252\233\022c\020\241\210"
+	.ascii	"QD'b\023QJ\225\022\237\210HHOC\272\341\335O\n\265\325t\240!>"
+	.ascii	"\r\327\f\337\374\244P\255\224\2163\3238\2163\310\200\330"
+	.string	"f\005J\030\242\206\241\346PBR\224\003?\314\024Mg\007\fCN\030J\f\001e\021\3244\001\032\342\371\201\351\236`|\203P(O\250X\337\344\3239\344\276I\023\340\247sh\bu\262/\254,\261$R\242\330\357\nL\023\357\nL\023\033\336O\341R\371\202\bb*O<\337\024B\036W\t+=\254x\022\2370\211\020:o\320\222)\314\201\233\314\037\020\224((E\216\316\233\2042\211\315w\310\204\037\247\b (\263\371\006\r\275%^h\210\021^\237\247\223\204\027\352\f\352\020\304\001\252|\216`\\a\246\220\220\263CNP\020\021\224\231\003C\223P\241\211\345\373T\002\231X6\231)r\232\357\220\t\007\312\300\201\223i\001\352|\3720G\274B\314\023\314f\bf3\304\013\025z\205\326\237&\263\331$*\001}\237J\243\206\rp3\004\n\"\023,\224\317\247r\270l\216Pb\311A\001=&<H\202"
+	.string	"\277\037\226\314\241\035\370\375`<\001~\177,p\200\337\037\034&\024Z\002~\177\330!!\037\241Wh\325\260\301\304\206\244\206\003ex\223\305\237&\023\032b\305\363}rX\361\344\361i\262\200\276%\220\"\234\240\200\036\021N0\001B\022\204\037\345\211\235\245\362-\341\001~?\370\300O\"\234t\203\224>N\021\260R\350\351$\001\t\277?9M\346\317+\302\2629\0024\204Q\005\247\b\034\240\037&\210c\220\322\007\bV\nq"
+	.string	"C\233N\037`\320z\240\fJX\351\241\004\374\376\034\237J\247\b\360\353L\321d&9\360Y\206x\276O\"\330G\231\202\250\251\034\001\277?8p3\204\363\004\364\205Y\210"
+	.string	"+\235>\310\267\311\024\001\335\201\223\357\nL\350\032\024D\324l:\233\254\n\316'\020\354l\262)\224o\220~\237DC\272\371\006=a\350\372\323d>a\023)\340&\363I\342MB\211`%l\342\365Q\016\231x\276)R\020\211\360\252x\276\320\267\204\207\n\240\314\n\340\367g\270\342\271|\237DL(\264\004\224idG8!\304\211\016\034\222#x0aD\262C\211\244\211\0208\"\234"
+	.string	"mZ\340@\031\200\240DA\030\210p\302\220\323\002t\304+\304\2047\213!g\007x\310\247IDB\020\bM\376\f\t\341d\363g\b\330\374\031\372\005\255\357\nL\250f1\344\364\321Ox\350\367!\213'\fe\376\274%\222\313\227]\276P\"\re\257\204\225\313\344\317P\006b\362\205\225ACB\357\211\237\241"
+	.string	"\300\314f\b\341+\304\204q\234LXY\202\004\316\013+K\300\357\007\022H\r\031V\274%"
+	.string	"A\211\202H\320a.G`\241\034A\004\2022\233L\022D\3748E,\233\034R\360y\201:@\177\234\"D,_\236b3\304\316\320\373\212"
+	.string	"C\225\"HX0\204\237J\330D\316\220\323)\242\203\f\360S9\224\001\372|\205\230'8\034\240\355 \303+\304<\021\fB\337\023O'\354\034\321d\0269\3744\231P\013t"
+	.string	"}\276:\007\312"
+	.string	"\345\300\371T\242\320?J\241\037s\210]\276\313\367-!E\210\235\344\223\003\237\024K\2453h\370\323d\226P>\341f\210\342\316\353\323|\237o\212\267\204\020\023n\022\225"
+	.string	"\202\177\232\257\210\016P\n\206^\330D\223)\342\371.\233o\t8\007.\302H8\007\336\201'\200q`\013P\001\b9\233\257\207!\247S\304\222I\342\b\363P\300B\371|r \200\217\217\362\007\277\260\322\303+\304<\321\226\200\231\037\340\247\023\bj<P\206WHY\202\013#\235)\232L(\013\023/\314|^\240\355\311\260|\337f\020\372\n)KX6_(R\303\206\023\210P\016\320\024|\234A\" \227J\247\b\013L\"\021~\210P\274K\016\226AL\"\024\357\3229\202\004\234C\002\007\036\036\227/\220\217\322\247i\001\030\372\302\024,_\030\372\022\201\340-\261\026_ \037e\207\235\241\t\022\037^\230\371T\001Gh\3509\002\206\347+\304<\241\2023\310\204"
+	.string	"p\230B+\332\003ep2\341\367gI$B\016\224E\223\303\362\375\371q\212\2600\204_\023F\235\020AJ\025\317\027n\206\b\201CB\310\t\002:\364\341\307)b\031D\344\0042A\301}\230\317\267\371\376\354{\240\200\r\024"
+	.string	"\302\n\366 4\240\203\006t\260\036\204\006\364\3644@\001=\373\n\350\371\301\311\241\0276\361\376(\205@\300\311\347;\364\276(\204\"\016\224\001\352\363\344\300'\005\314D\241\205`\246\b+\234(\204)@\225#\232N\246\3173\347M>\235$r`\245\b\013\320\241\037\027:\001|\240\f\3207\3505\001u\372h\030\352\354\020\244$Z2\241\357S\310\342\351\204\241L\020*8\203\240AX\t\007\275\036\002\020\"\004Kb\223`\233L\345\b\020\320\241\017>m\220\322"
+	.string	"\037\240C\037Tp\006\035\341w\351\364i\276+\323\204"
+	.string	"\226o\363\207i\002\312\334,T\350\205\241,L\034a!e\t\313 \354\fb\016\r\337\3442\304\n'\n\226\370&\207\210\234\317\017$x~\232\314\245\323\2479\302\316\262\351\354@\202\005\270\205&]\242\034\030\232\2740\364\276\"\3704Y@7\fU\006\265\320$"
+	.string	"\240?\312\240\024@\027n:\241\312\367\271B\223\026V\370G\031D\002\254t\006\245h\241\311\002\250\3606\267\322\031D\202\no\263ID\202\362\b7_!\030J\364\201%\207&\363\b\037(\0034\305\273\024b\236\bB\223I\270\371\252\030\341\307)\""
+	.ascii	"/\034\342\307\031$|\205\210\240o\tg\320\020\232\\\341\003eP\242"
+	.ascii	"\310yae\020\221O\220\322\247]*\337gr\3716\231(\204\234>C\230"
+	.ascii	"h\017\021m\030\206\207L\030\"J\302O%\f\335CD\354\373A\211\242"
+	.ascii	"\035\"J\302\357\317z\342}\022A\241\357\223\004\020\026\"2\361"
+	.ascii	"\2032W"
+	.string	"pX2\207\206\360\222\031\244<\001\332\201\204\025O\235\345\233\202\217rh\205\252\340\f2\261t\216(B\177\224A$\270/T\tD\342M\241\204\0061\225)\206\313W\005\363\365yK\004)\233?L\023+\236\306\003eH&\340\003"
+	.string	"\340 f\212\246\005\204\206\236\257>P\206W\210\t\303\312e2\370T\276,4\020\334t\n\001Y(\227?\350\223\310\t\004\204\2760Q\223)\304B\227M\247\317\013e\241\314\240 \246\320\nC\223\310\345\273\0023H\311\204\231\315\0208kP\212\327\203\216\005\013?M&\f\277&R\244(\262\360i\276D x\237$t\200Z@H\371$\341=\302+\224B?h\362\204\t\237'"
+	.string	"\200M\246\320\357\247\311\334P\346\n\016&\236N\330GI\002\024\3726M8a\"%\206\003e\300\220\242\b}IX\026\017\224a\305\223\203\237!\344\212\247;\244\024\362y\002\235\317\241\345\273\342\031\244d>_(\316\2127h\210\310C\212 %\220\333dV\220\374!\n\032\342y.\233L\024IX\tM\n\021=\341\024\336!("
+	.string	"\204o\220\322\307\205\237\257\212&\323\347\271d\n\001\233L\241\275B)\264\241\357\373\374y=\b);\250\030Jq|a\245\n&\354\303\201\251\344i2}^(\321\212gp\005\2212\271B)T\204\352\004\337\245S\bG"
+	.string	"\026X\f=1$\223?M\246\317s"
+	.string	"C>Oh\222\t\205>/,\231I\230\331$\032j\bZ\361\204\026\241D(\240\304g\023\232\\\361,B\203\336\346\273d>\207\240B\023,\211\224(\222\313\027V2a\347\317\333L\276P\242d\n\350\323\207GI\024z*\2230\364\311L\221l:\223AJ\037\035\241\247\022\312\\\342\034(\003\005P\345\220\220\323\247\250L\376(\205\206?J!a\220\370\243\024*\022\233P\237\037\245P\360Gy\002\036\"z>_\270\311\024:\237\257\006~\224B,|\240\fp\363\025\"J\342\300\315WH\310\tC\211|\222?J!\344\20120\207\240\305&\324'\311\034\202\026\223>\032\230F\234\024CA\311\027\312t6\211A\257\212d\n\237\340\217\022N\3728_\341\217\022N>\203|V$\235O%\212\241\316\n@\311\024CA0\234L\361./\034(\303\362\205\337\240!!g\007\237\034("
+	.ascii	"TP\262\370y\320q>_\r\370\370(Y8\305\273L\302\026\200\320\240"
+	.ascii	" \347SC_\242 \245\212\225(\t\344\0033I,\233\034\202\202\234O"
+	.ascii	"\244\n\312\347\017*\304|\236x\276\360+\344<\302\315W\350U\341"
+	.ascii	"\034QA\362\205\022%\235p\260\007\331\323\243!\271\002P\216\206"
+	.ascii	"$\234\302\t\345QA\311\"\231\202\317\013\3443\354!\342\250\240"
+	.ascii	"dq\264\220\263\263|\241;\0038P\006\250\317\023\003\324\347y\334"
+	.ascii	"*(Y\b\227M%\212\245\362]\342\274?M%\220O\022\206*S$\227AN\240"
+	.ascii	"$\034\244\314QA\311\"\007>P\006\016|R\030\3009\264b\204\366\205"
+	.ascii	"\225%\220 ,\231#\236@0\013\202sh\305\bO xC}\236\317\025\372\302"
+	.ascii	"\312'P9\004\357\024\224\357\023ER9\004\023\337!\026\360\216\373"
+	.ascii	".\235#\224C0\353\034Z1\202O\t\350\013+K\244\340\303$\002\201"
+	.ascii	"\021\272\022_!&<\344t\212 \246\350\340\201\303\206]h\362\247"
+	.ascii	"\311,\261T\276@:\210\251\2045\264I\364|\276*\234\373\247\311"
+	.ascii	",\341\302\007\312\360\323d>\223>K\345\017\232\334P\013\274BL"
+	.ascii	"x\205"
+	.string	"\262\313\340r\204\246\n\316\245\205\036\030\376i2\233L\245\320[\002\372\006\371\260\360)B\223\035\204\210\240?\270\231\024\372A\223*\336%\feG\2140\261\fr&\205V\023*\274\315\244\320\372T\252\370\241`\nu\224\260\322\303R\371\226p>Y|\270\320$ax\240\fLx\305\373|\203\226M%\b&\274\342E\302\315\024\031\232\364yKt`\302+^\034&\274\342\325\360\317\223C\n>J\024AAJ\237 \024^\361\006\341\244\007(\021\212 \224\b\305\017\232d\016\231\200W\274\033\b'M\b\241\233L\022M\250\317\372\376,G\370i2\227\3127(\310\034\202\376\240\311\016\032B\300+\336\355\243\201\371;P\006(\021\212\013\320\344\bx\305;\204B\337\347r\251d_\025\312 \023DCB\233(\371\016\2618\001%B\321\2568\221\342\365\360\016\2618\0013\233!\222\034Fx(\036(\203\210\023!Lp"
+	.ascii	"\277?O%\\\001\f}a\275\242\004\207\021\036^(\321\232\202H\204"
+	.ascii	"\02500\005\221\b+\236@\347\363\325\200\363\311\342gC\211\234"
+	.ascii	"L\025\357\223\304\321}\237D\360\013\007\223+\200\240\300\013"
+	.ascii	"+K\274\311\020$L\274K\347\210`\212\241 a\212\241\240\344\n@)"
+	.ascii	"h\330\220\004:B\207\234O\017\317w\311T\301\364@4$T\374Q\236`"
+	.ascii	"\302+F\200\233!\210\206\204\206o\222\370>\225*,\237\306\037\017"
+	.ascii	">>JW\305\353A\203\363\311\342'\250\342\365\240\202\362)\314\t"
+	.string	"\032\352\300\007\312\340|\262\370\331\020\324\260\001\036\"\022%E8\237,~\22004\031\354\201\207\2108p\n*4\031\004\366\274\260\022\206\302CD\r\304\236\236'L\302\bC\223\273I\002\213\240\241!\016H\370@\031`\240\037\346\253\302\nM.\225D `\242 v\200\"\367\240\310\032P\344\036e\326\240\314=+\262\206\025\271\207E\326\300\"k\020\232\360\361Q\026_\250\005\234'\336\245s\204\363I\302\004\250\022\204\363\311\342\347\302O\223\371\363!HI\344\341\205\022\345\300\311\025\357\262\311LB}\230B\312&\213e\322\002\224\271\202\303\017\021\212!\t\302&s\205rD\353\034Z1\302\253\342I\324!\305\220\210&\213e1\005\250r\004\224\271\202\203\n\316\240\024\317W\205\323x\240\f@\347\n\037(CN\007\017&x\336 \245\017\024V\242P\321\006)U\250`.\241\357\023V\242P1<P\206\246\223\251$"
+	.string	"4\351\343\243\004\302\007\312p"
+	.string	"\370@\031\240@\260R\210\203\246SH\310\351#\244B\223C)\220+\230OX9\202\b\027\223\354\2012\300>DO\030\252\001\232\\\361\302DB8)\3708\203\222\311$\373|\233*8\223I\026\372|\241D\315dr/\233\314\024\222\311\025\332d\016A\223I6\350M&[8\tC\231A\306\003e\200\276C,\340\r\226\357S\t\004\335\200\003(\314D\301\001Q\363g\203\025DMf\320\006\036( \251"
+	.string	"\020Vp\360.\211\202|\232L\016\236P\"\016\030"
+	.string	"\257x\233A\312\346s\251|\237@\360P2iA\305\373\034J&W\030\312\fJ&W%\254\\&\223\353\273\002\023\232L\256)\3708\203\264\317\373L\2720\263\031\242I\002\314l2\327'L\302\247ID\302R\371\226\360\361\341\220\343\343\243\334M\022\226\312\367\271~\350I\372\370(W\025\224%:x\340\260\302\007\312@4$\224t>Y\374\370\370(9\200>_\025\314\347\022\001o\262D\007\037t\240"
+	.ascii	"\242!!$\364}\272\320d\316\2334A4$\024\\\341 \"\350[\242\351d"
+	.ascii	"\302>/\374z \032\022:\276\311\346\0173H\231$6\177\230A\034||"
+	.ascii	"\224\233\305R\371\226P\302\312e\013C\223*^\017\316'\213\237\326"
+	.ascii	"\371d\361\243\237\320\024I\240\037&P\322\307G)|\227\316\016M"
+	.ascii	"'\023\312T\361>\205\3177(\210\231b]\001\304\013"
+	.string	"+K\b_\237\246\t0T\371\212\2009,_X\271\034\262"
+	.string	"\224ya\b\037(\003\007?C;?M\346\363]>\235o\t\023tT\274\036^XYBhl:\231\320\347\253\242\031BH\005\0228B*\220X\276>M\026\320\246\005^(\021\021\206>\211Dx\241DC\026O\370\025z\203\336\0238p\222\205\376(O8\231k\220\323\307\t;\237$\340\247s\b\332T>O\354\024\237\257\020\363\304\362\375i*Q\300L\021`'\020\324\303\013%\332Q\361.\177/Q\220\362\004\370\205\246Ha\302\033\264\f\021\244\204\231?\314\345N\223)\024\\\241\024\n\3724\231B\356\033\344$A<P\006"
+	.ascii	"\b\2750\224\005\224X,\361\252`\302>J\234w\351\024r\241>L\030"
+	.ascii	"\232\002T\t\027\201|`\246\n&\240N\022\nxa\345S'\005\037g\220"
+	.ascii	"\317\363U\341L\022\r\371\f_!\346\211\327G\371\374\3204\341\371"
+	.ascii	"\252\340\034\332y\276\314\024L\270\371.C,\237J'\212\342\n@#^"
+	.ascii	"(\320\352s\374i2\205\236\034R\360a\302&\336 \024\312\346\213"
+	.ascii	"\003?\237\312\0374\331d\246x=,\203^&\t\027^!eS\277B\312\022\210"
+	.ascii	"\007\312\300\001\364\351\2046_(\005+\224M\246\320Q\205\035\270"
+	.ascii	"\371B\337\347\020\354l\302J\024*.\370\250\b\032\276\311\343\233"
+	.ascii	"\314y}\236DN\023\317\027~G\300\315\367\371$\3629\262\200\231"
+	.ascii	">\312!%\212\"\254\024\341\204\027J4\204\302\3177\210C\207\027"
+	.ascii	"J\224\363\376(\233N&<$D\004m:}0@\231\320\367\371\302P\026@\260"
+	.ascii	"\022\205\n\342\373\243\204\203\234*\202\202^\237\240 \242\024"
+	.ascii	"\260\022\205"
+	.string	"\n$\334$rv\b\nz;\260x\2760\254\024\341\365y:S\350\260P\006\rA\2319\260\022\005s\370\323d6\237\312\013\354\004)}\2300\363\331\341\351$\241I\344\001V\242Paa\351d>_\022)\206D\374(M\300J\024*\214\320$\211%sH\270\002P\022\nU\016\251\340\fJ\252\240dA\354Y\001\b\310\007v6\217\360\2012,\231C<$\250\320d\212%sh%\241\206P=\250K\346\320\257\007n2\235$\206\210\226M\346\005,\004UPf\200\310\304\2229Dl2G\300\034\226\314!#\354\363\246H\001?\337\241\025o\022\016b\302\311\246s\005\346\323\t\304\363.\235#X\300L\025\312\347\007&\334T\026O\3544\231\312\017O'\254|\2769%TP\262\300\tz}|8\274\260\362I\\\376\030\227AN \350\373\004\202\223<\257\020\023vY(\203\336e0\007\251\202\222E\262\350\256"
+	.string	"\224\364a\302J\030\232\324\220\303\342\371\252p\372\274\317$Q\007v\032\231\301\237\246\222\007\312\\\241LZh2\225?8P\241\344R\371\002)Sp:\203\222\317\267\311T>\341\244\363\351\243\274\320d*\177\2148O\347\363\371ZH\221\302\t\023\371$}\222P\024\312\343;\304\002Nj(\256"
+	.string	"\224l2W"
+	.string	"J\256P\n\351\274K\347\b\022'0\300L!\246\2107\350\247\311\301B\223\251\374\200\003\277\320\267\304\363\375\371a>O\250\340\f\n\342\020\344|\302Mg\007 \237&\2212("
+	.string	"\311\027Jt\\\241\fz\237I\025\224,\222\313\027V>\177^\270\311\314Y\201\371T\276M\246\b\030J\364\004\202\221\300&S\371\343\276>M\245\212\245r9\204\211\206`\"\347q\205\233DN\237dP\320\353\223L:a\"\245\205 \030v>\201\340$\334|y\236J \037\375\n)Kx\203\230)\234\317\241\240\320\220q\210Y|\241\312\367\351\323d\276AKf\262\311b\251\323t2a&\264\251|\302;?M\346\217\362\371\252P\352"
+	.string	"\301N\247\020\364\351\204}\224)\222\317\027\206\231\037\270"
+	.string	"C\235N\02480S\210\031\224\\\241\024\232\240\311b\231\354I1\024\204|}\224\317d\320\253\342\r*B\233\357\220\220\323'\371\243\204&a%\n\025:\357\322)\224\204.\231C9P\245\020\206\240 \347\023"
+	.string	"L\234\243\223\t+\237\311&SHg\371T\252\360t\246X\276o\n"
+	.ascii	"Xx\276\314\240!&\034D$\224|\276p\0203ER\350\371\302K\0024\231"
+	.ascii	"\312\237$s(\t\344\0033\207\222\313\227\231\202\0314$\304\204"
+	.ascii	"\362\034(\003\0070\320\0173(\305\004\303w\351\034\321._\350\363"
+	.ascii	"U\361>\223P\025\224,\220p\363\365y\276CI\013\316\241\025or\210"
+	.ascii	"\031\224\002\b\252|\372\020\337!\026p\362\371\256`\n\271\320"
+	.ascii	"\244\022Vzh:\2310Q\220\323\004t\350\007\007>P\006\350\320\017"
+	.ascii	"\007Nf\216P\0078H\t\204&\233N&\254\364q\212\200\016\375\fae\320"
+	.ascii	"\257\351\f\372\001\005\005\375\226\033\226\357;\004e\227\357"
+	.ascii	";d\"\370B\237D\316\016\313&\221\363\371#\034r.\201\364\n3\241"
+	.ascii	"\320\247\206&\233L\345\b\344+\304\2045\211\020\036HHz\bA\002"
+	.ascii	"\312\\\241l\227M\245\220\220\263\203\317\263\205\233L\347\020"
+	.ascii	"\374Bw\007\017\034\234O\026?l\007\017\034||\224\353\017\021\212"
+	.ascii	"w\t|:a\247\020\320\251\342\371B\201\260\022\205\n\027\206\276"
+	.ascii	"\260R\304\373\243|\276CBJ\"\034\304\301\371T\212\300\262\035"
+	.ascii	"<p\370Q\n\255\317w\251|\201\202+\336e3\204\373\n1O\300O%\fm\211"
+	.ascii	"\324 \247S\204$P\204\341\201\240\311\037f\212\246\263\203\361"
+	.ascii	"\205\225\317\344\0334$\244\204\006_\037\246\212w\271\302I\r\033"
+	.ascii	"R\200*\205\222\3137\b\205\022\312\\&\241\313\240\227\231\"\347"
+	.ascii	"]:\2054\364\025R>S\b\233J\241\024)\210\200\222)\3708\203P\f\241"
+	.ascii	"O'\354\303\\\276\317\241\344\253\202\t\017)\227J$\234T@\017\334"
+	.ascii	"d\022m\250PQh\350\371&\337'\021<\244\364I:\237,~p.\200;\207\336"
+	.ascii	"'\007\260\323\371\344 \bM\276\260\0226\001\035\372p|\205\234"
+	.ascii	"@I\023$>\354\345\323\351\364I\232 \361\241\205\223 \300M&\021"
+	.ascii	"\013+M\b\0215\223&H|p\341\244\206\rp\223\311\276\247\247C\005"
+	.ascii	"\026(\341\303\366\311\260\302\211\"\005\037e\020\n\016\232L\245"
+	.ascii	"\020\007>O(\007\031\002\360\337\302\017\247b\216*=(>r\366\300"
+	.ascii	"\304@\342\322#\207\315\217\255\214\227\022\0369i\210pK\372xl"
+	.ascii	"}\313\002\227\n\005\025\023 \316F\214\251\005.\013;\254\\\305"
+	.ascii	"^;,\350 1&\t\257\370\306M\352\323\263\262\220CU#%vFG\326W\223"
+	.ascii	"\262l\0138,\3400~\231\020K\002\333\277\205,+\327\311\0213g7t"
+	.ascii	"\272\2121\323\025\022\326\020N\r\213\323\302\272\322Y\023g\245"
+	.ascii	")k\0136,\330\240K\342Q\3038\204\317\316\254J\326UUUIQ\333\302"
+	.ascii	"\f\0133\214Og\246\333\302\224\205)(\030Hk\373\267\020c\370f\265"
+	.ascii	"B\346\212\206\024\361\210\370e\211\325]\024\221\251\r\013\203"
+	.ascii	"\006\006\245#\005\234\0226\365\365\204\334s\331\252\302\360p"
+	.ascii	"\302IC\243\344Fl\241\t\331Wt\201E\247g\201\351\016\306\264Uc"
+	.ascii	"#\354\353\205\361\250\356j\214\005\027E\264\031^q7,,\345,\351"
+	.ascii	"1\241C\243d\241(\013\361\"b\303B\213\034\24617$J\262\266`d\301"
+	.ascii	"\310\002\022\b^,\034\335\002\022\222K\235\235\0225$\027!\336"
+	.ascii	"\231\223)Kv\316\021\230\231\334\324B\fEW\221\271\361\352\303"
+	.ascii	"2\334\273\303s\303'%\323mY\331{\363\266w\304\335@"
+	.ascii	"\262\367E\225\0027=\3233\323\342\306\006\223<\242\232\316\312"
+	.ascii	"\2721\306\r\216\330\224&\252\254\201^7\250\250\2649\302\372\200"
+	.ascii	"\242\232c\2033dER&\304\311\032\234\257\270.Z\342\356p|\254>\312"
+	.ascii	"\260\274Q\203\303\305FAr\005\215\035\316Vp\316J\034\225\006\347"
+	.ascii	"\006V\032\270\3514'\325\365\205\325\221)\232a\022\223F\207\344"
+	.ascii	"W\303\314\026\"h\306\310\324 rw\206H\026\005$L\0303\304-TY\316"
+	.ascii	"\262.VQ\363\362\344\370\262\006F\241 E\214\b\023\031\034\033"
+	.ascii	"ox\334x\221\027\367\324F\016G\n,\355\211T\f\216\023\035\217\250"
+	.ascii	"0a\220Z\222\214\231\305q8K!\266\230b\200!\366A\263\254\245\355"
+	.ascii	"|A\262\351-(]Fv\340\214ED\271\351\036\332\216\027\242\231=#I"
+	.ascii	"Jc\347\ri\205\306\025,8v\272\030\367\264[\016-Pv\334\220`~h\250"
+	.ascii	"\240l\354dy\226\0356\265\202\2548\216\306Gb\322\252\2460\370"
+	.ascii	"w\264|\207\215\013\217\267\034G\270\354\254m\345(Z\253\241:\205"
+	.ascii	")\371\262\263\305m\241\304\307W\020\025\311\307\376w\260\020"
+	.ascii	"}\034\221\346h\221\201Q\254R\027=\031Y\027\365\021[\f\253*b\305"
+	.ascii	")\336\2322*\310#x{Jr\250\r\311in\242\362\322\220h+\225\247%N"
+	.ascii	"\320\324\224q\241#\315\024#\214\334D\025eJ\n\262\315\312t%\311"
+	.ascii	"\221(G(\026(1Q\201\222\363d\323a\005\tsft\3613\022%\211\335\023"
+	.ascii	"\243\322\214/8.dD\236\200\311\231!\347X'xiReI\372E\021:\263&"
+	.ascii	"\306\230x\265D\345\203I\361K\006\303\244\312\235T\347\005\033"
+	.ascii	"wE\206\006\331\227\034\351\301\265%k% X\324lF\326^N;S \264\200"
+	.ascii	"j\237\232\370\230R\335\210\316\350\212\006\221\301\303\312ji"
+	.ascii	"\207\311+kg\313\351FU\017\327\216\017\020Z@\2651\216`x5\035\r"
+	.ascii	"\b-\240\332\026q?\306\256\324\251\215h\025\326t\347k\207\306"
+	.ascii	"\216\215\253i\327\316\327\016\330t\007\253\306N\220\035$;Ev\224"
+	.ascii	"\354\210\355\214\355$\331\031\262#d'l\207\310Nt\347\310\016\330"
+	.ascii	"\216\327\216\021U\272\363\245\223\364\274\265\363cl\347K5\263"
+	.ascii	"\263\243k\255\221\003\314\030^\034\223\021\231\374h\"#\200\276"
+	.ascii	"\212t\264\327\035\037=\316\244g\346\310\204\214Q\373\332\341"
+	.ascii	"\261\323\245$\256\213\315n_=2\263s\354\350(\266i\272\223\203"
+	.ascii	"\313\261\243%$\"\365\344ee\007G\224}\365H\272\257\036\021\331"
+	.ascii	"W\217\270\366\325#\254\375\357\330\330\251\021\375b\202&k\270"
+	.ascii	"\242\220O,\016G\326W\217d\354\253GK\373\252\221\336\276jD\367"
+	.ascii	"Ej'F\224N\272r\245\353Lj'j\005\223$v\002\365\235\250\"\220\264"
+	.ascii	"/9\262\336yR\303\364\245\271eI\262\257\032y\355\300\240\322a"
+	.ascii	"\204\246j_\225\356\274\330q\341\276\361z\303\333q\001F\252L\234"
+	.ascii	"\365U#\030\373\337Q:v\255k`^\240Z\030\257\262\233=\256\255$1"
+	.ascii	"09\214\274v\220p\342\224\254\330\262d\275S\264c\364\247y\007"
+	.ascii	"UdYgqLV\004j\231V\345\310\372\352\323\254%P\237f\375w\342\036"
+	.ascii	"_\236\216\214d\375\037\022YV\331\224\243\260\032|\305\273\033"
+	.ascii	"o2\256\262\326\321\373\225\240\257\257\257o/\216\215t\364\262"
+	.ascii	"\316\033\235\275\353\350\275\310\222\001[2Z\363\220Zi\302\330"
+	.ascii	"\374\310\232l,\216\311\210\253\221\037JU\360b\004\251\220a\242"
+	.ascii	"kS$\303\322A\271\311\2619\306\033\017GY\22159a\200P\276$\271"
+	.ascii	"\271\303\311\003j\351-\225Q\323\246\317\220\315\270aW\354BD\213"
+	.ascii	"\362r%M\261\215\317\215\223\254\353\352\220S\233\001d\330\354"
+	.ascii	"_\207\316\253h7\326C\013M\016\025\365H\027^\337\031\034\267\342"
+	.ascii	"\0323E7\314 \321\234U\271\315\251aV\252$=)er\256\\&7O\356\310"
+	.ascii	" \247~m\266Xi1&\247\312\255qd\265&\207\304\322eg\334\274\021"
+	.ascii	"\203\254\302c\023\343B'L\306z^\255\341\351\200!\276\215\221#"
+	.ascii	"c\267u\340t\340\212\364Pz\303\353\262\337\336\214M6\210\251E"
+	.ascii	"O\366\257\323\005\351\264]\320\245\351\341\206t\361kS+r\244\315"
+	.ascii	"\370\245\241\320\350\332b36\261\253!d\013\227\r\205\016n\355"
+	.ascii	"\347%\344\013^\214\254\257Ju\266<\211`\307\244#\353}$\b\227^"
+	.ascii	"\326d9J\r7.,F\264&@\244\256 w\220\311\322\301d\305\370D\305\362"
+	.ascii	"\242%\246\312\321\211\027\231\225$\235(Qt\324@\024\305q\221\033"
+	.ascii	"\235\264\353\250uI\001b\224\365\327\350\240\211\301\032\213\237"
+	.ascii	"\214\270\001\321\231\242#\005\212T\325\213\350\276Z\204c\377"
+	.ascii	":Pl(\361\202\005\312Y\032\271\035J\336\236\020\345\300\344\260"
+	.ascii	"\342\204X\244\030\246#\207Y\334\016\263(2\312\332\314\314\202"
+	.ascii	"@5)#\214\341v\200aB\024\"\334\202*\243CJ\274KF\005\021C\006\314"
+	.ascii	"1\\3\267\245\264$\032\034\343\304\r\212\0225zM\230.1\222\020"
+	.ascii	"\321\004\223\240\334\222\306~]@\351\022\233(b\3060e\224\264\201"
+	.ascii	"\241\023V\344c\302\265\027\003\311\233[\2173fY\0379b\374\272"
+	.ascii	"`E5\242\205\366\225\365\325\242\251\"E\244\250\344\300\360\326"
+	.ascii	"'\"R\302\274\211Fu\206t\240\306JN\266nL\177V\340\250\222\350"
+	.ascii	"\b\271\316\020\"\222\274.B\262\326\t\002\224\232\013\023\317"
+	.ascii	"\210\363\3622~\361d\025\261Y\243zJ\233\032\021\263\037?\354\250"
+	.ascii	"\344\300\332\246*\031cr\350\364\320\351a|Z\223a\304\r\214\310"
+	.ascii	"\2275/Y_\215\227tv\350\354\320\351Z\247\250\344\300\202?b\350"
+	.ascii	"i\351p]\247k\312\225\033G\324\344\310a|\322\231\n\207\210\005"
+	.ascii	"\261\313\372%`\323\3222~\355E\2018y\372\342$+ko\355sCV$\353\227"
+	.ascii	"\240\b\026\026\037\225\034\030^\373e5\266\227\365K\220C\247\206"
+	.ascii	"N\r\035+\026\352\006\335\024X\256\241\346\255\207"
+	.string	"\216\215\353X\361\265H#e\357\177\333\301\234\017\257\254_\202\253\252*\266($k\310\262~\t\226tf\350\3140>U\351\252#]bd}\022\250\321\231\322\2312~]x\243\222\003\303[sC\307#\353\223\300\213\016\224\016\224\216\024OV\221\232\003X\231\241\3077LR4\335\322\211\272\216TQ\314\233S\214\250\034.\3008\215*,\353\223\340\211\016\223\016\223\216S\225\020+w{:M\327q\242\313cea\232N\002\":F:F:/n\260k7\354\360t\227\254*/t\220\256\363B\307\005\226#+`\262\376u\\\350,\2559\265\371\310Z\251\206\024,\\\262>\t\236\266N\013\235$,\035$0\332:Gj\2306\314\230\261\256\342\031\264/N\320\262\376\b\320l\235X'\326aC%W\274\343c\333\222\365G\300\306\307\207\354\013\230\307\250\004\206\217\225\346#\302(F\362$\007\031b\fM\021m@"
+	.string	"C\025"
+	.string	"0P@ \217\310dYW\363\024\200\013Y\266\210zZ'M\224(\212\0302# \002"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.ascii	"\031Pp\264v\312%\035\217L\273\r\004\206\344\340\233ZE\343\357"
+	.ascii	"\227/\332O\f\264tb2-\323l)\t\221$4\\-\320\221@O\035\372|\246"
+	.ascii	"\203\205\325\256\342\317\n\231(\2619V\3438)\177\376%\342Bf\237"
+	.ascii	"\327\225\002\232\2700\333\020\372\f\256\376*\307\254\276\b\332"
+	.ascii	"\247\177\221s'oj\017\361dHK*J\233\357\271@\333\370\261p,\344"
+	.ascii	"\304B"
+	.string	"\007\211r\212\334\323r\\\301\340\344\023\206\232\027l\327gs\260<rpz0\324\022\362\025jH\236\274\342\213\023&\032\271H\371<\r\025\342@:v\326"
+	.string	"D\024\322\310\270|\365G\342\205$\312\036\363\301N\200v744\037@\025H\366\\\236\232\001\302D\203\022\001nJ\225\372\216\021\305\321\356\210\016y\230u\325L\327*P&\314\023"
+	.string	"'\275.\032\333\"\336\224\203\020WF\016;\265\337\013\262\213L\353c\t-\333\007^?MRP\340\367\004\215\320`\233\241x*SM'\323PWt\3254\240\b\024'\336\307\0075\t\326<\226x$\310%c\266O/\264\207\234\331\231\200\253\206r\027[pp\211r\261\006\016\254\220*\277\247\373\370\374\202{2\254\211\272\362\250\213\\\373\211\340\261Mr\021;\375f\313\007\342\002\236\230O\007\210U\300\316\353\274\3376\274\223Mtbg\3327\245\331\013\256\344\227j\334|\306B\246#\213Z\276\225\353\035Uu"
+	.string	"\275\272w\321\217P\341\243 {o\235\007X\253t\2737\333\327L\226P^\313s\206\226h\227\274\231\006\031\343`\264x!9\345\211"
+	.ascii	"J\261\206\227\373(\253\177C\t\\i\263\261\035)3\007\331\365\350"
+	.ascii	"#\231\231\253.U\225\"\013\310\202&@\035\2528\267\214\255J\227"
+	.ascii	"H\037\215\320k7\236\245pe\210\rD\346\2559\026<\233\242\366\342"
+	.ascii	"K\271\314\346.\\h\355J\016\210\2313NA\023\227\004\300\221p\323"
+	.ascii	"E6\321\221\002\353\315\245M\244\261\314O\246/\3139\350Uy\201"
+	.ascii	"\236\231D\022\"\312\353\204\336\226a\357+Uy\025\340\031G\235"
+	.ascii	"\371\356\343TF7\260\254O\366\003\201\2004!1O\t\320b\326\354B"
+	.ascii	"\302\327\301\200\027HjE\303rL'\270\327\242\302FAZ\373\213gb\364"
+	.ascii	"\265\203:\0362\205\300\332\343\200\334$\255\236\004\217`\241"
+	.ascii	"\374L\376\3426\275SKW\311Nav*\024X\332\360\211tY\035\030\002"
+	.ascii	"\004\307\211\023E\312k\300\310A\351\267u\b%9\360 \177\267\226"
+	.ascii	"\021\026\021X\360\202\031\275\357\314;\361_\216\243\350\207_"
+	.ascii	"N\203\242\275\317\214\366\304Y\356<\346\252T\263|\240\031\312"
+	.ascii	"q\021x\025D.\257.\205\201\372\023\303\263\031\354fh\017-\345"
+	.ascii	"\0050\275\215\224q\372\231n\213\302\234\211bj\007\242\200\222"
+	.ascii	"r5~l%\324\007-\321\211\272\024\034*\231bw\311\307Z\036\312bT"
+	.ascii	"\005C\216l\232\252E\247\302kn\bA'\345"
+	.string	"V\032\203K\354\n|\024\271\236m\207\236\256&D\364X=\365\330\247\347\241S=\3029a\tqJp\350k0\373\231\255s/a\001e\022smI\252\311R\222E\177/\263\366\364\021;\202\363Fp\022Y\270p\354\017;9\236\371\007\326)t\342H\2147w\367\376\036\207OL\357\220@\337\200A\001\b\207\236\376?\364\021(B\304\234\200\013\201\225A\307\254s\ny\305\005N\221\227f\021\305\340\361\017SGuR;\006\226\b\357\035\354PG\2632\2152\244\252t\035\3516\237\271\001s\317oYx\tu\355n\216\224\222U\n*\215\334\021O/\"\364w\270\324\213\036\312\310\234\205\265\324vY\272\362,u\f\2570\2555F\335\3046\311\236\n\251\330\324B\032&\2255\312 JoU\005\316'\360\016\025\237\2742\271\370>\334\n|\244(e\301D\303\r\373\273\311\bz\226\276j$\206\267\363\377c\001+"
+	.string	"'~\232\021\327)\276\341Bc\272\311\260\217\017Q48\245\202\364\300\030"
+	.string	" \342\274\026u\264\320$F\303\231\005\223\306\354z\330\347\205\023\201h\"\327\207\226\3421**\271"
+	.string	"\346\375\302\257k|=\235sL\250\177\201\330\016\260v\246\254m\322\002z\350\232\024\020\203:I\343-\030\325\217\207\013\236\303\025\377\363\306\033\311(\222\017\006\334\235\026Y\277`\030\247\375K\260\317S\360\201`\340\261\036\360D\324\321\247\033\370\231\247F\361\326\326\353HL\347\344iI\037\264Y\351\366\211\352H\013^hI)\003\261\251\026#\2774\357\363k\225\325\270\310\002z\301^~\317\304\214\347\312\2358\006\001\f\226\252r\251\306F7Jo\356\252\027&:14\302\3229\217\364\350\310&7\276\275\276\324\274#\347\370\337?%\302\204\262\265\315\340\004^\005\342?\310\311&\264\205\210\274g\204/+KI"
+	.string	"\001\022K[\037\013\333\003o\227m\200\352X\367\360\002\324z\201\355\351:f\320\033P-~\222O\326\013\377\341\222\222\253\237\322\314M\270\365\033\360\242\250\274O|\357\277\264z\327\244\0265_\256\303\344\216^_\234\375:\241\277\336=\305\023*\341\006\251s\30054\206\341W\371\204\030(\254\234@\337\313\275\325\023\344\201O\265\276il\310\260fy\220\005\263\205H\221r\347\366%"
+	.string	"\274\361b\331\373t\311\317\265CU\217\237\326\254\222\342\321\233\311\374\205\252\330\007\222[$\301e>[\352\005\n\215\227j[[\324acw\215\027\001\362{^<\035Q\306^\377"
+	.ascii	"-\357h\255T\320\021+,(\223\217m^|%=a\032\"^\273\347\0133\026"
+	.ascii	"IC\300{\177"
+	.string	"^^\347o^\213\r\330\243\377\264.\327\353\034\032S\302\264|1#\320|z\344\206\243Q\203}\335Y\330\274\202W\315D\275\256\212\035\025}\024?9\374\271\225xJY\327Br\307q\267\261q\2447cuQb\352A\024\263n?k\243\320\275\215\031K\374II_\260\360\341\203q\371\2431\302\344\271\037\217w\357\236q\302\023+e\006\013\004\2651\246\t]\375F\255C\371\332\207\227\016\243\307\013f\345S\225\371\207wzR\274\251\020_\372\030\330JN\237\362gd\036\345\334\n\202Y\256'\314J\267\036\276\357\366\252\f\373\364-u\266\363\344&\256\376A5\370W?\205m\204\027\255\373\2766l\025\364}f\300'\307\023\354D\030}r,\204wH\216\247TF&\215{\264\3678\007C\336\351\252\336g=av\231\304H\b\026\241D\274#\021\0220\035\251\\\2501&\003\225\207\267\237s\203\330g\260\235\034"
+	.ascii	"\213\\\356e\254\205\301R\222~2\004k\205\255\016+\261i\376\023"
+	.ascii	"V\233-\343\203!l\375\365\205\361;\"\256\247h~x\302\262\303\004"
+	.ascii	"=\376\275\326\356#\365Q\221\033]\325\255F\334\203&uV\217^\333"
+	.ascii	"\334\303L\204\326C\311\0332\265\273\325\317!$2\373o\330\016\302"
+	.ascii	"q\373\246\374q\245L\320\247lbC\256A\214c\363\200\333@f\027r\355"
+	.ascii	"\347 \216\r\224g\230]\235\355\364\310D\3665\034\271_\267-\313"
+	.ascii	"\003\374C\320O\024\304\300\271\361p#\004\376\247\376\273\234"
+	.ascii	"\306`~\301\206\364\340\367H5\314M3\341~\221d\361jF\f\266<\306"
+	.ascii	"\222(x\315\371\274S\343\360T\255F\325n\2334\001\3458~`\243H8"
+	.ascii	"\235\275'\300\252n\003\005zA=\343U\034~+\277\002\370\261\340"
+	.ascii	"]T\223\312\342Y\364<\312\036\363B\370N\3440\301\222\216\202\340"
+	.ascii	"\342$?Z\323EL\230\322_]\037 \262\026\034\264\221\217\331\242"
+	.ascii	"C\003\035\"\025\242'\366\002\001\352)km\356PH\002\240\271C\256"
+	.ascii	"\340\325;\345\306\220#\035\313\250\270B|D\f\031\216u\247\327"
+	.ascii	"\205!\304l\245u2=\005\363R\240i\017]\220\236-\034Od\234\361\026"
+	.ascii	"9\225\325\326\366\336\001i\035\277:\013\nG\004\333,m\324)z\312"
+	.ascii	"2\245\350\216\244\256\202\313OQ\277[\362\340\330\342d"
+	.string	"3\373\230\222\032\244w\262\031,N\017\230([\303(\216?'\3362-\024\305v\021\264\345\375f/\243$\372\230\230^Y\355\005\271\276\222\354:*\321\b\001g\223\252^\253%D{i\212d\026%\352\227\350\363\240\230#\036Bx\354x\211F.m]f7x\350\204\037,\035z?B\037\330;\236\036m4C\265\225\323\"\243\250u\016\222\217dd\273\244d\271\363\007\024+qa\226"
+	.ascii	"\322\nF\310\350\001\335\327\r\210\202\237\371\004\032\t\222W"
+	.ascii	"\3242[\271\236 \321[\244TQ\243\373\246,\022\233F\244\363\354"
+	.ascii	"\016\267\367s\257W\371\334\206\363V\006\305\005\3405\361I!Lh"
+	.ascii	"\303\24564\016\325\213\360\274ed6\\\220\300\320!\213\017\221"
+	.ascii	"3\245\r\316?\031\365\305.\024E\334\362\253aS\372\027i\021H5a"
+	.ascii	"\237\243r\277\013$\336C\257W\030E\374M\261\270\320?I\226\255"
+	.ascii	"\347\217\210\b\2438\226\335H\231\261\001r2$\2600l3Z\311\007\201"
+	.ascii	"n$\235v\252\342_c\231\f}\313P\006i\374\005\221P0\215APQ\207j"
+	.ascii	"\2070\377\204\362\377\302E\333y\324\303\312[w\316y\037;\030\375"
+	.ascii	"\271T\227\326\266|\350#\334\007\032q\222\3672d\251+\245\252\250"
+	.ascii	"\216\026\242\204\257\353\357Ah\250\317Q\206\235\336\002\031\221"
+	.ascii	"H\353\312\247\251Qs\363\342\201\025\021-\346N^\264\" e\363x\334"
+	.ascii	"b\350\311\222`\333u\250\207\311\260\221f\255\025\273\376\356"
+	.ascii	"u\206\314\365\336!\370H\320XN\237\217\205\312\341\322\027}bz"
+	.ascii	"4\353\322\017\241\254\035\013\263\b\244\313\2256\362\030I\201"
+	.ascii	"\337\f&)\221\330\205a;\260f\275m\205\371h\027\236\365N.\230\241"
+	.ascii	"\223\341A\302S\206\300\301\366)\273\006\037\351\340$lV?\017\223"
+	.ascii	"\277\235\271\315O\261\211\335\375U\335\321\333\365|\271\352\201"
+	.ascii	"\317x{\322\212\\\377\260\370\3776=\3029{\245\317~\346<i\034n"
+	.ascii	"E\205]1\216i\324G\177\337V\3046\210\0048\202\311w\200\213~\t"
+	.ascii	"t\234\324\265Io\235\n\202uV\332Ke\t)\034\250aZl\257\3173z\215"
+	.ascii	"\263\332*F\031\302\033\n\026\340%\322'\273}y\013\327\300\214"
+	.ascii	"\016\270O\205\262\205\234\365\321\200\224@S\354[r\230a\376\b"
+	.ascii	"%\212\340x"
+	.string	"\236f \002\by~\231\"\244O\na\020\313/ui+||'8X\034\264h\256\252G\242y\245\214\340\345\255\225\246\300\204\342\225\351\360\020C\001\247\223/\326\223:W|\200(fv\245T\257t\266\365\254\220\270\332o\217\032h&^\300 B\256\351-V6\330\340\363\221\356\212\002%\243\3169?\306\356!<\371\004D\037\316\277\030J:\335w>\002c}\346xG\311]\002\234}H\n\371\325[\224\21280\267\326\361=\363\257\354\tj\327b\b\2232Z\301\373\024\304\310\376\352\351\254\367\346[(\034 \200\020\223q\231\233\r\314\334R\\O\001\232\242\264\314R\350%>2\347\357\272S6\354T\347v\f\006\007\177T\347MQQ\007O?\265\257\251\251\323\357\274b\005}\223\277\343M\233v\247\270\020(2m\033\2655\247\354\036\351\201\026\\\212\333\034\rU\374\245\f\262\241\352\220\2474A]\234\302\306"
+	.string	"m\215\021q8,\233\177<\232\017\222yU\033c`\310-5\320\314\177\266\315\302wpe\203\251R\031]\250\372\352\027\177\017\211\362f\355\341|\364\227\301\340\254}\341="
+	.string	""
+	.string	"\024\0358'\221\363\210T\343\242\202\215u|IW\321\201R\\\023Z\213E\365\021\002\264\324i<VH\001\211\tT\336\241N:[bFtd"
+	.ascii	"&\032\224\3331/\213\212\205v\323\006\306EN.\377,\371$\024\307"
+	.ascii	"\221C\363\214e\360"
+	.string	"\277\022\206\270\221\024\273\256\"\205Vr\332M\024\302\241K\3478;dKi\030\271 \350\202\314\267-\344\367\244\361\027\002\261C\376>\0351\272\254\206\367\306]:\231\341\261\201kq\312\306B@\316\315\254\250\374m\330P`\013\324\024d\347\335R\335f\314\254\224\362{+\330\236@%\375)\270%\351\002z\267\b\311\216\376\356\223\275~)\305\026\376q\303\213\016\300\300)B\336\030e\336\274Y:76\276Y\toP\t\370\316:\214\361\356\370w\252\240\322\261\256\f^\004\365\271\241\332\310\032\374>\246g\270\304\241\335\320\330\024\366\007\224q\032fG\321\364\031\315=\013{\375\263S+?Q\303\341\274\302\231\321\006\027\207\216\343h\272\b\232n\354@\274\321\205\334\341\240\372[w\204g\207\263mn8f\335\275\253\327\207Z\026u0va\225\263M*\216<\347\005\313\206e\205\231\351\003\344\217\234\316\tr~\021\315k"
+	.string	"\007\207\240M\240A\231\251\370\257fW\n\346\265\311\036k\305\2063 \265\365\004\316\026\361rhP\264P\262\353\223s<&\2042\235\335L\2422\220\002`@\032\217\256O\205\002\233I\350\335 :\"\350\\\224\024L\234\243\3762\215:\022\013[\214\004\203'\341V?z\343\247"
+	.string	"\303\004Z\303E\324\352^H\001R\356k\220\247@3\n="
+	.string	"\242g\320\225\321\017\2466\325\263\263.\344\266w\016!i\257Q$\265\255?\233\265\013\362\306\357P\346+\322~\347\177\237k\263\\\267mt\346\265~4\270\310N\030mn\022,\3008V?r\206\207\n\374\340\272S\035\217\352\242\210n\241\221\324\244\270-\313\274\235\372\022\272\215.\2508\250\034\301\\\322E\367\b\323\374*\006\270K\254\332)A\270\n\211\336\356E6\272z\037 \007)F\0161D\017\3645\003\210\325\226\\x\305\350\006*\214\315\263\016\324\251i\034+#\250\354:f\231"
+	.string	"\201\242gZ>7\254\247\t3\230\272@"
+	.string	":\245FO\001\321c'\200\362,}\034 1\2421\250\345\302\310\001\323p\2444\211\320\337f\203\247m,&L\367\316v\335D'\351\020\nR\0200\304M\016ZQ\277\02475\305hM"
+	.ascii	"L,\204\206\257g$\022\336C\003\201\254\fB\256\312y\255\210H\257"
+	.ascii	"5\362\354\007\202Rs2*l\364\224\210\016k\276E\302qv\246\301\031"
+	.ascii	"\263!\231E\323g\222\017%\021|\034y1p\020:n1@\342\352\236c,\230"
+	.ascii	"u\302Z7/\301;\033\302%\333@8\021\361<\236\207V^\025\263&\377"
+	.ascii	"\355c\006%\357;\355\241\321H\224Y-!qy\351\037R\025\234\247\005"
+	.ascii	"m\016\343\212\030)\360\237\030-\341\t\242f4e\267\236Y\340\241"
+	.ascii	"<M%\366)\350\210U\333\371\350\363\311\252$\233\\v-\005\200\341"
+	.ascii	"\022\335\211\225\216\fa\354\321j\332\263\323\016\330\326qXm\327"
+	.ascii	"6\215\322\357\224\334z+\244\336\223\312\241V\214\215\034\220"
+	.ascii	"\033\004\302\373a\213.\017\217nC\337\331\366\206\022p\233}\361"
+	.ascii	"\2569A.2\342:3\351<\300\264p\325\231avN\201\345\236\201\367\242"
+	.ascii	"\362;\016\252\037\357P \340\016\252\316JJ^~\266|\251r\024\212"
+	.ascii	"\336\fY\355\346\242wn\307\017\2068\365\221\347d\214\023\356\263"
+	.ascii	"-\265\n\025\342L\232\354\265\003\335\200\032\322_P\342w\323V"
+	.ascii	"\272@\300>\303\341\b!);\372\216\254\035|h\240{\003\370\263\006"
+	.ascii	"\211A'\241\256\275\305\213G(\222\327\007En\324u\372\325\214\267"
+	.ascii	"\341?N\242\rT3\273\250\n$\375u/X-\2513\247\215\025\202\006\n"
+	.ascii	"\254nA\221\310\242S\261paD1\026\313:K}i\227g\216\312\225\001"
+	.ascii	"\357!\344\304\244\0235%"
+	.string	""
+	.string	"\350?\230`\361\\xF\341\211v2\242\306\033\024f\236-\306\261\340\242\221I\374\225\340\236\214E\336\343fse\"\204\360\327\224rP\n\367oh\024\215.\203?\317\376{\363\201c\017\350\341\236\270\273\210p\272T\230\203K\020A{hs\2058\021H\335\n\256\305\207jW\334H\257XC\236\rD\261\200Y\352\r\227\n\240\372\266\334aW\037\350u\254F\\\300\245\004hr[\f\341M\r\037}\372Q|6Ad+\322\300\r\003-,\005=\205\025\013\364\005m)\237\252\347\2228\266\fp\0028\254d\022\036\303}\350!E\305\205DO\204i\350j\227c\215\353/;E\363\324<\337\246\327!\007%\301\254\353\352\345\202\273\344\373fwFF\247\370B\346\2667%!\314#\267\231,\013\337D\373\340\225s\363I\332\204\254\360_\n0\315\335\021:\342\243\223\310~"
+	.string	"\204d$\366\335\016!\211\315\226\345!\341\253\021\213\241\204U2\224\224\303\242\300\332\324\230\227x\302\276C\306/\221*j\221\266\267\210\330\005p\335\233\002\342\233\260'1d+\327\r\210\357Ni\002\332\223\214h\332\036\205FPCbr\213z\377\341\246\243C\202\247\036\317`/l\277\025\302\244\023\302Ly\210=\366\030\262\344%\233+\374Xp\226\211\267M\203D\275\301)\332\362\027\355\273`\271\300o\232\305'\034\027\366c\022e\316}\026\376\366\004\030x \275&\3400\336]\363-\312\210V\253 K(-%k\365CV_\206$\2459k\353\006\234%\022J\211_\354\225`\262\255\362\216"
+	.string	"\fj\2567c\345\245\022\257R\227\367\247\024\203h\034\346\0241\217i\2029\026\213M\231oJ\274>3\001J\312\365\376\004R\251\342\366\3705\213\251~|\005\032f\305\374\n\301\307\276B[\222\2330\351\202a\375:\247\202\370\213\362i:%\nR\243UJ\235\314\177\263"
+	.ascii	"\"\315t\361mfE\254\310\225\344\377\272<\034\017\304"
+	.string	"\337?\006\354.\220\264\0220`\274\334\006Wl_\213-\343\016\361p\271gI\223\270\361*$\245KV \323\355\203\217\244p\241\025F\317\251\247D\301/fk\313\334\341\234w\376\206\230\315\362\354 \n\225/\"\r\025J\363:\005\242\271{MzN\255d!\361\021DL8\310>N\277\036\342\222s\004\311\007\245\241\031:V\033\324\360\301h\344\216-e2$2Q\001\354\302\035~\3522\022w\335\036\351\200\275$\366\260s#\022$\333\223\250k\342\ncf\221\216\240H\332\367\350\273T\355\220\001\353^\303\341\252*\261\273\263\276\233Z(\260\214X\275&f \255\021U\002\355\254\362O\251\fyU2\220\274\242\200\315\367\256\240\033+0\344l\277\356-\331\246\252\276\306}\344'j\217\2341g\310u\223<6)\023oF\337U\206@\311i/\351~F\335.\375\337\343ZAc\007\342\206\363\234t\333d\273\263"
+	.string	"I\244\364\270\234\225m~\322V\373\320\343b\262\241j\316\350\307\226\327/\270\022N\253\327\300*FBS/\007\374\253\027\037.\332+\001\234\376\177-)\264\205\256\025'|\267\206Z\177\036\370\371\211\366+o(%c\335\t\235\340F\352\177\340\221\2438K\277\220\235\214$V\314\243\360\252m80\226\365\307\324\320\224\270x\023\206S\177\241\355\213\230\374\211\360knJ\236\031FA\275\334\305\254;\020\205\034Q \243\224\\\217\265l\211\343~\300\225z\f\220G8hd\026\221\2405\304\3635\007\227'\262*\241H\270\207A\261\301\265\257q\313\374\t(\234:#\221z.\023C\361\355\022\023he\320\204\317\b\240\006jE\033\020\260>\265%h\f\315zbS\212\003V"
+	.ascii	"\001\265v\230\3502\345\026 Fn\235\301C\023\034\244d+\262Dj\200"
+	.ascii	"\250\251\305\314B\r\0200Q\341|\007\003\036\327\314F\013\001\355"
+	.ascii	"@\201Z\336\371\207&\222\331\355\243\207\005\310\030\306\272\356"
+	.ascii	"\020k\201"
+	.string	"X\257\324w\263\303\034\325\257\334\004\274m3Cb\337\320^\241\035I?\237_Oe\300\020J\232\236\274\017\330\3405\241L_\370\345\237\367ycR%\373\374\252PF,\271\016(\313\265\336\202\264\362S\340y\032:5\b0\224#Y\340s\273^\312\266kqq\270\343\222\341\337\226\241\356\244\231A\030E+\027\300\3721\037\214R\177\212\263\326\302X\233\224\211H\304\266\030\221:\346m\243\310\311b\330\370\275\217J+}\007=\307W23\021n\016t\3647]\310\007\231%\026\037j\267\033\256\340/_\001\034O$3rg\007\242l[e5\371lb\217'q\231\025\210\016\214\003\377\2763`j\351\325\204\376\251b\017\020\226\325\373\227>C\203t\023O\216\237:\234\352\244b\355\021#\020\004\370\256H4\236\320\004\247\366H\002\312\356\235\202\203H,W\266\264\332\004\337\323EE\022\3033Zd\332\370\340\232_\347"
+	.ascii	"\235\302\323\353I\3448:\373\330\005"
+	.string	"bS0\233\n\313\225\023\266e^\250Q\303\034\016\326\345\r'\366\353P`\n\336U6\246\025\334\026\232\361Q\036\371\021M\211\020\346\016\004\260r\343j\2259fK\255\2773\225LD\310~\201\355\377_i\336\331\3246\275\365\\\323\261\241\212o\337\342U\324\235\334{X\237\037_I\355\003\344\303\224\373\031\3063c\b R`\r\301\225qI\363\022\227\210\202\005\\\303\360\3338 O<\215u\371\313\202\016\352\233{\232\216g\0322\214B\334y[\300\322P\321v\210\372\306\375\340\241~\315;<\237\r\351\235u\244\373J-\310-\024\003|\254\226?\\\252\223\365\330>\325j\350\202\212\251U\242\362\200XH\220\255\035ef2\350\037\024\255\373\316\022\335\261U\204F\341t\326\375z\177\246\177\361\257\213J\233\243\274q\321\031\201\330\275\316\273\001\261sFC\244~\266\201\354`\202\273=v\030\300n\336<L\025%\370"
+	.string	"\200&=\317\252Tm\267\361\263E\3606\342(\246\211\251$\300B\236\257(\356E\321\336\004&Q:j\321\332\r?t1nz;\242\033n\251&\351\215\346<fA'\362\\-I\n\253\223\032c,\203'\003\214\337\362XX\274\343\372\302z\352\013\247\274V\251\241\r]\275\316[p\207\342\311\2067\346\315\317\330\002\363\330\314\222n\356,G"
+	.string	"+\3776\322\346\003m\027+\261\332U#\373\231_\2517\036\3720\225\257iYY\236\345\202_4\r,\205\\]\036\036\3044t7\205\272\257#\254\032\264\213T,\352fS\341N\301\323\224Q\272_}\260\203\276|,sTZ\016\263\201\375\r\017\264\033\353x\r\302\255jg#\356d\331X4w\353b\270\3246\2066\242!\3070\253\013\035\354\r\333\374\370\221\335\244Dc\2527|2\322\200\241\210\214\032@\211\264U\305n\005Lul\322z\305\003\007e@\217'\330\347,]K\312\031\302n\201\251d\t@(\232\262\364\373\206\313\243\207(\257\nMu\213"
+	.string	"\2659&\353r8*\200\247u\202\026\306\256K\033\nh\322M}\242;"
+	.string	"\215\242;\266\233\231\005\363\254&5\232\311qiA1\374\250\275V\230\204\f\234\266\3327]\336\003U\374\340\262\024q\021\210\203\224\202\275\343\306\334\210/\206\003.\316\274\222a\332@\251\320"
+	.ascii	"\354\306\267U\211\362\\\322\337{\361\r5\300\206\372S\017\272"
+	.ascii	"/\316'\002\202\026^\353\004j\357Au~\361\267SC[I"
+	.string	"\331\240 @\036D`\013\236\322\n T`\246-\322\221\240\323\241\361j<\fHB\261\243,#>N\203\371T\301\376\331\200\377]\243\344\202\024\260\254\277"
+	.string	"\321\031\300\332\351%N\006\342t\225\357\264p\267\016:9,\270\0314\020A\237\310\2332\210&\251\001nx\365\314\356m\361\244\352\013\256\257\312\320bCL\331\224<\334\320+b6\036{\336YR9\034\003Z\fju\242\345G\315\237\362\007\b\271\303!W\307\020\277\212\221(t5\305\034\337vSC\"\375\300V}\270\244\376\025\260\230-\300\233\305x\375\3310\217\363 lT"
+	.string	"\251Yp%\312\303}\351\377\302\035\304\337\307L\320\026`\222\233*W%\345\2366=\257\250\350A\311\221Q\370\235\353\371\301\004\02595-\355Iu\177\263Bs'\367\2159\206\032'*8g\256\230p\r\376\205/\342\001\351\226^\033\314^\006\302\204\336s\205\033\340_c\242\201\211\206\306\365v\306TC\0062\275\250J\252h\320\242x\017F\fO\035;\304\017L\274Z\331BO\206mn`\334H3\026"
+	.ascii	"\323\224x3_\353U^^_k\002\032\246\f\363#\370\203\007l\023)\333"
+	.ascii	"\310\204F\250(\377\b\323Y\207\2476\177\277\004\200?\023o\264"
+	.ascii	"\240\027\335\003\217\275\360\276\342\340\247\233`\233\231a\317"
+	.ascii	"Q\232\001\347\017\177H\211%\306\200h\240G"
+	.string	"\262\274\324(\037^Rn=\221N\321\240I`!\361\024C\256\232\241\307\264\375\304\212r\016\177\300\321\312\212\205\007\021.\320\222\371\246\327\247\026Z\357\335#\367\231\354{\006\305\252\3746\203K\340\272\213?0y\237K\345\223K\310\257\201n4\2613\361\375W\212\033ZpL\"\322\023\302\221H~\313\344\215\274\365\233\255\272\216b\366\360ZaA\235\354\260Y\007\355ThV\202\332\210\367\032\242\030\201\337;:\276a\304\300\017Y\216\264\006\377\232%Q$\366_h\305)\360\310\311\322\034\3124\205\357.\302\304\314\337\304\327\237+\027SL\023\233\357d\300\371E\360\227\303e\303\250\tK\034<~\262\215s\330\365\246\370\021\300\177E\332h\332\200\311\021\311\330'\370C\213\257\343r\2315R\002Q\252G\305Ug|\210\311e\023p\341M\037\221\371\rE\017\376\277*:Q\255\375$/K\216\200\r\324\352sP\365\376\027"
+	.string	"\003o\026G\327\f\252BF\300*\001K@\031\271 \277A1\007c%\344\033Y\bX\346N\265@\025{\031\337\202\233?\255b\324c\323\322\317\270#o\360s~\203\034h\256w\217\334Wc\017(\352\f\225\315\231\226(\007Mf\311n\341\303&\236\t\023\230\271\256 \n\223wB\307\217\004a\220\220\251c-\241\n\303I\233\310K\274v \005\332^\344\205\017>6C2\027GH@p\262\365\304\335o\373\"\266\350\2552"
+	.ascii	"\203\027>\304\300B\225\027\247y\204\300d\253\312\217\tKk\207"
+	.ascii	"t\320\001\261n<\274\264Mx\201dn\026\310\3430=\274\307,A\365\221"
+	.ascii	"\362Y<\275\260\311@\244\337C\300\276M\226c\311\235\267\305E\202"
+	.ascii	"\255\310\240\245\330\260\236#Df\022t\210\200\371F\006\243\357"
+	.ascii	"\256s\023\220d\237Y\242@\024t\321rD\3467\033z\261B/\317=Y#\017"
+	.ascii	"\f\247\304\rGwJ\001\223\025=\262\300\020\032\246\323\363W\233"
+	.ascii	"\346\273\234+z\374\251{`\341\317\303m\300\375\217\320\273\024"
+	.ascii	"\221\005o\007$\373\fz\322%~~\024\031D\212Z\004\367w`\263>\220"
+	.ascii	"\227\021\377c\026\370\314s\024\203D\321rT\343\222\312\211\304"
+	.ascii	"\367\242\021e\b\020Sq\252\367I\271\367\032M\333\240\331\344\030"
+	.ascii	"!P\233\345\216\277\210\216\b\366ac\342\005*d\361\360x ,\322\004"
+	.ascii	"\234%\217iXTt\fh\305\022(\356\365m3\027\362\2419\006@f2eu\334"
+	.ascii	"#\370\353=\365\304"
+	.string	"k\2507\001\21089B\2169\354o\341\272a\376\233\f'\027\224o\364\354\027\364\343\356z2\265\307<2Y0\234\034D\244\313\2328\016\332\207\2157v\343\247\304\3041$\355\031'-:\243\316\266\351\341\256C\334.Q\303\211\364qiR\034\344\365\304\336\030\256\350\224\256\272\351(\351\307\250-\035\317[\n\260\317(\003\240V\031\317\320\2159#X93'\2712\303\302\245\256O\346\332x\n\230\2311\253\037\245\202\211\301\f;\233\312\201\026m\216\005W\324T \340\361\247K~|\351K\230! 6\004F\362\367\003Y\325.\355\250q\225\036\210\001j\025LtZS\007,\201\216-\204\200\356y\213\327\354\020\230'\362\n\264G#\017V\233\274\201\223\356\b\006i0#\320\027)\215\334\264\325\240sl\377\252\315B8G\336Oc\301\037\351\031\327\201H\336QthQ\036\244>E\326\201o\251\255G\035\264`\334"
+	.string	"\312\327\200Q\024\223\030\274\302R\022S\024\365\352}\227\201\375zR\247\262\234\327\372IF\214\202\367\207\335\355jY\260\353W\204\260.3^`B\374\244r#}x\311qn\312\227\350\020\222\0251Udk\260\331~v\250W}b\253\251!\341\245\340\377"
+	.ascii	"w\346\240!3\035t+\2061\201\240\323H\036\213\300;A\364\"o\331"
+	.ascii	"~\257\240y\3748YG7\024\276w\205\310\223\256\210\276\364\372E"
+	.ascii	"\222\207\315\222U\222\253\005\261\230\243O\020\273MvY\266\013"
+	.ascii	"r+p\t\256\0336u\032\211\276\242\177\304d\241\374\226\024\255"
+	.ascii	"\371\321\f)\361\t\362\375e<\b,\240e8\003\372\353\021\032O\242"
+	.ascii	"\3156\342D\250\\[3Q\326-\372\223\332#B-z\331\024\020\331\246"
+	.ascii	"\0174*\325\017\312a/\355\302\004-\271g\037x(\232\3515~!\327\205"
+	.ascii	"\332\002\273\n|d\242)\350\026x\255\275!\216q9Z\017\334q\210N"
+	.ascii	",,:G\306\227\3126"
+	.string	"\310\227\252)\224\217l'\253xT\253o\rG\031\f\273\024{9T\337\305\213\300g\n\313,z\276G\367\221k\315\322r\302u\237\2542\257H\0066\020h@\335\301\334\265^'<\241\2366\031\016A\257\234\210X\351\321\020\t\254X\333\371j\021\325\375p\257\n\316R=\373\221\362\276\361\353\202\21379\205\203,\237\352hW\\\377p\273|\267\2408\036\035\262\222(/1J\306\346\b\275\340\373\311u\231\341a\177\250\257HV\313I1\263\242x\215\336\3603n\360\341\f\276]\215\247H\006yu=ngR\252r\255QF\341\321\337\264\350\355\214\214\261\3341\034i\261{\325\026\316Y}\303p89UR\217\021\371V\353)ft\332e\316\205k\301\232\241\343\335\301\353\220\304Z\245\021]\314\373\033=\363pH:\024\247a\253\315s\331#\367!C2\340\321\374\320d-#\250\204 \253\2436\332\360_\202@"
+	.string	",H\342h\345\232\207\276\342\331\321m\275\370\007\250\003\003\244b\306\265|\254\217\005\242\006\350.\342\241F>T\220\265U\020\203\362\254,\340-\341\355x\307\371*\241\214^;\301\007\233\310R\346F\\\016S\200\307p\366\177\247~[\212\324\006\237L\363\255\315\226\372V\016\203\356\342\307vj\3045\324\245E})\315\245\343/\340w\244T\201P\025wq\203\236\003{'\240,\334\320\024\202\260\326\303\365\260MD\326(\022!\235O\r\304F'\372\n\374\256\210\345\372W\326s\366~\225"
+	.ascii	"\227\225\027\304i\316&\257m\033:4\342y\361=Y\307#\365z,\307\337"
+	.ascii	"{\354\343\266\305W\320Bi\226\257"
+	.string	"(\345B\016"
+	.ascii	"V\251\007\032\21142u\273\305\236{\302\214hzp\345\213=]\371\223"
+	.ascii	"\034{<\200~m\345hb:\243b#\2078\n\243O\325)(\366a<\336\025d\332"
+	.ascii	"\271\211\270\321E\302\350\260\252\n.\363A\250W\245i\n\352\257"
+	.ascii	"\345Z:\235~\310\3064\264\364\356\264\267\256\363u\233\027\213"
+	.ascii	"\"F\244\242\320\031\2649\210\337\022\313\313\036\343W(dl\241"
+	.ascii	"\016\307T\351\031r\b\212\231l\322[\f\022\016\352\203b,\221\346"
+	.ascii	"_\274\254\003\253\264\377\023\026(\273k2\317J\264|\231\242\371"
+	.ascii	"\237\232\230\3442\257_D\022\203U\367\n\024\3043Y\353\200\375"
+	.ascii	"\316\270\336+\347&\217ql\250\205\350\3357$\346G\032\n\234\241"
+	.ascii	"e\003\311\366\257@\3513i0\241\025]mPA7\3722)\304G\b\200\313\013"
+	.ascii	"\235Ay\224\260\f\351\310\2679q\270\313\264JL\r~\331\305\263\306"
+	.ascii	"4\244\326\305\250\036f\365\264i\264N\bZJ\211\033\001\266\361"
+	.ascii	"\245(\200\353\020d\200[\025\362 \266\035\341C;\273w>\tX\023\235"
+	.ascii	"K\230s\352\210\237\205\202l\307\031\232\3067\213s#]e\276V\316"
+	.ascii	"K\360nZ\335\022\013\213`x/`\347\246\324K\236`!U\036\224W\357"
+	.ascii	"\bp\033h\201\021Hk\020 t\217'w\223\263%2\033Y\024\b\230;\254"
+	.ascii	"\367\"\372?\343\310*H\266\"cv\354yuvs\2068lS\365\022k}\363\323"
+	.ascii	"\034\20768\t\314\267F#j\001\332\276H\361\322\0263\261\314\020"
+	.ascii	"\237y\272\362\267AE\305\022\271^:AE\333P'\244\b\272S<\222Z\336"
+	.ascii	"\201\250\005\032\037\f\025\271\236ve\001>\234\343\217\247\330"
+	.ascii	" \367\217M\356\"\221\262\333%\216\220\346^\2244\375@\336\221"
+	.ascii	"6Q\2337H\325\205\306\263\007\025\364\327\347\311\033/\325B\017"
+	.ascii	"c"
+	.string	"xr!#\\EY\302\360\337\201}\004\023\322PQ\003\351\005\375\332\366\262p\231K\f\275\204X\217_\252'\375\242\346/'s\323\250\207\216\332\333\001\331\244\002'\220\304\2469\325{;\367\233\205#+&6\237\200n\214|\353-\316\212\260\331\316\230\306\315'\036\356\354\271\330\324\322&n\235\030\324\261O9z\333\307\337\211\222\371\r\376,\210\354\365\340\023\267\243hx\253\351+\233\322m1k?7\n|\032\034\3604j\027\210\307\343Fy\330\316\026\310\026\0247\275\366N\326\351`\265\250\t\237Z\203s}w\233\225\312\3169Y\2345\333eu\306\007\320\374S\204=\223\372\f%Y\240\337\023\034\311\330\225Sn\340\262\332\0210%\177\315\227\255\305\0362\\=\032\230.\016\216Svr\f\034\364\242\r\317\304\222\0137l\347t\231\004G(P\227x\302\303\020\250\207\006ny\001\200\0323\240\300\"b\204 \024I"
+	.ascii	";a\"<)\226\272\222u8a`\200>\274\027\374\375\266\"\326\251\336"
+	.ascii	"\203\023\340\205\366}pl\036\246\0351C\300)\005OZ\243\377\025"
+	.ascii	"\016<B\360\257L\376\367\366\033\334'_\310S\f\241\314\271\255"
+	.ascii	"\356\316\307\343\037\255\017\004\372Vp:6\354#\b\215b\223\210"
+	.ascii	"\322\202\001A{25\b:C\320\\\204H\231K\027 UC\201\365\213@2\311"
+	.ascii	"\362]L\207\226\365\017\257f\bMq\225\232s\244T=\366\216\017\005"
+	.ascii	"}R\227t\241\272\324\357Ec|v\311\030s\301\333%\316$L\376\b\217"
+	.ascii	"\321\212\2420U\255@\210\227\022\022\003\326I\345\217\200oCr\320"
+	.ascii	"\204\377/6\272\021\3357\250\351\034D\234r3**o\210\020\305\307"
+	.ascii	"j\031\310\303\017\372[+|\251gpaX\370\033D\323\204\337\210\336"
+	.ascii	"\026\320?\007\334\204~\251&\265\211\232\244>\330\302\240\263"
+	.ascii	"\375\002X\004W\347;q\300\230\352Z\177\230\305\234\275\233/\252"
+	.ascii	"\361\253\246\024_\221\314\b\333\257\304\266\273a\003'\312"
+	.string	"\230\234\351\342\333\361\224\034\331\212\n\361\265\227\265\036\201\241\256q\202.\031K\364\036\212\311.\372\201\265\263\026K%\r\377\020\212\206/\310\304H\273Y\266w\376\002n\021\222\356i\036H\317\306z\025\354L\344gKmY\271\fU\372r\266\376@\001\374\302\003R\240\2418\037\222\357o\304`zN\235\301\260\274Ce.\023z}\251\227{\032\226\340[\32708\341q\323:\n\237\235\205\325'\270\005c\363\221\246w\\\265!\2205\257\n\346\033)\020.\240\021\352x\251\027\263\206D!\262\253\306\3266\b,\237\213F\360\354\211\212\225\250\272\227--\246\025\375\337g\251\021\037\304\314\356\346\334\270\374:\351\224\031(W\006ils\315\316\177\223\315\313\307\026\241\311\305\302b\007\243\273n\25695\221/\201\031\025\357\335\022dy$\321\361\366\005\343\r\t\212\205b2\337\013\212\3558\023@\034Q9\262\017V\336Ql\030"
+	.ascii	"\r\0022\336\302q\031\332\013Hf\374v\022{\241Fj\277/~\241\236"
+	.ascii	"\237\342\207t}H\277\314\221\320\340\231_}<\360\311\326o\214\332"
+	.ascii	"N\274\234\251o\312\267q\221\215DFJ\260\354\231G;b\202\023<O\272"
+	.ascii	"l\001e\230\350\217,fI\376\374\371#\317b\2464923J~\2316l\bMA\201"
+	.ascii	"\356n\253\250\215Wy\332\370m\264\314\212\224G\212\313{K\006\377"
+	.ascii	"\372c\020\244<\330#\001`\307\257\2370\252\250\004y\200\224\031"
+	.ascii	"\fU\217%\201\331\347&\217\r\207\252\327^\367\371\177\327\265"
+	.ascii	"$\373\013\3247j\243Xz\314\307L2\325\263\233\246$\346b\262\331"
+	.ascii	"\320\037\023\217\241\025H\330\353\275\205:\034G\276\277\0162"
+	.ascii	"!yc\302\363\302\345\217\332\333\220\035>'[\375\376n^\377\225"
+	.ascii	"Y\005;\256\337 '-|ad\312\243\241L\303R`\023O\343\034g\335g\272"
+	.ascii	"-s\003pe\360\031u+\245\337\327\031\016F\377<8}\n\255&\376\341"
+	.ascii	"A\303\353\342\236\"\307H\325.T1\216Kg\204\321[*\342\b?\320\275"
+	.ascii	"w$w\263\022\360c\234H\2344f\220\250r^\356\247t\324\227\342+]"
+	.ascii	"\215\026\271#\256\306M\364\357\235\240}\260\f\214*\037\236\327"
+	.ascii	"\374\365}"
+	.string	"dA\30233\261\220\034\016b\3640v\247$\205\030\354\213\202\337KD\300)W!\337\343M#>\343<\246W\376\373*\305\313\212\211\246B\342\306\337z\275\243?XIb\222\021\246\3728\245j\251\271&\031,\217\252\343T\020\n\026\371\202\016f\332\225\001\330<\224bcv \320BT\003\2307w\323 GA#\236\233\324\2339\013\211\241)\360z\267\nO;(\2515\255s\225V\376\257\031\226\356\376`\251c\345I\316&*\032\354\301>d\221}\230\021\323;\005\235\\G\240\264WX\002U\n>B=-\023\271\032\303\277#g\330\220\025\271\330\321l\2250\326G\220\354\311doF\213v4\210\377\304\250b\207\361\264\224\241\036\305\367\321\375\220\264\266\357\200\360\235\233!\221\363\036w\236\25758\272I+\002Z\252xF\271\026\333\263\031\316\230\352\200\327\024\202\027,7\236\301\333!\217ieGvL\021\007"
+	.string	"\001\025\361\343\023\f\356{\253!p\311^&\330\262&\024!"
+	.string	"\3768d\371s\204S;\025\204\332S>\305\243%\3456h#\243\272\330\317\320!^W\235\326G\367\231m\332\370\242\347\311\215m\2118\212"
+	.string	"nH\033,.V\327\272\357'\240\221\205\200!P&v\340@\0323\255"
+	.ascii	"bjKZ\2671m\027\362Bj\307\252\007 \001e\2137\215o\316\376\275"
+	.ascii	"\276\225\327OZ\301\241\037\035s\004"
+	.string	"\2659\023\231j\310.\001\312\323K-\264y\3731\216\002\314\017g\361\342\346"
+	.string	"}\333\206\261\374\333\260\370\307\227\023\272\326\203]\341\324\005co\203cX\262.3\3144;\266\001\251\374]t\335\332k<\251\213^\036%\016\347\024Sz\352|(\266Z\275\263\375\221>\334\225\346K\215\356<\306\344\276\2607E\254\245\314\211\007*S\277x\311\254\025y\004y+\300\261\256\255\251P\375:\267\263\351\344\3051\240\f\343\316lR3*S\366\317\314\006,{\357\363\030\364z1cN\232\344\375Ks\f\266\251\314\234[\337\360\252T\026 \273\352\266\341\251\242p\223(\211\320\203\003i\214\3264\3545xi(s\004:\035\323\315gu<W\204;\035J9\276\326h\303\302\177\337\340g\200\327\217\r\250i\201\220\256\205\304L\017b\346\274\227`q\343"
+	.string	"\370A\327"
+	.ascii	"\006\005\303\205\037\350I\347\024`+r+\214f\225\0070\211\366j"
+	.ascii	"\234\303z\200EwK\272\351Tj\313\237\304\266\374E\355\022\2123"
+	.ascii	"1\201\2401T|\240S\243Qt\203\244\002\203\323\032-Y\207}H\354#"
+	.ascii	"Z\002\r7\b\2378\251\217\024\305\275~ \370\257\022\357,\030\317"
+	.ascii	"\354\276TZ\330\t\031\345K#U\003F4\204\3573"
+	.string	"\211X\367_\024\337#\327\237\354\222(\004\371\344w\312\333\326\232\245\356\271V\017\035;I\251\266\271D\3273\240\344Y\373\023\264'\216*\034\370T7 \021@\213S^\340\367@\346\004\301\266\276\260N\342:zu\376&\243\264\300\357M\3363\371\305\r\002\265\253\"#\303\267\020lP\307\357\005nx\0058\341qy\025\230\243\021\004\222\030\005\342\265\026d\277\331\267N\323y\203%\365\"\271\334\250`\247X#\361~\022\272\361VY\372s1\224\323\032WJ\020\251vNB\310\334|\207vhv;\317*\233\001\261\361x\375j\020f\256\346'~\031\221M\204{\203\231W`H/a\212\213\305dH\027\352\035\347\366?\231\247A\030\263T5\343\351\277\242\213.\343\022\275\225\374\201(\264(\003 \373\315k6q$\235\203\245t\312A\307m\025\"\323\3037<\342\303\013\221:J\333\330\256)TF\351-\330\244\373\250"
+	.string	"\230\021\273\322\266\033\225\312|Y\322x~\276\272\273\332\302\306\217\201 B\022\2609\262j?B\023QIu\264\022y\303]BD\377\276\343\231\354:\200!\344\365f\032\301(9\324\020\334=\251\002\253\001\311\362\006\004F\024c\364\341\370\"d\024&\271\375\372\"<\225AR\250\336\241\336\330\220[\361\3746\367\023t\223\310\212\242B\324\230\223\255`\350LJ\036\324J\352\272'H\325i\231X\373p\376\2208\200K\377>\366\303=\341\200T\352\376:\340J\356\360\204\345\366~6P\017\262\346\346\025\006\364\344\035\212\377\007\277\022\f\205-\027\306B\361\004-`T\245\205[\334\250\305\035\375\037\321\371\215(\322\345\3155*4\036\"4\262o\243u\242\270\315\335\330\317v\321\326\363\035~1m\031\336\330\256h9"
+	.string	"\006V\312X\274T\215\236Q\237\265"
+	.ascii	"$\263\325\205hb\222$\306\264\362\022\262\277L\352c\335G\340\340"
+	.ascii	"+n5U\365f\331\033\233n\360\016\354\354\376c9\276\006<\357pxG"
+	.ascii	"\351\312\203\217,6Q\215\305\332=b&\033i\233\277u\361\220\361"
+	.ascii	"i\364N\362<AYS\342\312\235-\213\354Gzd5\203\331\373\016\364\324"
+	.ascii	"\t\256\375\355d\217\035+\211TP\023\366\347\223I"
+	.string	"\203\253v\230xMt#\356\337\021)*U\267z\327[@\246[\202\206lm\343-n\001\034}!\351\002\321\353e\031\341\225\275K\300\312\335P\345\251u=k\353\215=`\033K\256\215\">\0178\265\206\214\372\210\316\244\303\253\356D*;\330m\013(N\004\302\032\373\265\310\224v\"\252\241\025\232\225\036_y-\255\376\324\034\346c\243(\007\2112@\337\350E\036\377\2345\305\016\241\266\371\017~k\337a\003\244\232%\346\030\345\204*\022j\036\214v\2473\260qd\322SB\006\022\032y\271\\\374\377\030M\375\001\311\246\361\\\223\003f\314\212\261\311\360\3508\263\037\341\201\227\302\221\024\241[<\345\n\276@\375-\340\313a\240\377C\344\200\313\330\276m\277\254-\342Z\270\261\352\036\343\2144\315\006\244\204\310\315\215\2467\351yCG\317$\360\203\265uS|\356?o~\243!W\264\003\212\232\243\334\301\374\003\205\002"
+	.string	"~Ygy\313T\336\216\332\367\364\376`\027\020\354\322\235Z"
+	.string	"[\b\220\350\031\242\315\013\2616M\225\035\214\3714\001T\303\n\305\302\223\001\314\217\263Q\263]\204\235'\005+\311\031\003\310\244zd|P\t\317n\356\355\262a\253Yo\023\251\307$&R\005p#A\374Q\370\246\272\020\277\372\231\301!t}\007\334[\315\34118h'\222f\207c\374l\204\246\247\235uI\243&\031b\024c\344\222\363\n7n\311D\257\324\300\003\334\251\344.\022K1\263\251\033\260o\f\033\304\204j\004\276\232Uxq\023`\336\356\244\021\202\235/\256\005\372\036S\031]dC\351\373s\n\326q\215\322\330\037[\270\204\224\007\253\200Q\316\207\266\277\350D\313\016\251\rOlJ\205\263\267\351\231\310\370\005\324\200\375\201\rl~\241\211I\207s\212\234@\222\f"
+	.string	"\250\006t\372\254\023\213\357`\001\\Y3\325\375Z@\320Sk4\267\364\030\204\210Zh(fMI\312\235\206\005\347\254^\360g"
+	.string	"\317\376\340Nn\274j\n\203A\377\233\360\375G\270\344\355\215l\315\373\260\346#=\231\332\306\341Y\257\275_\200\353b\211\345'\3028\2445?\017\0358\253H\235\355Y\347\004\026\376w\004\355\177k\017\334\246\345\021\373L\336\037K\262<*\276\311\303\301\b\266\231\244d\323\0269\\$\305#r\366ki\f\233x\311\004\336~>\367]\327R\363_\313\371_K~S\353\007)\346\260\374\225\321?\263]\232\303?\243\332_\216-P\016\305\326\231\310\177\202\256}\311W.\263\372\037@\340Nj\357\020\253&S\270\273\206\244\213\006v\034\310\246A\3649"
+	.string	"\247\304\237\034!\376\277\275\025\364\0230\277\240\360/\376\301\376\006\376\340\254\270\334\362\315\037\365o\"\3704(\371\336\\\307t\372?\305C\201t\331\245\374+\301a\311]\351\274\013\bL\364H^\333X\320\377\251\244\363\265\301W\336\267\234\322\bs\001\212\317\365\365\251\304\367\002\355\216G\030\350\362r\004\272\360\315\325\2079\374\343\027\237\020\314\241Q\362\020\305_\305\277\247\225M\2167\220\254\017\245i\222\332\311\277\332M\302\275\b\235v\334\343\177:\372?\267\263>\253 \\"
+	.string	"\\\2354q6\374\321\303j\204\031\277\237\340Z\264\313\327\021\036\261\317\246<\203\251+\034fB\321"
+	.string	"[?\200*\036\207\303kPge\206t\361\356\1779\345\tj\037{^\366\270\3309\220\222'\3247\262\333?\301<Xz\325\225r\261U\332\273\331\355\365\331w\307\017R?\367\373{\234l\274\355\264s4\276\334\307\235\345\332"
+	.string	""
+	.ascii	"\3447\260~\236\326x\313\324\027#W\272\305\364\373\322Y\2679\220"
+	.ascii	"\256\370yI\364l\275\374\373\262#\343\373\347ZP\363\003\301\273"
+	.ascii	"\345q\327\371\035\263QJ\254\247\361\374\375~\344;\262=\317\317"
+	.ascii	"k?v\366\373w\360<w\222+\213\270\300\260\006\356\033\277\226\220"
+	.ascii	"\\k\253Ox\035zi\234\373\313\343\027Uh\316\005\257\020"
+	.ascii	"\352\272\304\227!\200>8o\034\256\372\3522BX\257S}w\300\376\017"
+	.ascii	"\315\372x\256\215\204\357\027\024\204\017\211\211\024`\363\377"
+	.ascii	"\340\305\234\374\216\203\031\031\331\232\226whj\206\247w\307"
+	.ascii	"\261\320\260V\226\254\242t\334\252\374\377\224-\303\355\344y"
+	.ascii	"_\247\224^\203\027\025]\3212\0274\bN\225\202\375p\232\321\250"
+	.ascii	"\357\277\371\345\350\033~\211\374d%\337o\314\030\221\352U\305"
+	.ascii	"\230>\3447\211\234\031\270\243\327\315\332\362==f\372\310\221"
+	.ascii	"3\222x\005D\337\216 :\013\244\017\343\252\236\213L\031\245cw"
+	.ascii	"\313\3235R\370\216\207s\236\241\240\003\272+\343\330\021\365"
+	.ascii	"\213\222\304[Dq\021\321t\206\243SX\006\227.H\237\260\346$\200"
+	.ascii	"\375\227\304\323!\024\335t\205\361\270\312\273[`\371\265D\r\373"
+	.ascii	"\254R\177VAJW\325I\221n\234\234\360\025U\362r\001\330\270\236"
+	.ascii	"\276\002\270\215\036B\320\365j%:\326C\267\322\027\032?!4\221"
+	.ascii	"\025\f\026\250\275I\337\234\203Q\337|\313\345\317/>\017\307\001"
+	.ascii	"\247\034\201\300\367\021\342n\033\247S\036\177\363h\351\317\356"
+	.ascii	"\031}\227\333+\342\275\353\327\276\355\244>[\324\337\246\345"
+	.ascii	"e\324r1q\246\0370\346F-\375\235\377\266\350\211\353\314\203\237"
+	.ascii	"\242\374?\332\362\225\364\273\212\365\254\240\n\357Zn\311\320"
+	.ascii	"M}>,\276\264C\301\366GI\317G\266F\306\300\3679\255\376\022\340"
+	.ascii	"\315\020pn\260(\343\257\355\246\275M\362\227\311\005\350+\336"
+	.ascii	"4/ $\202\2766\343\310\314\362\277\230XWV7\230\271+[' t7c\237"
+	.ascii	"bt\252\302+\244wB\342\327\217M\245}\323f\013\b\246\322c\237\362"
+	.ascii	"\\G\331\260y\373\256#RgQ\276C\275\235cc8en:m\246\305r\022 \237"
+	.ascii	"\217\364_H\376\276n\233H{\001\337\337P\241MB\357\376]F\361\373"
+	.ascii	"\025\253\256\242N\3464\343\025\332\335\223v\316\f\376\232\277"
+	.ascii	"[BFU\345Y\ro\272\377ht^@\222\325\355?\365\352\371\033\206Zx<"
+	.ascii	"U\276\313\266\276i\214\207>Y\234\310\336\037k\237w\360\235\215"
+	.ascii	"\227/\032~=\377h\213\233\353\372\201>[\374c\003\211\335<;\272"
+	.ascii	"\357\377\227F\334\002\375_\225\017\245Lk\315{\017N\203&7\246"
+	.ascii	"\340\371\341\372\237?x\203\365\324\240z\007\025\347\377\244^"
+	.ascii	"#\255\203|+{}\311\337(G\333g5\233\364\227\320KU>ji\243\332\037"
+	.ascii	"S\276\271\251W\357o\031\252\335\026(\037\257\254a1\223j\325\025"
+	.ascii	"\027\316\243\247\r[\366p\3613,\304\033\001].\326\373-\177\354"
+	.ascii	"\006(?+cn\013\213\006<#\237\021\317-\234\333\361\215\207\006"
+	.ascii	"\037z\347k\204\226\303\361\323\332>\3607\223%/\251\3106\006\346"
+	.ascii	"\247\033\256\353\324\225l\354r\306\033\333\301\375\265\3027\262"
+	.ascii	"y\314\330\373\023\216{<^!^\223\251\303#\304\234L8\232\322!7\034"
+	.ascii	"\024\211\335\327u7\362\317\361\347\375\374f\361\377\032<&~\013"
+	.ascii	"7\243\255{\016\365.\021\351O\275?x\276\303\325\251'\377.K\215"
+	.ascii	"K\"<|/'|\277\347y\241\0323bp\210\274\277\315\377h\371\371\377"
+	.ascii	"\366\242\377\215Sv\204\374\342\245^\204\376\241\363\022\216\013"
+	.ascii	"2\256\256P6\260{p#\274\273\270?\262\373\334\340zT\317h\324.\221"
+	.ascii	"}\"\360\314=#\232\237j\207d\004S\202\005\276\035\245\324\314"
+	.ascii	".\377\3224\317Ix\273\340\277\t\314]\323`\024_\002\357l\342\311"
+	.ascii	"A\344\232\353N\300\\\035\301e\f\331\b~?\227\017\370\b\344\377"
+	.ascii	"\215\314H\243\330-\365\353D\236v]\345\325\360\232\017\261\227"
+	.ascii	"S\304\216\207M%\254\326\236\327\355\377\320\271\261Cw\345_b\234"
+	.ascii	"\201\327\"1M\377K\311\177\244\314\271\277\202G\007h?^\034\037"
+	.ascii	"\374\220\207\373\236\337\223s\253\207\rlCm\327q\323m\377g\240"
+	.ascii	"\235\325\205\277\362Sw9\351\321\274&G\217\3661\201q\263\354g"
+	.ascii	"\246\324C\341\252.\004_\336o\261\017\321_JjO\266yd\373_\220\351"
+	.ascii	"\202\336%\215\237\363\034y\"/F\252\272\327\272+\335\266\250\341"
+	.ascii	"<\336\211\255F{\016$\312[\216se\177W\257c\347&\237\221 \326\352"
+	.ascii	"\256d)\237\177"
+	.text
+	.section	.gnu.lto_.symtab.eacdeb542ca4fdf8,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\b"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\t"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\t"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\t"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\t"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\t"
+	.string	""
+	.string	"blackboxGetPRatio"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\t"
+	.string	""
+	.string	"blackboxCalculateSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\t"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\t"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\t"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\t"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\t"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\b"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\b"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\b"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\b"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\b"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\b"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\b"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\b"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\b"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\t"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\t"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\t"
+	.string	""
+	.string	"blackboxGyroCaptureStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\t"
+	.string	""
+	.string	"blackboxGyroCaptureStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\t"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"blackboxBlockFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\t"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\t"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\t"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\t"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\t"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\t"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\t"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\t"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\t"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\t"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\t"
+	.string	""
+	.string	"getMotorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\t"
+	.string	""
+	.string	"getMotorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\t"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\t"
+	.string	""
+	.string	"blackboxImageEnd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\t"
+	.string	""
+	.string	"blackboxImageBegin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\t"
+	.string	""
+	.string	"getConfigChangeCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\t"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\n"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\n"
+	.string	""
+	.string	"blackboxGyroCaptureRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\n"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\n"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\n"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\n"
+	.string	""
+	.string	"blackboxBlockResync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\n"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\n"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\n"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\n"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\n"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\n"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\n"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\n"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\n"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\n"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\n"
+	.string	""
+	.string	"blackboxBlockAddFields"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\n"
+	.string	""
+	.string	"blackboxPredictorResidual"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"blackboxBlockEndFrame"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\n"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\n"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\n"
+	.string	""
+	.string	"blackboxBlockInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\n"
+	.string	""
+	.string	"blackboxPredictorSelectorInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\n"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\n"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\n"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\n"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\n"
+	.string	""
+	.string	"blackboxPredictorSelect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\n"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\n"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\n"
+	.string	""
+	.string	"blackboxDeviceCommit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\n"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\n"
+	.string	""
+	.string	"isBlackboxErased"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\n"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\n"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\n"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\n"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\n"
+	.string	""
+	.string	"blackboxGyroCaptureIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\n"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\n"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\n"
+	.string	""
+	.string	"blackboxDeviceWriteHeader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\n"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\n"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.eacdeb542ca4fdf8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,562 @@
+	.file	"blackbox_block.c"
+	.section	.gnu.lto_.profile.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375 \375\245\004"
+	.string	"\222F\030#\240)\215\001\335\247\321v\371\223\202\350,\374\314\274/v\272\311\271\252\252\252*\367\266\023d\357-\245\224i\313\207\353\253a\020I\026\236\314\261\310\b\024>`\017\320\245\260\370l\366\243\220\026a(\236\3728\210fy\244CH@\212\365Z\255\336w\\s\374\003\252\231P\242\224\276\357\325F\333Tn\035&\025"
+	.string	"@"
+	.ascii	"8\370{\021(\314\005\235\f|\\\270\n\360\006\002(U\024\344\003"
+	.ascii	"$\340\254\334\005\f\025\360\02203\200\225\253\027\273\356\362"
+	.ascii	"\227\033j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375 am\001"
+	.string	"\260U"
+	.string	"\007"
+	.string	"\004"
+	.string	"\003\001"
+	.string	"\001"
+	.string	"\001\004\002\001\005\006\007\b"
+	.string	"\001"
+	.string	"\t"
+	.string	",D\230\"\327e\343\244H[B\200\001r\303"
+	.string	"\235l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\235\007"
+	.string	"bL*0pk2\034\3741\036\244\220\026\3521]\354\\\212\347\267i\302.<\021\017\033b\005\376\250i\367T\027\351r\001\245\003\230b\f@#7\332[\312\024\267O\nk\007\274\r\220\207\n\201e,\314G\301\321tp_\251\206\304\005(\241\317J\257\020\246\303`g\251\307ei\310i)\350\2624\223o\235\352\371p:\004\214sN\345\370p:\222[\245J\005x\016D\355)q$_\310\360\227&\334O,\024\"\342Q\350\263\241#\026\025\030S\244\3403\334x/\245\357\275\347\376R\b\252\332\034\364\027(\313yi\004Um&\037\315\214\035"
+	.string	"\\%\320[o\220Z\007\214\013Ds\275\274\266\215\203\3651\2612\340\206\303"
+	.string	"\240\334~\246\261\334\316\\\321\263\343\324piM\017n\216\361TF\224\f4[\351\020\270\264\302\202\313\2124\t!\024U9\302\274\245"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\265\005"
+	.string	"\202H\032#\240%I\007\377\217\256\251\235\366\007\210\001\037\037mnVU\307\312\334\331\035\2541k-\261\255mK\254L2$\017\243R\255@@\324\f5\344\213\370)'E\206\007\234\324\213\023\002\305\241\003\033x\201\223\302|\211i7\365MuZ\017\"w\367\275\024_\252\177\310\3413r&\237YP-y\252\245\032k\327\276\177D\203\003\004\036"
+	.ascii	"9/\037\264\005\246\f\320\306j.\243\346\264\227\324\0251\006\226"
+	.ascii	"\376q\324\002\347\2141PXQ\205\017\255\346\004\310\230\306\217"
+	.ascii	"\202\260\240 N\302r\266\311h\375\340f056'\3774\213b'?L\0331\007"
+	.ascii	"\344f(\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\232\004\001\231\004\004\230\004\005\231\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375 \245\305\002"
+	.string	"\364\002\231"
+	.string	"\007"
+	.string	"\004\370\007T\374\007\001\002\016\001"
+	.string	""
+	.string	"\017\001"
+	.string	"\004\005\002\024\274\006"
+	.string	""
+	.string	""
+	.string	"\002\002\020"
+	.string	"\001"
+	.string	""
+	.string	"\006\007\b"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021"
+	.string	"T\020"
+	.ascii	"\301\325\274\200\340\204p\001\202\013\025c;\3731+D\025p\n\341"
+	.ascii	"\317\b\227\013te\354f\320\f|\003X"
+	.text
+	.section	.gnu.lto_.lto.e7138603c09c118c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxBlockInit.6.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\223\002E\023"
+	.string	"6\343|I\300\324M:\242\365\272\333J\205\244\212;\204\230\330\224\225\225\013\347\b\007\366\020\333{\276Wv\201\013e\005\206O\377\356_\341~3\3518\272\2001\275\256\242(\266\341_\006\004n\340\200\246\347\334\274n1ik4\262\211\224)\005g"
+	.string	"b"
+	.string	"j"
+	.string	"+\333H\206\362\"\243\230\203E\325n\360`v\021\307;'\020Ni\316\221\201\035\224\\zf\007A\3311\331\365\334\242\346\234\340\232\030\357\215\267\247\263Kou\346\037]C\b\251\331r.\275\r?\035\004\330v<\226\034'#>6\232z*~\276\277]s\271\232\355\347\252\2220\347\264\326l \356\357\266ml[\260\025FP4\235\262\334\357\307+\220\032\242\351Z$\321\321){\314\321\025\262\257z\032\201\363\006\331\254\033\375&\252\376.\376\362I\367zjU\365\t  \361\344\303iu\343\3740%5\233d\215\024O\372o^\371,\2164{\222\227\274\211\233^\t\235\222\230r\351\n%\227\tn\340\273\364~\362]\332\037\355\225\006\357\341\032p\311\343\267\237\374"
+	.string	"\002$\356Fy`*\332\025\222}\366\313w\310t\250\210&k_xN\206#E,\022\021\363\0336\210>\343\266\314i(\021\255\200:\316g\277.#\306\312P\024\224\256\035\376\005N\200\023sN\b>\356.4\370(.]\023\323\327.\375\330w\371\332\220ou\177\364\002DzX\367\322\367\375\366<\0011\247i\275``b\030T64\261p\302\313\253\005\203\001`\327\212\214+\234qi\271\t]d\\\255\031\027\220&\246\365\002]\260\032pe\201\303\f/0\320&\fa\340j~\203|t\nH\232t\226&W\310\252\335\262vw\232\362]\037\217\367\322\267{#\244\035\007=ro\3169=\225\357\262V\245\313\361"
+	.ascii	"\321Z>\3337gj9\020\301n\0052 \240\202\021\263\342\001`\3535\357"
+	.ascii	"\266\0329U\360\316[\013\307j\024\020\227\362\326($\213W,8\001"
+	.ascii	"\253P\242\256,\210vq\311\004\337\030d\263\306\361MX\222V\017"
+	.ascii	"\306\2753\314\021g\b\367\036\215\032\0273f\311\212\344\"\256"
+	.ascii	"\336R\345i\257\206\201\255\267\265\327\217\215\265\300Y\231\220"
+	.ascii	"pME\235\320\331\300\315x\356\232\036\200rD\033\336\223r\347Z"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_blackboxBlockAddFields.7.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\204\003U\030"
+	.string	"\006\256\234G\260XQ:\361\200\257#\212\207\322\351\244\246\254\327\201\270P>\256\234"
+	.string	"\370\242\303\370\212\177\244\370\333\367aP\234~\2634\027\251\3617\326\245\031\374\037t\236\214\021.N\257\205M\023\002\342O\357_\325\376\t!\233H\231R\204"
+	.string	"}"
+	.string	"\213"
+	.string	"\266u\367\037\265\003\361\221Os\306\310R4\347|`\t\342%\202\357j\277\307}\324\016t\342\001\346\364I*\232s\367\300\020\304K\357\316\002/\305\303\200\227\256\331V\b\354\270\2147^\2269gkg8\034\307q\374\267\273?\255]~\2535?\350\tt#.\207s\371\205;*l\244r;\337\f\323\222\321{W\236\234\216~8z\276\357\235\201\216\b\227\353\271\206\024\346\234V\\\216\305\r\336\366\215\355\013\366\362\b9:\356\n!\355\344ve\330;\034\235\371aZ\362\372\3301\037\272Y\007\372\005\034\310\017s\336\275\002\325*\251NI\365\213\252]@5J\325"
+	.string	"@\365I\252EU\207R\rJ\265T\365w\365~j\375\324/"
+	.ascii	"\276xB@hN\025\343\226\251$\215n|\350\347\331\027\362\205\030"
+	.ascii	"5d\242\210\016ni\316\235\005\361A\374\236Q\227\266y>\022qV\210"
+	.ascii	"BA)\226\346\234\r.]A\274<*K4,\260\355\341J6\f\2202\347\234q\035"
+	.ascii	"\351\245\372\271L2\201\206\016\265.\260#9\202Z\231)\247\005\260"
+	.ascii	"w\207\033\211\211s\316\b>\321\213j\374\032\227\3760\323\343f"
+	.ascii	"\340\345iC\034<-@\342\202\313\332\345\335Z\204+nX\345\300}\004"
+	.ascii	"~\033n\201#[\223\203\313\005\027\254b\333\262r?\"\267&\177H\t"
+	.ascii	"\021b\r\377\004x\036\0279:ZW\300\356\336\246\343\273\231\200"
+	.ascii	"_\335\333r\350\350\350\325~/\344\322H\207tk\n0\033\231\353F\306"
+	.ascii	"N\002\204\315\354%G\300ld\256\033\320/\231\232\327LF\263\241"
+	.ascii	"\304\214\246\346\345\222\321\264@\304\\\037Z/\332\210\226\214"
+	.ascii	"\002\317B\300h-\022\263\031\255\205\332\315\257\217\037t\261"
+	.ascii	"\007C)gu\344\312\360\311\305\306\354R\321\006_-\017\314\256\366"
+	.ascii	"@AI(\224\351\337\234s~v\360\325\306\354{\227,tD\252\215\022\203"
+	.ascii	"\362\307\300\323\252\226\246\273b{\221\332'JN\216\303\362\262"
+	.ascii	"\251\225Mn=M4\030\370\301\360\244\fL^6\304\351\3550b\255m\016"
+	.ascii	"\017B\2501(\250\030R\210L\t\221\204\221\264Pc\200\002\031;\233"
+	.ascii	"\007\021\3205433\311\355\340SD\235\342:\301\215\222\217,?)\033"
+	.ascii	"rx\242\035\322\266\226]mA \253\354\366\265\237\361\037\212\272"
+	.ascii	"\031\274\313\253=\0166\321`\354\003\003\001p\354\374\3203iC\343"
+	.ascii	"\221\363\nu\177\321\357\347\363\202\272\020W\007 t\330\346vM"
+	.ascii	"\226>[\234L\021\254\034\254'\232'\325H\241\316%\355A2L\271\321"
+	.ascii	"h\\\252f\204\264D\005\232\b(\344\351\250&\364\033v\032\221\006"
+	.text
+	.section	.gnu.lto_blackboxBlockEndFrame.10.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\221\005\r\""
+	.string	"\026\274\322I\220VN:\205\360\005\310\005\347\232\r\017\305\365`\212\330\267\227,\022\004\311\345\262\314\316\317bDt)\265\256j\367c\232\323\350+sP}\301\214\020\257\0020\321"
+	.string	"\340t\302\312X\325\260\373\377\377\362u\337\243\021B6\221;\311\275"
+	.string	"\264"
+	.string	"\301"
+	.ascii	"\310\247\363\340\266\262\025.\226\367\336\004\351-3\024\377\310"
+	.ascii	"\274\333\347\370\030\324uxH\245\260\322\244\320\304\362\336#"
+	.ascii	"\320-\033Ho\177Ns\336\232\367\235\267\347q\024\363\224\037\215"
+	.ascii	"\367\310\033UdZ\356\275\277nq\274y<\367j\324ax/\275\024=wf\327"
+	.ascii	"(>J$\366\035\261(u\230\256\363\272^L\364\303\325\213\307aq\231"
+	.ascii	"CsK\266'\207\265\307\"\353\304S\224HE\226\326\3218,-\265W\253"
+	.ascii	"bU=\353\211\357\002\250\310\332\272\031S\2442\177\356\275G\333"
+	.ascii	"\252m\022X\256e\211)\nM\232\253\027\304\213=\200\f,\023\265\242"
+	.ascii	"D\367^\256\304b\3269\346\314\034\205\231\0250[\007\001[c\007"
+	.ascii	"\236C\204\330$nZ\256$\275\r\3303\002\251X\210UX\351l\300\364"
+	.ascii	"\336{\200\377\343kA~\330-sh\252'65\272\346fcl\252\3261\037\205"
+	.ascii	"\265\301\200T\261eq\1771\373\330\312=<;:\266r\216\255\214c+\337"
+	.ascii	"\330\3126\266r\215\255Lc+\317\\y\366\311\330\312;[9\265\225\321"
+	.ascii	"\247\235O\263\262\375\331\3314+\267Y\271\232\225\377\203j%\321"
+	.ascii	"y\273\367\252\216\313\205\263l0~\366\247\375\3127\363\371;\256"
+	.ascii	"\344\2531\357\030\005u\037\274[\013b\3664~\262\354=~\306GCF="
+	.ascii	"\035\007\367\212Kx\357\301/#3C\206\021=\361\003}v\031z\325t\332"
+	.ascii	"6\375\344m\t.*C\031\302t\246\177h\3322\031\306\360U_\363\225"
+	.ascii	"\021&\234'\3164\007\024T-u%Px\234\241\367p\372Z\002\b+\310'W"
+	.ascii	"2S\270\223\nB\306{\357\320\225\\\364&G\002\214\267r\276\276\332"
+	.ascii	"\001(\211\260M\325\2726\023\362\241x6\020\320\317\266\252]\253"
+	.ascii	")t\237\266b\3365\030\357\214\310Q\303\354/\256;\267\235i\037"
+	.ascii	"\3555,\004\f$\222\240\243\235\366\251\034z\t\321\276i\253\242"
+	.ascii	"\233\252u\0372\316-\273\301lw\033!\337\250\352\0343#]\t0\215"
+	.ascii	"\353]\212%[\306\272\341\200=\343\333\211U\016<kwW)C/!\206\037"
+	.ascii	"\001\246F\372o\001\026\226\220\222.\330\fN\0304 -\235MNIF&\037"
+	.ascii	"\025P:\n."
+	.string	"\031U\350\0204R:*Z2\372iH*\002\376\216\230\232~\005\006pp\003\022\323\317)\030d\372\361\216S\357/^\260\0057\325B\030\306\251\314\f\032\324\023\371b?\b3\022\b\254\214(\3023{:m\356\332\354:\207t\253\251\314\017 \324\023w}\261\003\bb&\002N\330R/\r\306O\236\007GC-\3459[\246\255\236\374\016\005\r\267t\247\331\334\371\264N[\365\264L\237\016y\244{\272\270\344\252\350\314{\357\3555\030W\224\346e9C\355\004zM\320e\232\247\277\344\222\323\351\234\336\351J\026t\234\316\021\372M\3434\312dH\207\332\364Mu\250a,\244\220S\210\021\222\021\t3M!\035`\002\031\2723\017\021\260\26537\222\304\345`\322|\340\002\036G\273k\234\023\355gs\256\001\002\322*l\207\304W\224f\271\203\257 \307\376;\017/`\257\336X\223\353\300\361\266D\364\304\325\330]\247"
+	.string	"\272a\236X\271\245"
+	.string	"@\n\t 5\350;'[\353\341\305a\327\266\177\214\356dG!,,h\036K\231\350\257\354\203Xq\331\031\361\340\321\312E5\203\2139/"
+	.ascii	"\3374\320|\302\026\252\031\352k\344\333\001n?p\211F\226\022\006"
+	.ascii	"y-\023\233\3139l\2068\251\241K\203\242\034\362\216\305\\\337"
+	.ascii	"\027,H\017\377\300\217G\274\027CB\232\022\364(Brf\244&g\377`"
+	.ascii	"\357V\002\307\237\273\321\021\256\370\007\262\227\220\201\201"
+	.ascii	"\321lh\247?\221\322\353\024&\374\242\2335<\253\224\245\035\034"
+	.ascii	"\304\201\033\332)9\tc5"
+	.text
+	.section	.gnu.lto_packField.11.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`N\005\r\""
+	.string	"\006>\327K\240\024R:4\361\016\b\177\310\231\270\370C\f\2046\3179n~HO\234\230\276,\357@0\304\237\265U\371\177\177V\221\256e\362!\266\312\376\006\376\207\321\351U\251_\207^.Q\231\343\026(J\202\377\260\353\267F\b![\356$\003\302"
+	.string	"\267"
+	.string	"\276"
+	.ascii	"\f\001\365J\037t\275\r>Z\227\353d%4\336{\tp\203Z\203C\223\004"
+	.ascii	"\257\314\237q\032L'v\370\313\275W4\214\367\022\t\260\001\364"
+	.ascii	"%\023\321o]\006\023\363\321\022\263\206\347O,xc\312\275wws\031"
+	.ascii	"\363\245=\316|\331)\230K>\223\311d\362\226x>\233\3515\032z\232"
+	.ascii	"\245\355\312\304/\336j\231\030{\0326\275&\340\304\024\325i\226"
+	.ascii	"&-\013\361\"RTV\207\210\225\222\027/\340\205T\211\212\276\210"
+	.ascii	"\024\211_=G\334\264\347\207\250\025-C\240=\200<\333q\343\253"
+	.ascii	"p\350TK\027\"n\025T%\237\206\"\3367\336\247\n\311\323p\304\353"
+	.ascii	"\311\340\336\313\365i8u\266\235\231\2230\263\020\263}\022I\236"
+	.ascii	"\351\367\215/\247\252\232\004\257x\250\311\003Y\310\263n,fbS"
+	.ascii	"5\221I\026\334W\314:\237\036\236\235{\375:9\257\361\017\3009"
+	.ascii	"\361\277\261\271\215?@\256\206\346c\347\031\231\230\177\235q"
+	.ascii	"0/.7\264r\313+\0038+\263<\354lC+\327^\231vVF\017v>\313\312fY"
+	.ascii	"\2714+\333Z\271\313\312\265\254\374\237\023\n\221\\\362\336\250"
+	.ascii	"d\225;\244\334\301\342c\377\327\017\366\207\3352\237\371b|#\333"
+	.ascii	"\306\312Z\360\320\227gf\342\347\270\216\027\331\306\314aJ\277"
+	.ascii	"@)Z\260\253\307\331\275D\n`|\274q\362\321B\302\027\037\321&)"
+	.ascii	"\324\313\352\307\331\275W\3672/}\266\220myk[\013\231\177>\323"
+	.ascii	"<\375\251*$\325l,\276\36143.(\333\323l;\246q-\274\026\327\n\253"
+	.ascii	"\353\004Gz\247_Z\370,\256\324\372\364\322"
+	.string	"\226\220\316\351[\013\021@%\273\2048U\244\275\367\336r\351\245u=!%\003\246\277\363\321\274\265OGH\307\200Wj\315?\032\025\311\230u0_\376\311\311\255k\335Q\320\276iZ\327 @\030\270F\373?\307uO\373R\034\300\364\3278\310>\f-\3534L\357t\204*)\300\324\245\315\316\351G\t\206\200\351\262\315\266K\200U\272\354Z\f^\341\363X\302\200\252\340s\350\013\251j\017\350\356\003a\3303\020\363]\373\300\027\277\032DO\362\021\005Y\007>\242 \364\202\317\302\321\220\221y\301'D\244T\372\2164\364xe\322\220\006#\240\r\246\320P\021\017(\203\311\274\002E\274\236QP\205\245^P\021\017\310(hwD\004\204a\307CJ\332\025\320\341^\206!\244\235\257\327C\332\331\210\367}\305/\236\246\305\305\204f\323l\321\\\313\310tK\360\311\020\017\375\253q\213P\321\315\f\247[\272\217,}\323"
+	.string	"\372Vr\315\222k\233\262T\n0\265 \310\250\320\316\230\316\265\220O\230\2469]\032Gw\232J\"*\006\332XL\2432y\372F\261\252\373LMo\241\250\272\307\234F\266\322\252;\214i\353\027\217N\331\202\252|%\323%@\317\364\214\2562\247\212\374\002+\244\211\263\304uM\013\271\fq\250Q@e\030\202ffFD\202\302\202D\035p\002\231:\353\034\020xG\333\264\006O\203\017\006\271\220s\211l\374\256\234y\341\247\373\311!\037q]f\326[7T#h\255u\025\301>\363o\033\026%x\253\305@7vj\226\203\221\274\246hD\320w(\357\314\241@h\026\240Z\241-\262}\365\253[!\266+\264\251\227\334#>\275\n\336s\226\255\023Y\301\302\216\230\r1\003:\244\266\210M\257\230Li\344G\361\030+=\314\025\215\317ec!\337\254\213m\211\352\222,\223\213z"
+	.string	"\340\273 \t\222TMP\342s\363B\n2\037\204\030\310z\340\311\324\"\266 \b]&\016\037\037;\2361\316\022\353\272\0028\275\264\240\213\225\265\367i\213\242+C\224"
+	.ascii	"\367\2765\346\223.H\305F6{\270\336\201/\r"
+	.text
+	.section	.gnu.lto_blackboxBlockFlush.13.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\346\006U("
+	.string	"zFt\017G\200ZN:\333<\257\021\242\236W\311y~\342C\337\365\366\303\270\267\303\2764q\225\370\312\342\341\225\035*\224w\004-\275\347\\7p\302\313\035\305\323\321m\247\0259=\"X\240\312%\007q\333\320\232%d\023\"e\222\001\345"
+	.string	"\322"
+	.string	"\347"
+	.ascii	"i\232B@o\356\252\330\037\327w\363g?\242\342HV\240T[(\333\260"
+	.ascii	"\006]\232\036\221nn\003\364\246\321}\352\315\362=\365&\373\204"
+	.ascii	"\273f~\004K\217\366\002\013\255.MS\245\346!\024\366\216/\217"
+	.ascii	"_\035a\025\236g\007\250\363\313\361\365x\350Y\315\262Y\270\357"
+	.ascii	"\021\251\316\363\252\260\357\224\375\300X\020/\256\260\003q\274"
+	.ascii	"\335`\235\342\177o\227`\004C\343\305U|NY\364\205\303\315\347"
+	.ascii	"\266\300J\243+[\260|\345\311\342\205\217\317m\325(\037\274\241"
+	.ascii	"\203;\033\026\367\216vpu\235w.yq\3218:\267E\243m\006\237\334"
+	.ascii	"\365*\343\246\016\221Ei\224\246\351\233\234\265\210W\\Z\221m"
+	.ascii	"\331\340.\025\024\261\300\320!\016K\037.:\310\274\354Gd[a\314"
+	.ascii	"\347R\232\246\313YD\256/\200\357>\303\356F\330\255\020\002\301"
+	.ascii	"\372nB\212\261\3427\273\013\365(A4MS\007{\270C\t\261\037\273"
+	.ascii	"\271R$\370Y$\352\315\367\313\316E\030]\212gG\252\370n\3678\344"
+	.ascii	"6\356\336@\334\032\271"
+	.string	"\355\257\335\243\312[T\362\022\021\0300Ty\005T^\241\312\033Ty\201*\357O\345\365\251\274\001z\276\366\005>\371\375\335\355\313C+\357Y\362\326\312kV\336\362j\3376y\271\344}\001\240\261\242\r\343\214\006sL_\334\301I\267\230p?\256\366\257\375\311\337\355\345\256\331\376m}FV\307\224XA\354hV\227\344\311}\333\372\216B\025w\262\274'R\352\230|m\317\226\366%W\3337A\nS\334lO2\267\"i\232\372\276d\237\206\306\0049\266\224b\217Lq%\033\227\246\243\007]H,D]\324\307\262S[\f\377\022D\275\020%\340\"\305\310\177b\2154.zm\\F}ztB\332N\244\377,8\260\t\364\351\272\300\f\265\200\036\320\214\266\340B-\240\271\314U1\351A-\324\247\227+\273\023\250\203\272\306\271*\376t\331@}\266\2332\272\316\\\221\ry\001\332\310\247M/W@\206|\267"
+	.ascii	"\370\327\373\244\206\r\365Y\001\232D\016\253\246\332\243[\333"
+	.ascii	"\016tE\375u\206\026j\220c\222\273\034\256\205)\t,M\323\007O\256"
+	.ascii	"\323\345\236\f\200\335\314\362\353\267\235'Y\005\356T8l89K\244"
+	.ascii	"oi\"\375\250\265\270d6\223\216\266\326nm\343\236vb\\\314\376"
+	.ascii	"\272\373\306\325\262\307\\\374@fy\227\335Y\260\354\252\370\356"
+	.ascii	"@8qI\312\251\312\335\204\034\363\341T\246\246p\367\234\233\221"
+	.ascii	" \032q\250\364\006\035\242\236\240<\230 N|\020\361\024UM\234"
+	.ascii	"\200j*\327\211A\320I*\252i\003\n\251\246\240\023ST\223\222\b"
+	.ascii	"(\246\020JN%L(18\260R#\236J(\235\220\222*\241\344;V}\251\252"
+	.ascii	"\207Zx\204xw\002\005~\326"
+	.string	"vS\235`\210(\331\211{\233 \033\004^qu\3006.p\355\327\323\246X\016\322y\274>\233} \345j\237\213\341j\202h\232\332IaGb\260\260\022G\247\215\313\353\236~\235\030\223=S\335\335\250\237a\"\332u\272\231'\2372og'1\276\212fk\252\370\256\255\240\300\b\363k\343\247\352\230) \230\230\227\035\200\033\2255;di1rzC\335fw\177\016)\367\303\273\026.\360\263\314\237\255\235m\0316\225\257\215{\266\373\266\fi\343\0218j`k\235\355\274\034C\344x\003z\313\212\366Pk\0255\260o\027\200\216\250q,\303\024C\214\031\nDDK\223\244\003`\002\231)\263z\021\300\251$F\222D\205a\f`\244\361Z~\323u\307Q\362f\020\267\333\0346H\322\357v\255w\235\263\327\217\350\203\353\241gz\226\200m\213\250\035L1t\242;\354\316\373\376\006\200a\003\310\203\205\301\031"
+	.string	"\210\246(p\326\363\343l\311a\240\210\253!\321\022\f\242;\261H\\7\bm\321\342\340\306C\201V\004\034_ \r$\333\211l\324"
+	.string	"\375\226@ \020n\230-PJ\232?\306\310C\023\250\272\026\220G\263\231\357\325#&\177\200\007W\341\256Q"
+	.string	"N\027\324J^jy\306&\347\360\335`\362\0309\005\303?\234F3\246\306\003\247\271\2030\204M\"\277\007\360\213\331f\314\212\361\253\3206B\264\375VX$\035/\022\231[\204,\343B\370\222\355\027\215\234i\2365\035\377uiw\n\275[\343q\273\277\"\273\013-_\211y,#&\356\013PU\313A\3201\275M\233q\2169\247C\003\t'\\\250h\3053\322\271\371\273"
+	.ascii	"\340\\\344\245\364\230\225\215X\r"
+	.text
+	.section	.gnu.lto_blackboxBlockResync.14.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\345\006"
+	.string	"\002\r03pm\032\003\260fH\367\177\232\020\016\036\214\001T=I\371\013\337]\350>i\2530\302\1773V\304\212}\262S\377u\353\302\230\227\253\"\026\2174\271\245L)\225\225F\316\215\205\201\230\226Ff6V\\H\310(Dy5\304j\240\223\001\341\212\016s^\361\242\335\324\237\210\"\001\241\224|\336DkN\245}\260\b'`\364\337\240\006qHD\315aX\211\216sfXw*\206\004\027%\214\217\223\217\333Z\315\343\236Fk\352O\324>\f\350dRm\177\305\226\362\022\034\351h\353K\261\326dmt\223L\024\244\323\377\3706\214\331a\265=\f\220\205<v\226\203\377uY\310\302}n+\320\266\240mF\t"
+	.string	"`\2517\023\232\364\201?\017\027\272\206\247\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_blackboxBlockFlush.part.0.24.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\350\f5@"
+	.string	"\232l\260\027?@dN:\023\\\250$#\311"
+	.ascii	"\210@\005\035\272\350\017T\301p*\032\b\205\221'\013ta|\352qf"
+	.ascii	"\357h\326\204\"~\334 \365\277g?\341\371\375\212\225i`\177\333"
+	.ascii	"\"u\267F\b\331;\311g\001W\001j\001y\210\034\317\006\265)\t\""
+	.ascii	"\221n\267\316\347\372v\350|\265\363t\224\317k\276)1\272\327\314"
+	.ascii	"\305\026\272(\325\356q\372r\332\255\3732r8]\234s\207\312\346"
+	.ascii	"n\372o\364\216\3676\375\275\273/\257\317\365PL\034\270\367}\335"
+	.ascii	"\343\365\365\362\362\354\336>x\365\357\274\276\246\371\360\256"
+	.ascii	"p\231\276\357"
+	.string	"\233\201h\244_\227\346tF\256\006\t\021\314I\334[N\231\276/]\325\331\246@<;u\250\366\354\372d{\226\355\313}u\273\356\331\243\351\356/\247\262;\321\351\332\336\337\2251\357\250\357\373Z\235\315Z\252\310a\265Z-4\322}\245{;\255\312?%\235\232\230\220KG%\327X$\016[v\315\030J\331\007\373\323\333\223\\\374,\261\323\2267I\317\324v\350\211\221j_:\364\233\261\235\251\375\310vV\345Jlgnw\327\341X\231\227\3679\247\254\030\006\247tN(\005\033\251\262\234\245\2758\374@x\2546\215\306\261\235\245\235\270N\240{D\370>'\225U)Ms\354\324S\211qF\301\303\025JP\214\217\0032B\350\245L\334\256\305Da\364\232\252\317Ye\265`\006\007\356R2\314\032\315\234|]2\033[\247\022\035/1\023\303\371~\316B\317,b;\333r\354t\250\341\207\367}\373a]\336"
+	.string	"\336}\271\356\316\321\355\306\005\3352h\3407\373r_\371\246\324\251X\006\303\031\332\031\352CCf\352:c\351vq'(\342F@5\345\342>P\304m\200\tw\001$n\251\003\276\243\b\270\270\007\024q\013`\302\035"
+	.ascii	"\211\033\300\007\337P.\356\247\"\356\344\022n\247%\334MG\334"
+	.ascii	"LG\334\310#\356\2453z\037\217\270\225\016\350\355\272\270\215"
+	.ascii	"J\270\213.nb\021\367\320\305\335\272\270{}\237w6\342\306E\334"
+	.ascii	"\307\260\340\020\362\371\276eUI\357\032K\347\313\353\374}~C?"
+	.ascii	"\241\037\320\037\351gT\365r\213\363\273\371\333|R7\337\372\352"
+	.ascii	"}\355\356\256l\372\212\275U\335|w>%\311[J\231\236}\340?\370\003"
+	.ascii	"\036\331\375\301>\241`\263g\210\340\246\377\3537:5\322\327!q"
+	.ascii	"9\372#\345!q\021_0(\240nn\020\317\266\316>F\213\026u\325x\223"
+	.ascii	"\276 \362\351v\003\373\211bH\311\023\245\376\265\006'\210\236"
+	.ascii	"Q=\007\354\037j7\317\027\221\377u>S\304\347\177\372\201\356w"
+	.ascii	"i\273\206\n\025B\263\202x\226\320\327\007\005\351)0\272\027\314"
+	.ascii	")\350}\312\017\nB|\301\234\200\316M\337\327i\202xv}\233\356\311"
+	.ascii	"\026P\327\232\2566~i\246{\374\264{\266\017\002.r\242p{\272\335"
+	.ascii	"v\357\364\003\031\332x\355L\371lv\200"
+	.string	"\310\274\224\231\362\372\206\031\345\230\335\214\314\355\0353\272\354j\217y)\037y\213\304\214J\300\027\304mJ\350\357H\337\227\354\315\306Y\260\026\245\225UyE\tm\225\320\366\354\361\244\357\373^\360T\245\226\013nJ.\370\315c>\365O\177c\242o\224\004M\3704\207\031\372\256\326\315\227>\251G\214\232F\203\376\344W\200\243\022\250\315\320\306k\013cI\205\031'W\335\230\227h\265JYH\027\254\246E|*e\226\315/n\256\0016fb.\346\377\335O\031\206A\233r\214\262\f~\323\315F\326\230\031\254\033\247\351 6[\212\322\f\007e\034\216\242DSA\n\245\230\207|\315'\303L\314\331\317\311\025\021m\230'\204\001\022\234{\210\266\315BHu\217\300\316\022\3102='\323g\324\021\313\346\2516\263~d`\226\270\332Tx\315\375@e\032\020\355\233l\016\262\226\177`\017M\322\212\244]\363\f&\215\354"
+	.ascii	"\305\360`?\260\273\bn\206\200\320\366\276/\206\007\366\b\254"
+	.ascii	"\244\204\202\266\263I\326\374D\307oL\020=\345\350\344{x\342&"
+	.ascii	"\2303\264\273\2430\316\335(TL=\343\f\201Y\330\275\002\217]\021"
+	.ascii	"\337\367\265\320x\211\305Z\364\337\316\366\013\030\370M\030\355"
+	.ascii	"\331\347\"[\237\270\2710\\\355$\356\2727_\033YZY\\X)\262\264"
+	.ascii	"\262\270\260\334\035C\262\266\274\330,-\036X7\200\264[\317\352"
+	.ascii	"\241\265\225\203\3351D\307\017\255\036m\327\220-\034kcE\340\201"
+	.ascii	"\305\325\003\207\215\"\\8x`\335\350\201\303\352\307\326\r\037"
+	.ascii	"VXB"
+	.string	"\272\254\",h. ZB\254\206pq\t\261r\355\376!,/\2372\364\252\225\273:\266E/\367\005}\217\340\034\205\341\252]2C\033\331l\242\312\031\020W='\3109\277\320\256\017\202\234 \177\n>s\025\207 3p\233k\274I\202\242N9S\345\373\271U\230\237\245!\274\347\262\211ii*g\300c\325\243\242\262\273\276\357\373\"\243\362\324\201\334\0074\220\017\2100 \225\377\367\340\211\244\002QY*\377P\316\3033f\266d\314\322\237\311\236\\ 1\fm\203\323\343\251o\232\326IYy\013S\n\"}\023\327\372\276l\036\036\351\354\031\"\301i\035\256\366\251?\332\022*e\317\347\233\331\334\f\355\342\226\"\201\234\001\211U\207\312K\240\3621\177\316\256C[\222B\343\203Ce\002\371hj\221\310\236\313\001\271?( \017\310\177\303,\304^X(\253\364\337\3726\332\263\002\362p/\r\300\206'\201\236\321"
+	.ascii	"\371dd\2402\200|\3023\bS\2653\224w\341\214\236G\305$~\312\311"
+	.ascii	"\374\224\361\033\247\234\314W\276\307j\233\262S>\023\315\230"
+	.ascii	"\233\362\323\336\252\314\3026\360\213\022b\201\t\250\221,\304"
+	.ascii	"\224S\210DF$\310H\222\244\0031\005\304((\245"
+	.string	"\264\r\022`\2259K\245!\241\222\322\202T66\003AR\251 \347\306\027\201\037j\326\201\341\376\275\322\0236D4\002\001\001!\343\226\320\344\240\213O\260\345\177\303\223\236w\214\343a&q\234\022Jn\372p\025f\247\310>\3141\257K\203\342\020\271\\\021A\255\245C\273\214\334\322\201\307x\246\001\330\326\2721c\366\344\240\241\001\376\321\311W\223\376\351\221\227]zBC\031\324\214k]^2\276\300L\306\315A\264\372X\262\020\243\252bN/V\207X\034TB4\265\273`\332Ok\364ZQ\242oI\277\343}\270\034\372\340\314\031x\270o\340{D\335\0072r\360\347\341\304W\002\\u\275z\366\374\350\275F7\006\f\0169y\007\"@[\201\032\274\243\250\201\0019\355\334\306\007\3348\322\266\024\367\020PP_\272\3721\204\225 \243\346\200RI\026T\326\355\315\276\277\006\315\200e\2006\217E\226U\3232H"
+	.string	"\263\200#)\0250\377x\346U\352\2005\367t!T\302\372\232@J\314\005\270\007M\307\036\005\376}\210g\316\350\303\372^\025~\210@W\3217~\005Xn!\246\347\375%/N\354\316w_ \254,Z+L|?y\220\223\265\204e\334R:\334\2601\305\356\340\220\301\006\374\025\353\243\305\221\217\021\005\007\344\350~"
+	.ascii	"0z\331\366\003>q\035\013\017q`i84\346[1\221\242l{\262\t\367\007"
+	.ascii	"\202X\272]\252d\22262\300\006\346\0243n\003x\370\036\035sy\223"
+	.ascii	"}\310\354\247\336D\020A`|\314x\211\275~#\305\264\262\332\237"
+	.ascii	"\370\207\273\273U\336f\334\300?\264\354\355\227\241U\220\311"
+	.ascii	"X"
+	.ascii	"\3112g\315\324Q\370GA&\006\321b\002$\034\222\320\276h\t\300\263"
+	.ascii	"9H\326T\243\023Q'\343\331\317rV|o;\245q\210'\fE\022\356\371W"
+	.ascii	"\276\355 \200\241\212\261\032(IG\223\305\2714"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\035\t"
+	.string	"\202\217:8@\217\322\001\260\247\321\020\275Vg\322\021\272wO\313\201<\244[\231\271\324)xR\302\336\030\236a\030\206ax\274\262\347Y\260\025VV\365\227\217\215\304\022\322\367\b\222$\311\372\311\223^J&0\356&\325\305\335\346\237\262\202Rqq;\362p\275\3247/VG\007\027\266\256\034 \253\013\016\356H\373~n\337\267.\372(\275\270oD}\201\"CF\277[\352\t\020'\017\232\257\327:d19h\337o\236t*\211\321\276\237\251}A\026_\217\021\006\t\355{\300\033\003\356\024p"
+	.string	"\001\177\357nU\321\314"
+	.string	"s\016\320\335\035bOE\032B&@\274\215X0(\037\356\0240\\-\002\0341\331\247\350R\241\3620\3044\236lU?\273\223e\252\212\320R\316\250\242\201\3728\004[\312\336Pe\325U\304\241k\306\304a\016S\325\223\004\026"
+	.ascii	"\370 \253\240n\264\332;\267\225]n.\005\352\001\300\001\300\341"
+	.ascii	"\003\204\307K\177\n\206\313\336N\027\023\214D\200V'\t@f\210@"
+	.ascii	"\212@\334\314\300@\2319\230c"
+	.text
+	.section	.gnu.lto_.refs.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375 \251M\003"
+	.string	"\302\310\024\031\220)\351\377\377\377\377\3777\200wQc\027\276\242\377\267F\310&\215\264$S\272\207\346\262\326\232\371\253R\361L\254\210\347\341iX\323z\254\333\203,<\007oy\002\326d\221\223\236\350Y\3173\3153%\343\271X\t\307\n\326\300\253\254\311\023Y\337%\265\021\006"
+	.ascii	"e\020\221\324i\026e\345W\355\313J~\244KA\001"
+	.text
+	.section	.gnu.lto_.decls.e7138603c09c118c,"e",@progbits
+	.string	"(\265/\375`_\024%a"
+	.ascii	"j\237\354\"N0\320\322\031\016Z2\233\272T\\\246\252>,\312\235"
+	.ascii	"\277\003\312<+2\007g\343\213r\275\006n\274\001\244<\255\210\b"
+	.ascii	"\242\307"
+	.string	"\t\260\214/\240S\213d\206'v\353B \326\240\"\003TM^y\020\263SCM\244\341\241\232\376\332j\275\211\224)\314\001\027\002$\002);M4\221\250q\376e\263n+'\346\327d8\375\312\375\033\267p\200\320\336\236\2448M{C\200\020\356\033\243/\2340O\337S\030\247AQ*wo\333\277i\253\266l\374\354fv\267\b\016\3129\253dC}\342\3528\t\343t\327\214\276n@\b\235Tk\007\355\230#Tm\234N\260LU\2507\204\220K\364\017\365F\365CU\210\004u\b\004u\313x\311\326\354[\266c?\314-K\273\225\273\007x\330= x&E\t&L\317\201\372\nT\023\275 \204D\033\202\f\211\2405\tT\026\247\377\212E\371\255\r\221%\247+f\307\354Jb\303\316\342\305\201I0\315\005(\317\226<w8\275\003\352\227\204p\377\226D\230\177\275\226\313B\201M\"\317\016\353^?"
+	.string	"YY#c\306\351vY/\273\022\355\227/\230\005\273\017s]\241\335kP"
+	.string	"TY\2428-\261!\204\351\n\365\377\327A\270\365\213\263\372%\022\006-\221\360\353\206\020\252\013B\310\367\257\215\177\t\330\026X\330\004~\354\f\037\022\364X\247\246<\3772\375\313\343-~\266q\341\317=R\204\325@!\002"
+	.string	"\253#\372\016?/\220\343_\023p\374KL\302\253\261\303\177\221N\300\317Mp\376\323\371/w\342\177\t\017\340\347\343\1777\377\363\376\263\375\247\373\177\367\337\356\177\335\3779\377\361P\370?\342\037~&\376{\302\277$\374\353\301\277\026\374;\301\277\017\374\353\300\277(\376m\340_\026\3772\360o\212\177\025\3707\370/\211\377`\377\311\376-\340\177\330\377\032\377\n\377\335\377\177\377\373\376\337\360\177\357\277\336\177\261\377\321\377\320\377\006\374O\373\257\376\375\375\375\375\300\025?\323\375A-\002S\037\244dE\251a\310\334\325\232-k2;\n\252J\351\024bk\256\317\226\353\3360 \3554\321]\365t\312)\225,\331\222-jYF\371\334\265\273\007\200Zb=\233\311\326\304\362\354\306\262Tj(\027\311\225\255\267\226-\231U\325D\200t\023"
+	.ascii	"\325\235\334f\353\356dw\3678\253\326n&B\315.(\250n\252!\250\256"
+	.ascii	"J\226\001\351\346\2609\262\251&\024\353iT&\006\332\325A\326\344"
+	.ascii	"v\265\334\225S\205&\2774\221:j\327\224\021<N\331\311\317\033"
+	.ascii	"7\257\266.\315]\271\311M\210\324f\332\251J\301}z\312%\023\236"
+	.ascii	"\203\206\206\271\002Y\335a\242\305\351y\311\317Bx\bSm\007/B\254"
+	.ascii	"\334q\252dH\210f\213\225)S\030\t\037\331\225\223p\024\257\335"
+	.ascii	"PN\302Rld\331\264(\340\302\205\2230\224W\221!\024(R9!u\342\204"
+	.ascii	");yj\327\023\\\344Ld\323<\250\\{\345(x\242`\234\236\233\352\367"
+	.ascii	"\204\020\370\367\267'\204\347\245\372\315S\277t"
+	.string	"*\247\031\235\237z\374:\315\223\323\257O\246\033\365\347 \f\244\205\\\264\213S^2s\327\237\361\013?sbn\3648\375\252Q}\364\374L\311\3114\206* o8\345\244\317\235\223\254\n\367\037\232\236\335\032\247\337\277\177\361l\236\215\246\300p\\I\234p*t\272\3351\372\372q\025Y\225\032\247o[\020v\372\200C\272\344\215\255\\~\244\244\242<\371\312z\274\322`\205\335@\324\027\267\324\262\267y\3004wu\3628}\213\274m\263mcs\026o\357\226\316\326m\235\325[\273]7o\347\276r\226\356\351\332\315l\261f\2432\320\300\320l\031\0135\033\3166\272lT\020\324\220f\327\275\032\345\355\333\306Y\266\260\224\313\031\273\356\376\246Q\263Q\017\300\356'l\272^\240m\324Crm)\031k\236\314\276e\3765\363\263x\261y{f\313F,\273\237,\021q\225G\246\t_\367\212b\b\305\216a1\233"
+	.ascii	"\004|V@\206p\3126\254\235\2375^\214\346gx^\260\214a3\237*R\340"
+	.ascii	"\260\314\312~f\300\313\203\243\344i]Vg\234\236\214\243|\204d"
+	.ascii	"\321\241C\022\346L&\f\233I\325\272\227+\326\245\\7\253\210\200"
+	.ascii	"\306\360\361\341)s6sV\344\tm\242\240!b\366\226\234r\364,\006"
+	.ascii	"\007.\r\f\224\312c\316aM\214\310\301\322\024\243\245\266\026"
+	.ascii	"T\252O\363\276|a\260\241'\020\3163\216\206\237?2o\252\2009\203"
+	.ascii	"\245o_qrl\3025)?;W\324w\351\302_CO\340\234\247\033\231\226n*"
+	.ascii	"\242\340\231%\334\024\366r\376\3622[\225D\203X{tc\234>Uz\335"
+	.ascii	"\213\271\226\252\201puOfZ\202\\]W\256\352\266la\256\267\032\272"
+	.ascii	"T92\310Q\203\206\005\013gY\r\370{2\323\262jE\230P\241\341\234"
+	.ascii	"\245\216N\311\235\023Ny\006\016\262[r\332\230\371B\205\n[\021"
+	.ascii	"\352%\335\234\207f\225\253>\256r\266\"\f\362$l\006N\271k\243"
+	.ascii	"j\236\250%\314-\373\031R\004\315\023*R\276+K\341'\032\254\235"
+	.ascii	"\344!\347t\2468pK\213\243h1\227\260{\327\247\224sk\213\271\266"
+	.ascii	"\235\335T\021\204\221\262k**\"\240/2*-\2342W]\320\r\313\0241"
+	.ascii	"N\017L\242\236\375\3243\f\374<[\255l\305P\324\356\356Y\236y2"
+	.ascii	"\343k*'\321\3171\234\241\374\354\247\233Kw\217\370a#\246\217"
+	.ascii	"\213S\316Z1 \"SN>N\031k\303(\337\356\b\341\224\257z\322\326\260"
+	.ascii	"`\340\364z?"
+	.string	"\373\357\223\")\363j\203\247\236\177a+\235\335]$\270\266s\371#\334\340.\321\017\264\3005\361?m`\321\233\356)Yy\352\2251e\223\227\350k\351N~\350\265\235M\350U\262\031\306m\352\303\332V\"\032\232\325\315\365j*}6\367\332\333\314\253)\025\232\353\323\331\\\237I\241f>\223\335\353\224P3L\231\334&\364j\252\t}N}hf'\033\252\264R\231\317\251\246\332sJ\250\tUN5\231W\001Hc\021\330\203\003\362\310\005\f%d\016#\261\203\016J\310\244\242\r\"\221\211F\023\021\371c\006qX\\\201x\001\016\247\031D\f\204z\034\231\224\220Gc\017\016$\342R\212l2\036\207A\026\226\206G\306\"r\251\350t\343\350\b\350JE9\214\305\244\343\320H$\2321B\022\321\230\243\330d\024A\304\225\212\216E\023Dd\221\311\006\320\320\370\243\211\030\002\b\032IF\fB4%%U "
+	.ascii	"\262h\334\340C\020\200\025EH&$\036EJMNK4\006\240\241c\210\304"
+	.ascii	"\303\347\303\"\023\321H\314\241\336\005\f\006`\304\360\321\363"
+	.ascii	"\0302V\310X!|\f\031FF2`\030\251\207a\004D\"\257T\244\302x\334"
+	.ascii	"\261\3438\034\201<\202a\2246\035y0\022; &\035\207=\304\245\033"
+	.ascii	"H5~z\236\300\217<\210L*\220\307#\223\212\016MG3\202\232\210N"
+	.ascii	"KH+\b\233\220\305\031>\310\342\216b\007\304\035HL88 \215NG\013"
+	.ascii	"|\020\223\214\033$-\021\21388\030\221v\340\300\341\244\324\263"
+	.ascii	"t<\3168\n\3460\026y\36082%\251\310\243\030=\310#\026-\220\306"
+	.ascii	"\242\223z##\013J\210\360A\006\352\260H\307\360\270t\343\310\307"
+	.ascii	"\361\206\216!\322\322\r\025\306\"\322\016\025C\246&\025E\b\370"
+	.ascii	"5\371\"\244\355\215"
+	.ascii	"\3570\332\\\223\267(;P8\320\222r\307}`P\272><\314\307_\036\370"
+	.ascii	"\330\300\355\271xv+Y\217o8\357\001\223+\357\005\371\005\355\036"
+	.ascii	"\300W\312\030\311#\314[\271\340\034#zo\360<\254\301\211\223\213"
+	.ascii	"3g\016\333q?\273\273z\306`\371\331\3219\333\325\001\035a\246"
+	.ascii	"\211q\312uk\347\317\316\037tM\3458<\267\353\323X\3169d\261\261"
+	.ascii	"\241\316\231z\027\366ir\\\321%ZXp\324\204D\320t\311\262\002\207"
+	.ascii	"t\341\301\2033\203\324\2133\303\351\333\333VW0\352\306\r\267"
+	.ascii	"i\220\254z2Cc;\267\0055\211a\212\351e\355I\020\rG\310D9es6\254"
+	.ascii	"6\364L\336!p\305\351F\306\347\003\346\210\327\227\032\247\275"
+	.ascii	"\340Ek\313n\251InA\031\033c\264\241'pn\255\210\031_P\236/\260"
+	.ascii	"+5g\264\263*\275=7N9\315\212\005\357\250\234\234q\312g?\343\201"
+	.ascii	"\256\250\241,\206\024DFdFDD\222$"
+	.string	"I\0071\005\204 &\245T\017\022\30051\020\"\347\314\310H\222\222\024\226\335\022\340Z\013h\244G\002\321\0130\266\to\237\265\216\356\324G\240\263CN\025a\304,\017\001}\342N_\322\352#p\364\223\236B(\036\301Z\215\032\342\366Q\013\262\240\005`\256\314\231>\361\262\302#\306v`z\360\214D$\312R\363\307e\313\300\260&\230\366k4`P\035\351\232\2320,&+\031\331\016\226V\332q\331\275S\376\243U@\n\317\033\263|\020\2218\372\206C\307}\251\2625J\013\342J\301\006^v\323+~\306\201\224\230T\361]\317U\302\211\373e\270]\321\036+\005\213f\273HGUN\240\375$\365\3676\317'\217'o\001\257\240<\212DA\332\342\370x\262\217\342\324\234\032\352D\235\034\274\006@\333\326\254\016\345{q\320<\034nBd\204h\024(\223\267$\275\237n\204\370\277\243\256\312\274\303\321'\203"
+	.string	"3\372)H\361\276\204\320\241\307\327NIH\250\211\\\275R\216\310t\026\202,\343`gZ\324\2479\01365<\204\320\262\364\222O0\256\374\326>\004&\225\3017\257\274IMO\017{}\306\317EC\210G\026/\360\013\331.}R\255 \372\350_\027z\305\376\362\356K\t\251R\334KIa\212\363\345\370\325\"\274\242\243\223?\177\263\036d7\265!<\253\327\260\243;\322\301\204\272\351\257f\374"
+	.string	"\0245\315\341\027^U\364\314v8\376\323]yu[\353CCF9\033\316\347\211]|\355^D\224\237\244\224G\322\264v.ir\302\335\231\305\025\002\344Q\232\210\352\006\031F\253\234{)\212x\374\024I\265\2316I\345$ \305\276\214\003J \253K\305\267\246\257Bg\236.?\303/\353\377\347B\221Z\204\326\203N?\243\202\223Y\212"
+	.string	"\201&\337Br\271]\200\257\357\372\245\220\006\275hE\377\226B\240\363\330op\210^\254\355\347\327!\227\355\253/\321\372\n|\t\303\351,\f\251\016\341\233\240\326\315\317\013\2121\3521^\266\372\223\371\370\300\270\036\215i\003\337jZ\"$\301vm@Jj\212\255\331$\204\f7i\311\224D\2466t\205p\233\317\013\376&\005n\325B?\b\302\t2\234Y<:\263m\356\026\3654\364\316\356O\017\205#\364\024\223g\271\273-W\270d\222\375\007\276p\300]c\346\204\251\204\275\343\363q\303\020\221G7\313X\225\301\326\3635[\332"
+	.string	"\002\f6\314\211\034\337\330c\017w\335\236*\315\345\033D\031\001*\346\346\020\335RV\373O\007d\353\213\022\235,K\352\271\347a\330l\323\204=C\367}\017\204\306y\276Sy\t\330'\316\327\244\276\202\345\267\241\375\334\271\2459\033\263\277;\177H\017B\356|x\213\360\311>\n\214\2459\226\027\330\251vs7\340q\245\275Q>U\210\355\246w:\331\036\253|ThG\210\"\275\247L\375\373dw\257\223\236\323\n?;\353\202O"
+	.ascii	"\247\002\003\017/\300\016b\f\244\353d\276\346\2446\\\375\266"
+	.ascii	"\232P\266\\`\256\323\343\007\236RwXn\341\253!Wp4\307ka\265'\216"
+	.ascii	"Y\236\3220\0367\230K3'I\025"
+	.text
+	.section	.gnu.lto_.symtab.e7138603c09c118c,"e",@progbits
+	.string	"blackboxBlockInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"blackboxBlockAddFields"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"blackboxBlockFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"blackboxBlockEndFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"blackboxBlockResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"huffmanTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"huffmanEncodeBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"blackboxDeviceBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e7138603c09c118c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,933 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375 \315%\005"
+	.string	"\264\b\301"
+	.string	"\021"
+	.string	"\342\203\351\365\f"
+	.string	"\001\317\345\236\361\b\004\002"
+	.string	"\313\236\356\221\001"
+	.string	"\003\357\350\332\204\n\002\002\001\002\001\004\346\371\265\305\006\006\002\002\001\002\001\006\367\236\353\232\006"
+	.string	"\007\222\351\216\363\f"
+	.string	"\b\217\340\201\310\r\002\002\003\002\003\t\230\350\306\253\007\n\341\222\236\260\n\002\002\004\002\004\013\353\206\240\252\016"
+	.string	"\f\302\377\311\331\004\006\r\272\370\337\300\017\016\271\274\355\351\n\002\017\255\372\241\327\001\004\020\324\230\357\263\006"
+	.string	"\021\274\320\320\213\f"
+	.string	""
+	.string	"\t"
+	.ascii	"A\221\001\201\261y*G\240\245b\310\345\022A\306s\031l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"u\004"
+	.ascii	"\"D\f\024\2405\351\363\252\252\252\252\016,Qww\267&\215l\"S\n"
+	.ascii	"&\237\036\332\221r|\005V\343b\304\206S\351\262\314\354\205=\007"
+	.ascii	"\357\367\252Q'r@- \240\202\271\252y\r\025\210\213\206\213\350"
+	.ascii	"\372l\031\241\203<\332\0019\021\316\305\002%\314\341b\236^\264"
+	.ascii	"\207\267\270\2701\203g\344\252/\275|}\331a\r\263HYp\300\217\205"
+	.ascii	"\001C>\222\005\257\305\r_\201ms\203\003\300\003Nsr\030\341\204"
+	.ascii	"\r\262C3\275&6\270\274V\206"
+	.text
+	.section	.gnu.lto_.inline.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`}\004\335\020"
+	.string	"\206UH=0m\223t\300X4\001\024\311\250\242\311\266\177\271\335\205jl61N\034b\211$]\325\221\242Os\032\266\331?\017\243N\002q\r\252\276K}\331X\r\326\217\332\215lk\255\221\275w\n-"
+	.string	"4"
+	.string	"="
+	.ascii	"Ge;"
+	.string	"\203\027Vh\233 \377\b\357\373\256\314\332N\201o\fv\377\204\217\032l[\350'\264\355<\376\020\336\335\307\311\216\266\317S~0\002R\265\246y8\t/R\\\004HB\b\247d\3507\322%\240\322\3561\330\337\355\237@\367YY\242-U\311\251\274\2630\244\355E\262\300\fm\007\214w\030\f?(D.\2308p\200\374HNj\200\f\340\r%\273\205\"\3322\370\320V\301\224\004{\252\230\3603\267\263H\r\217\021\031\025=\300\r\n !\246%mtp\371\363!Y\251\241\355PG-'\205\352\250\244k\220\"\331\006\020\267\312\202\267\352V]\230\321ad\303\300\315r\313\240G\006GH\333\362H\270\277\\\204\030\367\b.\302\213k\337\205\031\007\216\021\002O\256\304@\342\204\205\005W\006o\250\301E2\2310\261G\351P\0021f\254\316\003\022\340\0245\006\004\211\310E\022\214\214\202\024\264T\332\030\003RI"
+	.string	"5\345e\241ge\314\376pj"
+	.string	"`U&\236\241\372\355{h\257-\230\232h\316\335i\252rv\362\261\220*8y\031\206\336\376C\240\n\267FJ"
+	.string	"\363\302\265Q\335\362\267"
+	.string	"\356?\300~\305\255\224%\242\341\330\303\030+\363\342\0322\347\262xL\257\201\227\246(Q\222\303,\253*\276\220\306\273 z\361(\300\267\211\021#?\004\343k\330\315\250\336\231\212X\257Vi\333IX\363\274\243\037\360\356Ek\225\242cq\247k|H\013\252\274\251\243\224\t\004\t\305\2752\362\215?\374\216\263\t\220"
+	.ascii	"&\365\307\007\206\212\203\304.\357\215\362\210R\260Y\306a\n5"
+	.ascii	"\270p\323\361\217\323(\313\263\264S\374\201\217\274\025\264a"
+	.ascii	"\031\2610P\tY\302\367U\266H\233\240\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`O\004\265\016"
+	.string	"\206S91`E\224\3410\f\203>\260c\214\232\214\017T\177\001"
+	.string	""
+	.string	""
+	.string	"\360il\272'\234\002\302S\203 \273f"
+	.string	"S\\\224\377\301\267\372\255\374\226\333\356-\223\f)"
+	.string	"*"
+	.string	","
+	.ascii	"La\265\321\246\276\027\366\2275C\254\340\036q\026`]rw\213mQ\233"
+	.ascii	"\344;\277\227\207/\317dY\233TB\276\244\220\201\020\026K\322\243"
+	.ascii	"K\337ENp+\236b\262\255\266\206\275\206\023\251\"\033\016n\243"
+	.ascii	"\275a\277y\350\243\367\025\243G\367\364\035\361\235g\bJ\235\300"
+	.ascii	"\272TW\017\341\216\307w"
+	.string	"\234iZ\022[\2436\345`S\245\372\006\333\027\017\232\021\361\2560^\271\031\371\371X,\030L[\177>$\3116\241\360\333\201-\254I%w\020\3234u\226\0328\364\004~\300\267\200\017p$s\205\r\272g\356\023W\321\243\016\200\301\215$f[\fj\250\221\265r\306&H\232B\333\001`\"!6g\036\022`CMC\202\2506\246\260\242\202\024\324\256\307\030\256\346\006\233$\245MD\f\244\305\026TQ\255\230\244'Az\214f(\017i`\360A_\260pp\334\220\267TL\322|\244\227\304\237\"@\016\023\025\250c\031\"\203\022c\256\234kh>{\021\315\332\325\257\214W\033\034\206H/\346\235v<+\003\2371}\347\215\247\322D\206\252\326V|\220\221Q\236O6\342\214=\271\245\267\372#\231gz\232W\0132\236m[D\006 \304\\\336\315LS\376\005Up\361\021D\267%\360'\322\035S5q\247"
+	.ascii	"\203h\001\n!\235\013u\237\212\242\304\351\355\373\333\263\032"
+	.ascii	"\223d%\313t\244\2308\n\343\213k\237\207\214\307\013\204\n\253"
+	.ascii	"x\367\370A\034\013\265C\277\005\271\202\300\004\r\fRs^\345\305"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.pureconst.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\001\231\004\002\230\004\003\230\004\004\230\004\006"
+	.ascii	"\230\004\007\230\004\b\231\004\t\231\004\n\231\004\013\230\004"
+	.ascii	"\f\231\004\r\231\004\016\231\004\017\231\004\020\230\004\021"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"M\004"
+	.string	"\322D\021\035\2605\303\001\f3\r\303\212\3460\220\276d\243\305\236\305,5\241%\275\244\355\266&e\n\273'\320\240g/WI~"
+	.string	"\"\277u(#\rZ\225s\317yc1\361K@T\016\216@V\376\355\362vvz2\001\035"
+	.string	",\202l\020\214`\250\203`\021\246\021\214\335\260\354\024\216@p\220\030\025\212\200\001\273q:\213q\227\365y\372g\340S\355\001\204t\201\300\026f;s\3006\026\"C-\354lw\207\021 z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.f679931dfba2e2d5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.14.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\265\b"
+	.string	"v\321=70\345(\035\2363Fc\345e\f\2260\363\311r\243AT\022\034\365\f\364F\264\026P%\376-\217\331hG\276lA\241<\250\302M~\t\260\244\310\003m{\322\244L),"
+	.string	","
+	.string	","
+	.string	"\3168\036\3208k\327\302\370\205\034\264\262J\211\371\257%\210;cW\033\305\001\254V\312\270i\370_d\2658\334t\333\203\266\240\266.\001\207e-\"m\335i\233\330&(t~\030\315\277C\345\365\337S\006c\353\022\233t>\351\213\005~\027\311\353\177\236.p\234\365\271@\023(\0134\253\006\032\231\252\023\323\231N\007\226U"
+	.string	"\025\306\332\227\302\364h\235\371\377\246\253\365\2633\261\230\301Z\323\371 \210\375\0331"
+	.string	"\001\233M\356\366\211(\221 \270\2554z\270\340D\022[hB\244\225H!\nm;\241\264\017B9\323\350\244Up\334I\353\274;\363t5\033\201\2512\243\033\304l\003\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.16.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\315\f"
+	.string	"\366\330YC"
+	.string	"\2216\035\030\366p\265_\030\241\376?"
+	.string	"\276\244FH\335\362\027\020l\2752\276\313\034\357\034\023\241[k`\205=\004\207iMdae#\374\377\337\213\321\006\277\034)\323\214^&\007\237+N\2266\221;\245D"
+	.string	"E"
+	.string	"F"
+	.string	"\002vI\341\313\356\307\300\r\252O\177\225m\237\305K\233MC\302\311\204\342\006\n(\263\273\027\202\023\240>\247\017\240>\365\304\267\313\315?\370\004.:\274\024\356R\323\331]K/\205\304\255\267\255\300\366\003\373\036\0025p\250\215oG3=:\2309#\305Y~\373\276\313C\333r\311[\2542bTJ\273k\225\330\326\347\355\315\007m\331+\207\261\235\305\244#\3720\255\310!\356\216\330|\332A\365\371\002\227\366[\334\305\366\217\303\003"
+	.string	"\344\344\021\243RR}\214\020O\265\333\335\273\356\207\"\037y\217\322\207\217"
+	.string	"\002f\024Q\224s%7\177\313A\f\006Bx\366H\006y\317\027!3\212'\312\331\237H\252\t\373\323*\311\236\244\251\177\277V\007^\354\b\230\006I\362\251\240\3168! \017\005-\003\201L\330\240}\210d\230\205\217\013\344\301>W\026\032\2718\013\254]"
+	.string	"\t]$\232\026\272\254\257\373\264J\262mJ5\243\227Q\354Td\223i\267\004\004qE\3168\200\3042\360s\244b\024;(\347\022"
+	.ascii	"`\251'\023z\342\243\341L`@b\\\220\257\325\351_\355\222`\255\353"
+	.ascii	"\302\310m\263\235\r\006l\312b0\204O\221\203\273=\252\225\216"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.17.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\340\001\355\020"
+	.string	"\246\237oF\360\322f8`\312\035.\334e\331l\rY\376\300\307\307\313{\017\251=\240\251\005\207B\255%\333\240I\267\020\204\254T9^\312\370\357I\230\\\301&\037Ok]\032\001\327\327\226>s\253Y\020;ro\262\267\224)\005X"
+	.string	"U"
+	.string	"b"
+	.string	"[\203\243\302\203b\334\30519\347\024\323\271\037\020\213<x\332\017\372\215\327\205F|\300n\017\222\216]\361\304\fL\347,\276@\351\234\351$\245s~\331A.\302\330\023\335\330\304\206\354\356\247/\376z\276\374\307\016 \314\231yv)\273\353\fsT\334z\333\nlG\260\023\f\371\320%?K\033I\350\214-\322\244\272\260\277\355\356Z{\354-}\272\370{\027\372\273-\255[:\267\364\t\004\260\261\263\202\347\204\376\0207E\215\bl\306\355\220\361\242\337\276\217\3432\333s\314\215\334\340\206\310N\320\356z1\266w\356\217\331\363\207N\364z\221\314\003\246\260\222\017WJ\347\256\035\013\0364\035X\326\334\345H\t\220\217\201\264p\341\261W"
+	.string	"\322\241\215$\251\301\323\347\300\220\301\264\013{\370\335\227\261\240\362\341I/\273\212\211\031m\264\321\031\013H\223\337\3501\025\202\233\320vY\235~z\320\306\022\016j\214d\2476\013\244\221\2404c\326\245e\367Q\311~\001\021\250\020\t\303\342\240*\026\252\2659\205\342\322Zm"
+	.ascii	"S-\025\213\b\260\245C\n\345\241\345k\255P\254/\345z\371P\026"
+	.ascii	"\030\374\240r}0 \350\372<\021\366m\265\307\022\222f0\245\261"
+	.ascii	"\314\266\333\002\302\213\376q(kVMz($\365\252\252G5>'?i\352\006"
+	.ascii	"\244f\207&k\366}\034i\202\037#' p\202\021d\306\003 \352\215B"
+	.ascii	"\333\033\203\351\305(\020\327<\202\f\025i\216o\25401w\205\241"
+	.ascii	"Q\032\027\216/V\323\027!P\200_^\001\234\275\325 k\223\201\007"
+	.ascii	"\313\265\036\327X\356\n\235\007L\255k\306\230 b\027(H\024\334"
+	.ascii	"\343\230sh\216\2035\"\300\243\200\227\027\355#\003"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.20.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"E\013"
+	.string	"\366TM>\020Q\225\016s\226c{\006P\372\034h0`G~F\002\005F^"
+	.string	"\345Q\346\213\371q3\2645\254\023\357\341\201\321\366\337L\002@\001\200\252\202\310\013F@\354z7\254g\021!{K\231R;"
+	.string	":"
+	.string	"8"
+	.string	"$\0244v\027\323\020\337\036\241\346\346\003\350@\217\220\322\341\001S\n\256+]a\001S\307\206"
+	.string	"\335\bNV ^\\\365\274\320\2112/\313\356:\271N\303m\335\266\002\333\t\354S\002\351\353\251_3\235\220\353c5 \306n\206\317\306z\304\026$$\266\237\366M\374\304\366\324\307\221\335\017*V\354z\006\214"
+	.string	"\362H\371\304z\204\027`=z\263a\334\023\261\347\350\b\231j{*\3449SF\n\362\245\tKt\370H7T/ur2B\371}\004g\362PE\371\373\307R\275\352\311\001C\r\016\027\243\374\260=Q*\312>\334\335\265\236l\r\031\317\346B!:\2534\340h\030h\031'\263\300\202\206q\220]6\030\214\243\271<\300\262\216\004\254B\300\032\204L\007\233\240i\035L\342\205\256'[B*\212\221T\265\265\by\316PA\311b\306\312\003\264\002\023"
+	.ascii	"`\251'3`\235!5^\"\274\275\204j\025\004\002\302]\252\f\276\330"
+	.ascii	"D\252\3058!\nF]\302\"V\243\307]\276\331\036T\230\321\264\n\n"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.21.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"u\f"
+	.string	"\346\326SB\020\221\223\016s\212"
+	.string	"+@@\366\021\334Ax\255\332X\f"
+	.string	"<\360\227\354\030\035=`~~l3k\221_<n\275h\001>\222\2346"
+	.string	"\025\200\200J\351\020\234zJ\005\242\\!\230\025\326\222\275\245L)A"
+	.string	"@"
+	.string	"<"
+	.string	"/{\231\310\"3cw+\375\360\354\360if\376c.\340EF\324>\207Odt\"j\027\256o\300\210\205\205\016M\364<J\035^\234\364\224\240\20525\007v\327\031\265\n\367t\333\nl\033\260\217 >\007"
+	.string	"\r%\020\027\273\024:\033\313\301\025!|\022'\255|s\002\023\324\241\275bS\207\247l?\355\213\370\210\3540\021\314\261\313\001E\212\335%\340\002\233\303\217{L\207\357\001\246Cg6\214o\001\371\350\217+T\221\226\216\345\006(\273\203\210#N\325\305\335\261\351\212aB\215\022-DI\303\232T\265ST\362\361\2323\0318\221~\354-\224\352b\377\355\356Z=\330/\r\017\363\253f\227\312\t\347\001\264\025B\322)a\200Y\235k\001\004l\304\304\342\234\214T\235\022\016JeyR\252\020\020c\r.O\345"
+	.string	"\303<\025\265\201\036\363\315L\013\007\322\020\354\310_$\371\350\247\237T\021\243\264\341Q\t\325'\231\240\004\030"
+	.ascii	"`\251'3 \f\313,\354\323\302-\314^\320c\250u\200\024QO)\301RW"
+	.ascii	"\215\343b\222\260\302\253\313\024\246\342\001\rx\205\240\304"
+	.ascii	"\352\364\270\226g\212\221*\027L\023hZ\005\005"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.22.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\205\001\245\017"
+	.string	"\266\236jE"
+	.string	"\261&\035{\272O\247\325F\251\206\023\364\350\001\305\242a\230\001\013W\204\2543\257\370*\234Q\331\036\2650k\314\342\177\300\315B,v\177#\373\377\377\317\025d-\037Cz0\277\213qG\254\032\331\266\267\224)\005U"
+	.string	"V"
+	.string	"R"
+	.string	"1;\201\317\243Q\366\215w3{\357e\305\313\261\273\232v0\350\373\276\357\260\273a\242\036\241&\312\267\271\001\030\016\027\227z\204 \026\313\007\001\034\013\212\364\360\344<\366|q\253\204!\\\256\217=\001l\307\305\271<A\rv\327\351\342Z\356\317m_\260\375\300>\212\252\351\324\364\003"
+	.ascii	" A\003\201"
+	.string	"\213]\226O\307\316\2109 \356\335\276\n?\346Y'Ki\310n<\030\236\335\375x\264\203\354\361\"\333\331=\005\3525\326qh\227\203\r\234\335\0051\203\354\321\003>\355\233\370\t\324iR>`7\346\005\316n\007\342\005\331\243\273\027\370<\240\204j\227\234\344]\366P\321\224\375\025(\0302\017~\312\347-^0\252\374\234\032R\325\267F\300\033\306\347\232\372\226\210U~\216z}\354\361\005&ce\207*?\325\233\035\026\247*cw\251\024\231\351\341\261\306\330\242\323\374\241\327\374\331\275;f\032>\035\245\233\230N6R\3140:\235F\321\244\020\t\246R\204\215d\"\201\200\262\215L \215(\214h\246\322\250\202F:\225h!\007\274Y 9i&\333v\322D\335^c|\233g,J\314P\351*\252\214C0*R\255\221\037\217\372\3124\352ilb\250d\317\341\356.\264\202G\025\351[`;\255\r\001\035"
+	.ascii	"`\251'3\260\317#K-*\263Zt\023\t\242\340C\374\\\243\271m\350["
+	.ascii	"+Vf\306\203\031\t\356\266\364\031\231\013u\313\226\022`Sjc8\035"
+	.ascii	"\260\001\232HSX\202vqNd\321\fU\215\367\223H\347\232O"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.23.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\224\001\365\017"
+	.string	"\026\337kE\360\320&\035\372I\336?\332\305\201\376\254Z\005\337\037=\202'zJ\215+\253\203\272\360\300\347{3!\243n%\363\t\335\343\210\3256`\244l\"\233\220\373\303Th\350Vy\020pQ\311\267\267F,\331[\312\224\002W"
+	.string	"V"
+	.string	"T"
+	.string	"\330c\366\001\330\243W\366\214w7{O\303\213Wcw5\345`\321\367}\337aw\303\\=B\315\225\257\363\002\256\030-\216\365\bE-1\037\002p-PdH\310\347\257'\f\267\2220\304\314\365\257{\270xZ\334\314S\244`w\235-N\346\306n\273\202m\006\366W\004\360i\325tj\372"
+	.ascii	"H,`x\354\354"
+	.string	"\306|6\366E\364\001q\357\366O\370/\317?\031\353B\266\343u\020\332\335\217G/\310\036\317a;\273\233X=\307?\036\355n\240\321\263\273 N\220=v\300\247}\022/\261:N\312\005\354\326\004\365\354v F\220=\272;\201YF\265)\224\344[\356`Q\226\241F\275\n\373(PN2\017~\nv\030\032\025%\251\352]F\344\355\002\273\246\336E\304J~\306\364\372\327#\006\027\320\313\r\225\374Tw\200Z8U\033\273c\245\310\315\220\220\265\306.\035\347'=\347\037\335\273\261LG\230\016\250\233\244N\266S\264`R\251L\321\247\220\007)\224\203\355\224\"i\200\262\215@8\231\"\214h)\224I\202vR\225h!\006\274M Qi&\333\246\3228\272\275\326\370:\317R\264x\241\242+Qm<\242\321\222\252\214\3748\2460#\305\3648:A,9t\270\273\013}\340\230\226\3642.\036\227\f\001\037"
+	.ascii	"`\251'3\260\317#K-\332\263Z\003+\022Dq\260\370\217\210\266\304"
+	.ascii	"\231\2705\355\265\214\3004\236\231\366`Z\202v[\344\234\314\200"
+	.ascii	"\272\260\245.\330\224\332\030N\007l\200&\322\024\226\240]\234"
+	.ascii	"\023Y4CU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.24.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"M\t"
+	.string	"vRA90\345(\035\215\213o\016#E6\0310\017\357\017p\241\251v|\240\256\365\177\354\3778\002\031\336\200\317\361b\301~f\204\360\2246 \346\207\322\200\013\221_\364\311\336D\312\224\002."
+	.string	"/"
+	.string	"."
+	.string	"/\210\207y\202xh\317n\271+d\377\032A\275"
+	.string	"\354\356\246 \367\236\236\377\326\003R\252\322Ss\330]gJ\325q\353m\037\330n\260/\0201\323P\323Y\226\326L\247\246\237\311\270\260$|\273\034_\200\205A\025\022\333\327\330\316\264_r\023\357\254\f\303]\217V\312\356.\230\001s8\020\367J\214\252\252\200\262\021;\345g-S\355\021)\237\262\201\206\226|M}\324kF\344\004\0253\345g\273J\251\037\366\263\335]\353\312>\353\017\036\022\210s\001\315m$B\237\210\216\013y 0\272\316\004\307\001u\266\320\207C\261q\242\321\266ApW\341\021m\026]'\3324\256\275\256\374\360\0023\351\311Z\302L\241j\206\t\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_writeTag2_3S32Bytes.25.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\361\004M\037"
+	.string	"v<\307F\260\330I:\361\260}\002\031\242\213\025\256\242c\2156\273\354\361\360&W\005\177\312L\317-\233\271R\302\342G\300z\365\202|\326\301p\326\365\247\034G\340\017\371I\237\250\370\240\267\255\211&\032\245\215F\b!$\311\224\002\263"
+	.string	"\241"
+	.string	"\265"
+	.string	"VY\017F\2642{\267Uem\207\324+dR\021\022\2212b%\3068d\257\r\302\274\031\310\222\203\2240M\2143r\270\030oD5\n\355\365\026:[\373\360\217%W\325\253\261\030eh\341b\214D]\020\332\3631\316g\257\263\315g\257]j\253\370V#\202RW6\253,1\306\242\323"
+	.string	"{w7\267\373\222C\360\363\272\347R\r\032Y\031\210j\212\023\024\223\303n\006\212\n\027\270Z\202-\374\201F8'U\226\023T\013{\335L\2141\006\nE\247 \237\240h\331\345\210\362\215e\241\251&NPQN\320(\306\330t\202Z\341\306\334\366\326\026B\333q\005\306\262\207cjJM\013-\303\376\030#\323/\325\336h\351\030c\354g\264B\316\036p6\310Y\003\005\b\204\331\001\316\n"
+	.string	"\372q\020\273\307Uv"
+	.ascii	"gy\314\345\356\370\312\325\311\361\020\027\307\313\336\204Y\033"
+	.ascii	"gk2K\343eg\274\254\214\2631\316\3028\373\002fe_\326\345\313\306"
+	.ascii	"\276l\350,\350\354\347\254\227\331\316\313\336\313\246\263\036"
+	.ascii	"\222\361x\202\200+\306\024aZ\242\023\257\353\206\271\354+{\210"
+	.ascii	"\337\032W\331\227\226\267B\330H\303\020\255\254\210\263ZYG\330"
+	.ascii	"HaVH\341\021c\224\231H\215uU$\217\335\340\303w\001\016v`Sa\336"
+	.ascii	"\245\nRy\201\213\370\252J\037\261\316\237\214\345\230\217\257"
+	.ascii	"\255\023\270\255\034F\371\262\221C\306\371S]%\204\312\211\004"
+	.ascii	"s\3275\201u^\340&\246\232\324b|\367\t<\267\330\242\210l\340\037"
+	.ascii	"\203\256\251)\265\234\200\373\030\270\267\324p\274\344\200\327"
+	.ascii	"[\0302|v\022p\237\023g*\317\007\334[\356\272``\261\345\020\370"
+	.ascii	"\300y\336\264E\005\335\373\201\247\227\215E\217\367\240;\313"
+	.ascii	"\335\025\030Ej\271\032\t\210\r\341T]\342\263\347\375\323zz\361"
+	.ascii	"\367\274\273k;:w\311\227\377]\323A\313\260\352<\017\200\211-"
+	.ascii	"\327\224aM\327\353\303\271\037\"\254\344`\346aD\005\030\245\331"
+	.ascii	"\007\r\024@|IH\036\216f\032fJa\217\022\\\340\200\301\002\322"
+	.ascii	"\021\207\331\004\021H\0252\034Q\320P\241\210\003\006\n\033\212"
+	.ascii	"\216\222\224\212\022\004\025\251\303,\251\310\003\022RR\221\354"
+	.ascii	"\326d\307\317hV\017'M\247\205J\276\237\237\2127\344\235?\031"
+	.ascii	"\347!\260\017\350\355<\241\347\020y\007\364\021\347\034\350\336"
+	.ascii	"\226Z\216\266\363\237\223\240\342\252\305\240e\314o\336J\230"
+	.ascii	"\200\342L\265\371\315]s\233_\313\226k\212Ps\317\274\3474\356"
+	.ascii	"\262\314gv.sO\013\3461\267V-F\316an\234=0\252$6\027_\327\341"
+	.ascii	"\\H&_\336\036\315\322N\225\375\345D.\227\305\036\336\345\266"
+	.ascii	"E\t\005_\250Q8\0014\220\021)\n\210\242\246\205\351`\002\031c"
+	.ascii	"Tv\0210\2424\246)\324\030\326:3)\030\016v7R\313\220\321D\230"
+	.ascii	"\207i\376r\340;9#\340\254B\310\317l*]\322\004\376n\3251w\311"
+	.ascii	"\227p\312\351~ }\013|\220\031\250y,\271\333\242\341`.\202\021"
+	.ascii	"\231\336\351\344\261\007\215\036\200M\331\377\376\r\260\215o"
+	.ascii	"\003\016\361j\016qG\310\022YTMP\177\2344\330U\254c=\251\261\343"
+	.ascii	"2U@R\251\216NHNA\227|\031\365g\310\335\034\242\243\374\001\006"
+	.ascii	"\037\017\304\316I\360'1\314+bm]UD\303R\200*\315\210D\276\265"
+	.ascii	"\265\177t\273\2640\360\002Ec\230\0043\205TH\366\224v\326W\250"
+	.ascii	"#R*"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.26.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\224\006\355$"
+	.string	"\032E`\016E\220\236I:@g\270\016$\330m\022{P\366\235f\241G\350\247\034\003p\203TAuZ\360)MtV\272[\373f(t\005"
+	.string	""
+	.string	"\300\003H"
+	.string	"\t\2027\305m\370\f\261\027{\224\366\343\301\031)!d\223$e\n\323"
+	.string	"\276"
+	.string	"\324"
+	.string	""
+	.ascii	"\344z\f\327\242\\\207\341Z\3125(\327\227\353\225k\235p\304\006"
+	.ascii	"\210\217!nN\266\2336~e\323'\305(\321+\252X\274\350\027\033.Q"
+	.ascii	"FT\213n\261iV\241Y\214\304f\316ISa\323T^\275\224g\032\026\026"
+	.ascii	"#\356\306\330EWC\316\234;\f\336\251\025,\275\342BI\306nnU\200"
+	.ascii	"bgJ\003\225\2560\252T\002um\235\242T\260"
+	.string	"\264\312\013\r\232SH\017\314\234\273\232\245F\225\336)Q\250r\324\241P\245\261\3548\27232\225\327F\307\2633\347\264\275\210b\251\030J\360\213e])aZ[8\025)x\205o\344\004/Py\n6\351\"\323\332\322\241\237!#\027\002\3159y\266\262\300\025/\3149\275Z[8\324\243\332\206a;\203\035R\t\253\343\202\360?J\277\350\017\341\312%\f\370+Ok^Zrd]\244\256\217\360\005\323\345\310\355\317Ij\260P/u\335\242LL\324\344\310\262\234\345\264\207Ed\304\210\304\372\"T\251o\001\245\016\215\0361\366g\357r\373!\266\202\363Bl\271\226 \327\021\344ZJ\256\243\344\032\202^QC)\026\265M\256\237\344\272\246UT\035\214k'\271n\222k&\271f \327Kr\275@\256\025\310u\002\271F0\256\225\344:I\256\221\344\372H\256\017\310\265\221\\\033\220\353\002r]$\327\004\304\365"
+	.ascii	"qM$\256\005\210\353!q-$\256\203\344\032H\\\377\210k\037q\035"
+	.ascii	"@\256{\344\232\026\256y\344:\2712\272=)>\334\232)\350\236%p\233"
+	.ascii	"*\304\252\226\225d\034\347\001'p\375\"\372\320\007\334\310\354"
+	.ascii	"j\"\024p\"\360\002~\264Fw&\364\237\017\275\b\215\216KM\204A\027"
+	.ascii	"\002z\220\230\376@7\372\312*\363\371\317A3\2559Pj\"\fp\237\253"
+	.ascii	"nG\317\003\200\357\271\336\351\032\313*\313\205\251\317\023\037"
+	.ascii	"n\315\364\0372\346\247$bV4+\217\230q\355\307\222\031d:)\031\333"
+	.ascii	"q\3069q\n\304\2535u=\226\3149\235TB}{N|3\366\314\264\0038\324"
+	.ascii	"\325\214\347\264$\236\027\215\017\017\340\222\227\005D\374(\212"
+	.ascii	"\017\301\344\303\253\356L\225Eh\273\274rA\371\351\246\354mKZ"
+	.ascii	"\316$\274\366}:\370\032\370\247\253\2271#\b:q\022\341Q\227p\007"
+	.ascii	"'\256n\037\250T\204VU'\246n\"nW\343\325\r\205\210\016)BO=\201"
+	.ascii	" A\365\241j\212\304\215\303\212*\017!\246:\210\360`#A\325a\204"
+	.ascii	"m\312\352\312\366\324\344\252\0227+\333\211\252*+\033m\027C\301"
+	.ascii	"y!\326@\307\027\3439k\020\\\021\036r\346n:)(\n\255\203_]\204"
+	.ascii	"\366\006\016=\2751\237\246\321\355\241\tk\352\324t\247?\210\022"
+	.ascii	"\306\364\2457\211es28\023x\006dYe\013\236\340K\312F\025|\201"
+	.ascii	"\222\351\257\340\312\025eL'\202'\260\200\340*\026%\354\214no"
+	.ascii	"\214\374Y\025S\245\333S\267\031\3079\351J\177\320U\007\351\005"
+	.ascii	"\236t\205\363\373\035\035\351\300\217^\3043\272\201\0378\b\246"
+	.ascii	"\343Z\243\340\215.\315|\372\033\370\212\256_VY\256\350\005.\277"
+	.ascii	"t\\?EW\261\256:\272\035\001\200\203\250A<$\rRF\031\242\221\202"
+	.ascii	"\244 \315\032\240\002\021\262\252m\021\240\261ce\223b\366\f\240"
+	.ascii	"\323P\335 \227\262\244p\031\315\t@W\020_\333C\003\322\207w\211"
+	.ascii	"\370\024\247=u\365\207\300\243e\2630|\256\306\005\201XJ\005J"
+	.ascii	"\025\211o%\344-\210\203\257\254\006\367\242gO\0276\017\273\202"
+	.ascii	"\022 \340e\337\260\030!\205\245\271\025\267\251\317\013\211\255"
+	.ascii	"\006\3429Wp.\013\3146j\035\025\360\001vgD\221\320h\3029\031\272"
+	.ascii	"\306Q\037dX\021\002;\036g\225U\035R\325VSN\r\364P^\341vE\203"
+	.ascii	"\0353+\254\234\205\206\211\340\255\017P\334Kwf\245\312\212u\244"
+	.ascii	"\244\377<\301ky\326\226 +\244\210d\203\312\nU\214@\302$\2627"
+	.ascii	"6\316\032\212T,m\270\263\005\331\231\001\027Y\275\005\\{\350"
+	.ascii	"%\204\024\366@\3272\006!OX\205\373\334\360\024(@t\237\bmO\024"
+	.ascii	"L\272{\f\025"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.27.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\025\b\235+"
+	.string	"zS,\021E\200\234J:\355aq\276\222\335J\211j+\334aG\254\013\236\237{\034A\022\347\273\357O\361\317\300\207\206\336n\303zqL3\306\354\226\224[\325Ql\032i\204\222\377\251P\370*\324\013\355o\330F\b\331i\313\024\370"
+	.string	"\356"
+	.ascii	"\005\001%\265\257\244\026P\251\207Jj\241\222:\250\244\006\252"
+	.ascii	"\324\001*\365\017I\355CR\367\220\324<$5\200J\275S\251{$\265\016"
+	.ascii	"I\235CR\363H\352\262R\223$\3658R\327J\375JM+\365~@J\033\022D"
+	.ascii	"m\370:\241\251\343\216h\322\215"
+	.string	"qH\026\312\256\275U\210h\303\273\351\262Rv\212\335s\214\215\342\234\036n\230\230\246\331\213a\367v\274-\346ms\317\013E\306Q\r\241iF\3056\\c\332\321T\274\035\251\275O\226Ml\2053\366\3074\323\300`1M\241\223\245x;Z\310\263\355u\262kb\266\\\025\0321[5\266S\312\033\3234\177G+D\356X\027\210\334\361j+\266%9\326S1\357T\025\2672\263\261-\331\220Y`\306\fg\352\266m]2t+3\373\261\267Q\003H\372\230\246\251c\026\254\264\2642M\323\264\314\214\307\232\267\266i\330\306`\363.\004gW\257\262\360\377\352\267\360\255\222\205w\"P\353[Y\247\327\332\267\245\317\372\016\341*\375\266\355R\0177muV\200l8\207\357Y\324\360\375\206S\271\323\007\220\336\331h-G\3565|\247l\222\0222\300\272)E\340^\021#C\301;\342\235A\356\270_\036O\334\340"
+	.ascii	"BF\357l!\220\276\210\275\325|\232MR{\250\324\035Fj\016\225zC"
+	.ascii	"\245\3260RoUj\255J\235\265P\326X\225\332\002I]\241R_Uj\253\221"
+	.ascii	"\272j\205\273T<j\n\225zB\245\226P\251\247*\265T\245\216P\251"
+	.ascii	"!T\352\007\225\332A\245\216\252\324\r*5T\245\376U\352\247J\355"
+	.ascii	"T\251\233*5\023\217\232A\245^\252\324J\225:\251R/\250\324H\225"
+	.ascii	"ZA\245NP\251\021T\352\003\225\372\250R\033Uj\003\225\272\250"
+	.ascii	"\244.PR\023\225\324\004J\352\001\001\305\341\\\220\b\364\262"
+	.ascii	"4\256G\345\241E\267\275J\320-\363Q\215\217\271\300\213\276oD"
+	.ascii	"\037\360\002'\262\373\256 \t\234\350'\360\2422g\321w\241\017"
+	.ascii	"\270O\314y\266\263+H\001\367\r]@\230\245\037:\321[\220\030t\241"
+	.ascii	"W\273\2625P\273\202\004z\320\367D\013p\240\032\340\013\207\355"
+	.ascii	".H\344\262=D\2721j\267\177\021\357\234\237\202\204\361\212\241"
+	.ascii	"c\216/v\272q#\211I\304\\\332.\266\323\360Lsl\2078\215i\231y\026"
+	.ascii	"\223\230\246\271\264#\326)\\\034:\033\264\350\237\357\034\353"
+	.ascii	"Tlp\025\376\323\306\347=\257\260[\266\352>\367\225\3419\200\367"
+	.ascii	"x\353<{\007\340\273\203m\356\\\353\235\374\316\367-8\304\303"
+	.ascii	"{CeN\235\347\334C\271_d\325ux/\237\363=\317\200Zv\353\274o\317"
+	.ascii	"~\221\034^\236\006\033\227\361\344\256\t\262~\274O\356\\\263"
+	.ascii	"zuj#\266\325\271\025;\374\352V/\317\200Z\357p\3233a`-\272\274"
+	.ascii	"Nx\261\340\261\360rq\202\353\005\351\256\247\022)\276H\200u\245"
+	.ascii	"\360\022\001\003l\204\211.\256\023#~)\276\270P\374\272\302X\374"
+	.ascii	"\236\224\f\246\302+\354\327\002\f,\354\327\023\222m\335\247a"
+	.ascii	"\235\207G\026:\262\003\275KdL\315N\215)4\227\266\226A\224\352"
+	.ascii	"_\031\244\r\"\304N\234\023\272\035\2634\256\t\351\264\024&\234"
+	.ascii	"\302\243\250\270I\370\203O\360\231\272\004\251G\370\324G9)\b"
+	.ascii	"\217P\322C\340\342\340N\177\360Ecf\243\356\340>\273\006\377="
+	.ascii	"j\317,\324\033\320C\025\353\366\351?\362\351\213F\005.H\\\263"
+	.ascii	"\351NULo\3323}\213T\334\202E0K\343\204\214?t\303,\203\333\"\270"
+	.ascii	"l|\314Kg\360\250\341\234\322\023|\351\213\206\227t\245\373\244"
+	.ascii	"\004\211\013\216\364\244\217r\347Y\317\277\340\244\335\211\246"
+	.ascii	"\340H\n\276h\303\272 \021\301\217\236\340>4\347\331\201#X\272"
+	.ascii	"\245?p\"1\301\"\320\350G\037\337\3163*\0037j\332\275\201o\200"
+	.ascii	"\235\250Q8C\2152H\022\032RR\220B\2065\320\002\021\242"
+	.string	"\342\016\021\240\251Te\013\322l\035\340~I\034\233\235\354\212\335=:\206V\013\331%}3\266\247\343x\235W\224\247\225\323\310\317w5\301\341|e\323\372\263\025\0307\252\255\23105b\257\223\027\177\333\373\2039\326\001\346\336\006\223k$\314\2477\361;B\373\225S\224\016)\001\224\220htOh}w\004\214 \030\351q\313\205I\037(`\310\223\200\300\303\205\306\345-\365,<\023\330\2062\354\030\027!yN\303\214^3p\310\2628%\233\233\271\360WR\305-]G5\234\232|\304Y?\365\023\271\234==\250%\350\377\223\036\211\322R1\270fs\200\235\r\274\206\0165\250\030SS'\251\341&\024\005\355\275\004\242k\242\332T\030\207\330\003\033{\262\002\337\327Ytq\025-\037@=\031Kx\246b\216\227\221\301~p6@\t\361\342H\213Vg\345\215MiG!\237\335\331\205\202\036<S\226\322!\300"
+	.ascii	"\272\260\344~\244\314\331\320\t@WG\256?"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.28.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\316\005\305%"
+	.string	"\272G@\017H\240VN:\002\347,p\203\357\2307\276\360\306\330\373\361\371\272\007>\236g\036\277\361\\d\2725\315qC\2501\270\261\016+\347\020\272\326xi~z\037~\241\327\341\231\333\276\306\005\317\236n\2669\216\325\250d\023B\344N)\342"
+	.string	"\310"
+	.string	"\346"
+	.ascii	"\267\250\0333\n\253I\326\2102\310\364e\305I\207'\361\301\\\373"
+	.ascii	"2Y\351\364\242\004z\t\271\230\246\311\241\374X\373\370\0339\222"
+	.ascii	"\003]\363\020\204\246w\251(\315\254\n\304\372\272pd\305\315\363"
+	.ascii	"\205L\317\013\214\213i\376*\224\277\023iz\021\223\335\242~\246"
+	.ascii	"o"
+	.string	"(\214\312V\356\243%\224\037o\342\251\375\255\017i:\027\213\343\230\346\225p\3144\177\f\034\241\374\350\337w\310\217\345u\310\217n\262\265\374\227\303\274\027\217\036\0220\246i\352\026\207\305\213\277[\244M\257\344(.m\362\201G \034J\371\234^e\234\024\201\270(\361b\343\353\211;.xH\035x\322Q\2441\373A\303\306\327B|P\025fv\260\323)\037\024\025}P}\017v\240\260/R>\252\323:\3014MS)\037\214\273\274\355\030\266Q\330c\2207\024\362K\367\247\026\024\035\032\267\337\217}\354\0226\354\215y\242\303\335\25203\037\2737\354\037\024\335+\263\037Uc\336+{\206z\250R;h\240\023b\360\340\035t\261;W\251\201\316\365/\370\221\241N\360\257\033w\363\351\251\324\007*\265\001\222\232\247R\027\250\324\004*\265\215\244\036P\251\005T\352\235J\035\200\244\326\251\3249\225\032\247R\337Tj"
+	.string	"\225\332\246\244\256\251\3244\225\272VR\317Tj\231\222\272|\221\273\376\310M\276\353\036+\265x\352%\251)I\375\007?[V6\260z\354\331\317t1L3\251\214Kz<\370\213\375_\177\221\377\310\337u\322\276\357\365%v\315(\256\3045\252\263Z\230/\374\230kbL\001\324WA\366\354\024\224\343\366\\F\256DQ1\027M\3234E\007\035\267\r\366`\027\305\204}9\255\366\266\272\335\020\334rZ\rX\235\025Z\032\354Q\t\330\001;+\256\200\265!\351\315\020z\200\335Y\236,\247U\320\003\254\r\355L\313Y\237\325\331-\023\2036g/$xvj%\330\236e\220C\326\243\302\331\004kz\263\271\305Y1\312\231Fq{\263\327\nN9\265\202\306\3446\350"
+	.ascii	"\3664\202bg\232\315\322lni\224\323\252fm\2065\313\203\326\333"
+	.ascii	"\252\255\314\322,Y"
+	.string	"vZ\315l\255^\0049\2643kC\353m\225+cD\212[\346\252`\201:\0032q\260C\373\336\030\240\025\327\301R\262^\f\237\233\214\024\027h\277\344?>\252@\235u\215\361\311R\030\225;|\026;\006\247h<\321\241\351.\330\335\237@\304I\274\245\242\335\321\016C\215\222\005\020G;\243\0204)\236\304[*\332\035\355\224J\245\272\204\304\304\243\260;\"\"2B\252)\355\230\216>\234 ]$$\002\311\b\004\257\bi\347!\005\217\210D\321\207#\"\035\222\321\207\022\272\242$%\235\220\002\363L\354\222tK<^\222\256\366{\372^a\230B\345i\241\352\016=\260?kg\320\320b\235\374'7\260\007\366\301S\310\353\032\330s\t\267\234V\224g\355\016\036\310K\375l\201%\227'\355PN`\013\324\275!06\021\236\235YPth\\Y\226\217\024o[}\226\334)\213b\317\216\271\327\265\341\320a"
+	.string	"\324\266v\321\216^\312\267\250u\362\270\266=\360@B\340\2707\\\237h\241\271\343\202\324\220\262\272\262*!\315\375v\243\206p\205\302TqQ\177\005\351\263S\037\273\fV\r.\340K\264*\036\001r\250Q$\303\220R\310\020IHF\206\024\244Y\003p\002\021cV\333\020\220GMk\340\364d\"<\374\017\366\017\356\227b\366D\207\033ZUgTAd\324&\210\374\271Gu\315\021\317,\001\263\026\233\347Jf\324:\024\020\243\320\t\245K\037;#\371\317\021\005:\250\016\026\211_\372\002\223~\276$\341\3644\356\006\356!\370\264\370E\364|\301\231"
+	.ascii	"\177\307p\373\205\tB\316s\017\276\001\265\345\201\020\016\231"
+	.ascii	"\335\210\004\346Ue$@R\3303`i\260\256\204\353\376J\021i\031\231"
+	.ascii	"!\301cu\350y\376!\f3\265^\234\255\020S\251\356x!\262\rS{d\211"
+	.ascii	";\177\337Ye\340\003p\336\327tg\314\265 \004:\314#F\250\324\230"
+	.ascii	"y)\033\302\251A\310Y\336\250o\r\205.\222\032e\327\245\022\347"
+	.ascii	"\237\235\216\177T"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.29.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`x\004\225\036"
+	.string	"\326x\306K\240\326Q:%\355\364\254q\216\270\223\235\314~\235\253\240:\251aV\214a\241\b\213\021\256fnC_\341\n\025\377o\025\234\002\226G\322\372\227\300\257\360\007\274\006;\215{\205\030,\354\223\247\214\364js\367\266\374\226\020B\266\334I\006\265"
+	.string	"\247"
+	.string	"\260"
+	.string	"/\231\370\233\371\022="
+	.string	"\363e\217\271\312\211L\367U\311`\224\226{/\256\227R>\223\311d\362\226x6\273\367X\n{\241\247YZY\327\036\277\370\003K\254\374\b\371\036\273\226\360\bJ\270\242\2460\206Z\034f i\310\350/\253\340X\204\353ZB#{\013\222\361s(!\213\212\336\370\nMHW\222\206Z\374\264gO\220\214\231P\320\332 \217F^\325SM\030\215\242\227\365\350\026-\272\314>\350\321rt-\241\013\033C\006\241"
+	.string	"k\333\001HM\210n\274\001-\341\221E\220\365\202\312\213\257@B<\265\236\023\356\275\\\177\204\206\316\2633\277"
+	.string	"3c`\356-\00121\357\361\303\230\225_\376\343\277=\310\331v\252s\215\366\250\263K\255<{e\231\255\034\263\225\323Z\031V+\237\265\262YV.ke\373\312m+W[\371\004\002,\311\3120uoPr\313\305*\215<=\310O\365G\275\231o\244\001\322.\260\ti\306\024\277\212\212\221\240>!j4\2568\336{/\360\201\360\2458u"
+	.string	"\241\367\250\023\350\235q\032\233\202\216\367\022k^\262\005\364eM\231\271\022\357\243\367\037\214\204_\367&mY\335{\031\260\004\364%\215}e\376\216\363\350\275\007\212\327\356U\032bu/\221\001G@\0034\272d\374\023&\255\201n]\353w\025\233"
+	.ascii	"+\362"
+	.string	"\366\336{\315\036\326z\246\277\343j\312\007\351\245i-\003 *Ht\366Ks\rv\375\314>\273\214\342\263\245l\263\037\354\372\345\230\266\313\266X\202G\370DL\344\240N|\024} \243_Mrm\230\356\276\217\r{fb\276k\337\007\212\247&\271\326\357W\275$\272\"\022\354\372\325d\367\224\222\036\241\362Ua\232\231\027\242\376\207m\373f\303\0308l\017\371\267aB\036e\255\264\340\267\226qz*N\221\032\302\264\324=\344\232\337Z\200\323R\321\t\260\"\231\211\276\332\303,J\212\236p+1\317\0048\337\331\335\344v\035\314\021:$x\024`\"v$<\344J\230\254k\300A\007\347\206\247\323\331i0\301\333\220\243\313y\330\200\323\301\311}\300\351vD\340\032$`\036\210\335\016n\004\217\267\203K\211\367\255T<\232\204\t\326\257yb\260\230.\267\316\232\333l\251\255c\262T\030\255\316\2329\247\253\377\341"
+	.ascii	"I\212`\275\350\211K\305\253\207|\253\317\372P\305-`E\336\314"
+	.ascii	"b\r\323\262\013y\3321[\247}\343-\327U\222Qk\322\332EVa\315\314"
+	.ascii	"\001\207\006\330>vi\230\325q%\205m\230\220\307\263\207\234n\225"
+	.ascii	"3\375\0345R\310j^k\240W\375\225U\003\251\224\351K\375u#T\250"
+	.ascii	"A0\202\0303\002\307\214L B\"\2414m\200\002\2312\253\007\021\260"
+	.ascii	"\301DUu\206}\003\364\311\301\367e\324\337`\321Hm\t*\330\237\223"
+	.ascii	"T\032\036\220\205\270R0\316$\036\336\277\301#\226%\006\336\241"
+	.ascii	"\025\370\2631\237\337\202lj\224P\325\212\004J\321\001=\233\322"
+	.ascii	"\226i\306\037\334\306Q\302\213\232r\n\362{\302j\257\311\224g"
+	.ascii	":i%\002`\311\360A\026\t~X\224\306\362\230\231s\302\353\362\277"
+	.ascii	"\242\263\346\215\n[\026\211\351|]\351\263\036\327\365e!\315P"
+	.ascii	"\252\363MM\354\033\357\251\224\255&+\302\245q\347\320\256\310"
+	.ascii	"j\316\365[\350Gh\360\177\274~\214\032"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.30.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\225\013"
+	.string	"f\025M@ m\225\016X\002\244\201"
+	.string	"\265\332\fz\204\355Pw\004!$j\027\314\250\030\210k\275\250a\233Kw\305\200SMT\302\373\310\b@\\\027J\037\031'\266o\220`\332\234\364\377\365_\357M\244L)8"
+	.string	"5"
+	.string	">"
+	.string	"/\r\273\233\261\207\344\020s\214x\270\375\"\036\372\263C\034\026a\217aB\352\002\211\335\345\024\302\277\347\347\377\365\211jUzN\200\354\256S\265b\335z\333\033\266?\354+\b\376\266\273km\331\231\276d\332\222\351\312]\177\3144\324\364\246i\315tf\372\025\031\263\017\"\031v\027\324f+\203\033$Pl?\355Sx\205\357.\222'\273\016\002g\305D\244h\246\213\205\247^,RE1\020\226\216\006W\213\344\346\020\243^E1\017(Z\314\212\332\243\003y\225\377:E\207\021\262\004Z\362k'\305\250\025u\246\030\234\262f\303J\251\017\034\235\321gc"
+	.string	"\272\323\004"
+	.string	"y"
+	.string	"x\035\2503\202\300\343\b\3506\037\016\007\362l\006p]\250"
+	.string	"\247\341\260G\240\023\342D\236\027\342(\260\275\266\034RBf\322\223cB\314\246P3\032\252\233\036E;\251j\030"
+	.ascii	"`\251'\0230\373\315\300\203\263\254\330\035\302\013:\242\r\301"
+	.ascii	"c\006\202\353f\225\024\024\006\306\003\204\340\212\243W\023h"
+	.ascii	"\206\241\253R[*\224\002L\270\204@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.31.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\205\b"
+	.string	"\246\220<7@\217\322\001\233NL7\202\270\b\363\n\231\3036\026\200\262\252v\341Esj\033G\252MF\233\261\242l#\320?YF_\317\305J\375]\356\013mR[B\210\224)\005*"
+	.string	"-"
+	.string	")"
+	.string	"\001\3323{\266\312Y\036{\222\021\223\310\312\356B\355\270\367\364\374\257\276}'\322\363r\260\273\316\357\224q\353m\017\3306\260\335\n\3074\235\231\376%\243\221\222p\262\213\361bYW\326\372\300\330~\332\007y\210w\225K\274\355\242\254Lvw\343\002\200g\232\013h\317\260\007[\246\332\021\"\377YsM\335\230ZJ\371\262\226\230\332#\212\374w\315\240P\256\013%\331,R*\207}lw\327\232\262\257z\236\021\210\233\310\334q\030B\237\205\330\205<\n\025\261\323\320q\240\016\f}8\007\330\211\" \207\300\361\301#\202\0221\212 \206\265\307VSF\330p\225\324\302\001\n"
+	.ascii	"`\251'\023\332\372\002\307\005\333P\341\025L\271\004\333\254"
+	.ascii	"\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.part.0.46.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\256\003\025\032"
+	.string	"&2\251I\320TQ:#\0220\033\321.\230\323\257\255\3259\"\200}\001\206\3376i\213\367\004r\357ph\350u\207\376\033\343/\345!\373^@\371%H\024\003}HZ\021\177\344j9\200~\201(\212\242(\nm\377'd\023\"eJ\001\222"
+	.string	"\213"
+	.string	"\222"
+	.string	"?\202\034\3159\037"
+	.string	"\375\374\314\300\271C\2316\036!/\034\214\017s\340\274g\2460\275I\"\347\363\034\007\355=\263\317[\256\024B\007\311\321\234\275\002\017\255`|\350\336x\262\352{8\267q\003\366\346\210\234U\355\323x\r\332m\334\2704g\n\241\2419{\007\036:\301\3700\365\026\371\020\374\212|h_\206m\234\234i\366\220\367Z\314\363\370\300\365\034\231s\252\036.\213\323\276\n\322\374\332\3274\242\304U\345\240\310`\316\351Qw\207\267\215\300v\004\033|\t0%\365\213\250v\021\325-\007\272YF\365\312\250V\221\352\224Q\215\"\325'Rm\"\325%R\215\222\352\223T\233\244\272$\325\243T\213R-\037t\207\242\032\024\325+\325\372\336\377"
+	.ascii	")\013f\314)\"\3517Q\204D.\036\364\003\3759Nd\027\201\363\347"
+	.ascii	"(zx|\034M\333, \263\213\236c\371\240\343G\320\321C\320\276/\364"
+	.ascii	"!\373d\331yX@\2139\347Iv\377\006\216\357s\035\367\371\024\264"
+	.ascii	"c\203S\266\035\033\306Zn\364\t\277\224U\331\033\001H\331\016"
+	.ascii	";B7\244\223E\331\343\220r4\311&\213\332\023\361\310\234%kr\340"
+	.ascii	"\337\222\245\331\3619miQ\373\233\246=\355\372\364kZ\032^\322"
+	.ascii	"\3557\256\334\322\336\207\323\035i\376F\212;\356\372p;\003\377"
+	.ascii	"\212K\3033r\3739I\356w<\"\270\235\030\356\223\334b\354\016\270"
+	.ascii	"\213$\270\367=\214\301\003r{\201R]\177\310UA"
+	.string	"\036\304n\312\2665\3777\362\253\373\241\203D'\214\340t:\232\244\273\302\013\036\234\253\302\036\32521%u\261\227\f\326\240\025\233\325\224&\254Z6\0302\310\027\314\025[\311^\256\330\013\306B\265d\026V\032B\263f(\274\\\023`\254WK\002\007XM\005\326\312B\215\352\345Z]P\261l2\250f\b\030\206\241e\243\212\301`6\252\223m=\203\234\325\331]a\373D\303\225Y\233\325\322\203p\312\303\326\034\263,+\263\246\035 8\235-\2476?\2230\033\263j\204\333\275,\314\036g\302ei7\311\227\225\276\333olY\227\215)r\2031\363p[V\302\330\351q\343\255,\312\262,\004\036\021\234.\245\262+\013\032\335\002I\250q0\242\220BF!C$#\24345\034p\002\221t\266\r\021 \256du\377\rd\304\001\270\024\355\022\233\300\302/\307\037\001\020\374\347\354\b\304!#`\b\266`6\371"
+	.ascii	"x\037\212\310\264R\224\310X\210\365h\355b\213\271:d\271\315\373"
+	.ascii	" \264\307\376\311\365\257\n1;\342\300\246\004\263\377\320\211"
+	.ascii	"\202^\004\007\r0\251\271\362\256p\376\235eK\022w\273\003\034"
+	.ascii	"8v\004jw\246\277\262 \377\215\367\374\003\214\361\203'\361\f"
+	.ascii	":B&\305YTVn\336\200\366\367\321\020}x@\003"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.54.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\350\001e\020"
+	.string	"&]fF\360\222(\035P\223\223\343\270\271\007S|\226!H\020\232!\320\340\226\325q\350\226\350\b\300\241\r\352h\367-\002C\272\032\347\311O\252\016a\306\210\306\342g\b\306\261\262\36409^&]\315\326w\2705\331d\313\224\002L"
+	.string	"R"
+	.string	"S"
+	.string	"\337cL\037\260\333r\275vA\004\227V0/\r\236D\273\234/\240]\332\207a\333[\371\263\205\034l\261\267\211\205\230!\262\273\333ed\361\357Q\263\317W\261N\217\257\271\252X$\256\004\236\2154\330]\317\022\267\274\355\004\266%\330:!\363\264\232axb\310\356F\2302\376\r\237\240|\267\3510\027f$|i\031\262\013B\230\227\352\313x~\215;\266O\343\351\203E\231(\271tT\3734^\343\373\214a\006\260\273\"\310kw\031\314KO\326\261\352A\3571&\003\340\216XY\325\276\214\317\b\227\032\027\364"
+	.ascii	"\"\002\005Jc\032]\034\263g\273\273\216-\353\301\377\222\244$"
+	.ascii	"\306nK\254\310\252\220;^\334\365\277\376\234\237\346\231}?\007"
+	.ascii	"\206\343\331\223\002\227\265\332]\234\317\223\022\260\251\227"
+	.ascii	"\0240\256\277|\035\356\334x\017o\303\317q\202\342\205\376\r\016"
+	.ascii	"\303\002\241\2178\225\017wAc\021\225:\007\001H\\i\345\303A3\310"
+	.ascii	"\304\202(\244\322\201D\\\005\017]\n\006\320g%e\023\205>\0316"
+	.ascii	"\320\210\264\231\034p\247\201\033m,]7\332:\3176\266L\301\307"
+	.ascii	"\017T\004\341\030\243\213\355\251\032\355\r$\275\312\236T<\331"
+	.ascii	"\347\361\241\344\273\360MZ1 p\002!#\255\003\024\301\300W\217"
+	.ascii	"\\\306\350\222\030\277\003?\344Q \317#\214\003\375G\361\302A"
+	.ascii	"\036\326\023\235,\336,7\032Ew\307rub\206`.\001\231\214r\300b"
+	.ascii	"0S5xod\312\0012_\261\\X\211\220>\002@\021\266\204\355D\327\364"
+	.ascii	"\276\215\007{7\201\022@\273\213\324t\332\207\266\013l\316+\226"
+	.ascii	"\005\022\317\030\035\273\363Z<\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`\253\003\245\017"
+	.string	"\366VUB0\215\223\016\020\346\204\003\254n{\"\271/\220\023AH\307\035\233'.\250\331\276/\302\0019a<0\200\fua`\b\fhl\351\020\017\364\304h\253=Z\333F\324\032m\333\266\230Q?I\334i\247\035F"
+	.string	"C"
+	.string	"A"
+	.ascii	"\032!\005m\350\007\256hh\007\244\230\001\n,P|\364\362h\201\216"
+	.ascii	"rV0\335\\\036\027\034\325\300\367\036\324\326\301F3\243\325\264"
+	.ascii	"-ZJ`9x\252gZM\353\260\341=}\357\303\002\307\335\335J%|\357\305"
+	.ascii	"\t\001\262s\264\340\247\345K\316\366\247\316\337]\004\033\337"
+	.ascii	"\304\361}\200\216\bP\221\021\r\021\321,DG \312\361\241$\017\005"
+	.ascii	"\311\364\303\273\373\236\250E\207v\230CE$\r\255hI\0211\322\215"
+	.ascii	"w\"C\003\020\"\r\034\326\331\227\317\222}\271K\001n\226\214{"
+	.ascii	"hI\200B\001\370\001\n#\002\244\250g\036\352V1\f\221\202\004\004"
+	.ascii	"8\331\202\202\007#\346\364\311\245xw\361\346\342\275u\342I\262"
+	.ascii	"\031o\302\271\376\354'\201\017\257\304qw7\243y\006\322\234\232"
+	.ascii	"6s3s\251b\247\\P\301\200\302<\24341/\261\224PA\003\006\346\237"
+	.ascii	"\315\222\3078\223L`@\371\310_\333\224?aq\365\223M\304Y\325\261"
+	.ascii	"nV\017\225\360\345\241Q\250a\034\206R7\243\005\005Ik\006\360"
+	.ascii	"\002\241\242i\003\021p\034KB\246\"\213D\322,\350 \032~,lO\013"
+	.ascii	"\033\361o\233\244M\323\234\225\007b\311\377\327y!`3:\242\027"
+	.ascii	"1Ph\370\300\210\236\366A\317\341\265F?t\030\213\227\017\225O"
+	.ascii	"\006\322!m\022\373\337\b8y\320\251m\206\244p\310\373M\261,\217"
+	.ascii	"\336\255\374E\267W\247k\367\317\027\2006\311\b]\361\347h\321"
+	.ascii	"\273i\266\246P\245\234j\200h\253#\314\035\224\214\217P\253\265"
+	.ascii	".V\272\275\036\344\214X\240yG\257\243\n"
+	.text
+	.section	.gnu.lto_.refs.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\003\002"
+	.string	"\002"
+	.string	"\003\004\002"
+	.string	"\006"
+	.string	""
+	.string	"\005\t"
+	.string	"\001\005\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f679931dfba2e2d5,"e",@progbits
+	.string	"(\265/\375`-\032\365r"
+	.string	"\332\265\\(P0\222\322\031\016\372\221\230\242\035\216r\\\321\364&\025xLY\221qa%M9\276\340\320\263L\231\350\306\200A&\221\305.1{\f6!\252\n\203\236\351\356\354\244\252\210*Rw]\007\224\351M\ny"
+	.string	"\346\316\254\226\230v'\333v#{K\231\002\024\002c\002\220\002M\343\224\206r\2432\225Svf\312\210pj\201\353m\023\001d\210\0306\234^\004uL\017\330\217\033\222p\272\206\345\240\351\355@\305\351\202\3310\273\002\255\230\265'\347\315M\2202N\257\201\372\005\372\365"
+	.string	"\375Vm\277|\327\326\313Y@p\3248\326ak.\226\335K\273\326\263\327\275\324\263\213b\027E\332\003\227\227\331/\275\005]\322R#L\266\200q\272Zv\313\256&\226\313\367l\321\356[Z{];$G%\247>K\342\307\022\2505t\257\211\337>\237k\342\367o\026,\354%\345\205\327\315\2565c\227\331\025\037\2363/\n\331\256{\345_+[\3666\235e7Sw\017\020b\313TU\016\234n\211\375\371\005\005}\311~~\311\253\265\313V\212\336\2245N\377\255\362/\330\206m\023EB-\273\254{\035\321\"\356\n\223\323\215\262b\273^m\247|\307\226\312s\230\326\265\331\335=:j\314\312\340q\232\300\222\370\245-\324\257\224\0130\326\r\301Y\205\241\273\033\270W\373}]\022?u\177~:&r6\210\317\277r\013\264\240\365\001\203"
+	.string	"\344\277\214\003\177\316`E\\\241\220\303?VU\r\374\013\301\005\370\331\202d\212\223\370\231\202\377l\226j\2476\311\021\374\033A\217\225\212Z\036\353\364\257\0162%V\224H{\316\317\274G\024\370\304\326X\352\371\031\370\337n\215)B\374\013\367\334\031M\300\277z\377v`\303\277&\324\360\357\n4\354\f\377\333F\374\333\346_\025J\377\r8R\377\325\362o\322\277\304\177\215\376%\3727\370\357\t\377z\360/\214\177\207\376]\361o\212\177\027\3707\347_\024\377\"\360o\001\377\016\360\357\317\277<\377\352\374\213\376w\363\377\371\037\316\177\347\377\273\377t\377\251\374\377\340\277\334\177\270\377o\377\313\374\037\363\377\350?\332\1771\377e\374\377\362\337\354\177\332\177,\377c\374\277\362\277\371\337\201\377l\377\001x>\237\317\337\247\363\243d?"
+	.ascii	"\034\004RX\272\3144a\035\374\304:\030\212y\234\241\32292xiY\304"
+	.ascii	"\230p_8\345&nb\247\355\244\334\363\351\354kG\n\0302(\310\263"
+	.ascii	"\223\016\333\361\312\310)\357\330,9y:\334\305\271ZJ\205\006F"
+	.ascii	"\206\323\243Z\3529\016\033\331\310G\265\273\312S\352\343\007"
+	.ascii	"\234\021^:\037\327\254\257\222`\371\3119!\262#\356\371]\367\271"
+	.ascii	"X\322\261V\206P\246\n\313\331}\305\200\004S\274\346\230A<\210"
+	.ascii	"\205\243\366\332\306\265{,\025(\264L\252G\222\275/\034:\325\007"
+	.ascii	"\260\273 \234\256\236\016\327\025-I\253\274\274un#\325\314=\235"
+	.ascii	"9C\244\341J\013\342\315\327\251\366\353\301\246&\n\231\2350/"
+	.ascii	"\2706N\317\310\272\275\253[7\277\356]\227=\222m\332\254\233\355"
+	.ascii	"d\367\325\004T\306\324\365\325\025PO\236\034\224\266\373\272"
+	.ascii	"I\321Hy\213c\373\265\365\330\013\242N\375\242\251s\377\347\226"
+	.ascii	"n\257\032u+{:\373b\363\245\363Y%\331\201\307\351\256\271ZO\225"
+	.ascii	"\221U\257J\217\323\311\reQT9\2366\270\2678(j\334\233\2629w\306"
+	.ascii	"\351\367\314\372\360E\263.\232}\273Ow\037\273\205\004\371\031"
+	.ascii	"\363\362\004\304\331WI\240\177\335\276o\247\323\351\016\353n"
+	.ascii	"\003v\236ct?p\272i\316&\304\034\016X`\234\036o\327\230n\314\027"
+	.ascii	".N_\203z\376\177\275\224\354n\037\276\265\223G\235\257o\027\350"
+	.ascii	"\337Yt\025\370\2376\352\244[\352\356Nm\302e)\353\t\364W\267q"
+	.ascii	"D\257\235D6\267\214\310*>(G\254Md\200n\026i\344\272\245L\227"
+	.ascii	"\315\275\3666\323\226\262"
+	.string	"\005\344\272L\"\327\245\321\247\231\226\306\356U\351\203,[2.\262\271\245D6\227\312\021\315\324\306n.\021Q\231\226J\344\230\245\322\007\331\\R\"\231\266\224#\242\356\270\266 \177\330\312Z%\222\251\245\242\264\226\222>f\220\353\262\343\272\267\254\251\223\ntk-\223qKV{v4#u\314\262\264\\\023QG\256e3\231A:Yv;9\332\350(\027\306\325Lw\255\031c\021\255\206j\352&\240\327\356\250n\343\266\231\3566v70\251\265vc\371 \231QQ\335W%\242Z\313\210\326\324\315ej\316\224\310&\3272\b\215\254\311\354\035\253q\231\035\267\225T\003a\220@\204\345\001\255\356\274x\234b\334\2348\255\253c;(L\340\030\232\223\016m\316v\333\324CY\034\340Q\356\274F\216\351\322/*\030\025\330\0206g:\266\036/E\240\330~beI\212p\312s\254\246\215\233\033\303\375\254,\363\276"
+	.string	"\275\200\303\342\346\355\f\267l\"\246\302\222\300!;s\206\321\354\330\001k\252\260\276x\356\254P\355\371pF\243\266o\234\334\341@\346\211\036\2177\035\330\316d\330\270\214O\f\255\"k\023\303m\3472<j\354\214GN\275\304\212\224\341\224\307\374\206\250\\~.\034f\307\272G"
+	.ascii	"QV\273*\347o\315\321\211\331\345\034\346\f\306J\362\314\325\027"
+	.ascii	"^kb\002FdOe/\254\2466\311y}\371\362R\344t\001\302\346\311\324"
+	.ascii	"K\262\204SN;\2333\211I\t\302)\243m\\\227\266\2473\234\362\331"
+	.ascii	"\222Q\231\204\274\211\3155\317dM\326\342\213r\005\004\314\273"
+	.ascii	";\342\226\345\254E\004\222\007\262'X^\005\215-\017\013\233\351"
+	.ascii	"\234\321\021G\212S3\266\302W\272K\210\250\353\361T\226\3759\""
+	.ascii	"\316\212\3245\021\243\336\227E\345*g)iB\214lE1{\313b\202\365"
+	.ascii	"p^{\340\261tL\367\361\201\365\030\327H-\240\035+N'\234)\3471"
+	.ascii	"5\037\313&\036\320\023Y\336\221S\026;K\371s\200pnlcMT\016;G\311"
+	.ascii	"\232\232s\262\004\f\311\2306;$\352}XL\230\360\327Q\246\0262\307"
+	.ascii	"\3241\252\221Q=9\177\375\214tI-9e\035\230\2077(\353\024N\271"
+	.ascii	"\t;\331\365l\274\303C\024\021\343\305\215R\275\r{\266\237\317"
+	.ascii	"\250rW\027{\355\330\001j\252\260\276\272\257\200|[\216nK\226"
+	.ascii	"\234\275|`i\253\025+\361q\345\255\341\302)\343\3009\354"
+	.string	"z\202\223\354\304\201\022G\017\b\365{\342\267\317=\361{:g\304\b\037\231\273\302\344j\342\006\346\206\363\021\016k\246\211\342\262;l\201b\006\206\213\213\217s_Og_*\022\2637 V\210\020\341\254+K\236\316\234<yw_z\314 Ax\310\021)OgN\340\233\274\247\245\220\363\0205\240\222\211\222d:\005\004\bg\3111s\226l\312Da\235\263\366\250\250\330j\t\323\200\265\253\262\252\263U\317\017gG\326l\032\017\363.\211q.\231\344)\325\247\217nC\230\300\033\324\244I\3728O\251V\332\234M8e\345vI\327\330\320z\013K\261\024;]=\235}\005GHH0\202>\033E#bQ\007\305\341\214\234\"\0329\212C\242\221\360F\216\nA)\004\255\340s\201\270\001\222\214\242\222\220\350\307\205\020\016\341\013J3F\334\306\211\242\013\214\2042\030\re\3201\"\016\223\2121~\212I\302\242\022"
+	.ascii	"\267\241\002\307\n\"\322\215\033HD\005()\025\021\021\t\177*\004"
+	.ascii	"\245\320b"
+	.string	"\005_Qx#\t\251F\020G\215b\210\004\2063\204A\027\224bP\3621\022\026\203\301\035\032\304\242\240\320\005\237\027\220\222l\024\221\210\300\032\302\242\243\264\250DD\"\362\311pD\024$\016\213G\303\0343\202\301\235b\320\205\320\005\035\364\024\203C\300\235\242\020\351\b\003"
+	.string	"X\264\030\301G((\206\213\340P\321\321\f\3410IH\202P\220\217P\220\0011\b\223\222* @\200\030C\301!#\241\214\0231H\334\206\n\244\241\002\305\"#\0329`\004PD\034v\220TDCX\244A\211\032E\3420)\004\236\001\036PQL\022\342P\001\203\004\032ED\243\241\022q\204\022\016P**\306"
+	.string	"\203E\213\030-\202,\214\2042\212\212\303\244\027~\212\304!z\240#\341(JZQDBJZ!\202\250\230\003G\320w\242aR\021\261\310H\275\013!\007\204\206`"
+	.ascii	"~\350\305\003/\036\370}\350EP\320\013\241 \365BAhQix\024\024"
+	.ascii	"\272\220CM\022\332 "
+	.string	"J\213A\241\240b\220E\213\"q\b|P\220\005\t\214\360A\006*\221\n#\342\220\006\022\021\261(\b\003\322\f\026\210\204G3V\020\207\302\033+\210\222\224V\250H\361\265\354\367\306\025'\027\204\355\242\204UiNQ,\324\206\347\363\371\334\303bT\013\315:\212\365]\024\300\270/\344\322\017\b\224]\030\016[+\033+$V\f\264\253\222\205\254Z\272\252:%b\234\242?\030\235B\251\216\376@}\3500\255\350\217\224g\027\205OM\311\022\225_z\340\024u\355\t\340\352\211\024\232\374z\3132\206e}b\302\261C\245\306\212xoZ8E\241P\036h\324Q\250\257(T\317\336\242\350\331E\301M\262L\305\371\245;v\240N\274\\v3\201fh\262\324\035E\036uR\363\361\020\243\005\005\370\004\325\201\352`\270\034#\317Q\354\007\320\201J\324\037e:\242o\326\322\232\216\f\247C\246J\214\217\245u\2236\327"
+	.string	"\001\307\210\246\247\316\211\327D[\213\212FH\2234\3170Vw9\240\211S\346GdJ\357\n\247xx\274\247\032\207\306<\2359\337\234\367\316zh\363\351\215T\020\314\244\253\313\311@"
+	.string	"\251l\021!\003<\222\202'\202+\250R\3218F3\231BfHdD\223$\205\016\222\n\020\206\002y&H\327\003\022\200T5R\"\245\f\325\210\210\244 %I\215e\r\2228\221\001\210\330T\224D\302*M\222\342\204\251\\0\321\022\215\361g\375!\300\223\024\2548\225l"
+	.string	"]>\267\342L82\271\004\247B\243\360\301\342\372\032\177z\215\273\0306\203\310\016J\320h$\261\007\360\224\351\3749f\023\347B@\365\365_\212bjb\3225\234\277\313\3238B\032\241\313Jt\211\315\215b\217H\364\037\244\276x\216\027\201z2\346\312\226\024\316\325c\3730\n\005&BO\327\263\210\316\031\325\022\331@uEq\345\205\027,A\363\025N\204[?k\201\377sN\325\212\245T\246\251b\242b\025o\247'\343R\013\246\321\310\374g\357\304\002i\034\375rbm\220?/D%W$\2673i\272\255\345z\031\037\3715\230F;\270\265\224\023\377m\364\233\335 >\037\"\276>iG-4\323\t*p\020\371Kn\1770\231-t\203\377a\233\370\201\342\246\224!\224\353\222\252\235\302\214\360/\323\237D!\277\377\370@W\026"
+	.ascii	"V^P[@\250tgU,\211Y\232\326J\314\003G1\013\030\023\3171\330\342"
+	.ascii	"9ta\2018\003\231\251\013h\263#\334?\261\347\b\005\254\354\025"
+	.ascii	"TO\"\352\231\034\300i0\352\231\022\007,Z\021\b\336\274DJ\340"
+	.ascii	"sZ\354\220`\031\246\374\3265\300\363\302\207\270\n\021\306\217"
+	.ascii	"\017\364\343k0@-\306\200.<\320\330\005\022\037or\361%z/\226\270"
+	.ascii	"\302B\277\355\240e\376\016y\220r\332\346\025\343\373K\253\365"
+	.ascii	"\031]Oa\n\223\315\272\256l\304\354\350\2009<Lu\207 \341\231\214"
+	.ascii	"\267\351[\031\254\026E\235Pw\306Jc<a\271\304zN\244eZW\222\235"
+	.ascii	"d\231\263q@\033$\004>\377'\326E\r\373\035@\2744M\002\201\250"
+	.ascii	"\337@\343\013x\335\t\222\r\344\"v<\275\217\345\254z\253\224\247"
+	.ascii	"4(\325\370\342\315p\t\002\254\213\345(X\325\005\327\006b*,,F"
+	.ascii	"\300\210\310\013\264\022\r\315\260?\236\357X\005\264\302(\313"
+	.ascii	"\0208\200\230\216\262cPkI7\374\007\206tf\377\203\214=\372\200"
+	.ascii	"\206P\260h`\2159N\001\375\b\356\bP(>\301\nCu\364X\303_8\303\264"
+	.ascii	"J\274\275-\210S\324F,\022\200\222@ \036\332$8\275y\277\312\347"
+	.ascii	"y5\324BD\225\226t\344\251\356i\323\261a\205t\247nz{\0367\224"
+	.ascii	"\301\030\335*\361j'<\231\344#\226\0167/\344\375\237\211.PnLx"
+	.ascii	"\3750C$Q\200h\231\n\320\304=\177\016E\026\002)\351Lpb\340s\311"
+	.ascii	"|\203FP\007\225\270\242\301\352\025.Nz\275\3724=\020l\257\245"
+	.ascii	"c`ik\276\332\202\034OI3\231@\241\017G\374\216\300\324JM\270\324"
+	.ascii	"\245\026\t\316\244\251\355'\245\004\200f\025\034\\\214\320\333"
+	.ascii	"I\037b\303M\316f\234hS\037|\267\372o\227\001\235\035\222\332"
+	.ascii	"~\327ru`\210\335\005K@\320\212JF\264g\2332\302D\206\027V\377"
+	.ascii	"\267\021\371\277Z\333\002\306\221\347\256\003\t\372\226\201\027"
+	.ascii	"M\276\331e\243`Z\003\357\001\317\f\261i\367\005H\235\t\374\214"
+	.ascii	"\267Y\274g\325\271\f\227;i\322\351;\254\217As\301k5\3607\034"
+	.ascii	"l\267\214\213\361\331\267\270H\307\215\215C\2358\207\t\003/\245"
+	.ascii	"|\\\035\374\360m7\\9\374\016g\213\331o$\200/eN\224s\006|\375"
+	.ascii	"9\331~\211\3140n\306\021\305E\2333\275-}\302v\263\3152O\207\347"
+	.ascii	"\374\340jv\004]\013i\205\305\034\337+>\366f\017\022\233R\016"
+	.ascii	"\315%\357\021h\376\344\256\266]\355%\225\3751\257Q|\357^(n\371"
+	.ascii	"\231\366\276\222\356Yi\202\247\277z\b_\267\330\342\220\207xf"
+	.ascii	"\301\246u\017\005\330\320\363\344\257w\330\302\346\330\335\251"
+	.ascii	"b,p\2238t<\202H\032l\003\237\3563\221\270\215\373\251\363o\342"
+	.ascii	"\005\337\230\260\3755gN\017\2778o\367?\013\270\\/[x=\242\352"
+	.ascii	"\3022l\005"
+	.text
+	.section	.gnu.lto_.symtab.f679931dfba2e2d5,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"blackboxWriteLE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f679931dfba2e2d5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1014 @@
+	.file	"blackbox_file.c"
+	.section	.gnu.lto_.profile.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375 \335\205\005"
+	.string	"\004\t\321"
+	.string	"\017"
+	.string	"\226\366\215\243\f\b\002"
+	.string	"\002\001\002\002\002\001\002\003\002\003\002\240\342\234\212\n\003\310\327\237\343\007"
+	.string	"\004\320\274\227\255\006\f\002\003\002\001\005\224\314\206.\f\002\002\001\002\004\002\005\005\002\005\006\240\253\330\323\n\002\007\340\265\232\366\001\004\002\006\002\001\b\332\252\332\370\n"
+	.string	"\t\374\252\256\315\004"
+	.string	"\n\203\251\250\271\002\006\013\355\364\335\265\007\002\f\374\245\372\373\003\r\207\270\265\367\017"
+	.string	"\016\311\343\347\203\007\002\002\003\002\001\017\254\265\262\204\006\002\002"
+	.string	"\002\001"
+	.string	"\f"
+	.ascii	".Rd\006\203\004\225\320l\267\t\253uva\212P\340R\034\374I!K\270"
+	.ascii	"\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375 \302m\003"
+	.string	"\224\003\266"
+	.string	"\016"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	""
+	.string	"\006\007"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"\t"
+	.string	"\n\002\003"
+	.string	""
+	.string	""
+	.string	"\013\f\r\016"
+	.string	"\003"
+	.string	""
+	.string	"\017"
+	.string	"\003"
+	.string	"\026"
+	.string	" \004\025\367\b\301\304 P\341E\2316\200\234\250\f\370\354\361\262\374\252\245\225\005:\017"
+	.string	"\214w\305\006\330-e\205\241\316"
+	.string	"32\357\005\371l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`-\003\305\016"
+	.string	"\346RD?0\247*\215\001"
+	.string	"\273\333\352=\377\344~-V\363\366\220:v\231xv\245\262\211\034\021\325\023\022\244\351Z\322\bB\244|G\342k\251\200\210\b\004:\004\323'D\234fbI\004\322\335\366\226;\005,"
+	.string	"6"
+	.string	"6"
+	.string	"?\324\364\356\203\017\267x\367\375'\037r\223\277C}\374/RWOw\3674?\024/4\024\270\030\364a\204b\274JR\r\317-7\001\321\305\261bu2?7\251\230\377\321\022\211@\003\215>\f)\210\201\221Gg\371[|\030\263"
+	.string	"k\352\211\261X\f6\037Ba\246\003.\215\200\023"
+	.string	"\022\347\330}\230\031qwG\nWJ\363\0372\fT\255\220\2043\314\364\342k\003\201\310\366\321\005,\213\f\204);\337\263\n\322ow+OUM\365\"\341p\245\220P\323\016H\300\231\b{Q\216q\200*@2S\253\007\037\2269\217f_<\271\351\354\330]\313\332\260\373\342'\216\354\356Bh\263%\333A[\252\326JR\024.\232\024\025\255CPa\250\321\255b2AmYI\032\003\220\002\221)3\017\022\300\004B&\235R\026I\005\006u\322~\006,g\375\245\035N\211h\363\234\024\303\037WL\330PM#\277\177\255\201*\352b\366\277\273y0n\237\213\313\220\037\311\354)lb0^w^\026\255DU\263E(\314K\232\004\242\272\225c=\302\206\005H\207c\325\203X\222\242\210\006B\304\026(\314t"
+	.ascii	"\262\221\205\252Q\366\253\262\306r\226\340\214\337I\372b\317"
+	.ascii	"hB%\016fn\272\"b\340FpgO\006\310e\214\005\r\322f\347\350d\237"
+	.ascii	"\344\221\024r\241\026G\305\306rzh\361<c5\306\242\277\243\272"
+	.ascii	"\333Qx\340,\3654\204\370\347O\205\r5/N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`2\b}\027"
+	.string	"V\234bC"
+	.string	"\2216\035\374\032\254\b\320\244\365\377\337\333\3757\315\364\177W\325\372\177\352\247\227\221'm\200A\257\367\3044<\005\365>90N\262\033d\315\205\307\211\306\032\355\232q\300\360h\036U\343\344\266\355\266\267L)F"
+	.string	"P"
+	.string	"N"
+	.string	" \342"
+	.string	"\027\227\3376\344\376\343\373\356\377\222\273Se\303\314\201\207\371_\276\367\211\215\236\263\331\235B\273\356\264\037=\030\362\265\346\373\276\357\321s\275&\177M\356\235\262\321\213\217\336m\257l#s\240\264\355a\030{\222\b,\026\354\037w\323\201a\363\230\220kA\205w!\301\372\276!o\004\373u<\260\366?\305\304\034$7n\230\335](tU\315\312av((\214&\2633\241\320\035f7B\343\004\nw!\3740\273\220\030OfG)\244(\233\345(\022\356\3365\0343\376\034\337\177D\327\224\007\307Q[x\304\256.\266\372\302\234OP\312\271\325\332\252\371\227\212\337H\230\331\n\177"
+	.string	",\"\337\372W\030)\030,\254/\322@\215\261U\031\3468\003\002\362\002r%|If\367\025\024NO\033\271\317\3744^\"\377\246B\027F\032\301U$\216tq%\007!\n\021,\017\350#B\300!Z \306]\030I\245\201\251\254\204\226e#\221\002\227\262\221h\262\007\364\211\376d\350@\230L\225\254\252B\b\023i\227\210\212\226,Z\215\270\n\3434RK\205\342\001\324\321PB\362\351\234X\2665\036\002:\342J\200\200\240\250qM\251\231\231\221$5\262\214\001`\002\021\242\243\352\022 bI\022\2441\f)k\004\"3##\023\330\202\242\032\327\244=\200Qh \243\031\006\271O\372\177\211\227"
+	.string	"\356\314\t\361\254\355I\352\340\021d@\350\335(\241\347\247\262\301\3345\036\356\004\202G\020\263\314\341\\N\255\336*\030\232\210\n\fe?$`\031\023+\357;\035\363\026\252\026[\265\340\302\006\t\270\320\240[@\210K,P^\241\221\300\235\bjQ\262\f\212`|\210\332\262\016yP_Z\234\002r\330\267\"\177\311{\324,\340G<FG\230"
+	.string	"\305I*\322iF\227:\274\323O\2131\236\305\244\211\267/\265\216\304x\215b\317Mj\bv\007\033\317-mp\031d-\245\370\257\330o$\323\366\370"
+	.ascii	"\300?3\2468\351\021}\346\221)\375:;\255%ey\353]z\241\201P\020"
+	.ascii	"\246\220\36488\361l\241\201\342\225\233bR\f\033\260\031\233\334"
+	.ascii	"\245<*v\2025TL[\b\243C(\332\205\006d\005\350u\216\301\003B\035"
+	.ascii	"L1\227\330+\002\277T7m@\262-\231\352A\216d\217v0\231\243T;\004"
+	.ascii	"3{\345\365\rH3>\325\354\201#\244OGsko\315\356\340\212\007\022"
+	.ascii	"M\210a\207/0JC9\221h\370eK\225\017\365\007{"
+	.text
+	.section	.gnu.lto_.pureconst.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\271\005\003\270\004\004\231\005\005\264\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004\t\230\004\n\230\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"E\005"
+	.string	"\202\306\026\"\220)\351\377\363\333\337\335\335\035\004\224\344\217~I\357:\02284\251\351Q\315\200\377\210\333\266\326\244L\001+G5\230s+\026K\314j\251\305\322}\370\002\341\0378\036OC\202{\030\030}\345M@\347%\303`\027J\"m\322 J\177\336\2247\235\211N\324\276\250\262a\3043\005! \200\0029t\346\001qs~\""
+	.string	"D\0060\264`\353Vf\002\026-,\250o\276\331\211<\002\324e\260\357\232\002(\240\nc\b\341\f1\276"
+	.ascii	"F\006(\321f\334\201\210\205\353\232\206}q\320\256|\337d\333\277"
+	.ascii	"\326\325\260\t\007"
+	.text
+	.section	.gnu.lto_.lto.90cb62fde0fc568b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_largestLogNumber.30.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\035\004\r\036"
+	.string	"F\370\304J\240\326Q:\004v\247\373\320[\340(\027\333{\346\233\364\352A\241\007\276)\210b\270\243'\272\360\311\201\200\365\230\336zY)%!_\212\026T\257\002\357\f\235\314\030\343\272`\314\207r8\307\323Q{T\302\246\265\233\020\262\345N2\257"
+	.string	"\247"
+	.string	"\264"
+	.string	"\243\220\017)\2720\305\357\017\030\373\ru\024\357\025\332|\344\004\366#\013-\377\352A\212\270W\205TA\231/\207\222\021/\367^\334\314m\344\307z\032\371\261o\260\245\275\313b\266$\307\332&\355\361?|\375\001\243\313\0314\272\214\206F\023\324c\265Lb\252\272\024\340\213\212\003V\354\362QK6=\275t:Y\021\024\271\2700U\235f\360G\307\231{\257\031L\242\265\"\220\341\325b\026T\252\266(RXN<]\n\"\321\376\321\323\315\332R>.\005\bU\033|\361:\362\341iv"
+	.ascii	"\243(-\035\334{\231\236\301\2463\2003\263\022f\3361w\223`E\263"
+	.ascii	"kp\nr\326\001VP\031^A\242`<\243/\362$\271\002T\367\376~\372\330"
+	.ascii	"_\204\032\035\t\372s\326\265\037\224/\2446b\026\372hO1\037\007"
+	.ascii	"\007\026 w\r\346\222\362-F\331V+)\323d\236u\216\271\360<\213"
+	.ascii	"\035\353l-\345\262\244LZ\312cI\271\222\224\351H\371\001J\031"
+	.ascii	"Q\006h\271\227)\354\313\375\032\273t<\353\027\376Xo\346\363\215"
+	.ascii	"|\213\331d\242\037a\006FS~\334{\265\230\315\027\341\023\331\314"
+	.ascii	":\301\302\007\244\001\021\263\371\361\314E|\"\037\262y\254\236"
+	.ascii	"5\002Z\242TU\361\336\273\300>\365\t\327"
+	.string	"\024\037\225,.\266\276\365\231(\2051@eg&$?\002Y6\177+g\002\375i\353o\375-\234\254VX\025oe_\3539@\030D\001ZMUH\262z\345,\206\232\217#\3313\004N#czl\016Qa?\036>\032\306I\256\220\360\030{\212m^\3736\006\320\376\006\362Zwb\301^\260?\n5\0373h\240?k\337~`\276~mt\250.OUjO\001\370\006\222\366i\f\255\324h\007\017\364'm\r3\3365t2\1778W\b{\357U\260\004\204\216\315\361\221\177\202\374\370>\361\025,J\313\351\342\210\2065\321IRS\367\024\3778T\001<\342fG\267\353\021\n\302\345z\206v<?:\034/h\bw\343\n\022 \334\214\234s\241B\345 \037\240\335H\304\023\372\311\215BA9\037\236\316\256\344\351z\232ynr;\235\210\020(\200vH\360\350\354vp?:\235\0228\036^\020\356\346"
+	.ascii	"\003\231\310\361pB@@<\234)<z\215\311\264P\217,\324\346\261X\177"
+	.ascii	"\370\263P\212\361u\324>&Y\265\266e\016X\365\256\350O>\361WAt"
+	.ascii	"\212\365\024\177x\273\245G\026\323\346\\\313Z\333^R\362\230+"
+	.ascii	"4t\326\314\275!\017\350\317\030\t\\\376z\357\275v\264\315\265"
+	.ascii	"m\r\024Ik\256\325v\255\227\230_\336\3326-K\250A$\306\f#\210!"
+	.ascii	"23\023\020ia\013\007P\0021\306\224\036\020h\253\302\2441\240"
+	.ascii	"\020&\323\365\301H:q\314\301\364\363\021E\026\fC\200\221\226"
+	.ascii	"u\242\366Z\231\336\215z\220O\037N\347\341\341\325-.D\2261O\002"
+	.ascii	")\252\267\343\234b\336;\251\342l]\213\rYF\034c\201[9\264\021"
+	.ascii	"\031\030\352.\270\273\bsM\007\361\030\210oD\240r\266\242\023"
+	.ascii	"$\021SD\365\363\235\310!\tv\036\314+\327\275\201o\004^\202\027"
+	.ascii	"\355\320H_\b+\223\303q\252\001\336E\340\374\316\234}z\"\3232"
+	.ascii	"\250a\347\003S\340\212i\221O\325"
+	.text
+	.section	.gnu.lto_openLogFile.31.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\343\004\235 "
+	.string	"\346\372\323H\200\334Q\007\177\256\220#,\357nH\345\004\363%\361\341\tHj\366?!\275DZ\214\220\330\224\205\211kwX\365G\327!(\007\331$\257y\231\304\235\226G"
+	.string	"\r\267j\003\353>\240\254\351&?<\326\332&[\356$S\n\272"
+	.string	"\262"
+	.string	"\304"
+	.string	"mCm\243\327\366}\333\177\332\266o\333w"
+	.string	"0\223RTX\036\314\232\217\3156\271\354J!\342\\\356\335L\355]\235k\327\362-&\347\222\261+\256\031)\"\271j\245\345\234\027\370m\b\251\337\235\023@\375\236>"
+	.string	"\365\333\017$05\366\325\352h#^qZ\222\226\363\332\373\037\216\375\226\332\320{\276\305\355C\277M\330\241EK\255\307\215(O}\r\325\322v^h\243\205\211{\261\001u>U\226\223E\275)\312\357\243\221Y\202i\202\304\341\247\016\322\230C\026\355\237\004\216CT\035\244\361T\300\214\242\306\273\334>!\211\326\3320\344\234\333\252\310\033\3368\357\356\251\356\226\352>\223\001\037R#\020\257\033D\b\353j\357\234\274\211;\021\266_\365\210\022\267\275\004\352\027\375\033\224"
+	.ascii	"\373\337}\002\205u\365\276\221rUc\026\177\330\215\226c(u\006"
+	.ascii	"\360\026C\377\005$1\263l\377\212\321b\351U{SA\375\376\243i\236"
+	.ascii	"r4\331f\003\260\335E>\324U\3739ijX\304\037\272\035\243q\304\372"
+	.ascii	"\257Z\340\376D^b\212v\255q\354\217\361#\324WW\202\224\346lt5"
+	.ascii	")5Z\340\371\355\016\266\260\256\372{\227\247fJ,5&\215\037v\257"
+	.ascii	"C\373U\335\376\315f\263\331\357\243\333\271\274um;\007\265\215"
+	.ascii	"sm\347\3366\356\264}Cm\247o\003X\351ae"
+	.string	"\306\340\210\301\301\345~W\374!\020\3678^_\234\334^\007k\313\212\316\310\227M\210\246_\340X\304+L\321\256u\372\335\270\312\315\204\272\263\245u\243\232a`}\365.\030H\032$5\316\340\202\263v\316\266`e\2033\262\306B0\021\353j\372;`ce<\253\303\202\213\370\227\0256\222\032U\360\374\356\274\263\214\341\2544\347&W\2731\022\257\202\225\007\254r\316\023\250\270\030\336j\277\362\333\270\313\307\007(\203\005\233R\346\364\303f\340\266\327\275%3&\211\266\331;\266\233C\007\353\252\355\275\315VVc\022k|y\263D\277\312\033m\310\221\3455`\357\373\352P\220|\211\225\257\376D\310\313\222W\001\215\343\tyx\277\025G\277_\020\270\323D/\276\2034\374\364\030Ip\300\263A(\250'\374\005\201\001\032'\344\331Q\340\tyx;\337\322\220O\251h\027\\\332\031\371\200GC)v'H\b\375t"
+	.string	"\362\t\3721\221\240\205\277 \360*\371\210\222\\x\370\005\201\267.\352\361\001\217R\240\200\021$B*\032\002\022\365V\034\r%\365\212\224\204\275\036\004\035d\341S\352-\005\203J\275\334\232\375\314\357\243\321%\033\260\260\324\035\243\336\345\033\226d`a\267\035\2439\377\324\3359\337\030\232\236x\346\234\363-\002\2335\254\254\240\266\006G\351X\351H\215\236ySxG\032\335wc\036\216\006S\351\316\316T8\232%\267\240\232l\363kDa2\225\346\320\230\001R\250Q<\242\024\203Fff\202\311\214\002\267\001p\002\021\231B\037\021`AC33\263\205\315\001\201@\263"
+	.ascii	"\021\013\\o\356?f\032\346\334\227\f\365 c\304\237\245\262\001"
+	.ascii	"K\227~!.\025 \036\n\221\314\303'\376(\213\007t\364\237C?\002"
+	.ascii	"\006\232\354\217\n|\274t\315\201I\260 =EhZ\f\f\020\255\300@h"
+	.ascii	"8\004\232\204\274^\027;\024HT\373mf\262\325Z\240\322\342\005"
+	.ascii	"\273}\016\302,\335\365\177\006\201#\261\034Oj<\230n\361\314&"
+	.ascii	"\377\311~\330\305F\264k\374]\024S\036\342r\351\311\241\3213\237"
+	.ascii	"\3579$\237\253\231'\242!\300\270\240/?4\275\030\271 $\375\376"
+	.ascii	"\306\235\252\022\250"
+	.text
+	.section	.gnu.lto_drainRing.32.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\376\004\305!"
+	.string	"\006\177\336I\200\030R:\271p\232t\321R\032\274P'\\ \001\255*\337\245\266\237\3648\373\004\017\300\240\362\036R\242\356F\205\350\212\345@)9\363l\263e\002\331 \025\322\276\2773h`>W\017\366\027\374\020\362\302~\311'\204\310\235d\306"
+	.string	"\274"
+	.string	"\314"
+	.ascii	"`\177\327\257\374\275\230\337\344?a^\030\373\266\252=\214'\030"
+	.ascii	"U\210\177\361\231\314\003\223\"5\243\303\372\364\314/\370M\356"
+	.ascii	"\344K\346y\305\030R\272\020\223:RX\237\276\213]\237h\254M\260"
+	.ascii	")g\333*\033<e\b\353S\376\326\231\274`\026U&\221\273\037O#\330"
+	.ascii	"[\333*}\275\353\250O\321\013P\2376\020\316]\366kNM\321\276,\277"
+	.ascii	"\275\316\236\276\2429)\252!\357B\303\n\025\212s\226}I\274\271"
+	.ascii	"\235\021\034Wo<E{X\322\214\007\260x\300\361\220R\027E\013\250"
+	.ascii	"mIb\203,\242\bt\370\020;\363w\n\031u\373\313'8\302\\\262AA\342"
+	.ascii	"\370\315Yh\333\226\357\021Yu\326\235\231w0\263\013f\364JgU\235"
+	.ascii	"\376\223\017\241I>\001<\237gU^\347\364\231G\235\3113F+b7\253"
+	.ascii	"H!\233o\372\215\323w\255X\204x\237\214s\357\031M\375\327\313"
+	.ascii	"\212|\222m\013\365#\263\321\311\330\n\311\247T\370\207\324>G"
+	.ascii	"\033iR\375\304\314\300\217\261>mm\333F\340\213=\n\n\276\326S"
+	.ascii	"\016*\335\037\237\362\225\324\2477m\240\006\326\025W\027\324"
+	.ascii	"}2+\237ng1_(\031'\206\033\213\271\207\207/\357<\354\254s\260"
+	.ascii	"s\316\225g\234\233w\235kx\350\345\235\356\262n\275\274\346.\347"
+	.ascii	"\322\313\252z9M/\243\367:7z\371\366\345\023\020\321\343\215\314"
+	.ascii	"\202f\333R=\321\264ii\031\221\207\375\001W*\203\253\3537/\206"
+	.ascii	"\025\262\262D\036\2065\362"
+	.string	"\26360o\376\013\213\344\316+\255\266-\376\310&Y\213D@\314\254\022v\311\375\221{F/gs\342k1\273\305r\261\\\352\323]\353\254zwm\346\013\031\356\217\272\356E\251\255`\264U\213\317g\352\323\265m\226kb9\n\\\346!\r\352\217\271\266ab\226\204s\022\373\211\371\214\f%c\251\232\206\347\336F\373\367\240\246\315\374\001\304\375Q\355\333\350a\374\026&\007Lt-!(\264\265m+$\342YFH\300\222v:v\274\261\323h\243h\3064P\367\371\273\231m\275\241\235\345\244\336^Z~\211\272q\314\\\342V\234\326*\027\250*\n\234N\327\364N\007\215\025\315\344\364M\333\006\274c\372\351M8\001\024\006\177I= \246\037\240\336\260\251\007l\n.9\365\212H|\300\300!\303\205\016\030L\374\034\031\335& SR\322P\025\006\177M(Px\364\023\006\177,~:\024*\202\300%\035#="
+	.string	"\n\203IF-\206GJH?\341\221OE\360\227\302\207\264\304\344{\340\303\303\025\300%_\323p\270\344\34313+[\347\321\034\257\273\247\230\031\247m\216fiPM\344\240\033\364\356\177\335L\321"
+	.string	"7VA\031\026\b\033\344\313\357\240\220\245\025\373\311\271v\026\237\371\rk;\214S\324\236\237)c\363\342tMO\235\371\037\035\306\246\312\323-\310\256\356M\363z\212Uk\372\313\007\340\362\303\207\233\032\332\266m\233\333\351\232\356i\242 c\212E\210\274\346\351\356\"\205\310\306\fS\250Q(\303\220Q\304\030\203\220\0045C\322\250\003\200\002\221\271\262\016\020`74IAsD"
+	.ascii	"6!\001\017i3\362\331\327\205\333L\226R>h\366R\327b\350\354:\353"
+	.ascii	"\016\230\022\030d\026,wRE\013\373\006\366\327\300s\247}A\003"
+	.ascii	"\335a\352\374\276vGZN 74\342\345\346\330\316C_\030\376_D,\r\217"
+	.ascii	"\016]\325\314zK`\2241\3018s\276\347\232\337\216t\204\352\027"
+	.ascii	"\227\017\013\360T\331\257\370\003\234Z\264\202iA\312f\326\030"
+	.ascii	"\005/![c\372v2]\327\336:#\032\206\326\225}`>\332?\315\306\221"
+	.ascii	"Cr!XN\327\204\273\032FM\340\214\022S\003\346\265\214\037"
+	.text
+	.section	.gnu.lto_blackboxFileThread.33.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\f\006\235$"
+	.string	"\332@T\016Ip\032R:\003\006\022mAg1\0024\021(\302\337\232\324\205\351\254Y3@\224l\235\002\302\356\341\276\310\177\303\216^"
+	.string	"'4x\013\365\302b\035@\321%\303'\362\245\235\265\3162\210!N}B\247\252\266'\215\020\262w\222\001\323"
+	.string	"\301"
+	.string	"\321"
+	.ascii	"\335\273_\322n\007\220\363W\025+93!\364\021{\365J^\326v\273\021"
+	.ascii	"`\202a\351\234@\254\234r93\177\315<\320z\225\275\200\365*\366"
+	.ascii	"\321ic\334\336\327\303\263\323\343\355X\335\252\246\370\266\375"
+	.ascii	"\261\254\373|\306\264\336\223:\200K\213\273ZqG\nt%\204x\263\023"
+	.ascii	"-\213\310\313\263C\324\205u|/=\032\312\035w\342X\225\371\262"
+	.ascii	"\250\343\362R\003d\302\030\271Z\361\230&8\366x~Y\314qw\251\003"
+	.ascii	"$\030\255\253\025\271R\2401^i\276,\342\270\254.)M\242\204+\203"
+	.ascii	"\323\205\305u\335\326W\237\261*\035\3129\337\354\267\206\321"
+	.ascii	"\352\2527x\306\341\n\024\006U\276\253\310\205S\255c\2361\353"
+	.ascii	"W\227\224s\356K4b\275}\336\375\003\335\255\241[E\006\302[\247"
+	.ascii	"\003\334\373\206\256w\336\212\322\017[\316S'v\227x\025\340\217"
+	.ascii	"-\347\2144\345T\226\372@\2566S\n\265\237\242I\305=\361\370'\312"
+	.ascii	"\233\350\020\007{w\273\237\\\334\023}\370f\177\222\310&J\205"
+	.ascii	"\203\375\343\271\27198)N2\203?X\034\270'\030'\373\367Z\212a\215"
+	.ascii	"\277\272\337|\373\322\333lz[\267\336V\323\333iz\033\253\267o"
+	.ascii	"z\373B\003\330\220\307d\020\274\306\314WssrT\275\"\366\263\277"
+	.ascii	"\371\333\375\356;\373hO\016\245\375\331\2144\337`\346\254\333"
+	.ascii	"\020\022-&\261W\237}.`=\263o\326\275\253\335\344N\3327i\f\t\231"
+	.ascii	"\331\330ByV\366\340jS`\257\016\245\357n;\b\250\310\254x8\331"
+	.ascii	"\375\250U\305_6\3332\374-\312M\305;,3H*P\025q\263\303\311\024"
+	.ascii	"c\374\256\346\231\356\rG\343\201mK\361\245\234Y2u\347:\300}\332"
+	.ascii	"\357<\033\207\016_\363`\006\343\237\347Vt\270\345;O#\213\223"
+	.ascii	"}W\365E+\366\242\336\027\255,\256\321]\340B8\213\357\374\030"
+	.ascii	"%\004`Q\240\021\230\230\376\020\342\236\330CU8\230\352p\3626"
+	.ascii	"3\370\206\206A\225+\376\352\027\353\3050\232m\302\033\247\203"
+	.ascii	"n\267\210\021\367\304\213'\020\345d9O.\032\274t\302\240aP\025"
+	.ascii	"'\271\274\313\275\340\223\350K\314\303\263!\231\007\264\257\245"
+	.ascii	"\337\330\237\304z\225\005\221\225\32122,\335\375\0264\007y\314"
+	.ascii	"9x\344\333%\346\006W\217\217x\004LN'\232R\026LRRMP1t@)\340\211"
+	.ascii	"\264\227\214\230\234\232P\224\220\361dB\305\022\320\311\304\217"
+	.ascii	"E\023p\305o\t*\352g\244\240\237Z0A\375\244\236\236\240~=]\177"
+	.ascii	"F\232s\327\205\237\375pN\356\\G\270\375\266\307\372(Gk\275\330"
+	.ascii	"\234\205\311\326\207\357\371\305\202\220\371\343h\255\262\221"
+	.ascii	"\3306o0kw\033\344h\255X#\035\355\r\226qi\276\273ex5\326Cc\275"
+	.ascii	"\307-\261_y'\245<8\331\375\242\365\316K\245\264\340N\001%\334"
+	.ascii	"\340\317\363H\264\n\007w\030\334;_\247%\302\266FN\247=2\247E"
+	.ascii	"\322*\021z\216\255^lhz/Zu\370jrJBo\200\023\342t"
+	.string	"\370e\272\300\301\201Ss6Q\n\330\326\354\326\254\221\265!\272*\356n\231`\bz\352\210\nq0p\250\201 \344\034B\316\224\210\210\204\t\2234\035\200\002\021)\253\333\021\020E\210\bI\013\223\215\003 fC\217\3509\363\255\035\324m\203d\202\257\225\337v\243\340\324\006\362\266\227X\351{?U\324\262uQw\035\215\261\b,^2T\364as\377\377\f\006\250\21776M}\204\325\226]+\232\300X)yy?&\320#\202\274\031\311Mg\377E\362\201\254\370\347\033[7Dw$\005P\260\0318|fY\023\377\310=C\253\004\331\314aU\245j\210\211\237\306\310\017'\347\276\240|\2356\025\230\033\002\241F\253\252\254m\270\023=\302\221\024\026%\"B\016\307\354e\215G\350\267\307\312I@J\325\327\\t\235\342\322\310\226\347\302\3651\005\3233*\220\257\244\270(\2074\034\320{c1\001^ \302\351\202"
+	.ascii	"5\267<<\210\200U \272GU\003*a<L\231\236\303\220\001\307\327\303"
+	.ascii	"~"
+	.text
+	.section	.gnu.lto_blackboxFileInit.34.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`W\001}\016"
+	.string	"\226\232`E\360\260(\035\260\246\241\243\355\331k\356\336nX\360\346\210m\221?\007\026F\351\307\"\030U\311\271\001\313\b\3427$\267g>\255\206\340\213M#p\016\013\007\031\nC\213\231\fu\3060Vcnt\331O\366\2262\245N"
+	.string	"E"
+	.string	"O"
+	.string	".\254\267vT5\261\335\027\247 \336\335\243E\250\331\371\250{\f\\\003\360ux\374\250\034\302\006(\261\025\320\207\002\003\310T-\266\357$\025&\200\245\250\261})\220"
+	.ascii	"\013"
+	.string	"\306{\314s\365\231dz:v\327\351}\034\356\317mS\260\315\300\276\210\335gw9|\231\317`\360_\036\235\201$\357=\372$\332\343\025F%\306\"3\223\312\231\375B\245\266\354\303\325\026\333\351\3504\314\264:\375m\004\026\223\301\305\330e\315v6'\252\ba\273\304\336l;(q\367W),np\342\200\264#x\344\275\250z\300\303\207\031P[VpU\223\200\344~\227h\364\371\004\355\256\327\220@:\273\251{6\310I\210,\320\331]\216G\032\227F\362\236*\310f\226\243R\324]d0\024\352N\273\206h`\234\244\314\366\351#\002\026m\214BH\022<4\224B \242\217\220\020W\201\364!\302\211L'n\003\201K\026F&\356B\251d\342\266\327^[\374\230?x\261*qB\373\315\r\243B\335`\033\252;Rj\342Q\034\027+V\232\266\336i\366\3516]\001\023\020V^X\\4R9\013\035"
+	.string	"`\325#\231\200\343t\374\311\332\027&\371\362\r\007\246\001\326[0y\030\0065\320\226\334\340\006V\211\003>\315\034\207\340\202BWhX\305\212"
+	.ascii	"\330BB\263\276\0139\370\260\3220\3338\030\373j\346Xi\343+\241"
+	.ascii	"F\035\324\031"
+	.text
+	.section	.gnu.lto_blackboxFileBeginLog.35.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\226\001E\017"
+	.string	"6[bF\360\2606\035\356M\007\341\360\2022\017#?\3211\030'1y[\365\341\223\250\341e>\315<1\235\321\026xT4\222\021Fr\260\307\226\303\377U.!;D+\020\273\3537\311\234\367\315\301\250\331L\323\247M\266L)M"
+	.string	"K"
+	.string	"P"
+	.ascii	"\333\362\262\261\342|\361\301\366\212\r\262\215`\305\335AU\313"
+	.ascii	"cP\031l\\\273\340&c\336}bR;\237\343\344}j\035\216\235u\001;a"
+	.ascii	"\214\234\233\023\207K\023K\026`\025\312p\234.H\375\204\354\256"
+	.ascii	"\365;m\270\263\333n`\373\200\255\0167\fR\275\303\3544/A\362\320"
+	.ascii	"\331\265\360\317>9\310}\350\354n\202\232\223\220\340\317|\032"
+	.ascii	"%e\372)\331\247\255RA\377]\236u\255\306\216\3103\303$=\033\364"
+	.ascii	"T\302\330\227\257\327\213\307\362\305\266ZU}M\005\204\213\206"
+	.ascii	"\002\031\033\244\220\252\005g@\205c\321H\377\271\203E(b\220\236"
+	.ascii	"os\217\032\321\323\236\257\302\025\f\351\025\036C.\363$\231\n"
+	.ascii	"\377\306c(D\n\245(\374\226G\355$\331\247\306`G\270hD\374\204"
+	.ascii	"\3551$\246P\273\336S\266G\375\266\300\347%\310\305\244\001\026"
+	.ascii	"\201\214LJ\0368\240\300\215\220D\"&#\033\204\022\221\223MTB\331"
+	.ascii	"@\006\230\2130*m\0238\256\264\201\300=\266\362\305\037\017\255"
+	.ascii	"\226\376]v\326\027\344\310\264p0\277\313Tj\220*Y\374\024\277"
+	.ascii	"\366`S\302\230\270C~\rW\341\f\006@?\376\023p\021& `\002\031B"
+	.ascii	"\244\007`\352\361lh6$\234\346\206\317\361\230\203\230\313\304"
+	.ascii	"\362\207\361\260mZ\204\232\274]\372\357\341\206\377/q\214\265"
+	.ascii	"L\222\207\206\311\261\257\240\222\340E\233\350\320\3535\264\001"
+	.ascii	"j\330 j\343\306\2046\007\205| t\243{b{G\270\363\352\374\020\017"
+	.ascii	"\367+\263.\013d"
+	.text
+	.section	.gnu.lto_blackboxFileEndLog.36.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\037\002\025\022"
+	.string	"f\241uG\340\322&\035RV\224*\202\374-\b\200T\354\233\271\245F\037\275F\004q\315\352r\355\230>_\245_\037:\204q<r\f-\373j\255v\253"
+	.string	"\202\234\3638\230\214\316\334\215\023N\016Zt :l\005!\233\020)S\nb"
+	.string	"Z"
+	.string	"g"
+	.ascii	"\237\271\b\034\2516\243\261\013\226\230\301\367\316\266\0274"
+	.ascii	"\200\261\353 \317\315w\206j\204\224v\301\223\356\334u/v\234\246"
+	.ascii	"\3137\305^\367\276\020\217\036\312\001$#\034FC1\020\357>\234"
+	.ascii	"\013\211\311p#\273\373\237\247Ml&5\246&\016\220\205=\246\030"
+	.ascii	"\215\246\207\262\273NX\314\303\375\3356\007\333'vJ\b\016\220"
+	.ascii	"y\207\361@\017Z\205\324v;\034f\253<\005KImw\035\200G\301\362"
+	.ascii	"}\336\371\202K\347\273D\f\031\362\260\353\177\376%-\201KG3\372"
+	.ascii	"\262\301W\252\216}\275\335nK\326\034\373\263\337sZ5\235\232\276"
+	.ascii	"\tf\225v\234\330\330\275\271\365\330\033]Q\t\33306\210\355\314"
+	.ascii	"\007\272\214\225\001\236\030,\nx\212\214J\345a\036\241\321\027"
+	.ascii	"\327\251N:\224\205=\234]\321\323\0028'\202t\310$\017\177\350"
+	.ascii	"\033`(\035\275\322\307e\241l\206\372\205m\"\265\356\252\330\302"
+	.ascii	"wa\333\227_\204\235\325f&V\370,l\023\311qU|w\025\266m\"I8#v_"
+	.ascii	"\307\261mK\330&xw\005!1\223?\002\025X\020ZV\250\027U\013\200"
+	.ascii	"S&\252\225\025\205\t\032X)*)\324J\312\251e\205b9\245Z.'\023\004"
+	.ascii	"fYP\265N/,V\353\004\002\356\271\325\034{5h\264\374]\361?\177"
+	.ascii	"`DD#\212'\272j\214O\373\323\2079\357B7\312\237\241,\364\211\252"
+	.ascii	"\343\344\270\223D\025\241z\222\230jc\013\310\222\247\006+ `\002"
+	.ascii	"\231\2613\017`\365\222:tx\2121\022V[\201\005\304\211\020\f\366"
+	.ascii	"{\302\304\352Jrc(\352t[YeQ5\212\333\252\321\270\372\313\336\203"
+	.ascii	"\241e'yk\206\234\344\r\327\333\274\026\356F(\322\003\0256\254"
+	.ascii	"\320\2701\241\r\203\n\342\3359\210r\263w\032\362\030\267K\332"
+	.ascii	"\333\214a\332\350\337\032\177\267\362\355\262\360\004"
+	.text
+	.section	.gnu.lto_blackboxFileWrite.37.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\266\003\365\030"
+	.string	"\226\356\240G\300\226M:u\016\f\257\322\3063Q\210\253\020\311\324\021\331\367k\273\367\377&y`[2\0373*\\\337[\034O\"\337\304\361\2376\032\003\007\nD\205\225\354<\226!h\251E\026\016\241\037\255\263m\377D\223\275\245L)\212"
+	.string	"{"
+	.string	"\222"
+	.string	"\027bWT\370i4\377b\207\225\227\013\340\245\332B~\323\237\354rRa\200E\315d\201\224\225T\001dR\001\016\305"
+	.string	"\245rZY\346\344-\270\364\004P\017$\264\314\2348\276DP\265\257\364%\241\363V\0346\347Q\223#s\362r\354"
+	.ascii	"\2744\017\264\355\373\370\017!\207\221\267+\372\236\260rM^\346"
+	.ascii	"\344\311\f\034\347\273\214\267\371.\027\351\3415\364\377\364"
+	.ascii	"\330\003\212JW4t\215\2410\347\264\352\212\214\356\275m\004\266"
+	.ascii	"1\330\021B\266I\374H\230\340j\316\371\300/r#%|\035\227\266\241"
+	.ascii	"\320\353.}\024\337\345ke\220.ZJ7\355\331\274!\335\034\366\343"
+	.ascii	"\334#\373\274\037\307\352\233K\3356g\272cV\303\036u\327\034\310"
+	.ascii	"Os\247\373\025\325\256\250\236\211j\231\250\006U\035#\325_T\313"
+	.ascii	"O\035\245z\243Z\243\372\003b4\240H\3502'\214\036\230Y%\221\354"
+	.ascii	"\270\324\037\3653\375N\217\366\207\270\330B\372\342C9r\017f)"
+	.ascii	"\013\227\204\243\2738\033\327\346\320A\257\263\353\006\356O\200"
+	.ascii	"h\354\341N>\024\330\3159#\200x\023\035\002WL\342\236\212\216"
+	.ascii	"\306\315\356\376\351\n\226\254r[6\013\333\233e@%\266\247\272"
+	.ascii	"\315~\310-lY\242\352\365\036~\257\215\355\222%#\271\032K\263"
+	.ascii	"\260\225\200\205\343R3\347\303O\267f\027\204\301\331x\355WW6"
+	.ascii	"\205K\"\322\236\001\250\336S\337\245>E\323\255\335\234\267\353"
+	.ascii	"\354\332\225\204\373dw\231\304\"z\366B\036\333\202\241\245\252"
+	.ascii	"\305\016\005;:\032bV\033\021\203j@<<\266oD\220\b\0235\237o\026"
+	.ascii	"4\013\021MkP\363\351\341\321Ia\333!A\233\371\354\310L\364\314"
+	.ascii	"J\310h?@\262\006\007l;Q\373\221\005\331l?2\027o>\316=\262m4\243"
+	.ascii	"\352\266D\026\2409we\321\002`\t\021\354\2602h\200\355k]{%PO3"
+	.ascii	"{%\274\271\262r\335\026\231\005wf7\f\316\006liVf%\021\\\022\221"
+	.ascii	"7\334*\004\253\200+e\364\264\224n\337\306\354\241>\345\306\340"
+	.ascii	"R\242@\211Y\331\204\343!\367\333\234\334\026l\003C\250q,\245"
+	.ascii	"\024R\204\241\242\t\243\260(-\006\220\")\303n\021\300!D%4a\246"
+	.ascii	"9 $i\252\266\237\362\3010\370s\221\320\355\023eP\3629\254\370"
+	.ascii	"\241\234@#A0\006\310/h<_!\207\374\005\222,\"\207h\301\260\300"
+	.ascii	"\340tq\027.\224|E\205q\024C\036lopIwkj\224\037\306oA\342\314"
+	.ascii	"%\327x\243\356,\356\263\202\205\027s\300\035\2261\263GG\267e"
+	.ascii	"\2054\301\020\f9\351\036\327\261\203\345\206\305\217!H\222\347"
+	.ascii	"\204@\233\312F\beZh\032"
+	.text
+	.section	.gnu.lto_blackboxFileBytesFree.38.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\355\t"
+	.string	"\326\322D=0\345(\035\200\013\371^\277\004\n\177\016?\330\007\025\224ZB\331irc\205\030F\001\004\352\375\037;\002?J\213\360\365\375\364\t\026\006$`!\264\203\330\352\003\215C\237\375M\210\224)\0053"
+	.string	"1"
+	.string	"4"
+	.string	"*{\032\030{\305\231\017\217\027\003\273 \347yB\374\246\035!~\323\222{O\317\377\312\265\0012\341\367Z=9\021\273\353\374^!\267\3366\203m\007\373\n\001\233\255\301\221\377\256\267\031\351\320\225\r\256RI\354k\2530\333\351\230i\315tf\372\234\003\231"
+	.string	"\211\002\273 \341\201\r\260\335\240\330V\331\035?\345*\001\272\021p\311Z\031\332&=\306#\200Im0\231\2612tA\346\r ~v\027\323Cl\227\365\317\356\336\342\275&\266\273\020\340Y0\374\223oF\2456?\025\037\026}F%\022\305\304F\027\252\020\201J!\316\202\0042q\242\023\212\373,\270\273\030\235\270\214\256;q\035p\257\255\302\242zX\332\262\301\356\275\250\032Ui\\\"\251W\r\017"
+	.string	"`\251'\023\232\203\002/\277`c\006\177\025"
+	.ascii	"\301M\020\244\330d\252\314\205]\030\237\207\221,X\036\256\025"
+	.ascii	"\2230\311"
+	.text
+	.section	.gnu.lto_blackboxFileFlush.39.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\365\b"
+	.string	"\266\220=90\345(\035\200\213\335\026G\214\016{\035\363\335d\316@\"G\367\024\037\260P\031\205\266\327\237\321\217\322Z\364o\325\371q\005\005\220\r\210\004\217\005nX`\200`\214\035\245L),"
+	.string	"+"
+	.string	"-"
+	.string	"\366\002\311\245w-\325]\034\251\030\200\335\016\352\307K\317\222\177\221\277\224\023\027nez\n8\354\256\223[m\334z\333\b\266\025l\277\004\317\276\310\310s\327\206\016\r5\331\235)\325\303~\300*\313v\372e:3}\255\340\265\362\300\262\253\232\005X\225'\013\261M\2627\007\266\304cq\240$\365&.\330)g\3362o\024\355\257\223x\bZ\273\247s6\350]Lh\355.\003\354#\025>\310\237E\243\347\217\264\007\336`8\237N\004\004F\324x6\231\217\006Nt2 \270\t\211 \346\300\221\202\023\202\0261\206\340\326\355\225\365\324\340\244(\247^\237j-)\031*g\016\016"
+	.ascii	"`\251'\023p\346g\3204\341_\005@p\023\004)6\231&sa\027\306\235"
+	.ascii	"ad\t\333\027\301\206\251\235d"
+	.text
+	.section	.gnu.lto_blackboxFileIsWorking.40.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\r\b"
+	.string	"\322\21787Po\322\001 \371\252\025\200\217\317:\020@.z\025\240d\214U\235\272\363e\315\242\034\017Cf\204\246\367KC\3223S\036\273@W\326\215G\3045\fDd\023)S\n\3164\035\220\347\301\241B\343|\262\r\210\023!<\233P\3146Q\324\020X\213\350lqB\323\266\210}{kue\351\200IO\2067\270\256\226^0\250\224S\316\030\313\274U\256\203|\344\023\340\355\232\336\331\241\177\332\201\267\273\n!\027\221\360;\016-\032A\177t\035\332\024\026\371\356\272\220q\241%\373+\245j\330\267vw\255+\333i+\323\207\002+/\r'\273\251\031\231u\201(\036\266I6f;\201d\356\237\227:\207\207\"\211\331\375\242n\234{r\376?\016[LX:U\351\t\300\260\273\316N\205q\353m\027\330F\260]\022\n"
+	.ascii	"`\251'\023\272\371\201md\002\332\214\224\3140\346\032\275D\354"
+	.ascii	"\213\020\303tM2"
+	.text
+	.section	.gnu.lto_blackboxFileGetLogNumber.41.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"5\013"
+	.string	"\206TL@\020Q\225\016\030,i\255g\217\201\220\240\275\325c\316<\b\324\313\3506\211\260\303\354%\316\200\326\260\216\306\023\017\205\035\3331\231"
+	.string	""
+	.string	"\245#+\026T\341\253\247\247\200\022\335\257W\233g\367\336R\246\0248"
+	.string	"9"
+	.string	"9"
+	.string	"\361\360=$\036\352\206k\177\232\232?\001\261\342\265q\243\277\017.\303\365\245\b\013/*\234\351\025p\335\320\360\022\317\023W\312\234\030\330]\347\306a\270\341m\037\260-\300~\200J"
+	.string	"5AGv7JU\331\177\253)\333i\350tf\372\021\304F\f\0048v/\274v,\f\310\342\203m\221M\361G\234\204\310\332\353V\\\344\340\201B\212\034\273\213\215\\$\257k\r\023[\005UU\276$^+2Z4L\251\303\224\314\273E<\353-Ne\265K\372f{\216\"\003\260\332\335\001\335O8\360;\034\032\024\202~(\036\332\020$\344\267\007\316X4\235\215\202\004\0212\f's\351`0\006\233\213\007\313|@\230\205\304Y\003\315\007{\220e\037\214\322\3555\345L\355ZL\205\232z\322I\b\024IK\357-\270\n\355.f\270\240z\260H\031\023"
+	.ascii	"`\251\227U\300\223\316\242\"\260\310\024\2465\227\013\026`]/"
+	.ascii	"\204\257\301x?F\212\315\240\311\f\3305q\024\013\202\207\310\305"
+	.ascii	"]\211\331d\rA\355\001"
+	.text
+	.section	.gnu.lto_blackboxFileDroppedBytes.42.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"\322\31525Po\322\001\340DS\212\003\352\222`g\007\021\\\307G\177V\241\022\241\2605\324\332\201\020@\230\234\227\206\244gf\321\f\202"
+	.string	"o\022\334F\346@\fK\366\2262\245\2668\237\020\210a\241\342\3624X\235\220\007>\200:\016\320\302\" \247\300\027\304\007\203\022\327\205\301*\356\335\252\311\272)\351\205\355\211\237d"
+	.string	"\273\213\340\233<R\370\037\177\266\020\345\265?_D\375\245\006\224\224\362dGR\352\206}\267j\262\235N\025\220qQ`\331\3158\315l\313[\001\261=\262+_\344##g.zlTJ\b\006J\314n\204\233\023P\177\356\003\324\237v<{f\376I\356`T^\264\215\364\324$\354\256S\3334n\275m\003\333\007\2669\002\t"
+	.ascii	"`\325\023Xh\225\305((\004\350\032~\0331\262\020y\270+\246v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_blackboxFileInit.part.0.66.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"m\013"
+	.string	"\306UP@\020O5\035"
+	.string	"Q\204"
+	.string	"\026"
+	.string	"PT\200\275N\rA\005M\354f\031k\035\340\360<\347\277\210\031\202\245Jf\300\241\2145\215\210\376\013\300\006\352\260\227\375\361\361r\350\202"
+	.string	"\270#\317\262\266\335\344N)<"
+	.string	"9"
+	.string	"="
+	.string	"\256XD\034l\273b\0319|k\304x\026\307i\305\214Z[\332\351\212x\370\235W\350O\021E\372\276<\201\022*`\304h\201J}J~i\\j\255\206t\270\351m'\260\235\261\217\005\031\374\r_\b\315\213\247~\350q\372}\371\t\342\203\212,=\224f\307\\\226\367\372Uwe{z\356\364\351d\004@\326:vpT\025}A\302~)\2621{dc\2477\021+\277\274d\372\341c\356\206\365\245\264\032\274\273,\333\002\\\244F\222E\335\020\216\314o\201\007x\034\370O<\305\3472\310\215ZM\027=\210\t\301\344\324\266"
+	.string	"\232\027\235\235\226d\037\305[\001\216p6\356\223"
+	.string	"f\037\007v_(\003\277\r\004e\036\230q8O\267u\262\314\003\007\030\006\013\0244\300@0\340\r\205\363t\235\b\030<\315\204\315\346\321h\024\272\355\243m>\220F\031`\257\002\367i\240\347}\032\366\253n\020"
+	.string	"`\251\327\023\303\007E\305|\210\342\300\214\b\210\202a\256p\307!0\020"
+	.ascii	"g\2005GPgxIMQ\363\376k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\276\0045\023"
+	.string	"F\036rI\3200'\035h(\016"
+	.string	"#dl\251Ww\311\027\350\230\356\323\353N\003( \200\036\311\326\357_*HDo\205\027\\\341\255\207Q\352\203\243\277\007\361CI\017%=@\242@\252+\273\225\341\024m\215\212o\032#{o\262R\006`"
+	.string	"_"
+	.string	"]"
+	.ascii	"\263\231Fa\231f\020\323\013`Z\301K'pi\004-M\302\322\240\216\225"
+	.ascii	"\266\255\302\212\244\322"
+	.string	"5Z\rC\361H\326ZkJo\n\235P\311\210\237|\210l=\362\\.\227C\351\331\212D\r\237\223\026\241\231\224\314\357\262XY!swi\r\303z\264\333\273/|8f\250\312FI\323V\273;\221\002\005~\320\300\357\022\245^{o\204\355;\\l\337\215\274T\036N0\311\366\024\307<\025#)\307\307\376\366\3559\364\242\330\320\r4\264I\206N\301\320*\271\013\275b\241a*t\f\205\226\231\3203\022\232\346\3265\021\332\006B\257\322\203\276q\32088}r\323,6\335R\323.4\375\302\265\326\335o\215\374\236\246\026#\016\310{8\230\2747\306\344\207\t\0252\371N\f\221\2478\021y\032\304\357\231\261C\306\345\251\b\223{\003HGDL>\207WP<\037J\310\344A\376L\276%\340\367\306\001\177'2\b\213\237(\002?\035y\231\222\\\024-1\003Q\201\210\002\371Y\344\257\200\342\371\t\353\n"
+	.string	"\340\340\327zk|y\357(\216\304\373\274\363\022\213u\026\237^\036\007=\316A\\\013!4E\273\347\300"
+	.string	"\273\337l\364\256\221y\250J\252\2116\337\022yf\247\b\307kR\241(\032#\363\336\370\315\331\216Q\207\332<]\372\346\251\370\232\347 f\"'\"'9\177\373\346k;\003S\250Q\fE\245\322\210PT\320\302f\r\340\002\251\022\351\021\300\230V\310\220@$\032\231@,z\3265\273(\313Y\215K\001\265\2006z,\206r\376HX\177\343\234\302 \027h\0372=\006-T\3357td\336\326\330&"
+	.ascii	":\20738$;\f\206\f\027<\337\236z\246\347\247\023\251\001\372\366"
+	.ascii	"2l%\344\2206F-r\220Gx\264\\=j>3\313\003g\362Z\223<\211Yp\312"
+	.ascii	"\300\327\336\240X\257\027e\005\266\226\245P\004\016\350B`\340"
+	.ascii	"\247\272f\332\335r\274\201\306,]\005"
+	.text
+	.section	.gnu.lto_.refs.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375 \337\r\004"
+	.string	"\302\310\025\033\240\245\031\016\377\377\377\377\377\377\377\377 \036\021b\326\332H\333\335v[\333[\246\024\372\036k\0023.\\sYd=\236J\205\034\210y\226\326\b\323\240\343sX\345\231\274\306\272NO \\\236\312\233<\007S\343-\236k\236$\300S\360D\246\352\211\326=_\221\032\020\020"
+	.string	"3\007\203\200-\304\202\n\2614H\023\347Y\260"
+	.ascii	"\232nAR\2631\3162^\304\352\300\344\200\031|\025\316\031\314'"
+	.text
+	.section	.gnu.lto_.decls.90cb62fde0fc568b,"e",@progbits
+	.string	"(\265/\375`\\=\215\004\001\252\226\341YT \316\2346\215\001\225\222G\215\332\244\327\303\257\267\243[A\231\221\3104v}\033\fe\234\267l\362|<q\237\230\032e\020L\230\332=\322\315\375\346\200Q\034\220\222\313]L'7\272\n%\325~|/\222;\301b\366\t\263O8\030\214\231\314l\262\245\224R\246\356\004\234\005\245\005g\367+\305ya\357\246>\253\033\206w\243\367\213"
+	.string	"5\317\016\300H2\275&.\336\275q\331\254\264ho\240\016\270\240\364\260\0045\336\324\340\033\005\362/\333\177\237\367D\312\016\247\270\236\233\357Z\313/\216\263\230\244\315%\251\272\231E;W\224\250\216\301\365\231\310\372,]\237\335\326\225\261\365Y\306\372\334b}6ZC\310=\353\363^\037\235\256_\326l\003Y+\206\334\255g\343\332Zin\254`\267u\265L\304j\212\200t\254\3078\326\343\263\365\322\350z\274\265Z\275\356i\310\315\315\307V\353q\323\372i\321z\361\211u\345F}\251`SsxsK\313/\324Y\254\030\341\214\270\3035\203\305\340t\233\254[\f\035Q7\237\3572}"
+	.ascii	"(dCCcF\326_\276\325n\313\242^\026\027"
+	.string	"\311\246\235\356&]UK\353\262\301[g\260\351\324_\272\325H\345\210\335\217\250\321UA\304\233\336\310a[\177\315V{\207\256\020\316\341\031\002r\205n\212\024\034Hp9\270\326_\252\365\277A7.\230\250!\345\345@W\013E\261^\236\0247\023hs7\377\356\254\2777\253\265:\\-\324bP5\210^\034B!\205FWq\035>XB\253\303\316\371\250LG_C|Z\bm\021+\230\342\214n'\221i\247\307\210`\030\241\235a\317p\324\252\204\261\250/7\233\303J\213\242;\210x\307\302\306\361Y\"fc=m<\254\0173&\243\351\336\373\366\356\207\325\3033~\3265&\025S<Kh\373,\221\024\233\350\006\"\216\361\364\030\021\201\320\242Y\266\0208?\333f\354\352\203\232\272\0360\301\275\243\377/\215-\274\316{c\017\255\341\265\271\333&\27156\315\022\376\026\211\035|\206\350\007\031.\217\"\233\235"
+	.ascii	"d\273mV\366\231\025\374-\236\235\332@\"Q\341O\320\315\326\210"
+	.ascii	"\005\264i\005\260GP\f\271\f\t\313\326\037\332\002\250\326\257"
+	.ascii	"\345\366O\245H\213\261\275\233U\016\017\355\214\325\356}\373"
+	.ascii	"\265\336ji\260{%y\177,\316"
+	.string	"\250\326[%+\304\346\030k\343Ym\236\005b\323l\220g\032\320(\n\246\031\252\303q\363\255\006UE\203zkb]\331[jg\2456\355p\266\307m\235\215{\211Mt\223\331\2508g\324\315\237\301\252\002\321\036N\375\314\232-\213j\347\256\335a\351n\347\254\334\211M\324\316\345\275i\254E@\212\265\b\320p/h\306\324|\345z\343\332\201\305\240\3327\273\202M\373\234\205{T\305\004L?r7\377\204\3653\260\237S/\202ue\377\260Y\034\272\255I\007\357\3465b\\\224E\222\233\357\2015\315\336\330\031T\246\244;HX\r\260\264?\034\303\372\225\365\366\354\267b6j\315V\260\267\315\336{\003\\\b$\217\351f[\303\226\335\232Y\262w\370p\354\244\261\277\366\336\326\314\003to\032k\246R\2707\215\212\265\b\260\026\001\271\213\251\312\206\232o\262Z\032-\267c,\352OQt\253\240\350h1\275\371"
+	.string	"w\275\333bP;\260,\352\312\206Z\026\325~i\300\317\035\350>\333;z\001\005I^\315\326\315\217Z\f\352jYn`\f\230\374X\310N\254\316kN\353P.F\\\025\376\361\005\376;\201\303B/\001\374\330\005\333\205\037+y\260\362c\025\330\356\312\341\021~\233Y~\214\342\277b\277\225"
+	.string	"\016\361\333\027\300\340\326\270\021\370\257\021\006Q\003\177\370\017\304\203\005\303\"tx\313\217Y\360\333!\270\005\207\360[\035\f\230\203\001~\274\001\203\200!\340\301\217\037\260\341\3071\370\361\007?\326\200=\370oH\370_\350\217\033\200\027\360\343\003`\003\340\002\374\226\006&\300o\017\177<"
+	.string	",\200\2531\007?\316\2007\370o\026\016\200\235"
+	.string	"\306p\236\377z\300\032\374\267\002\230\345\277\035\300"
+	.ascii	"\370\357\t~|\001\257\374v\005X\345\307%\377-\3741\361\277(\374"
+	.ascii	"8\005\243\374O\301o\373P\360\343\223\037\233\374\367\310\177"
+	.ascii	"C`\300\217M\374w\357\277\322\377\256\375w\305\177\313\376\033"
+	.ascii	"\375\257\326\177\251\376\253\364_\346\177a\376k\374\357\t\377"
+	.ascii	"5\341\277\026\370\357\207\377\036\340\277\001\370/\312\177\325"
+	.ascii	"\337\356\375\326\356\267u\277\235\373\255\334o\343~\313\366["
+	.ascii	"\265\337\242\375\326\306o\313~;\366\333\350o\303\376\367\370"
+	.ascii	"_\202\377\203\377\217\374\366\376\017"
+	.string	"\374\255\327o\271~\273\365[\030\377\341~{\363[\345\377$\377\205\374\266\371\333\026\374\207\371m\323o\227~\213\364\333\243\337\026\375\026\305o\177~\273\363\277\360\267(\277\265\377\315~\253\363[\234\377\207\277\335\377\367\376\357\370\255\f~\033\203\337\262\340?\t~+\363[\375\377\353\277\b\376\317\375W9<<<\374U\274\2378\203\237\203\220\3527$\201RCq3\366\303\177W\252$xs\363\217I[\025\216!E\2564U\0254\355\263\020\304\310D\340\024\367y\245x\232*i#\224!\224\263\276\307\361\217\036xO\r\334\273&\204hM\220\375,\322\220\342\267\"\355\306\220\343\275\363\365\330H\215\335\214\201`\275\031?h>\364\260\020\214\225\007\210\203\203@\007`\001\211\350\206\205\233\025\347i \022\263\301t\270,\324\346Uw3\276;\306\373KJ\334\220\234\226\222\370\370K\2106\362VX\t\256/\001bg\207\303"
+	.string	"\200\3265\247\005\004\267VW\207\307\256\025\261,\352\305T\365\312\001\013\22417\207\313\204@\365\030\331\322<\276\376\304\222\344\344p\231\215Z\321cD\320BT\020\037\0317\277\204g\215\213\303a+\273F\b\217\225\346\3221\n\fts\303p\252\031\221\036#\202\031\005\330\325\324\n\307pDP\364x\370\f\336\214\337\360W^\240\232\036\021\225\207O\341\340\217\2655\314fC\310\212\335\203\343\230\355\252\275%i\331\271\223\234\2407$7\265\253\341\262]\2641\220\243\036#[V\254o\247\007\330z\206m\234\3412uo\033\205\372\374\240\241\341\262\325i\235\n\2134\\@*!\232\251\365k\212\0325p\031\261F\256l\256\344*\006\323\316\315_\2374h\340\261\232\2511\037\352M\030\024W`4\rG\357\024?\2414J!\340\212\016\203\004\367\326\361"
+	.string	"\013r*P\030\356X\301\300p\230\005\246\303\037\r\377\001\217\303,\326\323\222V\261}a/0#8\242_>>.\240][\033PJ\312\207\205e\034g\035g\341\2555\272}\2105\246\212\2544\340\255\0239\331\004P\321\246\246\250n>\340\211\374/1\211\223b\342q\363\211`\353\177\177u\323\374\354\275\203tt\377\324\234\250V[\253\341G\261\330&\340\177\376\r\220\302\336\316#S#k\f\0344+\336\301\276\226\356m\263\344\304\300\022\220\315\022\321\223li;m\250\234\027~\366\222\363I\266\367\205mc\343\324"
+	.ascii	"t_x\222m\240}\343\003\310\356\350\222s\333@\367\205m\263i:x\332"
+	.ascii	",\001=\311h\200.<\311\226\2006\331\322^\33164?'l\366\317\205"
+	.ascii	"M\266Td\223A\201V\236dP\240'\331\022\222\375z\022\032\001\001"
+	.ascii	"N\231\206X\347\323f\367\360\034\321\374\254H"
+	.ascii	"\237Q\350\016\262\267=\303\331?\t\330\373\b\372\023\204\206\310"
+	.ascii	"\262\325H{j\324h\2406\312S\303\004\3356\322'\026to\254\232\022"
+	.ascii	"\233\307\2033*\335QV\352l:\332;8{\013`G\367\346\331\333i\267"
+	.ascii	"t\357\355\334{\023\177\216\242{\033\255<\255xx\366.\312\300\263"
+	.ascii	"\217\234m8{\3373=6\240'\031\023\264\245\255\214\314j\233\210"
+	.ascii	":\255\325\016\262\364\263\2229g\354\235\277\325\n\b\205\337\017"
+	.ascii	"\322\235\t:\030\370\252\204\020i\t\355\346(\007D#\3177\023\270"
+	.ascii	"\nCa\027VZ\224\255\006\251\260\225M\303Ux\nW\341\027\247#\372"
+	.ascii	"l\005\032q\360\201\205\312I\241\247\346\253u\353\3255)\374\204"
+	.ascii	"[\354\036O\265\233qT\313\261\224JF\365\344\2729\002\252\331\212"
+	.ascii	"CX\026\0257\235\200%\375t\335|5l=f\302K\322\254\254\274\233\355"
+	.ascii	"\323bP/\224\265\034C\327\246^>7\037'\3758\350>e'$\275\244\233"
+	.ascii	"\357T\3131\022f\313\201Sx\3631\213\037\257\300G'7\002\255\252"
+	.ascii	"n\276V\026\203\332\200\234\226c\243[GE\2234\204\211p\321\t\037"
+	.ascii	"\202)n\266R"
+	.string	"\213A%\200eQ\261P\313\361\020QJ\t\314\305\315\003\300)\310J\326\240\244\2467\343\240\226c\024\024p\321\324u3\306@?\366\301?'ku5\236n\326`1\250\272\256\345\270'7\035\361\201q\363\327\212\262\245\275\233\217w~\234\203uff\204\035\336|\241,\006\225\001\317\226\343\023\026\2369\317\251\233\027`YT\214\003\005\205Jo>\306\371\261\r\2761\341\211\"z\273\371\262Y\f\352\007\226E\3054-\3075g\3219P4\263\233\035`Y\266M\303\333\022v \272\235.R??\017\270zuh\347\210^9\230\316\f\013\357\033OV\327\221+\270\005Ex\223\330\264[x\221\374\226\335A\265[x\377.\240\211\223\216\276\035\202\031>\260?}*\344\324l\267\336\013T{\242t\236w\3535\235\221\023\260\034@mc\275\246\341w\272\034'c\206\263\310\264\306Ict\247}D\322\302\0307\257e\260"
+	.string	"\344c\232\343\346\213\200\342\016\3650}MM\344\034.\305fe\3330\235\265\3308\\J\311\336KC\254b\024y\345PU\335\253;#\021\306\b\211\212\356\212;/\261\032H\250.\336\205q8+=\333\300\235\212\266K\344\352\270\322[w\371.\220\273\343\322\335\025\356\334\365q\205\334\037w\310\265\273qW\357\302\335\036\327\355\362\270A\356\335\315\2739\356\333\225\273{6\355\342Y\265\337\264\253&F68\235\272R\027\357\276\360"
+	.ascii	"G\331\326\2341\026ab\367\353\251\343s\"aX2zf\320(\374\001\272"
+	.ascii	"A5`JK\327\311J\213V\266\315X\224\225\224\213\ffwHDG\027j\202"
+	.ascii	"\211k\332\202\306\247\263s{\306\304\246XY\227Kglgj&h\265w\264"
+	.ascii	"\013\354~\205\300\371)\301a:1\275O\027\357\266\270Q8jE,\253I"
+	.ascii	"*\013IT3x`\303%\232\024;n\326u @\321DM\335\254\345\364\\\n\341"
+	.ascii	"4(m\207U\301\312zQ\267#\207\031\222\251\0327\353\025\264\216"
+	.ascii	"$\177'\360N\314\364\b\363\342t\016\263\244$\177\034\250*\246"
+	.ascii	"\224\326\340\360\024\007%g5\324|\334\254\337p\327\006S\206fn"
+	.ascii	"xyL6|1\366\334\302\364\364\231^\3137%3\246@`\350\033\327k\237"
+	.ascii	"3\321\013\233R{\037\212\237\013<\272\233u\332\347\326?\273\025"
+	.string	"\2367k\033\2373\331Q\345\242\020\3554oN7\0239\237*\347\254\221!G\343\232\214\206.;\341y\030\264u\342\302P\007\247\306u\231\r\3042\"\245\307\334\270~.\035%R1dp+\006J\317\035b\327\321\277\252f\250\307\315\372K\2071=\341\030\3510\r\246\324bpEt\365\372sa\250\275~\304&\320\205\366\322]\034\b\r\221q\263\356\272Hl$\251\021\305\320V\3270\264\225\326\262mrz0\266,\nB?8\254k\255\353,B\035\025f2b\340)\327\340\2133\354\364\302.\313\354f}\205R\243\231\256\2334\223\246\312=\266E\f\3520H\025\374\313*kqMu\375\"\333h\243\223\272YOa@l\270\327\342\355\306\005\036tsV-\335\254\245\260\340R\332]\212\233u\324\206\313M\351\240\203\002\201\224]\332\315Y?\335\257\030W&jn\326N\267\207(\225\026\0019\031\\\001\257\221"
+	.string	"\265\022\020\324a\220`\256\303\333\013\202^+Y\266\274\0375N7\353$\\$\333\260\333\341W\344NY;\250n\316\201\232E\276\353\201\352aws\026\324GWl\254p\007\222k\025H\364\n\fl'\215\355\243\002\250\303\240-\025\240\035;:mt\275\342W\245\205\203-\330\016\345)\344q\263\026\322E\331i\214\315O\354f=\244\211R\006\271\204\310\206"
+	.ascii	"\351\024QQ7\016o\326A"
+	.string	"\032E\n\022\364\205\r\037<\372\347\2450o\354f\335\243}\356\2147\030Gr\234\320;'\201bE\320n\3269Z\247D\214f\332\205c\3257\372\251\202\227\305\266w\263\306\321&,\3504\341\3402[5\215\266\221\303\252\301\271Y\327d\300\017I\272\361\274\331P;m\222\270\271\251\233\363\241\336\366\314\312\004\032\330\232\223<\267\220z\336A\013\263S\035\336\315\2769\017fB\265E\332\2216\031\353\t\325zDP0\377e\0236\332\302uv\030\244ccO\210\357\371\357\331\257\016\352g\357\346<\315E\3266 ]k\271\017\017\202\031\245\335\334\214\223`\301&B\035J7\177U\001\341q3\323s\020\246\274g\237\333\303\233\\\030\f\223\037\207VBY\310\363\336\363\220\016\037\362\325\322\333\024\220\336\217\f\344\310FS\220\233s^\316\032\201\013.\036x\317-\306\322h\210\356\262\270v\022%\271g:\271\334\003\373U"
+	.ascii	"\356\206\021\027\264\356\271\307\263\264\007n\351\310\315\331"
+	.ascii	"\356\330\260\250\316m\312\003OU\264\bu\362n\316s;\214\322\236"
+	.ascii	"q\244\3458\f\270ng4\016I\f7A\024\032Cd\220\271=\307=\347`\001"
+	.ascii	"\225\343us\206;6\214\372+{\256\200\r\257\366\324\fo\316o\271"
+	.ascii	"\rO\217f\006C\305\315\231\rOO\303W\004\363`\272\253\2719\257"
+	.ascii	"\035\343\205\301\341\334\335\234o\034\373x\352\221\372P+25$u"
+	.ascii	"\363O\204\326\237\360D\237iD3\332\002\352T\210\321\t\312AU\351"
+	.ascii	"\225=\243=\237u\370p\272\022\350 \037\234Y\r\\\004G\315\220\320"
+	.ascii	"\315y,\223]\341\354\020D\t\342E\3503\243O\353\327\312a\031\240"
+	.ascii	"N?\n\310\241\341\031FH\360\266\236\303\236\273:|\310`)7TbF\300"
+	.ascii	"\276V\212\316\n\277\262\227\n#\220\210(\310\372\314%Uz\236R\312"
+	.ascii	"2\326\035B\233\2200\030\367\216HON\206\361,\343\031\313B\032"
+	.ascii	"\027\220\260\233\237c`\303\030NdZ7\003\346\253\251 \034\323U"
+	.ascii	"\266\332H-\230n\256:\001\272\251\372\253\261f\252\374B;a\205"
+	.ascii	"\365p\255\031*\273\310NG\205X:n\316QYJm\212\350\254*?=\267\250"
+	.ascii	"\033\244q\363\264>7e\247\355\314!e\261\346\245\314\224\302\003"
+	.ascii	"K\013\206\320z\020V\032C@@7\337d'\027=\033\345\242\234\244\n"
+	.ascii	"QaQ\203\007\212\214\364\234\244a\375\212\2026\335\234Wd\026\327"
+	.ascii	"\320\260\251-\263\310G\227\257\360\004`T\367\005\321\275\310"
+	.ascii	"*\n\263O\366\311C+)2\354\032\233\215\224\244\316"
+	.ascii	"\025\331\277\037{L)\236\207\236\205:|\270='+l|\274\031\242\325"
+	.ascii	"\001\202\335\234\2032\212\022?\032Pl\357\373TE\020KP\357\346"
+	.ascii	"\ft{\336\307\346ess\376\271=)D\316\250\216\360\237]\217 B\300"
+	.ascii	"\347\363\3163\363X\032\333\207\030%\227e(\270\237G\032N\362\272"
+	.ascii	"\320\256n\316<_\341\351\211#\347Y\247M\320\250Ln\315'\3162\315"
+	.ascii	"\263M\246\3118\031\240\316\"\022\220\343\212\341&H$\033|\006"
+	.ascii	"\346\233g\234\373\325v\243-,\327\034\373\b2Q\205}\230n\330\240"
+	.ascii	"\370~\276\274q\241\215\356\"\250\263H\213V\220\"\r):R\340\234"
+	.ascii	"\031y\336\307\207\035>\034\216\310\024\005+\274\031\023\342$"
+	.ascii	"\330\360/\321SG\2057\320\025\027\202\300bP\311\002\224\217\027"
+	.ascii	"2\220\340\301\277\004\345\314gMG\305\212\003\261\340\020\031"
+	.ascii	"\236a\320\212\001\361\021K\263\023Ev\363\265\207\013\020h\026"
+	.ascii	"\213De\022Y|\321:y\204q9.\213/k\361E-\276\250\305\231$\t\013"
+	.ascii	"He\323\230] \343\022s\214\331\340\3304\036\227.\305$\262\t\203"
+	.ascii	"\234\021Q,\256\034SP\306\034\227\032\310\034\2170Le\322\230,"
+	.ascii	"1\272\200\351\200%\362\005\205\030\235d\2561\307\230bJ\3141f"
+	.ascii	"\304zD\242\240T\272\230\250\036@\020=\200(\221\211i\022G\250"
+	.ascii	"#t\214\232<\302\034\2273"
+	.string	"2Y&\306%\271l2E a^\232L\030es\331d\252\352\022\371\322L\036\227\310\227\021\230\240\001\034c\\\"_\212E\223\227\021%\307$\022&\211T&W\027%\f\214\361\370\362\301\272D\276\020\227\310\227#S\t\343\262z(\276\030\2250*#\324\227\330\320d&\225.:\251D6\215\312\344ry,\026\003\260T.\227\307e\223\271\302\300\314$\223\312$\261i\214Y*G\250#\232I\344Rf\004\361\005\251L!\267@\271,\321T&\211#\214G\230\354\241x\\*\233\314\242\0132F\3314\026\213+\0328r \003\211$\022\205\245\362\004\246\t%\23030%\034\217\313\0220\234p\201\204\362\003/\311\r I\034I\320`%\204\r\315\245QfC\023\2314a\003\022\312\017$\2172J\223\0174\231G\022K#\314\312KlP\"_\232L\f\313\345\361\245\311TI$\221#H\"\215\313\227\222\022"
+	.string	"\340.\310\3451y$\261\336\003\b\020@\204P\201\370\020#\2040B\b\352C\214\320\3222\002\210\226\365 Z\360Kl\350\220$\201\2041\026\227\315\2461\245XT\233\305\342z\362\022\033&\340r\224a\256\315\3421\006\331,\026W\227#\263\230BSm\026I$\2250\314\"\f\214\321\205\351\002f\261x\301\345\310L\026Sh\022_bC\323ef\331dr`\036e\\\320\344\300l\"Ep\230I\222"
+	.string	"A\205\231$\022\006\004\017 \212 B\250\300\341\3702\003\343\222DrX2g8D\240\303\313\2219\223\234)\256\352\262)s\222\262l\312\274$\221\313\026\214\2309\0311#\302\004\345\3104\212(\312\314\240\340b\024\241\362\222<\026\217)\030\231'\314\345\021\205\2451\246\270&\221\306\022.EU\231$v`\2220\302\214(\022\233E\342\013\214\262h\222\214\231\201Q\272\024\2273.E\223\346\221y\204\021al\246PL\0311#\242\271T\226`\026K\232E\013(\270(a\212\272Y\364"
+	.string	"\242X\322<2G\214P\026\211&\315\024\\\216/J\227\342\212bl\032_\212\307\027d\013\212\026\232L$\f\312\210\031\021E\346qy<.G\024O\232\305\343\013\220L\365\303\213Q\246XT\217/\312\230\242\376\002\256\2249.94\225\312%\007\223f1\004\221D\022\271\314/\306c\211\f\20346\363\314\312<6]@\302\313QFF\271|99\026Ip\204A\226\300rl\032\233L\335,v\020\241\231D\022\227G\02113  \241\204)\201Q*I(\352\227csil\222"
+	.ascii	"\245Y\224)y1\036\227%\232j\336\300\007L(\241\030\002\023\212"
+	.ascii	"\353[Z2\320\201\t@\300\201\325eCQ\005\245\b\024\\\2140\"8$\221"
+	.ascii	"\306\030\016.K&\207\r\n\310Kc\t\227|\2141&\2170\310\021\353\214"
+	.ascii	"\265\255#\2478U\354jT\305oHi\305\315j\230v\303ZV6\204\334\254"
+	.ascii	"\202e\024*PVho_z\217\330\343E\370\344%-A1\205\346\326\245\306"
+	.ascii	"\270\243z\342\322Q)\350S\217-]6\025\004$\323\322+N\344\202\320"
+	.ascii	"pe\225\221\340\267\343$\303\352\335\265\023X6\260p\330\t$>\302"
+	.ascii	"\233\243j_a;s0\360\336\032\327\005\244\346j\347\204\006\215G"
+	.ascii	"\022\253\241\025\316\264\n\253,\221\025\215O\252C\225\224\353"
+	.ascii	"\310\234z^\330\300\273\272\235\232\2335(\322\352Q\245\256\272"
+	.ascii	"x\366\023\342|\372E\251(4\"\210\004\352OE\355\353h\252\005N\272"
+	.ascii	"Z3\232p\236\264\022~*K\2136]u\272~AwS't\263\272\2442\315\251"
+	.ascii	"\205\331\334,\375\242\202\272YU\272=*/j`\271\200b&\024\037Mn"
+	.ascii	"?\222\354\231M\223N\317\2204\225\t\364\355\211\210\005\036Sw"
+	.ascii	"\336\300\2160\013;Du\227\264\"\357\024,5\302-#\034!&\236\035"
+	.ascii	"-\002bX\244\210g\325\373K\253!\322Z)M&\216\214\335\034%\323\263"
+	.ascii	"a\007($\303^\361p\315H\221\303\210XV5\204\240@#~\005}\021\252"
+	.ascii	"A)\266\212\221\222S\216\n\224\343\240\205AZ\352O\356\261U6\037"
+	.ascii	"\2612\325\007\003\001)\243CS{\362\336FY\032TzRyt\022\0130\244"
+	.ascii	"iF\324\235u\372\266B\233S\255\351\342*S\237zP'\301B\233^)\365"
+	.ascii	"\251\r\013`\245E\024\310q6Us\324\023\252\t\025G\325\261i\352"
+	.ascii	"3{]\265Qo\312\324\247>\364\300J\24100\025S\237\352\276W-\242"
+	.ascii	"\216\344\020\334{[\037\027Z(N\362\205h\221eQU\032\3754\345\244"
+	.ascii	"\223\266"
+	.string	">\245\306\372\024\261\365)Y\353S\252\326\353$\277\026\324HT~\360\372\246n\326\204-\327\205g\311\311\2712r\263=L\201ZW\256\346\273\376\343\323GP~~6\240\003\274\242\304\350\004\357\324S\024\324\221k@\224.;\233>#E\256\375\236X\320\020a\261\352\351\263\032`\221\254\276\"\037\327x>\364\036\276;\331\316\264\024\235\276%' \327{\327C\222Oee7k=-D\007\321y'ry\334d\260\270Y\377x\037\212\332\f\250#}\227\002\304v\335\306\246\245\226\306\366aF\365\371\251\210\2119\331\321]K\257\355P\206\002\2053\250s\202\303\211`D\f2$!\023\221\322$I:\223\025@@HH(\234\f\244\353\016\023@\225\252C9\314\223\314)3$\"\201$\221\244\234\024$\035\243\017f\234\325\246\233wE\2448b\263\242\245\243\234\354\224\360Y\n\342\002/\233~\372\237\347~\33460"
+	.string	"\352\234\300M\2544\373\263\246"
+	.string	"<\277E\2036Ap\3057}\034ac\364@A\004\346.\301\266\246\016\373h\201)\234\373\322\016\331\257Hr\237\205$xl\372e8I\360x\001Y\033\003\007(\331\262C\n\374i\273,\325\274 b\3000\205\367E\312#<T[\034~\022f\243\260\204W\300\273\320T\217$\001/\373\r\314B1"
+	.ascii	"\b\304\341\005\221F\262\276!_\306\201s\376\312\007_\217<\316"
+	.ascii	",\233\241\247\007\230i\241\332\325\027\017\344\351\020S:\325"
+	.ascii	"\032^\234"
+	.string	"\316\225\372XQ\272\274\023\277\330#\207\330\2429:\f\355\303\350\036g{\334\306h*\345LQ\205i\370g\220jP;C_\326\307\337\006\234\330/)\357\271\260\331\256\310\275Y\034\271\214N\366\230P=\210)\321\273\231;HJ\004\222\237[\360|\206X\030+\237\364\005\235\352.n\025N%\327<\256\213\202F\206\271K1\2268R\032\357f\032\030\370\b\356s\370\361\333\367}\234O\306\325(\346\ni\302\333\231"
+	.ascii	"D(\026\367\362\357\023\337\357p\276\257P!0\210\036\263\220pZ"
+	.ascii	"\337u\fv\344\271\004\025\300=\277\231\346\243\026\314\346h\335"
+	.ascii	"\233-\321\223\264,E(m\365"
+	.string	"%\206n://i \372\372\006\267=\300\274E@\373\"(\333\325\314\275\335\3713\334\313\005\"\211I\362I\020\b+\025\270\374Y.\377\026\226\275\326\312?\232\347\227\313\371\353\342\206\207\375\017\377\262\n\2367N\245\321\210\376Y\177\311\245\351\212\006I]\270\314\346^\256\351\377{\356\226}{\232JC\363m|\247,\007\013^\227\372\001]\021\023\222\276)q\226\325\032\0047\344\335\354\201dAf\243)\tqz\343\376\331s\207\367\355\327G\324`\342b\243\2772'T\315\007\001\027I\t/{\375\205\315\242\002\177P\353\320\270\377\352KT\341m\377\307\\\237v\271Q0\264\350\222\342vI\323\221\320\320o\2021\256\233\277z|T\326*\217\364\271\261GV\030\003\216\204\234\270RS\331\341\335\255\321\210J\237\f\340\267\356gs\342\3626\240\200d\265[z^]\255BR\212u.;\227\016u\250\260II\201\266"
+	.string	"\275\007\322\n\307\270\322=G\335B\236c"
+	.string	"`\246\004\210\226o\360,\220\347\nu\t\353\317$T\002\346U\001\342\245\2400\024_\3420p\007\375\275\374\220\302M\225\273\220\207%\321\364\0057\327\034E<q\235P\214U|7\315\332?\264\210\tA\n\345\271\031\222\247\205\232\242$\324v/\367\236O\336\376\366\271\213\300>\302\332\226\313N\377F\013\356\265\235Xqi}Oi\2472\317f\241\245|\030\276\224\253\327\323$\335\033\352\241\006s\211\027M\322\207\322\215\021\027\213\364i1\265R\232\322\266\246O\313\261\253\")\225'"
+	.string	"\217a;cW\020\2577"
+	.string	"k\245\240\325\265\252\273^\005\025\312\376\360\252Ripy\237\023\333\312\267\177%\2769j\251b\270\346\310Hdg\206\302H\273/ts_\f\262\211\0221G"
+	.string	"=\323\232\267Co\024\325@\331~&\360dp\220N\276>B_\370\350\233\220\361\032\023\231\202\264\330Zz\326\25102\360\314\317$\344[~O\364,\301\277\375\305\310\f\316\222\313e\220\355 \033\260\310\210\026XgJ\323\031x\201\373(\250\254\354\277V29\343\020\206\353s\213m~\335\343\002"
+	.string	"\035\316,\304\253T\227\032Q\336]\333v\316\240\351\306\332HCE\204\003\347D\023\246\3609\353\310s\"\277\334R\236+\021\355\225\rB\226\375\023\r\027\375\f\023H\212pC\026\026\r\257\261\235r\t\210>\340\314E\266\203\316\226Wj\222\245.^C\356e/\302%Um@\254\267\375'\320b'\324\305~\021\2166\305\3672\033#\366\016\344oV?\304\303\001hM\300\220\3077h\334z\036k\te\021\272\332\301Lc+\312 \2315IM\351@(\370Y\026\226\341 c<+\322D\254bz"
+	.string	"\364\377\234O\n<\002\236c\316\211\216P\003\376+\310\254\373\317\241K\024\367\276,\242*C\n\333\324^\r$\364\r.\030l<z6!#\351\370\263\235]\225\247\225&`Uf\332\007c7k\200:\207r\246\033\303|\257\224\2365\322I\316\023I\303:"
+	.string	"\313\355\235\003\307\276\217!\304v\035kQ\026\242\263\265\220\311\225\213I\352\005y\034\002\347"
+	.string	"`\274mR'\227qC\346\036\213\357o\036\264\325`_\020\036Gg\t\224\210V\204\353\325\005=\343\236n\007+TW\t\373)i\032\227\360\226\333@Y\333\235b\312\211j+\264\0372\f\302\205!(pWp\241\020_\320s\2247\362\b\370XF\021*\262\310Y"
+	.string	"\331~\212G\240dtukn\307\247Htl^\363\353\203\331^\017\375"
+	.ascii	"a\f\204\220\313[\220\345c\205sb\2733c\331\205\345\360\207\331"
+	.ascii	"\334V\217\370\0229\205\030\253^\301d\232\"\246\353%\351\031s"
+	.ascii	"\"\316\027D\020\245+\324\275\211\024\362\325\270z\327\251\316"
+	.ascii	"5\224\266\361$\227\205\263\366Y\345\220\250\021\343[\243\370"
+	.ascii	"r6\205\216JC\004\026\242\367\b\255b\320\020\301S\344`\304\262"
+	.ascii	"\355\321\353\220\342t^[(\306\226Tp\347\324\306\217K\245\031\357"
+	.ascii	"`!\210\267-\341 \036J\213\3230\332\276\247\255\210K\377\207\372"
+	.ascii	"\371\271hv\035hEv\207<O\364\310g\276z\233\303\314\250\215\373"
+	.ascii	"\215\242%\265\330e\342\367\204t\222\343\023\340\352tjM~\263\203"
+	.ascii	"\233\3412J`X<\313\\|\016\252#\255\3302\244!\375\316\231>\235"
+	.ascii	"=\221\331\330\274\007?\314tv\350\362\265\322\f\226\002\304d\247"
+	.ascii	"\362vY\312\b\334f\243\024b\001\276\216\232\036Y% \360Q\016\316"
+	.ascii	"l\006\013\032\341\210\317\266\\B\307\215\362\362\313z\222\232"
+	.ascii	"dJ\343\004ib}2\207\361/\217u\232\201\377$\340AAd\306\002\241"
+	.ascii	"\210GD\330l\256\367\205E\273QG\024C\225\360h\334\276\3010>\004"
+	.ascii	"\330)%\313B\356U+\220\022\266\305\230'\r\023+-\303\027P\250\265"
+	.ascii	"\312\243\024 <\355>\272\344\t\017r\303\223\331\330\276\356\341"
+	.ascii	"\317-j|ji\347\003{s\370\202b(m\266\362\373ozB\367u0\342\320a"
+	.ascii	"SE\311\363\251\244\374#Z\242\312\241\005\323\205\247\304l\001"
+	.ascii	"\264\323\227v\211g\3538\204\331\234\367\271]\004I=\320\330\225"
+	.ascii	"\241\3566\277\177\301\267\324\036A\246\204\rOu\247\243\232\300"
+	.ascii	"\327Y\237\346\235\216-V\3472\241P\024s\236\223\036\257)&\242"
+	.ascii	"\331\312o\304l\265\263\305_\254\373\017\302\367\301\351\3172"
+	.ascii	"\271v\001\242\336\205\234%N9\323\222[\224Y\303\323\237N\200\271"
+	.ascii	"\3531\352\264\300\024\221o\235\303\027\017j\366\246\2149DN1\306"
+	.ascii	"\307\246J:\201g\232B\323N\225\323\341\232\244J\201\205v\036\357"
+	.ascii	"\361\336\321\246\364kC/H\004\007\022'[\365\021\177f\035\016\211"
+	.ascii	"=\275{\027\005\337i\006\013\356VL\342\216\327?\021B\321~P\372"
+	.ascii	"+\303z\212x\302\350\023\3125c\t\321\233\002KU\224\025B\237\201"
+	.ascii	"\016\325\341JuC\344\346\307\031\347\022z\036;\257\024\231\316"
+	.ascii	"\360\231\312FA\346\372\216p\316<Gj\370\353[\335=\216\367\005"
+	.ascii	"O_\214e\030\250\272;\307\242\334\2016\357\322\ny<\246\303p,\033"
+	.ascii	"\246}\203(\022hpw>\355\005\020\241O\264<E\005\016B/Y\340\353"
+	.ascii	"\177\201Jk\200eei\216\230\371:,\374\203N5\\\007\3428\200\241"
+	.ascii	"o\223\026\367\226N^\004\340~\001\276\332_39\0226`RQ\003\203y"
+	.ascii	"a{\352\020\204\367\204\n\274^\357\317\002\373\024\0303\252\241"
+	.ascii	",\bE\225\246\r)-\220\306\333]\002\207\263\365k\377f\325\334("
+	.ascii	"\202\351\302\2140\304\211\262H\252\024oB\266U\236\021i=^\325"
+	.ascii	"Jc\343.e1I\2324\257[\243\340\322\t\242G\274u\317`\245C8 \f\372"
+	.ascii	"+$\377\nN\355Ol\324\304\350K\025\037\327s7\276\232T\3542\364"
+	.ascii	"z\311\307\377(\231\360qO\260|"
+	.string	"\272\222\356\031\315\256\013\304\272\244\341\335\256\267\345TvJ\367\271\354\206GTF\376O\324}\f\355\013\314z\215}-8\206z\374+\275\201\310[\352\264&nwh/Q* \357\321\037\037\030\242^p\311wE\367\357o\245\333\235\177\320\352@D\363\375\0213\374\333\355\005\212\234\331\373\232\330\254f\363\261\356\316x{\262\326\360\371\2358\270\217)\037\263\226\352_\263s\007b\373\345z+\365}\021\227\377wjz\370q\356\340\267{_O\363\201q\363\033+\324;\330\307\231\267\006r\270\347\207\004\177\223\335\275\3027\203;\351\264\025y\340\bobyN\232\345m\343\370P\027O\215\276D\227\231\365y\373O\237Y\001\216\375\220pd\302\356\035Xdi\344\342\230S\016.\004,\"Y\001\376=\347\272u\303\306\036"
+	.ascii	"=;\266\005\352\033`^c\332\374\335\204-\234\013D\322QT_V7\351"
+	.ascii	"\034_\3517\b\367\326\034R\362\201(;v\307\256C\302_\356\371#\363"
+	.ascii	"\233\025\357\nO\271\007E\254`\373;\246\254\210\236\005d\242o"
+	.ascii	"\f\372!\372\372JK\350/\366\313\342\277\031\327\231?\242\366\314"
+	.ascii	"5\013\373upCX\345\330\016\bf\234o\034\203\177\264K\004\346\372"
+	.ascii	"`\272Q\177\361\230t]\017\244\261\320\025"
+	.text
+	.section	.gnu.lto_.symtab.90cb62fde0fc568b,"e",@progbits
+	.string	"blackboxFileInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"blackboxFileBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"blackboxFileEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"blackboxFileWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"blackboxFileBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"blackboxFileFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"blackboxFileIsWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"blackboxFileGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"blackboxFileDroppedBytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"closedir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"readdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"opendir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"mkdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"remove"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.90cb62fde0fc568b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,332 @@
+	.file	"blackbox_gyro_capture.c"
+	.section	.gnu.lto_.profile.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 \303\355\003"
+	.string	"\024\005\267"
+	.string	"\006"
+	.string	"\321\253\221\343\001\f\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n\002\214\223\343\365\005\002\003\321\211\300\200\002\004\265\317\347\317\f,\002\004\002\004\002\005\002\006"
+	.string	"\002\007\003\007\007\002\b\002\b\002\t\006\005\207\310\337\222\n\n\n\002\001\002"
+	.string	"\002\001"
+	.string	"\022"
+	.string	"B\003pB\261\334\334V\021 \340\253"
+	.ascii	"V\322nZx\231\323\2420'\224{\271\bl\273t\201s}\200\365\256\244"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 A}\001"
+	.string	"$\0025"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\001\003"
+	.string	"\003\004\003"
+	.string	"\001\001\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.string	"J\005\0046\002\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 \365}\004"
+	.string	"\342\207\032%\200K\322\001]\242\221&\275,\312x\334C\n\305\351n\2203V\204\221T\344\0214AO$\224\260!\215l\271S\377\255\226h\222\006\375k\310\210&I\260s\f'4\356[\350e\203\201\254n\261\036\352$\341\320 \3723\204\260\"\211(\246,\205\177\377\036TWm\350\275O\327\03703\223\341\037\350\335}\255\217\314\004\274s&\r"
+	.ascii	"~\3460\326\240\220\t\007\324\n\230\313;\212\244\2508\350IEf\f"
+	.ascii	"\257b\270\234\231\305\272\r`\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 ?\275\001"
+	.string	"\304\0023"
+	.string	"\005"
+	.string	"\002\001\001\017\177\002\r\177\002\013\002"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\004\003\001\001\001?\177\002\007\177\002\f\177\002\004\002\002\001\001\003\177\002\b"
+	.string	"\003"
+	.ascii	"@\204\234\no\003X"
+	.text
+	.section	.gnu.lto_.pureconst.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\003\204\004\004\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 \300}\003"
+	.string	"2E\017\031\260%\351\f\303\212\310\222Tt\030\206a"
+	.string	"\337\326ZBD\3016\322v\222)\2523\237\317|\300a\243\236U\234\204w\260S\2603\273\300$\231\324*\fE\204Ry\222\347\352\310sX\b\024"
+	.string	"\005\023r\204\200C\r\347\204%x\331\2113\373\264\372T\362RfO;\270\260\300MA\273K\222\262;\323"
+	.string	"\304\255\031\006\334\003\006\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.aea97f4713fb8c8e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureStart.16.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375`}\001\r\016"
+	.string	"6\332]D"
+	.string	"\2216\035H\235\212<\031\021X\375zi\"\356\033(\241\270\270\016`R\270&2Y\2360\002v\201U\315\002G\332lo\373\217\fJ\247\334\004\326\253\024\351\037\214b6\023T \374\304\027_\265\332\326\344N)G"
+	.string	"E"
+	.string	"M"
+	.string	"\025\256[~\264\017^\345\373\312\310\330\356\b\231\323n\350a\t\327-\005? oU7 o\371\263q$\350 \340F\311\205fw3-\361\357\361\363\317r\314tR\362\b`\302\356:\232N@\334z\333\013l[\260\237\n\226C^\274\311\223\267\"\f\210\002\242H1e\207%QI\330\257vw\255)\330\303\377\372\312/\253\350\250\321\0370*\275 \320\261\373!e\2635,\031(l\337~\213\3159\307\266F\333\301\203\357!\211u\027\305&*4\250\250\266\310c\220\234n\312\201i\324\263\274\300\216\322\r\351\246!\257\230\336\003\312$\246|\351\365-\257T\204\210)\335H\265;\2071z\021\001\254\021\361\227\333#w\321\202\001\230\342S\332\236\263\230\004L\354.\004\177\305]4\370'\036\242\2177)x@\035\207\205.|fG\244u\036\206"
+	.string	"\336>\270\316\023\201\264\rdv\034D@6\314\220\221M\313\020\222}:\232'\333\272P\366\321\300\023\304u\231h\316.\343\204\373j5\305\331\251f\206\244&\276v\231\230hc\346\234\264\267\317\340`<\002\035"
+	.string	"`\251'3\364"
+	.ascii	"\021\030\027\b\334\001\306\205*\007\303z\007\340\313\224\020"
+	.ascii	"\300\030`\266\005qS1e\346f\246V\004\260h*\004\f\214A\314\234"
+	.ascii	"\222\016V\221\f\030\013\272\214\272\327+\246\320n\201B\035\256"
+	.ascii	"\341\2050\311"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureStop.17.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"-\007"
+	.string	"\262\31525P\217\032\003\240\222\314\231#\213\213\303` Bf\023\316\271 m\364\037\200@\354EH\275\255`\224q\260\274\267\240\252*\006\205\304\314\0207.\006\020\262\267\224)\005\3156\236\031\002}\260\214#\347\b\201\363 ;\n\031\266\320\211\r\t\030C\314\246C\334h*?\236\031AR\316\230\351n\353\020eu\244XRL0\242\265\350\322\206,\"\n\340\376\027\324 \016\031\325\033\276\nAz\336|\325\244\213/\r\005w\361\261bz\253\266+=\230\321\332\372\377BT\013\tR*\025\201\222\277b\325\362\223\313\204\243\2553\325Z\024w\334=2!A\242\372\037\241\2065?\255\266\207\001\266S\311\017s\360\277o;Y\270\320m\007\332\032\264\305\b\b"
+	.ascii	"`\2517\023\232\364\201?\017\027\326e\374\313\270\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureIsActive.18.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"%\007"
+	.string	"r\r26Pm\222\016\244\004\252\312!\254fo\271\302\362\230%\224\310\352?\370\262a\377n\317c\261\325\300\305\001c\271\355\232\231Y\030Z\375\035\202QD\360\222\207m\215\020\231\002_\230M\346\351p\254+\203e\037\206\f\005\246q\270\254\007M\214h\260 \342\225ID\214\301\030g\223\305\016\206e\361\302e\251\204\247!\301\bV\374\236\216h\001\231\231pC*2q;Z\375\001\275n\255.\310\322\352A\001\221\321\353\236\023=\250\361\245\022\236\376\367\203\226\017\224\201\224LR\267\222'U\211\307\037\372\313\007\b\241\265r\034\244f\\X\220\250dr\021nT\353\323nAJ\231\230\272\255$\352\003X\310\314\337V\302\350\260\177\301\257\360\233\002\t"
+	.ascii	"`\325\023Xh\216\305((\004\350\032\376\0271\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_blackboxGyroCapturePush.19.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375`\225\n\3658"
+	.string	"\312b\270\025>@\246J:\331\345\267-?\227c\273l@\256\312#\371\303\017\327\343\370\322\207\006c\330\340s\302/\247\351"
+	.string	"\325\356/\350\316\350J`\330/\357\344f\030jPV-:\031\215\020B\210\334I\006E\001)\001T\001L\250\006I\252g\376\256\264P\177\366\003y\345\003\376\f\362hx\250W\360\303\034^\242{\257\203\237|B\375\t\001-\343\243\252x\321\376\360@X\277\217A\236\f\023\232\305\21367D\360\336\373\2007\250?\257\314[\346\203y\030\344\373\200\034\352\336)\204\004\357\365{\300\024\324\237\354\367)\364\247z)\364'\222\371\320\375\352\356\373(\325\314\030\336{\217]\245)].\227\313\"\367M\277\263i\"/\025\005U|rjbZ\227\210j\212\236F\263\247,\222\317\026\344RQrmV\016U\230\264\023\024b\213i\006*mu\177rR\232\020\260\364\222p\266\t\213J[\334\231\b\357a\216\216\"\271\266\270\257\275&O\256\r\312\227\314\001|\200Q^\230|b\""
+	.ascii	"\344"
+	.string	"\333s\275\344\233%\246sb\024\311\265\335]5+\204\331\263{a\322\315l2g\344\\/\351\304\246i\006\2716\267\243+\233\232y5x{\204-\315\2367\253\273\321,\026&\361L\b\367\336\257\271-\302vf\315\245<%oU\311\247\314\006\312;J\256\227\274bN\361\231+\364\300c\025&\357\254M3\334{\331\256\261\265\235\251\316|+\314\374\203\231\350\025=\241\315~\332\026\363l\007\265\335\3754\2753\273d\254\266\3755?\365\336 \251\035\232\331e3\033FD u\323\361/\200\312\225JS=\205\311\320w\214\277AhV\0223w\235\016\231z\357\215\300\227\3639^|\274\237\374E\303~\215\006\372\363\375\300[;#Q\224a\372\314\354\222\331\357\3146\035\363\027\0242C\310=\205\331Z\266@\341e\376\t\\\022V\313\307\367\375['\363k\035\316\371\300\333\234\263\256\346\214\265Z\276Z\262l\265d\331"
+	.string	"\321r\001\3252\201\325\362\200[\026\220Z\016\220Z\256Z-\003X-S\255\226\247V\313\306\325\262\324-G\245\226\241R\313\305\325\362\323j\331i\265\334\264Zf\272\3455\265\274\224Z&\242\226\325%\313)\3212\252Z>\333\262\231Z\356\324\262E-\377\302S\026%\334\034\224\006\344w\221,)\335=\247\033,\207\363\267\371\325\374hn2\273\341\023\362\252\306\357\262\245\210C\003\306\220\315\3370\257\254\343nX\313H#%\230{\357\240`\033&\274B\343\313\002C\325\301\274>\r\177\215\232\207\366\336\330"
+	.ascii	"\032\365\002\267TsrvM\345m\271\337\355\t\201\264\324tl\365\016"
+	.ascii	"(U\217\375\345\231jcSu\023\246e9\323\360\345\341T'\020\324\267"
+	.ascii	"\341\224:\250\223\214\355T\247\214\273\333\023bHl\272H\206c\364"
+	.ascii	"\3545R\367\336\304\250\037P\013Qs\020Ia\324G\317\261-t\225\243"
+	.ascii	"\247\226\352c"
+	.string	"\377\315M.~\022\361U\001\314r\346\310\204V\035\013\024\n\002I\265\226]\037Tou\324\373\274\330P\3056\r\251\0352\032\241.z\352\246F\312\270\276\264\351N\206\"\";\224\016\346\331k\344\324\314 ^h\004U\035\241\306\263\266\250\251\231\332\251\317Ji\3123\021\0274\"PSW\260\353c\022\377cbA\240{\321\"\360\375\324@\241\240\016\b\372\223\251\027\b\352[\352\255^\213\304^\312jb\337\311\023=|\267\275\344\023\264\351\352\\\3551\025/\344\243\366\007\237`\020\017_\237\325K\024\245\313i\354)L\034\324\024\272\007M98V\027yp\254\376\243\013r\353\322\310d\255c5\205>\334\033\2424e\332\314\214\004\363\300\025\306@\367^\256\257-B;\3556\243v(e[\270@\277\206\366\025Z\007a>\236\035/T<\276\017\364\347\331MX\344\255\003\\c\353+\f\254\354\210C,,L\314+"
+	.ascii	"\330\311\300zt\2312\276\306\276\312n\200\315Pgl\340\240A-\303"
+	.ascii	"\241C\314\353$\373\272\221#\254\213,e\257\255\2571\035e9\272"
+	.ascii	"\274^\210\215\371\240\361\242\207X\f\033^]7b\034q\200u\205\035"
+	.ascii	"\275\306\310\216[Z,\226\343k"
+	.string	"\354X&&6v\\\375\314\236\301\254\317\342H5\033\234H\237:\324k\022\305\303\274W\016\303\321\374\201\207JD\006\352P\0221PM\307\304\267'\256\356AF\007\317\322\352\254~\337\337\035[&\217\226G\305\254\346\352\013\236\001\333\235?@\200\3123\273\264OW\315\274\301\306u0Z\270\277\003j\354+\263\216RN\232\322\251\351x\275c\222\320\347\335\352\340\007\016\264\245b\336{o\323\201\226\320\337\022\327&Mi\345\266\302@\035\026\353\304\260\t\223%&\236\007\256P\255z\0354\024\311\215\201n[a\225g\331x\234y\206\366\222H\216\024h\003m:\"P\240\237\027e\317\026yq\201\213\031\251\305\256!\271T\370)\201@\237\360\307AC|n\232i@3#\273\330!#ZQ\241=\346\022V\r\311\207\001\371\305\246!\3034)\002d\210f\205 \305\240?\333\314\332\"3kfBA\b\024\b\006\264\202"
+	.ascii	"\275\325\002\252:@U\277-\356\214Z\200\321\250\201(\304\024d\206"
+	.ascii	"d$\020\021!I\222\306\200\002\221\2512v\021\240)D7\263 \312\306"
+	.ascii	"\030\257C\017\242\247 \246x\"m\332k\305\211\300\335Zv\203/M\326"
+	.ascii	"\330\031w\303\376\213\263\241\2135\221\203\037#\367Mc\016J\006"
+	.ascii	"\215\2160~\271s\373\021\222f\333\354\373}J\201\252\377\345\237"
+	.ascii	"\361\025\030\215\374\r\265\317\276\217C\004\374\230\333\260\347"
+	.ascii	"\220\212\377\\\303\314\002\026D"
+	.string	"\272\037\262\030\210\205qY\024r\037\272\207\220R'\202\275gD\326\016#\261\354-\272\023\rBZ(E\340?\3705\235u\036\005\251K\270\343\360n\317!\260Prh\262\227\"o\367\374\032H\007\277rVO\304\337\357$V\220\221\334 \021mIi\037\203j\272\t\276\234>\3170\306\206&\332\036\356\035y\320y\304\202;.L\317P\352\007Z\003O\003W\370\002O\2573\2346]\314\266\033\257\023F\013\212\025\3066\361\272r\337\200\265\363\235=*D\215\3230\035\002\311\242\264\274\240x\333\\^\223\232L\202\f\001\"z\277v\360\224C\206\3150a\247\335\332\033\343\311\030\375\336\376\346\006\365\0055\213\372U@\303\200v\252\342\004a\232\263\244\327\177$ \215[g\355\254eQi\253\264\035&\264\337\252{\273\272\272Z\361\f9}\354\037\251l$Ue\263\334\2466m\376\034\342\256\271_\202\211\301>\201\020\212"
+	.ascii	"\231\036\300\210\020\343\366\\Z<\326\211uA\245\216\251\335\215"
+	.ascii	"\234x4\351F\237AX\232\353\207 B:zb\0066\244\374 o\301\023b\327"
+	.ascii	")E\302\256\006"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureRead.20.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375`u\001\365\016"
+	.string	"\006\235fF\360\256*\035B\273\332\257\232J4\204\346\311\020{\224H\366\220E\021\276\326\353\325\251(6\026\273k'x\034\303X\252\363\006\264\222\320\204\332*B\363\372\274>\305@T\377\314qcfk\t\252\nk\017\331D\312\224\002S"
+	.string	"I"
+	.string	"U"
+	.ascii	"\033\"0\203\316\243\303\023\360\036;\037\340=\332vF\202\225Y"
+	.ascii	"\017e\257gXA\341%g7\374T\303Y\3574Y~\311;\355\220\273\331\300"
+	.ascii	"\300R\256]\006\f\354\304\007\326\352\002|P\341\341\264'\n\354"
+	.ascii	"$\023\200\306\356:]0\013w\274\355\007"
+	.string	"\266\033\330\257\t\256G_\304{\274\236\366\224\275P\250\264\314L2g\207%\251+\366\273\335]k\314\376\354\3578\0355\335iZ5\235\232\276\007\302\346\340\200l\273\257\234\213\255\2114\034l\257l\217\355L\373 \336\262\372\214\344\002vc8\231\r*\255\314\215\334D\t$\333\335\0056\307Kt\024\220=\222\030\361Q\312\024\273{\026\237\304{\374\334\320\200\216\362\256\252\036\227\0275\033\333\205\226\246\314T\300Q]q\352UT\2739I\234m\323E\274\244\032\330`\3605Tgw\025\370.\017\241\362Y\036\035\"\222\017$\217\223)\244\362<\302 \245B@N\241\321\006\230\222\300\2611\002\212J\243\220\207\350\373\350\b\231\276QJ\365a\0340x\"\245>\020\020L}\236p\337\255\306\354\335r\266\030\375Y\336iwp\303\331b\322gyQQlG\265\206\211\266\272NgP\037\231\273X\274\323\b\030ZL\b\031"
+	.string	"`\325\373#\364Y\026\236c\367\226\254\361\325\326\034A"
+	.ascii	"\202\233\004\031`w\013A\324\210 1\321 \020!\206A\303\002\320"
+	.ascii	"C\3068\013\300&\224\222\304\256\302\260]\003\322\305\204CU9E"
+	.ascii	"\227\332\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 \267}\003"
+	.string	"\262\305\025\"\220)\351s]\371\352OHD@\377y~h\273UUUUEW\003\374'\340\03301\b\"{\357\024\253e\330\266\350\240U\354\346\362\300\240\203m\237\221Yd2E\032\256a\231P\022Y@$\341T\016\016\337V\017\001\300\177\216J>\277\201\330i\333\224\202\373\217\004\007"
+	.ascii	"\006\013=\230\313p\331\223J\347)tf\347GDhU\006"
+	.text
+	.section	.gnu.lto_.refs.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375 s5\002"
+	.string	"B\006\016\024\220+\313\001\377\377?\003r\211a\375\302\250=\371\333\177'\031\205\334Y\345\230\034\3278\306-N\261\022\013q\207e\270\302\021V\262\316$\225\rNp\310\001\256\334\013T\217\003"
+	.string	"\231\325"
+	.ascii	"\316\b\350k>\001"
+	.text
+	.section	.gnu.lto_.decls.aea97f4713fb8c8e,"e",@progbits
+	.string	"(\265/\375`>\020\035R"
+	.ascii	"z\215\320\036R@T\036\r\0076E\270"
+	.string	"\212[<}\377\306\317\004\241;\006G\350X\213e\275r\245*\3149\225\031\017\262\032\035\245\245\210l&\344\233\331c!\257G\300\2576D\375\377?:\302x\345\366\314\237\367uM\034A\005J\246\\\320%\226\005\320\333\335\266\211\224)\231\001\333\001\345\001\277\216l\261\354\025\025/t\027\207\240\220*B\206-i\335=4\02444D\202\007c\030\257\235\363\353d\243l\021U|x\3502$\013\237\013f\303,\263\305\212\341\034\324\250@\341\363\273#\375\266@mkk\333\002\335/\272os\200\25600>q\273\2242\013\024\322%b\265,Sh\267|\303\026\353:\306\265\265\272\327\037\236\242\223\027\030>\317K\277B\350\317\n\241/!=\327\004\372\016\322\357\225\177\247\354\326Z\331e\267\261\273Q\340\232\260<\261\302\347V\331\256e\246\330\257/\327\202\375V\\{\3355H\224\224|\002U\220~\275N@V\3138"
+	.string	"\251\013\335kk\233\002].\335w\b\333W\226%9|\362N\ncO\240\350W\357\tt\241\350\276Z&\320\344\323\332?=Z\216\234\361I"
+	.string	"\247_\273\327\004\n\264&P\026{B\210\177\233\354\225\220\355\310\264\354\255\356\265D\017\0342JV|~\335\023h\272&\320\367\374L\374_\346\377\230\177Q\374K\302\177\262\364\377\031\020\376\305m\020\330\277#\330x\213\377A\377M\370\317\301\377\022\254\034\201\237\2070x?\233\360\357\355\337\035\376\367\374\027\375W'\003\240\237?\370\027\203\177#\370\267\201\177a\374\353\342\337\241\177\205\376\227\375[\300\277\002\374\373\363?\315\1779\377\262\370\277\345\277\b\377\323\376\035\340\377\006\377\256\370W\305\277"
+	.string	"\374[\342_\240\177{\376\345\371\227\304\377\253\377*\376s\371\217\256\255\255\255\375{\346g\264\237\207\203\304\245j2\251d\252E|\322L\335\275lR*\245\2175|\256=\256\302x\360\271\354mZi\2125\211\"\333\221\032\253R\254\341\214Yr\214\314\020\206\262\251\205\251\211\342S\310\032\364#\306\206\033\236vH\237\230\206er\020\376\301A\272t\034\204\235\030\b\221\310+\310U\332\320\220\355\312\027(1\350\311@~\236a\325\234\311_\324\324\220\306\347m2\244g\265\224gM\370\330+\302!Z\322\232R\340\200"
+	.string	"\2132\242\344\344\016\r?^\350b\346\231\334\343\314Z>\241\352n \0363h][o\322\237y\254\032\256I\226\251-\344\212\237\325\tY\204\317\237\231\330x[J\263C\013\237\227\021g\325\266\371\344@\017bgj\326\354\231\22736n\326\242\331\346\326\255\211\354\354\352\327\261\351b\266g>\306\265\225\016|Y`m\325|\210k\367\210\261\305\251*m\261\330\270h+\266\315-\n\256\306\3168\006\206\201e\340#\277\300J\274\203\227\226\311F\3563\221\213\013\026C\006\033\267\315\302\361!\256\003pq\252\262\352^\367H\027\254&"
+	.ascii	"\316?Y\316P\225\236\223\244\253\306+g\347|\325\366\b\036\343"
+	.ascii	"\252\235\335\305\335\002|v\013\270\205%)BA\317\363\221\364\034"
+	.ascii	"\225\256\233}\263\314\025\233\366\0302n#f\365U\317\034&s\216"
+	.ascii	"\340\363\f$\375\256@wmW\240gdz.\246_9\351\367M\372\346\236@\323"
+	.ascii	"\350\220a3d\313,\375\226I\277h\376]\367\311\236a\233\023S\fL"
+	.ascii	"\370,\013\"1\004l\214\330\225~\245P\331+\333Dr\006\341\345l\311"
+	.ascii	"6\313\212\371\350tK\215Qu\257F\254\231%\263e\226\271d\313\345"
+	.ascii	";\266]~\256\335\306\005\310\326\313\216\331&\022\r\256\276\234"
+	.ascii	"u\367\027+i\032\237\2610\037\302\330\311y=\211\034w\304\301\352"
+	.ascii	"\371Q\004\314\033,!\220;\300\240U\326;f`\226\374\270Z.)\021-"
+	.ascii	"H1=\364\300L\036\020S\303\331\317\230217X\235\231\370Xu\361\301"
+	.ascii	"\304'W1\020MT\216j\200\370\241M\026!:\bYy\216\200q\262\203O\037"
+	.ascii	"\370\007\243\241\231\"\205O^\3620\2372iP?\260\022E\003\263\362"
+	.ascii	"2\204\022%Le\301\024\022\205\203\326#I\265j:<,\231bR\242\203"
+	.ascii	"\016\234$\355\356\205r\344\301\212c\304\313\333\234\223\334\302"
+	.ascii	"T\355\300\305\347O 8|\231\214\003\023\3219\236r\312\316:\231"
+	.ascii	"L\340g\217\364<\305E"
+	.string	"\3166\374l\003#\331\247\266\235A\343T\225\326OOB$\322\230\005\001s\344\214\344f<\335W\335\255bGM\243Q\361\311FVl\213\240j6|\276\315\302\371\257s\233rs\206\351&=\377h\027\223\335\335t[;\251\304\363\275m\317\332\326\200\377g\333 @\353\306\252BK\2270\213B\316\242o\325M,\321k'\217ZR\304c\2240\312\022k\023A\321ZE\372\270J)\317es\257\275m\224R\252p\\\227\311\343\272$\002\265qI\354^\225@\307\255\"q\217ZR\312\243\326RY\242\215Ml\255\"\221\324\270T\036\307\226J\240\243VQy4J)K\bQ\245\004kG\231T\234U\036\215\315\003\tUL\0025\217\353\262\311\272wk\251\223\006tC-\223dE \373\245\324\344\241T\245\270\334\265\273S \225\246\226ml\036\253\226\335UJF\215d\200\2706\373\206m\022\213@5\323Rw"
+	.ascii	"\310n\342v\263\273\211\335\215KB\255\335A\200\216THd\367S\020"
+	.ascii	"\262\241\210`K\335\274e\346Ky\324\232Z\352\300\244hQ5\fk7z\341"
+	.ascii	"C\372\2519`"
+	.string	"\020\t)\330K\241\356x\352\221\217\002\022\"\344@\352\351\334\350\305\360\350\210\3273RyH\271\241\372;!\227\004\304\341BG\022\360w\344\202\001\242\035\321\f\0359_Q\322Q\017\370\313\t\207I\271\034\013A\241\221\032\004\342n\360|G\247:\004\006{\267\033*\360'<B\213x>\020\214\206I\036\240\220`xA\216 \n\\\bA\357\375\204>\240\017Gz\006\210\\\020\315\320\201\373\f\0320h\300@?\203\206NG\203H\227\236HgS\325\033\275\300\001\374\tw\271\24108\004\372\206\004\364\212x6\036\225\027<\272q{o\270;\341[\341\247\366x\350Q08\301\356V\344S\205<u\210Sw3p*0)XCgh\003\030\374\251<aR\321\316\320F\021\320w+\342\371\214Nu\027c\201\243\037O=\325\033)\360`\016\2370\247\006\203\302\034\211\244\024)\207\320w\016w!\324\b\n[\250@"
+	.string	"u\227\016m\370\220~*\252\036\375n"
+	.ascii	"m\354\250;\"\235\n\374\341\256\323\325`a\203\203\n\322\336\013"
+	.ascii	"\2370I\315\301\353\355v:\202'\244\320\343\035\235\220\003\376"
+	.ascii	"xH\271\236p\230{\221@\r\n$\b\n[\300\201\033\372\216r \361\206"
+	.ascii	"\270s\222\235$\177@\255\266\252)Vd\262pII\363j\342\263\253\213"
+	.ascii	"\261\350\020}\312\232fn\322\372i\006\241\237\231g,|\345\307\314"
+	.ascii	"\22101>\371\213\301\226\3710\266\362CD\233\250/f\252\003\367"
+	.ascii	"0\224\275V\314\026fN\2227+\266\013\303!-J\025\"{\224\242\004"
+	.ascii	"\r\237\317:oe1\327\266\331\265\237\226\3045\007Di1#\226\326G"
+	.ascii	"(!\034F\242\306\250\234\271>\206\256E\371\222:\323\007/&\\|\262"
+	.ascii	"\224\363\224_\007g\304\030.Y\310\224\265\316Q\204\370(\253:B"
+	.ascii	"\371ux\220\214yY\303\347o\305\364\347\021M\232\360\032\201:\250"
+	.ascii	"\2610f\024D#2\"\"\"I"
+	.string	"\222\244\003\021\005\304\030(\245e\036\022\2406-\r\225C##I\222Je?\016P\343TLq:P7\007\271\254AT\312\342\030i\304\033i\033\306\335g\027EC\203\006\362\004\360\370|0\255\030cNk\25595\207i|\005\215\367h\362\320\215@M\304\354\227^T\357Q\307\323D\fg\344\261V\232$\375KY\307Z\331\327x\t.\332w\357\231\302\336D\255\230\304|\fd\217\231\177\250\212\252T\331N\235q\344F\023\250:!\221E=o\026k\334\001\241\311$\255\036\177\311+\340-;\0272\245\205\036\013\265\242k\005\244\003\332\246D\250\377.V\016S\262nP\2071\310p\324+\210\336NY\214\t\243u\306^\rN\301W\007\005:B\241\334\027\336c\271\243\356%6\007\225\263\310\3523\206\031Ci\201\343C"
+	.string	"!D9\234}v\002>\f\fGJ\306Y\3554\302)\022\333Uu\216\243\223\n\356\250w9x\037\211\267\271\364\365$\367\366\352+\020\314x\333\377\350`\272LW\200p\371\217%\323\301\206\002[\342\346\336$\300\311\271\224`\0311J`\253K\350\233\320'\371\237\371\325\373\033\372\f\2176\225\262)\203\346Q'\001\274 s\347,\260\313M`\377\t"
+	.string	"C2\252\027@)\323\237\202!\037|\007\360Q\321\024SBk\344%K\223m\261\244n\f\242\037\027\212J\276\246N\326\240\356->R1\321\256\250\260\222\336\366\244'X\032\343\232\202\300-\326\272>\210\003\347P\005\355AE\374\203Lk\313\220\311aw\361~\201H\321:y\362S\210l\352\360#\207\357\351s\024#\230g\002!\346\202\362\243\347\217?\021\005"
+	.ascii	"\227\265\016\307\005\200*\263>L\235\nA\201y@\342\025}\007\210"
+	.ascii	"\006\206Nu\302+\265\344\342\240\036\324\343\332\006\030\254\023"
+	.ascii	"4\363OD%k\323\3641C\"k\367\322\227\211\343L8\234tJ[\007\366\253"
+	.ascii	"\335lA\345\303\310+SI\247\nC\227\0218\231a \355\023{\034ZC5\330"
+	.ascii	"\030\356\023\214\205\204\266\234\313>l\334\304^\206\031\336z"
+	.ascii	"$\334kI\304\234\363\355'2v\235\276\235c\351\031^&\f\236\266\377"
+	.ascii	"N\376\323\022\203A\352E\316\263\377\264\235X\217\361\331\033"
+	.ascii	"r\361\2347\244\333\250]\004akgaK\340>\233\267\362\253\303~\036"
+	.ascii	"\204]\343e\303\"\307\225T\001"
+	.text
+	.section	.gnu.lto_.symtab.aea97f4713fb8c8e,"e",@progbits
+	.string	"blackboxGyroCaptureStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"blackboxGyroCaptureStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"blackboxGyroCaptureIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"blackboxGyroCapturePush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"blackboxGyroCaptureRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aea97f4713fb8c8e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1939 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\270\0015\016"
+	.string	"\304\023\254\002"
+	.string	"."
+	.string	"\317\223\323\216\f\n\002"
+	.string	"\002\001\002\001\240\342\234\212\n\002\315\370\325\300\013*\002\003\004\002\005\002\006\002\006\004\002\007\002\b\t\003\005\352\263\360\321\b\b\t\n\013\215\376\367\232\001\002\f\370\304\234\270\t\002\r\317\202\320\324\003"
+	.string	"\016\375\206\225\206\002\017\247\370\245\273\r"
+	.string	"\020\376\201\211\336\n\n\002\n\021\022\341\257\315\352\007\006\013\023\311\231\247\372\017"
+	.string	"\024\322\243\272\342\n\006\025\377\354\264\213\017\006\002"
+	.string	"\002\002\001\026\027\030\231\265\261\252\f\004\002\f\031\337\366\250\251\017\b\002\r\002\r\032\331\240\352\231\n\006\004\002\f\033\367\231\321\345\006\016\002\016\034\252\206\310\265\002\004\035\250\363\247\375\t"
+	.string	"\036\213\365\313\367\002\037\257\226\212\310\013 \343\201\230\333\t"
+	.string	"!\264\332\347\364\n\032\n\002\n\002\004\002\017\002\003\002\020\002\021\002\017\004\002\004\004\005\004#%\213\222\251\206\003&\334\304\343\312\001'\324\277\346\355\013\004(\200\315\272\201)\223\327\330\340\013*\327\336\217-+\344\222\323\346,-\340\300\211\333\002\002.\300\315\215\302\017\004/0\324\321\243\201\004\f\004\002\0051\205\205\345\221\005"
+	.string	"2\352\326\271\264\013"
+	.string	""
+	.string	"= `\002b\246\256\033\031\242C\t0\022t\200f\206o'\262\317\372\266\220\301Z\t!GHl\326\3232M[\024\204\241\265\311\030W,\264r\254\300\231\214\233\b]\031\002ve}\257\001\226\262\245\220\363\376\002\221Q\t\3034\267\002\300\345M\034\211\267\322v\023\b\322\362\356\266\300\334\244\362l;\332\245\034\240o| \367\177\314@5\253]*\354\274%\327\370\355\306+\212{c\212\227\001\327zd\214\224\353<\304*\251"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"-\006"
+	.string	"\"\007\025\032@W\241\003\3030\f\3030\f\303M\221\221\204H\004\324?\264@\227\261eJ\001\226\244G\002\267D!\320gz:\234\315j2\030Ke);\231[\222\310>\310\276\307\226c\2771\343-T\261\211\235\026q\3305\024fI\270\336\272\201\002Ju\300\311y\361R3 @\002$a\321\003I\023\\[&1\370(\\N\212\r\017\001qE\f\020W\n\314\3300\247\303\020\341\252\220\307\235\bL\263\031L\346[\267\03196\034\036\216x\202\301\3503\003\"{AK\214\001L3M\\\243J`\017D\2121\336\037P\352\201w\352\336\200\255Z"
+	.ascii	"\257\361\002\276F\210\302\212\017\342\225\270\007\"\031\216\202"
+	.ascii	"\205\301\024w\b"
+	.text
+	.section	.gnu.lto_.inline.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\025\006\025\025"
+	.string	"FY`H\340\262(\215\001\320\355\370\001\374r\356\375`\204\373l]\302\320\210/\b\205U6\004\323|/\372\025\n,\3459M\242\202\021c\364`\337\370@\214\0318\303\f3L\273\210\210\310\314\030\327,\374g\330F\232m$\203l\271SB"
+	.string	"J"
+	.string	"Q"
+	.string	"\273\337\240\\\345\037\316A\355>\321[\314M\246[\361\2365U\264\\\254d\230(\223\005\3145\373\305*7y\315\237\324\351\252\322\335my\277\322\315\225\270\201\322\337\244R\312\345j\306\260\265vN\277\340O\024\250W\315\005\t\332)\355\350a#&\016`z\243\322H:\035.3L\200\237^\216\023'E\b\226\222\232K\013\235\324\246\021\215\346\305\006\\\034I\226\376\214\224\344R\303\307vWd\322\250\264\334\356\232\016\327\373\023\335\335U\375g\003@3\233\013\003\n\330\b\333\265\023\214\3004A\354.\311\007\246\367\242y\261\tm\340\223J\326\334\002\264\224\312\340j`\242\217\032\"zF&p''\207\231Z\020J\207t"
+	.string	"\322\">\340\227#\231\242<v]\250\224\211\303\325\220\020\027\260!\007w\002<\253t~\241\005\003#\244%\\\351M\317\213'\334\202\312d\361\371\361A\001\212\326xTfRW\030C\331\356\202SPu\023< \0349d\204\226\020 \026\001\202\317\214\206L\364\003\007\243\350!\346&#\335"
+	.string	"\306\315-'t\311\\\201\243\223\373f\360K\223\327'\n\200\206\250\221A)\021IQ\322\336\001p\002\021\2512\362\022\340\"\205\303(\021HC\004J\261h\202\t\022HKj\264\001\333\245.K\003\225\211\206\371\346!\213\214\353\256-\223\300Z\315\320/\037\037?#{\243\224\350\2649a\2058\016\037\360\272\332`\325H/\273#c\273\277w\244ca\220K<`\202\353\022\013&\231\346=Z|s\215\217;\027\004:\252\317\370R\\\001}o\315(,\376\220*\305\005\206\"?\273*C\022\016\355\220#\231)\247z\232\226\334\204}\277\321tM\357\t\202o\271i\342o\244\331B\344\237k\312\254\350r\224gw\b\362\340\346\003s\222iMX~m\314\202\307\325\217\200\226,\212w\n\216\260\177\214Z\264qd9s"
+	.ascii	"\257\266\365\034\007#\002\026\005\210\212\212\013\257>\242\215"
+	.ascii	"\337c\0356Y\027\276L\363\364\312\250\325\250\234\r&I[2\237\377"
+	.ascii	"\277\331\350\364\214r\201\364\234\013\255\0243 uj\365\257,0\212"
+	.ascii	"-\343wGiD\240N\377\376\225\024>\346\\b>\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\224\002=\013"
+	.string	"\226\0201/`M\222\0160\f\203-\301\fM\r\202 \310Xk&\023\007[ \354\021$\204\214\264\215\3405\306K1Z\033h4U\243\331\035mA\232\224)$"
+	.string	"&"
+	.string	"$"
+	.string	"O\rkC\252\037\377\351\3074M\023\300Zk\361\022{\310O\375Uu\246\352\360-\352MJ\n\331\035~@\002\344\030\311\261\362\216\032\364QO \365\nz\020Y\351\311a\375\2658\211UU\270\221z\017\031="
+	.ascii	"Q\372\023\201\003\002-5\254\026\354{tc:6\374\f\377\302\277\302"
+	.ascii	"d%\341G\370\324\007G=\f\346\313e\213\205\"d\b\217_\177\306\307"
+	.ascii	"J\030\377\322\305_\361S\374\033\315?\361I\374\231\210\037\342"
+	.ascii	"\177\030aU\231\261\231\261\262\001E\250\361L\003\rYI\222dZ\003"
+	.ascii	"`\002\231*\244\007\021\3200F\0243d#bT\231\266\003\311\207\r\t"
+	.ascii	",\304\"\203\017\315D\206\362\037\257O\271\004\207p6\n^\302\263"
+	.ascii	"`\220\337\306&\032\r\266\034\b\365\017\221I}e\215>\002M\261\323"
+	.ascii	"A`\005g\212N\320\242\003\363\177\361\007P+Z\\\335\b\344+\322"
+	.ascii	"\233\2267\205\337\360\201\210\264$\376\317\207\366\271\023\026"
+	.ascii	"\204[\004d[\3017\314\t4\326\237\212\221\335S\030I\220\322w$q"
+	.ascii	".\213_\241v\227_\363\235g\\\2102\203=p\256\r\201\030"
+	.text
+	.section	.gnu.lto_.pureconst.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375 n\325\002"
+	.string	"\342\206\025 \200k\032\0033@\026\037\254\024\233!\023\362r\307pl\233M\333\266\315\334\273i\250\211~\2230\031^*N\361\211K<\342\020\177\270\303\033\316\360\205+<a;\270\301\013N\360\201\013\304\004\034`&s\314/\267\274\262Q>\271\344\221C\376\270\343\215\037\342\356,\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\254\001m\b"
+	.string	"\262J '\200\325\225\00330\003\323##\204\f\314"
+	.string	"\342*\214"
+	.string	"\301v\337\367\333n\177ww\373\377\267\335\371\377\277k\327\254\224)\177\336\247\341x\317\357uK\231\307\\j\371+\224\311K\270mr\330eU\324\204<\006"
+	.ascii	"\327\321\337\260A\306\317\250<j\027?\247\245\025[\340\177\002"
+	.ascii	"\030Q+\327\332\004\342`\210\224\205\207J\350gV\236ub\345X\347"
+	.ascii	"UnuV\345U\005\337nr\352\224\332\251\362l\302\267\023K\250qY\225"
+	.ascii	"\322$\313\336\001\240\202\231\252\352\001\020PdB%i\345\253\357"
+	.ascii	"\303Q\036h\334X,\370\367\335B\247A\210\f\030f\361|&\311\250\364"
+	.ascii	"\343]\3456+cF\017\301\341X\230)\266\270\036\377\247#\2575\304"
+	.ascii	"t$e2bZ\227\227\264}|\265i\215\222\311\311\340V\350\254\375\336"
+	.ascii	"\314\332\3657\034\027|\203\313\004\205m\210\262\316\201\266\302"
+	.ascii	"\234\022ej\337\305\306\t\213'd\203\035`\177\310\f,\240\002\017"
+	.ascii	"(\312\342\372\001"
+	.text
+	.section	.gnu.lto_.lto.90fdaa5804a29bd7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.39.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\345\n"
+	.string	"\306\323KD \311(\035(\027\254K\201V\217\003\276\224\300\345^b\361m\330\005\322\374`\321`/\371\004>h\016\364G\303\016\367\\\203\332\250\222\323\375_\001@\366\020\b\001`d\272\021y\001\247U\253\3767B\366\336)\0056"
+	.string	"8"
+	.string	"7"
+	.string	"\t^\007(\354nG\001<|\2453\364/{G\034Y\257.\2475\242\346\200@\303\350\252\240\030\032\332e\237(ck\316\r\305\356z\212c\313\275\335\366\205m\f\3733\033\231\007\020\fvW.X\330rS \340\261\337\376e\366\370\005n |l\365=a\351\2105\332\204]R\342\233'8\337L\376\201\373\306\271\003\367\315\241-\341d\200\375,0\245k\216\020R\032P\n\363\212\253\364\2432`\026\3015+x\233\177\b\367\275\027p\366\b\311\274Xi\367z)M(\313&Y\223\302\354\327\335]\323\032\373\261\273r\001\252\317\323H\201\031%T\205E\311\364\2118\300\217I!\357\264!\342\215:H\"\217Q\207:\211>:\322\007v!\220\275\224\351\353T\236\367u\036r?S\226\320V\345\314Jm\020p^4\003\202\020"
+	.string	"8\263\002K=\231\001a\330`ay6\350\030\2265\332"
+	.ascii	"\020N6\016X\323e\364W\227\005l\021\227y\252&\247hj\017"
+	.text
+	.section	.gnu.lto_blackboxWrite.46.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\345\013"
+	.string	"\306UPC\020o\225\016\240`\255\217.\320\300\200\331/\204\r\370Y\305\235"
+	.string	"\356\372]\262\302J3\002\026{\331\020N\003\266oF\031\214\206TL"
+	.string	"\002T\034\220\341>$\253\tDR$\276\240k8\255-\331d\313\224\002<"
+	.string	":"
+	.string	";"
+	.string	"v\361\361\264_\265\250\300\222\261\273\235\364\360\357\233\324\317\277\352\224P\024}\303p\271\215\304P\310:D\322\346Q\002\021^u\265 \202\252\023\003\273k\r\305\013\367\274\355\003\266\007\330G\020\"2\214\264f\217\"\225\035\354o+9\330O\375\234\252U\325\247Ld+B^\354\226j3\0266S\204\260\375\212mU;\200\200\357\251\220\345\256)\325\332\035K\f@\343\323\237\003*HJ3'mO\270\211\020\310iw\013\370%\316\362\370\250O\177@ \356\223\300\007\r*I<\204A\362K\225\247`\002?\342\243_>\312\022\354\322\207\237\276]\334\347%\307\206Y\232\017\347\002a:c\3616\t\"x\030\005\231\013\007\3231\330\\\026t\231\216\247\263\210\330k\240\351t\017<\257\323U\306\375\f6\222\340FQ\333s\240\017\275q\"\006\f\224\242\237h\261\226\254\335/N\345G\211\305*\026"
+	.string	"`\251'3 \f\233-,\343\006\035\232e\211j"
+	.ascii	"\004D\026\253J\013\232\t\271\177\032\002\213)%\256*\356Gj=\027"
+	.ascii	"\362\226\214}*5N\334\271\251\332\231\242)("
+	.text
+	.section	.gnu.lto_blackboxWriteLE.47.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\b\002U\022"
+	.string	"\266\242zH\340\322&\035\220\311\260\362\003S\234\210\210\t\357U\363\206\026#G\003\030\254\262\275\227&S6\021\346\004\226\377\264m_\254.-Z"
+	.string	"\037\244\320\276\214\f#\03014\034\013\324\360\225&L\017\322\035Wf\332\023K\366\226;\245e"
+	.string	"b"
+	.string	"e"
+	.string	"\247\246\235\204;\355^\200;\365\313\016r\332\254\336\026v\2605\325Z\277%\361\222\257\2438:W\276\374\224\b;\252\3339\367\332g\212\037!\241\270s\n\342s\2260\035\021Q\211\034&\t\316\211\320\023k\344\316\022\036\0359*\321f\222,\215"
+	.string	"\362\332\345\215(\223\022\245Rk\265\f\305\017ww\3333\266!\3302B&\274=\366\203~\357B\177\352\266\233\223\322s\245WJ_@*\307\022\203\036\265\342\334\236\252\022\275\201\342\266\333\207\341\017\331<v0\017\035\221\355\207\251\326jr\352\007\335\351=\333\222\366\027\257\013y\364H\255\"\222\214j\255'v\320\235&\230\227\366Y\274\305\353A\033N\240\326\036\027F\265\322N\334\240\013\373\235{\235\037\"\033\036\231\274\331[\377\210\246\345/\334)"
+	.string	"\037\267\221\301\300,\264\255\3415\300\005\263Zk\312\214\323\260\340\003\235Z\306\345\342Nw%\314n\241\016\002X\322\212]\037\277\351\036\271\357JmG\215t\262\037\343E\036} c0\222|h$\356\364\373\332\277\330P\221\0201y\263i2\271>c\2111\255\317\300\270@\026eq\271\254.P\263P\300\326\004\032p\245\205\265rY\371`Z\253\227\217\025#\363\241(0X\201%\346\233\001\301\230\317\243\305\276=V\211\255\f\265>\376\320\273\246\221G\232\234\333\033{\200L\255\267\366\212E\027\366\224\231\023\023G\003H\233BK>\264J\206\n%\331\302F\212\204\236\346m\356\201\234\0375\036sq<\034\222\n' p\002\"d\326\003\340\353M\007\254\236\201^\035R\3265\215h:\265\r\352.r\353MyVb\367(\213\254,\204\270\257\260\270Y\033a\250E\212)\323&\303\331+\021\207\344\361"
+	.ascii	"Ih\376\214\373\n\250\302\226\027l\2406r:\332\250\211\264\304"
+	.ascii	"\"\322\310Q<\211\223\221o\026\267\200f"
+	.text
+	.section	.gnu.lto_blackboxWriteString.48.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`0\002\035\023"
+	.string	"&%\200H\340\360&\035Z'<\253\022d\217\004I\302\331\020~nz\214gJ\261\305\261\356-S\204\276\002 \2712\307nC\213ml\255\221\217\371Q\216G\301\030\342\f\332!^q\261\277\036:\223\"\230\366\356\2505i{o\271S\nm"
+	.string	"e"
+	.string	"o"
+	.ascii	"\237\016\271\227\270\t\226}$\303\035\360:>5C;j\255\252\220\203"
+	.ascii	"\320O\371\001\364sA\230F\326Ot\312\215,\377df\203\2013?\311\223"
+	.ascii	"K\326\363\001\326H\223\246\245\242\323\276HS#n>7\\\312\003K0"
+	.ascii	"\230>@\227\004\221\365\300^{\214\2014qO\273\374\341\231\001\003"
+	.ascii	"o\036O\fj\255\2160\320\346\346n\373e[\201\035!\004_\274\311N"
+	.ascii	"\323\2227\307\035\215N\241h4\367\360\247rF\257\214\216\027\272"
+	.ascii	"\037\240\263\241!b\253Uv\343Q\225f\221\317\205~\373\376\320k"
+	.ascii	"v\347\230\247\360\332$\001\325Z\273\030\273\373\274\315\362i"
+	.ascii	"\356l\013\311\274\2762\240b\256\240\245ZC\221O'\340>\243\375"
+	.ascii	"\023G\301z\210\341\002j\315!zQk8\342\022.@<7^$\276\371\021\375"
+	.ascii	"\232\312\203x\230\001\330r(};\363\033\037&\r\362v\037\321n\t"
+	.ascii	"\310j\320\222hb\223\343F\270\213\225\002;\265V\023\237\350-X"
+	.ascii	"\374\331\247[<\217~.\b\341\241[\026\207\341@\360\324v\373\027"
+	.ascii	"\316\027o\366U|\205\217\374\231)\330(\036\366\351\333\210~\246"
+	.ascii	"\366\265\217|\320\021\304\241\025okCr\201\273:v\0300\236\313"
+	.ascii	"\302\334)$\336\212\203\013\036\nK\312J\002\212j\302\312\252E"
+	.ascii	"\225\362\002\243\"1`\317E\345EU\301\363^T]\330\272\244r\2771"
+	.ascii	"\333\334\206\264\366\363.\267\257\351A\367\273{2\263\275~\276"
+	.ascii	"x;\255\216]\220\222&j/\002\t'\322\225\033[\321\270\rl\3701,\254"
+	.ascii	"\270\231/C?\343\212\310\210uh\311Zk\245%\227\213\332\323.\003"
+	.ascii	"( p\002\221Z\263\r`\324\323\022\b\307\260\223\341o\264\212\217"
+	.ascii	"\024\346k\n\241E\201\246\240\316\242\254]$\276JZH\300\364\261"
+	.ascii	"\020-,\350\016\230I\356\207a\213\251\304\021&\333\260P~\242\031"
+	.ascii	"W\333J\300\220B\006Ul`\222\b:\362\223T\003>\266\036\204\252Q"
+	.ascii	"\2321\336\253\263\255a\2720\031"
+	.text
+	.section	.gnu.lto_blackboxImageBegin.50.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"U\n"
+	.string	"\226SF: \317\244\003\2402\317a\220G\035\266\312\226Q\034\343\225jln\007\005\020]\304;\"\204?\252\335\357\230{\354\n\305\020"
+	.string	"\007 \200RV\336 !\200\261\300l\021\332{\357\224\0022"
+	.string	"6"
+	.string	"4"
+	.string	"\232W\217\357`^5\017\300\274Z\264[>\312\3665\025\213\032ow\277\271q\361R\364/\362\215\353\305\272\314 \354\256\245\353\205q\317\333&\260}`?\024\263_f8(+\037\333\356E\357es\365\244\303\3669\266\345\370\020\3614\2257\2730\026\334\356z\f\322\274\n\320K\373\037\007\021?[\035`7v\303\355\216\036\033\004\323\206\370ME\262\363\220\323>\335\266\352\310v\027\344\327>\022\341s\274Z\"%\357Ja^3-\235KFK\366\354\221%\247\206}\272\273\353\031\263O\373\351\003$\212\322\211\202(P\201z\364\tK\t\023\241ha\0042\210>\207\022\330\360\215L\247\3573\340\360\201d\372Pah\3728\343\236\356\2149\224\222k\315\n\027\334\016oR\002\333\361t4\023"
+	.ascii	"`\251'\023\372\211\006\206\013\025\030\0024\001\226\301\306M"
+	.ascii	"\261\005\206\237\332\316\036\326\262\013\0271\314\203\251\300"
+	.ascii	"\340\21245\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_blackboxImageEnd.51.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\315\b"
+	.string	"VP=:@\305(\035\340-\206\266\352\364c>\030\325O\003T\221\2711\243Q\255\374]\340\263j\204 #\270\352\303\264\354;Zd\222\216\341\341\211\033]LbxvKI7\262\367\336)\005*"
+	.string	"."
+	.string	"-"
+	.string	"\023,\327\356R\3153\330\247\274"
+	.string	"\366\0313\276\035n\376W\227+\252\023\317\304\035^\022v\327\3203Y\334\361\266\013l\033\330F\t%\025-\255R\344\354\217\203\021e_n<\331\206\226\2233\342R\241\"\273\024/"
+	.string	"k2IT\266I6\306\347x\007\311\233\374R&\f\225\022\027-\214\225\207_1;t\220\232I\355\356\201\377\375\303\301\327\370\264h\004\357}\372#\354\363\322\005\330`\351\340\313\022\332\021\022\360\236\007\002\3166\365\303\201\250\036P\326Y\360P\206O'D3MD7\004\256\r\n\032}\250U\243\230o/7\236d\324t\261d\033\364\220-\200%#B\f"
+	.ascii	"`\251'\023\332\375\201\335LP@\\\251\204\221\252\330qa\304\r\313"
+	.ascii	"Y\260<\\+&a\222\001"
+	.text
+	.section	.gnu.lto_blackboxImageAppend.52.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\030\002\315\021"
+	.string	"\006\241tF\340\360&\035\333\250\306\220\254^\b\235\033\345\236)\367\341\243<\350\316*\361.\nL\224\036\340,\377_V\366\030UZ`\377l\372Q\304[\007\303\f3\314G\002\343\253\354\200Q0\211\223h\376\340/B\310\336R\246\024a"
+	.string	"V"
+	.string	"d"
+	.string	"\265\021+\350\036]{\310\366\330}\300\366h\226M\343\265\232\345f\037l\007iwM\032\342\254o\021j\262\374\016Y\314\267\270\200\006#&\353p\b\017\320xH\372\220Y\200\".\206`\236\314\225\nM\032zl>d-\bbt\003t\235\347\005\231+\2233\331]gL\266\341\346n\033\305v\003;[\002\265\230\324\231}\375\276\357\263\322\330\307\371=\236\363{\231\356`\232\213\351\r\246\243\246a\2465\323\231\351\203|\314\304`\300\263\233\341\303\261C\221\205\215\355{\266\263\366\023\254\3478\310"
+	.ascii	"vA(\375\354\356\210K\272G\021\370\264_\342&X\307\251p\001\273"
+	.ascii	"42~v\003?Q\r\024\341x\n\265\203f\004[:m6\343(\222|E\212@\215"
+	.ascii	"\017G\264C\253\301#\304\001\003\324\231\247\252)\342\232\252"
+	.ascii	"Z\300\347E\242\345\225\367\250HuP\364Lr\t!\251S\333\365D\347"
+	.ascii	"\205+\225l\263\234'\325\355n\211\277\363\024*\177\304\243%\300"
+	.ascii	"\344c0\333\343\365:O@\204\"\tG&?;\020V*.)-\333iuB\201F\221\250"
+	.ascii	"V\036PP\235\260\240N-'&\227\225S\312\204z\2011\221 \260*B\312"
+	.ascii	"\213i\245R\275\230\274\332\336DF[pww\3534(\025R\323\342\261\243"
+	.ascii	"k\247+\332\215\327L\200\204\352\241\234\332\250\224|\314\336"
+	.ascii	"\207\227\306x\323\250\234j\216\327M+?_7\2156`K2*\007\232\320"
+	.ascii	"\005, \220\002\031\242\274\001\240\353\t\005\3245\254Z\330\375"
+	.ascii	"A\276\262\306-\026\365\336s9\322\341\351\201\225\r\355\365\212"
+	.ascii	"d\242\201\370\270\013X\305!\301\033\002E\334j\321\222,T\211\361"
+	.ascii	"\026\213\361:\201\334.\202P|\333\232\336\373\213\366\r\321b\307"
+	.ascii	"b3>\257\002\343\21248\005\340\221\336\236\240\033\364b\n\026"
+	.ascii	"D\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.53.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`n\t=2"
+	.string	"\272W\b\023D`\236N\007\177\256\231\353*\236\0307\225\356Qz\331\357\035\236\362h\364="
+	.ascii	"Tb\001\\\033\215\210.\016\r\343\351|\f\360\225<\344t\013\b\352"
+	.ascii	"\210\246\242\f\262!\302epC5\263\262\350F\233\310\275\223L) \001"
+	.ascii	"\003\001$\001\354s\016\020N\316R\r\254\257?\327\215\330\247\264"
+	.ascii	"\313\265\3235\321\327\271\027\354\322\213\245\262\246\016N\316"
+	.ascii	"Y\002\353\353\365\270&v7\\\326\261)\315\320\006P\356\330\354"
+	.ascii	"\344,m\362\265\035t_\251Gi]J\343\2650g\261\277\273\234\263S/"
+	.ascii	"`}=\252~\273\235\315\333Zw\213\341@9\217\261\271\313Y\352\324"
+	.ascii	"\tX_[\352C\330W\326\215\330\327n\273\371\\:$\007\313vp\305\331"
+	.ascii	"\3119'\277\314[7\006\001\375\370\024{x\210C!\033\304\253\372"
+	.ascii	"\267m\037@7}B\227n\fF\020\373:\363 3\0072#r\177\314\354\206\\"
+	.ascii	"\2370/\206\331\201\335\2363\365\350\343\362"
+	.string	"\020\325\002j\177[\334\214W\017\365Hn\313\214\307\035.\211}\355p!\232\227\216\313\232\361\332\241\036\351|\t\315+z\2039\034\253\006\300\302\334(B\271\324\2412A\3348\235\337\031P\347]\203nIT\217\363\neE\342\210}\365\360o2\361\220\031\336\331\020\272\3657\030!\347\334\367\t\375\362\026\362n/\321\335\036\272Y\"\001y\351`\354\206\314&eK\313?2\023\361G\363\006vw\b\357\"\202\315\271\271\240}\213s\031\321^\304\327\226\242\242\302\276\256\037\314\242E\315M}-\376\224\363\177_}w\202\371\025\307\242l/\322&\252\256?\253\260\257\377E\"Q\377\373\316\025\250u\247\315z\343a\344\373\257g\354\336\326\310\2411\357\264[\312\274O\326\355?\235N\375\372\307\272\275\316;\312\341\274\241\356\355'\237\363N\272\233{\223KqG\no/\ro\037\205\267\005\004o+\341\333I\3706\022\276\035"
+	.string	"\337>\302\267\215\360\355\"|\033"
+	.ascii	"\276M\304\336\036\022\336\026\302\267\215\370v\020\276\rto\377"
+	.ascii	"\bo\373\004o\027\361\355\036|\233\007\337&\336\333C|[\310\336"
+	.ascii	"f\361\355 \276\215\203\267W|[\305\267\037\337\276\367\266? \300"
+	.ascii	"\006\326\243\214\307\257\221\346\256\351\235\234\267b9\342u\356"
+	.ascii	"s\356p\376\335n\327D*^\245\365:\027l\276\013\370\351\221agC\241"
+	.ascii	"g\343\177\255\023\237\3633\276\320\033\355%-\277\254\t\375\215"
+	.ascii	"\027_\311\357M\317\370u\202\036\350\215}\312\226IU\320#\351E"
+	.ascii	"\177\036\350\375\347\035G\333\033'\222\3063\303;c\237\036\371"
+	.ascii	"H\2609oc\232\367/\350\363\335\215\300\347\264N<\216M\3169\252"
+	.ascii	"=\216\313i\325\332\265\266\255m\303>oT\347\f\230K\372p\003o\241"
+	.ascii	"\340\342{\2237\275\346\375\353\366=\347k\241H\240@\001\373Z|"
+	.ascii	"!sO-\332\323\206\347\211\337\243\307\363D\303"
+	.string	"'\336\241z\247\315\212\023-\371\310\177z\237\342\030\356\330\3528\351\b?\371\0270\351\262\337m\341\302\365\247\360\217\315_v;\032Oc\225A\203\206w:g\312\242\306/\352\305\257\025h\336Zt\203\034<l\005_\301\332\2331.TG\352\247\016\335&\307\337\364\335\037@\\\177\366\321\371\313F>~\005O\310p\005\202q\027?\354\300Y^@7\3033\333\362OF\246=O]\313\013\323.\246\371X\367$\354\353\223;\266\264\2343\323\227\356\346{4]rJ,\251\016SSX\251\274\252\320B\211\2255\001\006\026\361\205\325\212?\201eb\2052\005\226\302\222\"\2416\025\002\253\252\0210\254\246PPI\245\230J\256\250\222R\221\244\272j\221D0\240\255X(\257\222XVVWI\242T\313\325\374c\035\347,\226\260<\255g\032\237L\211\243M\2714:P\217#.h\311\351\336\260\261\364FuMR\346\272"
+	.string	"9\215\225E=t\245\003\247\346?Q\177\374\253[\343v\271"
+	.string	"\322\006\t\202}=\376\3726\365\021p\340\322h\235@\2703\004|Qs\331\352BRTz\027re(}\360m\252\026\375\250\277xNG\372\244/\002\f\360G\217\364k\237\363\t\321C}\200\307{N$\253+\261\321\037\375Z\347\004c\272\022\027\275\321\273\023\355n\025\275\3339\323[\340\3159/{\240\036\300O\275\205A\343Y\230\350\001\334\345\325\312\"k\313\312\260\257D\037\314\022\250\326t\273\333\263\326\310\365'\324{\234;\216\256\276<\346/\325\234s\346A\336\247o\372\241\357n\223\264J"
+	.string	"\207~\265\321\347\027\325j\2714ip\210\376\"\200\276\250\201 &\221S\206hDD\n\222&\255\001\200\002\021\251\252\252\003\02109\204\214F\223\224\332\r \356\345\231/\222\321oj\247zW\254\266.\301\324q\336\224\3450\301\034\204q&\r\231}\270\274\030\221\353\221\224Nr\322\2504\353&Y1B\204h\nh\003O\352\203L*\2737\306\257\212\212\272\255(\277/\031\235\221;\377\350,\037\f\325\350\234h\276\225"
+	.string	"v\334\275}>\013\257\262*\n\345~_\005. \"\235\314\t\245>\b\312\231X,\244[\003\023~G\202/\366w!F\263q\2447Ij0]\236\270\\\330_K\375\356\202I2\362\360\260\370H\276\237\300P\001GHSk6\216D8$\317?#\205\322\223-\003\027\324\314b\364\217\330\376;\024\200wpN\201.\233\274_\002J\273\354\326N\274 \002F\232\220\261\227\371\270A\343\264\324\334tH\357\256\336O\260\275\204H\365\256"
+	.ascii	"\016\037\314OICj\227\323\013\254N\215fi\353\f\317\031hD(\333"
+	.ascii	"\261\006\342\363T\3637Q\314\321\372^#\"\267I)\240\223,\037\001"
+	.ascii	"\376Q\203\375\005\007v\240\327\266\016\312\276&t\346\330\231"
+	.ascii	"uX\216\216\007\343XuyH[\250%\2550\360\272c\032\006\270\364\355"
+	.ascii	"\334R>!\230\024\003\025i\331;}\315\245\275\261\001\340(\262\250"
+	.ascii	"^\353\256\344U@\254@\200\324e\r\217\241?\270#\256Y'\342?"
+	.text
+	.section	.gnu.lto_blackboxDeviceCommit.54.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\207\001\035\017"
+	.string	"f[eG\340\262(\035\223\020(\210\264\221 \273\241\236\265+Q\265\220\371\225\273\221\221-\224\324\212\352\331\346\330\206\033\006\361\223\313\204\216(Hb\340\026\302\233\203\030c\024\302\231\326N\031Z\223\374b\352\201\020h\027\210\335{\357\235RR"
+	.string	"K"
+	.string	"S"
+	.ascii	"\366\216\273p\366>65<\264\335\345$\211\237^\351\224\361\344\003"
+	.ascii	"\b\277W\332\300\205\r0\364\3609\017\324\004\231\b\ti\346\b\355"
+	.ascii	"{\211\302\231(\347\002\233\237"
+	.string	"\016!\241\314\024\221\215\320\361\326\243\2060C\214!\223\335u\004C\016w\350\266%\330~`?\026\362\255+\230\301V\037P\261f\273\276(U\366\347\356\256\345\215}\326=c\364\267\001A2\b\265\335\r5 \033\243\257\023g\375\366\337\262\310\327y\212\323Y1\333\227\332z\200px\354.\311\251\031l\247\t.RO\347\t\324S\237\002=b4\362;\n\235\020\251\tS/G;9\\\341>0\333\356:\360{\336\242\305\3179\265\205\227\227zzIo\374\254X\250X3\311yB\263\032\264Y\224\341C&BJ\225c\352\224\005T%v\200f\342\017\373*\276\3024\374\034c0,\036<\365\r\013\023\\RXPT\252I%^)\302\005o\324\221NTF\034K\351d\205#\231Z\270\222\021{\024PL\234\213\347\2318\221k/ol\202\2222uFg\340E\212\257 \007\261b\221\242\002\342\224w=F\207"
+	.ascii	"\307.\352\240\377\3420RJ]WO\355\025/\036t\200W  \260\002\031"
+	.ascii	"\242\365 \325\023\005\254\0332\332\227\200\332.>oW\304\321\356"
+	.ascii	"=K\013D\n\233\2675\360j\206\033t\323\r\\\033K\034d\025\037\251"
+	.ascii	"\227\276C\300\370\344e\027\270\007\366G\300m\001\226\244\264"
+	.ascii	"'\302\r\264\230\202\005\030\005"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.55.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"M\n"
+	.string	"fRE= \345*\035\300\013J\342\003\td\001D;\b\005\226\374\023:\257\256\021s\200`f\261\352O>\331:\200\205\027\201N\362\037"
+	.string	"\201\251\322$\035\257]e\230[\333\tx\370\033!{\357\224\0022"
+	.string	"1"
+	.string	"4"
+	.string	",\226rw=Z\362\324+\235)\377)\017\020G\360\265\340\264\n\324X1\2351\254\f\034e\310\300\270\232s\363\260\273\236\342\370qs\267\355`{\301~B\256\323\326\330\230\027m"
+	.string	"\262"
+	.string	"f!\005m2\234\224\304~]\352\262?\375\356#[\322 n\273\035\267"
+	.string	"+\343^Nl\277\343\224]s\362\265oq\t\273\353!\210\311\300i\263L\f\326\242G\350N\017VfV\263f\273t\362\343\354\256\032|\330U.|\223s>\241\346\305s>\252;w\272\201\241A\201\251\346-\026}\276\221D\306\027\"\211@\024!\257b\004*y\"\323\311\373(\370\263\2300y\030\337g\362:\244\352u\251\313\0214\231\212\206\255\365\\$V\316\300i\253$JA\316k=\002\023"
+	.ascii	"`\2517\023\372\204b\2548([\221g\314rVf\320\330\035\302\305\031"
+	.ascii	"Sp5\206AD0\326\270&\272\207\220_\206\020\227.f;oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.56.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\336\001\315\017"
+	.string	"&]fE\340\224(\035\250n\372^f\216,\246\n\200\353^\377\370\264\032\327Q\210@\317p\020Fs\260\236\303\330\177#2\315\255\371y\340\001&\364\217\003\240u\230a\f\303F\212\210\224\b/d\344\360g\316l#dK\231RU"
+	.string	"L"
+	.string	"R"
+	.string	"\262!\022\\\273/9E\366\245\355Ha\233\305\346\314\300\001\213K\017M\274\374DN\252%\333\r;-\361\3227-j\226|\3237\355\307\r\020\355\254\033@\345\370\202\334P\255\036M\256\250\357\264\221\354."
+	.ascii	"\325\207\230\035\224\335u\202*\021w\347\266=\333\013\354l\020"
+	.ascii	"\340\036\340bPy\304\266\312\303\025\317\356\351\201o\363\030"
+	.ascii	"\236\217\342\2325\220\362\3405\237\264]K\355\360h\315lZ2\307"
+	.ascii	"Z\332\034<\344A\237\365\b4!f\261OMv\370\245\316\330\217\2532"
+	.ascii	"\266\323\234\323\037\247\243\323\232\351\f\360\232X6(\224\007"
+	.ascii	"9-Y\261x\235nn\262\342\025\005\244mA\224\007UUM~\215\237&\224"
+	.ascii	"\305Li\344\2523\376\r\037G\364\021\272|\034u\202\353\002B\305"
+	.ascii	".\r\277e\230\347'\260]\363@\330\0368/Zl\214\375\031\266a\nb0"
+	.ascii	"$vM\207\261\r\313\016\235x\"\n\035\274\024\225\020\350BJ\207"
+	.ascii	"A\004Z\351B#RwR\300^\206\n\243n\203\347\215\272\260\345qU\306"
+	.ascii	"\035!0\\:\322/m\234\213\224K\373\350YG0\"\345\212\234ZU\243\272"
+	.ascii	"\330\216\232\372\3712n\224\270M\370h\311\212\310\353\263\361"
+	.ascii	"\0015;\213i$\231\340\001) \240\002\231I\252\003\323\312q\310"
+	.ascii	"\323S%\013\211\021d\352~\204\231\007\306]\321\013\213\3658a\363"
+	.ascii	"7\020\326\342\365%\232\227\3762{oZ{&\211[?\3174\321V\226p 1F"
+	.ascii	"\"\022\227\235\363\300\036wbu\017M\371\221\303\357\313\264Fp"
+	.ascii	"\344v\325\355\267\305\310\207\231uY'\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForceComplete.57.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375 \340\r\006"
+	.string	"\002\213)1`M\323\030\300\020X\233\241\210W\326\245l\254\257\350\004s6\034\333\264%\021\357\005\246|\tv$\312\r"
+	.string	"\b\362\215u\373\217D\201\007\030[n\231\002K\017\234\022$`\264 A\f\321s\230\240\206'Q\020\357\021\030>(P/\002B\3525\321\222\253:\026\305v\355'(Zf\252\016\246\327G\254i\306\247[\305\370\333\352\022\304#\223\202\200\262{YQ\331\023\200\222\216\277\372\346\002\203j+\343\306%9D,B2\273\361\251FZ\331\2543?\322\221\230\214d\230+[\300\301\356\3362\314E\256\371\017\374\004\177E\t"
+	.ascii	"`\251'3 \030vU\027\273&\026F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.58.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`R\tm5"
+	.ascii	"\032]\220\024A@\246Q:L\350\210\337?\"\264\3226\245\304\312\001"
+	.ascii	"\356\257\254\350<p\205)\316\\\345\321\037\215,!\340k?\223;\033"
+	.ascii	"\354\344+z\024\3752\027\265k\034\335\247\374\tYP\373\337\366"
+	.ascii	"\244\021B\366N2>\001\034\0013\001p\250\376*\231\275&\211\246"
+	.ascii	"%\242\355\231\3303\037\355\221\331\316Qb\204\256C\373\365k\316"
+	.ascii	"\246\310\315\200(HF\337\346\017Co\240\022\276\266\205\366\253"
+	.ascii	"\2027\261_\3253\261B\272?v2\"\207\366\t4\203\234\320\367}\177"
+	.ascii	"_\273\211t\377\276\342\356\"\335\277\276\220\241H\273\217v1\371"
+	.ascii	"\027;\2543\273\367\215\0263\227\273\027\320\024\200\211\270\004"
+	.ascii	"`(\f\002\177\276^\313cW5c\267\177\274\200!r\320\260\246/\274"
+	.ascii	"\244\231\304\001\230<,\232\364\345\304\365\f%\256\270\264\246"
+	.ascii	"\223/y\021\353\202\001\250\300HX\203\016\306\354R1\\\331i\365"
+	.ascii	"\0028\246\027<\004c^\021\373\0028f\027,$~\3111\332\312\002\363"
+	.ascii	"\340\334\033 \357\351\352\215\322\317\335V\226\326\177UT\005"
+	.ascii	"\276\3031\251\250}\001\030S\013\367xOiW\355(\242\203\336meYy"
+	.ascii	"\013\306\224\242*\200cN\301\274(g\325\bN?N\204M\245\332\024\210"
+	.ascii	"K\016\013\257\267\002sU\235 \005\216\233\260y\2452\305\235\341"
+	.ascii	"z\3321\222f\022g/\344\267\230N\026\300\373\276\276fR\305\274"
+	.ascii	"\247\367}\033/\233Y\357\001\357\276\230\356\356\321\335:\b?N"
+	.ascii	"B\225\270Q\363\263\251\330\003\031B\2310f\207\2228R\017\300\177"
+	.ascii	"\277\202\355f\321\002\177y ?\355?\023e\372\226\314\307\376\236"
+	.ascii	"\277\214\216\035\335\021Sz\316O\267\376\037\365\216\216O\277"
+	.ascii	"O\006d\b\232\346}\363\364\365\364\\\373#`\277\266)\336EQh\232"
+	.ascii	"\027\313\353\324\326\335s\035\240N\255\367=\3369\207\227\257"
+	.ascii	"\323\017\313\025\256\324\335.~\347E\373\276I\r\375:\267\023\243"
+	.ascii	"\357\365\265e@Ae^[\24502\t\357\317\371Z\267\365\275:\252\331"
+	.ascii	"\360\227\315\306~-\013c\310\t\225Z\341iw\024\211\363\263\373"
+	.ascii	"y:\235N;k\351n\334N\215\333A\020w\203\036n\006?{'8\234\367\001"
+	.ascii	"\036n\002\215\233x\263\367R\343\0366n!\017w0\210\033\330\303"
+	.ascii	"\375\353\341\366\365p\367\200\270\333\037n\236\0177\333\303\275"
+	.ascii	"\362p\253-\356\314\303\375\t\035\f9\265\276\334\345\270\350\313"
+	.ascii	"d:\351}[\355\204\271\331\177\366\303y\356~?z5!\217\323Rh\260"
+	.ascii	"\034\332os7O;\332\337\024y_\316|\371\331\022\016\314W;\226\362"
+	.ascii	"D\216J\235\240C\277\f\314\254#\254JVR_\376e\003gJ5\371n\025\266"
+	.ascii	"\227}\371J0$~\361\321\255b\305\275r\205\375\332\313\031\316H"
+	.ascii	"\303\244\b\373\224\275\365\3623z7\013\333\227\364In\026.\367"
+	.ascii	"\371d\277\006\335\314\331I\333\256\227\351\243\317{\327\346g"
+	.ascii	"\277\r\n\333\007\302\336\321\235J+>\020v)#\311\207\3002@\272"
+	.ascii	"\r\247\323\251\364\020\330\004\231An\254t\"\361\264\333\334\257"
+	.ascii	"\273\364\206\313\305\355\202\273\260_s\333\262Q\004\274\224\361"
+	.ascii	"\335/v\315\305\367\3350\354\337\316\313\335\356\030\227\f\376"
+	.ascii	"\262\315\352K%\037\233\315\274\234\t\271f>\347\242as\020\017"
+	.string	"\036^~r\360\222\347\b\233\265\264\320\310{7\214]\363\267\236\236\310\r\333\320?tD\256\230\352\216\271e\254[\306~]3o\213\2340;jN\220\263\033V\245\376\36088\021 Z\257\257j\356=R\013#\313\271?\350\204B\214 AB\316\262\221\025\236v\001\374\267\037\310\335&P\340/\263\357\253\016\335\035\335U>\266\2361M\324\254\371\311\366~\n\215\243\002\025\216*(\036E)#\017\036\306\250\0027r\330\2202\202\360\005\251AC\212D\215*(\0254|@\315\bRI\031sT\365@Q5e\354\361\353\250\n\306\0342\202\030g\350\210\202\3321\243(\225\003\212G1j\212\252X\201A\033{\324\230*V\031\215S\305\237\325\3257k\351\213}\204\242)\332\032\323\357\262\304/9\254\265`\tEI\320\326T\274<\261\211\031gd\367\223*\340\311\230\227\023*m\0326\207y\350,\363\363\246\272\267"
+	.string	"?W\026\240\227)?)=\013\006\032\251\023*\235\323\266E\017\321\202\227=]K\313;\345\213=@\037\262,u\202N\3466q\3128:7eB\204\205\364f\267\224\244N$"
+	.string	"\371\231\347\004\262"
+	.string	"\263C'k\027X\tNB \237\354\017\352\270\rr\216\261\215\245\351\032\272\2540O\231!\312\200\273\335(\356\024\374\2450\017\253\324\275!\361\374bg\001\350\275\023\346g\337`\333\354\300\t\312#d\034\032\0332\230\237\355B\371\003\346\026\205|\035}\267\261W{\017K\236h\242\265\336\2047\b\346\276$\254\374\262Q\203\034\244\340F\212\214C\003\n\323\332\340~\020\330_F\360\004\222\331\237$\216\204\340I\200\263\250q \344\234S\b\321\214\210$\005I\322\030`\002\021*3\333\020XFB\223$i\f\213n\322\357)P\341\003!\253&\234\3734\220\220"
+	.string	"\317\227\224\026G\315v\276\362Bna\020\205\346\252!\300\031q\t\236\350\247\177\243\207\345qB\334h\365}g\037\30536ec\254r\272\3220'\201\013\017\337\240I\246&K\202Pt\0052[\247\213-\3114\tB\355\336\003^\270iD\211\027\337\360\362\311Q=p\3163f\"\253j"
+	.string	"g\275\221J\317{\002\224\236}6geJ\234s>!\301o\255\027\002\243;\362~G:\027\206U\027\304\t\324\332x\265b\301\305\\\321\360Bj\tb\217\272\310/=8\226\326k\b)%\230\312\223\243o\377\227\324+\253H|\032@#\271\303m\033H\222\017\346\n|-\027\b\311r\033\035A\322\353\220\201\314\374\b\250\332;\240\266\307B:<\346\353\023a\222\022\210\243\3345\373\331o,\331o"
+	.string	"\310\313\221N\341\315\035\267\330\032\314\034\034\017\354f\031\357\217/\211\272\342\366\306\270\205\225lR\236bQ\024\354*~\240\013\327/\310/\272\351\303\rE\313A\337\363"
+	.string	"\007\355\315Na\220\006[\035A<\247t\034\226oX(\212\026\260\215\357j\203\204\313Xl\177\336\367\243\255\376\206\"\213\302\272\224\347b\255\007\2154\231\\Z`\246N\224Aj\264I\177\214"
+	.ascii	"\274C\364<\200K\375\001"
+	.text
+	.section	.gnu.lto_blackboxEraseAll.59.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"e\t"
+	.string	"6Q@9 \261\322\001<\004\340\2161H!\b\007\032\310\277\017\300\"^3\205\306\210pDs\177\363\212\375\315\343\214b\302\375\201\004\200\032$*\240*\224\"\220\321 \005\264\266\367\226)\005."
+	.string	"."
+	.string	"0"
+	.string	"\333\305\220\247.\243\246\374\227\334\363\201\252K\201G\t`s\271p K\"d\324<\002\300\226*gaw\255\037\310q\317\333V\260}`{&,/$\341Jo\266\214\245\021\304\276\334\335u|\331W\177~\302\026\214\331\256\306\215fise\304\3669\247l\231\313`\373Y\212\013\245\266\033\273\261\273\006\237\016\232Jk\f\243\022~\304\023l\036\007NbZj\263}z\214\242\263\333J\360M\036V\370\"\237\276@\351\277O\037\265\371|\344\004&\201\274R\310\302\0335\220D\016\243\016\242$z\350H\246S\007*\260\027\301`\352&<\317\324q\262\325\345\306\227C1\332*\262\244GmOB\3779FU\007\026\017"
+	.ascii	"`\2517\023\372\3761\240\be0{em\337\310D\005RP\004\3607\004\b"
+	.ascii	"\227Q^\206\020\227.f;oa\226\001"
+	.text
+	.section	.gnu.lto_isBlackboxErased.60.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\325\n"
+	.string	"V\324KA \215j8H\022\r\322\213N"
+	.string	"\241l\206\265\206f\274 \261\b\3522V2\203n\001j\307\367\277\266\360\304\016\336\343\303U\373G\001\f\210\3042\205\351\305\rP\\\206\261\001\016\246\241\326\366\336R\246\024:"
+	.string	"5"
+	.string	"<"
+	.string	"\250\257B\230.\310vGO#\034\374\246\t\372\243og}\303D\013_\031D\006\327\215bf\372`\021\303\r\004\201\254A\205X\312\244dv\327y\022\027\334\334m\217\330\366\260\177\t\335\271\353Y\347\350@bB\213\2245{\fS!\330\337vw\255)\333\351\316\351\314\364)\257\215\220\305\016\300vQ5\332\2728\016+\333\"\333\342\217\020\221\301\217\252\266\347\313\237:\275p\020s\205:\022QQ\255\202\335\355\310\360\340\032e\t\2776\264\036\3501\272\353\305\002\210R\316l\013x\005Pe\267$\342Sx\213\200/\341\234\013\204\362\247s~(\346`\276\016\211\201oc\302\321\234l<"
+	.string	"\035\215\307\343|@\036F\303_\200\222\2177\340\373>\236e$}[M\231\002\243a\320\220?\330\235u\013\35545\201\355TgH\032n\023\031\017"
+	.ascii	"`\325\233\"tP6\274\303\354\345U\007\276,\222\301\n\rS\354\n\370"
+	.ascii	"\260b\270\020\262\301\310\270\346\246\322\221\247UP"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.61.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`N\001\225\r"
+	.string	"\346\327XE\360r\234\016b\216Z\212\237\243\203\007K\271\266-7\220\244>\302\242\270\254=B_wz\207\225\002\262A\244i\265F\204p\261\233V\355\216fq\217g`\023r\263p\364\302.\376\317\003\221\323\377\240\245M\344N)D"
+	.string	"D"
+	.string	"E"
+	.string	"\366;>\3312\017M,\200\024\017\032\\Z\273\233i\211\237>/\225'\237@\207\033\336\307}~\305\027\220\020\321\341}$\277<\327.\205yT\254\023\234/D\245F\301\356Zz\037\210\033\273m\006\266\021\330_\t\266`2a\237W\f#h\250`9p\237\305Y\314\362Q\234\3010\362\336\247o\030\354S\303\243E,Y\365@\311\321\016;\251'\366u\034\307\031\253\211}\351k\264\020#\037\276o\360\261;2\376Xq\326@\341\376\313\005p\022\310U,\225\r\325\223\313\360g(\007\034+\225]\030~\214?"
+	.string	"\366ypSVR\330o\261-\263\331\345^\022\242\"\255\225\312\202k\240\003\246d\020\333\023\356\242\264\331M%\360\303\267\250\340\243|\006\326>\233\250\301\205-\364@\003A\be\021D\240Q\246\221J\331g\2007\t\016H\031\205m#e\235\020\365k\325d\223\203DDi\347\277x\201\230Q\274vw\247\350/13b\347rL\004\330\332qq\244=\332\344=\253r\001\037"
+	.ascii	"`\2517\023\332\231\002\323\361\255\200@P\"\252+LY\006\356Fz\254"
+	.ascii	"m\215s,\241\200\030.K\205S\236\312\304)R\200)\220\016U3\206~"
+	.ascii	"*\270\244\322K)[\3462\364\313\020\343\322\301l\234\246\244\242"
+	.ascii	"\356\200|\273\254<\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.62.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\335\n"
+	.string	"FTK>\020O&\035d \021\324\303\277\276\001\202\241\250.\374\333\267JN\016\206\023\004`\250\275\367\001\350c\267x\226\252\371\262\325\205\021"
+	.string	""
+	.string	"B \242\3275\326]\025%\254@4=6B\266\224)\0059"
+	.string	"5"
+	.string	"<"
+	.string	"\250\025\bEl7\344T\304\275GM\317\357<>\365\330\032\275\370`)@\017\327\270!\003\275 \340\027\025d\210}"
+	.string	""
+	.string	"~2\035\222\335u\206\300\016\267v\333\rl#\260O \327\256\262\321+\206\312\2233;\374RK\366\343*\311vzs:3}\307\245\204h\003\370\023kW4\223\261.m\305\b\333\267\315\261!N\260\200c\357\241I$ \241M3tA\302\365i\007\306\303\264\034v\367\300\005\204\253\2233\fk\251B\250\226\342\013l\327\001'Z|Rf{\302W\232\307\356\207\201o\342\252\n\376\351\232-l\362\241k\376f\013\256D:\213\203\013\035\345R\231@\240p\021,\023\fW\311h\270\210\001w\022\036d8\n]\227\341 \241\347q\225d\f(\026,\025\371{\333S\017\240\233\246jPK<\372E\215\2641]>\020"
+	.ascii	"`\325\243\"\364\225\215&\263P\020\263\367W\035\370\262L\206\225"
+	.ascii	"\212\026ga\262\021&P\327D3L\350q7SUN\321\245\366"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.63.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"-\f"
+	.string	"\206\327UC\020q\233\016\023#\204\022\023\220*\f\027\270\241"
+	.string	"\371t\310\367\207\226>|\205\020\320\247y\351\277i#\257\353BB\224V\037c\271\207\367\257\252\334\004V\370|\250\315\364\217(\375\320\fCh\364\244m)S\nB"
+	.string	"?"
+	.string	"D"
+	.ascii	"\013\"p\202\353\225m+`0b\356\240\211"
+	.string	")C\242\006)E\270\013f\032\342\334\243&\347w|\242\307\3145\002`!\305\300\276Q\\\220!\364\020\340\3632/\233\335u\226\276\016wu\333\017l;\260\037!U\352Q7\260\242\305\215\017(\224.S68J-\261\037WI\354\237\376\213\323\226\3231\323\252\351\304\204^\2306|?I\3315\245Z\026F\305\342\304\366\210\215\331\316\374\211\033\360\225\360\344b\003\371\222\265\361T\344\213\252:I9\272L\321\270L\226\303\356\036\260VTB\033\242\304a\031*( TK\034O\300J\025\200b\206\227,\266\265\237\260p\355z\r|\023\007A\374\021\257|A$_z\345\213X\017\0234\b!\020'\344\263a\354\321h \t\030\264\216\207\207C\241\223\205@\234\217\314\263\201d\232\002\326*|\266,D\323\266\f\003\273+\211\217\372\325RBD\212\212\3749\313jiT\r\266\243z\323\351(b\251j{|\004\020"
+	.ascii	"`\325\023C\300\203:\036d{\235\350\304\016\273\370\002e\206\253"
+	.ascii	"\212>\002f\226qa\274\310L\353\301$\361l\273E\336\373\232z"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.64.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"u\013"
+	.string	"\026\225N? O\225\016`\224\371\3531\025*\032\340\311\003l\200\022Z\tkNpQ\020\201\006\345\244\202;N>\311v(?hqJyC\r$\240H\005\246%u\366\303 `\240\356Tk\204l)S\n>"
+	.string	"8"
+	.string	"?"
+	.string	"\343\b4\240D\372\234\200\3159nK\342\335\345j\347{\227\027/Y X\244^(\302\017_\031 \343\343\202\204\237T\240\001\026B@\350QuL\346\234V0\364pg\267\355\3006\002\373\r\002\3403\177\243=\373^\374\201\024+\\\"L\247\216\306\354\361\323\035a_\316\025\331VkV\253\252\357\340L\2008\204\027Us\202b\032\263\225\251 \331\346\330\020'X\300q\367\236nH"
+	.string	"jc8=\250\255\216\030\261\326\267\036\306c4;\314\320\214h/Z0\027\236n\370\305:\205\366\005\264/\201T\013\217f\330\256p\224\3461\247\207\201o\372\351\202_\342\2311l\364\001\266H\270\313\203\f\\%\202\205\"\241\262M\270P0\233%\243\331$\006\314Q\200\220\331,p\\f\203\214\235\313\257\310\017\225P\237\325j{\361\017\215\222\250Z\251\337i\272\033V\367SpF<\t\023"
+	.ascii	"`\325\203C\020\267\206[\232@\274\2621\023j\362{\007\241\003_"
+	.ascii	"v\312\340\202\256*\026\206?,\343\302h\206\031i\203\345q\315Q"
+	.ascii	"\245CQ\253\240"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.65.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\004\002\245\020"
+	.string	"\326\036lE\360\320h8.\351\253\376D<\275\033\007\207\207D{E\016\206\030\274\315\314\217\316'\256s\300.\251\261\351\366\227PQ?\025\217\314\206\237\250\363\264H\031\213\303\245'Ow)\f\312\026\333\321\033\262\331\275\267\224)\005["
+	.string	"Q"
+	.string	"Y"
+	.ascii	"\036\\\247\341\354\266F\237\255\341Z\214\260=b\217\254`\301\210"
+	.ascii	"Q\027E\264\006\314^\260`j\273\242\247!\216z\307m\232(?\365N]"
+	.ascii	"tBW\311\271\006/\237\227\355+\337h\274v\300\0313\256"
+	.string	"\222\353\n$\351\004\354\256\310\305aK\020\307\356:C\327\207\033t\333\030l'\260\323A%l\337<\206\f\006b7u\230\355\233\f\027\301(\266\312\032\266\277\273T\b\355\2220\360io\001\361Q\316\371BH><\347\207t\347\256_\271\001\0260j0Z\213*G[\004SO\354o\2532\333i\221\323!\247AN\253\2463\323\037\235LZ\0018:5\240\246|\023\317\230qy6=\021\351RCz\226\0130G\373*\276B\304G\361\207\311\324\235K\325\360\332Q1Q\345\350\303\274\353\311\251\345\244\362\347\253'~\n\177fs\261aI\331X\214/\243+\245\325XRv_\374\023\276\t\375\004\272s\177lg5\022\033\263\037&m|\245\007\031>\217\017R\207\004\017oB\251\303\344\221N \336F\001\177\024 \234<\013\337w\362F\242\352\333\252\314\033TB\031\232\364Q]7\312\340@\372\330\214\207E\263\211"
+	.ascii	"\354\314lX4\032R\325\016\266USA_\2749\266\216\004\372A\361\003"
+	.ascii	"8=5\\\200\264#\224\362\241HS\f* \260\002\2319\262\r \325#\330"
+	.ascii	"\241\027\2241\2545\340$\204\263\330\220\205\033\017\305\273L"
+	.ascii	"^\356Q9\202\026\303\277\023\343\261[\235\326mX\317+\366e&\210"
+	.ascii	"+\342\317i$\2550\303\231\310\030\206HK\354\366;\013\315\341b"
+	.ascii	"D\300\r\t\022|\037\0305`\217\21342\345\302\\\235\0173\353\262"
+	.ascii	"N\006"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.66.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\r\013"
+	.string	"\026UM? Q\224\016<0C\244`oB\202P\r\253A\004\350VW\320uy\301\001\234'\016\271\2726\022\213\035\223\036\243\302\344S\270?\b\002\266"
+	.string	"[\202\234\256\354\026\212\207\005\\\325\376&[\312\224\002:"
+	.string	":"
+	.string	">"
+	.string	"\273\226\201\017\210\257\340\005\304W:\342\331\241f\346\203\016\217\272\203\r\344\343\272\017W\270@\304G\215I\267A\370\242CD\351B\231\221\313\356:\271\316\303]\3356\003\333\t\354W\002z\324aH\b\026\247\016-?\333\333RK\366\341*\311v::\235\231~\204R\302\324}\305\267;\372ll\252ja\302\366\307\236\370(\316\361q\326@\203\326UN\034D*hl\347\242\246'\303#\265)(\206\204\304v\330]\004\030G\n\2247\324\305\214\021\210j\t\276@\274\022H\001#\224!\266+\374\243#\331\r)\360=\356]\360M\257\214\301\223\347^\371\236\370\352\001\326X\256\315\203\fW&\202\006#!cM\330`8\226\006\353X\226\003\276(@\300,\013\327\205Y\023O;\\%9\002\342Df\317\342Q\017\240QS7\330N\365E\323\r\002H\233se\017"
+	.ascii	"`\325\223\"\3646\033\034b\366\376\252\003_V\311\260R\321\342"
+	.ascii	"\2400\"\272\206\367b\361\362\020\244\270[\244*\207\346R{"
+	.text
+	.section	.gnu.lto_blackboxDeviceFreeSpace.67.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`,\002=\021"
+	.string	"\346_oF\340\322&\035\223\240\247v\255\304\240\004\271\362\034\321Q\001\2004\206x\364\226\021\216k\267\376\327\215E\260\036\203lk3\363\370\212\361\002\266\246-\2071f\230\306[\\!_\033\201\366y\330\367\237#3jdo)S\n\\"
+	.string	"X"
+	.string	"Y"
+	.ascii	"\262\026@v\367\344\321\fF\036}\235\273\2101\013\302\214\013f"
+	.ascii	"\""
+	.string	"cQ\323#dw7\223\027\320\036\341\th\217z\342\254k\021j\262\374RGT\344\275Z\327t\310G\374\316\037\230\020*\362^ \016\r\\g:\031M\300\356\232^40K)\273\353\364^\260\273t\333\234m\007v\302\004\247\330L\"]\306\205\221]\231\006>\214\307x\361Q<:\003L\336{\364a\264\307\324\r#x\310f\256L\262y\272T\034\373pw\327zc\223\2304MGM\303\317n\315t\006(\321\361\360z\220\215\335\017ID\366\2137T|\366\3331\376\216O\237\261\276\260=\207 \001J\242\271\243\006\311\225I.I[E!\357A\315\036G6_\347\363\027\330\241Oi\263\264\344=U\325\226\017\364\325\220\257\225E\276\2123\344\023A\0359\033\253\341\007\351\213\234\335\037\237\206\215F~\004\332\343\037[\031P\316\306\354\367\3306:\360#\307n\353%l\333(\275]\020\252\024\312%\202J\265\232"
+	.ascii	"\300)\024nE\202\006N\205%\205\252\240\262YXA\265l\251\325\313"
+	.ascii	"\206\222\300\234\213j\265a\340\270\325v\262m\036\327\341\352"
+	.ascii	"\215K$h\362\344%\021>\321t\233\237\020) \211\032\252\252\246"
+	.ascii	"\035lk\372\235\017\370\216p|.\355\374\031w\n\324\242\232PQ\366"
+	.ascii	"uBWp\264\"\3020 \320\002\031B\315\003\241\250RSBy\013\237n\260"
+	.ascii	".\347\344\270]\307(\017T\311\342$3r\215p\327\306\312 \303\361"
+	.ascii	"vc\335\325\306\340L\260h\346\350\367B\311\303\031\230(J{\236"
+	.ascii	"\261\320i\375\214\257x[}$Y\205#@\023\314\256 \255\030\265\020"
+	.ascii	"\343\027\037j:.\0228\007\023DKM1\363}f]&\310"
+	.text
+	.section	.gnu.lto_blackboxDeviceBytesFree.68.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\275\007"
+	.string	"B\01766@o\323\001\230.,\236<\317\0044m@\311D\266\204HJ\227\200\322w>\"\2040\242`x8\006\3516cD\364\344\371\336M\004\020$Wx\245\252i[)S\n\246:\025\250\301\242\372<P\036\210O\224"
+	.string	"y\"\"e\205b\207\300\325\204\203\025)\252\312\212\233n\257#\250\234L5\247^\241>\203D\313\317~w\025\277\370\"\016\271\004}\227\246\303\324\203\220\216,?\303\264+.\362\3335\301CS\314\356\260\324\017\373\232\325\221\3554\314tf\372S@J\013w\217ew\343\233Y\030\3502b[do|\223\237\210|-`d\\AI\214\006Ifw#\347\003\323\241\346\002\323\241\202\374z^\376Q\316\260\342y\033\207=\001\024v\327\271q\034\267\336\266\201m\004\333\244\n"
+	.ascii	"`\251'\023\360\2063$y\361\3523<\327\360\336\021/\013A\206\273"
+	.ascii	"bj'\031"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.69.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\026\001\005\r"
+	.string	"\266\031ZC q\223\016'\020\2540\210@\013\210^\022\3379\261A\346E\206Y\372\003\202D\347\303u\0341LU\267\326m\226(\373\247Q\0225\021\332\bP\004\020<\020\034\240\305\364\200E\360\024\001\204\220\335V\312\224\002F"
+	.string	"A"
+	.string	"G"
+	.string	")\256\242s\022\311\367d\237A4\362n\354.\202C'\260\016\r\234@<\304|@<t\307\266\361o\304\026\030a0a\361\262\273\231\212x\347\331\361_\372\345\205<\317\212\301\356:\275\320\311\255\267\355a{\201\375\022\001kU\2615}i\332\272\351\256N\272\243\246U\323\231\351c"
+	.string	"h\210B\227\001c\227CJ\307\242`\f\0237\375\244\247}\373+\374\025\223O\001> V\300\211\032\243\r\n\254C\373\237\215\035\376%c~\240Li\245\334\251\344\003\310\305_@\330p\\<T\275P\256\2517\331\341\263\274E\210/r7\222\367\016\375\221xx\375\312\035\314HaA\201\362\311\224c\332\025,\344\275\250\372\342\322\001\005R\217\375yRC\330\307\354n\032\220\334\264\214H\203m\343<\270\254}t\033\220\013\235\206\3232\0214\231\204M&$\3238\023\262\217\003\356D6NF\241\3538\031\366\3551\253*\266\\<\240>\n\362\245-/\375)$r\357S\264\364\322\177\367\320\220\243\322\250\226\222\264\224\340\b\025"
+	.ascii	"`\251'\023\332\225\006\306\205C\300\242`\210\n\r\214\301?z\306"
+	.ascii	"A\023\260pS\316]\326tR\013\"\027\354`u\350\253H}\025D \024p\231"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceWriteHeader.70.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\350\003U\033"
+	.string	"\306\361\257H\240\230Q:\200`\341$\351\344\234^P`\2515\376\0268\321\207$\300m\245\307\252\277\247\360\261-\240~\225?\372\007Y\013\233\303\027R\227\033X\005'\307\033)\371\202W\376\016h`\275\362^\237\365\341G\373\204l\271S\n\240"
+	.string	"\214"
+	.string	"\234"
+	.string	"I`\212\265\016%\230\002\354\244\2070\333>\323\223"
+	.ascii	"y\307\301\027\024l\300\244\343\007\265Uk\265%\370\200\362$}\255"
+	.ascii	"<\271>\276{\314\006\366*I\272s\347C}C\357J\031`\220\367\330y"
+	.ascii	"\024\035\335\206\336t\375\270\334\b\221\rZ\301\267\205\343Z\210"
+	.ascii	"\216&L\001\217\"\243\277(\204\034Wf\f\310\322C\214,\370\233%"
+	.ascii	"u\260\324Uu-DF\324@\224/\310\320$i\234\306\2024\276\024A\222"
+	.ascii	"\016\256YP\210&\2602\376\016\365\t#\330\233\363\225\241\326\352"
+	.ascii	"\t\f\026\335\262\333&b[\203\275a\002\363@\237\362\344W'\234\302"
+	.ascii	"\325\0244\217\366\2607W\311\376\036\217\3075\336$\233N\327>\374"
+	.ascii	"q\310i\0329=\373\222\037\300\315\237\236n\222\234\246\344\364"
+	.ascii	"\322\351I\247_`v\306I\360V\244j\225qTS\215d\024\"\177\272\375"
+	.ascii	"&~\224/u\242-3\213G9&\354\"ca\313NN\033\310\207\262\314\366\323"
+	.ascii	"\356\265\250\376\005\032& Y\265\326\b'}\0016\277dG\003T\241\036"
+	.ascii	"/\212\265V\t\2660\247\375\246+\001\372\320\305qj\r\264\305Y\333"
+	.ascii	"\303\007\025[F\337\362\\\2336\210\020\363@\237\250\225FJ\221"
+	.ascii	" T\345*Y\200\324\0212T\2664\251#S{\263\344\302\260\210\222\266"
+	.ascii	"\207:\003\336\2300NX\263\005\260\264=\223\317\251\253!4\275y"
+	.ascii	"t\204\223;\3337yl\310\026+\252!\255\036I\2336Ng\036(\333I\324"
+	.ascii	"\2722\366\226\367\256\035\307("
+	.string	"\272JP\036e\347\0131\211\235\235\362\344\315b\020V-\031M\037VE\262\253\344}O\371\315q\372\"4\273l\363|\252\007V\253\220\005\337\311\237\344|!'\235\302':\270\033\n\037\262\304\017\211\023:&\312\333\317m\0045nBnG\304\212\\\016\017\356f\"\307vb\347\326c\303\351|l\023\0268\207BGg\373\311\345t6\3310\350\264n\322c\374\226\212\\YA\333\363\202\204taq+\213\326\016\273<.\266\201\310\300~T\242Z\353\203\223\265\242\2217\327x)6!\331\374@Y[\002N_N4\317\263\030k\373\2222f\251\2516}\342=\334\250\\Y\275\345\035at\257\0164C\333]\272\037*\322\233G\253\335\317\020b1\361\250\252\306k\225\250>WW\205\312\334\026B,\0023H\250a,\245\004\320\020d\020\022\211\210F\3236p\002\221\261\263:\020`X\232&\303\032`\034y\350\276"
+	.string	"\374Z5`!\354\255\310\370\017\313\031\244\353A\016\024!\bp\371z\200z%\246"
+	.ascii	"\367\232\262:\213\326\260\331\305\300\230\307\321\371\360\021"
+	.ascii	"\360!zn\216\354\342\006ZJ\245\202\270\033\300}\217\246\020\352"
+	.ascii	"O(\234^\334\300\365.x\333\240\204\364\256\241\233\372\375c\211"
+	.ascii	"\251\203\216E\374d\021\275\355\200#dR\211\257 \325\"H5H\254c"
+	.ascii	"\036\206\3145%U\027\350\2660d(\272,\351\366\222\355\264%\034"
+	.ascii	"\374v^C\210*"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.71.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`%\001\345\r"
+	.string	"f\333`D"
+	.string	"\221(\035\3774\373\242\270a#\351\277t:0x\255\336\203\b\276\352\027\260w|\302\300EV\376\375o\365\3601=\336\210\216uc\242tU\240Z\301\200"
+	.string	"\3259P\317CML\034:x\267\215\354-eJ\001Q"
+	.string	"I"
+	.string	"N"
+	.ascii	"\031\030\260\320X\265\314vc\233\201sh\217\360\004\264G\345\360"
+	.ascii	"\322#\324,\371\001<\323\243F\303!L\340Ra\302\361R\220\003\006"
+	.ascii	"\345\305\306S\245\302\002\253\033\0358\036\nv\314"
+	.string	"L.\207=K<Uf\006dw\235,\017\303\255\335\366\003\333\037\366[\001!^\247\374\354\030*U\305\276~\337\367YS\354\277\376\214\3231\246\025\246S\323\007@J\321\272\340\375\205\305n\353\253\261+\242\213\007\333$\366\306v\346_$(`S('(vW\201\027h\036m\373,\007A\342\222\003\325)\021\362,U\250\246\r\037H\264\240\2528\243\251\234\354\345%n\202\344\257\370\003\002i\217\251\r\\-2N\336\002\026#F=\322\256\234\314E*g\330\026\271l\244\331\335\017_\304Gt\376\312\243+\210\362\254G_\244=^\017\373\001\230\230\231+\"\317\310\210\213\356xt\037\b\026:\016\324\t\221\300m\023>!\"['$\332<:\334Q\360\204\266\221\256\013m\233\330\351\360\232\342\303> \177\342\206Po\262\202\335P\277\244E-\261\0355\025\005#Y\213\300 \246\264\001ww#'3j{\002\025"
+	.ascii	"`\251\207U\020^c\265\232`<\200\2065df\024p\305\320\266\202\200"
+	.ascii	"\006\214\017\321<\024\234\207\257*\366\204\203Yg]\270I\306J\342"
+	.ascii	"g\306\257\232\032\025Sg"
+	.text
+	.section	.gnu.lto_blackboxGetLogFileNo.72.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375 \317\335\005"
+	.string	"\004\nm"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\317\370\203G\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\355\275 \361\201\205\030\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\356\001\221\216\217\230~\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\177\244\003\001\200\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\251'3`\236\031\b\016\3115\\/b,!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFreeSpace.part.0.110.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\237\001\035\017"
+	.string	"f\033bE"
+	.string	"\221(\035\223\313\357\330\372'f\374\245\302\177\210\b,\252\347\b\330\311\"J1\352o_\326~\0029\277\355\243Xh\344i\b\022A\367\372\267\007\354\252!@\033\374k\2508\370\t\251e\244\230\025m\177o\271S\nL"
+	.string	"N"
+	.string	"M"
+	.string	"\236K\025%{q\276V*\333~\212\303\260\330s\220\341\304\372\300N\264\314\320v\227\273\374\034\204s\031?\200s\251$\356]a\364\374\016\352E\315\2672]\037{\203\021\262\332\267\352p(\340\261#\262\273\366x\270\345m3\260=b\377&2\247)Y%n\013%\2330\264M\315\220\231\263X\261\n\201\371b\001\370\020b\206\016\332\356\344.==\320\276W\276\302\005j\264vw\273/S\362c\336\346c<\177RsW*\026\177z\273\364c\274/k\257!\007\f\205\215\335\r\271\264\202j\233\234\300\177P?)5\331\227\335\305\005\277\204\273\024\370\357\322O\341\\^G\\5\260\326\t\326Z\330.\331\306\363Z\325\356&\270Dpc\307\314\004o\240\276Xc\\u\261\243r\240\241\204~\007\272\026\270v9\324x\254\b\031\303\304\003\226"
+	.ascii	"20\022\205P\036\214F\244\b\037\026\201\272\022\b\030:\022\023"
+	.ascii	"Qh\002\tG\241$t\302\211H\0258\320\001w(#\022g\241\353H\334\366"
+	.ascii	"\270\352b\020\032\0206P5\352\006\333Q\037{\200\031\016\031\263"
+	.ascii	"\223\242`\300o\327\"\252/\266\241\252B\032-=6\370& p\002)\212"
+	.ascii	"\252\016\341\330\002SoD1\232P\370\343\204\250f\240\222\364\300"
+	.ascii	"\330\037\246\346.`N\320:\026(\300\355B\210\274\215\360;|$#l\367"
+	.ascii	"\237\215\240\t\257\013\323:0\2201'\024\321cK,\206\250f\240\261"
+	.ascii	"\207M\r\375\304\335\\\330\202\241\034\312\245\327\3421"
+	.text
+	.section	.gnu.lto_blackboxWriteLE.part.0.113.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\360\002U\026"
+	.string	"&\252\216I\320\360(\035Z\b\nM0PN\3724\350\034\243\370\376\206\364\0243\315( T\bEp\204\3432h\307\311\377\311+\376\265\031\027\024\372\221sr"
+	.string	"\203\\\315 7MZ\\q\372!\003Z\344\253j\255\006\342\023B6\221;\245w"
+	.string	"z"
+	.string	"u"
+	.string	"4\037Pk\320\215\251\326r\344\324\t\306S\227\367\bO\307\027\bO\355s\260\r\2539f\303x9T\217#sp5j\255\252\323\275\340\327Z\353\301\362\2463\366\220\202;\305\230_\363\020\024qhG\035\266\031\210\362\344+q\235\315\244"
+	.ascii	"0D88I\033\317\027<\340\343\315\350\260\335\200\036\264#\362\274"
+	.ascii	"O\035\233lN\217\213\242J\255\325\243\204{\274m\322\266\002{A"
+	.ascii	"\002_\372w\237\366\375\020\347\315\234\204\317\264;=\r\265\326"
+	.ascii	"\235KL`\277\275\300\352\223\202#S\247%&3\277\275\020\210;\231"
+	.ascii	"\013_\255\345\227\016\302\327\215\2009\344&\225\363G\210po\254"
+	.ascii	"\251\2159\034\221\257\326\232:u\3128s?\007\26398\274\3638\030"
+	.ascii	"XV[\315\353\341J\261\177p\317\250Z-\234`\252\265\236\214\247"
+	.ascii	"!\340\234/a\277\321|\224u\247\3469\355wxR\354\267\341\351\t\321"
+	.ascii	"\217\270N'c\210<\\q?\003\362\233\336s\3177r\313M\363\244\233"
+	.ascii	"\302\323p\317\373H\005\032\033|\300\245{]\316\r\233\371\363\334"
+	.ascii	"]p\367\305\354\306x\367\302\357\334\353N{\212\234f\031d\363\347"
+	.ascii	"\375\346\234pls\205\274\"\312\320\223\317\033d\037\367\243\306"
+	.ascii	"\235\026w:\024\247i8\r\276\374w\247\347\227\356\013 \220\372"
+	.ascii	"\251\225\366\263Q)\320\022H\001\254\313\304\274Z+\332\362zYy"
+	.ascii	"@\275\"i\261\026@h\261\270\254V^XT1\254\025\030\325\312\345@"
+	.ascii	"Eb\300\255\006-.\225L\253\345Rq\330\236W\261YY\330BL\0355\001"
+	.ascii	"\034\367\253\203\332\357\223\224R\354A*\362\357\270S\264\233"
+	.ascii	"\001\201\035\323\347\2650\230'\035 'c\205lk\274\177\017\322\f"
+	.ascii	"\236]!\373'\356\007\215\205\222\212\233\371d\272\256\243x\201"
+	.ascii	"\f\325ZQ|\023?\301\362\215N\355\002\003\023@\250QH\303\220\023"
+	.ascii	"\214\231HfFF\264\031\003P\002A\214\231y\020\200\251\312\260\006"
+	.ascii	"d\036\236L\33180\022-\017r\3478\326\305\313\030\302\200\320-"
+	.ascii	"y<Aj\\\365\250\030'\323\305\237\005V\231\3608\213\233\270\335"
+	.ascii	"^I\211?^\2439\240B\225\344K\025tP@R\223i\fQ\272\222r\024\b\r"
+	.ascii	"\211\337V\226\275L\317\217\205d@\032-\313$\031\304\305\204C\206"
+	.ascii	"\372\311\216\366\317d[\340\025\360\337\314\356\310\017j\363\226"
+	.ascii	"\006\245W\203\037"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.part.0.115.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"-\013"
+	.string	"\206\322F>\020\005+\035\200\367H\007h\003\260\002kB\355;\244{\022\230D\035"
+	.string	"\273\006\237N\177^pw\257\3673N\361\022Bl\336:\177"
+	.string	":\001 \362]p\024\337\270P\217\311>\332\323\310\336;\2451"
+	.string	"3"
+	.string	"9"
+	.string	"'k\373\232\334\007M\271\273\341?\252r\326\351\254,\177\332\334`\261\326\351m\257,\271\034X\214\344\363\340u\200\264\273\376\224\334\337m3\330n\260\017\021/RD>feU\002Y\033!09\321\321\225\273d\370\317\344A\236\177\237#x~\257\016c\212\263\323\262\273\340}\333h\203\340\277\273\330\036E\314\262\001\004\032\033\3630\027\354v\274\027m\315\330\036C\237\320?\020\312\n\350\265&\201Ii\246\365u\351\314\246\241\322 e7\244\300\200\225}\272\025\231\321*\222\013\304\243\342p\275\227r\003\226\030)\3704\022Q\017\034\242i\342T\2420\205\026\250RExJa\204\243\005\213\027\021\2510C\024S!h{\276.\235\331!"
+	.string	"\257\203\272n2\331\r\2454\333\236)\272\035\036"
+	.string	"F1sV\275\272\025\030\027\006\202\003\034\003S"
+	.ascii	"\273Qq\243\f\3615\203\301`K\333\"g\206\007D\3010W\270a\023\366"
+	.ascii	"g\210<\267\304`?\220\267ZQ2t\206\262\231\267\323\002p\355\301"
+	.ascii	"\024N\363\322k\313\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.117.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`(\001U\f"
+	.string	"\006\026O@ O\225\016$\001\004"
+	.string	"\b\204\tW\227\326\214\251e\003t\374:\356!\365A\367R\374"
+	.string	"wT\267\024\203w\2168\205sb\t\t"
+	.string	"\220H1(\224\304\313\301g\243\020\267\223\023\204\306\266\211\224)\005;"
+	.string	"A"
+	.string	":"
+	.string	" l\271x)\333\266\\D\036=t\241\316a\026\341\204l7\344\036u\303G\327\324F~~*\322\365\340\003\234^%\0270U\205\347\344Z\006fw\035\261p\307\333\036`\233\200}U\207PFhd\330E\315`\254\206\030\363P\3023\bS\222p\322`)d!dk\n)\341I\204\f\352\b]\024$\027V,b\016\317\001y\214|\003\362;t\021V\025\273\335\007={\263E\366\366\370\377R?LJ\262\217\342/\007~\0073\370\344\277G\377\243\361\364\372\200\001B\316L\330\366^D\\\233\332]\001\217\007/Y\261jA\312\030\251-\253vm\225e;\255NgL\007>P\361\360\246\322q\n<\3504\b6\231\004\032N\001'\323\3416\236\017W\001\340n\201\001\017\327\240\353<\334vm\225\345\203\237d\252\352\004\333\252\251%X~\273\306\250\266lK\362jw\272\f\037"
+	.ascii	"F1\003V=\262\305X\272\202A\034\bQ3\003 I\034\030\323\016+@\013"
+	.ascii	"9\207\3605\315\360\bo\3462@\024\fs\205\273h\"\377\f\221\347\026"
+	.ascii	"\006[\375\320\251\343m\364\325Z\234\013\326DA\235\366%5E\315"
+	.ascii	"\373\257-c"
+	.text
+	.section	.gnu.lto_blackboxEraseAll.part.0.120.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\355\n"
+	.string	"v\222E> \345*\035`M\330"
+	.string	"\004\340\341\021\372A!\024\207`\2131\033\200Rv8.'\236\016h\235\335\317\260\0063LP\013\251\315]0\252\001\030\003\020\373\206\f\n\270\\\303K\216v\357\275S\n1"
+	.string	"1"
+	.string	"7"
+	.string	"\017c{\001"
+	.string	"Bnp\273[O%\313U\227q\252\374\250\333\265\\\253\313\317>e\272Z\313e\362h\3609\020\332]wNnz\333\016\266!\354?\004\366\303\323\244\214R\bc%\004(*\003h\270\335\260\236:<\002\347\264\363\003\316\357\324e,k\004^v\327\273?\003m\317;=\214m\220\304*\273@o\271\300\346rc\311\225\215m\360\323\371\234F[\312m\025uQ\302,\347\347\312\227=\023\032r\273#\273\334\256PZK\rhT\210%\0022\003\344\302\030\334~\204\fv\226"
+	.string	"y\\\002}&Q\307G\232(\215(H\325\3024\252\250\245SF\005-\370\273\2108U\215\357;U\317v\374\\\371\262h\346\346!YR\302l\f\217\214\023\355\r\216\030\034"
+	.ascii	"F1sV=\251\215\201\263P\304@\n\216\321lm\215\200\021\307\327\f"
+	.ascii	"\006\203%m\213\233\031\b\020\005\303\\\341\200M\330\237!\220"
+	.ascii	"\347 \310\263VT\017\235\253l\372\355\\\0018y0\217\323l\351\t"
+	.ascii	"e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.123.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\246\0015\017"
+	.string	"v\232aF\360\262&\035"
+	.string	"c\374f\355\266\225\373\235\310~\276\f\334\300\303=\337\371/;\005\253\270\341\313\303\373\340\330\265ck*\351\306\024\203\340\016\357\366\325pB|\006\272\206\215\031\354\201\271\370\263\212\032\356\017\321d\357-S\nI"
+	.string	"M"
+	.string	"N"
+	.string	"\237\177a\373$\302(\273\307\301\326\222\310\200`\251\tww\373\214(\216\272\214:Q\376]\027\351\274\324\245v\036\211G\331\240Cx\"\200\267\222"
+	.string	"xXt\334u\375\340\251T\t|\206<\330]k.wv\333\020lG\260\337\023\236j\225\352kR\346F\300\313n\210X\317\262\346K\205\214\223S\344~`\253\3454\036v`\204\273\002\027\200\217\241\342\024\022\260\3252R\302\304\215W\270\013n\237\006o \373\324^ \373\274}\253|\306\016>\234\026\273\373\271\357:\331\237O>\316k\214(\220H\331\247F\021\257\206\305\213\353(\331\215\204/'\3741\242\217\366\t\247\357\214`\025S\366mN\003\305Oa\r&}\367\351\233\"\203/\307\305\267\242\261\031\266O%Z\311\247\332\214X\001\304GJ\203h\214q\234\227\033a\034\256"
+	.string	":`\021\210#M\340\300\231X\020\205.\230l\030H\241\223MT2m\240\004\3462\214J\333\006\216+m\037\271\021\306Z\016\027\330JT\275X,\005:1\230\034\240vH\244\357\374\035\035\0340UL9\336;l\314\260b\214\261~\224i,\321\360X)\217\003( p\202\231:\273\030F\230\001_\017\037\207\013\304\006\272\231\326\221c\215\030\233Q\031\001{\317m\3109d\314\026[\347De\206\340:\260\256\325\236Ov^\230\3266>\356\312fE\017\ny>\302\307\240\372\360\360\270\335\013\314\250\355rq\352"
+	.ascii	"\315)k\006B\355M\210C\223q\357zc"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.part.0.126.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`A\001\235\r"
+	.string	"\366\231[C"
+	.string	"\2614\035d\244\223C\366\002\356,\026\302q\006\274\037\177\021z\330Z\251,\371A\247\021\300\023\324\323'\204\241\241\240\0302\214\264}Y\262\273K\256\352\232\023\"P\211IY\351:\371\f\001!e\333\2262\245G"
+	.string	"L"
+	.string	"E"
+	.string	"4v\343\202SfP\235\262_\343\020\021\315d\333!\"-\336\036\275\022\001\0247`r\276\335x\235R\022\337\256\t7?I1\334\365\3610\306\207\031\235\r\0301\031\236\037\207"
+	.string	"Fv\327\225\206\233\272m\007\266!\330\017\021\"(\031'r4\257\300\345\020=\231\2170\361\331|\373\022\025\274\305]\260x\005$z2\036\033:\324\310\341\370\002\237S\325\007|~\263\234\205\033x\340\371v\327\272\0375\333\262[l\313\232\307\371\315\366\270%\2235\177\263\201\034\307g\023\312\371\232\352\321\251\320\201\341q\311\036Wi[H\311\223\374\027\247\025;\235r:\266\265S\345\255iw\023\234z\374\275S\315\016\227;Ri\254\360pu\306v\032:\255\232\316\343\374\257`\212\022\002@\354\226ztl\236"
+	.string	"2 \001{\2002\n\251\224d\001,\002a\243\b\0270\022\023Q\210\002\311\2052\n\235\\\242,\345\002!0V\241$\273T0,\273,\333y\270:\343\307\177\244*T\f\266\241z\304E;U\032\333V\246\332&'y\222\352\201\227\032"
+	.string	"\241b\353\254zg74\264\203\240\036\202\326\264\300\003"
+	.string	"\232\333"
+	.ascii	"Q0\314\025\256~\023$\250\020}.\220\274\005\020K\n\320X\266\312"
+	.ascii	"\336T\026q\232#\252\226k\242\240N\373\224\232\302\346\251\327"
+	.ascii	"\2261"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.135.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\266\004\205\035"
+	.string	"\206\265\270F\240\\Qc\354\364\300\22110/Z\274i\256\316D:\020\177@^\342\361\307-\331f\247\226\236\344U\311Z\210J\321\036r\214Y\277\336=\236\224\210/xb\234E'\235\026x\252\203\375v\001\326\356\275\367\226R\246\024\252"
+	.string	"\232"
+	.string	"\241"
+	.string	"g\242\271f\317`\217g\333o\362%!\3274\340l824q\223k\312\272\367\204]d\360\002\343E{\002\343\305J\344\265\347\274\\fI\216\242\255T\247\346\223\261\241\347P]O\307_6\302U\024\233\002;#\272'\341\371\240\256Z\205\245\353\361\270i\037d)\251\3611\274\036\366@\316\251\315\205o\220\204wDK\222\214Y)\337\225\241\231)=\036\037\221.Z\0137\246\200:XC\274\274z4\250\005\320\303Y\006\302S\033\275\033\2558\242\003\341\031\215\002\356\275\256^\316\322\001\327!c\367^\337\366\343\006p\333gl\203\260-\212\276\323\247"
+	.ascii	"\371I\027]\"\210^w\321\017\252\027\336j\371\252,qb\243[\264\002"
+	.ascii	"]un\357\275\327U\210\355\242v\231\324fI]\232\324dI=\376\374E"
+	.ascii	"\223\332\226\324\225\244\246#\365\007X&4\001|\367\356\266\336"
+	.ascii	"\334\237\210\345H\024\232_\330kt\006\213\002\220\021#\265\224"
+	.ascii	"uo\247\204\246C\201\341\027\b\316`\221k\307\321T\030\237\345"
+	.ascii	"\355\033\306\207\306\340\253\242t\357}\335\027\322\354\227-d"
+	.ascii	"\277\\\351O\332y{<W\372'2\254\200{\013b\004u\357\245p\321\025"
+	.ascii	"\312\213vMJb\005\212\325V:f\b\246V[\307\247\\\234z\237\367^["
+	.ascii	"\201\0261\326:\033V\335\250\226\355\020\247\022Q\336{/\370bf"
+	.ascii	"\214\360\223XT\323\211\377\345`X\370I&\301\3033^\244u\346\273"
+	.ascii	"\262\304\310F\267|-'\263\360\262\256\206(\034\327\277V\240=\345"
+	.ascii	"w\261\325\331\244\361!Y\251->\227\252\345\376w\231\216\220<\312"
+	.ascii	"\307b\253\362W0B\225\301\313\273\277\343j\025\325\222\322\375"
+	.ascii	"]\bVl[\275\315\317\207t\357\320}\366\237l\323\254\250\356Bx\375"
+	.ascii	"p4\216\355\236S\371)\357\275]\b6\261\263\240\005\220\013\031"
+	.ascii	">\242\177vdA<1d>'~zP\370\300T\004\365\244\200\375\314Z\300v\034"
+	.ascii	"X\266\002h\006s!\223\315`/\333\364\366V!6\220\313\022\207\244"
+	.ascii	"\257\2159r[|\342_\033]\325"
+	.string	"\206mW\245\225\250\214-\024\2639\t\350\204\333\0338\320\353\3743Z[T\267\0046.k^fY\315\016%V\324U\232\"\327\204]\221/;;\034Vf\005\232\254b\235\r\303\214\225\254T\315\001j{\370@\257\033k\315\322\362BET\207|\250_\370\007\265\246\250\312\247/\331\2308\221I;\"o\244\334\n\304\365c\005\372\216\321!\234]\250QH\242\224B\304\210\224\210H\220\244\032\016\200\002\031*\263m\021\260=c5I\222\375Z\003L\224y\276\376jrgG*\320*%+\220k7\2303I\352\340E\216\367\216KT\246h\306>\223\006\315_QKv?\024\211\227\034\237\353D'2\r\266\346]\206\334\353H\273/\241\207\013D\230\313\327\023\331\326\232\256\344W\251\326\013He\202j\005\210\030H\r\245\355g\364\031\301\347:\361\250<\332\276sp<\345\b\366\321\226\300\016\250g\330_\370e\2061"
+	.ascii	"\031\341\353\206\214\336\237\204\317h\243\214\321\331i\234$r"
+	.ascii	"-$+\341\021\247Y4\364\020\222\365\361\320\033%\031\202\2623\032"
+	.ascii	"\262X\275\034V\310s\370\310v\361\r\326<*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\360\b-\035"
+	.string	"\246l\242Bp\252\315pW!\364T\332\2560\251\343\231A\230\360\300\242\307\320fQ"
+	.string	"\321;E:aK:w\333}\212\t5"
+	.string	"P\004"
+	.string	""
+	.string	""
+	.string	"P\311<V@\030\376\273\301&\t\216\250;\255\367\004\247\337\335\344\226)\221"
+	.string	"\213"
+	.string	"\221"
+	.ascii	"oL\017\r\314\016W39\364\325\206\246\240\241\203\031\332\nC\177"
+	.ascii	"\321\205\236:Z\027\232\026\013\035\241B\037P0K\033\333V\003\265"
+	.ascii	":\252,\360dfA\231X]%l\t\245\232z\271j\037\205^&e\020\202i\325"
+	.ascii	"GT\3257D\325'\264N\350\013:\247\372c\312[\232\246\251\204\376"
+	.ascii	"\237R\312\t\330dF\370E\335\f\352e\346\323\203\005\277\2531"
+	.string	"\235\230\01655U\311\377\256)\223\224\371\377LU5\375\372\373'\343ZN&\223I_O(\377\033\371\ty\220\364\221G\372v\214\364\351\024\351\263!\322o3\244\357FH\037N\220>\036 \3758?\372i>\372wz\364\305x\364\315\354\350\367\321\321_\313\321\2573\354\317\301\321\227s\243\217f\243\277\246F\177\017\215>\237\031\3751\031}41\372d0\372g/\372i6M\323\237\347\242\177f[\364\313\224,\372a\212V\364\301\312/Q\341\300L\321'\203\242\177<\3217\232\350\213)\321\017C\242\267F\264\226\210\316\n\321X ZX~xS\266\024\222\202\036\310\322\306f\206\032\340]\333\245\362u\344*Q^\343\256\327\227*\\Gy\270\345\223\265&j7&\261\203\275\215I\272\230\035\343\212\37336?P\256v\234[WIM\003$\334m!\361\"\367y\314\300Xy\030\244\254#\036\356M\353\bK"
+	.string	"g\b\300gqW\307{\334\325\361\252\2739\035\017sL`-9\t\271\007\273\343\305FU2n\255*\031@\321\252\344\363\270\333\205\326\225\026,\371D\356za\341\023h\352\254\244\257'I?_\342.\225\257\243\223\235\024\347T \343\324e\024\310\247\261\004\256\341\322U\206\002\333\256$\301t\300(\035\024\253\rr\"v\263'>\313~\274c\2770\247\245&2&^\344\321\370x\211H>\336u\f\002\257z\364\200\013\254`\275\001M\316\332\036\326\343\035\262L\217qE\261\036\237\353\276M\227(^n\246\307{\246\307[\300'\031\336\nW"
+	.string	"\217\031\240<^b"
+	.ascii	"\005\n\370\302\022\357z\\b\006{C\023\360iD\240\304\247\272Fb"
+	.ascii	"\306D\250\022\237D\004\001\200\223\250a\024G\272\260\244\240"
+	.ascii	"(\231\326\300\002\231\"\3426\021\220\034\310\2341\002A$\220@"
+	.ascii	"\2029\221\007@t\225\022\224\311\203\326\220\017\362\256\004H"
+	.ascii	"\"o\250\361\004\377V}M\273\"@\214\233\235\312\343\355cQ\262p"
+	.ascii	"KA\003e\331\217\343q\316'\b\261K\321:d\024\254`\216\020\271\225"
+	.ascii	"\370\206\203\233\037q\243\374\016?\223vB\234\231s\t\337\323\334"
+	.ascii	"\005\004\f\267\332H\031\024+\260wy2\235\355L\350(\363\271\226"
+	.ascii	"{\245\t\t\260\207\3302c\230>Ow<\3579\235w\270\337t\236g|\257"
+	.ascii	"y\036\367\270=\177\377-y\034\331>z\250\\\330}\216\251y\221~p"
+	.ascii	"y#\031\325\003\f\335\002<\321\202\356\227\004\013\217\231\221"
+	.ascii	"\274\b\264\bh\216c \021L\036\026N\367\305\235\260\367\313M\003"
+	.ascii	"cL\266-\020\350y\220\303\242\b\2204\277yO\335?\304\241\006\301"
+	.ascii	"\335@L\fqS$\032\327 \305\316)\"\326\302\301\226\031\201a\271"
+	.ascii	"\002\271\026Rf\374\211!\326\rVc\250\211j\025"
+	.text
+	.section	.gnu.lto_.refs.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\205\b"
+	.string	"\206S5*0\245J\322\001\300\300\300\300\300\300\300\300\300\300\030f\273\214a#\226\031\245\243\333T\337\264\332\362\204\320t\254m\255\021\262\367\226)%"
+	.string	")"
+	.string	"+"
+	.string	"\321g\324_\236n\201z\005z\312\323'\353%\354\022\374\207\372\225\257\260#~\222\035\355P\177\265c\277}\365\r\020c\373\265\267\035\300S\035\271\025\344SU"
+	.string	"\003z\363F?5\243\003\300^\021u\212\247O,\272\304\342#\236\016\261\236\203\257\t\223\313\263\251GTo$|\004\351e\2650*\375\362\003\203C\351(}\261\236\354\002\002<\245N\360G\272\227tg\037Y/[\242\002\217\355\341\206\344?Zw\264g\344c\333a\r\265\236\355o\272\203\037\273\201S\206\333h\272\240p\231bzg\352\233\251c\362\021\246\036\027"
+	.ascii	">\227\264=\203\345\034V\237\005`\b\214\245t\233\271DW\212S\206"
+	.ascii	"\3352\366Z\254\244\314\352\326`\013\013\327\224\001q\233\nP\314"
+	.ascii	"S\224\223J\317\350)\201\376\203r\006"
+	.text
+	.section	.gnu.lto_.decls.90fdaa5804a29bd7,"e",@progbits
+	.string	"(\265/\375`\332>\345\374"
+	.string	"\312n\351QU \fI;\215\001h\321E\202\261\222h^\213\b\326\242\211\322\223\360\244\273K\322\266\306\325\371E"
+	.ascii	"\300_\224\247;\210\236\201}0\201\275>\212<\2177\007d\327t\244"
+	.ascii	"\032\234\207\240,:\315\303\n\346$\035R3\032\273\033\250\265R"
+	.ascii	"\355\266\366\325:-6\"\245\224)U\004\005\005P\005m,N*V\263\306"
+	.ascii	"\376\356`\216U\274\362\240\260~>c9d/\366\031\213}\206b\237_\260"
+	.ascii	" .\006#\016\322?oo\324C\314\342\030\310\210\007\266\315\260\306"
+	.ascii	"@0WjI\244\260\306\321{\227\250F\027\207\365\t\377g\241\310\215"
+	.ascii	"\251] {\234\204\275\365b0\336D*2\246z\376\320\330\337\353\255"
+	.ascii	"B\245\205\n\226]\241\223\343\336\026\270\340)\361m\254\217\177"
+	.ascii	"`0$d\367\n\323\n\303\b/\223\353G6\024\270D\217\350&\3013R\200"
+	.ascii	"\223\240+x\245\334\301[x\241\334)7\360F\271\327Kx\001\365\315"
+	.ascii	"SRT\375\332\273i\331Z]\0012m\021\270\267\365\022^\272{\227\255"
+	.ascii	"l,\013\262\243\300k\344\310M{\201\306l\237\274\245\352\336\326"
+	.ascii	"\177\220\200\017.\341\375\273i\367ni\347<!%\304\255\275\2552"
+	.ascii	"\034\034\265\234\350\200d\320\307E\3541\224\3755d/\337\355\273"
+	.ascii	"\327\016\267\t\213\036\024\247\263'\354o\007#L\007\343/\035\373"
+	.ascii	"[\204\375\025\302\376\354\213=\333\245\2627r5\030o\335\265\273"
+	.ascii	"\327\r.\222_\271;\367b\217u[\261\025\225 d5\330\337\r\21491\361"
+	.ascii	"n`\374=bc\256\006#\036\001\373\300\253\241\310\0050\326\030E"
+	.ascii	"RD:\270L\321\363\331\212\033R\274\312\r\332a\335\006\023\025"
+	.ascii	"\223!\003\353\337/ \327\354%\032\263\243Sk\325\013v\333\256\365"
+	.ascii	"\232e1$\026\310\224\221\300\275\267\333}\273l\367z\333\376\253"
+	.ascii	"v\327."
+	.string	"c\335;m\357}\005\374!\332\356\331\035\"\002\biG\311\360\024 V\007\004V\270\267\225\003\016d8\310NbURX}\367\325`\214\371\035\362_\257\373u\323r\020\221t\237\355m\275\200\363\352\210|\260\276A\256\220{\275\340\242=\001\037<C\307\366\327\336V\030\227*\\U\016\261\276\t\366\367\002\343M\274\027\030?\002{\021\330+v\307\356\365q\267\354\367\307\r;K\324\272\257{o\230[U\004Z\205\365=`)\300\333\373\203\263\260*\366\336{\345>\316x\314r\270\032\214\372\356j0\336z5\030\331\213\301x\200\r\312\262O\006\200H\240\204\037%z\350h\235\3753\004\300\2608P\225\302\307\327\217\273Np\340?\3765\314\177\303\360\216\257\373\003\252\225\202f\301:\256u\227?\037NW\376,\345\307\"rl\020\201\377FU\247@\001\234!lR\266\241\354\365\260\340\307?\253 \202'yZ\026\324"
+	.string	"\352d\375\267\3751\337\177\3730\r\306\361c\036\253\037\257\270\221\374_\301-\201\251D\374y\355\252\370g\264\233D\372_\034\270\306U\336\200\005\025\020\302O\207\3713\f\354\204\233~\034"
+	.string	"\246\037k@\003s0\003\177X\372\361\0072\376\003Bq\f\f\343\177\001\376\313|\003\374\342 \376|\301\217\225\210&\370\257\001\ru\026\376\354\365\277\355\277\333\377\265\244\377\242\330\300\177\013n\314\237\217\340\026x\350\027\376l\003\263\370\257\004\336\362g\250\037W"
+	.ascii	"\350\307\027\3709\313\237Y\3748\372\343\236\037\357\037\223\340"
+	.ascii	"\307\"\370q\b~\274\302\217\227?F\376x\346\307\034\370\361\006"
+	.ascii	"~\234\201\037c\340\307(\374\030\305\217%\360\343\023?.\361c\022"
+	.ascii	"?\036\341\307\016\370q\003~\314\200\037\203\360c\020?\356\340"
+	.ascii	"\307\004\370\261\005?\336\360\343\225\377Z\177\254\377\233\370"
+	.ascii	"_*\377=\374\357\224\377J\371/\341\177\361\376\013\345\277<\376"
+	.ascii	"\373\344\2779\376\013\370\337\277\3776\371\357\336\177\227\374"
+	.ascii	"\367\352\277\324\377\346\375\267\356\277r\377\235\373/\334\177"
+	.ascii	"\205\374\367\354\277d\377\025\373\357\326\177{\374W\353\277X"
+	.ascii	"\377\255\372\357\364\277R\377\255\361_\247\3772\375w\306\177"
+	.ascii	"e\374\027\306\177\225\376\213\364_\243\377\022\375w\350\277\036"
+	.ascii	"\370\257\210\377\372\374\027\372\337\022\374G\362\337\021\376"
+	.ascii	";\342\177\223\377l\377\265\340\277\354\177G\360\337\025\377\321"
+	.ascii	"\376\233\366_\236\377e\377\375\300\377\024\376\273\374\257\316"
+	.ascii	"\177U\370o\212\377N\340\277&\374\227\001\3775\361_\022\376K\342"
+	.ascii	"\277\r\370o\b\377\247\374'\362?\356?\334\377\267\377)\376\203"
+	.ascii	"\340\377\334\177\r\022\023\023\023\177\013\032\374\026*\360\033"
+	.ascii	"\300\002\001_\354[\240\252Y\253\232#\307\332\331\005rU\373\302"
+	.ascii	"\372-H\354Y\n\2552\226U\276\302\201#_U%\032\317\342\304\304\256"
+	.ascii	"\260 K\016\035S\"$\354Y\302\250r\025U\246\332\260\221\251,\364"
+	.ascii	"\006Q[\352\300F1\004{\303\232Z\304\333\201%\004\353\263X\261"
+	.ascii	"gA\202\312R"
+	.string	"Pyj\334\373Z\245GHQQyz7\322\336K\033*\310\201k\353\204\317\323kf\374\371A\345*d\317\036\251q\3155\356\035\216\331Q\037\2725'\247\274\365\\U\214\211\251\216k\306\fL\366btKmU]rt\225\371\350\220q\3152n\332\035\333G-,\222\242\004\013\3676\322\201\246\002\250\307\036\261\317.n\206q\3150p\227\214u+Y ;b{\330_\334e\374\263\222R\356\321c\333\305\313\224I\t\261p\357\245\016X\244\302-\037~H\327\214t\375\264u'\265L\345\254\035|e\211\221\221\r\032+mD\277\327Lt\333:X\267\213\366\310\356\340+d\354\363O\006zfq\315,\362\020k\335G+S\211KH\035\376,\364<\344\362\":'\004\353\034\204\327\\\022\r\023\257q\032F\233\327J\026\373\377\327\270{\220\366\336JE\353F\3629\376\026\357\355\360\273\334|3\370\257w\376/"
+	.string	"\234\275\241\204\205\203\254\216\265\036&\016\373\277\333;\032\005\205@TR4JF\3205jC\243X\320\013H;\n\032t\335\373\302\216F\241$H\367\205\240\353N\332?xIw[\243\240;*\335\027vt\367p\b\212F%\005]{\222.\004]\243\222\3665j\307\354h\017\222Pt#]\330\327\250'\373*M\212\t\272J\223\202\256QO\367)\310\320.i\260p\312w\241\202\242\333\250\250\251\007)\346.\310*\335L\366\276g@\033)\203\275\233\244HLzd\\6\237;#\237\264\036\351\335P\3443\225\356\350]\320\016\351\336;|rv\221\007P\353\335\256\272wP\251\246M\004\2647"
+	.ascii	"\212\366\206\336}\267\367\206\356\275W\220\232\254{\323\210\t"
+	.ascii	"\252\026\025\355\275$S\264\233\240m@{\343\263>\266\244\240\353"
+	.ascii	"T\032\242\315\354Z\335,\254\320\033D$\335\325\315$\n\211\275"
+	.ascii	"B\3056\021\024\266\232\344B\020k\263\354cTR\325\326\207\310f"
+	.ascii	"\250n\252[J\322\004'\332L\001\201\303c\361!F\274\327\317a*o\221"
+	.ascii	"\222\203\203r\204}\t\356\347\f\247x\275\240\302\301\322v\310"
+	.ascii	"\003\206\224+\226\202\323J\260nh\213\017\037\320`\341FB\352\340"
+	.ascii	"\3062v\020\023\276DiAX\244\312\016bA\214\237`(\307\2028\360\030"
+	.ascii	"\305\202z\357\236{1x\271\027\203b\334U\017\231Q\337x\003P\246"
+	.ascii	"\tb\235\235\223?5\256-/\254\377w?,E2.a\213\326\371\341&0\230"
+	.ascii	"d\201a\335g\215b\240\343\210\023\3267\312`\367p\036f\202\225"
+	.ascii	"`=\274\344^1\037\276;Nr\301\256q\021#"
+	.ascii	"T\252_x\211T\330\316\3470\220\017#1\f<\"\207X\305q\230\017\023"
+	.ascii	"\201>\361 \354\016\260\212\f\214\333\f@\273\027\375\342\036{"
+	.ascii	",\302\261/\002a\361\034\246\273W\031\\\207\347c\324\204\365\213"
+	.ascii	"V\266\004;\361\312\030_\304b;4\261 \212?\254\210\253\001\356"
+	.ascii	"-\310z\341F\263\322\306\260"
+	.string	"\306m\330\355\370\r\263m\374\346\201t\357\036\374\006\203\270w\017\314\275\030\334\213\201\356\232f\t1\352\027\367\032V\313C`\203k\326\257\343\321\221\225tH\332]\032\026\202\321nZ\007\366\216\352?\036XBX\307\354}1\030\361Y\210\343 \307\241\241\034\203X\337D fdr]=X\233\225m\300F\337\320\276\256d+,-\375\300\372\230\f\217]\351\256\340\305E\331\026\r\254q\030\266\336\353\006,&H\365I*dI\260\367\335`\274\211\211w\203\021\203\2058\376\201\301\210\264d\335g\"XIua\235/\006\343\206\025\037m5\250\274\272^\234\2145\201b\315\345\343\206\215\"Xo\025\267\252e1\232\260P\037,tDf\025\030VT\243:DD\255\202\265\250r\321tx\021\3616\312\303\222\201i\b\3113\n\214\261\364\204\243\\\370\264\200\366\374\017(\017\207\332\213\3537e2z\302GT\214\204\225D"
+	.string	"!\261\264\310s\n\304TL\265\025\030\206a\320\300Z\030\013\373\300;0\017\334\003\343\300VX\007\276\302U\270\212s`\0338\353^1\025O\217\245\360T\364\013S\357\036v\272wg\273G\211C\0166\275\257\2271\034E\326\f\3645\031k\334w\272\007\373\343(\25031\277>\253\326\332[\313\222\342\032\377\2261\376\310\243\312M\261\327O,\023n\202\221R4\250\347\202\t\3178\356P:\302\302\372\372\007/]\217I]rO\214\2725*\354\363 \373\274\307>\313\261\317\001\326\266\037?\020\217\230\257\356X\024\026]!\016)\342\216\254\302Bm\250\266$+\3608%\374\t\233rm8\210\350\266\201\320\b\f\324Q0 \005\254\262\365"
+	.string	"\037J\3124\341u\224\034\005B\345z\242\007u\004N\255\rj(wr1\242\3726\234\311%\t\342\273"
+	.ascii	"\374\005\r\321\360\223\227\247\235\034\251\346\037"
+	.string	"Q\336\354\376\256\235\334\340\"\342\201\265\346\323~\227\"\205D\007\326\272\311\275\002\251:t\242\373\276],L\261\235\365`\255\231\340(\026\312\244\324t`\255\367\260PU_W\020\326Z\357\177Q\251\034sX\353%\327\017\346\353\311\355\b\326Z\tv\272\207lzB\230\206Y\325\222\037H\222$\3511\226\255\311\025\245!A\002\250\205E\307\002}#\022%\254\256\216O\013\327\021\t1\303\232\233\313W2\322\334\244\307ji\353\205\352\351\311^\323\221#\031\357\216\271Y-\025\256\020\021\221f\020\202\203\323Ed\244\320'\"\200Y\001\253\024\352:i\333\020\221\353\"z\252\341|\334\360\260\326q\367N\311\336\0275\312\220$fC\006\327\326\264[\230[\227a\341\013\324\257\205T\333\265\233\346\373\021r\301\246\327wx\307\006\365c(w\205\0332Ds\271a\321\025\3420\2430\265.4\264L}\300X\227a\016;\314\303"
+	.ascii	"\004\004\210\016\262\001+`\225\255\334v#\321\360\354:H\013\025"
+	.ascii	"\023\364k\372\273(Q\316\242\224\225e\252\2144\357\tb\321m\265"
+	.ascii	"\240\022\023\202\204\214,S\311\250J\210N^\020\376\270\205\205"
+	.ascii	"i\261\024lz_[\026\230\250\225Q\265\365Z\314\205-\306\r\265\036"
+	.ascii	"``\031\357J\013\213\256\360%F\025\245\026R^^\232k\f\213n\213"
+	.ascii	"\357k\307\004?[[\232K\320j\351*\271\231\361q\365\371\270\313"
+	.ascii	"\002\324\322\322=.\232 \026\235\213\236`\013B\315\343\272G\030"
+	.ascii	"\233\341\035\326z\007^\243\272\242\362\201\265\326\321AW\rE\005"
+	.ascii	"\005\271\272\322U\031i\346\303\263Z\332b\3213\362#(\353\272\352"
+	.ascii	"\322gwd\210\265\306\302kzR\322\372\374\354\216\020\r\225l\334"
+	.ascii	"\206\266\002q7\013\2632\243@c\335T\b\355\306\265\325\365;N\345"
+	.ascii	"\341\230V\035\255\320\355\244\212\312\"\350\327$\372\342\303"
+	.ascii	"T\275\260\237\236\364\224L[\240\336\027\013\027\375\262!u=E5"
+	.ascii	"\305M\252\247G\204z:\246:\312\210\321\234\325\326\246\201\006"
+	.ascii	"wDC\341\351\361i\212\306\036\326\272\306\023\246\237I7\031\203"
+	.ascii	"\364P\321u\3206\f\301\372tS\336SfH\251\254\261\027\272.\022\322"
+	.ascii	"3r\336qC\307\366\321\nZ\3274\260p\007-uxi\001\0305\245t=\343"
+	.ascii	"z)\001\037\374oIef\206\265\226\361[\005\305,"
+	.string	"\b\206\216\221\303/\255J\225\325/\020\340d\b\205\330B\305\273\342\2015\326I\377\303En<\234\260\326H\007tI\023\2436\351\243l7\315\363\301Z\033\275\270\261\b2W\305\352\026\327D?\013\213\333\323T\024\024\373\353\241\237eE\210\036S\265\211}\f\f\r\244\2014\013\016`\177M\035.\330\325\256\207fa\307\256\021\252\261a\375\230\255\241\032\252\243\r\250\0014\270U<\002\342\362\322>\327\321\027.\303:-\254u\017^+\366)\3311`\364\022\023\257\231qZ\264\324\301\221\311\264\312T\033\025*\231j\304+(\320\250\244pIP\307\341\241\b\\\200\325\225\350T\n\006\323\224)yz5\3402\002\032,t\201\022\342s\201\365a\200\244H\311W\354\246\313rPkV'\204\204\371\212\205. \353\350eG\005x\004\n\224\017\302\200\006\267X~\216\020\237\306\236<\311WY~@\203\205/WAE\206r"
+	.ascii	"\002^\277\022\244=J\004\210\203\022\f|ibQ\364\002\364g\335G-"
+	.ascii	">C.y||\271I\t\322\255$\202\216\246\016X\252\037>\260\334w\315"
+	.ascii	"\254dpX[3,\3710:\262\267W\b4\270\325\200(7\253\331\222%\371\252"
+	.ascii	"\t\332f\362\362\233B\222\363\220d\274\273\273\214\227\201\007"
+	.ascii	"\340\221\307\332\0274'y\306\303io5|`\301\343\220\322\333\023"
+	.ascii	"\326wAb\177\034\254\253\313S\\]1\233\002\fL\034\2122%\217H\236"
+	.ascii	"#\222\345\212\024\311rw#\225\r\271H\001\021u\034y\2263NU\031"
+	.ascii	"I\261\316Fp\225\242\036\227U\354\215\375\361\313\315-\303\335"
+	.ascii	"\275\247\262\0025xz\002\365\366\f\027w\245\354\030\274\201\r"
+	.ascii	"a|\034\266\320\243\262jj\231"
+	.string	"\315\001d~\201,\242\224\032Fl^nV\031i\305i\024\277#\215\264\264\307\255\370\364\0357+DH\246\336\2753\337\023\320\340\026\f\321\230]Y\223\262|\306\356\275\227 \251\306Y\243|a\235\3172\342W\225\r\353lv\207\034\353\300\230\202\214\260dd\231\312n\262 TjV0\264\256,\326\225\255^^\331\nE\004\257\303\243T\365\211Q\376z\266\3460]\365C5\207u\376\261B\204\025d_e\260kf\344\333\001\305\002\353[ b\337\242dk+G-\220-\265\260\355\310=v\360\340\021\242\bhp\253\205jE\215\0068\311\233%\223\304K;\323\222\363D\352|X2ut\2305\313$\262\371t.\2315,\317e2\3138OdXa\203lQxi\227I\235f\373lm2\2643'(X\266;\314\027\233v\207'\305\004&(P\302y\342h\323\332,\2237\031lnN8\221\255\262Ea"
+	.ascii	"\033fv\234:\316\366\211\254a*\225#\3548u(HQ\003\263BI\3013\271"
+	.ascii	"<\261\342\271\243S\342\231\324q.\221\315\024R8\223\001\250Y\256"
+	.ascii	"p\216p\241"
+	.string	"\331\336<\333\b\b\3409\036>0\2232\316\233\034'RysT&o4\270\240\"\205\0137<#^\236\343\001"
+	.string	"\316\244R\231\3241>\307\203\363Ck\303\243\254Y&?4\235<\037(P*y\226K\346r\3459c\004\001\263\231\363d.Wn\220\255R\257\330\251\321iu\214\314\t\264\312\244\211\r\317\026\307\206'\307\231\\\266\312\235\026\205\n\232-\215\016\317\004p\230&<\333\b\340,\223*4\231\030\250@\251\3441\221\001\207i\202\315\bg2\3469\036l\222;\037\23698I\345\215L\253\3034\301&y\302\263\305i\"\237\027\220\315\366y\242\331\236\340l\237+F4[\025H\024\0318Y\332'\223D\006\034\246\t6\313\022\001\260Y\226\200)a\3023\205\t\033\236I\035\035&\211\f\313$N;b\202e\273C\201v\306\311\363D>S\\\300a\205f\353lQ\330\340\204\326\311T\222\210Q*Gh\235\310f\t\231&\323\304"
+	.string	"0\3448y\224"
+	.string	"\250"
+	.string	"\204\207g\023\271\343\241\255A\356\244h\333\246\t\001\250@\242\240\241aq\242h\"[e\315\323\2114\201\206\306\305\271\303l\222@C\263R|\216\207\0176\312$\017\315\006\034\036\232\326\206\345\250\323>\235+Rhp>\223#hh\214\3553\331\304"
+	.string	"\t.6\313vgg\204\026\007\251s\3425\311f\273lq\330{"
+	.string	"\002\002@\020\241b\345\"B"
+	.ascii	"\021\002\b\343E\204\020\"D\b \204`\017B\210\334\316\340,\223"
+	.ascii	"MdN\212\347s\306\211\242\325I>\331\347\214\007 \230\300\320\316"
+	.ascii	"\230\310\240d2G\314\024\237\0230\223\025\254h>[\235V\331>+\230"
+	.ascii	"@\005'\022E\315\222\347\346h\334q\3528wp.\250hm\226'\332'\262"
+	.ascii	"9CA\023\231S\243\2373\037\234\315v\205d\323\306\202f\233\274"
+	.ascii	"I>\227\255M\262\3059s\274\300\263\311<!&\205\025\214\355Lk\303"
+	.ascii	"D\321\322\316P\340\331d\356\2708\227\314\344s\207\271\322>\221"
+	.ascii	"(\330\360 i\3306\004\311\024\354\223m\036m\220m\t\312$2\205f"
+	.ascii	"{s\3033B\305\363\270B\262\255iQ\220iA>\221$\250h\2764\237'\234"
+	.ascii	"P\"\223\315\326\251A\205\032$\215R\211$\321*m\222\307\347x\030"
+	.ascii	"\200s\006'y\263d\222\210i\237\310\346L\253\334\321A:-\2645\311"
+	.ascii	"\025Z\033\243\nN\244\316\214M\253\244A:\22363N\033e\233\274\311"
+	.ascii	"\320\3320u\264\263\325A6o\216K\244\316\315\rO\316\214\n5L%\215"
+	.ascii	"\213\263\311|\326$m\332\346\316L\273B\362\271\203\264Abx\316"
+	.ascii	"\200\020\202u\352\300\350\3544\333\231\266\311\363\334A\326\314"
+	.ascii	"0\233+p.<\2033w\332\346\207'\223\331\374`\3419#\342\271L\362"
+	.ascii	"\254 \237H\033\335\206 \351\324\317\231\004(\340\271L\256<D\b"
+	.ascii	"\022\034,0\201\b\2605\036\230\311\031\025L\032\025j\220J\232"
+	.ascii	"\017\313$R\347CM\323\371\301\003\0069O\234e\2534\206\351 SN\350"
+	.ascii	"\252?\304\330)q/\246\024\301\212_t7\374\312\260\266\246YXR\315"
+	.ascii	"k\352\321\243\330\225A\036\223\022b\261\253\310\345\346\264\261"
+	.ascii	"\270\212['\354\375\024fh\313O\342aS\321\307\005T\362\362#c\377"
+	.ascii	"\"\217l\235\222dX\334q\315\262\214\262\b\261>\366\tAB\250\245"
+	.ascii	"\271`\204\236\234\034\346\310S\24270\037\305\252\023\261\027"
+	.ascii	"u=Xk\0379\027MX\271\311\361\251\352G\357*\312n\301!\271\341\320"
+	.ascii	"Q\330*\262\256\253\2256\024\234\321e\004\353b\225\205?\253\266"
+	.ascii	"\251\255\"\265X\214*R]\244\003\024Q\0224,\334K/:\374\305\251"
+	.ascii	"\027\251\342\212@~\203xX\027\245\036\307\036\006\tS\202uq\372"
+	.ascii	"\270\2259\273i\r\027P\031o\0239E\245\371j\204 \321T\215\241\226"
+	.ascii	"&BnpO\367\316(\343"
+	.string	"\347\020\315)\357\234\225\304\020\332\324\224\347\326x\370`\232\322gi0\244\320\260jY\242\202U7CWa\264\254k\204K\272\007\330\233`TF\3561\216\331@t\021\343\372\005qr\327\002\353\342\213\027\273==&X\237\202#\366/*\275\350B0\006\024\023\326E\244b\222\217\252\020\276\353\377\234\350\360s\373\201u\321\250xD\255\006y\303\372\201H\205;\n\373\212f\030y\035R\021\311\031\365\322\306\320\260.\n\025\207\376'\007\261d\225\026\211\004.Ia\375\022\334?1\006ej\220\031\324)\326,\334P<\261A)\002\025\311sb2\003\353h4Oe\330\375\245%\027X\254\222>I\243\024{\212=JVK[Wm\357\332tW\334\305\235\257\252\306\254\226Z\364\2400\300\320\252T\311\324!xY*\205\321\250\223C\264\211\250.\225AJ\315\214\214$I\322\001s\025@0HL*\025\f\334\336\r\023"
+	.string	"S\310#\272\034f\2251&\"#\242IA*\205a\f\346\240\030\331`r\206\250\254\203w\371\334u\374\\\005\240\347\257\230-\310\020\357\327\252\202\307\314\\\305\335\236\266\246\310\365\234\362\212\003\220\203\3367QN\221`\337\002\300x<B\330un\t"
+	.string	"\t\033+-{;p3\232N\206\303\366\354\317\373*(\214\210=~\326\2053oj\226\275xJ\335\321B\350N8p\022\276\022\313\261\"E!\253\207\214b\013K\271\033H4\274GA\f\201-\375\333\034&\346\262\325 \225\032$R\216\345vj;[\020<\021B6\241\210X\255>\212\004(F\240\350aHC\224\245\254\n\013\032lA5Q\023\374\342\360\033\356\245!Q\035Z\234cr,\340\032;\2017kv\002\210R\370\270MYW\233\337X\304+\370^,I\267)\177\260\204\325\374&\230X\340\270\276\210\024s\020\351\322;\002\177t\372\tx\344\207\305;~\013tr\2509\252\3573\271"
+	.string	"x\311(\026t\350(\303\2129-\312\325H\223#\254\333\347\026\r\361i\326H\\-\247\024z\340\213\241\201z\025A\3318X\370!\220\355\231\231\200f\2660h\365\025\232q\\4X\205\265\003v.\374on\241H\3646\212?\312\212m\226\275\351\034\006\030\216\323[\310'\325\007*!]5'\266e\356n[\205\367\213^4\023\217\213X\313\222\352\255\3538\004"
+	.string	"@<\300\323\270\333\2078%\224T\003\034\236\242[\013z\266)\207\261Z\343%\210\004(Y\303\0136\372\370\3237\f\245\372U\013\r\342?\245\312\f{\354\233g\177>\027W\253\243\364:\021\177\017\336\2468\302\203D\nf*\370\025\303\031\305\004\320\322\326\362z\200\031q\017~\t\32041\237m\206#\371\\;\267\\\037"
+	.ascii	"\017\332\244\271_\211*\022\026V\260\005]\034'X\314}A\230\030"
+	.ascii	"*\371\350\207\027\334\032|+\310\025\025e\274\213Y\036\020\316"
+	.ascii	"\331Vw\320c\200\247\3120\342\226\004\235B\307V}\275\214\350N"
+	.ascii	"\032\215(\207h\277+\t$\021\365:\"\354n\f\306\246:o]\273\242\035"
+	.ascii	"i\345@\264\003\216\203\255\021\324\327\245\214y\n\317\306\351"
+	.ascii	"^D\363\314\002\331\306\261\307`\214j\205\231z\230\250=\363\322"
+	.ascii	"i\303tf\253\204\324&\235|\"\021\346\340sg3\233\320\0173\234\315"
+	.ascii	"\202\035\251x\237\n\344\306n\034o\260\3571\217\022\204\\\353"
+	.ascii	"\213N^\352\021\272<+\030\323\333\246\215\274j\327\254e\253\212"
+	.ascii	"\315\2059\312!\272\332ts\3666K3V1B\035v\243W\200\244\251\260"
+	.ascii	"\r\373R~'\035TdT\036\350\177\372[4\037\013"
+	.string	"}\256T{8\266+\363\303\262\323E\340\n\231r\327"
+	.ascii	"!\033"
+	.string	"\034\331f\311\365\334\2653\301;\305\001t\330\344s\220\247\246\341\271\234\017\362\367E\026\341\255N\\\n\237\373\221\370D\216\2117\242\256\326\214\247\0225\f\033\233M\371\304\215\371\213.0\276+\351(\367\220\324\211\353\213\206\235\244\034\353\254hD\370\021\333\335\355\230\020_.\347\213\243\277\001\177\223\335\210\264\377\205\177|\311'\322cB\356\034\202*mE\324\022\344^vHs\b\374\342\247\224\231w\321\3757\0334\225\032\333lCD\320\345\003Zft\304=\275}\260}@\303\342\303\177j\034l`\257]q\224\226\237\266\331\264\267\333m>\234Wg7\350\336\365\270\203\251\262'\222\267\362\350\304\220\276\030\003q\355\212a\222\t\210c\344\204\353 \331\323\264(\332\370F\006\320q\331\\\364\202\017\232$\347U\335\277\032\347?\312\263\177\331\355\201\3224e\314\006\331n\372$\242\347\204\3763K9\226)q\233M\3754\272"
+	.ascii	"\237x\333\330\213\177D\f\214\2524C\263\2029\013\232\313I\215"
+	.ascii	"\2050\034z\343\035\303\334\024\002\017\210\315\\\303\204\004"
+	.ascii	"\305@\313\211/\331\255\222\373;u\"\2624\355?\370.\221\205\304"
+	.ascii	"\205\242~\254\306\232\251\353r\207%p\021\304\002\037MJ\026\242"
+	.ascii	"\bB\331*s\311J\242\377\221\230|p\372\201\205\274\3202.2Y\313"
+	.ascii	"\255\204o\021\b\200VA\205v\325q\251\264\361~\261\031\277'\222"
+	.ascii	"\366D\264\237\030\005\255\250\356\255\266\361\310\n\221u\260"
+	.ascii	"B\021\230e\n$\204PMq#l\350M\250\266\245^\322\224(\002l\3403\243"
+	.ascii	"\202\214\024\2353\230\202f\316\205\363\353f\221\\\205M\230\240"
+	.ascii	"S\365&\222l\347\277\003\342PW\027\247o\324\233N\266\351\217\027"
+	.ascii	"\230\225\375c h\304\340\257\023\004\266(\205\332\201\260\356"
+	.ascii	"b\372\212&~\343(\351\344v\301\271\021\266h\357\320\277#\262\n"
+	.ascii	"\256\261\300j\271\323\371\307\325$E\2776R\356\366\226\215\231"
+	.ascii	"8>+\3470\026r\344\244\243x?GG\235#C\272\344\001\301c3\363\310"
+	.ascii	"m\311\035h\347\300\236@]0\347x\227\353\027\202\036\001\214\001"
+	.ascii	"\f\240a\bY_\221\247"
+	.string	"H\372QM\272\267e\333%\356\346,\2414\373!\324\215,\016\207\203\024Y/\t\3019\301k'\366\357\353\203\177\212\332E\f\334\243\034\353\330J*\2402\315\332\300K\242\2157\265\366\322W\256*\276(\275\252\317\245\240U\322X\322\311\212\303W]\037\251\230\265\216^i`\247\342\372\354\r\243\330\357k\274\223p\020g\334z\250WW\351o\367\316\037\204\277\333=\232\255\\W;\274\215\272\020\267\3342\213\206b\375\332\027\335\301is\251\325{\231O\233\377\221;\234\2239@%\303\262\273\313\234L\241\276V\003\206\217\204\242#\356\206\331ju\371\332\366\006\330\301\032<\026\353\0131R\233E!I\024XE\3537r\266\006V\r+C\0072\206N\266\252\251\325fm\241\330\r\3211\031\371y\224\220m=\226\376\021p\205Q\200E\334\223\226\247\304,\271\317\307)\310S\306\357n\013\r\004\013\326(\201\025S\3029["
+	.string	"u7\211\240\304\315\235\3653\222c\322\031\210\320\273\205>\033T\317\327\021\201\362\347\r+\216\350\017\312\232*o;]!{VxsV\307\304\340\332\277\332I\212\177\214\177E\271\222\210|$\316\263F\301[|N\247[\n\321Y\026\330J\\S\034\377\021!6\035j1\004IB\247\370\277&)\027\017%\253\227\377\253\374\r\215-\243\255(\265\357\307\252\315\234\3067@\203\0238\223\377v\033\357\234\036\2703\215Z\233\275\266v\210\b*0.,^\213\317\265lu\276s\372\350+\200\360-\214^aF\267\311g\245\350\345\364\nD\243\210\317\243\2324V\340\3141\310\n\343\nZ\233<\265\034a\n;\023sm\337\314\023\013\203:X\211`\261J\371\242,\034\331\334\365\375\006\016\020\267\372J\"P\344\320\\s\364Y\t\223\033h\312<W+\240\314\317\fx\207uH Q\230\326\332\302"
+	.string	"2\314z`\222\240`\366\374\320\303V\312\034\232%\261\207\233\030^\254\377M\252\320\327\314cN#Kr\016\177\260l\347\200V\033\033\245Bo\242\345U\241S\034\356\342L\224*\311\177!\030m\r\210\207j\367Wu\330d\025\350m\020\262\344\272\247\274\356\365\017J0\251\f\370\325\263U\344'\264\205\322\311M{\216\b\204\355\257\347.\2541\222B;\343>~BvS,\311]\004\370\346\3557/^\220M\017i\346=z7\200a\332p1\003"
+	.string	"\312\026\332tC\336\317\334\336\247\036J\360w\323\247\222\207U\346\005\034y2\232\t\301t\277\b\255\366\265\003\251\337\235\237\350z\342\236O]~\262=$\3666+\353u@\b\325\301vi]\034P\205\333\315\231~\2368Y\351\345\212\364qr\245\327h\361aO\033\375-\3074\315\225\2134\007\371\311\345T\2560\224-^\\\314\210\242~\324\2748\272\312\322\327\3015\233\215B\225\220\256\246f\364\253\207\231\254\331\274f@Z\037\003H\030)\242\312\242\022L\321\224\032^|\035E\303\227\303\250\305\\\371\322\242\367\f\367\334M\275(z\004#\341+\fW\340aV\253O\314m\252\226~\fi\265G,\3251\256_\354\001!\233\220+\270\251\341*\323\312\307\213Y\237\320(s-\254\027V\020\306"
+	.string	"\n\320\217\025>9&I\375"
+	.ascii	"\240xz\371\346\252L\256\007\340\033K\007Z\377\031\021.\276G\264"
+	.ascii	"K\"IDxMr$\300\372\2034\261\"6\300\326\341b\310\205\017\317\""
+	.ascii	":\035\344\243\271_\2425{\037[G\364m\316-e\225\3015B+\340\336"
+	.ascii	"8\265\367$OC\233\255s=O\326\324L/\377\322\367-J\371\230\266\244"
+	.ascii	"\326\361l\340\371\027\0261n\017\221\372\3134\261;\215i\207\367"
+	.ascii	"\316\340\350s;Zj\375\334\202jV\255\036\206|\377\360\362\260\271"
+	.ascii	"\241k=a#\345\007\337\035\255\033\233\315\311\322uOG&}\234\320"
+	.ascii	"YM\256\371\3573\375\030\216v>\263\271\365\005\177\317\301\t\020"
+	.ascii	"\314\277\t\354\031zqfG\377=\266\310\334\300\374\t\342Q\342\026"
+	.ascii	"\237vd\267\0267\007\f7\2438\377\372\236pc\376\276\32628\037\355"
+	.ascii	"\0266b\316\254^\355\013Vj\\\371\330\246=i_\214c\223\336C<\253"
+	.ascii	"r\367\324\240'\217\356\360\234\335\357\271\177\375o\024\232D"
+	.ascii	"\351\273;\346\260\316$\311\3318r\203\351\344:\351\273\354\267"
+	.ascii	"\357\203\312{\341\024\326\246\275\213\363\037\357\204|\271=\276"
+	.ascii	"\026[\2152\032\3756\214\224w\275\246\353_\357\321\373\364\002"
+	.ascii	"\006\017\245E}\245\307\332Xu\370\261{\351\315\225\2063\250s."
+	.ascii	"\0038^!yb\006\207\300\032\027\373!\244\353\325_\214&{\277\237"
+	.ascii	"\365\025\311Y@\354\234\333\217\220/\221.t|\210$\273h\376\374"
+	.ascii	"\364\270`7\017XR\274h\365\335\354.\366\016\312A\276]\221g\356"
+	.ascii	"|\316\004\276}\217\340\035\367C\034\346\235\253\224\356\316\274"
+	.ascii	"\001\247i'\346Hs.9^\007^c\316\265g\357\351\342\376v6=\031\355"
+	.ascii	"\271\302\037\265\207L7\256\215\340\207\251\207F\335\275\365\\"
+	.ascii	"S\277\234_\365\2572{\314=\245\035?t\324>\352\320\214\341\317"
+	.ascii	"\347\246\367\345\016\235)q\205\311\236\344C\313NO:X\177\013\315"
+	.ascii	"\377\343Ci\240\356\013Zm\243_@;\210\231\251\273\274\345-/>\336"
+	.ascii	"\207O\336"
+	.string	"M\230\253\367\345\334>\313|\335\f}\201\330\247\374\216u\204\373\215\372h\356!Y\007j~\232\223\215MH=<F\3511&/z\034b\2725\364\267\200\036\004/\314\037\316\274\353&\357\373\355\237\375\003\363\f\255/;\346\227V\214\351\255\267\216\260\261\350\250\030\035\367\b\177\201v\351\277\3540\031)\037\263\253\036\225"
+	.ascii	"u\003"
+	.text
+	.section	.gnu.lto_.symtab.90fdaa5804a29bd7,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"blackboxImageBegin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"blackboxDeviceCommit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"blackboxWriteLE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"blackboxImageEnd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"isBlackboxErased"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"blackboxDeviceBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"blackboxDeviceWriteHeader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"blackboxGetLogFileNo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"blackboxFileWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"flashfsWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"blackboxFileBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"flashfsGetWriteBufferFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"flashfsFlushAsync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"flashfsEraseCompletely"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"flashfsGetWriteBufferSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"blackboxFileEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"blackboxFileFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"blackboxFileInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"flashfsIsEOF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"flashfsClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"blackboxFileBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"blackboxFileIsWorking"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"blackboxFileGetLogNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.90fdaa5804a29bd7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
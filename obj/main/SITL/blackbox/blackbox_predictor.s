@@ -0,0 +1,387 @@
+	.file	"blackbox_predictor.c"
+	.section	.gnu.lto_.profile.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \307\325\003"
+	.string	"t\005\273"
+	.string	"\b"
+	.string	"\252\233\326\335\017"
+	.string	"\001\374\343\213\347\007\n\002"
+	.string	"\002\001\002\002\002\001\002\003\004\233\265\206\303\f\003\332\365\247\340\r\004\257\301\242\310\013\005\224\241\227\234\006(\002\005\002\006\007\002\007\002\002\001\006\002\006\006\355\336\260\354\016\f\002\002\004\007\371\260\266\237\001\b\002\002\002\004"
+	.string	"\016"
+	.string	"\026\023\007\002 \300\210"
+	.string	"\006V\350\b\327|!"
+	.ascii	"\013\200\f\020\002\300\356\374\345n+m\300\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 d\215\001"
+	.string	"\004\002X"
+	.string	"\005"
+	.string	"\004"
+	.string	"\003\001\003"
+	.string	"\001\005\005"
+	.string	"\006\001\003\007\001\001\002\t\002\002\030\001\001\020\001\006\003"
+	.string	"\006"
+	.ascii	",\001\217*\002H\004\030\004t\262\001,"
+	.text
+	.section	.gnu.lto_.inline.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\334\001\275\013"
+	.string	"\026R;7@\305&\351\257{i\243\240u\036\326\242\261\tY\302\024@\303;G\301\260~\006\355\267\3601\373\375>\344R\032c\001Ii\2141\006\377\f\301\242\335\242}\373\204\310\235\002'"
+	.string	"1"
+	.string	"-"
+	.string	"\330o\343\326|\275{;\315\314\224\236\"3+~j\375\007\212T\361\257\332\027#$\252\022[\306\253\2112\323\340+\267$\032\241\217\213I\256|\307]\005\0202rB=\250\036 \034#L5\341G\252:\321\216\240\246\210L\002\024\214\016\261\235\263v\023bO\257a\277\207\3760\305\304\274\326\265\356\006gX\2303'\263'3\302W\261\352\253ul\240d\\\250\377T\0013b\355\213\203\245\231"
+	.ascii	"\263m)\356\250\021\242\001\377;'p\025\263\270\273AOCY6\240\211"
+	.ascii	"d\331(\301\241E\226\t8Xj\300\300\037\361\345\234\326\356\233"
+	.ascii	"\246\274.wy\233\007> \220\242S#\347\001\256\267\200\002\272\204"
+	.ascii	"CI\004\324\270\006\233\001\222\356T,\333l\216\023\264\2629k\036"
+	.ascii	"\253;\266\300p\314\201\nm\240\232\273\032\342\223\001\027J\001"
+	.ascii	"\253!>\301\372&%\3017\322\241\356\250.\303\016\301`\345\2704"
+	.ascii	"\203\221\003p\340\246\326D/\277\330Nt\267J X`\036\230\252\201"
+	.ascii	"5\362\365\243\311\373\022\274\313\272\022\021\006\233\240S\204"
+	.ascii	"\214\350\006\025\300\361\3324#z\343\3121!\330\312]s+\302\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \233]\002"
+	.string	"\002\204\r\030\260%\351\f\303\200\226\244p\266$I\301a\300\214[c\2154B\266L2\0238\3722\213>X\321\266\217\263\307y\243)\235\020\202\005\370i\303\032X\367\177\214,\020\007"
+	.ascii	"A\363\254No\315\306\270EpbN7\352\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\232\004\005\232\004\006\232\004\007\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \347U\003"
+	.string	"\202\004\016\027\300%\035?(.\377\337\364\377\373\277\3615\255\361\200\220\275\033\2212\005\377\017\255c\2714\362\224\237~Q\365D\304A\215\341\315\357#\232\363R\262Pn\311\222\031\204\300G\023"
+	.ascii	"A\020\370X`\224\t\324g\210\242\"L\025\267\303\341\301+\032=\314"
+	.ascii	"\214\201 \334\002\313\230:\202UsP%\307\345\316\233\266\200E\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.lto.3365a8c838a9c83b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxPredict.14.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\205\002\375\021"
+	.string	"\026!rF\360\260(\035\353>\246\363\334\346<\275\246\242\030\352\\\263\326E\312u\343\023\230; \036\360\313\253\323\032\022a^\001!\020\311\253M\366\326\246n\205\322{\320\317f\034Vsn2\027i\257(\364\326\366\t\331[\312\224\002]"
+	.string	"W"
+	.string	"`"
+	.string	"6\220\371\032\025\213v7\334\240\355\312B\\ \364h\3337\361\023+fA\231\007\327\310\214\n\263\034\273\333\005\270i{\204\007\331\036\265\303Y\337\"\324d\371\255o\"\234\235\310\301j\360\263\237\\\200^\\\031\256.,-\333\307\356\216\\\037L\216dw\235/.\f7w\333\022l+\2603D\266\177\362eO\217\233~\366\005#|\\2\310\226\265Ra\366\341\352\214\355t\311i\222\323\243\337\374\242\333\374\241\313~\3565\377\346t\3244\324\264j:5}\017"
+	.string	"1L2v/\324t\254O\204\001\302\366\212M\262or\020\330|8`\031\013~l\013\007\013\264\335\r\t\252\234\210\235/\346\342\246\0271\244\251%U\236/\226gm\234\246FX\355\243Qq\023\n\250\260\233g\273\222\024\316\276\022!\345\364\032q"
+	.string	"}/\226\254\371:?\t\237V\356\270\356\370\264\222\215\330\312\260\360[(\215\330\356\n?\307?\241\274\312\366\370A\333\236\330\312\354\351)l\377\020\320\260\333\372+\003RR\336*\216\bHIy\253(2J\304S\241\240N\032\244\274\025\003\n*\023\007\250\222\007&]\204\223\022\b\035\312\233\320\211\234\254Z\245\274\016E\245\362:\331\036\256\316x\024S\223\234\202\304\274\342H=t\202`)\001L\217\2224*\214\355\250\251,>\316M\0027\221B\035)\254\361\275\364\254M\025j\362|4\0019 "
+	.ascii	"\243)\332<\201(\240\212\232\271\\\207t\332\270\030\253\330vt"
+	.ascii	"\020,\301u\301\246\310\270(\344\245!\b\211\357K\334\202\2661"
+	.ascii	"@KH\033Zl\357\327\r\r\027\365^\236\314\224\270=I\232\026\255"
+	.ascii	"\234\201\243\332l\001\212\304\262\r\206\211\212\026#^\b\305\334"
+	.ascii	"\301\f\202<\230\035\031\256T\005\t\215\370\312q\273\206\233\330"
+	.ascii	"\205\367\314\327\255\205\317\214\262\350\262\374\004"
+	.text
+	.section	.gnu.lto_signedVBCost.15.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"}\006"
+	.string	"\302\013'+@W\232\003\377\265\202!\001\f\t`HLZ\025EQ\004orGQ\214\252\242\301\005\214X\300\235\r\226\333q'\221\355I%I\006kUdud\225d\265$k\222=\311\242dS\262*\331\225,\313\266e\353\262}\331\302lc\2662\333\231.M\267\246k\323\275\351\342ts\272\215\257\316w\347\313\363\355\371\372|\177>\215/\303#\324>B@8@"
+	.ascii	"\241\211\n\020\030 (08@\020%\210\024\026\030\032F$\207\007\022"
+	.ascii	"D\204\304D\211\242\302\242tD\2350^P\247u\255\035\001\" \320K"
+	.ascii	"q\"w\215\211\270CcM\344]c\"w\215\021\271kL\344Nc\"w\215\211\270"
+	.ascii	"CcS\344]c\"\273\013\033\0231w\323\022\246\212"
+	.text
+	.section	.gnu.lto_tag8_4S16Cost.16.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"5\006"
+	.string	"\262\013%)PW\2261\217_\377\356\356zf\356n\324\231\231\231\031\315off\226\235yU\370\261aff\243\001D\255r\333\233\020\222v\323\005\271!W\344\216\\\222[rM\356\311E\271)W\345\256\334\322e\271-\327\345\276\\\230\033se\356\314\245\2715\327\246\225\321z\323\212\323\232\363\252\363\272\363\312\363\302\330s\301\021*u|xh|>\240PEU"
+	.string	"\242"
+	.string	"\221\300"
+	.string	"A\201\301\001\302(A\201\264\300\320\340\360"
+	.ascii	"\021!1AQ\221T\245F-\252\324t\232n\004! \340\225\326\"w\215)\221"
+	.ascii	"\275k\254H\270\3134&r\327\030\221\273\306D\356\032\023\271\333"
+	.ascii	"\230\310]c\"w\215\021\271k\314\210\310\233\006P\004"
+	.text
+	.section	.gnu.lto_blackboxPredictorSelectorInit.17.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\020\003-\027"
+	.string	"\306i\224I\300TU:h\266K\035\352\\\314\373\210\b1\223\027\217Zl\f\215#\205\026\264-\312\267\210\352\332\013\007\372\247a\367\275\2600\317\243G:\217H%\220Y\024"
+	.string	"\262\375f\025\026\374\275\236\314\372?_\365\205y[\262\267\334I\006}"
+	.string	"|"
+	.string	"\202"
+	.ascii	"{SO\267\367\231\361\264^\300x\272\262],\357\311\350\373N\324"
+	.ascii	"~M\335\275\342\030;?{\337*eG\325\323H'K\331\376w\005+\210\330"
+	.ascii	"p\263\243&\200!\216\025\217\202B7!\350\204\303\007G\310\n#w\364"
+	.ascii	"\223\212\2175\031\234\221\244\017\236\"\261\320\362\"w\364\231"
+	.ascii	"\342<\033\264p\222\"\205+\2323P\220\256\374wy\303\321\244<M\350"
+	.ascii	"\356\2256\\\356\033\363\335\315\261\273\027veS"
+	.string	"ce\346\225\240\342\263B\223_v{3\311\273!\016]\221\345\244]\325}\374\251\363\376\230\377\370\353(\227\036\370\235S.S\271r\312}\200q\t\312\001`\367\211\"\230f\242K5\016\374\356\201\354\203\300ERg(*\320\307\"Kw\323\234\256\205zz\231\335\345\037\037v&*\310\336{\310\356#\304T5\rI\b\205z\232`^\356~\307y\310\316\023a@\3254\037\211\"\335\275\007\001a\226`\250\335\264\233}\222+\3110W\003\316x\033\316xz>iQ\362\262\364\234qw;\374HN\201*\335}\263\253s#\254\323\001\017~\201\r%\326\t\2076(\357\326\206\310\333r]\212\f\033\242\334\036W\204\231\260\251\333\3506\312\267\335\375k\334\365\271\322\353\204\033\242\203\013\221,.\345]\330\205B\265\273%\354\205l\340\220\252BC\304x\212`\306\021\221,\316\311;\351\013\302\364\2029i\353?\004\256\367"
+	.string	"\271x`,\240VE\265~ZBuY51\330\020\313\305\323\212\005\345x\200\355\370\260t~vV@.\235\327\212\025\023Z\3250XXP+\266\032\202\301b+\231^\237\223\376{\005b\204\211\210\213\026\305\273=19\251\230\211\223\346\223o\213d\234|\236\217H\223_>\273\273\253\203OV1\b\335\023\243\026E\262(O\314M^\004l[&3?\247\353R\013\363\233\213)7F\336m\212%\307\316\222_\013? `\002\031\302\263\ri%<B"
+	.ascii	"Sd\036\332c\\\252\357\234)\013h,\363\211\"|k\364%\004\036\236"
+	.ascii	"c\230y\013\213\273\2410^@\022\322\341\017:Dc\353\001\334O!\265"
+	.ascii	"\302\303\274\215\326\002\020\344\262-\004\260giXX\305+w6\363"
+	.ascii	"\240\204\200X\360\321\"\344\343\363\262\301\216k4$\256\211\355"
+	.ascii	"\261+7T\240\366\373j\013\003\006lX\322\020\n\237m\224\313\322"
+	.ascii	"\036\235\337\313\f\021n\246\302\214\357\340\330\343\2618SH\232"
+	.ascii	"\266\025iJ!\240"
+	.text
+	.section	.gnu.lto_blackboxPredictorResidual.19.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\372\n\0351"
+	.string	"jY\264\022=P\350I:\220o\314\200\232\351\3732C\005\310d\371\324\027T\027\006\245\b\314\305\366\304Ga\266NsA\333\375L*P\305\"\247\310HC\354H\230\345\273\331A\2435B\310&DJ\231\002\035\001\357"
+	.ascii	"!\001o\312g\312\337\030%\032C\005\212\265>)n\252\205\310=2\273"
+	.ascii	"\267\313\267\333\267\353\267\233g\375\276\177\227\372\276\202"
+	.ascii	"\036\241\341\373\002\332>\273\367\365\363 \037\270\267\325s("
+	.ascii	";Ehj\255o_>\017.\371\267\3353\304T\002\305\304#7FR\255z5\314"
+	.ascii	"%\307\037\356K|\360w\026\017\334\346)b*\201r\322\331RGR\255\265"
+	.ascii	"k\311\247\231Kn\225Z*Z\247\2106gQ\2118v\316L\3367\302Q\252\316"
+	.ascii	"m\t\303\247\326\352u3\346\177\333\254\033\270\325;r%U\347\340"
+	.ascii	"0\341S\253\236\327\307\314%\257g\376\377\256Y6p\027\216z_\354"
+	.ascii	"\350\2266tr.\325Z\301\264\266\212.9.\025]\262\275\254p\201\247"
+	.ascii	"YRrl\026~\211;\366]!Tg\247d\201V\366\264\362\267\t\362\240Ta"
+	.ascii	"s\265D\241\262\345\036\202BE\020\035\323)K"
+	.string	"\016\001-\341\021h'e{\2542\264\345Q\224\335\334\b\001\357O\312\372Ynb'\307\\\226\325Z\317uvQ\366\301\375\237\367\037\307\017\374\023\275\325\333nw{\206e\344\270\370\353\311\355Xk\255\334]\376\035k\255\365\315\345\247|\030\224\237F\371/vo\357\342\344\267\240|\026'\177\305\311G\243|\025\224\237\202\362Q,\337\376\304\3117A\371%N>\211\223?\202\362EP~\b\312\007\261}\373\263\223\377\201\362=\234\374\016'\237\003\345o\240|3\312/[\277=\331\371\032\202\374\f'\037C\220?v\362/\004\371\025(\237B\220/v\362\303VoW\302\326\331\375\3329\273]\033g\227k\337\354nQ\276\003 \277\301\311gp\362\027\234|\005%?\201\311\3272\371Y'\037\301\311?p\362\r\224\374\002&\237\200\311\307:\371W'\177\300\311\267*\371U&_\200\311\247:\371S'?\300\311\227*\371"
+	.string	"L~\224\311\207*\371O\224\037\244| \345\237\224oR~I\371\224\362I\312\037)\007M\376\233h\022}\242D\233\330E;v\211\021MbD/\240\251\2464i\353&\005h\251\236j\3464\304\023\353"
+	.ascii	"M\345\320u\222\344\242\352O\333H1\226\214Z$\325U\214\366\026"
+	.ascii	"\022\r\031\337\037tI\261\336&V\242\372\251\001\364\016\315\334"
+	.ascii	"\217BuT\036\214\206\352%.\271w7\276h\255\2642R\354\242\277{j"
+	.ascii	"kt\353^\364\033\226\271V\302}*\031\312\322\335\005\207\0237p"
+	.ascii	"\032\315q\246\267\350\025\355\242\031\021\335\024\026\335\242"
+	.ascii	"KbV\263h,H\303N\021\026\255W4%\0167\241\365\372\331q\223\025"
+	.ascii	"Kt\235~\266U\364\303\254\265Z\370&\022\342\3350\305\034\241K"
+	.ascii	">\365\231EQ\2326\301\376\377\005\354\255\016~\365\331\300\246"
+	.ascii	"r\206"
+	.string	"x\275Bj\366\331]i\230g\366\342\335)*\373\320\222\264\267\272,C6\355\261\322\260\f\257\220r5\331H\356\b\r\363F\257\255\356\036\273\211C\274${>\312\335M\016\032\252\351j\256\346^)w\201\206x\333\377#,Q\030\265\250\326:\306\304\272Iq\\<W7\324\214\334\310a\204\356P{\263\221\003\b\233\2339A,L\b\233\233\017\222\355m\207\232\020\222m\007\033\020\363k_nmA\326r\330`s\3631\203H[\r\035kj;j\200\365\310\241\306\003l\315\r\b\330\327\203\267\371`s\003\013\322\326\346\006\026\324\213\333\2616\227\363i\026\304r\246\223\331\265\0334\264V\\\313\275\310X\253\026\262\315\263+\351\r\027\205yK\024\216ih+0{\r\332A/\032;a\321\240\313>\2200\265\211\343\342\031t\023\256[\320\n\232A\206^\360\305L\230N\201\220M\006\255~\352\004Y\255\265\241\263\366"
+	.string	"\313\314\310\372\353W\326\373w\226!\246h\327\212\270\320aMF\241\303\202M\001C_\300\320\373\207\240\3458\356@\033h\004c}\200k\321"
+	.string	"\2101\002\375\324\005\260\232\200\210\306\272B\307\004\021\342\254\277} z\005\225d\212\251\261kU|\350\016}\346\241?\224\355\201Cw\340\320+\350\2525e\032\320V}U\241\007x\355%KV+d\230\025\004\364SW\255\243\245j\001*\232\252HQ\3646\332\024'\372\313\207\242\022\331]\316\2356\305]\013\243\003\200\312\250q4&\225S22#I\222J\2065"
+	.ascii	"\003\021!Z\035\022\200t=\007J\247U0\023\246\f\333u\003@!\260"
+	.ascii	"\323a\372 \374\234\265\037;\255\256,WS\253\305\230\205\245%\316"
+	.ascii	"\026ri\202;\002\033\325\315G\351\\\373lpb\203\362ix\342\203\361"
+	.ascii	"\345\267\216P\023\335"
+	.string	"(\246\264\345\303]D<\024\216\331\325\021\203[k\007g\215Q\202\333\232\234\331([\335\263\023*\022gj\004''\230\360$[\211\250\327}\310\026\320\213\305c|]\025`3\336d\274G\344B\361\224\317F\314 \241\335r\306\253\276\375\323!\325\330\261\351\304\257\234}\274\026\203\f ~'\223\215\213\030\210Tf\f\200?\233\021\352c\320P\237aV(h\344\335\340\227\005\017\025,\210~[\372\307{n\310[F!|\373\240A\335qm\033;\270/qX\036\224\240d\006\3418(dr\n \372\342iF8\257\325\276%Y\206\212\221\373\230kA\031\274x\037\\W\001\020\364\177N&\224\217\311z\225#&\260Q\346\230\242>\222\221I\2074\3574ME\332qzo:O-\001-n\231\262-a\030\263c\033\227!*0\204\177Q\306\357y\242\204D\300\t\031\373\323\303~\346!\375\240X\031d\222x\022"
+	.ascii	"\3235\344U\026\320\220E\023\250\212\220\210\255\tAe\372\332W"
+	.ascii	"CP\325"
+	.text
+	.section	.gnu.lto_blackboxPredictorSelect.20.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\344\0035\032"
+	.string	"\326\356\243I\260\226Q:\353\215\357\252\013l\215\247\224\334J`\321\004\327k\203\364\243A\371\\G\\F.?\324\254\356\274\205\370v<\206\205\305\330vs\350\337\317\316\316\026_\270\233\030\013u\270\312d\306\311 \233\360a\311&\204l\271S\n\220"
+	.string	"\211"
+	.string	"\217"
+	.ascii	"9\007\256\241\377\234\243\237q\032;\346\231\271\"Z\313\020\024"
+	.ascii	"\320\022\225Zs\243\314\007\200\377\346c\300\177\333B\364\374"
+	.ascii	"\314\335\340\362\\%\322\020\374\346J\036_\367\031U\304$\243\365"
+	.ascii	"\\\365#A)\232\236 F\020\n)&`!T;m\272\202(\334\n\241\332\303\t"
+	.ascii	"\240g\224\242\205\0064!\324\234z\337]\316h?\022T\341N\3743\361"
+	.ascii	"\331B\0331ej\255+\264\230\334\357\316\300\346DF;q\031J\250\265"
+	.ascii	"Z\312hB\367\312m\023\261]\301\336\030\001\277\241\341\003u\361"
+	.ascii	"\317\027\001\376\373\206=R\216\222|\344\224\235\353\221{\353"
+	.ascii	"\031\325\236\274Dv\f\314\213\245]X"
+	.string	"\236\373\001\234\351\026\277t\323\360J\322\337J\317)\275SZ\256\364\005\250\204\214  Rk\211\251\250Z\344\343\2758\323\277\364+}\3557\311\304\002\324\330P\024\214\333\360wKL\272&\024\350?i\357\370:\257\370J\356A{\202\350n\210\311\223Z+\315?O\240R\332Oz\215\235\347D\030\bPc:\333S\255\001R\341\336\034\002\371b(\025\244!\222\346tg\236\037\270\327\235\"A\322!Y6\334\231{\200t\307\0222tP1Y\345\263\326Z\301\275\371\273\213EHR\223\256\347\206\013\356\314np\2721\033\302\346\204\204\355GN\311oow\352\031\241\230K\344]\2710\235\220\230\254\202\363\035\256\361\251\301\356\270\204\347#\247:\\\207\353\200\222Zk\215\315\3419^\377\b(\221\373\335gpS\216x[s\352\341vo\313\262\317\001$e\017\307\221Ck\255\021\034\255\353\344\260l&\353\206\225C\275z"
+	.string	"{\351\254Z\031X0\234\013 ^6\256\025\206\033\233\261C\013\003\207q\005\313\031\037,\360\013\207\005\033u^/\330\270\222\253_\"\227\225\361\331\037\177\353\262\267\205\013Y\321Zc5>\220\007aMoh\201\227\265\300\177\337\314\021\033G<\025}\331\205\ni.\356\314\274\213\373$qo\026\367eC\250HB\302\366s\027h\373\346?\\\005|\bh\372\fN\212J\024\0379\265t\202\341\302\314\345\321r\031\024\230\235\023\212\212\037@\001O\250A0\344\214CD\231\231\221\tHZX\035`\002\0312,\017\021\2401%vJ\fm\007\0368`&90R\016\342\376\020\321H\343i\2107\303X\210\023>q\t\200\316]o\216JgY\240\260\324\013\306\374\245dr|5\251\300\370\013\337\306')\3372\tCm7\373\024\""
+	.string	"\321\2115\006k\202\331>\274\023\322\t<c\034\005\013\317\205\370~|\206\213,\326\361\350\006-\346\205\3126\360\314\270{\2148"
+	.ascii	"\006D\347\021\n\311q}~\322\354\326\202>'}\351\266C\206\t\307"
+	.ascii	"\262\2573\r\006\r]\3136\354\nCk-\242\225+J$p\323\2453c*"
+	.text
+	.section	.gnu.lto_blackboxPredictorCurrent.21.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"}\n"
+	.string	"6\323F?0\247*\035\345eL\277\350u\036\332QT\225\333_\237?\376\311b\216\210q\fx\327\224\376>t{\322G@\206\361\357\r\021\243\016\003\003\\\200px/\322T\350-\216[\233 B\210\334)\0055"
+	.string	"3"
+	.string	"4"
+	.string	"\002D\036e\223\225RXy\234\f@\330\235]\345\r\333\265\354\f\3335\025\371\350q\344\237\3003\030\353\001*Ez\234`v\327\021\225\002\271\365\266!lc\354W\002\232Fk\026\0355\372\223\204\020\006\022\rv?b\260]\240\275"
+	.string	"\330\026\331\024\3331\332o}\200\3503\344\260\260&W\211\202\335I\341\013w\315\223\263\355\007x\376\201#\340d\036\271\035%\365a\344u\215\372S\004g\274"
+	.string	"\210\3335U\370\256P\203#\271\346\207\266k\327\b\007\255R\214\331\223\024ue?[Uy\373\374\003\240\f\275\257\363\2018{\026P\206\336\346\342\003?\026\033R\303\3612\035M\207\261\311x:\017\004u\226\t\313\317\007v\241\224`G\231\373lU\265i\245\244\035V\335\314\361\004\227\023"
+	.ascii	"`\251'\023:\305\201q\006\304\325\222\255\032\357J\264j0\254\211"
+	.ascii	"\\U\030Jo\365\031\313\\\303Q&\260\253\306\353\300\304\203\273"
+	.ascii	"F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \340\325\003"
+	.string	"\204\005\334"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\021\177\023\320\231\263\346"
+	.string	"\005\020\024\200\204\001"
+	.string	""
+	.string	"\003\005\017\025\r\026\002\023\177\027\024\177\030\002\025\177\031\001\026\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\003\005\b\241\341\365\321\002\001\344\013\204\026\244\036\304f"
+	.string	"\r"
+	.ascii	"\240`P\260\253|\306B5\3462\\\366\246\2423\320\303\t\237\200\201"
+	.ascii	"Y\262\004\232\273\326\034\003"
+	.text
+	.section	.gnu.lto_.refs.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002"
+	.string	"\002\003\002"
+	.string	""
+	.string	"\004\006"
+	.string	"\001\006"
+	.string	"\004\022"
+	.string	"\001\007"
+	.string	"\004\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3365a8c838a9c83b,"e",@progbits
+	.string	"(\265/\375`\337\reD"
+	.string	"\312u\260\031?@dN:\027\022\222\r\023"
+	.string	"\223\"\206E\353\217\020\240\332\b\310\370SO\207\376\207Z\351nu\003\276H\013\177\252\375\203\002\340\327\323\377\377_X\271P@\270\214'\243\330\350\372\232hA\354\226)N\001\226\001\212\001+\347a=\334R\361\236c\330\360\241r\256\345\212\223\312L\212t\327\027a\317TD\2562\025\361I\366.\260\301\236\353\374\334\206\357\230\316\215v\343u\267\001\342\030\275/^\356\312p8\016\267U,\347\234\307s\316\324l{\312\344\247(\212\335]\027\260\024q}\301\236\253\210O\325j\265\312UD~c<\343\r >\325\332~\372"
+	.string	"\347f\346\256C\025,7K\021\017\202\205:\327\261q\222\344\007\nx\327\237\331\374|\206\345x:t\216E\333\256\273\215b\222\232\301\271sWF\303i\270\205\300k\316sLw\245e\333\266\335\355SS\236\224;\264\273B\261\024\361j`\377\253y\001@\275\341\227=C \016\253U\206@|\313RD\226\007\020\233\376\333\202\372\347\351\277!\270\303\325\203\033\314\341\347\f\377\001\r\374\267\003Ga\350\363\237\216\361?\037\b\377\025H\375\267H\365s\361?\377\227\301\377\031\353\317\221~\276\360\363\203\237\027\374\254\340g\002?C\375\034\340g\342\377\302\377\206\376\323\375\247\376\337\363\177\316\377E\377\t\375O\364?\360\377\241\377\323\377\205\376\313\370\337\367?\320\177@\377\377\374g\363?\301\377\275\377l\265Z\255\376L\375/\207\037"
+	.string	"\231M6\350\017g\033}:\333\250\022\252\233Qew\013\205r\332-\225\354\234\262A\235\323(4\252\233\255\354\351\222\n\333\214B\235|Q(\224s\272\204:\233l\320\250*qorbY"
+	.string	"\335q\"g\263\313\310\326\226O(\252\263\215\366_7\333\035\351g\203\356\265\350\363o\331\204\363\230\3242&\3362\312mw\037 c\266E\273Iu\202\211v\203a\356h2\r\312\226\332oLU\272\255\365\330\221n\004\335v\223u+\271\251\335\255\354\356\245\347Z\333\375\004\312)%#\353V\233\"\3535\345\234#\335\327\0160\017\352\234\266E\215s\352\246\322F\322*Y\332\177lOv\252\\\323c\212X)t\311\240S\"=<\273E\254H)\360\213\021'!\373t\007\357\r 'b\301u.\332\026\031\r.n\214\312\266Nffp\321\300CM\200\211\002\273\264\016\226ta\f\025\302\003D\"\275k!@6\r\216\230\232\273\362 \376\343\366zL\210\337\360(\337\362\260C\226\256\347\327\307T2S\244w\355;\357\341\350\236\026\003\355\264Z\004U\025\037\3711\311\004\242zj\323\310\334"
+	.ascii	"\375)\356\231\364\250\356\256\324\251\246\3000f\326\356z\226"
+	.ascii	"c\215|\330\r\327a\252\035\013\271<\202,\207a\003\363a<\274\307"
+	.ascii	"T\265\017f\366\bv\267}\230\217\375p\313|\330\316Y\217\357|\252"
+	.ascii	"\355nv\3673\360a;f3l\273t\273i)\300\246'\026\205\260\273\225"
+	.ascii	" aJ\202R\337\240\363\f\033\303>eK\240\267\251\324q\232\230\321"
+	.ascii	"s\323n\332]\273\322\245\272\2664Oy]$M\272P~\327\356\027?V\314"
+	.ascii	"\356z\237\334\346\023\223+\327\t\003\322\031T\246\335\365\252"
+	.ascii	"\335&C5\354\357\031_\264\366\242\335\263)\022|i\004\343\330{"
+	.ascii	"v\207W 4\205\031Tt\005\321\231\340[\336]\237\317[\266Fu/\t\245"
+	.ascii	"\303'\354\271\f_g{\235\267L\300sE\240$\202\375D\233\300\323%"
+	.ascii	"B\223\236zw\375%\373o\222+v\3078\332\335\0343\245C\353\366\302"
+	.ascii	"\025\336\321\335\225\365\214\277J\3305|u\232w]\237,E\374\334"
+	.ascii	"p\254Z\275GX\r\004\235\231`\253\251U\005\340\253\352i^#\277G"
+	.ascii	"\036(\300\2162\313]\257\3626\257\331 6/\267y\231ktT\376\250\304"
+	.ascii	"\226K\036Cw\275K\266\343\304<4\255\273\353m\036\f\240d\212^\037"
+	.ascii	"F\253\226\351\225h {n\304\216\316\204-\023r!\333\266\031\006"
+	.ascii	"=ij\204\255\266V\365\344\007\347O\241\244s!\240S\267\\w+x\022"
+	.ascii	"s\307(\022\017:\221\021b[tW\206\264\216\221\325\241\336\225\037"
+	.ascii	"\231\265\203\202w=#\006\374\317D$\004\206\n\222\273\376\202a"
+	.ascii	"\177\177b/\237\335}\246\324\366\223\351tVb\256\372\213<\344\006"
+	.ascii	"\377\327\036\032\352\266\022\267\210\375\"g\t\345\256\377\027"
+	.ascii	"\364\311t+\243\272\355\247s\312\246t\262\001\004\215j\233\212"
+	.ascii	"\201\236\272\265\263e\203\256\321\276\3356wa\311\243\b!H\260"
+	.ascii	"\035I\344\327\222\216,.\2575\031\366\205\324R\"\342\245\205\365"
+	.ascii	"uLz\035\201\344\300\302*&\277\270\300\300\200\214\2302\020\003"
+	.ascii	"\fy \214+\3101\351#k+K\200\323\035\362*\242\306\026\327W\327"
+	.ascii	"1\314\311\312(C\003\326UWV\262\230<~\245\240\272\326\323\265"
+	.ascii	"\216`\\_\\]\3545XQ\260\272\032\262\364+\017\027<\\ \376\312\203"
+	.ascii	"\321\350\301\312\310\336\3128\354\372:n!\265\276J\024\330\362"
+	.ascii	"\342:\232\350B\262H\356\350:z\2310\260\224\374\216\bG\372\340"
+	.ascii	"\002\263\220D\"\301,4%\261\256\226\230\302\260\270\274\270"
+	.string	"d\300H\220\304\302\220!\031\206\324Z\223a\310\021^Y@\266\216a\\`NI,+c\362\353\b\204\275\3218b\001\r\027'X\255\n`\310\244\326q\213\013\314\007\326\020d\016\036ZY^9,|\035\263zX\320\002\013\263P\241\352\255\230\264p\260\2144\311\310\017\316]\303\204\271cnG\3330\343\004[\r\255\352\277b~\307\024\027\355\235\211\264\302\261\355\224\200\332\230\262/gP\362\324Yz)+\234\302\244\275\353\305\362\273\005\313\225\256|\335\314\013-\363\257\235kU\3056\204\204\205\\~\245\327[\317\242\323\256\022\253k\304\274\353\215\373\325\3623-\r\352\333\233kco\226_8(K\n\201\221\302\376\367\r\013_\237\301\273~Uc\277\212]\266\313v\255\240\200jf\237\022)\021\313\236\337[\225_+\001\240v\226N\267&%k\3257nmLM3r\"\265+\231(sQ\022I\221r\243q\332"
+	.string	"\235\356\332\270\274)\277Q\036\f\201\007\250\221,\206\224E\"3\"\"\222$)\244\0031\005\204 &\2614\017\022"
+	.string	"F%Q1\305\314\320\314\024\224\221\f{\006\210\007\220\253\032\341f\350w-\261\306\021\346\222B\016\257O\241\346\206\261\2666\360\0368w8D\350[T\371\363C\314\344\325\324\r\326\232i3\321@Q\253\301\217\372g\f l\342\211b\004\3355\220\033\216s\314\363W\2168L\272\033\224\002\306\3673\2235|r$\335f$9?\331\332\274?4\352\247\024\001\372xd\365\344\3364\003\266\264\336\251]\0021\257X'\235\2171(\\\033\223"
+	.string	"\273\2770\302\3143\276S\203,\203>\311\377\275\006\313\251\222\rS\200R\335\004u'\224\363\023=\271\352\214AzqQ\240\347/\365\206(;D\205"
+	.string	"pL\036\320sU\2070r"
+	.ascii	"=,\310\366\276>\203w*\242\032\t\256\355O\206\232\226\270K\242"
+	.ascii	"\360@\r?k\271\264@\314H\354\315?\001\242\\\306\337\301\345\265"
+	.ascii	"\252\314\361\320\327\204-\002\354\334\213\322\r\321\033\201\304"
+	.ascii	"X7I\235\323\025\325W\335\316/\271\326j\272\bk\357\224\262tx\306"
+	.ascii	"\250\fs'\251K\036W\32628'\002\251.U\251u\351\334\326\252e\334"
+	.ascii	"W\023\376j\022\032$;@\301\221\260"
+	.string	"\207\244\204.3\310\303\034\006\241$\021dzf\3127:\222\353jQBy6\371@\310n\277\023\316\206\036\177LWy\233\217M\204\331\224\274\032|\307\200\205BV1{\204o\002>:>\205\031\376s[\023\337\026P\364\232\355\371\203\256\376\270\3426n\005\301\376\\\034\242\206\231\316\332R\243k\232M\210\270\311\351\221\273I\003\354\213"
+	.ascii	"'\207\033.2\001\217\336\276{\354\t\266\307\033\211=j\223\261"
+	.ascii	"%}\307\375\256\370\346\357r;\356\207\\`\370\241\322C\356\337"
+	.ascii	"\220\016\334\\\213\231'\357\201\367\303\354f`L\255:\017\204L"
+	.ascii	"\205/\3113\244\016\362I\360\t;\310\033E\0078\263\340D\263--~"
+	.ascii	"\322U4\033\240\261\210\301*"
+	.text
+	.section	.gnu.lto_.symtab.3365a8c838a9c83b,"e",@progbits
+	.string	"blackboxPredict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"blackboxPredictorSelectorInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"blackboxPredictorResidual"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"blackboxPredictorSelect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"blackboxPredictorCurrent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3365a8c838a9c83b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
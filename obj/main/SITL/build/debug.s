@@ -0,0 +1,244 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\003"
+	.string	"\232\227\234\231\016\001\240\342\234\212\n\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.dd8c743554a33be0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.5.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375`\336\013\265:"
+	.string	"\352jT\02740.\247\003<\303\rO+E\3529<\032\026\346\215\001"
+	.ascii	"\274\351;-\327\275\363\353\353\266\313\352%\335\177\213\210$"
+	.ascii	"\267\255UW\214:\344\207~QK\262S\222\001l\001|\001`\001E\235\\"
+	.ascii	"v|\341\314\360\216#\312C\266:B\3311\206'C\303\021\351\362d\307"
+	.ascii	"\031\302\020\327d\307\2318\204\363DE\235\227\354X\003\227\341"
+	.ascii	"\233;\"\362![\235\223\354x\303g!\342\216\212#\255\354\230\203"
+	.ascii	"\225!\234?\"\376!\333\321Tv\334a\3120\220?*\016\"\333q.;\366"
+	.ascii	"\360P\2008\244\361\303\267\245C2\311v\344\223\035\203\370%\332"
+	.ascii	"#\235\221\355\030';.{\267\032\036iT\223\035\207\350\205\304-"
+	.ascii	"\021G.\331\261\b]B\2674\216\270u\372%b\256\354\230\004\255\323"
+	.ascii	"/\245\221\355\237\312\216K\304\3629\246\224l\237Qvl\302U\f\307"
+	.ascii	"\244\222\355\333\311\216O\254\nz&5\262}.\3311\nTm\236\351\255"
+	.ascii	"d\307)J\031\361ND\267\225\035\253\020%\364N3\310\326Ye\307+>"
+	.ascii	"\021\3619\327\224\035\263\350D\303\347\034e\307-4\001qOD\377"
+	.ascii	"\223\035\273\300D\303=\261d\353t\262\343\027\225\330\374S\232"
+	.ascii	"\354"
+	.string	"\030\206\244\032\376\251x\203l]\f\241GlN\212\230\203l\035K!FmN\252\250\203l]\212\241D<\274\024\321\007\331\0169\024\007\304K\025\205\220\355\215\270BD\334\024\261\b\331\002\345\004\031\211a\n\327\021\262E\201\310\021\354\034_\377\203\344\305\340\322\365\206\227\233[\353Q\034\017\311\366\263\343;\332\272\227\354\024q^\316\323\371:\177\347\361\274\236\177{>\337\347\375\374\237\017\364\202\236\320\027\372C\037\367\210>\321/zF\357\350\037}\244\227\364\224\276\322_zL_|M\317\351;\275\247\377\364\241^\324\223\372R\177\352Q\275\252_\365\255\336\325\303\372X?\353i\275-\023\217\353s\375\256\347\365\276\376\327\230dT22\031\233\214N\306'c\224\022\343\024\022\303:\013p\271=Q\002\343\216R\332.\020\301b\215P\330.\024\177l\207\2010\020\347\262\343q\t\022\fE\335\350\206$\003\021\f\367\032\006\312"
+	.string	"\266';\336\351\242\221\211`o\262c\260[g.\202y\311\265\330<\200M\311\216\303di\017`n\331\261\330+\266\017\273Z\3311"
+	.string	"V5>\024w\256\262\343\261T\3037\020;O\331q"
+	.string	"S\3037\020;H\331\261\200Q\30222P\303;e\305\335\240\354x\300\234\260\004\361-;&\260IX\242X \323\020\316\004qLvl\300\322\020\316Dqw`\222\360\004q\327$;F"
+	.string	"\t\311\211\"N\320h\370\206\202\250@\321\360\r\005^ w\266\300q\3311\003Cm-\212XPv\334`P\r\027D\354"
+	.string	"\020\r\027\030Nv\374"
+	.string	"\256|A\304\020\366\b_\340\by\206p0ze\307\022\354"
+	.ascii	"\201Q\324M\3709m\036G\324Q\2003|\363\270\"\246\354\270B\233\341"
+	.ascii	"\035\227\233\224\035[P\243].\347\252\236i\277\023e{\3526\033"
+	.ascii	"\334t\227f\370\362N \253\321uM7\332\312\352\240\251\352\315\252"
+	.ascii	"\300\263\005W\243\274\223\375\tyaw=}'\312\026\270\274]\252\355"
+	.ascii	"\264\307\323\2727v\327 p\r\246\354Zj\226f\226\250\331\200\253"
+	.ascii	"Q\240\257T\331t\013\317\306\356\331\357\364\235+\273\266\305"
+	.ascii	"n\017\210\262\274\335\005\372\312\275\262k\253\f\261\273\252"
+	.ascii	"hg\370\372\324\363w\372\266^5\217\335\032\r\3624\232\251&\270"
+	.ascii	"B\263\334A\323,\331\263\337\351;\327\001\367\004\252\254\272"
+	.ascii	"QU\325\033\270\246\331\265]\340\246\231)\252\325\022\r\310\252"
+	.ascii	"\033UU\275\201k\232]\333\013\356\r\0209\210\330`\303Q\206cG\033"
+	.ascii	"\021\033e=\332j\360(\273\021DH\031\b\006\327\307\017\266 eC|"
+	.ascii	"\370\bR\006\340j\337\271\262z-W\225]\333\002\256\003\362@>\310"
+	.ascii	"\t\271!?\344r\216\310\025\371\"o\344\216\034\222G\362IN\311-"
+	.ascii	"\371%\317\344E\337\344\234|\316=9(\017\345\243\234\224\233\362"
+	.ascii	"S\236\312U9+o\345\257\034\226\313\362Y^\313m9.\317\345\273\234"
+	.ascii	"\227\373\362_\237\344\225<\223o\362N\376\311Gy)O\345\253\374"
+	.ascii	"\225\307\362Z~\313wy/\377\345\301\274\230\037\363e\336\314\243"
+	.ascii	"\3714\277\346\331"
+	.string	"\274\233\177\363\001W\377\322\037\326\250)4\305\256p\353u-\315\310\313\323\002\256/\335\032\325&0MQ\336\t$\307J4\005n\002\032=\373\225b\027\300\025\273if\271\252\273\353\003n\240oeMU\223]\315\013\256\347\212\226aw\355\365t1\364\356\261k\257\027&LSwOU\321z\001\302\256Z\271\005\334^\357\344\221]2\363\204\211\022(\326J\037\201\253\006\315T|\327\235\002{\273;\206\226\301\030\354\326\274\337\331\323g\277r\037\270\275\225\335%\357D\303.Z\376\266^\177'k\362z\251N+WVX\252\225\277\340\036\240\342\273S\365\247Uv\375\351\275\203&\3315S\203\272\233\236\274`\271\356\322\247\002\270h\353\326\335\265\022\325\233\365m\275\236cw\353\337Y\356\225M\267Y\006\270\001\256\252\246(\213\226\277\263\223\354\352\265\334\354\331\357D[\323\324\247\262\346.p\205\353)\243\334g\354\271\376\312"
+	.string	"\267\007DI_p\257i\032\250\262k{\300\025\356U\3734\252\327\003w\353\025={"
+	.ascii	"\356\357\364"
+	.string	"\261\274\335\375\245\347j\352\275S\2235K\001\327,\303.O\243\245\311\242e\220G\340\252;\335[\263>\340f\327\024M\345\021\270\300\340\203\273\325\200\f\356O-\345\261\252\031\200\320\250A(c\254\246D*IAAA\222Bk\240\")\0322\017\021\320\224b\221\\\326\236\001j#t\202\006\230\204`\332\313\026e\270\250\213\240C\016\364;\t\226\222\362%8\362\323\"\357c\024\223\020t\253D\303\340y,|f\037S\0045\253\006\207\247k\t\027\311Db\353\276\016]\3419NijO8\261j\344\323\036&}\023\364i\247\311\013\02188\220\361MY\257\374z\273R\334\222\264\343\375\001@UY-f\357\233#\302\002`\353\203\243\013G\034\336\246Nw\t]=l\205<\237\020&F\326\256\314\312\242\335\250l\374\034\354\362\255\352j\252\2779{lX\033\256-\336P\204\254\256\300\201s\017'\261\307N.X"
+	.string	"\320#\003\353\337\353\343t\326w\266\201s\306\357\301\345Y @\361\354\213\304\316dN\310\351\035\356\335\036\027.$x\270\351\343\310\373\272{\013\321\346D\346C\272 \303\325\323.\371w\277n\350\274K\352S\242 \321\304_z6b(\245K\346S"
+	.ascii	"\326!\375(\006\230\177u\334\333\036\354q\353\333:!\325!'\002"
+	.ascii	"\207]N\333\205\336\215\345\223\200\303\310\337%N\352m\314R\314"
+	.ascii	"\207\276\0173\274E%\326\306H\3268\226\233\035\225\216r\350\035"
+	.ascii	"pV\217\256\333\356\347P^\354X[\316\345\032\277SM\200W\242\317"
+	.ascii	"\023\266$\343cyBge\370e\354P )\241\312"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\004\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\003\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dd8c743554a33be0,"e",@progbits
+	.string	"(\265/\375`\003\n\375/"
+	.string	"\032Z\304\022E`\232N:\277rt\260\020\237\301^@\361\322\275\352\356\t\323\213\377\226Z\027\227\016\242Q,\237E\323\237\305\302\3735\t\247\247\215\316\f:\235\002\235D\026\215\215\201\231W\005\023Z\366i%\314\202\224\205\260\217\224)\356"
+	.ascii	"#\001\037\001\315{\223\356\275\005v\326\332\360\302\264\375y"
+	.ascii	"\215\325r\222\312\246\364\307\030}z:\221\212\361\300\tJ\201j"
+	.ascii	"\313hl\345\234\306g\317\300\3419GfW\354\336\313i\033\232\367"
+	.ascii	"\"q\232q\360^$#\263\003f\0076\314J\213M\265\3270d\351z\256\362"
+	.ascii	"s\031\233\035\325%Sz\325\356\275\306\234@)i]m?\264\302G\365<"
+	.ascii	"v\002f\227\303"
+	.string	"\177\206\017\244\214T\355\027\037\325\367\360\177\333\317%~&\361\363\210\237E\374\034\342g\020?\177\370\331\303\317\033~\326\360\363\205\237-\374L\341\347\b?C\370\271\301\317\f~N\3603\202\237\t\374\214\374Y\300\317??\367\374L\374y\347g\365g\376\371\377\005\377\307\371\017\370\377\357\177\337\1775\377\367\376\353\375\277\373o\367\177\302\317Q\377\347\376\307\375w\373\237\363_\356\177O\247\323\351\377\263\377;~\036\256\326\350\327g\321\320\266\226m\317}?\247a5E*33f[^2R\025\300\267\236\321\024\231\300\320\330\332\376\234\331k5Vq\203m\317{?\347\261\036\247\261p\253\353cj\313\006\360\326\263\231a\323k\212U\333\002e\356zn\335\323\256\355\371\356g2l\307i,\356Mj\345\021f_\333\3731R-\362Qe\272\365\\\327Zjrrm}\370\270\205\214\267\360\034\377\334\353\214B\271Kf\005"
+	.ascii	"c\340\234Im\317sb\270y\257Z\321\t\355K\252-{\341/L\006\304`\316"
+	.ascii	"aX\356:H\322+e6Lz0\265\r\300H\265s\fy\334;\2352\220\312\\\326"
+	.ascii	"s\227\020X\316\260\26696\206?\277\375\03180\031\277q\234\201"
+	.ascii	"\020"
+	.string	"\\b~w\371\245\202\212\247\005\030m\313X8\013\223)`8\251\321\247\020\254P\260\355e\f\317\nT\236\262\002\365*\206g0\346(\031G\331\215'yo\023\206B\345\326\232\300\273\234\252@\344\333C\362l\033\262\351\362\372\223\022\231\311+cm\317l?\2131\025^\353\t\314\246\262C\202B\333r\336\372N\322\243\245\311\314\013\222\236\342S\342\275\265}O\375-\325G\372\311\020([[>\300\\\337Q<X\242t\316\266@F\212\350\224%\335\260\265}\027\371\273GCA\241\234\350\332^\215\221*\227\255\357'\343\035\026\300,\247\246a\021\245\262\250\266\357\246\277\227\315\3443\305\345\274j\373:F\252=D\326\367\222N\224\\\025V[b\017i\245\017\340\031\253V\376\035\244\205$\223\224t\265\305\300HU\345\243\312\323\365\rD\217\t\016*\371Ci)F\251\355\373\307\337J\355C\235j\375)\333>\013#U"
+	.ascii	"|T\273\307\372N\"&=\261e\265\345i\244>\"\346Y\021\263\326\366"
+	.ascii	"}\364\363\264o\317\333\034\332\263\255\004F\252:\204\353\271"
+	.ascii	"\320:\335,q\265\265\203\202aW\316\037m\317\202?\303\341"
+	.string	"8\3042\272A\260\266\f\205\221*\2017\3539\320\210$\353\210\331\026\351\006\320\314slL\3333\340\317m\370\317\215\207\352\351\210][\276\214T\003\254Y\317l\324B8B\324:F+:\254F5\206vt\214V|0\2521\204c\207\347@'\262!T\024dDDT\024D,j!\343\205\375\272\226h\220\002\205\211\341\213\013A0f\f\341p\021Tc\250\005\215\240\027E7\202.\030\270!D\243\005\n!\030D'b\340p!\004\243xVE\252\352*H\023\266\331\331\033\023\250_\333\006\214,\223Z-\367Z\372\363\232&\223\003s\027Hf}\217\r\247S-M\250\210=\321\330\240\332\276\305~\246\353\250\216)\341\233\266\327[\256\357\2601]\374\310\300\276V0m\365W\032\013\302'B\350\332\266\327\372\236\262\340\n\027\270\266;R\272\212zR]\177m\337]\177su\224b\230+/D\332r\223\221\352"
+	.string	"(\353{\213\330&G\250\325\366\330Z\235U\266\344\324Y\177\023\351'\031\224M\226\264\375\027\245\365\355D\375J\n\206aA\355\234qxm\337\320\237\371\272I\261\316\313\313L[N\266Y\337L"
+	.ascii	"\274\371E\227\226<\007\377\002\341\264}?\377v\366\025\021\210"
+	.ascii	"]\340S[N\240d}[\355@\253\250`\265E\320U\335l6\251\362\332\276"
+	.ascii	"\233\177\007\200\257\25010f\f$\214\023\021\031\005\005I\222\341"
+	.ascii	"\240\002\021\261\232\332\006\021P!\203D\320et\353\006\325\003"
+	.ascii	">\343E\026M3V\330\25198z\322\267\\\212\223\022\fc\371)\256\341"
+	.ascii	"\370\303\rx\202\222\037\331\306\366\005@5\311\361 \263\302\356"
+	.ascii	"\241\351B\"N\240~~\357\274^7\"\206\261|<\345\326<]\343\344t\305"
+	.ascii	"(e3\031\214I.C\034\255\027\270\004\323\372\344@\223\330\355w"
+	.ascii	"\314\304&\222p\212Bsh\3708\005(\026\214\017\262\341A^\374\336"
+	.ascii	"\350\267\250\203\251(tlG\t\034\317\002:\232\317\302\263\352\306"
+	.ascii	"\321\354\255\306\361\245\034:\0202v\224[R\003Jy32<V.@\036\365"
+	.ascii	"\245\235\027d\211\037\344A\004\214D\360\224]\372\262T\224\372"
+	.ascii	"\0179\332\207^+\3155\237C\tE\200\2473\013\342l\020R\r1\340\006"
+	.ascii	"\202,hB\337\243\373\224N\331L\006\361ET\0228\275\222%3\376?\242"
+	.ascii	"H\027\272\364\023:\032=LI\336\323\304\031\266\t[\240p\315\260"
+	.ascii	"\031\375\267\312\3671\314\\\275x&\006\227\240\205~\331\3424\324"
+	.ascii	"\305K\026\273\357\347G\211:\235\355e?\001\fkU\225Y\006\334\001"
+	.ascii	"\346kx\265\362\266\254\n"
+	.text
+	.section	.gnu.lto_.symtab.dd8c743554a33be0,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dd8c743554a33be0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
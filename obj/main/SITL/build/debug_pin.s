@@ -0,0 +1,222 @@
+	.file	"debug_pin.c"
+	.section	.gnu.lto_.profile.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\274\205\242\255\006"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\354\301\314\336\005"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	""
+	.string	"\001\001\001"
+	.string	"\002\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002"
+	.string	")\301l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\002\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002\001\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.1b024547b5f1fb05,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dbgPinInit.3.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \277M\005"
+	.string	"\202\211$.pU\323\001"
+	.string	"\025\330\302\231qq\350\200\357\3435\376\237\njj\266\025G1\t\221\271\201\335\204UU\005\304\225i\177\204x$D\026\355-S\256\246\f\333\034\220\216\272,jE\260\216\242\031\366\220\320\212\233\320)am\2738J\3214\216J\343w\212\212\312\264\330\243'\247\306^\301\377{\212\266\254\337\347"
+	.string	"\360c\006\004.\032\2008\266Wr\265G\210\213!\364y\002\376\323\271\331\272\262z\267\263\0050\364V\022\032\377-\3010\263\236k{a\233a\373\n\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dbgPinHi.4.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"\262\f/3`o\032\003TF\0308"
+	.string	"zGp7\261\244\310\027\001J\254k*\023\t;\204\265\252m\275\f\261\333o\020D4\322+\204q\227I\304\315\306\266\345\2262\245\022\227\205IX\216\006\223\235\205\006\317\346\262\242\345 =\233\210I\206\207\310\321 \242\206\240Y\347\322bD\226i\261\332\356'jf\342Q\264\333\307\275\215\326\322\377\367\211Z\227"
+	.string	"2j\031P\371/^\\\276\002Q>\252\266v\255C,2=\322\224R\277\206\307\311\377\203\032"
+	.string	"\030f,0\031J\016\230\f;[\026o\035w\211E\205\311\350\177|\034\236v\2636\211)P\350c\207Q\370_\007\na\270\317m\013\332\"\264\315\b\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_dbgPinLo.5.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\262\314.3pO\032\003$\nK]\340\266\t\316j\270\304\026\013\177?4\305ZD\350\023\242m\3106\020\024\366\306V\325\300\375_ag\276C\353\366\373m\313-eJ\001\023\227\205IX\r\006\223\033\006\007N\346\262\242\365 9\231\210\311\006\210\250\321\"\"\246\240\331\346\322\242D\226i\221\332\356\007jE\361*\332\255\343\336F\353\350\377\373@\255Sx\210\205\240\345\277xq\271\nD\001\241\332\332\265\016\261\310\364HS:\375\032\036'\377\021z\020`Xy@2\214, \031v\266+\336:\356\222\017\013\223\320\377\3708<\355fm\022O\236O\307\016`\341\177\235\347\203\341>\2675h\233\3206#\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\001\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\002\005\177\003"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1b024547b5f1fb05,"e",@progbits
+	.string	"(\265/\375`b\002U\024"
+	.string	"f\346\210J\340\320(\035\360["
+	.string	"\351^ \3163\300<\n\223\364\"\254\037\304,\347N\2145d\"0W)\032\027\234=\357l\334\032Q\232\307\361\347\217|\345\311H0T\030V\025A\270,\007\337\234\n\217\t\313\224\363\277\245\b\211\242}\"Sg"
+	.string	"q"
+	.string	"s"
+	.string	"\365w\021\373\023uv\277\331\376\003\257?\356\027\367\277\377\342\177\220rW\377\017(\222\207\303\375\272\002\270\357D\"\333\017\006\321\0302\3114\347\\\021\001\245\274\323Tq\311\333y\336\217\3202LE\024\277\375\337\033!\317\274\261\001\236p\240\2755k\257h\033\310vj\273\332\226`\033\206\355\323\322\322\322\222\355\026\33376\250!:O=E\377\332yp|\275\211z\r5\303:\"\221\365,S\257c\371\332)\356\321\222\f\032\305\024\231\242b\212\254\250\371\332\305%k?'k\247\231\362U\264$\323\321D\221)j\362T\030\305H@\326\236\303\355\306\022\365#\353\371\243\177\203l/K\376\335Y\036\2158;D\373\345h+\306s\353\177\0038Z\316\371\332\217\354\235\177\217f\341W\021\003"
+	.string	"N\036\210x\212\300\223w\f\275<\333\343\365\331\023\353\263uu\027\225\b\204\230aC\322q\335\316D\344\306\301E\213$o\265SV\\#\344\357\371?\342a\324\033!\004\236l\023~\031\375+N\t\255 \264?>\226\377;x\324\227\264\220\217\365\3305\261E\326\264%7y@\275\350\303\021\222`1\202"
+	.string	"I\356\230\1774__\246R6)j\376?8O\003\262\007\260\226\320\b,\213q\315T22\331L%\300\253\025\003\222\t\020\032\204/'1X\f\205\327\214\213\013F\005s\0016\343\242\212\301*`P\275\3142\250NFd`1\0071X\204\227\013L"
+	.ascii	"\277\300f\256\230\353\025Z\205\265\200\305\262\001\304,-\224"
+	.ascii	"\026\312\207YZ\253U\213\265\n\315Z\231\f\004\264C\243\363\235"
+	.ascii	"r\271\242\236\315\317\317\246&\03154:\337\356\2449rl\no\n\356"
+	.ascii	"P\022*\001\236\234\344\027\266\003+ \200\002\221\272\323\001"
+	.ascii	"D\306\036\003\2225\354\220\245|#4\302x(\201E\204ype\241i,-\017"
+	.ascii	"ycs\330\n\277\202\333\034\214\301J\255r%\305*\247\214\216bR\240"
+	.ascii	"\275\224\205(3\204\263!\226\341T\003I\323\030\364P\361\222\035"
+	.ascii	"\357^\312\346\246\215k\273\341\206\027\314~\313+|\235~\335\031"
+	.ascii	"[\361\030"
+	.text
+	.section	.gnu.lto_.symtab.1b024547b5f1fb05,"e",@progbits
+	.string	"dbgPinInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	"dbgPinHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304"
+	.string	""
+	.string	""
+	.string	"dbgPinLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b024547b5f1fb05,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
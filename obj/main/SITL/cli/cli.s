@@ -0,0 +1,9738 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001R"
+	.text
+	.section	.gnu.lto_.icf.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\212\017\365D"
+	.string	":i\b\0309 \342Nc\221\026\001\352\021l\335\274\320b\226r6\1771v\013^\352%\237\001\327\026\274\007"
+	.string	"\340\377\377\377\177\326\377\377\352\253\032\264\034\025\177\254\220\335\275i\251\211\320&I\312x\001y\001f\001\272\312\247\321L\332\223\226\263r\212\211JT'\037\025]\222\200\255\344\270\206#\252]o\177p\">\273\271\371m?H/]0g\332\035>:y\330\257\037\233\255\253\016V\250lf\2679\207\303\276\365\257\342\221\351\235m\320\321.\035\3053\r:J \2409\031\b\234"
+	.string	"\264\006\243\303B\f\372ie\266\326xAS\337\006\343\030Y\320NF@r~*\0208\2017N\204t\273\2440\201:\350\255\221M\202>\344\225\236\311\b/\242\035\036m\323\264\220^\334%\204\007G?\372\237h\341d9\030 \245N\375\255Al0\340\002n=\324\n\331\340\034\003\275\355\354\031\346-\320\260X\240\235\241\002\246\004S0\3003\221K\327_\377h\232E\224^J\372)\211\311\rL\np})\254\371\266\330\305\312\200Y7\216H\237)\321h\352\031(@=\025\200\365"
+	.string	"n\275\374\024C\304\2675`~\374W\026\244\313\033\273\006"
+	.ascii	" \235\303\312\002\255Y\245\211\020\013\357\346\025b[?\262\236"
+	.ascii	"V\205\001\013\254\306\362\345\177\177YkcC\325\320\305\254\254"
+	.ascii	"&\374\f\234Z\3247\255>\376\247\231`\364\360I_L.U\231(T:8Y\007"
+	.ascii	"\371\244\376\375\230]\233\340\013\037\376/\271\2056\347\234~"
+	.ascii	"\372?\355\264\275\365I\243\320\347\213\344\034\354\342\247\267"
+	.ascii	"\235w~\377\337\327\017@\305\004\\T"
+	.string	"\2437\235\266j\tT4\265\017\332\026s\212\256\226\211\271\201#\345\235\263\330\306\366\242$\035\366p\017q\203\031o\263j\016\n\365T\350SMk\363\352\211\314\206\370\330\310I\207\303\034\256\177Te\233G\260\211~\233\345\2302&\332\2527\334\372\244\r\306\320\235\344\222\f\327\360\f\327\030~\341KU\302\277-\255\022\013\026,\034~\205\303\247\320\205\227\315CR\355\322\025Csd\302\343K\270\204K\267Xw\314\225\221\bM\207\360\0020\2424V\225E\364\346\373\373\223C\344\301\374\205I\3518\304\201v\200\275\203_\337\340\235\032\244$\f\302\340\330\006\307\236\301\365\031\374\372\246\352\237\270<\264\037\n\026|\201\2023}\251\372gke\250\007\226\351\312\224\340\327'%\225\321\223\306C\351J\372\252\244t}\375\322\227\256t\24579\221<\304f\207\2562\222]a\351\320N-\305D9t\254\310+\254\021\207\324\313\334"
+	.string	"\301D\301Zf\214g7\240\222\016\0378\202\037x\234t\030{$\347\0267L\226\r}\215\204t$}\f\263 5\215vh\030\370\373+\3105\\2\n\300Z2=\310\030\357f\240,\030\214G\301\3026\377\274\320o!2\312H\027:\212\006\227\250\330B\277\312/s\216\0054\253;\306\265\"F\324\313\213T\241\251\231t\0021J\241\247\335\272\306.\024\232\252\355\272$;\241\341\2673Z\204&\002G\316\243\035\277\3528\302>\307\235?\022\355\303\225Ef\257\3418\216$h\335\332\337\327V\223\272\024\365R\227\212\212:|\247;\235\351\325\302Z{\333f\236x\264\022+w\232\215\033P6\356|\202'x\215\307&\340@\271\265\271}\266\273"
+	.ascii	"\351t\267\331\254\266\025\327fk\253\205\220V\212\233\214\306"
+	.ascii	"i|\306g\\\306\343\307\270>\214\303\177\361\027w\361\020oq}\026"
+	.ascii	"\217\277\342\372*\036G\025\271\250\nw\030\375\334\313\254\234"
+	.ascii	"\332c)\236\"\305\023\026\305\365\231\252\231\227zT\033\314\323"
+	.ascii	"\237~\342'n\342&\376\364\370O\247\036\2361\337\224\245\355\257"
+	.ascii	"\022\307^*_\026r\333\354/\263$!\272\252\355E\242\352\225'Fmw"
+	.ascii	"=\303\330\260\324l/\326\375\367m\264-\253\333\\\362\024\215\230"
+	.ascii	"\304\266\275\245\345:\2616\202\266\226\206\020\006\215jg\301"
+	.ascii	"\323/d\204a;;\342\361\341\252Z\225V\315\306\322PB}y\260\366\325"
+	.ascii	"~\374\351\247\".\342 \036\342 \256\177]b\276s\227\226gW9]\377"
+	.ascii	"\303?\\:{\331\243\213\334T\237\331\306Xm\367T\227\315\305y\247"
+	.ascii	"S\364\361\360\215\327\026\375:U\202\216Z\342K\017\310\355\222"
+	.ascii	"\230EZu\226G\013\013\024\201e\337\241+{0R[\306\212\246\346\315"
+	.ascii	"\351#YE\313d4\341\262\001\032\3262c<\333\201\344gXeYv3N1\ry="
+	.ascii	"n@\373\333:\177x\231\">\226\373\317\364Sj\264n\313E\270\027\241"
+	.ascii	"\356D\034\024sh\373\3212\\\233I\271\335G\313VY<\314\315g+\352"
+	.ascii	"k(P\016\345\031\244\210\324\314\354\366\036]\255,\354vwb\227"
+	.ascii	"\241\033w\353\321\261\2343"
+	.string	">\300\215\250\245]\272:s\373p\351\327&\370M\333e\271\355\314e\006\245\331\333u&<~r\354c\331L\232\037\302=\247\311\261\372Nn\275\023\353\233\310\206_\\\277-GC\311l\271]m>&\307\376\235\"&*\032\264\343PO\205\312o\326\270\334\331p\242Z\260:w\366\336\222%\207\217\276\267\331w\270\337\350\230\021\227\257\356v\243\344Z\311\365\3418\363\016\214l\263I\362$\217gC\302\355\337\326\203:\024\222C\270T\3727f\312l\347\351\231\213\210\fw\343\355;\347\235P\250\243\341\335\232m\247\243\206\200\333\310]w\344G\240t\336\262e\233N\236\027\367\270\202{N;\357\204\305\t\332rz\006\013[\234\334qFn\004\352t\263\347\246\271\267zs\2655Zn8\375\"\267\276\310\235'r}\353\353\210(\206p\243\201\246\251\002\204\265\317D=j\310\205\004y\220\013x\375\276\346.\267[\216\347"
+	.ascii	"r\375\037\327>\256\343=t\360x\201W\250q-A\204\020\022\231\021"
+	.ascii	"\021I\222$\035\341\004R2\210\206\356\016\022\340\344!\f;C$##"
+	.ascii	"\222\242\024\024T\322f\265\034\020\340\274W\231\241\337\243\271"
+	.ascii	"!l\223g4U}\246\301D\222\034\304\3602\205mG\255\274 \206\216\201"
+	.ascii	"u\355\367\250+R_;\207\272]z\317i\r\325\353\326<\004\233]t@|\246"
+	.ascii	"\r\254\363\300\321>\315N\373\367\367\007^+<\222e\205\201\314"
+	.ascii	"B\342\035\341\324e"
+	.string	"\366\337\f\330\273\220\007\301\022\221\n\224q\004\316\232\331\311\177\311-,\340\316\351\301\270C\"H$x(|\373\212\266G*\360\250\215\017\355\2254\255\257\341n\360\306\214\237\234\316\030\034A\271W~w\271\263\276X\256\250\312\302\003\276j\037n\346\345m\202I\230\334\031\240\311R\351=\270\030\026\326\272|v\252\2069\354\306\\q|\312\205#\216y\233\026O\343\241\016\241\201\217\316qV\274\224\264\007G\357p\222\034&\337\224\307\367e\342\254\222\270\026\212v*\037\243\373\2027\212\033\004\bZ\305o\2718z\3351\232\337\202\030|cv<\240\224\237\325E\346\313\205\001\3312,B\bV\336\301\rc1}Sx\311\312\034\360\307\r\354\373\262:\307\2201(\3756\250\037\n\247\017 \f7\264\244Z]\276\371\233}\234\265\\+\223\037\366\363_rV\244.\007|\325-@\342\310\255S\227\225\207H\r#\373LU\345"
+	.string	"\377}P\274\347\252G\005\277\t5)\211BQ|si\370\237\367\2763b3\305_\346k"
+	.ascii	"k`4C\365P2\213y\fIC\\\346\321j\232\341\214\372\231\307\351o\025"
+	.ascii	"#\352\363\303\215\275\215\357"
+	.ascii	"\270\362\337\333\b\207&\375\241\257H\330\353\377\032\2101\344"
+	.ascii	"m\3669\313a\217\316\213\275m\314I\264\334\262o\333\220\3738\356"
+	.ascii	"\317\t\214\202\032\364<\036y'\327\017\\-}\334\307\372\217\003"
+	.ascii	"`F\035\b,BU\025\005W\300\tn\341:\234w\27402\024\365\353\177\241"
+	.ascii	"\276\212\322\332\333\276\210\211.!\202\006\336,e{\n\337\266N"
+	.ascii	"U\352\240N\314!\004\346\316e\246\200\271s\034j\020\3560\342\036"
+	.ascii	"y\002\313G}NF\371\315k-\341\200rq\t\005L\204\036kj0\2445 b/\301"
+	.ascii	"\005\350\261\237\204\t\217n\346\365E`\354\301\216\276 E\375\267"
+	.ascii	"B\035\367{\f\353@\034\"#\234K\206s\327\260\333\250f\362\006J"
+	.ascii	"\017g\346Xf\367l\346\354Z\331\302.\231\374D\b\304.\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\223\"%@"
+	.string	"F\346k7\260\336$\351\f\365+?P]l\373r\270\314\227\237Y;8\302!\002\203\342\020\021\301z\034\036b\263La\032\207\312\342\222\372g\367s\347\216a\255]\372\250\355\275\223\fX"
+	.string	"_"
+	.string	"_"
+	.string	"\353Tk\300\340\276\365\307\214\fm\301\325\317Z@Vd\033\376\030\221\335\n\356\226"
+	.string	"\205\020X\257\007\f\\\320J%mw\201o\002@f\003\256?\331\242\322\335\247\253&\340\336"
+	.ascii	"\017\240\217\272\305\244\355\333V\247u\346s\361n\2734\0332\273"
+	.ascii	"/\266\277jC\366u&\025j\n\315g\254\266\315+\343\262\212\261\332"
+	.ascii	"\024\323w(\204q\357E\272hqg\201\272\367\356\275\342\366$\346"
+	.ascii	"Z\305xS\2408a\242\304$n\216H\023\021\"q\020\037<\334\357\300"
+	.ascii	"a\203\206b\006k{\025\006\263\336\027\254\207\026\262\275\333"
+	.ascii	"*\261\002R\310\233 !#\244)-\375\375 <\370:XM)\035\353NJ\357\307"
+	.ascii	"\366\242\264\205\262V\376\023'\217\265&iU\220\035\331L^\271D"
+	.ascii	"\211\265\310\364\335I\220\334\217\254~\265\221\342Mx\021\273"
+	.ascii	"L{\"w\246\245!)\344 \251\201d\"\245\266#\243\242\313v\242\241"
+	.ascii	"\376\360\321\203\307\250\035\266\365\323:\0161\3078\316\266W"
+	.ascii	"o,K\033=5V~\323\b\275\305\244\3173\236\267\357\207'C\272\223"
+	.ascii	"\255\235u\353,:\253?\007\345\344\377qV\207\363\306M\2661\304"
+	.ascii	"\303\321f\263f\235U\223&\205\3463fZf\235d\356\230\332b\2660\353"
+	.ascii	"\036\314\366\227\367\322\205\313j\177\213\226\274,c\371J\273"
+	.ascii	"\225\325.\303*\355\266\317\326"
+	.string	"C\233\312\337O\t\203S\250\242\\\223&I\241\315\022\n0\fDQ\242\305\230z\022\200\001I\niI\224c\n\0313#\"\"\"\022D\n\222\202$\255\001\373zS\221\006\002\265\301\016\302\335l\303\254\030V&\207\237\t\236\215\n\b>\3249\2159\025\257\303\326\210r\367\260s\244frs\b\217\272\364\334\017\210:\242\2703\r=c\032'\301x\202\303\267\334kq\2312\364\332}63\244\004T\240\213\r\366\331\220\220.\350\265u\353\030\017\336\201\273\367}\271\036e\330\371*\301\022\b\034\202\202\266\207\275\234K\001\213\200\334\315H\327\320\200\004\347\333g>l\303\\lYQ\022r\244y\203k\001\262\\*q\036\342\345e\326\262W\307\306\t\353[5\2275\234\236@\314\020nH\307\325K\273<\344\177\231\027\2022x\315\021\227<Co\225h\310p\275r\272\350+_6\nnY\272Q\211\376\022\016\023[@"
+	.ascii	"\201K\036\240>\016(\265;?Nb)\227O\254\032g/\250a\023\235\250"
+	.ascii	"\370\325\320\344v\254\224\272\374aQ\212\250\222\231C\235\237"
+	.ascii	"\273\013s\310F\247E v\374\342bdPa,n$\"\370\205|\337\306\205\321"
+	.ascii	"\207\300\0267\317%d\325\207\033*\247C\322z\202\212Ag\030{\250"
+	.ascii	"{(\366\214\025\004\002Q\201\002,\271\205\361\350\354\363\261"
+	.ascii	"8\204\273OH\242\205\352U\021\261\b\266\275p\246\202sS\307j\262"
+	.ascii	"U\333\271\276q\031\265x\360\366/g\024\306\251\250,2\016C\240"
+	.ascii	"\026\225\314\271\204H\036\377\213\243\205k\263\027\370d\"\231"
+	.ascii	"\"\2428\346\246gb~\316\201u5\037\354\022O\233\1775\332\206\267"
+	.ascii	"\235\007\001\234\266w\332\336n\255\255\375\207\205\225I5\377"
+	.ascii	")\263VD\fb[\003>\240\032\324\333\346\337`\270\013\030O\261\334"
+	.ascii	"?\376^P\025\3126\217\024\t\261m1\027\n\200\305\005v\322\331\333"
+	.ascii	"I~\300\241\026.~\300\017\307\"\367\206\013\373\020\0050H2\216"
+	.ascii	"2\032x\223c\nz\035\241\030\214\3474\207\013\2607\371\260\bb\336"
+	.ascii	"\301\027q\342\313-\024\032\t3"
+	.string	"\2032\354\245\240@\204\256\223#\311\346!\222Sqv8\n\242\315?\036/8E'y0\237\242\217X\004\016\t\311fC\b1\200Ef\032\315p\262\215\250\027w\334Y\232\272\322\004\243NPo&\233\033!\006$&\003\005\017\033\036\351Y6'1\0267\343%iS\254\303\334\265\022\243\347\241\2259G\033\213\222b\236\333N\340\354Q\303\350[\025\027\355\341hH\320\360\274\364\370\315\205X\304,\220Q\236G\345AI\313\254-y1\267\356\327F\3643$\026_X\3124\206\303C\247gP\250\331\t\n*\357\332E\272T`J\2358,\274T\tO\"\024LE\002\031l\256TY\001\t\024\251\216D9\025\301\215\342U\212\360\214\243\305\272\364+\177\205\301\274\201?\025\016'\237\372u\365\377@\257{\234\257\362{MZBQg\313~\303x\215\214\r.\017\262z\025i\321]r\256-\344\336b\311\272\232\177\271"
+	.string	"\223W9\244\226p_\315\007\003c\214x\177\201\241\344\2170\304G\001\344\230\276\304\250\311\366\306X0+\024\365\r+.T\0244*m2Y\221$\246W\374\321`!c\374h\356(\262\217\031\213\021\256\273\352H~\341\005[Q\301o\231\306W\235\214\241\001B&Z\313y\017\256+o\344\236\347\035H\0267\260,y\357\211Z\352SYm\243Qg<m\r\340\200\212\310\3754H\261+]+\242\244\t\312\265_g\nF\335\370\301\037"
+	.string	"\224\177n\n\344\007vz\020\f\347 \300\352\247\375"
+	.ascii	"\246g \262\340\333\3128\237\260\265/_\030\225m\r\231Y\316#\026"
+	.ascii	"$tKV\327\344\037\030g\361\256\0023\316\030\243\275\344\251\273"
+	.ascii	";\251\313\204\033\201\"\007r\344\031\240\343\364Z\177\200\244"
+	.ascii	"\346\016\330"
+	.string	"\361\263O\365\365\b\307 *E\nL\334\n\036\nW\344ne\024\331\235\267\030\262&U\005\322\334\374\b.\267D\220Z\267\324\271\250u\372\224\306\310\204\177\326\246+\341\201\347\365;\013\337\307\374\362\001\203-\237\224\240\333\021\3323\376\337V\252{\335`\341\373\"\030e\247YI_\217\326\310\322,rO\215\237G\337\320\f\007\372\233r\227\355\342\240j\f\2234\317\314\037f\202/\002\2138<\\H\203\247\237\207\nj8\236\363d\355\020\321L\021\331\244\270de\255\033b\b\r\245\203$\323\030=\333m8r\317z\215\020V\206?\240$=\372\250\225\2626\301\363\031\270\353\227\334\224\221\021;\306\230\277@1\221\262\335\336O<\351+\256\013[\357e`\030\001\215\204\377\272p5\005\037O\317%\234\332\360\374\023\336\364\nO\222\323\274\016\216p\244\002\333<\315R\t\255f\222\303'p\017,\"\307\3579\363*\230D"
+	.ascii	">1+\355|\334\001\230rq\312\253S\3116\243m\242\331\311}Z\271*"
+	.ascii	"\220\370\016\363V\003\237\242\204}\352\233\222 \272\257\362\222"
+	.ascii	"\357Pc\236\022\264HsC\330\346B\246\301%/\023&\376}\205\003\327"
+	.ascii	"\226\216\257\277\363\177\227\246\315\031\317\276\200\340c\364"
+	.ascii	"\033<\026\245\206}F\033e\251\001\263\224\214zW\376\221\365i\204"
+	.ascii	"\363\260\271\350\017ee\261y\004\0358}6D\220\\3\033\312\257 \317"
+	.ascii	"6\341\300C\246\037\352\027\020\225\032\033\376\373_\r\3078\304"
+	.ascii	".\352\362\351\007WZ\033\365\253\004\244\016\275\312 z\377\203"
+	.ascii	":P\226L\347\210O*\344O\020\3629\3460\001\377\007\247YN\255%;"
+	.ascii	"\225S\242&h2\344\213?\263\"\352{<\201\005\231\365u\375 \273\202"
+	.ascii	"`\305\252q\0231\325\224p\032\271\271v\352|@\206\333\34651\337"
+	.ascii	"\214jQ3\\q\255\013\250\272\355\021\256|\355p\254Q\255\224\376"
+	.ascii	"fDA\b\371\375\277\3253X\b\302@q"
+	.ascii	"\306\007\331s~\2666\030\244\020\322\266\216C\315\220\364\232"
+	.ascii	"\350\025\001\031\255\277C\342)=\3410\232`\263\360\356_+\001\025"
+	.ascii	"\350\355.e\207\260>\227Z\341$\211\201\003\214\356I\256(\033\260"
+	.ascii	"\370\016"
+	.text
+	.section	.gnu.lto_.inline.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`tM\205\314"
+	.string	"\272\367p2L \324RI\007\327\2538\214\361sX\236\344\004\206q\311\316C\n\"<\016/'\270\027\307\341\205\241\243Pk\226\364\235\232\237\261[\034\002\367\f\005"
+	.string	""
+	.string	"0\2057\357\212\326\034\307\225\365\370.A5\263\211\177\312n\250\265-i{K\231\002\313\002$\003\037\003\206\210\\M9Q\226\305\016\224\024g`\001\346>oo\237\207\347\341y\306\3442\013\364c_a\2742\321W\341+\023\027\307\364\300\315s\025\322ayU\331\227o\242\305m\035x\277q\013\004S\355\377\255\322*\022\303\245V^\201%\032gY\326z\246\247\347\245\255\337\236\247\242\022\316/\024\207u7\360\t\320\372\003\205\247\345\351\f>\025\236.q\232Awa\364%\371\177\007\357w\253\264\310os\323\376\273"
+	.ascii	"\t\004O-\017\346Q\305<\370\r\354\016\246:\375>\315;\307#\022"
+	.ascii	"%\316\302\211\211\310CS\202U&\357Jy\004\016\270\323<\263\306"
+	.ascii	"\246L\275\001l\327\335\344\334\352.\376\256b\203\323\211\263"
+	.ascii	"\260\320\331\003\376P\234\304\026BxT\020i\022\327g\200\247\370"
+	.ascii	"\261\310?j\022a\006W(\310\377J\361\220/\261DG'`\376{Di\314/X"
+	.ascii	"\203\310\220l\360[\217%\205\220>\300<\242VV\310\037\007\316s"
+	.ascii	"gO\210\007\374o\0163\314\312!4\005\216\342\210R\372\037\b x\227"
+	.ascii	"\277PL\245\273\215n\242H\376O|f\366\243\211\222W\024$\f\001\360"
+	.ascii	"\362?\321H\377#\371\376\037\270P\314$J\234\227\340K\374F\314"
+	.ascii	"|\244\023\215{\372\033\361\017\274U>\310\037\230\352\254\006"
+	.ascii	"\246%N\321\217&\377\367\201\367\373}b>Q\342\274\374nt\242\361"
+	.ascii	"D#\377\017\316\377\374\037\007\357\356\367i\266\001\377\237V"
+	.ascii	"z\272\304\257\357!i\253\202\220=\360\215s[w\027\275\212\t2\033"
+	.ascii	"\003\264\"\310lL}\021\377\353\344;\375\037\305J\004\231\215\251"
+	.ascii	"\374o\024K\021d6\246\350\363\377\353\360\225i\266uc\371\316u"
+	.ascii	"x\25638\017-I\232\275\360M\324\367\317\353\340\037\357\377\371"
+	.ascii	"\255\362\"q\360\324\377\365\262?\246\372\377\275A\376x\352\276"
+	.ascii	"\257\323\314BKr\246\236\177\246\007{_\276|b+Af@N\\x\241\323<"
+	.ascii	"s\333[+?\374p\373\333N\323\r\233(z\222\316}\356'F\262\2465\026"
+	.ascii	"\300k\355\327%\306\3622\373\232\347Zk\237i\3553\225\301p\212"
+	.ascii	"t\211\333\323~\024\373I\263\245.\2013m\246y<\036\211\220?\324"
+	.ascii	"|b\006'\204<\312\201"
+	.string	"\356\nrN\355\332\332\255]\333\357+5\317tu\261\335\314\367\377K\341Ka)<\227\302RX\n\271\317\2450x\016\236\203K\263\273\255\346\203\333\347\340\36698\203\273\273\270\037\276i\266uw\211\363\360\274\264\347s\023ww\223\177Uw\027\377\340c\314\363\300\373\307\230\237\342\375\207\3639\360\252-\227\315\301T\337\264\345]A>\0077\355p~W\2209x\352E\337'n\353n\023\377\03691*eoa\332T4Ai\272\224\316\304\302\013y\372-\213L|!\377-\213\236\346\034\2569-\244\327;\315\343\361\310\207\3169\036\365\220\350\377\026gd\013\032\023L\221#\r\343K\273\273t\025$\013\220\234\034\023\353M\313\237\003\n\312H\021\206\024\367\373O\237\230\210\02117$\032]\261\214\002\257\177b\272\037Zb\240\370\216,M\356HLLO\033\b|\377\023\300B& D\235C\210\016\3475\374\376\233"
+	.string	"z\201\013\362g\233\377\255\301_{zT\271]p\006'N~\247_\023\300\273\337\277&\200)\220L+\337)\321\370\017\266\024e\371^\317%\310\033\\\207\005I\024\t^_k\260\2205\262-\345\313Gq_\321\315\251\275uE\027G\350\373\177\300\326\355\001<\325\205<\200\251x~o\230Yv\314\346\316\3472L$_R\021\243\323/\212\340\033\243\177Q\004\243\346\022BuD(\275\036\212\213X\346\300\2414\230+\321\0347!\375/\344\345\377\313\203\215\0242\025\363\327\006K\251\323\233r1H1\264\340>-\231\030\321q\257\216\236n\23761\227/hr\344\207ob\332>\246Z5\313u\022\001\301\n\036\206\377\205\023\215\254\327\335\344]"
+	.ascii	"\300\367s\023-]v\364T\314\f]\022A;\262Cz\245\2233wb1|\377u\b"
+	.ascii	"\267\312\213\324\301T_\273\3351\210\374b\261\t\213\305<\370\227"
+	.ascii	"\263;\006\221:\370\006\030\343\327\236\313\275\005\243\377(\202"
+	.ascii	"[\2043\004\334\232\355A\203\305\332\254q\263Z\313\302\277\337"
+	.ascii	"\357\311\377e\321\033N]\"4\n\004\342r\204\036\fNl\232\333J\274"
+	.ascii	";\367\313\342\b~\205\023'N\374\004\2223\267;za\257\021\273j\266"
+	.ascii	"\\4\273V\207\232T\342\342$)\241\244\302\215\352\236\326\237\211"
+	.string	"\323\f\272sB_\276i\222\305\355\301k\265c\217\334\036<\265\302mA~\257Z\220ku(.\356\335A\003@)\005\024~B\214\237\226\363\377\026Yn\267\270;\220 \267\310T\237\337\250)\246\273\221n\302\211\306\022\240f\2230\202\b\177\b \354\303\206\337\";\324\247\376\203\023\215R\323\020\227\2572\340=x\342@I\312\324)z\007F|\305\f\256O\235m\270\322\274\375\256\001\235Q_gL-:,$I/o\f\242!;\304\007\370?q\232\226(E\026|\377w8\263;\360\324\027\271\303T\342e\326u\270g@\0375\257C\324\211_P\262\330>\013\026\333g\0262\270\273\227\312\355\2272\266\317\245\214\341\235\0048\017\177d\310lI\246*\355\n\222\374>\315\272\356V\272\005\253c~\n\252\276\202\023\215%\310Z\002\307,\220\247j\220@\246\332%yh`G\247`\202#P\342\224\251V\306'Y"
+	.string	"(I\260O\323.\202\037\306\277yk\352\340\031\035\202\375\236\217\244\364\342E\264x9\022"
+	.string	"\377\217b9Q\214\0041\340\016,\230\235@\362\320\224\3247@4\376\247\206F\360.\210\306\335\007\247\323\f_ [\"\371\312sY\303<\244\227F\217\211\275\222\224\311\373\275\2762\025)\232\356b\360\302\013\251\334ij\351\356\022\225\3230\373\276R\263\b\024,\343\006_\2567\257)\221\363S\277?VM\032.K\200\023O\316\234\330"
+	.ascii	"_\037\\B\254=):\"\214\020KPl\230=;H \360\335\372\006Z\326\363"
+	.ascii	"S\263\301\177\224$Jd\001\377{\003\027\n\204\227\227\301W\353"
+	.ascii	"\264\231\367\0135\3336\213\032\361v\363\037\234s\273\377#Zo\304"
+	.ascii	"U\330\300=\222\217\325tm9\371\300\211\207 \302Cf\276\006\373"
+	.ascii	"\347\032l\033\030O\240\"\242-\273k`?k\270\252\320\3330\311\304"
+	.ascii	"u\275\361\321\246\201\375\254\341\302\333\262\273k\340:z\022"
+	.ascii	"A\241\303\2361\205lIs\023|\245M{\006}\255K<\206(\210<H\257\265"
+	.ascii	"km\031\263\317\233\2661\276Z\373\265\354\245zZ\n\273}m\003w\225"
+	.ascii	"\025{_K.K.\205\333B\341\266\260\016\207\303\341\266p\205[v\237"
+	.ascii	"+w\r\363-\314\334\235}\255\335\257N\234\250H\227\263\027\257"
+	.ascii	"\335\335\347%\336%\007\314\307\230_\037\274\373\030\353\303\026"
+	.ascii	"\020Z\274\234\305\313S<'U\263\255pW\220k\\\336\334\324\332\322"
+	.ascii	"\226jw\255\313\346\340\251U\372JM90:k\366\253n\217\377\013\\"
+	.ascii	"\272R\323h\006\247\247\304\377y\360\356\372\321\302R~\257|\224"
+	.ascii	"\311\263R\364\265\232O\314\340"
+	.string	"\364\220\332\210\t\272R\236G\325\377F\322\335I\327q\250\237\022\017NH\205r\360\\\036\256\037\245\332\330\234\221\001\216\343[\200\306\324 \315\301\025bB\300w\370u\370\026U\033:\302\216\024\024\237\232\203\303\203W>\207%\032w\267\334\013\207\302m\341\360\302\341\022\203q+\363\023\274\220\373\302\245\331xK\226\320s\337i.\031\242-JR#\331{b\305\306\335\3528\332\005u\314Y\035\324\006'\251\033\204\304\361\216\003pY\357\006Z\026\264#\343|\377\226 \377\023\251\333C\324E\003\376\367\006\343\245\001\331z\334m\214\tC\227U\276\006\325c3\263\r\356\316\031\025s\316\0241fz\336M\021#'\254\300\bY\301\r<\204\313\333\330\307\234\306\211\306\235EClp\002\213"
+	.string	"\236~O\030\371\342\200\377\2360\242\301grt\230\260x}\024\267\tQ\202\204\021\362\257\301m\n\001\322r!\001\030)\301\215I\350\fO\335\341\\\352D\243\327\334\323\037\311G\364:\321\253\211\363\264\230\201-Cq\213r\007@\330\025]\237\3524\373\212\016P\321/\305aW\203\246\240\360\375\1771F\276`=\265\256'/\204P'\032\347\n'\224N\r\336\350\277H\276\340\237\352\351\235\270\311\016\375\241\\hON\230\021|\313\374\2551{\264\201r\346h\356t\242\221~\217(\212\260z\372M\372y-\037I\257\376\233\364\373\017d\317\b\033!\232+3.\352#\217\223/A\001\320\377.\312H\027\323\306\364:\302\216\316\351\034h*\006?\321X\202\224b\262\356F\361\305KtH\317\210\242\357\235"
+	.ascii	"m&\363\356\022\217\215\261\203\342\263a\032\361\005\215n\255"
+	.ascii	"\312\250em\022t\357,\016\246r\001\350\211[\017\006\253kG\266"
+	.ascii	"\231\377\342\331\363\205\367\242\006\307"
+	.string	"\371Q\345M\370\235\263\377w\213\312\035\232#.\316\362\312\246\374\255\256\234+yhI~\3378G\372|\021\001\374\302\3317\377>\351\307\0257\310n\215lm\205\342,\327\256\233\207u\027\215\276mf\230\"`\340\276\336\340\264`|\353N\267s\223.\3218\217\307\343\221_\305\n\211\211\255\025\032\fG\353M\026\376\372\206\001\363\272G\006\013\n\222\207\210_\317\304sE+O|3X\210\231AWkUv\345gP\t\344<\216\007\266\312\b\211\203\247v~iL\"g\262\340}\315\367\213\357j~\t\364\344\213\213)b\374\200a\360\365\362\247\215\313*\351\373\266g\307# \002\272\216\307@\020|\335\026P\331\2266\026ajr\262`|\333\376J\366\327t\027\313/\033\321\310\313|\325d\315L\226\022\306\270\242\370\270\333o\327\266\313\376\276\274\030\257\300\035\035\340B\033rE\202o\332w\253\353*\213\336\013t\344"
+	.string	"B{\242\357\226\023\215\233\342\310\374w\303\306$\301'\215\003\036\313ssu2u\213\230C\320$9&\205\3619\246\251\370f9\321\270P<vu\007\214\305\237#sw\026|\257\330a4\340Z\371O\315\211F\336#;\fPa/\257\037\331\001\2033D\316\f\005k\232\f){\333\267\n\225#\352C\235\365\201o\354\357\333*.\322\007\276a\347\367\211\311\224\311\251\371}\317\366L\243&Yw'!\255\331\211\306\305B\303\007n\355M"
+	.ascii	"\337)l\274\314\270\034\260\203\347\320\237\267}\313N4./\345!"
+	.ascii	"\253\262\267$\305{\266\304\261z\235\271d'\032\367D\343\213\350"
+	.ascii	"\022\215{ n\362\374Ac*h[\200\2440\026"
+	.string	"\fV\210Y\353\327\210\277\3019\024\016\207\335\302\332e\013\313rv\235u\322\3563\245M\303\f\323\265\304\312\236\016\373tiJa#EL\322\353+\024\007\331\372\002\205\200\327&6\004FD\213\357\\i-\313\262d\356>\363p\273\317C\033\230\215\0246a\373a\2478\017\007)\275\360B\214\2630\237C\232Z\032\027:l_\3033\361\215\232kc\336\314\375\314\367\311\316=\326\324;\"\320\024\242\031&jy\317\373\236\035#\032\261\346\317H\276e:\367\323\013\221\225\271$<\204\235;;\204\270al\330\376\3375c\244\013\333.\376\247\215\371\245\244\312\332\262\265\330\257\377\2271\233\270\031\362\301e\276\354\374T#\004\211a\033\340{d\345\366\320l\211\342\177\326\230r\362\350\201{\235\267\355\220\245\273\267:\013+\213\243\300\024\203\227\005\310\343\276g\205\260\035\217\211~?\024\313\035\217\204\214\350?\277\003\221\343\221P"
+	.string	"_\343\217Ta\013T@\030\2241\256\267}\273\242\2246\210\n1\324i2)\272)\241\223I\321\rL\212\317\304\004\261%\321\2515\002,\013 \025\001\205\324\250c\b[\026#\035d\f\315\210h\222$\035\003\023@\340\2008\024\020\314\345\363e>\023\200\202\310\250!*9Ns \306\214B\210\210\210\210\210\210\210\210H\232$\035O\322`\361ys\327+\030\322j-\b\364\t\3212\035\267\226\244bq\034\t\260\357J\226\003\220\224\027\225\255\032\177\362\254#\324nT/}\362M\200\213\210amDJ/\263A\233e\350+\t\254\212\335\245\342'\3438X\tx\"J\331\231\310,\370\354\250\fD\334\314\333\267>\310\334\362\362\321\230\270U\251\262~w\244\312\306\356|\352\b\254\034\301\220\0311\340\331\324\311\001a\222\305\245\f\244F|\207e"
+	.string	"\347\276\225\337%\3125`-\232\215\325+6\2335C\r3\313\336{\204\347\336\356\301M:6\366\267\332t\206\276\360P\026W\367\232\227Y\272\324x\373F\221\r\305\362\201\027\373\035@\263y2\263\374\242\321\034\345\312\005\017\024D!\030\031\355\237d\244\215\001\020\232\326\273\323\027\242+7\203Y]\2032\352\235\262\"I\032N\364\205\323\326\270\377L\313\027u\316\224\017\330\"\334#1\345\300\\\372\350Y#=h\274\301\016\211O\025\300\333+O\317\n\352\004\354\002\217Z\337h\n}\023\342\020\216?{\244} \277\201\342\306\212?\\\"\315\346\"-\033\323sLZ08\266\302\360C\246\035}#\237\230\t\035&o\365\207\212 o\036\217\255k\327\245\t-\\\242g\205\227\n\244\006\3745\374L@\235\360\017\210hQ\376M\203\305>S:\024\236\372\030"
+	.string	"\211\355\032\023\350W\313\363\311\2549\2455\223\344\313r\024\346~\265\232\353UDX\324\305\355\274\264;\300?\3031>&&\003*&d\202T\271\b\327gr4q\311(\f\2700\256c\nk(\354\244\001\226\202\336\033o\035\275\345\257\207x_\023\214S\220Pk\372\373\275\220\270\353Z3\306d.;\201\225\007\240\350\217\346\3048J\314K{\301\257\t7\366 5\350\217|\303n<\205ofw\177\231\220\bj\007\351\262l(\212\005\032\234\200\020<\370\315\246\314\362\025\231y\347\321\034\022\324\256\271\211\210\307\370I\2714\227\316\276\350%\377d\273&eR4\214\346;\367\001,\313&\277-)5\020\177\f\274\331\377\377-\216\034H\005^\317\356\332\306\334\246@\200Qz( \225\0011\350\241\361y\226\"\315\343"
+	.string	"Yj\204\032\036CGV\271X35z\250\340\254\232\353\240u\306\016\203\306\220\004@\241.E#\005\277,\323Q\3512\330\323\250\306Y\322S\254v\266\nn\276i:fr uZ/\213r(%+d\215`d\3760%\310\216i'\305\227\220D-\262\321S\310;O"
+	.ascii	"KZ64CF\033\316\261d\344;A\001\002\002\223\016\201\262\264\tA"
+	.string	"\312\301b$\020\377\350\\\tm\026\334\375\201\210t`\201\223\0023\212tD\364\202-\342:\376\375\004i\371\357\201\374\362\335\246\251\n\240q\301\024\21599D\304Q\374\240K\375\231OR1\320\341\003sw\3442\361\037\0033o\303&M\344<^b\271\277@<B\374\260\236\347\033c\356\031\373\365iU\007Z\233g(\337S\223\"e\332\341\363\321\f\244\253\240F\245\242\203!{\277O\310D\352\bdq\300\300\013\\:\370\322\363\223<\022\2568\264b\177\262%\317\311\350W\021w\207\004?\352\213\346\262\225\250W6\026\020v\325\227,h\216\365\311\3162\217\300\272&)\2250\024\202*\243\327\3714\330k\314Yt\301\301\207N\tK\345nx7Ly\206\203\326;"
+	.string	"Uy\007^\343\241\203\367\225p\013"
+	.string	"\312'\003\200\311\276\337f\237\370zn\231\231"
+	.ascii	"\202t\220W\30378\320#\247\321\353\345i\240\305\242]\245\017H"
+	.ascii	"\272f\273\037\276*\314\311'\031\213)\023\253/\352\310~\344\273"
+	.ascii	"\022\337\263B\016\310*\333\325\247\331\237\274\305\245\31591"
+	.ascii	"\217\233\345\365y\204\316\360\r\376)+{\355l9\030U'\334y\034\024"
+	.ascii	"\363n\235\325\303U4\212\027\3018\241@\210\205\016\232\031v\341"
+	.ascii	"\243\254\350h\024\313v\2159s\013\342j\232; Z\351n+\bQ\360\267"
+	.ascii	"'\220;wW\024\226\020\004d~\\\340\330W\n\200\246y|`p\006\016\241"
+	.ascii	"\265\242!\353\316\001\315a\214\242\375\310I\035\235tk\320\177"
+	.ascii	"_]\223\006\\\240\342 \016\261\002\307\345\"\222\236\337\300]"
+	.ascii	"\325\343\304)a\300\272\213ip\001\214O\303\311*c\310X\354\265"
+	.ascii	"\b\007\337\233=\357\\>ha\372\276nb\346x\304\t\274\313\221s\""
+	.ascii	"'\030\021\212\217\263\347\003\217\362(\200#\360\2477\325\375"
+	.ascii	"\246\212/\362\250\205\203sU\024\334\254\344\357\355O\346\275"
+	.ascii	"\344I\216NF\036\343\375S\316\370\177m\f\302\020\314\fJH\032 "
+	.ascii	"\006\252\236\0172\343\374\320\330\037\254\214V\031\315:L6\371"
+	.ascii	"=\371\007I\302;A\343\366\215\027T\023"
+	.string	";@w\353\2078\002\267E\221\260\205\177\212r\375N8h\272\354\374K\024 \322\277\314\221\353\317\277_\022b+\345\212w\261\311\317^\030\334\313e\273\031-\264i\270\232\315\025\020h+b\323\216\314\023QD\2237\033\341S\224\303\262\023\220\334{\242g\273\204\245\342\354\204ph\"%\200EC\250\013\337\"\006\024\002\326Pe\325\211^6\313\310\253|\326\272\354P\214:\340\3614\250\312\222\360\232\245\240\320&f\215\031`\250\376(\354\364\260KPZ\030\364\234\2179\254\303<|Z:\213\246\2121w\323\227>\366S\356\2226\314\001\006\262? @V\251%\317\352#\310\025\223d\346\311*\312v(\264C\374\006\365\367[\356\313\372\230\274\266\030`\231;$\311\005\004\265\310\2074*\317\206e\227\305(%(c\302\220\255\177,\013\354p\225\362h\020b\230#v\242\345\234\0240\027P\252\026k+\306\320\252R\030"
+	.string	"*B\023W\373\252\2146A\272(\324}\356\005\342\372\236\2718s\350\020\217b0\tK\323bGu\262\274\224T\375b\200\024\322\024\026=T\205e\357ET\236\020AEzk\330\030c\276[<W\303\227\031"
+	.string	"\367\251] "
+	.string	"=~\263\351\257G\240\221a<\311\300\007\333\223&\3009^\223\250\025\365\301M\376@T\204eJ\234z4\020\206\207\320\023\252\337"
+	.string	"A\221Z#\004\022\261\224\330\327\302\274\344*\033\260\022\372\2205l\215\250\337\315\274\235\022\3213\221\357\3500\352\003e\271l-\221\344\tcg\205\303\030\374a7\036\243\325)|\332Z\r\320\315\022\354\306\374E\371&\323\240a[\215\007\371Cc\221r\247\356\023\207"
+	.string	"%\343|X\342w\226z|^\ne\030%S,?MY\201\334\341\232k\213\3350\220\306\351Q\334\241\375\332b\313U\235\322\210\006\347pU3\336\375\231p\350\235v\334\313\250\357\216`\300I^\275]\",8\027\277\001\212y"
+	.string	"\f\240\270\3417\275p\265]f<\237C\322\3554\372\225o\353\310.-5\244\225$\3177\230\357A\271 \277\217\211"
+	.string	"\202zn\263S^\3145b\3275\264\200\022_\246_\362*\264D\fj\206\343\030\304\025\342-\002.\241\320\323\204\013(\324\323E\252\327K\020N\nb\032\242Xb'\250%\321\311:aN\340.\026\353i\"\253\245\273\f\274\365\3742\037\020\005\007\346\345K2\002\216\254Zq\364\276\233G\277\201\345\254\257ng\332w\r\324)\036s\032[\362\021\266\376\376\361\336[\274}\3062\213^\020@)\017\035\255\365\265\330T\337\337\323\324\376\006rb\361\211\316\021\333T\207Z\202\232x\026L\336r\245;\352 VX:0;\f\030\357\b\005\210\263\312\313\304J \377\230v\035{;\022\302\375\262\350\274\341f+O\254S"
+	.ascii	"E\257\2108e\232\f7f\rO0\365\225fMN\030\362/D\366%\364C\276\001"
+	.ascii	"e@\247\214\270\334}\233\305\347H\017\300\005\305\031&\001Rz\374"
+	.ascii	"\326I_PR\365\036\362\377\305\237\002?\"\210\374\256\373\200}"
+	.ascii	"}\355\231EQ}\310\216Q\254\264#t\0261\251&\3454]\016R* X)zFI\262"
+	.ascii	"(\2123\305~\0019\245\025\3050\2233F\211\257jGd"
+	.string	"\312\254\022\271D\217\254h\261.\256\006\361\007\353\025x\213L\017#\262\016$\342\007\r\311\260$\275Q7\337\253\252\2718v\270b\2529m\005\265\362}3Y$\212\315\206\252\216\246\f\024\356\013\2006\207k\"\003\035\347.\306\336\251\201\025&\251`*\360\335I 9LR\216k!\312\312\337\224\352\336\377LBW\312|\220F\331\335\302~\345O\242\310\225\"\0132\"I\321\270F\273wI\215\273G%\236\266(\213\324n\2517\336\272\246\332\342\270F\252BuNo\330>\240[\360r'#D\2450\220\324l\276\230[\220\021\342GH\317\226;\361t\306nK\326\245\276\304\232J\241`\347\001\003\211\366\327\355^\326\211\352>lB\342\244\332\007\037\2559h7\354C\233x\377\224\261\3761I\3567\351\314\247\263\022dU\260e\231y\017\201\326\316\217\f W)QW\315\030E$\320:Zq\313\347\201\3225\236"
+	.string	"\3550\330Tt@\240\316\215!A\241\256LVM\227\307\317\2179\321-\211'\270x3\274r0\253\260\262\001\214\275\3160\362T\266\034\247\3321\26555$?\215K\204\262\020\032\231\271\342\205\212F1\300\032\030\362\276*@\320\306\354mC\371\021M\247\275/\030\373\300I\237\243\223\336\313x\t2\223\362\f\355;+x\262j ;Q\332\225u\244\375\300T[\236w[)h\342_\343\351\025\230\211\244\3209+iv\007$\r\2069\256\024(\231h|\370\033I\253\217\374F-\327\034\324M\225\353\026\300\307\2752\"\375\251\221`\3422Z\0178]\277$\327\222\227\232\001\3670\352\034h\316?\00623;\266\250\346\363\205l\233\323=a\240\214;\t<\215\204\021\036[\035[\352hA@ih\221\256\222\\Dy\340\203a\252\243\315?$\275\007J\227\b\201\336\247\305\300\362,\322\366\376MzQR\021\022\355\031"
+	.ascii	"\335\2428\355\003#\247\265;M\233O1\327G\336\201\344\204c7\366"
+	.ascii	"\024\262\230\243p\261\b^\314\365B\204\017\376x\204\344\375\223"
+	.ascii	"Z\224_\3156\215\204"
+	.string	"\261\327\244\013\242a\370>P \313[\322\336\277\203\214\233\0054\375\377\032Y\224\223\fb}\376\201\033\0229y\357\325<\300H\347\270\005v\365\370\025C\2321\311\210\301u\365\031s_\347\253GN\230o*$Z\224\276^\003\343\200\361\225\202[\225\364\302\374\317%C\233\365\270\354\253z\301\2075P\013\206*\235\331Tj\232\220\241\245\227x\320b\253\375\214\251\222\342\230\352ch>\020s\033g\373\357\035HA\267\025\202z\215\024gT\013\344S\261\262\277\332b\3422@\327\f\250\356\031\204\230\206\377\265Cz\257\013s\215$OY\301\225\265\037\200\244\304\331\214"
+	.string	"x\b\260\306\310V\342H\344T\272\276W\323#P\356\300\361\006\n\360E\370\364w\350\037\253\250k\210P\373\007\223q\177\324a\212BWg\330E\227\377,\b-0n\226a\303\312\325\246\265fB\334(u\272\224\016\262\207>\245\327\375\341a\213\241q\3162\267\201\n\005\300\345D~Y\334k!\331Z\226\310\354<\351]\240]0\210M\261 \310\\|\366>7@S9\363R\251|2\235\375\007\003\333\002\364JX\013b\315\227\341\272*\024\006P\204\377T!\013\235\370 !I\355\243*\001\320\272\310Z\321\036}\265\367\340j\357q\213\333\n\250\244Zs"
+	.ascii	"\005\206\224\311\246^VQ\233~d\003\224(9+\236I<\355\"\265j\002"
+	.ascii	".\212\3375g\230+p\307\233\2115\356\246\364\274\217\254VS\261"
+	.ascii	"i#\214\250\377\200C\336D\311~\275\n-\372\013\034v\320\342 \005"
+	.ascii	"\204\222\235\225\216\312\006\371\274M\245x\335j\\\366\242Oo\260"
+	.ascii	"\372a{\355.*\236\334\341\032\373\031T\261\227$\037\264(\234\264"
+	.ascii	"\216+\270D\305\371\271-\346@%\254\024\033\241  \2118\205\374"
+	.ascii	"q]2\177\351\322\252\032\357\367\364\023/z\037\343\206\033%\260"
+	.ascii	"\233\017\356\346;EZ\262f\304B\264\275\275\234k\034\334\201\\"
+	.ascii	"V\003\316u\225\356\334\246\363s\323 F!\310\242\n(]M\327\241\235"
+	.ascii	"\3045}\200\225s\270c\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a8b8e9593198327,"e",@progbits
+	.ascii	"(\265/\375`\303\215U\033\001\032K\251DY R\262\332\034[A\254\264"
+	.ascii	"Rk\017\230\237\217\2707\262(+)\336\374\373\213\317\214\273\214"
+	.ascii	"\177\027i\367vw\221Tz\001\007\332[a\373\242\355\332;\251\237"
+	.ascii	"\326\203\204\230\213\217\206\302\211\210\234*P\272\021\216\343"
+	.ascii	"\373\265\307{\304\275j\276\203\337\352\304\006]P\333\210\211"
+	.ascii	"\3352\245\024\003\004c\004:\0048\324\032W\006O\273K\313\300\251"
+	.ascii	"\247;\035\0033w\225\016e\003\247\202*\343V1nU\302\227`\302\201"
+	.ascii	"\333\bf\312\201I\007\357\033\372\204jN\303\366\2512\247(.n\335"
+	.ascii	"\301\303\241\210\270U\007\267\f\267\233\224\323\tu\001\024\r"
+	.ascii	"\267z\247d\327\270\325\265\350\352V:\r\225w\312]\325\3556\273"
+	.ascii	"\205\255\030\366\312\255\250\035"
+	.string	"\342\264@\230\265\231$`\335\366`y\360p'\035\334\352oXwg@\332\265S\032\267\246R\271\356\301\303\235\270\334\332\235bp\253\363)\214[\235\2734\025\036l\332\324Tx\260\336ii\001\017w\002\001\2236\002mB\256o~\360p'+7\275\361\035\322\223\004\226x\272\3046\0243\036\202`\022\302\243\330\256A\3336\301\037\240\304S%\236.\300\346\320mB\347\306\216\224w\022O\223x:Z*<\330.\200\315\273q\260\342\341\272\034\260<e9w\025\357d\326\336\320]\031\327\206\326\200\207\353\276\360R\336\250\247\250\310\234\272\365\032:'\302\303uXn\225IyJ\304S\"\265\273\204IX\357NpkGe\003L\035\340\022\252\253\274\306\272\316z\225F\301\244\274s<\3159\252\375\240E`}\311\003^\271\335h\367:\213\245\002\206u\005\264\025\335U\264w\332F\247ot\332]@G\312\373\363\364K"
+	.string	"\315:s\355\211%\035\246#\230\222\340\022j\267\227\336\334\334\350\350pt\373\001``\232\007\275\204\207\353f\270:v\320\225\233W\035\002\017Wopk\353\264\253R\336 x\n\002\252\005\256i\207BY6\232;\327\"\360p\225\013\232\224\367{\372]Ca"
+	.string	"\346\324\323\316S\236\262\260\202\n\2372\247c\264wMx\270\312\304\255G\334\33255)\3005\340\3252wi\033\373\234\353\033\314\306\2469\213u\302\303\325\"\332\204~\302\303\325*\267\366\226v\032v\225\312\272E\322'\f\325\"\355Qx8w\343F\n\017\3474\270\325\007\326ar`\221\003\0135\324\300\342\341\374\213[=\225{\312\253\252\333_\314\251;\026\267r\257<\037\236v\225  \034\034\357R\336-\203\247]\305S#\335]Q8\301\251\370y\003\n\n<\2347q\25337\fO\230S\037\266\302\303y\005:\227\327\320\365\270_\341\341\032\r\313s:e\341\341:\013'\355D\213\271\231V`\335\231\013\300i\273\t\\sK\004`\346&;\250\247\355\275\352v&\\s9\367\332-"
+	.string	"n\357\332\275\204[\t\247]\323\216\323\326\302\303\265\225[U\251w\352\255\3624\345\336Htww$p\341\341\372\206\021\222t\341\341L\213$\213\207;\272\365\210\027\036\216\310\255)#\314-B\373\315\006 \305\002\303\303\371\340\035\267\353\264k'\272M\320\234z\332i\361p\253\306\301=E\244\273\253N\213\340\235k\033\333mc\275;\327\2346\300\035G\267\023q\316\275\321\254\3056\025\355\3159\313\271\346,6M\271\253<}\351\366!*\347\2243w\373m\024tS\321K\236\356p^u{"
+	.ascii	"j.\327\254\305r\263\026\353]s\271\336\341\\\273?nT.\227\353\322"
+	.ascii	"\234\305\336\232\232\232\232:\355%O\231Bx\021\303\303\241nu\357"
+	.ascii	"\306af\020\230\371\006\002^\033\212\356'\272\246\363T\207\247"
+	.ascii	")O\2030ww\345\2779\213\365\224\267w\003\341\316u\332Lc\330n\246"
+	.ascii	"1\2547\023\031\036\256oeN\335v?\270\346j.\327\314<\230S_\362"
+	.ascii	"ti\2069\355\264K\233\311\f\333\315d\206\365f*\016\360\352q\343"
+	.ascii	"\340\235\362Vu\373\312\231qx\003b\272\027^\270s\315\314\251w"
+	.ascii	"W\270\273+\315"
+	.string	"\315i\327\331<e\362\306\321\355\252)\236\312S\225\247\253nG1w\252\232\362\264v{\337\340i\337\320\325\323\352i;\233\320\335\225\233\002,S\0063S\027\001\325\257\355\276*o\030\210\301\375\202\037\254k\231\231Ie:\327\036\006\257q\2537\0307[n\262\334\352\235\r\375\005\353x\301.P\301\r\n\234\270\031\301\215\0217E\334\3127A\334\35272\334\352B\332\270\325\255x8!,\270\325\205<q\253s\252F'\204\211[y\225\313\t1\342\3264\274\n!\342\332n\212\026\362\303\255\334Bp@\203\213W\317\246\313\25568Hm\300\345\326\032\330lYZJbi\211\245-\236\315\013n\245b\206g\323\305\255T\312\310\342\326\022,9\301%\3241\274\372\360\321\234\305\332`\271\325\323Rm\204\3508\3205m\334\3525d\334\3525b\334\352\035\007\272\356\3209\266\373\241\275k\0245U\334\352\304\255\036C"
+	.ascii	"+j\214\250\242\246\006\210[;\256\321\341V\357\200\350\356\207"
+	.ascii	"\256\231\341V\357rlw\216\r\362\003*\242\360pA\216\270\025&\210"
+	.ascii	"\225[\275z\321\250\034\353`\004\331\341V\225\024+ l\334j\261"
+	.ascii	"\370\024\335@\256\270\225\246{@3\031LF\222$]\347XT\003\221\200"
+	.ascii	"\024AtS\321@\252\374@\343V\367<Wy\275\302?\276\270\265\353*\035"
+	.ascii	"EGC\2470\360\332\211\341\265\203\242\303h\377\201\345V\357\211"
+	.ascii	"\037$\270\265\253\271v ~\200\340\326\037E\334\232\002\321\336"
+	.ascii	"N\264\321n;Wu\350\356\003KV,]\201Bq-\201]m\261\332\342\2143~"
+	.ascii	"\bq\353j\213\276\026uF_\353\275\312\375\330\341V\313?`\270\265"
+	.ascii	"\353\232\360q\203[;\037Z\262\360p>\230\270\325\252\274G\340["
+	.ascii	"\300\200\245oMMMU|\b\341\243\206[\323\036k\250\230\b\2017C\005"
+	.ascii	"\001s\017.\267\236T\335\336K\364\210\301\255\3366\266\272\240"
+	.ascii	"\275\253\022\336I\324\013\264\243\252x\277\340i\312\235\205D"
+	.ascii	"\017-n\355Nmc\031\325G\364 A\017%nu\3561\201[\275\207\r9\232"
+	.ascii	".\267Z1h\246\340Jc\345\326\216\246\207[\235F\207\0178\025\235"
+	.ascii	"\202\341\265\3638\265\315Y\354\211\00341\334\332\324\344\235"
+	.ascii	"\202n\036o\\\036e\334\3329\017,n\365%-<\034\217&xx\200\013\353"
+	.ascii	"57\322]Xgn\034<r\270\265\333q\306\255vG\026\267Z/<\334\216 n"
+	.ascii	"\265m\334j\301\360p3\\\334\352-i\361p3\033\270\325\271\360\231"
+	.ascii	"\030n\355\266\360\031\254c\321}E\373\322\030\326\271\373@;\031"
+	.ascii	"V\345N\204\0164Zp\253\235\342V\357\234\016%tT\340V\233#w\253"
+	.ascii	"\367\020|\345J\3329^\340.#\343\016\350\226\261\234v\216(\376"
+	.ascii	"\331\346`\342\326\0346\310\270\301\345\326\256j \212t\211\006"
+	.ascii	"Kf\234\334\210\306\001\016\232\265\250\300\253\355\270\264\233"
+	.ascii	"!\343\205\024O\213\255\r\344FF\005\267v(TG\321\3162W\254d\260"
+	.ascii	"\254Npk\307\265\251\335z\236\214\bn\2251B\246\003\2672\327\274"
+	.ascii	"\006\326-\n\003\314+\023r-\303\303\255\226W8\270\3252\027\017"
+	.ascii	"\267\272r\253\267J\342VG\255\210XY\271\325W>\360pk\227\303\321"
+	.ascii	"\203[;*ix8\034[n\355x\215v6\232y\351\006\326=\227\003\017\207"
+	.ascii	"C\210[a8\246\215[\275\030\032\334\332\305Tqk\027\223\304\255"
+	.ascii	"\036"
+	.ascii	"\343\201[\273\036\272.f\210[\273\236\261'tM\001\346\224\r\017"
+	.ascii	"\007\343\306\255\226\323\026\334j\271\302\204\340V\017\006\211"
+	.ascii	"\\\256w\340\341`l\270U\007s\3527/n0\277\250q\253/\265\341\341"
+	.ascii	"^\210\210\200\225\027 \334\360p\252-\267\272\017<\234\312\207"
+	.ascii	"[\375\026F;\030\355}\323*\034n]\332\3219\226;\307z\337t\212\215"
+	.ascii	"[;"
+	.string	"\225w;\244\270\334j\315Xz\303\303\245\264\334j\013\340\f\001\327\302\257HaqT.\227\023\241\275QT\256p\232\032\342\326\007\334n\235\203/y\232\362n$\034\3206U\001\030<\\*\207*]\312\275\241\300\2019\205\273uf\246\231b\260\356\314e\224\321L3\244b\270\325\2753\332\006\317\213[\333k\327\260\305\255W\334\332\261{L\234\232\206n\367\224\367\016\216;Ws9\032<\234\267\304\255\316^\021\267v\031\270\265\343\324\363\341V\313\024\270\325\333\301\313\341\326\2169m\033\274\265\322\f\377\024\321)Go\373~G\234\215H\177+\217\242\304\300\231\223\347\235S\006\316\220\376e\344H3[4|~\3371z\216I'\016M\320&\373\360\373S\234\305\246\304\210\360\b#|?\004\250\365\003s\021\275\214\034C\333,v\023s~\006\242eQ\b\034*I\302\004\311\367d9\2421\322\346\363Qbb\022\317\257"
+	.ascii	"{\016\227|\035\207L\276/D\362\261B\022\004\360}\270\344\013\201"
+	.ascii	"\177\305*>iFf Z\242/S\002?\004\313\331\r\244\375i3\"S\002_H2"
+	.ascii	"\"\242\240\211\236\343\f\n\223ee$\244\262\343K\226\177F9A\364"
+	.ascii	"~\022:Jyqv\004\222\342\353 !\225/\232\340+\371\277\201\264\377"
+	.ascii	"\177&,&Lj\377L\230\034QR\373\377GI[y\332\214\2344\320\224\225"
+	.ascii	"\3509&}\224\023,B\201\207\234J\220|9_\344\303$G>\034<$JLL\212"
+	.ascii	"}\316\377\377\367`[\t\337\237\037\352\304\266%\337\333\226|\237"
+	.ascii	"b\021\005g\377\302\265\022=O\\\243\331\302\023\237()*\211\037"
+	.ascii	"~\257s~\377\2468\263\205bR"
+	.string	"\214H\b\316\013\243\342\251b\226H\226=\226Y\316\317b\261\036\035A)/\236\2408\253\275\216\214\034O\320t\001\341\337\021m3P\351\321\231\rD\022{d\370\374\276\310[>\277\224*\306\362=\277\3730!\237'rA\341)j\005\275\320k\007\3538\333\276\312\226\303\2572\212_B\225}|\204:>\277\312\341\367M\376\374~\347\311\217\317K\210\347{\\ECF0\230\020\017\020\336\021c\240\211\242\230\004\022XHN|\2045\002\213\004\313h\222l\234!\201\250\350\344\345g\250\365CDAC\316/\347\317\357\215\374\371=\216\bl9\024i8\024CR\374\244\030\n\036}H\2024Z\311\263\203CR\354x\312\254V\003-\207\336\354\b<\307\236\032f\311\310\221\264\241\037\212#\3228\253\321\306\363Cq\234\325j\255 |\242\230V\232\035\233b\b\2263\264,\217>H\b\366\344\3702rDM\020=E\023"
+	.string	"\214B\013AT1\226\233\241 \031"
+	.ascii	"\222\026\202\234\220\244\205 /\354\275\3271z\226\263?E\031\t"
+	.ascii	"&\305>\024\225\300\223\264\275\216\030\226\264\377\001\342y\031"
+	.ascii	"9*\201\342\354r\370\275\f\307f#\210t3c\370f\003\177\360\371}"
+	.ascii	"\r\244\241\370\374\212\300\360\371\275h\332PPDz\341\223\266\203"
+	.ascii	"Q\361\024M\313\263\0318\232\342i\303\245\222)\236>\330\024OS"
+	.ascii	"T\022M\036\034~\177\033i\247\r\337! \027\224\373,\300\212^\247"
+	.ascii	"\347\325\n\n\022\342\371\227\nB/\024"
+	.string	"^F5\214\332j\344hy\005W\317\353\307\362\221\005\204 \016\003\271^\257\026\024\036\217m\337\315\314\3017\220f\204\034i/\312H\320\304\301\347\367;\"\r$\037G\025\023\303\217\243\2129\261\214\034\321\262<\022a\252\030\030\276\256\024ZD\367_.(E\277\302\217\217\020f\205\"j\226\265\232\355|\264|\255\2020\002\302\217\305:\322\302\373\b\275\253\347\207\250\310H\350]@?>B\260\241w\025\265`\317d9\242\265\362\303q\006*\221?+\016\277\357y\265>\374\376\345r\251P\344r\362EB\257?\277\037\354z\362j\301\336G\350\213\214\204h\270\350e$\304\363E/W\220\321\023X\353{~\200Z)\274~zp\217\013\350\247\345\363O^?D\260\326\320\212\237\274~\214^?E/!\236w\301\204|\\N^\005\327O\n.\330\273\210Z.\240\241/\362=\256\"\036W\221\253\347]0\227\nO$"
+	.ascii	"V\305T\376\327\317\303\204`0\027\016\016N\f\377Ne\034\034\234"
+	.ascii	"\216of\345\033Z\371\226\344\310wb*:\360\372\305\027\n\360\352"
+	.ascii	"\375\340\341@@\342\326\246\246^\n\202\205\0310s\217\001\202\017"
+	.ascii	"\267zw\223&K\335\245\313\351\350x\355A;\020\026\204\036n\025"
+	.ascii	"\302\303\375\226[?\214[\273\317\342\326S\312\255\f\270\366\240"
+	.ascii	"_\360T\025\203~)\276\0045\227\373\233.7|k31\351\276Y\276\016"
+	.ascii	"i\332P\321\374\022\375\213\2167\361\276X\233\202\006\231\"J\272"
+	.ascii	"T1K\370wf\270\2103\013ECA\256[\344>L\350\211\302\257\b\022\""
+	.ascii	"\243\240\177\362\372\201\025\021\035\341/\321G\305\363\317\017"
+	.ascii	"\007\207\243\013"
+	.string	")T\315V\232\262\307Q\305\340\360I\303,\026KF\216!9:yq\241\007\326\022r\362\302\254GE\"\031\366\370\024Q\320\264,\232\240\224\320\004\223R<\233\201\035\247X4\301\243\023\223\345x\232\242\222\347\203a\370,\321\317)\311?e\330c\024[>\277O\321T1+6\305\333H{\030V\305\240\342\031\3035\220\326\361\315\006v\234b\217Ql\212\350\t\322P8,\316\304\363g 9\312F\263|\321,\321S4/\307^T\002\317\031\026\225\300\363\304\261\027\223\320\017I\221\206U4\220t!4\301\362\b\007\377\216\212\377\374:&m0\234b\227'\312\300\032\221)\016\235\242\f\254\021\235f\211\306\304\363_\274s\222\345\210\216&8\364\302\266\363WL\024\212\247\355ul_\023\"\237\244\023\234\371\3300\222\217eS\362\275m\004$\337\237K\276!L\202\"\355\377\231\324~J\214\024Q\020H\t\367\374\270"
+	.string	"s\301\214\212xZ>F\257V\220\f\263\036\025\211x\360i\212\246\r\215\201H6\022\244\315\360\255\204#\337\207\243\013\266\030m\207)\336\306 \025\243\3478;q\353\205-\2071hI\373\331\f\\1+\374>\007\263N\324VCm\345\317f\340\313\310\3614\232aV\310\202\271\234\004\031\275\276\310h\250\310H("
+	.ascii	"\334\3632\022\"\372'\257\037\026Z@C\277\203\303\357obH\216o\226"
+	.ascii	"H\345\213&\374>$m\345\3712r\234\002\316\206x\260}\341\360{q6"
+	.ascii	"\"\225fMDAs\305\277#\326\246\024\275\214\034\223\320\262\244"
+	.ascii	"\021=\017\354qh\030\346*\002\372\361A\361\357\2104\320D\372\025"
+	.ascii	"`\337\3638A\030\350\205^*>i\341\bG>V\370\251Pr,k\250x\276\217"
+	.ascii	"\017\020\376\027\222\302\357w\220\220J\324\026{q\206\242\245"
+	.ascii	"\231\204\276\2504\242\261\326\343<\017\231\2016\022\244\345\244"
+	.ascii	"xH\211\332\300\034\024\233\345I\212\247\013\261S|a\221,\311\023"
+	.ascii	"\207\337\233\342\021\315F\276\320\0179\016\371`\221\006\236I"
+	.ascii	"H\360\007\207_M\007\3030K<z\264$?\234\331\312XM\030B(\222b\255"
+	.ascii	"\254A\305\263H\023\035R\254\225?"
+	.string	"%\004Es\006\3769\252bX\341\367%\372\341\367\264\322D\3720\374P\263\034\372\230\025:!2zST*?\264\201G\217\0045\313\241!\314B\307\233\370%z~\246(\245\fMP\212Y\372\340\260\355\373\"\177\204\246\007\347\340)\240i\266rp\370}\221$TF\212\263\227\221\243\211\022\365\340\227\320\353\370\370\b\375\316\031\212R\312\331\254\345\203\207\204\337\357\f\255\340\312\201R\364\344\345\002\002"
+	.ascii	"\307\276\337\351y\031\t\371<\314U\304\323\202\265\240\360\324"
+	.ascii	"\260\013fT\324z=\371!R\355\270\214\200Z)|\321\313\005\203\031"
+	.ascii	"\361<\253\307\365\344\325\202\302\363\257\026\317\237\037\021"
+	.ascii	"f=*\022\255H\331x\306p\b\226\263\023\273\202Z\257\030>\277\017"
+	.ascii	"\305\020,\201T|:\207\337\230:\361\377\371\245,\227J\246xZ\366"
+	.ascii	"\370\235_\200\022\024~M\242\304\312\031\317\237\337\033\361\004"
+	.ascii	"\315\360\355\273\035\371\235\363\024\3150\004\243\304@\224(\004"
+	.ascii	"\016\217\300\331\b*\201\177\003i/\214\347\016Y\216(h\332d#\022"
+	.ascii	"Y\362\030\341\235PDc\"*\206\177\226\346\224'2\034~_\232Sd\237"
+	.ascii	"\342\327\251|~M\316\317r\354cu|\206d\031\023\317\257\031\001"
+	.ascii	"\341\263\350QR4M\033\317\353\3140MD\317)D+\300\204`,<y\235pD"
+	.ascii	"_\347\373\302o\307h\210\307\207\207L1E\024\005\217\236(\374r"
+	.ascii	">\005$GXG\236\310\207\337\357\2102\020\235\225)\354\234fi\232"
+	.ascii	"\256\347I\362\263\342P\254\005\207\304\250\323\007\233\026f\235"
+	.ascii	"RHFdd$I\322\001\223\022@@\200T(\225\214\245\333f>\023\300\300"
+	.ascii	"I$\321\210H\030\213\206\343H\022\003A\006\001\0312\206\030C\210"
+	.ascii	"\204FD\222\244\003\b\206\2005q\036\313\324D=\241\230`\333\267"
+	.ascii	" \342G{{1j \026f\333\036dXu\204\004\\\235$E\346\334U3c3\344h"
+	.ascii	">l\350\020\037\026]\344\032CuR\233~\374\335\217c;AQ</\357A\025"
+	.ascii	"\r\bw\236&c"
+	.string	"\212i\202$\242eh\267)\331\035\200\024f/\236\t\212\206\256\326\236\267N\013-Lq\376\250\r\350E\035\027\356\326\346\345)\256\352nQ\3261b15\265\027oF\2464#L\221\345\004\016\t\271u\003f\345\330)>n@\335\364\373.\317\317[\275d`\377\377\037\370\006\323\0311\366%b\016\2614C\376\303\370=\340/\025L\177b\3566Ya/-\306A\373 \023\231v\356w\324\260\350\267\247:+?Ry\\\022\332\3323\332AYl\355D\377\202\227\t\274\242\203-\365Oc<Ot\371-\by\355v\233+\216\204F\347\2760k\021\303\016\305\237\265h\330\005&#\327\247\371\017F\352\037\271\260\231\353\035\323\021\203#R\0040\323\336\035j(\212\210\004M?\023&\336\244\362\371\327v\032\225\224e8/\021\235\273II\026\255\353\rO%\244\376\331\354\337\325\276R\22405\2548\252S\314\233\\\253"
+	.string	"\326\013\203\367>\244\br\321\327>4n\320\\\367\303\207\342\306a\b%J\364\357\351\274c\265\271\322\r\277\325(\331\230\343\370\340\321\321\327\fD\244\343\204\311$%\r\253dT\2065C\336\313p\302\202\206\262NWH4\323\305\325\035}Jn\345\202m\365'\\G:\271\027\243\206i\334H\024\307?1\210Z,>\024\225\026\236A\006\t\250\212\200qaO\315\323\327\353\240im\222\366-\251\350\177\002\007s'\026\205\246\215\036}R\367\001*!\346\316\311u\253\344\243:>\376\247"
+	.string	"\"M\342\247Gd\006o\230\246\023X\021\2344;\332\032-g=V\022M\3464\316\226+\372\206E<\235\372f>z\351\240\342zX\343o&\227\201\t\323F\342\017}B\346w\237\207\026I\374\t\210\346\177\017\326fG4\373\232\256m\252]\223\342\245\002f\270\236y\334sg\264!tvR\304H\235?zM\277\312\002\277\350\021\254j\314\257*\355m\271\330\234\214Ex\022\202*q\220\2242\365o\361\271\273\367\310#\340\332\307\r\275\027\344{"
+	.ascii	"{\352\343\2005\206\364\234\244\265a.\346\324\002G\351\"6\233"
+	.ascii	":\215\214\231\325$\334\234\301_\266\367\377\302\350\234\327X"
+	.ascii	"\266\031K)\2360\"*\312`\351\210\202[\373\250J\250_a\334]\261"
+	.ascii	"\007\326\210F\024Z\026\250\307\340;Y\031\007\004\365@n\365\361"
+	.ascii	"\266e\253\325\235\255P\205\241B\202\365\201\352X\225\327!\304"
+	.ascii	"\247oIo\211\225\207kA\354\276;\302\273\367y\306\2023d\"\304\206"
+	.ascii	"^g\234\026p~\363I\206\216iDq\222(\345\312\331\206\316(\033\220"
+	.ascii	"\204MH8\336\375}\016NzC\272N2/tD\325%\366\221D\236\034\275\023"
+	.ascii	"\267\204%f\261R\344\202\263=\244o'X\3105\253pZ$\212\024\214b"
+	.ascii	"\374\036`\215\312\r\027_\244z\nnS\236\335`\377\"\212,s\244\307"
+	.ascii	"\357\247s]L)\250\264Q5a\022Xy\247\247\266\236\226hG\347\203\207"
+	.ascii	"\360\370Q\007\344t\321c\272\313\025&\212\304\365\221\236^\211"
+	.ascii	"\346\260)\2728'ofc\306\224\\$\307`\013z\002:\356\273\262\302"
+	.ascii	"\221\314U\323\204j0k^\341%\317\366\bV\307\"\322\001oQ\005\370"
+	.ascii	"$\"\\\243\302\245\234\347\343\263\255\016n\221\261\020\004(\005"
+	.ascii	"\016+\271C0qD\022\234\300\301\341\2408[\005\206\bi\347U\267\327"
+	.ascii	"\337\037Q\224\362\251MbP\343\2712\347\375\371QF\037\274\214\230"
+	.ascii	"q\027\214mQ\217\361\3340\310*\025\332m\215U\204\006Ob\203\321"
+	.ascii	"\357\372\225\025?e)?\017\271\205\335\315\365j\207\232d\016\207"
+	.ascii	"\374\266z\036z\256^\213\375H< \265\261t*,p\"~\365B\322\017\270"
+	.ascii	"(8\312\022P|\357\315?D\313\036\031En|C\r\312\"BF?\251\237\272"
+	.ascii	"\264\211\224]jY\300\f\031d\250\216\227\242\352\017\262\240\320"
+	.ascii	"\305\224\034\351\236\030D\377\343Z\021\320QK\023\2205\026\267"
+	.ascii	"\320\372\330+\360\336\034\213i\246\331n\303n\3161\034 \211\020"
+	.ascii	"\213\225\007\311?w\371#;$\363\312\3001\nQT\261\203\374rE\201"
+	.ascii	"\217\0367#\256jk\221\037\313)\360\321\343D[\342\271\214\257>"
+	.ascii	"\351\272\316\261{3\246\220Q]\247\3634\207\030#\232\263eA\266"
+	.ascii	"N\\\240\b\033"
+	.string	"=\017\217\341=/\\a\320\313\224L\320\034B\362\340\\\363\360U\302\371$\267\203J\320\343\031>\236A?\324\352\002qa\345<|\265R\235\223<'$h\374\260uW\255\303\216=\030[Aaf\216x\023\227\365\023G\322\003\205\034\n\n\253\263u\3142\335\235\212y\262Bt'}1r\034Ku\022\270p\365\264((\016\374\252\301\260\251\253\312#K\375\rI-\002-\020o\\\r\021\225\257\333\362\342\\-\336\311(\017\262\340\237\021\204\035\303\r\202\217\266\373r\316\013[Df#\3530\322\276P\215\004\242\364\210[\237GF\"\026\221\220!\030\007\332\360\023\013\251<\214K\271L[3\003\202\334\320\202\303\356\371\343N=~\027{\306\316\314O\207W@\013\324;\2037\255\371\033\2442\f\231\370u\365GC1\211\352{y\261\332bw\266g\225\3505\\4\254\364\211\266\030\024\225&S?\305j\001\2355\336"
+	.ascii	"\324\230\356\\p\366\276\366\320\361\225\235\256T3\322f\030\354"
+	.ascii	"\370J\263\206;\0221\f1\305\025s\362i\261\026\317Y\004J\247\353"
+	.ascii	"\2340%Aqc\222\277\216u\030Qb"
+	.string	"\272\336\243&\300\314\022k\307\321\361SdR\324\244(`\330%v\276\355\315w\223O\346ZcNQ\204\320\245\005X@\364\216i/\b\356s6\331o\310\004\003\302\327\244\362W\b\351\231R\270\363\306\302\031\026]T\253\"\\\350\001H\334\006\201*\200\t|N\017\244\202\017iw\343\206n\"(\366[\320HP\243\304E\254 !\276r\366"
+	.ascii	"E\216T\331K\255t\022x\354f\253\330\2279\344\251\250\n\306\377"
+	.ascii	"?\242\265=\240\236\232\204\023<\356??J<\313\036\360\201\340\030"
+	.ascii	"\t\272y|7\177\256t"
+	.string	"\367\rB\276h\371\351;\315\345c\211\031.\251\257\235\311i\002\3304%\342\211\323\246\274\367V\037D\346|\357@!\021\361>\007X*O:\375\222\033u\026\3500r\030+\273\001\020\244\213\023uy.\265\375\332\365\375I\326Q\026\"U\365\243S\267%S\355\333\250p\277\351\330\277\023\347\225^\256z\016?\354\020\204t\346\3450\006\034\302NA2U\017\265\275V\332ZJu\005td/\2004Qc!sk\177e.\350\021\326\300\0355<\027\376-\271\366\312\367\337\223\003\0164\321\372\346\365\242\230\235c\217\177\b\323ZQK\366{T\317\215;\263\027\212\354\337m\037\243\252\244\357\002+V\202\354\226\261km\224\230_[?\334[YZ\221F[\036\234\350\222N\321D\fct\232o\313\244p\202\232[\320\337\032l\313\251\271g?\211\261)x\0350\266\372lC\307&\027~\301t\260\272\243Kr\251\276\210"
+	.string	"a\343\\i6\230A__,\337\017*g\304\234\2567R\315f\207\233\371\001O\300\2636\n\327cs\t\243\313h\326B(#Z\200\222w\376\020\300\355P9t2\242 %1\350\265z\003\215Z\017\2027\312\315kL>\255\232\356U\253&f\320)\3108\037\322\356\352m,\356\307"
+	.string	"\370\216\342o(#\266\\\355\256h\335~\264\323\340\370Q\037b\262\031\377\003V\237x\226\034\364\263\311\341Bj.\224\303@\273\230\023\371\300\241\211\202\316\355\022\252@\301\032J]\267}w\202lg\343\f\355\020\252a\214\315B3\232H\366v+\256\235\254\320Z.i\316{\315{\017Pz\262{\210\020B \336\f\366lC\331\277\350\203\317\fZ\356xp\034\t\264u\215\333\272\034\317\"p\232\342\001\026\236\364\004){W\264\254\360[\032\030\\Md.\310.\007\276\357\211\331\374 !\207\ni1d\317!\213\335v\371\305\300\364\336{}}\255\026>eh{\035\205\327\240H\022;\201#\273\220\344@Q\373t"
+	.string	"\037%W\b\025\371\f{\202\214\351\253\302!\263\004Vc\262/\222\035\311Q\370\023\350"
+	.string	"\367\337\237\303{\246\320\306\357\025\022\272\312\006\223@\f\340\222\302\277\rS\3567\270w\335\211\243\365\314,?\261\224\221-\020\211\337n\"\215\202\256[>1\341X\035\356w\023t\024\303\322\322\312"
+	.string	"m\3550;\354sMjQ\271Q@\233@\307\327\377\305\035\\\237\271\f\021\3062\036\370<\233p\352+\037\323\002\003<\022f\217L\331\347\205\277\354\236\216\344I\277?\367\036\246\265\216\333\353\261\250y#\t\252\330u\244\343TDa\222-f\3320`xH\006\276\324\036\203H\353\005\322\31386\372\235\360\030f\341w\021\243\360\315\252'\366-\330\234\243\205;\343\236\332\244\275\305M\331+\236\177\301\310#S\0242\333\274\177\274\350\245\363\332\331o\301\035/^\037-ll\264\250\031\004\021<\330\211\016\335\255&\245\304\272H\031\2076p\270`8>\352"
+	.string	"\013p\310&\351\340"
+	.string	"\225\357\271/gHs\262\323\327`?\305,\356\003\270\205Pm\341\032YXq\350\213U\255\242\230\213H\323\251\251@\345\373\233\003\274\t\005:P#\201S\032\371P\264\031L\212L\362\363\031h\313\325\016"
+	.ascii	"A*:\310K\260mB\360Zy2cb\265C\264\334\362\257v\031\227\023 E\302"
+	.ascii	"\2017\224\203\236!\356m\222\303\001&\256\020!\215\233\332\331"
+	.ascii	"\205'\027\034\023\001\274t\247\226J\033\036\241\251u\221\t\016"
+	.ascii	"\355\364^XD\272\320\325b\357\243z\377\3208\03708\033\202\202"
+	.ascii	"\263\344SEVX"
+	.string	"\266\205\227:\023\240\240,r\250\232?\360\003\216\002mr-\352;\357\b\310\027\267q+\257\021\337\335\226X\370\333\337_\250\304\300\303\302,x\336\305O\275\345\221\351\322&nr\260_\305\260\270\251\226m\226\335e\245y\357\314:\237w\214\f\\\020\003u\036\311K\263\225^\373\237\253D\035\264c\360\232\035\335\246\344\034e\355\321a\250p\264\032w\203\260\003\343GS#\317\315bP\2757\237\020\307\013\223\225\377G\230\355\204\3570\030e6\201(=\345\351NY\226\006N&U\345\260\237v\204\342\274\264x\373\\\301\003\265\027}\013V\351\255\265G\177\210\266\337n\337\367V\353\262\304\227\230\334\247\225|\037\304r\316+'\2548\007v9\351Ol9<&>a+q\300@\366\2072\224\b\t\263?\323\253q\344\216\264Q P\351\342#\210H\360\231\016\351\211\343\340\346\360\273\300\3667w\322\255\007\344\3331Z\212"
+	.string	"458bLy\342h\255\276\232\256\276\236K\036\006\254`\274\333s\204\253\314E\304\"\302\361J\337~\016f\236D\312\363\212aVP\363`\322<$D\307\037\013?\272\232\265\363}AQ\025\300<?]\251\203f\250\032\246\037\203<K\300i\0359\213\265U\027\266\024\356f\304\314>q\311\023\\(\300\212"
+	.string	"\313\023\315\217U=#\033\034L\005\330\245\335\242\302\216\032\223\\T\030=m\027\341\372}\336\214*e\030\235\025B\013\260\022d\016\231\225B\0335\262\242\276\002\fq\023K\332\3050E\026R\222+\342C'\031\003\273\0307x\037\343\335"
+	.ascii	"\223\013\352/\\mm\002\020V\216\306\222\271\363\224\370'\232z"
+	.ascii	"\305\244\024\362\021@2\031\324\3073\357\260P,g*\374GLX\325\255"
+	.ascii	"\227\215\307\020\264)\020o"
+	.string	"\234:\332\227\306\\2BF\352\223U\331Z(\353e\204J\337\\\304j\177W\344N@N\013\240^e\372g\255\203\244\250\177\317\224\237\267\021\200\037\265\213\372\003\210h\351\366\346\370aK\365\263d\365b\202\340\226u@\006\311\267\024Z\253\305\250\271\365A\310p\343\203\365\273\333a\252Ta\322[d\251\t8g]\3711N\205\232\\\036\257\211[b\243\351t\0074V\250\225\034\005,[N/\007\303\020D\366\352H\346\225\272\332\204\334\345\326W\262\365\217B\230\r\263X\214\325X\361\270E\003\027\213!\251\342\227\361\352\275\341m6'ss\261\343~\373)\311\356\312p\213\273[mb\301}\004\0344\032d\030\340\026A;\332\303\272\002\242L\253H\025\020\031|Xn\177\220\350\254}\250E\316]E\350CP\265\025\270o.\033\304\210\2600\\\334#@\017\363\270\231]\236\260\3600Y6_\002\271\333\266I\236\246"
+	.ascii	"\252\267\313\035\204\356\313SH\376G+\f\236-6~\n\310!,\345\230"
+	.ascii	"]|e\260\356U\250\246\231F\305o\267\232$\311\022gM\371O\n\346"
+	.ascii	"\257\337\362\330\nk\334\2369\267#\033<\270\004\372\357\200\314"
+	.ascii	"e\247\344\247F09&Y\300\224\361\365C`\222m\021\215\243\222o0\340"
+	.ascii	"\333\352\236z\276\363\240D\204\317\212avL\336z\006\325\026\352"
+	.ascii	"\350\224D\3355\0233\377\210Zt\366\235\202\3100\311\214\364\330"
+	.ascii	"\237YL\212\265"
+	.ascii	"L\016\213\333\314\370\227\223P\351\307\001 \f\225\352\213U\030"
+	.ascii	"\206\013jI\221\214\3165x\212\241\327\263\220\2619!G\216\2156"
+	.ascii	"\241\200(^\346\233\376\253\240\342\314\221n\032QBO\t\352\032"
+	.ascii	"\016ya\3302NL;\266\231\205-\031`\345\035\241\207\255r\2363\334"
+	.ascii	"Pt\252\230\204\352\353r\212\231\245\324\2711rp\210x\233\177$"
+	.ascii	"\271%\317]C\230\026&\277\352\207B-\223\306\267\214W\323t|\254"
+	.ascii	"\3255[\031l\034\2416V\b;\233Q\227\347\324P\tA\021u?\302\212\f"
+	.ascii	"o]\223\330S\322v\"d\007z\fd\207\365\345\323\247e\006`\302\270"
+	.ascii	"\353\350!$\370\034qy3&\366\200\036\221.v\223\366 \355F~}&\320"
+	.ascii	"\325`\227\206\204>a\221"
+	.string	"\200J)u\304\355I'\365\352d\035\257\3732?N\177\205\ba\201\341\212O<5\3149\313W\030\001\252\257\355B!\370\"i3{\031\275\020\337ryk\353w@\357\314[\264V\177Z7iW\356\222\200\362\264\251\270\006,\346\336r\215\257\226\244\230\322Ot\361\300\023\276\2351\210\006\247k0\366\270Hm3\260\f\017\3352\333\257\023\033\234[\031\360\356\245\341\302#\227\231S@\312);\343\226\301g$\027s9\211\355\032a\251\202\360\2441\242\023\353C>\017Fo}\n\265I3\027\303%\231\254$t(\330\352\352\337\024\020\347$\3571wL\026\366\234\007C\"\315\356\213\236\205\2523\247u\271\003\272\271\321m`s9=\241\300|\002,\262n*m\370V\372G9\376\2219\216\222$\370ox\210\337\306]\213t\377\323\026\227\212\226\035\006\340\371\244\354D\215\b\200\365\3525\255N;\201EA\255\331\032"
+	.ascii	"\315\316\327\027\347Ah\177^U\350\"%\210\033\226%}\b\245\3401"
+	.ascii	"Qg\357\007\251x\036;\207\323\207\033y\256\221\212\236\360\036"
+	.ascii	"\263\355\2447{F\222\217e\240N\235\030\224\260\363$\310S$S.\365"
+	.ascii	"\316\266\201\376/6PIT\020\025\262YJ\023\370\223\231\301\345\312"
+	.ascii	"\204l\206F\333\356\365\006\231\031D\031\261:O3\0341\275\013\013"
+	.ascii	"\026\321\274\342/2*\306pW\261\234 \\\3754\331(b\217\222\2433"
+	.ascii	"\262\312\203\373\266B]\320\242\335\334P\362[\375B\037\244\005"
+	.ascii	"\301\003\265C\304y\205d:\261\242\357\323\021q\306\375arY\317"
+	.ascii	"A\026c\363\332\021\223\037\261@\226'y/\266/!j]\2034\333qu\275"
+	.ascii	"d\202\264\257]\263\327\206\364\240\206T\t\323\013I\033Y\374\""
+	.ascii	"\036\233e.\273\330h\031E\241k\333^\013\240C\304n\f>\216b)\363"
+	.ascii	"\301PO\204\003\300R\036!'\332\316\362{\026\277\326w\232a\236"
+	.ascii	"\213\240\300\376\034\363\361#\344{\334\250\313G\227p\347Y\216"
+	.ascii	"A\275D\035\204\214\210_N\361F\315\235\302\253\362TV\203\311\317"
+	.ascii	"B\317\271\352U\341-\364\231\274@\324U\263\324}\204\373cz\tzp"
+	.ascii	"\202\206o\"<\353\345@\211\215\266\307\024\260,.:5,F\300me\025"
+	.ascii	"i\303\320<\003@ <\235y_\3264|P\177\271?\271\337o\216I\3440\204"
+	.ascii	"y\366b\244;\246\240\340B\253\232\304\245G\003~]@\267\037\262"
+	.ascii	"\274o\004\217\230\316\342A\263\251lT\302\226`\247\366\0070\234"
+	.ascii	"Cn\226\376nM\335\270&x\375\005\016nS\005\252\027Gr\371\225\230"
+	.ascii	"\314E\030B\"\321\336\260T\232\022QS\224b\002\366\356\205\004"
+	.ascii	"\3461\001m\200\r;\355G:76\363\322u\324:\332\304a\351\003\234"
+	.ascii	":00f\332\261\023u\005\370\273\tO\220\226\230e\360Jt\346b\335"
+	.ascii	"\314\212V\260\372\026-\321\377\001\004;\306!\212\204\261A\030"
+	.ascii	"H\317\013\304\361\034l\252\375\212\242\335:&VB\356 \024\261\364"
+	.ascii	"\356`\344\243.\245\237\0335\013\324!Vt\213#\0025U\355]S\251\033"
+	.ascii	"\367\235\027\352\257E\017\371\361\031-\317iHi73H`:q\316\302B"
+	.ascii	"\361\247+\262\20482\031\263\204E\024.\376\313#\227\270\"\275"
+	.ascii	".1"
+	.text
+	.section	.gnu.lto_.pureconst.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001}\013"
+	.string	"\006\340Z6\320\234$\351"
+	.string	"_<\300U\003\303\027\017\347\304*0\306`0\035\364B\2265\327C\013\313\374L\037\0342\234\034\266\f\035\030\346\234\030\262#\310:4\310\243A\312_\332P"
+	.string	"N"
+	.string	"I"
+	.ascii	"/\021_\210\017\304\367\341z\270\035.\207\273\341j\270\031.\206"
+	.ascii	"{\341Z\270U(Q\270\023>\t_\204\013\341\352\301up\033\\\006\257"
+	.ascii	"\005\237\024"
+	.string	"|\246Y\351*\301Ep\017\\\003\267\300%p\007\\\t8\025\340~\n\300\247\243O|\221\210\"\221\330(mr\231\314\226\334\224\334$\037\222{\3443\362\025\371\210|C>!7\310\007\344\376\370|\274z|<\276\035W\307\315qq\334n\274l\274j|4\356\214+\343\306\2700\356\213\353\342\266\270,\356\212\253\342\246\270(\356\211k\342\226\270$\356\210\227m.\331\\\256\371\250\346\3054/\242\271\361\314G3/\226\271\221\314%j\30613\212\371\030\346\022\314\345\227\031\275\230\330\345\222\313\214[>j\271\314r\211\345c\365\361\312\245\225[\345R\271S\256\224\033\345B\271O\256\223\003\227\214.\027\275\250\350\306D\227\210.\017]\032\272,\364\"\241\313A\037\005]\006\272\004\364\361\317G?\037\373|\344s\271\347F=\037\363|\304\363\361\316\245\235\313:/\266K:\227sf\224s\031\347\022\316\214o.\335\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\022\017\005:"
+	.string	"\372I\270\017A`jQ\007\241\212\332\211\274\345\021i<d\312\305\325\237\214\366\\\304\314#\230\260\006\312QV\361\024]T\213\255\276;\177\177E\3074\303e\350.\341\267\325\344P*F\373\273\221a\237-\261{\247\224\002\334"
+	.string	"\367"
+	.string	"\346"
+	.string	"\f\305,\242C0\203\370\340\0368\211\367\"%2\232\003o\270\261\362\354l[\203\256s\031\370\311\333)\n\371WD\366\205\030\242\220\277\276\316/8\221\275\302\257j\337u\246\205\nN\201\251\254\005\206\215\375\277O`\266\341\356\336t\273\261\0227k_8\227`K>_\276I\374vK\251\334\271%yG`\bR\312\277\002c_\370\300A\003f\3007\264#\2713\212\302\260)\331\\P\033*\300\26139\024\2457\002\247%\346\233\201\002\004\236x\013`\346"
+	.string	"\f"
+	.string	"\222\3556zm\327m\334\353\235\316L\3736\231\273\335\347kn*P\274\031\212;\243(\215\231i\227v\241\314f\3664e\356v)\336\234\336x\017\367#GQ\276\334\334\314\316}\346\315\31459598\223\033\213)0\033(\024\265/\217\342\304@\262\311\216\177&M]\337{-3^5.\357\312'\311K\3168\355\207\r\271\300\022\360VV\325\371\216\225p\022\224\221\222G\263\262\374`\026\373\317N\345\214\344\210\332\022\235\364\204\031\032\205\276\032\341\"T\2104u\005\303\376\254\350\301\254\327\346\377}\356S\334{n\262W\271\237C"
+	.string	"\230\365\330\230\027e\365\374:\205D!\271\374J\001$\327\021\311\005\324\325\276N K\212`\316\212L\316\363f\377\037\346OQ-}\274\200z^\373<:\314\320\b\374Ok\237:\357\234\306\242i%\035~\346L\016=]\007\312\272\202{\376wM\234\233\335\231MnJ8\316\263\242\326\365z \266:\022[\023\375\267\2557\016W\373:o8\221]\205:\033]\203\006\367\227\037\016a\244I\0235\311\333_\2700\333\267\265\266\326l\301\202y\005\253H\201b\327'L\224 1\"K\225z[oe\366\274%\261WU\"\373[\314}\262\031z-!\270\177uf\257a5A\240;\247\341\356\363OF\326gx"
+	.ascii	"\353\0055\366\337b?o,W\234\333\206\225*?\2571\031\277y\367\230"
+	.ascii	"\334\021\371k\225\362?\213U\211\t~\345\n\362\277\344\3220\213"
+	.ascii	"}E\377K\266\035^\237\367\343\307\205\2355\206\025\247]\313\272"
+	.ascii	"\336jA\245\337:ra\357,\347\312\032\227\327\315t\371\277\032\344"
+	.ascii	"\224\257_9\337\224w\356\354V\336\334\300\003;\222j\360N\255\327"
+	.ascii	"w5r\2019\251Xg\367\357\177_1\333\267\362DDGb\217#\221}\"\242"
+	.ascii	";*\353\316\256\262$\266\222\251D\247\007\376Q\306\356\354__y"
+	.ascii	"[5N\347\275\2627\025\307\351\314\366\261w\007o\356\340\363u\007"
+	.ascii	"OS\024\345=f\r\247;\273\307]\305\252\224\234\223\232z\242q*\225"
+	.ascii	"\213\221\313=\345\244\246\236lL\3434"
+	.string	"F\032c\352\202\315d&\343F\224{S\353\325\276A\3367\364\366\313\260^\227\327\200e)\245\030\343\362\362~\215Z[\353=v(\212]\347m\250\020\241\223\367\205\273\254\314\235\007\tB\006r0\326Hd\377\2125\265\237G\004\333C\323\366\025\030\333C\263\374 \200\345\007\377\037\370\354D\366\321\230=\357\210\374+\242\323\273\227\326\271\271\273\213\331z\214\265\341\367\226E\224O\362{g\367\001EY\267\274\356\377\237aZY\316M\345\334;.x\016\214\025}\267\305\373Nm\370<\027S\332\313\334`L\267\347\365\251\322\342n\266S\207\007\260\177\224b\254\354\374w\230\341c-\213+\237$\2267\035o\345/\371n~\212\362\231\020\2419\256%K\307q\336\231\r\247?\260/\3547n\332p\201\231\250\341@\350\320\314\310H\222$\031\016\261\004\206)\307\244\204=\022\200e-\206!c\212HR\220\024\024*;\233\001"
+	.ascii	"\223\336\354\021\225\246\351\026\217U\216\261h\253tT\335\374"
+	.ascii	"\362\305\332g!\205\313O\300\217Z\0033\200\264\255*\217\317\374"
+	.ascii	"\240\020\354\216G_\356V\"\345\375L:\236\2373\031g\373\033\370"
+	.ascii	"\301\276~\212T\006(.\314\274P+1\233\367\r\237>>\345ZV\350\002"
+	.ascii	"\277V\343\202\377*\0238"
+	.string	"l\003\350m\016^\235D'\240\241n\363\\\2539\203+\006\326\235\020\017\206\200LV#Z:W\344-\354\006;\016\024\306\004\241\246}\225F\347@,h\345\365D7\037\0166\225pw\350m\243q0\304\213D\213!\017!(\370\212\"+\006:>\237\262Ym\362h\017|\\=\371\017\346\023\215\367C2\032RJ\264\273E\263\ry\f\226\327s\235\005K\205\323\017\303:\373\360\263D\362\206\266+\031\250\352\361\310\205$6z\212\340~\306\300\250\217ri\203:\002RY\210\004\025\200eV\273\316\3173p#\356\352\214\035Z\353t\305J\205\005\315|6\247\306m\217\204\372?\310\266\300\321\0254\211\301\321\205'J\310x[\t\227&\251\n\375{vN\267\367\320\276#\312\241\2710\253!\300ig,/\f\007\\I\341<\332K\216Z\352-fh}E]\311m\n\255BmwDr\325\264/BQD\321\347"
+	.string	"\343\370\235\031\354\005m\375\360?\204\017\032-\206\037\312;#\254z)\200!\354z\366\253Pf\357\313C[g\027\265\326\335\313</\030\rE\340P\273y\205\036\236\354\r\270\211\354\035\004\277\262G\023\332\033\264\220\0056"
+	.string	" \026\005\f\250\240Y\001\230$H|\326\223\277\323\255\231\312\234\204fQ2:\362\317\r\021@p\177\263\b\\\221\354\360\224q\027\310D\327\335\031R((\310\2214\0047;\210\341\005\301\270j|^\364\3360!8\251Q6y\334\024\306\346o"
+	.string	"\251j\264\301'\022b\r\324\234\344\301\263\325\335\270p\034~\242\336.\272\bI\246k\344h!\025\2160`L\026h\267=d\334W\033/\312\025\227O\003\260\322X\222FD\243\304\355(\341"
+	.string	"\030:\236}\330\355\002CT\030FX\270\rN,\355\306V2J\336X{]\213\004\263\241\020\230\351\206\275\030\346\341\333\271\030l\203'N*\037\t\313\342\312*\255o\305nK\271\322\307\340\227\231\272-B\032\246\375\307\331X\203(\201\362=d\034\341\\/\006;\f\232\372\240\264\356\240\350\216\366\330\221\370\360\254\335\300\366\311u;\251a\022\364[\351\353\324\365\344\347\002c2\227\301"
+	.ascii	"\362\216P,O\275(?\200\004\244|_\326Y{(\321^\325\023$!I\203\302"
+	.ascii	"\204\035\243\251]\377\231\256\271\370=\346\327kL\017\256\302"
+	.ascii	"\002\301\234\311\236\275\301\001p\316\263\343f-8I\034\203\032"
+	.ascii	"\3421\0046\b\300\366\306a\236\257\361\376\235'\001\300\353\365"
+	.ascii	"7z\227K\021\b\026\310}\204\230?n\257&e\020\007us\337\244\030"
+	.ascii	"\036\006\3322|r\257\212\246\256\350\224\240\210Fg\236\235\226"
+	.ascii	"W\363Z\006"
+	.text
+	.section	.gnu.lto_.lto.2a8b8e9593198327,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.217.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`6\0035\025"
+	.string	"\326$\212K\240\230Q:\n\3479\030\317k\\\326]\252\316\241H4\211/\255\005\357\360:\274\001N\321:j\374;l\026\260\303\307\325QA\237N\256\0373\326\016\322\312\225\260\243-\206W\244\017\361\255\013\277\016\217\376\240G\344\266\261\255\ti$\355s"
+	.string	"t"
+	.string	"w"
+	.string	"B|A7\337\004~\323"
+	.string	"\371]\241\233\257\204\337"
+	.string	"\250\202\243\023\325I\340w\200\251\tw\350\346\037\341\267\200\034\300k\204\337\003lT \272\231\002~\023\210\002\216QK\031n\206\200\337$T\016\277\0134\0055\334\374"
+	.ascii	"\277\r\300\330\300\341\346\006\370}\300\205\360\312\360\033\301"
+	.ascii	"\na\f\352\t\253\304\326p\230\237\364\356p\263\210\337\tN\336"
+	.ascii	"\303\353mOZ\353\"\003\337\362.\342P<\022\221\304\0203QD\316\315"
+	.ascii	"E5\034q\344\300\2129\365\271YT\302 \222\360[\024?\210H\370\355"
+	.ascii	"\342\00246-u\301\357Q\213\026~\367\311\327\225,\374~\235|U\321"
+	.ascii	"\215MT\273\233\177\205\3370,+,\005\350\366n~\025~\277\\M\341"
+	.ascii	"w\254I\360J\3417\214\022\341e\302\357\230#\302\321i\351(\360"
+	.string	"[\206H\004\t7\377\004~\317\004\250\232;K\032{\346\326[\272\352v\264\230\375\325\fY\370\311.\f\005\021\311~EAY\ri\201\030\204\212dF@`\221\f\306\316rpnx\265r\347\023\263Oq\025g\361\026\177q\246\307\270\214;\375\3513N\343R\257\361\033\307q\035\337q\036\357q\037\377\361\252\007\371\220[\275\310\215\034\311\223|\311\231\334\311\237\034\312\243|\212\202g\235\312\255\\\353X\236\345[\001\366\314\255\243Uy\265r\347\363\262\347\216\313\242\345\316\355\264\301\254N\317e\333\332p'\220\317\206;{(O\214\235\365\\\226\267\200\007\263*o-Q\236t\245\245\261\027{Si4\237\r\316\315\214\265\2315\237\r\003\337\211\232=1?0\333\243\3033{^6\375\311\231:_\272\372n\252*\203\226\273\032\214\315\231\253\232\322L\324\206;u2v\206\236\345Z\302,\314\232\2702@\250\021p$)"
+	.string	"\213\334Q\224\222\244\315\320\002\031+z\020(\2020\022\247\003e(\233\210E\275\262\027;|-Ay\252#\305\007j.\222\205\374\315\264\225\233\362\322H\020\346FMFn\022\377\206\362N\3631]\316s\317\246W\002{]9\355u\264\324\025\037rB\332\253u/\246"
+	.ascii	"v\"\372\274;K]\233*\326\254\333uW\246\247\352\005\201#S^\234"
+	.ascii	"\232\272\020}^\204\3431"
+	.text
+	.section	.gnu.lto_featureNames.218.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\247\003\205\026"
+	.string	"vh\224I\240\332Mc\253V\262\"(I1i\346\255\005\002"
+	.string	"\211\n\343\301)\274\016\257h\215\237 \355\204\222(\277\243\013fKA\177w2\215\326\226\034{\367\373v\032-\315\034\360\214\034\242q\026\013\216\f\002\333}\253]h\2044\231d\205"
+	.string	"\202"
+	.string	"~"
+	.string	""
+	.ascii	"\250\\E\376\r\320%\304\303\351\245\362/\316\023\tx\002N\377\313"
+	.ascii	"\2779L\216\360R\376\025\220\004\225eQ\021\3414)\377\352p\r\330"
+	.ascii	"\352\025\341\224B\376\255eU0\302)P\376% \344H\226\265\205\204"
+	.ascii	"\323\237\374\273sU\240\207\201\035\276\f8}\220\177\017\340`\302"
+	.ascii	"\bj(m\300\251O\376M c\ts\300)\203\374\253\240\212\351\324zr\002"
+	.ascii	"\373\375\322G\375v\300\251\315\277\013^\273\207\231\337\372\235"
+	.ascii	"ZcN\001[\316\345]\356\345`\376u1\037s2\r^\306\376l\223\005a\237"
+	.ascii	"lj\241\254\b+eG\330\022\326\204=\341cS\364\210\261\257\037T\223"
+	.ascii	"\203jQ\330\251<\305\204\255%\001a\207\323\207\345\337\230\215"
+	.ascii	"\362\312\277\262\020J\262\253\255\256\374{\235\270\362\357\214"
+	.ascii	"\375\360\253\374K\363\332L\030\212o\225\301\230dXT5a^\225\177"
+	.ascii	"g_Z\344_\232\227\215\226\022\b\247g\221\177o\256l\031\326V\004"
+	.ascii	"\234~E\376\rU\2078\26247\t"
+	.string	"\352\323\246\206\270r\247E\020W\321\334\350\220\246\251\272\334d\270\321\333\016i\225w\212A\240\326\241\342I\2027\265\307cd\241g\273`D\204d\353%)\331xj\325\207\241(\311\246\301\347K\262\321\352\353]\374\305a<\306g\234\306m\374\306s\\\307\255\316\343>\376\343@\036\344C\216u\255\023y\221\033\371\221#\271\222/y\223;9\224G\271\224Oy\225[9\226gyug\232#xCo7\020=\177t\342\230#\305\234Y5\313s\243\272<\313\035\255\236\243x\242e\220\0167\255\216\240\250\303}\346\312M\253\333\324\311\304\\\250#AmSy\372\fw\341\030\236\263\212\353\211\325\235\220\211\216\3418\202\0324\321!\215S\315\275\273\341@T\334[\327TS\324\347Fq\3418\253<p4\267\210\303\025\267KY\325\221\"N\203B\272\314\241cH\222\340\317M'B\250!D(\005\326\b^VQ\265p"
+	.ascii	"\003\221\231\242\007\020 c4\n\322\266\030\375)\337P@\266\037"
+	.ascii	"\345+\246bL\263\032:\241f\004\361\313\316\300\300*\233M\336\033"
+	.ascii	"\030o\033@cCb\367+\017\321\n\205!\0240\235\327w\320\270\323\351"
+	.ascii	"\013\241\323\222hE\245\303\366\235\266WQ<\201Q\t=\211\345\031"
+	.ascii	"\345\377\236Sj\363\034*:\361\033\225\257\304\3007x\231\021\200"
+	.ascii	"=\341`\231d"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.220.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.221.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\320\314\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.222.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\203\354\364\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_mcuTypeNames.223.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\035\002\225\017"
+	.string	"\206ZfH\320\030'\035\350\304\021|,1\211I\3142\223\230\304\313]h\332\th\365\020\362\350fB\030]\376\263\375\220\3161Q\201\263X\315\336f\211\221\267\372\001\215\340J\"!j\215LcIL\025NK\306\237\266W\023\211H\222\001P"
+	.string	"O"
+	.string	"Q"
+	.string	"\2451\247\317\002p\310\266\210\244\320\347\227\032\262-*g\372<@\206l\215vJ#\253\317\004`\3145Z\320\347\002-x\366\210\344P\032\273>\033X1\367\250T\320\347\003?\221\316z\237i*\177J\2626\233\215\007q\356)\215[\237\025Hu\223\t<K\273O_\231KC\321\347\215\312\334\240\023}n\21127\310D\237\327\311\\\241\022}\346%s\205H\364\231\364\023\t\311\334\241\021}\006Pd\356\220\210\0362\227\210\f\321\347"
+	.string	"A\346\022\225\367\320g\223\217\2715\262\247\317.;2l\255\324\t:\\\352\244\"\206\233\030\247A\024c\234\213v^\350b}\212\2538\213\377\334\305_\034\3501>\3434n\3437\236\343:\316\343=\376\343@.\344\345\211\2007\362#Or%g\362&\177r(\227\362)\257r+\307\362=\213'n\345\354C\007\006zZJ3\023\201%S\363\300\001\004\223z\235\252\305\352u^\213\325\246S\251\276\257\305\272Z\2011\037\030\023\266X;\020\005\333\021a9\260\032\030\004\212\232`\203\222\220\332pC\223"
+	.ascii	"\306\373B\327\213z,p\025\2728o\025\272L\372\205_\003\326W\n\307"
+	.ascii	"\302\213\203\341T\270\300\275b\001/ `\203D\352\321\030u\325\256"
+	.ascii	"k\034\275\374\270\016\215r\\\021\274rb\001\177\330\030kC@r\235"
+	.ascii	"\021\\g\004\3272\3025ed3o\021\\##5c\253\033\355\254\377.%k\205"
+	.ascii	"\255\263\236\371\254\267\206\254}\353\231 \\\231\344Fg=\231;"
+	.ascii	"\262V\260\337\240\212"
+	.text
+	.section	.gnu.lto_configurationStates.224.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \256\315\004"
+	.string	"d\bT"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\330\330\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'0\206\b{\by\276'A\206\bwu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013CONFIGURED"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\020CUSTOM DEFAULTS"
+	.string	"\rUN\006"
+	.string	"\211`\215w\001\332$\3153\214\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_cliWriterFlushInternal.225.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"%\t"
+	.string	"\246\220>80s\322\001l\3060\341\321v\252s|\f\224jF\310\320u^\315\224\242\r}\227E\213\266\200m\234Xm\r\b\212\205\002y\030\300\331\274V\315\3448Y4K\366\3362\245-"
+	.string	","
+	.string	"1"
+	.string	"\217P;\377\262\003\270\274\325\343\307a<\320\271Q\021\360Z\021a\204\004\346\262\353\206\307R\r1\354\256\325\345y\334\362\266\033l+\330\266\t\266\257\366W\316\322=\246\372\300\356kGf\367[p\202\350\322\337I\332\245\350\004\332\245;\273\347\337\311\206`/\032.>\273;\241\311\2734 \263\026\\\251\227\303Q\003\255\322\024\032\240\300ZxZ\372c\177+\205%\366\343\356\256\341\313~\354WY\020\202\363\020\263\333\021\004\26439\2232\n\234)u\342,4o\245S\3046'N\020\022s\343*f\211d\024\205\211\233)\024\212\233\243o\037\027\276\354 2\313\200\254\030U\241}\201\241w9 \017"
+	.string	"\357b\314\304\023\277p]\0034\302\212F\265"
+	.ascii	"\004\016\rA\ba\025\314\273\004\320\254\246\210\273<U\223S4\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliPrintInternal.226.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\035\n"
+	.string	"V\022D<0\345(\035\3005\374\360x\3511\346F\305\216\205\n\331\244\260|\351|\275\224\022p\265\177\273\343c\237\302\2658^\353&NX\030\300@\003\036g\344\203D\035\305\022J\032\331D\356\224\0022"
+	.string	"1"
+	.string	"4"
+	.string	"\235~|\361\273\246\361\363\037^@\005\236\256q\033W\215\303\261\022#"
+	.string	"S\232Bl\244\343\341\343\nD\305\250i\330]G\025\250q\313\333v\260\355\261?\020-\"\266\277\261\035\247\305,\341\321~\311M\276\273L/\330e\275\274v\347\202\021\270K\317w\266K\356\234\355\322\237\r\340\263\265\032\020\026\214\024\001\273\033v\251\"^e\251'\206\226,\200\332\264I=\b\211A\231IE\231=OQ=^$\241\214\225e\177\376\333]\277\374\274\2253p\301<\250\354f\314\006,L\006\036i\244\036\210\024\362J\233?\236P\304\247\233\bAHt\037o\324y:\026Q\200\274\216$\022y\335f\356\225\025\236s9\201](J\323\342\246\252+[\306M\245\006\023"
+	.ascii	"\357b\310\f\355g8\004\207\\\360\n\227\262!T\277\241+0a-\027\034"
+	.ascii	"\204j\213\025\306\003\325\300\02507@E\031w9\252&i`j\017"
+	.text
+	.section	.gnu.lto_cliWriterFlush.227.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \362e\006"
+	.string	"\002L,1PO\323\001\240`\321\231jt\374\254\016M\004\005"
+	.string	"9$\347;\354\"\270\021B\217\205\2000\255 \303\fg\246\221\371z\271\2460A\337\335\204H\231R\206\322D\3017Q\3601L\t\013\017Z\016O\np\325\240`\275\207\252\262^\324\355\225;@\301hJ\341'\2576DD>z\240B3\373\"\037\231\360?,q\345\343\035\377z\356\\\rX\\2\264\314\330]\226\272a\277Y\345\354\247\337\b\234\244 \230\354^d^\026\343\224\200\330~d\314^y\327\261\220\207\212\005I\313\356>\3458\366\304\374\207\034 n\331\023*\330]g\3340n=\201m\215\t"
+	.ascii	"3\00178\203s|\241k8]\b\3762.\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliPrint.228.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\255\007"
+	.string	"\322\21765Po\322\001\220\364\220\024E\321\016\347N\277\370 P\220\b\001\242\355\336\241B\215 fwd\311\341l3\326\024\"\343fL\217,\270\364\344\241\276i\215v\2232\245\027\bSW\236\317C\005#>\r\020\260\2720\350\351\330\222p\270 \310\262.\310\211\373\314*\347\005\230\222H/\254I\325\253\215M\3447\023`\250f\377\344(\025>\210)B\371\355\317\017Q\177W\205\223\b\207(;;j\251\035\3663\273\273V\316>\351\327L\377\r\274\2700t\273\032\335iK\257%\204c\373i\237\344%\331I\026\017\330\345FVv#\202\r6\177\216\357P\177\233\013P\177\316l\323\343\307^\305\224\221\022\263\273P=\236=3\377&\007\330F\332S\223\260\273\316m\264q\353m\027\330>\260\315\022\t"
+	.ascii	"\357b\310\304\253\276h\217\013;`\324%\254f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.229.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"r\213+4`M\222\016` \341\245R\355\003\036C=\360L\231\025\324Pl\b\\\027q\264\265&\215[\256Vt\3248\t\222\002\224\n \035\244 \220\325uiv\023\231\002\017\020\340SF\3630\271\bM\003\204\233\252\t\2271\230\222p\250\034\005EUN\302\262\350y\201%\313@\215\243V\221\216T\024|27}\026\001\233\004L\243\277\300h}\267\023P\266\201\327cWC\217\357%\321\363x\020BaH\311\344\264\2042\213L@\376J[\257R\354\223-\001q\220\254d\246\303\217Zm\326mH\005^\347j\003P\310\314\333\353tt\354\217\360c~N\t"
+	.ascii	"\357b\310\204\006\340q\200\013\3335\221,\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliPrintLine.230.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"M\007"
+	.string	"b\31624Pm\323\001$\203\310\252LR\241\312(2\204\212Fb\025@\030\273\220\343\037;B(\376\346\r\344a\030\220\231Ed\207\365\f%\fO:\213\267\377\273m\231R\025\310z\235<\237\205)6|\020\030\342TY\321\303)\345\220PE\020EUq\303\335\322\237\326\003\216n\342\205\212\311\326z\350ht\241\207U\312|-DD:k\242dt\024\017k9,_Gk\351\377\373\264\326\233\235\260\263\221\242P\362_\264\260\274\203' \233\266\316\326!\026\271\274I\030\340\327F&?W\320\201\214a9s.\206\031\007\\\f{\265*\346>n\022\213\212\221\225\377\361y\370r^\265G\326d\"\314\2111\370\337\314D\030\356s[\201\266\004m\267\n"
+	.string	"\357b\310\304\023\276hq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.231.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\202\01775`o\032\003\024\022\002;e\001\200\256\225\307E\330\022pz&\001`0\365\f2\024tH\230e\352\343\233\030A\200"
+	.string	"*\262C\375=\240\227\001\310v[\331\244L)=\360\004\b\304M\024\202\305@\331\003&#\262\006\b\211m!\t\352T\223p\330\244H\3236\311\231\267\346\320T\206\223U\006\324\250\365 l'J\254\347\351\025\212\201\323OrWq\221\024\022\034[\213\213\347\256OE\262\332\200\243v\216\036\004i\255\371\377BSk\224\r\243\201\311K\346\362w\314\310|\025S#\234\266~\255Q\234\302\031\205a\202\337\244j\371\347\247\b\227c\247;\226\343\345\002\313\261\\\013\343y\372F\344\203\203%\346\277\204!\346\374\270\332*\006\350J#\277\315\302\377\276\256\344\341B\267\365\264\375\264M\005\013"
+	.ascii	"\357b\310\304\263\276hq\241\202\024@\252\225\002$\027k\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.232.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"}\b"
+	.string	"F\021<6@\217\322\001\233N\003LA\367\004\306\"\001[\301\nnCjQ\354\220?\250Z[\002\340\247\022\240\023\343\207\303\360\030?"
+	.string	"\214\321\223\340=.\255\243\344\023\"eJ\001+"
+	.string	"+"
+	.string	"*"
+	.string	"\031\017`\234\265kY\374R\327>R\245\222\226\377[z\2703v\265I\f`:\215\214\032\303\377\242\351\264\341\246\333\032\264Mh\353\n( m\255i\233\330*,t~\027\315\237\303d\365\237S\004ck\021\217tV\325e\201\037\025\262\372\037\247\007\031g}\336`\234\005NLg:\003VX\245\027\022\276\3327\302\354h\215\375\177\023\325Zeg~v&\0261\2545\202\024\225\210\223_\343\345\362V\026\020\034\202\\\256\343\221\3406\n\217\303\304\306\205D[g\323\017\350!\264U|>\241M\363n\354\211j\003\253EJ\214j\210\231e+\262@\233Z\220\221\243\006\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.233.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"%\f"
+	.string	"\326\326RA"
+	.string	"s\233\016\270gy\232\023:(\273h\265(\343\211\t\304]\317\370\234\367D\377\021u\262J\321l\303\017\202s\330I\003\374\307\247\345]\365*A\001ZL\260 [\0250T\265\317\343\323'{K\231R@"
+	.string	"?"
+	.string	"?"
+	.string	"\217\326l\036\367L,FE%\245\005\310\356VZ\342\332\241\246\346\277\364\f\327m\207\037\256\260@\016\033)\004t(\360\200\210\021/^zn\350F\231\230\006\273\353\344:\017w\274m\007\266\031\330\177\020\361+?\324\364)\316\217\033\023\\v;\274\f\331/\312@a\373\032\333\231>\013\226\f;\026\370\236\235yt\202\247}\025_\241}E\303\007\354\222`\304\330\365\024\030\001\365h\357\233\351\221:\201)+:w\265-\204\362\234\001\324\350\361\245\350\226\035\016\0164\324'\3235BI\007J\n\261\337r\027'\376\t_0\311s&\323\343UA\314\b\022B\224/\266\267\245\222\260\017ww\255$\373,\177\026\206\274<$!\003#\231E\225X\240\f\2230\371\352|(\\U\205\217\005\252\256,Tu6\306H<YU\202aY\245\361\366p\225d\b.\237HG0@\332#\037\216\217o\244\233E2*\324\267"
+	.string	"a\324\006\025"
+	.ascii	"\357b\314\304\263\242p\034\006X\370\025E\350\002\242V\001\201"
+	.ascii	"C\204p\215\030\b&Xq\215]\206!\3014p\305\251\2711\003\005\250"
+	.ascii	"(\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.234.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\321\001\255\021"
+	.string	"fbyH\340\360&\035\3304\021f\351#2Q\037\232\021T\306o\233~\020\027<@\265\215\274\n\344\025\210\216\331'\273G\353\032p\306\017\337\346\003`YU\270B<\240d;T\234.\366\360\n\002\030\203\373\362p\230 \262\367\226)\005c"
+	.string	"`"
+	.string	"g"
+	.string	"\007\202=\350\202\001\354\356\260@\332\rO<\300\373$\271H\367)\037\322}\332v\201\0030\307\036\206\300\341\320"
+	.string	"Tcc\332\rS\021\304c\2372j\314\357"
+	.string	"e\237\034.Q \215$\331\335\017\220\246Q\032\240a\352\360\001\316d"
+	.ascii	"\247\032\030\267]o@\232*G\312\356Zm\300\rww\333\016l\253\330"
+	.ascii	"j\022\221\307\376\320\357=\374\347\203~i\265v\352{\274E\016S"
+	.ascii	"\215\026\033\2738O7f^\314\024>/\272\375\023>\316(\377v\"\330"
+	.ascii	"\213^_\f9\fF\020\345v"
+	.string	"sL>\255\300\373|8r\033f\243lK\241\327`\037\2620\002\262\264\232\b$\004\241\027\365al\3446\210~V\234x\237V\265\377\023\237\352K*\321\224\243E\231=t\311\213\366\004\226U\322\207\0165\371Q\034\307\022\220awoc\267`\3646>\356\236R\222NS\216&\312\254$\226<\2002\326\315\270R\233AS\247;\224=\352\370\230P\212\261\307%\335c\204\232\f\232:\031\344%\235\214\217\267\235\200\n\027\265\0307\235\231>\331\241Lc\217}\271\273\353_\005\225\371X\256\326J'\343\362\372VV*1.\337\013f\345\321\022\3635xa\275$xV\241\260\270\250R\024X>VJ\345\212I\241\210\270\365\262r\245dZ-W\n\025\356\345F\036\337\366\223\243\333-\336\350\307}\001\r\243\333\221\374c\235\306\033\333\032\2352\023g\237/\271\273\223 '\244O\016Q\373\001\204\260)7\2132\203h\037"
+	.string	"\3571\270\026/,\013zm%nv\005c\255\037b8E\020L\024s\200\314\250\206D-W\244\220"
+	.ascii	"\013\tZ0\3710\b\273\314\326\205\024\027\031N\344\321\336\021"
+	.ascii	"\226\0029\245\202\301\025F\f.\302\035\004\264\231 \210wU\271"
+	.ascii	"\336U\366"
+	.text
+	.section	.gnu.lto_cliWrite.235.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\325\t"
+	.string	"\206\322C;0%i8\336c\357\371S\242\346)]\240]\234\330\325\204\364\240KN\271\221\225\261cg4#\304n\212R \226x\263\327\\\007\003\312\201Z\237\013S\212\271\036\265J\354\336R\246\0241"
+	.string	"3"
+	.string	"2"
+	.string	"\273\236\242\034<\247\t\372\237} \024Y\347B\256\334\201\316M\013\201\370\342\022HLd>{v\210\256L\220\303\356:C\021\344\356n\373\301\366\202\375\007\231NM\037d@\3031\355\354~\334\bl\255\243a\261}\221\355L\233\324"
+	.string	"^\266a\335-q\241\355\216\fV\b\2753h\333>\246,h\305\006\026\023`\003\260\002)\346x\324\250W\237\253\004\f\317+\007\330\177\371\270\362U\254\241\312\207\357|\325\347\335UEl\002FZy\263GV\352\211}n5f_\366w\001\024_\372\033\225*>\317\242\024a\362>T\312\033\025\370t1\201\3622N'\224'\032\367\334j\314\0203\265\226\272\270P\246^m\214T>4\002\207\262\334i*\251\007@\017"
+	.ascii	"\357b\314\304;\240p\t\006(\343\025H\325\034|\r\261\027\324\260"
+	.ascii	"\240\013yK\306>\225\032'\356\334T\355L\321\024\024"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.236.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\356\001\205\022"
+	.string	"\346\243\177I\300\322Q:R%\345\265\341"
+	.string	"\316X\313\340\036w\241\354\033\32603`\220\212?\243\260@J\331\021\205\261\216^\327\237H\301\333\374`}m\326kC1\241A\035\025\242\323\007}\261\374P\230\267\356\020,\352o\021!{\313\224\002k"
+	.string	"d"
+	.string	"m"
+	.string	"D_a{Q\006\263v\177l(\355\216+&\260zxr\227\370p\276D|h\333\006\016\330|\373(\324\023\322\001jC\217jw|\311\022\277=\234Ro>"
+	.ascii	"\036\356!\210\317\231\002\\\232j\361t\246\253\347\304n\204\247"
+	.ascii	"S9]O$v\214\360tf\212\210\032\037\336\273\356\360r\252!-\273k"
+	.ascii	"\335\361<\334\342mC\260\355b+\203\227\301`0h\td\037\351g}\374"
+	.ascii	"\303\027\375\323j\025\325\037\271\324RI\3214\355\366\004\201"
+	.ascii	"\3448\2052\206\236t\373-\374\237[\276\357.lO\252}5"
+	.string	"\37040\021\005\334\365Qyh\005\253\207\037Mn\333\354\226\355i\364#\333\2210\230\220\254\356hH\t\301\270\222\372\361fr\037ND4VV\017\255j?\022&\bU\001IT\007K\332\260\230\254\311GDU\376\027\377Y\020\300\263\273\337\33101\260&\016U@\035\2113K\007\3343D{f\243\337\371\277\237\207\211\311I'qv\024\213\0338\246\f\362ob(5\305=\342\256K=\236FH\031d\024\361\222\302\021\224N\177\370\344(\342\224\227\357\275\200\212\251\\\016_\210\234\006\355\021\2472\310\016\260\013\212\003\233\241\315^D\034\231\032\354E\346r#\003\253\331\310Dbn`\016jfj\025V\216\261\300\310\304^40\260\231W\214v\363bqyV#\243\275pf3\332\2535\356\347J \253\366\276\022\304\347\223\207\361\377\276\200\007\020_\214\371\337D\225;\266U\272%G\346>ww\303\332\334\375I"
+	.string	"4\322\240\003\250\375 \002\212*`N\342\\\242\001\" \200\202\031\301\365\237\030x\211\027\243x\265A\024\020\266\017\302d\347\300 \225\255"
+	.ascii	"\035\210m\2170\271\202\035\310\031\306m<a\234\316\b7E\036\361"
+	.ascii	"c\333@#\216\024\336\335|{\307\227\"\247\016\346\025\006\203\013"
+	.ascii	"\356 @3A\342\025\267\240Q"
+	.text
+	.section	.gnu.lto_cliPrintf.237.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"E\n"
+	.string	"FSE90\257\322\001\204\356\315\321\345"
+	.string	"X<3\200\013\3411&\027\267\017K4\360\255h^D\004\333\234l\024F9e?X)(d\220\240\031\363\352v\253R\037o\373\0337\332;\2450"
+	.string	"4"
+	.string	"5"
+	.string	"\324\342;\334i\346\001\334\251?\233\345b\310\336$\334(\251\355n\235 \377.?\377\261k\302\025x\2119\330]\313p\325q\317\333.\260\375\261\037\n\313qkA\311(J\353\260\337\376c\336\330\342G\276\303N_\r\025B+5\356\252<\247\366dN/pi\337u\221\357/\213svY\256\223]\361c\203\314\003\2405r`eN\273{\350\314d\234\364\374$\217E\020\244B{\242B>4g\226b\0333&h\213\240\234\037\366/\273\273\236,\373\257\177bN\333\332\214Be\003\"\ti\022\225\274N\201\363\bDb\030\325\006\222\250TG\036D\005u\3349$x\325\324u^\335\210\373\313N\226)mm#j^\370t\331\365\b\2150y3\200$-\324l#\306\f\023"
+	.ascii	"\357b\314\304\2131\\\340G\355\230`\203\304E\300\003\0326J\n\b"
+	.ascii	"\203\350\370U\023\230]S\320pp\247,\006C\344)*\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintLinef.238.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\365\n"
+	.string	"&TJ@\020\345j:"
+	.string	"\\\207\350H\262k\254\200\303\205\216\021\353\0373\022\200(\376\242\264\034\001\351.\370[\263\215\355\336\003\315\225C[\277b\021\200 \"\035\001"
+	.string	"\306B[\240\362=\020\337\323\221\240\275S\n4"
+	.string	"9"
+	.string	"8"
+	.string	"f\360\316\331|\247;\347\375\240;\347\321.pse\017\240\004\004\246\266\273_U\371x:\372\207]S\256\310S\002\207\3355-W$w\275\355\005\333\037\373\020\001\264\223\232\001\023\201\335\221\333\001T\214\023\320\372\353\267G\037\346\215m\336e\374\353\364\375P=\264L\316]\225\347\234=\336\271#\234\332gy\313x\027\3079\273\254\230"
+	.string	"\273\346'.\240\243\tZ\210\355\354\250\24454AV\253\035^tfgG=\377\313a\031\n\"\245\275a\242/\315\231\311l\247G%m\223\2445\305~fw\327\225e\337\365W\357\001!\rZ\n\221\304P\2423\b\032Q\200_\305(D\372@\021\343\003u\034Z\210\304\257\024\206\342\2671\367\231\255,G\f\210\241j\312\247\314.J\303\371\2427\033P\033\024\321T\2663U\311\024"
+	.ascii	"\357b\314\304\023|\270Q\213\017\263\360C\270\020H\\\004A\340"
+	.ascii	"\260Q]\300\032D\321\257\032\313\352\232\"2\021w*`0D\236\242\002"
+	.ascii	"\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.239.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\267\002\305\023"
+	.string	"\266\243\200I\300\224Q:\350L\264\210\351Sp\312\204d\017wT%\367\003\255\324\3500\375\274\034\233\335\016\230\003\035[\212\377v/\230\331\201\376\374B\375\301\366S\022\273\"\032f\373\377+?b\372\027\3316\365\320\351\315\021!{\023)e\nh"
+	.string	"b"
+	.string	"p"
+	.string	"W\030\272\243\351\221\b\035\320\035\324d\243{\\\271\202P\345GE\231*C-0U\236\366\023\321q\250\301\"\"\037%\251\356v1\013\245\351\224\037/\355\n\266\230\344t5\235(T\256t\270\217\325\335=\373\235P\376\020"
+	.ascii	"yj\261\322\335\276\004*V\314P%\335\021:\236]\260\245\273\277"
+	.ascii	"9\235\t=\250\377k\376S\370wH2\224i\347J\364\233\234\325\\\316"
+	.ascii	"T\251\234\262{\001\264Ka\333\251\177\254-\013\375\372uw\237\203"
+	.ascii	"~MR=\321Qu\245"
+	.string	"G\252\252o?y/y\377\361\236y\277\274W\003\332\343I\031\001Q\244\273\304\224\222\346I\034E\377U\365\177\367\212\224\024\342\200\200\276!\0019\270\306\370MT\236\301\270d\201\356\003**\345\016\311);)\240\035\312\236\360_\301\202\210\204\251\027u\343\332\t\354\t\257X\227.`\b\273m\232\373\370\027_>:>\346\037\036\275\034\260\231\020\347\242\242\222o0\203NM*^V\017\327j,\363\217\223\221juIi\324\254\fu\3434\027\013q\017T~\231\207\325\334\001<\365\340\365pmu?H4\361w\246r\006$!\267M\362ko\265Z\337Y\r\370\254\227\b,\031\030\031\031\b\255V+\200\370a_0\233\033\326\314L\fq\304\330L\266a\302b\342\213\206\330\013\374\213\205\206\303\313\325\201F\214\271^\263\033\027\013\312e6\260\231\013G&\233\271Tc+\007\311\036\257\027ec\236\311B\2523\203H"
+	.ascii	"]@I\035\261\355Tw\327\244\316\234<\365\241\343\002s\205\231*"
+	.ascii	"'\363\017\224\321\367\0243!\304\305\0046 \360\002\0211\353/b"
+	.ascii	"\f\f\2551n\311\215p\254Ce\016\023\332\3351g\350(\003\357\022"
+	.ascii	"\033\306\260\315\274\224\303\311\002\214e\314\036\243\220\267"
+	.ascii	"\244\3157\227\0237c9\344n\361,\336\023q\256\245\363\030\024\365"
+	.ascii	"\272\244\271\\\323\241r\325\013$\"\204\007\306\330k\3016\316"
+	.ascii	"\021\005\3061\370\303\334\240I\026\313\347\006\214(\302%\016"
+	.ascii	"X|\271u#\303M)\352\036"
+	.text
+	.section	.gnu.lto_cliPrintError.240.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`e\001\355\016"
+	.string	"\226[cE"
+	.string	"\261\266p\030@=\312\235\002\353\3723\"\357N \034\332\370*\365\325\267\"\0237i\r\223\002\333tT\255\231\277\363\035\245\221-Y\033{/\250J\020\350\230\256\314B\340q\342\365ch\3668\254^\332D\312\224\002M"
+	.string	"K"
+	.string	"S"
+	.ascii	";\212\030\301\347\231\307\207\264g\237\023\320\2369\264q>\252"
+	.ascii	"v[\305\340\300\312\331]NO<<\246\031\372g\035\200\210*\035\023"
+	.ascii	"q\305\026\324@\221\020\200b\301@!pf"
+	.string	"\234\365\354\200Z\311\334\036\354\256SD\201\270\263\333&\261\335\300\276+\307vw\255)\373\343\277=\346\3274\235\232>\350;\306\234\033*\255\335\017=<\246\233\314fu\232\337\376Y\006\3712\237\tO\223\362=\271\220\254d\274v]B\236Y\301\347\331\013\214<\t\236\366Y\274E\370\030\225\177\354\246Z06\372\202\303\256\0229R\250\302\030E\273J\230\241\301\222:\354\273\370\013\024\037\205+\214\362\342H{v\325\027\033+F\230\262\307\036\t\242\332TS\373\003C;\243\316\353\244%o\031\362\327\234eb\300\203hg\330\220\027\375\261\243B\347\325\242%{,\245\302\330\001\366\b\240\235\206<\351>\022HA\023}\035\204\t\237\267\331\033\031Y\360\270\013\243\356\343<\222\t7\0222\210AD\342N@\220\304\201\306=\266\232*q\335\230t\305)\330\256\t\007/\231\354\301\006\344kn\023AD\265{\272X\36291"
+	.ascii	"\261;\357@\213\226Z\242\324  \220\202\021A\273\001\377bL\343"
+	.ascii	"\205\021m>\3679\262d\335\336R\035F6\373-R\316\313:\346\007\316"
+	.ascii	"\036\336\216Gp\214o\340\326\220%\"\022w@\nw\355\354\202]\016"
+	.ascii	"\254\177\034C\016\3155X#\002.\212|y\322\344\024\315\357\001"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.241.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\265\f"
+	.string	"VXWC \217\232\016\004\212cS\002\234\204T#b\210\264\310\016\377\b\250\232f\033\220\334\032\243h\235\326\261$\016\b\277Be\332\200\325\2661RR@\001\007\240\002\207\263\364\314\302\2726\340\200?\0325\332d\357\224\002@"
+	.string	"C"
+	.string	"G"
+	.string	"W\301\035\205\344\230\335\016\f\027\273\365\200\013P\247\256\317H\247\324\003H\247\346\354\226W\317N\237\026\017`hw\253y\342\334%\347\037\374\3453\351.'\006\273k\371\231\214\270\347m\023\260\255\300>\210\321\356\256g\307~\375\351Q\376hJ\377\362\261\206bh\030wE\21428,\364\305\347\240\337\376Ao\370)W\341\016\032\371z%\r>\241p\267\304\343\324\b\250\323wT\222\016"
+	.string	"\313A\345\203\201K\373)\002\237Ey\t4\366\265\031\360\025g\221\301Ga\t\230\374\207I\247\237\017f\210'\0349ZCj<tF\323\316\264\314HB\f\275\331y\222\036\377\312\301\020\001!>\333\002\006\371\317\230\361D\f;\314\316\256\235\234&\354\007\326\340\230\326\005)be\233\026A\332d\226\003\b\3315\371\372\300&\\\025\005\314\312\252k\013\251>2\326*l\266JD\323\266j\243\356\243\235\035\203\210,\234\271\301#\321n\211\005\007\375a\212\034\215\221_y\013\020\215g\327{\026"
+	.string	"\357b\310\304\273\274h\302\205N\0329D\260h\234\3026\266@\303H\tG4\330\275\t\354\\\003\013\346H8\3530\216\t9"
+	.ascii	"\303`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_getMinMax.242.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\031\003\r\023"
+	.string	"v rG\340\322&\035#/"
+	.string	"\025\b\325\330\330\272\363\264\200nq\255\021E9I\337\021--\004\240\357\353)\312|\300\321\332\004\310w\354\303\202\035\364\001"
+	.string	"\034\001\204\033\232a\206\317S\316g\020\347\247\200\363\205&do\"eJ\001Z"
+	.string	"W"
+	.string	"_"
+	.string	"\276\213\277h}\006\363\001\2738;\202v\277\024#\350\016\375\335$\036v7\305C\267l\244\1779\313\351(\321\320\206\354\256\247(\336:\3344[\376\201\327\017X\314u\250/\242\355>\177`\"\204\020Xl\304Uf3\260\273"
+	.string	"b3\231\234\203\335u\302b6w\274\355\025\333\236\255\257;\323\300\247]\340\320\245\200\211\207W\b2\030<\263\230\\\262?W\352\t\373\333*\216\255i\323{~\001\377\376"
+	.string	"\237\375%0=\022\323\035Ls1\035a\032n\351\r\246uK\247\246O\200\205EQki\267f\211\310\326\240\220\216\355\223\330=E\030\344\347!\037(O\0070 \251\252\247Q\2129]\b\225\222c\227\333\300pr\224zP\206C\223\243\324\257\220\321\222>\343,65W\026\311\335u\251k\030\251"
+	.ascii	"M\226?\2114| \370\332\331\265/\3036R\267\353:\211\337\254\212"
+	.ascii	"\232\235\275Y\005\207&\275\317\027\334\314\244\222"
+	.string	"\271\237\304\253I\23542\031\253\376\263\3526 N*}I\251\224u\372\240F\251\2444\240\274\227\324I\345\241X\035<\025\023\2576\270\260<\017\253\025\313#\371\366\333*\216;\243\026\265\030\225\201#\235\216\254\334\250\250\326%q-Q\271\b\357!!\301\204\363\240@\024\365\"d@<1\216bTb\203\0266\205\025\256#\007\216\355\207g\246\352\017\265\370F\211\357\241x\370 \001I\250QT#\025BE\023\244\240 %i\306\320\002\221)\272\r\021\020A\247LUiR\2509O\370\311\364O\242\341\022\022\212\237\273\240P\036\242:\3464.<\002 x\262\211[\272V\242\256\216K7\0162?\360\004H\2360[\236\002l\004\215\217\027\300>\277\204\202\256!\254\361O\"8C\247\221\344\307\367\222\232\370\260\371\335\331\035\220\254Y\210\\;c\346\2179\270\254K\017a\274\354\017\212\240u\213\t\203MCS\224\033"
+	.ascii	"Q\207R\b\020\223\206\315a\331\211\213\n"
+	.text
+	.section	.gnu.lto_printValuePointer.243.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\275\024\005["
+	.ascii	"\372\2258!O0\220\322\351[\267\210&AS/(\323\343\354\320\351U\215"
+	.ascii	"rG\203r\025ft\2348\2756\240:GH\021\342\352\315\025\266\310(\b"
+	.ascii	"\370a\356-!P\2200\254\261\354\231&Z\030\032u\3011\f\036\333\255"
+	.ascii	"\364\333\024G\343\213\231\220\225-\245\224\002\375\001\320\001"
+	.ascii	"\n\0026\316C\241\263\320:\253\252\263\035:\007\205\316\257:\273"
+	.ascii	"\352\334T@\200V{-\230\221=\037\333\345\n\314\341J\255\035\223"
+	.ascii	"\246\353\256\353\226\353\256\322A\346f\356+\334X\332\216\211"
+	.ascii	"u|\027\274p-\320\2364\271\327\tc\330\226\216\357\224Wl\267\213"
+	.ascii	"(6\004.M\315\275N\004\346\230\330V\256\003\033\314\310\264\030"
+	.ascii	"\266e\3567\3568&Ri\270\265\253\360]_\257\333\036\220\231!\351"
+	.ascii	"\273\367.\265\345\025\303\266\312\240\023\231\331:s\211\247\265"
+	.ascii	"[\270\240\331\222E\340\322\360P\374\024>\303d\204\263i\360\263"
+	.ascii	"s\257\332\2040\2653wZ\253\255\275\306A\033\357\035\313\303r/"
+	.ascii	"\233\b>\032\266e\266>\252m\207\335\243\266\345\225\331\314\017"
+	.ascii	"\326e\2360\003\313rSs\357u\372\023\270\003;\310\326\\\364\265"
+	.ascii	"A$!-\217\214\212\210\224CI\244\320\207 \240\037\017\035\216>"
+	.ascii	"=<\306\035\235\034\234\"\361\306f(Tm\360\225|\345\026J\271u\021"
+	.ascii	"\024\320\212/\256\213\331 \222\220\256\364r\356\212\037\031\025"
+	.ascii	"Y\211s\"%\335\034\234\017%\205RH!\2654\377\020e\315\203\350\032"
+	.ascii	"\210\005;(\376\203\327\036\360\230x\007=\347\222\240\362\314"
+	.ascii	"I\347\307's(\270\217\\\025)J\360l\317\027\217\020\243\t\255\035"
+	.ascii	"@3\235\271\036\332`\3667C\230W\222\316ARF\006\326aN#\352\315"
+	.ascii	"\035\222;&\ns&Qq\202B,\256%\255\347\304\013\006\360\327g\327"
+	.string	"q\355[]V^4\301\213H\023\211\302\274\206\364M0D_\335\r\255\347\034\022<r-\321\3523\347\227\333p\031\322\t\343T\022jf\266\343\032\001\261-\2664\2770/h\007;\314\371\314jb\251\3050h_7]W\366\033\b\221V\n\2060\302%\204\326s\026\t\036a\020#\323nMt\346\334\342.\224\272\367\262kuy5\207h\346ob\346\021\230\215e\002;o\334\371d[\2204{\335\323=\250PGM\316\353\240\241Z\245L\240\266\315)~\324\343xs\236J\374\342w\363\214\370\311\275 t\322@\365\206\006\233\2779\263C\205\016\265\255\215\360\243~(\374\244\330\026_\227\356\251\036\032\313IW\277\255t\231)\344\364\336fk\0310l\316Hr\221\200\267\026+\261\236\311\366\325\367\271,@ =\346\307\013n\036j[\373\275\365\365\037\365\301\357f\nV\036\310O\377\237l\323\n\314\002\354\274\216"
+	.string	"O\312\3645\234\327\225\302\221\340G\371\270\247\301-1p\203y9\030\270\365\\\212\027\356/mYhr\217\\%.\314lfx/\263\215t\037\271fJ\232\334{\225\332\272\210r\244\351\200,l\244\352\357b\213\177\307u\260\357y\347\367T\\\300r\376G\271;"
+	.string	"\262?/Jl\215TS|\273\365P\257M\314\225\377qK\033\251\366\247x\366\254\247\025\307\350;\031\303{\257\240\270\265\254W\013\f\225h\240\266\355\377:\2671#jk@<\220\231\215\351\037e\356\216\332M\377\370\307\230i\364Z\367\214n\241\373\205\352\354Bu\236j\301bE\3135\253h\271f\251\236\322\035\245:\247h\266n\024Gg"
+	.ascii	"Z\256\031\252\2534?\265\363\t\037g\023\326\271\204u&a\235G\250"
+	.ascii	"\316N\355\334\324\343,\202\350\314Dt^\352q\016a\235\225Tg\020"
+	.ascii	"<\316I\326\031\311:/\215\316GFg#\243s\221\2163\021\216\263\362"
+	.ascii	"\306yHuNZg\244\352,d\235?X\347 \325\031\310\350\374\263\343\354"
+	.ascii	"\201\350\334\201\350|\264\316>:\316=9\316<Dg#\321y\307:\353\340"
+	.ascii	"8\347\024\235q\210\316E\2423\321:\337\3348\333\004\353\220\265"
+	.ascii	"H\3335\017\\\0304\322\3463s\234<\305~\216\234\254`C\323\022\206"
+	.ascii	"\315\007|\032&O\212\365\314.\302\\\301\303G\371\002\365\305\017"
+	.ascii	"\020D\006f\r{c\256\374/\017\314X\207\217\362\321\033}\237\211"
+	.ascii	"9\332\032}:\023q\364\255\005z\007e-\351F\337W\274\t\324\033\375"
+	.ascii	"\215\330\027]\026\240\320I\\\225cO\275e\316\211\265\211q\261"
+	.ascii	".\276\241\365\371\365\035\315\350\221\361\371(\253hM\036\251"
+	.ascii	"W\315\336\214*^5k\356\254x\025\354M\207\305\037\337\300\204\344"
+	.ascii	"\264x\013\314\310d\321\341,5\324o)aG\341\242\215)cG\"-\202\227"
+	.ascii	"\366\304\004\366\023\224X"
+	.string	"OD\232\366d\214\035\0044\2600\327\2727\305\027\337\320\244~}\316\325\355k\240=E/\265\3365J\321\023\305\240T\276\300x\210^\305\337zW5\242g7\\\030\022\214\312_\361\336e\275\253\024\345\023\305\236TF\b\334\031z\026g\326\253b\210/\204n\270\2754:\337\342\275\313z_\f\223O\024\343\242\262\365\345]m\303\013\017\221\023\266\344\370\020\356)\027\224\033\f\332\026\t\334z\201.\002\016\356\305\016\002\237q'\017\311\256\363\262M}\317\265\021n\257\2134\313\001\271_\350\376\2512ef\210\340|\224u\264\2104\336\"QZ\352\247\337B~\233\021z\244\020\031N\037\254*0\0059\022z\247\2625 \036\330\301{\357-\366\323\323\370\244\225\226\013Nd\362\266\342Zk\031\222lM2l\322HBae\342p{u\322\253g\366\bLn\200\336|\224\237\376\303wX\233\227\246\016\372\017o\3214\215"
+	.ascii	"}\320\267\231g\311H\"\343\025\315\233\253\nGd\253\023\307Z\241"
+	.ascii	"\264\025\"\003\372&\362<s\304\346\347\333\212[9\300~\025X\243"
+	.ascii	"@\240\266\375y\237\353\360Q\357!x\374\016\307O"
+	.string	"\356}\360%\f\332\320gM\317\373\374\321X\325l\250m{\214\037\365<]C\007L\265T\242PV\260T\n`\200\213\002`\304`\241l1\305\200\002\r\314\230\021\203E\020\213p\256`\371\\@\0011\202\f#\206\222j\251\024\262\217\245r\204Re&g\037\313g\252\345\357\300\241\3431\250\241\343-\216\316\221\303\207\004\301\0367,\330\201\203\207\0027|\344\250\361\243\330\243\306\217\277\241\243\006\f*\0356\204l\243\tG\016\033N;p\324\320\341d\243G\005NMG\346A\301\215\036N\026\360\340\321\303\211x\373\307\334\272;\340\363\223\002y+\366\022\232\245\230\276FL\020\0200\034\352O\364U\201A\"\343\03367Hj;\343\231\253\304T\3110\300\221\254g\226\3612UkN\274\372\204\346\340\267v\2003W\315PU\303\004}R+\344s\t4\351\243\374/,\331\307\254e\3556\315 \251\355\277p\024\365"
+	.string	"\374\026"
+	.ascii	"\323)\017>\202H\037\365eW\241QM\374\217\2661\036\303z\253\320"
+	.ascii	"p\240\2665\361\311=#_\266\276\222t\303\361\335I\217\364\252\322"
+	.ascii	" \253\374\206M\n\244\030\365\025\377\222\203/\312M\032\263\025"
+	.ascii	"\212\226\272\304\030\246&\361%\276\263\236#\036\352I\274\317"
+	.ascii	"5\001\235~\3047\016\316E\006\3234\357\310\351\373\fj\006\nY\027"
+	.ascii	"\337\2424\361\353#j\372+\274u\254j\315\312T\33361}\210\0271\\"
+	.ascii	"z&\250_z 0U\201~\2672\373m\252e\305J\"\313\022\342\325/(\037"
+	.ascii	"\2245 J%\020\257d\345u2\372\215\254\211cY\261\220"
+	.ascii	"\246\367^\005p\305\351\326\254 \257\036h\265\345^\267\324\266"
+	.ascii	" \276\337\312>p\271\225\213\200.\267\262\202pb\032\3074M\372"
+	.ascii	"\356\203\206\361[\2136\037T:\224t\025\320\244H\244_NYE a\330"
+	.ascii	"\244\342\353\2226\237geB\037\365\024\372\f\f?\027\306\203\017"
+	.ascii	"H\357K\332\270\3205\3227\211y\006\321\335\260\250\276)\036(\034"
+	.ascii	"\"\347\005\004\365\313\272^>\006P/~O\250\357,\256&\201\032\023"
+	.ascii	"\336Y\032Kgi;\326\242\205\342\231\003\201\233\250q8\344\030c"
+	.ascii	"dFDD$I\222\264\006\241\005\304\030\306\030\263;\022\200SA\211"
+	.ascii	"\224\314\031\"\222$\005\251Q\247\003\347'\345}R?cw\327\230\324"
+	.ascii	"n?\263/^I\325\271\224\362\341\006t\\$\344\306\334#\027H\205\220"
+	.ascii	"z/_[\222\366\267)\004\022V^\251i\334\030\263 \313\311{\260\327"
+	.ascii	"+\003\347\3470\345IdN\236y\240p\274\334\377\026)\273L\300\335"
+	.ascii	"\316X\034\335\320\031\226nx\346Y\306\013.\327^\031f\344\260\332"
+	.ascii	"\270\344\267\357\304m\207\037\250_\006O\323\232C}\345\370x\305"
+	.ascii	"\237\034*\314\245\235\312\315\306\036\025`\231\274\022\311b"
+	.string	"\276b\256/:\336\233\274\242\201^V\315\272hm\204\361\226#\372\210\021\316\272IM=y\233\303S1\231`\377\343\245w\241\256\220:Q\034O\226\350?'\322L\274k\300\214\366\335$h\232bN1+9Y\276\270\273n-\273\3713\374>(\336k\214\024^\234{\241r!<\352\"h\334ZF{#w:2\271\364\251\261b\242\276\237_\3440\240\264\332}\222\016I\202o~%\313\245|\260\301Ok\022B\366%&\007\374Ib\375h\324\t\245\350.\277\373b\331\240K\024\231\236\210\317z\343\\\020\032\274T\322!\360-E\273\225\221\355\366\253vw\030|\306\177\320\257\227\331\013'Q\267~~\375\336\266UE\322\r\343\020h\006$Z\222\207Y)\260f\377\201U\272A\203\336\001M\27719Y\316\234\251V\226\226\034\310\365\306k'|\343\367\340B:\220\253\221\026\305lZ\026\006\017\204a\025\341y\f"
+	.string	"\240\276o\036\326\260\247\207[\221\200\365\027\231?\032'\305\246\274\301R\315*\234\250v\306!7\f|"
+	.string	"p\254\246\261\357&x$\20322\220\\\364\020]\031\031}\033\267\232\024\224\2227\362\304QC\343f b\346\321\366\363\303\264\377e\ny\243Q\307\1776B[7Ykd\335\214\032E\327\b\311d\312<\245\031"
+	.string	"n"
+	.string	"\213\232B\252\316\020N\214e}@\201^"
+	.ascii	"\243\342P\204)\300\001j\003\304k\202db1\210\272\377\234J{'\316"
+	.ascii	"\317\272T\202\bm.\352\267\204,\333-d\031\273\317B\007~\033X4"
+	.ascii	"\217\254\230\354_\r<nJ\225\226r!\355)7^\247!M?%EN3\310\020eO"
+	.ascii	"\252`\201\3330\251\333j\350\250N\224\336\032\243Q\034\342\242"
+	.ascii	"\274R$\226\006\313\300\024\037\020\364^\237SC\262\3708\013\360"
+	.ascii	"\177\242\300\224\200qT\227L.\200\034\304\345q\230\357\222\034"
+	.ascii	"/$\013\322F\250>\304k\206\302j1\210(:\355\246\372\325-\365n$"
+	.ascii	"\020Z\250\241\216K\316R\237u\037\317\315\264D}n\027\261+;HO "
+	.ascii	"\227/6\013\200\364\254\005\023\001\236\216\350\274\276\214\222"
+	.ascii	":\314\024\202qf$^\027+\334\314\372R!\222\341\227\375\334\221"
+	.ascii	"\205\271\303|\214\260l\267\022\262\325"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.244.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`I\f\2459"
+	.string	"\272d\004\026AP\244N\007\255l+]\203\\/\311\370a\3718\210\272x\302f\021\236\026,'\b0\022TZ\211\360\212\002\327\370|\005\021\245"
+	.ascii	" \"\323\3653\237|\366\005f\246\252\331FMD\2046\221{\247\224R"
+	.ascii	"Z\001-\001I\001c\351\375q?\216\234\236\035\225{\237\033\364\030"
+	.ascii	"\332w\3556\0169u:\376\356\275\021\326V\265\364\026\261\316\253"
+	.ascii	"\001e\366\274jB<\2714vU\255\362\203\265U\2504\313\034\363\237"
+	.ascii	"\314Gi\350\232\341\355\230rgn\273\306\"\326w6Zy/\234\2361\367"
+	.ascii	">\017\360\200\265U~\366\221mu\355\"\333\252\202\006b<\246tF\006"
+	.ascii	"\210 J\264\271%\320\275\317\253G\302\035\355\364\331\274\364"
+	.ascii	"\261~Z:51-)%!\035\031\025\021)\207\222\310\243\261H\034\256B"
+	.ascii	"\253\246\357c\334\302\255\275\326P\306D\214\0165\262~J\205g<"
+	.ascii	"\346\032\216\363.\305\022\364G\246\3034}yd\rK;ai\272\322LV\256"
+	.ascii	"\370\222\225*\256d%\311I#\3159\361\243\271&n\344\244hI\023)Y"
+	.ascii	"\342J%I|(\255[\002%I\244\221tN\"~t\033\342\306\325O\035\021\300"
+	.ascii	"\2675\273.r\324\333Z\220&\3229\203\370\020\216\263-\205\212\242"
+	.ascii	"s\002\361\225\n\0239!\375\346\374a\211P%P\216zs\332Y\241p\353"
+	.ascii	"\336\333aZD]\020\300\2675,m\331ZE;\363\324G\177j\300\215\215"
+	.ascii	"\017\244\232Yz\364\306\210\236\336kOS+s\027n\335{\331u\250\255"
+	.ascii	"5\003hf_\301\314 \230\211h\001m\\\252\024\3658#\364\317^Z\006"
+	.ascii	"\337{\275\302\301\273c\346\202\270\373zi\373\031<{\363G\031\223"
+	.ascii	"h\276\022\353\275f\016\270\307\2149M\254LZ\345\266a[\355\317"
+	.ascii	"j\313\023\274\273\341Q\346'\231\177\034sc\311\t\032\344\207c"
+	.ascii	"\266Pa\213\302\004\t\021:K\267V?\273\263 `\365]\367\003\325\271"
+	.ascii	"\201\352\314\300:/\260\316\n\254s\002\353\214\300:_5\230f\253"
+	.ascii	"\316k>\320z\315\314\252\366\322l`\350L5t\236\032:\027P:\023\030"
+	.ascii	":K)\235\007\030\235\005\030\235\003\f9G%\235\241\206\234\001"
+	.ascii	"$\235\237\214\316K\243\263\323\320\271i\350\314\204t^B:+\035"
+	.ascii	"\235\223\220\316HG\347#\243\263\221\321\271\250\350LDtV\026\235"
+	.ascii	"\207\210\316I\2413r\350|\034:\033U\347\242\352L\\\235\207\252"
+	.ascii	"\363\272:\013\205\316\326:\253\3269U\235_uv\325\271/0\315)\213"
+	.ascii	"\243\245\016\307\327y^\036\321\301\333\247\222q\322`\272\363"
+	.ascii	"\272\365\272\275t\312\334\314\375\205;\f\027\30104I\032\273@"
+	.ascii	"\037\326V\233Y\214\233Kw\351=.r{\tDZ\257\374\2459\201)4\270\260"
+	.ascii	"\255\016!?\353\223\310W\t\035?\216OC\227\304\351\326\303S\306"
+	.ascii	"\370q\354\304\252\026\252\0312\373\352\352+\274\317\261\305\217"
+	.ascii	"K\261\004\375\361\021\037\256\206=~\3779\360\306?~7\177\024\337"
+	.ascii	"\370\335,D\374\365\213/\334\323d\363\"j\375\360\233\266\240I"
+	.ascii	"i\300\030\033V\356/\333\352\372\235\326v\303\243l"
+	.string	"?\353\205\337hR\254\336\276\005\323R\203{i\303\036\263U/\34433\b\017O\013+}dN\210\367\004\331\330\326\217\343\336\303\355\227^\301\303\235\347\251\324\341\266\343M\344p\317\351$On\2217\334p\330o\275\227\254\335\270\227V\254\310\255\033\362\344\336K\325n\230\331\257\333\215\375V\271\353\274\317K\325j\203\3570\255\324\303S\245\257\351\205X\330\340\271\2409S\023~\034\3332l*\204\267|S\322d4\032\215\366\224=\360il\325\207\360\035\230>\263\325w(\332`\231G\371?\375\346\320kJ\f\220S\343$\367\337\316\266/\202\352\307q\022\032\237\337c\2751\217o\316\231\315\374\264\276'3\023'\365\307z\017l\026\272\321\241\321\224`\332a\017}\006\204\224\235\020\r\035\321\352\322\216\177\323\005,:\314k\206\214.0\033\006c\306\327\2050\030]/\272\274\272\214.dp\275H\303\274fp\255\350\302"
+	.ascii	"\026\026\203\b\026\026\343\301\270h<\253\260b\341\245\342\n\006"
+	.ascii	"\013\256\027W*\300d\\Y\035\361W\214.\260\253\260\257/\260\253"
+	.ascii	"\342\375\353tY\365\021\"(\373\362\364\350\273\361e\177O\037\307"
+	.ascii	"E\035N\026>P]\220\246\030[\325V\237\306\251\223\0019u9\232bl"
+	.ascii	"\247Y=\363U@3|\360\332\230\271\240N\357\275w\211&\257I\302[4"
+	.ascii	"lI\023\336B\351\024Qx\013=\222\334j6\2642~\305\n\317\251\260"
+	.ascii	"\352\r0\333\352-<RY\0227hnm\272\235\220\23791-1{\301\202\227"
+	.ascii	"\320\304D5\365T\005^\352\247\350j\024\320z\002~\307\246\324@"
+	.ascii	"a[\225\022\360Y? \r\360\002\002,\365\321\003H\t\351\210\331\n"
+	.ascii	"\024\374\204$\244\250\00708vw!J\353\241~)p\320\302\005.\333*"
+	.ascii	"\200\345g\375S\003j\247_:\275\335rT\347\016\240\021\221\222\331"
+	.ascii	"\t\022<\205\"\242\207\353\323ML\337\264\364LJ\217\364K/\f\024"
+	.ascii	"\374\220AI\353\223\276\t*(\"C\227m\025\311\350\263\376\310\233"
+	.ascii	"\327\330\2427\372F\243+z\013U^\241\263f\byd6\002\004\277\225"
+	.ascii	"\374\270\224\202Y\027*\310\207c\242\037:\241!\200\370\250QD#"
+	.ascii	"\031S##\"A$I\2224\006\360\002\021\031\252\315\001\0210!cZ\325"
+	.ascii	"\202\246\320\030/`\357F\fS B\251\025\253\313\364I\245\373\365"
+	.ascii	"\222\217\336\222\370#m\243r?w\242l2O\360\351\367!j5\254#Li\026"
+	.ascii	"\305\367\340\271\246\300\275\277uc\031\017\345\3670\027W'\373"
+	.ascii	"\265\310Y\312\017D\t\020A\304[\305\236\002\244w\213\320\377\253"
+	.ascii	"xj\020\033\301p\005A\263\376)\026\244\240\333"
+	.string	"7U\324\336\370\003\242\244\250\355\222q\320/\211S\206\322l\247\350%\005]\001'\204\346g\n[V\270,\375n\325o\025\033\373\317\\\266\377\022\335\017\366\375\377\264\307\177\271\376\rP\016\257Xe\354`\n`\021'\n7\332K9\351\337Q\316\334u\254\324\310!\210\250\26764\031\fB7k\203\263\206\211L)G\235\326\330{\325\370\2335\366~\252\305\363\212\202\206\257@\020\306X\001\021\\\322U\211\247\376\365\274\332\300\034\315xF=\320\371\330\0176\271\226g\3448\031\240n\340\r\357+\276\005\340\364\270k\002\300\b\255\224\267>\034s\266v\376\300y\035\004\221nG:\215|j\372\326\341\f\n\344\0303\315\026\363\254^\221\271\367\260mN1\325z\\\2215Tb\216J\033\222\225\340n\353\2126X\251D\020\210\214\200\343\337\260A\214m\302\377\371\267\276I*+l\003\374P\230\354\204\261\2224\244H\322{"
+	.ascii	"9\371p)2:\0229\230\f\310F\300\241X;A\325\323+\200{\256\b\035"
+	.ascii	"\2442sJF\322D\331\206\005mA\264\275)\373Q\003"
+	.text
+	.section	.gnu.lto_cliPrintSectionHeading.245.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`e\001\335\017"
+	.string	"\366\334kH\320\322(\035\222`PW\307<\344\206\254(Kr\214H\374\305U\354\332\315\260\315_`Z\253\232,I\230\356_\366\367\035<\355\357\355\027\324\r\373\232A|\302\301\002\230#C\275\344\023\324\300) &\220e\223\270\367\3362\245X"
+	.string	"W"
+	.string	"T"
+	.ascii	"\237\303\227\320O\357\001\350g\374\360\331\351\224qg>"
+	.string	"\355\224\301\006\03668\200\300\f\237\362\244\003\"\t\300\217\214\233\224\013~\330\2401\002\332$\245q\3001\201\267\215\322\344\342(g\004\244 \021\230\210\201q\237\357\fX\333\005A\251\265ze\300\0137\310m\257l7\260\037\"4\026\300\2130\252\225fI\251\022\315\030#l\313l\223m\357{f\002H\252\215\007\205\220\002\271\366\201\004\262\357^\036\016\310\345\330\031:y\237\336\265\237\342*d\017'8\244\326\032#\241Z\303\223\013x\237\004\244m\377\304wd\236\305\230\033L\215\001\335\013\234\217\217Z\303o\261\243\003\221-\322|\f@\032v\363\205\322\270H<\273IKGC\322\204>\276\004O\021\311M\350\214\217\262\006.W\333\245G\033\022=E\3213*c\256B\316\212\0367t\330\026\311\016i\033q\354\313\032o\354\357~\372\360\237\357\371\245\327;\327\017a\321\t.\030\204\225\225*\005\245\022Ad\005\325\342"
+	.string	"\026k\301b,\021\226\027\352A\313%\226\3429u\242jI}+\025\312\345K\271^\337I\211Y-\025\327\007c\261\\\237)\254\2177\336\225\361\036t3pAR\306\373\334S\322\r\375\004\315\263\370\306\231h\024\230X\243\336\312hKx\355e\034\035"
+	.ascii	"\3571\330\020Z\260\016\251[\200\033[\261\016\315\300*B\325\260"
+	.ascii	"`\027\330\"UqY\305\002QI\343v\021\304\320\n\3125<\\6 \301\206"
+	.ascii	"3\206D\320\267\317\265\004\224<\270KJ\033\304B\007&t=js\250u"
+	.ascii	"\236\001"
+	.text
+	.section	.gnu.lto_backupPgConfig.246.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\t"
+	.string	"\266\322B;0\345(\035\236\213[\017\325}\233\021\221N \021D\210*Kn)U\264KNJ\026\rY\202]\3408\221\271\215U\305EDD2\200\301\223\217\260\344\341S\325\013\244\022\262\245L)1"
+	.string	"0"
+	.string	"2"
+	.string	"\3419\3311\355\007\3311{v"
+	.string	"\204\215\375\032HdN-\003vw\323\220{O\317\177\312\tP\251\3579"
+	.string	"\261\273NT\312\343\326\333V\260\315`\377!+\373\340\237\305t\214i\325tf\372\332\306\244\225\272\310k\267\343E`]\030\314\210\306\366\323\376\311Q\274\203\245\033\354\256f^v\303\216\027\264c\016w\211Z\300\002Eg\341T\023X\327\324\316\251\200-\276B\322v5\034|\225\016Ck\035\363K\331\261\353U*\001%\240)_v\370\245\202\330\217\273\273\326\240Q\372\343\tQ|\266\212P\204h\373t\244\315\30317\222\350\266\013\216\3536M\270\217\253+k"
+	.string	"b\\&\315\360&SU\243\332\240P\036e\315\007\207~\266'\002\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_restorePgConfig.247.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\317\001%\021"
+	.string	"6\340rG\340\322&\035\"uwm\016\217\\\tN\344\334\330(\246`\227\266\207\210\200\326\\\007\271\224a\257\347\234Bk\333\332\025\026m\334p\023\031\306`\245\030\215 \031c\206J%\357\314|9\b\264\267/\251\224\f\262\211\224)\005_"
+	.string	"V"
+	.string	"b"
+	.string	"4\0046\320=\232v\023\367\330\235\204{4\313\326Q\"\263-\005)\214f~~\354\356\247#\316z\3344Y\376k/\305d\255\307\017\3376\223\r\021G#2\231\355\004D\r\017\236\f\226\272\235\354\020J\032\221\2756S\rO\354\265'\215\f\226)\302`w\2351\231\315\315\335\266\004\333\017\354,\020:vL{1]\372\354\357\356\363s\"\351M$\255\\:c\372"
+	.ascii	"\002\3148\310\316\203c\267&\024\262D\221\206\t\333\367\177\016"
+	.ascii	"\364\362\027\276\rN\222\367h\277\330\336\343=\333J\273\013\326"
+	.ascii	"}`\034ws\206\034\350\036\005\344\323~\213\367\260>\213\371\200"
+	.ascii	"]\235\242\031\273\001C\234z\220J\267\273\327\243\300\361\261"
+	.ascii	"\202\206\007i\303\246;\366\224\323Y\007\026!\220n\3440\t\017"
+	.ascii	"\303\225\324\323\222\03637\257\f} _x\214\225n\027\266\300\207"
+	.ascii	"\301\002\372%b\270\307\222\036\350yS;\n\3223se\230C25'\3240\034"
+	.ascii	"\247\332\032RQ+\202%\020\233\366J\335\261\257a\030\206\326\266"
+	.ascii	"\200\222R})\025I\005\007\252\f\340\252\001j\005\272\264\240 "
+	.ascii	"\200\021\\@\026\222\224*}BQ\301p\372XTRV\276\323\252\345C1\031"
+	.ascii	"T\241V\237\013\b\256>\217\346\372\266\252\323\031\361 r\351k"
+	.ascii	"\333\335\215\0042UuS{\002\205|\314\tr4h\313v\312\205L$f\247\313"
+	.ascii	"@\251\232\024\315\\\232\372\240\231# `\202!\202\324\003C\261"
+	.ascii	"\361*\360 \236\306\321f\275M+k&\f\221\261\312a\003\214@\275\240"
+	.ascii	"\23396\335\005\242\311Fv\201B\310G4\242\231\231\206\333\333\275"
+	.ascii	"\005\033\022V\024\341\332\306\241\021Z\flTl\277\255\317\206J"
+	.ascii	"ci\206zl\271X\310\342\026+\n"
+	.text
+	.section	.gnu.lto_backupConfigs.248.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\365\n"
+	.string	"\266\024MC \213*\035@(\360\231\t\240\0352\334\002\020\255:\372N[\261TU\211\322\225\026)FQ\205}dF\226\34043$<M\263\240F\250\n\001\210\251"
+	.string	"a\304\214\362\235r\205\202<>Fn\226\220-S\n;"
+	.string	":"
+	.string	"9"
+	.string	"\023%\033f,(O$t\330]o\032"
+	.string	"\025<7\025\364\037\306\360\234E\365\311]\260*\250 F\023\207\301P`\303aW\324xR\255lv\327*\216\002\356\356\2667l[\330\317\004~\345\263J\005\030\377\262\260\233\272\331\366B7\341u\331\355;\360I_\374\330\037\200\227\221Dl\206\375hc"
+	.string	"\240\266Kb\274s\205\345\235\311c(\357,\227\240\274\373\305\240\315!3\274\311\360\032\007\312\332\234.\223(\237\0353\r'-\355C\370\214\344+\360\310H/\276\363G\363\260S\214\024j\254\330\200\222\336l2\324\351\242!\240%\360l\331\227\335\252\032\037 5G\323\001\341x\237\016\207\307\343\204D\236\006\343\017\344\021\362B\276/\344]\310\375lyS\232&n\272|\362\231R\355\371\276\"\020\241\301\256\311E\235(\273\242\266HD/z\006\017"
+	.ascii	"\357b\314\fM\3478\374>\323c\357\0016\331\301\004\3532\016P\205"
+	.ascii	"\326\205$.\364\313\025\343\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_restoreConfigs.249.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\005\r"
+	.string	"\266Y\\D"
+	.string	"\221(\035\023\333\232\315\257\251\202\342\373\236\314U\022,6\313\2747\216yW\240\2059\017\007\350\242\247\241F@\025\300\333XmmL\261\177"
+	.string	"\204\002]}\345\375\363@~\204\001\304\254\263\341\243\375\177\023)S\nH"
+	.string	"H"
+	.string	"G"
+	.ascii	"\234C\217\1774\207\371\017\315\2419\033\007\200\013"
+	.string	"\333\035Pa\225\254\220\331]MCp\311=\323\344\374\016\257{\3069\271f\004P`N<\036I\366\231\001\342\306]O\023O\225\271\001\355\256s\345i\270\341m'\260\215\300\276H\232\351\314\322\357\220b\260L\274\237p\331e\305fV\006\204a\342\257\333\377\374\026{\374\024W\301\375U\301ci\354\275\031\025\0171\273_\201C\207p\016\375q\356\261\235i\037\305W\270\263X0\334\375\320\342\305\356g\300\002\002\276\353 \225v\336h\252\263$G*c\367\327=D\004,F\265\345\021\315\365\301\313\206*a\366Y\334e\304/a\023*\277:\364Qz\327\003x05PV6\2442f\177]j\353e\304\013\tk\212}\226\177\363\327\035\021J\taA\t\0257\005\242-\236L\"\006\261\301)\222>\034\002\031I\bi\244\221\203\tZh3i \037\307\222h\323N1n\232\347\333k\212A)%\311\264\345\267|"
+	.string	",=\0229\207\016.dv1|\245\232\301\356d\252\035)\344W\001\021"
+	.ascii	"\357b\314\fM\3478\374>\204a;\236\260q &\004\227q\221Ul]H\340"
+	.ascii	"\202\200\223\252\332%VR\306]ni\217\006\246\366"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.252.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"U\n"
+	.string	"\246\223G;0\305*\035\336\256/\340\030K\021E\006\fM\f8\314\266\361\327\257hQ\231\t\027x\321\267O\262\212\001\251GL;\206\256\320\201A\006\250k\377\3036Q/wFQ\322\366\226R\2466"
+	.string	"5"
+	.string	"8"
+	.string	"\373\355\224\315\337we{A\311\240\331B\021\334\271Z\031 \256\266e\002\n\2071 \236d&\227JY\331\262J41w\013\265\326s(Z\354-\373\237\341\177\301\277\034\177\r\344~\375+k\273\376\363\273\363\347\371\314\374\275\b\2140qi%\265V\214"
+	.string	"\252\311\034\211\375'\375\230#(\220\376iP\340\312\246#\227\n\301\325Z\243\255\021#7+\366q\"/\374K\204x\303\256w\243ejpo\023\231\265\272_\337\212,\333\031\016\220\333\211s\377z\354L\364\205\235b\304\033\356\374\216,;\267\rn\254\022\217\001\3678\035\217G;\036\217Bt\032\036\250\007\nQ\016\301?\021\016 :\361\371\200(\246VW\326v\375\200D\316\306\\t\327\334\252\377\334\233R\233\344\354W\317\326\250\244\002\2248\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.253.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"e\n"
+	.string	"\226SH?@i\225\016\343j\216\245\\\274\304\323@)\031\365\273\305\252\313\350\\\201\342M\360@\276\222X\335,I\006\307\0353\351K\320c\3321\027E\3201\001\335M\021N\016\204\354\276\305\231\330\275\245L)5"
+	.string	"6"
+	.string	"7"
+	.string	"\357.\343j\347\237\365H\354\005s\360\201\336\245\351\261\0014}\343e$\013@\001Eq2#M8\353Z\002C\252Z\305\234\323\372\201"
+	.string	"n\310m[\330\216\260\257\001\266\313\323U\331\217sS\266\325\232\325\322jU\365#\024\001\r\300\303\030\314\371\021b\230\021$\204\225\355\217-\361\004\305\307\335\303\310\263PA\020\222\026\310\346tm; \241\356i\245@B\214\250\315\301\321\177\332\376"
+	.string	"*\264\336\035{\320B\355\252\272w \337\311\354EA\2443\373\t\336\352\370\006\354\341\321\177\227\276\007r\371\225 p\002i\030\346,\230\f\267a2\334\246\201\271\310\330\270\rg\2638X\263\201\261\331:4\232\315&q\315\307\271)_*D\271\222\002\253\255n\311\266n\005\264\241(\277r!.\2202\2004\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.254.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\217\002\225\022"
+	.string	"\206buF\360\320&\035\356\364\255\311\013\343\347I\347\367\225T\252\024"
+	.string	"\276\336\242MV\271/,\247T\371X\365jS\017\332 ef<3m\021\340\263\342.[\270\233\224[\tA\306}\263\225gU\275\331\367X\322\366\336R\246\024b"
+	.string	"Y"
+	.string	"d"
+	.ascii	"?\361\362\316\345\002vqj\034\355v\t\034\262\035\272\333l\373"
+	.ascii	"%n\342\305.\021\031\030\230\020\236\n\261\0248v;U\352 \3610?"
+	.ascii	" \036\252\207\273\036\341\323t\371\334#\203\237\241$\270\321"
+	.ascii	"\374\335\347\013:\f\305\220\315h\25621\257\230\332]\217\031\354"
+	.ascii	"\245\251dw\235\262\031\206\333t\333,\266G\354\244\021\031\253"
+	.ascii	"y9\302Q\260l\2731\n\374\237\006-\233\316\241\357\022\017\257"
+	.ascii	"\367\371{"
+	.string	"a\023\224\243\007&\227\354\216K\315\261\377VqlM\243\234\376p\372\364\356\367pz{i\323KGM\303\227~/\235\232~\n\365Agv\241\244\335\013K:\026\t\266\ba\373\305\006`;\323~OOMl\214X\274E\002\236\322C\355\024\007yY\352S\316_q\021\033#\236\346x\345.X\037jbS\304s\241\267v\220\270T\272\032\310\265\002D2v\271\033\371G\251\rD~\321\246agiC\276\n\327\266]\3567\206\264\345\251\331y\220\355\332\177c\273\226\262\0359D!\240\301r\207\t\334@\274\242\324\001(-*'\023\240W$)*+\325\203\224\223\025\325\252\305\242\"\0011\013\002JK%\201\305j\251\334\355\337*\216Q\261\f\026\322wE\016\261\231\032<\351i\202f@\350\207nJ\301\366\246\251/\037\350.y\321\244OO\2527`7\007\356\212QMj\232\001\023\361\312%C\215\372\330\216"
+	.ascii	"i\257P\3622\250W\242\275\224\203\0216 \240\002\221\271\252\016"
+	.ascii	"\37610e@\b\031t(\266\211D\310\2300\220 \256\256\207N\255\375"
+	.ascii	"l{{\235\264JF\311\333Ah_!~,qX/\030\264#\207\301\034\030\004\273"
+	.ascii	"9\022\202&\030T\f\311\367F\2117\177\205\305\305\235\305\212\212"
+	.ascii	"G\310#$\\\206\\\r\222\033\001\\\200\023v\300\366DC\212\210\205"
+	.ascii	"\026\357]Ai\260S\217!\362\206\013h\210\375\246|8\263.3d"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.255.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\025\002\245\021"
+	.string	"\226\"vG\320VM:\344\251\200\240G8\22560\320\022\263\223\223\200\353\r\223\035\203\271\013\323\005\207\2038\247\304jC\223\336\340\022\242\371,\333\016\3033\3617\013T^b\207\245\372\321\224v`\315Z\352\260Y#\204\354-eJ\001`"
+	.string	"Z"
+	.string	"f"
+	.string	"\007\036m\300{\314\023\351<\265\013t\244\307\356\327\342\002\336\243m_\306g\274\354$\352\201\003\354\204\202\241 \236\033Nv\277\225\277\257p\217\336U\334\243\252\370\353\021j\276\374\235G=:\202"
+	.ascii	"P\030\335f4\237\353\211&\203,\273{\333\263\207\026\313\354^v"
+	.ascii	"\3279\243\205\270\271\333\206\261\335b'O\266\227Vy\351T)\215"
+	.ascii	"\372w\237N\364\253x\351R\227\366`\272\343\322\\\227\2160\r\271"
+	.ascii	"\264\306t\302\364\005\234X \241\335\250\310.\210[\224\r\022\221"
+	.ascii	"Z\374\373\355\3736^d\233|\363\032FPK\212\261\273\246\033\333"
+	.ascii	"\364x\373\345\333l\262\375\345\004X!{\032\221\241\025Jv\277\022"
+	.ascii	" \344(N-)wwG]\303\241\362\347C\220m\311\020#\262\204b\337\350"
+	.ascii	"G5\276\220#\304\344g1\334#J_t\0026 LJ\320\370Ae\252\315j\345"
+	.ascii	"g'e\221\351\216\257\251*\205g\212)<\307\214\267+K\340\343\230"
+	.ascii	"P\301\023z\364u\270\307\353m\2170j>\236\020\301\362f\177\261"
+	.ascii	"\324\024\366\341*P\254\226K[\032hd6D\263\\fhX+\013325+\226\013"
+	.ascii	"\303\312e\3056\027Z\256U\006\033\033\327\312\364\301\016W\201"
+	.ascii	"\334\215\020\001S\013|\232\250JK\332c\273\244~\201i,z\312i\252"
+	.ascii	"S\257\323\273`p$Nqj?`TU\225\246\216\016/by3\324\250\037\220*"
+	.ascii	"j7\200\311\317\240\236\204\t\333\301y<\330\021$ \200\002\031"
+	.ascii	"*\253\003_\f\200\342\235-\342\372\203\375j\205M\257\215\023a"
+	.ascii	"6D\022]\263\350\233\265\002\202E\026>\273\213V\214f\211\2676"
+	.ascii	"\261+\204\215o\333\360\320\200\316\f\20368\253\027\366\030Y\235"
+	.ascii	"Ydc\303\023\022#\203\034o6\200\227\003\237\013\2328\320\316&"
+	.ascii	"\3402"
+	.text
+	.section	.gnu.lto_dumpPgValue.256.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\371\004}\037"
+	.string	"\366\371\313I\220\234Q\007\004\027\240\022\005\236c\367\227\232Cud\305\271%\220\255\241"
+	.string	"\210K\210e\277\001\007\365q;\027Ygk\030/\214\352Fm>\220$\212D\304\330O\b|'*\251\371\235\260\001O5D\207-!{\357\275SJ)\271"
+	.string	"\245"
+	.string	"\270"
+	.string	"\327\251&\305%6\202\037DHj\255\030\352\257\275L\247\027c\227\225\202.9C\326\n6\341\235t1\251\237\310 m7(\265\344\001\332\245J\262\2673zl7XdZ\340\215\265v\316\275SY\272\356m\031\360"
+	.ascii	"\264Kf\346f\322VI\274>\215%%\036\016\224\\\r\241\210\335\333"
+	.ascii	"\342\270\355\035\263K\264\001\230]~\217^\033=\315\222|_\271\317"
+	.ascii	" \r@)c,\361\327\350\031\304\303\351\251\317\033m\222\t\302\246"
+	.ascii	"\234I\211Cr\207)\b[#\n\275\034\246\304%'\2134=\005\375kD \251"
+	.ascii	"\336{\233\253\275\0061\350~\006\335{\331Y\242S\263\254\231\271"
+	.ascii	"\211\231y\314dXG\035\367g>\201\302\233\355y5\370?\356\367\177"
+	.ascii	"3\3036\234k):\364\336\240\004nc\210\035\n\244K\356\031f\227\375"
+	.ascii	"\351\216/k\240\256\260\224|\214\271\375\371S17y\177\212\271\261"
+	.ascii	"\272\325\316j\006\352\254\356\237~\322\355\323Z\315\267\336j"
+	.ascii	"\356\351\266\233g\346\254\203:\347\260\263m\346\214\203:\327"
+	.ascii	"\330\371\206\346L\2439\247\247\363,u\226\315\234Q\324\371\234"
+	.ascii	"9\2332\347\022u&M\347?\235\335t\356\002\2750&\033\304\346Bs/"
+	.ascii	"\323\330\232{,\251\bi\255\356\255v\346$\356(\315\305)3o\371\310"
+	.ascii	"\373\324\006%\f\254JV&\336,O\210Z\372\0373\257W\255emr\363\215"
+	.ascii	"$\007\2314\025\202\260P\346Sa\351\333\373\222n\357\275\345S]"
+	.ascii	"i\332\037\025\303\250\264O\213F4O\3060o\357H\212a\202\256\246"
+	.ascii	"\375\336\373\373\003f\372)\212`\202\256\206m}\300\364\371\364"
+	.ascii	"S\240\221\314\360)\200\377\374\354}\236\331\002\006o\026\350"
+	.ascii	"ID\311~\366=ls{\331\267\224\361k\210\343\307\315G\177\003\007"
+	.ascii	"o\366\366\252\360\177\\\376\371\350?\033a\025\260C[9\277\202"
+	.ascii	"\217\362\3117\277\205U@\037\343\377\362\237\315\207\256\002\202"
+	.ascii	"\212\007\021\276\217\300\305\013l\307y\236\271\204\to\366\377"
+	.ascii	"\301\312\030\t3V)\250=\002*\322\256' ]a\344HD\276\234\212\335"
+	.ascii	"\205\036Q\316\367bws\204$b\205\213!\241\334\216\305\254E/\327"
+	.ascii	"\301\210\347\023Bw>\242\034\214r\307\313y\020\342\351N\3265\030"
+	.ascii	"\"\322\341\\\f\345x8\335Q\017\327`\207\213\214vG8\244\242\242"
+	.ascii	"#\\\332\336&\357O\001}\037\313l9*=\020\355\322\311y\235o\243"
+	.ascii	"\230\234O\247"
+	.string	"|\r\261=7\230U\352\334\341eE\205\nu\020\274l\337M9\314\244\371s\2013\257>\326\037\247\216&\2610\340\377\030\201+h\234\347y\365\231W!+\021uX{\234\3571\302*`\227\332\343\020\371\212\202\272\302*\3407\317}\\\217\310\210^G(\253{\205\315\256IPaY\250q4\204\214R\n\231\231\221hFk\031\016\300\002\021\"[\007\021p\255s\312LR\032\003\203)\375>E~\315\030E\033\321\031\205f\372\017\365\256(\225Z\340M\222\034\351\213O\220S\316\3306\003\323%`)\314L\232\261\343Fqf\311Qb%B\025\375\352\013\013\027\333\032\3164\362D?\252\222|};Dp\267d]\260d\272\360N~\033\223\310P#\320Q\236\276\320\303>h\276\213,E{O\034g\315\2113\013y3\231n\026\022\264:\332\276\326\023d\332\303L\357\027F\306\242t\f\312&\317\233\310\341\031 "
+	.ascii	"\225-\257\225Z\251_tNW\227m\253\367LY\272cS\350\037"
+	.text
+	.section	.gnu.lto_dumpAllValues.257.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\356\003U\035"
+	.string	"v\267\302K\240\326Q:\005|p\f\365\026\274\254\251|\273\253\223\324\233Wq\343\2757\241:\372vT\320\036\342\267,\221\356\333M\317~\255LN\302Z\365\020\337\031\323\300y\002_\256\347\006\362\300\377\340\006\021\326U\262z\321'\204\220-w\222\001\255"
+	.string	"\246"
+	.string	"\257"
+	.ascii	"\304\377\360\035\310\b&\357\235\321\345\300yrV_\231\357t\037"
+	.ascii	"\276?\221\370\314\275J\305\"\367\022\021\360\200\363$\023OS\236"
+	.ascii	"<O+O\262\2179KM\350\376\026\f\275\320 \306{\257\255m\360Y}\207"
+	.ascii	"\235fI\332\256>>\325m\222\022-\302\364w\2305\205N\340\370"
+	.string	"\026\n\027\026\307\213\013\353VA\365\254Qdt\263\305K[ F\226\n\232'IWb\351P%\001\244\250\275\271\367\306R\241j\255\002!\343\021\2004he^h\224\027_\211\322\241\332\267\272\205\341\327\026\032EF\257\246\203{/WaZt\20693\357`f\013\314\235\0251m\340\262f\326}\250\027\3124\r*\203\330\205k\250\177\314\304_\355%\346\3430ye\341Vb\266\251\371\323\037\340@~\332\257\3163f\345\231\314\247\376\230K\375\262W\235O\363S\347\022V\231<+\333\256\334]\271\232\225_\023 \005\005%j\350\245\247\020\357\211\343\227\253Eb\345\370\325_\305|\"\374\342\025ov\267\356\323+\303#\027\205\363C\370V\034;\311\314U\275\233 \361\2460P\212\\N\306{\211\006Nr\316y\3621\346)\022\265\331\rB-y`\243\036\304w)\021vv\203I7\032\234'ol\007\262\236\351"
+	.string	"\315\\A\247^X\323]\244k\205\026\332?\376\013\240\211\246\262\227\262>\353\230\247z\036YUz\220\037Q\322\272w\274Z\031ba\261\275\324;\250*\301\352\305\264\356\266R\320\257YW\032\022\364\253v\001\345{\326\\Q\243\240zd\346\013o\222\001\003R\224\361\336 \003&\034\356tt4*\371\022^y\362\215\001)\252\313\023\2552k\330P/\344Ou\245ZA\375c>\022\036\001*\367\006/df\237\037\341`c\2727\210\203u#7\373\246\223\214\313\225\027\346\312\2233\375\342m\327\321\021j\312\020\026\300zl!I\204\322fY\r\271\036\317-\004\251\373\016H\247\203\217n\347\226\363"
+	.ascii	"\363\201w\313\001\321\323\3339}~t@\270\234N\256\307s\013!\313"
+	.ascii	"\365\334&\354\364\340L\306%\320\361\340l>\272[\217\r\267\343"
+	.ascii	"\331\022\320\360\017\210\334\316\006\364\363\263\263\305\210"
+	.ascii	"\367\255D\365\227\350\202\241\005\354 .X/q\f\023\323\006\326"
+	.ascii	"4\374B\213\225\211\330\232e\237\3520\246\341\027\264Xe\332l\242"
+	.ascii	"&\033\202\023\333d\037\375\002\376\311\267\"\3307\261\204\234"
+	.ascii	"\034k<:\016\215\200\365x{\357\275\247\265\346\221P\0358\312\232"
+	.ascii	"fK\232]6\021\363\337+\317\266\351[]CR\221\313P\214\240z\254)"
+	.ascii	"\314Z5;G\250Q\030\304\210R\210\031cf\202\241\240\302\220\033"
+	.ascii	"\200\002\2312\263\r\020xX\232\264\031\037\"\316_\026\376G\206"
+	.ascii	"\"C\373M\260\t\311q:\001\024\262\304f\177\3502|s\200x\370`\023"
+	.ascii	"5I\007C\0078\332p\273\b/\020\362\265\313\355\022\301\226\224"
+	.ascii	"\311\205\n\253\330\257%5H\251\230\026\337\b\311\034\267\301\234"
+	.ascii	"\235\263\367\247m\315v\006\032\274\322\002i\252\265\254\305Q"
+	.ascii	"\036~\214\230;\224\265\024\360\344\n\326\221\023\373\332\316"
+	.ascii	"\334\235\245\371\017\016G\203\257(\200\250\016k\004j\265\333"
+	.ascii	"!S^~"
+	.text
+	.section	.gnu.lto_cliPrintVar.258.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"5\013"
+	.string	"FVO? O\234\016\243D\361\262#\r\316\3173\200*\361\305{1>%D\200\025\210\355\325.@\n\367\t{\024\377\265N'=\306\244\202\020\262\216\232\345K\313\036pA\004D\035p\033\032\351M\344N);"
+	.string	"@"
+	.string	"9"
+	.string	"\033\242H\261;\025\370"
+	.string	"\344\322\363\024\353\022\362\001\326\245;\373EE\303z\rJ#\021\312cw1\005\361\356\261\363\217z\344\003\275\307\353\301\356:~`\207[o\333\200m\007\366!\004;\372\220\261)\251\"\304O\277\375\243,\261}2\214\311\266\330\203a\211\024cw\"\270\364\305\256\242\315\340\322}\303\302'\001\322\t\323\212\005q^\250L6TbC\202G\373\246\223\350\256\201\341\0026\266\364z\017\034,D3@\361\303WT\265;\237\370Oj\364\350\020\221\n\251gO/\352\007\373\325\356\2565\264\257\361_\337\370\255\237n\371\371k\025\375H"
+	.string	"\027\034\300s\230\330\234\207\243\233\315gB\305a*hF\303D\220\240e\2273\213f\223a\0244\030\r\313\270\016f\241x\343d8\314\263m\034&\231\373j54\244cD\n\244\031\f ^\245\252^jk[\374\347\002\"\365\002\017"
+	.ascii	"\357b\314\304s\242pF\347\205\b\\s,vw0\020\013\"\200\023`/(\f"
+	.ascii	"\206\005\250\320\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.259.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\257\013\3259"
+	.string	"\032b\254\025BP\346Q\007\033\f;\210I\177\336%z\250a\373f/\324\361\026\322\3424\033[\217\366\310\265\037k:\246e\005\242O\347\341\254"
+	.ascii	"`\344D\023\235\343\236?\\\223\211\266\366\304\346\023f\271\333"
+	.ascii	"\336;\311\224\002E\0017\001L\001\270[\0267\333\342^Y\334\277"
+	.ascii	"\342\306\217\333%\030h\323\322\323\206\026\366~\244\331kOQ\246"
+	.ascii	"c\333`q2\356lc\332\247m\356\366:\231\"qK\232\233A=rw\024\\g\211"
+	.ascii	"\2533\265.m\027\323Ag{\202\205\327\331\202\020\221\322\354\345"
+	.ascii	"#\223\253\213\336\345,}\340l\027]g=\330\335\216\273=\352i\257"
+	.ascii	"\253\tqa\316P\250p9K!\364\002\327\331\226zS\353\254\353L\255"
+	.ascii	"\263\375vW\235\222\031Y\001\355\271t\273\3139K\275\224>\302\257"
+	.ascii	"/\t\225\222\220\216\214\202\300\237\353k\331\365\361\333\256"
+	.ascii	"\200:\345j\"}I\357L\230\247TMb\311\346\340\242xH\253/\351u\305"
+	.ascii	"\3630\237k\206\274\2726>u\004Z\230K\360Q\224/\247\033\215}9\361"
+	.ascii	" \202\261/0\007\256\016\352\330 r-L\260\265\311\353\n\227\347"
+	.ascii	"a6\301\277\225\211I\232>\236\207\351d\215\352\263\245\211ka2"
+	.ascii	"\301\356\324G\220\311\3359\335\267\326n@;c}\315I\220\321\251"
+	.ascii	"\213\342\215}M\361u+\3316M\211\243\002l*\377\241faK`S\253\005"
+	.ascii	"\306M\211\3631\346\224\026\373>\344\234\033s5\277\274\231\274"
+	.ascii	"\333\251\272[\332\r\004\022^\006\321\035:\266\207\030\277K=\320"
+	.ascii	"\212'j\316J\347b\341*-@\265p\201\235\2537\210%\037\331\335/\374"
+	.ascii	"\017\f\017\324\216\341\324)g1P\361\273\236\023\016\030\265\254"
+	.ascii	"=N\\\312\243W\266\362i\357\263R\321\323\325'\271%\330\237Z<\355"
+	.ascii	"pX\356t#\370\220\367\240E\353\262X\361}\315?$\261^\373\212\276"
+	.ascii	"\306}]\230wuH\274(\0034\257\372_V\247]\316\363 9\355s\350\022"
+	.ascii	"\305\265\303\221&\177NN\364K\233v7D4Y\262\330[;\\W\335\234\221"
+	.ascii	"\376l\177\022\313hfYr\316\r\324tw\325\375\351B33Ks\003g\241\336"
+	.ascii	"\327\374\201\330\022\353\265\323\371S\353\017\365\215\227K\264"
+	.ascii	"z\206\2371\2729o]h7\363\206\261\341Vq\266]H\353\254?\213\024"
+	.ascii	"$\366LS\313\302{\335R$\37626\207\360\204\365C\351\216z\334\305"
+	.ascii	"\307\r\345j\356\t\234\214w\001\002\316\346=\240\305-\340q;\265"
+	.ascii	"\270\207\217;@\213\273\351q\003Xq3=\356\245 na\020\267\322\017"
+	.ascii	"w\022\0207\022\020\367\321\017\267\221\213;\330\342\006\372p"
+	.ascii	"\377Z\334\256\017\267\257\r]\335\356\305\266\300G\275\001=r{"
+	.ascii	"\312\247\026\336\303M#\341{\031\334\344=\362D\005\322L>R\370"
+	.ascii	"@2;~\376\004\313\340$\357\221\003H\\e\017L\265\353\322\177\236"
+	.ascii	"\270\035\002~Y{\220\226\300\263lU?XM\021\"\352\357\313\372U\322"
+	.ascii	"*\275\217\215\001\264\205\363\272qS\306\253\304m\177\301Zg\225"
+	.ascii	"\336\273\232 \275\321'\275+\271\270\336u\332\243GzWj)\360G\277"
+	.ascii	"\332a\202\215\274`\276h\337\300E^g\022\233j\226g4\347\255\f\316"
+	.ascii	"6\356\302D\336\260\265\337'/Y\353\\oY\353\254"
+	.string	"\321\373\324\241\316\252t?\215\223d\272Q\330\307\340!\257Y\023\364\245\342*i@\275V^,^\306\016\214n\353\221gX\371n\3617\320.8\371z\3614T\274\325\026|\027\343#\340\234}\300\260\361\242\235\022:\237\373\300w)\316\372=\020\214\357\275i>\325\003\261\350\367>\365\275\373\242y\2427\315\357\274k\236\007\302\345\360\336\370\276\325s\316\315\341\265\353\267v!D\270\312\023D\345#\233\375\226\204\0332\341o\205Tx\033!\016P\366\375\355\317\377\372.h\251\227U\302\353L\370 \024>H\205\357\201V]\016\372\357Ss\312\341\005\235B\0051j\304\b\025N6\254\250\216W+\206\032n\\\331\2602V\021\177L\035\217 \204\275\203\30171\352\233\250a\207\221G\325T\017a\323\240\301`\330<\030\020!\020%\0205\030mXM\035\2114\214>rTU\201\b@\345?\216WV\"\256v\034\251j"
+	.string	"\217S=\276gD\240\252\232!eE5\205Cj\306q\207T\204\246\316\241\303x\224\272\312\221\343(\025\354\354\017\245\335\274&]\326k\265\247q\307\213\226,\271\024{\301\262\033R\261\360\\\245C\361<\216\027\355\354\204\303\027\300%\304\320\231N/ \021>3\272[\226\027\331\001\313\005\247w\267?j\001~\210\265\b[1\372\036*\326\036\256\362\"\335\016\224J\\\200\367}9\025\321\361\242\335\035\245&\263\327lH\305\002\360M\357j\264p\024c\207$.{\227\0300\024)"
+	.string	"\357wND`\324\374\215\373\232;\324.N\322\006\334\375v\275E\304\270\023\231\246e\274:\255G\326!}Y'\2051\212\372E\321\336\226o\276\356\352\325h\300\273\030w\r\241\255Y\276\371\274\253\3003=\036\0333\267\364L\357^8\314\030d\253F\237\316\245\367/N?x\276\346\234\363\321\227\265O\335\237K\264\271 >\342\275\272\004~\300\007\200\332\250Q4\245\030r\306\320\210\004\221$I\322\030\220\002\221\031*\253\003\021\320,\007\235*\222\321$\205e3p9 \201\265\233\037\310Io\203\215\332\377\031/\352\313l\2549FsvG\030EJ\003\247U\211\204\005\362\004\205\336\351\334^\271\312\035%\035\013C\377f\230\322\035\265\366rm\377\274\205\305\346}\356e\236\333\311\325\227\365\307c"
+	.string	"\017n\267\375@\311\r\t\260R\216\322\305\341\203\322\024C\341+\344\251\253*8p8\374\020Ft\002C.\2359?\273\244!\003\023\343#DA\341F\245\016K\213\237\255c9x\315t\217.LFk\233\254\370\227q\333N\003\"\225\270W(A`\231~\360\260\353K|]t"
+	.string	"\005\350\254\217\231\355\204\335\275\fF\223Ns\215\227\004G\032s\243\261;\fW:\263\333\357\246\221\324\274\224C\262Fx\354`\234\304\370dNAt\225\034\026J\rN\242\003\224\362M\306W\025e\347\214\200\201\\<:,\026\340M\026\304(\242S\030\265\025\351S\201\266\232\230\301\324\004\203\261\273m\016\333\006p\305\332e\361\225\210'J7B1\264\303\3366\f\246aWPo\262\212\2120\347\007/\006m"
+	.ascii	"\366\222\250\204\b\033\316\003\352\024d\360\361\262\346\230\022"
+	.ascii	"n\244\271JH\004\223\213\372\250\n<\257\367h\034y\3643\255\371"
+	.ascii	"\370\344M\217z64\352u%'\033P\037'5\216\342~\362c\374,S?\300-"
+	.ascii	";L\207mJ\271\032\201e\023K\024z\177(+\2316\363\177>\032\324o"
+	.ascii	"\362U\2008\203`\273p\322\263\211\234x\177\364M>\037\365\363\030"
+	.ascii	"\242/\236\203=s\257\t\351\250\330\262\022\371\234UC\007L{\177"
+	.text
+	.section	.gnu.lto_cliSetVar.260.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\206\nE0"
+	.string	"JQ\304\021D`\236N\007\314<\346\320\202\223\360w>\020-h\365-\006\212\371\302\032\305\310c\322\235\255J\321\241\013\023,\216\265\364B\215\237\340\225\f\375\023\361\362\370&\273w\330\202KGD\245\006D\"d\357-wJ)\005\021\001\354"
+	.ascii	"\n\001K\2163\274p\267\275\346\2246\346P\320\342\002\275\313\n"
+	.ascii	"\312\033f\017\326\\\364\005\273]\303N\211c\316\275i\f\332\362"
+	.ascii	"\022\263\247\365\025cc\201\301\276{\307\366\300\334\273\246\304"
+	.ascii	"\t\326\266Gh;sWi\245\261\321d4\361\336\"m`\356MS\342\003k[N\353"
+	.ascii	"b\332vm\240\264-\033\231\351\210f\\,'%\3271\213\335\275\227\351"
+	.ascii	"\215\264\261\205\212A@?\304\2410\350\323\003\374\371V5\265\350"
+	.ascii	"\273\221\333\200\234'\327\027V\013\351\025\355\202\346\200(\304"
+	.ascii	"\375\250!.Q\222\004I\217y\035I\177L$\314t\350E\030\024\322>\310"
+	.ascii	" \336\203*\2538\001\252R?U\n\354G\373\340\274\304\320\243'^>"
+	.ascii	"|U\245\326;J$t\306\300\230\264\332\243SU\252G\333\340\027\r\364"
+	.ascii	"\350\336;\303Q =\346\025\366\373\332J\207\005\306\274\230\240"
+	.ascii	"\217.@\252\331\321p^eh\221Mr\256\267\264w}i\271\253R\367^v\256"
+	.ascii	"/\260\346\241fn#\314,\305\354\323\021\356d5\252\231p!\233\017"
+	.ascii	"\365pjo\266\034\217\273\331Ei?\324\263\037\303\264\374\311\314"
+	.ascii	"S\335\205j\275w\353\211\233\213QJ\325\252\244-\267\214\264m\177"
+	.ascii	"\024\222\313\024\264,\177r\217\033x\346\021$\274\271\020\274"
+	.ascii	"/\361|4\267\036\2139\r\313\237\214\271\321\373E\230\255\363\004"
+	.ascii	"\353,\001u\216B\235#\240\316PO\020\234\0344hZR\352\265\346\244"
+	.ascii	"\306\322\215\324\313f\004\215\326m\340\210@ki6\3629\027\251\316"
+	.ascii	"\003Vg\001\250s\200\324\031@\352L\224:\017Yg!\353\\D\235\203"
+	.ascii	"Tg\240\324\371'u&\252\316\303\324Y\250:\007\255\263\217u\356"
+	.ascii	"A\235\201\250\363/u\366\245\316+\352\254\246\316)\352l\2553j"
+	.ascii	"\235\037uv\324\271)\b\255\314}u\334\333\2759\236z\267i\3054\351"
+	.ascii	"\265n-\335\313~\346\356,\315\326[\030\310\314\001/T\203\363\006"
+	.ascii	"\374y\3427h\372\237O\263\034\305\206O\034\2760\t\347\313\257"
+	.ascii	"\351\205\357 \370B9\343\331\006\016i\333\240\357\311\352\250"
+	.ascii	"H\370\246\177\372\274\204\236Oj\037\340\367\270i\003,s\207V\246"
+	.ascii	"{\211\327\266>\031\253c\360\244\020\276\210m\314\032\373\364"
+	.ascii	"F\337\305\374\373`\034W\035\243\377\2750)\367E\365\375\372\020"
+	.ascii	"\376\335\234\336\367v\357\250\376\252>S\247O\377\351\337\355"
+	.ascii	"\270\303~\332p\3063\017+\367\207\264\255}a\362\215\234.\261,"
+	.ascii	"\177\026\331$"
+	.string	"\347l\303H\221\336b\335\261\243&7\341\235\276\267\364\017\363\350|63S\364'\374'5\372\276GC\317\377\277\217\316,\020\275\206\n)\216C\264\233\210\266Fq\376-\206\354r\327c\372\305Y\023\313\367\030`a;\203>\0317\032\3564(\232\031\3563\256\304\354\016!\303\315d\272\365^\254F\262\0253\273\367*h1\214\354\036r\225mf7\355*h\033E\\\342Ai\316\bW*P|\325\212\022S\035H\\Y\265\360\221H1e\002\255ZQb\212\205\275\232b\361L\2654\242\004\025\323\211\021S&\230\250\256R0-\025\331\nE\325\025\223\n+\253+&`\332\355/\302k\336\263\231\365Z\334a\272\377\371|\346\021B\332\273\003\362\254+\026=;\r\343\231\205\013i\333\242\027&\351\236znA\003~\300\013\325\350\336\360\230@\002\236]\313x\206!\030\227!m+\340\205Zq\236y\272\227y\312\237"
+	.string	"H\037\340\205\3118oGg]\3038\203*\303\243#^\3564x{\334\316\247\313\343>#g\307}\327k\360\240\211\220\007\245yt'7\230\356\217\340a\352\330\020\031\266E\t*}\021[\033\322g\351\217\216>\030\027\003\331\346.L\b\340\211^)\351\001\020\275\005\223~\350\227\350\030\317\\hH\333\016\27509\367\305\007OR\350\223\336\231Gg\361\223Z\350\275.\350\213r\250\220\312\350\312\202\276\303\220om{=fx\374\032|\021\033\323\351s\360\004\276\213\031\350\t<P\200\340\250qD\345\230RR2\222\024$\205Jc\360\002\021\231Z7\021\360<\250\234\"\321&\205Bc/\240\001\365\360\213\325Ip\316\271jBr\321A\354_-"
+	.string	""
+	.string	"h\030)\006\343j\326r\220\2017\265Kq\360\306V\261(\017\024B\373g\f\370b\210^\215\364\034\026\0352\206/\244\324\216\303\277&\2528\274\246\270><\2020y\234\0372\211\3557\t48\233\273\276\251&\340\003H8\020\b\325\020\351\357\177#M\277\n\276\210.\202\004\204\242\310R\350\321\230"
+	.string	"(\013;\317\315\274\037>\200\210}\343\035\013\002\"v\351\267\n9\r$X\004B\221\326\257\354[\243_\004Wi\232\302n\215\332\245\340<Bk\351s\226\247\341\215\024\004\3136n@1\245\013Vw\221v\200\252\213\254xqJ\020.\374\332b\341c"
+	.string	"\3211\370y\322^\344+\361lR\321\3159\341\334\211=\r\346\331\303\356\221I#\213;\366\344\230f\034\377\351\2215ZM\216\364}\210W?|\177\320"
+	.string	"Q\316\031A&\300\021}\026\211\232\270\215\351\233=\260\265\005\311j\273\375\005\270\363N\356T\035x\247\225\252\320S\030\264 \227AZ1\343\247\344t\"\026\242\241\225+\326\271\271\214\t,l\217\264\303\037\220\202\247\305x\003w\365)&I\317\022\243.j+\264\314\330wY\213\016\307A\306\215R\375\007\300\030\003\342\316\004j\001fo'\337\364\006\253K\365\346R"
+	.ascii	"\022\300g\226\2275gV\257\006"
+	.text
+	.section	.gnu.lto_cliPrompt.261.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \353\225\006"
+	.string	"\322\213-4PO\222\016&F\243\243\203\2504!\224{PK&\217\332X\324W\013\254\021k{\b\211\022\217f\323:33\2154\357\354\023\360\263J\361k=\266\232\335D\246\033|\004\006\246)P\310\201z\020!\206\207GY\022\017\344\271\212h\260\336DUY\257C\312\342hN\251e\303\300\214'W\223\236PxF2E\315*8\242\003\204Noq\341\232]\225\022\313\246\201\330\2230\207!\337M\342\350\221\300\345E\353LLfG\rMn\323\n\311\337\316\327\303\024l$\246\200\002\302\221\"\223\231\017Ez\325]\267%\r\3104\254\016`!3w\231\346\321\261\377\347O\370?\002\t"
+	.ascii	"\357b\310\204&\340q\202\013\3335\321-\004\3742\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_cliShowParseError.262.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\225\b"
+	.string	"6\320=90q\323\001\202\343\027X:\351tU\201\352\255\334\037\202a\314\240\b>6\334k#\263A\247\221A^\333\274\224\210\307g\223zX\024\357\213\276\373\003?\342\013NO\215\354\235R*"
+	.string	"-"
+	.string	","
+	.string	"\317\f\3324\003\252\r\025Z)\".7\273[\351\311\301O\320\177\353"
+	.string	"\342\030~z\030v\327S\034Knz\333\005\266\027l\267\004\254\177b\240\232\221\36191\273$;:\353\312`P>\266?\355\253|\005<\353\343\001\273\244\314\313n\231`\321\366\314\345C\332\263\355\002Z8.\020\032bm\276<\313\206hfwu\221c[!\030<\233\324\356\360\230\027}\360\262q\251hh\227\341\244&\366\261\335]S\322~np\210(\221\036\b L%\212\t\222\004\b\325\235L\025\035\34717JYp\365\"u\352*\367e\324Q\310\036\006\352\253\032\236\367\325O\271\307\226\222\336^\001\t"
+	.ascii	"\357b\310\304;\276h\203\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowInvalidArgumentCountError.263.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\365\b"
+	.string	"\326\320@= \3458\035"
+	.string	"\274\"\304\023\210\fX\204e&bW\350\354\376\200$56\220e3\b{1\211\200\b\222\001&\025\345\350s\350\001\017N\210\200\355P\017\226\032\326\237\201ad\324\310\336)\005,"
+	.string	"."
+	.string	"/"
+	.string	"'\320\236\031\264e\fF6dh\261H\\4\273[i\312\301O\320\177\353\001\342\030~n\032v\327S\034Mnz\333\007\266E\266]\001\246+\373\254\177b\0023*\343\001\224\273%e\200}e0+\034\333\237\366Y\336\002\236\005\362\201\335U\315\313.\271\340\317\366\314\344;\332\263-\330\322\225\267\362\344\025BE\254\315IO\336\205\343\023\263\253\272\330\261\251\024\020\236Mj{|\314\213N(\307\227\212\2066\031N\212b\037\333\335\r&q\245\t\221\207\304=H\224 (B\036\207QD\250\202\033\025\234<\023g\341u\033w \324EW1P&\257v)\215\n\352\370\3138\245\352\306\367\245*\207\334\007\t"
+	.ascii	"\357b\310\304K\276h\205\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.264.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`;\001%\016"
+	.string	"\246Y_F"
+	.string	"\223\223\016\323V%\365\316\270!\250n#\031\005|/\351!J\006!\331xan@J\"j\270(\023\370\254\3225\323\312#\217\336\366\357\347\036Pt7\026\032C\214\342\004\023\236>\341\023\201\373\237 \262\267\334)\005I"
+	.string	"L"
+	.string	"F"
+	.string	"\331I\260Ow\266\016\023\016\353\035pq\323\001F\217\335\335\324\304\273O\251\261\363o\363\220\017\364>3\230K\021\020\346*IX\256\027"
+	.ascii	"p%Q^2"
+	.string	"\"n\363\350\001l\211\021D\301\356:~ \210\033\273\355\007\266!\330\377\020\377C\002\360p\201\327\261\261\373\262\243\2639s\006\n\333\367\3305'\020\350\213\267\272\323\230\206\034\331\025\211\0218\273\233b\003\331\247&c\310b2\262\253\326\207\362h\237\305[t\237\321p\001\27319pv\303\024\017\310>\035\276\004\373\f2\213S\245^\037\3437\025\b\334\330u\371\247\312\\\022\024\370T\265/`\210\377|\362\262\243\306\206P/\276dX2\324,\330U\275\037+Z8V\321\207\035zQK\330\227\273\273\326\030\3735\377<\315/?\363\353\303&}\264\006\241\005\032\351\243\205@\240\b+ \006\332\212\203\220\246\372\234d\020qz2qZ\342D'Y\342D!\0227\002\361H\3054a\264\235L\"n\033\245T\233J\211Q\024J\251\315\002\n\225\332<\341~GE\316\006m\231\236(\201\213\377,\317r\275R\004\035"
+	.string	"\357b\310\f\rFH&@\326P"
+	.ascii	"\263W\250\306[-\003\256\024\bR\300A\242&R\301.u\r\3501c\2009"
+	.ascii	"\220YP# n \006\\Q\302\270\2400\030\026\240B\217\273\274\263\311"
+	.ascii	"\2460\327h\025\024"
+	.text
+	.section	.gnu.lto_nextArg.265.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`Y\001\305\016"
+	.string	"F\233bD"
+	.string	"\221(\0355\036~,Y\250a[\201\r\266\366LPu\251\021\347\260\n\353\270l\273x!\264\277\360\240\360\255\241o\234[\304\210. \234TUU\211F\005\351\214\240\026\371;'\351\357\001\374\t\331[\312\224\002K"
+	.string	"N"
+	.string	"O"
+	.ascii	"\017\301\0369\037\200=j\b.\241w\303\344\216E\250\311\371\031"
+	.ascii	"\351U\303\324\211\216u:RF\2500\253\031\220.\0052hI!\342\252\347"
+	.ascii	"\251+%<\261r\275\352\017Z\256\317\324\255<\263\006\273\3534"
+	.string	"u\035\356\354\266G\266\025\330\367\020?\274wg\246\317\001p\243\241\273K\307.\207\257\307\262\"\f\023\367~\033\305W\271c\333\343\002l\315\276C\275\320\330\261\353\031x\264\226w\341.`\027E\363b\327;\340\002\234\307\253\370\n\024s\232\2414bA\3602CE\306f\327\323\354\005 *\256\r\212)\201\325M\216\214\232z2\207\245F\321\353\213\271\201!y\300\335]\230\340\251\230f\244\327*\005\005)?m\001\002E\243\216)r\307\300\240\332\025,\344MQ\323\346ka\225Td{\242\324\224\375\00552FXQv\206\305\273\004[\350D#l\016B&$\333F\301\363a\317H\211\004\217fR\002a\202\346\331@\332H\210?'$\233\026\372|6\255\343\355\025\245\206\360,\236ez\3267\303\032)\211\004\246)\213\034\204]\317\022c\3432\027@\234\022\327\217\226\353;}\030\345\367\026\016\030\027QS\016\036"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\3133!\032\355\306\227"
+	.ascii	"\212\033\355\246} \205PW\233j8S+o\221\nBP\342\276\025\017o\302"
+	.ascii	"q\024a\241\362\3753C\235\262\204#V*C\021Zy\315\203\201\242l\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.266.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\001\004\225\034"
+	.string	"\206t\271J\240\230Q:\021\270\223\023\017,\200\343z\316\231J\216\004\307\037\2141\314\210lI\210\024\227\n\330\343P#k\377\377\243\260\265\213\314Q\2126Na\210\321\340\251y\326x\n^\330\031\343\227J\247\354\375G\027\326\032!do\271\223\f\245"
+	.string	"\232"
+	.string	"\246"
+	.string	"\364I\274\307\3565:\016\271\267\350\200\023\230\267\347\361\036=\314k\037`\257\350\201\222\225\023L\307{\2135.\236F\336\232\237\221\267\r\203\351k\361\334\242\274\273ZfI\332\332\224\3077\236\002\020\205\223ph\342\256J\223q\303\306\233\250\030\252\013\252\246\204\034\352\364g\350\243\255\027D\241\233E\304\240\227,N\272\206,n\253\002\254+\""
+	.string	"\206\301:"
+	.ascii	"\bD\3435\004\322ZgBRO.u\004MT\004\325\006Op\f\275\206?\332\207"
+	.ascii	":\006\245#\226\"\242\320i\031\341\336\313T8$\236_g\346%f\316"
+	.ascii	"a\356\250}\304\\\364\321\313(\262\302\207\333\210\231\346K\277"
+	.ascii	"\200\027\377\231\354Q\347\030\214\244<\363\244_&\346Og\363I\347"
+	.ascii	"\262\244L\226\224mI\271\226\224\233\244LI\312'\020\340\005\322"
+	.ascii	"\360Y\347\275@g\230ke\211\324x\324\377t\312|>\323\251D|\2125"
+	.ascii	"\270\310\322q\357}\005\341KEq\225\221\022\230\253{\257\005\363"
+	.ascii	"@\370P\334t\247\236?\361\374\022\357Q )\035\257\356-2\270e\t"
+	.ascii	"\346\355\201\372\031)\202\371u{\346\036\346\0273\367\022\t\037"
+	.ascii	"5\264X\202\006v\177\306\026\n\002\265\2319<I\355\031\320GHP\227"
+	.ascii	"\033W\310>j\346\016Gb3\357\275\020\370G2\330\030\210\201t\313"
+	.ascii	"/A\336^\230E\326\3353\343y\236\310\352\321\223\215\364\244\250"
+	.ascii	",\017i\266\375q\2021J!\360\2265\235\n\356\030\021f\246o\223\\"
+	.ascii	"d\371\2404\021\225?\3323\3154\330\005\226\343\\E\306\232\366"
+	.ascii	"\251^w\314\210\202\003J\323\026\037=Y\206\302\232\031G\207^\030"
+	.ascii	"\353K]v<\275\334\312\361\364Q\373\210y$\254\373\307I\3058\345"
+	.ascii	"G\261\330E\313f\276\345\350\205\260>\324c"
+	.string	"\307S\213\325\257M\320*\244*_:\234S\003\"gg\273\325p\271\333-W`\307\026\242G\334x\300U\300\321\331\314\035\216'7a\207\273\271\361\340\350$x\320\331\261\205\220\335\340\340l:\253\333}h\266\251\321\331\261\251\341tl\267\232\215\016D\255\206\306\271\0177\272\332.\227\323\325^\305\336k\253\354\230\230\276\3611&E6\254z\355s\365\021\313`\2314Ms:S\320\033\271\331?\207\372\201\234N\"\023\326\\\251L\227\375C\247\274\336{o\253\217h689\235\202\024\313$\233\026\343\302,\277\215\264Mv\345\022$\342+\271`3\371$\310[\333.&\237%?C=z\226\001M\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.267.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"]\013"
+	.string	"\306UO@ o\224\016\303\002Y"
+	.string	"\267W\006\200\304$F\201\b\306\003I\356\357 F\216l\003(\013\324\340X~\323\277\032\254E\365R\033}\002@\020\002\001(\203c\255(\300\350\376\327\246\251\022\264\367\2262\245<"
+	.string	">"
+	.string	"="
+	.string	"\207O\223\344_\344\360\304\006\022\331\n\021Z\351\320\272\360G\3216\036fw'\332)\365e\272\024\bE\313^\005E\322]\344\331\241\23525\024\354\256\263\202\366q\307\333f`\233\200\375K\353\261\222\261(\240\211\016\266G\366\304v\246}\017\3770\272Jt"
+	.string	"\273[\210\022\273\234\001\017\260\016\315\335\022\017\255W\342\241m#H02)\300F\311\305\201\022\f\034 `\354r\227j8)\272\205\342\3652\362\"\305G&\204,\016W\001\231\212\021 \246\\ev)T\211Z\024U\027\2608e\f\233+\245\206\330\177\273\273\326\315\360\252__:5\375\370\f*\017\013\037\247\320b\003\017:\034\f\364\211\336h8\0206W\207\323 \302\265\301>\227\306b\217\004\007\330\005\362x\260k\302\355usj\201\347\313<\265\3036T\214I3\247B=\307\fS\256\"\324\020\377I\322\245P/\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321J\023\tD\001\215"
+	.ascii	"\353\t\341s\031\345\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.268.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\242\007\335)"
+	.string	"zKh\020B`\246\316p\223?%4z&\364\262\333\004RH*0^m\253\007\276~\017\324bu\030\320\326\240\t\207?\304)Z\311p\345z\017\211\241\354\340\037\353\030\271\376\363C\317\f\177\353%B\366\336{K\231d\364"
+	.string	"\331"
+	.string	"\365"
+	.string	"r_\356o\016\214\202X\215\fK&N\320v\343\300\314\325L\271\3528jC\002\372\321\001\204\342\275|\231\253\331\332ud\312*Rb\250\337\262\207\333\337\317\335\345\362B8\246\\\313|u\3109U"
+	.ascii	"\255\2532\352\347\266P\177\362ow\333-\306 ,-mB\250Xy,\305g\001"
+	.ascii	"C\"Z\307\330\324\246\324\237\253T\317\273\257r+\305\257\311\330"
+	.ascii	"\336\272\02613\267\256\312\251M\240\376\024>\210\3764o\204\376"
+	.ascii	"\334\342.\036$\032k\330\203e\222c"
+	.string	"\033\240u]\207\215d\213n*\277)\027\257\246\350i6\027\367oG\220\354\023v\325l&{l\374M\0163s\302\322\006\237\303\211q\372\304\307\321\036?}e=n\232Pgiv\f\225\3210\203n\214\330\371\362LV6\306}\270C%\307\260\331\301\225\3718\247\024\326u]F\226\351\370\366\276\273h\273[f7M\nQ\370\213\006}s\337\bE\214\013mS\277\277<\225\237$\0311\273\267\274\031\\\250\353j\330\021\351\005\262\202\216\272S\357\242\310\342#\237:\210\344\241\304\313c\354\260]e\030w\332\356\223\376\230\255\331F\333}0\274\227\357\324\343\276R\327\362G}\356\013\365,?\203\247\273\375\n\276\366;\235\313\267\351n_a\312\313\344\343=\220\362.\251\274J)\257\001\037oR\312[@\345EJy\t\370x\217R\336\240\312; \3455Jy\213R^\001*/Q\312\033\300\307;\224\362\002U^"
+	.string	")\357/\345\365\245\274=\225WMy\323\036/\232\362\236*\257\231\3626\312\313(\357!<\365a\203\243e\251\244\355\224+\216B\203\3266']\223{\371\343\376\271\237\313\315\335\323\275\313\376\313\003I9S\326f\260yQ\033u\232f\203\314\327\\@\027\021\265\200:J\210\372a\222r\360\326\226\370\327\001\272\251\367s0|Gr\215\224u5\036\251A5\236\312\202\237go\350\300G\256\271\376\350\260\035\352"
+	.string	"k\365:\017\022\366p\036\347\203\271!F\240G\216@\177\016\265\024\035:"
+	.ascii	"\r\354\273\001\320(\220$\033\274\265\023\217\257\177\235\246"
+	.ascii	"\221\335\031\317\n|\305\240\275\366u\2531BQ\273\327'q5G\324>"
+	.ascii	"\335O=\3118S\326\216\346\307l\217\331i\3137\201\232\335Y\332"
+	.ascii	"\356\330\350\214q\240\005\262\260\323\036\366\211!h\247\375c"
+	.ascii	"\036\332?\206\231\352\263\321422\307\274\335\0227cB]\327\261"
+	.ascii	"\b\3732E%'T5\260\006\352i\213sfe-\352\335S\315j\216tD|1\227j"
+	.ascii	"\250\336%V\361\221\335\n\220>V\356\250\226\352\023)\250\0314"
+	.ascii	"T\237b\214\001\013\\+'a\225\223\360\313I\250\225E\304\202\321"
+	.ascii	"ET\025T\272\340\245E\374jq\005\254J\273\\\204@\261\225eE\274"
+	.ascii	"J\341\003\341B\353\213\210ue\305\344\205\"\013k\213\313\202\326"
+	.ascii	"\325\326\0261\205\205+,\242\227V\026\221\nF\027\222\n/b\007\026"
+	.ascii	"+\276\254\324\255j\220\245U5\334\312\"\256\030Vuy\r\033\004\227"
+	.ascii	"\213\305U\327\320\005\027W\327\360\247\\\333\374\355*\\\020'"
+	.ascii	"xyf\264X\033\265\323\026x\006\355\251-\227\034\345x\311\276|"
+	.ascii	"O\312\222\312Q\016\035\366\337\336K.\325\216r\374\324\302&\343"
+	.ascii	"7lu\3068\320\315u]\327\364\177\2016\365\203>\334\3173ngb\\\210"
+	.ascii	"Q\246\003\315tw\341y\204\016(\365\222 \245;\003x\305+\337\221"
+	.ascii	"\264SA5\276\313\202\237\033\314:l\223\332@\247i7\3448\334O\237"
+	.ascii	"$\244.\260\007\251\017\346T@\222w\360X\251#\216\311\271\304F"
+	.ascii	"M\300\302Q\023\020\361;<G\003:hg@?/\200\210\250aH\345\bB\244"
+	.ascii	"hD&H\222&\255\001\240\002\221\271\2629\021P\251C\316\225\246"
+	.ascii	"\225j5\210Pg?\242\304\022\0014\335\tQ\3710:\024\336C\244\376"
+	.ascii	"{\3608#M\266\\\346]%J\f\346$\037\"\266\001\204\017\"\211\034"
+	.ascii	"\344\3440\220\317\rA\220\373}\212\025\003\236\340\264OW\024>"
+	.ascii	"\316j\304\215\2408\351US@\244Q}\352\221s$\032>\024.9\310\302"
+	.ascii	"\223\327KW\305\002WpJ\353\263\353\r\324&\376\021\005\362\354"
+	.ascii	"\202\322\307\277\370t\216\227\373\301\371\253G\360=,\200=\300"
+	.ascii	"\021\223\314c\357\343`\322s\001Y\007\251\206\241\230b7$\374}"
+	.ascii	"o?\210\210S\271\200?\333\n\r\013J\317\223bq\352}\257\351\321"
+	.ascii	"V\211k\247\035\325A=\232\362\33303\b\252\276\302l\020\323\332"
+	.ascii	"\321H\306`\035\331\343\215\200\024$\2074\211\b\005\226\226\225"
+	.ascii	"x\356,L\223\307s\222\025D@\233\225:x\223\243\335s\013\266\325"
+	.ascii	"\301\360L\003\031\341R\374\316k%Y\020\024\351!H_\007\375\003"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.269.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`l\f\365D"
+	.string	"\032x\260\032A@\244N\007\357*\013\212"
+	.string	"Q\332\375D\371F\332U\266\b\330\320)jt\020\251\244"
+	.string	"\204D\207K\245\226\344\203D\274K\312\033\344\337\247?\021\027\354y"
+	.ascii	"\311~\252\232a\206\355\245\221\220\275w\222)\005\232\001q\001"
+	.ascii	"\236\001\3072]\236\321\262C\361\374\375\310\"\343}\257\373\315"
+	.ascii	"X\216Q\363Y\2224M\220\234 \026Eg\227\253'\265{4n4\371K+Qt6\257"
+	.ascii	"\3062\214\232\315\214uH\004\311i\3600\355x}\024\243\343(W\263"
+	.ascii	"\237U\371\343q\241\350\354{\235\337\365\321\001\204\327\355\300"
+	.ascii	"l\370\351\323S\2303\325\312\2778\335\353`nxv\346\"\235>A\205"
+	.ascii	"9G\245\234\355\007Eg\233\036Ss\020N9\356v9\357\362\372\234\016"
+	.ascii	"O\346\334\204\217L\316\324\005m\240\350lS]\331:[\364\244\326"
+	.ascii	"\331~\273\t\233\310r\330\203\276<\317:A9\347\252ok$_\251\336"
+	.ascii	"+~\235iI\251\224\204\224<2*B\272G#Q\221\330\262\3537\341\267"
+	.ascii	"\375,\314\231\226\356\246\270R)\211x\201\rM\212#U\243P\326%\340"
+	.ascii	"\023\234\034\300\2066\365\2434F\253\225^\346\363j\324m%\306\035"
+	.ascii	"\302y\\4\t.bCssd\234\2779\267\032E\322\346\b>\256\305E\215`#"
+	.ascii	"\361B\225?){\330\320\336\234hu\200w\266\347\325h\221\025i\205"
+	.ascii	"0\316\343\242j\270\270\266L\372\332\274\032U['\254y\013\364\300"
+	.ascii	"4L\\\223\324\362\346x5:]\247\346P)\342\200O\334\256J\2637\250"
+	.ascii	"W\243Q\326\250\302>@\216\347\304\354\372o}|x5*e\245\320\347\303"
+	.ascii	"\217\3379.;\023\303\253\021.\210\1771\2107\025\235\221\255\313"
+	.ascii	"\234\263\337\371\200\270h\026\214\211\027r\316\215\241gh\336"
+	.ascii	"N\336\355\324\356\346\3536\366\005r\322\370\234U\304\360!\373"
+	.ascii	"\322FB\277\302\263v\232\272\f\277\371\232s\316\353K\035\254u"
+	.ascii	"\372\n\377Df6\350\\\023\303\207\315\204\377\017|\367k\002;\264"
+	.ascii	"\227d\037\326Jl\364\006l=\214\327\241(B\361w\247X\201\035\372"
+	.ascii	"\277t~X;=~\242\324L\317\363P\023\037>\0039C)\377\322v\177\n\224"
+	.ascii	"&\330\364M\232F\353\337\202\316\316\030\036\324IL\340\273Y\\"
+	.ascii	"a\207\372\373\235\273\017\274$J\f\013\307>\254\233*\206_\332"
+	.ascii	"\355\020\b\341\250\375M\272+x\236\267\225\213\333\001\203*\367"
+	.ascii	"\363\246r5\336\013\034\215\367\224T\224\213[\201\227\361N\340"
+	.ascii	"s\356\007\240\\\214\267\001\027w\001\247\272\023\360=\357'\267"
+	.ascii	"\363vrq7\271\270\231\\\334K.n\245\213[\t\211;\311\305\215\204"
+	.ascii	"\304\235D\342>B\3426rq\027\271\270\221.n\327\305},\302mtq\023"
+	.ascii	"\261\270\213H\334\304\026w\353\342f]\334+\306\375.n\334\342v"
+	.ascii	"\013Qvtp\300\364\021\376 5\233\035\026\312\202\254\337\024W\343"
+	.ascii	"\216\306=\317}\317\335\317\275\214\273\030w0\356vN\324\355\355"
+	.ascii	"m\\\260\373\330[\356\246wL\343\364q\253\373\230\246}\215\232"
+	.ascii	"\0278\242\374\255\2750\323\036\210F\307\232\323\250\031\315H"
+	.ascii	"\252&('h\213\313\315t\033\235\332e\3119\037\273}L\273\236\363"
+	.ascii	"\371\237\003v\316-8\320\024<\222\0054\215C7h\267\306\022:x\005"
+	.ascii	"\337\330\t(\211\267\276\203wA_\267@\241\363w\306\316\217\330"
+	.ascii	"\241\373+\003\367\327=mg\353\221-c\220/\306\t!\fU\033s\235N\365"
+	.ascii	"\336\306\0214\365\372\264N\376\370\216\f\236\375\242'\305\340"
+	.ascii	"\261\241\223?UoTg\344\356\351G\224\337\334\214/\305\007\220\274"
+	.ascii	"Ip\035'\201\202c\037\366d\246\350\021\275\264\337g\264TP_\364"
+	.ascii	"\246\320\325\031\303\203\264\260\330\273D\302\033n\276L\036\270"
+	.ascii	"\345<f\345l\343\214\303^i\333;\235\266\316R}\200\251\337\202"
+	.ascii	"?>\200:\265C\343/\370\225\315\241\027\256hh\352\215\357k|\205"
+	.ascii	"T-\220\363\3121.\372\247\370\322?>\365\354\227\274@Q\230\350"
+	.ascii	"=\215\023z\341\246\334rv:\264\335\320\007\275R\326w\n\364\205"
+	.ascii	"k_*\257\025\354\320\251/>\321\257\016\350u{\261D)\276\007z\261"
+	.ascii	"Z\2476XV\244\351\222a\363\207\250\243\225z\266\231\247\207\316"
+	.ascii	"N\001l\200\313\333\005;T\352q\240\023+\202\330\301Z\342G}\211"
+	.ascii	"i\236\330\340\235\237\030>\364\342|\300<\211\226'\267\026\301"
+	.ascii	"\317t\277Y|\017\206\326\351\r :C\271\234\263\225\036/\314\320"
+	.ascii	"\036\305\331\336\320\001;\364C\353,\361[\264\351\235\341\\\373"
+	.ascii	"\t\236e\363\355;\240\027\t\353\322\002=\345\374\320\033\260e"
+	.ascii	"\277\3007~\246!\221\361\265\265/M:X\013\365\377%\017\n\035\033"
+	.ascii	"\366\241\036\353\365\223\b\022\330\241\354/\0338\201"
+	.string	"7\360\216\347 \002\035b\303\210\021\030<d(6\262\263\240\226XP\313\032PK\030[W.lx\035\265\026\025\r\255\257+\256\252\030]\\\\]XO\255Ee\303\253\312\206W\0223\253KD\026\363\213\006\023)\303\2312n|\255+\263\006\214\253\023L\257\255\0323\230^\256\027\363\013\353\312\353J+\0033\253\213\013\351\365%\343a0c\304\270\322\302\"\272\250\321\342\2311\266`0\271\256Fdqa\021\033\213j\013\006VU\214\255+\256*,/\032UT\312\356\222\301\364\252\372\352\352\362\252:R\233\336|\261gR15c\3306\3014\227n\2549\263Y\270\363d\341\027|\350Uw\362\314)/\340\244\224\373\030\f\345\r{\340&Vt\372\035\002g\017\220\275O\214\347\311:O\204\b>?\254\270G\214\026\245&\267\267GY\321\351Z\234Mo\224&\031|\036J\232\200\227\236\351\013\274\233\301\322\327L"
+	.ascii	"\235\367\254\350t7\004@^!\313\347\207\265\3253a\037\256\374\245"
+	.ascii	"7J\327\0029\327\360\017Wz\345\277!g\\\322+\261\201!\253|q\226"
+	.ascii	"(Ib\327L\013\031\316\265au~H\201\356I\240X~\034U\275\022\036"
+	.ascii	"\225\037m\324?}Y\325\237\236m\362a\241\263\243\002\257\275X*"
+	.ascii	"\270!Fb\365\312\251_\363\221\336\237\207\214\200\271\262\271"
+	.ascii	"W\250\210Z\222\003\231\251\036W\254L\232<\362\202\211\200\021"
+	.ascii	"U\367\n\207\b\241\372\243g\222\"\031|\036j\266{j}\216\210\264"
+	.ascii	"QA@\b\316\bA\334\036\234\3004\201EFj\030\r\354\310\266\207\317"
+	.ascii	"p\324\241|\212\336\350\237\244G\016\237\207\234\220_\364M\200"
+	.ascii	"\001\200\364\250\201,\245\030S\246dFD\244)H\322\030p\002\021"
+	.ascii	"\242\262\332\006\021\240\27536\222$\2054\006!\243\324\275\177"
+	.ascii	"\356+>\022\034W\013\354/\036H\322\214\337\372,X\240\317\374\274"
+	.ascii	"\017u,\214\206\372\031\002\313y\245\356\230/DRq\264bA\361%\235"
+	.ascii	"Q\353dT\326S\n\030\332r\r\251\377X\267\255\340\270.\212\201d"
+	.ascii	"t\340\250\334\246\206\t\376\241\224+\276(\240\206\2358\333\264"
+	.ascii	"\212/\337\232\364\235\024\230X\315[\235\013\234\304\237\200\327"
+	.ascii	"[X\315\300\270v?\003\235\342\357P\255\313\003\261\030m\373sN"
+	.ascii	".\312\340B\270+\360,g\270\231\314)[HO\\=c\225\3700\326\201\314"
+	.ascii	"\233\325\234\031\3345\375\242\231;\265\214\277\001\226P\331\346"
+	.ascii	"M,q\t]\256\004iJ\250\327\215\211J.\335\231SX\215U \302\345\321"
+	.ascii	"6\r:#\277J\336v\346\201\031\361!B\301\002\253\223\351H\311\377"
+	.ascii	"0\3657\364(\262g\246\211b\025\350\243\223\202\372r\f#m\032\221"
+	.ascii	"Z\256\032"
+	.string	"\206a`\305\314\250\0273|-\005}\262\f\025Q\225!W$\375\331d\357,B\262\247u\251b\263i\0028\205\36073\366HN0\270\2074i\353\003\036}\034N;\027\200\351 ?\017\031\263T\267OI!\364\251G\371\033G\260\234\206\221\300\f\251\235\274u\265\200\214\320\235#\nY\210\302\236\223\207\347f\026\237h5$+R\341\f\250%\365\240\233\006\021\n\211\025\234\371#\231\204\023\277e\035k\252\217$6Z\320VM\203\005g\224\020<"
+	.string	"\204\243\340\300XHJ\271`\001\344\0176\0249\020\021Y\001c]\343\227a\236\005j\371\310\f\266\203\213\351\276\244\315q"
+	.ascii	"\305\375\340\224\\\230\335\202\332{\357\210fm v\303E\203\327"
+	.ascii	"\343\277\034}\351\325\353\255\007c\341mu\370\003"
+	.text
+	.section	.gnu.lto_printAux.270.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\2258"
+	.ascii	"Ze\020\026AP\344J\007\203f\341,\305*\341\3460\211$\251;\356A"
+	.ascii	"U\304s\227\263Z\212mC\345\316om\016m\301\030\307\260\351\001"
+	.ascii	"\0205\300\bp\201A\340\257W\020\202\367)!\006\033d\023I\310\336"
+	.ascii	")\245\024V\001,\001R\001;\206\326\302\265\325\022\333'\210jP"
+	.ascii	"\250(\357X2\334e\232\257\315\364\037"
+	.string	"'\375v\030\335\305\305\t\362@\002\263\373\274\224\302\236\253\220#\\\034b\257{`\033\306~\210h\307P\341\301\254\007\206\256k\317U-y\027\245\317\353\266\030\356<Nv\312\314cp(\221=\3274\365M\034!]\342\272>\241:\345\032\267\323N2\363\207\321q\370\002\314\335\032\b\177\266\027f\177\331\2014\264\222\331\265E\335N\371y\333\231\233\256\2710\273\256\007#\327\365-\257o]\237Q\334t;U\352\"c\247h\023\031;e&s\035\244\2625,B+\244y\227\270\256\353\324;a\001\215>\233\225\316l!e\020PRE\336\2431E\337\231\334x\315\304\332\2613\314K\013k!\364\313\022\331\272\020-\t\212\201O\323M\347\215\271\262\211\232[\007-\275\251\2655\020['\331\344\320\220\270\332\366\327KrhG\034I\244o\277\251\255\365\261\013\321\326Z\260\351\306\0263\322)JdD\017\2162\255\fu"
+	.ascii	"\247\312\221d\232\231\243\250\2016\203WZ\260\227\n\321\214\240"
+	.ascii	"LlK\310\364_\373Y\032\231\177\347u\n\027GH\247\370\246\346\326"
+	.ascii	"~\334\260\256+\2733M\255y\250\231\233\0013caV\215\002\005\210"
+	.ascii	"8a\223\247\215\0342\347\303\376\024\276\302\247\255\231\2251"
+	.ascii	"_Dc\354\367o3\2711_d\250\357\357\277\006!\307\356\331\031\342"
+	.ascii	"\375\021\363\3057\354\253[\362\254\364\b\017\325\020\2369\013"
+	.ascii	"\206\267s\302\0279\377\250(\"\232}\030\3633\314\037\216\271\221"
+	.ascii	"\246x\031\344g\302L\342:\213h\275\346\020\275\327\374\341:sh"
+	.ascii	"\300f\252n\2335d\3503\315\027\032L\267\205\366k\256\320_\272"
+	.ascii	")L\3500\335\021\272\256\033\302u\226\272\316Q\335\327\354\240"
+	.ascii	"\3074C=u\230\346\006\327\231\301u"
+	.string	"vR\235\027\\g\005\252s\323uNp\235\231\256\363\222\352\254t\235\021\\\347\003\327\331\200\352\\ \351L@u\036\200tNB:#]\347#\325\331\350:\027\251\316\002\2563\321u\016p\235\001\250\316C\327Y\350:+\257s\220\352\f\224tN\252\316*\322\031\211t\276\327\371ht6^\347\324\350\214\036\235\375\350\334UOv\354\332\200i\327\336\360\271\nY\354\263\022\246~S\032\260\273\355>\323\255\327\275\327\335\327\355\327=\246/3 w\333\201-\310\3113\001\037^\207b\020\026H)\035\353F\261\016\371p\354F\250n&\255\224&\337\221\303G\375\031\263\223G}\362\205\236\350\213\376\350\241\236{\017\263\312\361\r\320\215\033\335\272\232\265\223y\345\232u\233S\247\307gfa\316y;\031]\333>\214\215\376H\317\033\346je\3644\3304\002\276hK\343\251\022\360>\3304\212ub\207\035\340\211\232N\003\370"
+	.string	"C\017\200K#\332\031\232\253;\222)_\310\314-\251\2715\006\275\362\337\217\231\034\320\007}3\273\364\234*\tO\230\252\345t\3504*\016\3207 \253F\261\356C\307\t\221|\037\354\340\034z\325\347\360*\034\273\247\371\207yD\303\251z\343\243\217\225\372M\205\035l^d\343\344\355\350\246\251>Uk\267\3305\026/u\022\215\017\227\202\0315|*\326f\261;r$\3257\222\022]\210\374\356\303\006\316\035\371}f\023(\274\235\032\276\323\224\220q\212^\263\342\256+\331\004\3564L'\213\033\245\323\373\215\207m\025\353\224\376\364\351g\3707\303\266\204\306?\032\277\017\233G\320O\277\233"
+	.string	"\374\302Wx\346\026Ko'\372\177\207\375#,\3730\366\267\360\027\276\005;\305\035\213gfe\314\311\006\201\254\241\017\307\275\303h\341\003\f\246@)\007\3302\351j\271\245^-\267\336\203\327\214%X\215\254\240\034].\276\353\004V\226\f.\255\031W\253m|\231\200\301\245\205\265\314\212\241Z}\315"
+	.ascii	"[\276\310\302B\340\245\205\305\325\325\201\253K\353kyC\353\353"
+	.ascii	"\212*\013\253k\013I\206\327\322\212\306\026\030\326\345+)\255"
+	.ascii	"\031WS\\Z\313\255\251+\033^SRE\334E#\313\306\324WW\227\215\251"
+	.ascii	"\344s\355g\202\3277\017\r\242\"\242\330\217\021\n=\034#\265\004"
+	.ascii	"!\243\264lM>\3473F\203\032|\3435\362I\213\244\311\347\023\376"
+	.ascii	"\351\317\032O\243\353\272\256J\034F\250'\361E\330\2751\3030n"
+	.ascii	"c\276\350A*T\177\265zM\276\244\210\227\222z\002\217\340\023\274"
+	.ascii	"\202wb0\305\3013\370n\376Y\360N\016D\217\325\202\246W\340\316"
+	.ascii	"\252\246W\301\032*2}\202\245gR\372%.\376\243\2514w\340\021\030"
+	.ascii	"\370\003\377j\n\274\001/\253r\212\343dMO\n|\273\261t\\,\b\201"
+	.ascii	"W\301\036\002\rx\021\177\204\213b\350+\342\200\3575\366\260\353"
+	.ascii	"$:\233\311\020\t\374\002\253x\013\345\356\210\372p\334\202\215"
+	.ascii	"\244"
+	.string	"\323\3065\371R\343\325\323\2725\371\236\333\313\350\340\317Z\260\273\315\331JI3<\243\377\364\r\376\354\303\377\227\300)I!\276\207\364\t\222\364\035\310\276A\n\200\302\250a0\b\021\202\204Dd$HAA\223t\260\002\2211*\325\001\021\3200\251 T#II\322\030ZfY\037\r\235\323q\202\300\316\364-\304\024 !w\332lh\205\217\006Y\344\3738\241\0018R^\202d\235S\245\341+\255D\3516-\036\345\345V\263Q\033]\211\013\256\221\326\203hl2 F\333\210\030 \021\353\236\374\363\247\030\306\211\342\224L\002\030\207\221\004\355\264\030\235&\331\206t\235(\205\"\006\335\235@\363\336\332X\t\0064\215\365\ta3\350\202\274\351Y\016\236\263X_v\311ZPy\365,\201&H[\250i\356@0\335\211j\225X\220\307\3054\234\236\312~\236\210\305\374;\303S\247\023\320\0053\265\321TT\033\221\034"
+	.ascii	"\275\344T\276kc\261\234\212\033\242\343\t\346\201\300x1VRYQ\361"
+	.ascii	"\262\205\245\340\020\024qD+@\026\213-\024l\032\232\216\365\323"
+	.ascii	"\372\355\264u\351\366<?J\031l%)\324\242\233a\202\331\f\240\324"
+	.ascii	"|\027]0\b<Q\326.ii\367\203\242\274=\233\371NmO\331\354\347\261"
+	.ascii	"GD~\024m\325\220\f\336x\270M\201D(p\006\352\307\024x<bp\332o"
+	.ascii	"\271\013\202\367\243N,\236\036\261\343`\322\304\003w\02759\020"
+	.ascii	"g\355n\035\301E\366\002(\334\334\n\337\202qja1x\215\006\301@"
+	.ascii	"\367\007\2507\350\025\214\270\336cX1\303=\363py\020\023\032\214"
+	.ascii	"D3\377a\304\242\002"
+	.text
+	.section	.gnu.lto_cliAux.271.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`9\001=\016"
+	.string	"\326\232`E\020\221\223\016|Jz"
+	.string	"\bG\2061\004|\213\375\021W\226\215\022\001l\331{\007\200\2219YK\025\201\335\255\365\377\\\312\353\004dev\022\351jE\230\313 B\301\202\240\276PD\374R\211R\347\233\335{\357\235RM"
+	.string	"I"
+	.string	"N"
+	.string	"\367\324S\316\007\324S\217\354\031\005J\226\264\240\005\f\223\0247v\327\222#>:\2352\216\374\267\274\203\363H\247\034\224O"
+	.string	"\036\312\345D"
+	.string	"\256\250!\300;MO\247\302\275\345\361\203g\212q\323`w\0359\357\344\256\267\035\301\366\003\373!\002$\3733E)\302\276\f\3030\264D\331g\371\353\277\237\316\350s\236z\321\2018\271\212\314n\027\342\330\025e\221\262}w8\n+ a\243\363\216\355\370y\230\371x\264\277\362\023\243\263\220\334c\027\345\022\263\373%\360\001\316\251\277\365\252\253"
+	.string	"I\032)\273\245sW\331\037\207\271:R\335J\306\312\3562p\371\013\346\2338\265\205,\236\313\352\351\217\241\332\332\026\317\371/%fV&O\251\001c\2449\324K\n\252\030\247X\343M\244\322\026m\210\347.\003\300\270X\321\200'\031\276\360\021a!\233\006r\205\254\253\202\001l$\023\3014\020\204\020\355\332\370\372d\"\2275\222\2014\353\n\211\254\217\307[\006,di\330\266\220\325\371J\237+Qv\220\003\244\001K\3224ww)\201He\225\266\204\t4\312\224t\251\351\021}\222\352\203\004\033"
+	.string	"I\231^\t\377.\306L\274K\nWz\021\301A\242\335fX\f\034\314\032D\267\211\252\370\202"
+	.ascii	"\t\261\232(\031\354s\327\3005\002[\341jP\b.\003#\002T\224q\227"
+	.ascii	"w6\331\024\346\032\255\202\002"
+	.text
+	.section	.gnu.lto_printSerial.272.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\244\n\3051"
+	.ascii	"\352V0\023EP\244N\007\003\344\374\274s\360ciPF\256\324\"\227"
+	.ascii	"\251^+\377\316\367h\370l\353\b\006\252\026\354ykL\213M/\362x"
+	.ascii	"=\240b\240\240@\004/\324/=\265\233\001\332\242s\373\376c\357"
+	.ascii	"\335m\357\235dJ\001\032\001\007\001+\001\302\334\231\315\355"
+	.ascii	"\022\236\242s~tQ:\377\367\214\315\006\353\304dV\276%\236\347"
+	.ascii	"~\327\355W\332\365\032\356\006SF\317\013;:>c3a\323\316\216\330"
+	.ascii	"\272];^\303\276v\367\335\213#\3443f\276g\344\244o\202q\374\034"
+	.ascii	"\372\332X\255\257\016w\367\327\301\260\242\306\201\256\357A~"
+	.ascii	":\025\243W\211A\364\023#\347n@\265\276\366\263\365\334\355o\016"
+	.ascii	"g\3648\031\355\3061\233\036\2268~BuR\353\353\221\007\261\276"
+	.ascii	"\252\016\304\372\332\306\3566Dc\361Q*:MZ\021\214\3438\352\215"
+	.ascii	"t\353\352\323\333\315F\177\335V\310\256\352gc;\324\221\234\321"
+	.ascii	"\271?<\346\321_UX\206\003\215\227\301\241\246V\005\272Qs<\317"
+	.ascii	"K\246Xv\213\234\245y+\344\341\254j"
+	.string	"\344'\006\212\0173\251\"\371\020r\005f\222\345\025,:\030\310v\326\303U\325\t0\213\034\2309\246\006\231)Q\272\236\3472&2\277\343\371\332\224\223\276M\331\316\322<\013'\304q\334Y\311<\363\206\275\273\357\272\233\254\373\315\020l\356h=\230K\365\233\355a\354\277\327\\\032d\246\323C9\177\267\207\017\331\225\377G\310?\266\177~\217\223\274\323!\\\013\226\323\265\025q>\342\2254\216\221U#<\013\2116\216\221TX\214gE\2516g\f\326W\177\327s\265\311\2141\202kpq3\362\340C\313\246Y\276}\262\203\037z\203\357\326B\221]9\365A\312\301\347\024\220\354\217\335\317c\376f\267W\005\2221\351'\322}\005\301\312\351\334\253\274\212;\325\224\327\271;\3608\367\006\236\347\r\345w\336OC'\257\363nrs/ps3\261\271\227\340\334Jp\356$7\267\20277\022\234;\201\233\373\350\315\215"
+	.string	"\316}\300\315m\364\346.\202s\033ps\027xs\023ps\023\261\271\207\340\334Bp\356 7\367\20077\020\234[\200\233;\300\233\373\007\316\r\300\315\355\363\346\356\201s\363\270\271\3417\367\353\346v\327\334\255\233[\350\346f\333\334k\233[]s\177\031\246\244yI\224j\313J%)\201\357qr\206\311\032\234\260)\363<\200\027\360A/\364D\337\231\206q\211\220m\314\232\265\2678&s\245\261IK\266\305\344\253\360\215O\214P\262+[\215}\374\261\207\236\310M\210<\206E\225\221D\251,\2664\364O\320\264(\371h\224\243\3121QjpI\350\335\213\023:\005\341v\352\004\001\375"
+	.string	"7\2473\025\004r\023\341r\342\b\370\371"
+	.string	"S\034\316\233\300\237\274i\tw\323\006@\317\373\030\341|\215\2324=n)\\j\224k\333\321\370\037\005\265+\\`]y\201\365\225\347\215\216\360\275\017\277cp3\031$\370\021#\224\211z\337\3538\365\246q>y\370\356C\370\260 \355\273\357\355{r\213\325\013_\330\264\373\033:\373V\377a\222|by\260\013d\036\357/\254\372\353wo\350\220]\311\276\214 \036\246kI\n\206(\341\313\324\372*\033%\232\367uy][\034#]\351\205\350h\242eE\007\243~\326\230\335\030%\232\017\031\363\253c\277\271\347U/\304F%\320/3\221#\205\256\352Z\374\001\315eB\351\310\350\213\253\030\346B\253g\313\275\300<\240`\261e\242\250\225\342\005\343\n+\236\320\262"
+	.ascii	"\204b\353\004\213\256\n\\\305-/\255/\036\025_\305\r-V\204\231"
+	.ascii	"h;\213\301\026WV\024\213\255\342\212\250,\257\257(\006A\335\325"
+	.ascii	"B\313+\n\254\253\313+\n~\306\376D\240\336^\331\0018\005\234\361"
+	.ascii	"b\3577\333E\322^9\243v\222{\271\227\255\266N\357Pw\333\242u\222"
+	.ascii	"{y\352\207\277t<w\337\250q\034\307\256\260\351[U\207\357\364"
+	.ascii	"\313n\367\027\354\323_\275\216$w\346\376"
+	.string	"\352\326\304\362`\326\322~\263}M\3372\271\307Z=X_\215\344\336\352\\\034\352\227\256\347j\237\215$\224\205\360\255\256\303o\372\245\201?\360\t>\351\225\236iA\022\250_\260\364L\3176\357\3468\261\222 Y\372\247\275\2766\243\334\223\021\"S\221\"\245w'\316-nR2\221!IH\257\300-\013\t\002\004i\313\324\030\227\177\370H\200\340\217\246d\265\264\036\b\334,d\264\274\343\300\017\025\275Q\316q\306,z\357\342\344\242!\233\3452\003?t\204\217\300\027x\307\220m\004\200\300\250QH\005\021SB\"#\nR\230$\255\001\340\002\221\241\241\325\001\021\360\250#\020)\233\262\220\335\257\310Y\351\335\260\347O\205l\372[\006\274\340l\n-\251y@\372H\217\024G\250\237\320\236\237Y&\350\270\016\313'\233\222\243\242\315\252\001\227y\235>m\373\007\222Rd\262\026\344\371@\345^ 3\003r\372e\312\276"
+	.string	"b\004\003*\221%\266\007:\267\020\304\030\006T\"\213\3027\355`\341qrc\215/\234\261\247\326#\227\3107\351d\352f\007\210\3426\335\372\370\321\213c\035\030\270N\240\266B(\026\275m\034:;\302h\231\326"
+	.ascii	"i\274\241\315\205\261\240\r\261I\271O\210\2438\300\030\006T\""
+	.ascii	"\033C\307\b\360\306\203)\200\347\361*\0021\273\240B\317r\330"
+	.ascii	"?\3528<\306\006\226\220\324\342J\207\372\356\360\270B\037\030"
+	.ascii	"\362_\023\206\237\353\211\373\231\207#\337\257\373\243 >C\351"
+	.ascii	"G\356\240\207Niv\350!\243\303\202\234\352\211`\231]\260\027\237"
+	.ascii	"\223t\347\201C^\266\374\211y\207\201;\344\016j\203\344K\342\331"
+	.ascii	"\207~\232?\316N\250ja\335\245\210q\310\201\305\017\262rFvw\220"
+	.ascii	"XE,\362M\302\311\301\375\027\336,\206\004\b\f\273V\301]\260\252"
+	.ascii	"\202\303\352\r4\376X\305[\034\320\350+01j\372\270(\330\221\325"
+	.text
+	.section	.gnu.lto_cliSerial.273.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\317\r\315G"
+	.ascii	"Z|\230\033?0\240R\007\347\247\326\303h\"m\253\035\177\215R+\346"
+	.ascii	"\021\302\254\247>\006H\017\026\313\353I;d\306\215\254.\t!\201"
+	.ascii	"\024\204\002A*\243\240\251\243\2164\367,&\301Q3\270\326mw\222"
+	.ascii	")\005\256\001\217\001\251\001\330\371\274\317\375\374\317\265"
+	.ascii	"\315\004\364@\251\013\222\rm\r\311,\346\\]\261m.h \3652e\236"
+	.ascii	"\327\362\r?\206\200\035\224dv\024\3458\331\333\346\f\005\027"
+	.ascii	"s\316jP:\262=\214\213\221\372\230.\364l\315\336c\216\341\232"
+	.ascii	"\305\234\363\005\245#\243\256#\275`p\270\031I6[\237\330@2y\214"
+	.ascii	"9g\255\034\331Y\3358\253\343\316\001\307\335\236\347zR\337\333"
+	.ascii	"\341F9\317\375\231\3119{\325\001\224\216\354\254C_G*\035\351"
+	.ascii	"udK\273\025\231\324\262Y\226!\336T\fc\316\031\353\237\264\353"
+	.ascii	"n\326\333\tK}J*\n\352\311\251\211iI\t\232\204tdTD\364t6\231\313"
+	.ascii	"!e\362E\272\217\245\355mf>%%g\375\342Q\\\207\200{\240<NU/\017"
+	.ascii	"?\271M:vo\036\247\352\305e\340\006H\307\t\335\260\223\023k\027"
+	.ascii	"ob\312[\302S\252B\005C\251$\321!M\241\303GP\214\222\025\346\016"
+	.ascii	"\341\366\024E\301R\205\202\211\306\016\337\366\310Y\271\370s"
+	.ascii	"\211]\303\210\347N\327\300\342\031@\036\247zu\241B\250P=\r\034"
+	.ascii	"nJ\211{\213r\316.WU\362\026U\353\\f\222\245;\001\215\021!\236"
+	.ascii	"\306\251\342T\337\\Lgg\217\023:\025\226\252\027<\204\273\270"
+	.ascii	"\222J\316\212\304\223n\224\0347Z<N\025\211[\245\204\311\337\024"
+	.ascii	"\277F\034\351\"\271\001\322y\266\255\271\007\350\330\2751\333"
+	.ascii	"\324\260\373b\377\026\363\032\345\254{\376\256\201+\033\"\317"
+	.ascii	"\2664\027\n\247\t\036\327:fkC\3038Y!\347\334\230\332f\365\216"
+	.ascii	"z7\376\320\335u\335L\277\256\225z\201\326\3119;p*\237\004\217"
+	.ascii	"\237\b10q\352x\206\037\331\314IQ\202\304\361.\370?\243\243\207"
+	.ascii	"\n'\370n\351\027\013\330\251\013\036\351gg\267\225\312\260\001"
+	.ascii	";5\301G\025\370\325c}\0221\260o-\013\032~\354'\334\364>|\255"
+	.ascii	"\334\315\270\026\307\023\n\265\333\303\007\374\347Vm\\\\s\264"
+	.ascii	";\333E\227\t\267\357x\333E\274~\306\335\234\300\320A@4\306\274"
+	.ascii	"\234\317\330x\033\022\355S\034\331&N`\247\236x\035\351\216\342"
+	.ascii	"\355V\261\002;\265\335\017\313\240\355\264\371\376L\231\274\323"
+	.ascii	"x\375[\360\335I\303\202\272\b_}\267\326\026v\252\277k\335\303"
+	.ascii	"\221,\343b\332\233ug\321\360c\273\335\373\336\324i\353\237\353"
+	.ascii	"\366=w\r\027,x\241\267\204\b\020\0368\310r0\336\013|\214w\002"
+	.ascii	",\317\272_1q[\005\250r2\336T\321)\037\364\226\212j\342\206R\342"
+	.ascii	"~Z\342vZ\342nj\342fr\342^Z\342Vj\342\206:q'-q#5q\0379q\033-q"
+	.ascii	"\0275q\0239q?\235\270\235N\334M'n\246\227\361^.q\0175q+\231\270"
+	.ascii	"\223K\334\357\022\267;\204\373\225\270q\022\267w\270\372\203"
+	.ascii	"&'\214a\227O\314f!\217\204\362\0269X\305\013\335\007\335\301"
+	.ascii	"\270\217q'\343^\306]\320\223\335\336\355h\332\3234\263\020\307"
+	.ascii	"\234\341\343b\f7\323N\330\314\301.\214\246es[R\214 c\036\214"
+	.ascii	"\032n\246\337\212\350\347\232\227sf\006pLm{um\226\224\234^\366"
+	.ascii	":\035\235\277\244v\330\347\370\006:\304L]\232$\244\3076\022y"
+	.ascii	"\226\207n\020\341Q\021\255Q\221\353eo\023g\227\360\315WB4Llt"
+	.ascii	"\367\333rG$\341\210k\313\226\262\324\0016\"\241\220\006\316\364"
+	.ascii	"\371\330k~9\237\2422\246\215\363\261\315\364\262\227\371.\307"
+	.ascii	"\347&\r"
+	.string	"\013*{%<\363\225\020\327\004Z\273\242\005r\337\362\2665\303\205\372\215\332\2239\315\307FP\205P{!\354\310(\202\372*\211\225\274$\027`\354nEe\316f~u_\222\017\201X\3119\027pd\325\273\337\026\267\255\032v\304\204\212\304U\231\217\355\241\177_\f\314\001I\335\2249\247=h\367\343\177\244I\\)\2344\356\225\306\275\216\034\372\241A\253Wz\020\263\246\317\037\335\353M\276\3257\236\"I\276\204\307\201X\370m\"\305b\247&?\032\341\337?\302j\037\247\216R\030B\204A\324\300>\214\313\3076\204\1770\211\211|v\250 \274\247q\243F\273=\333\2647{7@:W\206\036\333\230\320\225\214\206z\246\332\244\225K=\033~\263\336\265\256\304cXg\252Mf}\200gk\367\215z\234|\360\016\236\255]\371\330;\036\365\017\376\211(\230\270vu\237\270V\032\345\337}\267N\371\303\227\330\347h"
+	.string	"/\275\013\337vi\335\233UEz\005;\365\337\033\355\n\267kc\366\002QI>\266\243\376\222\270A\272\227\275\317?7A\267\275\354\215z\266\255g\375\237%>\031\200\261\264H\357\260S\263\336\r\355\316l\323\336\307\342\005\375\305% \032\3250\020|iy\211u\325\300\n\363Z\272\321\305\005\306\241kLk\004\027\231V\013\247\227\213\205\315X\216\201\221\311 {!f\201\313\353K\313\306\221\330\330\214\377\322\262\361/\274\\\200\205a\030\003\353\022\023#\333rv\201y}u\311\320\002\301%c+\331[\b\274\276\266\260\300\274\264d`m\211\325\300B"
+	.string	"\355\260\031]bXcaabX\314\354\331\020\257p\366h>d\352\255\210\214W=_t\223\267F\252\311\334\234\345(\270\240\373\"\030\374\330\027p\321#\275\3227\275\323C}\3439\036\205\222r\210x\326\234\312\343Q\271\346U\002\216\264\362\226\232I\321\260S\333\315J\336\254\237\036\352\227ux\370\022\373\034\237\036\211E\261\316U\317\351G(\316\271\352\201\300W\270\246\245g:\262\204W\002\277\271)%=\264H\322\347\250SlL\201\215\024A2\372\243!F\237\243N\017\036\013l\305mE\017\2152\370|\242\367\251\243\362\371\311AEBW\275\2753\374\330\023\260\313\211\252\263`*\365\201\235\332\005\356\342\324\230\321y\211\212\2005"
+	.string	"\221\n\301Z7\362\273;r\300\216\226;(\247\350\367r(\372\313gk5_\0028S\244\343k\303\347\351\261\355\204\356qlp\216M\027\244\276\352\331\204\374\305\005i\202\360\255\f\360T\317\326MS\337\256\322\301G\237\255J"
+	.string	"\237\304/\356\356\346\234\263\023R\364[)\372\355:\243\016\367w\347\310d\341\333-\212\376\324\263u\037\360\252\277\360N\350!\304\b>\342\246\350[\370'\342\341#U\205<\347\360\307b\316\346\002\356\216\207i\001\201\016\250QH\343\024SfDDF$I\2224\006q\005\004!'\035\326\003\021p-S\320\324\244)\fs\313\223\022\275\260\321\266-\023\200\323\317\251u\241\227x\211\344\024\217\224\345\214\216\361\243\345LY\330\371o\354\273J\241>Tuf\204:\364\362L\333\246\276A\030\372\374\0027\331\341\036\377\334\b\300\340\201\224'\016j82\364}\340\202&\"=\r\262\227y\"\324\3268\3311\337\262\355k\322=\224D@\365\212)\206\341\307\007%\236K\n\342\303x\257\"\317\257\310\304\343u\003\017"
+	.string	"\021v\241\031\243\213\367\306G\201\035\246\317c\324e\0324O_\210\221\026\206\270\362\223>\361\f"
+	.ascii	"\032\273\360\334\003?\032\270\266\304l\275Y\261\251\023'\370"
+	.ascii	"(\246\253\002\306?\203\203\366R'P|P\306"
+	.ascii	"]t.\360\305\356u\n\037(g\030=w\244/\311%@\344\217\261\361\346"
+	.ascii	"\b\350\305\266\333s6^S\331Rm\274k\235\024\263\221\255\b\n!\224"
+	.ascii	"\275\317\224\363\316\306\227\200\321f{\362\204\234\274J\231\224"
+	.ascii	"Z\0054\306\265R\004A0\272(\213yqkE\177\242'\b!\254\373\232\310"
+	.ascii	"%\312\003\036\377\334%\360\372\t\375\032\203\312\033\203M\310"
+	.ascii	"\345\353\362\264\"\230 \b\004\306=\371x\200\305\345!,\201qi\237"
+	.ascii	"\331\247\262O\250\222H\002\272\217\0277\270j\332\230\177\340"
+	.ascii	"\tY;T\364Y\360\335\3717\202\364{f\260&i\024\251%H\002\205\253"
+	.ascii	"\023\275$\232\354\210$h\334\341\017\350j\024\252\263-[\323u\203"
+	.ascii	"\230\247\b\261e\224g\340\214p\305\230\207y\221#S}\206\301:\363"
+	.ascii	"Z8\322#\002\0305A\233f\017r\001\357\0374Hm\003\364\030\266\n"
+	.ascii	"\005\233-_%\324S\254Q\342\003P\243\305\025Q\034n\307\236\366"
+	.ascii	"\256\227J\205\331\300s\024\202A\0024\365H\336\270\212j\204\023"
+	.ascii	"U\267\376\374&\"\326\201\310e\202X\337\336\2317EMmH\200<f\350"
+	.ascii	"\246OQ\003"
+	.text
+	.section	.gnu.lto_cbCtrlLine.274.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\266\001=\020"
+	.string	"F^jE"
+	.string	"\221(\035\373\210D&\330\260\344\364\2009~_r\037R\370\266@u\314\026\312\277\346\272\2132\312^\274\266}t\214\334\b\252\320\363\354\257\277\253\252\365O\2304\214\264\215\346\315t\354\376\315j\375\204\220M\244L)T"
+	.string	"T"
+	.string	"T"
+	.string	"F\340=z\366\020\367\350\235"
+	.ascii	"\367h\320\256a\200\265\251\00603\255\026\233\335\375\364\303"
+	.ascii	"\301sq\323\004\375\323\316q\205\251s)\217'\235\220\225\033\200"
+	.ascii	"0\303uKP\263\302\006(4\331B(!\\\247=1\204\253\314\356\301\356"
+	.ascii	":]\341\353\356n\233d\333\201\235^?\247i\325tn\351\007(\340!\305"
+	.ascii	"\353/n\354\242\324p\254Ld!\342.\277\375\323\334\361M\274\005"
+	.ascii	"\274\213[|_\373\0130`ljv\367\343\321\f\274\307\216Mg/\001~\245"
+	.ascii	"\304q\267\203\f\005\336\243\200|\332\037q\022\340e\236\371\200"
+	.ascii	"]\230\354ew\266  M=\355\020b1.Z9T\036\234GA\332\245\254\262\346"
+	.ascii	"\277\204\343\250G\235\255\r\253\203\270\251yQ\215\371\343\235"
+	.ascii	"\252\212&\006\013\r\223\274\361\265\323\253\340\364\nb\305\320"
+	.ascii	"Z9TY\263g\251\324\230\375mw\327\n\263c\032\024\323\237\230\366"
+	.ascii	"|\345\347\334E\026\244\n%\220\b\236\322\t5\332P\026H\250\021"
+	.ascii	"\323\250\363H\024R\032}#! \"\337\350D\362\211B6M \235>\224\311"
+	.ascii	"t\372:\263\375\266\n\343\250h\220Q\351\212\353\244-A\344(TB\231"
+	.ascii	"\225\246\242\306\354\301}\016\250hj,3N\234\243\237\315\313TU"
+	.ascii	"\233\002I\336\345\016\226\246,\322\237p\b% P\002\"\205\327\r"
+	.ascii	"\301\271~6\006\333\203\2205\217\266B\206I \207\020)\275\263\210"
+	.ascii	"fH\213\362\340U\f\241\201\2570\315\240\227\020_\252P\f\276\224"
+	.ascii	"\"\265w\274\001\346\030\222\034\205\246\330e \373\332e=\313\262"
+	.ascii	"~\023*\215\311\0355\270\221\027!\003\024\327\024o\3235\204\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_cliParseSerialMode.275.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`v\001U\016"
+	.string	"V[`D"
+	.string	"\223\223\016\370W{\372\221\236$\032[\370\335\377?\263\231\347;MDfd\336\377e\fi\230\250B\230\301\276\205\217[\337\233@R\324\217\007\372\377\327\240"
+	.string	"T\307\030\201\"\3772\2107\307b\022B\366\2262\245N"
+	.string	"I"
+	.string	"O"
+	.ascii	"*\007\242\026/A\016\314\013\212\036\273\253\025\270\310\365\b"
+	.ascii	"\037r=\352\207s\277\"\324\344\374\247\336@\204\243E\362@\277"
+	.ascii	"8<\216D\te\2560d\346\005+\200\347\002IX"
+	.string	"4\035\236zv^(\023c\260\273N\222W\272\261\333V\261\275\300\376\212G\335\232\351\314\3643\002 `J\277\261c7\246\365cWQF\210\243~\233\363S\006\361QV}K{\r6r6\360\330\335\221G#\310\036\323\276\211\333p\3772|\300\256iF\214\335\257\304\006\262G\177\231m\237\304Kpvz\262\200\016\307\203\222\034\200\213\033\0359r\325N\305\263\205\202\034\001\365\224,\232\231\0335\206\353\n!\225\303%}\030\313\237x\212\225lwtR\205lTr\340\361R\333\302\205<\351z\0265\"V\"\005\331\037(\365d\037\256\232l\354\337\177\301f\371\250Y<z\022aK\201\022\266\217\272c\2022\241\243\251\240<H\321:\236\025\315D\304\033\205\023\217\366\3316\217\006\362\355\341\252\311O\3751\035\016\214\210\251!T\205\332\331\206z\03256\253\026\r]\316[u\251b\032q\324x\221\te+\006\035"
+	.ascii	"\3571\346\2107\350\025\b\254\240\207\r\315\260\027\264\016\034"
+	.ascii	"\001\333\001f`\t+\344HB\212\212\270F3\001\272\206\213\254 -Q"
+	.ascii	"\214\212\027\267`\212B\215\240\212\fNL\322\006\261 \022(\003"
+	.ascii	"\362\005fL)\024\024"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.276.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\227%\025\257"
+	.string	"j\026\265>Q FaZc\203\226\326\355\031\261\356p\362\b\205\316\363\2365\"\321\372zh\203`\356K4\266\2001\267\363\234\376\251\220j\252p8\027(\026\330\234\202\353"
+	.string	"8"
+	.string	""
+	.string	"\240^\fjK\324)r\030p\030j\351\\\325"
+	.string	"\373h=7SI\331dJ)\005\341\003\211\003\350\003*\306\250\325i\261J\371;\264Wk\260\316{\025\212\tk7\335l\272\367\272\361\272\355\272\321t\327u\237\351\226\353.\323\235\326\275\326\315\245\273K\267\227n0\335a\272\305t\223\351\037\346f\356>n?\356q\303\243\b\336\033\250u\rw\033\356a\223\344\272\276\031\322Wu\365\270\371\270g\317G\277\316\027\b\237\033\301>\267<\244\236;-5\334w\334c\3073\r\304C\303r\345\246\3534\334S\307o\375r\275=\004\316\234\231\276*n\013\321PM\300\n\214\343\300\235\343\036\271:W+\367\310\r\267\314\371k(n\307q\233\341\2362?.\250\341\373\243\376y\271-d[\255\331\272\255\335\372KW{\204&\241\341\270gL\2775\233\314\004V\023\246{\\\266\214\270-\374wD\377\264b\302P\307\234a\370\215}\271\274\354t/\356\245"
+	.ascii	"\f\020\366\355z_\315\336\225:\026A\211\023\315\366\002\304h\205"
+	.ascii	"\366j\265\323=\274\007\272X\340t5\244\206\365\254\312\373\206"
+	.ascii	"Y\300\345b\001\205\227\356\355->k\226\276\367E\243\341j\351-"
+	.ascii	"\315^\3437\243\020\264\267H;\345C{c\270-4\262\375\323\246Y\300"
+	.ascii	"\276]h/W{\227\200?\352\337\373\242%\265\220M\270-"
+	.string	"D\263 P\251\235\271\251m\326\354\263eWx_(g\302\274/\332\022\027\271-d\264\016j[\350\366O\333\302&3\233\fX\257\225\t\253\007\317-\177\357\3736}\024\327\345\265\023\356\033x8888\330,Z3\220\260\331\334\306\\\230\215\327x\013ka5Nc\021\030\r\306\013\027-X\254P\221\002\001\024'L\034P\202\304\210&\246%\245$\021!\220\216@\030\025}\360\320\301\310\201hH\310\200\r\0322`\270\300]\202\200~,T\2400\241\350C\354\341\331q\207\255\220}or\017\235\254\232\333\270\034\221>\361jfc\207XZ`B)\346\364\211\351\274!\316ktO\2104oa\217h\001\222>\301\240YMHz\225\200\013\322\253,\347\2646Pg\021\3740\340k6\211\364\352\002g47\201D\032F^\263L\244WZ\203\376B\260]\b\212m\005z\013A\261\255:\316\002\220\216\257\240\323*"
+	.string	"\347x\212\277F\200\025\3217B\234\246\333\372c\203\264\300\240m\034\005\233\271,~\202\003\2565m\342"
+	.string	"\276=/\241\327$Xc\t\327'\007(M"
+	.string	"[l+\317G\350\341y\023\323\\/\235Icu\245\244\241\223\210\022\314x\210\242\271\300g\025\251L\234\037U\033D\025\214\033I\271\276t\321\027\326x\347\305?\310y\240\333\352\"\266\345\346\035\206\323:\177|md\177\274\274\3305\335V\033\253d\367\301\222N\303\3059\f\235\346Z8\255s\245\002J\271\3264\321\231\017\235\265\020\2255\232\271\001l\220\007bV\232n\253\214\025\361\366\245\032\346\033\260\264\206\242\233\034\260\fd\3261\307P\241hn\312\205\016\202\245\271\013\233\342\313[\025\222^-a\207b\203VZl\013\314\203\350\266\250`9P\007\016\270\246\364O\t\026"
+	.ascii	"\325*\254\b[\243\340&\254\201\023\330\026fc\0354\335\226\024"
+	.ascii	"\366\323\330\340Zl\253\211\027\243>t[\032\260F\261-)N\024\262"
+	.ascii	"!\241g\350\004\327,\026\2606jw]\212$i\236$\2753t\342\222\322"
+	.ascii	".;Tw\346J\323my\261\036\230l\340\326p\335Al\253\313\207.\245"
+	.ascii	"[\017:\370b\222A\353J\267\226\264\356\373\276<"
+	.string	"E\236\255\353t\205\255\032\2760T@)\327\224f\273\310\n\366\254\036\221>\351\352gED\345\216\024\213\ba\203\320<\341k\270\366\254\"W\356C\247\367}\331\241E\270\232\027h\346\226\231\035\213\231\250\r\377e\316\2240\351n;CB\341\247\\\3446\007V\354\256\017\361Y\314\rx\b-\314;#\274<\327\331u\216\230{\3145\236W\006x\305b\275\261\277\t?e\266\r\320V\370\026S;\323]_\341\177\324\264\231\353\256g\333\312\026p\0252A\013\fZ\244\360}\226\205\331\306\215\353\3548\024^(\313J\024\225C\342\323\023\362fx\361;\316\251\314\0050\345\270\316ns\324B@&\035o\350\2047\306p\346`\323\312\033Z,\263\004\216\350\363cH\304\367y\201\325|zC\211$(\031\241\247\347\257@]\b\262By\276\207\347?\257\314\354*\004Iw[Y\331\225gG\214\205g51\360\206\356\374"
+	.ascii	"\226]\271\nqe\245\331\371i"
+	.string	"\030\277\t\341\275\357\253\324pM-\f_\357\373\246h\341\257\201\016\337-\342T\232F\334\367\025\202\202}\3122\255\211\344G\333\302\341\267\030\030\037\331\231\tw\337nze\320\324 \372m\246\233\232U\246\017\260\317(e\312\026\367\247\334\026\264\355\267t\204w\234Gin\340>q\235]w\324\302\031\323f\024oh\373\336V\226\301\025\313H\227A\373\353\263\362\300\341O\2134;Yy w\3773\210\325\332>a\207\322\316yUq\302\276\201\260\217:\246\001{\224\375\013C\035\313\200\231\366\252t\261{y\363[\333B\274*Ix\tK\270\006\217:\366:9\302J\314\306}_\253\2162\263\223\327\352\245\212s13\233\356\250C\337\020-\244\361\335V\226D+\372z\271\340\327\355\245u\021&y\307\265[S\n\020\036\264\343\\\253I\305\b\357}\235\rm\206\271\316\276\036\265\260i\245\371\2017T\352\201\334\340\372"
+	.string	"\373\234o\305\376\236"
+	.string	"\035\r\365s(R\211'\037\002U\202}f\032\356\344\267\022Djj\272\370\375\263\337O\301 >x\305\2054C@\301\376V\320$s\247\264\360\177\347\314\255<\210\016\356)\334,k\232yC\233fm\013\375}\240D\251t\351h\231\233YZPG\317i\346\030]\007\211\033\251e~j@(\227\251\231i\264\034~c\024\314L\242\341lp\212\026V"
+	.string	"&\367\007'\210\017\n\t\306\001c7x?y\346\006\002\340\r\345n\303R\302\265('n\353\177\312\r\244\355\277\241\246'\304\3470\006/\3003?"
+	.string	"\2017\264\277\341z\2017\264\277>!o\305\214v\345?e\356\2448`\262\360Ca\356\263\356~\322\322v\322e\232;\332]\255\325h\232\373eV\320n\232\1774\233f\252\336k\366!\325\343\234\243\321\272\013\320x\315\ft\232]\263\002}\246\331F\215^k\246\321\\\232g@\311xJ \206S\213i\206\301\343\374\202\307\331E\321\271E\2173\213\036g\025-\327\234\202\350\214"
+	.ascii	"\2173\n \347\023?\316&\336\371\200w.\321^\232I4\230\346\021<"
+	.ascii	"\316M<\316L\026\234\227*8+\025\235\223\212\316\"B\024\235\221"
+	.ascii	"\272\256\371\210\307\031D\321\331\250\350\\Tt\376Pt\366\300\343"
+	.ascii	"\334\201\350l\344q\346\320a\232\211\212\316CDg!\242\263\001D"
+	.ascii	"\347\rDg\rD\347\fDg\fE\347\013D\347\240\2423\020\321\371\207"
+	.ascii	"\350l\201\202s\005\2423\005\242\363\204\t\316\305\242\263\017"
+	.ascii	"\321\231Xt\356!:\363\020\235w\210\316\256\217\363\320\235[\242"
+	.ascii	"\263\220\350\314\3668?\217\263\277sw\224"
+	.ascii	"S\230Y\226\276\307\230\\\211*O\362bfP&\351\225:`\203\274]\237"
+	.ascii	"o\305\335\205N\036\211O\372\026\324\3409`6q\225^)\257G\374\224"
+	.ascii	"\223\240 %\275rl\f\340Y\223\b)s\203'\256\363\345\256L\277\t\024"
+	.ascii	"\020^\223\332$k8<\021\237\242\352\305\264\303\221\276C\007L)"
+	.ascii	"dW\254\267\342\006\034I\3153aR\ts\235\017\026\302\325\371VM\242"
+	.ascii	"K\226\220\274\240\220~hD\013^\324\354\254\203\222$H:M+p7DN{F"
+	.ascii	"\005A\311\b3\204\241/\242$\351\247l\364\314-\246\225\241\017"
+	.ascii	"\\\247\363]\2413ruv]\271\022\361S\366/&R\2537um\025=\254\020"
+	.ascii	"i\332\2053g\346Y=b\376\321\3217"
+	.string	"\336c\300\f\201\003\231\353\364j[\226\246-G\220@<\222\022A4o\352@<T\207\322_\320\324\332\241\023\004!J\375!n\205\372\335pn\246Y[\364F\337\324\334\314,-\213\300T\363\206\202x\366]\362\364A\240\250>\322\3014Q\252\321\013\305\f^\243f1\376E\3525-EO\"m0\315Q#\265\201HC\277A\020\242T\020?e\377\232\313{V\213\234L7\2249\353\263\372\241\341\264\002\037\350 \r}\341}\370\241t\260\212\321\247\275\r\325\3761\303\340\214\301\371*J\276\024\375\324\363\332\303\2674\016\224\020\236\207\357\273>\342\022\374\213\232\265\3270\257\017\035\276\351\230[\034\216\2167KA&[\207\007\321A\357H\255X=4U\333\357\033\002\270\321\215\371\345\375\266\322\307o=\346\253\301\340\031\277\r\023\266\006\360L\251m<\363W\204\255\271\272[\363\211\356\201\351\360\323\350\373\322&\362\013\243"
+	.string	"#\207\3774\30125=6:\224\370|MS\253\231\204\331\375\361M\300=\005\216Ye\016\337i\232\305\022vwu\347\266D\251\bU\b\207\261\271\266gu\310\311\364\321\212\345Y\025j8\r\343\263\230(\303\267\237Z^O\006q\250C\026\252#\224\t5T;\3647\360\240\206\304\204\245!\273\020\002\337\237\001?\345\241\031\rB\377z\n$u\215\256\361B\277\300,j\255\366u\205\310\206\237\262\206\027\262c\216@\202\353\364\264\032/DcJ\347\316E\200"
+	.string	"fL\003\206\032\237\342\263P\270\311!\202A\303\013?K\370\006|\237\361:\346\333\020\234\353\3640c\2127\340\207S:U\247\227\001Z3\374\224\231z\303+\037p\r%0\255\336\320\r\317\302\311\034\277\241`\2629\241\341\333\332B3ardJ}\\\220`h\300\312\234\303\200\306u:\222\2663\270\353;!Cw\341\247\334\235\341\215\035\031\005\200\240\236\304g1\320\323\217"
+	.ascii	"\212\361D\237\225\3411\374\r3\374V\364E\204\227\341\213:8\213"
+	.ascii	"\3437 \245"
+	.string	"\t\030^\310\025\370\0255;;b6\026\364S\246`N\003'\177\264r\241\361Y\b\230\213>\253?-\335\201b\315\362\254\262R?C\206\031T\002o\245>\331\330\206\323O\237\305\354\217\323\037\255e\317*\233\3241>\213\277z\306\177)\021\023\341M\035\373\262>P<cV0\317\252\353d\232\211P\317E\250\347\026\352e|\026\373<=\263\356\323\232g\225\330\r\244\345\342\323\323'\360Y\r\327\335\304m\216\210OR\263\033\343\231%\306\340\201b\235\363\2542\333\306x\247\317B@t\312\230&\225\206\023\235\302\254k[\372\rxfvUj\032\337N\276E\030\030\265\273\265\350\225\017\262\373\365\266S\2768\352\337\213\366\206h\017\264\272\340\355\347B\025)\350/\004]\221~`\001\310\313\322\317\003\375\374\347\2355i\322D77W\300\276\n?\035\3546\035\022\204\255\215\301\261\300\306oK_\240~\026\002l\024\300"
+	.string	"d\030{$\225G\2432\351\303\315LUR\024 \215\311**##r\007\016 8\214J\344\004\311\036F\245\034SRGe\324\004\312\344\214\017\314t4&\360"
+	.string	"\004F%R\202\244\261*JI\"D\262\212GRy"
+	.string	"\343\021\231c**\002\034F\3441\311\303(\307\224TU\025\222\312\250\004\344\030\205T\356\2102RI-\361\3700\035\215\214.\214\307\037Q7\214G\243R\0213\035\221S\310\036I#\362\206\261*9e<\356\370\221\304a<\032\t\261\361hd\\q4\"\036\215,0\222G\024\225\021\251\2142\2260\036\247\242\214\016h\340\243\221Q\211\274\301\343\307\2241"
+	.string	"6\246\244\0340\036\245vDI0e#\003#\247\222SBn\231\312"
+	.string	"8\250\220=l\364\244\224#\225Q\023\034\225Q5\224H\036RU>9\242\252\276j\307\217\250\003 e \251 \240\222\242`\003\202\035\251\316!u\200\251\344\023\017\225\360\306\323\361GT\002\310\0357\242\246\220De\225\214\244\324\224\224\003>\312*\031S\001\020"
+	.ascii	"\211*e\262\307\204\br\374H*#\250\242\242\212r@\231\244\232B>"
+	.ascii	"\200\203\n\t\244\254\352\201\224 \212j\250#Y\365\024 \217SRB"
+	.ascii	"d\216(**d\003UH*\244\222\210\234\222\332\201\344\021\005\200"
+	.ascii	"#\017\034C\306\301$\265\003G\323\224T\024\217&\034J\252&\246"
+	.ascii	" N\366@*\233\252\222IeS\017Z\220v\n\362W\"\330\330y\256\005\214"
+	.ascii	"E\315:\210\r\007r5\272L\300\276\257\024F\223\351\356K\013\363"
+	.ascii	"\2776\367\362I\353\342_L\227Q\236ouF\211\350\353\305\357\310"
+	.ascii	"\351\360\245%\027\"\310\306\220\321\370)\373t\201\252\340\205"
+	.ascii	"s`\364\234f\340\263\030\370\026\357R\2653,\276\205\024)K*\336"
+	.ascii	"P\026\337H\234\\\275U\227\234*3\032\251e\340+\370\316k\002<\265"
+	.ascii	"\332@\205-\257T\221\361\323(\376\301\362\312\267\331i \364\342"
+	.ascii	"\200\3724\324\346\330\241\353\241V\305\347x\366g\327\3252\204"
+	.ascii	"\037\263$s\371\253\314\256e\231\212o&dk\200g\033xRgY\212`\327"
+	.ascii	"u\305\212zR\177/\267\264?\330\226mvJ\256\316%_\226Uo\350\217"
+	.ascii	"o\277\376\001\264C\302#\346\0050\201N\266T/T\363\022EMO\211#"
+	.ascii	"@\302\362\315\033J\365F\037\217\300w\233.\300\263\213\355)\370"
+	.ascii	"3\206\206\025\343\247\354\243\365\361\302+\266A\273w\363\341"
+	.ascii	"\342\353}\205\244`^\302}\227e\231\023x\313\022\276mim\372j!?"
+	.ascii	"\333sY\3161/\321,\353\274\241\313\272\266\205>\276\371\232\215"
+	.ascii	"36H&f\005\0348gN?\305\300\205\275\274k\231\227y\313\275\272\277"
+	.ascii	"k_\340\314\3136K7r\256W0H\374_\261\335\251\275\370\251\323O|"
+	.ascii	"\307-\027\260\224\203\342\231\227\200K:hJGx(~\347O|\177y\n\022"
+	.ascii	"\275\211\307\021\205\310\335S0\b\325M\030\027?=\340{\352\326"
+	.ascii	"\350\250\351\225\370\021\177\300\367\363HR\023}\211o\243\020"
+	.ascii	"a{\216\271\362\301F\223Z\265\370)\013\365V\360\237-\003{\214"
+	.ascii	"\361-\007]'\373w\324\302\307\242\202\237\312\264\252\032\273"
+	.ascii	"\373\273r\235l\234\243\026.\360Yt\324\362\032\360\005\276\343"
+	.ascii	"\036\013\023+\350\351:Y1!\352X\350u\206o;!F\374V|%I\243\342\241"
+	.ascii	"\214\370\277Z\253SKa\2013}\307\271\357\033\244\241MYL\f\256\350"
+	.ascii	" \342\0315\375\316\007:\210\275\306\364%\306\354\310\342\336"
+	.ascii	"\nS\013\303W\021\327\311~\031\2513r\0252\204\022\304\017\001"
+	.ascii	"\030]L\304\254\336\324\r\211\242\006\205\211\326\372\327#Jj\033"
+	.ascii	"gi^ux'Z\353{\256\3319avWwkIh"
+	.ascii	"\342\364\231\370)\0303\213\320W/\031\263\262[<\230\036\360S~"
+	.ascii	"\254^\372\226\"\371\203\032\250\022\331$\220\302\034c\n\315\214"
+	.ascii	"\310H\222$\035r\n\020\006\243q \346\264\007\022\340dE\211;e\246"
+	.ascii	"F$I\222\354\214\001\305\351\332o\277l\245\2218\025\377Oq,*\203"
+	.ascii	"B\035\260\\\272\036\001\201\"GW\374\370\301"
+	.string	"p(\273\001\275\373\022\007;\332g\265\255y7\024\354\f_\247\226r\234n\267?W\024Y\371\020\253`\324\234\030\215{<\257\034\303Ox\331\206[\306\315\317\277\361D\346\205(\337mG\325\201\241\350I^hg1\252\211\266'\373\275X$h\016\020\214\333\027\271\226\207\313\212\352\205\025D\n\206\250p]\2246\216,\232`\360\311A\320Ja\261\246d7\242\264{\016!\350lt)If\267D\224\0067\t;\357\260y\257V\261\241\007\275M\377\340\004\354\3253\214j\362\213\340e\275\002\005\324\007j\351\3072r\300\260\t1)\355O$\216\224l\367\321\213$\247kr\332\260\235 \\y\233\215C/O\2225\032\343=m3\344\340\267\215gl\375\254y<\342\2104\310d\302\230\212\326K\301\211\320_\353\020\235\203\250g\232\006\025\351w\350\227mA\222\241\215C.(\334\373j\352\351$\352+\001r\274\241\351"
+	.ascii	"h\224U\022\306uEn1D\240>\271Mg"
+	.string	"0\372\314m\2334\313F\220C(\031\233\307\324d\305t\210\003\036\336\034\325\367O\271\030n\274\270\\\005\346\336\334-\001\346\362\030\373D\264ch\224\233\242'/tQ\367\214\243S\177\240\034I\001\270\274\370]\370\221\013\305#7\334\326Bf\2566\250\236\357\b\3136T\247!\264\214^#\214\016\310+\230\310\302\204\225\302V\346\233\"\312\245\2357\305u\353\242I'r\t\177\247ud\222P\275\336\225\222\362\203&v\201$\322?\216(\2009A\336\031\205#\2663\256\220,\036\0075\025\234\257-sk\3404W^i\2572\220\210\3235\342*\031*~*\360M\240p\241\213\362\376\n@\026H\311A\203\360\361\344:\215\242\272\003\024\201\024\223B\350H2\260T.\"m\245;\306q!\210\324Y\322X\021\025\334%dlgy\362{\224-LA\177\317^&\201\317\262\303\325\202y\003\244\213a\320\021\331\315\251\237"
+	.ascii	"\327!\255\265\231\006\352"
+	.string	"(G\324\375\201\267\362\t\364\234\200\216\037\n 'a\326\320\243\204?\337Q^\371\n\202\335D\316Q\035a\324\254\bX\025\341\333\221>\026\270\n\242\361\004GAyR\305\375Eb<e\336\262\3565\224\217\316\231CM\231\203<\030\352\332\310\342K0ZZF\002\023\343X^\313Y\214\333u\247\240\030^\362]\303\031b\320\207! A\274b'\337@O\230\215\260\353\372\216[3\235\216~\311\024\331O\356\027\005\220\002\013\214+kIS\360Oc\315a\216\235\023\301s-\013&\227\372\304\265t\345}d\377\240\311\353,*\017 j^\013Ko\244C\b\3432\347\251$e\244y1@\261\007!e\317\277\035[8\223\361\354\025)\304\235\207\200w\222\230\272\017>\315\022\n\020\316\247<\324\330\037\256\337$'&/\232\261\226Gxpz\354\316 \214\017\251\337\002T\267\0077\277q_(\001\365\206\021\\a\303\202"
+	.string	"\bm\210\016t\346"
+	.string	"\035\367~\216'1"
+	.string	"\35592\244\230\021\330&\373\003j\332=\362I\311\264\333\243\320\\\013\246}\206G\267\224\327\256\326\370(\f\013\263q\031q\027\274b\245\031\305UKP\246\001\n}\315\332\017\020RA\275F\352\326\223}\346C\361\233\372,%\257\211\263d\235\2500\003Y\217d\037\017X\360\242\243\221\013|\331q\013\343\242\020\227w\244<\336\036\200\361\013\332]\223\\\364L\247\221\345\307<\007Mam7*\246\304\376v\343\312\363\f\200\223Lg\305z\340,yvZI\270]\b\366\235\320\312\206a\362\034\320m\021*\264\272\231\3512F\320U\222x"
+	.string	"F\362\355\251\370Vfz//H\371\031\032tE\254\303\372\223Y\325Z\331\350B\345EB\006o\214\202,\005\270i\310\306\361/\230\364\306\230\204\020\b\216*\306\224\245\257\311\316\210\0063(\230\241Q\320N\324\022Y\366\027[H\017\231_\241\252(\275\221\007\272\246\225\311\034\314\360\313\341!\360\242>\316\344VT\330j\344j{\316\030C\022\360b\b\210&7sS\335\026\360\037\215AG\376\327\240\210\376Q\247F\344\004\247 \211\266X\001r!\236\271\213\305\224Y\270R\277_\366\ff\313Dv\364\245\243\200\336h\216.\312\034\247\3657\3338Y\236\361\274\326\274\251\030{\367\245]\f\337\177\214_-\3769\314\212\264\351>b~\005\026\"\303\352\301\236\355\371=l"
+	.string	"\262\020(\260\265\265!\323\201\215\003\217\217\2013\324\344\002\232!i*\274:\212\366\327R|e_c\376<\301\237\036Z(L\b\260"
+	.string	"\245\337\326\224#y\226\226k0e\347/n\227y\361j\344\t\304\377\346<\t\273rd_F\036\345\363\313\032\243\004\310h|\025\366c\306\205\310E.\371\337\363!\021\354$R\357y\313\030yb\200^<hr\260\351L\307\237\234\004\336\247\367\342\377P\361$\260\203"
+	.string	"A\0160\027\372G\254\t2R\323M\316\245\374do\202\221\007XB;\206\307\224\371\022\355,\001\306\033iD\320\025~{\021\207^\307\304\346S\241\342\001\220\256\345S\213\244\250\376\\1\322\324\3130\345ap!w\366bv;\210\271\372\261\306oy\271\027\bM\263N\036[\272\207\t\236JeT}\326`]\334G\006d\2454\337ae\024\376\r&L(.\004ss\240\240i\026\325{m- WCnv\225\251Xy\020\270\033\024\340\316\252\261\245\376\027\354\337uyN"
+	.ascii	"0;\366\364\353\tw\344\257\006\310\242y1\2168^\332OF\2747\266"
+	.ascii	"m\207\274\357\342\265\314<\024\343\374\260\331\220y\006\363\316"
+	.ascii	"\216\300\212(8\004"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.277.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\213\b\205-"
+	.string	"\212R\330\021D`\236N\007s\023\334\251\222\366\f\220fM\377\270\255G\367vE\337\200\";\210b\350z\275\240r\240\345\202\341\300\r\367\220q!NS\247\344`q\376\256/@\362Z\260HO\312\267\317d\354-\367\336)\245\024\f\001\355"
+	.ascii	"\022\001JVG\340\035\026\rz\307\244\275ts\351\256\353\236\353"
+	.ascii	"\223\271\231\333\216\373\216\203^\206\344\320\370\212[\270\273"
+	.ascii	"\364\222\203u3N\026\210\222\335!$\207f\007\243\001\204cs1\n\221"
+	.ascii	"JV\307]C\023\263\245\266\026n:\0166\312\314s1\204cJ\366\254g"
+	.ascii	"\017MK[\035\226UF5\312D\265\321\0162\363\307\311\3102'\002\356"
+	.ascii	"\016\226+\333\312\261\257\3140\nb\307\260(\221R\033e\245\332"
+	.ascii	"\316\334m\355v\3547\032\274\262l\0213v,\253\224\342&\265Qa\023"
+	.ascii	"\245\215\236=\2246\312G\346>\243\033,\362\001\223-\231\245\016"
+	.ascii	"\313\262\303_c\245>\225\315\251\037\373\246\350\371~\344\226"
+	.ascii	"\353\245\026Pl\217\356\f\331\367t\034"
+	.string	"]\220@g\311\363\n\320I`\323\211y\332\323\304G\243=\372<\223\362\314@\001:\273q.\245\021\331\322\313v\263\2631\377\246k\250\266\f\226=\2723\037\3557\213eY\366\262\263\035\315j33\020f&\302\254b\bv\330?\302K\370\023\f\331\223\236f2i\277\177\2239\021\363@\236\372\376^6\372\327\342\211\355\311\345\261\341\201\357G\345G\363\331\307\037|T;xf\257\025\336eTO\224#\n\333\374#{$\263\022\351\217\204\271\203\340\370p\360\037a\316\272\262j/\315\023\032\256\273\252\353\232%\364\225\356\bT\035\327\375\240\337\272\0354\227\346a\3175OIu\\\363\202\353\034u\235\241Vg\005\3279\301u~\272\316\bVg\247\353\334t\235\231\256\363\322\352|\340:\013Wg\003\327YiuN\272\316H\252s\201\353L@u>\272\316F\253s\321u\036p\235\211\256\263\200\325y\350:\013]\347"
+	.ascii	"\3279hu\006p\235\201V\347\237\353\354\263:\007\257s\217"
+	.string	"\352\274^gUu\276\3279E\235\321\353|^\347O\235=un\nU\200byp\314%\277\0279\n<V;\247=z\002\237\256\t9\323W\"\307\021\023s\311\246\346\346\250\320\325\357y\237\007z\241\037\360F?\365\334o(\\#]\244\250\265\261,Y\227UP\311j<5z\376\205\f\336e|\262j\217\344\2427\322\320m\264\212\276\330\262i\337l\254i\242\037\320y-\340\211\206^\300\206\336\323\033b3\026\340\205\310\324\216\232\301\244A\037\340\037\217\314\311\007}sh5ZS|\334\241\323xh\364)\t\200\357)\255^\373\363@ \372\314\317\027[\275f\360}B4\236V\260]\277gD\223Y\277\330\3565\337\356\253\177\327\322\344\222y\230I\364\230\022*\313\216Qq\2079\226\231P\331\032\275_\365&\310\233\217K}\372Wo\034\202~\372\215~'\277X\375\371w\r-0\031\325\377V\377x\311;"
+	.ascii	"\336_z\302Kx\346\255.\357\262\377\207\243\207\007\215\177\325"
+	.ascii	"O\370\276k\020rh~"
+	.string	"dO\304\034\007\0355\273\263g\244U\217\224\346\207d\346\271\031\363\314@ht\022\202\251\340\"2\201\021W0\242[\bcA4\302\350\372\361j\260\"\b\024_^\\\304\256\024=\024\212,\214\304\023]\\Ea](\276\210\037\212_]-\212aF\025\\\304\240\025aD\016/Z\030\271T\336\232\362b\2615\374\362\"\266\030n\201\205\r\247\210\330\305\213.\260a\321\205\013\260aP\311\366\037\221k\265\316\rM\363\317\306\213\335G\302\353\0244kec\266\311\245\263\031\237\350\202o\271^\2230\245$\227N\365Ro\346mi}D\372dY\226M\037\t\277a\276%\227\247\225*\207I%\271|nc:|\263\276\353\225\217Y%\271<\257\236\317\227\372\005o\306\334\035#\235\372\254o\272F}\264e\260\354\305\t\235\300#\275\322\013\277\351\023<T\324\321m\370Q\337\311<\n\036\352\216\226\202\307j\373\232O\237"
+	.ascii	"\301?\275\343qz\004v\232NL\337\264\364L\357x\016\374\022\240"
+	.ascii	"\226S\022:I|\007\276y\264~M\003/\224c\240Mz\2458ZI\217\325\312"
+	.ascii	"i\026x\244\277\200\230\250a0\006\221rfDD$\030\3214Ic\260\002"
+	.ascii	"\2211\252y\021\0209\207\220S\243IA\2325\032\001\3756\263\006"
+	.ascii	"\243\350\004\354\275k\372\306\3042\020A\204JP@\213Yz.r}\1770"
+	.ascii	"\254\006mt{\322\332I\371\001\345\330\013I-bb\007\222U\240\201"
+	.ascii	"\024l\021\\K@\305\211\375L\256\353\341r\002'\360:\024\013\240"
+	.ascii	"j\343\233\262j\312K~\336\226\003\311n\244\233y~\311\321\201\020"
+	.ascii	"\r\312 \307\016\204\013\002\257\334\002T\024\247\323\201\305"
+	.ascii	"\332\001\300\264\r\376<5\311\253@\344\303R\230\222\212\253!Z"
+	.ascii	"\251\262\324\214\335\274\232'\013\375HFp\327\342$\343\246\262"
+	.ascii	"i+E\373\325\363\347\346\337h\276?)e\251\221HE\323\033I\251\272"
+	.ascii	"NP\235\271\247n\351\300\"\274X\245\302ujy\366H4}8P\023\026\203"
+	.ascii	"Z<3\273\3615\203\315\356Y6\265Y\303\303\340\313\221\231\"}\021"
+	.ascii	"\350\361\250\363\256\253\241\223\031\344^\b\360\212\n\016\216"
+	.ascii	"x2\\\007\233\274\341\\\330\355\256$\212`\004\300\356m\033\337"
+	.ascii	"\202\361_\244\230\275\242q\276\346\357\275\275\272\376\364\232"
+	.ascii	")\025"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.278.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`<\001-\016"
+	.string	"\206\232_E\020\221\223\016\360\003\231\257['\320\b\216>5\253#;\236\004\033!\334\367Mf\2603R\267\346>\260\273\265\376\237\363\306sk\300@l$\322\325J\205\027\001\205\202\005A}\2412\350\245\222z-K\310\336r\247\024J"
+	.string	"I"
+	.string	"L"
+	.string	"\237\006\337\271>7\027p}\272d\317\020 Y\223\202\0314%04\273\233i\210\227>\245\306\222o\372\334\234\\\002\370N\256\362@k\005\215"
+	.string	"_JvT\"\274\277<n\370P1b\036\273\353\350}\035\356\353\266\031\330v`\377\013)5\331 **\b\373\032\206ahE\261\337\362\313\203\277\312\350o>\323Be\342\341\037T\354\252\302\033\313\232,Vl\337\031^\302\tF\204\234slGP\203\215\216G\373,'Qz\313\3109vQ^\310\354\202\bl`\023(>\n\223\262{\272\367\225\335\361\023\032\346b\242\"\203ew\027\230x\314\346\253|z\002\027\357q\327\347o\341\262\273P\274\347\307\300\bY%O\251i\311\2501\\\327\b\253\030\251Xc,\252\332#\221x\357\372\227\237C\n\027V\215V\246\340\031\221@[G\032\211T"
+	.string	"\371|h\242L\223P`\003q![\367i"
+	.string	"\322i\2305\017\027\242e \356\323e\232h\224y:\016]\330D\031)\024\022e\034\360t\217\223\242\344\356\356\034\020U\245\332\017 \314\350\202D\265\"9\242?r\371\037\327W\017\034"
+	.ascii	"I\231^\t\377.\206\314\320tF\316\037 d\202\200+D\033\315\260."
+	.ascii	"\270\2225Hi\023U\362\005\001\022r5\0214\330\342\256\331kD\263"
+	.ascii	"\302}\240\032\270\002\346\006\250(\343n\276\231]S\223k\\\n\n"
+	.text
+	.section	.gnu.lto_printMotorMix.279.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`M\t\2751"
+	.ascii	"\nY\230\023F`\232R\007;\301(\333.k\342+\344W\255p\017_\217y\332"
+	.ascii	"\237?\250\224al\263\210\211|T\343)Z\306\3365\361\205\036\272"
+	.ascii	"_Xy\\9p\035\032\007\233G\275$\264\247a\327\235g\237\357Zn\211"
+	.ascii	"\335I\246\024%\001\025\001'\001\030\217I\326\255/\347L\345t\355"
+	.ascii	"v\375\3265=se\2571\226\235\366\345LUr`7]\007\272\277y\325\343"
+	.ascii	"|\256_9'SS\312X\300Q\265\271\253\315>!K\341m.\245\312\335\250"
+	.ascii	"<?\263\213\315J\373r\326Rr`'\257\274\335\037\005\306\232\230"
+	.ascii	"\b\265\273\n\230\352P\252\034-\2061'_\245\331@\340:\260\251\256"
+	.ascii	"\343n\237\272Y\225\237\311\350a\316_qr9S\021\264\221\353\300"
+	.ascii	"\243\367\004\035\330\372N\320\201]\325M\306H#;\035d\215"
+	.string	"@\327\322\344\234\221\037\326\256\267To\"\256\362\2278t\205A`\373\270\252}\316\211\244l\254\256n[N\177[\341\r\255\036m\2042|^ng\205\211C\270\274|(\274\360\305\305\303\335\241/\256.\027*\321\352\302A\234-h{\264:\316\332zb`\273\303\003\316\352_\264x\264\007\254K\274\336-\032\270m)\2309!\342w\216ol]\265\217\306f\305\225h\365\300\357v\016\f\223z\231\372}qy9\026^\31097\306\332\342\362.zw\347u\267\225n\027\032w\336\252\221rI\273\262\265\231\201\377\236\355\206\337\334\177\264\233\352\304\0176w\246\206W?X\367\003\003~\346^\300\267x'y\027o$\307\363>\362<o#\327\363.r5w\"\257\342=\344W\274\217\236\305[\310\321\334\203<\212;\320\213\373\307\353\274\215>\036\305[@\021wO\0217O\021\367N\021w\200\"n\235\"\356\234\"n"
+	.ascii	"E\3348/\356\033\"\356\"\021\367K\304M$\342\036\022q\273D\334"
+	.ascii	"B\"\356 \306\r\034\342n1\356wqc\027\267K\230\300\306*O-{\344"
+	.ascii	"\257\324\214\343oM\366\002\244C\342[\334\273\270\343\271\347"
+	.ascii	"\271\353\271Wq\277\342\236\305\275\316\335\315\035\316}\212\273"
+	.ascii	"\234\337t{\267ki\347\342^\374\213\203qk\277"
+	.string	"zU'yS\310\306\\\2748 ]\226\307+j\036\303\t3\243N\323\344`\360\240\312\267\2708:\251\031\307{5k\233\246\311\231\372\244\322n\305\261\370]\277Y\332\334\351^Y\266\271\315\311\262R\310r\3161\334*\313\335 B`\307\302y\337\343+\363B\343\235\315\203}\376\346\013|\367\210\022\330\261\f|3\310\363\235]\374\233wh\233\244/\2760\314\254\013\324\353\347\223\036\263\201\006w\270\037m\361\364\270$\021>\230\032\177\037\003\361\207\377>\201*\264\013\351\207\236\370AkP\272\243?\376\360\007T\241\356:\322\366\336\202\037m\026A\367q\254i\302\017\276\373\302*\264\313\350\205^\370\306*\264\350\333\017\2767\221\212I\273\262\321Y\341??\244WJ\305d\227\276&\206=:\263t5\254\005\243WJ\257eg3\360\237\231\245\2531\235*\024=\320\036\321\003\337\255~\"l\312\367db\205\215@\353t"
+	.ascii	"?\332\216u\242\007\362a\306i&/\214\t/\263D\"\030z\022R\275\262"
+	.ascii	"\023\316\267t \206=\372u'}\314\022\211M &\364$\244`\312\316\216"
+	.ascii	"`\241\321k?\332\313\356\306E\355+\323\366\256\260\232\356f\362"
+	.ascii	"0K#\261\234\257 \264\357\275p\n\302\216\305x#\"g\370\203\376"
+	.ascii	"\337\237Lr\274\357\202\376\370\375\251\304\n\377\265\361\375"
+	.ascii	"=\275<:6\035\035_<EE\361(W0\337\"U\022\0061\303\022*\331t\341"
+	.ascii	"t\003\005%\245lW01\237\246\200TI\030\377\344\n\0260h\220\242"
+	.ascii	"\211\242U2A\250h\361\324\224tZA\304\300\204j&S85\371(\235^<-"
+	.ascii	")\245\230RKQR\314e\223)\207\3052\2714\025\325lr\233)\301\023"
+	.ascii	"\024\023\262\305S2\n\311\244\\\"\023\364\264\324\224\223\022"
+	.ascii	"\311\224\222R\"_j\366\007\353\016\177A\374\372f\274\225\033\034"
+	.ascii	"U\233\363\227\005\227s\237s\235>4\374\347\343\375h\017\213\f"
+	.ascii	"\217\236\340\316\352\241\200\357\026\003\275\317gM}\360\2659"
+	.ascii	"\347L\374h\273\325\207\330\354\0354\3165\360\335\266>/\300\275"
+	.ascii	"\0314\376\203w;\377\300&\275>\177\020\300\001~\347y\276G\311"
+	.ascii	"1\314\265=qB<\325\343\216\026\177\033\n\240#\205\317\n\266\016"
+	.ascii	"?\332X\250\3448`\262X\240q\301\003\376\363Y\335\0040\316\003"
+	.ascii	"\370\234\327y\3437~j\020\n\3312\3751\315\371\351X\033\334\247"
+	.ascii	"\247%9\360\207\303\022v\254ns\217\271\"\2358\243\234\352\021"
+	.ascii	"\200?\032\261_\375\315\203\213\205\364\001\200\263\250aT\204"
+	.ascii	"\020\"3E\"\"a\202\264 \351\300"
+	.string	"\002\021\252\252t\020XEU\222BZ\003\366-\353@\\\371@t\316\330d5*\273K\200\246\344\025\246\357~\204\311\r\200\322G\3646EX\322\004a\211.\035\321\007\030]T4\020\220b\303\226\017\322Uu\223\355c\373\337\357\3249\211R\201\227\276\006oD\307D\001\033\003\235CW\373\222\326\311\363\307Xr\333Gv&gD\307\2404\331\200Q\304\033\207\314\376C\204!\204U\266#\023\301\222\255\225%0\013b\253\307\240\254y\367\341\215\336\033\025\022Y\333\315\256\327lA3\223\r\223_\305\322\266\324\233\322*j\273\325\247\241\372\335\314\f\314w#1\353\370\334\353:\004]-\276\360\237\020\372\306\363(p\035\310B\311O\371\356t\034\215\234\302\2321\323\274j\331h\306\252\n\224\366\254\277\327vu\"h\261'\374+\337\252\252]!\315{\353\320)N\344\343\203&\244x^B\020K\016&\221\266@\ta^"
+	.ascii	"\257C\235]\305h\361%W\332m\3739c\352\264\240\237\256\271M\r\202"
+	.ascii	"\273c\324\322u\006\026\324\313\350\335\202\204\260:e\306N\224"
+	.ascii	"2kQ\207u\344kb<\026\312\256\377\260%\250"
+	.text
+	.section	.gnu.lto_cliMotorMix.280.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\337\f\rB"
+	.string	"*qT\031@@dN:\217\357\241\200\022\032\250\366\360\351\233\255\312\352\016\326\325\360"
+	.string	"\262B\221\203\212\333\365@\264\217\255\254\205kv\200.\024\247_O\330\237\370]F\346\3071+]\331\377\320\261I#\204\354\235d\177\001i\001\207\001i\304\300\273:LG\031\202\334M_x\263\326\336\356\316&\366\327\234\215\3736\355\367W\355}\021?S\245\364}\337\256\366k\225\252f\310\323\033}\237\3666E\"}\337&\203\257\315\325~m\n!\324\340\270\373\314\327\271?3\344P\357\373\246\307\367\276M\007\215\240\375\332\315\037\331\257\355\215\354W\267\333P"
+	.string	"\263W\214\253\221$$\033G\357\373n\345\270~\343\356\226\355\251\253\315\267\222\352\236\300\200)\001\001"
+	.string	"H\035\243\214E\250'\247&\246%\242\322\260\025\262+\225\232q\001\267\357\374\201\2725v\201xib'0`J\200z\354c\205\320\243\3132j\226[\236%dp"
+	.string	"\272\003\240\363\202\245\272\374\330\205\013\216\332r\343\226>-\270\230\345P*\325\337\2361\217.\263\250\007\242P\311\373\334\022\013~R\217h]\222\217.\315\250Y\322>F\357\223\303NH\274:\314\351\0255(o\022\346\341I\202Q;\223\333\334\262\r/\021\343\360"
+	.string	"1\247D\365B\035\035\226G\227Q\324\254\306I\347{lX\t\312\207{\267\212.\231s\313'\270\215.\245\334y\253\271\345\032\026\252\302$K\300G\227L\265\013\321!(\3173\303\254\022\230&_\333&\247B\316-\353\260\372*j\314g5C\336_\226\246\2642\365b\242\314\271\363X\231F\206q\361\005\204\032\336\367m\253*jg\336\006\336\215Et\267\221n%I\001\177\223\312\241\312o\315\3408\023\261\013T"
+	.string	"\257\357\300\336\315\001=\264\037\332\263\026X_A\210\300O\342\034\205\246d9\225\236Uh\323fO\315p\335\035"
+	.ascii	"\367\207\260}\022\354\357\336\307\004V\004\350}\307\236\374]"
+	.ascii	"w\203COdc\237'Y\222\371\276o\327\236\363I\321\337\362\265W\260"
+	.ascii	"\300O\262`\277\376-\330n\027/\360\223}\347\177\344\251\344\235"
+	.ascii	"J\221\227\313\023\223\367\236\340\016\323\237\277\343E\264\362"
+	.ascii	"\007\220\033\363}\317\236\374j\3174`}m\265\200\204l +\373<\330"
+	.ascii	"g\030v\202\312\360\243^\302\006r7\230\r\374\344\363\3223M:\225"
+	.ascii	"\226e\261\356&\331-\034R\023\303\031\256_\300j\212\242$\235\337"
+	.ascii	"\272-Lx\363\227\300\005A\313A\326\002\005W\363\276\372\231\337"
+	.ascii	"\352|\357\2527\337\006Z\334TR\307{\037\243\214\305\267yC\rq?"
+	.ascii	"\rq;\rq7\rq3\tq/]\357M\024\342V\022\342\036\036w{\334l\213{\025"
+	.ascii	"\342V\205\270\263\0207fq\037\003\2065v\177k\032M\312\201\315"
+	.ascii	"\027m0\322\013]\341x9\337\257\367\343\375j\3766\007\254Sh\355"
+	.ascii	"P\035\037\207\323\027\030\255\0059\234.\301\224D\327'7\275{\366"
+	.ascii	"\032\347\017\324\215\271g\204\3204\213\217\277\351\n\314=\272"
+	.ascii	"\356\273\351\3475\361+\336\217\252\262\346\033U9\333\001j\261"
+	.ascii	"\323\263\224\2532\366\263\200\r(]$\370\311\245\374\276\337\t"
+	.ascii	"\332\223\345TZFe\n\027\247\fg\350Ry\202\2118<:gnwmo~M\352\222"
+	.ascii	"T&f\345#M\265 \237Kln\273p\233\377\304H7-\201\222\366\f\b\226"
+	.ascii	"\313\304u\342d9\225F\300\347\303e&\324?|\335\r0\331\036<\246"
+	.ascii	"\304\346\266U\231e\261&f\245L\214\313sN\355\265\t2\r\363\347"
+	.ascii	"\2502\233\271\206\305@\211\370@\317\262X\177\360\215\207]3Un"
+	.ascii	"\214\\#\313\177\203\324\270Yz\200\377\274$\227\n\027 +\355Y\r"
+	.ascii	"\254\257Vpn\234\324\223Is*5#\260\244\216\216x\247iB\246z2\351"
+	.ascii	"2\274\364RY\311\346\317\225\370#\027K\373\276e]}G\237\272ZT\227"
+	.ascii	"\213\353\205u\275\260_\331\374\275\253\223\230~S8cxP}\2610W\030"
+	.ascii	"w\f~r\315\330N\2428\320\tQ<Y\206\177\347\312\331\356\217\025"
+	.ascii	"\004.\031\327\f~\222+?\321\031h\327;\346M\233\341TU\320\255s"
+	.ascii	"\321\264g1\324|\347\213i\022\325A)P\361{$\314p=\024\264Z\310"
+	.ascii	"\353#\252V\342*'\276)\242\210\315p\377\301\036\263\205lt\336"
+	.ascii	"\3619"
+	.string	"s#\303\203\335\317\253\356\r'\324\317\241\240\037\251\333\204\353u\003\371\240\023+\224X\240\0132\301~\225 \347h\f\017\3661\347\374\274{\210\273\013DN\032\303\203Y)nm\312\032\255\242\003\207\021\037\330\346\221\240*\306W\214\027:B(u\007\021\033FTq\370\020b\003\212\021\037\230:\306\013\0357\326\356\361\305\343+\214m\032Za_@\300pl\365\2401\003\354\206\214\251>\330mx}\321\360Z\303z\354\310_9\300n|\341x1\"\006\016/a{i\201\335\360\332\312\001\366\002\307\226W\030\217-\255c\353\330\361\025\266\325C\207\216\260-bs\354\371\315\b#%\320\261L\206F\300\003\0262\370\341`-\036\270\344N\206\365U\220\310\242\246\247\024\276\251T\002\033\226\001\377\373\243\177\034,\027\247\273\001\216\273\362<\027T\004Ef1\004z\244S\034\260\325\224\b$|'\210\250\235qL\004\264\355\001"
+	.string	"!\267*e\314QY\251\276\375\330(4\001\214\031\302\241'I\230J\340\0279S\244\350i=e\326\216\240\035"
+	.ascii	"mI\216\016r\253Q\305l\324\312+Y\240\227,-?\251bv\220\211\316"
+	.ascii	"=\247S\356&2\210\331\"\371Ay\242'\313)\263\201\004\321\0343\\"
+	.ascii	"\263\2351.\310\255\026\241r1+\263 )\3102\023\225\341\032*/\310"
+	.ascii	"D\247^\223\030f\002h\316\022%~\n\2322\333Gp\214\261\357C\272"
+	.ascii	"\351\036\362\t\325\340w\276\3653U\"\237O\f\016\225\225\n\002"
+	.ascii	"\257\024\200)2\345\356\r\030\255\237\3040\200b\350t\313\300I"
+	.ascii	"\002a$\354\242d\242\f\370\312\314E\342'\231\2620\215 \033\264"
+	.ascii	",\n\006\352*\257d\200a\2562\266#\350\004Z\226\305\232\220\231"
+	.ascii	"\331\223\360?\330\201\003\250Q@#\021cfDDF$\005M\322\001\261\005"
+	.ascii	"\004\031\305 4\017\021P\255s\214J\222$i\016\357\332\357"
+	.string	"\003\337?C\311Wn\374\200\377{\021t\241\306?\243\303\222\251\323\202\352\205Z\203\235_\323vA\362\264\002\204\202\023\220d\332jZ'\365\2768\264\305\354\360h\025\017\033\3141F1t\351\355M\2605\035\220>\033\013\313\337\036Jg\2721\200\ri.\200\004\237|4\b\374\354 \372\274\306\2672\267\274d\206\254e\233\241\262D\316\020\257\006p\241\204\361\303\231\210\363\336\007-H\031\312\3717`c\210\316h,\336\246\270\364\257\256\347\022\234N\215\306/\251J\206\",\2043t\352\275\002\354\3453d\216\343<\244{0\257$\345\236\300K\\X\310\007\023\365R\252@\3055\265H\253\372\344\013\"\222\316\320\024\240&\263`\026b+N\214\245\273DHB\b\217\007\031\332\022\341\001PZ\273\001\257\270\035\200\340'v\007E\221.\275\004K\035\r\t\033\254\354\001X_\215:J\310\036q$\220>\3400\024\330.\003"
+	.ascii	"5\355\222\240\013\257\"(zJ\235hk\037\235\346\324m\354i\200K\311"
+	.ascii	"6\352\346\347\353\266\353y\214\247\244S59\037\223\275\300r\007"
+	.ascii	"\005\005\272p\333W\022\027\302\r\337\305f\346\325\205\357\325"
+	.ascii	"c9+q\025m\274r\301"
+	.ascii	"\317\374\237\343\315ys\035\335\206\323\260\021f\375\207\352\241"
+	.ascii	"\f\366\n\277+\321\2013+;\024F\0056\031H\234\350J\333`\233\305"
+	.ascii	"\360\007` \201\2225\213y\341\024\t/\023\210~_\270SE4c\034\034"
+	.ascii	"*\331\251\255>\"\265M\212\324f\244!\360\272K\f7DB\r\205\030F"
+	.ascii	"\371l\3568\276\343\253/B\032\005\255\302\253@#\372\264\276\005"
+	.ascii	"\037e\267\t0\330`\t!\266\264\315I\032"
+	.text
+	.section	.gnu.lto_printRxRange.281.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\017\005]!"
+	.string	"\006\276\330K\220\026R:\200\337s\225\336\372$xA_'P\301\2420\322\225\002xa/e\304\023"
+	.string	"~_\342l\0303\336\260\333\211Z\350\241\354\377\352.\334\224\300\034\267\n\340_\314\304\311\242\315&\313(\005\3700\353`a\255\021B\b\221;\311\300"
+	.string	"\273"
+	.string	"\304"
+	.ascii	"G\262\355'3{)\341\232\216\267XS\"9\303:\273\367\b\364\223\211"
+	.ascii	"\324\237\2671ss\211\030\303\260\025\344D\003{\374"
+	.string	"\217\340\201\214\310\221\271MZRA\352O>\252\267\314\307\2721\370,\022L\273\227\006\221\260{\217A\334\243\376\304\375\206\3764_\203\376\344 s\225\234\022W\210`I\\\203\234\335{uM\305\346\315\343\031\265\301\247\350i\266\r\362\273\2363*aR\"\213\302\247\346\213\331\216\0271\305\325<\020\365ev$\223EkVP?[\3344u\312\230\360\210)\2260s1f\f9\330-\261\330d\373\310\0230vi)\221E\250\333\224\301\275\227\255Sq\305Y=3\273`f\023\314fY'\023\212\235\231=\305\037\201\342:\206\224\331\214+eR\232\254\226\216\3722\263j\266Y\235\006\272\200f\366`d\357\264\323\267'+'Y\254\f[\310|\024\332\2362\333\021\025\306m\203\371\247'w ?\317\267~\334\316\271~\235g\375\002\376u\316\271\327\031\347\346\\\347[j\331&\265\\\243Z\246I-\317\250\226e\254e"
+	.ascii	"\250\345\030\3242Lj\371E\265lK-\327T\313\264\324\262zZNS\313"
+	.ascii	"hj\371\264\226Mk\271Q\313\026\265\374\001\013\2240\225m-Q\264"
+	.ascii	"\362x\237\272l\271N\316\"9\376\365{1\177\b\037\214ml A\360_@"
+	.ascii	"\234\360x\237R\252\261cO\275\020\0165Kh\372PF1\231\236i\224*"
+	.ascii	"\311\0212\r>P6\354z\252d\332'J\326R\3634\200\376\360\352a\207"
+	.ascii	"\351\030\230\276\n\243\230\226\262\313\2368\266\326/\215\323"
+	.ascii	"\374\261\ti\215)WRX\367\016\357DA\035*\375\374D\273\202\005{"
+	.ascii	"'6oT\013\331\326/\027.f\363\221E\353\232r\345\302\234\341F4\350"
+	.ascii	"\252\356mR\300\017\013\261\013\202\202\343'\255\217eLf\311\262"
+	.ascii	"\331\233V\273\247\201i\253\375\264\277\032\3115\332)\325X\023"
+	.ascii	"\240\237\235\353^\262\026\211\261\017{\267\331\314<\"{\247\263"
+	.ascii	"I\310\260\315\323f\233Tl\343\272;\3052\2742\317d\350\333\366"
+	.ascii	"\207:\230l\027\306\351\267\217j\354\310\312e\311v\t\f\364\301"
+	.ascii	"\001}p@\037\334/\304o\346\001R\321\016\b\202\007\323\373/i\002"
+	.ascii	"\221\2577\264\343u\2509H*\002\3568\360\206\002 \021\3658\370"
+	.ascii	"\216\034\360\210|;\tE<\237o\327A\250\306\003\322\016\302\007"
+	.ascii	"#\340\220\312B\005zEB:_og\244\023\372!\351\n\334\370\350\003"
+	.ascii	"\357\247K::\372\351l\307\373\266\301\357\272\232\354q\263XYj"
+	.ascii	"\246\264\247\230v\343\374\241\341X>\255I\313D6\317[\277\353\264"
+	.ascii	"\252e\2125iw\372\246\211\246\305\222*{r\363\336{\321\236\342"
+	.ascii	"OY\276X\223f\256\223\226.\326d\363\201hN\023\017v\032\224%\214"
+	.ascii	"5i\3664\233}\323\267&2\377J(N\377\364\221?YpI\331\231\256\261"
+	.ascii	"\211\220\3236\375\225\013M\007Z\2501D\305\220R\244\f\211H A*"
+	.ascii	"P\032\003\200\002\221:*n\021\30055R\245\220i\r\310\344\270\\"
+	.ascii	"\212?\352\363\214]\200\276ef\367)J\307b\r\220\200\321\354\304"
+	.ascii	" \220\314\204-[\305\022\257\337\367V\t(W\227\242\372\026\251"
+	.ascii	"\246p\377\340X\354\375\177\223T?\020\306\260\335\244\356\310"
+	.ascii	"\235e\321F\376\251\204\230\342\315U\016\023\023\336\344xz\013"
+	.ascii	"\200uTa?\245uT\246\307-i\261\021G\320\247\241\351\264I\242\007"
+	.ascii	"v\364\237\271\211\222\001\335\016\360=_\001!S\347\013X\316\247"
+	.ascii	"\273%\"|\030\332nr\017\347\271d\3242\037\323\027(\310\326\330"
+	.ascii	"\313\005s\272\004Bo\201\343_\233\302\007\323\256\230\276\030"
+	.ascii	"\363\007"
+	.text
+	.section	.gnu.lto_cliRxRange.282.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\007\002\r\022"
+	.string	"&\241wH\320\224M:$\205`\251\265\244\276f10\277\2729\311\325\026\303\030\n\240\313\323\247\340\254\262oK\211T9\210\332\2126\362\3530xvA\224I\310\002\317\352\206}\320\007X\304\024\323\346\354\337\013\225\2660k\367&[\246\024`"
+	.string	"]"
+	.string	"d"
+	.string	"\273\267$\245]\334\002\037P]\032\367\223y\251\272\311\274t\314~B\231\255\214\001\022\031:4\216\354\356\027[<\366\324\224^\324\230\377\242\257\302\232\354)\025\317\247\314a\325f\352\225\324x\036\275\004\272\245\"\002j8\336\t\315E\370\242+\212\332\215j\352\301\356Z\303\232\212[u\3331\266Wlu\0208\032\345\225z\321~\205\320\207\217"
+	.ascii	"n\b-\224\016'\312l\334\215\306\037\373q\267\333\355\034o\366"
+	.ascii	"\211~y\334\357M\265J\365K\036\025\203\266c\273\017\246]\332."
+	.ascii	"\3116I\034/l\337#\236n>=&q#G\333S\220\317\320\356\262\224e[q"
+	.ascii	"%\234R\256\366\207>#v\242\232\017\bAP\364F_\262\240\332\315y"
+	.ascii	"xA\225#\001\301%\206\f\372P#\001\232\020\013(\335L{\314h0<\023"
+	.ascii	"\365k\246\257a\376\350I,\221\th\327\346\341\217\354\224\333h"
+	.ascii	"Y\235\240\351\206\f\355n\003\244\327p\361\203.\335\002\365!8"
+	.ascii	"/\377\016\323v}\320\207>\222\021[\223\316\201\242tJ\321\"\346"
+	.ascii	"\343\206\234\220\236\001e@\330\264\007\025\032\330G\0033\001"
+	.ascii	"c\\/ \214\313\n\007\230V\312-\025\327K\353\213q\271\300|-\230"
+	.ascii	"\314\247r\342\027\b\020\366\315\274^\260\217\205\263\271\267"
+	.ascii	"\361V!G\n(\235M\274\361vwS\006\324\2132\332\020\"\310\377p\332"
+	.ascii	"\261\315\002\372\334y\260H \271\035-\001vtx\002\005\236&\023"
+	.ascii	"Y!\353\221\361\307\n\256\321D.* \240\202\231\252\262\003\351"
+	.ascii	"L\217\302\377c\314\212\207$\321(\\D\203\344H\007\030\230\022"
+	.ascii	"f4\331\005+M\276\246\366\001#\343\362\304\037\234\254\301\200"
+	.ascii	"\b\nY\262\256Ks\253\354K\314!\356\212\242\261\036\273\b#FHlY"
+	.ascii	"6\275\242\215\005E\300Y\tn\344^\310\344H\n{\212G\3235\204\n\005"
+	.text
+	.section	.gnu.lto_printServo.283.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\203\rmB"
+	.ascii	"\372s\200\031>0\246J:(\024\355S\247\324\3530\213^\351l;Z}\\\213"
+	.ascii	"\222GU+>\206#@\215\245\265\273a`>\201\256\370\003{\200\363\b"
+	.ascii	"\216\251lJ8\336\242\267Q\263\215\020B\b!r\247\035\215\001g\001"
+	.ascii	"\204\001?\220\257\341{\346\243\270(\027\"\370\027\356\275\221"
+	.ascii	"-qO\016\345\340\007\342\342\234\247\246\333a\2167\370p\016\210"
+	.ascii	"\213q~\240\257\234\363\205kj\272\341\211\321\025!\355\177hVJ"
+	.ascii	"\347\233dm\272\365Q\301\276\017\337\017\027\237<\254\2068_\246"
+	.ascii	"[\310MN\236\244\367uf=\305)\330\247]\304\030\267\033\037{m\037"
+	.ascii	"\332\274\241\220\235_\223v6?\250\220\357\020=\266-\366)v\262"
+	.ascii	"\317\030?\357h\322\236\006\bn\337\227\312\237\234\367una\004"
+	.ascii	"\354S\253'\325\247\350\241\324\247\030\247a\234\210\212\310\253"
+	.ascii	"\214\300\034\\\356Iz\337\227\253\257\034\217\307\343S\024f\217"
+	.ascii	":\217\3254\355\311(\250''d\323\321\310Tt[vj\225RS\264s\032>\337"
+	.ascii	"\257\236\201\364\006\3711\225On\021\\\346(+pZ\016U\030%?\335"
+	.ascii	"\335\251yd\263\020KnBQ*b\204\334\360-\013Za\360Mb\223|\264\002"
+	.ascii	"Gw#\2243A\031|\222\213\006\250\3009\271\21368\234\003\351\206"
+	.ascii	"oN\320d\022.l\007\3636\227\333\301sh\316\311\311C\244\002Gw\366"
+	.ascii	"\356S(T\223\277.\250\226\2400s\307s\003`\336\344\362z!Z.\205"
+	.ascii	"\256no\202n\370\306\005\235\260H\321\334\375\324\262\352~a\362"
+	.ascii	"t\311Q\264\352\017\341\230#\223\bz\365d\312\233\003>\2671\207"
+	.ascii	"\344\276\337\033\364=R\033\344\307d\362\274^x\337\027g6&\334"
+	.ascii	"1\3251~\"\306\370\211q\321K\177\f\r\311\223pn\260\016\321\215"
+	.ascii	"hM\f\323\361\036\365\235\373k`\324\362%\374\240\337\007|\252"
+	.ascii	"\247\357\221\336 \276D!\371\322\003@\201x\215\215\371Bg\335B"
+	.ascii	"c\034\243,\237-C'\341\240\274!\036\256\265\022c\2472\267\035"
+	.ascii	"\306W\217\2501\202\273\016\343\023%F|\316\261\210\3079\016\001"
+	.ascii	"\342\303\363\034\213u\270\235\343\ro\363\207\375\316\261\206"
+	.ascii	"\263\371\3012\334\315\177\341i~\013'<\376:\237c\257\3239\356"
+	.ascii	"\372\3371\204?\217\037p\335\315\261\0037\343-7c\2555\343,7\343"
+	.ascii	"\006k\306\f\334\214\027\270\031+X3N\340f\214\345f\214\300\315"
+	.ascii	"\370\300\232\361\225\233\261\0017c+7\343\002n\306\004\324\214"
+	.ascii	"\253\324\214\007\254\031\013X3\016\320f\f`\315\230\252\315xj"
+	.ascii	"\315X\252\3158\271f\034\305f\f\265f\374\304f\354\264f\214l3n"
+	.ascii	"Z3>\266\031\033\327\214\231\332\214\213k\306.\233q\273f\314\262"
+	.ascii	"\031"
+	.string	"\257k\306j\232q\272f\214\256\031\267\232qV3>\n\261@z\177\366\230\204=\310\371&\271T\351\355\223\006v9\341\317\347\317\363\333\371\357\374t\3769\377\337\037\347\177\336\305\370\205\350\333\027\026\227\347e\017\376 .\362A\024w\027\307\346\301\327\203\213ns\256/OR\035\374;\307sA\255\210X\034\235\027;\001\205\207m\333\341\2538)ol\327\341\3778\007L\226\251\2563|Xw\0338U\364\252:\2547t\333\204\322\232\230\006k\r\367\363\001]\325\325\003\372x\236\352y\002\252\235Y\245\272\016\267w\351\211v\013\323\320\0220\3436\214\246\016\372|o\233\314BK\300\234\241\271\272\215\315yuf\326\\\302\"&\033\265\3550\"\246\242% :\202}\304<\264\004l|4\025B\267=\360m!\246\244% Z\2421\332\\\355\240\3330\376y\250\017\372D\337\357\251\0227tU\371\251\243Z\252\251:\200"
+	.ascii	"0\b-\240\277L\004\320\001(\001\300\233j*\304\251f\361t\203\230"
+	.ascii	"l\251H'\222xP\035\365\b\252Y<\371\020\235\372\251\325\246\334"
+	.ascii	"\235F\206NX\200\376\372\320\241\311iUf\333m\246>6\262\0374\376"
+	.ascii	"\"\016k\035\237\024\272\274\367];\233\030\273v'\n\236\242\355"
+	.ascii	"\001D>\033F\337'\255\304M\215\024\361DM\226\020\215}$\361CF\274"
+	.ascii	"b3\231\270\241\023\305D\304\266\335\024'\324\342\245Y\233\005"
+	.ascii	"\\&b\254\342\202V\260\357;D\002\376\237 }Z\260Z\236\256}\270"
+	.ascii	"\276K\210i\214\231\253\325.\321hR\322V\373i\177)8\242\321^\233"
+	.ascii	"I\370\226Y\357\036\321=\270\fD\346\373\271\210\016\321\030\217"
+	.ascii	"\271\310g\353nFU\n\373\344\016k\021\375\300\227h\272EZ\023\243"
+	.ascii	"\026\240MY\006\375\0175\254\007\324\235\231\322(\330\214\354"
+	.ascii	"\314\214l\007\231\231U\217\262\032gI\374\002\313\n\r\313\212"
+	.ascii	"\212\006\231\r\033c2\\\254H\0306n\200\265\032\316h\214\241\345"
+	.ascii	" 3\226\335L\207\211\0306\312^\214\221\311pM\350\240\2016\006"
+	.ascii	"\203\354\305\323Y\2151\263\261\0217v\230\221\235\025g\234\215"
+	.ascii	"\201\300Q\003\355\005\213]8(\243\341\202\313F\331X\r.\027fg\\"
+	.ascii	"\016\222\370\006\01623.\0357n\230q\025\235\357\371\316\006\342"
+	.ascii	"yA<\024\322j\311\266\303\355\035\024\210N\315He\345\273\336w"
+	.ascii	"\365\031\351\265\211\352j\020}\301\247J\236q\240\234:\364jf*"
+	.ascii	"+\377\325mH\376\365=d\020\325y\372\352\016\204Y\234\276\264\016"
+	.ascii	"\266U\247\210\017\326\363+\223\007\271\245\325\rz\253\325\275"
+	.ascii	"\254\326\372j\255g\265\212h\255R\222\006\375\302\243\225\236"
+	.ascii	"\204\210i\376\002\235\271kj;\354\245\307\370\241W3lV\336\253"
+	.ascii	"\333x\250^\335T\364\320\367}\337c\333\341{\365\207V\315<\353"
+	.ascii	"d#\0030\006]l:\341cZ\240\240\017\364\202V\367\226rl\220\0244"
+	.ascii	"\n'\217\016J\321\253\273\032\347\"igV@\177\216\322\320\260k\027"
+	.ascii	"\243\340i\002\271"
+	.string	"Vb\261N\320\305\346\234\242e\342\241\340\341\222\350\266\035V\037\314\201.\320X-\240\320\334\240\245\\V\036A\213u[Z\n\036h\003\215\240\007\f.\345\256\372\200Wk\375\252\253\366\326*Y\265\201F\341,\347\n4\201\266\352\365\321\222\211\032\021F\005\372\202M5Y\r\003$\002\375\301g\265\201\243\205\016M\017\036\n\200\371\250q8\345\fRffHDD\222\244i\f\240\002\2211*\316\001\0210\255C\314\221\310HA\322\312\034M\231\360\031\230\235\357,N\233:\257=\336-6A\355\261N\372o\202\006\\\334^\202\220\355\345\217\304\241\244'G%\033@,cK\t\371a? \323\021\335\\\205\025\3700\246\337\034\246\"\251\313pq\330W\340\321\220\210\227\357\222\035\324\335\264DP\312\211Q\244L\301\274\\\303\300\243f\305\330\022\242\2126\232\360\270\215z8ut\317\360\022\033\034\024H\277\274\370\034\016\027"
+	.string	"M9\317[(\214\376\334\331\272\261\346\304\227p\235\270\002\355\2545\361%C0\024[p\225\264\002T\347P\367\030 \237\017\3200\034\241\370?3\370\352\337\204c\f\031\250!\007/\322\316\335\274\270e\236\302\335\206\362=\300\210\301\366W\217d\361\025\t\224\264\356\232\324\311\302\376\321\373\257T\025\222HB\221L#r\222P\354P\027#\225\n\245\"\303\336\334p\351\253\b;;c\022X;\260\235\306\2479\031\220\271'e\t\366\021y:\004\374\220\262\210\0260\032*i\002\t\022\224\254"
+	.ascii	"s\271\360%_\325\233\365\325E\324'\310\250\b\357\204U\365\362"
+	.ascii	"\34065\205\276\236\035\3705<\233\377\r\253\"\b\264\357\254s-"
+	.ascii	")\034\376\244"
+	.ascii	"*\333\034\033\331\201\021\221\032\321\\8\230\357\rOa0a\"\275"
+	.ascii	"\016\305! \032U,\207J\177%\017\356U<\212\255\273\312\3003\004"
+	.ascii	"9\340\210f\345\226Cs<J;\341\315\201&k8\247X\216\374\2563\201"
+	.ascii	"`\215f\215[\037\304\374\243\350\n\261\252\230\270]\345\251\031"
+	.ascii	"l\024\245\306\bD7\317\2413\206\235\211]\242\032\001a\333J\\\374"
+	.ascii	"1\252\300\023b\362\306\bD\034>\031(\323b\301|\351\226\017\007"
+	.ascii	"\273\307\371B(\025"
+	.text
+	.section	.gnu.lto_cliServo.284.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`1\f\305A"
+	.string	"\252qT\031CP^N:+\003\273\005\252U\334e\233\352~\320\302\216O\302\302\344\265\356a\264\265\225\306\246\372'\004h\034MA\007x\2217\300q\f\202i@\304\200\366\246\230+\263\335\327u\327\261\266f\t!\204\354\235d\202\001]\001\212\001\304\257}\343eZ\001\231?\203\362\243\027s\272&\2169\031\345\2458\3762_\027\220\031\033\b{\305\1779\030\345\303\364\364\357\363\375\016:fo\376\336\367\305r\277&\325#\261^r\030\275|\357\235z\314\340\374\275\357\\\325\327f\320\215\347r\3301p\334\375\270\313)\317E\307\217\357\273&\265{\337\271\003M\345~\355\271#\331\257\356\221\330\257\255\354\336\263$\366z503\263\0043\350}\337\253\334\244\3356f\345\241\236\234\232\230\226\224"
+	.string	" \223\220\216\216FED\306\"q(\224r[vUs\024V\366\207e^\207z\222\273S\223\360\311\23288&Uj\rI\340\371\234Z\324\244\233\275\345R\026\245("
+	.ascii	"\240 \337\222\236 99r\203\303\307\256 oFj\2014= \347s\266\251"
+	.ascii	"H9K\362\024\251\013\304\006\241\235\317\211D-\n.\373N\305\311"
+	.ascii	"\206\211\322\302\260\361\310\213\320 E\372\020\325\236h\037\236"
+	.ascii	"\317i\244\b\026\342\261\347\331\245\324V\354\007\224\3639\321"
+	.ascii	"T,\301?\274\333}\212\212\263\013v\247\324\236go\211mH\376\342"
+	.ascii	"\002\325\236qgU\tyB~\020\225-U\354\304N\037b\331\030^U+= r\347"
+	.ascii	"s\022Q\217K\360Do'\206\325\323}J\355\271\345\371_G\036\245\026"
+	.ascii	"\370\273\013t>'\027\025\371\003\n\363t\307\31520\214[\n\357\373"
+	.ascii	"6f\226=\337\311w\343\r\335\335\354\036z\b\302k\261j^\363\227"
+	.ascii	"Znw-6g5\177,\255\230s\376\362\320\027\036\354\003\317b\213\031"
+	.ascii	"\347\333]\025$c(\352'\006\017\f\017~\215\227\263+j7\341\276\016"
+	.ascii	"\266\317\201\275\231\353y\300t\330\336\367\353\314\233\3516p"
+	.ascii	"7\037\260\224\222B\321(q\357\373b\261y\233\020\375'_[\304\b|"
+	.ascii	"\346\b\366\353O\202\355.q\002\237\331\2276A\263\267l\005\207"
+	.ascii	"\214\345\f\355\337\310\314H\225\250\274\3264\330\347\024\321"
+	.ascii	";aX\260\215p\201\334\215B\005>\363\371t?\017<\2717\360/,{u\317"
+	.ascii	"\201\341\f\355\376R\017*p\235\327\272#`9hp.\277\202\207yW}\356"
+	.ascii	"/@%\340^\336\001\204\270\247\204\270\223B\334RB\334QB\334PF\334"
+	.ascii	"OF\334NC\334MC\334LK\257{+\rq#\207\270\223\212\270\221\212\270"
+	.ascii	"\217\206\270\217-n\243\026wQ\213\233h\210\333H\304]tq\023]\334"
+	.ascii	"C\"n\341\020\267+\304\335\266\270\331\026\367\352\342V]\334\271"
+	.ascii	"\305\215[\334\237\240A\020\330\0340fg\262\337\334\373c\260\320"
+	.ascii	"\273\267\342Ey\335\357\345\017\363K\257v\277\271~\327 \244zY"
+	.ascii	"\372g\216\327M\354\256\337\265\006:g/\323\267kb]O\223asoY\333"
+	.ascii	"\226\266&n\320\005\267\253;w\301\"\345\374e\212\247\263\340\363"
+	.ascii	".\330\243\214t\314GY\235\0368f\023\3227\201\252[\022\257\343"
+	.ascii	"\357\270\261\311\200u\201F\031\332mU\346\301\344\254\030\276"
+	.ascii	"@EF\252\274\224\233Fy+Z\224\211\262Qn\301,\201T\275*\027\345"
+	.ascii	"V\3172\013\273\224\211\362\021\231[\234e\2361W\345\2771\340\032"
+	.ascii	"\263\ti\036\034\336\027\036t\321\370\b\022e(\b\271+QUo\265\250"
+	.ascii	"\224\251r\323\007\236\034\234\250\002\271\325b\204, 7\333B\226"
+	.ascii	"\242\0062$j\232E\276\360\340^\234\035R\214\352\220*[\341\335"
+	.ascii	"\245\271\016\262Rn\002x\336\035\0326\310O\317\2733.V\216\220"
+	.ascii	"\233\335\377\355\350\362\030**\267H\335\252\254}[\376\210\t."
+	.ascii	" 7\310D2\266\3011+gj\200=\206\311\365O\336\226\250\235\247-\337"
+	.ascii	"\f\t\263\0305bN\251\274v\264\347\335\031)\254\334j+ \007\310"
+	.ascii	"M9'f\013o\276\367a&\n\3630\253\200\226\207\372~J\037Y\356\223"
+	.ascii	"~\016\366\2530\023\221a\343\323,\222\340\0012V&\"c\363\033\263"
+	.ascii	"\002\206\007\257\276\357\373\272\031\232\257\234N)\007\305\306"
+	.ascii	"\004l\263\233Y3\006N\225\035\344U\317XZ\022\013\310\335\025,"
+	.ascii	"\3403\333\314\266q3\303b\023\374k\241\260\202\334\215!\003\276"
+	.ascii	"\323\204\320^X\366\302e|\310\260\031\332\353{\312R\345\365K\235"
+	.ascii	"\237(\2340,\bA\313\035\2705C?=\233\257\266f\234\331\374%\220"
+	.ascii	"\275b@\262k@r\251_Xqi\331\330b\301uU\343\205\213,\030-\234j\310"
+	.ascii	"\350\322\262PaE\026\f\0246\216\270j\310`\021\243\313\305\026"
+	.ascii	"\na\326\267j\314\310,dd\301`\021\003E\207\0251T\264\255\302*"
+	.ascii	"\013\206\212+\031Y(b\\\251\330\342\272\262B\266\326\f\026[W5"
+	.ascii	"\264\264"
+	.string	"\266\256\210s_\247\360\225\301\016\265\346\325\rJ\223\273\221\327\033\223'\034\352\373\252M\270\364\247\373\361\317\013\036ty\210\2319!\300P9*K\345d\236\312U\271\361\020\245\222v\355L\\Z\334\373\216\235\251\\\342\216q\021\370Z\365VB\225M\360\231\255\276h\331\253\217y*\231/\025\225\017\225\331\2667\277\2476lV\347Y\326\224\237\362\221\23575NN\360\017\345[\356K\323\347\243\307\231\200L\331)\023\333\336\352\226\207\220Qps\217If\347ML\322\024\274\214\033\023#\222=\031d\002~U\301`J\271\334\227&K\232\203\347u+\331\360\327\007\225\t\277\330\313\003\373u\215\324\017\314O\nx\334\323\243i\300\361\224X\224px\247\240\236M\371\303\224\241\307\246\\\2247\247)\233\220\366\301Q})\264\324}\302/\323\301(\234\007P\330\224\224hL\231\2307%\024\325\013T\231\262\ti\0344\177y"
+	.ascii	"$ec\330TPT\257\007\233\201\310\fmd>\346\"+V\310\300\177nL\225"
+	.ascii	"\244\243T\2706\365\263\204o\007\222\236+\345\330\244\\de\312"
+	.ascii	"'\372&\f\013\376\301_\223\262\t)\0348-;\006\035\021\365\002\200"
+	.ascii	"\373\250q4\244\224b\206dD\002\031"
+	.string	"\222$i\306\300\002\221\251\"7\021\200\275CF\223$\031\326\366w\351\035S\210Y\326i\024\375\333\304\226\024@\323\247\262\376\224Z\350\325\374\001\034\253I'\371MNI\355v\264-\377`h\036\262\227\3072\311S\307?\352\350X`\004?\251Y1\024\353\333CD\375SG\356T,\352\037\352PV\377\373\275+=w\215\013O3V\232\002\024\223\341LR\332\260gB\240H\200\330\343\236\240\005\275\311r\f ML\336\025\357<cXBr\227\377\n\3341\303\303\2671\244\306\376\2373\203\3778\361\0228\255\300\230\365\n\235O\221T\320:lz\020f0 \022~k\177\"\232\302\263\234h\300\212\2605\310/\356H\0058\225Ex\364%\320\222\256\210\212\341\362\310\324\202\221\0204)`\b\247\246\316\216\326\024d\222\227K&.,\346\037Dk\204)\204b\316\200\003:\206A$L5\026\314\376Oh\350\363\351\212"
+	.string	"Z\254\f|4\"\264\030\b\027\346\333\005\331\027@h\216\334\020\352\302\331,\013C\303\350+\352\357\022}\323\"\004\237\266~\340\037\276\323\300"
+	.string	"\216\207\203\240\033\341\270&<b8\344\262\350#e\312Kv\260\265\"\265m\n#\210*\3522\222dZ\272A[\n\257'`\266M\246\377"
+	.ascii	"Zn9aA"
+	.ascii	"\242h\356z\260;N\305\230\255\332\"#\202\235\315\b\353\307$[\022"
+	.ascii	"\343\007wOy\004\210\325\242\31075/ \376l\277\3350mN\017\364N"
+	.ascii	"hF\337\"\220\254e\231\313\"\020\323Pv\367\233o\232\3333\330\007"
+	.ascii	"\363i\366\201\034\360\375\f6\017D\035c>\354\273h\3300\004*';"
+	.ascii	"\222\326\306\375P3$\330\323e^\267v(\377?yf\271\225\321\253\001"
+	.text
+	.section	.gnu.lto_printServoMix.285.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\335\007\355,"
+	.string	"*R\360\021E`\236N\007\267 \260\016|\3034\315\025\243QA\362\233\b?\245\222\353\310\323%\244\337\021.\315{\341\226`\364\200i\324\220\311\035k\214\037\354\260\025'\231\301D\024\201\325\373;\0245\267=\273{I\333;\245\224\002\f\001\362"
+	.string	"\016\001{\355\325\344\336\322O\271v\026{\216h\364\271q6\207\007qm5\n\350"
+	.ascii	"B\261\265l!\031\231w\007\320\fm\314p\355,\334q\334\266\312\314"
+	.ascii	"p0\220\274\230W\311\352\235\355\245\315\271\227\271\240U\246"
+	.ascii	"Z[\355\226\231\337M\006\026%!\332\276Lpf[)6\333\214\242\237\353"
+	.ascii	"u%\007\203\265Uf\256\355\314\235\326j\305^\243\301\301{\311\234"
+	.ascii	"s\3672\031\360\322\332*R\017\375ZM;\350\327*\027\231\327\024"
+	.ascii	"\331\270F\bat\220X\346\334{\205\217\204\177:e6\257^\354\340\n"
+	.ascii	"\374\251\351{\221\373\255\225\232f\272\362\342\224"
+	.string	"\306\016\246O\246\013Y\227\341!\226F\030C\022\246\343\332\277\224]\276\222\201\2115\360\b\330\217\376\365h5=\302\013#\245GyL\225\204\024i\266J\033\236\246\021\324\320\314\372\331\256C\351\225>\333\333\035\373\227\022\351\337q\255\232\235\355\245E\311\300~\264\003)\334{\331\223J\260f\266\231\031\215\231\227\314@\023\001\377}\214\002l\366\362\353\367\357#\224.\357c\247\357\357gg\340\021\327w%\357\215\257\206\367=\0317jm\236{\\\370\013\372\351\231\207(\274\223\r~\bL\314\\t\357\370Ff\246\321\277\214\271\243\344\216h\370\2150K\210\202\352\266\356\007\315\326\355\240A\273u\013{\255\373\251\2654+h\270f\247\246vkN\300:3\261\316K\2553\002\326Y\251uNb\235\221X\347\003\255\263\001\326\371(\350\\\200u&\020t6b\235\007\264\316E\2543Q\353,\200u\036j\235\205X\347\240\240s"
+	.string	"\326\031\250u\376a\235}\202\316=\2543O\320\031"
+	.string	"\353\334\266\316,\353\034T\235W\326\031\310:\377\334Y\r:\247\356\374\253\263\257\316=\201\203\231.<,au>\217yw\364\331\271cT\272\263\256\353\326\322=\327\r\327)s37\0357\224\333:\027=ph\001?\027\351\275d\023\272\256{\217\315\3738\311\333\347y\237\007\372\240\037z\242wzn\275b\025\240\221\273\275\261\264{\217\235\254\260\036[HS\253\300\267\200\301;\311\351\035{#\013x\"\r\002\226B?\264\241\241 \204\344\242\001>\b\352!\300\362\347\20184\024\304\2173\332\363>R=K"
+	.string	"\317\323\241\241\036"
+	.ascii	"@\243\354\267wH>\376\320P\020\353\275\027\212\375v\322\264[\256"
+	.ascii	"\365x\323\007?\352\267\210\254\037\374^\277\221P\250\007>\320"
+	.ascii	"l\351D\362-\350\337C\375\203A\322\tys\351\266k\250\2105\331v"
+	.ascii	"\375\234\321I\346\021$\274\223\277\1777M\206\2149\276Q\213\330"
+	.ascii	"r]\327o\367\340\325oh\257y7\320\344\034\243t\365\233*\317 \352"
+	.ascii	"\227\335\365\203g\302+\322\006/\215\227\323y{\022\025K\277\214"
+	.ascii	"\247~\351g]\321\363r:\314\\\242\237S\353\275^P\351s5\333\226"
+	.ascii	"k\334]b\020\273-\311\022\356\031\277V{\256\377\314\027\020\177"
+	.ascii	"\007\037\\\305\204\024\303\352\212xD\364s\201\270bj\313\305\220"
+	.ascii	"\307\252\263\264>\240`aU55L\301Z\320Z\2615ubXUD\314\032\306\260"
+	.ascii	"\222\302z\2215\374p\205\245E\334\242\002RA\234\222jq\265U\265"
+	.ascii	"2\325\223\325\n*!\013\253\251+!U\026Q\3704\304X-\206YB-,\254"
+	.ascii	",a\313\274\375F\336z\245\213\336\350^\215\357\312\013~\031\267"
+	.ascii	"\311_\220I\030\037\322\351\374\305\351/\301\367[\007\315\302"
+	.ascii	"\356 \235\336\340\233\376+\255\254\212\2257\235\336{\357\372"
+	.ascii	"l\240=6#f\333\035\360\313X\215\217\035H\247\n\265\306\361\201"
+	.ascii	"\003\351L\271\267~\n\376\253\241\035\324\363!\206t\252Q\317i"
+	.ascii	"\332\364\t\376\213\271\033\306\317\351%\274\223\270\276\256<"
+	.ascii	"\2671\342\334\200'\360G\177\340\221^\351\227\230\212K\005\317"
+	.ascii	"\204\340\2274 x\256\346]4\351\2256$=W\363\313r-}\244o$\237\201"
+	.ascii	"?\300\301\300\262\300\037I\025x\256&\230\250\321\0230z\256f\230"
+	.ascii	"e\321\017\370\237\331\0246\317\"\225\242&(\0308cj\035\200\222"
+	.ascii	"\250Q@\346\220R\206DDD&hA\322\214\001\320\002\2211\3426\021@"
+	.ascii	"Ih\252F\241\n\313\030\262>c\022\322\177\222\037\0373\350Y\234"
+	.ascii	">=\221\007\320\274\021\022C49\247\336+ (q0\\\013\243\377Ul\353"
+	.ascii	"\322\302:}++\002\330A7\362\247\234\254\314O2\335m\"\271\212@"
+	.ascii	"Ri\252\265\205\035\320z\243\006\331\356\252f\366\n7\255\301F"
+	.ascii	"\235t<\320@\326\006\202\254\341S\031I\027Q\245\226\004\210\222"
+	.ascii	"\020\2115\265\2538\023\2179\007\375\003P\"\325\013ifE\323\021"
+	.ascii	"Up\235B\022\372\007\210\242GW\220\220(\002(\t\254\246\244\206"
+	.ascii	"\365t\371\\Z\273\334\232\320\002\361b\304\257\201\211M\240\360"
+	.ascii	"\322\363!@S@?\235\243\017\356Q\270\243\t\352\232\310\006\357"
+	.ascii	"\031\313w\020\036\317\206P\303\234\241Gd\213.\002\352\314\340"
+	.ascii	"\230\360rL/,\263\f\032r\361\310y\2667\371\207#y2i\204U?\260l"
+	.ascii	"\263\246\031\b\206?H\205\"bG\307\316\322\273 \224C\231\351\303"
+	.ascii	"\024\361\007"
+	.text
+	.section	.gnu.lto_cliServoMix.286.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\367\037\035\225"
+	.string	"\352\363\2606I \f\333\032\003\377`\t$\264\305\342 2R\220<4\204\030~\n\252\003\004*y\177\376\343\307r\252\034\307\005\340\243\323s\226w<\026"
+	.ascii	"\260\333%\347\254\263\341\r\270\357\373w\2138\213@\002o\352\253"
+	.ascii	"\250^A\266&SJ)f\003\020\003Z\003v\320\322\024\ty\331\307\301"
+	.ascii	",\367\345B\003\255\210\t\357[\007\001\031\356@^\236i&rQ<@\331"
+	.ascii	"\307\033i\316\2004\031>\226\245\211S\223\003\354\254\220\027"
+	.ascii	"\322\257\327\315\343\302'\027\367'\304}\317\352^\262db\027>\033"
+	.ascii	"\355\307-\206\227k\314\324\204\341%\230\017~^\302\267\307N0C"
+	.ascii	"T\244\001\244\277p\n=6s\270\257\334|\274\304f=\271\352\336\261"
+	.ascii	"e\342\234\240\334\234\367\255\223\221A_\371\313\316\b\362\006"
+	.ascii	"}\345#\327\231\255\232\334Ooi\274\326\343%\227\316\213v\227\016"
+	.ascii	"\236<\357\273\205\306\327B\331G\177{\b)\204\274\003s3\273R\265"
+	.ascii	"\226\266F\333\216\375\372%{\373\013\215\331\236\342\373\276N"
+	.ascii	"}d)e\037\237n\235\220\355S;s\313\365\\\264\263|\320@\357\313"
+	.ascii	"\266\307\367\276u!\230\203\262\217\\\327C\310>*[\b\331\307(3"
+	.ascii	"\033\243\256W\313\204Y\227\351\2269\357\373F\375\022n~\245\022"
+	.ascii	"\t\311\247\231\244\274\320\034r\177\262\262\335\272\346(\236"
+	.ascii	"h3\036\337\361\026\266c+k\341\024\270\316E\013\026+T\244@Aub"
+	.ascii	"\312\204T\t\022#DDA\205xr\002\361\301CS\007&\016\0334dx.a\270"
+	.ascii	"\240\224\204tdTD4dA(\b\350\307\331d\372,{x\224I\344\321}\217"
+	.ascii	"r\367\214i5\343\335\021i\336\242e\273m\317\240\313Z\333\004\t"
+	.ascii	"i 4k!Z\223R\235S Z\223\2029\327\021\255I\277\334E\243\267\270"
+	.ascii	"\343,\354\370\212:\256\202\216\247`t\024\213N5\307O\264\361)"
+	.ascii	"6nb\215K\271Hje\312\230\266^BiM\032\246U\343$Fh\023]\204\233"
+	.ascii	"\354\"\022\245\t\253\210.\025\243b_k\317xT`Ci\265n\326\310\002"
+	.ascii	";\204X?\351\265\353tD\313J\001\361a\215\214L{ \254\002\302U\377"
+	.ascii	"\274\t\353\035\334\241\301$[\020je\312\032\256\352\305\231\334"
+	.ascii	"\2376T\276DU\365\336\032\256\272\347\034\b\253Y\270\352\3257"
+	.ascii	"$\335\364\020\313\264\006\267D\327\234\264&\254\352\271>\214"
+	.ascii	"S\303\206\253v\361\f\356P\0238)MX\315sA\370\355a;K\347O.\275"
+	.ascii	"\224m\245\035\264(n\326\310\2704\206&\254\226!|\363\013s\255"
+	.ascii	"$g\030\347I"
+	.string	"\311\027J\310Ph$,}\344>\253W\334'\\\025\213\033\0316O\033Z\232\23352\024\272\210\260\217hE\244\254\221\3155\221\353\256Q\331j\302j\024W\205\031\275;\035\370\304\207\240\264\205\300\256r\343\242\b\245\205\\\251*_{MX\315\342.\363\344L\351\254\023\017r\207\210D\2416a\325\214\013B\361\313\n\255\327\304\201\226`Y\004\345\026\225\220\245\365\017\017]!UJ\b\355d\002W=\342M7a\306f\212-c\272+\346\342\334\232\260\252\346\276\026\2741-\306\210\373\254\221\245\365RL\273ik\322!aH\360\036\302\252\233^g\200\253\026q\0367)VM\243\264&\035\342R\271iS\244\371\246\256\314\240\204\354\254\223\315\3275\334\346\004\345\026\327\310\316\032\331\204U\264\345\230\227\037-\254%\031\322\256\333B\257\260Is\254\313m*ibZ\257=l\214\313_\250=\371\342}_v\352\030Y3"
+	.ascii	"\315|dd\346?f\244\243\177Go\205+}[\336\350\276\357\373\372\034"
+	.ascii	"\277\301\336\373\353\370\236}\363\023\234\"$\323d\331\330\375"
+	.ascii	"\365o\027\270\304\252\235r\021\242f_\337aZ(\373\366E\220\213"
+	.ascii	"\352=\341\332\343\272!D\321HPz\365\0207H\313\033\035\n$~\214"
+	.ascii	"<\337\306<\332dW\377\310\210t\261\226\361a\276f\325r9c/\257_"
+	.ascii	"p\224\337\326YH\031\337\325\027\312\233;\364R\223z#sg!\231\243"
+	.ascii	"F|H\026\017\333\0318jS\335\307\314\201\203\020=\342\036!\251"
+	.ascii	"\343T\017\213\"\211&\211\266yS\243K\220}\234b\002G\306\3777_"
+	.ascii	"\273X\364\330X\017\361\276g\311Y\t\311osVl&\203t\352\336\363"
+	.ascii	"i\0252\351\313\026\243{q\324I\024J\2277+\202^l\212a\220\337\366"
+	.ascii	"P\017~\354\250\024d_}+:E\031=A\351\325^M}\214Z\211^\361\246\372"
+	.ascii	"[ \243S]T\364Jqw\347\345\370m\314\254\301\271?@rG\347\220\355"
+	.ascii	"\245\355D\351\336\216\311\373n5\265\2750?u\035\030_4\210\306"
+	.ascii	"\232\225{\337\227\212\261\351\310\340~R\345M\255B\366\261\333"
+	.ascii	"\006\222Y\200\001\274\251\fB\037\235wQq\332L\364\250\270b\232"
+	.ascii	")\353\3541\275B\001K\266\300\255WS\017PzU\320\324Gv]\202\317"
+	.ascii	"\361aN\315\300?\327\031:k\"\2273r?\003\337{\323;[\336\310D\236"
+	.ascii	"\343\231\023X\300\233\332\337z\335D\372\026\371\026\025\271^"
+	.ascii	"\213\271N\332*\332\220i\375\267q{\206\022\340\210\361\2631w\265"
+	.ascii	"\251\r\326`\232\373\253\273Z\332Z\036t \344\214\005\344\352\207"
+	.ascii	"\005\235\245{\202\256\353\226\240\017\233\037p\240\355\232\031"
+	.ascii	"\350\272\346\034\356\034@#6\333\350\302\301\346\252>\323\\\243"
+	.ascii	"\001\233i\314hl\263\214\0300\200\234_\0049\273\brn\001\344\314"
+	.ascii	"\"\310y\005\220\263\n \347\024Lg\024Lg\252\006l>\301t\236j\277"
+	.ascii	"f\023Lg\251\276k.\301t&\321w\315#\230\316\"\234\316QLg\250\037"
+	.ascii	"\347\020N\347'\247\263S;\203p:\177p:{p:71\235;4\235\231\232\316"
+	.ascii	"\034\230\316\033\230\316\032\232\316\031\232\316\317\246\363"
+	.ascii	"\022\323\031C\323\371\202\323Y\311\351\234\344tFb:\037\3758\033"
+	.ascii	"1\235\213\234\316DN\347!\247\263\005\247\263\220\3239\310\351"
+	.ascii	"\f\304t\376i:;\233\316M\2463\263\351\354\303t^2\235{\230\316"
+	.ascii	"<Lg\245\217s\262\235\221>\316G\246\263\313t~\246\263\3738w\227"
+	.ascii	"\r\020\306Z\270\305L\357\017\353^\"\215u^\301c\337[\037v#v'v"
+	.ascii	"\027v\017v\237\351\376\353\006\354\366\353\006\323\215\355\266"
+	.ascii	"\353\276\353\356\322M\346\376\333;\373\273\236\375\341\235\365"
+	.ascii	"h5<\300\335_\037\366\226y\311>Z\r\177\230\355\034\304Nl\355\237"
+	.ascii	"\r4D\023\336\227\017\214\027.rs,\350q\303\n\312\315\361\301W"
+	.ascii	"\215\206\233\312\325K!\267\341\231{\323>\2517\211V\031P>\301"
+	.ascii	"\372\245\333uLX\221\244(M:0\217\336\253X\315|\300\202\307t\364"
+	.ascii	"\255\304\032\310\345\214!\216\036\203\253\341\"\225\022*\207"
+	.ascii	"o\343dK\2004z,\253\231\2427\372\217\363\244,z\034W\303+}[|\327"
+	.ascii	"%\273A\207O@\007M\241\305\300\230\325\001\301\t\243\341I\343"
+	.ascii	"O|\030\273O\030?\342\303|\257\211>\251\365\246p\350-<\321\377"
+	.ascii	"\226i\2317\373!G\374\320s\260\242\301\013s\342-<\216\253\031"
+	.ascii	"\353!^\237\324\0333@A\213\233b\227<\370\017\320\240L\261\030"
+	.ascii	"\200<\215\017\353l\363\314\241\275M\261K\035\360\270\231]\247"
+	.ascii	"X\fN\r\343\303t \205^F\320\003\275\320\177\320w\220\242\301\303"
+	.ascii	"\342nM\343\201>\307u\214\364\020/\214\203\245@\367\354'jO\364"
+	.ascii	"\240\203\316\246\366\304\212\364\340=\013\347F\360\347\231\031"
+	.ascii	"Z\247\365\330\317\002\342\233\241\276\201"
+	.string	"\300i\340A\363\274\251?/\244\204\247\206\361\035|\004\3271\326\303;5iK\331\252.5\340M\246\001\241{NDj\223q;\350 \006lS\037\257\260\320/\336T @\214pd\004\275\376\350\3360|\033\217\310*\265\326'\261\020\271XW}\030W\273\352\037K\277\305Yr\241\352[\353w\270\345\215\241\023\224\276\226+e\221Z\372I\306\"\027k"
+	.string	">\314\204\006\340\235v\206*\0041\241B\227\364m|\314\036\261\327A\007\033\016\342\265\251\217\307\254\021{\026\350`\262\312\325\313\234\274\246>\006\360a"
+	.ascii	"|K\377\312-\3570\200o4.\027\235\262\204\250\345\331\365Z.\322"
+	.ascii	"\267\271\362n\313\312\221X;\277\253X\265\315\367y\347#\231\231"
+	.ascii	"\2361\277\371\r\300?5\363\223\266x\325\271\002\005\323@e\206"
+	.ascii	"\\S\235\206\271\002\217\213\036\361\245*n\005\352\207\354\243"
+	.ascii	"\317\267]b\226\255_~\033\266\002yym\200@\340bcT\365]\350T\240"
+	.ascii	"c\240\200J\257\316Bh\205;\355\355K\021\016g\206\232\201\006f"
+	.ascii	"\033H\013'EPJ\364m|\242\210\205\356\372$\026!\027\353\032\315"
+	.ascii	"\316B\326\370'\364\266\255'C5\276\273\376\207\033\0279U^\343"
+	.ascii	"[\320\337\242h\027\020\343:\260\203\272\300\035y\037\223\023"
+	.ascii	"c\341\333\270\311\370\023\350`Q\241\322\253O@\323\0043&\264E"
+	.ascii	"\214\220\020\344\325\277\235\341\224\033\376l\366C\346H\204\252"
+	.ascii	"\361\246^}g;H\013'\202`\027o\273\272"
+	.string	"\202z\222m\3205\3206J\257~\322S\026\302\330\273\250\210\244\004(@\337F\244g|S\277\3054\002nY\002\275\324\244yF\330\374~\334\346\2147\361am\307l;\3056\221\017\242\312A|\217\3615\250\nL\210\3208J\257F\322\004\225\003]\36478\202]\257\3051\234\347\231\241v\240\215O\023\317\203\235\"y1\242\202S\371\r\227|\344\367\227\362\237^\257\305\r\366\311_\272\321\341M\357|\241\032-\\\232.\274\307\270\221\250T\n\261K\351\325!4\365q\202i\024\214\250\317\016\337\242b\227R\331\\\0343\373\323\324\277\320g'\313\322\305z\306\207!\277\341\240+x\221h\230\362}\271\250\330\317\034-:\304%\022\035C\216!\373\210\f|\245\001\226U\026\222\237\316?\234\261\234\237\317,&\036$\363`z\346\301\324\203\347\310Y\316VYXV\032Xa)9\213\351\311\303\212\207\216\253\033=Lc"
+	.ascii	"\030\004<g\330\270\001C\001\002l0\231\207\216\253\013\216\034"
+	.ascii	"\304*\313\n\013\311\025@eE\005\251\200\202\036\027L\220\304\315"
+	.ascii	"\201\025\217\0376\2564\300\262\312\352\261\332\201\225\301\025"
+	.ascii	"\002A2\300\340G\217%V\020\f\2544\320\221\225\304\n\202\301\367"
+	.ascii	"\350,\n\260t\270\026\354\260\252`\307\361\207\325\005o\365\243"
+	.ascii	"\307\005V>t\020\300\303\307\216$\357\200\352q\301\216\250\037"
+	.ascii	"=t\370\210\332\201\225\025\0055\304W\030XaE\005\271\272\302\212"
+	.ascii	"Z\326m\365\263\361\213\255\227\"\271NZ\255J\032\n\212\325\350"
+	.ascii	"\240K\267^\003=\345\312\264h\264\266\201\2163\200\364\026z\004"
+	.ascii	"\212d\333/\270^+\005\031j\336I\001LL\264U\256\274H\362L\266p"
+	.ascii	"\226(A\361/\002]\264=\033\242\nI\326\250\336\305\230\026K\276"
+	.ascii	"\004\3037G\324\246\276\305\027\345\001bY\270}\232\240\033\022"
+	.ascii	"\212H=\213G\002\003\304[\341\344\317\240P\226\\"
+	.string	"[9E\263\021H\374\212/J\374kT\361\366eqmB \023\361*>)\357O\316\364N\n)_\205NYrm\251\260a\206\336=\021\030\307!$?\344\305\350\220P\237\3421\200\375\265\231\3369\212\361m\214b\n\357\301@\361%\312\266otP<\216\275;\337z\361mL\365S\377k\3262\\\316\350\\.\250\336\334\257\026T\317\344\332:\241\"\251\036\307\336\226E\344\033\026\337\306\322\236\372\244\335\326\t\323p\305\324;\341l\227|\035\233\375\376X\266e\2426W\024E\205\324'\r\267K\254f\240\312\244\220zf\230m\222\357r\233\245\030{\206\202\ry\270\266IZM\nU\032\211\037\301v\330\bE\342q\354\331]q9\302\023`Z\304'\r\017\033\335E\353\224\210gR9\244\203\025\261\250\224Rh\302\031\033\352\223p\016\351\360O\341\235\024\324\363P9\224\003\3658\256\215WZ\311J\234\022\316\226"
+	.ascii	"\031\342\201\017\361K0l\033%\304\007\036\307\365\016\210\270"
+	.ascii	",\211\304\276Q\007P{\344\355!\3642\"*\306\227\370\260\226\202"
+	.ascii	"\246\235b\243\232>\352)\352\235\376I\333%\336\351\233\354*\307"
+	.ascii	"*b;\305B\375\370>\001-q\212\r\341\300\333\370\260\326\252\231"
+	.ascii	"b\241,\b\341\3241>x\370\246\377\220\214\361\036l|\323\347\270"
+	.ascii	"\306)\034\374\212\232\343y\375\343=;\005\260\003\243\215\016"
+	.ascii	"1\336\202\217\340\032\347\243l\021\204R\323Z\350\036\021\242"
+	.ascii	"\032\177\003\035lBt\340[\333=\002\030#\325EE\023$\270\205\370"
+	.ascii	"0h\330\324\346\032\320N\335\223\020\367}\327\\\364_\267\242\026"
+	.ascii	"od\2535\3205KL\240V\246\240\340\264\303\225\315~d<1:E\212I\237"
+	.ascii	"\017(\n\332)S\004\247\257%e\035\001\004S\232\2702h\f9|\206g:"
+	.ascii	"\333\360\0344\374\2067Z3-\242\341\217\366\b\343\312\f\nf\370"
+	.ascii	"\033\207hY\226q\260\037\236\177\306L\231\246\276Y\372\013\377"
+	.ascii	"|#\277i\031\206_:\372\247\306\360Fv\274\352d\263\230\\iL0\303"
+	.ascii	"l\200\003\376]\370\346\273\246\271\202\034[\301\203_c\375\221"
+	.ascii	"+\315\2335q\272\245\351\333XI\233\364H\257\364=-c\223\364\375"
+	.ascii	"\246\031@b=\322\273\001\202\223\250\362\360\030\215\242\250s"
+	.ascii	"\b\231\021\022\032I\2224\006\002\013\020\006$i\036\227\330\003"
+	.ascii	"\022@\2259+\25132#Q\322\032BB`\277\210c\343\026\337v\030/-\216"
+	.ascii	"\030\313\204RS\n\300\207\342\372\331\227\374\314;\204g&\177\225"
+	.ascii	"~\001\006\226i\375\243\364\214<\323<\241\301\307\t\2509\372\354"
+	.ascii	"t\376\251\255\224p`'?\"j0\334\255\234\034\007\240\375\302y\251"
+	.ascii	"\004 \367\351\004\336\333\360"
+	.string	"T\233Wy\270\324#\341G),\274\307#\3544a\001\032\344\241\302\206\373\027\235\234\373:L\201\205\203\263\035\320r7\240%ZO@\240N\360i)\257/j\334\363jj\222\226\363m\313\237O\330\343\200\350\304\277%}L\317\261t\354\337\365]WS\317\314\017\242jH\021\025\032\243\357\340~\263\246\271'x\255\371\206\020\016\223J)\342\321i\201\276\335\352\261\337\323a\220\333\\\212\275g\257\030\346U\037\005\013t\310\363D \235\253\0351\331\310\360H[\227eVM\225\261i\346\200}w\n\323\004.\220\211.\036\204\342/pc\232\273\247\377oA\353B\0323g\322\001\235\033qd\364O\212V_\301\245\025W[\352\325\025~\261\273\004\274\367D\322\220\342\006\001\200\302\341d%\220\305\200\325\300\t\352\254|\206:\261\245|\200\322\310\242\3006\023\212d)\314X\t\021-d\260\360\226\r\263\360\364\374\301BA"
+	.ascii	"\026\224@=m\321\311\236\031_\007B\337\034\213\r\263\021\033\020"
+	.ascii	"R\222\275\353/ i\301\230\246\031\362<\024\315\311\210E\253\226"
+	.ascii	"a\225Z\006\247\226\215\276G\035#E\267\020|x\357\234\270&i\306"
+	.ascii	"\250\370\232\234\272'BG9s\344\340\326WQ\366\224\227\216M`Vdr"
+	.ascii	"\022\224\334\246\301\t\017\377\333\032\310L?\260\024\334Y\225"
+	.string	"~\"\303j\024V\356\325c\225\037\357[\206+:\316m\020\245\036\260d\370\276\321IR\253E\025\307\026C\3449\206\372^,\260\316^\220N\262&\013\310\253\r$\344E\246\362\214\r\344%N"
+	.string	"q3\216\031\221\240\342bG\020C\327:\016\311\262\260\273x\212\272\265O\002IT}\277\247\220\333\206\341\217\024=S'\251\"b\327\3740\236x1\250\364\305\027\272V\034\305\370\037\025B\367e\375\2506\266\321\334\357z\311\332F\2649\210S\221]\264\341\032bI\030(\362\007\21249\221\201\302M2\321\304\020b\027A>Y\034\253\260seB-\245N\377\3113\207l\341\r\353+\313C\210=\274\225AR\321W\001\331\356\316\030X\331k\214 \023\353A\253"
+	.string	",7\231$\376\024;\253\217\350\242\257\3731Y\252?d"
+	.string	"t\317\353\035\213.o\267\354\230\331\347w\024\337\253L\001\362\277\261\3262\320A|\013m\213T\371O\252\363\307\333\023\220\243\024\245\035\030\353r\342\316\260\233\312\313\215\025\367\235/\257\204\313\263Y\2776n!\206\253F\307\332\214\260\bj\361oy\202\351\222M\224:\372\240\367\266\367\323\033\342\346\225\002xB\230+@\213\023P\341\2711\334\200\376\\\341\t\027\235\020M\342T\177\351qA/P\020\337R\016d/?H\236U\261\253\004Py4$FD\240\025EK,-\210c\334\346\f\334\026{\262\355\351\206\336\355\243\322u\204\002\020\242u\3359\037\030\t\215\\\021@\3510\031/#!r\223\003\036\311g\2474\206$\023Ph}%\326\004\224\220\216\034\035\304\t%\"\240\334\350\303\r\306\203\0054\307\bb\252\026c\203+\003\354\343\344o\342\003\023)"
+	.string	"J#KN\tn\301\270\036\264-\024x\r\310\n\024V\302\214\246=C\375 }\030\200\220\212U\005\325q\r\327\017\223\217x1\027\216\262D\004|\236\265s\337\257\366\021\241<.yB\003h"
+	.ascii	"\331\255\2174\204\253\035\307\332\356H\366\375\244\362\321\204"
+	.ascii	"\264wM\314E1\353\224h\246\277\346lW\3029\006Z\240\004\222s\007"
+	.ascii	"\361\336\235w\251x\343\346\024\271\313\243\366V<\226s\363b_u"
+	.ascii	"\242G\267\001\246,\230|#S\265\217?\021?\274\224N\336Jt\322yP"
+	.ascii	"}\303\333\235\255E\022\b,\346v\222u\2458\335P\224\027.\336\237"
+	.ascii	"\020\345c\227\337\276\240\2740\371\360\324\013:UH\376\327F\220"
+	.ascii	"\3428Rv\374\r-A\231Q\202\352yr\242D\260,\310\334:w\350l\306\270"
+	.ascii	"r\036\247`!d\3649q\\\245`\013p\325\003\330\276B\243\033X\267"
+	.ascii	"\237\314\250\206\337\314\003\206\013\001Z\350\364\221\377\201"
+	.ascii	"&\222\003xD.\035a\031\270\314m\307\266\3725\241\226\347X\320"
+	.ascii	"dK\224C\211\272\270\310\220\365S\251\205E\257\363\340)\304\355"
+	.ascii	"\257\200\203\314\022\3263\304D\324\260\017\330\027 \273\216\366"
+	.ascii	"\032;\002"
+	.text
+	.section	.gnu.lto_cliFlashInfo.287.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\215\006]&"
+	.string	"\032FD\017Bpj\321pM\300\347>\274\032nt\"B\232KE\255"
+	.string	"\200\030\f\006\027j-\305 \353\"\333pg\262<Yn\211\340(*#\274A?\261d;0X\205\032\206l\245\t\016\364\317\330\366\336{K\231d\341"
+	.string	"\317"
+	.string	"\345"
+	.string	"{4g\254\200he\231A\245/\263\377\332\332\315\225@A\275W\360+q\265:f\225\201Ho\376d\336\2655.\031\204\262\376p\330\262RZ\303\326\033\017!\3411h]\223\rn\356\204]N\326\b\344\340\274{0\017\243\036i\343K\353\272dM\233uM>\330\004\351\315M\336v\336L\317t\336\\uW\220\023\216UH!\353N\216\256\262u]\237\272\311\236/\223_\224\325\247\350i\226\315\352\276\353\345\321\fO\321(|Z\322\200\270\031\363\260\037Xe\205@S\304\374\353\212Q+D~\226\027\302t9\3660\022\313\336\362\232\363\257\037\270\362\003\213\315!/K\t>\202\214!\031q\224G\203"
+	.string	"\031\217\346\274\3038\344\376\327\315\343\230W\321H\344\214jX\327u\271h\004\362\245}w\253\354n\330\2569\026\235F}\216\t\264m~\220'.Gw\366\261\3126Q\034N\331\037\304\335\375\243\240\261\034\213T\334\315\n\356\3079\356\2628\033]\272\256\303\n\3735*\030\2514\212\214\363\346\033\025\262\206\314\013\362\006\237\355\021\357\272\340\361\213\007\272\024\3732\007\354\252\205\273I!\267V\036&b\216l/\331\375\326\227\301\202\237\371\346\316\365=p\257\357\355\344-p\362\0228y\235R\336\246\224w"
+	.string	"\312kKy\005\244\274L(o\200\223w\351\274JF\274I4^\244\224\367\b\345\005\220\362\326P^\243\224\227\226\362\246(/z\362\236)\257\211\362\226)o\243\274|\362\376\201\002>\200\204<\320\331\272\3728S\264\202\231o\250\374\314\357\365o\375\\/w\277{3\001\266B\310\"`C$ikm\204\342\271\240\315'|;\277\365\216\223\247\220\021\0332\242\227\353\272\256hk-\350\177=\r\3231\346E<r\305g{\343Z\037\265R\323\372i.\246j5\365Q\233\244\304k\301j\3416\340$(\252\024~Q\t\251\223\250\234\217j\005\251/\007@\037a\271\036"
+	.ascii	"}>~\220F]\353\253\321\3620\023y\324,*\027\243F\021\261\3412\343"
+	.ascii	">B'\031vZ\235\271n.\262D\b\230\326\273\352\0275\f\277\230k\334"
+	.ascii	"\260\205{kZ\327\216c&\216\237\346w6\030p\302!%\376\330\341\303"
+	.ascii	"\305\276\220\201\r\361\020\001S,["
+	.string	"k\037<o}4G\300E\366\207\214\237!#\352-b\206\314zo\374\3566\373\354\264_\346uB\330\372\254+\361E\021)1\205\002\022%\370\305-\327\"-\\4\033\314a\330\321\340EM\355~\301\037.\312\203\201\r\346p\301\034\356\227\303Y\230\312\341pIk\341\347\323A\325\226J\007\354\001\243|;\250\337\316\205.\306\216\006/\312A0\207\341\347\353\001\245v?\234\207\0211h3vSU<\023\030\354Y\351\250\316\252\036\017\310\003\372tP/~:\252\026H\273*\036\325\016\206n\304\024\f)t\245 \360\250\244\236\252x:\030OR\276\337\023\004\333\366b\354|O\300^\317\367TK\256\357%k\204\344\002v\243\257\366\306K]\240L\rb\033\222\022\337\205#\266p\t\264S\027\350\037\313\310\210W\256\016\021hj\247~\216E\003Z@7\265\271\207X\305\326\003\372\206l\235\341\350\340L-\240\315\256"
+	.string	"\315\324'\364$@\317`\343e6\201w\325\"\252\021~q\251\031 \263\"0_Er\356\252IT%\374\"\203~\327\003p\250Q$\245\240c\206dDDdDa\2325\200\002\231\251\323\035\02105D\020\r\215\335\034^\217\313(;M\264ad1k\002\355\2444\036\207\225\322Z\332P\303\353\217>\3722q\006\342\250'\365\242\366F\371D\271\311\271\216.\006_\343\003\f\326~\0068\027\240`N\252/\3164r\271\255\026\310\347\270\355\367\027\3770\023P\034-|\300\002\3551\"\t.Cj\n\355T\260y\177\345\332]_\312\005\210\260\177\264\256Q\247\335\365*U\f\323\266\2741\376\207\277Tw\263\335\346I:h>\273U\270@V\340\342MS\370?3\005\203\032\360w\372\"\235U\376C?ECj\216\274\205\314G5\222\361\033L\355!i+\256\306\300\266\022\377q\334\225\216\362h\035\372"
+	.ascii	"e\227e\210\336\002\013\356\204\205\r0\265\260\210\037\214\376"
+	.ascii	"l|y\342\244\363\250\340Y\2517\031\346\017"
+	.text
+	.section	.gnu.lto_cliFlashErase.288.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"U\n"
+	.string	"f\222E?0\3058\035\300\021\221wz\205u\b\273\251\377\360\207\026\212:\016\rl\313!5A\251\344m\307?6jh\224\374\004A\364\177W\317\b0\031\236\300\235\305\304\232\231\bg\227\207\364\324\310\226)\0052"
+	.string	"3"
+	.string	"2"
+	.string	"\bv\267\233&\241\206\317\246\206\276\301(>\343P\237Y\002\231z]\306Q\246@\240e\372\352\n2\222T-\233\335\265\236F\221[\273m\t\333\017\3661\001\t\266\245\261Pl\377b[K\016W\303\325~\312U\302\253:\216\331%\003\b\330-\035\274\300]s\371\314v\215\373\301v\315\241\355B(\255\b\221\"1\001\b\333'\305J\001\222\302\274\251\235\241\241?}~u\fK5\2405\232\242]\212:K\016\214\220%O\322~\371gW\375:\325\347\030`\037\250\277b\273!\261\236\320\007\324\371<\213\347\343Lt>\317bO\363\001y]\350\303\371:Ot\321i2\006+<\242\016\003\004E\335\245\334o<\346(+P\033\264\320\237<#N`\006\2467\002\024"
+	.ascii	"\357b\310\f\rF\354\020\200j *\354\375\331\374U\256X\227U\f\213"
+	.ascii	"\270\240kT\253\2550\036\250\006\256\200\271\001*\312\270\313"
+	.ascii	"M\265G\003S{"
+	.text
+	.section	.gnu.lto_applySimplifiedTuningAllProfiles.289.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\312\001\r\021"
+	.string	"\246\037qH\360\260(\035:\230\350\366"
+	.string	"\177\351aN\205g\204\020\004j\006\020\210R\260\352H\370oq\355\325\334\343\244\342\326\267:d\307A;\205\261\177B[\364\203\023\231KH\007J6,\270\206\306gE\275\377z\367\264F\366\336;\245X"
+	.string	"W"
+	.string	"a"
+	.string	"\242\327\002\007\351^\351\005t\257r\344\227]#d\2660\006=/PP\344\330]o\202\360<\035o*_\257t\312\227\037\032\2219\275\251\264\020k\260W\032`w?j3\212@\322j2II\260|~|\275\245\344\304\032\313ehdw-\305\332\312\335\335\266\3136\312\276\214=b27w\0276\247\315\036e\362;?\330!*]Os\313)}\321\202\030\235\226\247\340\330\345\220\343\261>u\305\210\323\374\366}\334mN^c\321\356\236\030\303k\234"
+	.string	"\350\006\314\356\216\354\317\370\243G\257~\211\233x\235F\344\273\262\327p\353\201\021\264;\036x\265\201\263\203\001\262\201\373\271\361 \2239\177\310\2378\3177\007\340xp.3\2731\235\357\234P\337gK(\221\027\375\361\337\340\302eu\004\315&\314\267\271\n\nt\347\342\205\247"
+	.ascii	"\351\214\020\273\333\340\3468\023|\021\257n\231\310\213\257\276"
+	.ascii	"I\367Z\347m^;\274\374\354\340\344\264\310\371\371\361\016n*8"
+	.ascii	"(\001N\221\300\320\002\312k\205`kuj\021p\212d\372X\236+\205\372"
+	.ascii	"T$!\025N\246\325\203\223\352#\001C\b\246\217\005\300%\322\247"
+	.ascii	"*y\253/B\211W\n[\036\t\304 \353\024z.\020\f\275\321\030\273\314"
+	.ascii	"O{a\341\023\233\262:mV\2203C\263\306H\323f\f\034\215\fr\307\351"
+	.ascii	"\356.\235\266\213tr\206\002& P\002RR\221\007,\243\244\031\373"
+	.ascii	"c\bC\363\210\311\006`\020\020\277\367\375\306\256\023\013\364"
+	.ascii	"\370\220\306\351#{\245\226x`\223%\325yh\333\210\235\264\227\240"
+	.ascii	"\027\200\013\212\021\316a\003\031!o\205\274\305ak\267E\f\205"
+	.ascii	"\276\257\210\314l\334xC\306\336\346\200 \312\246+?\001"
+	.text
+	.section	.gnu.lto_cliSimplifiedTuning.290.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\247\003\365\032"
+	.string	"vq\257E\220^Qc\f\002\007-\203X\231\344ROd!D\002\034\355\254\3124Z\035\256x\263\326\323|\210U\344\351h~M*-4\303\007aY\002d\310\263\233\257O"
+	.string	"\251\360\340D\203\033\253\273L\352n\273\345\2262\245\226"
+	.string	"\217"
+	.string	"\241"
+	.ascii	"0\333\264\030c\016\204S\373O\207\342{\024\031\037p\357\020\013"
+	.ascii	"\313\275\305\b^`\336\272x\236\362\326<\201\362\326>[\215\001"
+	.ascii	"\340-\242p\225&I\352\315\275wV\213\270\236,\336%\365\375e\272"
+	.ascii	"J\273CV\352\363_Aa\321_\346\220%\037w\221\002\356\2751a\022)"
+	.ascii	"\341\336\373#\220\226;K\230nM\246\357\214\321\321\343QW\300D"
+	.ascii	"\307\017J\376\347\343\225t\240u\345&&<\"y\224\220\004\037ujC"
+	.ascii	"hD\251\013\303\275\3274(\\\272a\267\re{h\327\n\001\017\376\272"
+	.ascii	"\302x\346\210\3061\214^\312\255X\230\367\"=\2103\22140\2705\253"
+	.ascii	"\255kA\037|}U\023V\026\260\026\331E#Z\211\366)\220%\034V\\\207"
+	.ascii	"v\254\244\006\360(\377\353\305\337\274\324m-u\265\324\324R_\300"
+	.ascii	"\2041i\230\236c\315\275J[sn\226\315\222\344R\277}\277\312\251"
+	.ascii	"^|\312\346\275\367\205\211>e\013f\352<\271\367\302\354K\361\217"
+	.ascii	"\206\335\372\306O\361]"
+	.string	"\252\301\357\322}\r(Wr\264\356->\270\365\004\363\266\207\244\001;\266Q\331\030\321\034\3218'\313J|\203\322\326X-\261\230\241c,s\fbD\267|\200\236\312\301\370\324\002F+F\254\247{\177^\376\345C\b\037\037\233D\211\037\377\034_\204\024\341h\235\352]z\244\225S\020\306\271\230 \3118\335{+h\371\226\023\276\221[\243HA\037LQ\336\002\250\247\372\210&Oo\234LQ1\331Z\353\217\347pD\251LR\235\037\335\252\367\336k+\321\377o\035\322:\343J\005\315D\362@+56\265\311\002\036\n\210eE\306\250m\013\242\017\272:\314\r%\267V\242\003\226\005\345\316\234\213\241\236\232\355\004:o;\334\331\353\251i@`!\231\216G\0244\353\361t\275\234\255w\300B\262\332\271\233\r\t\005\2357 \003\266\335V\320zg\3154\321m\267\243\2250l\265\\\007\333\355\004\322\361D\324\316]"
+	.string	"[\356\274\331p4\0205\334\217\313?\262\363\3663\313\2354\334\354\207\327\233\311x\254\333\331x\263!\235\2167\203\025\177\257C\303\210\360\310\372U\243+\257W\265}PUDv\\"
+	.ascii	"bY\231\t\304d(\340\264\301D:\r\006\2676\207\0164\352\003\252"
+	.ascii	"\232\266\262\216j\221\357\252DS\b\332X\265q\002H\250A(\307\024"
+	.ascii	"B\002eH\005$Ba&M\007\220\202\231:\223\007\020hi\223t\001\214"
+	.ascii	"\210'K\023\324g\362?\224\201\274\202s\363\037\325\331\200\201"
+	.ascii	"n\317U=\243\034E\005\321\205Xt\356^\250*\003\3059\303\216\234"
+	.ascii	"_^v\322\330%\255'\255f\330\357I\004\3268\226\300\\\336\310\343"
+	.ascii	"\325\350\212\240\331H\005B\322\334\013\340\302\207\376\032\261"
+	.ascii	"-\266\333\315Ej\216\263\257 \315M:\301f!\022\353\261\r Z?\257"
+	.ascii	"/xK\333\3329\261\355\024@\304=\321\265~2\273a\303T\024\211\243"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_printName.291.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\257\001M\021"
+	.string	"\266\341wF\360\320h8\032\3170\351\206\331\037'\214\272r\314b_\337a\212\337\231\305L\371\234\316\354y?\244E\266\022k\270\032\374\324\232~\267%\2236\003\374K\361\344\320,+h\246NL#\"\262\273ul\267\275\267\224)\005]"
+	.string	"^"
+	.string	"d"
+	.string	"k\353\021O\341?\217\341\323\276\316U\310\276\263\301\037\273#b\004\355\216'\027\b\377\231.\002\376\363>"
+	.string	"\374g\231}c\204\303\316N\204:\334rG\273\213\322\022\227\335\323\224\371$\224\017\0217\273\367\341\n"
+	.string	"W\363L\273\373\334\223\006g\313$\241\354\256S\304y\270\277\333N\261]\301\316/2\340\277\353s\030\375\244\320\321rg\217\263T\034\373\336\356\256\365\306\376\316\037\202i\322}n\360<\377\007\246\365K\247\227>\b\013\250F#'T\243D\343\326\354v\354\320\247;q\237\337\376s.9\301\211\354>\032L\263qkH6lF\235\243\335\361\300?3\260s\374\n\331ydF\002\004A\030Lrvg.\246\302\231\024\222\177\251\241\332\252U^\264\351\2463\203\232z\272\365\240\345\316\363\024\007h\3453rvm\027\177X\257A\322\213 h\271\313\334\335\231*\216\017\343W\n?D=F\266\324a\237\005\274\202z\0367]-w\b\376\202\305A\321\356.\260]w\361\nwm\nZ\304^L\212L\004>\245a\006L\rV\256T\213\211"
+	.string	"HHH\254\025\223RYA\200\265R1/\253\220\025\226J\313\353A\354\325b\271\224X`\251\b.\256\230\f\241U%\254\226\n\325\302J\271P*\030\030\252D\304/\227\025\f*\366z\301\240J\343\336[\275q*IE\204ln2\322\327Y\220\020\002\207\b\235\013\341\314\004\222\177\2524%\022(\206hZ\263\200T=\213\007\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\307c\320aC"
+	.ascii	"\234\210\206\2531\301bBk(X\337\013VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_printBoardName.292.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\r\001\375\f"
+	.string	"\226XXB"
+	.string	"\2216\035\034\n\240\216\226\337wQ|\232\214m3\211\212\304\237A\371Z\273\265@\031\252\306\177#\"g)n\003\220R\370\231\351\313\207\\\262j\361\0358\">\301fD\373\223\f\013\324\240F\366\2262\245C"
+	.string	"B"
+	.string	"E"
+	.string	"\217\360\001\246G\177\354\030\003B\313!P\301a\205\204\214\335\305t\303?\217P\363\343S!\033\336\307=V8\fY\037(5\363u\360\332\335\207x\262|\240L*dw\235\336G\341\236n\233\201\355\004\366K\002\027\272,\331#.U\203}\270\273km\261\017\363S\232\2060\255\232\316L\237\343"
+	.string	"\214\027\013\027\235\330\235P\242\261\244\230\242\203e\373i\377\303A|\016\023\301\033\273\031V\240\330\035}\230@\365x\275c\ny\317WH9\2507\341\022C\352\224\263BmRU\360\302\037\001A\253^\374mzT\325\032,\242\224,\231J\333\203\222\367R\357\001C\247\334sw9\265\307t\025\021\341\002\2243\f\340\036\023\245WK\202(f%\366\024\2706Zf\322`\244\223m\"\031\022O\266\340DC\031\251\254\001\341\224h0\023N\246a\232\216\007\003\351\360v\262\351`\017\266\255\203Y\243=\\m\261\\X\220R\264\213\231\204\372\321Kl\004\264\330U\271\347\240R\3710\360hsH\002\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliBoardName.293.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`:\004\235\036"
+	.string	"6\270\311J\220\026R:\200!X%\f-\323\007\f\353\3118I\fn_\323Ns\224D(G\202\275\0060'\37017ogVt\343\241\207\325\031\235\002\260`\301\207U\024ek\203\245\367\313\3274\020\f\354\025\326\313\177\306,!\204\310\235d\266"
+	.string	"\250"
+	.string	"\262"
+	.ascii	"d;\320\3565.\270\311\016j\326h\302\n\203[\346\367x\327z\037I"
+	.ascii	"\247\271\267\212\210\221{\215\r\030A\355&\033_s\336\254=\300"
+	.ascii	"y\223W\346\263\001M7\370\200Lk\b\346\345\336\233k\254\257\277"
+	.ascii	"\331R\231\030\3644\313\266+_\354\007\314\242|I\001R\f\376\206"
+	.ascii	"N\260\031"
+	.string	"\220\0015\365\024\211\343I\312\312\340x\232\212\2621'\r\251c\2174\031P.\216\236\245\312\3448\234)\n\313\233*\030iiqhM\365\336\233\026\233l\211|j\221\026\231l\2275N5\210G>M\2259hG\270\\\354\026Eq\311Zt\302\275\227-\261\bu\23693#\231\371\004s\177\005I\347M\333\345\026\024QJ6y\233\244\311\311F\267\025#\235\267n\341\220+_T\230\354\027\276Y\346\021C\366D\\w\225\253-\307\245\016\362\373\326\r6\f\243d\223,cm\315\3743\262'\276o\242\266\236\322\320\230:\310l\f\332\266b~'\223\311$w\025si\331\346>~\232{\235q\017;\337n\374m\247e\364\264|\242\226\315\322ryZn\323\262--\177@cE9\245Pq)\261{\235\222`\356\321D\242u\257?\354_\027\343\364\307\301\326\207!\375B\335\237xB\306%\241vS-\275\222"
+	.string	"\\\344}\321*W1^\310\264U\221\237}\035J\276\004\310\317\342]\217=\261\347\274y6\t3'\\,\262\262x\201\212!`q\375\261'\271\360\262\031\031j\302\037\316\315\217\275\314G\301\224{\205'j\250\twpn\3224\363\006 {\"?\310U\332q\330A\316)\256x\201.\270\33135\004X\233\2665\256\231=|\260'\232\215\272\240\022v\260,\320\005\311\361l+\266\351\262m;d,\256\354\213\275\002\031\025\356\314\344|\3334\333!\213%\233l\bC.\021\023xv\3333\032\313\034$dO\354~\027\325R\007-c\211\nN\225\275\323\366\257\370B@\364jY\374\254\343\373\t\025\005\251%|\033"
+	.string	"\360.\203\216\027D\341G\347\263\2232\0160\001\216\032a\007\204A\327A\345\300\333\375\374"
+	.string	"\361\250:\024v=<\235\005\036u\267\243r\360\341\361t<*0AN\221\217\250\217\204\214B\304\370\212\206\210|?!\236\210_\017\345\236\316\020Q/W4$\364\313\365\216\2009\235\0326\"\341;\312\22502:\312\245\306\373\362vU\212%uT\352\245\362\336{o9\266\366\225\306\311\274j\2557\260V\034\231:\330egS\2206\005\366c\177\262\346\270Y\267jB$\234\233\314+\327\312cf\t\327\017<\233\254]\2172s\342E\213\212\274\241\225\242m\221\252\216\307\236\210\366\267\250\230\240\004M\250a \244\214\223\210P@2\023\320(,h\016p\002\031*4\017\020P\tU\315\001"
+	.ascii	"3\253\036^\300\275\336t%\212DP\314\005\214\324\006xWgoP\004b"
+	.ascii	"\344\314\207\340\245k\337~\242'h\262\222\271\314d\036\235\230"
+	.ascii	"\352\221\024B\341\273\205m\350\030|\257f\334\024\250\\C\313\362"
+	.ascii	"E\243o!\3555\336H\253)\232U\360o\216\276\341/\310:b{\214\020"
+	.ascii	"\315\2523\326A\214*\023o1<\317\205k\"\232\261\221\326\022\314"
+	.ascii	"\001\002\312\250\276z\357\361\361H\335\357r3_\204\324\301z\317"
+	.ascii	"H\261\365\035c\330\235\3577\253\301\177"
+	.text
+	.section	.gnu.lto_printManufacturerId.294.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\022\001\025\r"
+	.string	"\346\030YB"
+	.string	"\2216\035\034\036@\212\226\277\227t\353\371\347\373M\316\310\314\20269z\334AP\035\252\306\177#\"g\021\213\013j(\355\314\255\177\222"
+	.string	"(@\214\322w\3506\302b\356\277\0026Eb\353F\366\2262\245B"
+	.string	"C"
+	.string	"F"
+	.ascii	"\324#|\007\365\350\220-c\300h9\004-^TN\320\330\335LI\017=B\315"
+	.ascii	"\220_"
+	.string	"e0\336\307=Z8\034]\237(\225\343\353 \266\273'\361\\\371D\231Ufw\235\336W\341\246n{\201\355\214}\222/*\030\272<\331%.\225\203}\270\273km\261\357\362W\232\2060\255\232\316L\037\300\201\031\022.\234\005\305.\205\223\2155E\026\036.\333O\373\">\"t\227\b\306\354np\261b\267\004b\002\326#v\217\356\214\344=c#\345\240^\005\t\204\251S\316\n5J5A\f\337\004\004\315\352\340{\250GU\275\261\222\001%O\256\322\376\200\362^\352?h\350\224{\356.\247\376\240\256\rJ\300\020e\r\007\370\007U\351\365\232\300\022\376\024\300D:\f6\316\006:\331h\034\200J4Z\307\310G\243\300D\003\211X\336\204tH6YIG\243e\233\355\223\205x\330c\302\331\262\023\217g\313\256\322\036\256\266\\\244\020&\024\355\"GB}\351)8\002^\354\246\334{`\245\200\030xt\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliManufacturerId.295.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`J\004m\036"
+	.string	"6x\310K\240VN:\204\033\313\322;\237\243\007\224\307<\233\236\367\231a\371\002aLG\217g\232\201\351Gd\272\333\326>\231Q\371k\371a\243\330$\236\265\340\312x\203n,\2266\347\205\310\202\323\213A\372'#\322'*#\204\020\"w\222\001\265"
+	.string	"\245"
+	.string	"\257"
+	.string	"_bc\367\n\033\234d\b\247\025\242\350\342\340\226\371A~\245^\b\322\005\334+\005\226\344^\341\003Vp\236d\341g\312\223\347\007\224'Ye\276b \305]#|M\371mq\271\367\326\232\352\352gh\f\314i\226\344\330V\345\2339\t\304\276\364\250\020\t\256\237\2319(\202\031MP\217!\352`z\2620\343\315\230\022\262\353`\202\032g\226n"
+	.string	"Odra\317\322*\206\223 e3\232^\334,\307\024l\370\243\005}c\215\224\21424\370\263d\n;:\241A%\333D&\2501\275\367\276\353vE\260g\255\231s\357e\013\f6\235\001\234\231\211\314\354\304\334Z\0014d,\263\217\316\036h\373CT\257\327\277{\212O\224\263n\037\022\033YV\224l\027\006`\231K"
+	.ascii	"\331\003i=~Q}\r{\275\362{\326\275\365\373\222d\213\034c\321f"
+	.ascii	"\026\"\262\007\276k\236\256n\331\230R\257\314\302\325\366\024"
+	.ascii	"\363\273X,\026\271\245\230G\3134\027\362\313\034\353L;\327yv"
+	.ascii	"\341\217\222\226M\322riZ&G\313ci\271I\313v\264\374\002M\305e"
+	.ascii	"\211E\213\303(\336\273T\364r\207\344\022\034\307\372\271\236"
+	.ascii	"\365.F\265\276\245\236\353\304o\323\275\212\260\257*\267\363"
+	.ascii	"d:b!\311\\\342}p*\375\036QJ\275Z\255\260_\026LO\031y\331\347"
+	.ascii	"\361\344P\216\370U\214\323\261\007\352\224'\3136!FV\346\224\304"
+	.ascii	"j\254w\036\260\264\276\327\233`8\223\032\032N\037\317\346\344"
+	.ascii	"\275\316d\003\203*\367\372\016\344p\372tlN\3124s\207\036{ \277"
+	.ascii	"\bU\223\341\257W\256-Y\362b68\33142\002\226\246\321\2465\363"
+	.ascii	"\007\020\366@\262M%Q\276^\307\262\247\230\246\307\236]\211\261"
+	.ascii	"\264\261\337\365\nR\242\002\234\301\3127M\263\3759\365l\261Y"
+	.ascii	"x\357%C\224\335\026\013\377\310\210\020g\025\037\251<\331m@\313"
+	.ascii	"\212\247$[\264\367\336;\036\225\266\037\214\363\003$\"5\332u"
+	.ascii	"\230a\n\027D\354\340vzxn\266\n=9\233\006\031\266)Z`\223J\300"
+	.ascii	"\365d\260yHyr\270\235\235\236[\212C\001\247\223\263Y\270\245"
+	.ascii	"\270\t)\317\206\\\316vK\213\026\334\f\355\202\372\347\002o\307"
+	.ascii	";2\322\371\2208\032\362\021\242\355\206\200\202vB>\271\037!\235"
+	.ascii	"\311:\034\240 ]m\b\310G\250\246\343\025\325pf\230\310\304\216"
+	.ascii	"W3\"\"\342\325P\341\375x[\n\245*\033&u\217\307\331\215=\257Z"
+	.ascii	"\225\314*\0165\207\226\241R\257\2152\260\367z\230\272\243F\355"
+	.ascii	"q\372\336\2639\311\254\376P\201\320\240\f\371\217J)\352\325\237"
+	.ascii	"\304\266\370\310B\343\244*J\214\331\226\230\332n\366@3N\250a"
+	.ascii	",\204\220\203\306H@3\"$\005\246\306\240\002\221\251:\017\020"
+	.ascii	"P\351D)\fc\230u\256\231\363\277\033\236\371\242D\027\377\376"
+	.ascii	"\274,\013\034\267\201\016O=F\321\210\365\264\017\3258\356_{\r"
+	.ascii	"z\204\240U\r\313d3\300\303T\003\021\b\305\274k\266\3119xu-9\030"
+	.ascii	"G\271\307\202&p5\217\302\331\r\244\315\307\2200\361\252C\315"
+	.ascii	"\355'\212\271x\335g\332\266#D\353\332\331k`\241\352b]\f6w\373"
+	.ascii	"A\242\224i\245\241\001'@\234\300\244\270\177\007\360\340O=\216"
+	.ascii	"\324uT\273{\247\354J\311\211\017\243\245\3431T"
+	.text
+	.section	.gnu.lto_writeSignature.296.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\317\001\375\020"
+	.string	"\226 qF\340\322&\035S;\336w\346\322\21700\016O,\264]\245Y\220\2274\230=>${\372Y\344\353\271\345\365\033k\276w\027\320c\005MC\fF\020\303\372l\254\217CN\346K\306\242%\321\032\372\"ido)S\n\\"
+	.string	"X"
+	.string	"["
+	.ascii	"\005\270G\177\037\331\036\271\017\330\036\315\262{\020\220\331"
+	.ascii	"\026\212\215\232kf\264\273\235\2360\311\341w\303d=BM\226\337"
+	.ascii	"s\230#\333\361\212\265\036\341\215F\020\235b2\320\201K\007\210"
+	.ascii	"\323\236\260XL\302\0255\327\323\036sdA\257X\315\223\364`w\235"
+	.ascii	"\257\030\315\275\335\366\3126\004;\001\004/}vsO\2234\275m\351"
+	.ascii	"\030\323\020\2465\323\251\351\213\240\230\350\020\342\262\237"
+	.ascii	"\335\017\265 +\024k\250\370\354\366_\3704\227|\237\303`}V\362"
+	.ascii	"\245\331\317\344\334\230)\332\375\020<\232\001\367H\002_\262"
+	.ascii	"\235\337\313\017\005O\373-\356\202u\236\r\017\260{#\203\306\356"
+	.ascii	"g\3426K*\3772\211\247-ojR\222\036\310\323\211\272\351\363%\033"
+	.ascii	"\247Q!\221\307B\025\352\201\\G~\f\r\027\270\024\376\313\366\250"
+	.ascii	"z\230\b\230\254\371Z\322\324{:1Y3\247\327\323.\301\203\f\207"
+	.ascii	"\353\b&k\252E<%lTq\354\257\225\"=9\206\2547\366\351<\277\351"
+	.ascii	"\337\003\316\260 \201\201\210z\210j\025aE\205a\225\3222\001\345"
+	.ascii	"b\262\312\t\252\202J\327\202Ja\351TT.\335\311\210S\026VT\335"
+	.ascii	"*\225Ru\245o\337\363\303P\330\b\301hLT\034\207\354\350I\343N"
+	.ascii	"\032v\037><8$\220\303\335]\2508'\025@$\013\362H\230\022\352\177"
+	.ascii	">\003e2\264\353\375E\201\363\032\034x$i& \200\002\2423\356A\265"
+	.ascii	"\376\030\341h8\271\020\003\013Z$\316z\323\261v\232\005#\374\306"
+	.ascii	"\340\021\211@\3418\334\r\372V\177&\331\004oE\361\231\242\200"
+	.ascii	"A{\242\354\013Dk\374\312\301\312\020\231\354\256E\323*\336\330"
+	.ascii	"Q\004`\345\264K\260\b\356\025\313\361\300DL\327z\002"
+	.text
+	.section	.gnu.lto_cliSignature.297.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`z\n\375:"
+	.string	"\372e\310\026?@\346M:\f7\260s\211\332\366!\001\350\226\204\352\237\343\\f\030\332;\205\247\351\246\006\033\00560\034\034\324\271hI\230\202\314~t\247\016x\353\350\031\331}\263\300\317n\310\210%\204\354\235dP\001@\001]\001'\330\253\377\233\313\371\263\205\3759\247\323\276\216\217\347\264|#\230\240j\321\2343\t\366\2521\205\3638\355\353~H\202J\321b\257\336l|\233\323\265w\003\344Y\231\331D\320:\321\234\231\016\256\366\004\366jj\344E6w.H\337\203\337\356\247\271\\{5C\036\225\363\026\273\273\234\347 t\002\366j\317\275\270^e?\265^\355\266\233Q\200\262\234\244"
+	.string	"Ub\366\206R\3169\013wi\343\323\2717{\333W\025\251\246\244\242\240\236\210C'aS\220\005\256j\n"
+	.string	"\337\266\337\204\226|U\321*K\332\227SMI9\243\366\230m\251\021\216\351v\241\200ooQ\347\237\330\254\\\"\034\223m\217\271v\207H\250\035GY\322\274\334\211\312\025V\201cN\271M\351U\\\245=\337c\262\245\002\340\224\271\375y+8\246\224\033LOiJ\3377\230\021b\362\273\262\313\002\255\270\244\251}Mq\2338xD4\263T\203\334\231\266\343)\257\372\347C\274\265QJ\343\227%\355\355\351\213\250\035@\332 zg\322\367\230`\322\342\222/K\262\213S\001k~\232\374\356V{\314(\351\225 -\213\376\374=C\033\273\027\330!\347\334w\211\226\366\016\360\356\307uw\264\233}\0238\305\370\217\222\314\030\306\370f\231\356\027\254E|\361\361\256\342\351\326H\t7v\377pT\r\026)j\325\355\2717t\265\302\267;\240\257\007\210rV~\311\202U\306\300\272\252"
+	.string	"w\273\200q\277\354+rC\243g\206\223\305\263:\177R\334\354\277A\242|\007"
+	.string	"o\35198z \321\361\221\335J\034\"=\3370n\266\217\325\nc\245\236Ft\200\310n\245\376q_`\275\356\030\370\236q\314c+|Lf\231\212\334\277\216\272F\334-c\306\375\362\370\317\377I^\236\354\027%\303\311\356\271\344\305\315Emf\2324\336\322\r\341j~\005\257\363\266\372\334o\274\235w\221x\233jx{jx[\212x;jx\033jx\373\211x\233\350t{H\274\3554\274-t\272\335$\274\035\274\267\331\246\333\300{{\005\336V\357\3554x\033\263\267/\360\366=`g\336\022%O\316\366\227\363\222\277KYO\305\003\346x\376=\277\235\337\315_\367\327\371\332}\247\237\347x-\324sh\373=b\3016\250\227/\366j"
+	.string	"\374\251\025O\020\250\274\227\217\366\006\005\023\315\371.\005{\273\376]\013\257\332YpD\016\352\214\346<\027\210\354\256\221\026\312\241lQX\345\353\260\256\336\356*\333)\n\252\260\312W\241\343\264\"\341\022\337\264X\b\260ii\233eD|:\316*zc8\3317o\315\021'\334l\007\037\342[\346\3015\236\304\352$\247mk\235\355\333\375r\210/\346\312\0021\355\230\373\245\023\276\244\313F\301\004E\210\\\205\370\\\350\370\256nwk\246\215\273_\n\261\213+c8\371"
+	.string	"}zO\232p3\357{\314\320\001\002r_`=\237\222\3413\024\307\3140\251\356.\210\233\035\254\264B\300j%"
+	.ascii	"}\306@\t\005\3634\347\234Y\334\354\252<\2745u\305,>\353`\027"
+	.ascii	"_\240\270\252\333$\251E\023\241\225c\225\317\306 n\302\367i\226"
+	.ascii	"\251\377(\f\314K?\310z5\310\036\352s\036:\2232\240\013\226D@"
+	.ascii	"\334\204\200\177w\025}n\201\224kA\360\210\2459g\341\020ms\377"
+	.ascii	"\032\210\273\333\353r\3325\005\330\226\217T\f\304OO'\236Y\246"
+	.ascii	"\"\320'\177aV\334\\q\177Q\020\002l\006\256>\013]\242\343\371"
+	.ascii	"\212_\360\371\361S;p\241\370<\317\026{\fq\277T1\266\344\346H"
+	.ascii	"Oy\260\265\320\361\300\250\020\345\234-\334\2537\360\324\"\r"
+	.ascii	"\270\367$\326\024\237\317\361LT!Zv\237H\221\341\212\022'\033"
+	.ascii	"cc-ve\034v\004c\017\244\212\247>v}yiq\205\030\241\242\251\261"
+	.ascii	"\304\256\260"
+	.string	"\214\030\216_%\264V\030\275\270\216]]_[\306\b\037\216!\270\216\036\214^'\270\270\264\266\214bW\r\232\006\327\327\t\020\306\256\243\327\226V\227\226\210-\002\315\340\303\321k\353\210\242\305q\201\261\306\225\021\203\b\257\020\\\307\022\306\017#Jh\255\340\032\201\240\373\356\310\201\354\221\326\bCb\260\207!q\340 \217\036*\220<|\364\230\021f\003L\314\t\031\006\206\003\231c\006W\215\0344\200M#\002\030\016\032Ya`3rd\321\340!\226\025\241\330:v yd\365\320\241\203G\2260\277C\021<\366'UA\274G\317\2455\271K\200c\004\247\b\304\315\217:\252\017XW\210\370\001@D\304\022\253\374 \"\230\210\374\341\351\225\341\344\005*G\342LI\270TT\370\212\234w\364\030$QcEj\n\3372S\370b\006\214\321\323$J\n\377K\024)\334\202\257Q\205ClmP\034\356\355.\224v\354"
+	.ascii	"[\031\253|\036\254\253\335\255Y{D\221SN\217,\312@\024&\346\365"
+	.ascii	"\231\363\213\376\310\225y&\204\257\357L\244KF\320\332\023\024"
+	.ascii	"\276{\027\356\222\026\355~\t\205o\346\n\031N^`\227;nD\334\354"
+	.ascii	"_\372\023~\337\263\213\004\331\367\322-\223\326\311\375\262u"
+	.ascii	"\262^}\302;\370\026\371\251U1\301\242d\370@\001\200\322\250q"
+	.ascii	"(\303\030TH\211\214\210\214\264\240\240\031\003\200\002\221\251"
+	.ascii	"\262z\022\340\325M\211Q-\250e\377\331\f\3070\312$Z\350\f\304"
+	.ascii	"0\324<\036\247\200\331\207)?l\030SU3\037&\342\330\250\201\346"
+	.ascii	"\341\255t\002\006\0065\307\016\1770Y\004\241\325\0310\b\204z"
+	.ascii	"\002.y\354\271A\030n\232Q\260\275\307o\206F<\237\2344\334h\314"
+	.ascii	"Y\361v\026OS\241\300|\001*\246X\267\35478\377\233K6WF\371\371"
+	.ascii	"\2558\312D\374\004\034\260q\n\306\270\"\020a\307V\222\206\201"
+	.ascii	"\215\252\306\353~\225o\261\310.-gd\222\263>\307\231O\230\t\332"
+	.ascii	"\247\336\f\024\201_o\251\370\"\034\026d\020\266\255$\312r^\335"
+	.ascii	"8_E\267\276U[)\2513\376\027\037\02752~\347\204i\273\266\252G"
+	.ascii	"\210\230\b\f\276N\225\005\357U\201\267U\262\266\bS\231\007\267"
+	.ascii	"J\356\324\023)\264\212wA\305\317\341\362\3667[\022\266T\026\234"
+	.ascii	"S|\261\271A\3349go\274N\376\n^\030y\342\032\024\267\232\177\320"
+	.ascii	"\001t\016\276sb\236lO1\nd\021\205h\317\372\237+\005{h\322NRG"
+	.ascii	"\264\327\261o\260\201\302\343\270_>\247\301\206\243\323\231\271"
+	.ascii	"\203\207\004p\340\302\310\317\227%,w9\357\333\203\372TR1_\\\032"
+	.ascii	"\t\330a\021\032\306\237\320\3422\007\f\355n\204\206\001\216\254"
+	.ascii	"5\360)^\317\b6\3659\367f66\227\3343\211\245\n\333<Oj\013f`\302"
+	.ascii	"\245+\224\240\377~\006M\020\312\237\355\037\004\231\034\327\240"
+	.ascii	"\206\364\242_\336_o\215\032"
+	.text
+	.section	.gnu.lto_cliMcuId.298.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"5\t"
+	.string	"\366\020@:0\217\323\001`<\222\2327\020\254P4\263\034\353\032\022h\357\t\265cS\373\330}cONSH\r[q\323O)\020\207\334\312\376mFo\246a\2445E\240\272I\354\336)\005,"
+	.string	"/"
+	.string	"."
+	.string	"\027\320\236Y\264a\b6v\364\270b\251\024\231\335\255T\344\342\247\350\337\344"
+	.string	"\244j\374\334\034v\327\223Tu\334\364\266\rl?\330\206\005\246\036\330\n\310[1\273\0343\261}e--\333\357l\317\362\342\205\363i\177\344$\342K0\036\260\273Ra\331-\025|\300=syO{\306\005\031T\303\333\234\267K\343|\363\237\034\305\344\271\354\242N\2368\024C\3023\233\302b\236\364\206\345\361J\321\321.\307IC\354kvwMW\016\256hX@("
+	.string	"\201\021\247/\034\b\215@Q(\374@\200\302o\363\327\001E_\035\201\237\260~%S\355x&I\204Ju\202D*\325\256\334k\226\256\334\261>^\001\016"
+	.ascii	"v\264V\302\277\213!\023\317\374\242).l\273\006\261\302x\240\032"
+	.ascii	"\270\002\346\006\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_printFeature.299.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`H\b\305/"
+	.string	"\232W\364\022Gp\\R\007\377jSH\214RE\354\020&f\223\273\364\331\251>`M\256\001r\314\026\n\223\0302\016\235\204H\215\216PN(\242\244\036 b\351P\217nh\271\217</\fB\006W\301\240\211\255k\311\336r\357$S\n\036\001\n\001\025\001\256l\266\217 P\271\333\324\260\n\231\271\330g\023\246\206\325\253\264\2635k\305\305\020\013\231\275z\3173\2734\273\234\221\013<\355\f\253\247\227\355\356\237\342kTN\345\2050\230\261\324\346* W\347\301R`\240\301\214\005\244\310\321E\302\270c\346<\305\250\215VO\333o\267\247\371\023*\207\022\243y9\377\270\302\314\031i\324C\253\247C\357\301\236\242\316\203=m\252\3563\302\254\\\005\2419\243]\263\3139\027\177\b\260\177\034Ez\343\247r"
+	.ascii	"\300\237\217\355\361V5\210S\364/U{\322\203\350\270T9\200\036"
+	.ascii	"\313\366\002\325$!_c\376\343\341\276\260"
+	.string	"\035\227%\376\370\322\341=\007\323\245\303\231b\227\307\303W\246\023\301t\205\241\303\234\263/\235\250\244+\307U\335j\314\203\250\232\305e\304\301t\225\241Ho\352\340\234\315\357\226\327\325\305\275$7<\265\341(\252\240\356\215\r\320+\013\355\3412rd\275\260\356;\233+\240K\2529\331\274n\370U\223r\316}\217^_\336:\336\355\030\272\273E\267\232\025t\312+g\322o\034a\003\206>Y\373\023\226\360Pje\260\356\233\3666\227#\361\264\026ig\302\236Jxgs\024\215\316\355\312\331&fu\357>\331\314\362\372\366]\243_\340E\337\335\344t\375X\374\03614^\334\324i}U7\262\352>Y\267#\225\275\251\353\017\322m\201\202\273yO\340\335\226\200\024\301\337\274\0378\322\375\310\245\270;\340\335nPt*\356F\016\305\275\310\257x\023\271\025\357!\241 \242S\361\036\376m \365\366\317z\373\200z\333"
+	.string	"\276]"
+	.string	"\337\366\301\267\t\340\333B\365\366\200\365\266"
+	.ascii	"|\273\007\337\016\200o\363\340\333;\370\266\216z;\370\267\201"
+	.ascii	"\352\355\337z\333\207o\263\370v\017\337\346\251\267\327\365\266"
+	.ascii	"\252\336\306\370v\212o\243\352\355\307\267/\276\355IN\\\324\302"
+	.ascii	"\2545i\274\023\231\271\356\342d/)\334\021\177s\277\342\356\346"
+	.ascii	"n\305\321\356\267v8\340\023\315.\315\216\331\315.=\177e\227a"
+	.ascii	"\326,\253k\353tR\252\360\236\254o\234(\307v}2,\336\200\351rI"
+	.ascii	"\r\336\227qj\31665\370A\232eK-\360\314\232\\\355\362z\323\207"
+	.ascii	"~\253\321t\370\236t\036\221f\215vy\213O\374-\357\200\201\357"
+	.ascii	"e\2308\230\016k\316XH\355^\374\313\007\324\213x\332 \224\260"
+	.ascii	"\037\225\260\247\300\004c\266\244\215=\201\263\272w\216\346\234"
+	.ascii	"3~\262v\245\363\3104u\264K\224\3027\372\304\037\376V\267\273"
+	.ascii	"\013<\364\026\224h\234\335i\215]\335\273\233\342\020\300,i\230"
+	.ascii	"n\352v.\360\333\265\210\340\t\331\"f,-g-?\216X\265B \360\364"
+	.ascii	"\367E\337m\\\272~\354a\373U\355\373\037\373\276\367g\033\327"
+	.ascii	"{\364\331\027\312\265a\274\357\275\252l\301x\377\363l\342l\305"
+	.ascii	"|\227\370\353S\370)\037\352\257\336\364\364\325\367\026n\302"
+	.ascii	"\343W\315\232tiw\201\323\237\360WN\033\207\376\375\364\325g\033"
+	.ascii	"\366\217\276\267s\206\276\310\377\205rZq\216\336\377>~\266`W"
+	.ascii	"\367\256\035\274\277+=E\022\035E\304v\024\221\321\220\tjJ\312"
+	.ascii	"\310d\302w!*\205q\252\005\323\257\311\241\244>\234P\321T\302"
+	.ascii	"\310\204\242'\225b\312h\202\251\004\353\024e|B\235\242\214\033"
+	.ascii	"X<M\225X{\211AS\212\245\242\212&\343Sq\t*\252\310\240\247W\260"
+	.ascii	"`\202*J\255X\001Ud\221\331?H\322\327,"
+	.string	"m\230n\352\254\376\n\300\2235\313\366C\"B\013z\323\211~\253\177A\337h\220\370B\277\025\306\201\226\370\323\fP\2021s>\200p\316s\323<k\227\276\b\337\350*\364A\\\234\350\221\224h\240%\177<!se\006n\233\2214^\256\320\377D\370\030\007\376\347\375\300\2037\360=3'\311\002\377\340\177\316\347u\276\300\013\225\004\336\347\3255\002\357p\236\252\241k\2529\223>\341\321\353\274\360Y%Z\2336\214\335\271@\337\356\334\340`trg\034V-\023\b<\035 \340\007\364\274\200\277\3126.\300\353|\317\013\327\264a<\037\340\3255<\357c\206\346l\273\r\007\234c\357\311v\336\1778x\235\337\371\177\006_\207\350\213<\370\316t\017J\264.Zq\256\302\004\200\222\250A0\303\034R\306\021\022\021\021\021\322$\215\001\220\002\221\261\"z\021`\265$vZ\230\202\244\003\240w\221d\324\235\217ft\005"
+	.ascii	"\fBR\367\211\335\201\323o\2239\263\n\263\313z\301\025\261D\202"
+	.ascii	"\207PV\247\374\233'\217\216\221\262X\362\206\202<\212\244\323"
+	.ascii	"[X$\346,dpp\025z\363\305a\256`\275\240T8\271I\334\307\360\233"
+	.ascii	"O(F|D\"2\310\261\240dLg_b\346x\216\3243\213\0361\b;\264\203\310"
+	.ascii	"S\re\250\340b\255\032\302$|\232\005f\033\020\216\364\220\020"
+	.ascii	"4\327\272\361,\375A\t|\016\b\331\230\315p\362b7\366\036\265B"
+	.ascii	"\"\r\r;\205\006\351\365v\b\221\3660\214L*a\037\3730\337\207\260"
+	.ascii	"R\342tB\033\377\243\212m\300\231`\332\363\301\210\211/\027\333"
+	.ascii	"\247\001e\365\020\302\367T5\311\370E\r\340\260\352\2745\266\245"
+	.ascii	"\320A&\256\264O\340\251\203&s8A{\234l\205\235\t\252C\317\037"
+	.ascii	"h\005(\005n\342\031\325\340\r\340'\r\333\316g\344f\322o\247\n"
+	.ascii	"\217\006\301\252\273@v\273\005\264\316~\366|$-!O\342|\311\235"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_cliFeature.300.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`8\013e="
+	.string	"*j\350\027B@\244Nc\033[\245\253u\300Yhq\006Te@\267\022RKW\215B@1\272\334\002\002C3tw\017\375E\376!U\021\277\031\375\205@\323g\235\316\2451\223:\020\206\021\0075\332d\357-e\222\001j\001P\001r\001\373x\327\313\307\274\257\036\326\351\336\204{\371\035\374/9\036\237\305\367ae\n\246\032\307\321\004o\363\203\367\355\222\325Q\035T\005\3279\177\356t\360\353v<\031\307N\302\370\305q4*\033x\337\346\350\225\356\333\367G\356\333\f\347\214\007\300X\f\006aj\347\304+\214\343XjCa\217\271\351l\364\371\210\205\317\2644@@"
+	.string	""
+	.ascii	"JIJ\244#\243d\021\021rH\350h,\276D\267e\267\206\363\301\316\004"
+	.ascii	"D*8g}r&\345K\200/\262\005\332\r\020\320\345\001\006\237\\\330"
+	.ascii	"e\334SN\003\310\0228E\217\322\0268\2354\027\367\244\242\225\306"
+	.ascii	"7i\025\211\255@\267\305\355\203\3177v{\321\233\036p\212>Z;\223"
+	.ascii	"r\243(O\262\b\324\326\240}\360\031\205U\272ib\347d\334t\021\207"
+	.ascii	"\267\272\3029+Q\230G\325I\347\344\236\234!9R\355CjqO%Z\350\203"
+	.ascii	"\317$a\226\350\343\323\332\031\222\033Y\007c\205I>\370lc\205"
+	.ascii	"\f\235p\036\367L\323E\275?\255\235\321\375=\230\263~TB&!\030"
+	.ascii	"+h'\026\271\213\204:\217\320\246nY\t\206\325?$t\214%\216\231"
+	.ascii	"Q9\230?\305=\215h\026\355\233EP%\363\347\203\317#\254\322\214"
+	.ascii	"\n\331\365\256\313\240L\255\211\030\3428\316\232\fz\366\334\364"
+	.ascii	"\234\365T\316y-\347\342Tq,&!\237\315\333\204`G\220pI\270o\365"
+	.ascii	"6\244\022\312\375\205\351\253\276B\007\245\262I\372\322\2571"
+	.ascii	"\241l\213\343\346\311P"
+	.string	"\274M\021P*X\350\223\345\363\301\035\021|\242\343\304\313\336l\371\313e\332\273\311\006\356\216\216\2306\3149\2738\232\034Qmq,\026!\377\314\2470\362\247\274\315TU\372dU\356[\247\235\202\032G\256\356\233i\337\217\3630L_\363\220^\3329\317\300\322'\373\276\336O$\315\372\264V\3056X\316Q\246\336lr\354\306\254y;\311\331\201\224Q\347\250\327\375\b\356\367\\\200\300\323\362_\236\235\\\235\233\230\036\375\227\220>\346\371\350|\317F\337{N>\357\271\350\321g\242\377=#\211:\017\021u\026\272\316GWg\343u.\026u~\2573\221\250\263\373\352\334\276:\263D\235\367u\326\256\316\207\220\025\347\356\r\336T\272\t\243\261\331UP,\330\376\301\375\357\037\363\373\375|\377\336\377\345\317;1\347\347\374\277|\300|\334;\336\221\242\231+\354;\231||\353\367\265\024\213\306P\243\030;)\207\367mn"
+	.ascii	"\001\376\030\257%X46#\276\331\241\231+\274\360\206aci\314\276"
+	.ascii	"\325E\347\266\\\232\017f\317\007\335T\214\205\367m^\256\3274"
+	.ascii	"\220\263\257(\337\313=*2\t\354\341\354K>\275\326\351\236\263"
+	.ascii	"\257\210i\027\355\262\223\271\036&\227;\263EK\233h\227e\243\247"
+	.ascii	"m\004\"\325k\2521\370\322^\356\024\324\353\035a\036\026\243\276"
+	.ascii	"?&\311\315\026u-\367\335\\\267r\320\322\261O\346,\032\352!\223"
+	.ascii	"\220/-\302\240\232(E\203\004\255U&Q\234\033m\251>L$q_\314\377"
+	.ascii	"\330\b<\020\304\3516\264\3312\r7\352b\276\307\006\215wJ>,\305"
+	.ascii	"}\033\265KP\375\334\021\362\245\205\345*\227 rBH\251\255\224"
+	.ascii	"fP\020\343\003o\264\313\334\234\270\342\325<\304\3750}\254\371"
+	.ascii	"\360\r\r\357x\007~S\266\301\275M+\273!>M \306\004w7\217;:P\272"
+	.ascii	"i_\372:\360\225\027\316\3626_@\275\205\265\300r\372d\256\321"
+	.ascii	"\035\034\235`s\203e\242\353\365z}V\343~7\355\254\235F\362\027"
+	.ascii	"3n\264\024\t\350\234a:\330\356G\232@~\326*\363\335l\377r\223"
+	.ascii	"\333\301\376\031U\316\035a\236Z\024\242\223\326\373|\207\243"
+	.ascii	"\201i\316\324\333T\321\301\203\346\203\313\"8\226\006\212\221"
+	.ascii	"<w\263\005\276\255\343\264\331\335n\355\307i\204\251\257yov\337"
+	.ascii	"y\230\334\n\2767\016\252\235;\302<AL(\340\035\267v\263\345b\032"
+	.ascii	"\321\301VJce\263\037\370\344.\333\341\352\375\265\334\342\202"
+	.ascii	"\037\336\331\352*+\006\325\326\324\233\255\272\2606\0243\325"
+	.ascii	"\226\227P\236\n\221A\304r\203\007\020\031N\210\3600\224\273\016"
+	.ascii	",\331L!\013\213\nG\206c\276\321\205\225\325\346e\327\0016/)X"
+	.ascii	"]e\305\240\332\2322^qy\335\240\272\222A\274\302QC\353\212\313"
+	.ascii	"\305\372\326U\326\246\321E\245\305^mae]iQ\211\260\322\252\"\346"
+	.ascii	"\252\005XYUR[XTZRU\\]R\013\224\271\206\215+.\251\0335jpI\035"
+	.ascii	"\243a\206\307\020\266\231\206LH\233\300\376\231\035\274\273\275"
+	.ascii	"\247\304I\231\245\343~\031-D\203\223\217\270A\202c\033l\300\023"
+	.ascii	".\003\3626\237Vh\006H\300\017\030\352$\344m\376\271\343\366@"
+	.ascii	"\320\005\212\300G\250qz\004\3056\230q\314\225@\001\004\375\310"
+	.ascii	"N\231\204\360\017\200\244\0360\222\003mJ\336\346\231\360\022"
+	.ascii	"\026\200?\0215C\252X\253\255\225,\203\224X%\322F\356\262\373"
+	.ascii	"\t\374\341\354S\026\367q\227\025\377\345\"w\233\027G\312\320"
+	.ascii	".\260\267\030\344V\360\241M\364\2667m\nb\352\253\2001J\370$\t"
+	.ascii	"\355\257\031wq\023\t\355e\3216n\343\333^\237\363p\277\241z\221"
+	.ascii	"*\245\364\313h&\334d\301\034\266\267\351\005\365\026\301\316"
+	.ascii	"\031\206\002\273!\251\201\372Y\253Kht[\220\226\bl%5\320:\243"
+	.ascii	"\007\036\251xB\307\327\342>\340\241\316\300\251\242F\367\307"
+	.ascii	"\306q\034\037m\266|+\323Cg_\362\017\200\323\250A0\004\225c\206"
+	.ascii	"dFd\244)L\2411\200\002\021)+v\021"
+	.string	"@\255D\222\315&\231\346\315P\021c\252\374\250\341\313\007\275lM:\257\260\0138\217\266\301j\272\2077okI/?[KxEQg|)\0356\203L\330\311\353\r|I\204\036\263<\307\020\325\007\004\001\217\233\3763\032/`I\\j:\002\242,\216\336\322\321\242Z\b\375Y\367F\f!\234\243\367J\330\253\006\302\036\037f]q\352~\334\375s\202\253T\230\301\237\247\316\340\374\334g\352\221\177f\321\363\004r\274\305}\226e\200Bb>\316\"\214/\210\225\b\255\032\221#\272\213W\\\235\331~\005\013 \333\367\2045p{\244\021Zi\304\206\361\026\301\206k\333\027\301/\203\334\\R\n\237D\332M\344\034\216A\213b|\370g\335\322\032\030\204\034\377;\337yz\301\261\207\271\235\305-\317\331p\262G\240\225\262\006\224M\307#\323\312\375q'X\236yg\021\023NE\013s\201\314\230\230\235d\360\b\357\356"
+	.string	"\212\242\213\316v\220_\205,u\33472\226J\006\t\302\177\221\002\323\277\335\2110\313}7\033t=\206\322E\252\207!*\neN\376\270\367\306\300C\f`\003\225L"
+	.string	"UR\204A\006\230c\3163\323\030\371\006\023 ~\304\335J\365=5!,@\372B\330\034\210\207\341}I\027\246F\017\320\026\3423"
+	.ascii	"!\362&\221@\253Es\214\027\237\344\226\002\030\255z\261\375\301"
+	.ascii	"\376\327\272A\260\320j(\225\227\\9\335'~\0367C)\276k\235\324"
+	.ascii	"\274\256\217=)\031\323\250\001"
+	.text
+	.section	.gnu.lto_cliRxBind.301.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\325\013"
+	.string	"\366UO?\020Q\234\016\030\002\320..\034\034\3013\230\355\240\3376\235_\364\210\033\240N\007\b\262\r\203\215\254\377\n\005\355O2n\310\252\352:??\227\277\205\311\204T\201+\210\2614\276\021\331{\313\224\002<"
+	.string	"<"
+	.string	";"
+	.string	"\246A\300\303v\013ft>\270\260\261\273V\004\235\373\224Q9\0372\211x_\367\331\361y.'\317#\365md\201\335\375\212+\210O\243\n\231\354\256\325\373D\334\322mG\260\335\300\376\203\242_:\370kT?\302"
+	.string	"\324\031q\217\032\273!r\340\330p\3060a\373\224m\0057| \270\332Oq\025\334E\034\036`\3673\202\261\013&\260\201\351\323\340%\322\347t\001\322\2479\007\034\005\007>\355l\202\336\363G\241\023\341\246\223\021\225\242\275U\320{\226\032\255Az\224\320\342c\2437,\251\215!\203\336{\274\214\020\211P\023;\033\3544\226\260/ww\035?\366\003\256\252\312\242e\025-s@aZv\3010\024\b\025\314\005\361Ue\227\313\3222\n\306\2722\026\254J\342\215\002\226\261.l[\306\242\300\275\334\3701\025B\021v\210\0329\001\350Y\374\0056\300c\227s\3172\005\031"
+	.ascii	"+\341\337\305\220\211\227G\243\341\"\202\023\260\273+\264\007"
+	.ascii	"\"&\224x\220\f\230T\265\253/\330G\256\001\25504(\004\227\201"
+	.ascii	"\021\001*Jp\227\200\201M\3357\324\344\355*e"
+	.text
+	.section	.gnu.lto_printMap.302.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\256\005%%"
+	.string	"jB\324\016Gp\236Q:a\315D\304\224\177c*\\\bf\374\216\351\320C\276\320\252f\017\3003\r\273J]\275\230m\226n{\b|\025W\253\352)\262\316g\005\013l\003\003+/\361\211KR\227\316\334\022=\233%\204\220\275w\222\001\326"
+	.string	"\314"
+	.string	"\332"
+	.string	"2\206\002\344!W\225\tV\371,\301k\221q\0019\027\371\363@\375\331J\365\266\373V~%\370\255\031m\313\371\352\213X\316\312\007\255@\375I\364\034\372\023_\b\375\331\301n\346P\215,\224\260\fR\344\262\226s\326\335#\255\036+\3376\033<n\275\331\324\024=\361\265\301>\316\262\3234\"\205\307\025]M\371\370\212\017\300a\023\345o\216>\260\221\217!`\376\344\330\303\336pz\343h\205\221\322\356X}\354V\nI\303\332\214LU]\275\232\242z\312\343(n"
+	.string	"d\215\216\234\033\"vVd\321\236AH\"&\3129\257\310\032\026c\241\252/\263\2779Ra\007fP\254V\344\320\336\217\035\304\262I\332\325T\325mZ!\347\334\326\210\234z\003\275\273\317\272\333E\367i!Q\266y\273\334\3403v\033g\205\356\321\007\334\356\336\n{c\356\346z\220)\343\203\207x\205\335J\241\275\311\356#\245\021\231\364-\322mTt-?\202o\371\207\336\365\316\275\353\027\372\326?@\265\rt\2577n\275]\354mSm\253\250\355T\265\215\252\266\317\3246\266\331\276\252m\233\332~\002\2469\\p\270,\261\356\034e\306\321\364\223\313N\262&\367\372\277\3760\277\330q\367\357\345`\017\373X\257\021$\004/\366#\022*3\0164\013\315\353D\030 \316TI\313$NJ\250?\373_\016&\370/\34031\237\352l\251\004O\316\307\017\352\317\347"
+	.ascii	"\027B\275\\\020\r\225\031\231\202\241\225YY\313Yy\364\263;t\337"
+	.ascii	".\030w2l\tR\215\325\333\345-\221\024\303\354\245N)jX\270\320"
+	.ascii	"p\3169\333n\262?\366\377Pcf+-\272\215\357zo\277\013\024w\215"
+	.ascii	"nP\026Z\223\b\204\206mZ\365&\333\242G_\253\234\016\016t\245\272"
+	.ascii	"\201n\321\275K4\275IlmH9\346@o\021|\177/\234\rm\237?H\362G\234"
+	.ascii	"\363?t\275\253\024\265;P\007\363\025\240\203.\215y"
+	.string	"\360=\331\230\320-7\360\030\340{+\314%\025\273\365E\313\013\337\244\230\017]TM\016\027\332\320\366\351{\273;\306\303|AX9g$\ff\314\223&\204\3723G#\002\217 \201\336H\002\375y\257\2043\262_{_\374\023e\233K/c\002\001V\316C\244\356\335\311(\2519\017'\214\261\300#@g\211\f\364\347o\332\245V\006\344\nY\375[@\344\264\363\245?\026;`\013\036\320\022\360\304\305\260\004<q\353\375\t\352C\n\246\036\212\035O\305\315\003\024\013\340n\211\207\002@\212\336\022S\323\205\027O\352\212\337.\311\311\007D\241\266\022\204\036\013%\035So\347\323)=\375t\020r\335\344\304{\322A55=\351Ve\376\252\025\244,\352\322\370\002\342\234\257(\340\321b\233aI\337\303\234\243\341H\353\007\316\200=\331\301\222P\035L\263)9\347:\034b0\343\254\345L\274\261\203Jtb\360\023\375"
+	.ascii	"\342`\264\252\312\212W\3307;\230/G\207\rS\316\232\036\004Qv\240"
+	.ascii	"Y\261m\275\266+u\211{\224\340l\356\252\267A"
+	.string	"\bI\257\232\336\027\255l\027\275\317\262\323\245\370\347>\024\316\303|8,$f\233)z\242l\323\311\355&;\265R\215\356\307\256\246-\233\024\303l\007n\250a(\303\224r\006\241\021\221`dF\333\214\001`\002\031\272\252n\021\240\2754uRh3%\236A/:F\372\201\304k\375%\376\024yK\254\027.\240\r\f7\356\212\357b\240\254]\354\355b\341\250\205CY\006Z\203%\343\301\355\227J\326\255\237\333\372S\244\261,\240\377\315\302\007Fn\243\217= o3h\022\220\225\215\207\\C\3257\f\260\177\023\204\"s~\021\256\021\3455\341?q$`\304l\200\363&\360\037MI2&\031\267$\001\330\377\371\260\307\3268\275\3139\221\017t\361\246I2\335\316\232\253\031\220\252\251h{\363\240U\020\252\r%\303\267\364Ml\304jJ\352\250g\337\232\270\331\257\f\274\037l\037\375sL'\001K\340jX]"
+	.ascii	"\343j\341\231\374\002\345`X\322\364\340u\235Rt\323\353t}\003"
+	.ascii	"\313\337\344\275?"
+	.text
+	.section	.gnu.lto_cliMap.303.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\331\007}."
+	.string	"\212Q\b\022EP\\R:\005U\033H\224\303\0343\377\266rLlY\200\230\002\003\301\302C\345\177\257\263\260h\021\253\235P<\220\026!F\030! j\221P \020\330v\361\200\215\320\311\321\177{+\362\277\375_~K\310\336I\006\n\001\370"
+	.ascii	"\021\0019\236\275\362{\350\251\316\335\311\031\r\301\331v\320"
+	.ascii	"\236=Z/\232\216\271\004\277\335\347\362.\316\237\3618P\316J\330"
+	.ascii	"\316\344\214\266\324I\355\331F{3x\266\3752x\266\333\331\235'"
+	.ascii	"\244\225\255\036T\327@\303\374\345\234\2310\223\356\376!v\373"
+	.ascii	"\025\355\275\256\316/\225@?I\344\321X$\016[a\220]1\363:\373S"
+	.ascii	"\253/\225O\016\324\304\310\375!{rn\013\2716\320\372#\362:)\221"
+	.ascii	"\325\270\007\nG\354\036\177Ev\343\230\027\221\027_'\035R\234"
+	.ascii	">/\361no\373\252\200{c^N>\034\260\304+\354\355\272dff\247|{\013"
+	.ascii	"\362*\322 W\270\336'w{\257\223\nY)\304\201\375(N\2417\030U\325"
+	.ascii	"\333\033\363\n;\273\n\273\244r\220S\255\265iO/\354n\277[S\254"
+	.ascii	"\273\022\251|\035\267_g\256Jbl\276^'-\2626\335$\261s\267\017"
+	.ascii	"\250\"\205r\257\360B\316\271ot\352\365n\276\373\323\356v\352"
+	.ascii	"\016\276\tgpP\2659\347C\351\353\300\337\n\273\030\tc\374\247"
+	.ascii	"\025\254\033\330C\370\342\"\037ys\370r\221\265\221aL\355\177"
+	.ascii	"\200\232[\024&V\222#\230\204\361\323/I\332]\326\335\323\307I"
+	.ascii	"\370}P\300\253\033\330\307\213\204\273[H\335G\217\357v\345\233"
+	.ascii	"-^\350\262\260U7\032\326\305\324:4H\314\032+\351f\260\244\364"
+	.ascii	"\263\237\300\325\336IG\373\221\214\212\210>\346=\324\336\026"
+	.ascii	"\"\336\0060\274\035to7\177\233)\274\275\274\267\225\304\333@"
+	.ascii	"\355\355$\3616\222x\3738\274mlo\027\357m\242\360\366\260\275"
+	.ascii	"\335\022o\013\211\267\203\303\333l{{\275\267\261\360\366\r\336"
+	.ascii	"\276\203\bs\270\300\2167\227\363\217\300>\231\216\205\223r\265"
+	.ascii	"\237\355\037s\334\375\266\361\267\336\241\247\226%\347\\\374"
+	.ascii	"\303\274\355n]\034\303fB+\346k\316\263\335x~\346\366\256Z\275"
+	.ascii	"\223\263\264\211mx0Os^-\035\334\316\246tZ\330j\335\303\027\246"
+	.ascii	"\330*a6\312>\356DD\230\315\343\347%\001\234\033@\"\321%\200\273"
+	.ascii	"A\210\270u\266\360\t\320&w7\304\3244'\302J\201O1,\261\214\307"
+	.ascii	"n\261\013\354L\333\304\330I\332\035\0237\361\253G\226\270\337"
+	.ascii	"F\242\202]\224\211\203}\013>\304K,\204\367\002E\374\236\b\225"
+	.ascii	"\370cit\202.\020\376\333\3338\2659?\037\355\263y\325\304z(g\373"
+	.ascii	"\204S\360Q'\024)\356\243J|\244\205\255:\211\2010\261LO\r\024"
+	.ascii	"0\351\001\211\223G\244\021"
+	.string	"\037\213\330\370\2428\304H\230H\204\207\270\310\207\336\032\024\320\200\032<-ALm\252\240\231\267Q!G\344\345\371\343\273\272\201,\246\266p\r^\302l\224\331[]\346C\370git\262\356\236\227\341}\311\255\230\372\034\301!\274\204\223eyj\236b-\356\356\017o\243b\222\345\234\233\036\305#\304-\276q~n\020w?A\335G\205\370\210\305A|W\314b\334\007\005\354\007M\203\300\221\214\247)a\273P\200\243\212\251\205\214\245\324Y\330P\201cD\301\300Q1\244`DM=\205X1\005%l(\005R0\240\230bH=M1AU\321`R\320l*\031QUL5\250\250\252\230\212hWV~\341\nc\335\312RB^\240\226\003tC\260\2247\326\234\307,\234\355\277\003\346\006\266\3225\372\333\371\234eM;\247\224\366Y\302\200\223\212\323\354>\332\b\316\260\\\356\306&=2Y\370\200\334n ,\311"
+	.string	"\367j4\302EE\370Q\3765\347\234\177\2120\003\214,\373\363\023\032\261V\243x\364\234W\332<!\f\341\016.\b\003\300\347p;N,\002\310r\316j\352vjy\035\347\026"
+	.string	"v9gA8K'\b\357\320[\323\003\207\327\272\364\240I:\273\210"
+	.ascii	"r\004S\013Cbj"
+	.string	"\307=\t\343<}\230\364\027.9\255#\246\366->\3563\346\272\240f\216\217\273\021\336\352\246\275\347\024\343\321=\231\317\321 \f\343\232\002\310%\347\2538\227\203\2413h\270\032\202g\377\3666\022\001\2727\004\200\241\250q0\305\2244S\"\"#\222$I\032\003\200\002\231\251\262n\020P\251D\223\fcS8\367@\037\270x(\302\245\030\375\2102\224hc\006\354=\263\264\335\376\327 \274v\261\331\202\324\367a\227L\003\016\212\234f\206!\023\215\275?\326\17768x\354\026\371\233\345\315\301yp\310 \332\250\235\331\301\261\033\214K!\303\314\220\244I\300<\215N:d\002\300\311q\334\fB\310~\226\201\225\024\177\362\303a5\277XS\241\006\be4j\013\357\243\346\0044f\333\347\203qxe\253f\337\260\027\022\373\361E\254\212M}\321K\336\r\310\td\005\030\342\365\211\277\342IdD\253\373\345\035\375\251"
+	.ascii	"\365B\261\224\202i#\240\236B\036\340\322Pk{\331%\205\333\277"
+	.ascii	"\311v\373Q1d\202\030\334\177\336\206\2379\275\272\320\2320]\351"
+	.ascii	"\r\200L\215\021\0354\370\202\200\362\001\342\201_\332\325\221"
+	.ascii	"e4\001\306H+\031T\254L\375\242\303\240\372c\205\331\200\374_"
+	.ascii	"s\350\226\212\341\f!\360\030f\rC\034\001x\311?\346(\351\231C"
+	.ascii	"\267ac\224\376\267\027\013\214+\364\2000\374\27407EA\333B\332"
+	.ascii	"\210,\241\256\245\237\024\227\326E|V\003"
+	.text
+	.section	.gnu.lto_skipSpace.304.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\255\013"
+	.string	"\326UO? Q\224\016\034\022\"\360TB\247=\002\361\314\264\361\t\306\372Rm\253\212\nf.\232L\367yL\332o\330\036'\006\250`\322\267I"
+	.string	"H\005\001k\322\020E\030\202Lv\341\243,\331{K\231R<"
+	.string	"?"
+	.string	"="
+	.string	"P=\370%v\37041\277\032u1B\232\347\360U\031\t\004\207\226=K7\002\362\323S\244\201\362\211(]\177\372\002\221\016\025\322J\317J\301\356:C\232\206;\3366\3066\001\373\007\002\231\351W\bf|l\270\215\324.)ucC H\b\333\035{b\333\371\r;\200\335\216m\305.W\300\003$\207/q\023\035c\232!\373tH\360\302\204!E\215]\3162wJ<\224<@|\361z\022(dX\310\316\376\211\n\034\311\207\217\305\303k5\352P\"\016\237\267\273\373l\340\251Q+\221N\305\205\021\240L)\212E\246\251z\330\234'-\037\272\021k\207\035\341\267_\277\335\001\027&\223\241\320 \372R\3218\270X\0204\f\036X\227K\202U\241x\023\001sY\0236\233\313\232p\373\367R!\324\303\330Z\204|\024\004\325\303?\375$\0274L\032\325/USE\266-\340\234\025"
+	.ascii	"\3571\216\020\rN\244\214i\250\r\275\017-D\226\005 !\241\f\300"
+	.ascii	"l\024\210h\271C\261\313\226\275\233\261\347\317\f\205\312\022"
+	.ascii	"\334\322\247j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_checkCommand.305.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\266\001\355\020"
+	.string	"v!tF\360\320&\035\302\277\332\270\034\216Si\317\273\303H\361\260\306\305\023\371@\257Su\026\353Pb_\324;\272\230\321\327\333\337\307\351\244\240\216\321\271\003\317\300\363a\207\0038~M\205u\347L\016\310B\277\021B\366\2262\245f"
+	.string	"X"
+	.string	"_"
+	.string	"\017\021\343\324NX\311h80\324S\0033\232\023\364\f~$\273\334.\222].\317S\317d\\M\371\252g\0367\261\241\226+\3472\206\004\t\255L>l\210\305\210\2622\272\360\341\242\211\335Q\315\013\316\265\322\215\034\216\213\327\207\213\025\013\340\300 \342\257\253\215kFUK\231sZ[.\n\267v\333'\333(\266z\004\007A\341\223\203\210fU6\250\322\335\261\277a\030\206^\035\227\356\363w\007\177\316j\222\325[\246\326\242:\213j)\325\321\352\215j]\365?\f\334\240\221\363X\320\2348\241\216I$O\364\330\216\2619\333\nJ\2601@\357\223:\310\234:#J\314\t\2328\300vi\333\007\021\2730\256&:\254h\021\263]\360#\003\200\312\265?\026}+\333\222\270r_\243f\207\017\213"
+	.string	"\263\3159\317\301Oe\227qocAFC\177\273\335\025!\021\023by\230\321\220G5\243hw\307\002\256\253\340'\006\215\036\271\323/\267\335\332&\006\372\226n\tkU&)\2676\312\201\276\365\375++.*\247\023\352\323X\\L-+\247O\363wbj\371<\027\223\312\311\373^\036x'#F5`y\361 \240P/\036\007\316\307\271:V=\320I\212R\304\003\375\257\207\310\322\222\326\3066i\235\"\2633q\3169\263\020\335\326F\220@\337*i\333\355\266\n#\360\257\266$7\261!V\006\205UP\301B\302d1\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.306.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`F\001m\016"
+	.string	"&\232`E\340\2246\035\006\321\200\003\204\234\354\361hF3\212\032\2668\210!\314\234\032X\217\310\235B!]\b\366\250YL\n\232\305\331L3\377G\021\305\370 \214\340\311p\344\264\267F8g\004\204\005H\357m\333{\313\224\002L"
+	.string	"I"
+	.string	"L"
+	.string	"S\236\200\365\351\222\215\244\300\207\355\030\020\301\001\202g\311\356f\361\305K\2372j\311_Y\351\360\276\356\363\340!\350\250V\336W\342\022{\224X\312\305\221\3533\311\0045CH\b\370N\252\237\007\273k\365\276\021\267u\333\021l;\260\257\023 \232\005\007>m\016\035\364\236\025\200'\302S\354lT\247\361\306\276\334\335u\264\261\277\363\177T\375\253\201*\307\304{~\354\206X\365l8{\304\270l_\355\3178\215\322wd\f`\267\005\220\035\273\250\025\033"
+	.string	"}\252\034\263\036a\247M\016\303\253\tc\274\261/c}\242\245J\3310rR&\036\240\366\205\226\b\252H\321G;$R9\317ox\360s<\322\364\336\247\257Y\237\217[\221 (ft\345\023\265_\266\024\241)v\376\350Q\257\021\223\202\263KsoC\036\301h\022N\002\240\220D#\316\205\002i\3330\2108\024\207X\264\f\241\fFsy\311B\\L\306\202y\323 \3422\322\266q\331\205\332\313\2156\276\300$\341L4\315\t-\317\001\n\tM+|(\017%)\026\022S\273\202\205\330\031\204\263\"v\027A\004e\004\035"
+	.ascii	"d\n{\027c&^0\205s|\330\210]\266\303\354\301\032o\314Z\300\017"
+	.ascii	"X\006\nj=\270DsE\026V\217IG4\301 \306\021\216\247\032\363\026"
+	.ascii	"\0321RX\017\214\272\204E\254F\217\273\f\263E\232B\337\327\324"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_cliReboot.307.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \325\305\005"
+	.string	"2J'0pU\323\001@U\354; ,V\375#^\362>>\342\235O\035\336G\213\253iwD\003c\006t\353\377s\201\340\225\351\326\307\021\036\264Dn\231\002\247\225u\321i]tF,\007d\322l2\253\3031\311#\233\024\f\313&\005\366\262G}\005!\206\267O\362[!\374\226\213\\\356\212O\f3\\\177\260J\376\374;5{?3F\222g\307\200n\316H\320\341\240\024\372\277\324\265_"
+	.string	"\241\351\272"
+	.string	"\0207\243\201\356\236\fZm\245\366]\321\032\270\256\256,4\272\373\222\353:{\336\304\377-\t"
+	.ascii	"3\003\226:#\\\270\3175\334-\204\3612\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliBootloader.308.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`y\001\355\017"
+	.string	"\226\335lH\360\222(\035\260\224\244W=s\337A\350>W\213B(BC\230~)Y\207\245\316\323\271\222;2a\355\352\373,Gj\350#\306\221DP[\3344\201*\334\"\233\241\0353\\;2\241\264s\257X\370#\315\022\262\267L)Y"
+	.string	"Q"
+	.string	"^"
+	.string	"\"\356\033\350\003\270o^\331<\004\\\225\345 \310\013L\247\247\326\332\315\230\257\316mt\356\312\037!Y\347L\276\2258\245"
+	.ascii	"\206\300x\220\220.\312\300\325\223\"D\266v\322\004@n\b!!]\250"
+	.ascii	"(&3\336\346+\202l\355~Tj\255\336\221$q\177n\233\3056\006\373"
+	.ascii	".\002Nu\330\217\237\267y\311\254\206\202\326"
+	.string	"\232,\273d\355\204\261Ok\255\325Sf\277\346\347^\376\224\256w\256?\002Af\204\211\277\354\324\032+B\244\3226\0343\266\037\262\275\345\007\036\005_\3731.c\365\032\020/\251U\266c\243\326r\201\021\200\276\271|\0258\333\302\005\224\332\016\001\373\233\327\310``\005\013\350\365\340\344\233M*\355G\177V{1a\320\350\221\203N\030\243|\347'&\207\006\307G\200\235o\341~\363\031\037\250\326\327\307\r\240W\203\223o`\270\037w~VSA{\255\016W\254\305\264\007\356s\302rfp~\264v\210?K\247\003\366L!8\022=\023)<\251\302P\303(\302\n\205\021\352\033\265\240>\225HR\245<\361\200\301P\244\036\352;y I\202\t,}\\J\371N\245\016\365\221\300\256$\246\272\024\221C\016\236\330\251\302P\354Be\375\224Y%\304t\341\n,7\355\225\t\373\321\324:4'Xl&\373\007\035"
+	.ascii	"+\341\337\305\220\031\232\316\344\301_\222\233\275\204j\037\\"
+	.ascii	"q\202 \2441\\v\347\022- \214F\260\t\024\f\327\312~\220\325\325"
+	.ascii	"\256\326`\013\272\306\266\302x\240\032\270\002\346\006\250(\300"
+	.ascii	"\035ii\357+\341\212[\250("
+	.text
+	.section	.gnu.lto_cliExit.309.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\032\001\355\r"
+	.string	"\246\231_F\360\2226\035P\253miF\f\353\326gPJ|X\327@\262\214=L6\264\240\007\344K\203\205\220\217\232\244\251\024\221Z\324h\244E\243\270\341\016X\"\331\017\245\316:X\n\006T\004\243\n\237\213\025~\273\033\355\235RG"
+	.string	"L"
+	.string	"L"
+	.string	"\322\276\213\277(\035F\207\007\330E\321\324\354\212\007\\\300sj\361#\365\324s\001\365\324%\333\307\200\017\013*\370\321\002\004\215qw\257\211\342\245\313\222\377\030\027\tO\340e\247\301\356Z\206'\022\367\274m\002\266A\366G\004\346<\003\252S\3124Aw\344e|\306G\222b\367\345!\213\347%A\311\251\255a\203|h\271#f\205\263\3620A[\004\345<a?dw\327\023e\213L\325\n\030\0211\017\301c\027&'\310\246\250\016\025\266\377\261-E\0167&\017&H\244]\001\245D\ngezJ\365k\236#\305\002\bTO\031\214=fT\252\177\3438T|\031_\300\260zJa\264\031\375\254\332Fp\232L\336\354\356\002\277\306mh\276\314\251E\233|\270\325\323\t\243\315\f\020\027\231c"
+	.string	"\322\001^\371\274\221\365i\242\016\303\220Y!\255\005\373:\026\313D\013y\234\365"
+	.string	"\202\003K\324m-\2306*\321\272m\244qX\204\020\227u\234\235l\243\354\3526\214\2732\322w\235\214\330\313\240\221\256\025\317#]\037q\037\262\023\345\217\212E\312e\232$\240LU\031"
+	.ascii	"+\341\337\305\220\211GI\243\341\"\326\274\006\346H\246A\300w"
+	.ascii	"3&\201m \307Ge\005\222\313j\277\"\263A\220Z\033.\254\2550\036"
+	.ascii	"\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.310.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\315\b"
+	.string	"\226P=90q\323\001 tt\332\245\351]\212:P\353xkd\351\263&\236\336\001\016&l#sg\324\373\274m\205#\324K\201\0168uL\330\207\247\026%3\025\0265\021\273eJ\001+"
+	.string	"."
+	.string	"+"
+	.string	"\003\330/\203v\f\001\306\206\0132\252\f\025\326\356N\tr\360\n\372?9\200x\n\257Y\303\356Z\305\023\307-o\333\300\266\202m\230\f#\251\216k\274\354n\264jvu\261\204\330\376f[G\n\032\204\253}\222\227\2007\251\270\300.J\265\262;&\370@\373\345\361\034\354\227\3666\004I/\272\340B\206\366Q\2362\341\247,Q\322\213%\354\327e"
+	.string	"kF\304\303\244-{\fU~\330\337\354\356Z\242l\251\376&]\310\003}>.\353>\217\303\347\3432s\035\017\304\315\220\347\371&7\"\315\016\307\242\207n4#D\242\321\334\306\275DysiY\231\244\2055\275\f\r"
+	.ascii	"\357b\310\204\366\340q\301CkC\260r\rm\205\361@5p\005\314\rPQ"
+	.ascii	"\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_parseOutputIndex.311.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\023\003=\031"
+	.string	"\266/\254H\220\\Q:H@B\301\273\234K-\027\302\004_\267}"
+	.string	"!&\007\223\332\344\013\2011\227\343\333q[\264\350/\341\3729\315k\2539\355fJ<L@Ij\002a\302~=h\332s\361\036F$?7J\032!D\356\224\002\227"
+	.string	"\211"
+	.string	"\231"
+	.string	"'\306\270N\255TY\246\324J|\340\004\347K\023O\333>\222'\331\331\306\rLK\302\b\\?\200N\330\324Zi\262\363\230/\311\357\230/\267\307w\3179_fI.\335\371\274\347<\3539:\270\216\234\331\341\024\365\363KQ\177\001\020>\335$kQP\377R\003\212\264P\265%\006&\374\321\322\264\222\n\023\024>\235$\031\230\241\242\206\247\tH\020&\364\321%}\214\270\271\022\0232\221\007\212LU\317:\245!\354Q\372\272Pk5\r\n\235n"
+	.string	"\267\375d\373\206M\265\004VW^|\324\215O*`\355\025:\372`l\237u\002o\266\214G\337\362l\"\217\356\320>Yk\255^*\373\304\177\347X\277\316\213w\354M~\001$\365IR\277Hj\263\244.\227\232\\\352%\251iI\375\002\264\215\227\"B\326\\JJ\255M]p\352\261\254b\365\342o\357\374,\303\374\242\215\257N\3653\300pU\231\251\2656x\351\n'Im\t\023v\307zq\"\002(\255$X \320&0\33088\265\277\344Lv\001\217\362\233*\327,\327"
+	.string	"\327\326\231c\017\n\017\254s\207\3377B\266(y]\353TL\2348\177&\270\034}\313\033\342\003\215\016s\207\376\013\223\\\031Wctv\227\334%\003\204z\327m4c\273\333\323$U\006X\245G\273\326H\232\033`\312\0014\266\327:\024[\217\230Z\177\017\336\316_\320\002\"\024\364A\377\311V\226#\323\362\354bp\f\016r\207\216\241\271\352\342\243n\374\245{`\234%\332e\030\265U\030\321\007\277W\222\243\267\274\337J\220\252)\273C7xl\027\030%\236\r\371\310\036\310 \310("
+	.string	"i\020\372\001!\233\201"
+	.ascii	"\302\320\241&$\023Q\373 \242\346A\226!\210\303\317\b\241 \005"
+	.ascii	"\236\351p8\333\216gC>2\031\212\243\"]M\307\005\321\320Q\220\022"
+	.ascii	"\013$%\0269\230\356\246\003\302\341~Z\344p8[\200\0247\244%2\262"
+	.ascii	"\t\r\031\335^\276\315\212p7\332Q\221\315\210vK\322\321f<\316"
+	.ascii	"!\021%\321\224r\271$\032\214XO\326\245rl\212H\227\327mL\021\001"
+	.ascii	"r\316~.\r\333\347\372\302\322\366rz\350\313\030BA\355\374\345"
+	.ascii	"\026\274\334Y\233D\t\331oy\236\335\334\327\0061 \220\002\021"
+	.ascii	"\262\253\007i\036\031\345E\247<\002\217\177<y\211\230s\357}d"
+	.ascii	"Ez\230Y\303+\374\310\267\372\270\345\356?c\013\017\221\256\215"
+	.ascii	"\3574.\321#\3650r\232\347\261\350\271B\002k\270\333\017\253="
+	.ascii	"&\3712\301\337\336\026\306\007\266\305\363'J-\230\211W{rk_\213"
+	.ascii	"\245\215&\340\025`\356v-)\240\237\032\300\367\2035\372{M\316"
+	.ascii	"VY\253\201\002"
+	.text
+	.section	.gnu.lto_cliMixer.312.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`-\006\215'"
+	.string	"\212G\320\017D`\336Q:\277\354 \210\323\375\341\036\242$\265\314J\361\307\322\021"
+	.string	"\243\374T\\s\2277\257\370\311>\202\320\354,\n\367\021\f\n}ANPo.\361\033\350u\334a6\355\227\271\342\177\3257\220O\b\221;\311\352"
+	.string	"\327"
+	.string	"\355"
+	.string	"sb\316\266m\031<e\b\353S!z\227:\3624\370e~\330\225\354\305v\334\250m\275\314\322\264\355\322\001'X\237\362\362A\365\351\372"
+	.ascii	"\352S\226\031N\200Uk\2140\027v\305\034\324\266\355\260\245\360"
+	.ascii	"\271u<\340\350\362\274C\331\377|\275\"\336\216h\325\251\300\024"
+	.ascii	"\355\313\362\215\377\231}\003\026\\Y\230\\\224\255$\367]\031"
+	.ascii	"\362^\027\226,\256[\244\003\203\203\303C+(\271P\371Z\326\022"
+	.ascii	"\264\305\220\275\271\231\222\273;\363\032\300\336\332\210\260"
+	.ascii	"\336\310\220W\214|E\231\b9\317\276\226u\004\325YaYy\331\017`"
+	.ascii	"\311Bru;-#W?\225\344\300\257eM\341i\035o\252\202\271\251\205"
+	.ascii	"\311=\331br\024\265\300\246\b\226O\313\n\275_y\372\234\371\373"
+	.ascii	"C\253\352v\200_\335\205\266m\371\"\265\266\316Fg~\007f\206\301"
+	.ascii	"\234\302\b\367\320%\342%\016\332I\226\323\373\330\315\024\323"
+	.ascii	"\2708\267\256\260\266=\036\tc=NPz\312\350-\352`\377`\360\243"
+	.ascii	"\356+A_c\362T]B\374>\352\233\271zN\335CLt\203\315\034E\343\036"
+	.ascii	"\371>\363\017\222\026\247\225sV\265\221yIu\n\3060\315\356$\377"
+	.ascii	"\n\263@i\303\355\305\\\340b\177\022\322\311\234\217\276<\007"
+	.ascii	"\337$;\003\323\313\277\364\262O\275\334\373\362/z\363\314\373"
+	.ascii	"\345\335/\257\352e\035zY\375\345T\275\214\252\227;\275|\321\313"
+	.ascii	"\027\362xR\331a\316)\233m\331b\0352\324\252\245g`o\376d?\231"
+	.ascii	"7\363\315\204U\313Vk\307\007n\0316\350c\3742\262\034>\224sh\234"
+	.ascii	"m\273dZ\237\3363\231\307\027\3631\354\311p\233\267[\355{\334"
+	.ascii	"\t\337z\262\215a\033K\272k\277y<l\026\2446-\353\361\304\026\022"
+	.ascii	"\2764\264&rN\2536\002\365\3045\327N2Q\222\265@#\245\305y\252"
+	.ascii	"\374\034*\220\277C]\373OV\274\216\332\332/;*\350\351\326\345"
+	.ascii	"\f@ (Bt\b\356\307N\207\375\022\234\302*\327\343\007\026L\323"
+	.ascii	"=\222_\246\020\227\332E~1U\tkh_\300\366b]\3630pU\264\f\353\206"
+	.ascii	"\365\270A\351)\207\016\367H]\013\217m\344\243V{\207\345\306\347"
+	.ascii	"\352\311\364vt\246\235d\346\244\233\366\307\016'\004R\233\210"
+	.ascii	"\365XAi\004\211{$?hb\325\306\033oc\202\211\277\346lN\240(T\250"
+	.ascii	"*\324\247i\017\251\234-\275\033\355$\346\261\213\352\036\342"
+	.ascii	"\333\335\277z2\213\253qZ\333\266J\002\037\315\323<\361\253<e"
+	.ascii	"\342\213{\344\013\365\351\355\037\231\240*]J\261\251\234\341"
+	.ascii	"C\023\b!\006\016\036\232J\200\340\320Cy\002\021\252\205\023T"
+	.ascii	"\321\351F\023\217m\324(B\245\\C\201p\202\024\021G\361\303\216"
+	.ascii	"_\274\f\"T\023e\024\241\2101\234@\270\210\361\244\343\247\245"
+	.ascii	"\"\324\323PF\321)\306\360I\252\306p)\310Q3\210RC\033QQRC\336"
+	.ascii	"r\352\355\305\027\246\232\352\315\257\223l7j$BO@TlcM./7>\264"
+	.ascii	"\310\250y\277\376\303:I\320\326\266\255\237\364\r\351\347g\235"
+	.ascii	"\250\276\376\365y\355\353\001`pqW\317\001g\270\376\364:\331k"
+	.ascii	"\251]\367\372{\n\241\251\035\333\316\0361fEK\367e\016\307&\033"
+	.ascii	"\264IY\217+\224\236&53K\205\375\232C\200\210\222\013\257\223"
+	.ascii	"\254\223\343C\352`\332\034!\300\333\271Q\377\340\265\357Z*\305"
+	.ascii	"\367\350\331\365\315\216\322y\002\222;C\333\005\227\231\005c"
+	.ascii	"\2570\177 ihK9'\025Q'\013ts\250A$\305\2304F\031\"\221@$h\333"
+	.ascii	"\214\001\220\002\021\261\262n\021@MklS\320\314\001RC\355\r\037"
+	.ascii	";ad\232\277S]B.\365\205\204\257^n)a\356\013\277vJy.W\bO\270X"
+	.ascii	"+y\265{N\016Ub\274\350\347\333\3577\213>l\230\364\0215\216n\373"
+	.ascii	"\262\236q\035\325\031I\215\311\265\376U\007|\031\306\022\203"
+	.ascii	"\254;\213\276\203M\306\314\205g\361\3425 A\263\321%<\237\240"
+	.ascii	"DXO\260\365\212cQ\204n\tmq\241\361A\007\320w\351\313\030\310"
+	.ascii	"-h\335qaLNc\3263m\024\362\341\326\301\311\270\277`s\345\217\036"
+	.ascii	"\027\204El\363\323\244\353f\224\226\024aZHG4\373F\207\221\004"
+	.ascii	"\374\313L\234O\352>\244\324\260 \237>S\t\206\201'\277O[w\r+\343"
+	.ascii	"\327\331Q\"o\305w\357M\020\021\243\221\245\356Y2\205\205\177"
+	.ascii	"\322\222\266\360\245\001"
+	.text
+	.section	.gnu.lto_cliMotor.313.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`(\t\3456"
+	.ascii	"\252`l\025CP\246N\007\324\360y\351\241{\237\325[9\021\270\340"
+	.ascii	"w\016\342L\326\n\025\302\016|\215\205\274m\212\b'\r\002\266 "
+	.ascii	"\311G\rD'\301D\347{C\"\240`\335\002\274'\342i\202\230\b\331{"
+	.ascii	"\357\235dJ\001G\0014\001E\001$\334\302:\264ee\330\332\361\341"
+	.ascii	"=r%g\271\013e\262\214\371.;3\317\213\004\232s\263\202\253\371"
+	.ascii	"\232\353c\272\3163X\366\035s\336$\320\234\263\222\253-\241u\365"
+	.ascii	"\230\342f\226\336\222\343nG\3634\327\303\350\360\241\234\237"
+	.ascii	"\270\311\345\334d\352\005\255\253\335t\243\325\325\326\211VW"
+	.ascii	"\335n=\003\2722r\302\240WI\246/\347\334\364Q\332\326\330\354"
+	.ascii	"\373\276\257\247Mo\340\273nTD\004`\310X$\006\030\n\t\203\300"
+	.ascii	"\226]\325\364\261\333\036\374B\272Q\021\\\025'\0020\224\262]"
+	.ascii	"@\254\370\035SJJ!\020t\316\351\226`c\231\027\211\256U\346\001"
+	.ascii	"\356\230V\344\304\360\220\3150\006F\305\205\356\230J\322c\316"
+	.ascii	"\331\2630\223`a\232\340\311\022?\277cNI\217n\236J\317\302D\202"
+	.ascii	"\203w\314#]\030\210\004\005\314\210\267\354\231\240\2660gS\013"
+	.ascii	"i^\244\370\0353,}565\016\347"
+	.string	"HY\230fxU\006\277\222\253\321\224:*\2154\306\f{\225\352U\262g\f\314\210\247\353Y\337\023\315o\f\314\314?} \366F\b\361\213+5\222\343\004\217\3039\366\372\332\302\230\315\220sn\274\374\002\363\026\340\335\276\245\273\211t\263s\001O\366l\246\256b (\232\227\314$N/\265\2366g\244\2131A\276K\034\274\351n=\356bmYf\346fv\340j\361\205\354\370\236~P.\034}\274;jf\324\"\354qn\006EQ\336\322\343\234M\212\244\274\234\223\276\\\321&\253\030\270\332\302\t\373\322\300\343\267h\227g2i\213\217VJ\304\b\276;\352\005\366e\373[t\310\223\210\207\2341\377dmc\365w\261f\207\013\007j!\036\360\3351\250\260/\375\035\316\275\207\335\036\246\037\224\353\221\335M$~\262n\247\340\203\256L\377\223\356&\246\245\007I\356\364F\3620\356\b\016\0308jq\023\360\246\373"
+	.ascii	"\237\3636\372\030\357\242\227\361&\016\335\315[H\030lq\003Y\334"
+	.ascii	"\355\212\233]q\257+n\325\317x\247*\356Wq\343\024\267Gp\377l\341"
+	.ascii	"\221yw|\235f\006\362\376\345\247:w\346s\356N\3671\356e\334\333"
+	.ascii	"\334\335\334\3178\333\215\246\235\256\205s<\364\3366T\036\327"
+	.ascii	".\327BW\2358\216\\\315\374%t\376\255A\353S\321\272\352N\306\331"
+	.ascii	"\334\214\2779\\\013\317t]\232\3338\274@\256\344\234\003\330O"
+	.ascii	"2\216\002L\340\273]0n\032\366\245\372.\347Foo\221\243'\360\215"
+	.ascii	"\227|\264\360;<\342\242\034\233\347"
+	.string	"q\256G\203\204\262\rm\322\212\201\253\034<\334y\203<\225\217d\215DQ\n=Y\236c\255\377Vkq\212\357\333\027\346X+\376\177?z<b\357\217M\031\325\302/1K\234\017!\260\370\007\336\253\201\303?\002\n?\305\336u\353\201\037 fO\016\037\236\236\001!i^\202O\3268^0Jg\313\364Qo\022\2453U\362\342{\351x\321\224\316\266I\210\035_\230\324\300\023[\241\026|\311T\311\207m\360\205\354\366DS%\027\276W\326J\374\006b\3524\341\303Ks\316\031\370d\355p\256\276gJ6\366\301\367:\374V\207/\364^\235\262B\240\336[\246t\256K\337\251*\374\340{\345\0203\243\223\302\373\210\231}X\233\336\005E\375\226\274\370L\317:\005\331%\305\266\360\333\356\306\375\333\374\375@\266G\230\370\335!F`_>\260{r\331\271\277E\341<\331'k\b\276\364\r\304\330i\302\207\247'"
+	.string	"/9\361K\230\300\276\\\372\247\213\242y&\037\331\016\307\023\360A\373\240H<\310\2338\271Cf\r\r\225t\254@\34385\345Tl\250\244c\005\250\244\343\2609\230"
+	.string	"\241\341\304\332G,\345WX3\256\260F\030?DaM9\235\260\252\272\252\242\nZ]\315\210\252\341D\203\205\3614\343oDA\311\220R\243dHMEQ9\211\200\242zb\373\t\202\324\324S\223\f)'\252\246'+\032M\020\214\272jF\224U\323UU\225U\223\260\231\341<\203\326o\341n\"\341\214\330\277+bJ\n\370\021\031R\224\225\346<\206\301\333\334\241j\370u\242\241\267\267n(g\217\n"
+	.string	"G\203\263\273\244I\233t\245\3139\200\2677\355\331\365\310\241'\353a\240b\322\263S\002(\271\361\275\214\017|le-N\373\300we\024\002\356v\311\334(\330\227\355;\022&[\217t\244/lE\214Kn\374\244/\2607H\r\313\302\377\332\231$\210}\247\363\022{\203\354\222P-\374\376\201;\267\275\242\022F\372\364\035\215\373\271T\022\344\271U\332$\016\006\356\231\213\005\277\275X\326\357\356\032\376\247\235\t\362r\316\024\332\373\270\037WK\273\231\253\355rq\273\250\355n\227\325U_\362A\372\365\005"
+	.string	"\371\003\224\204\276\332\024;\242\177\232\277\262"
+	.string	"\377\344M_UF\273\254\331Q\037\351\003\200\270\250q,\244\020SF\031!\031\031\205I\232\016`\002\2311\253z\021\300\275D4)HZ\003\365 \220\340\177\344\241\210Z\034\322\302\347\307\004\202\216+K;\262\342\257 &: \\*\3462\244\344)n\302\002nc\373\261\3752\021\234)\251\231\251\244\002\276\364\205\324E\351@\234&\336\327%\322\263\f\242\354\373[B\214\222\200\207\235\307\232O\302\335K\217\020\246\337\252'\3504\007O4\345e\204a[\242\241\034J\007\276x_.\302\344\266,FKp\335\3304+`\031Y\351\222\f\3704\027poA\315\360\317\335\271v\243\266\3160x\311l\305\024"
+	.ascii	"R\261\031\201\205I\206j\217w^\355\321U\311\266:\234o7\353\003"
+	.ascii	"\n\322\2666\325\272\230\021\022G\244R\214\327\357\323\224\342"
+	.ascii	"\376\211\027F\336\227(\035\242i\240\b\f\\\204\267[-\326\200\206"
+	.ascii	"\241\350\231m\255\327hoSw\312\215_\341\322x\272A\005\217*\032"
+	.ascii	"\300m\205L\001\"!\361\027\316!\260'la\374\305\230\333]{\300l"
+	.ascii	"2\001\255\034\350 r\352\352tz-\204z\2628\354l1\253\350\326\272"
+	.ascii	"gg\230\317\260\263\246\026@\371\032G\017e\361\037\0131q\230\n"
+	.ascii	"\345\037\310\343\222\272$\354K^ Y\351\274/\021\211!\314O!C\255"
+	.ascii	"\327~\241'\364\001\346;\234\304F\237\260if\302 YC\244\276\361"
+	.ascii	"\304\324\030\317\331\364\t5"
+	.text
+	.section	.gnu.lto_cliPlaySound.314.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`$\005\025#"
+	.string	"\006?\343J\200\330U:\271\315yG\210\n\304\030\330\236\210)]\017\267o\247\375\254x\201\356\352\n\200\216G\002*\376IC\027\177\035d\300\366\221\321c\377sD\377PH\022\r\267\274\347\245\027E\367\353\264lv\023\351\212V\322\b!{'\031\313"
+	.string	"\273"
+	.string	"\324"
+	.string	"g\320rf\002]m\241\356\313L\021&\350\267\373F\016\026\374\021\251\003\310\231\213\314I\316L\004}\200\275\332\314\347\254W\331\343\254W;\330-&"
+	.string	"U\026*h\307\024\223\230\3119\3730\216No\3609\334\315\306\352j\253\232\326\340\033\354\337\222\302\347\n\340\204\272X\334R\006VzLYo<\301q/\344\214k\253\r\335\buU\2311\222\246\274\252qv\327\205u\335\243\310-/d\326\255\245\017\300\210\344\320%\213)\016{\236\375\371\002^H\032w\205qU\227$R\335\224\305zM\032\264\005\310\214G\2214R\034\031c[\356\205\324\2728\212\224\221\366r\316\177\376\036\223\303{kC9\347\276\306\344\325\333\346\335g\273[Ew\212\025?\021\367F\035|\253\264-4\350\027\363\360\257\020\267\206o\362\2616\353\357\350\250\216ro\354(\353\325\213K\264\355W\326\212\333~\310\022*-\030/\373\304z\374\241\371e\352\236i\333\265\301\335@\022\367\306\343?\177+,\255\2234\264),\354f\n/^v\377\206\271:6i\314\325\375#\277"
+	.ascii	"\236\035\035\336\315\356\314\337\346a\357\233\215\275\363][o"
+	.ascii	"\257\352mU\275\235\252\267\261z\373\246\267o \247\264\342\242"
+	.ascii	"E\214\267\317\234]\264h2T\205\342\003\337\207\375\316\343\356"
+	.ascii	"\277\371g\343\372bO\022\274\263\315\236\257\362\253\264\264i"
+	.ascii	"h9g\006\354\325^z\2345Lj\227\243\371\311e\033\026X\242"
+	.string	"\321\017\206\242w\211\276\200\246\241\001(\303\034r\303\313\276\301OM/\273\033\fd\245,\262\223A\303\275q\207{\254\224_\320),\264\361\356\225\334l\203P\227\234\2117r`\211\016~\256\n\300\335\035<\334\033\033\201\225R\013J\205\205<dZdX\274D\213\353L\207\271\232\305\252\227\240\247X\305\207\222\342oe\211\005\331\002\303Y\300\2041\251\341e_3\321d\017\025\350\037\2220\322\035\314\342#\331y\276\260<8R\242\311\037+^\336\234\263PMu,nj\323\024\313jx\270\206\217;\030\343{5\257\330\334\356\244\245{#\306Q6\2065\274\203q\303*\261&\027\347\3260\3159\347\024/\373_\020\255\242\243\006sI\255:\370\251\351%wy\270;\r\345\323k\240\344\023\302\351\027\205\304d\224\323J>=\024KJN\277\336\023\020DO\311\311\004\020\252\007$\322i\tD\032\2122\364(\020U\330"
+	.ascii	"\341\202Q\357\250\350\350h\002\357\367\245&$\247t\311\351\307"
+	.ascii	"\264\324\204D\244\324\224T\353\244\004?\246$\237"
+	.string	"\323\017\251\311\227\364\004\345K\220\323\300\021KO\276\022@\340\223\017\307\314\037Z\201\207c\271\266->\261\016\316q&\265\212e\266\033\334\343L\036\213e+\017\276\341#\346\265p&k\024\313l;\334\351\312b\033>v\377\334\025HPH\357\300\265\341\356\340W\260\310\275q\305\252\225\262\312\200{\3036h\020,'\210\204%\206\310)\245@\211X\330\004nw\204\t\252\225\362\f:\304\302\266a+\267f\225\331e\226\361\270\201\033pw\370JN\245BOc\25010\344\220C\210\214\220\210\214\f\211\322\006p\002\031\242\263\016\020hi\232\264\006\377v-\310\257G\232\253\305\244J\3332\343e\261O \222\202\274\320\326\017\204o\3112\315\366\300V\177\353\352\254\204b\f\024B\321\360A\002\206\202\251$C\t\267-\220\275t.\234j\255i\3106\224\335\376\324\021{\023\200d%\326\324\335M.\230\332\r\202\013\024\353"
+	.string	"6\322\227\251\200_\260\333\364"
+	.ascii	"\002\313\275\235\323\247\372\207\376\307\266\324\231\267v \331"
+	.ascii	"V\264\360M\3448\377.U\272\270i\371\271\266\"8\272V\302\326\035"
+	.ascii	"W\335\274\027\027\020\360\204\334D\274z\003N\275G\242\331{D@"
+	.ascii	"\310\f\032\333\305k\006LV&ip\236\355\355\350\2329\300\031+\202"
+	.ascii	"\005s\034A\r"
+	.text
+	.section	.gnu.lto_cliProfile.315.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`B\002\235\023"
+	.string	"\006e\202I\260\226Q:4\343\243\223\031ra\366\375-,A\003\274\331O\222a/\371\307\200\316\364\316~56o\245\331\027\266/\337\020\324o\346\236\326\017u\016\373\326\333G\266?*}\345\343\337(WA\306+a\327>i\204\020)S\nk"
+	.string	"f"
+	.string	"p"
+	.ascii	"3\247ci\316\235\003'\020\017z\367\225\360\240x\225"
+	.string	"\360\240gv\221\235K\023\027\2225tzK\346\234\254}\341{uv\021\025\202\337\352\314'i\027_\3639J%\324\363\020\205\324yiS\020@I\352\216\374\360\370\374\373\"\350\206`\240\2209\337\362\216\230^t\335!qtU\256\250\2309\247u$y\356\324m\253\260-\301\326\020\001\337\234s\356\006\371\n\003\304G\fo\316>\321\277z\357V\205\352\324w\267\370\335\017\242\324_\250^P\255\237\372)\005J\035\317\347;Ls\256xr2\233\300\0353\336\273}\236_z\345\033\035\307\354=\023\002j.fJ\213\222\274ad\316\311\340\240\037\210\007]\276\257l\353\356\204S\203\253}\033\327\315N\204\342)3O6\210\023\017\t\334 \333\004t\367\274+i`\031\262A\264A0\207\016\372\321.9K\263\356\356\223t\236\324\364\311\001\324n\271\364\243j\322\355\207I\323\215\001\026\272\241\257<\202\036\341\217\216\004b"
+	.ascii	"P\n!Cs\332>\276"
+	.string	"D\033\314\202\203\376\024\\qwJ\204_\017FDp\264\211U*\256\r\213\351\307\357\213\376\333\217\222&\234\245\331;\332\003\236Q\340\342\242y}\210\311lV\376\353\256\232\027\215\013&ca\006\326B\271\365\362\242i\261j^20VK6\202\365\262\342\230\215K\306\"\021\213\311X\253\335\374\346\034S\333\033\031\342\001]\255=\201B\321cZ\224pIP-\232Z\273\302\205\227W\334\r\250G\265\251\265\216Hj\372\224\003\227\343\021n\220\365\"\302oeF?\366\333\323\020\272\035\261`\310\240\037U\3732/ \300\002\222\251\365S\370\247\030\222\3212\317\261\237\257\325\2720\204\027\337\301O\272\307q\3106nP\363I\310cgh\343MdZ\336\022h\264\335D\234\366y/\323\341z^\254'\032\b\263\261\243\222(\305\231\341\274\233n\314\"\036\325\\\371\334\200\242\320\213C\244bF\3366z\3744|\033\240\340\307"
+	.ascii	"\252\367Z+\234"
+	.text
+	.section	.gnu.lto_cliRateProfile.316.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`F\002\275\023"
+	.string	"Fe\203I\260\226Q:4\003\247\240\234Z\205\306\260\277\360\007B\375\370{\253k\\\342\216\001\375e\025}=V\"\330)6k\247\316\201}\374+e|\352\211{\350W\336\356\230I{\203\177Z\3738\326\221\317p\2432[\362\t!R\246\024k"
+	.string	"g"
+	.string	"p"
+	.string	"s\346\230\224\346\3341\360\201\361\241wg\021\037\216_\021\037zf\027\331\2514ob\331\324\323c2\347d\255\013\337\253\263\217(1\004Wg~I\373\370Z\320Q\252\241\024\027Q\312\236\373l\032\002\360\225>\220\264"
+	.string	"\n:\b>\320\021\275@)y\300\345\375\226nt\365)wtW\256(\2319\247\225,\201\356\324m\227\260=ck\207\264\203s\316\271+\344k\f\220\0360\2749\373E\377\352\275[%\252S\337\335\343w\177\210R\203\242zC\265\202\352\253\f\370\351xA7\2614'\212''\323)\324!\343\275\333\347\371>\257\374\243\337\230\275\027\"@\215\305TY\341+\177\034\231s*x\350\006\343\303\027\360+\333\272\023ad\301\325\276\215\353f/\032q\225{_\321\006!\302C\nW\310\266"
+	.string	"\335=\357I\026Z\204\\\030m\016\214!\203\236\364\013\317\322\254\273\373\034=Oj\372\344\024\265[.=\251\332\364\203\253\341\244C@\205\216\b\364\335"
+	.ascii	"\017\361\277#qX\301\221XB4\247\355\344k\264"
+	.string	"\305$xhP\303\035\327\007\204\370\325p4dG\233X\245\343\332\260\230\236\374\336\350\377\301\321p\332Y\232\275\013\256A\360\342\262ym\210\311p\\94\262\024\377u\327\315\313\306\005\243\221P\003k\241\334\202y\331\264X7/\032\030\253%\373\300\202aq\f\307%c\345\304b2\326j7\2779\313\324V'\306X@Wk\317@0\272\214K\322M\t\312ESkG\230p\337\365\366\203\333\241\332\324Z\311$5}\302q\3131\211+\344\360\036DpeG>\026\334\317\030:\361k\241PAO\252\002/ \300\002\222\251\365S\370\247\030\222\3212\317\261\237\257\325\2720\204\027\337\301O\272\307q\3106nP\363I\310cgh\343MdZ\336\022h\264\335D\234\366y/\323\341z^\254'\032\b\263\261\243\222(\305\231\341\274\233n\314\"\036\325\\\371\334\200\242\320\213C\244bF\3366z\3744|\033\240\340\307"
+	.ascii	"\252\367Z+\234"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.317.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\225\f"
+	.string	"v\227UC\020\2176\035\023\340@:\025!\200g\020Qt\247\3064v\b1T\212:XpT\356\330\337\377\201^\275\031BFg\375\204\271G\210U]\202}\302\342\n%X\354"
+	.string	"+w\371\r(\352\216>\331[\356\224\002A"
+	.string	"C"
+	.string	"A"
+	.string	"\323\247;\033\206\356\311\202\230\274\025R(cw+-\361\356Sj\354|"
+	.string	"\236\3503s\371\341*\017|\"V\002x#\251AQ!=|\354\340u\304x\341\354\256\243\207\347\341\236n\033\202m\007\366)\004.v?J-\2532[\230\260}\214mI\362\222\356&\030\344\200\035\221\020i@}j\244F{\001\203\356\340\206u7DK\202G\373(\236\242\373\210\206\023\330\375PNvA\005F@}\032|f\372\244^ \034T\344\353TG\322\f\216X:\313\210\322\n\251!qC\312\212\250~\216\337\230\256\017/O\200\250\210Q\2222\212,6(\212\032b_\356\356Z?\317\233\374\362#\277\036\374O\031`\361\202\004\344\037\001\026B\235\b M\343\2422`\327\347\001\346\311*l\334\204+\003\t\300\264\216\204K\263.\2666\231\307\252>YG\253,.Tm2\336@\030W]\3306\256\302\200{\016\207v|\372\022\245NU\265C\032\361\036~xN\027"
+	.string	"\357b\310\204\366\343\210\206\0010\034\024\212\021\rA`^D\252#\270\205\273\260\036\fK\3720/\204\177\204Q\270\f\022\006"
+	.ascii	"#\002T\024\340\216\264\264\327\224pS\n\265\007"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.318.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\255\f"
+	.string	"\206WVC\020q\233\016\177\303I\007"
+	.string	"\t\301"
+	.string	"\003\355\300\023B\024(A.pD\312\251\364\250\023d\377\232\307hZ\277\312\210\335\326O\2167\215\352*\337~9\001\257t\334}\201\nn\370\315\277\344\216>\331[\356\224\002B"
+	.string	"D"
+	.string	"A"
+	.string	"\324\247;{\206\256\312\206\240:\2000\2056v\327R\023\357>\245\306\316\007\340\221>5\227\036\256\262\3007\342F"
+	.string	"\257$71XL\017\0375x\"1^:\273\3538\342q\270\251\333v`\233\201}\t\0014v7\234r,\313\204q\302\3661\266\345\311Q\272\247T\220\231-\225P\261\240\372\334H\215v\002\005\335A\020\353\256\b\035\007\036\355\2578\213\356&\027.`\367\223\241\262\013\"\260\201\352\323\3405\324g\365\001\001\031\224\344\353TG\323\216\220xz\013\211S\013\251%\021\303\312\246P\375<\017B]\037^\242 q\201\003e\245\024[l\220\024\265\304\276\334\335\265~\236O\371\345M~=\370\277\"\360\242\306\t\311?\004\024F\327\003\221\366\341\251,d\236P\203\f\364\231\260q\0212\217\213\313d\332\005\301\243a\027c\234\017\b\263B\237K\2630ndq4\336D\031gyl\033ga\300}'DE>}\211R\247\252\332\243\217\370\021?|'\027"
+	.string	"\357b\310\204\366\343\210\206\0010\034\024\212\021\rA`^D\252#\270\205\273\260\036\fK\3720/\204\177\204Q\270\f\022\006"
+	.ascii	"#\002T\024\340\216\264\264\327\224pS\n\265\007"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.319.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\025\r"
+	.string	"\346\227\\G\360\2226\035\260$\323\260\323\301\343;\242\n\234{ \032\327G\226F5r\272!\024W\370\373\204%V\323\250\205\347\330\230w\356ab\213R\322\344\214\006\033}\203\236\324O\225|\245<\346\304\301\224\333\n\215\364&{\247\024E"
+	.string	"C"
+	.string	"L"
+	.ascii	"\037\200\235\032\264w\314\315Y\031l\004\214\017/x\354\3566Y\007"
+	.ascii	"\177M\t\372\2579H(\242~\221\370\274\n\334\250"
+	.string	"\241\002\200\230\272\f\304\240\210\361\232K\020\242\213\224\331\202\335\265\fE\0217\275\355\024\333\025\354\233\0043\205\375kw\327se\177\374\351i\376\231\211\340\254\260\201y\214\214\335\020?|l\213\316\230\261}\217=\236D\002l\352\346\004\202K\373,\336\002<\315\351\002vW:rvG\022\217tN=>\004;\355\004\337\226\301d\3726\317\270\277v\256T,\231V\207\351ra\222N\002*\226\t)\332P\321\230>at\232\300\340\314\334\344H\311\036\306\344m\356B\303\b\216\335\227\207-\235\227\004\007N\347\2647p\220\017MU\254\022-\017\023e\217(\031N\341>\021\270O\210\003\235h\265\0039\250\r\264\225\372\221P;\255\2520\250\017 h$\032J\r\235\324PE\321jWW4\225\016\324uU\001\205\322\250\364\211Z2\026\222\210\233@\3622{%#\013\336V\032\211H\233\367a\330JBl\272\300\022\022"
+	.ascii	"\357b\310\304\263\241\320\b\034+\343eI\265\f \001-&\354\346\034"
+	.ascii	",\f\327\200V\030\003\030\006\303\002T\350q\227\247jr\212\246"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_resetCommandBatch.320.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\355\006"
+	.string	"R\314.3`O3\006D+\360\200\t\025\2659\226i\2770\344\215\316b[\337\021\311\223:\247\021\321\237o\367\007\322>\b\003"
+	.string	"(\300\261\216CJ\007\236!B\244L)\235\225uMi]S*X\007\trj\013\262\032(\226!h\222\001\3034I}w\354\004\200<\237K\212&>\324\035\366h0\360>'\306L\365\20690\365E\0352\320\235\245:3Y\312\274\217\t\205\306\212\006\206\332\217\203\261\242u\364\377\215\2356\362\007\013\247\002\362\314\t\371#B//\221F0\332\232\352\326\242\304\213\2343M\220@\200\264\374\227\321\302\233\341V\333c\201n\303\031\002\024\374/\3546\022n4A\333\214\f"
+	.ascii	"3\001\2178\003\344\335\003c\240\211\2410AR\244\304e\350\227!"
+	.ascii	"\302\245\033\263\265]\247\005"
+	.text
+	.section	.gnu.lto_cliBatch.321.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\315\001u\020"
+	.string	"&\236kF"
+	.string	"\2216\035PDh'\330\223LH\325\274&\337\271&\210\023\260{8\316\0078\005\254\316\t\215Ba\371\377\337\237\254\341t\206\315r\345\363\337\300\357\353#\"\200\246E\302\304\034\331*\035\274\177\261='mw\333;\245S"
+	.string	"S"
+	.string	"["
+	.string	"\331\251\305w\352i\366\002\365\324'\373\306\334\2305\251\"hxx\321\261\273\332<\361\323\261J\257)O>\366\001"
+	.ascii	"\206\250c\031\311+\366\001C\222\323\021\2778a\207\225\234\003"
+	.ascii	"B\326\345\331\335\257\270\374\020\252\244\304>\273k\t\206!\356"
+	.ascii	"\354\266?\333\020\354\337\004\037\247u\332\245\f\362\340\347"
+	.ascii	"afV\266U\303\232([T\311\211b\177\216\3438z\236\330g\371\261\213"
+	.ascii	"\177\275\244\345\224\276\200\277\224@\341\230)\271\311\270\013"
+	.ascii	"b\274\331\032tF\n\333\347\330\226\242\006\032\005\227\366U\276"
+	.ascii	"r:\313\206\023\330=y\021\263+.0\202\247\366\306\311"
+	.string	"\203\216i\325\254&\212N\024\027\217\021\342P\"#\205\204\212\315o\2520<T#9T\330\354\356^7U9=\027\033~\213\303\230\374\024W\020\311\203\242z*'fb\304\246U\222\222\343\347Dq\202\177\206\270\320\254\344\016\007\220\364]}\313Y\220\262]\326A\f\031\213A\006\205>o\373J\036\013\334\267\205x@\243\255\353H\016\f\370\363\266\257TC#\221H\250\333\036\200:\0163\007\"\022\341\264\221h\3534\316+i \035\223.\204<\355#\221<\215#\246~}\236d32\333\252IM\325\205ud\235\330\264#H\240\023%\253\207|\313e&\034@A!c5\370\b, \340\202!);\273\360/b\214\221\033c\350N\037\026#\222>\215ygc\0076\031K\251[\006\030a\335\264\265&nw\020\315\310h\326\345\361B)a\004\202\023\034uR\324\236h\302F3\013\327\031\320:4\205/\363\210"
+	.ascii	"\216B\\\242\001\037\003.\277[\345\366\353\n\351\266\366\350\001"
+	.text
+	.section	.gnu.lto_prepareSave.322.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\250\001\315\016"
+	.string	"\206Y^E"
+	.string	"\257(\035\300\374C\313\201><d\370^_\b\334\361\3771\221r\f[\030\016\307\246"
+	.string	"\300\276\033\023\216\034\3154\376l\216WH\267\031'r\207\377\377\377w\364\327\242\242\352\366\001\177\367\307\263\355I#{K\231RL"
+	.string	"F"
+	.string	"L"
+	.string	"\357|\244s4\365\255\200\206\024\360\233\323\240\200&\252Y\270\214\032\263\021/2>\n\361s\372\340y\276\t\032\243\206\nE\205\217\212\r-\336\202\222\322\315\370J\"\2019\347[W\323WR\335t\3149\255\336\227rwn;e\333\200}Y$\032\332.\222\356\312\376\206a\030zUl\253\245\325\321\352U\037\300aX2\270\240\001\317Z1\347)\2141e\222\004\213\355\021\333c\216\003#\356v\312\250.h(\223\t\f\2149]\334\256\274;g\333h2\256v\016v\020\242\367,\340\244\303\214\254\264\244\237\250VN\310]\217\327\013\302.\007h\202\305\252\231\305\342\256^\256\213@D\004\335\001\034\376u\247}=^,J\264\306\276\313Ct\276\007K\020\321{\227\276\210v\371}\353\261\005,1S\271\200\001\006m\204>@\\\350\003\3041\b%"
+	.ascii	"\341@\243\020n\343cQ\003\005#\356\201H4\342<\256\3718W\305\001"
+	.ascii	"`(\0201\261\355\255\377\004Ca\210\211\355_.\327d[\256;H\266\024"
+	.ascii	"\347\234\223\263\253mA\212M\204\201\304]o&%\243m\352+ \300\202"
+	.ascii	"!1\253\003\0132\264\226\024\336\027\211\321\340\305#\273\f\261"
+	.ascii	"\034\202)\005|2\243\tOX\001\3550\213\013k\320\207\271\262\232"
+	.ascii	"\350\306\312on\364\241\027\353\212\355\2208\202)$A\\\343\021"
+	.ascii	" \316q\3277~d\271P{\225h\276\204S\f\217\312\006\216\207\n\252"
+	.ascii	"a\020}\273D\031"
+	.text
+	.section	.gnu.lto_tryPrepareSave.323.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\335\013"
+	.string	"\346\326SB q\223\016\034q\244\203(\207XX8\254i?\243,\226Y_\214\205\\iPr50 \377?6\022\264\2619G\\{\245\320\022\t!\002"
+	.string	"<\360\360\214B\fHC\201x\360\306>!do)S\nA"
+	.string	"B"
+	.string	"?"
+	.string	"\320\266\0270\370X+P\262\341\240D(LT\234v\343\245\"\256\375ij>"
+	.string	"n\373\263>\\\337G\311\t\304\205#y\001ZLh\274{n\340@\231\025\310\356:C\234\207\033\336v\210\355\017\373!\001$N$\023*\"\223\262\304\345\260C\307\312\200-R\036\177\373\343w\276\370Q{{\262\333\215L\211\021&\222\201C\037\2602\355\223~\342\363\322\205\013\330\035\231Vv#\002g\254C\307c\250C\353\004\250\007\226\220\345C\327g\226\225R\bU\024_\243\240&8q\221\222\242\006I\266\030\246]\301B>\004\365\335\007\274\230\001\243C\016\033 \335\354\270\245\242\330\177\273\273\326\221\375\322_=\3360}\017\005\001Y\266\3010\nY\265\341\2104p\300\301*c\232\221\007\330\005aD\204sa\236\354\322`\334\211\260\361\\\023:\035\317u\211{\035\371\335\257AE\024c\005\213\3745\312zM\315`;\325 \030\024\364\254\254\324\001\017"
+	.ascii	"\3571\302\020\032\243\016\322\205\025\206j\252+\307\211\023E"
+	.ascii	"\227\301\346\227if7(R5\301jy\252\231\246\304\2431\250="
+	.text
+	.section	.gnu.lto_cliSave.324.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"}\n"
+	.string	"f\323G?0\3058\035\300!\350\371\377\300\275\236\177#\247\036\237Cm\360\026\223\246?\216\230\343\261;\035\021\0160^\2774J~\202 \372\277\253g\004\030\326E\230\326,\246$O\370<;\320S#r\247\0245"
+	.string	"6"
+	.string	"3"
+	.string	"-\007v\327S\223\213\327t\212\376]\327\214d\351Z\027r\325\030d/\005\n\310\223\306I\261\306\273>?H\323\234\031\210\335\365\034I\220{\273\355\b\333\017\366\021\002\273\251\004\b6\266\301\240\330\376\306\366,7"
+	.string	"4|\332O\271\212\370\026\307\rvU.\257\335\322\301\013\3357\227\347p\337\272\037p\337,\332\004t_K\302\211\004\360\b/\265\006w\235`\021p\2323sS\325\306\310\230\037\257\n\250UL\354\244%\273,M-\261\257\355\356ZU\366\313\177{\353W\235~\227"
+	.string	"\033\2602r\026,\240QH\364\001\277\f\b\364H|\300/\343\257\023\022}\336(\344\001\275\217d\341u8\016)@$\357\"\fI\336\246\334k\253*\324\312@\254CM\232f\332a\305\374h\375\311L\026\022"
+	.ascii	"\357b\310\304\343\240\241m\035K\205e@\265\t\034^]A1\254W.\f\255"
+	.ascii	"04(\004\227\201\021\001*\312\270\3131\233\244\201\251="
+	.text
+	.section	.gnu.lto_cliDefaults.325.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`v\bm1"
+	.string	"\232S\b\023FP\036V\0073)\201$go\0256\024[4\244\035T7Q\214\224Mh\266p\013\332UP\313\354qM\"\330\375\347y \365\334F\200\230\004<-@\350P0\f\352\362\344=P\364\316P\354\373{\333\275\267\224)\005\027\001\021\001\036\001\233\312\340_\227\340\236\251Tk\210\237\335?\355\325\224\377d\306\003\355\r\304z\335\233\332\300\215\342\177\235\372B\370\337\370\205\340\177]\351N\247\367u\203\301\322\256\346\024:{\357$-\304w\333\355v\373.\365\275\227\225O4$\f\n\005\001\375\370\364"
+	.ascii	"\177\276\036/\336\301\257\253\263\322\277\027]>\321\320\217\255"
+	.ascii	"\262\027\222}\220\314\f:\226\205\310\214\344\240\"\017\344.\320"
+	.ascii	"j\221\363q\320\"\256P\353\210\363\255_\300\fJ$\377\370\354\224"
+	.ascii	"~l\r\371\2368(\017wh\006\r\313@\243\251\027\354\317\215\200E"
+	.ascii	"\347\353\343\240`\356\257N\263\314\233A\277\262\317\313\372\371"
+	.ascii	"\031\265\312\275\002A\266\272\236\367\022\246p\327\370\343\240"
+	.ascii	"\\;WH\332&\327\023m\272D\271\263\2567\203J3\234\215\246mG\376"
+	.ascii	"u+p\321\241\365qP\251\233\215\240q\343\213be\267'\312t\207{o"
+	.ascii	"_\364*\353\267>\020q\212\005.\255\356\307V\327\347\235\322\336"
+	.ascii	"\333\2633\272\365\016\340\335\237\211\273\263\271\303t\001G\372"
+	.ascii	"]V\315\226o\262h^\037i\035\247\231\247*o\275'\373\264\273\261"
+	.ascii	")\277\363\365\206,3;\330+\275|9W85W\213\371\024\f\324:J\265l"
+	.ascii	"\371&\233\346*\327\321l| \251\243\335\227?\313SY\021\234s~\226"
+	.ascii	"\277>!\230\333\233\371\316c\314L&\370\227H\273\267\220\312\357"
+	.ascii	",\322o\375\240*\331\035\273N\313\324Kw\3522k1\367\037\220\266"
+	.ascii	"\345\216k \356\304\243\177\362o @\321S\377\211\204A\340\257\275"
+	.ascii	"\377^\312\273\257\367W\336y\361\267\275\357tv\370\315\376\276"
+	.ascii	"\331\335\234]\347\354\371\315\376H\017\304\300\245-\251J\275"
+	.ascii	"\364\031\352\326\332\336\331\330\367\255\354\327\376\245\374"
+	.ascii	"W\377\257\374\267\375\263\375\224\247\362X\336\352\2766+X\025"
+	.ascii	"_\345\255(\377\n\fw\017\331UK\nS+s%\342\177\177\362\013\301U"
+	.ascii	"\252\337L(\217)-C\262\367\025\204\024*%+\032\273\312\007q\212"
+	.ascii	"\205\332\001\302\004\345\257M\271\233k/\335\030M\261\\\323\350"
+	.ascii	"\354z\351B\355j\246\351\027*\273\264*r=Z\314\271\274P;\340Z\263"
+	.ascii	"e\353\251\213\266\001\255\237\245YhI\260Wf\324\322~=\240\016"
+	.ascii	"\240\237\336\353ia/\326\301\267\017p`Y\225\363\021$\306\215\206"
+	.ascii	"\217\367k\362\366@\375\364\251z\335h\272\361\2109\252\322%M\267"
+	.ascii	"\\\244}<\255\305\224\202q\371\236~\272\313\333\351_U\372\325"
+	.ascii	"t\313\237\375X?}\b\226\325#d\334\255\305\334]X\232\245I\005\376"
+	.ascii	"\237\202\337\372Alv\007\235\373o\377\323O\337\365\264\273pO\023"
+	.ascii	"`J\325\232n\356\221\346\351\347[\377\277\252R\270\246\333\356"
+	.ascii	"\337\336\341X\273\353\306z\247\2372\302\306\310<=\234\2601\017"
+	.ascii	"0Q\023\310B\003\30325\031\2661&\357\347\262\323]\247\315_\334"
+	.ascii	"\340\304Z\314\313k0 D\304\314_j\235\261Y\251\266N\213\345V\362"
+	.ascii	"X\303\354\250\340\254\377\b[\232!8\022q\211\230\t#\301\277&N"
+	.ascii	"\344wfM\314:\363\302b\301@\331\200vGQ\314\357\364\243\2543\034"
+	.ascii	"<\253$\313\027\006\034C.\225d\341\242\230\302\3104<&\207L\b\206"
+	.ascii	"\303&(\247d\322(eD\016\017\364\200\007\374\b\265s&'\024M<\037"
+	.ascii	"f\251&\247\024PG\f\276\250\037d2\312\370\242(\265[qLj&\016Q."
+	.ascii	"\216H\rHc\322\370TD\026C$\227\214Q1\214CF('\026\306\247\342\007"
+	.ascii	"\246\247\245\235/!9\261XJ\202r*>%-!\245\222\220\204~\2142\"\223"
+	.ascii	"\222\307#2\311G\335\257\201\270R\225\266\302C4\202Kn,L\355}\330"
+	.ascii	"\326\246CT\356\336?,h\327\362V\310\343\202\2227\037J\240`\377"
+	.ascii	"j\304\032\204\365\243!e\003bJ!\371\235\260n\321\343J/_H\213y"
+	.ascii	"\320N\020\203\374jw\245\021%\331\325\253\231\246a\306\270s\212"
+	.ascii	"\314\001\242S\303VvAA\226\211\266N\373t\337f\312\177\314\225"
+	.ascii	"S\345Y~\247\362\f\376\327\227\265!\206\016\234\252\274M\362f"
+	.ascii	"\241\205\371Q\243T\"`\210\222I\314|2\245\223\342\017\255\213"
+	.ascii	"O\201\354\256\204r\241(\013m\013\326J/}@v\365g\3713\031\210\346"
+	.ascii	"4\304\314\257\221\200C\207!V\200\262\250\2014\306\024d"
+	.string	"FDDD\222$\205t\200\002\221\261+n\020H\210FH\222d8\252\005\212\336\360\236\372\355\342\2076@\374\017o~\234br\032@\265\240\211\302\243\bA\032\240\t\231h%MD\254\027\211\236^\0035\247/\321\334@\346\\\205n\242\213\357E\300@\245\035Q\361\220v\261w\354\036\n\315\037P\353\005\230\023\367\322\267\253\006[\317b9L\210\303\351\322a\332\362j\214\007\214s!\t\r\034\203\335\230\223|\260m\bH\255@\222\177\r\3064\001\301K\253\016\362:\234k\202%\363\325\244\301\027X\234\325\375\356+\002\024r\341\321\334\364\376\241o=L\216Lb'\265\311rBX\220/.\306\016,\032\313D\002-\245\342C\252\344\007.R\333D%{|\003\3100\333\326I\0317.+\212)\275:\201+58\322}\274\245\242 \2202#\350\306\013\363\316\302\355@E\246\026ZY\353\231lp\f\223\211M\306"
+	.string	" \340f\344\216\376\324\310\311\024\260&\003\366\273\031pM\354i\2479@g\262\305Y[\236B'Ie\262"
+	.ascii	"\375\0252\301\215\023g\336\361\006\213\301\325\006\260H\261\332"
+	.ascii	"Ll\365\210\306\211J<\217\261KT\353k\257\\\202\223\355eVD\217"
+	.ascii	"y'E\254d+\260?\331?<\343\017\313\347\304\373\003"
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.326.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\370\002\245\027"
+	.string	"f-\240E\240\334*\035\204Jg\205\322\200^\202z\362\240\257"
+	.string	"\244O=\256!~\303\354;o\364\017\341\356\016\017\313/\310f\261\267RXf\372\317\3645\\\032x\022y\020\337\227}i\314\221?37\376\370\t!\233H)S\213"
+	.string	"\202"
+	.string	"\216"
+	.ascii	"F\352\212\b\260H8\254\265\027a\351/\224\334\343q@Ui>\"\t\313"
+	.ascii	"\377\356\226g.R\217\025P\353\321\230`\255\275\toP.}o{\306\245"
+	.ascii	"\345\016\030\227\336\374\335t\r\326\"cQ\233\241\037S\255\265"
+	.ascii	"\325I\326\\*6\233\337\365\355\311\206;\227\016YQ\2040\3442\007"
+	.ascii	"\205\023\022{\210\232\330R8\032\267\250`\251\f\224\005.\007\301"
+	.ascii	"\t\211\013\210\034\311\262\276\345\037\270\0313\331\241\326z"
+	.ascii	"\266\341\204\354\307\375\337\342?\212\2779\004\225\226\341{\345"
+	.ascii	"\305\214\222\t\217q\351\366\352r\302\235\021\017\311\0077\375"
+	.ascii	"\275\223\033\311\277b\255\265\276\217\376E\332%\260\277\375j"
+	.ascii	"\223\366\252\355\355\246N|\024\311\347Y\376\351\304/I>y\342\217"
+	.ascii	"%\237\222|\221\362{\3443\345\257\001\013j\202"
+	.string	";)\300\"7\235\246W\211\232\354T%\332\305\311\376v\223\376\265\362\005\036\365\013\030\314\375\351\020k\256\236o$<1\003f\307\204\241\\\272\353;\352\177\322\016\256\267k;\007#B}\376\037\261^H\234\272\300\022\220;t.f\311\233#\242\216q\325\032rB8\bx\354\262M\234\340\265\255\232U\353\363\264\311.[$S\323\315Pl\220\354\375)\241-\366\330[\323\315\270\351\335\264E2)v\213\n--V\214qrB6+N\365\317\302\005\257\255\033\313-\212\034%Z\237\214;s\013\323\215\344\273cTu\205\234p\311\267\206\306u\036\200\271\377\027\214\327\246j\026\255\317os\267\234\241;\227\261X|\312\032gm\200\311b\256\034,\025\216\230\314\025\003\006\342F\314%\263\001\003 \243\006\303d1W\016\n\373q\225\200\361\363\"\377\242\340\023{\265h\370\270~Z\257\240\033-\n=\007\252\001\013j\341"
+	.ascii	"\002\nj\241zu\305\332G\276\025p\2332D\311G\317\250\003\376M("
+	.ascii	"f\224W\225!\323p\326\347\031p\204Eu\252\t\364oR1y\254\241>O\233"
+	.ascii	"\247Q\275mj\272Y\030\236\33699!\223\021\217\305\247\376~\361"
+	.ascii	" &\310\t\321\030\355j\255\255\355CY\373\360`\351\037B\004\007"
+	.ascii	"/ p\202\021\251\244\007\033\346{eC\266\207\256m\237\037\315\316"
+	.ascii	"\262\300v\f\274\330\367\002\343\304N\004\322\357\034Z\224I\333"
+	.ascii	"\262\223\271\024\200\267\264\360aLI \332\257\341I]\350\r\220"
+	.ascii	"\354<\002\rhf\320\020\345O\337\270\233\215\013I\361>\320\245"
+	.ascii	"\211\005\333\262j\306\3749\271\326>\363\355\333\255\220\232\361"
+	.ascii	"^\013sX@\207\006\036I\336d\2625\023\005"
+	.text
+	.section	.gnu.lto_cliGet.327.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`s\007\205-"
+	.string	"zP\320\021DP\036R:\213\201\347\254F(a\027\312Y\273\320\204\326\301,\314\005\236\212*g@\261\374e\320\177\303\022"
+	.string	"\2207\3304\003\250Z\b`"
+	.string	"'%\016\006\240\223@\025\307\030b\231R\034\320o\377[#\204\310\235d\n\001\367"
+	.string	"\021\001\314\374\344q[\345X+\240\310\263\271\214\266m\233\207w\271\033{/\\\007"
+	.ascii	"k\254\r\240|6\271\242m\3332]\345\n\277\253J\351m\353\001\247"
+	.ascii	"\351\227\371k\337\302\236\315\307\003\264m\031\034]\333\266A"
+	.ascii	"`\005\277\253\334\366\243\365\352\357F\353Uf\231\361\272\245"
+	.ascii	"k\233kS\251\365%\257m[\2476c\341eOD\034\n\203\300\237oU\323\276"
+	.ascii	",\377\355\036\316\360\340$\231\305\023\211\235\230>\210\216\t"
+	.ascii	"t9]b\351\021\227\224\344\337\236\240JW\363\016S\337\221K\312"
+	.ascii	"\345t\035I1\350E\311|\356w\213\231u\205K\274\214<\230\200\314"
+	.ascii	"+\354\300\265\311\345\354w!\317\246\032\0372/\260\373\276\202"
+	.ascii	"L\255\365\310I\335\223\223u\201\365J\344j\272@\213\336\031\""
+	.ascii	"&25\360<:\0212\2177M\215\300\344\354\\NWX\332d\307J\230\220i"
+	.ascii	"\274\375\271\007\237M1>d^F~}\033\332\266\345\233dz\235\213\316"
+	.ascii	"\374\"f\216\301\274\346\005\314R_\363\264\200I\333\0321\244\271"
+	.ascii	"\232\023\351\241\\\345\024*V\025\353U\265?w5\354\353O!\261-l"
+	.ascii	"Xw\257\337\320\034\275z\205U\332\200\313\217k\341\342>\311\217"
+	.ascii	"{\360IhlP45\363\242\335t\2470\2725(\323\260@o\363\351>\006\212"
+	.ascii	"\017\205\243\246\356\223S\353\325\256K\366y\337\276\326!\254"
+	.ascii	"\273\307\303\313L5\343>\371n\350\2342]\203\242Y]dn\313\272\355"
+	.ascii	"d>\006&zw\334e\314K\016\376<'\275\355Gp\266\377\300z\331\350"
+	.ascii	"rg\342P\b\274\034\374]\006\256\227\177\367"
+	.string	"r\366\335\313\353/\253\276\313\351z\271}\227\357z\371M\023\360\322\254\241=\233@\372N[\313\265W\250\205\252d\246\\\356\367\362?\337\314g\236c\241\\\216\264\205k\261\274\232\316\354\242ky!\300<\216Y\310;\016\307W\262\f\203\326\266\255p\007\263\360\352\375\227\277\2610M\026\311\334oS\251\006\0065\342\2357\024\257!< !\326\331\224\204\220\237#)\323\006\375\"\334\207y\036\353d`\366C\246hp\265\t\373\304\317\243\037\246E\241\305k\210\357\232\220q\372\332\371\207\017\b\300\032\225v\214\017\277\017\343\375~GZ\257\016h\221M4*\337\303K:_m[\274\330M\266KW\215R\2651\343=\304\005\216\264\376\332\250\371j}e\335=ff\243\\\017;%/\317S\221\333\322\f\232\335\357x4Q\326\022\315\240aZ\233\006\227\351I}\240\231Y+,\0266Pd\027Y\301U\373a^\207\325B"
+	.ascii	"O\333\"\237d\325~\310\021\r\330-,\027$e\232\032\350\261\213+"
+	.ascii	"sXR\246\325Ao4\313\263\246\266\223\231>l\024_\200\314\334\336"
+	.ascii	"\360\343\3608z\022\372\224\004'\251_vv\367\226$r\331\n\005\262"
+	.ascii	"K\333\311=\326\265\257\334\356\214W\217\021\\\004\2556\363\007"
+	.ascii	"\020\367\311\2653\214\035Y\304\331\220`\200\247m\215\0278\374"
+	.ascii	"\341\211\203\t%\017\"Jp`aB\004\221\317J\032\224n,X\251N\003J"
+	.ascii	"G\337\220\252\001UUe\325AjJF\024\016\250\252\242\251\032T4\246"
+	.ascii	"\252\240LHUE\3718*\002\025\215(\247\032TPUNQW7\234\"\034\261"
+	.ascii	"\225\215\251+'\034VVWN\3026\254w\231R\r\r\024\253\263\2106\334"
+	.ascii	"\303\335-\266\230\365C\2528\262Z\027L\251VF@\234\336\0321\025"
+	.ascii	"\016\333\327[\276\226\360%H\211\233\335E\376\307\2139\313=h\354"
+	.ascii	"\241V>\335=\022\271-\361\362\376d\270Lgf\267X o?R\252e\201\032"
+	.ascii	"\243\303v2qMp\251\207<\233bZb.oq\032\024\366\337~-1\227\351C"
+	.ascii	"fb\007\273\003\260\203|\333[d\271\322Ca\226\311\006a\203\254"
+	.ascii	"W\201\335K1`_Xw\357i\333N#\350\0345\207\200\016\232\323\036\266"
+	.ascii	"\260\267\230\377\034+\261\227\272\257\234\331\t\272E\202M\037"
+	.ascii	"\266\203~\364L\317\036R\314\302M\352\003EX0\2650\n7)\200\217"
+	.ascii	"\250A4\346\020RJ\321H \"\n\223&\035p\002\221)\253\352\021p\301"
+	.ascii	"SF\233Ba9\013\366W&\236\362\303m6\362I\255\307@\034\020:0*\031"
+	.ascii	"\204;\375\327]\347%\006-;K*\027\206\250\037\311\212\032\025\360"
+	.ascii	"\n'\"\024\252\002\003J\345\245C<\302\255u\210\220\345E\230\027"
+	.ascii	"\362\234\215\202\307\327\303\"\312\0166\221\241\013\224\250m"
+	.ascii	"_SJ\211>\035\362\0376f\377\304\372\246B\256\344N\002B\322NYF"
+	.ascii	"V,\347Y\370\312\200\2337\220=\021\245\213\336\2708ikZ\264\220"
+	.ascii	"r\fA\314\364\337\030\362\027\215\311\004i\362\021QJ\370\027o"
+	.ascii	"xz\304\ns^\306\330\243)\022\313b\3217Zj\021\256\335\365\237x"
+	.ascii	":\313\346\222a\360\361\224\261\244\367\304\213\005O\351\317\311"
+	.ascii	">\003D4\216\354\r\302\270\002E\2052]\326\365\272\215\254\037"
+	.ascii	"&.\354\2655\234\016Pm:\021X\214\300:t\212\007\344\332)\n\314"
+	.ascii	"Gv\256\313\322>h\270\241\021\335\256\333\3642\206\213\r`7@\177"
+	.ascii	"3\241\b{\307\336\003\311)\324\352Co\fi\320;\202\215p\304\352"
+	.ascii	"\bF\362\177!\230\n"
+	.text
+	.section	.gnu.lto_getWordLength.328.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\033\001U\r"
+	.string	"\306\030ZC\020\257&\035cE\311\b\271jF\035TI\242@e|\316\240\241Q\027\331%z\273"
+	.string	"I-\336\"6n\032\255\023\211\275C\263\335\020_;"
+	.string	""
+	.string	""
+	.string	"p\204u-\224%\\A\202\020\034\274\321\b\331{K\231RF"
+	.string	"E"
+	.string	"F"
+	.string	"-\021\003\013\224\0227\273\034\246\032\3742;|\232\231\277a\243\2219i&\207\3172\245p\020\240\231\236\307\252&\346\251'J+\345\333T\256O\375\232\331T\335ISyZ\bv\327y\322*\334\361\266El\033\260/\n\334\017\337K\253\246\363\334}"
+	.string	"\003lZ\210\260p\225\315nJ\347bQ\300\230\016\266Gv"
+	.string	"\233\233\341\310\264\017\342!Fw)9\306\356\212\t\230]\216\303\004\256Cs\327\210\207\3273\342a\201\003#g\2720\031\002/\241>Em\234$\246~\305\b\025\023re\237D\004\222+{I<L\035\331T\035\352\002\351\355\356>g\317\210O9*a\243y9\361P\312N_N\2304U\026\2333I\217\226U\215u\305\3468}\335\345\267\036\f>\nBD\037\361\343\021\001I\020\"\372\270\334\351\3604\350`\037\317\002\007X'\364"
+	.string	"\353\3200h\004$\204A"
+	.string	"\201B\230\271\375{O\177\351\006IKV\275\364(/H\331\331\322\253\352\311\207RvPY\374\3241nR\310PP\216:\032"
+	.ascii	"\3561,V8814\323 \321\206\330\212\367\017%@\334\035\353V\220\020"
+	.ascii	"Qfa6\nD\264\334a\323*a\214P\237\205\300\b\030\007\206\005\250"
+	.ascii	"\320\202\n\002\267\351T\215\034\024\345\3275\237"
+	.text
+	.section	.gnu.lto_settingNameCompare.329.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"E\013"
+	.string	"F\025LA \213*\035\247H\023\002\022\302!\355\260\372\353XA\"\b"
+	.string	".\005\220PE\033\302d\021\254\325\357#|n\013\345\366\307@\225F\030\200 \200\341l\254\257\362\f\334\265\206\377sxp\362\311&R\246\0249"
+	.string	"6"
+	.string	"9"
+	.string	"\217\021i\333op\007\237\215\201\262\260\002\0036\0023\224+\266\273\335\345\226\355Q\273\304\366\250\b\376=?\377\020\316y`\020\263"
+	.string	"\246J\317\t\306\356:\301T\200[o\n\373_\255?jZ\313\264j:3}\312\204l\325\022\360\330k\027\300L\266\032\342\205\005\266o\373\263+v\253C\206{t\246}\326\037|\017G\034wU\031`\273a\2051\\\033\f\272\004\217\223`\367\264\261-\362Wh\303a\367d\341z\204\221v\005\217\006!m\007\037}\222rV\254\250\327\243>\230rf\207\245\324\003\366\265U\003v\246\271\207\377\344\001\031\357\334\036\315\207\303\323u|:\240\316#\032u\032\213=\017\rQ\367\341y\242\256\022\356mN/&%1D\246jj\1776\362 \247\027\252\022-U\3602!\247\020\302L\3204\263bMT\365\001\026"
+	.ascii	"\357b\310\f\rFT4\341\300\035\200(\030\314\byW0\310\022\034\263"
+	.ascii	"\331\353z\233\201\245\\\310\302\324\330\003\214\200q\005\324"
+	.ascii	"<\270\013J5xM1\036\034\034"
+	.text
+	.section	.gnu.lto_buildSettingNameIndex.330.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`*\006\375$"
+	.string	"*Cl\016I\220\230U:%\216\342\266\354%/;\270\266\341|\\p{&\235\354\200(Gr\"\344I\215\224O\371\330l*\232Z\240@\372z\036\332\265QK\020\315\""
+	.string	"\241\002\326\002\203#\021\307$\037\306"
+	.string	"\332\266m\333\032\331D\312$\003\325"
+	.string	"\302"
+	.string	"\326"
+	.string	";\333\0379\022\240\033{p>\034iN\b\034\332\320JS(\004\257K"
+	.string	"\366*\340"
+	.ascii	"\320\327\363;\364\025h\327L\247OR$t\350Bhj+MS^\363\330]Y7\273"
+	.ascii	"~B}k{\333\327\236(\320q\272\233\255F\233\311b\260\334\013\255"
+	.ascii	"g3\320\376\370S\207pK\320qH\327\36582\361mx[R\022#\256!\235\346"
+	.ascii	"DT\203gg#\225T\216Et\343|\200\244\310\322\253\316\343Dd\203e"
+	.ascii	"<;b\034=V\365\317H\016\177\234\311\021\343\350\260\373\206\317"
+	.ascii	"\035\213h\351\b\344\227\254H\343(\215\327\363\305B\b\304V\304"
+	.ascii	"\342t\300\324\262:\362\034,\372\361Y\224\361>\362U\207P\371\003"
+	.ascii	"CU$\343\374\212\220\246\351\362PQ\214\357\356\273o\261\273\013"
+	.ascii	"v\353\206\275\273\030\356\244\247\323#MS\007{&o2b\337\364\272"
+	.ascii	"%N\360\207^\367'\320\327\017\241\361qso\375>\362\024~B\245\024"
+	.ascii	"\030e\227\217\233\215b\031\233\335\304]\250 n\2451.^l+\355\362"
+	.ascii	"\354\350\234\352\233\203\363\244\324W\227\273\361\213{\324\367"
+	.ascii	"\326\274\266\223\267v\362\322\230w\326\274\262\2237\366\344\027"
+	.ascii	"\326\274/\346E\231\2676\357\331\274\315\274\314\274\037peV\324"
+	.ascii	"\031,\243oe\245\251\260\351&\345R\255\202<\371S\375R\177\324"
+	.ascii	"o\234\332+_\245\344K\200N\245\002\027\204#\305%\001\207L\t`\257"
+	.ascii	"8\376\016M\002\207>\016\300\222\354\354\225Fr\270\264\207"
+	.string	"\332#\243f$\2070z`\257\374cc\220JfU\226k\272b\262f\255\345\032#L\327\273\016\356:\327)\214\336\020\221\322\262\202\231g:\253\360,\275\002X\230K\221\331f\bM/AR\232\022k\342Z\270\225^\2030Ur\372U\237\360\023J1b\345\343\3462\300\302\302\004kb\256\225\366a\226i\256\320\235\276\3262\215\261\376\311q\035\304\365\253\237C\n\355\227\001\2646\332|\244\310\005\006\370\364z\362\263w\372e\200I\375\036\024\327g\377\370XS\221+\013\350\2046q\371\354\266u\360Eur\327\016\356\2766qkW\232\247\353\023o\260\273%\\\255`\346rw_\250kou(*\3167\255\007\020(\b\364\225[g\311\310\307\315\277\230T\2718\233\370\036\364\326<\335C\212[m\200I?n\356\003(6h\b\361S;\374\347\"2p\350\365Q\360\363\301\207\027\342'\003\b\236\017\211\022<\005"
+	.string	"\266'b\003\t\236\211^\217\004o\006\225\276\225\026\266l\303\205K\313\327\277\375/\240{/\377ra\337\264\031|\330\007}\265-\205W[j|\334\204\201\023\322\035o\340\310\206\323{\346p\235\353\340FyN\314\214\233\224\347\032\247K\221\251\004>\035[\330\232\270\267'\232NW\246.\327\272\016\352\332&c:\204\251#\247\332l\327{\312v\r\353\240\256u\372I>#Sd:\311\t\361e\217@\017\254\335O\230\205\213}\320\232\270\b^\353\263\221\272\252q\254i\275\313\341\207?Tk\001,:hgM\353s\252\303\267\364`W\263\276r)\327\273\226u"
+	.string	"&@!9\035k\306Qdf\tu\3652{\250a \006\225S\310\210\214T\220Y\020\rc\220\002\221\261*z\020hFbRIk\217H*\022\fO\251\263!m{\255\266\023\025\022\026yg\005N\351\216\360gh5d\207,z#\017\224qE\253\307\353\330\253\\\343!\213\026\372\277BJb\252J1\334L\322qP\353\373id53 \026ES\337+\247\333\343\367\013\332K\214\257\341\016\233\211\036\016j\006\2547\356\251\200\340}\230\346\003\t\177\226X\214\006\023"
+	.ascii	"ltCi\"\322{2Y\252{\214c\242\017\023$2\327Q\3250\013N)\267\353"
+	.ascii	"\037\357\331\0374\024\027\003\317F<\002\312\346\023W\t\f\215"
+	.ascii	"\206YZ\350\325\032\211\304C\377\205\326\005\323\203\361j\034"
+	.ascii	"\301_{\002)\002\024\371A6\b\320,mZ\032\005\315\323\026\252=\374"
+	.ascii	"\305:\346\r\375\275\330)gs-\366\340\224\317\017~m\364\013K\374"
+	.ascii	"\337\306\255U#6\211D\002\023]\r"
+	.text
+	.section	.gnu.lto_cliGetSettingIndex.331.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`7\005\365#"
+	.string	"\372B\234\016Fp\334Q:\003\3772\nIr\006\376#\274\260\022\254\004\261\240\376\226\344h\303\346\377\341\323\b\013X+\301\332\201\342\254A\005\315~\203\346\355\300\332\240[\033w\261\363\202\2166f\257B\005M\210\366\177\311'd\313\235d\331"
+	.string	"\312"
+	.string	"\327"
+	.ascii	"\3672\370\311\017\322\237\005\254\255\314\021&@\375\253\006\367"
+	.ascii	"\275D\334(\250\225\371^\277\002u\244\215\003\335\313%\266\274"
+	.ascii	"\027\351\200\017\244?\031\231\236\312\253@q\324y\227[@PcX\216"
+	.ascii	",y\356E\002\003\334\207\376\254\017B\177\366\021\336\325\250"
+	.ascii	"\363v\272\034.\275\241\247\355\032\305\227:\357iXC\2248\352\016"
+	.ascii	"\325\022r\235\201\334\rC\021\255 \307Y\004hF\342<\r\013\210-"
+	.ascii	"\"b\206\307\233`\375\250i\202\2441\316Z\021\255!\277\331\376"
+	.ascii	"\322b\366\223\225\303Z\260\022\005\311\233`\025+\232\206U\264"
+	.ascii	"\005\226\257\304\254a=\257\374w$\215c\326\212h\t\271\345\361"
+	.ascii	"\266\013\324\274\334\321eQY\337U\222\252+_\255\262\246j\275a"
+	.ascii	"\270\367r\255\312\322:\377\234\231\3510\363\007f+'`o\250\352"
+	.ascii	"\036\346\227\375\313\f~\027\277\020\326W\375\344\013\321\237"
+	.ascii	"\357+\277\301\310\225\032=\305\033\265\311\214\224\252}d\276"
+	.ascii	"\002*\\\226ps1\033\025\021]\354\374;\362\027\360\257\177\350"
+	.ascii	"cg\337\311\316BA=\256\374\363\344\231\267\313U\326\235\225si"
+	.ascii	"e\034\256rj+\337\322\312\250\255|\332\3126\255\334\017;\327["
+	.ascii	"\345\017\3705\327\276\212\357Cv\357U\263\317=;\313\224\\\354"
+	.ascii	"\037\373\311\376\344\037v\346o\341sy\227/"
+	.string	"\311\234z$\215d:\244c4\352\325\261u{>\222\3062j\367\"/\210Y%\215h(\244?\317\f\305\327r%\353\302\030L*\205\225&\215dK$`y\026\250'\031L\200\033[\027HG\322(F\355\006\267>\3623\240\272\376\032512\244]|\032\350O]\237\b$\327\226m\370d\2526\3775;h\\h\037\231\301\177]\241\330\326\004sC\240\246\355k\001\315\254\201C}\325\257\013\f[\212\207:\355Ga\302\206\247\303\323<\\\013\005f\226q4\020Gm\356\245\252\220\346g\"\354\b\022(\t\364\247\257\207\334x\241}3\3613Q\351\275\267\002\277\314\315\224\340w\375\344\023(*\n\364'\332-\214\\\311\321SV\317`\320\263\205\272\236\031N\341\365\256\317\376\362\270:L\330\314\232\t\347Ky\036\335vP\177lHd\2526\271\333\366s\264\335\354bR\330w\261\212\025\350\212\3561\257\342H\261"
+	.ascii	"*3R\260\276\212\211t\\\371q6\325R<3\344Z\367\221g\240\357\026"
+	.ascii	"\001.\204J\035Tb\021\342\305\222\360\351)\350\244{J\242\341\024"
+	.ascii	"lB\231\222\252\020F\205\361\364b)\230\204\006\225X,YF:\022&!"
+	.ascii	"\001\227\204,\224\200HMN\300#\0373\311\b6\001\237\230\230\232"
+	.ascii	"\200:\344}s\361\031"
+	.string	"\263\351\265\353.\336p\375\363\323\214\341FO5\341\365\221\257|\312\3443\264A\315V\327k^\023\257<P\030SO\233ep\266\272\332;\353Ulc\003v\346\267\367\336\273\2639^#\261\255\301\025u\257\211_\276\227#j\266\270]\327\353\032\\\250\211\032B\023\254\366\350\2026\314\tuQ\177\213I\033\236#\355\224m\301\365\221\253\032\223\317\234\363\327\365\214\311f\205\036\335\250\211Fm\242\330\204\002f\206\252\356\t\203\305\3112\355#\377\302\230|\274P\264qMd\346\035\261\332\023]\250a4\203\224A\b!#$#\"\023\210\322\001P\0021\346\240\325\001\020hY\232d8O\022]\243G\003\202\276R\n6~\003 \340\350O\206\306M\200#\r6\301\332\002\213\360\034/8_\020\305,\022\340\215\223\300\346\032\361$\224\013p\331\226\371\365*3)l\276v\214\241\250aX\n\261X:\337b\303j\217s "
+	.ascii	"iGsz\256F\037,\340\361\362\337\364\243h\223\231j\221\363\214"
+	.ascii	"\004\"a\2606\025nj\207\tv(\025\n]\350\361a\254N\231l\307\235"
+	.ascii	"z\342M\262\257\202\33166\035\330I\333\235\2745\245\317\203\370"
+	.ascii	"\0135P~\243\bVz\351+_\237\024$\347d\347\031t\227\361D|\311\301"
+	.ascii	"\320\272\b\204\342\342I5\243\002\376\224S\032U\003"
+	.text
+	.section	.gnu.lto_cliSet.332.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\f\"u\235"
+	.ascii	":\003\2759P \206a:\303\001\303\332t;\035g\327\357|\r\351\203"
+	.ascii	"J~\036\354\262wg\317\236B3\337OUk\325\350\236\366\bc\2754\004"
+	.ascii	"\0330\337\3414\350\304\363k\\\367\314P\033\320?\\\342\207\242"
+	.ascii	"\3278\3511uiZ\210\302\026\355Zi\210\020)\223\f\220\0035\003\212"
+	.ascii	"\003[L\362\022\213\274\303\3636\021/#y\177,-\330\316\264\205"
+	.ascii	"\221K#k>8\225Ia \025\217\270\202\227\003\372\003\375\203?\341"
+	.ascii	"\003\377>\377\013\277\236\177\372\367\375\177\377\235\237\357"
+	.ascii	"\317\373\353\374q\3769\377\335\377\346\257\373\327\374,\374m"
+	.ascii	"~\272\037\315_\346\227\273\207\335\007\372\340\t_\310\352\036"
+	.ascii	"\327\324L\021p\305\271\346f:\307\312\250~\t\222[{\363%\216U\214"
+	.ascii	"\025m\r\240\251=O+\232\233\266\300\325(\310CnM\213\037*\347\232"
+	.ascii	"\030\237\037X\344\326\302={\234V]\221[\001\247\307\263\317\263"
+	.ascii	"\307i\bV`\254d\322.~\267s\300;VR\344V7*\306\277'r\353\333\024"
+	.ascii	"\212q\3314\211Z\243\300\265\005\356\355\245{\344C\022c\215N\275"
+	.ascii	"\364\356\302\036\353,\033\345\026\234\032\326Bl\332\026F5\346"
+	.ascii	"\351\211Z\243R\270$r~w\274=\276\001\374\242\252\252\323\234e"
+	.ascii	"cl\202\031\345\322\002\277\250*\330\225\361\3048\313\246ier\006"
+	.ascii	"l\210\233}\013o\220\f\3253j\226\023\030\353W`[ \bk\256\302\331"
+	.ascii	"\334n\217m\204\f\251x\252\220\003\344\322\334\n`\\\341\021`\236"
+	.ascii	"\005\005\f5\315\324\241(\3164\024\006`<q\210\245\264\032\240"
+	.ascii	"fUyZ\277\340\226\205\013\346\353\212\fU1\265\231'j\375Z\323\026"
+	.ascii	"(\001\n{5{"
+	.string	"\2443\"E.\rM\352g\366i\366x\"\032$O\344\322\270<`<1\303\343>\267\307\023n\206y9\021\206\262\314T$\t\316\264\262\006\214'*\207O\026\3130\200U\250\231J\364%\227&e\252\252pN'n\324.\3031\340\356\351\274\373\266\2731\377\206u\244\252Z9\263FU\341Pl\223\361\304\205\273Q\361D\343\223\305\023\227\271\013\330\352\032\225\254\230\026\245\313L\240\252\252P\215e\203\266\303\276\360C\270\357\210!\363/\\D\265`\261B\005T\n\024ON'L(P\202\304\210&\021\t\204P\202\370\300\344\241\303\222R\022\322\221QQ\222\b9$\304a\203\206c\006\f\306\240\"q\330\314\334g\bk\376\205\213 )d\323\032\006/\252\205\235\263\370\273\235\037\257P\001\345w\307)\374\206J5\2609\214B*\207\237\244q\330\t\316\211g\301\271\211\026\024\310\003s\303\352\033.\221\247\006\366\306$"
+	.ascii	"S\340\021W\232\250yS\213-\32366\021d\t\254AC\024W@i\312d\323"
+	.ascii	"Z\266\206\356 PH\203\346\f\031\342\007\300\023\305X\243\234Q"
+	.ascii	"s&\265<0/\354a\330e\346\354\236\007\3267\214\341\026F\313\245"
+	.ascii	"m\334\341J\2231_\022s%1l\234$f\370\244\006\026\206\221\244'j"
+	.ascii	"Z\243c~\324\345Fh.t\341\242d\220\024\225&\177'BnQ\003\323\302"
+	.ascii	"Cy`%\f\225xYX(\004\225&~\347\360\327B\031o\220B\306\032\352\334"
+	.ascii	"\270\0245P\001\213R\324\260\267\216m\b*`\177\304c\324\n\235\266"
+	.ascii	"\tRi\002\370\f\317\003\203b7\306\030\206\311(\335\336\363\300"
+	.ascii	"\356\f\237\366\326\261\317=\204\032X\224\215\303 .&]\236\007"
+	.ascii	"\0068\204\361g\272\302\32389(\355\311\213O\363\t\252\210\265"
+	.ascii	"\321\342K\023\366\344D.\036\016O\224\305q\300\363\300\304\206"
+	.ascii	"Ft\252\3309\206mq\017OLU\350\303!Lkh\304\244\313\363sg\2570."
+	.ascii	"\346 )UU\227\237aM\276\013|w\210\301\356\243v\231\222\004G\033"
+	.ascii	"|7|e\231\347i\271\307\350\274\233\022'z\300g\351\207\t\252\007"
+	.ascii	"\005\217\210\017\0357\031\372"
+	.string	"l{4\206&\022'g\213\377T\301\320\031\364\304\366\330\304h\260\261\227\200\226\203\374g\217V&\240\215\315f+\364N\212\247\232L-\376sG\233\200\3529Y\361\016z\252\223\254\3209'\030\031\334Aw1\225\360\237\t\350\333\275h\272\367d\215\340\224\201-m\322`\330z\007\275\214\363k\200e|\331\0247\370b2\341?;h6h\036\037<\025\366\364\251\031\373l\205\306\2127k\342\037\342zM\320AMcN\261\203\306\030\212\002\206\347\262\3140\246\023'\305\023\213\335\244E,\213\013?TUU\r\3523$\305\t\372f\3754?\326Y\237|\3162\027\274\313|\302\214j\310\233\342iusY0\261\037\245=\350]&\031S\212\322\331\315\0356\261\337E\310Y\347\240\207}\265>\013\273X\320\342\302\205\342\356\247\300#0\253 I\317\214\316\253\200\205\251\305\0013\256n\226\300M\230h)^\2041\275\240"
+	.ascii	"\353F\252\"f\307\366\266\274\304\b\t\251\252n\375\271\273K=\374"
+	.ascii	"\305\364\022\225EU\267`\234\270\354\305Pf\332\360\\N\\\346\372"
+	.ascii	"d\256\025O|\224\276\232c\b\264>\361<I\310\342\302\3569;\256\260"
+	.ascii	"b\023\377\f+a\262"
+	.string	"!eQU\347\237\3141F\347\335J0\335\230d\370\317U\202\346\261\301\203\221\345\317\224\330g{\342\034\024\271O\270\314\265L\303\201\221\313\236\001MT\3435\226\305\205\f\342mm\312\360\337\362\215\223\302\b_\335g+B\221\203V\0215\203%\256o\213\377\354\233\203f\027\272\b\263\270pA\360\006\275K\243\006\377\371\376\334\223k\366\234\340\tN\267\272\271\013\327\344>\333\375\237Q\352P\331\266\262\373\274\357\257\334\354t\337G\371\233\357\235\374\356\373%\377\272\327\237W\362\351\367]\327\363\375\326_\370\276\371>\337\345\003\277\013\370\3377\311\021/\222\337\371\0369\240\357\020$\257\220\007\372\002\371\3407\204\023~Ax\341\267\n\311\373\301\021\357\217#^\037_\363\245:\013\337\036/\363\335\3612\337\251\267\371&\340o\277\007/\363\355\340r_\016\016\367o\220\344\255\340}_\035\377\373\3468\337\027\307\363\276\001x\235/"
+	.ascii	"^\367\275\361\272\257\215\327})8\232\357\004\347\255\221\344"
+	.ascii	"\225@\211\227F\2227\002#\336"
+	.string	"\031J\274RH^\b\214x\037(\362\312(\362\3068\342u \311\333\200\022/\003D\2740\224x\0278\342}\201\344u\221\344\215b\336\026F\274,\220\274+\220\274*\220\274PJ\274)<\360\242H\362>!y\235\220\274'\224xM\024\361*\220\344-\201\344%\201\344\035\241\304\333\324\201WD\2227\201%\336\020J\274\312#^\020I\336\017K\274LJ\274\036\214x;\034\361.\031\361*%y\223\316\213\224\304{\204\3445B\362\026%\361&\221x\211\214x\221I\336\241$\257\220\021/\007$\357\206#\336c\2227C\021/\206$\257\321\2107\250\210\003Kl\232\372|\316\177\240|\205\177\004C\210\350m%X}\226S\252\022h\021\t\264\007P\276<!Z\331\337\352\341\235\020\255\304G\331\337s\006\204\362\311\361\363\003\236\321\240|vJ\020\275\315\2055\025\362A\032\202\234\247\236\017\r\242\207w2\340$\037\372"
+	.ascii	"P>2xL\355\241\337\325C>:\232\251\227\314t\021\006a\252\263%\026"
+	.ascii	"\376\323C?\3179\020\3127\006o\213\3175\360\251\3415yPC\337\035"
+	.ascii	"-\020}\266\335\\\216++\354\265/@\313\2018\320\227\300e\301\257"
+	.ascii	"\177_\372\354\016\035p$\267\276\231: \345d"
+	.ascii	"\302e\b\374\330\016\344H\322=\335c\3732\005\372A\013\357\261"
+	.ascii	"\202\240\004\326\263D\213\221%\317R\2578\024U\363\302\024\317"
+	.ascii	"\221>\340+\320\213\316\021|\313b3\001N\220\251\317vC\237\216"
+	.ascii	"\303\303u\347\241\317\026\202\261\245"
+	.string	"\177]\212\334Z\026\3458~\345$\310\255d\001X\242\340K\344\322Z\350\252;\342\276\333h/\034\335\2417\364\211\233\263\324\035\372^\370\216\325\322P\224.\320\316\337R\203\240\025\255c{\3339\251\n~:\364\3312\022\367\235\225X\372K\237\224\356\255\204I\373\"\305_i\257\035\"\331\350K\327\346(\375E\212;L\262\321\024\260\330q\364\277Z\250\316\032\365\303KJ8Zi\214\357\251\207\203\264\004-JNOj\r]~\360\216FZ\227k\374gR\027\311\376\244\307\255-\251\317\366L\264\"Rk\350\022\347W\307\002&\332\222\255x\"R\337k\314\250\223}\324w\2021~\341\024\213\332\250\357T\303\321E]Tc\002\323Y\262\021\211\242t\201\226~\214\267\034\223\264\024\245\233\316\341\273\245\333\222\314\022\002\313\270\342\211\311\276\364D\265(]\2402\2677\27003A\244>[\037\353\025\243{\265\217\325Y\344t"
+	.string	"\264\327\036\021\365\275zh\306\f\307Y\316\275\310\202\206\341,QH!m\201N\372\306\rQw\320\212\2521j\273\217\276\013td\342\372\370\001?\263\227\006'X\224\374\233\007\224!\212\303f\250\252T \230\226\341\302\275\200\221J\256n\"\373uV&x\272\b\367\317\013\rr\250YL\334]\234\0175T\037\237P\306khI\013\311\231s\241\026\322\023#d\023\323\200O\347rN\347w\313\202QU\325?\353\226*\240\200\352\361\301\313\200\331,\355\370\317/\351\343\275\350\314\036\031Q\311\326\bB\027\360\2354\025\234\245\034\006\240zl\360\026p\213 \007'\315\241\237\027w\267\305\177\3568\215\bK:\214f\2517\\\212\316Y9\361\314\034\207\276\230\350\234\2252\267\267\r}'\335|\272\bsp\206/\233\342~\311W\334\321\267\374\343?7\364[8\247"
+	.string	"\325#\203\347\344\024\270H7\364\331\016\317TD\342&*\007h\203\220\254\367\001eM\340\264\311\203Av_\0065\220Y\206\273\312\305m\001\225\350\300\224E\021\263<\006\016\212\t\313a\224\306,j\0131\274\2660\252\031\230\345\265\0054\252j\363e{\246\342\211E\2523M\316\027V\333]\300\277\214\237\252\211\023}\fW\263.&\334\343\235\251xl\037\275\334%\246\305\205w\330\213\025'\265uaz!&E\345\360\312\332\2700\232\221\342\211\3076@TnZ\346\266\305H\023\b\254\205\351%E\026\252n9O\022zt\206\346\351\3725G\002\314\013z\002[\203"
+	.string	"8fd\300a\225B\256\224EF\034W\003\f\004\220\243\206\322\202\n&P\226@QBiA\005\312\013,\250\201\001\215\031\026\314\260AC\331c\004\212\025\312\032\021(1\270\200"
+	.string	"9\224\024\350\270a\001\006\027\250X\024\2745r\314\320\241\224\340\006\216\031\031\350\270\261a\2252\224EF\024W\331@\221\037A\252\256\256\250\212(\257\202P\021!b\204F\222\n\310\216!F0L]M\365\030\2120E\204\310\324\221\310\225"
+	.ascii	"\200L\035)f t\343*C\017\252\017x\\MY\005\005\251\262\352$SVM"
+	.ascii	"\374\340\352G\020*\034T@vLU\021\231:B\224\204\252G\220*b\017"
+	.ascii	"\252\037A\246>\240Ae\004\310"
+	.string	"\324\021\r@\246\216t\325\203P\001i\"WC\024@E\244\nR\005\204\312jJG\017+\036A\313#E\025\020\036PA\252\246\254\240x\020)\002\225\302h\205\f\241\"\002u%D\b\021\250#\234\372\266\262RY\255\205\345E\030o\320\036\334a\321\211B\001\245$\241i\"u\321'\252\317\230\312\005,>@'\215\002V\337\323\237\321\311W\240\200`x\\i\337\016[\332\354i\301N\247\372\033\304\203\342\032}7=\207u\007\013\217\321\311c}\002\023\2158\324\026W\246\006\361K\324\356\2052\267\267\343\263L\213\305\260\203\215\346\021,=\231s\rMW\035\t\226~\207\036l\364\215\033\335\020PC\246\271Go\317\2456\233\326/\274\266@\025N5q\273K5yP\250\013\235\301\025\022\220\301\312\023\205\325'A\037\253\214\371\321\342\233#$\016\376\031\243\242\317\270XHW5\215\336\305\362\203%X\304\214Fk"
+	.string	"\375\0231\335\202\212\240Y-\316OHs\263\305`\0012b\r\032\235\337+qb\004D)fN\265\273h!_;p\246\244\230\021B\317\350\277\260v\251\273\312\020\264\323\245\232K-\245T+\2014\004}0k\027\024\0174\373\305\335\001\351\007\272\255\020\022\233"
+	.ascii	"\356y:\341\364\245\351\036\234\024L<\275\202\366\222\321W\213"
+	.ascii	"\363\033\3221ZF\367`\227\230\326\021P\004\241c4\207Y\321\n\273"
+	.ascii	"X\250\240\207\364\355\254hwN\rt\021\213?h\006\272\252k\331@\177"
+	.ascii	"5sv\223\001\021J\240\177c\204\n\013\013\013]\364\007}\"h\312"
+	.ascii	"_\324\304\322\253\b\243\213m\242m\360\304\365\365\027&\330\322"
+	.ascii	"\013\253x\"\214^R\3435\266@?\217\331V7Y\0010"
+	.string	"\3771A\234h\233=\201\177\321?\276\032\315J\006\227\345\b/JX\352)\265\261S\026e\213\226\027\375>\3216v\312\334\2304\226+gR+U\200\334a\013\353)V\013H\235\264\331r\204\250\226\262\324#\016E\333\324\351\262&\013\241\205\364\306\354\b\276e5\b=\254r\321\033@\377\322\244xGU\263z\026\003\375#{{S\"G\037\233tz\246\354\321\373\036\022}\266H\316\265\266g\037\311\255g\272\352\230\234\256\243\275>8\327\304t\3255]Is\340\236\t\200L;:\207\216\216j\316;\322Q\315!.Z'\216o\216p\005\350\210\247\353\350?\373a\326\022\336\242\257\244\333\205+~J\022]B\341?[\364t\317\316Lp\312\265\244\211Eo?Y>\221\360X\321,zx\207\315\234Ox\222\025v*:E/`\b\325*\240R\364\005\375\"\320\252\233\b\024\275\335d\231\265$\243zj\024O}"
+	.string	"\250\337\232S\233\350e{\375D;\2350\321\367\343\2276\350\007%\001\005z{\tV\240\245\224\037%Z\201\022\215"
+	.string	"\250\237\023\022\335\324o\366p\220G4\211\021\035\202\234\250\322\340(N\342\240bN\315\214\210\214$I\032\003\262\n\020\210Ba\036\327\222\017\022\3004A\007\204\212\021\222\021\022%\331\237\003\021!\306\355X\3538\217\377\315\360\023B\307\334\314\252\"\005*\354\275c\227\204\367\255@\227\302\312\343O\320\314\262\261\277\350\002\204]Y\250s\340\004\240\203?/\237\334fq?\331g\313N\t\263\t2i\272\357O\312\241\266\250\032\256\001\237PLR\301s\310\027\251\333\242\342\277\220\262\247\343\363hH\327\323h\234\235\307\252|\216-M\342P\0326\026\345\020j\317A\240\373\374\032q\bSV5\024Fh\363v\305\201\317\022\237\r\b"
+	.ascii	"\313\241S\234\317\333l\236\263\204\233\023\217\371\030-\356$"
+	.ascii	"D\201iG\204V\367jjd\365\211*\305\224\245\241z`N\270\273\\\372"
+	.ascii	"~\276\240\341\356\370\373\231\346k!\305~R\177\201Rj\273P\021"
+	.ascii	"\351#\224\234V(>\226Z\242h\240\332\362\rJk*F\221\375\033\351"
+	.ascii	"g\265a\210\300\t\310D\264T\317\233\343gA\373o%TG\311\n\235"
+	.ascii	"d\357\305,\371\245D\370\025\303\210\244\032y\276M\216t\304\006"
+	.ascii	"U\342\026\277\335\325\363]\342\330\347_Wc\013\301\316\007F\032"
+	.ascii	"\013\033k\027\2128\243`\275\371\302\300@\375\373\270\b\"\246"
+	.ascii	"\256\242\210=\261\201TZTs\n\343e\222\026\032\210gG\201\263\035"
+	.ascii	"\257\221\220><\2563\340\203\027I\001\241\212Q\3328\261\031\311"
+	.ascii	"\240\b\031\001B\242\t\324\270\035k\334M\367~\201R\277\307\230"
+	.ascii	"\211:\335\225\331\227\355t\260\013>\225y\300\273\334M\253\271"
+	.ascii	"a\327\356\320a\023N5F\374^\006*&\205\223WF\307\fl\262;\267O\325"
+	.ascii	"\024\023\317\3131qB&\2602\355\213D\231\330s\262\231M+\217\274"
+	.ascii	"-\206\240\274\274*+\253\263#\231]P\351\005\312\245\023Z\262X"
+	.ascii	"?\214\216\005\361\016Q\204\356\364\370\016\326\021\323\203\002"
+	.ascii	"\262\006\306\372\026d'\223A$a\211\305\205\310\017\025\362Y\223"
+	.ascii	"m\367\037\306&l\317\344\340\231G\220r"
+	.string	"\223*\365\205\254\031O\346/6\262nl)\026\304=\360\237s}\323BV\252D0\031\022\240i\355\261h\013\353\357\373\267\346\211\017\232\341\202\247\211\317\320\021\357x\305:\366p%\252\3314+\3431#\017\225L\222\364WC'\220\337\334x\277Vw\235\031\322\f\b\036\2758;s\337\305\020Q\354\026W6\346\215\252i\005J\230b`^\3331\312\204K\032o\320\202\215\250`\367\261_\023\233I\364\277gNOO\202\030\245Ma\\\370\251\"\277\272\031\316p\235\326\026\325p,\b[\236Ci\006\307\0167\213\006dSe\322\260\302v\345b{\346\322\031\210\222\244U\316\340p\330\351\257o$\301\300\"z\260*{\004Qy\353\201\203\333A\226\023\335\360Z\236\272\326AI\343\270\213\322\275\2156\177\241\374\r\206\221\215\240\210a]\330b\305}\376X@@\001lY-\224K%\271s\205\026\260\3474\274\017\316\275"
+	.string	"\320F\036\177 \217\347\031~\005A\004\307\206\231\2756\263\307\304\270\370(\037\006@\203\n\277\030v#\202\270H\263\325i\313H\005\263z\001\317\365gH^*\334\330\255Vz\370J\021\200Z\021,\300\017\357\246\350\265r\245\267\364\352\365oS\324\022Y\275\201&\220\004\330\327\213\177\256\370x\316\274\345j\027qz\363\211\020\267\342\004\365\300\3120\200\327\277\273\367\370\020\354:\335\344xa\365\035\242\310\337\357\007{=.\306\205\210x\340\2301\312\033\f\320\030\034\030gIP\250A\250\344(\300\006FV\354\214\325\367&\267A\255J\016\207\347\262\n;\b\320B0\"\260=\035\370\320\276\263R\372Z\300M\214\013y\221\255\304%B\223+\375\"\211\322\345"
+	.ascii	"{\352Y\366\221\345\315@\300n\306\024\201;\254M\237s-:\255\276"
+	.ascii	"~gk\257nn\326J\025\r\377\023\001\2028o\f\260d^\"\264t\226{s<"
+	.ascii	"\353\316\022\366#>\350\002\3327vs\312\232\313C\305\320\250\352"
+	.ascii	"k\202\n\337\202\360\311\023\250\037;\346\007\373\351\341\341"
+	.ascii	"\226=\301\355\267\265\020h\006\215\216\337\204\301\321\004\272"
+	.ascii	"\343\270\"\231\322O\245?<b\321\270\221)\254\356B+p\243\032\220"
+	.ascii	"\377uC\036\203\201]\2372\222G\365\022T]\265\304\246BJX_\022L"
+	.ascii	"\t\260\320+\314/O\247\033\340hv\354\257\357\303;x\b\201\366~"
+	.ascii	"\207\330\007\361Ul1I\b\312\374\234\220\323gq@o?\366\336\352\025"
+	.ascii	"\f\327jb\t\256\310\312\233\305Z\371\354{\21373+\262\024G\213"
+	.ascii	"\317Bj:\311i\256\336\226\250\362\210\006\020\3314\276\215\002"
+	.ascii	"\307\352\343\006\221\036\\\227\271;\370\267\300\037\005\274\006"
+	.ascii	"\233\207\232\277\207\250b#@\334\362\331\313U\321\276\273\213"
+	.ascii	"\231\211\270b\022\242\307}\2253m7\321b\217\204}\204\321\367\360"
+	.ascii	"\221$\347\257y\021\177[7NS<\222T\223-)\277k\370fX\316R\263\307"
+	.ascii	"\236x\224L\311n\230]\255\r"
+	.text
+	.section	.gnu.lto_getMcuTypeById.333.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\205\013"
+	.string	"\306\025OA O\225\016\300X\224\b(f\340\001C\300\377\025\364\007\270\202TM\350\370\025\020\003d\tP6\204q\325\373@\372\013]~\241A\206'\200\233\300\"\210m,\013\2545\354\362\316\305\030b\311\336[\246\0249"
+	.string	"<"
+	.string	";"
+	.string	"\256\026\273!\347\360\023\355s{\207\366\031-\274\273\214\332\371\242\313\b\206\205\006\226\354\003)<n\200$I\331\335\267\256&\320S\215`v\327\372\201\023\356y\333"
+	.string	"ls\366/\001\341\257V\177z\304.\2048\235\265bW\302\354\305\252\2300\f\266C\266\206mU\373\037\016\"\364\020d\214\335\n)^\273!\210?\266O\212\264\355w\270\207\220\273\220}\245V\332\006T\204\022\302It\333\356^\374\021w9\360W\237~\360\321\177\237\376'rx(\023,\330Hg\272\273\242\030U\226\034\244i|\3532\303\t\205LD\214\244.\354P\244Qe_nLY>\316\020\020\220\t\220\031\260\031\330\2505\226\r\002\r\247`S \001\247\351x8\313\304\234\005\007:\\\003\016\247\3039\334\307\224U\375\022\f2<\324\t\016\273\245\177\236\255T\251|\276uI\224\361\321\024\215\031E/\023"
+	.ascii	"\3561\320&\270\302\020\226\005\210\306\312\020\006\016\302\\"
+	.ascii	"\307\030B\2529\2705\\\030\215\306Z\240\032\241\311\030\001M\210"
+	.ascii	"R\002RUZg\234\355*e"
+	.text
+	.section	.gnu.lto_cliStatus.334.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`:\025=p"
+	.ascii	"\n\304\254+K \224\322\032\003\302\267\355\363\226\177P\020uX"
+	.ascii	":\235\332\303\333\331,z\227tA\376-\277\203>&\275\001\"U\rISu"
+	.ascii	"=J\225\203\177E\270\340UKxN\272H\027\266x"
+	.string	"eKQ\016=\365\346v\347f\206\230H\345\226)\245\024\245\002t\002\265\002%\210\316AEg\240v\376!:\373\024\235\213E\347\236\2423O\217\363N;\023\213\316:=\316$x\234\207<\316B\2423Kt\016\266\363\272\343\374Dg':w\373\200\221\007\2476\205\r\315\311\343\255\275@\002\217x\253\3018(}\246\273Lw\265\233\256[L\367\\w\226n\266\356\266n/\335p\335q\275\303\334h\316\344\260\313S\223\363U\307m\327f\252WE#lik\364\336w\255\2052M\177\247H^\2401\26646zWAp\223a\"\035\263\245zYS\223s\302\030&\212Q\266]k/\030\f\267\252\332\224\367]\263\321r\334@0q\256\311Hm\34325\354\340\267\226\336\322]\372\255\2774\030&\276\210\341\3548\024\326\227\310\273ED\nj\333\332\bp\3140\027T\267\b\206?\264\233\263\275\350\360y\253o\273"
+	.string	"\245B\326\300\260\203\255\247\324A,\227\366\301\331m*\370l!y[\b\224\312\021\275\367\375Z"
+	.string	"N\247\203X6\236\363\341B\362\376L\331\250\354\240\367\276oT\367\320X\234\235\205\307\372ry\271\2024Q\355\304\250\311y\3375\247\016\362"
+	.string	"\303\016\266\253\257\261\260\306\330\316\334j]\305\331V\232\375\363\276J\272\300\275\357\332\023\247\030v\220\327Z\210\355\340\260\203\330\016\262\223\331\315\277p\257\021\026\255IT\213\234\367}\241\276\006^\n\352\260\260\327\265\346\341\352\354vI)\311\004\322\221Q\021\321\220P\211 \240\037\237b\017\317\016Q\207\304P\310\006\327w'\367J\315\013#\005\333\352v\025\366"
+	.ascii	"\362\244\357\276\270\2543\376\364\342\032\214\025_\242!\354J"
+	.ascii	"+\201\351\037#\325\256\252\346\227$\354J'Ui\023+\214\036r\306"
+	.ascii	"\372\356\253\312\272\363\027E\323R\276\324\034\211J\037Q\331"
+	.ascii	"\301\215\322\272hm\323\2468Q\2220(=\004\345\211\0139\351\022"
+	.ascii	"N\3004\361 \241\002c\272D\n\252[U\315\217\2060\031\032\210I\377"
+	.ascii	"0Y\342>+\01322BZ\310L\331\020m\346\314\213G\272\247\357\276\216"
+	.ascii	"\264\224/2\347!c\304w\3140i)_cN\\c0\221\022\245\311\364\211\273"
+	.ascii	"\257\"\253\316\234\333[\217\351\023R\276lp\235\023I\302dh\022"
+	.ascii	"\353\360\356Kl\235\341^`O\037\322\020F\244\205C\232\325\001\213"
+	.ascii	"\241\203+\013\275/|=`\320U\b\310\023)\021\254\207\257=`\321\265"
+	.ascii	"}\337\227\b\326\345\337@\364\006\3246.j~I\302\210\264\013\025"
+	.ascii	"x\337\227]\n\026\326|\242\231\335\007\263\0271\377\274\020\337"
+	.ascii	"`\272\247lig\3217\367\037]\300{\351$\351\357aK\230\255!\333\215"
+	.ascii	"\002\313\353\027\3603\336\213\331]\350\250\357\350\017=\307\344"
+	.ascii	"\260\270\260u\237\3570\376\345\306!r\373\206P\027\322\343\267"
+	.ascii	"\270\273\211\215z\237\027\226\215\221y\342\261\221==\220\r\343"
+	.ascii	"S\327/\3115b\bu\260\025S8c\252]\277\305<@\233|\t\276\031\243"
+	.ascii	"\300\026\360\030\210\245\201\322Z\200<\361\261\276\031;u\361"
+	.ascii	"\227X\326t\371\037\033\273\347\213\337Q\"Q\317\363=\337m\240"
+	.ascii	"s\236\036\310;\317\343\002\272\217\253\341\373v\311`\207z\324"
+	.ascii	"\r\334r>\237l\007w\276\201\350\025\216X\2323\262*V^JF\006\354"
+	.ascii	"Y\312[\316\273\234\321\342\331\217!\324_/\247\013xA\364\374\364"
+	.ascii	"\272\204?|\342\267\234o9\201\b\201\r\241\r\347\f\022\375-\034"
+	.ascii	"=\2479\203\373\210\006t\3020\304)&\306v\220\370\256&\216\304"
+	.ascii	"\353|G\347py`\221\376s\032\031\276\357+\203[N\3739\217p7\351"
+	.ascii	" ;gp\2269\313\330\016\222\370~\263\304\n\227\007\232\r\215K\234"
+	.ascii	"6xK\205\277\363\346/8}\323W\r>\273\347t\342\2042\204\266\rQ\330"
+	.ascii	"o\003\310\301"
+	.string	"\211\346-\r\376\316\2332U\024\316\354\244\342\254\322$\004 \022?\275\326\375\327o\271n\263@1\357}\241-\2451\204\366\020\025\016@\340-\345\026\372[\214\344\377\314\024T\340-]\277\355\372-.r\346\fjxK\377\333\347o\261T\327Z+\331~\377\206\356\360l!\032O\311\335\2049\360\300[\352\001\333\301~\035\261\272!\310\252\020\341\362@\346\265\247\277\031s\3178\373\323\343W\302\334s\315\035\355g\237in.\267\350\314,:g5[\363U\2635[\025\235q\264\230f\023\272L\363\b]m\026\241\351\232Ch\270f\020\212\316\t\024\235\021\350,\315R\315\326|@\213i6\240\347\232\243:\256\271\200\216k\236\321\316\004\020\235e\024\235c\024\235\007(:\303 :\277\350q\026\240\350\354\"\310\031\252\350\334\242\307\371\251\235\215Eg\247 g\026E\347\025@\316M@\316*\212\316\001\024\235\231\200\234S"
+	.string	"9\243\br\006"
+	.string	"\310\371\004\220s[t^*:+\t\235\223\210\316&\210\316HE\347\243\037g\243\242s\221\2173\021\217\363\020\217\263\220\217s\357\364%\250t\201b,\036j\332\007V}\376V\333\212\017N\371\002\253]HM\237\365EmT4=\222\226"
+	.string	"^\305#\325}\351"
+	.string	"\376\333\216\326\360\320\274\024]}s\301C{B\344\324\007\274W\227f\372\035\035\230\351\017\230\362\001\032\245\370\253w-(R\374Zg\365(\336\247P\351\360\240z&\204T\231R\364f\354BN]\304\005\017\215l\b\307#\360^V\357B\254\315\033"
+	.ascii	"\336\352\333-:gi\304=\342-\005\340YL\371\342\254D'\036\307\027"
+	.ascii	"\271A\313\264\317o]D\330\313\334\324\365\276\\(N\374Q\032h\020"
+	.ascii	"K\337\376\021 T\217\313\003\333z\351Y@$]\277\325Co\306\355\316"
+	.ascii	"\300*\375\016\rX\356\355\232\261\314n\r\356\022o\251\322GM\371"
+	.ascii	"\366\252]|tU!\243\263- \344>\354\360\311\341\330\311k\271~s\235"
+	.ascii	"(\345Aq\243\030M\371\300T\201\332\376\324J\374\350\244\237\262"
+	.ascii	"\341-\327]\334\034\206Rf\027\315M\363\226&\275\321\224\357K\325"
+	.ascii	"\204\025\227J\261\312\020\352O\204y\355^a\221\336\304?Aw(\001"
+	.ascii	"\213\253\305[\212\364\301*\036\365\006?\275#zAovA\331\230\233"
+	.ascii	"\033\200\216\320\334-I>\f\241\276\304\350\217\276\225P\337\302"
+	.ascii	"D\347\b\341\344\211\3754\t\254\321\273\024,k\334.N%\001\352\214"
+	.ascii	"]7\227\342\276=\235u\220\375\006\217\342~\001\343\316\315\261"
+	.ascii	"\0354z\250\356\373\301\304\007\257\365\021\376\347\373\316\235"
+	.ascii	"\270a\306\f\241\236$i\272gW\205\376V\361\316\231\270tuC\250\223"
+	.ascii	"\355\321\021\215\001\232\3511\3401\020\303\243bY\3435`\340\262"
+	.ascii	"\351,gM\270K`;8\302\277\233\227\fC_\342\211\276\2418\f\233\351"
+	.ascii	"X\241\037\372\206J\021\341\205\276HKt\216\222\022\206I\274\314"
+	.ascii	"\2653\343\2369\303v\260\304/\225\215\305\361C\3424\322Y\316\234"
+	.ascii	"\314\217\270i\030\317U\343j\330\016\212\360m\246-83\026'-\216"
+	.ascii	"\313\003\231-J\327\020<L\2355K\315s,\3203\237\275\247w?\302\354"
+	.ascii	"\274\031{\221\016\n\341A\370\240\3673\252\227\267(\021\240\017"
+	.ascii	"\341_Kt\216\001ol \r\260\214\025\361\304c;\342)\226%\b\024\342"
+	.ascii	"\233\2610\b "
+	.ascii	"\023\276\3074\220\030\274\"^Hp+Y\003\336\253\311\376\374\022"
+	.ascii	"\213\032\037.\346\262\231\301>\304\211\270mV\367\215K\004\353"
+	.ascii	"\022\301v\360\347\233L_\360\034s\343\027\347_\332\274pD\307\335"
+	.ascii	"\003\341C\230\356\241\235\341\025y\375\364\236\277E\342\315\230"
+	.ascii	"(\025v\264a`K[\022}s\366\342U8#\314djW\216j\231U\310\366\006"
+	.ascii	"V\325\325r\201!F&\263\262\224Kd\313Lj\361\230juT\331hw(\247r"
+	.ascii	"P\035\255\030h\231\271T.\227\016\2644^HP\344\025L\246\366\251"
+	.ascii	"\345\261Lji\035\247\332\032H\246\246\266\003\001\\\264p\321\262"
+	.ascii	"ho\034\265\254\224\035\250\340\017"
+	.string	"4h\215H\255\343\262\275@\003\020 h\215m\322\212\212\007UkdbB2Eq\200\001\215\007\230\271A\253\205\225\\.u\320h\215A\314Db)\251\222\314\366\252J+\213\203\366*\251\305\344Q\343\210\251\230Z\254\314d\222b2\261\334\032_\271\344q\243%\301F\347\250\226\251\\\362\200\300\207\255\246\216VU\307\024\216\355\216\343\225\221\311\324Fa)\253\264\216K\0357\252l`)i@\361\016\246\035.\332(&3\271D\"\217\255\021\311\324F%W\250b\2669\250\216Z5R\360\n\021T\200d\222\312A\245\264\242\3212\231Z\016hT\020\304TfiUM\261;\222H,\t\202\222\313\243\n\310\3451\002fO\016\346\361j\255j\2462\353\221X:\2246\2029\230\307\n\230K%\023+Y\003\231\324\242Jj%\221A6tL\275\026\322\223ZG\rv,Y\346\215\243\225\215`\022\253\312*yu\264"
+	.ascii	"yE%d\252\026UVTPXU\307+(\252%\023\252\205\020+\263\222K(-\245"
+	.ascii	"r\tE\\\343\352?\030\252\\\377d\025\332t\254\357\233$\001\275"
+	.ascii	"\036<Ph\372\027\204\3337\343F\323?r\360\256\270Q\352\347\257"
+	.ascii	"pxW\254$\271/\305\203\225Z\247\210\275\331[\337\367}\227\b\370"
+	.ascii	"N\343}\356\026\241UH\363\317\213h\302\361\275&]]\323\316\216"
+	.ascii	"\355 \001\317\226\031\t\364\213\223z\031\337\317o\300(\221\030"
+	.ascii	"/c\200\217\361>"
+	.string	"\027\225\201\353\215=\300\367\024\252]\037\364\210\242o\256\367:)\234\006\342R\317\334<\323L\303\266\264\350\033M\273\332\264\317\210\337\022\246\007\230\322\233M\3254\331xK\335\237`\332\327\347\246\331\246\371f\b}\300\2768\325\256\244\027l\232D\0205\367\206\320'\323\214\363\342\215\246}uU\"\325\353\b\023FN]\224\207\207\346\346(\353\023X\373\212\025\340\247\232}.\004\032O\323\364\343\246\021M@o\002\262\035\024\340{\312\214\360\245Yq\247n9\277k\006n\r\241\377C\037\225j\017\343\267x\027v\356\323\3551\204\276\022\250w\361OQ\250o#\236\276\305?\261\340\345\272\340-}zv\016\311\01607\210\267\324\370\301i\237X\365\231\300\037\360\b\374\212\2071\306\205\301\0352\204z]\212W\f\215\323\303xvh\021,\002\201\207\250q(\305\024c\244\220\214\214H\222$i\rA\005\204(\007\035e\035\021"
+	.ascii	"1eP\315H\222d9\333O\230\342z\371\230o\310yM\370Q\270\013\375"
+	.ascii	"c4}V\365\377D#H\n_\005\363\021Y\334S\377T\fzJ\376\363\300S\215"
+	.ascii	"\263\374"
+	.string	"\310\305\002\257\304V\326\202\213\241\2347\334\365\305\312\024\204B|PuuT{2\205\362\252gW\004\251H94\226X\204!@\210#`\271\261}\267\026\006\367\250pb\216\016'\007\224\320\025\365 \375\267\272\331x\033\037\216\003C\002T\220\350\034\\\\\330\036T\3616\362\232\333\365\231l\013@\317\217]'L\2479K\314l\325\351\334<\032\036\327M\026\3656V\253\2558\240D+\025$\212\b\332\375\351\273\2217$s|\344\\\212c\360B\007\253z\351;:\032\365\022BS\370Z\311\265\030_\307\016[\026\3743\332\202g\216\203\265!\252\353R\372}\006@f\201\365\206\365\313\271cA\225\322F\016\0054\230\031\222\033*\235WX\215\005}\t\t\332\316S \222\317\226]9\261\373Ha\034\2113\035\266\237\034\252\033m\0061\036\314c\025\321n\356\312\343\221cu&k\340\002^\210\r\240\212\204\354:H\317"
+	.string	"\270@\363\206\264\037kj(YZ\301\270\336\236\253\325\212\017\237\336u[U\203\377\313\300\211\244W[Q\017\2052\265\266\244\"\211n\037\314=Y\260\342\"\347\023z4q$\021!\324\320\315\002\177N[\302\316\352\377\002\303>\234U\304\310r\254sX\250\r\r\340\274\301\007\206\212\021\203g\312\202\023c\226F\302IN\326\027!\037\331oWb\036\270\351Z\250"
+	.string	"\374\266\211\210\204\0311\355!\02184\013\027j\225\221'\330O=\235\204\322"
+	.string	"\266h8=\254\001\303J\355u\214\330\225\216\210\205\365\032\241\347\b\347\353kF&\377*O\273?\2102\224\255\207\f8\225\306\025\022\033A5\300\262\\\201>o^\266%\241\025\f\222\177m\344>\270\037\310a[t\274I\303\2624G\222R\366\351\322\007\260U\205`\020\3426\255y\237\307='\026\347\2148v\300\234\233\325\207*\350\207DZ\255\210\220k\200FUI\271F!\356\024O\255\234G\303f\023\340;!L\341/\267C=\201\267\375"
+	.string	"].<\035\341>\265z\206\332J\250%\236`-\212j\342\016U\376P\211\273\305\026\243\354\313\263"
+	.ascii	"\266\372\204\021\032:\022\342\021S\370\210\332i8Rg]^\002\023"
+	.ascii	"3f\3107KD\301\005-\333J\033Q\325\230\bH\037s\bst\210I\313\302"
+	.ascii	"N\331\317\360\216-\314\033\260~\224\0312\241G\356+\307\304*#"
+	.ascii	"\330\037B\217wE\252\334\223\017L\021O>ZH\343\302c\215d\343\b"
+	.ascii	"\304:5\3125\035\351@\304\246u\233s\227\244-]\301\210\270E\233"
+	.ascii	"\254\224\006y\367Ji>w\365\f\237\374[\223/\253\036\310\366!\340"
+	.ascii	"\030\023\3151\021\fF\376"
+	.text
+	.section	.gnu.lto_cliPrintTaskHistogram.335.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`a\002\315\023"
+	.string	"\206\244\202I\320\320*\035XO\216~P\346\223F\022,\313H\347\326\312r]\214h_\037l\034\252\016\037\016\341O-\303m\263\262\200\033\255\334!\365x\320~6\307"
+	.string	"\371\265\210j\220\204:\2100\3518\034\307\262:\335\233\220!B\344N)k"
+	.string	"g"
+	.string	"n"
+	.string	"=\016\027\331\315\221\001\264\353C`\003\345I\373\216*\235,/\240t\3223\273\206.\320\216(\365|\350"
+	.string	"\314\261\273+%\341\361\243\357\036\347\354\344\250s\346\373\334\001\317\210\006.G;9\002 \362D\200\344hF\023\335\220\370\340gMnf\216<7\327\007\017\201g$\304\345n>=\030\354\256'.\007\342.\335v\314\366\003{\332\004\003~;aR\2576\213\266\2176U\207\310\323\001Ys\354\323{\377\307}\177y\340M\352\364\250\323\252\323S\247\017R"
+	.ascii	"\351\306\217\356E8vm\212;\226\210\fBq\340\355\377\370A\233\374"
+	.ascii	"\337W\314\016\264PH\rgEln=!l\354\356\310I+(O\246\306\233lO\237"
+	.ascii	"\f\201\220\265\375L\214|\332W\361\236\331\003S\307\307\335\335"
+	.ascii	"\221\344\244\236\364H<#\341m73\2136\315\251\027>\250\002j\245"
+	.ascii	"\27450\301\241QZ\3540X\tvvm(6\313_\270\234$\331\231\372\340U"
+	.ascii	"~\273aRPm\026UuC\"\217\3324\257\037\372\237\017/\004(\332\275"
+	.ascii	"\035\367R\336\026\0348i\2732\314\343l\302\271)\3156\354-d\345"
+	.ascii	"\256\355\304g\001\243\241<!\243\001\226\235\250R\037\226\235"
+	.ascii	"\250R\244e(\252\024L\345\321\272\253\005&\345e\345\345\342\212"
+	.ascii	"\301Z\026N\033Z-,\257\230\222Y%-\f\254\025Lk\345e\305z\301V%"
+	.ascii	"(\273bX^\253\230\313\365Z\231|{\315\361\240#\005QMgl\232\252"
+	.ascii	"\343P\004\224\204\362\2262A\3451X%%L\341B\252\367y9\343\267s"
+	.ascii	"A\252\216=\206\364\244z4GNj\215\205J\244\276\367;\262\005- \200"
+	.ascii	"\002\232\241\243\007\211\243\374\007\226\205\326\370p\325\235"
+	.ascii	"\177\030\034\342\272+v\020\021\b\246$`\032\006\242\260\004eP"
+	.ascii	"_\336\233\277(\377\337\321\310p\231\266'\326\250\303\341\r\003"
+	.ascii	"\363\312\2059\276[gW\224\330\313\363K\2718\226\263c2\203\242"
+	.ascii	"\035\220}\355\246\n\263\276\257\0225\" Q\340\n~\210\360^\261"
+	.ascii	"0\036\020\"\246k=\001"
+	.text
+	.section	.gnu.lto_cliTaskHistograms.336.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\253\007\025,"
+	.string	":K \021F`^Rc\0229\231w,\032S;\"\276#\306\275\3129\2648<\213\340\374q\231\325\357\006b\210\327\3414\205:\362\210+k\203i\302\013r\340\017\001M\252\351\026|,JLG-\352,\365\303\330m\367\336R&\031\374"
+	.string	"\353"
+	.ascii	"\006\001V\315#'sR\2639{?\215\276b\t\355WW\375\017c\234\2372\356"
+	.ascii	"\216\2361\276\331\235\357\317f\034\2707\021\270\350\336\317\006"
+	.ascii	"\230\250\375\212\237\027b\277\266\017\262_\361\2131\235\336\321"
+	.ascii	"\355\305:\277\264\324\346\354\275\223\264\021\034\224\337\007"
+	.ascii	"\203\200@?>=<\277\035_\333cWU\347\027\277\352AU'Q/@\275rP\221"
+	.ascii	"&\222\003\303\232G\016\204 \2549\366\23717\260\354\2432\250\353"
+	.ascii	"\"\347q[GT\241\033J\226g;\202&[_\271\007\372\035\250\263\315"
+	.ascii	"MX\023\311y\326~@~\344\035*L|*\203/29\336d\313\207*tf\310\334"
+	.ascii	"\343\266\272r\313:\2450\351=n\253\207Vf#\310\2511+[\225?\256"
+	.ascii	"\254\254\236\310\211\\\324\314.\254\231\344Z\215\2205\007\210"
+	.ascii	"\017\027\226\312s\247\205\346h\3175\270\256r\356e\330{\343\274"
+	.ascii	"\344j\036\0038\306o\302\370@\214Y\006\001\317\351\333\0220v9"
+	.ascii	"\270T\240|t\214\207\304\374%&\300\274\373\"\305\n0\026-\243\265"
+	.ascii	"\0306\3725S\332\032\254|\207{\362\253\034\f\213vo\345\227\306"
+	.ascii	"V\211B\370\365Gc\374\024\225\277\274>\332\201k\323\267mW\227"
+	.ascii	"\245\2530~Ve-F'\004\r\035\326D0\376\331?d\340\317\377\347j\307"
+	.ascii	"\2766\343\366\031\367\332\214\3316\343\265\315X\355e\254{\031"
+	.ascii	"\347^\306O\020\201.j&\005\352\004\323\323\347\276\221GgKW/d\347"
+	.ascii	"\362\177\371\263\374jW1n\303\217\336\r\377"
+	.string	"\272\334\313\373/I\240-\335\327\241t\206\031\321~\315AV\313\267\274\347B\005d\025d\237\b\324)\206C\373\365\322\003W\360\331\326\216\345}\226\027y3\203\354\357P:\265\324\355\275e\241\375\252\267\203\007\331W\301\207\342\337W\374\264[y\257\026C\335k;\\/\216!&^\231T)\367\264O\377\355p^\036Dj\272Z\345\331\b\277\376\355n\357\217\003j0~\275^0WKW\t9\333\214\236& g\356\313\013)\377\355\321W\314\350F\336#n\317^L\274'R\345\203\304\221B\346\303j$\306o\222\263\035'\260\3727\344kjwf\225\363pQ~\333\331^\262v\357\375\245Oc\3742y\235\234\355\271\213\211\347%\325\323\350YX\217\334\373D(J\253<\330\312\304\343!\305\032@\206&\345\231\276e\002\306^*\255\322(|\235\036\362x\256X\315\375\264X\334W\315\344f\2145l\310_\256\272"
+	.string	"\363\256\016\221\034+m;CyHc\334\301C\234\240U]\034\337\217\254\252i\244\311\025\310 D\344/U]\304\274{C\301\356\tZ+ cL\302\204\031\351\225O\227\230\217\2366s\002E\253d\322Rhs\f\034k$\006\230\246\f\312\2325\r\270\024*Z\245\212\254s\270\350\211XlAt\335\005\256"
+	.string	"\\\224Tz\240`\201\333\300m\202\340@\201\017.N\r\241\\\327\2051\214ZBZZZr\240\344bJ\212\352Ht\223TI\037\260P\352\350&\205n\213)\343\013\267\b\3054\224*\272GNNG\267\210\034\272I\367)9,\241\204\247\212\311\"\222\305NNG\025K\0355\f\243S\021\351\202\215\032\"Y\034\247\222\306\026=G'\251\266\311\303Sr8\305\026\245\214P\305\250a\210\246(b\017\023\221\214P\304$)\3430*\211\210L&!\t\341\243\213\"2i\352xD&\375\236\273\3153X\351\2536A-\206\177\220"
+	.string	"\r\350u\n\017\256\001 O\311\352\336{\007i\261\307`}\332\200>\364+\322\276\322\\M\241_W9\017\277`;\360@*.Iu\3570\fuUr\036\320\255\320yk\bm\264\312\337\t\277\346\265)\234\324\256.K\311\006\216\272\237V?\354\250\325EL<*R\245\256\302\025\032(\b\200\241\250Q0\305\230T\206DDDD\222&\351\260\002\031\261\252:\020H\247j\2244\006\321\225Evb\375T\272D\307]\013\243g'\005\006Wo\252\035\322\330L\021\373\372\360\215#k\200\322#\003\211\231\261H2\305\207t\002\267'\320\316\235\237]$03#\f\305\n.B\310\215\310\2623\204\023g;f*\002\370\002\202i2\373\273R\ftW\272\357<e\250l\002\033\231\222\231\360\237S\022*\221\261=\374\307\325\017\245\317\024\346\372\201\352\327\343\333\235vg\274(\200\240_Gt\275\345\327Y\314r\301Uu"
+	.ascii	"3e\243\033K$>\362&\270\221\345ZR\217\035\353\005\221R\226\362"
+	.ascii	"\244\3009\003\3547Ow\237\256\333+\003\347\276>s\314F\374\177"
+	.ascii	"\263\025\223\335\336; \023\312\242\362\345\375\324\2053\325\350"
+	.ascii	"i\267b\2519Y\316\240\225&\272\032:qu\366\034\221\336\372Gt<\236"
+	.ascii	"{\t\301\343~\"ia\355\266R\b\220\337{H\\\327\364\346\214*\301"
+	.ascii	"\342\276\270(\"\024\177\300BH\250\373\264\t[`\032\231\256\304"
+	.ascii	"\242*6a7!9oIO\3741\376\261\352Y\r"
+	.text
+	.section	.gnu.lto_cliTasks.337.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\210\001\315\017"
+	.string	"\006]iG\340\260*\035\342a\316\372\366\037%n\360P\027\202\237\354k\231\027\254\027\346mg\351\301\034\006\022\253zE\313z\3438\230\030\317K@\256968\006\ta(\363\001\256\200\006\201\034\007\277\r\26474\013\261\204l)S\nU"
+	.string	"O"
+	.string	"R"
+	.ascii	"\336;\257\354\233\2355\363\203\027#\203\305\304m\316\t\256\313"
+	.ascii	"JW\357x\235\\]\371\036\"\353\235\257\345^\311ME\347\021a\037"
+	.ascii	"\361\245\222\004\203\023#\024["
+	.string	"\276\262\344u\363\360\021]\362\003\307\002\3433W\rbK\265c2\347\264\206\"\207\373\273\355\224m\005\366Y\0045\330\262\354\261\245;sA\243a\343\225\331\227\371;>\376\237TKU\257\252u\325\377\b\345l4\035~sc\316\r9\034\263\326\265\ba\373\036\333:b\260\031\270\332'\361\230\325e2<dNY\212\2329\307\003\036\360\275\363x\021\357\335wP\022\200\356v\254-\032\351C\217\274\226e\020\325\265%\230\364\341\356\210kY\226\007y\337\352\222`p^\300D\2644\027b\003\005mw\346\002\377\236\320l.\305\331C\345O\336i^\002\365\315\t{X\341\203! \360\356[[eA\037~?\363\307rj\004VQ\231&t\245\024\023J\351$Z@:\215:\036\221\230PF`\212It\002G)\025H\"b\024\205R\nTA\241R\240g\\\371\312l\262\262\255wBj3h\260\t^p3\274"
+	.ascii	"\352\340\201>t(\226C\374\314@\214\350~\301\223{B\263\001)\204"
+	.ascii	"\b\372P\256\200XN\256\346:\261\342\305%# p\002\"\244\274\001"
+	.ascii	"{\370\307\030\342\320\224\311\330\277jP1\241\203a+Nmh\314\271"
+	.ascii	"\220E\365na\343\272\032\006Y\373'#m\b\007\233\266q\360\202\036"
+	.ascii	"\207\372-\264\032\232\205]\366\210\200E\031x\344l\017\n\263\270"
+	.ascii	"g\353\2221:\235\247\205P"
+	.text
+	.section	.gnu.lto_cliLatency.338.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`Z\001\005\017"
+	.string	"\006\033dG\340\2228\035\022Ce!\322U\002\204\211\3237\343L\263\nNP\244\032\2477y\354\204\364\233\247T\326\301\206\377\213<\254\201\375\2033\005\212\202\2005(\202\214\fC6\2644;\343`\3759)\2653\233FK\332\226)\005Q"
+	.string	"K"
+	.string	"P"
+	.string	"\257Zk7Y\204\033~\243Z67\3649\343\350\033\207:m"
+	.ascii	"\203C\313\020\244\2601\2423\2362\317\215\025?JF\323f+/`h\210"
+	.ascii	"#\3523c`"
+	.string	"z\235(\031K\031\t\354%\307m\276\036F\322\356\226Rk\365\212c\210\233\273m\320\266\003\373\251\366k\376\355\344O\263\365\316\3659\005Z*X2\217\t\251\025DlH-\265\0323\266\337\261\275\244\006\037\n\276\366a\234&|\315\206\007\250U5\303U+\271\300\006\270k&\357\241\327\270\017\240\327\034\332AfuU\0244\006\221\227V;\017\304\244H\224%\023\"Z\320d$k\177*\354E\023\210I\215%\311d\246\265c\316\225\023\374\223\302\r\217\322\302<\262g]F\210\253\365t\361\002wB1\271F\247-\302\260\027?o\363\177\210\025)Msd\223\243\235+\373g\261^*OUv\371D\037H\277\226\017\313\007Ry\260\002\3626{'\037\026\257k\371\250\200:\017\024u'\036\207,|`\347\022\n\201]\207\254\253\247t\230\244\325\346Y\033B\204\275\350i\035.d\\T\300n\323\2260\001\205R\226"
+	.string	"\242e\240;9\334\364(-\314"
+	.string	"\326\373\366b\037"
+	.ascii	"+\341\337\305\220\031\r\256\003\326,\026\226|Ma\240\256?*\213"
+	.ascii	"\321\306Xp\314*\375\253m9m?4\326_\303\323\210\212\225\2044\212"
+	.ascii	"\2630]\003ZahP\b.\003#\002T\224\341\216\334\264\007a\314B\365"
+	.ascii	"8\324\ny\004\265\007"
+	.text
+	.section	.gnu.lto_cliTraceFlush.341.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"u\b"
+	.string	"\362O:8@\217\322\001\360\341b\f[c\257\266\007k-\002\340d\005\245W6\327)\316h\243l\240\375\237\262e(2\262\213\301FQ\240\341\260\273Q\273>\bqA@\177\023)S\n\346<\037\020\027? .>|\026\034\"'\212\210\236\216C\020\r\242(\021\n\211\"\307\265\277Hm\314HZ\332\f\323\236\240\310{V\035!\254j4U\325\301\257\f)0\246\254\3317\371\211e>\210+\034\313{\207\276c\233\303\353&\265r!\321 e\215\355\032\245\252\354\237%c\265X=\354\247\017\tVFP8~z\331E\325\320\354\f\302Dl\237\343\316\216\321e\331\216\315\253\304Befw\243~t\331}\323\354\374\267.\340}\243o\001\031\327\315\200\366\222\031\370L[\007\025\342\275\365<}\245L\200\204\335uz\037\306\ro[\301v\201mX\r"
+	.ascii	"2\003\302\260\301\302vL0\330+\fSD4Ct\020p.\243\274\f\001\\\276"
+	.ascii	"\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_cliTraceWrite.342.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`)\002=\023"
+	.string	"\326$\200H\340\360&\035:{\352\224 R\242\034_SR\334~\241\016\324\305\031\314\031\r\366\225\270\316\346~\330\315\r=\303\017\375^\301\310T7{\315$\034\2150\306\030\315\2109\333\373)S\373)\366\r\250\354F\203\220M\266\224)\005n"
+	.string	"f"
+	.string	"o"
+	.string	"\027 \357\031f\323\330\251\233<2\t\311\346(j\316\311Z\016\006\020\206\341\216G\333\r*\354\037(\343*\314\217D4\034\262Z\314\277\370\321\334xX\325lbk\367\244t\334uV\213)(qr.5<\306\0054Q\033V\265\232\b\262\263y\221\252\315\350\036\367\323rI,j\370\340\344\\?\006sN\253\254\206s{\334v\006\333,[\033\004[b\005Mm7\310\266\305hKh\367\344\005\262W\252\337\376\324\215\376\017\360\373\355\226\253\216\252^U\353\215\356\007\030\220\313q\323\271\205p\316\233P\307l\362\224>\330~\312\266\332N\002\366\233\231\3541\247\317\f\335\234\223\304\007\300{#\361j\177\304\213`7\202y\310\234@-ts\332H\\"
+	.string	"\274g\333E\344=0&@\373\021\321\024\333\030\273\340\001\001\0247\310#7\223\334m\351\344d\340b\314\350\316qmW8\322\212\210\320\234\263\345\243x\n\227?t\317\022\\\\n\310\240dN\264L"
+	.ascii	"\207|\230\365\216f:\273&.\203Jp\335\335\327\364\3044\264\177"
+	.ascii	"\364\234\231\374!S\360\222^\346%yO\327@\207\034\031\r\255\340"
+	.ascii	"\337\256Vm\020\321T\324\204\210i\030\020^\036\260\240\250H\223"
+	.ascii	"\027\023\007\321'%)*',\226\024\223\025\326\311\313\205U\"bW\013"
+	.ascii	"\312\213\365\342r\275X)\333<\356!\264\237\242&\231\215}\232Z"
+	.ascii	"K\271\340\316\254\037\353(\277\337\316\020\034\334\027\316\251"
+	.ascii	"\344\340\252\3768\347\234\340\006Y\243jU\347\264saU+w\246q\265"
+	.ascii	"\036\f\247\235\236]\355wf\037\203\004Q;%\202^\026* `\2021\307"
+	.ascii	"\214\007o\214`\264\236(\322@4-\222Q\027\253h6\303\364\013\232"
+	.ascii	"d\243\362\3565\345\3156M\342Y\320()\230F\0164\221\316\022\203"
+	.ascii	"V?\027[\231\2628gq\326\330\312P\241~\242\365\361{\205\326\213"
+	.ascii	"eN\227\036\205/\033\246\211\264`\341M\240Nd\332>inU\350\024\305"
+	.ascii	"`\227(\003"
+	.text
+	.section	.gnu.lto_cliTrace.343.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`J\005\315!"
+	.string	"\366|\332H\200\234Q:\273\nXvX\312\324"
+	.string	"\306|%\263\253\022D\373\031\024i\201v5pS\177?\205x\375\227\375\271\324|?\002\0201\277\315\262w\204m\007q%\267\243\361|T\300;\250\355\256Led\200\337H#\204l\231d\304"
+	.string	"\262"
+	.string	"\324"
+	.string	"\007\272\227\007\026.\367\"\023\260\201\364'#\037\204\376L\017"
+	.ascii	"\375\311+\363\032{\271\334#\252\305\325\"\013\354\336[\263=8"
+	.ascii	"\266\\.\2277\221g\265\327\377\370\364\360\354\2503Y\032CO\323"
+	.ascii	"\366\312\237\021w\377\361A\275\300\35092\234\332\032\342h\236"
+	.ascii	")\237\340\305\205\221\035E\037\3371c>\341\220o\r\245L\007a_]"
+	.ascii	"\236\374\320\221\341\215V\207\254\212Q\237%\177\030I-:mv\024"
+	.ascii	"\243.3\025\370\300\244\2765<\232;a-\310\374\310\320\330i\354"
+	.ascii	"[C\033-\032=\177*\321\327\346w\024\247nM\004_Zpz\210=3H8\004"
+	.ascii	"\370)\357\027D^w\f\302\275\227\033H,\236\201\316\374$f\3161\233"
+	.ascii	"\307}tf\333\255\017d\241 U\030e\357>\302\276\270X[\305G\277\025"
+	.ascii	"\201\325\325\3530\336\351_\375\nSz\357\357@\022\351\257A\321"
+	.ascii	"\317\037\313\354\364\324\007\336~\312S\257#\022\354\313gw\314"
+	.ascii	"\310]\333*\346\333\345r\271d\313\203Y\350Q~\240#\377\237g\235"
+	.ascii	"\3257\317b\3152\2639E\233cf3z6\237f\263i6[\263\271\315\346\323"
+	.ascii	"\030\030\221O\230$\265\272\354\031\344\025.\347\\\345\331\205"
+	.ascii	"\310\263n\273\231\257\370IV\371X\247\262>\213\277\230\327\312"
+	.ascii	"\205*\032)\021r=9\372\311\013\322\2374\363*37RE\027\322\233\371"
+	.ascii	"O\016e}\224\025\001\300\230=\020\264\232\241\354qX\027\020\033"
+	.ascii	"<\253\222\016\306\240\025q\307V\261\317\217\231\220=\177\310"
+	.ascii	"\216\256\332\027\252E\355\327`\2111\320\314k\223\325I\037\210"
+	.ascii	"Z\0259xv\367\216\002\362\245EE\272j\205\254\345R\"d\363\303\301"
+	.ascii	"\353%\017\365i_\305\302\205\"\037\253\224\b4\237\3351\201V-\263"
+	.ascii	"\004\n}\340i\237|\037\203Tt\354\034\032I\322\314\006\364\257"
+	.ascii	",\\ \342\272\027\352@\346\f\032x\250\300\224=\273\213S`\206\223"
+	.ascii	"12\363K\006\323\032\005\251\336(o\254c&N\032\240\2319tp\243\344"
+	.ascii	"eI\323C*f\265<|H\177\025\354\324}\03141d\240Hc\270\315\215\235"
+	.ascii	"\324\331\226\305\026\020!\322\337\203\266\215\364:*\345|\371"
+	.ascii	"\032\214OX\304\364\t\234\323\225\270\241\270\321\226\210hH9\""
+	.ascii	"\332\315\246\204\323\321p\267\246\023K\267\021\266\r\004\330"
+	.ascii	"\204\323\211\245\223M<\351r'\337tJM4\225u8%]\016e\372\255\004"
+	.ascii	"S\323\315I\t\303\222\223-\306\266$\246&[\255\004\223\222S\315"
+	.ascii	"\206\313\325\222\202\370\311\304\rW\323==\341j*\362\336\274\020"
+	.ascii	"\240,\317\274\367\336\237\006\235\332\231\375\325\273\326\031"
+	.ascii	"A\\k\215\364\307\241\350'\363j\\\243\324\034?\273k\272\231\365"
+	.ascii	"\230\336\333s\300'\3632\353\224\371 ?9\005p\325\201\376\234\331"
+	.ascii	"guu\201\352%'U\255=\372@\231E\215\251=\203VSJ^\2259T\226\370"
+	.ascii	"\330\252\006\002\262\n\261\252!@\315\322\253\34794fY`y\031\365"
+	.ascii	"jdE\322\017d\250Q4\306\220sfD$\022!I\f\323\001\260\002\031!3"
+	.ascii	"y\020XG$Js\"\320\372\345\215\223\245\006\312\033y\255 \b\b\233"
+	.ascii	"\037\b\271\034l}e\022\316\306\230\347\350\362z5.b\354\214\215"
+	.ascii	"8Xuo\271\001\324,\273\006\200i\345m\317\270n\375iC@\227$\301"
+	.ascii	"\271\212\006\363\001\344\222\327\334x0jl<\\\371\205\217;\305"
+	.ascii	"W\204\366\213\216<\255\335i\333I\252\233\263\251\217\262\030"
+	.ascii	"\247>\336\206\023\204\201Q_\313\275\326\325\3378\331\271\260"
+	.ascii	"Gu(\305\324\250\222u\255\333;.\375\366\351\264n5\3710\003\026"
+	.ascii	"\240\337\245b+ \205\255*c,\326vX\250\244/\336`\351\342\224\004"
+	.ascii	"n\312'\354\361\344\2635\260\003X1\222\205\032"
+	.text
+	.section	.gnu.lto_printVersion.344.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\203\001\355\017"
+	.string	"\226\034kI\340\224(\035d$P\305dH,\245\340\013\334c\321\246\025\357\030,'m\006Wu\321\362\037\262\220\201\331\272\342@\243\274"
+	.string	"_\374W\375HR\301i\030\212\021^\013\201H^\005\240\265~z\003\241\264\026\333\001\371\204\220\275S\nP"
+	.string	"R"
+	.string	"["
+	.string	"\255\337F\240<I\317M\217\202S\3737\307i}\006\211\017\330\255\361\310\355\336\026\330@\370\317\267\237\200\377\302\023"
+	.string	"\377\3316R7\267,\300\035\025%p\374\354\356Xk\336:m\371\257q\023\331\314u\n\232\260\273\246\262\031\212\273\336v\212\355\226}]+\252kG\312\323a\326\034 h5\271\215\3378\275\3338\304\fx\331\f\370\357\025"
+	.ascii	"MN\214\0268"
+	.string	"\264\027\335\3317\030\2550\354{\273\273\2565\373\324\336\251\353\251\351\251\037\376\307\316\005\222 4O!d\367\304n\311\372|:2l?d\273R\333\001\2049%G^\025\346\002\324\256\300\362\231\250\231\371\300\252\313(\364\270\363\\\2506 4\2270&\202Dk\325a\2506\036Z\2060v~G\303}\\g\203o\363\317\034:P\320]\004<\356=H\360\205M\367S\206\261\023\351\337q\3171\t\030\262\033\273\354\024\306$\220P\037\350e\3666.\225\304\006\237\031\210\017\304\022h\226\207\023*\006\206d\231TB>G\242\b+-\024D-.,\b\316\321\201Qt\216D)\tL\030\325\312\313\2124UX*\324J&\200)EZxI\225 \227\"*\246\034U(25\226\253s\024Ol\312\230V#\3134Wc\350\366\272\267\265\346\220\b\215# \260\202\241\242\333\363\003[\220\200\342}c\210\307\313\226hi"
+	.ascii	"Fq\257\277\247]s\273\301;\273\303\243\253\f[\335t!\fd<\030\363"
+	.ascii	"\t\355\304\254\311\367\016\206\211\357e\030\303y\224=\002K;\240"
+	.ascii	"\251\341\336%\300\226\204\017^\\\236\f"
+	.text
+	.section	.gnu.lto_cliVersion.345.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\035\b"
+	.string	"\222\21788@o\323\001\270\266\347\034 \220\b\211!\362S\276\277\006"
+	.string	"9\023\237\262\261\240{\271\022\344$\"\326\376\355\022B\240\250:\020\314\037\233I\251\215\300\226; \021\021\273eJ\001\032h\373x\270\354\322\270N\202\207\313.g\234\355\223I\320\326\341d\346-H\216\306\235\202\346I\206\256\363df\356\243\310\230\2514Q\247\210(\341J7\327h78\350C\027\230J\036\250\323D\004\355\tj\324\260\217\331\335u\024\331\037\375\212\371I\006\330\242rq\216\221\335\212\324\313\246T%\035\266\237\261\255\363aes\265\377q\220\357#\210\007\354\212HH\273\323\300\004\330+\317k\254W\330\005\254W\376l\226\270\244\305\260LR\024\".\273+\343\306\277\353\347?\344"
+	.string	"a\b\274^\b\273k\rC\026w\274\355\001\333\007\266Q\002\f"
+	.string	"\357b\310\f\315\252q\306\005b\327\320V\030\017T\003W\300\334"
+	.ascii	"\025%\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.346.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\013\b\325'"
+	.string	"jDT\017DpjQ\007\351O\376\372\027\221\\\247H+\313\240\201X\002b\260W\031#\353&!5`I\007QB\n{\026\r\265\344\251;o\317xj\200\025\003B]D2\006\334\\\357hO\224VZ#r\357\275eJ)\334"
+	.string	"\320"
+	.string	"\345"
+	.string	"\376\005\326>\246k\355a\\\314\352a3t\302%Y\227\204\025\343\322\200\335\324\275;\262k\335\375U\343\263\217%\031@\026+v\004P\316^\016\334l\n\370\275n\374y\340\337\355^\274k\365/8\274(g-8ir\366\202\320\t\260\233\355\345F\247\233\330\003\234n\366\332\355\347\34649\353\024\273\332\021\306P\316Y\351>\361\325\213t9\334\315V\243\3150z\232\345\375\265\035\2750#\032\205^\244\313Aq\234\222$\177\263ey\r\311\221\247\035\230\241\027\232\0041\342\270\310\001+@\210<\212\345'\315\210\345&\316\310\326\214:\276,\033"
+	.ascii	"RC\310\307\370\3770\356(\215\256\246\020k\306\341_:@\270\312"
+	.ascii	"4\347\354H\377\036F\253\177\364B\316\271\237h\f\342\r\300\273"
+	.ascii	"}\327\355F\335\347\231,\220m\233-\335\246K\013WYu\376\r\026\370"
+	.ascii	"n\017 \336\211\177\221\212-\2306LG#0\013\3454\240\330v%\207\237"
+	.ascii	"s\026\336\273\325&N\277-\220{\206\177\250\273Kx\032\0238\347"
+	.ascii	"a\205\3663\216\006E{\0247;\305\212w\342\212K\253\323\236!\373"
+	.ascii	"\222\343\313Z\367\016\346ex9\256\234Y'\3660;b\201\233\335\276"
+	.ascii	"\027\357\3046\213\355\226\344\360\n\273\366\3350~\357\304\243"
+	.ascii	"\253\242\330fIZ]a\267\227\325\337\255n/\363\325\352\3660\357"
+	.ascii	"\235\177y\037\231\337:\364;\207\277q\346\367\r\375\266\341\357"
+	.ascii	"\232\371MC\277g\370\033\243\337(\376>\321o\023\177\227\350\367"
+	.ascii	"=\277\337\374\366$\002n\006}\031q(a9_\225!\312Is\r\025\017\363"
+	.ascii	"\265\273\325\307oYNv\223c+\264*a\202Y\027\253]\333u3N\\\320\212"
+	.ascii	"\245v\r\324i\345\320\0021!\271\031\262\031\230\377Y\267\220\236"
+	.ascii	"`\326\221N\203\222C\307w\253}=\236\264\033\204\342|\326#\355"
+	.ascii	"\346\254\3321\262\004?\273\016\346zV)FT0\353M\252\350\270\302"
+	.ascii	"\306wv\335\314z\305\361\254X\360u\244\343:N\33214\301\233\027"
+	.ascii	"\275N\306\355\254]\006\362`\255[\326.\357\304N\331+\354\363\242"
+	.ascii	">\307w\367\274\316r)\257y\035\315\343\013\316\335-\257kai\377"
+	.ascii	"\260k\254\276\354L\256]\006V0\230u\037I\305\366M\203$cB\314\031"
+	.ascii	"\347\356\2120\"vD\352\031\376!2>\206\341(\003f\251\220\212-\233"
+	.ascii	"{w\367\336\331\221\2507x\234\026\3039\347\n\355pDp\300Qj\234"
+	.ascii	"n\336\353c<\275\264\304T\372\244T\025\030\204R\227\226\bt\022"
+	.string	"P\215\301c\200v\222\024/\306\024\357\307`\326\251\r\250'\005\251\005\027.\200j\214^\252NE\001\251T_U\352\223\021\245\3660\244\b\322\256\372=M\220\240 \302\223\002Z\177\300\020\202C\007\247\224)\004M\345\005S\027\351\211\246\364\311\247\366|\252OC\212\240@7m \361\241\303\022\332\251\005\037U\r\022i\232\241)E \240\252\204\357\307\013.\321hz!\203g\343\251<\r/\246\242\240T \360\347\324\013\346|SQR\276\037/\304\323\257\207v/B\224TOi*\212\367S\352\005\253\224\"\0305\220\312\027TR\201\300\240R\315+\207\227~\265\212\307.\311\034\327\252,\372\253u\310\021\026f\337x\314\242{\037Ur\317#\013\247+\362\254\016O\356:\330\017\001\341n\356\310\013q\267\347\244\305s+;\016\261!:\032\003\200\224\250aL$\221c#\"\n\222\244 \205\306\300\002\031\241\";\021"
+	.string	")D\216!\022\241\245\205:\215\001\030\213\246\003\002v\212\375u@\033\370\370\177\200\377(\347wI\344\207\016\315j\251`L$\027w%\261E\n\250gd\245\300\035\026w\036\3746M/\300\326A\211\251\215\034\335I\207~\bkx\200\332\360]!Bp\276\023|\312'\230#\026\005\0247\237-\251\212\2021\004\240\f#)r\323R\027\324\310\315\362\233Z`y\b\331\023\346\344\353-\273\230\357\n8\314\003\243\214\225'\016\263\224%\244\nz0\370\273xw'V,@N\020^\035}\302\f\246\211\250\224\300\270\215\031\271\026\272\236\2770\2410\307\334^$\202\005:%\314\177\034\267\002c\026\222\324\273\273\344\263\300\242\037\340Q\337E"
+	.ascii	",\225\231i\032\367Z(\230[\256\361M\314\342\033\356\323\256Xb"
+	.ascii	"n\356ug\004\344U\323\241m\204\250\202?\337\t\3601\323\361\211"
+	.ascii	"P\374\230\316\200\3133#=\236\345\030'\206\267\355o\226B\215\b"
+	.ascii	"U\003"
+	.text
+	.section	.gnu.lto_printConfig.347.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`b m\221"
+	.string	"\372\346\3244N \216Z\352\245~\001L\035\235\227\242\207\206.\340\370\365~\032\235\230\347-\315_\226\277\340\0307\225~\234\371\304&;\242\247>\032\037\347'\\&\027"
+	.string	"\002\016@I\37593\017\241\344\n\025\241.\360gl\263&\253\350\245\354\rBv\222)\005\033\003/\003C\003*|\317;\205c\275Q\270\235w"
+	.ascii	"\336\344\211\367\211&&\217\342\275\324\3466q\314\255d\314\235"
+	.ascii	"\324\346.q\314M\302\230\033\251\315}t\314=\242\315mt\314]\324"
+	.ascii	"\223[\3041w\21067\210\236\334\310cn\2426\367\2201\267PO\356\017"
+	.ascii	"\306\334Amn\240\317"
+	.string	"\375\303!\267\217\347\366\320\346\356\320\346\3569\346\346\340\271\217mnc\233{\30317O\233{\347skhs\353\034s\347\034s\343\030s\337\030s\333\030s\273\306\3345\306\334Ecn\2421\367\347\3349\347v\207\026\220\006[]\"7\246\345\371\340b\034\2073\304Xb\025\"\276\347\216u\267s\277s\307so\342\376\304=\212\273\335\016f\017\206{\365\345\312\235I\213\230\271N\364\202\205\321\306s1V\330\001\324?@\367\332@JRp\311S!\0223\251\262L\336\f\277\366O!\223\267$\254v\340\327\3760(h&\225\362k;\220t\020\255\273\212[\361+\215\203\247\007\337Q\361\304\330x'\0059\26245\\\273\227G\021\325/\017\306\024\267v\343\264\007.\245o\244d\226x\320\215\343\304n\272\224v\243\364\017\214Y5\216c\234\034w\342rN\3278>\347P\236\036\305\212\007k\205x\203\trc["
+	.string	"/p\235\210l\375X|\"\202\212\254\021b,\035J\324\272>\b\232\204\320\306b\361U`\021\025\313\\\325L\034\303%9\261\r\350ns7"
+	.ascii	")\236\356B\b\0167$6W\315C\221\341D \243\344\271\333\253\336\366"
+	.ascii	"t\267\3277\3041Z\035\2258\2063\321E\256\023\033\316{"
+	.string	"\212Nt\375Xt\342\263\033\206\217\251\304e5cY\242N\314\304q\314\364=\212\305\242Q\277\267p\336\310\177z\023\323\222\t\245\244\022$\220\216F\030\025\211\b\001\002ItbH\350C\020\320\217\217\207\016=\034\216\306\r<;\032trpnl\334\232\"\261\375\374loyX\t\263\370\242\200]y\023\223^^2\321\307%+%m\321\222K\220@\352\363\243<k\036\321\332\344\260c\342_\276\246\264\002\224\031\362\346`\244d#\026r\324yQ\215\n0n,\242\032b\253\206;r\324\271\b:\017A\027%\203hy\240\264M^\3362\222\205\034sN4\347'\276|a9\362\345\227\207\272\270\220[[\376P\365 6\007bk\221?\324+-d\237\352\222\354\201\210w 2$\367\bq\016B\202\344\243\0177:\026\020\337\320\006\260eF\352_\276|\2649g\242`\374\310\327\217\314\003\344\310WZ\336iK"
+	.string	"\332\021\372\227\257,m\017\216!\\gY\203\216YY\316\251Q\261#\207\231\343\370\227/)Y\276Q\301m\276|\251\320\"\3438\036\313.\210\0359\304\274\246=\216I\021\243\001,\332*\211Q+B\211[\255\326\2678a0\210\321"
+	.string	"\226\325\242 \003\246\202\3239\210#_b9\327\250\210\343\2703\027X\016o"
+	.ascii	"\274\373\215tg\031\272\201~\004\327\334SEJ\027\220*\033|g\007"
+	.ascii	"_]J\246\302W\242\265\274\004\276\303\203\257W,\260\226\265,\226"
+	.ascii	"\002$.\234/G9\272\371&=\330\0132\372WF`\270q\034\027\201\375"
+	.ascii	"\366\34027\237\343\347\206\225\017\273\033\016\223\207\300|n"
+	.ascii	"\034k\t\3209H\026\002\373\215\201\313\224):\321\346\213W\244"
+	.ascii	"\177U\26367,\017/~\300\203E}q\214\345\\\235\323\262\017"
+	.string	"8\260=H\026\036\314\316\005\017\026\235\330T\b\033\256%\301n!\351\340z\354\276c\251\\\254v=h\360\241\021,\303sk\215L\001\035\360!Q\337\225\013\315sGN\214 \353\271\325\227\245\0261\004\f1\306#\313\341\247M\024%\003\022\265np\017\241\230#G6\026\265\356\370\240\003\360]\256#\025k\236\031\227G\250\371\034\204\272\345\032\215\2461 7u=K\320\240d\006\254V?q<\223\310\200\315:\212=\301\210\302\\h^\013<\341y\202Q\n.4{\221\360R\242\207\203\006\367\303\370\323\r?\355\234\303\213\357;\342\374|\212\257a\257\356\232\005\366\034\023\"s\241\371\252\f\017\253\345\365<#J\323\341B\275O\310K\311\035V\353\257\006\300\376\251\361D\375\377\231\210\341\363\222\335\363[\312I\036\301w?\247\317\036?^J\330\222\270\\\b\245\351\035=\201<\205\314e\325\340\f\001\265\376\312\323\316"
+	.ascii	"R\331q\263F\224\350@\360\335\3460}O\224\354F\324\212\343\364"
+	.ascii	"M\337\205T$\3328R\261\351\211\357t^A\\]]\034\237\034\021\252"
+	.ascii	"\026\260G\271\335\372T{&\311\316\325n\365\233'2\254`\b\230\365"
+	.ascii	"W\235\263\274\351\3773\022j^aT,+\037j\3101\004yz\bT\241#\350"
+	.ascii	"\374\264\363\303\031\353\271\346R]\250c\311\217\344\245\344\204"
+	.ascii	"\034\244#\025\231\336\351\013\310\243{\026\274\334\260\342\374"
+	.ascii	"\264\235\316\215T\262g]l\036\370n\335\245g\372.\377\030i\236"
+	.ascii	"o\256\365\310\211'\374\177\274\224\200\335\3608Rq\351\037xO\243"
+	.ascii	"Z\377\242&d\345C\267\371i\347\271\354\231Y\315\002\337,\023S"
+	.ascii	"t\361\315\262'D\006\276Y\306B\333\342?/[\346\365,`\310+\376\304"
+	.ascii	"w\345\271,\331\224\032'\364f\031a\321\275B\364+%m\353V\305f\031"
+	.ascii	"\n\237\335\252\230\251d\311\322dw\253\342\322w\205Pt\340\233"
+	.ascii	"\244|Y\367\247\306\034z5\217\346B\360\311\206\242\357\331\346"
+	.ascii	"B=\212\013.\007\270U\213\f<\034\370|S\300\205:\034\003X\262\026"
+	.ascii	"\255!\304\0260\254h\341B\235\332\002oG\016+\253\375i\237\263"
+	.ascii	"xx\214\013\024}\r\270P/\302\342\r\360R\263\3036\0263\302\"\377"
+	.ascii	"\323\026\241\270\342c\304\275\240\225\3174Pv)\316\347d\"-\216"
+	.ascii	"\241\316%\201\013\365\264#'.\360\335\024X\220\235k\305gl\226"
+	.ascii	"\fk\b\270\365W\335pY\371\247\335\376\207\207\207\207\375h\335"
+	.ascii	"~\365t<\357\244\337yo\340n\356\0218A\360\200\273\340\356\200"
+	.ascii	"1\367\013\027\f\264`\261\302\341\334\0270\346\016d\210\234\200"
+	.ascii	"\272\330z\342\321\204r\2317\275\320{\037\365\357\017\212\023"
+	.ascii	"\002I^8\364\323\267\354R"
+	.string	"\376\211S\002>\336x\305\b\262\336\255,6j\245m\211\017!W\004\023>\267\253\354\336\207\237v\213\315\336\245\001j\177\2135*\374\020?H\005\311\230U\003\370.8'!\036i!\222\226\f\227w{o\374 \227\266\267\313\201!\263\276\352\213\243\2047\254\2057\354\250o\311S_\034`oX\330\to\n\\\324\262_?\211\213\240!)!\031\263j\273\267\345\325^\262\327\333r\344-{\301s\206U;3\362\3528{\247D\336\351\b!?\344\325\301\343\235N{\274>\326\260?~<\337\202\200\244\204`\314\252\255\023-\237\366\ny'Zz\274D\f\030\222\346\031\251c\341U{\215\274k\217\366\256-\245\375\216\347\361\252\275I\336\265w\355\245\276lljX\035gO\266\017F)au\205,_\366\276\375`\026\351\313\304\201\24138#^d\257\223\270\027\312\330\013%\205\027{\235\310\275P\240\320\275uX"
+	.ascii	"\305Lx"
+	.ascii	"\262\325\370H\007\005\315\252\355\025\226"
+	.string	"\317\361^\235\310\356\t\016.U\260\367\356\265{\257\217\343\275\026}\t\357\365\336\275x\357\365\275\276X^-W*\016\226\003x\317{\256W\357\233\344u+\375\215\327\313{\360\022f\204w\257\037\372\026\216\350{\255\337z\367\3360o\341[\370\362\275~xA\327\277z\307\020\245\275e\\\350\353\225\265a\265:\247y\216y\210\233Rg\346\253\264\300f\304\205\205\004\350\r,~\370\354\026\367B\367\373\227\317\274\201f\262\341\233}\007\337\302\327\260\350\304\017\237\200\017#!Y\342\237\240\367\0352x\323\007\275\003R\375\370\242b\216E\270\342\307(\025\004\363tzY\360E\223\303\244\351e\337\303L\244c\206:\275\030\340\254+8\n\bG\215\322`\310\177p\326\026\034\215\336\200\273\356\276\f\001C\310\311\367.y\f\214#\013z\227n\245\374\002\f\366G/\326\022\202\020\340D?8\254\257\231\017\3561\"L\026\003\207\235"
+	.string	"\367\350\221\002<\326B\031v\231\375\232\277\300dn%\r.s\241\257u\344D\240\237\007\202u\210\360\371\237\3672\321*Yg\271\013\254cK\346\002\363\230\302=|\024\235\350\363DYS\236x"
+	.string	"RA\316\273zx\267\372\365|\207\027\342\302\341{\360`9+t\034\236\2315\305\t\325m\231\217\337\271\312\363\355\2707\245\311\222|\346\310\211:O\0046b\300\n\321\277\312 [a5\002:\327\345)p\222v\r\246\026\251E'\036\253,\371\2067\276P\030\250\031\317ox\217\246\301\242\213\302\3635_RA4\2636\267\030\271\363\334\nb\007\351\237\240Y5g\217\234\270\363m\360[v\256\344?W\200\376Uk\370\235w\r\357Q+\033\274\316WQ\365\016\243ir\036\3477\370\214&Z%\313\t\314\244\t\f%\016\256\313y\307\363\341$\273"
+	.ascii	"\313\301e&0\024:\270\256\256\350D\234\367+N\354\"\3753c\326\346"
+	.ascii	"C\200\364\357\017\0037'\237\016y\314\221\023\275.W\341\r5\245"
+	.ascii	"\274\201\232Rvhb\037\217\372I\031\245l\"\221Q\311\251\345\214"
+	.ascii	"%\223\n\251dRU5\225L\021\035\265L\312\260\301\254\261\301tm0"
+	.ascii	"\2253\246\222L\016\240\2226USJ\251\252\246\025\007PI\242\266"
+	.ascii	"a\225l\225PTR\033<1\231\236~\272FR\252m\032K6\230L3j\034\233"
+	.ascii	":\215\314\351b\323Xj\0065\215%\246*\0323\226Q2\200\372F\007i"
+	.ascii	"c)%u\243\263\323M#\244M\027\273\246i,E%\227Le\223\211j\351\241"
+	.ascii	"\225L\253\252\244R\206\333\336\312\017\222M\252)$O7gL-\253\252"
+	.ascii	"\224M$\222\252\n\231dZ\315X\312\230\242zBV)\233J&R#s\032\t5\225"
+	.ascii	"\224\222\242zB*iT!\253\230\311\252\246OOQ-\233L\345\007n\fb7"
+	.ascii	"\241l:**\331\266\222\231\004\001\212\231\244a\323\315b\327p\233"
+	.ascii	"\251\254j&\245j\252\222L\033\033J\250\251\006\224QK\031T\314"
+	.ascii	"\t\240\2265v\230J\033K\251\235\252(\253\244\f%\213fT\322\312"
+	.ascii	"\003\245\016\263\312\202\031SK\250\244\362\205\215\245\023\325"
+	.ascii	"\007Le\323\330A3\351TC\312\n\312mNQ-\253jP\325@)\243b$\247Z("
+	.ascii	"\241\250\234h<U%c\360\310\220\261dA\005UTN-\243\224R\311\b\240"
+	.ascii	"\244\236j\372ii\031\365\3044\265LJ1=1\233LK=MUC\311d\252\242"
+	.ascii	"\242b2\341\300ay\033?\232\327\033\026,\326g\265o\311I\336\355"
+	.ascii	"\204\342\244#z\275]\3338\216\343&\022\234u\036\254.\224\030X"
+	.ascii	"\326\326\336p\332\t\2459\357\\(1\313\333\t\272\3001L?\355&i\232"
+	.ascii	",\nhYvK&\302(\275\211\275v\253\325R\372\2408+\031:2=\244&\222"
+	.ascii	"\332\244C\0173\306+L\251\004\032\022_\342=\333\306\207$>\210"
+	.ascii	"\207\225\217\352\326\201*\\I\223\220\036Fz\007C\235\341/*\226"
+	.ascii	"\257[8\212\2248\n3\342\217>\327\311pf\304\023\305Y\303P\335\260"
+	.ascii	"\214\212\336\350s]!a\321\023\361\260\202\241\272\005\001\256"
+	.ascii	"e!!\350\n\022\206Y\221\270x\fn&Ec\306\254*\230\004\370\\#J#Z"
+	.ascii	"q\342=\205\004b\265\3128\257X\\(\021N\357\005\370pI\213\026>"
+	.ascii	"'\027=\027J\024\273\036\241\001\"\002\214\027g`\213&\304\213"
+	.ascii	"\330\373/^B\304Y\255P\335F\374\264O\274P\364\374\2323\"\276\316"
+	.ascii	"S|\027\214b\212\377/OB\227\337\023\243\237\322y\212\177~\316"
+	.ascii	"\022\252!\037\2100*\036\304;\030\303\277\024"
+	.string	"\257\"\337\271\365\231)\372\251;\313\024\267\034\343\254uK\004E|\026\370P\311\311\367\334:\303n\375\325\351w\344\034\343B[A\023^nd\306+e\342\020\030HgP\213\363C~\377\335[q\226i\017\322\316?g`\340 W\fD\217tf\337\356\255O\3059\330\316B\247\241\223H\003\036V'T\020?\355\001\270\210\374\352k\316\234\350\256\234#q\376\005\t\026\033\022F\021\305\373\325\353`\251\177\205P3\027r\323\017\275\023\215\363\360\305\017\275{q\033$\324\277C\024\377\342;s\305\200\225\017\337\007\337U\202\261\250\342\340(\324\322\234RhfDDF\222$\035B\013\020\210BY\244w\347\001\022`4E\220K\347h\222\244\003\020l^Z\007\246i\177\201\r\273\225\231o\276\237\340xMS\354\322\300D\002\267\fp\004]\022\211\303\230\274\332\317Uq\377V@\222(\366\355\331\207\224\373\344e\004\202*"
+	.string	"\341\240K\370\236^OG\220^\325Jj\366\013\245zD\366\211\366 T\031\013_ny\367.\"3\246L+T"
+	.string	"\326&p\375\344\004\0017\333\352\214\275QPW\317\204\360\351k\227e[\305(F]\350n\270\234vn\334\023e\220N@\270\232&\2228\003\\C\272gc\377\214\210\272x\031\276a\244+\344O\264-\303\303\n\005\001\204O?NHW\361Q\243H+\251k\346\333\2475\275\333q~O\220\323\034U\302\3107\217\003.\270Iqy\"\245\210\222\273*\262t_J:\242\267\306\023\202\336\334%<\005\312\037]U\033\350\325\300\302B\243\025\025\2169q\306\034`G\305\317\375^\304\246\352\035\034r\021hm\001\365K\213\201\002\347\370`\205[\025\217\343kf\004\245\002\220\326\033'\317\214\b\341u\027d!\341\252b\256\323\206\372\033<"
+	.string	"\366\355HH(\350\023S\300\r\020\345Z\200\254R\243F\373*\357\366k\351\251c\240j\211\254U\317\333.\356\254a\347\222[\nW\013\320\251\321\374\336O\225H\213\250\211\365\35085\226!A8\343\250\220\033\031\017\262\370\351\370m\372\235\020\374$\1771\035\"\300Gw\216\274\027S;\007n\0336xU\250e\352\3274$\006\nr\237\177h(\032\271\035N!Z\374\311\031\234(\331\377Td7\023wf^\361W\0335\3735cpV\346K\252n\324\254\351\026\372\bf\356\f\031\375x,\3621t/\205\230wN\320g?\205\336\346\363\354\241\260Nir+\244{A\031\336\333\236|\023L\232%\347U\025IL\261\027\0022z\201\220\2019\342{"
+	.ascii	"z\320\357\372\375\225\320\0241\254\223dB\362?\263w\t<Bm\340F"
+	.ascii	"\322I\242\272\362\314b\355\026\3022\310\033\030K\324\376.O\204"
+	.ascii	"\273[0\270b\347\324\275\026l2\234\n\231{\313\3041\214e\"\002"
+	.ascii	"\001l"
+	.string	"V;\335p\222\251`"
+	.ascii	"d\177\na\310j\337"
+	.string	"\020+\023\376\235\336\006\356\334\032\360T\r\t\\T\177%\270\001\f\323\316\2214\244\263\202k\016r\237\370+\322\227\235\254\212\226\200Y\310g\b\307\374;\327}\262\023\240\344Zt\274\3539!l;\211ST\270\370\237\311g\205\305\nW\337\301\030q\362{y\021C\335`4\210\030\3347\037=\227\023\303~F\347%\330\007\264\270\023\2711\023y#\330m\2145\214y\242Bi\023\201\302+T\300\206\271ws\276\301\2204\272\024\222V$\352\004\350\357\233~\202 \025\264\227\037\361vr\316=\251\241GpBmw\213\036\214r\247_\255\246\207\233sm\306k\362\200\242`cX\2428\332\361R/\361\263\200\203\300a\276\312\215\224+\236\267\253\002!\322\232p\037BCb\360\316\033\365\364\tY\204P\3468\256^eVf\250\237lo\302>\211\355A\237l\204\032,\203\365>\341\333]\245r\344@(i\224\226\007\371"
+	.ascii	"V\234\244\267\261\020\307A*\220\206\271\3133J=,&7\305/l$\354"
+	.ascii	"~!\200i\n\234h\340\376k\024\205R\234\225\374\303o\001:z\300B"
+	.ascii	")\025\r!\303\316\335^W9O\254%\303\326\231\025\226Z\272\001>\b"
+	.ascii	"\274Q\255\360X\311,\350[W~\256~\3633\"\202\244/\240\0325\350"
+	.ascii	"s\244(\342\f\367\315.\237\357\217\263\353\355G\267\315\225\303"
+	.ascii	"\t?\245U\036L|7\217=\020\371b\355\\<\0201,\265\267O\304\231\304"
+	.ascii	"3P\243\300\275TF\203\263\320\231\243\007\346\230[ \2422\335\255"
+	.ascii	"\025%\325L\001\026v\001\026\343\322I\241\201k\3654\302\210\006"
+	.ascii	" N)\023\013\324\213\274s6\261\306\220\007\275\004\267\353Yr\342"
+	.ascii	"\rW<\215G6\331T\244\372!\035\026\257|=D\256\305Dv\215\002\277"
+	.ascii	"\207\323\225\317Yh\375,\332W\202[\307;\"6HX\271\2041\016\321"
+	.ascii	"|\322\224Oy\244\001\363\264.=\267\220\3534$\2015\236cq{\004z"
+	.ascii	"6~\315\244+[\300\327<\201b\317%\214\0010\373`\203\333\356\222"
+	.ascii	"\021F\003\004\351\270\305nE\375T\355i7\007B\352\316\252\225\325"
+	.ascii	"`n\251\352\343rz!\362\260vi$\340\241~h\b \330\273_S\003j\306"
+	.ascii	"\361\036\\\007\333\\a\200C\250d\354\217\354\275\323\021\211\274"
+	.ascii	"(S\2209C@cc\250\025\217\224f\345M\376$\260\247\305\377\357\330"
+	.ascii	"\fc<\223\355\231\221\272\375!"
+	.text
+	.section	.gnu.lto_cliDump.348.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\215\b"
+	.string	"&\320;9P\305&\035\r\t\306n\353\224a\023?;\237\262\230\260\016(\030\024\b\344\032\r\210\221\340\022F\214yb\362\\\004\275\263\210x\026\337\255\201\324\b\333\271t\016\"\275\233\334)\005*"
+	.string	","
+	.string	")"
+	.string	"\321\235]\322%-G\325Q\272(\001\260\273RA\336\035v\376I\036"
+	.string	"\ny\207\325\302\356\032\202B\032\267\3366\201m\005\333(\001\251o\027\343\013\260)\361$\304\3663\266\341\224`A8\264/\362\221\356\243\211\013\354\212LH\2733\301\005\326\243\3475\230G\353\003\230\007\216\360\340\252Pm\210\bx\220\rN\337\242L\026\352\331\323\203\372a\377\262\273k\025\331\237\277~\364\303\370\225\224G\213\312\306\003\330'\363t\264\253\3024\016CG\273*_\233\314s\311O\306\321\344\3059\310\215\306[\003\306\311\207m\343df\356/\253\"[\247/\003e\242\320\212\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliDiff.349.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"m\b"
+	.string	"&\320:6P\215\322\0010\354\225\013s\276\026\025[\222\247]\0014&\344\257\260\265\3318#\022\b\3372<%\235g'\3513m\006\261\340Z]\351\031\364n5\203\304v\223;\245*"
+	.string	"+"
+	.string	")"
+	.string	"\321\235]\242KZ\214*\003\205\342\343dw\245n\274;\354\374\217\016\360\001y\207\025\302\356\032~@\026\267\336\366\200\355\003\333\"\001\237i\267\342K\331R\f\341\260\375\213m8\037H2\207\366;\356\321]\004\361\200\335\020\biw\032\230\300z\364<\306\362h]\300\362\2160sU\250v\203\003\374\307\005\250\217\224:M\250gO\017\252\206\375\312\356\2565d\177\376z\321\017\343M\337\310d\344\342\001\230'\353p\264\253\302\264M\002G\273*_\232\254sIO\266\321\344\305-H\r\306\233\002\306I\206m\343\344e\356+\253![\250\257\224:E\250D\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cmdTable.350.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\200\027\345c"
+	.string	"\372\233(#P@\222\353\034\220~\344\324#\226"
+	.string	"N\225~\327%\255@as\327T\302\232\234\266I\306\231\025/W\376\244\201\202ni>\"%-'\211\220$i\302\262~\346\314\277\317\320]\310]\333\206\332\255\027\242\273\317\231\031V\246a\236\341\332N\"BRJ);\002C\002\006\002X\344\265\362\030\314\227T\216\322TU:G\2573%^T&\230\206:jQ\0240\316\t\253\216\261\220X\213\307;l\231\025\301Yf;\256\334QSD\001\345\b\020\245c)$\246\342q\225_\013-+4%\315\243\365\350UF\207\226\203\312\004\007em\366\250+\250\200r\276PT\331\340\361\rOdb\234\244|\374\350U\226$\375c\347+\205\222%\0363\241AVd\2064P:H\257\261Ai\241\337"
+	.string	"x\n\037\361X\006\214$\346E3\242\322P\232\252\212\322k,\215\215<_\004\b\031\3421\021\034C\254\f\r\006\027JSU1-7\274~*p\013\330\005\217\201\340\037\261\237\017\025\207\016\275\306\216\360\350\363[\201ot\214\203\304:<\346\201w\304x\340\034j\017\037z\205\231\301+\250?\202\350\025\026%D\275T\250\200~6\206\3025<V\001GeA\230\206J\2454UEg\210z\257\200\204\n\360\323\357\037\362\006\362w\220 \225\210\224^3\034@\252\021$z\315Z_*\025\016*\321k\276Z\242\246\350\002\0262"
+	.string	"O\277B\220w\b\177\275\366\250L\232\3505\377\364\250N\236\3505\003\311\323\002\007\363\r\025\212\252\213\342\342r"
+	.ascii	"\234~\345\220w\216\277u\350\250Q\244\350\025"
+	.string	"{\321\202*\225*z\305Y\2648.p\020[\251V\324\262\213\313\313\017\2015\375\376@^ \374}\343F\275\242f\321+\236\322\246\205\306L\330\\\200\203\030\350\365V\311@\275Q\250\270\260\022\320J\343\357\226\032\r6\320\353\205\202\246E\007z\275I<P\357\025\327\030\005\304\364;\206\274=\370\353C\231+E\306E\bz\275;\262D A\257>\023\324\025]\\d~\264\253~\273\220\027\313_0_n8\275\226^\2304\024\324\032\352U\004\032\027\021\007\271^)\320\251\271+.\255/(\250\032\013\\\023\262\033\273V\372\265\"/\026\177\265\230(l\250\025jX\220\345\324>\275\262\270\022Ci\252\n\nj\225\241W\004h7fo\n\262\033\2633TY\346Z\023\365F\020\024T\215\233\343\306\2546am\022Syz\326C\346=>\363\361\272i$,\332\020)\016\035zER\"D\013\034D\202\201\207zb"
+	.ascii	")1G\246\254r\220\216\317v\352 \365\240\315I{\244>\364z4\347G"
+	.ascii	"\326\027,\267\351\331\r\231\273|\206\023D\032$\025\242\327#8"
+	.ascii	"oT\034\372(\013\210\033\016\036y\031\242\242\350\332:\363\213"
+	.ascii	"\241\351Y\r\231\201>\257\341:\322!o\035\375\240\245\211\201\203"
+	.ascii	"G6\210\250/\250\266\264dY=\223!s\031\237\315\370\220\"\321\201"
+	.ascii	"zH\245\214\350\325\210\315\230\024\t\225^\215\314(Q\233\256\266"
+	.ascii	"\330\314\270\364\354\205"
+	.string	"\314_|\346\001L\026V\272\204\211^\215\222ti\242\2528!\225\345\225\255z\306Bf->\357\260E\275\242\215\246\262\030\345\310WR'\351\023\275\026iAQ\315\256\255<_C\231J\277V\271\312O\275\2424UUD&J\037\242lC\3177\220\031\007\237s\210R\344\005J\021\016\371\311\021)\252H\265\325\247h\t\023\237\233\344\032\212~d\032\212hP\021dtD\006\237\223P\245r4\021\037\032\2224\213\322T\025Q\233*\352\275\332\032t\224\205\364<\204\314D|\226\312E\210\2001\244\\\232\310\013\r\006\rp\220\310\212\212\202\n\310\345\013)\267\220]\360\031\310\017\"\033\262\017\242\037W\272\210\3107z\306Af\035>\363\310;\210x\344\034i\226-z\035\362C[\301\005\016\306\271\022\223D\250g(2\327\360Y\205\034uj6\231\306\320\226BC\277.\352\212+`\326o\004\237\216\375\220\370\217\307\201"
+	.string	"\r-\371J\261\300\350U\007\352\243\203i\030\365G\001\317\374H`;\035\343!\261\020\036\017\201\365\350\256<i\226&\243W\215u\347\304A\215\245\214\326\257\004\0349\036\317\t\352)qR3Zz\325D\322h)\255\351\370\007\022\003\341\361\0337\032H\033\027ZG\261I\335\340\240W\272\245\252\270\002\2421\241\225\306\343-53<hR.\245\251*6z\235\001\3236i"
+	.ascii	"\020\323\361\030\022\367\340\261\017eff\310\244nt\227^g\\hYj"
+	.ascii	"\024\034\234A\201\243\316HHi\331\231\262\n\240K\307\001\275\354"
+	.ascii	"\275\375\321\261\366\304K"
+	.string	"\263\344\243\351k\267\215\263=0\372\302\246\332m\333\036\030{\315\003+\263\247\t\343\177\237\256\347JS\034aQ~\302P\256+\303\235(\302\342l\334\307\013a\324*\260q\037\226\265\333\b\"\273yO\006\272\307\037\232M\233\357\320\215\362s/m\224\353\016\2608\376}hX\352\372y3b\"aue/}\350\036y\317u^\317\367s\237\337\334'\357\nX\316k\n\317>\356\247-\203\327\353\205I\326\251\3733f\267\221-\237>\377\334i\fM\336\020\321\321\020\321\221\315\311l\252m\233SXv_\333\266\221\363\336\211\206_\374>\323\204\361\371Y\3336\316\363\375\2329\263\247\317\310\236\344\031\206\350\271\3113D\223,\016\207\362\223\377\247\\\316|*\315\333F\317\276\273\001`\271\030~TfO\264\3440\370\376\234\347\033\371N<\367\370M\221\377\023\026\327\363\276\361\251g\242\347\023\216\243!\357\266\321\037\242\347M"
+	.ascii	"mK\263\237\237\303\3301\314\335ydE\007:O\\*{\350\227\304\177"
+	.ascii	".9`\302\232=\376\227P\323\374KE\366n\271;\\\036n\230k\346\236"
+	.ascii	"\271\300\313u\273n\020\327\316\275s\371\334>\227\320-\204m\340"
+	.ascii	"\025\263\200{\340 \370\005\\\004Ka*\234\004\327\200\233`("
+	.string	"\030\007\254\003\266\202\2570\027\314\003\016\203\315\3403\030\210\271p\027\016\002\323\301u\360\036\354\205\005\341A\331F^3\013\271G\016\222_\310S\331HV\222g\310U\331I\226\222\247d\035\262\225|%A\016\223\305\3443Y+\263\311?\3448YN\276\223\361\344>\331O.\024\001\354\006\0043\n\305\276\300\240:\254\006\tS\301\303V\230\215\244\035Q*\r-\"\017\214FJ\003\007\243\364*\242\005\033\352mr\245\206\320\327W\317\200\310,\310gB\203D\350\b\344B#\001\242\375I\261p\020i\314\r\365\305\225\232B?\034\226\353\312\360\277\030\303!\264\344\036=}/\306\020g\343\274P\374\034-\271X\273\241\"\347q\261\364\345N_\351;\301:\371B\230=\371h\212]g\362J^\3336_X\3336\006\254\314\236;\021\r\233v\270\277Y\200\035K\276\237\214\254\323g\322\226\005\007%\200\020\302\006\037\204\260K"
+	.string	"a\17737\226\275is4\354h/{\002\226\327\224\355\347\333D\313\276\003\2608o\376\233\3142\025Y\036\037M\005nGv\210"
+	.ascii	";\303,S\030\262\271\\\037c\366\344\272\005l\314\356\022v\006"
+	.ascii	"\377a\323\323\211\362|a\216\217)l\034\217\027>\361\037\306\030"
+	.ascii	"\177\270{:\237\236>G\317\320\337\"\260hw\3421\253\355\311s\266"
+	.ascii	"\006FX#\313\317\360\363\021E\273\327w\342\336\235!/g\302\242"
+	.ascii	"\\\007\263\273\377\020F\t\213\273\315\354\331\323"
+	.ascii	"\2118{\272\215\"f{<\276\363\336\024\367\331G\023\026\247+\373"
+	.ascii	"G\317\275\023\177\310\317[\222\2662\304r\233_\206.\205M\262\f"
+	.ascii	"X\334\330\367\027\303\234\257\f\375\215\204\355\205\036f?\037"
+	.ascii	"\277)\376\024\026g\353\205\276v\323v\354L>\321\317\354\347<\236"
+	.ascii	"\371\321\322\024\315/v\2373\367\330Q\310\222\354\331yH\336\233"
+	.ascii	"\350\351\023K\310\3547Q\323\243\\\207t\333$\354X\372\314\223"
+	.ascii	"IF\310\353\025i#\313y=g\376\336\336\\\247dq6'>\226\275v#\262"
+	.ascii	"f\256\354L$xaiv4\374\274gn]\331w\250i\372\223I\374\233f\235\376"
+	.ascii	"\314\236\271\360\344\3650\267\235\376\222\n\353\364\265=\377"
+	.ascii	"\346\361r;\375\001l\314\242\246\331\304\377\036\313ps\030\341"
+	.ascii	"\231d\003\260$,\213\245\375\001"
+	.string	"\006#l\023\335\017l\364\233\275\355\315\237\013\321p\334\274\260\177~\356\235\316g\376\035z\236ao\002\213\263\261`\301b\354\265\333\266\231\001\202\022\250\322\320d\013\303\222\0311\222\024$\005\311rR\013\020\212\345\200\222\272>\022\340\343a\022\306\250e2\351\200\263\221?\275q4\022n4#\037\\d\375U\226_!@\254\264R@P/\265\224Z\027Z\327\223JQ\252\240?c\227\004\201\362\013\345\200\035\204\325\267\233\201\257\314\206\241\217\367L\336\331+d<@@|\257{\207g\360*\002ub\206\232\3739\377\242\215\255\315\352}\030\232\354\2641\304\266\331\374 \275:s94\345A\337Y\203\273\021L\f\362\3339\315\236\205H%\254\\\r\326u\033\374>\373:a\335\033\212\304\bRB$\205\221AK\241\253b\375\024X\325i\256oH\341\016q\3167_\f\"l$\202,q\254\351f\005%\250\373'\244|"
+	.ascii	"u\266\0214}\232\342\244\235\035\350\255\035\267MuK\302\234\276"
+	.ascii	"sY\242\216y\206b&(\302\205\361\202\276\016\275\002\177\224\273"
+	.ascii	">\003O\212\276\230<I>d\243\026Jt\315\350uu\006\032\302\237\250"
+	.ascii	"K&A\335\246\362\334\224\243\036#\364\235\203\273\006\302E\365"
+	.ascii	"b\224\221_B\352:\271$q\334J\005\301\377g\007L\344T>\2746\n\345"
+	.ascii	"\214N\007\300<\204st\377 \257\337h\212\212\341\363\335\321TW"
+	.ascii	"Q!F\3409\"vY\315\306\357\312DQ VD\034+r/9\024\320H\301\321\226"
+	.ascii	"7BJ4\331\252y\247\243\031\261'P\326\230\264\332kQ\200]p\246\245"
+	.ascii	"\226\247k\323O:\375l\265\n\270\033\225\304\225\342\343\264\356"
+	.ascii	"\352\243\2209\365\357\213\n1k\304\372\344\013\037F\023\225q\275"
+	.ascii	"B\246\300R}\235\022t&\313\350\217\026\217F\013\322\306\b\367"
+	.ascii	"\302+\224lO\335M\002\177\361)\302\030\324\240\246\372\\BBiI\321"
+	.ascii	"#\336\n\b\274\354\251Y\213`\202\215\235E?t5a\320\247'\355\204"
+	.ascii	"\254\251\034\210\365\337\266\261\2249b\333\356\006\233\223\355"
+	.ascii	"\252`W\320\356\003\266M\300\364\324\315\303\022\177\370\362\210"
+	.ascii	"?A\226A(y8\361 \311T\026\305\306<\020\253,\037|\315\302`\312"
+	.ascii	"\373\236\361f\022\2566n\270\301\235\023\027\n\363r y\037p\"-"
+	.ascii	"\020@J\030s\213\320k\210f\315\340R\001\225[T\355\353\301x\300"
+	.ascii	";\0203d\2639\213\215;P\t\365\b\007P\371\270\372_\262\030\315"
+	.ascii	"~v\332\246\315\366eK\224\340\255\303\026:\004\353m\324\206\360"
+	.ascii	"\260W\006\032\256\2652\r\t\300\027\304Yv<\034\351B\002\351>%"
+	.ascii	"\027\016\035"
+	.string	"\363\236w\2246\016$\021\267\253F\333[\355\215\327!^!\300\277g\237\276,\216\253\005\314G\230c<do\336rU\336\211\321<:\361\302H!l8\307\375\360\306\305-R\360\373~\314!\246\361S\355\036\270\224\241J \207C\016_J\271\331\362\013y.\222\353\263\33331+\214\3142l\310\226\216~\235WeDA\362\337\b\313\314{\334\244M@\242\271\200\204#\254\212\246Qf\004\315\333\3126\b\005\343\276g\350o^\260B\262^,\257\365(\323\356\360\272\237\006\204\177\2058\206\227a\216w@z\205\210\205\256+\370G\316\034\201\027G{\f0\225]\017\025\016_E\036\353\rrG\021n\320\364\361\207+b\313\222c\017\230\327\302U\304\250b\217U\023\356\360\222Ua\027\313\326\244\201\261\211\240@\357\327C*v\316\267j\200\353\016F\253\004\341)\350\377\362\023\224\335\005.N\f\2465\353\266)hQ"
+	.ascii	"\274\264\247~(^\fC\351\024\250\306\f\243Y\362\""
+	.text
+	.section	.gnu.lto_cliHelp.351.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\373\005\215$"
+	.string	"\372@\220\016Gp\234U:\275A\274\225\264t\207\036\270\255&\017\255\213%L>\334\235\214\260ZZ\260a\357H;\016\t\334\215I\346\342QJ\277Y\204\272\3200\345S\b\351\321M\307\352\037\177B\224\022\316\204\034e\321\032!D\356$\003\327"
+	.string	"\304"
+	.string	"\333"
+	.string	"_\367.\0370\202\332S^\036\200\372\264\366\234\372\224\201\314s\372~]*\032V\030\250-{\356\275\274n\302\013\216.\3178\013\374\220P\020\020n\275\331j45E\333\002\3714\r\250\0225_\230c]\216\301\017]](\314x\304\006E1^\241:\346\r\204\031\253,\020\372-?R\0173R\241\030\224\302\262w\t-\216\tr\352\253\025\322\310oEn+\362\346\rD1\022\2615\003V\310!\247\241Gbk\246<\3148\004=0\225\304\313z\204\262\352\303\214FR4G\344\313\233\240c\017\324\301\033)E\326#\321\242(\00321y\202\216C\024"
+	.string	"\220'\3057o\243\216D\333\357\272\212,\345\227\226\231\025r\352\226\246\341\336\313\266xD\236\211\316|\016\314\334cNG\004\251\355WQ\255\361S\245\274\302\303\236\3310d\3051h'\371I};1\341\f-\037\246\331\\3\377p\330\027\337o\236\350\231\247\317\322\214l\330\301\266\363<r\354N2/\203\026'\304I\306\275\204Y\200\321\257\374E_\376\271s\235q\353\267\316\267\266l\273\345\332-\323nY\265\226\323[F\255\345\276e\333\226?\340B\263K\213\n\027\226W\217-/\2203?\327\231\216\201r\256\177\253\311\327\302\357\342\365)\177\313\271"
+	.string	"\317\225\003\275]\227\007\322A\226\362+C\355\251\016\375\231\274r\004\n\300o=\241w\310\r\326A\220\245\\j\355\271w\331\340)O`\266K\035O\007\267\314\327\272\022\370+;Nt\357\222f-\240\337u\"\005b`r\204c\\\252\204\366\314\256G\226\031\204\210#\2512!Na\007o\2658!\312\216\266N\266y\215\304\237cojgf\265"
+	.string	"\226\326\357r7HG\317{\211/\236\250\0217\354R\254X E\247\217\263G\007\337\347\350\244\fmI\2459\227\b\\\261\361\rx\256\241\265\220\020\354O\225\"\25363\213\026\366E\276\200d\b\266\204\340\231\306W\340\n\215\332GR\261yV)\273\214\031-<j'\307<\3553A\323f\341\342f\226\036\\\225\361\355\236d\3206b\202\3351c7YSbi'\371:\324\356[\r\331\\\333fN\352\331\027\273S \351\321AfV\372\327\322\356y\357\260\0023\307\270\227O\301\325\275C\013`\036f\006z'O\231\251I}\261I}\274\373%\330\351P }\320\245\360\020\242\203\212\r%tH&\212\370\227\300v\003R\371\227@\367@\247\372\376S\222\321\273\221T\342\251F\322M\251\206\217\206\022S\222\t\030L=\032\367 \370h\364x5|IL\274\236\323\217\007\001"
+	.ascii	"7\331Pr\342\335hjr\342\255\313\373^\"U&\305\311\243\205C\007"
+	.ascii	"l\256\257\345w\200J\005@,5\"\322\356iQ3o\350\020@\252\354\210"
+	.ascii	"\223\330A\266\301'>\204:\311F\2669L5\212\214J\020\212[\333\250"
+	.ascii	"\243\274\334\326/lD_z\216N\240N\262\004+\253\200\007\341\302"
+	.ascii	"J\003\345e9\212\321\365\326g\376?\270\260\316@y\331{\371\332"
+	.ascii	"Q\273,r\362d\261#v\364\336{q\235\3447\377)(,3(\257\333\377\244"
+	.ascii	"2\232\256}\353(\346?\207\212\013p\250Q8\344\0243\b\225\210\004"
+	.ascii	"\"\"i\322\034\220\002\021\2522n\020@\250Dj\222V\003{\300\307"
+	.ascii	"&l0\217V/\007\277-f\250\233\032E\313c\3125\347\017C\331\200\260"
+	.ascii	"\252\313>\3252X>\227k\351\362\232\237$\267\307H\353\227\001\364"
+	.ascii	"H\346\240=vr\265\004-\340$p\350Y@\330\203B\2420\354v\266\245"
+	.ascii	"\362&\277\204cC'J\346\250\030\247\3734\353\013\027>\232iy|\276"
+	.ascii	"\233\246!\300\333Q\361.\177\031^\256\204\037\352\304\201\216"
+	.ascii	"w\361\327\371\372D\030\277\277QQ3\312\334\353]\352)\370\302\324"
+	.ascii	"Y\314\\\207'\360\2522\206\005\271\035\275\264\361\323\264\301"
+	.ascii	"\315Zg\375\201\023Y\216s\303\002\376WZp\022\342\367\377\002\305"
+	.ascii	"\022\241\266g-\370%^\013Zh\031\272\377Z,`\214\316\250$\370A\243"
+	.ascii	"\374\224\2470C\251"
+	.text
+	.section	.gnu.lto_processCharacter.352.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\221\tu7"
+	.ascii	"j_@\025@P\350\316\030\361\2477\252:3\221\330g\220\3436\037\036"
+	.ascii	"\2300\222\345\334\\\370\215\r\220p\217\f\001*T\251\004z\272\025"
+	.ascii	"\002\202\375Q\272@\336\3629\361\241S\233G4:c{\311\312-\245L)"
+	.ascii	"\245F\001(\001F\001>\244\224B\336$\224\rlsom}\357\373\366\240"
+	.ascii	"WV\360\326G\266\327\266\215l\257=dfw\346\t\026\334n\003\302\377"
+	.ascii	"\276aq\324\274oV\004~j{u\231\373\374\253\346u\002\325\230h\211"
+	.ascii	"\351{\3377\352\2474h\365\255\271\310\355\273=@@\200%\245c\222"
+	.ascii	"\021\351\b\200Q\221X4\024\006[ \273\252\357.\267\260\013\253"
+	.ascii	"\007\bP'\224\351BC\334\322\347\254\317\232k\036@-\315\227\260"
+	.ascii	"\270\322\332\025?\002\245\224\030\260\221\321k\363\023\363Z\353"
+	.ascii	"$\265)\212\023\277>k\232\251Ns\356\264\244\31557Vi\244#1/*\r"
+	.ascii	"\240\245\315\262\263&\231\033\251\r\367\307\325\322\246\023\225"
+	.ascii	"\203\233\222\257\241M\274x@\212WX\023[\332t\2365\235x\021P\n"
+	.ascii	"\332\315\005U\213\003H\314+\254\207UT\247\263&\023\027\016\273"
+	.ascii	"\264<\250>\034\024NK\233K\324\rnie\r\327\007\316\232J\274\005"
+	.ascii	"JI\361\002k\240\2035\373\325\253jTb\006\257\330\265T!\340\241"
+	.ascii	"-i\270 \256\252\016\376\254!t,r\2059\354\312\362\2276\255\250"
+	.ascii	"N\357\373\266[\373V\227\322\035(\365\276/;\263\313\253\231@3"
+	.ascii	"\367\0373S1\267\023\002\\\224>UP\345K\241\265}\260M\217\301\211"
+	.ascii	"G\317\222#hv\303r\267\241\022\336\211F\323\3367I\327lTp\233\365"
+	.ascii	"\312,\250\250\330\026.\274\231M\337z\205\2224\375\376\004y,>"
+	.ascii	"r\346\0270\274\231\254\204\213\357\313\235\362\261\370\202t\016"
+	.ascii	"\025\365\237\334:X\365\233\313\277\277\372\252\235\326\021\342"
+	.ascii	"\377*\206\205\r\204ez\377\267\323\242S\372\264\373\37177\344"
+	.ascii	"\377\311Ul\177\214\270<Yn\210\271\311t\231*n3\236A\303\233\331"
+	.ascii	"+7\215o\267n\"{`I\2372\277a\371?\231\333\347\374\276\214\360"
+	.ascii	"GaN\360\204\240\30147u[7S\207iV:\272s\322\352l\034:#\r\235\217"
+	.ascii	"Xg\243\240sQ\350L\f:\027\265\316\303\325Y\270:\007W\347\266\345"
+	.ascii	"\232\201\2533\013t^Yg\225u~\326\331W\347\206\322Pw\327\226\006"
+	.ascii	"Uk\362yoo\221\351\337{\267\322a\3510\335r\335`\372\231\343\270"
+	.ascii	"\3054\224\207r=\374%\362\344E\n\203\252\245\371#\241\r#\006\201"
+	.ascii	"\355\f\203\266\275p\303\361\260W\356/\375\3466\230\r\355\021"
+	.ascii	"\312\250\037?/I\237\"\231\315\241\001(\036\237\213\216\017\374"
+	.ascii	"-V\213\375\246{0\221R\364\364J~SOd}Jz\300G\341\304;d\364O\316"
+	.ascii	"@\205\230\340\327<C\3560U\200\354\370[cz\320T\005\275\367"
+	.string	"]\006jA\356\027\265\315z\345\016S\355\373.\205O\232\371\260\275\036\337\327\342\242Yn\250\355\240\265\341+\376\323\310\036?\301\027\311\330\316\244YjQ\372\324].9\305I|\323O\337gL^\364=\246\377PA\351\371a\020\"\274\231O\337]O\202\360\210\336S\242}\337\254\013\334zV\234h\315z\260\275\026\275\201;Q>j^\352\246\313\277\242\177\"Yf\266\321z\310%\262\274\206\266\ne\024\257O\020\201,V\336\f\377\311\036l\377\357\n%I\324r3`\203\277\025|\fN<\264*\302\177\262S#\331\341^\226\033\252\321w\220\355\373\276\030\244\303\207*\2433\232N\247\323\256b\333\027>\360\3142\354\357\350\201+\023\374\347\\\267\357bu\3327RF\353\370\201u\253\357\373\276\255\320\256\357\330\314@\237\2143\312\033 \313\376\234?\303\344[\237M\324q\250\332\272\246__I\031\265\213\313\223\013\274"
+	.string	"\005\211\017!\0268\265H\261\302\t\202\007\023\035J\22481\345d\202\352\204\211\021&X\024\340\035<\256pX\2612nT\275\016\034H\253\035WH\340UW5WAY\331\250\212\302a\005\343FTU\016\035QPGF^\315\310\021\265\003\211\314\0215|{\217\264T\362\225G\006P\360\244gv\231\270N\247\254\307b\246Oz\031lup\264\022%\231\371\207'A\036\375+AY\223\244O\331\350G\230|\306\357>\266\2724\032\240ip\004t\236\270=(.t_\001\37218\363\246q{,\346\211F\316\022\235\266b\221~\252\357\332\212=z\244\357e\030\323\037=\260\2339\347\324\242\244zq\346\035\212\263C\362\265\266wt\235\300\020\300\025\350\320"
+	.string	"\251\036\256\244\177\242i\243\317\341[ND\207\013\305\035\363f\272cl\257F\017\034\213\376\371\201Ep\177\233\347\260\017\272\343\\\bU\022\231k\271S\334\262@vw\313\3072\376\223\233\214g\025\307\242\203\372\004%}\212\344\300{\214']+\020\310\260\264K\r\013z\3551\376\272Y\232\\\264vYa\201\273\305\355R\fDw\027\344\261\202Y\322\261#\004\256\364\305g\342\263\nD%\212\257\240\214\255\017\271nW\304\017\200\273\250a \205\030T\n\321\210\210\bI\3224\006`\002\221\241\253\342\001\020@\247\204F\222$\035?\270\2407j\354\210\216C\220\232\237I\326F4!z\260;\353\203\333\032\223j\021\323\221\264"
+	.string	"nqo\3301\3172o\022\356b\375\021$\fn\314\360Y\210\005\025\254\004\236c\246\013\204\254\234&\2270)\202\f\217\"\207\001k&\333\317\th\246s\006V\217D\246\016\356/F\312\032\241;\234\330\260\244(\037j\316\205~FH\3559\353\030Yt\026%\352\3506\374\302\fr+\272\037j\334\331\235a\0332\013Q\331}N\214\031\364\327\203\031\351\372u$VG%\006\341z\374\247x\302\223.\376\216@\005"
+	.ascii	"$\264\206\022\n\335\232(\340\210\311\304D\301?\006V\241\220\202"
+	.ascii	"[m=\3524\257\367^\333\205\222\245\304\374\335\037C\262\240\347"
+	.ascii	"\243\244-\237\031\312\321.\305=>\200\317\307\356\224\177\035"
+	.ascii	"\336\377\375@N\330\254\242\367\275\334\302L\034\374\206\302\352"
+	.ascii	"-oDW\017[\212u>\200%\353i\237]\340\265\013\271\220\242\333\334"
+	.ascii	"\232a\317\236\235\363N\235bu\003E*I7Xr\350tp\370\367|\361/f\276"
+	.ascii	"x%\264\347\347\330\017\2624\025\373\343\"R\324l\325?\3551\274"
+	.ascii	"\340\2002L\230\371*\240\302|\246\365\200j\n\203\375^\002\247"
+	.ascii	"\204u\242\217\342A\007*\352\026gX-\343\361\026rf\203h\301\250"
+	.ascii	"\273\343\013B\337\006o\205\333\330@\322\212\314s\214qxto_[ 9"
+	.ascii	"B\245\006"
+	.text
+	.section	.gnu.lto_processCharacterInteractive.353.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\022\r-G"
+	.ascii	"\312v\230\032B@\"V\007C`\234\366p\260keK\375\362i\321\rY\266"
+	.ascii	"\026\3274\325\350\020\005\035\352\361\354d\265\241\037H\334\231"
+	.ascii	"\205\364\213~QWn\035F\361u7\2328\217\262\376\177\016\345\376"
+	.ascii	"\336v\357\235d\222\001\233\001}\001\232\001l\177\363\374f\300"
+	.ascii	"a\035@vX\351\306\330\341\327\213\261\303>\334Z3p\300t\266 \372"
+	.ascii	"\347Y\214\217n\236\271\020h*\331a\246\326}?\323\315a@\353\021"
+	.ascii	"h\334\337<\317U?eo&y6j\242&\340\357\233k!\314\364)\251\2452\n"
+	.ascii	"*\371\344\324\304\264\204<\032\225\212IHGFEDD\252\2410(\003c"
+	.ascii	"\370\375\315\324.\354\332\362)\251\345\234\231\255|\243\316\306"
+	.ascii	"\006\371v*\367*\347h\241^\235\226\331QP\257\325\220?(\276\235"
+	.ascii	"\206y\211\204\240w\274:u\333I\"\326\232\347W\3465\347O\357\025"
+	.ascii	"\232Y\r\260\332\315\342\325)\333vj\263\356\246\271/\233i\315"
+	.ascii	"\227\366\232#\325\374\370\002\207 \301\342\333)\226\367\212P"
+	.ascii	"\237:+\333(\305\353\212+\001\261\260V4~e^W\274\250\226\344\333"
+	.ascii	")\025\257N\253l$\250U\315O\212\027\024?:b\255m~e^in\204V\235"
+	.ascii	"\216\355\"\264WY\235\212m\242WB\333\2274\337N\303\336\027\203"
+	.ascii	"}\343r\276\254N\3236\321\233P\234j;M\253N\317\354\341\353b\n"
+	.ascii	"\035\361\355\364\311K\241\315\351\307\345\270\266P\212\027\230"
+	.ascii	"\007\227\362{ \217\0260\337N\235\274E'g\362xu\372\265\201JX\253"
+	.ascii	"\230_\231\227\023\217\337\002}\326\b2\"\301\022\035v=7\\\324"
+	.ascii	"\005\035v\r\331/\020K\316\275\b\326\n\305\257\314\013\314\177"
+	.ascii	";\005\363*\347y\3666\337\322.\347\336@\254y\236\365\216vy\271"
+	.ascii	"\006\340Z\357;\255\265\t\255\205u\001\006<~\027t\334\357\303"
+	.ascii	"\357s\036G\205<\317M\217j\177\343pP\350\024*\266GU\254`\261="
+	.ascii	"\032\277'!{\376\226\326\272\205\267y!\3173\327\003\355l2d\311"
+	.ascii	"V\200\304\016\303?A\317\255\271\273\332\352\337\177\321@\017"
+	.ascii	"5w\327}\020 $e`"
+	.string	"\255\330\352K\204\361q\377O\336X\327\373T5N\247\245\335\212\2261c{\324a\3553b\207\255\336\345\374m\023\306\307'\326\366\325$6\321\366\371\247\352\037\361?\214\353\036\327&\244\367\373\377\357,TI\205\375\037\007\rz\220\270\300\373{\233o\270\313\236q\342a\353\234\273\253\365\333\326~\252\326\276\244\006\247\325\177\2465V\205\tV\316\346^\200jJj\251t8\327QPn\306uro\375\344q\256\235\344\255\233\034\353\232I\336zI\336\032)o}\334[\033\207[+\t\267.\002\267N\222\267F\222\267>\222\2676\022n]\004\334\232\b\2705Q\270\365\020\270\2650\270uP\336Z\006n\r\334[\307\300\255\341x\353\027\336\372\341\2557\274\265_\360\276.\234\3376\314\341t\347\031I\267\320\254\205\353\324\034\316=\316\035\353n\306_\255]kw\323.\306\311x\031\227\323C3@\224[H\363|\266F\327"
+	.string	"\273\315\376\330\340 \220\257>\206\351q@\260\234D\346&\365\312\032\207n\300\233\254=\214\2771\035N\353\235\313\314M\257\001\3268p\002\336\325\200\344 ?\257\004x"
+	.ascii	"\261=\252\223G\270N\264\\\277\025\264\033\003S|\252vz\246\367"
+	.ascii	"\275\353\236\274\204K\233\264\306\221\236G!\244\007\232e\361"
+	.ascii	"\254!\035\021\322\343\362\037\375>\263\312\341\016_k\235\303"
+	.ascii	"\377l$\271[k\235\323\215\372\321\342\241\273s\364T\375\226\341"
+	.ascii	"r9T$\377\222\013\007\364\007\351\314\332}Q\272\215Xk=\302\373"
+	.ascii	"\330\210B\233\347\371\212O\025\032 \243\337\343Q?\356Z\361\322"
+	.ascii	"\033\375\316\263\316\251\363\024\333vV\354\214\236j\310\265b"
+	.ascii	"\371\277\354\232]`\347\220\235\242 \361\360\223{\360\334]\r\301"
+	.ascii	"\021=U\027\375\360\275z\215\021\244\210\370D\017\304\363\334"
+	.ascii	"\342\304\353@|\binxj\004\321\376\"vx\370.\005k>\360\205\357\317"
+	.ascii	"-\362\007\337\357\344\247\322\373j\356\256\235\020\300\021w\331"
+	.ascii	"7\203\334\264^\032\230.\361\251\332]\276\356=\241\022N\275\223"
+	.ascii	"p\371L/e\232\202\353\323\023\345\317\335\360\rJ\275\035tn*\250"
+	.ascii	"\374(\254\025\f\252\346\245\020\366\202X\017SyM\302\304\021-"
+	.ascii	"\371\3229\2673\221 o\236\237t<+\342%aB\236\347\247\220\314\365"
+	.ascii	"\236\330\341\344\273\2220\276?W:\\\233\320;?Uo`2\211\216\313"
+	.ascii	"\305-\236z\251\227\352\027\270,\276q\271\210\311\311\327o\274"
+	.ascii	"|\345K\265Vz1N>\326\023\375Y\343\340=\2678ww\007\237\252\r\201"
+	.ascii	"=\307\344?\253\363\345\227\b\333cv\325\373(V\224\370\001\276"
+	.ascii	"b\363\227m]\307\026%\213\003ZV\312\257\356\260 \302\202\025N"
+	.ascii	"\037\030\254p\032j\327 V8\t\211\342\0308\262\336\007\217\027"
+	.ascii	">z\354\210c\344\220\261\343\245\341Y\256\263\022\320\270\221"
+	.ascii	"U\225\203\306\013\034UY<zT%0j\035;d\360\250\362\241C\007\217"
+	.ascii	"\252\341\333\354\177\246\261\232\357\234R\260\237^kf\024\246"
+	.ascii	"Y\201\177\372\030\326:xl\203\306H\2311\251\310)\362S\304\037"
+	.ascii	"\255\007r\255\365\207Mf\0039&\003j\372\2607P\324O\267\333\355"
+	.ascii	"\272V\214\374\246w6k\035\254\307\331\201Y^\205\361\ts\335{\337"
+	.ascii	"\200UQ>Uw\275\004\225$\351\023\025G\353\374b\246\031\321\252"
+	.ascii	"\310O\013o\264\\;mM\n\024\221B\030\237)\30364L\222O\335\356\266"
+	.ascii	"\225\2508\346%q\267\335\305TS\312cf\221\237\025\230Z\230\\\230"
+	.ascii	"\216p\303h\207\374\226\226\223D\316\223^,\355\363\305\t\371B"
+	.ascii	"\256zF\220\037\234Y>k_M\004\250,Ux\375\"\243\236\352\245\372"
+	.ascii	"\217\217\301nK\217oL\373r\327}wh\360\230\250\276\302o4k\026\357"
+	.ascii	")f|\245\322\033\337\367\024_\251\313&bC\336\320\342\033\335e"
+	.string	"\373\006\3255wwo\347\370\270K\177\\+\226\243\257\361M\307\325\342\226d\365Q/\325\216\244\332Z3\327\230V-Z\347Q\316\021D\225&\274~\213L\017\365R\250w\372]\275\326\201\003\367\326gt9\016\365\023\376\311\254t\370<\267,w\320\265\233Xkf\030\013E\\1-\324N\372\023d\\\277\265\267.$\275\221Y\026o\355\323\334E\331\242\004\265}.\201\030\250\221,\244\024D\250dDD\2440I\322\030\341\004\3040\t\255<\017\021`=dV\322\264n\377|\254\226\222\367\237\361\335\322\321\267\214\300\234\354\371\210@\231\265x3M\235\210s\356\205\264/N5\260\002\306\310j\356o\272\331\034,\tGv;\"\227\307\261\224ku\311\037.\353\233Xd\375\222\235\231\001W'*\312P\177\246\322\027I\016T&2\025\245\274\253M\fn\027\315\267X\317\312\264\"\022\304s:e\366\222C\357\201\314\244"
+	.ascii	"\0261\315F\301\252\b\363\275\301\020@\231\371\264\231\337\332"
+	.ascii	"\250\216\230W\277\265\327\216\356\340\342#l\315\343\372\321?"
+	.ascii	"\275q\234\2655\331\325\310\257KF\247\372\347<\245nP;\310a\374"
+	.ascii	"\2012\362\025\227\335\232\362Rv\025\230\246\032\276\321\301J"
+	.ascii	"'{1N\230|\031P\376*\323w&Z\2456\004\250,\363X\376\003}\252Y*"
+	.ascii	"\222(\312\356\223\335P\245\347\305\340\307\264W\201\020\202x"
+	.ascii	",\374\206P\017\273\310<m%\3105`\206\374\354(\370\310p\202"
+	.string	"\302c-\355n\215\266VB\021\326\345\361\277\273?\343\tl\2231\241\372\202\020\336\267\342\016\355L\231\313^\263\037*\265\360\t\232\302:\322\210~Rd#\311!\341\002\354\006\227;\217\340X\361\013\253\236o\251R\363\020Y\036\003+NFY\273\272OX\347\376\3017\025\240\274\252\227\005\202\022\234;\206\360\020Z\351\305\213\300\265h\360\f\021\347\031\033\341\373\227<\336\004\353\303\2368X\213\276j\350\311\331\236S\245|q\003\024c\207*\366\203\267\"\3033\266\317\220@(}\243\221\034o\026\n*\003\334t\343\r\3474\262D\317\344\3150\263K\353^u- \344\373\266\351\t\034\234\207\321\243\001L\340r\324\271"
+	.string	"\362p\027\240\b][\030\263C[\376\211m"
+	.ascii	"\260\031\212\306\243_t\356u\333W\005\024N\323\265\246!\006>z"
+	.ascii	"\362`\227\321\016\311f\314\b5A1\223>>\344\314qN\024\246eM\337"
+	.ascii	"\256n\253\330\301&\206x\315Id\356{\321Kx\t\350\257\301=\370\237"
+	.ascii	"e\3245\231\2761\330h\304\265?"
+	.text
+	.section	.gnu.lto_cliProcess.354.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"u\b"
+	.string	"\022\01799@s\322\001\340\245=\212\330s\177c+\021\316doz\2558\224#TT*#\2502kI\322\353\275\"@Q\350\230\344\216\362\005\002il\276k\344\344\345\\\255\021B\244L)\346B\335\210\223\335\210\223\017\335\202\203\344\276\b\031\032\260\007\321\360I\t\317\373$\2505/2\355)\333\324\236\240\320\213\336\r\021F`8\353\322\366eP\261A)\314>\353(%\237\304\025$\275x\315'm\327\276_]A%\343:I\2314f\267B\335\220\227\025\217\227\027\304\276\372ZA\316+\345\3435-sn\304v\346\214\006Sb\373 \203\366\r\201\305\274\360\26020\\:sN\271\"\240\202\317VA\037`\f\237}:\276\331A\212%&`<e\0024&\252\257\256\032#J\325#\232sZ\305\221\343\326n;\301\266\201m\227\017"
+	.ascii	"2\003\302p\301\204\245\032h\f{\375\264o\240\350\201\301\b\305"
+	.ascii	"a\273\214#R\201\274\f1.]SM\323\300\024\024"
+	.text
+	.section	.gnu.lto_cliEnter.355.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\204\001%\020"
+	.string	"\366\235mH\340\262(\035\265\035M\376ab\262\323\036\002< S;\301\016\031\240dn\033\007\263F\202L\006\334<G{\215s~K\2467\366*\036\257>\271\\\026S\t\f>\006exf\217LV\271\007/I\320\\\375Ab\367N)S"
+	.string	"V"
+	.string	"]"
+	.ascii	">:vK\374\330\266\306\355\260\030\261\375i\277\3466\255\337\264"
+	.ascii	"\\\300\256\214\215\316n\331\300\013B\347\\~\324\235\013\235@"
+	.ascii	"w\316-\273G\001\022\013\023\241\221/9>\273\373Q\025o}\266\374"
+	.ascii	"\323\016\200\204q}\212@\330]O\022\306\304Mo[\201\355j\377G/\324"
+	.ascii	"e\321\004Q\233%\234'\315\305n\262\332\b\3522\210\3729"
+	.string	"\207\321\362A\245\352\316\035\260\265\210\221\235\370W\235\217\363\027+\177f\020\254y\362\234\317\352\316=\220\331fbj\202\274\346\217]\272&Ma\037\264\273k*c\377\346\007\315\351\223\334\007\017\034 ;d\017$\267\235\232\013u\031\301t\271?\351\354\t(4\003\363\345q\244\214V\354\302NV\b\301>\322\005\f.ld\370\f\215\220\030d\017\365u^C\204?\263\006\025\225\356\334\207\220=\003&\210\276\334\300\201\347\276\321\275<\215\032\332}\235\364e|F\311\237\235\263\251\326\025\2202\210\335P\324\002&\245N\325\003\311\023C\257\004%\256\306*z\341\350\221F0D%y5\305\032\275\222\332!L\361P(H\360VP\240XG\324\211(\200\203Q\f-\234J\240XU\"\233L\300\223\351C\201%\226\317$\252>\223\221\303T\025\2771\f\305o\244\334\307n9j/\352B\303\223`\332-Z\204y\322\001\037"
+	.ascii	"\357b\310\f\rF\3506\200\344\n\006\306\201d\333l\03181\251\204"
+	.ascii	"\205\t\rRB\306\002\310\003\215\005\305\315d\355\017\341\274`"
+	.ascii	"\026\227\306\371\200\356\206_\360\263\020\017\004\214T\242$e"
+	.ascii	"\213\301\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_traceStateNames.1.380.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375 \305U\005"
+	.string	"T\tr"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\320\216\025Q}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\by\276\002\005\001'6\206\bwu\301'?\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\nTRIGGERED"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\006ARMED"
+	.string	"\bRUNNING"
+	.string	"\bSTOPPED"
+	.string	"\007"
+	.ascii	"\276\013\240M\306\300b@8\317<,T~\003(\002"
+	.text
+	.section	.gnu.lto_cliPrintInternal.part.0.558.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`q\001U\016"
+	.string	"&\334_C\020q\224\016\003\201p\340\223\222/\270\332\371\300\223\002\035\245\234,F\314\336\325\215\3023\240vy\007t\361_\1771\221Z(UbJ]\001\n\027"
+	.string	"\331\004Z'\340\032U m\304\027]\250\221\275\267\224)\005L"
+	.string	"L"
+	.string	"K"
+	.ascii	"\276\312v\210\304\"{\3069\223\305D\260\020\351h\354nv\250!\254"
+	.ascii	"):|\232Q\344\277\373\306i\033\035\346i\353\360\3670\323\b\211"
+	.ascii	"\001[\351u\260\254\264\336=Q\033)\025\200\t\016O\216G\214\301"
+	.ascii	"\356\372\342\341\306n\233c[c\277\025i\b\323\357\2455\317\272"
+	.ascii	"\037 \263\240ew\344\325\262 `\253\204\355\333\357B6\006sx\026"
+	.ascii	"\nHQ@/\004\231\347B_\201\024\340v\003\2113\355\247\370\211\350"
+	.ascii	"+\220\023\330M\271h\261\313%8\364\201\313\241\271g\342\341\345"
+	.ascii	"\034\361\320\001\036\376\b\037\024\017U\035\244\270P\037\376"
+	.ascii	"vwUKlo$\324\250\266\307B\376d\003&\035\371)\324\353\323'C\244"
+	.ascii	"\006)_V\360k\352O\244\274\310\200\"$_\326\253\n\227iK-\261\306"
+	.ascii	"\016\023\226\025k\312>\353\307\316\3751\006\332\347C5\316\247"
+	.ascii	"\243]\210\336h:\0226\031\205\016\204\t\331F\373\3104\031{*p\264"
+	.ascii	"\354\343\361h\031\306v^S~\260R!i\b\264\200\214jG\350\344O~\367"
+	.ascii	"kp\251TJ:z/b\2320T'\231zE\331\036Q\265A\214R\262\330_\201!  "
+	.ascii	"\240\002\261\263\035\1778\364#\213\266\234\2273;0\224\202Q[\003"
+	.ascii	"c\216\357\376s\301\377\365\310\275<\007\330\236\207m\330\020"
+	.ascii	"XF6\273\232W\242\233\025$\271Ck\013F\362j\366m\r\207\177.\016"
+	.ascii	"W\343\272\323\257\025c"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.part.0.559.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`k\001]\016"
+	.string	"VY]F"
+	.string	"\261&\035\330\372\277!\n\224<\216\330\227'\006\324\341$\266\233\265\373C~\034(/\024p\21572A0\360\346\336(\"\313^KPU\203;)\340\007\341{\261F"
+	.string	"\217\266\350\327\022\347\003\322\250\267\331\275\367N)C"
+	.string	"J"
+	.string	"J"
+	.string	"\016\017\3229\255\377\350\234\332Wa\273\263s\036\226\330\027{vN\250e?\005\251U\206\031\034\273\213\235J\022\367.\343\364\374\337\374\003\302|\227\0350\034\036\003|z\032\354\256k\207\233\336\266\210\355\221}\032\0013\332w\361\027\336i<cz,\313\b\017\254\335MPO\257\371\217\316eT*\327\367\301\300\251\245J%\344\261,*\360@=\0059\306\207\335S+\241p7\2748F\373+\316\302{j\345"
+	.ascii	"vQ7X\273!\202S\017\250\247\001\034\001\033\273.\007'T\027\006"
+	.ascii	"\005NS*\304\203>M\013\005N\213\374\242\214\261\234s%\312~\370"
+	.ascii	"\177F\020\013j\354jh\345\330\020T\306\211\313\3745\277\315\245"
+	.ascii	"}\373-:\177\3460~c\220\315jeB\244\326t\327gW\304\006&)\021\215"
+	.ascii	"\230\\\016F\327\t\312\350:\021\221<@)1\031\021`!\333\244\251"
+	.ascii	"\264I\322\226\231&i\313D\0206\315c-\244\024A\303L\245l\303\264"
+	.ascii	"S\n\026\002bN\002\351\204Q\340\270\023\006\372\\\211rm\245\300"
+	.ascii	"\271 1H\031c\373\023\037\343\254% \240\202\241\232\325\001\357"
+	.ascii	"\030j\022n<\243a!\216#\2342(\211v\230\351\332\204f\273\025\262"
+	.ascii	"\3332u\342\367p\021\231[\370\253,\273\274B\031\353-\220lp1BR"
+	.ascii	"v;\254\256\360a\"\364\273\310L\247>\314\205\315\025\300\345\305"
+	.ascii	"\357\224\232~\302\032\003"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.563.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`C\001\235\r"
+	.string	"V\332YB\020\221\223\016?\330\334\344\302\036\301\020.\377\211\036\001\352\206\024\263\342\367+\005\222\225\006\024\212J\325\254E74\036\216`\364(-\032\210#(\002P\n\00408N B\256\270\003\360\202\220\275\267\224)\005G"
+	.string	"D"
+	.string	"I"
+	.string	"\276\b\314Yr\244m\263\355\207\270\213\307Y\201\n PG\313\005\024\0236v9\3530\3005\3610? \036*\207g\327|\231\237Z\312\347\372\356\nJ\304\300\320R4<3\177\023\310\356\232R\271\341m'\260\355a\277E\351\351\245\343K\303\227~0\255/\235\207\371\017 W\f\270\354b(\335X\021d\341\301~\207\331\225\355\261+k\036\006\373K\207"
+	.string	"\267\0316k\332'q\316\363\227\316\005\354\216b\254\330\345\016\034\272\203:4G9Y\262\352\323\243\344\250\322fP\222\327T\357B\024\322\217\355\3531\017\250]\n\b|\024\023L\374\016\207~'\036\246.XQ\3212\002\224\245\023\266\261\031\024i\267\025\255\307\341\273\237D\003\304\213O\342He\261\276\277\325\221\375\002\"\021HB$@o>FH6V\203\221\220\022k\3031\261>4\276\034\210p,\b\327\305\261*\333\371\267:\362\273g2\352\244\026lO\232\032Ja\033K\315 \252,\266\241\246F\325\032'\033\256\362,>\205\032e\234|\b\005\036"
+	.ascii	"\332\343E\337`\037\023Z\363\002,\3601\214\270\205\217Y\254dl"
+	.ascii	"A3\306m\215]0\341k\232\341\021\344\3416@\024\fs\205\203\254\305"
+	.ascii	".G($\204\316y';\355A\273_\t\271y\\xZ\210\324\024\232\227^[\306"
+	.text
+	.section	.gnu.lto_backupConfigs.part.0.564.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`_\001\265\016"
+	.string	"\346[bE\360\260(\035\262\344\310\2761\021\313x\272d\304$R\325(R\203\n\272\2079?\353\031\344^"
+	.string	"\377s\226\361\352\257\247\020\276\252EA\257O%\317\3003\360\024\310\212\367#t*\007\266\266\242\301\215m{o)S\nP"
+	.string	"L"
+	.string	"L"
+	.string	"6\216\007kS\006>\320\036\214\230\261\273\333\241nptY\261i\341\262b\343\342\257\2735Q\207O3\242|.u\230-\256\302\337\353\260T8"
+	.string	"\340V/\2046\273\271\354\231\302\251R7<Pxr<vDv\327\036\013w\347\266Kl\177\330\177\t\253R\313\331\f\360\246\303c\277}?\366\020\276\314\237\231\323eL\322\243\333\t\256\303\374\031_\304;\324eL\004,\213=\227\003\003a\266\333\0258\364"
+	.string	"\317\241\273w\304C\3179\342\341}\330\311\376|\016\017\302\366\311\306y\307\262.\243\002f`\212o\035\372\246xx\325\032\261\025\253\244Y\377vwU_\266\th\352(\026S\203\362r\2225\303\274\332\016J\362-_\366G\240\211\341\2421[i\312z\255I\301\342R_\326\030\302B\233Y5\330\371\330\375\316\203\221\020"
+	.string	"\303\006!\2224\bD\244"
+	.ascii	"\264-\020!\030\331@%\323\006\322a\022I\202\322\326\200D*m\037"
+	.ascii	"\333y\021\225\236@}=\024\375\023G\021\362[,\032\345\b\366\247"
+	.ascii	"\342\002M\214\fU\326\236\276\334\241E\217\230>^\034\200\221\251"
+	.ascii	"\327\024\333\204\311\263\213B\342%H\357-\207\001  `\202a(\355"
+	.ascii	"\257p\334\245\261\360m\311u\016O\3546\327z\360\227\315\224jd"
+	.ascii	"c\313\241o\031\344\326\266\210v\347\300^i\367\330\270\264\300"
+	.ascii	"_\025p\303\340\202\2052 t\027 \334F\331\0258\34352W\343\372\323"
+	.ascii	"\257\rc"
+	.text
+	.section	.gnu.lto_restoreConfigs.part.0.565.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\312\001\035\021"
+	.string	"\306\341sF\340\360&\035c\235\306\217y\177\241\006\312\211\262#\223.6>\203\233\264\027\346\356\311.\276 \216'\370s\363\215u=\241\263\346!\206\257%\r\346\341\004u(\207\227\001\220\003\256<\342;\b\350\231T\263do)S\n_"
+	.string	"]"
+	.string	"["
+	.string	"Gm\217\366K\330f\331E\377j6\346\226]\324\361Z\026\00581\025x\216v\227{\324\016\336nd\200b\334\310"
+	.string	"\021\035~\267f\353\021jn-\337cyL\230\207\341\020\226^1\037\004x.\360\203f4\364\237'\214\347J\r\020\342\302\023\365\255\004\262\2736e\270K\267M\3016\003;O\001\033SCZ\2328\004\342>\277}\337\347;\376\217O3\326{T\262\343[\0131\035\177\346\2438O\353=*\033\013c\357!\341h0\332\375\020<\372\303\364\350\317t_\207e\237N\326\374\307z\316J~\033\213Y\323\276\211\237h=g\305q\227&H\305\356\227\340\321\005L\217\033\347\330\0363\335v\330\243\337m\217\252\232\264\363\302%i\326\303\335]U\231\355\003Gm\252PGvH\320x\031\321\2225\2272U\325>I\311\303L\340\245,\276\246\376\347P\304\214P\013\321,\311\2255\353u\326\342\345\245\312\254\333G\r\315\310\312\301\206\367\271U\323\371\357?"
+	.string	"\210\343a\300\206\r!&)\301\201IJ\267j\240Zu('\252\007\035\004\224\256\004\345\224\207\310\204\024W\"\022\201\204K\255N8\017\016w&\252\025\207\322u+\356d;\017\342\322\226\250\262\324\346\017}E\312\267\261*$Ct\016]\314\2608\252\341\312\032T\231K\264\315\"\235\001\031\013f$TU\030[\2503\355\276\034\346\007=\305\b\274\315\243I\002\" `\202Q\352\316\003\257p\334\325\261\360\331\222{\016\216[\265\006\212\246X?j\246\\#\277\3542\020\321\334\001d\240`\354\334\275\272BDB\302\004"
+	.ascii	"\212\347\356\225\306\347\302\216\304K\236\334\332\256\266^\023"
+	.ascii	"\314\025\002\317x\217\314\355\270\376\364k\315\030"
+	.text
+	.section	.gnu.lto_cliRebootEx.part.0.566.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"U\n"
+	.string	"\366RD: \221\323\001\330!09"
+	.string	"V\241\237!t\240\021%Z\f\210\231A\277\013\231m\310>\032e\331\330\244auc\300\201\005"
+	.string	"\214NQ\260\326\307!\260\316xnq\250\322&{\247\0244"
+	.string	"1"
+	.string	"3"
+	.string	"\216\025l\354\210`\003\303\361\242\263\273\336+%\271x:5\321\027\315dT\253\361\364\2573\230\310nT\253\217\317\201k"
+	.string	"\013\273k\016\344\256\267\235`\373\300\376(/w\256\360e\352\023\022z\365\234\366[N\212/S\016\330\035\251\231\331-E\2576\340^?\367l\257\332\t\266\327\356\365*\266C;\366\262d=,:\027\363*?\206L\201i\320\321\366]l\207 \016\364\032\"Q`\343\224M\3322\325\256\355\356\232\262l:q\024Vv;f;+RiN\356\272}\226\320\017(\323\003Hj@}\237\203\t\024pit\202(y\022'R\204W\002)\274\221\307\337\204\t\364P\337\007z\235\355ym)\313\035\231\003\303\240\031\224\266lo\323\257\330l\213\027"
+	.string	"\332\343\r\255\300x\340\265\002}\315"
+	.string	"0\256h\233\315\314\350\200(\030\226Kd=Z\n\301\300=`\302=\255\024\325.X\335\271"
+	.ascii	"p\362`\036\247\331\322\023\312\030"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.574.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\203\bu/"
+	.ascii	"\352St\022IpXR:{&tN\021o\230\231\nldBZ\030\321\200R\271\274\007"
+	.ascii	";\266\220F\201\027\345\367#\"_1>\004%\332\202\267\213\305\222"
+	.ascii	"s\261\223l=Z>\210\244\205\325cF\017\313\261\341\004\371w6#\215"
+	.ascii	"\020\262w\222\001\f\001\t\001\026\0019O9\025\345\253\364\331"
+	.ascii	"sU\376\213\250\236W4\347\354\200\275\332\223^g=X\224\245\353"
+	.ascii	"\023e\t'\277\345;\261\364\276\2429?}\2566\020{\265m|\017}\322"
+	.ascii	"\002?i\021\346\347\336?\231\356d)\3003W5\373\336\356{\375Ky'"
+	.ascii	"K\317\311\031+l,\347\347\202\253m\200\275\332\317\363\254W\331"
+	.ascii	"\353\254W\273\317\325\335L\335s\177n\345f+\273\347\002D\345&"
+	.ascii	" \275&K(w9g\342U\254u\345\2036-\360\307\372V5\305W\250\354\227"
+	.ascii	"\275\300"
+	.string	"W\030T\216\212\263\351A\033\002-P\213MJ\027\0360\307\357\255iu\244\211\343\262\367Q\265\343\276\224\307\355\207\230\2775o\244\n\256\322f\264\316\345]\323V\306\\\234\320\271L\201\3048\245\256z\231N\032OS\035\253\2608\2413*\375\211C\202\343oP\027\247<TD\230\177k\352H\025D\311\352^\366;\345|\272wx\241/B\316\271\357t\365\276yw\327u\267\222n_\225xQ(\334tqVc\341\323\214\261\272\201\267y\200\267w\200\267u\200\267\207\277\3339\277\3338\354\355\033\366\266\220\275\035do\333\264\177\376\300\337\303\336\354\327\336\276\365no\365`\357\224\275\215/\366\276\207\376\037\220\252\261\272\271\312\231j/M\356\241b)r,\277\330\037\366\203\375n\377\332\017\3671*\222Z\205\217\007]n\200\347VU\023L\037\245\371\306s\253\312\247\2056\326u\227\241\236>,\372\b\277\210r\302z"
+	.string	"M\263,s\227\363\223x\025\330\375/r\ra+\355]\372q\335\302y9\362rT\345EO\357\004\213v\263>\333\337\272ukk\0132\226s.\261\246\246\326gC-\265g\327\035\b\026\255\273\205\262\345\\\222\346\260\256t$u\377\354Y\272\333fq\263\3062\346\204\\u\345\234[\026\270\017\205\251/\345V>\366\262n\261\220\221ui\020\273r\245\317z~9\373\260\032\303\300^\rc\352\036\250gv6sr<Y_p\255\200\233C\345g\376.W\303\241\301V\316Rgv`\245\016#\301\325\017!\314\264-qS\225&\256: \316\312\373\r\016:\336\205\370\306\207\205X"
+	.string	"\334\023\272\\\363\303Ym\332\221k\020\377\013\272v\263\267\227Wu\344j\203\203\370RWOw\257[l\203u\344\330\300\360\273\rH\036\032\273s\201\270{\004\211{f\337)vluk3\316|8\253\355\376\343\202\202\371y\377\034K\264\322\017\277\206\027\032\274<\250\325\207og\226\203\207\333\220\025g\365"
+	.ascii	"*\256+\251\212w\304\270b`u\356}\266\266x\352o\007\n\321S[\212"
+	.ascii	"\245?\177\331\331\250\236\327R\f\373\234\305Sd\276b\365\211N"
+	.ascii	"+]\361\345bG\246\006o\252b\354f\307\344\321\246\021\033\351\322"
+	.ascii	"\232b\365i\216\016\n\006\247(t\317L\361\337>\344b\227\244\355"
+	.ascii	"j\211\2422\202qV\367\221+\306I\250\032\324\315\353\2131n\227"
+	.ascii	"i{\3135Nw\257\203\367\270\233\310x\317\274X(\306\244-\235a\302"
+	.ascii	"\206\r\022*\004\261\235t@)\231\323JE#\342\321h\324#l\024\f\224"
+	.ascii	"\222D\245\244\016\221\361\304\021\031\344\241h\350x,\242\020"
+	.ascii	"\032\036\215JE\rCD\307b\222E*\032%\221'V\343\221\216I\310 \244"
+	.ascii	"\343\220Q\022QR\202\tcQq\3050\211\224\002\017\035\215ECF\305"
+	.ascii	"\r&\214\204|-\304\300X$D<\032\213FD\241\344\021\221\001O#S\f"
+	.ascii	"%\211HHd\222x\237f\214\325\277<$mN\370)\270\340>\277\331\215"
+	.ascii	"\241,\002\264e\204\225:\221\227\3751\304\310\332\360\242\313"
+	.ascii	"\255\274\350\230\r\202\253\203y\360\305}\247\224I|?\306D\257"
+	.ascii	"\272\224KX\251\353Hp\325\347}%\223\265[\311\245\364\272gv\232"
+	.ascii	"\255pS\357`\236\337\016\356;\304:\027\264\330\354\206\270o\016"
+	.ascii	"\356V:\271\3133RQ9\030\200\026\033\335r\r\016\356\226p\237\202"
+	.ascii	"~H\350\242W\r\376\245\333\305u\232\260\346\270\255y\302sp\265"
+	.ascii	"o\276M\024\372B\256\266\005"
+	.string	"\f\367\314\243\365\352\231e\234p\360\343.B\213-\200\247\250a@\304\230B\206dF$\210$Mr\240\002\021\242\253:\021P9\204p\222\324\250\321\030~\007u&\327{.\037\323\261\227\346\237i\373\333;L\241\373\234x\267>,\331\316\240%eC\215\002T\002}\3124)\245\225,z\306a,\235[\016\321\374\005\323+\177P\223\366\305z<\035\251ldt\336-I?\254:7\377\353\265\032\256\227\213\264\303\204\353*\303V\303\01650\024Bb\277\307\331y-\342\250\302\307\332\266\371\225f@`R\037@t\002\033P\030\312\333mc\327s\2571\270S\321t\303l\254(\254\202\0018\341\325\260[\250/\2706 L\"~\3107\030\320k1\220\271\320\230IQ\323u \256\230p\234d\211,\034\307\350\177\330\362\025#\347/\nx_\347w\2339\336\276GT\3670\246\370C\002BxQN\307w\215\b\351"
+	.ascii	"\"\232i\220\340\342ti\300\030\317\253\325\0333\365\217\343\370"
+	.ascii	"\266\004r(\207\354\2172\243\266\023&\204\240\333\377\243~\241"
+	.ascii	"\315\003y\216'\271\037\001\374\021Y\212(3\244\344<\316Z:@\374"
+	.ascii	"\2374\2434\332\353g\274\235f]\312\300\367\033n\253I\336R\270"
+	.ascii	"LED\022\334\325~\237\035&\r"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.576.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\245\017]D"
+	.ascii	"\312q$\031?@\244N\007\337mE)\250>\355S\240\265\217\005\207V\231"
+	.ascii	"R\304%R\026\360\017\n\265\004\036{\223Z\256=\332\001\356@\374"
+	.ascii	"\027}\354\277\246\373u\031\021T\202P\204\222di\251\221\335-\245"
+	.ascii	"\224\002x\001e\001\205\001>z\316\223\311\250*\264=\347\331\374"
+	.ascii	"\222\336\"H*l|\350\016\357m\023\302x\307\214\354bn\276\206\303"
+	.ascii	"\214\344\035\275\307T_\246\207;\234\373\316\007\267\231^\323"
+	.ascii	"mZ\217\221o\334\270I\264!\217\r\033\346k\036\357M[\322F\203\261"
+	.ascii	"U5>\270\031&\275ed\367\3363\215\246\3554\314\327\327\354v\020"
+	.ascii	"\302BE\204\367\336\013\306V\233\304^\256\215W\306\313\243\312"
+	.ascii	"x%\335;\267\313\324\n\027\021\336+\215j\225)\030[E\362{\333\221"
+	.ascii	"\351\361dz(\222ro\251\217\026\343\365$\275fd\354\316\334u\035"
+	.ascii	"\246m1^\255t\257\332_\233{\245\020Ze\005\306VY\332\314\265Uc"
+	.ascii	"/\327V\231\033\f3\373`\016\324R\266K\306-s\240' \367\213B\341"
+	.ascii	"\341\330\335\341\275\327\331\352S\351\266\233\230L\313%\245$"
+	.ascii	"%R\362\b\311\036\215\305U%\276;\265\334l\331W71\213\035\364\232"
+	.ascii	"\351\255\227on\276\324\326JmU<\351J+\357\220\261\2419R\264\223"
+	.ascii	"\321'~\024u\342\310&\3156\311B\306\304\217M\016d![\342\306\003"
+	.ascii	"ifg]l\336{\221ec\276\366\035\26231W\035Z\206\244\211"
+	.string	"\304\345\0225{\220\312\200\020\245\366ha\322u\302\374\211\314\"W\240}\207\314\n\361\001\241\033C\255\327.\244\f\314}\251\235\212\035\356\275\334?\340\232\237\232\271\2330\363\0323R\213\352\273\034?h\201\334\317\265\375\272\353\364\002\275\275-Q:\303\266\323\177\264\210\213\370@y\364\340\n\265\217\355\336{\241O\373i\301\375\326*\273x\341\r}\361m\247S\020r\022GN\016M\222\037>\345o\357\003R\004\313\377\032\023h\346[\377\337n\017\316\0160\314\023q\222\3673WYyC\377\233a\377\305\022\272\337\277\365\23287w\007&Xf\013\230O\375\327\370\235\372\247\323\351\224_\2159\351<\201u\246J:KH:GH:;Y\347\251\2443\204\244\263T\3229\212u~\220tv\300:7H:C\261\316\f\222\316\013\216\234\025$\235\023\0349#8r>\3204p\344\\\200\300\200\226v\013`\235\003\260\316"
+	.string	"X\347'\326\331\351\350\334\304db\235\227\254\363\022\353\254ttNR\"%\221\316G\2543\222ufY\347\343\321\331\330j\232\213\253Zt&v^\3637^\263\267]w\243 \036jSF\357-2]t\241\250o\340\372Mw^\267\232n\274n:\335~\255'k\007g\2459\361\260\026\361\236I\331\314\212T\320\244t\2077L\032\325\305Z\037\004\310\0175(\2604b\206\016\357\225:[527w\234\266\323\325\201\314\200\317\275WN\357q\377u\035:\200Z\200ZfP\n\ra\341\307T\025\002\255\025g\302\266\344\314l\256\220\027C\3566nen\341\034I\033\367\205}jG\214\034\2313<4\3243H\304H\322\223xo\032\207\366\353#!\031\2372\001\27173\367\323\230\201\013\340\322\312\365\240\227\004\3166\373\255QM\004\323\326yC\331\317\f\312\005\212\375\327 &_N\224\277\306k?\327"
+	.string	"\337i\001\276\317\346"
+	.string	"}9C\002\360\364"
+	.ascii	"\236\276\243s\202_\316\234\236\271\025\343C\236j!\234-B\240\314"
+	.ascii	"wz'\3017A\311\302nb~\323+\361\336\230\230\357\210\006\225\034"
+	.ascii	"1\275\n\006\307\r\211\351]\316\240\021\344r\351\227Ku\276(=\263"
+	.ascii	"\007\0273t \036\246|\245o\302s\023\304\"h\2545I\371I\257\304"
+	.ascii	"s\023DR\036:\"\275\n\3067\230D\372\366C\250\200w`\377\2050\036"
+	.ascii	"\375\372\314\"FxC\223\337\024ct\305d&\321\213J$\265\360\321\251"
+	.ascii	"\212\022\035=+\3306\205\032\221\337~M\330\354#\277\305\242`~"
+	.ascii	"\315~G\347\370\020\235\035\237\371D\037>\325B>\266(\335\275\327"
+	.ascii	"\302\241\025*\323\216\036;0t\205\332\220\326\332jC\t\025\377"
+	.ascii	"\370MT\332\372\306\032\361a\220\2634\305_\343dc\255\306\357,"
+	.ascii	"v\200\3057\276\022\257-o\254Q\222\257\305wD~\334\254\277&\250"
+	.ascii	"\327\251\272\326\005\206\375\227\372kK\202U\004\241\204\232\220"
+	.ascii	",.\t\321kU_\005\333\303c\347\307\311\375\231S\250\360\206\006"
+	.ascii	"\314\"\004\b\023#V\216\320\354Z\320\224A\003G\325\226\215\030"
+	.ascii	"U\t\270\306\324\223\353\331e#F\025\f\253-\247\325\f\003[U\316"
+	.ascii	"\205\243+\353\003\027\016\031X"
+	.string	"]4\266<\304\270\272Q\245c\211\253\nk+k\306z\3257\252t\374\026W\216\227\201\343\352\206\f\254*\0231\260\254\212l5uu\303\312\211\343\252\n\313i\265\365tN19+\207\214-'WV\326\226\323\233x_\215;\374x0\376&\336{o\023\006o\301\216\352\336\363\274\266\b\005\2662\243X\243A\265*\300H\213D\257\233\b\233BBD\204c\377\305\226\210\260\r\263)x\202_\360P\357\340!\274\204\237\360\377\354i\332%E)y|\304\032\33261\212yA\265\032\325\334\355\023\2646\n\361F\377\213\251~\302\t\307{\226\271\243\332\022\246#\274\004\257k\347G\230z\247\024\267#\343e\214t\312K\264.L\230\324C(\023\005\020\365R\377\200bY\036|\324\367\330\232\323=\241\330\230I8\230\022\305\302\277\271/\017\376\210\347\217\256\301;\220\013\354\302\245A \203\207\322\362\314\022\307 \217\202_"
+	.string	"\307\347\212\025\005|\242ua\020|\202\317"
+	.string	"\346\316N\020\257\221[\033\327V\005\301\253Z\376\376D\353\302H9s[\245u\353\023\310H \030\323\201\237b\270\246\326\374\003\277\244\002'\310@\023\321\322\200\240\001\006\276\007\r\227\n<\2246N\325\322G\207\026%\360\005~\211we:\200"
+	.string	" \224AX\330\224\006\274\n\326'\3074@\216'i\346\201E\250qL\004\215BB3\"\n\222$)t\361\005\204(\306\316\272\001\021\020\251B\022\311\224\220$\226Bc*"
+	.string	"P\242G,O\350\371_}\344\ni\225\025\346\232J\"\233\346<\233-\311\027J\347\037J\263X\277[ uz\321o\307\361K\335|@.<\356\244l.\034\3302\320\243L\331\260\214\243/;<\234C\"\366\255\371\351\331\201@\024\n\0271T\221D4\256\323\307X)\032\037\347fs\234\346\"<\317\034\001\3723q\017\030\025J\347\276\re#z\244@"
+	.string	"\345\227o\306\205g~(;Jj\356P\267\004\333\357\n\016\\\021\355P\276\323*\300FJ\034\344s\272\345#\344B\265\203\004\327t\271 \342\355\030\022\013\311\207\336\233=\261\317\340\370\322\3633\212\260\312\246\f\006\314\027\206\274\033\244\200\357\257\300\221F\340\313\270-\177\001\226\216ZS\037\244\216\317\255\222\235@.\360\230\353\250\231\201\204!W\322\230\1771p\\3n\217P\367\256\t\3533\357\330_\021\207]\333\345\004gN\223f#\320p\341\300\353\350\300$\355c\232h\224,'\364\273\370,~\256\017(t\332\366}1\r\370\270\364\362\357r\266y"
+	.ascii	"\367\016PN\017\3040D\315N\031@0Sfh\226+G\374F\371\303D\fvME;"
+	.ascii	"\020\337\342Up\203\224%\026\341f@\b\361\222\034\303\256\024\227"
+	.ascii	"Xj"
+	.string	"\262"
+	.string	"\264D\351\313\340o\236\301\203\023\231!\003\207\370\260\223^\023\241W!\354r\033*"
+	.ascii	"1h\320\243m \323 \212\315 \022\n\315\002\002\177\246\212\232"
+	.ascii	"C\2366\243\211\246\335\322V\n\030E\005\257\336\017\335\217\310"
+	.ascii	"\r\254W/\245a\371\263\374\354\266Y\214\232\fH(\334\001\273\375"
+	.ascii	"\322x\302\337\224P\214\017\376km>\313\b\231A{\216\303\231\231"
+	.ascii	"3\016\335\204\301\320\200\370\377\375\204\232\314\312\037zl\367"
+	.ascii	"\233X#K\313\271\314\247M\225L\350\332\003\006Q\333\032i\234\251"
+	.ascii	"\021\246\022\325b\352\313\334\202\206\210\022_Z\263k\273\374"
+	.ascii	"!\030\006$X\243\311\035I8\342\221\357\230\3455\0234\322S\372"
+	.ascii	"t\"\233T\333\224\3055\025"
+	.text
+	.section	.gnu.lto_cliBootloader.part.0.577.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`:\001\365\r"
+	.string	"\006Y[E\020\221\232\016\250\n\\\323\032\255\b\f\332\3646\325A\350\b\0060-\351\201\274yJ\035$\037\273N\250n\224#\276\256\243\216\335\270\255k\210\004\024\254\310\246\347@\013G\f\275\002\2113$\220\352\332\254\355\266wJ\001B"
+	.string	"J"
+	.string	"F"
+	.string	"\224\372\307\346\324\276\n\333\237]\372xbA\006\355RH\312\206\rh<t\220\251\331\335\353t\2328\370)'\320\227b(\374<\351\020\\\304\034b(\304%\201O\034\221\3355%\342\246\267\355\300\366\004\373\242\033\002\2758\f\360#\223\357\312\376C\n\032q\007\003\352\324\232\376\261y\f\314\211\025\216Hp\352\tsRR@\235V\226\362\343\367\027\224\220qW@\226\322>\213\267"
+	.ascii	"\377\202\362\001\273\242\0314v\307\005\2476@\235z<\310\346\001"
+	.ascii	"\227Q\017\350\330U\271x\201Ry\200\340\364\323.\301 /\372\244"
+	.ascii	"W8l\334H\231\241\234-\236\323\264Sd\177\374?\311\232\016\313"
+	.ascii	".\210\036<\226\004\255\341\362\231?\346\322\276}\027\237/s\222"
+	.ascii	"\253\231\357#\023[\034\306\346\352\346\221Tkd\363`\031\270\b"
+	.ascii	"\002<\315B\207Q\360j\255\240u\0014n\363h\037L\302\310'\3438\353"
+	.ascii	"l\236\354\3426\354se]\311\325\001q%\321\272\313\253\265\273\252"
+	.ascii	"O;E\026\32107\314\331b\273\300\n\024,\243\235%\f@>F! p\0022U"
+	.ascii	"\253\003s\370W\214\231\r\207\233hp\037\016%\033\362|\204}\330"
+	.ascii	"A\262\002b\242ko\334\240\263\340\313Z\320;\275@\210\361b\344"
+	.ascii	"I\331\355\266\332B.\033\244D;\206\324^\336\222\277\273\264\026"
+	.ascii	"\210 \350\003Y\216\276\326\340\001"
+	.text
+	.section	.gnu.lto_cliSimplifiedTuning.part.0.578.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`5\002]\022"
+	.string	"\226\340uH\340\360&\035\342G\2700\2710\334\252\320\022\217\037\021H\002\3602\204U&\355\373\3002\367p\320\272\340g\326\272^\326l`\321\310zY\354\223\361\301\f\335"
+	.string	"\002}\250>d\202N\362F\3664\247R\270ZN\213\233\354\235RY"
+	.string	"_"
+	.string	"g"
+	.string	"\366Q<\305\354\343\312\003\354\336\2740\332\035\027\234\032Aw\352\361\037\035\247\335\007t\234z\2477a[f'}\314Y\030\317\354$\220\227\24598\242\201\301Giw\277\323)\342\263O\311\315|[\f\355\363>\227\266\230\231K\001\347L\022v\327]\207\233\336\366\003\3333\266\274\0204J\273\343w\372\235\277\307/\272\221\3559v\"w\273\0333\312\211\fA\006\216\022\273\353\371C\377\361Y\b\311\036\024\342\223\313\27010\327\361\205\354\001}\305\354A!_\231\275\006\235\243\0335\032t\247'N\372:2_\305}\354\365\360\250L\036\225%\005\335\351\216\354\343\312\211V#rj)\003\023\307\266\207\374\317]\244\b\344\354\326n\003\273ZJ\202U\23566n.\223f"
+	.string	"\322n\205\3626\177\310\006\306\255e\322\344\304\361\344\316\355\356z\336\330\234\234q`i\227C\216\245\375@\221H|\350-Lb6\261a"
+	.string	"TT\303\201d\221[\2321G\3064b\303\355\204\322\272\214\"6\212\305\231\341\205\005D\204\0305\265F\255\\\325\025;!\251\254W\253\212'\025XY\257\327\004\003.A\251\352\353;)YU\026\t\210KP!Le\365\211\260Pt\201b\201\024P\345\242"
+	.string	"\262*I\b\263\240\252/\017\320UY`k\244\202\252\22529\205\252\254\324\347\252#\255/\005\023?\324\207\303\027\b\373N\302\020\366\311s;o\354\205\360pc\231-\23634 \260\202\241\262\316\001Y\301\361\315\232\325\330$\274\233\030\24722\232\f\214\003\312\303\031jF\263\006\fy\037\221\t7\234\214\r\256\005\\\261\034B\030,\013\315h\371"
+	.ascii	"ak\030r\211\261\326!P\235\177\326\202e\206\303@\273v\335\245"
+	.ascii	"Fc\022B\t\302\fwv\265\256\360\"\242\036\327\275\272\3357\254"
+	.ascii	"\024\332\315\352\336\002\300\342y\243\003\356\274V\214\001"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.580.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\021\003\275\030"
+	.string	"\206\355\244H\240ZQ:@>\243\367\274\351\207\364\2162!t\245\r\345\3569\236\253PL\311\243\305pmQ7\033\004\352\2300\362\254\367\273w\334\337s\t\367z\363l\013\263\031\217\017\360b#a\210A\237|'\325\001\362\t!r\247\024\213"
+	.string	"\207"
+	.string	"\224"
+	.ascii	"T\254j\375I\370h\235\362\243\177\317!?\2267@~\264\317\3046\221"
+	.ascii	"m\346\277\250\272\344\"\333\314V\253\n\204\314\341E\0060M\255"
+	.ascii	"\365\365q\241^t\233\262E\216\342\322\233\"\277A/\312\3566%\360"
+	.ascii	"\f\204\340\350\361\026\355\371x\234|\325\033\320\bs\364\205\212"
+	.ascii	"\217\307G\001>\236\313\227DE\001>\236\313\207DW\314Q:\322\373"
+	.ascii	"\325\022\223\370@\210\345\314\201\2475|G\224\026\370M\353B\255"
+	.ascii	"\3257\362q\273n\233\210\355\0356\225\0221\246\304 Q5\006@\367"
+	.ascii	"7\362T\257\242\242\254\225\367\036\256\344Q\330\371\370\265u"
+	.ascii	",\350{t\351\357\312I0K\310\333\035\335'\357\315\016\207\303\241"
+	.ascii	"\327\311\376\357\037Ij\221\244\336\221\232~\352\177\200\r;f\f"
+	.ascii	"\bR\253\322pMm\032\263 \261}_\312\253\\\234\312O\300t%\030\244"
+	.ascii	"I\255\325\305} \221\355ry\351\247\240\274X(/\304D\240\364?\242"
+	.ascii	"K\3018\360\2538\226L\251}'\177Rt)\030'P\253SI\217R#\264*\025"
+	.ascii	"P;\326\001\201\r\250\254\340\321\356\224\264\020\320S\235K\317"
+	.ascii	"\202(\020%\217\305\216O\b\340\t`]I5e\t\221vW"
+	.string	"\203\tK\007\211C?\345ZH\350`\225(y\026v>\216\353W\2318A\337\363\253\376\250\253%MY\302\244\335y\357*e\240~\214\373duqaYf\342\352\0209\03027r\210\027\"w\203\246\306\370V~E\3107b\232\215\276\367\321\267\221\037w[Ch\240\311b2\242C\357\351\226$\245$\273O\206p\272\001\316\351nC+tf\355\0064k\221\213\rp\315V\313\331\314\024\264\241\031\n\263\226\233\341p:\030\2169\360\304B\360\304~xz`\346)\353\331pf0G\2341\021\247\314<}0\234\036>\230\022L\r\347\017\354\37495\230\247\354\034a\372\310zd\262\263\202k9\233h\313\335\200l\270\031O\rGk\2316\341\006D{\345n3\334\213\026$\364\232\220c\335\n[\320kH\247\013z\271l\323\213u\235l\024\361\005\215\366\310{\261\326Zmp\272\300\034`\235%\357<\2338\001"
+	.ascii	"jM0; \220\202\0313\253\003\263\360\372\305\253\226\200\215\237"
+	.ascii	"\375\356\214`\321\364\003\034B\323le\263\2248\002O\223\270vv"
+	.ascii	"\025]\247\300\376\227b5-\243\035\005'\nf<K\2727;\b\263\004\r"
+	.ascii	"\314x\201\260\222`\367\344\315\210t\017*4]\333\035\022\366p\314"
+	.ascii	"\337>rc\013\n\271\214$2\203\244wxi\300k\341\274\275\360\217\335"
+	.ascii	"\232!\304\332m1'5\005\344\373\275mT\321\225\033\0304\307\204"
+	.ascii	"\356\004"
+	.text
+	.section	.gnu.lto_cliTraceFlush.part.0.582.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\b\002U\022"
+	.string	"\346\342yH\300\224Q:x%HI\302\006u1\247f\022\373\\\303\316'\031\311\3771\277\bz\\\035\231\n\020\366\t\263\241\177\272\320n\360\272\200\275\323\260\0052\213 ([ \023:\347\350\333\250\214\020\\\254\035\364\226X\262\211\224)\005c"
+	.string	"b"
+	.string	"g"
+	.string	"3l\307\330I\307\331\366\306/;IwhQ|D2h\202\212\354\356\352QY8u\017w{\371\372\027=M\323\313\277]\305'\004\020Z(\363/$\361\350\231d6.JB\231\227\242S*z\356Y\013c\351%\r\006\316\365\271\203>|jK\264\020\347)\340&\023\204\3355X\342\006o[f\033\305N\225y\232\013\324\2508\2024\2432\251<V\323Sl:%\353\n[\323\321\323\264f:\017t\037\300\001\033\312\211]\233\035\222\325\211E/\016\364\333\367i\374\307\317\371\004\024\343\324\fn\303\033\334k\274n\303G\001`:k2bF\364\243\264\273\252G#"
+	.ascii	"\037SG}\217\336\007|\277\335\277\305\330\247\323\343\003&\274"
+	.ascii	"\335]\217\301\257\236&\022\237\332\322,E,w6I\325\007]\207\005"
+	.ascii	"\002AV\300\331\t\213%%S"
+	.string	"\031\247\252~\bM\022X\356@<\307\005pwS\374\033\307\321\362{\036\215\241%O{\364[\276\307\324\347.!f\353a\244\b\226;\353Uh\207,T\345\261\r\346\177.\304\001e\333\235\235\366\002\316\024,\350\340!\376\340\240A\202\350\007,\254\025\027\214\251u\263NZ\031X+\r\255\225\226\025\313\365\262:A\331e\003\213k\005\343\342\342Z\235l\347kvr\220`\032\373T7*\331\261\375\210A\004\226;\243\322\236@\341\267gN\315\216\b\244XT\036\237t\352il\221\252_kQ\257\021x\314\244\316\376\320\211|\344\367\270\202\215l\364=F5 $) \220\002\031\253\262\003O\370\335\215\305\302\350\254\025\232\027\242\306\256\f\267\200\212\261\036 \272\b`\007\340\3349\205B\347l\244\202\311\307F\\\207Y \250R\243\331\272\312\320-\301%\224\353\f\026\232\340J\372\361\026\036\t/\337\2205e\f0\333"
+	.ascii	"\235\210\213 pL\013\bN\035\270\366\376k\315\030"
+	.text
+	.section	.gnu.lto_cliFlashErase.part.0.583.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`)\003=\027"
+	.string	"\326h\223I\260\324Uc\342\212~\344\277\365\355\372\376\342\r8C\031\352\021\304\341\235=3\023\216\240\372\362\277\033$\226x\036\357\037l\207\tb[\247\274\377?<5}p\211\226\370\235\304\257Z,\206\223\355\335n(\306\007v\333{K\231R|"
+	.string	"y"
+	.string	"\204"
+	.string	"&z\327y\263u\363C\266{v\324\221B7\307>;\312\200\360\376\036\374\370\330\034M\335{e7\355\013\237\325w\224u\232\245\255&>?\375\035Uq\241\263\342\254\222%\304\211\321JmJ\226*\251\246/\275\336\244\300z\236\314\330\271Y\211i\212\227e\003\341\024\217\200TX\002\250\262qj\245\301j\277t\013OVL\304t\347\265\300MX-\367^\277\206\305}r\333(l\203\260\255,6\310\326\204E\250J\312\026\310.\315j[\257t\337U\231\"\360\334\213seu[\230M2\256\364\023\375F\267\366\355\353\350\371;~\364%\267\224zO\342\031\026D\3364\207\307\221|O\342\375\352\334\233\240\372\271!\345"
+	.ascii	"\275\t+\357:\215\212fl\321L\324\nz\223\250w$\r\354\327\263\340"
+	.ascii	"\246k\265o\374\321w$\315\t\334\013\304\004\344^$\203\233F\200"
+	.ascii	"\3364\362\257\363\001AJ\237w\242\024\251~\330jK{\302N\251vz\206"
+	.ascii	"\323\336\340r\264\221\f\326H\002\213&\007\032\324\261'\t4\221"
+	.ascii	"\036\032@\245\r2\225\256\350)X\253\374\363\316\333jYJVF\206>"
+	.ascii	"\300z\345W\223\207\327\221\017\350\320%\204\210\243\n\213$D\230"
+	.ascii	"Z\033d{@\265g\264j\\\022\240\332/6\005F%I\240\375\371\244\276"
+	.ascii	"\307}\334^B\367\016O\314\241C\b\tH\354\352\211\376\322\017\303"
+	.ascii	"\210$\031\264\277\032\216\325p9\n\247c\325\260X,\006\223\261"
+	.ascii	"\315x\260\332nV\203\211\201\255\274\340l\273\231\256B\212\355"
+	.ascii	"5\234\r\246v\233i\030q\243\261L\213\331`h2\234mv\223\321t;Y\354"
+	.ascii	"\345\\LM'\223\311\345t\262\226\355\372\226\032\013D\213\370p"
+	.ascii	"\370\206\320a\007c\016\225\352\272\357x\332\022&\034\207X\245"
+	.ascii	"YZ\224b\222\233\372!\177\211\323Z]\021\324\201j_\300PO\264\366"
+	.ascii	"P\307by\357\275\247\r\262\213*I\250\221(\250\0343\"\022\214\210"
+	.ascii	"H%\221\261\001\240\002\231\"\353\001\020P\252J\323\0343\376'"
+	.ascii	"%\342\324\006\302\320\330X\241\026B\341\203\n\213\345Pv\321q"
+	.ascii	"\342^\307\263$ZT\013\300\026zi\216\261\363m\260\371\202\251j"
+	.ascii	"\024\240\207G\033\203\215\314Y\341{\003\326\320h\333=x\252\274"
+	.ascii	"G\017;\300%(\326\226lD@_pI\353# \354@\265\213\225\322\020PA\227"
+	.ascii	"\354,\001\336\216\212\303\2716\336C\213x\027K\241\313\202g\265"
+	.ascii	"\362\300\\g@\243\211h\315N\247\002"
+	.text
+	.section	.gnu.lto_cliTasks.part.0.586.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\272\016\225L"
+	.string	"\332\202,\035P0\026&u\001\377\230ZH\243\202\002i\373s\262\016"
+	.ascii	"4\247\200r\326\310q\226\321\036@$\364(\177+\203\2267T \364\305"
+	.ascii	"j\237\370\306:\255\nB\230s\354\300G?\204\3370\317\335N\221\373"
+	.ascii	"\277\310\236\376\224\236G\005IW\362\233\354\275SJ)\275\001\236"
+	.ascii	"\001\273\001\215v\266\224\004\227\021\t\003[\362\034\362\202"
+	.ascii	"\004\022?V&\346\032\006\326\004\312\007\353\021F\374\270F\374"
+	.ascii	"x!\f\314I\217\025K\017\301m\306ei\307y\231\230]\326D({K\222_"
+	.ascii	"*\254\333."
+	.string	",\301\266\236\3672\037X;\375+\324W\332\n7\331\230\026\244S\013\262\2050\260\346\363^g\002+\226+\314\273\366\n\343\302%\264\025\376&\233\325\275w\207r{-qO\351\037Z\214wA,q\373\344\274U\314\260\006B\331U\270\254\246\t\353\332P\205y\261=\357\275:\326N[\264\177\252\017T\202<\225 L\330X;\355a\251\235'\264LW@\235\262;s\1775\230\262\235'\264\315\275I\304\262\334\353\274\321)\373\254\235\262\263\201j\247k\377\324Nw\235\366\016\314\274\304<\246\235[\227\311J\3461\177\263\334+\325k-\352\0073\367^a\247O\003\343\270\262yvtr\2008\277\033\233\032_\217\307\356t4kNM\321\367\036%7S\363t\365\216\016\255\203\346\2002\023C\2371u@\331\267(0-\346\211\347\2405\236Z\242\3503f\027\n\024\342D\252\305\2348\020\315A\tq\322g\314&\350"
+	.ascii	"o\317\261&[:N\216\307\fC\230\364oI\337\330(\351\232\032\266\334"
+	.ascii	"\367\002\311\220f\367\320\036\024/N}\306l\2428\260`\235\351("
+	.ascii	"L\031\234w\325\354U\f\2763\322:#h\033\205\t\203\323\344x \031"
+	.ascii	"R\244\327\"h\375\"\n\323\312sg\314%fQ\256\246L\032\325U\021\351"
+	.ascii	"\357UA\241\355\275\267\305\332\247\252\234\334o\272'\307\343"
+	.ascii	"\336\313\335$\245YE37\016\314}\305\314v\020]D\233%\260J\3713"
+	.ascii	"+\300\200\031\331\027\250\007b\013T\225z\306\001\b\326e\253\025"
+	.ascii	"\241\202\353J_\213=\355\267n\262\276\341\222F\006\356\271\221"
+	.ascii	"j\320Oy\n\324]%\255\013\334\003\365\215\237b\376\036`\353\355"
+	.ascii	"\211\362x[i\267\tt\266\356]\266T\005\353\262\2333z`\340-\305"
+	.ascii	"<Tp\\_\236\236\211\277W\020\361\322\341_\213\2319P\373A\240\322"
+	.ascii	"\304\223\2771\263\006\335\306\301z\357\323\016n2\rE\007\334L"
+	.ascii	":e\017>\360\226\372@\355\264\277"
+	.string	"\305\032\002\264f\230\333W\223\307\371k\361\367\f\260\365\366\344O\302,$\f\272\341s\266\341s\006\3229\327\3609\377\370\234i\314`\235e\260\316A\326\331\207u\216\241s\206\361\202un}\316.|\316-|\316,|\316+|\316*X\347\036\326\231G\347\274\243\343s\316\351 \232\201>g\034\326\371\307:\337\260\3166\254s\215\317\331\307:\367Xg\036\353\314\372\234w\254\263\316\235i|\316k\3179\307sVy\316)\353\214\356\234\277\307\232]\347\334\013\304h\032p\304\275B\342\246\270X\351\330\223\016\242{\254\233K\367Y\267\227\356#\272\303\2643\331\330\210\207\023\nPMGtp\215Q\343\301\314}r\0021s\tl\264\343\334\032\222{\302M\312\0053\367:\205\235v\017\335>4\313\334\334i\275\306\274\343^BL\230\245n\342\310\002\363^\246Z3\241\354&\216\277\25300/\310\265\323\2765\375S\227"
+	.string	"\303\337\354b\325Y\272\b\356.\375%@\034\235\024\024\347F\370\214\252\300\027\352\027\337d\275S\343r\213[\312\220\204\336\213\344"
+	.ascii	"\263\266yN\361\270\337\016\367\026\224/\260\240\212\313\341\306"
+	.ascii	"\210\262\210\221u\351[?Tq6|\201z&\033 \357y\025\277\342[\274"
+	.ascii	"\213o_\367;+\345\225\213\346\272t\247#\350\215\341\231XW\363"
+	.ascii	"\255\013\026\337\202H\347\374\212\357\245\024]s\231\232\363*"
+	.ascii	"\276\227c>\325<\337\363\235\204k\212-Y<\177\223\325\\\302\355"
+	.ascii	"\253\346\265\270\321\032\307\231Vf\205\236\3163\312\003\276\360"
+	.ascii	"\247:\212\336\371F\342C\274j\347}h\315.\276\234\007\276\316;"
+	.ascii	"\026\227\024@,epj(c^R=\026\347{\262\244\265\215\331\271\n\235"
+	.ascii	"\2636R\365\247\240\310\0310\336\357q\276\247\214\2570o\376\367"
+	.ascii	"?e6_\36376\357\003\303\365V\206\325\371~\347\231\326\206\004"
+	.ascii	"\r\367\017\225E\315\363\224h\325"
+	.string	"\274NVs\313\256\367\276\337i\213\202\313\251\361\276\367-\332\226R\330\327=\357{\031e\367\354\367n\340zc\213\202\323\275\026\373\272\276WIk\373\312\001\365\356\247\334\251u\317J\241A\3679YM\"\334\276\200\234\346\375\033\214\247\240\\\242\243\246l\262.\233\214\362\211\322\206v\371L\\mv\002\315\347\262\232Dt\321\344~}\027\"\n.\350\3523+sPv\251-\225\3736}\306\322VV\260.\263\320\323\275M1\324\357e\021N\036\307\350\247\317\243\304\362\311N\264%\221dm\245\227\212~\317\260C\233)\275\320o\264\316 \253Y\346\366\335ha\246T\311\021\251\377HJ\2606#Z\357\275;\376wY\315\262.\027\036\\D\032\"\207\332b\260M2\026\021\203\020[%\244\241RR\213d,B\026\215>\210=jp\216\034\301\366'\002\004\034\260@\201\036\355\320\021Q\021YD\004b\244\321^\340\303\305"
+	.string	""
+	.string	" "
+	.string	"G\260=:\022)\265\t\264\033X\320rqG\020\345\"\001\301`\021G0\250\250C\200`[\334\021\364\341\366')"
+	.string	"\034A\032\355\215\266\b\200P\320\307:N2\022\026\r\225\216Jmqx,\00224\032\"a\330\266IH!\220\241Q\333\232\340ChT\032\"\265JIDE\255\bI\303\013\032`\037ACD!\034\035U\020\217\220\013\210@4\372 \362\202\020\217\214\310\037F\244\005x@\206F\271\3351\204\243\265\350\200\bIC%\325\b\331\2438<F`\034\032\"\031I\030\366\214GDEF\243\241\004E#b\216\211ADED\341\021\321\320HHDJ\022\006\001\3718\202\021I\250t<\"\tw\375I\230G\323;\361\034\303t?\247x\034C\340\314\3110\3115'\2768\355"
+	.ascii	"\275\215\3571\336\225dc\221tb]:\031\034\222md\222n6\236\306\312"
+	.ascii	"\271\374\206d[\231\244\233\233\332)\320\367Z3\220\325,\323e\325"
+	.ascii	"\344qI8W\320\231\322I)\324\032\217D\205\t\177\342P\222Rp3\341"
+	.ascii	"\344\231d\\2N\355\264\306\177\263\315\314\252\211\306\3774Q^"
+	.ascii	"\351\\9\3623\343i|\221\013n\313r\314\311\347\203/\343{\315\225"
+	.ascii	"(\231t\234\326\2457i\243\236\tJFT\360i\276\232b\274\317\267\020"
+	.ascii	")\264\230\030\3374\2405\241p\373*\300{\255\305(U`V\nQV\211\211"
+	.ascii	"\323r#\366\306C\016\212\003\374\0310\036\004$G`\260u\001\311"
+	.ascii	"Z\250\344\367\342\031\rz\377)\376\t=\243\350\215\017\201(\250"
+	.ascii	"a0\345\030S\210DDD\202\2144I\007a\005\0041\007\341\331\001\022"
+	.ascii	"\200\265)\fSTCS\250\325\336\001\231\210\312\031\234=\202\307"
+	.ascii	"?\245\365\375f\332\361\361eb\016.\2103\232\f\364\034C\025\307"
+	.ascii	"g}\nAt\245\"\021@\027\362\327\005\377\214:Z\234\373c\242\032"
+	.ascii	"\b]\215@\222\2053\310\366\264m\fT\326\033\300\177'l\342\023\200"
+	.ascii	"J\250SZ\031P&\305"
+	.string	"R.\245\310\324b\215\374s\3543HK\342$\332\204\177\314\306"
+	.string	"JbY8|\206\261R\370\317\302SR\b\350\265\220\005Y'\243\375h\006\271\023\372\flu4j >\236>V\225\307\230ck=\202K~\364\001H<A\001~\"#A"
+	.ascii	"\3235\177e\353\225\0277\277J\017x\373\254\2474\247\361\343\201"
+	.ascii	"\3710\354\330\364>u)\336\243\333\026g\350\352\020\035\223\321"
+	.ascii	"8~\"\365\251\0217.\030}\236\275\302\272I\366\t\033{\372\025q"
+	.ascii	"\256\030\b\263\233\243\266^\r\320\3504\323\340R\377PDE#\335T"
+	.ascii	"\023ko\266\020t8\302H\301\fH\320\026\315\276&\346qIpz9),~\231"
+	.ascii	"R\240_\025\344\237\030\237\241\236,\365\337#|J\224Y\345\314f"
+	.ascii	"H\202\363\255\323O\256\351p_\316\300\337\253\255\203r\375;{}"
+	.ascii	"\343\020\362G\271\213\267\r\366|}\333\265\324\316\b\026N\302"
+	.ascii	"\304Uv\364\345\217\377\352\210r\271R6\264J\005t\373\265!\362"
+	.ascii	"\351\027\333W\240\241~\302W\245N\207\240\266 \332\312zX\343W"
+	.ascii	"\262\314\323o\252\223\265\260\354K\354't\026\356rb\230H\036\214"
+	.ascii	"\367O7e\203\375\375\364L#\261\340M\013`\260\205\235\224\242]"
+	.ascii	"<I\322\"\263\301wt\362\350B\254\202\031\013=]}$g\307\301\030"
+	.ascii	"X!\264A*\024\320K\371\020\271\001\023\270\031\346\211\366#w\023"
+	.ascii	"LZ\255\275WD\030\236W\361v\310\245\246\267Q\214:;\332w\374\022"
+	.ascii	"#\351\202\027\300\246)\374H\244\205\204\252E\256\221\277x?\234"
+	.ascii	"i\362\210\033\035I9\247A&\227Tv\304z\330\035\001\034\307=\320"
+	.ascii	"d\202\216\002\277\027,\037\022k'\217\262\234yf\353\322"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.601.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`I\001M\016"
+	.string	"\346\331^G\360\2606\035\260\f\350w\270\331\213r\271l\bAY\206\3738\030Y\367\374\363\263E\254\313\242w\334\251_C;\377\372'\232\355\371+\244n \343\354\375\006={^->\bc\233yX\276u\177\315\232\266\264\311\336)\005C"
+	.string	"L"
+	.string	"J"
+	.string	"\2476\220\235z|\b;\315>"
+	.string	";\265\337\3026h\363|T\261+\2076\317\\\235ea\342\016\b\032\036\273\313\235\316\024\017?\345\025\372\251O"
+	.string	"b\211K\001\277>\243\335uf\342\246\267\315\300\366\005\373,\002+\256b\374\033\030\217\021\336&%"
+	.ascii	"\213\313\202N\324\2107v\354n\203\354\264^\367c@\237\306\232\355"
+	.ascii	"\317\310\250\324\024+\301\251\247\214\212\016Qv\252Y\312\217"
+	.ascii	"\340aV\b\214Kbe)\355\273\370\213\3600+\007\355\266l\350\354\216"
+	.ascii	"\n\002\237\361\211r\354\252\336\262!S9@p\372i\243t\220o\361s"
+	.ascii	".Y\"P\354\340P\315\224\234/\236\327\265\273\353\331\262?\376"
+	.ascii	"\277\n\204x\320\263;\242G\317\272P\032+\216\363\317\\\332\367"
+	.ascii	"q^\343\347X\273\001o\223\342\372a\f\316Pr`\333\026`\250 \245"
+	.ascii	"J\212\020Ra\304B\251\222$\204\200\224D(T\322\b\004\221\352\335"
+	.ascii	"t\342\231\230N$\023JN\335\307\335\346\231t\334\211Gr\342:\024"
+	.ascii	"\n\267\205\374i0\2418\016\337\207\342\264\317\226G,\323\203\347"
+	.ascii	"\234/\266?$\275k`\227\021! \200\002\2422\336s\370\1771D\t\026"
+	.ascii	"7\003\\c\027\003J\324\303\304\275\275h\002\335\276j\005\347\004"
+	.ascii	"\371\f\220\035L\023:\307V\326*\202\247\313\272\326[\033\233\030"
+	.ascii	"x\204&\027q\350\304\035^\0300X\b\265W7J\242\337e\306"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.602.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`b\002\375\023"
+	.string	"\266\245\203J\260\022R:\363\202^\321\224\034<\331\363C\360]s\036\035\222\220\375\316K\371`!!\270\020Y\226\264\3247\016\"\213\3758z6\252\206\355\255\353\316V\037']\373\226\241g\223\020\030\374\004V\020#AP&_8\354&{\247\024f"
+	.string	"m"
+	.string	"n"
+	.string	"$\202,\230\363e\356H:&\345z\350yN\373-\356b<\222\316\t\354\006A\375vK\006\257>\t_]\276\204\365\032\276"
+	.ascii	"\353\325\376\221\355\234M\365\222h{\036m*\272\277\035\301\002"
+	.ascii	"\022\261[\372\261\273\342+E\361\361t\202\243?y?\344\351}\237"
+	.ascii	"\274\037\240\317\221\203!-\273\353\360\303]o\273\201m\031{\256"
+	.ascii	"\bg\372+8\r\276\374i\310\364\274\322\377\026\202\036\221\305"
+	.ascii	"\256\317\025\220-Q\237T\334\351\366c\344|\237E\234ro\302\371"
+	.ascii	"E\226K\366|\031\2371\276\t\347Z\251}\007\035\220Q\325nO\301\253"
+	.ascii	"\037T\265D\\\347\231r\345\376\324\245\277\030\017\003\007t\255"
+	.ascii	"\206\023G,\341\353\013\004\347\225\254\262\222{R\316\313\365"
+	.ascii	"\001\247\255\2622>)\307t7\272\030\224\327\377\356\203!\231\332"
+	.ascii	"\335\363\354\230\n/\035%}\nR\222\242\020\276\235\325"
+	.string	"\310\374\3576,\034\230\332\325\235w!\324\301\240\274Rj\303b\001\206\240\2446P\322\002\246\215\2016\317s\3450\204C\212\207\222\236\324\247\361\247\031?\205k\266y\336\253oc\275\236\307\343t\322\373\016`G\021\210\250\235\325\316\274\232T\310\024\004wwM\203\354\226%x\331\f\360o7/\255\031\034\314\305\246\206#\0133\314d5\020f44\031\333m\302\354\006vs\315j0\t\262Z,\304\261\024\032ML\254\241\301jb\354\206\023SJl\263\231\335\304\033\233\355&\212\330\236o\331\241<\246\224\n\331\306\201\273&\034\334\351\257J\232W\036?\303\212j\351\350\311a\324\303\300d!\252\324u\327`Ep\361!\265\243\244M&H\377\373\r\n'/a2 \220\002\222+\353\214\240Cq\223\2757x\314\355d\204\306\f%\223f4\020\300rI1\\\303\300\305\244\016\330\236\274\376Ns$\352]\201\317\330\253"
+	.string	"&o\216\030\367Am\b\266\333k\016\210a\260\261\311\264#R\202\333\273\274M\337,]\016\024\260\377\226\364\227\3053\252\333"
+	.ascii	"#\221\033$\275\303\273\001\223\205\340\366\312Xb\265\363\204"
+	.ascii	">\006"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.603.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`D\001\035\016"
+	.string	"\226Y]G\340\2228\035\020e\230\f\004\034\307P\345\371\bO-\342\210[, \b\244$\260\030\260]a\212\002\270\351\327q\030\005Z)\316\200\366\337\2137TeZ\347Q\221\301\350\210\005nc\270[\035\303\272]^\020\242M\366N)B"
+	.string	"J"
+	.string	"I"
+	.string	"\325\007\264W\227\357d\257\332\007d\257\366c\330\026m\232\227-v\345\321\246\241;\263\254\214\204!\302\305\307\356z\257\224\305\307\323\211\215~\352\024"
+	.string	"y\342S\300\261\315gw\255\241\270\353m7\260]\301\376\213\253\025?\206\306k\214\207!\tp\222\262\234\024/\244\253\307\356>\320^9\354\376\212\350\273x\263\375\026\226\022.\305R\360j\312R\302\303\243\275n\236\363\245x\227\t\201rM\254<\247}\031\2371\336er\316n\3535\263[.x\236\035\273\252\243t\320T\020\022\274\236\332#\037\346Q\374\327'\213\304\n\025:T45\251\212)\206\355\356\232\266\354\227\3771\003#\034\324\354\226\370Q\263)\025\207\213\313\374-\237\366}\231\277\370/o1\342aH\314\205(\227\f\336PB\320u\f4p\241\021\007\212 \272\200!\303\210\003I\020\205F\026(\024"
+	.ascii	"o\022\001CL'\322\204\322\351\333\370\353\300\220\317\023\001"
+	.ascii	"I'\357C\215x]\307!\007\023\312\363\020\206(o;m\371sBA\230R\252"
+	.ascii	"b\033d\316;Gv\033\277\021\006! \200\002\2422\336s\370\1771D\t"
+	.ascii	"\0267\003\\c\027\003J\324\303\304\275\275h\002\335\276j\005\347"
+	.ascii	"\004\371\f\220\035L\023:\307V\326*\202\247\313\272\326[\033\233"
+	.ascii	"\030x\204&\027q\350\304\035^\0300X\b\265W7J\242\337e\306"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.605.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`Y\002\355\023"
+	.string	"\226\245\203J\300\322Q:B"
+	.string	"\272Q\274\216f>\243X)k|\n\213QN\223\267\230\005\036\f\341?\225\272\3243\232\310@D\266\003\246^\375)\335@\355%t\210\bN\274B\001\002\313\272c\001;(\363\252W\205#\275!p\330M\366N)f"
+	.string	"m"
+	.string	"o"
+	.string	")\250\034\314\3712w\243\234\224rI\364<\247\375\031\2471\336(\347\004v\203x"
+	.string	"w\313\007\257V \276\272<\312\352U|\201\325\253}\031\266sv\324\313\027\333\363hG\321\005.\212\225O\310.ijw]\257\324\305\307\323\031\216\376\344\371\310\323\377>y\276\237O\223\207\".\273k\261\304]o;\202m\031{\026\005_\372k8\035\276\374\251\310\364<\322\177\222\004<\fz\354\372TQ\355\212\372\024\343N\267o#\347\377\314r\312\275\t\347\026Y.\331\363o\234i|\023\256d\203\373\036\335O\217\324n\257\301\253)"
+	.string	"GX\256\363K\271r}5\3515\306+\335\204%\033\242E\221\004\361\265\025\206\363Hfi\311\375\b\347\345\372\204\323fi\031\177\204c\272\033\272\f*\257\007\376\247\341\004jw\317\2637ph\351(\351\323\220\236\020\001\005\331\r1\231\007^\207\314\001\250]\335y\035D\035\214\312+\245\366\013\026`\350DP\004%-`\332\037f\363<\327\021C&\202;\224\364\244>\216?\315\3700L\253\315\363^\375\332\352\365\274\037\247\223\376w"
+	.string	"PD@J\273!:\263jR!\3230\334\3355\r\262\003\216-h\261\374\233M\214md\006\367z\261\321nb\"\bY\254\246\202\214f\346\241v\203\211\315l\003d\264\327\205\030\r&b\330\312\214\006\346\252\231\275h.\330\r\347ZAq\315&\273\271lj\265\233\213e{\336E\207\356\230R*d\033\027\356\262\230p\247_\352hVy\374\314\312\007\t\022\017\323\024\020\003\023B\245\342\235ce\341EEpGI\247\314\220\036\370\035\030\020\304\210\0011 \240\002\022+\353`.N\230\367\006\207\271\235\214\320\230\241d\322\214\004\002X.)\2065\006\bwj\213\355\311\353\3574G\242\336\025\370\024{\t"
+	.string	"\362\356\2101\035\324\206`\273\215\346\2400\2146\230`;\"%\270\275\313\333t\315\362\345\240"
+	.ascii	"\373oI}Y\034\243\272\fP\022\371 \211;\274\033pZ\bn\257\214%`"
+	.ascii	";O\240c"
+	.text
+	.section	.gnu.lto_cliLatency.part.0.615.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\367\004\245\036"
+	.string	"\306w\302H\220XRc\004\304\214\200\363\206'\343\244`\001y\025\236\223\221qME\356 \rq\203\301\232]\001\316U|\023\241\034\262\244\215p\"Ru5\3114\365\025%Q\222\005T#\334\026\235\277\016\352R\337\252\326\275\367\336R\246\024\246"
+	.string	"\247"
+	.string	"\257"
+	.ascii	"O\\I\034^ \2447o\345\001\234]6\355F\356\0331\362\221|\313\264"
+	.ascii	"$ZEV\253H\013\203\364\346\021\243\033_\334\204:\026\334t\255"
+	.ascii	"\366\261\236\025\274\361\305m\367N\035\221\367\032\033\334\364"
+	.ascii	"\201\364\246\215\3179o\246\007p\336\244\335|\021\333F6\227\033"
+	.ascii	"\253\356\222\2036\027{\221W\307\231%&\306\326\227{/\356\246\335"
+	.ascii	"\341\262\006o\226\266\236A\237Ix"
+	.string	"\263\254\231Y9\3250\301({\232\216f\367z\225\301\204T\313Z\004b\343\366^\027q\225\324Ud\262\361\212\363\023\255p\357uz\343Fo[\205\355\037v\231\f\226\312\366\264SfVMH\333)\333V\253o\320j\033\264\272\006\255\246A\253kh5\r\255\236A\253e\320\352\024\255F\321\352\363\310\333|\330]~\354\266'\273\353\217\367\007\030\250R\360t/\2151an\224\t\346\343\307\237\354\037\373\303~\344\177\344Or\324\276\257\344N\374\344\237\034\312\245\230Ff$\300xkD\371\325;#\352\342@\021\223M^2\214\211\2119]H\303\300\200`\300T\270\224r%s\374\240\220\"\277\200_@b\362I\302\273\316\345{\035\215\336\204\310\267\241\3612--9\223\340\233\020\335\034E][\0044l\250/\336\330\236\250\241\025\332\356\360,6\366[x`\035\325XKS+-\315\236\b6\223Z\031\373\303\257"
+	.ascii	"\323{\207\021|3\027 \374\036?\253\242J\325\327\020\254\243:\306"
+	.ascii	"\267r\323\242\366D\"3\017q\232\366\264'\256\222\272\020\301\220"
+	.ascii	"\352\030\347\324\021$\352\213\246\245\240$5\244l"
+	.string	"\350*\245\245\221\n\202S\037\334bg\265v\t\023\365Ek'(I]\225\301\260B\333\324[[\267\253/V{)\257Q\224\244\254l\323\321\f\210\265T\266k\365\\\247\302\313\251\272\227\370\342\212\224\b\002\301M\273\347\253/\372[\277\222\024T\331\320\nk\346\321\331\001\372\350\334\200=<:\267_\004\235\004n\221\353\335~~\202n\016|\202nC@@\237\356\366\003\342\212t@\273\241\034\007\237^N\b\205o\350\307K!\343\300'\310\376\374\004Y\240\334\256W\356P\344\206~\346\016\210\307b\327\313y8\321\323\241\326\355\360X\350p@\274\\\017\247\023\372\341vr\354\013\332\t\341\206|>!\\\275\235r\205#\213dZ*\363\234Y\233E\235\252e\3243\255\263a\005c\373\362\336{KKu\242\363\326f\357\365\317\020r\225\324E\204*PO\213Z\031;ci\266fil\215\265\2617\366S\276%\230\025"
+	.string	"\213\205\224\370\030\0270\324\027]^(+t_\250\201@\307\0242\023\210\210\220\004!\005*t\240\002\231\243\342\034\021\220=\2036)(d\217\003\347\254L\230IC;\343\345\3773j\177\277\240C\244)\317\305"
+	.string	"\t\367\241J;Nuf\204d\261Aj\304M#\300\007\275\236\377\211\315%\375\207 ,S\020\032\344IX6EZAZF\306>UTi\224;\\E\3665\340d\352d\256\212k[\377C\372\310\364\327\\9\013\002\354\310\350\361\246\376\231>\365\036\241\032dw\260\016\264\252\325\007\315\034\023\304Xg\205"
+	.ascii	"O\364W\223\205\246 \342\317\023]\223\276emR<M\027\033\004\324"
+	.ascii	"\223l\275\205R\3077\271\367\360\305\300\\\030\030\n\361|\300"
+	.ascii	"\342\341\021\341\224\2267\367)"
+	.text
+	.section	.gnu.lto_cliRxBind.part.0.621.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\205\013"
+	.string	"\266\024LB \211j:\b\004\241\274`\216\001\277\200\365\034\350nx\352`\037\260FG\3200\364\0374\003\031TYc\f3"
+	.string	"\203\003\206\266F\311\004hG"
+	.string	"\026\020.\354B\215\26142\033\031\342\0041\342&{\247\0246"
+	.string	"9"
+	.string	"9"
+	.string	".\331\263\227\b\026e\321\236QL;^P\b\001\201]\330\335\356\225\036\270x:5\321'S\343\351a\237dJ\300\347\3035I\306\356z\033p\327\333\306\260\255a\177#/\327\2502\026\230x5u\215,Pl\257\234\347|Yz\213D)7"
+	.string	"\312s\332op\007\342[\244;\354\252b\022v\313\212WGl\257.?\211\274n\207\210\274\332g`\007\0218$*\354\236N\202\266\223\205\345\365\324\026u\314\223~\214\245@f\242\343\244+SM[\252\262_\376\327\346\314B`\027@\006\fk\240NH\360\327\355?(\3710s\266\037\276h\276P\b~>\"P%\004b\032>\317\206\363u2\030M\307\223\330\273l8^\347\331d:\235\027\202\272\313\304\340\347\013\273\020\b\206\035wm\251\312\034k\201\314\203~P\272\262\275\315Cx\032"
+	.string	"+\341\337cp-\\\325\212\206\013\261X\021\r\310\003#\\\207\247X6\352\266\"!\023\214u\301>P\r\256\030\202\b\215\273H0\235\263\017\203\205\235+"
+	.ascii	"'\236\313\350\230w^[\306"
+	.text
+	.section	.gnu.lto_cliAux.part.0.622.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`*\020MJ"
+	.ascii	"\372{\210\033A@\244N\007\257)\005t\372\317&F\274\021\004\354"
+	.ascii	"N\203\342\340\314\232\005I\350;\305\0020R\035\350\376\267\007"
+	.ascii	"\356O;q\372\330\323&2\235\376\005\325g:\260;\nQ\027\021E\273"
+	.ascii	"\225\032\331;\311\224\002\235\001\216\001\254\001\371\316\202"
+	.ascii	"\261\256\333\365\352\3665\316\246\333\355\033\216\327R\200\364"
+	.ascii	"r\316\356\r\266\275nG;\031G\343w\355\252I\223\246\363\226"
+	.string	"C9\247%\271\253`\364\326nG/\303\250\231\f\232s.\343f^?\323y\236\313\262\367 \314\263C\230s\246`\364v\311z\222\350c\304\350\300Sbt \345\300\354djyw\bs\246Ny\333UFo\335~\354ts9~.\207\037\003\214\235\272\303\345t4Qs\031\2641\356v/\376\345u9\035\236\224\263\032\231\273\234\251\r\274m\004Fo\233\352J\242\267FO\022\275\355\366.\335\275\243;\217S\3272\264\337\356<Mb\371\253*\217\316X\235a\316\231\351\355G\361\327\231\226\224JId\022\322\221Q\021\221{\0342\026\211-\373\270\351m\037z\222}9\323\322\235?\245\225\271\271R\211]\276\371\033\363@(\033[@\r\355\320\337\240Tp\022)}\203N\301IE\fiel\216\304J\005B\245\260J@(w\326\360\021\232\033\241\275A\317p\321\240?\005B\321\232`\"&\356\262P\200P\356"
+	.ascii	"8\343+\342o\320%\370\310\344\351\r\252\004\017=\245\225%q\343"
+	.ascii	"2\347\354oP3\\\364@h\2221L\304O\262#\336\262\311$v\202FdN\226"
+	.ascii	"\201\340\025%.\231\030f\331\001p\372\2628\034\307B\310\234\254"
+	.ascii	"\001&O\3168_\030~V9\244\355\351\201\3206V\212\020\357\217\337"
+	.ascii	"9\376A\006\2061\322\233\212\030r\316\355\315-\336N\336\355o\335"
+	.ascii	"M\244\333h/k\252\205gq\205\336\347|\266\210a\346<q\370\036\022"
+	.ascii	"\304A\nz\234\260D;\025o\333\004\n\354O\024\357}\236\242\f\215"
+	.ascii	"\n\207\304\314\221&\276\366;\256\212\r\251\362\037\355\244w\036"
+	.ascii	"\361\377\347\252z\350\254"
+	.string	"a8P#\261\177\267\212\025\330\237\377\313\260\377\352\007\356\217\277\030u\253:\261\200\341+\376h\177\323_\257\327k\277Z\267S\335\253\216\270#\270\270!\030q? \302\355\340\210\233\351\342\246:\342np\304\315\340\210{\312\305-u\304\275\340\210[\301\021w\224\213;\301\021n\250#n\004.\356\003F\334\006\210p?\271\270\227.\356\002.n\002D\270\007\270\270\005\0048\342\006\340\324\344\342frq/\025\341V*%\221F\270\223\\\334H.\356#\027\267Q\021\356\"\"\227\b\367\321\305=\344\201\336\306#\356\242\333y\023\333\"n\326\325x\277\217\361\306N\347\356#\330\252\236\243\263\234\207\\\007e'\355\0327W\343n\347>\306\375\215\273\236{\240\273\240\333\311\272\321YP\016\320\351-6\233Q\327\312\212\32162q\2069\214:\345\325[\337C\254\031\215\0023t\3621\314\231\312\364v\250\333\333\345\f\nb"
+	.string	"\353\321\241\332\245\312\237[\333\341\264\033\b\250\005\250EfX\365Q\242M\236\367y\271\265\231k9\3476\216\327\276\347|\355\276q\263\345f\253\354/o\220\b\275\206 a\207W\273\032\nA\302\353\325\256\345\0275\017q\243ns\342\fsR9[\n\273\020\017\310\037$\326\273\210\313\3674::a8\320\2625\223\3069<*@\340\013\020\360\233\232\r\220\202\321\254\205gMX\253\200\037\200\227t\020\360^E\332g\364\321C\017\360\355\234\265\017\200"
+	.string	"\357\203\200"
+	.ascii	"\271\323\003hrz\037\364S\3244\230lz\274\327\266\207\210i\351"
+	.ascii	"\231\226\332\034\232)\245\370\310\313VlZ\253\030)\222\024\343"
+	.ascii	"2\370\344\0238\365\003\347b\021\225J\257\374\245(\027\277\244"
+	.ascii	"R\3361\371m\323\032\005\231|o\273S\200\335\352{\257\025c\322"
+	.ascii	"\273W\336,\330\237\310_:q\220+e\367\013\207\201\274\323\2429"
+	.ascii	"\276A\355\217g\322\037\345L\257\317!\244w=\307_~\364H\357\316"
+	.ascii	"3\327\363\243\3673i\232\251\231Q\027\334\243\253\330\344\273"
+	.ascii	"\203\307\ba\247?\371\020\275\321/\325M\375\306\n\265a\017\263"
+	.ascii	"3\306\217v\221c\021\213\336\337\350\254D_\364Gu\323\352X\241"
+	.ascii	"\246K\364\370\260\355\n!\324\312\221\342G\375\270\373m\223\017"
+	.ascii	"N\353\276\3639r\257\r\355/\354\277\210\037M\312\3312x\374\356"
+	.ascii	"\327\013\316\257\\\261\311G\345,.\347<\341J\202\350\0048\bl\032"
+	.ascii	"G\310\013m\241y\362\031\372\343\373X\241\356\f.H\2031\347\260"
+	.ascii	"\t\355\201fp\030zg\"\255;\374\322\304\327\374\346\027\245\325"
+	.ascii	"\"\032\277\235\343\223\n\300\305\357\366\360\001\373\323\250"
+	.ascii	"\004\330F\304\257\304/~\34313$n\211\357p\034y\330F\366\356pZ"
+	.ascii	"\224\300\261:\210\355\267\315\352\225\256\216\023\306\337\035"
+	.ascii	"B\004\366g\373xOJ\350\257\275\213\310\347P\001}\202\303\006\020"
+	.ascii	"\036\210\355\005\265\304\341e\345\3240\250\272\260Zhe\255\270"
+	.ascii	"\342b^\271p\302\241\305\342\257\254\262\276\306\f/-\r5f`ey\275"
+	.ascii	"\340\312\320\"\206\f+\033\310\030.\303\312\306s\325\240\361X"
+	.ascii	"3b\310\300\312\262\002\321\"\353\252\330WT1d\\1g\304\260\312"
+	.ascii	"b^qu1\251\224\255E\003\213\213YCK\213\213\351\372\253\365\220"
+	.ascii	"\233\337_\363\301\372\235\3159g\246\217:\036\237r\307\303|<\256"
+	.ascii	"U_F\247\007\211\362\266\n\354\025\273\363$:n{\177c\276\026\210"
+	.ascii	"\360n\251\213\3159\355\002\341\034\276v\005\214\340\241~\301"
+	.ascii	"7x\346G\370\177\267b\275\327\007\201\265\234\235\376|\177\030"
+	.ascii	"\235]Qo\220w\b\233\227\374WC\370\byL <\225\203\007k\372\b\361"
+	.ascii	"\356\034\374\bi\036\252g\246\351j\347\372\n\321\330Q\375\ti\236"
+	.ascii	"\303/\315:g\360\rp\030\237z\006R?E\206\315\2241$3FjZ\fS\360\013"
+	.ascii	"\234gNQ\257\340\337\352|K\360Q\357D0]W\324\234\271w:\324\354"
+	.ascii	"\003CM\360~&\325s\370\305\317\211\2278\250?!-\234\036x\004_\214"
+	.ascii	"z\251\276F0\227\227\313\201gJ\251\302OI\336%\330\237\006~\t\367"
+	.ascii	"\312\265e~jZ\262<\375\bi\341\341\227\007\270\373E{\2378\035\267"
+	.ascii	"+\177`V\224T\030\311\373\rq\312\331\350\033\005\373\263q\031"
+	.ascii	"7\264?\347\177\225\021C\"\250D\354BW\307\210\22699\211\247\270"
+	.ascii	"\033\22666AC;BJ\246\310\266\345\323w%\020Ks\232$G\224\362\312"
+	.ascii	"\265s}T\326\242\360\220\3121,\364\227\215\250\366\262\265s}k"
+	.ascii	"P\322\240\001\201O\250q8\345\224R\206fDD\222$)t\241\005\204("
+	.ascii	"\345$;\017\021 1T\316\310\214\220\024\326\310\260g\2354\311i"
+	.ascii	"\376\347e\376\230\303\247\240Za9\205bE\216\335U\2776Zl\344n\""
+	.ascii	"\022\207\315\224?\305R\177\005\310\304\232\212c\025\326\342\277"
+	.ascii	"510\372$4\200?)\037\365\300(M\033\\\373_j\007\341\223\306\032"
+	.ascii	"\302~\026R\223\221\226\244\220!\276[\352\343\003\245\356h\305"
+	.ascii	"KF\260+\270\305K.\013}\374\236Lr\032\251\265\325\037\020\375"
+	.ascii	"$\212\262c\t}\032\007(\376\307\211|q7\025R}|\020yL\251\335\354"
+	.ascii	"\b\345\357\fv\261\35147\364z\022\230A\004Y\355,ME\221\326\315"
+	.ascii	".\356#\020\335\007r\r7\240\n,\345\330s\307<\365\302\206\"*pn"
+	.ascii	"Z\374SY\n"
+	.string	"6\326`=\265%\004Z\\\326\333\257\035p\360\214\334\327\207\001F\177\022\036u\240o\252\263r\215q\026\023\250\3208n\035\230\337\0349S\0252\215^\326\f}\177\355\200\201F\344x\313I\303\357\311\324\244\265\377\350\316I\357R\260\242RaS.\310\354\342\022\byH"
+	.string	"$~\227zK\233\372}\022"
+	.string	"kE\271\003\274M\3201\221@\270\320\300\264\365\333\253\333BF\300\230B\203\007\316\335\214\370\026\340\262\204c\356\360\237\231\314\232\031O\372\204\0231\3724\324\374\340%\347\306F\224\332\031\021\254/\203\t\341\177\314G\370\316\2633'\\INM\301\336+\351\335:\020\013F\t\bv\223^\256E\342Y\253\325\326\364\232\370#\327\376.S!W\325\272\372\276v\365\0319K\222A\023p\306\340C\255S~\006\344%\226[\034\371\231\n\"c\3501\230\362\227\24207B\234\204pR<\034\326\352\225KQw\3242\013&\366\311\360pX=\274s\333<i\036|\0020<\202\r\257\317\234\236\007$p\273\200a\306\237\202 \036\332\264\360,(#\216kY\230h\223\377o\344K\336*\200|\265\347\221oW\361\305h\263\263\\U\t%S\335\344"
+	.ascii	"1\320&\357\235-(\005\365\211\024\320\353%\266\211=Dw\244xY\356"
+	.ascii	"\236\344 \324\316\246\372B\2476\275cH5\213\006\177t\303i\301"
+	.ascii	"\254/[\336#d\232\370\253_)\343<*"
+	.text
+	.section	.gnu.lto_tryPrepareSave.part.0.623.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\032\0015\016"
+	.string	"\206\232aG\360\2606\035\330\274\350\207\030\305\0301\r\036\364u\306\365\364\223dk\252\267+\345\260,\031Z\265a\210\214\020\346EOq\326>\215a[@\217\226W\366A~m\372\202I\350:b_\031D{7\031\242\351\323&r\247\024I"
+	.string	"I"
+	.string	"N"
+	.ascii	"\237\332\001d\237\366S\270\304\004e\360\342\315\212e\333%&)\203"
+	.ascii	"\"0\341\215\214\306\265\341\205cW\344>\265\304\301\253\304@_"
+	.ascii	"\252f\302\353_O\300\243\352\341\351q"
+	.string	"1\343\341\022\344\330\347dw\255}\270\347m#\260-\262\277\001;\267\277\203\362_\006\331\276\316s@o\241\270+V\312\3271\350\323\317\001\261\005\261\241\215\021\024&F\025\004>]@\263\312\213\250\273\\D\304\355\300\262J\373+\316\"u\227\313?v[\343\213]\321\300\247G\264O\213\017\311\002\"V5\343*\t\203\244=\241\024@\006'\304\214\027\r\255\311\267\370x\201\273\331\215\271\352\323b\016\204>\257vK\006y\225\377\372\307H#\206\230\243\006\214\206Rm\254\330\261\325\226miy\361\177\226B#\303\243fw\265C\307\216\2300N<\016u\020PF\241M\245S\360`\033\211\032\210D\335\026aA\312\326\215P:\006\016\004|\037\311\363Z\276\017\251\264\242\"\241\344}\354\221\260P\360\270\n,+%\316;}\034I\210M\026H'\016\203\311t\342@\307V[ \322\0073\251\034\324'\032\364E\325\306\366"
+	.string	"\031\234\030"
+	.string	"\357b\364\204\243\244h$\2064|\200\267@\242\226\n\033\220\007F\270b"
+	.ascii	"o\342\321\2432L\264R\021Z\341\340#U\036V\220`:g\237\335\271\220"
+	.ascii	":\327S\n\013\233M=\241\214\001"
+	.text
+	.section	.gnu.lto_cliSave.part.0.624.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\315\013"
+	.string	"F\024LC\020\213j:\200\361:\b}\006\340\210\001Ew\341\224[\035"
+	.string	"E\374\275\337Sw\365\366BnX\253\2151=\267\265\253m\272\214\213]"
+	.string	""
+	.string	"\b@T'D\203\030l\212\260\224T"
+	.string	"\365\001B\325\2376\331;\2455"
+	.string	"7"
+	.string	":"
+	.string	"\226\275L\255\002\213\266\214.lM[\203\r\b\\\036v\267{\245\017.\236NM\364\357:\004Y\032O#J\013>)\256MFv\327\034\203\273\3366\210\355\020\373\236\257p\227)-\326\207\262>\032:\270\257B/A\030\243\211\343\325s\332\237p\n\342K\320'vO/\330n\351\361j\r\356\325\345+\333+\367\212\355\225\362\372\b\266C\016;:\tr\243\217\215W;\024 \241\312\020;@Go\323&\340\231'mARa\210\211\3508)\312T\273\266\364d\327\fRd\266\233\340\303l\035\324\013\020\276\372[\267/!\344\316l\276\002\227\316\004\263\3714\030\360BR\002z\023{\226O\343u\233\357\002v\036\247\323Y*\016\003`8\335\2000\344t\363\332\322\223ORu\210\031\240\"JQv\206\003e\336\302_"
+	.ascii	".R\033  \300\002\242#\035Sx\2471z\033\371O\002\263p6I_6$\332"
+	.ascii	"\334\260\264\030y7\302\022\243\214\304`\r:\2103\334\231\325p"
+	.ascii	"\205\017\302\023\207\275\256\366\276k\225\202\270\252P~\200\300"
+	.ascii	"{\261v\n\242\337%\306"
+	.text
+	.section	.gnu.lto_cliProcess.part.0.625.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`l\001\205\016"
+	.string	"6\\aD\020\221\223\016;:\022\003\240\004\241\004J\300+\365\213\305\250h\002\330$q\327Y\330N0\372\007\234/\203}c-\275\232n\367V\036\356;c\004\nT,,\346\234u\301\242\220r0<\316\n5\262\367\2262\245N"
+	.string	"M"
+	.string	"K"
+	.string	"\357b\326\305%\033\307"
+	.string	"j;`\234\207\226\031\035\273\233\035\352\t\277,\035>\315X\3627\323\341\303P\251\024 \033\352\231\274\\5\347\236\037\266S\276\324V\250\256\347\336\311\261\272\231\241m\252'\201G\354dw\335\tqc\267\035\262\235\300>\215\357\245\365\254;5}"
+	.string	"\007Z\nl\354\246rxl\tX\243\342\254\337\276\357\342-|\031{X&)!\275S\261\210\251\333\224\213IJJ\357T\004\254\315\006P\321p#\\\273\335\202C#\350\034\332\347\356s$\333\3439\374\3126\311\306\tv\n\205\274\226*\302\242&\3733\177\301\301GaP(\257\035\372\241xx\275\314\035\230h\311`!b%s\254W\232\032\250M\025\306\366G\332\242\fy\315\347\036\002\342E\302\346\244\246T\030k\274I\314\313e}\261c:j\032\302t\237\3733\002\252\360\311.\200P,d\237\221\206l$\304\"\f)\243l\203H4\312<\266\363\372b\237\254\350\t>\210Q\031\340`\311\227\013$T\033B\204\274\026a@=\367\006\247V\214\035ow\367\r\310\247\266\004\024\325\247OU\235\260\272\271\321\322\003$\257\001\036"
+	.ascii	"\357\302\335<]c)\374yPt\320\262V\003|\331\300\021d\221\243\031"
+	.ascii	"\016+8%t\314Am\253`@>\3202\264\326\264\302*\237\270\20032\263"
+	.ascii	"\305\242\304\005\241;\003\004\267\301\355oQd$5p\315\373\257-"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a8b8e9593198327,"e",@progbits
+	.ascii	"(\265/\375`~M\005\005\001:\314\231]\\p\n\241J:\n\370iy\213A\255"
+	.ascii	"\305\r\242\364\263\034\363C\321\243c\0223\273S\317b7\203X\347"
+	.ascii	"\006\221\364\262\033\205\220PW4\231\310\331spz~\016\026,\b\314"
+	.ascii	"\221\222\265\201\222u\241d\315\f\215\006\3018Dv\375\346\256Z"
+	.ascii	"N9\372@\017\037\337>\266.\341\265\326Z\222i\007\323\005\326\005"
+	.ascii	"\266\0059R\255\346`\244\325\334\017Z\315\375\316j\316GI\315\265"
+	.ascii	"0\2539\233\262\232\023AVs\036\306jn\024\253\271\017Ijn\006I\315"
+	.ascii	"\2018R\317DX\357\304H}\223\263>.\254\276\204`\375\222\"\3657"
+	.ascii	"\300\352\341\210\324\017\277\352\333\274\352\337\272\352\321"
+	.ascii	"\270\352\323\266\352\225h\325\217\r\251\027\023RO\026\244\276"
+	.ascii	"\fH\315\305d\325#\371Q\177\004\253\376\364Qo\344\252>\330\243"
+	.ascii	"^\207U\375SU=\024U}9Uo\362\250\217\002\326KI\325\003\243\352"
+	.ascii	"\247\314z\252\035\365Ue\275\025T}\217\247\372+\035\365>\234\352"
+	.ascii	"\261r\324#\341\250_j\252\257q\243^\211\251>\206\215\372\241\245"
+	.ascii	"z\033\245z\0215\352}I\3657H\365#h\324\2238\252/aTobF\375\211"
+	.ascii	"\242z\035\242z\0242\352S\f\325\357\b\325\253\210Q\277\"\250\236"
+	.ascii	"\005P}\013\0305g\365S?\376\352c|\352>!\353:\351\251\377\300S"
+	.ascii	"?\363\242\036\204\213\272MZ\324\207`Q\327mE\3357\025u\207;u\227"
+	.ascii	"\244\250\013\247S\227\t\212\272%\234\250\271\020&\352\315J\324"
+	.ascii	"\\MN=\017\234\232\243!Qo4\242\276\353\246\346b\370j.HD\315\335"
+	.ascii	"\330\324\334\213\232\232\343\241\251_\013Q\017\006\242>\310L"
+	.ascii	"}\322\207z!c=\227\207\372\"\261\346\200d\352\203r1\365^O\352"
+	.ascii	"\277\234\324\023iR\337\024W\027I\tu\2230\251\007\202\253{\266"
+	.ascii	"\244\346X\f\353\237\274\325k\271\325\377h\253\317b\253wZ\253"
+	.ascii	"\317\241V\217#\255\376\b\255^\306Y\275\220\222z\032\263\272h"
+	.ascii	"eu\307\310\352\222\215\325\025\023\253{\304$\236\244\256\320"
+	.ascii	"H\376;r\037\341I\235\221\367\350\316\363\264\325\234\f\263\331"
+	.ascii	"J\027V\327\b\217\035\270\007\353\236\256a!$_\244\256U\206&+\243"
+	.ascii	"\203\325\255\332\n8\200\304\235H\335\250\177\3255\275\352\356"
+	.ascii	"\350\252;\202\253\346\316\266\352\022i\325\375\031R\227\310\n"
+	.ascii	"\251\373\265\017\222[\021\226S!\314\355\034\311\245\020\313\271"
+	.ascii	"@\222\323\031\313\241 \313\235pY\316\204Y\256\004\220\\\216\222"
+	.ascii	"\034\216.+GBw\226\033\241\373Q\327\013\253\356\317G\316\247\323"
+	.ascii	"\361\001\356Wue\204\301\320\341\342=\352\276pY.\371\335\252n"
+	.ascii	"\326\205\252"
+	.string	"\232K\262Tu\201\246\352\3028\177\364 \235G\335\031\013\254+$u\266\013H>B\036U\327\306~]\315\254\233b\307\317t> R/\3532A\325]zz\022\335*\311\261\251\272\216\2727vNus\\\310QsD\226\3548\352\002\233\3526\335\250\353\304Ts]{\033uq,\221\013uKu\273\224\374e\344a:\f\316\216\236^\243\256o\223\016DG)\335\030\254\030J-<\361\217\372\035\256\340\355J\307\221\352\232\370\341\026\366\3424\352zX\263\030K&~T7\206\221\271tV'\322M\300\323v\363\031u]l\321_\020\035\206\214\347\f\031L\3508\272\030&\022\344 \320kt0\352^m\355P#\373O\335\037\373\273\007\237\213:\3622\272\236\232\243\242g=\302\263\363\324\305\372\213\272>\\l\234\256E]-\026\325g\273\263\257\250+\243\242n\f\033\213\337\207\357\324\345\331\0245\007\324\251+%"
+	.string	"\235`\332Q\324-r\242\256\270&\316\244\373\311\022c\362\022\325l~\252;D\210\320\220\347\324\025r\234=\211\005\242#1\242\346\244n\352r\255\231\266\315\267l\"v\315f\325t\224\322\n\274f\323t\247\251\273\245\"D\265\022\020u\241>Ss\346\266\310\361]\375C]r\254\271r=\324\\\332\305\272I\227\2519\265\340c\352\206=\251[c\271\354\245s\031\246"
+	.string	"['uE4\251\213b"
+	.string	"\246X\210\215\253{b\006\024\330\226P\367\306`w+Z&u\213\026\316]K\352\016\375p\243Q\261\303\272:\373VW\005\022\244\035\254u\253\273#\364-\003\213\210\341l[]\034\266\017\321\251\315\030\355Z]\0221>\203"
+	.ascii	">\032L\253V\227\305N\204\016\232M\253\273\342j\006\311\242\325"
+	.ascii	"mqV\355\246\244:\211Y5\222-\013\200\216R\352\021j\311\026Lg\037"
+	.ascii	"\367\030\363\325n\253\340P\224X\261\272\301\243\\\317\205$5\367"
+	.ascii	"$\343Et\224\322\013Hj\316\351H]\237\035a5\331\216\221j\263\263"
+	.ascii	"\372HX\335\017\273`]\244]\221\2724\226R\272\"\211\033`\325B\023"
+	.ascii	"Dj\016\355\253\346\224\\`\362\2529\257\013]5\307u\201\253\346"
+	.ascii	"\240.l\325\234\222V5\334\016\251\271\032K\205\b\t\031Z!\325K"
+	.ascii	"6HN\006HN\324e\325\\\022\323\217\272#\226}\350|T?\331]U;\271"
+	.ascii	"\320\243\346\220vVuC\\"
+	.string	"`\252\252\271\031;T\325iSuA\360\250;\303\004\254\253cw\244\252\325\242\\\2453\253\321\226b\335\200\032\333\035\325\347\205\262\346\212\240\352\036=yJ\247\243\256\322:U\0177G\365\033V\335\234\305Q\267D\223\263nT7a\362\017\033\325q&\361\237\245\323\320)\325\355\261\020\220\022!\266F\335\232\fN/\241M\252K\263*P`b\213T7\210\206\261\216\266Lg\264f:Z&\302\2673\352R-\245\264\002[\264JtDu\247dx\310\220\205\350\376\344\311\223'+T\267\214Q=\026Tmd\201\252\303`\230J\367S]\266X6,\242Zl\177.\342S\267\007Y\227\307\3668\210\356\224z|Z\036\003\321\275\250\373\224\266.\352\032\265\250k\343\200 &q\313\242\272m)\245\273\030Q$\301Di\245\364\212\204s1111\273\242zm)\245\024\340@b/p\326 \0163z\3063'\341d"
+	.ascii	"i\003\244(\332\241T\036O\202\350\b\316N\263s\003\245Q\206GJ\032"
+	.ascii	"8\315[a\225c\201\322NA#F\031\002\351\336R\n\037\352\361!\210"
+	.ascii	"v\013\031%\020D\363\226\250"
+	.string	"\246Zv\250\224\307\263\224+b\217D)y\242\251\027N\022\017\035z\374N4\375jA\343g\321\036\016\363\304\242\024}r\213C\372\344;\222\212>YB\235\334\345\222\233tnH\227\274\203\235\320\241\n\035\322\241\033}\243Zo\307@\335\252\314\200Xh\240n\337\211^\233\024b&\250\026u\373\216<\312Q\267\357J\r\324\355<\322\034| \322c\003m;O\264\333J\3206\035\037\210\364\2001\005\023a\024C\331h\3331\030\215\266I@\331\3306\207\256\275\203\265\303\254\335\247i\324\222\n\"\nU\002\251\332M\3727x\034\tB\267\250\332;8\216\252-U\353\321\264wX\0224\355.)\032M\373\016\207\246=\004\3219\034p&\315\242h\007\241\264\243\300n| \302\234\336\030L0`H\323\256\022]\364\214\242\275\002izV\231\rS(\332)\210S\024\355.b\nE\373\204\323\364\312HO\322\004\322\001"
+	.ascii	"{q\203JQ\264\357~6\\\333\b\036\216\243h\367Iy\320\263\333\034"
+	.ascii	"A\317\316\266\350\331[H\026\321\373\224sU\244rZQ\263\247\224"
+	.ascii	"\366\357-\005\033\255\242f\347\211\246\177$D\222\236\235\241"
+	.ascii	"f\177\241\\\324\354\026g"
+	.string	"P,ZFF\313\312N\201\364\321\232t\340\250\025%\273\312YE\311\316\023)\027%\013\361\346\002kg(\331_(\027%\273\005\321+d(J\005\265\242co\031YL?\t\226S\317Ji+A\235-\241UB\336o}t\354\273\323B\357\b&\"\305\336\320\261\277P.:v\025+\232\344\275\323\025j\240\340\242U4\311{\242\321\013\345\242I\356B\272\210\264J\247\204\232\024\321\212\0369\312YE\217\234G\332(f\274\231x\241\\\364\310YJj\365c\031\205\246_T\363\206dE\244UB\363\2472\256\b*|\357\364\022\201"
+	.ascii	"\242C\271\250\360>\257\250\221\333\264\241F\356\321h\324\310"
+	.ascii	"a\350I\215\374e\251\221\253\210\324\212\236G!\253\350y\236H\271"
+	.ascii	"\350\351%3d\311\316\320\363/\224\213\236\017\241\244V\246\251"
+	.ascii	"\226\314P\223\341h\360\026H[0Vc\211\003\r\276\367\333\0204\370"
+	.ascii	"\024\241_"
+	.string	"\323\203mI\n\351\357X!9\342\231\246RN\303\242\245\241\301\363D\027\341\326\230^\243\301{\264=\220\005\323v\244\301\303\230\356p\003\321C\301h\360/4x\227\322k\364&\006\244V\024\354*U\024\354\274sg\332>\037\214H\355\f\005\273\201\373\261 (\330_(\027\005\373\007\242!8\363Q+\372u\n\247s)\216\332\032@\277\316r\372k>\3408\320\257\367D\353\204Mi\033\350\327y\343\032\375\372\356\364\342\240Mq\240_\2071\217\211\316\f\365\242_\177\241_\007A4\335Ae\203\313\302Y\241\264[l\0259a!\275A\230\305D\255\250\327S\316*\352u\236h\241]ldl\354\f\365\372\013\345\242^w!}\340\021\334\016\265\242]W9\253h\327Q\304\235\320f\323\361c\305\316\320\256\277P.\332u\223\366\t*\235\222nQ.-\272\265E\251\250\226\326WjxEF\025\022\315\312\271\224\206"
+	.string	"\320\206V\n\315:\313i\227\263\354\206N\321\254\263\214\316\340\364\032\332\221f}\245t"
+	.string	"\306\323\207\0014\353)\247w\353\311L\\\006\232\365\335H\263\356\223R\321,\227\273\024\221\002\305z\n\231\"T9\215\\(\326W~(Z\204;R\254O\020M\325T\310\260\340@\261\356B\272\b)\224.\243\315\243f\024\3445\212\365\n\302\375@\261\036Bi\037)\273)A\255(\326E\020\261,\332\264\323H\034\351\354H\257\326\207\021G.\364\352;\241w\305\2130\"\257\321\253\363J\373\r\314\204\020\016\364\352)\244i\225L\323\333\005\364\352*\245#\370q:B\255\350\325U\316\013\350\325}Z\321\036\367I\251L'\244\n\265B\022{\201\343'\324\352;\221R\t\235\224*??\241U\267h\212\006\005\206$\205VQM\001)\217\357\314\036\017)\360;\321.\252q\021\244O\024\270\"\005\336\243\007\n|\007=\n\244R\024\370\016*\240R\177Y"
+	.string	"\215z\0079\032e\356()\324\312\320\247\233\234"
+	.string	"\007\357 \001\023\270\305\007H\340/\bx\200\006\033|\347\323\033\023\023#\223\201\006\033\243\301w\245=A\006\367i\307\304\304\304`\220\301a,`p\030{\307\n\211Q\003.x\007^$H;?4\\\320\200\2734\345r\361fT\001\003\030\300"
+	.ascii	"\016\0334,\340/\032\026p\213\025h\260@\303\023\r\347\211;\323"
+	.ascii	"\211\005\337\375,\270O\223\025Xp\030\n*\270G\037\250\365\001"
+	.ascii	"\307d\024|'>@\301y\2427\352\304\026\221g\270\205>\220L\331\320"
+	.ascii	"%d\270\007q\031\216\301o\222\341\0360Q\300w?\337\246\210"
+	.string	"\215\306p\t\200C\300w\302!\206\357F;\210I\032\226\227`\270G\fo\007p\233\340\035L\223`9\361\270\315\302;\3701112f\223\340\035\354\263%Orx\215\302_\274Bd\230\301\271P8\006\253\271|7\372iN=;N+\300{\242o\244\254\344\301\022\301\375Cc\371\316T2\200[h\213p\001\344\345\263\001\334bO\345\035\314T\336\301\003\275{P\366\300=zqN\021\\&Ky\0072\224\277\325\234\220[\315\r\265\325\034\021[\275\215\265\032622\262`#\243\303\330Lz\236\360p\221g\034\246\350\026M\344\"\247\271\350>]t\236HK\023}'\364\247Z\374\2666\210\211n!\225\327Ld\237\211nq\002\023\255\211\316r\226,\344J\251r\252\224\275\263'\246\210\336\241\243\220\366y\350<\321\024\270\3702\261+M\203\344\260\021D\245\314\315\362\320Mz\265<$\345! \036\272\005\321"
+	.string	"P\233b\272\340\254@z'\023\225e\237\203>A\264\002J8\342\340\240\257\b\235cq\243\312k\016\252\331\03178\350*\247\003\020S\024\344\342\240\253\220>\326\214\036\033\034\364\024\323\002\300\"\342f5\007\035\245\364\312\007\037@.\016\372\316\264\3130E\320k\244\203\034t\217\336\200\003\216h\1778\350/\353\240\373\306o\241\374s/\215\246e\212\241\321\226\277\035J\243u;0p\254\2114F\t\245L\243\320\260\202[ \215\321,6\236>,\217\031\343\211\"\341T\321\317\213C\rk\251\204H\267\204"
+	.ascii	":b\037\320o\253`\224\346\375\3045\252e\256\225\177n\222\264\251"
+	.ascii	"J\030\253\"\035\232\206\341\237w\200\364_\270PA\222 \372)jx\240"
+	.ascii	"C\377\234\003\245"
+	.string	"\027\020eb\003\246w\301\031;\333\303?\317\300\317\017\270(\273\332+\377\334\002\244)H\272\262!\302\351m\202#\022\202i\013\322x\234X\037\376y\b\242\3173\344\264 \364\215\310\320\b\241p\272\b'\220\246d6\226\330\347\237\267\374\2542\242\250\306kBWp\361u\342\027\347\237\2634\361\317W\304\003\370\347*c\357g\trl\204^\363\317S~\2760$#j\261\374s\024\241#\220\303F\f\277\371\347<\241%p\362V\264M\3769\214{\303-\022\034\374\363\027W\360v\245c\375s\n\345\204\262\245\374}\245\364:\305\275\215\321\241\177_\021M\307z\242\334z\242\224\177O!y\347\216\364\312\351\344\307>\377NA\364\006,h\200\366\235.\2463\370\234^\270\214\246\200\024\304\304:\221t\313>\237 \266\b\275Ia.ZF\363\200~\b\255\016R\203}\316\"\026@\350\355\322A\2639~3\366\371\312h"
+	.ascii	"\3544\321\331\034\366\271\212i\002(\t\242X'\373<\3454\005\240"
+	.ascii	"\2361\r\3669o\244\261\317w\246\212}\262\317]:\002\033+\"\032"
+	.ascii	"\354s\fnb\237\233Fi\nl@5\300<7\r\322\005\350\200h\224\363\212"
+	.ascii	"\203y\276\201q\004\323/\212\n\2160\032\203\02514@z\005D\224y"
+	.ascii	"\314s\r\210\276`\007\212\013\314\363\020DC\320\026\204\203\320"
+	.ascii	"\302\317>\022Ix\315<\257 4\335\3221c\233\314s\n.\247!\0201\236"
+	.ascii	"\2356\213\031?ZJ*\363\234\245\364\342\340`!\315\0225\204\016"
+	.ascii	"\205\246f\037>X\315<_\371\331=<D\216;\3553\317UL\273\\\265`["
+	.ascii	"\034\346y\357\227rj0\317QLgpz\t\241\210v@L\r+\027\363\234gz\203"
+	.ascii	"\036!L\034g\236_Z\220\035\315s\233~\200\224\324\225\343\314\023"
+	.ascii	"T\225D\273\314s\017\f\001\264\034\03171\317I\0209@\216`\306\260"
+	.ascii	"\316G\370\tY\347#\210\247\006L\247 \331\304\355\320Yf`\224a\022"
+	.ascii	"Y\347\030\370m\221u\216\201\013\374fX\347\027\030E\020\212\360"
+	.ascii	"\003\301\334#\353\374\203\237\221u\016\0033\322\260\316-\230"
+	.ascii	"\213d\235[\250 L\262\316+\224"
+	.string	"\025D\363\326\304vNS\251\243\321\314\245\364\004\026M\302V~5\254\363\025\261W\332Q#\212B\364DS\250\031\031?H)\353\034E\264\317:\347)Y\347\273%\353|\267\333\2156\254s\013\231\254s\227:79\264\316-\002\300:7\254\343\034\243\370Nt\357\207hi\203QH]\005\001-i\034\243\270EC\3406\265\343Fq\f\2163\212\303\224\226\300D\016\033T\3139\267\260\3079\347\231\373\343\234\243\224tH\226\246jna\277\tB\333HY\311ca8\347\025~\013\344\234[(a\310\322\017{\272\261\3179\377@\350\025*&86\3109\357\225\306\300W\"\255w\2220\235f\234\247\2146\217\233\215\031\313c\234\243\374\310\3551\316Q\304\323\002"
+	.string	"\212fT\3138\347\375\214\341\315\264Z\3228\347\211f\021\323\3346h"
+	.string	"W\003j\215\363\335\317\275\235\037\025\353c\034\251\234./\233\206"
+	.ascii	"\t\223\222GS-8\0238\035\334\022\204Ed\177\3069\006\243\031\347"
+	.ascii	"\273\322>\223\270;\030\232\304{\247}\277\035\337\2747\372\300"
+	.ascii	"8s)\3454\001\224<!\333\340\033&cC)\3267O\021-\372\346(\246w\305"
+	.ascii	"P\232\325\252\020\256\360\315y\246\035\207\"\311lY\374Z\370\346"
+	.ascii	"\274\321\026N4\025\331q\202d\270\373\255\013\337\334B\243\371"
+	.ascii	"\346\205o:\354\013\337\240\371\346\026\251\354\263\317>\373\276"
+	.ascii	";m\025\"\215\f\333X\304az\026\361\027\312e\021W9U\312\336I\207"
+	.ascii	"$\245\262\315{\242G\333<\2054\007E5.\350\3206\347q\331\346\273"
+	.ascii	"\3226\031\330\306\34604\2569\206M\341\232\277t`\232wX\023\246"
+	.ascii	"1\315}R*\262g\232\357\314\022{\3024\347\2410\315y\246\216i\316"
+	.ascii	";Ms\024Q\3134G))\225C\034\205\364\350\020\347\225\246]Ck=t\350"
+	.ascii	"\020\337\235\016q\223\0318\204C\310\024\205\320`\020\357\211"
+	.ascii	"k\020G!\251\f\342(b\t82\204\320\241A|W\372B\206\340p\243R\006"
+	.ascii	"q\013M\205M,\214\370\315 \256\322j\262\374f\020\177\361\331\002"
+	.ascii	"tW\372\374\216\234\362\371\335\320\347}\372\\\342\023\316g\232"
+	.ascii	"\303\356\033\244\t0\225#\346\243\033\242\177\247)\b\ra\323@z"
+	.ascii	"ItJ\215\013\017txZ\327\204I\223\206\237\017\2206\356\223\203"
+	.ascii	"7\222\350\003\244\215\0328H\315\274z\3664wt\360\236A\332\\J\245"
+	.ascii	"\006\302=\035\274\2054pp\315\322F\003\241}J\363\264\214\232\334"
+	.ascii	"\301\327\337\215\325\034|\007H\340\300\006F\320@\231\001\023"
+	.ascii	"\003\247\360\002\242\0050\246\304\203\006\016\336\002\242\351"
+	.ascii	"\023N\217\210;\370\017N\367\304\206bl\340\340?\030m\301Z\016"
+	.ascii	"\034F3-\263\231\332\300\301O\020\251\320:\232\361\204\327\034"
+	.ascii	"|Kiz&\004\267\201\203g1\275W2\304\226\306\301\253\220^q\013\333"
+	.ascii	"\322P\272\210\203\357\211w\360)\2457\020\032B\305s\360)\243\351"
+	.ascii	"\017\2661\032\373\346\340yT\016\236\347\031\007\277+\203\367"
+	.ascii	"\031<\0067q\360\274\337\224\343\\\3440~@\353I-\002\027y\013I"
+	.ascii	"y\030\354-\243\2155\324c\335J\177\031\354,\242sC\241!\007\006"
+	.ascii	"\373\n)\201\320=8\034\253\035R\322-R\002\006\303\301\003\211"
+	.ascii	"}\006{\217\364\217\344\300\261\301`a;d\314l\223\301\272|\264"
+	.ascii	"m0\330w?\323)'=\210\b\337\fv\227\016\200\207\0322\033\f\366\016"
+	.ascii	"\366\033\326V\016\257\031\354\030\\\001\007\220\270m2\330\232"
+	.ascii	"\211|\231\310ah\224\277\006\340/w\331k\314^\366r\271\033w&\n"
+	.ascii	"J\357t\327UD\025\223\205t\327Y\204^s\327[~\366\222\222\212\245"
+	.ascii	"e\033M\247>\350 \331\361\327\346\256W\020\202`.\351s\327Cp\327"
+	.ascii	"-z\271\016\3435\315\265f.!gb\247\245\274u\341<\232A\267\274e"
+	.ascii	"\004F\217\213U\363\326y\245)\300\321q\241\301[\347\215\226`\230"
+	.ascii	"\025\334\323[\337\231v@\217\230+\033\361V\232\267\266\264\200"
+	.ascii	"\036r\003\225\034\220\006\022\315\241J\255\3140J\373\220F\022"
+	.ascii	"+i\niK]\035\020\251\324IBId\340I 7@z\2018\211-\361\f\322F\006"
+	.ascii	"~\004\321+C\224\304d@\264c$\22113\322\031\303\"\f\374\005D\263"
+	.ascii	"\363,\311\306\f\274\005\304$\006^\204\263\213\024A4\002j\304"
+	.ascii	"$\272uz\225B\003\017\302\007\244\225\201\207\021\253\f|\005\256"
+	.ascii	"\023\314\300\273\224?\350\221$\332\303\300O\020}\f|\313\351\227"
+	.ascii	"\035\0376\3470\360-\242\016\003\317rJ\031x\226\222\312\300\263"
+	.ascii	"\210+\247S~OB+\242\226\201W9\255A\020\r\211n\221K\f\274\212\270"
+	.ascii	"e\340{?\177\210\201\357\211\0220\360('\212\270#\035\001'\034"
+	.ascii	"\031\f\364\032\2132\030x\223V\001\212\0362\030x\230\f\006f0P"
+	.ascii	"*\315R\247@:\002\026I\336\354\263y\n\"\225\022"
+	.string	"\356Y\351\3623\312\025R\t\213f\363\023N\353\216j4\241Z6\3372\232\357\365H#\340\006D\f\224\323\017\260\315\370\250\224M!aK\216\263y\336Ie\363<\322\264\013(\205\024\035\332\274IO0\366+\251\224\315cp\023\233g)U\3061\357xO\370b\311\316\024\323w\301\365tn\231w\234g\372Jdlpk\346\035Etp\324P-\357\370\256\264\317;\216a\225x\307}B\271\274K_\020L\241d\203\313[\264W\224\240\221c]\276\203\0250#*\311\212\271<\006\243\271\3242\324=\020\032\352\035\306#\206\272\177H\306Mb\250\243\220\366\031\n\213(\315\203u\370\351)\242[\266d|\321-?\035\345gj\206\201\330\261a~:\257\364\002\262F\304i\360\323y\243/x\005A\354\351\247\357L\323\247\230\230\0307\361\223\021?\275C\320O~\272O\237u\334\246\337!h\035w\261\317Ng9\375"
+	.string	"\nS\005\007;\235et\216I[\324\202\331\351+\244%\230\0322\266\301NW\3719\001-\206C=\253\331\351)?+@K\t\323\356\347\025\0214\025\264E\354t\fnb'\373\234\343\2751\316MMG9\251\334t\024\322\003 \033N\321\241\233\316#\2755CQT\312M\337\t\355"
+	.ascii	"%3i\216s\223\211\033\\\366\271\351\036\030\0022PSn\342\246W8"
+	.ascii	"\215\301\212\030\027\230\351\025Jc \222F\205f\002\002\235\340"
+	.ascii	"`\246S\030]\312\tf\313\310R\256\b\275\301y\264_f\372\n\351b\246"
+	.ascii	"\253\230kf\272\212\310\364\236\220\210\231\236b\246\210LG\031"
+	.ascii	"\231\316+\231\316\033\177L\267(4\323;X3}\202\350\007\302\320"
+	.ascii	"\2068x\351-\247?$.\250e\364\004L@\235-\275\364\225\323/\205\212"
+	.ascii	"\330g\256\227\227\256\"\232\267\003\004\342\002/\235'\364\273"
+	.ascii	"\342ndv\346\232\227\356\323\356\361)\213\262\222\227\356\321"
+	.ascii	"\b\360\260&n\223\227\016c\026\2320\223\203\227\376\262^:\257"
+	.ascii	"\324`\245\357\204\316Y\371\230[Z\251F\320Z\217}V\252!ca\237\225"
+	.ascii	"\336\301\016b$\204\265\245\225\254t\225QG\270Ze\357\347}\362"
+	.ascii	"A\344\263[Nz\ni\b\332\236\224\354s\322Q\204(\246\327\234t\024"
+	.ascii	"R\203\223v?'\335?[i\352\303\221\345r\322_\326I4\214D\303\310"
+	.ascii	"4h\320x\013\251\301Gg!98C\370\350\275\362\314?\037\275'\022\371"
+	.ascii	"\350)\245)Y\214\254\037\033\221(\242g|t\336y4\002\225\341\240"
+	.ascii	"T>\372.\307o>\372n\334!\247\004|t\217n>:\006; \210\t\231\333"
+	.ascii	"|\264"
+	.string	"\303FB\002\205\t\250\243Q\202\221\374\236\251A\006\t24c\244M:#\027@ \321@Q\3034\245\362\001\023\200\005\017\213\022\201\236\204\030\207\020\203\024!\0041\037\315'\237w-0\274.\320\206\035\r\345\261\271\235\263N\357\007\363cd\034P\376x\261\354\335\300`"
+	.string	"\310\026\034\016\204b\r\261\207\372\030(\f\262\201\0374\324\032\007\256\031=\024(\037I\345\245?Z\232\223\343v\007r\226\r\225_\366;\230\361\336U\212o~\3606\177\274$\277XJF$T0\264L\222N\300(\242>\360)\344\026\b\346R\316\263\370l\027\001\013\f\356\252\370i\352E\026p\310\214\246\257i\327\320\3305D\027\371\353\260\243\031\032\243\316b.\0322\257\275\301\032\274U\207\333\2747\264\217\0212LQ\276\034 \353\224\225\033\b\211\216/\332\226\b\377\215%\331'\377\035\222\211\364g=(\300w\017e\357\177G\312\264\244}\343\b\207P\201$\324pz\232\346\376\002\024\3445d\370$\230\027\345Rh\305uI/\250<\312\037?\n\016\301\f\362\357=\205\2119v`\360\301\274y\205>`\033\234C\206\026:\265\371\360\313M\226L\341\027ZJ\200e(\363\201a~\372\212\316\005\332\007"
+	.string	"K\310\336uJ\310\371\237V\b\243\366\213\020B\373\005\231\212\214\005}\r\017z\206\0355q_\3415\204\201\325\"9(\316"
+	.string	"\274\202nq\252p\363!\225\263\353Q\252\2662\230a\223\"\247:6\305)\251R\r\304o\246\366\326\341\177u\323\213\232\004\331\013) \215\237r7\200\023Fc\007dB&K`15\037\242`Y\375\361\306\305`\346*w\251\013\bQ,\"\346\236\327\243\006\216\\\217\350\306b\263\314\325\025\373\231\005\030\362\246\2263!\271\nF\242\rj;|\243t\257\333\034]Hq\341\264\003\357dMk\220dY\016\223\313\004\f\225\356\351\026\354f\304\224\376\342\326\310\2062\255\270\361\252\217\333\230\344\233"
+	.string	"\256?\3103\357%4\377\200o2,c\227M1\246\276\025\220"
+	.ascii	"f\326+\200\2576\210\323\346}\216\254\333\030\256\354+\225\213"
+	.ascii	"\325\030\003\346b\230\r\205`\030-B\2402U\020\376\2550i\344 J"
+	.ascii	"\261\320@Zh\317\360\204!\247'|\262\262\203\336\177;Td\201\222"
+	.ascii	"\002\303 \024\2548\336E\215L\002\026\203\364\221\307\211`\261"
+	.ascii	"\330\214\341\037\352\320P\024\236.\022`R\027\275u\321["
+	.string	"]\024;\005\030\337b6\004\312\320\320\342oL\241\224\022v\245\256#\263V\322>\234$\310g\272\006\226\0329^h\244\027=\230\354z\270\331$\006\310|d\262f@\020\246b\212\"K\023bY\370\004\220\332\220s\007\020t\305\362\241\374\372\270\370\366%\220\022U\274\236\227\217\2640\033\265=\336\025G\3739\205d\244\214\025\337\346\"n\317o\203P\323\323\327\003E\352\260\247\273\307\222o\220+%a\225\363\347\227\271\307\017\300mSD\020\222r\246C)g`E\363 \326\3767\317\257\220-\210%F\b\037\007 \301\226R\306\217\377\007\320\0045\313\310\023\377\313;OpE\254\001\267\304\\\322(&\321\304\312tB\351!rGo\3233S\316?\027Ovs\374\013q\200)\340\036\231\375\n6>\027\033\032ULP\375\257\002q\037?\032\276\210\236/\023>\037\326)\374<\252augt\b0\017\260B\315\007"
+	.string	"\232K\202\230\230\226\253<\216\240\216\361#'\247}\255\230{!x4\016\271\300O\177\003\222\005\\\217\366\350\372\221(\270\217\240$;w\243 4}@I"
+	.string	"\021+\"\270\305\316\223i\236P\nx\363\r\202\302\337\001\325\375\255\033\371\367\356\005s\024~\266\324\022X1\036"
+	.string	"\332\312\226\363\021\f\277J\243\\\347\320gh\3224\\_\226}\033\222\334\260\031\373>6s\303\334\352}\020\201\324i\305K\300\275\031\007\020\336\334$\216P\365`8\326\255\315d\3528\242\276Rc\200\214\300\261o\353(\2059\005\027K\315\275\255\263Y\\=-\003,\374J\330 \203\027\033\371\340\205+\370\3347(\367\315\325j\3642\031\223\323b\257\236\267\306\030\200\363\317\316`"
+	.string	"\2452`p\243\2238Z\027\323\027\305K@\303H+@z\226\024\237I\331\210[e\237%g\221\217u\361\\\340\2769R\251\257\234\370Xu\370/V\224\212\235\241\255iY\n/-\024\013\020\214\204&\367\303q\232g %\020\004\312\246\032\005\330\304H\326\321d\324\364Q\256Yu=\227\242\257{ ,s$\342j[\016(CL\033PNY\231\270\224 \224Pp\353\f\315\036\n\201e\235"
+	.string	"nK\033\2764\354Z:\003x\302\026\307~\216"
+	.string	"\355\3328\005\347\363\026"
+	.ascii	",\272\033y\376!\037f1x\352M\203\222WCO\023'|\005\333(&\362\007"
+	.ascii	"\013\304\257@UE\020\276\335\006\001!\"\024\213W\b\204\261]AD"
+	.ascii	"X'\"\217\237\263\2551\006\323\336\361\342K\301\206]\023N\033"
+	.ascii	"\301\334\022HZHE\002<\210\245i\251\203\236\276p#UJ/\352\016\b"
+	.ascii	"\br\"\033\213\356\030\t{\215\002\316\310/\030\247\007\274\325"
+	.ascii	"\333\344\316\372\345\244\362h\220\245\020m\354p|3\367\"\203\367"
+	.ascii	"\350)\321\334\"\020\005\304\222\034\246\027\032\026\321\243\373"
+	.ascii	"\331y\350\367\341f\024\236\301\235\277\261\022\216\033Z\223\305"
+	.ascii	"\006\362\363\302\302\026\206\333\030\3409\326\256\216\332^L\004"
+	.ascii	"\307\322\376\205\315,,L\001\006\r2\236^\275[G\205,,\357~\312"
+	.ascii	"\230t\032\031\202~\266\310\226\272\336@\343ch\367\"e\342\333"
+	.ascii	">/\332\320\006\007\364\3528\206\354\362\307e\247\313\017k\326"
+	.ascii	"\007n\326q\f\261\022\020\322%B\303\030\007\205\334c1dq\254\263"
+	.ascii	"V\344\031\216]\242\343k\006\271<-\263\3702\355\314m\253\264\263"
+	.ascii	"\202\273\330\220\035y\217x|\016u\213vw,\335ih\007\033\254i\273"
+	.ascii	"\257\255QTl\262\005\233}\340\245\267Ta|a\n\346D2fH\361`\n\242"
+	.ascii	"\355\250\206\244q;\267rLx\225{\352L\f\217[|\211\262J\2743\251"
+	.ascii	"\276\242\243\2170\006F\252\345\367N\034\f\224\177\251\251\005"
+	.ascii	"z2\270\375\321qs\354C\261\303\263\233\232\221\027\301n~%\267"
+	.ascii	"A\377\f\265<\013\356\034\372R\304\362\357\020;\366\342\330\323"
+	.ascii	"\247 7\360;C\017\237\216\037`\177\212[\336\033b\300\276h\366"
+	.ascii	"\364l\270\r\374\341\350\355S\261\007\340\207\246\326\367\202"
+	.ascii	"\335\260\007\317\231\376\r\265\200\037\034j\361\331\263\315\355"
+	.ascii	"\300\217\2437\237\232\031\200\337\024\265\274\013v?\fx\202a\233"
+	.ascii	"\277\336\t?~>$2\037\026\333\245\211NMb8\346OP\241\227\0313\023"
+	.ascii	"H\362D\245\2733^\374C*\346UG\037\\$\373,\245\301\3304d\270\203"
+	.ascii	"=O\275\235Q\356\326\344\271m\333\202\013\260\261\243y97\260:"
+	.ascii	"!\0204q\004\321\372\320\350~{\274\211\360\344G\360\350\252\312"
+	.ascii	"\004Lz\bt\347'.\231\277\031K\020\013\202\f\266\026\342n\343\305"
+	.ascii	"\350HN\304\3737y\310\274\215\341\022\334\221*^ \027\357O\304"
+	.ascii	"t*+?\353]\263R\"\177\205\231B\025\036\032\361\214\001trc\252"
+	.ascii	"\314\212\003\204cV\315#X\323\217G\241\205i'\300\230\021}\033"
+	.ascii	"H\225\264m\243%\034\307\213e\226@\026\343\264\371`\232\3000\016"
+	.ascii	"NbQ\003\216JX`\324\346T\255B\261\202zX\231f\263G\030n\254f\261"
+	.ascii	"\020Cx\254\207\240D\330v4\220"
+	.string	"j\350Mo\240\254#\r\016\261\224`U\345\3411\305j\030\376\364|\352\202\202C\226\316#4\217.\276\265\317\202\334\233\254\211q\2511-wy-\232"
+	.ascii	"\301\273gl|\367\030\210\210\224\205\353\260\355,\234\373\313"
+	.ascii	"\037\223\013|0\205\327\204\271\365\037\020\335\222>\320\252\005"
+	.ascii	"`\305\346\013f\276\251\305K\270\355?\210\330s\216\300\350\243"
+	.ascii	"\367|\027s\366\224\2657\365\034\314T\005\306.\032$\211d\314\231"
+	.ascii	"\305\315\030\302m\002N\360\201\005\3340\243\355\240;c\276:\222"
+	.ascii	"\264\007\376\237\320^\271\\\331%\375\372\376\230r6\345\016\030"
+	.ascii	"\001\245\3144\3027N\206\376\245O\271\353\240\201\347\256\274"
+	.ascii	"ET&2\301C\317n\330\220'[;\305\n\f5D\312&zj-*\021\324F%\305\306"
+	.ascii	"&\234\273\254\202\224\225Wk\n\210jM\\F\\q\246\235EVA\007h~`\302"
+	.ascii	"\204+CH\331\304T\n\352\361.\266\005>`n6o)7J\220^\321\207\313"
+	.ascii	"0\275`x\234\021\3546\273\201c\320\214\317\320p\232\0274\355\333"
+	.ascii	"B{\002s\020\251[\231\255\312\330\200\003vo\n;sDvc?\330\264{6"
+	.ascii	"\3366k6\343\343\321\251\360VaZ\367\0328\020#\300`\230\337!5n"
+	.ascii	"D\304V\231K\335*\245\002gbC\300\207wI\021\346\240\013\202\232"
+	.ascii	"g\301^\004"
+	.text
+	.section	.gnu.lto_.refs.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375`\340\006}%"
+	.string	"\312U\034\017@\200\252I\241\003\3631\333\2534N\271\323z[\244\321\326u\333\372\356\273\253]\376M\351(\335\214\257\364\341\304\245\344\211\206\001\317\221g\346\332\330\032\037\322\0205\203\322\322 \b\202\240\264\330\b![\246\330"
+	.string	"\342"
+	.string	"\337"
+	.string	"\235\223\315\223\245\223\033\312\326\311\023e\357\344\203\222\303\201\031\034\004\252=\027\001-"
+	.ascii	"X\247\345UT\007{\324\301w\032\370ML\003\273R\356`\336\201o\210"
+	.ascii	"z7j\314\220Y\314\230\330\277\017\213\300`A\001\254\251\177\371"
+	.ascii	"\323\277.\376K\rP_\215\326\253Fk\206<\354\215\241\027j!\307\201"
+	.ascii	"uQ,\037)\344XX\260+\344#X\017\305r\221B\206\205\213`K\350\243"
+	.ascii	"\357C\246\035\344\241o\005\375\t\327\233\306_\362}\222R\236\363"
+	.ascii	"=\316\367\242\357\353;A\356\366\356\352\345=\240wk\001=\324\312"
+	.ascii	"3+\003\344<\253\216\265\353\273\335G\355:\324\356\307\252\317"
+	.ascii	"]\251\220\026u\237\272\247\362\234\324\217Q\037\342\276\343P"
+	.ascii	"\342\241\322S:\3652\275\3243\351\\O\\\357X1\037\tOl\215qa\344"
+	.ascii	"\270\266\350b\222\205\267.\356\213\256T\027\035\251.>\333b\026"
+	.ascii	"\341\343\216r\361F\214>_\364]\321+\306q\270>\216U\021>\342>\034"
+	.ascii	"O\221\347\264r\244\254D\221#\365>{\237\310_\263\232\307\214\211"
+	.ascii	"}y\035\3502p0\330\271\254\240\246\222\306\201\233\210z\\\r\030"
+	.ascii	"l\211\360.\336oo\257\373m\022\342\341\277\034\321\305\335\026"
+	.ascii	"\321\277n\373\253\333\016\221\343F\313\303\321\022D>\2334\263"
+	.ascii	"=&+|O~\300\355\363\352\342\302\262\242\232\355\245f\333C\356"
+	.ascii	"1\261\260\t`\257\365\360\265\354\200\373Q6G\366G\026H6I\216("
+	.ascii	"\273$\253'\307\223m\222\353\311\256\345}\262P\262R\262T\262V"
+	.ascii	"\262Y\262[\262]\262^\262`\262a\262b\262d\2622\262+{%[&[#k&'\224"
+	.ascii	"U\313\345\322n\311\255\252\245;U\313\207\325r\263\204\347\266"
+	.ascii	"zn\265X\362.^7\260\325\007T\275\224\356\231ty\222\356q\274\036"
+	.ascii	"n\265Wr\347x=ym"
+	.string	"\225<\354\224+\245Cp\300\240f\257\300\253f\035\253Q\336j\367[\016U\263\013%\351\032\351\223\257\020\256\2748\352$\317\365n\023\361\256+&\271\002\251\367\222\352\006\300\356\222\360&9RdH\220\037\355\321\262~\237<\257]\307\367\332SU\311+\275\326s-\313\307\226e\223@5P\326-\013(\333\226\375\223-2~\241\"\371\375\364\310G\250\221O\320\"\217\240D\236@\207\274\224\226\220oj\203\\ J\177\246>\332\243<^\302\216\0349\272;p\003\250\216\177*Y\336T\262l\216p\250\252\2637\302\235\226\222p\247\245]\031\343\363i\214?\217\363\365\221\311O.\266O\236\275\336\325Z>\270\313t\367\364J\261QC\367\245\001\324\375p\306(\350\276\247\373-\335\013\320\345XU\037UuN\227\325\363\364\222\356\223v/V}\255.\233\370\026\256\315\323\303;\3755i.ca,\254\277\377\202\360\3007"
+	.ascii	"\300\256\277\337/k\347\2513J\366\210\321\"E\207x}C\202\332\266"
+	.ascii	"\372~\232\266Y>\235\006G\313\237S\340j\225\363\313Ok\234\203"
+	.ascii	"E\033X8\371pZ\366\267y-\277M\337\234\325M>\232\236=\306\202\330"
+	.ascii	"W\277\264\371"
+	.string	"\007\357\311\037\224M\336\240k\316\374\202\252\311\246\351\315E\205t\333\231kF|*\252?\201]1\271\327n\337\353\224\347\352\224\374j\267l\030\361\254~\351TOc\277\\/\343a\021\026\034\340\352\331Y.\225\353\331Y\266K\322\005\312\245\363\002\200\231\250Ah\246\f)\031\021\021\221\240 I\223\016\260\"D\244q\003\020\330\r\007I\311\237\2005\356\022w\321\330>\025&/\206\177\026\b\327\362\200/M\303\243j\205f9%\357M.\036\007\232\211C\312IF\366\261 \003L\027\017@ J\307\375p\315\351\016q\217\f\245\323\371\207\004l1\204\nbs\200c\354+al\202\002b\341\251\216\335RE\247m\214'v@q\220,\315\265L\361\2150\020B+?\267\300\342\233&\240\222`\013\026$-\001B0?\001\\pK\021\270\257\355r X\"!\252\252]\3207\331J#\304\031%\323\254\255\"\306\273\305"
+	.string	"\206\322\304\177\262D\300\203\322\270\031m\373\200X\200\307\030?\177\310\032\206\013\\8"
+	.ascii	"|\013\361\231\270\255\030&\3252\n\372Y\317I\212-*\004\213)"
+	.text
+	.section	.gnu.lto_.decls.2a8b8e9593198327,"e",@progbits
+	.string	"(\265/\375\240\026\275\001"
+	.string	"5\224\006^\246\311\202\"S\020(\006-5\006\242M\023p\205B0'x\356\016\340gN\335F\230\257\355\353l\347\006O\2709\253%\314\337(\363kR8\310\260\017k\337\016\263_\241"
+	.ascii	"(2H\001`\263\np\030\001\340\320\005Shd\267\022\300\370\t\254"
+	.ascii	"=\b\267\304\256\344\256\264r\247\266\035=\"G$M\206q\220\254\237"
+	.ascii	"$\332\007\001J\006,\242]\367Q\220X\366\217,pMJ\221\260(X\034"
+	.ascii	",\032\026\247\264\330ba1\312\213\200\305\354s\221\257\260\330"
+	.ascii	"\227\261\212ho\373D\217\263l\221'd\327ba\321O\007\234\216(\303"
+	.ascii	"L4\005Im\251\217<\262\377\326:]d\333t\217T\333G\342\330Gr\355"
+	.ascii	"#\245\366\221'\366_)\233\203\342\236\023\245\322\226\022\300"
+	.ascii	"\254\365r\322\214\252\217(\353\277v\373\036\360e\254 \303+\223"
+	.ascii	"b\223\026[\314+\342\241\345\265Pb\240\237\020\316\230\270\300"
+	.ascii	"\f\225-\200L!\272\372/\216;;\252\026\202dY\327\031\007\265\236"
+	.ascii	"|e\375W\306\316N\305#C\256\305%E\272\026[\234+\"yQ\256\230\344"
+	.ascii	"mq\256\250\244xd\371\203\026\377\270lx3p\030^\220\205\310\235"
+	.ascii	"\331\271\372\373\312\316K\255\323\225 \273\377b\334\213G\376"
+	.ascii	"l\225ad\250\345\035\030\230\223\2543\026\304\213qm\331\035)\214"
+	.ascii	"\024)4\224RF\244\305\026\213\274NY\205lS\321\202F\326 @\274H"
+	.ascii	"\244=CLC\002\367\266\214\302\343\311\317\333\335t\314\310B\222"
+	.ascii	"u\2331\354\352\243E\326\337y\273\305Sq*\004\242\2457E\017\032"
+	.ascii	"\331 WT\327b\025\f\255k\261\312j+\253\025\225]b*\262P\312\343"
+	.ascii	"*R\375 j\024\273\212iK\033H\236\022\215\247,\216bX\bDK\257\212"
+	.ascii	"\240\243b\013\247\377\205@\264\364\022\345\325 \333\312GK!\226"
+	.ascii	"X\350\n\252X\2055eV\214Q\314\n\201h\351=\312\223"
+	.string	"*.\025\315\212dWaA\376\214\235\321\343\005Zq\255\250V\034R\004R\fR\024R\344QL+\262\025{\024\317\212\330\342\217bY\321G\213-\232\025\305^\034+\356 +\232\025\257\305\257\366n-\006j\212\300\013NF\224a\034\243-y\324HB\223@\177\357\330n\334:\335\337\265M\367\233k\377\3050\035kiP\374\320\342\033{n]-\266\bV\314\361?6\313\323R\222\365\267\324\376n\341U\274\301\234\222D\350$\353\357#\257MT\344\212\2258\232Rpe\375\243a\321\3061\273\177\334\333?*\331?\016\331?\252\355\277\230U\224q\355\342\361\227\365\035SyeG\236U\326?\356\330?r\355\037\255\366\217+\366\217'6\007m\323\375]\353\214*JA\351\241\"E\264\242D\025\241\230\224\305\330\254\377\342\213\027\241\2306\332\360\260\262.\272\310X\211msqy\373\256\221}\264\266\351\026W8\305"
+	.string	"\372\313\372\256\331~\213-\252hBZ\341\2523,6\035f\322\324\027g}\327k\377\255\230\242\250\224D\305`6\353b\022\332\021h\317I\222\254\357b\355\214\035\314\204fP\260\205OZ\036\355Z{\247\305"
+	.ascii	"0;)\271\213&\250(\0052\277,H\224\021\213A\355\335\023K,\324f"
+	.ascii	"\230-\022\265L\370\212\212H\305\243\242Qq\250x\242\210\242\305"
+	.ascii	"\026\211\262\3413\225|\370g\220\"Q\236\222\261\332;-\006\220"
+	.ascii	"\365e\231\204;~8\261\350A\263(E\240\242P\213-\006\375\211\026"
+	.ascii	"\307k\305\240\\\245\370\323\336=\241\305M\311!Y\3017\231\013"
+	.ascii	"`\301&|P\256\376\213?\305X\bZ\326`\3269\361\370\344\264d(\353"
+	.ascii	"\273B\373\317VZl\276\262\013\303\340\020\263~a\022\311\214\253"
+	.ascii	"\272\254\357\376\354\033\021wFk\235\256\207\266\351\336\030e"
+	.ascii	"\337\330\267o\304"
+	.string	"\3337\316\355?\023v\251)!\254\313\372F\271\035A\340\363I\025\272\272, \"\334\021\215\254\243\264\340\021\330\"\353\033\331\240\344'-6\377\345>4\277\026.\217\356\372\227\371\342\237\300\017v\240=13\214c\264\347\005\027\030{\204\251Ht\365\215Y\373\306\247}\243\322\376\363\236\223\001\244\001Ie\355\004\253\255\312LJ\330\276\364*\330BE\202\2205\311[n\0359r\"\353\274\314D\206%%\020\026FfdM\343\371\3268<\002\302\273\323k__Yw\267\203\323`d\261e]\227\231\350\261(\313\372F\240}\017\200d8\232\240\242\024\336v\240\3759I\216\313H\226\3058\006:\273z\260\326\302\265wO\b\030+#K\222\331\376G\023T\224\002\030\331\237\347\262\\^\222\225d\272\026\233\223d\"\317E\262\221?A\37036I\376\321\302-\177\320\342\024\307\254\273\275&\3038F\273\340\202\013.x^"
+	.string	"\027\356\200\342\246\324\031\t\234\f\357\2226:\254\254\017\342\371\b2\253\310\213'Y_\317\355\026\255u\272\317\266\351^\277\345\267\266\027\307\331\020\214\254\257}\270\2651\327\366\232\206\fyn{\024eL\243\353\322\250\200e\235\205\354-\261\026(\262\316A\376g\364\203\342(\353\027>\356\377\253Y\300\355\240\313\372\332l_\217\355k\257}\315\265Y|\250\031\203~\304\300\221\366\254\366g\036\271G\226RV\305\270:t\030Ue\375\242\265N\267}j\233nF\003\361\234\326t\227\236\320\3425\266C\031H\262v9\223j\371\256Rsfd\307\035G\256\326\262\316d9\357\310e\317dy\354\035\200p\245P&\323q\f\324\266\001X\266m"
+	.ascii	"\214q6\200z\270\372Zk\277\305f1\250\006\200A=\t;\332lQ\356\216"
+	.ascii	"t\200\351\030"
+	.string	"^m;\262\026\324\nb\312\221\261\\\247!\304 8\276\334\033x\206*\262\316\327\354\325b\237\371\006\263e\022\244\024\225\365\265\325\376@\334>\335'\266O\367\317]-\\\316\243C\n\342J2JA\222\315\312\372\3176j$c\354\025\001\2225\2155\241\037!lDY_\267\330o\311\362Vnq\004\262'$\233e\344\254\254\225g\344\030-6o\345\251\\\225\2552\214\"\266\255VHfQT\273\266pbH6\255\345\321\256\025\325\256\233h\317\2555\313[\371*c\025\325\256\373\304\017\271\255\354\224\245\212j\327\027EV\220l\034\243]\360\274\340\202\013.(Z\031\302\204\207R\367e\032V\330zd}\235b\267E\255\323mi\233\356\237\251\376\027I7\305\3055\353\353\242\375\242\225\375g\251\034\265c\205\214\0321\363\205C\314\301\"\353\354\"\277x\206\312Oq\206\372\240*\216\2012\024\263J\034\0031\3336"
+	.string	"m\033"
+	.ascii	"=v\325\005\304\325/\032\356\027\007\367\213Qv^\201&\024\307\261"
+	.ascii	"\f\363\207\r!\030Y\277H\267\357Z'E\264\353\321\355\004Y+\330"
+	.ascii	"V)\242\275\355 {c\3318\216\263Q>*\246-\355\037?\316\262q\214"
+	.ascii	"f%\027\235\020\313\306q\234\223\332!-\\\021\355z\374\221e\226"
+	.ascii	"\215c\264\234\324\032i\355\212h\327\026\262\312\262q\034\377"
+	.ascii	"\317L9EV\312*2Rn\312K-6'](\251\335k\003\213ho\333moG6\216\343"
+	.ascii	"\013d.h\323V(eY\264\207\214\342\025Bc\276N\006\245\326\262~\321"
+	.ascii	"\310~qH>\241\225jL6\330\262~\021l\377\317C-6\023\265Wt&j\023"
+	.ascii	"\263P1mi\273\375xb\352\230#s\322:\007\241\265c\202+\262Y\277"
+	.ascii	"x\265s\234\177Zl\006\272\346Q\025\253\3051\032\\\004jA\347\226"
+	.ascii	"\365"
+	.string	"[\017.3111\261\365\340\276\370\264_\374\331\317\207\033\221\331\242\214\310J\326\317|\373\036\360\265R\206\256\\\343X\350-\232a\013\245\225RD{\333(\364\022\263q,D\245=l\261\255a;\345\202\013\236\3102#:\216\\\375|d\267\203-a\213\225i\013c\346\3620/\305\224\254\237\333\266\007\342\270\225q\333\304\304V\306}\376\221e\373:2\225\365\263\215\375\277\375k\243\264\330\026\260}\362\026H\033\344\031-\216\325\3428\276\007|\255\337\022\210%\026:qt\215c\265\026\260\205\322\372\025\321\336\366\321\t\244l\034\253=/\270"
+	.string	"\006\f2\253r\365\363\326~N\261\373\320\222oSl+\262~&\332\317@\373\355\340\326{\352\303*\271\303\254\337\316\355\274\226IT\223\026\333\346\265x\357"
+	.string	"\004\2628\216/x\036\227\256\250\304i\3756n\2775\333o\303v\335\323\315\312\233B\226\365\333\252}\020\342\266<@\322\036Y\376\260\304A{Z\3278V\373\337*i\351\332\271\026\333.i\345\336\022i\213\274E\213c\2418\216\337\242u"
+	.ascii	"B\273\244M\322\036)\242]\343 \275\257\013x`\177\f\032\306\261"
+	.ascii	"\332\005\027</x\231\\\243\260m\375\352~\f\373\020\330h\312\024"
+	.ascii	")hTe}\024\366\031\260\237\255\323-\266M\267mk\335Zl\207\366\355"
+	.ascii	"\035\200\360\342\017\217\230,\216\321\230\360\025\261+\210Y?"
+	.ascii	"\204\375\266\203\333&\266\035\334\203\330\277`G\320:]\3356\335"
+	.ascii	"\257\265N\267\355\321\252\265\330\n\332\037o\317Z\264\033\201"
+	.ascii	"\320b\2648Fcn\275\254T]\326\247`/\231\304 \334\335o+p\213\211"
+	.ascii	"\211m\005\356\363>_\353tYZ\247\233\333\246{\303\326\351\376m"
+	.ascii	"\331\337\356h\311:\024\213\220\252\342\2658Fka\242\265H\302\312"
+	.ascii	"\372h\255\323\335m\323Mz\370\223\026\374K\2577&)\301\362\372"
+	.ascii	"\n\376\366r(\300\277k\200\221\304\340W\016\276\020\214 \263\354"
+	.ascii	"\242\352\275\031d@Wl0\347\345%\031/\353\345\272?g\225B~\345\220"
+	.ascii	"\177\311\325N\217\344>\343\007l\374p\b%\t\377\213L\033\302\246"
+	.ascii	"\201\316\352W\302\370\227Y\277\321\205\337(\3427\302\240\224"
+	.ascii	"\372\225S\377R\306\257t\261\214"
+	.string	"\361+W\374J\026\377\022\353\337\035\214\021P\246x\2414\351\214\032D\3532x\331X\354(\234\005p\tyH4o\217\246\021\274\267k| \375\312\3017\351=\372\227W\357\211\277\375P\334\371\213=\177Q\347O\032\375K\030\177\022\305\277\264\372\223?\177\022\350_V-\340/\226\360\027\033\260\244\372\223\036\370\227S\177\361\204\277\030\301R\352w\233E\033\302\030*XF\375\313\027\313\017\226.\206\276\302\337L\032\023A\370\341\266}\203\230r\360\305\200K\332\233\301\273\200\037WL9\2709\274\036\\D\270b\312AX\311;\301\003\214E\233\002b\0370\"\271b\312\tZ\301\377\310\374\333\017K\025-\317\337Ji\247\313\246\037.j\372\001\376\026\001\354\017\030\221Z\274\tZ\021H\354\244\016?\222\r\t\344_\"E\340\337#Xl\b.\217\376Vi\263@\365\267\"\354\023\376\215\302\361o\211\342o\225F`\031\242\361"
+	.string	"g_\020C;\303a\027\317\362\376\257\317\337\357\216)\227(\347\376\245\321\262\350w\217\224L~w\205\313\264<\361+\363\376%\221RO\204\266\006)\363\342\301\314\257\034|]@\3707\213\345\220\323\025S\016vhi\220o\214\313\006\273\304KF.\205\216U\220\026\310\311\277\215!7?b\267\370\377\301\337\242Afy5\310\313bqC-\203\"\340b\343\337P\377\022\350_\376\374\233i\311\201\177\271\201\377\365\260i@n\344rY\342_\332\360#\365+\370f\217\205o\004\376\027J\337\233\367\322\275K^$;\372\222\345x!XV\377%\365_\362\374\313\235m\206|i\274\023,\245\3772\347\177e\274)\336\240\254\3743\313\237\227\177\206\377\354\362\237\277\305"
+	.string	".\374\277\210\313\033\375\362\356\232\"\006v\264\230\363\033\t\177d\376\215\205l\357\316\322\346\177]\364\235\233\003\233\260\234\341\337G\214J\340\253wS12\201Q\354+n\025na\023\376n\f%~\370\312\022\372o\257\033\262\207\275\303h\004\316\261\357<\220y\262\006\354\336\220\337?\220\300\025\330{K\031\376\367\212\021h\033\375.\320\262f\211\201\377\245\001\227\360:\271ay\201\277\030\270;\034\253,-\300B\0053\2261\024-%\360\303g\313\030#\322\351\376&\025#\314o\214\371\2154/F\347\3777\343\314\337.G\374\306\263\337\370\374\215\023<\340\207\333\362\326\3778\245\013\277\022\002\377R\304\377\001\320P@\366\237"
+	.string	"\177\323\304\377\202X\276\200"
+	.ascii	"\023K\b\374FC\027~\243`\261XD\212\320A\024\006\237\177\331\302"
+	.ascii	"\237d\300\237\034\341_\262\2204!\351\302\237\204\300"
+	.string	"\277\f\361'G\374I\030\376\345\n\177r\002\313\007\374I\n\374K\007\304\360+\007k\376%\001\222\tX\252P\003\325E\357]\300\337^\022\376\342\321\204\342\376]\255|_\006\230\360.\300\345\003\377\373\267\\\200+6\b\245\231\344\177\205\226\n\310\033.\341\rj\036\337\016,\023\360#!P\fQT\341O\222\370\227\bX\212\360\027G\370\223\323\177y\200?\331\363/\r\360/CX\026\340w\227n\037\334f\375\225\203I\f\374\311\032\376%\001~\344\nK\020\376\345\007\277\033\200\370\277\b\177\263\305\340/^\340\272\370\213\026\374K\017\212\036\212\032\024?x\300\312\257]\370_\254d\323\262\203?\311\342O\266\370\227 V\320#\374\257\325\222\203d\324T\325\237\264\372\227\033\374\313\017\311\253?\t\365'\267\376\245\006\1771\204?)#\231\365/3\370\223^\277\216\300\022\203?\231\343_^\360'\301\376\245\005:\226\0364"
+	.string	"~\r\302\257?\374\257\324\377N\375\313\n\336\027\\\377\373T|[\374\313\001\374\311\261\342\322R"
+	.string	"o\317\253\2020Y\366'\311\376\344\331\277\244 \231\226\354\361\303C\\\354r\202?\351\343Ob\377\245\004\377\313\364\267\005`\301\030\364\277\2028\0214\fnQ\212\377*\376&"
+	.string	"\\\266\2775\301\375\361\2674p\212?o\270\204e\004\360\337\223|\t\322\002Ex'`\t\200\277ei-pYB\340\362Xv\370\225H~\245\334\277\244\321\241\031\001C\020\327\227\301\233\376\027\fh\364\271b\312\301\226\003\r\262\371\b\376\227\n\334+\202\313\231hK\342\0030\374\337\202\\\241\245q\007\377\303\217\341o'*\260\344\360\277\\K\231\274\341\022^\021\313'\362\003J\t }^A\3142\346o3\300&\361(\305\340\242C\t\267C\300N\327L)\001WL9\350Z\320\212\200\\\276t\370_"
+	.string	",\233\277{\003\036\001\202\004l\352\017\217\340\372\321\264\"\260\344\375\310\003\270}p\233k\346\367\267\"\300q\257\005?\\\202k\346\301\005\002\255\b\356\230\317\322\3457\322\340"
+	.ascii	"\202Z\217\023\377\313c\331\362\033\221\330T\374\033\372\357\031"
+	.ascii	"\376%\213\210\232\263\177\343,\231J\030~\245\225\243\222\345"
+	.ascii	"\022&\001\357E\377C\360\263\004\371\223!\374I\003\374K\370WV"
+	.ascii	"\340W\306\360/\225\027\370\225\203\311\022~\245\315\277L\376"
+	.ascii	"J\031~%\364_\"\215V^\267{\370\233.\336$J\022\313\367\337\026"
+	.ascii	"\270\026\274F\226\033&\361\"iv\375\177{50\206\340J\375\257\335"
+	.ascii	"\277<\"\317\301\337\334\261t\177w\304i\342"
+	.string	"\2324~\244\323\322\330\272\025>\371w\rI"
+	.string	"\374\312\301=\365\267\t\330.\376\266"
+	.string	"\371\271]\352\337\270\347t\301\340\3371\374\333\002\377\262\270)\300\362\365o\021\313\374\357\032X\3766\f\313V\310\363G\266\375\313\267n\233e\353w\301\340D$\025\r\016V\3766\004DW\307\337\206"
+	.string	"Om\370\335\n\300W~e\211\037\266\202\264"
+	.ascii	"r\352Wv\340\207\253\270 \266\310\274\0379\356\002\260\024\260"
+	.ascii	"\037.\374s\333Gd#\331\255\360\311\336\3717\317\017\023*\331h"
+	.ascii	"`A\362\277=\3124%\032<X\225K i\0309\360\273U\260`\266\241\002"
+	.ascii	"\301\377\b\370\233z~p\340\277\201J\3300\002\206\300\b\304\367"
+	.ascii	"\237\303\337\002\367\3425{$\351\376d\335\017g\217\371\327&`\300"
+	.ascii	"\3421\211\004\216\242\344\207\333\376\006\377\375"
+	.string	"\306\277\244\337\017\367\361\375\306'\"\300{\177\321\375u\t\032\022\370\221\020\200\365^\301\261\370\345qO\250\235\211\337\276f\221x\317\355\177\235\300M\376\335A)\250\f\372\225?~8o\277\300L~WFi\364\303;\312\243\231\217\300\333/-\355\214\362\003\277\322\307\017\333\205\360Ji\376\301u?L\327\316\375\360\334\337\326\375-Mk\207\302\371o\b\222\032P\360\277\002\370\341%\023\240\360#\247\277\361\3527b\375\260\222\037\331\363\303I\376c\334\177<\362\037\221\374\260\334\017#9\362\303D\376\243\313\177\346\277\024\300\377\326\374\257\fn\337\237\024\341\207\333\376V\004\f\270\224%\237~\245\214\037\036\362+k\374.\024\026\242\274\376J\257\037\016\362\033\251\306\352o\264*\301~\245\216\037\006\362\357\016JA\230\355wI\030sp~c\006~#\r\306\350\316\257$\373\225e?\274\366\2735o%^\200\277\211\227\005\220'"
+	.string	""
+	.string	"\004\177\203Op-\310\006@Z i\344O\306\375\360\017\0202\003\2744\325\315"
+	.string	"\306\302>b`\022\025\250\375/\n\370z\366\303;~\315s\352\337\f\361\270"
+	.string	"\374\031\202?S\360\347\t\376,\201"
+	.string	"\376\277ij\006\300\017C\340\025\310\036,\270\361\237\202\277%\232Ad\002|\320\202\260w0\300\b\234\003\306\001\177\375-\007\243\322u\306\237\023`\366\037\304\337\322\201\037\226\221A\370\215@\037\374\331\203?\023 \203\3703\0079\004\003|\202\277\305\204R2\371'\225?\034\343G\256\020\342\207\261\376}\244u\242\004\276\202aX\375\260T\322L\336\337\342\315`\203\244\245\353\337\026(3\360+i\370a\027\032\370\225\324\037~z\267~\330)\363\030\377\366\235\021\204\004\340\0260\013x\305\322\273\344\177\n\177S\007\322o\254K\262$[~\370\210\206?g\340\317:\177\346\371s\317\337\206\300\202\333\"[5\200\327\322c7\275\273=d\002\243\200\215\2126S\313\004\255\224vJ+\370\267\201\203\177[\230\245|"
+	.string	"F\244K\360\2734\377d6\031\370\303B\311\301$\225?i\370'\021\1778\350\327Kt\335\257l\177e\376a\240_yT\356\037\376\371\225I8\376\225.\277\262\371\303\037\370\365\330\017{\340\327=~\270\003\277\013\005s\340Ov\220\364\340\2077\240t*g\224\317_I\363\3037\300&~#\366WJ\360+'\370\341\022?l\303\357\216\320\n\371\225\025\3005\374-\331\337\336\370a\237\326\307\357*@\t\200\037\266\302\325\337uR\177#\220_\tB\331\301\017k\340\327N\312\020~\245\001~\270\347\327G\360T\211\200_\231\200\037\346q-@\322\200w~d\216\037\t\366\303:\377\321\tL\2036R\222\240,\341\2073\220|\373u\017,\375\333\263\266\377h\250\203~=\364k!}\342\327D:-\324\337^\177\230\304\377\n\304\320$\245\300\321_K\241\370[\021\274\376_\377\246\315\217\374"
+	.string	"2\376\341\233\343\036\323\r\tD\004\333\3040\201{"
+	.string	"\245\017\\\200\335A)\230Yx"
+	.string	"R\360G\016\376\360\f\177^\001\212L\374\341\013\204H\032\377\244\373\303\026@\312\375\310$?\034\303\277\177\030\221\374F\271\037\256"
+	.string	"L\001$\340+"
+	.string	"O\340\317/\3000\354!\377K\370[\240F\374\306!+\374\371\001\177n\341\317,"
+	.string	"\371w\220\354\200\377q\310'\360\013\177\016\361\303\020\3705\322\237+\360\303.\374\371\002zE+\002\006\326\376c\360\2670!\225\373\212\361\003U\270\005\230\0058\0042\371\337\371\277\304d\275\277\315@\306\373a\025\376\314\344w\237\376\f\230\007\377\234\367'c\376\344\363\207S\370\263\223$\r\214BN\222\217d\302\276\304\377\026\374-\211\377\266"
+	.string	">!#B\360\352x\305\340\006\374H\013\314\344\303\034\330\204_\343\345\375\303%\374\312\024~m\205I\370\335\033\360\b\377c\200;\200\031\360\303\007\370\265\036\007]}s\374\037\341o\322\360\001\270"
+	.string	".\0130\001\376\214\370\347\303\377q\310\275\037\311\367\303 \264\"\300\020\320\030\221\036\200\337\245\202\277\235iE\200q\376\226\206\277\315\300\3777\344\r\374\301\177ta\017\340\016\246-\3152"
+	.string	"H\013\374\310\013\374p\006\307\343\337\322,\231\377\316\340\337\032\3740\006\360\005\277Q\354#\366\0050D0\302\277_\340#\004,\t(\021H\200\326\203\t\336\332e\214\021H\001,\035\370a\013~#\221\271\277\205\177\330\303\253\201\336\300\251\300\025\374\306\033P\340\001\374F0\270\255\300\363\025\210\320\365\277\001\177\263f\023"
+	.string	"\026\300\210\377\311\337e\353\177\037L\301\377\222\200'p\013\177W\312\017K\360\n\220x\\\350^\007\300\001h)\330Yp\004\277\313\005\003\340\025\334e\004\f\301oDzq6\370]\334\376\266\250\003\024IH\037?\022\373\303\035\376v"
+	.string	"\030\350\264\037`\232\f.\363\263L\377\343\035\374\3747\210\177{\360\3031\177+\200\377}4\273\203\277\235\200%\352\223\207\327\343GRa\230c\335\337zp\\\362\377\215\251c\207\370w\013?\354\334,\374W\376,R\377V\341\207_H0\200\b{\004\226\240\026\205\321o\374\201\233\023\f2\367~\230\371#U\374\360\373\267(\376\266\250\025\372\337\367a"
+	.string	"\307(L\272\r\243\002\021\264\376\226\246\005\002\355\362\025\214@\272]"
+	.string	"\370\341\232\177\277\374\360\376\215T\340\343\337R\320\316\264\313%\374\353\033\3767\304\377\262\360\303\356\337j\346\017\033]-X\267,\277\021\b.\376\306\303\347\375\255\313\017g\344\004o\006p\373\377\215C\333\376\257\340\317\017\340\025\370\037\343\302\323\322\274\205\337\305\351\277\341\177*m\313\017\345\377_\233\374\225\211\177[\201\005\377\343\376\034\200\bw\353?\314\017\213\270\313\317\202\301\206\225W\332\232-\301\377\346\317\322\2006\001y\263\210\260\227\377g~\226\016=\377Y~\027\274W\203\377\360\357\022\203\273\201\322J\034\363\267\264o\277\033\304\t\271CY\345w\235(\021\177d\332\257<\374\221<~%\225\377\025\374J\303\277\335@/\177\213\361w\221(\245\374\310\002 9P\026\032\227\334\275\377\313\037v\373\221\026(\t?\342:\277\321)\271\301\356"
+	.string	"\243\001\277+\246\034\374w\207\252\226\021\376\335A)\370\357\033\n\377\235\225\201-\315\367\317\322\367\273F\224\331V\0069\330\353\337\371\337\372W\006\326\334\375Y\216\277k\344Gf\360+\263\177[s\343\017\323\370\213\325\n\376\266\204\277?\254\342/^\177d\207"
+	.ascii	"\b\340W\002\376?\376M\020\376\227ES\203\377\025\373\337\260_"
+	.ascii	"3\371_\374\233>\377\366\373\225Q\3766\316H\006\177"
+	.ascii	"\277;\001\224\337\310C\331\322\264 \371_\255b\373+\375~\243T"
+	.ascii	"\225\001\036~e\237\222/\373(\367\214UJ'\277\321F\006\177K\363"
+	.ascii	"\237\303\337\024\361+\365~e\336\257\234\373\225r\277\022\356"
+	.ascii	"W\272\375\312!\277\222\355W\376\370\225>~e\217_\231\366+\313"
+	.ascii	"~\245\216_\351\365+m\374J\031\277\022\353W\302\370\225S\277\362"
+	.ascii	"\305\257d\361+\217~\245\321\257\024\372\225\361\257\354\300\257"
+	.ascii	",\361+\251\277\222\206_\211\363+m~%\364W^\340W\306\360+%\360"
+	.ascii	"+a\370\225\"~%\004~\345\003~\245\n\277\262\204_\231\200_i\200"
+	.ascii	"_\331\301\257\364\360+'\370\2254\277\322\371+\233"
+	.string	"\277R\371+\367\257\314\177\022\361OR\371\223\203\1772\360O\372\375\311\272?\251\344O\312\375\311\270?\t\367'\261\177\262\307\237L\373\223g\177\262\354O\216\375\311\260?\t\366'o\374\311\255?\231\365'\257\376\244\325\237\234\372\223Q\177\322\305\237l\361'U\374I\244?\211\342O\002\375I\017\374\311\032\376\244\365OR\377d\317\237\304\371\2235\1772\206?I\201?\t\303\237\204\300\2374\341O\216\360'E\370\223\006\370\223 \374I\017\376\344\006\177R\203?\211\301\237\264\340ON\360'\001\360';\374\311\347\237l\371\223\312?\351\376\310\304\0379\370#\241\374H\276\037\271\344G&\371\221m?R\310\217\004\362#\261?\222\307\217$\373\221`?\262\306\217\244\372\221O?R\305\217<\361#\201~d\374#}~d\365G\366\374\310\350\217\274\300\217|\341G\206\370\221\b\370\221\007\370\221!\374\310\f~\344\005?R"
+	.ascii	"?r\202\037\031\200\037\t\200\037\331\341G\312\374/\207\037\351"
+	.ascii	"\374\221\315\037\271\374_\b\376\255\201\037\231\374\221\312\177"
+	.ascii	"\323\360#\367\217t\177\244\376\221\371G\376\177\257\374o\225"
+	.ascii	"\377\225\362\277\204\377+\370\277\331\377\205\362\277Q\376\267"
+	.ascii	"\357\177\367\3767\357\177\361\376\327\356\177\351\376w\311\377"
+	.ascii	"&\371_$\377\033\367\277n\377+\344\177\331\376\027\310\377b\377"
+	.ascii	"\035\375\337\036\377\253\366\357\232\377%\373\337\261\377\315"
+	.ascii	"\361\277_\377\353\365\277]\377K\343\177\267\376W\306\377b\375"
+	.ascii	"/\214\377\235\372\337\027\377\373\364\277-\376W\305\3772\375"
+	.ascii	"o\212\377\r\372\337\244\377=\372\337\023\377;\364\277\361\377"
+	.ascii	"z\340\177k\370_\352\377\366\374/\317\377\342\374/\006\376W\206"
+	.ascii	"\377\215\341\177#\360\277#\376\227\205\377}\300\377.\340\177"
+	.ascii	"M\370_\022\376\227\001\377\213\200\377=\300\377\206\360\277\004"
+	.ascii	"\370\337\017\376\267\203\377\325\340\177=\374\257\005\377;\301"
+	.ascii	"\377\n\340\177#\3707\005\376w\346\177c\376\327\371\277\315\177"
+	.ascii	"3\375\357\373\357\304\177\027\376\373\311\277\371\376\215\367"
+	.ascii	"\357\244\177#\371\367\220\177\007\371\367\332\277\315\376M\366"
+	.ascii	"\357\033\377\326\3727\214\177W\375{\352\337Q\377v\361\357\026"
+	.ascii	"\377n\372\267\322\277Q\374\033\350\337\361\277o\370w\211\177"
+	.ascii	"\327\360\357\021\377\266\376\233\372o\236\177\347\374{\206\177"
+	.ascii	"[\340\337\021\3707\013\377n\341\337#\374[\205\177\243\360o\022"
+	.ascii	"\376\255\200\177\033\340\337\005\370w\007\377\366\340\337\027"
+	.ascii	"\374[\203\177K\360\357\b\376\r\301\2779\374\333\371o\226\177"
+	.ascii	"/\377]\374\267\376\217V\376\243\341\177,\374\217\203\3771\312"
+	.ascii	"\177\334\373\217y\377\021\357?\326\375\307%\377\021\311\177t"
+	.ascii	"\371\217,\377\361\370\037\213\277{\345w\253\374\356\341\357\032"
+	.ascii	"\376\256\224\337\035\374\335(\277\013\345w\375~w\357w\345~7\356"
+	.ascii	"w\333~7\310\357\262\375\356\217\337\355\361\273f\277K\366\273"
+	.ascii	"c\277\253\343w\277~\267\353w\267~#\341\357V\375F\033~w\3527\356"
+	.ascii	"\374F\030~W\352?\013\277\361\303o\234\340w+\360\353\272\337\205"
+	.ascii	"\372u\324\257\221\376\266\355w]\374E\r\376|\345\317R\376<\370"
+	.ascii	"\273O\277\353\364g\276?\267\375n\213?\367\374y\206?_\340\317"
+	.ascii	"!\374\331\303\337\326\375m\322\337\362\374m\364oK\370\333\227"
+	.ascii	"\277\305\340wW\374n\323\357\036\375n\321\357\016\375\305\300"
+	.ascii	"\337\r\372\335\370w=\360\273\034\370\335\033~\267\304\357\326"
+	.ascii	"\360\033=\360\273\326\337\235\376\356\316\357\322\360\353\273"
+	.ascii	"\337"
+	.string	"\225\376.\211\337\205\376.\006~7\206\337\235\300o\344\340wG\374.\004~7\304\337r\375\255\324\257\231~\327\001\277\333\200\337\035\341w\027\360\273\007\370]\020~\267\203_k\340w5\370]\013~\327\303\357N\360\273\001\370]\b~W\346w\235\277\333\374\335\345\357\276\277\221\001\277\253\177c\006\2771\3617V\371\215\207\277\221\312o4\374\215S~c\341o\024\374\215\177\277\361\311o\344\373\215{\1776\362\033\363\376\226\312o\244\372\263\3657\326\375\306%\177\253\367\033\345~c\334\237\027\360\033\211\374\306\267\3378\3447\002\371\215k\177q\304o\304\376F\036\177\033\367\033=\374\306\264_\303\360\033\317\376\342\n\277\221\3547\212\375F\260\337x\3437\332\370\2154~\243\214\277\330\376\272\372\033\261~c\325o\224\372\215Q\277\321\3517.\375\347\371\333\342\337v\360\267 \374-\3627*\375\255\b\377+\370\215H\277\261\350\377"
+	.string	"\376\217\370\037\303\177\235\277\235\340ok\376\277\375\306\241\277\235\371_\370\237\346o9\374F\240\337\370\363\033\343\377}\377\343~\343\007~c\007~c\211\337\310\363\033#\360\033G\370\215\n\370\215 ~\343\006\277Q\203\337h\301o\244\340\327}\277\346\373u\336\257\361~m\367k\266_S\375z\352\327R\277N\372[\267_\037\375z\003\2776\361k\353\257\251\277\356\371\365\364\327;\277\306\371u\004~\r\201_?\340\327\005\370\213\310\277\350\365\027\273\376b\215\277\270\365\027\255\177Q\003\177Q\372\027Y\370\213!\376\342\003\376\342\207\277\330\341/\316\374E\347_|\371\213\315\277\270\377\342\361/\026\377b\376s\342\237\247\374\271\360\317\204\177\356\3733\222?\307\375\031\356\317n\177\366\300\237K\374\331\347\317\032\370\037\342\3176\177\206\376Y\206?c\340\317\f\370\263\002\376|\200?\033\340\317\026\374y"
+	.string	"\177~\371s\363\317\355\337\"\376\355\341\337:\371[\273\277-\362\267o\177[\375[\245\277\355\371\333\351\337\222\370\333\233\277\265\371[\031\376\326\204\277U\300\337&\340oC\370[\232\277-\300\337\022\340o?\370[\017\376\366\303\177\021\177\253\301\337f\360\237\354\3176\374_\362\277*111\361\217\200\326_\002\005o'8@\036vT\301e\263~\002"
+	.string	"\367\333\033\034'\366c\344p\\r\206\013\271\033p\221\271\303 \032p\021\230\b\213\037\241:\370\312/\205\022\f\227\211\234\240\301\"-\353'@n\037\026\322\302mX\270-\337\025\213b \030\037\330\005&\240m\277\315wn\220 \312\353\222\004\370\330o\305Z\230\255\305\302lY-\005\264\370\247\205\2023k\nK@\230\017\037\360\217\227\2038H/m"
+	.string	"\203^\330\303?\262\024\0260-\353\027&\211\374t\314\331e\375\004l\241\241\301=d8\210\203\364~&\240\2033k2\344q\270G\013\267\353b7\256\254\341\264,\206edh*\001Pff\231\254E\213S\370X\2315\205%\300h?\223\2650\031\026&\313d\317\370'\220\203B&4\f\216"
+	.ascii	")\033\026\203\305\3401\tv\374\274\260\305\302cLpp\001i\222#\007"
+	.ascii	"\254\243\235\232\031\304\003;\254#\213\001\n\232\271)\361\362"
+	.ascii	"\202\277R\210\343XE\232YS\330\215\303_M\200<\221\312RL\035\210"
+	.ascii	"GDh\320\200\273\336.E"
+	.string	"\271g\201\\\207\273\224jYD\350\262\206m\024\177\216T9\311\032\256q@\346\013\036;\364"
+	.ascii	"\203\\\223\234d}\004\220m\030\006\f\003"
+	.string	"\336J\204\265\016o\t\256X\321\"k\030\013\316\032B&%\003\316\202e\344(T\250\364\321\310Uko}A\344\262\216\221\247r\325\037_e\301\206\262\206\257nD\210\\\017\032F\260\254\024a\263>\002nl\270J\2735\276v\204e}\004\300\320/\316\266\250`)>\037N\324\262>\002Vl\030j\306\220$\\Y\037\001DdqJY\2235\3719\314ziCi\253\305\336\rn\221v\215\343\230E\351G8d-\353# \336\360\nxE2*\316*i(8\345\226\365E\370\333?\234\204\205\223\340\246\246\b\002\231\0163\035n\372a%8E\013'C\221\331T\326\360\022\210\303L0zHI\314\372H\332\246k\224k\233\356E\250\3330\322\237\324\202\217\366\221\221&~Y\027\223@\034F1\206$\360J\326p\321\316\243\022cI\326\027\201\r>\001\017\035&\372\213U.\021#%\243\254\225Y \016\017i"
+	.string	"\253j+\353\026\013\003\301A"
+	.string	"x\262\321\266\374\222\224\t\021!l\377p\f\307I\271W(\006z\362\240\207h\314\035e}\021d\\\271\242\224s\341\341\013\357\260\216/.\352H\326\027AYEY%\031\347R\264\363\256\250d\013\253\360\301e\375\003\024\356_yx\250\264Q\024\212\201^P \346\345\365V\b\224\365\017\220\304\320\260E\bJ\267\026~zA\244HQ\022\376e\206-\231\313f\375\003\310\330\2772\260\305*\003\225\204\257P\f$\365\301Y\374\304\314\320\315PJW\326J\302_)\250\034D&\346\252\243\323\236\215$Y\277\240\265M\367\007\b\332\277\022P\t\230\3143\n\305@/>P@\223\030W\3267"
+	.ascii	"\337\376\225\177\312\277\344\022dQ\373$\230W%\353bp\005\225\265"
+	.ascii	"'O\224}/\n\305@@\336\342\370\t\203c\232aTQ\3267\300\325\376\225"
+	.ascii	"|J>e\237[\264\247\\\375e\343\370\t\003=\204\006\223\246\276\027"
+	.ascii	"\017\360\304\325I\3267@\274\177e\223+\367~\245\236\322I\206\222"
+	.ascii	"\001\261\250\3200k\335\3266]e\036\210+\233\030\035\255Me\375"
+	.ascii	"!m\323\275S\342e9.%qY?\204'wtt\312\272\226G\374\003B \027XX\034"
+	.ascii	"GaP,\322E\245)*\271CIQ\222\254\037\202\222\375+\225\274\305*"
+	.ascii	"\225(\227\244P\0257e\340\305c\357\020\206\002\005\264u\344Ea"
+	.ascii	"\223\254\037\002\220\375+\217\264X"
+	.string	"\345\021\245\334\027\336a][\347\365ct\314\241D\202\364\312U\310(ezoY\357\020l\354_Y\344\312\270?\251\24742d\312\265+\353|m\235\256R\r\304\225E\350\270\200\250\262\276\322\255U\302\265X%\234\322\355\031\0035i\340\264\264\002\203\207\260b+\3356Q\b)*\310DFt@\211\202\327\b\353\210(\205\\\331\366g4\345\020*\036<\236\262n\227Z\247\233\255@\\)\204I\314\007\220\265+\203\374J6%\220\022\276\244\\d\235\371Z\247\253\301\017\020W\256=Y\025\245e\235A\333t\225\330_\251\246\364\221\241|\322\314\022\263\316Z\255\323\025@\333t\217)@\\\331\243\bEQ\r%\217_\351\244L\313P2 \251\3440\242#\353\274\366+\311\310\224g-\2178\305\263\b\323\223\007\245\034\034\332\020\263+\317\216\331\"ldY+\313\336\240\243[\235\022(G\377_\267.E\225\303\254_"
+	.string	"+[\207\016\345\330Y\3428N\226\301)\305\256\034\313R\361\221P\326\3120\343V\323\317 \326\331\327\223\214\254_"
+	.string	"\301\215C\231\0039W\344\305\305\004\307\227\362F\222\254R`\326J/\266\2416$Y\277"
+	.string	"E\366\257\354j\261\312\253q\007\0214\247\254_\330\302\375\177\215WR\240\270\321h\261J\032J\033\317\252\270\351\0031/&s[mjH\214\274\177\312\032[PKM\211[\326\307\270u\272/@\016\261\245;2.\255\254\225[\2772K\251u\344\212\b]\326\331\260u\272\033\264MW\031\003\304\2252\326`\320\300f\375\241m\272J\254?I\247\274b\021\303 \312\272}j\235\256\322\252"
+	.string	"q\3365\353\027\240\206\262J\031u%\325\257\224RN\341\241\230\212\312Z_[\247{l\333t\225P \256\214R\352\202\002\224\365}<]\371\342O\002*]$m9\025\311:\277\265NW\351\004\342\312'\024Ul?\262\266\240m\272\312\026,\230H1\314:\351\003\304\225,N\024\035.e\375+\231\232\224*\004\225\232vd\255\321Z\247\373\265\266\351*\227@\\\3114\326\343\212]\326\377\201te\212_\231\244T\312P2\\[\020Me]\324j\235.\bm\323U\036\201\270\022)YDH\022(Y\177\240<q%\212_Y\2444\312P2\360}\305H\313Z\313\265N\367A\332\246\253$\002q\345\211e\023\0346hd} m\323U\376(\177\224B-\007qP\036\334\005.\360\224A-V)\264Bh\t\220\254\225@\005\230\332W\222\211\331\351\350FS\326/"
+	.string	"\323\225d\225\233\030?\214d\375\002\024%\021\241d\210c\2644\033q\311\303\fe#i\006\220\254\243\246\340\245h\2322%Y\330\362\210\177\222\200L3p\314]\031\215e}\002\020J)\234\303:\302\226u\222\260U\002\n\375ie}\002\350\355?\231M\006&\005\217N\252\200\275\310:\313\265N\027\003@\020Ofa\020\t\321\221\365\005m\323M\376-\211\234`[\222\365\tP\267\377\344\223'\241<C\311\340\266\203LE\326I?\020O>\361\363\033\314\313:"
+	.ascii	"D\236\354\313P2\304\224\020\nJt\362$\337\177\314&\367\210\250"
+	.ascii	"\245\235\310:\207\265N7\251\007\342I'F3\2603\247\254\007p\327"
+	.ascii	"b\223w\311<\017U\261\n\017b^:\242\334\024|8\216\222y\177\022"
+	.ascii	"/\311\244x\330\026\237\334Uee\355r\327:\335\\\243m\272'@\332"
+	.ascii	"N\332=C\311\240$\006\022\245\254\223t \236\254\013\262\304JW"
+	.ascii	"\326\315\266\351\266\330\244\222\344\022\017U@_\b8K\343\002+"
+	.ascii	"\256\b\233\021#'\227\024\235\264\f\b\202\325\225\365\t@\265\377"
+	.ascii	"$\222\267\330$\222\244\034\002\212\374\bf\221pFz\034\301vr1\220"
+	.ascii	"\262>\001\216\366\2374\322b\223F\222q)\23411\2313>\305\271\345"
+	.ascii	"e\235\214C\313UszMsY\037\204\301\375'\211<y\024r\007\310\224"
+	.ascii	"u\322\013\304\223D\252\300t\\\271=\t\367'q$\337\260>\200\232"
+	.ascii	"d\335j\265N\027y\007\342I\267+G\224\204<\331\366\357\"\311!/"
+	.ascii	"\370\224\254\262n\371Z\247\353b\201xR\210\021\254\205\013\033"
+	.ascii	"@\236\fb\304\304pE\326I3\020O\002\231aUFc\255\305&\327\364\317"
+	.ascii	"[\024\307L\037\004z\2315\031\306KK\030\034\204\276\375'\325\236"
+	.ascii	"\374\361'}$\261?^H\310\262\316O\255\323\235\240m\272E9\020O\252"
+	.ascii	"\035}\004\322\305\311\036K+6\216\354\262N\362\200\243n`\305\310"
+	.ascii	"Z\023\202x2\315\350b\211\025\215$\332\2374K\236e(\031\254\336"
+	.ascii	"\320\206d\335\312\265Nw\246m\272;\222d\256`\354\024\225\365A"
+	.ascii	"\200\333\221\034\373\367\220\244X\206\222\001h\306\214\254\333"
+	.ascii	"\265\326\351\346\" \236\fS\026i\342\201$GW\022,C\311\220fWE,"
+	.ascii	"\353\366\332:\335$\016\020O\346`Jq\375<"
+	.string	"e\355\274>\371\365'\275\2227\2143V\264M\311\272\215\351\002\361\344\025\326\252\001\346\2265\214\215'\271~c\221\326lI\222<\304\254\2216vbb\221\255\254\2235\376\344\214$\215\f%C\032\232\020Q\326\305\260\326\351\026\240m\272I-\020On\201\205\r\241\312\232"
+	.ascii	"m\323Mf\375H\031m\332\r\211V\246d\255\273@<)\243\356H\366\f\306"
+	.ascii	"[l\022F\022\313CU\334\364\301`\221+O\206q\374\204\20121E\033"
+	.ascii	"V\326\311\253\247\033i\177Y\037\004\265}\020n\354?i\225\254*"
+	.ascii	"lB\247\202\352\311\252\353\265\tje\355\026\001\361$U\231\214"
+	.ascii	"\242\031\311\251\267\321\371\220!\365d\024\r\034R\260Y'\243\216"
+	.ascii	">\222\254\254\310:\371B\t\343\304\224+Y']\270Fp\342a\242Z\262"
+	.ascii	")\251\342\311\025O\256H:=\305?\201 \304\375\2305\031\306OK\036"
+	.ascii	"\222Np\"\217(\200Y'Y\374\017\371d\306\213\035P\377\337\034e\356"
+	.ascii	"\310U\326\007a\306\376\337>\377n\f\264\024\307q\223\021-^\nR"
+	.ascii	"\272\177\373\326\330\266\036~\270-\266\022\374\327\027\241F\n"
+	.ascii	"q,\025\327$\216\343\226p\177\271\001AE\020\377\277\2078\376i"
+	.ascii	"\3438^*R\203\361\323R\244\006\024\027"
+	.string	"\371\270cj)R\203\301T\204\026[\305\304jXq\021Z\325\217\256\372\211\343\370'\307h\261\020\f\246X\250\352\247\247\b-^\212\321\252~Xb!&\226\"4\240\237\"5\030Lm\221Z\025S\221Z\025SK,\024\377\304B@V[\250\212\251h\256\212\211\245H\r\210\251H\b\006S\213V\025\267xE\320`\374\020\305j@p\034\307Hh\327\037e\034\003-\305?LrR\f#\233\024O\305\355\235\030\032V\034\307?k|WU/ZP|W\204\243*\207(\216\371\342\244\017~\332\037\2648\216O\304A?m\034\023\241-\305qP\225\fOq\034\307Um\223\023K1\034\013\001!\005]U)\211\202\252N\3048\254\3328\216c\246\"\265\253*\020pX\265k\034\204\366\323\026!U\305\327\230\017\306\322V\373i\007a5\032OHI\246\327]\361\312a\225u2EN*%\227\236Lq\264d\n"
+	.string	"Ta\266m"
+	.string	"\230/\202\310\335p5\322\336\021%\306Z\322Q\022Ek\203\t\013\240\254\017\302O\262\350mQ\266v\227\365?\020L\236H\016-\367\336\376bd\375\017\234$\205\320^\236t(e\375\303h\343*qJ\227[7c\216.\353?\031'\036Yq\322\303ub\030\246v\005Y\005\013\016\254.kd\025\344\241\001\f\225\234\3340\264\322b\221U\220\210\372\t_U\031\001\321\372\037\210\355\177\260E\305P\310\216\257k\326S26\256**\353\177\360\264\377#\013\221\204\310\301\026\213\224\202\f|\016\"\210\254\013z\272\3061\032R\n2\213\254\313K\221EJ\311-\242\224\314^\030\"\r\221<\001n\375\017\224\366=\260\262\357A\340\376\221\200\310(gQ\210xd\375\347\305\"\253E\326\367"
+	.ascii	"o\277E[\262\344*W\227\335C>A:A\362!\241 \373Z,\322\017iw\344"
+	.ascii	"\035\022\017\351\207\234C\326\265wZ\f8\242D\211\tdsY&H"
+	.string	"\275\366n\315\004\"vY\244\0372I>j\307\224\314^\204\3051Z\333\207\326\327\264\324\310&\256T\021\037Q\326\367@l#=\350\332mU\353t_\332\246{\017\2506\222\2169\004*\nP\326\367\200i\337\003\243}\017\342\375\016\n\367;x\262\337\301\334\376\221H\220Gn`\347\306\262\216KZ\342\024$\353w\360\266\337\006i\241\264!\211 \205 \201\344\256E\220oH#H\270\026\213$\202d;\022\b2\310\237H\"\356U>\032rE\022y\001\221kV\006\230R\372\"b\350&\311]iCj\244\333\217\354\201T\313G\271jy$n+*k\344\020\020G\266\331`\332C\314\372\200[\273\303[\333t\337\201\324F\372@b[\354\227 \177\034\215\211\304Rbd0\353w\260b\277\375\022\367\003\355\227\2704q\353t\213h<\220iiER\200\240\035\231\366#i\264l\031J\206\031,T\330e\335\356"
+	.ascii	"q$\0323\317\255\220\013y\2064k\361\362\316p \307\220d\3102\344"
+	.ascii	"\016\244X\213E\232!\303\256\311\264S\216\261+\216\035Y\020\300"
+	.ascii	"\304\276\322\016\353\302\342\030\355\036 \315\220:\n\360sXg\214"
+	.ascii	"b\246d\207R\277\003\242}\020U\366A\360\355\203x\333\007\221\266"
+	.ascii	"\017\002l\377\310\033H\257\327\311\337\212\023:n\360\007\225"
+	.ascii	"k\227\006El\310@v\271\345\252\370\205\020\031\\6\222CKsC5\216"
+	.ascii	"\264\361\304.B\244\254\2214@\034Y#)\264\002\bW\326\357\f\344"
+	.ascii	"V|'\203\t2\353\310\255\037\251eL\201\004\365\004\230\365\262"
+	.ascii	"m\272H\031 \216\314\312]kK\226d\r#c \261\334\254N\320e}e\007"
+	.ascii	"\243\310)\353\203\200\261\017"
+	.string	"\302\177\314\361\204\0169\365Fy\247\024\323\226^\270Z\222m1\365&\"\221\212iK\016\270\nr\314\001e\016\371\002\t\003I\205\264B\272@\262@J!\237\220QH'd\013d\025r\005\022\252\305\"\247\220KG2!\233\212c\357\241\\\266J[\212Lv\305\226=\346@\252\250{\377\220S\257\241\222,\242[\326\312\220\353\030r\352\275\"$;\206\234z\251$\311N!\223\220J[\307\025I\2038\f\225g\\?\324 \320\0071\264wU\353t[\241\266\351\236\203\300}\016\3546R\ty\204\026\344'\227\3659\220\333H$\344\021\363\nR\237]\326(\204\\\257S\262>\007B\366\213TBJ\310\342$\327\237\273-\3378\226\223\273\"\207\220@\032L)]\275\031\"\215\220E\310\023H\242\026\213\034B\006\tI\226\241\331!A\352s\300\265\317\001\214}\016\242\3669`\261\317\201\322\376\006V\3667\330\333\337"
+	.ascii	"n\177\003\261\375\r\254\3667`\332\377 e\377C\336\226\342\227"
+	.ascii	"v\007\225\365?\374\330o\311\370\310\262\202\356\325\325\216\354"
+	.ascii	"+\330B)\033|\013_\3027\260\305\276\202o\366\025|\001]\302\244"
+	.ascii	"A\034\257\013\277+'\244\376\007\245\375\017(\366?\374\354g\333"
+	.ascii	"\246{\r\246\354k\240d\377\257_W\034\031\212>\276]W4\203\216\357"
+	.ascii	"\357^^\301\224\305\226\337\275\277NrU<%\316\312\253\007\317\330"
+	.ascii	"\263\203\312\372\032\360\330\377\333\344\315{\363^&/^1\207\222"
+	.ascii	"\240_r(\206\032\223\367\356\265\003z\022\266\227\365\037b\325"
+	.ascii	"\224\254\257\301\215\375\226\315m\307\025I\231\334\033\344m+"
+	.ascii	"\246-\355 =\310\262q\214\366\312\275po\034\212\036\257\334\373"
+	.ascii	"f\244r\t\223\374\346\302\346\336%/\335\233\344U\322b_\271\367"
+	.ascii	"\310\363]r\205W\250\324\327 \305~\006\211\373\177\343\214\264"
+	.ascii	"ng+\342\210\274E\222H^E\230\262~\006\203\233\310[%\257!\300\375"
+	.ascii	"\f\236\354g\220'\344\035\222\305\310\270\226d\375\f\210\b\311"
+	.ascii	"\340\307\376_ \357\232\022<\036~Y\277k\257U\225,\333\373\343"
+	.ascii	"\305\276=^\037\257Z\213}\327^\0360\020\257W\207\327\030\206\331"
+	.ascii	"w\355\270\343Mk\357\264\364\034`\366]{\261\250d\017u\350X\352"
+	.ascii	"g \266\321\220BcTxY?\003\255\255\325\027\204kn\353\315\361\352"
+	.ascii	"x\317\336\262w\307\013\366\206\275f\357\330+\366\342h\261/\331"
+	.ascii	"{\343\273\357\2251\343\245\261,\3061\226]\327\222\253\022\033"
+	.ascii	"Y/\331[\343%{\277"
+	.string	"\236d_\262\327\313"
+	.ascii	"7\222\230\020\321HT_'\236\372\030 \356c\340\267\217\001\335>"
+	.ascii	"\006B\3661\030\333\307\200\306>\006R\373\030\034\2754\214T\373"
+	.ascii	"I\b\251E\326\307@h\377\202\277\375\013\350\366/\300\356\366\255"
+	.ascii	"u\272\277\240k\377\202\253\375\013\234\366/@\332\267\300\312"
+	.ascii	"\376\337\252b\024\025\037Q_/U\321k\352\225\242B\306D.\353\250"
+	.ascii	"d\220\302\0243\262\276\005O\366\213T/\212d\257\223[P\037\324"
+	.ascii	"\353\342}j\261\357\213w\205\220\027o\212\267\251\230\266\264"
+	.ascii	"\333z\360e_\274*2\330\021(\230e\022\315a\t\267~[\264j?\266\020"
+	.ascii	"\263\276\005F^\026\217\341d\214\2675\240\254o\001\217}\013t\274"
+	.ascii	"LK)G\205H\262\276\0050\336%\013\\\354\377Uz\223X\360u\225\005"
+	.ascii	"\340+\211T\326\377\213\364\036\255@\"\232\221\365{\364\242\250"
+	.ascii	"c\272\341\225\365k\024\203]{\313\372\026\374\354{p\345q\305\264"
+	.ascii	"\245\215\2451\226}\205^\242w\350-j\261\357\211\235X\274z\240"
+	.ascii	"Av\215c\264\367\304"
+	.string	"\266\022dG\366=\361\306o\220\006:\340\314\232\362\323\217\277%A/\220\234\322\022\032m\361\213 F\222\274?E\261\251\030/\366\262\276\207*\373\036\232\354{\300\333\3670\267\377]e#\262`:\002\3654ZI\364*<\244\242,\272\201\215\245|S\371\367\224m\230\241dh\223\304bJY\353\242\326\351>\255m\272\305\026 \276\245\230\335\025\006)$\324\221\206E\224\t\241d\2101\345G5\270\005\267\033\320\235\220\"`\013\260\024\201Y\f\n\013\003\312\316n\300}\305\027\307\330\200\217\313J&Wp\350E\371+{\201'%\353\375\367\357'\033J\226R\356\260\252!:\262\206\345\332\246\273\373@|\373)\007\371\324\304\262\346\300\267\357\276\260sNY\277\r\262\344\305\025\215NITV\256\207\326\334S\366n\327!\335\355$dI2V4\331x[o\357\355\274\355d3i\261\373n\333\025\245\234\021\311\262\350{"
+	.string	"\333\367\340\265\357\201\306\276\207\254}\017V\373\036\\\354{`\332\367\200b\377\033\311\221\036\3022?#\337G~}\270\3432\224\f\177/\314fd\335f[\247\273\213\200\3706\262\024\373\221\342\312\272\303&\262\341Z)\273*Pv\3337\334\277\335\366[\222\215ij/k8~k\233\356\036\002\342\273\315m\207\035V\3262[\310\367\217=C!\206Y\357\037\333\fE\266\fi\207\322\025\255\350\332c\253m\266\215\335@\266\217\035d\363\330k-v\377\330iY\262\244\342\365\352h\377\330c)\304\362\236@\374\330g-\234\224\333\204\224\210\3030\216\321\2247\244\346~\274\350W\220d\277\202!\373\025`\367+\360\332\257"
+	.string	"k\277\202\026\373\025"
+	.string	"\355\017@p\177"
+	.string	"w\373\337a\033\007\023\037!\225\254sl\034\3070\300\353\306q\334\261\273h\202\212\342\230\311"
+	.string	"sH\203\207\307\257\215\343\210#\223\t@\020i\3600\307\376\332:6X\213\3358\366\365\333k\3378\346\370\306q\004;\352h\357\326\342\230I\203,\322\340\241a\034\307v\331\"GH\215\214[\247\333V\265M\367\003\320\2617\227T\216\272\301\254?"
+	.string	"\256\335b\3078.9\316\321\f\3051\220\024\322\fI\360j\270\364\303\b\222\340\325p\357\be\f\031\206$x5$;\232\321\004\305q\225\024r\256\205\220\243\222b\332\322\253\344C\353\357n4Fq,\007\205\004C\022\274\032.\245\035\261Z\310#H\202W\303\245\035\343\270v\fR\003I\004I\360j\270\251\366\214]\265\261v\326\256\261e\354\255mc[m\030\233\306\326\332W-v\3078\332\375(v\034\373\323\003\264LF\023\024\307S.\220r1\216Qv\213\020\210\226\036\020\303E6\216\343\035\343Xwt\342C*\033\307h1\216t\031\213f(\216\253\246\220dH\202W\303\035\343x\226\241\212h\327#\326\207\215\342X\214\355\264\247\304\220uH\202W\3038\216a\303\035q\f\b\264T\213c\350\fG\326\027"
+	.string	"\341\376\277\241Z\354\216\332OzGm\027\373\005\215Q\034\003A\035W E\0214\214\343\370yA\013\265$\310N\353\375\342G\035\371\255\257)G\326\027"
+	.string	"\222}\001\364\330\027"
+	.string	"\216\275Y\3100\261\262\200\364\262\276"
+	.string	"\2606\340Q\260\210v=!H)\313\264W\354\246\026\273Ul\025\307\301}\"\004\242\245\026\202\222\262[\305^\372\\\021\315+\216\261\242\\*\244=\"2\027\\\240\261ZI\250\266>\005}\373E\276c\242L{\247\305\200\033A\204\304\262\373\304\221\360x\205&\250h\005\271\237\307-\3378\206\261v\r\032\313\002yh\357\326Lx#\313\356\023{\350q\\a\331}b\3072\355\235V\f\364#"
+	.string	"\026Hys\206;i\247\330E\033i\243\330G[i\033\265\330}b\023\031\261>\f\021]\364)\300\332\247@j\237\002\026\373\024$\355S \264?\201\225\375\t\n\367'xb%\377"
+	.string	"2I\221\365'P\262\377\037\017\217\210-\366X\345(\345\351A\341\321p\371\323\022\307X\177\327c\225#\225\243!\226\006tH;\226\212mO\b}\270\372\023\270\330\377\321pJ\362J\231\324\225)G)K\263.$\254\254?\301\317\276\004\207\373\022\f\356K"
+	.string	"e\377\307\300\037\0053\224\221\315h\311\211\254\217Y\020?\006\026\207\264\220\232\262\256\240m\272\227@o_\202\273}\t\342\374\216O\372\266\r\275(#h~\307\276\265\230\357\310\367c\237\353\367s\344P\354\250\227W\245\005\\W\326\227"
+	.string	"k\277\305\036\233\344\r\301a$\204\311\217yd\312\303\271\272\025Y\277\360\210\367\377]:1s+\202w\267Lb\022\303\270;\332\275R\370\254\354\310\372\022@\355K\260b_\202\2449\260\366\330d$\215H\326\227\200h'Q!\365\243(\353\007 p\337\203!\307\267\254\256#G\271\026{Dr\204\323h\361\021\311\221\3101\216\306(\216a\210-\263H\\S0\020C\304\026\256.r4\302<\262q\202\306W\021\255\375"
+	.string	"\250h;\272\345&\0373\002p\242-"
+	.string	"\361~\004\177G m\236\224C\243\254\037A\335\221-\202\270\375\b\202\354\377\210\365\261\206\006W\224\265Z\021\017\007\024\222\254\037A\332>\3668\362\030\003\fZ\312\372\021\350\330\217\340\306~\0041\366#x\332\377\261\354G\263\267p2\304\264(Y\242\312\272\003\020?\226\031\261\242\222\365#`\332\217 i\357\242\266\351>\202x\037u\334-g\273\300)\303\254\017"
+	.ascii	"*\273\215\355v\273t\274\341\265\313\314\016\313\274\356\036]"
+	.ascii	"9U\271\035\257\307.\277\030mC\\?v\375\232L;\265pm\023\022\030"
+	.ascii	"]Y\267@@\374\310\245\261\244\244\270\221\365\177\264q\254\261"
+	.ascii	"\303\211\337Y\326\307\032\177\261\305\221F\226RV\355`q\002(k"
+	.ascii	"\035\037g\034\245\202\300\211)\311\372\036\034\2032X\214(Y\262"
+	.ascii	"\023~\331#P\f@\252!(\331$%W\020\307\243\271\353\224=\027n\242"
+	.ascii	"\225k\214x\230\304W\304\227\315\330\237\303\354\321\351xutqd"
+	.ascii	":V\035\243\216OG\250#\213#\214\243\325q\352\230u\334:\2528\312"
+	.ascii	"8\2668j\035\251\216M\307\025G\254\343\213c\214\026{\224:*\375"
+	.ascii	"\230\342\270\364L\205\230\261\254\024e\221\226\030>e\253\374"
+	.ascii	"@\221\225\362\202\350I6c\335+\031\254\310\017\342\210\242\205"
+	.ascii	"\213A\227\025\312X\177G\251\243\221]\366(\345R\t\034\274"
+	.string	"\362\004\247\261\330\212\321\201\316U\255\323\245\240m\272\007\200\216}"
+	.ascii	"\264\330\007\200\320>\004R\366!\360\333\207\340\310>\004<\366"
+	.ascii	"!\260\261\017\301\212\375\016\211\373\035\234\354w8\262\337a"
+	.ascii	"m\277\203\330~\207\031\373\035\236\366;\f\355\323\374\355\323"
+	.ascii	"\310\355\323\364\330\247\251\261O3\265Os\264?C\270?C\244\320"
+	.ascii	"%<\302\n4\312\332%\374\005\201.\344\262n\317@\334\035|;BTE0+"
+	.ascii	"\365\024\027\311\372-\031\224(@7\320\375s\243\264X7\373'R8\\"
+	.ascii	"\253\027Y\367\353\353F\342\222K\027c\n\026\251?\263c\177F\313"
+	.ascii	"\217\t\342\230`\326\367"
+	.string	"`n\356\310[\224 r|W$}E\222\330]\225\354\271w.\236[\347\362\271z\256\023\267\211\233\347\332\271}-\326e\342\322\245\021\201\002\007\202\313\304]B\227u\231\270F\334\270!^3p\030^p\314\263r\002\370\324\237q\261?c\264\317a\312>\007(\373\034\346\3669`\3679\204\355s\260\332\277.s\213\024\371\334\"!\0308\262>\007\246\355\266M\367\034P\354\313L\331\227\321ss\265\220?\222 \266h\033\322\006\271\313\256\r\201\222\241\312\236\223+!l+\252$a\312z\314\025\243@\007\223\304%C3\030=\334\037\256\232\213\346b\33547\210\273\346\362p}\270@Z\254\313\366\027\253\3343\020vx\271VA\2568\\+1\240\304%C6\267,K\321\004\025\305@0<\350\270\221\270dx\303\265\002\222\275\336\255\230\266\004C\224'\004\353\262\271d\231,\207+\306\346~\271VK!\264\230\311"
+	.ascii	"M\211Ka\317\227\212\236^\326S\027e\346\366e\336\366e\260\373"
+	.ascii	"2:\366e\262\266\013\346\352h\261\217s\303b&\023I!\325[\326\227"
+	.ascii	"\201\332%\3428\216\333\307\271\307\307\271\2271\332\177J\331"
+	.ascii	"\177\342\355?\261\373\317\256\375g\213\375\273]\\g8\222Pd\355"
+	.ascii	"\332\330~}W\224d\375'\320~KF\345Z\331\200Q\343\252\345\312p\263"
+	.ascii	"\362\270\256\256\226{\225\217\230B\310q#q\311\320\235\341\326"
+	.ascii	"pi\270[-\326\325\372],7\306qp\360o\0062\353\256U\256\212c!<\206"
+	.ascii	"\334(\262\333\273\326"
+	.string	"\351\322\264M\3671C\366c\314\266[\245\004j\321\206\227\365cr\354\307t\355\337\235\222r^\031rI=K\025\235\244\320\201\215\202\322\363\343+\314\332\205\372\335'\327\205\373\342X\025dj\006S\312\234\222X\326'\022\267N\027Y\3256\335L\005\304]'0\267&:\262F\372i\321\230\342\262p\217\220@\350\3423w\205\253\342\230\347\206\307\303U\3416)\221>\340\256T\262fz\026\207\210~\316\262~L\324\376\357*\271)Z\254\273\344\"\tq\227\\\024\356Q\f1w\311Mj\217 \365\306P\2740|YH\265\035\271\3721L\3730W\366\357\036\271BN\262U\206d}\230)\373w\215\332#E\024e\204nE\356\211\370\245#{\213Bt\367\304\205`!3\314\260\262v\207@\334%\202\345\262\262Y\003\240m\272hOEC\314\334 \027\350\205U\f\024?w\201\324\332\264fd\263n\211\200\270\373\203"
+	.ascii	"\032XcY\377nlL\f\273\003\032\314\372\n\032\334\225M\241\225\365"
+	.ascii	"a\350\214U\214\210-\326h\305H\305\212\361\320h\245x-c\342\002"
+	.ascii	"cZ\335\320c\341\352\303\310\355\303\230\355\337hh\234b\\\272"
+	.ascii	"\032m\215\030d\222&E\211\261\320H\250\006e\307\217\254\007a%"
+	.ascii	"VV<e}\230\260\375\337\2305\002\032\003[\254Q\320\370\007\245"
+	.ascii	"=2v\215c\265{`\0244Fi\217\264wO\b8B\326\222\031\005\215O\262"
+	.ascii	"\0242\353\206`\025C\370\316\305\016\250\255\017\323\264\017\203"
+	.ascii	"\264\017C\264\357\274\342\327'\305\362\022\313\232\017\t%\311"
+	.ascii	"XW\326w6\331\367\200\316h\327\007B\257\370\347\327\304\230gd"
+	.ascii	"btb\334k\261F=\343\035\236\321\356\352/k\3243&1\316]A\311\032"
+	.ascii	"\365\212P2`{\367\024\003\001qPv}b\346\366\200\312\033\242\324"
+	.ascii	"w.\331w\246mc\335[\365\242\007P\326w\212\355;o\030\227\344*v"
+	.ascii	"{^Y\337)\303\250\304\031\265\177\243\034\222\036J\306\200\262"
+	.ascii	"6\"9\022\347D\206Y]\326\306\270g(\031\342X\b\325\n(&Y\033\213"
+	.ascii	"\200\270\321\210{\205\312\321Z\326L#\021#\234\221\217\212\213"
+	.ascii	"%#\034\324\276sB\303\313\370ft[\322\205\344'\353\266\270!\034"
+	.ascii	"S\262\276\223igA\242\303\253\212:#\300\214]\352\273\236\240\342"
+	.ascii	"Td\bt\345*x\364w\025\374I$[A\227\261J~\327\027n\036$\345\257"
+	.ascii	"\366\356\t\001aO\262Y0\310\312Up\b1\333\224\261\226\3068\256"
+	.ascii	"\262\273\006i\261$[\314Z\265p@\214]F0\243\017\343\017#\232\221"
+	.ascii	"\313xf\034bd3\256\031\203\030i\030\261\306\031\3064c\017#\020"
+	.ascii	"c\r\243\231Q\210Q\315x5\226\031\277\214c\3060#\017#\016\343\r"
+	.ascii	"\243\227Q\314Hf\314a\264a\324\321b\215;\2142n\3142j]?\265pI4"
+	.ascii	"\215\037D\225\221*\310\325\205\234q\207\021\313\030\243\275{"
+	.ascii	"Ja\354\254\312\270\303\030"
+	.string	"\027eA\300`3\246\200jsR\222\366\203\210\032r\2252R\t\341c1W\254\3322\272\262\tU\271^\255e3\326\270\303\310\304\227E\321\302-\213q<\025\345\032\307h\202\306\035F$\033<\366\016\227\177~\202\204)\350\2774\331E\264\326\351\206\360\222\304\030C\2068\346\370\225\250$\230\365_\212\354\277\244\355\277t\355\277`\355\277\004m\343\224nA\027\203+\3537\021\367\233L\366\233o\373M\034\373\315\254\375f\324~si\277\211b\277\371\263\357b\270\357\242\267\357\"d\337\005m\337\005\307\276\013\326~\266u\272wQ\332w\001\332o\311\356\267\024\331o\371\332oi\261\317re\237\005o\237\345l\237%\306>\213\323>\313\211}\246\341>\223o\2379d\377:Q_i\023\375\232\234h\304\353+\277\256\242\255X\311\021\016\311\232i\3306]}\b\342\0321iE\210 P\326\020P1,BkI\306\361"
+	.string	"\374\313ZO\331mG\331\254\317<\223R\250LK\241\002\207\036\274.\3745\241\246\321\001\322VV\326\311\266\351\026\001A\\\017\272aE\210c\202\2018\202\024\202e\235E\023B\244H6)\3533o\354{\260\367t\205\242\237\350?\r\330bu\024\315\367\214\325}\327hq,\304\211\213\"\225\337\335\226B,\361Q\020\3245\212\326\273[{\267\026\017\245e\360euXg\030\307\361\005t/\352\220\220\372L\025\273\215[\247{&\321\376\322\312\376\322p\177)\270\177\335D\347%{H9\213B\363`\203\353O3\321pV~\324\222\340\351\2736\261\260\035\372\356(\273zoBtY\353\2721'<\374\262\246{_"
+	.string	"N\355\310\372\313\274\375_'\321J\364\222\026\253\347t\334\365\021\215dN\367\320F\212iK,\f\035\025\307\3464\217\214\345\003\25186\247\345Z8\275\244k\034\243E\301\212\223\332\372K\"\333\255j\235\356\233\264M\367\313\036\373\327j\327F\256\213d\r\210\002\354G\326D\212\332\276\346\262\376\362\272\335t\020\375\246\205\3506=\244\305j8\315\206\265r\005\222\bW$C\204\323k\207Y\247\037U\364\324\017B\303i\037\013\300\023\314\2061\211\270"
+	.ascii	"\254[\352/\343}\370o\037\276\333\207\333\366a\262}8\306\326R"
+	.ascii	" \256\325 \030"
+	.ascii	"\022\007\227\365a\027\373pP\032Z\266E\223\3008\037/\210\316\314"
+	.ascii	"\366\031\221,\257\262k\263g\260\266Jh\311)*kM\006\342\272\254"
+	.ascii	"\310\307\004\307\"k\243\336!s\324\001G%cLl\206\0351\220\254\303"
+	.ascii	"\220I\362\210Vd}\245\224\375\226L\327\200\242\277\264\215>\276"
+	.ascii	"\f"
+	.string	"\346w\325_-\224\fv\365$\253\275\364\r\255C\343\32094X\213\325_\232\353\272\253HU\314\272\370\243\361\245\257Q\262q\034\037\315\230\b\361\226\372\312\274\255<\262\257\304\356+\317\366\345\364\f\275\365\006\2445\224\265\226\262\311\013B\270\254\257\274\261\177\235e\205g%eF\326/\362\265X\273>\225e\371\362\227\331U;\265P\316\240\306\264\f}\245\261t\f]\245\2514\214\026\253\255t\324\265\224\236z\213\346\"\177\005\221e\265\225~\341\305d\356U\362\001\024\304\242Ch\235\356\261m\272W\032\355'\021\367\223\200\373I\277\375d\223\355\341n\377\232\005R\020\260\"\244\254\177\275B\253\350ks\262\227\265n\"T\261\343,\353'\221\354 !W\235\244\231t\n\255\324b\365\322\237\005\365\220P\226\n\201h\351=\341\025\344\232\235\262T\017RU\354\262\342\207\027[6\216\321\2264\221F\n\201h)\026\362\341E"
+	.string	"\027xfM\206F\277,C+\244\3765\222>r\313\272\033\222\265FQ\214\305\260\330\254\237\304\261\177]\324b\265\3212\255\310QW\326\372D>:UyJ\314\372\205Y\354\377\2534\\\303\n\311\372\311\255\235\223R\373\311\247\375k \375\203\274q\027\204\360\312\365\317_L\3241s\251\t`\215\254Y\342\326\351\346\270m\272E+ ^\274\242D\201\302\2130\3536\261X\305\003\025'Aa\210\305C\250\264\"CYS\331\001n6\330\362\362`\324\236;.\273J\022#\335\270\372\262\263{\342q\320\306'~\\\311e\215V|\2037\236w\177\342\351\321 \343"
+	.string	"\324\223\356I\007\217\261e5\026\361\bX\326\347@\3223\3113\311sI\224\324\224\247\244\340_W\216\247\222?\227(\343>\036XE\033(|\"y\")\300\317\f\034azJ\333\n\301\276\2708\345\265\345\021\247\360"
+	.string	"o\006\2160\242\253\034OY\177\003rE\212(\257oT;\216\030\272\361(\362\366b\310\207<\rp\235\002lr\tc4\032O\270\347\233\022\242\237\333\363\355\351F\005\233&t\025o\300\242\256\303g\033r\211\212Q\032\224\254\277\201\023\317 \317 7\246"
+	.ascii	"\233\f\215B]IH\262\376\rQ\236>\236>\236l-\2178E\207\025RNn\310"
+	.ascii	"\fM\341{\256\375\311\366A\331\030\215\254\237?\036\227\257\232"
+	.ascii	"\242\256Y?\261\333\r\354j\345\206\276\347\331\363\354\331\343"
+	.ascii	"Y\3653\230A\\\240\362\252p\350\354\211\366g\217'\217*D\342\037"
+	.ascii	"O\036\3174\343\235\222\0260d\326\22405\r\301\303\0161\262c\307"
+	.ascii	"\263\354\271\343\262\030gY\036FFeO\262?\313\360\364\232\212p"
+	.ascii	"\3408\216\247\030\007m|\"\310\220Y\366\205\343A\224"
+	.string	"}\346\370S\354\031&hvh\367\f{\352Psq\205-*\376q\347\302\305\023\354]\361D\ni\233\032\273a\305\214\031\317\033\317\252\237@\004$\361\022\314\232I)R\347\365\347\2157\350\235!\206\224#\353\347\365u\232\202e\367\225\365\263\353m\362\201\325\366\225\365\223\2538\305\334\362\033+\312\372i\343\177BX^K\262~\326\310GdSD\222d\375\244Q\374j\021\337\234\030u\025\261[zfY\377\206\241\0301\236Z/\256\306- boY\177j\375\f\321Y\311\372)\343\rz\222tuQ\374:6!yc\23225\365\274jY\320\202\364\242\256lX%\030\177^]\005\001\274f\375\264z\203\216N\220\344\254\262~R=\253\222TV\034\315=\253\224g7\204\236\206L\344=\235\236NO\021^2\242\230z=\240\024\201\3723\212\b\217\206\221\254\237/\336 \244\217\036(\022\263~>=]$\007U"
+	.ascii	"V=](\307^\320\220\222\304\004\220'\213'\013x\3145\224\002\223"
+	.ascii	"\213RG$.S\372\237JO\025aM\262$\27797\310\252I\3063\305\237*\236"
+	.ascii	"MyR\320\210<\233\236L"
+	.string	"w>\306t\324\035QbdI\326\317\245\367\b]\025\"Lb<Q<Q<\221\be \036=\217\376D\212\231\262b\251F\237\221\312\335\023\254\201\365\342)\364\024z\026\315-\371\210\030\262\235\370\263\350\255\262\005\324#\353'Q\314\224<'\2738\353\347\220\022\254\310\347\224V\305\204\212\030+1V\236@GC*\031\207A\264\022i<\177\376\004\212\262W\230v\225\3653\216\231\222\303\312\231V\"\017\025Y\307\\a\376\035a1\230\365M\024\355\227@\214A\214A\214\241\362\344\252\241P\255Ae\375\022Rb\nc\nc\250\030\241\222q(f\225\304\3601T\222nWZCS\336\023(\022a\374/F\312\243\320\230kQ\226\365K\310\355\227(\0223\0303\3702\270\343\347\260N\207\324\0219\037P\240\304\004\322\341\tf\341\025=\270\264\262\217\t\034\222\2016\225u\f\340\033\224\273\264\334\262Y\307Dy\203\270\350"
+	.string	"\251\262\216\371S~\t\345\371H\362U\204\016\206\330\327\335c\230\334\305\3701\345\236SH\270\250\303*\360\224\"\331\246\030\275\307\370=\246\257\003\020\262\030\363L\214\220)\353\030\276\230\275\030'1M\262\230\021\217\352J(\353\230\274\030\274\0224b\346b\346b\352\242\004\t\303Z=\241\300%\272\307\324\225\205IYQb*FI\214\022\330oE\224 \241\341\016\353\372\021\225\365K\244@\202$F\356Y\365\023\250AS\224 \241a+\005v\205!\327\245\306\003o)\353\227"
+	.string	"*R$&\256H\032\2239f\233\321\016+#\217\211\313\210R\200\344\260!\273\366\030 k1p/\306\224\265\331\254\255!1C\036\003\367\2307f\025A\267\303\254\037\343V\\3\022\245-\353\230\266\227\037@H[jY\377\203\322\212\226\020\025Y\307\bQ\316\240\241\304(E\3261A\234\210OW~TT\336E\303\n\212\254c\330\366|\370\210\301J\271-\246\256D\025\225,\321\235a\223D8\212\322\220\262\276\rb=z\304\270 \273^WD\361e}\033j\244\245y\2202u\210C\203\023VeY\277\006\304\263\263\2302 W0\240''1d1d1e\001h\232\222\322\342\315k\022\205\243,J\013\267\255\244\254_CW\314X\314X\f\362\311\3510*\214P\320\354\232\365k\270\332r[.&lIj\360\210\316:,\363\013\373;"
+	.ascii	"!i\205\212\213*+Y\343\300\021\003\326\"I\306\212\260\342\020"
+	.ascii	"\337\222!9\036\003\206\301X\223Z\r+bh\304\320\210\271\361\254"
+	.ascii	"\372)t\225$\311X\301\214\023\362\303\306x=\346\006\016$JLY\307"
+	.ascii	"\\\263\030\2240%\034]0\344\220#\322\305\345\342\025\302\255\250"
+	.ascii	"\021c#j\311\233W\326\257\301h\307\324\330vTRNrY\337\247pk+&\352"
+	.ascii	"m\n\260\211H\224\037\033Y\337\207-F\214\230\254g\325O\340\007"
+	.ascii	"V`\260U\311\3052\036\223\345\212\005\361A\347\003vu\025\023\245"
+	.ascii	"\242)q)*\351\304\220\254\357\363\242\252*\306j\352\330b\312\211"
+	.ascii	"\021\255\025(%h%\025\207\324f\230\365}\204b\246b\246^\006\257"
+	.ascii	"\354\262@tV\266\262\2765\033\003\025\003\025\023\0256\345\304"
+	.ascii	"H\330+\005\304\005\\\024\026\222F\032"
+	.string	"\221\025\332\323\237b\\<\253~\002-"
+	.ascii	"\233b\"\305\330\004J\222 \027~:\356\272\262\276\025(\206E\f\213"
+	.ascii	"\230\026\\.\231\323a\224a\021\211\205\021\0341-\376\016@\200"
+	.ascii	"\215\242\324\331)\311\372U(1J\217a\212Q\212Q\241\361\242<h\261"
+	.ascii	"*\027.b\232"
+	.string	"\036\243\"\256\251J-\316\372\205\036\230(\260R\202\262\216Y\212IQ\255\213A\212A\372@S\342RXX!Y\341\r\241\013\305\240hy\304)6\300$q)L\351\003k\206\024c\364\030\024\205UN\250\262~aL\321\377\227\303S\026\222\230\242\230\0237\322f\270\310:\206\250\030(\225\344.\353W\253b\206\252)b\342\2308\006(\021H\367A%\241\305\374<\006h\b\305\020\023%\2148#8\236@1<L\025C\230+G#\317\255&\342\324\227\241a\\\024\345\001G\006\325\234\225\303\\\231K\364\361\006\303\255M\fH\3260\210\307=\275%<\262\20694B\251x\202\203\312\377*\265\346\352\004\263>\025l\237\332%E\n\214]\313\304#q)\314\013{\2420\353SW\020\236\020\036{\356\270\214M)\033\204on\212\240 \354G$qIKi\033D1\327\327\007\223}\"\n&.\031\272R\b\005\237"
+	.ascii	"\036&\273\\B\234\361\2265L\224\b\332r\304\3703\022\371\241J\372"
+	.ascii	"\203\262\263C\006\255\374`\236l\243'\032\200\3330~\032\360\201"
+	.ascii	"\207\007\263\347d\272\221\270\224\rs\300\360sr\230\2756.\210"
+	.ascii	"\220+k\030=%\f\251%X\034Y\3034\311dK\241 >/\230\274W\017\217"
+	.ascii	"\210\034L\036\f\023\370J\025\034Pp8\266\324\262\276\006\256t"
+	.ascii	"t0v\255\241\024\242aX]\231_\221\272\303\330mAa\361D\003QK~\230"
+	.ascii	"%\360\230\225\353\017\267\277\300\254\257\001#$H`\222 e\343\370"
+	.ascii	"\311\203\013WlG\344\016\223\344J\302D+\2100n;K.)\f\260H\021\230"
+	.ascii	"8\016\332\370\204[\217\242\367\204\337\025\n\030#\207\211\203"
+	.ascii	"\t\362\006\370\006\245G\016{,\f\334s\307e=\222\262G2\240\354"
+	.ascii	"\336\333a\340j\030\241e\r#\004\306\215\2200\317\315\255-\256"
+	.ascii	"mN(k\230!\\vDIY\277\207\307~!L\220\244\033dvA\200\264\001\251"
+	.ascii	"\200\2225[\016\034E+\262~O\215\275\006\363\203I%J\n\252\254\337"
+	.ascii	"\323b\177j\245G\017\030\265\226\005-\310/1\273\004L\361g\246"
+	.ascii	"\226\303\257\314+\353O\233\300\224\301\224\301\244=\253~\004"
+	.ascii	"\023PE\n\321\220i\005u\225\001\223\006\203f%\021\206X\3260g\031"
+	.ascii	"\212\211\206\\\326\237\312\2001\233\246\330\261#\353\372pS\222"
+	.ascii	"TE\207\016\030\261g\325\217\224\343\222\324\224'\303\374b\260"
+	.ascii	"nF\330a\304\256\020\025*\343\377/\007~4\270\262>\017\035L\016"
+	.ascii	"\230\034NB)A9\303\032UUp\264yy\301|\265<\342\024%\244\006\217"
+	.ascii	"\204-\373\242\324\275\200\271q\230/\244\337\020\333\232\025%"
+	.ascii	"iLM\262>\217\r\230.\230.xLJPn\037\311H\003b\305\206\215\227l"
+	.ascii	";\026\2258\025\2465\b4\230\365w\364h\320\200\307\236^L3p\030"
+	.ascii	")\002\223J\022#\006\314\026\007m|\002\353#)\373&Y\245\275\320"
+	.ascii	":\314V>R\306\310\253q\225\205\366\023G\311\202\221\361\nBy\""
+	.ascii	"\264\f\202\272fe\375\0355\030+\030+\230\253\"?2\242\244\244\300"
+	.ascii	"\341\004\003\3430W-\334\212$<d\354\210\301P\301P1\035\326q\r"
+	.ascii	"qk\313\372;U0/`^\300H!\211\237\230\265~K_;`\242\016#E\345\320"
+	.ascii	"\312Y\3260P-\210K\025R\256\324\310\372\205-\210\207NM4\262\276"
+	.ascii	"N\025\030\0250*`\236Z\036q\212#[\223`\225 \2069~`V\034\346\t"
+	.ascii	"\306\211\r1\360\013\306\t\246E\223\341Q\216A\264L\344\225\"\013"
+	.ascii	"\206\205\361\317\n\321\317h\007\207\375\351\271\370SR\202a\242"
+	.ascii	"\251\"\345\344FQ\r\f0m\3510L\305\2715\242\304\254aR\334\315*"
+	.ascii	"\333\364BG\r\246\b\246\b\006"
+	.string	"\351Y\030\310\005\006\267\001Z\231\2029:\f\022\221A+\265\254_\b\203\242\250\307td\006\f\n\030#\346R\0231%.Q\023\250\254\257C\005\363\003\363\003C\024\007'\2305\334A\003\017\b\3500D\177\007 \300\f]\261\fOd\375\303\f\301\b\t9\322#\242\214q%\t L\220f\233\371+\032R\245\360\316)\316Bg\342Xr\t\322I\024\227\214*w&\336y\245\003\020\276$ih\314\205\225C'bP\013\026Y*\n\311\367\342\304\224\254\235\206N*^DJ\f\305`\276\035\210)\244\320@\350\214\342\214\342\344\200\356\307\035B\370u\005\274s\320)(DF\225\027Y;\003\223\1774\340bd}\032\372\234Y\032\342\374\374\234PZ\036q\212\2278+\301lv\321&\344\367\344N(\257Z\023\033?N\377\337\226\241\237\256\254O\303\031\335\235wtN>f\221\313$\346\007f$\357N\276;\367:"
+	.ascii	"\341qB\370\256ZY;\235\3505ar@\245\0228C\250\254\235xvu4\2049"
+	.ascii	"\2278\227\300c\317\2624\035Q{"
+	.string	"RP\244\262>\rRow\022ys&):AL\246\035\245\341\305\335\231\344N\271\016@\370\337\016\003s\002\224\265\023\311\021\247\221\377e\034\177H\201Y;\213<N\371\264g\230\005GC\213\266\266\027\027-\2178E\fx\202\331\375\302\207\0356+D\b<\326\362\210S\034\233\244\300\344\302\342\370\311\203\211\247B\"Y?\003\330\2655'\220&c\224\261\243@\266;\201D\021\002\207\246\244\354\377{\001\0319\340\262~\006\270\234jN5'\366Y\365#\370A`\225\340\033\020\035w\203>\356\3042\241h\252()\255\265\3033\026;\262\314\356D3s\3620\232\025[`\353\224\244\335\311\303O\360'(\353'\273\314\260\354\262v\236\255\b\273s,\314If,\213\343 \016\320\202\370\244\020f\351\355\270\223\254\b\f\253\303)\226\201 '\327\235^N.'\030s\215\212\203\035<\344\205X\225\363\306\235`w\346\350"
+	.string	"\204d\024X)\016\206\224\254\2358\234_\316kW\025\247\325\235XN+g\r\246\220\300\250)G\220C\200\324~\262\356\254q'\215\016@x\234\224\026\212\035Y;gli\311\310Rl?n\270\310\332\031#K\035(J\340\025\214\354\213;\245^8\2514\f\006\304H\361\017\2178\205\223L\212\313\220E\354\203m\352N\252\037*\006\223\2203\312\t%5\262\235,\234,\234O\317\252\037)K2)\032W\266\204H\341p:\335\371\244\373\206\214Td\375Bg\013\244\023?\304;g\213\367g\350P\211\332\f\243;\217\214\234*\212y-Z\374T\365\023h"
+	.string	"\035\313#@\0301\234Jw\252\270\263\251\003\020\376\307#\003\213\315\332\311\344\\r\246p&\375/\211H\016\251\254\235H\007\204\205\244iEE\251\273\312\013\312\332\211\342%2\025\003F\326?\002q\002u\315\372\322+\247\220S\310y\342Ij\306TX\336\240_\212\254\177'\321\235'^\242\332\244d\355\034z\\\233\003n\006\224+N '\020<\366\254\372\221\342.Ie5\031\006)\251\242#\353\347\304M\371\313\341\024g<\025C%\352\260Jr\311T\226`\225;\343\277$v"
+	.ascii	"B\026[\342\260\221xw\345\305\312\013\"\025\303\034 \205/|\031"
+	.ascii	"lY\320\202\362\266\256\31137'UY?"
+	.string	"GKP\360e\360Y\365\023H\301\027\334\f\034\206O\216\030\331e\3752\330\307\024V\226\365s\224\366\366^\2622SQ\211S\310\2459\2450\300\277d\253p\035I\222\365\313\223\227(\256[\215\")^\242\274\374\251\350\363\021\307\214\213\215[\210*\204\274@Y\036*\261!7\230\365\013_\374\200\n\253\004_\374^\372\006\201\302\220$\257bM\be\205\312\013\337Q\251lh\306\022\234\335_\230\330\275\350\275\215\343\370+\n\221P\211dt'\226\365\213\336_\232t"
+	.string	"\302\343\306\354\204"
+	.string	"\363\360\340\302@0\030Y\277\334\275M'\272\336\262~1\305\325\320[\016#\177Ab\344\205\216y\235b\322E\035V9\252!\022\272H\362\027\272\277\314u"
+	.string	"B\026\313j\022\304,\353\227%_>\321\021\311f\375\027%\310\257\030j:\262\276\006\233G\013&\246\254_\344\262\224\253\307\203N\310\313\221\2278\034'7\267\027\"G\242"
+	.string	"\307\212k,`$\302\375\205H\234Q\030\221\037Y\277\274e\261\260# \2038Gf\177Q3{\031\302\324j\343\370)\016\022\212\247\242\216I\242\246\0341\214\213\236<,\303\210\260h\201\375\313\220\277\b\351"
+	.ascii	"\204\307\261\365\241\200\222\365K\220\267[\203\330\242\254\377"
+	.ascii	"\302\366\002\344\177_/(B\256d}\022O\366\313\232\006R\207VU\262"
+	.ascii	"\376\313\017-&6rd\235\333\307\271/>^x\374\245\307\377&\315\342"
+	.ascii	"\210\362\262>\211\274\375\202\366\227\264\377me(\3351\311\372"
+	.ascii	"$\352\366\377rV\243\305\214\254O\"\311>\211622\017D\t\022\206"
+	.ascii	"\265X^MzY\237\004\330\330\030\354\367\"J\2200,\251$\016\211_"
+	.ascii	"\326'a\304\305\365\022\366\254\372)<\312E\001\216\271P\202\214"
+	.ascii	"\256"
+	.string	"_\177\t\373\213\216\016@x\034\363\307\022\336S\326\177\001k\211\274vXe\375\202\343%\307&\352\353\n\213\356U\360\026q\361\227\370r\343\177BfgRY\277\\_\274\212\324\241\300\313\372-\366\305+\351\304\244\366\344-\353\227\256\271\0325\340\270\027\205\342\251$\3278~\362\200|q\003H+\353G\207\274d\275d\275\314h\203\304{M\357Y\223\036z[\177\231\221\323\374\220Te\375\242\005\027\271\261\207uQ\026#\306V\321QG\224\231\220\251\253++\313\033M\214L\311\372\321\023VV\207-\225[\f\031\200TT/RO\026\2648\013\360\032\307Q\030\034\323h<Y\311\3727r\373\177\201z\201z\221Z\356\375\2753\246\262F\256\320\021\035n(^\242\262\224\322\212\337\021\304\254\177\203\266_\234^\234^\\\234%\016\264\212\363V\264=\375\305\205\f\250\037\262\254_\370\006\335I\221\262\226\365ot\260`1"
+	.ascii	"\025i7\327\227\245\227\245\027\025V\023P\321Y\030@\216d\375\277"
+	.ascii	"4\375E\005\037\231\235\213\254_\230\262\030\025'&\302\033\251"
+	.ascii	"\027\245\027%\025V7L/(^\220^Ph\243\243#m\264\177\220tL7(\366"
+	.ascii	"m\252\274\024\275\024\345\b\004|!z!\322F\211"
+	.string	"^6{/B/B\036X\301\263\333\377\013\320\013P\262\360Y\0253I\340\326\346\210\301$\226\365m\206\354\377%~\211\235\020\340A\222 \211Y\337\206\354\312\025\330\352\025\212a<\201\300djr6#\353\333l5\r\233\206\315*\036@Y\2315\205!\276Y%\312;\246B\b(\353\346!\025\033))R\232{9~l\224\b\ta\253\024\252\200T\004\340\212\222\223\033K\301\035H~\262\376\fT\004\0059L\t\214\222\3156\227\340\341=i\376=iF\211\002\005J\"\334\221\375\031\324\232}\315>m\224\200\"u\327\031n\350\3515\3678\210\005:ys\357\310\222\023\254\031\246\362\362f\226X\315\340\204\207\307\301.m\006%;;x\352Y\0257\205\240#\360\260.\211\020\331\224\254\017E\244\243C\222&\270d\3112\021\316\311\376\233I\232I\220])T\305L!\210\301\035\326e\r\2721e}(\022$H"
+	.string	"`\027h\326d\bmk\3025\341\232qQ\020\344`j\032y3..\0079!b\221u\263\b\223\360\307]\\\326M\"Y\214\357\n\350\004Z\266\377\241m\2665\2074\335\036\327\306Mqkd\225\210\b\275\356C\255\204\b\321F"
+	.string	"\260\022\270\242\271\326\004\322\\k\366`ck\366h\343%\t\250\230\240@\3732\3645\261M\354\004p20i\2325\325\232f\315\036\315\263\346Y\263\307W\232YSX\223\307\233=\216.\234\326\226\262n\246\205\305!\001\312\272\211\326\302\031qk\202\230\024\207\026\030$\353\313\340\266/C\216&Y\223\f.P\206\016\035\3151cQ\034\2570\200\223US,\323Q\0012\245\031\266\311z\244\355p\235\b}\\\263\276\fL9r \245\340d\b\332\177\363\253\371\005Gy\250\212\233\fp%\211\t\221\027\006\327P\212\254_\223\365\362\322F\3118\253\232%M\033M\033\315\256/<\263\246\260&\327\233]\\h5\200\320\240\301\001\016\257L\253\3056\265\232[L^e)\216\214d\375\232\033M\031M\031\332\210\212U\215\214\3757\261Zl\023k\303\201\020\212\201j\2707\234\016\243\f\257\354\374\210\262>\006"
+	.ascii	"\367\337\254jV5a\274B\261\f1\027\f)q\3110LG\326M\253(\272'\274"
+	.ascii	"\254\217\201\272}\f\254\355\277\031\365\026\333\214jN\025\213"
+	.ascii	"\252b&\003\030\"\r\036\032>%\001z\221uSJ\307\371\310ve}\f\360"
+	.ascii	"\330\307\200\331\213\267\330\346\213\243\027\b\027\201\030\230"
+	.ascii	"\261\377\346\023\266\371t\354zV\305M\001hr\022\fC\"\350UW\205"
+	.ascii	"E\213m\262h\266\260\300\005\223+\244\254\372\322+C\312\372\027"
+	.ascii	"\200\322T\321b\233*\\BcQ\0347\201\360\272\200\034\023S>z\205"
+	.ascii	"b\030[\311\025NO\352\2220\220\246\340\310\372\027\310j\246h\246"
+	.ascii	"\030@a\332\005\244\222\222\232G0\310\262]\213\240\013\024\355"
+	.ascii	"\277i\3244j\036\265KhB6\254*\260\222f\326t\265\344\bE\326M\024"
+	.ascii	"\355\026\222\237\255\254\177\201x\337\002\331\346\211\026\356"
+	.ascii	"Y\365#\030\201\240\223\2239\3038\226\303@[\001t\262\225\365-"
+	.ascii	" \244\t\324\024j\0025\207\232C\315\240fP\005tp\026\350\261o\201"
+	.ascii	"\257\335\214\233q\\6"
+	.string	"u\265\200\225\241\241\313\225\n\340\340\314\232\f\255\334\345\312\023:%\330\254]\252d\251+\233\021\270\254_\350\202(\346%\330\004\361\020I'v\027G\305\265\221\201$\035KY\273P\261\300\221\013\241\313\240K\241\213\224\034cU\305-\025\026\316/\033/\255\300\300\025RVq\235\030\032\314\3721 \356\307\320'((\365\023\303\235K\326%\353bc\307h\203\273\006\212\033(\262~\fD\372\372\\\242PY\2315\031\272\374\335%J1\205\224B\271\254]\240d)\302\265\277'\031\353\255\361\"\251/k\027\277\030\324\\\230\2700q\331;:\301\2718\271\313\236\322\307\217R\225\254]\364:\250\"\344/k\227&p\026\363\315G\027\223\254]\362\222I\2011`\310\305\020F\347bG\347rwWW\327\034\304\213a\306~\f,\\\344\\\344\\\226\264ep.J\356\262$\212\221\026X\260\254]\222d\251$yNNb"
+	.ascii	"\332G\216h\2436\216\t@\005\357\320\345\315\345\315\305\210\227"
+	.ascii	"K\221\273\030\001\002\226BJ\326.D\262T26\3722\312\332\005\016"
+	.ascii	"\316\322?\020yP\211\262\177\227!.C\\\332\236<\342\037\227\254"
+	.ascii	"9"
+	.string	"\004\240U\241mD%\274\267\002\221E\326\257"
+	.string	"\336v\301\272`]\202\234%V\021\350\002\344.A\336\037\032AOY\273\260e\251|x\305\302.k\22758\353\f\260\3600k\227\037\007T1\264\367T\001\267\375\273\250\271\250=.W\305-JDp]\331\n\234\355\337\205G\213u\341\341\236\240\240*nW\020\301qe+\220\303\314\005\315\f\036;;\203\307\332x\351\002'\253\nd\355W\240\211\214L\033\235\005V\340\304\330\030\333+\025#\350\251JX\230\033\f\204\r\361L\020\f\314\025j[\204b,%\3278\236\303@9%\236\362\227\365)\300\267\177\027\034.8\\\241bQ\025\320\225\005ON\\a\206q<\207\001\322o\b\2158\353S`\307v\351r\351r\271\361\345\345\342u\227\0332\370\331!\311\332\345\232\245\212sW\364\376\310P4\025\231\312\372\024\340r\241\341B\303\305\206L\240U\262\206Z\322Z\215\273\330\300\253\352\223\243"
+	.string	"\226K\226\313\226K\226\213\226\213\326\016<\n@\355S\340\b\206\013\026\f\227\0301\\\256\\\2568H\245\2315\205M`\312\376\004\346\\\244\\\250\\\244\\\252\\\252\\\246>\245\215\332\b\342\370J\3074\001#\373\023\360\341\342\302\005\312\305\005<\346\362\302\345\005<\206W"
+	.ascii	"fR\342\\\214\254?\201\261\375\thm\027'\027'/<$\026,\264\021\004"
+	.ascii	"NV\023\020r9r9rQ\301\202\311\254)\314\245"
+	.string	"\351.*\226qrY_Y\2730%\223\244\030I\314\332e\311%\20520\351\206_\326.H.)\216'\316\262\212\\R\270(\361@\262\032\273\26257\030\304%\311He\312\220\273DB\227\037\227\037\027\243\034ifMa.Ew1\212b\245\220*k\227\023\256\217!B2\262v!r\031B\243A&\225\265\013\220\313\320\273\345\224\367\304e\310E\350\310\217\2529*\257\033P\026\225KP1J\321\320\210\036\r\273)SZ\022\221p\201W\336\222\230\314\022\3519e\335b\205J\0246\241\254[\252\264 \036\032\231\025\311\272\305\260\005\361N\b\307a\013b\313\341\213\037`@\370b 9\321D\305x\327.MQ\241wd\267\374\265\374\265\024\236%\236)\322B\370\226\302\272\265\241\254[\006\265\221&'~d\335\"\330\022\330B\201c\203\222uK\224\226\300 \262!\177-\201-Y\035:\360\362\332\236<\276\246"
+	.ascii	"\2152\224U|\204|C\374Zl\213_\313\223\267(\216Uh\240\002\317\025"
+	.ascii	"Z\326\005\006\361B\313\313k\341\343\020\230\266\367\026\276\034"
+	.ascii	"b?bY\2678I&\265G\200`\035f\335\242\227\217f01\r\311\272\245I"
+	.ascii	">\342\223J\333\373J\222\244\005oY\bg\326\024\326r\367\026\274"
+	.ascii	"\247\030q\205Y\267\330%\223f\260\200\001$\353\226\272\026:\230"
+	.ascii	"\313\256k,\353\026%-tXRx\b\265\320\265\314\021\271\"\030\230"
+	.ascii	"uqh\t\026Y\242\371\262\212\276\255(\022\210\341\346\326\202\204"
+	.ascii	"\351\345e\326\024v\344-H\230\236Z\240\310\272%.\231\224w\004"
+	.ascii	"t\227u\213\221\226\"7\327\023C\262nyk)\002+q\375(+B\244)HJ\254"
+	.ascii	"\307\314\213\322\247\002\256\210\207\034\234!\270B\002OC\206"
+	.ascii	"h\243\244\023\223\004\224\366\337\002\344@Z\202|\341\tf\267\214"
+	.ascii	"\241\276\262dPn\261h=\214d}\t\b\241\241\265\254!\023\231~\274"
+	.ascii	"em7\201\r\345e\335\202-\212\305\351\310\313\272\305G\213\232"
+	.ascii	"\316\353\262\301\226uKZ\213\332\231\035\330X\213ZK\217&vRdt["
+	.ascii	"\013G\n\027<t\034\334\202h\354\207\241\231\2316\022\2033k\n\003"
+	.ascii	"\304\201\243\205"
+	.string	"\314\005\n\316\254)l\307[\310X\260\b\322\312\272e,\2314%\243\217,\353\026\261\2260\345a\323\222#Y\267\344h\tc\032\001\271(l\tk\321\361C\225\3040\254\306\333\021\267\0260\3155\326\3255\324d\306\214\226\033.vVfM\206-^o\271\2214\264t\315\272\345\232L*^M\231R%\353\226\256\326\350'\213#\353\026\032-\\/P\335\323\f\256\026\033U\244P\204i\2752d\354\3055t\224nK\021o\035\301\302j\321:\213\233$\315\254\311\260%\353-Z\307\253\326V\220\254[d\270\020\245\252,\353\226\030\231\254\005\033\220\303\b\234\301\200\3012\225\3438\216\257\307\0376\\d#\300\325R\325R\3052\005\367stJ;\f\312\372\021\260j\231j\231j\267\230\3440H\036a\213B\313\372\021p\321\322b[\240Z\242\\\226\3428\306\017\001\250\322\2420x\005\207\\\rj\025\312\252!\025'"
+	.string	"\263~\004\226\366[\234\332\026\027-.\362Q\n1P\023\005\201i\021\020\332o\363\221\333\262\242eEK\213\266"
+	.ascii	"*\274ZX\264\330\226\026WLd\220\3010\270\324\322\264\304\304\264"
+	.ascii	"<\373\271\333\207\001\333\202\324\242\324\202\244\215\222\222"
+	.ascii	"\264\321\376\211\231:\254v\354\303\260\325\"\324\"\324\202\302"
+	.ascii	"\013\257\305\350-(\210\272\246d\335Rd\343\265b\250\345\204R\316"
+	.ascii	"\254\fH\313\211\026\"\242\254\f\032u-!\033\n$Y\017\025\221\274"
+	.ascii	"\257\t\020\244\254\017\003U\013P\013PK\274c\264\026\t\fIU\252"
+	.ascii	"\264\304 \350\022[lK\234\311\300\216\324\310\312\232\345J2)\013"
+	.ascii	"\346\346\"k\026+\231\214Y\b\bXc\204\341\341!<v\346\005\337H\201"
+	.ascii	"\302+\353\217\330\333\206\206\360\330\216\217\203ptR\244\300"
+	.ascii	"c3\211^fM\206#\212\020\022\312\224\341)\237\306\246\310e\375"
+	.ascii	"\021@\262,\202Y\370\213%\220%\020\376:\013\020\234\004H\002\237"
+	.ascii	"<\030\255\004\321\216\262\376\210\035\373#b\370\261@\361c\211"
+	.ascii	"\362\327bY\242<y\242\215\340\322F@\355\217@\321\204\305I\023"
+	.ascii	"\026\276\275\026\313\302\247\247\247\215r\\\025\307\327#\226"
+	.ascii	"I\354\232\270/\342\257\216\345\256\216\205\t^\213eabg\247\215"
+	.ascii	"\240\230D\324\355\213X\223cQ\"\3072\267\244\305\262\314%I\242"
+	.ascii	"\215\332x)\216\237\022\020Xt\0251\266/\"\006\034K\034\034\313"
+	.ascii	"\021\226#D\210\260\030\231\241\302T\344,FZ\204\321\3701\312\232"
+	.ascii	"\005\326e}\021.\366E\020\005aq\013\302\322&D\bK\333Y\200\334"
+	.ascii	"\300\300!gi\243\233\361\245\366\302\224\375\027\360\330\330X"
+	.ascii	"~<Y\320\342+\250+\n\"\0244\262\376\013C\366\317\242\246\306\362"
+	.ascii	"\243XT\025\253\310\340\013M\360M\311$\367\"\251\250\364\032\256"
+	.ascii	"\310+\313\032\373\377,>\224UKp,d\334p\373\201\342'\353\277\260"
+	.ascii	"\003\215\205\007\032<\226\226\006\217\271vV/\330\330\177\341"
+	.ascii	"i\357\330\301bv\226X\352\bgUv\026\263\342\220C*V\262f!\203\263"
+	.ascii	"\316\202h\030yA\211E\214E,\020\017\002\2119\236\203EG\004q\034"
+	.ascii	"\023\305%\f\305hd\301\316\242\343\177\311\036\203gePX\272X\276"
+	.ascii	"X\272Xn\260\\Y\256,7\316\002\264ud\202c\361:\313\215\214U\005"
+	.ascii	"\350)\316\232\243\262\362\312\372\020\240\333\207\300\017\026"
+	.ascii	",\026\032,X,6j\234\305F\214\030,3\366\017\025/\263\2460\226\031"
+	.ascii	"\332\205\024#=\262f\321\222\321\003\351)k\226\254,F\005\251\007"
+	.ascii	"]\326,2\036w\\RwE\005\001\033\373\020@\202\001\203\205\005\342"
+	.ascii	"\217YS\230\013WX\252X\252X\246\314\256.\320m\226(\226(\226\251"
+	.ascii	"\343\024&\263\2460\251\263L]\351\243\222\022d;9\261\274\220@"
+	.ascii	"\354\307\254)\214\305\305Y^\360Hr;\2215"
+	.ascii	"\313S\226Jn\371(\362\344B\327njba\321\306EV\360V\234\205\305"
+	.ascii	"f\262\203P*k\026\025Y\352\212m\310R\326\317Rd]{uY\337\205(\226"
+	.ascii	"%\226\245|\367A\340\217\013I\233\205\210\205\210Ei\307hma\032"
+	.ascii	"\213\321Y\224\316\222\324\001\b\217B\225\265\307\224\365Y\220"
+	.ascii	"`\275\377\335\203^H\252\262fA\301rd,B\024\327\345\302\211\n\224"
+	.ascii	"O\\\3105\261\024e\251\243\226\220#\330\254YN\2640%\221E(\221"
+	.ascii	"%\310\215\343\026\255*\305R\374\264\344\201%f\211Y\202\332x)"
+	.ascii	"\220\005\350,A\377Uo-k\226\037\270\210+(hH\345d\277\2056\346"
+	.ascii	"!\363\220i\2450\220Y\345L+H\274\264 $Y3\021\33786\023l!m\237"
+	.ascii	")\245e\0322\r\213o!\320\301\265 \266\337\026\337\\f!\263P\033"
+	.ascii	"m\b\240\274\314\232\302Z\310bf\231Y\346`\216'W\3013\007_F$j0"
+	.ascii	"kf \023J\021\230\013l\013N\314>f\0373\212\273\004\357\357\314"
+	.ascii	"(Q\334\370\324\246d\375B&\224$UI-\230P\230O\214\266\004\263\305"
+	.ascii	"\244,E.\254\b\323/\033\026\376xB\225\365[(b\3521\365\230{I\270"
+	.ascii	"4\263&C\246\2233\367\332)8\bg\024\346\345\341\331\355\273;&^"
+	.ascii	" \013\330}\346\\\313\254c\326\345/\004\f\302\305\030\234\005"
+	.ascii	"\257\375\2016\177\271\314$\314$\314%g\321r\023\255\232\360\305"
+	.ascii	"Hc*\271\202qB,\353\263\340b\377\313\025-v\271\202\211\304\205"
+	.ascii	"6\216\203d\271e\225@\241\3102\221\374K\026\313\026\314#-\f\031"
+	.ascii	"K\342\254\231qC\342nT\311\372, m$kN\246\256/\326\256q\214&U\226"
+	.ascii	"\255\252\023\313\n\346me\263`\023\255!c<b\374-a\373\262\307\034"
+	.ascii	"Sd\327+\256\261\262\303 kvtcY\265'c\314\262e\216%\330\362\207"
+	.ascii	"%\216\263\214\256K=\240\\\201\214\235\031^\253\224\224ei\264"
+	.ascii	"p\314(\346\025\223\214\371\303$\302\214\231ML8&\033\223\212\251"
+	.ascii	"\203\211\203\231\305\\cv1_0\207\230(\230U\313+L\"\246\031\223"
+	.ascii	"\211\251\202\311\305\034c~1S0\205\230@\314 f\017\246\027\323"
+	.ascii	"\211\331\202)\204\351\202\031\306\374\301\334b\2421\217\230V"
+	.ascii	"\314 L\036L5\346\f&\020&\026\023\273Ld\2461\245\230`\314!L\026"
+	.ascii	"L\030\314)\346\r\346\t&\0243\211\211\304\214\3014\302|b\322`"
+	.ascii	"\2361\257L%\246\017\346\033\263\006s\211)\203\271\203\351\306"
+	.ascii	"lc\346`\026aj1m0W0\215\230b\314\242\026\313,[\036~\211\270\254"
+	.ascii	"\362\004$\0132\231\221}\377\230e\313.dZ\021\355z\302\217\024"
+	.ascii	"\206)\262dlUc\3278F[\022\262$\253G\225\215c4\253\275\260\367"
+	.ascii	"\357\252\224-\266\200k+\216\351(ZB\226\305\252\241\271\\0\313"
+	.ascii	"\226|\313\302\"\332\033\nCPva\331\252$f>\374\256fT\256\202{R"
+	.ascii	"\307\0340\366\272\262 ^\215#l\331\245\037|\327/\247 -\334\364"
+	.ascii	"\344\226\322\242hiQ\355\270\266xs\273\006\371\262\222%\244\330"
+	.ascii	"\242\210\220\3541G\f\032\327\261\035U\252\344\316\262az"
+	.string	"\211bzW\332b$\001!\305E\366\375\263\361\342\230#\312\354\375\253\001u\315\202w6\262^\371\353DR6\216\343b\325\234\217\035F\364\202\264\210\003\222]B\363\001\230\2655\345\211\212R\013f\331\222\310\220\354\3737C\352\230C\306\214\033H\327\342\030\016\024\305\261\257\275\243/\027P{g\305%\266:f\331r\213\352\032\307h\027\270A,\272\234Z.\375\020\203\373]\3216\335\207p\262\037\002\311~\b\036\373!\276\366CT\355\377\310\365e\341\222\260\255Z\221\204H[\326\203WP\264\225e\375\020.\366\377ev\t\270\f\\Fi\261K\301%\024\277 K\301\345\337\220>!\327\245\340\362\311\n\026~K\306\255'\301<\244\376\nW\366W\230\262\277B\341\376\n\203\373+\004\356\257\360\267\277\002\335\376\n>\366W\020\333_a\306\376\n.\366W0\332\177@\341\376\003\346\366\037 d\377\0019\366\037P\265\377"
+	.string	"\245}\007$\356; \312\276\003\350\366\035\240\266\357"
+	.string	"\261}\007\330\330w\300\323\276\003\204\366U \334W\241o_\005#\373*\370\330W\001l_\205\252}\025\230\366U\210\367S\370\333O\001o?\205\265\375\024\256\373)L\355\247 \264\217\302\340>\nx\373(\260\355\243"
+	.string	"\266\217\202\214}\024\226\366O8\334?\201o\377\204 \373'|\355\237`\265\177\002\320~\003"
+	.string	"\367\033\240d\277\001\330\275\004\243v\271\300f\375\006\240\3557 \307~\003\262\366\033\260b\337\204*\373&\344\355\233\200d\337\004\354\276\t`\373&\310\3307\241\305\276\t\361~\t}\373%\024\331/Al\277\004\252\375\022\222\366I\020\334'\241n\237\204\266}\022\302\366I\270\332'\201h\177\004\277\375\021\344\366G\300\356\217\360\265?\202\324\376\b?\373\f\350\333g"
+	.string	"v\317\334\265N\267H\3266\3353\200\253\251\t\036\203\202c@\322^\032-\215\226K\b8\213rM\361\345\322K_\325]\326K\245,%\030H\345*\353%\212e\022\025.\244\263\254\377e\322\022)P\350\306\215(\030\240Jt\222\365Q\356{\f%%.\\\016-\207\226'j\034\021\323\314\232\f\227'\244\214K\203Fm\013\370[\306\313x\031\304\341,p\t\364e\020\n6.\033Y/\177\262XS\036SX\027\017\262\302\272+W\006\231\026\260\266\177\270\n\026\256\322\372\271\320\306EG{t\3318\236\303\240\365\n\373J\312\372\013\370:<\314N2\217\370\007\231\325\207\342\205a\2244\304\263\254\277"
+	.string	"*C\303\t\002\323\026`\264\177\270\260\020\226\322\362\210\177\226Yv(^\030\306q\024\006\256\215(D,j8\2558c\312\372\n\270\222\315\302\203\357\004v\201fMa\202\207\007\037\367w\007G\2245\034(\203\\\036\f\005<\211\022\305\206\037%P\240\340\2315\205)\200G_\037\354\227&\001\234\327a\277\327\353\353\n)\353+"
+	.string	"L\211\022x\357\317\306\025\357\360\336a'\035\200\360(x'l\024e}\270\t\254\367\277\331kk+-\353+\240k\303L\340\274\0360\254\350\262~V\300V\005\313$ET\220W\304\032\\Y\303wYj\013M91\203\355|\300-\221\002\333\301uxCW\224\262\256\203\227\300t\331\024\211LY\277\3117\254\354W\326W\300\323\276\002P\354'\340\n\222#\201\345v\034\307?,q\320\223\276k\374\264\024Q\235\031\240V\237\020"
+	.string	"\210\331<\323*4Ju_\270\341\031\301\312#-Zy\244J\227gK\214K\322I\023\303R\215\342\360@_P>\001P\345\231R%P\225:Y\300\351)\036kHD\253M\253\224G\005\370\246\3322\035!%!\275\231\356\360\300\320\241\032\275\301\204\016\224\007\n"
+	.ascii	"\027^\236\363\241\252\264Fq\224ThT\247\004\027kT\004\2135\212"
+	.ascii	"\2025\212\202L\264\307\304\b\023$\334\360HOxZ\243(TI\360@\243"
+	.ascii	"!`\027\232\033\330\220\210\326Dq\240V\021&lxt\234\316\236\235"
+	.ascii	"j\024\247\205\032\355\351\361\231Z\217\325\027\230\312\023:\030"
+	.ascii	"\301Z\205\2228\226h\300\316\224z\202\225\032\255\341\351\334"
+	.ascii	"\201\262\020\265\341\211\352HE\300#\250\323\023b\222,\317\371"
+	.ascii	"\260\201\r\211(\016\0174\307\346\t\265BMx\301\032\305q\211"
+	.string	"Z\241:>6:\320\022\246V\237\021\236\320\251U\252_L\220p\303#%\001"
+	.ascii	"\236h\317\024\236\241\204\346\f%<o\242Q\024bp\240#L\220`\215"
+	.ascii	"\242\320\202\nH\253\224G\205\026Tp\255Rd\013*\270\200B\013*("
+	.ascii	"\247+\264\240\202~\316\207\251\324Z\323\202\nZ\232B\013*\350"
+	.ascii	"(\016l\242\347XUZ\243\"\252*,\2438\312\022\322\0207\320\351\n"
+	.ascii	"-\324\032\032\366\215\n\312\235h\210\034\034i\n4\330@\2555#h"
+	.ascii	"\260\201Z\253\313\350\r\322\251U\304\313s>\354L\251=\321hM\364"
+	.ascii	"\006\251\bk\024\247IC\025\032\242\2324\301\032E\301\306J]Zk\220"
+	.ascii	":P\233\351\n'4\237\363\301\n}!\247\032\245\222\210\276P\342\205"
+	.ascii	"\030\227\033\350t\205\021\254Q\234\031\247\216N\264\204\031\242"
+	.ascii	"8P\253\3164\002&\250Q\253\025J\2025\032\325\221\222\250\241\340"
+	.ascii	"&\332\3233\245\232\020\325\221\236\360\254\216`\215\3428o\260"
+	.ascii	"\332\300\030Xk"
+	.string	"H\330\264LI\360\250`\303\343s\002\r6Q\226\020\022\350@mr\254\320\235\r\254U\236\251\215Q\307\025\301\201\246\212\002\007k\21559%\301\243\2025\212\363b\245B\233=S\253\b\027j\364\006\032MA\206\347\004k\265\246\206\006<\237\363\241\246\202h\215\323\032E\001\346&j\245N{z|D\270U\025\226\306\347|\250\222\230JM\350D\255Q\235\236\235i\tU\02201!Zx\301\205\0064 \211\303#\265J\241\022\250F\255&H(\361\302\r\024Y5\341y\023\245\372T\245\023\334\250PbJ\202\t\022JLI\270\341\221\222X>\347\303\324&\332cb\002\350\324JBW_\320\321\031\201\002\237\020.\334\360HO\220@\307gj\245Z\253\307hM3\2523\003TG\n\255a\004+u\352B\265g\307f'\272\343r\260F\253;\321\035W\272\223S\225\362HO\230\216\020A\235\236`\225Bm\020"
+	.string	"\217\r\323\033\253O\216\210\351\210\230\033\036\351\t8=\256\313\rO\264\006ZC\r\217\324\252#\365\231\241\246\206\205'\252C\265V]\036\252\265\332c\302j\023\265\201\366T\253\322\343s>T{p6\230J_zp^L\364\330\354D\255Q\021S)\217\264g?\347C\222j\255\006\200'J\245\372\224`\215\342\310<\347\003\016\217\224\307\307\272\301"
+	.string	"\234\317\3710\203T\347F:\265B\365s>\300Psl\250\326\252[\255\351!aM>\347C5FG\307\207\207g\312s\264aJ\315\261Ny\216$\240Q\035\035\245\372\364\350\236\035\233h\025jC\265V\221$\304<\347\303\224\004\217\264f\003\033\022\326\252\264J\215\366\260<\347\003\211\231\013\200\210\301\003\f\030kzHX\221\313\033\236hO\317\b\314\033\036)\t\bp\240!\240$\304\330\330\214"
+	.ascii	"3\245\232@!\206\032\265\3624@\252c\263\255\2565\212B\322\365"
+	.ascii	"\031A\252c\003+I\220\220\036M\364LKh1\3213-\201\305D\317\264"
+	.ascii	"\004\227\350\016\224\205\033*tJ\302\362E\252c\203\234\222\340"
+	.ascii	"QAi\302\206'j\205\256p\243\0025J\365\261\332@I\370\360@C4{\240"
+	.ascii	"!\244:6\356\215\n>6.\324h\211]B\032\"y\023\335\241Ju\242U*\264"
+	.ascii	"\207E\311\301\207\0227*X\253P\235\345\r\217\317T\204\t\250\316"
+	.ascii	"\323u\221\251Fo\246!^`\227\027*4\002\312\022\322\020\311\232"
+	.ascii	"\350\216\324\312\343C\335\300\206\004\214\325i\265\261\201\026"
+	.ascii	"\233\317\371\320\241*\342\206\331cb\004\263\332|\316\207\025"
+	.ascii	"F\250 b\003\032l\246:%D\251\323\022\230U\037+\324j\245B\255\""
+	.ascii	"z\246\323\025^\216\325\033*\324\007\005\032\252\320\r\2427\323"
+	.ascii	"\020\233Y\225\352\330\264\214p2A|h\331U\035\235\021zv|n`\034"
+	.ascii	"\027zv|n\222p\025Jm@N\025\252s\202T\307\346\205\n\215@\217N4"
+	.ascii	"\005\251\216\315\221\n\215@U\331\022\345\221\256`eFy\244+Dm\240"
+	.ascii	"T\353\373\"\325\261AFw\240,X\221Q+\324\204\350\216t\304\373\234"
+	.ascii	"\017\033\274`\225\242`\245Ns\252\021 \361n\251\216\r\263)\325"
+	.ascii	"\261\341p\224\352\330,\253\325\250M\265\032\265\231\261JK4@\252"
+	.ascii	"cs|\201\371R\302g\204\036h\b\245R\007*\245V_\035\25049\255\201"
+	.ascii	"\272\2210\016\217\364\006\032MA\004\217t\205\234*4\005e\364f"
+	.ascii	"\032B\252cs\274\331\261\3313$Y\\F\220\352\330\310\224xa\007\312"
+	.ascii	"\202\225GJ\355y{v|L\220\352\330\264Hul^n\242Qk\317\316\364}\267"
+	.ascii	"\013&\250V\347{\303#%\241\304\013R\035\033\026d\213T\307\306"
+	.ascii	"I\202T\307\346%Y\242\001/Hul\\\226N+\025j\2556ox\242\324\032"
+	.ascii	"\234\236\232\232\026\270\372B\205F\300\032\025!\325\261yM\364"
+	.ascii	"LK\340Q\241\252\302\222\032EA\252c\343\262\304q\312\300>S\037"
+	.ascii	"\034\352\b7R\035h\r<*D`\3034G\004\217\224\207\n\225\300\f\211"
+	.ascii	"(\217t\005\027\252T\307fy\001\0201t\200\001#4\002L\026\016>X"
+	.ascii	"\251\320\236\0171J+uZ\355AA\252c\323\022\245N\255\325(\225\211"
+	.ascii	"\343B\217\017\r6\320\031\226\321\233i\b\021\321*\025\352\202"
+	.ascii	"T\307\306\305\032\305y\276D\2530LG\270`\215\342\304Xsl\254\317"
+	.ascii	"j\215\362\206\234\232j\025\332c\303T\247\306\006\250\211%\210"
+	.ascii	"\033r\226.\326\347|\270\221\366<Oh\2535$n\244=\256\013\255\n"
+	.ascii	"\255\t\355\215\264\247\b\302\312#\235\272\320\343s\303#\225@"
+	.ascii	"L\322\006(\005|D\334H{\226<\322\020\326\021n\244=,V\233(\t\022"
+	.ascii	"Vj\264\247D\264\306\252#\265\326\360Lo\220R\2479\317\350\315"
+	.ascii	"4\204\t\253\264\006(\025\005\251\225\007\312\034\001\303#\205"
+	.ascii	"\242@\235\216\360\362\202\rP\023-Q+\224\272\274\301ayFw\244V"
+	.ascii	"\244\t\250N\364&\371\322\264\001j\242\206\211|Y\262H\2238<\320"
+	.ascii	"g\f\217\024\212\323R\335\251\271\201Fs\2404L\247:5\324h\315\224"
+	.ascii	"j\003\225\341\221BqXZb\2523@]\230\316\350\3154\204\0134V\351"
+	.ascii	"\216t\205\250\016\016\317\b1<R(\n-\324(\016\216\224:\302\206"
+	.ascii	"\251\216\316\b%\344\330\360\370@u \250\211V}\\J@u"
+	.string	"\242\324\032\033\240&\2508Q+\217\364\345\006)\025\032\345\221\256`\255\372Ps\254M#\217\024\212\203\214\332\360@k\270\201\336\3005.::Q\233\232\030+O\364\031\335\201\262\320\223\334\351a\351\2212\243Uh\224j\303#\215\352\334HkxL\3348\253<P\252\025\006\207G\352\244F\255Vi\006d\254\325\351t\206\026\253tG\252\323\214\332@\2515:\321\032\242:\314*O\264ggjS\203\003\255\326X\2413\324\340\254\336H{^\252\320\035\232\032\035\235)uF\332\"\355q\251\341\221\356\3348y\244P\234\232\231\230\035j\324z#ALUGg\004\034\036)\217\317\b\021&tzz\240\021Tq\250#T\253Q\233)\265'\006\207:\202\265D\224\347(\"j\225RmXZu\244>$8_\232\"nt\244>38\243Th\317\316\264\204\350\016\224\205\252\013\017\216\264\312\262C\235\222\340\211\211\326"
+	.string	"\025\021\245B{\242\324\236d\265\032\265\261\201\272\027"
+	.string	"\021\003\b\f\030#\220\316"
+	.ascii	"\255\251\241j\242\312\202\003\205\326PS\003Ck a\345\221R]\220"
+	.ascii	"\352\330$U"
+	.string	"\310\251\372\350\234"
+	.string	"C}w5\272\003eAy\243\202\t\022BX\2438\313\033\352T\002\326(\016L\235R\251\rh\211\332\270\344\330X\241$\264Dm\240=\"z\2444T_\023\326\236\235\006T\245G\253\216\017\224D\324\204\252\016\324G\003\r\240Z]pZ\2438\257\325j\205NuH\030w\2449\"\244:6K\023\240/&z\246%\260\340HI\264pp\316\230\350\231\226"
+	.string	"S \001\007"
+	.string	"P`\242gZBMU\202\227*5j\265FW\260\241\2620C\320TK\210\336LC<_\315\201j\022\254Q\021<\322\025t\250\326\022f\260AFk\250Q\036\033Z\250F\251Ljt\307\247*bgj\255\372\330t\210\326\334\250\020\265\201RGHul\340hMO4:\203\322ZS\r\321\264Zk\2427H\253.M"
+	.string	"\232\325\030\251\216\315\033\255\211\366\230\030a\255F}4\020}\201\032\275\201Nu\254\323\351\f1\326\235\250\265jBDK\217\325\307\005\251\216\315\3616Rj\224'\212\263\377\001\0014 @\b%\216\326\236\035\237\233d\264f\3042Zs\243B\264\307\304\b\037\233\235\344s>l@\202Y\215R}\254\320\350\t7L\353\rO\364\265R\241.\260$\2555\311h\217\211\021ou\032E\201i\255\311\251BuH\300\325c\364\006\251\210(\016\264\247\212\214\336 \025\241\003\265N\255/uj\265\211\212\240F]\250Fq\240=K\353s>@P\265Fi\260\361\231\341X\255\311IZk> "
+	.ascii	"\034\275\231\206xk\2526@M4kbz\244:$r\252P\252\r\322:\242Z\323"
+	.ascii	"\274\211\336 \325\201J\255R\036\025Z\\\353s>\320\320Vk<\260\366"
+	.ascii	"$\215 :\210Z\241\326\252\033\325!\0215\201\305\351\214\211\021"
+	.ascii	"A\202\004\323\204\rO\324G\003Q\352\t%p\210\356@\251'X\237\363"
+	.ascii	"\241\2523\245Zy\2466\325\232\021'\210\260\241\316\354\370T\213"
+	.ascii	"8<R\036)\224j\335Ui\211\021^\021'T\253Q\036\021S\253\017\224"
+	.ascii	"&\306\372\234\017S\267\232\002\223D\324\204h\217\211\0215!T\030"
+	.ascii	"\221\334\221Z\2138Pk\361\030\255\201\201"
+	.string	"\032\335\221ZY\2528P\235\023\2428\320\252\017\022\266>\347\303\0068=08<Rj\364\206:\215\276`\365\351\261\372\264\340\254!jB\324\n}A\311\3023\225V\251\321\032xT\330\261\301\205\226\035\033\\\270\211\332\360\230\250\362\300\020\255\372,\255U\252\017\t\321\252\017<\242\245\352\352Lm\246\326)\325\005+u\332S\345\201RG\3000\251\321\035\351\210\233(\016\017t\006\253\224\004\3534\247jB\264\352\003\323\202U\212#\275\201\341\221\356$K@w\2226<\322\035\244\316\324\205\2455Z\003S\255\211\342@\2530\264 \2435'\274l\253\225:\355\321\325\032+u\352B\016\216\317\224\232c\255V\241.\304\334H\363\215\017t\006\375\234\017\321\035\251\265Zc\205\336\324$\251\320\250\t\235c\345\231\356\030M@o\212U\252\3174\307X\215Z}x\244;\307\352\r\317\324&Z=V\245::\322\035\3679\037"
+	.string	"\300\222\214\332Hk\210\336\270U\351MM\365F'*%\361RU\362@wH\220\360\311\251\241\301f\2523\003\\\245N\2556\322\233(\265\247&Z\203\324\332\003\275\2016\253;\314\235\036j\264&J\365\261\366@m\236\363!\252\023\265\261\201JP\255\261\261\201\032\255\317\371 "
+	.string	"\353s>Ts\254\320\235\rx\246;;S\233\235\266ZS\323C\242YBJ\265BCX\247\324\245\225Ys|\316\007\253\215\017\325Z\355\240ZS\"j\365\331i\241\301f\252SS\343\326\324\034\251Q\036\033\24655\307*5Z\365\341\251\251\3317<R\032jj\334j\315Q'ZS\363Zk\254U\251\016K\217\t\253\0067Q*4\247\252\301\006U\253t\206\r|xp4(\341\303#\325\321\340\003\002\324\020 \204\022\033Do|tlx\244\033P\253>\033\030\300Z\"\312\243\003\345\241F\255<\322\232\033h\224\232c\355\251\251\211\251!J\355\251\251q\255U\251NM\215\013\265Bojj\334\350\r\322jM\215K\203\315TG\333D\2515H\253\224G\005\236\023\254R\036\251K\265\272`\303\343s\302\r4\372\202\215\315\b/66\320\315s\302\r4JuQ"
+	.ascii	"Qcc\003um\200\276P\202\t#\270\326\347|\360\351\331\251\231RM"
+	.ascii	"\340\330\330@-\210\326\274\300\001\b\034\020\300\247g\247\251"
+	.ascii	"3\255F\251\310j\315K\264F\204O\317N\322\265\352\370T\243/\360"
+	.ascii	"L\245>=;.\321\032\036\034\251\016\264f\311\203#\325\031\301\306"
+	.ascii	"\006\272M\334@\243/@\255\320\233\327Z\255\251!j\302\224j\002"
+	.ascii	"\347\32566Pe\364\246*"
+	.string	"\255!JUR\243::R\022n\r\321\233\342\r)\350\364\354@\253\312\022L\030\301\306\006\352FmxZ\260V\241\321\025\254#\334\300\240\023\265\261\031\241*\225y\316\207)\325\004\316\006U\352\264\312\023\255N\251&p\224\321\032\246!\246T\0238\021P\2416\334P\2419-\324*\211\232\034\034iNM\264\352S3\265&A\334\220Sc\323\001\211\036\235&\b\020\035\324\334\220\363\322AM\216\215u\312Sc%1\255>m\200\232\250a\3320\325!A\215\326\320\002\f\"\332c\302Z\323\301\322\0045Z\303\324&Jm\261\326\360H{\25256@M\270\2300\203T\007ZB\314\r95<\322\033rjJ@w^`n\242V\233\2505jBuJ5\201\003O{JDkxL\334\324\200 \321\243\343\002C\215Juz\244V\035\237\235\032j\324\252#%Q3\245\232\300\251\271\211JIHuzv\244\325"
+	.ascii	"\270\354D\255U\023\325\345\215\264\207\371B\264\006\251\325\006"
+	.ascii	"\332\022\275\231\356 \2536Rk\265\206\206*\324\312\254N] @TGJ"
+	.ascii	"bJu!j\205R\2354\330Lul|zl`\033(\025\005\236\026\250Q\033\246"
+	.ascii	"=0*\334P\241\323\031\2307\344\204\210Vs\334\250\025j\025\301"
+	.ascii	"3\225Z\241T\037\027\034\036\351\016u\004\032l\244V\021\321\026"
+	.ascii	"\353\216\356@Y\240\241\n\0351\203O5y\023\325\231\001\312\323"
+	.ascii	"\200\252\3645a\225R\247R\252\0136R+\324Z]Vap\341&J\225V\2437"
+	.ascii	"Lk\315\216\324\232\254\302`\255F\255P\235\226\022\320\035\227"
+	.ascii	"*\f:P\353\324\372\3023\225Z}l\242%\032\300\241\nC\216\225\003"
+	.ascii	"\020P\253N\324\004(\314\210(\016\224\032\255a\004\034\036i\r"
+	.ascii	"\323\235\247\265fJ\202G\205\035(\025gj\255JS\240\241\n\2656\237"
+	.ascii	"\363\201\032\325\361\271\211\346\330T\003P\205!\252#\265\362"
+	.ascii	"Dm\250\321\036\245\225\307gjc\254FulL\2240\245\232@!j\205\352"
+	.ascii	",\2555U\030\242;R\353\256\302P\002\272c\264Zy|\246% y\032Pu\255"
+	.ascii	"=QkUGI@\253:R\350\t%\2502\326\347|(1\335\240\247\272s\243\202"
+	.ascii	"\225'\312\003\335\241F{\222\325\232\022\323\031\214\306\350\016"
+	.ascii	"\224\205\022\323\031\216\326\351\210\233(\r<R\235]\255\341\231"
+	.ascii	"J\255\322\033\236i\t<S\351\216L\264\346F\205\022\323\031\216"
+	.ascii	"7*Do\246;n\264&i#\305\231\256\020\275\231\356\274V\234\236\233"
+	.ascii	"\250\025*\265Nq\242<\317\022Td\017t\307\206j\244Fo\2445L\251"
+	.ascii	"=7\321\022\324\226\022Q\235\036\037\023"
+	.string	"H\350@s\220<\322\b\2545G\034\350\210\251\264\006\307G\247\347\331r\303#\235\241\306\n\255\326\354\370P\2554D{\2523\312\250\016\324\006i\245Fk\340\221\332Po\244;F\036\351\316\246\301&\232cS\002\272\263\253\321(\025'jBT\007\207g\204\035h\t5\364\220p\271\321\231\346T\243\324\234\021Q+\264\006\251\325f\204\350\3154\004U\n}\362Hm\242U\237\232\022\320\235\232\022\324d\t\037hM\t\350\016\263J\235R\251Qg2z3\335i\261\362H\247=\326h\225\346&\032%\001"
+	.ascii	"\022$\246V\037\233\232\252\264\004\264\006\307g\206\350M\214"
+	.ascii	"\211\036*M\ruj\265\201\222\250\231Z}\24058<\322\034\353t\272"
+	.ascii	"S\255\261\241\006\340f*\245F{jH\364\350\324Dw\240T\02256\324"
+	.ascii	"j\215\264Z\245\312\334Hk\254R\036\037\270\003\235\022\324*\323"
+	.ascii	"Z\205\222\250\361\231\241\272\244\362TkJPk\242U\237\032\022U"
+	.ascii	"\252\r\223\206*t\247\246Z\023\275\221R\251\321\032\2465=\325"
+	.ascii	"\035\016Th"
+	.string	"\216M\004>\260\3659\037\250\321\022\322\035\0166@M\024\253\324\251u\272\243\214\352X\255Sj\216u\353\350L\251:\307\306*\3551Z\251Q\253\r\224\n\315\261\251\261N\2473D\251,K\227\2514\306\004\325\032\335\211\352D\2551.4T\241!x\246R\253\r\217\017\teOu\247\332\203\323b\205Ro|\2403\324\224\230\316@\203\rTg\006\230*u\332\223\274!\247&j\205Rk\242V\350M\217O\215ugJ=\341\206\n\265\201:%\341R\255\331\201R\241.To\242Uj\264\206(\225\031\325\271\271\221\356\270\326\352\006\326\034\034\251\016\211j\r5ZB\032bZ\0035ZUZ\2438T\250\025\216\332P}\246\"\254>=<\322d\324\n\245\352\233h\264\247j,1\235\241h\255\271\331\261\221\352\330\354;yNP\336\360@wv\246%Hul\220R\252M5z\223\254\342P\241\332\372\234\017U"
+	.ascii	"Du\2406\"\230->Pf\024\207\007J5\346\330X\2456\210(\341\003uR"
+	.ascii	"\243V\236h\tV\236\350\216\265\352\223\201\033(\213\3659\037J"
+	.ascii	"P7(A-\241\004\025\306\372\234\0173\321\035(\013&\240:=U\351M"
+	.ascii	"\322:\325\221\366\300\326\347|\240\241F\245$\244V\236\350\215"
+	.ascii	"\024Y\255QF\300J\235\272\300R\203\033\255\211\336LCX\251\323"
+	.ascii	"\036d\364f\272\243\2435-X\251\323\036\270\3123\225Z{\246\307"
+	.ascii	"\250\025\372\302\215\017t\206\035\275A*\"z\203T\304\266n\252"
+	.ascii	"\362\006\032MAG\n\035A\215\222 \341CB\t\253\262\006i\324&\372"
+	.ascii	"\302\023\t\265BM(A]R\255.\250\240\003\225R\243U'\r6\320\031t"
+	.ascii	"t\240%Dun\244J\353s>\340\364l\200\323\323\264\341\3619\301\032"
+	.ascii	"\255F_\300\351I\362\220\310\326h5J5VkLP\255U)N\364\005\234\036"
+	.ascii	"e\364\006iUW\253Q\352\315\r\364h\242gj\243\251\326\236\242\365"
+	.ascii	"9\037\252\321\233\351N\215\ru\003\033\0222=Q\253\210\033\236"
+	.ascii	"\350\261Z\023\305\341\201\276\240\023\345\341\201\346\330,{\242"
+	.ascii	"V\021V*\324Z}\255\317\371PC\302g\206\r\252\324h\rR\352M\004P"
+	.ascii	"+\364FWk\250IkM\324*\245J\200\204\317\fHj\324*\245\332\340\342"
+	.ascii	"P\241E\023V\251\r\264\007j\263\255\320\2543\235\222Pct\255\326"
+	.ascii	"h\225\004\211\251{\023\245\301\006\332\343Vk\242>:\320\032\244"
+	.ascii	":6H*4\307FGw\240<:\332c\302\252\255>:\320\bHulX\2545\035xP\002"
+	.ascii	"\032\242\003\017|\\k\264F\307\245D\364\206G\205\250\316\fP+2"
+	.ascii	"\2523\003t\304\nR\035\033\230\036\037\032\246S\035\327\332rt"
+	.ascii	"\255%\240;\305\020<\322\020R\035\033\031k\r\001@Xy\244>\233G"
+	.ascii	"\272S\274\211\362\340H\253<0\224\200\356\360Hw\226V\327\004\224"
+	.ascii	"J\035A\252c\003c\002J\245B\215\326\347|\250\342\360H\255\326"
+	.ascii	"h\225\303\247=Q\352\006\326\351\224\272A\262\212\003\325!a\254"
+	.ascii	"\326\224\260\202\b\251\216M\f\217t\347\315\261\342\360DuJ@w^"
+	.ascii	"\034\036)\325Zu\2555!Xy\244>\307\352\264\307*\235\301\305\221"
+	.ascii	"\222\340\231\332\270\326\032\036\234\036\343A\200(!\002\030X"
+	.ascii	"@a\333|\220\352\330l \325\261\331\200G\n\335\331\300\206Z\335"
+	.ascii	"\340\303\013\017NO\361\177\207\0330[OV\270\350\274`\256:prM\352"
+	.ascii	"pey\301<\222\212\203\352\320%3\244Er\346\"J\207\255\016[\035"
+	.ascii	"l$\3510\343\035lt\250!\345c\f\260F\007\032\\pK\212ytZkDC\373"
+	.ascii	"\357\240\005C\007I\341\203-Kf\n\226k2\007'C\346\205\222\210\033"
+	.ascii	"\222\0302"
+	.string	",\214`L\205=\260\232G]J]\205W\035\240\264\222\251\261\037\0301(6T\023 xV1@(\306\254(\241\341\370\021\346\204\n\346\n\326\260\255iJ\271\"\n\350J\233T\207(\257@$\274\326m\t\220\253\254c\210\b\235Rd\335\201E\007\026\035\\\264KK\n\350b\232\201\243\203\213\247\345\013+iD\236:8\315\320\353J\022\"\303\216\274\351\350\320\302\245\353\252\273\361\304p\377\035V,\227\224Tf0\341\321A\251\203R\207&\266\016)\336\241\251\003\323\t\037Gl0uX:\222\222-\363\333\301\343n\377\035\222\234@\222JS\342\230: 1\007\217\236\354:\0341\243\274Xa8\254t@!3\267\fB\004\204\260\203\021\214\264$\2042\203\352P\0047\301B\206~<:\234\220\311\223\221\026w ji!gf\207\224\321\354\210\304\361\350 \324\022\265\2076\330!\250\003\020\362,+\206Y\342;"
+	.ascii	"\375\035\342\016?GC%.\275\254\215um\323\245\271\002\3424\211"
+	.ascii	"\312 S\350Xd}:+U\\$(B\206\016OS\345O\372\321 \036\207\f\263\211"
+	.ascii	"Y\347\242\326\351fA\020\2479\334isE\204\250\030\026\225\314\234"
+	.ascii	"\350I9\215\341\257<\242\231\022\364#\203.\353bU\353ti\nA\234"
+	.ascii	"&\206\022a\326\036\020\016\346$\264\353^\3664\203?M \215`!\220"
+	.ascii	"\255\241\254\213k\255\3235@\333t\215Y N\223-\036\242-\311\001"
+	.ascii	"Fy\023c\204Y=9M\224\237\006\n\315_{\306\205\007\227\2656l\235"
+	.ascii	"\356\335\332\246\253\324\003q\232'/\214\022W\370\321\364\265"
+	.ascii	"6\266\252\240\354\235\246"
+	.string	"\357G\016\241\341K\244B\n\313\3325l\235.\215\023\020\247\3313^a@\265e\375(4z\315*7{}TM\\\242(\001\361JB\223\347\242b\bM\217IK!RLl\250\r\257\205\257\210\315\311\030\315\035\034tvBH\016\032\273\026\024;k-\313\bM\335Q\220\357.\213\206\216ie\211\204-I\216&\tM\022\232%a4JN\263\304%\205\032\f\243$C?6\315\021\232#4H\242>\240A\322\022HV\003\n\312l\3774qI\264<\004\2308f\344\tW\374sZ\202*\342r\343\b\227\"\315\006\021*L;\036V\002\341\222\203p\226I\032\320\233\213\224\354%#\026tK\323@\230\244v\264\301\271|d\2116\206\300\304\301J)N\370\020\242\024B>1\"b$\bL\022C!E4@h\330\274\n_dm$\b\305\306\276\362\323`i\326h|\320\250\265X\232\0370?h~\320\364"
+	.ascii	"\f\222\366w\215c4\232\0374<"
+	.ascii	"\344\244\020\r/H\016Y\021\211\202\324o\207t\354\267C4\366\333"
+	.ascii	"!+\264f\224\263\346\220\231\313\025\227\312\026\020Q\031\r\230"
+	.ascii	"\212'S\b\311`\366\232\236l\375\354\240\311\201\201\264\272\277"
+	.ascii	"1\230\354\214)\300B1%\n\367\211k\007a\2302E\213F\210dO\007\214"
+	.ascii	"]\256\341\364G\245\321\256\330\360\262\206y\362b\225{\366\347"
+	.ascii	"\016\253@+Y\360\213\374R\211\375\356\276TX\013\235\f\271\321"
+	.ascii	"b\216\005\332\r\257&\f\227GV\025\025\327\030+\034qT\227\222\n"
+	.ascii	"\233\302\215+&\352\004\322\233\215\230,\f\260Z@j\304\3348\"\362"
+	.ascii	"\210\362G\203\006\006\027\016\250\0311`0\331\234\230\331VL\330"
+	.ascii	"\022\267\034:\264\232S-\272\356\222\320d5[\034aP!r\242\221\241"
+	.ascii	"\334\332ON\006\253\320\304\210){\372\201\303\007\326\217m\005"
+	.ascii	"\244(\354*\006\333C\013K)\353\030\033a>\234d\255\210\220\205"
+	.ascii	"Hc8\252X\314\224?\306\220$\321P\275\250\330\222Z1\005\367\330"
+	.ascii	"B\200\310\260!%#\267\374S\373\343\213\202\007\213\206G\300\216"
+	.ascii	"\240\\\226\300K\240\310\254^4\273\214\\0\351s\341b"
+	.string	"\304\t\224\033\330\254iX\320\260\240q:\013\020\342\017M\213\3238\265CG\373\247Y\341RE\243\"Y\303\f\253\357IS\263\007\222E\017#cLL\226\370R,Q\202\021Cbu<YKz.y\333\204\260TH0jW\\enGx\314@\033\211M(\236{\032\216\t\221\221Q3\356\355\262!\344\256\b\236\232\262\203\241wB\031\327\266\340\312\243\242!r>\205\230z\033\244\031\342C\241\227D#4G\023\304b\344\r\212\024\032\r\020\313\021\232\237\027\027\310\030Q\346\2564\261\216\275\344\007\326W\242r\t\215%'\277+OCd\337Y\342\024+N*2\036R\246\26264\234A\264\221\201\027\217\275C\304\303\257&U\222\314\034\316P)>5y\273q\215\323A\207\270\377\231)\312:+\033:`d}\002\224\212\"3\205Q\be\322\264\032\024*\203\260\225\220$\247\031\301\226'\206h6\002c\352\232"
+	.ascii	"\2613\331e\020rI61\305\f`\214\034\342\020\251\231\277\317DA\""
+	.ascii	"\032\311k\222\365\f\024\345\214+!wwY\317<q\"ba"
+	.string	"\030\275\315\370\305\370\031\215T\035\026\365%\241\034\241\002\305#\353\231\275\272='|S\366?\343\344\205HqO\007\337uF\257\271W\214K\022C\234i\"#\264\365\232\360\206f\362\224/\264\252\252\356\262\236\301\333;\202\344X\363\333\377\314\235L\254\257\330\264\300\354f\350\252qrmP2\304\354*C\024B\262\2162R\025>A\231s\211\261$\211\225\364#\0223)y\311\346*\266\301\266$L$\311*4\312\336\344\230G\216\312P\274em\304\310\314\2216\202\2528\276\306A{@\230S,\374\226\f\343>s\344%\n\221\255\304>!$pp3D\2722 \362\342\347\204C\212\217\375\317\274\271\334\271\301~$\b\"\305h\213q\3014\232\212\2028\304F&\303z\301%D\306\353H\026W\020\031\035h}ZT\200(\367\230RGI\254\260\311\224i\024\331\023C\326b\342\340\256\037Tv?\2246\216B\324"
+	.ascii	"\367\260-7j\3048[\222uZ\332\214Z\237\022\217\317\250\315\364"
+	.ascii	"\250\001K\310E\217\2310.\303\026c5vY\331\314\231\236\230\331"
+	.ascii	"g\316Z\270\344\330\272\204^l\035:fvP \024\307D\361\r\211AA\262"
+	.ascii	"3;f\306\344\272\262\200f\306f\304\336'B\220\314\210\375\377L"
+	.ascii	"\230\fnkp(r\030\346\310\372\255\020\320\376g\300\222q0\215.\032"
+	.ascii	"B39Z\310^`YQe=sc\346\35338>\203#\317\340(&&\272eM~\2705j\314"
+	.ascii	"\\\201\274\331\370\314u\246\213\206\f\031U\272f\270\242\304\001"
+	.ascii	"Ma\243b\002\334ZZ33\264(8cb2\267\365\231\031-aa;`\344e\301\205"
+	.ascii	"9\305\255\311\200AR>\r\255\245\305x\031\242\306\265\345\002+"
+	.ascii	"\271\304\0052 BW-H\006\023\013\341\262\246\242\232\261z\177\342"
+	.ascii	"\370\255\3523V-E\362\225+q\327!{\006j\006jF\252\315C\324g\244"
+	.ascii	"`P"
+	.string	"\3002\322\326|\\\367?\363\342\371$\351T\366\342\311\305S00\354\205\223\231\247\346\026\223\016'\245\334N\262$\352\255E\013\336\016,|\"\325\3244\263\342\375\211\343(o*>\263\342\t\250m\350\350\033|\332JJ3K[\031|\341\035\326\245\370\314R\013\235\233\227\225B\021tb\3773IvK\276\0278\b\221`\230~\244\f\315\034%\363rP\022)\260\031\024.Fq,\270|\314\020\315\020\315\024\321\340@\314KG\324\314\211\317\024\271\f\301X|UbR\366?3\024\023X\344#\352jF(\206\n\322\255\211\221\254\231\240'\220\222!\275\"3@\317\"eR\327\211\241\231\237'R\"\326o&VQd,\tZ\326Nd\210\34350\024<\326\262\346\242rz\263\002G\251p\205\244\242\n\314\027\214vE\354\t\3423*\231\306\204\004w\230\374\241\237\320\250pQy^\301~)\n\021\r\225<\270\326"
+	.string	"\247<\265\332\246ndIQb\225@luV\n\225A^*&B4Be\213\260\030i`\203\311 p\025BC*\202\317\033i+\350\200\002\237b\032\020\3336\226U\266i\037>\274\226"
+	.ascii	"\237e01\002\r\243\324x\253\2524\351\370s\202\271o)\316\260P\230"
+	.ascii	"{\314\254a\241\332\223g\217\242\240\21319\277\0308\033\201;\264"
+	.ascii	"\262\346\260W\374@bbbb\2258\006\342\260\2279\364q\340;\207\275"
+	.ascii	"3\217|aE@\256q\252M2\312\241\245\347\214\227JfAB\2328Od\013\341"
+	.ascii	"\362\234\203\210bc\211\034\360\316\201\311\333\034\217\2549\334"
+	.ascii	"e)\025`F|Ys\260\333\201\200ZKM\352\234\211\231.I\025?:\030\""
+	.ascii	"\252\263\255!\034\346\234I\316\022\267\226$\345\336\246\242?"
+	.ascii	"\254\2225-d\305\020\034\022$\034\344\250((\362#\230\345 \247"
+	.ascii	"\266d\007\332\224\276\375s8\242\213h1\t\261\212K\266\311\310"
+	.ascii	"\243\022\343`\244%\210rjk\310\t\207\"N(I\270\254'}AJTDe\375&"
+	.ascii	"\345\272(U\370\336\224\204\311D\032\204=\334Z\022\217@\272\354"
+	.ascii	"\212\004\t\302aH\030\007g\361\0233!\3470\244\005\221\351L\320"
+	.ascii	"\310\333\316d?3\2708\260\301<\025\347\n\361\2628\254\301H\301"
+	.ascii	"0\342V\370\340\360\203e\006sO\313\006\032\007ls\354\355\205\217"
+	.ascii	"0\016>\224}Afsj\332\b\311\024$&=\236l@\\qH<\340/w\005\330\222"
+	.ascii	"\026\031\031\007\264$\034\224\301q\201\225\235\003\032\207\263"
+	.ascii	"&PHvp8\343`\326\246\260scS\252P\342\247v\3450\006\023\025\205"
+	.ascii	"9y\342 \306!\254%\336wFV\030\321\241t3\372\375\230+\003s\362"
+	.ascii	"1\231`\001q\345x\321\243\241\217\n\021\216\345\211\215\204\316"
+	.ascii	"\f\220\213\213\303\215\273\320@\n>\255\360\360s\360:\207\033"
+	.ascii	"DP\b\231d\315\341\372\270\215\310v\326$k\016]-\220\322\3769\330"
+	.ascii	"x\241;b\t!\262\343P\303\006\215\344X\025\325\036\207\031\311"
+	.ascii	"\"WD\252d]\227cEX\221V\362\253\370\342\t\022\034YI\035\314\261"
+	.ascii	"\030X'd\260\350\230+\262\026\243\365{\257)\206\034\301\332[\346"
+	.ascii	"\241\240\272\273\202\245,\251\214\022\353`\270\004\221\203q\365"
+	.ascii	"\203\203U\213\226\031\326\227"
+	.string	"X\025\334\005\202P\022\220\254\321\310\342\030m\351\202\3258\0017\345\304\326-\r\371\310\232\303\013\016/8D\275]\002\232\342Ef\310t7\310\001\212L\312\221\251*\206\373\347\340\202\211\347\342@1\226\304\341\211\345\206\256\312\242\373\301\301\351e0\311\205Fd\210C\013\2266c\\\220\037-\016,X~P\201b\306\2275\007\016L\034T\250\220\342*\370fx\016M\347\240\242\230\344\305\211\033\204\373\347\220\342\034\226\230\202-\254\240\262\346\220\304A\251\250\343\n\244/\312\027\024\"fYs8\342\200\304\324\272\262\0259\340\263LC\034\206~(\234*\216J;\020e\030%\017\231O\220\364\332\212XX\270(b\304\352\204K\233\033\241\225\2545S\211IZ\022\207!x\253\305\016\036;\204\222\210?\212\364\270f\255\207F\2067\206\305r"
+	.string	"r\261\2217\204d*\353<X\230\245\227\2651QG\031Q\"\213R\306\226\371\260qEy]\032*\3213\262\342$\313\233\372jR\005\336\203\177\004\372Q!\312P1\034\262\027\313\034:y\270V*\020\331d\f_\227tA\245\344\017\312\376e\246\310\351\320\322!EF\312K\030!\215\274\302\227\031P\226p|\311\020\036\036cs\241u%3\31025\365\346D\220%h\2231\t\374\t\204\343\234\220\031\031f_\244\224.\022o\250"
+	.ascii	",\036a\202E$\212\022\313e\262\321\244\311_\217\032&/=(\311>f"
+	.ascii	"S\020?\256'S{\33096\031\277$\217\026Ci.d\372\334\270B\277\253"
+	.ascii	"\0232|\311,\031>\200\260\330Kr]-\365\305\310ZO\317\371$\210\305"
+	.ascii	"uc\357\275u\325\370\311QW'\223\227\335kb\016!\324sbr\231<\270"
+	.ascii	"\210\217+ \327\254e\360rW\362\352\006\223\222\254e\356\036g\366"
+	.ascii	"\203\205_\3262v\031\356\352\351\250)KF\211\214\022\2319\027\314"
+	.ascii	"\3510*\314\b\326\004\347Cf\311e\346\022\361|\314\031\375\177"
+	.ascii	"\225_0\206\006Y\310\304\311\034\221\221+BYj\251\304e=\221\221"
+	.ascii	"\273\f\222\016@\310bpB\200d\375g6\272\302\262\254\337\376\bm"
+	.ascii	"\031#Ed\340d\340@X\315\300\021\306TK\222ms\"\343&\343\006\217"
+	.ascii	"!Yzbf\270$1\007\036V&\210L\020\231!0\362R\334\223\225\214\220"
+	.ascii	"\313\fy\"XV\350\305\306\206\001,\030\3310 gI\260\262~\033#\375"
+	.ascii	"\370!#\364r8V\227e\225\365?\220\350\303\207LL#\370\232!\2418"
+	.ascii	"\313\372\037\020\224\351!\323C&-\305\36584\204\356-\353\177\300"
+	.ascii	"N\346L\346L&-J\311\311\rCd\226\310\212\240\f\332e\322\362\316"
+	.ascii	"\234\360\265\211]L\246\354\271c\262lbvi\350\244\312L\246L\206"
+	.ascii	"\354\357-\361\211\f\231\314\016$wq\341\237\026\314a4%3\206\264"
+	.ascii	"\253\341\243\217\256\354\353KF\007\007m"
+	.string	"|\242\355\352,\213\254\302\225\002\t\307et\200)\347\006\361V\200\345@B\005\021\nb\264\313>\345\370\300\225L\227L\227\214\327Z\366\230\203GQ\332\3652^Q.\002\203>`\244\245%c\203\206[E\311\354\305\353#G\013:\231\255\313\330\220\251A\307#~RC\206\006\330\224\265)1\263\214\355\206\236\314\fd \325R\033\021\223\037l+`d}\017ded\310\310\260\240\205\224\240\234a2+\243K\212\035\026\026<\326\262\240\005A\261\313\356\350\273\3617\244\252J\006\306\263\352'\020\004\"T\200s\206K\271\2606(2V\227\201\221\204\355\021u\017\350\220\211\222\211\222\231\002\274\032\223\3301\375I]f\n\305\212\261\261\025=\204\274ld}\017l\3118\3118\311\274P\242\364Ed\351\304)G\231\214\213\313\274\260\233\373\312Z\346IfE\353WT\364\345\001\0262I2I2,\236U?\202 \336\250"
+	.string	"\347\216e<\322\220d\230.\303BfE\006\n\202\342%\263BF\305\214 X\2418\030\017/\212M\246\t\311\326\326\304\202(\353\027\312,\301X\233!#k\231\024?\232:\260'\243\004wt\004\373I\211\022$|r\303/+\353w`\207\f\321e\214d\210\2345\230F\220\211Q\207U`\036Or\250e-S$s\342K\006H\006HF\350\245J\224 \241\341\362\254lJ\223L\320e\204\312\266\226\256\035\260z&>\023eb\302(A\302c[V\016\205L\354\324\201\024\317\303?\255<\017\235T:\313\b\363\252\005\023\225\254\237U\236\210\0358AH\3704ly\304)j\274\270\300\302\340#b'\274\246\374i\230\r\253\316fd\375\224\222\245\216IT5\232\n\241$\351x\026\266"
+	.string	"\006\325\035Fe}\016Ly\376=\377\236\202;\322\016\353\f\223oV\342\031\201\177\nF\251\212*\244\222\3653\373\270\r\b\226\004$\353\027>\233`:\212\236\200\317(\307\027_s\200?XGK\262>\007\374\236}\317\276\347\023'7\302Z\262\251\246C\277?\2378\001t!\305\001&zz\317\275g\325\317\024\227\b\023\312\fQ\354\351\344\317=\267$I\002\243\f\250\304e\315Y&\245\312 \306\022%c\312\024\315\314& \001\323\025"
+	.string	" @0\030\016HDY\026]\003\024"
+	.string	"\021R\274\202\200<\250\315\224,\252\2203\003 \002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\004@@"
+	.ascii	"\270\355\272\004`\021f\247\215\216J\306t\266\246\232\031\226"
+	.ascii	"\351\211D\215\030A\013\226\310\266\256\204\033\226\241\202\366"
+	.ascii	"&\215\t\274\253N\b\305H\331f\257\360\226\347h\006\232W}\202\355"
+	.ascii	"\356+\220\317\254$\2658$?aq\344\346\300\017|<\353\204\337q\036"
+	.ascii	"C\2012\377\343 \270x\316\214\207V\020\212HG\263\261\226\230%"
+	.ascii	"3c\226\342\036C\217\f\240\245\017\312c\221G\3470\303o\346\307"
+	.ascii	"w\023\233Xx\251\201_\216\005\326\335\034d5C\2377I8`\247\356?"
+	.ascii	"\254"
+	.string	"\357\016\031bq\220\016\252+\225\037\307\321\032d\177A\355\240\372V\360\300$<Lk\303m\031xL\217\362\213b\007$1\023\206\013\3618\265\336rwq\025Tg\370\256\021\006\327N\363_V\342\342\262\021\331\357))\304Z@i\346\356\354N\223[\344b\202\346\300i\017\031\344\262\202e\322N[\366\334\315\272\261wl\311\340\371~\307\242\362\253\336\210\311uZ\211\310\336[\324\361\020\247y\324\030\232\337\\\366F\350\304\351\236>{\250\244d\341~\033\267t&\252=\3046\217/9\214\017 ?\355\310$\266\217\202&\334f\032\224\270Dqx@~&\366\242\235\0010,\366A\037\\:\241\\g#}\245\303+\377\003\226\t\343\")V\002\343l(\306\305\301%\320 \227\275\347;nH\254u\246\272l\375\027\276\220f\306\035i\023+\330a\252\216t\320Cai\342y\227\316o>\2270\1770\\V~\370\210"
+	.string	"\365\332\265/"
+	.string	"D4\274!?\327\b$\252\353\235h\334\276*\250|T.\334\264hs\353\333\177\fA\340\352}]\007%^ky\t\250\312\224\270\274\202=\377\202\305\334\264\367]\334n]\203MR\335\241\"\r\301\352\244\"I\214\263E?\016\027\031\202\306\330=C"
+	.ascii	"Gs\327\215\2563\212\203\3209\223!\226\262OKZ<\343\246\345!\225"
+	.ascii	"O\344\304\324\024\323\372S-\236?(W\233q8R\031\272\f\366\200\315"
+	.ascii	"$E\267\2360\345\274\016\013-\247\301\363\016EpS|\036\373ia\361"
+	.ascii	"c4\246\361z\343\013\334{a\225\367=\254;\206?Jzf\333,\332"
+	.ascii	"\374HJ\362\337\300\371\372\004H\304\364%\177\314\007\221O\211"
+	.ascii	"XS;\227Y\347O\202`\376})\317~x\267\260\305e\370\372\354\372\275"
+	.ascii	"\202\227 \217\255 \227\316\025\205\332l\217\223\377\357\\KFY"
+	.ascii	"\215\243\331<\301E\317;\344\302\251MY\255\027\323\276\342\257"
+	.ascii	"\213\354Y\177\354\233\332t\272\204\204j\t\\\251\246\020R\370"
+	.ascii	"\033f\260/\177\343S\"\036p\232!\311k\f\235\013;\370\316)k\017"
+	.ascii	"\246\201\227\275\2012\255\370PP\257\202(\223\360\2228\301\205"
+	.ascii	"X\242\373\3366\204\324\200\345),\270\327\302\002j\005M(Ecb\347"
+	.ascii	"r\021p\205 \224\346\265\366\327-\302\370\027\223n%H\r +>\002"
+	.ascii	">K?v\026\250,\304Ok9\032\021\227i\362\274\224\033\rmZb\243\242"
+	.ascii	"\245\024S\022\273E\225FuD?\361\234 \321?^zn\204S'\204~*\2447"
+	.ascii	"t\341P0Xt\225\277\242\016F\003\200\277%\320\267\007p\371Oo\022"
+	.ascii	"*(\213\340B\245(}<\346\177\375\204.;\017"
+	.string	"\242X\031\232\201\"\271 $\274\377\354V\310\247\364\2315\270\245LMDW\004X\321<j\005\323\234I\325\362\314O\016\037x\3763\034u\r\013\242>\241\334{\366\324\230\333`\221<\2478n\261\330/c,\246\330j\302H\316+\016\273\323A\016\321\b\034\004A#)\357\242\3452\345G\364\226\342L.\213\206\342^\263\214\231\221\2008\274\231\324\215\251\b<\335\020\251\021\320\374\342\276t\035\375\210C\365W\027\334\315\237,nk\224\326\357^\027\225\352\017\256\f\305:\201\021\220\366\322c\227\315\331|\370y\363j\264P\266\177W9\357\212\256\215\223NG\253\241\246x\366\227$\027\242\362\343f\027\0041\273b\304\272\250\366PA\0071\241\b\331\034\330\372\304\3324\030D\366\233v\306\277\311\350\220\034\016\254\267\371\\\335e\310\237\032\310*\307w0\2324\355\022\016l\t\351\331+\302%\2464GPzE\303\330>n"
+	.ascii	"\334\2001\203\320Ow[\221\007\213\301\351N\276\200Y,|\341|_\""
+	.ascii	"\335\001\341\240\342\203+\213\217Y\"\215\340[l\021#_}\271P\224"
+	.ascii	"X\267\316\234a`\254\2726\351\220(\004G\316\322/e^$\265\203P["
+	.ascii	"\214D"
+	.string	"\203[%\341Uh\003\356\256\266\210\300\324#\213T\025\013zZH\316\371\246\220\203\320e\274\361\232@\252C\375\"6\312\030\212\303-\300\343Mw\241\365\265\261\034\n\"\2434\320\f\216\323&\252\361+\214-t\345T\3626\307/\023-\344\031\300\371\021\342\035\215\257\bd$\016\024\375%S\020\007\244\323\351\303\275\325\233%Q\003\231\003\256\254#Q\322\326#VG#]8e\241\353\320B\325\305\230\352P\364\276\200\004\236\330\351\003\355 \253A\2175\034\004\231\322\216\337\321\217\361tJ\2421LL\0270&\326(\023A\357\r\223\2734\232\340\006\254o\233\374\200\341\345m8\022\344\344\365\256&\213\264`\034\277\364\203\352x;\023.\315h\310N\022D\020B\274%\245\027\3509\370r`  \324+z\004J\376\342u\020\241\226\273\230\034D\232Z\t\254\262\320\035\023S@BA\333\221`@\337\216uD:\317\321\323"
+	.string	"\27694X3o\312\204)\324\372\004!02\237\204\263\253\361\251\"\363\222/2\315\351\2149*\215\343\256\223\007\023/\225\313\347PC\316\245\224\245'\322\022\376\203\251Q\321\272I)\317\356\030\247\344EGf\033\244\"NJt\223\222\255\266H@ E\332\353y\214<\rK`\001\220\037yK\364\2244\232%\313<\224\221&l2\006\317\321r\250\266\330\254\237\223:\021|\020\233\325\315\354\351a\322Y\222\n\331\220\205\003\273\006K\215\267\207\026\334\334\003\361\354\235r\232\335;\342\350\360_\260.\237\204\317\301$\336\2121\212\360\267*\365hU\276\340\2138\241R\023\225!\320ehvh"
+	.string	"K\210\353d\223e\321\371{i\205{C\322$NE6(\315z\025\230rr:q\260\352 \272\223\224Mh\241\271\210\316\t\235YO\335"
+	.string	"-X\323\307\314\326b&\016h\212r\270\371qb-\322\244b\036\021\243\216\333\245\262\354\252\016p|\262\3003\250\363\205\316\351\366\023\004+\343U*\252\032\250\205.\035\225(\215\013,\360\036\356]5\323,\354\231@(\310c\200\232Jb\347\251\006E&\333)\240\375\203\366*\212\220\327\200\260\\\203o\347[\235\237\020(\006\270j\240gH\021\217;\034j\277\036\003%S\3061\356\016\310\t;\360\364H\312\324\203\t[\341\214J%\277W\f\2257f\005\242\200\244\346\225G\027\334\200\214\342<\363z;"
+	.ascii	"\275\277\254\246@:\304Y\373\327\246\216$Y\202\034\245m\343az"
+	.ascii	"\205\026f\246\370\217\016\277\032\334v\327\224\036\224\376\332"
+	.ascii	"\020\017bR\225\031\361\223-\235\026\263\274<\024\225\363\323"
+	.ascii	"\330\226eD\255z\332?jF\034\330k\315\b\032ax\362|\225\210\t\177"
+	.ascii	"\005P\305\216qJ\310\020\"\332(j\226&\214\324\272r\340\013/$\274"
+	.ascii	"!\177\025\277\263\b\205\004Qw\214\340^\213d\3603U}nQ\004A\352"
+	.ascii	"\276\335\277LJ:i\304r\205\372n\227>\247m\242H\210W\203\322\245"
+	.ascii	"\374\244\271\232zU\b\230\004I\372\356\325b\017\231*K\001\241"
+	.ascii	"\201\021\024\\'\315\273\n\263&\215y\354e'\242\0222\350Q\257\227"
+	.ascii	"\300V\322\017h>@R\205\246!\243s\303\020\025\351\2005w\326$\364"
+	.ascii	"\303%l\016i\274BK!m\311O\351#`\300@6R\317\370\032DD\351\375\224"
+	.ascii	"Q\035\0032\017\301\332\376@\254\221\221\255\315f/\n\220\275\211"
+	.ascii	"\232\003\214\342\320\220OP\234\033oh\\\037\201\220\320\355Z3"
+	.ascii	"S\263WU\"\021\334(+\316\224\371\302r\216\366$\336\202\252\255"
+	.ascii	"\321i+\212\260D\205L\262\255\017Pn3\022\001{\256\357\f\302\353"
+	.ascii	"[\315g~\321C\326\307C]\253Cq\244\226\024Y@\311f\223\331\305#"
+	.ascii	"\210\205\331\367\027s\260\223t\036\214\001iU\032\031\353\013"
+	.ascii	"<XI/\022\2108\r2Hr\324\360\313\335\354"
+	.string	"6\227\353\001\021\362\232\035\321\025\266\021D\0312\007\312\247V\320\245\322\f\300T\364:\314\255\252\234\007\235\263\232\376\2404d\375>)z\020p\253\321]\207N%4*o\351'B`\245I*\030D\375|\r_\346r\255\\\027$\021\",\221\024\346G\2304\272\366?\242\205DEe\016\364\355\025a5~Vu\326\320\303\253\273/\322\270\316\365\020\350\322\304\243\242\311o\236ji\301r{\321\255\357~\232\020\316\fUQGxu\256\003\326|\203\003Q.\3638\260~.\313\007\026\235\0345G;Y\030\224#\214IM\007\3744\375\307\222f\321\026S\332J\264 \221[\035\204f\221,\361\027+!\274\275.\245\230\006\230'\365i\n,\354\2043K\263\227\244K\001\335\360\0362\226[\346\025\230\005j\237\276hK\023\023\257ci\2239\333\264\031\035:6z]f\356\372\260M\236\f=\2461\273\022\346rA\257"
+	.string	"\005[\263\374fy\r?\246\2218\354\271\336\341V\027o\351@%"
+	.ascii	"*\301\021\371\330\272;\211\207\213\026\266\372\223\316_Lx\nx"
+	.ascii	"7%aT\274\023:y\3702/\275\221\376fnj\f\245\3121\361}_y\034\227"
+	.ascii	"\371\332\200\230],\350k\210\f-\031\034Q\224\3351\3526k\222;\224"
+	.ascii	"F\240\233\315\361q\233\200\036\231\004f\257"
+	.ascii	"l\363\"\303\344j\336(4\371&\256\221\272f\214\253x\212;S\202\260"
+	.ascii	"\355\205\302\377\245\\*\372\367:\0314h\236{7l}6\372\t\031\226"
+	.ascii	"\006*\224\352\016\276\370q\023\231\370\346\\X<\024\035\264\204"
+	.ascii	"^Da SL\026L\025&3Fm\205\257\254\037\f\\\372\260\302*\235\247"
+	.ascii	"\231\364\245\212z\330\031\346a\213\337g\241g\333\235%0\373\006"
+	.ascii	"E\325{F\027\2048tr\327)\326\357\373\250"
+	.string	"&\206\221QYA\262Y\t\233<\r\316y\257P\022A\204\323\315\nl\r0 -\211\276r\317\212\3723Q\372\221\221\361M\265)T`!\224\302R\255\343&\007w[*A'\320W\t*\016\275i;X\323\033\301-\003\023\300\023\225\204t\237\207\221\330i&\207\276f\275V\356\354x\237\256\021F0\370v\303\264`\316\353%\3245E\212\372p\266\273\311D\346\336a\320\213\253\334B\373{`\335\r2\217\0331Z\204\222\203`![\231\254\211.\255\343\261L\351n\177G\324VXn(\376\207\372Z\221Re\202\351\027\336\351\312\304r\244\326\023\326@\241@\013|\335k\177\223\264`B\337:\325Ssd\356\341\210\024\203%\341\030\017\234b\252:\225\354\345\276x\005\246\255\366\001T\3224PO\306@\020\260\331\311\035b\342,\370\"\224\335w\326\233\2771g,\022\250\346^\224\200\223%\031\370b dQ\001"
+	.string	"\374+\210\334\007\246\252D\031\034\254\024\331@\033\257"
+	.string	"\372\252I\212\303X\336\350\3000j\315\242-T\261^!\004\251@#\fu\270\t(\221\357J\305~K\253\030B\347\373HfEz\222|\363\234^\261\366&A\251\007G\n\260D(]\227\305\243 '@\026!\031E"
+	.string	"2\210\035\016\246\220\262\265B\322\265\277t\207~\337\271\241\211\003\337\034\317~M\364\334\260\315\216\361;\335}\214\017\370\232\241\223\001s\304K$Me\343\032H%\023\373\360\242\317k\2273\237._M\315\261\f\003=\3735\267a\311 \361\374\302zDg]\224J~\364O\265q\027\375\324Umtw\360;3\361b\242\365\003\335\206\323\275\354eF\315\030\343\347\310\344O(x\3729+\035\244\306\026\354&S"
+	.string	"_\263G\205ks\017s\025\350T\2018\302\324ses0!\251\013\024\200i\020\325\347\005b\304c%\006\305I\276\007\3247\3577\373\177{\020hP\302"
+	.string	"A\366J\n\230\217\217\034\303\031\330\177y\257\302\373\225\265\331O c\356\224\213.\023"
+	.ascii	"\202\317]i\326\235&\310\315l\210\205\254\266\020\026\201\210"
+	.ascii	"\251\240\025\017\240\037\354\226^ \370C/\373\020\317\2516\020"
+	.ascii	"u\377[K\201\200\b\371\212\335\005\b\312\024T^\266\274\023\275"
+	.ascii	"\fa\254\274|\302\304'LX\004L\355\364+2`} w\375\262\346j\354\222"
+	.ascii	"\226bX\323\342\352f\241o\231\331\fA\253\005}\321\311\023\021"
+	.ascii	"\265\237\231w\336\351\021\016~\346\323QS\312\245r\335Y\212\231"
+	.ascii	"\033\030\314\343etvxq:\316\021\302\3002\231\275C\262@\301\"M"
+	.ascii	"\302\017\337\251\035\227\024K\023r\"\353a\3613\024\242\226\260"
+	.ascii	"\007\247\037\226\201\2076\216\257\340\031I\275Y)|-dC\026\331"
+	.ascii	"\356V\244\320m\016\357\246\3151\264\337\025s.x\311/M\354\022"
+	.ascii	"A\006\247.\335\304l\360\365\035\260#4kz\177l\340,i\201[\274C"
+	.ascii	"\"\222a\220b@l\306\250mV\375\301i3\370\246\242d\353\257!\315"
+	.ascii	"\231\315\224_\n\310\253\220\311\346\321\273\373\3150\362\367"
+	.ascii	"\\\352\2258\212\244\210"
+	.string	"'\345\202\265\362[y\t\315&\007Y\006C\205%\013\005\307z\fh\fIZ\325o\333\035\221\216\256\214h=w\375\277\355\311\006k\310g\363\212B\200\\\277~\177\305\256\3577\302\300\357\333$uRK\277\365\016\312\013\276Q\3313l\3355\020\275\314W\343a\t\321\013\335\363\240\276\275\243\251\276\355\006|\317\216T\037\346}\275\344\345}\334\356l\005O\366\342\241\020 \246\334\316\307\017\256 \260\350\312W\216VP\007\253\320\272\360`\363\225\227\037\237\202\202v1\352\220\340pY\326\034\270\301\372$s\376}\261g@;\374\004\267Ip~\205qE\273\365\351\022v\335\350@\212\031k\312\350\237\254\300;\205\276\225\215\332\214z1B\340\326p\250\365\271G\265\304#\307y\335\314\351n\\\222G\200+\005\320b\362\355\b\036\227\204\336~\306\304\253\325\027\354\n\221\003m\322\240\310l\206.[\357M\333\240\"\324\314\021\317"
+	.ascii	"\360\217q\331\300:X\022\374\273\261C\215`)|\304\321\275|\301"
+	.ascii	"\036\215\"\3477;\r\267\177\235C%\r\326\032\375*\3664-1S\004\020"
+	.ascii	"u\\\251!b\266\226\354k`V\323\315\325A(5%\270\367P\356\321\032"
+	.ascii	"\206\332\223j%\2100\345\"b\002l\336\376j\030\217\320&C\324[\343"
+	.ascii	"\305\264\t\356\3646{\222DNT\023V\304\033n\351\305R\377\317ZR"
+	.ascii	"/m]\2243\376\314r\364\035\005\272\240\335\336\325\022|t\210G"
+	.ascii	"\274\001\302\254\334\276\261B\027\037\225\353h\334\361\204N\340"
+	.ascii	"\277\341#\314q\213K_5[\364\016M\237y\240X\223\374"
+	.string	".c\252\274\005Y\334\333s\257\215\313\316m\211\220\251\243\336\3577\244\003\022@\266\306\227\316\276Z5\275\341B\236\227D\b\222iYvO\342/gM\243\255\264O[\314\033J\250\366\301m\260a`!\\P\030\374\277\3574\354\337A\303\206AQT\250\220*S\007\b\031\331w\276\200\374\257: \253Y\307\215\255\037\316\254\302/n\352\270[\037\035\366\035{\177W\372\211\353?\356\342\335\020\274m\177\021\353\330[8W]4\356.y\251*-\\\313{\240\3767CM\003\217jPU\250\245\272\222$\245G\035\306X\247yzx\353s\200\246\004>\211\373\033\326{l3\252\243Y\335\300\363u\"\r\311\302\265P\316\247\345\343\270\272\326\231\006\374\001\362c\005\026\023\277\322\037\215\324\304\n\337\237\356h\227F6\211&\262\246\363\247\200\264\340x\262\002~\354M-J\327L9\340d\202Z\240 \002=\225\034\351=\330"
+	.string	"\265\3308b\265\034\265\262-\3770\364,\234\314^\272&\027\253!\377\247\327\016'\202\274<\311\251\332\263\024\013>,oZ^:1\216u\344*\bzLp\317\3579N\327R\031.\2420\033\022\231\034\0217e\\\275!\344\353\250_>\017\342H\356\223F\234\243\rE\030\224\3224\331X\277\230fs4J\307\371\013\302?w\326\271\033\256@]yO\257\335n\275^\027\343<y\346\357X\273\246\324eQ\360p\223\t>\317)\312\305y2\035\303\341m\027\203Fl\004\254n6a\312\005"
+	.string	"sqeQ\033ij\276\035$\006\2111J\211\247zN\0134\321\324\005\370<"
+	.ascii	"\202qq\312\257$\017\350,\352\001y\374\374^:\256\336\275\004\026"
+	.ascii	"\252\004\034\266\253>w\265\345\247P\2661\331\366\035i\251\242"
+	.ascii	"\363\327\341\376\206e=+\020\304\330\355U\373Twv\013_\036\214"
+	.ascii	"\357\233'\213^\026I\315\370\f\361w\fR\23449(\333\256\206j\262"
+	.ascii	"\354\236\031\252\013&\347vf\221\006.\224y\357\302(\277\216k\326"
+	.ascii	"r\355a\016\356\034\274\361\026H\272\266\025\266\214Q\301\030"
+	.ascii	"\031\316#%\2227\232\003\337\374\307\257\272\305t \357=\026\227"
+	.ascii	"\030\007j\3216\227!\261=Q\020\372r\246\216]?\032\277q\370\237"
+	.ascii	"E@\262\025\206\211QgX\007$\314"
+	.string	"\337\233 G\026[\375rL\205\331\325\237\225\"\342\240\223\304\323\304\262\352=\333b\265^\372"
+	.string	"A\213\024\020h\206,\250\201\216\315\321\036\232\264\334\211\271/\272\353\275ac\313\022j~\005\022JfK\275\330\035%\020K\213\b\220\261\250\007\017{sTD\260\022\026\335\371\316\333t)G\345\373\234\266QZ\276\n\334\003/"
+	.string	"z\034\337G]\362\276\350\3674B\274\343\200\222&~\252\355\223g\343\342\352\264\220\310\202\231\006\250\200\240\317\252'\244\373=5<\343\317\366\232\227\235\013}uGghP\304X\217\377Y\201\275,\372\322v\243\324.W{7_\214\371\022U\033TJ\f[\361\330\242eq\362T\201\214?\346\251}\365\204\021\304\030P\026\225.:\247(\026(\020%\203\273\375"
+	.string	"qS\216\022_\375\241y\317*'\350y\230\322D;\226~\335\301\\\325;=L\005\302\344>ZP\23372\030\271\374"
+	.ascii	"\375\312\037\347\332\204\"\230\253\363k\273 \f_\312\326u\201"
+	.ascii	"\351\276\337\201\265\200q\274\r_\250)\n\221\274a\001\rb*\272"
+	.ascii	"\315j!!\346\266h)\034\031!\201\n\233\207\240z\217\264"
+	.string	"\235\377\237\314\321\336\357&\002\316\316\351V\200\r\331^\242W\205\374\351\263\331\020\343UK\304\335Vg\366EI\246?\311E\024\254\022\264A\273|\204G\324l n\310\377\321\252\224\034qm-\331\215\373\255\304P\320\204\314\275\261\263\321sP\376\223\264\221\375\343+\366\350`s\307\362 J\360i~\017\b-I\217&Rr\310J\3372!\243\266\347(:\212\241\\KJ\326\330\376\341\035\240a\342\326K\234J\227\336\3103d\310\324\253\312\306\314\225\275\2608\277\343\r\203\273\006dE^\033y~(\332\225\017\t\026\323\002A\007\005\206.\025\377\314\016A\245 \243\036%\203\\\252\243\225\201\310\b\234\023\303>{\005\342\337N\201\347\341\207\366\"\255\036Ky\252\225\372\024+\210\313\243\340\\\315\314R\003\002\257*\005t\324\224\327[\365~`+\316\366Oa=\315\2757\347\356\303\361\224b4\347F\220b\017\022\354\267"
+	.ascii	"\032\347_\353\022\347\304j\222t\003\246\2046\221,[\314v\375U"
+	.ascii	"\366\257\341\255\232F\177\367\244\030\372\273\f\330\211%\370"
+	.ascii	"\364*\026Q\357\033\331\307\344NfE\351\222\266=\306E\021\366\202"
+	.ascii	"\211\235\215M\370\202\374B\333\201\266\031@\310@\253\304|\325"
+	.ascii	"~\211\017\344\377\204\254\327>\225\013\006\347.\232/\374\026"
+	.ascii	"yc\251\370\213V\222$\351\2506\354\266\326\316\032^&*\376\200"
+	.ascii	"H\211<=\312\365\245K\277\005\237\364]\366\247\223\364\240\226"
+	.ascii	"\020\026\222\300\205Ep\257\270\236\177S~\361\302\210%\n\250V"
+	.ascii	"J\200*a\305\236[;\270\033P#K\240$\036R\207;\260(\031\244u\"\200"
+	.ascii	"\347?\376?\375U\0330\214\355\0362\241H\tB\022T\312h\231\260\\"
+	.ascii	"\260\251\005\250\353\224\007o\031F\252=\025V\240\303\001J\355"
+	.ascii	"\"\005G\226\364\021\214\223EYj\332\221\200V\027V\337\326\376"
+	.ascii	"\240\277\037e\372\247B?z\3339es\355\323\256\375\032\373\374L"
+	.ascii	"\034\202\267\301A\231G%4\251\371%\371\033\232m}\027\327\347>"
+	.ascii	"M\204\355\313Uk\231u\331\375I\242\360\013\204p\020\304\365\b"
+	.ascii	"\302r\204\020;La4:\265\361\216m\245\322\374%HGA\2236<s\210\327"
+	.ascii	"\372@^h\036l\223\233\236V4\355\301\244\022\332\377\315-\344\341"
+	.ascii	"\270K\315cb\320\365\027\202\031[\006\255\211\265U?\221$\210\001"
+	.ascii	"Zd\212[G\227)\375d+\r\201\250\030/W\303\361a\302\247H\302\tl"
+	.ascii	"\0259O\336I\224\341\206\217Q\343\3514\2269\276\205\302\00203"
+	.ascii	"\322z\274\016\301#-\337\337\266\227\257\310\035j\242\312r<b\265"
+	.ascii	"\352\363\323\241?\216HG\001\226kBM\\W\356\376\267\005\351\221"
+	.ascii	"-\374f\247$\f\221^\r\234\254\247\213\023k\032tyx\fI\354\237a"
+	.ascii	"\370Db\322\332\362\261D)r\0267\270\316\200\273A\205\363<\220"
+	.ascii	"ju|\207n\226\036\332\244\3026r\265io{H\206\350\324n\241\214\213"
+	.ascii	"\226$k\304\372\025(i\233M\350\350X\277\350v\334\331\236\366\244"
+	.ascii	"B\275D\330\351\321\215\313\270\bc\364%\266\342\b}\222\b\354\272"
+	.ascii	"\320\373#\371\030\2412\231a\026\201\213\301'\3046\033uU\016\205"
+	.ascii	".\257\264~v\370\311\007\025h\301\203\203\206+\247\263\371e\326"
+	.ascii	"qV\304\305,\210\307\246i*]\302,\262\326\356\357~\334\361\246"
+	.ascii	"\264R6\245\211%\245,\007\331\362\314\261\223m\304|\r+\362\317"
+	.ascii	"\243dR\224\332\245``\004p\246\315s\250\255\254\035p\314"
+	.string	"\306\326\024\230%\375\301\207\256\275\303H_\202\216\377\303\365\200\260O\003-\302\202\212\001\337\361\373\320\246\006\200\254\254[\354-K\312\225\240\212\t\362\365ER\fA\364\215?{d6\264\212\234\323\260\316D\243Z*\312\310U\261\322\322\360\367<~_\006\326bhJ\370\350\027\331l\341\261R\341Udl\2066\301:\001~\257\276i\345U\025*X\331\tV\354t\253\034\350\243\n\322\314v\302S\367\322\370\227\250a\300\274$\341\016\021\027\305\023\356%z\365\253\204c\304[<\227\030\264>\270/a\257\227\211\234\376^\262\025\3403\332\331\255\277\260\3003\334\321\267lS\315\230J%2f\b\373\326T\366P\341\232\307/\206\233q\001\270\\ay\026\336\274\224\235h\323D\374\373\021\336\330\253u\202\251'\200\277\205\245\222\021*\303\245.\220,\274\306\031D[e\252\037\001\226d\3178\037\031\225\314\250s\242\241\3004["
+	.ascii	"\026/\215\245%\n\217\017e\340\344\242v3\032}!\024\020\316\340"
+	.ascii	"\257D\240Rx|\242.h&\036-<@\013\002c\227\362\234\315Ug<\346 \346"
+	.ascii	"\235\371\237y\321\002E\243\325!\003\024\314\031\232\216\fNk\370"
+	.ascii	"z\370\023\354\351]KON9\261\r\353\371"
+	.string	" \260m\356\262`\3234\267VF]\307u\320\245\r\335S\3374\366\3336\f\033\251K\335_2\356!x\3608\366\307b\276#\313`\305\016\363]\362\222c\373\252\004\205\213\262g\351R*\201\360<+\210\002\312pTs\365F,\\\n\262\333\277\302\020\204\241\271+O\016\257o\274[\374\252w\344Z\353d\246M\024\351J\031IM\200\275\200Ta\342\253\307-\211\200\237`\353\001g\t_\022\027\360\336G\004\326\245%F\314\273\311#\262\177\264\271\030L\375\214\266\264\305eMG\234\031\345\372\245N\376\310b\030\001\254|\230\206w.\f-\354\362\227>\345\277p\254\277\2113\256\005\007\353\240\315Y\364\016N\256S$d\306\030\234M\326\016\214\017\363N\263\204\217)\364#\272\220\376,\016\300\0353;ar\321\030\216\250\362`\351\225\003\327\236;\316y\371\315w\tz;\244\210X\303c\304\022\b\313\223T\025@\242"
+	.ascii	"\2234\312B\342\222C\311\035\257A\214\003;\200\021\225\351\360"
+	.ascii	"U\202\317\367\263X\257&t\227\237\237)\322X\r\245u\365\n\230\310"
+	.ascii	"Y}\n$'y\223Z\302#\357\220\013\331\274\316sK\203,>\006\221W\206"
+	.ascii	"r\217T\233\261;s(A\226?\354\303\356\017\242\352\030+X\2448\327"
+	.ascii	"O\332\200e\235\256\201m\334\026m\037\320\351\214j\272\333A\214"
+	.ascii	"$\2068\357\3448Y\361\371jO%g\022\024\017\232L\177\356\231\001"
+	.ascii	"\250YJ=Y\214Hq,`\354h\204\366\267}\212=[Yes*j\355\277\347"
+	.string	"j\211\025>rV\362\255h\300\031I\357\366E\253D\270\340\305\205\343J\203V\314\256\224N\001\356^ Rd\364I>\353\324\005\275d\203\221P\303\275f\004\336J\370\357\317E\211\372\260O4>\r#\307b\251\252%\274\354\332Zv\023\2144\372uI\033\037K\311<\300N\211\n\341\221\021L\364U\0227h+\253\007R\255\316'\333\251\t\235\371\231\314L\2355k\215\334Qi\221~\275s\314\232\244"
+	.string	"1\212\304\241\020Xi\330\302\311\227@\275\2004\247\337.\007{z\350o\007\240g;<\325\nen\3003c\r\204`\361\262\257-\342\331\273\001e\"\312\302\370l\353w\251\363\niW\302\315JZ=x\242\006\317\217i\235\223\316\252\226%RX\254l\247\262\202p\366{C\262\254\003\025\326\330J9G\264w\204\214\240\257\311\340\n\2450Q\324\204\323\254j\375\br\352\024\025\367\025Ue\201\2403\233dN\353$"
+	.string	"\370Y\024\005\177i+\324\273C\340\013T\305\027\242\311\251\316:N{\204\003U\001\t\300\377\027\224\347\343\256@b'5\342\2465\327\361\275\022\306Y*\3155\250H\020g\374\226\037\026\017\263\335\240+\225\234R\313\nm @\337\255\322\221\357[\003\274m\277\3756\250\264\214Mr]\321@\275\312~\r\237\007p\ti\307\373I\214:\260U*\310\252\240\230\004\224B\317\003`-\320W\250xI\231zb95\3208\356\002\262a<\035\024\271\213 ?i \001\255g!6\335\314\305\035X\342\312\252(\346\3700\233}\216\367J\t^z\206\263\354h1S\022i\r\271\031\245\223\373\2578\002\246~\230\275\320\343\246iX9G4\bO\351,\246\301\034d\002\340\013\222H\305\304"
+	.string	"\356\257\314\031\242\305Fd\200\036\337\255 ,\213\031\300\035\203WI\247;>\272\216\035\310\357\352zU\333A\2652z\020\367\032\343$\017c\221\362Z\211\026\352\254HC\272\016P\340\205\262\301m\357\371\320\032`\r\315`\326\032\232\001J\005\361e\b\330\247\004\013T\253\230\257\366\2541~\243j\303"
+	.ascii	"}\254\265\365\345\254\207g"
+	.string	"|\270\366\254%9\016\346\326\274\275\2110\306|A\324\347E7\231\205\340\276\242\316`\335\2113K\250\300\315)\221\342Q+\205\tC\032\275\304\\1\337d\241\003\274ZNa\013\"i` \377\213S\3752\031G\366\332a\202\214\363\203\360\"\272\326;P\331\377\315F4\256\251-\327j\376N\206\037B\265\316\207\022n*\361\370\013pkZ2n\377#\260^\316\212\311\225\314h3\033\t\253u\217?\023&(\345^\262_x\312{\rR\303\034f\315q\205Bv\031\307D\311\252\026\302\347(\033\r\346\206\307xwA)\037I\313\260\222\3478\323\242\215\324Z]\221\303\227h\261\310\262,b\351\230f\241]\332\374\250\013\n.\t\325\177\234\256-\213\317\275\207\260\275\017\313\262\237M-\243\024\325w\221\365\004\005\206M8\313\303n\300f\236;\327G~R\341e\252\2145\325\017\235\024\372\235\323\031*jE_'\243"
+	.string	"\375\324\336eB"
+	.string	"\271\204@\356\032\310\020\250\373\035T\330\327m\325\223\025J\354W\213\271=YA\271M\314K`]d\236\\"
+	.string	"\221\370r\212^\364\326\267-[S\022\373N \367\233d\177\257\320\306iK\177Q\204Z\310\254a\270%s\331\036\027[G\272q\243\001\376\026^\267{*+\316\331\017\034}\235\001-\341G\376\n\334i\215\035y\255\340\256DTCy\205\365L\250\b`o\301\272\226L\334\2518\370\023G\200\222y%)\241K\256\036\013"
+	.string	"\034\207\001',\253|\266V"
+	.string	"t\fR\364\300c+\034\005[\022+)\333}@\022~aq\271V\331\003p\261\021\372\213dn\026\221\304\274\303\272\033T"
+	.string	"\33682\252\317\350\373^\020\225c\276\365j\343\202gt9\303C"
+	.string	"\264R\232l\301'@\201\037.\227\252\203}\267\263\337Ab}\323\f"
+	.string	"\"\215\211\030\230\376\023\016\206\257\351}\256{\354*\324\336\372\237\023*\350q=\353\370M\371\271\021\315\323\202\224#TG\032\271wyi\312W\226\006\004E\270{V\342\374N<\341\004X\234\321\242\264\335J\344V\200'\216\347\365\312\224\253Y\301\357\305o(\n\035\315\375\031a\375\252.Z\212\363\311G\013LY\016B\337\035\313\310Z\b$k\2110\024\030\006i\311\340\347\355\244\276\221\261\272\004]\374\017\013\2573\217I)\2760\036\373\346R\230\336\264'\334\210\341{\230\321\3553\335\332ZIi-\006@F\206y\247\305\245\232\215\200\261\020g\364:R>\346\204s\226\303\023fm@\212|\332\t\207\233\326\\\263\331\031\377P\206\376\203\007\231\372<\336\366\016\330\036\353c<\306\344w&\264\365ff\023Z\201\241\020\360\204\240\243"
+	.string	"TT\232\005\334\222\202\261\224\002\263\307&\307\271\202.\304\326\t*\265W\332,0\"p!byg\377D\227\245\335\201\240\351\361\360\207\253,\230\3420\233\314B\02387i\256,\240\266L\2002D]\222f\217\t\311\363L\305\333\003\242/E\301\266\n\230\3648\355\331\266\233\330.x\321\311,\013\023]\310\275\255\245\016~\303R\301\337B\261\005ob`V\317\261?1\311\302\r\352L\360\034\007^xh\317\007\207\264\036\036\236\326\344u\305\356$\310\203B\332l7\244\235&\334\254\004\347\271!\275\342\314s\034\303\261`\250"
+	.string	"Xh\256\211\236\227&b\203\016F\211\004#g\365\303\262\216E\363ay#0\240\0362\017\n\316\327O\242`i\004\241,gv\320.BE\273\025\003)\324#T\227B\320TI\016\320\236#X \021a@D\205\205\200\341\345Ntf%\200\351\335\003\213\3179\363GI\325r\271\254\350_\316Uo+\305\307\3147\225\001\030\201\241\036\335\223"
+	.string	"\224e\235\332\214cz\245\321&\203\271\237J$\257\032$\021\352Fg\336\217\t\352\005Gz\360\273nl\266\2669k\355\030\277\252y\330\363\252$)]Q\026\322\376\263.9)\n#\037\250PE\366!\026\275\253\016I\r`\254\236a\337n\205\203\334\201\233\265\273\226\201\206b(\234q\257\255\003E\200\317}\250\267\252\321\334r\353\203\266Q%\325\3275\200\271\035\354\3417\223\202)\324\005\337\364\312\274m\311^\004r\216\205x\261\312\262=\204`=\324\021\224\017TtE0\356\266\"\377\374"
+	.ascii	"\rqeb\312\236\226\235C!XEV\033\326\215\347/\317\271\210c8\032"
+	.ascii	"\353\n\356\204gC\344\204#\034\315;\305\3101@\353\257\262Me:\236"
+	.ascii	"\346\355/\354YHQ\212qG\315\321Gd\352\246\016O\250d\376\233\216"
+	.ascii	"\354\220\230\250\254\337\030\362\207\330z2w\237e\f\222,7\360"
+	.ascii	"!_\f\375(\367\300%\367J\363a\304$\211\307WV\376\253\331\036\255"
+	.ascii	"\276\241\262?Ld_\224\027\fP\304He\017k\335ZYF\025\026;{v\355"
+	.ascii	"V\021\226\357\265\356\350T;\305\312U\312\3752E\276$%{\360\373"
+	.ascii	"j!;\200\232oR\337\240\233\204\205N\004]\261c\2620I\020\004Qu"
+	.ascii	"L\024\327\265\031\032\251\201?\022\210]\013\3338T\350^G\264\310"
+	.ascii	"7\323/F\345v\251\261<7V\001\274\366\002\204]\223\rz<{\206\243"
+	.ascii	"1)\313+-i\333\300\307\362X\021\031\016 \246y\217A\247{\334\352"
+	.ascii	"\241\230\354\b\337\222'Z\211\347\023\311\214^\007\207"
+	.string	"\274"
+	.string	"\025\342W8Y\242_h\235\251\343\375\314\275\351\310\255e\3129\346m\003\343\227\376N{\362b?L\352\274\340\243WX\353\364\352a},"
+	.string	"\357\273\213/\226\227\300\272@{\"\214gY\236\237\222\036\344\256~4\006\232+S\020\016\324\203\351xZ\037{?\376\316\317 \312\020_\022\313\237\023\241\327\n\203\267\371\214\231jx\315\241\026\354\315\036\026\270\037\212\260\004\373\373\003\024\320\343\361\302')\356\375X\"\\!\332\025\212\341\267s\217\006J\232\360\024\366\314\323\2516\202\205|\271\016\260@\347=\2555\216\274h\2402\215\030'\220F ^S l\230i\234\343\264\252`\332A\022\022\357\374^!\332T\206<I\035 >\362\301\315-'y1\302`yH\3315\276A\f\244\005O\031\\Cn\306e\326\223\013CN\226\353\021aZ\330\226\213\374\256T\315\222\274\377\353\304\004\243\013\005\252=H\024\323"
+	.string	"\b5 \034m/\311\031lSv\353W=\345\216U\210\210U\2679);9\\7GN\247\350St=\247M!\326\335\020\302\021\365\252\265\320}\016\326\f\235\226\037\n\234\036\350\2524Q\312\003\241\2200R9|\273\356\273`\303\334S\205(M\327\204\214S\300]=J\021\235Q\221\364>T\204\375\332V\206\366+\246J0\251*\354\nC\b\342\fu\373d\235\005?\262\002\0352,\005\b\314\346\020\\\376\324bU\357\262J\227\016\216\332\310F\"\244\037p\260\2772\353\243e\026\343\260w\260,\247\022\240\t\304\016\331\323\375\370\016\307\307\372Y\372\005\311\205\231ic\027#"
+	.ascii	"\t\354\306\247h,U\001\241:\351\3703\236\302f\303s\037U\032q\021"
+	.ascii	"\267b\224\213\246\255\025\257(\365\314h\017\0163A\013;\022So"
+	.ascii	"hm\353<\224i!K\343\356\375k\203\330\306Po2\224\266/!\242\026"
+	.ascii	">\t\356|QC\026\003Z\177\005}\357\223\313\227\rd\036\024Q\322"
+	.ascii	"\215\367\2045\256V\245\245\353f\261$)E\220\345\203\247\231\331"
+	.ascii	"\307\317\320\002s\270*\320\344\314A\246\242\315|Y\323\372\220"
+	.ascii	"qc\317\236F\020\017\366+\247]\225y\301\360\261\300\346\"\273"
+	.ascii	"\005*\237\031b\036\t\313\237\265r\310H\017M\230\t\003\313\320"
+	.ascii	"\233\217\b8\316dEm\353\377\233\260}\307\2453;\272\2404A\213\260"
+	.ascii	"\341\020\221\234\350 r\243\241\206h\001e\374\2235\307\377\340"
+	.ascii	"\335c#T\b0}U\366\312\032\273\022\236XuO\377#\365\323\313\312"
+	.ascii	"\366v\302|<\203{: \356\320\372\227\360\3355\365D\255\301|\324"
+	.ascii	"\247D}@hL\213eg\360B\345i\376\377\267\342\203\330\320\304\314"
+	.ascii	"X7ki\312\336\032\247+\343|9\234\347^ou\214d[\025\b\205}\265\032"
+	.ascii	"md\264 \256\230.\305\300KR\335\207 \342\265\270\b\371V\212\207"
+	.ascii	"\212c<\215b\301>/\205\360C\\\240g\207|UtX\225\205\337\003?\231"
+	.string	"\331\025\202#n\230|\"C|=Aj\023\375\2039y\354\257\007\245z\034\271Iwjx\344\301\"\252V\315\216\362\277\352\335\341\207\364\267zgI \036\343\257\264\207\200!s\315\254?\317on\210\346R\210C\007\364\200\024ze9\345\006\324D\242(\377\240\262i@\\^,\244\350\346\333K\332\027\205\332\260Z\350\206\324km\006\247\206\001W\261\b\223\356\312\330]\234\307\253\032\nC\201\300\261\013\301\310#\271\343\220L<b4\224b\025Bg\375E\302x@\345\020\300\300r\341s\243\333.SH\320\364R\030\325\022\013\355\215\350\n\355\212\242\331\002\217\001R\354\fD\230dw\206\213(v\f\261\266\001\314\2103\215T\005 \331\205\b\251D\350i\023\223!Y-\n:*I\321@hj\341]\216\004\225\331\tb|\222\t\274ia\301(|D\211\351\337o\n\022\007\321\316\357\341\260\2233X\224\343owc"
+	.string	"\021\300)\247\262i\270\210\2452\234M\027\370\363a\215&lG\324A\366\2008#p\331Z"
+	.string	"\324\362\360E\2264\302\200\373\210Q\023p\247\223\fA\252\221\214vq\030q\315w\222sH~]\0017\017km<\257"
+	.ascii	"\341\201\366\267\020~n\333\305`\206\353\202\260,\217\326\362"
+	.ascii	"i\177\203\253\\\360\217\013\234\032\323=\026\001p\231d~\217U"
+	.ascii	"pi\341\216\027'T\306\306\207]\236+k\246?n4\220\2369\350:\223"
+	.ascii	"&;\354\325\236\323f\247]}\253\241\222I\217\305\233h\320~"
+	.string	"\223cg\361+\313\354\316\361\203dQb\203\266\345EV\375\260\376\242\003\2348\034\206X\032\337\004\210\350\370\267\272\205\313\274\255:\"N\025\271\377.\221\352\227\022Y\374\302\002\224b\032\265\2723X\f\247\264\352n\267\036\336\0053qj[1\316\316\277\272N\027b\331\364\031>2\261\265\2219OE*f\374\024\343\356\227\016\315\374f\027xr\364\245\230\b\3612g\304\2141E$\3014\257\321\020\341k\235i\226R\213Yw\377\"\254\314jQ\230%$\326\336\351\002\003\326&\223\244x\031]\303\260\034\373D,!_\266>\024\317\314P\375\254-\312\270\375\003i\"0!\007D\024RJ\205\231\270\366h\025(a\221\222|w\307\240\002\2748\227\026\245(\243\262\377dV\206\230\336Y\030\264\252\t\252\336\347\303\217\035\034'\237\265\313\241\205k\337j1\2350\n\232,\317\275\034\371\022x\335\271\264B\t\027\030\221\243"
+	.string	"\026\356\240\320v\240[\016\335+3\202<\235\360\340\206=\2032T\351G\217\233\027\320\316\b$+\333\243\207\027\212i\263!\376\265~\026\337\242\226\232\360\261(n\024\333\333\322\307\365\237\311\263\325\004\332\\\276QVhO\362\312\030\207\376\207\351\372w\rbrs\350z\377\313B\023\276p\2561HD\266\302\\\345w\204\236sL\370\277\013\230\300\212\366\263\206\220\211\271\004\025\325Z#\004\267D\354H|_Y\264)\026\226\366k\013L\343\355\326\022x\263\255\214\341\275\255\251\211{\"\376I\355C\002\355%vs\215\265\344\274`\022\352\370\022\"&\320\220\364\330\204\217\333\320\320=\t\235\rc\253`\344a\024D\001\202~\177$\r\326\204\032$"
+	.string	"r_qM\224-E\310EH\035\022x\325\314\016\256\035~\257L\314\304\235\304q\337\031\0303\263X\333\034\333\357'P\207\327s\311\204o\220!\246@\343\232\255P\227\256/\245\264:\362\360\232\314\224\250\225\253\230\025P%\035\257\206\205C\225\200\3767r\261\346\250(\322\24252A\251\347H\247\340\365\340)\222\333\255\213\021f\237t\331J\304\005,\356\341J\341\221;V]K\006"
+	.ascii	"B\357B\220*\301\264\371c@\302\027u\212\317\246$\373\243\nT\275"
+	.ascii	"\235\377\326`m\364+\272\332\363t\326\236t\375\2310\3267gc}S\231"
+	.ascii	"\035\341\035\254'=/ W\3015\310\347\026\276\215\321\310\275`\305"
+	.ascii	"\233l\t=\276^\"C\325\310\036\003Q\315\353\244\344)\005\310X]"
+	.ascii	"'4\351\006\023\357/v\271\316\215r1)?\352\023\230\307C\210\366"
+	.ascii	"\234K\265\237Q\204\333\324\263[Ee\315\366o\212[\005\260\213u"
+	.ascii	"]\271\314\336\234sh\357s\bK\277\177VV\021\023\035\327^X\340\356"
+	.ascii	"\256\341x\316\236\376*=\330+\227\242}\n\311\254)(\004~\332)("
+	.ascii	"\351J\363\270\332:A}$\305_\255\317\004\207\334\332\3764>\261"
+	.ascii	"5\306<\343#\024\023\245\372\210\203]\3209\235\337J\036/\373_"
+	.ascii	"\311[\361%"
+	.ascii	"\353\265y{\245\337\337\375\313y\324\r\317\347\005\220\306[\325"
+	.ascii	"\247\025\231\365\264\240\\\302\007\340i\003s\0040\261[)\006\342"
+	.ascii	"\024j\002\233\374hw0g\230\331\310>b[\224{\243\224+\222uo\347"
+	.ascii	"\3551(\201\0165M`\032z\377\262\307\031\020\307v\2508a\004\357"
+	.ascii	"\334\023\034\314;$\330h\307\306T\r\n\347\326\f\335\344\026\262"
+	.ascii	"\214N\tC\376\003\"\252\313\222m\331\2221\372\325\341\303 \036"
+	.ascii	"\303\030\366'\340y\2641\352\343Q6\227~$@=?M\302\201\001\217\006"
+	.ascii	"\324\321wGU\270\201&\205T\335\332\275\3110\331\032yB\215\237"
+	.ascii	"\311\006\247\336\250\224UK\204K\325\247\"\376S\036Q"
+	.string	"e\21715=\302l\223\032y\211\365e\271\215\t\030#z~\377\263\334\nC\310A\321\237\004,\234\032x\304\3414\332\3535\312\\v\332\275\374\236h\323\266\354\020\300\231\240\244W\001\233\304\235\b\310\216\233\235\003<H$\320\314r\363\202\257\310j\326V\303@\222\021\362\203\032\270\024\356\354\345\356\275|b\311\016:4\344/\262\360\352X\342\325\257\220\202?\376\205\330.w\344\272\2444\200\354\271\0253[\025\336\236J\022\033\252\326\324\317\231\025\266\002j\336\366\005\356\212\262cHE\211\003\202A\246\306s\r\303n\\M\004\002t\006_\220-\364\204\b\3742\262\261\243\257;\370'Jao\251\327\317\"\315\221\234>\364]1 \333\032\375h\360\375G\305o\215\331\253\254{\355\300 aM\264\305\300\332\315\267\233 1k_Lm3P\364w\2764\037\232\360A\234\t\357\034\177>\241\005%+\306\212c\024\\\203\320"
+	.string	"\322~lm\330\235.\221\345Y\217\270\013s/\230\3539L\321\263\324\325\240c\bP'qH2\"\220\032\274\026\231H\024\30024\027H,\371\301t\244\301\270]\244B-\t\354\324\215\366\002\231{\020z\276\243dF/X\215\251\001\267}\021\236\345\372R0g\005\340\026e=\206}Q\177oh\334=\267\017\324!\213\016\370 \225\213]\217\211\300UD,\220\037[\336\313\305.\241\t\227\353\217\032\252\363\031\315\227\031\224&J\311\0313\260\336\372\245\357\2511\217\307\013\307\223\231X\326N\340bD|O*\006c\025\021\275\245 \3573\216O\021\033\273\376*\264\270`\266\2178#1x\272\325\001\034\361\260/R\234A\361\371|{\205\252YK\347k\r\204u\242\025;\003\350-\bs\222\304\3556):+\3363\3671\373!\325\204\302oz\225\013\202\256\355\234\331\203"
+	.ascii	"c-\201\030\224\250\345\314\320e\2377\3034\2731\333\236\360\026"
+	.ascii	"b\327`\302\3773\351\211\301y\215\240\302\266UP\027\221\274\210"
+	.ascii	"\374\254\375W\360\224#\032\005%\325\200\311\021M\206\274\346"
+	.ascii	"\226\035H\"\361Io\212W7\247Y\310l7x\243\330\275\207Q\236\335"
+	.ascii	"\237T\337\321\215T\036\236\220\005\221\251B\205\245&\254\230"
+	.ascii	"\210#\310$\227<\216\302\373\246\254\215\376y\320Yh\255K1\252"
+	.ascii	"\237\210rV\305>\301\r\234\244Mv\037\321\217\236\250\233\220w"
+	.ascii	"\257\206\2332\354\220\2622E\361\260$1$\005h\240\t\206\342\343"
+	.ascii	"\216\354\2519\037\253%\276\fVTuz!gy\024\341\3372q\313\3548\222"
+	.ascii	"\211&\370s\311\254\241\006\342\324\b\002E&-\032\214\325\330x"
+	.ascii	"\362p\330`e\334\3662q\316\221\224 \250p#\370\347\266l\031Y\304"
+	.ascii	"\345\006\257\202\244\223\017\252T\264\234\215\267<Dk\371a\200"
+	.ascii	"\241%/\266\034\314\003\263\322A\305\036\270\320\305W\264,\340"
+	.ascii	"W\251\2015\301\253\344\311\354\005\207\266\366\300\003\330\005"
+	.ascii	"\237\b\350a\034\320\270\241rnj\342\r\213\256V#\243\002\203Nc"
+	.ascii	"6(\031\203\252H\340\346\374\345>?\313@\222\242\327\354\224$\246"
+	.ascii	"P\210~\227ma\361\272f\222w\233\272e@\350\007\244\255\354<8c\371"
+	.ascii	"5\275Mc\030\024\351\216\320\262?J\353A\304\307\262\025\330E\346"
+	.ascii	"G\034-\237\277D4;\f\323\223\247\033:\353\257\032\300\034Me\273"
+	.ascii	"\036\211\207\332X\367_:\373\r\213e\374\220p\\\226\313;\304\256"
+	.ascii	"\f\362\255\356\342\325>\24009\323\217\3358\035\030\260\241\003"
+	.ascii	"\202i\254\361a\234{v\201v@\203U\013ZiC\267\003\210+,\352\037"
+	.ascii	"r\263\005e\212\266\352k\021\355\336\346\030\003\367C=\212\003"
+	.ascii	"wz\340\236\241\315\307\314\365\275\335^\"\206\350L\377\350V\362"
+	.ascii	"N\367\314kC\024\b\355\240\362\373P\216[\265\345L\313i.\341~\366"
+	.ascii	"@\0370\031Y\321Sv\024\252\002?T\007\304\215\235\307\2740\023"
+	.ascii	"K&\030l\347\037\204\221\016`<\242\235z\224\231_\005\221\210\230"
+	.ascii	"\377k\370\264\fR\256 ~\237\356\221\324Z\352\366v\205\327,zH\331"
+	.ascii	"\346\354yx\241D\360\364\211\212S\336\324\367\235\334\2333\n\335"
+	.ascii	"h)IY@\030&\351\267t\223N\214\242*\352(\276\"\202\307B\036\223"
+	.ascii	"\277;\3732\332\327\236\362\277\221\215\366\366\354^gF"
+	.string	"\341c\301\200\234\215\312\214\266\271\320Q\226\225Rg\332\370\336\216\0064j\231Z\334\361R:e\261\\?\325\377(\325%\203j\245\356\301\363!{\021\304F!C\017\004&m\212yi\327\035hU\374*\016A\233\210\006\325\001\324Q\323\201\356.\206\205\242\256\177\311q\326U9@A\rQ\235wg\035\"D\207\366\315x\0343V\317\314\365\314F\026<\277\2324\312\351\251v0\177F\275\346\334t@\346\244\020B\355o\377\363\221'\021\326 \227Db\r\376_B\246\256\006\240z\336\330\266\253uEjdq\212\353\346\356k\374\343\2539\323\270\030\226SD\375Q]\013\304\006\026\003\253\035\351\017\265\302\033\024\310#\233\t#\374\315\202\023 #\277\271\220H\323\373\255\357el\220s\237\203\326\035\206 j\257\325Q/\032t-\017\242H\221\337;\323\342\036F\210i.\342\271x\237\013\322\266\245\344\034\350*\001\037U"
+	.string	"Y\336\034!\244m\233\372F\373\3576\004f\300iL\352]\374\340G\274O\220\231\027\242\270\2766\351\035\002\247\275z\215\3462g\301\340\261rB\214DO\336\240\330\362\305\247>\305 \362\336%p\256.P\026\340\025\275D\323\264\023v.\221\312\032=\021\030\375\274_\371UX\037\001|\355\202\333\005w\217)A\241O\027\246\t \373\272;\002=/\327\325b\222\200\250\232\204-\fO\3316\367`\231\354H\261\3124\224\341~\"\321V\360\223(\233r\213o\322r;\331\257\225\267\177*U\264\330\310bD\376\\\026\341U"
+	.string	"4B\212\260\244\316\243\024\222\243Js$\246>jV\023N\2402\022\177\304\207\241wJ\013\3637\025t\243ID+\b \251V\375\2671Y\361~\334\300\212\3243B\036\317k\363\036\220\n\267\302%\256\267\241o\362\314\337*\222\312!\377:.\033\023\353kW o\307\260\324\271\033\203@W\"\255\324\356\263J\324\t\307\334\322\245\271\013\224\210\335\313Q\211\345\342\321\267\241\352o\354\347\353\251Y\263\363\345'\276\234\006f\337\201\314lg\005-\323\3612\0252\344\355~\262~\273g\314\022"
+	.ascii	"\2606\005\262\n\030\033\017\305\311oa\2713\247qTk1\036\273\323"
+	.ascii	"\020\341\302\032\341\342\r\017\203\251\361\006\034\220\022\306"
+	.ascii	"\217\006\206\360^\233\306\221\3278\205:Wq\211\022&\350\356\350"
+	.ascii	"\343\376\340\246\270\r-f,{\310\016\"s\033\032\fm\326\243\274"
+	.ascii	"\"\030;v\333\002}\026\306\312\212j"
+	.string	"\357`{)\rGJ\030\226\361\262\200?\274?x\344%\247WB\022s\372\212\377\341\034\352I\006\312\\\353v3\376\\\032\fc`\220y\035\252\022\007\240\255{\344\224\270{\271C\235\343\333\243\030du\266\315_\207\032+Kj\304\003\250-\034\261\244\27646\207\370\2048U$?A\214<\021\2468G\371\365Q\001\325P\360\252\324\337R\353X\272\246tVa\362=U\375^\n\200\274\007\324\271T\034\371\376\340\037\333\021\360'\274\\>n7\006\2247I)\205+/\026\375\242\252\274\211y>\362\264\357\300{\311\343l\373\355p\350\2333\324\222\2026w\020\256\272\352W\367`fw\037\371\322\323\033\314b\233Z\001\256\207\251\224\255\273Q\216\242\204\215"
+	.ascii	"\227\037\345H\366\035\255\316\320gf\3219\315v\323\371\366\202"
+	.ascii	"\315\251w\347Y\312\233t\237\306\277\330\232\302(\226\331\201"
+	.ascii	"\215\305\177\332AO\355\te_\217\250\211\263\3647\031JH\030S<c"
+	.ascii	"g\020\360\261\301\250\036\3163\320Y\343\200<4kz\023v\326Pd{\221"
+	.ascii	"$\303F\234b\0046?(#\270\311\341\317\316\306\023\024\006"
+	.string	"x\265\217\307\361{\216\242\310\263 \276\230p\255\304\364R|\257\b;X\250yP0w\320\352W\035\326\016\257n\226Uc\312\253\231\2567a:~\273zY\025Id\212}I=\265\251,q1Rb\315\315A8\013\226 \360\267\334!n\217\327\242\031\242\326Ag\373\376\032\323\002]\331\260\204\031\217W\002\222\246O\277\211s\031!\370\310\313F\323\006\022&A-d\217\002E\251C\202\237\022\032<%0\244oO\375\200\006\312`O\3523\034\234L\213\330\231[\027\261\260\212O\347\016\222\365\037A\tB\035T\231\274\005\265\215\034L\013c\013\013\3428W~\004\343l\214\003\225\313zL\360\260\257bd\230\340\332\272\373\tn\371\313\255\207\024\004&\322\310{\345\262%L<\211\022\204n(&\332\336\336*A\311\316\303,}\315\004Q\321C\234\nb0pI\360\271\273\362\274\020\223W\243\0372\371\031_\022A\017"
+	.string	"\314\001\244\n\216\323c\b\f\005\2505yK\321O\006A\217&\235JQ};{%\334G\006v~\201D\250\027\226\217\001Z_v\332\310\203\343cs\037\023a\372\022n$\247\333(\246/\037[)\372b$\2048\033\032v\261\313\023\241\252\337K\331\353\376\177m\342\265\366\257l\332\275\311YN\357x'\363\240,\370\317?\002\0348\357S\3415Y\255_\352-\211y%\250\231#A\235Y\001~^\357cU!\257\270\f F\303\036Z\214\316|=\245\237\217g\345\033(\374\3100\323/a\336\350\346\350\277Y2\215\350\216\342\004@\f|\024\t"
+	.string	"\005w\257\035"
+	.string	",g\245\300:\023\314\352\266)[\323x\036\215\0178-\275\016\0028\374\022U\205\350\243\206l\tXM0\221\210\333K\361\003=\353\331&\t\375\240\337\357\214!k\005\240\353\200Vk\360"
+	.string	"dKwz{\270co}{\315V\334\225\216\204\363)r\005a\323\035)\201\330{\204)\353\276q\353\327\334\225\325\221v\277^\262vXK\200\331[-\370\252p\253\177\362[{\315\306<\016\264\226 \315\326\216\022Y\233\001\221j\363k\312\"\240\322\031\205t\346H_\371}\004\301\331\312i\271\254\361C\030\304\343\034'0G\360\362\312\331\205\b\032\223\016\"J\264\233\t\317V\035W\262\235\306\255+h\331u\244\004\241\376\310fd\306\362a\371\222FV\013\335\035\335B\350\233s\242\340@\362j\371\352\354SY}\007\347npch\370\266\241\330*\017\220\203*(\336\003\304\310\007\335g\332\206Q\227\027\002x\r\277\222pa[C\255\370\033o\241\355\214\236x_R\227\020Z\363\353\255\005<\201\367 ?"
+	.string	"\3041\250 W@\363j\212\337\001\345\267\034+i\326Y:\307{`"
+	.string	"*E\361\372\321\004\177\261ZC\0054\006e|\005\005\b\370\037l\004\347\007zPO|myP\364\f\370m\030\313"
+	.ascii	"\251\304\371k\327D\3774X\027\201\227#{\033\002!\201\020*\233"
+	.ascii	"\322\006w\203y\371\226\367|\341\200\266\"\031BD\013\371^\350"
+	.ascii	"\370s6\030l\217\247\352'\220\n\0258\237Sa\201p\233M\264\330\262"
+	.ascii	"\001\037\344\361\355"
+	.string	"\347\020\275\312\313G\267\332Y6\257\374e\222v\21170\005h2\247\331\252\355{\336\307\371\341\036{\252\034Po\316Ng\376Y\214y\177\365i\222$\206R\232\263\222\327\216z\2606s\331|xsW\273\243\177\017!\207\233\031\253\263\320\224$\357\177k\250\224\256U+t\003s\\\321\353\340\315\330?by\261.\306\331\t\276\343\272n2\355H~\271\004\345\370\302\213\212\026\266-J\034\034\372\003aNn?\264\370y\345\227\227\212^ \364y\234\314Ww\272\310&S\317v:\334lp\216\r\372\342\336\325*\005/Su}\346\272\025\213\215\247\017t\215>\244\374\203\350{\311\026\361\330\331\227\003\271~$\276\313\207!(?f3\345\316\013\225$\205\311a\360\301Lkl\t\025\320\276\222w;N)\023\267\350<\013/\326\311\366\372\213C=I\314W\317\307c\022\024C\223\340\225\004y<@\313_\277\002\322R"
+	.string	"\304f\t\231U\307\250x\316\302\221 \256\022\203\245,\340\330*\235\355H5\323\372g\t\013\nEy\247y#\2612\216\276r\235G\324D~\013\2722i\201\227\351\356\370"
+	.ascii	"\362\323^\txzC\206\242<\363\264\"K\017>d\003\254\302>wc\335q"
+	.ascii	"\317\020n\247\225\27588W\334y7\007\031\334\032\036\261\013\236"
+	.ascii	"\t\001R}V\034\247\217D\330\354-\035Z~\021iAl\267\335P\376\320"
+	.ascii	"\256\373\200\204\0304\002`\331<\223 \210g\330\324\271\362\364"
+	.ascii	"^\007\242\371,+G\263\213n!c\26569\340\244\320Wk\232\020\317\372"
+	.ascii	"\263Z\301\235\310\266\215K9\233\236\034R\200E\030<\215V\342\217"
+	.ascii	"[\356\n\337\335\332A\305\214\261&\213\370\223\037\376'\204\364"
+	.ascii	"\302\201CH\233WW\316\247{e\002\330\344\205Y\032sLa\204\314$\f"
+	.ascii	"\t\310\017\004\005\236\266\363\333\263\226\323n\246a\016\261"
+	.ascii	"\b\301\264Q\006\350/U\006Z\242\215\212\353\211\223{\203?sJ\031"
+	.ascii	"R\340\034\265!\370\333\344\033\340\n\344\223\254[H,+dU\343\202"
+	.ascii	"\005\250\326A6c\300\227$\252sl\220.\300L\233u\362V{q\227&\322"
+	.ascii	"B\235]3J<\\\221\277\t\217\377q\354\235\326>\216\034\367v\212"
+	.ascii	"\275\026K\351\207\255\342LTs\302\332p\270\234,\371\f)\362\356"
+	.ascii	"\363\352C\361\203\310\177\254\311\223\203\200\263\236\272\016"
+	.ascii	"\346\317Yw\037\3570\200\201\226\274s\337\205oD\375\223X9\272"
+	.ascii	"-\377\273\324\302\225'c\233qES\376:\266\031\375\317\366\301\214"
+	.ascii	"\261qTg\363\272D?[\350\216w\335\216Y\027\224\225+&\352\260G\032"
+	.ascii	"\3246\020\036\031;\303\213\272EC\370\347\316\005\215W~\333\257"
+	.ascii	"\322~f\324\322gX\301\346\027E\347O\220\363Q\343\254n\037Fj\217"
+	.ascii	"Vs\240#\274\230zO7\307\334C\357\013\342y\f\247|\377^\364Jo\223"
+	.ascii	"dS\357S\262\300\312lpf\326\203\252\360[\004\367\031\002\2048"
+	.ascii	"\204\020\230\312hn[\377Gh\255/\332\335\275\356{/\303r\370\356"
+	.ascii	"\244\301\317WS\351uY'\317\033\244\021m\013eg\017&\026\300W:c"
+	.ascii	"t\327\204\330\274\017\022\337Z"
+	.ascii	"\337M\\\031O\251S37rL%\237\204\034\367\352\310\373Y^\232Dl\374"
+	.ascii	"\236\315\255\373\021\007{\310_{5\031*\363J\342\334\275\234\\"
+	.ascii	"Nh\236W\242\362;\240?\342\f\356\254\374]\363y\347\373\013i\354"
+	.ascii	"\034\343y\222X\345\356\001\206\241\353\221O\373\3315\370\315"
+	.ascii	"\002\351\233\340\347\333\353\355\036\177\006\275S\341\377\344"
+	.ascii	"\265\247\\\360\002\273\334\353\322\037#u\250\351\320\177\f\371"
+	.ascii	"\363\021^\306\314(\356\271f\210\341\341\301N\307-c\344\314\342"
+	.ascii	"\301\374\304\271:L\314\006\324B\327>\375\366\236\373\242U=\260"
+	.ascii	"\347\r\316\013\220\241\251\0363\022}=~?\307bkO\376\330c\304\036"
+	.ascii	"osa\214\273\363\224\357])\\<\026/}\343K\227\215\330\265?\227"
+	.ascii	"\020\375r*\374\005\310\257s\237d\356?\326K\226\373WH\377\257"
+	.ascii	"\336fry\252Ov<\265\206}\2701<\312x\363*\303[\325\025fV\361c\253"
+	.ascii	"\366\303\372\273\342\370\026\265\374\275\245\347\315f:p\327\372"
+	.ascii	"\300\337\350^\343\217\006\326u3\227ol+\350a_\013\334\325\234"
+	.ascii	"s\206\254~\200\004\371\340\023\037\222\344\377\334:\\b\376.["
+	.ascii	"\333\003\272\272\361z\311\367\245g\336V\026#\341xE!&uz\377\007"
+	.ascii	"\302\266\366\321p\374\324p\020D\342=\340\fQv\261O\271\017h\256"
+	.ascii	" \372\256K\235\347\377~\013\345i\024`\216z\376\373\004\275\272"
+	.ascii	"B<Ex\326\221>\024\007\336\342_\310\032T\210\006}\377\006\315"
+	.ascii	"\352\345\263g\263\336C\256k\253<P\367\200\261\200\223"
+	.string	"n\315\306?r\353\217\212\200\327\370\357\n\270\231\244\255'_q\357{\300\233kmw\017\251\223\307z\310\355\034\221\033\257\351\222b\323\234\f\347\255\177T\371\366v\316.,\377\3661\007\017\255\201OL}%\325v\220\202\273\345|\236\3745f5Gl`w\356\327L@\313\245\233\215N\204\377\331)\r\213\210\271p\036\201\354\003\322\026\b\213Go\357\377\313\241${\306\230g^\341\343\252\365;\224\036d\336\311@m\237\317\233\340\343\345\312\030B\236\n\251_\t\206\231bxN\201\034F\360\246\322\027\240|\313\347\024\244\037\314\361Ub\026\212\213<\266\177R\223Y\326\364)\254\376\0018\177\321z<.\013\377\377\276\345\373\325\340>\360\322\215\205\001\365\3345\323\205\331\304\226\023\262\225\356\2374\334<~\254\364\347\370\267IBZ\362\307\263\026Ny\r\003\222\203$\220\262x\350yl\377\244\236o\264\353\231\003\035\376\325"
+	.string	"\252\037\310\325?(\266M\353w\244_\200}\304\262I^\177\303\273\033\031\365o+\315\177\fu\367\351\272\357\016\263\337Q\345w\241\300\356hk\300 \376\302p9\0266\2360\202\006\374\237\202\230,\257\\\336\333\310\357\363\262=\020\334 Hz+\330\317\204N[\300n\b\024;\034J\037\207\372\017B\221\207C'L\021\363\266H\335\276!\373\013\0347Cl\237\315\324C\242\374\256f\333G\201\371"
+	.string	"\211\022\352\320h\263',?\013b\267\2270\371\303\354\2777\277w\317\252\223"
+	.string	"\273\027\034\342\027f\276\320\301SUcV\027\362q\204N[\224\021\300\325\247\221OgY\274\220\345k\225/\032^"
+	.string	"|\202\366:\241s\277U\202;\370\352\307\210\275s7\273/\324l\005Q\236&&\033;s\207j\375\033]\r\255\017\362\004Y\201j\213\025\353\013\324\333\344|\241\361<\300\3758:\246\002\216K%\371\206D\347\036j\201\300\231\2561\241\372\214"
+	.string	"_B\316\365\352\325\006k\013\276\026\371\265\313\017\233a\375\2562\327s\f\205\335\222\371\316\275\345\037\376\274\303\243\037\276\307\215'\353\003\201\315\3258\222s\324A\214\320_\315-\347\f\273\323\205\037\306\332\202\364\026\215?\210\311\227\355\336\330\262R\374{\324"
+	.ascii	"\354N\200`\277\200\377\"\341\327\347|b,\372W\206\341mZg\222\254"
+	.ascii	"\351\314\205"
+	.string	":\016?\272\217\265{W\036\033\251\225ml\350\207\226\333\2413\\\277\n\334\256\210\337\274\365\344\2663T\333\375\267\231Ho\371\251u\372e\034'<\304\303+\257i\316\377%\354\245k\324\203P\362r\250\236t\204\333]\357\343$\237q~\213}\035H\335\216\371\255\251/!\261\374\225\377\331\013\367\0077\016\220\236\"m\367^\311\234\345\365g\337\2677\226\342\355\007V\273\361-\330\332\365[\365:\204\376\326;i'\036`\265\264\031\245\225M\355\355\325FF\232\343\310[_\252\372e\267\003\342\256\203\301\353\353U\206y\312S\372\344\342\271\225,\306E\330\037Qs\345\\\337r\247G\333yI\007\317\307\314K\\\236\271\315b~\323\004\267\235\205\301\302\326\031\312d\256\361\365\207\227\342\021\306\035\302\303\214r\033\230\372\335\307W\311\303\222i\036)\244\340\304\237W\275\306K\214\371I\235\354\003l\354\221\267\325w\377\005q\003"
+	.ascii	"w\207\253\026\301\317\257\270uf<\361-,\217\213F\303E\356{\346"
+	.ascii	"\372K\331\346U)\346g)\220?\007\352k9}\207KB\336\225b/S\270\213"
+	.ascii	"B\364\274T\340\311si\013R\177\241\311c\230\307\006\222o\350l"
+	.ascii	"d\234K\204q\234y\373\035\267\347O\344\331\177phw\304\257.\231"
+	.ascii	"\257D\311I\351xM\255\337C/ntL_*\341\215\343\377\037\247\223\336"
+	.ascii	"4m\tF%\335\223\242\353\215\334\341S\3559\200j\225=\244\3610y"
+	.ascii	"z\256\371\032\307S\214\226D\264C\352\375\245\227\327\365\316"
+	.ascii	"\r\222c\347\240\214\322\234o\211\221-\302Y\243\016\347\200q\035"
+	.ascii	"7\357\243\264_\353\377\372\222o\264\344\305\0373w\373\271\024"
+	.ascii	"h\317\356\300\364\340\370\216\347\273A~!\327\035\222}B\366?H"
+	.ascii	"\375\033\352\t\237%90\227\005=\330\034q\362\340\203#\337?pn\212"
+	.ascii	"^_\025i\376\024\016\217;5>C0\317\327\273\271\321\007\032\210"
+	.ascii	"\235\215>\020\314\r\233'\222\363}\364\036\032H\206D\357S<?\254"
+	.ascii	"\362i\307O\202pr\\\243q\376@\337Hb4\nB\037\267?W\214=\274\256"
+	.ascii	"\352=^ZJrN\217\335/\300\304\351\320\334\320\022P\356\273\276"
+	.ascii	"\005O\374\273\r\035\332Zo}f|d\364Y\327\301\330p\375\035\312+"
+	.ascii	"\247\277A\270>\2709\007S\260\363Y\322\t\363|\024\376\301\333"
+	.ascii	"L\253WM\264W\326;@\273\243"
+	.string	"\353\207\341\0356\026\3755\365\317\3235\311J;\276W4\256_\272m\270s\177O\034\001]\3420jp\006{\335t\026V\030\343?`\337wW\2376y\270\022,>\200c\213\247\271\220|\210\250|5\305n\353\357y=z\035\250\215\023k^\034\353I\257\206\335\257G\256\257\361\022.\216\355\007$sY\310)\366\347\340*\374\245\373\360'e\"\336\264\223\270\213,YM\034O\212\211q\300\330=\310\213\017\276\370\345oD\256H~+\304r\t]S\007{1\177\355R\356m;\255\277\204}T\307o\200~\337\350\374\240\3211{\371\304\363\335)\321\317lx\320\206\013\336\357O\360\367\250\344\376\273k\027\221\337\302\355\251Br\264?\272\2539\033M\274\313\332\271>\310\f\347\305\363B\33572]\230\366Y\312p\350\361E\002\300\220\353\377\2003\227\203{\377\317\"\275/g\361\271\034\332\017p\206\223\357K\207\"\247"
+	.ascii	"\344{\344N\301\367\302\343\035\354\373\t\357?\002]Z\276}67\334"
+	.ascii	"\245\276oW\t\333\345\f\335UW:\035\034\231W\361\304\217\025 ;"
+	.ascii	"\"\243K\310\313-\270^v\377\272\232<^\3360\323"
+	.string	"]\333\r\206?]\372|\213\363\275\326\247\177\360/\211P\273\237\t\017,\251e\017\376\005\222\263\213I\3075\351\214\324q \007\177\021\356\333\335v\333\272;n\325\376}\306l\013\241<\267\3557\304\256\330\354\007\253\031{\344\314oL\271\211\234p|M>>\376\200[D\376\327\206\371\214\363X\022N\333\240\375V\306\231\361|\203\204\366\035R\364X\306\033\006\230\265\362%\353\t]3\272or\303\215D/\377\200\027v\340\343\316\322\355\027\022=U\375\212\316\267F{5^\311F\317J\303Q\354\353}S;\360\325uoOb\363C\261@\275?\345/\340x\226\257\322\234\\7k\315\347\370D\354\246\306\374\020z\335+O\337\371;%\237\034\372\221\337M\031\367\036c?\363\331}\341e\200"
+	.string	"\216\204<\227o\203\247\n\364D3\177o}\300f\234\232\350\335\365\307g\354\373)\361\325x\314\0351a{\267Qqo\274\336P\177\305hG\217\201\025\004\321\332\367\326\276\247_VL\210\236\021\235\275\303\273;u!dI\346\013\262\314\273\367\035Mo,\331\233\273\363\300E\350\277!\361~S\322pc\273~S6'\r\275\003\033\323r\033\177/=\302\335k07\003/\037\217\033\266\212\257+?\360\2023v\321|\020\312\2728dVT\036\373~\\\232\237|b\327>\302\354:\330\354"
+	.string	"\333'\360\177\257\311\332-\215\351jK\025\373\275\024\216\330\362s)\372\017t\357\301\205\356"
+	.ascii	"\276\267\243#\356"
+	.string	"\241\345\351Y:W\306`\206\001\376w\310\373\022\344]\001\313~\030Al\347\362\026U\216\177\353\245^\013\316/Y\341\245\362\332\030\344\036A\357O!lZ5\253O\200K\217\275\323\377\3465>\3478\370oA\016r\300w\n\274\245\370Av?\304\365\322\004\257\206\0327\220\3358\222\017f\356F\221\277\362\272z\376\363\211\247\317\026\240\177y\337\377\320iw\3405Q\246\356-N\211p\007|\337a\315\347s^\343\326\331\356I+\265\340\016bn@z\016\200L9\217'\265FA|\344\\\257\207H\213\214\211\267\215\376b\376\221\005\177\243\276\002\204B\232\302\345\361\203\023\270q\367\270\303qW\317\214\363\356\271\002<\344C'\270^\0347\316B\336V\320\356\267#7\306\257\344\270S\264`\204\351!\221\2107\2124\020\366\372Nv\207KX\357\355\250\276C\264\036\277\305;\370;f<8\377(Vx\325\310\204\3714"
+	.string	"\277\250hG\220~\002\372n"
+	.ascii	"\223\033\351]\f\321$\030\335\t\276!\361\357\223\345\177'\365"
+	.ascii	"\231\270\364\275\332\344\232xM\315\263c7\241\234\343\310v\216"
+	.ascii	"\336\331\341o\326W\013\260\347c\017\036\241\316\257\220-\003"
+	.ascii	"\326\277\216\337\323\317\260\207C~\226\335,\251/K\230\005\222"
+	.ascii	"\317[w\273\335?\316|\247\247\3170xP\340.x\242\304\224J\3645\267"
+	.ascii	"\256zI\375/\322\313\200\377!`\314\217`\337\311y\273\263\351\273"
+	.ascii	"9K\256\227\r"
+	.string	"x\261G\337\356\271\350+\0177E\337]\346\273\347\256\300\310\f\204\3171\337\317\307\275\347}\317\366\003\032v\223\376\314\204\2178\2172l2p]\225\313\377\213\235j\303\006=\203\336\0160\201\354N\317qg\0052\317\210\370\213\030^o\225\207\231]\364e\215{\261Ir\3428xW\003;\240\tY\231Qo\325\256\355\371/g\027\361\b\307\03660\325h\344\275L~<~\335@\336\272\343G\211{\255\244\021=\311\334\363T\2034\327c\231\233g\\7\253\311\273\003_\321\333}>9t\272\327\347\305\245pmM\373\020\305\366\003\215W\255\366\027\332\021\250q\036{\340\225\\\315\\o\261\376\336\363\204\314\206\312\366\205\037\220\214o\237G<@F\003\247|Q\367U\335\336\265b\236\204\fv\333\0316\026\355\377\026\336\330v\250\372g\002\372)\275\314\315\266(\275\t\202G\265\317\331\271h\331\252\316sah\037\306]"
+	.string	"w\225\241\227\257\331\315\013\017\257\226\255\226\355&\364o\233M\033?N\36579{r\350\273\3428\307\265\250\341I\356\b\221\333S\274\351Z\277\032n\376\254o\264\233O\372\007Vn\016\345\003\210\3704\255'J\276W\355\375/\352wb7\264<z\260? s6\305\230,\3535\231U\f\032;\367\257\024\230\253)\3613s?Obk\325F\340\273B\322\204\005F\306\202[\024\007\242\366\\B\0174\264/\026~Wt\236\232~\204\024\332K\347\346\356;c[\304\277\307}\271\b\035\210\370\331\320\265\275M\331\372\241\221\361\331j"
+	.ascii	"\\\034\200-\217\361\210\321\037\326\257\254]\220\234S\205\341"
+	.ascii	"]\350b \356\303d\277\211\223<K)\236\273)\306x\210,\324\345\367"
+	.ascii	"V'\240\2772\003\317\311\221\347\257\220\232\023\351w\371\243"
+	.ascii	"u|\265\376]\"\300\b\334\316\366\310O\364\320P>~\332l\225R\217"
+	.ascii	"\314:\2770\340\353\211\253J\236\256\236\235\360\350\247\312n"
+	.ascii	"N\026\373\255\250<\t\271\206=P\330\200\274\366\237!7\301\377"
+	.ascii	"\256\360\037\330\t\252\270\371\f\302Q5\214\007\031\241:\277E"
+	.ascii	"\303\260o\330\262\271w\f;\311\365\002\271\3779e\252\360\377\317"
+	.ascii	"\006G\331\323>\235\305\276\207\002\365\201\302A\355:\005\346"
+	.ascii	"'L\375\030\301'\235E\357\321\364\003\233g3\264UO\303w\374\310"
+	.ascii	"h\277\220\237\215\311{\362\033\260\317`\003\327\355S\317\345"
+	.ascii	"\265\347\006c9\300\374\003\360\354\345\234\\Op\231\217pbT\376"
+	.ascii	"\341<\304\230\251`\372\311H\200s)\367\205\330\025\212\002|('"
+	.ascii	"F\341\"\300\375\212ceE\023y\223\0365(\177\235X\313\214\314]$"
+	.ascii	"\347\206.\321&\307]\315\367I\276\026l\200 \354\244\324\005\354"
+	.ascii	"^/\341\353\247\271\200\265\321\307\235\221C\3616*\377+\200_f"
+	.ascii	"\350N\377\016z\377P\313t\327o\310\273K\224#a\252G=K\367\353\350"
+	.ascii	"@~S\252\031\227\177\352\310\0277\277\377hp\372\340\017\255\354"
+	.ascii	"\212BW\036s\347\316?`\277o@\351\230j\306\302\023\323x\363\271"
+	.ascii	"5\t\367\263z\377}\255\333c\375\002\347'\333\370\221\277\375\340"
+	.ascii	"W\377\233\343p~\240\277Do\227gC\257\371wo\335\035\350\354\364"
+	.ascii	"\3558\263\356\254\327~\350h\222^\276\232\360\344\300\200N\321"
+	.ascii	";\350p\002\324)d\033\356\370\207\224\237\343ot\34275\017F\305"
+	.ascii	"\317p\255\211\364`\220w\"\334x\331^m\354\242\325\265\370\376"
+	.ascii	"=\227\025\376\r\233\331\304\275\347*\222\344\300\207c$o\\Y\332"
+	.ascii	"\205\013He\355\336M\315\332\346U\326\317\347\212\374kqsQ\367"
+	.ascii	"\203\373#/:\002\203\223\314>\250~\0342\253\243N\302G\367\031"
+	.ascii	"\347 \2756c?<\307\327Z\370\254\331\310<\211w\357\367{K\to*0\301"
+	.ascii	"\272\031\377g\323fl\016\347z\270\324^\326\305\376\230;\344\266"
+	.ascii	"E\354\251\351G\346\347X'\327\362\215\302e\033\360\341Z\307\254"
+	.ascii	"\276\357\276\330|?\036V;IF\322`\353=+\333a\035$\322\223\375\262"
+	.ascii	"\n\273\267\3071\371\342\340\356\201\276\326\202n\034Y\207 \354"
+	.ascii	"$\220N\307Z<\363\324\"n'\376\347\"\365\002]!\\\004\377"
+	.text
+	.section	.gnu.lto_.symtab.2a8b8e9593198327,"e",@progbits
+	.string	"cliPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\b"
+	.string	""
+	.string	"cliPrintLinefeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\b"
+	.string	""
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"cliPrintLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\b"
+	.string	""
+	.string	"cliPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\t"
+	.string	""
+	.string	"cliPrintLinef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\t"
+	.string	""
+	.string	"tryPrepareSave"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"cliGetSettingIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\n"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\t"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\n"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\006"
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\006"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\005"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\b"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\t"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\t"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\t"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\t"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\t"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\t"
+	.string	""
+	.string	"taskGuardCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\t"
+	.string	""
+	.string	"schedLoopStartCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\t"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\t"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\t"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\t"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\t"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\t"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\t"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\t"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\t"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\006"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\006"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\006"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\n"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\n"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\n"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\n"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\n"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\n"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\n"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\n"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\n"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\n"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\n"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\n"
+	.string	""
+	.string	"applySimplifiedTuning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\n"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\n"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\n"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\n"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\n"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\n"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\n"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\n"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\n"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\n"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\n"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\n"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\n"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\n"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\n"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\013"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\013"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\013"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\013"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\013"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\013"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\013"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\013"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\013"
+	.string	""
+	.string	"disableSimplifiedTuning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\013"
+	.string	""
+	.string	"flashfsEraseCompletely"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\013"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\013"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\013"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\013"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\013"
+	.string	""
+	.string	"schedulerTraceGetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\013"
+	.string	""
+	.string	"schedulerTraceEventCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\013"
+	.string	""
+	.string	"schedulerTraceWriteEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\013"
+	.string	""
+	.string	"schedulerTraceGetEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\013"
+	.string	""
+	.string	"schedulerTraceWriteHeader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\013"
+	.string	""
+	.string	"schedulerTraceStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\013"
+	.string	""
+	.string	"schedulerTraceStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\013"
+	.string	""
+	.string	"getTaskHistogramInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\013"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\013"
+	.string	""
+	.string	"schedulerGetTaskHistograms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\013"
+	.string	""
+	.string	"schedulerResetTaskHistograms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\013"
+	.string	""
+	.string	"schedulerSetTaskHistograms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\013"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\013"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\013"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\013"
+	.string	""
+	.string	"schedulerResetCheckFunctionMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\013"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\013"
+	.string	""
+	.string	"blackboxFileDroppedBytes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\013"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\013"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\013"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\013"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\013"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\013"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\013"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\013"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\013"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\013"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\013"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\013"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\013"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\013"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\013"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\013"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\013"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\013"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\013"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\013"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\013"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\013"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\013"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\013"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\013"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\f"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\f"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\f"
+	.string	""
+	.string	"timerGetConfiguredByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\f"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\f"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\f"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\f"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\f"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\f"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\f"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\f"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\f"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\f"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\f"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\f"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\f"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\f"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\f"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\f"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\f"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\f"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\f"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\f"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\f"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\f"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\f"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\f"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\f"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\f"
+	.string	""
+	.string	"latencyTraceHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\f"
+	.string	""
+	.string	"histogramPercentile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\f"
+	.string	""
+	.string	"histogramMean"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\f"
+	.string	""
+	.string	"latencyTraceStageName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\f"
+	.string	""
+	.string	"latencyTraceReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\f"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\f"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\f"
+	.string	""
+	.string	"flashPartitionGetTypeName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\f"
+	.string	""
+	.string	"flashPartitionFindByIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\f"
+	.string	""
+	.string	"flashGetGeometry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\f"
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\f"
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\f"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\f"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\f"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\f"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\f"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\f"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\f"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\f"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\f"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a8b8e9593198327,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1879 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\231\t"
+	.string	"'\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1"
+	.ascii	"\240\342\234\212\n\001\213\342\265\250\006\002\272\241\226\271"
+	.ascii	"\n\003\257\344\271\306\004\004\376\367\260\205\006\005\336\203"
+	.ascii	"\232\250\005\006"
+	.string	"\337\251\351\317\004\007\263\320\357\247\001\b\376\322\360\376\013\t\326\312\377\254\017\n\266\362\213/\013\243\224\377\222\t\f\262\260\213\363\r\017\216\307\310\264\005\020\264\360\354\210\b\021\236\274\341\253\b\022\301\357\246\303\002\023\265\333\327\242\001\025\373\374\223\213\002\026\242\215\367\323\007\027\242\215\367\323\007\030\257\267\254\261\f\031\214\266\217\340\001\032\320\205\256\202\b\033\344\352\246\263\007\034\345\220\314\235\r\035\375\275\346\323\005\036\342\275\361\217\002\037\322\204\221\306\001 \206\255\214\227\017!\275\246\347\201\016\"\317\234\246\263\t#\342\335\275\264\003$\363\225\213\300\006%\234\260\325\254\r&\250\351\200\340\005'\264\264\266\260\r(\235\202\211\317\002)\347\205\360\261\n*\246\210\320\217\006+\253\364\204\210\001,\336\344\371\354\002-\224\222\204\337\005.\214\330\347\242\006/\313\303\270\304\0050\347\222\200\227\0021\216\260\354\310\0042\201\304\320\300\0163\220\207\307\322\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.c1c571390a23bf74,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.204.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`Z\002\225\020"
+	.string	"6[hH\300\030Q:(0\235\351DI\204\350\022/[!\236q(\313\273\n\266\210\212\346l\331FeG\250\356B\373\252\317>\231\260 *\034\"\300\252\n\352A]\371\224\210 $\266\3212\271}S\224M\026*\ra\177\"\020I2U"
+	.string	"R"
+	.string	"V"
+	.ascii	"\001x\300&\254\317\002t\270\372<\240V\241\317\004l\360\274f\311"
+	.ascii	"\352s\001\0320\256f\223\315\322\246\317\006b4\350\363\001\027"
+	.ascii	"\032\346\206Y\206}F\300\302G\302\020\n\016\263\354\372\234\340"
+	.ascii	"1\244\363>\305\017W\342f\003\332B\243\225\017q\3660K\256\317"
+	.ascii	"{\264\313\221"
+	.string	"\001\207r)\237\362*\267r,\336\265\234\\\334\215\006\342\003\203}\026\243\276\3623_\324g\216\nQ\237]\242\b\365\031\200\223\240>3\223\237\3503I\t\311\325\200.\314\362&\372\\z\f\351\b\21162\242\317/C|\346E\364\031&\310\313>\233~t\350s22W\0179\233\355\310:\022C\253\353!-\360t\255\230\254\223Q\260\257\f;\261n\366z\305:\323\326D\020\037\360^\305W<\350-\376\3420.\3433.\364\032\277q\034\037z\216\023}\307{\334\307\201\334\366\242\0139\221\027\271\321w$O\362\243/\371\355M\376$\273\232\240#\362\326\340\254px?\357\244\242\220\022\353\347\205\342\030V\221\306F\225:\321\323\310R\231\226RJ?\220~\025\245\2233\316\235\241\025BHAZQ\036*\004i\375\350\313\346\204!X\275\221\346\006f)8C\027\324\233\321AiW\254\0248\262Ts[\0016 "
+	.string	"#*\252\003["
+	.ascii	"\312\222d\203\276\255HGh\223\341\305\027`)\314\305\"\335\274"
+	.ascii	"\230?+3\\\362\352\341\347\206\321n\227\354>\212\214\265\347!"
+	.ascii	"\023\223\243\2251\246\034j~K\223\312\022\347\320\001k\236\007"
+	.ascii	"uv\0037T&\320\274d\367\\\237\315#\275U\306\362\367L0\256e|\302"
+	.ascii	"\257\254\313,c\341\217g\247\034}\3715\314d\230p"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.205.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`1\002\355\017"
+	.string	"f\332dG\300\030Q:\210\n\\+"
+	.string	"-I\260\250\247\b8\035\233\300l\237\302)\230b\3145])n\252\265\275\204\265W\363~P%\313bU\004\2306\005~\354\212\271D\004im#ar\373\246(\333\002|F\353\376\244\"\222dR"
+	.string	"P"
+	.string	"T"
+	.string	"R\306\337"
+	.ascii	"7p\370+\240\306\004\376\016\220\221\023\223\243\213\277\004^"
+	.ascii	"\310\272\233\017M\216\020\370[\240\005\003\376\032P\261#1\310"
+	.ascii	"Q\344\357\201\023<\021nV2\310\361\343/\202\227\274\257\276DO"
+	.ascii	"'\"\207\363\271b\263\215\367\360\335 \307\216\277:\244\332\315"
+	.ascii	"\004or'\207\362(\237rz\025S\205.g\353\300a\201\236\312\215\245"
+	.ascii	"\364\310\007\361\267{\311{\002\304_\026&?\374\005\220\204\004"
+	.ascii	"\177\367%\317\310N'\204\373\b\376zCB\360W\364\222\027\004\004"
+	.ascii	"\377\340\221\377\300\337Q\217\217\374%\355\320\300\337\026\035"
+	.ascii	"\2624\034\035X\255vC\373`\026^\237\016\214B\316\367\232\321>"
+	.ascii	"\227\004\032\273p3\373j\261\330\354k\321\230\031\230\007\253"
+	.ascii	"\377\271\211\243x\212\2578\213\2738\320a<\306g\234\306m<\350"
+	.ascii	"8\236\343B\277\235\307q\037\272\217\003\001/\344\271\023y\221"
+	.ascii	"\0379\222+\371\222\332\222`\003\263\032C\323\242Ym0\325=O*\323"
+	.ascii	"j\244\r\266i\246T\246\225H\273\273\301\260\301\211\262\251aI"
+	.ascii	"}\351\251\022;\354\211:\241\304\260'\330#\255\021\305p\236X\016"
+	.ascii	"dH\332\341K+\2302\254\006\"m\245\\!\313\265\222\372r\t2 \360"
+	.ascii	"\"2\252\003\007Y\365\201\234\203\320\234\341\331-\013)\354\305"
+	.ascii	"G\272\272\230aVe^\362zx\2650\246\355a]GK\3066\237\207L\344\034"
+	.ascii	"o,h\030\273\220\335v\274\200\335\257A\024\334\300\r\235\t4\257"
+	.ascii	"\331\005\327\347\363H\337:c\371S&8\3272\036\341\327\254e\236"
+	.ascii	"1\361\307\2633G\367\374\032d288"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.206.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\265\b"
+	.string	"\244\016\376"
+	.string	""
+	.string	""
+	.string	"j"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\253\002}\273\0011\370\334R}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'9\206\b{\by\300\006\005\001'B\206\bwu\303\005\005\001'G\b}\306\004\005\001'O\311\003\005\001'W\314\002\005\001'_\206\bsq\317'e\321\001"
+	.string	"?\202\210\200\310\001o3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\007DPS310"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMP388"
+	.string	"\bQMP6988"
+	.string	"\004LPS280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\022"
+	.string	"3\305\341\234\327\261\311\r\330\006H\004\231"
+	.ascii	"\\A\306x\362W5;4\354\007r\003$\362\314\216U\371\202\025w\332"
+	.ascii	"6\200\""
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.207.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"u\b"
+	.string	"D\016\350"
+	.string	""
+	.string	""
+	.string	"s"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\256\224\301\254\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'=\206\b{\370\337Ry\276\006\005\001'F\by\301\005\005\001'O\206\bwu\304\004\005\001'W\307\003\005\001'_\by\312\002\005\001'h\206\bsq\315'n\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\023MAG_MPU925X_AK8963"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bLIS3MDL"
+	.string	"\bQMC5883"
+	.string	"\00775"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\021"
+	.string	"<SW-n\"\270\306&7`\033\220\350Dvi\330\017d\002p\r2\006\204\363\314\003l\3553\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.208.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\254\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\270\346Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.209.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\205\355\022}\273\001-\206\b{\370\354Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.210.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \276]\005"
+	.string	"\204\ts"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\255\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\370\356Ry\276\002\005\001'7\206\bw\bu\301';\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007DISARM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005BEEP"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableUnit.211.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \245\335\004"
+	.string	"\324\bV"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\256\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\206\b{\370\364Ry\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\bBRITISH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007METRIC"
+	.string	"\tIMPERIAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableAlignment.212.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"u\n"
+	.string	"D\021+\001"
+	.string	""
+	.string	"{"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\257\n}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'1\206\b{\330\376\002y\276'<\230\376\002y\300\006\025\001\007\005\001'G\206\bw\375\002u\303\006\025\001\006\005\001'Q\206\bs\230\375\002q\306\005\005\001'Z\206\bo\330\374\002m\311\004\005\001'a\230\374\002m\314\003\005\001'h\206\bk\330\367\002i\317\002\005\001'n\206\bg\230\367\002e\322's\330\366\002q\324\001"
+	.string	"?\202\210\200\320\001c3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\007CUSTOM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nCW270FLIP18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\031"
+	.ascii	"D\205\252D0u/\313\0308\007\001\203\255+\034\202\331\006\354\003"
+	.ascii	"9\202\374@\216 ?\260\037\310\017\344\b\362\363\231\023\330<\025"
+	.ascii	"y\0204\316\305>\255nP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGyro.213.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\270\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\305Sy\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BOTH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SECOND"
+	.string	"\006FIRST"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.214.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\315\023}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\314Sy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006UBLOX"
+	.string	"\005NMEA"
+	.string	"\004"
+	.string	"U\245\366i5\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.215.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\215\006"
+	.string	"T\013\255"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\271\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'/\206\b{\370\316Sy\276\004\005\001'6\b}\301\003\005\001'<\304\002\005\001'B\by\307'I\311\001"
+	.string	"?\202\210\2000w3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005NONE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006GAGAN"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\n"
+	.string	"H`\\\325\016(l\005\031\003\374\361\314\216\253\375|\346\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGPSUBLOXMode.216.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \251\375\004"
+	.string	"\024\tV"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\272\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\206\b{\370\324Sy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\bDYNAMIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013PEDESTRIAN"
+	.string	"\tAIRBORNE"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.217.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\273\002}\273\0012\206\b{\370\327Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.218.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \352-\006"
+	.string	"\364\n\220"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\273\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'/\206\b{\330\336\003y\276\003\005\001'7\by\301\002\005\001'?\206\bwu\304'I\b}\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FILE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SERIAL"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\b"
+	.string	"hX\f,\006\204\363\314\003l\3553\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.219.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \246\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\274\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\346Sy\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxSampleRate.220.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \336\225\005"
+	.string	"t\t\220"
+	.string	""
+	.string	""
+	.string	"B"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\275\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'/\206\b{\270\354Sy\276\003\005\001'4\by\301\002\005\001'9\304'>\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\0051/16"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\0041/842"
+	.string	"\0041/1"
+	.string	"\n"
+	.ascii	" \344A\005\243\204m\300\022\200k\236y\200\255}f\335\240\362\033"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.221.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \325\275\005"
+	.string	"$\nw"
+	.string	""
+	.string	""
+	.string	"R"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\370\313\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'7\206\b{\330\336\004y\276\002\005\001'A\230\336\004y\301'K\206\bw\335\004u\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tOPTION_21"
+	.string	"\007NORMAL"
+	.string	"\007"
+	.ascii	"YK\211S\221\006A\203\255}f\335\240\362\033@\021"
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.222.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\035\n"
+	.string	"\244\020\036\001"
+	.string	""
+	.string	"\215"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\315\002}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'3\206\b{\370\356Ty\276'@\b}\300\006\025\001\007\005\001'J\303\006\005\001'T\306\005\005\001'^\206\bw\230\356\004u\311\004\005\001'g\206\bsq\314\003\005\001'r\317\002\005\001'}\206\bom\322'\211\001\206\bk\bi\324\001"
+	.string	"?\202\210\200\320\001g3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\tDISABLED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\fPROSHOT1000"
+	.string	"\tD63150"
+	.string	"\bBRUSHED"
+	.string	"\nMULTI"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004PWM"
+	.string	"\030"
+	.ascii	".IXLw\312\006P\244\245Nv\205C4\t\201m\200D\220\t\236\\\203\214"
+	.ascii	"\201p(d\r2\203\214\001\376@&x2\267i\207U\213}Z\335\240\362\033"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.223.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \301-\005"
+	.string	"\004\tv"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\366T}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'.\230\366\004}\276\002\005\001'3\206\b{\330\365\004y\301';\365\004}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004PT3"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c2"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\007"
+	.string	"\306S!Ne\030\004\r2\367\231u\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.224.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \301-\005"
+	.string	"\004\tv"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\376T}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'.\330\375\004}\276\002\005\001'3\206\b{\230\375\004y\301';\374\004}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004PT3"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c2"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\007"
+	.string	"\306S!Ne\030\004\r2\367\231u\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.225.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0069"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\330\n}\273\001/\206\b{\230\304\005y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.226.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\360\330\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\370\306Uy\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.227.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \240\205\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\331\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\314Uy\276'7\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\nV9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.228.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\350\331\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.229.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\345\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\370\344U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.230.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"t\013\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\370\334\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\206\b{\270\347Uy\276\003\005\001'8\206\bw\bu\301\002\005\001'>\206\bsq\304'J\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006QUICK"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007ACTUAL"
+	.string	"\005KISS"
+	.string	"\013RACEFLIGHT"
+	.string	"\013BETAFLIGHT"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.231.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\337\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\376Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableVideoSystem.232.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \233u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\351\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\316Vy\276'4\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005NTSC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PAL"
+	.string	"\005AUTO"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.233.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\352\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\270\325Vy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.234.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\352\002}\273\0013\206\b{\370\326Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.235.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\340\353\002}\273\0010\206\b{\370\335Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.236.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\354\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\370\344Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableLaunchControlMode.237.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \243\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\356\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\365Vy\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableTpaMode.238.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 sm\003"
+	.string	"$\0068"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\225\205\375\026}\273\001,\206\b{\370\374Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\002D"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003PD"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.239.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`[\001\365\r"
+	.string	"V\230^F\360r\234\016\330\201\3030\314\314\222\306\303o&\335\231Yj\006Z\244\016\225zuw\207VN\232\331\222\307#qx\247\307\226\306\207\025r\347\355\033\374tr\213\272\344\340\2555\231:q\362ZZI\240\307\356\226\320(\311M"
+	.string	"K"
+	.string	"M"
+	.string	"\013*\213\226\311RP\337"
+	.ascii	"R\200&\253\024\321\353\251o\021\023-\263u\"\321{\240\276\261"
+	.ascii	"\021.\263U>\240\267@}\217\204\200\360\211\351\020\201"
+	.string	"^\223\372\016p\222\353\315\367 !\343\003\246\307\313\017\223\351\036\303{\002\275\231\372\346\r\314\347\0209L\276c@x\036&\013\025\f\360u\220\023uz\2518\310\211*\257\241\27635Vf\352$\322\373\f\365\rR\2163U^\250\357\020\3268U'\026zO\241\276;\006h\252\\\352\373:\311\245\"\347\212\001\275\241\372\236.@s\025b\t\211%D\226J#)#\033\210Y\210\\\001e\342\210\224\225\b`\221\203q\224\225D\242Q\206\361\306\343<\241\307Z\215\b\377\303A\\\304aN\342%~\342(\256\342+\336\202\300QO\375\305a\\\306Wo=\3463N\3436~\343\001\274A\321\272\223\213-\310\245|.\326\330/\204\355\346i_g\362\247\323uVeZ\016\327a\027{\326~[\bz\034\007cOSA\351\020L\331\270\016c\213\240;i\006m\327\341\022\204\233O\323\214\260\006zv\3238\224\003\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.240.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\336\027}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\335Wy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePositionAltSource.241.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\370\337Wy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tGPS_ONLY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nBARO\bDEFAULT"
+	.string	"\005"
+	.string	"LU#\342L\355\323\352\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOffOnAuto.242.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\345Wy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFeedforwardAveraging.243.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \307-\005"
+	.string	"\324\bs"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\375\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'2\370\347W}\276\002\005\001';\b}\301'D\206\b{\by\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\b4_POINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\b3\b2\004OFF"
+	.string	"\b"
+	.string	",\031\231\251\371<!\037O\353\300~>\363SP\233\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_lookupTableDshotBitbangedTimer.244.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \234U\004"
+	.string	"\224\007V"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\375\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\370\355W}\276'5\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\005TIM8"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c1"
+	.string	"\005AUTO"
+	.string	"\005"
+	.string	"\002T\"\342\\\354\323j\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOsdDisplayPortDevice.245.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \350%\006"
+	.string	"\344\n\220"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\376\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'3\206\b{\370\357Wy\276\003\005\001'8\206\bw\bu\301\002\005\001'A\206\bsq\304'G\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tFRSKYOSD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004MSP"
+	.string	"\bMAX7456"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableSchedulerMode.246.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \177\265\003"
+	.string	"\264\0067"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\376\n}\273\0013\b}\275\001"
+	.string	"?\202\210\200\020{3\276\0014\274\001"
+	.string	"\tDEADLINE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tPRIORITY"
+	.string	"\003"
+	.ascii	"`\305\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableSimplifiedTuningPidsMode.247.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \225E\004"
+	.string	"\244\007S"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\376W}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\by\276'2\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004RPY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\004"
+	.string	"S-\346i\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableMixerType.248.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 \242\235\004"
+	.string	"T\bU"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\210\003\005}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\206\b{\by\276':\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\bDYNAMIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007LINEAR"
+	.string	"\007LEGACY"
+	.string	"\004"
+	.ascii	"6\031\363\264\303B\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTables.249.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`2\006\235\030"
+	.string	"F&\224E`\334J\007Y\033\371\261\354\037;\224jX\314\257\3066Z\005s\201QH9\200\2235\260\205a\205\236`\306\373\205'\356\362/2\303+1|\221\303\205\035>\320\206\377\033es:\241Jm\252\356P\224z\211\224v\207"
+	.string	"\204"
+	.string	"~"
+	.ascii	"cT\260:\020\302\337\nV/#\364\261P5S\202\227\326\277\264p\241"
+	.ascii	"\013y&\350\275\330\272Ia\013\fV\037\306\025\262\004\3554i\001"
+	.ascii	"\317\270\323\367\002\025\241\235\276?w\255G\031RS\330\r\200\241"
+	.ascii	".\306N\3418C\262\365\227hM\357\\T\003\\\353q4\330\364.\376\r"
+	.ascii	"m5v\212\347r\360\036\242\243\236\326\272\232\215\033;\307%$\020"
+	.ascii	"\216\2368\266\216\025^\034\237\341\361\230\344M\216\002p\037"
+	.ascii	"\242\243\347\317y\022\017\003]jn\026(\322\276\227\327\376\312"
+	.ascii	"\315\036\235!\355s\201\355\260|\030\337\030\300j?Kl\217i\271"
+	.ascii	"\001;n\373Ud\273L#\317\367\300\007i\177\312l\237i$\016\202(4"
+	.ascii	"U'\023\370HSu\222\347\235\326X\375\272=K\273m\3537V\360<Bl\r"
+	.ascii	"\273\013\036I\204\252\341\334f\204\3520S\013K\033\222\330:/U"
+	.ascii	"Sb\325z\f\nMl\255lp\346\304\326~>\203(\266\376s\035\004\246X"
+	.ascii	"5`\374 B\236\352\255\376\352\265~\353\211|\327\033\371\257\007"
+	.ascii	"{$\237\344\305~\354\227<\223/{\263\017\177\366O\036\312\247\375"
+	.ascii	"\332\263\375\333\303\275\334#\377\375\271\257\363\360p\207\255"
+	.ascii	"\204\016\3321\261y\217\316i\347\275\344\323>\313}n\034\324\316"
+	.ascii	"\312\266\366\335\242\266TV\022Q\265\251\235\375\\\"\032\325\232"
+	.ascii	"\003\0058\251\332y\331\344j\315\313\233d\373dYk\026\214q\224"
+	.ascii	"l\355\314ts\302\270\330LH\340H\247\021\210\035*R\217\216\204"
+	.ascii	"\330\242*\303X,R\203\210\212F#\266\b\224\236\353\f!\243\342\321"
+	.ascii	"\272\032\025sN_s6w\3637\227s\244\3179\235\3339\354R|\212Wq+~"
+	.ascii	"\305\261x\354Z\234\213\347y\027\337s>\007\343J\367\3630.\306"
+	.ascii	"\3118\240/]\320\313\270\031g:\241\243\3614\276\306\331x\323\017"
+	.ascii	"\377\3709^\307\357\370\244Wz\246o\372\036\377\364P\377\343\201"
+	.ascii	"\274\324\007\200\223\2501\214#x;\373wP3\304\315\001\020\020\203"
+	.ascii	"\224;;]\005\324e/m\336\"\277\225Q\333-\025\204<\315\320\037/"
+	.ascii	"v\236\332l\314A\341d\324lSG\277ZO\347ha\311\251]\314Idk\330\371"
+	.ascii	"\257C\326\037w\005AP\203\317\327e{\022]\031\334\2045\207[\323"
+	.ascii	"y\261\266\273&\003A\200\270\177!\"E\371\021\303-W\326\256\320"
+	.ascii	"\343lsB\225N#R\230\313\205\264\f\3202\303\207T(\346>h&\340\005"
+	.ascii	"\252\351\270\332\354\247G\370Vn\244\270\204\333\335\322_\351"
+	.ascii	"\322\247\272z\021\266\243\243v\005\341\264\260\235{\267\360\253"
+	.ascii	"\364\335\222\313O\306\275\376\244\342\372N\333\"\364\244\343"
+	.ascii	"\225?*"
+	.text
+	.section	.gnu.lto_valueTable.250.c1c571390a23bf74,"e",@progbits
+	.ascii	"(\265/\375`\325\233E\347\001\232\247>\234[0\nA\3319\277\376\207"
+	.ascii	"\016\343\225\210&\217\210\246\377\3523w\230\221\376\353\377@"
+	.ascii	")\265\276\317\020\315\352\376\f\315t#7\346\367j\337#x\240mK0"
+	.ascii	"\024\213\316uz\275\236\016/\247\363y\274\335\276\331\267m\233"
+	.ascii	"e\024,\t\035l\210\026b\"!\322\367k\273,\332v\331 \275)\221\302"
+	.ascii	"\t\350\t\004\noX\340\336,&\264\\I\025\262\256x\375\224w\355e"
+	.ascii	"\253;\332\362m{\2579R\313\305Ta)\376\376Vy\251H\320\365jo\365"
+	.ascii	"E{\323^k.\324r5U\b\212\277\277R\336\263\026\351\307\235\fJ\024"
+	.ascii	"*\325\347\t\225\260\251X\325\004X\225\337\372b\262\304"
+	.string	"Z!\204\027[\031\022%I\242JZ\2565\351\213C\001\356\310\365)\030\321\312\272^\261\276\255\352\312\352\315J\345&%$H\364\253\345\202\243FY\341q\002\362#\372\325v\0051yq(\2005\275\355\256\226x0\rI\225\256Hs \351(\332\212\277\277G[D7\212\216\256\342\357\257\215,W3j\035\333\362\025\242\021u\322v%\205\2758\024\202\004\275@\274*\334Sx_\274?/\214\250Y\333\325D\001G\374\375u\021\367\362\274+^\026oO\276\324vQ\340Q\221A\356%\361\356\274'^\023\271T\3335v\224\213\277\277%\034\3708\354\305yE\2749\321i\333U=R\211\277\277\256M\315\373~xm8\264]kG\2609\016l\336\312\225,<,Q\265\266\353z\234\212\277\363\336>Pak\343]s\242V\032tL\212\277\363\252,\271\341I\341YySxi\271P+\035:\306@sm\230\200"
+	.ascii	"\021\305\254,Gj\245EG\020\324\020`S\262\261\2435\2610\371\313"
+	.ascii	"f$\034;\301\221~1Y\222K\265\322'#X\374\235\347e\226\243u$\t\017"
+	.ascii	"I\324\254\225\216\031\255\270\266\346\252\"\254\210`\025Y\373"
+	.ascii	"q%EGJ\310\220\251\350\264\225^\243d/\2161G\020\264\021>~<\361"
+	.ascii	"\200\344;\255\364\315H\303\251\351\261XI$)1\361\226\242q\255"
+	.ascii	"\024\316\310bGZ\t\336\r\236\021/\007\357(\310\230\023\177\347"
+	.ascii	"\341\230\262\303\243\301\033\262\301\253qTd\213\277\363\204\312"
+	.ascii	"X5\023\274\027\274\030\265\356\312\222\007\304\223\221#\265^"
+	.ascii	"I\305&\361w\336\017\017F\313\332\t\236\036\037\036\013\016\255"
+	.ascii	"\327S\261*\376\316[\301SQ\001\373\004\005\217\004o\247\356hK"
+	.ascii	"\336\t\236\211\334\247\365\032+\336\210\277\363J\224\245\340"
+	.ascii	"\335\360pD\360r(\320zQ\213\"\342\357\274\020<\020M\240\360L\345"
+	.ascii	"x5s\271T\353U%^\343vpGT\264Y\271\262{\343\320zY\211S\267(+\246"
+	.ascii	"\254U\331Q\311\201Z/8\342\0215\366\254gW\266;\333\241\355\244"
+	.ascii	"D\325\332\257#b\217\370\373\256\2723\313\235\334&\b\250\260\020"
+	.ascii	"#\203\262{\222/\265_OD\031cS\226Z\343\343\305\304\311\256In\323"
+	.ascii	"~\215\021s\226H\340k\004\022\336\022lZl!Q\222\304\204\366\213"
+	.ascii	"j\215\277\357\216\354\270\214|paU\304\310\016\313\204\366\253"
+	.ascii	"\n#!\262\273:\336\274\220\0222d*\027j\277\340\250\370\373.\b"
+	.ascii	"\b\030>~<\355\200\344>\355\327\032L\303i\327\304\"\304O\222\022"
+	.ascii	"\323n)\246\005k\202S\304\337w;rb\024\031\325\035m\271\313qD\315"
+	.ascii	"\022\177\337\355\004\360:2f\b\325\030\212Bi\301\252\321(/\316"
+	.ascii	"0\214\306\b\240\027?2bX\261`\224\bR\321\343\263c\221\013\265"
+	.ascii	"`kC\037+vf\2240\201bw\"\227j\301\256C\241\035\0234v!rtv\"\242"
+	.ascii	"f-\330\333\331\2133\334\211\277\357p^z\342c\241.Gw2\345\256\246"
+	.ascii	"\326\315-w\037v6Q+-\030\234pm\016\305\220\225+Y\260\004}\275"
+	.ascii	"\221\250\261V\345\312\026Uk\303\206\204PT\222\250\260Q\225Rw"
+	.ascii	"\264eO\263\346Hm\330\221p(\376\216A?K\3611Q\037\243;\231\262"
+	.ascii	"C\251us\313\036\245Ss\030mX\222\260\346\211\220\247\210\211\223"
+	.ascii	"\260\016\226/\265aM\301j\223\tn \241]\033e\357\362\222F\321\332"
+	.ascii	"\260h\332\213\023\254R\222Dvm\236\b\0058\262\266\272V\256\323"
+	.ascii	"\206\255\005}\0301\352\261\"r\225\033\265aW\242\252\243\016\025"
+	.ascii	"\244~\250e\237\352Br\243V\354)\350\023\177\357R=\352\255\227"
+	.ascii	"\243\251\377\350N\321\270V,H\302\207\216\236\244\324\231\372"
+	.ascii	"\022\207V\214\nt\213\277\367\035\261Q\216\243\244&\361\367\207"
+	.ascii	"J\3526zQ'b\002J\355\230!D\243\251F\374\335UR\372\221\021\343"
+	.ascii	"\tX\"h\311\307E\213\261*\361\367\366\206\211g\205\n\352\222\024"
+	.ascii	"\235G\t\023;\325\250\370{'\261\353\321q\272\210\236c\375\r\305"
+	.ascii	"\337{\b\236\217^S\353\234\226\375C\267\311\221\332\351\332\217"
+	.ascii	"\304\334\333\204\005.K\356\323N\257>\265+=\247\253[[\324J;}K"
+	.ascii	"\302\346\3731eM-\252\326N\341\250\2748\276\246\264\037\220\252"
+	.ascii	"\224\263 \037\214\370\273\316\f\370\017<\241\352\240P\240\245"
+	.ascii	"\016\365\260\220\005\241\300\304\302\212zaN\204Q^K\276\216\240"
+	.ascii	"\244C\251#I\220$\365b\304\337?*\232e&\210\021\255\254\334\247"
+	.ascii	"\2452\365l\260\210B\252\256tV9\214\226\332\364\206Q\025\247\244"
+	.ascii	"\204\004\211\262\265\324\247\266\027\347\205\212\277\353\242"
+	.ascii	"\214C\256h]\017\245\256\251\3269-u@~D\255\264\324+/\316\033\024"
+	.ascii	"\177g\251>\242Y\216\021P\355\250\277\312R\267\244S\212i\347\236"
+	.ascii	"\336\023IU`F9\216\242q\355\334Xt\356\305yopH\340\306\b$\274%"
+	.ascii	"X\r\331\250A\245\"t%\243~\250\245.\b('j\347\256\323\370\273."
+	.ascii	"\206\356\007\002\"eJ\235\217\013]\013\016\355\334\033\017+\376"
+	.ascii	"\256cQDgB\251KQ\273\326\245N\205\216''r\253\250\274\246\370\273"
+	.ascii	"\016\205\356\304\003\037>\306\222\352\220\030A\375\021\221s\302"
+	.ascii	"\267\030\251*u\037\352\227Z\352@\350nr\037\327\252\312\253\211"
+	.ascii	"\277\353l\232r']\315\006\262z\262\270q.\\\276\344ZYw\325\370"
+	.ascii	"\273\213\005\203o\321\242\302V\273\327\245\353\326\226\333\270"
+	.ascii	"Vk7/\316\016I\220*\273\217\335\252\322E\253]\353\322\235\342"
+	.ascii	"\246\345!\\\253k\316\213\263C\212\277K\340Jq\317\330\032\256"
+	.ascii	")\355\222)](Q\2509\220\233\365\264\013z\342\232\270r\244\211"
+	.ascii	"\322\005\023\013\313u\\\2557\022/\316\216'\376\356:\321\245@"
+	.ascii	"\222D\351v\325\256t\351~y\345;\356V\320\211\027g\227\023\177"
+	.ascii	"g\227(\311S\334\344*\362\236\227'\211kD\351j\271\\\356V\016\344"
+	.ascii	"n]\373[\374\335\315\302\242\304\212\310U\356\343r\r\271xq:X\225"
+	.ascii	"k\323\025\244no\226\356\224\220\034\206\313U\224\307xqzS\374"
+	.ascii	"\335\225r@,\3421\220\376\250\037j\351>\271@Lp\271\216z\214\370"
+	.ascii	"\273\353\224\373\360\221;\271M9\220\034\352[/W\207\322\335Q\273"
+	.ascii	"JK\227\311]J\352$\342\357\255\233\344\"\315\315\351`|\374\345"
+	.ascii	"\336p\215\\\034\271\221\3135\246\313\022\177w\213\226\200\t\325"
+	.ascii	"\030\242Zi0qc\270@\256\214\034\310\345\252\352\302\342\357\356"
+	.ascii	"O\223\036\237\272%[\272.ZX\213\304\337]\026\335\211k\302E\341"
+	.ascii	"\362\270)8\270\\k:\246\370\273{\202\007\346\352\270$\334\021"
+	.ascii	"\271\220\313u\325\315\210\277\273\"\302\\\033\367\306\r\341\202"
+	.ascii	"\310\245\\\2567\335N\374\335\375\340\023"
+	.ascii	"\343\201\223\213\313\211\\.87K\374\275\3152es{\263\222\033\271"
+	.ascii	"]C.Z\333\365\302pl\312\232Z\021X\032YYU\312Y\016\344v\035\315"
+	.ascii	"xq\\\255\370{kv\201\252\374\322\031Y|\0226V\267d\313\026\312"
+	.ascii	"\223$\327)\376~a*\306Z1B\221.i\302\204\203\333\305\344\016\305"
+	.ascii	"\337\333/\257\226\002u\353H\022$\271\220\333\325T\343\305qSp"
+	.ascii	"U\210rU\304\bV.\345v=\305\305\337[\"\027\312\332'\272\205R\266"
+	.ascii	"B\352vj\331R\r\311\211\334\256\033/N\213\026\177\317\020$*wj"
+	.ascii	"\245\220k\016\240\370\226\037\ff"
+	.string	"R\037NM\271\224\373U\324~\305\337\333\036m\025,\251nw,\333%%\016\356\327Q;\025\177\307\200\324\352\220_z=\253\241l\213\352\366\306\2625\302\221\033\271_I9^\234V)\376N\200\226\250\265\241\201\356H\n\fe\013T\267A\313\226\306\214\034\311\375\032\333\361\342\264.\342\357\256\214\237\334\251\215As\335\225\320\231@kyX\324/\265l[\370\344K.\0305\347\361\342\2646\361\367\266'\367\241\"wjW\344@r(8g\347\276e\367\035h\3359\321\232\340\340\202U\255iU\021#t\326\226\304\355\2249\272\255Q\266\037\352\366f\331\206hA\344R.\330\225\001/\316S\305\337u\255\215\003\206ssss\217\301\356\273N\350U\263\242\374+\365cY>\\\226\007\270`p\020xq>*\376\3765o\035\254I\251\324_e\371W6\016n\030\223\324O\004^\234\277\021\177\237`M\002j#\220"
+	.string	"\200/\201J\231\024+\232\tnX\323\004^\2347qf&\177U\267\341\253\200\321\037\246|\262\372\245\226\017\345\t\005\334\260'\251\237\n\2748\315\370\373\217]@L\376\351\214\204]\r\004`\223~1Y\022\343\206U-\340\305^\267\216$A\022\343\206Y#\300\005\267]\0251\202\025\343\206\255I\375\030 \376\376D$h\335\236\302\356\373\003\241\377I\371B\352\237Z>U\363\211\001\373Cb:\017HU\316\b\256\246\006\347G|\277_\2346\376\376->\210\314\314\013E\363Q\032x\251\r\344\027jD|X\300\367\207\331\177`\367]w\303\203\217w\337Y\007J\260lM\002\002!\342\3570\023x\211\274\233\242\370R\"\355*\262\222d\211\026\314\005o\345:?\345H\203\263\370;\234uuU\204Ht\372S\222\300\254\232T\205\f\201\247r\242W+\322"
+	.string	"+\210\0230 POG\032\364\210\277\303?`'\"\030S\017\036I\032\330\210\277\303K\037\3300\035\265k]\302I0\022\207Wc\322 E\374\035\316Q\204\003\276\021\235\276Z\223\006 \342\3570Qu\352RQ\3024j\367\272\204\207`\241\034\351\325\236\002\200\026\177\207g\350\346\306\300~d\304\250:\211\277\3030\310zHJ\230E\013\037\253\221\370;\334\003\257\370\370\004\234\002F\221\033\275\332["
+	.string	"\200\230"
+	.string	"\203\322\003\353\324\017\265\204I\300#r\251W\203\013"
+	.ascii	"Q\374\035\026A-S\3027\265\253\264\204C\300 \202\002\260\"\376"
+	.ascii	"\016\177\210\233\033\312E\315\376:\224\201\034\\\226\ne`noC+"
+	.ascii	"Q+\177-\312\200\254mx5S\2432\\\313\245\376z\224\201\326\224a"
+	.ascii	"\032\205/\241*ex\226#\3755)\003"
+	.string	"\246\370\373\320\354\313\224\303'T(Q\265\2772e\360\"\376>$\223\"\005\023\033\206\345D\177\035\313@\204\023\264\252\327\222\341W.\364W*\006mR\353\203)\207G\3526h9L\202$\346\257U\f\250\361\367\341P+w\032nE\263\332j\332T9$\2025,\022\235\376\365\r\203\257+\253\337\024!C\206S\271\316\267\025aP$\376>\f2\224\372\tR\223\376x\002r\244\344\264\306\324c\310#_\372\266$\f^,\261Tt\f\223\206H\271\315\2671ap\223\243\b\307\360\206\t\337\326\024W\343\357C\242\335\224e\243Q?\324r8$\024\363mO_\361\367\341\214\037\0311\306\210\300x\321k\353\251\333\033\313\241\317\220E\016\364m\324\330)\376>\\1T\341s\033\232\250]\245\345\020\305\360D5\006\212\277\017wD\214\320\211\3716kl\"\376>\314y\033\326\f?\324\256u9\0041\274\211\371\2665"
+	.string	"\304\305\337\2076\354\225,qB\270\\\352\333\256"
+	.string	"8\213\277\013\261HY,mV\3348|\333[W\374]x\315\242&\244\"\\\213\252}\033\034"
+	.string	"~\304\337\205S.0#\277\024Nhv\206&%Gz\267 "
+	.string	"\314\250\226=\300\306=\241\n\241px\267\""
+	.string	"\224 \243"
+	.ascii	"&\026\026\363nIY\234\260s\272\036^K\204_&\274\033\323\005c\322"
+	.ascii	"\232\236\244\024\036I\"D\222\373\274[\323\005T\361w!\227p\253"
+	.ascii	"EZ\244n\311\226B#B\254h\334\273Q/h\"\"\375P6\244\212\252z\001"
+	.ascii	"\216\251\033!\020\245\020JJ\030\025\363n\326\013\236@\364\250"
+	.ascii	"\333\251\245\260\311Gt\372no\027\224\340\021\342H)LR\332\221"
+	.ascii	"\353\274\033\234\034R\216\334I\250#\212S\363-\273\232\217q\244"
+	.ascii	"Du\033\264\024\336\020\026E\247o\245\310\002*\361w\241\r\341"
+	.ascii	"P\356$\254\221\337\324|\313.G\370\243\024\002\tg"
+	.string	"\b\203r\235\267rd\001\224\370\273P\2060F\\\215\2102\237\372\253,\205\302\026\034\036\356\310\202\255\370\273P\247*T!\344\211\306=\\\222\005S\361w!\n\341\211\rF\200\215(!$\221#=\034\223\0057tvWJ!\210\372\241\226B\034a\210\334\350\341\232,p\021\177\027\336\224\220\253]\245\245\260&8\027\363pT\013D\304\355\200\275a\271Ru\263b\242\312\225-\032\367p\326\n\244P9a\235\022L\213\232=\334Z\005]\361\367 Z\031\212\262\252Y\256\363p\327\n\254\342\357\301(A1\031\230b\354\tY\016\364po\025\370\230\006\305~`<\355\2232\310\244v\255\313\240\223&9\321\303\301UPc\211\n\251\022iW.\365qG\025$Y\241\305\025\334\312\215>.\251\002\233,#\362\233U\351\261\252]\245e\220\310\025\223Z\374=X\025\244B\301B\252\376*\313\240\220`\220\\\350\343\232("
+	.ascii	"\213\277\007\243||4\224A\247\372\241\226A \301\037Q\265\217{"
+	.ascii	"\242`*\376\036l*\223\277:#\341\026A\245:\270\264\f\006\343\326"
+	.ascii	"(HB\021\334\341Bz\244#\230#\252\344\343\336( \212\277\007\215"
+	.ascii	"^\224\005m\004\213\202DQ#\037\007GA\214\0320\202h\004g\004Q\220"
+	.ascii	"\"\376\036\004\n\312\300\360\343\242\006\022Y\006a\004_\344R"
+	.ascii	"/74A\\\374=\330\"\306TEOpE\256\363rE\023\250\361\310\3309\021"
+	.ascii	"4\221\003\275\334\321\004c\361\367`\2112\240\236`NP'(\"II\374"
+	.ascii	"=\210S\026\024\264\t\336\004?0\021\211\277\007kfd\211\203kz\302"
+	.ascii	"B\243\315\212\333\223\322UH\215\312Z4\356\345\306&\2601e\350"
+	.ascii	"\f\r(%:}9\352\004.\252_\003J\024 5\337y\271\352\004&\342\357"
+	.ascii	"\300'6\302\246b\326\t@\304\337\201`D_L\226\344F/\267v\215\277"
+	.ascii	"\003\275\200]2p\n\021\353\343\".$\300#Q#/\367&\201\224\370;p"
+	.ascii	"\013\250e\301\215\277\252\201D\226@,`\021\016?\027$\2014\376"
+	.ascii	"\356\001\320J\002U#\220\360\226\200#*\310\024PH\276\364sC\022"
+	.ascii	"@I\275gD#' ?b~\256H\202\243\246\243%\036LG\022"
+	.string	"\274P\312\221\243\326Q-\201H@\035\271\321\317%I0\"\376\016<\002\032\311=\311\226\216!\033E@\242\230\237c\212\340J\215\n\220\2001\350\226G\t\004\252?j\t\234\021\324d\026\177\007\312\260\340\223Z\324\017\265\004\276"
+	.ascii	"\272\310\211~\216\032\2014\376\016\364\001\262\220\037\210\334"
+	.ascii	"\016\340\t%0\205\n On\363s\325\b\242\342\357@\024A%\351\210\022"
+	.ascii	"$\256J:\277\264\245\004\202\250]\245%\020\007\030\"\032\367s"
+	.ascii	"o\021\330\210\277\003o\200\037\260\3240m)\177qs?\271\350\364"
+	.ascii	"\347\340\"p\021\177\377\301\375\262<\023\2172\2677+\271PKU\024"
+	.ascii	"\001N\233/G~i\217-\345o\255\n\225#55\037R\254h\271NK5\006\001"
+	.ascii	"\331Yu\004\022\276\204&(Q\250\324$O\310F \341Kp\002\023\373\205"
+	.ascii	"\345R-U\025\202('?\274\226\374\276bZ*+\0049\244@\216$\371!\311"
+	.ascii	"\201Z\2525\bdp==\005\254\254\237\221\334\246\245\272B\220SdG"
+	.ascii	"e\365\253\312\215Z\252\267\007\254\304\337\177C~S=\252\275\202"
+	.ascii	"\222\372E\345H-\025\334\003bOR\357\031\255\373Q\376|8\375\232"
+	.ascii	"r\242\266*\350\201\254\036A\244;\226\224\242F\332\253\243\250"
+	.ascii	"\326\213\363\300T\322_\t)3\312q\224\353\264WI\0170\341\230z\317"
+	.ascii	"\224\277\032\365WY\376\210~6\242f\355\025\323\0032\206\206H\201"
+	.ascii	"f\374\202r\241\366j\354\001\022\361\367\237\214\337\242*sQ\273"
+	.ascii	"\326\345\017\306\357E\356\323^U\035P\213\277\377ZT\201\251\250"
+	.ascii	"]\245\345\257\347\267\"\017\321^Y\035\320\212\277\377x\254~$"
+	.ascii	"\224\277\235\372\241\226\277\023?\023Q\256\366j-\212\344\305"
+	.ascii	"q (\376\376+\341\276]\375n~!\352\037\316\362'\342\227\223\353"
+	.ascii	"\264YC\016\360\210\370\201\320\315U!\002'\367\253\231K\312\022"
+	.ascii	"'V\304\327f\345\312\033S\006\252\033;\2065e\255\n\025\016mVS"
+	.ascii	"\006\256\370\273O\r\307\210\331\031\232\224\2306k,\252\372YO"
+	.ascii	"\341\t\025\n\265\210L\213\t\230\230/,\246\315\252f\360\211\277"
+	.ascii	"\373\234\370\232\030\301\266|H|]\265.m\351\363\362I\243fm\226"
+	.ascii	"5\203M\374\335\247\304\227\004\213\353)dm\371\264r\2436k\r\003"
+	.ascii	"\225\370\273\317\310\037\261\"\342\273\312\245\332\254+\206\260"
+	.ascii	"*$\276(_\020\337\224OHn\323fa\260\212\277\373\244D$\361\371p"
+	.ascii	"\002\342\373\301\241\325\032\302\260#\376\356k\332\340\225(\325"
+	.ascii	"\035m\351cZ*\302 #\376\356\333\341K:v=\005\243\034\276\243|\251"
+	.ascii	"\325:\302\200\023\177\367\341\270\222\322\250A\344\263\221\013"
+	.ascii	"\265ZI-l\361w\337\220O(\t\004/\037\214\030@>\0319P\253\305\324"
+	.ascii	"B\375\031\300\327S`\321\302\347\223\357\264ZM-L\342\357\276\236"
+	.ascii	"%&P\360\244x\272:\341\332\030\200\211/G\207\204oDN\324j\215\265"
+	.ascii	"\360\020\261\233\"\240\211\357C\255c[\372@\370n\242j\255\026"
+	.ascii	"\265\005F\374\335g\343\253\221"
+	.string	"\337lxD\001N\254`\201\353e\211\306\265Z\325\226\023W.\360&\357\2463\022\016\002\266V\345\312\026\235\266Z\326\226\017T\330\251\260\336Y\017\255\227\326\263F\315Z\255\265\013\326\370{O\212\333C%\326{\322\243\366\312zQ8\264Z\327\013_\361\367\036\024\263\252\251\223\260iO,\246\325z\273`\025\177\357\201Y\215)\361Z\362\225\033\265Zp=\244]\026\262\310\262\266\216p\r]\260\021\177\357iq=\351Q]\025!rt\301E\374\275g\325\253\202 \t\224\035\234T\335\321\226=!A\222.\344\304\337{Q\022\200\032\201\2047\202/\201\332\353\321k\352\375\3509\345R\355\026\223\005\266\370{\317G\031\222(H;\226\224\236\242$\351~\342\262\"\034G=\243\350\264\335\032\263\260$\376\336\273A\304l\206P\215\336P\256\323nQ-`\321\300\240\332{\361#\243\027#'j\267\252\026\232\342\357=\030\273i"
+	.ascii	"\376\254\247\326\261-{>,\254E\361\367\336\212\013\314H\3319\221"
+	.ascii	"\242\207\"7j\267\336,\264\210\277\367Lh\241\365pD\214\350\351"
+	.ascii	"\3446\355\026\234\005\233\370{/\307\355\331z\353;\327\263\251"
+	.ascii	"us\313\336M\357CT\255\345:\252`\026\177\357\325(I{\003r\356\234"
+	.ascii	".\204\016GWB\267\243[\241\353\321\275\320\301\320\315\320\321"
+	.ascii	"\320\021\351\212t:tH:&\035\017\335\223\016J7\245\033\242#\242"
+	.ascii	"+\242\333\322q\351\224\350\272tLtMtS\335\230.\212\256L\207\246"
+	.ascii	"\263\352\250\350\252\350\254\350\336tq:\271~\323At\235>\242\237"
+	.ascii	"\350(zOg\321_t\030\035\250\007\365\241^\243\337\3508\272\216"
+	.ascii	"\216\324y\364\036\035H\177\352C:U/\322\261:W?\322\277\372\222"
+	.ascii	".\326\247\275\254\233\365)]\255\267u\267\016\327\343v7;\020\273"
+	.ascii	"\021;\022\273\024;\236]\213\235\213\035\320.hgcG\264\323\261"
+	.ascii	"C\332\361\330\365\330A\355\242vT\273\252]\326Nk\327\265\223\356"
+	.ascii	"\300va;\352.\312\316\272K\333\261\355\256;,\273,<\033\336\007"
+	.ascii	"\236\016o\004\017\005/\005\257\005\317\005/\2107\203G\304+\342"
+	.ascii	"\351\340!\361x\360z\360\240xQ<*^\025\317\b/\213\247\204\327\305"
+	.ascii	"k\302s\302{\302\203\302\253\362\316xj\2745\236\033\317\n\017"
+	.ascii	"\216\027\367\336\274 ^\235w\304\213\342M\361\372\274-\336\030"
+	.ascii	"\257\214w\350\255\361\342x\215\336\244w\307\333\343\365"
+	.string	"\361>\275P\357\324;\344%\362\026y\267^\256\267\353\225\276M^'\357\330K\366\226\275f\357\224W\355u{\255\274q\257\\\017D/D\217D\257D\217\247\247\242\327\242\347\242\007\324\013\352\331\350\021\365r\364t\364\230z<z@zO\275\251\336\220\036V\317H\017I/I\217I\257Io\254G\3263\353U{Szj\275\266\236[/\256'\347\013\341\303\361\225\360\355\370T\370V\370\\\370^\370\202|3|E\276\033>\035>$\037\017_\017\337\223\017\3127\304G\345+\342\303\362q\371\216\370\276|K|S\337\230/\212\257\314g\365\245\371\330|W\037\026_\226\237\315\357\303O\3477\342\207\342\227\342\307\342\347\363\373\371\305\370\321\370\t\375\212~7~:~H?\246\037\217\337\217\037\220_\220\237\220\337\325\217\310O\353\267\365S\362\353\3721\3715\371M\177c\277\262\237\331/\3557\345\307\366\273\376\256\374\260"
+	.string	"k\2006\300\034\240\b\340\016\320\004p\005\260\007\b\003\370\003\244\001\024\002\336"
+	.string	"\342"
+	.string	"&\001w"
+	.string	"{"
+	.string	"}"
+	.ascii	"\237\200P\300!@*\240\021`\0260\tP\t\260\t\320\tp\fH\006,\003"
+	.ascii	"\232\001\255\3004`\025 \033\360\rx\005(\007\234\013\202\b\206"
+	.ascii	"\b\216\b\222\b\242\b\246\b\262\b\372\004\177\2021\202B\301\241"
+	.ascii	"\340\215 \216 R0)\330#\350#\370\024\204\nN\005\207\004\213\004"
+	.ascii	"\261\202G\202H\202^\301\257 X0,\b%H\r\236\005\245\004\325\202"
+	.ascii	"k\301\266\240[0K\020Nh#\374 \314\021\212\020\356\bM\bW\b{\204"
+	.ascii	"/\2040\2044\204BB\034B#\341\222\220I\350$\374!\f\"\024\"\264"
+	.ascii	"\022^\t\263\204ZB%\302.!\023a\023\341T8&\214\",\023Z\205i\302"
+	.ascii	"*B6\341\233\360\212PN87\f1\304\031\222\030\226\030\246\030\362"
+	.ascii	"\f[\f]\f\201\206A\303\032C\033C\243\341\321p\307Pi\350c\3304"
+	.ascii	"\204\032F\r\251\206UC#\303\254\241\222a\327\220\311"
+	.ascii	"\260\311p:\034\033F\031\226\r\321\206\326a\225!\333\360\312\020"
+	.ascii	"\013\\\003\333\3008p\016\\\002\336\201y`\025\260\013\370\005"
+	.ascii	"\f\004\007\3015`\033\260\021|\004\357\200\225`\037p\023\034\005"
+	.ascii	"K\301Tp\025\214\005\033\201\217\300H`/\370\013\016\203\305`("
+	.ascii	"0\025>\203\245\300j\360\032\354\006[\201\263\300p\304\032\242"
+	.ascii	"\r1\004\021\2078\202H\202x\202\210\202\270\202\330CtA|A\224A"
+	.ascii	"\004\"\n\021\207\210E\304\033\304\034D\035D%\342\022\321\211"
+	.ascii	"\370\203\030\204(\204hE\274\"f\021\265\210I\210J\210K\210L\210"
+	.ascii	"b\304)\221J\214B\264\022\323\210U\210l\3047\342\225bM\321\246"
+	.ascii	"\210S\314)\226(\356\024y\212*\212-\212.\2122\212@\305\241b\215"
+	.ascii	"\"\216\242Q1\251\270\243\330Tt*F\025\245"
+	.string	"\212T\305\252\242\221bV\021I1I\361\253\270\2448-\216\025\243\024\313\212hEk\221J\261J\361\255x\245(W\2343\2020\2060\2160\2220\2420\2460\372\030[\030e\030\201\214C\306\032F\034F#c\222q\207\261\207\321\207\361\311\be\2342\0161\0221\0261n\031\271\214]F\251\021\314\030f|b\204b\254\032\317\214j\3065\243\233\321\212\021\316\030w\374p\2749\2128\352\034O\034Q\034Y\034}\2161\2162\216C\307\032G\243\343\321q\307Q\351\330tt:F\205p\034r\244:\0269b\035\271\216G\216\322\243\327\021\354\030v|r\204r\254\202p\234\362A\264\b\006\336\312\320\322\254\271\320K\341\b\200E\312\331\b$\224\020\305\254\214I\n\265\235\222\215qx\257&\251\230\313\304I\223\261\252\370\373q\311\361\253\250K\322\245\204\303{Q\t\220\204\244gmiY\t\020ddgE\344j\215"
+	.string	"%\252x<A\246\216Br\243\367\272\212"
+	.string	"\027\177?J\001\201z\312\245\336\353M\204\352\217+\036>\216=8\374W\220\bJ\230\226\3447\263\320\344;\352\250\037jyL:\"\345K\3775$\002\220\370\3731\307\257\250n\203\226G\034\307\0331\377U$\002\216\370\373\221\350h\303C\213\262\031B4\242f\377\225$\302\212 \240\226\240\364E\355Z\227\307\237#\214\\\350\277\236D\260q\321\"\026\036U\364\034W\344R\3775\226\026\177?\362\034S\310\255\216\241\214a\211\243\211\343Nt\372_k\003\030\213\277\037I\034Gd\200\217!rp\230\260\342\357G\020s\265\253\264<\332\034k\242f\017\3264"
+	.string	"\246\370\273Q\256x\245~\250\2451\213\021K.\365`O\003\b\212\277\033\337\214\256\215\322\310\326f\274\346K\017F\035\200\210*T.8\202Y\247\244\345:\017v\r\001K\374\335\210f\224\022\214R\273JK\243\231\261,\032\367aC!L\211\277\033\251S\262\261\"11\013L\3526hit\322\344\210+\376n\\b\364\312\235\214_\033\350:\272"
+	.string	"\034R\032\221(I\022\363aMQ\361w\343\221\026\251\021-cV\276\363a\326\020\226\342\357F,\fUWV\271\321\207\255\205 D\225AJH\220\230\017\273\206\300\023\345T\267SK#\020\343\217\034\350\303\336B\270\211\277\033\233\036x\260%\036F\246\350\364\303\340@P\312\201\244#\250\354(\002\242\033E1/6$\215\277\033mH0C\310H\243\b\204\252\370\2731h\2022\030\265k]\032c\374\034\371\210\277\033_\030]\f)\350\315P\032U\324\306\025K#\213\236\230\027K\262\021\177g\207\030y\332\240\n\244;u{ci<a4\221\353\274\030\025\204\026\361wc\t\013\312rtD\304\274X\025\204\034\234\013|fJ\243M\335\222-\2157\306\0171/f\375\300-\376n\254q{"
+	.ascii	"\220\245n\311\226\305\270\"\\N\364bk\037P\343\357E,=mV\334\256"
+	.ascii	"\322\370{\361Zd\023b0\245\270VT\313\201^\354\355\003\253\370"
+	.ascii	"{1\355\0023\362\227eP-J)\236\345F/\006\367A\217\370{\321\314"
+	.ascii	"g\246,>\241B\t\372\340F\374\275H\246A\031\230X1,\372\365\323"
+	.ascii	"\244\017f8)2\221\213MzI\301\241\r\272\274\244L,\224l\325\256"
+	.ascii	"\322\262x\244\310\225\357\374\264\351\003\022\361\367\242\026"
+	.ascii	"\007D\260\212<]\025\255:\0202\2448\225\333\374tlCY\020\017\200"
+	.ascii	"@\025\237\242q?\335\320\344G\231\206\277\342Q\277\324\262\350"
+	.ascii	"\243\330#:\375iu\203V\374\275\310TT\312\235\212K?\324\r\305\034"
+	.ascii	"\365WY\026\221\212:\242\323\237Z7\0049\372\200\350F\261\310\204"
+	.ascii	"\237\256m\250ac\013\204\031\265k]\026\205\2124r\235\237\302m"
+	.ascii	"\360\211\277\027\203B\200\021\243\370\023U{j\220\206\270\027"
+	.ascii	"=E\237\"\213(\332S\20744Y\321$\302\211\024(\2124<\231 \300\220"
+	.ascii	"\016\211\342\b\n<\365H\003\f\021\005\270R\026o\352\207Z\026C"
+	.ascii	"\024AD\241<5\311\203\270\370{\361\003\021K\034\221\312\344\001"
+	.ascii	"5\376N$Np\301\001"
+	.string	"\332\254\270\305<uLI\374\235xU\243B\\\313\211\236J\365@H\374\2358\245\223%\200Xv\206F\224\222\003}\224#\017\224\342\357\304*\321,\203\336\0132(Ob>J\222\0073\306\026p\346\244~\250%1\214\b\026e\373(p\036\330\304\337\211M\202H\277\274\202\256]B\270\210H\210G\242\323/\033\352\300,\376N\334\232*b\004\213\303\227\025u\220$\376N$2\244\275R\022\207\324\355\315\222XE\244\312}\276,\251\203\036\361w\342\024K%\205\252]\353\222(\025\0255{3k\007AO@\336\252\262\036u{cIl\"\372\210y\263\265\016N\304\337\211<\210L;+\244\035I\271\315\233]9x\203\272\302qD4\342\360fo\034@!R\203\210h\303\2047\203\343\200H\221 \0323\202\224\260`\304\370)\3721\302\242\205\017\023\0078)\262R\250\340yR#\241U\302\004q'\267y\353\230"
+	.string	"\226l\021s\210:D\021U\001L\315q\021?\324:\247%\021\004\361&_z\353\232"
+	.string	"p\\9\0227'\227#\275\365*\200\024H\336j\235\323\022\306\002_\211\232\275\025n\203,I\330\332\340k\016\364iC\033X\253P\341)\261N\201\323\242P>\255h\203-4\266\253\254\n\233\3456\237\226\264\201\217\370;\034\205\225\216=\201\311\362\245Ok\332"
+	.string	"h\352\366(\341&`\260\223\250\332\247U7\b\354\013\224)\0275l\030\0365h8\001f\270\341\350R[\240\357\227\027\230\305\2214\376b\323\035\236E\250\221\245o\031\371\211\003)X@\"\347 {\002\214\374\002\375\r\233\265\215#\2213\314*\347\246O\250\234\233\300\241rn\016\225s3\310\272\324\314\031)+\347&\034\254\2417Ldi{\236I\3323\f}B}\313.3.d\357\372\351\034\262L\272\203\374\202\004\262H[N\326M\236\217]\"i\030\037\033d\357\n?\034\210\264o\271\276o\033\003\033d[X\n\036\220\200}@\351\254\221\366\005\366\246i[I'e\017uS\356"
+	.ascii	"}\201Y\0172\263\354an\022\331d-\343\265SF\310\342\367\374\"o"
+	.ascii	"`z\260o:\371l\332\365\034\201\263F\322\267\214\007\033\350\301"
+	.ascii	">\262\313{n\312\267L'k\333\246;<e\350\335\314\3002\241\315\371"
+	.ascii	"\206\331;YC\355#\213\201\305g\027\345\334\304\231\365}\333O\233"
+	.ascii	"F\211D\316\027\330\033\252\224)\b\331\333~\342\310:I\333P\231"
+	.ascii	"\356P\343\32099?\300\336ts"
+	.ascii	"\266_*"
+	.string	"\260\316\271\371\362\"\003#/\221O\246\213\005\366n\312\264-\203Cg\244\207\247\313\02293]Z\202\036\346f\220M:\347f\363\td\2333P9I#\2354\267SF\246o\031\"k\0346g\216\354M3\237P \253t\3266\235\264\237\264}\201\245e\230s\007\333~\"e\033\006\037\016Y\232\231Y\2440\363d\312\016\260\264-\2234^x\231of=\277\264\020\331\242=?]`\346\354\322\254\225@\226\006\257\2213t\016z\230\233\025\230L\231\027\013\316\272y\3277m\323\370M\003#dm\032\247\233B$\215\323\311\226\016\267L\3372\260M3g\031\237]\220F\032\233\306\361\331E\246\221\366\363\245\345\302\221M>k\233\206\312/P\246\214\317.5\314*\235\265\323\236g0\260\314\031Y\343\265\215\224\355\347\213l\313$3\374\352d\020\236g\2329#o \333\001\237]\352{f\2469\332\264\207\272\371\273"
+	.ascii	"\255\231/3O&\314\234m\\\206v\312\311\017~l\362\003\n\354\314"
+	.ascii	"\223\031da\2245L\362\003a\222N~@d\351\233)\003\225m\032w\322"
+	.ascii	"\310\346\ftHd\237\035l\372\226\223t\323\236\2352rm\343E\026\267"
+	.ascii	"g\374\226\225\316Zf\322N\347\f\203lI\326M\331\206\301_\033\346"
+	.ascii	"\207\264\345\233\306g{\211\254eb\214A!\022\350\373\315\3144\275"
+	.ascii	"\037\360\226gf\032\037K\343\263\275\234i\333E\236\241\370p\206"
+	.ascii	"\342\275\243\005&\363i\303D\326\246q\344l\3170H\031\177>]h\233"
+	.ascii	"\306\347$TF\256\300B\353\245\334D&e\231f\375c2\347\346\rl\332"
+	.ascii	"\363]'\213l\323\236e\374\266\353\027\331\371\224\2313\262\002"
+	.ascii	"k\323\311\272\303\323\206\3127T\031\244\301\353{v1\302lRfv\221"
+	.ascii	"o\250R\310>if\315\234\2252}\313T\360\360d\272\fY\032\351|\312"
+	.ascii	"t\363\t#\343\364-\337P\345\205\017n\250\222\330c\223\316\331"
+	.ascii	"%9\323Iyf\246\t\262I\372\266\351\016\264=3\323P`\233O'\235\224"
+	.ascii	"\357\233F>m\250\234\254\241E'\335\201\266\241\031&\240\361\271"
+	.ascii	"C\215#g:)\277\274<\351\345\214\3134\363\314\354\224\2617`\351"
+	.ascii	"\346\354\f:\353\023`\2344\311\n\354\023\352\201\226\2354\311"
+	.ascii	"\243\006\r0{\002\214\214\334\360\002eR`O\200I\016a\220\370\323"
+	.ascii	"i\274\2354\264\371D\312\312\371\226\361\331\245C\005\026\237"
+	.ascii	"\345d\r=Z\240\301\353\016\263\255\224k\3349\027\221\310\331\227"
+	.ascii	"T\022\331$\363\ts\323\365\023\212\323w\013K7k\374\307\322\314"
+	.ascii	"L:\td)\260G\230\245\261\351\016O$m\3130\367l#\2073\376\034\262"
+	.ascii	"@\242\221\205\312$\235\365L\260\006\262\301\246\314\235\254\241"
+	.ascii	"D\366\004\030\371\276g\350\314\223)\317\3144CvX\241\205\275\233"
+	.ascii	"rr\246a\346\345\363\311\304\300\336\265\207\371\202M;\353\331"
+	.ascii	"\306\345\247\215\234\213\320\372}_^h\235\344\275\360\240\365"
+	.ascii	"\216\335\275\354(\2600\270\322I\333\370m\301\bdq$\375\362r\304"
+	.ascii	"m\032\352\201\226qf\215\313\316\347\t\265\375\204i!\026\355\247"
+	.ascii	"m\323\027\330\227\227'.\203\274]f#+\323\267\214\221\235\231i"
+	.ascii	"\344$\215\317\266\222\306\2355\005g\rdgf\232\244\357\327!9\343"
+	.ascii	"2P\\\346)\333O\374\3314\262\270S\346\211\244\231\365\313\323"
+	.ascii	"\206\312O\\f\306\351\233\266\345\231'\2239g`q'\215\264i\250M"
+	.ascii	"+\225\265\215K\240t\316F\346\323\306\235O\244\f\203t\312\314"
+	.ascii	"\314#k\317\264\263f\312\370-c\303\340B&\216?m\030\\\306\235t"
+	.ascii	"\013\353\234m\334\002\253t\326\312\331\246;\314\025`\360\347"
+	.ascii	"\263y\333O\0349\277\3106\215\343u\0060\260\370\375|\272\024Y"
+	.ascii	"\274n\326L\331\303\334\314@#g[f\322\035h&|'k(\205{n>P'\213F\017"
+	.ascii	"s3I\301\236g\354\347K\222\246_\034H:\353Y)\327P\271\205\275\320"
+	.ascii	"\264i<Y\001k\201\265\351\232\t\255q\246LS\266i\234Y\277\310I"
+	.ascii	"\272~\251\231\320f}S\300&i\274\311\304\203\254\007\232\t\225"
+	.ascii	"I\2760g\030\271\311\304\207,\356\254\345\246=3g\031\307\2370"
+	.ascii	"C\266\311\304eg-'k\350\217\311\244\221\264}\314\300\244e^<\320"
+	.ascii	"\234 #\2213\224\311|\332\027X\245\263N\3164LR\006\257q\346\374"
+	.ascii	"\254\355\271C\013\253t>\2312>3\2234\r\275\345\244S\346i+%`i\244"
+	.ascii	"s\306\357:\211;i\333\226A\322\312\031g>;\310\310\233nB\355\f"
+	.ascii	"\310\233\256\300\246\241M\032\217\200M\316H9I3]\346\273N\312"
+	.ascii	"46N7i&\215;\300\336\310\032\277k|\306oyy\3178\314\322\311gSV"
+	.ascii	"\312\270\320\311\037\013\203\304\353\231[\276\237\320\001\310"
+	.ascii	"4>\333D\226F\316\266Rn\332\263\354|\312\366\f\224\310*\235u\323"
+	.ascii	"\236\345%\262\306o\231f\272\314N\372\3106i\374\246\271\345'\235"
+	.ascii	"\254;\310Id\007\"\363\211\304o\231\f$gy\346ig`\231sm\323\267"
+	.ascii	"\005\366\266q|\256\300.\2355\323E\246o\031\031z7e\334~Bif&\364"
+	.ascii	"\256\223\0238k9I3\205\254\262~q>\221A\326\303\323E~\326\316\032"
+	.ascii	"\352co\031\027\271\206\3362\314=3_\204\354\235\201e\316\035l"
+	.ascii	"\032w\3262\016m\3228>\313\035\350\244\214\327\316\272\002\326"
+	.ascii	"\371\254o\233\356 3\237\310'\376\264\241\030X\332\226\301g\372"
+	.ascii	"E\246\221u\007:\211\2645h\320\240A\203\006\r\032h(\r~\313\270"
+	.ascii	"\f\331[\306\245\206\3362\r\020\262\367M\333\311\344,#7\324F\326"
+	.ascii	"~\336N\372\2267\310O\233Fyd\231\314\247-;\2255s\2267\310O\233"
+	.ascii	"FYda\220x\r\225\235\312\2329\313\033\344\247M\2434\26233\215"
+	.ascii	"\354T\326\314Y\336 ?m\032%\221\365`\313\036f&m\3136\315\224I"
+	.ascii	"\3220\310\333\310&\357\247\354af\322\266l\323L\231$\r\203\274"
+	.ascii	"\217,\235|6e\233f\312$i\030\344=do\032\227q\326M\031\247\357"
+	.ascii	"\227\227\247L;\237'\320\315\032\277\300\3362\335\254q9I7\355"
+	.ascii	"Yv\326M\371\306g\374\266\300\3368\214\262f\276\310\314\031\177"
+	.ascii	"\342\362\215\317\370}do\231n\326\270\314\234\361'.\337\370\214"
+	.ascii	"\337F\266)\343w\235\224\2313\376\304\345\033\237\361\333\310"
+	.ascii	"\322\315\331\331Y\032i\313<o\031g\316\262\363Y\343\365\375\204"
+	.ascii	"\036\331\033\237o\331Y7\345\033\252\224q\346,;\2375^\337O(\006"
+	.ascii	"\366\306\347[^\"g\027&s~\221\237\366\354\"\343\314Yv>k\274\276"
+	.ascii	"\237P\tX\2729;e\r\262M\3372\262\207\247\013\314\322\315\331)"
+	.ascii	"o\220m\372\226\221=<]`\226n\316N\371\003\331\246o\031\331\303"
+	.ascii	"\323\005f\221\034\334Jg\215\343\364\335A\315Dv\340\254\347f\007"
+	.ascii	"H\373\356\200\003\f\354\023J\333\035\340\317\247\335\301\217"
+	.ascii	"\245\233\263S\006A\266\351[F\366\360t\201\331\257z\253\317z\255"
+	.ascii	"W\362]\337\344\235<\365\243|\332O\371\266w\373\270\227kq\332"
+	.ascii	"\234\226D[\242E\321\246h]\264/Z\241v\250=js\264L-\217\366G\013"
+	.ascii	"\244\255j\255\332\254V\253U\322v\265NZ\260\226\332Fi\321ZkK\245"
+	.ascii	"\255\322^i\261\264sn\215\213\343\346\270%\334\035W\205\273\302"
+	.ascii	"}\341\302p\203\334\031\256\r\227\310=rs\270<\334\036.\224\033"
+	.ascii	"\345\016q\251\334\".\226{\304E\342.q\231\270Sw"
+	.string	"\314-s\315\\5w\315\265\342\276\271\001\215}\250\324\244\236O\002\301\320\324\314\024\211\b "
+	.string	"\020\220"
+	.string	"\243\0304$\212\212\3634Q\323;\024"
+	.string	"\033t\204>\"<hV\231U5C0D\330"
+	.ascii	"\204Y\223"
+	.string	"\204>\363\325\344y\006(\310\270\376?C\254\271\001\343{\035\021.t%e\3449\301\227b\212\221];Y\336&\330A\234O|\237\226M8s\250\\Uf\363\257\320R|}\355\265t\217\2758qm\363\204\214j=Zv[\2522:\265N\365d\265\3143Ssv\350\373\333\370o0ni^(@\365\310;\334\313\034l\b\344\036\n\242\366\263\013\221\027\370\005\021\355\n\022\244^\370F*\177\216\201\314\b\002\036$\261\324\263{\200\347]\212b\225\324\257\206\300\262B\234\367A\245O\202\232\200\206\210\347`\235\220\311\034b\177\365V\353*Y\204_\245\252E\373\305$F(\365\023\302\031\355'!Pk9oN\202d\336:H\325\352\002\215\264\316B\206\203,\310B#\200\021\333vi\316\230\276D\260\033`\316\004\251=}\312\367\315\204^\232\006\251Z\376,\375%\310\234\302k \205\236\262\332\022\347\370\326\203\276"
+	.ascii	"t\271m2\231\211\034\300\005\330\254\020*\371\317O\304a\252Cq"
+	.ascii	"@\262\221\242KY\333]\345\275\023\316\340n\302g?\252\330\\sM8"
+	.ascii	"ReP\351\3517\234G"
+	.string	"&\357\310\360\377c:\211\265K\254\222\036\035S\370j\340\331W\362:q\211\376o:}\320\003\023\006\253\017\201\030\333\365k\355\030\356f6HZq2\364\244a\201\3108S\270\277\320\037\360{\334N\374\366\0028X\017\276kW\005Z\031g\242?\304R%\212fkC\211\374\372\225\2448w\375&\332$D\342\035l\346\177H\3250!4>\325\354$\035\006\315_\325\230\372\221\334\253\260\246\357\r_\n\355\273\333VXJ\006\260\"5.\364\233\027\026\254\nZZ9$z%\226\367\202!\246r\240\033\323\254\274s\336\312VP\t\031,i/\355A\310\203{\305\274n\374\207\020v`09\332d\377\367\377\274x@\035O\220\300\364\220\002\273x\025\253\206\200\246\334&aCS\212LdO.\0043i\374\035\276'\303\2505\255\245 \0276O\0245\242x\202B\247SX\210:\016\"\253\021\201*\357\364\326\b#"
+	.string	"\330\006y P\027\230\325h\346(~S\233\372\316\301\234\222\223\202P\223\233a\266\t\020\373\222@_E\210\351\357B\306aU\330\202\373\310\334-)$\2065\033\013\310}a\207"
+	.string	"e\215`\261}\334\247Ae\350\263"
+	.ascii	"\342\251\262_8\274|[\377\211\n\300\2264\315\251)e%\377\376\227"
+	.ascii	"2\300l\202\034\303\304\255Z#\210FX\020R\244m\\\222H\314\363\313"
+	.ascii	"\361\244\223ia"
+	.string	"\3609\367^\2428|F\2007\351\270R\217Z\377\321\363!\304<\004zy\271K\007ze\353\246\373~\251D+\343\204<\224c\245\n\272\267\177,c\216\245fQ\262\032g\374\200\277\277\nN\252\237-\3327K\364\016\265\3418\374\327\377.\037\224\\\311\265\222\247\343^\210\363\231\3065\026|\233_\214\301\270T\210\366T\203\313\361\264\327G\227\212\346\263\221\310Z\337\263\030\236\366\320\002\3533\227j\203uw\332c\313\276+ P\322U\270\360\307\2717h\235H\b\"0\340X\375\301A\254\020Ya\206\250\216+\200\034\373\211\231D4\202\346\324r\005\032\361\325,~8\232%\235\253\r^\342\035z\2006R\347\003\301\220\253j\326\017tl\246\262M\347Q9\364u\252\262s\022\340\r\230\177CV\377\204\365\376s\207\353J\335\202lw\261L^d\337KV\336\2168\032Cd[\345R\200tD$\213ylI>"
+	.string	"d\016\026\216\b\212\270\215=\260|\007\323\227\300\327\371&\025\225Z\257\003\0056\262n1\356O:\351\205\237a\035Q\257vb\342\204"
+	.string	">53W\b55\374\316^g\377\212G}\004\212\240_i\317_\037\006\300\341\\\237F\005$\307U\272\251\335+"
+	.string	"\021\021W\205M\310\272\276\323\373\357X\274~\3662\217\f\243\354\244h\001\331F\240\222g\005Z=\262\225F\271\002\260\262\036B\266\325/\330\033\250\240\333\244{\301\006\330?h\036\304GCj\321Z\362Rm?\001\243\340K\333\212YC\006\002G\030\373\376\360\364\267\273\276\201/\257\3306\317-\343\220?\325\334.\370\210\r\256\320\017\267@(\266\314`\277;r[\275?\337\327\361\331\303\221\361\013x\217\376>\277\013\217\355\253\177\364*\350\251\n\215E`\221hY\177\035\237\336\354\305\327\377\371}??\325Ke\243\362\035\256\350\375\317\325\023'+\243\b\322\032\340\032\375\242\2418>\340\333\327\236&\241\002ru\256\225h\276\274:\234\374N\301f\361z\217Q\tQ^\362\016\376"
+	.string	"\220\264k\264"
+	.ascii	"\030\3236\374\036\227\204W\252\342\353\246\371\034\020'\222\365"
+	.ascii	"]2\356VW\007\315\035\266E\345\2362\267\271\360\265\02488\342"
+	.ascii	"\020(\233\r\314\277\313\366\006\303\304%\2677\026\026\224\372"
+	.ascii	"/[\">\235\341\251A\"\365,I\213\nT\310\003\244\036\\\335>\241"
+	.ascii	"\330[\223+\034\262^A>bD\336\037\371\030\222\254b\302rp\320\252"
+	.ascii	"\211bR>\256\262\013Z\022\325\205Xw\262eV\220\245\247A\301_\326"
+	.ascii	"&\323*\021b<\271\3614l\013|\f\035\206$\343\365\340\206\227z\b"
+	.ascii	"\265\235NoLwQ"
+	.string	"\016\253\234\372/Sa\363v\2401D\307Fx\2368\022\331\365\3004\213\231jYBqQ\323\037\236\033\020\025Q\364c\013\026|\346\034\013\315\267\2208\263z\272\322\362\024\026CQ\204\233!r\023D\255\231l\266\323\034Q-.\270\364E\305\204\207+\225i\354\253\365\343\322\246\020\311t0$t\235\262\237\326\231\360\214q&\325\347sr\253HBi\365>)\t\332w`\faC}\323\007l\356\013\231\032\224\262g\321\032 \344\232J\254S2\202\277\345\345\024\236$\255\245H\311\265M\200\271A\202|\250\202\313\271\203\314\031\366$ \377\003\227\341\245n\373|\227\370\032\323-\311\321\307\320\266\\e8\022\345o\023\364_=\201\306>\211-\275\270+\27761\237\261k#k\206\265xCZ\215\177\316\344I\276\312\033:\341R\262\316Y\345W\267\025KY\366\370\330\240\357\276\366\037\207\365\352\266#\271'\221\2730;"
+	.string	"]\b\n+\350;a\241\222\033O\352\304\024\356\313\020\220\3279\320Xh=p\340^\331X\312\026y\302\3412\226v\342\226\3052\271\025d\356\321\231N`\356\306\375\244\fK\213\363\304\373NG\343b/\371\331M\315d\025\326\250\222\"X\2114\367cm\316\343\016H\311\313Nh\242\332.3\262x\224\306<\342\344\326d\322\021F\237\026\256\313JM\354\231\221\345\241\313Z\372\026\354\367,N\237\310\311\334\243\005\177\332q21\371xT\bh\0039vM\200$\317JKR-\300\352\215\202\177\001\346\323c\224S\251"
+	.string	""
+	.ascii	"|\251\254\321\020\261\366\252\312bd\250|/\374\227$\307r\301F"
+	.ascii	"\312f\036\213\200\317\267\344\231!-BOp\033\b\b\254\366\017\250"
+	.ascii	"\024\363v\n\3233\247\350\371)\321\324N\036t\226\356\t\027\004"
+	.ascii	"\316\"Y\341\370x'\322\335\375{\326\357=t\004\335\035\2235\276"
+	.ascii	"P\033\251\307)\242qR\2733\256^O\333=\372\n6G\245\257\261[Y\344"
+	.ascii	"\272\364\325\252\226=\242\372<"
+	.string	"\357AL\250\264w~\0333U\210\214\022\211\200\013\035\260\320\347M\351b\0212\337\244\320\3459T\202\263\245\337\352\355\232\347\267\202C\n\273L\263Y8Pqy\337Ir~g\320\251Q\212E"
+	.string	"\316AkO\t"
+	.ascii	"W7K]\357<:\022\300\2163\370\0035\213b\202-\306W\"\250\263\303"
+	.ascii	"\355\362%\311\225\213\313_Q\217D\r1-N\210[\030\t@\310 \240(\t"
+	.ascii	"l\221p\231\303\213C\335'\306R?\277\2438b\301@\225\217\024\247"
+	.ascii	"\256-Q\357l\035;\370\323\374\377\273\334\237\250)\254U[M\312"
+	.ascii	"\2441\233\002\252\222\361q\375\374\206\261$\322w8?\342L2x \323"
+	.ascii	"\032\223\374\364q\212\237\203\366\225U\325\206\004\234\343\371"
+	.ascii	"\254|\367\275c\234bt\031\003\366\374\203\216?j\351\022\356q]"
+	.ascii	";\2564\351\224L\234\310\220\326\242&Q\272\327\315'\263\317GF"
+	.ascii	"\373%x)\274\370\253\032w\365ZF\355\3536\\E\3158\242\226\302"
+	.string	"\036\0312;\213\230\\\246\231<\352\303\022#\361\302\300\245\361\003\2255\340<#}'\340\364\n\303C\\'\210z\307\210$\004\021[,l\320\320\235\343\277!^G\274\023\271\260\3200\211((t\363\033b\0311\335\316\001\262e+C\001F`\227\303:\327xH\262G~\333\342\002\327\210&\350\217\352e\233'he\247\345\335\300\243\023\025\247;\237\204ZO\312\261\231\205\016\332\262\351\213\236kb\352\331\232\230\256l\312\033L\363aQH\037\252)\300\245H(\331\021e\240\307N\321\204\214\261\214'\356\354\314by\032\204\244\356Y;;\016j\013i\023\277\325q>\322Ny\263;yV\254\211|.$-\373y\335\021u\344\036?\257&\332\351\233\2448Gjp\250\304\222\016\314R=\370\243\247\022UGYg;#zI\2516\271\027\207\033\016\231\013\244\347\322\376LL\374oI!\003}\260\206a./K\337"
+	.string	"\034\370\261S\320JbN%;\245\225\254.I\375\t`\246\261\316a\035\257\350\316\033\027\206\271Y4\234\366\003\241\b*PC$g\251w\\\2300\323\206\233\314UG\211-i\262\341\023\316[\213\210uZ\322\237\331\261|L\301\377\323\303\234\313\202\b>S\237\232a"
+	.ascii	"\004J \212?S\020\370\244\020\031Zn\034LS\350*F\201\263\026\272"
+	.ascii	"\225\bcs\023K\3279SU\305|\033\243\b\317:[4\332Gl\261\370\315"
+	.ascii	"ld7\353\354m\202\0210\251L\305\327\262\226?;\351\313:w@/?\f\202"
+	.ascii	"\364+\310D6\241K#\310'U\344sN\313\251\376\222\001\245\376\260"
+	.ascii	"\257\373\024f\343K\235\271\226\314\020\217\242\374)7X_\3606Z"
+	.ascii	"d\222\006\300b\037\270\271\3652\216>\007\207\307if\273\036\331"
+	.ascii	"H\023\273\365\360a\354\277_\304\375f\253g\217\250\3479\220\300"
+	.ascii	"\023L\226\264\230\327\233P\017\303X\361M\377\0132kC\rI\317w?"
+	.ascii	"\221-\273\025\030>)\365|\361)F\003\202N\037\274\370\221Y \024"
+	.ascii	"B5\307L\3022j\f.\314\034\241\321-\r\037\363\216v\265\305\200"
+	.ascii	"N\256\212\325\272\231\305H\\\316a\224N\034\200n\330A\335F,Y\033"
+	.ascii	"\250qj\351D\257F\366W\227\330e\215\321\373\030*KMD\357\177\206"
+	.ascii	"\221\220\254uYw\375\017\006HB\252\244\235B3Q3-\223Ct\201\365"
+	.ascii	"j\337w\226(\220\022\321:*\367\213\023<\325\246Ta_W\020\227\r"
+	.ascii	"\013\022\200%Bq\212)\002\252\230\371k\305\034X!\210+\363\222"
+	.ascii	"g\351\213\235\013\230>\201\232J\341\203h\002\272\305\343I\212"
+	.ascii	"#\323\236\026\352\003\336\276\253\243>Yr.\bFyv\200\031\244\211"
+	.ascii	")w\2614i\003&\003p\226\256\2330lF!\234\363\210a\271\367\331\n"
+	.ascii	"t\025?\372wUQt\270\343\223\357\323Q[\252J\230Q\343\366\200\003"
+	.ascii	":\363\315\306\305\275\344J\375\344s\007\300\351,s\335@\341\327"
+	.ascii	"\332\rV\237\032\357\260\266\215Rd^\276!\322lT\311yxuU\230\017"
+	.ascii	"~\003\364\300\371\232\020\235\231\347\033\224PkF\214|B\371F\251"
+	.ascii	"\213\206\203>\375\367ff\\\302l\307Kv\372u\335\305\027b\026\001"
+	.ascii	"j\375\216\024\202\035\242\260\026@\266\264\025:\004B\317\213"
+	.ascii	"\207\244\026\302\t(\317mU.>\033\031229\344,\202\222\237\3413"
+	.ascii	"\343\253=\233\252t*\342\022DW^\247~\242K\326o\f\275\331\206\324"
+	.ascii	"\002x\350y\356\345\220\032\206\227\3130e\tuH\332 T\330SovD\360"
+	.ascii	")\221\363\030\002 \205+0\337/\027\323\366\321B\256\330\303-1"
+	.ascii	"\305\374c*\247T\0341b\263~\325?\347KG;\352oDO\226\007:vT\253"
+	.ascii	"zg\247D\311\r\224\037=N\231pg\263N1\205Q\0254\200\221\3559\270"
+	.ascii	"\273(\037\336\217\003e\335\226\271Z\200\007_\367\301_\b[\376"
+	.ascii	"\031_\35643\001\224\027\303\257\216\370s\001\235BN\331\321\035"
+	.ascii	"\262\355^y)\227W\374\217\007|\320\257\265aI\305]\233^I\003\004"
+	.ascii	"\205\300\343\204*\024\306\260+)\031\233\354-9Z\017\235&\334\374"
+	.ascii	"\211$\315\272@\373._F\025\205\351\211\032\262\325\003\354\\\251"
+	.ascii	"\026\271\2129\030\366\322Q\232\302\240\207\331\217\300\n+"
+	.string	"9\005\372\366\353\217\313\305\"\004m\203\220\203\245\251\267V}W6\246x\322\360\251\322i\247\356\271U\202$[\331TF\311\256\270Zq\272\030<^\200\3029w\274J\225\376\307\232\226I\177?\207+lI\361\370\257\210Aw>,\365\376\023%Wq\243\002\264\363/\340\350:\371c\357\335\327e;N\202\363\016\323\013\215y+*\020\f\3115\370\313\024\345\303\212\364\337\233}T2\234\240 \214\356\341\302\034\2367\206?\210I=|\203}|\303\266\306PO\252<\357\3457\215\215\025 \303\210v\331\207C\211\254\025\375\323N\202Q\376\272\267g\353K\327Vw\320\346R\313\332\276\243\3235h^\321#\1775\213\200\336?\362\376\323\2224\027\355\022\262\227\347k\201\340\002\342U\004+\237*\212\n\t\256\256%V2|\203\021\204\266\234\251\212\357E\234U\333\034\202sa\335\016\231\302\030\334\021y:`iv\220\027d"
+	.string	"\240\242Q\020\254yD\374\242x\307\372Fn\023C1mH\034y1\344\207\211%$\374\226\343\220U\213\254(\351\027\256s\236nk\0061\005\370\340\274\326\025.\231"
+	.ascii	"\373l\245\261\313P\345T\353(\344[s8FV]\247\024S\013\214JDN\356"
+	.ascii	"\335\277o\311^\005(\240\375\230(!\210\336q\271\355\335\211BZ"
+	.ascii	"\365\317\316\367\270T*\220\332\241\027,\213<\213\023\342\277"
+	.ascii	">\345t\335\016\024\246\006\032\n.C\236\026W_]N#\243\216,\361"
+	.ascii	",\271\262T+\005\247%\255\206\0227\bY\250\265\007$\f\355\352\375"
+	.ascii	"\036s\200.\317bMU\270\264Y[L\031u\224+\025.\331\026P^\250\205"
+	.ascii	"c\017.\033oE\251T9\021\343\006i_VJ\256\r\343\267\314hHM\250\210"
+	.ascii	"\331!5b\361\246)\004f\254\320a\227#\354\227\213\025\312p\372"
+	.ascii	"\305\245L7xZ\307A~a\331\bZ1\352\362\226\bF\371\223$\3641k\260"
+	.ascii	"F<&\372\303\027\301\356F)\321\237\rm\367NdB\327\177\037\354\203"
+	.ascii	"\313\201\316\260\243F\034z\253$\341\212\205\025\\\006\202\350"
+	.ascii	" \232\022\323\270\2176$\023k\353\314\030\312._2\267d\227s\017"
+	.ascii	"\006q\236\217\267\326\274?\033\b\t\030[\030\274K "
+	.string	"V~;S\364J\330<\260\223\034\245\002N3\232\240\234\243\005c1q\302@\300\022c\271_\023\236\247$\203\f"
+	.string	"L`L\354!/\310\206\200\305^\326\244#\366\246t\237\020p\220\220\345${1XZ\347mo\233/\250\307\334\322\210\236x\210\227\255\255Zc\275\200\365\t@\314L\251\353\312\\.kb\3226\222#\251X3\3765\002j\223m\222\242\303MD\232,\352\341\2576\275[\201\302\r\2700=Z&\020r#'g\210\321\307\337\347\210tW\2070\221bV z\020\3469\372q?\3261\374\004\024R|t\2301X\205)\333fH\r\017\265tc\317\f&\336\026\306\225T\361/\363\327\321\313\232E]$4\266\rFb\002G?\036U\"\361\313\302\016\233P\214{`\226\312S\366\240\372\276:\242\255lA\334\321"
+	.string	"\276(\016I\277 \037A\216\351\210\337\005\334\240Q\252\255\017\022\233I\212\353"
+	.ascii	"\333\266E\326v)<\345\221\374\204,\224r\242"
+	.string	"\262]Z\273q\331\225\232S\312\376\345f\340\351\022\275?\261%F\022\3548\245O$\245\222\021a\205j\036\375\b\321\t\321\031\303\033h\272\244z8\n\360\213\005,\256,\252?\345\353N\030\006\323\275\227,\375E\224\200\232\204\261_A\004PW\340vr7\347\026\004\242\031\263\214\t\244o\t\002\253bH1\003\n\217]`)\324\223'\205\231\272\261B\275\305\006\023\033\332\225\031\206\366\222\n0\244\216\rM<$\307G\330\245\244\216\324\371\200H`\016\tRv'?\345\316)\203\324-E\211\233\023\2151\2249\202#n\345%2P\253X\335Q\237#\230\253\302\035\340\216\334\350\316Q{\002\225\262_\313\006?\035\222'\263\251\364\276\250\001B\311`0\300\216\375\277\2642o\334\214\323\362=\"\203\034\310J\312\236\266u\344\230<WY\334\210\2315.\367\352\007\031\317\013\263\004\0359\026\f\"G\333\201W\272=\320"
+	.string	"\035\324\016@\364})\205I\342>%\227m\354m;\240\3663\225\026o\375\366Ab#&M\210\350a\235\360q\277.\220V'\340\371\361\233\376\320"
+	.string	"2\351\224\323\354\006\370\215\340\\\374w\233\020A\205p\305\026\007\365q\250\320\037\001\037\363\322m\375\334w\344\215$\277\372\031\241\r0\274\253+!\037\033\212"
+	.string	"\017\t*\217\206\343"
+	.string	"\270\375\365\324\256G\327o\200S\200\263Tk\201\256v#\rx\247\253\212\r\323\245\367Z\022\301\031M\\\322\233\035cHR\016m\005\223s\311\021\271\255i\2712\352,\352\237\240\321\237\333\025\221:\222hs\333\356\356\220P\f\234\325\343K\275\266\226\205t\277\r\267*N;[U\3556W!E\266\036\342\301Q\273\303\305\f\271^\362<\216\032d_h\200\332v\264m\267\t.NM\275;\215\2465\313/\330\331|\355j-\365`.\361\223\325Bm9u\312\331\205\205A\367\225\211\035\232t$_\177\325\211H\026\331I\274\202(EA\240\257\374\025\241\263\206\335\350e@\237\210\3135\274.\227\251\221\360\357\201\341LDD\216htE\007\037\031u\313\274\216\254-kr.\273\206\370()\016\202O\217\272\213\016Y\307\\\266\243\226\2208\207\246\267\277\331!\250Q\326-m\357\217\342\332\344\256F\270\317\345\301\316"
+	.string	"B}\317P`B\232\\\033\3405D\360\312\027Q\233\206-"
+	.ascii	"\336 \246m)\205A7\370\022\026\220\212RewAj\226i\222\325X\302"
+	.ascii	"\225H\366\220\311\261\002\345S\300"
+	.string	"\300\367\242\030\331\372\034\037\321$\177\032<f\317%\232#\304\0348\233\346N\346,\3320o\373C\030\3457fJ Ir\247U/\377\021\026S\226O\340`H\255\351\240p\342\252V\320\373v15\211\330\301\241g\242h\003\354o\264\361\370r\257\037n\274\226\206\271_\244\\\274\n\230\245\303v\201\025\377]K\241\376\247D4r\213\351}\022\334j\026\205\256I\246\216hD\245E\376\335\347\037\272\211&\224\225B4+\245\376\262\2677\373=\022\352\224\247i+\240\204\342b\200\327\353\007\323\365V\206C}k\374\246a\201\336\352\021\262\341bRUAw\271\372\267a\242\260\210\022\256\3767\220\333\273\270\323#F\026X\004\\Tm\267\342\232aN\001\230\247\222\310T@,1\026\333h\360v\250\025\031\017\222\255\303\307M-\f\227\263\230\030\360\360\211\225\b\345\356\305\215\251x,.\266\240J\347\356;Oi&\360\243"
+	.string	"~l\213\b\0331\342\215f\022\375?\024\027\r{\310\241\034\006w\n\232i\360\025\277\331\225P\251\302\213\3630X*\354jw\034\236W\373{A\352\313b\276\265~\262\340\267\362\f\bxF5\024\345V\312\022"
+	.string	"}\241\222\316*\355!\2068,"
+	.ascii	"\321\272\005GA&;\374z\200\237\364U|\333\327\337O\362\312\343"
+	.ascii	"\247l\262\304T \031\261\315E\206\027\351\261\247\323nZY\325\001"
+	.ascii	"m\220\256\345\212V\207D\270L\363\007cv\337\322\362\254\217\210"
+	.ascii	"L]\212\022\322\257^\355-\220\274\342~\251\245\221\030\311A \031"
+	.ascii	"\343\340X\2029~u\346\267C$eT\315p\326\317\025\325\201\305=<\240"
+	.ascii	"5\\;\023v\357\005u\211`dJ\272\222\307\344ROZ\301{\340\031.=\345"
+	.ascii	";,\264\277\342\034\323\320\335L\261r\305\334\342\217r]\202\031"
+	.ascii	"\tE\340i\361\254e\240}\037\370y*IF\354\213\355\331\202\206\255"
+	.ascii	"A%\305\271\254\353\365\310Z|\227\367\222\323hVW\304\354\231\342"
+	.ascii	"\335T\255SA\271\320\364e\r\231\216\020\221f\322\005vY\341\353"
+	.ascii	"R\374\342\027\315l\270\253\317\200\326\312\177\334D\025\017\321"
+	.ascii	"\352\340\241L\360D\232\343\263x\366K\235\0241C\215\177S\360\217"
+	.ascii	"30\251C\252\276\033\214tRh\304<\377\202\215\031\\p\357\240\316"
+	.ascii	"\310\3577wp\317Q\207\330\233\016\335[XO\225\255\351\236\006\243"
+	.ascii	"\335xN\177\030\315G\330\270\367\377?\366\370\025Y\252\276\030"
+	.ascii	"\252\210\340{)\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`\b\001\255\b"
+	.string	"\322M10"
+	.ascii	"\233B:\327u]\327u]\327u]\027\021\274\372\377\377\377\377\377"
+	.ascii	"\377\177\351\377\377\377\356\322\377\377\377?\\\327u]\327u]\327"
+	.ascii	"1\312\266[\332\001ww\277d\3134,O\365r\345-\225\271\212-e\255"
+	.ascii	"^\242\234Ul'c\365\322\344\253\222\255H\256\032\231Jd\251b\013"
+	.ascii	"9\252\227 \307|\fUl\036?u\354\324K\216\2336f\322x)\343\034\214"
+	.ascii	"\225.N\262\030\251b\033\212\217\212mb\243b\223\270\250\330\""
+	.ascii	"&\202x\350a!\207\307z\331\360L/\031\226\351\345\3020\n\007%\334"
+	.ascii	"\203\260\230\313\301a\006\003\025\374C\260\317\300<\002\357\004"
+	.ascii	"\254\0030N\261\365\233\3315x\227l\257\377\372%o\260\336\235l"
+	.ascii	"\0263 \300\323B\007\251-I\335\212\025+\226\314#\217<R\267bIj"
+	.ascii	"K\246\266$\217<\346\221G\036y\\\036M\315\212\025K\362\2709\372"
+	.ascii	"\326[\266,\222\335\030\305\2155\031\203@\362\220G\036y\3441\217"
+	.ascii	"\324\226\344!\217<.G-\222\004"
+	.text
+	.section	.gnu.lto_.refs.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375 cu\002"
+	.string	"2\206\022\027\360\334\264\006\314\3003\360\f<\243\270\231\231\231\231\231\031\017\021\021I\311\207zj\332\226\222\216\212\206\202~zvrnjfb^ZVRNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261Wk\325\356.\025"
+	.text
+	.section	.gnu.lto_.decls.c1c571390a23bf74,"e",@progbits
+	.string	"(\265/\375`C25\306"
+	.string	"\2720\031BT JQ9\351n6\215\335W\323\344y[\363\254\376\336\017\352\256_\345<M\343\267\346\311\031\270\255\217\025\333\366O\026\202p\207\331SM\026\231bu\367\f\327u\375\\\002\200y\230B\360}\337\327=\347\346\261k\3032\f\""
+	.ascii	"x\004\001\266\373\311\344\313-e\nc\003\037\004E\004j`D\321:\373"
+	.ascii	"\f\210\236\357\3203\030\364,\207\272)\3528Z\\\342p\237\307P6"
+	.ascii	"\273\246G\233].\233m\036\304\bfi\232v(\332\251\022\3427\327}"
+	.ascii	"\206\001=\363@\317X(\232\242\223\353\216\317\f\020\375\bd\274"
+	.ascii	"D(\223!\205\221\327\005\226\246jf6\206=\263\313\335\333\274\257"
+	.ascii	"\230\035\363e~\331\376\340\017b\204\335[\275\305\013bb\246T="
+	.ascii	"y_TW}i\252\326\241CQ\007\2361`i\332"
+	.string	"\320\376\326\241_5\364K\2062\315~\250\250\214h\201\241_/\264h\207\316\265\333/\273\334\260`\016b\204W&\264\324\fh\316\330\234\277-\364\273\341\334\300\335p~\263\320\257\025\312\301\022\235\315\266D\247\026\024\257\351\343\013\367\227\006\372\215\201^o\211\316\367-\321Yk\210-\321\031\314\023\001\372}\333\205\373.\027n\337z\322e\322\342kk\246Uu\036\200\376\306jtq\237\2102\337\356\333\311\364\221\373\321v\305\275\334\262\245\302A\322\324\211I\231\b[qPX}i\225\016\017<0\314\br\205\373K\345_\263\205\262m\253\225\246Ni\232Z \224F\335\275\341^\265\225\262\313\017v\312wm\331\256\323\304L\231i\312\024b#\200mi\334\031\226\350d\005\240\337\017\316\032\030\270\037\234\313\f~\323\026m\350\254\322\301L\331\3224\025\n\362\241\206\306\344>s\211Nt\207N\206\363G\371\005M\351\b\257"
+	.string	"\005\241\271D\247N\232\035:w\001N?\303`\021\374\034\202\237_\374\354\342g\026?/\375\214\374\331\003?'\375L\374y\305\277\030\360\321\317F?\243\370\271\003\033\374g\363\337\315\317\032\3709\003?\267\360\363\211\237I\374\274\302\317#~N\341g\021?\243\360\263\004~>\341\347\020?G\340\347\007\374\354\200\1775\370W\347\337\363_t7\220\360s\002\376\315\340_\t\376\245\340\337\021~>\300\317\037~\006\341\337\242\377~\377\001\377\r\376\013\342_\021\376\035\341\337\020\376U\300\317\036~\356\360\357\005\377v\360_\357\377\231\377{\377\321\374\347\300\317$\370\003\036"
+	.string	"\013\200\003\300\0360"
+	.ascii	"\270\003\346\2007`\rD\374K\201\177W\340\r\377\035\360\363\226"
+	.ascii	"[\334Z\332\262\354\311\222\232\346\022\374\025L\006?c`\204\313"
+	.ascii	"\212jF\024\214\021\264\250\177M\036+R5B\261\201\013\\\360\263"
+	.ascii	"\006\023\\\301\317D\022\360q\233\177Y\260\232\232\304vU\252\321"
+	.ascii	"\004?K\260\201\217\275\360\357\t\026\3729\350\177\224\316_\177"
+	.ascii	"0\320\317?\020\370\027\007\243?\357\234\347\257\037\376\225\363"
+	.ascii	"\371\253\220\177\251~>\177\326\371y\177\376\277\201\377\316\371"
+	.ascii	"\367\357\3378\377\302\371"
+	.string	"\367\315\277n\376m\363\037\350\257\035\374\273\346_5\377\346\375\213\367\357\335\277b\376\005\363\257\335\277t\377v\371w\313\277s\377b\371\327\312\277m\377\256\375+\345\337\264\177\317\376]\376\013\345\337\262\177\307\376}\362o\223\177\227\374\033\366\257\222\177\221\374k\344_\257\177\271\376\005\362o\216\177\253\376\225\372\227\351\337\021\374\033\202\177A\360\357\213\177[\374\253\364\257\361_\025\377\036\375\313\201\177[\370\267\304\277\f\370\017\367\237\312\377\003\374\247\373\037B```\340\317s\344\337\t\373;\320\022C\270_\251\352\024\177a\220d\214\f\356J#\370Z\003\235\243\245\206\0277\005;t\3660\273\204\300\330e\205Q\245x\244R\002\220A\231\211\365$\211zjS\241\252S}\252e\250\236L\341^1\301W\250\006\030\031B\306\315\034\240R\225\2512\361\234\216T\332yI\240\314\304v\330\004\006r]s\016\227\036?*'^\314"
+	.string	"\001\231\257Ji\021"
+	.ascii	",\216\034\2614\355\341\241\325\336p\305\340\376\016\324\337\037"
+	.ascii	"\363\211\210\323\363\363s\223c\263Kf\303|\"\314\322~\324$\t\003"
+	.ascii	"\206\373\f\207\335\360\227\216\233\0304\372\270\267K\360\374"
+	.ascii	"\246\207\300\241\202\201\23398i6\273\316\037z\273d=N\303\325"
+	.ascii	"#\355\254\233\272\242\343>\243\371\331\f\357\361\027PT\225&'"
+	.ascii	"n>\023<\307\240g\303\n\026\267\316\016\2355\2043\252L\031\256"
+	.ascii	"\343\220!M\271t\3504\277\354\222\2770\031\021\031\322\224H\f"
+	.ascii	"`iB2Y\224p\237\301p\030\376b=,)4\334,&x\036\343\343tE%\t7\317"
+	.ascii	"\016\235:\251\034\335\226]\362\026\256\353\251Z\001O\257\231"
+	.ascii	"V]yH\373\321:2\207*\007\367\231\356g.\334\205\277:\254\331\301"
+	.ascii	"\205{\327\202g/UN\013\224\034\356-r\273\262K\276\302s\034\230"
+	.ascii	"\251\225\317\023\027\0368E\344\226i'\025\266(\316r\376\372\321"
+	.ascii	"J\323\267\326j\273\002\344\006\021<c9\305\262l\371\2211\224]"
+	.ascii	"2\024\226\263\342\020\266\023\343\006\r\27787Zg\230\270\337\230"
+	.ascii	"E:\200\201ao\270\317p?G\341%W\371\321\002\302\366E\013\367[Q"
+	.ascii	"}\202bZr\241g*\273d7\226r\236\302k/b\246\351[\232\246n\214\306"
+	.ascii	"j$@U\361\324"
+	.string	" 2\206\306n\314\206GFu\325\307\203\345\003N\247\007\272\351\022\235\031tb\250\245\005\225i\312\251\302\315\364\321!U%\n\367u\232Pf\006\317g@K\366f\250q\033`\207N\020\3220\375\006\375\216\355\312\355r\345\270\214G*Moph\002\005\312\254/\255\352\341\341\007\013_\035\021\262\2406b7\322\270\237\26091\275\265A\361\330^a\261\024;_\2040\247p?)\3429\022gF\323\036\372Ek\302B\026\217J\336\033\f\274\204\231\260\023\016\333%7a#\214\204\223\260\022).M\226\216\203T50\022QU\232Yvn\267@\345\305-\226&\f\266mU\r\f\215Z\343\322\204\207\360WU\003\343\221\301\345\326\241\250\002V\031\203\366\323\357;t\245\226\350\224`\207\216\374<=v|;\300\352\320\267\225/\366\252RSZL\t\204\312\256\212\034\341\261\362\327\004\213\233\2130\327\271\213\211\244\334u"
+	.ascii	"\2554m\342.!9i\332$\264\333\301n\007M&D\t\225\263\337o\350{\r"
+	.ascii	"}\243\241\274\305\324 \264\206\304)H\030\252f\337\304E\2315\003"
+	.ascii	"9\206[\036\031\016\326\261\266\266\314b\031\214\0255\306Y[\267"
+	.ascii	"a*\023lg\215+J3M\231\234\265w\233\2462\301HpA\371\301=\230\007"
+	.ascii	"k\361\016\006\302>v\311Yw\312Z8;'.\257\254\231\246i\007\r\035"
+	.ascii	"\366\354\252F3\003\007\316\301\343\304L\325x\312\264\361\301"
+	.ascii	"\326\205\276\267\256\372G\315\006\2226\356\267\f\364\306.\331"
+	.ascii	"\212g4[\361\024\333\250gUh\334\232\016\241'uf9\272\271\212\271"
+	.ascii	"dl\256\232|(\323\340\032\273d\2527\232\026\023\2506\341\260\213"
+	.ascii	"\343p\n-\207\3635\006\364u\016}\205C\245\204p@\201\0024C/\002"
+	.ascii	"\037\303x\232\003\226\246N\374\264~\fC\006^`3M\235\2408j\227"
+	.ascii	"\374\304N\035:\024\365@\311\362d\306\331\257_(\247\314\264K\r"
+	.ascii	"\334\024\347\216\212/\b*\2024]\r\347\006\006\256\206\363\225"
+	.ascii	"\007`\333\022-?\270_\231\320\357\337.W\316\366}\273\254\2273"
+	.ascii	"3M\325D\340\333"
+	.ascii	"\267\240\246\f\251S\324\f9\353\267o\225)\207\316\210\232j\246"
+	.ascii	"\251ZQ\207\016@\001-\345o\257\305B\327\345\356\217\273\323\202"
+	.ascii	"o540\020\213\027w\020Z\237\245\021r\245\317\272R\274\205Qc\203"
+	.ascii	"\273\315\202o\246\226\223'B\226Qj\326\231-\035\345o\263\206\302"
+	.ascii	"])\276\256\340\370\270\327\002\262\340\273\f\250\353\210\223"
+	.ascii	"8\356\n\306ZL/\213\211\233\026\373+\215~\302])\274\020\331R\203"
+	.ascii	"{\265\226\310I\2233Sxp\334\357&\177/i&\214\204\306\027\025\356"
+	.ascii	"\275`\207\316\016\013\276a\340\211+\0033\204[\003X+q\013\323"
+	.ascii	"d\343~+\351J!'\257\214\020\356F\022|'\341\302\325\344\336\340"
+	.ascii	"\210\2212E\242\264\2217 W<\306p\267W\360\3755\307o\006\033\267"
+	.ascii	"\320\016u\245\t2\023\203\310\032\256Z\225\002\215\034Er\374\370"
+	.ascii	"Xs\327\205\b\220\235 ~P9\206T\256\236C\013\242&\204\311\254\027"
+	.ascii	"\031\026W\020+>ei\376\270lU)\016+\222\262\321\342\363\231\022"
+	.ascii	"\253\013\003d\256\207\213\223\2268?\270\356\315\316\316\213\217"
+	.ascii	"\036kX\322\300\272\007s\353\f\311\034\217,\024\307\323\331\016"
+	.ascii	"\356w\326\337W\275\003\250\007\fC\210p?\214S\360\255Cg\007\335"
+	.ascii	"\226\221\034\215\243\210\024*X\334o\034\177\215a\263| \020\220"
+	.ascii	"\217\273\257\202o\254/Z\232K\356\237\035\262\272\001\364fOHT"
+	.ascii	"\337\370k_\333\220r\n\302\204;\204%\252\242\342'gC\240\232\252"
+	.ascii	"\211\374\330\003R\203\306i\003\t\0312\334o\032\177\205\353\251"
+	.ascii	"\305J\203@q\257\016\031\301\367\f\236\2668E\266pO\3201Z*k\213"
+	.ascii	"\210\214\226R\203\353\372jFA\375\234QY5\324\337N\375\004b\312"
+	.ascii	"\213\313\022\235>\200\3017\f\251?\262\246f\3229\223\202C\245"
+	.ascii	"\231\226\213\323\317\027\226U\247\201OUuO5\360\257\200u\016w"
+	.ascii	"\2458\003\225\270\221[\242\263G\316_\277!cg\305\375\372\367\327"
+	.ascii	"\0365\016\036\034"
+	.string	"\233.n\022\226\350\254}\301W?(E\244\276\270\317\312\007\007\205\2150<8lA\200Hf\200yS\335\370\344M\251k\253gj\033\356J\001g'\245\b7\207%:\327\254q\2032\023\023\232\013;r\204\373BVfvY\315T5\"v\200\335@\363E\213\330V\020'\356\3274\177\335\253g~\234n\260\365q\327\030\202\257hX\t\033\035\0357\320\016\235;o\006\371\345\345\245@\365\367\003\243\007\031\2569<\274\300f\020\363\356N\315^3\210K\214\030\252/\3154/\276\240\250\n\246\202\211\363\322\324\263\263\253R\023TU@\r\\s*L\027\027\367\201\330\350\350\224P\001Z\322\245\213\222(@8\266l\371@\006e&\36637\327\367\243\207\005\013\327q`\246LAh\366\240\314\372~\334\334vY\335\252\225.\031\314\036S\322d\350-\323p\277\312\375\365\255VY\323\264\207\206\273\302\005_\343|\334\350"
+	.ascii	"\225p\017\245Z?K\332\332\252\024\022\266\237\034kk<\327S\305"
+	.ascii	"\003\207\206\254\351\363'E\n\232#`AV7\326\304\210IKc\276\t\252"
+	.ascii	"R\240\341\325\024\302q\027e\013\367}\334\316\316\f\300\003\312"
+	.ascii	"L\314\207\311r)\007\312L\314'\007\024(\037\310\2002\023\363\211"
+	.ascii	"*\253e\314'\242\n\233\2611\256\323\221J=\260\315=y\342\241\007"
+	.ascii	"Z\223&\002\250\2032\023\363Z\262D"
+	.string	"G\317\214\032V\303\214L\361)Q\302s\0342\244Nf\002\353\220 \351c\0321R\245\274\314\360xU\257\352\305d\350xn\240\177\335\332e\335\252\\UJ+\265*@\031\023W\263O\250\351*\213\212\r\023'n\270_\213\3745H\025\262\323\346\206\347\205\273\016\t\276\022\351k\262\306\204\373Sv\350\364\200)ff\307.\353\216\n$\212\237\231\021\030iK\360\240Lq\277\376\370kV\345\021T\206\025\325\304]{\004_}hPe\316\n\367\316\016\235\2352\257\334\330e\275Qs\210\201m\036T\033\2474\036\030\202\300\221\303\375\212\243^\315yi\341q\357Y\360\025K\350.\356M\022\356>\033\231\214]V\031\265J\0043e\362y\332\201\376\210\263%G\032Z&\213VC\244\260\305\021R(\0029<2\022U\260\220D\036\213G\023\224\216\206#\222G\304\022HF\242q\351\304\321\220\250\202XTJ\"\232\360"
+	.string	"9tAT\201\002\344\260\270t4\\ad\242H\211<\226x!,*%\211'\034%I \207I\304\023GC$\243\320\005%\261\004\345qE\362\004\r\220\214D$!r\310\"\304\021R\330\002yTq4\034N`\203\243r)\204\262\030\302x$*\211\311c\211\f\224E\342\004\204J'&8\"\225F\306%\341\b\013\220\214\304\025\312\3431\311\204\021\013' \207F\242\020y\342\2104\n\341BX\034\262@\201\244\2412\371\302\304qxD\264@\005Jb\022q\304\260\250T\036\221+N\b\275`4\\aB\213cQ\005r\310\202D\006K%\274@\016Y\034\215\206,\254H\n\221&\024\2550R\022[\230P!L\026\211\302\t\f\275P\022Y\b\221(\020\225\306\020\027$!\207\312\0230\030*\2758\221L\n\225Z\034G\024\217FG\345\021Y\"\251E\211\257"
+	.string	"\341\303Q\221\270\344B\022i\311\205\341Q\020\222P\005a\tFF!T(\215\030\"\205-\216\220B\021G\344\013\024.(\n]H\"\242@\364\025 \f\221\204\312\342\221\305\207$\362\2304\016\223\033\222F\310\245\243\t\344P9TAi\034\"\221KF\026\f\225B\026\206E\245$\241\211\rFD\026\303\023\\\034]x\301HX,A\003\006H\214(\241\005\013\206GG\025L\204(\301\004rxDdqD\2260Q\002\205\n\224\306a\222\021\211X\fA\201\222hlA\310HB\205\n\022\031\224I\024\3113\371\243T\016\223*T\034\317\243\341\013FB\2453\211\202X4\352A\nW\030\3650Ih\354\241\322\013e+-@,\032eP\242"
+	.string	"!\202\013\241\n DX:\225C\024\305\t\224=#\224\226^8\036\213\247R\202\235S\351B\230TU0\022U \026\2154\030\211I\365hhD\"&\215-\270\020&\031\211IA\3123\004\261hT\301\013!\022)\324Q~E\022IXT\241\223Da\302\b\023\304\242\221\005Fb\022\317\n%\222qXt!L\342A2\022\221\312\344\251DA\302N\362\250\244$\272p\"\021U\030\217F\247\022\205\021II\307\210\244T{\224\306\245\243\t/\220J\243\004(\370\005?*\r\221\037\224\307#\362\203\217\022\005\002\202J#q\t}0h\002\007-\254\200\002j\004B\022\311HT*\207\311\017\304\242\321\007#Q\230\364\301\b\231\374"
+	.ascii	"\202\006\027\303##\005\206I\302\025\206E\027\204'\206KE!\213"
+	.ascii	"\241'\035\247\266%au\334\327q\372u\232t`ljw\304\n7\027 x\035"
+	.ascii	"&\263<\2766\334\036v(pN\221; =\347o9\r\310])\262\364jlq\357\206"
+	.ascii	"\274\340\373\317\t\216\035H\342\370\211\345\230ck\277\277\305"
+	.ascii	"t\337\024)Md\270\267k\211\370\340h\361\343\201\306\375\206\363"
+	.ascii	"\267\225~s\306\225\231Yqs\225]\360\355Fgo\257\315]\0336ZZ@\362"
+	.ascii	"\270\337l\376\016\3535?c\232\276\276\270\227\255\211\345\006"
+	.ascii	"\332\0265i\262\246\264\314q\277\323\374\215\244\321\234h\362"
+	.ascii	"\274Pqo\337\231\340;\006\037\3007"
+	.ascii	"6M\334\032\354\231\221\343\246\317\217\373m\346\357\274\326\363"
+	.ascii	"\2111\246\357\212{\303,\321\231\001\227\340\273\314\327\026\024"
+	.ascii	"#xd\310\210\f\211\342~\223\371\233\254\357|\316\300\310\031\343"
+	.ascii	"^01\301\367\030!\037I\230tp\023\205i0S1\274=q\277\301\374m\327"
+	.ascii	"_\236\372\232\201\334\334A\335Y\035\026':/Oj\002\311\270\337"
+	.ascii	"^\376\346\322"
+	.string	"]\270+\305\226\034\263\n\367b\260$\370\336\362\323FOmL\313\234\016\246_\022\356\367\334\337X:K3\205m1\343f\035Ktz`%\370\276\262#e\215]\312\r\200\035\222\213K\303\024\031\323q\177\2475\334\024\017\035j\270\337\\\242*\375&EJX\025\367\373\355o\031\355\006\004\rM\007\367V%\t\276\251\330\030\223B\245\215m\314\220+x\334o\266?(\214\023'e\270yJ\360\275\326\003\327,\243\232\322R\204T\231\t\204/\250c\203\304Q\230\351X\230S\2129\221\2214I\032\003\323\024@ @\214,\036\355\302\366\006\023\300\020'd\3310\320\224\004)u%I\n\n\265\232\003\246\202r\225\032.\fk\214\260z\332u\270+\222P\216i\177>W\300\377\217\371\005\r\370\363\032\021\216u\324\331\245`H\206\235\005\253\2169f\314Wn\327\272X1\t\1778Z\b\\-\230O\030\247W\272bu"
+	.string	"\257\271;l\272k\263\200`\245\332\374\003BMNP\016\3401G\231'\3204*\200\216\233o:@\204\333C\266@{\303\005\252R]l\310\334"
+	.string	"\261\f\3144\006\351\"\300\235<\272\326\363P]\033\373qS\361h|\2458\\u~n)l\245\016\373_7z\036g\022\223\266c\037\252\360\275W\233"
+	.string	"&\245\352Y\204\177\306\302!\2165\005\fDX\210\ta\235\204r\025\271\343o\201EtX\303%;4\363\330\032\271\225/\202a?H8A\n9\026\364\366y\253=;\372\310\207\234\027Wa\"\246\277v\220\263k\n\022\223\236\315\220\0052|\340\375\223\245i\363\351\362p\221\313\203\001\343\216'\b\327M\357\242\365.\212\351\246\246\220\244\331O\351\233j8\377\002\375\330=\356\024_\321\252]\354\341\024\257\244\266Tl\302\352\322\315\314\223\t'z\024@\355\245\234\220\320)\b\235b\261\236U\2558\3629@\n\031^g\370\0025%\335\301SL1;=\224\211\020[\020\317~\214"
+	.string	"mj\005\333\235\240\374\001\343\005\312qu\220G\226\260\032\332\271\241\213N\001VQ\342]E\242\260\227\247\277\034\266$p\371\267\267\031\023\f\024\216\375T\316_N\350\212n"
+	.ascii	"\007QR\372\340wfd\004_-<\320\371\227/p\335\376TF\206\360\001"
+	.ascii	"Y\220>K\376!\030-=\254q\f\252j\205\375\202\2347O{A\246\0372\324"
+	.ascii	"\234\351\004\367\234\037\364\363\231P\337c\223\324\022\347\027"
+	.ascii	"\235S\323\315\210\255)\005i\306\331\240\030/\215\321\346\001"
+	.ascii	"\211:\274\204\265\r\304\240\f\252.\214\235\310\n\363;\375\362"
+	.ascii	"F\244o\006+\361\321\232\256\362S\256y\"]\274b7\023\031\b\254"
+	.ascii	"*dsj\025ieC\360\362 O\037\340\241n\357\222\313@\022G\377\272"
+	.ascii	"\021\210\231\354\222\361qg\272\235\321\225\354\003\322'\205c"
+	.ascii	"\331m$\031\233\223\016ek\376\363k\032H\345\007\352\277+(\n\020"
+	.ascii	"3\331\007\nd\315\217\246\364k\020\031\364\253\355\373L\257\007"
+	.ascii	"\206\254\331\222\263\333\271-*~\270R\342\001L\235\204\331\242"
+	.ascii	"E\300\273\361\2646L\322\372J\030!\200\345\207\256\254,\026\245"
+	.ascii	"\232\260\371\027>6\266`\220\340\235\3761$\205\214\222\230\306"
+	.ascii	"\177\202\226\377\227Z\020\266\004\225\325\335x\030\271\367\230"
+	.ascii	"\244M9\201*\351\322\334]l\367\323P\035\350\255\330D>\261\231"
+	.ascii	"\322:\2351\2410M\234\331$\200i\326\"4\353;\301;\205Y\r\223\365"
+	.ascii	"\260y\234X\344`\262\370"
+	.string	"zI\253\250a2y\3624\370<0\345\224c\234\326\354\365t%\223\240\304'\321\267(\272\244\212\276\233b\266\007\327\037\230\254K\224\260\317\351\302\232\260I\340G\220\327\276\346SZ\\Jx\336#\300L(\231\225\013\231\254>U\240\342\370\261\264\312\006\242\201\025?\343\214\214|\253\f\274\305Z\254\337\370\321-=T\322Y(\324W\264\200\016\021\373+\3050n\315\370\025\340\002@\3509\220\336\312U\264\017\213t\251\241\226\232|4\256\312H$\210\276(-\027\332\343\270'\251osTo \r\311\\7\377\374U@LOp\204n\242\330\310Ir\005\016N\324\"\267 \364.\330xX\377\361^\2727\007\032\344\\\227\253\261)\265b\367\f\306S\260\323\212\260D\273\017^A\313\203M\263M\253\352#\241{\006XJ@aa\323.V\265d\325\b\b\021\302qG\277[\220\336\353\340s\330F\353\351\361\251ld\214"
+	.string	"\020\251\037\227\bq\037\311&\302=)\243\322S\bq\230lD\321ST\360\203\372\221;\317S(\333\351\216\350\032\362\037\366D\212\334\005\026\274\310\n\021\346<EmZ\023~`\351\302N\013\3350\260\353:\2010p\346UF\253S\265\365\361\210\312\372\232\204\322!t\002L"
+	.string	"\341\273\343\335T\362\016?Z\274\343\334\205v\325\026\267LlJ'\030\277\006j\250\336\236\234l\254\270\342\212\364w\271\337cApT+\205\033R\202\340\247\b\032\"\230\321\305\335,\376!\332\355g\265\177\227\334.\216\n\007\276\256\206NHx\2014\365\0038\310\346\211\255\372\355\017\\\304Hf\243Z!\202\021\340$\003\227\210\360\256C\337\035\021n\220\372M\333v\340U\276O\026b\313\035H\007`\320\243\0240\216^\244\242'\344\260n\241\270\341S\204\234~\211wD\215\257;>e\031\374\316:\215$"
+	.string	"\246\200\250\310}[\267\350M\354Y\354\304\371ru\202\353U(\245c\375X\240\260\241\250\220\344\016\241\313\370:\277;\222\204\344.F\363\377`\360\002\274\365}\377<\005\345\220`\022c\025\227\375\214\030\313N1P&\f1\2246\207\312\036&\334| \344\210\231\352\r*x\242\2178\365X\202K\210\325\367#\b_\252\300\315\200[\263\301 \242\360?\211-\247V\0132\336\333\373\r[\367\245\004\357\316\0053\276_\262\202s\235\321\362\204\354s\305\233\004\361*\244\025\242z\177`\224\304K\261\b\213\bcoe2\337\027\311*\307O4\302"
+	.string	"\027\251\203\223\"]\t\271\033C\024\340\251\226>\223\315\257\3629@\337\306\262\317\351\367\306aP\021B\352\207$\361{\213\007\232\322\263@\317\343\207\210w\303[aJ\227\372/\372\356{\366\226\033M\305\357R\210G\005\263\314:\013\264\202\304\2369\356g\031/$W%\217z=\n\253\277\246\214\211\213\353\347\364\r\340\024`~\307\021L\3754F\016\300\026\370\n\030\302~\222>$\341\202\034T\003O\214:\243\320}\021\337/\377\353\r\311\341\345\3008'\177CL\300B\304\"M\246X]\024\354V\224\251nF\351\0012\021R\367]\034;\0278\361\377\024e\361\252d@\353\001\222\267)e\304,v\345y\257\355h\026\353h\247\237\350\247\376k!w\263\021\360u\347#\006SN\021\3138t\340\310\210\003h\233"
+	.string	"\322\013\0203"
+	.ascii	"\302\376W\316\277|\376\351\373\315\365\007\317\317\036\177\362"
+	.ascii	"\373\346\366\203\327\247:\375\274\315\347<~\206\301g\336}\262"
+	.ascii	"\366~\354\233[\017\247\276,\275\032\372b\347\331\231\317W\336"
+	.ascii	"\214|\260\361\354\304'\013"
+	.ascii	"o\006>\330w;\357\025\353\316\277=\275v\366\331\223c7\277\036"
+	.ascii	"x\353\362\252\267\214:\357\3223l\321\225\272\363\3647\370\230"
+	.ascii	"\337\003\363\303|I\337E\245\225\206\335@\265\013\360)a'%;%=\212"
+	.ascii	"9\241\271(\352\023ls\376\t\373zLu\025\314`s\307\370\2158%\325"
+	.ascii	"d\315n\231\237t#\322C\342G(\033\207'\305n\321xo\027ws\252\257"
+	.ascii	"SC\037\300\2765\305J\341D7\237\255\017a\317;\273/\034P\343\007"
+	.ascii	"_Po\377Fc\026\3477\323\233\263g)&d\364\256\315wui\345\004\353"
+	.ascii	"\225{\023\256\020\320\326\324\211?>\274\253aM{\340G\375\300\370"
+	.ascii	"\264\234r6l\377\274\247b\233\200\337\t,Z\016\330l\350:!R\356"
+	.ascii	",\0010\360\246\255\350\220\227\265-\035\273y\234\271\221\355"
+	.ascii	"!\350\2047\237\370\256\200G-\013>\274\250\r\0346\352\262/\375"
+	.ascii	"\017\331\323g\313p\320\260\330\237\272;\\~o\363\253\340~l\353"
+	.ascii	"\323\3631\341a\277\027\255\307\347\226\357e6\271\307\005\341"
+	.ascii	"f\234\036\004\253\363\215\334\027Y\317\243~U\017!:\366\237%\217"
+	.ascii	"H\037\205\236*n\205\217Z\314\371d\274 k\222\262\274\363]\375"
+	.ascii	"\213\371\024\353\343\377^\322\3727\342\315\003\323\213\202\331"
+	.ascii	"\005\037\323\251\325\302\357z\352\n"
+	.text
+	.section	.gnu.lto_.symtab.c1c571390a23bf74,"e",@progbits
+	.string	"valueTableNameIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"lookupTableOffOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"lookupTableItermRelax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"lookupTableItermRelaxType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"lookupTableFeedforwardAveraging"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"lookupTableOsdDisplayPortDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"lookupTableSimplifiedTuningPidsMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c1c571390a23bf74,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,617 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 f\245\002"
+	.string	"$\004Z"
+	.string	"\b"
+	.string	"\334\206\377\260\007"
+	.string	"\001\260\240\374\337\017\002\002"
+	.string	"\002"
+	.string	"\002\265\212\310\322\f\003\262\264\234\242\004"
+	.string	"\004\216\231\205\311\b\005\327\210\227\303\005\004\002\001\002\006\256\306\254\254\004\007\365\267\335\206\001\003\002\003"
+	.string	"\006"
+	.ascii	"=\247\270\\\221\331\220\232\362s\271c\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 \265\355\002"
+	.string	"\224\003\251"
+	.string	"\b"
+	.string	"\002"
+	.string	"\003\001\003"
+	.string	"\003\002\002"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\200\f"
+	.string	""
+	.string	"\b\003\004\004\003\005\003\001\002\003\002\001"
+	.string	"\b\001\020\b\006"
+	.string	"\002\201\006\007\002\t"
+	.string	"\016"
+	.string	"z0"
+	.ascii	"\325\016\217\020&\005\353&8\013\270\302\211\025\323hO\311\336"
+	.ascii	"\361\241\271\f\210\0048\002\003,"
+	.text
+	.section	.gnu.lto_.inline.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`O\001M\007"
+	.string	"\322J%,pI\223\016\374\247\021x\260\223\341\345\313\302#\277\017\376\3362\254\277\376\303\212\f\006\276\365N\377\317x\217\206T\314\361\377[K\266\334)?HO\303f\264BHO\003\320j!=\215ce\275\256\002f\236\025\257b\nN\"^\305\034H\274\212\031x\275\032\305\035\234ha\343#\362#\322~AA\223\301}\2063HNP\320\204\220?\243\210\277RlGHRP\320D0[/\364^\206:\347\234\362-\033\234h\021X\177R\\E\354\330\3629\321\022\360\215\233\020# \200\"#\243v2\001\021\r8\200D\302\3341$x\227&\007\032\304\361-\362:d\nq\354\006Hf@"
+	.string	"\003s\244\346A,\314\206\f\016\027\300\020\343\257x{\177*6 \252"
+	.ascii	"\344\t\0373\276tu\022\377\257k\267\351\300\270]f-\215\017\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 \353\205\003"
+	.string	"\262\305\017\027\300\245\320\001\277\353w\375\377\306\377_\371\277)"
+	.string	"\263\t!r\313$\003\322O\fz\2740\353\343\237\234\225\353\310*'\031\343\261\320,\226TR\326m\200\337\206\225\020\3742Wa\r\3744\032\004\023"
+	.ascii	"P\245cz73\026\302\332)\266\312Q\204\021\032\240\201\030\344\032"
+	.ascii	"=\362\202\0014\2556\330E\250\005j>\204\371 \260\234\027\0216"
+	.ascii	"\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\001\205\004\002\231\004\003\200\004\004\205\004\005"
+	.ascii	"\231\004\006\205\004\007\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 e\225\001"
+	.string	"\330Y"
+	.string	"\006\001\003\200\007\300\004\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\002\002"
+	.string	"\024\004\004\200\005\003\006\007"
+	.string	"\t"
+	.string	"\300\020\257\372\301\314"
+	.string	",\006U\330\317\321^(\003\341o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.cc285e0f764884ef,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt.3.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`k\0025\024"
+	.string	"\246&\205H\320\360(\035Ca\372\204p\274x\306\2345\376G\362\264\313\225\366\310\360\223\246\n9Y\233\373\346\377\261?\221ei\275o\261I\240g\3529|\341\005W\320\b\037R\235\2059\261/e\204\220\266r\005\375\215\020B\310\2262\245u"
+	.string	"h"
+	.string	"p"
+	.string	"\007\304\177?\361\234\227a\232\3730\243 \007f\247c\316\334\n\300\005\200\377\364*\360\337\342X\274\314\335\241\302.\206\340'Wa\376\316Gzr\304\324\\.\312Pff\306\211f0H\024$\243\f\264ZL\303\0216\007k\376\231j5\227\322@\f\0174P5\n\222\200M\210\346T\223\351\336\347\n\324\213\251\331\\C\006sNkL\355\302=\336\266\006\333+[i\002\266*$\005\"\325\250\217\343~\217\347\376\323w\267\3518\334-\256:\\5\250\352O\325r\325\253jU\365\003\2148TFsZ\350)\315\241\317E\210\357n\237\307\367\361\311\272\367\274\276s\220\234(\032\344\350\034\3159I\376\331D\374'\"o\277\354\223\235`\301\353\271\002\3369mE$\252\307\301\374\315\311A\207\305\2349\023\007G"
+	.string	"\216\233Z\tc\246\024\323\n<$\216\276pCV\177D:\274\005\0047\334\177\013\356\336(\271\334o?\256\334P\266\342&T\350\210\344\336\334\002\356\272tB2M\362\270\273\367\371\310\013\336\362dv\264X\243\326c?\366;O\375\300\324\350\242\326*\336A\340Www3\245\230\366|\332\357\332\200Yz\321\236\235s\321\275\331GA\232\211\360\336\004**\232r\226\213\265f\235\260\\\254\025Kke\245\305Z\261\250\244\254\254X.\t\253\223\001nE\200\340ZMh\265\\\253Sn~ol\031\216\013\002\"\"m\030z\331\230\2707\207E\240\352\001oIInZ\232%(:\300\251\241\037;.\315\274\233vS\364tE2M\272\234s\316po\036K|\2515\201\260\311\220\025\227f\227\334\264\252\re\364f\266\230\366\024\b|/ P\002A\314i\007\023\005>\035\006\352\013o\031\253(\007_\373"
+	.ascii	"\032\302\224}|hK(j\205\357\277,\002Z\371b\364(\267\303\354\036"
+	.ascii	"&j\237\365\006c\332b\251)m\001\360y\332U5\223\332A\3068{\356"
+	.ascii	"\315J\\\262-\326\177\337\306\"P\337\361\267\f/\200\305\377\f"
+	.ascii	"J\336\022x\bh3\270g\f\207\227\030y_\343\367Z\247\245O"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.4.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`\214\004%\037"
+	.string	"69\307K\240\024R:\225\364o\320\032\363I\260\377J\334s\n)\250t\215uQH\332@Oy\177\340+\037\211\357~\350\273^\036\255wS_\313\365\022\344x9\377\234\274\236<F\275.\2746\214\314n|\354\255\277a\t!\204\220-w\222\001\265"
+	.string	"\253"
+	.string	"\261"
+	.ascii	"\347Q\364)\016\273\355^\027a:\305\223k\275\324\217\311{U\004"
+	.ascii	"\021ro\021\001\347\234'\257\343QE\374\253E\030K\f\212$\371\260"
+	.ascii	"roQW;\256<Y\017S\236\354\027|\376\374U[<\247\375\373,EO\263$"
+	.ascii	"m\327\037\277\253\266@\f=|fM$\0213\256d\t\205\335!\023\353z\026"
+	.ascii	"\260\246\002\236\230\232\216ZSi\251\311\225,\235\260;caM\302"
+	.ascii	"\341Q=\237\230L\334,\3612\035\2268i\t$i\001\2056\f\332\234\023"
+	.ascii	"\330\210\331\020\251Z\343\353\016\033,\230L\274\237u\003G\306"
+	.ascii	"X05\275\232\273{/W\020C\246s\313\231\271\t3\357\230\255\2050"
+	.ascii	"7\033Z\271V+\277\320\\\316%\365\247\277:\243\257\372\317O\375"
+	.ascii	"\346\261\316\344\245\316\266V\356\263r5+\037\200\313\023n\310"
+	.ascii	"\275\"\216X.\022\262\213\306\277~\256\377\352\307\272e>_\310"
+	.ascii	"\277\370F\236m\025]\353^\314B\007\302\357\n@\303\312\275wv\222"
+	.ascii	"\313^\030;\250\"B\227\372\025\330\225E\211]\213\277\3053\241"
+	.ascii	"\007a\243\275W\021\242v\210\335{\037\b1\317N\236\271\210\377"
+	.ascii	"\343Y<cf,\"\034\017Fj8\270\"\332\001?P \002&voQ\347$7\260=\356"
+	.ascii	"\243\350U\035l\355\036\265PRp\236\304\261]\231_\f\345\255k\332"
+	.ascii	"\032\tb\001\326\020S7\304\312\231\246\351\252\205\263\342\032"
+	.ascii	"J\231\236\351'\221\300\265L7\225\003\217i\\\377\3261m\036m=\007"
+	.ascii	"\020\252$\244\206\022\246}T`G\225\214o\r\3237~\300\227U[)]\341"
+	.ascii	"\262\265\266m\263i%\221x\351ZsM*3:\033\313\356\227\276\327s\200"
+	.ascii	"U\202Xjw?\313\207\f\371\2342\370D\345\311\332(\322Q\330dT\217"
+	.ascii	"ug,X\243\233\330f\243]\231\004\241\200\365\310g\277M\243\223"
+	.ascii	"\2442\243zd.\002k\023\231o\002\245@\341v\301|c\363\257s\256\206"
+	.ascii	"&\255<\223V\226\251\225q\265rLZ9>>5\350\027\200z\202l\206!\f"
+	.ascii	"@=\033J\236!\236\013\226\347\3435\363\022\360|<\035P\357\347"
+	.ascii	"\247\307\323\001\371\360\374\350x>!]\002\032\356\005\365\370"
+	.ascii	"tC\275\236O7+\032\335\246\266i\264\346\340\205\304\250\201\263"
+	.ascii	"&2M\030\005u\251 \224\252f\223-d\264\245\331\326\264m\013\321"
+	.ascii	"&O\262C\230B\226\"\265\347\255[\026\234l\227~\326s\220\252\004"
+	.ascii	"\241\320&\262\371\304\264\351\033?\301\252\254u\236k![\363F\302"
+	.ascii	"\213(m\353[\013\231\310s\335?\216TO\216*\231\275\367\336\263"
+	.ascii	"\211\214\342(k:\215\341D\322\364M\013\231\017<\3276m.9\006\235"
+	.ascii	"\200f\023_ \\\250a<\243\bs\210\220\004#22%i5`\002\231\262\354"
+	.ascii	"\006\020pg\223\244\335\320p\257\2130\0215\201\t\244\037\262\230"
+	.ascii	"\bR\023\354:\202!]\034\344\b\003\331\211)\300\b#u\233\207\037"
+	.ascii	"\232\264\335\352I\361\360W\371q\267\212\237\254\020\221\242\305"
+	.ascii	"\\\025\251\265\2741&\261\203[\216\261\220\261\0070\017\223\246"
+	.ascii	",\2016\025;3\324\362\023\211*Y9\001:$]Y\026}d\267\035\274\223"
+	.ascii	"\355CX0\271\017\367\037\343\207C\261B\270\303\356l\004\252\263"
+	.ascii	"%\004H0\326M\316.\254\3275\322\246C\216-\207\n\301=\377\316\224"
+	.ascii	"\366j\314\"\030\343\2261`\274O\210i|\313?\304\212\361\240e\311"
+	.ascii	"_\373\f\351\210\376\007"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.5.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`\272\0045 "
+	.string	"F;\315H\240\226J:\2329\307\020[\242\220[\362\"\323u\361rP5&a\301'\360\201\003\336\270 \327\220\270Q5\3364\264\3254:L/z\205\361r|\230\007\376MO\357ZB\366J\260\335\335\336]\233\033i\204\020B\344N)\273"
+	.string	"\261"
+	.string	"\270"
+	.string	" *LYc\253U\330\363\321\rl*\364\220\326sj_\3538~\317\361\3410\265b\001\021\253U\270\300\006\314\217\026~\206\374h~G~\374\331j6L"
+	.ascii	"\322\232v\270\325Zy\313\302\346\315\037\025\205\367\271\277\353"
+	.ascii	"\316\234Y\222\243\270\364\347\017O\251\2328I%]'\226L\"`\\I\324"
+	.ascii	"\t\321\347\215m\354b@z\016X1U"
+	.string	"\365\234XBE1\271\222(\023\242O\333Z\325\223\324\0225WL\225xIu\362\224\242\372(\026H\242\"\255E*(\342X\035\031\241\223b\242\242\331\351\326\214\253\251\022\337\213=\201[\333\325T\325i\371Sk5u\222\232\272\001\334\266\023\333\021l1\030\3244%\365\314I-\263\213\311Q\303\224\324/.-\037\273Y.\374u\347\272\317\347\370\315\207\335\343\275n\261\244\336\222\232\232\324\017\340\342E\263V\253\2108\270z6\216\305x\331?\366\207\375\\\277\227\017\344e\276\231u`?\261\362\220\240\265\305Vk\355\371:\231}\364 \276\020\001Z\272\217c<J/u)DZI\217\356\205t\340\347\212\026\033\017_\314\272\260\242'n\020\314\177\371`~\217\3738\372\017\227\361\344j\275\332\222Qk}`~\344\021\277#\217l\335\307\277\353C\353t|\307\357^Hbm\361\243\245\346\300\374\370B\277#\271:\374"
+	.ascii	"\003[.\211\013Z\001\313\315\372\001r\2678+\032\t\302\001i\b\256"
+	.ascii	"\032l\244\315\336,\005\343I\361\rd\315\332\354\233H\320l\315"
+	.ascii	"\256\024\005\237Y\232\375ng\266\\\n\373\215\037]I\306\r\244\314"
+	.ascii	"\372\272\216,\3217\357Vfov\002d\303\035BU\t\"\302\254\27010`"
+	.ascii	"M$^\026fM\315\273\214\244\373\262'\273\001 \225 \034\220\306"
+	.ascii	"\371K\367V\232\256(\3218\373D\214z\346\013\277\210\374\370\275"
+	.ascii	"\330\0214\205=U)\321\270\365i\013\312X\263Psm\rA\364N\347\322"
+	.ascii	",$gK\233d\013\201t\263\354\227@(i^,{G\347ew\016\316\315ImsR\327"
+	.ascii	"\224\001>#\016\033\024D{\276\336b\030\312\260F> \243\242\321"
+	.ascii	"\250\b\303\272\307\240\347\353\361\206\210\204\204\210z\274\241"
+	.ascii	"  !^\317W\304c`c\"\016\031|<#\"\"\037O'T\372b\331\342)\256\313"
+	.ascii	"X\345Li\201\206\241\273\346\332\027\200\350\235\314\303\264I"
+	.ascii	"v\331\335!Ht\233e\226\252\\\213\205\030PT\267c\216e?"
+	.string	"<\00505\352#\221\342>\235;\236h\217\020\345\r\305)\232\273ei\360q[\026P\r\2034r\233\345\022\255\324\2410\274\262=\317\331'\213\345\316\004\026j\033\263\273}r\221\347\354~\305u\241-\3217\261\326Z\315\315r\316\006\211\263\247\013\253\361fw\366\311V\360\234\325\tb\250a$\246\214t\310\b\311H \"\2224c`\002\231\262\253:\020xg\232\f\007*U\024\244\341\220\224D\305\333\036\034\020W\023\273\232M\020*\271\022~ma<\305$\257$\027\301\362x\204\243\001\030\2179\260M@\n\305\261\307\370\215\332\354-X\354\322\364?\222oq\331\263-\320\003\t\303\325?@\353\236\344\177/U)\231\314\257D\236\020\220\230m\021\256:&\\\204\313\322\257\234\355\262P\250\013\3771\257\252]SQ\235\004x\265\007f7\272\255\032\356\005/\253o\335\225\366\275~\320\r\016$!\206\260\243\377\272}"
+	.ascii	"\006c\301\0361\366F\004h\325?\305\030\350\317\203d\0320~\262"
+	.ascii	"\0217X\224O\004\226\341\221\3131\276\035\242;\271\377\001"
+	.text
+	.section	.gnu.lto_crc8_calc.6.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`C\002u\023"
+	.string	"\366$\201H\340\320(\035\212p8\317-\362\220l\254\223rJ\t\333\267xd\233\203M\031\221\207\242\364\331D._|\311;;\266s\261\236\205\357\303R\t\302\030c\214A\020\317d\205\003b\314\2654\017b\231\320\377F\b\331[\312\224\002p"
+	.string	"e"
+	.string	"m"
+	.string	"#N\020^\242\036\260\230u\034\b\031\324\215\227\216hN\334im\034>\342nPY\017\301O\306U\226\257\363H\202\003\017F\326\3620\202\261\231\031\007\232\241\305\222!\033\035\276\273\302d-\005o4\377f\227%\331\3541\"\210\361\241F\207\fC,P\363\331`\222\275\350~\367\0054\036\030\031\315\025\2140\347\264\302\3104\334\244\333\366`\333\201\255\023\002\376\3608\356\357\3400Eu\211\364\234?<\316\017^w\177\3628wT\365\252ZW}"
+	.string	"\rf\004zs\312\364\216\346\217\\\021\342\272\333\337\361w6\371\271\233`\271\316=a\313L\310\313e\020\232s\206\\\032\025^\036\370\200\3572^\300wy\233\3056\3318V\321H\216\201\027!\252\307ay\347\254\225H1'.0[\344\337~\354\005\032\217\253\326\322\236\262\370\326v\005\237\\\216\005\241\341:ji\314\316\b!\331\261\245\365\330\357\036"
+	.ascii	"\305k\266[Z\253\310uw\357:\222\253\253B\203\361\233\0239\240"
+	.ascii	"\2706\257|\337U\316\347E\215,\367\373\335\343\r\315\305\353\206"
+	.ascii	"\313\362bE*\326\341\202KZ\024\215\367\232\265\264g\343Ztm\366"
+	.ascii	"K\206\\\"\2745\016''\272BA\245\022M\236Z\245\326)\222\324*uJ"
+	.ascii	"Q\241\240\250R\247\224\023\023\224SjU\341D\002b\225\212\204\325"
+	.ascii	"\311\202J\265:\231p\363[cGP\256\311\364\230\353\366\343\262\255"
+	.ascii	"pm\006\203\276\217\220\350V\323\220\177\013s\374\342^\347\241"
+	.ascii	"\214[LI+\027\346\273\347\373\026B\214M.\350E\215\036\347\234"
+	.ascii	"\023\\\233\031\264\220\034\373\232[N\364\330\270\001, `\202Q"
+	.ascii	"\320\312\003\016\t\214vH\240\257\034\213\233Dy\227\2323\256\325"
+	.ascii	"Tj\365\245\224\327\204\324,p\3723Va\214\247\2635\222\373\004"
+	.ascii	"\354\030\341\204\201\314.\272\276\256\350\267\340\275l\265\373"
+	.ascii	".\"\366\251E\221\350\202(\276\2610AF7\006\n\337\360\276\203\205"
+	.ascii	"u\031\026\360\315\3245^f\220]\215\337k\235V<\001"
+	.text
+	.section	.gnu.lto_crc8_update.7.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`k\004\225\036"
+	.string	"\346\370\305K\260\324Q:xp\354\331\034\037[2\246\310\017\\\033n\347y\257\227;\2221k\266Xz\314\274d\017\201\240\355\307\276\331u\200m\357\202f\252\264?\245?\245?k\3713\302<\027\331h\322i+T.\252#\220O\b!d\313\235d\264"
+	.string	"\251"
+	.string	"\262"
+	.string	"'2\224\303\334\253T\004\207x\232\362\344y\231\362$\327\372&\035\367\275G7\200\334KD\300\005\316\223\f\034\344Xw\242\213\2422\311h\210G\225{\211\263n\301\347O]\265\304\363\253uO_\350i\226\244\355\252\343\347\b\215\220\370\205xjM\021E0~\304gds\270\216V\227\332\325\227"
+	.ascii	"\026@\341Qk\022\371\226\374\210/\205\315\331\202\"\274\361\265"
+	.ascii	"\367\023\252'\013`\360&\212\227\257\037\212\223\226\200V\322"
+	.ascii	"\023\330\217g\001\034\0211\221\376DTk\374\200\021LH\300\340\373"
+	.ascii	"R'\223\\l!\001\205\257\346\204{/W\022?\340\271\345\314\314\204"
+	.ascii	"\231-0\333\006\001M?z\250\363\371\035\277y\342_>\352l\337t\356"
+	.ascii	"\263r5+\037@9D\353\206\311\275E]Wn\026i\025\343W\177\325\017"
+	.ascii	"\365G\3352\237\017\344W|#\247T\271O=\b3\356>\370V\275uU\345\336"
+	.ascii	"\373\252\363.\231NIF\2707\351d\021\246d9~\212O\305)\356?\330"
+	.ascii	"x\206\360\235O\305\021\307{o\005\034sz\362\3149~\217Kq\032\005"
+	.ascii	"do0v\205\212+\226(@\001\375\362|howt\274\227\210s\222#8\351\036"
+	.ascii	"\273;$+\036X\035/\346\276\243\003\243\367\"aQp\236\f`\2732\037"
+	.ascii	"\307s\344\002\262\006\021\244\342\035\355\314\036\336@\031\353"
+	.ascii	"\232\2269\341]\331\325\022:j\034\313\231ni\232\230\251\241\023"
+	.ascii	"2=\323\\\017<\246e\372\274+\261\216i[\320\310m\370(j\221=%L\337"
+	.ascii	"\212D\204*\027\307\032\246o\274\265\021\304\352'\"+U\266\273"
+	.ascii	"\366K?\310\255\214\340\323\320\211\335\2618h8\357\275\177\301"
+	.ascii	"\007*O\326\006!\244\352\t\203jW\315\331\342-u\017\273\354\263"
+	.ascii	"\253\022\036\215]\355b\263\337\037RP\031\312\022T\273\230\211"
+	.ascii	"\273\332C\346\233\273(O\270\225\230od\277:\333\324\320\234\225"
+	.ascii	"gje\231Z9\006\255\f\023{\201\275\352\354r\247\277%}<<\325\366"
+	.ascii	"\013>;6\353aC\315f3\374`\360\331\331P\352\374\350\\\260\264\033"
+	.ascii	"\255\231\226\200v\243\315|j==5\332\314\207G\247gF\273\341f\t"
+	.ascii	"d\\\263\355\334f?\265\332m\226\022\203n_\335i\3320\036VVP\357"
+	.ascii	"\322\036\362\263j\020\2410tiF\221Z\266\355\036\243.\315\266\242"
+	.ascii	"\335mO\256K\220\302\245\342e\317X\273,\270mX_\352\366(|\342\321"
+	.ascii	"@{\310f\023S\3267\376\254\302t\3248\267\351\036[\363\346L\302"
+	.ascii	"D\324/\035\353\336y6\2266\r\241D\213b\023\241\312e\357\275\367"
+	.ascii	"\354!/\020R\326\364\225\230p\2204}\323=\346\003\267\351U\250"
+	.ascii	"\201(d\bc\210\03032\001\321\210\266\325`\002\031:\264\r\021\320"
+	.ascii	"9U\343\264\035?\220\177\001\331yRv\275\rr\2367L\371\255\260\213"
+	.ascii	"'\216\224\316\020\001\215d\352\261kPL\274\375/\211\327\206c%"
+	.ascii	"\360\254rvtv7S<(\t\200U@u\0240f\204\236\325\352\331RS\362\r\t"
+	.ascii	"1\361\031\001mY8F\301\335\230\276\257Y\021D\374\202\221HT\020"
+	.ascii	"\257\005=\017\341\005\330\213\205\240)\266b\376\210%dVu\371\021"
+	.ascii	"\003r\221@Aa\035U\327\243t&\217\226\226\227k[\372\317\020\230"
+	.ascii	"\247\305\310\215v\302\340\215\306\364\225\226\334\031\317\337"
+	.ascii	"\324\007\027\246\333\374\001"
+	.text
+	.section	.gnu.lto_crc8_sbuf_append.8.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`\262\004\035 "
+	.string	"\346\372\314J\240\326Q:b\322\223${\204\317\370\202/g9+\370Xo\215\274\235\327+t\371I\022\3226\227\312 \233\237\201\301F\013~<6x\0341^\216\227\343\345\2708\f"
+	.string	"R\306Z\354\027\370\266Y\240m\021\377K>!D\356\224\002\273"
+	.string	"\255"
+	.string	"\273"
+	.ascii	"i*\225\364\251E\021Lz^\355\353\370\016\337\261H\234&M\251xx\245"
+	.ascii	"iQ\201\r\2407]<\316y\023\275\315y\323>\333\312\2130\322\033\253"
+	.ascii	"\226zpI\3234\267/\214\036\365\325\262x\327\326w[\215\206\316"
+	.ascii	"N\263\334\352\363\217\027\020\265\205Ixt[9S:Qu(NQ\345\017\231"
+	.ascii	"\030\362^\277Z\013\340\342\t\352\264r\326\3444\345P\234V\224"
+	.ascii	"?cW\240\016\366\032\024&U\324\305\323\3603\025?kB\0257K\002O"
+	.ascii	"\246\252\310\b\201%\217\324\022\0246\241R-\301>\240\204U\213"
+	.ascii	"\247\341\367^7\247\256\306Z<A\275\316*\244i\352\312$|\272an;"
+	.ascii	"\314\366\005\273\f\021\3254\267\031\231\230g\3750/\376\265k\335"
+	.ascii	"\264c\375\350\221\367\371\256\273\374\326\275euE\253\317s&\237"
+	.ascii	"\360\224\245\351\211\262d\352\304D\312\370\327\217\374\273~\255"
+	.ascii	"\177\313\037\362/\037\3146.\337\177\334\210\335;\021\277\310"
+	.ascii	"\2161\261\335D\226\351P\202\261\252\254\275o\031\341\"h\371\""
+	.ascii	"\346\303\367\262\255\313\303\324\225\005\364?|.\037\310\203\364"
+	.ascii	".\304_\350\221\023z4\226\020K\323t\002z\023@y\233\263g\333n\376"
+	.ascii	"=~\264\315\366\226\021\232\316\230\035\247p@\260\265><\005:"
+	.string	"\321\232\242\344\020K\323b\317M;\260\313j3h\340{\226\2217TVX&\316\356l\320Np\235\305\355\210a\027P\3527[\342\017\234\267\315Y\034\025`\362WMd\331\020;o\026fqj\270\226R\330\354\315\272&x\315\332\354\201\311_-\363mk\226h\330\344WB\214OL\241\223fy\306%I\225\314\267\245\331\203\275\274\032\036Y\372\262\307\246.D\312\335\357\314\336\310K\032\303\343R\212\337\225\200\330\200\372\036\316\233\337{\275LF5\tB!\325\262\375\031\003\316\330%\006=\211\b4MS\007>\222!\016\005`\304 q\336\244\355\314jI\027,\244Zf\027\177u\211\366g?,U\274T\366\016\356_\267N\016\016Z}SV\333\224\3255\264\274\"\242\r\n\252:\236n5\f\001\255Q\207\035QY\304\313P\3243\213z\032\326\272\005:\236.7\264\023\022\332\351rCA\031\204r:^/\267"
+	.string	"\347\035\021\020/W\264\333\361r\266\"\322\313\332n\f\006/N\220\366\347\231Z\027][\007T\317d"
+	.ascii	"J{\344\230\255\b\242\256,}\261-\3211P4\031\232\224\033U\265\266"
+	.ascii	"%\355\334\037\217f\271\321T}\243s7H\333\262\026v\nY\310X\324"
+	.ascii	"J\364\266\347\006m\237\227+\263\310\250#\300\032\264%z\0266\303"
+	.ascii	"\241\\\254\244\266\347:\033t9\333A\245X5\355\314\3366\350\257"
+	.ascii	"Sg\037\230xa\fK\252de\232\246)\272D\373\200\2359\373_\250Q<\206"
+	.ascii	"\210cdh\002\021\221!J\322\030`\002\031\262\263:\0210\262\234"
+	.ascii	"\222B\273\001*\362\345\241|\215\247L\215\302\023\263\306\342"
+	.ascii	"\223\220\232\270\025\0200\214\211'ZSRgH\240\264\315\305\241>"
+	.ascii	"\346\341\254K\023s\377K\"\353Q\377H\236X\344\f,\346\007\tK\n"
+	.ascii	"\220\204\354\321\212_\bf\263\351N\323^\202\336\246(q\272\261"
+	.ascii	"T\231\340\234\221\"~\313\356l\212\251\353\275w\301\344\202p\t"
+	.ascii	"\r3XA\017\225\033p\t\021\237\032xk\fqCj\366\204+\216#\254\001"
+	.ascii	"\250\344\302\243+h\330\211\326d\033\270\036\035\304\257w\031"
+	.ascii	"\355P\b\244*\233\243o\006\221y(\314\004F\3716\235\314F\322{\332"
+	.ascii	"!\3124\3107\373AH\023n\376"
+	.text
+	.section	.gnu.lto_crc8_xor_update.9.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`\306\001\375\020"
+	.string	"\306\340rF\360\320&\035\372\305Z\210\323\302TM\345\214\207\334\376ZD~{\367I\017;1\240]?\351\372[\372\230\242\321\244\300\365\314\254\355\245\323\361\303\342cq\030\352\202\320B$\333 \345\"/\257\311\272%\204\354-eJ\001^"
+	.string	"`"
+	.string	"["
+	.string	"\316<\316\312\272\033B\326b\367K\340\003\334#\203\006*\257\376\315\270h0\261\226\212\033\273_\247\"V\t\277\033\346\352\021j\256\374\020\020<-/\224G\270\255\270\320t\274V`\310\220\220\317eO\327\213\225\320\346\345z\331\021\300\202Z^/\317-\302\356:[^\034n\355\266K\266!\330\351\021\206\307\271uK\247\226>\200\255D\214\002,v]f8\366'\372\220\370\316\037{\332*\237\3472\217b&p=x\254J\316\212\232\007;&_\226\r\"\027\253Gh\367\373x\264\003\230\3429\252\353d\200\036\253\002\243A\001\367h"
+	.string	"j\332?q\024\252\177\016z\200\335\030\240\217\357\003\264G\356\002\264\307*9t\270\273\013\027\034*IQ\260 \325\324\221~F\253\003\353=\030N\334\b\337D{L\225"
+	.ascii	"\263\341\372\220\222\263T\036\027+/\3655\352\246)\203\305\004"
+	.ascii	"+g\326\364z\002\203\321\312\221\2223\373CI\225\261\03723$d\215"
+	.ascii	"\261I#\321q~\356;\367v\235_\373\367\307\307\036\250\217\230H"
+	.ascii	"P\220B\311\004\023\211\005M\244Dd\004z)O\355\201x)\2573\235J"
+	.ascii	"\245\223\327\231*\210\224:/u\241\003!\340\023\212$\325\225\234"
+	.ascii	"N\251n\364\3555\306\206PU$\322\216\226\315O\212\262\242\312\370"
+	.ascii	"?7/\224\244\257\271\241\311\250P]\227\235\253qCCGj\230\234\252"
+	.ascii	"\272l{S\250'9@\001\" `\002!\265\316\001\226\300\304C\237\265"
+	.ascii	"c\263)\324\312\362v\024\320'fZ\264\026Z\2033\267\274\273\232"
+	.ascii	"Z\301= \324\236#\255X\2348!\300\340\003\tt#\260\303\2572\372"
+	.ascii	"\262N\303:\302Z\324\355\263\335\330c\310\232\t\224m\371\371r"
+	.ascii	"G\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.10.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\355\021"
+	.string	"\026\342vG\360\320&\035\373),\346\r\314;BX\036\256\003\267\335\214\262\257\032\263-\257#d}wDiY\275!\215\242QF+\260\235\256=u\324\260l\"\233\031.S\324T\177\240\227'\016\007\217#E2\215\020\262\267\334)\005a"
+	.string	"`"
+	.string	"e"
+	.ascii	"K\343\363\263\033.\260\002\356\323\341\th\237\334\007h\237V\331"
+	.ascii	"7\036\332\354y\\\274\300t\354\256\247\036TQ\206\267\214\252O"
+	.ascii	"\251Q\345\303\236`f\250\365b\371\224\033\013\346C\200\027K\222"
+	.ascii	"\030\025\001]\366\350z\255\242\024\021s\275\354\0372\263\326"
+	.ascii	"+\346q\203\260\273\216\255\227\206[\273\355\223\355\007v\224"
+	.ascii	"\0207w\235\177\233\217\335\362=\267j\321qF\037\300\326\"\206"
+	.ascii	"\201\031\2730\263\035K4\201@<\366\357\374=W\373\366U\3702w\261"
+	.ascii	"TK\306\220\003\356\363\3479\314\235\031\214\250\336\243\302m"
+	.ascii	"\210-\326\001\306\310\316\205\257K\006\222k%T\264\033\202|Z\304"
+	.ascii	"\216a\252\006\310\243}\024\317Q]g\345\0026\352\342Tj\034\301"
+	.ascii	"\363\002C4\272\334\335\225\"\227\352\241/!3s!\261\2123\253^;"
+	.ascii	"\275\215\227\r\253\263\260\240\302\371)\355\363z\331\345\317"
+	.ascii	"L\314\305\241%\316TcA\254\227j\215M\367Iq\273\333\300_q\252p"
+	.ascii	"\200\306\315\212\316\0248L\350\264\304\231\035\262D\255\261O"
+	.ascii	"bcTd\245\261=\272\207?\351;\001 \352\244\037\370\251\t\312\211"
+	.ascii	"\242\300\022T\312D\245\230\250\277\220\017\374<\024S\251d\372"
+	.ascii	"<\224\t%%\357\003S\274\220\0026\235N@\017e2\201^\027\356\245"
+	.ascii	"T\235\021\202\210Zt\345.F\335\324\246P\212o\031\001KY<5~\314"
+	.ascii	"\004\275\034M\255qw\342\006\347(\222T\252+\307E;=\354\\\016\034"
+	.ascii	"\241\350\253h\032) \220\202\231\301\333\001z`\217a\310\276\310"
+	.ascii	"'\317\013\036\023\206\212MZ\267\313fT\203Co\314\261^\217\\\236"
+	.ascii	"\021\203\001\360\022\262\260q\245d|\365j`\023nme\2650\303\334"
+	.ascii	"\321\004\351La\200\302O\230d\330\003\024\004\301Y\315+\315\r"
+	.ascii	" J\275\307\2235f\200\312\203\374R\356\\\353\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"E\004"
+	.string	"\364\0052\001"
+	.string	""
+	.string	""
+	.string	"\002\003\177\t\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\n\354\363\203\007\005\177\013\006\177\f\007\177\r\b\177\016\t\177\017\360\372\250\n\177\020\001\f\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001\013\177\022\r\177\023\003\002\t$\003\002\b\344\016\003\005\344\013\003\007\n\360\372\2508\001\304\006"
+	.string	"\020"
+	.ascii	"\007k\b\353\b\335\264\003\324\303\007\310\357-\265J0\\\366t&"
+	.ascii	"\016\314\020\320\016h\207\004\332\001\332\001\334i0\307"
+	.text
+	.section	.gnu.lto_.refs.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cc285e0f764884ef,"e",@progbits
+	.string	"(\265/\375`f\013U;"
+	.ascii	"JfP\026G`\\R\007\277\002\252\026\242\202A/\226\242\n*\027\213"
+	.ascii	"pZk\275O\331~\\\211\350d\213H\312\234H\332b\3707p\271\215R\035"
+	.ascii	" \302_6\204X\3767\374H\200\345\367\325\320\345\352K\220\\%\242"
+	.ascii	"\332\"\224M\246\0241\001@\001^\001.\341\327\233N]\302\257\333"
+	.ascii	"\261\\\341!\302\345<\342\\\366\343Rc\314\360p\356#\265\212\223"
+	.ascii	"\271\353V\034\332.\346T\372\307\375'\373\377v\2571\177\006X{"
+	.ascii	"\376\267\276\232\377ng\350\026Z\361)\376Lpd\337\210ET\007\325"
+	.ascii	"\305\246\356\337\375\2310!\037\303\334\322~\271\207T\177\367"
+	.ascii	"\371\005\205\324\246\240v\273\224\247\357\3752\007\346\371\342"
+	.ascii	"55\250\343\363\344u\345\331\341\334\355a\335\376\304\275\334"
+	.ascii	"\331c\241\332\207\376\273=\275\031_se8\373\227Cq\027\310\243"
+	.ascii	"4\206\r\335[\235\256\327\277\013\334\231\232\022\322\342\334"
+	.ascii	"\017\324v\260\016\340\374\r\215\325v\240\237O\035\350\327\256"
+	.ascii	"\373\374T\037\360\303\006\272\261\001\b=\326\335e\316`7\316\241"
+	.ascii	"\323\351v<w \355\366 \003\002\013H\270\002\217\"\300m\247\333"
+	.ascii	"\315\272;B\267#\350n\022\276n\237\322\355\007\272\335\247\333"
+	.ascii	"{\272}\247\333\001t{\356\356\274\356\246\353n5\335\355\326\335"
+	.ascii	"k\335\035\326\335I\335\235\326\335\\\272;Aw\277\335}\245\273"
+	.ascii	"\237\335\355\354n\002\335\215\326\3359\323\351t\332\355w\335"
+	.ascii	"^\324\255\332\005oL\376\177\r\237\373\311\343N\273\317=\250\233"
+	.ascii	"\307{\356\240\273\363\367\332\247\355\277\352\307\234\312Uf\324"
+	.ascii	"\201sw3\370n\362\277\366\274\373I\366\315Z\331\347\030e\217\373"
+	.ascii	"X\005\376\335z\326\315R\346\366\361\273\357\217\314R\276`\335"
+	.ascii	"6\311\272\355\032|d\273\376\273\312 \0135\256\316\276YJ\366m"
+	.ascii	"\225=\217\374\365_#\226\212l\225lZ\253\f\262\257Q\311\"\263\224"
+	.ascii	"=6~\364\320\361\224\345\344\341bX\344KE1\215\311`\224u\333o\373"
+	.ascii	"wh\323'\035\3743\333d\233\021\207_9F\245\216d\306\326\335\377"
+	.ascii	"7\020u\324j\037\031e\223\264\377I\216,>J\303\352F\037\210G\327"
+	.ascii	"-\346C5\375\037\210"
+	.string	"\372_\375\243\377\277\376?N\222\351\376[\005\331fT\324\377\362'\352\231+\226\246\177\f=sE\311\276Z\255\020\213\224\267\371N\356\352\315o\313J\252\357\032\345\241\376\337\345\324\246\222j\r\316\336\305\275\270\033\344_\332\321<\255s\220\356\2779e\344\256\24083p\237_fR\333\203~\300\351t:\365\240\237gq3w%\270\226\366-\316\245}F\367\335\177\027\210\205\340\211\205\341\034t\237\037n\241vMMx\206\200&\216\024-\250C\215a,~j<\203GI\222\314\027\316\230\365wB\263i\2063v\262\302\217\037#}\351!\254\310TM\372\205\217\215\221y\312\032\305\016glt\351\316\226X\031\026\316x\365\247\257J\213\323\033~r\343\306\363B\254\351@Zc\343\f\257=\317\267\0061{\342\354w~U\305\211]K\227\177\365\206\263\277q\265\336\226'W]\360\344\344\234\316?\371\277\354\200$/\016"
+	.ascii	"\223\035uU\332\264\323\371\253#\255zZqv6\376\346\224\2219\315"
+	.ascii	"\001\001\233\242i\311\327\247\325\006\256L\356\255\337\\\215"
+	.ascii	"\032\374#\034\\\234\017m\f\013\027\327\256\246\323\364\246Tr"
+	.ascii	"x8;\234K\335\332.1i\032\235\246\225\034^\031\316\215\343\233"
+	.ascii	"3\234\3218\364\252\306\020\260g\317\351\305\006\f\215\215\315"
+	.ascii	"\335B\374\177\357\177\207\227\346/\227A\275'l4\306\332\332\335"
+	.ascii	"r\216\330]=\341\354f\374\314\367\362\370\362\006g/\323\322\""
+	.ascii	"\262I\227\253\375\300L\335\275\201\252\355`<L{\324\365\250\257"
+	.ascii	"\251\353\377\352\376\224\006/\032P\352~\311\f\002\336\240\322"
+	.ascii	"6\031\323\276\326\215a\203\237\355\374{\375\177\002\237\232A"
+	.ascii	"\227\006g\027\343g\001\256\216\230\271\341\334l\200x\336\254"
+	.ascii	"\220\t\203s\273\226\332\270\373\027D:\304\342\b\234!a\211\243"
+	.ascii	"\"\022\321\304\016\001\242R\f`\220h\330\302hXD4$\016sR$\035-"
+	.ascii	"-\031\0258*\032\245Xb*\022\320?\305\"\322pX4$\034\022\207:=D"
+	.ascii	"\"\036%\035\255P[\303P\205!\242\0308M\304\341\002\207\013\277"
+	.ascii	"&\342 \024r\030\022\252=$\354\025\2130d\030\022\252\305faA\005"
+	.ascii	"\023\n\027FG\304\"\f\005\255\264tD\024**)\021\205tR$\035\365"
+	.ascii	"`\024\251`B\001\343G,.\365\212ED\305$$&\234\026\n?0(!\002\204"
+	.ascii	":\2640$\016\205\222\224\\\270P\032\n%!\031\271\020\032\022a\b"
+	.ascii	"Y(\320\003[\265\2712\2023\326\322\320f\341\255\306Z\355b-\340"
+	.ascii	"\335\277\321\275\001\346\"\243\312\373aa\245\024\023\251\023"
+	.ascii	"nqU&\"\026\235\013s\2729b\206`\205\301\0313}:\275c\002\331\267"
+	.ascii	"\3757\342\035\370\2521\263\275\201{\003\340\t(-\250_\306\201"
+	.ascii	"\003["
+	.string	"y\320=\302Q\211\3635Y]O9\032[\t\001\323\243\006\316x\351\322,\203\353\256\325BE\205\253~\324\367Jr&.G\215\f\331\227\215\306U\376\304q\316\265\255R\022lg\302\220\251XJ\n+\335\251`\254\211\331\344\177\031\244\2635\366\266I6V\026qS%\2123\236\362%nR\254\3162\030\327\322\007\030\024\224\253A\003\352`\323R\027$\200\366\250\2418F\034$\"3#\"\232\202$\351p\002\221)\263\316\001\021\240)\223Jf\222\244\320n\370+x~\216\220q.\271\201\3245E\231\314\3138G\347\264\253%0\240D\255a\231\005c\317\225\331L\212\344\332fq\340\032m\006\026\031\241\036\006\263[\2105\355\334\244\r8\005\026N(\270\033,\272\3036\020\336\001\234\0241\020\221*\005\006\251\262(\345\3300\323mG,p\337E,\306\303\312\2566\232\351\200f\210\254U\367<\341B\016\274\330\310"
+	.string	"7\320k<1\302\020\326b\327Th\316\223\007\260\333\333fub\0316\314~\250\276\"\235\270m\240\334A\355\013D\223\270Y,\302;\320!\373\330[\312OS\313v\020\340d(\005\245;Z\374)\370\260CR\217\204F\363>\033\317\320\321Sb\001\3114\316\274\344\020\027\006k}c\320\374\025;d\255\340\004\316I9\030_"
+	.ascii	"\216\303)\004& \354X\346b3\246\261\017\266\234=\232\213[nUo\r"
+	.ascii	"\023\246\032\345#\304\017\352N\201t\361\253/h'\220\244?L\307"
+	.ascii	"\2008K\315\3137\233\354c\222\227L\244\334p\274\023\201\252\226"
+	.ascii	"\"\265\246\307\230>GI\335\250\375`J\226\022T\033.t\342-\252\223"
+	.ascii	"\205t@\303\377\007\372\312Pb;MZ\356\314\306\341\3635\242\277"
+	.ascii	"\352b\214\274\235bkd\276\324~\363\004\377\276\r\002\374T\273"
+	.ascii	"G~\024\342/\377\302\375e?\273\331\336\016\356\376\357\017\227"
+	.ascii	"\260b\377\340\247|T\344\302\373=W\307\365\237\030\376\177\375"
+	.ascii	"\263o\373\347\373\203\351\374\226<\021X\255\216\350K\3647\373"
+	.ascii	"s/\177\030V\035(\367>\030\267:~ \234\353b|\303O(\250\371\247"
+	.ascii	"\275\005\3611\212*"
+	.text
+	.section	.gnu.lto_.symtab.cc285e0f764884ef,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"crc8_calc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"crc8_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"crc8_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cc285e0f764884ef,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
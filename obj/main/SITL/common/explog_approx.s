@@ -0,0 +1,287 @@
+	.file	"explog_approx.c"
+	.section	.gnu.lto_.profile.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\005"
+	.string	"\255\350\377\267\003\004\002"
+	.string	"\001\315\266\304\242\016\002\240\342\234\212\n\003\261\252\331\243\006"
+	.string	"\004\266\245\265c"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\2016\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 35\001"
+	.string	"\320'"
+	.string	"\003"
+	.string	"\001\003\003\004\002"
+	.string	""
+	.string	"\001\003\001\001\001"
+	.string	""
+	.string	"\002\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"5\005Q\031\374\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 \323\205\003"
+	.string	"\022F\022\033\220)\351{\333\363S\025\3538\331\366\"\341\371\310\335I\330 \351\303o\216l\271S\"\026\022\230\030\325\343\017h"
+	.string	"\2369\376\003\343o\250D\235\201\266p\220\177`\031\215s\212\375+z\266\374\205Ri$Yg\223\237\240e$\017"
+	.ascii	",;)\006\240M\300\b\367U`\254\320\202\346`=p\254\b\tz\232\307"
+	.ascii	"\312\214W\026\313e\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 4]\001"
+	.string	"\004\002("
+	.string	"\003"
+	.string	"\001\001\003\177\002\001\003\004\002\001\001\016\001\002\001\177\002\001\002\002\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"G\205\2442\316\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\003\200\004\004\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 0%\001"
+	.string	"\300$"
+	.string	"\002"
+	.string	"\001\200\007"
+	.string	""
+	.string	""
+	.string	"\001\002\001\001\004\002\200\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"9\205x\336\335Y\277\001,"
+	.text
+	.section	.gnu.lto_.lto.3802a7b8dc3a75da,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_exp_approx.5.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375`%\003\345\025"
+	.string	"&(\215J\300\020)\0353\332\330\026k\241\r\216\330k\244\003#@\271\036\377\375\205h\353\346\352\357\202\324\274_\330\027"
+	.string	"\300\372e1\243W\355\252*\b;\334\"\b\202B\241\207ai\341\037\202\343\235\034 \210x\377\303q\302\276\265M\344N2w"
+	.string	"k"
+	.string	"|"
+	.string	"\272=\213\033\035\351-\236\264c\020\304\003\240N\203\2435OL,)(ZS\354\340\177\250d\250\3742\210\035t"
+	.ascii	"\344$\325\335\002^7\301\353\225\236h\315\205u\307\bZ\352\356"
+	.ascii	"\001[\340\365\272\273\373\241\253\320\355\232\0206\2146M4HV\335"
+	.ascii	"M\236\\\326z\025\037k\275r\317u\247\272\375\223\216\322SU\203"
+	.ascii	"3s\352b\320\335Kkp:|\371\273\033`w#\354\362\2106P\275\0044t\357"
+	.ascii	"PD\370\254\342\303\213\002\372x\364\334\375\315P\016\261{\261"
+	.ascii	"\231\247\344E\337\331\177_\331\217\276$\007~c\017~GN\364\213"
+	.ascii	"\234n\310\351\202\234\356\307\351z\234\356x\272\035\247\013;"
+	.ascii	"\335\327\351\272\230n\213\351V\246+\236.\237.=\335\233\210'~"
+	.ascii	"\256n|\310\324}sb5T}\341\363\337_\364\037\375\300?\0305G\371"
+	.ascii	"\363\304ahg\301yN\315\370\305\207\3213"
+	.string	"K\037/\347b\025\253\234\025Mw\201[\363\325\335+3\256@BM\273\312-f\0344\036\370<\317\312U\304\f\027\326\016[2\026\271\226L4=\022\2261\1770\313\247\0303\223P-]`fA!\324\333\321sG\230rl\352J\027\256\271/\261\030VH_\363\272_a\353\2252\213\317Uo\227\325\335+\347\021>R\231c>h\030\006j\264\234x@\234\360\027\0045Z\256\326h9\336\226\024\031\033\356v\243I\240`\253\335d\\\310\030\033\f\214\255\205\214y\241\301\220-\270\nd\n\200\265\335\\p\244\005\233\rG\216\277\276\330\314S\302';\346m\b\273\270\204?,};\243\024-\202p\bW\245\017\006\341\221\251J\207\206\215_\226\007\177p\035\216\354\301c\324Y\372H\bk@au\360\310\325\251\314\2311\214;\330\304\250\364\335\004w\244^\f\343D\250aHE 2\310fD\202\264\240\240\260p"
+	.string	"#\231\0337\020H\246\316\2445\310"
+	.ascii	"\274\344\013\300P\033\024_ \272\261\341%\026\371F\024u\355\241"
+	.ascii	"\365\365\274\213\231\rM\335\215\336\306\276\340\265b\341\037"
+	.ascii	"\037i\261\346\032m\007\221\020\031L\344/\026A\260\020\273;\024"
+	.ascii	"\034\203r\337H\275\314\221\026\357\316\351s\223\374\316\246\030"
+	.ascii	"\"\370\300\247>\213\"\312\215\300\244\345\202F\"\2538S\027\027"
+	.ascii	"\030\223+\001\210\326\316\203T"
+	.text
+	.section	.gnu.lto_log_approx.6.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375`\260\002M\025"
+	.string	"\326\250\216J\300\020)\035gP\017\264\246o\202\332s[3+\203\302\276~\004Q@{r,>gq \243*\264]\030\001d\277\216--jWe\006b\2001Ea\317\335u\322\207\033\0252x>\246\267n\374\267\373\333\320\377\215\020\271S\nw"
+	.string	"m"
+	.string	"\202"
+	.string	"\266\2036Mr\214\024\2246Y18$5\302\336\260\326z\340\243\023\260>\322\013\331t\253\326\027?F\265V\024#`}\264\355\2478\020\3166\305rD\211\317\310\231!\202\252\265\316L.S}\024\017S}\\\021\307]\\\212\363/\274\201\336I\263\213\271\310\373\212%>%\336k\247\023\t0\355\330\270\360\264f'C\351\312A\255\325\224f\307\341\036o\033\202\355\005\366\n\b+!\307\211\234\322\321\323WA\301H\254Z+\003\330\226\330\f}AI9z\332e\f]\036\373b\255\265z\177\262\227w\214R\303\036\274G.\364\213\234:\344\324\257S\203\234\372\343\324\256S{\234\272uj\326\251W\247V\235z<\265H\251\227RSJ}\222\00787\276\240"
+	.string	"f\2557gT]\032]\230x\371\007Om\234?t\241]\001?\275&\262g\265\254}\021\t\304Q\362P\251jW\273E\244/\266\343\252vo\220\300\0165p\350L\211;\356\201zNd\217\316\374\024\215\247\262\272\301y>\311\324\232;\211\255\270\353#C\327\264\002x\263\031\333\tG:\222rQFR\321\335\025\211fx{\236'\335q\350H\327\304\342\203\216\236\242\270<\364-r0\351\354\376l\332\246'\"\033\301\346\024\306\220\241;\374\035Y\025r\b\340FR\301\366\001\265[\313\336\356\262\242a\315\222r\243\331j\265\225\n\026h.\265[\313\f\206\366\362Bc\231\301\\Xy\231\261\3300\314R\006\230Vk\261\3152\320h\266\231\253\254\027\353\376L\267"
+	.ascii	"l'\304\214Im\376\004\324\320\322\353\027\2625\266ek\222[\235"
+	.ascii	"_\373\261\262E!}!\013\262\257\275\024\351\363AA\326\221\005\331"
+	.ascii	"\363z'\tt\355\307\2520\r7x\254k\251\024\351k\255\307.\f\020A"
+	.ascii	"\022\245\310\332\326>1 \260\002\021I\353\300\031z.Ce\323\261"
+	.ascii	"\215\375J\254\335\232d\321\231$@@\240C[\214\210\344q\271Py\347"
+	.ascii	"\r\305\2303\223U^\212\346\005\027\322\021\360\"\211g2L\252\313"
+	.ascii	"0\003\262\317\220\354\336\312\374\tKH\217o\252H\026\203\2077"
+	.ascii	"\266\216\325\335\3215\2703\340\3554ec\3003;,359\\\001\316Sos"
+	.ascii	"\212\266\366"
+	.text
+	.section	.gnu.lto_pow_approx.7.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\025\t"
+	.string	"\306Q?9@\345&\035p\321e\247\346'\343\361fJ\"\215\b\334 \376LO\023d\260\211r\033\204\222\202\372H\240M=vZ\3311\fO\365#X0\342r\037\276\374h\t\331R\246\024/"
+	.string	"/"
+	.string	"+"
+	.string	"\"#\227Y\321H\t\260\273\220s\002\354\327\373"
+	.string	"\366KC\276=7\377(\177)\017"
+	.string	"\246\023\367\3240\354\256\323t\342\270\365\266\017l/\330f\005\351|\372\032MGL\301\313\356F\213\2650W\013\211\355\315\336\330\235\212\302\363*\257,\260\353\222b\331]\004'\004\374\262\355\233\374d\263W\257\013\024\230rJ\312\371\322k\352g2JH\331\362\313\247\266\305E\336t\255\370()gw\\*\210\375\267\212\262\237\306\336\375\327U\377{\016\367\334\237\316(jY\346ix\210\021\331\b\004E1\024\212\037(\202\360\204\340G\223\200\035\003\307\f\244\301\211\0305\270\351\366o\025\205)\007CI~\231j\007\r"
+	.string	"2\241\001(\260\344\013\265\241BqM,\317B[L\200\300\b\310\007\206\005\025\332"
+	.ascii	"TFS;\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 tm\002"
+	.string	"\304\003p"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\003\003\201\204\001\004\004\002\006\177\005\002\007\177\006\003\004\003\"\003\004"
+	.string	"\200\200\200\200\004\001b"
+	.string	"\005"
+	.ascii	":\207\261\223&MQ\002\020\217Vy\002"
+	.text
+	.section	.gnu.lto_.refs.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3802a7b8dc3a75da,"e",@progbits
+	.string	"(\265/\375`\271\003\005\033"
+	.string	"f3\262H\260X\325p\314u=oZ\004\314\234$9\264\020\210B\355\272["
+	.string	"\371\262\262~\252\226\217(d\373\377\n\320)\377\266O\271\005\362\177u\311\226\224\215=\214\207\217\235\227\253\360\354\r\355\006\210+p\371p\370\t\347w\333-S\214"
+	.string	"\226"
+	.string	"\245"
+	.string	"@\314t\325\377\tn5\031\351m\301\023(\375\201j ~\n\245\032\374\317\006\313\031\272\367\350\374\n\256\376\267\277\334\007\377\227\377S\250N\375[\270\234\274\333\355\317!\270]W.\351\374\242\357\t\020w\2562R\327R\321\312\373\216Z\356\331\223\236w\341\016%\327\262\367\236\377;\205\344\341RH\021G\265\t\030\343d\257\317\006\333L({k\266\201\266\221l\037\331.\262\335\263\255\301v\006\333)\333Gl\217\303\341ph\273\204\355\035\366i\026v@Z\264Q7\321\377("
+	.string	"\250Gk\002\274"
+	.string	"vc\354\001{Z\230\237Z\324\227AT\310\033?\323\2058\332~\271m\257\3547qW\217\262X<\353\016\367\023\371|\235q\326\327\335oK/\232W\217s\271m\207#U3\312\251\246(\353\252\211\336\226\226\373\035z\372\314\222u\256\273\222u\252;\334m/\367\264\021\375\264\2458V\220\272C\317\325\304\271\234\353\016\3073Z\242\204\301i\373\211\233\316D]\202\247\232^\370\257O\347(\314\257KQ\241\351\263\300Z\360D-\342\270J-J=a\215\037\022\ti{{b\302b\307F\320s\272\230U\213&Fx`\220^\243\335\243\243$\002T|/\220V\220b\203Er\305\204\023\242\335\325^\037[\264C\273\372g\325_\004\b\357h\356AK:\314\301#\216/k"
+	.string	"5n\001\224\267\207\364o\207\266\005\333o6P\371vM\2518zw\254\220\227\307\016-\217\355\251r/\257\034\350A)\312\202\345\271\\\314)\t\223\025\025\253z{\266L\005\377\004\374B\377\027\254\321\023%B\304\321U\374\263\255Z\034J:~\210\243{8\204\371W\260\f\0319\035d&\344\340\330\244H\304d\253\225\214+g\304\2134\214c2\330\254\225\023\213\315Z\001\354r]x\341\240\001\003\371\212\360!&BF\203\265pb77\261W\013\307\306\303M\3535\033\321\212\300\200\026\233\311d\036:\310h\260\225_63\030\016\354\003i\n3\020fhh)\323\324H\250\221\2002M\215\313U3\343\"=\343:\025\261\227\3106m\357\344\373U\326\352h\030\005\2128Z]\003(r\013\2406\310\n\331!\017Y&\253l\352\327\377-\373\323T\376"
+	.string	"\221\264\324z\b*)i\201\252\037;6\202\006\b\031Y\302\362\363\002\307\030B\0264\002A\250\2410E\034$C\"\221\004#\022\310\220\324\001`\002\221\242l\036\021@\036j\223T\332\377\r\345Oj1\235\342\350\215\243\355$#U\300\355o\032#\201*\373\211\207\rUu\216\204\376\363\212\204\367\360\353'\007\0357"
+	.ascii	"\243\360]\211\227\031\026\333\344\240\345\344B>\246kqX\3305a"
+	.ascii	"LS\262)W\361\365ELak\200\231\373$\353\233)b\226}\027\242\326"
+	.ascii	"T\222\3030x\252|v\354/)\255\362\332\207\2267\374\371w\365r\220"
+	.ascii	"S\363Vv:\364\227/\r"
+	.text
+	.section	.gnu.lto_.symtab.3802a7b8dc3a75da,"e",@progbits
+	.string	"exp_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"exp_cst1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"exp_cst2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"log_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3802a7b8dc3a75da,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1565 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\214\003\315\016"
+	.string	"\224\023\200\004"
+	.string	"#"
+	.string	"\203\255\266\373\b"
+	.string	"\001\356\361\330\337\f"
+	.string	"\002\321\307\201\370\r\004\002"
+	.string	"\002\001\003\353\220\276\200\006\002\004\263\311\277\326\001\006\005\372\202\264\222\001"
+	.string	"\006\225\344\315\256\n\002\007\212\334\340\211\007\b\271\232\305\245\007\n\t\375\350\224\301\013"
+	.string	"\n\353\201\255\347\007\b\002"
+	.string	"\002\003\013\345\325\337\232\t\003\f\312\333\257\274\f\016\r\211\337\230\303\004\016\217\364\362\333\n\020\017\225\326\304\223\t"
+	.string	"\020\347\235\302u4\002"
+	.string	"\002\005\021\222\347\327\201\t\b\022\334\234\272l\023\234\367\206\316\n"
+	.string	"\024\302\265\230\372\n\032\025\224\247\235\304\016\034\026\243\352\335\360\007\022\027\270\232\233\257\013\030\002"
+	.string	"\002\006\007\007\007\007\002\007\030\210\347\254\275\007\b\t"
+	.string	"\002\n\031\306\201\267\277\n\004\002\013\002\f\002\r\002\f\032\350\243\231\322\004\016\007\002\007\033\276\202\210<\016\034\205\341\214\231\003\024\002"
+	.string	"\002\017\017\017\002\017\035\240\364\236\306\013$\002"
+	.string	""
+	.string	"\036\250\203\377\344\007,\016\020\002\020\013\037\267\320\322\347\001\n\002\021\002\022\023\002\022\002\024\002\022 \332\256\355\220\007\022\024!\211\316\374\230\f\b\002\013\002\025\"\222\236\256\375\007\006"
+	.ascii	"H\250a\271A\202\031\034Q\005)\2441p\202SU\235\003\022 D\031\310"
+	.ascii	"\203\306P#\204&\230\t+?\023\266v\003v\376\357\263\361\204J\257"
+	.ascii	"^t\375N\314\206\236vFz\226\353q\306\203\236\206_G\251\264\273"
+	.ascii	"\036\320\365\220\360\230'\326\345<!\321g2C\007\237g\336\0027"
+	.ascii	"\272\367\237\376\212\331\236k\nK\244\325\231\024u9k \177\325"
+	.ascii	"vt>\321%\271\215\352\314\327\261M)\033(\373\177\006\032\016\004"
+	.ascii	"\306\321\027q\274\346\3024\364\034-zs\032\310R~\240\373\270\203"
+	.ascii	"\322\366\270]\367{\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\371\001\335\007"
+	.string	"R\b\034&\2205I\007\377\377\377\377\3779#\315\314\314\314\354\024!\204\020\242\331\377\357\267\377\377\355\267\326\3156\322\b\331r'\031\274\0055\202\001\204\n\004\274Vc\316b\220\231\001(\321\235\027Q\220\307\216#\277u\237\265\215\004\225\306X(\024\346\340\204\017\233\0301\231&o\262\223\257\376p\221\375\352\251\241\316m\312,\027\224\256d\225z\335z\023\rh\t\001H\250\240NR\222v\003\340\202\021\032\262\003\022`\263 \b\205\321\261\260\260\260n\375\317\021\036Y\247\234\343\375D\247S\n\236\350gs\354z\023\002\326\237\252\201\250Z/JHl\341P~\313\016G \262Ae\032\351\311"
+	.ascii	"\254\034\034\242$\2117@\326E\316\224\235\270*I\235\b+\210\325"
+	.ascii	"\370\223q\306\025\362\301@)?\255\204\262\031ch\245\001W\t\217"
+	.ascii	"\217\301\310\205!}\004\202\274\340\355\270\360\334\214\223\354"
+	.ascii	"\372\005\273B\211\001"
+	.text
+	.section	.gnu.lto_.inline.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`t\016\345$"
+	.string	"\326\251\205F\360\316(\035\200\036\020;\362\234\336hz\372:k\313g1\323\264F\223\336\020\233\302\bX\001U\r\254J\347\344\020\r\321\366\244<\370\r\\\306\032\334+\305X)v\021F\326\024\273\261?\f\334\242\375\333F\332\226i\247h"
+	.string	"n"
+	.string	"s"
+	.string	"\016vc&\2230^V+%\255V>\034\036\211\276\207\354\226\324\r]\240\270\245\333uR\264\352\324\245\340\356\222<A\241=\325p\373\244\334z\311s\372\322\322\237\235\252\325\365\013K\220\315z\324U\235\266\367\375>\376\310\256\347\354\256\264\264\353\341\356^\236\036}\353\353+\242\375\315f\260\2731\373\266\266\276\273\2536"
+	.ascii	"g\300\002g=\242\230t\0357\262\367\020\1777g%\214`\027\262\276"
+	.ascii	"\024\345\022\310\341\r\253\310l\2669P\216\206\212LT\333RZz\212"
+	.ascii	"\341\351\351\035\234\2349\357\"\216\3650\256?\316+\235j\330,"
+	.ascii	"\247\260\273 \"\333\250\307\217?\332\216\0046\324\027\310\315"
+	.ascii	"\312\222bnJ\335O\306\211\275\222Y\322\234\317\371\007\356\221"
+	.ascii	"[:=\355\305T\236`)(\262\003\037\021e\273d\326qxt0\334\247\371"
+	.ascii	"i\206\375R\331\356\n\by\2456\231`\347@\223\002\204\312'\177\376"
+	.ascii	"6;J\004\312bc$Hv\202\323\200\261\006]\274U\301\037\310,O\211"
+	.ascii	"\312c\233\22131\366\376R\300\336U\336\217r\334\260\233\326W\207"
+	.ascii	"M]L\nm\375\216\304\007E7\273+\342\216\021\332i\271]\177\356\372"
+	.ascii	" \332\266\273\376\327\217\2640n\\\007\216%(&-)E]\352\321\245"
+	.ascii	"K\342x\023:4*\216\242F\326\"\344\302V\273B\215\254E\312]|\b\362"
+	.ascii	"\030\243\343\3537#\266\210\020\007\335r\b\033f#\006L\265\266"
+	.ascii	"\374\202\004\034\017\001,\362\035f\302\354\314ld\206\235\231"
+	.ascii	"Mt\371\204\017;3\003\033\351\321\036.\267 +\021\341\304!\321"
+	.ascii	"\030\362\323\275\271Q\312\365\016\265ZO\310\206]C\255\326\003"
+	.ascii	"\323Z\255\306\323a\220\221\355\372\206\232T\001\2010\2501E\347"
+	.ascii	"\320\210H\222$"
+	.string	"i\r\361\004\204!\245\234\223\364\022 cQ\f\310A\204\020\031\tDF\002\tFDAI\222\222TZ\003D\261\262\3434\\\030v\316\370U\343V\315(\316\370\201\3336\264i\336Y\021\305j\335C\220\233\3039\205\2129\205\315\250\266\347mQ\270\302\034\364\315\212\221\354\271\210\326J(\242\366,9\311\232\311\333>\370\253\316h\376\312\212~\261\321\220\367\200\222^\322/Q\240\313\273\232\037)\007\f\025\302~\223\203\327\256\304\374\222usK[\304C\210&\317Ch|7G\360fB\313\243u\023\346Q\252\371\306\334 \273\231\247\223\0373\262g\253\3374g\264+\345=P\225\273]Y\273\261& \221r1|[;\237v\241\302#\006G\023\241\341\247\210\302 \376:\356\3266\233\375O\371\2601\324\037\034\356\250\256\377\355K%\265lc\207\345\205\001\370-FR\345f\307\215\"m'\343\234\371\002J\004>g\306"
+	.string	"4\332\323{\262\216\376\313\007y\004\343-\264G\037\024\024\024I\242\375$/cw\301\351\200\342\265\2700\035\210\270\210H\340H\312\202\270\265\013rK{\310\001\201\253\022\003\267u\234\370\3514\263\344`|\265AdFO\030\264` \233\303_q"
+	.ascii	"2\253\327\263[4\232\305T\310?\002f\263\237\350\036q\022\311\273"
+	.ascii	"\021m\350h\323\244\n?i-*p\325\350sN\321\2312zw\365VJ\0235m\243"
+	.ascii	"_\316+\343\310\013\r\027\364\n\374\336\314\376w4\247\026\373"
+	.ascii	"\325\216\324\232\207:\353X)\303\222\2212\205i\250\\\013r\027"
+	.ascii	"\334k\0175\374\364\240\261\301\243\036\017D \305\301 \334^\006"
+	.ascii	"~\231\2650^G\220\326T\372p\312r\r2\215c\nd\3671Q=2\351\363\b"
+	.ascii	"\300i=oY\216\3578\0267\f\030q\311\241(\361VA\262\334@\273h\032"
+	.ascii	"\225\357\307\210492\321\351r\351\3458N\262W3\032\357\204\347"
+	.ascii	"\235(\024\335\262\0034?\307\316\212\303U\217\314\002\363(\271"
+	.ascii	"\323\b\374\336\023j\340\215\3420'\377\210s3P\327#\023\306\347"
+	.ascii	"\253-\357\206\213A0\3303\021\203\214\3443\204\001G#\241I\374"
+	.ascii	"\242\325K\376\333\311\241\360\316\311\343j\342\347\230@e\344"
+	.ascii	"\227\376A\004*\350\330#\254-\3626\225\217\337\351m5\316\322q"
+	.ascii	"\222\260\025\212\"\226]{\370M~\302\375\212\007<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\215\003\305\f"
+	.string	"&P4.\2009\351 &\264\226.\266\322\316\243\t3$l\3774\260\030\300L\351\334\301e\300o\324\244\021\332\006~\030B$AhO\320\336\222\244$\003&"
+	.string	"&"
+	.string	"*"
+	.ascii	"\222\327F\020A\351[m\233\201G\300\371M#\300\001p\276\033\313"
+	.ascii	"\306\371\265\363\235\037\265\256\363#\306\2475N0!\002\030\027"
+	.ascii	"b^\227eb\212\203e\363\304\350\275\367\212~\366\211x'\006\233"
+	.ascii	"\230b\361\3718w\242\312|I\242`\242\230\037\227B\324\303\207\374"
+	.ascii	"\307\267\246\206c\264\\\233o\245\265\225\346\342\203\237\346"
+	.ascii	"\263\013{ H\007\024m\203\201#\260\016\315\026\235\260T\004X\371"
+	.ascii	"\225/1T\276\264\340\024\242\227\301\342Es\243\227i)uC\037\342"
+	.ascii	";$\t\210\021\367\331\3524#+H1m_\250!eh\210\026$\031\266\003\240"
+	.ascii	"\002!\031+\017\022\240EU\306\244F\022\025\024\224\225\024\325"
+	.ascii	"\310r\342\227i\026\206\327\361 \363\306\321\236C\271o\260(\226"
+	.ascii	"\247Y\327%\026p=\232)\002\267\b;&\207l\302*\246zK\371d\330\020"
+	.ascii	"\241\361\336N\201B\264\006\266\337\b\274\n\204|\020\342\265{"
+	.ascii	"\244J\"\336q|u\375;\355iw\271Y\001\376|pV\347\203\002\231\325"
+	.ascii	"W6\022e7\022\303\271\242\343\247\300y\342\222T\002\221Xtk\023"
+	.ascii	"\217\204\367==\233\274\204\222\321\253Iw\036\256\017Mq\004R\026"
+	.ascii	"\370\356\2727\r\365,\257\363\036B\021K\344\026!pB\235\tsZ6\250"
+	.ascii	"/\275\371O{\214\326\246\203\002"
+	.text
+	.section	.gnu.lto_.pureconst.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375 n\245\002"
+	.string	"\342\006\024\034p\255a\fV\305\376\357\252\252\252\252R\262\223$I\222$I\"\310v\227\244\331MdN\361\211K<\342\020\177\270\303\033\316\360\205+<\341\b?\270\301K\301\t>p\201\027p\200_ny\345\2247\271\344\221C\336\343\272\343\215\307xV13K"
+	.text
+	.section	.gnu.lto_.ipa_modref.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\356\004\375\017"
+	.string	"\346\223<2`I\223t0\f\234!\b\267B\022\204\273\206\001\301V`\030\024\004\307\026\r\214\023\352\377\377\026q\232\335\276\376\317\230\375>F\227m\243|l\226\020)S*"
+	.string	"3"
+	.string	"/"
+	.ascii	"-\300\\\\\\\367\001x\332\223\230=\r\337n\355~\232\357\256P\365"
+	.ascii	"\335\335]z6c\367\234;\312#\245C{\373s\363\b\f\001\355\213\344"
+	.ascii	"\300\360\026\224\210\306\214\215\301\016\334\bZ\374\204d \025"
+	.ascii	"\350\003[\021\027\027#F\227"
+	.string	"\206@\243\013EP\3514\316\237\312PE\223\224\247\001\\'\240\005\3231S\244E\025\364\241]\210\032\007\005y\265\356\307ddj\261Sk\322$\370\230\242\327h\177\200\340o\245\203r\314\335\346\274Ao\214r\006\001K\240`!\002\342\004A\312!Hv\234\317q~\244+\226\331\275\0133\314\234HpYzw\367\234G\325\225\347)\345\224\316\311ME~2\200\210\250pR\321LR\3100\006\240\002\2211c\035\021\2600\307\240\"GAS\224\242B\2061F$R\310<\306)\307\210\2060\201\207\343=\211r\233\226\265\303\017\262t\240~\200\237\370f\205\377\235\343\316\377\317n\023U\350\030>2\253V\207(BM\bmp\310\232\371\350r]-\330L\017\326\361_\365}\364\035\366\374L2\252\214\306\227\257eLt\017C`v+\250\023\257-$OmH\2324\366\253\326\357}\343p\2425\353\001\273\2718\r"
+	.string	"&\002rc\373\347\027\321\216\231\tJ"
+	.string	"A\251\272\"\263\212Q\036\0334\263\260ST\246\246\346>\311\366=\322t\342\257\240\333P"
+	.ascii	"\037\"@\201\356\230\013\237!\300UBd[\342\031q\301\255}\005\214"
+	.ascii	"\226\375\365151\007\243\037M\351U7\226W1\367\237U\006\013\230"
+	.ascii	"\244\222;u\316v\262\211\372U\256\277\037\354N-\362\312\211\022"
+	.ascii	"\005\341\2147\007\214\235\343\177\206,\345.z\345\007"
+	.text
+	.section	.gnu.lto_.lto.8e707b7e99e6f28,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016\244\204\251b-\342\250\232\361b\245\344\224\226\370\024\223\265\240\302\314\354\206LV\013\353\263\276\354\270\231\231\"\351\021\022\253\300\032\227!no\033[k\204\310\024\"\210\020\310c]s6ZG\344\340i\200\240\354\363\3118\020\344a\370@\216\366"
+	.string	"7\004g\241\216\006EY\246A\354?f\253|\246_F\342M|\034\271w\361\255\362\231\276\247\266\017K\301\234dV\264\260\244\2115\262\361o\217\375\316\365t\352\200L\022\024\221\314\324\234P\367\365\350\307\326\030Q\201LS\210Hf\324|p\251u\274\374\227\243\035\333\247\252\230\241\201PB\201Z\311L\230)\346\252Uu\340\252\3650\272\325m\267 -@\251\220J\243:\200\205\314\334\221J\026\375\3657\370\025\376S\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.6.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"=\n"
+	.string	"F\223E<0\345(\035\340{\236\277c\334\003\013\0237\206`\361\206\316\321\244\034\3445\244h\0355\002\361\2551\2046z0\376\356\r!\r\343@\2515\2049d\363B\227\004F/e\373\233\310\235R4"
+	.string	"3"
+	.string	"1"
+	.string	"\254\253|\266H\361\261\t\201\001Y!\260\273\033\347\007\231O\355\006\231O=\371w\371\371\177\275#`D\245J\227\032\211\335\265D\245Fn\275m\005\333\020\366=\001 \002\200]\221q\266\262\351\202r\327o\177\376\313\033\333.\213\332\262<e\025\023`w\031>\375\020\302\034.\337\262h\202]\030\253ew\033\2740\360i\333\017\252z\235/#H\"\325\342Kf2\331:b\034g\036\273\246\216\252\256\006\200\261\223\034\355\260$\325\304\276\266\252\262/=\037\376\332]\255_^\372\232\202\023\025\322\"C\222:\270\013\3204\347\361>$\215\020h\033u\"Q\307m\243\020\206h\343<\216\315\223\340n\343\343m\244\256\363\266M\270\327VUS9&=\371\252\351\324\027"
+	.string	"cZ\022"
+	.string	"2\241e(p\317\213%3\374Q\201h\352\016\327\304_\213\032\325\"\333,\310D\220\005\341.`\004\344\003\303\202\n-"
+	.ascii	"*c\247\235O"
+	.text
+	.section	.gnu.lto_pt1FilterInit.7.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"}\t"
+	.string	"V\322A8@\257\032\003@\311\"\340\344\327Mo\354M\315n\204$\231\bB\030y\336\221\310\277\240\201\276\005\254\217n\342GQT\235\340\203{\3425\227G\016\005\032\332z\357\275eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"]K\033x\356>\027x\356:\266-\007\032\001/\033.\332\177p\003\361\3509\326>qF\265By\002@\374\357T\255:\334\315m9m\035Zo\002\033\331\317Q\203\371\254K\021ikM\333Y\332dt\253\260f~\025Y\354\177\247\r\237;\005\316\2635\211KF\223'\023\374\254W\354/;]\370\034\t\244\213\007\254\355\344\264\026F)\354\373\377P\2730.\004XBN\236;\006r\204\226\232\265\266D\315\355\2435\367\377\335X\255[6g\322\236\336\300J\022\026A\246\221(\344\365\343\021A\246\221(\004\226B\022)\374\200%Q\004\t\374\210\024\240\007\241\341\004H\004Ma(\202\232\362\346\276\261\332\305\314R[F\271\255\255\360+\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.8.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\r\t"
+	.string	"\266\321?9@\345\2501\340\245\360\313\361(\211\333-K\301d\211\025v\t\26287\241\274\245\tB.\n\b2\2165\34247\257\242*\301\001\030K\213Y\336\034yk\274\307J\"eJ\001,"
+	.string	"."
+	.string	"0"
+	.string	"\226\233\t4\313z\255\213\277\220\333\225\201\361\002\360\177F\020{\206^m\2275)\325\3110\300\341\177aJ\265\341F\267Mh\313\3206&2e\244\2557m\341\347\023\317\255\302\252\371U^b\3779]\330,\0212\206\255Kl\342\231e\362\300\277Z\211\375\037\247\n\233e?\027h\001(\205m\377\033\352\227E\205@\213\210I\263\2140/\022\017\024\234\265\337\t\306\217\326\231\377o\\\265n\331\321,\033J\215\203\305"
+	.string	"\366k\314\002\\\026\021\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)\0041\232\236nbv\016\312I|\272Y\342\270nn\276;\363\270\352C\207\f\025/\032cK\341\f"
+	.ascii	"3C+\0258\b\207Z\\|\b\313\256Q\3060/\020\030\\\221\246\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.9.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\013"
+	.string	"6\326M= O\225\016\204\360D\370\360\362\232\203\311-\243nD\020\362oE\026\\(P\310wj&\207\ba\2477,^0\032\033!0"
+	.string	"0\002"
+	.string	"\327e\331\240\314\255_\311\317\"!do)S\n;"
+	.string	":"
+	.string	":"
+	.string	"\321\336e\333\357p\017\233\215\202\236\206P\305M\220`r\261\273\230\201?\252G\370\001\325\243f\370\366\334\374\20384a\341\344\371p\236\226\202\335uz>\025n\275\355\003\266%\366#\0041\3230\323\232\351\314\364\001T#\024\004Z\354R\370`\354F,\261\301\366f;lg\276d\2243vO\254H\355.\304\t\236\366I\377\260\335\333\\\300.\210Dj\327\203\030\301\365Pc\214n\304\345\347\353\245\252\226\251\343\300i.\"\025\242\302\017\036\302(\211o\302@\270v\367\241M\365x\265D\247\027\244N~\266\307I\305`\037\256\202\354\227\376\353\336oe:\031\r\346R\211\225'\021\215\222iPa\200]2\213%\233`\227\312\002\0136\321\034`\221\002\3160\024\r\313d\231\2069\274\275\035\365\321\2116:\3129\352\210"
+	.string	")4<,:\371\031\3525*\324\350.\250\246\006\025"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\322\262\304`lpM,\250\305\026Y\220\225\220@\240,\203&\236"
+	.ascii	"\224\024\3235\311"
+	.text
+	.section	.gnu.lto_pt2FilterGain.10.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\215\n"
+	.string	"\006\024I@0\251(\035P\030\373Ss_\331W\037^!\342m\321R\206\302\267\343\331\274\307D\266\215\313^\355g\b\320P\214\366\366\334\322\006\036B\244\240\006\267\333"
+	.string	"\357\013\3430CAH\205\377mo\271S\n5"
+	.string	"8"
+	.string	"4"
+	.string	"\252\033\350lP~\002\b\034\306\202r"
+	.string	"\302\356f\2333\\>\345\027.\237\032\340\335c\347\277u\271B\305L\247\321#fcw\035M\247\225[o;\3026\206}\213\230\313\253\201\303\203\335\224P\3022\230\n\n\234\365\333\235\337\262\3066\313`f\244\322\340\301\0068\330\335\211O_|\256\212\307\257\fZa\327\245B\260\273\024\226\310|\332\366\003\327\017T\314k)\305\320Q\r>\001l\301\267\326\b\303\b'\273$\b\325\f\024\350\275J1\264\277QT"
+	.string	"\366\345\356\2565e?z\376\373\345Y\253?>\372\001\034\035\321C$\212L4\020\317\264\306\341:\242\221\217'\013m \320\246e\241O\b(\323\270\222\214\363\340\215\244\303e\242m\3432\315\267\227\253\251\251\033\222\226|\225:\365\023\274\227T\325\020"
+	.ascii	"2\241k(\360\317\213\225\314\0304u\361\256\301b-r\316\202L\004"
+	.ascii	"Y\020\356\002F@>0,\250\320\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_pt2FilterInit.11.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\365\t"
+	.string	"\346\022D9@\255\322\001\374\242\350\273\017\217D\326#\206\027/\312"
+	.string	"\337\207\340n}FGYRA\026\261M\r!\210\307\261D\261\253\210\267\342 \353g\236/\005\2238lL,7\332;\2450"
+	.string	"3"
+	.string	"4"
+	.string	"\026?\320\235z\027\350N\035\332)\0275\366\261\026\205l\334\335:3\036^\206\376c\307\250V\250\313K\302\356Z\252V\026\367\274\355\215\355\003\373\013\001'\232\220\335\212\334\312\336\350H\313\3663\266\245\370Wx\230i\306\354\222\230\324v\227c\003\357\224\300ri\337\343\037\341]\247\007\354\262f\265]\221\343\002\3574\270\213\207\317\350\313\326A\333\330\020\0071\315\333]\004_&\021\001\200\262q\352N)G\3118\246d\316\026Qrb\330\267\354\356z\262\354\303~z\327//\335\030\r\007?&Q\b\324\331\323\001?&Q\bTI\337h\364y*)\3040\252\036\260T;\032\177\016\037\260\232\276\017\254\031qo\331\311\262\002\356\226\232\023\246\323.]d\252\330\002\021"
+	.ascii	"2\241}\034\030.\250\340{\340pM\375\234:\314\033q\241\026\002"
+	.ascii	"\037\302\262k\2241\314\013\004\006W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_pt2FilterUpdateCutoff.12.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\005\t"
+	.string	"\366\021@8@\305\2521\340\245\240\356\261\364\327\213\003-\023\3117\234j\277\224\373\205Y\2434M\331\177A0\277\025\256\317n\"W\024\027c\247G\227\302\031\237\363^n\276\377\344\2272\245-"
+	.string	"."
+	.string	"0"
+	.string	"\232\345f\002\315\262^\253\342\217\343v\261,^\002\376\317\270a\317\320\253\3552\006\2252\031^\030\376\027\242R*7\272\355A[\205\266\001\002\227I\022\217\266\316\264\205\237E<\267\n+\346/Y\211\375\3374a\2634\260\030\266\006q\210gV\311\003\377\312$\366\177\233\"l\226\375\\\020\205m\377\027\352\027\305\204@J\207e]\322,#"
+	.string	"\224\217\214\023\234\265\237\tF\215\326\226\377o\\\265n\331\321,\033\312\213\352D3\373/f\003\002\017\356<\244\020\350\243\265\303\351<\244\020\3503G\234H\304u\346\b\344 \232\235.br4\345 <\335$q\\73\337my\\\265\001Cv\212\025\215\261\225\360H\013"
+	.ascii	"3C+\0258\b\027j\002\263k\2241\314\013\004\006W\244\251)\340."
+	.ascii	"/\332I\006"
+	.text
+	.section	.gnu.lto_pt2FilterApply.13.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`d\001u\r"
+	.string	"V\231XB\020\221\223\016\270\017\211l~\247\273\324\216t\033\321\375=N:\b\360\365\356D\206\001\330\227\301\365\216(\342_\037\330\354A\266\375~\031"
+	.string	""
+	.string	""
+	.string	"P\004\245\341\374,@=)(\203h\027!{\357-eJ\001D"
+	.string	"?"
+	.string	"I"
+	.ascii	"\273(-/\273Z\207\021L\177\326&\333~\207{\300\354\222\3230\244"
+	.ascii	"\300\254\204\t"
+	.string	"\313\214\335\255\f\234\003\376\271\013\200\177z\341\330\023\363\037\342\016\305\204mtB\362\214\nv\3279:\221p\353m\037\260\355a\177&\337\\\3735\231\2462=e:f\032f\372e\332eZ3\235\231>\200\250\262\242\200\314n\204mfc\336\211\f\2661[c;\363+.\231\332U\001\343ew;\234\340i\237\364\017\330\265\221\007\b\244\247$6\\\260\030\311pz}\352b\210(\250\246:\205.\242\rYn\276nT5\246\020\251d\"\037\221\312y\341\007\027\341\322\264\273\036>K\003\bS\312\b\374\273F\020-h\220Jr\2635\222T\013\366\335*\212\375\225\007!\021\020\220\347Aw8\327G\310\201\207A\005\262>\037\253S\201<\013>U\347\n\2518\004l\201|\\U\310\262\256J\243\355mJ9L*\304\224hfJM\300L\n\225R\007\0235u\322W\003\352\323\250\003\\B\336\0025j\220\341\020\036"
+	.ascii	"i\231\"34\030\201fC\237\020\034P\f\214\bF\004#\002\341\352@\373"
+	.ascii	"(FXY\034\2749A.\017\321\213\031\003\\\256(\2327\305\305\233]"
+	.ascii	"\026c\203kb\001\266\210\"\013\247\022r\t\2249h\367II1]\223\f"
+	.text
+	.section	.gnu.lto_pt3FilterGain.14.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"u\n"
+	.string	"f\223G@0\307(\035\260xw:\307`G\355\252\253\277\034\013\336aCK\273\242j\376,"
+	.string	"\211\251\254\r\255m\237!\270E)\353\323\265Q\260\315\023A\230\007\002\215\240\304\004\233\b\242\360\207\366\333&r\247\0244"
+	.string	"5"
+	.string	"4"
+	.string	""
+	.string	"<[\314\302\027\230\307\f\230\004`\260\273Z\347\n\231\317\354\t\231Ou\271w\351\371o=[\2010T\252t\251\311\330]KT*\345\326\333~\260ma\237\"\r\nvOF\007{`\022\2109\353\267=\277e\216m\226\305M\te\341\213%X\260\273\021\237\256\b]\023\227_Y4\302\256K5`w%\f\261\371\264\355\253\036\252\327\016\020\366\201R-\276E\245@\270\306\030\307\006%\273&\007\325\013P\300\367:\311\321\016KRY\354g\253+\366\245\347\303?;k\365\313K_\243q!\b\032\033\222\003D\222H6\017\320\364\346\351>\244\220\020H\033q\"\021\267i\243\320\207H\333\272\021\315\303`N\344\323i$\216\3534N\270\267\247vLz\3625\323\251\177\360\2752\r\022"
+	.string	"2\003\302\260f\b+3\346Q\321i\352\016\327\304c\213*\326\"\347,\310D\220\005\341.`\004\344\003\303\202\nm"
+	.ascii	"*\243\251\235O"
+	.text
+	.section	.gnu.lto_pt3FilterInit.15.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"M\n"
+	.string	"vSF<PK\325\030H~\203\n\241\331\322h\326r\\'\267\367m\351\246\340\314\240o`/m\273\334\244\371\236\325\376\372s+3\303\232\360"
+	.string	"\003as\214\020\251\240(\002\204\206\3566\371\245L)0"
+	.string	"5"
+	.string	"4"
+	.string	"\236\375,\221yj\216\310<\353\265-\177\020nTKA*\374\277\311\007\366\034\275\332(?B\242\217\243\003\300\377\306\220\210\201+\3356\322\026\243\365&Qs\204\033(b\377\202\330\353\254\211AB[C\332\306\317&\317\247\202}\374\0314\254\376Kz\241yV4\034[Sp\005\317%\217!\376\221j\365\177\222Zh\001\276"
+	.string	"#\025\260j\232^!\030i\r\330BA\355\177F\235Bp\340\201\303\177G\360d\236s\302\213\024\202b\254\375>Q:h\335\370\377\312Q\353\223\235\271d\007\003\334U:\230\213%+e\322U:\230\213e\323p\231\fG\3314\027\001\231\215\322q\266\311D9\002\225n\353p\\\267A\276\273q9j"
+	.string	"\027\013$\0234\223\355\306\240\354"
+	.string	"s5\340\004\022"
+	.string	"2\241Q/0\\P\301\367\300\341@\335\200\354\232\3729uXo\004\306\207"
+	.ascii	"\354\032z\f\363\002\201\301\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pt3FilterUpdateCutoff.16.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\025\t"
+	.string	"\266\021@:P\305\2501\fA\275\b\271\227K\375~\206\034\242v\301^c \237\2250\237\217\267\236\220\313\b\202\330\213%\377\222\013d\326q3\001t\261`\372\302\2607\373\275\321J\"eJ\001,"
+	.string	"."
+	.string	"0"
+	.string	"\226\233\0174\313z\355\213\277\220\333U`\3435\340\377\214 \366\f\275\332.gP)\223\341@\304\377BTJ\345F\267eh\373\320V@Re\244\2555m\341\347\023\317\255\302\232\371W"
+	.string	"\304\376o\352\260Y.`\f[\227\330\3043\253d\203\177\305\022\373\277M\0336\313~F\320\002)\205m\377!\352W\006F\201\213HI\263\214\001PH<Np\326~&\030?Zc\376\277q\325\272eG\263l(\tT-\n\263\237cF\340\262\024\356<\244\020\350\243\265\303\351<\244\020\3503G\234H\304u\346\b4!\232\235\316br\022\312Ux\272I\342\270nj\276\033\363\270\252D\207\354\0245\032c{\341\f"
+	.ascii	"3C+\0258\b\207Z\\|\b\313\256Q\3060/\020\030\\\221\246\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_pt3FilterApply.17.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\346\001\315\016"
+	.string	"6\034aB"
+	.string	"\221(\035,\313K\351G\333\3309^\004\003`\371\220?K\267\242\030\343\317\360\356\362%\225\310r\265\332\250?a\024\264\035\001\303\035"
+	.string	""
+	.string	""
+	.string	"\b\352H'\024w\260'c\223\331e\337\366\t!\233\244$SP"
+	.string	"C"
+	.string	"Q"
+	.string	"E\026\2168aG\202\0012QX\\2;\217\"\330\360\265\333\332\026C\240\210S\373\302\272\r)\331\204\n\024Tfd&W"
+	.ascii	"92|\030\n\310\360]\003\236\320\247\"\222@\f\005\007\227\352\244"
+	.ascii	"\004\255)\310\314Zur\001{lk\240\355Gk\t\001(-\266\0207\260C\004"
+	.ascii	"`\327c\267c\227cwcWcw\263\253\331\315\354>\273\230\335\333\265"
+	.ascii	"]\034\260Y\2558\320\"\323\302\f\215\214y/\035\332\236ZN[\033"
+	.ascii	"[}U\223\251\002\206Kfz4\001\272\001\331\337\265w\300\210 Kv\255"
+	.ascii	"\345\002\301z7\341q\301B%\003;\376\035\213\221\302\360\373\330"
+	.ascii	"\263\226\324\n\345\231\3427\376k)R\036P#X\302\377\274(\004\\"
+	.ascii	"\351k\313\314\217\242\312\202\b[\nI\206\017\257\265VdX&\236i"
+	.ascii	"\273\022?C\213X>\246\221\220Q\350e\005}J &\007\241\006\334\210"
+	.ascii	"$\022\221@\334(\304@\304\201J\"\334\207@I! %\316D\"\2258N\227"
+	.ascii	"\330z\316\241\372\020crT=\177\201\351|s\3171\030\316\375\316"
+	.ascii	"_\215\3155\347\274\243\345\001\272l\256\255\\2\232\237\330\236"
+	.ascii	"]\243\335\337\002% \320\"\241\322\016)M\021\241\371\b\246\205"
+	.ascii	">\005G1#2\342\021\023\256\024\326K{\004\342\253k\255p\020\243"
+	.ascii	"\036\231\223\361\225\305\342\315\231\\\216\350E1z\271r\232\267"
+	.ascii	"\303E\210]\246m\203ib\005gDQ\341T\234K\220y\332}\272\024\323"
+	.ascii	"\265\310"
+	.text
+	.section	.gnu.lto_slewFilterInit.18.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261C!\017\231\251M\007\264|\260\005\320_=%)p\004\325\342\n\231\0021J\375\b\261M\201)\245\006\301H\be\013 \301\023\303MB\223\300\332\\F\353\341\t\034\3018\244H\233\354\235R6"
+	.string	"<"
+	.string	":"
+	.string	"KZ\274\221\275\232\374\005\366\232\335\002{\365h{8\251`\177: \340\304\332\335\215&\370\3709\372?]\013\211<\237\021\037\273\353\031\022\025\270\351mWl\203\330\347\002\244\177f\022\0306h\264v\t\264B\354\252Z``\373\024\333\344\362\242\330\001\240\220\307$/a|\311\245\265]\r\035R\273k1G\366\232q}\332\207\360\b\343I\235W\354\216P\251\r\025.<\270\250}rT\375\240\002a\240\264=+6\347\024\\f\273\333\341O\b"
+	.string	"`\202\303\202\016\366Z\033\250\034\260>\263e\223\236I\021\330\277vwMG\366M?\366\322\177=$\232/\023r`F\324\304\316\353D8\234&\3240c. 'j\272\222m\363y\336\207\3316\335\210\267a\300p\273`\3703\341\300M\374>p\243\220\373k\351\310!\031V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.19.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\274\002E\021"
+	.string	"\026\236iF"
+	.string	"\217*\035@\316\301\b\323\356~\261\031\262\270\241\320\271\302\bb\017.\036\303\322\374\313\370j90\204\236\332\206X5\005\367P.\266\361c\364\001\252\252\252\200\032R\r\237)\034\214\314\274BlFD\366\336[J\231\002W"
+	.string	"N"
+	.string	"W"
+	.string	"\360\313\300\222'\034PX`tw\307\321\r\251\021\352"
+	.string	"\251\2211(I5\333\224\021\362\222\256\263\003_X\263\024TI5\263\263M\224\225\024N\033\013\254\244T\024\256\220\240\302\241L\226\001\240N \247\273\025\246\013\001e\332\235\235\356\376\246\240Rz\r\375\177\341\377\307\277\263\372\251j\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\334\004\025\034/\272#\314\220\321)\242K\207\377\244\237\373\277\253\257\307\256\351>\341B\326\335\035?\240\373\253KE\220\364#Q\001\335\252\026Y\367\327q\216M\343\277\355\377\025\204\206 \375\261\221W&6Z\314\01703\025\024r\f\331\203\241`V\206\feN\036L\"Z\202\231{\301\264\266\273K\314\253/+'\200\321L6\306\377\021%\261l@\303\033\350\210\307\266\356\376\270\262,p\260\261H\244Fe\256\315f\\%;\343\377J\313\253_a\263j\243/U.\243\221\220\320'\312{<<\220\021\203\217\202.$\002\201D\236.\364A"
+	.string	"\352<\236H\347A\340\242\020\020\257\033\211D^\307}\255PY\265aN\t\233^6\034WdZ\032\227M\254\261hm\262\230\177\335='{0\232d\345i\241E2\367\212i\271dd\345\007\313\2215\265\201v\252\005: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.20.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\325\t"
+	.string	"\006\323C<@\247(\035P!w\236\274\354\365'\354\225f\373H\253>\3438\202@\2318\177n\024\273\350seFF;Z\017\212 \343\030\020\fF3A\214d\274\310\344\335\265\037\021\262\267\224)\0051"
+	.string	"1"
+	.string	"/"
+	.string	"\366\007\275\016\217\237\276\013"
+	.string	"\nv\367\272\034\241z\204?\250\036\225\343\335\263\363\177\362\250\361\361\215H\240\247\005\261\273\316\021)\343\326\333f\260\375`?!\361i\370\264>\235O\237b\031I\200\t\260\213\221Z\260\b\342"
+	.string	"\020\333\235m\261\275\003\016\317\233\374\231\262[\300D\300\356b\334`\360h\333'yI\027P\257\226\302\223\310\200j*T\013%\n\251TU\341\0245jjE\240\322\250\327D\211DB\231\262=P\352\206}\270Z\262\237\266\356\375\325M\177\237l\323l6\032W\201U>\331\246\3312\316\223a\025c\231-\343$8\233\313\243u:\032vy8\021\235\013\333(\256\314\202\265\211l\2738M\333.\213\267\207\253%K/\026\032r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.21.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`f\001\325\r"
+	.string	"\366\331ZC\020q\233\016"
+	.string	"\003\350rH\340\2137\341\330\244Rq\tc\207($j\374\2600\275\215H\006\032\204AB\367\374q\336\372\352\223\363\\\267\257\352\024 \037\n\2118'\356N.>\016\246!m\326\2376\331;\245D"
+	.string	"G"
+	.string	"F"
+	.ascii	"\237\366G^\242;I\351\001vC`\220\273`\306\007\254W\203\037P\275"
+	.ascii	"Z\027P\275\272\263i\034\024\331\207"
+	.string	"1,\204\345\356b\324\303\273\317\316\177x\313\007\322\361YY\260\273\236\037\b\206\233\3366\306v\003\3736\002\246!\366M~\352%?=\311?/\027)#s\262{!\005eO\325\024\302\366}\024\027I?\341M\215\353\325&\331\327\353/\333\324\204\002\005`?8lP0\301\233\350^\342\321\226\335\027%\271\273\031#\260^\rP\001\236\230\213\206\360\321c\001\221\335M\340\253\250\240\371 J\325k\305tR\226\336L\2615=~~\370\241\312\343Ex#\2475\265\353a(J\351\244\276(\2320\377\371\342\377\201\204\206\315@;l\320c\322\016\366\251\335\335\331\210\263y \3128O\306]\241\214cp\251\334\321p\331(\302\307\203\2016M\333:\030\350\303\321\260\016'\3024\004\274I\3108l\264m\034v\201\336\303[)V\234<\352\341\267\310\356\302\301Y\240\214(O\376\242?7y\344\2301\303\357\206G;\037"
+	.ascii	"*C\244e\212\314\320`\304a\003\264\254H \030\201\306\t+\034e@"
+	.ascii	"\005\033\214\262\276RB\212\312\016\301\332\300-\273\323\261\316"
+	.ascii	"\225\230\225x\3502\020h\224\217E\002\230\253\201*\f\303\224\020"
+	.ascii	"\"\020\003\\\221\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_biquadFilterInit.22.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\236\001E\016"
+	.string	"\006\032^E"
+	.string	"\261&\035\2406\257\037\335\312\303\257M\026d"
+	.string	"y\275?\217\\\240'\013\255\3742\345@l=\033\332\"\313PL\213\025T+y\364r\3135\253\361X(\301\252\303\004&b\231tv!\004\017\"\204\354-wJ\001E"
+	.string	"M"
+	.string	"G"
+	.string	"\207\366[<\246\273\f\313\003\354\226\276\323\2567\342\004\327\245\275\023\250.\257\013\250.\335\331;\356\301\354M8<\230R\273\233)\212w\207\235\377\027\377 \275\214\016\255\006\273kHz\021q\353m\213\330\266`\303\001\001\267\371\253\327\374\3624\177\374\314\257\227\371!\b\226c\303Sc7\304\216\316\342H\224\n\333\307\354\233\016 *D\033\225\034\020j\374\305\220\375\340\022\363@iVb\310r0A\202\001\364\356\242\373\214?\177\354\322\320q\332\335\021+\270.\017\304\276p\024\310\rh\"\345\370\263\rEl\320?\177\327\356.\360al\330\f\300\244`\251.-T\217T\252\005\356\330\202\226V*5\252*T;\244\001\236d\004,J\354\b\035\331\336\b\352\t\373qw\327Z\262\177\363[\001\242\023\023m\252T3e\205\202\204O\021\311\204\223\320\344J&\207e\230\234\003"
+	.string	"\225?\036n\2120h%\031\312\006\002m\237\fE#\001e\037.\224y\nxK\231\\&\3326.\303\274}\\-9\002\017\234\026u\361e\3346\371\f\3551tV\244~\272\003# \340\202\2411n\270r\320\207Ha\212x\274\321F\303"
+	.ascii	"\244\307\245\246\305\036\003\t\3709fH\342\034\033xi\302$\261"
+	.ascii	"Ep\216\230}Ls\r<\214 \026\272\354  \317\303\273e@\2113\242\214"
+	.ascii	"\3331\270\"-\246\300^^\264\225\f"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.23.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`y\t%%"
+	.string	"v?\331E\220\234M:@\fJ\245,"
+	.string	"\t\2240\320\253\240\2431\005M\277h5]\215\004Q{!\037\356\207\ro\316\036\250\251!#\351\220\340\357TeBB\200\377z\243;\022\004\035\007\004"
+	.string	"\213\232Q\215\023M\b\2212\245\311"
+	.string	"\251"
+	.string	"\311"
+	.string	"\007\373\303~-\017~\313\271\274\213ga{L\200U\r\233\276`\334\274T(Q\321\246\325\213\030Y#\354,*\312]\r$\337\221'r\346\234\f>Z\204\261T\355"
+	.string	"!^Y\001gC\025\007E\332\264\342]\321\260SZ\210\264IU\004\210\005\005\036\212\324\2438\350\2379\301\224}\3159\033\030B\371QI\274\332w\362'R\357r\361\2429\261\304\276\346\0046\360\202\362\243\201?\"?\2267\"?Z\312\206s \222\3711</\250\224\3159k{\344R'GqU\312\327'V|W\273\223\025\270\214\024\304\210\357rQ\353G\346\273\312\361\255\242\342\221\2649'\320UOT\037\fsN\253\357\312\306\355s\333)l\347\354\037\031\001Pz\337\201\025`5\024R\355\316\016\036\254M\f\341\364\205\341\260\f\325\234S\tt\013\254j!\260_\335\367\264x:\364\200\375\222=\224\330\351\311\231\322\241\r\334]\234k\304\2768\347\234^,\373X\376\t\317rGx\327\237\340W~\004\367\272\227^\345W\372\327\235t\260\373\300\303\356\002\217\362\023\370\224\177\200\252\221T}\244\352"
+	.string	"\2526R5"
+	.ascii	"U\027\251\232\246j\"U\017\251ZH\325A\252\236\251\032H\325?\252"
+	.ascii	".U\355\243jR\325\243\252EU\257\252U\325\257@\224u\246F6'\215"
+	.ascii	"a\236)"
+	.string	"\034\301\224<\313\357\365\177=\352\025f\374\321\335\317\346\232|)\3674\t\372\346L\341\t+\357\224\253\373\r{ZuF)\301\255\262)3W/.\321gm\333\351,\371l\356g\246\227E\256\315t9XIK\256\356\367\245\247\305\273\375M\210_p\\\273\304\335\214{\033?+=-qm\247\263q\260\234sJ\360\311\244\266L\020\261\231s>\211\013\362\243\216\371\346$\255R\211\233\333\032\366\262>\346C;\204;\325\263k\304O\343\253\321$B\377\314\201d\315!d\3742\206S\316\271{\020\177\005\371\321\352\233/dd\3159\025\210\361\203\224Hf\215\t\234\n>\"X\365\322!\254\322=V\332\335%1\236\016\305\003\273\313b+\370\224\264C5J-\260v\212\266\022\267'\334\210\002J\241\230\324\326\224;a\033\037\3304\252\251\204\323m\005y\313\265\370\320\341\267(\233\207&\250\233\216\304M7Kq\323e"
+	.string	"\"\315\344@w\213:\341D\242\206\002\367\364\204c\252\241p\262=\325\230tP5\007\006\214\313\335t\265(\034NW\233\001\347\305/\026\207%\302\251\345y\302\332#\324\210\020\331\235\037H[\344h\221\210\034\355\256\341\021`\205\030m"
+	.string	" F\273ca"
+	.string	"\254\217\242\005\300\243hw\214\007mu\020-\r\007\321\256\2320]C{C\350\021Vh\207V\251\364\304\256J\241]&j~]K\033a=p\305\351\005\341\211\375\"\031\2443\2026\307\025\234\251\325lu\\V\200\024\006\320\212h2\354\315\231\262\255\tl'\255\372\262U\266\244</wv\240y\200\246\250q\\\250L\t\215\214\024\024\244$i\r\320\002\021\241\232m\022"
+	.ascii	"E9\2131e\004\206\t%\250\232\241,\325*\016XT\255d\351Z\r\321}"
+	.ascii	"k\227\343\246I\233\314\374\3474#\322\\\351D\231\215\211\333\\"
+	.ascii	"\264TS\217e\274Y\313\2337\023\23073f\006;\222G\217T\313\346\017"
+	.ascii	"x&oN\005\n\017\362\344HJ\270\351[&% \345\231f2\326Hy\365\246"
+	.ascii	"\312\235\226\037\0044\032Pndc\321\271\354\267\022C\361\036\b"
+	.ascii	"dlQz\206\237'R\2303\331\024\314\022P\235lb\022\216\265Q\007\357"
+	.ascii	"\251+\232\007\377a\007\373\300v\2606X\300[jR\3605\320\225\354"
+	.ascii	"\373\022\354\322\325H\312}\212\005\021`%j\376\260i\265\356\037"
+	.ascii	"~\331\343\257k\375\256\207\252\273\2261\216\272;\030E\247\347"
+	.ascii	"\206\270w\354\027P\2118\026J\253\363\267\351uDVL\231P\001.<4"
+	.ascii	"'\322\2042%\031\237\002\322\317c\243P\036\264j\207\340_:K\371"
+	.ascii	"w\322\320?\252\205\205\277\335\177\201zu9\207\310G\325\023@\004"
+	.ascii	"\020\261R.\250a\244\035\253\200\3423\026\372\373\205$\023\213"
+	.ascii	"FS$t\205\365\007"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.24.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\215\n"
+	.string	"\366\323G=@\305\2521"
+	.string	"\274\326\377\366>\201Z\237\353+\240\312m\263\256c\264\231\350\333\335V\245e\236\277\035\025b\204i\256Itw\371\341\313\305\0215\352O\223P\367\020|\017\222\215\354\275\245L)3"
+	.string	"7"
+	.string	"3"
+	.string	"\017\031s\035\275\320\231\313X\2413W\2615\340\261u\027\b\020\"C\360\337\233(\026-\305\3322kT\253\223%f\342\177\245j5\342N\267\345\264\255h\335\t\003~\221\005\n^\343^R\332z\323v\306<6\204\247LZ\021r\264\213hXg\325\374"
+	.string	"\022\320\376w\n\2211\327\260Y\266v\271E\364\353\303\t?K"
+	.string	"\355\037;\r\251\272\324uf\025\224\253\366n?\212\263\3159\345l9:\244Uu8Pr\222yj\307\223\234'\255\267\377\357d\265\216\331\233a\366\364\313\226\335\301\n\001\211\237\351s\201Q\372\302\320\027n6\276\220\302\240+\310\023~\246\fQ\310#\201\243\021\b\362H\242\317\310\003\205%\317\303PP\343\013=\023\b\206\336f\274\267OV-Xj\250\tR\214\354\3142\023"
+	.ascii	"*C\244e\312L\274\030\032-\210\307\205\2603\261NKS\325\334\270"
+	.ascii	"0\004\230\241\201*\f\303\224\020\"\020\003\\\221\246\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.25.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\374\002\r\023"
+	.string	"\326\343zF\360\320h8\250H|\037\203\007M\031\231\"\003r\207\362\325\210\315|\351\241\257o\345\030\370\325\252\272\311h6\300:~\023q&\005\250\223\223\261\263\r\\\214\233=\324fX\rn6\327\002S\3227\302\335\366\336R\246\024a"
+	.string	"Z"
+	.string	"m"
+	.string	"\273\233\340\236\027\200\231\277q\316\245]\236\242\234\335\r\261\202\247\375\333mf\037Y\276\332\215q\221\263;\206\030\001x\317#h\333\017q\0213;\327\215\035h>\227\037\027\234\215\335\r\013\234\365\335\353\356\361\335S\231\317\2363\377\270w lh\330`Z\236$\007\273\353\264\301`\270\365\266\r\330f`\253\205\366\330\222\312\301~\267\273k\215\261\217s\263~\363\177|\374=2\275\312tG\246U\231Ne\032\225i\216L\2372m\312t)\323`\246I\231\3762\355e\272\313\264f:3}\020\225\321\213\006\271\335\227#\243\365\361t<\034\347\267g>\316'\3338\025\300\226\013"
+	.ascii	"l22j\004\0378\364\244(% \344\372\016\207~h\302uN\372\031%\375"
+	.ascii	"\324\244\001n\200J\322\222\202\300\250\325\210\257\347\200\372"
+	.ascii	"\236\231\033\rv\024$}\316\323\324O=\240\332\0061\217\334\251"
+	.ascii	"\252\247\244\024\265\0321\345&:=n\346FSy\t\325\221\030\037zM"
+	.ascii	"\355\200j5\242WN\3029pwG\374\021\017(\2004,\337\275kI\024\"\272"
+	.ascii	"\321\362(2\223\025\225V\354\223\255\240\234\270\274\317%\"\261"
+	.ascii	"\226\314\304\025!<\201\275^\260\222\360\304\005\341\025\226\304"
+	.ascii	"TB\021\001\206\241\264b\241\f\006\213\205\247q\337\255\306\260"
+	.ascii	"4\365R\344CS\321,\365\271A\224\201\326Cb\263\302\026d\247\274"
+	.ascii	"\205'\016\021i\240\261@\375\220\334\206lA+M)K\263CU\272\322\003"
+	.ascii	"\270\326y:4w$\\\205J\023\207R\223\246t\300\211Z4 \340\"\021+"
+	.ascii	"z\351\232\"\"\236\224\024\r^\202N4\020\r+\211_\200!\2702\324"
+	.ascii	"i\352a\032\365\213K\r\006Z\357\2568.\220:kf\216\030P\362\035"
+	.ascii	"(\211\b\313\023\003%\337\001%\301\274<^\3270\251\2710\004R\022"
+	.ascii	"\t\307[g\320Ma\314R\262!~C\254\220\304\005F!\344\336D\342\303"
+	.ascii	"YJ\241\311m\225$\020\260\314&\236\252\024\323%\310"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1Weighted.26.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\244\003\325\026"
+	.string	"\246\252\221J\300\360*\035\370\313 \204\032\362]p\225\272\247\201\2219\366\237\342\254\316{\212\235\217\315\314\314t\222\0265\376\nH\267\237\237\340n\220$\353\037\242(\nSa\333\206\277\235sQJ\365\307\354]\225\325}7\367\031\331\020![\246\024x"
+	.string	"k"
+	.string	"\210"
+	.ascii	"'\375r\341\2042\346\002\254w\003CF\255\025\301I/(O\336\336\331"
+	.ascii	")\333\273\3471q"
+	.string	"\\\325\231s&\250\326Z\342\004_\373\300\357\354\036\2049\253V_RP\255\301\022\037(O:X\332\366=\374\303\316&\216\301\r9'\031\231\n\302\031\265\326\331\310_\247\223\343]\247\223\364\346\273\357\316\177\317\311\232aS\217&\346\213jPk\365\366h0\334\364\266\r\330f`\217\n\002v\360\\\252\301\376X\251\317\376\360\226\355Zd\327\261]\207\354\032\266\353\327\256Av\355\332uk\327\254]\257v\375\261k\217]\253v\335\261\353\324\2569v\275\261\353\362<?\352\301\377\264\353q\327t\327\273\353\017h\351\250p@T\253\205&\032\365\210\024\342\360\341o\337\377\371\320\007r\312g\367r\020F\371|:\324Z_|\037\247\002O\021\243;T;\212\020\272\302\027mQ\030\r0\202\247\003B]\364E\005,A\370\t\020z&\333M\270\350c\260\250\007m\321X\215\025\375\240,*C\342\375\316\b\037Z\321\033\341"
+	.string	"\315\333\205>\350\211*\312A=(\231\304\263\351\240)\252\242\250\022\274\337\211{P\007\275\020\007hJ8\211\024=y\261AQ\224\203\216I\274\337\271M\376\320-\027abYk=\361C\344\\\374\034\230\323\311\rz\240\223\234KE\240\271M\001:\025\227\226Z\356\244saY\261\221'\323Lr5\235\212\355\301l\005w\273\341h\263\025[\312mF\313\265\314L"
+	.ascii	"\030\307R\313\315t8\\n\226\n\232\037+\365\225t\304\244\247G\272"
+	.ascii	"\264\244#\022\317\346\244t\244\250\"j\342\275\024j5\tPJ\322\245"
+	.ascii	"\264\210\367\263S\336\342\364=/\340\373)\002e\224E\215b\215\271"
+	.ascii	"\002e\207\250\247\204\242G\344\311T\314`\032\231\250r\201\002"
+	.ascii	"d\352)\211P\030\225\321\215\321\020*BI\204\264@\250q\034D%3J"
+	.ascii	"IQFRR\255\001\240\002\021\271\242n\021 A\213\244\"\t$\255c\251"
+	.ascii	"Y\245\031\366k\004\210\210\245\3754;\304\033\232\004`\334b=\200"
+	.ascii	"t\221\207x\031c\327\031\003x\340\003Ie,`\203\256\035\214d\037"
+	.ascii	"\023\033 N\006\370\360bo\374\264\364*\216W\215\005\216w\246\353"
+	.ascii	"\030\247\017\353bI\366T\240\240\001\220\263\001ap\210\234\216"
+	.ascii	"k*\rilI\306\036\251*\333\226K\177\326F\331\274\247*\323\013\306"
+	.ascii	"kxZ*\223\327\251"
+	.text
+	.section	.gnu.lto_biquadFilterApply.27.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`b\002\335\020"
+	.string	"\266\337lD\020\257h8\200i\362\336\331)_\346w\367\276{\370\254\337=\037\263x\240\343\354t\002\374\274\310\262M\242r\3630d\365\261\004\220\264U\004"
+	.string	"@\240N\242\310\264\377t (\327\tgdk\355\336{o)S\nW"
+	.string	"R"
+	.string	"Z"
+	.string	"\27303+\273\273a\003O\373&\027\341\372\370\361\214\335\031\212\225\335q\303\004\276s\036?\333>\210\207p\331\265m\324@\322M\260 \2016\263\273\240\200\003\350\316m\037u\3474\303]O\227\177\3327\017)'d!\257\247\227`w\235\262\020\221[o{\200m\004v\302\b'\277\350\343\237\221\351P\246A\231\376d\332\223\351N\2469\231\336d\372\313\264\227\351.\323\\\246\267Lk\2463\323\327\020\275\250P\260b\227BM\214\215\341X8\034\345\267]>\315\035\333(\021\276W\005\r\331\206\013.v\267\3009\037\3702\177\342\2327\001\234~\272\311\210\035`Y\343\221v\352i\347\"\226\204W\351\224\264)\247*#\226<x\211M\275X\215F5u\244iB\034Y=E\225\243\205H\257\251\233\214X\002s\353$\\\373v\227\303\037\261"
+	.ascii	"\302G\362\321\235\273nb*4& Yc\217\257T\f\366\267\325\231}\224"
+	.ascii	"{\364\254\216\326\312\244\352X-\217\324\211\353\\\"\251L\254"
+	.ascii	"\216S\0030\025\242Pa\tL\235\030\240\300\222j\005\222\0028\364"
+	.ascii	"0\251@V\030\252\300\316\270\337Vg#\005\211\270\304\200(\314!"
+	.ascii	"\205\001\251GC\037\005\235\376\362\351\250\307\301[:\352\305"
+	.ascii	"Z>p\224\345\303\"i\262\027\033\375\224\243^\nq\004\365\225\215"
+	.ascii	"\236\346i, \260\"\231\263z\251M\021\212\007L\242YI\320c\003\271"
+	.ascii	"\264`\320\233\321\030\3505\034d\0024\214\254\264`\024\2446`\004"
+	.ascii	"\343M\316\214E\037\206<%\004\341\341\340\240\256\354E1W\243P"
+	.ascii	"\321\033\306\234\222\035\361\333cu\024\027\326\206`O,E\024\221"
+	.ascii	"\350p\026)4\275\255B\002\201\226o\342\311\245\230\256N\006"
+	.text
+	.section	.gnu.lto_biquadNotchTableInit.28.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\316\004\275\034"
+	.string	"\306\264\264H\240\330M:\220a\"\3107\305\027m\033\360P\214\332\007\037\337\203\350)T\323t\315I@\323\367\323\"\365\205\360\006_\261G\032\232\261\372\227\3474\342;\3611N\214\321`\352G\312\033\271\347\224Y\220:F>!D\312\224\002\236"
+	.string	"\223"
+	.string	"\244"
+	.string	"\027\310\213:\263\237`\351\331&/\302"
+	.string	"\363\310\307\223\204(\227a\200\211d\304\004A\201W\302;\224K\313\346\264R\246j\316\331\300\017\310\213\007\302\253}$O\302\373/\306q\346l\312\252\232\023\330\300\013\310\213\006^\300x\221<m\274h\236\375\345@\247y)\"3\230\220\231s\326\026\210?\037\002\357Py\027\303U\236/u\004S\\|JD\027C\016b\266l\224d\204\024\206\370x\274\274\")\031ihd\351\373\362\013\202^>\245\245+M\2059\247\325\247t\343\036o{g\373\203\035\212\005\027\305&,a:\212t\314\006\022\351\376\260/\332\030B\303\333d\357\374\311\257\363&\377"
+	.ascii	"U\323\036\274s\036\365\343\034\352\277\371\357\2679\325=Su\215"
+	.string	"\252e\252&UM\243\352Q\325\242\252CU\257\252U\3257@\313\261\205\301\311\2346\306\312L-q\n\221[\375T\177\360k\337~\225\177\345\231\224O\341\335\252\005I\224\244\241\306\357k\316\244\r\nN\033K\317.R\031\213$J\"\235H%\311\340C\361\247\202.?oL\325\002\253q\344k\316\311s\321\001\021J\274\213\355\342\215S\227\017\254\350\347W\344\312\242\264<\001\320\377\304\250\263\003\260~\025D\372l\0248\275\317\341dZ\"\217\273K\263\217\322\333!\356\330\265%\356\204 \277\331\206;v\365\276\262\310\335_\235g)+\354W\244c\273b_R\302\326\272v\356Y\324\214\017\354\353\362glt\303,\275+\264\375\236J0\253W\204\266\366\212_\271\324\217#H\216\234\305Y\332*\300\352\2151*o=\232\263(\301\315\346\354\247n!)X\245\267\303H\307|\263\366\320\253\270$\347\234\020|*>,"
+	.ascii	"8\t\2111\006@?\273\234\220\030t\237\022\312\341\267\235\255\003"
+	.ascii	"\320\320Mg\342\246\233\301\350qa\303\2110z\204\202p\342-\205"
+	.ascii	"\217m'\372\307\201\356\266K\021d\242&\224\303\341r?5\241 \033"
+	.ascii	"\256\366\243\033\2529 \340\234\212\233\256\266\313\345t\265\031"
+	.ascii	"p~\233,u\322\212I\253h\215\304\375a\032\261\335\331\345R\236"
+	.ascii	"\317\026i\336X\343l\377[\302u\244b\017C\006\237\355\316\276|"
+	.ascii	"x&\350\325\"\234\263\007\205[\375_P:\346\232\265=<\f\0300\020"
+	.ascii	"5+\213\332\362$[;\304\275\276t\211\220\205\375\310\265G\234\313"
+	.ascii	"e\201.6\320\275\220\320q\232s\006W\250QDe\224Q\310\314\214\210"
+	.ascii	"\314H\232\264\030\220\002\221\261c\007\021P\2654E2C\312m\375"
+	.ascii	"\fa\234KZY\335}\302\241+5\267\347\2430s\023\022&`\301\236\252"
+	.ascii	"#$A\242\217\022d\303!\374\023\274\024.\361g\344\337'\373\320"
+	.ascii	"\277\3728\270\255\376sC$D\324\2626\243\306\t\231\025O\365X\204"
+	.ascii	"\326/v\232\027i\360\226\213]GV\215\300K\220v`{\023\205V\231\220"
+	.ascii	"\273\027a\325iH\300\253{\344K\310h\326\306{L[iu\026\357E\351"
+	.ascii	"\210h\247\247S\215\301\333\215<\320\220\266fN^\037#\3562\022"
+	.ascii	"\236\r=,\314\300)3\342\231I\303\352\231\300,\226_\232J\344\033"
+	.ascii	"\277\316a\250"
+	.text
+	.section	.gnu.lto_biquadNotchTableLookup.29.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`c\005\275\036"
+	.string	"\306\267\301H\220XN:\300)*p0_x\030z\b\207\217}\350h+\337\f.E\f\351\271\2675\2311\331\331\351\177v\2026S\345\277|\267&I\027"
+	.string	"J\217\037'\203\340\306\004\265^\006\334x\345\377\221J\337\254\344\023B\266L)\252"
+	.string	"\221"
+	.string	"\271"
+	.string	"&\312Rk\275\211\260o'\367E\256\345[\326O@\020W\245P8\251\252`c\375\314\022+|\242p<A\253\265\0368\351\b6\275\032\001"
+	.ascii	"W\203C\272\034,\361A\236.\304^#\256J\001S \251\265&\260\002\363"
+	.ascii	"\244\200\361k\377\307\201<}H"
+	.string	"\3429\265R\025\221\324JL`\003\346I\023\337S\2364\277S\236\364\223\335\345\304\033\365e]&\210\024k\2559j\343O\037\351>\371\327z-j\252\304G\333T\213\323\321@\214(-n\246\200c\317\030\r\263o}\245\246\202\2734\020j\255\336\250)\0267y\333\023l3\331\344\214\265\326\347 Q\236<]p\232\371\030B\355\031\233\b\\Z\303\376X)\225\375\253?\300\261n\242r=\364\256[\350Yw\320\256\201.\344\377\371\360\007\260k\237]\367\354\232g\327;\273\326\331u\316\256q\273\306\331\365\315\256mv]\263\353\333\256m\273\256\355\332,\3274\273.wM\356z\3345\335\365\356\372\003v\226\214Y8S\253\2123e\252\030\251D\307\273~\254?\353\324\276}#\276\227o]\376zeQ\177\202J\031X\006\363\310\267\354\233E\334H\364F\3134\341\016\223\326\250\215\222b\277\332\325\322\247\204\025k\224"
+	.ascii	"\216!\224\356Q~\344yV\264%\034\312\216\301\215Z\203\rx\177\342"
+	.ascii	"\341f\245\213U\255A#\260\013LF\242\344y&f\210\340C\224\206~\f"
+	.ascii	"\327\2310FI\203(Q\325\020-I\030\\M\204hf\356\257R\210\016\321"
+	.ascii	"\002R\204g\020\025\242\367:\005\027\\^\3020\222\2164\210.\227"
+	.ascii	"p\007\020\304\231\220\364deK\201\350H\257\365\261G\320\fH\206"
+	.ascii	"U\005\034O\177(\245^\341\t\334$ic3(\255\341\037\272\364\205\013"
+	.ascii	"\0360\310T\t\013\356\030\333I_\262\364A\231{W\3623k\r\032\371"
+	.ascii	"I.0\231\001\376P\324\364\301I\227\004\244\343\260HM\275%S\251"
+	.ascii	"\207\344\264\323\371\216\314\246\243#^oW2\361|\024l\274\020\035"
+	.ascii	"tN\244wE>\236S\b\244\243\234R/)\251\267\313)!\351\222r;_S\256"
+	.ascii	"(\310\275%\236/\347\324\353\371r7\""
+	.string	"\324\307J\251\254AH)\375\326k2\300\304\266\234\255\224mc\370\022\203\242@\373\3200=T\207\372\360\320\036\035\272Cy\322\212'\230\035\r\367RD;\323\021\223C\271\340\250\r\315\301\2418\033zCq\266\374jW\247\225\226\262\233\r'\373\221\347i\205\345\212\225\r%\317\323\307\260\206V\261\227\221O\005\002\007\233,#\312\223K$\352\313\215\232\264\206\322+D\324\026b\250AH\304\020C\306D\204DAT\220Bc\300\002\021)\263\r\021\220\245C\344\206D\n\nR\254g\314H\211T\351g\3749\301\3534E\214?\207\274\206\307\007\202\301 \353KW\271z$eb\261)\374\254\305\324f\013T\033@\216[\007\030\326\013\244\252\260d\375\342\204\220\251\335\316\225\217\357\375\244\236i\333\347\326\2058%B\374\237\260\020\207\315\2255\007-QD\336%X\262K9\025\025\023\261/V\306\236\312w3\363\002\370\t"
+	.string	"\247\036\366i\215\254\354\350\t\360C\261\243\031\227\342\2132! \235A\217\336:&\034\024"
+	.ascii	"A\2714\367\372G\232I\013M\314\211\210\006\362\206$\354\021\200"
+	.ascii	")\252x\013:ii\220\277\364P\261\3505\222\243\006"
+	.text
+	.section	.gnu.lto_biquadBankInit.30.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\205\n"
+	.string	"\306SH?@\305(\035\365\226\327z\025s&\257-+\257oa\261!\302\204=\343\335"
+	.string	"\204\210\231{\343h?2\257\202F\350\232\030\2344\020T\201\027\321p`\243\235\260\222:p\334\025\216\326n\262wJ\0012"
+	.string	"8"
+	.string	"5"
+	.string	"\333\251\307'`N\267o0\247\026\355\330\307\222\375K\314\243u`w\353$\271x)\372o\275\340\204*]f$v\327\362\204\002\271\347m3\330\216\260\017\021\005\006L\314v?f\262\205Q\001'\266\257\261=W\316\"\236\345\227v\260\035\")\327\356r\374\260\235.hr\034%\250\227\366S\256\"~E:\302\256*\200kw\344\270!\340\001\214(K\206`N[t\027\277\266\335u\360[64\f\b\230\2200\2474D\206\2222\311\231=\226\344\034\261\257\355\356z\252\354\217?=\353\237_\3752\263\ta'\3628\nv\036(\344>\340v\321y*4s\235\357\023b\200,j\347\205B\036W;\220'T\271\017\254\035\005{\031\237\257\206\236\367U\315\270\327v\252La"
+	.string	"f\232\034\246\323\016\022"
+	.ascii	"2\241\035\034\030.XH%\351\364Xnvy\214]\343\032\020`F\007b\300"
+	.ascii	"\025%\214\013\n\301e`D\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_biquadBankSectionInit.31.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\310\002%\024"
+	.string	"V\244\202J\300\322Q:BX\216\263%B3\257&\355q\246\017E\355\260\336\016\005\225\t\027+\361BDz\301\342\025\204\370Y}`Hi\003\242\255[tn\022\034\005\006\356o\237\034\025\030s?H#\316\302\bP"
+	.string	"RV\322\b\331{\247\024h"
+	.string	"k"
+	.string	"r"
+	.ascii	"0l\377\241\371\200\335\235\247\244\335\336\212Q\306\207\356\335"
+	.ascii	"\200\370p<\001\361\241m6\220\367x\373\032T \204\246v\267EU\270"
+	.ascii	"\276\366\356:m\017+\2356\337\350\t\200Q9\335\355a\r\020\364\321"
+	.ascii	"\021\240\273\251\fvG\301\373>qt\270Y{rN\357;\n\360\227\323\345"
+	.ascii	"|\256 \354\256gNW\342\026o\273"
+	.string	"\264\355\262\347S6\311\213\376\221\023\375\343\207\376\325\203~\361@\177\370\237\277\036\351~\211\211\316\017\nQ\273#\252\250\326)Tjq\244\333?\362}H^\032o$F\032F\"\202\354n\312Cg\030\037\236e\027\335\3600T\"\231\"\023\206\200\022h\320L-Y\233\024,\036\314\336e\330\016\344_-Y\034\\\210\244\335]\361\202\361!\202\372i\377\305\003\300\337\007\0248\036>\3107\355\360O\305\345:NXRBSS\307\361\034\376\231\300\316T\2006\345\204\324\314*\373g{*\260\355\3417\374S\341\355\256\003[\303\225b\343\3566\260\321av\302[A#>\274\357)RB.\246jf\025\245\273\243`\017\365j\216\320\221\256\250HCZ\251M\3430\2373J\214\036\273\2437\273w\233\224'\350\263K2\335\t\244\314\005Sk/.0RF$cf.T8YsYx\241\221e\013Y\2626\220e\004"
+	.ascii	"\262\031\254\366\"i+\277XJ\262\006\003ki\311f\261\330\354\325"
+	.ascii	"\222\301\\\261\326\253\244\265X\016x\026C\226\255\332lV\266X"
+	.ascii	"\275=\335\361\215>2\231p\252\241\270\220\362x\004\212\222P\n"
+	.ascii	"5S~\212\343%\361\364Cf@\331L\"\257\273\273U\345\247$\364'\002"
+	.ascii	"9 \360\002\021\272\311\003\3709D\301\354yh\017\223\237\031\320"
+	.ascii	"/\271\227[\347;\212\202\357Yv\b\335\006\354A\227\314\246sqH\337"
+	.ascii	"1\\2\233\317\305V*\361x\334\022B\233XF\021\254\3419g0\217s\006"
+	.ascii	"\005\324\260\305.hh\324\262\3574\227\201\206\rB\341\313\f\202"
+	.ascii	"\274\034\363Pf/X\330\206)BT\214\256H3\345\274\0271Dd/T\214\367"
+	.ascii	"N\244s\235'"
+	.text
+	.section	.gnu.lto_biquadBankSectionUpdate.32.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\313\002-\022"
+	.string	"\026\242vF\360\360f8\330t\253\023=\232\2330\315\266'\346\003\205\252\205=\216\222;\376?Do\310\\\231_\033\rh\350\2210\313\0040\373\367\013\270K\3573@\326\rfp\323'hi\233\274P\231Wh\320&{o)S\n`"
+	.string	"_"
+	.string	"b"
+	.ascii	" \273!\204\211\005){\n\327\201L\333@\326\246\306\306hwG\214\300"
+	.ascii	";G`{\332?q\024\256\307f\016`\227\207\206\321\256l\304\"\3369"
+	.ascii	"\313.\240;\347=@w\316.\333\306e>\373\0317\035T\340\330\335OE"
+	.ascii	"\334\365t\371\247\035\005\313y=O\rv\327\t\313\371p\353m\027\260"
+	.ascii	"\r\332\252 \273k\345\261\037\373?N\364{|\350O]\350\357x\320\217"
+	.ascii	":\320\357e\272\3134\227\351-\323\232\351\314\364CBjJ'+vo\232"
+	.ascii	"rl\022\327\242\304g\277\375\323\234\362Y\274\310\365\031\214"
+	.ascii	"\367\302)\261\331Y\332\3059p\316(\336\271\224\0310\021\207\021"
+	.ascii	"&\333PL\217\207\022!\244\007\032$\263\005\025\256t\302\351I\247"
+	.ascii	"\366\263\251m\3410P6&U\373\302\221RTO:\264\237T\033\274\2130"
+	.ascii	"\231bW[\345G"
+	.string	"~\r\303\352\303\207\304Lw.\213`7\354\f\247\231\346\355n\202\353Ig\366\023\243\311&\243\322CS\332\241(\365\364F\247\211\036\314~a\345a\026\221\361bw\364e\313^\251=\366\267\r,\225*\024\301\256\265\242\262\nc\272\320Ef\002\204\207\255\224\b+\254pT\205c\352%\034\035t\264\210\253\026\030\262N\006I\306\260\245a\245\372ZD\026\026\021\374ZV),\0378\262>\222\001\026]\302\361k\211\342\370\245d\373m\225\307&GI4Zc\230m\027\004\203\317\376%\240lr\247\266\204\307\250A\241\323\323Q\215\211S;5 0\003\221\251i\003xr\210\232\3313\361\300d\2706\f\262\022\344\252\342\262\355Vy\231v\212\rq\231vU\321e~\002\370U1\242\321Z\302^\232\026\230]\3065\036e+D\245\275\235k\342\301>\022\314o\273\022\314\2140\3200A,\034\320\300H\221;\037\231\254"
+	.ascii	"\013\3530e\210\304\310\025ih\n\370\345E\313\310"
+	.text
+	.section	.gnu.lto_biquadBankSectionUpdateNotch.33.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\037\002e\020"
+	.string	"\366\035kG\340\224(\035\2305\244oY\203PWxv7\263\234&\022tf\3011P\242\241\021G\206\333\252\241\260>!~\254\021\345f\241\323\304\177h\022\t&I\205\341x\326|\324'\332\021\0030/\234\340\035l\304r[\271S\nS"
+	.string	"T"
+	.string	"W"
+	.string	"\016\270O\004\0379\2060P\262\"lh\030\\\332\2479\214\360.\226\233\354\266h\260\335\361\304\n\270O\217'\260}r\037\260}:\264\203|\214\331\003\221!\021\203\310\356v\312\342\341e\350\377u"
+	.ascii	"\"\314\352\022\004aw-E\230\023\267\336v\002\333\025l\231\"\237"
+	.ascii	"\335]k\313>\316\037\272\353\347~\363o\037\377\251\322\252\322"
+	.ascii	"R\245oR\340\210\017\fBvM\324\214\254l\336x\361\234\337\376_&"
+	.ascii	"\361e|F\370\034\025\267z\241\320\302\305\220\335\227\005\237"
+	.ascii	"\236 \023`\234\"\021\264\3466\341o\254\363)\331\022.;`\273{\342"
+	.ascii	"\252 V\017\232Kt\035?\304\231\367\035\013<1q&\325\376\216#E*"
+	.ascii	"\210\3253\343\272\332\244\333\360a&\017\241\030\031\226\355S"
+	.ascii	"\326\020gv\351/\353p\273\333\340\nb\361\240\271Zd\315\234<\215"
+	.ascii	"\277V8q\323\2516\n\204\274h\271\023\223\215\320\225=\256\244"
+	.ascii	"\256\260\037\250\321\350\003\275-\325!\205\364\251\266\225\357"
+	.ascii	"$!\300\247\302A\224\232&\220\224\362>\024\310\036\312\351K\251"
+	.ascii	"\220F\235\t,\225@\2573\221D\245\316;\241:\224\003\006?|\247."
+	.ascii	"\005\202\247\216d\334\177V[\276P\223\265\250\213U\237]\025\017"
+	.ascii	"\206\324\310\232Cjgx\317\314\021\233A\241jk8\317\206) \300\202"
+	.ascii	"\2219\333\001\2672P\024\332C\002\243Cq\016\022\257Yv\355\"ZL"
+	.ascii	"\0031P\353\030\363\016\364\365\226y\023\020\277\004eZ\203Y\247"
+	.ascii	"]\332\255Y\343k\232\243*\331qx'2\351\b\320\306\235I\355\0321"
+	.ascii	"c\344\371\302a\207H\f_Q\214Ka\207\005@h\350\313\2136\223\001"
+	.text
+	.section	.gnu.lto_biquadBankApplyDF1WeightedReference.34.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`?\007]'"
+	.string	"jG<\017I\220\330Q:\222\207/\315\3100\036zz\n\244\313\333\312\3035\241\004\004\3441g\214"
+	.string	"\002\254\t:\362QjMo\003\213q\320\224\210\240D\206\270\232\004\222L\021yC\354\261\276\254\027i\225\327\017\022\324[n\204\354M\344N2\335"
+	.string	"\315"
+	.string	"\344"
+	.ascii	"\247\223\224\217\f\037_\030\234\360\267\212N\212\\\024\230\360"
+	.ascii	"\233h5\375\002\245hQEc\231{\211\021\316+\341gq\355\225\177\365"
+	.ascii	"%\275c\261\327\351$u2)n\225\271\367\026\275"
+	.string	"2\204\363\265@\371\0323S\"s\331p\356\323U\214\334)\363\217\034I\357\303\026\317\2717\007\232\256{\211\016\230\301\371\312\304\367\330\327\363;\366\225{\314cN\024\336\027\235\300\300Bs\357\315\365\016\346\256l&\223\311\344K\342\331\354\336O\323\326\262i\217o^Hr\003X\302\202SN?K\363E\024\220s\221\262QN0+\003\345Y?j\326\270-q\356\2756S\300\362\001\205\232z\242U\b\215\227[/\255\300\310\202S4\336\317:\003\260\260\340T\215S\363\302\275\227ipj\306\231vf\306bf\r\314f\201l\305\322\356>\320\352G\223,\324\264\355\031\2145\234t)M\347\275W\002?J\257\310\356\374\321\242\337\344E^_\312\206>\232\374\275\367vS1\023\235\350\215\330\032-\356\034\314\270s\235\027\274\353Lt\342\257 \301\265\316\b>\374\017\274x\036:\326Y\310\244L\300R\276Y\312A\226\362"
+	.string	"K\031\310R\266Y\312?\226\262\217\245\334c)\363X\312;\226\262\216\245\234c)\343X\3127\226\262\215\245,\300R\016`)\327,e"
+	.string	"\2262\315R>-e\223R\266\225r\255\224\313J\271+e\332\224\237\373\371\332\002\"\313\275QI5WK\205\022\344\\\177\327_\374\265~,\346\033\371\307?\341Z\227\212\002O8\027\n\352Xu\357\315pr\251\b\307\233\320\214\217\320\305\225,\3011\037M\362O\363\364\202\346]a\002\254\362\351\236\376i\233\221\f\037\177\024v\370\030\243O\377\350\341bz\272\002\217\235\306i\236\246F`\225N\347\364N\367Y\030>\342\204\037\016\246\201P\247q<B<,\247M*1e7\035\240q:\b\313\246\005\364M\337\220^\370x\244\210w!c\323G\032\235\213\200~\227Z\237\035\240-\022\210\003@\323\272\3266/|\341Z\370x)b\367\336\t\314G\317\202\364z.1"
+	.ascii	"})`\240\370J\374\n\255-\200\031\022\265\331gW$\320\352\247\273"
+	.ascii	"\025>V\351\0211\321d_\315\256\321\020cd\350\373\027\217\217\n"
+	.ascii	"\204|\346\262\257D\335F\250\033\265\025\264\355\003\207\224e"
+	.ascii	"\327\241.\373O^m\200%\273\357\275\276\262\251\372\215\240\033"
+	.ascii	"\t\034\362\373zL)P(\351*\323\211\024KH<\273\244[aT*\355tLGHK"
+	.ascii	"\246\356,\232V\264\t%"
+	.string	"\243\021%\037\341xHL't$rJ\273\244\244\335QNIg\224\224;\342-\345pA\274C\201\304\3131\355v\274\\\215x\3379\222\374\234BE\213\257\177gS1\315\314&\350\016C\213.$\324\004\372\303+,O\324\214\2317P'\366\"\320B\217\022[\243e\nu\202~\326+\016\2600j\233\212k=J\\\327\036]\364\241\206r\360\241\246:\256\302<Q\263\227\265\301\207\032\327\337z\035\002Fvk\036!=\013\216\0055P\337\332z\001q\374\006tP\003y\001\255l\315\3073}\272\327w`@\3333`\325\317\326@]\215@\253\037\207\237\331\232\366\342L\331pA\247\341\343\315\214L\231\016\032>\336\310\310\202cD\3103&r\214\021\033\2761\016\200\210\250a,\005\0352\204\320\320\214$I\222\326\260\002\221\251\3436\0210A\251\216\264 \255[\016\261\324\327\321\317\264c9]*k\201\201\324\001"
+	.string	"ZX\037\236\032\2416\020\252\221u\020b\331g0nd\227\003A,\355l\013.\273\332\211z\234\002\346@\323p\354\315\210{\252'\032x\367\f\3574\273\326\203}Dk\r\347\337"
+	.string	"\364\026\305O\240\260iZ\031\362sO\246S\372\346\346\3027\205%F\302\356\245y\355\275>P\264\355\304\031\227\333\2246G\335\207\335\227\030\227\220\234w&\362\256\342\361\256X\235\221\001M+\307\007\257\352\250\002-"
+	.ascii	"\032n\030\325\314\232\354\274\023\347\353\340\354\341\024\022"
+	.ascii	":\022u\024\220\204\004\3404\204\373hM\2005\250{\003?@\266\345"
+	.ascii	"L\336\237\216\250\024\220\036\303{a\320\300\206\373-\t46\367"
+	.ascii	"\324\365\031(\347=\361v\177\002 Y*\350\265j\203\370^\001H\305"
+	.ascii	"\264'E\214\326\247,\314\030dK\365\211\335,\027\336k\300s\322"
+	.ascii	"Zv\300\365\007"
+	.text
+	.section	.gnu.lto_biquadBankApplyDF1Weighted.35.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`S\007='"
+	.string	"JG$\017E\200\336I:;\312\263\226\341P\035HV\332O}\356\376\321\004(\251JK!\333\237 \344q\305sz\f\230\\\0339\034c(\314\315w9\347t\227\335\242\222\2136\253!/\007}~\320K\216\323\310&\204\310\235R\326"
+	.string	"\311"
+	.string	"\354"
+	.ascii	"e\3063%/\373\177?\226?\354\242}\373Y|\263\003\177V?y<p;\262\f"
+	.ascii	"\205\347\351\353P~,{qf\226CCy+>\231y>\372c\277b\036\213\203%"
+	.ascii	"\026\217r,\313\035\f\345G$\361\0273\217O\345U\314\207]\225X<"
+	.ascii	"v?.;\302\363<\037|\364\256\374\370\023\210\372\374{\323\235\332"
+	.ascii	"\217r)\346{3\036t\236_jZ\316\323\027\301\016\312\217\366}\210"
+	.ascii	"\374X^\210\374h\323~s\337\221\363n\334l\210\3219\317S\267F\\"
+	.ascii	"\207\303\341\360\242\357\026\251\371Q\\j\372bOj\223\266\325\205"
+	.ascii	"\365Q\2545v$\371\351\252!6\271\t\317Nv\312\325\245EE&>\276'\273"
+	.ascii	"\203\2649[]>N+\207\363<M\267\272z\334\344m\273\260\355\301\256"
+	.ascii	"7\002\377\002\343`bT\220\261\273B:\317s\003\335\017\001\225r"
+	.ascii	"`\302`\271Kr\021\351\216k\337b.1\260D\342\373\267\007\222\266"
+	.ascii	"\206\013H\026\035\332>,\272D\3547\035q\023z\277\354\f$5\006"
+	.string	"\222\272\351e\367\216\244\246@RO \251%\220\324:\222\232\351\277;\302\303~\b\357\375\f\356\373\027\034\313\275\244DR'\221\324\tHj$\0345\202J}T\251\017T\352\\\2456\252\324E\017\273\211*\265\201J]\240R\023\250\324C\225z@\245\026\252\324\002*uP\245\006\252\324\001*\365O\245\366\251\324=\225\232\247R\003\250\324\270J]\226\324\265\244&G\352\261R\213$\365\222\324\224\244\276\206\"/fJ\244\235\347\216\241\2353[l\276\0326c[lY=j\031\324\206[l\006vhw+\006\013,\2015\260\r\314\342H(\260\r\306\230@\b,-\033q6\nK\255\f\330\240\035\332\334\033o\211\320\n\330\001{\264&D\022\332\24373\210\200\275\034\022_\233\260\207\003\264>\033\264Ec\002\354\317\002m\316\314\rP\200\315\2151\275~\366hJ\\M\302\236\fX\257gq\353\263\365\215\347\305\263"
+	.string	"\266g\211\326xM\264\324\230_WN\344G\236%z3\205"
+	.ascii	"\330\377\236~F\267/\003\353)m\2718s\210\313\275\300F\b\3652\006"
+	.ascii	"\246\231_(\254\310\217L\353S\304J[\257\356\270\021v\343\360\234"
+	.ascii	"h}\271\303\220\344\326=\257\211\026\035zi\311%\337l\334q\324"
+	.ascii	"\305XY\360\303\230IR|\364g\220\037\307=\360\017\202\303\266^"
+	.ascii	"\026\035\356\216\241\325\350\332%\202\026RSQUOP-j\225\n\253\026"
+	.ascii	"PTd\324\241\254T8\271\030c\\\301\330\024RN&D?1QAU\251\210:\241"
+	.ascii	"\223\232Z\261b\352I'\025\345\264B\367D\325B\307d\344)\026PT\272"
+	.ascii	"\252\251)*\035\217\357\374~\331\242\250\264D\"\320\312d\255\226"
+	.ascii	"\223\326\017JI\332\361I\020J\202\365\271\374J\202\035\237ti;"
+	.ascii	"C\332\236#i\266\330v\277\362\301\300\013H\n\236t\201r6.\021\343"
+	.ascii	"\334\312\266)o\350\203/-\327\201/\337\270\220\331\243\275\330"
+	.ascii	"qf\246\374\250\270J\313\265\264\b\366\275*dhP7\333 \350\351 "
+	.ascii	"\202=bsQ\204\360\245\315\260'\373\350\2256\347\300\032\355\321"
+	.ascii	"\216A\236\227Vn\017\2308r{10a\323\032xS\032\347\231\245\204a"
+	.ascii	"\307\24252u\024\355R\210\327i\332\312\373\265\365v\353\013\327"
+	.ascii	"\213Y\333\217,?\016Z\200\215\250a\034'\241C\206\202\031\021\221"
+	.ascii	"$I\322\030\260\202\221)\"z\021\020\265t\020\235\324\243\003*"
+	.ascii	"\b-VV\001\2462\245\311\346\251\345\261=\276\214\t\361a\217&\255"
+	.ascii	"\"\220uaqmI\232\274\025*di;\365\272\217x\354\264\005q\343\242"
+	.ascii	"-\2131 \251\341\302Z\304pAhG\207i\231\324\346gh\007$\021\266"
+	.ascii	"\305!\316\350\2069\035\n\2536\032\311w\361\204\245\2753D~R\322"
+	.ascii	"\203v\367\377\323E;x\007\204\201\033\342\323\226=\032\346\250"
+	.ascii	"\201\r?\033\342g\023\352:\332[E\253O{\210{o;/\261-\341?\013;"
+	.ascii	"\241\275cw\240\335A|v\327?Pf4\374\nB\266v\365\330\200\365\b\001"
+	.ascii	"RwG\314D\007\bLG\313\2737e\274\220\320\202X\225h9\220\324\363"
+	.ascii	"\261!V\2077e\370ri\341\313\317\355Q\2351\257\n @S<\314rE\366"
+	.ascii	"{Yh\324i\302\310\332\006\321\r\330.\257\024\325\264<\024\004"
+	.ascii	"\222\033\260\177>\322\205\220\f\212\232\347o\277\216!\250"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.36.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\\\001\315\r"
+	.string	"v\031\\E"
+	.string	"\2216\035\033&\0212P\326\230X\367|\221\234\227\205uU\033\266\\/\032)d\236\301sZ\202\200\372\350\225\276q\317 \250>\031\342,M\250\022"
+	.string	"@o\\\342\030\330p\260q\330\2261\376O\263\273\333\226)\005C"
+	.string	"F"
+	.string	"K"
+	.string	"\366S?\341\335\245\344\001vQ4Z\354~\t|\340\272\364\367\001\363\362\272\200yi\317\246\371'b\037j0\305\250v\027\213!\356]=\3771\007pJ!]9\rv\327zJ\351p\307\333\356\260\375a\237&\366G\322\b\302\276\265\273\353\210\262\017\363_\177\371\347]~K\252U\252\377y\315\212\312\006\006\031\273\034npl\f\351\202\204\355{l[0\236!"
+	.string	"\332\223\024-\f\342w\024\336_F\n\332\223\322\006\005\327%H\257\001\221d\353\2061\0375\036\245D\351\261\263\nM9\034\332\326\016[\302C\2077X\260\250\256ho\227\361\214\364"
+	.string	"\256Tf\264\271\257\340\230\300\026\225\217\246]\341*F\327\356.\360\301\013\"\237\031#J\346\345G\312\304\207\224\215\211\336\004!\026\036\304P\006\315\001\t\007A\244\221t\2463\217.42A\013\301D\334\266q\031&\322@6,\353D0\217\002\346(\204:l\204\343:\314\363\355\255\215(\313\232\225U\r\223X\262\237M\033\344/2P\206\305\346\243\032\021<\202\246?\331"
+	.string	"J\034"
+	.ascii	"i\231\"\023\017\377\242\301\203K0\224\253r!\2135\276 [S\201\002"
+	.ascii	"D\220b\317\321\324T\bLRT\207*\334\267\270S&\254v\r\b\260\241"
+	.ascii	"\225P\016\346\222\020,\b\237\251QpY\232\032\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.37.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\207\003\375\026"
+	.string	"&\351\215J\300\360*\035\232|5\203\016\213\321{\277\261r\203\211\324y\306zY\245n4\305\210\335~\204\310D\037P\200_\244\351Kh\226'\367\341\3067\t\313]\024E\327e*J\205\023\325^\221\321\223\035)\002\332\2665B6\331R\312\024x"
+	.string	"n"
+	.string	"~"
+	.string	":\265V\220\017X\376\027\270 n\033DY"
+	.ascii	"\265\266\030\351\324\032\004\371\007\271\342\203\344\377\357"
+	.ascii	"\207\245\271\375\302\031|\211\241+\024v8E\265\326\322c[t\305"
+	.ascii	"\271\033t\305\276\260\267\245\342l\276}\307\221\231\204$\344"
+	.ascii	"\371R\226FXQ\345s0=j\255:\236,\333\363\343\227\202E\345S\231"
+	.ascii	"\255 \013/\366f\271\347\3131\217#\265\3263\317\007a?\356\377"
+	.ascii	"\331\177\221\277}\002\t6\304\205d\255U\344\213c@F\306\240\320"
+	.ascii	"\025\267]4I\277\032 \216\207\1770\205\333\345\337Y\273\245\203"
+	.ascii	"\344\273\326f\267\265\301\335\r\222\317b\376j\344\253(?5\371"
+	.ascii	"\250\311?1\337\304\374\022\363I\346\217\315\247\"_\024\371s\362"
+	.ascii	"\273\371\314\374\r\260D\025\212d0 \252ue\230T\201\304\235\f\377"
+	.ascii	"o\377\351?\363\332\\8Y\265\227[\t=\035\206\026\003\357\007\324"
+	.ascii	"\355rT\237\372\300M\013\025>\372\377\332\0230T\2270\300S\373"
+	.ascii	"\3008pva\264\373\324\004\216V\350~&\236R\233~\271\235\013K\335"
+	.ascii	"3<F\300"
+	.string	"Vs\274\234D\360x\230@\2660%\264\274\031co\223\3154t\032rk\242v\341\3679t\305\261\267'Aln\332\253\3430\367?t\266\330\023\206N&\307\303w\317\336]\215\222%\001\353\016\211\355\210\347p\013\200y'\013Lf1\221\376\025R+9Q\020CP\316h2\031\355U\316b$\262\362U\263\225!\256\323LJj\345\t\215V+O\301\272\263v\313Yt\365n z0Q\315\352\336\377\216\366\300u\356\2536uG\257\016\205\252W\275\272\030\254Vu\003$\341\256\006\216\207\223\262\330\022/\256.1\327ZSD\033M\365\312\334\270\b\262\245\272@\r\320l\227\265\321\237dU\330\306]O\321\020\016F\177`+\241\231G\250Q(*\0213C\025\210L\"%I\332`\"\221d\327\001\021\240\245TT#E\005\333\f\351\022\207\013\315]\3322\234\033y\007\246`\341\205.\020jpH\321:\2240"
+	.ascii	"\225\265\262\207}\203H&R\201N\226pX\244\307\006;\361\210\327"
+	.ascii	"\342\356+\n\247P\032\bc7^J\233\334\212\022\032\272\257+\027\206"
+	.ascii	"\036\377 +\263\325\244\354\203MQ\013\335;\027\232\2337\265C\272"
+	.ascii	"\306\250\022\222\307\330\3124>\224\257\235\371\b\257\275h\344"
+	.ascii	"\265\223U\2205\226z\200J\365\002\324\206UZ\217d\025\001\272\331"
+	.ascii	"E\232b\n5"
+	.text
+	.section	.gnu.lto_simpleLPFilterUpdate.38.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`h\001E\016"
+	.string	"\026\033_B"
+	.string	"s\224\016K\334\021\226\275\240.\325\237\001\231\004\037b\254gSJ\221kI\341E\355P\300\t\2545\304\306a`\347\2015\232Y\257\210\244\252\252\277\377e\bA\224\361\300\366w\304\214\301M\366&R\246\024I"
+	.string	"H"
+	.string	"L"
+	.string	"\1771z'\372\200]U\017\226\335n\304\013\342\237\273h\333oq\027#sXw\"\005W,\r\255\227\335\325\020\274"
+	.string	"\374\303N"
+	.string	"\376\251\211sO\316\177\353\330\n\227\016T\212\364\314$\354\256\023\225\362p\353m'\260\035\301\376K\335\037@\323Q\323\231\246\241\246\237\2461M\253\246S\323\0279\020\"\207\350\265\313\341\345\332\226Wcu\225\337\036\371-cl\253p\221\324!\256\254d\370\330]\006\177~\020\363)\034&`3\220\330\300\262\273#n\220i\237\025'\021O1\nUo\\\370\214\247"
+	.string	"T\270\004\301\364\t9\2450\345\313\251WU\005rr\231@\217\221\252\200\207O\016\203\213\273\353\300_\251\200\022Q\374\371\"\370w\315>\270\260`\225\362ew\244\324\022\366\261U\225}\225;\363\224\037\363!\316\th\363\201\234\222\t(\033\017\204\326\220|6!\216\t\005\315\263u:\233F\363\230\224t4\315\007\244\221\030\360fa\363\321B\333\366\3210\335\036[UeTd\004\210\226\222\232\3744jF!\270pD\245\221\331q\324\217R\246Q1\3308\r\201\212i\246\331\n\035"
+	.ascii	"i\231\"\023o\374\321v\255`\247\232\006A\264\314`&\222x\321\034"
+	.ascii	"\n\213\300\342\360\016!\262\322p\340Lc\240\035D%\202\351\254"
+	.ascii	"\034+4\327pB\260q\204&\310E\211eb\bI\310%P\346\240]#%\305tM2"
+	.text
+	.section	.gnu.lto_simpleLPFilterInit.39.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\365\n"
+	.string	"\266\323IA0\247*\035\020m\273K\365=\303\n\213\r_\234|~\233\216\333g\b\327\301\004\225\016<\275\305\332\020\302h\231\224$\rXd\023\250\215\255a0\240\212\b#\341\220\260)b\326\226;\221O6\331;\2452"
+	.string	"9"
+	.string	"6"
+	.string	"\337\253\3137x\257\337\031\274W\2236\203\227*\373\331\f\025\303\355.HY'?I\377\261#\244T\246O\213\305\356z\246T%7\275\355\b\333\025\3661\002\237\337C"
+	.string	"\005%\331.I\356\301\326*\002"
+	.string	"\266\177\261a'\232Y\236"
+	.string	"\371\027\251SX\021\224\021\332\356bL\361\275Bt\237\366\005|"
+	.string	"yW\351\013\273+\033m\267\304X\"\016:jw\334@e\335Z&\023\267=^\200\364\355\256\306\227\201|$\330VJ\336kE-\30058\315\234]\232&M\261\337\355\356\232\256\354\303~\357\257\277\273\353\001\243\347\263q!\362X6cG\243\363\314\311\210\235\221\343\343\001C!\b\024r\300\320g\003\0029\342\b\31488\024uDp\fC\021\274\224\373n\351\312\031\255\332\211\206\330\243\366\350\007\022\334\002\025"
+	.ascii	"i\231\"\023/\306\321\342\202\n\336\201v\037EZS\346\270\355\325"
+	.ascii	"1k\215\013\303?\214\001\346\300`@G\222\020\027\246b\200+\322"
+	.ascii	"\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`\004\003m\t"
+	.string	"\264\f"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002\005\177-\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\006\177.\007\177/\b\1770\t\1771\n\1772\013\1773\f\1774\r\1775\016\1776\017\1777\020\1778\021\1779\022\177:\023\177;\024\177<\027\177=\026\177>\025\177?\030\177@\031\177A\032\177B\033\177C\034\177D\210\256\217\005\035\177E\036\177F \177G\037\177H\320\231\263\346"
+	.string	"!\177I\"\177J\310\376\350\017#\177K\360\372\2508$\177L%\177M&\177N'\177O\001)\177P\377\037"
+	.string	""
+	.string	"\200\200\200\001(\177Q*\177R\003\020$\204\001\003\020#\244\001\003\021\020\"\003\022\023\027\020\371\321\360\372\003\001\242\007\003\032\033\032\"\003\034\030\037%\344\001"
+	.ascii	"1 `\203DI\016\325\201\017\021\242\265\007\026J\252r\253\f6\264"
+	.ascii	"\365\320\263a\\=\034\201,MK\377&\030\331K\273\317\361\347\320"
+	.ascii	"\311\347\024![\202\230\337\200\360o\370F}C\005b|\3437\276\341"
+	.ascii	"\033\337\360\r\337\370\206o|\3037|\343\033\276\361\r\337\360"
+	.ascii	"\215o\370\3067|\303?\\\353\217\001"
+	.text
+	.section	.gnu.lto_.refs.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8e707b7e99e6f28,"e",@progbits
+	.string	"(\265/\375`~1U\300"
+	.string	"\252 \271?W LA:\351\256?3s3g7\343_\317\006\b\355w\1771\222fn\240\316\032\371Rf\022\tWW\333H\355\311\240\256\f\337\201\227\230\235?A6\001"
+	.ascii	"(\340\306o\253\205Y\276,U)~\317@\350Z\320\243\325\005\343\361"
+	.ascii	"\351\225Y\267\361\214C\213\021\r\311-w\nW\003\353\003\n\004v"
+	.ascii	"H\254\225\236q\244g\253\364\f#\275]\361\362\020\257\260j\203"
+	.ascii	"H\202p\263\220\214\223\251."
+	.string	"\n\367\371(\r\364\213\276A\371\273\325\260V\251\207\fT\251\324+\034T\247T+\365\311\311J\370\032\245J)\204\342\365\007\366G\003\350\327\354{BG3\270\345\027%\342\207\344/\032\025\302\366\305\311*X\233`~\321\031\"@\256\204(\350\263P\312 \b\323\327\300\364\025J\372\372$}m\222\276\356\245\257x\351\253]\372:\227\276\306\245\031\274:iR\227\177UF\334|\266Y\345\220\n\221%uyty\025\217O\2572\251{\365Y\363\352]\313\025\275*]i\277\216\245\257[\351k\016\273\272\226?\030=\244\270\351\206\260(\233M)T\351+\221\261878\270$p5lm\256*\251r5\256>+\\E\362\372V\223\f\201\371r\326\275\275t\275\325\003qCm\221\276&\0351\022#\250\267U\307\335\366\001\246\250\357\005\035\367k\022\r-\354\254z\251\2455\327j\221\312V\237U\255\246\275\016\251D\204"
+	.string	"\271\2247\322\276]\365@,\326\016\304\243H\317\223\376\365\354\325\314*\221\250\234\034`\262\216,\003\271\313>h\200\t\330\013\356\223H_\277\306\276&\343ro\222\257\346\210\037\254~Uh\r\373Z\2653\273+\236\t(D\352\",\274\367\222\325\032\352\263B\253\330\253\220\352\365v\336kv\357\365\300\203\017.]3\270\206\210}\022\322' \235\340\356\212\3604=\247];\0203\250\036\210wV\017\304\264v >\3755\305_UtQ\f\334s"
+	.string	"\006\314\360\327\033\2669\376\265\304_O\374\025\347\257&\372\330\002\317=\374\355\201\024h:\020C\205\331\201@\215\300\n&\324\023\032\320\0030\341\257)\374\325\001\177E\341\257\017\370k\t,"
+	.string	"\035\026\372\204\277\322\374\025\204F"
+	.string	"\007,\003\177\340\035\376\236\240\203\207\013\376\372A"
+	.ascii	"\177\265\340\257\001\250\340o\373\342o\375\002\277\341\267M\002"
+	.ascii	"\365\016\377O\371o\370W\376_\345\177a\005J\234\303o\313\202"
+	.string	"\036\363\333\264\377T\376[\371k\375\177\245\336\361\315e~\373\366\226\345\206\343\177\336\377\275\377z3\312\226V\374W\022\367\037\356\351o\223\\ \330\332\271\371\257\366\237\355\377\332[~[se\001+\n\234\345\267'\374\257\341?\364\304\337\232p\376\255\002n\177\273\301\317$~~\341g\027~\236\300\317)\374\314\200\237\027\360\363\007?'\340\347\016~\316\340\347\001\374\354\341\347\342\317\365\257Q\376:\370\327\300\277\372\375\265\357\257z\177\305\373\353\333_\335\376\312\366W\261\277:\377\312\365\327\255\277j\3755\353\257W\177\265\372+\325_\247\376\352\342\257M\177\025\301_m\376\372\201\277\272\360W\t\374u\304_+\370+\007\177-\300_\t\360\327\376\317\367\237\356\177\333\377\262\277\032\375\325\347\2571\374u\305_\203\376\273\360?\003\177%\301_G\360\327\235\277\352\374U\206\277\276\360W\013\374\225\002\177e\341\257\023\370k\b\365"
+	.ascii	"\1775\300_7\370\253\006\177\315\340\257,\377\233\374\257\373"
+	.ascii	"o\344\277\331\377\n\374\207\341\277\334\177\016\016\017\017\017"
+	.ascii	"\377\364\001?\221\204\177\203(\001\034\224Pf\323\2052\357\206"
+	.ascii	"+\004\304T$t\2318\\(\023\360B\251\2326(\241TMJ(3\252\342P\376"
+	.ascii	"\0256\315\345\250\352\252\200J\241\253\224$\005\304\264\301N"
+	.ascii	"\351\244\272|\367V\263\241\313T\200{\245\250\230\370\200^T\266"
+	.ascii	" ;\245\240!@T\026$\005UQ]!;\245\017\252{}\004\235\270I!$\235"
+	.ascii	"v\027\253\332%iH]\244\241{/H\2727Y\257\335\2757y\357ma\222r\336"
+	.ascii	"\013c\203\262\231\224t\357\362C\322\225J\026\031\272\227\315"
+	.ascii	"\234\2605)\241UT4E\310\240\315K\344L\326\346\345c2\245\320\344"
+	.ascii	"\363\"\t\246\315&\247@{d\215\\\242@\227A\270\213`\200x\265\265"
+	.ascii	" \263JKD\204\205d\353\013\204]1\343\262'\030\303\314\207\r\002"
+	.ascii	"\354\203\252\232\221\332k\223\365i\201\356\214\261@"
+	.string	".\346\326@\020g@\020\277\306WZ\214\352\271\241\350d\220\210Y\224\241\025 1#\205\334Ub\224`P\241\301}\226\025\351\253W\224\263\346 \013Z\2055\2450\024\026lj\2612\033\222*d*\\\310S\352\223\2450!\013\322\031\034R\332o\303\364\315$}\347\245\034e\300\372\274\033\007\336E\310y\241\025\353-\211\245$U\321R\357F|\277\375\361]\213\020$Uf~W[\372*\334\343'}A\256\270\205q;!vi\311\220\362\334\343\266\253\021\005\231\311q\234\f\320\206+\024\364\325\344#\274\307H8\316:\331R\2421\260<n\302z\314\204\371\352\223\367X\311y\216\351\376\341k\217\2158o\016\"^\330\220T\241\b\021x\217\353\370N&\351\274K\304\252\263!\251\302{\235\036xP\2242\327l*6\3371/a\274\363\035\333]\204\b/\n]\257{\235|\327\367\002\325\252\201L\255\032\260\270\351"
+	.string	"\032#\366[H\372\366\221\326\017=\225\276\221R~\343$\365\331\001\303\235\335\370\310Y\200\234\327y\257s\206q\030\236\215q\277\203\322\327\016\210\366\360\260v@\274-L\271v n\260\177\351\255\223\"\035\b\031I\363b[\233\372\022\013\344f5\016\224U3?\350\222\242\274\245D\240\312 \251{/\005)\246"
+	.string	"\332\030\362\024#\203\254\006_\032\232\322m\307\024F\343\263\246\2631;n\035]\305\345\026\b\2305\306dl\306`,\306a\354\344\032\370\311\320\372\3442\306q\366\342\257\250\022\036R\324\317\250\tE\331\334*L\212~\t\022\341!\375\025q\235\313\352\023\026\"\204w\324\034\214b e5\320\b\017\351\203\007-Z<\222\314Q\320,\316$,\344kC\322\"BC*\334\334Es\016\302"
+	.ascii	"\0344\202p\333\332\201\b\202\223\355\207\217\267\276\032Y\334"
+	.ascii	"=>\274\030a\236\275@k\362\r\316\"a\210\311Ei\fF\364^\347G4\331"
+	.ascii	"\306\335\354\223)%\253\202\212\362`\255\372\344&c}x\242\372\201"
+	.ascii	"F\314\332A\0343\223\342\304\255#\255R65e+}r\016\306\361\337{"
+	.ascii	"\241@\236v\334\267\314\364\026*\275EJo\207\322\237\257\226\\"
+	.ascii	"icI5\254\322 C\216\324\315\234q\335\260A\243\252*\341\"\303r"
+	.ascii	"\026\327\216\202\226\314\344\213\217/\2538\356\237gP\2610\305"
+	.ascii	"xR\343\226\221\376\261\245]\021L_\275\212\270\242x\212a\260T"
+	.ascii	"}r\fF:'\261\322\210\243\257\331'\023\005Cx;b\360\022C\331'\223"
+	.ascii	"\013U]\321\257\030l\224\345\001\361\312\337\n\270\227>C\375L"
+	.ascii	"\304J^2U\0050yU\200\274q\277\230\001rC\355F]\372\021\203Ql\354"
+	.ascii	"\304-\330E}\362\023\263\370\022\224\301\346\365T\243_\223\021"
+	.ascii	"\332p\217\202n\304X}\341\301\245}NK\231\211\346\334\324\201\310"
+	.ascii	"\264t\316\300\314\320\261\324\306\375Chz\273F\314\301$T\334]"
+	.ascii	"\365\222\324TM\325SVX\336\232\362\316\244\364\213~\321S}K\321"
+	.ascii	"4\213\211\r\271"
+	.ascii	"\216\361\236j\251\352\263\243\343n)\227\353\302p\217\273\243"
+	.ascii	"\032FC\365\262\256\225Z\251\237\376\242D(+D_\335\342\375T\354"
+	.ascii	"\341%\005\213\273\231\332\211%\016\253\020I;5\013\270\245%\301"
+	.ascii	"\036E\031W\334\20441\026SL-\311\335K\234\365\302\323\023C\267"
+	.ascii	"\247\"B\346\330:\250\203\032\251\211ZL\037Z\224\221\2437\222"
+	.ascii	"\213\2149(?\270[\331F2\200:\362\330\332\250\213\230\356\212\255"
+	.ascii	"\317\217\310\325\020\356&J\257\310\244\226\355G4T\243\207z\005"
+	.ascii	"\031\024%r/\206$\217\\\264\020\263\360[q\007\305}\227\256\302"
+	.ascii	"\302N\236eE\213WQ\336\016\271\337\311\23132\031V\354!L\334R\333"
+	.ascii	"\214\303+z\200\202M2Xr\034\335\035\0312\222Q\336\326\fn[\245"
+	.ascii	"\205\213\307%\342\266T\276\006u\225\303\214\333N\261CV\212p\354"
+	.ascii	"I#J\224\250&\023\255(5\270\357\302bp\320\0066)j\016@\351\305"
+	.ascii	"\027!\024(6\220/\025\021_\264fU\r6\001\336\006\256\025\225@\204"
+	.ascii	"_\3346Zu\326\304Ej\347\347g\373\230\304E\363\234\fAc\302\304"
+	.ascii	"\366\351\3155g\234\205yXNn\373\304\220\342\246p\333&v\311\314"
+	.ascii	"[Q\230!\267\345\373Z'\021#\022\345>\241\035\"\322-Y\241\262\245"
+	.ascii	"\247g\361\352er\022}\361\372;J\263\202\203\263xzU\232\251\037"
+	.ascii	"\023\033@w\267x.^?\322\230\334\226\316.\201\212\261\035-\261"
+	.ascii	"k)B\303\006P\035\013\025\255D\0052\251\253\204\326\0073\210\035"
+	.ascii	"\267\235s\002I1\342\266J\354\220\205\332PB\271\255\334\234\016"
+	.ascii	"'+n\033g\205\322\242\0371\274R\026oozkU+\313J\214\373)P[\233"
+	.ascii	"u\323a\313\232\300\224Gn\335\216^ 1b\325\212E\236HW\201gg\226"
+	.ascii	"\255\206)\242\334\230V\217\265[6\030\245=)\227\333\246Y\265\242"
+	.ascii	"\234\024\251\245\032\221\031\270\263\030H|-^O\206]C\352\335\025"
+	.ascii	"\260\2611n\213\206\007\205\332\262\025G-fq2\204\310n\313\354"
+	.ascii	"\035\024\024\212\333\326pDL\314:\2574\335\320\224\207`A\202X"
+	.ascii	"\347_\2126\205\005X\330\255\263\270B\t \034\267\025b\301Z\252"
+	.ascii	"\330\025\005Z0\373\305l\221\034\242{y\3421\024\350U\221\324\260"
+	.ascii	"\031E\016[\232\\\\J\210KGj\3541{\364\260[i.l2\246\302~\334n\265"
+	.ascii	"\310\261\220s\343\266>Z\234\264\264l\026X\263\225b\030\2710\304"
+	.ascii	"\302\262YcY\334C\357"
+	.string	"\306\215\035\267YUHP\213\"n{\303\352\220\351\001\007\264\245#G\361\253\213H\252\315\245\315\212\013/\0345\255\211\240\250\360\200rue]\324\245\tx1f\f\013\335b,a2\255\0257[\310\202\222\2422U\234Z{4n\255^j\260b\365\204\333V\265QQ\341)\233.[L2vx-\227v\352\t\225\350].A\304X\031R\022\343v\352o\206\353J\332\023\267\205\262RE\247\031\205kV\312Fi\351PzQF(\344/\bF\025c?%(Vv89Y\027\033n\320\337\223h\372\004R\007\343\351\326E\317\340\203\272\342\266-\276\246\366\344\303A\244\262I\267JW\262M\351\275\367\250\031\270,\274K)\020.\205Y}L\267M_+\336\213A\214\027\235\223\222\333.\331\243\031\240>\303'\356\023\272\324\037j]h\203\351\211\027\210\351\336\313\202\305y\231\202\212\257,\265\202\370c\252}\337\373"
+	.string	"\3548o\222.\307`\332c\r(\2123\270\277\335\275B\314\344\003\230MB\314\027J(\363&\205v$90]fR\t\275\227\303\025\022J\246@u9(\241\267\351\256\270k\252\327\311L^!\252\313\341\n]\240\f\224B\314&%\024\250)8<96>\310\037\236\343\215\t\236\034\037\344O\bc\t\024:7<9!|~P\204\240\200\347\310\323\202\2541\322\220\363CLq\3649\201<\362\264\340\330\030u\032i\374\3311\356\020yr~^~\342\203\237\023H\233\035\025G\237\236\036\233\232\237\343\315\313\004/"
+	.string	"\300\202\n.0\336\360\030}\2148F\fl\200\201\207\ndzP\310p<\266@\001"
+	.string	"8\2240r"
+	.string	"\003\032\025R"
+	.string	"\200\n/\264\340A\205\027Z\350\260\341\002H\343\n332#F\214\030!B\204\210\030\031\034\234#\022\005\nF\244M\211\036\rx@\346\360\260\300\223c\263B\314of\320\351\3519AG\007\005\317\314or|\214<F\023\351C\030A\001#\220\240\242\345$\224"
+	.ascii	"B\t \020OB\t44%\214@\223~\004\032\213\374\251Ik\214=3d\300\346"
+	.ascii	"\250\203\303\202D\342\344\234\200\241"
+	.string	"\007\247\345\347\307\246'\305\261\005\243N\317N\316\217\207\036\034F\326\210\030\201\344\311i\261A\032I4R\347x\204@\rK\t\343N\216O\217\t\033\037c\bN\250@\t\243\t\0236:\036T\030K\360\260\300\001\016\310\232\021h\220<9(R#\r90\2448\226\340\311I\361\262\203\002\006\023<9!8\356\270\340\240 a\2215>G\344\215q\0030\360\034s\2207\306\237\364\247F\006\036\033\b\024\221<(\2167,\310\t\2205(t\370\301\3011\036o\210?5F\035\0226\0318q\203<\2720\001\r\022\340\311Qa\263\303B\203\004|\214/\374\364\030\221?/H\344\t\0239\306\024\304\0226(@\220CB\006\004\022LC\202E\220`\032\033\026a\3034*X\204\n\246\231\201E\314\300\310\022:\307\023?F\237\023H\227\"2g'\247\205\024F\235\037\027\344\bd\017\214\b\021\310\036\030\032\"\362D"
+	.ascii	"~\3541\372\204@\036\217>!`d\250?5*\320 {`NC\203B\006\032pa\205"
+	.ascii	"\364\346\003\037#R'\007'\004\317qg\347x\023\202'\307f'\304\215"
+	.ascii	"\317O\210\017.0\"m\220?,w:a\330\246\316Zt\264\357d\354\302\016"
+	.ascii	"\261\360b\340\356\336\250\376\220\\\234(Y\362\360\233\"&\361"
+	.ascii	"z\024a+.3\342\341\304\275\267\327N*\023S`\bpZ\313\026 \376n\362"
+	.ascii	"v\2625\346W\204\273\371\276\366\264*r\307\335Lv\350\265\332\331"
+	.ascii	"!\340\223\316\303#\022\204\005\203\273\355\215\244\255\357\354"
+	.ascii	"^\361&\305\356R\313\032\334\035]\341U.A\300<\217\236K\346\336"
+	.ascii	"w\357%\"D\270_\312\265\265\007\304\335v\357\272\345\\[\224\256"
+	.ascii	"\353~\227\227\036VP K\351\025 \346\242\251\211\273\225\334\217"
+	.ascii	"}\370!\001r\267\334\335\212K&\205WqtUxA\334\375\326I\352\363"
+	.ascii	"r\rw\2316\24239e\372\022\324\313\021\373\310\333\255m\312\212"
+	.ascii	"\311\375\3425\202\266\027\325\254\222\036f\220\215\255\325\352"
+	.ascii	"\006g\220\236\262\031\203\330\216\300&\351\207\364\220V\253b"
+	.ascii	"w\t\203\"M`^\205\367.A\244\311g\013\037M\344\255\266V\346d\311"
+	.ascii	"\030\031Y\243\255\255\275\360`\221\367\343\354\215\346\362#H"
+	.ascii	"\324\034w\233\265XM\213\261\262%g`\264\t\006\326P\003H\261\013"
+	.ascii	"\\\026\306(\231\246\202\214\275\241,\330O8x@qwX\213\261\274 "
+	.ascii	"$\253k\261~BY>\223U\232\226`t9\231\320\311<+\302\202\304&>f\020"
+	.ascii	"Euu\265\327M\002j \310\026\270,\234A\345\264\327B\336^2sA\246"
+	.ascii	"\b\271;H\377p\231\013\3032\002\223\354f7\033\210\005\200\315"
+	.ascii	"\300e\341\215%\262\245\336z\003\371\033J\232\312\342n\036\375"
+	.ascii	"\203\n\026\f\"\375\243}\340X\03219\231\311\323\241"
+	.string	"d\243\007+Qa\027\325\343n-\216\253JA'\271&;vt\016*f;\200\034\252aau\2164\264b\326S\324 \216w\216\350\020X\016\356\276\321NVF\rP\230\324R-$E[7\230\314\276\352\313\361\342#\020\032\245\306\373\252\247\230V,\270\333\212\263\304\276j\030\341n\032\035\204n\250\323cd\211\244,\225Q\314!\222`$M\222\0163\026@0HP8\030\266U\363\023\200\224\007\023\272\024F\235\203h\204F\222$i?\003\020\022=d\336M\302(\311\371\025\304\215x\226\327\272\311q\"\256\266w\273\303\225\373\267\016\3216\302%nm%\252\023vq\031k\362J\\gy\226m\2744?\370\305\263x\2555\210\323\354\007R\021z0"
+	.string	"qFx\274\236\003\221Y{\307+\357Q\246\357\b\025V\223\353k:\256\257\265#aD\nO\304s\2642J\320\334Bfu\313\271\034C\0040\31688]\234\373\356i\330\022Z\b\306\0244\212$bjS\031\207\004\232\225\035\213MF\371\2044n\276\nw\rRs\304'7\324\204\216\205\027\"uN$x\232\243\213\326\f\013I\220\265\261\266\3008E\261:\301m]\233\350\3515\371\226(a"
+	.ascii	"\227T\304\021m\2134\254\230>\352R-\2358G\237_f\310\273\256\234"
+	.ascii	"\333\353`E.\240\217<\375\370\037 \360=[;y=A:\300\313 \356,\314"
+	.ascii	"\202\230W\376\210\002-\237\325\314\325\026\"\243~^Uk&A\031L\\"
+	.ascii	"\206?\320\026\371\004n\177S)\212\242\\\025\001#g\333>h\361\030"
+	.ascii	"U\253o\314\bH\"%\202a~\366\02050\223\342\256\364\206\304\224"
+	.ascii	"\305\264\246+\004\201\256\202d\206\310Z\177\350\322j\252\fkX"
+	.ascii	"h\374*s5\004\007=y\335tJC\225\253CK\335\267\373\027\372\037\242"
+	.ascii	"5\344\347\211\247\032\301\307\340\032\"\204\364\022r\260\211"
+	.ascii	";4\245I\006\264\343|\353\335\226\373G{\3332@w\357\\n\325H\250"
+	.ascii	"!\270\311\2717L\352z\335\022\002\330\373\251\252z\373a\233\367"
+	.ascii	"\333 +\210\240\200\204\351:\003\253\214#\211l\036\223\373\345"
+	.ascii	"\221q?\333\234APB\364/\324D\203\371\032:\332\351\302IC\016\363"
+	.ascii	"ph\037c\247\260\247\200\023S\007O\224u\231\356\346\2545C\021"
+	.ascii	"\021\"\232B\005\022:\276\246\235\256\311\2568P\313Li\006\023"
+	.ascii	"\275\364ofF\016\2213\340\221-\302\273\204&S\032\270%i>\363\340"
+	.ascii	"\177iO\3542G\367\325Q^\212\340t\337T\276\340k\315\226\364\247"
+	.ascii	"\345\247\301\335s\224\264\227\024\334\216\235\257\367\304\277"
+	.ascii	"\026\323dn\251d\331\356lwP;\036\256\220:\271r\356i\301G\006L"
+	.ascii	"\213#\350\311\"\264/\211\344(\212!\234e\300\023\023\002\\\306"
+	.ascii	"^~e\314G\202L\256\274\304\177\316'`\222d\363\200b\301Q\227c\341"
+	.ascii	"\326B|_\237\022+>\205\001\241\344\026\326.\276-(\334\247\306"
+	.ascii	"\250\3719\017l\371\352\212\365D\250k\334\353\351\247\301\350"
+	.ascii	"\005F\306\035>\264@F\343Y9\320Q\234\274\201[\341IN\255\316\217"
+	.ascii	"\333!\032x"
+	.string	"\217\235\b\214w\343xVF\334\371\374o0\307\300\275i\225\337\301\274R\245|\224\205p\022\263^p\252\t\353\240\230=\223\315\313|g-\304~\013\340\244|\304t#\021f\217\030\347\234dP\265@\214\fl\325\367\276A\257\236\217--1\033^\362\2542\354\002\005\274R\177\355\346\263fa\243\202\342~BH\f\220\245\006i\336\267\262a\200\271\264\201\241OJ\b\321ev\366\365\243by\270_\r\310N\233\302f\334\267\"eu#(7\036\375\305\3517lV\034\247_\007\376\f\001\245\315s\331\031lg[.\206\240\347~#\355g[\336\340J\355^\263\033d\272i\307c\345\210\033\367\244&E\367\222\244V\374\352\303\243\223;\2019Ya\224]\377EZ\335.\004\026u\311\374\264\347)\304\t\300)\221>\367\035\375/3\233d\223\365)\342\342s\232.\311\372\367\377\306\355g\355\034W\336\317\274\363v\271_"
+	.string	"D5\250a\367\372\021\322\270\372\276H\225\265\023F\220\265\234L\245<\231J\243\026\332JS\023\311k\035\322\200\226R\233\375\246\347*\237\022\317\006b;iS\271\020\345\257C\001\247\262\200~\017\3415\034\270i\025\234\003#F\265\216\272bB\353\\\315\242H\022uPmA\233l+\2754\235{\351\fu\243\016\314\341E\203g8$\203r\370\300\026\013B\211\324H\2443\020\340q\260T\375"
+	.ascii	"g4\341\356\3278\250\310\334\266L\313#Y\334q77\242\0334\256\277"
+	.ascii	"r\272\312\205\371\367C\217%\371\203\006l_xkcv!fJ\313\320\247"
+	.ascii	"R\241Q\336\373\007\034\200\253\211o\205\221\226\344$l\251\230"
+	.ascii	"l\024\006\273\306\214\\\210\200\003v\026t\022\227\227\271\026"
+	.ascii	"Dr\345\377\213\213\320\313\347\271\017\271q\345\331:i^vc\027"
+	.ascii	"\302pbN\2009\237\367g\263\214/\316`\367\245\354\260\035\256\355"
+	.ascii	"L\310\252\223_,\016&\033I\361\336P\344\300F\202Xc\376!Gyt\366"
+	.ascii	"f\237\031_\325C\305q\237z\355^\f\204\371\237\337\342\036a\235"
+	.ascii	"X\030\366\315\005\360\331]\013\367h\310\253jI\300\002\033\005"
+	.ascii	"\332\002\361\351\245&\307\225\220\3035\036\355xZ2\252\"\211n"
+	.ascii	"R\003\023\302\\\2409\032\375\004G_:\226B7\356\345\363\274\305"
+	.ascii	"L8\236\354/\343rI\tF\t\302\244\022GA\276\326\\?\243\260\211C"
+	.ascii	"\n\033\222\245\342\027m2_\237&Q\005\026^\f\215\262\313;\356\333"
+	.ascii	"\036\243\001\310\251C\227\334a0Q\221\250wFM\351ys\177\377\266"
+	.ascii	"}\332\314\n-\236\331l\204zn\227\277\033&\325UI\251\217\233\312"
+	.ascii	"z\265\223\251\235\323x!\203?\024\254\t{\241\233\306\032\031\027"
+	.ascii	"\243\376\322\251p\273G\0028J\271N\370z\013)\336o\352DuA<X{\273"
+	.ascii	"\253B\214\241\236\037Y\026\376\371\212]o\216\n=\366/\357\223"
+	.ascii	"\253\243g\201(\\\035\230\227Z\376\206i\355\306\265\337{\335\211"
+	.ascii	"\315<\321!\377\347\213\017\031\326\0206\270.\201\347\305j\223"
+	.ascii	"\207\275o\326no\253\232-U2]n\266~\353\nnx\370\224\353':\240\271"
+	.ascii	"dHL\303\203c<m\ti\315[\211\371;\254\317\241\220\2766\337l8\030"
+	.ascii	"\205\f\372c\006/\337\347P\007\334\363i}\202\277%\366"
+	.string	"\322\307{5u\356\006\236N\373\36578\"m6,\300\032Y\323|\331w\035o\326\325Yl\016\342=\037\253\213\215w?\365K&M;O\310\226\266c\360/\355\343\337\214\210\275H|\344\177\323\f;\003\327\224/}\336\366E\373&\242'M\267{\033\203\032a\033.\360eO\240\266\304\201n\0015\301\277^\274X\334\2220\327\375\036W\325\372\220\354\005\276c.\371\351\342\331t\3372-\270\036\017[%\274(M\005\367\346\034\0218\025\256\304\367\321:\220\306gN]\334~q{\r\361\240\360\274\036\f/\231w\342g\207\335\365\207\236\254\204\341\224\241\337\211\357\344\"\303\367\350x\237\301\002p\325l+\2727\254\216V\\8\263Mg\330\233`'\326\033\234\277\325\356\027\024\27531j\357\205\273\213F\375\001;@\217\267\3262\367x8\233\036\027\216\204\313\360\217+\272_\007\317\346=,:@'\304\005l@{"
+	.ascii	"\016TYpP\266\270\341\314v9\326\303\335\325(\034\325\357\211k"
+	.ascii	"a\275\237\367o$\036;\307iS}'"
+	.string	"o\303u\036\340\217U|\204s\026\226\016\3657\331A\363\037ks\350\253L\276\222\223\013\376\234\236\f\022\276\246\324]\251\327(\032\022\270\361\017k\331\b\017\0036\002\300u\224]\330\321J\274urO\214_rW\370{\352\2509)\277L\307i\020K\341P\373\256^\272\321b\357\\\366\204\317G\367rJ\214\374\255"
+	.ascii	"wz\371\371\0253>\024y\034\037\325\316G\232\177w\3517;\256^\033"
+	.ascii	"\220\263\027\033\276_\360\307\332\020\022l\247\017\222/\260\307"
+	.ascii	"y?\203\203\250\331\320\277=\217\331\265\243\322\215\275\313]"
+	.ascii	"\306\204\312\321\r"
+	.text
+	.section	.gnu.lto_.symtab.8e707b7e99e6f28,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"pt2FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"pt2FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"pt2FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"pt2FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"pt3FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"pt3FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"pt3FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"pt3FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"biquadFilterApplyDF1Weighted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"biquadNotchTableInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"biquadNotchTableLookup"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"biquadBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"biquadBankSectionUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"biquadBankSectionInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"biquadBankSectionUpdateNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"biquadBankApplyDF1WeightedReference"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"biquadBankApplyDF1Weighted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"simpleLPFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"simpleLPFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8e707b7e99e6f28,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
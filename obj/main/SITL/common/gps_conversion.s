@@ -0,0 +1,224 @@
+	.file	"gps_conversion.c"
+	.section	.gnu.lto_.profile.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"h\031"
+	.string	"\001"
+	.string	"\311\301\254\210\013\b\002"
+	.string	""
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 C\365\001"
+	.string	"T\0037"
+	.string	"\001"
+	.string	""
+	.string	"2\264\341\347\261\002j\001"
+	.string	"\001"
+	.string	"\001\002\003\\\342\350\236\235\002j"
+	.string	""
+	.string	"\006\204\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\002\232\212\217\211\002f"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"x\206\265\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\001"
+	.string	"\001\300\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.30c698a7bbb5c116,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_GPS_coord_to_degrees.3.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375`n\t\2755"
+	.string	"\252_\334\024Gp\334Q:!\304\241\251\275}\340\323\267\f\005vV\034\004)[\007 ^\237!\0253\223.O|\324\037~M\240\203?\370Q\312Qo\330b\263\034\222D"
+	.ascii	"\3642Ek\023\003\n\352\267\377\355\212\376O\b!$m)\003J\001#\001"
+	.ascii	"4\001C1\220t\313\262\275x\302\252\301a\307\032\235\024k.\206"
+	.ascii	"\336\266\314 [L\260jv\264\220\270\322hV\215\205\005\332\036y"
+	.ascii	"\232\302\366\201\355\324w\231\t\202U\233\271@\333.\247(mt\332"
+	.ascii	"\326\311\240S\326\300\336\313\334U\332\212U;_\364\257m\277\304"
+	.ascii	"li[g\0223\261\235\262\223m)=\305\212\257P\347\221\255\007jYh"
+	.ascii	"y\332\326I\034\352\241\332)\332A\265\323\033A{\310|u{\254\343"
+	.ascii	"^\243\316\3464\275\352 \240\2410\b\374\371z\274\037\237\235."
+	.ascii	"\307\256j\212\376^q\307\350  \221\033u\206p\2115\020\352\303"
+	.ascii	"\246\211\227\003\037ll\222\334!X\013\227tp\t:\244\344\002\231"
+	.ascii	"\236u\206p\201\365\017]\300\034\263\243\321h\205\241\3033D\340"
+	.ascii	"4\231\026\222\353;\002\344\366\2044\217\331?\314 \327GH\357\320"
+	.ascii	"\225F\216\260F\243\365\003\235\240\207\016\227\254\253[\237\212"
+	.ascii	"pyu\316G\263h\264|\240CDdZ]w%\032\302\345\325*z\26340\274-%\352"
+	.ascii	"D\005\n\222\345\026\326M\307x4\212:\265m\313\333\232\201\242"
+	.ascii	"dZb\367\375\326\027.\315\306\026\217\276\353S\333\266|mlq5\013"
+	.ascii	"5s\217af\034\314k\236\313\\#\251\3515<\237\317-\215\244\242O"
+	.ascii	"\337J\346\217>\275\377\3258Yq2\356\223\271\271\\M\231b\227p\277"
+	.ascii	"\270\320\232\245\227\214\373l\264m\3336]j\242?\275\t-\355\242"
+	.ascii	"\261\261)C\337d\242\367\223gdf\\=\334\353\240J|\277\337:\211"
+	.ascii	"\306\233\262\f\353>\237\346\215\231\332\337dv\306\270\024\232"
+	.ascii	"\370`\343\1771?a`/_\260\340T\201\275L\241i\002_\226\020\001\002"
+	.ascii	"{\371\201\003\246\245vv\023\371\262R\2335'5`\320X\232\027(@:"
+	.ascii	"J\200\340\200Q\021\321zyhw\331\300\356r\201\335e\002\273\313"
+	.ascii	"\003v\227\005\354.\007X/\003X/\013\365Zs\220\3562\020{y\330n"
+	.ascii	"\315\302fk\016\256\227\201\353\345\237z\331\227^\356\245\227"
+	.ascii	"y\352\345\037\366\262Ozy\327j\315\272\334\345\234z\231e/\257"
+	.ascii	"\351eu\275\234\256\227Q\365"
+	.string	"\362\323\313\367^\356\fKl\204om\233\343\271\2475\223r\021k\263n,\335j\335k\335l\335n\255273[q\237uZgi-\335\326o\274s{\021^\032\370\036rF\246\273\364\357@\337\177\275\373\376\266\262\336\233I\327\333\322K\327,T\006g:\214\2564%Y\202\"\3139@\341\227\216z\340Q\226\345\262\230\355\371\365\024\\\247\324S*\357}\206\347\254\215O\f\007\257\302yY\252\354\226\375\326!\304p\360\232\316\350.x\243/\215.\374\305<\351\305\375L8\243>\r\327HH\377y\005\n\377\3510\355s\n\273\373@\331\031\275\35190i\2747\277\264\202Ox\372\345\371\363&\\+\220\342\243;z\320\227\214\352\212\036\334\275\311:\260\260\034\206\257H\252\250\r\327G_\006\301\302r\026\276S\342\246\022_\364%7\217Qs\277qge\212.|\356+\332S\351\344\266m\033C\367&\367[w"
+	.ascii	"c\262Ngtm\270N\220\340\3541\\8\373\333\226\025\007\242\031N]"
+	.ascii	"\177\341)\232\222\251~}GQ\177\343,\275"
+	.string	"\226\272\350\026\236\373\002&\367\246\323\323/oJ2\256s\347\314\027\373&\273P\217~i\210\234\271\231q\365\364\212\246D\027~\271\264\226\336\363\276d\356\036\260\203\n\024\365MnZC\237\276z]\342\211\036Id\025T\022*E1\204\324\211\242\261\004o\352h,&{T\305br\252(\205b\245*V\2518\032=\234\200:\"\215UQP\311\022\277\026E\251#\207*\343\224QJ7u4&\253B\024\253\240\216F\251$\022\031\345\343(\245#\322H\225,\2568\"\243FP\245\230\"\036\221(P \243\210G#\024\nbT\222\212\250d\304\310\024\305$\261\n\211L\022w\314\314\316\266\377\305\367k\254\f\220\204/\303\316}\245*}\371{\254\266\240!\203\257Y\334|m\246\033\f\035\300%\030\370\320\3216\265\300\r<@\034e\024\002\027\360\002_\321\224LV3\340\004\032|\300\001X\230\341l\026\243\006\270"
+	.ascii	"\335\003<]\203\242\001k\373J\025:\200\267\222\f\353>9\350B\027"
+	.ascii	"\3215\007\350M\356\331\020F\370 \026\367k\270NZ\260!\213\333"
+	.ascii	"\217\205\007\316\023\223\363[:\202/S-\317&\316q\2033|\223\357"
+	.ascii	"\222\261\260 \204\367\2361\034@\246/\330A\031\013\013:8\243@"
+	.ascii	"\004?\340BMz\204\367\262\236J\246\360\315\003\035\302\203\003"
+	.ascii	"\035%3\374\203\257mJ&\326\360\350\235\2548\004w\360\036\323\005"
+	.ascii	"FY\026\324A#O\360M\356\200\277\250a0#\rT\204jFD\222\202$\031"
+	.ascii	"\016\220\002\231\251*z\020`GS\223\326\300\233\360\0162gTS\273"
+	.ascii	"\225(B\b\275T\371&\261\215\321\250Lb\345t?\301=\202\013\3248"
+	.ascii	"\"*\r\302\020&\226\235\205\254q~\270\032\255\251Q\233\306k\335"
+	.ascii	"!\004\271\001\006\252\220\221\275hSR\201_\335+\235wp\210(\314"
+	.ascii	"Y\344,\367V5\233\304\303;\fz\335\007\312\375vP\251\320q\232\363"
+	.ascii	"\200\320=r\222\202-\226\257d\231\006?\023\301\005\274p$j@sQ/"
+	.ascii	"\202\224$\016\305\213\211\366\255\224dYwQ\354-\025?\345\034\227"
+	.ascii	"O\225(\202\2351#\256<Z\237C\350b\346\031\377\r\312\336c\025\236"
+	.ascii	"rA\312\335\320\355\fq\267QP\235c\213\324\001\206\223\303\313"
+	.ascii	"\241\275\203\301\365?\332\020\326\013S\365;\"-;\034P\224`\203"
+	.ascii	"o*\334^3\205\030\353=\241\340\007\t\253G\027\321\370\265\206"
+	.ascii	"\235REcoe\262\001\225\227\202m\030\001\263XD\0200\207\213\365"
+	.ascii	"\262@%:\343,\340\360a\001\323?\254!\031\310\200\225\345\233P"
+	.ascii	"R\337j\037\314\224X-\363&\237\r\346Q\253\224\0301\r\200\267a"
+	.ascii	"x\016\3447~\242\320\300\205\341\300\263\033\231\354\221\f6=A"
+	.ascii	"\262\274\031\374\034\373\030Emq\247W\026t\251\2571\312z\272R"
+	.ascii	"\336\r\030\371\223\304\272\227\005\334m\271\336f\335\241\224"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\001\314\231\263:\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.30c698a7bbb5c116,"e",@progbits
+	.string	"(\265/\375`#\003\025\032"
+	.string	"V\265\267J\260Vq:\224J<\177\344m\243\342\\\207\024.\253\025z\3078\016\027\035}\331\264\033\311\022\272\244\272\263\024\020\t)]o\260\020\351g"
+	.string	"\226\260\345\326r\245\013x\337cpy\026\2614T\034\334O?\205\277\241B\241 Dd\n\226"
+	.string	"\237"
+	.string	"\242"
+	.string	"^\244\234V]B]PK\324]\227\270$\357:*5E\225d\352$1\342\356T\021\346\003\177N\3623\021.\302L)\233\2046\257\373\256TDV\324\300qU7Pf|\260\370@>\302H\316\227\215\034H\350)2I\027\351n\276Ahw\311Wu\246\273T1'`N"
+	.string	"\016Y\322\321$\004\377\211\277\274\023\212, \374\177\377k\370\277\340\377\206\377\030\376\377\374G\360\037\311\377,\377\251@\371\237\363\363\214\377O\377\231\376k\371\377\255\353\272\376\267\360\377\307\237\312\tl\325n{\273A\034\331\235\232m\325\264WM\202\313\331\027=\271qh\333[\366g\342\312se\325\362\264jz\256ZM\333vI\352\230\300\265ioz\202h\025=-.5WVMa\230\330-\355"
+	.ascii	"aq\215\"\247+M\235\236\275hGu3\017\251M\237"
+	.string	"n\035jF\225.X\312\255\207\342\366\244D\371v\267\201\334m\tm\\\317\366@\273{\334<t\007\221\267\3276\270G\322\320u\022R\367\201\276\335\271n\222\273\327\335dw\333\230\272\333\375B\307\356r\271n\245\002\271\326\221PH\335\037/<\341Y\t\253\347&v\342&~b\276u\313x\021\240l*\261\245L+)\261p\300\220AN\360\316O?\220\020G\301\351F\020\241\305\2250\037\310L\270\t;\261\330\311\371\tC\371\r\356\266\332}U7]\304\304\340}`\017\357\204\340\221xf\205\252u]Wf\205'\363\033\025\0203'\272\360\222\327\312n\241K\020\317@\374\177\016\2734\273;E\315m\363\206\023\376|\256af\3759\234b\237\377`\247\036\240\327\344\2271\"\217\247\022\306\007\376\357\351\203\001S\262\033=W\004\254\2322.\007iy}\0066\330\313e\203\r\331\\\301\307\0172Z\3136\216\264\026"
+	.string	"\033\f\b\202mf\024B\274\3135\241'C\005\nb\314\301l4\252\321d\"fc\fV\373P\324\232\215GGc\25453\342p\324\212\321j-\007>5\231\214V$\353"
+	.string	"\033m\260\016\264q\214\301.X\2400\3401#\232l&+\022\037\364j\360\032\032a\363!\242\007D\017\302\017\021\271\\D/\227\370\227+E\343\340!\006\236\253\260\025v\372\341+g,\234\3455\345\355\373\335@\303D\311\007\352\360N\370q\016\361\374\023\246\326\225\177B\206\342)\354\304\303Tr\322\bIc\346\003\3175\3043O\310+\007% @\002c\0243\352\001\3042x\003l!\300%\"Y%\264'\025"
+	.ascii	"g\270\204\006WZ0\fx\177*hE\020\032\330\205\255z\013\03132h\310"
+	.ascii	"\032&\022\354K\333\013\263(\272)\375\267\343\f44\002\362\036"
+	.ascii	"x1r\334\270\324um\313P\273gu\3476X\t.-\210\331\302\332\203\271"
+	.ascii	"\2305\307"
+	.text
+	.section	.gnu.lto_.symtab.30c698a7bbb5c116,"e",@progbits
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.30c698a7bbb5c116,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
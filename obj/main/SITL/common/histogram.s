@@ -0,0 +1,577 @@
+	.file	"histogram.c"
+	.section	.gnu.lto_.profile.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375 \330\305\004"
+	.string	"\244\007\314"
+	.string	"\f"
+	.string	"\200\233\316i"
+	.string	"\001\231\203\346\232\001"
+	.string	"\002\252\274\360\254\f"
+	.string	"\003\332\360\213\342\n"
+	.string	"\004\335\273\355\340\002"
+	.string	"\005\263\251\261\300\b\020\002"
+	.string	"\002\001\002"
+	.string	"\006\242\354\362\353\n\b\002"
+	.string	"\002\003\007\314\257\230\355\017"
+	.string	"\b\252\301\200\234\013\004\002\002\003\t\351\234\342\b"
+	.string	"\n\367\254\256\253\001\030\002\004\002\005\002"
+	.string	"\002\005"
+	.string	"\004"
+	.string	"\013\366\210\304\217\t\006\002\004\002\006\002"
+	.string	"\002\006\002"
+	.string	"\002\006"
+	.string	"\f"
+	.ascii	"m\b\265s\037\310\fdy!\300\312\215A\265\np\007\203\201Lxw\312"
+	.ascii	"\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375 \321-\003"
+	.string	"\262D\r\025\260%\351\f\303p\226$I\222\n|\210%d\023\333\366N2\005\006t\2231\244\253\372z\344+\362L\025\016\222.\336"
+	.string	"\335\002=\303\"\330L8\270\2673\213\203\023"
+	.string	"eH\302\005\200"
+	.ascii	"\373\303\327\036K\004-`\270o\346:\244\204\025\025\203\213\005"
+	.ascii	"\202\006\223\373\250f\201\302\003\251\342Y\206\274\204\261\001"
+	.ascii	","
+	.text
+	.section	.gnu.lto_.inline.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\345\003\325\017"
+	.string	"f\030M<0m\223t\243\264\362\2634d\331\013\332\036\215q\017\005\037\006\331ih^\r\223\357\320\001v\013J\367\303{\304\266a\030\320\023\\\rql\270\350!\352\237\210\315\266F\272\241M\344N\0015"
+	.string	"@"
+	.string	"<"
+	.string	"O\324\314\b\202\223\020\244\373\212\305~\n\374\373w\301<d&t7\231Y!\335\025\353\356\212M\367^\232\231\371\274\202\314\324<\373\243\336\367]\364\312L\351\247\021$\265\276\352GfJ\246)vDaK,\\\346\240\017\203]\033\033\006\026OL.\2344\207GjfV\202ccD\033\333\344'\366\337\250\233\245\234N\210\003\234\372RD62R\341\242\"\370\001\\&H]\244.\032\3508b\312\321\201\301\303b\0240^\312\351\2044h\267/\235\270-\232\352\035t\t\236\251\032\230\222\350D\3300\340\247W\363\336\265\245_\336K\312\026\306.\345\036\350a\025K.L\037\210\204\370\b\360\031\355"
+	.string	"\242aA\001\304/\203I\020\371@\201\300R\364W\335dj:N.N\016j\275\257\343\246jh*\326\025\253\226\266\242w\367a\264!\304\213U3L\360\020q\007Q\250\0015#\235\231\031\t\"mK\215\001`\"RR\331\003\022\340T)\007\223\f\211\f\005\023YHi\331\305\305\272\001\202|6*\2201\256\177\301\272le\227\324M\366\213\3457z\025#\232\364\317\370\rn\\\325\343sM\026\002~\271#tAc\342\203\351\344\274\265\025\247\256\240\2023\020\224\266\232\"\320=\307\367\216r\247\\\356\334\177\371p\032\024#m\2671\025\236\031\216$\2569&\030B\272va\327\242\252$\030&\375\324\333\233Y'\326\365R\253e\t\234\366\355\210\245\343\245:\n\213\336\\\324\013L/\245\356\254\210\214\220\f\273M\336`z\"\304Z\364\357Z2\360\334"
+	.ascii	"\020\b\340\247j9m\3402\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"5\005"
+	.string	"\322H\032\"\2205I\007\273W\n7\257\303\247\310\356\356V\333\314\314\314\214\341\241\t\r\332m\366\277\277\335\215l\231d\\\261\021\216\236\362\363s U\326\013\016"
+	.string	"/\306\027\353\210"
+	.string	"\224\234|\003l\314\2051w\326\320\253\322\276\247|\017\036*\226S\316dX\311\231K^\347!\273\367;\230JJ)\215\032\216\232I\036*\322\253g\201'\002\030"
+	.string	"\200\n`\367fE#\213\001 \030\\\030\b\2336\342\252nkf\260-*\200\237\266B\005\f\220\240\330\200y8"
+	.ascii	"\331\365\202a\235\f\327\024H&1\212\242\237\317\353\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\200\004\001\200\004\002\230\004\003\200\004\004\200\004\005"
+	.ascii	"\232\004\006\205\004\007\204\004\b\205\004\t\230\004\n\232\004"
+	.ascii	"\013\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\315\004"
+	.string	"\022\007\026\037\240'\351\377\377\347\n\335\376\377=w"
+	.string	"\006\036\020\235\005\003\302\336\376\177m\237\220\335\210\2232\005\037\022\n\303\371\013\375\be\362)UQ\201\366\001 \375\250km\2559\"\373\255\\mg\256\3107\347I\277\365\\Y\\\346=\265\013J\325c\032\217e\301p\260h\344\211\b\032"
+	.string	"I\r\351\303\214\204!\243\224\001\315"
+	.string	"p\367\323\302\306\b\\\032\211\312)\274\354gH\376\203u\035\332\230\312\021N\200\243\204\274 \200B"
+	.ascii	"pZ*\213#\365\341\3349\231\366\274\0202\200\""
+	.text
+	.section	.gnu.lto_.lto.90c304fe8834eb10,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_histogramReset.5.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"M\007"
+	.string	"bN34`m3\006\300\t\033\260\2703E\355 \251\013\323D\356\337"
+	.string	"Wx\245\030\t\037\317;\341ELM7\243(:\276B\302\"\241Z\3660vQ7\222D\312\224\002T\253\215\305\271\026&\350\323a\220\236iY\263\222\236\016\307\222\325\365\221\233\202\316\006\205K\202\346\274$\206\273\245\303\2551\243\213\200\022\225\036\034\271%\323\201\037l\035\036\236\265f0:\n\230\265\\\366\240Fk\351\377\013\267\326\"\373I\024\312\300\311o\261\242\362.\222p`\332\372\265\366\360\007f\021\204\003\376Md\364s\232j.\216\345\234\231\034/\026\230\034\213\265&\004\023"
+	.string	"#\025!)\377%\3340\346\207\325\0061\245\2052?K\302\377>-t\341B\2675h\213\320\266#\t"
+	.ascii	"\204YE&\036\355E3.\020\202!\227`\233\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_histogramBucket.6.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"}\f"
+	.string	"\366\226UC\020\221\223\016\363\225\317dY\255\266\352\001\340\030\020\220\350\255\023@Z\351\216\242\220D<\261'\343\027-\220\315-x\213y$WU\243\375\004"
+	.string	"`\204\\\001P\235w\001Fp\211\265\261\234hvo)eJ\001C"
+	.string	"A"
+	.string	"B"
+	.string	"\207o53\037"
+	.string	"\007:\344\260\374mH\005\230\221\007\247mG\214\016+(nB\356\323f6\216\345\272\006ZX`\360\340B\333\221\331"
+	.string	"\343\245\247\210S\311\334\210\304\030\235\033w\341\336\334\266\002\333!\366\017\004z\322\237\231>\354x\321Q\021\243\205\316F\214y)B\330\316l*OB1G\214\032H'b4}\370\203\363g\333\027\361\021\231\375\202@\333\0170+%h\304\030\253\002\357\300\277\375"
+	.string	"\370\247\036\236\005\022\3407\325UPR8i$\236v\235K\215\223\213P\326$\n\0312\0316u\365i3+7R\262;\210\255%Fu\344"
+	.string	"G\201\251/]\200\013\315\251E(kl\023(ud\177\243r\2603\275\231\016#\017\032x <\177@,\017\266\340:1!aP\225\\\226u}\252\022\022\217U}0\223\n\204\200/\007#Xur]XE\231\342\367\251R3\3264\367\013|\351\tD&t\365*R\213\244\250\n|\231jG\b\025"
+	.ascii	"e\b\b\303\nZ`\244\005H0+\f\325\026\210\022\204<\276\032\003\256"
+	.ascii	"\374l\311\250\234|\b\3145\374\022\213\0273AC\205#~\346I\332\036"
+	.ascii	"!\240@\323\252="
+	.text
+	.section	.gnu.lto_histogramBucketUpperBound.7.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\325\n"
+	.string	"F\024J> O\225\016C/(5a\320\206\254\351"
+	.string	"\215U\"\233\021\002\321\344E\267Z\0220Ss\374\356um\204Y\202\335\026\221%\220\251\302\002\360r@ZR\215\250\250\007\333\265D\033\367\336R\246\0247"
+	.string	":"
+	.string	"6"
+	.string	"\020\371\270\027\336y\204\253\035?\303\363<:F\207\221cu\336\350\013\013\220HH\320\360B0\262\252`\342\247\253\310\003\251^P\346\234\326\316\213p\313\333N`\373\200}H\2764\260A\200\2109!\264XLU\f\241\3016\307~\330V\275\311)c\314Ia\304\2079\247\304\022\307\243m\237\303;p\334\201\037\006\017\201\n\316C\2129\277\213\300#\362\021>\017\344\273/\\\217\202@\261\232"
+	.string	"w\341F\216\305\265\370h\353\031:\222j\267\344\215;%w\177:"
+	.string	"\324\tT\211\220\256\260?\217n\311>\234k\301\360\246\177\255\326\325\032K\003l\243@\032\233d\225m\201\246\311\\\030\\\030-\3134\354\302\\*\331\205m\231k2\300\232\003\313vi4m\273\036\337<\204\337\237\036`\341\352\212\326\224\317\202\242\324]{\023\022"
+	.ascii	"v\b\b\303V,T\301B\215a\257\241\332\002R~^:\332\207\037Vs!\227"
+	.ascii	"\030\303\201j\357c\354\021@\245\271\331\036T\230\321\264\n\n"
+	.text
+	.section	.gnu.lto_histogramAdd.8.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`(\003e\026"
+	.string	"\006(\215I\260\022R:\253\360\304\234+\304\247P\212e\013\333\356\352\321\257K\344\377C\264%4}\367\024\260\357\035\243v\361\277\337u\333\331\320\276>\030\327\364?\203\336\027\330/\240\017\224\346\177t\206\274^\034\322\037\222\317\022\262\367\2262\311z"
+	.string	"l"
+	.string	"|"
+	.string	"\265\372VvE\374\\\337S\350\247x\024\372\271\265\335\034\367\001\325\327\360\240+\002Rku\265\211\327.\206t\312\346\332>l) \302j\307\263]$\340\243\263\363\220\306\207\035\251Rk\375O\307t\312\004\035\234z$\274\234\034\341Q\342i\344\335\260\2349\252\035/\304[\"\340\201\002A\302\263\221)S$p\034x\306\341\341\230\303\226Z\353\362\216\247\363m}wsv\267\301nC\b6\214\265\353\303q\367v/k\377\354R^\024\312{r\241\177\204\362\212\234\350\037%\2578y\303\311K'\357\224\274R\362\266\344e\311{"
+	.string	"T\305\224\200\037\265\346\004\205T\251\311\224bw\277/:\220\346.6\264\031\215\237\2734\273\343\347\307\335e\337\207j'\242m\253V\237\252\005\342\247\212<\357\236\305[\324.Ts\223Z\177^(\005I\357\226\315U.\217A\023\273{\352(H\210{I\351\273\035?\215\276\271\347\220\033\036\034\007#\034\211\026\340F\255\225\301\356\313\217`\304Z\253\002\030\024,\224"
+	.ascii	"\235\250\241\237\357\377n@\207"
+	.string	"\321\025\323\215\203\264\305c\357\201\262\f\364\273\223\226mc\016\277\334\320\354`\220(\310/\312\206\261x\251\307T\217\034[\244g\216J\227u\343\340Q\354x\244\272{%\247\321\261\017\274\t\221\325oF.\032.\2746\314\326\302Xb\257\331\213lF\006\246\202+F\026\213\311`\256\030\230W\314\005\233\311\270X\006\254\f\203\313\3145#\223\315\\\243\357vY\373g\035\254\220\2725N\354^T\312\357\007lHW#n\034\344Z\253-\224\363\244G\037r\255\276M\364\300?\300Ij\221Fi\234\025{\302\017j%\374\211&v\330\203\024$\024\266\023\214\366\354\260?6m\266\241\313\272\275.\0036\373GN\262\233\002@\250a,\305\fdL\311\004#A\323\202B:`\002\221A:\017\021`U\213\244)\273\\\016\204\350'\345\226\262N\0070s5\236O\301\037/z\250\001h\221A&\266\226u>!`\031p4"
+	.string	"\251(R\201\307\262\274\262\334\362\021\346\377;\013\332\264\243\207\273\251t\257\371\023~<v\272\325\003v\272n\323\352\026~N,\323\005D~\210\303>\302X\022o\355\026\372\224\220\nD\013,b\3752\263\t\270i\246\237\f\241Fg,\243"
+	.ascii	"xB\327BP4\236Q\003"
+	.text
+	.section	.gnu.lto_histogramPermille.11.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\215\005\r$"
+	.string	"\232AT\016H\200\234Q:[\253Vz\263\227Lj\365\331\013\312\224t\033\300+H'(\262\361\3461D\231\002n\337\340\312\232L\277a@&\353\244T\375',N\324\375\3167\263k\201\307\340\225\226\221\221\021\337\366\244\021B\b\331r'\031\326"
+	.string	"\302"
+	.string	"\321"
+	.ascii	"\225\371\3027Y\3720\305y\356\255*\263\345\336!\003fp\236\344"
+	.ascii	"\341y\254/Y\342\236\035\366\b\226\304)LQ\302\356\035\342\n\034"
+	.ascii	"\250<i\357S\236l\036\307\333\341\231V{\267\325h\351\f=\315\222"
+	.ascii	"\264]{|\025\267\025\257A\007\231\232\355 \207\353]O7\254\205"
+	.ascii	" M8\256\365\253\264\035P6\236j\360\205\001\243\202\222\372l\353"
+	.ascii	"\033\316,\001\243\202\212:\312\006N\016t\300\250\240h\334|\327"
+	.ascii	"\323\f\343\253S\220\251\226\366A\225`\026[\020hkG\336\024\371"
+	.ascii	"VT%m\005&I|\274\353\251\206\355'\305/i\220E\265\327:\251\303"
+	.ascii	"\bF\005e\343m\023H\211\211a\013\372,\020\227\216\257\027o\240"
+	.ascii	"\310\223T\255\346\205{/\327\246 \324\371v\346\01713\007f\222"
+	.ascii	"(<\204V\026B+\007\241\225\201\320\312?\277r\366\231U\356\231"
+	.ascii	"U\346\231U\336\231U\276\331j\\\2316\253\234\036\312?\373\360"
+	.ascii	"G\271\262Y^\312\231D+[\264r?\353\\\321\312\007`\n\271\004h\271"
+	.ascii	"\027F\031\235k\206\314\022\362+\177\326/\345\315|\276\226\033"
+	.ascii	"\231S6\361/\fa\212\314\271\334\313\226o1\353\336\205I'n\302>"
+	.ascii	"\205\257\225\305[\306\343\2757\303\371-:f\023|+\277\302\307\302"
+	.ascii	"i\225%\336\247\260I\304+\311\2757\345\361\253pz\222w*JV|?0\234"
+	.ascii	"'+\363\022\277\310)_J\357T\361t\026\211Z\216\367\016\025\234"
+	.ascii	"\344\013\247}r\342\322\241\240\250;\367\347s\222p\236\334\251"
+	.ascii	"5\246\360+\207\331V7\343S7\3041\277:\026\364\013\322(\255-\273"
+	.ascii	"\266\023\3039o\225\265\277\365:\303\205W\321\321\330\276M\271"
+	.ascii	"\021\023\0068\"\001C\376t\255\005\274hC,Cvw\255/g\367.\245"
+	.string	"\003j\356\375M`6:W\356\344\200\036\335\327:\002\"_bY=v\344\"f\333\352\275\322\247\177\232+pNO\373tU\303\323=m\312\001*1\275\316a\312\235\346\351\262\016P\352\326i\357\364\201E|\265\214g}k2\r\023\331;\355c\271\r\213\372\302DV\240,MW+\225o\020\3045\277:\306\314!\036F\351\274\367\027\201\017\206\304\321\t$Ey\362\375\342\017L\245\271\022\256\250e\314C_m+\346;(3NqW1\243\225\211\320\032'r#\214\224@\224#\222\212v6)\227\343\331\034\t\022GH\273\\\211\023e\243\006HE\273\020\272\023\274#\021\270$\035\022\222\316\b\227tT\204\2043\332\361p\r\b\260\256Dn\207;\241\323\355p\351p\305\273\212\215`\275\251\321\320!X\302\031\021\232\343JX\277\346\246\331|aE\373lmh\\\340\\\tI\030AZ\324\332\212oM\251\255)"
+	.ascii	"[\301\313v\272\326-\226\214\264v\206]\2215\277W\222\307\262\353"
+	.ascii	"\016\"\233_\035\273\275\367^\332\202\227m\353\343\215b-s\243"
+	.ascii	"p\244m\305\377B\222\005\035\262Hv\220\266\211\332\211ggP\006"
+	.ascii	"\030YL\240\026\022j\333C}/\327\360T\303\013\030\307W\313\320"
+	.ascii	"\236Z\233o\364\360\241|SP\333Va\213R%v\326\006j\222\311\213\211"
+	.ascii	",l\250Q$\246\0204F)#\"\023\214\3144\351p\002\231)\323m\021\240"
+	.ascii	"\311\262k\330:\004?\211)\337r\006\272\240 \003\303\255\325\302"
+	.ascii	"d?\225\371\273[w\216\254,\257x0K\322\371\231i\266\342p\355\224"
+	.ascii	"\346\205le\334@ bu\311-v\026\211\033\301\342\016fx\324\020\266"
+	.ascii	"\202)\355\332h\237\032\272\311\3339cG52fw\301\b\007|'\204G z"
+	.ascii	"\2776\213r\373}V \020\031\254>\030$uFc\030\277\270\261\373\324"
+	.ascii	"\270\312\361\344V\306\216\265'J\025\210'\341\205\"\330{m\005"
+	.ascii	"\240\364\233\204r\\`\230.\026\b$\264\327\267z\302U\265\022\267"
+	.ascii	"\267\032\306\206n(\f^\2402\235\267\331\326\337\021Yc4\204v`\262"
+	.ascii	"!\223;\237\345\b\021\213\264\367\021N\013\377\030\360\032ZA\371"
+	.ascii	"\317\251\221\316{V\036U\003"
+	.text
+	.section	.gnu.lto_histogramPercentile.12.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\305\t"
+	.string	"v\323D;P\245(\035\f\301N,\260\312x-n\026\035\3725\201\207:\334a\236\252\371.X\001o\353\323r\267S\033\231o\374dUUm\221\201\316\344\256\327\311\315\302\177\264O\b\331R\246\0244"
+	.string	"6"
+	.string	"."
+	.string	"\037\371,\202\321\003\205\255X&\223\003\273Q\303\\\001\373\005\237\200\375\322\216\213\236\"\377\253\303\220\215\001'\324\350\231A\354\256\363\204\322\270\365\266\027l?\3307\b\002\n\\\002\354f\264\020,\201\013\300\207\355\317\266\330\206i34|WQ\374`K\0060\0342\355\223\274\344{\2548\302n\212u\262\0333\316P~9Rl\373\"\001\212\261\320\221S\265\340 \354\232\372\013\220R\266\f\365zS\002R\266\3548J\345\260\017WS\266\323\331\343\217]\365C\230\326+\235W\372\224,!\017g\3638\237\254\342M\303m\274\210.\004\352Hh\236\216\343\272M\363t6\234\266y Msq\367\341xZ\250\353<\315\022\367\316\024C\322\222+\251\212\251\335M\344OY\r"
+	.ascii	"\204YEfh0b/\\WO\342\\\303\003i\001{Lh0W\240\302\301]#\325\212"
+	.ascii	"I\230d"
+	.text
+	.section	.gnu.lto_histogramMean.13.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\355\013"
+	.string	"FWP=0O\224\016\b\330\375\002\006L\016P\315\211\312xC\305A\323\035\236\227\352\214\034)\325\373\277a\233 6X\215\0049\307\352KA\211]\2500\264\263\260IT\260\317\373F\b\331[\312\224\002@"
+	.string	";"
+	.string	"?"
+	.string	"\021\0037\225T\210D\264\330\215\226\344\005\246\303w\002\323\241^\370\366\247\271\371S\006\205\215\021\347\371\003\300M\270\n\340BO\262\273\007\361\304\340@\231T\202\335u\216\270\214\033\336\266\002\333\025\373\f\002\361\247\234\206/\375^Z_:5\375\007\265\342D\244\333\225\320\275X\023\220\304\006\333\035\033b;\323\276\306?t\0369\037\260K*1b7N<\251\016\035+\333~\207{\350x{\001\034@\331\371\252Jq\210:|}\003KE\220\341\271\273\036\2656]\003X(\245\b\245\013\333\017\036B\253vC\025\277\244\201Pi8\3649\323\341\325"
+	.string	"\n\215Ovv\364\244V\260\377VI\256\036\017_(\227%k\200m4\214\003+\203]\027v\2612\030\313e]2\315\242D\214i\026d\326\006\3032\013\022\367o\225\344L\177\233R+\205\212a\033\252\344\243\240\367\236Vz\200C\324\241\232\372\024\262\210\020\026"
+	.ascii	"\204\251\302\370x\236,\340\217\225\310\3428\202YS\243\325Cp\002"
+	.ascii	"v\301*\t\273\001\314\\\264\261\3145\374i\002\273k\224\212L\020"
+	.ascii	"p\002\220j0\246\234\241Nom)\003"
+	.text
+	.section	.gnu.lto_histogramCompactReset.14.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"e\007"
+	.string	"\262\01644pm\032\003\200\264\030:\2041 \262\274QT+\020\003s \324W\210\371v\217#"
+	.string	"r\300\344j\336\256\250\272@\017\026\251\221\035\221\311\t\250\221\275\267\224)\005\227Z\233\213\203)H\320\247\263\020=\362\272\244\025=\035\316\025-\354\0237\002\225\f\tX\004I\211E\314\274\247C\256\b(\035\004\214\350\364<rG\252\002?\33068<o} \244N\002j\355\324\036\264h=\375\177!\327Zd\277\251R\"\031(\371)RJ\357(\221\fL[\277\326\033\346\310,zp\346\347F!\377\324Tc1\325\351\200\312\224\305"
+	.string	"\225\251f\255\211'\306\355A\232\3708\371\037\341\2053\277\254v\207/[H\363\253\034\374\357\333B\025.t[\202\266\006m5\002\t"
+	.ascii	"\204YE&^\356E;.\220\202!\227`\233\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_histogramCompactAdd.15.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`X\005- "
+	.string	"\2467\304I\240\230Q:\021#.\351\302w\206bX\276\256\006\0228\030\034>|R\270\310\263f\n\225o\363\267\334\346\361\376\377\311\202\033\244\234\320\366\244\302\353\340\302\253\360R\276\242\035\007\344\202\363R\002\276/M\333\377\215\220\275\267\334I\006\263"
+	.string	"\240"
+	.string	"\260"
+	.ascii	"O*\036\340\336%+V\367\016\035\260\203\362\225\207\267\331\327"
+	.ascii	"\362\002\354+\0131{\371Px\217\245\205/\312\314\275\367\326;\212"
+	.ascii	"\247\3033l\n}&\213\301J\322V\332S\210O\362\034\340a\344\007\\"
+	.ascii	"\361\231\222\021"
+	.string	"\322eZEHt\347\336{\242\215\031\243\031\306d\375\002\323\357\306\217\242\031\023f@\207\021\215\227\020\204E'/%#\032'Ou\003ZE5\210\276i\217^)\204\027R\2025@\026\224\026F\307\225\f84\251\002&\036\327\021\340\321\233.H\242\022\243\006\330\243\266\254\034].\365I\004\344\315I\362\334{y\376\200Fg\332\231\331\310\314\027\230\253\200\227\372_\034e\205\331\302\352M#\363\2207;\310\374\232\217x\305\275\304\\'\353\324\31198\177\372\007\324\311\266C\3756\237:\327\354\344\032;\231f'\317\350d\031\235\034\263\223avri'\223t\262\255\223k\235L\353\344\246\223'\235\374\035\033\216$\244\240\213\346\032^\030G4\367Je\342\343Sg~\021>\325\024?\331\351\r/p\203\260\350\304\340\225-\224Q\227J\361\"L\356\242\202\334{e\257\314)\230e\257S\306\314sx\"B\207\322Q"
+	.string	"\267\227\203hB\371\272C?\231\357\364!B\017\265mS,\276\257\035\355\332\004\260\206\276\032\274\23369f(\2117\217<\273\373\034\036\005W\001J\204\331\247\372\315\310H\267\261\270\304Xv\360:\313\354s'\272\023?\205\304"
+	.ascii	"\222\344$\206\2445\247ed(\1779?\261\227:\006\242\252\266\265"
+	.ascii	"N\023\341\354\273\003qKo2\317\255p\005\264\334{)0{\270\222\237"
+	.ascii	"\362\336+\241J\003\b\233\260\207\n\373\372>\361\t~Dy1\331\315"
+	.ascii	"\243\205M\233\346K\345H\330\377r\232\366\nr\253KX\373x\204:C"
+	.ascii	"\254\322\233F\230"
+	.string	"\031\031M\250M\333\272\262\340\362}\355\346\261\302`j\321\035\344\332u\326\246\003??\023w\"D\017\212\nc\237\007@=A\036r&J\374|\270\211\310\001\001\345|n\"~z\200n>A%n\017r87\002\027t3\221\313\005\335d\303\335{\t\303\222+\273\346\315:X\334)iB\"\211Y]\262\232\356@\244\322s/5M*Uy=\321\272\213NggM\353\3315\224\304\3332\353\326\252jz\2225\027\356&K\355\307\331X\313\272\323l\341n\264j1\004`\222\304:\310\264_\211\323\225\007\311\340\265&\342b\255O\206\310\2457\215\247\367\336\013k\360Z\343\364\255\204e`m\245l\262a\335e[,\337\027\226\256$\273j!iz\262}\205\323\231r\363\003\023r\250\2414\306\bC\212\206DJ\222\246\322\001p\002\221\271#\017\021@M\210\314\222$\245a\f\204\367\345\267~2\006\371\361\272\006"
+	.string	"S\272kO\304\332vT\327\004S\262\001\315\231\252\032\302z\026\357\252\275\234nO\024\321\255d\233\372\b\230tJ\026\355\340-\244\247J<\362\316\3003'\305H\334/\350X\312+\263\001\235\374\333t\226uo\211\251\027\022\306\311\0206\205k\256\220\035i\3004&s\230\362p\340\243\272u\230\372"
+	.ascii	" 2G7\217\245\254\263\023\222\24190Iq\341\025\223I\307\033Q\t"
+	.ascii	"\365K\b\241\310@\261\240\271LU\007\3028\264\007\340{\355\353"
+	.ascii	"\303vp\216\275\255x\332\330\027\355)mL\337r\306\351d\251\247"
+	.ascii	"\303\272X  \354>\2664\375;\036J\017LN\350V\236\t\030D\256\216"
+	.ascii	"\273\230\004:j\345,\001 N\277\005\234\362$B\r"
+	.text
+	.section	.gnu.lto_histogramCompactPermille.16.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\260\005\005%"
+	.string	"\372C\334\016F\200\236M:\263?$'\247\005^3\217v\322\022\353\2655\r3\n\226\023v&LS\311]\376\372{p`\305E>t&i(#\302#\030\232\020\216\2447\230M\024\004\025\020\354\021\215\2665\023D\244\021B\244L2\336"
+	.string	"\310"
+	.string	"\333"
+	.string	">#\025\316\227A\314\274\373\255_q:Q\306\205j\305\362\363U+\021\302B8_.\361|\225k9\355\023I,\0224\273\216Du\241\325J\334%x\221\371\222\374\220\371\262\211\234\235$~o\374\364\034\356\226\002\241\247\315,\311\346\247\375\214\347\212\3570\334\202\007G\202\330\323\346dT?\310\fJ\244\200<\354\307\267\254*\037O\311#\2228\302\003\031\357\301\215\026\236\253*\253\243\n\3162\212\215V\332U\025\217\333NF\265\343x\236\nF\261IN\350\022\f\223\013\002I\334\023;Mn\264\342\222\304`E\212\221\223Q\365 ;KQ,\r\322`\362a/\207T\360\\U\371x\223\r\204ir\344\202>\262\250\315\020\263\027\257\240\t\225\220\331\246\241\326\272,\025\254\372\352\276{\003\273\373a\267\264\020\274\004P\336\001(\257"
+	.string	"\2247"
+	.ascii	"\312k\204\362\026\375\313\227(\345\035Jy\001\244\274B)o\220."
+	.ascii	"\267\274\270\224\367v-\177z\342\017\264\274\247\355^_\023\345"
+	.ascii	"-Q^\022\210\267\017\366e\224\367\005\370\315q\210\244\313\210"
+	.ascii	"\025\307Z\237\312\246\004"
+	.string	"[\362/?\330\357\365\336\375^\314\217\273\351\276\270\330\366\021\033g\037\3632_7\356\366Nf\313,ch\337\262\017\003[#\006$\225\303\371\257\336\356\213\275\227\177\331\203\331\264\213\023\323\267\354\005\035l\204Z\265\326\224i\337e\323\227L\347\322\224\340G\254A\021V_Zh\033\316\227\274\353\264/n\272\367z:gP\235\305\256)g\265\022\035\274\\\r'\231\345\\N\327\022\203\203\352/\177l[fAl=\324\035\237\326\341R\363c5\243_\220\207I\222\266\346\236\332;_\243\311}\343\205\210v\204\344qS\342o\312\326]\215\245m\0258\213r\246,\352\\\033\320\221\207k\215\331d\347\372{\200\302n\262\357\342d&\026\304\251\365ga\367\350m\220^\036(\322\375\260\263\027\035fB+`\255v6&\215\354\341\237L\242.\352e \237\241&j\216\003\240\207\332\266\007H\305V\366Ec\n5\2006\375"
+	.string	"\205A}k\241>\260\211\217\3276\355\240.\341D\375y\337\372`\316"
+	.ascii	"\213\321WV\374\223`\r\016Yo\223\371>\301%\347\307j\273\313;\232"
+	.ascii	"\246\263\326\037\205\375\231\025(\316$2\314\227\357\027\277\340"
+	.ascii	"\252\314\224-(^\333%\372\270\207\273\227\260v\024\262\215\265"
+	.ascii	"\213\0060x,\220\232N\230,\224\216\226H%\036\217\211\344\265h"
+	.ascii	"\241\"i\211\347\342D\027)B\322\321\022\212\036\f&\025)vJ\275"
+	.ascii	"\244\244\036\322NI\305Q\322\016i\211i\027\001\301\366\\\360\226"
+	.ascii	"v0z\275\245]J\204zc\255\02337p\270~\330Q&bc@\004\320 \3061\276"
+	.ascii	"\234\237g\257\006\250\366\345\350\340\026\200\275\231\262U\342"
+	.ascii	"PR\003\327\303\325I\245\272\016\221\325\016n\353)1(i\356D\023"
+	.ascii	"\023\366\376\3114\317l\315Y\\s~\254v\262\326Zo\017nk\335\016"
+	.ascii	"J\215\257\314K\350\3435^S\255\200\244=\334\233E\t\203\016 \243"
+	.ascii	"d\225e\023\350\251\005:\003p\300\021\306f\324\002zjW@\227=\240"
+	.ascii	"_\346\035\250z\224\001\365\370x\r%b\356\375q\004\t\363R\001\232"
+	.ascii	"\354\031\271.\254\264s\271\215\272\214*\213\nl\250Q$\246\020"
+	.ascii	"$\006\031eDH&\3144\351p\002\2219\3339\021\300\301:k\330\343\204"
+	.ascii	"?\311+\227\362]C\034\367\215(\244\311\234\330\251PpPdR\375' "
+	.ascii	"%\005\216\002\372\037\306Z\252\034\210's\003\300\335c\232$\275"
+	.ascii	"l\212\301w\007g \3207\362_4\034I\370sx\214R\004\224{\005\335"
+	.ascii	"NA\326\330 \217IKP\271xu8\t!\366\306\f?%#\200\240\270P\017\206"
+	.ascii	"\027o\336\005\303\r\332\310\f2+\325\237\334\312\354\350\375\222"
+	.ascii	"\340*\2352\026\024h\004\233\367\266\254\234\211\246\344x\006"
+	.ascii	"\327\232\207\366\n\234kJ\310\352\325\330\314\216,L\205\356Z\030"
+	.ascii	"/\2322\307z\3304\306\250\2551\203\204R`\322A\343\233M\0256\227"
+	.ascii	"vL\013\005\355\327\330/\311\202\026\301(A\247\310\3754\244\263"
+	.ascii	"\236U(\324"
+	.text
+	.section	.gnu.lto_histogramBucket.part.0.19.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\234\001]\017"
+	.string	"\006\235dD"
+	.string	"\221(\035\340\271\236\003\234\376\315\371\\\177>\200[\033`\030\227\320NR\273\376\363\260\241\355\244\007\220n\n\017\267F\254\b\340:\f}.\375\277\233u\266\376{\252p0\365Q\254\017\273m$\226l)eJ\001N"
+	.string	"S"
+	.string	"L"
+	.string	"\221\345qh\217\354\320\276\n\022\373\265,\022\252\024\333>\212\2478\331\257\b\031\266\304\013\324\013\216\030\343v\350\371"
+	.string	"\354p/"
+	.ascii	";\324\021?]sO~\246T%\327\273\236\340F\215\224\212\303\263\343"
+	.ascii	"\273\371\304\030\235u\270\341m7\260\375\261\223@\273i\335t\236"
+	.ascii	"\365\037\300\013\300\210qCM\216\b\002\2660\361\230\277\365\264"
+	.ascii	"o\177\005\211\377r\227;100&\217\314\312Av\330"
+	.string	"r1\331\203\342b\332\350\202\300B\303F\214q\301\241\031d'\273\343\314\263\3362\262\254\250Jq\346[F\254\305\030\202\205E\f+\250X\200\031\024\215I\326xs\005\330*T'\312\203\352uu_\037M\252\201\373\205\251vD\310\370V'Y\343,\257\366\005\017{*\365\256k3\\\304@\321\222\324\025\353~\243\252\330\233\346lZ\333t\266\351\315[7\006\323\020\246\003 \036\247$\021\205P\351\001H\311\323D\245\n \f\320\241\017\0164\222\320\221\274\220\t\233H\307q]h\023\t\001q[h\344m\037\b\334Y\020\2156R\327\215\266\3167\252\212\357zGj\312Q\r\2669\352\217\211\236\250\256\330\316\024SMu\346\373\220\351\277\023\0076\212\311|\001% `\"\202\360\346\2452\306\025\031\032\013\264\243\027T\207:,x@q8Kq\003\321S\206r\362:\302*F\262R\230\2020\273\376\f\377\321\263\360"
+	.ascii	"'\312\326=r-\276\321.P\013`0\n+\362>h\314\360%\214\256s\240-"
+	.ascii	"c]\373\200p\250\315'\004<"
+	.text
+	.section	.gnu.lto_histogramBucketUpperBound.part.0.20.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\350\001E\020"
+	.string	"\006\336hE\020\217(\035\2508B\t\240\304U\rd\330\202?\360\257\217\007\200\321E\260\306\n\316\213\335\201\327\234)\302\0175z\265]J\266:k\351\203\b\200JpPe\344H|:\320\225t\275\250\006\324\b!do)S\nR"
+	.string	"X"
+	.string	"O"
+	.ascii	"~q7'\007\025(\346\234\234Ks\270K\373$L*\333\276\210\217(\361"
+	.ascii	")\272>\254:`\244X^\314\351\362.7/\240]\306\023\320.\327\303O"
+	.ascii	"_\215'_SV&\337\317.W\260`RV\030\256\032\217\333\307\234\323\\"
+	.ascii	"\206[\336\266\207m\007\266>\b\336U\353]\377\001\f8 3\347\205"
+	.ascii	"Pfn\220)@\\\366\307~\330\327\276}\023&\237\345'>s\206\314\305"
+	.ascii	"\245\264\t\033\304ZZJ\033\224\200\211\352@!\204\007w\t{\225\274"
+	.ascii	"A\275J\234\211\212\213\265\250\340b\316\251\340\322\035\\\211"
+	.ascii	"\235\341\325\273L\3215W*\257\276D\334J\026\240\214\266\333>&"
+	.ascii	"5s\242\241\273\270\332^\003\013\006l-\370\256\334\215\031\330"
+	.ascii	"\332t\343n\274R,\316uw\037\003\234\031\271_\264\257\356gO\220"
+	.ascii	"\n\301\026\212\206\272+\336\3708W\305\226j\215TwR\315I\365\266"
+	.ascii	"j\355\260\330\035/{\237\t\035\222\347\323\030\200\220\214:\022"
+	.ascii	"\004P\310H\222>\022<$ \232=\034\241\216(\302G\032\201B<\221/"
+	.ascii	"\024\372<\236\b\250\023\362<\242\221\307a\300\337\310G\344\221"
+	.ascii	"\276O\344\351\343\\\025\177v\r\355V\263\026lk\326\037'\213\262"
+	.ascii	"\273b;@\030\206\341\021h\334v\253\305\200-\271\333\006, \260"
+	.ascii	"\242\271\3436<\"\260E\006\311&C3\201Z@ \001\361\211\201\f,\256"
+	.ascii	"H\3600\020<0Dg\230;\234\232\033xO\217m\220\262\333cgW\270\204"
+	.ascii	"\235\245\354\372.4&\311B{\021K=\260p\032\2545\260\260\017\353"
+	.ascii	"\346\316\322\204\351\361\230\301y'~\223\023o\354\026\"M\241\273"
+	.ascii	"\364Z3\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\235\006"
+	.string	"\364\b\300\001"
+	.string	""
+	.string	""
+	.string	"\002\023\177\024\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \024\177\025\005\177\026\272\200\202\002\006\177\027\007\177\030\b\177\031\013\177\032\241\330\3771\f\177\033\r\177\034\016\177\035\017\177\036\333\303\207\017\020\177\037\001\022\177 \377\037"
+	.string	""
+	.string	"\200\200\200\001\021\177!\003"
+	.string	"\f$\003\002\r\003"
+	.string	"\301\205\303\210\002\001\202\001\003\004\001\240\341\365\321\002\001b\003\005\006\001\371\244\305\016\001\302\n\003\007\006\202\001\003\t\n"
+	.string	"\250\355\343\007\013\342\n"
+	.string	"\033"
+	.ascii	"L\215\270\tE\300\205\\5\022\234\273\265\b\361\3030|\212\314\037"
+	.ascii	"S\253\004\303\263\227G\342\304@\273\004\021\274\346\030\340\033"
+	.ascii	"\360G\t\002,\2060\340\033\340\317N\002\200\033U\005\004\034\003"
+	.ascii	"\324\240\331\351\004"
+	.text
+	.section	.gnu.lto_.refs.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.90c304fe8834eb10,"e",@progbits
+	.string	"(\265/\375`\362\022mW"
+	.ascii	"\252\216h\037SPP\322\031\016\372\212@e\225\372?\375\377]_wWu"
+	.ascii	"gF\316\265\356:\002\330\375?\207\013L\260?5:H\3734]$\315\256"
+	.ascii	"2\013`6\202\245\251\225\005\271M\256\377\300\227\213,\364\324"
+	.ascii	"\005!S\356\340z\006\021\243f\221\224!b\265\335\2336\2212\005"
+	.ascii	"\226\001\332\001\371\0017\210m\224\r#Ravw\225\235\262cKe\265"
+	.ascii	"Vl\275\276P\366\353\037\326;\260b\373d\273jb\272\237\2340\273"
+	.ascii	"\327\357\325\357\263b\213d\223\360"
+	.string	"V \335Q7r\322\266l\325\321u\257\"D|\020!\0025R\t\323%s~\303\376=\262\353v\361\262\273\330\335\003\324\204\201Q)\371\\)>_\260\347\264\315\351\003\311V\307\347\275\234HAxe\220\276\202t\231l\223\325\342Y'_%\313\365\230\342\332\315\230\2658\033\\|\336D\372\345Am\226\007\375Ozn\016\032bu\320\305\332\254\325\372\330n\035=&W\033\231\250*R\342\370<\003\351\267\371\034bCp4}\013\3731\364\234\032\320\253\203\362\326\315Ao\326\206\177k\330+\036\236\312\264l\256\356\025\207F\207\265$\"|~]\0354\335\034TE\212\023b~\236y[\023\346t~F\372\377\366\277\213\227\377\\\276\374\346\347\024_H\330\341\340_\020A\013\330% \363\363\005[\002\320\b9?K\360\277\312\377\260)\377\305\376\203\215p\234\237{\376\2159\341\373Y\347_\336\206p\364\347\230\177="
+	.string	"\341\275\237\025\370\367\203\177-\370\327\304\277\016\374;\342\337\235\177\023\370\367\200\177\007\370W\346\337\363_"
+	.ascii	"\376\235\371\267\367\037\314\177\271\377q\377\317\376\223\375"
+	.ascii	"\267\373\277\345\377\316\377\255\377!\374w\362\237\356\177\016"
+	.ascii	"\377\347\376\177\371\237\366\037\355\277\331\377\262\377W\377"
+	.ascii	"\021\370?\366\237\346\356\356\356\356\347\375g\026\177\r\n\001"
+	.ascii	"\374\243M<vwSo\355c\222\207oo\227\347\247Y\336"
+	.string	"\236\315;\340\252\333\206\335\227\264\352\t\261\006\207\350\023\351\036\342\364\332G\265\3714T\265\254 q\326\3061@7\243Z]\237\220\347\262\271\327\336.>!UP\327\345Q]\227\303\233..\207\335+\362F\345\"\016Wm>!\325\346\022\211\323\305\036v\223\210#-.\221*\331\022y\2436\211H\265\370\204\304Q\332M\021y\301f\245\310\002Q\213\r\303\250$\036o\320\324u\331m\335\313\345\242\217\bt+\227\3076\342\214\365JB\203\221\324\204\270\334\265\273\t0&A-\273\210\246Z-\273\255\222T\264\361\201\341\212\326T\2136\214R6\223\213\356\002\214\335\303m\264\356\036v\267\357\250\\\273i\334\250L\243\261;\371\301\330\312!\024\027\335\314\225\305\013\2516\241\226>P\266\232\314VZ\207\2532-\233\331mO\307\2649D\322L\335\275q)\023\371\002\334\272\316x\335P\342\304\347\356\260u\253\005b\355\336"
+	.string	"\004\347\r\261\372\212&L\2210uY\351\027\004\272w\013b\345B\327\240\332\260\360\2716\003H\016\201\221\303\234\315V\034\234\220\023\251&$N\356\213\030\223\0176>\343l~\320"
+	.ascii	"sd.9s[\270\365\262Z\373\266j\337\265e\373\371\266Q\266KM\257"
+	.ascii	"\233\330\306|3\363\205u\r\261\222v\371\367\312\342\260\\\366"
+	.ascii	"T2\301\202\360\271m\213e\265v6\313W\313ny\217\270\366\312<\300"
+	.ascii	"(\311\342\363fuP\236J\277;(\357\356nw\320\232\265m\235\322\232"
+	.ascii	"F\263\262\223\026\2430\271JC\343 [dFV\031\343\330\f&g\037;\203"
+	.ascii	"\200\025q\260YY\017\031\306N\311'\331\007\232:)44\371\374\252"
+	.ascii	"\351\227kIWWg\254+n"
+	.string	"\236d\335I$\326\244\266V\225<4I\350\350\300d\235\233`g\323\262\331<6K[sI|\362zF\362\307\370\330\324\306\260l\244|\303\371H\215\027\264X%\323\237m\370c<\350 3\203\343\363gS\372\263H\003\rl\004\203\265c\240Z;\232\314\350\322\0262\2208\212\234\215\330\264\370\002\003\311'\013a\"2nC\304\210\f)\326\200#\316\270\375h\223\323\302dr\225\232\312\213\242{\001+\310\271\352$J5q\301'\003\341\0365\200\334\205M\241\242\342\031\262\352db\230\2232\363q\236A\346E1\352G\017^]\030\252\263\036<|\314$\225\2148\033f\021-w;V\355l\222\231\261!\221\222\342\251.6H+!j9\316SKNF\214\260r&\253\b\304G\325r\311P\030\\\301\302\244\3112\325\245\355\351\f%\023\346\214\254\212O\306\301\312,\252Z\005\246\0075\267\345\211\f1\304\3007"
+	.string	"`\372\266\262\270P,(\035v\3308\337\360\311\315X\242\205O\246\301J\224\013\310\022\re\215\336\016&[\305\2644\245\022.\347\221\252d\016\243\223\023\317\330\244\004W\214<3\245f\026\030\3163\266[P\375\340\223e\324`\211R\305\203\327\306\033\271)\275\351\244-M\334:\231\344\351-\225\322\202 \317M]<\370\230cF\361q\341T)L>r\f-hJYd\251\216\034iA\370\204\261^hW\223\f\027oJ\354\202\022/\251*/E`\245\203[\272\224&\345\305yi\273d\244pX\2758\330)\003J\reS\322\263\220t\310-\206\\D\273w]\3068v\322\211\347{\307}&j1\221\213\333\307\356d\363\262\2105\231\321uR\311\343;;\363\342\305I\347\342\301<t_u\267\001=\027\252(\213\360y\271\355B\315b\330\355\300\347Y)\375\272\245\017B\340\020\357\207D\024$B"
+	.string	")"
+	.string	"\203>\240\271\212\021)\200CF\302\243\236\037\n$\"!\340P\217\321\021R\217"
+	.string	"DDH@`\020\350\023\002\375X\030:B\205\277\243\242_\021\272B\320H\2050\b\364\235\020\364#:\205G\300\240P\217\005\"! \340\220\220h\b\311\004  \232\017(PL\220\243\003\f\372i@\363#\032\022\002\177B9?\"\242\241\"\243_\0078(PL\340A\370;\372}PC"
+	.string	"\n R\220\002\243\337\212\025'B\\\310\206\304\b\241Q\320\212\021\024\bp\241!\243\037\360\227\"\375\003?\f\374\224`\341{\t\023$L\220@_\302\204\217\217\211\037\237\364?><!P\t\237\360\307\347\bH(\024\264\242(X\001"
+	.string	"\302\2538\340\301\025?\243\036a0h\3243s$\374\245 \204d\202\357\bhF\bD\n\n\365\204@\r8\300\"\250\210'\004z\340G\b\034BJ\357\343SA\210\023\033\\\220\n\215(\n2J\021\024\036\r\251\350\001\006\213\212\202B=\300\241\240\242\036!\243\243\236\021 \212\220\216x_\227\230`\340\332\232<\034\241\334\232\023>\031\007V[\255\203\361Z\215\031\333Z\233\\\312\302w04\314\306X\345@T\262r\243\353\253\305\021\246c\024\207\034I\254\370$#\343\263t\370\203iv>S\362\320\001\213O.;\030\023\355\306\206'\332\224)\\%\035\312@\351p\342\371Y\354\\\205\247#\307\2262>\231\312v1}\301\320\366\025\266D7E\003\n\254H\243,\253)\345\253\006\355\310\035\025\237[g\256-\376\342\255y\350!V\307\360=\241re\216\256\325$\317\f\022\027\220\24499\177\235\2414"
+	.ascii	"\301\271\244D\204\254\021\371d\257\363\223d\331\227[\027?\251"
+	.ascii	"\222j\016\251J\317@\212\005\003\262\311\271\260\025\027\2467"
+	.ascii	">\231\311\301\236d\243\233Zb\006u%\211"
+	.ascii	"OVR\363\245\244d\254G\312Ib\276nH=\035Y\262V\203)\225>\201\230"
+	.ascii	"\250\3018\204\034$\"\"\"\"\"I\222\244\003q\005\204 %\031u\035"
+	.ascii	"\021\020-\223\314\314\210\310(HR)5\006-\237\020~\315\243\346"
+	.ascii	"B%W\373\"\277\231k\003`\236!\37457\237\247\320(8Yd$\255\021\t"
+	.ascii	"\232\377\235&M\250\340\3471W\200\372?\025m\371Ll\230\017#0\323"
+	.ascii	"\365\373P\b\3445\345\243\364\t%\f\272\274\211\237\204\025\035"
+	.ascii	"\213\030\307\326d}G\365,\265\354g\377_T\330}|\255\306\237\254"
+	.ascii	"x\2761&\366J\023\304\274T\202\254\313\202\242\344MN\227GgJ\207"
+	.ascii	"i\263\213"
+	.string	"s\244\025\016\030\236\t\273\344\364\364M\214\2477\016?\343\226f}\017\331\356\365\327\203R\310j\275\352K\216\"\333\232`1dm!\377\025\212\034\r\230\b\230\200\200t\022[\262\333Y\320\\\314y4\200[e\242\317\314^\215,\001\345:\251\256\302\001\273\347X6&\037\033=\3646\320\242AY\003\300\r\3525=\266\221\340\300\213\302\002\350\203\320<&\207\234D\352\024\315@\347\301\346\007\017m0\033\301?\257i\322\006\203s\\\360T\017\217\3659\027\214n0\232\315\255\330\231P\356\023@\310\320Z\345\\\003\312\201\333F\235Mj\202\0037\332\267\202\027?\352\212Y#\234\373P\367\301\320B\260E\207\260\243\244\t\030\375nn\327\310>?\032\250\352\204\313-bM\343\261(\321U\310s0\013\006\312\266\027\006\304\322]\365J\343Op*5\220 \247\024\204:\016C^K\370\273M\2473\005\020\237\243hu\246a"
+	.string	"\347\017d\361K\006\021=#\223\025\234s/\365\252d\277"
+	.string	"\301\004\247]\364V\206\212\371\0242\340-\226/\001D\276'\2113\261\263\310\223\200\223\376\024\326\031^(\201\242.\005~{\312\212<\247ta\200j\005\221\200\276\230\305?\250\025\322\022\"\244\021\245"
+	.string	"C\251O\253(+F\204\034\232\331\254\225=\247\b\007\037\362\332Z_s\r\300\362\255\332\241\350\227``C\332\211e \362\254\234\332\232\024\210\367\375L\206{?\211\222\376\275\024z\004Ve\370\310\272\307\374\bPYg\374-d\314\350\254\227\315<\267T\262\005\004RG\370M\217y\220\243\217<\357_\221jt\021\177\032\362\241\211:"
+	.string	""
+	.ascii	"S\222\027\355\306\311?\036\307\266C\224 $\234#\227GS\032\322"
+	.ascii	"9y\235\351e\346I\303\t\315\207\340\031\3339\255\237l\365\016"
+	.ascii	">\f\334G~\240\313a5K\306\271\260\017\231\037\352?\344\021\200"
+	.ascii	"\033\354o*v\364\274\t\237\327\360\234\354'\351\375\303\017\303"
+	.ascii	"q\311\2241\352\037\311\030\375\235u\370<\023/\202\357\341\347"
+	.ascii	"\260\\\316\254\245\377\273~\246\3165{\243\314y\027\332\"_!x\024"
+	.ascii	"\2647\2709\357\364\213\347\235\3476\270\346\233\371\037\364\365"
+	.ascii	"\340\305w\005&\366B<\202\300\357\341\264J~\315g\251\273\362\364"
+	.ascii	"K\342\221Y\247\253\026h\222\033T\373\243\253"
+	.text
+	.section	.gnu.lto_.symtab.90c304fe8834eb10,"e",@progbits
+	.string	"histogramReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"histogramBucket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"histogramBucketUpperBound"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"histogramAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"histogramPermille"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"histogramPercentile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"histogramMean"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"histogramCompactReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"histogramCompactAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"histogramCompactPermille"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.90c304fe8834eb10,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
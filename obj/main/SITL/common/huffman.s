@@ -0,0 +1,294 @@
+	.file	"huffman.c"
+	.section	.gnu.lto_.profile.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 \210m\002"
+	.string	"\024\003|"
+	.string	"\002"
+	.string	"\374\230\247\260\003\016\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\003"
+	.string	"\002"
+	.string	"\001\361\212\334\223\003(\002\005\002\006\002\005\004\002\006"
+	.string	"\002"
+	.string	""
+	.string	"\013"
+	.string	"\373\r\022\002\200|;\212\225"
+	.ascii	"?\363\001\"Pj\364&\003\314\024c\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 8\255"
+	.string	""
+	.string	"`,"
+	.string	"\002"
+	.string	"\005"
+	.string	"\003\001\004"
+	.string	"\003"
+	.string	"\003\020"
+	.ascii	"\035Id\303\002"
+	.text
+	.section	.gnu.lto_.inline.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 \2555\004"
+	.string	"b\b\035)pU\222\016\234\312\320\363\013\226\221\037\233\341\221\323y~]=\272\373iH\023\177:U\364\276\377~\177\263\373\335\020\t\2212\005K\\\232Q\315e\300\322n\267\233\340\275\216R.*`\360\017V]\037\n!\370Y\262\033\330\227\263\t\351Y\234Na\276\242ww7\336nt\223\221X\275wQ\314\335E?\025 R\205\016\354\217J\3069U"
+	.string	"T\361\020\276O\002\005"
+	.ascii	"e(\365U\271!\256OH\030f\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 :=\001"
+	.string	"\310."
+	.string	"\002"
+	.string	"\005\001\377\007\177\002"
+	.string	"\177\002\007\177\002\001\003\001\004\001\177\002\006"
+	.string	"\005"
+	.ascii	"7\213\350\274\221\322\036,\002\003,"
+	.text
+	.section	.gnu.lto_.pureconst.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 8\035\001"
+	.string	"\270,"
+	.string	"\002"
+	.string	"\005P\374\007\374\005"
+	.string	""
+	.string	"\001"
+	.string	"\b\b"
+	.string	"\001\004P"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	":\271\311\345\330Y\276\001,"
+	.text
+	.section	.gnu.lto_.lto.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_huffmanEncodeBuf.3.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375`Z\b\2150"
+	.string	"\032V\334\022E`\\R\007q\336q\260\242]\001\321\025s)#\374c `\201\001\267W\203`[}"
+	.ascii	"c!\311\r\177\314\312\234\265e\303`\2238\260{\020\n1\273\036\256"
+	.ascii	"\b\252"
+	.string	"\274\350a\377\332W\210Z[\302\335\366\336I\246\024\"\001\f\001\032\001Y\304\026\027PQ\031\025\242\250}p\235M\340\004\365\264\347\232\277\036<\341\242\227\363\031\322\331\346\340\256YV\324U\270\322ok1c\375\030\022\365UX\004\0253\026u\353\001\306\216\326o\r\3149\214\256-\347\254\324\t\034w\273\231O\201\372\231\0137\346\fdJ[\316gJ\215t\235\3553\027\212G\201v\277U\210\261\022\231\222ee/\347\234\034\340?\255\263\253\373\264\316\276\020wa\377\252\325j\325\3273o\342C\335X\344!\016\205o\020\350\376Zv}\fm\017v\275p\343\230\027\327\237\273\037m\034\217klE\002\013c\303\331\206`\036\037nQL\004\363\341\372hX\342\034\217\253\307\372@\212\2231,,\f\342\305\303\337\025\002\231\226\017\rs\356\274\214k\f\007\313\270t`\340\016\002e\\9\260K \314\353\313\177x\\_\353"
+	.string	"<\355\312\302-\016g\211]\322u@\316\371\355\212\201W;_\313\352\340\204y\361\360w7Gb\203\023\346\005\346\370\007\225sn\254\325\345\345\335\343\335\276\354n\255\356\237\207\355\217\337\263\372\234\f\210\021.\213w:G\232\3012\325\021"
+	.ascii	"\211\020\264\177\261g\333>\006\372\344\211\323\030iw\321:\353"
+	.ascii	"l\216\301\2028\221\003\003W\273\317^\340\027\353v<\207m\257\037"
+	.ascii	"H\267\223\243\271/P\320\304\224TJr9o\244\317y#y\026\367#\004"
+	.ascii	"F~\305\375\200Wq7\340g\356\0050\356\"\257\363&r8\357!\357\342"
+	.ascii	"-\024\004\004\340\347\350\323c,z\025o\036\214\233\210q\017\201"
+	.ascii	"\270\205@\334\357\213;\350i\336@\337\342\355\376|\315\273\005"
+	.ascii	"\342fW\334k\020\367\007qc n\177j\202;b\311\271F\365N\036\303"
+	.ascii	"\272!\361:w8w9\3679\367.\356i\356[\334\327\334\355\016\323n\327"
+	.ascii	"o\335\227:\227\341zi\217s0N7\327\204\223k!\227B\017\314\325\027"
+	.ascii	"\177\203:\334\325\232\207@}\2413\341:[\304\336\326\356\326\257"
+	.ascii	"\263]\242\260\221p\235\365nh\273\232sq\266~\273{\255\337\326"
+	.ascii	"\234EB\231\026\275\234\003\276\346\234\263\220\350\235\376\265"
+	.ascii	"\222\367xmrT^\242'\376\227!=\361\205\254\340\336\343\323s\013"
+	.ascii	"\276X\013\375\3601\021\252\335\222\037\370\341\017\263\3048\360"
+	.ascii	"\305\232\270e\367\363\354\317\366\3352k\231\036\200\322\231_"
+	.ascii	"\323\361}~\352vn\001"
+	.string	"\t\215\237\202\357\2655~\361\247\335\335\013\276\370\230\232G\025\203\205\371\334$7\276\202\377Q\245`Q\\m\177\323\341yt\007M\366\3444\371\361\233\236\305QG\312$\372\363;gzL]BU\223\344@\317\364\354\0251\322\276$\037\372\344\263pq\322\276V\370G\25580p\265\201\376}\341\377[\226\215\350\230\016O\367}\366F\325\341\314\271\023c\215\332\340{\030u\r\026\346k\344\017}\360\335\316\r\334\250\223\365\025}2l\320\322\326&\347\371\244\377\033qR&Q)W\223\202A\022\371\r\214\330a\037\351q]O9\232\021Oir\306zj?\243B\271\344l\373\212\326Y\366\237\324\230\375\037\375\372.e\262z\323\265\370\377Y7\322\262(\256\006%J`\246\022\303\253\024\321\214\340:\227Q\316+\245\363\267\\b\247\322\352\225N\026?\347Ry\"\204\324\006!S\211\201\271d\251\236Q\314%\313Tb"
+	.string	"R=\243\234\317f\333SKL\251**\252'\211$\263YU\325\234J2\227RU\311)\253\253\344RQ7Q(\255\222\316f\323*\371\236e_y~n\031%dE\243\f5\326\202K^T\364\r\005\343\243\306\027\353\337\033\255e_q\355\\K\362\212\304\240G@\354\371\337O\363\034\001\376\232\361c\316\214\033\236\027k \221\241\022\005-}\030\351B\3001;\354y\036\344R\320b\206\013\374\317\260}g\363#\034\030\351=?u:\237P\204l\230\364\275b\003\317s\340\205\200g\004hm%!\n\201\036\370\323\026\036\337\375i\257B\343\267?\025z\245w7?\002R-\262!\305\311\360\305\372M{\235>\250f\367H'\272p\204\354MZP3{\234\263_\265C"
+	.ascii	"\276?\350\201|\276\377\347\217?\355\267\370\275~\317\033\177"
+	.ascii	"\212\364D\357t\250a\2600_\200\257\250A8\245\220b\310\320\214"
+	.ascii	"L \243IZ8\200\002\23193m\020X\210f\223\244\003\274\244K\001\334"
+	.ascii	"\026e\321\316\020\322u\342\"U\364\230\2504'+\225D\006\031\277"
+	.ascii	"|\224&#Z<\212\307SAd\232(\316b+`j\225-a\260\232\003!\027\213"
+	.ascii	"\254\f\305\306\276\365\230\352\214\211\022\001D\254\266\030\243"
+	.ascii	"\275\\_\326\030\355\007\341&a\242\301\030\234\361V\316\t\261"
+	.ascii	"\372\370\307:\035\021z\037\203L^\244N \003>\305\216\026\310\354"
+	.ascii	"\013\224\373\020\277\020U\342\271YV2+\213\370\250!\326\257\314"
+	.ascii	"\255v\004\201\341\007\027\2060\030p\367vS\tO\354\352\361]m\276"
+	.ascii	"t\240\342SF\026\373\r\nb\024\267\007\001\371\324\027\327_\367"
+	.ascii	"\3655\247iX\002\326\351\2775~`,?\203\303\253!0\274p\345\024\001"
+	.ascii	"\\j\207\247\227\357\351\342{\365\315k$Z\337\022\317\022\323\204"
+	.ascii	"M(\3225h\006\233g\313\201iQ\337`\024\345r\367\b\335\336\254\r"
+	.ascii	"\224'm/e9\017\344\t\344Z\016~>1\314\273bN\301E\343p\233&@\232"
+	.ascii	"d\023\337T\004\223\360\220:(U^\016=G\037\344\323\374\007\373"
+	.ascii	"z\323_\211\23137\332P\241\344\003\257\177\271\025\2123\004C\275"
+	.ascii	"\356\254\376\007"
+	.text
+	.section	.gnu.lto_huffmanEncodeBufStreaming.4.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375`\344\b\2650"
+	.ascii	"\352U\350\022F`\234N\007s\352!\037\306`j\325L\210\254\302G\003"
+	.ascii	"\341\355\307\200\201\325\231ClI\3564\346\2434\231\274\206\243"
+	.ascii	"\330\002\005\362/\254_\316\257A\034\237~\277\234+\026\004\342"
+	.ascii	"\007\221(l\"\302\216\266\367\336;\311\224\002\034\001\007\001"
+	.ascii	" \001\353\233\324\215=\036(\\_\275\373\331N\305\335\372\355\356"
+	.ascii	"6\246g\350V\360\212\355\313\203\353\353\322\202\247Oq\272\331"
+	.ascii	"H+\205\f,M\316\322\243\257]\301U\243\274\300{\360\330\237\264"
+	.ascii	"\234j\314Vdg\323\234s\202n\200\235H\005\031\263\025[\r%\307\335"
+	.ascii	"\036\365&O\227\306p\235\234\313\270Ls\226&\350\243\353kK]&\276"
+	.ascii	"\366\354\226S\245g\\N\246u\005\305/\347\214\034r\037\326W\325"
+	.ascii	"yX_\037\210\007\372\360\211U\251w\361\237n,\022\207\3027'\350"
+	.ascii	"\266\354\252>~\266O\271\361lZ\205\213bN\364\262\025f\205\207"
+	.ascii	"D?\272z\270\260\215P\345\3267\326u\346\257\n\201\b\226X\0066"
+	.ascii	"z9\352\2038\035Z\356e\013L\305B\370\372\034mk\007\016\362 B\333"
+	.ascii	"\372\302.\321X\227\227\267^\266\274\324!\234\305u\205Y\035\276"
+	.ascii	"\022\271\240\352P\316\371\345\222\201\325;\247@\026\244o\254"
+	.ascii	"\253\207\277O}%\343\3217\326%\346\270\215\220sn\214\305\325\345"
+	.ascii	"\255\343\335\216\241\273mt\267\177\001\004\336\301\027]\026X"
+	.ascii	"39\027\246\233sf\320\236\367"
+	.string	"\2146\031\0303$\006\353+\321\273\233\027\351Uy\023\245\302\201\335\322)\374f\335.\214\242u\244\277\254{\351x\300\347\274\221\274\316\373\310\243\270\033\3607o#\177\342^\300\235\270\027\371\024o\002\336\346M\344R\367\241\307-\344v\336A\036\347\r\344p\336?\217\333\007\343\356\031\342\346\031\342\336\031\342\326\031\3426\262\270\213,n\342\213{\370\342\026\276\270\337\027w\316\213;\310\342v\207\270\333\0277\253\342^\205\270U!\356\177q\343\034\334\256\240E\323\023\222\222\263V \234\334e\305R\304\355\334\343\334\347\334\353\334\337\334\341\334\247\270\267\271\333\275\245\375\256_\273\226c\013B\303\275\322.\347t\256\245\337\272'wj\313m\333\353\221&\347|\314sK\033Ua/\\_\033\213gyz\034\224\233\247.\026\233\330\322\365\325\210\275J\273\025\237\366\353+\234\324\320\224\332t\205\353\001jQ*W\347\273;`*\250"
+	.ascii	"\356P\254\361u\302:x \224\361\333\251<6\336\256G\"\310\205\347"
+	.ascii	"\267\246\370p\230\001\224\234\370\305\307o\3204&\377c\022\277"
+	.ascii	"\235\302S\213zv'\353\006\250\355\273\363[\323\276Y\273\223\035"
+	.ascii	">R\215=6\276\341\257q\372\2349\226\032\341\017\377\361\240\200"
+	.ascii	"j\204\277\372\240{\023E\340@\177|\020`n\240\200\354\373=Xjr>"
+	.ascii	"\370\357\253oW8\252<8\032g\316#\340\213*\235\301\307oe\\\367"
+	.ascii	"\327>\2717Q*o3\255[[\217\330\366}\214\215\214\025\376k\244\007"
+	.ascii	"\372\366\375\316U,`tW^Uo\306\207\021?\365\315\372\203\363-\031"
+	.ascii	" \221\276\235\202S\213\262\177\364\030\357\n0\204\213\031\261"
+	.ascii	"`L\316V\f\332\3034E$\275`}e\177\001_\224\352\r\374\372\016MS"
+	.ascii	"\275\355\330\177\365W3P4\374\377\276\247a\204+\365\256\305\327"
+	.ascii	"\265/4Y`\002\272r@\377\315\276\350\215^\215\003M\253\302\201"
+	.ascii	"]\340\375\347\276\304\\\001\272\336s\315)\340\254\235\311\372"
+	.ascii	"\032*T`e\322\302\2334\261\234\3406\235$4\231\311f\313\\\266x"
+	.ascii	"\023\312\344G51\024\223M\030\022\232\316\013&\222.\230\230\302"
+	.ascii	"$\213\022L\034\204\312\244\005\245\323z\302)A\351\264&\233LM"
+	.ascii	"\346\332MIJ\246\247\023'\234)\220\312\345\323\323\262\t\251t"
+	.ascii	"bzB6E1\221I\001z\331\"\031\205l.\227Q\310W\232\375\313\332\335"
+	.ascii	"\334M\303\304F\361\350]\324\242o\222\013\t}G\240\372*4\343\233"
+	.ascii	"\265\322\037\361\300\267`\270\350\177\214\376\347\205c\003\312"
+	.ascii	"\362\324\212J\376\363"
+	.string	"\007\336\247N!\354K\f4m'\017n\006\361\315\372m\023.\275\237%\t\373\243\007}\226\337y0-\311\031\3411x\206\004\360q\316\016\305\002}\326\321\007\275\267a\273\263\302\177\256\346\234\363\020\201\007\375\322\273\0220\270\3273C\306OH\340}\200Q\363z\221@\t|\203\336\347\205g\222\374\350}\036@\034hX\025\016\304f\336\310\226\344\374|\317\177\030\266\274\247\363\260F\337\363Aq<\370f\315\363;\\\2727`(\317'\361E\255\240v~\325\373\022\200\251\250A$\310\224S\b\t\215\314h\222B\2061\220\002\0219+n\021\0209\350 \232MRn\334D\357\303\017nb\300ESa\234\034\220\372\210\b\374\204\016\230j*+!!\027\371\007\004\236\274\005+\220\247\3362\003\210\204/\267;d\2676\313Z\327\214(\033p\277FI\205aD\243#6\031E\n\003%\005\274P\326\324\f\024\324`$\367"
+	.string	"\255\302\002\np1T \230\211<,\351\242\002L\020\256\373`\001\034)\235(\360\f\237\250\271\004\314)m\374\254\246\035B\364\256eQ\241\f\310\231A^\327h\251\206\233ji5E\"}\360\221\025\030\251\034\036\352\006\030\207\251\232\222A\036\372\205\232\b\2633\213\200\232\007\363 7\305J\210\005i\020\t\032\341\177K\335\3061\"C\022lL1\235\360e(B\346we\213"
+	.ascii	"88\345s\200t%\347\344\352?D\r\202\023\353Gd\250E\036\320W\202"
+	.ascii	"\256\323p\305\007\030\036\327\363\177\311\254\271\331\360\320"
+	.ascii	"\341(5\314\2713\345\240\344a\327\350\013\370\204\352\\q\b\002"
+	.ascii	"\240\231\324\255\275\265\237\246\310+c\332\300\n\2207\021\263"
+	.ascii	"\315h\22204C\327<\267g~\370o\n\342x\336\335\r\020\346A\360\312"
+	.ascii	"W\335\300\224\233\214\2624q\346\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 4U\001"
+	.string	"\024\0020"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\b\370\317\365\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\t\261\217\306\f"
+	.string	"\002"
+	.ascii	"\240Mj\3151"
+	.text
+	.section	.gnu.lto_.refs.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"(\265/\375`\300\007\205,"
+	.string	"jQ\224\021IpXR:\177\177\376\263p\020\311\244\030eo\260}\277?jb/\036\\W\352\270\331\206)m\316\201\301a\326\022\354\3707*\336)\245d\226\224\320\332C[\351GP\017\314\377>\227\327$\223\004\207\377b+\022\t\322\210L\001\346"
+	.string	"\004\001\007\001<\\\332\244\254\324u\337\237\241\241\3249e\306MM9\n\227\361\025b\263\363\030\213\375&x\373\242@\330\220\201\241\351=\254g!u\367|\262\220\372\r\253\002&\240\246\025\326\023\255(\017PyL@\375\231IP\317\275A\334\n[\356bt\311\225\335\235\0313\200 Q\260\237\223\260\222\277v-\025\262\307\272\257\017\312\246\205J\210\246\334\305J\370\006\261\327#P\370\016\370\325\312\356\333\023\240\r\2226j\320\364B\353y\311{\276\232\302\321\365\034\244\362\223\203\324_&\240\256<@\375\277\366\237\313\377\266.\377\337.\340KD\201\237\245\374?\373\317\374\017\366\237\301\377\022\377\201~N\177\376\177\263\377^\274\237\301\374\237\373/\342\277\363\177\225\377i\377\251\374\017\373\277\374\377\365\037\300\177,\377w\317\347\363\371\277\371\363\205_-\006M\234"
+	.string	"\274\315\376\301M\340\326\261\251\244\272\017\020\273\201\334\315\356\006v7N\361x\273u\360\332$\221\330]\365C\354#\360L\252\033\035\373bfl\227Z\310\336\031\223e\262a\\ '\333\231U\\\227@\257\246\352n6\263&\2155\342\2748s\350\334\33244}\333\351\032B\307^\353Y\371\367\3328\013\203\001\t\333\016J2\026kc.\374\305\315*\013\\N\2720\033\273\361\032_nc\265\363\026n\376\347v\017\273\233\257`i\222lc-|\306s\323\215\034Kv\337\241\241\237\241!v\002y\234\001H\317\\+\3770\220\365|\265\236o\254g\252\225\307\003\254\200\335,\257\310\251U\021Z\207S\234(\323\250"
+	.string	"\220\242\205\250\206\246\314\373\023"
+	.ascii	"K\215\016\037h\372\027\353\024\226\302\227\321\270\311\331\t"
+	.ascii	"?9z\273\227\335}\026c4\206\302g\334\364qA\251\204\353\276\227"
+	.ascii	"\360\367\376\b\024\030\215\311\370\013H\330}e\025\312\356\006"
+	.ascii	"\2729\316\321\255\241)\233a\260\2332UVL4\345\2703\321:,\251\030"
+	.ascii	"h\312e8l\307J\222\034C4e\27039NI\02114\375\034\223\371\237\223"
+	.ascii	"#$H\027-2cv\214\304\311\2751\257bIb1\321\224\305p\223\234\251"
+	.ascii	"-2a\346\326\243\277\332\301bw\323\270\271]\024\356\250|\303\334"
+	.ascii	"\340\017\300;^\360?\355\335\023\300u_%\345V\"e\301\035h\372_"
+	.ascii	"A\377H7\320\247o\027\333e\026\260\r[3\372\334\306*\320\313\255"
+	.ascii	"no\2261E6\332\267\271\207YF\026\355E\026\333\213\004\362z\210"
+	.ascii	"\004v_#\257\035\013\002\271]f\031\333%\322\350\323\303\006\366"
+	.ascii	"2\210\265\016\221\3066\013\322\310k\227Ac;\3142\372X%{tM\201"
+	.ascii	"\tr1\260\035\266\f\3421X\3445\333\213lg7\217IuqA\367\021Yt\006"
+	.ascii	"q\260\231\260)C\370$\210\344\333\335\006\210B-d\017\233m\021"
+	.ascii	"dw\021a\212\354\217i\207\342\307\324\224\344{bC\030\270\322R"
+	.ascii	"\024\206\237\006\336\225\230\236|?\037\212\365\023\212\034\024"
+	.ascii	"\031\265\300\271\321\021\204#\b\352\215\216z\275\243\242\336"
+	.ascii	"\372\242\336\216e\231T($\037\233\304\206`Y\246'\022P>\326\205"
+	.ascii	"\211\035\037\353\002\347\347\373\260\024\205\201\215r\312a\237"
+	.ascii	"\002\350N+|OD\254\223\323\023\221\016\213T\324[S($\237\n\023"
+	.ascii	"I\"x~\276\017\276\023NJ8,\222\021\373c\212\302y\257\227A\301"
+	.ascii	"\b\020\034V\245\007\277\244\246\245\245\250\024D?\247\246&'%"
+	.ascii	"\242\037SR\023\221\322\023\024\321\003\004G\203\250\220\357\231"
+	.ascii	"\3500gx{x\324\336\334\234]k\013\234\347\363\371\3443\325\253"
+	.ascii	"cvEf\003M\317\374\f?W^\013\331f$\371mLZY\233\363S\207\311\223"
+	.ascii	";\206\246\234\206\331\340\240\035\207Ta\263F\205\343\262r\276"
+	.ascii	"\265\216\021\266V\211\032VC\2238\246\326\240)\243\251C\265\326"
+	.ascii	"\363\027\006s\016\3630<\307U\275\373\262\204\306\261\256\253"
+	.ascii	"\252\032\344\320\365\221:\271\363\334\231;\335\001\200\211\250"
+	.ascii	"\221D\205\2203#\"$\201\310H\222\244\003p\002\221\252*\333\021"
+	.ascii	"\240\261\201DL\244IAj5\006Q\0057\237\242\264c\346\007\351(Or"
+	.ascii	"\026\362\206F\r\260\344\250\037~\217\034\352\223\201q\224;\225"
+	.ascii	"(\360\003\021m\f\030\262\213\361*s/\005\2520\3401\230=\013\300"
+	.ascii	"\t\250\201\370\034-\300\361#J\360\243p \037j`R\r*VeH]v\333<A"
+	.ascii	"\017\260\r\"\003\246D\366\217\0031k\314\275\257\233\333\334\330"
+	.ascii	"\232\234\034\"\214\177]\026\310^\377Mn\0268\342,aD\3747\f\360"
+	.ascii	"\344xr\231\362\3420&\002\251Z\272\264\t=\2468S\311\246\0365\021"
+	.ascii	"\t\021uA\245\364]\032\b\250\363\377N+/\363\304\244z9h\027x\256"
+	.ascii	"\2210\365\275\331/\2620V\304\027\346\276\021^\256\3717\270^5"
+	.ascii	"\350\021\334\256\201 9M$O+%\227\366\230\035l\231\304+~O\227j"
+	.ascii	"\177\217\232{b\362D8\246\357\250k\242x\370\320\314\r\324\246"
+	.ascii	"\242?\235^\212\217zg\265\226K\236\373+\335\262\327\326u\020\331"
+	.ascii	"\267\310j"
+	.text
+	.section	.gnu.lto_.symtab.6e6ff4e2f8bfdf32,"e",@progbits
+	.string	"huffmanEncodeBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"huffmanEncodeBufStreaming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6e6ff4e2f8bfdf32,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
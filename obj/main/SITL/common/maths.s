@@ -0,0 +1,1313 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\260\005\375\t"
+	.string	"\324\016\244\006"
+	.string	"\035"
+	.string	"\341\333\245\345\002"
+	.string	"\001\337\352\303g"
+	.string	"\002\203\270\227\357\001"
+	.string	"\003\264\245\347\210\r"
+	.string	"\004\346\353\250\236\002"
+	.string	"\005\246\240\335\225\r"
+	.string	"\006\267\332\206\371\013"
+	.string	"\007\271\225\217\236\002"
+	.string	"\b\352\222\314\276\016\002\002"
+	.string	"\002\001\t\223\242\326\261\005\026\002\n\326\331\347\361\r\004\013\350\355\231\037\f\231\274\327\315\004"
+	.string	"\r\202\362\202\320\006"
+	.string	"\016\326\360\230_"
+	.string	"\017\277\337\362\237\002\030\002\003\002\002\004\020\343\267\372\377\002\036\002\002\002\005\004\005\005\005\021\356\322\327\356\017\034\002\006\002\006\002"
+	.string	"\002\007\007\002\007\022\242\333\255\257\0038\b\b\002\b\023\333\332\376\205\007d\t\t\002\t\024\234\341\340\262\001\220\001\n\n\002\n\025\013\013\002\013\026\f\f\002\f\027\r\r\002\r\030\016\016\002\016\031\244\246\246\251\f\032\275\305\343\240\f"
+	.string	"\033\354\261\352\343\013"
+	.string	"\034\364\207\213\233\001"
+	.string	""
+	.string	"! `\202)\022\025<\240\300V\203\223\270:\216\003\254\004\351F\017\216"
+	.string	"KF\342\351"
+	.string	"\016\260f\344\232#8\300\222\221\304G\335)\327u'e\272\254\305KL\330\355<s\257;\003\235aD\303\037\217\352\321\305\320Z\2120~\317\013\305\264\246"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.ipa_sra.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\305\005"
+	.string	"r\006\025\034\220)\351\377\377\377\377\377\377\377\233\302?B\377\243\377\321\022\031\221-\371\255m\231\344\016\345\350\r\006m\321(\022\210\222)\017\245\241@\210\243a\016\235_\216\264c\264\352\351\236\bM\006E\013\252\234\243]}\323\320\247g\200\013y"
+	.ascii	"+\311e\275\317\326\243\030\t2 \360\002\"\233\016\276\330\302"
+	.ascii	"[,m\300p`\361`\207\320\270:x\2141\030\260L\016\206/;\204q\006"
+	.ascii	";D\343\312\2011\370z\354\240`#9A\026\364\311P:\230N\020\234\253"
+	.ascii	"\003\244\252`x04\212\036:\322\2068mU\361Y\364\345m\277\360\r"
+	.ascii	"\307\006\",haP\216\265a\360\342\002\f\001"
+	.text
+	.section	.gnu.lto_.inline.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`*\013\025#"
+	.string	"\006\261\236G\260XQ:\200\210L\343C\230\253\221\314(\200\320\016n\003\277\265!\336=\322a:(]\336jub-\266\263GI\357\257\355_+n\316\351\016\313>\243<\245\260\007\307\271\261\302\027\323\026!\262elvH\334;\311\024\212"
+	.string	"\212"
+	.string	"\206"
+	.string	"*\202\210B\304XNi\311\212/\236\354\300\335)\307\276\263;c\340\020\264+\266\250\020\202\3578*\035c\017\022D4\"t\304\355.Im\250\205\324\307\b*I\326\276\316.\b\004\376^#\2555\364\b\220O\225\027\337\021lji{q\3725=\354\356\314\216\266\277\253C\245\320\031\34650\377\020s\t\321\306)\205\356\373\005\337\021\026q"
+	.string	"\371\030\221\254\367]\337\335\355l\331g+z\214\024\334\216\262\223X\321c\024\300.`\317@\376\364g\253Gzj\360\204\035E\020Q\316\364\004W\2366\367\f\375\031\372\223\365\241\"%.\364\240\017Z\025?\335h\360\312\301\r\324\340kT76P\360\033\3349\336\334\311P\321\222\031\273\264\3306WW\234\247\223\016=\235bK\312\222\025M \231Qt\317\224'\353)j\264\037\256\313\373\034I\031\352f\235\351\212S\323qtBgz\006K\353+\3460\302\203\203\344.\326n\253,\362\374\360\210\322\231EN\313i\330Q\32271\2455\f\264\267\244\2352v\327\344O)\327\260\013\331]\031\377\373\212\267\335\375\354\327o\236Ua\264J\025\206zC\243\326P\027GY\204AkQ\304A\374}\337\367}\261\324a\365 \345\271\365_\035m\311b\275\271mw]\f@\306\361\365\365hFxp"
+	.string	"\3742c\371z\025 Mh\274%-A_\202\276d\375\207\326B\211\353,\376\334\025\006\307\024@>9\222I\366\245/m\036\342\304\217-z\252\024]]\177\006\266m\317\260\343\024\026o4\236\236"
+	.ascii	"J\007X*\224]\021\250\353\224]\021%\013\230\211\001\"*\312X\370"
+	.ascii	"\217\\\356H\233X\270P.wd*\tNLvW{\"\224\335\365\020\032\323cX"
+	.ascii	")\221S\3413\254\224\310qp\212\211\275\307\356:\210\235\310\356"
+	.ascii	"\322x0\032X\330v\375TmgW\007\004K,\246m\316\256\266#w}\235\353"
+	.ascii	"\025\233.\016\004\225\312O\020\206 8\247\245+\342\334\212q\201"
+	.ascii	"\277\267$\033*n\025\325\236c\354\200A9\301P\245\333\005\200\355"
+	.ascii	"\250\301`\247jDD\nR\222\244\320\030\220\"\232)\"z\022\200\363"
+	.ascii	",G3\251T\"#\"\301HAA\222:\331\032\003\303\n\030\374\343j\312"
+	.ascii	"\263Atwy\300\361\240\377\b\210\356\205\017\324\t9\245\234\350"
+	.ascii	"\350(\204\022:@%o3\016\340W\r e\261\002\216\006\220\013k\210"
+	.ascii	"$x\371\344\245K\244\231\310\306\tf\306!\351\370&\204\210\350"
+	.ascii	"\315\005*2\206\026l\261h\231L5\346\007\026\017-\035\220PEx \n"
+	.ascii	"X\243,\337M\240#<!\371\370q\302\275\366d\253\221*;r\262\221\344"
+	.ascii	"\207q\321\307\304\037\350\257)1GR\321\001\220\244F0b\364K=\240"
+	.ascii	"\013:nv\240&\370%\321Rk\363\213_eHp\206\0138V\324"
+	.string	"\2265A\032\230\006\370\324\342\310\004\205\332\261[\320l\277\235\2730\271/\024!X0\364\022\340\255\013\367.\215\213\232\243'H^\325\276\302\205\020\226p\245X\216r\216\002\207\231\205\266=/\216>\034jE\325Z]\n\205\204\377\220#n@\342\277\022\246\335\232\376\213\337\375gUaN\021\b\310\262\020\313U\323\215\305\324i\254\206uB\214Y\301\256\217\377hFO\261w\274q\017\2523\337\360o\206\312\205wb\255\373\313\250\017\200 p\n\227\317\371\006\240\277\315\3054[\027W\003\305\034H\303Ln\356A\200\025\255\3700\276&|:\257\207^\333\253\271\246\210\034\3523k,\204\227]`\b\364\274\204\3200\276\177\177k]h0bhf\233I\360\036\235\260X\325\r\374\245\253\205\036\347\373p\334\330\305Q\200 A\017\201\007P\317c\272\267\235\003\360\311z\302`<\325\342\026\251\222F\220\344,\001\201\262j\275"
+	.string	"\246\354"
+	.ascii	"\303c\234\342\353a\272\341\211\342%\353\n:\234*\354\353\243\340"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\025\006"
+	.ascii	"\302G\033#\240)\035\303\257\036\307UU5\327\177\363Z\325X\325"
+	.ascii	"9\277\265\377\333\336\273\255\355\266\377\255\021\262\311\336"
+	.ascii	")\311\371\374\327x>d\300\005S~\223\"\201\200~\256\035\224!9\355"
+	.ascii	"\263\344#\347Z\005'\323\206\360\006\202:Q\033X~\001}\234\357"
+	.ascii	"\234\3467\305|\326$\177\265Fii\205\202\271\304LOb\224< ~r\227"
+	.ascii	"\217\332td#\001' \220\002SU7v\350P\203\021.\266\0231t\261\301"
+	.ascii	"\032\202A.c\b\306\225\203]\235\261X\007lP\270\302l\235\347l\271"
+	.ascii	"E\013\240<\230\007!\356\222\265\240\340\0044\030z\365\2076\206"
+	.ascii	"j\207\267\301`\222\271m\231\301\026\345t\373w\310q\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375 \\\225\002"
+	.string	"\302\205\023\037p\211\322\001\374\337\373\036\252\375\377\277\253\252\252j\212"
+	.string	"T\001U@\265\375o\377\333>\375\177\007\2231\027S\361%.\342\036\256\341\026.\341\016\256\340\006>\300WMjNS\272\321\205\276\347sf3\231\271\314\247\362J^\310\017k\230\231#"
+	.text
+	.section	.gnu.lto_.ipa_modref.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375` \001\255\005"
+	.string	"\222G\026\035\240'\351\377g~\256\306\377{UUqU_\347o\335\326\366\223\357j\377\023\342\245L\001\354Y\230\035\305 \207q@\006+\250W\204\277\217\337\210\366\267\324\364U\220\243r\344\216\322\212\022\034\374g\026\n\230p\231\257\365\274\24365\360ZL\346<\225\033\345Q\b\230]]\013* \300\202\231\261\362>\" >\fo\304<\315\322\"=\210\270\345#ch9\372bhN\302\340\342K1\253\026F\273\273\"^`9\243"
+	.ascii	"\n\006\025\034\221k\357\f\237\256A\347@\r-%qf\020\256\bd\241"
+	.ascii	"\027\027wK\2332\336\301\217\230\267.h\334`2\020\\\270!"
+	.text
+	.section	.gnu.lto_.lto.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.5.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\025\f"
+	.string	"6\327RA\020q\224\016; \034-\264\364Rb-4\245\337\347\260\333\213T<lX\020)8vI{\020(\374\364\307\336^\267H%w\273\250"
+	.string	""
+	.string	"(\267I\021`\266\214\345%\326+jm\315\222\275\267\224)\005A"
+	.string	"?"
+	.string	"A"
+	.string	"\027.\030fx\240\250\261\2731s\f\374s\037"
+	.string	"\377\324C\226iv\247\231\371"
+	.string	"4\323]%\344\352\016\210\270\b\t\240\235\034&\006\207\223\247\236 \032G\246\245`w\235\037\232\206\373\335\366\002\333\321\276\203\252\351\324\364-\002H\b\274\330\315\260\262\2610\336\n\021\337~;\363S\276\330\336*\270M\301\200\304\t\312\356n\376\274\251\374\345QV\331\262\333b\204\212\335E`\003\225?\333~\211\233\310lU\203jz\202\017)(\272\275\004S\037\2340\341\310\024g^\202\327\324w\210\234re\250\327GB\303\343\306S\250O]\303BF\207\211\205\\\331\233)\265C\t\210\222\020\326\021\353\333\r\217\372\337\323\356\250;#\320\207\344H\267\207#\2120\352\\\021\204]\027\346\211\240O\347\212\236\220(r\n\030\223"
+	.string	"!\024G\030\026\212\227\275\216X\233\ri\225\355\3248;M=9\227OUAl\230O\355\t\024\340?,u\001\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.6.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`=\001\305\r"
+	.string	"\346\232]C\020\217(\035\250\001\323\253T\360\037j\254\375Y\2317\"\264\344`AVBv\030\002\023\227\370\233]\375\227h\232\363p\331\226\263\247\002\266\001\020\240*,"
+	.string	"\300!\200\030\322\t\2720\220\326}B\310\336R\246\024K"
+	.string	"I"
+	.string	"J"
+	.ascii	"\366=\374\003g\253\022H\310\220\274\224R/vW\333\270\306\365\b"
+	.ascii	"\017\340zT\r\347\01659\377)\207'\013!L\236\310a\311\025\0220"
+	.ascii	"I"
+	.string	"Q\222\341\211\240F\013\006\227\247\236#\336(\023;\260\273N\223G\341\216\267\255\300\266f\377\024(\177>}\214\201\n\001Z\273\023Z1\226\025Mp\370\367\333\367Y\376\371\251\025.t\224U\345;\355n\310_q\346\321\241\253D\200+\002A\007\027\026\273\313\361h\216\354\234\235\311\243Xe\314.\212\023\211\335-\340\001\331\243\035%Z\264\\P\324A\256K\031\260\254F\t\303\033\007\271\242^P\243F\020+J/]\266|\205\372\3245'T\220V\235\352#J.X\353\034\355v\232\324\353I&\242l\331(Qj\006\373p\365${\032\203\351\013\246\343\277\033>\240\316G\b\f\2717\035\037\007 \017\216\326\3318\234m\243u><8\332\306\363\321:\004x{\320\300\243\201\266\315\243e\272\303\325\023\033*\266`\303*\255\262\235\232LGlg\372\224\237\204\344\261:\025A,\257\376\367\201p\335\204)T\221\f\030"
+	.string	"i\b\361\3350\026,\270\303\354MT[ \325F"
+	.string	"0+0\277\242!T\354J]\346\032~\262\201\323c\027\2720\f\\\302\252\351[\342D\202X\306\004\021\025n"
+	.ascii	"*\217U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_atan2_approx.7.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\254\004\375\033"
+	.string	"\346\361\255I\240\330M:\300W\235>\360xE\003s\212\332s)V\244\211\214\265\263O\246\005\345B\310<\247\306{\220(\377\347\0244\241\352\333"
+	.string	"\237\002\354\361\024^\345\325\326\342\245\231\323;@l\300d<~P\263\267F,!d\313\235R\233"
+	.string	"\207"
+	.string	"\235"
+	.string	"7\0228\371w\203\353U\025\023tS1\016\0344\202\036\215\003\237\227\341\237\307Z{\274\270QkE`\003\255\203\266}\030\217\361c\377hOI\305\211\200\020\362e\325Zk7\227\205\007\351c\302\203\233\342?w\215-1\004\351\316\037_|@]\030\005\361\220\003\272K\367Q7\200\027\242\304l\r8!\242\350\"- \004\205\222\017\tQDi\273\037#\204fH\342 \371\312u\230\324\225\033\361\215\345p\364\246\326z\251\317\241\334mN\361A\255\325\323CN\304\375\272m\236\355\0066m\0210+\333O\035\302N\207EJ\271\315\3221+\2634\037/\013\263\nt<\310\254\240Y\332=\240\271I\366i]$\333\206V3\243\371\364\314\247ew\272e.\343\2179\324\r\363\336\377\342\322\022{\324\r\3734\313\247_\237v}z\374t\353\323\342\247\303O\203\237\246\237\336O\317O?"
+	.ascii	"\314\311\316\004\212\242\305\352U\020e\225z\005\346`q\247\037"
+	.ascii	"\352\217\372\332\267?e\277\246\375\343?\335w)\277\242\214\026"
+	.ascii	"@\371w\243\024U\023\367Z\226m\260\304\265\257e`\005\207\356"
+	.string	"h\\\327\326|\344\016\311J\221qq\250H\236R\223#W;p\342\266\366V\341\212+\300\212\344\225e\216\202\033.\200(t\301\005\340#y$\254\234\250Uv\351\326\370\310\035l\347\356\316\250H\336\327\277\357\252\262\256\256\314\005\255\310\245\333\3576p6\216\252\035\224e\026\256\326 \002\260\375^\247+I\336\215\312vfi\366R\207\241\"\253n\263\234\331\317\370\334\371H(\267Y~\326Z\201v\223\374\263=\t\310\266\210\250\351\t\tnR\261\314\006=\026x6\202\204\036\n9t\3039\334:8=\027|rvj\031l;;6\235Z\006\f9;5\035\236\236\032\016\3156\r\026xj>6\033O\355\325\253\247u\221V\2146k\332jY\027\227\215\221S\256\202\366\346jY\233\265\321A>\t\032\245>.5\355D\332\232\206\261m\211\331\031Q\222V\214\3226\202\321\217\\:\216(B\216\304M\362\2154}"
+	.string	"k\266\002\323\025:\333\330\016\275\354\214\b+\234\315\020\222rU\263>FR\344\022\270I\336\300\304d^\211\t\310\322,l\207l\317\210\210<\375`\331\326\316\3665\310a\250a<\244\020S\210\321\004\"\222\302\202$\035\300\002\221)c\035\020H\206\2144\311p"
+	.ascii	"Bo\b\013L\340\312j*z`\264\371\024\003j\020\333\345\327T&\273"
+	.ascii	"\030\b\251\035\202\372&\006\314n/\262)\037\333\230\215\275\005"
+	.ascii	"\027\356?\226l\036\272E\3221l\370,F\22283\005\f+\001!kfp@\177"
+	.ascii	"\025\2047\201\024\311\027\034l{\223\320\275V\324H>n\231\332\032"
+	.ascii	"\314\210\203\251n\317\315YqO\277T\033\021\005V\266\311\321\214"
+	.ascii	"\006%A\242\310A\331\001[\240T\242\276|\023:\n\236\2338\270\314"
+	.ascii	"[\r\031b\256\200\207\302\213)<\256\001\367R(46\025\2231d\233"
+	.ascii	"r\007\205~\337S5\016\353\355\321?"
+	.text
+	.section	.gnu.lto_acos_approx.8.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\374\001u\021"
+	.string	"\366 tG\340\322&\035\220"
+	.string	"\002\n4\333_\310\025$\017\374\346\306\236\207\022Y\272\030=\347\304-\310\343o\337\\\205L\350\367\257\027i\306\264\205\212\31109\306\030\215\326\211aF\334(\037\013&x\024Y\332\3106B\b\331R\246\024]"
+	.string	"X"
+	.string	"f"
+	.string	"\317\3649\026=\232\263\306\212\030s\316\006f\300=\263\355\343\234E\312\026%\254\204\211\007\275\210\331\031\232sz#/\240=\223'\240=[\022O]\256\246|\325\345_\255Q\2065\363\225\013\200F\354"
+	.ascii	"\300\002\245\210\253g\346\261\353\212\365\251n'sN\253\f\313\303"
+	.ascii	"\235\335v\004\333\017lu\t\243\rS\351\332\330\227sk@\016\273K"
+	.ascii	"\327\271\273\347\374\244\253GWsWoWkWgW\313\253\367j\275\372\001"
+	.ascii	"6\024@\tn\314\311a,\232?\331\214\023\207\375:W;\345\267x\314"
+	.ascii	"\235\216\305\021P\300\\}0^\016`\0269U\007\003a\020O\2179g\311"
+	.ascii	"3\227p\001>.B\035\333r\253\371\204.m\267\335v\302\033\033!D\024"
+	.ascii	"\201\331j\033\362#|u+7\333\0038\302\233\017\253\f?D\340\256\\"
+	.ascii	"\0044B\327'\036\204\n\r\020\306Q\250\246\333]\005<\341\215\324"
+	.ascii	"\257}\001\203v\031\335\021pU\356\326\342\255\340\2340$_\t-\036"
+	.ascii	"\341\353\323\321\244\355\366\261\313\024\255\034\341\020\214"
+	.ascii	"\006(/\332R\301\205E\005\245\275\334)&,\023ZPL\336\312\311d:"
+	.ascii	"\245x+\024PL^\n\212\3053\021\361\311\202\n\312k9\235P^\007\233"
+	.ascii	"\227sk|\032\034\227\226\006,\310\216ve{\264>\201\331O\2266F\350"
+	.ascii	"G\202\354_\2551|}\227\341\003\210f\327\306\242m%!m\310\006\234"
+	.ascii	"X\017\250D\346V\267\264\017' \200\202\221\200Q=\355\b}(qZmX'"
+	.ascii	"{i5\246\266\306\nwm\025\247c\223\013m\304i\347U\366\313\251\203"
+	.ascii	"\233\207\206'\370u@eb\261q;j\2535\244\357\340mF\303\001\357\325"
+	.ascii	"\236\217\234e\206\r\351}\276_\2218s\002\003FjB\270\002\310gR"
+	.ascii	".\317u\366"
+	.text
+	.section	.gnu.lto_gcd.9.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"-\013"
+	.string	"\246UK:0/T:\2041\266\204\201&\032\232\256\002\257\020H\3237\242\375\233&\203\fG\325g\306\3322\204\334w\020@\262\253\256\241\240\202\244\255\315\220\230\362ni\013\244!B\366\2262\2459"
+	.string	"="
+	.string	"6"
+	.string	"\177T\217\272\301\267\346\366\b57\377\337\241\007\f)<\035,<j\016\241\004u*\001\340:\320\352\200H\377\236\037\216\223\372xZ\223\335uz\270\nwu\333\013l+\260\237 \336\235O\337\262N\254(\320b\027\224z\261*b\211\203\355\315v\330\036\t\362|g\223\033\273\031.\224\330]\210\0170\036\377\341 6\333\004\275\021w\r(&\214p\261\273\227\201\013\250\036a\033\250\"\377{\200\370JS?\377\3168\205\350b\252aFU\375 x\352"
+	.string	"\n)\021,8\211\262=\315\341\356\256\252\310O\311\bu\262\206\354{\177\365\356\217\357n}\230\226Y\030D\fB\246\256D0\r2\024\354\3124\f\323*W\346\200\202]\225\013\346\212\020\260\366\300r\2712\232v\271\034\336^C\266SU\257\377\336\220P\332dJI\230\350pQE\352I\004\r\025"
+	.string	"i\004.0\307v\032\177 \251"
+	.ascii	"\003X\370\320\032k\237\236\r\320\004\265\004>M(`\016d\006F\004"
+	.ascii	"\0250\240\222\371)\373p\224\254\272\251\246j\264\253\344\001"
+	.text
+	.section	.gnu.lto_applyDeadband.10.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\031\001-\r"
+	.string	"\006YYB \255&\035T\2047P\036\002;0C:\301\303\001(\204\017\200\2317\352\274p\020\330%:s\367\327Q\271VV\332\371\250\213\001\332-\t\020\300\302\005\t\002P(\331\002nN\034cF\354\336[\312\224\002F"
+	.string	"B"
+	.string	"G"
+	.ascii	"\273\026\201[\300?w\001\360O/\\t\370\234\246\310\3778,\371\003"
+	.ascii	"\220\225\334\271\213\020W"
+	.string	" u\202\331d\244Tw\300\364B!@6r\026\251\023\314W\236#Y)3\223\261\273N\221l\302\235\271\355\313v\002\373\034\001N\277k\277sZ\237\362\247\323\2572[j@\334%\211+\266\304\023\201b\237\305\336\334\366\2607\266\266Y\231O\351\260f\327\202\007\020\273$\0046P\375\331\3665|\203\207EN\303\220\301\023\n\t\034b6\243\214)\322!\004\365\024\225\n\365\245\f\243\214\277\013\312\210\315u\300\324\005$)ZH\220r\313\020*R&\252(\273\225W&Z^H\2719U\365,W`\252\340R\212\001\311hk\037\251(\373\032c\214\326\023\333i\030\035\320\305\240sy:\225\207\343\301\025\341\231\203\241\321`\343\372X \354\363\3018\026\310\301\365\2618!\r\013\343\302\030\004O\310\332\300\260\220\265\321\366z\342tP\363\204\312\207\3674&*\246\364E\360:bg\200\350\310nw\027>}\311\024\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.11.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"\326\330XB\020\257&\035`\225\204\336H\303\206\232-\320NU,\\\306T\351\300\256\230\211a\034@@r\264\271\277\216\312\337\0301\r'\326\330\355\266R\004"
+	.string	""
+	.string	"T"
+	.string	"\241H}zLT\213Rh1\232\335{K\231RF"
+	.string	"C"
+	.string	"E"
+	.string	"\273\225\200g\300?\367"
+	.string	"\360O/\\t\370\234\246\310\00794\371\303\310L\356\234\206\210#\200J\221\341d\244Tw\340$\246\004@6r\031\250\024\231\273<I\262R\246\206cw\235#Y\205[s\333\226\355\004\366\037\004v\246a\246\337\267\337\275\345\327Lg\246\277\301\260\200*"
+	.string	"\263K!\266X\024o\004\213m\221\315\261\267\025\325\363-\022|\261K\"\204\210]\022\002\033\330\374\331\366;\334\203\3106\271m\005\303S\304\t\037f6\031s\004\204\210\366TS\205\372\222\206Q\306\037\206\245D\312\251f\223\355\034\240\252\240\204\303\313\tR\246\362\304\002\205\242\252\331\351\265\343%\206\224)\253^\357r\267a\305T\232\t\311ho \251\232}\2151F\253J\036\220\325\341\261>\236\315\007B\003+\302sg\303c\301\207uU \354\272\260N\005b`]U'\344Qmh\030s\360\tU\037\030\026\2528\333^U\234\016j\2528\231x\357\002\345\224!SI\324\034!:\262\333\335\205O_:\031\005\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.12.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"R\21765`o\032\003\024F\0250\303"
+	.string	"\304\234\244\263\367\003\321\320u\247P\332)\327\206\220\325\377\367\266\213{\354!w\0254&&x\305B3\310E\336D\357\261\345\2262\245\023\236\207\330\214\003\202\bu\264\371\3314m\313\346'\242\243\315\214\003M\316A7\t\0177C\333\306M\315w[\217^\035BV\244x\321\004\267\0246)\013\366\237\241.\251\260\0308yX\326\242\3132\272\240\240`Hp\246\375F0r\264\266\376\277\321k\235\262\241%"
+	.string	"\322\262I\3713fd\276\222+\037\232\266\206\255E<\3229%2\301\357\241T\376o\241\033\314\262\237\r.K\314\005\227e\273\366\305\337\351Vm`\250b\376\317\330\341\316\260\253M\342\200\222id\b\320\360\277\260d\322p\243\333\"\264Uh{\022\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.13.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\302\002u\022"
+	.string	"\006!sG\340\322&\035P\256\263\212\254\233\207\203\210\021\030\346.\365\265\225\351 `\360\371L\275\032\205\201\036\213\243\034+\266\2156!v\334\364\\Y\204\313\205\021\204 \316X\236\0072\235\3441\bHPo\2044B\b\331[\312\224\002]"
+	.string	"P"
+	.string	"g"
+	.string	"&~\002\365\227\313\003\354\322\334\360\354\302H,\302=\032\366\020\355\221\273"
+	.ascii	"\355\321(;\307a6\373X\207\013\261\242\335\375\364\303Q\217P\023"
+	.ascii	"\345_\347\035\253\365\362\030sHj\305\\!\002\027\215\r -\030\030"
+	.ascii	"\"\344\001\307u\236\030Z\252\314-\301\356:Y-\r\267v\333\013l"
+	.ascii	"\227\330j\022yd\303^Rk\354\303\335]+\215\375\234\277\364\327"
+	.ascii	"\017\222i/\323\244Lw\231\3462\275eZ\313t\3144\314\264j:5\375"
+	.ascii	"\001\244\231\220\b\321n\206#\037\033\024}nl\337\263\235\260\243"
+	.ascii	"@=\3072w\2730vxv"
+	.string	"\227\304$\334\243\001\370\264\037?V:TK\n5\306V#z,S\335f\200J\274\262\207\207\220\f\224\035\260Og\021}~H\024I\370\n\220\034*\251\315\362\035\313\nt8.\2148\\\004\313\025\244Z\343\221\247\206\310\350\334\200\311\036NU\001\300\346\254\331\310\257\251\037Z\271T\236\360\024\376\341v\327\304\2175\250\300\205p\321\036\257\232\222\031\275R\001\026N!\305\201\032\245\204\345A\313\211\351S9\231L'\224O\005\302\211\351CYa\371J\b\370\024!e\345k9\235V>\017\266\207\2534V\260#(\245\252\350\351\214#\326,\025\203\001\b\"\326\314S\333\364\027$\345\324\353\024*\tGU\322N7\033?\234n3@F\257\255\205\246\252\233\302\032+WT\250\232~%#5\252\0267 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.string	"\206+\255\206\240\303\272"
+	.ascii	"\311\316\256\213\300rz\035\232O\267\234E.\020\275\216{\336H\252"
+	.ascii	"\240s\255\b\n\342k\211\221\337C\202\321\306m\337\242D\357\225"
+	.ascii	"8\210\372@H9\216\347\3304\277\3116@v\251\220\r\232?\342\310\350"
+	.ascii	"\214\321\025ip\312\340\345n\223ou5Z\270\007"
+	.text
+	.section	.gnu.lto_devVariance.14.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"%\f"
+	.string	"\006\330S@ Q\224\016"
+	.string	"\021%;\330\212~\334\343\205\177c\270\021\350\362"
+	.string	":\206#\216\006"
+	.string	"h(\227Y\360l\026\333v\267UO2\322\246\013\t"
+	.string	"\025\f\020\020)K\330\023#\353*\300\346\244\221\275\245L)D"
+	.string	"="
+	.string	"A"
+	.string	"\035_\341aA\004\215\335\305,/`=\302\017\260\036U\303\267C\315\315\377\f\0160L\235\350p\322m\\a\005ub#@G\202\bV\031\\\034\304\363\324q\231\222\006\273\3534u\030\356x\333\016l_\354K\b\336/\321t\3244\314\264j:3}"
+	.string	"\223\221\225\002\026\273\027\276\221U\021Kx\260\275\331\024\333O\373 \377\260\335\013]\300n\352\203\304\256\267\300\t\256G{\227m\337\343\037\233\255\202\336\206\2371j\311(\2418\177>\302\252\324\003\317\016&\324J\225\303\227_\365EH\nR\326\260=\341!,r\355.\003?\244S\341\352x\364C\326\343\225@\013\220Q~\266'J\345\260\017WS\266\246\257\007\0246\017\324\032\314\007\002(\223a\034-\3134\r\306\211\220\3110\215\347\203a*\326:\033\017\006\3224\017F\361\366\232r\246U\266\323@\324\223\355\250\226\221r\020BM\275T\202\242d\202\313\317\252P\243H)\306(\003\023"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026s!'\250\031\354\310\330\203v#)\2011\357"
+	.ascii	"\324h\025\024"
+	.text
+	.section	.gnu.lto_devStandardDeviation.15.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"\306[`D\020\217(\035"
+	.string	"\373\004\016\035\037\243\365\032\204\362\"\033\336\320px\026`\337v\342\244 ?\302\226\373\336\2745\204c*\202\226w\002c\253&"
+	.string	""
+	.string	"P\021\002\005L\324\323\344*#\r0/\255%\204\354-eJ\001N"
+	.string	"H"
+	.string	"O"
+	.string	">\207w\360\354\025\3744\244\376\"b\302\007\027\273\273i|\300\365\b/\340z\324\f\367\0165=\377)\207'\251\026\222I\344Pc\"\271\302\214\023\n\022"
+	.ascii	"&\021\334ha"
+	.string	"\200\271\352Y2\2052\261\004\273\353$\231F\356x\333\nlo\354\233\004(\033\24630\235\3014\246\351\013\246#LCM\353\277?5\332\205\326f\265[!&\306\272D\023&\376\312U W\261\252\274\234\354\256\006bk\367l-\355\243\334\203\367/\344\001vQ$J\354~\007l {\364\227\331\016\212\245\030\235\270\024\323\3102b\301\271\352\245W\213\321)\2241\017>\302\253\250\005T\344\006\322\251\245Z\342\315Uu\305\nK\2240|\225?\017a\226lw\021\370 $@\360S\217~\210^\365\215\021\326\013\024P\306\330_(\265\304>\334\335\265\006\021:\026\250;\234\017\203\017\016n\363\3508\256\353l\036\r8\270\255\343\371l\234\fw\016:<\333G\327y6\315\266?\320\025\345\324L\203ia\245W\266\223@FK\266\241j\2004dMf\324\346\272\353$\250O\371)\224,\270\210T\004b\0325\013\025"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\201\313\230\246\342\005\025\324k\274\222"
+	.ascii	"\211\034T\341\340n$\325 MI5.\005\005"
+	.text
+	.section	.gnu.lto_degreesToRadians.16.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\205\b"
+	.string	"\306\220<8@\345&\035\340+\200\316\367. .#\211\206\220\024D\310\023CG\330\357\242\024\337\266\3017o)A\250\324\323>\\\206\321\037~g\0313Wsg\351{l\333D\312\224\002+"
+	.string	"+"
+	.string	"*"
+	.string	"(\025&3\273\0139'\320\374Y\037\320\374)\307\271'\347\277\344\326\212*\236P\243\347\246aw\235'T\306\255\267}`{\3016K\213\021\001l\313S\361\260\315\331\227\355L\373#'\341\336M\370\355\246NRvW\301\b\001\177\002i\333\017\271\bg\257\254\256C\365\227f\2101\206b\227dpU\275\t\244\224\321\251\327\233`H\031\355n\224\272a\337Z\325\2605\255\357\376\324\364\337\365\341\222 \263\001!\f\333\0360\207\215?\235\020\204\310\223A\220\226e\332\007\202\"<\031\374l!\330)\260&\201mP\244i\033\274\272\275\255\312!i\311^\375\"\200Ej\003\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.17.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\357\001\035\020"
+	.string	"f\336iF\360\260(\035\372\275\304M\204%|\315\202\205\340\373i\326\016\370\236\211\223J\346\237\232\004\375y\350\301\275$\206D\034\265#H\024\272m\016,XHyf\235\004\347%\357\355\035E\352\320_\025\024\375\237\020B\266\224)\005V"
+	.string	"T"
+	.string	"R"
+	.ascii	"\241m\351@\341\300\214\f\00226\003B\230\222\347c<\263g\227C\b"
+	.ascii	"\025\273kb\001\3355\333>\314K\250\354Y\fA\264\376"
+	.string	"\322\202\005\253\261\273\036\311E\266k\361\243\355\232~\270\352\251\362_\363h\343\312qi\251<9\003\273\353ti]\270\365\266\003\330^`\247\204\232\376h\332\223\351.\323\\\246\267Lk\231\216\231\326Lg\246/r\f6Lh0a\261[a\347\306\302\320V\210x\354\227=m\225\237\3425\006\311|\0237Ch[`.^\nN\034\205\3521\337|W\026<,\330\r\215\335-\271\346\004a\367\321F\343Y\f\256\030\233\252\206\364:\253\021\232F\335t\004\007D5\035\321\371\320\250\\\352U5\316X\275Xr\307\036\232\032qt\350\225\201\353\005+\307J\356\330\241J\352\213\375\270\273k\365\340\321c\267\3502\177\310ew\350\341\017\362\230\377\3433\277\307i\376\016M\203\002\2457\370G\332R(\024\007\335G2\201(\355\364\201\bL \212\233p\233NP\017R\245\223\227\362\235N\237\311K\201P:y&\020\345\235"
+	.ascii	"\360\027\001\005\364R\337\007z\240po\217\224dEY\f\322\321G=\n"
+	.ascii	"\322\2576|\364\235z4qD\032\322N\013\270rV$8\025\275B\224SR* "
+	.ascii	"\340\2421\013\036\024\202\025P\006\374\260,\201\256\2114\330"
+	.ascii	"p\337\200\3551\331q\f\341\rfaP\034x\322Q\276\241\365\231\001"
+	.ascii	"\037\213w\352\232\224\021\213\006\336d\363\n-\224\244\207\342"
+	.ascii	"K\004-\264\031\300\346\fG\262N\300\256d\234\304\016\311:\021"
+	.ascii	"o\220\305\0010\217\251=d"
+	.text
+	.section	.gnu.lto_scaleRangef.18.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`b\001M\r"
+	.string	"\366\330XB\020q\233\016+\204H\b\253\273\345\003\224\210\020\317k\024b\003^\272z\rQ\007 \034\030\276\242A\361\365\275\221\372\022\265_\0374\325w\250{\357\202\020\245\212\311\301\344h\324\005\361\270~\353F\233\310\235RD"
+	.string	"M"
+	.string	"?"
+	.string	"\230]\226\023-v\327\200\013T\227\266}\024O\321\331\241\004\212\030\361\021\r\r)7v\027\333<\300t)\035\300t\251!\336=v\376W.\261|-\"$\236GJ\301\356:\212\220t\270\365\266\t\330~`\177F\217\216\217~\307=\230P\361]+v7\274\340X\031\322\005\211\207~\321\243\335\371,\276bK\344p\203A\263#\031\\@\016B\016+\017\007\001\336\250\206\215\335\365\270t\003\025\207\222fG>%\013Pr 8q9"
+	.string	"\212<\036o\342\320\00100\232\321\353\205\007\212z\255\3641\274\022\224N\032U\246H\225\364\n\341\013=\320'\276\330\240'*\b\373\322\356\256\365\203\255\207\356\314O~\314Ewu\360\247n\362OG\371\345U~\351\321\032\234G\370\374\230:\034\210\204j~d\033'\265\2711\3106\216\262pg\0277\241\303\321\260\220\251i3\303B(p4,\3338\354\032\340Y\001d\303:sn\230\005\356mK7\027\364c\251\252\226\306\221W\222\321JU\023|-^   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.19.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\342\013\0050"
+	.string	":T\324\021C`\236J:\267\360\304\004\267\201x\023\264\326\021\0179\271g2P:\020\203\245Et\264\374\326['\361\302\367\363\320\210V\206\273$\231\274\202\311\326=\307^w\335\314\234\205\264]\243\373\265\332\032\331\204H\231d\024\001\350"
+	.string	"\013\001q\364\366]\304\002\225q\313k\331oY\"\0261\nM\326\250x\226\365\021\242d\303{^\212[Y\245\036k\224qi\232\246\330%\376\334U\261\307\262D\025\277\302\302L\357R\263\210^\230\270:\034\204?\353\353.\345S^e\211T~\\\270KR\301n\227\004\206i\352\345\t\036\226\360P\036E\354t\273\024\306@+\342\321f'0M\323\247\237[%\374I\300\3449\027FA)Y\2243\343y\367qw\"v9\030\027JS#K\2744\235\213\332&\341\317\235;Q\375)<\200\372s\305v\333|\316-}]\233\262\272:i\232\032\373\310\305^\374\361!\366\f\205h=\315f\261\375\253|h\226\026\343E\345\177\200"
+	.string	"*\331\207\355\304\037d\330\270g\355\303\217A\363\341\267\306\302\002Dp\250\035-\343{\201745\256<~\312\350\222dS\307\333tR\362\351(\246!M\"1E\326|\313\371,\215\214\031\275J\323t\331,\r\307\027\350\273\233gw?\354\022W\004\335P\004\355\310\215\361\340\356\034\222\273m\367f\332Fv+oV\345\305By\257P^\t\327\362\215Py\255*/\204\312\373"
+	.ascii	"\345u\200\3626\270\336\267\252\362RU^\006(\357\002\224W\301\367"
+	.ascii	"\276\t*\357T\345EPy\017\240\274F\224W\352}\337\250\312\013Uy"
+	.ascii	"\237P^'\224\267\351\177_\003\225\227\351s\277\200\323}\225n\367"
+	.ascii	"M\372\335\027\351T\276G7\3635By\003\240\274E\225\227\250\362"
+	.ascii	"\016]\356\007Py\205*oP\345\005\252\274\305\312\373Sy}*/\261\362"
+	.ascii	"\366T\336a\345\025V^\264\362\326\312{V^\263\362v\345\345\312"
+	.ascii	"\373\t\275E\255\315M\003\316\2457\006\361\244a\316,J\256\345"
+	.ascii	"\327\373\367\376\276\377\3577\363\323\375v\377\335O\345=\273"
+	.ascii	"7\263\007d\023\362\267'3F\f\236\276\275_\235\275=\037\230/\001"
+	.ascii	"D}\300\037\342\323Z\317\003\017U\024\240\213\214:@\267Q\037\320"
+	.ascii	"\207\251\367\177O}2\304\341\323\232\360\201G\340\324\324N\006"
+	.ascii	"\272\211\251\r\364\311t3\365\305x\270\235:\215G\351D\256\207"
+	.ascii	"{\337w\240\3577D\237\326\352\003Oe\224jcTKqG\365\375\204S\275"
+	.ascii	"\337c\320\347C\317\2475\363\201\207\260@A/H\320\n\246:A\237\357"
+	.ascii	"k\316=\325\377\242\3658p\270_\345\314\326#\216\322\211\\}\357"
+	.ascii	"\365\036\\\221\235fc=\255\361.\227\262\372l\333\334\301\331\274"
+	.ascii	"A;\250\352\006\357\252~\027\263\310V\275\327\"bD\275\031V\233"
+	.ascii	"\035\203\363\344\210\031\322\335\266sGQ\257\032D\224>2\276\263"
+	.ascii	"\004\216\242J\350\253~2BK\350\323\316MY\036\253\216\320\337\362"
+	.ascii	"%=\300d\337\330\362S\312\346\204I\227\311\322tl\351m\325\317"
+	.ascii	"\273\020\035\362\317N\211\\\256\253\331e\321m\267\304\323t\t"
+	.ascii	"\3234e\200&\303q\200\033\222\237{\030\365\347\003a^\\+L\260\343"
+	.ascii	"\026\330qK\270\302\213\013\254\205\027\027\230\320\353\310\025"
+	.ascii	"\246\025v\374\022j\205\231\020\021\342\334-)0\022aZ]F\257cW\327"
+	.ascii	"q\313\350\305\245\325"
+	.string	"e\334\372\0023J!\355\361\204\210/c\330\361\370e$\216\335\3749\337\330\224-}\036\370\241>\263\220\027f\254\221+\324C\204\004\311j\252\026\352\027p\203A\r\204\355GR\003u\220\022\251\201\350\024}\250\365\370i\245.\266Y&\271\344\250\177\372xpn|v\350\310Al\237nAb\177\301\001&{:\r\355\306\260\217\272g\211R\017\375\222o\302\266Q\343\f\251\321\026\266\311%\251Lj\264\037\007\327\005A'\231\306\214\262/\227\372\363\204c\305\216Z\215b2F\362\330P\237]\273\005\223o\310\263\277\340\244$\315\346t\227Dgv\027\352\203\030\206\334\3224\255\322\360<\033\004)t(\236qQ\177\262\240\331\033\252\206j\263_0\031\034j\245\256R\003\241\241:\251\253\376\206\032\251\253\366\222oY\r\325GK\177uH@\2737d\261{o&\200\334\250Q@$\225R\246FD\244\240 I!\215\001"
+	.ascii	"\003\021\231\352\034\022 c\211\024\006\225\202\330TFAy\030\246"
+	.ascii	"\003\200 \326\t0\020\302q;\2453<\345P-\345\276&L\376j\223\353"
+	.ascii	"\032\027D\260\340\2432\226^\036\027\343$-~\\"
+	.string	"\204\327J\210\231\230%C\bO\240\251P_#d\316$\351&F\t<f \t\205\365\211\221\346D\303[\365\003\215\275\006W\243\315_<\2107\220\240\326\251a\017\024v\370\330 \362w\240\020`j\201\211b\321^\034\0328:\220\013(\266\024\322\264oX\302\353\032'\305+w\223\250\244\204e\251\002\237\234\234=;\336\214\365\022\346\3149\260\257\t\221YR\365\306\236\323\261\251\231~i\211\354\025|\333\n\340\3444\032NH\362\321OB\230\340\333V\023'\263\243\207\243\tH>j=\202X\0315'\313\224\232\0026\216\222@+\025\326]\210X%e\307\242q\017=q\370\206o\332mb4\353S\207\354\013y\217\365\203\274|\252!\367-\r\2138\r\273\2200\206\222$\342\254\220w\345\363\237\026\201\376\264\353\317\247\025%\202\234\037\335\3179\020k\300\026\"-^g\366\n\021[\341\032\361}\005\003\t\262\007~"
+	.ascii	"\022\035\0259\017\327\242\016&\314\3467HwT\032\342<\312Y=\306"
+	.ascii	"z\fd\003j)\220P\335\242Jm\246\263k\023iS\272\232\247\212;2\356"
+	.ascii	"\252\352\fF\246\210\353\037"
+	.text
+	.section	.gnu.lto_applyMatrixRotation.20.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\251\005m\032"
+	.string	"\206\355\236H\260XUc\302v\205\302\031\366B\001\006\261\334\265\236\223u\300!\307\203\307\020v\b\226\2375\206\335T\363T\250b\"\342\355Su\353O\007\254\017\301w\250)\034\371\243\312\250\231\346\315\016\353\272\016,;\332\226\333_\312\224\002\203"
+	.string	"x"
+	.string	"\222"
+	.string	"?\016dw#\237\236\2610]\320HqyW\307\021\310\2133\324_c\210\373\360\351\006\027}\036\357\261;\321\b\222\227\202BQ\215*\367^\235\213~"
+	.string	"\\U\373*\333\324$1\3249\265\237\343:v\037r\220\273\356\025\002\362\273\327T`\004\344E\233\207\215\027\311\277\306\213\336\331Sn\366\356\213f\234 \332r\357\245\325\030\337\235\356\374\357x*H\005\357\324J\270\367\232\006\251Xq\327\333&`\033\203=\036\b\266\311\243\025\206}\324\255B\366\177\177\316}?\201\033\375\003\376\273q\356\273g7\177"
+	.ascii	"7\272e\037\372c\226\332\306R\327Xj\032K\r\263\3243\226\372e\251"
+	.ascii	"e,\265\313R\307Xj\030K\335\262\324,K\275\262\324*K\375b\251S"
+	.ascii	"\226\232\264\324\326R\217\226Z\264\324(K]-5\265\324/\320\312"
+	.ascii	"\242\344A\222{Q<u\271@\021\311\306\371\263\220;\362M A\274\310"
+	.ascii	"~$\353MAWl\025+YeB\234:V[o\234\202>/\374\2227\341\271\224\036"
+	.ascii	"\023'\364V\032/\216\365B&T\035\225L\264\230\325ZQ5\026\004\372"
+	.ascii	"\374QO\301\223\360\334\307\022\222\023\365j\375\221\fY}\245U"
+	.ascii	"\364\231\270\001D\237|\304\247\201%\333\tn\204\247@\357\336\353"
+	.ascii	"\300\366\"\037H\"\023n\002H\214\027_\r0!\r\361\t!\t\007\304\225"
+	.ascii	"|2x1K\362\251\3022\244\201\217TaD\200%\032\027\375r\274(\253"
+	.ascii	"\"\023!\303\241\022\364)\034r|n\031~\306\r\032rF\237[\206\037"
+	.ascii	"\224\b\033NW\263\320S\332t5]\211k\375\334;\013r\036t\265\033"
+	.ascii	"\255\247\274\335\312\035Z\217\255v\243\355\340r\264\0052\227"
+	.ascii	">\035p4]Y\342h*\363\276\n\371B\023\260D\005\262M\265s\024\250"
+	.ascii	"\246\302\252\rM\255\2517N\224G\357\023\315L\225\251\260W\235"
+	.ascii	"\251\261\240S\027./W\225\031n\321\342\032\306\324&\230\312\252"
+	.ascii	"1\255\nSo\234\260\\\261\322Z\325\227\312R\325U\215\005\251L\021"
+	.ascii	"\252R\365%\n\024\246TM%\035\301A\326'>\003h\250Q`e\024TRJ\222"
+	.ascii	"2\222\2441\300\002\221\031#;\021\360\244\"J!h\b\225Q\220\273"
+	.ascii	"\001\242$\016Bg\315?\021\030\002\004\326\364\351\324\214tpH\005"
+	.ascii	"\3273\354\205\226<\221{\200\207\305\322,tGl\335! \345\352z;\233"
+	.ascii	"%x\313\347\016\342pBE\255\275\303Kn\300\345\027\006~Y\250\021"
+	.ascii	"\n\325C`R2/\177})\206B\230uA\237\007ge\310;\tIo~\222\025[;z\245"
+	.ascii	"\323u\324PMu\203\235\020b\016\326\262[\0070\bs\371\373\205\245"
+	.ascii	"\026\346\007\326\255\364\036\203\221Y\312/\373~\222cfr\304;\307"
+	.ascii	"\007\344<\3178$\212\250!\371@\tM9!%\254`,\273\006\033\260-GP"
+	.ascii	"\200\374\241\233.\212E\005"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.21.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\312\003\275\027"
+	.string	"\306)\217I\3200'\035[ \323M\376\t.\326u\257\315<g\251\323\241x \346\360\036\022J;\0318\356\263\334\220\374\341\330\266\204\365X\275\227\\|\241\036F\251\227\247\314\364@\304\344\263>0R\314\226q\353Aj\215\020\262\267\224I\006{"
+	.string	"t"
+	.string	"z"
+	.string	"\237:\206\377p\0205\265\311\361B\356\033B\201\263\333\321\3352\330]\337\247|\310\367\311C\312\227\343U\256\355b\213\025\202\337\224\2746=\210\"= \275\300\345n\027\201\336\002\372Y\026I\320\216\317C)\035\037\022#\235\236\005+\374\2230\034\t\333\335\354\224\003\272;@n\202L\2609\271\232\225\033x\316g\272d\201\304\303\345x\276 Jw\353\342r;\327\217\253\252\224\252\236\250r\206\267}\263\220\252\310\307\377\245\253\256\363\256\342\\m\315U\326\\\r\347*8W\277\271:\347\252\334U\226\253+W?\"\340\b\006\003\035\335\024z=:j:i8\357_\372G\350\231T\324\363l\341M'\344\311\200\212\205\237R\265\246\337\251\250IW\252}I&\274\3518\030JA\325\335%\237Z\022\365\261\253\372\020\027Q\3738s\220n\241&\025\335cL\021\204\001:\375x2\004%\0276k\025\373\270"
+	.string	"\221\311w\266\220\277\273\201\0256:8\321lo\262NYE,\302 nK.r\316\253\224h\330\254\325ew\267d\335m\237\310\",\237n,\260\252\256|g;0\325\335\013\346\023\016\207\276I\202-\304\240\237\341\347\374\320lO\227_\314\374\033\016\362\332\342;/\377\306\250f{*\362\371L\237GH<\234+\232\3551w\367\215Y\247:\006,wy\204\253\312\t\314JL\312L\326B\233\315h*\262\026\226\224\231L\345\005Fv2\2424\227\007/\262\030\032\355E&\216\3757\013\271\030F\3035*#\273\203\032|\351\247J\212\271x\250\310\342\033&\036R\005\266X\247-f\361\253\250\305{e\302\"P\365\261\302=Q\342K\224C\206\254\323\220A\006`\005\265\327\247\3573\344\327"
+	.string	"\371\273\203\304\230\301\340\344\363\232\210z>V0u\022\177\351\330\335\037\007[\250qP\247\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\330D|[a\270PB\351\345\3434\312\213\352\226\364\211\222t\020\263\237j\001\267\370\022\205\275"
+	.string	"u\t\323\330\363\342\373\255\026`v\370\213|+=8\bY=\314\353\200#\033\206\334~\b\203@\327\246\311\200\241\213v\240\250\234u\363\254C\360z"
+	.ascii	"\210%\360\241\034\340\005}\232\020,g\316\t\312\220\037\300\f"
+	.ascii	"\214\237\220\361&\244~\001+\f\004\224\203/Z\251\247\201\333g"
+	.ascii	"\370\200C\204\354\024\274\004\303\302L\031\333@\325\327x\360"
+	.ascii	"\002I\300JXc<\323m\311H3\004 3\331T\r"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.22.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\252\006\r\037"
+	.string	"\366\363\261H\260XQ:\360\270\357\021S}\2325\034L9M\022z\235\247=\245\356h\351\003\315\325V\fX\036\313\231L\214\253\215=\270B \275\346tG\375A\373b\2307\034S\177\005X&\316\207t\355\333\377\366\177B\310&R\246\024\243"
+	.string	"\215"
+	.string	"\234"
+	.string	"\322\274\3618\0164\343\033\310s\221\013{\222pzT\346\2345\226\007\b/\301\307\302\313\355\261<\310\273A\275=\006{\271Z\254\225*\205:\215b(\301\325\233/6"
+	.ascii	"o\004M\301\345h\036{q\330\013\037}\355\356\332\271\320\326\212"
+	.ascii	"\263V\250\320U\212\253R\240\320\324\211\243N\230\320S\201\026"
+	.ascii	"!J|T\242S\242\300\217\316\216\212$\036\262r8 K\357F%\210\362"
+	.ascii	"\0019b\345<\200\b|~d\274\350\232\223\263QP\306\210\357\213\016"
+	.ascii	"\016\t:\302\345F\\\305\006sN+.\027\342\006p\373\031l\323l\331"
+	.ascii	"\024\272<>\030N\250xyl\331y\277\213\325-'\272cR\r\223\352\227"
+	.ascii	"T\273\244\272%\325,\251^I\265J\252SR\215\222\352\223T\217R-J"
+	.ascii	"u(\325R\252AU/\250VP\375\227VR\222\005\2779A\374\254L$\022)\306"
+	.ascii	"\211\376\241\177\207_\344\224Ot\033itF\"%&\263\361r\264g\374"
+	.ascii	"\236S\326q\241\231\017m\030it\034\364,A\231s\312.-\033/\317\002"
+	.ascii	"\200\252\375\240\347\2309\217\303_s\362\030\005\231\2237\263"
+	.ascii	"\313\370\227\343\336\tM\334\367\376Z\302d\305\325\355\211\214"
+	.ascii	"v;\341&X:\217\0178@\204\006P\270:\207+\227\202PR\007m\232\205"
+	.ascii	"+`\367\362\336m\334\367n@\210\224*H5\372\223\253\363\311ge+\342"
+	.ascii	"T\366\330\346\3103\t5\351\240M\007\347\234\023\\\335oale\013"
+	.ascii	"\372nT\254\355\007\357\335Z\226\346\234\n\244\017\027\305G\322"
+	.ascii	"p\033a\370\034\3669&j\364g]\227\335\375\315\f\360.\022~u\177"
+	.ascii	"\363c\243?\307\366\373\242\313\032AG8Wj\364\267\353#D\304\207"
+	.ascii	"]\235\315\243\t\023n\341\031n\030\332\005\t\030 \304\324*\330"
+	.ascii	"bbl0\265\n\023 \304\324`d.\324h\004l\263\020A\246\206\301f\223"
+	.ascii	"\251\245x\363\313\323\262,5k\343\r\340\234-\030|"
+	.string	"\350\207\242C\177n\231b#\366\332\243\277\214v;0\330\276\224`\257*~\255.\311\350\n\344\303Eq\271\266\345j\265VJ\254\031\020\026kWJ\312\232\255v\265\272\331\017\325\352\254\332\324RP\315RL6\234:\355\023\037\2171\211(\324\236v\200\017\r\265z\345\345\004c\nO\342\036Y\322%\273\235q\365G\217\353N\n8\256\316\343\212\273j2\002\336\2760\200\233\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022`\204=\007\305\350HJZh\375\357\"D\207.X\371][\035\013\222\263c8\037l9\367\001\211\257\374\244\341\252GB\b\226\207\032\372\026\032\360@\202KH\032E\310\025\033IVj7\031\333g\225\242\237\226~\006\201[\354\336\306\031u\325\346w\241\bv\264\201XM\r\333q\355\206F\240\266\246\236}\t0\223\235\262\374\370\032 \264\365\022o+\023\032\223-t-u"
+	.string	"9\360\3429\273\005\3567\027\340o\310y\301\327\002G\251S\230\303N\325\322L\265\354Z\177\277\220\220\223i\b\270\243\234\326-~\344:U\252\003\"\227\f\214\t\274{\0359\005\323\264\320\364\242\363\225F\031\361\0071y1\202&jCV\2036B+\300\311\034\224\374\202\372\265\n\315|c)\352`\252Vh\310\301\256bS"
+	.string	"\372\341\242"
+	.ascii	"\271~\227d\334`\303P3\236\3604\316y\013\246X\024\334f\202X\231"
+	.ascii	"%\340:\2234\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.23.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\027\013\205("
+	.string	"\212@\264\rJ\240\226U:\204q\373\352>\307\343\200A4\213.\230hy\351\375T\230\301<\261\0011VZ\340Z\252\371$\221\367v\232\344\027\315!\254\302\353\260\026\274.4\021\306\023\330\254'|O\005W\264m\333\266m\333\266\222F6\2212\311\320"
+	.string	"\262"
+	.string	"\303"
+	.string	"\346\351\026\315#=\351f\211d\321\004P94\305c\224Rk\035\266\034W\236\222\267\225\247=\264\253\223\305/\311\304\003YV~\276\036o\247\313\341n\266\032m&\213\301^\256\026\313\\\225\224l&\356W/\344\013'\"=@8\007*\235E)\006\257\300\370\017F\022\373\220\336Cz\301\274\243\357\216\\\260\316\3509#\025\214K\361[\n\024l;\361\332\211\"\246\021}Fd\202e$\036#1\202a\"\376\022\021\202] \336\002\361\201Y"
+	.string	"Jl\360p\363\310\217\007"
+	.string	",~\202x\325\341%\331\302C\266\030w\230\222f\2555\006\204\2014\300>@:L\256\340\360\276\323\311\037J\307\036 \016\347\325K\255u\271\007h\303\267\345\273\254`w\205\273\254\f\0018\335\347n\021\207[\250\330B\2731/\376\b\226\027\346M_ \345e\241\274+\224\367Gy}\224\267Gyy\224wGyu\2247Gyq\224\367Fym\224\267Fyi\224wFye\2247Fya\224\367Ey]\224\267EyY\224\327\244\274+\312[R^JyI\346m\222\227I\336'\250\005\0319"
+	.ascii	"\244V\rUTj\021\332\303\350M?\323?c\357\264\256}\023\321\304\371"
+	.ascii	"1\233\216T\202\346il\367fo\\\327\312\370\322\315\231*\2308?1"
+	.ascii	"CS\236\324Z]N\327\305<}\221\037\363\356c\\\351\346E\013\247\325"
+	.ascii	"*\224cG\255\305\340\016\bNZ\252\325\re\343\234\364\264j\365\271"
+	.ascii	"\255f\265\256\350X\266\232\253\004Y5\251\222\325\247p\b#1\371"
+	.ascii	"F\2153Q\024\322\354s\315^5\214Jh\366\233\254\372\306\323\220"
+	.ascii	"(\351\025\3557\345 \n*\273\300i\\W\366\271e\323\236Y\202\272"
+	.ascii	"\300T\013\365}*O\313\316\021\021\270\221h\366\215\017\340\243"
+	.ascii	"\352\250G\016W\321>\227U\3241\275\352a\227\003\333\347RKK.0\325"
+	.ascii	"\311Zk%\373<\261\004vL\223O;#zw_n$\nHRk5@\237z\240\354\203P "
+	.ascii	"\232(\366\026\372>\037r\270j\271\021t\367wZ\220_!\345\233\373"
+	.ascii	";,t\270j\201\375\276\323\251\013\245#O\225\034\256\352.\326\032"
+	.ascii	"\016\016\341\023\2762\302\b\r$,\240\031>\250\241\241\251\221"
+	.ascii	"\031>p\260\200f(c\023a(\354m\r\004\0066C\t556CW\261~\213-\004"
+	.ascii	"\323-9\255\263\025\310ZK\0348\323\377D\006\314\324\002\373|\272"
+	.ascii	"\356\351,}.K\257\364\fK\347V\214G\273\342\373q\233\324\352\367"
+	.ascii	"k_\353\212~\276\322\307\353^\320\007\331\353s{\315k\030U/\310"
+	.ascii	"k^\237Q=v\273\326A\355\242tS\253\353\223G.\327\270c\016\207\263"
+	.ascii	"\tw\334nm\273\365\233\330l\264c\255u\\\367Z\237[kZ\317\034kL"
+	.ascii	"h?\230\216h2\250\2310\307\254\317\235\265\254uE3\241\254\224"
+	.ascii	"\301\202Cp\274\206\204((\026kX0\006\203\271\242^}\343\365jW\024"
+	.ascii	"\371b\302\256\251u\261:\201\002\250\221\\E\221P \"\222\024\244"
+	.ascii	"$i\r1\006\204 tf\035\022\300\203)\210\305J*\221$\226\373\377"
+	.ascii	"\031\302\320\265[\235\375\321\305\233\313do\335\23205 \037\211"
+	.ascii	"yP\274\002\004I<\313\027\227x\324WI\363+\335I\020\005\336\271"
+	.ascii	"\275\276\353\320|\t\350"
+	.string	"\023~p\374%\365?\227\260\027\324\321z\374I\021k\234@m\274Hy\271\316\256\235\331!\236\216\273W\371sl\340N\340\205\245\332;\n\341\316\361(\246\230\265\3110O+q\022\200D4\234\276\225\372r\256I\022\326u\024\023\371Vf\225#\317\303\3636|\242\324\263\317e\343E\245'\3078F\240#\303\354\226\325\236\214\n'\006D\f55t\353\032V\311P1N\024\263d\264\371y\215I\254F\234\302r\336%\314\215\322M\372\256ovQ\264\365:\n}g\006\031f\363Y\322\231q\2269b\211foVX\253.\341\006\365Z'$\371\301cL\234Rc\311[=\372\\2'\362}^\244\022Wv\246\332\351b\177\203\023\200\001lj\322a\313\177\343\305lV\013\202\353kZ\251\316\2766^\001T3\300\230\317\307S\340\372\226@\213\233O\360\2372\314\017\"\313AY\3641N?\235`%\362\037\231\302"
+	.string	"F\230\203\210_\030tm\325\017\337\245\206p\354Tsc#\255\210WU#\225?\264N\020s"
+	.ascii	"-\346Qk\202\220\006\3213\207R\246\2109\200\026\363\250%\223\031"
+	.ascii	"\304\236\203`\250K\257\304*q\307RDo\026\300XnJ0\177"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.24.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\210\017\3052"
+	.string	"zO\020\021J\240X\231\0162\224'\246[\260\3059\240\t\013&*k\307G@\332c\017\331\177g\362\352\241\365O\207\025>\276Oc\362\315U\331\033G\013x\035^\007\035~x\343\r^\206\361]\300\263\343\243q\364\364\364\364\244\355\275\345N2\245\013\001\346"
+	.string	"\367"
+	.ascii	"\254\347N\262~\303q\344\2641M\2568\252H\016\032\224V\\\327-\362"
+	.ascii	"\234\246zN"
+	.string	"]\246z~\025\215\3624\351\235b\243\023a\206/\302 \360\347s\351\361v-\272\034\356fcik\264\231,\006{\271Z\254\225*\205bW5\247\217\215\355\253\201\324\006\220#=G\035'*9\214\222\022<L\342/I\220`!\222\007\221\2160\320\310\177FK\354\013\342.A\200\340^\221\363\212\210\360n\207\267\354\320\201u9<\227\003\007\306\335\360\333\r\033\330&\344,B5p\013\303k0^`\232\013\237\271h\201e,<\306\"\b\303\220\376B\256\300.\023\3362Q\002\263H\370\212\304\b\254\022\341)\021!0\252\207\302\003\220\263O|\200z2|~\360\n\302\325\326QC\312S\362\340\234\2523\200\214Z\307\f)\201%\224\031N\344x\303\361\002Nc|\360w\"O\223\212\220z\216\037\034\257\006\\\327m\334s\364\340\035\343\335\017\240\273g\272Y\271\032\256\354\340\247\377%\224\031@\377owR\007\007"
+	.ascii	"Z:\373St\327x\322\235\246q'\360!ob\306\r\223q\0173\356\227\214"
+	.ascii	"[\230q\0073n`\306\375\313\270}\031\267K\306\335\313\270y\031"
+	.ascii	"\367.\343n\311\270u\031w.\343\306e\334\267\214\333\226q\263d"
+	.ascii	"\334m\306]\313\270i\031\367,\343\226e\334\261\214\033\226q\277"
+	.ascii	"2nW\306\335\312\270Y\031\367*\343Ve\334\251\214\033\225q\263"
+	.ascii	"\031\367\232q\253\031w\316\270S\214\373S\3348\305\355\nbF\234"
+	.ascii	" xr\335\016ONn\223L\004\206\017\271\373p\377\321N\324\252\366"
+	.ascii	"!#\253\343\303\016E\001\222a=\317\272s\332\225\255j\036\336#"
+	.ascii	"\307}T`u|\016 \177\242\256\353\022=7\221\365\214O\3740\356v\035"
+	.ascii	"\276#\307\223\026\034\346\272)\216\204\270nR\246\207\001G\353"
+	.ascii	"\353\365\256o\203\240/'\325\345b9[o\324j=\313\331\232a=K\365"
+	.string	"\253\230\245\267L_\375\333\253W\275\215\314*Fu$\324\252\177\243S~)\365\317$\210c\034\3145\225z\324\267AQ6\365\370\ntE\305\226T\324\372\\\342l\"\177\330\307K \216\221UR\366\337f\177}V\323\323\233\371.\305\231\256\357J\2075\243\374\232\337\207\216\220?\352\013pz\221\267\266%\024\032\352\277\255~~\233\036L0\340\246nbo\246\352Y\375\032R\306\225F\366]\351\276$#&\";\370)\377\333\250\240\257\371\265\007\023\235\370\033|\251\307\023\003n\362\324u]7\375\327\215*\361k>e\362\224\370\3566\256p\245Q\350t]w@f\366PigB\301\310\266h\267\360\276!\304\016~j\3744\377\357<4Ro%\325\037\277\363\310\270\200\237\232\370\376N\344\271F\021R\r\374\201O\360\256\231\211\300@\002\315M\321\001\316\315\rNM\321A\003\232\233b\r\204\b\305\231[\343<X"
+	.string	"\241(\001\007\007BQ\225t\375S$x\336\316_\350\n\251\353\242(\340>\334\243<\0220\205\232\370\257\222\267L\207\371\267a~\3706M\230\257\r\223\230\206B\247\022\227-!\177^^^\370m\220\363\345\361\025'\241\020\330\f&I\203\377v\360\201\317jj\006\337\245"
+	.string	"\037\370/\222\337\277\375{\337\333@\177_\363%\t\265\357\337\346\021\027\227\357=]\232=\265\267[b\304c\315\224\367o\363~\367\254&\336\273\224\335N\367\314\226\226\3279\265\314\350\230t8h\316\231\224\313=\016\232s\342T\334\277\317\"\267\333\333\2427\233\255}\"\016;B\376\260\374\333,\337\276\315\fKL\213$\324\322\2425\350\220\265V{\332\267A\321\332\343+P\032M\366\234\275\220\331\354e\317\231S&\203\305\220b\261\207\305d`L0\027\364\345\024\201d\250\201`e\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262I\016N\031&&\222\032K\373\177\007a\034\266\370\226BJ\326\353\370\200\210\272W\315\366"
+	.string	"\2368S\270+\304\0332*\022\021\303\316&\361~\317w\305\247\264\322\346\001\251\242\201yUhM=\200\274\350\216\246d~,\315]7\300\303w~\033\243\261\230\247pm\271\263f\340\333\207\254\213\2735\230\313o\202\357\215\314\354\211\337\367\026^+\240 l<\n\376\253\313\310K4P=\203)\373&"
+	.string	"t\254%\373@\254\241KM\246@_\341\006\n\260.U\342\332\222\224G9\233\212\337\311\273\277w\314\372\2330v\352\326\256Yx\333\302\363\260\317`\366\210i{[J\020\313\257\373\002E1\206\332b\311'\224l\351k3\337\353\220{\307\276\313\370\231\032\200)Z\360\207\022nZ\321Atz.\346\355\264M\310[\251\264\337\254rE\277\002\206X\354\275\230i?\332wL?\313\032c\201\324\360\223\372\3568H\212/o\313;\221>\207y\340]\215eeo\bh\200\312\221\3012\312\314\006\303T\220\221\304\226\331\304?\324\310|\320\274\343%\224Mp%\212\025\206\353\312\216e\323&,kt\356\272(\006\021\273e\007E\203"
+	.string	"\003\001\023L^\237\220\310<\321\327\311\247-\351\016$\027\rX\326\226\360\bH\037\230\252\207\325\226\232\214\325>\375\026\023"
+	.string	"\302\310%bC\370\007\352\021\013\317\267\\\255}\335\321\214},\360\211\004\321\021\nR*@\372v\001_\024}\030\312)\343\372\003\003\224\025\3137cV\367\3114@x-bD\003\336\271\036\272\366\236\206\257\234@\231\300\324\323\323\220,\201M\345\263\371G\376D\310e\341\247\216\235$\376v\340K\204\\\026~\352\330I\342o\007\276D\310e\341\247\216\235$\376v\340KC\f\311\365J"
+	.ascii	"1\\.\306\366\235\3415\037\212\322O\200\364\230\226\343\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.25.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\332\003\275\027"
+	.string	"\366\351\216H\340\322&\035RoC\001)\216 r@\375\256\240\253M+\217\331}\240#S)\207CU\224Ers\207\207\323\372\017\0079M\214\003\3254\030\306\030\205#\330\034\247v\277\307\310b\003\252\320\301\231\025d\033!do)S\n|"
+	.string	"r"
+	.string	"y"
+	.string	"\227\016\277\227\270\t\227}\024C\r\034\236\324\241\307&d\316\271J\035\325]\306\233t\227\233\301\373\030\336Q]\007O\246\317\353d\\u\371\336K$\201\253!\243\275\016Z\370\311B\0055\255`\370\241\360\017\307\214\302\n\210\331\004\365$\274\213\251\236\230\262\305TF\001s\316"
+	.string	"4\b\321\200\372\320v4~"
+	.ascii	"\372\276\350\021\006\356&\243\001]\275\2279\247UF\373\271Gn\033"
+	.ascii	"\207m\027{O\004/\375\334 ;\345\341\217\"\325\250\337nP\252OR"
+	.ascii	"m\222\352O\252=\251\356\244ZJu\274z\243Z\243\372*%Bn,\b2g\204"
+	.ascii	"\034\221iC\276\360\360\333Ot\025~\221A\377\226\363\275f\337-"
+	.ascii	"I\204\352\273\214\266\313\267\031\264S|\310u\"\235\3575S\220"
+	.ascii	"\344\301\307\234\223\345\322,6F\256\366O\034\205\353\241\215"
+	.ascii	"N2g\020\316\305\234\241\312\005\276[s\267r\033\f\321\340\321"
+	.ascii	"%U\267'B-\337\336\366\0010f\214x\001\323\234\334\232M\0336e="
+	.ascii	"\231\262\034\\"
+	.string	"\237\003\031\332\301\243K\217s\316\031\267\366\234\016\334\224\215H\261\013k[\3466\037\021\3201\347D \221dJ\276\321\003\037}\034|\033\355}*\3004g]\224\335},D\274et_\335\307@\354h\316\340~_t)\002w\353)\002\323\334\356\234\363\265[\263\3033\257\271\203;\306\345F\006\007\206\265\242i\261X\255\230\025\315\f\fk\025cs\263rQq\253\206\201\315\n\247\325\262Y\201\341\374\347\006\2416\005\333\035\353\30491$8\321\357#\205\n5\304\240iy\340n\322\303;m\315\2475\355\311\322i\225H\213\251\344Gg\372\224\305U\b)~[\363\267\336\002P\212\2417\322>\207\267\267\235\244F\322zRu\025-\204&t{@\307W\034\305&S\202i\316\341\234\263\013]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.26.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\310\006=\037"
+	.string	"6\364\262H\260XQ:pU\367\201\033\221\005\240\023zf\243\314\340\323\352\235Rw\022b\277\f\241\030\215\354S\276\323J\3539C\217\027\232\300\373\235\302\273Sxq\036\367\032G\315\355\204\333\310x\3432k\377\333\377\215\020\262\211\224)\005\243"
+	.string	"\216"
+	.string	"\236"
+	.ascii	"\322\273\3617\216\303f\367\300\235\013\2403\345\310\341U\231"
+	.ascii	"s\326Z\036 \274\004\037\013/\267\205\345\301\335\r\252\3551\330"
+	.ascii	"\313\325b\255T)\324i\024C\t\256\332|\221\001h\303\210\312\rW"
+	.ascii	"\363\330\213\303^\374\350Kw\227\316\205\266T\234\245\242GW)\256"
+	.ascii	"J\201BS'\216:aBO\006X\204(\361q\311N\t\003A;<*\222x\310\302\345"
+	.ascii	"\200-<\034\225 \312w\324c\341<\200\t~\202b\274\350\252\203\273"
+	.ascii	"Q0\306\210\357\213\016\n1\352\335p#\256\"\2039\247\365\206\013"
+	.ascii	"q\003\270\375\f\266ivH \272>>\240'U\274>\266\354\273\377E\252"
+	.ascii	"]Nt\307\244\032&\325/\251vIuK\252YR\275\222j\225T\247\244\032"
+	.ascii	"%\325'\251\036\245Z\224\352P\252\245T\203W/\250VP}\230X\217\022"
+	.ascii	"\007\2779A\374\260\314$2\t\306\211\376\241\363\360\213\234\362"
+	.ascii	"\2116\2145;#\021S\217\331x9\3326\237\347\224\275\343B\266\017"
+	.ascii	"q\030kv\0320\025E\231s\312.-\033/\277\002\300\325~\216\353\260"
+	.ascii	"}g\244\277\346\364\371\001d\316\335\314/\343\003J4q\317\373\013"
+	.ascii	"\t\323\212\233\233\235\307\221\216'\334\004K\357\361\001\274"
+	.ascii	"[\223\215\376\020\f\231\201#\334\234\303\225KA\350H\007\2752"
+	.ascii	"\013W\200\016f\334\363~@\b\023+I6\372\223\233\363\351ge+\336"
+	.ascii	"T\366\330\352\310O\021r\322A\257\034\234sNps\337\020\306V\266"
+	.ascii	"\240\017\247gm?8\317=\227\2459\247\002\351\2735\371I\032\334"
+	.ascii	"\033\201|#\355uL\330\350\317\272/\273{\034\031\340]$\374\352"
+	.ascii	"\036'\350F\177\216\355\367E\2274\214z9Yl\364\267\373\023D\304"
+	.ascii	"\207\335\234\275\253\t\023n\341\031\356\030\332\005\t\030 \310"
+	.ascii	"\324*\314\310\310\314\304\324*L\200 S\213\241\271P\243\025\360"
+	.ascii	"\214\205\b45\f334\265\324n~}\\\266\305fo\314\001\234\223\305"
+	.ascii	"\202\017\375Qv\270(\325\210\275\266\367\327\221\216\007\006\333"
+	.ascii	"\227\022\354e\305\257\315\021A\272\336`rkr\271\266\345j\265V"
+	.ascii	"J\254\331\021\213\265+%e\315V\273\332\334\314\350\003xWm\316"
+	.ascii	"\252M-\005\325,\325\244\206S\247}\362\3431("
+	.string	"\"\n\265\247\025p\205\206Z\305\002s\202I\tO\342\022Y\322#:\236\221\246>\256:\0378n\316\343\212\273j2\002\336\276}\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.27.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`K\013\325("
+	.string	"\032A\314\rJ\240\226U:\204\3360*\371\003f<slV\3048e\313K\"9\306-G\372\016\304Xi\201k\251\354\223D~\344\030\257%\232\001X\205\327a-\360\352o\202\0277\206\336M|O\005W\264m\333\266m\333\266\222F6\2212\311\322"
+	.string	"\264"
+	.string	"\306"
+	.string	";\300<\335\242\371\243\313\270\331}\"\213(\210>\025\204\307(\245\326Jly\256<%\177+O\373\304\262N\026\277$\337<\310\262\002\374\371z\274\235.\207\273\331j\264\231,\006{\271Z&\253\244d\363\315\236\365B\306p\"\322\003\204\363`\322Y\222f\360\n\322\201H2\370wt\337Q\f\356\031\235g\004\203wE\327\025\261\340\334\212\343V\020\361M\305m*Rpm\350\264!\024<+qY\t\022\034\033q\330\b\021\374\nqW\b\020\334\002`\202\303\207\233G~>"
+	.ascii	"p\361\023\304,\017/\311\026\036\262\305\270\303\2244k\2552 \r"
+	.ascii	"\244\001\366\001\322a\262E\207\367\233N\376\320q\354\001\352"
+	.ascii	"pf\275\324Z\227{\2008|[\276\313\fvw\270\333B\n]\254\025\247\373"
+	.ascii	"\334-\342p\013\025[h7\346\305\037\001\345\2059"
+	.string	"\3237HyY(\357\n\345\005R\336\037\345\365Q\336\036\345\345Q\336\035\345\325Q\336\034\345\305Q\336\033\345\265Q\336\032\345\245Q\336\031\345\225Q\336\030\345\205Q\336\027\345uQ\336\026\3455)/\213\362\226\224\227R^\362\274M\3622\311{\0057 F\026D\325\272\341\212J-B{\024\235\351_z\215}\323\276\366L\027L\234\037\223ij\210\320<\225\355\336\354\215\373\332\245q\245\233/a0q~\022L\tqRku9]\027\363\364E\200\347\335\317x\322\315\213\353\364Z\255B8v\324Z\024\006L\272\211K\330Q8\316GHX\256>\327\325\255\326Y\035KW3\025a\313\366\244l\365\331\034\305Rf\363\215\363\020\024i\366\271f\263:V54\373GV\337\370\032\221\251f\321~\r\035CA%\201\002\267\361\235\261\247*\207\257\312>\267l\3323JR\031\330j\245\276P\345i\331\272!\002f\337\370"
+	.ascii	"?\232\030\365\310\341+\332\347\266RtL\263z\330\345\301\366y\024"
+	.ascii	"%%\031\330\352d\255\265\222}\376B\031\354\230&\241vH\364\356"
+	.ascii	"\276\334\270O\002\222\324Z\rP\250\236\252=\020\013\373d\022\355"
+	.ascii	"\327\251\357\003\"\207\257\226\033Aw\177\347\005\371\025R\276"
+	.ascii	"\271\277\343B\207\2576\330\3577\235\302\320q\344\251\222\303"
+	.ascii	"W\035\020.\341\025\2762\303\t\017(4"
+	.string	"\240!F\250\241\241\251\221!F\200\320\200\206(c3\2018\364m\215\004\0076D\n556\304W\261~\213-\004\323-9\255\263\030\310ZM\034\370\322\357\204\006\314\224\r\366\t\365\235\361,}.K\257\364\f\313p\005\212\321\256\374~\374\326\204\005\004\366\257uV\300_\371\353\265O\350\203\364\365\271\276\356u\254\312'\354u\257O\252\036<^\357\244xT\273)\273\353\223\207N\327\271\243.\227\273\rw\340p}\303\365\217\267[\355h\353\247\357\214\267\365\271\266\256\365\314\321\266\244\366\304\2506\223\242\r\235h}.\255g\255\263\242\rg\345,\326\034u\233\324P\220L\3261\241,\026{Q\301:\007\f\326/*\022\266\204_S\366\325\352\016\201\006\250\221\\E\221\214\210\210\244 )IZ\003A\006\204 eV\035\022\340\203%\310b\re\"A\323\302\326\377;\322P\316\313\272\233\"\237\372\347\224G\354\2468"
+	.string	"\320\260\354\352\020l\320\007\361~\001\365\007P\242\253O2/\\\230\365~Z\002\356\301\2137\314\376\022\314\221\254(F\207Y\331\215\261Q\001y\213"
+	.string	"\035\025DD\271\251K\276\266\207\215\022\353\3741\007\b\022\221\235\350\024`3\025\321'\004\335\307\360\fpG1\207\n\\\\\312Y\242SI\n\231\232k\321\331\236w\274e~/\217\235~cx\264\007\251\314\022\bh\037\"\327\202A\237`A6\253-?\t\200\371\271\333\363\220\341\220\224\023\030\212\222\306\020\r\bv\034^\314\024-\312J\343\327\363\346\224Mh3\320 6\"\207\3475\314p\324c\315\246q)s&;\311\260D\322[0\354\211\217+\261<C\247\301\265Z-\247\".m\375\230NJr\327\311:P-r\r\027\3642c\023s\343-\322\302%\254\255.M\316\257\027s\020\321\276\251\2377N\003e\200\021\275\215\004e\375\037\253\277\264w\234\034O"
+	.string	"\271I8\231\322\310\231"
+	.string	"\375\277\366.\277~\301g\312t\177\020A\246e\354s\374y8\321K\344\27121\001\244M\002\237_9z\353\272\216\241\264\226P\226+\217\tC\255\340TU\0253\036\372|\200\353\001~\376\220\347\013\270\017\260\373\007=\037\340\365\200\235\177\310\213\317\030\261\247\177\311\030\212+1\222t\260\274\322\273\261"
+	.ascii	"\3571\351\304?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.28.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\322\017\2551"
+	.string	":N\324\020J\240\230U\007\nQ\003\207\021\221\215b\3641,_\"T\242m\310\212\013$r\377\021\2219\301\0075G\304 ~<p\307L%=\013<\205\327a\035\276\234rD\276\024\242/\004\313\021\212\347I\226eY\226e#{o\271SJ)\006\001\332"
+	.string	"\365"
+	.string	"}\3249z\230\233\350\222\305\213\246rn`^aY\366F\330\271\264/\332\267\264\357\257\340V\243\313f\324{\0329#\023s\2041\026\211/Ca\320\005\370\363\365x-;]\016w\263\325h3Y\f\366r\265V5\275\350{\017\267j"
+	.string	"\305\201\004*h\310\247\221Q=\023\245\304e\222tL\022$~l6L\323\311\215M]lbr\342R\277,\005\361!\220\026\002Q\362 \217v\341\261\303\201:\372\247#\207\373\216\272w\204\303yF\335bt\303w2Z'#\206\347`4\016\306\013\277\271h\233\213\026^S6M\311\302g'Zv\302\204\307J4\254\004\t\177\215h\327\b\021\336\032\246\360P\324\253\023\241\242!\r!\"WCt*\033\332\200\n\231@~\321\264FQ\223lH\003J\200\tJ\215Vj\3470\204\301\321\031\037\372[\251Q#\315f\320\320\207v\325"
+	.ascii	"\313\262\354AC\036\232i\232\371\0010\263\rs\214A\237d^\372x\200"
+	.ascii	"\"\246\226_\005sN/\273q\256s\202NjF^\347\231\353,s\235c\256\363"
+	.ascii	"\361:\303\\g\343u.^g\342u~\271\316\303\353,\274\316\301\353\354"
+	.ascii	"r\235\201\327\371w\235}\327\271w\235y\327\271\345:\357\256\263"
+	.ascii	"\356:\347\2563\356:\337\256\263\355:\327\2563\355:\317\256\263"
+	.ascii	"\354:\307\2563\354:\277\256\263\353:\267\256\363z\235\325\353"
+	.ascii	"\234^\347{\235\321v~\324\331Q\347V\240\003\321\004\301\223e;"
+	.ascii	"<\263X&\227\210\214N\352F\352\037\334J\374\342N\262\260\372\b"
+	.ascii	"\255ITW5k_\034s\0177\223_\314=\332GO#]X}\204\016P]\261bY\026"
+	.ascii	"\331\227\221k_GQlg\356\035\315\243\247\227\354\3245\226U\261"
+	.ascii	"$\204e\2275,\263\366\345\345\032\262\217\2652\233X\354\3650\032"
+	.ascii	"\246\3361\033\366I\206\375\353uj`4\257,F\374jY\275\224\237\342"
+	.ascii	"r>\324R\373\321\023\325\345\372\326\353\260\254V\327{\226Sm\331"
+	.ascii	"\252\244-\265\n\252\225R\022\255\255\007iW>\241\353'y}\365cT"
+	.ascii	"\252\232\237\276\243\264\250\372\315\354\332\022\252W\357\367"
+	.ascii	"\217&%Q\372\002\332\006\322;f\020\225\037\177\362\230\240\330"
+	.ascii	"H?\311\351\337\327\361!\225\301\261x\312\233\237\322\276\351"
+	.ascii	"\353\2245\3537\263\211F\260\\\021\371\361\347\375$\267Z|\316"
+	.ascii	"\253A\216l\344sh+>\25228V\243,\313\262\350'\333B\212\374\234"
+	.ascii	"G\237\200L<3\367\260h&7\217-\313\262\003\356S\020\025n\251\n"
+	.ascii	"\334\\_p\263\3237\007\021?\376d\177\234\377o \033hsT\332\357"
+	.ascii	"\337@40\370\223\221\337\337J}o4\233\033\262\374\370\363\237\t"
+	.ascii	"J\215\242\017\016\032BSh\316\261\221\320`\002\316\316\315\003"
+	.ascii	"\236\235\035\236\234\233\007\016pvnr\"H\270\261\3511\017\204"
+	.ascii	"\005\021n&\360\360D\270y-\331~\025\t^\370\363\030\370\002\312"
+	.ascii	"\262)\n4R\267U\217\004L#F\316D\315\314\274\314\324\214\314\225"
+	.ascii	"\314\261U\322\267)J\242\230\230?\2661Y\307\243q\n\246M\002\003"
+	.ascii	"\363\306)\230\326\370\306O\")~\222\213O|\035g\361u\304'$#&~r"
+	.ascii	"\n\352\345\345\207U/S\303t\030\204:\3226)T\370I\026~\360cT\204"
+	.ascii	"\337Q\202A\340?\271\270<0\313\305\006x\005\3649\177\255\221\337"
+	.ascii	"\357}\316_\353K}\237\254*\322\353=\317\252\307\343\355\236H\327"
+	.string	"\232\224D-\237\344\226\337\275\216M\013\315\356i\264\313Y\351\234CT\235\356s\257\303\262\322\275g9s\271[\025\356\205\340p\177\253\302\265\267[\315\326\264\331\276f\253\251]\325fNZ\226\223J\243\375\354uXNZV:\233\305Z\3317\311\002\201_\250qhd\215\214\210\210\224$)H\2061\201\006\"CU\305\r\022@\222A\216\307*\312\\ 2C\206e\377\337\341\274,\304\273\277\313/`\003\3168\207\321\276h\177\025=?.0\377W\214\357\327\"\030v\254\003\f\223KB\361\242\300\034\020qO'G\210\244\202d\310\016\275\227\346\231\276\335M=\367\2618K<\037+\340\207\352\r\366\tx_\354\037N@\022\320T\374\304r&^\027\256\206\222s}@=\033\234V\344:A\203t\263\262\321E\204\312S8\212\3645{\207\372\330\374\357\355\300|K\n\314\021\313L\234\b\207\310\031\277\360b\336J\017"
+	.string	"pyT\340\234-~\261Im\037\300\344p\323\265AA/\260\001K\204\375\243\0076x>\245\357%U\265$\177L\306\350\021tz\304\203M\305\305\002y\0042<  \020\362\006\255\366\211\227gYb\301\214\365o\227_ 0\224\206\260\312<\313\214\372\0012\275\343\301\244\275d\001\347\3103\324\221gA\240C\352z|Ee\220;\304&\330\\V\034j\022K\234N\222|\021\334#\225\223\004\365\025\316\313\375-\207rd\305$\271\027\345M0\223\332\207<\212\313\253\242`P\3003\272\307\212(\202\177\246\354\2222\244h\253\rP8\315Y\r\025\242=\340a\330\241_zPm/\367\345\005q\363\345\236w\005\360x\356\300'sU5v%\355qp\031\005"
+	.string	"\271Y\3402W\020OE\231\377#{0\222~\214\007\315\f\375\220\224\277bE\314\230\326}\016\026 \274"
+	.string	"q\223\300\201_\277\376\306V\303Pm\235H"
+	.ascii	"\256\347\246YH\002\223\312GR\235\036\033\347\347pJ\325\253\365"
+	.ascii	"\3774\030\235\323\225\325\367\352|\321h\272\316{*\236\252\367"
+	.ascii	"c\343\374\034N\251z\265\347\233\377\353A[bu\345\005\006\215\031"
+	.ascii	"\336\371t\224N\t\020I\023k\374\003"
+	.text
+	.section	.gnu.lto_arraySubInt32.29.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\032\002\315\021"
+	.string	"6bvF\340\360&\035Z\344\032\205#\303\026M\020L6v\334\376\"\330\004\377\266\207\340\030p\b\021\270/\362p\374\320s+\332\267\346\215\203\177j\035\032!\304X\224V\320y\355/\013\235\301\\\023{\217\277\030\261do)S\n`"
+	.string	"`"
+	.string	"^"
+	.string	"\353\205\370@\367h\357\002\270\307\356\037\334\243c\366\213{7\373\237\f/<2vW\245\036l\372\276\357;\364n\230\261G\250\031\363m7`DD\253\255<B\223K\f\bT\315\005\216,)\t\375\366\204\251\311\022\216\230\271\376v\004E\037\2556\36349\330]'\255&ss\267m\3016\004;#\004O\2332\315=\0353\r\237VM\247\246\037`"
+	.ascii	"\016\013\t1vc\276\031\213\024\205B\334\347\366S\3707\037\017"
+	.ascii	"u+\032:\333O\214\322\356\202<\372A\367\370\r\333\211\342<\261"
+	.ascii	"\367x\b\002\330\226\016\033\202v7\304\r\272\307\002\360\037\334"
+	.ascii	"\016\r\006\336\221\310\323\276\211\347\304\256\243\362\324nM"
+	.ascii	"N\320\00608\205\332\251&\315D\310<\324\244\207q(\215\n\223|\240"
+	.ascii	"\013)\335\007_\205;\f\rK~N\355P\325\317p\340\275\202\273\246"
+	.ascii	"~FB\226\237Oz\375\355\020\206\221\355\245\006K~\2526\"\227\232"
+	.ascii	"\252\215\355\255\344\310\315\222\222\265\306N]\347\367\370\316"
+	.ascii	"\217\272\367w\274\347\347\270\317}\312t\027%\207\231Tp\261\342"
+	.ascii	"\002\005\030V\257\327\212\203\241\220L\200f\211\240P\200\255"
+	.ascii	"Z*\023W\253\345b\251LJV-\025\353\205\242\022!`\327\t\311K\005"
+	.ascii	"s\271^\252\ro\2575\276\355\235\212\022H,*\213j\343\023\215\246"
+	.ascii	"T]$\310O\n\303\241'\275\316\211\243\226\\:\334\335\205N\360\223"
+	.ascii	"\246\3642E\337\214C\247>\320I\n\252E\002\321\002* \240\202\031"
+	.ascii	"\313m#\016\224\003{G\226[\224\276\265\240\214\244Q\370(\376U"
+	.ascii	"\034\331\221\231y\233\006Y\301\211\005,*\260\004\213i\256\262"
+	.ascii	"\225\331\036d9\355\266r\ro\030\215]\334\2601\265\016\247\003"
+	.ascii	"\033gmv\230!\f\267dbin\300(\371^>\213\2440T\215\367#\322\271"
+	.ascii	"\304\023"
+	.text
+	.section	.gnu.lto_qPercent.30.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"U\b"
+	.string	"FP:6@s\322\001\275\326&\2258D+\375\002\034X\246`\351\320\303\f\257#]\257n\rAg\324\3443Y\323H\226\3130\022\256\261=\254\016F\370';\033\233l)S\n)"
+	.string	"+"
+	.string	")"
+	.string	"&4\273\033\tn"
+	.string	"o\345\013\340-\3358\367\344\374\227\374\261\254\310\240R\243'@\303\356:Q\251\212[o\033\301\266\202\355\2265\353b\245x\330\336\354\215\355L\373#'\331\336\211,\260\213\001\202\262\273\fN\b\270\305y\266\375\220\213l\346\262\343\240\200\035\026\247V\201\327\324\2341\251`.\202\252\327<1}\224rew\243T\r\373o5\303\357\335\257\232NM\037.\\\374%fwb\025\022\367\325\001=\204<X\374d\030\226]\361\003\341\301\342\245\201b\347\300Y\204\203\026CY\246\305M\267\367S\016IKN}\372\223\212\224+\017<\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.31.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"-\t"
+	.string	"f\222?6@\217\322\001\t\254\376\363\272\222\305\220[\226H\020\023p\204\225w0\306\223'j\373\310\235g\356x\262]\241\263*\212\206\003\227\013O\272\r\220\036\375-\333\233H\231R0"
+	.string	"0"
+	.string	"-"
+	.string	"\\v,\t\250\301J\275Xv7\016\274"
+	.string	"\376\345\t\340\237b\234{r\376A\236\255\230\210\250V\245'\300\302\356:U\253\211[o\373\300\266\202}L\021\261\226Ey$\033\266I6\306\266\346]\234\337.E\210\346\362\347L\373\036\377 \275\203p\300nEkdw\023\214p\371\313d\266\375\326;H\016\372B\301\236\036\305q\312\2303\275\346I\nf\312\230\335\225R/\354g\253\026\266\323\360\335\377\356\3723M\253\246S\323\277h2\236\242\262\033\243\007\320\307\363\034\356\316F\3240\342h\361\263i\332\326\211\037\017G\213\235\220(n\f\274\201\030Bq\264m\241\210\351\366\206\2321\351\311\252P/p\227\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.32.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\005\t"
+	.string	"\306\021>6@\217\322\001St"
+	.string	"\376u\377\337\261\236Z\210\252\325\332\226z\017N\240Q\354\377\365\322\035\266\242\311Nh\232\035\303@0\277\272\023\344\330"
+	.string	"\351\321\265z\357-eJ\001/"
+	.string	"/"
+	.string	")"
+	.string	"\027*\210\221\201j\261\354n\314\234"
+	.string	"\376\271\017\300?\265\370\3509\362\017r\247b\222\222R\221\236"
+	.string	"\n\273\353L\251$n\275m\003\333\t\3661\001(+\273\021/\327\236\274\221\r\333\"\033c\263J4\227?k\332\367\370\207\350\033\204\337\356\304Jdw5>\270\374\t\244m\277\343+\221Gn\013&\201\327\324\237\\\246|\331\3515CP-\245|\331\033)\265\302\276[\245\260\235\206g\375\357\333\3574\255\232NM\377\202\240\361\231gA\261\207L\335\331\200\030B\034,f\032\206i\235\2305p\260\330\371\200\342\246\300\232\203\347\023C\232\366\211\230mo\250\231\222\232\024\352O\034OU\265\025\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.34.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`F\004\345\030"
+	.string	"\366\352\226J\300\020)\035\214\337\356y\216]\227\375\236\241\251oS\373\2557ng\253f\232\200uC:\035\345L\364"
+	.string	"\377e\355\2776\215\377\302\320\004\n\004\211\240I\020$>\273\3655\025\2405M \0334\237\335\212\376'\215\020B\310\226R\246\204"
+	.string	"w"
+	.string	"\200"
+	.ascii	"E9\373a\231l\177\320\201\356\274\221A\363\304\243\326\032[\261"
+	.ascii	"d\003\214+\322\035\031W\354\241\367\307\266\255\353l\231%9\212"
+	.ascii	"\264\371e\373r\215\016\205u\2212\340R\246\0366\202v~\366<\320"
+	.ascii	"\362\311\300&)\013\332\361\331\222E\016\006ZRk]\244\234\036&"
+	.ascii	"it<\362\254X\362,\245\244\016\207\003L'GU\204WR\013\\\266\321"
+	.ascii	"\271q\267:XX\036\331\027)\253\265~o\032\366\260\375\377\342\177"
+	.ascii	"\312OM\002\314\017a>\b\363?\230\017c\376\213\371.\346\237\314"
+	.ascii	"o-\324\336,\311Q\244\315\353\333/\2005\360S+\316\020\253\002"
+	.ascii	"\211RF\033\265\013\265\374\357\277#j\337\250\005\376\374\325"
+	.ascii	"\240j/\311==H+p\217\222\204\nl\337\337O\021\023h\0052X\242qU"
+	.ascii	"k=Y\361'g^\337:\325\242\2343\257\323\2037kM\241t\242\326\232"
+	.ascii	"`\305#(W\374\267\251\366\007\251\217(f\267\207\251\035\022\216"
+	.ascii	"\207'\331c\026\254\206G\325\352\336\205f\300\370Q\345Xh^\354"
+	.ascii	"Q\200\211\002\027\232\224J:v\213\234\023{\177-\310\356\275\204"
+	.ascii	"H\373\224nw\333\234\n\315\374\250\306n\n5\334\361DJ_\"}.1\367"
+	.ascii	"\266\315\351\314OE\216\205\357\245\335\275\340\222\240\321aU"
+	.ascii	"\3771W\353\315d\233{\201{\222\264cw\204\343\341{;jJ\247\303\335"
+	.ascii	"{\277T\210\204Wo\241\177}\273\"\001)2\034\343\322\"Ce\366,(0"
+	.ascii	"\021bVf1\027\332lFc\211\271\264\254\314b,/01\024\222\323$@x\211"
+	.string	"\305\320h/\261s[\250A\020\304\t\322!\017\351\313n\215s=\250\301k\221}j\212MbtS\216]~t\331 \2759v<X\267\372\2439k\003\n\035\020\326\253a-V\355\216\\m\366\253\307\247\035R\205\236\236\025\216\334\331\256\036P\265\343\341x\030\342\206\013\337\202\3410\206\331g\023x2\273\354V\213C+\312.;a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`B\002\375\b"
+	.string	"\244\013>\003"
+	.string	""
+	.string	""
+	.string	"\002\"\177\033\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \005\177\034\253\325\252\325"
+	.string	"\272\200\202\002\006\177\035\200\200\200\200\004\007\177\036\b\177\037\t\177 \n\177!\377\377\377\377\003\013\177\"\f\177#\r\177$\016\177%\017\177&\020\177'\021\177(\022\177)\023\177*\024\177+\025\177,\001\026\177-\370\354\254\027\177.\200\200\200\300"
+	.string	"\030\177/\350\314\2313\031\1770\032\1771\033\1772\034\1773\035\1774\036\1775\037\1776 \1777\001!\1778\037"
+	.string	""
+	.string	"\200\200\200\003\001"
+	.string	"\302\001\003\002"
+	.string	"\241\341\365\321\002\004\035d\003\013\204\006\003\017\342\001\242\007\013\342\016\022\242\026"
+	.ascii	".  \003\031R\265\001E\330\2500\332\315\276\264\0219\327y\350"
+	.ascii	"?\330\016\304\377\033\242\222i\2274s\326B\270\222\364\210o\240"
+	.ascii	"\3117\300\323#=~\343\337\020\3337d\3048\3025y\025\357`\370\206"
+	.ascii	"o|\3037\360\215\3457~\203~C\302o\254o\b\261X\"\360\271\341\033"
+	.ascii	"\276!\344\313@Z\211\317\301\030\003"
+	.text
+	.section	.gnu.lto_.refs.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"(\265/\375`\203\033\255w"
+	.string	"z\301\264*R@P\312I\007\273\276\376\376\353\377\357\266+\376'\352\256\355\375\315]L\305\226;\023\023\263\336\320\333?\351\314\344\021\305\336:\016\325\347j+\264\032+\367\335\034\303R\313=`\366\007C\2627F\016\031G\211r\265\317\2038\262\351o\273\377\241n\215\020)S'\002\225\002\265\002\354v\251\220\320\361\034\223q\225\343\264_~Q)\221\245Rt\242E\b\263\331\263\264\375\2107\254#R\212L\277\340\030\312\2534N\233+\203\210k\032\307S\370\006&c8\216\342\201\013\367\362\216\264\3549\252=\317h\317H\355\031F{\276\355\331\355\347'L}\265\245\003\364\224>\034\201\315r\233\316\271\206\033\"\324\211zkV\265\266\242\301f\033\206V\206\235\374\334\305G\270\311\372<\222\336\262{\251\034\212qpN"
+	.string	"\233]\363"
+	.string	"3H\344\227\325\354\227\355G\210A\251}%\021\300H\356\b\311\331\331V0hKF\205\304w$\354U\232\227{\335\272\324\356\275i\274\204\321\270\312jL\306LX\311\271\214\315\316R\357u\336{\317\324\337\213\277\230\t\203\275\272\202A\257\214\030Y\0130\243\220u\005\336{C\204\b\021\302C\210\"\016*nj2\354?hY\312\035\210\001h\320\236\307\216@\363Rp\004\332\017\320\336\246\375K\373n\037\307\035\210\037\270\003\221\345\033\242\r\225;\020[\276!\2060\241*\004\251\006k\005kN"
+	.string	"\320\004"
+	.string	"H:\200mp:\314\024\315\3008_\330\346P\205\237\231\370\257\314\345Z\376o\371/\370\231\277\005\377\327\360_\357\377\225)\377\341\036\367\177\356?\225w\370{\317\206\025\314X(\362\230\277\263\256\376\237\375g\362\277\372?\3550\177W\375Gc\366o(\244\365o\031X\374\214\365\341\337)\336\177\037\337\376\235\302\317 \030H\341\213\177\243\370\371\352\347\252\237\245?C\375\334\3643\364\347\244\237\217~6\372\271\350g\347\317\315\237\357\3170\374\354\342\347\237\237y~f\341g\024~>\341g\022~>\361\263\211\2373\370\271\304\317#~\326\371\371\201\237\035\3709\304\377\300\377}\377\353\376\257\375\254\300\317\037~.\340g\234\377\205?\013\360\277\204\377\"\374\334\341\347\233\2379\374\\\3633\315\3171?\017\177\356\237\377\237\313\177,\377\355\376\237\370\337\344?\212\377\026\374\177\373\217@aaa\341\317\326\370W\023\177"
+	.ascii	"O\001\027J$C\344!3\210\177\206WV\340\336\006\002\357\325\301"
+	.ascii	"\365\327\n\2516\241\376\341\236\353^&\207K\275\320\247\330\024"
+	.ascii	"\3639F%\312\201z\245\006\270b9\356\223:\025e\245\267/\365\362"
+	.ascii	"uNEY<\251R\350\223*e\332\\\247\224y/5j\363,k2\371)6\025"
+	.string	"}\212I\243\034\256\3632\257XS\252uJ\243\317(\322\250\315S\254\031}:\247\242\034\252\270\254\276\214|\204\235\261\324\323y\223\220\242\232P\233\270'Uz\355\356\345\262\242\013U\340\336()\324\256\331\304jDqIDL\232R\246\"\021QI\2573\356\251%\275W\213H\305E\232\200I\215\273V\034\307\314\021u\217\212\356%\340R\357E\272\227\3117\356\336\313\274\367\026\241Q\324{m\330<\247HH\367:y@\272Q\314\265\242{\273\fO-\372\024\243\222\352\254\221\211M/\f*\223\247\327n\n\332\2121\301\356\221_;\215\322\300\322S\353\334R\r!\315\276\215\332\276\3218\230\f\247i8\267\265\364\303&\365R\261\360 \2126k\303\035\210\357f\033\303\275\214C\344\302B\306!{\265\241\3300)\230\215\f\336\037Z\331`K\025\223\301;\233\002\330l7\2552\f\336\333\354\246\356\247vz7\235\312\234"
+	.ascii	"s\0025E;\256g\223\310\264D\364\272iFKD\260\261"
+	.string	"\247\224\0324\272\351\310\210F5\310\220\302\031\321\227&JD\210D_\235q\323\301\325\005u\363Bzz*%\3018EI%i\366\235\364>,'U\232\345.\2357R\215\\\025\020\310\221\f\231\267\255h\313\370;F\033\325DU\377\234\232e\003\370\206\3300t\336\317F\242\343\331\243Yb\027\3150c\3666\244\206f\3373\274o\313|\272\0255\313^:o'\233#\213R\020\242\346\230Q\263\251\331n\366\225Q\033,bjf_\254$,\300f\271\013\0232\331\331\270\360/N\352\025c\253\032\230V\177\355\213\"\237mP\220\205#\002E\360\013\020j\232\305F s\341-L\306\202\254E\220\377\242\246\367\336\232&\325\225\025^{\266k\317t\355\271\212\037\226\3662r\204\332l\237\007\326\232\341KK\255\335c2\346c+:||\205\365V0\250\t\2713\276\020\f\365F4\205e\365~\306\343<vk\351"
+	.string	"/jw3\266\322\332\263\221\266\031\270\263\213\231\273\342\244\324,\327\341\3148\353\224\300\200\2646\260\334\n\006\005A\316\213\2530[F-\214\262\263\032mV[\214!\315~\330,*\272K\002\343z\322e\317\351\024lqp\251\003\214\2626\327\346z=\200\233\276"
+	.ascii	"J)\2012#$\\\257\007\324\253D\334\201\306\344\026\270\302\036"
+	.ascii	"\022\253\302\2577\004\262+&s\306kZ\3276DP\260\007\353zL9z%\204"
+	.ascii	"\b\227\367`\314\226\337\032\265\331\336\3624\031)m\2048\246\364"
+	.ascii	"\364Z\213\036_\02786\257,o-zQB.E\3156\226\006d\217\302n4\001"
+	.ascii	"\374\273\tDJ\363\343:\034\032\250\252*#\277\323\365\215\345\365"
+	.ascii	"\025\003\337"
+	.string	"\240\206\364\361\265W\342\270\266\372^\332\252\200w{l\205\0253rV\227DG\327V\346\354\372I\352\2170\357m\245\nC\326\206&\330l\343\275\332\326\225\331 l\266\357^\345\272\233\352\322l\333\275\nV\265F\245\331\256c\233pp]\245\n\312P\253\313\231\236\334\273\n[1\310\035\363\252\331\246\262J\311\252O\315\366\r16v\320X\322l\307\235\255\345b\366U\245\331\236\242\005\n\224\216\202&d\313\217\037o\357(\274t\345F\221\024\315\364\357\007\223\316\315\255\333<(k4\246+9\326\236<\351\266\227\013\235\353\212\251\3331#\b\333\273\255\372\262\2675\0052V\255v\223\271\033\323!U\206\237\323\332\273\211^\315\345\233\013l\266\325zIwq\271-!)+k\2641'\276\353\344\004\202\233\266,\315`\362F\323\243\021{\222\226dI\013\216\r2-9\013\233ZZ[\223\211\233r\2015k\306J`"
+	.string	"\265\240\374i\201\2015\231\\!\337\207-\037hco\262j\340\321\323m\266\223\264\330\220\256o\232\027VeJ\332\243Y\346P\211N\213[\225\021#\375\325\323\"\031\225\236L\340\230\r^\357\257\276\355\334\212^i\266\2174\022%*\026>\300\356\"\336iI\301h\332\332j.\f\250\244\3605S]\224\030\2217\027[\315\221\251\331\\\263=\244\370\006GE\003\033\273\264\326%\205F+DH[\361\275rgLn\\LC`\026\221f\277\302"
+	.string	"\002\244\263Z\233K$\2474%j\221b32}g\261RvO;\232m\254\23240;\037[~\374G[\361\223y\357z/\016\302)\315\215$ZD{\255\216\356\241\243\255L\334\313T\251\022\364:\325"
+	.ascii	"\361\316\321U\357\035\177\357h+\016\027z\257\323]\365\360\230"
+	.ascii	"\334\002\257S\024\b\031\245\275\036Ex\274\255~\t(xU\346\336#"
+	.ascii	"\367^\003X\t\336\rN\232=\340\013o\245\02593k\337D\332\377L"
+	.string	"\274M\350\275w\306\220\032W!B\350\347\307x\024Z\372\264\2203\224L\001\301\213\241\244\317\017\004\023\220\330!Q\342E\016\222g\350\347\230\364\311Q\n\r\345\344\270"
+	.string	"R\252X\002%\213=F\344\017{\034\366,\225,\204\206\313\343\220r)\224\004\332\200\005\314\013?A>\313\237\241\023,^\226I\344Q\211\034\201E\373A\013C(^0*\225\306\231\036\013*\240\240g\304\215\005\025P0B\211\\\376\370\230@\236p\341\3503\304\002\200\033\022x~|\206Z\270\351\211A\246H\032I@\376\030\217B0BI\243\017\217\221\004\240\022\204\220He\n$\217\215O\013$\007<J#O\322\270D\321\002\311\023"
+	.ascii	"\362\2304\372(\215'\264@\362\304\250\020\032\032\241\005\222"
+	.ascii	"\247\2504\"\1776h\201\344i{hx\222\306\026x\214H\016^\370\t\n"
+	.ascii	"2\316\360\034S\254\306\030\t\222\306\245QF\b\350\b\363#L\004"
+	.ascii	"\"\226Jc\220\210\027@\312\240 \343N\322G\210\303\217>Jd\022\231"
+	.ascii	"\242\375\004$  Q\342E\361%.\210\340\202\b\210/q\201\216\316\005"
+	.ascii	"$t\332\223\320Y\227;\022\350\274\360\351).wH\350,\215@?=\303"
+	.ascii	"\345\216\004#\226I\237\242\022hyD\266@\201S`\025x\271\202\205"
+	.ascii	"v^\370(\227\306\023I \237\245q\t\244\334\t\352\271Y\306\364 "
+	.ascii	"yvf\\\030_Xw\202z^~~\200\224\254\212\343\322'h(\204\374I\221"
+	.ascii	"4\022]\030\225\353R\005\001\007\nB*s\226@@\312\234\230\344\316"
+	.ascii	"\212Uh\247\005\222g)T\274\216\316\006\037L\020\241\203\366(B"
+	.ascii	"H\305\322\270\"'\t\264b\005\3201'\351c\\\221sT\n\345\210\300"
+	.ascii	"9q\302\0052\311\363\003\264\263\202\210\302\0052\271\263\202"
+	.ascii	"x\352\337\035\226\325\212eeV\330g\245\331u\307\327\253\035m\325"
+	.ascii	"|L\275NRf_\t'\201X\340\002\3573\n\304\320\007\024\257\245fW\037"
+	.ascii	"_\177\324\315\275\205)\265\253\325\327\036P4\362\264\214\332"
+	.ascii	"\177\345\301#\n\034\226fOt\266\037\022NM\255U?d\212\004\255\354"
+	.ascii	"r|\255\242*b\001R\355\232]\251Z\352\005l\312S\227\337zc\275\261"
+	.ascii	"J\363xLg\352\250uy4|\225\306\344\365u\3115\273\342h\252)Ro?\356"
+	.ascii	"\326\247\365i\205\362\021\265\002*\205Um|\205j)\231\0346\260"
+	.ascii	"\332\232\n\306\355\312\220\266\270\0313\326&^\2024\343\264z*"
+	.ascii	"a\372\332\2447d\21215\325\354\272\324\314\032:\273\255\254f\327"
+	.ascii	"\032\315\\y\364\210\032\322\354J\243\231/Y\202\374\0216\201B"
+	.ascii	"\365b\230WE\364\274\222\222l(R\311b%\254\307z\264\036\255F\036"
+	.ascii	"\334y19)\342\301\264>\327\347j\364rw\305G\203\367vC\326\032\343"
+	.ascii	"k\202V"
+	.string	"\250r\351,\307\002\235A\206jFD\222$Icb\013\020\004\203Q\232{w\022\300D5\222\033\306Ff$IQR\032\326\320\220\034<E\230.\330h2\232OE\204R\361U\032\333\214\007\243\006ZF\376\027Qg\351!;\013\216\216\034\017\215\004X\016\340\020\305\356\325\376\017r\242\352Z\201V[+\214s\204\373/v\020\243{;}\266\375\367\003\005V\302\321Y\033\275\244\345\224\324,\2243\364\211o\325.E\305\201J\221\333\306\300*[\033\245\273M\020;_A\245\221\313Zi\330\373i\363\251w\241\244\203\237\330\246\023(\214]\023\025c\366\272\007\260I\225\031\013\321\007{\314\210\215\f/P\024\nWS\226\235K\005\340\201\033\226\276\330\216<\021/\300\360\262\370\325\004e=\272\350\370\320\206\006!\307\352u\360\343\333\3116y\022\324O\317.\2728x^\3609\340\203\020)\273\031\212\362u\327VO\214T"
+	.string	"+-[\216\201t;\315\243\236\226\322J\005\235\324\220\323\275\264i:\273\004w\247\200\264m\334\205\373\267\331\210#\236c\211\315\rx\361\230\327\216w\263@\255\006\246\211\330\377\007\020z\201\333\203L\326\002+\357\tqW&+!M\230\236\267\004\306\204\244V\361\345\265\tD\237\265\0335\221@\244X\302V\213j\316\226\205Z\347Z\316\205\316_\236\323\t+@v\024\304K*\372v\026\240\366\370\0137\301i{\227\t=j\361\236\357~\247\241\261%"
+	.ascii	"\306zC\342\225\207\373\2162X9\246<\033\2273 \230\315\221\303"
+	.ascii	"Pf(\267\205\321\351\3104i\270XZ\345\352V*45\310=u\336\0211\225"
+	.ascii	"\267\320"
+	.string	")~\361\274\212\345\237\237D\t\345\231\004&\257\345K)\316dY\213xh\367\212\274\242\322\027I\322N\027\"O\204\\\227*\256\250\222)2\365d\020uH|\260\332\210\342\004\304\373\036!\250\006j\273_P$\333\005\272\263\310\272[\242\320\355\337\353\303g\335\214\266a\217\007N0\r\360\212\006\n\036\n\317\353\205\252\227\004\246\250E^aB\352\201\3440iq\245B\214\352h\002ZK\272\253\257\212\321\336\3021\335\325nv\030%\365\277m\212OG\361h\363\b\363+\355E\240_\346\306MC\204\001B\251\2638n$\223\325\244\r\325\215?\301\305Z\211M\271iG}(#\025:\022\251\266@q4\275\n\255\3064\327\310\3369FB\001]\325u\332os\002P\251U-\300\203x\032a&\226\337\024\222\2750\212\021;j\332\225'\200\004\211\327ff\203KKZ\375\033Rv\305b\273\373D\323\205\274\215+"
+	.ascii	"y)\030\n\307\355\25158\214B\362\216\372_'?.\343\323'R\263`\005"
+	.ascii	"e\323\327h)R\302\025\366\341\034r\2337\004\300\f$$\245\214H|"
+	.ascii	"\004\226\320\250\242\353\344\216Pr\200\236\321MW\217\217s\343"
+	.ascii	"\320~R\323]\177i\322V\372\337BD\340t\b\005\365\232\307\334\024"
+	.ascii	"\0315\3544\345\364S^\216\023@>'p#R\265P\003\362YD\250d\203\302"
+	.ascii	"\261\005EA\2673\313!\303P\271\213\202\267\265\026\344\001\277"
+	.ascii	"\002?\252\fd4\tYBr\024\365\370\021\234\265\002\340\262\\\200"
+	.ascii	"\326\256\262\206o\bE\2303\345\323\274v\224\217w\366\373\347\211"
+	.ascii	"\257\2560\254\034\234\\\266nh\215\317\030\213|7\360K\253Cd;\026"
+	.ascii	"\373\023\216\036\375L\007\301\036/\316g\326o\310\346\201\033"
+	.ascii	"`\336\252\203\224\033\321t\334/p\r\262>\360\210D\371DQ{\f\305"
+	.ascii	"\353\362\007\361k,\031\005\274\337\250\017\317\177\346i\222\327"
+	.ascii	"\314&/z\3722FY\304\3778\334\223\235s\037Z.`\275\243\374\365\324"
+	.ascii	"\201o\371\276\300\316\007\202\253w+`w\233!\357\254G\037\330V"
+	.ascii	"\237\213\377\235\260\317!\235\376\247\304\345>\324'\361\0242"
+	.ascii	"\270\007~D\032d\262\336{\242y\t\372\263\350R\335\201\375\221"
+	.ascii	"\034\370\357r3\255\356)\276\313\025\360y\353\247\354\256>\200"
+	.ascii	"\003\217\2475\212a\001\273x\257\342\016\025\177\n\274\324\272"
+	.ascii	"\2672\331\340\337\223Z\001"
+	.text
+	.section	.gnu.lto_.symtab.d0dfdc5404dd6e2a,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"applyMatrixRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d0dfdc5404dd6e2a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,394 @@
+	.file	"printf_serial.c"
+	.section	.gnu.lto_.profile.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"D\003;"
+	.string	"\005"
+	.string	"\254\277\363\246\017\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\226\266\306,\003\376\220\273\353\017\b\002\001\002\001\002"
+	.string	"\002"
+	.string	"\002\003\002\003\006\361\201\277\304\t"
+	.string	""
+	.string	"\003"
+	.ascii	"\270Hg\336\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\350#"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002\001\001\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"D\005o\ti\003X"
+	.text
+	.section	.gnu.lto_.inline.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 \347\375\003"
+	.string	"2\306\024\037\220)\351\017\211\020\227\210BC\375WP\201\342\355\254\2554\035\273\273\213\232\374]7E\266\224)\237h\253x\376\232j\354\374\203eo\224\366;\024\204\341\250\004\020|L\026\021BaL\2359J\243$(Nfy\003\333\226\374\017\267\275\246(m\001\177\226\004\020"
+	.ascii	"Q3`\n\327\211i\340# \307s:!\240x\016~\231+\270\321\312\342S\305"
+	.ascii	"\370\271\007\250\305T-2\213p\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 \364\275\003"
+	.string	"\002F\022\034\260%\351\f\3400\005/\017\303J\205\212\034{I\222\005\226\024\027\254m\273I\"\223\f\253\013}9\004H\266\002\t\263\033m\017fO<\342*\2406\364\206\370\f<8\237\020\213<\367\342b\317\356ykY\006'x\256S\004\021"
+	.string	"\020\023\204\314bj\022\224\223\0308d\004f"
+	.ascii	"`0S\020\206\215\bs@\347\376\230\026L\005\360g\t\230i!\312\216"
+	.ascii	"\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\270\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 g%\002"
+	.string	"\244\002U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\002\002\001\002\006\001"
+	.string	"\003\003\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\005"
+	.string	"\001\002\005\001"
+	.string	"\202\f\006\005.cO "
+	.string	"\n"
+	.ascii	"8\001\340\216W\331\322\f\356\346E\315\273\027c;s,6\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.bf20f4f64a6f2af0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.23.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\265\007"
+	.string	"B\21766Pm\323\001$\203\310\312\352V\251\226#\242\201T\3218\250\204\2011J\227Bk\332<\277v\347o\013\347k\006U]\263\221b\257\257E\303\223:\031\265\337\233\354\235R[\245\f\001\276\254\007\fV3\233\006\207M\303\252fj4\313\35055\f\223\315\253n\246e`\252\311\324\271QZg\365\355\247\215\236%\007\351\023#\f\243\037r\221\216\237a\b\016|w\351s\250KK\243\303\342\003K\366\347\201\361\302\376\264\273\353\350\331\027\375p\252B\027\222]\212R\312\222\244\311Fe\373\320\276\307?\270\213:\037\330\365F%\273\037\202\023,\227\376~\241.-'\240.\315\331'\005\022\002\243\211\021\224\335\235\021\343\334!\347\037\344"
+	.string	"\035\310sXY\330]\303\016Tq\307\333>\260\255`;\024\t"
+	.ascii	"\3202P&\264\356\005&.\024\202!\227`\233\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_tfp_printf.24.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375`\337\001e\021"
+	.string	"\326 tG\360\262&\035P\341'T\025\355\367\261\273A_\315\272\205m\222V-\353\3403\247\236\324\252\320\264\201Fk#\332j\261\254\006\017R\315`\356\275\312t\272\304\233\235\315{\177\342\\)\375\3317\255\253\352\264\023D\366\2262\245a"
+	.string	"]"
+	.string	"`"
+	.ascii	"\0270\347\213\007\307\2340\005^\300]\032\306\375\305yT6\020\204"
+	.ascii	"VL\321\303\306\207\310\234\263;\271\311v\031O`\273\\\024^U=\312"
+	.ascii	"U\225/\033\022\272V\217\001X\340\\\306\221\326\215\n\022\027"
+	.ascii	"+\256\020\325~J\\-\335\317\216\342BH\350\302\271\216\264\314"
+	.ascii	"9\255\241K\304\275\3356\3116\213\255\f\002\255]\331\260\225n"
+	.ascii	"\216\375\025\035\242\232\367e?v\217\016\373\271M\035\245z\243"
+	.ascii	"ZW\375\222\317fV`6\347MQ\021\032!\371\263\342\261_\246\362{>"
+	.ascii	"3\211=\343>\252\313fZj<L\224 Z\b\007\334\345\r<f\2408i3\236\030"
+	.ascii	"\241\203'\345\322\r\270K\265\037\3432T\207u\b',\240\007i\230"
+	.ascii	"\340\342\262]\356\036H\213\3079\347\\\233(\205\n\264\241\032"
+	.ascii	"kW\036\240\017|p\373\325\265-\274\350\303\321\236\330\334\306"
+	.ascii	"o8\b\251T\332.u\001\3704^\303\344\357\370\202\247\017/}o\273"
+	.ascii	"\374\352\216\235\0220H\320h\221G\232\362\323>;!\370\020\332_"
+	.ascii	"\006}\350\203\320\031\252\005\244\r\2122\245R\036\310a$u\202"
+	.ascii	"Y\227T0\220<\320$\363\002\223By`L\207\372N\247\257\324\241<\322"
+	.ascii	"\251+\2012\235J\002\1771&\260K}\037\330\221\300\346\3675\332"
+	.ascii	"\363\020\242\331\032\317\3049M\260\\\366\327bZ\0247\307\377\316"
+	.ascii	"r\264\\r_\226\331\342\202=?XJ\344\003\272kG\220\240\017\343\006"
+	.ascii	"& \240\002\021\301\344\001\321\300\312\033\355mC!\245:\325`\273"
+	.ascii	"\313Z\234|\226\316\275Y\024\033\301\200\304\211\360\324p\025"
+	.ascii	"YgQ\fX\220\306\306\273\274J\353z\225=\031Kb\321IC\031w\n\312"
+	.ascii	"\301\322\303\212\250\357\024<X\370w'\035\324\304z\fS\332\204"
+	.ascii	"kZ\347\352O"
+	.text
+	.section	.gnu.lto__putc.25.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"m\t"
+	.string	"v\023C70\221\322\001\003\023\222\237\252\026\304Z\206:\306\371\"\204mS\301\232\256\313\260fI\b\243Af$\301\367\321\364`D0\260)\376\230\213\245\207\310\t\266\332o\233H\231R1"
+	.string	"4"
+	.string	"0"
+	.string	"\235G\207'\330<v>\260y\364g\303<\374X\007\031UJ\314\356f\352\361\357\371\3717\271\007\\\241\236\234\207\335u\202+\215[o\033\3016\203\375NN,}N"
+	.string	"KA\313n\306\213f]q%\304\366?\2665m\205\206\357\241\205u\227C\245\265\273 /<\355\217\234\344{\211_.\260\313\022i\355\206 '\004\007m\200\241(\373'G\251\360AL\341\345Ao\363\250\352\331\270\246\036\323+\204\213\252&\225/;D\245v\330\307vw\255,\373\341\217\305\264j\006\332M\267\026\232\020\221\272\221\027!q*\221:SV\342\266\215\323\262\022I\264eZ\347e\241\003s\246Q\227\2358\256\313>\341\036[e9\316\270Rza\200LU\2657.\003\013"
+	.ascii	"2\241\031h`\341Q\022&\242Kx_F%\327\330Wa\260\202\n=\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printfSerialInit.26.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 \353}\006"
+	.string	"R\f.3`m\322\001"
+	.string	"VX\013(`V\310\345\033~\275\234?\310\221\377\233\025D\226\340\003W\315*\273y{,\352\203 \020\330\177\366lYM\351\327g\211\334)\005\235,\f\027\nb4\n\013\033\213\202\031g\275\252z\223\263\250K\345&\250q\226\202\276\f\006\272\315{\320U\262;=\225@\237Q\210\223\021\2454{48\004\374\034G\347\366\001\2429v"
+	.string	"\2041\nI$\326fX\313\214\326\322\3777=m\"|D%\004!\277\305\211\311G(\"\034m]\351\325\2228\333\270?(&@D\377]j\370r\273jwX v07\200\204\377m\261s\341\246\333\032\264=h[\021\007"
+	.ascii	"2\003\346j\006q\241\324e\220\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"e\005"
+	.string	"\302\207\035'\200k:\034\216*\003\320v"
+	.string	"\001#\321t\210\300\207\031@\2140\346\266\201e\340\330\254Ml\333\346Zj\321\215\310-S\335P\372\177\213J\004\0052QS\t2\267A&v\200&f\312e\b\303\223\2053\2055\374\337f\243\204+\210\360\343\035$\232!2e,\033Q\250\340\306\343\336!\030{\331bw\353\232\332R\3478\017\247u\373\301\240\364\377\225\035\257-^\002\025"
+	.string	"K\215\202c\233fY\215\260Mh\236\031\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\207\017\020\002\227\026X0<{@\240\254b,\204E:\361\355\212\214"
+	.ascii	"W\001\2419T\031"
+	.text
+	.section	.gnu.lto_.refs.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002\001\001\001"
+	.string	"\003\003"
+	.string	"\004\002"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\006\002"
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bf20f4f64a6f2af0,"e",@progbits
+	.string	"(\265/\375`\232\022\r["
+	.ascii	"\232\230\004\"Q@\220\322\031\016J\203\034\316\201\036\205n\233"
+	.ascii	"\020\001C`8\214\310\213\242b\202\361Pi\252Zm\312\364F$\nb\364"
+	.ascii	"$\031@\177\fmM\225H\215\031\324\220\376OJ\333C\263\221\033q\241"
+	.ascii	"\016\226LMs\200\311\232\2404z\"\231\273\276\337z\023)S\321\001"
+	.ascii	"\t\002\022\002=bZLk\t\23669\264Y\203\226\376zC\374\336\306O\274"
+	.ascii	"4earp+j\344m\312\326\335\332\255\r\364\003s\003\222\345Hz\326"
+	.ascii	"2\263u>i\230\320\204\2612C\265dv\270p8\025i\332\271\243bM\236"
+	.ascii	"\036\362i\313\024F\317K\351\227M\372\245K\277n\351O\226\364\337"
+	.ascii	"0`|\316-\2619F\327\313\272\355Z\300~\351\035\305\332|v\332,q"
+	.ascii	"\263\242\222~\013\370m\336\026\360\373>IG\254W\372\335J\277W"
+	.ascii	"\351b\331,\273\006\355\332w\207U;Nr\355'N\2303<\312\030\375\356"
+	.ascii	"H\277A?\237\r\372}o\244#6\304\017]\020\277\024m\033\002m\251"
+	.ascii	"\234\2415\252T\001\302\350\215h?\373y\371j2F\377\235\362=\363"
+	.ascii	"!b\326\245\007\243[\266fyfZ\322\030\335'\013eW\023\033\345+e"
+	.ascii	"u\270\017\271\366\332\275\372\360\0206O\306\030\375\331\020?"
+	.ascii	"^!\375\232\370\365\362\362\326\304\357v\237\373\217\243\243&"
+	.ascii	"\004\213\215\321\003\323\273H\277.\210\337\216\245PY\3109F\337"
+	.ascii	"\"\375\256+\366\357\222\365\332\260\236\362F\263\313\272\327"
+	.string	"\0179l\212\260\3411\032\3667\360\300\311\354t{u7\001<^p\214iF\277L>\300U?p\237\364\234\376l\335\020\277tA\374\376m\341\205\377~\216\341\337\nh\234\200\377/\256\363s\b\377v\340B\t3\376-\222\241\376kd\374w\203\003.\342\347\026\216\376<\374\267\370\357\321\277*\374k\302\277\036\374k\301\277\023\374\033\301\277-\376e\361\257\212\177\031\370w\201\177\005\3707\201\177\021\370\267\304\277?\377\215\376\r\361\357\210\177E\374;\300\277\037\376\003\375_\373\357\313\313\313\313\373\227\203\277\207\363\373<\020H\2534\331d*\2654\231?\312'\222\251L^1? \321\"\242\305\206\021/qkF\231\354&&*\344\362\247M\2716[L\367\226-\365\262D7Us)\006\t\265gJmMJR\220\315\025\200I\t\253\331\3116%W\263\233K)F3\2518\256m\035d\333\216=\250\372\306R\367"
+	.string	"L\335\307\355\266\356>v\367\315\222j\355\226\372Q:\231\230\272\243\200\230\232\352\210\266\324\315epgL\345\023\253)\204F\366t\266\f\353q\2257\232\355l1W\313\364y\f\353\033\335\275gR'3G\235\217,\035<\035\336\232{\004\240\263\303\206,sPXW>Kt\370\320Z\275p\320\326\340P\203U\323\016\357\356\213\307\256\334\374\271\212m8\333N3\200\034\263\034OC\030]\240\005\361\023\022:\363"
+	.ascii	"\361[F\255\355\263L\326\204\251Q}\216\217aI\260L\261T\327\220"
+	.ascii	"eje\251\035(\363\031w\026u\336\221'F\246"
+	.string	"\f\243\f\365\271\2348!RK\030\275\035?1\031-;`1\312:\270\206\363\023\347h~R\321\354F\362\223O\017\335H\237]\022\273$P%X[P~\350{8\322\237q0{\310\210\305\035\231y^&\021\362C\215Qv\002\362u9\233<1\372^\215\264\211\223\255\34246\204N\215\315\006g\332\026 \316+A\336\250\350\276\300\366\331\344Vd\255\374Br[\006\212[\023]\\\024\235\020\232\305\313\241d\243\t\331\347\226\334\264\306\254\226\236\344O'\261\246\234\016\374\233\306\245\252-o\273l\030\026KK\034\033n<\366k\363\266\207e\323[\2357N\260\272V\355_1p\253\245\027\266L\235\214I\321u\257\377\371\3103p\rnb\033|\203\231X\211\221L\003'\271Y\006Vn\033^\332u\363V\315\227\207]s\240\265;\331\335_\257_h\363\226n\317\364\302\226\235\314:\032\220%\367\244\006\257{U"
+	.ascii	"H\201R9U\330h\350\302(\263\245\311\2520`U\322\263\263\2253^\363"
+	.ascii	"}u+\245X\225\304\2642*\350\346\016\315\0170Y\316k:J$dI\260\370"
+	.ascii	"\232\240\255\335a\271\262\323\245F\233&F\257p\032\253\351\320"
+	.ascii	"9\3451w8\353AwD,\275\217+e*\347*T\252\262\256\264\320~\234\033"
+	.ascii	"(a\246\234\214\336\367#\275\357\211\214\214\315V\254\2356\213"
+	.ascii	"\007\224\023OG\214Y\023 O\316f,\345\354I\210\031\243,\2059\n"
+	.ascii	"\353p\226\302Pv\222+KA\273\221\273$zvI\370\322\210 \307~\350"
+	.ascii	"}\313\364v\\\266\263\036\233L\231\023\234:\271\270d\217\322\224"
+	.ascii	"\363\007\232\364a\017\343'P\263\007\346\006\224\263\253;*\bM"
+	.ascii	"\323\345\206\261\3633\005\203\327\303\f\214\262\030\033\341!"
+	.ascii	"V\240\216,\033\037\326\235\334"
+	.string	"\0241``\314d\307\224U\\x\374\205\244\210\323\355\316L\310\370\274p\025\201\242\346\345\3659\240\23759\306\305\251\223\204\2063\037Q\224(a\255\236\262\211\264b\261\244\315\r\f\257\373\312\002\233<k\022\206\205\004\tw\245\275\302q\341q\232\301\202Jr\356J\3739\255\301}a\361xm\275\261Emm1\327O+\311]\241\353\250\250 \03526)\\G\316\\9>\246\216^Fp\332\356\356\312\214\374\206\336\225\246\265!\354\324RQ\254`a\347\252\331\251\312\222zc\364h\222\310we\"\314\004Z\033\307\tf\313u\201\367\316\244<d\307]\216)\270\271\364\374\203\201\234\203\374\017\302;\322\265\235Z\250\251\342\302\353\250e\320{\317\364\374\377\032\271\354n\034\276\265\227J;_\337n\320\317\263\275-\321=\b\344\272\223h\241I\217LAN\215\350wu\037?\364\332K\345\363\352\250l\342\205\371am\253"
+	.string	"\372\331\243\225\353\025\023m6\367\332\333\311+f\013\312\265\271T\256\315\343O'\233\307\356\225\371\243,C\036W\371\274b*\237M\346\207N\366\261\237\001E*\322\260\230\004T\207HC\035\265\030T\215"
+	.ascii	"\030\215\302\241\241\340\017\005!\023\034H\301\247\006\217\212"
+	.ascii	"\304\242\021C\030A\340\f\343\013\306\037\025\202*\020\310\343"
+	.ascii	"\002\261\030C%\"\335\024\005\205F(\021\222\020\030\234\001D\032"
+	.ascii	"\252FC\0310\200\300\037#\"\221\002\240\357\0055\351\350\002u"
+	.ascii	"xdD\n\026_\030\207\"\204\352\260H\202\216:D\322 \3511N\210(R"
+	.ascii	"e\020\211T\243\0160\251H\315q\241\n\215 B\370)\362\275\304\220"
+	.ascii	"*#\t\350\373\320\260(D\022\252\220^\305\n\006V\260\240qs\026"
+	.ascii	"-R\264H\361;\213\026BB-V\b\245_!\324S\215C#`p\306M1\030c\bU\037"
+	.ascii	"\343\004\ncQ8cX$\"\340\304$a\021\205J$\026Q\350\024\205\303\242"
+	.ascii	"\241\212$$\032\346\030\201;#\250E\242\213\037\241\021\214\340"
+	.ascii	"\213\031?!PHD\354 GHD<B\205\300\017\324\"1\211\307\210D\034\252"
+	.ascii	"I\304\033\241\032\004\201HF\020F*\204a\030B\252\002Y\334\250"
+	.ascii	"iq\207((\314@\0056\340\200\3210\370\242(,*\222A\001\rug\306P"
+	.ascii	"8$\004\001H\005\256\020R\221\2062\322\234\240\032\264\200F\261"
+	.ascii	"\247\250\272\320 \304\205\204*\030!\202\007\030\244C'\214\202"
+	.ascii	"\303\242\320\b,R\221\206\305$\024H\304\243#\342\020\n\244a\360"
+	.ascii	"\b\305P\321\210\342\004\t\026\206\2020\214\214"
+	.string	"\202\025\b\215\210\206;<\324\355<\327\"N\324<{\354\252\222\370\3003K\325\244\351P\223f-u\253:\362\345\356\r\n\315\0207;\255\272\264,\034hx\316*\307\232'\214\226\371\313p\035P\332_cc\350\3004\023\245\231s]\017Z\3160\312t\237\313\351\232b&\245\260\\\321\241\244\315\230s\334\030\236\363\201\365\236\310\330\262\260\334y\256\007\256\356\250\304\350\026X\017.\2142\\\334\226-\374&\301\352\006\326\365\223S\232\301\331\345\374v\016\343d\331%\352\013\203\371qv\351\206%V_R\366\302nKc\266\272|l&p\252\354\230\313\313q\256\321*\302(\267}n'\t\306\204\007\243\314\205\003\201{\250\2010\246\230D\"2\"\"\"I\222\244\003a\005\204 g\2413\017\022 \2055\315A\350df\222\0242\354w\260\245}"
+	.string	"p\263FD\264\226\003jU\"\001l\3023\345\224D+\001TF\201ai\376*\2769X}{\305\020\276?@\313bO`\363\"\237\224+\r=a\305!\214l\036\362%"
+	.string	"\300L\021p\n\301\365\340\345\236\032@\013\36349(Rc\363?\307\353W`\3419\032\204\270Y\350P\016w>\252\337\356\366W\277\365\333\335\346\333\215\020K\313\260\263\304\221"
+	.string	"\006\2732\217[\017)\226\305*[f,\260\205\037\250\353\322\227\"_\220ir\234\b\363\316\237\003\300\213B\300M\216\020\326\326\026qE\242\bK\326$\232\006\374\330\351\302\260F\230\364'\322\262\266uh\203d\360\352R\360B}\342\200\325w\331\032\357\2010\213\r\025\336\372\341\020\301\275\315&5\215z\253\023\235\360'Q\341\2265k\362\002\273}5\250HYu\252\022\271b\204\260\2067\204\313\316\334\214\365\213\266\344\n\360\025\362\355\022\332\304\001V#\251\231\276\340\214\031\315}\bF\204\233\377\272J\262m\315\003\336\3068\204\310\".\013\316\276\331@/3js\214-)\023\251#\323\376\360\006\322\023\016G\246\017T\027\201?\200{\337\223\270+\267\252\"\301r\246{sI\177\211\305+\321h\002\271A\203J\216\376%\\'\362\244F\2659\3231\364q|\220\350xi\347"
+	.string	"\322\210~\277\233\232\223\004'\363+bp P\002J-\005$\231\2304\212\236&\372\224\346=u\375I\340\007\357\323\201#\3479\343\205X\327\256\342\"\370 &\361`c\203B'-O\326\373XJ\2766\323\013\370\004\354\356u\013\376 \n\201\302\214A\200G\021\324w\264\224)d+\362\263\336v\202\n\350\023\247\274j\354B\202\265\225\375e8i\353\220P\235\032\214"
+	.string	"\314\254\335\304V\301\326\001t\207\246er\322\266\2062\276\2673n\206\351 drR*N\335\200\213\035\252}\007\220\033\230\027\360\t\276D\343\r\242\020mt\335\355\n\372\216\353\346&\204\235\345\272\250p$\f\345\357CY\202\314\013\373\033\021\034"
+	.string	"\316\230\212!\200F\352\335\304\270g\231\r\317\230\274D\201\305\216\020S\344\007\034N>\fN\027\001\244\312\216E\001\226)\306\221G\334\334"
+	.string	"\317\035\361\311\262S\251t\032w\270y\220\347\265ba\233K\321\016@2\006eu\262\024\376"
+	.string	"\321(`\221\240\343\270\244\330#\304C\320\225\324\347\364NM\322\007\366&[\313l\212jC\316\332\336"
+	.string	"|\336\3767g\316\005\200\367\352"
+	.ascii	"\3362\351?\355\214\256I,x\207lN^\030Vp\315J\025"
+	.text
+	.section	.gnu.lto_.symtab.bf20f4f64a6f2af0,"e",@progbits
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bf20f4f64a6f2af0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
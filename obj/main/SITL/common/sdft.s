@@ -0,0 +1,501 @@
+	.file	"sdft.c"
+	.section	.gnu.lto_.profile.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\205\004"
+	.string	"\302\205\025 \240\033\032\003\343\3416T\f?\242p\315;\221RUU5`W\307&\276\377\336rK\271\223\224\001\247\316W\347\001\201\006a\241l\026\226!\003\301\240}\323\216h\364\200]&\212\207\352\257\243\236\263%i\025F\236\001\207Es\340\371q\374\276\323i$\"\233K\207\204\030"
+	.string	" "
+	.string	"\273\361j\350\200"
+	.string	"f\020\340\006\204\237\001 ;1h0\202\200y\335\036X\344\036\226ZA+\004\257\233+\030\3504\300\2506\354\346\004\"R\316x\261\254"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375 \\\255\001"
+	.string	"\360P"
+	.string	"\005"
+	.string	""
+	.string	"\001"
+	.string	"\004\004\001"
+	.string	"\001\005\002\001\006\003\001\007\003\001\002\n\002\004\004\004"
+	.string	"\001"
+	.string	"\t"
+	.ascii	" \205W\2068\013\\\310\210I\024\344\200\263\360\356\352\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`m\001U\f"
+	.string	"\266\322D@0\211*\215\001"
+	.string	"B\257N\233M9\017\227\317\347\220\335\363\313\305\334W\t\265\347\263}\264\352=\242B\307\361G\024h<\266\246s\241C\f8$x0\213\230\006\\\211\002`bd\004\244m)w\n2"
+	.string	"0"
+	.string	"6"
+	.string	"\036\r\260\022\261 \260\325_\323\030\367\350\321\003\254S\353a9\321+:\342\307mW\215\3169'\366\035M\rp\020\301\242\277\031\013zy\020h\370\310z\021\332*u\243\020\346\234\f\025>\225i\"\273\273\374>\321\370\276\235\025}*S\304\0269r{\372\266<\333[R8a\312\345\232\355h\203\317@H\371\233-\221B\n\223\265\013}@\005\366\312\356&a%\227\231\370%X\360\340\302\2472YP&&\" \025\002\"\261a\357]\211s\334\232\255\331\232\211\3139z\232s\006\377sc\354\006\210rag\217^ \003o\227\263\n@\224\013@hd\301A\242u\273\246\021\032\205\226%\024{\372\001\201\034\330\227\365\262b\264\365\201\240\024\357\0165 \240\242\032\241<w\200"
+	.ascii	"k\005Q:\360\200\211\220\226\013\302\344b\002\226,E&\312!q\322"
+	.ascii	"\020%l\211(\"\210#\270\301\265@\210=\360~\013\231\3076\001$\231"
+	.ascii	"\333\n!\220!;\304q\304\223\343\260\304D_\271:\265GM\360\215\264"
+	.ascii	"\364*\023\272\205\t\0228\231\235\347>\204@)F\373\022\366gE8\360"
+	.ascii	"\332.\306%\033\\*\200&=\\\355is\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375 ^\035\002"
+	.string	"\024\003R"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\004\004\001\001\001\001\377\001\177\002\005\177\002\n"
+	.string	"\005\002\001\001\017\006\006\003\001\001\001?\177\002\n\007"
+	.string	"\002\t\177\002\n\177\002\001"
+	.string	"\006"
+	.ascii	"2\005y\031S\363\026\272A\241\234\262\001,"
+	.text
+	.section	.gnu.lto_.pureconst.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\232\004\005\232\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"U\005"
+	.string	"BH\027\035\240'\351\377\247'\376\353*\276\261\252\252\212\0338\001\203\336\376%O~\236OZ#R\246\377\206\276\356\002\355\205\3624\224\001\334\275\334k^Sf\316w'\250\247\227n\235\234\260\262\"\277^'^\210\324\203\342\250\314\251\334s\236\324l\345a\034\3073\225\017:Q9\252y\n\312\221\271\b\037"
+	.string	"{B\331Z\220\261[\324hFe\005\265\0362*\266\001\"\016#\021.\215\001s\270%)\033\270'\207\tpWk\343\033\033\020[\017a\220"
+	.ascii	"\007\033\241\312.\206Jx\234\201\274\f\222UXZ\021\255g\261]\f"
+	.ascii	"\020p\001\206"
+	.text
+	.section	.gnu.lto_.lto.b80e017c27633989,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initTwiddle.8.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`\335\002\035\026"
+	.string	"&)\216I\260\022R:\342T\267\227\221k|\002\"\302A\325\b\334\242\257n62\227b\211\342\377\336\342\347,!\337\235_\377\367\373;\260dYd\177\2309\377)\375)=\027\206\355\216I\\\005\216\373\353 \234\013\276\251}B6\221;\245y"
+	.string	"o"
+	.string	"\177"
+	.ascii	"B\026\212\365\350;AO\303Z+\311\251\025\264Nc\017\031O\305\023"
+	.ascii	"\030O\377\262\315\236:\020\247>\220\021CdUk\225\355\215\023\\"
+	.ascii	"\004\336t\332N\216T\334i\363\311\023\001:\267\2234\037\305\343"
+	.ascii	"\2401\n\320\333\211\020L\350x!\323\323M\272b\346\"y\022\374\254"
+	.ascii	"\311\tJ%\365f\276\257^"
+	.string	"\214\030\253\265\336\347\363C/7'yRk\365\344\365B\334\255\333\256\261\275\300\336W[!\310C7\261\354\023\275\b\306\317q\207\227y\336\251\377\262Ob\341\003\"\201\233\245\r\274\315\375\331G\260d5\364\236\260a\027\272A>t\273v\272\265\323\344N\217s\232\356\2648\247wN\317O?dB\214\021L\252V\020eV\215\242K:\037\372\205>\355\333\207\341\007\375\032r\223X\217$0\331(i\235\332\377\361\201~\235\036\350A\266\007\300\323Sr[+6\355x\306\025\227\334\006\301\034E>\272\261q\r\020\361lr\263\244\033\323\355M\203\031\224\270\332\261=Ev\305\035{\360l&\310\3325\016\363\274\335\331\302E\224no<P;Q\021\312\022K7\027d\347\214\035On\226\373\340G\232\234vC\334,w\251F\004\221\304\375\t\377C\204\217Z\253\305Zq\">\322\223,l\261\222\225\200\237(nz\254"
+	.string	"\354\370\351\331\375\031f|\264\3232\254\254g&.\027,\264\310Tj))\265\231L\205F!E6ci\221\231\034pm\005\205E\346R\253\261\310^\300z\237\213*\206WC\334\346\310\375\035f\2741"
+	.ascii	"\253\312\367S5\356\317/\236\b[\232bI\356Z\0317\215\256\375\324"
+	.ascii	"EZr\327\302\366\345A\270\363\265\326\366\206?\315\n\340\324Z"
+	.ascii	"\035\3705\356\204\342\347\234\032\003\2156\236.\021\217\n7K\237"
+	.ascii	"\306\231\034c\216X\3702\013*9 `\002\031\262#\017a \037\317\020"
+	.ascii	"\263m\0265H\rhb\030\016\333\033<\333\226\235\304\227\252\214"
+	.ascii	"9r\027\367\306\3620\221B\373J,\267G\335!\026o\343\263\313\315"
+	.ascii	"'\f;\233\311[e\235CR\250Xmq\376\275\013\330\\\220:p\363\200\260"
+	.ascii	"\217\361\205\306\275b\277\200\035\304\211o\3150\302_\3068P\204"
+	.ascii	"\002W\235f\243\2139\036\251\006\357\351\327\204\353\230\3017"
+	.ascii	"\334\214\353\340\3410d\254\325\b\372\022\225\266H\333\025\312"
+	.text
+	.section	.gnu.lto_sdftXYZInit.9.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`\332\006\345&"
+	.string	"\232F0\017D\200\234Nc\036\206u\2036Fy\355\\\036\272\236\007F\342zJ\227\316\322\273\240p\342-\300\013\021=\343\215PC\260\300Q\323.S\375'\b\367\267\263\356\264FVN\235F\003U\223;-\351%mK)S\n\342"
+	.string	"\321"
+	.string	"\337"
+	.ascii	"j\367N\031\331\310|\031dO\355\207]\f\352c0\036\340\336.1\265"
+	.ascii	"{\215F~`\276\264\361>\273\227\346\005\354^B\331m~b\374\344dh"
+	.ascii	"\251\273\367\006\253\221]\255\325g\233\301\317\354\326x\233%"
+	.ascii	"\324\001\364\374N_\217\007h\362v\245\255\024\312\347i8~\301\026"
+	.ascii	"[\025V\324\001\\\252\307{\354\313\3608\336\355\n\210\305@$\216"
+	.ascii	"\312\221A\350\357\307O\013t\273\362a%\260mQ\037O\303WV\217\367"
+	.ascii	"\350\217\363\230;\016\264+\200X\271\333\025\227\315\200\303\355"
+	.ascii	"\312\325.\344\344\352\b5\205\276\262\264\316\263\300{/\017\226"
+	.ascii	"\f+\301K\f\272k\262\343\345\325\036!\371\206H\226\326\255\017"
+	.ascii	"+\307\253\215\300E&\007\017V\321\372\240)2w\264S+\254)Jy\032"
+	.ascii	"\356\275\246UXYw\200\333\037\332\026\332e]\367^\n\276\030\020"
+	.ascii	"M\2778%0v/\025H\231\022G\212&\315\2436\221\005}\225}\302\264"
+	.ascii	"\025k\224"
+	.string	"m,\322\352e\377og3\\\273\354!\241  K\215\340e\377\001K\375\363,\177\201c\371}>\366\0138\230\373\367/\367\371\265\333\367\264\273g\251MK\315\263\324;K]Zjk\251\253\245\246\226\372\f&|\0218s/\216\244\235\333V\256-9\230\377\313\277\366\247\335\332`|\266\033\310\264#\231\215.\276\027\237kF\232QW\346\031\331\f\017W\363\3514#\3555\343\020\226ts\357%z\351\016\346\315\354\023\255Hl\312\226\237\271\270\231\217\302\316\227\266\013\373|Y\236vY\222\013Y^X\340\235*B\203\0025\376\n\324\261\274p\357^\"e\002\366\336{wE\367\325\241z(ZG\247\331\246C\266Q<\316i@q\266U\034\216D\202#\367\336\nHW\223\364r\200\227S\264\032]\\auR4Y\353\2757\252\254^\376\240\246\322\236\0206#\034\035\265\262\315j+=\reS\005\207W\315j"
+	.ascii	"I\305\265\253\274\272\273CU\345\247\356j\217\215\216\212\t\202"
+	.ascii	"j\237\270\333y \321*\372\201\212\240\236\313\255\025#pTr~\252"
+	.ascii	"-|\033\230X\321\236\314k\245\325B\022:\2528E\232\334\2615W\253"
+	.ascii	"\227\313Z\353\321N\265t\314m\325y#3E\351\270\350\005j\255\345"
+	.ascii	"\221\255\254v\212\233\371\361TI\030\031\334\031\034)[\313jJ%"
+	.ascii	"g\350F\356^m\375\331m\225$qO\346\224\3059\272O}-\341\322\250"
+	.ascii	"\270\2124i\242\333\303\2171\322\f^:\".=!\r\017\020\205-\220\254"
+	.ascii	"\360D\245\245\244'\244\rC\026L>&\341\206\022LJ;&\341\206''\244"
+	.ascii	"'\242i\235t\364d\242\0041\310\3244\0346%\005\231\204H\303`\222"
+	.ascii	"\0231xd\300M+\224\234\202OMMN\301\323(\365\343\315\262(mR\265"
+	.ascii	"\b\240\247v\271wv\002\325*\307C\364\263Z18\353\307|enM\220"
+	.string	"\337Y\201\352\221/\265\264\350l\2441\204\307\331\013\252%X\017\321\177?z\275\246\306\370~5h\316\335\374\315\007\332\300&\336\346C\202#Kg\023\242@\234\210\317\215`;\004\254c\235\235\033}\274e\351U/\237\247v\371\300\332e\236\034O\250V9K\364^\265\262Y\257~\354Qog4\314^\025\252W\273\003\270$=\257z\371\004+\207j\t\006$\272\257Z\031\335W\351\027\231\334\024\245s\033\213\017\200\203\250a8\242\030B\312\f\215L0#I\232\016\240\002\2311c\007\021\240)E5\263 E%I\007#F\372\031*\276\341\300g\240.\333\321\342\013\214P\352\005\032\266\275S\037\236\356\213O\371F\353\263ch\027t\204o\355\005e\321P\237=\350\366\277\216\214?\222\030E=\241Cq\340\354\376\266\264\315\343\375QDT\272\245\177\200\334\203rG\013\005\270\037\023\336\001\362\037\224\270l@f%\t"
+	.string	"\021Fb\361\365\330\201\206G\324\350\253\331Fv\220\342iB\274\221\343\\\261\321\370\212v\351\224\035c!\240\267\240mo\277BxS\252|\302xHT\024*\025\237$\310~jV;\355Sx\201\333\206\227;\004b!?\347\223n\003\"\020\013\316,\0164;\356\361j\001\227T\013\333s--\3773\364\363|\334\3138$\214\342\232\345\237\325\210\017\224\223\353\026\221\332T\232c\273+]\212\327\030\304!\247\222n\200]\276\250\317\366\324"
+	.ascii	"\205\032"
+	.text
+	.section	.gnu.lto_sdftXYZPush.11.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`q\b\265,"
+	.string	"\032O\354\020E`^N:\313bfy\016r8\305\211\360k\260\364&\232\2114\215bw\203AU\323\360\232\310'\306\2635\026\343\324\215]\270r\213\311\037\251\030\250\241\311\033v\214W\212\267\024\034\316\001u\206Z\223F\b\221;\311\376"
+	.string	"\347"
+	.string	"\375"
+	.ascii	"\274\266\331P\275\300\216\202$ibB\335\272\230\254_\"\230\317"
+	.ascii	"8trw\257R\352L~\030^\301p\233\352\005\246\252\245\235\335\215"
+	.ascii	"\330\342w\371\332\331x\375\222\364\340\205\013iG\200k\034\232"
+	.ascii	"A\321p\265o\331:\027.\325\013\314@1\t\023\013\352Q\244\323~\311"
+	.ascii	"+\037\313\323\202\317\322\245z\201q\240\343rw\357\215:\312\023"
+	.ascii	"\344\200\2542\207\033\007\267\314\257r+\301\243\351\270\200{"
+	.ascii	"\225\240\201\271W\351\200\237\324\243\254|\201\364\250z\002\351"
+	.ascii	"Q\0162\313\2712yOw\205\307R\317\275\027\330K\226\226z\334?\225"
+	.ascii	"\347\263\203W{)z\266\r\362\227O:\342V<z]={_B\234|\016L\354\254"
+	.ascii	"\200w\327<\034\321\366\212<\355e\200\273E\322\025\217E\216\236"
+	.ascii	"\001\356\275A\307\257\023\2025\036\207\366\214\022\366>\335\241"
+	.ascii	"\306\342\212\307\260\333^\206{/\333\342q\310\331wf\256\302\314"
+	.ascii	"+\230U\021\001g\322\267\355\023\245\fm\036\013\365\373t?\361"
+	.ascii	"\306\332\360\370#\264y\375$\336\035"
+	.string	"\230\3562f\345\320VH\342\335q+a\216Z-C\255\226\031\254\226\237V\313N\253\345\246\3252\323jyi\265\254\264ZNZ-/X-#\255\226\217\236\346\254\340qg\243\2439\027\375\355\234\340e\316D7s\036Bp\345_\340h\377\200\317\235\205~\226\203~\226\001\374,\003\375,\257?\313?\237e\237\317\262\352\263\334\363YN\177\226Q\237\345\323Zn\325\262U-\037Bo\212\232\"\265{\205\344\365\271rh\363\311\315\374e\376\267\037\315\037\367\247\371\347\376,W\231\317|-|:^\347\274\234P\335\236\206\037w9^\311\004\307\004\233G\303\207\3435L\360\314\277\361\313\334\314\317\360\312\366%\271\026\354\022\334\272\026\226\202\2636\371cN&D5A\223@\272Y\241\035\236DM\002\3114\"\355\345\342\237]\313\227)za\206\372g~6\221j\377\303m\266\256AP[7hB\026\357\003\240\205\274\340"
+	.ascii	"5\036\267\001\371)\322\331rnK\327\006\352\363\013\261\331\340"
+	.ascii	"\277^\273\327\020\311\206y~\375\345\231\324\264\331\203&\264"
+	.ascii	"yh\227\261\317\256\021t\333\331\250\013\265\321\301\205\372x"
+	.ascii	"\322\354vX\274\253I\362Fyr\203\0135\202\376\330X\034\221\354"
+	.ascii	"\274\303\314\245:;]\007\222u\202\352\016el\216\257\227\314\024"
+	.ascii	"\262q\212t\324>\333\327\347\032\"\224^\247\255\316\371\0353\371"
+	.ascii	"g\334\202\331\354\213\314\226\036\3555\320LLh\363\\<\0163\277"
+	.ascii	"\226df\255\303\351\272Pw\357\2550\3657TG)$\323\376\232Y\223\253"
+	.ascii	"\356\206\333(\360\353T\310\320\221\036E\373K34>\033\034\\\352"
+	.ascii	"\275\367g\374\034}#Rh\363\330v\201\356>q\312y\016YV8\246N\255"
+	.ascii	"\323\260z\321V\207\020AB:\2455\243\n\006Z5\243\306\325TVz2\325"
+	.ascii	"\003\255\0300\262\2004\260\256\256\260\250\2004\254\246\256\200"
+	.ascii	"T7\262\200\017\206\030\253F\325\r\240\026\026\326\r\340\252\024"
+	.ascii	"\276\225p\007*r\302\036r\327y/\022\f\317\362//\340\016\213\332"
+	.ascii	"e\274\"\323\250n;4\250\213\212\032@\037/-n\207\305\343\363\336"
+	.ascii	"{{E\035\325\207;*\005\331\206H\006\325l\305\030\264QC=\265S3"
+	.ascii	"H\320Ob\001\234Z\313\b\263\251\331\2061\265Q7-\265R3\021\365"
+	.ascii	"R\230\252\324ZF\324\214\310\244\266\313\"\235\005m\324Im\327"
+	.ascii	"\020\245 \365Q/\350\023\311\206L\245\241F\352\276S\034\033\202"
+	.ascii	"m\220zVz\364\250\211\370\030"
+	.string	"\2216\310\007\243$\020\020M\311\277q\b\373c\304QRA\243@\346)\022\371\0333\007[\224j\262=\254\217\022\374\263\023'\322\243F}\271;\035\311\354i\266\232\333\3271\3552\376\262\001\200\260\250q@\205\224Cf\206DHR\220\024\032\003\240\002\021\252*n\0210E\307\024\r\205Ia\r\200\3128\304\330\177\376\302\205A\265\240kz\243\026\021\274P\250\352\262=\215B\212::\260\215\211\367\225\334Hs\276\327\364\002\242\t\225q\031!t\205\235\324\311\243\201\rn\346\347n\312\327\264|L\343\236\340p\372e\331BQn{B6\207A\215\364\354\225\335\330-\327\300\210da\260\330\253\212\270.-\365\260\207\244A\030\244<\266!\252\262\256\341\316\216\354\263&\271\207\032;\013\341\001\254q\355\251%5\365\323\3223X8j\273\341\030\216\330'\354\302\t\252\035r\261\302H\r\b\320,\371\002\311E\257+a\211"
+	.ascii	"-\332\354\223\300\243>#\005\023u\r\001\n\350j\331\275\037r\235"
+	.ascii	"2\353\207\350\216\353\317#\214\252\027j\231\207B\337\236\215"
+	.ascii	"\354=h\3368\335:r\255s`\f\013\223\332\247N\333\231\322Z\016\362"
+	.ascii	"\343V\006\317\336\245E\321\305,\247=r\023\r\220!W\037J(\340Q"
+	.ascii	"7\374d\034\371H[d\342A\267G\221\033Z\003\2642x=+pH8\360m\235"
+	.ascii	"\346\031\340;4\322\002J=9\247\311\217w}^\030\300\354kE\214\251"
+	.ascii	")cw\337m\375S\351\320\375\017"
+	.text
+	.section	.gnu.lto_sdftXYZPushBatch.12.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375``\013\3259"
+	.string	"\312e\340\025BPdN:\213\036&)|\243:\214[\257e\324#S\007"
+	.string	"\353LJ\302"
+	.ascii	"\231aT_\245,\355\023@(\234l#@\025\217\361\017\211\241\206\354"
+	.ascii	"\022\376\352\277]\344\251O\307\020\337\210%j\215\020\271\223"
+	.ascii	"\fS\001,\001L\001t\272T12'#hY\274\324\257\313\331\361VI\2662"
+	.ascii	"\223Z\002\333\226\215\353u|;f\341p]\233\032\216/\376\334\351"
+	.ascii	"\376\206Y7\317\2556a\007\306\220Zf\362\n\027\030\352\323\257"
+	.ascii	"\313\205\251bd\003\226hXV\250O\373i\276\346l\230\205\373\361"
+	.ascii	"\266\327GB\r\327\251bd\352\0314\277\016\352S\376\231\277\035"
+	.ascii	"\217\246\207*F\366a\0170\260m\333\251\247\214\001\257X\346m\307"
+	.ascii	"\233\371\201\"\265chL\346\332v\254\212#\250O\017\240\227\rH\237"
+	.ascii	"\252_\346\213\371\230\343\327\202<\251m\251\254\231k[\266*f\240"
+	.ascii	">e\266/\t\237\252W\022>\345#s\237\263=\333\357\335\rq3\324\266"
+	.ascii	"\255\261\255@A\025\207\334G\331\316(z\274Q\221%\256\352Px\224"
+	.ascii	"\242}\217|\004\317;\3132\261\033\241C!G\264\\\217\f\n\212%\030"
+	.ascii	"H\367='\267X\305\354\311\331\275'P\3532\305\354\311\211\353\024"
+	.ascii	"\263\346U\024I\217\214\t\240\362\016\211]\316.T\317~\204J9\353"
+	.ascii	"$\271\036Y\023t)\017m\317\331\374\311\013\231\363\246(R\333\266"
+	.ascii	"GeB\320\006\227Y\226\274h\227$\357\373]\312\251gY\226\344w\270"
+	.ascii	"\241m[\276\3132\2633\2003\377\212\231}0\023\253\004\201s\315"
+	.ascii	"\007\372\375\324W\244\364\222d\255\367\341:\265m\333+>\237\r"
+	.ascii	"[\252Z\020\341\323\367*&(\314\032\362\0162\263%o\2471\037\353"
+	.ascii	")\030\310M\205\031C\361\362\205\342e\013\305\313\025\212\227"
+	.ascii	")\024/c\025/O(^\276*^\226P\274\034\241x\031B\361\362\203\342"
+	.ascii	"e\007\307snp\276\263\361zg\253\337\235\253~\347L"
+	.string	"u\274\363\224T\324\331~\005P\b\016w~\272\231\377\300\327~\247\377\235\233\336wf\272\232s\201\3652\201\365\362\200\365\362\322zY\300zYi\275\034\200\275\234\264^F\272\227\001\020/\037\021/\033\255\227\213\353e\226\275Ld/\257\354e\225\275<\\/\013\331\313\351\275\214\022/7\361\362]/\237\003qI\236\201\301\266=2\230\250\305K\351\266\034\357\277\363\337\375z?\337\217\347\377\373\373~4\277\232\037\356,\363\001\325\264\035z\034\337\217\331\276=`\252\235\343\341\363=\017\263u\216s\216q\256\307\337c\326\356\370\272\337\361\357\034\357y\314\276q\363\244;\316\035\277\036\307(\334\300\264m\313\306\341\317y\035f\003M\240\241\372\326)\235\003\232@\247\212\224\316\247^\352\001\215\326)\271$W\\\346R\017\313\026\035\022\320D\270\356\350\332Y\002B\2429\327\t\225Z@\243|\224tT\017\320J\215\272e]e"
+	.string	")\213\324Nc\026\2130\252S,GSoj\352[\205\341\340\316\364\206M\035\325\377\022E.I\304\035c\271\005}0n\262\207\201\347E\n\350K\371\226\200d\204%\265\220\217\331\034Dj'\277\265\243V\320"
+	.ascii	"\356\347F}\324\324F}\300\247q\242\330Q\bS\346'\3544\376\225\220"
+	.ascii	"\b1tT\354\031m~cW\220\255\316v\261\321AJg\262\305\025\261}6\217"
+	.ascii	"*K\224v\032\257\177-\325\375w\247\316\324\314\2523\365\t\265"
+	.ascii	"\375\215]\301\347\241\001\262\241Tgj\251\376\023\247\036\245"
+	.ascii	"\223\330iX\016\300\345\263\004\264v\332\304F\371\224\\\324\036"
+	.ascii	"\366z\350\202,\307Wc\027\034w\277\344\2706^a\202\274\203$^\210"
+	.ascii	"\345\016\367df\257\023\352\221\241\257m[\254\027\037\024\343"
+	.ascii	"\351\325s\330\207\273B\207\314z a\337\355\312\032\362\177x\204"
+	.ascii	"\361\201\b\237\246}f\263[A\243}\345\027\364LGx\273\373L}\373"
+	.ascii	"~G\005\235~\206,B\336\301\376S0_7|d\241`\347\2721\243o\274\201"
+	.ascii	"\203\007B0\257,\260\024D\032\\\036\262\300pl\321H}\320\baC\013"
+	.ascii	",k\206\272\205CG\216\254/!\312ZV`5h|\031\271\272r\344\350\322"
+	.ascii	"2r\335\310\312a\324\362\3722Z1q\227\216-/#XW\227\227\221eC\376"
+	.ascii	"\f\017\331I\356\201\266\355\024\rG\363\263yR`\031\243Nc\266\311"
+	.ascii	"b\350\376#>\265U3\255\272@_\260\355\016m\333\266-Z5\206\376\336"
+	.ascii	"S/M=J\347\205\346\233f\241\215}\241BSh\013U]!\r\211B\2039\221"
+	.ascii	"\303j\276R&\264\261\261\256ZBO\240\352+)\252\204\006s\362\306"
+	.ascii	"lF\350\353\266\004\004\241\215\035\241/\237\322\313\203v\320"
+	.ascii	"\020\372JgR.\301T?\350\036\264|\222\204rt\226\340\035\302\247"
+	.ascii	"\016\272\t\021\263y\235x0\360l\202X\360\374\035\207\270MF8=\033"
+	.ascii	"4\213f\241\345\022\344\035\363q\312=+\261\200\257\222\273\304"
+	.ascii	"\004\363\211\024)"
+	.string	"\204O\215\375<\217*\203s\210\016\331ovB\312\330Nc\r\204V\004\353\223\314\235\n\325\005\232\311\314\327\354\"Q\253\032E\323\356\036\271d(U\243h\3121\233\267H\030_\355qO\243bH7\325\317;J\327|c6\211o\004\355\204H\351L*P\"\310\320\372\024\200\343\250\201,\246\024C\b\t\215L\320$)d8\240\002\221)+n\021P=d6\232$\205j5\200\313jM\342\355'\244\367?\203\202\313\240\256#\263w\313\232\345\234L\323\207@\330\300I\262\266\030\364\313\033iw\204Y\330\260\237\274M\2433\310;\3048N\270T\254\214\374\r\202C|o\304\202\021\234\230\r\212\003^&\340\345R\310\272Pr\016\255$\351\326)\204\b[\371\3604\276\214\\*\244\0335\370\253\273h\230$\2111Ye\342\242\305\342\360=)?\353u(9sk\200U\307\320{)[\fu\343\027\214\232\352\200\334"
+	.string	"v\005\376\243\253@_\237\320\277\313\235\240\022l$\220\377'\207\263\354\304M#c\030\275K\360\032\005\247"
+	.string	"\003\220\232V\035\276\254<\355\370\364\202\251\271%\355\017hy1)\226\306]\233Xgp\027\320\r\245\3008w\377\016\246Dd\021\035\364\030\264=\366\375:\260i\034\237\013\331(\235\350CxA\246\177c\024\205\356d\230M\330aRSiG\353\347#\270`F\223\035.\203\005.\305\241\364\020\204a\345\023c\021(\332\215\221\253\007\271r\234\276\372\213\031gtl\024&\"\247\372\022N\220d/f|\345\210\341\n\313\bHH\307\205\274 \332\234\017\r\371\340i"
+	.ascii	"\230*\363\374Dn\261W\310C\327\023\366;\312ulP8\336h\0029\212"
+	.ascii	"\307F\f\032\022\236\304U\261\244\341\tP\326\235\237\nH0\031\212"
+	.ascii	"\226\223\202\346\006\340\317\215\357\265\257\230`{\341\211\256"
+	.ascii	"\360R$\227;\225\"x\336=`\224\242\300\n\352&!O0\201v\260Z\214"
+	.ascii	"\232x\337\243;H\247\002"
+	.text
+	.section	.gnu.lto_sdftXYZWinSq.13.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`\020\004\265\033"
+	.string	"\206t\263J\260\226Q:4Gk\0075W\016I\263\304\340\305W+d\021\\\330\367&$\316\355i/\234\314j\212{\036\335\267S?wy0\351\275\376\372\305\013xW\370w\202\264k\f\0320\024\033\221\204~\255\273\330\216 \237\020\"wJ\001\236"
+	.string	"\224"
+	.string	"\241"
+	.ascii	"6>\343\214\254Z\353\203\227\256`\357\222\2071X\355\021\371E\240"
+	.ascii	"\301\017\321]i\205_j\245\201\025Uk/\3079\347\313\003\344\251"
+	.ascii	"\375 \027\242{\022\213\003\250\325H\030Uk0\307\f\316\227\016"
+	.ascii	"\276\306|y>\200\371\322:\233\312\203G\365F\030BE\260\324Zek\303"
+	.ascii	"\n^\307\343\261\313\311\340MR\335Kr\251\316\207:\002\034Q~\300"
+	.ascii	"\335K\262\025\324B\307\f0\210\334\321\222%\365\341\351\020\020"
+	.ascii	"\210\222=^|?\274\203\033W~\300\027\247\255\f\265V\323\037\320"
+	.ascii	"\305m\3366\316\366\006\233\344\020;\2725\354\357\034i\311\362"
+	.ascii	"\032\331_\372q\316t\307\356t\337\374\351\266\271\322_C\363\244"
+	.ascii	"?\300\2057\254\244~\265\250g\226Z\346\244\2169\251]-j\230\026"
+	.ascii	"\365\213I}\232\324-\223\332,\251K\223\232,\251\327\244\246%\365"
+	.ascii	"\007\300TAi@\254\265\305qK\275*\245v\\\3703\375N\377\323I\373"
+	.ascii	"\366\217\370C\273\204.\236;\242\263\251H\221\206\363\345\337"
+	.ascii	"t#\207\262\313\366S\212sGd@\310\030#\213\307\311\304\003=X\035"
+	.ascii	"\n\222\301\003\203\315d\342\271#\n\265Z\270\331U\232\372\241"
+	.ascii	"\344\\\2726{,\037\217?\371\225\227\350\002\023_m\262V^\202\227"
+	.ascii	"&\332\246\t^\266\366\334\262\350C2\227\334\326\306\260\232\314"
+	.ascii	"n\225\273\025\355SL.4\367V\020\016\333r\005\030\227\314xT\274"
+	.ascii	"\212F\201J\002\317\r)\235\303v\267U\264\207\027g\005\216l\203"
+	.ascii	"\370\024\215\200\224Z{;#\236\244\366\262F\n\335\226\0221\213"
+	.ascii	"\024\217\036\327\301\335\267\211*\b\270\206\360/\315\336\212"
+	.ascii	"\257\b\310$\216d\305Yko\202\037\365\301v\346`a\276\374~\370\005"
+	.ascii	"U\210?\222x\364h\007\003\265\227\350A\2614\034\265\325h\356\204"
+	.ascii	"O\356\304\315\374\251\251\350!I\317tr\"B\374\310L\334l\266\333"
+	.ascii	"L"
+	.string	"f\242\326c\223\315p?2\035\034\337|h8Y\356v\303\311\\\301\3725\362\241~>-\271\342-P\2715\374\002\262\345\356\024J\263\260\035\202\355k\351\024\"NzT\213\355\236Gy\255\f\357$9\263\2761\204\211/\337C\363%m\362\253\002\263/;\263\213\345+\212Y\234\225\331\373|\2207\023\323\2651{\330\272\366\\\204\272\3046\2660K\026}H7{\263/\353\203\203\312\207\004t!\226\245\212\327\301\304\327Q\rH\250!$G1C\210BN\215D%\025\026\266\030\200\002\221\252\253\016\021\300!T9\2414\233\001\037PZ\367\342\312\213\347\210\355B\333z\310\366D\334{\233\3700o\312,:\003\261\201`Xn\212\204\262\247JxK\331b\374W\363\363\244\307\2205\n:\221j\372\207~\227f\226\337\231\003#\361\203\350\200\240(N\254\210\233\200\251\302B\303z\342\235C\311e\337\023\030\220,\345p"
+	.ascii	"\374pq\005W\246\203\316\362\374\233#R\223Id\t\317#\003*kR\242"
+	.ascii	"\003,\030d\323\214.\204\204&1\211\232\322\027\247\363u*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375 \366\245\004"
+	.string	"\004\007\362"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b\177\024\360\370\322\033\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\006\025\200\204\001"
+	.string	""
+	.string	"\003\005\005\026\007\027\002\t\177\030\210\312\343\001\272\200\202\002\013\177\031\360\372\2508\f\177\032\r\177\033\001\017\177\034\377\037"
+	.string	""
+	.string	"\200\200\200\001\016\177\035\003"
+	.string	"\t\311\303\226\362\003\001\304\001\003"
+	.string	"\b\204\006\244\006\003\004"
+	.string	"\210\312\343\001\001\""
+	.string	"\016"
+	.ascii	"\240`.\203\362)2\"S\022\013\206\313\036H\034\240\256\363Yx\343"
+	.ascii	"\204E\256z\034`,f\245\f"
+	.text
+	.section	.gnu.lto_.refs.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\003"
+	.string	"\001\003\r"
+	.string	"\001\001\021"
+	.string	"\002\005"
+	.string	"\002\007"
+	.string	""
+	.string	"\003\030"
+	.string	"\002\006"
+	.string	"\002\t"
+	.string	""
+	.string	"\003)"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b80e017c27633989,"e",@progbits
+	.string	"(\265/\375`\210\016\365F"
+	.string	"*z\220\032BP^N:s\304\370\034\330\364\337]\270\3175\335\035b8\3636P\307?,\373\244\035qg\215\255j\r\370\366\240\324\233\365?\024\207\221\236\220'\004\360\020\006u\034[\214"
+	.string	"\325\266m\240\215lJ\354\226)Z\001\234\001\233\001rw\201M\b\357z<V\"\032\3219\235\337\254y\203U\350\256\267\215\323\331\315\020L\231Cww=\032\r\354\221\223\210OD<N\"\022\0019\211\310\200\225\3220\334UK\322\304\316]\317p?\233\3413\374v\247\335W\335]\340n5i\363\253\236\312nr\020\332I\330\335JDzuaT\356z&\366\214\346\003\310z\303Yv@\263\022\361N9\211\310e\234\316\324$b\364\253m\001\306,\350\240\350]\0370\231S\005"
+	.ascii	"z\201Y\335\365\347\266\237\303\260\030f\033B\213L\273\332\335"
+	.ascii	"\"\025\303\274)\253\336\225\331.\257q{f\3431\307\260\341FW-\246"
+	.ascii	"\273e\266\265\373\311\334\340\210\271\001\021\235\331\263\fq"
+	.ascii	"\375e\337\262\022\221\345$\"\217`\022n?\376\367\205\337\037\214"
+	.ascii	"k\342g\02158\304\023\374\227\003\236\377z\376\363\375\217\363"
+	.ascii	"\277\357\177\335\377\277\377}\376\373\375\347\363?\017_\346\300"
+	.ascii	"OW\372o\005\n\027L\b\370o\323\317\025~\226\360s\203\237\021\374"
+	.ascii	"L\340g\343\317\305\237\211~\036\376?\364\237\360\277\340\377"
+	.ascii	"\300\377n\377\337\376\263\370\277\366\037\306\177C\377\005\375"
+	.ascii	"\017\364\177\360?\240\377~\376\277\370\017\367\277\355\377\212"
+	.ascii	"\377\355\177\005\377\347\374'\026\026\026\026\3767\352g\260\037"
+	.ascii	"@\220\320+2)\222\222)P\bi\201!c\306y\320\2536\262%\366\214\036"
+	.ascii	"\361\240\355\264\373\272\271\212\325Q\007\335b\323h\337S\t\257"
+	.ascii	"\261\3023b\225\3469\345\266\273\rlY\225M\373\n\017\2326\355N"
+	.ascii	"\263\232\352-\r\316\026\257\2510\236\363\211X\027\301\352>\320"
+	.ascii	"m\367V\267\223\033\257\273\235\335]\214\212\265\335aG\350\331"
+	.ascii	"\326V\367\327\322V\2139\347\260\272o\325o\215\024J-\233:\315"
+	.ascii	"\235\241\236uV\353\344\263\356#\213\262Tg[\027\371\303\236I\221"
+	.ascii	"\370i3\326\361\312\342\273+\023\342B\\=\035\0332^\265-\365\310"
+	.ascii	"\216\017O_\025\366G\221O7H\320\321\033\275+\335\262fYz\216\360"
+	.ascii	"\355\346\221i\375\tTW\\\333\002\203\016\002*\002K\"$N\216\005"
+	.ascii	"\277\222\231\266\035\215\374\004\343\252O\330\237\377\370!N\275"
+	.ascii	"t\234\273\006.\261\023>1\256\273\236\303\330g\240C\347,\356\256"
+	.ascii	"\356,N\2359{8\017\0032\037\326\303}\330\217\253\374\307yg=\266"
+	.ascii	"\363\265\355\276Rs\207\373\030\257\272\256\331\211\261;\335\221"
+	.ascii	"\261\233L\316Y\206\337\351\3479\034\307\177\214w:\306\253\236"
+	.ascii	"@\213\003\330\335\347\270\237\347\376\230\r\313I\240\325\375"
+	.ascii	"\\R\200\214\232U\307\304\304\264\304\304\304\304D\254\242f\205"
+	.ascii	"\311\261\217o-2\246G\213\357\347=\306\303oC6C\346\344\335\225"
+	.ascii	"\227\226\354\377\246\254D\f\340F\212=\222\375\f\366.\330\243"
+	.ascii	"`\377\201]Y\316\317r\274\206\353\212`\340\244\021\272\353\271"
+	.ascii	"\356g8\034\347\001P8vm\221\035\233\264Aw\275ONG\334\243\343W"
+	.ascii	"\347jX-o\264\272\264L\230\334\261c[\331\261;[\323p\351\365\231"
+	.ascii	"\376\216\261\034>hD\356z\235\334\2564.i\336]o\023\036\f\240\347"
+	.ascii	"\355n\356tk\222\2710u\262|}\335% \354\260\001V\030K\022\030\366"
+	.ascii	"\273dp\314\231\225\273^0F\223\243f\f\017\n\316\251\331\335\365"
+	.ascii	"\267\214\310\211\\/\376\352\341\036\277\257\bGt]d\006%\371\365"
+	.ascii	"223;\003\350\256Wz\273\216\274xq\241\335\256\213\204\2500\220"
+	.ascii	"\017J 1oH\033\302\273\036\341<#\232\2240\261\273^\256\033]\355"
+	.ascii	"\304\364\270\334\255kd\215\334\336\032\240[\344\277\221(H*f\247"
+	.ascii	"\327.X{\\\356\372\253D\253z\265\030.E\333N\030n\321\t\277\\Y"
+	.ascii	"\347\352\315\272\334\332\366\225\017l\321\236\360\233\305\376"
+	.ascii	"W\bW\257\020f[\002\021V\005\354h;\341,\210\375\355\353\374}\376"
+	.ascii	"\367y\255\330\266\271<\300\0319D\330_\321\b\327\352\307\260\341"
+	.ascii	"|\214\272\305tw\002\"\2754,om\330\337\237\330\317hw\037!j;j"
+	.string	"et&b\216\360\007\340!;\370\277\366\260\257[l\212 \273E\356\271\344\256\377\031\364\325\272\235H\335v\024J%sB\315\350I\221\332\036+\320\324'\rm\311\244\353\264o\267\315}E&\345\001m\247Qh;u\036\373j\352\354n\245Gh\365\351d(\225L\n\245N\245H}\325\316\246>\307\330\253\251\024Jg*=B\251OiLe\262\204T\023\031\265#\006\2222\211\254j2\225K(#s\tU\364)\013\314\251&\222\352\300\217e\325\216\035H\033\312$\263\210\307\013eR\206\321q\212\331\243\005\200f\221E\225\224\217e\213\252b\224\024\220\244\016d\262\231T\252`&\003\034JJGTT\322\007\214fR\231\004p\250d\225\224R*\007{\rO\025\236:\374(\276\203\207\013\036.\020\337\301\203\223\223\207''\366ON\303\24629l\"\227:p\0205?e\340\313\035RUM\315\345\262\252\t"
+	.string	"\262\211\214Z\2316j\320\230a\374\021\225\034*\223%\232U\310&\223U&KD)\245\210R@\222/n\030\231RSPMd\t\252\036\312\"&\222Yl\332\370!\245c\007\325\022\312x''\023\fb\260@\301BYh\342\210b6)\227TTK\250&e\022I\325\004U\305l\262\260\244c\271,a\203\350\267\rH\340\333U\241"
+	.string	"\255%yYZ\346\273su\264\320\371\362\345\256\261\305\262&w\314\357\032\237\241\241\2721?w\275bn\327\315\323\005\356\356\2567\f\017.\230\n\271r\327\013f\bU\263Z\335\300\246\224\335\025\r\355v1:\213\366\276x\001\022\366WW\204\377r\371\355BG\204\265GP\357\2567\355t,!7\266;w\275[NW\234cW\346\344\220\226k\346V\030\270\347\256Y\262\\3>\266V{Zg\254\263\255+\355\017{\255X\271fK\323\341\036\324\013P\255\373+\002\r2X\374\\\3715\223C\343\227\327F\216\271\250\371\362\026WVv\251\354}\235\005X3\003\007h\312/\025"
+	.string	"i\236\334\341\271\353\205r\245\254[\207\264\356\244D\001\f\201\032\250\261$g\224DDdHDD\222$I\007A\005\204\030g-\264\r\022\30051P2fFFD$IR\243Fc\213"
+	.string	"%[\366\374~f\317/\027 <\3210W\033\020n\200\023\213\026\036g<\356\206\346\200L\343DVn\372^i\277\2601X\352W\352\232{\332p\f\263\322\177JE1g\313\212\332\213\210\320.\006\226\202\370Z\004/l\001\254\302\370\270k\302Y\354n\315\\c\267\262\261)\262v\032\257\362\006L\351Pr\357%n\237&4\237\006\275\251M$k\360\232\344k\301[T1\363\332\230\332\375$.\331$\033\264Cuc@x\033\246\003\374\230-\260\203Xxj\252$\241\222\231\327\215\357@\304\331y\272\304#\237\226\316x\334ho\231\302\364\333\326\267\341\3350\274\330\300\364\270\2105\334M\205"
+	.ascii	"\265or\374[\355\221k\207\200}&\311\344>w\265G\250\207D\330\305"
+	.ascii	"\205\"\026\023&n\034\264\275\036\252w\277\273X\326\274\323\264"
+	.ascii	"\220\231\013\361l\374\225\2458\3627}\223j"
+	.string	"\222s2\245\022\330C\026%@\352\322\360\315Ig\346VZh\230\006\200\202\317\016\216\205\242q\003\266\256\263\317\344dO5\372\360\205\304\253_c\022wA!)\225_`*\220\302\254|90\222\266R\021\335&,\300\214[\373\206\350D_"
+	.string	"\346\017\265u\251\227\n\r\037\231\037\027f\320\003\304\376\360\245D\373A2\031\177\251\017:\353\342\304\354\2012\203\356w\376ls\033%$\217T=6p\031\217\360\256\221=\247\257\310\273\364H\205<\224\263\204\021\021\333m\311!t \305\0049S\254R\030O^"
+	.string	"\272\204\020\355\035\314m\200\364\202\354"
+	.ascii	"\307ch\253|\037\3307\006\330\315\2312\202\274\375\353\274R&\003"
+	.ascii	"\336||\006\nj60\346\377\337n\260\223f<\334\344\207=\327\037\037"
+	.ascii	"S\216\237\273\017\0262}\022^\323pq\263\2310\314\317\335p\276"
+	.ascii	"\177\313\362\304\024\177\024\236\355\303\223\030\017\302W\343"
+	.ascii	"Iwc\360\004\361\237_\310\350\3056\350\0215 \231\374\\\227\235"
+	.ascii	"\371E\006\323\253\002"
+	.text
+	.section	.gnu.lto_.symtab.b80e017c27633989,"e",@progbits
+	.string	"sdftXYZInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"sdftXYZPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"sdftXYZPushBatch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"sdftXYZWinSq"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b80e017c27633989,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,277 @@
+	.file	"sensor_alignment.c"
+	.section	.gnu.lto_.profile.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 Cu\001"
+	.string	"\024\0027"
+	.string	"\003"
+	.string	"\373\355\275\203\005\002\002"
+	.string	"\002"
+	.string	"\001\374\314\370\214\017\016\002\001\002\001\002\316\304\261\210\017"
+	.string	""
+	.string	"\004"
+	.ascii	" \200\025\004\20006\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 \\-\002"
+	.string	"\364\002P"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\002\003\002\003\002\001"
+	.string	"\002\001\002\004\002\001\020\006\006"
+	.string	"\020"
+	.string	"\007\001\001\201\004"
+	.string	""
+	.string	"\001\002\002\002\001\200\001"
+	.string	""
+	.string	"\t"
+	.string	"\b"
+	.string	"5cf\036\250i\374\251\346U\020\263\330\0042\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\325\004"
+	.string	"\242\b\032 \220)\351\357\213\244\315\244D\200\217G4\237\327>\213\027\273\273\b\277\266\264\375\376\"\262\215\354\275S\277\332\2539\332:\317HHeB\031\214\257\366L*\225\022\232-#\032\025x\370,\333\026\220N\250\361\316\263\221\221\266\006\346\376~5\002\372\005>m\005\343\310\362i\235\3007\370h{\310\037\341\335}MJ\332\">\277B\024"
+	.string	"C\030"
+	.ascii	"\016\260\3071N\263\364D\020\322\204\003\233\201-`\337\234\035"
+	.ascii	"\"n\276Y\314\302\"Xn\202|+\303\244\204P*\\\020\025v\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 \252\335\002"
+	.string	"b\205\017\030\260%\351\f3\rp\311q(\235\347&IB\034\310\031J\354&\233L2\333\250\252zj/\236Si2O\206/\300u \361|\346\r\206\333\200\271\021[v\313{\324)i\244\361\2340A\n"
+	.ascii	"H(\006\360\302qiT\220\213\351\223!,\005\302h^\t\231\204l\240"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.pureconst.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 X\r\002"
+	.string	"\324\002F"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\003"
+	.string	"\002\270\001\002\007"
+	.string	"\001"
+	.string	""
+	.string	"\020\177"
+	.string	"\260\204\200\370\267\004\001\002\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002\b0\002"
+	.string	"\0051cO3"
+	.string	"\007"
+	.ascii	"\270B\233\301@]\033\214\266\033\343%\223\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.8a99c3fdc0e33beb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_buildRotationMatrixFromAlignment.5.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375`I\002\215\020"
+	.string	"\026\037mE\360\320&\035\350\030\370\355\246\2618/\2275Ifi\321\221\207\225B\243\202\233\332>!\013v\267\300ke\200xj\342\031\201\277\216{+?j\360D\354?k=\b#f\346\307\004h\236\354\241k\322\310\336R\246\024Y"
+	.string	"R"
+	.string	"\\"
+	.ascii	"8)pu\340\317N\320\256\206\003\217f\340\362\310\226\205\236"
+	.string	"\005O\373%nb\365\032\025R\200u\271\301\240b\267\205\300\t\262G\267>\302\036\263\017\300\036\275\262\201H/\036'.|6vWS\020_=W\376\277\213X1+\317\220\202\335u\262b6\334z\333 \266\033\330\371\005\327\251\220\355\272\210\344HHe\"T\260\307\353\311\fM\rK\276\354\326J\352\214}\270\273k\225\261\337\372?^\363w\304\264(\2463\230\016\3054\026\323\021\246aLkL'L_\200\250\006\201\234\335\f/\034\353\212?#\216\363\333\377\347\016\337\3467\253\007jGx\013\315\221\251(\244\231\222xJ\316bEH'|\240\301\324.\375\207'*\0065*i\206\351>=PQfn\250\332\247\247\260O\201\020\266\311?\324H\306\356\212<\302\217E\303\3471^\300\330\365\310\353\005\344\262\313\002\222\252z\030\022-\371\3625\225\344\002&\310'\337\331\354.\251\023\212\tG\302u(UI\325y"
+	.ascii	"6/I>l\nQq\247\2153A\241\224J\274.\305\235R\032\327m[g\3228Ti"
+	.ascii	"\323L^J\0131\340\216\302\311\323T]\347i\035\255=\\\225q\354\340"
+	.ascii	"b\321\026\247\300]\017#A6\371\362(?\364(\3769`\331\017 \344Y"
+	.ascii	"\036qp\275\350\212E\001) \340\202\031\242q\003v\"\346j\340<\264"
+	.ascii	"\343\030Zd|\f2TFW\243`\356\370\2127\341\313\353\255\251\357;"
+	.ascii	"x\345\033\303\267`\257\027\335\336a\2058\262sq\016k\323N\361"
+	.ascii	"pA\025\214\233ha)\347\030B_\0066\230P;\346ch\333\304x\003\324"
+	.ascii	"J\254\341\205\340\311"
+	.text
+	.section	.gnu.lto_buildAlignmentFromStandardAlignment.6.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"\225\013"
+	.string	"V\025M>\020Q\234\016<\226\341\232#\324\224\007*\004\200@\020oC\205\"3\"S\"k0\255}\321\023\362\377!\246\271A\345\340#\001\200\002\n\267F(\b\256\376\250)\312\375\260w\032\354\266\245L)<"
+	.string	"="
+	.string	"7"
+	.string	"\2247\333#\001H@\212n#\306\356Z:b\313\355Ps\363\003x\334a%\272B\005#\0202\bx\0368Q\321\321\375\364\344\340}2\001Xv\327\031\362<\334\324m?\260\035\301~\203\351C\006\300\220\260\330\355\360Ac;(\016\022\266\037\261\235\337Ol7u\240\201\375\204 A\250NM\340\323\276\211\223\266\2274\374\300\356\250\006\212\335o\201\031T\247\374]\022OUG\020\037\352\fQu\302\351\305'g8\365\252\nWt\"\247\306\r\310;1\352\365\247SJ\264\3508<\371a\177\\\252\b\373\t\362p\361\301:\262_\372\253\233\376\250i\325tj\020\007\005\214\251p\260\314\205Q\320T\270H\320\262\r\226\331XXv]\031\306\3024\227\313\302h\033\253Bqf!\243Y\234,\323\254\310\267\267lP\017\214\031\265R\373\002\206|\310\224r\337].\030"
+	.ascii	"@\025\261I\356\334\034(3 \f[L\330\254\201\350\2607Qm\201\324"
+	.ascii	"\024q\013L0\210;\363\2227GK\327\200b\030\r\204\317\324(\270,"
+	.ascii	"M\215\006w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_buildAlignmentFromStandardAlignment.part.0.9.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375`L\003\215\030"
+	.string	"&0\240G\320VM:\325+\240\261\013\326\022L\235O\021\235\270cA#\305F8X\004G\201\362\312M\356b\360\3555&,\316{\240\355\201\202l\323\003\374\321,\0028\034\365\246\2167\f\334\f'\275\275\231\2315b\367&r\247\024\210"
+	.string	"\206"
+	.string	"\213"
+	.string	"\307a{\016\020\235kyP\320\230\340]\302t1>\254\335F\216K\270$|\034\243}\032\257a\273\215\234\257\354\246`\372\261\033\312\\z\201w\351\360"
+	.string	"\346\245\367\226yi_\206\355\232\315\344\341\212\365\261\315f\342\022b5\004\024\222\262\273\257KUa}\027\336]\264]v\032\247\315\307\351\\v\256\335m\341Bt\tD\340vb\027{^\374\\\177\364\030\004I\017\356\347\221\345\363\004aw\355\225\270O\267\355\301\366\005[5\004f9E\257\234\242]3ZeF\267f4kF\257f\264\352FwjF\243\036\376\336\213\356\223\214\2362Z\312\350NF\253\214\216\027\372\357\362\227\245\335\021MK{B\002i\361\242\337\350\321\276\337\343<\374#\243\232ax\326\207\221\272%\2320C\211\223\335\255\340\r\335\037\252\371;\254\262\375\"+`P;\021\3150:\341\216\360Q\300\300v\"Z\267@\017b$q\262\033\306\\\232\202w\251\272\214\027\252\205\213\323\033\001\267\226\252\350"
+	.ascii	"(_\216\245(m\251K\022\b\264R\231\2634@\221o)\310U\272\322\027"
+	.ascii	"\246\017FJ\343\2154U*\200\351sqR\224\376\350\335\013\035M\300"
+	.ascii	"\334MwWG5\310\266*\316\233\310\214\271\247\266\006X|\217\001"
+	.ascii	" \031\371T\307S;=\351\227\200?\336iS\352\324\203@\277\201\251"
+	.ascii	"*\365%\351[\322\323\246j\2473\t\004j:mFU\375gb'6\371\032\365"
+	.ascii	";\036Sb\b\314\335bS\324 \353\374j\n\273\305\213\0013\233\017"
+	.ascii	"3\335\f\307F\002\013\025A\3054\bpb5\260\030\006\233\r3\026nd"
+	.ascii	"\263X\315\354\025\223\301`2\232W\314f\006\366\242\271\231\275"
+	.ascii	"\020\024\260\214C\315\315\013G&\273y\305C\270\351\216\365\227"
+	.ascii	"\032d\224\222\266\250*\305\230\247T\204\314S\372(8\224x\342\024"
+	.ascii	"\353\273\335\335\356\300S\332\242\250#H>\023,j;\303\211\314\020"
+	.ascii	"H\262\273\016l\232\017\251\031\260bw\033\b\211a\360Y\\\3729\363"
+	.ascii	"\362=OV\224E\017\346n<\3570]\272\242\377`\250\250K\273$0\027"
+	.ascii	"? p\002\231cW\007\255\bH9\2230\2717\273OA\356\034\253\"\020\004"
+	.ascii	"\277`,\032\022\254\332\371\245\267\2610\240j1\335fo\362\3311"
+	.ascii	"\334\016\262\020\216 \304\370\222C\375\342\212p\233\031\235Q"
+	.ascii	"\307\226}\217Q\0307&\327R\213\260\2144\212}\275k\036\303\367"
+	.ascii	"`\004\215\322\247\017\334r\254%-W\276\020ra\025\305\355\b\267"
+	.ascii	"\023\251\035\347b\370\005\244\277\314xr~\207\227\006\250\005"
+	.ascii	"\2561\212/\264\303\022\242\332\254\217\247\214\235\177m\030\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 \247e\003"
+	.string	"\222\005\024\037\240\031\322\001\217\301\375\345\337\006\370\332\307\333\332\023k\377\377\377\017\030\346\326\366\244\374\226\354-S\323A\266M\\v 4\206F\ni\233\341\016\333\376\341R8\001ka\2514\b\027\250T\211\031\034\240~DSRD\376~\302 \333\026\035\252\377G\n"
+	.ascii	"\2560h\b\206\317\"V\231FA0\\\366@\307\2356\001\261u0\311"
+	.text
+	.section	.gnu.lto_.refs.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8a99c3fdc0e33beb,"e",@progbits
+	.string	"(\265/\375`9\r\255D"
+	.string	"\312yp\032DP^N:\373\246\321\017\270G\337\315\344\341\207Sq\213#:\034\f\353\374\343*\273\366\260\326\rm\213\217\200\3321\031y\261tV8\254\206\255\311!-i\001\206\240\357k\001\"\214\273A\232Z\230L\206\264-S_\001\237\001\225\001g\276\210\3612\323\016\365\341!3\346\252?\233\3412A&\027\264=Z\273\354y\201\271*\235R\020\213\235\035\224\253\236\275\3301,\206\245L\206\337\316rB\245Q\367\022:|dx\215\273\360\224LM\323\343\353n%&\246\365\254\017\316\271\252g.`\346\304\361\034\303\261\224\345~\333\356%{\371\302nB\240n\350\236Yw\277\302\377t\226\3430\354v\340F7\264\314"
+	.ascii	"\2339[\376\374\272\233)\211\211\351\230e\354\217U\257\202\275"
+	.ascii	"\t\366%\330\004\034\330s\227\237\261p\026vch\367\262\273\013"
+	.ascii	"\004\361\030\3036wUnc-,U\342-\347\226\271\034H\331v\313w\310"
+	.ascii	"\262\234W5\342\001\353-\260\347\350\t\264\351\013_\331\032\335"
+	.ascii	"\201\201\254\264r\373tf\373\371\n\253!\255\315g\333n\335]\024"
+	.ascii	"\214\243\323\362s\325{\331\t<`][\036\260\262\214\264\376\347"
+	.ascii	"\362\177\356\277\0333\330\300\032\376\243\370\177\340g\fG?\257"
+	.ascii	"\\\341\347\247\007\375\267\350g\bM\377\331\374\207\373?\375/"
+	.ascii	"\367\277\315\1778\377\335\374\017#\346g\t%\376'\375\377;\201"
+	.ascii	"\377:\3709\302\317\r~\016\372Y\300\317\354\1773\377\351\376\373"
+	.ascii	"\371\317\347\177\235\377q\376\353\375?\363\277\314\177\341\377"
+	.ascii	"\272\377j```\340\317F\377\205\372\001\334\005\311\356\326i\304"
+	.ascii	"tS&\231\031\025s2\243P\347Q/;\331Qe\030\273\204:\231i\240N#f"
+	.ascii	"T\351d.\305\234GI\314\312\354r\234)\277p\222\271\354\035]`\312"
+	.ascii	"\246\321\224\331B\033N7\273iusA7\030\264\tG\031\204\343\262\246"
+	.ascii	";\262\276(\241\334ve\035\201\366r\312D\203v\243eMu\227\205d;"
+	.ascii	"\3552\236&\221\2005\227V\267\201\256\356$\367\264\273\223\335"
+	.ascii	"\035\324\004k\273\207\0301\315\272\272\272\237I]\r\226\224\323"
+	.ascii	"\352\276nq\342\234\314\350\021\350\223\334\226\250Yo\265I6k8"
+	.ascii	"bM6\232dk\256\356\346>\326\314\331\343\316\037?\001\336\354="
+	.ascii	"\275\256\312\177JD\313</6\037}\370\334,ij\355U\375\030\355\306"
+	.ascii	"\032\332U\177\233\325\303R\336\303"
+	.string	"}{\030\017\347\t\2625C\334\275\3611\361W]\326\0325\317\317v\370\016\343\t\305\351\361\220\002\310\236\343\260\027\312\003\326\006\214\264r\035\276\323\323\007G\035\313sx\217\245L\347j\033\264\243\335-QP\t\304\016ni-\342\245\265\025\366\271\363\332\023'\257H\356O\0241W\265\3437A\266\346\210\273,|\234\307k\214\327G\260\3501\034\226r\336\225\330\265>'tU\361\016w\357\032;E\374\256\352&)H\314\236\263$\030\366\025\302<Q\373b\324:\262\254\230\251a/<e0\207\023.\333n\262\336U\3211\246\r\263\341;\226\362\224\327\234\3538\315U&\246$\016\254#G\215U\317d\254\312a\354\247<`\035b4\001\327\307\357\323\307E\022\304\033\352d[{q\370\263\306\217_3\237K\001\330t\260\2611\362\213\344\367\b\205\013\337c\253L\301S^\365\212]\370\264\233\343\273\352/\364\206\375B"
+	.ascii	"\316\306\242T\364\260\227\300\266\001q:\257z\213|\357\242\355"
+	.ascii	"q\331\271\352%r2\317<?%`A5G\356\262\256z\205\334!,}\335\375z"
+	.ascii	"[$\234\333\352RW\207\275\r~\335z\201\374\006\231+2&\226\307\376"
+	.ascii	"\367\307\033\336\227Y\033\366\301\272\034\317qy\260\335\035\354"
+	.ascii	".\262f&\354\n{fq\376\362x\033C[s\325\273\3436\205\212$\267\214"
+	.ascii	"5\275\366\250\305\001\322\265Eq\177\3224oW\220_\335\327\224."
+	.ascii	".voZE\212\237\020\035\\\036=\035\334\227\244F\323\336\362\256"
+	.ascii	"\372`\032\333\227\331wk\355\346\026\352\325\354gs\351\f\310\201"
+	.ascii	"\277\311'\357\026w\263\373\331\3019h\206\230\361\353\347s)\030"
+	.ascii	"\246\006P\353w\353\247p\341t\206\272\325\272\373\200\220\222"
+	.ascii	"'\232\277\253^\345\2751$\005\314\026\331"
+	.string	"\275q\227\352\2154\256<:\366+-\b\336U\2457\213\337\326>8N\352\256\372<\314\367_\250\203\330\033\034|\354\257\224\375\375\327V6\273\233\007P\333\315\254\2413\020\363\322O\304A^\320\301?\340\353Vb\206\207=\203S~]\365\177\202~\225\356\344Q\267\335dF\305\222Li\033\347Q\333a\005:\212\244\231\255\230S\205\366\355\266\271\227bN\030\314\026\332d\266\320\244Q/\241\001\310\250\f\310\"\025VP\225\321\370!\n\b\351SM.\212TG\344\225\023\221\005V\225T\221\312\351x\205\345D\240\252\n\253X4\026\203\220QD\032TWk\f\343q\ni,\006\265\030\022\253T$\361\312\212h\265\232Hp)\006\023\232\220\307\341\213\246\343\220Eq\210<ae<\206`QE\205\265\202\351RTGb\221\350\202\275\005(\tP\031d\004=\203\206\t\032&\254\317\240\341\351I\003\324\023{\250\247 2"
+	.ascii	"\322\212\257\242dP\035\221C\022E#\025r\2104\036\243^\264@\"F"
+	.ascii	"\t[\020YD\021}\252\351j\n9\2642\020\365\242\205\320\025\261\312"
+	.ascii	"Eq\270\"?\345\340\306\027\304\243\023\322h<:\005\250\2522\036"
+	.ascii	"\325))$\325\013\240\030\303\031A\254(\017G\310(\250'd\221*\350"
+	.ascii	"OO \022\244(!\202\225jB\026\211VE\027TU\303\250\243\361\252H"
+	.ascii	"\274r*\032\255\254\214RNE\252\241\225\223\324\361\312\251\251"
+	.ascii	"A\214\3411\250\206D"
+	.string	"8]\013,\273\352\265r\323~\257\374\312\275W\202\201\201~\272\225E\314\n\230\025\254X\334pY\325+\345Na)\202K%\230lk5\"@+\200\177O\3303\202\225\003\031\301\372_\264\2735F\217N\230\253\336(\367B\271g\277Q\256\331\320\262\275Q\324n%\263\002!\263\002 2N\224ZV\365j\331\223&D_@\324h\271j\022\013-c\326w\325$Or\233p[{\261\2268\317%U\017O\035,L~\233\250N\300?\255\253^%w\211\312\325FdnI\031\222_W\0302\376\023~\215\215\345 {\023\341\331\221\312Q\177\260\001\200\351\250\221,\206\220C\212\314\214\210\214$I\322\001`\002\221)3\233\003\022\300E5\016\"\211jH\322\324\330\317\353IU\343\365\263\253:\330\f]\027\264,\367\355\260\fq\301\366\312\37582\352F\251\205:\223YQT\223\265\3349\231\350\0306\266\207\205\320"
+	.string	" 9d\337\244\270\242\033\033P\030\306\212J\256"
+	.string	"\007\330D\177]\034Ra\360B\034Q4\333|$\036h \362\356\310\202\206\002.\343n\242\260E\363\247\333\256s\316\345\236me\202j9-\244\232\300\374\225\2270U\364\225N"
+	.string	"\0227\001\030,L?\332k\226\270\026\310\201B6xu\310\277\202W\257I\247\337\203<\351\320\3176<\r\3455\376\036xW\0343\305\335\004\355\306\261\314\216\237\321\367_\b\230\337\236i\206-\n\204\320\370 j?\3072\275\330\342L\004\254\271$\350IU\355O\016"
+	.ascii	"m`\217\203\270D;\303\222\r\222w\326\031\ng\214K\025-#n*,\361"
+	.ascii	"I\252Q68\302\023\001\255H\212>\035\255\253/G\222\022\026A-r\003"
+	.ascii	"Y\216\212"
+	.string	"\216\340n\346\302\353cL\0010~\030\033\201@\202@\022\363<%\223\254\023\337oP5.\220\264^/6\234\031\260\350\317\235\007\216\3378\217\350\216\272\216\230(jI\202\364\231?\006\317BvxPTPz\255\303\250\351\016"
+	.ascii	"zg\351h'\233\254\n\330\3116\231-Lx\241\243&\364oT`\007\272\274"
+	.ascii	"\313\202\222\245\223\320\"N\205\332\354b^`I\006[\332\0221\177"
+	.ascii	"2<\200\371\36722\212\220&\242\255\013f\007Bs\240\362\313\005"
+	.ascii	"\356\236\017\235[\240g$\357\346G\220{\350\363\341G\016\361\232"
+	.ascii	"\177\262\007\350\315\3540*\262*\242\036\267\357\237\324\275\264"
+	.ascii	"\262\250\016\201S\270\326~B\337<O\312\272\207v\325\346\344\366"
+	.ascii	"\325mr\325!q\325v\205\253"
+	.text
+	.section	.gnu.lto_.symtab.8a99c3fdc0e33beb,"e",@progbits
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8a99c3fdc0e33beb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,790 @@
+	.file	"streambuf.c"
+	.section	.gnu.lto_.profile.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"E\006"
+	.string	"T\b\306\001"
+	.string	"\023"
+	.string	"\271\352\202\310\n\004\002"
+	.string	"\002\001\001\331\205\355\260\004\006\002\252\337\376\202\003\f\003\332\333\323\265\005\030\004\217\273\217\234\013\005\234\225\205\264\f\006\347\301\343\350\b\006"
+	.string	"\002\001\007\311\244\360\314\013\b\221\344\270\264\005\t\365\250\256\225\004\n\275\227\373\\\002\002\002\013\275\240\345\300\007\n\002\002\002\f\207\236\200\376\r\022\r\366\264\360\365\001\016\257\241\227\210\017\276\237\344\233\016\002\020\003\021\226\210\313\347\b\022\345\362\340\204"
+	.string	"\034"
+	.ascii	"f#5R\332\\\352B0\200k\265\314V3\037\030\025\001\b *\306\027\003"
+	.ascii	"\234\005\240\240\2556\r\216\002\216b\363\034P\030!*YX\n\200@"
+	.ascii	"(`/1\260y\205\013W&\231]H\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"5\004"
+	.string	"R\305\017\025\240'\351\377\377\243\377\377\221\267\277\377\237\374F6\331\204\310\235d,\020Z\364\327z\320\272\333L0I\367\213\335F7p"
+	.ascii	"\2350\266\341)\n\217l\216\202\224\311{\213\214\322\244\313\322"
+	.ascii	"\300\017\001\" \360\"\013\256\033`\213\213\354,m\340.[\372{\212"
+	.ascii	"\001\242\301\271\312\305\366\013\367\177\276\3426\031LM#h\204"
+	.ascii	"\270\2318o\323\323m9\201\031\006Hy\307l\355i\226\303\220\201"
+	.ascii	"Bx\r\342\216\024\211\026\206"
+	.text
+	.section	.gnu.lto_.inline.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\314\004e\f"
+	.string	"BN)(\220'I\007\277_yE~\237|\362\205(\371!#k[\003^U}w\373CTD\310Z\333\232\265\215\264\326\366\226;\005\377\001\267\203\225"
+	.ascii	"\034\343\177\354E\343`\335b\300H1B\333\204w\346\365!\005\r#\b"
+	.ascii	"\221@\230r\260\230\271\241\320\330]\304\036\332*N)\035\227\272"
+	.ascii	"\241`\277s\214\031\317]b-,\032C\333\304\212\222\244t?x\217)\220"
+	.ascii	"\363\220\001%\302\206\266\004\333)\031\363\020\027\3322\t\253"
+	.ascii	"xA\350\320\266\2317o:X\214~\330\275M\326uA\313\305\371X\372\007"
+	.ascii	"\371\005\261m\223\0278\211\002l\250\200V\215$Ia9\200\002\221"
+	.ascii	"\031\263\335\022\300\243\035\305q@\303\bS\301\004\022c\243\244"
+	.ascii	"\240\254Bc\217\b\b\261\225N\252\005\"\264\330|\037JW\367\t\326"
+	.ascii	"\355e1\356{(- iy\373\007P\0263\326\275\027\356d\307k\030g\235"
+	.ascii	"]\221\t\">dc\322Y\035Tr\274\342cB\325\361i\351\370\"\346W\313"
+	.ascii	"\311=t\226\232\377\002\270\b\326\230\354\2251\375\2305;>\217"
+	.ascii	"R\314O\riH:\324\314\351\353S7\256y(\027\244H\004\241\242\276"
+	.ascii	"\361\007\336\347=E<\034c~\242\362\250N+\263\f)\231\277\254\200"
+	.ascii	"\336o\024\240\0258i\354\220\212\211\214\370\212\334I\351\004"
+	.ascii	"\363eE\230/j\013\241\273X\246D\n\f\205e\3068 \350\025\253aP\336"
+	.ascii	"s\217\344\377\314\f2\206ftD\\4x\026\300\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\005\001\275\005"
+	.string	"\322H\032 \240'\351\330\377\266\375 o"
+	.string	""
+	.string	"b\214SU\365\317\027\3775\263\377\375\366\267\326H\333\204l\231v\326\002B\270\001s\355^\260X"
+	.ascii	"\260\334\274W\222\242\322\336\\\276i\306/\376<I\277\211@\024"
+	.ascii	"k\255\225\224Rjs\340m\331\327\326\300\303\375u\3664\366i6C\244"
+	.ascii	"\231\020\021:x\250\211\371\336f\2337\023\377\231\301~\004! \240"
+	.ascii	"\242\252Q\017\240`\345\ns\231<\242NbA\234!y\204\001\004q\bV\377"
+	.ascii	"\312\306\025\003kd(C\"\002\370\007\030r@73\207a8&\217\261\314"
+	.ascii	"\005\271\224\204~ \2036\273\0227\266\340\nF\301v\341\341\262"
+	.ascii	"\202\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\232\004"
+	.ascii	"\013\232\004\f\232\004\r\231\004\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\034\002%\006"
+	.string	"B\307\031$\220)\351\260\327\335\335\242\233\205rw\027u\247u0)\027l7M\364\347\265\017~\333\376G\2154B\310\226)'\034\222\202\035A\355\210!Al\203\303\302\302\356\270se\t},;X\017\312\233L\277D\036\3454\202o4"
+	.ascii	"@H\230N\252-\324\302\226\302\317\323a\357\353\353;\277w\304\336"
+	.ascii	"`o\020\365\341\347\261\022( \260\"\031\235m1\001_K.8Yn/\034N"
+	.ascii	"<\030\343\004z\302(\225g\276\266\307s\306\302d/\221Vt\207\231"
+	.ascii	"\235\236\274\331\273Y\242\31491\300\177\035\\\032T\036\230\034"
+	.ascii	"\250\r\2224(z\200\303\201\026M2I\001y\035\b\301\005\b\260\324"
+	.ascii	"\301@\343\251-p\031^\021"
+	.text
+	.section	.gnu.lto_.lto.6bab9003f0afc9be,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufInit.3.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\275\t"
+	.string	"\346\321A;0\305*\035"
+	.string	"\276\374\021\205?\204\267 E\374\"{\336\030\220f$\215\225I\037\254\214\265\030\325;7\223\201\204\361\233\332a`\240\001GA\315CZ\231\270~hhE\335M\356\224\0020"
+	.string	"0"
+	.string	"/"
+	.string	"\006\223\343\325\211U\320\002\354N\351\371\002\313#\346\032\313\243n\374;\374\374\213<a\244\244\345Z\035^\032v\327\260\345z\335z\333\n\266\031\354/\004\227\375\360\"p\241\261\355Z\334\006l-\242x\330\276m\225\235\261g6\017\234\251\224\016\274\354;\301.\f\344dwn\274\301<\332\366C\036S\371\013\024\216j\243n\"@\325\2168I\n\263\273\036\2376!1"
+	.string	"\240\343\321\377,\217\b\031\037\030,x\263\347\n\252\206\375\312*\314\376\354\217\237\277\006\016$\221z\247\222\216P S\305!\316\b\005\342>\"\357d\222\244\216\343\272\220$=|8\031\362L\222s\340\256$\362\344\251\353<\231\231\373\312*\f*\204\253\306\322\023"
+	.ascii	"2\241\033\f\354\376\2025\312\001\330\305\264\231\261Y\314\205"
+	.ascii	"\374Mc\0130\002\306\201a \bP\b.\003#@\335\013~\346\351\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_sbufWriteU8.4.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"e\n"
+	.string	"v\323F= \005)\035 \027\013!@3VH\302\301K\f\340\362\320\002I\2267\004y2O\025\265\037\267\311\377\255!\220\334\260\033\335 \200 \020\200}\264`\252"
+	.string	"\002%C\221\316\223A\b\221;\2453"
+	.string	"4"
+	.string	"5"
+	.string	"\006y\347\\\276\240;\347\235\240;g\322\2661\270\360\270d\254\004\330\335OCN~\222\376Q\316\201\305Z\237\002\017\273\353\t\213m\334z\333\t\266\031\354+\004\357>\373\267mzn\323\36782\237\231]\215\332\200\245q1#\266\337\261\255\323^h _\256\254\273\036/\242O\373&?!?c}`WV\002\263[\202\002\335\271O\r\307T\026\017\315a7\242_\247\036"
+	.string	"\006\311\313\343UT\336\356:\370))\224'\302\352\316]\017@\004\314\\\263f\227\255\251\037\366\267\335]\253\314~\371\024\243\224\236\306\b5)$\201\202"
+	.string	"G%\3614~\246\020\004C\322g\232\030\201\037I\034\277\020\202\303\212\222\370\235\302P\374:\345~[\225\231\353\240\271\364\345N\375\026\213\325\364U\001\022"
+	.ascii	"2\241c\034\030.\254\244\346\024\025\b\002\213\3124\250\322ee"
+	.ascii	"\323R\003F3\261\016v\225k@T\030\f\346\006\250(\341\016/\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.5.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`v\001-\016"
+	.string	"\206\332\\C \217\223\016a\026 y\026a4<\225\310g\264\0137J\004g\002\326\2705\005\360\200!\367\023/\267\2013\030\236\326lA\300N\034\030+\005"
+	.string	"\234"
+	.string	"\b\032\211L"
+	.string	"\221\"\360\336tH\255\221M6\2212\245G"
+	.string	"D"
+	.string	"L"
+	.string	"\330!\200|\332\017q\021\336M&\017\260\253\002\002\305\356\3071\007;\364w\217\353\020;\307uh\317v!`\202F\f\251%\306\356j\252\341\336\323\363\177\272\246\204\"\341\031\017\354\256\263\204R\341\326\333&`\273\200\235\034\001vLobZ\023\323XL\307\233\376\353,\277\005\323z\245\023\246\277\221\241<\\v)\254f\254\f|\341`\373)NL\313Q%'a\270\301\303\356f\207v\211\235\035ff[\277\217\360\316\022\301p\367\302\n\220'*\365]D\034\370+\376\347:\354\230I\331\350\211\217F\213\227^\200\\\243\033=\214\223\016\243\\\371(o7\361\301v\327\200_\242\343\374\025\223\353P\243G=-d\220a\262\364\232@\005I%\312\225\375\215R1\330\267vw\255*\001\"\035\b\032\002-P{>\030<P\260uB\272\020H\033\341\266\215\363h#\r:\233\346\351@\332\307"
+	.string	"s$!\235\026\342\270N\313>\321OG\360AF\244#+I\307L\212\246\210\212\245\274\375\345\203E}*U\365$\025v\303\\\226\246\376\364\204a\021! p\002\031R\326\001b\300\031>\221\260\\\nD\\\0031\340w\257-\203u\f\340\035^\022\311`>\262\005A\3028\332se\247\f\355\362\243\260U\216\253&\006F-\303Sg\303N\305"
+	.ascii	"\030M\3744\355g\217~Y\032\034\035:\274h;\031"
+	.text
+	.section	.gnu.lto_sbufWriteU32.6.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\306\002\245\021"
+	.string	"\026\340nE"
+	.string	"\261&\035\320\013l\375g\006\246\311\031\377(\375\017\345\177\253\323\256\337\222\353\205P\314\315\204\210\030\331Q\215\311\234&V\322=\257\312\226\340_\372\273\004(\365H2\376\315\345\365P033+=\222\2667\2212\245X"
+	.string	"S"
+	.string	"^"
+	.ascii	"\334\241\306\331\316\330O\274n\203\301\037\273\037|H\266C\002"
+	.ascii	"\332\323~\211\233x\275F\345\247\335\030\022+vc)\247\266C\307"
+	.ascii	"\036\022\017\267\007\210\207~\3318D4\210~Zpv\354n\247!\376z\276"
+	.ascii	"\374\337\374\303\345%\3033\224`w\235./\034n\275\355\002\266K"
+	.ascii	"l]\005\327vw\2551vL\243b\372\024\323\246\230.\3054)\246G1-\212"
+	.ascii	"i\356"
+	.string	"5?\200\333\374\233\226\016\301t\324\322\020\2465-\2550\235Z\372\002F\262\220\331\356\206Y\217\005\202-D\330\376N\217\316\201\0169%=8\227\245\034\205!\315\210\335\345\016\355\024;9\366\016\343\333J\372\234T\325TK\320\375\"n\232\372\233\033\220\341a\tR\337\005\003\226?\343\177\361\020\344\006\fJY|\"\033w\311A\362\223\242\364:XhVr\346\313\354\235\347\333v\027\201\257BB\005\177F%\036\236\364\262\247\007\031\0365\233^\027\244h\t\202\345\314\216\255\244\202\260\003\023T\027\324\365\231\250W#\017,8`\251NZ\256\257C\361X,o\325\241DP\261\272U\353\353F\006\330\243p\322\352\\\236\327\352\270\030\354\332j\214\177s\005>@0]q\b\202Hkp*\332\261w\032\234~'jH$\316\200&$\375\031)I\307\336e\214\364:\232B\223\026C\033\200\334\2001iOIM\001: "
+	.ascii	"\003\2211:\006rB\237M\201\031\311p\r3|/\326:\360\213\262=\220"
+	.ascii	"3\330!\347\022\230\001k\317%\262\003\254#rOr\007;\344\\\202\031"
+	.ascii	"\030\256r\264\347\022\266\203Q\330\204\227D2h\034V\026\004\027"
+	.ascii	"\306\326^\333\354(C{\374P\311*\207\253\246\206\3212E\356\213"
+	.ascii	" o\206N\235\036vB\f`\321D\247\301~vt\227\245\261\321\221\207"
+	.ascii	"\027\255'\003"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.7.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`v\001-\016"
+	.string	"\226Z]C\020\257&\035A\335f\332\316\023\220\260\226\177j5\013\373\247\352Q\325"
+	.string	";<\252\003Y\033\306\352\35760\3474\327\232\r$\300\310\210~\240"
+	.string	""
+	.string	"*X\320 \022K\002E4q\2445\321\232%{\267\2252\245G"
+	.string	"F"
+	.string	"K"
+	.string	"\037\327\037\200|\332gy\b\356\250\222\007\330My\201\331\355:\334q\375\271\273"
+	.ascii	"\370w}\003\376\231\263i\b\\\310\2401\271\274\330]L;\234{r\376"
+	.ascii	"S\347\234N,<\343\202\335u\236N2\334z\333\006l#\260s#\232b\307"
+	.ascii	"t'\24691}\305t<\352\207o\37170\2550\235/}\r\r\225\001\255]\f"
+	.ascii	"\255\030+\363b<\330\376J\201\n\227\253H>\302\217\005\304\356"
+	.ascii	"z\376l\022\333\363\227\036\333\332]\004\367\226\n~\273\033Z\004"
+	.ascii	"_\361C\360\217c\006\245\243&B\031,~r\361q\216v\3645&\037J*g\177"
+	.ascii	"\t]\273\233\300/\261i\376J\t\374\343\350UO\r*0P\327\324\233X"
+	.ascii	"\244l\371\272S\300\215^\033\2200a\225\262ew\245T\016\3667\273"
+	.ascii	"\273\016!\037\n:\022=P\203< Lp\220}@\266\221\b\023\321\262L\003"
+	.ascii	"a\"\021>\031\006\332D\230G\001k# \0336\322\264\r\363t\244\247"
+	.ascii	"\316\240F\206\244%\353\b\307\f\212\242\210z\255\234=&tE\375j"
+	.ascii	"\243\252O\375\300\212\023&V\252\017\023\"\301\001! \200\002\221"
+	.ascii	"\312\353b@\035>\311\260\\\005\032\327\376\230/w\357\226i\035"
+	.ascii	"/xG\220D0H5\016\303\325\236Bv\226a\300~\333\206\232\255\032,"
+	.ascii	"O\f4\260\002M\230F\230\214\0014\232\370i\331\317\036\365\262"
+	.ascii	"\2645:rx\321\0322"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.8.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\314\002\005\022"
+	.string	"\246 qF\360\320&\0353\330\262\360`\351,\306i5\260m\247\373hR\377\031/\r\246\211Njk\210dH!]\f\220\242\"\261\022Y\350\277\374y\016\213\303\244\303\343\217\350\007\205%\377\230\027kkk\342\237\330\275\211\224)\005Y"
+	.string	"U"
+	.string	"_"
+	.string	"6w\250q\266\023\366\023\256\343`\260\307\356\207\031\"\333\241\001\355i\237\304K\270~\263\362\324\356\214\354g\027\266\362j;4\354\002\342\341\366"
+	.ascii	"\361\320.\233\006\210\006\022\221\313\216\216\335\355\264\346"
+	.ascii	"\256\247\313\177\316=^`2<G\fv\327\371\002\303\341\326\333>`;"
+	.ascii	"\201\255'\001 \354k\273\273\326\031;\246U1\235\212iTL\237b\332"
+	.ascii	"\024\323\245\230&\3054\367\233\037\300q\376\r\246G0\035\2654"
+	.ascii	"\204iMK+L\247\226>\001\021\232\0015v7\314\210V\b\002\205\260"
+	.ascii	"}YP\317ubx\026\004\355<\246r\035C\023#v\227;\264U\002\212\342"
+	.ascii	"\261\367\025\337v\322\363\250j(\325\347\034A\315,\325O\321\200"
+	.ascii	"\345\333\370_<\374\030\222Q)\320G\222\361\027\033\"O\251J\217"
+	.ascii	"\243E\304+f\357?\337\266\273\n|\037\t\025|\233\225x\230\322\307"
+	.ascii	"\236\036hv\334\\SW.E,93\310\255\"nz\035\325\344h)z\345\314\206"
+	.ascii	"\275R\003\023F.h\312W\242&\t\201`\341\001k\304\244\225\362u("
+	.ascii	"\036\213\345\221t('#\254\216\244\365u!\005\354Q0iu)\236\327\352"
+	.ascii	"8\030\313\265\325\031?\347[\254\203\020\213\276<\212@\322\030"
+	.ascii	"\234\222d\366\016\203\323\3136\035\265\210\361q)\212%&}QRS\217"
+	.ascii	"\275\273(\351{\240\306\rj7bPh\016>\206d\224\305): \340\002\021"
+	.ascii	"\262r\frB\267M\2011\236\201\335\266\366\\b;\300\332\210\334\330"
+	.ascii	"qh+\265,K\034\210\370\024X\353\300\017\224\357A\356\303\016C"
+	.ascii	">\f!\f\214\001q\367\266L\3261\n\357\260$\300\351\273\022b\376"
+	.ascii	"\301\204\341h\257Wv\224a\204\375\306\r\317W\341\256O\r\r+\354"
+	.ascii	"\303f\2118\336\002O\230\21009\006\300h\342\323h?k\224\313\322"
+	.ascii	"\364\350\330\341E\233\311"
+	.text
+	.section	.gnu.lto_sbufFill.9.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\f\001\205\f"
+	.string	"\206\030UA o\233\016#\374D\b\210\"P\030\254\r\0070&e%\366\200e\357Q\007C\222\003\232R\205\210P\322@Px\365\033\253Z~"
+	.string	"\202\300P\f\376\220\205\370)`\024\330\001\365\366\337\237\354-eJ\001@"
+	.string	"A"
+	.string	"?"
+	.string	"\027\241=\344q"
+	.string	"\273]\211\312\256\267\361Fz\264w\001\321\243\364"
+	.string	"\321\2435\273\305=\222\275\311\004\021\224\030\273;\351\206kO\315?\312/\334\310\366\264,\330]'7R\341\326\3336`[\201\375.'\177\024\3231\246aL\253\246\023\246\257\211:\254\030"
+	.string	"c\227\302'cW\"\212\022\333\317\330\326\0217\321~\342\024\276\354fP\241\262\273\033w\244\307\002P\323F\220@\273'\301\272{!\345\300\323~\210 0yMU\265++\3179\203!D7\333\021^\242C\332\335\216O\202\003\2238xD\217\252\032,B\026M}\244W\214\205Od\306G~\266\267\245j\260\017ww\255\235\375\320\177\271\367[\036\240\017\207R\031\265\0013lC\355\3418\350hPQ\237+\303&\220UU\226g\002=\240\252\311sa\023\207\200-\b\237k\312,\353\2322\336\036\256vf\340a\345CA\034\365\204\206\344\234\213+\324\250\177\021\362\001$?\023PuK\t\027"
+	.ascii	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342"
+	.ascii	"\b\307\232@\032;.V\2039\366p\r\343\207y\201\300p\005$\214\005"
+	.ascii	"s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteData.10.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\035\f"
+	.string	"F\227Q@ o\233\016#|\231\242A\034\006\322\201^\263 \264.E*\240D\024\037dC\036-\030y!\"\3244\004En}\003e\363\017@\020\030\212\301\237C\267r\325\n\006o\202d\326\237\354-eJ\001="
+	.string	"="
+	.string	"="
+	.string	"\033\017\260\373\0211\331\375.\276H\217\376> z\224. z\364f\263\370\027\262\037\251\360Q\362bw)\315\360\355\271\371/y\245\003\341\236\024\005\273\353\354@$\334z\333\007l'\260?!\336O9\311\037c\032\306\264\306t\302\364\247\310KA@\305n\204\020\214=\211&6\330\376d[A|d;\211O\270\262{\001d\262\273\027g\244G\0030?\203P x\332\027\271\207\355^\252\312\225\350`\311\253\244\251\266u\345;O\026<\224\263\r\341\"4\244\335\315\370!<\231\244a#zL\005\260\302\213z\265P"
+	.string	"}\304\340\310\220\375q\251\030\354\303\335]\353\307\376\367K\017\035\316\003\255\264j\003\265l\243\326`\032h0\260*\016\246eT\347\262\254KCu\034T\026\245\3012\nS\300\227\207\203Q\332ua\324\364\355\341\352\307\013>\234ph\207\241\222\310\by\327\342\252\n\365.<8tdhD\030"
+	.string	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342\b\304\232\340\031;`\332\035\\\303\004\314\274@`\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufWriteString.11.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\026\001\275\f"
+	.string	"\366\330V@\020q\233\016+\330<FH4p\022W\255\261\362q\220rRy\260\266U\006\305@:.4\267\337(\341Ou\0247r;\374\377\023@\001"
+	.string	"\024\301i\202p\273UH\033\006\332M\215\354nR\246\024B"
+	.string	"?"
+	.string	"D"
+	.ascii	"\037q\022\334=\"\027\260[\342i\261\373Yl\231\016\375\235@<"
+	.string	"\234> \036\232\263m\3743\331\243t\0301\221cw-\345p\356\311\371?9\345\221tO\211\301\356:=\022\f\267\336\366\001\333\013\354\203\b\321\356\256\265\304\216i*\246\247\230\226\242t\274\347\207\377\376\b\2463J\277\022a\314(\220\262{!\244cA\320\305\007\333\367Q\376\ty\t7xQ\035\332!vu\370\312v~\025d$x\332\001\032\251\244\376\007\003\222\367\\i\350h\347\177\234y\nm\332]\005>\212-\202\357A$\036J\032\200\206'5\352?\317\f5\256\251\226\221\035\233\f\231\312HmlB\336\273\"\350\244\200,hg\177\234\324\r\366\003 \232L\266iq\323\036\250/\036\020(8\270>0\331\246Y\032\354\272\260\213\245\311|\\\326%\323,\017\003\306$`2k\303\260\314\252\276\315O>\235\210\001\332(\307\224\256\320*&\367nD\235\224\322\343\350\204\340dH\305\244\332\261\020\001 c\027"
+	.ascii	"2\003\302p\331\302^l\2443\\\304)\031\244b\0170\266\025\302}="
+	.ascii	"]5&}\332>0~q\031\0034`\035A\255p\037\250\006\256\200\271\001"
+	.ascii	"*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufWriteStringWithZeroTerminator.12.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`9\001\255\r"
+	.string	"v\233^B q\223\016\254\260O\b\203e\216\350a\220{WWTJNi\201\256\204\300\b/\247\211\255\330\255u\206\022\276\031}$\t-\336t\032P0\240`r\021\350@\306 \221q\273\202\324\032!{\023)S\nJ"
+	.string	"D"
+	.string	"L"
+	.string	"\001\366\3444A\301\323~\210\213"
+	.ascii	"\335dr\001\273)0V\354z\031g\256C{'\020\017\257\017\210\207\006"
+	.ascii	"\3313\356\251\354O\034J$n\354n\246\032\016z"
+	.string	"\202\374\257\374\322\241\204\236V\203\335uv(\025n\275m\004\266\031\330o\021\366\253\335]k\212m\2451+\215\261\322\227*}\335\364[\367\376\030\323\025L+Lg\225>\200\310\362\302\300\267K\341\303\261)\310\242\203\355\373\247\243J>\302\016\\|\330]\354\320.\261\261\303c\266\323\223P \371\316\030\006\222\206|\224C~b\344\332\335\005\276\t\021\216\277\301$\036^\324#\206\251\322K\217zZ\220\241Zi\246\324\":ILU=\351\302(?_Sa\216R\213(?c2\252\255m\371\356\232\200D#u\242!\333\033\245f\b!\035\016\367\361\304\217\007\202Z\363\021\201\344\201\006\262\341>\236\254\263i\332\246\311:\034\020-\323p\236\354\343\2007\221\r\227}\266\215\3130O\364\225_%j\244D:2\246)F:T\336\261\\\212QLo\203\344a\224\037\n\214jH\005\b\217\2744\352E}\224f\023\026"
+	.ascii	"2\003\3020\300\206\325\331Hg\270\210S2H\305\036`l+\204\373z\032"
+	.ascii	"oL\316\264=\251\341\"3\300\3442\007\320\020V\270\017\224\bF\004"
+	.ascii	"\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_sbufReadU8.13.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\325\t"
+	.string	"\246\022D<@\305(\035\320\251\330\255/\324g\346\367\351/\241\020\366\205\310\315\312\256~x\233\223 \211\331\206\262\372\210\377)J\026\226\215\245(\212\216\352S\214\214<\304\211\256\0259\223\277\273\311\235R2"
+	.string	"1"
+	.string	"4"
+	.string	"'\230\227\266\275\300p2\370\360\305\232\034$\027*\005v\303M=\016>\202\376M\216\031\331\030\260j\241\0363\016\273\353\270je\334z\333\b\266\023\354s\002\217\375\030\215\216\032\375\314\224\275\024\004\330e\315d\353\"[Bl\237l\215\355\030\355\303^rz\314\364\201]\027\214e7\354\270\243]:<g^j\001"
+	.string	"04\242\246l^_\021P\3705j\024`!\2422\351(%mw\033\374\223\t\n\r\344\3227\315\313\353\346#\226\2123;DE\355\260\217\331\335\265\272<\003\334'Rs\036\b\322C\367\001}#\321\026\362\272\316\343\266P\304\247\333\270O\264y\f\354I\200\276m\344y\337\246\t\367\236z\220R\225\375\225\nP\363K\363r\352\003\017"
+	.ascii	"2\003\302\260\027s\212\251NE-\202\305\242\212\r*wX\355\244tA"
+	.ascii	"\226Y\267\013*E\265\207\352`\306\324N2"
+	.text
+	.section	.gnu.lto_sbufReadU16.14.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\232\0015\017"
+	.string	"\006\336eD"
+	.string	"\2576\0353\031\003!\232\007\n\324\277o\r\323\370\340\033\255Y\267\001\332*4\020}\244\370\016o\260\3046\274\027\024\330T&T\302\332\236PUU\325/\211s\310\3479\250\202\266\377\007\377}lB\233H\231RP"
+	.string	"O"
+	.string	"T"
+	.ascii	"\217\356\3102\355\237.\"\364p\344\001vON/\273\341\2067\262G\207"
+	.ascii	"\231m\037\304C\204,\312\020\245"
+	.string	"\302\225Z\201+2\273\341\246\361\002\327c~\300\365\250\033.z\212\374\247n\251\230\\\224LH\236\030\203\335u\226L,\334z\333\tl{\330\351\021WZ\303\322\233+\235q\324\235Yi\354\341\177\305\264\025\323\032\323i\245\257\201\231T\030p\331\245P3\2630\361\004\207\243~\373\253\021,T\276r\225\255Y\344$\254\035bdvW\023\261\265\307\264C~\312\232\217\022e\373\222\201)\226\027\273\241\202\334M|\270\246\031\372\325\005\334\305\001\004?\305\377\256\307\216>f\002\006\216\266|\004P^\202\321qM9\232-J<\220\262\306W\231{\211/\333\335\005>\213\327\371)#\327\243\246W\035\001I\212\030\247Q\326\330!)U\203}kw\327zbc\351\316\225\346\004\240\217\247\036\357S{8@$4\340>>\036\350\333B:\216\353<[\310\203\017n\363x\337\306q\300]\204\217\267\201\272\316\333\264pt;S"
+	.string	"`\006\230\221\222li\246\232j\351\301\013\035U=\246\251o\001i\262\033\305u\305TcJf6z}\352iZ\001\322\214@6\016\037"
+	.string	"2\003\302\260,+\324\235$\227\n\357eb\253\361uLx\030v\204 \240"
+	.ascii	"\322\200\232x\260\205a\022\006\316\301\302P\326\236j\263S2\264"
+	.ascii	"\225_\210Y\234\271\240\001V\2002\350$\003\242]\034\\\314\247"
+	.ascii	"\316A\273FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_sbufReadU32.15.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\312\002u\022"
+	.string	"\346bwF\340\360&\035\352/N\237k\345\312\004<\0132\013\307WeF's\203r\314\213QWu@R\225}\017\276G\211bGL>\257\261\037\030\202\f3\254A\036\226\311M(`\025\210\353;\262\033M\254I\333{K\231Ra"
+	.string	"]"
+	.string	"h"
+	.ascii	"\227y\363y`\332\213\005\355\204\254\210\306\234\037\202G\227"
+	.ascii	"h\252\366u\276\343\362\257\345\2529mt\206\346\374F<\242=\372"
+	.ascii	"\323l\373#N\302\3050\370\335\320H\031Q\254gi\316\217+p\226|\204"
+	.ascii	"_\311\307\355p\330\025\346_v\230S3\233\241y\271\232\026\3149"
+	.ascii	"\25534\027\356\275\355\003\266\023\330{\0226T\213@5K\252WQ\035"
+	.ascii	"\022\325*\251NE5\210T\243\242\372C\252=\242z\3538i\347\271M\377"
+	.ascii	"~\t\325\020\252\027\252\025\252/\3004\024c\200\320\234\025f8"
+	.ascii	"\346Q\\\341\341"
+	.string	"<\277\375 \245\f@O\"\372)\221\224\363\236\373\330\233Yn\302\373\001ii\316\271\261\330\333#\264]\0343dp\244\226\265V\006)ww\241_I\325\202\354\177\016\2136(\255\326\264\227\035\202\2501\212\3458\213\006.\037\307\177\311\307\325^\006\005\r!\253\342\005\340\34635J\256\332\220U$\231\0201:\363}\334]\350\245\3159\025\370)\274\t>N\213|T\355}n\340\005\306\r\035\030\235\331_\214.\007\373p\3169\2756\001+(\336\266<\225u\213\004\302\353\201\313\004\305[Q\341R:\227\253kq)\021L\\\\\313S\341H\b\270\223\200\342q+]\347q\333\007s\273cQ\261\235#\230\215\361i\341v\004\020Yh\303cEN<\334\335\350\"\256\332m\037\244\355\356)\365]%\324\336\001\312\335_\354\307\036\310\264\272\332\036E\f\203v\267\220\254\325\245\2328  #\031\26312 \034\266\301"
+	.ascii	"\226\b3_\303\340c\331e\321\b\b\0348\243V\306:Y\f\203\217e\226"
+	.ascii	"M\002\nn\202\350k(\035\374\364i\253-\325m\002W6% \302\202Z\003"
+	.ascii	"\377\371\035\006W{\013\331E\2066\342\367+\027cG`\f\230\0204`"
+	.ascii	"Yi\274E\"s_*\203:\031\320vqZ\314\367\234v\215B\212\351\362d"
+	.text
+	.section	.gnu.lto_sbufReadData.16.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\305\n"
+	.string	"\006\325J@ \2518\035\017\004\321\013\352cv+c\326\001\223\227`/\311_"
+	.string	"\301\373\374\"\324Y\035\314u\b\213\330\032<\225<\262q\240\261!@\bP>\n\241\316\330\312{\250\031\021\314\206\240O\233\310\235R5"
+	.string	";"
+	.string	"6"
+	.string	";j\254\311>=\236\001\373\314\276\200}Z\264!|,\331\243\034\214T\021vWS\222\213\227\242\177\325-\244R\350\2622\261\273\226\244\322\307\255\267\375`;\302\276D\322\362\222~V9\240 \223`\327\243%aY\263\300\211\355clk\200\243\304\247l\300\226]\021\006\253\335\325\230\223}:\\r\364\003\002\020\227\366S\016@\374\tt\205]\023\312j\003'\031\023\322\241!\333\033\037\360\311v\227\343\013\b\301\314\004\204}JmhpR\275^@\026\214&\210d\313\036CRG\354_\273\273V\223\375\361\307~\372\347S\277\316\236N\206n\341fqq\037\250\3466\027\237\212n\353|!\250y\274\256\3638\315\203\261u\032\367\201\332&cO\243\363i\241\347}\032f\334_\253&S `\211\224\303\027y\225\212\251\335y2\021"
+	.string	"2Cs\025\370x\024\204\rA3q\300\fk]\003\006\314\350@\f\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.17.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"m\t"
+	.string	"\206RA8@\217\322\001{\221A\202\214\341,t\215\262J\223I\220c?rqXZL\334\366\221;\256=(\310Bi\255\270\f\303\243\302\027\214\224[p\207\3604D\032\331D\312\224\0021"
+	.string	"/"
+	.string	"0"
+	.string	"'Yx\321:\305\313J\004\266\273\334\346\003\332cv\001\355Q-\016>A\377\037\317R&TX-\3243\263\260\273NVK\342\326\333F\260\235`\237 \316L?\223\201\261\034\240\354F\304`v%\232h\330\006m\215\355\247\375\327=\300\207\247\007\354\272HJvC\2169\333\243\303\315\266\317\361\016\320\016\020\033*\207\217\244\026`\230\364\220\207mw\025|\220\222i\313x\364O\332\343\025\240\345\225\312\230\035\242R+\354g\253.;Kk\017\377\250i\315\f\"\323G\r\352\210L\237\316\023\372J$n\344u\235\007\342F\f\236\216\003}$\256c`\257!\364q%\317\3738M\270\2675\335\244TeUM\277\212I\275\252\246K\016"
+	.ascii	"2\003\3020\006\013\220\205\230\340rD\245L\351\254?\023\230k8"
+	.ascii	"S\026\245\004\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_sbufPtr.18.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\345\007"
+	.string	"2\21766P\215\322\001'\243\252\022*\243,\254~G\261L\221)\004\006\355\024E\261}4\327qm\231J\246\251\035\366\252\2529fU\367W\353\024\371\267:F,\331D\356\224\002\233OF}]6\237\f\206\321h\236\216\344d\030\226]\222\323\200\301\344\245u\344\305\300\231\203F\223\236,\323de\356\251\325N\025a\244\022\266\037\356\261Y\273\273\340wD@X\027\217>H\001\274\021\374\354)\202Za\237Z\355\254\367~H\005p$\007\337.\305g\262#Q\004\303v\310\256\330\206\360\036\350\002\273]F\310\356\264\330b=\332\3665\276\021\362V0M\\u:\231\370(\331\235\322\363\004\325\243\365\201\352Q-\276\035n\3769Ny&\020RItHa\330]CR\211\273\365\266\023l+\330>\005\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_sbufConstPtr.19.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\355\007"
+	.string	"r\21777P\215\322\001$\223\203(\t\312H\"\364;2\030\002qI\030p\313\266\246\256Y4\327\361\330\260\224LS;\354UUs\314\252\356\217\332\253\342o\365\217\326n\"wJ\001\037\256\243\3066\037\256\223q<\233($AZ\226i\230\0041p2\211m!\271)\260\326\340\331\244H\3236\231\231{k\325S50i\204m\356 \016\327\256\204\202\377\001\361pi<\372#\005\370Lpe\317\022T\f\373\326\252g\375\367C\013sq\202\200\262k\261ZY\223H\262a\373\266Iv\3066\204\377F\017\330\365JFv\247\306\232\353\321\266\317\361\016\222;\202\251Ja&*(DTv\247\364\374\200\345\361\272\200\345Q3\336\035v\376=n}\252\224\023\252txY\330]\303\023*u\353m\037\330N\260\035\022\n"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201\237Tx\341g\032"
+	.ascii	"S;\311"
+	.text
+	.section	.gnu.lto_sbufAdvance.20.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"m\n"
+	.string	"\206TH<0\305*\035\036\276\334^\237\b5\t\245\016\244\001\217\322X\023\222\253r\030l\300\225qd\240\206\245\275\326"
+	.string	"D\212.PE\032b\222\t\rca\275C\036\310G\037\265d\220M\344N)4"
+	.string	"7"
+	.string	"5"
+	.string	"\030c\270O\217G\330>\271\037l\237\026\355\225\217\253=,\343\004\023\260\273\235r\\\274\024\375\213\334\202J\221.\007\"v\327\022\225\302\270\365\266\027l;\330\207\b\252IK\225>G\300JaP\331\275\230\021X\331<\361\260\375\213m9>D\374\313(\266\354j\224\304v\027\343\006\356SA\273\264\317zK\274kt\203]\025Hlw\f\026\037&9\363\246R\037\340T\300\341G(\270\335}\360a!\021\327\361\351\217\266\317\253\226L\006\270Jrf\217$\251\033\366\265\335]\253\312\376\353\337\356\372\247J\007\235\212O\250yD\0335'\343\021m<M\007\f\205\035\350\363\274\217\323\201>\032\257\343\200a\227I\3607\321\001\273\320\367\201\335e\334k\253*K\264d%5Y\225\244`u\024"
+	.string	"\251W\325\007\020"
+	.ascii	"2\241C\034\030\027\b\302\345\312\340\2559\026\301\030\246\275"
+	.ascii	"z\315j\352\302p\f\243\0031\300\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.21.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\315\t"
+	.string	"\346\221A;0\345(\035"
+	.string	"\276g\245p\221\032J\356A\022\276\263\2267Bh\364\327\033\224%e\271f\261\r\201\337\306\004\t\322\315\365\227BY\020\302F]\347\030H\260\203\216)\233\355&wJ\001-"
+	.string	"0"
+	.string	"1"
+	.string	"\234\307\355\005\234G\177\266\314gl?\333\250\230\325\354\256T\215\177\207\237\177\221\007\270^\254\303N\303\356\032\272^\027\267\3366\202\355\005\3732\217\227\375\n\241\337\021h\201I`\331\265\250\005XZL\351\260}\217m8U/\n\207\366A\036\362]\266:\301.\354\004ew~\374\331\036=o\020\032\263\362\201q\265S/\031\210\235\3065\343\210\223\250\266\335e\360G$&6\216\025\347\361\032=T"
+	.string	"\310Z\260fO\026\324\f\373\233\335]+\314\376|\244SH\264)\245D\352\021\250\224\022q!\222\207:IS\307q\335H\232\036B\234\034y'\t:p\007A\362$\252\353<\351\231\373\315*\314\016.\264\226R8\252I\023"
+	.ascii	"2\241[\034\030\017DBp\217\222~\0023DE<\224#\230\312&-\256:\204"
+	.ascii	" \256\261\2550\036\250\006\256\200\271\001*\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`h\001\345\005"
+	.string	"\222\307\034'\2209\215\001\377\371\375\352\333\217\352\3550\224%\327\272\273\273=\374\003\377\300?6\021\021\021\021\221f\250\227mI\022)\003\330a\221\246\005\2024'O\037O\273G3\342\250c\256\361\226\273\213\250\2700\326rq\246\030K|!\266\016W\206\251\302\023a\211;\332\036h\013\262\003\330\320\365\263~\252\035j\300t\003Y\n\342\210\025I6\273\273\322\312 \"\323\005\037"
+	.ascii	"`(\310\fg\3117y R\036\226\224\311(\3150\250\207\017\020gZ\372"
+	.ascii	"L\005\303e\017\320\016|\016|\016|\016|\016|\016|\016|\016|\016"
+	.ascii	"|\016|\016|\016|\016|\016|\016|\016|\016\274k\333\211\007"
+	.text
+	.section	.gnu.lto_.refs.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6bab9003f0afc9be,"e",@progbits
+	.string	"(\265/\375`\225\024\035]"
+	.string	"\032\231\334!Q@\220\322\031\016\336\023I\354R\334"
+	.ascii	"\303\305x\356\301H\b\342\210\017BbM\001\022\312\207\236%&\232"
+	.ascii	"\210\016l\360\206\b\",\217\"\022\311L\315\"\"\377\344\335\034"
+	.ascii	"B\263c.l\037\007J\367iQE\271\275\313\200\246\325L-29v;v\2232"
+	.ascii	"\005\301\001\b\002!\002\335G\340.\002\273\b\240WS6|\245\350\027"
+	.ascii	"I\3351KfW\024{\366E\333\264\347 \255\335\314Ic7\244\213Q\023"
+	.ascii	"+\"EgP\277(R\340\242H\027\314\206\331\365\304\226}qX\263\343"
+	.ascii	"\034\327^\231\311\236\327\026\243=+\"e\242\372=\221\372\236\317"
+	.ascii	"=\221j\255\251\332\022\264\264\261/;I6\264=\255\214\247\006\210"
+	.ascii	"X\030\217\023(ZHF\301F,\01760{\214\276\005\265\313~\355\272^"
+	.ascii	"\226\353\313e\273>b\355\366\322\335\337+^\273\365\301\b\242\373"
+	.ascii	"\b\026f\367\372\024\377\217\227\335\262[\276\365I\367\021\"@"
+	.ascii	"c\030\016\245\263{\035\341\200\003(r\353\r"
+	.string	"-EO\201\272\275\"\322\236\025\352\177\324\177\233[8M2wj\214\376\273\365/\326^Y-_Ri\331]\335+\bnKSB2\272X6\313\256%V\313\201V\334g\324\352+\335+\220\347\215\2257n\030}\003\3527\353!\216\275\342\254~K\244\373\334\022\351\327\025\221\252\013@j\2011\004\333PQ\024\206\3633\n'\\\375\371\305\007&. \2616$\340\237-\276\347\347\006Vxd\302\201?/\360/\221h\310c\300\277\"\264`\202\026\006\236`\037\211\347\363\204\207\177\3350\360\237\204\231\316\277u.\324\374\377\372\357\225\376\233\366/\013\377\302\370w\204\177-\370w\202\177\203\376\205\340_\007\376e\340_\023\377\222\370w\304\277\001\374\033\342_\236\177\177\377\356\377\347\377\275\377\316\377v\377\327\374\027\373\017\366\237\350\177\333\377\341\177-\377]\374O\373o\366\177\354\377\227\377Z\377\303\376o\375W\340\377\331\377"
+	.string	"\236\317\347\363\367\351\375\254\342\007\276\bl\334==\346\0072T\354\302\030=;=\237k\230VH&vzyy\273\247\266I\256r(\351}\367r\3368\331\362\030]7{#jI\234Z\252\306\244\2277\207\207\267N\265\273}\335D\3040u\252\260\234\020\321\341\353\304\261\332\001l\215\321m\2233\345\215+\210\0304\013\n\024\025\033\035\335\332\251\306ncO#\343\272\320\345"
+	.string	"Q3sc\363\265\373\232\037\0235$N\214n\335\306\335\200\242\267\324\302\231j\023'\206\203\372E\263i\324\354\032um&\240+;\324\234\r\005\205\002]\321\222tr\3375?\320\212\215\333\351&\201\363\303\314\310\025\243\373\266q:N\326\250\275\270\034t\230A\354\366\300~O\310<3F\027n\271\20685\311bt\335\320\036=\22660z\274\315\361i]\301\313b\364k\245\236\377\264\217M\335\355\204\263v\023r\347\213\263\213\342\347Y\337&\360\037m\237"
+	.ascii	"Q\272\177\334\335\251P\304\216Bn\242_\245\333\b\242\327nJ6\245"
+	.ascii	"\214\311-lJ\020k\033\031\240\233G:\271J)\321es\257\275\215$\245"
+	.ascii	"t!\271.\233\222\353\322\330\323HKc\367\252\354Iv\035\215\233"
+	.ascii	"lJ)\223\315\245\022D#\265\261\233G#*\322R\231D[*{\222\315\243"
+	.ascii	"2\211$\245\004\341\343\016\211U\216$RU\253L\"5\217\245\250cS"
+	.ascii	"\317Zr]\266[\367v\341\350\246\004\272\243\226MnG \373\005\271"
+	.ascii	"\306\003\351\345\270\334\265\273\tXBN-\033i-\031e\331\035\005"
+	.ascii	"9\243\227T\030\327\265\256\3325\343\221\250V\302\321]\300R\267"
+	.ascii	"q{\255\273\215\335\375k\212Z\273\203\364$\231KK\335P#\226:\312"
+	.ascii	"8\206\243\233\273\340\276(\223\315\251\345\317\030W\223\331I"
+	.ascii	"\253q\231\355&\325\2446\215ZZ\311Ne*{\2609\323\006\304\362A\325"
+	.ascii	"d\005\346\214\271\221\362\203\321][3_\266-\323\313\246b\331}"
+	.ascii	"\\6\240^*k\235\271\264\230\314\227f\247\215Z\315\364\023\023"
+	.ascii	"\3036\305\331I(\024:Zvh1\003v&;\217\001\255\270\234ZeJ\232#\243"
+	.ascii	"\374\345\037\240\322\310\350\302X\f\n\222&\025F\217\"\325?\240"
+	.ascii	"\365\244T2\312^.\307Q\344\224\352\030\345./\333\201R\343L\302"
+	.ascii	"_jSmHF\231\013w\355\3723\366z\332\004\265v\327\007\262$\2573"
+	.ascii	"=\3654\354\317Rn\236\267\220\021A\"u\267\365\225F\bsN\275\317"
+	.ascii	"\r\013\026^\321T1\317(Qb\222u^}\317\036v{\214r\226\215\343y["
+	.ascii	"Z\361*\253R\205\261v\213\020:!\264<:\276:c\261\036\335z\306("
+	.ascii	"[\331\270\345\342\344$\316\213\311\344)!\276n\354\3302+!mP\316"
+	.ascii	"SX\n\332S\222\022K\341(>\035X\356\304v\230\230\230,\371\206\037"
+	.ascii	"U\034\2301|\003?\361p5e-\b\330:\0028\327\326\003\353J\223&l\025"
+	.ascii	"\342\315N\021/3bN\316V\273\365\323\272s3FQ\242\204\227\344L\355"
+	.ascii	"\200:\3030-\251:/y\231\316\322H\222\323gDJ\212\251\026\252\202"
+	.ascii	"-8:~\013\323A\205\344L\225^\325\220V\003\243|d\213\350Y91\312"
+	.ascii	"S\227Cs\030u\354\360\371 B\204\227b\2308M\2708\265)r^\2521\351"
+	.ascii	"r\216\371\222A\202p\024wou\251PO\314\274\021r\216\022\303\303"
+	.ascii	"<\302\026\246\367\364\304P\334\313n\346\217k\n\213.GY\005\006"
+	.ascii	"\204\201\234\241V\253\307\333R\022\027h\340\312\324\371\360a"
+	.ascii	"\345\341\315\351\fK\214\231\230\211\235\324n\253b\372\314\224"
+	.ascii	"\330\254Xyv\372\220d\225\003\r\243\334\264q;]\354\332\332\354"
+	.ascii	"\031 \0257;\322d\345\310\301K\252Q\310\216\334\030\2623J\347"
+	.ascii	"\245\375*\362\205\t\243\274#\005{\003\273b\224u|N\007\357\315"
+	.ascii	"\322\371\204\221\214\344$\265\333\226\230i\335\325\0303\306q"
+	.ascii	"N\362\320\266C\2162F\371"
+	.string	"\206jf\313\021,\2142\322jy\020+\322R^\366c\f+M\t\033\003Ab\r\032\3500HD,\036\2451\320\030*\n\026\311\030\n\2031j\020\r\r\205>\304\243\032>\002\020\021\325\030\016\215\206\277\"\214\240\f\302\243\324\206\021qF\321h\370[A(H\204\026\203GE\301\242\224\0304r1c\250(\264ABph(\364B\214\013t\210\305\020\212GC\243\f\210\305\020~2\206\302\340\bG\301b\f\030\204\330\001J\021\364\243\303\342E\f\241\340\b\036\210FE\241\241\260\210\030taD\f\2320\243(,\001\001\031C!\261H\002P\250(\244\001\017\021\221\220\003\025(\305PH\030c\270\201\f!\006A?\"\200R\004\375\354\260x\021,\n\211%\350|\250(\034z\240~HH\f\016\2032\324\253\bz \210\005\f\277\263h\021A\213\b\322\263h\361\363\323\"\350G}\320\217\217(4c\b-\302"
+	.ascii	"J\021\364\243\026?\343\200\033\321\b\022}\212FFD\037\235\030"
+	.ascii	"\303\240\357\b\306\n5T8J\211E\032\276\"\f\026\305\241\260\306"
+	.ascii	"\357??\031\230x\001B\007\352\020\004+\324P\241H(H,\036\371\f"
+	.ascii	"\215\212\212\214\206|\206B\241\"\237!\342\221\017\004%\316\316"
+	.ascii	"}>\365\234\300ds\231\307;\234\235OAiJ)E\031\317G\203^\367\221"
+	.ascii	"\361\230u\3406g\274\003\177nU\222\307\364\016.\375\302\224\305"
+	.ascii	"\305\346l\007d\363dD\b\243L\307u>*\314\257\267\365rk\240\304"
+	.string	"\221ea\224\327\360\234\022\246\027\230\317\235\256\311\031\305\t'W\346\307\003\313\rU\034\331\207\265\254g\025\243f\316h\330\f\303\371\330\250PKc]\005eN\036\260 V\226i\316p\3477\240\025\374\305\303\243L\252\r\243\354\246\206\317\234\267d)\303\321\306(\267\235\267\250x\254\261\261\3255yZ\302T\217V\2059\343\020\206\313"
+	.string	"\225\272\225\332\207\324D\316\230\037v\314I!\031s.sV\033Rqq1\312ig\261*;\256$\032\213=\211\363\362\206Q>{`H\236\021=2W\302\346D\n\243\274/KY\314\022\231\224!\214\262\331\347x\274hQ\022U\206J\005\201\276\250\261(g\0345#\"#\"IARH\007\321\005\204\020\346\030Z\007\022@&)\220\"\206F\210$)J\251}\003\272\300\223\003\362\277\027}K\262e\301c\220:\375\035\245[\326\231\177\013\371?\313\222\243Q8C?Br\207\3702\335\235\310\001%\"_\357m\\\252\234\037A~0\310\310!\353\244\206)>!\227b_+\371U\202\325\005rj\235\252h5\320\316_\350FI\347U\022\305\217\340\034^\274\355\205 fH\343z\361\002\353{\032\354\316-\260] \340~\0071\232\360\017(\177]\307\024:!\211\334\327\b\004\034\371i\236\222\261\207P"
+	.string	"\341\214cW\217 \025\r\333\360Y\315f8\t\2047\265\2544\211\356u;\315\203Zy\314\035v\202\226\376\231\023\212\243\177\303\203\225\355\373\347\020\305\fI{\270\321\021f\037\310\202v\264\207\356\377\372\330\214\2026"
+	.ascii	"\360\031\037\\\376Y\252)\261-f~d6\t\213\277\245\272\035\352\255"
+	.ascii	":i\373\031y\376\247,\0251\030\252(\375\370~Y\332L\362\032s\256"
+	.ascii	"\001\253\3634\370\362!}\224\022f\355\241\0329\201\312\235\250"
+	.ascii	"\367\305x\262\316\312m\277Q\254\313\206\207\231\003\205\360\212"
+	.ascii	"\305\221\250@-\017/a\326\251\300\316\205\020/G\342\253\263\366"
+	.ascii	">\220\225\357\021c\320\342I\253\013\"\033\213\304\277\207\322"
+	.ascii	"m\346F\0331\007e\354\227\304(x3\001\361G\315s`\003\306g\003\256"
+	.ascii	"{u\375`x\301\377tw\333\365kN}x\020\334\2455\030#\245\225\357"
+	.ascii	"\021\343\274&m\346\234\"\374\024\314\206\261\03092\267\240ru"
+	.ascii	"\307\310!\361\303\304F^\3019\006\\.\346\224\323L\271\233\033"
+	.ascii	"F\3052\205\"K!\353\340\201S\277\341\340\372\252\026\021\bG3B"
+	.ascii	"@_\211\373\016\325\372\272\003\337E\223n>\344\240\320n\336\f"
+	.ascii	"j\274?\362\260\250\210\315\234F\027\005\224\200\202\327\375\232"
+	.ascii	"\272\247t\016\003\022DH\255\203^\202@_R\"\037'AJR\2500\307\241"
+	.ascii	"8\0218u\t\247-\202\022\233>%\354oc\3666\022&W\316E1\021\254\356"
+	.ascii	"+\276\337\305\fxB\307\023\241\213>Vj\030O\013\204en\220\354\314"
+	.ascii	" Xl\356\314\354\224\277\236\2445\255\352\223\377\325(\270A)\256"
+	.ascii	"72\002\224J\222\207\354\300\024?\373\262:\024^}\352\235\r\370"
+	.ascii	"\207\365\201/\017\274\225\230,m\244\344\177\213\372\207\013\307"
+	.ascii	"\r\033\035\033\374%\360\363:\352~\301Nx\334d\007\254\352\336"
+	.ascii	"\027\330\327\032\013\263<\235M\177Z\275\r\001w\275\256\266\267"
+	.ascii	"k\351\357\206\307\277\370H\266\314#\300\226\351\332\214\361\313"
+	.ascii	"{n\237\306?D\274\255\fp?/[r\331{+<\250z\262{t-\276p\303\331;"
+	.ascii	"`=\fn!\334\0316\030\330\rz\264\226\257\240MWwX~\245i\270\324"
+	.ascii	"\312\002\030:\321\306\275\354\237[\024;\313\r\200\357\206\247"
+	.ascii	"\332Q\332i4\363\272\037\330\237\017_f#\242\335\215\177\006'\367"
+	.ascii	"\036\334\034\316Y\020\273\210\237*"
+	.text
+	.section	.gnu.lto_.symtab.6bab9003f0afc9be,"e",@progbits
+	.string	"sbufInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufFill"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufWriteStringWithZeroTerminator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6bab9003f0afc9be,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,325 @@
+	.file	"strtol.c"
+	.section	.gnu.lto_.profile.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 Bu\001"
+	.string	"T\0026"
+	.string	"\004"
+	.string	"\356\251\224\234\013\f\002"
+	.string	"\001\002\001\001\245\345\200\302\013"
+	.string	"\002\256\272\324\254\001"
+	.string	"\003\321\312\313\372\t"
+	.string	""
+	.string	"\002"
+	.ascii	"\271\2046\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 \207\355\001"
+	.string	"4\002{"
+	.string	"\004"
+	.string	"\004"
+	.string	"\003"
+	.string	"\001\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	"\001\003\004\001\200\f"
+	.string	""
+	.string	"\001\201\002"
+	.string	""
+	.string	"\n\002\003\001\n"
+	.string	"\n"
+	.string	"9\207 $"
+	.ascii	"\0266\312i\250\270(\221vW@\213A'\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"=\005"
+	.string	"\"\212\037)`e\222\016PQ\226\277\210\255\031\f\002*\bx|\375\323\025\350"
+	.string	"`\202\210\024q33\210\212\035`\361\200CR\032\2212\005\377s\306+k\372\t\355\277\366\225\273\263|\237\216Zw'\230\254,\376\003\206x\321\251K]J\321\321F\343\341\274\247\r7\330\325\311\204\n\3672zw\227\366\017V\n\340`&\201\222\354o\331\237\224\306J\370\007~\371\325\332H\333\2040"
+	.string	"\220\210\364\347\247\231\b\017"
+	.ascii	"\001\023\307*\202)\013\364\221\310C\031`\020,\346\026cc\253F"
+	.ascii	"\300\324\013`\036\3160\250L\313%\214\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\275\003"
+	.string	"\222\206\021\032\260%\351\f\243\034\340\b\036\206\205\"\2355I\034;jy(mkj\023\231R\036\207\022t\241\220Z_\fH\301\362\215N\2731\244\327j\300_\036\361\207Mf\330D\241\367 >\310*i\322\326\324N\376\307\361A\022"
+	.string	"\030s"
+	.ascii	"\346\024vlo-\033L#\0253\r\310\301\305\n\005\351\242\232\215\021"
+	.ascii	"(\301\034\230\331\215\244\bv\223.=\005'\205\025\r\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\230\004\002\230\004\003\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 _\365\001"
+	.string	"\324\002S"
+	.string	"\004"
+	.string	"\004"
+	.string	"\370\007\274\007\374\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	""
+	.string	"\002\001\003"
+	.string	"\374\007\274\007\240\304\300\377#\002\003"
+	.string	"\005"
+	.ascii	"U(\204M_V\225\227\335\b\033h\003"
+	.text
+	.section	.gnu.lto_.lto.bdf0654b9cb18726,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__strto_l.3.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`0\016\025M"
+	.string	"J\207\214\035S@\022\346\244\003[w\315\265\3007\261\262n!@,t\347\372\003\237BE"
+	.string	"\020\3327\343\037\346d\037&\240\367k\355\222\301\354\"p0\343y\344\300=qNa\337\201\330\023;/\306\027\024\240\235\344\f\221\352\377\357\253\356\277\355\253\276\233\231\265\204\220$\245\f\315\001\240\001\303\001<\2647E{Q\264\367|\357\337\333g/7p.\3074\233\265ZG\270[\242\306\241L#\334\204\371\ts\024f)\314l\274\313\314] \357j-;a(\254\306k\334\266@\266\245R\334\032c\263!e\251\034\361\244)A\024\016\242\214\037L1\2434\037xB,\276\326\344\030\333\002(\236\264\270\t\361\254`-\300zh\326z\246\304\350F1Y\2673Xw\250"
+	.ascii	"\266\342\275\3138\360R\213sX\267\365\325*f\307Vk]\332\247\036"
+	.ascii	"\243\305s\373l\003-L\334l\306\001\323\324\032D\215\255\326\263"
+	.ascii	"\245M\3521\3126p\231\326.\225\2343\026\276\006hrD\363R\353Y\323"
+	.ascii	"\236\3610e\264\307\302\224\321\257\2607{^\213\215\212\210\206"
+	.ascii	"\204\202\200\212?>\304\036\236\035\235\034\234\233\241\215\260"
+	.ascii	"\206&8#\023\003\003\374\371z\274\024=\337Z\3133[Gl\261\321\032"
+	.ascii	"\027\255\265Ii\"5\036R\213\322BP8\350\t\023J\0039\341\342)\374"
+	.ascii	"\021\005\013\313u99M`y!\254I\377\370d\001\361R\226\204\330W\013"
+	.ascii	"L4\353)S\322<r]60\222\256%\275\243\223\244\206\316I\30284\030"
+	.ascii	"\351\233\364\213\214\207dl\263\244H\013\201j\2104\315\221G\202"
+	.ascii	"CX\350\231\261\023Z\006\270\374\200\b\261\2571\216I\232\3200"
+	.ascii	"I$]%4\020H\377\316\244\344\017=X\256k\354\034^Qa\b\366\311u\375"
+	.ascii	"8\213@H\272\302\272'\366\005\306\274\237\227\017N\271~^\307t"
+	.ascii	"H\304ml\201\304\272\300\216\236<\017F \223\361\362\340\204\252"
+	.ascii	"k2\221^\306>\217\364\340s\0337\020\262\345\334\023\257\036\334"
+	.ascii	"\274\250Z\3536\b^_\274G\274\333q\273{"
+	.string	"c\027\370\026<\002\276'\032\363\244\013\322\3643\226\350\317\247\347/\307\036A^\2674\352\350\373\313\221\251\304Q?\177\037V\216\314\035\230\373\013\021\275+\027\250\006\2272\023S\236\032\031\272LL\00382\346\004\374oi\\\314\0033\034\021\332\022PxWRan\343^\020=\304m\365\227\0329;!\351y\"=\346H \022\356\344\373\216\374a\271\312R\220\255\016\341B\255=,\373\260\\z\265nqR\2113H\265P\250H\350\232\025\205\212\364\266\273\\\230\223\313\245A\250H\214\372>|\213\333\321v\350\225\313m\374b\214\313\031\370\236\315\342HG*\361\357B\313\216\256[\231\356\357V\331h\006\341/\356\370\326\362\373\034\304\321NG\337\355\362\024\255\"V\275\"\313\034\244\214\362Q4:d\230\216\263\326Z\317ub\2443p\035#\3069&0\030\373\356io\036x\375\312\335\263\255\206b\241\256\271\017\262\313"
+	.string	"\257W\006\2371+\020\203\2310'\200\300T\257\027F\257\367\005K\341=\200\233\360\032\340\242"
+	.string	")\316\2019\212\200^o\0136cf\301\353]\301\353U\321\353\205\022 \305S"
+	.string	""
+	.ascii	"\240p:\321\304\3049\360.\231PJB\372\365\036\375z\215\320\336"
+	.ascii	"\"\264\227\b\355\035\342\365\n\361z\2038\n/\020\263\361\026\177"
+	.ascii	"\320^\037\264\227\210\366\366\274\227\247\327\273\343\353\325"
+	.ascii	"\351\365\346\234\2758\274\336\033^\3570\355\265y\257\360\275"
+	.ascii	"5\357\2459{\203h\357\f\332+\303f\2741\357\205y/\360\354\375\235"
+	.ascii	"\275>~\302\333;{\003\317!\272a\312r.\315\216k\255F\034\233\247"
+	.ascii	"\357\260\367\024N@Gq\2441\354\270f\263;,\236\351\310\265Q\372"
+	.ascii	"\236\303\237\233P\301V)\316\231L\b\316y[S\214sP\302tp\327Z\271"
+	.ascii	"nd,\227\034\327\2101\276\247O\212\367\270l\0062\237\251\003\035"
+	.ascii	"y\263c\032\221\233,ctr\\\363A\340\305#\2338u \020I\216k>S\377"
+	.ascii	"af \266\340 e8<7\371\200\243[k\3069&Inn\300q\214A\f\257\305K"
+	.ascii	"%\2759s1\227>\274\317K\312r.\255\006\233+\227\267\305\314\307"
+	.ascii	"\242i\244\336A\251w\214\324\201[\314~,\356\024u\036\331\241\246"
+	.ascii	"\267'M\324\235d\b\262\234\217\206#<b8\216W&\352\373\213\372\322"
+	.ascii	"\221{\372\222\3365R\007\322\301\321H\335IH\320\305\177F\354b"
+	.ascii	"\n\210A\007'#\365=\177IW:2\210\217R\233\317XV\021\336\346\354"
+	.ascii	"v\264\353`\351\302g\375\230\343J\032\373Nx%\307u\351\252y\020"
+	.ascii	"\246\020^\270\001K\n4Wf\341\244\273\270\003`o<G\245,(W\363>\202"
+	.ascii	"\246&x\232\247h\301\363\320\320!7T\231\2319\233-\265\374\374"
+	.ascii	"\314\377\345\330C\216\243.sN\202\255\035\231?\035\2145\310\\"
+	.ascii	")L\223^\300Q\037w\\\355\203\004!1W\256\027\230\267\3312\013\360"
+	.ascii	"\273T0\277\003\217\272a\321\"\302\277\247n\234\306\020B\023\346"
+	.ascii	"\312\345+\234\276\227J,\2658q\322\245\216\"A\307\005\203\021"
+	.ascii	"F\313\017+\300\023l\225\362\216E\204\367\277\315\301\325"
+	.string	"\030~Wns\033\013\267\320-\263\354\350:\356\351\241\204\006\037/\2003\034?\035\311m\f\303\b\217XU3n\\\200#M\261\250(\240\021A\005VT5|U\030XeQ\331\250\302\321\313\262\262a5A\0045j\\e]@\003\306\006U\0055r\240U9\250f\234XY\026L\200\243*\305\312\312\361\245\301T\301U\026VV\216&\034W7n\\\321h\302aEu\243\211\006V\216&&\236\275\262\240\n\253)\353\352\n\253\txV\231\350\304\273H\306W\254xQ\307\215\247\321\321e\234\207v\2643\372\321\317/\\E\234\270\021\212$I\307EW.3\331\347\202\222\344\220\212\357)\324\364\023Gz\031a\006\242+w\350A\266\203\366\216\275\330`\007\244UU\034Yt,\242\017\275\350]\345\b\246\342M'\372\2158\226%\360\241\257H\246\035\247\030\373N\350\312\016z\0208\026\340\314da\023\211+]\200"
+	.string	"\002\340\313u\035`\211"
+	.string	"F\210Z+\027\031\302#.\251\004\314H\006\261,\305\235\024_\341\323\0058rwP|\205N\007\340\310=w\230\316\023r\027n:ry\203T\201\347\360X\362#\364\240#\360\243q%\241.\304\364\341\203\316_%\254q!\201\252k\352\340\323\342)\036\303(\005+\313\271\264\004\336\342\333G;\035D\232muD\237\263\220\245\026\342{\356s\024\355\bf\300\241N|\352v,3\366]\3175"
+	.string	"Bwd.\021F\\Y\241\347\312=\340L?\022\241\313\022\316\304\247\016\001\0205\236+\267u^\274s\216\230\230r\221\030x\340\3008\324\221K\3479\213-\255@\235\347\020\204!\321\333\263\255\343\316\020&\246;\177\241\363\2353[\230\225s\317j\335\322\211\343\234T\347J\"\250\260\204+rN\212s\2353\tao\235\303lLLs\016\343\017\204\245q%q\002\201$\250a,\003\rcH\031\222\021\221$I2\034\001\005\304(J\241\274\r\021`\271SY\223\2441\337"
+	.ascii	"%\022\003AqC\363\302_\236,\244\375ib\337\251\026j&\327@\030\325"
+	.ascii	"F5<j\3275\3710P\337\f\200Ja\300G}\316\231JD\177\\>\233\2215Q"
+	.ascii	"\023#\317\216\020\350\206\223"
+	.string	"i\007/V\236\364\216/\\\303\032\376\334\227\312\316\r&\332m\355$\031\007\227\366&\2541l=sy\036{\227\341\312\320\030\304=l\354\"\345\201\006@7\004Q\252o\034\203\213I\214\fj\371J\3110\333L^\326-\020\002?\326\307\242Xm3\323\301\252x\342\221\200\275fH\342%\362\222\310\210\226s\226!\3639\036?\323$\3503\230\210\274\210}\210\0367'\016\324L\234\221\242\037\363\261K\361\341b\2200\024\315\326\200\312f\274K\022\314\377\202\345\236\n\205qf\016\251\223\364H\314\274"
+	.ascii	"\204\356\3100\357\272q\004T\027\327\021\026+\331\333b\324aD8"
+	.ascii	"\"\2048\363y[\024\376\342\3272\336c\217\327\232/Wj\247EY#\031"
+	.ascii	"\316\304}y\305\356~\347\365uF\353\315\307; \2152:\022\232i-a"
+	.ascii	"\2137D%\214\254Z\361\207r\224(\320]\202\035\\\211\300%F\377\270"
+	.ascii	"\362Y\203\362\034\030%\366\217\037\327\242\214\007\304K`x\032"
+	.ascii	"/\035A\033*C\360\347'\240\225\204\336\013\373\013\327\216Ab\226"
+	.ascii	"\220v\221b\002\356\303r\275b\325,\326\310\2475\317[[\001|h\021"
+	.ascii	"\307\212\311IaNh\021\342\230\332\235R\032fVm\0268\251^\240lc"
+	.ascii	"\207\027a\372\364\037\206\241@Fb\022\f\315z\244\341A%\340\fL"
+	.ascii	"\250\350\350;\266\005\363\355\013\346\212\237{\302\007\315fa"
+	.ascii	"\372w\276\005E/\353\203\346;\366V.\277\271{\313\366r\256\021"
+	.ascii	"k\263\346RB\342\372\360\242\227s\033\331\245\210s\337\021-\234"
+	.ascii	"\235\237\024r0%\032\234\017)oR\023\255\t\237\202\253\345\376"
+	.ascii	"\021K\333\\\240\310\262:\203OI\364\257j\213\214\342\254\252A"
+	.ascii	"r\021\2624k\37225\342\262\235=U \221W\035S\001"
+	.text
+	.section	.gnu.lto_strtol.4.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"\235\t"
+	.string	"\266\323C7P\215\322\001g\026\0251\355\002@\357\334\034\261\207\025\210\362_}#\257\336\033\376\207\330/\002\265\261\006V\275?3\323\246Yz\373\355J(\016\253\325\f\022\273\267\334)\0054"
+	.string	"3"
+	.string	"0"
+	.string	" \236]R\360m\230\236r\215V\256\335\235\376>`\271\314.`\271T\215{\207\236\377\325c\307\005\t\251\024:\304\032v\327\220T2\335z\333\b\266\031\354\023\004&R\204\303\266g_l+\264\037\362\224w\225G\f\260\213\201\322\332\335\214\027\262KL4\374&X\232\303\243(\036\260{\362h\355~\031'd\227\266\375\217\007\316\240\302\245FU\265%8x\322\0253\322\220\375\205\240f\330\217\273\273\326\223-\241\261\253~\371\357\217G\375\032\241\237a)'\007\254]\213\227\312\006\035n\343\020\267\016\364\360\351X\266\216Ss4\021Z\267u\334\374h\036\217\306\231\037\210\215gr6nj\f\254\201:\333\3544m\233\227ooc\212\021i\205\257\230~\264\"\202\257\r"
+	.string	"2\003\302\260#!hu\315\356\317\004\201\023dh\030(\202\306"
+	.ascii	"\n\240,\016?\363\230\332I\006"
+	.text
+	.section	.gnu.lto_strtoul.5.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"]\t"
+	.string	"\206RA9@\305(\035\340\345j\t\363\214\340\020\353\377\261U\"\301\377\340\032Y\237\013\256H\240\017\262\r#\354\306\262\254\376\227\216afcy\254\032\343)\310\302\314\213\361\311&[\356\224\0020"
+	.string	"0"
+	.string	"."
+	.string	"\006\323\303\204\255\260F*"
+	.string	"\273Sz\276 \376\272\234 \376\322\216w\177\235\177\325!\210F\213T\022\375a\016\273\353G*\231n\275\355\004\333\r\366\261\030\333\372\354\217\234\244{\312'\016\330\335`\255vWc\206\313\257\f\364\233\024,\233\277\243*>\260{*Y\355N\215\025.\277l\373!\027\351l\224\252O\355m\342\235\02453R\221=EO9\354\303\325\223\r\237\343S?\374\374\365\250\377a\002\031*\b-\273\030\255"
+	.string	"\233r\231|\330\356\354\236\215\363"
+	.string	"5.\004\001\362D\215\333\324\235\215D\306i\334&A\331\347\223u$(\202\363\221\035m\223\233\003g!\217&\271,\323$f\356\355\250\031\013\2750\366\026\0165\016"
+	.string	"2\003\202a\354*\020\327D\211-t\177&\b\234 C\303@\0214\006P"
+	.ascii	"eq\370\231\307\324N2"
+	.text
+	.section	.gnu.lto_atoi.6.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"M\t"
+	.string	"\346\022B9@\305(\035\365\211N\032\200\324Vz\247X\212\377aHy\034]\201\341\355\\re\266\201\336\206\021\320\312\262\304\027\363Q\365at\275\216\335\234\321$2\217J\030![\356\224\0021"
+	.string	"/"
+	.string	"2"
+	.string	"V\305I\n}\004\372\210\260vWV^\200\375\212'\300~i\306\277\303\317\177\351\007&\224\347d$\3049\f`\330]CP\b\343\326\333F\260m\261\377$\033~\310O\233\233\254&\024\307\356j\033[\373u\373\2635\333\207\366?\016\362}Z|`W\244\221\332\235\026+d\277<3\333~\307=>\007\013\027\270U\230O\201A\365O]\005<(\352OoHY}\224cO\017\324\221\375\270*\262#tTh\375\374!\346\220b\241$\224\354^\264"
+	.string	"\354\352\n\234\327\2511\027\211\315\343\274Nj\266Lf\303HM\304CFb\270N^\f\274M@p\322\3336Nj\263s[\265\322Q\217\243\252\276tH2\371\004\350\300\2263\030\013"
+	.ascii	"2\003\302\260\307B\330\256\211\022\232 M\305\013*\250\275\n\r"
+	.ascii	"N<\251V^\302$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 \330\235\003"
+	.string	"\202E\024\037\300%\035F\367.!\340\353\272^\307\372m\373M\034WU\241W\005\273\322B\366\336[\312\235R\275s\212\361>\204\031\r\f\t\354\035\314\211\3204\3549\3203R\371\177\233,V.\253L)\021\376?J<\314\013m\266\007\200\027\201\242a\336i[D\f"
+	.ascii	"\200\210V\025\216\b\003`\262\346S\331D\246'\026\f\227=@;\360"
+	.ascii	"\271\235\030\323`\342\001"
+	.text
+	.section	.gnu.lto_.refs.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bdf0654b9cb18726,"e",@progbits
+	.string	"(\265/\375`T\006\315%"
+	.string	"jFL\017H\200\234Q:>\265\001\260\342@2\240T\267H74B\330L\rU\306%\202Y\3745o\n\312}\205vk\004]\346\204W\272\270\r\242<\202\03413U\367?\207\245D\006<\023i\312Wdc\277_B\220\267\334\237\310\024\305"
+	.string	"\331"
+	.string	"\360"
+	.string	"\272\256\254V\252]\260'K\365\221\250\226\355i\325Lf\245\324\260\306\033\362\376\234\205\365\363\224EdC\336s\313X,\207&Ok\310{\276\372\200bW\270\255\370s\024\236b+Z\312\264\266V7\233\273E\261\001\304\b{\353\351\252\303\244\211\274\\\305R\316,S}B\205\323\316bOu7\263\024\326n\224\331\233\235n\364\306\f\304\ft\241D!\251R\273'\313\263\\\240V2\201\232\227\030U\3713\223\377X\314z~\036\202\346\315\177\366\377\210\377\006\376/\370/\342\377\203\377d\377\245\344~\326\361\277\315\377\343\177\261\377`\376{\375\337\372\337\376\007\361\037\353\277\325\177"
+	.string	"\377\301\376\363\234\235\235\235\375\374\377\\?\317/>5\346a\206\360\3770\215\035\374\277\335\377i;c\003\355\300)\225dA\237\310\373\277A\007\365\206U\355 :\314\241H[\025\207e\034\276hT\315\245l7\006V\355 \273\236\270\016#\252i\020Uq\335\366\231\366\332\r\322\026\245\321,q\230KY\3420m\211C\\\332\256g\367:d\225E\3174H\304\201K[t\330-\361\314\245m\221\262\251\026UM\234$\r\266\f!\024\252\342\214)\273\366\261\233\265\226Zu\320\r\265\252G\024\007s\001\2152\200W\320\225\331\356F \004F\255\0354\246K\326\356%@\243\026R8Yc\017a\343\351\003\252\231\226\272\0234\333-\354>\271\215\335}v\267M\205b\273s\340R)\241\260\333\351\200\260\241\316\256\245nRK\r\3270m\243\326g\376\236"
+	.string	"U_Ke\202\224L\346\\\346\357a 2\214d\210\345\317c\376\036\2372#7\210\350(\317Maa,\206\300\351\302\017\030d\245\215\036(\2210g\261/\236\263\004\016\021.\336\234\324\2111\246r\341\302`H)\333\2242w\310\004x\335\020\332\370r\006\003\026 H\265\364\205\274\354\245K\312\305\305^\345\331}\262=\203\257\350\270\310q\307\224p\341\261\345\354\025\366C\325\203\252\311\313Z\270\370S\243\311\213#y\271\213\263hn\204\250f\370,\317SX\353L\205[\246\302[\307u7\260{\007\217\001\347X\226\031\235vr\202P\213\363\204h\205\345\274u0\237\356\005%*\005\252%/_\341\""
+	.ascii	"\251:-\030y\331\ng\335\310\302\230iA^\256b\003\023\213\342A\336"
+	.ascii	"\307\371\327m\352\212\022\206\274\377P\222\177\255Q\265\273i"
+	.ascii	"\360\260\255\002\003=\323\314@\202\207\267+JRR:\262\335(\210"
+	.ascii	"\227\304\342G@\205\3513\372\231H\266\022E\274\336\345\371R$]"
+	.ascii	"\037O\205\3313\177\266#\363Wt{)l\275\332\025\334L\342\371\204"
+	.ascii	"~\246\351\023\n\320#A\242\374\356\310\307C\342\231(Oa(\302\220"
+	.ascii	"\205\025\266[ \222@$\241v\013D:\035\321\220\256\374\220\216v"
+	.ascii	"\235NC\203\020\036:\224\273\240\236\371\363\375\224\204\220\314"
+	.ascii	"\023'\314\235\020\322Q\321\t\241\235OI((\201\257\310hw\341lu"
+	.ascii	"1\242\243\212\331\321g\252(g\007y\271\214d2~s.c7>A\226\313n7"
+	.ascii	"\312\f$\200\031\210\347\353\bzU\273g+j\316m\324\3601\227\262"
+	.ascii	"\315\324\264`\357\020\223jj,*\344e6\274\346\2524\236\307\214"
+	.ascii	"|\274@04S\237E\006ibT=\351\324\t\202\217\225\033'b\320\234\217"
+	.ascii	"\267\247\037\303 \2339\007m\250\221,E\0344DfjDF\n\232T\007\240"
+	.ascii	"\002\221\251\2639\021\300\261I\025F\223\202d\2179j\006H\376\246"
+	.ascii	"\264\t\251\003\355\255\221\237q\200\304\271\231HI\242\373\211"
+	.ascii	"\b\214\343\2256zrf\372\220\311\213N\360@\034\307=5\\\314D\314"
+	.ascii	"W\374\226\261\306W\023\245\001\243n\346\231\022\245\227\312\024"
+	.ascii	"\325\034\003~\244\212|\2521J\206\246\3372\202\331\237\b\220\361"
+	.ascii	"\367\025\372\265\030]\177\200\004\236\006L]\004&qPh\035Np\240"
+	.ascii	"w+\273\336P\t|kb\033m\263\267\251\3266U\"{/\022\027\222 [\265"
+	.ascii	"$\251evl\241\364\021\225\235\235\016\037)\203\"\343'\357Qb-O"
+	.ascii	"\001\244\213\267\006\027\032\302\306\265\342\245~\317\254\211"
+	.ascii	"\201uj\333\003F\217\201uvv={\313\300\307;H2\360\245\006"
+	.text
+	.section	.gnu.lto_.symtab.bdf0654b9cb18726,"e",@progbits
+	.string	"_strto_l"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"strtol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"atoi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bdf0654b9cb18726,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,983 @@
+	.file	"time.c"
+	.section	.gnu.lto_.profile.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\305\b"
+	.string	"\244\f\312\001"
+	.string	"\031"
+	.string	"\232\324\333\212\f\020\002"
+	.string	"\002\001\002\003\001\243\214\302\266\b\002\255\263\333\322\001\024\001\003\373\373\217\353\007\016\002\002\001\004\315\203\200\366\013"
+	.string	"\005\320\272\212\332\002*\002\002\002\004\002"
+	.string	"\002\004\002\004\006\346\307\273\333\001\004\002\005\002\005\002\006\002\006\007\352\263\360\321\b\b\303\243\360\202\004"
+	.string	"\t\211\242\243\201\017\002\n\251\324\331\213\005\013\326\225\305\221\002"
+	.string	"\f\216\215\301\347\t\002\002\007\002\b\r\240\342\234\212\n\016\305\237\224\203\017\222\275\371\270\b\020\331\345\253\313\f\b\002\t\n\021\354\242\3530\002\022\221\335\225\216\r\023\266\200\366\276\b\004\024\211\307\225\365\002\024\025\364\235\311\257\t\026\355\314\246\334\007\027\352\231\201\312\b\030\240\342\234\212\n"
+	.string	"\" `\002b\322\034\003\fR\343\007\260\022\203,"
+	.string	"am\200\331a\374+9\266x\334\312\363\266\022\211\316t\371f\375P\001x\027\356\n\301\02261\360\262\217"
+	.ascii	"t\0348\n71\007\354\007\350\rH0\200\341~\006\343K\334L\332\035"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`!\001-\006"
+	.string	"\362\210\027\030\220\245I\007\272\273\273\273\273\223\032\262\b\021\364\177\255\245\335\244m\271e\n\333\037B\332\307s\340\r\202\245@\017\3501%"
+	.string	"\r\252\216\370K\252T\020-vh\027\022\020ij\337\322\215,\204\327\022\354/!\315\023\377\020\022\371\303\347V\353Kj1\207dd\021\252G\244\211\n\032\2701\035\001, p\2022Ry\003\314A\304\312\006\214\034\026\310a\270\251n\033 \325@"
+	.ascii	"\353\001Q\r\323\030\031\330\t\254\223cv\b\230\320\311\\\202\233"
+	.ascii	"\0328J\b,xV\233\"\374\273\2036h\0252\r\202\005\271\227`\030\200"
+	.ascii	"\002\260Zl\261\276'\001 \032wu\030\037\214Ly\323\216\3438X\215"
+	.ascii	"\310\016\210\366\027s\b"
+	.text
+	.section	.gnu.lto_.inline.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\213\006%\031"
+	.string	"\026bmC\020\217(\035\005\004\272&\236,\306,\034]\344jl\240z`\354\027\005\340#\363\t"
+	.string	"\325Lzu\004\002\257i\374\267\377\205>\022\201\024\020\005\016*\240\257"
+	.string	"\250\271\255\256\366\333\222\362\255\265Mb\267\2242\005S"
+	.string	"^"
+	.string	"["
+	.string	"\252\025e\366\207\272\224\234\220\024X\333\231f\246\363c/\224\234\220\020\260\352\365\326\274S\232\342\377\306\232\347\214\322\326\177\214\225\333|\332\265n1Bh}~VSZ\255(\275l\325\376\277(\232\363z\023E\333"
+	.string	"\217\326\034Mc\316\325\256\374\327\260A\306\026\004GP\342\3407:\266_\317\301y\304\237+E\030M\213\301\330\361N\333\372\031`\326\367~\353\363\320\264\376W\360\177\304\036m\334b*F \251b S\002\344\007\321j$J\246\207\3244\304\031#W\2275=\220q7\271\272\264\354\220\035\005\321L\344\307\325\321\020\207\234*\245\320\372\210"
+	.string	"\357s\017\032\332\237\214mR\347\214\f\032\2368\216\216\2515y9\261\0202\3676?\323\276`\301\302\342\362f\324\373`\266=\232v\202H\217&\330\270<*\262\266\263tE\025Q\214\223\265,\0212<pK\2031\251\313$u&uj\233s\322\324r\242\246\246\223\245\016\376G?\216\374\277\005F\275\325"
+	.string	" \355\224\216X\261\241EV\002\205I\013\210\003\f\021\0232`\310\244\t\332\253\324\345\204JK\306\037\265'\245\202\311\013\264Y\213\"\201D\210\217z\245\001\004\f\231\343Zs\311\177\215;\227\332\305\177\315\234g[\273lw\3773\336hl\357f\226\261~4Sz\270YA_&u\233\005\200\262\250\021=\310\224\b\211\004I\222\244\320\001p\002!*\"\363\022\200\025EJR\251FDR\220$\205a\377\r\266\205\262\032\020rd\200\205\002Xka\030\272-j\224\0162\033\373\376a\227\353f\335h\245\001\370\223\\K\\\021<\366/\244\365P\337\020\215\336\326&,"
+	.ascii	"\321\207\201C\3333\022\\g\352DY\265\247O(\305\017\274y\225\247"
+	.ascii	"\263\322\274\262\005-\2058\t?\377\367\356\314\201\013\357g\314"
+	.ascii	"\240L\340\210\fG\322dJ\341M\\\264\370Z\223\331B\360,a\351DNd"
+	.ascii	":-\032\211\201@ \035\361H\021mb\325,\344\222\364\020\352\314"
+	.ascii	"+(\266j\227\221&h\252g$\245\347\306C\222d\200fs/\311\225\313"
+	.ascii	"\030/Z\253Q\032W\277\rfTQN)\255\335\006\214\340\n\246\036\342"
+	.ascii	"\213\331\203f\261\322\023\230\325qR\307\265J\377\323\347\262"
+	.ascii	"8[;\204O\323\250\367\215\301\213\303\f#\215\261\214\313}2z`\022"
+	.ascii	"\007\260Yq\204\n\243e(.\205\276\204fUL\312\240\035!%o\304#mU"
+	.ascii	"\270\017\310\242\037\365\006G\202\326\211\001\215\216\346}\276"
+	.ascii	"2\230\017}\"\fLi[\027\001\341\230\373\367\312\016\230\360?`\316"
+	.ascii	"\227F\223@\325h\247<:\320\221\340E\211\024\230p:\256w=\302\035"
+	.ascii	"&\347f\211_\207m\177\207\241Li\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\003\003\375\n"
+	.ascii	"rN/0`k\222\016\335 H\330\242\260\230 \b hN\201\332z\306JT\303"
+	.ascii	"\360^ps\252\302\260l\030K\2179\200\201o\277\207\242\337\332\260"
+	.ascii	"\021!2\355\227\200p\030\214\0135]L\233\007j\262`(.\324\324\260"
+	.ascii	"\201\240&\313\335\006\234\273\340*\305R\356&P\023\312\214\204"
+	.ascii	"\222\031\b*\260p\237{\324\243o\004#\204\"M\312s\330d\217\227"
+	.ascii	"g`\367\370\216\373e\305\323\241\244\313\004\\\016_\354\272r\r"
+	.ascii	"\276\006\373q,\236\316\n\354`\322\224\242\366\220\377\006p\266"
+	.ascii	"FX\225\006\310\206\204UUU\365}`\317\263\315\272\233\365}\331"
+	.ascii	"\232\364\035\363\263\306\006\2327%\337\336c\177\225\233\270c"
+	.ascii	"\034\001A\250\021Q\250d&\220P\242\fc`\242Q\b\253\007\022\340"
+	.ascii	"\3624E@t\234SN \326d\226\277\305\325\006\bK\3321\016\277B\254"
+	.ascii	"\016\223K#\177\264\376\220\325\315Is_Q\257\315\3379\200\344J"
+	.ascii	"m\270?\321\304\177\345\0215G\222\346\240\252\375\f\321\\=\234"
+	.ascii	"\223\320Hzr\267\024\306:/\3159\303Y!\374'\214%\275\377T\304="
+	.ascii	"kE\021\350\307\237\030\"/\264\344B2\2471\274\004#\356U\202\230"
+	.ascii	"\302\251\007x\257\201I\277\255\241\262M\201u\313W`\260\027@j"
+	.ascii	":\274j\353\345\232\001"
+	.text
+	.section	.gnu.lto_.pureconst.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\205\004\002\232\004\003\205\004\004\230\004\005\231\004\006"
+	.ascii	"\232\004\b\200\004\t\205\004\n\205\004\013\230\004\f\230\004"
+	.ascii	"\016\230\004\017\230\004\020\232\004\021\204\004\022\230\004"
+	.ascii	"\023\231\004\024\232\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\013\001\235\006"
+	.string	"\262\310\034%\2207\351P\325W\335i\325v\177\247\375s\274\341\273\257\356\372_ER\336\210\335\330\220\020\033\033\261\273[#[\246K\221U\003t\001g\264\335\243\266l\\Y&\246@\302"
+	.string	"\201\375\200\025\340\225A\026\243\023x\300\237\347}\260?Z\027&\262u\242P[2\034\321\202\271\244j\236\222uOSby \376y\177\357;\356`\325\274{\037\227\260\177\222\035\272[' @B\344\324\361\001\310\007\030\257S\333&\"\342Oo\"\031\003\254m\224\023\271\022\201\004\332\3205\300w\353ir"
+	.ascii	"\211E\257\267I\030p\315`h\001\004\371\303\3512\2344\020\3451"
+	.ascii	"\003\"\264R\34613\017 <\222\005\322Tc\024\003\250N\300\203\030"
+	.ascii	"q\0200\007\254k\250YO\003C"
+	.text
+	.section	.gnu.lto_.lto.66aa276c037f2467,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_days.14.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`|\001\305\013"
+	.string	"\206SD<\020%9k\360\3140\202<\001\371\352\336\306)\343\224q\366$9E\020\371\367}\263\221 %\250\214j\200w\316\373\002@\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200,"
+	.string	"\304\325)\320"
+	.string	"\025\200Sk+\2737\3556"
+	.string	"2"
+	.string	"4"
+	.ascii	"\243^\027\231}\344\366\324\270j\2440l\341\201\341\340+B\211f"
+	.ascii	"]\203w\361\235\367\005\036\002\b\035V,\232\002\016[\213\002?"
+	.ascii	"\213\207"
+	.string	"\340w\200\264\b~\2719\256C\b\253\317O\310Y\243\243\234\236\262\272\312\353\255\331Wnw\215\263\\\327\r\"m\254@\233DF*D\203(m\272\274cs\217\317?\310O\243\203\234\036\262\032\032\235\312\345\362\327\346\260\317c\344/\243\303\234\036\263\272\314\353\262\331g\267\317\214\323t5/\302+y(O\3669|\030\337\351\213}\001\256\305-K.7\331<\334$\263\267\334^3\3563J(\260\271\234\266\371\315\3475r\234\321sN\327Y\335\366\372\316\354\267\333y\306{8\002\003\316\305\001M1\307\254o\335D\027< `\023Qs\363IQ(\262\022m\207\024\346Zk\245]\333Zi\327\264&\332\f}[k\244]\323Zi\327\264&\315\265\255\21168t\303\266\326b9n\230\333\206\030w\030nS\f9v.\002\373\240\337P\260#\367\016{e\316e\035\001v\343\260{\337C\333\001\273\256\252\f\211a"
+	.ascii	"\370#\261i\250E"
+	.text
+	.section	.gnu.lto_timeConfig_Registry.18.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bi"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\277\254\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\344\006us\375\005uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\216\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/common/time.c"
+	.string	"\004"
+	.string	"\236\n\013fq\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_timeConfig.20.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_dateTimeToRtcTime.21.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\353\004\265\035"
+	.string	"Fy\303H\220VN:\205O'\017\001\376\222\336\264\fb\373;s\237\253\002\257\243\231\364\246+Xo\342"
+	.string	"2\376\375\347^\264\363\320\364Q\267\216\030\300\020\334$K\217\363&\270F\320D\273\177\224\372g\252\377\377k5!\233\020\271S\n\254"
+	.string	"\233"
+	.string	"\265"
+	.ascii	"_?\330\037\366\217\235\264\357\003\271\231\2353\210\227y\261"
+	.ascii	"\306r \354\334\307\333K\276\326\271\356u\037\377q\261\22397V"
+	.ascii	"BB\230\t\b`*\034|I1\350\332\361<\271\324\247\027+n$\330\332\201"
+	.ascii	"i\261`\253uh`x\254\245g)\225#N\224^/Z\260\325Z\t|4\201\362#\217"
+	.ascii	"\370\030:\347\257D\374\245V\030je\265\016\013xW~\264\355\367"
+	.ascii	"\270\325\222\231t\303\031)pZ$\204\\Oj\255<\017?C?\226\217\241"
+	.ascii	"\037W\306\231>\231\374\223]\344!\305$\n\305\210O\262A\255\325"
+	.ascii	"3\nE\212{o\033\310\266\005{4\n5>\372\"\350\307/\t\304\253\352"
+	.ascii	"\252i\276\331C\247\2711\354\213ua\330\344\264\020nz\207\233\016"
+	.ascii	"\302M\003\341\246\177R\246\005<\353\366\371\326\335\363\256;"
+	.ascii	"\300\277n\236\203\335;\017\273u>v\347\374\352\307!\247o\312i"
+	.ascii	"\233rZWN\327\224\3234\345\364L9-SN\307\224\3230\345\364K9\355"
+	.ascii	"BN\267\224\323,\345\364\n\235V\241\3239r\032G\247S\350t9N\223"
+	.ascii	"t\232\322\351q\234\026\307\351\035\247\3478\375\001\324*\211"
+	.ascii	"\216I\255&\336\240T$\243\231\215g\375[\177\327\037\373\2620k"
+	.ascii	"\343\262,\373\262\024\rj\252e]\366B7\253\253Ix\227m\246\035O"
+	.ascii	"\233\260`F\255O\b\320\256\204\202h\341\002}\324\005\372\261e"
+	.ascii	"O\366\227.\032fB+`I\267\007Q\334\n\255\247PEN\307wteY\250\234"
+	.ascii	"zve\177B*\r\312Me{<\334\270\317hnUV<\303m\016\303\217d\300-\211"
+	.ascii	"C\254-"
+	.string	"e\003\224\233\262\"\032\271\345^\303\215\220Kb\211U\321\345\031\372\270tE.\250)\247\371fq\307\375\206\023\021\227t\021\326\266\273C\364!\273$\216\260\252\271:E\0272\333\2769;\317\204n\356\375\214CYk=\340\007y\340+\003F\300`Q\357\003\355!%\001}?z\224\024\354 *\021\031m\007$`\3607\036\021\365\224\304\336\317W!\204\017\230T\"\031M\027\r\365~>$\0360\370\373\005\213x@\037\321\217Wt\364\2017d\343\240\207\336\021\017)\030<\342\345\206M\267w%[\216\2626\266\246ur\320\002\355n\0175u\263A+\256\t\335\232\324\356\"\364g\201v\233@Q\371\354\317\336\354>fN\264\322\274\"|-\303\315\246`\215\265]\331\254\317~M\250\245CX\277\243\272\265\331\235\265\234\255Y\335\352,9\315\326lN\024\235\235Y\232\305YS\360\035\225\331\231\305\341\332\331\230\225Y"
+	.string	"\\\272\357(\314\306\354\215\021(*\236T\250A4#\215a\214\021\222!\005-ha9"
+	.string	"#\031\252u\021`-tl\204R\305\035\022\031|\214\273\322\232\002'\323;B\223C\0360\231\214\254\301<\003\260:M\306U\345\373\220\203.\\\304y;.2!'0\216\2643\351V\312\256k\324e\202\302\251\215\017\025Bm\264\322\320\362\262\307\226\343\344\337\346jiA\256\220\303\247\330"
+	.ascii	"xy\362\330\277\345,\347C\230\3071\327\257#\351\316\307r\0279"
+	.ascii	"#\322\006\323`\361\264\335\276\266\333\327v\373\332\372]\337"
+	.ascii	"\344Q\307\t\366&\247H\340\005O!\374\251\232\350\363\007"
+	.text
+	.section	.gnu.lto_rtcTimeToDateTime.22.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`z\0065&"
+	.string	"*F\f\017G\220XN:\205\324\036\210\351(F\"\367\334`X\314?\221\3229\356\\N+/\260\245 q\310\262\272\255\264?7\3205\223F\177e\310de$\002\020U3\003\f\253\rMw\202*l\372<:\314ZB\b!i'\031\341"
+	.string	"\316"
+	.string	"\336"
+	.string	"\273\266\230\307L\266\272(.\306|\fQSk\235"
+	.ascii	"eW\004\344\251@\037L\272\"\370\211\301~\016\333\2351\256N)`S"
+	.ascii	"\324\324:L2\271\fN\223E#\035\276p\253Rke\260I\246\273^b&?7\201"
+	.ascii	"\341\236Z\177l\251R\353\220\301\356N\223;\364Oi\362\264Oi\362"
+	.ascii	"\267\233\306C\256j\372\340\242\022sSk\345=\210N\207\333{\034"
+	.ascii	"z\313\377\234\303\235fI\216\247"
+	.string	"\2775\325*Va\305pn$\207\030\361r\230+\341H\341\254\314\214\212\342\200\330\320\341\323a\256r\330\310\225\220\232#O\255U\007\0138:\240VXS\264\314y\3410\211\240\207\r\035\036\307%&H\204\350`\311\030\377d\fM\207\005\2447\231\221\262\332\252\260p\230\232\025j\255K\253\260lxu\336]\264\335\255\260[v\b\265V\tk*\277\257\336\311\0201\271\206Q\232t\025\333x\362\264l\311{V\026}|\013\241\227 \361/\272\325r\226Hq\253fQ\322\377\016\362\360\351\3072\2527)Z\\\223\214_\224D\367}B\264\340\327\024-\356\016c\320o\205)\351\242\261\377\261\373@)\t\351hg\244\300M\354\004\216\342-\362\320&r\230w\310P\274B'\335\003#]\003&\335 \223.\220I\267\300I\227\200Iw\200I\367\307\244+\340\244\353s\322\rp\322\3559\351\362\224twN\272:%]"
+	.string	"'\335\234\222\256\256\244\2333\351\342J\272\247I\327,\351\226&]\262\244;\222tO\322\245#]C0\233\200\t2\253\265F\021N\375B\022\2138\314\206bG\361\003J\302\314\332\234;:\337\261\3400?.\203\371\242s\234WZ\222\237\021A\343f~kqCH\244\377\r\275\325r\261\320=\006\314\f\220\276\361\231\031hj\271S,\026\213\336\225BG\272\311L\336\310j\243\006R\246\204\rY\256w\345\216\027z\322\255\326\343\267\366\350"
+	.string	"\036\005\326\005H\337l\316\001\334ToR\273J\336\002b\301\356^\260\026\021Cdj\005N\300\342,$\306\022L\245\253\230J\2239\307yyq#J\271\013\210\225\372o\235y\367\243/e\345\256{\331%hDwd\367\334\215#\013-\370E\264\321w_\312\032\303}\267\311W\316\343\3568\005\214~\336',\006\211SF_\022\266\231\337=a+\345\315S\005/\337B\270\026$Nq\321\025|I\230\026\374\"\277\353d\263\024gM=\247\r-\234\236X\234Q%\232\\\214(|OP=\322g\237\t\272L\r\232zN>\336\023T\257\007\305\304{r*\321\3431E\255\3405"
+	.ascii	"Z(\025MQ<\037\024T\024O7\254\306\231\213w4\207\376\340V\030\234"
+	.ascii	"|\221\372\324\036\370n\006\257\371`\340\007N\305\250\336\244"
+	.ascii	"\230\350\006\356A\253-H\f\372\256\006\257\251\245\031\350A'\305"
+	.ascii	"\004yL}\300\201\356`\027\201\027\370\305~;\254\006\302\210\013"
+	.ascii	"\215\b\"\2563\004n$\204x\364\001W\241\265\366\363]\016.\223\""
+	.ascii	"N\025\233S\224\002\376\363\340\002>B+\215\352\315\347\273\035"
+	.ascii	"<\346C\233*\266\235*\376P\006\270\317\257\326s\236\007Hz\217"
+	.ascii	"\356<\017\241\345\205\352-\367\2555\231\217\314\234J\337q\324"
+	.ascii	"yW\016\r\335l\366Xk\255\270ou\361\320\225\356\035;\326\036w\250"
+	.ascii	"Q \243\220b\212!D#2\332$i\rp\002\031*+z\021\220\255DeS\320\032"
+	.ascii	"\2056\003@\320\031\240\004L\265qtf\367\212\206j\200j\226yB\275"
+	.ascii	"D\204\267\340\374z\240\013\226=\210\213\314\rp\260\306\273dx"
+	.ascii	"r\r\035\374e\375\341|\376\366+\253\205\312\266UR\f\023a\312-"
+	.ascii	"\302\350\304b,\016H\215\364J\037\237\262&'n\334\035\3452S\362"
+	.ascii	"\221\242\302\203\024\201d\210\367\230[\35765\3645KX\254$\251"
+	.ascii	"\326\336\307Rt\037v\003\272U_g\252\354\321z\215R\020\230i\222"
+	.ascii	"\032F\350\233\346\245R`|\025\f\246\0269\274)\235\272\026\034"
+	.ascii	"@B\264\"\t\211\022\204\357\b\267\243\210W\021HB[\315\r\354\236"
+	.ascii	"\n\027R\313\n\032L\335[\312A\3420\300}8\007\0030&k\t\220\024"
+	.ascii	"_\300\334|\017\030\325\205\352\353j\317\024\200rh\r\002}y\312"
+	.ascii	"5\035\304\225v\352\376\007"
+	.text
+	.section	.gnu.lto_rtcIsDateTimeValid.24.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\340\002\205\022"
+	.string	"\206bvE\360\262&\035\002-2\360\031\252\034\237\317\256\205a\274S+(\305\260m\365th{\307RL\332\305\344\324\277\202\232Z\210\fV\314\344{}\262\206\025n\321\333;\217\222\236/w|\227\250Do\226\020\262\367\2262\245c"
+	.string	"Z"
+	.string	"d"
+	.string	"\333\241a7\020\017\267\027\210\207\266\035A\302\212Y\016\273Yi\252 \230\030\217]\330Hm\316\362\020\267i\021>M\026_\033\201\"nl\304\260R\017- ASs\256&7\0243 R\203\311\370\222\360C>\021\313%5\307L\210\027\262\273_\361\224a\2512\265\221\335u\306\260hn\321m\307lC\260\323F\031P\266\023\207\276J<\274\302\030\263\034\235\226\234\331\260T\352\313\376\333\335\265\272\fr\235\037"
+	.string	"L\2074\315\275\364\366\322\332K\307\227\206/\375^Z_:5\375"
+	.string	"\241\032\034\nv\354\256fA{\003\312pl\257\330\"\333\231\366S\\\305\312uTN`\327E\303g\027\366\300\f\002-\233\322{4\205\262XN\324\227\017\274\213Q;\264J\354\374h8\214\bd\330\356\302\004\357\"T\017\253\031\317\237B}1\323_<\2052\027\177\372\262\350]T\265\260\362\261\363\363\331\273\230\252\372f\274\214Py\303c]\002\345\356\246T_\026\320sT\274\222\264pvj\270d\017\333\247\267@m\273;\301g\021\245\316t\241\224R\202a3I\244\324\231RF&\247\256;\221F&\246\222nD:A\031\211 \360\211C\351d\224r:\235\214D\260\275\272\234\\\203\347\346\340!\225\261\r\242!-\252rHA\3640?Zr\006C\372\272\006\355\2468ui:\216\212\\\311e\2408\2052\036\335|\276)I\313\004\351\262\rh\300\356j\024\336EM+\0045 "
+	.ascii	"\003\021\021\353\006\314\b\230\320\307K\240\210\340w%\333\202"
+	.ascii	"\b\3025\315\006\\\213\244\3457Z[\3402\336\2317\260\345-\313\""
+	.ascii	"\341\224`\215\265\344\f\247@\333\007'e\270Ky>\325\314%\3065\351"
+	.ascii	"\227\205\230\203\321XL\301\264\364\350L+\232Z\\$^\353\017\215"
+	.ascii	"1*D\034F\243`\210\035\214\243iC\271\3471\352t\310\200\214\200"
+	.ascii	"\f;R\217\030,\003"
+	.text
+	.section	.gnu.lto_dateTimeWithOffset.25.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\310\001-\021"
+	.string	"\206\"vF"
+	.string	"\317&\035\333qUuE\032\264\325\305N\376\202\347k\203\340\241M0\036\026T\354[\313\234\216Pfl\033u\006`z\207f\013\254\307\275\313-\331^A]4\n\362!c\325&\2167m\027\247=\332&\322\244L)`"
+	.string	"Y"
+	.string	"c"
+	.string	"\255\347LH\324\262\274@"
+	.string	"\355.\210\023\214\276\241\362\035\\\250\""
+	.string	"\265,2\030\221\247\375\016\367\320:\216\3129ve\204\200vC\020\023\030}s\370"
+	.ascii	"\334\267\321;\270on\331)\036\322l\234qi\231\271\330\335N/\274"
+	.ascii	"\365l\371\237=#\366\262\362\214\bv\327\031{\251p\353m\177\330"
+	.ascii	"n`'\203\216iTL\2374m\212\351\215\230\3268\316Oz\316\237\021\323"
+	.ascii	"\243\230\216\017\177"
+	.string	"N\323\"M\253\2463\246\317A\272\031Q@g\327\245\006c\207\266\240\032\333\367}\376\263:\315\036+\236\367\240\234f\0034(vI\347;)\247Y\304\345s\263\273\245ov\212]\372\246%\333\372\341\262,`6\"\035\351\177\376\021\324BfRU\221j\tX\314\201[\004\227\252z\230M\206\246~v\221\006\013>/\023:\033j\322\267\304pe\315\007\372uC\337\363\254!\001\343\020O\374\343\256'\375\316?V\344\310L\320\202^Y3)9\265AU>v\365\340\3110\304\242+v\370J\235\261/\332\335\265\3128+\217\205\222\372\300\030\201\344c})\005'\226\26721q\340\201\337\210\307\"y`rI\210\007~\254.\245\002AUI\227\372H\300\256\344d\325\205\f\260J\202w\322\261T\252\223\256\024\272.Z\225\361\202\rC.}\331\224\032JR\333\203\220\217\371\263\217\204\300\360B\005\005]1J\243j"
+	.string	"@\001\213\321Z\355\244(u\266\300X\210\033iT\r\036"
+	.ascii	"\006\b\312\f\375D\004>.\336UA\220\212Q\023\270\215\323\017e="
+	.ascii	"U\211fZB\225)]z\\\347\322\244\013F`\025\024\006\322\001e\241"
+	.ascii	"P\312q\2101h\264?N\223\204\r%\264\031\034\006\303\002Thp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_dateTimeFormat.26.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\306\b%/"
+	.string	"\312V\350\022E`\236N\007s\2049\006\354b\313\344\265\352\342AM+OCq\220-\024\024\f/2\374\035\021W\022a\237R\232\033P\004\3069\374\201)\342p\240\212\267H20\322\355\020\307\262\305T\255\265\335m\313\235RJ\001\034\001\375"
+	.ascii	" \0014\346\254\311\261`\026\266}\346/n)m\245\355\372\311\302"
+	.ascii	"\273\306\373j\247Q\275w\030\306\332\370\356=Kq\027\354\240\264"
+	.ascii	"\356\347\2121\335\206\334{I\364\224\246\362\325UX/I\254\271\344"
+	.ascii	"\226E.\356\336[\245\266MB\243 \223\222\315k6t\373\"\227\240-"
+	.ascii	"sP\255\367\023d7\217p4\345\262L\260t\315\344\253\233\264\360"
+	.ascii	"\237+\026\026\343\356\336\033\305\r\324\266?\376M\2572P\356\314"
+	.ascii	"-\327I\276z\356E\003\335\313&\345\356\336f\0247\251m\271\331"
+	.ascii	"Bi[\265\203\322\266\314\314\303\006_\214\354f\233\031plm\351"
+	.ascii	"\304\357\336\346\324\377hd\013\203\253\nL-\372\216\344\006J@"
+	.ascii	"\343\202`!CK\2660\250\324#"
+	.string	"\355F\257h\321\332\226\031\275wf\003e\002\343\303L\0279\273\341*PB\2174\034\r\354\275\263\032KO\325\332\n\321\224h\322\275W\006\332\230\2433\372\321'>\274\276\03641T\310,\bY?\333\313\320\302\334\201\022\356\275\354dhi\315;\315\314Mf\236cV!\004O/\225\214\231x\302\233\214\223\224\237d\247\377/\362\206\245\351\243\\\207\033\377\246gW\306\001\323\322N\357\337X\272B\337\233\235\322\331\017\365\256\267\254\003\346\177\f\241\211\276g\274AQ\"\t\363\277n\213\303w\367\317\344\026\251\323\367\22270l\302\224\021\3638\314\3150\177&s\243\367\331\230{\256{h\235\025\364\223n*\353\034\005\325\315\356\247n\322\355$tn\262\316\007:J\263\201\256\322\274\324u\315JI\335lF\262\316GAg#\353\\`u&`\235\213Vg\"\353<`u\036\262\316\002Vg!\353\034`u\016\262\316"
+	.ascii	"\202\316@\326\371'\350\354c\235{Vg\036\353\274\263:\013\255s"
+	.ascii	"pu^\255\263\272:\003\255s\272:[vF\255\363\253\316\256:7\204!"
+	.ascii	"\270\265\034\314\035?\246y\315\376\346\334/\326)\244\243tW\351"
+	.ascii	"\256\353v6\312\334\334y\255\327W\230\205\314\242\363\230(;\337"
+	.ascii	"\363?r&\030\265\335\253l2\n\252\222\005\202\266\303g\266p\301"
+	.ascii	"/\216O\262\317\377\210h?+\237\267<\337\003\242\373x~u\n\177\307"
+	.ascii	"C\267\021>\317\336\230#\353\007;\364\232\365\255\023\370\352"
+	.ascii	"\206\346\003\376\2727\006\316\234\375\364\207pi\226uXC\243\251"
+	.ascii	"R\271\317 \347\214*\\[n\257\264\255}/5\271\265$s`\300grpL\312"
+	.ascii	"\322\316v\227N\231pK;\264\033\231\032\260Pj<\326\344P\244O\372"
+	.ascii	"2\356\322T\337\317\006Zb$\231>\023L\206~Z\201\231\343\247A\315"
+	.ascii	"\0341\033\324\274\361\253\352\200\367&.L\367\025\366@\244\317"
+	.ascii	"\257\273\nD?\253,^_\\\033n\253\264\257\260\210~Z\365\220\271"
+	.ascii	"\367:\350+\335fpk9\332\200\371\2757i\237\311\302\261#K\273\217"
+	.ascii	"\372\224\371\266\364eA'qK\273\207\372\224\351\266\264\363\004"
+	.ascii	"\255\364e\375l&\267\347~zY:.~\250?=\322\227!S\364I0\001r\244"
+	.ascii	"g\036q\345M\206>\017\031\235/b\237D{\374\377\351;\257\003\\b"
+	.ascii	"H\305\364\240\304\220\212\t\213\251k\001\025\223\324\007)~\220"
+	.ascii	"4\244b\212\352b@\305t\244\342\n\253\250\302\032\271\272\212("
+	.ascii	"F\2708\252Z#\\\034\203*\256B\034\211\\\351V1\313\310E\fq\344"
+	.ascii	"*\2420\356\030\211\307\256\255,\rG\242\321\204\211\"\017Q+\353"
+	.ascii	"\003\361xUB5\321E\342\031K\212\250\225u\234\332*ji\025\261\246"
+	.ascii	"\266\262\256\264\246\260\270\214SRD\\\\A\344\232:\026\213\\S"
+	.ascii	"\302&X\243\367\331\f|O\231\336\027\260\017c#zo\217\b\355\354"
+	.ascii	"\346\243\363?\3413\331\327\250\277\241&h\326K\017|\331\322+\370"
+	.ascii	"\003\017\340\003\274\200\037\360E_\340\217\276\363<\0062\tR\211"
+	.ascii	"\252\354\263\035\237d\243?\022\3410\254\214\336\022\370\002 "
+	.ascii	"|I\340W'\321\027y\3601\242\347\331C\003g\350\007t\360\260\241"
+	.ascii	"\267N\241\027\260\301\223B\277\356\005}\200\277\240\367IKsd\016"
+	.ascii	"\350\001\374\020\310"
+	.string	"\230\fM\007\350\027\320\245A\203\317\364\030\316.u\353\263\261\r56L\274(\275\202\357,m!\016\310\237\322\017\314\377\034\313\230\031\021\025\311\323W?\370\001\200\224\250A,\3031\204\320\214\210H \"#J\241\003\300\242\231\"\352\006\021`)dfJLR\324\001\230\2028u\353\th\276&\222\222m\271\025\305\335\326\353^\233\225b\3713\334\277\257\366^gI\312\270\245\"\023H\001\350\3600\"\246\250F\341\326\266F\252=\350\271\235A\323\002\3350W\276\245\377\333m\333\276F\r\213\353\f\330\375O\336\337\233\356\366\246\b\222\244\\h\021IRA\264=\031%I\241!\005\304\2533\006\216\360\032\034\017\362r\270p\241\2057\345/\352\004x(\f\350s\334avWa\355i@\037\302\003E\246\016a'm\271Os\310\200\365\244\355\024\325\260\020d\214z\212\001\301CA6.D\270~6\201\356\227>\267\315"
+	.ascii	"\246\211tqHKO\356\226\2334{\021G\205\320+u\336\225\340\376\353"
+	.ascii	"9\235!\026\251u\351/142\217\201\262\276<r\346\301\222kI\305\205"
+	.ascii	"2\210Zk\210\b/$\004\020\n\212\371=\310R\340U5\215\016v \001)"
+	.ascii	"C\207\314\353Ac\001\246\225K\204S\036\370\007"
+	.text
+	.section	.gnu.lto_rtcTimeMake.27.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\345\t"
+	.string	"\326\023F=P\207(\035\003\325\264\212U\220\032\0038\235\3756\206t\004\030\200Z\024\002\024l\320wj\036\325\276F\221\323~\006\371yn\334\314\314d\342\031\223\023\241]\001\f\214\274\002\371{\023)S\n5"
+	.string	"5"
+	.string	"1"
+	.string	""
+	.string	"\036\2403\247\301\003!E\005\251\320\351\301\356^\366\316\020\017\255/\304C\3758\347\311\361\177:\314\b\371D\243\316S2\261\273N\321\210t\353mC\330\226\260\377\020\213\361AX\004\260\200\210\355\316\236\330\256\006\234@w\223\205\341\356\306\001\324\256Wq\305:T\310L\373\002^\352\356]8a\227\243\204\332\335\212#\254CJe\333\017\267\201xM\325\006\240\221O~\256\364\372T(\202'?\333\353\244z\330\257vw\255\035\266\323\361\246\037\336\373+\230V\230N\230\2765a\220\300\342`\003\\\206\301dZ\344\260\013W\031\263\\\264lse6M\333\260+\223Qh\027\246\341.\213\203\267\212\213\346\332l\233\346\232x{G\245x\364c\325\324\250\007i@U\255$\013\002\r"
+	.string	"2\003\302\260\\8"
+	.ascii	"\354KP\231\264k6\313D\004\004\006W\304\3248\270\373\244Z1\t\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rtcTimeGetSeconds.28.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"}\b"
+	.string	"v\220:5P\215\322\001\207\002\351f\214"
+	.string	"*\211\204\346]w8D\303mQ\256\301J\347\267\365\365\\\355\033\2223\265\212\230\231E\306\324\362\021\237\374\022\372$i{\023)S\n*"
+	.string	"+"
+	.string	"*"
+	.string	"\244\r\222\335\205\225\013\274\273\353\001\357N%\016z\202\374g\374R\245FJ\246\320\223\202\260\273\316\222\t\342\326\333&\260m`{\025\255\222\005q\036)\333\037;\263\235i_u\214\317\243\347"
+	.string	"\273'\216\216\335x\340\002\354\316\021\263\355[\374\342c\320\025'L\017\305\n\2517i\250\030]\203\241\203Q\370\236ww\275\210C\204([v\f\245\242\354_\253'\273\307\377\322tj\372/c\205\300\217\335\207\234\373b\301h\031\016\324l\232\266]\240&\223\240\301\313f\001Z\006\274)`6\220\263m\033\230\305\275\235VD:r\252\323\223N(\253w\3365\r"
+	.ascii	"2\003\302\260\\\270\372)S>\246\345\236e\256\341$\023XQ\343u`"
+	.ascii	"\342\301]#\325\212I\230d"
+	.text
+	.section	.gnu.lto_rtcTimeGetMillis.29.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\225\b"
+	.string	"\266\320;6@\217\322\001\323\036O\233\033\377\242\311\007\350F\300 D\027\370\316\300\360D\f\337\352u\272\326? \365m\303\024Eq=\272\032R\260\036<\2123n\177o\"eJ\001+"
+	.string	","
+	.string	"+"
+	.string	"\033\252\245\262\033a\300\t\336]~\340\335i\306IO\222\377\220c\254\216\222\224\252\364\2740\354\2563\245\252\270\365\266\017l'\330~\005;\261\255\354\211sq\330\036\331\031\333\231\366Y\007\031=\212.\260\273\"1\331\215\nF\300\3349bl\373\036\377\030\231\224Q\203\342\265\002\357\232z\226\b\327\351\"\020!\314\206/zw\327\247H\\\230r\263c)\025\303>\266\272\262{\3741M\247\246\377"
+	.string	",P\026F6\240{\243\341d\035\020\364hY\246m\240\247\323\220\301\315\347\001j\n\2549p>\020\244i\037\230\211{;50\351\311\251N\217j1\345\346\313\353\241\f"
+	.ascii	"2\003\302\260p\341\210\217=\271g\257k\"\311DS\324 \035\230 \340"
+	.ascii	"\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_dateTimeFormatUTC.30.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"%\b"
+	.string	"V\220:6@\217\322\001Xp\006\354\311,Lc\034c\241h!\357 \271D\033J\256\306\352#Os\0025\310\226\335\202\036\206\341\261\272\2012\360\234\256\364y|\367#;J\231R,"
+	.string	")"
+	.string	"*"
+	.string	"\f\235A\217\035\245\2434F\"\253\335\b\025u\320\023\344\037\344\006!#\"\025\022S\350\031\340\260\273N\222i\343\326\333>\260}\331>\t\036\266o\273\2633\2665^\240$d\332\377x\252\273\n\343\002\273\247T\311nT0\002\346\317\361\004\326\037\346\003\326\237m/\004\232j\177,\362\244\247\232\221\206\354\030J\345\260\017\260\273k=\331N\277\307_\257\372\323\242`Y\2654\254\354\226^\\6\345\231\004\\DJ| \324\330\305\311:\034\364hY\246a\320\323y\310 \266U\300\253\300\332\004g\203\234\246m0\023\367~\252\311P\221\255\334|s\r\t"
+	.ascii	"2\003\202a\353\352\022w\031\033T\003W\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocal.31.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\205\f"
+	.string	"\226\331W@ q\223\016\217\021\r(=\240\241\311\020)\365\035\274\213CoF\013\325\004\204a\302\022K\323\356\326\320\206\004F\346\213$\213\222\235"
+	.string	" \004B1\356\352\204\0302\246\030F0\341#\265\266\367\2262\245E"
+	.string	"C"
+	.string	"H"
+	.string	"'"
+	.string	"\377,\037"
+	.string	"\377l{\001\003\217\265G\020\037\017\3710\"I\331\215\225\206\\\273\323\324|\035i\021:Y\261}\35666\017W"
+	.string	"\233\310]v\367(\236\036[(\263\002aw\235\244\255\303\375n;\202m\214\375,\nb\337\355\356ZK\266\323\324M\177\345\245\341\343\377^Z]\372\033\234\222\224\030\017^\354~\234h\254\311s!\302\266\307\346\260\255Q\003J\202L\373%n\302s\323\206\013\330-\235(\331\215\n|\300\362\347\030\372\261j\252\003\022'\243\032\240<9\247 \266p\025\235\263@\331\0255\360I\236B\343\213\374\371\302\365\374\013\376A\245L\240<\345\356~\324\032\274>\304\b\fQ\316\260%\237\332\0318y\322\325"
+	.string	"\207\021&\"\375\3301\224\001\031\205\254\320\231\240\2660\231K\223U\035\330uaV\325\241\221pU\326\206Sa\n\030\303\220\331T\031\206m*\216\b\272[-9\323\357\300\213\3100)TU\017\333\224^@\032r\200D\360\324\247\025\265\255L\236D\351e\024\022"
+	.ascii	"_\204\n\233\033\016\035*\367U\214]\205\002WW\355\022\016\366"
+	.ascii	"\335e\336<\232\314\004\016\n\301e`d\001*\214\314\353C5\275\t"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocalShort.32.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\335\t"
+	.string	"\326\323F> \307*\035\227\220O\004<\201"
+	.string	"\3249\311a\262\252\216\217\001\241\275@\321.\362u\002'\177s\247"
+	.string	"\240\035#\25071\035"
+	.string	"A"
+	.string	"\023\316\2768QkI\024\242\027E\241\223\004m\"eJ\0015"
+	.string	"6"
+	.string	"1"
+	.string	"\227C\356\b\227C\333\206\220 \271\364X\262\272K$\025\223\355\306N]/=K\376W\316"
+	.string	"#"
+	.string	";"
+	.string	"\200ezn\025\273\353T\261Bn\275\355\006\333\033\373\n\001?\374\353\327`:\265\364\271\321\210,\001E\313\356j\246`\013\300\001(\266I6\306\266F\017\004\232L\373)W!\375\365\361\203\335V"
+	.string	"\001\273\361\301\016\334\241\343\023\002j\3625\365\006R\013\274\361\230\307\355\202L\370\260\263|\376\311\241;By\325\241\037\272\034^#L^\247\234\331\021\225Jb_\333\335\265\266l\247\267\307\"\214\314\030]\2509\233\216\347\021u\237\317\363>N\367\361Xx\035\007\024\3526\013\3768:\240N\364}\240\016\023O\367\246\231\223\242l\220\232\247B\325\324\326\360\344U\233fR\001\013"
+	.ascii	"2\003\3020\330\341\364\241jZ]\270'\306FP\r\\\001s\tPq^\327$\003"
+	.text
+	.section	.gnu.lto_dateTimeUTCToLocal.33.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\025\n"
+	.string	"\306SG>0\2478\035\230\313\230\374\0038\3327\350\262\177\0058\352k\037hwJ\317( \\\3024\263\210'\200/\316J\340)$\n\021@.\320K\254\302X\377\225\244_\202\322\204\206\366q\223-S\n2"
+	.string	"4"
+	.string	"5"
+	.string	"\227O\217g\250|^\276P\371th#\370(\262\007\200*\251\024\354n&C\036^C\377'7\020M\242\253\245bw\255\242\351\343\226\267\375`\333\302\276B\327\356\256\345\311~\352\237\037\377K\252U\325\267 \0248@\221`\327\243\265`Ws\300\210\355c\366\310\222\270\332/\271I\370\324\306\023vO\001\004\354\216\030C\004\230\252\234\362\2226\206\247\027\355\320!E\276T\211)\261\374]\245q\331\345\230\360Q\236\362\361Q\237\006\205\364b\250\362y\031A\"@\222\032i\313\036I*A\354\007\234\327m8P\323p\264\355\343\034p^\267\341@M\263\201 \314[\206\363:0\353|\236\367mY\247\323\274l\363|\262L\203\277\f\316\223\201\337\347\311\260q\364k\345\311\027\006V#Ir\r"
+	.ascii	"2\241-h`\342\342-\365\206<Xk\256\261\2550\0340\002\306\201a\001"
+	.ascii	"*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_dateTimeSplitFormatted.34.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\030\002\265\022"
+	.string	"\246!zI\300\224Q:t\002;\2532\313ii`]pf\350P\177\322B\301\266\365r\3000\265\231d\003\025\330cD\031>\370\245\277n\373\307~\315\363y\207 \bBG\211\200j*\305\200T\001"
+	.string	"\310q,;c\375F\310\336r\247\024d"
+	.string	"`"
+	.string	"k"
+	.string	"N`:\365\370\002\337\251\351\004\276S\025\0064\216}\034\221\363\036\0263\334R\255c\270=\376d\354\340G\347\312\230_s\020%\316j\242L~)tN\251O\017\021\274\235\350\341s\256"
+	.ascii	"\255 \201\0225\314\275\351\216L\304\033\271\317]\316\300!\304"
+	.ascii	"\333\211:\227 K\255\325\222&v\270M\267=\263\r\301\226\023\002"
+	.ascii	"%\2746\373\267?\300\307\037\300\351A?hi:\247\364Jiy\334}\001"
+	.ascii	"/\244%\"\017\216j\315\351)\251HT\006\212\343n\377\205"
+	.string	"\237\303\301^q8\234h3\240!\265\216\nN\275b:\275Mc\233\330\267\227\201\001\365Fh\203\203\035_BT\244\264\377s \232\007\301~R\253m\027\243\326qA5\0206\262\367Yk\255_\312\347\236\350\207\026Jrh\307V\203\316\235\373\255\331\276\353\363\2112\270`2\036KG$\214\274A+\222\362\257\334\n?:\034\0252\3313\270\376\220\005\030\312\307\t\377\365\235R\237\034HB\330\310\036\002\030;F&\215\273\276\335\347~\242C\311\205\221\244\03772\311&\005\271\355vy\354\261F6\330a#3O\251bZ3\325jy\231/\251V\253E\305Z\301\234\354\202\222R\305\264B\231\225J\265r\tebZT\241\013\353B\210r\300\253\231\024+l\255V\254p\254_\233/t\t\274\"\235\321\347\307\276\347N\201\267\323\031\315?\366Q\272f\261Y\231\tpy|\332\321\323R\232\004wn\315E\337\215"
+	.ascii	"\344D\030\\\246\335]\022/ \200\002\021Z\346\001\245\t\376:wj"
+	.ascii	"3\031\362\241\303\202\327\312\233q\275S+\234\266\376t\221\007"
+	.ascii	"\271\240\236\246c\203K\024\b\312\306\t\fA\231\267b\334-*r\237"
+	.ascii	"j\266B,\200\215*\021\213\027\302\326\005\317\236\315\026\033"
+	.ascii	"\370\354\271#\023\031VT\350e\216\310Q\202\023n\332\212\264\006"
+	.ascii	"\347\206m\340\273\264\320#\220\213{]\357\t"
+	.text
+	.section	.gnu.lto_rtcHasTime.35.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375 \367\275\006"
+	.string	"\022M/4P\213\222\016"
+	.string	"FU]jCZ\311Z\006\327=\001p\177\315\353\013\3253\374\277\017\240o\365\261]\354/;3\263]\214\335\326\246d\210\336\325\032\265\266\211L\001W\023\212U\271<\313eYW\365,\225\005\353UX\303\233\f|1P\260w\271.\354I\266,\206\020\t8\330\371b\"E\304z8:\035\025\003s)v\310\270j\245n&R\252\030"
+	.string	"\301q\245\3376\016%\276Sf\346\030\372\335\350\334\235\004,>\02242?\245\220\364\2406*~\315K>@\320\234u\233\370TD\362d\200dn\017E\315\352\262\333\213N\244Q\207\006\332\324\001(d\346N\003=t\354_\360\033\374\021\001\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_rtcGet.36.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\225\013"
+	.string	"\306\026QA0o\223\016\004\236\351<\252*\310\377\206\321\260[\357\377\376\353\202\241^T\341"
+	.string	"\243\026\212\270B\bvkH\332\te\366\030\022\330\264\252\206B\242\260\334\346qfv\232%\3431\210.\031{o)S\n@"
+	.string	"<"
+	.string	"<"
+	.string	"\266\315\240Af\355\261\303\306;Ld\224\230v\243\245\035\327\35645_\300\026\272\243.\\\335\201R\006\027\003\266\221CP\302$\343\"O\215\r#\023\300ew\235\244\315\302\375n\373\201m\005\366!\004,\034\240\354n\234^\254\311#\361a\373\376\310I>\217\326\r+L\273[}\354\352\357vfW\2663\355{8H\366\020\320+\273\245\217\021\273q\201\023P\177\216/"
+	.string	"\377\250\023\200\177\001N/\362\312\b\312\211\026(T`d\212\375\017/\351\370\036\256"
+	.string	"\312\223\376|\020\374sz\222\247\007\307\t\007\b\006Q\236\3548J\345`\337\355\356ZK\206\017\371\237K;\247\223\312\242)\236\033c\311\\\032\217\265\301\256\013\303X\033\215\204\313\302p:\226\305\200\261\t\031\216\345\3010\216UE\321\235\302\b)N@\210H_\203\251\032\352\213HG.@>\2651\ny\022T\247\241\247h8\205Pw`\020"
+	.ascii	"_\b\b\303N\026n\025\361#\026\352\r{\r\325\026H=\021\227\367\020"
+	.ascii	" \327\250D!JPA7\257\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_rtcSet.37.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\345\t"
+	.string	"f\224G=@\247\270p|tq.U\365\027"
+	.string	"\315\271\376\202\273\301WE/\216U\230_\261en\237\204\353\264fu\347\267\016\225\252kSqQQ`\t\302\300\202\2437\224Dg\002\221\322&R\246\0246"
+	.string	"4"
+	.string	"6"
+	.string	"g\310\216i_\310\216\331\366\004\205\307\337\305\020\321M\tB"
+	.string	"X\273\342\246\246\177\317\317\277\311\035FZ\007V\001F\237'\202\305\356:\303Q\307\255\267\375`;\302>%Z\262\237\3723M_\232\326+\235\232~\302Gb-\250\030wEck\r`\004P\266=\266\202\355L\373$/\361<\3259e\267\204\032\260+J\030B;f1\bB\006\252\327K\263"
+	.string	"\207\b\230\243SU\037z\240\245\275\241\311\207\251\027$P?\366U\036G;\371\235\354\330U\033\264\300\225\200\017P\216\266\370I\005\261\177\355\356:\233\333R\271p\230\315\226\3518\256\263l\031\f\006\267Y<\315Vip\247q\361\266M\327y\233\305\375\265Z\362\277,c\364p\240"
+	.string	"\244\240/\365U?\341\370's\235|x\354\001\t"
+	.ascii	"P\213RF\214\325L\274<\203\225\032\355\314\204\226\256\001\310"
+	.ascii	"\016q^\327$\003"
+	.text
+	.section	.gnu.lto_rtcGetDateTime.38.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\323\002\005\025"
+	.string	"V\247\212I\3200\2511\222\005o\023"
+	.string	"\036\376\231\361\313^\326\301a\377\311\346\232w\036\254q\353\306\343&\241\227\006\340\027\253\270\235\311C\236\337\270\370\001 '\206\310Oa\n\266\215\254\305\323\345|\2005\006$\354\352\227\326\310\226[\312\224\002u"
+	.string	"n"
+	.string	"u"
+	.string	"\324>\320\203f.$s\220{w@\025\367\236\006\\\240u\353\363\001\306\333\326C\306[\333>A0\343\332O\037\234\367\bq'\202\367\236d\355y\355\243\025+\255\3714\037K\020\331Z\365s\2022\322y\270(\036\270\005u>t7\321\343\n\367\364\236\r\255\342\200\335N\216\017]\2158\242\264\204;\360\364Fw\243\224\205r\3575\315\3516\334\254\333.m\227\330\265$f\224\031\364\301F\207\366YC+\217}\361\336{]w~\261\250]\027\372\255\251)\213\372!\004~L\235\036\035\025\352\2748C\341]\262+D\374\374\355\373D7\2029\n\0130_t\340\313}\026\331\021\276\3300\376\320\1776\3141\367\331\356F\230@\367^X\214\r\273\245\366\214\3373\314\366I\373\305\220\343\302A\355\230\2727\207\344\326$-\032\367\336\004~\213\331\004\237'3\336\376w\312\303\341\231@U6:\254G<\037\033\026"
+	.ascii	"}\265\325\216\255\320\347<r\2534\376\371\327\332\341g\342\204"
+	.ascii	"\005\f\016bm|\325\367\336j\032\252\341A\357{\257\024\331\021"
+	.ascii	">\347\003Y,\320\347^U\2544\277\0021\004\326\312\343\323FW=\360"
+	.ascii	" =+\246\033NR6\364\312~\212\037\321|\236e%}\256\034o]\365F\247"
+	.ascii	"\274\263\317*P\307LVd,3\262\245\224\311\312\030\331\302BAF\306"
+	.ascii	"\\^H\023\021\227\027V\\\310YY\272\220\260\323v\361\326\235G)"
+	.ascii	"\rEH\366I\013\2442\024!\211\177m\244\365\246\032\305VkL\023\357"
+	.ascii	"\r\241\240w\220)\337Xy^0\370\223\n\2230\330\340MTB\032\016\276"
+	.ascii	"De\025Ly\360\031IV?2\376\237!\\\211\004\216\340\237\022\3411"
+	.ascii	"Rl\022\216\237\252\253\214\377Y\302]\250|D\0051 \220\002\021"
+	.ascii	"\272\243\007\227\f\375\252\360\216\210\257@\342\017m\240\243"
+	.ascii	"\311s\244]-\342\034\246x\354q\311\224-\207w\244p\261\206~\230"
+	.ascii	"\006\276\217{\270\222\343\250q\367\306\336\006\330 3D~\274<\202"
+	.ascii	"\232GE\347\357\352\243[\034\0202GA\364G\t\360\001\013\204\322"
+	.ascii	"\275\311:\314b\307v\rK\023\022\002\023\272\315\373\306\2542<"
+	.ascii	"P:,\377\303\223\026\335\003"
+	.text
+	.section	.gnu.lto_rtcSetDateTime.39.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\305\n"
+	.string	"\326\226N=0O\224\016\307\n$\267\216R\035a\364]e\3616\332[\231\347k\234]\261K\277t\344\215\326b\037\341\365\007I\326\376Z,)(\265\2501\213\371\236a\304\334\2630\233\f\262\267\224)\005="
+	.string	";"
+	.string	"<"
+	.string	"\273\036\002\033\250\036\355\375A=V\037@=\332v\002\005\031o\3676t\316\001\003\207\204\306\256w\251\206o\317\315\377\3500\204\242E\347\321<\0010\330]g\347\261p\353m\027\260}\300\376\202i\n\246cL\303\213~\205\351;\004\204\\4P\261\333\371d\254)\226<\330\276/\342$\314=\353\210\024\032\273kal\353\361v\306\266lg\332\007\361\020\231\213&<\300\356\347\304\2121\242^)M\026\025@\\~\206\032\365\234\031\233\374l\245O\202\220\345;\250'\335\001\372v\343\304\251\306U\252\332\022,\371\356\372(}0QP\215\355q\251\031\354\303\335]\353\307\206\001\227\007i\f\022\311&\227\213\242e\231\206]\224\211\203\354\302*\226\013B\300Z\204H\345\272hZ\345\262\2679\\\375\370\033\365\321+\030\027@\033\247\215r\246\324/q\023\230\337\301\021I\364%\324\343_t\001\t"
+	.ascii	"w\213\302\2631\354Y8(\204+<\303q\227\331A\005\315\274\212h\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_rtcGet.part.0.50.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`&\001\215\r"
+	.string	"f\032[C\020\221\223\016_/'\375\023E\" 4H\307\363\226\206\353\005\261\313\242_\332G\243^\307\353\347P5d\321\336\3739\221.\002\274}\""
+	.string	"\240\b%\245\202\3365Pv\232\341;\352+\372ju\357-eJ\001G"
+	.string	"K"
+	.string	"F"
+	.string	"\177\216\367\200\177\232\027\200\177\366M8DD\224b\333!\"#o\217\037P\336\342\342d5\263\033\257?m\371vM\267\371iR!]\257:\202\0217^\310\260T6<\t\334\001\030\331]k8\334\357\266\035\330^`\237D-\\l?\346"
+	.string	")B8\245`\274\224X\013\221\001\310\333\307\005\215\221\212/\276\237\342+\320QX=\320\230\331]\320}\225\310\346\330#\233c\315G\321aB\037q5\244X\323~\352'F\207\t}\300.\312\205\305nl\360g\005\232W\341\361CXB\350\371!\370\247\352\001\242\3035\365';L\262\345M\332\031\205\274\351z\3257\"t\254\340\250QRR*\213\325\335\255\242l\247\341\343\377`\332\301\264\302t\276\364\003$\230!\340\264\213\322\312\261+/\332\335\001!\301<\332U\222aX\326\271J<\021\260\253\363\251p\201\030p6\201\344siY\366\2718w\253(_\365\00722bV\344\277A\250\031lC\365\210\211\226TYl;\365Y\332W&\033\252\251N\217\341T\312\226}V\032"
+	.ascii	";\213\221\362\006'\007JA\005i\253\030H\005\025\b\004\220\007"
+	.ascii	"F\270b\304\304\006(e\343\227l\360d\016\030eF(\363\235\215\235"
+	.ascii	"\021\205\340\3209\357\320N\0135\207Qg I\r\\\363\376k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\030\002E\013"
+	.string	"\346PA;0\305*\035P\017\350\202\034kR]\030\007\302fL\264\001Fh\252\001\220\357\301#\346F\244\352\f\302\303 \023\306`\362v\266\256k\313\242mk\0040H\320\200\3470\310\336r\357\024,"
+	.string	"2"
+	.string	"3"
+	.string	"\236\2565\3440j\303\237\206=\231a\214\274\354c\203\342\343\002\271\177\f\333\243\320\377[\327\332\035?\377\"\026qvwc\270\223\377\227\013\261\023G\023\230$\021xt\300\"\003\016\231\030\324"
+	.ascii	"\240D\243\304 \211?#\366\310O\210*4\304\035\020s@\336|X#\377"
+	.ascii	"\313\332\036\036\316t\006\350\3775\306\fZ\200\221I7\240\312\271"
+	.ascii	"`\234=\027\305\246\330\335\177\247\306\300\245\270@@\177\t\027"
+	.ascii	"\354\005\321R\260\320_\005S=\300X/\226\313\241\025qz\f\003O}"
+	.ascii	"\335\202\357P$\263\013\311q\233\272\354*F\032F-d\263\314\312"
+	.ascii	"\256(\033A&\013\356\204\nl\350\3336#\213r\026\253\340\360\350"
+	.ascii	"^Bo\351n\001* \260\002\031\243\362\006\231\301\237\241\234\312"
+	.ascii	"P&\373\022!n&w\036\030\330\031!Hc5\256t/\307\216A\f\260K\021"
+	.ascii	"\2750]\022\3010?\373\307,\267a\025:C\017\277\361\033\3733k\002"
+	.ascii	"|\"\f\276\301\316\353\207,\202\036\177\243ol>\257\351\f\207\231"
+	.ascii	"W\036\324\243Q\023 \024\022ffP"
+	.text
+	.section	.gnu.lto_.refs.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375 W\r\002"
+	.string	"\022D\f\023peZ\f\374\377\207N/\233\036i0\216\027\271wJ\001.\304\320\321)%\260\221c7\215b?\211\255s\3302\205\005\254\315\232,\225g]\r\004\005"
+	.string	" \344%"
+	.ascii	"VA\300\031\246-e"
+	.text
+	.section	.gnu.lto_.decls.66aa276c037f2467,"e",@progbits
+	.string	"(\265/\375`\370\036u\212"
+	.string	"j\333\340/Q0\216\322I\007\236hYK\330}\205\203h\206\245\200\033Q\203\307\207\332M\336\020\361s\347f(D\214\343Ya\354\330X\005s\007\264\013\032\227Q\317\217A\246\241\277d\271\203nKo/\204\321\254\nP\256\263R\336Ku}\347J1\210\021\273\267\224){\002\351\002\005\003f\356\200@\316\230\250\264=\337\375\034\206\353\270LpI/\354F\333s\231\237\3070\031fc\346"
+	.ascii	";EpIM\265e\037\273\237\263\030 \017\270*#mq\270\347<\357\034"
+	.ascii	"\367\234\f\346\347<D\317\371\264L\357\316\006F\202,i[\371K\n"
+	.ascii	"4\311\246&\326\366g/L\327A \361\352\321v\316\207\301\232a\360"
+	.ascii	"\332\236\243\320s\024\265)\256&T\030M\347\310s\221_ppAI\243\022"
+	.ascii	"k\303\2222%\210v\265\254\200\335\270\n\263\325t\r\255a\326\204"
+	.ascii	"\307\351\377\363Sp\001\273q\031\243\325\224\353\"\277XIQ\326"
+	.ascii	"\207\306d\357\3364\216\337X\216\2730\034s\341-\334d7\306r\316"
+	.ascii	"\302Z\336\351\275\311{\357\003>\325\210&W\360x\354a\240_c\023"
+	.ascii	"\347M\f(\257\261\025n\246\340+g2nr\340Rz\3236\342\227f\326\366"
+	.ascii	"+\240\347\024g\375\373\343\024\347M@/\002\372\017P\237\rP\004"
+	.ascii	"\330\304y\013P\025l\342d'l\306M\003\370\311)\270\340\365\350"
+	.ascii	"\344\212\335\233\356\344\254\t[\243\246\355#@\001\360r/\370\r"
+	.ascii	"z6\340\344?6\340|\243\023\260\211\223\207M\234\315='\023"
+	.string	"\0263\240*\233\230\027\312\275i\211\235\024\b\247 m\237\262\211\023\345\236S\006\020l\024\353\326\276\230\301\r\273\374\374\301\226\233\277k\264\317I\374\235\206\"H\347\357&(d\340\340\r\206\340\337]E\016\374\273\352\374\233\307\317nc?\267i\341\t\262\374\334\002\313\317l\274\246\300\337;\374\034\201\024V@\r\350;\177\017\347\350z\310\201\373\374-\0037\020\345\377\333\345\376o\371\317\345\177\334\177\267\243\375O\361\037\350\177\001(\376\036\341\277\337\317\311\212\3633\222\237\203\3709\311\317[?\033\371Y\353g\256\237\275\236\374\274\3749\353\347\"\315\377<\177\265\341\347\024?\367\337+\374|\3663\331\317_?+\371\231\351\347\342\3177\374<\374\331\305\317H?\327\3603\321\317A?\317\360\263\f?\303\3603\320\317*\374l\302\317#\374\f\302\317\035\374\214\301\317??K\360\263\212\237\027\370\031\305\317'\376\317\375<\300\317"
+	.string	"\374\234\363s\360?\337\377\002\376;\360\377\314\377'\377\257\374\\\177\266\377\327\374G\363_\357?\021\377\315\374\277\373\357\345?\335\177\261\377\025\374\207\373?\300\337\337\337\337\017\334\373+\331/"
+	.ascii	"\005\001J\272\212\301<\311\342\322\266\275r\320\324)\247\250"
+	.ascii	"\321\341\322;r\024\263\265\325I\202\310\276\250\251=\256w\222"
+	.ascii	"VB\260D\307\231\226\254\277\263Z\253\261\360\216\274\265nf\307"
+	.ascii	"\212N*\254m\033\351*\240U\226\272.\326\313\251\343cv\235\241"
+	.ascii	"\3470n!\315\026\322X6J\313\305\f\336}\332\001A\023\341-#xa=$"
+	.ascii	"'J\232\237Z\333\024g\355G\332\216&\350\233\252}\274\177\374G"
+	.ascii	"_\221\220\336\0347fMQS{w\371\244\342o\253\367\225\036\211[\300"
+	.ascii	"M[\330\230\037m\217\306\246\005%nW\3326\223\016\215\225\035s"
+	.ascii	"8TpkI\2000\026\013\304\207\224[\333w\024\372\377|\336\245\247"
+	.ascii	"{\257\016`z\237\220$\316@\316\341\312\n\374\267\2672`wo\020,"
+	.ascii	"=\264\253\312R\217F\340\036\354\336c\211\233\336'\345\231\325"
+	.ascii	"Q\331\364\002U\"\275U\003\334\263 W\231ZAY\346\355\233^\276I"
+	.ascii	"+\250\033\224)\363I\2312\217<7\311<\336\233B\361(\241,\035Yy"
+	.ascii	"f\005\245<cB\225\270\311{\274gKUh\222\t\245\214cB\361(\317\226"
+	.ascii	"\240\224I+\250\022@\260\210\250\261\301\347d\214\351\224\311"
+	.ascii	"\213\303\211j\351\211gN\2312\257\335\275\f\205\306}R\340^*\346"
+	.ascii	"\223\335\222\024\257!\347p \245,1\371\204\023\362\212y\223sJ"
+	.ascii	"/"
+	.string	"\346\275^H\243\353d\3011\235\273Ex\356\030\204\3526\321\270\027\205\323\275G\276s\367\336\343\2757\370D\225\336;\305\243\344rr\272w\351\343t\251\216Vh\334\333P\306\254A)\317\256\230?V\236\234q\335\032\351\221\271\256\235\325\023zv,\273MgP.\250\250\274\266i\312\367%\307\021m\233\207O\016\\\024)\227\016}/\377\006\242\245\372n\212,\253-\037\260\343\347\375\203N\330\321\007\222\266\006t\324\337P\255\243\2214\340Pa\371\001i\333xl\342\\\221\343\347\375\364\236\234\25617\316\332J\300=g\373\3207\270\371,\335\364v\342(\267I\246\367\254H\333\261H[\313oh\016\301,g+\273k\264\215\267\262i\220H\266\322\336\273\304\234\200\016s\002\300,ZKfl\350\337L\311\234\036O\254\3124;\331\310\020\204\350A\246m\037{\351\215\354{\033i\001\363\336\245F\356\364\335\273\264\303\234"
+	.string	"s\002v\311\325V\224\323\236\251\374\371\235"
+	.string	"&\f_[?>\202\325\350"
+	.ascii	"\357e\232\341\272\367\256\341&\373q_\352\203.\257\220\021b\355"
+	.ascii	"\271\f\345=N\303\315\023\314\307yXH\2500\224\207{\371\304\311"
+	.ascii	"\177\177|\342<c\241?\033q\"\370e\005\310\0204\254g\304\026\332"
+	.ascii	"_[.\202\363\270\3718>s\033\306\207+\252\037h\017\367\217\037"
+	.ascii	"\207\3678\333\246\244\354H\204\333\331\365$N*\334\254Z\265\352"
+	.ascii	"5\252\356Hr\224\252U\251\230\215\347\260<\020\023\363\300\216"
+	.ascii	"\036\0234)\036+\365\273\002\220J\022\310\314\340\335\233\026"
+	.ascii	"\251F\270Y\263\356\223\336\254zU\261xn\231^\0358S\360\316\200"
+	.ascii	"=p\342\201\234<0v=N\254JDGJJ\344L\333:$\270\224\202cb\006\341"
+	.ascii	"f\025\202\006\314\212\232\337\265e]\371@\177J\241?}\250@\320"
+	.ascii	"!\360|\234I\364\347E\017L\203\036\250\207\036X\006=\260\016\375"
+	.ascii	"+\217\272\004\236m\321\343R\227h_\344\232\220_P\036\3569\021"
+	.ascii	"\340\236\263Up\317YsT\250\212\\\2626D\355\t\205\254.jmm\305\321"
+	.ascii	"p[\\NN\355g\207$\255\254I\355O\217G\333z\003\245\001\314\222"
+	.ascii	"\342\306\007\025 =\332\276\336\370\333\210\352\203\016\177~G"
+	.ascii	"\264\275\035\2338\253\362\347\325\006\016\027-xM\332\222(C\363"
+	.ascii	"\232DS\231\272,}\302A*\251 \350\344\326\021MR\237\235\2450Fj"
+	.ascii	"\264\255\267.U\344oc\303\326\364\205*\f}=by\321R\322\266\327"
+	.ascii	"\274\377~\233\240\330S2\315\013}\367\265\337oS\375\342\330l\264"
+	.ascii	"=\360\b\372\356\201L\025\037J\003\350#\205\315\030'wF\332\276"
+	.ascii	"\371\376\336\3534M=\226D\264\275\216\021?\357#z\013\n\034\\\333"
+	.ascii	"\034\340\322\2313b\226h\r/X\367L\021Et\022\276\267\317f\353\251"
+	.ascii	"G\035\030\"\210h36s@\232.9\2712e\372\316\346>\271EM\201U(E\344"
+	.ascii	"\271\265\355;\233$]WMW\302\204\3511ag\032\246\224)\346=\206\213"
+	.ascii	"\364\321pj\333v\235<\331\276\200\200k\333u\315t\023\004Y\345"
+	.ascii	"K3}\241\2715aBG\327`\320\216\354\314u\335U\265m09LW]Qm\333KW"
+	.ascii	"\341\220\r\261\245\213\305\352\322\005H\324\324\236N]SL\333\333"
+	.ascii	"\034r\315\226\353\251N\357\323\271\\\263\204\300\336\345\215"
+	.ascii	"\305\371\301"
+	.string	"\301\365\033/o\255\343\0215\005\226\363F\344\210\0201\250\026-\375\206\336&\224H\232\"8\334\336o@\2576\034Pm\273\255\223e\300px\265]\271\322X\232\1777A\362\372\262\260\275\2610\233\225C\"\367\204\n\225^\003\3402\237\b\341\303\303\261\261eL\252\312{\r\007\nGFU\345\205\246\245\265\224s\210;*\025\226\214\026\037G\324\336R~(+\022\245q"
+	.ascii	"\241\313\002c\263M\272\226C\260\320w\223\033\255\331h\254\347"
+	.ascii	"\223^\035@e\236.\004\257L\364\314zg\332gi\233\235\367r\312\314"
+	.ascii	"\361TV\326f\350\221\211\310-U\004\231\346\304\2468y\233\3316"
+	.ascii	"&\"jh\350\234\004\021\327\366\225\007\372z#,\254\311P\246"
+	.string	"\037co25\245\337\222\266-\326\311\235\037ypcm\233IW!\251\241\267\204\325\340\b\261\027&OI\302\007\035l?\372\272\272\372KH\016!\336_oB\320\344\265\3551d\b\301\020\232\270Q\221(\304\341\210H\204\302\030T<\001\275\321\n\002`\030\223\216\210J\305 %\030F\234\031JC\027;\306\033\255(RbQ\244\3243\224$C\004\243\260\210\223\004\243\201\305 \022\306\240\244\"%`R\221R52\026%\tc\234B\035\216\212\266X\024\022\211\210\204\2023\224\206C\226hT\252\317\231A4\026\217\212\204,\004\365\020\t\223\212\216b\b\005\211\204E\0316ixd\0242\n\021\021\203\212\224V\350\004\t\215B1\224\220\204@FaQ\310B\221\022\212\027:F\341\213\242\020\tCF\342\r\221\320h<\212\241\364B\200!\220\013\240\026\214\304\241\321\013\037$\241\2618\343E\211\030BCC\023z\\"
+	.string	"\265p\002\317\013\243p\004\241\rB'\340\020\t\215D!c1xN\260\302H\024RZa\024\2160d$\346\030\205\220\210C\021tR02\036\275@\004"
+	.string	"\321Q\f!\027\212%\f\031\211"
+	.ascii	"\2000\004*Q\234!Dd?\304\302\020\250\304\207\216\210\302$a\021"
+	.ascii	"z\013ZH\320\"\203\034\202\317@\203\t4\230\340|\006\032\374\374"
+	.ascii	"h\320\342\007}\213\237j\244\240\202\030\303\341\007A@\242\220"
+	.ascii	"\321\220-\006\025\035\301H\032\272 \021<\301(,\302\2001\f\322"
+	.ascii	"\301\310c\0342\022m\21477:\361\241\222\220\310\3028\034\022Y"
+	.ascii	"\340\024\217b\3048B:\213AB\244# \241Q\210(\b\307\030\324\342"
+	.ascii	"\007%\n\tgX#c\322\020\t8C\210\250\026\2112\206F\300\242\320("
+	.ascii	"#\351\b)h\f\312\300\230t$#\370\237\037\027\b\264\200\302\b\350"
+	.ascii	"\320\n!\322\221\221E\322\020\ti8\304\"\351H\b\211\305\020\261"
+	.ascii	"\310b\205O\221(i8$,\006\343\352Y\205\253\242\344\013\316l\307"
+	.ascii	",\375Ae\013Yp\215\006V\363-\n\207\211\324\252s\353\245\222\336"
+	.ascii	"\330\230\266JV\367e\307\325Z\222\210\305\205\221e\351/\2575l"
+	.ascii	"Sm\353\225\312\366\212\345\025KW,\365\357\357\034\003\203v\332"
+	.ascii	"J\245R\251k\350\361JL\255\362\272F\342\206\362\355-Xd\212\226"
+	.ascii	"\0162{jZ\312Uur\326\305\212Zc\335\204\345i-\333V(\265\207\276"
+	.ascii	"{\227*\224\256Qj\332+\224\357\004\355\300\224K'ZOY$\227\035\177"
+	.ascii	"O*\223\020K\206`r[=;\323.\237\230%\30276\246\236U\2634<\230~"
+	.ascii	"mkZ\313\270\251\242:!\022\202\206\245\355\203L\350Y\305\271\243"
+	.ascii	"\342|X\r\253d\354\344\346\b`\214\353\210 \366\356\375\301\352"
+	.ascii	"o\354\365Y\254\r\260+hm+\330\215(\225\211\330V\035\227f\262d"
+	.ascii	"\207\311\216!G\322\035\033+j\224\374 \367U\277z\252yn\022)e\215"
+	.ascii	"u\354QEM\2515^up\263\326\250J|\312\322#\016\2275:\312\247 }m"
+	.ascii	"\275\322dp\251.\314[\212\236\305\244*\017\2622@L\221\371Q\231"
+	.ascii	"Bt\351Q\227bc\352\017Z\325\252f\361\334\222\347&\251\354\341"
+	.ascii	"\335{\253V\365\301h<\267\334`\211\335V\355\252AT\256z\244\"\251"
+	.ascii	"I\002\202\261\250\242\3414G\342\224RfhDf$I\222\016\202\n\020"
+	.ascii	"\004ca\"\311\245\007\022\240\0055\321*\310FFA\222\202d\177\016"
+	.ascii	"@\005\221\246\031\261\216\321\310m\363\374,\026\t\023\030\375"
+	.ascii	"\303W\310c\263\202ErG\271p+\025Y@\003\364\353\306x\311\211\264"
+	.ascii	"Z\021P\251\030\344\263\344X\002\275N\372\221\177;\301\330s\232"
+	.ascii	"\261\240\017\204`\264\251\033\3748\342\352\334\363\361\361\274"
+	.ascii	"\255\355\313\233\337\247\314\016\371\324\343F\314\214Xs\354w"
+	.ascii	"\213\214\326/\226z\332\327\357\202\213\371\203\221`\241\003\213"
+	.ascii	"\262\257\232\t\340\257\"\206\332\2323(\037a\b\241@\021\306Gz"
+	.ascii	"c\035\357\216\367/I\001/\321\003\3678\007\247\300\227H\312\317"
+	.ascii	"\350|P\355\245Ue 4B\021^\326\007!\357\305\235\342z\021c\201\004"
+	.ascii	"\215\322\257\376\252t\221D24pj\021\331\220\036\360N\260\236L"
+	.ascii	"F\362\003\020(\242S\351\022\355F\211\37114\357\265E_\034!#\243"
+	.ascii	"\t\206\021>\223h\023\240\321\3134\bBqG\311\242\304\242\345`c"
+	.ascii	"\245|\330\337r\325\"\372\204`\270=\243\361\340\005_\244l\007"
+	.ascii	"\264J\334\273\307\2609\263\254\307%\205k2\223\2107\361A\252`"
+	.ascii	"c\b\356\006\322\243L\003\257\177\302D\255\362\263U\372cj0\314"
+	.ascii	"l\027\332\227\277o\262\242k\350\252\212U\276\004\2055\200T\270"
+	.ascii	"x\026F\035ak\243\315\206\005\206N\177X\2068\332\374\to\373\352"
+	.ascii	"J\003t>\366\312\331@\322p\t\316\177+\217\020Q\315\"9)\3540#0"
+	.ascii	"L\365\036\034\373\3048\026\267\266\370\277\376qu\340\334{\351"
+	.ascii	"?\234\374~\205F\314\226^ e\004\354\026\003\343\372\027\305\222"
+	.ascii	"\325umIz\265W\217G\312\267\314S\003\360\274o\254\245\365M\252"
+	.ascii	"\300&\244\355F\304E/0\201\2373\n\314\322\256j7d\0227\261\221"
+	.ascii	"\006s\345\340E\02633E\366\213f\304\337\303\024\273=*\235nP\231"
+	.ascii	"\205Js%\316T\302\355\215\267Ft\364b\266\034{\326m\013\360\236"
+	.ascii	"\036\032&\270D\227S\002(\230uE \212\025\001\366{Q\261\242\b\227"
+	.ascii	"\013\277>i\020.u\202\213l\304c\026X\212\274k\223\305\207\347"
+	.ascii	"\263(\317HB!\330\345\346f\362\202\031\345@t)#;\224\035\341\317"
+	.ascii	"\306\036]\263\251"
+	.string	"#Q\324\002h\271<F\321\355\316.*hf\303\313:5c\3620\263/\211f\017=[\002\231\261\202(\"\305$\327 \336\334\365\267\375|9\240J\232\235\036\223\217\f\237\260\232\266[\367\272-\t\212\206;$\216\233Z?\355\005(@\311\n3\t\217\227:a{\234nf\337\026\232\211\241y\t\002(\315,$\330=\\>a`\244\366\217\242\037s\311\377\353\017\275\264\243\263^\317\330\274V\034\245x\261\246\r\001\252Rt\037Y\022\263K[\212ZY\354\f\301\367\266,>\004L\306#YG\322\200\346_/\247\243d:@\360\313\240\003GP%\022\204\0267v\317\t\211\276]\3142W\204wn\250V\244\305\215m)\254\333A\227r\013g\310\250\\@\021{& \223\223P4b\304C\023@\332\022\022\235\341o\260|\203\234t\2603]\211\017\300\304A\240\2667i\326\311:>Hf\363\274\007\031`\244\361"
+	.ascii	"\020^\236\315\257\206\026\026\316\325\037\311_\270I\263\0017"
+	.ascii	"\351\243\004\365V\323\230xr5\361\n\231\240\375@,\212aD\240\366"
+	.ascii	"\2230\017\231\324\240\376"
+	.string	"U/xv\023\274Z_-\304%\277E\r\2531-\266\201\206\024\027'mX\020z\314\372&A\347\262)!.i\n\334\330\356\331\233\301T\24604\346f\031\213\017x1\377fP\177\302\036\2013=^B\324\323'\"n\270\270\274\367P\240\244}\215\262\267XB(\377K\347>3\367\006\235z\217\37540\351\200P\366\213\266\304_\301\220*\274\321\3438\002[=\214&\244!\264\b\035G\205\334[\304K(\n\207\364\300\177\335y\326378?\213#s\241\361\327\217\274\310\341\324\256\372\034su\217~T\333Y7\376f\344\205\006{\214\217\205\372\0028"
+	.string	"\370\\\322 \214\275\300\233z\036\017/]\016N\221St}&,\033\376p"
+	.ascii	"\341\221\275\363\301\361g\377\246Y\337\363\331m\365\343\334\257"
+	.ascii	"\300\236\027N'\267\250\037\300\235\305$\335\372\304cEl\366\311"
+	.ascii	"C\354}\315\363<\n\216Q\205\013\366\212\343\340\341\265\3706\373"
+	.ascii	"X\243\377\351\036r\265y\254J\\\251\317\341\265\330\"\316a\236"
+	.ascii	"\275\035[\303\241\347\264Ro\231\317\371v<*\033\274\017i\363>"
+	.ascii	"\305\265\327\261jO\246\344\035\325w\242\237q\372\207{\243\372"
+	.ascii	"P\023\2172\3509\2430}\031\273\"\223\253\370\b\327\017\262\322"
+	.ascii	"\361\316=lN \034+\360\216-\326\257\354*\233\372\231\327\257\360"
+	.ascii	"\231\334z\320\3533\035\341\314p\005.f\203\251o\325\334\332\361"
+	.ascii	"\n\260og\350\243\262\365\316\260A\360\313\232#\375W\231\307\350"
+	.ascii	"/\306\213\273\265\325\375yr\021\350\265u\350=k\003\207\241\304"
+	.ascii	"8\001\026\364\240\332`^9\362\025\220\351\337\355\317L\326\n"
+	.text
+	.section	.gnu.lto_.symtab.66aa276c037f2467,"e",@progbits
+	.string	"rtcTimeMake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"rtcTimeGetSeconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"rtcTimeGetMillis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"dateTimeFormatUTC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"timeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"dateTimeFormatLocalShort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"dateTimeUTCToLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"dateTimeSplitFormatted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"rtcGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"pgResetTemplate_timeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"timeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"timeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.66aa276c037f2467,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
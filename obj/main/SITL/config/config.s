@@ -0,0 +1,2887 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\244\002\375\016"
+	.string	"$\025\230\003"
+	.string	"'"
+	.string	"\303\263\213\202\001\024\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\250\350\335\333\002\n\002\001\002\003\002\004\001\002\005\002\006\002\005\004\240\342\234\212\n\006\t\350\300\306\254\005\002\002\007\002\007\n\352\263\360\321\b\013\321\211\300\200\002\002\f\350\223\272\372\005\r\246\271\307D\002\002\006\002\b\017\310\231\353\334\f\004\002\t\020\021\371\323\221\332\fT\002\n\006\002\013\f\002\001\002\b\002\r\002\016\007\006\001\002\017\020\003\004\002\004\024\273\203\325\342\t\027\221\366\305\344\004\216\001\002\001\002\021\002\001\002\022\002\023\002\022\001\002\024\025\002\026\002\027\002\030\031\032\002\033\034\002\001\002\035\036\002\037\001\002 \021\002!\t\002 \006\002\033\027\002\"\002\t\002\030\001\002#\007\002\007$\313\202\353\372\r%\361\223\327\210\007\n&'\256\222\200\314\017(\267\333\375\360\007\002)\274\351\304\362\006*\312\302\204\263\006"
+	.string	"+\201\227\212\371\t,\244\277\210\226\013\006-.\350\352\264\304\013/\354\206\342\366\006\002\002\t\002\t0\337\231\330\317\001\b1\224\272\233\325\r\b\027\003\002$\002$2\334\237\214_3\261\340\353\213\002\002456\374\213\316\204\r7\326\273\224\201\00389\240\301\276\347\017:\271\230\252\375\006;<\240\342\234\212\n"
+	.string	"> `\002sC4\036u\362qq?\326e\375\322\002\313\314!H\306\273\377\244Y\241\003\330\255\016\302\n\004%\233\270\306\006\251\366\033\264,\322\232YU\fr\007\274E;\f\016[L\274\213\2637\317"
+	.string	"\343_\346\337\020\360\r`^\023\321"
+	.ascii	"\312\214g\243\033\343\322\233\034Q0\270n\007\375y_pX\304xGo\341"
+	.ascii	"\236w\2167\264\364|\301\352w\257\b\356N\341\030\344\240\307%"
+	.ascii	"jwcp7d\263\360T(\235\375\033\202)V\301\207"
+	.text
+	.section	.gnu.lto_.ipa_sra.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"}\003"
+	.string	"\322\304\f\020"
+	.string	"\247\r\007"
+	.string	"\364$\231\252\301\262j\241$K)\316\301\256`\006"
+	.string	"\373\325\244v\232\322F\013\351\3434\314\313\n*\212\254\256c\032\263\230\304\034vk\342+\031"
+	.string	"8\211`\306\355\"@"
+	.ascii	"L\205\252\024\271\231!M\017\242\320\207\262\030\013n0%g\336\342"
+	.ascii	"\3236\226 \001\270\007x\264l\330\025\227\033A\005\025\305X\241"
+	.ascii	"\254\237\243F\003C"
+	.text
+	.section	.gnu.lto_.inline.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`p\005\265\017"
+	.string	"f\221@;\020%)\035\200\270\334^G\b\001Qi\223\332\300\026\r\326(\237\271\271k\005\247a\343\300H\004\030\355\276\306\210\253\252\350\177U\265\250*\"\242h\204\266\372\223Y\333D\342\211L;\005+"
+	.string	"3"
+	.string	"1"
+	.ascii	"\261\255\310\247\260\247\320mG\241\b:\366?\264\312\227\377\006"
+	.ascii	"M\327\237\377\277kY.\241\331j\031n#\313&4[m\241Eh\367\005'U\241"
+	.ascii	"uL\027,@J\336\264,\223\303#\363N<X\331\205\"\373\2112\267\271"
+	.ascii	"2\314\210\016K\001D\202/;\215\354\371/\320\001\322H\204\262\277"
+	.ascii	"\344\n\n%\267\352\025\217\227JAM\024\240c\235\220\360\300|\204"
+	.ascii	"U\006\025\242\037\227rL\210\315\314\353\203\203I\376\007\264"
+	.ascii	"!\225\341\177\257\f\340H\225/\031\344\017\305\210]\230\273EO"
+	.ascii	"!*o\267\233\255kUIS\363\341cr\234\341\274D\022Z\321r\3458T\236"
+	.ascii	"\264\300fB\3656\376w\264\\\333\222#\207K\027m\250\301\275*\t"
+	.ascii	"dT+\225e\r\220\242\031\"+\017\022\200\344 \310\203\3060# L9\022"
+	.ascii	"I\214\004\225\273\260\322\032:\340\212\345\261U\t\214\034K\034"
+	.ascii	"\363xO\007\220\371\t=,\270\2124\207\204\333\320\246\013/\221"
+	.ascii	"b\3603\254}\215\232riD\334yF\335\262|\007C\240x\243\203\205\364"
+	.ascii	"\274\244\306\346\346L?\004\344\030\254\201\224\233\343\225\230"
+	.ascii	"\213\377\365\325\240H\307qJ\266\320/j\205\302a\372\020,\214\026"
+	.ascii	"8\307#|\321\034\035 8`#\322+WX\340\316\225,\325D\216\177s\214"
+	.ascii	"!\366\232\177\254\263\357\n\331\207\211x\016\325\355%|qL\373"
+	.ascii	"\355{\r\244\220\206\314t\\\034C8\215\021\373tI\332\031\237\300"
+	.ascii	"L\025\213\303\217f8\037\b)#\026xuV)\231\365{7\031\377nw`\266"
+	.ascii	"\237W\214\365\246\034o\313\\\370\254>\214\251\316\204\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`*\005\005\022"
+	.string	"\306\226H:\020u\222\306"
+	.string	""
+	.string	"\324\203<MBn\3729m\340;P`>\005L"
+	.string	"\216"
+	.string	"\244\324\243\334\256\256\252\252\252\252j\024"
+	.string	"P\261(S/Ri[\020\"\304\204\024\262m7BdJ\0012"
+	.string	"8"
+	.string	"="
+	.ascii	"Z@-\321\001*@\003(\2003\275S\324\247(\333\fv\213]\234\n"
+	.string	"w\361V\034\013[\303\030h\217\2501\217\351\3234$9$\255\220\372\250\bT\t\002k\275F\243\264\224\226\255ek}-\312\354\030\333\210\242o\2042\223\204\344#\241\214\3065\256\204\201\351\326v\224}\037\270\317\204\332\215\275\303\370\027\243,\335\t\024\227\342\201\f:\266?\017\0079\026-\370\217\201\334\007w\031\343\201\270\020\004>\021\352\245sc\037\217ceE\342t$\225_VY\034\223e2\035)\217\224}&\307f\231L\3114M\323\366_\013\004\005j\005\216\242\240\023$\370\211\335\363(\032A!\350\003\335\250\233\0354\320\315\f\324h\301\211\002\fv\301\236o\303\214\227\261}<\356Qd#\307\302\341:h\366\b\021!\017\361\035\037\200\206\250aEs4\n\222\224\221\244\003p\"1eD\017\022 ri\030\2079F\315\221\320\246\262\263\237\001\227(\226\210\364\220\260\3233\205\",\r\223\252\274\305\224<"
+	.string	"\251\361H^\223}\004y&R\335\257"
+	.ascii	"\325\\\013\326-\366\331\302\327\226\234+Z6?^(V \217MB\366%\177"
+	.ascii	">\250S\304t*\t\371\003\244S\215\005'\220\246!\255n&h\205\240"
+	.ascii	"h\026\\.\307\373\224S\363\016Z9\206\026\230\323\325\357\365\360"
+	.ascii	"\370\235\250Y\215\227\tV\327\327$\005\365{\033\005\374\b(%\264"
+	.ascii	"9\327W\334\207)\233\345\203\3565?}a\340\350\333\030\362\377\036"
+	.ascii	"(O\033\320\214\374\233\262eB\300\361\03039a\3213\206\215\351"
+	.ascii	"\210\273\0307\242\246\312s\315a2\017&\247\216<\222\205,\257\333"
+	.ascii	"\311(\367C7'\3640\356p\024\033\247\335\325\350\202@.\334\026"
+	.ascii	"Y\330\355zL\210o[\200N\214\232\fL\304\330c\36370f\\\031\370\354"
+	.ascii	"Y#\020\264\004/!\356\372\267\260\370\201\224p\350\362"
+	.text
+	.section	.gnu.lto_.pureconst.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 P=\002"
+	.string	"\002\305\020\033\200U\3513\300H\216\313&hB\230\321\272\242m\333\266u\320\307{~+\347\265\0033\273\330\274\016X\267\232\324\235\246t\243\013\335\347:\267\271\314]\256rCn\3075f1\2119L\341\006\267K\356\016\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\016\002%\t"
+	.ascii	"rL#%PU+\00703333333\265n\217Cc{(\325\355\313\323B\352\037\223"
+	.ascii	"\002\200E\373\207\340K#I\246\252E\205R\354\345yYe\213\n\260\262"
+	.ascii	"\t\t5\002\342\001rP\033\036C\364,\270B\202\3654\272\224\035\312"
+	.ascii	"\356z^\273\223\235\311\263dG\262\033q\"\257\265\253\236\225\013"
+	.ascii	"\331\201<?v\036\027 (\345:v\034;ic\215\035\365\244\0168p\323"
+	.ascii	"s2\310xJ\004\003\023p\320k\024c\347<\235]4\343.\236\216\314\001"
+	.ascii	"F\250qM\203\243\005\245\345\354\006p\002\031Bc\007\021@\031T"
+	.ascii	"L\315\b\231\224\3268c\243Tf\264v\016i\357\273\003H\310e\356\332"
+	.ascii	"\374N\260\214;\367d\3237<\376\006j\314\001\316\036\347Z\006\274"
+	.ascii	"a\177\275\316\304\372\247U\243x\fIb6S\260\027\013d\334\022\355"
+	.ascii	"O\02135t\240\331\255K\3303\376\307),=\tMh\312W\246\231\365\033"
+	.ascii	"\235#\306}\027\200\024\214&0\337\240\204\032O\210\0136x\307d"
+	.ascii	"q`7\006W\340\223\037\027\223\255_\342@\017"
+	.text
+	.section	.gnu.lto_.lto.f523afe6fc476f2d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.149.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \237\225\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\357\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\"\005\001\006\035\001'\001\257 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\256\222\360Sv\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.151.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.155.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"\024\bk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\303\366\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\222\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\257\222\320Sv\301,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.157.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 T}\002"
+	.string	"D\004A"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001"
+	.string	"\005\001'\002\206\b\177\005\001?\202\210\200\330\001}{\273\001y\273\001w\273\001u\276\001s\273\001q\273\001o\275\001m\274\001k\273\001i\273\001g\273\001"
+	.string	"\005SITL"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_isEepromWriteInProgress.158.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \346M\006"
+	.string	"\222K+3Pm\222\016\244\004\252\312\251\272Y\027`\0208\324\031\317\263\362O\036\272a\377n\207\327\n\246\342K\243\020UU\021\261\362v\001!\306\240\247C\267\266\267L\001O\226\207\213\003\206\232\032\346\302"
+	.string	"\321\246J\242Y\b\246\"\032\2526AQU\253`Y\374\034\026p\260\342\033R\021\353rL\221\271^\225n\006\240\322\241\200\006\347\262\3076\207\240o\224\370\371\357\303\001\017\223\203\223\314N\226\222%\022I\307\257\371\312\t\n\232\255b\241NA\030\026#(\231X\303\215Z=\353\026\244\321G(\273<\233^\300Bf~\227'\243c\177\203\037\341\277\b\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\177\021x\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.159.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"b\214.5Pm\222\016$\217\250(\004\252+k-\034"
+	.string	"\304c\3203\304\365Z\332\005\271\241\335\2166\364\316\251\370\322(DUUD\361bv-)d\"\007\321Z\373d\313\024W\233\006\016C\307\252^\207\243\340\360\252\313\3636\003[\017\013\327\203\260\254\353e\266\254\216\264#\310\\\350\367T$\002 \263\002\341\206\324$q;J=\361\301j\245\356\347R\n]\200)\303\323o!t\245\257%\035\351\307\321\t|\234hJ2E\247\2254\241H<~\320g68"
+	.string	"\215u\333\020]J\031\026#*\231\333s\032\305\212\330-H-)\034(\332\210\242\210I\310\314Q\033]t\327\277\340\327\374\030\001\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.161.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"b\214.5Pm\222\016\244\034\021\252\344\253h\3266\375,\341\330\240\347Y\371\363vAnh\267\243\r\275s*\2764\nQU\025Q\274\2303p\2101\350a\264\326>\3312\005W\232\207\215\003\307\252\036g\303"
+	.string	"\361\252\253\3634\003[\021\r\327\223\260\254\353e\266\254n\264#\310\034\350\3574d\002 \363B\341\202\324DqK\245\256\360`\265R\327s)\205.\300\224\341\3517\020:\322\327\222n\364\343\350\004HL\016N2C\247\225,\241F<\376\317gFH\370\214u\343\b]H%\f\021\225\314\355\271\215bE\354\366\243\026\224\216\024MdQ\304,d\346\250\2112\272\353_\360\033\374\032\001\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.162.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\r\007"
+	.string	"\"\21505@o\222\016X\340\032\336\021\343\036\240N\241\232x\027_F\226\337\307;\003zC\233=\353h9-\360\242\006\037\303\360\250pi\261u \263\311\037Fm\244\021\"SW\233\b\016D\307\252b\207\343 \021\253\313\0237\007[\023\017W\244\260\254+j\266\254S\276\321\017!{\241\337\323\225\212\200\314\f\206\253\322\315\342\216\024~\361q\325\n\357\347\t\244dn\346\267\220{\036\337)\337\350w\2737P\202Yh\311\334\230\221\311\027\310B\362\203^sMz\002\032s[\b\007E*\321 \2252\267HP\003\252\320\265\200*| \305\352\260[\224N1\".\232\b\243\016\240!3w\232\250\243\277\376\t\277\302\377\021\n"
+	.ascii	"\252\322\t\314\264\312l\034\n{d\260\3105\3746bd!\362pWL\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_resetConfig.163.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\b"
+	.string	"\226\320:7P\305&\035"
+	.string	"\225\312\0035\375\336\022\t\276\006{\267\270b\223\301\307\220u\347)\261!\322PV\233\b\377gk\247\321L\021m\221\371\352\3676n\306\360*\222M\244L))"
+	.string	"*"
+	.string	"+"
+	.string	"\177\257\234\331)\027u\354G!\213Q\313\356B\345x\366\314\374\177.\300q6\317"
+	.string	"\204\335ur\034\214[o\233\300\266\201m\226\233nl\321\226\272a\177Z\365\330\231\2362\255T\245Q:\350v/\272"
+	.string	"Kz%\037\266\357\203\036\322<\304\n'\325\237\255\261\253\217\224\352\244\257\350l\331\331\027\371H\364=\034\201\345\271?\037\243\376T\037zA\t\005\244\003\312\320\262\363K{\202\"\3179I8\244\266.\016\230\206L\264`\006\263\360"
+	.string	"\255\013\203\227\001G\b\206\013J\304x\301J\244}Z\365\370\237'\230\220"
+	.string	"\250h\272y\322\321\271\025-;?\r"
+	.string	"\252\244\2231\275\177\206\341\254\002K$\245\270qM\354\037\202"
+	.ascii	"\025\320\251\240/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_activateConfig.164.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`P\002\235\022"
+	.string	"\366_sH\300\324M:\2703\222\fv\263\306o\0377\372T\270\303\013\273>\257A\220\n \300\377o\252\311\355\332s\266f\037V\223l\374x\33663._\367*%\273K\324/\004\270R#d\353\211\351w/Zmnd\023)S\nX"
+	.string	"Z"
+	.string	"d"
+	.string	"\326U\237@\t\212(\224\036s\232\250:2wQ\t\310\366\375\241\023\325\\\347U\316\322q\317\3314\277a\rS4\346\2344v\215\315z<\313\322\026r]\317\\\3550\335\030\025\231s\202\313sy\225\376\205\036 \304\251]W\017\346\234\326\020'\347\336\333N`;\202\255P\001=s\316\0069\256\003\266\022\213}\217\255=\321\343\211\026RH<G*\\k\262\233t\223\3449\313n$\002\300\2346\f\374\242\343p\361\177\036=\213\321\2071\337\243k\237;\310b\311\b\316\246U\266\356\246\273c\337\233sN\257\216\355\251]Qm\262\352VT\307O\355E\365z\032\352;\311!\2467\311\034\004\t\336=\365=\332\023(<\355l\266V\301\311\202\017\003\372\2651d8\261\331\232\225\276J\244i\205M\2536\3408\260l\fP\273\203\007}\350\013]"
+	.ascii	"R\320\356\2665\267\326\347\361\244\031\377\307\037R\364a\312"
+	.ascii	"\367\370\334\025P-\025I\035Q\235\350G3^RO\b\342;T\274 \001ny"
+	.ascii	"\205\220\301\2002-1\331\b\226\002\206\275b2\226\227\031\f|\221"
+	.ascii	"\251\270\2000\032\t\360u\3003\230\025\032(3\233\321@\226\316"
+	.ascii	"vo\256\316\205\024;\333\336vJr\026\350n\\[\372H\027'%\266fo\343"
+	.ascii	"\213\003\221@Q\336\276|p\272\273(0\016\365\343OR\206\234!\203"
+	.ascii	"|\031\364=\352:\210\201D\326\030\202 ; \220\002)\242\243\007"
+	.ascii	"/C\224\323\315L\263n\303\270j\025\3364\f2I\211\006\2565\312\005"
+	.ascii	"\313\237g\331\007\261I\022F\337\210>\030R\324%\037\033\310)p"
+	.ascii	"\303\262\3356Y\3238 \356\322\374\274(\2271\204r\f\213x\261i\217"
+	.ascii	"\226\270\340\253]\230\241\004\355\2601\373\251\257ZbY\207\313"
+	.ascii	"\232\266\323\\\031\214\027\314\365\033\317\332\334\035\226\023"
+	.ascii	"?&P\254\203\b}\224(\360w\307v\247\342\002\246[\264\342\t"
+	.text
+	.section	.gnu.lto_validateAndFixRatesSettings.166.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`S\006\235 "
+	.string	"\246y\313I\200\030R:\177}\025\214\340\330\373 \016\313*F\2608\370\203t\212\243\020\336\302kFn\003\t\201\344\027\243\027\033O\362,\257\301G\035\303)9x\251\3674\355\367\t\345+x\222u+\331P\347\320\322\352\337\032!D\312$\003\263"
+	.string	"\247"
+	.string	"\276"
+	.ascii	"@I\2265&\344\216\356\211{\255\001\265Z\353n\367[\373.\256\024"
+	.ascii	"aK\252\006\271\017\331+wwtO\344YM\327\002\3129\265\310!Y\"\273"
+	.ascii	"\324\252Dpt\017\344\216\016x/=z~'=\212\3335\355r\271\362\252"
+	.ascii	"\342p\314\220\372r\253\265\372\032Gw\243\233\376T~q\335\364\034"
+	.ascii	".E\317\346\246=N\202\220\023\300Z3\036\235\236;u.\232l\275J\013"
+	.ascii	"\031\247\020\263\207\326\225E\306\305xz\342\324Zy\307\2503\001"
+	.ascii	"\2538B1\372c\352g\221\237@\222M"
+	.string	"\343q\352}\345\017$\327\214\307\030g\234\204Z\353\262\361\350\342\253\373\356n\355n\210\335T@\213\342M\220P\237\264%\305\025Cj\255\016\304\316d\270\347qtG,\361\215G\367$\322\243\334\027\313\222\325\353\367\273\216R%\305H\235y\342\346k\255\265\333jWY\344\336\016\261\262\355\252\335\037\237s}\003\034\354\013\340Z\337\336\311\313\323\274;'\257N\363\346\234\2748'\357M\363\362N^\233\346\255i\336\335\311Ks\362\352\2327\327\274\270\2237m^\264y\317\223\267O^n\336\017\340EI{\260\254\225E\263LEC\307|\034\354\347\372\265\336\273gP,\013\262\340\013\231\033\357\304\215,\203\027dA\274\366E\300\002@\236\342\005\247\177\305\262\344\315\232\020\002\227\037\022\262J\tsK\256o\316v\315\353\234M\363\272\207\251E\370\346\206g\371\365\032\262*\211\332\322\246\337\244\351]\36709\034\313\020/\257"
+	.ascii	"\371\314\nMw\260B6&"
+	.string	"K\327i\302\bh?$$T\246\334\310V\323\272\226\301<\033\3275\275\034\005\246\310\315M\033\267\030.E\310_W\273\035n\366\3531H\033\350\217D\201\2226\177\345\030\353>\273\307\214\207?\031b\346U\255PB\273k\341N\200LE\255V(\262\227\021\235A\243\364F\243\364h\267\331\r\262d\326\0237\273k\255N\347r\007\350>\223:\263{\3641a\327\240\341F%\364\257\r\013\"hH\304\220\310DTT`\351\250\004\360\f*\231\320\260\024d\002\022u%\202\037\222*\004E\034\025\r\211J5K\024dtT\2244$\362%\035\001\221|D\304%_\220\317\016\225\202D\037\323pH\364\355\224O\027\362\\\230\031\332S\027sm\265\n\260R\237F\261\230\353{\351\201\322^\267\216O\355\020+\303\235y\257}\372\312S\200\221\\\343\264\255\366\006\353\374i\364\255WE3[\227\026(~\373\211\266\325\201R"
+	.string	"\375\323\017\223lFQ\361\264\031!\004\2652?$\344U\030\2317\264y\260\344\364N\243:\275\323=mnB\366\272p1\277vC^-\t\323\246\323\354\205\3239\335\323\226\341_\206x\013[~\2501L\305\034r\204FD&-H\222\306"
+	.string	"\003\031\242J\007\021p!D\312M%J\341\032yr\202\277+\016;\342W0\205\343\232C\002HZ 1\022\251\337\016\252Zj\275\006\244\352\2434\341\003]\020v\371d)9JBu\213\335!\300\215\312%bEh\001\357t\247l\253\336\246\371\344\f\266\212\005\356?yTa\r[\021Z\300;\335)\333\252\267i\206\023T,I\177\353'\354\003\374\r\001\217<\276\251\225\220\233\332\303\366\261\022g3\312\026\362\030\325\377FFN*\2575\260\246!3\b\337f_\210 SF\0249P 8Z\267\263\275\304zY\227\267\340\327h\030ja\024\217\233\345\216W\350\334\r\316\317D\215zq"
+	.string	"\342fN\313$\251`"
+	.ascii	"}\375\251\244\022\252\246\"\324.\304G\035\331\377\001"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.168.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\303.\375\260"
+	.string	"\332\013\035<N HQ<c\324\360`\345{\3330\035*\244\235\276hc\3124\340{\3026\321\301\232\0368\322D\302\257`\240\311\255\274\317\270\207\234g\226#\006~\256\265\357Z\275\224TI\033\243\\"
+	.string	"\377J\203\310\020\214 8\243\002\332\215$(\211L)\245\254\003l\003\274\003\213\335f\272\021\273\351\272\321\272\331\272\335Z\311\334)0\323q\002=/\341\333J\300\260|\375P2r\343YE\226\245As\003\235\222r\320gX\347\210\235\"'2\237\214i\024\355\250\223-\274VC\253)'\231\030\332qK\021\215\224MT\312.\323\271\305\003(;9\303\313\216ZXW\026\245\006\322\225\201\351\277\245\266\343\034\351\022\337\270\305Q\357\312hx\361\371}\261\002\364\263Z\005\375\034\320v\374{f\250\334p\334utF"
+	.ascii	"\220\213\026\200H\303\361Oq,{@\303q\006-0\356\270\226cfr\004"
+	.ascii	"\032\216y\330qe\241E\200\231\331I\241N\353\266~c\346\226\206"
+	.ascii	"6\333-\004\"'\266\267\352\002\264E\036\312N\022\255\255\326k"
+	.ascii	"\315f\233\300\372Z\261\275J\\5\266\034l\r\304vR\331\026\330N"
+	.ascii	"2\212\025\315Fk\211\232\330\336)\024\221T4\352\373\342\035u\222"
+	.ascii	"I(;\311\314Mf\305f\363zo\272\326\240\336\250\357\373&}\227\321"
+	.ascii	"\337\317\317\017\347\361\367\312\326\214\224l6\217\341B&d1\034"
+	.ascii	"\345A\026\344@\006\3440\374\307`\330\217\373\370\013\363\361"
+	.ascii	"\036\353q\036{a<\276c;\256c:\356\302\\x\216\3458\216\341\370"
+	.ascii	"\215\335\030\312[\270\215\331j\320\230!#\006\214\027.Z\260X\241"
+	.ascii	"\"\005\n\006N$\231(\201tDb\204Q\321\002\"B\200\370\340\201h\250"
+	.ascii	"\003\007\241\r\0322`\270\020\004\364c\241\202O\017\317\216N\016"
+	.ascii	"s\211\243\274a\223\353{\223\373\306\006NTUS\363\030\272\346B"
+	.ascii	":\271.\316\204\\\232\305p\211\312\r\nm9\327\202\266\234s\316"
+	.ascii	"\202+Q\230(T\247\320+\224-'\227u\210K\253\252\346\034\230\326"
+	.ascii	"\f\230\206\346\034F\013\032+\316\177g\315`\314\232\375\314\312"
+	.ascii	"\234\373\204\266\234fi\304\234\277\2345\363\2055\357\205\201"
+	.ascii	"9\353\255\377D\205\"\264\345\254\262\312H\214\342\234G8\205J"
+	.ascii	"\263\227\257f\274\257;\255\240-\247\227\263\335\227b\226s\035"
+	.ascii	"\b*\315tP\232\273@y\342\314\345gk\nV\363\\\320\226\363JNh\313"
+	.ascii	"i\205\345\0347\325\f'\264\345\234\032\301\371-I\263[\022\021"
+	.ascii	"\234\241R\315[\244\242\234\333V&[S\2204\263\tm9\221\254$l9)\340"
+	.ascii	"5\"\233\006!Ud\033\237\301\246e@z\2145\016C\215\277`CHUu\027"
+	.ascii	"l\250\336\342L\2638\263\"Q\205\031EOQ\246Q\224!\343\f\224y\233"
+	.ascii	"\372\ti'I\007\335\304\232\342\211\n\245\t\251\244k\216\032\250"
+	.ascii	"1\375&\350%\002\353\2508\022`\037\205i\022+P\230\225D\335\237"
+	.ascii	"\217X{\300\254'\352\334\350\306\206\tJ\374\272\350\256\027\270"
+	.ascii	"\223\332\271\b\277\016A\327 V\021t\253\206\017\\\352\272\270"
+	.ascii	"\207\271&\232\033Z\223\363\016j\315A-\315\205\320z\003Z\235\026"
+	.ascii	"\327p\326\031\316\n\315\034CY_(\213\212y\220\225\006\262\022"
+	.ascii	"\030\346?`m\001\354\257\212Wp\300\366\371\352\236U\205\231*,"
+	.ascii	"\346\022\305\303\036\243\362r\036B\252/-\337\311j\235\225C\241"
+	.ascii	" \331\007(R\272\364\030U\024\317YId\0012iB\252\254\025H\314\024"
+	.ascii	"3cTP\234\371\244\227+\211E/)\364\030\325\223\025h\312JT\277\265"
+	.ascii	"\007B*,\307\361\260\245\344\252\225cTV~\003\345,\t\235\\\221"
+	.ascii	"\016\261`Y\270\242;dV=\371\272Su\204Y\345\344OHu\265\022\275"
+	.ascii	"\357\333o\355RUN\367\033\033\357\373\262GU)i\026\322\314J\034"
+	.ascii	"f\316\302\274\300coQ@7(P\203\031z[\024\220m\255\301\276\003\177"
+	.ascii	"\376i\326ihZ\2361\256\n%D\334\026\236\205\177\362\215\264\335"
+	.ascii	")\333V\330\306X\210\350e\356t\b\027Z\026Z\3731\007\361,n\231"
+	.ascii	"5\303\024\304\267$h\357\373\222y\005\334Dv\317\270h\334e$\373"
+	.ascii	"\376k\020K\342\234\210]\260.x\235\007A.\022\252\r\317\215\360"
+	.ascii	"VB\205\177\262\3578\226\366\036\307\202\023Ve\307\303m\304\""
+	.ascii	"\275\024\267\017\016\357\267\335G\226\331\255\272k\204TQU\027"
+	.ascii	"\375P\221\254\207J\207\360 h\255\201N{\242\026\267\360|u\316"
+	.ascii	"c\320b\204\2229A,\347\223\320\310\235\033\316|f7\262\331D\264"
+	.ascii	"|\346\267\323\301\232OU\\\021\232P\313\307\301\002Y\3455\313"
+	.ascii	"\224\233\316\004\330\020\336\311\264\222\313KVNS\212\305\371"
+	.ascii	"\037H\334\253)\245t\023\274\253\231d\252YU\305v\022\347\223P"
+	.ascii	"H35\026\356\335l\30227\2354\257\274\243Bx7\303f\261\272\310\374"
+	.ascii	"\2477\027\337jv\375\006B)Q\232Z\336Q\234s\327\247|*\223\262l"
+	.ascii	"\331\233\35765m\214\205I\336]<J\263\313\201\362\350\234\201h"
+	.ascii	"\357k\244\243\330\2378\224\346\024~6\273\274\213m~5\253xG\335"
+	.ascii	"\274\316\024_\324\351\233p08!\201\251\247HU\262\357\204a\316"
+	.ascii	"\244\271\326n\322%M\261\026^^\345J\232W\326&\226\250&\031\333"
+	.ascii	"I\366\333mzc\244\223Y|\252\27164\302\r\240$\311\277)T4c/\264"
+	.ascii	"\022\313,\201G)\205\220:\222\003dI\263\320\032{\272\206JR\003"
+	.ascii	"v}'\003\235\232\371\221\246\226\032O7V\270\323\3725\276\232\225"
+	.ascii	"Z,[\377\311\3155\366\237\tJ\306\311\325\244ySsm\310\353}\235"
+	.ascii	"X0\263k\345\357\r \351\373:\271h\323\221\016\2548r\2609\330N"
+	.ascii	"\376\337\024\232\251\3468\211.\376?\331\333\210\365\377\001\025"
+	.ascii	"tr5\314\023\031\0319m#\226\310\373\243H\213;\222\345\364H\356"
+	.ascii	"'\362^\007\325\206%h5J\312\367}YpS\273\272\203\033\254\223\\"
+	.ascii	"\001\017\357\250Nr\363`;\331?$\253,+M\315\210G2\2639\375\237"
+	.ascii	"\314\215A\254-\312\317\305\334p\275\245\317:\013Y;6\367\330\t"
+	.ascii	"a>\316\r\266tn.\235\335fk\016\241\335\232\211\370\300\240\307"
+	.ascii	"\005;\316<\230\316\0260\235+\340q\246`\307y\207\217\363\004>"
+	.ascii	"\316JLg\035Lg\tz\234#\350q\316\321\343\f\001\323\031\007\323"
+	.ascii	"\371\001\246\263\003=\316\r\3648\337X:\333\br\256\301t\246\021"
+	.ascii	"\344<\243\235e\0049\307\br\206\321\316/\200\234],\235[4b3\213"
+	.ascii	"v^\321\316*\226\316)\332\031E;3\320\316'\3329\251\235K4]3R;\037"
+	.ascii	"\265\363\2106\323l\324\316E\355,\342\3079\304\2173\210\037\347"
+	.ascii	"\017\026\234=,\235\211,8\017-\235;Xp\346\260t\026\362q\336\260"
+	.ascii	"t\326\340\343\234a\351\214\241\202\363\205\245s\320\322\031h"
+	.ascii	"\307\371g\351l\301\307\271\202\217\263\217\217s\217\2173O\217"
+	.ascii	"\263\216\216s\016\2173s\307y\251\343\214\323\213\315\312v\276"
+	.ascii	"Y:\263K\347d\216\363\272t~\246\263/\235\273\353\332\316+\013"
+	.ascii	"J\227\334#\262\275S\221\220o4\231'\326\216\335\0017OE3\034Mo"
+	.ascii	"\237\223\007P0\242\370\013L\034hbl\200\201G\006>h\361\306\313"
+	.ascii	"\206$\214\215\023\325\023\037\344W\243\247\211\215\002_\364h"
+	.ascii	"$\375\217w\354\244\017\302\233\361\325fn\303\270k\202\316\260"
+	.ascii	"\370d\224\370\005\364\274\357[\342\231}k\244\225\030G\377s"
+	.string	"\370\276G\2774{^L\"\007c\304\353\264Q\216\370\233&\356za\240/\212\376\t\273\350\373\261\004\247oj\027Y-\242\253\234\331\006[1\336Q\"^\347\213Y\324\251\305?[C\226\271-\374\305\326\220\305\231\0261I\261\235.\220\230\202\214\256\254\021\350k\316\215E\210\227"
+	.ascii	"\230\2262_\206\314T\032\242\252\266\342\3054\210\017\001,K\342"
+	.ascii	"\037\032\216)\004\361L\30383\025h\330\017\377\243=\363\321\026"
+	.ascii	"M\222\027\267\214?\330:\026I\333\307\027l\253C\200\037\330\256"
+	.ascii	"i\331\264\221m$\333\311\017\3174\204\363\360\374\177`\372\336"
+	.ascii	"o\207\350=\354\345\275\336\016\321\307x\272\r=?\236\273\304\245"
+	.ascii	"\3546\375\235\333DY\367v\256\263\341\274\236:\374\320\227p\241"
+	.ascii	"\236Ks\355\345~\316E\"\345&\231b;\331\341cpEV\325\"\340\034\236"
+	.ascii	"\037\316]\362n\377\3466iNd\235\270WO\337\304B\317\341K<\371\266"
+	.ascii	"\346\332\332\263\271Q\264\\)R\330N\n\375\2131m\252j\0358\263"
+	.ascii	"\373t\273\\\3171\352\374\246\024\377\324\342NEx\275\357{\346"
+	.ascii	"~u\220\232\3518=RQ|t\303\347\214U\371\n\270b\035\350E\346\222"
+	.ascii	"\365\027\0246|\007~1\240a\254\271\326\301\353\212KvAz\202\206"
+	.ascii	"\277q{<a\305\235\206\bc\216q,s-~\217I\377\344\033\304v\305\330"
+	.ascii	"\f\317\004\r\f{*\256\230\362+\303\337p5Vq8Q\216\336Zt}\274r\306"
+	.ascii	"\304\212\301\275\362\\\3155\016Rv\261\374\024\227\354\202W'\371"
+	.ascii	"\245\374\226\233\305\314\325\242\205\355$\206\357\267.B\341L"
+	.ascii	"\211\1772\225\243\336\362\274\372 \375\005/\305$\244a1jP/\322"
+	.ascii	"?\233\364\005\337[>\202\302#7\355\265\224t\2300\346.\353\243"
+	.ascii	"\2309Q\202\2277\022n\033{\301]{,\267\355\255\376\312\205\276"
+	.ascii	"\271qql'/\024\271\2311\033\361Oni\227\370+j\270\3475\004\213"
+	.ascii	"\357\361R~\006%\363\355\\gM^\243\177\266\021\333\343\033\356"
+	.ascii	"\373\217\356\316\213\034\233\311\02202J\276\312\315\220\332\230"
+	.ascii	"\310\207\270\270\300?9\350\201\276\267\346~J\251\373\274Fp\273"
+	.ascii	"\364\236\227[\367I\334\273\177bF\004\251\240\357\276/5\277G\242"
+	.ascii	"dB\312\354zy\n\270z\024\230\340\225\3542PG\200\236\271gh\226"
+	.string	"\327a\252\334EE|\2206N\332U\026\b\307\322,B\274\263\021\2179\310\033\371&7Ajc\2127\302A\020\315\234-(\340\207\177*\333\355c\177\236\t\312\347l\334>\035\317E/\220k~~\025\274\362\320\330U%\035\3171y\324\307F@j#\0132\214T\242O\001:\035\032\323J\254\205g\202\202qF%\035\317\250^\0324\026~\005\274\352p\346\204=\305D\036\256/\034*\274\3173A\005\303x\031w\372_O\260/d\246\025\276\367\002\035\321\235\352x\202\361\035\032\372\374\312\007F\350\237_\272\220\332G(F\007\205\273\262\306\r\377\344\236\347y&\350\340\240;}\255C\301\300\236\357\273i\030w\252\203\253\321\360\317\317\301\f\262\235\344\371\256\353\021\\vU5\r\377\344\333\323\313p\202\030\367\"%\304\273;\341\273\020C\035]\227\013a\205>7fP..\354;\032\024\274\201\t\"B\202,q\220"
+	.ascii	" LI@2\360\006&\202\f\361 \351\203\r4\030\322\200\005`\340\rL"
+	.ascii	"\020IZ\032r\301\201\017\230\226<X\022\031\002B\006\353\220\026"
+	.ascii	"\022di\007\223\020\020\206p\200\323\200\f\2060\t\351A\304\003"
+	.ascii	"\rp>X\332\200\310\003\rX\002\262\364\301\022\223\005LK\037,\355"
+	.ascii	"\b\"\204\351\001B\f\304\204\006C\026\320\301\022\220\244\016"
+	.ascii	"\206d\300A\022\020&\"I&6\360\222\007"
+	.string	"B\230\222>XZbJb\262\031\351\347b\b\314J\250.\032y'\267\353\373n\325xk\237\305-A\376\331J\254T\024\317\222@j\343\262\225X(\245\020Gt\260\004\002y\367\177@\003\235\\\315\231\244\223\323\375\206\233\312q\0214\311\246\346Zd\362-\302X\304\261\310c\221G\266\223\315o\271v\263(c\262\322~\3743\262\331\270}% \333\\\365Q\033q\230pq\314\340\207\307C\300\271V\233O<\036\002W_\314\326&}\212\n\370\322\026|\037V\360\026<\313\006\312\312Y\244\272\246\340>\266X\025<\322\227\262\212\030`\002z\354\277\255\256\nt\272\305)x\346\"l\212D\216=\221\3237\361\216\247\340;\205&\200\023\353\016\252\r\263Q:\210\200\346\023\273\343\1774\255i\326\305\025M\353|j\241\240\330N\356\370\246\272\3323S;\300?\255$\232\2416:\227v\247\354\324\235\016I\333\357\252\256\314"
+	.string	"\377\234\340\225\376\007t\320\311\325 Y\017\r'\370\032\255\324Z\350\212\255\204J\357\301\025]U\315\210\231+\273\235by\035l\253\326\300U\260]R\241m\322:i\257\303'\321\247\002\240\351\"2\003\350,\317\253\017\345\373x\251\257\366A"
+	.string	"\037\337Y\276\3214\210\2512\003\320\361\177\355\325\020\230\216J#\301?\360:\376&\020\312*\202\227 \307G\3607\216PX\020<R\347x\f|G \327\033\017\301wPh\305yi\016\305\b\340\212\305\361\256\370\300;\3608>\203!\224\225\323#\371\366\036\370\006\234\2525\360\016\334x\244n\340Y\276#\2206\376\306\367\2235\257\271\306S\345\005\317\306\313\230\366\323\260nK"
+	.string	"\214j<S]{%\331\024\007\331\310\354\356\255t]j|\247\351\025\317*\022"
+	.string	"=\216\272\321tO\035\321\022\304\340\250\225>\214Z\256\320\021\203\1772\215\377\021e\205s\037\337h\274"
+	.ascii	"\254 [-\267\213\215\022\245.\266\2307\\\247\265S\224Q\274\266"
+	.ascii	"\265\317\023+\233K\326\325~\301U\275\325E\317\312\260\006\231"
+	.ascii	"\205\326\350\357\020\326;\244dM\253I\323\223\247<{\307:(Y\337"
+	.ascii	"4\314\366\367\270!/\212\243\337\332G\030\274\036\211]D\206G\237"
+	.ascii	"=\257\023\030=\006/\305|,\006\337j\353\373\276\357\005H\215\301"
+	.ascii	"\367\331wb\257\220S\304)<f|\217\256\366\n\003\310\270L"
+	.string	"x\316x\035\023\366\252\025Pt\022f\201\214w5\030Ud|\223u\265qJ\256\202\177\362\232\3251\246a\353V{\005\211\254\004)%\304\370$\334\236\231\032\243T\253\212\202+,\214g\022[\243\264W\214P\200\314B[dv\277\254PZ,+\020\032\310'\265\025k}\322\222\265YZ\263\026\306\267b\2138rWU{D<\265\255\035JG\335\211\255\254\352\331\3518j\243\t\244\370\352d\255m\333\371k\022Uz\361LY~\323\355[\\;\347\035\365\342\037\340\205J\007\226\273x\346\266\256\275k\361.^\303\312\244\271\266.i\361\3558\225`\305\373\241\217\365\212o-\021\250\370\0345]*^H\032^u1G\353e\235R\342\3405\302\263\221\332\bA\n\275U\004%\345\032\265J\265|}-\0300l'S|\203\322\250\002\031!\217\303\020)\"\021\221$\005)d8r\013\020\206\302`\032\226\324z\022"
+	.string	"\0241\311\243\220!5#&J\322\336\001\034\344\327\315TX\361\235\272\204\354\311I\222\252\007\241\220\003I\035\204\342:jpOK\257\374\250r-"
+	.ascii	"\252D\205\304\005\307l\307\"\227L|\203\317J\237\260\3260\316"
+	.ascii	"\350&\203;\217$y\t\255\333\220{\331%\220Cj\013iY\365\316\301"
+	.ascii	"b\313\364\322$v\254n\205\r\020\350cd\264\031\027\307:"
+	.string	"\027\335\361\221c\347B\304\335\325\220ZS(-\255\240\020$=\032N"
+	.string	"\3327\317o\2022O\221\230U\f=\246\334"
+	.string	"A\255\004\\%\222;\340\224\354&\337\307e\023d \b\215i\354\f\3724#\261\250\255\210&q-9c\257\222\337\271m\177v\336\200\005\331\264\035\237\036\030\350Nd\211"
+	.ascii	"\221\ft\233\301\302\265C\205 !\b\177\376(hs\350\331\326H<-\312"
+	.ascii	"\372\tD\214P\366\326M\027\3740]\250\347p\031\364%!\016\324Fl"
+	.ascii	"\262\303\206\371\250\"^\266I\225\310\252x'\223\237/\263]\f\344"
+	.ascii	"\360\243\351n\362t\211\277\320\375\032U@\351\342v\205\324jy\036"
+	.ascii	"@\002\\4s\247\020\240\232\207\035*\307\025\007\222/{\003\001"
+	.ascii	"\234\313\320\316,\024\300\363\245\256\274\323\023\b\257\222?"
+	.ascii	"\264-\216\326\324u\374\225jM\217\001\244\300m\034[(F#3\035\344"
+	.ascii	"\247\242q\025\232\260\026\224\031\247\237]8H\231\023\354\341"
+	.ascii	" \177\342q\375;)\372\312\214.q\271W\027W\341!B\336\256:\362\232"
+	.ascii	"7\336\223\355\261\364\302\363d\277\256t\246\363\\\307\317S\005"
+	.ascii	"\3276\025\333\007\016\253\356\253\222\177\353aa\247\266\245\t"
+	.ascii	"!$\3758b\b\315J\327\256\372)\370\027u\"\274~\244\343U\231\203"
+	.ascii	"\234Sw\371S\201\241_d\361F^-\036R\207\314\250\365\351\034\357"
+	.ascii	"\034\307\367\004e\016hScS-\325\266\221\217f\342v\247#t\204\376"
+	.ascii	"\263J\031\376\273\237\333\213\033?\036Q\030\310\002\344\024\343"
+	.ascii	"r\363\n|s\250K;\310\276\312\224\220o\315\n \324\303\316\2608"
+	.ascii	"\313O\210\301\305H\365\322\222\001m\312\207\353\242\037*\202"
+	.ascii	"\252\230[\303\037*a\321\250\t9%E\007\203\243J\304\t\221\260\300"
+	.ascii	"\035\324V\027\336\234<;i}\n\f\340@\227kE\320I\200\204$\312y\344"
+	.ascii	"\210\214\025\324s\342\310R\366\003\276BG\314\316H\205\240\033"
+	.ascii	"g\213/Azvn\234\337@\030\305\303M\330\r\317!\336\005\344\244\313"
+	.ascii	"\261\262\334\207\204\204\303 \245\265*\013\211\330\023io\334"
+	.ascii	"J6\037)\301\243\337-?\260\030\347\024\246}\034\267J\222\301\364"
+	.ascii	"\324\026\356\323\017\365P\303\031g\325q\002)\237\255\224\003"
+	.ascii	"j\027a\002\374~\035d4\np\341\221\225\r\226A\025oD\254\371*\305"
+	.ascii	"\034\361+\375\214x\256\300\260\275\273mC G\306\340\330\033\024"
+	.ascii	"2\255\241j\357)!>\201\024\230\344II\303\"\264\321\222\326\333"
+	.ascii	"\300\003\025\026MI\210&H\3020\022\365\346\262\343\325/\227n\316"
+	.ascii	"/\214w\261\020\254\305\254\356\223J\177\330fQ\307E\277`\271\327"
+	.ascii	"\001#\017\316AA\352\207\t\177B\254\224\243 %s\217\031\332\264"
+	.ascii	"\007\317<]\247\020e"
+	.string	"n>\277\314L\242\317\004\240\027\253W\220\f\r\207\027\216+Z\226\327\032=\241\210\232\036\277\230\034G/l\277b1}\bXS\006\330\340\001\0231&A0\004\026#\314 \3604\360\245_\372&\323Q\033\230L\202\345+\024U\344\3356?9\253\207\367\267p\364\030\255\231\205\224hT\211i\177\335\005\303xA\346\013\235\343\005\373\1772\374c\271\365\337\344'\244\253\277~\272\031C\226\323d\256\300ow\214-\363\030\302\036\256\333\004\346\207\200L\301%[f\362!^^\305Qx\2569\203\031&`\241qMt\314\376\333Y\\Z\0277\201\f\013\214:\343\023\312\333\323\271\367q\202\027\373\355\035\276\313\335\326\027s`K\034l\355\272\252p\030\"\326\364\2426\277.\220\025\260cn\347Hj#\251\324\277M\262,\200q\261\333\363\0017\bg\347\013!\033\254$\371oi\357p\200\362\027\356U\337k\025{\0057."
+	.string	"\026A\021\250\251P\301I\024\312p\257\005\247,,\264"
+	.string	"<\317\310\035\265d\246\200"
+	.string	"\222\212\t)\25437E\354\320\2229\005"
+	.string	"HUL\210\260u\265S\036\230w+\253\230{\020GHs\013\003\bR\035e\244\002k\270\233\231\303\301\326\n\332\332I\224\310\002\\\311\267e6\027\303\376h\032m\250\013\260\036\337\002'\313\027\002D\003]c\374\003[\206\227\340;h\250\370\365\334\264p\276O\217I0<\300\215\214m\2116\n-6d\240\261\362 \323\375_>4\246m\031q\220mC\253\260\240\265\016\271*Z\310l<v\020\232Z\206\203\356\225\216\007\210\002'\tT(w\342\333}\334?\\\246\002_\244\273I\213$\3658\370y`\365\275:W\"~\316\345>?\244~!j\362\275n\021-\343\204\273\2359Q\201\267\352\006\330\263\306 l\033;\235\2308\204\320\024B\3241\f\237\334A\266l\305\370\211\205\224\331\233Les\226~\260\340\210{L\301X\322d\002?\264\226\2103d\017`)u\232f\373\314"
+	.ascii	"\324E\003+\347\177\\-\363S\t\013GV\033+e\nbo\356y\206>\0222%"
+	.ascii	"k\337j\3561$\340\307\ti.\267Q\325\215\360;\224\353\323\243Zc"
+	.ascii	"\360\272\275\\+A\321\334xv\026\306\273\214\347\226\252\253\230"
+	.ascii	"\267\362ED\367B\262\215&\274\277qm."
+	.string	"\321\221\247^A\201\326;\244 \002/\255X\334\034\276\025.~\222\016J\370\334\016\345\344k\021OD\002\027\017\314\251<\033P\343(BX=7\017\240Q/ML\317\021\240t\001Z\363~K\314FI)P\333\350\254\206\204\303\020+\013\223\037\372\275L\245%2\311\346i\354\321l\330\325\321\227\016V\307*u\243\252Ng\324\365\240\313k\250b\2256=U\240\263\002\002k\330(\216W\367,f\334d\332\245E\206\377\"\034\2362\310\251\235bI~,6\341\216V]rxe\320\320\261\2151\316\032\"\022\257\360\225\231\022\035(\254@\275\374n\262\200\027/C\b&\231\256\r\2667\217%\345\030\221\332\223~W\312\230=\025py\277\344\020}h\030\220s\253u\304\302zB5$\030\026&~7\304F\244\2026Y\347R<60H\226\327\004o\020\231&\301\3016+*\n\300\026\200N\217U\366B<\303/"
+	.string	"\027\363\3336<y8"
+	.ascii	"\365\331\330^\t\fl@\b\310\277\336m\303\204\324Z\361\242=\030"
+	.ascii	",\"\310f\r\024\343\320!<M\213\007\214\302C%0S2\253\234h\365g"
+	.ascii	"\364#\306W\225\026"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.169.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`N\0245X"
+	.string	"\212\215\340\037M \222\322\351-\346"
+	.string	"\317O\200%\201\177\2171\267w\316\033\";M\005\257h\314\237\216\321\357\277\b\270\340\362\207G"
+	.string	"\020Q\217\216\231\213\270\344\006(T\262\276\251\331D\256\231"
+	.ascii	"\032!\r\360\177\217\2703\253#\212\233\260\323\310\336;\245\224"
+	.ascii	"\002\360\001\303\001\344\001b\270\211\200\021\246\201\341\376"
+	.ascii	"\013\243L\357\027\013'\200Lv\370\365-\277\3709\341B\302\007\314"
+	.ascii	"F.\334{l\354\322;\264\355\305\n"
+	.string	"'\253\310\305\361\261\347D\013\364^\267\020\212\255\342x\357\254Z\270\267\350\201\220\334r\273^:L%nn\035d\341\316#\300\200\266\361DHf\271]\037\354X\331\236Z\341\275V&(\266\032\267\016}\307F;\256Ko\225frv\310\344E\261\325\266\322W\332\306\302u}\177\\\337C\343\204\007\364\336k\242U^*\266\232l\236\265\325\264wV\272<\271\300\257\270\274*d\276\340\200\306\344\335{\337Z\n\tt{L\002\363ZG1\241\3358E\220#\315\326m\314%\264\032S\320\205\0061\265{o\t\314&0\033[e\215\3342\007\266\033\331\3759\223\343\232Rx\357e\372\030\272m\023K%H\214\020\241\004@\022\322Q\322\250\210hH(\b\350\307\247\207'\304\216N\016\316\215\r\362hdk\212\304UM\337[n\242\213\032\247WV\233\330\322K[\364\274\204\226&\241%\317G\324\265\210:(t\256\004"
+	.ascii	"\321\205\221\037r\235\224.\211qY\241\371\272rHy\276\214\215i"
+	.ascii	"@9G\212\353\243\270?\034<9W\305\215\332\272\250\215\315\211\214"
+	.ascii	"\374\230\353!\265\026R\203\342AM\272\324\362lp\240t\tz\305L\363"
+	.ascii	"u\255\245<>\314\234}\367\304\177|<\255{t\272\226\244\311$_\227"
+	.ascii	"\231\363\370\365\021_\327\234\022\017Q\326;eI\\G\206\316\221"
+	.ascii	"\001\211\343\220\365\r\031\024\027\334F\254\221bt-\370\221H\033"
+	.ascii	"\211\310\2059\013\3265`q}\324\244k\210\027\217\214\374\370j\""
+	.ascii	"_\327W\025._\205\264\332\204\333\341\351\n\3756^[i\362\336\333"
+	.ascii	"R\332{x1\335\211.\356\275\354N\257\037\315\0014\363\3630s\016"
+	.ascii	"\31497\0022<\025\311\034\311\013\005`\300X[%\276\212!\207!`x"
+	.ascii	"\242)\034\334\371'\257\2576\340cF\326o\201\344\001/\342\202\372"
+	.ascii	"\027\fA\363D\247\005\"f\322r\322\377\030\0166$\225\300Y\020\362"
+	.ascii	"\027\f\001\302\020g\205\247\"\262{/\220\3162d\260p\360\346\373"
+	.ascii	"o\274ya\031\356\325\345\337\004\310\306\024\270\nV\305{\267P"
+	.ascii	"\260\243\340)\320\340.k\325\202\265\325\376\206\322JW\352\212"
+	.ascii	"\210\255\261\331\370m'\322\206s\371\t66\276\351\216;\2145\\\313"
+	.ascii	"\231\307\032\337r\354?\237\326h\r\r4\235\206\245\361\035W<Ct"
+	.ascii	"\"\354\302\242\323w\225\025\bu\206`\227Yg|\303u\332$\215\260"
+	.ascii	"G\372\317\300\206~\031*\206D\374\336\233\365\377d\242\230~Ze"
+	.ascii	"\374\215\267\035\266\374\fs\217i2O\334el\303\002og\253ic\260"
+	.ascii	"\266*\343[J'\001\241\302\374\313\001L\313\243\314n\314N\357?"
+	.ascii	"\231;\275\177\204\231u\266\301:\327`\235i\260\316N\254\363\f"
+	.ascii	"\326YF\216s\214\366\322\fA\3535;`tN\300\350\374\002\351\354\242"
+	.ascii	"\311\350\214@\013\026+p\234Ut_s\212\266kF\321a\232\223\220\216"
+	.ascii	"\220\316I\244\263\021\322\271\b\351Ldt\036::\013\031\235\203"
+	.ascii	"\216\316@H\347\237\243\263\217\321\271\007\351\314\303:\207\270"
+	.ascii	"q\336\261q\3269:\347 \235qnRg\033\2443\022\351|D:\033\217\316"
+	.ascii	"\254\321\271\246\2614\027Yg\"\353\274\262\316*\353\234\262\316"
+	.ascii	"\317:;\353\334\027\b\3411\373\244\234\315\375\237\333\365\021"
+	.ascii	"Es\367T,K:Lw_\267\227n\275n\274n,\335vMdn\346\026\323|\r\370"
+	.ascii	"A\007\177"
+	.string	"]\354\0333\253K\376\223\333\257\273\254\271%\260h\305sJt\364H\337#\305#\275\232\2057f\224\036\375\212\357a*!l6a\336}\031\033S\364\323\303\271l\321\373\371\026\002\026h\310\206\342}>\305\377\\\263I\317\373\374\n\246\t\345\371\236\357\024<\257=\313\342x\255\017\257\026\b\220\265U\236o\277f\340\007X\340\0236\255Nr\003\225<\"\021\322{\2154\345@o\030\n\361:<\t\200\245\r\"B\314\275\367J;\005c|\b\237)\\\207\016\374\316\307\370n\016B\360;\277b\n\327!\013^g\345vdt-\232\317\315A\360\275\327\r@\301\306\030\262\351\274\003\237N\341:,\300s\236\271\rk[X\333\251\363\311\255\317\342\243\234\357-mcL\t\225\246\036S\350\237\336\3268\357\2078\264g\rGV\245Ek\022C\245}\202\363\r\207\204-\350\237\356\3266\337F\032\257m\336\t\354\317\360k"
+	.ascii	"o-\235\327\276Pt\262Ki\307\006\360\267\026\215\333g\033\203\267"
+	.ascii	"\223m\340\264X1\204\356\370,\346\026a\315k%\257,L\304\324\006"
+	.ascii	"\265<\312vkid@=\305\347\324\347\346\217\276\007w{\266\"\277\n"
+	.ascii	"\211\263\265gFk-\032\221\032r\304\017Y\312\304\326~6\3604\256"
+	.ascii	"\343\003\330kp\2646I\252\244]\262.Y[\275\371\306\342\363\317"
+	.ascii	"\272f\362\b\333k\212F\375\212?\202\226G\335yK\264\247\341\356"
+	.ascii	"\356i\242\365\370\337\305\370\307gw\njyt\006g\322\236)\211\341"
+	.ascii	"\326\211/i\321\214\310ZeW\342f\355\223\026J\273\326\256\255\255"
+	.ascii	"\032\277f\006;\250\330\032\033\373\\\327\354[\367j%\241\370N"
+	.ascii	"\323\324cz\224k\236\375\264K\023J\374\232\357\273\2561\346\002"
+	.ascii	"!\327!\017\361o\274\361\260\345g\332<\234\343\004\216)\035LW"
+	.ascii	"98\230\362`\203\037\316q\302*\307\025\224\222\211j\251T\006)"
+	.ascii	"\227TR\013XYIE-\253f\340\230\232A5\245\324\221RN]\351X.#\300"
+	.ascii	"1\245\303\b\245\201K]A9EY\301\030\001J\311^-sX-\340\301"
+	.string	"2jy\265\254\232!\001\016\251*\020\206\244\224S\025p@5\345\201\016%\224\325\221j9u\0255Uue%\345$u\005\205C\307S\325\362j\251\354\341\250\023\034Lm@\265\214b\242\232\202R2EUY1\235\020\342\245\016\251*\246\253\345\262\212\311\350\246\325\351\375#\334P\272\b\007\304\236!T\353\231\254\342\371\267~\207\006X\177X\200\200m\255$h\367\366\027'\030\345\2654H\347\310Z\255\317\302\352!\005s@\364/\026\031,\037\260~\300\372amU\305w\224v\242A\255\260\013Z\234\020\027\217\300\377\034\327a\267\245A\343\342\273\255\375L\220#&\316\030Z\t\273+\\\372\353d\031'l\317\314$?\203\260\273'l0\234\031\213\020\313\220D\340\225=\346g\225\370g\017]Fi$h\027VGB5\302\n\302} \343\201Xi\260\242mV\326\332\252\321g\020Fg8\342\237\254\\yP\212"
+	.string	"\264!L.m\320\314)\266'\342\237\354E\177\343\rp\313\3170=\214\237\203iwp\265<x\254\255\026\215\360\342\242\364O\266\021&\351EM\021\274(f>\220\002\350\004\210\236O\251\364\345\257{\3228\005\233\236\347\211\276y\350\2323}f\321\246\231\004\276\211\006\023"
+	.ascii	"\234\346\273u\350_<{s\360\200\271K\227\364O\036\001\327\205\356"
+	.ascii	"\250E\215\237\023@\256\272$\213O\372\036&z\350\033\260\375+\310"
+	.ascii	"\230$o}\200I"
+	.ascii	"?\364;ofH\377l\345\312\342[\374N\237\331_S\214\351\321%\350\025"
+	.ascii	"3G\377d\241&A/\364\335\204\262\370\240/\3523\303\343:\004z\026"
+	.ascii	"; =\373@\337\001\201\245\250\201,\203\231BC#\"\"I\222\024:\221"
+	.ascii	"\005\304\030&\245*n\021 \245SL\325\214\214$\005\311\036k\036"
+	.ascii	"\350\334\306\321X.\002\377\374\225\237$\307\327F\n\347\261\252"
+	.ascii	"\216\365\271\353/\035F\322I\r\254P\b\343U\264d\343\200\022}x"
+	.ascii	"\267\252\226hz\303\b\017\315\307\353\224\032\274 \2147\244\367"
+	.ascii	"\032\266\034m\b\235\347\215v\361l\365gV@K\224\330u\017\235\013"
+	.ascii	"\352ch\261\360>\265\027\027\207\275\247\240\232g\201\227\334"
+	.ascii	"\345\354@\217\330\203\377e\355\246\017\303\256\037\001M\263 "
+	.ascii	"5\274\222\376\033\343\231\007\023\nxC5\261\213 gqsV\313\320_"
+	.ascii	"R\355L3H\030\245\335\270\342rP\037R\250n\256\242\300\217\374"
+	.ascii	"\363S\242jJgd\266\b\314#\317g\326\345\n\203\355g\367\346\004"
+	.ascii	"\275\357\232%\201]q6\311\033\0371\266b\3418[\330\266\301n\341"
+	.ascii	"i\373\2647(\227\217\t\277E\273I\363O\363\336\212\237m\031\272"
+	.ascii	"\221Od\264\3118\023]m\002\261\352Sh_^\035`\245\375Q\021a\346"
+	.ascii	"\004\330\311\276\344G"
+	.string	"\247\202}\221)\037\203\373\002\243\035N\271\315\3759$x\022\005\312g\361\225\237\036\311\366\003\006><\272\200\022G\333\033\230\266\310\371$8\020\277\257f\321\230\322a\001\346m\340\367o\342\343\036\305\206\243U\302x;\364\227\033\343.&F0\222\1770\3721\323V\210\235\220\230\224h\233D\303\2424\250oK\357l$\n\374\262\036Jsb\336\224\236\331\223X \r\312\334\276@\212{\313\005b-\246t\372\017\200E\213\37098E\302\347&18\332\376m\334S\275n\031B\224M\217\r\232\312r\004:b\235O+u>\360\264\216\020\203Zs\004\360\353\305\017\326+\253<\371!'Jk! H\033x\220b`\314\004<4\206\357!\257\340\342j\310\241AXP\300\266T8]_\255B\021\356\316\234\363\036u\001\025\312\341\371\237;\352\022\037\256\351\026\325\024\224\331\347\236\277\250\t\250PV\342\237{\376\242\226"
+	.ascii	"\271\322h\"R\351\342\227>_}v\020\365\3209L$c\017\203\224F\211"
+	.ascii	"\334P\240+=\001\265\2716=\330\241`\244j\005K\315W\325&z\257\305"
+	.ascii	"PF\003\262\265n\364\016\306\366\326\205j\333\2469\264\325\333"
+	.ascii	"(\227)CG]\334f\1773\013\371K\013i\306g\314\244Adl\246\274 \201"
+	.ascii	"x\325\347w}\037\337\037w\335]\362\232\006\234\373\322\243\256"
+	.ascii	"K8q\315\233>\016O\301\230?\356\331p`\345\301T\323\035\356\177"
+	.ascii	"\337\005\241\031\034\\\"\"\267\207`\372Z\003\314\271\371!\264"
+	.ascii	"N*nl\233\241\212L\336_Ih\203\250\301# \323x\367\265\336\211\016"
+	.ascii	"\213\212\310\350z\006\303\3353;\260|A\r5\300\2377\207\234l\216"
+	.ascii	"\366\363\332\321>\267\334-\237\230\315]\253\242\240%\207\355"
+	.ascii	"|Q{T\226\343\355\360\376"
+	.text
+	.section	.gnu.lto_readEEPROM.170.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\025\f"
+	.string	"&VQB0m\2341\300U\253\327\335\351'\177"
+	.string	"\207\366\356b\224\363\024\364?\324\370E>F;\367\257\301}\177c[\216&\367\332\342\247\023\266\030\021\205"
+	.string	"\t\016\205\002\036\"\213\207\023 \201#\021\321h\023)S\n?"
+	.string	";"
+	.string	"@"
+	.string	"\333\3110\243s-\bk`a\004\351\361\313\035\025\277\f\022\302q\370\033\001tA*!\330\200\302\332\313U\b\017OC\377\345G\304\3624\206:\247\022\021k\255\351\030\022\335\365\2667l\177\330\377\004\017\354[\266:\260+\265V\251\263\223\267e1!\221!\204\006R\205\212\272\026t\246\260\346\365a\302\311\337\276\217\341\327\336\274\371\005k\013D\224\254\265\333/{co\277ns\374\322\001\376\351\034*\276\004w\036\375\370\313\367\260_Y\375\275\006\bTiT*\360\320\323\222\340\362\211L\001\034%N3\243\366W\200~\264*\206I\345\001\243\266\346"
+	.string	"\375hjR1X\245\304\332\261\257Hk \350u\235\006\224\270\243X.\0010_\307a.\225\001\\\227\0019\312\304\037\001/\303\031\370\276\f\267]\317m\253\3364A\301\364T\021\300\313k\246\225\271Ji\265\303\307\023\177\005\313\252V\377\031\211\364t\030"
+	.ascii	"\252\244\223i\021\206\265MP8\241F\237\203Y\004+S\212]ee\0334"
+	.ascii	"\001\370@1\232\327\001\022J\035\201\323\3267\207pM\244b&DE\321"
+	.ascii	"\037*x\270s\246v>\001"
+	.text
+	.section	.gnu.lto_writeUnmodifiedConfigToEEPROM.171.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"]\013"
+	.string	"\226\323H<0\345\2521\200\360?\034\275HN\006e`\210^7c\267\367\233\031\032%\003\372k\300^:\263\373\367\177\300\245\311\346P\264\235>\252<\f\030)\374W!\241\302%\333\033h\022I\231R3"
+	.string	"9"
+	.string	";"
+	.string	"\367\336\360\326>\331\341\355C\243l\230\237\032\267"
+	.ascii	"\266B!Rs\357\025k\306Q\247(\377\262\203\346*u*\220p\35755W\027"
+	.ascii	"w\275m\003\333\b\366Y\001v\204\004\275ij\003\200\262\313\225"
+	.ascii	"5e\237%\255\030\366\003n}\331\224zC\251A\002\016M\371\022\002"
+	.ascii	"c\251\270\363V\364\002\334\233U\341\260}\237\366\332\3513+\264"
+	.ascii	"x\270f\001'\236\361\363\371n\301\372\332\017\\p1\027\215u\222"
+	.ascii	"\227\200\026Z3\241\016\217\3104\360,v\271_\364\371\037\007\021"
+	.ascii	"\371\033&I\364\346\255O\372n!Z\272\230NE{&\262v\2634\036;\240"
+	.ascii	"\020\303\210\034\305Q\310#\022\307\222I\354pL:|J\342\003I\226"
+	.ascii	"\304\360T\275\276|\331\007l\274\333.\247\252\24575\345f\314="
+	.ascii	"\037X7\365\023\256\222\366\354\233<  \340\202\231\272m\n\351"
+	.ascii	"\244Z\334\2213 \326\340*\361\2205\233\205E\326\227t\347u\004"
+	.ascii	"3\334-\220;\230Y\252\013\330\355-X\\\246$\303\333\267]\272\214"
+	.ascii	"w\241\031\206\247\260(\b\f|\270\002\226n\321\262'"
+	.text
+	.section	.gnu.lto_writeEEPROM.172.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\035\007"
+	.string	"\342M24@o\323\001[\224]\037\260l\240\354\263!\244\320>\325-\245\334L\376\254Ml\333\231\0316\023\354\3321z\031\206\307H\216\346\037\033\337\321\335\371\372\326\266L)\2454\016\233\006NEE\316f\341!RV'j\bZA0XQ\242\252\254\230\3410K\207!\214\312\326a0+&\333\210NZ\353A\312\327e\020\324\264\347\322N\230\304S \372\237P\217xDQ{xj\305'\255y\252?\027O\036i\264x+X~-\227%\344h-\375\177a\250\225\0046.6\223\230\374\030\037\313\273\351\344\243\2553\275Z\024s\242\017\204x\026%\336\377\b;|9\257\332\"\016\3206\220\023@\341\177S\3332\\\350\266\006m\021\332\202\004\b"
+	.ascii	"\252\244\2331m{Cha\332\261\013&/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resetEEPROM.173.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\335\013"
+	.string	"\326\025QC kL:HMX\300\004\024\264\224\002\".m[An\231\301Y\322\233\007\324\235\372g\200\242\022\373\361\210\202\314>\023##\373(\n\220"
+	.string	"D\\\37736G\353\210TX\217\203z\265\267Q#d\357\224\002="
+	.string	"="
+	.string	"<"
+	.string	"\344\304o6\027\206\3353\303\030\223{\266m\321\030\231\374\251\300$\3212\005H\340\260{~5\301\311S\322\377\353]\203\224\005Zmv\"\235J8v\327\324<\025\270\353m_\330\336\260\177\t\036u\347QWI\305\205\222\026\2415\240\326\3165\345:\254\006\257\002\003\333\367\037<&:\004{\006V*\327\356\376<,t\007\266\244(\260v7dSD6\345\336\355\221M\261M\351]\001?\030\251\265\253\017\240*i\316\376\204\313@\177\201?Bz3\214\334\253\365\261[l\250\261T\257\003%\232\363\204\3720"
+	.string	"#\275\351\303~\311\2608[YI\366Y\322\212\300~\267ue\007\343\007\004\204\331h<B\3613\202:4#(\302\231\n\007\334t\304\314\327\0011\341\227\361\214_\205\302b\210\306\363}D\321\363\371,\275\333\272\362\311\b\204\f\305\302\331J\2654\347\365\007\031\212@Wg7o\001\024"
+	.ascii	"\251\322\215\254\025\254\265q4KjX\274\306(j\030\004\001S\212"
+	.ascii	"\235Y-;`\254vM\f\321B\017!hK\310:\307\257\034\341\224\005\341"
+	.ascii	"\3316L\230z"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.174.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\335\007"
+	.string	"\022\01646@\217\322\001\360~\360\266\263\336\371\376\035\035\2439\002\323!aJ\204\305c\337\270\362[\310\315\210)\301g\316\210\215\242\350F\026p[\217\300\3447\301\377\255m)S\n\2668\f\236\205\317e\301\217\007\241\001Z\030\br\006|9(`\360\341\2720\270\341D\357\210T{\231\264A\020\371\315\372\325Fg\242\236\300\\\023DTF\271\362K;B\"\277]\177\372+J2V\305\242i\310\346\264T\016\373o\325d?}\f\226*Y\304\237t\273\245\256eQ\027\024\020\333\3378\263W\316y\254@\310\007\211$\265\273P;\236\375if>@\f\375i0\256\217\300\244\241\n\210\332+HA\221~zR\304Qf\246\263\273\316-^\334\227\333>\260m`{$\020"
+	.ascii	"\252\244\223i\021\206\363\020\266j\240+\354\005\252y\340\245"
+	.ascii	"u\357\267\260\236\013\371^\260\3762\256\270tM5M\003SP"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.175.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\245\t"
+	.string	"\306\021B< \005)\035 a`\363PI\021\013J\r\306\030\022\216\035$\003<f\031,\340\177`1\263\365\033\222\342\037#\373\256\r\021\001\t\020\240^r3d\213\305w\033+\210\372\273\377\226)\005-"
+	.string	"0"
+	.string	"2"
+	.string	"){\373\374f\225}\363\020\266\007,\240GLmw9\211r\325U\345?v\201\317\265\272~ v\327\372\271@ny\333\n\266\031\354\203\002jop\350?/\314B\304\226\\\331aK\345\211\375\316\312\227\375)X\231q]f\334\375\030\003\2548iTl\337o9\230\272\314\003$6\333\247\035\021\"a-\207@}pt\2013\352=\317A\223\016\343%\300v\367\301w\371K\206\237\362\351\023J\377}\372(\317\347\3017"
+	.string	"\250\241\231\310h,\035\335\t\356B\026\243\212\222\327q\245\021\005\211\353L'.\204`\017Cd\3424<\317\304m!\353\362\345\200Y\211\310\222-\203\324\341\266\304\304iD\354\220+\033\250\335\211\036{\020"
+	.ascii	"\252\244\223\261X\364f\304\305B3\276\316\3406\303\300a\323\204"
+	.ascii	"v\\\030\327\203\345\240l;e\371\322.8\347\026\302|\002"
+	.text
+	.section	.gnu.lto_setConfigDirty.176.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"=\t"
+	.string	"\226\320=:0\345(\035"
+	.string	"\276\315\256i\3415e\223\r*\345K\331\257\367\201*\t\001\241\t\226\"LcC\177Qt7\332\250n\fS\220\005\005P*\270\227\bd(a\2201\310&r\247\024+"
+	.string	","
+	.string	"."
+	.string	"\217\327,\262]\377@\266\240\224\202\261\232\331]\251\037\027\035\212\374\233>\320\221,\016\003\026v\327\260#i\334z\333\b\266\025\354\023\004\366\261\325\016\033Bc\020Z\263\003\027\327\242*\251h\353\333\214W\200]\211(\"\266\357\243\236\n\375d\006\326\213w\332]\355\321\016\331ZW}5'<\236\354Q\365\251'\260\264H<\324\306\377\311\374\357%\037?\304\025 \370\356\321\007e\217q\204\345\342\235dF\360e\177\034T\217\3364\020\233\007\316\334$g\323\020!\267\216Gj\f<%\034:\222b\316\216\324\276\321M\0270\341\370"
+	.string	"\300\214\2243\246'\357bf\246\212\351/<.\022"
+	.ascii	"\252\244\223i\021\206E\026\226\317\204\202\340*\305G\326AP\b"
+	.ascii	"\r\002\346T\256$e\213kb\n&4B\005~\271\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_isConfigDirty.177.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3PO\222\016 ;\263\3265\244$\245fc\341^\2064^5V\364\271\254\265[kh\334\374y\2723\0313\263\35048l7\336\264K\260ejho\231\002K\230\210\f\204f\222\232&\343 \321$\212\242a\f\236&\036\250V1MT\273`Y\f\035\036x\360\363\035)Iu=\266\330\\\255Fw\023\320\350p@\303s\331c\235\303\215/@b\350\277\017\tB<\256\236d\231\240\254%W\242\224\217\237\363\227\025\0268W\305:@\005 *\027%,\231XC\216V\275\352V\244\r\037\024\023\353\352\364\004\0302\363\263\256\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_setConfigChanged.178.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\025\007"
+	.string	"\022M/3`m\322\001\300\376\373Y\255\257@\262\247kl\027\247\273\201\272\263\3003\331e\326\272\216\021\002\373\251\212uL\001"
+	.string	"!;\260A8-\353\342kK6\2212\245\266*\206\313\002\346Y\016sIhp\326\365\340*\002?\007\205\313A\274w9*\356\245U\217\001PHB\034\3558\025\344\360\344\317L\327\324K`t\356\361\217\214\317\341\bM\036\276\371\232\351\355\212p\221\362\261\340\344\310\216\233\324\f\373\322\252\307~:\237~\023"
+	.string	"\211\262\213\230\354R\214V6\324F:l\2372f\227<n\354\300G4\021\242\262\273N5\216=1\377\240\007\300l\363\264\034\354\256\023f\025\267\336v\201m\003\3331\r"
+	.ascii	"\252\244\2231M|\206q\346\300bJ\261\243\312(\213\262\3045Qc\b"
+	.ascii	"\344e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_getConfigChangeCount.179.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \366\265\006"
+	.string	"\222\214.4Pm\222\016\244\204\252J\304\342wTz\371U,\311\205\355\005\035m\312\313\332\337\355\360Z\301T|i\024\242\252\222 j\340^8\225\023o\033|t\263d\313\024S\231\007\215\303\246\242\336F\303"
+	.string	"\361(K\342e\n\256\"\032\2547QU\326\273lY\007B\207\301\334\347\033\352v]\217)8\330\254\322\345L\225\320\005h`8\372\315\203\216\343kI\007\372qt\002\241\013\255\"\223L\214\321J\242H%\037\177\347/7\244\"\235\257\205\nL;"
+	.string	"Q\261 I\311\334\036\246\004S%K\007\246J\256\243W\361\272\035\251\302Gt\222i\236\"@Bf\216\231\226\321]\177\203\037\341\337\b\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\275\0219\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.180.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\203\004U "
+	.string	"v\374\324H\220\332Q\007"
+	.string	"\312\270\360"
+	.string	"\r\247\206\360h\022\362\256\217\024\217\347=\360P\267\203\274D\236\232\325\027\227\017\223\340\270\244\207X\250\370\271\376\331R\320\254\023\300<E\352h\251\276\374 \240\240)\033\316J\333\366\336[\312\224R\n\305"
+	.string	"\257"
+	.string	"\303"
+	.string	"m\231\331\235\271\301\003\244\346R\301\177\357T\231\222{\217\f8\301\331\226\221\230\277\3641\307\325i!\205E\316\334{w\217\203k\216\324\270\233\255\206\236fi\353;\022w\215\230\3248\033Q\305\276U\036-4N\372lX\254;_M;\032kX\303mgC\032\235\266C\021\233\274f\340F\324\214F\013\334{e\370\331J2\332\254<fTi9\242\260\356L\225\301h\254\241\224\227UB\020 :rD\247\372^`O\032kH\303\355o\313\205\030\033Q3\272\326\004Se0rD\246\212cF\225\326_\033\034!\212\345\210K\025\367\343\013V\247m"
+	.string	"kXt7'\334{\331\237\210Q\315\271ff3\314\fd\256"
+	.string	"\002\367\207;,\305\210\323\312D\331\326\037\355\352\257\0063\301m\305DA\357\247\266\334\301\262m\177\247]\307\024\211hI)y\222\371\270\344o\344r\321\210\374U\314:w\326\311i\256n\234\033\233>6\327\264Ws\316t\306\231\3167w\266Y\347\232;\243\356|\272\263\351\316e\351l\335\271\272\363[g\257\316\275\223C\263\"v\222\344\275/\222i\256\025;\346\243\217\335^\355\314\315(\232\bG(\202\331\272\207t\3126\257\2363[,\302\334{\254p\266\345\356j!H}d\262\276Q\267W`\331j\021\346\336\253\240-;8\333\026h\234\262m\355"
+	.ascii	"e=e\356o\037 \215\222D3\224\265\3672\275\265\345#\351|#w;\232"
+	.ascii	"\020$1\314\257b\005m\363\366*\rLZ\366a\305*\262\322\366\365\215"
+	.ascii	"jok\222\0015K\343\232\342\352\"\314\277f\242\301\tPmI{p\335{"
+	.ascii	"!,\351\261\r\034:x(\333\326\036\201\216\256\334\243oRAI\n\221"
+	.ascii	"\177\005\315+\314\236\237\363M\206A\233\177\276n\212\323\330"
+	.ascii	"\202.\337|\223\214\323\324\222'\331~\371\241\223\2008\357e\372"
+	.ascii	"\341F\322b@\314\353y?\365\312\266\366\033H\361K\253\353\347L"
+	.ascii	"\212U}#\373J\377\333\215\036C\032\215\374\033\271\376\177\210"
+	.ascii	"\224\013\223\243a\234\257_f\021\"\375\377[\210d\241>\342;\357"
+	.ascii	"\r<\344#\302W\264;\032\022\362\375\202tE\267\023=\021\300\n\275"
+	.ascii	"\237/(h\204A\b\350\033\342\035\001\021\t8\002\226\bR\370\375"
+	.ascii	"z<\224y>B\276 `\220\267\003\372\200\210v<#\022;\237\001\034,"
+	.ascii	"\352\031\355\216\202A\243\235\355\250\324_\305<A\351\227\206"
+	.ascii	"\270\035\327yf\013\027\274\237n\214\224yb\205\351\223\270\223"
+	.ascii	"\315d\345\315\353\274)\265\344\311\234\262\246%\267\232\315\363"
+	.ascii	"\b\263\\X\364o\036\352\346@\222\027\036i\025&G\303\303V\321\232"
+	.ascii	"\277\201]Q\251>m\363P:\302,$\252\373\032\341\225X\315\371\334"
+	.ascii	"C\345\036\367\255%\355b\037\3679)\0243\365\246\335Fa\226\330"
+	.ascii	"\211>W\323\346k\036\212\371\273\247\274\275\356\235\214\323X"
+	.ascii	"wO\250Q\024\007!\346\214BFF\242\021\222\331\346P\0021\nZy\020"
+	.ascii	"pg\223\346\313\244 \204L\245Q\3344\333\323!\230%\242\267:LI\304"
+	.ascii	"1\351wmR&@\220\353\370\252p\236\360\340\203\241\231\262\001`"
+	.ascii	"\216Y\211\376XcF\216\236r\020\303\314\033#\006\340\007\016\330"
+	.ascii	"`{\005\301\334@\020\200\005C\301\232\026\275_\2751\002\032\001"
+	.ascii	"\250!\270O(\271\205\233^\374?_\001\n\200\243\226@*\035\037-,"
+	.ascii	" \035\222\245\b\261p\300\367\365\216\020\245\244\377\230\024"
+	.ascii	"*\013\030n\020S\313n0\321\341\244s\021\033\030a\013\365\267 "
+	.ascii	"\321~\270\225\2465\361\221\352\375\001"
+	.text
+	.section	.gnu.lto_changePidProfile.181.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`d\002\275\024"
+	.string	"\346\245\207J\260PR:\342\377\310\371!|\323s\024G\241\254\304\217*#{\232\013/\207\215\310)\201m\031\3633\004\202Y\353\353'\204\254\304\335Oy\002\301-k\313\371C\252o\315B>%\204\007-\307f=(g\265\023-!d\313\224\002m"
+	.string	"n"
+	.string	"y"
+	.string	"v\315\217\\\322#\303D\255\265\306\266\261c\0377f{\327.A\220\273\321\215i\255>H\303Z\203#\026\351\370\350\234m\365\340\257~\234 \302Q\272Qk-\251\320s\027\351\346|\340C\244\274N\237\356\342\227\036\342\344u\372vNE\221+(-\231\257'\006\310)q\036\370\365\340\343\355\302\030\324Z\275\247O\347\036o\033\305\366\004{\213\002\303\236\030\\<\273\375\372\257\353jHi\320\376\206$)\325\325\310\022N\365\266\313\261\2655\300\354O\037\320\262A\305\243:;\310[\032d_\254\024\310\356X\317v-\203\255=`k\330\215~r\327K\256\017@\226E\303w\030L\265\346|\341\250T#\013\"\333\367\225\276D\363#S\237\325\220il\244\013m\216\302\013B"
+	.ascii	"\371\030\325Z\037|R\242\024\317V\321"
+	.string	"\210\335~9\330\001Y\033\002J\215\316\307\316\250-\201\302\201\377\007\246\242\312u\325\243:\317\250\337\342Q\246?\344\n))I/\200\025%\254j\302\272\360P\246\270\342wf\370\320\2028C\201\323\237.`PQ!?\316\350\205\037A\374T=\t5\211\220\321'\335\200N\224\260\212)\007I\355\225\253\270\021\360\253\265&\360\233\236\202\346\017}t\315\266?m\344\307\007v!a\271\311\2243.\266\333K\313\007\207\032K\314\203\332\313\255\305\304E`\271\311\314L#\261\335ZbLZ\031s[\201)i\270\r%\t\210M\231\032\256\2341M\\\031\013\356.V\n\324\261E\202jGy&\260K\355\0340\2074\240Gu>]:\202\223\343\364\300\247\374Hm\211\366\240S?oB\302\250\007}\007\037\336~\331w\361\027&\rN\366\347\t\371\021F\277\3642 P\002A\214\225\035\236\fSJ7\232\226\230a\233\355"
+	.ascii	"\301\242\200\262\3528\331i\353 \004\303\323zU8\266\361\260\263"
+	.ascii	"\241e\022\301W\232K\275b4,\220\346\270\261<\277\222\357Y\274"
+	.ascii	"\f\333e$\\\370\274\302\260\3101\3364\257\372\244\251\341\314"
+	.ascii	"\024\337\356x\371h\317C\316\0371H\264|\240\310\376\306@K\235"
+	.ascii	"\025\271y\033\233D\252\304ea\313C\354\233\332\003\005"
+	.text
+	.section	.gnu.lto_isSystemConfigured.182.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\262\r25`m\322\001\310\017\340\374,\311\004\033N\037*\222\\)\201@i\217\266\302\200|t\354\320\b\376OU\254cl"
+	.string	"\b\351\177*\002;#\"\334B7\262\211\224)\005\2560\020\231\007M\254\240&\323\020\001+\353\202\230\001G\t\007\013R\304h\301K\227}Z\375\250\026d\2529\177QW\325\267\322\031i\236x\310\005\260\213\241\340\203\\T\341\177\374\331b\223\337\376\374\r\365w%\360\020eY\262;-u\303\376\264\372\261\235\326L\177\n@\311\340N\032\331\365\224T\326\344\215@\2669\366\305\b\t\034c\357:<\002!\222\216H\312n\007\225\343\330\023\363\037:\303\t\251d\343.\236\226\205\335un\234\306\255\267m`\373\3006(\n"
+	.ascii	"\252\244\2231={\303\024\306\330\241\262\30551e\004YB\344p\347"
+	.ascii	"L\355|\002"
+	.text
+	.section	.gnu.lto_setRebootRequired.183.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\035\007"
+	.string	"2M15Po\322\001\240\243\216cg\023\004\301\004\003HgJ\243\026\315\363*t\342\353\370\226\240|\263\007E\304\b\365\b\312\314\214\253\302\376T\242\006C\024\031!\233l\231R\276,\205K\002F^\021s9X\210\027\226\211\326\200%\003\002\026\033\244\304b\305\355\245}\037"
+	.string	"\225\221Q\347A\230\322g&\333A\243\237V\020\021\005\013J\304\323\374o&_\364\216\215\277\341\007\216~\036\372\234\351\020z\234\\Xp\244t\264\2639M\037\206}i\337\307\2264\"\236\211\355$\335\256\247k\331\021\f\001\331~\345\31469\247\261\002\241\022\211\217\225\335\215/\343\3315\363\037z\300\334\264+e\260\273\326\271U\334\357\266\tl\027\330\006\005\n"
+	.ascii	"\252\244\233i:\3070\342\333w\307,\350B>\027\354x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_getRebootRequired.184.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3Pm\222\016\2602b>\305\346\031\215Q\rJC\020F\321j\264[)\254\331\277\333\341\265\202\251\370\322(DUY\020\261\362vA\210\005\203\243\306-\356-SO\226\210\013\004\206\232\032\346\342 \321\246\212\242Y\f\246&\036\252VAQU\253dY\374\034\036p\260\363\005i\210u=\266\310\\\257J7\023P\351p@\203s\243\3176\207\033_\200\304\317\177\037\022\240\210\260\206J2=\243\224$\221F>~\315WVX\320l5\353\360\024\200D\027\"'\231YC\216Z=\353\026\324\206N\310\344\3026=\001\206\314\374.,\243c\177\204?\341\307\b\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_CSWTCH.82.296.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.347.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\265\013"
+	.string	"\346\023IA\020\251L:"
+	.string	"'\005\216\030\033\2548Z\336\320\371\357\243\003\377\377VBP\002\312\217A%\213\030\264C\322n\243\021\321\354\253\211\323\321k\004"
+	.string	"\n"
+	.string	""
+	.string	"\027"
+	.string	"J\215\242"
+	.string	"*\t,\301\321\320&r\247\0245"
+	.string	"8"
+	.string	"6"
+	.ascii	"*\227\354\007\227\211,\303\213$E\303\355\256\367\251!/]eW\362"
+	.ascii	"e\2702]?\2763a%hp\263\2556.\027\336U4\273k\013\307=o\033\302"
+	.ascii	"\366\203\375T\257t/\230\202\270\253\221\233\260 \023A\211/\340"
+	.ascii	"\265\321i\236\036-\331g\266\350\004\254+\0078\021\266\273\037"
+	.ascii	"\360\321\016=\200/\254\005!\321\350~\214dc0\237\007`\233\024"
+	.ascii	"2g\337\300m\237?\342\212\216|\330\241|^_\273\003\203\333\211"
+	.ascii	"\030\3738\311\234-\322\237]\200\344C\177\366\b\005+\001\002J"
+	.ascii	"MR]\326\356\335j\313\236\322rJ\007\336d8\037\205\007\334x\236"
+	.ascii	"O\242\343m> /\323`\320b\342\343a\200\340\307\303\330\226\357"
+	.ascii	"V[\326\234\024\245\352\262G\316\370K\201\016\225\324\003\017"
+	.ascii	"#\374\037\345*\365\031\"*\" `\202QR\231\007U\310\267\231\206"
+	.ascii	"Q\323\217=m\201W\214\242b\020\001Scg\236e\031du\344q\2041\006"
+	.ascii	"X\302\361\017}\026\214\263\032\305~\261\"5\333b\320v\313\261"
+	.ascii	"\325\211\221\360\362\r\325\226\231\267b\001\250=\005\026\206"
+	.ascii	"\246\236\360\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`H\013\275!"
+	.string	"\346v\277Cp\236J\032\003@S\013N\004\210\301\013\3329\027b\020\254\340=G\374#\220\226X.\372\342H6\003\3413L\371\032\236V\377\201\222\265\201\222\335\312\017\b\3427\363t\237M\333M7wm\016\252\331M\322\016\255"
+	.string	"\244"
+	.string	"\260"
+	.string	"{\223\253\375\f\306n\366b/\013\255v&\341\030\f\222mU\033\352\205\325\305Y-v2\252},d\361\232\025\357M\215F\3524\020\326\2130\231\250\325\250x\214\204\305\2448\016j->\024\2071p\346\226\346\304.\026\232\330\255\304W|\224D(6b)>\021[\361=\355KB\254\303i\007;\272\315\327\264\177\201\330\275B\246\375HX\307\245\267\302\340\030\345\303n$\3640\035\243\313t\230\313\307a,\22316\f\004h\034\307Q\303^\206\0316\243"
+	.string	"\303g|\224\322\337\030\f\216m\224.\245s[\023 \243\313\273\260\207\205\224R\001J\001d;\334\330.\267d\337\"\266sQ\262w\t\333\347\222\354u\345N\007\266\333}\355_\274v<$\273\227#\373\235\221=\257\310\016\206\310>e\310NE\310\036%\310^\005\310~v\355l~\354m|\354nz\354ox\354pv\354q\270v9\217\343Hi\202?o\355s\326\232\207\216wd\355#\307]\3438\210\217R\027QSR#\236n<\304G\351\322\324R\323\224\223\224S\224\207\247\024\016\350$\3266.\342\253\261\263Mc-\337\214\035\n\326\376\204\302\031\345pM\356Nd\354k\301]-\306\236\366\270\243mB\362\350\027\261R\225\003\377\230\235\323;Yq,\312\303;\275\267S\312N\254P%\n\363\274\023k\211 \221XC\234\003\361A\2633D\036\266\251\263F\275\210u"
+	.string	"9\020\024-\223\342\211U\310\314\023\253P9"
+	.ascii	",6/\nF\254A'\r#V(\022\216\250\"8'\240ev\203\306\021\325\003\345"
+	.ascii	"\024\217\n\233\030\225#\252@\252e\250\n\235\023j\0252)\324\032"
+	.ascii	"TV\2505\210\274R\353\357t\253\365gb\251\365W\276\325\372i\326"
+	.ascii	"\272\231\245\326\313\201F\270Z\327\366=N\366<j\273\236\264\375"
+	.ascii	"\016\332\216\247\311n\347l\257c\266\277\225\355&\223=Kt\017B"
+	.ascii	"\035\n^\240\f\226]\322\203\032t&\325_\231&\251\376H5I\365\363"
+	.ascii	"\305\374\334\251\243oII\3653H@\244\312\204\204\006\2512\275\037"
+	.ascii	"\257?qFGf\216\352_\r\032T\013\f\214\352_EFu\263\250N\226)\252"
+	.ascii	"JEuAQ\375\211\001\326"
+	.string	"\277*\260\036\024\201\265i\f\260*\221\001\352\001\353{\347\001\366\274AC\267\210\365*&\027\261\256f\246\355\231rb=\215<\315\362\214<\315\322\214<M\262\362\261\362\237\324\351*SbN\373\354\321\212\243sb=\214\354b\322\211u\260:\261\376U\356y^\225W\244\225iU\236Uf\025Iu. \200\274\2501 FEE\"R\220$\251t\360\002!\"N\007\021\200$&\215RH \221\004\022HI \017b~\375\377X\376\274\027\301\247&e\354\f&\001\262\232\026#a=\222I\321\034p\007\177sA\366\312\340\022(_\277\0278\201\217\020\254H\321\362.\224\"{\030\"\2415\021\335\235Ih\213\b\353\335J\037L4m\240D\236\\\355?\234gD\021\231C\002\0335\247\345\212\224\247\230u\2211\320Q\227P&\f#\025\324\307\200\013\013\\\231\254\361\211\034y\bX\302\311\277dN\233\037\264\377\213"
+	.ascii	"\353\266\206VS\253U\251y\026\376\020\200x\334\264\244%Q\323\222"
+	.ascii	"\226DMKZ\0225-iI\324\264\244%Q\323R\nt\272Xz\261$X\304 \270}"
+	.ascii	"\n\361\036\2262\032K\025DY\212\302\257\270\356\001\261\332\301"
+	.ascii	"\034\357t\277k\205\322\350TV1S\203\335\031\347E\305\025\377\030"
+	.ascii	"\222\325\t\351\030\345B\302YD8\217\204\317\313\244\214\253(\331"
+	.ascii	"\374\016U\355\254\256\345:\004\242t\214r\230&\261\227mF\021["
+	.ascii	"d,\024\333$\223{\351\344\005\3032\335\224ap\001\254\002"
+	.text
+	.section	.gnu.lto_.refs.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\032\002\005\020"
+	.string	"\246\350m@"
+	.string	"\355$\351VUU\363\022\365\210w0\007\375\017\300\242\003\307p.\272\350.\275s\273\006\374\377\377\377\377\377\377\177\351\364\227O>\324D\203\016Z\333\017\373n\233q\002\321\304\366\306lk\273\265-SR"
+	.string	"\\"
+	.string	"b"
+	.ascii	"\223^\307x\177\361\376\275\356\336W\274>z/z\035{?\361\372\365"
+	.ascii	"\336z\275zO\275\336\267\005\312\225\353\350\256\300\333\036\211"
+	.ascii	"J\321\213=\321]\350[\350E\027\036\262\276\262:\225x\253\251\353"
+	.ascii	"\254\035\243\377\360-\332G}\n|\254\335\352W\370\330\307\236\""
+	.ascii	"\005?\222=$\037$\273)\277\324\361\027\035o\301\201Wp\340-\353"
+	.ascii	"\242\215\307J?\221\365\253\364Y\372fk\254\363\"B$>\210\017A@"
+	.ascii	"U\237C\365\377\220\372\032H\277OF\237B\373\234\214\307i\275\246"
+	.ascii	"\275L\373\227\206\263\264O\301\370\221\366\246\213\377x\275\343"
+	.ascii	"=\307\373\215\327\263\367\032\357\205\360\300\343\353\240\301"
+	.ascii	"\251\227\301\002\005\tN_\004\r\357\001\003\005@\276\004\262\277"
+	.ascii	"\304\251O\342\364\217\270@x\270\376 \240\016&\374\037\323\277"
+	.ascii	"\341\003\337\347\343\317\200\241\207\247\365wt\332_!=>';N\376"
+	.ascii	"M\276Mv\232\374\231\3541\3710\331]\362[\362Y\262\257\344\253"
+	.ascii	"\344\247d?\3117\311N\222\001\327\340\r\016@\033j\006\005`\205"
+	.ascii	"4\324\2259@\257Lc`\372(\377\252\276\326/\324\"\3271\367\226\325"
+	.ascii	"3q\252\252K\266t\312\365\272Y\360\226\f\340\226t\205\032\253"
+	.ascii	"\252\240\364\244&8\346z\310\375U\322\023\353\024V\222<\344\272"
+	.ascii	"\345\036\301\333\303#\322\273sA\344k!\244wB\310WB\004\217\036"
+	.ascii	"  \240\"f\013s\026U\3366\254c\361\231bn2\270\272\210\310\200"
+	.ascii	"\bp@X\300\340\200BHq\257p\301\300C\300\205\r\206\002\032b\r\226"
+	.ascii	"\342 X\013\210\215\215\350\221\220\016G\035'X\251\006\312_\243"
+	.ascii	"\216e\243"
+	.text
+	.section	.gnu.lto_.decls.f523afe6fc476f2d,"e",@progbits
+	.string	"(\265/\375`\310\321\245F\003\356\034\305-\022U \niG\215\001\204z*1\021\004\313P\240DbX<R\222\034\314\344V\227\002\345\312u\"\362\324\302Do\345E\321\023w\344b\301\320\202\266I\227dY\226\305\304\243\231\375"
+	.ascii	"\345m\253\272\323\030\022\237\305\230K\324Q\310\017\361\240\307"
+	.ascii	"\326\214\020\271\233\262I\231\002T\020\233\022\325\022iQ\276"
+	.ascii	"\223r/\277w\003\020\214\r\007T\326;\256]"
+	.string	"\327\177\236\260\211\016 \035Y\377\273\256\035\024\336\236,W_Y?\361M\001\003\223#\353o@\263\377\343\346\316\311n\311|\211~2\220\220\221\222\3657\204\331\217\273\227\377<\034\005\215\312\226\254\277al\307\344\337U\355l\354\226d\335\022\033nj\262V\022dV\251\331\223\3657,7\2177\247\331\016;\377nkGd7dgd\207d'dWd\227d\227\265\323\302\315\335\221\335\217\357\200\354\260\256\231\357\373\204\305\202\334\001\323!f\247\350\352m\211\203\255\310\207\2247g\216{\301mexI\306\216\323\314\352^\202\274\367U\253\222\366\276\357\356\310\256\307\275\004\237\230\357\222\364-\f\033\265\347\373\276\035:\020\t\273L\331z\212@\177\203\324\316L<\204r\b\264?\201\334\376\004\317\375\t\342\366'\310\263?\301\235\375\t\352\354O g\177\2027\373\023\270\355O@f\247L<\204\376\211\205P\340\004Z\366'"
+	.ascii	"\333\237\240\311\376\0049\366%\230\333A\245}j\264Y\223\365%\200"
+	.ascii	"\263w0v1ps'\343\372J\326\233\345}\231@]\323\2164^\262>\346\200"
+	.ascii	"\n\347\346\346\3460\007\364\022\230\331\227\340"
+	.string	"l_\202+;\230\205\205\320K\340\265/\301\221}\t\254vp\251\377\334\341\362\205\312Z\326\017QF\203)b\007\203\235\231\343d\222)r\247\315L\035\347\0325bdpx`\205\021c\266E\312\211&\216s\214\0379:N\323\321n:\217\266\243\347\3507\rG\353\321p\332\251\373h9\355F?u\034\355G\343\321m\364\033\275G\327\321|pS\337\321l\332\270\310\250\261\354\002\345l;\023\242l\353\312\354\214\214\206SLK\017's\215\216\323\fM\203\t\304\206\331\324\336\364\035\235F\215\323L\337\321f\035\200\343zz\275/\023hE\007\222\" \3645\334\331\327\200\266\257\001l_C\223}\rC\3665L\355\023\371\331'r\263Ot\266O4e\237\bk\237hj\237\350\335\317\200g?\003\233\375\fi[{\321i\270\251A\177\311s\304\311F\326\317P\266A\360\276X\003\212\347\346\260\006\364\031\242\354g"
+	.string	"\262\237\001j?\002\270\375\b\320\354G\200\266\037A\225\375\b\210\354G\320\264\177\335\\C\255`\310q\311\302\341\215\223\027\026mem\315\2259Y\037[\3216\3768\257h\246\036\323`ZL\207\341\246\266\242\251\\\177\351*b7\344p\340\265\340\356}\263\374,u<\235\332\212\276\322^\270\355\210Fs\007\233Y\3219\030"
+	.string	"\326\307\371\276L7?S\246\004u\316\302Ch\006X\b\375\220\236=\245\367\364\025dM\326\037r\333\017\321\203\b\032\031>\364\022\335DK\321]\372\211f\242\271t\024\355D/\265\022\334\324P\364\221\353\035\332\352\207\026\022\324\275/\0215E\316\024\031Y\313XZi\260\031\2179b4\024=\004\212F\242\223\340\266\253\023\276\3508\337\367\205\242\267\360Z\260\211\371V\245\\n\330\361\"\322QA\240\310 \322I0Y\nen*O\326\037\222\262?Td\177\350j\177H\306>\206\270}\fo\3661\250\355c\320\262\177\215u-$k\003o\206}\365\024\265#k\035D\357HS\244I\326\307 \2665\220\242k,"
+	.ascii	"t\031\363%\353\024\013\241\3070e\037C\326>\206\252}\241>\373"
+	.ascii	"Bq\033\247\341!T\002,\204^\210m_\b\314\276\220\226}\241*\373"
+	.ascii	"BK\366\257\253\246\252\220\321*\313ZOe-\245\251\256\247t\324"
+	.ascii	"A\200\360\337\323\013\366\276L=\245\337\267\t\343\013\202\030"
+	.ascii	"_\260\033\303\244\t\013\252/dd\377\272\306\006Oa\270\200\321"
+	.ascii	"\230\241\323\214\311I\222\365\177\r\245e\340\246\236\241c<?\345"
+	.ascii	"\254g\346\373f\3213\364S\231S\317\3200\360\032n;\362j\031y\276"
+	.ascii	"\322\274~sO\300\310P\375\013q\373\027\316\354_\260\262\177\355"
+	.ascii	"\324\264\307L\221Qe\375\353&\315\224\326\b\243\221\226\265~\205"
+	.ascii	"]\306<\371\223\365/tm=y\256\314\211\305tTn\260d|\225Q\t\333\n"
+	.ascii	"\323\311\240\202\305tQH\234Y'uDO\234\23351m\200\226r\336\234"
+	.ascii	"o\362\233\034\347\030\330\222J\023N\02357?\313;j\234Y1\276\234"
+	.ascii	"t\350,\325tq2\032\334&\310\024\364\276[3\226s\352,\337d<i\234"
+	.ascii	"j\331\315s\251{uNa\3163\264\037:2\035\232\016\216n\211\016\220"
+	.ascii	"N\211.L\367G\247G\267E\307F\247F\007F\007\247[\3235uK]\024\035"
+	.ascii	"\027\035\022\235\023\235\034\035\230NLgF\347F\307\246\373\322"
+	.ascii	"q\351\230\350\232\350\354\350\320\350\256\350\254\350\370\350"
+	.ascii	"\262\350\334tytbtttRtg\272=\2727\335\035\335\030]\234\316\213"
+	.ascii	"\016\217.\211\256\216\256L\267F\367\3241u]tf\2724\272':-:/\335"
+	.ascii	"\024]\232nN\207EGF7GwFGE\347\324\311\351\312\350\252\350\276"
+	.ascii	"\350\336\350\374\350\372\350\332t\201tatj\2721]\227\256\215\016"
+	.ascii	"\nn\352\342\350\212\\gD\2675e\013\026\323\325H\342<\323\305!"
+	.ascii	"\243*\322iQ\251\261\221[\226]\371Z\276/3\277\311pg\260\330T\020"
+	.ascii	"*X\340x\235e0[S9\367Asf\2654P\272W\367\004FE\013\234%Y\354\317"
+	.ascii	"g\371\013\217\2428:\034\272,\0353\315\004\030>B\374\272\027\312"
+	.ascii	"\313\251{uMb\3167u\346,\325\332\364Yb1]\025\220,\\K,\246\243"
+	.ascii	"\261\304\251'\0072{c'\3162\212\024.z\370\270Q{\023\307\316\226"
+	.ascii	"#K\246\225*K=O7^@\370\363\233<n\320D\321\035\331:\313z\262\334"
+	.ascii	"\231\223\n\031\034%Xk\3768u/\323\230\223mn\231\325\324\004"
+	.string	"Z\352\311{\314\b\341\341\304m\177>K\353A\005L\354\314\213\217%\026\323\315`\342<\013\223\313\310\320\275:\030U\234Y\317\037.\313\254\007P\221-\3167p\232w\314\266\220\f\271*\322\021\301k\301\246\240\367\t\306\024\330\237\365\350\342d?\315.\316\263.@\250\224%1\023\265\343\317jgh\250\255\301\251\021\305\313\254\312X~\343t\303\226\251\350\342d.p\202,\337\227\211:\351\340\262\302M\364/\370\330\274,<\204\342\034X\b\375\205\251}\013s\373\026\346\354[8\263o\241l\353\262~\235\r\335\r]\020\234\225\303\f\030\264\254\261t\201h\240\205e}\013V\366\177\235\017]\017\335\017\035\017\334\324\001\321Y=\353\340\342\324\001\321]uq\3468\323\001\321\355\300dA&\346Ke\200!J\226^\357\313\334!\271\312\343\326\323\267`d\337B\220}\013@\366-\370\330\267\300c\337\202\216\215\235x\b\005"
+	.ascii	"\026Bo\001\306~\320\333~\320\232\375 0\373AV\366\203\234\354"
+	.ascii	"\007\001\331\017z\332\027\352\331\027\246\331\027\226\355\013"
+	.ascii	"\245\354\013\267\366\205;\366\2050\366\203u\366\007X\b}p\315"
+	.ascii	"~p\314~\220\271\037\\\262\037\374\261\037\264\261\017\374\263"
+	.ascii	"\017|\333\007\262\355\003\313\366\201T\366\231X\b=\360"
+	.ascii	"\310>P\307>p\306\376\317\271\377S\333\377i\331\377-\331\377\371"
+	.ascii	"\330\377\315\330\367\341\331\367\261\355\373\320\366}^\373iX"
+	.ascii	"\b\275o\310\276\257j\277\007\267\337;\263\3373\333\357%\331\357"
+	.ascii	"Y\355\367\232\366yv\366yq\366"
+	.string	"yi\366y^\366y`\373mX\b\315b\362\030\334$\312d\204\230\215\323\324\217\254\317\213\262C\360b\"\364s\230\b=\017\310>\357i\177\303\355o\267\375\035f\177c\331\337L\366\235X\b\375\336\261\277\337\375\364\315~z\266\237~\355\247A\366\323\032\373\250\334>\352f\037M\333G\241\354\247Y\355\253\341!\364(\214\375\035\334\376\256m\177\267e\343\027\013\241\3375\331\337\355\330\327p\033Wu-\001\366\221\373\312\223\365C\024A\263\0042GF\016;YB\342d\254 r\302\206\250\321b\313Nr\222\254$\037\311O2W^\346&\231IF\222\241\340f^\222\215\034\233\345\255\274\303\252\016\233\216\267\345\3732\227d\"\230\f\267]\215\360\225\306\371\276\314\347\253\277(/\311<\362\217 \023\363eB\273,\337\260=\337\367M\335\204\274\271C\244\361\213\207\320\353\262}\355\265\257\215\354k\037\373\272\306\276.n["
+	.string	"gsH\333\177\366\361\374#\r\205z\032\322\225u\356Q\364\354#\216\215/:\262\336a!\364:\346\026\201\312~\034<\204^gd_\227c\377\031\307\215c\331\2360\030\3177\376\034#\313\3106xlg\312\250\262\256\362\225]\311\355\311\3729\320\376\237\245\362T\216\302\315L\225i\034\203"
+	.ascii	"\205V\303\313\362}\231\231*\317\350\262|_&Q\207\016\035\262\024"
+	.ascii	"\036u\256\266~\206\333\317i\366\263\227\375\214e\377\211\207"
+	.ascii	"P!\026B\363S\3213\fMd\017\325\223\2545\026B\377\354D\201\220"
+	.ascii	"\271C\212H\326\177n\312L:\250\250\254\267\354}\231\026\202sY"
+	.ascii	"^pY\347\227\b\370\344\363\305)\353g\256\375\020r\372,\303~,\366"
+	.ascii	"\206\357\004\231\202\336''\252e\330\033\334&\250{\337\246?K4"
+	.ascii	"4\226en\201\234\357\373\026\305a5xM\307L\3332\260@\211\371\213"
+	.ascii	"\342\260\033\334\006\267]\351/@\314"
+	.string	"\037\233\305\3411\370\214\216\231f\002\226\032\316\2665sp\344~\034\b;1\034\326\203\237\370\017\306\203\375`>X\016\367\301\200\360\036\234\007\317\341&\216\303s\216\351\340:\317\314c00)\231V\224\263\354\307fq\230\013\376\242c.K`\221r\276\357{\020\376\2428\230,\250{_,?!~l\226\006\223\005\231\202^'\267\031\313\367e\0363A\200\200\343\260\025L\246c._'\267/\030d\351B\005\350\371\276\314\016D\035:t\350\320!\315\332\"[b\201\376\261\235\343;\307d\033x_\346\373\276\031,\254U\005\311\032D\321\261\035\324K\214\220>Y\037\353\331y\211\207P\001\264\355c\265}\354e\037g\331\307`\3738J\233\037\263\301a\230L\311\305CK\326\307\\[\207\205\320c#\373mV\373N<\204\036;\355\033\367\217\311\034\237\371q\030,\006\257\341,\241\036&~\226d\215\313`5\334\334"
+	.string	"\2339\036\303\314\357\232\230/\363}\231\302\254\004\220\031\226\254O\334\307\033\240\272\2719\274\001\212\307\212\216\311\350\322\310\304\370\223\365)\260?\300C(\212\205\320\243\330?>;\376\362\343-\270\f\247m\340}\237\336\367\315\360K\242\003\207\232\2541\032\366r\234\206\273\2748\215"
+	.string	"Y\357\333\204\323\204\177\336\267I\210\361\005\030_\240\277\264\270\266\240\372\016\330\270J\321\361\331\217\253`0!\264\352\212\371\226\275\357+\024\272y\211k\222\365\027\260yX\b\r\302B\350\313\360\020\212\257`,\270I\001\326r\020 \\\307t\345\005{_\246\020\030\210J \271\254_\200}\234\345\031\256\274 \\h\037S\200\3429L\001\372\274\203\360\020\232\261\020j\001\026B\211\360\020z&\036B7\026B\253t\251"
+	.string	"\024\372Q0b\220\374)\226\0375\300\366"
+	.string	"&M\310\217\007\260!\003\201\350\214\251\330\217V`K\306(\226c\360\003u\240[\266\016\345\301\371\006\031\266\007Z>\301\017\344\241E\352\273\037(\343G\235X\001:e`\026\216\205\340G\315\366"
+	.string	"~T\2717H\253l\016?:\345B?\320\003Q\376t\313\224\177o\320u \373\243\\!\370\212\ft\361\243\025H\267\\\313\024 2e\222\201)\024\224\212\0138\374S&T\250\362O\235\374{\003(Ln\341\007^"
+	.string	"s\320\306\037-\261\005\360\347\016~\275\201\037%\2615\330\031\374)\006\376\215A&\300\257\303Z\002\251\231>\361\243$\354"
+	.string	"\3749\351\317\354\237]\374\271\370\347\027\177>\332\027\374\231D\306\277\300Q\020\300\266\340\337"
+	.ascii	"\310\220\346q\002\246?\252\373\321\235\222\177\023\375z\315\237"
+	.ascii	"&\355\f\377N\356GU\354\b\376]\357\337e\370S\345\036J\333\177"
+	.ascii	"c\330\271\371w])q\013\355\013\177\032\202\177\367\346\337\271"
+	.ascii	"\375\333\302\217\026\371Q#;(m\261\205\177\n\202\177\307\266\203"
+	.ascii	"\177*c\003\377\235\225\177\307\374\321\b\354_\215?\215\372\267"
+	.ascii	"\357\337}\370s\004\376\035\210\235\007\377\316\303\277\353\340"
+	.ascii	"\337\275\177\027\342\337\274\177\027\002\224h\247\376\2735\325"
+	.ascii	"\361\357\375\3572\330\351\277;\341G+@\235r\001\376\334\341\317"
+	.ascii	"\013\370\360\347\021~\024\003f\373wC\033\3751\217\037c\375\270"
+	.ascii	"\314\217\203\374\370\215\312\217%\360\343&?\236\363\343(X\354"
+	.ascii	"\307P~\214\346\307n\377\315\244+\374h\206\275\373S\036\177\332"
+	.ascii	"\343\337\372\327l\376\255\323cv\376S ?\252\301\306\177Jd\377"
+	.ascii	"O\223\374(\b\351\\\240_'\371Q\253\037\275J\001\375z\352\327R"
+	.ascii	"\177\372\347\327T8~4G*\367\353\017\234\220\372\371wh\376\324"
+	.ascii	"I7\301\257\345\244F\3773\374z\371\353 \3777H\373\374i\236\364"
+	.ascii	"\355O\347\374)\234?\205\221\2017\373\201\025\374\177\376\370"
+	.ascii	"\367\337\317\217\201\377\377\374w\373\261O\375Q\026\251\233\377"
+	.ascii	"q\377\265h m\263!u\373S4'\372\177QB0\363g4\247?\232\200TM\001"
+	.ascii	"\177Z\206\314\237\21201\006\205\037\255\300\226\234Q\025R1?\006"
+	.ascii	"q\001\374_\361\177C\032\346O\277\334\303\377\343\362\353\214"
+	.ascii	")\227\037\255\300\226\377\033\374(\226\363\376\337\334\237\021"
+	.ascii	"p3r?\346\260B\\j\206\036-\375\360da\006\376\340\374\370\203\037"
+	.ascii	"\017\340\307\035~\274\301\217\213~\354\341\307\037~\354\301\217"
+	.ascii	";\3701\207\037\203\370Q\267\037\003\177\240\031zT\206\266\371"
+	.ascii	"S\262\f\177\n\200?\265\340O\003\360\247\023\374\327\177\320\204"
+	.ascii	"?\325\177\272\3774\375\323\335\237\342?\325\375)\372\247\275"
+	.ascii	"?\365\240\345G\235\177\372\037\235k\376\017\372\203\023\370\323"
+	.ascii	",\177\312\374S\261?\005\373S*\177:\345O\243\374)\224?u\362\247"
+	.ascii	"\\\177\312\344O\225\374i\221?\305\372\323\036\177\272\343O\247"
+	.ascii	"\3764\352O\241\376\224\351OC\360\247\036\370S\027\177\332\376"
+	.ascii	"\351\361O\213\177\212\201?M\361\247(\376\024\205?}\300\2376\340"
+	.ascii	"OG\374\251\210?]\300\237\032\340O\013\360\247 \376\364\203?\365"
+	.ascii	"\360\247\034\374)\006\177\n\374S\337\217\266\371Q1?\n\346G\323"
+	.ascii	"~\024\355G\317~t\313\217j\371Q,?j\345G\307~4\354G\273~\264\312"
+	.ascii	"\217N\371\321(?\352\344G\271~\224\311\217*\371Q$?\272\365\243"
+	.ascii	"A~\024\310\217\372\370Q\036?\252\343Gm\374(\325\217J\375h\215"
+	.ascii	"\037\235\361\2432"
+	.ascii	"~\024\306\217:\375(\323\217\206\340G?\360\243+\374\350\322\217"
+	.ascii	"*\375h\373\243\311\037=\376\250\361G\217~t\375Q\342\217\016\177"
+	.ascii	"\324\002?\272\177\f\347GS\370Q\025\377.\316\217F\340G!\360\243"
+	.ascii	"\276\177\267\376h\005?\212"
+	.string	"\302\217\236\370\363\177\r\347G\035\360\243\r\370\321\023~\264\304\217\222\370Q\022~\224\001\377\315\374:\343\217*\340G\203~4\001?\212\200\037\377G\r\360\243!\374\250\006?\032\200\037\265\340\337\261\370w\031\374(\321\217R\360\243\023\374\250\206\037\315\360\357\330~4\202?\017\340\317\300\037\305\360\243B?j\341\337\025\340G\203?\372\373\257\345Gy?\232\376\273@\377N\316\277;\373wL\377\356\350\337\031\375;\024\376\035\321\257\347\374\031\377:\316\257\313\374\232\314\257\235\374\232\353\327Y\277\316\361k\247_\267\370\265\372k\t\374?\361\353\024\376\354\201?\223\370\363\210?\223\360g\341\237{\177\346\3759\3778\304\217/\3748\377\030\377\227\362\377\314\377\n\346\346\346\346~\340\362/Z\361\343\350\n'\241j\237\204w_\304\234}\021l\373\"\316\366Ep\355\213\240\332g@\236}\006\254\3553 l\237\001>\366\031\300\264\277"
+	.string	"\270\375\005\270\355/@\314\376\002\262\354/"
+	.string	"\311\376\002\252\366\357k\232C\341\312\332Le}\3346\327\223\323\333\243c\246m4-,\347\\\217O\317k\003\214\367%R\005\375\242\272\363\347\351c\362\275=@\275?\275@\270\331\233\353\311\235\365\346z~\320\256\260'\352Eu\347\317\223\331\233\353\365\361\341\004\0361\323\005\314O_\001~\366\025pg_\001l\366\0250f_\001]\342\262\234y\263\345\315\372\n\240\262\341zyp\263\247\247G'I\017\217\216\231\266\275hI9\365\364|\364\346hE-{y\222\364@\265s++J\220\254\257"
+	.string	"!\373\230\271C\203q\202\272\323{\303\315\236\235^\235\236\035\236\225\006\203\003Q\335\371\343\245\353\223%\215\023\325O\300\234\375\004\220\331\2759Y\336\367\315\340\303\321&\207G\326O"
+	.ascii	"\2268RvL=\271e\375\367\340\364\336\210\301X\356\311\332\rV\343"
+	.ascii	"\263\005F\326O\300r\037\0042l\2755/\316\2534\2640\230\214K\230"
+	.ascii	"\030\235\265e\214\231[\217M\357L/MoM\257\255\247\246\327\246"
+	.ascii	"\207\0067{l=\265\367\314`6,0\230\354\314Y&\227\301mW#x\2159\331"
+	.ascii	"z_zP\315aC\307\344\\\261a\320O\200\214\035\324"
+	.string	"\263?\202\235\375\021\336\354\217\240f\177\004\265\375\021\276\354\217\240e\177\004\261\375\021\272\366\337\363\022&J\023V\326\007a\214N\026\230\235\260\260*w\226b!\230\315\236\226^\226\036Y\217K\257K\357\254\267\245\207\3263\303\315^Y\317\312{WzX\236\277t\326\323Y\3263\322\363\332\343\247W\326\353\321+\202\333\216h69gY\217\212\316\312C\305\006\215\327\316\t\254\016\233\b4^\342!4\002,\204~\204\030\373\bx\356#\200\316>\002\324\354# m\037\001\314}\0048\331G@\221}\004\\M\321\360\333\022#\353+\353#\240\251\253\027\0057{RzH|\364\216\340\266#'|\235\351I\351%\351A\301mGN\b\204FG\211\033\213C\365\223\374\243\361\f\313\372\007\210\263\3545\351q\365\230\340f\317IOI\231\223\336\022/N\272,\235\2409a\002\341\212JJ\327\214!Xxz\372\007\210\262\177"
+	.string	"\036\373\007\270\261o\200?\373\357m\275w\004g\005q4\275zd\215\331\024\275\2675\202\022\"_z\210\350\302\322\244q\222\365\r\300f\377\357\r\351\t\301\315\236V\357\307{A\202MA\357\233\304NO\253\347\003u\202\333\216\350/9(\0248/6P}\314\334Q\247\207\325\313\352\001\301\315^\220\363\320`\336\226AxV\032L\223\006d\250\224<\237J\261\"r[\337"
+	.string	"I\366\r`d\337"
+	.string	"7\366\337\343\321\223\021\244\362\245E\256\351\255\363\207\027\b\r3\017\rg\226a\007\213jK\355\311\343\243\347mI\265\245\3465\367\346\354\311\340=yr\003\310\003\007\305v\347\007\325\226\332S\314\036=\345\207jK\315+N\203?!\234\300Pm\251=\315\234Rmx\256\250\266\324\236=\031=&\003\220\241\332\352\305\350\335\350\345\350M\365h\364f\364t\364\250z0zQ=\251\036\216^UoG\317F\317\252\007\325\273\352\325\300\315\236\214\336S\035\036\313\236\f\236\036\034\210jK\355\347\343\253\f\034\007}\021\332\354\213\360e_\004\261}\021\266\366E\220\332/\300\334\034\036 `\233\225\234-Y\277"
+	.string	"s\366\013P\206\347GJO\021)Y\277"
+	.string	"Wv\237\002p\355\027 \310~\001l\354\207\360g?\0045\373!\244\355\207"
+	.string	"\266\037\202\221\375\020l\354\207\340\264\017B\235}\020\304\354\203\200\205\316\2349rxqt\304\341\n\313\032\016\363\002(f\200d}\020\226mxm<7\2745<7\036\033\334\344\275\341\261\211Y\003\264T3\227\205&\227q\222s\362\336\360\322\370qb\235\371\263|\3033\363gj\216\023\f\217;lA}\020\336}\002\274\355\023\240m\237"
+	.string	"c\366\t\200e\237"
+	.ascii	"N\366\t\320c\377<5\" \235?i\330\312\240\231\225\001S\223\365"
+	.ascii	"C\220\361\314\274\234Q\304\276\300\260\231\024\036\025\255\260"
+	.ascii	"*<\261*]cXxZtV\252\366\026'*h<(eN/\274/\2741\2740<1<0\274.\274"
+	.ascii	"4\036\031\334\344\241\361\266\234\307\205w\306C\343\215\361\256"
+	.ascii	"0A\365L\261\351\361|_f\336\343\244\213\020\f\032\267\341!t\003"
+	.ascii	"\026B\037\242\217\023^\231VW\026\220\254\037\202\316~\b6Yx\315"
+	.ascii	"\315\244\211FK\231,hL\236\225\243.\263+bL(`\274\260]\0333dc\262"
+	.ascii	"~\210\"`!~\354\207\210\301\363*\223\004\217U\326\007\341gO\001"
+	.ascii	"Ag\037D\230}\020W\366A@\331?\357\t\317\t\226\265\257\246\254"
+	.ascii	"yN\226\\\274,D\230fp5\311Ze\310\304d\315$\214\t*.\353\2030\262"
+	.ascii	"yIxDxH\264\3168yIxC\272\246\236t=yKxJp\223\227\204\247ED\264"
+	.ascii	"\263\314\250\270\240\372\347!\341\035\371\003\204\206W\326[<"
+	.ascii	"#F\340\274\200\214\360\212h4\252\027I\326/r\356\027\321\331/"
+	.ascii	"b\333/\362\262\177\236\220,%q\266\334\360\262xA\272\270\304I"
+	.ascii	"\311\272\006\363\fL\030\247T\326\017qu\265\344\371\340\365\340"
+	.ascii	"\375\340a\341&\017\boF\226\025\2176\036\367\022|\nzk8\371X\362"
+	.ascii	"\200\360v\364p\276\357\333!M\017\266\250\236~\021\227\375\242"
+	.ascii	"+\373Ea\373ES\366\317\323\221\303\317\230\334\223\254s\374?\017"
+	.ascii	"\307/\253\352}\312\003GN3\353\033\350\221=PNY\277\210k\377\347"
+	.ascii	"M\361\250xU\270\311\263\301\223\021#\t\317\006\017\206\226\022"
+	.ascii	"\236\r\036\024O\212\n\252\026\314\262c\346f\353\237'\305\213"
+	.ascii	"\002\023(\017\236\254k0\321\256#y\302d\375\242!<\032\274\031"
+	.ascii	"8\344 \261\223\365\213t\354\027Q\355\027\311\330\377\340\317"
+	.ascii	"\376\007p\373\347=\235\347\264\306m\254k\317\361\230xM\274w\007"
+	.ascii	"\302M\236\323\006\364\334#c\0353\375\364\251\"G\305\371|N\031"
+	.ascii	"qz\361\234\366\037\3249e\304\371\354\260\263#\266V\345\247\377"
+	.ascii	"\301\226\375\017\230\373\037,\331\377 \307\376\0070\366?\370"
+	.ascii	"\331\377\346\263\363\300y\236=\363l94\340\270E\271\231Z\322q"
+	.ascii	"\203"
+	.string	"\262\263\357l=\033\317\216\333\316\275g\277m8\334\334yv\2357RK\26085\362\3546TnWEy\366\034\364\206T =^\357\313\374=\001\202\206\f\203\376\007\263\375\017a\373\037\244\354\177\020\262\377\341\307\376\007\252\375\017L\373\036\336\366=\244\331\367\300\205\315f\3439e}\311e\375\020g\326\234\233m\233A\343\\;\263\334iv\333V\263\327\340\346f\333h\330\266\232\034\030%\313\035\027\037\357TO\337\303\330\276\007&\373\036n\354{\200g\337\203.\373\337e\320&1)\036PY\377\233\314n\307\225\030>\262F\277\242\300\275abh\234e;\3136\333^;\312&\333U\366\330n\356\260\255eo\331][l_\331b6ss\331Sv\227\r\266\2776\230Mec\331^\266\225-e\217\331i\373\313>\333h\270\271\303l'\337O6\224McGM\t\303\325\204I\023\347\256\n\243\263R\325"
+	.ascii	",_{\031\005\n\327\3639\207\316\316i\001\025,\\\317\347\346B\337"
+	.ascii	"l\210\020\005\013\2348;7:+U(h\2519\337\367\245\272\261c\362A"
+	.ascii	"\030\224W\003z\347\234a\201\242\234LavO\273\031\270\255\354m"
+	.ascii	"\302A\2001\255),o;\246]T\002\340\270\236^\032\220\236\213\200"
+	.ascii	"\023\327\323kKm\252)P\230_`p\\\317\035f\013\331KnX0\005\307\033"
+	.ascii	"\366\246\n\024\256\347\263\206\023\327\363\371\265\303\354\252"
+	.ascii	"\354\230\350\254T9\300)\216\223)e\307\211g\247\207\n\216\214"
+	.ascii	"ECOe0\206\203\353\371\3344\276\303\354\032{\306{\203\303\224"
+	.ascii	"-5\205\205\353\311\264\303\354\232\360\232\bcnp\344P\201\343"
+	.ascii	"z>"
+	.string	"\315\302l&\035Lq\342z>wL;\314\316\351e\302C\200\2610\\\317'\325\016\263k\262\2432D\2040-\256'\321\006\274\330a\"\241\017\307\304Ch\320\013\013\241\367@\313\276\007T\366=H\262\357\201\217}\017n(\001Zm\201\003\224\365=\220\261\265\221\354#\333\bn\356$\273\310w\220\235u=\004\315R\013};\343,J\262ol,\334V\246\305\244\331I6\021\364mm\351\353\023f\005\327\323\357\340\317~\007|\366;\310\263\337\201\234\375\016\330vP\033\036Bs\324\306\361\215\365\357\376l\033\033H~\363\302\201\221\365\217\247\364+\315\317\237\254\337\301\227\315c\367\300\315\355c[\351\355c\347\330;p[\031\t\260.\316\355c_\241M\270\255\354}mx\360C\312\r\314S\027F\315\0177T\277\003&\373\035d\355\255\343\327\264\003mM\326\357\300j\277\203\252\235c\024}\343\b\324\247FY\326\357"
+	.ascii	"j\007\275x\b\315\177\3669pn\315\201\332>\007g[3\261\020\272\241"
+	.ascii	"t\034\034Q\264d}\016\306\366\377\035c\303\300\315-#}\363]\236"
+	.ascii	"\035\334\211\266\214\024\316~\322Y\251r\200[\020\347\226\261"
+	.ascii	"\363\223\272\021!F\225\tnX\316\016Y\214\312\215\t\252\267\323"
+	.ascii	"\032\234( Y\237\003&{.\r\204N\321\352\261\234K\347\244r<\234"
+	.ascii	"\351\\\372\007m\n>1_\246\020N\\O\257\335\264\231\366\213\233"
+	.ascii	"\351\\\n\350\273=;>\001H[2\267>\007@\3669\250\261\317\201\214"
+	.ascii	"4N*'\365\223\263\316\214]\245e\335\347\217\023\234\223\254\337"
+	.ascii	"an?\204\035\037o4\334\242\362|\214\316J\325\326\242%\345\004"
+	.ascii	"\253\263'\205K\343R>\351\0237S=\351\235\247\316\024\317\223\236"
+	.ascii	"\224\316\275l\230\361\276j\\\320\253\250!z\236\035R,6ji?\375"
+	.ascii	"\016r\033g\341!\024\003\334~\207:\373\035\334\354w`\333\357P"
+	.ascii	"f\277C\230\255k\303C\350\bX\b}\007\262\375\016_\333\316\2358"
+	.ascii	"@\210d\275\013\004\205\326X\222\006\222z\242\366\214R\005m\302"
+	.ascii	"\222z\242\366\3142\250\344\234Z\215\236\322\352\343\0044\303"
+	.ascii	"\231\212\331\315\2412tV\252P(\002\345D\247\320*?\313\367e\006"
+	.ascii	"B\245\322'\016t\207\032g*F_\241O\035\323\311\3736!I{H=Q{\356"
+	.ascii	"\376\354\246\360\332\006\030\357\233\205\325\313\021\005\354"
+	.ascii	"^tV\252\"\210\341\206\206\006I\305\240\\\032\214\024\251'j^;"
+	.ascii	"9+\264\207\033\033TZ5\226\356\220z\242\366L\311\3222\351Z\332"
+	.ascii	"\226\252I\333\244ei\2304M\312&eK\327\244^R4)\231\264Kj\226\252"
+	.ascii	"\245[\322/)Z\352"
+	.string	"\226\232I\317\244\\\3221iZ\n&=\303\315T\314\256\316w\317]\237@h\224\316J\375H=Q{Z\245?D\210Q\305\233r3C\237@A\275tV\252L\3202#&\265\221\356\250\222\346\220z\242\366D\247P\033\350\215$\251s\r\225T\f\372\2056\351\254T\225pSC\247\304\240>P,\235\225\252\315\305IL\n$m\212\020\243\312\001Zc\316\367}\373\2442D\210Q\305\253\341v\206\006I\305\240K\324\211\216\231f\202\326\232\023\r\"\006\315B\233l\230\361\276D\276R/\251'j\317]\240]\r\267@\273\270TL\252\005\223\001\351]I=Q{\276/\023\363\300\202gl\004\375\016P;\315B$$\262\325\344&\353\017\340\271\261R!:\346\262\204\323\224\223\231bI\255\340fz\345\351\225tH*E\204\030U\020p\222r\246W\322\261\243\371\201\006\221j\322CC\207\016Z\313\0213A\266\376"
+	.ascii	"\302\366\261\230&\032p\333\021\006<\341\002\205\2123\225\222"
+	.ascii	"j\245L68A=@\355l\3711C\312\236|9\341\200\333\312H\244\201\245"
+	.ascii	"R\322\256"
+	.string	"\217\t>\005\275OM\274\234\251\224\224K\003n;\36261i\240C*I\3273\005K\305\322)i\225\224J\372\225\206\245^\270\231JI\243\354\2644\237r\027\3649<\3679\340\331\347 g\237\303\232}\016j\373\034\276\354s0\333\3470\266\204(3\335aC\225\36594A\222&\301\315TIZ\344\214H\272\365\266T\222\036I\267\210x\220&jN\355\251C\243\243\247\211\352o\360\266\377t+5\342\013\024\006$Pj$-\022\024\343\212\"\222\3657\030\263\277\001\332\376\006d\373\0330\367\237f=\025\362\235\331\21432\262N\203\024=\315\202q$\352F\326\033`!\364\033P\331\337\240+\365\301C\031\305\216\220\254\277\001V\017\036\272$N9\313\253\247<\230\350p\201\263\201U\216T\007\016^\024\035fu\262\376\006L9p\360\336\200\241\355\271\361\024\207.\016\313\b\223\032cW:\274\370I\251p\227\234"
+	.string	"\332\366q3\235J\245\236\372\\a\313:\225\232\302U\354\270\361\311:\245\221\326\330K*&\0305\336\324\316\004\352\221\316\340\341q\243\346H:C\203)\342\004\255J\326\027"
+	.string	"\230\rHG\366D%\205\201\233i\f\324\017Q\2104\006*\227>mp\202z\233\264\006\320#\n\216\355\367\316\350\363E\353?}J\235\360\324\224\023*\353\264\211\207&\207\0163Y_"
+	.ascii	"Z\373O_\334L\231\354p\020\002\345F\326\217C\347\376\363\362\226"
+	.ascii	"\233;~\262F\003U\275d<\262\006\224\332\261\301\346J\326\027\200"
+	.ascii	"\215\375\007\365\223\2054\265\261\221\365\0050\265\257\301\237"
+	.ascii	"}\r\370l>h\226U\225\250\254\257\001\235]\206\222=aA[\276\357"
+	.ascii	"{\005%c\222bE\275y>\333\240r\304\344A\355\240wP<h\034\272\007"
+	.ascii	"u\242zp\023\205C\347<\277A\303\340P:\350\233\316J\325&\303\242"
+	.ascii	"\306\371\276L8\324\n\217TJ\324\233\347\023\016\345\202\272mp"
+	.ascii	"\202z_+4\320\313D\307\202L\026\336"
+	.ascii	"\227\bV\232\0368T\f\035k\222~\001\363\020qB\271\300\001\255\303"
+	.ascii	"\024\362\336\300\001)\313\372\032\260\331\327\200\314\276\006"
+	.ascii	"[\366\217\3129\032\247\304\035 ^\262\206\3233\223\032\263\222"
+	.ascii	"\3655\020\333\350\033\324\315\034\032\257\235\254\257\301\223"
+	.ascii	"}\r\232\264\241l\3205\270\211\272\375\013\032\246\n\352\206\216"
+	.ascii	"A\331p\333U\320\373jy-\337\367uC\317\3204\035s\231jq\023s\276"
+	.ascii	"\357\253\241C\207\016\272\034_G\372l\315\206\222\321SHP\266\250"
+	.ascii	"7O5(\0324\rn\242l\350\231\243f\350\226\023\241l\350Z\r,L\234"
+	.ascii	"lh\031\324L\022\024M\324\233g\207\334\346G\235:[_\203\"\373\032"
+	.ascii	"\004\331\307\315\277\241j"
+	.string	"\267\243\004\315\216\260\254\257A\217}\rp\354k c_\003\247\375\020h\030\264\313\327\362}\231bp\023\r\203\202\321\351h\202\031\242\3653\360\263\237\301\036/\270\211\246\241h\230\211\246\241]0\331\006\247\367\305b\202\372\211z\363|\3427:Q\260\264~\006h\373\031h\331\317 l?\003(\0333\361\020J\204\205\320g\260d\243Z\256\244\3100\263~\006?6\232\005\305\3627\035\323\311\373\022\361\021L\213\032\333\363l\342&\232\345DD9\016\02006Z\037\203=\373\030\334\331\307 \316>\006l\366\217\216e\2674QNY\037\0034{\207\001\231}\f\272\354c\320\3348\313\013\235\222\263\322\376\304\330\2215\332\205F\301\315\217A\245\360\236\230o\026$e\230\220d}\f\302\366\322\373\276/\376\0304\375\030\364\030$\331x\211\205P'\327`pzC\214\0250Y\037\203 \373\030\340\330L\2048\200\220Ae\375"
+	.string	"\004\332\017!\004%\242\263R\265\267lq9\321$\350\022\334D\225\240EP%\250\021\024\311\206\031\357;\204J\320\031%E\215\250\003p\313Sn\007\252\267\320#\302\032Ld(anE\331\017@\326\036\202j\345\033\315$\001\3101$"
+	.string	"R\373\027\370\331\230\211\205\320\037(\020\354\266\307\317\f:?\326\\\241<tL43l\302\\\221\345@u\370\264\334\230-\263\376\005Tr\\\300d\267\005}2\274hq\311\372\027h\355_\260c\377\002\247\215-\200\333\267\300\rJC\330\326\204\fZ\326\267\200\f:\303,\006\356\2021\326\225\365-\210\262\377\243O\270\211\302@_\030(\023\352\264a\306\3736\371HsD\r\321\363|\337\227\250\003\366q\306I\215v:\332\224\323\344\334\210\2225\332t/Y\r\036\254g\326\267\340j\337\202\247\375\n\3426nk\263\363kf\277\202/\333\302\025\026Bu\033\036B\177\206\205\320\334\334\0210\361\020\232\343`!4\3359\177GW\306\374\002\225\265\035\335\232.\037e\262~\005U\366\333\256\016\372u\307\251*\353W\340d\277\002\"\273W\001\325~\005L\273\007"
+	.string	":n\332\344,/^\306\252\262v\323\340\2033\244\f\214\254\017\2002{\247f\307e\267\004\267\225i\265\247S\315\356l\007\206\310\235\235\232\035s\267\245\251\017\333\256m\307f\267\0067wjvavjvbvi\202O\314\027G\217K\213\353\371\324\320\341'%NS\252\247\321\020\355\240\226K>Y\037"
+	.string	"\\\366q[\226\2651f\226V\324\312x9\263[\333\231\331\251\341\346\256\314\216\314\331\373\276\2760\246\2322=}"
+	.string	"\214\355\003\300k\037"
+	.string	"H\366\001\240c\177!J\001\216\230U\326\007\300\214,aK\264\335\025\260\264\235\027\334\334\241\355\272\224\361\250\b\361\212\201\352S"
+	.string	"h\237\002;\373\024\240\331f3\350X\261e}\n\322\366s\226\225-\313+f\313\346.\013\027\247\226]\331\216\f7w\315\035\226\357\306p[\007\"\036\036/\250$[\237\002\264}\n\256\354S"
+	.ascii	"\266OA\224}\n\214\354\237\325\366Q\340\264\277a\317\376ea!t\347"
+	.ascii	"%\205L\352M\240\254\277\301\315>n\356\246H\361E\201\203\013g"
+	.ascii	"\326\202StR"
+	.string	"\300~\3500\363\023\373m\021#G\245\326\363\352\361\250\262\332*3&\334\342\226&F&\270\005K\217\037\341\230_\235?J\302\322\262\026\206\021\206i\352\211\251=\204]\272\b\277\374B\023\030\207>y\224,\237\357U\016\016\277\020\355\302/\30240H\346\344\b\323\204^z8\3444\307\354\220\310\3418\033\363\237\247u|\251\222&\353\2532\366/<{\333fv\332j\b\271\374\326x\034\321\312\232\tFE\245$\313\354\007\206\206\b\031\2632`\033\355\004O\324\032\262`\2231\031gQ\264\004\265\202\354\310\003\226\365\225+\302,\250\224\037[XRn|if\375\013\261\\\230\005\317\255i\242\371\2022\004\006\\\326\337\300\030!S\310\374\255\245Yn\351\261,\222\3657\220E(&\024K\305\246\2148\335\220\031\023\313\372\033\200R\245\212\020\f_y\251\204k?\206\200\361\022\362Dg,k067\344\274qT\250"
+	.ascii	"\267\020e1\355IwX\005\362\363\024\ny\303\364\311\372\303\246"
+	.ascii	"p\212p\312\017\016\203\037+>XO\241\334\035-\267\254?l\"\214\""
+	.ascii	"\214\002\002+>X8\313U\0215Y\177\330\003\n\224<Vp\317'\217\r\316"
+	.ascii	"\326Y\326\037\322p\342\344\007\207\257\274T\030\376X\361\301"
+	.ascii	"\302ex\224\371\311\372\032\340\342\372\255\335\260b\003\346e"
+	.ascii	"\006F\326$\353k M\310D\310\344\267\026\324c\005\3072\367\230"
+	.ascii	"e}\r0\021n\t\267\204J\310L\315q>\177T]j\314\222\\\250d\307\305"
+	.ascii	"L\0304!\222L\347\216U\033!\022\341\2216j\200\200\355#]T<\262"
+	.ascii	"\276\006xde\t\213\020e1\355\351\371\231\232\343|\006\377|]\261"
+	.ascii	"C\344\302\":%4\302\242\264x>\252\350\264\321\032b\314\342T\213"
+	.ascii	"\262"
+	.string	"\241\212\350\271\022\n\371q\001w\304\370\"\313\372\032h\022\376\020\376\020b\261\375\264\342`\214\t\201\\\210\005\346%\313\372q?#]\326h\351\362vu%\354\321K\233\232\343\004zQ\263:\303\343\302\036_Z_x<\003h\204U\302*\341\216'TJ\236^QTC\312\bu\\\270\203\267u\265&\227\265\320\2060G\224.2\216\bs\bq\300\370\212\202Cd\373\370\262z#\274\321\373\201\302\305ar\006\353?o\001C\334\314\360\232\232\n\312\021\3557\fK\224\263\311\2160W\262~\006\204\bi\bi\b\243v\240f\177\270\266\bk\\\030\005\214k\266\211e@J\350$t\022B\355\2312\342\364\372\311\245\321\002%\224q!T\252\305\312\f*\353\307\tc\004\002$U\226\265\020F\027\025\0213Y?\003L\302\247\375\007\025\303\025F,\353c\240\216\220I\310\024\234[\3131\347\211\222\035^\334\262>\006\270"
+	.ascii	"\002\024\234\353\241\3111GHfN\2228\201\036\234\023:EY\322\005"
+	.ascii	"\003J\372\364\t\312\241=\254\330\200\245l\2228\301\362\363\240"
+	.ascii	"v\033{\023\007E\331\250\376\370\311\372\027\330\023\027\027\344"
+	.ascii	"\223c\316\023/\324\r\263\217\233=\017\362\371\037*cZ\262~\234"
+	.ascii	"O\315\177\036\320\353\315\r\217\254\177\0015\2473\bG\224\305"
+	.ascii	"\264\007\rdU\345\031\002f\033:y\036\204\273`i\325\224u\020\017"
+	.ascii	":\366Z\311\371\310\372q\034\2044\264\354q\312\372\027\270z\363"
+	.ascii	"7A;\327=\275XUzjSs\234O8\177\274\362\004\347<h'\370v\347\t\232"
+	.ascii	"\225\267:mk;\206\300\321P\266f\203\016\217m\2027(9\377y\026`"
+	.ascii	"0qe\035\214\203\263\220!\221\313\372\027`\332A8"
+	.ascii	"\177\201\276\"ieMY\337\002n\330\330\202m\210\262\230\342P\247"
+	.ascii	"\225\224'y\310\r\033MA\267\007\333\330I\3132\222uPM\220M\260"
+	.ascii	"\211\2250O6k|b\300x9M\t\002\301\003e\254M\037\341Q-}<\253\376"
+	.ascii	"\363vL\2304\366d}\013p\211ypML\020M*\206\350uzz\261\220\b\311"
+	.ascii	"Yq\005z\276P?8\034\031\t\202\346\314\203h\320\240s\315\264!Y"
+	.ascii	"\007\325\0364\363\363R8n\316\\\341\263\203d\036,\363\363v>p\320"
+	.ascii	"\351\312\372\025\310\263\377\340\230\237\367;\202\206-O\326\257"
+	.ascii	"@\235\375\n\270\001\003&\370c\007\235=\032\320\023\036sY\277"
+	.ascii	"\002kii\2775\242,\235[\220\033]\300>d[\313\254_\001,hh\370\207"
+	.ascii	"\225\022\261=\003\214\234/Y\277\002XggjV[\177zp\200\324\001\222"
+	.ascii	"\365)\340\326|3\270\005_y\2514`e\244\207\227.\317Z\021\"f\017"
+	.ascii	"n\3411\211{&)\363\261\365\270\021\247,H\026G\307T\023\375\232"
+	.ascii	"x\013+\023\324\242+\262\306D\r.\f\013\226\036\233\225V\325\026"
+	.ascii	"\250\2665Y\237\0026\254X"
+	.string	"I\253v\314\221\331\365\250J#\307M\225W\t\216\341 \246\223\033\330\362\247\003\211\327\022\261\007\307\364\037$?\272d\375\270`\330\177^J\305N\025\222\260 \030\320y'\214\231u\020\254\207DCz\243\255\214\2144*T~k~\2568\364\244l|\325\260\322\325\025\234\202\366\330!\267\364zb\003\302&(\345\301)\267\023GN\310\227\254\203Qp\020\210\231\227\216\t\370\330\377\037|\022|\362[\303W^*\rRv\370\271\361|\337+\016:+1\3149\347ri\206\347L3b#\353K@\315\376\203L~&\301&'P\371\226G\322\250\262\036\022v6\346K\326\227\300Y\260\310\203J\202E\2025X\304\340\215aas\276U?8\360\241\265\241a\222u\020I0I\360Hp+hD\002S\202T\017\352\b\356\bZ\341f\220*\250\265sz\233\230\244i;\035d8\260d=\204\271\203;B\007J\326\227"
+	.string	"\222\242\036\301\037A\335\3736uY\276\301 A!\270\031\314\n\002ypG\320\352\330,\230\025\304\n\232\265\275a{\3463\26515\250\276\004\200\354K\200j\377A\037\017\376\370\203WA\036\3016)R\336d\215\315\212\036\364\321CsV\241\312\372\022\240\2611\024\036B-`!4W\341!4"
+	.ascii	"X\b\r\342\b\346\b\336\b\332\bV\245`g\377\301\240\324\017\214"
+	.ascii	"C\320"
+	.string	"\373j\261\245\275UW\034\2401\344\370\374\310\372)\240ys\340\235\035\220\035\026n\002\337\004k\240U\313wK*]\323Yqb\343J\326A\032i\023\2347f\262~\n^\3661\230\023\210\247\216\023\230\207\2163\016\310\007\267\035a\200\0245h\027tl\203\023\324\t`s\234\357\313\f:\001\373\004_\264g\320\t\250'N\020FpF\020*\030#\330\024|\n\312\300\315\240\023\360\031t\002\302\311q\n\365T!\263\n\322@\347\33768A\235 f\307\t\234\0132\341f\360}\360E\345\200\201p\333\025\363\275\201\331v\320\331\243\241\0030O\2338>P\375\003\003\001\001\2351\267\340\262\006\376I\257\254\316\300\310\372)p\355\037\350\0077\201r;\316\353\213\\\326\217\273\257L\022-$\373)\374\330\300=\333\215\023\b[\326Oa\307~\n7\366S\250\261\237B\214\375\024\230\366\017\304\203\216eY\323\303\226\365W"
+	.string	"\332\300:@;\302\2574#\\\262>\360\355?\017\205$j\270d\255\351\3443\\K\251\254\017\234\023\214\323\304\314J\326\007\312\3412\247\207G\326\3008;\306\212;\033\364\200\240\005\361\001\347\3008?\260L\336\261\302\034 >Y\357\306\212\016\204\303F\3069\226\365W\230!s\240\033\031`\233\235\323\333\324$e\373\301\301\2068Q\372d\355\345\314\026\255\254\201j\200k\200l~\036/L\224\333\217\254\277\342\313>\260\355?\257w\204\r\223(Yg\3741(0\315\201l?/\005\253z2\313\372+\316\366\201g\200h~\236\016\020\23203\262\376\212,\373\300\265\377\274\020\320\021B%k\240\231\035cE\224\rxs\256\274)Q;\320\314q\332\006\242|\\\335\311\032X\246\350@\265\314Uv\346L\326@,\204~\305\225\0301j^\370\340\001\224\365W\304"
+	.string	"\202\001s\245\202OZ\332[\205m\353\200j\002#\353\253p\203\206V\200'\350\223\032\332W\326W\001\346\354\f\270%P\206\332\322\303MWY\031pK~\337*\\\316\024\212\251\006\227\031n\002\267T\001\303\264\312\372q\230\354?o\247\265\247\216\027\255f\023\250%g\275\357\033\343]\212C\245\017\272\303\215\031\024P\013\3726gJ\033W\326W1\205\005\313o-\277Y\357\273L\325\250\324q\002\251r\234\001\003\310\212\225\037\334q\325\227\020`>(l\366\244\311\372)\356"
+	.string	"\307\200c\2775<\002\025\265`X\333\025Y\326O\321\266\303\302\336?\035\004\372#$\353\2478\333T\250"
+	.string	"\253|\001\221\003h&\027C\016\360\353\300*\371,L\220)Y?NO\375\347\375h\334\b\203\225\365S0\201S\200S\360|p\352psz\325xJi\313\372)\272\240"
+	.string	"\243@\371\255\241\357\213\231YTU\357U\025\207\256\256&\020hz1\270d\031\313\372)\254\366#\340\004\350\244*\002n\270\270~kk>H\321Ui\203\261#\353G\200\214\t\223\037\334\027\017N`\035:\357Y\326\217"
+	.string	"\330\376\201J\232@%?2\032\344\3101GF\227\251=\231\313\372\0210\262q\023\210\344'\206(\353\305\001\002V\016?]i\024\037N\250\262~\004f\340&P\bp\213\367\3646mI\2359\346<\021z\235A\003,r\340\326\017\034\002\324\002\032\311Vp\230\230y\363\364\312\2225\220H\321\201E|\\\316"
+	.string	"\342\312Z\b\013\241\030^<\204ff\233\375\003\203\0347\201A~`xOo\223\022\364*\207\233\363\t\254\343\243\tI\326G!\006\b\220\037\032\357\351m\362B\275\250\266\324\334\234\331\362\226\365Q\214\355\037\350\003\350\343\307\205\367\3646-IwL\261\351\361\244\271gN\023++ \217\242\247\267\251J\n\366\203\203\224\016\022.M\300\253TO\032/rZJ\016\222\250\254\217b\310\376\2018p"
+	.string	"u\020\0051_-.\313\367\375\301\201\317\217\2328R\300\034;!p\200\226\020\375\242|\240\215\311\372(|\354\037h\343\270\t\264\3613\323=\275MM\320@SF\234f\236\300\370d}\024P@* U0\020\004\340\366\017\224\002J\375\310xO\257\021*\250\024\251@zv\325\323kJ\326\207@\232\375\003k\0347\2015~M\016Y\357\215\017"
+	.string	"5)Y\346%j\226\315\254\017\201\263}L\005\003g\0347\2013\320&\264\212\306\253e\243\203W\f\016\016\201+\0337\2012~X\320*\374\276dnx8\335\202\3748\313\372\020\b\333?\020\006\020\306\317\n\\\030\256\347\034\025\032\221\254\017\001%@'\240\323\232\r\256\366X\025\267\270\254\017\201\033\373\0072\001\231\3207\336\373\016A\222\346\200\300;7\367[\303o\325\373^%\240)\346|\257\2568\b\227\324\311\362\322\363\347\317\017\320\205\367}\337e\252\245I\305\311c\2325\271\003h\255\247\304J\f!l~\374\374\236'\274\357\313\024\364:\271Y\262|\257\2568"
+	.ascii	"u\310"
+	.string	")\242$\353\243"
+	.ascii	"\306\207\317\357y\\\365\276o\257K?\321\251c\344\211\311|rlx\205"
+	.ascii	"e}\024\206\354\353)\374\213k\376\342\364\224\356}\261~\244?\230"
+	.ascii	"\034\034\205\250<y~p\274\367}\337\253\227)\256\327\343\212\303"
+	.ascii	"\356\213\330\036=\217\373\017\316\t\024\255\250\254\177\302\331"
+	.ascii	"\3749\177b\034\262\232rt\340\344\312W\332\356\213"
+	.string	"\216\0241\373\377\331i\376\354\350\246\242\367%\022$]\252q\220\257\216\350\260\223\365O\310\301\315\237\234_\035\016Y\357\r\002\364\311\243d\t\\\363A\303\231\365\257\316\377\233\363\243\243\231\360\020#g\336\254'h\303C\250\016\f\013\241?\221\004\016\234\037X\257\352}\265z\244kUW\034\004\237>\300\266\262\376\211\035n\334\370\226'd\354\377\267\0067\177k~n\037\340\367\r\343\004\304\371\276?8\320A\321\341r\366c\363\323\302\n\023\bH$\b \034Y\377\001z\366\377C\203\233?4?5\371\312\313$t\352q\243\353yGG\224)Y\377\324\374\2774?\266\314\204\341\314 \022\227u\020?@\314\376\257\314O\355?3\377\231\371\255=\350}\337\240\024\035n\316\347{U\305\341\177\034n\376\326vl\272\232l\311\372\017\370\261\177\374\374\243oS\325\373\2767v\314\267\312\351\207\376\370x\2071\207\037\210u8"
+	.string	"\377\265\356\237"
+	.string	"\r\n\274\257\222,u\336\367\305z6\024/M>,x\377\377\031\336\367\265\001\365\3642a\250,Cl@e\031Re\001\n\315\020\033\357\223\r\257\247!Y\030\352iHU\325\323\313d\341\3152\244\n\352\035b#\350\315\362ZAeib\302PO\257\215\367\035\362\006\275PM6\336,\314*\013PY\206TAe\031b\303\002T\226&\033Po\326\033\004\305$R\3652\2070Y\250\221\245\311\306\233%\313\206\2057\313\020\0333\224\3149\341 \313\262\b\027\240,c\002a<PO\357\224\324\217\246\252\2406(f\326\033\347}qY\214\267\352m{\337"
+	.ascii	"\274\357\217\254\2528MV8\315\251m\312\351\254)\0133\337\367\325"
+	.ascii	" \345\244\225\365>\2651\341\267\r\252+\353}\273\234\220^\251"
+	.ascii	"\367}_\00201\333^$\270\215\211\310\2177*\306\373J\3602\337W\352"
+	.ascii	"}\231\360\333\366\276/\323\373\276i\325\017\346\373\366\b\202"
+	.ascii	"ZJI\275\357\025\221\324\373\203\351K\214\367\315es\322l@e\321"
+	.ascii	"\312*\372\242%\313\362\225\301d\302PQY\357\362\2153\244jga\262"
+	.ascii	"\362F\275\357\213\341\366\322\006\216<Y\217\201\362\362c#\353"
+	.ascii	";\340\315"
+	.string	"\376\205\311S\201\366\334\310\372\016\370\262\177_\204dz\304\265\311\372\016\3202\205Y\366\276\257\206\355\264\203\315\227\254\267\364@\263\225\365\257\313\031/B\274d}\007HaZ}\341\211\222\365\217\f #8\262\276\003\222\354_Y\234\346\233,Y\337\001?\366O\213\376\221\346jM\326w@\215\375\313\302%\r\2260Y\277\001s\373w\005\252\006\230\035Y\277\001\317\375c^=\261\362\226\365\033@g3}iXf9~a</&8\266\262~\003\322\366\257\n\376\335yz;\222\365\033`\305\353Ge\273\365)r&\3537`\211\327\326q\363\267\365\223\202\253\360\373rqs\345|\337+\016z_\304`\251\221u\0245jE\242\262~\003\200\354\377?'\277'?(\270\371\353\372q\375w\344\207\244\353\267\344\327Dg\245\n\005\0305\324~]\277$Q\316_\327o\331cj\216\363i\207\310\030 [\277\001Q\373&"
+	.ascii	"\355_\223?\253\375\224\374\230\344;4\244\220e\r\007\n\r\n\232"
+	.ascii	"\254o\002\317F_<\204\336\304\231\215f\341!\364m\260\020z\023"
+	.ascii	"d\277\"\301=5\342\312d}\023O\366\217\310o\310q\3637\344\227u"
+	.ascii	"\301\037*6h\204b^\314\340\311\372&\200\354\377'\344\227\345\226"
+	.ascii	"\206\214[\326\277 \2731m\344\326\262\276\t\251\375\377\200\340"
+	.ascii	"\346\017\310\317\007\207\254\027\207\007]Ts\330~7\300\304d\311"
+	.ascii	"\372'8\367\377\373\341cK\310Y\326?\037\377\361\320V1\260\320"
+	.ascii	"~=~<\202_A\226m\324\242\344\236\031\303\325\224\251\254\177;"
+	.ascii	"\230\273\n\227(eY\377\004\267]\223 Vi8\216\233?\034?\033\371"
+	.ascii	"\312\313\344\363\222\307\216\027oH\023\030Ti7l\230\320\212\302"
+	.ascii	"\221\365\257*'\351b\246I\326"
+	.string	"?\341\312\376\177S\307\315\337\324/j\367\364\032\021C\301P\335\371\363|\337+\016|g\344\314\316d\375\023\266\366\377\223\212\332B%\314[\326\277\032\031\357\341#\366#\353\237`c\377?\032\277\031Qf\210t\341\305\211\261\203'\353\377\007\365\203\021\247I\316F\326\017\321\364\216\375b\374\236~2p\363\007\343\347t\314\006\207\035\377`\374\230\346\310<\263\333T\f\267\255o\002\233}\023\324\366M \3337a\271\177\337\234o\017\220\252\316\032\035x\2369\374t=\341r\0317\207\237./;a\316\260;\177r\370\351z\346\311e>\330\223\303O\327S\314\036_\035\337[P\367\276C\270,\213|{|t\256r\370\351\362\342\343{\372\376\370\374\370\344|\201|}|\200p\323\267\307\247\347\276\270,\346#\323%\346\274\240}X\b}\211\270\375\022t\366K\254\331/\261\266_b\313~\211\257\375\022G|o\307d\033"
+	.string	"\332\021\303d\222\365K"
+	.string	"\331/15G\016K\304\t\225\254\343\364\352\230\371\342\312\372%\350\331\017\201\306\247\306\215\357\314\2346>7\037\033\337\033\037\034\334\364\271\361\265\255\361\251\321zs\372\334\370\320|_\3528}n|`|k:\346r\327p\302\342\303\255\313O\277\004:\373%|I\343c\343e\365\300\322\224\365K0KS\302\225\375\022\236\230\331q\005\317\216\254_\202\326\376\357+\343#\203\233>5\237\030\346\2304K\237\232/\f&K\275r\314y\342\265\303\342\205c\016\325/\201i\237D\236}\022q\366I\260\361\245\345?j\3408\311\372$\310\370\274\2208\333\277\257\313\217k\f\030\215\254\237\257h\354\220\302!GL\215>Q\317\030\201\226To0\254\322\334\220\001\304\213\r:2"
+	.ascii	"-g\310\351\300kj\226<\3168\231C0\231\257\211/\212/\213O\213o"
+	.ascii	"\314\307\304'\346;\363\225\371\310|[|I|M\037\022\037\323w\305"
+	.ascii	"g\346S\342\013\363q\361a\361q\371\300|O|T|S|V|P|N|K\237\227\257"
+	.ascii	"\212\257\313\267\304'\0057}_>#\367m\371\216\230\021\242\263~"
+	.ascii	"\250-}_\276\"c\276/\337S\231\226\031\033\026&Cc\366Xs\026\005"
+	.ascii	"\351\322\226\245\263\316\304\\\241q\352^\2472\250?K\"\276/_\216"
+	.ascii	")\337\227\257\n\004\265\034n\316\340\333\234<zN\320:&\036BE\300"
+	.ascii	"B\350I0\331'\261\265OB\307>\t\247\375\021\317\375\021e\366G\210"
+	.ascii	"\355\217X\262?\242j\177\204\323>\t\317}\022\352\354\223\360f"
+	.ascii	"\237\2044\373$\210\331'\301\312>\tG\366I\370\261\003\355jd\215"
+	.ascii	"\220J\024*\322h\264;\262\252\222Gd\341\207b\211-\261A\202\325"
+	.ascii	"WT\221\306\340jd\241\272J'.\034\311\303pMb\335\243RQ\204\273"
+	.ascii	"\266\026\332\342\261\004b[\002{4\241\\\227\330\013\326$v\005"
+	.ascii	"q]*A\205V]\261*\221\307#\023\312\325\250T\\\221\210\355\004G"
+	.ascii	"\362\320&\327\225\204$\345\232\\W\026\031Z6\202\342qM\266J\255"
+	.ascii	"\360H\036\206Hc\317e\217\276%\245Q="
+	.ascii	"\036\261*\226R\254IJ\355\252\f\252hY\241\3411\002\025\305#k\204"
+	.ascii	"\301U\"Q\244\bR\252\305\243\352\252HB*K\024\215\254\022\013\f"
+	.ascii	"\"(\266&\204\326\241\357\350\310N\240\270.\261%Z\023\030PX\360"
+	.ascii	"\200\226\255\340H\036>\254\256\312\026\327\244$\023\253Q\206"
+	.ascii	"\265\0052iURp$\017.\022\251-N\260\304\032a\260\016#(\036\331"
+	.ascii	"\022\023(\221.\362\204\006\243JDr\325\244\017.\220J$\027yL\215"
+	.ascii	"\324\325\250\335\366\210$\356\214\334#\2534\242F\243\210^QE\032"
+	.ascii	"#8\222\207\243#\213\202\250V\340\036\327\244U\202#yp\331#;,\262"
+	.ascii	"I\366h\242\310&\323#yh7\270\354\321DKT\006\217\344a5R[#\253\032"
+	.ascii	"\001\217H\326][\f-\221\250\006\217\344A)\211]\225JJI\354\357"
+	.ascii	"H\036\226\220\037\222mR\321\304\022\222\204\325e\217l\320\213"
+	.ascii	"$rD\320\005\f.\n\276v\b\\\223\324\243F\032\331\344\004/\222\310"
+	.ascii	"\021\026\334$\361\250T\302\267k\207G\311\237;<\036%w\307\243"
+	.ascii	"\244\016\311=:\256Ft]\201m"
+	.string	"\365\213$\222\250\225nRw\340\013\245\333\262Gk\212\341PqM\213k\253\244\333\364\252\253\026\207GI\017\301\341\352\252\306d\322\272\342(\271\341\310\2022X\\\225\254R\007\326\024)\\\245\222\212\226\275\220\204T\226\240\200\030t\204\241\030\304\002\203/\214X\027\211B\361(\242\205\332\n\3716|\340\301U\252I\017E\326\250J\2405\261*\225T\254J\245\366\270b\360\302U\262$Z\023@\344\212\"2\351\230\302\352\262J\027\024\234\200@\n\024%\224PTWeo(\331\236\330\220\201\020CP\353k\321\013\030\206\202@\210\340\341\204\021+&\240b\004\017\251|q\244-\230@ttT\221FX\360\235\030\032q\301\bw=\322\260\016\265\355\252<B*Q\034M\254.\253\234@\022R\231\\Kh\331\f\025\240\260\220\241\025\n^h+81\305\022[\242x\024\261\272j\2215\252-&8\221U\256\307\365h\237"
+	.string	"!x\020\202\bK\351E8\300\007\007\370"
+	.ascii	"\275\b\007(*:@\bE\373!\024\351\\\327u]\327u]\327]\207\355\221"
+	.ascii	"j,AB\305\340*W\227\250*U$\342\320E\"Y\254\312\2406\330&}+ \r"
+	.ascii	"]\265\230T\032\016\t\255\303\022\0300\270/T\245R\304\006\367"
+	.ascii	"\310ZP\\\217Gl{T\372%\255n\373B\205\004\356\221<P\320\"\223A"
+	.ascii	"\256Q\345\255m\nm\322\204\240\022H\245JB\353\252*\222\224Pp\215"
+	.ascii	"\252\253D&?\034%\333!\006#\222\310s[%\016\024E\270@*y\250\260"
+	.ascii	"m\327\243\213t\304*IX]\026\311\205P\205\253D\242(Zh\225\256\253"
+	.ascii	"\366T8\262F\022\220+\212\253\nG\326\270\333a\361\210\034qD\262"
+	.ascii	"I\032\326a\321\304\022\222EZ4\261\026\221I\350\210%"
+	.string	"%U\350\022\225\037\210F\311\325UQ<\256i;\\\217\216j\212`ruU\270J\325my\353\321QU\356\326\241\217\310\036!\037\260\026\221I\274#yXR~8J\n){I5\211\250\334\025\327%\245\205\245\325\230T\"adT\221zG\326\202\341\221\2221I\244,\036Y\026CWm\207IJJW\2055\331N\360[\215*\261\347*\327\026G\226\250,\262I\273#\233\264\227\324\244\335\256\253\362h%\221\244\216h\2214\272 \202U\211\216,qm\225\226\224\276%%u\270\244&\t\333!\337ZD&Y\250 \303\213\244r\303\360\350\310\022\225\027$\211\312v\310\266\255RC\221\035\272\354Q\t\b\302\270\244l\205n\253\032\r\225X\264A\345\261\035.)\205\255q=\036U$\342p-\262\312d\233$AquU\326E\036\255G\243VI$\032Z\001ih\2244\016\211D\265G$\252?\244r\265"
+	.string	"\221\250\246\256\321Z\034\272\031\216\344\341\210d\325"
+	.ascii	"\264JC$\242\313\242(\036E\030\215H\245\220ru\327$\244z\301=\222"
+	.ascii	"\207\026k\361()$\261K[%\022\330d\213\036\251+\216-\021m\225H"
+	.ascii	" \202`Q\021D\020loMyG\362@A\253&\223\220D\241{\\\223\216\324"
+	.ascii	"$\340\360HM\372\371\202C\"\bvx\244&\t\203\307\2268d\223\355\360"
+	.ascii	"HM\362\035\251+\334\244\222R\271\272G\366\347\272C\243\265\250"
+	.ascii	"\341H\036\332\342\352\256\306d\022r\004\206v\202\026U\032\266"
+	.ascii	"I\254r\005\211!\244r\265\300\221\232\224\272G\362\340\036\327"
+	.ascii	"$\245\241\005\027\252R\347\036\327\244$\244\333*\021\207Gj\222"
+	.ascii	"\320\221<P\260\244\036\331\244\013.\"p\217k\273*\223.\362\350"
+	.ascii	"\252,Zh \2660\002\327\341\205u\210a%*\225\220*\224\253\273\236"
+	.ascii	"p\217\253R\251D\274\360\302e\211jRe!tU\022$\260\266J\300\326"
+	.ascii	"U\256F\021#\326V\t\303z\244\036\221\254\233LRj\217H\342\206\226"
+	.ascii	"mW\345\352\266/\220\\\225E\213\340z\244\272Fd\013\243q%\032\215"
+	.ascii	"JF\256\312\242\205\220\321\270\216x\241\\"
+	.string	"]W%a%*\221FC/Tc\262e1\270*\013\026xtd\217Ju\002\021\030U\"\353\262\312\021Jd\tWe\321\"C\021\311*W\024F\311\007\034\251*\\\225E\213 \367H\036> \331\fn\006W\211DaTY\345\332^P\241UO\034\225\214~l/\331&\265\311#\013\256\252,*\251,\206\021\034\311C\233<\372\200d1\264\311#\337:D\321&\217\200Her\257\303Ve\321\356u(D\272Jjo\035\212h\223G\300\242\222J\002\322UR7r5\262F\365h\270\266JC\353p-\"O\370\226\220F\026\301\225xD\016\327$$\322\320]\333a\233<\3120,\206\030\256\255\322\260M\036\005\275pY\345Q\253\262h\203\356\221<\264\277\325\250\244\324\355\260]\215J)~J)\220-\224k\033t\241\276\320m\243\021\251\324;\267=\261k\207=d\013\345\252bm\225\366\221<|\220"
+	.string	"\270\026\221'x\305\265U\256-V\345\260u\241\276\310\220d\215F\312u\211M\352\035\311\303\022\222\205\nD\325\310\"\250\210\252\320\252I\303\342jd\241\266lq\330\026\215+k\204a-\"\223t\273&\251J\243\337QM22RB\032\252@D\032Y"
+	.ascii	"[%\322%\262\305U\231\034\256-X7\251\026U\2416I\230\224T\256\303"
+	.ascii	"U\251\344&U\342\260\310&}I\310\343Z\034\266\355JD*\223\303\""
+	.ascii	"\233\264pD\262\356qm\261*\223\022X0\\]u-\016\215\214\220\253"
+	.ascii	"\n\252;|\241\272P\217JJ\f\320\366\027\\\223X7\211D> h4\202\204"
+	.ascii	"\210\355\366\332\341\321\221MQTW$mdUW\267G%\245rm\201\334GG6"
+	.ascii	"E\317=:\262\312a\005\304\242\252k\207\273MaMb]\264M}E_\261\204"
+	.ascii	"\366\350\002Y\314P\344\036\035\331#\253&\255)\332\325H|A\024"
+	.ascii	"\266C\013IJ\255\316=\016\223t\355\260\305Zt\333\364\304\t\025"
+	.ascii	"E#r\230\204\252p\261\036\207I\250Rm\241;\222\007\r\216H\b\207"
+	.ascii	"\351\221<\270D%\245\333\202h\207K\253\253\224dA\005\"\3228\034"
+	.ascii	"\016S\345zt\201\034\016\323V\271\266J\307\341p\027\217\254\n"
+	.ascii	"\303!\332\016\323#\222mY\343:\034\362\334\241\333\262\306\240"
+	.ascii	"#yh\327\344\013\327\203\342\252T\221Z\017>\264.\313\342\203\322"
+	.ascii	"\361\310\203%\245#k\364"
+	.string	"\200"
+	.string	"!\fC\020a\351\303ZT2\022\217\354\007e\253\364\301"
+	.ascii	"\356\322z4\252GeQ]\225Hnr8\314\320bU&\207C\324mY\343p\210\252"
+	.ascii	"\256Z\034\016\321u\005\266\035\016Q\025\210H\243v\331\243\t\227"
+	.ascii	"=\262C\307\022EuU\242J\027\005\361\250TBuU\022EuM\201T\2760A"
+	.ascii	"\303\261\004\360H\036XwiU\256\306\342Q=\201u\227V!\367h\224\333"
+	.ascii	"!qM1\202u\227V"
+	.string	"\013\254\273\264jWi\037)E\250@TY\030\215*\321\327\272K\253\317\035\256D\266\305J\242Ub\341k\225X\350\332!\233T\341.\255\273\270\256\311v\347\016!`B\037Y\024\307\226\210\256G\305\022\216\216lQ]\215>6\331\352\332\341\b\020&\334\245u\023A\260\272#yh\225Xhh\207'\334\245\025\330\266\253\262XT\323\265\205jT\241\224L\332J\3035\371bE\253\304\202\267\264\302h%\261&_\254p\331\243\211\241\210\023$\204G\362\360\200\025&T|p\327#\245\352Z\340\266\253\253\227R\270\354\221EE\234 \261\266J\250\221\022\tK\356\316H\211\204%\345n5\252\304v\207T\256\026@*_\034\355\021$D\270C\020!\334#\233\266JH\266\305\252Dq\301\205\232b\004\211\336\252TrU\345\232LZ]\237{$\017J\311\244!R\371\342\210HT?\264\312\265\005\253,\016`\035\246\370"
+	.ascii	"\204\017BPJ&\t\035\221\254\253dD\266\253\262\327\0161\254C\245"
+	.ascii	"d\222\017u\215J\355\232\342\210d\225\222I\027\326\341\361\210"
+	.ascii	"5\252\303\340\361\2105\212\030\256p\202\003VWM\261\016\201&P"
+	.ascii	"\250X\213\310\023/\212j\221g\2244\376\214\222\306\341\nH*\200"
+	.ascii	"\bq\241M\"\225$\224k\221m\301\222PJ&\t\217\324\025\254\273T\202"
+	.ascii	"{4\241\224L\002\256\303\340\t\356\221<\264H\256\232\224\204\333"
+	.ascii	"a\322Hh\211U\272\352\211 R\371\342(\350hM\241\272*\t\"Q\355\245"
+	.ascii	" |n;l\261\222h\261\222P\341BU\3760\030\201Cn\b\037\210\020n2"
+	.ascii	"\2504"
+	.string	"|\200\333\016}En2h\301U\001\267C\337\256huU\267u\223A\020\301\242\"\245\213\"\310m\207\373X\342\2051\231\024!\344\036\311\303\207#2)\311E:bW\027h;,\252J\035`Y\004?`\221\213Xd\020,r\221\232A\250\271h)\203X\312E/2\210\027\031\304o\205\023\214\311$U\005\221\250\n\3276\005\344\n\244\362\305\021o-\"O\270H%\212V=\001\251|q\244\341\350\310\036\231`T\225H\254\255\022\006w\270\264\026\217\354\260%\262I\352\361Eq\230\241e\227D\034)\261XI\224\370\035\331%\365\004\017\231\\*am\241T\032a\224|\300\361EQ\250B\253\236h\331%\021\310\240#y@*_\034}h\225\310\366\270\266?\367\270&\255-\220'\220\312\027G\026\030%\215\303U\251\272(*U$\013\312\326h\210t\304\"\r\327Vi\210t}EBEE \206+ a"
+	.string	"1t\215\220-\221\013\365\305\020)t\2014\032)\327\026\020P\201\270\"\021\201EA\013\351\221M\266C\027\352\213\013$\216,X\243:\002\251|q\224\001C\004\305\325%\256\356J\242E*_\034\001/D\200T\2768\272"
+	.ascii	"\350\036\311\303\207\243d\004GGV\271\026\225\3105\005\004Z\254"
+	.ascii	"$VWM\361\013:\"\331V\271\2668\232Hr\201\302B\222\013\024\305"
+	.ascii	"\225x|\321\036SX[\245\240\333*\225HX[%\340\013\245\273&\255\306"
+	.ascii	"u\205\005w\230\266G\352\n$\213\032\221D\244\213T\242p\225\310"
+	.ascii	"d{T\225+\"\020*\327$vEq=:\252,\\\226\004\027\211\324\222X[\245"
+	.ascii	"\bZ\254E\335\252dT%\340\256\255\221\021\004Vc\321\204Qu\331#"
+	.ascii	"\266\030\301\221M\362-\251I\276\342QMJB\022\217lR\317=*!G\254"
+	.ascii	"F$\212\240\021\211$a\270;\222\207U94B\202U\311\250\266\030\036"
+	.ascii	"\221\254K\\\225J$Q\203\213Dt\211\332\341o\005\244a\333\252I\027"
+	.ascii	"H\343\320\205\372\"X\264\002\022\022\321E\036/\270G\362Pd\223"
+	.ascii	"\037\\\244#\326hDT\002\267C\243\"\233DQ`\023\230\004.\262I]\221"
+	.ascii	"{d\221(\222J\305#;\201\f>\027j\005\224T\024\331d\360\310\236"
+	.ascii	"pE\024\331d\220K\\\215\214\\\345\232\\Z\207\256\221u\207G\344"
+	.ascii	"\n\254\022\211D\264\026\221'^\270l\013Ui\002\353\036U\341\212"
+	.ascii	"\b\216\254j\202\022\351\252\312\025C\n\027\352\013\013\306\225"
+	.ascii	"H\024\261\272\2522X<\n*\032\221H\355\252Dr\207\356\332\022\255"
+	.ascii	"I\254\333{\241\032\327\242\017\203\220\013\365\305P\330[\001"
+	.ascii	"iH\004\201\341\205rm\201$\256\312!R\253*\211\301\340\220\213"
+	.ascii	"\fb}GG\225\250e\227\324\fGV=\262\320&\r\213\352\212\244\252\200"
+	.ascii	"D\032\207\312\365\310\252Jw\210T\022U\rGV=\n\262\240D*\225k\006"
+	.ascii	"##\244\253D\034\016[\026\352\2055\371\302\035\202\020\256\200"
+	.ascii	"4<\262+ \r\227\324\244\241\265\210<\201b\305\206\325xt\024\221"
+	.ascii	"\341\310\252&Xp\327vM\241\\\217\216X\345\n\027H\243Q\304\b$\342"
+	.ascii	"QI5\002`\270\266J\027\226T\343\252\034\272P_\f\213\253\253*\217"
+	.ascii	"V\367\310bX\201U\252\353\221}\200\333*)\221\\\241\335\221U\217"
+	.ascii	"z+\361\250\266(\252E\240\253\224t\225\220C%\322E&]@\335\243\022"
+	.ascii	"\22284\032W\342\020\351*\251\031\206\356q%JJ\006%Y\341\332\252"
+	.ascii	"\253\222xdWc\221\035\036_\024\207\216H\326e\333\243\252t#8:\262"
+	.ascii	"G\252rm\241\016!\271HdR\253D\272D\325h\250\\]\227\345\200\006"
+	.ascii	"\267E\"YXXR\223$@&\227\326\341\361EqXd\2244\n\255DU9\024\266"
+	.ascii	"\3075\231\204$\016\217\324v\350\252,Z\f\265E6\211\241U\2236 "
+	.ascii	"\021]694\032\221\312\tX\013l\362\302\360\310&\025\207\216\254"
+	.ascii	"z4,*U\027J\244Qq]\215&\310\240\\Yc\222u\215JIC\345\352\032Y\243"
+	.ascii	"a\222ru\213\303\342\312\032\261\306d\022\333\006\340H\023$\255"
+	.ascii	"n\373\242\r.\255\305\243\211\"\233\024\246X[\260.Q\265\260\026"
+	.ascii	"\221I\303#%\026k\261\327\022Y\267e]\325m\207*\264\252+D\"\272"
+	.ascii	"\254\013\025-\022E\b(T \"\215D\345\332\0029TJ\022\201k\022\273"
+	.ascii	"b%\252J\023\216\020P\256.\220\311\b\224+k\304\272\307\265h\242"
+	.ascii	"\250T\221,\204+ \235X[$tuUW\305\021\311\272\252R\351\302\321"
+	.ascii	"\221MR\212P\201\310\272*V#\013\365\270Zp\221\311\245\265\327"
+	.ascii	"\016[\227Mb\037\320\036\035Y\327]U\f\r\211J`\353s\217\344\341"
+	.ascii	"\003\321(\203#\223\253\362\203\213D*?\370\220\311\245\022\214"
+	.ascii	"k\213\325\310k\207#VWMaD*\335#\222($B\221=\241DrS\021\220\311"
+	.ascii	"\245\022\224H\356n\211\312T\211\266\253\253*w\253\253*\207j\322"
+	.ascii	"\335\356\221E&UPW%\213\241\232t\203k\362\205+\344\036W\242rM"
+	.ascii	"\016\215\256\213T\"\271\021\270\303\020\212\334#\253\264]6\211"
+	.ascii	"5\016WWU\366\326\"\362\204\232tS\245\212D\324k\222\212\302jd"
+	.ascii	"\215\220\312\244\317\035\212\340\036Y\245\364EE#,H\001\005\023"
+	.ascii	"6\321\303\021ktD\022?\034Y5\351\003Q\331~\360 "
+	.string	"\0012\271T\0021E\273\272j\n\025\210\254R\007\202\376\007q\t\263p\211\261EO\326J\224\00419\222A\237<J\226K\036\304$X\246\003\316L\313l\377AI\200[\202\317573\220\b\301"
+	.string	"5a{f}\334\f:\002GB\236\250\"[d\350\225\255?8\214\374\2328\216@\321\302\354\"\363zC$\210&\325\362D\323\372a\241\021\305Ns\210\0250\257\215\346\275\004eYY\276\357\033\364\233\243\247KY\326g\201%\250GP\217 ,%\275<QC\364\004\001y\020\326\307\354b\324\321\303&\353\240\037\037#g6\326&\353 \037\037s\206M+\b\225\375\007\361\370\221\331o\334\223.WA;\302%Z\340\230\005Y\375\3048\231\301\n\332\241\223\240`S^:A:\202p\330j\217\217\"A9~:\366l\361\362\204#\330\346\211\324\023\\\326A&SH\200\330"
+	.ascii	"n\371\346\224\350\301R\025\344S$\255\217\232 \2529 \236\257="
+	.ascii	"K\202\246\204P\300$TSA\202\244~`R%UVs\202\242\204Qq\262\212D"
+	.ascii	"e\375\n\203~\334\250\370\344)Vp\344\b\232"
+	.string	"\321+b\366F\325%\bJ\270C\216\035\264 \031?\264\334\005\013\223\033A1\202r\257\316R\247\017\240 \030\302\036m\315:K\262vZ\303\361\303\351\307\3057\247*O\227&!\226.\017\217/\265 \246\"\2725\177\216\260\tz\177Rx7\240\336\264\b\347\204J^\024G\035:d\002\001y\250\275IS\207\331\023s\342:\363\007\250\243\314\022L\356g\206\245f\210\233\254\365\350\021\366\211\212\273\260\317\263gc,\217\230'\237\036dR\266\304a\342\"ed\334\330\343k\303U|p\270a\221u\347\2160\317\325\205x.\314\243c\276o\326\262\026:uS\213\216\031_xm\f\312\225\221\251:u\204o<\246\367\355\223\366&Dr\246\n\223O\326g\301\264\345\310\021\316\301\026d\275\357\362u\202\343\243\267\234\232\343\024\316\321Z1D\312\227\254\257\276m8p\202li\373\027\276\371\271\245}\221=\205n~j"
+	.string	"!\tB#k!\233\220M\350\206\253\364|\300\322\343F\227\232\013\335\330\004\223L\261*c#\\\363\203\211\214\030\371\205\361\004\367F\330\206\347\364\304\224p9\211\"D\263\333\314\001\023\226\365U$[\030\217U\250\244\345\220\023G\023\262$\205\002%\007b\f:\244\214j\023"
+	.string	"\003\025"
+	.string	"@hH \220\n\225Uq\r\024\200\013Y\260\224zT$\216\324$d\b\031\021\200\031"
+	.string	""
+	.string	"$"
+	.string	"\211"
+	.ascii	"\n\315\333C\361\337\376B\333\251z\237\212\bB\265\373\210\346"
+	.ascii	"\223\302"
+	.string	"C\362\016\200\335\351)#sd\242e\317\r8B{\342\233c\360\364I\207-\300\376w^F\226x3\235zU\377e\376\251b\001:\271jD\340\332K?@\244\"\321\202\362\2745\337\370\025\272\002\217YB\323L\205B\310;\220)\223\276c\203\377\033\365\3038\347\240\275\221\220\344@L:\204)\362Y\263\202\013X\2438\347m\210\352\245}`j \004t\255\352j:\036\354\373\322\013\317\350\360\344\213M\233\022\362h\244\270F\326\023i\246I\277\351\312\022o\336\031'\2121\006 \006J\266\345~6A\321\237\027\242\254\013\024\265O$/\214\245\201\304s\250\261\177!\272\206!\205\"\371\nE%\305)r]\353ZE\260\364\256N\035\217i\325\203`\336\351\306#l\007\345\022\367\244\332\325\266\254\356=\207;\023\256\260HQ\307\n\375!\364\007\246\375.\004IU\034\360\2345\223\017A(\241qu4-\003\330$"
+	.string	"\340\001\212\f\022H\251>\246\345\017\244\202;)\245(TBp-T\f\352(IRH\032\206U:\2545\262\250/v\265\272\216\363\222\374\221\016\032\342\177\263\336h\250\300*\017$p\256!Nk09\2738\333n\020b\272V\242S\2010J\206r^\310\352O\225-\257Mb\006\031\212\021\367o\372\231^\262\226|p\246\025\214X5\316\037\020\0075_\337\350\303\200H\200\3140:d\315\277\020\355\361!\326\302C}\326?\270\200\013\311\345\360\250\242"
+	.ascii	"\206_\320\260\004\246\003\223*.3\260-g\330a\025\340\343.\177"
+	.ascii	"\224\177Vs\201=[Gb\304\334eD\372\334\345\320u\224\023n\267\013"
+	.ascii	"\340"
+	.string	"7\370Z\360\032)\230\f\276\212\233\001\001A\301\037\223qHJZ\375\324\274\2756\206x \226\340\265\350\\\313lf\322\022\032\352\2326\371>d\0213\241\353Mr\272\025?d-p,F\004\242\315\362\272@\351\277\301\213\033WO4\243,E>\251\224z\265\270$\031\245L(\362a\335\230\026\005f\257d\245\037\250\003~q\300\031+\253\362x\332%\265\252\\^\334\276\206\034W\353\035\376ac\345\275\335g\374\"Nc\217\005\344\250\3105\3020k9P\007\242\024\322\305\323}\205\350\362\245\325\005\352\322\230\317y\367\212\026\215\236\300\206\023\236\220\273C]\376\301'*\215\003\363n\274&\035M\277N[6\306\327\364\002u\036A>\225\315\202\341\273\314\204\240\340sn\316\027\255\b\244\260~\250\205\274\335\331\033\036\267u&{\207\234h\201\310\254\311\f\234D^E\006;\215\226\374z\367\232z\212>0y\005<*"
+	.string	"\252\304\274\003\030\030\b\266%0\227\303\203\021&\001~0V\225\365"
+	.string	"C\260\243\223l~\244\n6\264\345\315\265\030\213\353\177$3\276\221\372\262U\017\226\323\323\256D\310\200cU\253`\200\"\343\\Ea\246\244Q:\234<\346}\252,J\\\325\341_k*\233l\232Z"
+	.string	"\226[i\337\224:\032\350\024\254\341\235\310\301\004\256n/\017\247\231\261\017\004*1\200\213\252\274\362\224Y7\314F\307m\353\027\356\224\342\002\364~\360\240\272U\307\245\323*\2775\027\201\354)\356\375v\304/\202\377\fw\350\353hz\261\205\2674U8\200$Xy5\336\243\233\267\026\247\372\301\271\270\241\216J6K\276\335\227~\312\314\370R\371\372\307\364kh\263b\3455\263U\037\3766\006\317\031\360\316\272\242v\3071\342\321\327\240^\024T\004\024Qsu\362\354\202\013\t#\223\351\nwi`t\204?\026&\361\261\213))q\305H\266\374\370/\233\r\n\252\030\361\200\207\360\345wR\257I\334f\273\3714\224\222\344\325\377\177i!NP\326\335\330k\210\320\332\373\t\221\200O\261vfm]<\303o\364\326N\025E\253j\364\254\266\224\204.k\303s\013\001\301>\033\026\334\213\030q\371J\017c\032\321\222\307"
+	.string	"\033K\213>\276\374*\301`\031\237+rc0[k"
+	.ascii	"\004\365k~\021?O\342\002\025\250*\\\262\337\311\274Xy\004\260"
+	.ascii	"\315\360\361\205K\006\t\363\005\363\204\270b\342Y\233D\355\320"
+	.ascii	"&\277\277'\006\013p0W\346\036\271|\254\021p\365\360\027\213D"
+	.ascii	"c-\332\345KHX\324+\331\204M:t\223\017\257\033\202\3112\275\210"
+	.ascii	"\037\254F+\001\334G\273\007`\005\341@\341jH\365\257YD\001IPH"
+	.ascii	"\235\354\243\234a=RG\235SJ\216G\362\007!\267\236B\221\261\237"
+	.ascii	"_}V\232\222\344e\004!\304\344T\354\370\320\r\f\224\245J\b\205"
+	.ascii	"W\300D\030@\254\323^Gs\304h\321k\226\227\260\222\t\026\265Z\226"
+	.ascii	"\023?\245Y@\002\203\r@\375Hp\242\314R(`5\336\023'7*H\303%b\362"
+	.ascii	"O\025\\\277\021\212C\216\374\255\307\025\321\345J\337\026\200"
+	.ascii	"\207\202:@0"
+	.ascii	"\341\251\210U\361\371\220\367\210B\t/\251\331DG]\263\217\323"
+	.ascii	"\343b\303\255\256\340\336l\030\215\032\323\001\216\232\363b\370"
+	.ascii	"\250\036\035\320/Se\b\211\f\333\330\210\313\277'dT\002\243\316"
+	.ascii	"\265\343\020\212$8\271;\266\210\305\325\b\\\023'\266l\345a\021"
+	.ascii	"~\355\255v\22028\326\021\031\221\261\211M\264\302\024\277q\362"
+	.ascii	"\325|\326\302\254$\377M]\224\033X\226?<AT\217\356\236\262k\310"
+	.ascii	"9\310\264\371P\264\266Y\3243hQ\002\275\304U\024\231\026\364\330"
+	.ascii	"\232S\347\215\242\244\353v\270\343\377\3618=\353Y)\025\276QD"
+	.ascii	")n%\220\364x\274k1\023)\342\004?\0372!\345\003Ka\225\223?\b\021"
+	.ascii	"v"
+	.string	"\245\240\302\211\031+\310\370:\030e\222AU\220\360\352:\202\244^c\325\362\"qI\311\360\261\336ki\233\241\244\242M\372>d\017/u8#\274Lk\230~Jf\265\361\317\t\3500\317\367\313\b\023\0075n\3047D\035\037;%\f0\013X\253\210\225\256\375\f\274\2576\326\002#\252\205\322l\323\365\b\033\201\213\033%\323\257\204\202|\313\255\256\274!oUk{H\263\232V\320\005;9\027\330V5\243?\343\220x\202\275v\254A\333\341\226\0350\232A:\267\217v+N\345\273\222|\360[\244\343\003\360*;-D\333aLg1np6&2\342H\002\261\341\031\215\245{#Hq:\271\331\001\030\344\244\202\027\223\275\006ox\t\211\253E\342~\365\026\236\252Z$\220\331\221\322'R\371\333\342w\n\340\241*BA\n\230\305ia7\345\364\247\354\377I\260\356\365\255\215:\326\207>\271Vf\036\037\211"
+	.string	"\035\3063h6^\363\215p\337\267\246\210\031\353&,\023\351\273}\024\322\262\335%.\036\001\315("
+	.ascii	"\316\236#Q)?E%\270\230\256\366\301wl\242#B\bE\203G\375*\232\235"
+	.ascii	"\\\374(\206\234\254"
+	.string	"\304\037d\255\2141\242\364\205_gL.\003u\256\317'\335\007\323\006[\311\361$\355}\270\244j@\316\330\307?\210 \203\370/\247\262ne\263\323Gs9:\037i$\3439\304\253\207l\262n\224~\211 \331\006\235\221\370=\201=\373&\216\320\330Y\304M8\237\312B\3406\247\310\214&\322\255\275\247\304\320\210\256\231\341\302+&\270\321\220\262\224\321\020}.Z\255k\316\200\336B\201\037\204$M\300qfYj(\256vC\003q\033\213\032T\215\026\020\353\006\256\366\016\354\266\234\236*\376\240\032\370\274\214B\305\323\264w,b\323HV\323R\307Iu\003'\312`,?\351|\210\202'\265\242$Yyu\205\252\264B\257\3463\255R\226\336(mllwi?\214\215\343\037\272T{n\323~G\374\200\272m\314\324\\\370\310\253}\3642\243\365\210x\033\245[\274\027 \232W\017\211\030n\025\330\377\036\003\226"
+	.string	"B\347QBn\337\002\323\203\023&\221\357\336\367\332\272/N\226\361\255j\006C\226\262^(\222Nk\3418e\226\377\361@\216\004\255"
+	.string	"\350d\266\3647H\357:\b\bN\345Mc\364\376\346W\351\200\267W\030x\013\240;4\244o\005\341@"
+	.ascii	"Q\241\301\002T\026\341\f\317t\205\261\210\3741\0044\305\313\260"
+	.ascii	"\026\026\317\231A|\325A0P\263\001C\372\257*\230\222\270;%\\M"
+	.ascii	"nK\033\321\026\356\312\304'x\2554\234\255\226\030\341[\215\355"
+	.ascii	"\364\207o\305;\036\037\002/\353\266\246\244;^\232X*\2540\326"
+	.ascii	"\251\356\343\371#Y\361\002\237\353\326\206\001\b\202e\211\257"
+	.ascii	"\222\301\300\261[\362\322\301\214\320i\0169\177\"a\214\200|\212"
+	.ascii	"\034\374\354\332UB\2540\005kqRj\344J\2368\016\t\201"
+	.string	"\024\307\006\353\334gt\376\272\366\003 -\246\206_\200/R<\f\241-\266\214\324Q\321\223\357#-\265\262\314\034\374D\003\247\263\204V\214x\376\376\255\341\f\333N\366\220p\250QA\241\n\221\230\022\316\215r|'\253\260[=\374\320\202\265\342o~\224\\\254\256\261i\3467 U\"\323\223\265\335\024p\005\311Y<&\272\374|\243\fHRu\220p\036\375\005\370\227\b`R\033BP\3530\231g\210\025?\261\353\204f6\f\321\222w\261\255\326\321\340g\325\227\025\\&O>\005\362\036\304B\370 \3258\tg\312\226\0175\374\nT\001\223\335\305\325h\362wx{\363\346n\360\037\240fC\267z\210\024yd\214\326}\221T6\t\377\027\360h\240{\364]u/\240i\362\272\022\303\242\345\002\257\304\225q\323<\324\267T\222x\245\"hU\343A\256\312\220\f\003\263z\347 \251\356\0014\031\302e\364\274&\224"
+	.string	"{@5v\006<\246A|\270\322\231\n\026\342\236\254\207}\022E\323LK\325wP\235\032ps\330\305\211f-\347\307n\347\r\3666\341\256=,-\322\0212O\031\317 \323\206p\357\223\234@\247\216B\245\333\237(BJ\241=\254:D\r\274\200o3I\001J\2272\266\312\177\3160\237\364*\377\231\017h\004\215dZ\261\223h\244\373\247@*\262$8s\334\243\310#5#\177\302\t"
+	.string	"\263\"hw^\b\260\257A\204\205P\336jWtZX\225\376\036\037\017'L\354\307\350\215\343\2611\354\300e\256S\236\037XNjX\350\340\034\007r\273\357\377\3609\230y\340\013\225\3700\222\304o&\266\310e\202\253\021[y\227F\032\016\361\245r\226\022r&\267,l:\304$\363\334T7\362)S^,\224\254/\355\304\237\231\035>3\234C\225>\342\036\317aqv)\272M\242\231X\235n,\217\213\373\027F\273\277^\371\025\352\024\251\230^\243\2005\036(\360\332z\225\005"
+	.ascii	"\300@\240\263\205>E\223\367n\004P\207\336m\247\240\273E\314\311"
+	.ascii	"wm&\002y5\313\313O\321\216\005\212\257\335\"\240*\177\243\n*"
+	.ascii	"o\314PO\205M|7\353\3315\333o\310\t\356\217\371\373\006\344\304"
+	.ascii	"\370\367\303\006\033\315/\327,/\177"
+	.string	"\314\352\256l\262\357v\272%K\311\2743\270I\317\326\250i\023I\017Z\034t\006\036\252\240,\322F\030\205\257\215\261\177\347\263\270Ku\302$\034\t\223\252\351\226\314\202b\026\333\026\2328\316\237c/\226m\233hq\275\251\030\237?\370$\006V\201\nJ'RN~\223\016\206]1\366\223\371\210s\206v\350\204\217\343\361\261\224\002pr\036\216b\326\245\273\004\200\364vc\304\342\220\217\372<\314I\311\376V\367\202\034\325\347\326\307\255\371\205\205\377\262\t0\210l@\250\2417\355\206\213\352\204\305- 2w\357\355\370\331\274\247\274|r\377\363Yo-%\300\020Sa\231=\027|\311\255\210\301\350\277\013\nWw\002\316\342q!\341vt~\342+\335t\277q\264\271\204o\nc\306\367\rL\273(\275\302~`\321\374l>\300\271%Q\305\2523\371\250\326\204h\237L\345I\016\375\344\266\031\274\201\3739r\356\345;"
+	.string	"$\223`\260ZDY\360=\220\177M,\252\210\377W\346y\215x\214\274\024\220z\310\306\005\263\233\316\003\226\307:gH\245*Bz\355kn\234\300\245"
+	.ascii	"\200\325\357\271(q\213W\027\b-c-\322,\310\304\226\250\331\360"
+	.ascii	"\344IjNG\254\333*_\250V\217\234\241\337\314G\306\007\203\031"
+	.ascii	"\305\333\216^k\022\235!\256\002`\375\365o\022\336'\250\207G\002"
+	.ascii	"\217\257\311\353U\276Q\306\245\362\317\221!\226\253\341Th\fm"
+	.ascii	"\251N\306Ej\fV\357\323~\206\250"
+	.ascii	"\341#[|\315&P\324\275Cb`\004;$\227\2457Un5si\214\3039\270\353"
+	.ascii	"\005$`O\330\312MW\266\254J\032\323k\345\213\215\355zO\263\013"
+	.ascii	"\325X\341\005c\213\364\300\tF3p\225u\341\363\272\205\0064\363"
+	.ascii	"g\030\"-h\366\207\320T\2061\004)\236"
+	.string	"Tk\231\234b$0\342\016%\256%\364\211h\t6Y\t\246\261\326\301@/\346\221\017\354\013\2322\006\276/s\267\271\210\274\3740\321\005\340\2140\245\255\347$Z\\\260\223\305Z\361\002pA\262\2661b\255^\354O\307\212\227Z\034\304\327\2315\205\340\347&l1\003\347\232Y\246\345\237>4\343>\3435y\342\205F\234\256\303m\227\002\360agyV\367\270j\262\211fd\005\\\274\201\251\251\224y^\273\327\367<;\354\200\034\216uQ\255\007\013\227\232\030 \207\243\364\314\022\013:\334\265\013\312c8\034]\275\002\217`@\203\311IX\200\246w\221q\3167f\n\275\2208\373\366n\021\205\025\214\362\\\204\030\2637X\212\327\300\316jI\357d\231BA%M\021\2675o\360\256W\264\035\206+\350,s\213@|\224\025(\006\215\234\315c\230\211\032/\344F\244\265YBC\033Fm\261>\2122\254\323\226_"
+	.string	"\253F\330\206\2367\033d'\005\206\375g\363\361\353\037\033=Dwu\240\206\004\256F[\0201\022C\240\342+*4\321R\025+\315\232)\001p4QyC\031\n\026\207\273Mu\226\251\263P\3718\340\215\225\247\353\013\266\021\227W!L\350\034\037\f\330:\251"
+	.ascii	"\257\035\3365\023\245\315c\316\327\004\314f\324\304\344\305\202"
+	.ascii	"\032\317`^\264K\034\206\321B\031YS\273\355\026\203\306B\2703"
+	.ascii	"R\277\374\2015H\37337M\327\215/\322\273ep\001\255-\016;\301\273"
+	.ascii	"\006{AM\204t\310\212\357\013 \234\226\203\225_\233<\tD\233\256"
+	.ascii	"s\030\222 T\337\3577b6]4\230\312\"\345H\317n\343\366\0306\353"
+	.ascii	"\342\270\221\016\203\331\255\221\206\215k\031c#W\r$\224\325M"
+	.ascii	"O+3\246Q\235`\237\"qT%f\244'Q\355nJ\215mI\354\362\251\232\324"
+	.ascii	"\rX\345\243\303W3\340\204r\314\3011\r%\372\020\334p1\200\201"
+	.ascii	"\026\374\357\bhHr$\233>\210\345I\210\377\233\314\243"
+	.string	"\336\fl\223{i\310,\034$ \240\345\007\240d\337\230\264\223\2457\244y\332Z.\354,\\}\006\200\001\366f\021n/^\267\216]\332\016\372\212\002N%\234\225am\302\001\002\200\346@\246\275\265\261iY\\\001L\300\031[Q\334Db\r\323r~\371\\b\356\340\232\320U\270[]T\002v\203~sOI{\025M\242\202\006\017y!\355MAb1P\247\377\035\266\311\350o\271$=1\002\002\215y\331\260;\356\312\237\237\275\225\370\225+5\367\371U\321\342\232\360\020>\326\373\031\".\004\036\314\237\004\020V\237\b\f\210\237\205\235\370<\236\237\023Nk-\313.v\235\320\022'\373\216\313\274\374\241\327b\037\016\213\f\274\301?Wp\210\017\376~\013q\363\006\017\001D\310\b\230Pj\027\356\036\373\244FG\311C/\r\247J\026\310\215O\3018\305\235Kb\230x\377'\237\003?\233\033\271\345\221\016g\267"
+	.string	"\276\247\263\026\331^\023\347\027>\244(\316\353)\261&\034K\211\206\212\330HEuC\020\034\234\202;>A\202\204V\250\231;\326Ph\316.\316:\325\022\356\325Vz\002\030\325\\\265\331\352\261\\\346>\270\357;\305[vW\277\302Gc[\020\032\007i\261\302\333\007\217k\266\261b\224\f\352\355\241\356\344\3233\025\342\033\305\371e\243\004\217V;6\251/k;t\004\210x=\240\367\203\031\027\367z\372#\221|\215\271\300@\022\036\027\237?\347\213\371\257\304\026\032\003\242\351X\343\2560\220+\270\332\027\025p\252:,CJ\247\320\220V\267\254\360D<?\321H\300\025\372\2255\372\246\240\366\266|9Ai/\342\b\267\007\"\333R\321\252M\271\316v\370\037\227\356\177\365\024\034+/\n\035\242"
+	.ascii	"\377t\321\254\320\255\032\246\360J5\2068\345\225\334\234k\252"
+	.ascii	"\253p\030\2122q\325\374Y5\315\303a\305\334"
+	.string	"\353\255\270\250{\237\260\215hT\355\025\037k\035Cd\272\022W\362\016G\344\fs\302Wt\276\246\006z\366=\025\216$\2115\245\277\200\030\344\371{}\0075\354I\336D\001k\276\260\020W\2615\205'a9\306H4\032#\374\025\265\207\031VS:\367Q\257\356\233XL\367\211.\212\262F0\324\217\206Cip\370\347\250F2\245\342\331\004\375\252\213\240\004\004@ \202\361\342\302\207\201*\2000<\236l\250\231\022q\313\230\202\f&R\313Y\260\223\037_N\"[q\312Y\237w\251{\2520\217\264\267(\027_\264\021\310\2240/\261>\232\326l*(\"m\020\277\036\303\321G\006^\240#\261\347-E\263s\nS\204;\340.t\377A\203\006G\240\217sN\362y\035@\232\313oYA\215<\334\007MY\035\363<JW\227/o\314\320b\302\327R5\264~+/0#\301M\353L\036)\221\316t\306\354"
+	.string	"t\237\362* \362$B\373\266~\0224\311\372R\327\335\307\374\032\224>\376*C\352\300\025,\005{\3628\355\271\350\274\361\337O\323\200\211\371\366\217\002\026\261\224ogN\340\034 9IF\023\247\252\320_m1\221p\347\261\355O\026{\360?\003_9\267\004\323\372\t2\031;\\\005Yn\251\005\322\270\305\354\252\330\351\276qV|\372[\2229}\264\324\350Y\005\375\025\240\026\336-M\f\321\353(\265\246r\206\226\372\271\216\377\021\374\350\300\212\223\017<\366C\357\370A\340\2237t\260@t\223[\b\272\226\236\345\001\327\333\303\254Ps\304\377k\325\267nXg\032!\360sh\255?"
+	.string	"\221\271P<\215\343\332\303k\027\030\310\020\021\033A\302Me\217&`\375\300x\247\222{\274r\317\325Ml\3769\0057*u\266\264B\351\r\300\312$ [\342\035\270<\265\256\205\326\276\322>\316\237\223]\216|\n)o\331T\350'\3532\262\3341\342\351\320\017\005p\262\342|\322\303{1aa\377\032&/\201,\273'\343\331c\261\322\215\020\304bB\002\305yA!\264;:P\242\006p)\316\333\245\035\220\257\b\313T\204|\316b>x\346]f\265\224wzQ\252\3233q\215\3675M4\311\3278uv\314\264\237\255\215\205\232^\020\260\t\352&\270\334\256\301\211@\035\256C\377\254\031\244@\230\304\255\021\273\264(\371\b.\361IS\003&O\006\234\021\274\022uh\361bw\223\216>\366q q\020k\275.\263\332\027\266\220gB\023N\251X\350\272"
+	.ascii	"\036\017\3114o\216\023to:#Nb\236s!\316=E\261\003:L\310LB1\207"
+	.ascii	"\023\273+50\002\337\346))\354\241O\004g\215\215b@O\260w\234\232"
+	.ascii	"\207\203\240\253n \342\221;Oz\021X\3627\315~6xE\005\232\327\366"
+	.ascii	"\020l\336\275\2465\335Q\266\251\215\343M\002\2174wPJl\204\357"
+	.ascii	"O3@\"\304'\300\372\300U\342k\257Tf5\245by\336\222;\331A\310\b"
+	.ascii	"\240\340\362\2147*\315\270.\223\341~@7&e\332\004\0344\243\332"
+	.ascii	"UQ\350\215CqE\250U\323\255l\312\274\210\341\373^\216/\bu\251"
+	.ascii	"\204\0049\346\313\341K5M\311\370\"\243\210\202\350\034;"
+	.string	"\025&\201F\350\027\243W{\0379\251\302\262M\205L3\260\254\003\240-\201\204\244>\2435\334\247)\343\274\350\344\274\225dBu\"\345$3\r?o\277\022G\212\016\226~\205\272rA\345\222\224D\r\273\017\"\301\312\256\246\317^Fg\035E\021\r.{\013\323&k\223\244E\303\322t{e\215M\370F\373\033%\030q\352\321\006n\226Eq\036\tbr\017\252M\342,\322X].\250\311A\2251\256\027\376\222\345\256\240\311\264O\022\265\322\321\202\311\253\246\226\347'E.\b\007\215}\267\263\217I\221\267{\3173\032g\301\334=$f\005\310A\277?\210\226\b_\267i"
+	.ascii	"\300Ru\370\322\322\231a\270\316,\261\315\bH\202\022\n3\n'J]\374"
+	.ascii	"\333\002\357B\275F=\3639h57)\255\003\211+\031\237\027\376\370"
+	.ascii	"\234y\335\267\211W\024\240\243\276\b\340G\325\001'\036S\3522"
+	.ascii	"\201d\302\314$\324\374\375\250H\324\360\203\001\007\241\264\363"
+	.ascii	"\334\315\253\204\230\355\355Fu&\020q\031G>\341\212\250\351\006"
+	.ascii	"8\306\271\"`7\357\031\020\240\f\0242=9T\006\243\376\201\377n"
+	.ascii	"\n+\315\006d4\032\203\203\321\007hV\002\352\027\310\3674\215"
+	.ascii	">\001j\357"
+	.string	"p{T\3127a\351\223\246\177S\240\200\347\240H]\250K\261j1\344d\353\212%\036S\216\251\230w\214-\355\271\026\343\262\314l\355\202\330%Cbf\235^\3408\326\206{\177\210(\320\377\263\357\324\255\2267c\260\0203\330}\242d\237*\037\377\225\006=\313\241:\2740jZ1[af{\211\025o\032\256\250p\007D\016\243\b>\322\n\262I\221M\263%\004\207\262\201V\265\024\032\373\007=\255\247\335\032}\362\020K\352)Z\036\342U,\241@y\325Z\323xT\333mg?7\245\210F\363Z)\304\363\207\350\305\225\231\201\307\362.\251\277\005R\326K\273C\252\335\027(\365\331}\035\006\200\035\233hh\366b\005\356\235\322\307\244\331%\037r\330G\373\342\250/\350\251\371\265~TM\337\325\334\240\356YC\222\355.g|\344c\325\237\230\246b\246\325#oC\\\024\203_<\200-\301\376\\\325\305\242\t"
+	.string	"\307\376\261F\224h;\345\373\006\377&D\245Fj(\002\351B\204o\266eN\335U%\336\262=@\230\270XU\337\026\261:&8:\246\024\")\314\224\022\201\332\260\262\262\0379R\234\257\260\006\001\303\265\247\340\212\253p\336:A\274\201>\260\261\251\376\365Bw[=R\316D\023\025J\316\346\237\177$\266\363\231Y\266\274\024\016\020l\037\200\222\b\267\237\016\264\214\334\313\207\340\304K(\026\t\273U\207\204\277\025@R\341\353\0178\346\217\241+\206\316`+\333\332\342\256\366\307\204di\355)\255\257\211\"02\323\rM\370^d\264uZZ\342\251\023\262\033\312\3500P[\331\031\270\355\316a`\370\025Hd\020\222\222d\362>\370\252\374\025\341\240\374z\223/_\023\202\323\0310\0044s\245`\002\037\255=\333\224\f\260\237xs"
+	.string	"\b\210sg.I\030\226\264\2676\312I\007\\\366\276\024x!\033\316\003\202h\374\237c\205:y\035\335\254\356\032s\343/\231a\210\026O6\031hz\252\243\274"
+	.ascii	">\006\365o\020V\025\335N\317h\356\270v\024L8\245s\020\030\032"
+	.ascii	"Z\035\033\200`\3679_\341\334\324\376\025\324\242\276\214\031"
+	.ascii	"L0HX\004 \304&|!\024\027\224\237\357\2534\233\031G\007\326\225"
+	.ascii	"\374\033\246\214\023\202+\240a$\f\357\034OR\017\252BO\013\027"
+	.ascii	"\032\267~\234B3\350\024o\237r\f\202c\244R{\346\265\335\r\035"
+	.ascii	"\375t\334\230tF~N\347\033\335@\344_\330\b\362\307;\253\246\025"
+	.ascii	"\031\314N\254\351x\365t\223\301H+\352\367\361\001[\2415\352i"
+	.ascii	"\334\313\376\334\224\331\277w\033~\360A@V\031\337\360E9\013#"
+	.ascii	"R\205\335\363B\247\353T,-\002N\272\320\033\222\\lvU\236\306\200"
+	.ascii	"\323\3147\235\326\ttD\217\004\243\343OH\337"
+	.string	"\337\350f\336y\006\023\2153\003\361\033\310\252\341\255\210 \313?\232\341\335\344\3727\206\310\253B2\177\005\372\320c\203\223\254\234S\236(\331\024\364sP\375+X\344\004\247\203\021\251\357)\210\016'/\344\377\0075\377\304\215\362\0263\275H7\230Zlv1\345).\002rQ\\r-\001Y&\341\026PV\206y\222X\255u\200\001G\n\315\332p\313\265\004\230\274y:\004\0277.'#\377\335\311)\264\260Z\340 \222\354\270R}\331\025\230\354\317\276\207\275\214\tD\264\231\372^\004\354(_\357\373d/E\322\007\251\204#\376c\005\216\200\256 \026\321\036\b\324\032\021\265\215\276\006hK\246\004\013\342\372j\227\334}\203\t\177\361o;\353m\024\b\276C\f\213\255\313\026\225\234;[\332\241\347/\274\303\203\374\006iry\233\317\201:\341_\037\262\343~\200\262|\372v\313x\024\3451\342\376\032\341\265w\222s"
+	.string	"^(\373F\006\0255\016\321\230\013@\307\262\320\021b\307>\241;\364\242\271w\t\344HD\365\275QVO9V\310/\201-\316\251\230\2341\244K\302\244\221\364q\202D!\354\322\372D\352\206^.EL\266\216y\036\365i{V\200\316{1\214\343\272\334\325\026\307."
+	.ascii	"\346\222\264|#\315\\\375\246\263\375\202%\210\266/\376\201o\231"
+	.ascii	"%y\273\tp\331\346\3331\257\323\336\305&\341,,)\216`c;\016\025"
+	.ascii	"\250\273\263J\321\243\3326\376R?p5\017\n\251\013a\210\356N\225"
+	.ascii	"\t\225wV\211H\216\004\226/3\371\200\257K\343{%\034\324Y@\360"
+	.ascii	"\207aj~\332\204U\357\354\262\317[F\203}\272\2724\260~\013\303"
+	.ascii	"5l\017\022\004\017\357\235o\3166\336\236\261\216\245\325\215"
+	.ascii	"\227\b\212a+\006\213\320\b*\004T\323@\306\353\251\206\256\343"
+	.ascii	"\250\022\251\2235\325\006\305d5\027%\024&I\n\335\372\027\371"
+	.ascii	"\214^\n\342\360\342\363\237fH=fE)\"\230)\234\207\230Y\372n\220"
+	.ascii	"\226H-\351\361\272\0358\270E\316\211\2536\3663\032\301\255\370"
+	.ascii	"]o\0278\206F:\b\374^\315L\222\261\366\t8\007\212*\315~\375HT"
+	.ascii	"\"QN\205\301&\301\225\274\362dI\204\035L\226\302\261\230\224"
+	.ascii	"\017\256\372u\325\215\2751\342\026\333\273\224\263n~\240\316"
+	.ascii	"\340\376+5\225;\365\353y\233\377\301\206\317\212\bS\335\320\232"
+	.ascii	"\027\251\357Y\212\304\322Gt\2110U\003\200\373\303\217\246\364"
+	.ascii	"C\264\326\020d&\370Q\003\237\374k\332\200\241\342\240r\321\367"
+	.ascii	"eD\255\324^\370\213\343|*\2361\036\270\331Z*\264\306\267\343"
+	.ascii	"\277&\2337\311\2602L\336\352\233\362\374mt\242\203\217\016\230"
+	.ascii	"\b\331\353\"$3\363\ry\315\276s\260\374(\236T\215-H\266\021*\260"
+	.ascii	"$a\253\217\326\004_\311\354\007\224\025\020\216UVR\245\033`\246"
+	.ascii	"4a\315p\003\253l\300\311F\307\330*\3024\346\357\206\245\376s"
+	.ascii	"\373A}\307\321\032\3641\360]q_\360W\n\377\365\371s4B\377\255"
+	.ascii	"\242D\030\007!\013\t\230\306\036u\034\210\275\327\251f\321\311"
+	.ascii	"\345\306_,\tof\3740\277\356K\006\013k\341O\221?@z\333\221\022"
+	.ascii	"\252B\227#5%\351\026K,\335*d\n\037w\211\2558\237\324:\236l\017"
+	.ascii	"\213\016\024\231\237\300\277@9\254#\300\322\016\357i\210d\334"
+	.ascii	"Q\362\311j\247\220&\350\233bK\221E\214Y\320B\344\373\241S#\037"
+	.ascii	"\336g"
+	.string	"\215\017R\222&r\3462\226b1\223=\202\220\361\350\203\341Ld\002\026\355\312\206H\223R).c\211Q\363cK\362K\020\223\251\331vl\202\311\035\361\204U\215s\276\333\026\022Q\357\220\213\220\360\002\032\263\221\211\265\035\373\343C\002\260\327\251\340\323\340\357\222\373T'\2060\327\263\003\334\032\261\237P\321\340\243wQ\237.\247\340\356\302Vpq\227|\267-\366\356\353\206%\006\372\361\225\2144\310\352\326I\274\303s\277\204\256\203Qs\264\377\022l\316{\305\006\215\224\272\213"
+	.string	"\220\b"
+	.string	"e\001\317\216T\246\024\034\263\212\216\326\210m\202&\233\302\217U\261N\271\304\326\233\265A\t\n\256\024b%\266\352\337\243\006\032W\001hB\353\232\007\361\252\213\207cG\202\262\024\";\305tE\021\343+\364\017\360k5\261\201*\313\006\271\037\260\340\267R\354\360\210"
+	.string	"g3\210^\347\016\200\236\n\353\017U"
+	.string	"\033\337\306FA\315`\375WM\036KDW\317\261\036\031\333l@\346\276\365\022\242\007\245<b\235;\001M]A\250U\355)\300\356\345\017\026\357=\t\241\337\031\245\352Z\261\243\364\300\312\3330\274\250O\035(\2037\335;\212\375>\bwL\304\004\277J\201<\360?\207\224"
+	.string	"\204\007\317\027\270"
+	.string	"|\263\305\2359\212o8"
+	.string	"|\303-{gRB\374[\274\022\313\252\356\343D_%~_>\005\340{\376)\376g\n\376\302\373\225./\365a\017\207\337%\366\277\301\006\203\301\276\323\200N\231?\336yL\367\367u\347\372\377\377\331\337\200\214\240\2507|\352K\375#\320\367\233\345M&\215\035\237\250\332J\357\026\276?\317\211\307$\247\017\277\265rPq;\277xL(\370\320\355\345a\347R\254\342\363\326\350\343(\337o\220\374LJy\356`\275\343,K\211\022\005.\372\360o\3156R\375\314\353\234\274\357\335\356\272v\312\027>\221\177\202\342\367k\243\376\353\333r\245\211\205\335\356\3612\364\3727\r\033\303\225\366EB\035j\366o\2247\336D\227\026"
+	.ascii	"\177\177\365\277\"\303\317\214\236\343\247\277\330\020u\205\217"
+	.ascii	"\361\363\255\027\210\366\336\272\234\250o\361\273\363\352\r\303"
+	.ascii	"\237(Z\345\233\025\250\271\202\017&\221\177c\363\336\213'\361"
+	.ascii	"\253\373\343\305?\374\311\001f]\271j\007y\352w\f\276\2741\272"
+	.ascii	"W\215&\362a\247z\327\370\021\303\217SQ|W\016r&\367Yf\303.\376"
+	.ascii	"\263w\273:fa\335^s\367\317\027M\355s\256+\216\357\276d\317\373"
+	.ascii	"\316\226\362\217{c\312\027\223r\001\307G?\236\025\226\234\365"
+	.ascii	"},\007\336E\362s\205\377=\177\255\034\037\255\017\271\343a\253"
+	.ascii	"\035W8\233K\267#\336\377\007\235\273\n\t\205C\260\217J\220Z\237"
+	.ascii	"\334C\225\r\240\275\306\233\357o\2272q\207\334\327\255\327\331"
+	.ascii	"\363\r\337\177\211\217s\265k\362\256\210\344\223\352E\343\177"
+	.ascii	"j4\307\347\013\306\241\322\017w\342\315;\246\205\332\017\334"
+	.ascii	"d\241\265<3\377\3743\335\242fg\315\305&6\2212K\241\017\314\t"
+	.ascii	"\341>\273\023\275K\337\272g\237\340\264D\320\253O\362\362\017"
+	.ascii	"\343\335\227\335S\201\355Qr\377\024d\372\335\242\354\364\017"
+	.text
+	.section	.gnu.lto_.symtab.f523afe6fc476f2d,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"isEepromWriteInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\006"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\006"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\006"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\006"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\006"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\006"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\006"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\006"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\006"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"setConfigChanged"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\006"
+	.string	""
+	.string	"getConfigChangeCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\006"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\006"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\006"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\006"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\006"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\006"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\007"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\006"
+	.string	""
+	.string	"ratesSettingLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\006"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\006"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\006"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\006"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\006"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\007"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\007"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\007"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\007"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\007"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\007"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\007"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\007"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\007"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\007"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\007"
+	.string	""
+	.string	"validateAndfixMotorOutputReordering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\007"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\007"
+	.string	""
+	.string	"mixerModeIsFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\007"
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\007"
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\007"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\007"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\007"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\007"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\007"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\007"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\007"
+	.string	""
+	.string	"featureInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\007"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\007"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\007"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\007"
+	.string	""
+	.string	"schedulerIgnoreTaskExecTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\007"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\007"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\007"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f523afe6fc476f2d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1022 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\025\007"
+	.string	"\242\313+3`O\322\030\340\250\004\276\n\005\017\237\273\217\3270\213\033\357R\321\325\332\340B!l\266\004\201\t\004A\020\004qDC#\3226\331{oB\310&{\247-\003\2734\341#\345\nh\017V`\254\020\200} \n\030\026\252^l(\260K\275>=\r\253\016IA}\003M\003\3034\265\3008*tn\353 \\'\222.\227\357;}\311\355\363)w\023\314\214fb%\376\306\237a\353\220\310`D/E\201\215,\003jo\264\033\326\005k\003\001\241\241\237#(\231\310\003\177^rL<4\\<p(y\370\375n\273\337\333{\2548\"Z\226\3326\020\024"
+	.string	"D\223\nP\255Z[\234\266\206c\226Q\301\374e\370Q\023\300\235]\276+\206u\306"
+	.string	"N\331\265\256\0260\361"
+	.ascii	"\020\344\330\252+WZ\325\200\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\r\004"
+	.string	"\242\305\016\023\240\271p\377cUU\325\247\227k\355\1777ivK)S\311\356\253\253\236\266yG\216n\024{\023\034\333mgt\207\375K\021\022\2708\232\251\330\235``\266\346\307g\342xzJ\035"
+	.string	"A\231\200\220D `%\261M\253\237\032\202\n\212\f\027"
+	.string	"w\f(\004@\300Pt \204\247\026#m\270\b\317\266B`c\203`\037\205\3132x}\257\334\260<"
+	.ascii	"\360\2000\020\204\013\0219\203*\300\020"
+	.text
+	.section	.gnu.lto_.inline.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`~\004M\027"
+	.string	"\366\244|H\300RN\032\003X\200\006\024\250\004\030\206'$\337r\216\372\317\341\240S)l\377\2400Y\314r\257\221n\007\264kY\224\230\345\261\r-\031\203\375/ \200A\300 \311 !@\310%\241\347\207\357\351\256\n\244\021B\244\224)c"
+	.string	"c"
+	.string	"o"
+	.ascii	"\371\261\324\302\337\311\262W9\202~ \030|Z\334\213\001\237e\251"
+	.ascii	"6\004\355`\372\233\340\364E)'I\344\317\266\221\3655M\2121~\373"
+	.ascii	"\253f\346\271\242:b\214\256\327\033\267\037<\324\334\330\325"
+	.string	"[Y\364f\350\351&\327\265\2461F*\360[6\312IH&\201\367{L\363<+(\316\021\t\234\001\037\373s\t\n\366\022\331N\242\371\2367\255\232\232\032\022\360,\227\263\334\263\334\036>\354\013\017o\013\242\207\317\210\002\207\021\016i\336\241l\rek\250\242:\253\035!\362\3305\220\266\273\335n\b\370\031b\214/\317\372O4\363pG\321d\035%\213\2265M\300Y\272 ?\215\030h\322\374Y\324\300\301)\371i\2149\01600U@2\274\031\260G\027]\034\360~P3)A\275\240\030@P]t\317\026M\321\244#d'\227\310\357\263\234k_m\013S\005\324\024>ng\212: \031\320\317\tk\"\026\351\b\034\346\313\313YNc\353\003}A\204b(\017\227\240'tVR\337\032\256\0206J\005\017\220\334\233\246\034\240\204vT\024J(G\267M\221V\320\020\235\204\007\377\331\322a\266D\213\253\030"
+	.string	"K\032x\310\240l\222#`KujtL'\024T\004\f!F\001.\331I\264\026\313\363Y.g\271=w\355\013\370\265\315\331\261\021D\246\377\320\360\361\221r\214\221\233\316\260\001\242\201\341\226\251GJ\251d\230M\223^.\221\225\365n\345n\325\320\275\363\027\317\313;ml\362o\251\267\262?K\273'\357\3307\ro\250Q1sdfd$H\n\223J:P\"BEv\036\022`\306L\247!E3Qik?\003\3171\314M\357\376n\006\036\026\361\233VX\356\301\346\233\002\026\321&r\267\205\350\343E8S'\207@x 8<Dl0\232Z\350\305\212\240\2370]\322\216\3611\217\257"
+	.string	"@C\330\374\255\247;\265kE\252\314\316\352\252\340\030\353\273\2717\005\217\325`\222\304.\007\337AQ\243Gx\217\237\312\245\240\243V\213m]\n\301Dy\240\321 \236\377\022\226\331\223\347\333n\350\007\0015H\252\367\026"
+	.ascii	"\251\3028\326\207\230:\021\350\203\301i\262u\"-\003\006\030i"
+	.ascii	"\265k\005o\357\025@\020-})\215\266o\266\242>\2764\255HV_/\250"
+	.ascii	"\365U\021|\220\"\372\354<\"P\262\260\220\234\352\276\3741\330"
+	.ascii	"UF\013\301+\307\221ax\244\r\221\274\244R\257$k\274w"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`~\005\235\017"
+	.string	"\246S:5P\207&\351\210\235\231P\177\2445\b\205\021\273=2\225Lfff\207\255\037\321\031\242\252\252\2619\221L&\202\353e\037Z"
+	.string	"D_\361\rP\377\337\366'M&\031)"
+	.string	"*"
+	.string	"."
+	.string	"K\326\027p\017\360"
+	.ascii	"f;\306zg\3543\326y%\264\326\252\303Ug\322\"\243\364\036=G{\006"
+	.ascii	"9\364ZJ\276\234\320.\002\252\326\213z\017\265\211\037\212X,\344"
+	.ascii	"\227M\323Fz\320C\310+LU\026\247\307ze\335\016\375\203\274\316"
+	.ascii	"S\320Zd`5\311,\022\016\247\241\220\"?\037E*\220\t$\021H\036|"
+	.ascii	"\205D}\203Q/\007\334S\312\016D\330Rd6\3066\360\005\256pI\302"
+	.ascii	"&D_\303.$\351pLa-I!'p\325\353r\1775\310\370>\r\204\201\\ '\233"
+	.ascii	"{\301+\270\r\202\333i\232\246{z,\306\260&\270F\006v\250q=\202"
+	.ascii	"hf\026\026\244\320\001\200\"\2312\263\r\022 \363,\001\206\003"
+	.ascii	"\235D\002c\030\021\251\032\223Bi\230\003'd\304\021\323\177\237"
+	.ascii	"R\342y(.0\222\354Y\212\203ax\2424\321C\006m\022\365P\301/}R\t"
+	.ascii	"m\275}\3305\034\337U>`u\306\304@\243\031V\360..$\351\302\221"
+	.ascii	"\004\320\221#\330D\022\2420*3Q\rKo\225&\340\306\003\372&\001"
+	.ascii	"Z\206Xd3\022y\302f?7\203\034\320\177|\327(L\211\3752\305\354"
+	.ascii	"n\240\304\036\300Cc\326\031\327\220\311Eq\261\342\271N\323\334"
+	.ascii	"\345u\032\254\344\254\002\357\0024\020\346J\306]\f\274\300\355"
+	.ascii	"\216\024K*8zC\1771\0304\340\202`\330t\026\376\007N\213\003\001"
+	.ascii	"f\205\265\"\027X\323\364\263\203\027\373WB1\252\365\302\007\352"
+	.ascii	"\223\2422\2735,t\214\256\005\016\341\323\211`\030LS\327\347\367"
+	.ascii	"\352\326\330\374\\\262e\255\304P\373\334\355N((c"
+	.text
+	.section	.gnu.lto_.pureconst.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\265\004\003\205\004\005\205\004\006\271\004\007\225\004\b\232"
+	.ascii	"\004\n\231\004\013\230\004\f\230\004\r\205\004\016\270\004\017"
+	.ascii	"\230\004\020\204\004\021\200\004\022\231\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\325\006"
+	.string	"\342\t (\220\265\031\016\377\377\363\237\330<3\263\263@\n\237q\375H~\306\323\261X`\326m\340\023\244FKo\377\353\022\341[\312\024S"
+	.string	"V$\231\252\250\312z,\017\344\270\237)9\225\210\017\033\034\007\n\202\202k\247\323\225\035\255\030<+\020\341\232\213\362F"
+	.ascii	"\033\344\177N\235\223\032\326\307\245)\207\332Z\233\332\204\253"
+	.ascii	"\374\311\200$\2253JV>\345O\235{\316]y\324\t\225\375\313K^gN<"
+	.ascii	"\005\002( \200\202\231;\333\024\240q\307\007c\020\205I#\200\002"
+	.ascii	"\206\033\242\031G\262\027\264\303\235\340#\003\016\373\261\222"
+	.ascii	"\266\361\260|\025\316\214\331nEH\2144\026ga\273]t\3722\214\364"
+	.ascii	"\316\373\266\243\271\353\001\354\030FQ\037\340\366>\305\300\241"
+	.ascii	"\235\216\275&LFx\303,\002"
+	.text
+	.section	.gnu.lto_.lto.a1d85e2c114889f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loadEEPROMFromFile.14.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375 \333\305\005"
+	.string	"\222\n'.pU\323\001"
+	.string	"\r\360\271\321#~E.V\213\361\277\326\021\215\205\020\3410\350o\356\rXD\214\325\002.\200\370\253\310"
+	.string	"\250\341[$\267L\001\247\246\213\326\254\252\026\016\253\201Qjb\026\343\232T}\314\251p\232UuB(\255S\002{\371SdD\nsg\371G&r\273\313\320\0239\336~p\223\254\3717\320\374\375|\260l(\240\3732\002\264(\b;\377W\272\366\213\026\344\364\202\306\312g\324\335\2237\253\255\324\276\353YB\347m+\007\211\356\276\354<\314\236\367\277\341?\342\277$\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_initEEPROM.15.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\005\007"
+	.string	"\002\r05@m\223\016\274\305/\362t\255\277\276\341\032V\363\317\361\303\262PV\330\273R\013\215p\303og/6\001\237\326\373\236,\345\306its\217|\346\372r\213\b\221)S\225\213ue\252*\201\301\262\200\261\250\210\261(\\\"u5\304\212\300V\246\272\242\203e]q\3528\005\365\300\342c$\342\300l\312\273\334\003\304\253v\271\"l9\022ep\363]\366 \306\227\222\320\363\220\200\244s\361\231\200\"]R\234\230d\210\004\262\361\367r\224\3234\264\3441\351\2042s\252\364\232\237*u\032\373\221v\032Y\017\211\210\216\222\314\2140\243X\037v\013j\200\266m\372"
+	.string	"\f2\363\247m\025\035\366\037\370\013\376O\013"
+	.ascii	"\252\244\223i\021\206\205\b\333*\204\347\032\016>\304C\250\030"
+	.ascii	"/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.16.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\r\n"
+	.string	"f\322D= \345*\035\3408\bn1_\220\277"
+	.string	"\2053N\265\304\370&2\211\327LZ\0312\205,\351\243n\026\233\232D\323\202)\324{$$"
+	.string	"\322] .;* \022\b\330\\\215\b!r\247\0241"
+	.string	"3"
+	.string	"4"
+	.string	"\026)\345.\371\251\307\305s:E\337tNm\264\227\030\2251\343:0\2468\202\335\375\353s5\242\346\314pv\327S5b\334\335m/\3306\260]\006\177\375\035$\034\033\260\323\274\331\244i\252\313>\267\332\262==\347\364\271k\\\224\001\030d\273\254\333\200u\351XFl\227l\215\017\020J\026O~\260\016\022\013j\316IQ\234\272\346\356\232T\344#\357\372\200\002 5\005\330\006\037\033\t\354\246\022\374\223\303Hj\243\231\204\274\363\004E\246\004\246\334=]\365\316\257\360\336]\003\356l@`(\362x\032\">\020!\260\363\205>\016\240\257\023\222\276M\201A\221'\374$@0\3744\344^[\366j-\262\331\374E\357\257+\324Vd3\365Eo\352*\020"
+	.ascii	"\252\322E\301b\253\216\203X(n\354\b\243\213\215\0052\330\276"
+	.ascii	"\320\314*.\2149\230\2216X\036\327\034U:\220jh\023J\031"
+	.text
+	.section	.gnu.lto_scanEEPROMBlock.18.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\205\005-#"
+	.string	"\226\177\337F\200\234Q:\337<\004\005\245\022"
+	.string	"\f\342\254Bc6\312\255<\245\374\374\304\253h)"
+	.string	"\220\307\304X\\}\356\275\322\306\020x\031\232\275\333e\273\324-\276\221\200\303\362\374\"\0309\2407\033\330[\373?!do\271\223\f\314"
+	.string	"\273"
+	.string	"\324"
+	.string	"t\356=\022\270e\006\347m\020}\257\254\224\031\201\202\253\037\255\270\357\375\342\223\200\322\033Y\\\350^ f\270\334{,\300\007\316\333Cy\224+\016\032\035\205x\231m\336\f\223{\356=\372\370x\242\362\366|\257\274\355 \\\322\340u9\334\315v\232\245\255M\203|\027\327\231[Y\352\370\360\322\361\\]B\343\312Q\227\356\275\270'_\243\214\201\021\221\314\370\355\206\r\215\313\306Y\245\276\310d<\354Lh\\5\352\231\222p\341\240f\225\032\326\207\225\267\256\031\267\027\352x\255D1\212\020w]/\352"
+	.ascii	":]\362\340\272\262h\327\001_d2v]X\225\350\354\007\234'O\267\272"
+	.ascii	"\262(5!\334{\231\022\273\274\316\2733\263\0323;`\266\020\002"
+	.ascii	"Wx\"\226o\261z\022r\357]\220\345Z@\360\211\334\362\217\212\236"
+	.ascii	"x\313\247\272\367L\246\274}\207@\226e\3214\276\224\027\365\233"
+	.ascii	"\211\030\230\226\022,\272\306|\304\242]d\376\367\300\230\202"
+	.ascii	"\205\033\bs\2162T\216\362\223S\023\223R\022\245\214t\364\343"
+	.ascii	"\017\340\306\277\210)\017\365x9\312B8\312A\2252P\245\274\263"
+	.ascii	"Q\326\235\224s\2252\356F\371v*\347\223R6m\224\313\033\317\366"
+	.ascii	"\244\\)\3456)SJ\371\002\212n\234UXso\2145?\327\314z1r*g~\225"
+	.ascii	"\203\335\n3\216S\274\nwR\215\223\024\314\270[\312|\305O2\216"
+	.ascii	"\247\034yu*+\316\313\345\034\206\371\t\001\210\330A\226\311\242"
+	.ascii	"ia\356dI\263u\221\321\246\234\316\254\236\314\314\006\"\313\312"
+	.ascii	"\346\265\331W\253]\366\0071e\303?ht\020\221\234]\344K(k\003\221"
+	.ascii	"m\"\274\214\0042\016\023(\224\267\265\355\0220>Fa\327\301s\306"
+	.ascii	"\303\354\"\253-\371\272%\331\035a\354Q\367z\353a?\343,1\336\224"
+	.ascii	"\372\311{\330!\307\276y\2755fJ\212\215\030\253\007l\306\272\201"
+	.ascii	"H3\365\275\222\327\335\017\273=2VV\357\275\2674\242\364\027\312"
+	.ascii	"\242\356\265\2653\230\222\031C\006z\342Q\353\276\3641\323j\027"
+	.ascii	"Q/.\231\355\"\277\216\017\032^\265\213\f\240i\357\222 \3350k"
+	.ascii	"\270\227\r\347\275YQ\374.\026:\234D<\364\345\2641\n\351\332\177"
+	.ascii	"\230\211\235i\026\233r\022r\003?\340\257\177$F\200(aO\234\177"
+	.ascii	"\006JT\001OPQM\215 !\302D\325\317"
+	.string	"g\202\004\210\022\276\0370\205\317@\023W\235\240\002\372TTU\001}\270\243\360\r\204Q<\331\222\203\352'o\353\261\343\253\362\203\345\320P3\004ac]\321\265x\260|j\250n\265a\215~\260\024\352\247\276\225W2-z\264\276\202Z\250\237\246\250\221:\310\017\331\032-&%\234!Mrf\257\317\336\342j\362\332\336\316\220\030\315n\244\336j\020\343+J\2476*\362\243\251\201\234\230\032\250\243\310\254\261\335\324;2\007s\333;\246\263wtL\037\335X\23098]\363Z\251_&\327:5\271\266I0|\330\210\336\232\327\270N\352\245^\343\372\303?\302[K\215\021\013K[+\336lo\250A0\343\020D\304\241\021\212\206$Mk\240\002\221)\263\016\021\3009E3\316\260\031\312\337uia\360\023\026\302hU\331q\307\026\211k\366\021\250\031\\&\314\231\005\222\363\331\237\017$mAH\\\021\302\n\334$"
+	.string	"\247\200\276\002j.\206\306\304\356\3103\231\352\335\016\264\373\325\377\022\020&M\356\316V\214P\030\033<\232{8\346\3574\242,6\226W\254\320i\314\213&60\300\370\274\311\231\177\215\2466\005|\n\346\f7\266\217\367\331?\241\203\270"
+	.string	"\035F,J1=w0\240\356\206x\030\231\3100E\2677\326\200W\200\222"
+	.string	"\332i\204\r.\253\302\345+M\262\276\005`r\364\322X\245\316\025\007V\265\317Q>8*\216FEa\262\313\030\215\232z\0057vV\354\313\245\361l\275\340\316"
+	.ascii	"\330\347\303\226\242\n"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.19.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`6\002\205\023"
+	.string	"\366\344\203J\320\360(\035\272b\243\304\b\202!-\035\201\360|?\240\331\212yH\0275k\372\244\351\2079\201\r=\\\363ELkz5\220Vy\0213v\030e\003\365\362\202w-\354Y*\262L\324\203\240<\326+*\t\221\220\275\267\334I\006n"
+	.string	"j"
+	.string	"s"
+	.string	"\267<\360\312\b\276W.\337a_\277\003\260\257\234@A\n\273^\316\264\234\306\304\370\023\343\336\022\325\032\270\247\353\225zm\247\213\257\362\372\332\013\340\320\210I\n\232e8\345\350\360r\217z\261\026\233p\266B?t\271\241q\366\367rK\r\300\024a\bg,\264\003)\206\351\265Or\026\233\323\013\271\367\362\224\315.\234\2773s\214\231\0270\317U!\3763\302\257ye\2268/{\345\213\024L\346e`\277\366\r\244\234RF.\326*\314\245\312l\031\334\006\034\r7\2159<\201/\317\037O\256\3479\323\227\347\256\223'\235|\216\367p\210\301\302\301\355\336\226\335\214{T\207n\316\363\227\237\314)\374\236\327\030,+\220\344\t\220\357\225\257\363\235\224\363\240\374\262\270l\214dQ\356\006\375>Iac\371"
+	.string	"\233;\3326\242\230\213\3274\006i\232\306\233\027vH\026\2157\0136m\322.1\2157\357\3245\3102K\004\261Q\202\321\351&E<\354\217\233\034\237\025F\247\016;"
+	.ascii	"\021\212#\332\335\247n\234\027\260$ \017\260\271;\275\367\336"
+	.ascii	"n\031\376?ft9\3334F\261`\013\260\201\341\243be\352\030\2348\313"
+	.ascii	"\007\022=\234&\020\367\276.\343\007%WYX5\030I\211\023\"lp\312"
+	.ascii	"\203%\266JT\252\007\"+\t$b\nE\262\202\300B\245Z&(\017\002,\226"
+	.ascii	"\250Z\250\023Ql\241\300\362\276il\227t\266\033\375]\366\2653"
+	.ascii	"X2\262\335&\337e+\327\346\220W\303j\3130kG\250O\3755\311<\233"
+	.ascii	"O\342%P\3705\254\022\021\261\257\323\205\254\305k\356\370=\273"
+	.ascii	"qc\215\327\205\304\001J#\276' \200\002\031\261\353\001\352t\355"
+	.ascii	"XL\3358\"\201G\226\333\355H2\247\325\nVF\210\036[\221D\374\340"
+	.ascii	"\225\201\232C\310Rd\260\270?K\001\266\306\330\260\354\251E\017"
+	.ascii	"RJW\370q\223CBH_\334\013\003\366\t\\\303\273\203LDF1\257H[\211"
+	.ascii	"\324`\371~\204\0218\034\215\201\356\001"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.20.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375 \374\325\006"
+	.string	"\362\214/3`m\322\001\310\017\200\314@\021\273~\246e\377D\t]\350\356\272.\370fQ\357\030\335g\013-\006\211\007\bB\322\201\032\261\243\035\264\273\254\365\336D\312\224\002\236.\232\0079\024\205q\3104l\336\3446\031\006\215\233\340\203\273 \370q(\350 \336\203\316\022\367:J="
+	.string	"\251\204}\221\307\312\347pD'o\235\371\235v\226*p\001\312\313\216\237\324\f\373\322\352\310v:\325\300\342\004\203\262[q\251\254\t#\351\260\355\261-\376\307A<\256\n\342\206\250Q\254L\214\244\354F\347x\202v\026\360\201v\246\032\257\236\225\377\220K\036%\227\025\372<\001\026v\327i\205D\267\336v\202m\005\333\030\001\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\273\021X\013\221\211\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_getEEPROMStorageSize.21.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375 \337-\006"
+	.string	"\"K*1`M\323\001\300\006,D\336\201F\212\035\227\"\336\245\237*^\300\342u\263\217\240[z\017\361k\374\206\201!\003+\266\377\260\224,w\255\355f\367N)v\232H\316\351y\022\030\240\005I:Q\202\024\242\350L\207\330\020XN\317\214\017R\316\310\324\375\313\334\356)\034\200x\021v\255\334\253\260?\331\227\331\356\037\3326\322"
+	.string	"\262KQB\262\332\342\201a\233\262\031?\343\032\224\251@\275\300\340\204%\301\261\355\326\350\372"
+	.string	"\370\245r"
+	.string	"\370\345Y\234\336Q\377\033G\350\020\t\261\256\352\216r\260\273v\326\205\335\357\266\013l\033\330\246\002\t"
+	.ascii	"\252\244\223i\261\317\f\t\016\3125<6bh!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_findEEPROM.22.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\023\006\005'"
+	.string	"ZF|\017D`\346M:S=\255\350\036e7\325\227\002\221\272_\330\334\347\025C\204]\331E\274\177\203\003c\031\267\f\340@\344\341\371\361\203\372\020wI\333\223\234\033c\272z\301\004\253)\351g\356\326\324\255\021B\266\334I\006\347"
+	.string	"\323"
+	.string	"\352"
+	.ascii	"7+s\016\276\227+9Mf\321\320\203GD\227\032\366\212!/\330\t=si"
+	.ascii	"\rn\262\206F~K\216s\261a\215\356\026\022'\022t7\233,\327z\265"
+	.ascii	"\033?\2727\t\"2\367\"\037p\004\335\315cyZ\016\316JB\232\201\025"
+	.ascii	"\211"
+	.string	"aR\364B\350^d\220\221\017p\336\324\035x\336l%|r\257\263\356\353\245\274\235\016=M\3335\213\337I\271\2658\266/\035\367Yt\307\017'\237\343U\304R04g\346\312W\343\027\261\366\234\312\300\306\236\246_;*\31728\272\001\362\373\332\262\001\344 \341\363(^C\352N\210\316i\216\227\030j-\240\t\373q\267W\037_E[\231\344\371\363\266;E\361\"R\317\ba7\003\334\206\275\257\274E\333\363%\255\320\021\260\261W\364\302\275\227k\327\027\330\371w\346\373\230\371\005\263\351\025\367\336{6\031Wk\373n\347 \027\246\350\306\263m\324F\266E\315\226\007l]\033\271\301\340)Sc6\031\377\r\004P\2177\313\365\300\023\251\223\372mW\300\365\206\030\227\224B\254\313\tA\330\230u\2231#\211\365'\2331$\334I\230{\225\233z\225\231\226\320\312J\006\316\345/\200V&p\265\177@\322\256\262"
+	.string	"\340\273\234\221\216\214\212|\225\177\275\312\276^\345^Z9=\333\231\307\253\274\323\355*\243h\345\323\264\225\255\256r?y\256h\345;M\230;\21659\3538\344\375\261<t\341L3O\316\366w\371\223o\346\363\335^\346\352d\330\f\253C(\fsz\305\007s1\314)\317x\030\016\242\301\035\323\356\275\351\277\360\3338e\253\332C\246\304\f\3464\006,\032\237A\\K\322\002\275\313#\240w"
+	.ascii	"\336\024\023\365\225N\264\0054\327\242\030s\270\235\016h\243"
+	.ascii	"hv\254\234\b\232\036AxM\306\004\372\364p:#\316nCKrdZ\036\304"
+	.ascii	"\251\324\004:)PQ\254\f\2138\334\2108\037H\360\317n\2347\225\372"
+	.ascii	"e\216\200G\226\265'Y\324\264\352r\327dl.\230\262\\{\263U\r\275"
+	.ascii	"\rI\016\322\261\233\022\016\314\356\325z\327\232\277\231x`v\357"
+	.ascii	"\245\300\346mP\360\317nr\212\247\372\256\247\363f\275\367\374"
+	.ascii	"\326/[\213\323\rl\3335\020\227\024b\267\202;q\210q\312DZu)g\004"
+	.ascii	"J!\264\355!z\\)\272uR\263i\324\3006r\0375[S\327Emd\250\363\375"
+	.ascii	"#ky\266\252!fV\3614P\272{\267&\360\321\234\020\352\316\262\316"
+	.ascii	"\233oS\020\234BjZu\311\277\r\354\002\202TUP\252\nXu\026T3\206"
+	.ascii	"-L,+(,\0220\204\303\030+xT\303),(\341T\213\251\253+\250\030\302"
+	.ascii	"\237T\224U\263\020\202\214\241UUT\224\n\251\251\026TCa\220j\n"
+	.ascii	"JFPhu\025\204p\200\207UQVA\254\341\320*\230\"\265n{Gm\266\361"
+	.ascii	">\210P\201\323jb\231\357\301\232\2422]\352+\237\200\255r\212"
+	.ascii	"\247\017S\252\034\323\220\322\332?\271&E\267\3723?j#R\377\372"
+	.ascii	"jkp|\315\357\363\264$\367\353sI\271\236\357\331\300?c\f\031\352"
+	.ascii	"\2732\2347}\275fJ\235c\026\261\ns\201\306\364t\300f\024\330|"
+	.ascii	"\002\233\327F\326\0255\243gQ\327\246F\352\245\004I>8\276\341"
+	.ascii	"d\352\246nDE1\342\206\263\327L}1OP\307\0171.yL\273\327\025\021"
+	.ascii	"R\033\350\264\037EN\311\205\246\345\274\016t\250A \245\030T\006"
+	.ascii	"\221\221\031\231\231i\323\001p\002\031\252*z\020xG\222$i\016"
+	.ascii	"\301\\\253*i\315\017\"\034W\202\r\205\302'|\005\027\226\324\224"
+	.ascii	"\203A\005\274\006F6\237\270Q\002)\341\207\322C\200\244,\340i"
+	.ascii	"\332\273\2663\2240\276U\022\257\271\032\215\314-\200Tr\031\261"
+	.ascii	"C\241y\210\244X\365\203xf\332\364\306&\006X\235\301kABIJ\341"
+	.ascii	"\323\242\007\375.\342\003@_\213\243\003\250\226p\217\005\177"
+	.ascii	"%\227k/\263\203\001\224\306P\303|G\006?1\002\236\357\207\030"
+	.ascii	"\316lJ\341Rl*`\253M\256_\267\310\024\320\007\273\241\361\246"
+	.ascii	"\323\3762P\0365\327/t\233ns`\265\304\2179\035&\002\024y\215\035"
+	.ascii	"\306\362\"\347\0235\247\205G\243\261\242\313\365\306\262c8#\205"
+	.ascii	"\321\370\321\377O\302\357_\373 \367AQ/#\253T\267\327\262-\240"
+	.ascii	"x\377\234\231\357U\305\256\301NW\003"
+	.text
+	.section	.gnu.lto_loadEEPROM.23.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`b\003%\032"
+	.string	"6\261\255H\240\232M:<\226\017\363\250\365<\200\202\300\017z\013\361Z\376\335\322\334\373.\267Qs\311\004\351\220{\352@\333\364\275\370\314]\245\257\247+\2360hm\353\240\302\201\365\300\223\227C\037\016JxWY\355 d\357-e\222\001\234"
+	.string	"\215"
+	.string	"\235"
+	.string	"?\373\246}\335g3p\033\353P\004-+>\006\237\013A\374\334\b\022~\326\366\021i\350IctSij\035cMd\351RQU\230\245\242\252\254\313\361+\262\3556bH\247l\266\355\233\216\200j**\013\n\357v\033\031\002\r!y\027\034E\262\002\360\207u(\034\213C\210z\017]<\035\247\"\217\317\027O'\r\324Z\001\360\200X\312\234\242\2520"
+	.string	"xA\262A\230\245\036\237:\013\361r\334\207\372\002-1\276\255 D\275s\230\241\326\272\274\343\021}]\337]\250\335\315\260\333!\002\274\347\241\260\336e\321\303\337\341\364\247\356Z\222\205\313\326\017\250oMU\005\210\327}\264;\336\270\002\022Pk[\310\256\200K}qn\376\364\205\275\356\373\272\226W\024y\303\311KC\336\031\362J\312\333\223\227%\357u.(\031\371H\"\323Yc\035\n\252\251\\&V\222K\375O\277\357\275\373\335G\355\247\366%%C\326\336M\315Yi)a\020\357\264\207\332\327\347\276\311\307\237?\315\220\2657V\"\032Zb,\214\327\241\237\342s\350\347w\003L;\320De9Q\202\343 \347\b\t\360\007\020\374\335\306\330\"e\353\227\353\333m\\\271Q\204\366\321\031\251\367D\313\264Q\261\037d"
+	.string	"s\323\016[\304\b\376Nl\021?t}\333\275\024\332w\273$~U\3423li\265\3331\2336O\321\255\t\020\f\006\201\177Ae\317\246VAF8\016n\267\354\353N\274\nE\267\203\"Non\035\034\030\2525\233\342Pdb\255\271\t\373'&f\342\221\317w\033a\372b\324\344T\203\203\354\244\006\315\030\331G+\203\342t\001\246&Qdr\f\\X\262Y\255W\314j\355\3433\223\311b\370\204+{\320C\253\271\230\315P\254\340Q\321\202&\213\265\340I\321\023\223\325|b\017\016,\315\305\254\026\203A\243\325b\257\261\376.\305W\337\334\210f\314(m\375j4\356g\323GK\241G\230"
+	.ascii	"\310\253a\307\003\223\022#\037\254\205V\206\256~\3237$\225\321"
+	.ascii	"]\361o\243\257\026\272\225\035\261\326\240\357\366T^\205\203"
+	.ascii	"\334\016;\364\273\317\375\016\375\204q/\n\023 g\274`\3111\360"
+	.ascii	"\262\326ZE)_\036\222\200\272\253y\254\273ZhW\301s(\254\005\364"
+	.ascii	"\241.\003; P\002A(\231m\252ti\r;\303Ab\032\335\214\213%#\344"
+	.ascii	"\305\b2I\037&{\203\351n\355R\026vY\3278Y\304\352\327N\245U\022"
+	.ascii	"\212\216\343\003k\316-\005\315\360\346\307b48\200\013Cz\345\005"
+	.ascii	"wh\030f9\202k\320\016t\275\320j\325\200Bj\315\321\360\243m\242"
+	.ascii	"\222#\030\245\211z`0of\236\313fY\277\315.ug\003#R\032\n\016\334"
+	.ascii	"\206\263\033x\034\354\343\bCi\364\317\325G\f\331r\357\325\276"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_isPGInSet.24.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`W\001%\017"
+	.string	"\006\236hE"
+	.string	"\261&\035\220:\340\265\031\3753\372\213ct\313\261\030b$\210\0266^\322d\260\201\006~_O\353\326z\316\361\256-H\212v;R\235\376\377\377sdV\357\017\n\223\271\037\304\301%\314v\215\220\275\211\224)\005T"
+	.string	"O"
+	.string	"V"
+	.string	"\237\006\002\001\366\304\005\006!\323~\211\233H\275\245\344\002vWb\264\330\375\024x\301v\350\357\034\361p\373\200xh\333\f\032\244\254\372\027\002\246\301<\270`n\354~\234\202\270\352\251\362\017s\330!\247\346\225\262zj\022v\327\371J\341p\353m#\260=\301>\215\037\354g\273\273\326\025\333i\320[\376\317_n\317\277\177\213i-\246cL\303\230\316bZa:a\372"
+	.string	"\n\300\230\261!f\027\026\323Y\031pf\304_~;\345\303\370\343\237\270K\352/\031\266\025\312\246\002&\302\306\356\227\340\320\021\266C\217L\003$\227\351:nvO\036\330\243\263 m\273'\016V\210X\340\270a)\321\216\0323\360~\021=\2525\255\035V\306\234\352\321\264q\355\230d\314\241\233&^S\337\242y\212\323\266\333\372\313\2179\212Rv\226C{\247\370\327\241\177\322\353QrdZ$X\031\263\277Uj$]\210\211\004G\035JC\272\221\tDD\244Y\364Q\362P#]GaD\252`\362D\234\211\004R\342D\250\013\334\307\001{#\035\212\303\340y(\356\363\355\263\325\025\220z\230(\313\276(j\n\322\273\\D\315T\323\f\307\245\002\365\017\305\250\320\246\245c\340\241\350Q\250\021\307\245\302\312X\031"
+	.ascii	"\252\244\2231-\243a\n\266\020\224u`\311\214\325\003\324n\214"
+	.ascii	"=<2\361\320\256\376\031\021j|(\230\233j;h\263\266r\241\001\032"
+	.ascii	"\203\341,C\023&\274\0134\203a\tP\021M\327|\002"
+	.text
+	.section	.gnu.lto_isPGChanged.25.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\030\003\205\027"
+	.string	"&\255\234G\300\030Q:@D\232$\022n*\007\320[-"
+	.string	"\270g\0031q\032Ga\3217\013\201\346\310\022\235\325\253\246\273\302\276\001\375\003\223\362[,S\020\315\205`\3156\317c\037\363S\224`2\324\370\266g\263d\357M\244\224)\213"
+	.string	"y"
+	.string	"\222"
+	.string	"&\032a\202\304\324:\342\254\374\203\220\371_#+\264\263C:\313\252ug\345I\255#\2037\bW~\334"
+	.string	"se\2706s\345\377;x\260s\236\035\177\370P\237 8$fj\035[\r\264<K\247\004\233y\276\016\224\220r:\332R\225\016\007\336\324Z\347M\2069\026\004\003d\361\361E\245\223\001*\340a\345\206\250\263q\203\013\216\204\354P\351j\240\315\017\223\243%Z\236\241\2631\323\t\265\326sNgc\037\356\177\332\177\r\177K\b\353\232\246\376_0\336\234\330\007~c\260\310h\332?\326\270y\377\202\265w?\345\263\316\257\241\374\025\345\253(?5\371\250\035\367\"\345\237vh\327$\362\251\310\237'\2764\361\301\220\337\224\317\223\277"
+	.ascii	"\b\244\311\242\343\253\325g\tM\305\"\243\004\331q\367\337o\222"
+	.ascii	"\365\275\330#\247\276_\221\027\337\336\026\375\342a\354\221\247"
+	.ascii	"\200~f`\374\342J\376w\276D\027\377\2171\266\336j\004\275-\276"
+	.ascii	"\002K\273a\236\232\325\003\214p:\212\316a\245x8\365\026-\353"
+	.ascii	"\250B\246\303F\361\300IO\002\243\344'"
+	.string	"\233\367\335\366\262\033R\006\354\035\252\267\227hYK\302\320\306h\351\222jT/.\rjo4U\235j\001F\26745^\372\372\376a\235\200h\242\"\304\027\210\316\\\251\352\365-\377(\211I\022\272\210e2\"\254\325\006\341\273\344\004\211\260\326\272@Vn7\322/h\250\207\227\370H\310\017\224n\3367\306\024{\200\220R\217\213\215\317|\305\017?\221\003\223\265`2\033\327k\326\260\327\254\357\312Y\021\233\311^/\0220\024&X\304\\-\026(J\254h\271f-Z9\006\036\223\275f-\027\261\330\254%\216=\013\326\336\235'\3162\270`i\317\370_\3237=];\355\232^\234\2448;\333\304\rw\203-\373\247P\20177;B\217\333VI\261\271\337\302R\271\260R6\227\311\341\300\260S2\200M\221\256\004% \202#\307l\336\2529<\352\315E0Y\275\352\363\215\007\253\233\001\320/4 p\002\241"
+	.ascii	"\221\036\235LP\317\f\330\236\320YF\332\n}\345\032\312\232B\303"
+	.ascii	"\202\033\343\b\016\323\013gq\312\315\0061\264\001I\361\\F\305"
+	.ascii	"\r\201\215\226:\031w,X\305\345s\025\013\375\274 \374\264,\307"
+	.ascii	"\262#?\345\230\031\200\354pM\330 [c\030\302\373\305\241\246\r"
+	.ascii	"\214\"U\026i9b\305\007\2430+\334\006f\272\316\203\213\352\033"
+	.ascii	"\337\302\225\201\2212l\360;\243b\371\f"
+	.text
+	.section	.gnu.lto_findChangedPGs.26.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\333\004\265!"
+	.string	"\246\177\334E\220\234M:\222\n\260\266\361\2120y`9\212'\020V\002J\022\fK\246\177\273' -\264p-\256\226\017\220\300\305\203\022\253\220\336$"
+	.string	"\220\333[F\362z&\023+\021b\033|\302\004\035\333\b!\233\020\271S\n\304"
+	.string	"\274"
+	.string	"\314"
+	.string	"~\327\261\3305\323\370\025\217z\256h\330\265\213\323\306\341s\271f\373\227{\335U\225\274\036\230\235Z\177\017.\332\302\234\337\262q"
+	.string	"\265\026\031\373R\353\017\202%\220\027?\345Tp8w\364\323\262\032\353t\341e\331S\353\317\346\337\213\350E\362D\364\342\0321u\202\365\365\306\t\326\027\331\303\337Mg\356%9R1\334\231\363s\274\034{ew\206Xa\235\f\035\004\031\353\3615UWa\221\032\"e\347z\202&UXs\fG\035\275$B>^X\301\314\016\230{}R\371t\223\322\230\374\270\350\343\241\220OG\210\240\326Z\363I\315\275\327\035\004\201S\276\037\237\343\205Z\253\347\224\317\352\246\335\266\025\333(\3540InA\277\270\2568R\323\314"
+	.string	"&\320\332&N\314O}\357\365\363@\343$\215\324\002\305t\370\326B\023\301]\206>x\200\265oL\363S>\327ih\204\244\331m\016\373\247\233\233e\277\202\226\231\035o\021\2736]\200\300\200\3324\022m\372\350_\267Qm\272\2106-\340[\177"
+	.ascii	"\332\364\220\247\203\016\274\201j\264r\272\374\357&\313\351\261"
+	.ascii	"\234\246\345\264XN\207\344\364\222\323s\234\276\201\003d\324"
+	.ascii	"\334 \253\265w\346\247\246\021\301(\371\327\017\374\177_\373"
+	.ascii	"\276\226\207\311\270\027\007\211\321\221\262\305\007\343\362"
+	.ascii	".8\376\345\202\314QE\206\365\310l /\"\bOD\177\305\367\002\302"
+	.ascii	"\350\325\031\203\201\224\021\300\335\023\335<\233\"\322\326v"
+	.ascii	"\300.\330\320\"A\210BGG\006\374\023\365\006\364h\207\326s\027"
+	.ascii	"\344\354\032\250\200=Z\2440\274\253\207y\303\335t k\225\232\340"
+	.ascii	"\267Q\341\301G\002\203^\024\260\017\373\002\252\255.!U\266\312"
+	.ascii	"]\243\346Sx\306\025\267\3340\310\353A\367O\242\343\212sv~\016"
+	.ascii	"<\211\032-]\032\344]\351\346Y\214\233\371`@\253\326Z\301\006"
+	.ascii	"\361\261\020d\255uB\231\022\""
+	.string	"\214\264\220\330\240\027\3055p\004\214x\207\241F\033\356\255\202hv\177v\215v\335\360\376D\3153'\335ct\356\356wc\027S\"k\335\205\271\230\021\341\221\\4\t%\372)%z\021h\347\036\354\342\222\240\330\016\212n\236\235\215\234+^\341f\005^\021\201\t\312\306\004E4\343\226\302\251Id\272\341\366V\243)\204\213\024\270\247\245\033\256\226\342\306\344tb\305\322\350\245\b,\236pP\267\233\t\246&\025NOK6\247\246\023,lK8\027\266\b\n\374\004u\303\331^<=\341l\277\250o\021\267\bz!\013p\350\301\341\205\215/{\220\203\326\027\242VW\372\306s\264h\013\354>G\311-\332c9\2036utdZ\2020\360\221g\017\031\322\332\222KUvr^Y!\322\005Gj\232\215\233e\n@D\002\r\314\246I(\225deR\200\226\312\241H\333s\235\274\303\347\314\364s\264\266Tr\342`"
+	.ascii	"Z\260c\213M\327\230\3244{Xk\255t\263|\260\227n\372x\t\007\254"
+	.ascii	"\303\255-m\251\354\244\023Q\240%\220\001O0U\250Q(\245\214\"D"
+	.ascii	"!EFd\206F\032u`\002\231AE\266\001\021\360\301*j,\354\033!\216"
+	.ascii	"~\n\242\022\365\036Z\267p}\242\360r\227}\t~\275\202\220\255\033"
+	.ascii	"\262\210\362\270\345\226\217\352\323\231\313\b\255S\346\327\f"
+	.ascii	"S\244<LW$\354G\376^\201/\273J\374X\374\330\301?N\322\242\361"
+	.ascii	"\306\300O\340\033:\306\334\340w5/\276Y*y\r\242\353<\356\257\320"
+	.ascii	"Bj\230\3045fCA\245\220S/I\253\341\200g\217\300\"\214*\204'L\230"
+	.ascii	"\323-\220\334i{O\314k\212\254\022\374\202\332\364\210\023\\\033"
+	.ascii	"2\265s7J\b\003\375\333d\224\311\354#\200\016\3456\363\252\313"
+	.ascii	"\364\270\336\026\346N\363\250"
+	.text
+	.section	.gnu.lto_isEEPROMErased.27.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\204\001U\017"
+	.string	"f\235fD"
+	.string	"\221(\035\360\003\376b\223\315#\372\r\023Dx\233\276|\264!\314s\375\360\2370\037\264\3170\250\235\275/\372Y\033\007\203^}\222\267&\021UU\353\307Z\217\261\336d\003\255*C\215K\237\264\275\267\224)\005T"
+	.string	"P"
+	.string	"S"
+	.string	"1{"
+	.ascii	"\371x \301\310\333;\017\251L\352\345\002\n\2309;m;l\n\273;\352"
+	.ascii	"v\031\341\352\346\223.=\270\023\212+i\034\201r\b\033\260\224"
+	.ascii	"\370\340\301\231\340\266^\261\rw\322\275\353\032\333\341\321"
+	.ascii	"h\341P\256\031\2209\247\365\204\313pgn\233d\233\201}V\362\335"
+	.ascii	"\r\357\335\013\325\252\352k$7apl\2579S\337\216\031#\262P\271"
+	.ascii	"w\373-\337\345\211>O\0304'*9n\314\331\021x\364\202\354\361\366"
+	.ascii	"\310\336\330\336Nd\003\201\252\375\225\263\214\316*9\2009U.V"
+	.ascii	"\314\331\025\260\201\354\321\335\005\310\007&\2159\234s\316\270"
+	.ascii	"\253\213\344n\266\327\360\301N\034J\372\251\212\r\252\026pW\376"
+	.ascii	"w\022\251\033\362\\L\032c?\205\005\222L\204_\"\037u\217J1\321"
+	.ascii	"\317\273r\277w\035\256|\261\023\211\222~;\243F\253ewew$U \343"
+	.ascii	"\005\b\257\312\316\316\372\003\236w*xF \350\346|\204|B\240N\007"
+	.ascii	"\302\004\217\004\221\017G\023\361D\b\3218\241\021\355c\200?\240"
+	.ascii	"NH\243\360\371\204\264M7\277*\377\304\035\274|/X\3747y\327\037"
+	.ascii	"\274\350x\301\326\337$\204k\020\223-\205\220\273\262\306\004"
+	.ascii	"\3146\246\250Q\266\035w\367.\036\214  P\2021f\335\006\252tU\206"
+	.ascii	"\277\233K)\f\324\244&n\301\033o`\353\241\346Pr\231\372\262\036"
+	.ascii	"X\022\356\266>\206=\354q\237/[\013\020%\344\271\260\227\031\021"
+	.ascii	"\320(\375\3031d\211\331V\226k;om\237K\233x\355%\274'"
+	.text
+	.section	.gnu.lto_writeEEPROMBlock.28.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`-\b\2550"
+	.string	"\352V\f\023E`\\R\007\377C\235\210\b\330\177\335J{fv\357\350n\340\rG\004\270\314\317\377&\275\024BV\255\223\315\303\276H\200W\003\030uZ\214<\3179\337\217\334e~c\332\261\f+!:\311i\237\273\355\275\223L)\033\001\020\001 \001T\027\256\263\021Z\367i]K;\\\007\337T\f\263]v(\237\264\213\n\252;\350\354{\232\257y\026w\353`[\3223\263\006u\005\333T\326\223\372\240\346L\366\244F\265\346(\006\251\226&9\333hr,~\366:\032\013\317\316\354WM\244t\324\234\337\210\234m\017\256\263C\274\226\271"
+	.string	"\032\346,\2631\f\217\273\217\220^'\263\362a^\336=\231\034w{\025\027{}\f\206\007\310\231\310\231\267\234\311\212Z\202\353l\223\371O\353\254\353>\255\263\375v\347\001i\345+\n\322\031\3153\275\2343\361\301\272u\302\325f\306\tW\033\236\257d\336.~\035\350\376Zv}\374\266\273\371\352UC\316\t\275r\340\372\323\332Z\342v6\270\326\245=*\027\207[bWA\221\033Q\377M\275\335\341\354\n\201\n\027'\be\256?[K\234=P-\274\256A\034yfz\240\314\225B\032(\017\237:~B\263\360;\234\213\220v\261\031r#\352\370\207!\347\334\330\t\275\341\275\343\335\235\326\335\320\356\337ZzA\340\316\326\377j\027m\203\367\2513\270r\346e\206&\013\357}\232\234\026\364\333"
+	.string	"v2N\374j\325;\256\355\346\320\001\273\263\300\373\234\035\225 \214\375C\353Z\334\r\004\005#N\002\337\035b\004vg;\260\213R\307\374\253\376\371n\022@\037\256\304\017\264\335&\334\315\252\223JD\323\302\336`\341j7\331\022\377W\267/\031\331\313\353'\322-\304\315$\304]A\210{I\t\351\250H\210\233H"
+	.string	"\356\007B\334C^\346\336@\250\200\020w\220\217\271\023p2\367\037\177\363\036\n\235\315\273G\210\033\200\0207\217\020w\360q\357<n\340\343v\037\367/"
+	.string	"\3566"
+	.string	"nv\210{}\334/\304\215{p\273\005\236)mP\217\261&\347\255*_\256c\2710\3618\3677w4w5w6\3676o\273\275]\214\323\031]\256\245\242b\364\214_\034\314\321\345\272DTL\330\261;\270\305\347\272\203\r\345r\3559\242rA.\355\323.\356\345\3658$\260N\032\026=\377\354v\340>\355\360\225\336\341\334\315\363\222!\207\371d\211\253\030\307\317\251e\353\267\377C:\372\337{\035\214\325\276?\211\226\2313\266>\373\023\202\364{\304\253/\0227\347\314\276\321\2211\246_\277\365\232!g"
+	.ascii	";\035G\372\243O \374\377\337\335\214-\315\276 \334\312\371\364"
+	.ascii	"U\222\344jw\320~\231\270o\036H}jE\364\017\336\233}<CO\364N\347"
+	.ascii	"\253\024\254\316\n\036Z\337\222\023\237\276P:\311\247\276R\243"
+	.ascii	"a\226xlm\260\326\370\320/=\020\0340\375Fq7\257\224\241w0\316"
+	.ascii	" \206\030\376\356\227\212O\247:\251g\371Ls\266i}\250ez\314\206"
+	.ascii	"E\303\230\341\241u"
+	.string	"-q\265\205\252>\325Vx\246\017\212kF\227s\375\212y\036\0137\347\254\244v5'^+\355IT\264\316Vx\237s\006\3171\263>\2611,\\\305Y\312\226iZ\344\232\363\220\013\036\347LQ/s\250e\270\332kW\376!\270\371t\\\025a\213\255\277\233\021\302\303o\360\335\0326`w\372[\005\321\372+\307\001\375dt\224\"\036\245|\234\224\311\242Q\331\036\215\312W\032\235\232\214OmQY|\245\261*\231L\321\026\225\032\242\232\220NQ\033\216\310\fN\306*\245\261E\024r\300\213\025Q\037\234\214\307\250\246\247b\260\210<6A\261J#T\223QYE\345v\321\b*\251\2242\032Q\034\221)\242\222Eb\024\262\t\212XTR\021\215\026tR\312\250$V%\223Jb\220\f\313\237H\367\352\n\277\350\237\356]\\\035\326/\233\005\032\225Z\262\r\t\023\330\361ru\251\313\372\253\264\267G\226\225:"
+	.string	"\357l\363"
+	.string	"\036\227i\362\370\340\363"
+	.ascii	"\2339v>\350\0337\373\240.\364\301\007r"
+	.string	"c\272\300\337yg\362=\360\021\334\321\220Ct\205\212\336\375\366\216\306\230\265\367\307\035\224! \2766\325IsQ<*\360\277Z\211\307Oih\017\367+\344\005s\037\321-a\303\177\366\372\353yws\247\201\206\203\016\027x\341?\261\214\027\314\315\231\351\316\306M\034\343\365Z\373\375r\276`\255\263\303U\n\305B\307,L\026\336[s\316\331]Y\241o\241q\215\265H\037\200\237\250A8\307\020RJ\215\210H 2\323\2441\200\002\021*\243z\021\2209t4R\320BZ\003\330|\260R\230\352\340,\260\005\253\366\027\306D\244\251v\213\264\325On\261\r\215K\266\265\006U\216Y\013\363P\304;~\262\275\235(\361\360\021{ \323\202\234\2676w\034\035\332`\222\251\203\267\312\267\264\035\270&\356\310\367\341@\023\"\246^$\267(D\367\204\230\355\253\"\225ts7\370\225\030oA\")\243\365\201\002\226\321\363"
+	.ascii	"`\363\3761\210(/\246\2105\220\003\005\321\223\231I\203\323\037"
+	.ascii	"\232\177\221\033\305\263\337\377\262\3739\371\265\377\327\344"
+	.ascii	"\3671`8\003\237\213\230\236M\360\271UE\374\244\326\t\005\342"
+	.ascii	"2 6g\020;\234~\007\366$\366\241\200\240\374\305.es\336\017A\327"
+	.ascii	"\211\262!Za\271\021\234D\2172\200\224\334\354\224\217t\201\001"
+	.ascii	"~\001\274HS\340l\215\350\t,\356\330\245\305\326\030\233\210\365"
+	.ascii	"\034k\356\245\345\003\335\364\013lAy\354C\022\314\300s\301\353"
+	.ascii	"h\364\250Q\020(\204L\300\245i#\3407&\330\n\r\304\226\024\031"
+	.ascii	"\320\263\2067\207y\271\246\f\001\247:*\201\206\340\243\337\235"
+	.ascii	"\321h\321f\001\345\250\355\020X5\331\346\017"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.29.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\f\006\225$"
+	.string	"\332Al\016I\200\234Q:\037\302\204\364P\354\264\322\034\n\256\301\376\252\020\024S-\006\260d\020|({\301\001+\236\374c\033\330\357\201S*\373c?\0045\177\f\243r\214^\224c\177\214\001\212\233\002\305\326\333k\265o\215\020B\210\334I\006\326"
+	.string	"\302"
+	.string	"\326"
+	.string	"W*\3477\314PT\317\274\304\377:\221\037\271V\344\306\245\033Q\021\340r\2713b\327\031e\005\365g3\270"
+	.string	"\364C\016\266\364\342\212\236\246\342\365\321\214\302&P\023\324\237\366\036\207\376\354\271"
+	.string	"\364\347\211-z|\305+L\273PQ!.\370\311\r\324\237\354"
+	.string	"\302\022\257\003\234|i\030t\225\001\036\311\356-\346\372\306\327\323fj\212\236f\333\225\357;-\r:\376\302\217jlF\3008U$\226\325\220\242\272j>p\"\253\262\265\001z9\017\250\241M\337s\357\255E\001-j\372\310\270\002#'\352\311\304m\271*s\036PT\366t\262f\223m\023'\314\021|\330\rp\201\2322}\224N\326\374x\353\"\352gm\032t\357e\033\214\222:\327\316\314Q\230\231\004\363\251$n\254~\355\273\235\342$\334\321M\356\371\n\372&a\304\322d\3330_\212\216'\212\210'\272[\326\275OM\356d\204\371\255\237<\244C\037\374\311\327\241?\337"
+	.ascii	"~B-O?~v\3117{\344\217Ej\220\331\350\204}\220\177<\r\031CY\246"
+	.ascii	"lj\037s\321"
+	.string	"g\333\006\363{\271\\.\271\261\230O<\363\260\345\235'9\343\276\344\254\303\226o3\3136\325rmf\231\246Z\236\315,\253\251\345\224-\243\247\345S\265l\262\345f\3136\265|\003DW\204/\242\376\002\315\275\302\345\233\233<\237\350x\222\177\311O\374\213\277\221\237\314g>\222\257\344a\\[\322\253\031\205\311\017\352\221#Yz\222\024\346\035\026\003L\326\036\253W\317S\373\030\327\263~\332j\337\f0\016\256\371f\326\257\213e\225Y\301\036%\213L\332\307a\034\242\261`;\224\250h\347\3041\216A`\231\327 \253\020\373 \332\251\024+\247\366\335\246\345F*\035[\277~\306\276<\314\n\0064v\357\225\360\023\314=[A\177\236\3153bi\\\237\235c\034\2061\233\337E\350'\353^\246-\347R\201-\b\t\241?q\335\307'\037\374,\327r\201\277\305\0304X\r\350O\263o[\302\266d|\r\231\354r"
+	.ascii	"\2245"
+	.string	"X\350{\250N7\221#l\214bv\354\231\234\310\006\016\035\354\203:\375\260\353$\273\224%\023pU\271g\333\240\362\356\033\017\017\335\250\026\313i\250|U\346W\324v\2171\216\321\261\314 B\330\007m?;\026F5%\336\220R\207\236\215\267;\032\332\361\224zj\211]\021\322\220\t]\332\353\355t\272\024\275\224u@GI<\024\273\335\210\"#\"\244$]\016\311h\350(\247\343\365r@\0078\t\305\216\227SJJ\342\345j\305{\3636\026\377xU\331\203\013(6\343\351\006\322c\b\024Swf[]\313#b\347\277\242\267v\301\314\267\346 \246\376\361\212\242\n\363\336\032\024n\344W\0261\357\275\227fk\236>\034\244\255\013 \275v\224\375\330\031\253\026\352u\311\224\374\225\006\372!H\242\275\267\326G^\255^5\253\247\223\tE\310bS\353\037\177^M\241\001\306i%\0302Uf\013N\353\235F\325"
+	.ascii	"\237\374\330\033\253\226}\220\3266\t\246+\351\223\033{\226\263"
+	.ascii	"\024\224k\325AT\225T`\325r\250a,\305\020c\210\b\215P $I\222\306"
+	.ascii	"\220\002\2211:n\021\200\255d54\005\246a\r`hH\246\224\372\222"
+	.ascii	"\214\254\364 M~T\366\313\304\251N\2621\321\313\337\360\001\333"
+	.ascii	"\321\331;Q\2036\221\374\231\035\356\016\372!\002q\261+\261f\236"
+	.ascii	"\332d\247\331\231\001\205]N&#[\256\215\306q\331\037J\240\214"
+	.ascii	"s\226\031g\317\371\343\027s\033FF\260@\337\277\267\311\300\260"
+	.ascii	"\305\003l]\027?G\3072\266\002\024PQWxsyG\3074EoS0\242\004'\202"
+	.ascii	"\373\233\213}S\200\377,\210\334\240\263\013#\204\306\310\220"
+	.ascii	"\262\221]\007(Q`\207Bw^\002\211\343\353\357\330\322G\370U\202"
+	.ascii	"\035\255\003i\346U\237\340\340\266\3476[\234Rr&z\352\331\034"
+	.ascii	"y\274,h\b\361\002@:\030-\3628\332\004\371u\313\1771|\313n9\001"
+	.ascii	"x6\354\301uh\324"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.30.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`g\002M\024"
+	.string	"v\245\203I\320\360(\035\370oj\027\204\335\203\264(\370$8?B\3201\237\217\035\212C\333\204\021d\\ \246\325\222C\361\266\301\375\204\206\375\2055\001P\017\f\360\305\003|\232\231\240\205\034\302?\260$\032D\240`\2405!\204l)S\nr"
+	.string	"g"
+	.string	"k"
+	.string	"0[\351\243\207Y\300\366##b\232s\242\326\307{9\336Ra\377\b\301\317\223\2530\037\244&\376#\001\207\032\234\207\262D\307\205\315\321N\322I\320\340(\030R\223\351'Gf@\314\036\203\346F\226\330X\261t\234\214zR\300\234\023@\r\203l\240\264ZL\345\b\233\357\205^\202\003#\266KQ\263\271\202(sN\353\254Vs\203\334\366\217m\024[S\001sz;\330'\221\007\335\341o7x\365w\265w\265\274z\257\326\253?\300"
+	.string	"\216\030\022\n[\211\335\215s\246\211\307\324y,B<\350\277]\355\3337\341\013\375\304G\330\203\234#\211\031g\r\034\312\321\315\b\341=\222\217|\367\344\t|\367~\234C\374"
+	.string	"\002\354\267\027\022q\2343\337N\216\212\033\323\234\243\311=;\b\35797\220\356-\217\003"
+	.ascii	"\355)d\262\335dEj\362pi\226\373=\356\241\f\033\220\254HOtpi/"
+	.ascii	"\237\\\t5bT\207we\017\331\r\270\273^N\246\001F\233\254w\356\013"
+	.ascii	"WW\276\220\001\305\264\351\036\305Ki\006\017\367\264\b\220rv"
+	.ascii	"2:1m\262T\373\202\213~\366\275\320O4f\354\320\305V\3349\247\270"
+	.ascii	"\313c\217\242~\316/\226\225\352\365J\001].U*\325\342\002\235"
+	.ascii	":Y\261Z,*\325\204\n*\024VX)\324\212J\312\n\225j\271P'\n\314b"
+	.ascii	"Q\265P/\026\253\205\n\031\247x\024\230\215\211\037 \352}\365"
+	.ascii	"\331,\013\372\231\027\354Z\350bV\364\222\210\017F\341\267\252"
+	.ascii	"\344\372\3668=\3203\372\200\313co\3373\324\342\242\237y\322h"
+	.ascii	"ClE\347\216v\222>)\301\025Y\032\321E\366&C\01615 p\002\031;\263"
+	.ascii	"\003\252tB\303\240\261Q\033\354]\344F\024CQk%B\177\023{%\214"
+	.ascii	"\252v\247\263\334\237\272\270\205\252\273\200\254r)\241\206\221"
+	.ascii	"\306\221\n\261Jn\360^\372\345al\275\266\321\013M\353\303>\302"
+	.ascii	"\356s\354\301-\031\257\321X{H[\007\207[V\314\330%]\222\313\345"
+	.ascii	"\216Qw#ay\256\0361\3749\367=\2607\2605\223\\\277\307%\204\310"
+	.ascii	"\353zO"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`\334\003}\022"
+	.string	"\226\235pJ\340\320(\035\360\235\261E\226\035\317\203\353"
+	.string	"\323\0224\305\331"
+	.string	"\204\001Ly\b9\201F\036\013\334F\212\225\304\204m\0063\314\320\0362\3140\303\\\313Y\214\217\331ed\360\210\227\037=\330\315\243}\322\371\245\372-\215X\235\266\334\001a"
+	.string	"_"
+	.string	"Y"
+	.string	"\317\345r9\001=2m9\266\020\001\032\204i"
+	.ascii	"/m\25183\341\322\037\265\321\322+\312\362\022\305\200\310\021"
+	.ascii	"\264\322*\n\353\020\036\242\251\355\250\264\211\306~`\344\244"
+	.ascii	"\264\bEiy\334{\357\253S\364s\362\250\343*I8\225\210\346\234\335"
+	.ascii	"\025\305Y\2119{\316\0263\356|jnN\032E\347\234\036=\001\027\274"
+	.ascii	"\321]\250\321\353\3100\022\0314\234\274\267\246wK~%\227z^\334"
+	.ascii	"\b\273\327\222\277\"G\256C\330\235I\216\311n\214\260{\204F\221"
+	.ascii	"\351\023\b\355z\320)\016Z\245A\2570h\226\005\rS\320\254\004\375"
+	.ascii	"\202\240ab\272\345@\273\360\235\3359Y\2616a6\320"
+	.string	"$\005\032\204@\237\006tH\0035\376\300\321\201Ad\337\211\374\032q\273\243\211c\303L\315g\317\"S\036\231\005Z\311\336\305'\261\347Z\367\275\325}\037w\205\220\256\"A\352U#j\f\353\3012Uo\311\257$\341\302z\022\311t\247F\001(U\3175\246C\034\\\244x=\217a\375\204T\275\f_\005\217,\323\303\361\024\242\211\3601\001\357\331\360\312\203\316\207\017|\367\303\323&\343\006\250\004\276\305\277\367\316X\360\336\310\\\341F\203\3032\275+\231\236\330!D\243\304\364\3264\375\303\251\354\277R\304\376\263\251\366\337\310\017\232Q\343\266\262'\221*{\222X\355+\216)\n\032\213\021{/? \300\002)\"\242\007&\206~\350\f\315f\375\364]sFI;`\320\201\r2.\003wep\036\255\253\317\204\233\247AM\243\306\371\202\267fP\227\355\313\246,\213P\354\033\372F8\365\030\034\30118\202Cp"
+	.string	"\207\340"
+	.ascii	"\016\301\001\034\006\207;\220o\227jla:,/ \372\332\016\313\b`"
+	.ascii	"\214\033\370F\031\237h\0240\301#\334\337X\377\021\252E,=\310"
+	.ascii	"\030i\215\261\303n\346W(\243\357\235\301p\260x\243/\311ZO"
+	.text
+	.section	.gnu.lto_.refs.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375 \211\315\002"
+	.string	"\362\207\023\027\220)\351\377\377\377\377?\253\006\321\261\204\276\241\306\033\327\266\272I\222)\272\320\016j\302z\330.\333d\213l\317:\355\265"
+	.string	" \362\314v[!7\223\271\240e\324g\013\264\206Z\242\003Fe[\333\367a\034m&b\253\330&\326\263%\265\021\002"
+	.ascii	"R\221\217\346\245\314"
+	.text
+	.section	.gnu.lto_.decls.a1d85e2c114889f,"e",@progbits
+	.string	"(\265/\375`G+\025\272"
+	.ascii	"*\032\221>X NI9\351.\\\320\373\030\374\226\340\340\177pZ<\377"
+	.ascii	"\227\024\373\"f\\Uq\324W\361\207j\260\362c\303{\\w)\3766\007"
+	.ascii	"\240\244\032\355*\304/\262\npe\343T\3148\206\032.\220\244\030"
+	.ascii	"\225\237%%\273\304\361\236\200js\305\346\345\366)\224\364D\213"
+	.ascii	"{K\231\002K\003\316\003\371"
+	.string	"\003\f\306nO%\374\240\363\343-\f\310\177\314\307YX\0137\271\217\245\234\247\260]2\254\217\335fL\240\253.\017\204\215\025 a2l\2605\374n\003\"\245\n^T\2540\026n\362\225\343\244\367\212\205\360\353\\a*\274\307nO\351e!\002\274$?\020\032\200\240\251R\003\035T\320V\2519\222b\355\265e\275\227'\031\330P\224\235\334\344\274S\231\271w\203\363\nW\331\225\337\3110\251a\365$\311y\026;;\207\201\234g\035\347Y\353<c\235?\313Eqi\256Yy\322\026\254\343\332\216\210\254\316\r|\023\364\3007o\354&sWCJK[\206\"\206\363Bd\t\215\031m\317M\347YH\312`5e\276\204Yi\345\205\240\204\315j\223y\032\021\231\312\013\0331\002\253\261\030\203\325 7\\\2428\032L\366\372u\324x\t7\251)3\005\253\255\274{\357y\354\3279\253\261\021&\253M\346M\022\335"
+	.string	"\201\264\022\006\325woz~\302Nx\215\333\270\311jg4Nc\257sz\225 p\202[t^^3\366\334\004\354\205{\223\367^"
+	.string	"\300\260%i\273j{\2353\223\233\340\322Szmb\260\316^Li{\030\316 \337\234\37501m|.\230m\037\202\262\316\002\034#\322\366.\234g\341\344#\214\204\233\037p\222s\021\036\273\313Pz\3233J\236\324\223\266O\341<\177\020\254\201\201\374A\360&\234\3157\301\r\0208=p\207 \017\341/nr\3004|\304\b\257\310\257\333uojC\263\305\307\226\277\266\017\341<\023y\006_w\204\237\347\231\203 \0072\007\301\367\231\303\035\202\013\340\016\301\237\203\374\f\204\273>\250\312\243\345\025\2737\345p&\317\214t\265}\312\035\202'\337\004\377\346.!\3532\177\035Fa\030\r\201\237\355\372\001?'\333\001-\272\0012\232\001U\232\204\036\341ga\213\240\363W\017\374\274\326!\374=\342o\235\237\r\320\013H\342d\005-\302\255C\264\002\022"
+	.string	"B\203x\341$\374U\002\301\277\312p\r#u\316\317K\372\003\004\374l\244\017\340\207\305"
+	.string	"\177\177H\372\360W\016\006p\3736\177\363\265\2407\370\031K\013\340g\300\016\300\377\265\2775\bj\234\277\001\360\367M\007\177E\333\324\376\372\202\r\332\306\303\337q\375\327\235\255\021\264\314\317):\246\346\257N\330G\303\374\254\301\007\036\202\377\037\374?@\237\337\3009\370k"
+	.ascii	"\332~\003\020\376\303\3745\003w\371\353\n?Su\275\375\353\t\177"
+	.ascii	"o\371\231\357"
+	.string	"\347\275\237\361~\276\373y\356\347\270\237\337~f\373\231\311\317G~\376\361\263\216\237q\374\314\374y\353\347\254\237i\374\214\365\363\325\317U?O\375\354\364s\323\317I?\253\370\031\305\317\367g\026\374l\374\331\004?\017\340g\016~\356\371\371\202\377\201\377\241\374\314\363\277\354g\232\237_\370y\004?c\360\277\206\237A\360\237\206\237I\374\254\201\237[\3709\003?c\340g\026~\376\340g\017~\376\360\263\207\377Q~\356\340\347\016?\337\374\\\177\356\237\371\347\377w\373\337\365\337\002\377\331\376s\b\f\f\f\374\203\\\277\013\320\357aCAd\330MIA\243J^`\332X\232p\235\265m\266\024\226r%l\312T?\241\201\241\003KR\356|\360^\026.\351]\"\232\t\262\013s\316O\303\225=\250\3775 Az\221HtX9s\220\rA\265\2759\367\"\227\224\315*$\007es\350*ipc\342\240L/\025"
+	.ascii	"n\363\352*\323%\322.\221}\323\233\254b\272\311%2H\231\336\245"
+	.ascii	"\233.\221\033n\222i\2032\035B*\233UL\254l.\2318\334\344E\336"
+	.ascii	"\344\020\325\231\\2)\235,\2316(\233CL\312d\025\023\337ty\371"
+	.ascii	"\355,\255B\026\335\346\020\315\275\367(e\"g\356\035Z\272H\270"
+	.ascii	"F\272UyH\027\306e7\037\351\325\275\367^\244\030\235\325\022&"
+	.ascii	"%\272nJ\035K\023E\367\322]$\021\220\2144\272DH\276\267(]\272"
+	.ascii	"\227h\371\302\323\222k0Z\272479tDd\265\234)\"Z\032]\035T\314"
+	.ascii	"\244lZ-u\312\300\232\314K\224\"\231y\351\252\226\316&\222\367"
+	.ascii	"h\232YOGi\023\203\247\036Im\341:.\246\310\\\223W\030\\\277\265"
+	.ascii	"\233\026\243\253!m\241\324\027^L\320vt\333\214\223)Rrmo\251\316"
+	.ascii	"v\362\265Li\352\220S\033YZ\263\323z\rgyY|\020\242\004n\251\357"
+	.ascii	"\336'\020f\214\260\351\365\222fR\203#K\027\263m7\321y\253\301"
+	.ascii	"\314 K\001\327\226\003\003o\337{\345\254\306\314h\214\215\312"
+	.ascii	"\231>\251\341\244\255LF\t\214\261\246\266izoj\343b\303*\220\257"
+	.ascii	"\311\230\214vT\301J2\226\303\357\317I[\246\353!5H\016\367^Aa"
+	.ascii	"\366X\007\351!\021\250\203j\352\233\341i50\367V\3411\343\272"
+	.ascii	":\220\222\322\320`m\244\303\272H\037i\261F\302\315\036\353\257"
+	.ascii	"7\221n\036G\207\225<\215i\004\035TS_3o\264\217\232\344\206\233"
+	.ascii	"\334\242\222\0276\326[O\253I\246\036\364A5qu\2155\215\326\032"
+	.ascii	"\221\005\252\t\007\306\210O\313\351\002[\257\223\263\275Z\b7"
+	.ascii	"\317\326\351\355\n\276\035N\332\276\232\235o\001\237-\370\232"
+	.ascii	"\344|\r;q\264\016v\023;\341\307\235N\373\350\035\315\305\344"
+	.ascii	"\202\035TS\337\275\027H\377\340f\373hjPC\003\022/\262\240}s\275"
+	.ascii	"IC\005-\265\321\266y\350\274{\224\220u\365\243m\255\3133\207"
+	.ascii	"LZ\n*lZ\316\267\337\371"
+	.string	"\336;\357\326y\347\333\356l\255\356\254\266\361\326\352\0323\311\326\262\367\0161\177\250a\376\340\222fc\210\210\334\371n\233\321X=\202\334\265\265\225\301\315\306z\307h\254\276\002\222G\023\205\204\205g\255\231\025\2531\335\220zR\325Qo2\226\204Q-e\202\274x\201vm\250\332\214\244\350)\030W1\260\314\320\266\245\304\322\232\025WXV\020y\321P\334\354\250\367S*\303\023s\204\216j\027\351Uz\261rad\206\003\002\304\313\327Q\037V\320\276\177\234-\343\374\333)\206\252\"\210\025\262\266i\327\214\222R\326\262\251E\260\205\020\027FmY\234ZjD\005\266}\2738\227\270\331L]t\313\324F\255T\223L/\362\205\f\312\310\254\017\304\313\234W\021\020k\337J\215\242\223zy*\233|\261\265m\025\275\202\2339}\364F\342\260\303$\323\333\204\221\333\223\022kk\227\316sN\320\206s\202\255\324y\247\350"
+	.ascii	"IZY\333\227^q\236\267\234}\271C2\207&\213\034\021\027\021\233"
+	.ascii	"\305\221\226\244\032\342\300&uB\272jd\337\027\265\026{ym\003"
+	.ascii	"\323\241995\275\363\334U\003\313y\331\305\315M\341\001\205\273"
+	.ascii	"~\035:\216\322%\205\341\372\370\216\257\260\333\323\206\233L"
+	.ascii	"\322\327\307u\001mg\303\n3H\333\372w<\216[\273z\321\266\372="
+	.ascii	"\355\205\355\211\325\224\336\225+\225\017gY\347\\$\371q\331`"
+	.ascii	"\231\021Y\301\362\312\307dtM\276:=\275\272\247\205\371\322\302"
+	.ascii	"i\351\257\312\353\036\225\230,MT(a\320\360\360"
+	.string	"\352\335k\362\302\bd\336\251\034i\217\272\272zg\267%\217\243\362\254\244\354^\357\250\330\242\032\266\266\264\255S\252T\rCk\356h[\245\364\020\250\027FJi6\2062 mTss\225M\005\223&II\223\245\266\207AF\211rd3\207|\263\"%.\256Vi\320\202I\006\216\0326p"
+	.ascii	"v\265\375m\365\2157\244DqJf\320\312\325\372r{}\243+\2227\325"
+	.ascii	"\266B\251R6IuYT\332\326'\355$\307wD\312)CM\255\262\261U\n\250"
+	.ascii	"&\230\244 FP\326^\331\376\023\314\006\223\244\324Y\333\n\244"
+	.ascii	"\245$\257J\222T&U\216\323\373t\336\256.\300\274!+\206\274\235"
+	.ascii	"\2752y]2b\204\337\235\\<\344\206\332\326\264\232\2476\263<\264"
+	.ascii	":\226#F\263G\333\237_NLLm\253\331\357Z\307\335\221^\333Z\366"
+	.ascii	"\264\231\247\271>,\262\327!f0bT\t)\"\007u\246\350z\375\352\252"
+	.ascii	"G*\334\371\264T\006\242\365]\345S\216\214\017)<\320hx=\362jd"
+	.ascii	"\304\bO;B\307\234\321\266\026y\035\243\261\007\246\024\253c7"
+	.ascii	"\354\216l\221r\3260\005\264\224\037\225\026\260\317\200\263\261"
+	.ascii	"\243m\363\323\202\265y\274\257\225\365A\265\255D\216Gsd\310\214"
+	.ascii	"\250\232\276\016\361J+\212\203;\253\327\253\220\037\206e$\271"
+	.ascii	"\301\265\005\321\323r\252\321\344\374K\331y\036<\352\017\376"
+	.ascii	"\272J\301\260\345_^\216K_`\234\214\352\343\365\007\233\375I\245"
+	.ascii	"h[\271\330\2549\265\346\327\266\3668\3361\311\345#)\370DI\213"
+	.ascii	"_\f\035:j\025N\016\256\323i\210^\023\023\016\034\025\213m\324"
+	.ascii	"\031\231\365U-,\220\264\265\375K\021\223Y\267\356T0\357STN\214"
+	.ascii	"\024\022\332\025=\0336\352Vp\005`\247OoQ\266\320\234\310h \265"
+	.ascii	"eeU\254\005\334\260\013\206\321\240Q\261\352\224&Ff\\0f(\202"
+	.ascii	"`1e\310\250X*\\\032Bl\240d\230\353\361\212u#\207\325\021\324"
+	.ascii	"\325U\255:\357\275uG\314\230\026u3\214\264}p\211\212\252V\235"
+	.ascii	"H\016\013|\312qyj\322\"\360\n7k\025\234\216\255\"\200O\177\252"
+	.ascii	"S\374t\221z\"\3348\202\361:U\305)\016\331\266\276\250R\313-\027"
+	.ascii	"}U\252F\2711!\267\240\320|\375Y\335\n\325_'\332\f[-\332V\027"
+	.ascii	"\f6\223\203(\016+\013\f\217\027Ydv\347_\235\252S\324\fS\223\027"
+	.ascii	"HkKK\265\251\231/axF\362Z\2746\241\005W\240Q\211QY\310\274\340"
+	.ascii	"\373\373\253,*\323\0168)-\026*\030\201m\0319:\252I,\2464\003"
+	.ascii	"\322k\222\026LX\036\220\"B\214\214\252\212\263nJ\212W\025h6i"
+	.ascii	"{K\\\264\255\312v\202\211\252Q\005\220\301\\\254\260\330\221"
+	.ascii	"\315P\207\352PE\201W\223\257(X\211\\"
+	.string	"SQ\333J\324N5L\2424\033h\365\211U\034\321\362\374\033\020\260^\234\257\213\254\211\203\212\002!\250\242HE\326\205\351k\212\013\3226\360[f\226K\301\262\030d\340h\033\330da*\220GW~\245\377TxQ\232\362{\377i\321\034\371\342\221\327\266\261t\026\033\273\032~pe\351#[1\326d1\223n\341\021\310\327E/Js)\237\332\022\311\251\355]\206\366\232\275\327h8N\226R\020n\365\316\267\\\317\275\351N\327zl\203$\353i)\347\357\273\267^\236\313\234^\223S\036^LT\322X\r\206\302hb5Of\200a\241rFS\2720\201\335X\322\266\353\332\356e\205ZGa\021=\002\001\241\020\004C\034\316\024wL\360x\350A\211>C#Q\210\006\003>A\265\007\355\351\331\t\262\271\211\020'\320\243Q\005F\021\303b\317\0062=;@\027\360\t\n\276` \334\300\2078D\213Bt"
+	.string	"&\214C\342\260D\0067\021\342\002\033X\201\004\007\204*\220\240\300\005P\2301a\024\372)\321\341\210\032\211\303\342\321(\002\355\021\372\341!\016E\024\215B\"2\370\371\021\"\022\201\210/("
+	.string	"*\2328\002\021_J\354\240?\026-\n\005\331\240\023<'\320\023\301\233\b\301S\344\021\201\203\036wz\202\204\204\307\343\220\207GH\202\016O\221\347\202\233\030\324g\247\bt$\201\001\352s\003\264\001\243\017qx<\242$:\240E\241#\217P\361H\"\203\236\341\317N\00708\016\211\303\030\364g\210\302\t\240\"\n;@?\027\240\307a\021\005\033z\210(\007\023jL\220\251"
+	.string	"q\207\307h\323\203\032w\212'\030\2075\307\342\316\261(\364\t\022\no\216(\t\342\n)\264`\034\302\240+\030\222\330\300B\006\\h\341\204\023z\210\303\0221\347\031\026Q\"\352s^\004\022\024@B\003R\360\202\n\321\036 \026\320\242\320\317p\247\004\315\021\025\242ps\023!\216F\240 !\021\350\304\t \036\021G\324\247\270s\364\260s\334\261@\314Q\0304r8\n\213\307 \230\036\"Z{\210hP\320N\360&B\024"
+	.ascii	"\006>\n\321 \025\f\177v\204\302\"zb\007-\036\215B\002\240\200"
+	.ascii	"\213h\211\022B0\004\217;],\242\365\007\b\250\002B\027\240\037"
+	.ascii	"\242\320Y\004:\356\020\207'\212\3501\346(,\242=;\250\n(\fB\236"
+	.ascii	"\241\317\316\211\263\003&\334\034G\204`<\016a\260F\2411\205\026"
+	.ascii	"zP\037\342\216\t\236\231\343M\204\360\t\022\341\023t\303C\024"
+	.ascii	"B\341\210\032e\210%\372\210\032\321\242\213Q\250\202\342\321"
+	.ascii	"8\364A]\360\t\2321q\364!\242?A\243\021-\366\364\354\274\250 "
+	.ascii	"\b\210\307\026\217A\365(\354)\002\361\240.\324\334\203\003\005"
+	.ascii	"\241E\021G \240\242\b\031\237\240\356AK\300\263\023\024<\nI\320"
+	.ascii	"9\321\025\f\215\366($\372\004\271\020}\202*\021hh,\242'x9\n\033"
+	.ascii	"p$\016\205^\256\243c\202\007\016` \205\223'\304\t\240b\020\212"
+	.ascii	"\n}\206%\210@<\"\210\303\235\023\"x\212F\021!>\030}v~J\270\004"
+	.ascii	"\031r\231\002\007\344FW\235\262YR6\371\001\251w0\200\177_A~\240"
+	.ascii	"\220\t;\013\214\363\321t6U\364\306\205U\201*G1z\324\275*;/\251"
+	.ascii	"\266g\251\230\022\214hF\333\232 \017-\2432\035\225\315&\265T"
+	.ascii	"\241\310\321e0L%$Kp\330\254\323l\255\351\352\206\215\240\333"
+	.ascii	"Y\335\021\263\377\202{\310\0375f\260Z4Lx\024\275m\325\267\030"
+	.ascii	"\031oY5pb\302\260\322#\247\213,5)[\243ctE\315\3357\0325\251\002"
+	.ascii	"\376\021\021\233\301\304MH \r\254#6pWC[VV6\006\314\322\322\275"
+	.ascii	"O%<\321\222wu\033\003\214\346\306\320\f<&TT\365^\030\200\314"
+	.ascii	"\030%g\224\006\333QW\303\3028\201\030\331!FD\352\312d\261\363"
+	.ascii	"\242\213\342\203\271\342\322\001h\241\266\260\251\345\235u\372"
+	.ascii	"b\306D/\251]\350U)\\ESOV\206\231\263\262\264\252\356\030\352"
+	.ascii	"\232\222\0243\264\265M\265\005Z\356\035\262Mm\235l\f\267Mg\376"
+	.ascii	"\300\374\301\346\205\216K9\024laY\234kdC-,\323\231dE\336\216"
+	.ascii	"\023\t\311*\255\020\364\227\344\227t\253T\325^\030\341\270q\324"
+	.ascii	"h\334\203H\032\220\025U\205\222\317\307\236UQ\177\2405\311\322"
+	.ascii	"\266\266\310\026Y\345\211t\322\224\363[\243[e\247a\315\305\305"
+	.ascii	"P\235\277E\261\226<K\312`\223\265j\314\305\f\253\266\267\327"
+	.ascii	"\016\221\225\341x\n\300\021S\314\"o\207d\230\320\240\364U\303"
+	.ascii	"\034\223\026\220\276,Y\352\026\254\243"
+	.string	"$\277\276\t\030\r\371\003|\335\262\304c\262\265\255Z\002\203\354\250r\361<\306\362\2302C$\"\"I\222\2441\242\n\020\204\"Q\242\bn\017\022`\025E\217*\310Dd$IR\2306\003!\364P\3014M\025+\335\017\225k\246\030g|\332`\346\013-\264\374m\240\177=\276\201EB\f<\031h\260\361\365/;2f?\260\252$\344\343\022,N\307\304#\321\331E\201\227S\225\362N\333D\336\215\345\264\372E\273\242-\005\317&\r\022\306\022\220\200OKn\321\203\323\237\322<\375<DB\t{\224M\237\252_\337\230\30649\224"
+	.ascii	"UFI\245>Bs\221\317\201\300\353\034$\272\332\006\231\327eW\350"
+	.ascii	"T#r\250\213\220\317 k`\b\206tO\352\314=\306\346\340\021\033\001"
+	.ascii	"v>\231H\212Q\b\235\337\330\365\24298w\031\261\236\275\002\"\002"
+	.ascii	"2\337\037\356\340\020\205\234Q\276[\3712<\341\216\232\331n'\202"
+	.ascii	"\273\003\362\247\222d6\247N\013\002\242,B\037\374`\245q\257\246"
+	.ascii	"t)\377\302\237\206\312\\\347:\030\350X\233\310\247\226l\345N"
+	.ascii	"H\370\tn<~\264\031\342\026\364sF\253\366W\036z\213>\253\332W"
+	.ascii	"\036\242\274\032\326\302\207\347\363\026\323u\345\005\246\031"
+	.ascii	"\262\246D\235\206\bzm\206{\330X^\243\273\313\327H\\\3234\245"
+	.ascii	"\0316\321\267\316!\314D\213YZ/\221\366x2I\263\376\300\317:\252"
+	.ascii	"\021\3079\020\005\362@\304\212\207\252@Z\225\313\\\f\363\372"
+	.ascii	"N\336\344m\330\037\344\265\r\240\f\032\325\262\035)Gv\232_\257"
+	.ascii	"5\307\n\243S\226\344\037\223\344\276\254joP-+5\006\362\023\006"
+	.ascii	"@o\251'\363\027t-\t\036\030'\312\341\370F>\336\327\333,@\025"
+	.ascii	"\0313Z\036\342\365\016Ea\360\331\206\334U\017\257\376\233E\022"
+	.ascii	"\365n\253\226\242\245J\027+\316F\265t>\217Ky\341\370p\221\216"
+	.ascii	"\222\r!\234\261\200\216@t]\353\270\323?U1Q'4\326\213\300\002"
+	.ascii	"\200E-\370\244\016*\332Z\\\233\026\324j\210\235\212m\362R[\374"
+	.ascii	"\234\236\311\271\352\024\n\217\006\273\266[\362\262\353\324\344"
+	.ascii	"\265\330^!\226\026/\276'\312dY\271\3616O8cj\036\303v\0205\201"
+	.ascii	"\237?\304\276\361|\211\217h\263_\201\005\"z\307<L\030_\205\244"
+	.ascii	"\301O\035\224;\266\221\353g*\230\233\261\030s\303.\247\334\355"
+	.ascii	"\302K`\037[\310\275\265Jws\221\367\245f\r\023>T;>\256\3742m\270"
+	.ascii	"\025\231\331\346\217,xc\336\327\016E\236\324[\t\005v\226\332"
+	.ascii	"\3143w\273P\267\320L!\221\234\250:\257Y\355\317q\036\200\305"
+	.ascii	":\246e\317\007\016\343i\020C%@!^\030\366\377\220S\304\325\006"
+	.ascii	"\2626H\021~\0303G\377F\304\r\332W\004\265J\245\350[\224\006\203"
+	.ascii	"\337\261\307A3t\252\3050\354\307\370n]\362rp$\244\177v!\016\325"
+	.ascii	"\224\005\224?zJ\354\b\\\364\034#>\345\207\375\035\031\254\b="
+	.ascii	"\266\204\037\203$\f\250$\3373\013W\204"
+	.string	"2Y_g\026\0016\330\202I+M\212\304\312\373{\331\217\\\206\321;%\232\r\f\004#\007i}\033\2361\314rCi\372\006s\315\336\002\307\306\002\030\203H\214\332)\371EF\227\241\026\206\352\024k\033\324N\364)\343\026\277I2\220P\342\237\036G3\271!G\255*\264\342\211K\334W\331*\336\220\263\3201\322\357\t$^\313n\013MT\331\227\361\335[mC\330\365\345$\020\004.\237\235QiC\325\222\263\005M\303*\274\231@\360\214\325\317\215\3423@}\214pG\n\216\016@\037\013<\025\277\004\026\360^\270\364\324\351B\214\3063\357\375\006cI\022K\275\256\304'\350\266\336j\037\033\347_\020\370\365D\322\nIN\250\013\327\031h|5\352\365H\220\2573\2354\357q\\\246z\222\2778\210\376\016\223\254R\023n/\025\336\341JG;\244\332Q\211{\367\013\232\212.\247F\033\253\360\346L\034\357\271"
+	.string	">_\256\203d\331\240\312z\265\231@n\017iL\323\021\371\030\373\314\277}\254\345^\n\027\341!8\353J\001\026\256!\356\304v\302X\221q\366\203/\224\nn\302\340\1778\324\273\017\n\fq#\333Q\327\002\305\340H\340\023\026\300TDX\013p\325J#\262a\243\002\030z>Y\250\n\f\322{\272\030\020vc\331\241\303\302\261\200\201\304\305\334#\334\030\345\002\031\202\001N\210bT\nV*\"rr\274\356x\206t#\362\266"
+	.string	"\f5\\\177<b\246v\315d\004P"
+	.ascii	"V\306\b\336`\373SF\354\365l\003\205x\271\345\203\030sKe-\356"
+	.ascii	"\260\256\022\263\326<[Hj9\363\211R3s^|\276G/\026I\236\343\232"
+	.ascii	"|)\362c0M\370\314\020\023U"
+	.string	"bk\200^W\353\026QVe\2461\276\b\212wbZ\327\200k\256XD4\231\277\273/\035\333_h\327\005\020\265H6\022'8\352\342\252\304\331\334\366_\345\230fB\027\3622\032\367\324\340DV\376,\373\374\236Z,Q&L\335-\337\272\310\262\236\325\024\206\350\t\360\r9\356\301\336\264\363Z\016}\341\216t7\227\242\357\207\2301\035f\344\013\305\362 e\241\203{\004\342\212\373\003Y\3221\326_\353\260\217\007( \021p\3727\250\334[\355\024a\n\373\210\372I\317b(V\357\306\002\243\255\352\207\211\212\333\375\247i\232\020\001P\321\231\n\022~\320\356\343\306\037\343+x/<\0344\351\351\016:\342X\255\231\2147\374\277\204\332\240\320o\0347b|\022\243\017\f\225\006\201\274\234\260\033O\226\035\210\362\350?c=U\020\024\005\375Bd\240\236)\316 \353N\013\236w`\365\fH\222\337\372\005}\033gh"
+	.ascii	"\253\225\236~\356\301\371\277\036\340r\350\313\033\215\025bD"
+	.ascii	"p\260\007x\316R_=\215\t\007\210\271\215FP\037\346\377\016O\025"
+	.ascii	"\370i\nl\3358\372e\365Q\234\227\353\300\003\2677\230\257\215"
+	.ascii	"\036\254|\374\274\353'j\230\200C\216\231\212\361i\235\343b\372"
+	.ascii	",\231\245\323\337\006Z\352\265\243\362}\324\317\003U\343H\007"
+	.ascii	"l\373\334j\213\001w\252\334c\347\003P\3570\320d\207%oK\312\224"
+	.ascii	"\340Uh\326\330v\251\277\214v\241}\013\310\\%\237i\177\204\345"
+	.ascii	"W\362\355\345v\246F\343\367\370\t>\207\345v\033\340\271\356-"
+	.ascii	"\330j='\214\276\336\246\177\017\306\024\255\037\024\177x\267"
+	.ascii	" \334\220\177\230\023\361\236\335\2378\300)\375;{:\337\305\243"
+	.ascii	"\233k\f\224\357\365\203|\266\355Gy:}\001|\362\366\031\264)\340"
+	.ascii	"\2272\364./\037y\002\360%\325C\0301\245\375\322O\316\017\344"
+	.ascii	"\b\241\274H\347\330\330\241]\266\2711\375\006L\264\256\227\356"
+	.ascii	"{\352\356J]\215\\C;\3100\354\351S\367\034\36273\216\f\321\256"
+	.ascii	"|o9N\235\257\"3\350\375\214\231c{\343\027\206\213\345\206@\346"
+	.ascii	"\342l\204\263\370\033\300o\210=\177?\016\373\350\n\237?2\242"
+	.ascii	"[\022\317=&\3439\257|\001\342\213\362\265\271-\351\303\364F\334"
+	.ascii	"\203\035\376\001\240M\264\275n\232\323h\254\rl\207\313\316\362"
+	.ascii	"V\250\333o4\220\275\375};qO\247/\376\3143v\306\224\312\253c\344"
+	.ascii	"\276!\357\221\343\315\371\354\374%\374r\271\232q\343>\037\242"
+	.ascii	"\354D\341\245\360\376\023\263+x\003\355\034\013\376\266Kx\222"
+	.ascii	"\375\255"
+	.text
+	.section	.gnu.lto_.symtab.a1d85e2c114889f,"e",@progbits
+	.string	"loadEEPROMFromFile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"config_streamer_erase_remaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"config_streamer_start_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a1d85e2c114889f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
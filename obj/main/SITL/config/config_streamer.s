@@ -0,0 +1,558 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.981244649db993bd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.981244649db993bd,"e",@progbits
+	.string	"(\265/\375 \347\275\004"
+	.string	"\244\006\333"
+	.string	"\f"
+	.string	"\253\332\330\232\013"
+	.string	"\001\330\355\273\207\006\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\327\214\262\210\007\006\002\003\004\002\002\003\271\275\275P"
+	.string	"\004\257\371\247\356\n\016\003\002\002\005\235\324\263\222\b\006\342\337\363\300\005\016\005\002\005\002\006\007\266\266\306\373\006\b\355\363\303\263\003\b\t\247\227\2044\b\001\002\002\n\272\335\241\341\005\006\013\240\342\234\212\n"
+	.string	"\022"
+	.ascii	"|`\334jA\035\252^\002\020\024\033\241Z\001\007^\234\356$\344"
+	.ascii	"\f#\363n\327@\324\002\240\"\200S,\231\231\337\225\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.981244649db993bd,"e",@progbits
+	.string	"(\265/\375 \350\335\003"
+	.string	"B\306\020\027\300\245\320\001\377\377?"
+	.string	"\374\377\377\353\355\005\255\021\262\ti[\312\224\002~\030;#d\n\035\361\006\354\023CA\341\375F\025\303Z\341(\272\020\246C?\020\031z\\\243I+d\026U\241\265ou\003\036\002\026"
+	.string	",Y\270\320\350\fp5\350=\024\341."
+	.ascii	"J\370\260\020\350 \034\302\r4\211p\001\270\b\221C\351\235AZ\216"
+	.ascii	"\250){\240,\2409\211g\f\225p6\200\005"
+	.text
+	.section	.gnu.lto_.inline.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\237\003\245\022"
+	.string	"\346\\\\A \215&\351/b\260\023(\234(P\216:z0\262#\343\247\036g\310\346\314S\2261Y\366\207L\215\350\254\002\363\017\201\303\361\247\246M\202E%"
+	.string	"$\t@C\215\276h\n|\373\033i\255\021\"w\nF"
+	.string	"J"
+	.string	"K"
+	.ascii	"\267\321\303\302\024\364-5\001x)\3507\201\301)\245\271sFsF\375"
+	.ascii	"/\334{\327\355\356\006\2568)iy\237\265\026\024\251\225g\275\266"
+	.ascii	"\257\"VDH\003\023\214q\316\b\377L\353\265>s}\344hf\346{\314n"
+	.ascii	"$\356y\352@\364!R\271\247\321PT@R\340.k\204\017!\013\256\353"
+	.ascii	"\232\327u\232bIy\200c\236\025"
+	.string	"\225\231\325\305\024Y\217 3E\217a\305\277\024\321\204XC\217\2506\036\260\260\202\306\f\210\030\020\323\320W\013\364\260\3064\303\005\241\220\240%\363\035E\311\224\210\246U\305b\333\330\321Xl(!i\266Po`\365\005w\032M\261\244\224\360\315\346f\354)\201\2262\023\363u\361{\235\007\222\323\t\306\356\3619\243\366\247\215\310\314\353\346vo\323\251\204\023\034D\356\243\365\251\005\222\323\005\354\013z\372\316Z\337\247\251\234>F\260/\320:\2000\231.\252o\257\241;\032(\t\023$\005\001\306\2203\3524\303\275]\247\277\367\276d\350\246\242D\005\022\200\337\357p\314\332\327\200\020\236\035\236\371S\b+&\032\312\021d\250A\265\203H\002\021R\220\302&\255\001P\002Ah\252\356\022 \325=\350<\fb\312\265\307\336\001E(\340Y\220\362$_\027\352\254\242\241~\341\242\316\322\\\002M/6\347\363m\021\316\320\203"
+	.ascii	"\203\021\335\213\340V\366=\310G\215\030\372\\\301P\273\"\237"
+	.ascii	"g\034D\330P\337UB\243\352\274i\314\364#\375\260\242\221i\n&\006"
+	.ascii	"\265:[\364\213\035\244\037\254\3347\tx\316\034\255\024\216\315"
+	.ascii	"cP\221\"a\276\344\b01\215\375\037\210\232\2570\277w\310\255\362"
+	.ascii	"\331\t\356\344\332\374+\260:Z\002\242\036\031u\306\271\336\342"
+	.ascii	"k\263y\274\327\265\327\2609\031\303(\005\244\351pJ\375\002\377"
+	.ascii	"\022\304\246\255(\002\352\234Tm\247\372\016\354\252$N\233\205"
+	.ascii	"k/\303\007\3666j6!H\205\2653\323\263\262f\031\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\325\005"
+	.string	"\242\212\033 \240%I\007\217n\032\203\217(\212?"
+	.string	""
+	.string	"QTU5\301\363\376\013K\374\326>\261\244m\222\222\f\333\027Qc\003X \021W\257H\240\003~\0215?\242\205\322%\224\025\301\004\\EYYd\254\251C1\3432\327\227\200J\b\201p\007\345\315\203\273\2422\331\"\332\276\207\376\f\347\234#\355}\031t\267\232\022\223\022n+\332\354\272c\032\004\035"
+	.ascii	"A\271`c\264\301\n\372\"8o\244\341`a\302\262\301+\252\250uc\355"
+	.ascii	"\030G\233D\nH\024\006#\302\220 \305\220\202a|\346Z \227\346="
+	.ascii	"J\021\003\270\374\320^\3141\206\203\225Z\214H@\001\263\260\345"
+	.ascii	"y^\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.981244649db993bd,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\230\004\001\232\004\002\231\004\003\230\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\205\004\b\232\004\t\232\004\n\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\017\001u\007"
+	.string	"\362\311\036%\220'I\007\325\374\222\273\353#\244J\2323\231)\245;\3351\217\270+\334\224\266\007 \"D\332n\255\021\"e\n\033\034 \024\024o\326&\230Z$@%\264\204\026\217?c3\320\327U\365\303AI\216A\320\260\324bF\346\024\217\030\321\334\020\271{\245R\335\315\254\0341\007\241\205\204JP`\3401\343Bz\327%\365t\376z=\347V.\320\273'\371\321\376JR\016\260\361|\b0 @\002B\024[\037^\005\020\227\022H\026\247\352\273\210\037\275\b0\344\340\271"
+	.string	"9\340\276jS$\b\270@\337c\036\003\201\030\334n\357+:\233u\361[m\320[\311\364\033\030\205\332\026\374@83\231\003\201\r\333\353*fu)\343\207\031\263c`\217Ly\342\344\"\023?"
+	.ascii	"\rg\202\234\027\306g\362\236}\201\361\025Sa\306e\324\272\r\027"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.981244649db993bd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.10.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001"
+	.string	"B\253\003"
+	.string	"\2421S%^c\323\321q\227\362\001\030\332\376\212\2358\3406\322\216\267\203\210\265\216Rv\361\347\261x\002\307\305r\0074\353F\266L)\226ku\262\013\344\271\262\221\310\001\342\363\020\302\254\030\372x@\321\312D\261cP,\342\312\342\b\303\262\310\361\356\351\260kC\314W\001-:e\202\233R\0358a+1\221\346\232&/\337\005\334ZoK\270\321z\372\377\302\256u\311\316\251\202a!X\3713fd\376Q(\036\234\266\316\326!\026\321\\\242p\300\337\251\234\374\036B\0256\246\352y\2402\265\261@e\252Z\333b\257\343&\001\301(q\371\037!\2075\247V{\304"
+	.string	"\034isj\030\37679\222\206\013\335\266\240\355B\333\217\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.11.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\351\001\r\020"
+	.string	"6]hF\360\220*\035\022\r\201\360\3375\265\206\200\017n6\2760\375\231\301\005\277\031\314\257\254l\342\247\333\213\327\006\217QE\374\036:J+\177\007\036f\246\331,\331LS\270\346\024\215\346\212,\373T\372G\337\326\022\262\345N)Q"
+	.string	"N"
+	.string	"X"
+	.ascii	"\273\257\027\266\335\021\304\n8\367<\336\343\273\307\371\200"
+	.ascii	"\357\236O\366\214\217\260\375\254\004\nm\267\273\240~\370\351"
+	.ascii	"S\345\311?\355\235U\013\365\251r\235\bbn5<-\325\364H\t\261:\355"
+	.ascii	"\222\325JI"
+	.string	"\271y\260\273\226\253V\207\333\273m\b\266\035\330\222B\036QRY\354\317\335]\353\313\376\313\337\371\370o.\373?OZ\247\264\234\322\357\220\300a'\363Q\333M\251\241\331\234\307B\204\355{l\253\211\317N\1771nv\254\312\003\313\266\273 n\300\271W`\312\321D\263\340\322\276\313c\247\313L. 16]qU\221\231\f\225\234\261\035\372\255\304Q\002\254\026WL\366\322g_\270\212\222\312\300\330\351\244\332\242\2470\035fE\343*\365\033\\\251\353\204\225\030(7:j\217\216\3028\275\301\330\330\250\235\341'L\234\335e\340\327D\222\302@\230|\367\016\260`\256\330\312\211\254q\241\206\020i\206\244\217\310\004\335\240\0201\024}B\261\204Ta$d\201d\004\002IB\037\021\b\022I`\210\001\2170\204\"X2\032\211\240g\334\317\325\227#\214\310\235h\312\tn\177\356\302\270\017\225\234\313E7\225\345\245\257\005"
+	.string	"\357\246k\t \355pD~e\216\032\211\\JQ\207\315\004' \200\002\221A\273\003\n\323\315M\177\315\206\003\326\222YR|r\2039\206R8\f\213r\336\267\350\272wA\227\255\215\001/\30336\204sNm\020\360\200\211\b3\034<\203\266\316!\t\227\307\002\331\315\262v\001c\030"
+	.ascii	"\3632\360\256(\214{\341\227qD\200\210\"]\23679E[{"
+	.text
+	.section	.gnu.lto_config_streamer_start_append.12.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\345\n"
+	.string	"\306TLC\020\251j:"
+	.string	"\327\273\016\013\300\b8\354!\004~\304K\203\255\b\353<\341\357\271\"\006\301\311\035\027\332\320Y\334\227\265L\326`F#$\020\002"
+	.string	"\b1L8v\354Lq\t\201\315\366"
+	.string	"'\005i{\357\224\0025"
+	.string	"="
+	.string	"7"
+	.string	"d\306\025\3345\223w\330\256qg\330\256y\264_'Q\373V\200\223Vlw;J\340\343\347\350\277u\205\222I\364i\321\330]\317\222i\345\246\267\035a;\303>E\226\215T\f\302\304\202\335\224\331\204}\24090`\373\027\333T\301W\343Y.+fI\002"
+	.string	"\270v7c\f\356\032D\235$\311\003fI+\024\213O\373\b\236`\274*\364\205\335\323\313\265\033\273\027>\003P\bE\025\bm\327h\204\362\200\204\321\234y\233\225R:\251-22_rC\251\"\203\231P\221M\212&\035`\277\356\356\232\236\354\263\376z\362\247W\3753\037\210#\326O\334tT\357\3664\341\327\331|\341G\344\370\340xx@\257\363p6\235\316\013\305N#a\020\344\013\273\017\b\206\335\205\334\327\245'\3272%\203\215h\211\177p\263;o"
+	.string	"r\033\020"
+	.ascii	"\252\244\223i\272)\033\2039\303\332\r\316\330B\256\261\001f^"
+	.ascii	" 0\\Q\302\270\2400\030\026\240B\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_erase_page.13.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\325\013"
+	.string	"\346\226SA\020s\232\016\360\t\361\323-\200\026\270\306||\343X\337\235$\n\230$\231\312\205\203\263\301\275\276k\265\361\352\033l\310\021L^\247\261uUU\013R.B\b\032\330\177\256\274$R\254\352F\366\226;\245A"
+	.string	"?"
+	.string	"?"
+	.string	"\031LZ\264\354.u\340\005\242\313x\002\321\245\216\370\366\250p\363\271G\211\301\205G\007\214.\345\032\033\254\244\250\020\320}\342E\360\370\376\035\242t\036\b%\315\356\032\236t\035ny\333\017l;\260\257 B\226E\326(\361\320o\337\366\346\177\276\370\241\222\211\3430\305"
+	.string	"i\360\261;1\227f0\035\332_q\026\333\247\205\017\330\365^\314\330\235\t\274`\272\364\234l\373(\236b\263m\304I\242\223@\001QU\002\200X\361\240\3529\276$\222j\300\304\211o\307\007\002q\004Um\222\n\360'R\377\375\036\216\017,\037\345\354\311AU\261\037W=\373\241[~\376\252\320\217\236c\266\374\230pcw\303\220\031\211ViY\224e\026\306\341T\2227\031\314\022\251,L\313 H\350D\030\2716\324H\247\022\2416XFe\020\370\242`a\224v]\030u\231{\365,\201\202\230\310\200\230\377;\200\0204zh\346W\024\265\346\202z\002\017"
+	.ascii	"\252\322-\301\342\240\316\340Y\200HX\267Uo\342Vqa\254\265\331"
+	.ascii	"\315\tu}\3522h\"\222\022\220\252\032\212.\005\005"
+	.text
+	.section	.gnu.lto_write_word.14.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`F\002\375\022"
+	.string	"\226\344~H\340\360&\035\330\005"
+	.string	"\345\205\323*E\314\031:\257\223m\231!\214 \370\004\312\260s\030\227v\007F%-\333\346\321\367\2147\\U\253\006\225\315\207\341!C\033\326\t\260U!\212\001j\230\003\204\367\211|o\t\331[\312\224\002j"
+	.string	"d"
+	.string	"l"
+	.string	"\006O\266}\023\037\212\331J\021\374\371\274\234\n5\\\323\234SE\362\221\3562~@w\271\036\036\273\327\311\270\032\363?>\331\275S\206w4\324WS\371\034\355f\2431\216\344"
+	.ascii	"\331\236\273Z\370h\261$G\322\016\3247\323\215%;10\204|5q\204"
+	.ascii	"\211\007\307oW\234\257\246\352\241\3149\255\266\357\302}\272"
+	.ascii	"m\232\355\006\266\306\004a\350\355\261o\364"
+	.string	"\203\034w\247\016\376\037Q\355E\265\354\324Q\252W\2525\252\037\340\271\236\035\235\240\233\255\001\316\234\260\307\\\222.\202\216\273\375#?g\224\217\223!\231\201\363{\0206\r\231\\\232\301\351\362v\314F\331V#\n\004\004\314\331\r\204\202\253}\242\027\305\016\316\\d\316\236\027-\346\004\0218\301\3512z[j\237\373ud\204K\263\225\331+`\bM\t\353\342*\220\313\221`q\017|\370g\b\321\224\210ou\273+7\033^\370V\247\273\2534j\032j\034\341,Z\272\005\212\2324I\007S\207]\037\233\374\273r\2731S\036\266]Wa\245\005~\n\b\023Ns\316\207\270\364g\272\313/\207\241\237\235\023D4\032\332\240L\327\307\376\206a\257\027k_,\026\226\230\225nu\257N^\254\226\n\353\005\003Kiqayq\255T/.*-\325\352\005S\235\030\260K\002\353\245\202q\271^*\0248\037g\354$"
+	.ascii	"\021#njH2\345 \b\247\206\244_oql{k\024\232\255\211s\316\351\211"
+	.ascii	"(\310~\254\235\242\242\267\311\375\355(6+\263\2220\332P\243\273"
+	.ascii	"L\227\332Eq\304\023\242\2726\253%, \240\202\0311v\212t0\233V"
+	.ascii	"\245\205\301l\360\033\2573\266V\246\245\211\352\013\340p\332"
+	.ascii	"f\020\340\020\013\234L\344)\247\354\262\2622\240q\024S\262\226"
+	.ascii	"&\362\332!\343\261\bJ!JIx\307=\307C_)m\b\227\250\021\002\341"
+	.ascii	"\274K\211\006_\204.\017\"o\221\246\323\202\333\300\356H\022\301"
+	.ascii	"2\003"
+	.text
+	.section	.gnu.lto_config_streamer_write.15.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`:\003\275\027"
+	.string	"F\253\227I\260XQ:\360"
+	.string	"\250\r\220\205\210d\234\004=\0232\345\003\235k\031!\234B\271\207\311j\036HG]\033\337~\274\204\034\231V\236\307\322\337\307wj\343go\343\201;0t%\371\341\376\205\201\006\245n\250\007B\310\336R&\031\202"
+	.string	"|"
+	.string	"\205"
+	.string	"\245\207\007\250\025\227\004H\255%\202M \236n)\236\306k\310v}\263\314\221\003\214x\334vXj\255\252\231\247\300\323y\001\340i\253\220\361,\277 \313\036\202t6\313\366\273C \002\2214\222>\017gh\013\301\342D\336\346\315\222\022\322{g \222\306 "
+	.ascii	"#\241\323\022\2373\201\r\313\211\023i\233.K7'&\262\306\375\336"
+	.ascii	")QP\322H\n\235\303\007\265\326\345\221\034\361\025\277\273\""
+	.ascii	"v\327\301n\343\0042\216f\374k\036\021\033\331]\264[\372\360M"
+	.ascii	"nIi\033\267\233\232\274\250\227\377\3519\376\227\343\370M\347"
+	.ascii	"}E\2217\fy\301\311KA\336Iy{\362\362\344}\214\013\214\036\344"
+	.ascii	"\203\240\324\032\342\247\245.\241H-\316\373\356u\354{\274\036"
+	.ascii	"\230\312\244\236tb\344C\251\326\222\346t\033\210\247\337\225"
+	.ascii	"\355\232v\267\37196L\230Z#:\301\200q\364\020\200\2515\335\007"
+	.ascii	"\005\347\335\037\335\206\354\001OR<\373\324\273\023(\360G\332"
+	.ascii	"3\266\366\331}\221\230Ln\334\255p\"\026TC\f\3146\351@\374\030"
+	.ascii	"\205\366\b\n\027\270\331E;\277>\220\273o\350h\242\213R"
+	.string	"\343\245\355\336\335\016\027\202\023\223\253\265\336\354\256\216\304J\345Z\017\222\341\364\245\257\214Uf\377\241\343\022\367==w@&\270}\310\344>V9\3607w\373~R\320\370\267\273\032\316c}b\255u\301~\307\205\034q\205\007\360\364\375\336\347\221!(\001<\253\235nqp\305\346\316Y_V\r\254\225\263j\301xb8\031\\\030t^,\225\216k\225\243b\301b\252\232\002\373\332i\301T<\257\027Le*\353\033\207\352\231Y\323V\t\252\277\373\2341D%\313\321\214\177a\027\255\315HS\035\232`S\213\r$v\330<C'\005lS\207\375\237\027/\r68\345\266e\306\277\317Zk\005m.v\252/\320\202\222~^\320\370\307$(\315\221\240$\fM\211a\205\366n\204\033Y\237\210\342B\250q8\210\b#F)\t&\220`FA\2621\220\002\221A\343\001\021\260\301\252dH\333\001\352#t\006\222\236"
+	.ascii	"!\204\314\234\332\363\247\021\364$\200 \276\374@\270^,\345\365"
+	.ascii	"3uF\340\2748\225C\253\nK\215 \346l\367\211\021E\262\264\326_"
+	.ascii	"\344 \212*\bp\335\237;\316\204\251'@\263\200\306\f|`\231\307"
+	.ascii	"\250\216\277\363\226\306\307\017x!\350\313\2255U!\231\272\241"
+	.ascii	"\2251\201]\261\233\371\n\016\2554\306\2668p\2549p\244\317\265"
+	.ascii	"X\312]L\236\231\002"
+	.text
+	.section	.gnu.lto_config_streamer_status.16.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\215\b"
+	.string	"6\020<=@\305&\351\340\245\313\274tv?/\237\031F\022\347\356\201\035/\345\n\030\335h\340\t\002[\273\331\366\316\252\233\2063\330n\207Qt\304\347\337"
+	.string	"\205\210\021\252Ei\316\331\303\266F\210L\001*"
+	.string	")"
+	.string	"*"
+	.string	",\00623\323T\001\323\313*\002\246W\004iW\330\335\246T\302\343\024\300\344\221\n\t\"2sh\362:z\354\317\360?\374"
+	.string	"\002\003\256\227\221\277\373\314_\370M\025\245\3537\352A&J\200K\346\327\260\003\326\353\017\373\257IO\272WY_\210\227@B`#\231\tqU200\221^w\024\013R%\270\372\217\004\343\307\327\312\314<\242\036\302c\277\026Z\006%\005\274\236Z29V\0072Z\3276\\\347\303\351p\242\320D\205\207\002\264i\031\310\303\371d\032\027\3126\013o\026\035.\023m\033\227e\276\354\307\250)E\215\377\242+\253\260\013"
+	.ascii	"\252\244\223i\021\206\315D`\232\005\344\230\320\355\232R\202"
+	.ascii	"\t\002N<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_config_streamer_flush.17.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\350\001\265\020"
+	.string	"\226^lG\360\222(\035\222\215$(Q\253\020+;^\360M\017\177\215Rb\203\244\344;\347\013Xg\251\214\214\242\036P\375\227i2\274\274\326u\325?\3206\004OVRR\265;\233B\204\201\210Oj\242\353bn\237\354-eJ\001V"
+	.string	"R"
+	.string	"Z"
+	.string	"3$\361\202\317\245\303\217m\237\305[\260l\\\fi\240\b\305\216\027\333\2179\247G\372\250\273\214/\320].\211\263\036WY\376i\016\001\006\226\343\003[\217\"\276QA\316\215\017\001\240K\034\301J|\247\271~"
+	.string	"]\252\236\007sN\353\007\206\270\345mG\260mb\253\205\f\374Z\006\016\237\230K\237\245\273\374\232\304t\200\310\264h\316\016[\2723\373q\256\314Vu\350\341\017R\265\247SwR-\243:\256zW\255\252\376"
+	.string	""
+	.string	"31\340A\350\314\t\313\005\2318$\r\023\266Y\266\210\332\227\371\f\353!\313\t\314)\273a3\0031\022\320\272\005\325`3B\272;r\271v\311\244\377Lzmk\345\376\366J\341:\214\016\"\332g\247\374\305\311"
+	.string	"\216\206\327\240.E8q\325\366\215\320\215\267\215n\367\267\327\t\227\346\374\325="
+	.ascii	"\003\253y\031r\332N\216\315\356\314#\377^\250\351p\321\035\333"
+	.ascii	"\251\2730\3563\347\f\245\273T\2422\241PL\252\225\325I\312\t\203"
+	.ascii	"J\252\344\251\234PP^I\265\362J\0208\265\301\244\362VR)\225'\022"
+	.ascii	"\316\307\271\262\320\222Z\326e\\h\033\304\206\254\210;\253\341"
+	.ascii	" &DE\017\317\332\022~c\334'\200\332>\036\"\355\026\264\366\004"
+	.ascii	"\n\372\317\263$\017\333\262/c5\252\360\333\t\t-( P\002!c\322"
+	.ascii	"\016j\322\211\246\033lX\r\263n\353\276\211.u\310\211\221\200"
+	.ascii	"\016\301E}}hx\202A\355N?\351\372\032x\020\260\340`\323\\\220"
+	.ascii	"\016{\fnRhD\304\201\001(\fBvX\254\3410/\243\255\221\324\217\302"
+	.ascii	"\315\253q\t\017\243\177a\033\265\345 \314\337n\244\013\264\336"
+	.ascii	"4\245\350P"
+	.text
+	.section	.gnu.lto_config_streamer_erase_remaining.18.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`x\002\025\024"
+	.string	"\246e\203I\320\320*\035\332\021\305_,\233\bF\321\304Z'\313\211gh,\2458\306\276\377\242f2\353\222C\235\324MD\315\274\363BoA\030$$\215!\"W3\310\325\262\"\246\001%"
+	.string	"t\020(\307>/\b\2331B\310\336r\247\024o"
+	.string	"g"
+	.string	"q"
+	.string	"6\242\236ZG\004N \236z\024\217s\024.\3337G\033ZHn\026\323!\252\265\236D>"
+	.string	"<\235\027"
+	.string	"\236.\b\203\322u1\004\351\\\351\362\303\232\017=\031\355uqD\313 \303\271\272\336\213\377bj\323$\205\211\0201\t~\340<\234\022\370\354\360\r@{\231\"\265\326\357.g4\230\224\241\203Z\253\245\214\266\341\366\270m\016\266Ml9\02367\247~\013x:\332\0062=\0349.\262\310\036_ro\366K~1Dxm\266iJ\227H\243\217\377\307uw\270\322\340J\323)=\247\364\256\264\\\351\203\220\206nh\257\315\250\025\246HG\005\242.J\\\367\333.\177\347\221m]\313T\177\3651:r06j\035GN\275@<\225\366s\256\302\365\261\345 \265\006'\376\317Zk\005wm\nga\037"
+	.ascii	"\251#\273\341!\303\265U\026\344e\273\262'\b\007\350e_\353\361"
+	.ascii	"\365]1c\203A\367\346\020^\216fI[\342\341v\310\321\232v\346O\261"
+	.ascii	"\276\005\312%\3555\320\300d\2211T\311\023\253\301\n\340H\370"
+	.ascii	"\326-\360\013a7\364\"s8,z\013\034\355\367\243F\246\027\253\301"
+	.ascii	"\314:\257%\326ZK|\235\t\027\f\004,Vj\205\202r\022\242n\024\311"
+	.ascii	"*\245r\222Z\261\260\036HH\211\260\242B\235VRNTN\250\025\353D"
+	.ascii	"r\300\252\n\251\325\211E\245Z\235Fc\375\332,\303\221\2039\036"
+	.ascii	"8\267T\332\323\b\362\001rY\330\bqo\006\227\376\244\334\247\005"
+	.ascii	"\256\002\241\234\357<\\\272\363G\312\250\241\333\t\367\346\357"
+	.ascii	">q2J\327s\2326\334\331\310\347\376\267\023\342\261O\234\313@"
+	.ascii	"\246E1 `\002)\262\350\006j:\234a\212\255\356*\372\244H\027\303"
+	.ascii	"\341\206\033\210\030\327\025\354\264n7\0162\030\301%\22658w["
+	.ascii	"\334\263\324\315\316z\273\303\273\343\211\021\275\300\3411\264"
+	.ascii	"b=1\267\204S\273\215\375\315\360v\006\342\305\304\252+\265\017"
+	.ascii	"Z\261\325\205\025\255\363\370\026\314r\345\322\013|\336>\274"
+	.ascii	"u\257V6\322^\243+\3555\204++\267]J\017"
+	.text
+	.section	.gnu.lto_config_streamer_finish.19.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"E\f"
+	.string	"f\026SC\020Q\234\0168\304\225\003$\330\245\001\252\017\226\314\r\210\240\367\337\301f\356\311O\266<V\212\365\240&f\b\261\325\321B"
+	.string	"\366M\37412E"
+	.string	"(\025\020\320\274\004'*\250\352{6\37075![\356\224\002>"
+	.string	"?"
+	.string	"@"
+	.string	"\273\273Y^\301~\315\017\300~\351\210\177\237*?\377\2543\020\361\201\006\030\212>9\\\247\201QdG\200\2604+&\023\340Y\227\031B\222\224\331\202\335\265\004\303\r\367u\333\rl'\260/!\342?\245\3645\215\312\244!\274\007\222]\323I\217\275q\3258a\373\263)\266/\355\257\336\342\273\030\272\200\335\223\215\220]\361\200\021h\277,j\266}\025_\361\331#SL\205\004P\220\300"
+	.string	"R\022\362\240?^\244\030y\214$\025=e2\206\250A\330\025B+GI\232\330\256p\027 mw\025\370-\013\027\264\022\277\374\020\366\353\252!d\250@\260X\215\344\211-\212\244\242\354\317\325\223\255\322\331\003\334\315]\274\f\007\223\361>\236\007\232M\204N\307m\235\r\206\263q\236g\273\024p7!\343m\237\256\3636\212\270\2673\265\214\224d\233\363\030\036\311TEf\340\230\212\0029\f"
+	.string	")\007\035HJth\322\246\340\t\026"
+	.string	"\252\244\223i\021\206\341Z"
+	.ascii	"\034\346A\212\241sB4\b\342\n\203\255H\035\f\026\240!\023+\260"
+	.ascii	"c]@\263\206\013\343\221f\244(c\0044\021I\t\264\352\246)\205\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_write_word.part.0.25.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`\177\002\305\023"
+	.string	"\306\344\177H\340\360&\035\300\016\251\b\bX\207\200\252\263\202\253X>\346\017\315\013\362 \254\353\342\213\033\256\365:\205\273\036\251\377\263\347\207\320-\267\375\351\337\362Y\004\212\030\314\007`\254\007\326FG\305X\356\036<\243\221\t\331{\313\235Rh"
+	.string	"n"
+	.string	"d"
+	.string	"\265\356\324X\2525T\360\351\005\337\247\303\317>\020\214\215m\277\305\177b6\223\f{l^\215\207\0167\250Zk\352\223\344\007\350\247\274\001\372\271(\036\373\224\033i\314\2174[\314\247'\2431\222\037\262\232\023\315\026\342+\0374\335"
+	.ascii	"\205\330f\362:OD\327=\326l\262\030\013\234z'\265V\177\"n\357"
+	.ascii	"\266)\330\216`\307\245\361\267\377\002$\213\234HN\2555\273\250"
+	.ascii	"jb\306X\361\334\237t?\351/|%\244#\230\221\217d\220#\330\204\035"
+	.ascii	"\324\017\204\357\363\276\021\214\2573\210\355\347\216k\261\315"
+	.ascii	"q-"
+	.string	"$\263\260\332Bd5\334\017T\255a\311\247\035|1\033\304\033\177+r\331\"\227\221\001uF\224\202A\214\037\202\271\320\313HXA\3308F\373.\036\306.\364r\002\001uOx\377\221\323\204\263\313c\371\026:wcnOD9f\261\207Eb\\\271\266j\025O\233K\302acl\253|\006\353\253\2656\360ed\270\340\373|\372/\024@\220\017C\303\212\357\343\273\320\317\270\327]\202NM\251VB&\356\342\362x\351e\335\035\373\213\376\274h\317\213\246\317\335\323\213\226\037\372\227F\007 \270Z\027\354\205\362rQp\225\222\002\263@U\267\312\004\\\255\240\254\300\227\253\202\n+\205\245\245J\261\260PVR*\320\2252A\340\026\206\025\230z\265Z`*~w\0342C\342\203,\371u\377\315\314\210\240\335p3\321ok\266\277\365\211\314\312\274\323[\033\254\3559M\207<\213\322\3656\336frdqG\203n"
+	.string	"\034'\036\373\335qC\007\207L@\243\"\n\0274 \200\002\231:\353\001\351\351\201\263\027\361\243\364\031\361\3510\346\026y\3130c\225\202X\211\305\335qh:8\331\215\256m"
+	.ascii	"W\356=E\341\333h\331\031\324\3372\203\225\273R\332\272\205=m"
+	.ascii	"Qt8\376\250@\0066\3310\344${94\333>\2536\004\361\t\372\214o\306"
+	.ascii	"\022!\221\021$y'\213=\333\r\020\332=d\262j\332\2350\320\227\261"
+	.ascii	"\261O\266\374\004\214\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`!\001%\b"
+	.string	"\022\f.2p\211\322\001\216\227\316\202@ie\363F\\0&p4JQ\bTHoH\365\317\377\377w\\}D\324PU\364\277\375o\215\220f\355\3176!r\313\024\366dbZ\026\262\036\232\243\324\211\317ea\207\276\005\327\320\304\240\032\027\237\206\313=-\220&}W&\246e\241J\242T\037(\335\003H!#\235>\230\246\0209\254\235z$\251\006\021k\347\232\201_8\267\b\034\223\033\327\356\004<\223\2663A\002\3001m^9\030\211\0304\247d>\301\334B\300\264\354\362\312\362H\345\020\030#(\177<\335\266m\233\234\"\260\276y\013a\204\260oW\304\224vw\253K\234m\307\t\037"
+	.string	".C\0175\030\253\313\341\034\337\246\310h\215\2345\303"
+	.string	"\365"
+	.string	"\340"
+	.string	"\340\360\001\322\374\245@\020\306\303\"\233\340\003=\224@\214\036\276\001\376H%"
+	.string	"c\b\003\376\354$"
+	.ascii	"\334H\343\032Q\270\001\301\005\307 `\300\035m\315<"
+	.text
+	.section	.gnu.lto_.refs.981244649db993bd,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.981244649db993bd,"e",@progbits
+	.string	"(\265/\375`~\022EY"
+	.string	"\212\224\200 R@RJ\032\016\252\212\226T\207\375\363\266\365Q\247\274\013\001\214\237\231s\341{\231b\206\205\331 /\270\nG\311\033\224~\271\226\b'f\r3\300\344\217\374\304M\334EsGg*3\253f\325\252yM}\317:gZ)\243w\241\342\037m\3447\2212\005\257\001\356\001"
+	.string	"\002_!\352q\330\223\341\276V\352\226\361\222\355\225o\331Z\3011nY\332]\334M g7\201\232g\220b\027.\375\366P\277;\324\"\266\271f_  Q\203v\257\227\340\377\231\262a\373\\q\324M\005D\001\3043M\262\332\272\273\312R\331u\247<][\264  \307\253\210-'.\375>\277c2t\017\240[\033[\203p\272QV\312\256\006\254\330_\300\370\215\310\325Z\2724G\322\230\341\364=\365\3215"
+	.string	"\267\316\237\257\021(pH\345\332:\031X\361@\302\351\rH=O\375\fu\307lS\340\376\202z\031*\013&'K\207<\215S\234\376\353\365o\326jm\363vdZ\366W\367\312\203\023&\307\031\"\247\233d\267v\355\331%_\256\355z\316\270v\263{\3259\361TZ#\343\224\305\246\300\245>\352W\311Qp5\214\263\372\355\301\351l\017\356\353\246\300\251\213\002\367/\006<6\007P\250\300F\326@\t3~\026a\215\350_\031.\300\317\036 \260\201JE\354\377\224\377c\377\2750\361\177m\267\342\003\374l\2631\374O\2630\354\214\003\3603\317\277\024\270\260-\330\374\033]"
+	.string	"X\370\315\317\017\374\357\362\357\ti\377\325\376\203\371\377\345?\224\354;?;\360o\t+\274\346g\025\376E\341\337\030\377f\360o\005\377F\360o\003\377.\360o\002\377\"\360o\001\377\246\370\027\305\277\272\177\325\177s\377\243\377\237\377\331\376\223\371?\343?\013Y\376w\375\037\363\277\211\377K\374\227\361_\314\177\257\377\315\377,\376\223\375\307\211F\243\321\377\306\300\317g\277n(h6\252v\267M\223\322\023\264\255\225\310\236\177\323<q\272W\350d)cE\311\351\231\330\263\377\271\032%\276\236\216\340\364\334\244\376\374\343\272\237j\326F\036\341|kv{~\335\336V\201\377\351\215\001f\267\024t\t\225\210\263\250\203\323\356\351&\"\217M*\"\317\261Y\354\243\227Y\222\347\270\366\324"
+	.ascii	"\335\344\321\307uIL\227D\356\265\215T\3116.\211E\307\265\221"
+	.ascii	"\275.\211;mL\356\034\327\"\361\330\244J\356\261\271L\362\264"
+	.ascii	"\261\211m,N\251\306e\362X\266L\356\034\233\305\344\321H\225\334"
+	.ascii	"^\227\275Y\304V*\"R7\213\272\356fZ\231D\234\356\"\262\211g\334"
+	.ascii	"\324T\320\246\336\321kvd\345\321\335\335\304\257\264\252en=j"
+	.ascii	"\263c"
+	.string	"\221\345\020RwZ7M@\\\342\332\335I}D\334n\244\025\331}\264\224A\271\\-I\310\326\265\261\310tT\265\304A:Z&u\221\251M\036\233U\313\237(L\232\314>Z\211\313\3544*\244\332$\256\030]\323J\311D&\207&\346\207/1mSN$i~\001\033\323\304-\207$K8W\035\034''\253%\023e6YS\252\276x\211\025\303g\222x,\341\224M\305-j\213\312X\026U\313\236\345\020y\272y \301T[,{\266f\312\265\2374\350\222\304\326\346\344\317\234\\7\025\030&\330\021\007xY\273\254\227\005\263_vm\241\253\304\206\331u\325v\313\027m\271\\\305\332m\374I\242\223/\322\222\330\332\236\374\013\006e\247\344\030w\332x\265\006\355R\333\257?s\214\253\002mIlX\253\365o\223\377\005\214U\333\264-\313!\256\355\364\202L\022[[\367\252\242E\213\026-rIc\200\344"
+	.string	" \375VQo\275)p\021,\023\365\273\245~\217\250\213\304\232\355z\262\315\362ti\314\020e\234\006)3\271\032\027Qc\n\303){\375\251\344\322\346\243\211\245*\211#N\271+GJ\222\0232(\225\327\363\222?\227\223\262\243\007\325\222\222?g\363\004M\007\223\323\327 \251O\243G\216\260\326\356\254G]|`\342\326\343\026R\326Y\013\307\223%JN\031\311\236\361\025\021\035d\251\232\312C\206\260\021\025Kb\230\013\240\230hXm\335\312\036\023rpa#r6\302D(\323\332zp\312C\340\224Q?\306(Q\271\310S\256\245\356V\314q\305\231\nQ\177\366q\266Z\331\0073U8\256+\021W\005\004\251|"
+	.string	"\307\212\022\2200N\317\314\237\201p\020c\316\0202ZLN\371\352\347,$\367\303\251t\306\351F\243\213\002\267\323\334\315@p\020;\224vp\372P\317?\254\262\246\3008U{\377\304=\365\241G\017\253\233\266\256&|\340\364\351\215\252*\"K\272#\333\322\271ej\212\245V\215\271E\350\320]\316\037~`\251\\\006B\2441sHJY\305\035g\251\247\312$\b\025\343\r\213y`\036XG"
+	.string	"B\200=A\333\320\276\234m\211:\353x\352\322\236@\2458\345\036\030IG\207.Vk\234\262r\307\340\240\215\201\342\245\f\016\213\323\2312T*\016\034\f\265\335[\244\236\240X\254\364\204&\213\323\337n\260\023;1\324N\037%\241\204y;\023Sf\207\2473T\212\244\345*\r\247\234\2745\031k\016\301)#\367LGT\222\323\237)\216(YW\300\360\022/q\323v!Q\366\234P\312\272\362d:7\255\335\220\251\222\303\221\221X\354\312R\223\025\225\310JD>\342\272w]:!\271\370\"\037\267\221\335\312\276\2019>A\2618\351|\264\001\213\254\310)\0371\222\232\325\305\214\026#\361\215\033\263$\361\212M\307e\246\2529e\343niuL\310\025\224\227\216YE\314\311\251\236\223\250_3{\346\213f\335A\336\020\020\013\341\317H7\374\371n4"
+	.string	"\001c\334\264\360!\027B?_p(\364\351\005\031\021\001\375|>A\241\221\217"
+	.string	"DDF\277\037\360g3\334\341l"
+	.string	"\203CC\340\317\206\006\257G\224\016{\302\032\275\032\270\240 \360\205\032\274\240\0200\230\002\317\207\\\304`\201\004\031>\303\236P\2207d!\003\247'\304K\001\204\335\b28\210\021\202NP\317\2067\344}P\003\030,\352\365n\206\204\276\237\217\206\320\317\327\013\"0$4\"\242!4\032\362\206B\001v+\206A\336P\230b\350\373\371\002\270\211\300\3050\310+r\021\024\004\332\330\365\206\276\240\r\236\003\365\204xE\273\236\220\027\354\335\034\310\027\354\375zB\352'\240"
+	.string	"\002\n,\250\301f\270{!\201:\f\352\321"
+	.string	"\004$\372\031\251B\036\241\260\027\f\n\342\331\364n\360\t\323\341.8,\032\376|F\271\240_\357F\004\004v\260\253\t\372\365\212\212x\270\0171p`Q/\3503\004\002\203>'\206;\013\206?\237\221\315\fkcqC\036\007\203\275\333p\327+\262a\270\373\t\371\210x\273`\217\006\r\243\031v\013\374\347\307\003\026-\234 \202\n\344\"\330\253\301\353\005\207\302\235\220\217\306\017\b\344\363\363\361j\370"
+	.ascii	"\005\205>.\0268c-\335\215\246(\261,\3175\303\222b\262\031#\241"
+	.ascii	"Zq\026\241\030\213\032\266\004}^\341c\316\224\016\\Z\270,\n\005"
+	.ascii	"\266\f\343\224\253\360\021\273\376\311V\326f\016\026.hiQ\324"
+	.ascii	"\032\272\333&\032\215F\317T\214\350\224\031\222\003s\305\251"
+	.ascii	"\342\305d|B\345\320\230\341J2\306N'=\374\250\022\203\222c\246"
+	.ascii	"$\n\004\247Q\242\2603\212\251[B\303"
+	.string	"\2740\t\373\303\330\271\\\355D"
+	.string	"\024\022\r\253-\027D\220!h8\335\225\2355gE\256\236\034\331:sm1\224\033\332\256\255\\\336\300T\371\262\003V\037\225='\226,-\311\322\344\f\345\f\366\002\306\325\260\210@{\362\034\345\025)\320/v\362\347n\210\364h\032\211R\017\001W\216d\222\003\201\205\250\2410g\030D\"2#\"\222$I:A\005\204 &%\265\016\022\300UA\222!6\"\"\263I*{\035\262\312\334@\375\333\322\017\n\335\037E\232\352\264\270\211"
+	.string	"\020\361\234\255P%r\241\035r\343\177[\363\241_\f\247`\3767\325\337\262\001\234\216\346\321\210\345\346\237\335%/\n\"\344aq\351\027\364i\372\376\323\313\007\232\323~\004%R\323\234<\373Ax\320QJ\234\327\004\256\355R\265\233\344\276\230\220o\2751cU*c%bu+\300s,\265\205\275\203\003\\\001\336\016\\\251=\260%\205\324&s\256\352f\265P\016\242\231\313\227)\233~\222\204\211\002\221M1\373\251\fc\310nH\326\205S\027\235\334\370\363\253\273\351\231\235\244\221\263D\210 \006\225\202\227tev\361\002\221n\013&\374_HaL\362\032\341\201u\316\343\253\271\215B)f\363Hw\260\210d\323\360\317%"
+	.string	"\224\253f\357b\037\317\324 \251\344\3244\314\352\22208\240\351\f\243\337\205\0063C\224\241\302\221#\352A\372\357F\023QVe\320\205\375}\346:\031j9\273\351\340\203\261<r\t\be\376\327\246\250\261\226\230R\203x\243nf\200\224\354\255\004\0011=L\020aZ"
+	.string	"\021\027\243\257O\333\207\265'\250"
+	.string	"_Y\325\\\013\352=\366\326\f\270$\353\324u>7\352Kn\200\364(JI\223,\226\354\344\210 \005\206\030\n\276<\021\310\322=\374\246\002i\024q]\343\246\373.\\\200,\313\202\0059\370\360sk\t\377"
+	.string	"\217\355\301\330?\213\002\3529\301\237q\310\345W\324\355\271M\212\035PA\f\375\270\016\237MP\323 \242}z\"V\034\266R\231\373\245\3578\242*\375\377U\374wyr\200>k\013I\251v\342\215\352\246c\316\253|\342\003\003\375F\373,\264\302\357\337\345;/\020\253b\270\221\313\346\"9\244\252b\331\201\340C"
+	.string	"\b\030\036\360f!\322T\bM"
+	.string	"9\272\224\013\035+\240\2016\025<\177R#\330\t\256\300E\2001\246\217Z;R S\236B\212a\266\342|3\ba\323A\214\\R~\367\022\211J\254\214\3711\220\351\311\365\302\365%\362\rF\267\277|\344\201\366D#\202\203\026\202"
+	.ascii	"\\\3102\243#(\335D9j\001F\301\227\352\016nF\031\216\305\374T"
+	.ascii	"~\251\357\323\335\340\221\325\337\221\342Y\277\366u\343\205\215"
+	.ascii	"\177\024j\271\350\355\220w\002v{\346\321\317\270a\021o\005\375"
+	.ascii	"6y&\006C\363\231e\334r\367\337\373\352+\302\275\335\026\\S\243"
+	.ascii	"6\354\276Y\374\3632\346\271\253\277}\372v~\370M;\177\316\267"
+	.ascii	"\331\206\316\331\371\277\325\225\375\030\r|\363\310\277\364\275"
+	.ascii	"\346\373\267z4\271O\336\213\306\306cq\255\374l\337\214\3302\b"
+	.ascii	"\037\237\343Z/\245@,\n\036\336\257\260\355\323\2009x\032\306"
+	.ascii	"Tp\325\017\356\251\001"
+	.text
+	.section	.gnu.lto_.symtab.981244649db993bd,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_start_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"config_streamer_erase_remaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.981244649db993bd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,511 @@
+	.file	"simplified_tuning.c"
+	.section	.gnu.lto_.profile.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"U\004"
+	.string	"\244\005\367"
+	.string	"\n"
+	.string	"\360\321\375\354\016&\002"
+	.string	"\002\001\002\002\003\002\004\005\002\002\002\005\001\252\264\277`\002\364\253\230\202\013\003\233\234\365\274\002\024\005"
+	.string	"\004\372\220\320|\006\002"
+	.string	"\002\006\002\005\005\326\256\372\352\r\006\265\214\315\374\017\007\366\274\373\260\013\006\b\252\346\372\211\006"
+	.string	"\t\256\350\341!\006\006"
+	.string	"\024"
+	.string	"ac\nDq]Q\230V/.\314\344`g&\252\240?M\200| y\245Y=_"
+	.ascii	"\370\257\"\366\245\006\334\373\231\261]\2400h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 \217\265\002"
+	.string	"t\003\203"
+	.string	"\b"
+	.string	"\001\001\003\004\005\001\001\002\007\002"
+	.string	"\211\001\001\001\b\001\006\001\001\001\200\004"
+	.string	""
+	.string	"\t\006\221\007!\b\002"
+	.string	"\b"
+	.string	"\007\001\001\001\201\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	"\t\t\002\001"
+	.string	"\f"
+	.ascii	"\005C\245\n\340\bivV\341<\007\006\006\244\230\0237\030We\360"
+	.ascii	"K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`D\004\225\r"
+	.string	"\346\323?3pk\322\001\3047\302q\271<#\272\251X\274ry\314\"\035\265\300\245\374\003V\0347\031E\310>Y\376\271\316\357\344>t\027Fo\373[\022B\366N2\0053"
+	.string	"3"
+	.string	"."
+	.string	"\326C\273+\371\316\257|w7}\377\362\206\335+bc\032\266\341\231\310Kb\ry\037\r\221z\274\375\030Y\263f\352\351\347\206i\034\233\016\310\035\266Z\022\b-!\322\322\2509\017&}\306\224\263\340\f\273W\200\233b\200P\\4_[\205s_[\267pP\310\220\374\357\246\003\302\322\271\266r}+\306\252\202P\3259\206\320\2070\032\302\350\303\177U\243\325\242\211\276R\\\345v\321\316\372\302\256\346\371.\372\216r\245\253\312\232\354\204\335\275l\211]\346\207=\227\301\266\335B\266\264F\360\320\273\235\006\377\354\356\263\376\324\343pZF\344\344\001,#Wg\025%\302\004\360\214\357\274\334\343\221xPK\223\3529\2512s0X\250\301d\211\310\222\202\222\226$\255\001\340\242\031\241\351\001\022`C\021\313\225\336\241\031\312P\276\345\257\315\214#[~\006\213%\260\301\233M\224\241\036"
+	.ascii	"\2369<\311\375\024\260q@\255\267\342\241\227r\034\371\322\242"
+	.ascii	"k\262zb\320\352EW&'\252@YQ\270b\263[y\362;\337]\217D.\204Z\233"
+	.ascii	"\332\330\343\223 p\236\213\236\374\277\360\333s\315\005\325\023"
+	.ascii	"\367\256\321\007j\265u\334\235JA9\301c\230\356\\\321\\\346\270"
+	.ascii	"^\270\245\364^%'7\233`\264B\200\013Y`J(\333G\257\222\351l\r>"
+	.ascii	":\247/)\210,\273\376a\247\373\026\365\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 \264]\002"
+	.string	"2\004\f\023\300%\035\357\372\277\257\252\252\372\002\2405\322v\333$%\031\243\313\213\320\005W\363\364\007\235P@[=eNq\256fw(@3\274\206\216\254\b\n"
+	.string	"\200\0234g\0028\37690\230\f\b\302\235u"
+	.string	"!T\306\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\003\232\004\004\232\004\005\231\004\006\231\004\007"
+	.ascii	"\231\004\b\230\004\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\355\005"
+	.ascii	"\242\b\033#\240%I\007\017\326C\216\373z[\0353o\253\205\004\342"
+	.ascii	"\252\212\365\277+\233\365.\327f\262-i\255I\231\002o\320:r\220"
+	.ascii	"\323TXL\003\026\223x\224\241YjM\004\t\201\372(\246\371\215\013"
+	.ascii	"\221\244\312)\\\311\241P1\357\216u\363;d`n\234Z\343\251n\201"
+	.ascii	"S\t\206\326\234\313V5K\213\371\312\f`\336\347\203\362?n\363\020"
+	.ascii	"% \340\002\031\251\335\211\f\240\b\210\031\327\301\321\331@\314"
+	.ascii	"X\321\023g\004\013\033\204y\237\302d\361\r\003\bo\\\351;\033"
+	.ascii	"\274\200tP\016\227%\247S\260\233b\231\202Af\202~\353\315\254"
+	.ascii	"\310Q\026Yr\2271\305Y\250j\204\353\272\202\017\001"
+	.text
+	.section	.gnu.lto_.lto.62822d46fbbb2dcb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateNewPidValues.24.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`#\r\275:"
+	.string	"zk\314\02660\252I:\301Xv\263\020?\237\206{'\267\260\375gjU\2667\254@t\016|\177_\f\363r\337\217\352\225D\342\322\325\003A\235dw\005cl\233\020B\222\2242W\0016\001m\001\264\267\353\3545`\366\026\240\275\004\316\336\001f/\027\355\335:{\005\230\275\001h/\200\263W\313\354\315\242\275\303\263\227\232\275'\3555\317\336\322\354%i\357\317\3366{9\310\026'\003\200\265Z)|U/\225\214\3440\"\346?\314\200\230\0051\017b.\304e\223MwYRY\227H\036\"=*\321\310\254\013\0072\243]\255e\302\213VmO\321\256\026\037ZN\264Z\210\326\021Y\007\245\3303H\212\216\311\256\026\227%\377q \006dBlh\265\nIj\0334\251\207 J7"
+	.string	"5Y0\2545\222\340\234\025\324\217\375\324\361\237&d\035\304s\030U\"Uk\265\300\345\242Q.\027\220\334\273\274\207\371\324q\237\023\036Pk\032O\212j\365\303\260\036(\227\353\307]&\227\224\013\230\\n\335\256(\366kSE\364\221\022\210U\255\225x6{&\375xi\327\361\220\236fI\276\353\226O4C\334\\V\341\351A\341!\311\225\351\212\0272\203\261)\2035X\272\360\311\205M\022L\n\t\001\023\232PZz\307.\263\364\2660IV\030CI\213"
+	.string	"\275(d\027&4\241X\021w\236\336]\237\023q\205\301Rg\260t\341>\321j\255\333xzXx\263xw\345\354n\226]"
+	.ascii	"\216\002\303\233\260\316\3236\326t^-\016\237\371\265\362\346"
+	.ascii	"\317@\362\245\033_\"\377\002N\253\276D\214\006\324\037\277Z\367"
+	.ascii	"\254\260\020\325]\255v\016~\033\357\300#\035c\027n\377\377\""
+	.ascii	"<\222\342\367YJ\254\035\302\202EZk-[\246\364$R\021\372\306\211"
+	.ascii	"\311%\377\007\034\276>\273.\334\36532\327Zk_\315.s\255\265\356"
+	.ascii	"\323\3542\"\3366\332\013\204\366\366\240\275<\316\336\035\264"
+	.ascii	"W\007\377\341\315\301\200xq\260 \336\033<\210w\215\013\361\332"
+	.ascii	"\340>\346\032\264w\006\355\225\301\210xc\234\2750\314\336\027"
+	.ascii	"\303^\265\263\327\005\355mA{Y\320\3364\332\273\342\354U1\354"
+	.ascii	"Ma\366\2428{O\234\275&\316^\264\263\367\354\354-q\366\2220{\315"
+	.ascii	"\316\336\021\264W\004\355\rA{A\320\336\017\264\267\354\354\365"
+	.ascii	"@{;\320^\016\264w\303\331\253\301\354\315@{\211g/\331\331\213"
+	.ascii	"\201\366^\240\275\026\316\336\n\264\227\202\331;\341\354\225"
+	.ascii	"`\366F8{!\320\336\007\264\327\001\355m@{\031\320\336\005g\257"
+	.ascii	"\002\2637\201\331;v\366\212\321\3360\332\013F{\277h\257\327\331"
+	.ascii	"\213\300\354=\020b\201&\234\302\275\b\217\244Lt\225\032\\i\260"
+	.ascii	"\251\2541\244\301\316\233\360\363\331\343\313\004\bi\212y5\233"
+	.ascii	"\244\312\030R\307{<\257\277\211\270\356\366\\`\034\222\307e<"
+	.ascii	"\017\205)\341\bD\375U:\242\240\333w\035E\005\2224\223\361\322"
+	.ascii	"L.%\374"
+	.string	"\307\036\037\243\b\337m\321v\r\245\353\331#\3401\226\370\231*\206\360\022gI\017\016\301\301\037\\\214\360H'\307\033\334\001\2037Xp\006\n\276 \301\025\264\340X\260^%\370\023<|}cwUT\320JM\254M\255\025\004\ff%\203\313\256\301Z+\343\2312\3611Bw\376:\001\306\262\300h7\361\355\243*\243+^G\246\330\321\316\221\230\314\343f\260\017\027A\250\302.vR\360XI\306\301\036\3660\302\265\177\035\354`\233l\334\353_g\004\367\272W\340\201#\240\301\251j\234\225\355\356\223L\214j\315\254M\255w L\361)\034\344*\321a2\236\016\223\313\003\177r\207,\273\316\343b\251\f\274\353a\204\005n\200\007\217*\360\343\335!p\035\037\0134\340\004\036\006\213\353\003|p(\2563 Ol\007\bi\ny5{\201c\\\314\037\233?Ow\355\352\265V(\337z\016\001\337\272\t+\300\005"
+	.ascii	"aO\001\256&\207\017\300qh\035\300\277\004\263\256\305\306\234"
+	.ascii	"\262\356#N\253\341o\320\007K\204l\216\b\035\333\033\021.\356"
+	.ascii	"\355\rl\256\270\204\215\224s+\0329R\2443\202\004\206\234\033"
+	.ascii	"\335\034\333\033\327\021\263\f\"\307\246D.NH\02077![pE\266\264"
+	.ascii	"b\351f\244($NnF\220\342\221\254m#\033\002W\204CB\007$\210[QH"
+	.ascii	"\321\310\221\267\342\034qHQ\b\\\\\033\021\256\310\366Fl\223\233"
+	.ascii	"#\222E\330\270#nrD\272\27089\242\226\237\035s}\032C\254\002\326"
+	.ascii	"%\273\033\207W\263\034\360\316\266\377S[\340\030\317\213q\030"
+	.ascii	"\3578\177\226\356\332\325\2768\214:\235\346E\017\332\341k"
+	.string	"\222\226\254\210\207}\204\242L \237\361\274\266s\"&\353\034\001\217c\324n\246\356N\227i2\025\256\326g\334\361\n\347\240\213\3578?jq\0278\316\342-.\346\350H\307\230v\026\007\333\264\342i*\276\342^\201)\256b\257\303\324\361\235\265\001\263f\326\346K\212?\351\343\353C\361.\305\261\335:=\315\245\216\017\331Q\3541b8\331\211c87\n\361\023\037\356\001\232}\213\226,$n\266\367\347\341$F\334\303\231\221\210\217\230\361\020\027\321\343 \036\342a\2027\376\341 \016&X\366\017\347#\235\262k8\026\036I\235\035\016\344D\301\343\030#\207w8o8\361\0344|\303)l\312p\ru}\332J\2067%O}v\027N|\202TGI\306S\370\205\363q\216\204[x\200\327\2501,'\r\203\310DDDR\220$\031\306\320\002\221\231\031\352\006\021\340\2405\212\261\031\232\034\203\202B\241\003\335\312"
+	.string	"\334\263\267\240\021T\344;'C\022\373\313]\211}\266W,\234\374\333!\266\211\257Hp\257dO\246\310\300_\273X\206\311\344hZ\355P\371uV%\216M\210./\364qS\037\0029K:\371\324@\342\235\254$4\367\274d\357\321\263\236\3610\020\360\2116\314Q\306\024\301\213\372\365\313/\267\030\315\366\2516\206\326\213W\202\023\347\354q\272\020X\320\t\316\233z\365u\316\274\217\324\373\033#\007\"\354u\232~\327\234\ns\212\255\330fN\322\332C\n\350\0072o\234\035L z.;\004\335\020LJ0\352\177\334\003\207\003\201\312\367\347\006G\032\007\"*;w4)7\022zbl\214@(\204\303#\317\204"
+	.string	"\034\307\234\236\354\311\036D6`c[\nE\343\242\005\246\2426vN\203O\221\023|c\353\364\027,\035\262\230\244\276k5Cr\314x\363Es"
+	.ascii	"a,|\262C'\242\315\302\225\215\352,n\001\375\255#\204\273\247"
+	.ascii	"u\245G@Z\204~\370\304^h\347\262M\344\2456/\333\304_hr\314\006"
+	.ascii	"}\354\260\256\001{\311\013'\273\345L0\344\020hJ\223\324&\243"
+	.ascii	"\020TaZ-\263\247\007\265\270\273;\206g\306\271\0203\342\353+"
+	.ascii	"T\036\300\037\251\025\344\313/A\234\304\350\033\327\0331<\226"
+	.ascii	"7\277\t\001-+\266i\204\020\213*s\2618\336\224\264\252_j>\316"
+	.ascii	"~\307\020T"
+	.text
+	.section	.gnu.lto_calculateNewDTermFilterValues.25.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\177\003\005\024"
+	.string	"f$~H\340\320(\035\333e\232+G\351\273H%o\031\230(\361\247\252\227s\325\001o\005\222\201\006\201h`\016\257f\013\317\3014j\255\336IE\376\207\030\326\300\036\252CX \302\220\n:\341MC\177\260\233\331F\366\336[J\231\002h"
+	.string	"["
+	.string	"m"
+	.ascii	"\277\356(\017L{`4\325m;\032\352\276\031\370\201N\343o\272\222"
+	.ascii	"\032;UI\215\207\3754\364\246\241'\206\t4\334\215\356\3668\203"
+	.ascii	"\302\264\2332B^\330u\226\224fj1\332\021\270Ps\243\263\005\315"
+	.ascii	"\rm\245\215\306\231\204\205\026\224Q5\0318\240\273\365\203.\205"
+	.ascii	"\232lw\226t\367w\246V\243/\351\177\232\377\t~\266\005\n#5*\307"
+	.ascii	"\016\270\234\236\330&\3757\3312\316\257\260\273\373l\373\265"
+	.ascii	"G5\300\356Wp/\002\367*\270\017\341}j\367 \273\377\200{\024\334"
+	.ascii	"{\300}\007\357O\2737\355\276\004\367\035\334\317\335K\270\217"
+	.ascii	"p\017\341\236y\277\273W\001r\307\b\200\211\356\nI9\272(\022q"
+	.ascii	"8\375\327\rLr\002('2\216\217\232>\025z\231X\177V\300\022"
+	.string	"\377\020\024\250\343\222\376\350\344Nm&\253\215\033\030\222G\254b\350L\215\310\222#\013\032R\314\005\344\310q\306LGVB\237\223\314\220gn\346A\266I_fV\032\322Y\024\327Z&1\302\035mw\307\360_R\371\201\217\f\231\305\361?\202\206xu\335\215\340\nb\301K\267A\343\003(+_J\313\305\340\344k1\335dD\205\365\261^\\\032\234\240|)\337J\013\313\367\362T\276\024V\313\304c}\016X<\023\327\313\033)\360V\013\212\313si\265\\\336\351\026S\330l\273\002\236\242\030\313\272\025\253\020\341\225\212EHh\b\253x\346R\034\222\"\305$FB\023DEQ\200\260\006\311\017&B\361\007\307\234\007\2438\276\230\351\310Dh\007{\360\f:q\307\320)> \320\002\031\0313\017\222C\323J\201\241`\223d\357\2344b\254\354\320\345\316\216\f.'&Zg\266x\033\022R\337%\0321V\366"
+	.string	"\227U\311c\343\203\313\t%Ed9\212\307\2106\"\256\247*\223l\234\260\t\203R\227\n\276<J\325`\201}lZ\307\351\316\2443Qi\007"
+	.ascii	"\033-\333G\364\320\005\225C\320\263p/\204\316\177\314\022l\363"
+	.ascii	"\231B\270\244\001U\r\b5\\\343\024G\026eF\271\032\333%\312"
+	.text
+	.section	.gnu.lto_calculateNewGyroFilterValues.26.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\354\003\235\026"
+	.string	"F\250\214J\300\020)\035{hw\227B\263%-\241z$q{\234.\006Uu@\001\030\23323\202\001\312\0072\214$\257\325i\367\021z\255>i\245\364\377\267\333\246\353\022w\021\212C\237\177\177=\031I\301~|4ZK\b\221DJ\231\002s"
+	.string	"i"
+	.string	"}"
+	.ascii	"\377\313_jo\371_\367\327\020*\"\247?0\352\232\363F\ni\316\237"
+	.ascii	"\201\037 \265\377S\021Q\233\324\227\250\375\334?C\1779s\344\220"
+	.ascii	"\323#!5\347\214q\007\315)9\212\035\362\346\256\243\311j\306\027"
+	.ascii	"\243\344\200\r56:\276\240\261\351\255\210A\233Ga\303\013\312"
+	.ascii	"-"
+	.string	"\237L(`\316\251@\272\025|\273\335\321d\316\371\235\361\325\350W\372\237\346?\203\237m\004\037`Dm\345\326\001\366\374\350\266\352\377\355\226q~\r\347\234\363|\363\367~\244\3670\375Q\005\300\373W\357Cz\357\n\367 \274\377\340}\253\367\036\275\357\350}\031\356Y\274_\361\236\354\375\310{\261\367\335\373\260\367\034\356\227\367\032@\304\361\004;\232\323B\025\216\351\324J \206\202\2264H\205^\364\367R'\3103\347,\265\003%IL=\3158%t%S\025-+\326\025-B\222\377\231*\2150\311\n\244\0054,\355\240\212\250\306\250\221GX\2074\364\361\020\245\323#\252\261\033Yy2@\361vDN!\022\24534\232En \214\220\233;\006\317G\247\364@\2219\344\021\310\333\331m\325\227\231\265Gu\bj\202\266\\\362\004\274\261s\316\030~\213\250\354`\204\f\231\235\372o\323\242\026r\316\211\340J\264"
+	.string	"G\006_!\301\255\270\234\320b5\033\215\006K`\273M\220\261\216B\"\253\315j\022\\\032<H\231\251\314\"\260\320f\270\230l\246R\263\241\304j\263\023Z\f\345\206\213\221\020\270\215%\345\026s\261\331n\261\362\247S\276Q\220\303I\307;\362\305A\030\277|AE\322\020\206\261\n\035\251\213C\270\233@\330\305\004\302%I\301\361#E]|\2606\211-f\341\301-n\243\036\225\016\205v\260\007w\323\t-\271\203G#\026\227K,\016H\250A8\210\021r\244&\243 \005I\232\003\300\002\221!\263\003\021"
+	.ascii	"\251TF)\032\231\245\261\347\365\tr\200\232I\270\301\362\026\360"
+	.ascii	"\261I\245D\2629\004\r\363\321\005\n\304\215\244.\376\351.\331"
+	.ascii	"\325\022\214\201+K,DW.\340\177\315M\021\363\305\243\314^\210"
+	.ascii	"g\226\243c\362\256>\376GJl\227\340d\257\342\201C\350\343\272"
+	.ascii	"cGA#cL\250\022\323\352\034\321<Q\354K/\270I\fb\r}nZ\004\r\306"
+	.ascii	"\305\251\016\0078j>\374IO\301\352!d\246\3604<\320r\264\266\215"
+	.ascii	"R\001"
+	.text
+	.section	.gnu.lto_applySimplifiedTuningPids.27.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\345\n"
+	.string	"F\024LA0M\225\016\310\225\002t\330\371x\200\254\370\364}i0\275\263t\244$\356L\312\350\030\370\370\r\253\360\336\236\025\221\210\361\377\2774\f5\252\255\307\327\211\302*\212\243\232\250\022\033Q\f\261d\357\275S\n9"
+	.string	"6"
+	.string	":"
+	.string	"W\201`\340A\305\356j\222\302\275O\031=\377\251[|`\350\363\301\345\364h\211H\221\001\222\246\244d\341{\352\261\0018\212\0212`w\035?\320\301Mo\233\200m\001\366!\001\366Q\377\214\321\307 \021Jp\204\330-\275V,\213\216\270\020\261\375h_\3037xG\201\256\261k\"\261\332\r?\f ;ux\tv\232}\003;\265g\243xx\332\2371>@`\221d\350'Wk%\375\301.\021\250N\220\242\313\266\347\035>\331\356\006\3609(X\220U8\365A\330\351%\305`\"\003J\024_v\030\212r\202\375\271\273ki\n\226L\275p]\201J\335\\\2302\301lu\363t\fT,\365R3\033M\345h\230z\3318\212\266\325\003\032\215\322q\264I\207\271\215\245\323:\034\327i\221p/\201%\222\243\231\305)\355\004\234\370\020"
+	.ascii	"2\003\3020\304\302\006m\3206,kT\263 P\211\020\264\021n\312\204"
+	.ascii	"\0260\345\022l\263\232\"\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_applySimplifiedTuningDtermFilters.28.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\335\n"
+	.string	"F\324K?0M\225\016\b_J\250\253\202\320A|\335\003\330\b\264\3336\212\243\202p\024\"f\006>~\303*\274\267gE$b\374\377/\rC\215j\353\361u\260K\305\254\211\026\261\021\305\020K\366\336;\2459"
+	.string	"6"
+	.string	":"
+	.string	"G\211\200\020\"\305\356j\262\302\275O\031=\377\247[|\340\347s\302\345\024\320\032\201\"\003\024M\310\350\302\367\323c\0040\024\243\343\300\356:~\240\204\233\3366\002\333\006\354;\002\366M\377\214\321\307\034\033J"
+	.string	"H\355\216^+vEI`x\330~\264\337\341\036\274\233<\327\330%\261T\273\341"
+	.string	"\023\310N\035\036\202\235f\337\300N\355\331\254\207\245\r\2371R\032V\"\371y\311\325RIw\260K\006(\023\242\350\262\3159\210N\266\273\005\374\017\016\036d\026N}\017vzI3\234Pa\002\305\227\035~\242\244`\177\356\356Z\222\002\224K\255p]\202I\315\\X\022\261lu\343l\024L(\265R/\031L\325h\226Z\3318\211\266\325\005\030M\322i\264H"
+	.string	"s\031J\247m8\256\323\036\341\236\303\n$C3\213S\332\r4\361\001\020"
+	.ascii	"2\003\3020\304\302\006m\3206,kT\263 P\211\020\264\021n\312\204"
+	.ascii	"\0260\345\022l\263\232\"\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_applySimplifiedTuningGyroFilters.29.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\365\n"
+	.string	"F\224LC kj:8 B\343!\244\003\262\226\376\024\314x\271\217\301@\361\322\260H\300\350\210JZ\035?\364\026\371F\263\260\334\021\b0(Z@"
+	.string	"\016:\376\3351\372\344Pw\300S\240NM\325\237\354\275wJ\0018"
+	.string	"6"
+	.string	":"
+	.string	"Wm(@A\304\356jS\301\301\323)A\377\251K\204b\350\024\301'\325hY\bQ!\222(\245\304 |\352\322\2008\222R\362\261\273\226\241x\340\256\267\035b\333\303\276$\366Q?\225\322\307$\0318`\274vK\257\021\313\252\027\032Ll_\332\207\360\b\340Q\240[\354\232<\254v\307\rsd\257\036O\301^\263_`\257\006\355\017\037O\033\241)*``\221f\350'Wk5\355\301>\001\250:\220\244\313v\347\023<\331\356v\370\022\b|\262\005\257>\b{\375\254\016@<@\211\344\313\036Cr&\260Oww=M\001\033\207\351<\020\357\373l\023\266T\266\216\353:\034\221"
+	.string	"\027\016\303\t\320d\270\215\266q\230\316\263h\0357\222\321,\337F\253d\330\323\\>\215\343y\2376\031\367\032X\2429\242\231\244\323\036\260\221\017\020"
+	.ascii	"2\003\3020\304\302\006m\3206,kT\263 P\211\020\264\021n\312\204"
+	.ascii	"\0260\345\022l\263\232\"\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_applySimplifiedTuning.30.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"m\t"
+	.string	"\326\021B;0\345(\035\200\013\217\272M\250\371\210P\213\261b-\270P\242})\034\2153\272F\303\234\rl'\262\313\314}HS\025\214`\240\366r\234\216\205L\t\006=\372\266'm\275wJ\001."
+	.string	"2"
+	.string	"0"
+	.string	"\230\313\314\t0\227\366l\330\277\217\275\013\226A\002`wg\364\270w\350\371\037\271F\265B\035f\236\3355T\2558\356x\333\b\266\035l\267\004\362\255\037f\231K\312Alw#\026`_\362\004\304\3669\266\341Wa \260)\227\206\347\320~\310E\274\267,>\260\313B1\331\375\024\274\220\271\364\367\202\265\233\234o\037Ynxy]D\fk\240\214v\225`)e+\022\302hS\234\340U\206%*\257TD\331\037\n\306\016\373\001\273\273\216,\373\337\037\033\325\270\312P\273\323\266\t\211\250V\273\007\020%m\374\351l\034\345&L\020\240\020\325\250\2104\242\245\271Q\215\253\237\311\321\210\321\374t\245\331Ip%\205\272i\252\001\016"
+	.ascii	"2\001Wx\006\\,\270\007\214\331\274\366f\023vam\205\361@\211`"
+	.ascii	"D\200\212\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_disableSimplifiedTuning.31.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\365\n"
+	.string	"\346\223KB \213*\035H\275\025z\201\300\204\300`\360\022Q-\246+\020(\305*e"
+	.string	"f\207yQ\245m\030\253\252\213J\206\306\362\035Hh\n\022\304\313\250\333\325F\263\300\023TF\335\352=\214\301\262\237\004\221\235R4"
+	.string	"7"
+	.string	">"
+	.string	"\033\224s\256\257\350\316QN\321\235\363hgxe\260\207}0 \233\355\256\267-\370x9\372\177p\b\224\312t9\301\354\256%J\265\272\267\333\306\260\375a\277#\227\354\356zc\331\257?\367\327/'\"u\266\341\242\303n\252F\333\013\\\205\006\266o\261-+\311Bb\013\300\016`.\355\273\356`\374\253\364\211]\226\205\t\273U\303\001\033\313\022\n\325\203\206\323F\200^B\004\220"
+	.string	"Rwn\004A\353\262\333\237C\260\254b\263\213:;\364\230\210\262\273\034>l\300(\002C\253\324\235\003I\321\022\2708\234d\315\256&\271)\260\003\340\374B\352A\305\021X\331p\346G\305\020\315\364T\234\271\200\341\fC "
+	.string	"\232\315\374&\307\323\231\037\017\234_H3^8\003t\274\214\370\361.\031\246\236\215\350\201(\025=K\335K6\022"
+	.string	"2\241}\034\030\027\316Sc"
+	.ascii	"2\300\230*d<)JBE.\232\335q\260\353\256Q\2540\036(\021\214\bP"
+	.ascii	"Q\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_pidDefaults.0.32.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 \231E\003"
+	.string	"\224\004\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\370\035\001\320-\005\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\375.\324/\304\001{\303\001y\302\001w\301\035\001(\306\030u3\307\0014\305\001\300\001\277\001"
+	.string	"\r"
+	.string	"5\003 \270Q\350\001,\202r`\030\270\002\346~\325\035*C\244\fV\te"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_dMinDefaults.1.33.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"D\002#"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\025\001\002\005\001\006\325"
+	.string	"\001\"\036?\202\210\200\030\1773\275\0014\274\001\273\001,"
+	.string	"\002"
+	.ascii	"*\343\017\240\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"e\004"
+	.string	"d\006\026\001"
+	.string	""
+	.string	""
+	.string	"\002\030\177\r\200\200\200\200\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005 \016\300\204\001"
+	.string	""
+	.string	"\003\005!\017\002\031\177\020\004\002\032\177\021\033\177\022\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\002\034\177\023\035\177\024\036\177\025\037\177\026\003\005"
+	.string	"\320\360\372\250\001\001b\003\006\003\007\004\b\005\"\003\b\006B\003\b\007b"
+	.string	"\017"
+	.string	"`\220\326 "
+	.ascii	"30 X\013\361\001=\3007\300\237\235\004\250\352\360\340\030=k"
+	.ascii	"\002s\237bd\304J\031"
+	.text
+	.section	.gnu.lto_.refs.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\001 "
+	.string	""
+	.string	"\001+"
+	.string	""
+	.string	"\0027"
+	.string	""
+	.string	"\0019"
+	.string	""
+	.string	"\001\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.62822d46fbbb2dcb,"e",@progbits
+	.string	"(\265/\375`\\'\315\234"
+	.ascii	"\252\360\0045P0\216\273i\f*\334\204L\206[\227\235%*\275\306J"
+	.ascii	"8K\214\017'IF\303`\356\301_\003\006\274N\034\367*f\323\202\036"
+	.ascii	"\301\364\201l7l5\240\240\2335c\325\351\306\375\"\020\206\363"
+	.ascii	"\253[\233\347\330\323,\267\002:\202\314:r\213RJ\231\002\315\002"
+	.ascii	"`\003c\003q\214\362\223bh\335\234>\022!}\244A\372H\201\364\275"
+	.ascii	"\"\365\253\346!2l9\2719\377\321v\265O\272\001\220\336\364\221"
+	.ascii	"\324\364\221\260\350#9\321G\n\242\217\324\245\177DH\377H\216"
+	.ascii	"\366pTF\377\250\212\376\321\021\375#0\375#-}#\031\364\215\336"
+	.ascii	"\364\215\276h\007\214\260\350\033\301\240od\3247\252\241_$\247"
+	.ascii	"_\304G\277\250M\277HM\277\310\212~\321\021\375\242\035\372jQ"
+	.ascii	"Q_\377\321\327u\364u\030}\035E_\027\321\3275\364\211\006\351"
+	.ascii	"\023\325\321'\022\243OdE\237\210\211>Q\230\223\356\326\2706\354"
+	.ascii	"\331\207{\343w[\365CW\352Vo\022B]\264\334|\242-}\373A\207\347"
+	.ascii	"\346\354\007\335u\201\364up\372:/\372:'\372:\243\276\216\250"
+	.ascii	"?\244G\177(\215\376\320\231\376\275\372m!k\305\242\241Mvl\271"
+	.ascii	"\371n\251_\"\016c&\206\334\315\367\212\306CO\364\207\212\350"
+	.ascii	"\017\341p\322Y\031\354\f\366,\312\002\332Y8X7\\\270\371C5t\013"
+	.ascii	"{\316F\351\236\375\350\3475\372\267z\360\33036\016\205\275\263"
+	.ascii	"\366\336PHc9p\270\271\331\256\226\317m\234\335\263m\034\004\306"
+	.ascii	"\275\257l\334Nn\357\253\235\265\005X[@\236\"\326\304\213.?\233"
+	.ascii	"\321\226\212\324\255\036'\035W\230\272w\2738k\177\230\334\374"
+	.ascii	"\354E\027e)\372\031\211~\336\241\237e\350\343>\372+n\323\307"
+	.ascii	"[\364\261\022}\354\245\217\267\366\360\246A\210\321\016`\321"
+	.ascii	"\023\334$\372\027L\237K \3750l\364\321\244\351\273I\321\247S"
+	.ascii	"D\177\265\\\332n@\251\376\t\332f\261Z\354Y\007\273\345$\"8&f"
+	.ascii	"\331e{\253\273\244BR\n\r\272\371)\314>"
+	.string	"\005gGp\004\364m\007\235\235\263\035t\277z\311>\351,\227u\322E\331'\335o\253\374\226\212-\353\200\2135\214\233\313\336*\323N\005\2631\344\346\253\366I\247\255\223\356\366\317N\327\375\031\023`A\324\215\376L\301\177\231\354H}mh\340\267\203.\003M^\364\3479\277M\363\3338\277m\343&\356J\177F\340\2673~\333\365\333\260\337\256\320{\322\237\241~\273e7\370\357\002\277\355\361\333\261\337\232\370/\321\177\365\177C\374\226\203\337v\360[\030\277=\361[\r\376\253\300o\377_\020\277M\177\033\344\267H~k\302oS\370m\t\277e\341\301\377\024\367\303\177\013\370\207\037\007\372/\001\377\355\360\337\250\377n\370\257\206\3776\375\367\350\277E\377\265\277\225\373m\334o\231\374\027\340\267J\377\023\370\277\345\267}~\013\345\2671\374\017\341\267d\277m\362\277\354?\324\3775\377\217\346\346\346\346\376\373\365\033\241\375"
+	.ascii	"\360\t\372Lg\364\231\316\364\231\240\3503%\321g\322\241\317\204"
+	.ascii	"\245\277\244G\177\211M\177I\325_2\242\277\244C\177I\206\376N"
+	.ascii	"\220\376\356\216\376.\215\306Y\260\026{\306\001\233\305\035\301"
+	.ascii	"\352\272\371;1\232\205\275-\007\235\235\233\263\034t\337Y\321"
+	.ascii	"\337\025\321\337u\351+\311\351+\275\351+\235\321KJf\372J8\312"
+	.ascii	"\007\235E&\255\354\346\037C\211!i\fM\206\224\030~\f\203\025s"
+	.ascii	"\266\013H\355\317\327\315HO\310\224\264\230\305P\345fL\366\343"
+	.ascii	"\027\260\023\335\244\313k\337l\271\354\223\256\351\370\210\233"
+	.ascii	"\020\321\2502#\314\315\230\311N\215\315\211\334\315W2\352?\200"
+	.ascii	"\204\213\232)?\216^\276p9\246\215\251\262\216\275 \205\f\n\222"
+	.ascii	"\225,\312\221\365\307\005\362\246"
+	.string	"\246-\006!28\362\254\\:\352\254i\266\f\\Y\233e\003\307D\220\fAG\256\035n\326\261\343\224\034w\216\030\314\316\335\253mD\306\221\355\013\217\332\203\215 \032\200\216cK\252\254s\350\270\360\347\312\341\034W\rNr\323\334;x\f\013\271\2000\027\266\2017\016\202\213\267\317ms\343\334@\367\314u\203u\\;\027\017\326\3028p\215K\347\262\271kn\033v\001\317\270\353\335\203\211\3348\334\205\215\370\n\357\270r\256 <\004\367\300>0\026\026\273\2040\220\213\006\363\2702\340-\\\344\352\271\203\356\f\230\306u\273~\356\234\373v\013\341%\227\017\316\302aX\306\205\303?0\022\f\343\326\271s\370\013\037\301F\360\r\254\004\023q\214\233\347\302\301^\367\215=\303`\227\314o\231\313\306\305\013Y\fc\353\034\ff\363\330>X=j\200\266\265\356\275\245\304l\255n\305A\3074\213\006n\212\017\"k\310\244"
+	.ascii	")\263i\340\242X?7V610\353\231\213U\\\307\230\224\255m\334(9\222"
+	.ascii	"\261wvHa\260k\345\202\301j\030\0230z<\340$\312:\246\304J\031"
+	.ascii	"\230\035A3\002\035\311\250\370X\323\344H\006\003\021%\352\221"
+	.ascii	".k\030\035\025K\332\332\r\362\206\206\313K\217\234#G63T\216b"
+	.ascii	"\204\254\035#\270.\274\265]\271f\276\254mD\276\254n\366\r\\\222"
+	.ascii	"6Zr\353X\222+k\331\315z\233S\003\243\320"
+	.string	"\361\3075Z4\"i\326\275U\251\265\035\253\030;<\322\302X\231S\247\307\361\222=Y\262\316\261\177l -\033\253m\373\357X\023*k\233\"inF\210xY\325\272\316\366\3041\202$L\330\230\273\245t\265\264\263`\334(\373\357\017\fv\207\234\251\255p>\340\214y\031Tc\215\320\fAV\016\216\306\225.]\324\300\\9Z\371/\327\345\361\326\306\246a0\373\006\007$DT\b\035V\216&:,\223|%-]d\374J\022\244\237tG?\311\214~\022\232~\322\023\375\013\346\277e\267\312U\263\306\242\2574c\300\334\374%\n\027\232\001\246\312\315OZ\242\273\\.\327\313E\263g7\355\232\375\236\331\266_\365\021d\261hX=\022\241\211\245\271\335\264\273\345na5\214\326\322\242\266Z\025\213ES\".m\2548_\216{\253\177\340\227\372IDp\323\256\026\213F\264\335\266\026\232\230\027\242\2617v^"
+	.ascii	"\264\267\032\025\"D\210\020CH\302\342\002L\262\027\222\231\227"
+	.ascii	"9"
+	.string	"\200\226\310I\311\343f\355fU=\n\363\243\313W\022\031;=m\202\310\271Y-C\332\332Jb\314H2q\315Mk\353\346,\226\305\262\021\313\305E\214c\340\214\327\235)\200v\330W\221g#lC1\360\370\201ss&\242\007u\271\"\347\346<\204hM\0331 g\3139\304Pa#\246\277\226\203\344,F,KHv\374\250q\361\001\004\b!@k\261\313\315\177\202\301\203G\366\241\347H\244#.\206\024\027\236}\\9&f\322\334\234{\350\326\224\220\331\332\023\026\226\275\332\034u\016\031\002\221\001\003\006\206\345\326\216\273+n\214C\224\344\257\374U\201\026.\353\016\013\0031\344E\206\215\316\315\327\340e\3436\262\227\336{\0379\346\256g/\333\247\f!b\346*\272\372c\214\313\\yK\327\347*\312\2318?=\b\005\31270[\256\002c\214\353O\246\361L\003\313\335\342\352t&caB9+\313\270"
+	.ascii	"\253\230\255\240\311\305\2334\310\316\232\0357g\0309\206=;[\326"
+	.ascii	"\372\275b\335^\224\245\252fJm\340\346\320!\243[\020\331\263\351"
+	.ascii	"\356\264E\337\t\212\276\225bq!L"
+	.ascii	"\b\317e\342\0050\212\271L\227us}-\220\267\275[YG\306\334\374"
+	.ascii	"E\305a\344\312\310\315wJ\242\357\344C\037\377\3012\034\317\360"
+	.ascii	"\031\260\234\r\333\030.\016J[\224\035\306\005\342\307\203\216"
+	.ascii	"\345\256\007i\013@\204e\253F\234\233\377\007\0132\212{\363\006"
+	.ascii	"'(\220\021\216:gl\230\311\020\222A8\276\334|\206\001]2j\226\240"
+	.ascii	"\351s\363\233\334\364ou{{\r\251\233\013\013Ig\207\254\005\361"
+	.ascii	"'Yl\r\370\237\367\376\177\202\004ug\341\221\363\243\311\326\256"
+	.ascii	"z\334\303\006\2617\221\253h&\204\310T4\273\332\3053\267.\246"
+	.ascii	"\242\272\203@m\263!\273\250\032\211\331H\274[\335YB\272v\226"
+	.ascii	"\221(,\252\233k\253F\342\322\316\352Z*\252W\304\242\231\220."
+	.ascii	"[43v1\355\254M\334YWAt\226\261\253\330f\354Z*\232]u\025\263\204"
+	.ascii	"t\331\255\032\267}CF\025B\214\261\315\256\222\366\3365\324#\021"
+	.ascii	"i\357+\256M\204sml!\253\215\375c[7)\352\220\275\367\336D.t\304"
+	.ascii	"\214E*\326v+>"
+	.string	"1\376b\354Mg\333\200\200h\211Z\033\213h\367\216\241r\355\215eD!\314h\345hq\355\244\235uU\003K\314\210\024\003\313\250\265\237\004\261]E31\243\224\230-f\307\215\245\022\355q\323\021\302\245\315\210\352\346\322'\311,IX\r?}\216\354\214\331]7\307\2059\301\222\347\3467e\321\177\300\013>#\242g-\003cG\355\262g\225\372\202g-\243f\214\024\270\035m\266\240U\261\261\266\255\321\261\302E\320\212\335\340;\370\rN\203\351`9\330\r\307\301l\260\035\\\007\317\301{0\037\274\006\353\301m\360\212\341\260\032\334\206\361`88\217=\303o\230\355\330\f>c\305X\321\242q,S\213+\231\2675S\302\330\256\240\315 C\303ceS\273\323\206\005\237\025\222\022\243\226\226\347\370\206\303\270\301T\336p\231E\263na\233\310\007\002>qd?\242\222\260\344@B\204D~\023\f}\215\366Iw"
+	.string	"\023\240\377\211\030\376R\262jD\360\254\252:{\303\340\331+J\311\02385T\002U\220C\323\007\3654\3640LK\0240\364\231(R\204\340\002(\024\222\034N\324\205\t\0014\250B\313\024%:\244A\023#I\005\315\023>\245#\007D\fS\240\0259U\226\360\231\302\244'0,\255\200\344\b>\023\005\213\322\2032%\201V= \331{z\317D\313`I\245\017\201\004\rH0A\013\242\364?\021#\206\3509\f\226C"
+	.string	"\n\030\3622@J\203eU\271\342<\341\241DI\026>\224\3741\241\303)\336\217\312\374\361\312\241\025\357L\217\244\234\244\244H\360^\3744\220\340\245S\3470\252\034NM\235;\026'p\n-W|\240B\257\374\365\222\244\224\230\210\202\246p\330dU\"\250\302\004\222\031@i\330\340+\323^\231\226%\206IM'\352\202jC\0325\344\241\360\231B\244\027?\336pH\nY\234@%\251\027?\2453\330\224\376'\302g\nG\244?*\0238\025\365SX\242#\322\363DG\034i`\207\274)\237)\324\241\260\034\330\022\326g\n\261\024\n\241\225/h\222"
+	.string	"u\304\2024\301*\004\237)T\n\232'R\f|\246p)\355\225SS)Z\246@3\345\005\317\027&z\376\242\\\244\346\n\0225a\246Ar\227b\003z\246$Zj"
+	.string	"\201\005\351\202\tX\366z\030(\371\250\226|\300\3637,\315S\230\226\303\250\262\312L\215\\\220\300\322w\244\301ig\364\342\307\353\r5\270@\313\025g\257Dy\277!\211\366\224\224\236\322Si\311<\"\243\206f\013\222Ge\245\242\364A1\r\253x>\262\374\221*\234'\220\207\226A\363D{$\207%&\364D\321\022jj\352L\255z\274\036o\250\202l*\205.R\036\211\335\213\037/h\246<\t\244\364\213\337\211`\331CK\024)\004\350\240\004R\0051\200\n\232\244\t\246\264\034\226 \240%\025\225\211\246`q\002\201\030"
+	.string	"O4\r\236\031\374zA+\0228"
+	.string	"\257\034Z5\265 \201%\312cA\272\340\371\312\224D\251\3124hjxa\242d\0314;H\207V\350/u\0322*{Ar\205\217\364%\245V\302\324\352\344\241gzV5\351\322\240\325\331\343\001\201e\217\307;S+\022\n\230\246'\372Kyi\260\214B\311_/\227U\244\007%\320\234:Q\341Q\225pIh\356\312!Y\242\275\240Y\002}\346S\3604Ss\030$\321t\003U\320\244\"\321r\005\371\364K\317\263j\210\236i\217\234J\315\0248\244\303\363T\301\224\232U&\220W\266 \253"
+	.string	"8\205-J^\320\205\217'5%\004:\225=\022\345\001\313\025%p\027\034\006Ka\325\331\343Q\221C^J\252X\361T\372\316*\336\320\247aHV\t\360\353\245\246\220\007\004\236h"
+	.ascii	"&\223)l:\315\224DyA\263\312\367\0244I*\236\017%Y\240\347\224"
+	.ascii	"\257,\247\002\200Jy\023\244A\323\212\350RR\031x\020\301\003\023"
+	.ascii	"\272'\202*h\006\255\322\021T\346T\360\354\215\b\232d\325\210"
+	.ascii	"\036:\034!\002\001\2644\201B3\005ZU\361\3202\005\232S\274*\264"
+	.ascii	"L}<_iN\231@a\2259\f\203X\250\242IM\246\2342#3#\"#I\222t\302\n"
+	.ascii	"\020\006ea\034\250\262\007\022@\003I\317\243\016*\032\221\202"
+	.ascii	"$\005\205\372"
+	.string	"Os\211A \3236T\034\337\023\330\227\324\277\364\022\356\303w\332\342q\030\0259\022\254\032,\013\316\300\325\225\324GQ\244\351\203\272\350\222S\205\b\223r\362\264\361\236&\271\027\005\261\3115\303\007 \376\f\177\322\341I\204\314S\302\316\313\261\026\233\214\325\211k\256O\246\026\235\355\350\026#\2749o\325\313\031\221{\364\201\036*\"\221\377\207^\207\263DT\016\227\b\006\345\rc\355\300w-\211\231m\363\375g \332-@\2707\332^n'\330f\355\251OhO\326-\247\001;\255R\323v\023\276\322'\343\331\222\247@%\244\375\327\264\304|\215\2403c;\034\306\262\021\344\304\361Q\327\260\200\rf\2204ik\"\355\"\305\250\"Y\033N\247\221\261\374\206WfbJ\246\321\315\f\024\300\r\272\b2G\314\245\226\016\232\2246t\356\254\312\034\221\3408\213%\2377f\242\347\364\361\266\252%\356Y\352\225\013\221N"
+	.string	"\203\350\226\220j\277\263\225\224T)\246K\371\266\254\023%w#N\245\271\251\325\233\2175\324\245\376Y*R\241\002\216\323!5\32464\347\321\323\325\274`\201\003\325\340:S\374\366\0024\002<[\216\373\210`\346dD\353|B\326\200\242W(G\031\263+\301\353\310V\213O\027\254\264?A\334\030\226\237\335\346\237\374\227\250<\201 \005I)\234Q\007\bJ\310\270C\256l\275T'\027\345\342MJT\266)u\357(\256\206\213:G\252\316a\032\233N\275Z\020\177\227[\250\025\247\031\333\t\"\335}\024\222\3171\036]\306\355-E\346\177\212\2502\206\332e\\\375\312l\257u%\221\250dW\030p\234\022\330"
+	.ascii	"\253\344\332P\351)\207na;\245\203\276\360 \245\276\353\273\240"
+	.ascii	"\347*\004\003\260\350\202<\347\230J\352\232*T\217\312\335j^\264"
+	.ascii	"\227\007=\347AqFf~7D$\b\362\313\205\243\341\373\277\245\316\316"
+	.ascii	"\323\355\201\375\201PGP<&\366\260\346\031`\030\275R\305\341\344"
+	.ascii	"\246Z\265\3045Bo\n\276U\251\332\025 B\367"
+	.string	"t5\324\0040%\213\t\331\226\257\t`s\232\230Y\204\270\225\206\350\031Uml`\320\347\007U=R\016\004A\307jBL\377\335\243\3507B\231\206g^{\362\263'\fJ<\216y<\267\206\326\227d\336\212\336\374<*\331\326\032\345\231\216Us_=\261*\220\313'\"L"
+	.string	"\205\364FV\003\351\246>\020C\246M\221\275\211\272K\240b\215\3008\326\257\244\216\232x\331M\231\365\267~2A\224\347\250\267\225\207p\201\272\3428\\\351\322\3760\267\023\"\347\364':\224\264%\274t\276s\3236\210!c\346\374$\314\324\272\246\241\345*\250\375\353\002\177\260\264\3576Z\005\216\365\031\202\222_D\264W\270\372\324p\\\245\324\216Cr\246\2721\2708\n\262I.H\036$\262\224m\260\345M\001#P\363\007\263\227\256g\212\330\002B\023\357\204\261ZBy\r0\003}<\300\376{\031 \311\301\222]xI.\202\211\246\366\345v\320M-\302\305q\337x \0138.\341\377}7\333\003\277\266'd\362\341\220%\0034\270\004V\226c\025\331\355\017\225\325\222r*\241/M\244\233\334II\372F\034\302\304\350@\305g\036'\326S\243\364\177\355\031\254>i\233B<D\230\033"
+	.ascii	"Y(#L\031\007>\372 \035\355\322\247\303\217>\240\302\\\221\365"
+	.ascii	"\003\260\330t3\031\204\342\324J\f/\225"
+	.string	"n\262\340V\305\303\312\001\260\031\373\n\320\221\246r\256\271\326\206\025S^cW\233\305\256\304\347v\254\217\221\247qD\025\372p\251f1\330\201;\",\271^\313\236~\206\375]/\311\305\316W>\3307vx\254#d\264\021\213D\214m\362\303\237\311\371MIcr\024#\303E\272\002\024\246\333\370\025u\006.\203SG\226\216J\3777\023\244\215\020+\201\357\327\233\207\f(\024\302\304\334\325\300\037B\2623\377d\034\337\311\272x\213\207\331XF\336+:[L\t\335\343\272\bg\202\303\325\201j\022^\244?\270\312(i\335<`&l\236\005\275\bH\201\316}/\002\331\362\355\027_\345\327\211!\257\347\220@\005\361N\213\2552\271/\311\302\274GZ\314\335\222\\\337\0041k\034\323G$\351\306p8nsc#\376\215\2240K\212\030M'&+\336\211\264\246\223\245O\350#\316-\020H\331\252\371\316e]-"
+	.ascii	"\024\335sI\271s\006\030\n_GI\031]a~\314\353w\007(uy\326\223\200"
+	.ascii	"\256\353\3641\353\036\\\325\002\314;\376\256-u\2050g\335\257"
+	.ascii	"\367!9\3665\273\327\310&\355\255\351BT&\364@$?\021fr\341\214"
+	.ascii	"\360@&\037\375\305\353Q\213\222\024\315\235\211\244\355\347j"
+	.ascii	"%,\234!\022`\252\212\313\260\b\241\376+\347\354\224\320 d\333"
+	.ascii	"\204\363\200{G\033\033\347\016\252d\024\333\227Sa\345u\177g\242"
+	.ascii	"\324\f<w\326\007\302|L\3615\272>\3379\301\232V\254\005\377\237"
+	.ascii	"\276\007\035\214\021\252\0053$-T\004B\320\f\214\360\325\035\032"
+	.ascii	"z\271y\331\f\212\335\005\256j\324@\354\265Cb\2775\007\265\206"
+	.ascii	"J\252\264@Z\240\207q\332p\351G\023*|p\033\321\332\256\035\202"
+	.ascii	"F8\334\201\210\265\360\256\007\330\t\0203*\212\321\206\363\273"
+	.ascii	"\367$\307\353\033\326\023\203n\317l\205}\025\222h\276\373\003"
+	.ascii	"\310Gg(\2052\201\247\b]\240\226x\375\242\355xa\035\030\b\352"
+	.ascii	"\327\350\261\310A\340\244\375\347\307j7\257\233\327\335\027\371"
+	.ascii	"\003\360\306\260\346\032\013\212\346t\234\211\214\027\334\036"
+	.ascii	":\261\036\370[pk\367\320\266(\017\314\t\331f\370\210\013\036"
+	.ascii	"\036\313\201\\\371V\370\t\177j\017>\235Y\344\347\201\206a\f\255"
+	.ascii	"\241V~\351\315\370\201\201\007\017}\213\345zc9o\234\204\346\362"
+	.ascii	"\"\\\311\021g\223\226%\220[\330\330\370\232\352*\021\277\370"
+	.ascii	"\334\353\376\354\321\265\001"
+	.text
+	.section	.gnu.lto_.symtab.62822d46fbbb2dcb,"e",@progbits
+	.string	"applySimplifiedTuningPids"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"applySimplifiedTuningDtermFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"applySimplifiedTuningGyroFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"applySimplifiedTuning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"disableSimplifiedTuning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.62822d46fbbb2dcb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
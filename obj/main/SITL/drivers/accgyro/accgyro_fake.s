@@ -0,0 +1,779 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"U\006"
+	.string	"\222\312'0pM\322\030v\026\035\025\333\2178\264\200-c\274\002\311\bn\3358\321\312\262\027\251\377\377\377s\365a\377\020\b!\204\354\275\311\336[\356\275\323\226\001\252\226VG\253\241w\206\004\b\224D\312\202\231&h\237w\347}\376\346DBE\342\221\313\343\315\354\211p\340\2508p\270\333\301\231\004"
+	.string	"\342\2011\345\256\353E\203\314\205$6\357\007U\216\\\016 \236s\273_\035\230\013\202\325\325\240X\2104\326n\373\267\331N\254h\260PV3\240\360\301\360\353\325:t\006\241`A\351\017\031\033\024*\251\232\004\021"
+	.string	"p\314r\233\021~\205\001h3T"
+	.string	"\022\242\200#h7\017\316"
+	.string	"A@\362;[`J\310\300\314VR\337\335P"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375 \331=\003"
+	.string	"\024\003\315"
+	.string	"\r"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\b"
+	.string	"\007\003\001\001\001\003"
+	.string	"\003\001"
+	.string	"\001\006\002\b\t\013\004\r\001\001\003\001\016\003"
+	.string	""
+	.string	"\017\003\020\021\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\027"
+	.ascii	"K\020X\247\020\334\025\301\006Qt}\306@p[8\221#\240(\002w^\200"
+	.ascii	";\231\30683\320\314\262v\250%K-\202\225\245pQ\031@gP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\251\001-\t"
+	.string	"\022\315,1`m\322\030\305\n\213k\267\352\231P)Y\337o\334\0160=\372\3038\363\255e\020\343[\273\271D\210\242(\212\b \276m\223\266\211Z\333\204H)SO/\240\232 "
+	.string	"\314<\352]FO\027\363\026\235\240@\300\360<\\\037\224\234\241\301 \202\372\362\272I\216\001\r\260T\357(\f\264\273\355\206S\005_\323\251\242\177\312)K\215\320\347j\263\337\250\303\356JK\257\377E2\331P\260\230\376iE\350\263`\345+'O\016\022$\254\214j:-\025\244$$\243\375K\221\353\302\003\223?&\216#GIF: \254\361\223=\301\356\026|>\272\334\335\325\257NO/ p\"Bc\352\001OR\340\032Z0\322_3S+n\336T\311P\346\004#j\r\366\016G\341\034m\2532\3573'\263\314\300A\2666W\005\3205\034'"
+	.ascii	"\020\003[2\030 zP`\001\352\246\332\327\305\222x\267\231\fY\260"
+	.ascii	"f\005\351j\240N<J\242pK\310(;\200\316\341\215\254r\013\332`d"
+	.ascii	"\233\033Z\335\210X\007\3019F1\335"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`d\001\315\007"
+	.string	"\322\013(/`k\222\0160\f\3030\034\300[f\020\004\201D\321\2324Q\225\025\233>\201'u\202I\016\023\240+\237o\335^g\266k\335~[\322d\222\001Q\2049 \303\232\326\222 \213h\272\200\246\225Q\001I\030\030i= p\202\007n\322"
+	.string	"\201Ik\255\315\324B\357K\024\312\256\354\366\257"
+	.ascii	"\310\214\307G>,\254@<\232\204\207\314\360\210S\274\206;,\254"
+	.ascii	"H<\232)C\234\222\020\362\211\353\034\277q\247\006\373r\177\271"
+	.ascii	"N\n\203:w\316$\253\332p\265\231$\237^\346\374\005\345\225\374"
+	.ascii	"RB\007\262\224$ p\202\tL\235\035\353\031p\323\201\333c\206\375"
+	.ascii	"\252-\334\nR\212\025\2738xV\251\020\370\rb\302\301\270K\362\033"
+	.ascii	"\245\031\002f\003!\007\332XjoH2/A\300\253\035\231F2M|\215y\207"
+	.ascii	"\260\362\023>\006 `%y'\236\322\236\213\305\tR\377\033J\021"
+	.text
+	.section	.gnu.lto_.pureconst.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\232\004\r\230\004\016\232\004\017\232\004"
+	.ascii	"\020\232\004\021\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\005\007"
+	.string	"\262\b\035'\2205I\007\377\340\273O\362\335\376\211;i\377\377\377?\237\035\242\331\377\377\247o-\n\260\376\326\255\352mIkD\312\024\177\247\"F\226\330\235\212\016"
+	.ascii	"h\032J\354\334\330\265\230I\223\244Ho\2676H\025\304\257\245x"
+	.ascii	"\224;\312C\033u\327\0304Z`9\363\251R\275\030\330*\t\007L/\340"
+	.ascii	"(\003O\207\312\347S\316\350\335B0\347\213r\250\275\355\315,\b"
+	.ascii	"2 \240\202\031#\363\204~\025\224\360\236\f\303\323\262\351>\002"
+	.ascii	"f\305\021V\210\212\fr LI\260dP\343\f\303\t\254\335#\310i\207"
+	.ascii	"\316\254\356\266\261s\215\273\206qN!\242\t\\AWq\300\203\310w"
+	.ascii	"\334-\b\2763\362\213\3315BC\307s\214k\2675F\214\"\304\212v8;"
+	.ascii	"i\003\231\206\246p\345\331\267\006vESC"
+	.text
+	.section	.gnu.lto_.lto.c3af2d077162e0cd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.20.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"M\f"
+	.string	"v\327TB\020\261$\0358$c\325Bp\005TQ9\333\377s\202\006\320\305\341\373\004\022?\300\250\334\240\377O$Z\206\367#*\fQ\211&\223M"
+	.string	""
+	.string	"\n#\267\313\200\366?\007\002\"!>`B,\331[\312\224\002A"
+	.string	">"
+	.string	"D"
+	.string	"\003\244?c\266\315\267\227]`\303BScw\241\2168v\247\211\371\237yG\324\262\273\311\303\325\205\210^\320"
+	.string	"\240\2558\220\026\022\3613O\016\232J&G\203\335uF\255\303\375n\333\201m\006\366\037\004!RrdoY\252\213}\267\273k\005\331\227\371\235\2463\323\357\320\300\302\202\300h\267etcC\017F\t\017\333O\373&\036\203]\346s\001\273 \0275\273\033\002+\230\376\274\035D\372\233\036\032!\305\214\225\274\361G\372\035\351j\223\224\344cj\201\r\232\331_\221\341#\332\326i,L\273\233@\205\211\307\200\f\230\217\364wU\0201\342\007\247\376\211\243\370\3700\306p\222\217\177\376\211\364\227-B\"b\002\326\2052\342L\211T$\234\t\020\254\013e\204\2428\320sU&\235K\002\244\320\341\224@\352\362@\221\020[\025\252\013^\260\254\013zl{\267\n2\f\331\020\245\250\212\013\2206U\345\243U\263\277\334\210jT]|\340\031\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.21.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\r\002\r\021"
+	.string	"\246\336mH\340\260*\035\350gT\b\205&y`u\030\t\235\321\324"
+	.string	"\330\226\374=\306\375\025\347|j\353a?d3\313\253\237\032\3339/\214n!\271\37110\034\201\rsj\n\321e\346L\217\016pa=l<\347\373\215\033\355\235RS"
+	.string	"U"
+	.string	"\\"
+	.string	"-\327\335\021<\272\335-\271\201\350\365c~\332g\361\232\3534)\027\260K\253\351v\311\222\031\210^M\276\300\367*\372\200\357\325.\273\347\344\313\276\305\007\0177>\273\033\322\023w}\272\374\343\016 \346\242\362\031\022\331]\317\230K\210\233\3366\002\333){\262\002>hw\327\224f\177\323\243\337\376\320m\376z\333OO\363\317"
+	.ascii	"\244\0353Y\t\026\252\203\\\020\275\036\233\243\306Ha\373~\316"
+	.ascii	"s\254\343\230\264\233\311X6\350\342\245\311q\f\341ffw\301W\333"
+	.ascii	"\304\006_'h\337Z\363cW`,\016lzD(\371\032\327m\001\270\025\265"
+	.ascii	"\364\0324j\315\355\207R\333\n>\243E\340ew\027\3702\276s\022Q"
+	.ascii	"\3631\324\367z\334'LK\314\254&#\315\021\365\313\024\311|\314"
+	.ascii	"\007V\250\212_^g5w\261\227.\271Ne`\267\273!0P4\3700)\337\353"
+	.ascii	"\210\276<\b\n\037\031\\)\3425{6\t\233\324\204\003\276`J\200\362"
+	.ascii	"\223w8\310\242\tEr\2520\242\032O,\210\342)\\\215(\016\251\221"
+	.ascii	"B\210!u*\t\305q\025\232@\254\312\200\032\303\r*\325\030\202\344"
+	.ascii	"\353\240\2454\037\367\007*b~x/\n\313Ex\356\243\027\274\026\031"
+	.ascii	"\336%|\366\204\343\030\021\355\222\b!U\235\234\031\036\266\331"
+	.ascii	"s\210\362\374\206\r\357|\001- \220\202\231\271\272\001Y\334\340"
+	.ascii	"\206\363\031=Yh\205\003sH&\276\256\035OD\267\273sb\201\260\346"
+	.ascii	"M\264\243q\3259\260jCC\233\265\\\261p\220d\226`\326F#\026*hb"
+	.ascii	"\254\313P5J\200\205&\3341\342\020C)7\210\0014\032\207;2\314\300"
+	.ascii	"\220\002>\200aIB\300\214\301\025i0\005\360\362\242\245d"
+	.text
+	.section	.gnu.lto_fakeGyroSample.22.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\347\002\205\024"
+	.string	"&\346\203I\300\322Q:\340H}W:\225=#\006\311\360\210<\273\306\203?\237U\301`\330n\2300"
+	.string	"Da\315:&\332[\360 a\327&\324\326\333OX\251\020\324\251\224p:(\240\271\320\002$\345,\350\347\212 \240\t\341\266[\246\024g"
+	.string	"g"
+	.string	"s"
+	.string	",vW\365i\337\330\252O\375h\225\275\273\013\333\213p\304\333\016\313\216\023\277\335\035\005\237^\021?\335Dr\265\337\342C\266\023q\360\310\256\017\021\322\356.\305\r\304\317\223\013"
+	.string	"?S\007"
+	.string	"~\332f\003\371\016h?\002y0\202\332]\2264q\333\325\346\177\374H\216\347v\rWv\327\232\343\tq\313\333>`[f\313V\275+\n\250\024#\f\021\217q\0315~\220cf\372\334\f\374\274t-\351zp\032e\357rT\226\260\237\332\335\265\374\261E\265\211\250^\235\350/\231j1T\207\240\032\f\325\023T\247B\265\004\325:\325\017"
+	.string	"\nq\032p\264\013\"\252\3106\315$\241\027\375\366\375\027\367\331\234\3473\365\330\3307z\317V\371\346<\273\226\002*\264s\022\245\213I\327\023JP\206g\272\216\034z+\201\237 \221\231\222\2223\3458n\244d\310cC\227$\345\350#\022\240\347\202\250\224\362=t~6\312\225&\210\273\313\300\247\361\032\024*\270\350s.\340\247\312\217W\335\007\025#\206\222Vj\"\375\336\013\246\317\371\244\203\274\371\275#\321\364)\367\236c?\202)\360\264\273\013fl\220\371A5\340\247\211|\306\240\202"
+	.ascii	"\366\362\2223-\261\231\214\0064L%\026\363\272`\201V\273\201\201"
+	.ascii	"\301^\254\231ZL\203\254\366\302\222\221\275f,Xm\206\245\222\300"
+	.ascii	"\264\f\261\032\213\206F\253\261T;\334\345\217Y\2064\341d\216"
+	.ascii	"qR\273>\016~E\032e\002z\336\307\007(%\362\274\377h\211\273\270"
+	.ascii	"\247\373\200\020\241\325rI\370\370\324\n\022P?\035y\363JW\322"
+	.ascii	"\367\265\370\316\303\347\330w\300\030\220\221\255\344}\0176 "
+	.ascii	"\240\002\2311[\007\2628\366\031\275\331\200{d\b\306\216\257N"
+	.ascii	"\302\337\036?\nd\003\311,\031,u\223\347\272FW\275\301\270x\201"
+	.ascii	"\226\30113bh\202u\321Z\236GiN\337\356\205p\214\021!\270\317C"
+	.ascii	">m\027*1J\206\311\242\205c\020\021|\341wa\031\315`\254\342\305"
+	.ascii	"HG\241j\024\312\261\0208\325\361v37\346a\207\243a.\234y\224["
+	.ascii	"1v\005\334\241\002\177y\321.2"
+	.text
+	.section	.gnu.lto_fakeGyroSampleQueued.23.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`,\001U\016"
+	.string	"V\034eF"
+	.string	"\257(\035@\307(\376\374\343h\253j<\244\211\242k\302\027U\212g\237\354\323\200\340\337\221\371\241\367r\367M\275J\351\250\374\346\376F\204H\276\352\227.\030\007\300\204\247\347g\004\b\347\225\320\362\b\211\233\220-S\nQ"
+	.string	"K"
+	.string	"T"
+	.string	"\036\006\341\276y^\200\374\306=\200\374f\333\007\022\230|\372T1\271\013\206\301%gwv1\345\247kQO>\352Z\374\260B\306B\246\265\341QC\020\"\303LG\213D\353\304\300"
+	.string	"\361\330\265\244\245R\325\360\354\256u\325:\271\267\333n`{\201\375\223\021eO\224F\024\373\332\356\256\343\313>\354\327\370\274\245\325\252\251\277\001R\223\343\202\300l\327d6ck6\025\036>\177\333\344\307\334\261=K\337\013\0326X.\030\234\335i\340\233=\234\252\375\021g1\0356r"
+	.string	"\273/\024)vg6\376\210\374\366\026\253\027\376\036\023\302\355\252\024\3700!\210\333\335G\017\326\n\007\026XJg\321\265\322r\023_\2222\016`\245\224\270Q\251\fs\350I\334\304\250\263\331M}\345\267\334%\344w\370fp\244_}\363G\244\n\372\225\214\217\235CE\304\306\300Q\005\337\004Q\350C\222$\007_\b$\"\355}|\022>\021\036\200a)\304\363>\035)\374,\200B\b\035\005\320'\324y!\251\373(`P\364\205\235\b\b\206]g\356\265\215/K\331\314\013M\374O\362\2613\220\311\274\320\250\177\222\032K\242=\251H\242E\224\350\237\020y\032\023"
+	.string	"_\321\233X\350\216\bw\262\241\274lG\025\214\203\206\036\225\200\204\230p"
+	.ascii	"\206-\361\230\3552\323D\272p\353\214\225\214\242\273<u#U5\024"
+	.ascii	"]\n\n"
+	.text
+	.section	.gnu.lto_fakeGyroRead.24.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`_\002]\022"
+	.string	"\206\"yG\340\322&\035P\2676;\244\355\310s\357\3354\312\325V\327\300\346\257\001\321.RJc\216\355\267N\261\017\016\266\326\365d\346vl\007\243Z\226\343\363\b\347\201\005h\352\331\330\313\223,B\243\233\330\360\312\211%\233H\231Rc"
+	.string	"\\"
+	.string	"j"
+	.string	"\033 \323\276\213\377\300\0164\363\222]\236\334\320.\210\342\006\337\243\301\233x\217\337\005x\217\266\235@\001\314\261\203(pHh\216B\300h\332\005Sz\342\261w\2321_\366NW0)\355\230Q\323\271v';H:$5\232\316$\311\204\217\207\317\233ZM&Jew\235\264\332\210;\336\366\004\333\021\354\274\005\255\350\267\\\036\362\264\353\303\177\271\026*\234\226lTf\203\262\324\036\373\335\356\256\225\307>\320?\342\364\347\245Q1\355y\351\030\323\235\227\326\230\316.\375\022\007`\323\017\002\270]\234\247!\253#\026\245\270\355\267a~h\021\037\374\013\330m2\237,\207Bxci7\347\300\243\037|\217\017F\235F\224\323\350\024"
+	.ascii	"Q\020\026E\252D\026\006\\\370\020\206\017\307\222a$\3473\343"
+	.ascii	"=\236\006$UU\205lr\314\362\t\301\205\2143\300\300^y\250*\220"
+	.ascii	"\333\335\005\217\251\025D\f\331\371)\232\345S\0221%\221P\355"
+	.ascii	"\261j\by\324\244\020\223\344\317\362\036\364\260\345\333\335"
+	.ascii	"\323\036t\031\255owv\232\037\3437\027\337\347\321/\001,\0160"
+	.ascii	"-U\214\327y\225\302zQ\261\254\270^2-\253\225*\025\363b\201py"
+	.ascii	"mHupQ\265R\253WL*\345\304.\030\326+\365\301\345z\245D\300}\267"
+	.ascii	"\312cO\251\307\r\247\177\314{x\tJH7\\\3721\357\323\033\333\237"
+	.ascii	"Ze\2464\226\351vK@\270\355_\262\345S\207R$\034\236\242~t\033"
+	.ascii	"y\033y\217\236S\324\032\001* p\202\241\261\344\001H\341|\246"
+	.ascii	"\227&\241-(\001nw\231SZ\373b\321\27074@\033\3318\342F\231`\347"
+	.ascii	"\327<\232\020\3379\rj\003n\264W\243\017LpGQ\252Q\026\"\323\372"
+	.ascii	"\215Eh\3737\237e\305o\203\215\026Q\204\\@\351 \241\274\315\370"
+	.ascii	"c\212\0260\214\374+\313\233\030\232r\212\256\265\007"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.25.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262=\254\177\200\267\237t\343\244}\235\037^\341\256\r\334cm\b\370\253Ln\221\246\352g'\227\f\016\037\236{\002\036\371\352\366~\264+\333\b!{\247\024R\223\020\223fh\222\316\020hj\001\2251\317\274\220\025\023\031\035Y`\230\214\":5>\224\"b|$(bT\024=\t\316B\223F-\313ht\335W\013;\237\273\n8`\207]I\017\222\330\257vw\r;\373I\240R4\b/\273\245\233\232\225\261`Nlo6\200mXG6\016\357\331Gy\312v\225\215\013\354v1\250\335\252\340\206\316-\327\023\\\267:\037\270n\331\366\002\303f\356\325\244\304\361\020\371`I\355\326\bK\316\375q\376Wnpr\031\231i1\221\3768\017\273\353\007b\n\271\341m\037\330\216\260}\n\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.26.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"5\013"
+	.string	"v\324MC\020o\225\016"
+	.string	"OJB\354\265\270\"my\217\026\366\2140\200rR\311\255=\002\312N\376\331!i\030\3532\367\254N`\227F\222$H\034"
+	.string	""
+	.string	"\335\205\360\377\356\364\366]\251\242>*:~\333\347Fd\247\0247"
+	.string	"7"
+	.string	"@"
+	.string	"\337\330N)\327\330Nm\033$D\344\360\243\252\364\024\205\b.rw\344\264\013\017?C\377\255[4\234P!{\231F\237\023\001\273\353I2\235n\355\266=l\003\260\257\t\3668\232Z\312\276dw\327\032\312>\353\237\023\002\025H\026\027\020\273\245\362\305\246\240$2\330\026\331\025\333s\332\337p\016\242\263B\317\330E\265F\354\216\037\036\241\234z\f+Z\354\314E\030FO&H\262\363:f\337Cl\352\n\005\247\343\271\013\034\260\212\221\022|8T\273\342I\366\202{h@\331]\021\277\203\003\020\306\f\303\251\037\332N\251\205\022\037d/\t\342,\003`\005m$\3660_\247+\220\001+h\343y\035\367\251\037\003N\325p\0078\235\207\363\352\207\303\\\f\"\370*\247"
+	.string	"\004+W\031\367\366\037n\006b\023Z\254\020\265\0076\354.\034\240,I\b\033\022"
+	.string	"_\241'3 \f\0337ax\254Qs\001\220\017\334\f2\002\322"
+	.ascii	"\031\203\202<\225\310Wg\034\231 \342\032\r\331!\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeAccInit.29.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"e\f"
+	.string	"\246\227UB \221\222\016\234\226`-\210\002-\242\2250\376\237\235&\013\016\304\253W5D\330\355\326\360\371\020\377\023d\343\302\350\243\302\006\351\032\021\t\212\004\003\264\024<\255\003\"rP\005H\034h\031\221F\366\2262\245B"
+	.string	"?"
+	.string	"E"
+	.string	"\002\246Cov\215w\242\335\204d<\304\320\354n\245$\276\375in\376a\336\021?\334\037\025\342\372DH.n\200|T^\310J\211x\230\347\207OJ\346\246\301\356:\343\007\304\ro\333\201m\006\366\037\004\"P\262dw\\j\310\376\333\335\265\202\354\277\374O\323\231\351w@h\241\261q@\306\356J)\307\306\200/Lx\330~\332Gq\227\355/\236\007\330\005\311\314\354v\b\274\200:t\367\220\351\220z*a\005\r\225\254\361G\372\234\351j\223\224\344c\352\200\016\312\331o\301\341cF\264\263\307`\240vW\001\013\223\016\001\321\3103\035^\023\214J\221\345\251\237\342*<\376\310\032N\362\361\320?\231\016\013\260\234\030\341\022\327e\251\257\021\214\304\242\020!\3236T\270.\253\352h\230\tG\233PY\340X%\325\245u\252\021\021g\0270\255\312\220eZ\345\321\355\337*\310\017F\013\016\022\212\246<"
+	.string	"i_X>Z\225\273\250\2064\243\032\262\201g\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.30.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\f\002\275\020"
+	.string	"\006\035iI\340\262(\035b\305\207\204,\003\370\020+\374\314\275\016\344>\227E\215\233@1\n:0\251\311\0019\200*\376\261\021[\367\234&\202\315;h\215D\222\243\030\232a\316\351\244%L\250\025\007N\206R\225$\300\277Y\356\261wJ\001N"
+	.string	"Q"
+	.string	"V"
+	.string	"\265\335-\371\301\350U\300\374\264?s\232\3615.\037\260\373zQ\333%Kv0z5y\003\333\353\350\004\266W\217\366\217\223\260\375\rO\210\233\240\335\355(\212\217\237\243\377\331\001\260b^>E\021v\327\223\025C\342\246\267\235\300\366\211=U\001\273k\372\262\267i\322q~\321m\376z\331O_\363\317"
+	.string	"%>\256\226\f\017\332\203\334\021CD\326\247\332Xa\373\376\214\323T\317q\311\214\253\245\262\271\030/U\236c\n@\270W[\305\346^'g\343\024\221`\343\003\002%\017c\274\254\305u\367\304NU&\304\005\245\266\027\034GK\201\006\376\215\353x\0378\317\002\267\327\317>c&^.\232\026\311$Q\277D\241\314\263\214"
+	.string	"\004}\361\313\327H\315\037\326K\247\274\026\036\200\355.\003\032,\034\374\230\313\366J\242/o\222\342\207E\213\262\304j\016\331$\314\2442\366G6>1)`\371\312?\374\373<\352\317\004\242x\030N\241\270\222\341\373\274.%\202\036P\342\205N\003\312K\351>1\325\231L\034n"
+	.string	"\305\256C\030\212\035G\256>\373\204\236\025\002ZQ\030Z\205\323N\222\321\022\241\002\350\247\315\266\360\236\323\210\004\026\033\022\024DDu\234g\207u6\241Zz\216\2352 \220\002\0319\273\003\261\270\360\031\"Rh<\302\224"
+	.ascii	"\324\001\221\370Z;\317\013f\t\260\365!\020c\231\013\325\232I"
+	.ascii	"\326eH\005\006\254\331\324.a\004\207!\334\222d\n\252\030\214"
+	.ascii	"\365h\204B\005U\214u\031\252F\t\210\320\204\037#\022b\230r#1"
+	.ascii	"\200QvE\342|\007s\f\306 \310#f\340\221\304qa\307\350\212\264"
+	.ascii	"5\005\360\345E\333\311"
+	.text
+	.section	.gnu.lto_fakeAccRead.31.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\031\003m\024"
+	.string	"\366\343\177J\300\322Q:P!"
+	.string	"1RD\311\355\007\254\"T\226\337\001\326h\022\033\246Hp\240\224\336\\+3\323my\313}Z\035\315\236\3479\252!\323&\261\205\206\340 (\005\t\223\373\244\244\270\203CY\030\300\3357\0032\310&r\247\024i"
+	.string	"e"
+	.string	"m"
+	.string	"\266\347\264\237\373N\315yhNR\253MG\243V\362\304\f\302S\223/\001O\303\007"
+	.ascii	"Om\033A\202\032\277N\336pD6\b\341\360\342\251VR\\\024\177\235"
+	.ascii	"~;_\276\315\351\n\031:\3372\365\220\224t\263\021\337\317\244"
+	.ascii	"6$\0025\213}%G:?\336\363\351av3\247HJ\255\325S6\003q\203\267"
+	.ascii	"\035\301v\213\275\017\002\245a\256c\021\270\325Z\025\300\210"
+	.ascii	"\301\340\343h\300\323\324\276\374\344\021\355p\350H\300f\317"
+	.ascii	"&o\346\236\260\377\325\265\331\340t\352<\177\350iJ\247?:\275"
+	.ascii	"t\372$\256\017O@\304\242ZqzC\252\021\345\251\260}\037\350\245"
+	.ascii	"L\316\222\214\3753 \347\351-\3563s\322\224\226\253\345j\255\250"
+	.ascii	"\031\033u\272v\215\215\n2&\373\300o\250\204\265\326\005\276\215"
+	.ascii	"\007\255\330,\252y\231\n<\235\353\200\206\253\355\360\276;o\344"
+	.ascii	"\206\243\331j\271&\330\354\315\032NG&\276\237\361?\207 \204\344"
+	.ascii	"\264\024[\233\247\220\325\214\326/\360\333\342\302Gl\n\261\275"
+	.ascii	"\372\214W\030\342N\277\357\371\244\3454\325vxFfj\375\322\345"
+	.ascii	"e^\346\002\261\265\361\313\307p\315\036\265\326\313\036\266\200"
+	.ascii	"b`\034U\353\021e\365\242\242\300\302j\315T\030G\225\350j\255"
+	.ascii	"4\270\264&\2101.*\030ql\271D\024\023\263.\254Zb\006\026\253%"
+	.ascii	"\242H\330\277\2726\203J%\312\335\367\2367H\352\225\273\375\356"
+	.ascii	"t;\330\246\353\024\330\336P\037\237oy$\375\350H;\346\035\004"
+	.ascii	"\236~Av\213\210N>\244c\027@\b \026s\205T\004\334,\3419V\302\231"
+	.ascii	"\024> \200\002\0319\244\007R\334\377N/\252\241\367\033\b\350"
+	.ascii	"\026\006\215\266hn\231\345i7\352\220\032w\350 \302\327\\8\306"
+	.ascii	">\244\315^\301\270\215\021\276_\262\230\022<?\"\323\352a\030"
+	.ascii	"\300&\211\f$d\n\250%hK8\202\2007\370\222!\316\016\273\326\013"
+	.ascii	"\350\260\230x\276\262\300.\347-\226\315\232\233\235l\035\344"
+	.ascii	"\253\213\013sp\t\037\243-\315pe9\023Z\274\263\207|\013\031k\021"
+	.ascii	"\202\361\2347\234\341\342\3248\361\204\242\226B\001"
+	.text
+	.section	.gnu.lto_fakeAccDetect.32.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\005\n"
+	.string	"fSG; \261\322\001\244vH\223\026\024"
+	.string	"\337!\tX\025\207\021Q\030F\343\027\370\330\345\277\354\267\030w6{\3610\350\322L\022"
+	.string	"$@"
+	.string	"\214G\343\002\204\250\b\3506Q\266\303\215\310N)4"
+	.string	"2"
+	.string	":"
+	.string	"\025t\202\357\325\266\025\026X6\177\322`\237\211p\334t\273'\350\315n\236\232\376U^p23\222\303\305Z\247"
+	.string	"\016\273k\372\212}\334\336m\037\330n\260o\020\273kOf\337\366\323/\345\241\273\031\345va\273\236\245\2512&\266o\233e\007\330\246\324~\312k\254\333V\037\330\225\325bv\317\004\217@\257>\037\372\036\036\357B\25280\272\234\222\351\364\033\371\200\262\363\262@\205jv]\177\331\251\263d\200v\227\301_\321P\t\320J^\375\325\367ZA^Zr\270\020\027\335\331g\213z$\366?\033\242\030z\026E\243)\224\200 K\025I\024C\020U\216\030\2452\002\244(\205'P,Q\240\b\301d\305X\202\027$Y\202>\367\237\365d\276\371M\350t\360\330\270\274\r\373\244\317\001\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.43.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\235\n"
+	.string	"&\223E; \005)\035'\027B\007\240\022\220F\264\262g\210"
+	.string	"\272g\347\333`p\007\\\f\364\261\255;\360\2771\360\353\032AR!\t!\230E\221\2029G\217y,\\\013\212\314a7\331;\2451"
+	.string	"2"
+	.string	"7"
+	.string	"\266S)\026\355\331G\230\225\230\235\304vv\267;\235/\027?\245&\372\207]`\305R}\016\260T.C\327\002(v\327\333\312Mo\373\301\266\205\375P\177\335\376L\312\207\031d\373\257\324G\024\247ba8\265\224\366i^#~D\275`\267u\203\263;:\234:b;\365\370\203\317\351v\203\317)\350\3642\001\264G62I\346t\331\336\244o\363a7<V2\304)\310f2\241pj\213\234\344W\006ud%S%\247\313S\273\266\263eO\t\200\240e\027%"
+	.string	"\317\272\320\234\230N\250a\255 G\372\302\r\216\003M\036X+\0204\177\"\220\344e\\\204\365\244\361}^W\252`\310\250bt\035#\217\243\373j\251\023-8\364"
+	.string	"kg\n\303\332\311k;[\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.44.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\355\n"
+	.string	"\246SIA \347(\035\220\b\"\002\231\355"
+	.string	"N\\$S\355\311;\211\2103\202\023\367\005QX\372\203w\303b[\027\326o\032\032{\"\310\r\023$! \217:\214\013\347"
+	.string	"\016\022\032,(\244\241lv\223\275S\n4"
+	.string	"4"
+	.string	":"
+	.string	"\004l\237f\f\332\f\036\002X\017\013\026\363j\260\273\334\247\3149x\0313\320\277\353\b)\025\3522AE\363\330\360\314\323\261\273\326j\356y\333\031\266A\354?\004SA\200\267n\277\300\311w\371c\373\255\323C\323\206\262\261\370t\214\366\r\374"
+	.string	"\370\320t\206\335\025,\301n\210\361\351\r\355\323\341!:\237\332\035:\237\237\317\007+W\376\030\020k\221.R\262lk\321G\220b_\3745\262\306\247\212\006\303A\361i\263\224\342SV\200\t\210\275HT\224,\313\354\331\312\225-'\026,\334\354\312<p\2608\001\226\250_\255\336&\242_\311Fi\267y\244\316\253\036\021\224v\322\024\344\211\272\221\220\257\226H(\355\270Q\365VBU\204;\tu&\034\255#\016T\341\017\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`\362\001}\t"
+	.string	"4\r\356\002"
+	.string	""
+	.string	""
+	.string	"\002\031\177*\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\037\177+\005\033,\300\204\001"
+	.string	""
+	.string	"\003\002\030\177-\005\023\024+\177.\271\220\202\202\200 \024\177/\0220\301"
+	.string	"\002,\1771\035\1772\0343\025\1774\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\0215\026\1776\002\027\1777\032\1778\036\1779 \177:\001\"\177;\377\037"
+	.string	""
+	.string	"\200\220\200\001!\177<%\177='\177>&\177?#\177@$\177A\003\001\023D\003\001\022\340\236\212\256\001\001\244\001\003\001\022\241\341\365\321\002\001\244\007\003\003\024$\003\005\025\006\026d\003\006\005\320\360\372\250\001\001\242\001\003\b\t\t\b\013\023D\003\013\022\344\001\003\r\023\r\007\003\r\027\204\n\003\016\030\020\023D\003\020\001"
+	.ascii	", \020\003\021*n-\031\031\370B\364\rB\222\333\020m\220\003+\230"
+	.ascii	"\302\212E\205\201{B\0343\306\307\301\251]\320\001]\320\001t^"
+	.ascii	"\220?\273TO\n\206\354\245\235\317\371s\353\237D\026\362\f\317"
+	.ascii	"\f=C\206\261\016\020\006O\013\206j\214\331\3223\214f\003P\371"
+	.ascii	"\323A\007\336\t"
+	.text
+	.section	.gnu.lto_.refs.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375 yU\002"
+	.string	"\222\207\021\023\2405\351\377\377\377\377"
+	.string	"\177\373ok\254 \322\366\226)\005\272\347\303\004S\330\322v\3661\216s3'\013\214\323"
+	.string	"{\3204\212\022\245\245\224J/\032D\241\226j\247.\306\211\207\275Lv\332l1\035\246e>\352 "
+	.text
+	.section	.gnu.lto_.decls.c3af2d077162e0cd,"e",@progbits
+	.string	"(\265/\375`L9\235\364"
+	.ascii	"\nraRV \fI;\035W\t\022}\277\227\004\304\233\357\211k\3617|\232"
+	.ascii	"\362\244\343\212\357N\027\374\273]\025\375\3034\037!\002\016"
+	.ascii	"\300G\0205\301\215\211z,}\202\307n\027 \0263:\271\225\202\263"
+	.ascii	"\374\355\022\270\200\242\312\254\2630\313GvxB\206e\361\272d\333"
+	.ascii	"[\312$S\233\004\006\005$\0057pK\025\002\017\f\250\327\203\375"
+	.ascii	"\327}~\353\037\276}\245\267\362\300\307\231\001\236!h\373]\276"
+	.ascii	"\244\002\036\240\335l\362\020$\332W#\232a\303\206L\026\025\267"
+	.ascii	"\244\263\247]\332/\026\037\031n]\224\004R0\022$\013\372V\317"
+	.ascii	"\364=*\340\001\272@\0224\250\224\273\315\270\354\355TF\305E\245"
+	.ascii	"\365S@ln]\331\2105.\350\006o\365)\270\333L\017\315\356\231\302"
+	.ascii	"\202\276\325\377\3100\323l\267S\345\021\265g\025\335{k=\327\013"
+	.ascii	"\371\254\277z\254\337\372!\367\371V_\345\030\332\r\030R2\"\321"
+	.ascii	"@\013\331sT{\246\242=C\321\236\355\264\347$\332\3532\233\366"
+	.ascii	"l\246=\177\361\300\360\314)M\210>{\236\322\356\376:~\307}~\324"
+	.ascii	";\371\343\370%\307\320\356\215\266A\323C\3150+\354\r%\205\352"
+	.ascii	"r\271\177\210\372\034\017u\353\222\332mt\221\372\350\222`\330"
+	.ascii	"\260\001\247\361Y!\242f"
+	.string	"\307R\240\236`\006\273\224\006\237\336i\306\013\210\020\224\233v\234\246\035\027\321w\337\013*M\253\375o\270?\322\317\270n'\244f.\344~>\177\215\017\3766ZD\t\031}\306 K;\266\322o\203yh\r\267F}#-\205w\003I\214\"\347]\331\326#\362wz\237\272\307|\313\202\207^\350\205\026$6 Q\035\364/\376i\345\002\315\005\b\016\356W\314\256 &\313\022&1>\373\225\007\232y\342\245\326\366\371\177f\206\232l\247\377y\037\227?=\301\255)\332_O{\2705\352\357g\336'\006\337|\037\202fb\030\250x\313\226\213\201\352\237D\373\035t\277\177\027\313\025\274L{\367\b\215\220\200\035\371|\263\334\300\373\314p\265x\332lw{\253D\361\024\255\351\022\354\275e\313\315\240\336\"\037\374\002\016\361\332\233\217\0263\355\341^P\325[\243Z\3010<R*\362V\3327\320\273|\030\314\251\317v"
+	.string	"\201\356\335R\271~\367y\253\334(\236\333\3557\314\375\303\255r\245\\(\006s\356\236\035G\034z\236D\202\321\275\333\r\0306\310\234E\003\221\324\334w\247\f\203\244~|\354\365\321i\277g\032\312\335{#\"=\274\240\\i\277P5\352ur\357\376\262\270\220\241\257\335mr\237\367\316\375\322\3350\317aL{l\357V\0067\221\346\324>\373\265Q\207\327F\365+\244\363m\316-\301e-\033\320g9lge\003\356\263\263\320\317\253\344\306\265\033\203\2525\205\307\371\331\217\332\215\332\327@\240o\333E\342\327\355\036\331\327-\004\223\333P\313\336\315\341\275\005\270\267"
+	.string	"Y\353\t\310\231\232\235\003\332+\240\375\256\271\337\"\227\354\252\235\260w\273\367\246\240\202\022\347\322\347{v\215\334\247\0057\r3\303\2062\203Y\203\201\237\375\003="
+	.ascii	"\247\315\201\017\265_\013\324\273\345Z\240\202\370\340\327\254"
+	.ascii	"Fu&\265{\250b!i\002\374\354Z\377\255Qi\356\005\365\231\356\005"
+	.ascii	"\365\202\272[\243j\270\027T\367\013\346~\267.\327\375\302@BL"
+	.ascii	"\273l\357\266\202p\353\355\251\354\363\375\372\353u[\277_\267"
+	.ascii	"\313Ap\3401=\233k\357\366~\345\275\233\367\026`\346\336\002\244"
+	.ascii	"nRM15\267\367\202\252o\215\252\001>\367\257"
+	.string	"\332sq\317q\356\267\004wG\002\305\375\222\320s\277\0378rO1p\277! ~]\020\020\361\274\306=U\336\335\022y\356?\374&\356\017c\347\376j\235\373\353\027\025\334\323\013\236\335s\225_\234\227\242c\322\301\005\367l\344\032\237m\316\3351\360\241{Z\301\375\315 \360K\344\034\303\035\301-pO]\334\177\351\323\307\241$\316\375\341|\002\367,\350\376)Z$\356\377\356\367\0037\301\375\333\234\306=\273\271\377\021\367?s\1770\367\267r\377)\367wr\377%\367?r\377\"\367\177\341\376@\356\337\343\376\333\375K\340\376(\270\177\322\375\227\356\177t\177\021\270\177\216\373\263\356Ot\377\325\375;\340~c\334\257\005w\307\200\373\235\342~\255\270_@\367'\341\376\006p\277M\367\027\200\273\013\272\273\227\373]\335\357\tw\327\342\376\032p\177\022\334_\002\356?\302\375\242\271\277\b\367\217\200\373\325s\377\r\356\257"
+	.string	"\367\267q\177\f\334?\001\356\217"
+	.string	"\367\277\300\375\017\340\376\032\334\237"
+	.string	"\356?"
+	.ascii	"\367\267\300\375+p\277)\334\235\004\367k\302\375\022\335\357"
+	.ascii	"\t\356\336\272\373\007\356.\347\3563[\266l\331\342\236[w\227"
+	.ascii	"\022\3343\310 O\016\310\242\372\213\016f\030\271(\317\310H\331"
+	.ascii	"\006\336\222_\344\030\231F\226\221\223\262O>\312C\271'\357L\224"
+	.ascii	"\231\031(\267\3105\2623\033\345f\026\312?\331E\346\271\317\034"
+	.ascii	"t\343\034\007b-~\017\370\201_k\177\321h\214\207"
+	.string	"\201\263\300\2703\303\316\"\214\204\301\234\024x\212\373\026\370J\006Y?u\231`\036\233\257m7#\007\341\244?\303`\316\020\356\222\f\346 ,t\361\214\360\314As\320\323\327}\202\343p^\320\035\0324\007a\242;\210\3335\n<)\201\342\241\034t\363\356\225[W\266\265\337\357\243\203T/%\007a\301\253\026\202\255\375\213n\2704\304\250|9 \273\f\234\256\320&\335\032\025\003\n\351k\002\213b\301=\240P\250\376\034ca\362\031\311\363\303V\252\270\b\221a\026\305\207_\025\227'\\i\177T\034W\301Wp\350\220\342\273_I2\324>\343)\327*\320o\255\b\367a)\302\036\3000&8\212c)w\253\357\016\313g\274\207\3714\025\021\263\005\337U\222Dn\260\006\024\027*xtQP\256`\216 i[\237]\206G\317\341\"=Y\237\361\356\023?\301J0l\200\237`9\354d\306\214-\217*f\273"
+	.ascii	"d\313N\356.\f\030P\240\317\270\211\313\222\0302\342\220\324\335"
+	.ascii	"'\266\363>\233\246*#L\367;\360\246d\301t\216\2318w\021\032\237"
+	.ascii	"\347\204}EM\302\302\226`%\376MM'E_\332c\244\264\307Di8\225i\306"
+	.ascii	"\226\320\r\355\033D\341\035=biTNxG\210\2541l\326t\004\247a5\314"
+	.ascii	"\206\335\360\033^\303H\356\023\267\3413\277p\370\006n\303F\360"
+	.ascii	"\263\210\030\035\024\267\341\246\255 ZZ\3216\354\003\2131+\270"
+	.ascii	"b\302K8\326\3320\016\274\344\301\026\233L\025(h\225\205\214\321"
+	.ascii	"\\\236\370)\225}\366\230#\3551?\332a\002\315\034\227\2050EI\355"
+	.ascii	"s\221\027\263\241/\260)\032\223a\"0{/v\337\235v\030:\335\342"
+	.ascii	"0\fv\237X\314\203\340\252-,\206\205`\257[\227D\263\367\023\026"
+	.ascii	"\025\026\303?0\325\235\027t\303\206\r8\206V\024\240\316\276\201"
+	.ascii	"\027\036r\277.\020BEK\353\013s\341\256\373\304^x\3131\017\334"
+	.ascii	"\243\007{a\255\347\301\355\232\016\022\223\202b/|\205\263l\204"
+	.ascii	"\330\275\223\033Q\242\350\3540o\332a\326\264\337\247K\301X\336"
+	.ascii	"\227},A\352\372\3540F\264\303\214i\207\301\322\016c\245\253f"
+	.ascii	"\2304\233\347N\213j\357\326\352>q\025N\001\313 r\304)g\207\361"
+	.ascii	"\241\035f\207\006r\237\230\nO9\b\016\2700\025\226\272jUB\\\261"
+	.ascii	"ii])|Bpl\321\376"
+	.ascii	"\202E\373K\237\366\027'\372bx\231\323XG\322\320[\373\324\030"
+	.ascii	"\n?\271\224\f\2560\253\260\242{\343\034\367\211\241\3120\274"
+	.ascii	"\236\022W\223\234\375e\207\366\027&\355/4\264\277\034iw\274t"
+	.ascii	"\325\346\204x>\373\313\220\366\027\027:\335/<\332]\262\350\353"
+	.ascii	"\254\242/\323\255Q1\022\226\021\263\246\305\007\35136\302G\367"
+	.ascii	"\351n8\006\0178&\217=\315B\350n\252\273\300\351K\205\246\335"
+	.ascii	"\245\325\267u\031\342\002\277\300mZ\\\223(\354\342\006\366\201"
+	.ascii	"y\3023\243\202\201[\2704u\335\f\314\217\332\223\021+\332\365"
+	.ascii	"\362\264k$\372\256E\365\230\376,\031i.\307\024\227v=\245]\307"
+	.ascii	"\370\277\272\251\267\264\026\177E\030\325\267N\230\247]\b\247"
+	.ascii	"\177C\205h\372\235\267Fu\377(\3177t\002\270g\366\031\312\357"
+	.ascii	"\335\347\363\275^\346{\274\317\343z>\337;\371\263\231\236v3U"
+	.ascii	"(u\201Xmt7\356\324\354\302%\233\177\342\322\323\356\261\230&"
+	.ascii	"R\232\035\222v!\221va\220\036D*%\2116\311p\305\266\244\343s]"
+	.ascii	"\316`\217\031\237\351R%!L\374>\273\260\251\375\222\375\333\215"
+	.ascii	"\336\301]\024\242\r\216\t\323\303\370\243'\2336\262\262\273\326"
+	.ascii	"d\206p\273y\367\n\006\213\212\3612\\\255\005X\006mT\177\321\350"
+	.ascii	"\333Mr\347\2344\270Q]\270\267[w\361\232F\036\334\234k/\367l\357"
+	.ascii	"\366I~\356\341^\3113\371#\337\366K>\356\221\334\347\277\275\217"
+	.ascii	"\377\330\023y\273_\267.i3\251\\\340\326\376E\337>\351\305<\360"
+	.ascii	"qZ \007\r\350\333\267\370!\017|\234.0\210(\335'ow\313\363\334"
+	.ascii	"\272\250\335dz\320V\367\027\215r\360o\227\355\272\341\226JHF"
+	.ascii	"D\352\212\275=\331\253\035]\340\006\375\213F7\310D\267v\216\001"
+	.ascii	"\344\264k\325\342\313\352\263\253e\032\355>\377\371E<?\277\354"
+	.ascii	"\215\334\272\262\275\2132\310b\362\323\212n\2706\344x\350\262"
+	.ascii	"\021\367;v\211\374\231\313\032\024#!\237\377\354\247\\\355\237"
+	.ascii	"\216\n\216\350\347\030\325\207vu\206v\025H\353\013tk\324\017"
+	.ascii	"\3130\204\332\321\304\373\354iT\323\370VI\237\323\034i\224?U"
+	.ascii	"\371\354\245Q\351\016/26\257\354\024\363d\356k\351s\252\343\365"
+	.ascii	"\254H)B\206\237*"
+	.string	"\023\"-Y\310\232<ujJ\227n\330&\022\316\350\321\343\017k(%\007E\251J\2472<\235!#]r\334\263q\334\020\006\321\352\361\027\335@I6\177e\353\005\231\rO\227<\305\001\202\003w\033\306\201\005\331\270\221*\271\273\274T\345\030\273:\322\256A\030RQQZc\306\tX\024\245FJc\210#\007\214\017K\305\376\250\334}N\362\f2O\250\020\341C\"zj\261\366\331+\004i\247\371K\217\322\243L7\201_\220\241Q3\311\231^*\224\n\245Erl:\207\026\033.R\247\247Ej\220R\225\265\317)Q\226\231B$c\356s\n#\035\232{\361\"\343\225\240\342\307\205\005d\256/+\315\307'\005\232\340\312.?\233\320\314~<\005\222\201B\205\245*\347\020V1\023\302\222\2256\323f\332#$\365A\026eF\312\343i\317\f\227\033\0240ou\353\021\355\241\335\323\235\356;\370Al48"
+	.string	"\001\363 \206 I6\2376xUC\320\363 ZS\311\325\347\254\345\316\301\020\341=\001\3629\007^A<&cN\351s\316r\005\301\350hl]A*+?\230FX\260\274\235\352t\361\3013\373\221Z:\362\331i~\240\331\n4_\271B\305\251d\277\273\235{\307\005\251\342\331/3\247\332\336\206\201\332\207z}\317\334\227\2250\220\bXL\240\333\231d\001\232k0\t\331\222\274\314\227\227\243\250{\337\226\211\310\351W<GI\233XM\235}\326\323\313{\232)\224\262\203\342y\357%i\210\254KM\373p\353\356.\343\371i\330r\342\031\217"
+	.ascii	"hHL\356\334Q[#\306\224\3353\333\335A\233\275\2154\3041\367\002"
+	.ascii	"|\350$'\227\351t\273\211\326&?.\254\235\344d\342\231\356\203"
+	.ascii	"\216\266\225<\02764h%\317\345%W\017\n\030E\027E\016o\210\244"
+	.ascii	"=#\311n\236\337\334\375-\307]\017m\314\244\0306\3569\211\347"
+	.ascii	"\270\233F\304\311\317\347\fw\3472\240\024+\271A\355\356~\325"
+	.ascii	"\275\215\322v;yb\374\246\367\332\270\313\\|\r\200\335\375\001"
+	.ascii	"+\332\315\323g\305\212\256Rk\332\320\260m\366f:\201\306\234\230"
+	.ascii	"\025\200\306\232\033\210H]Q\005\240v7Q\260\307\2406P\313\304"
+	.ascii	"\314L\314\337\355\356q*\332=L\314\035\240v;w\313\304\244\331"
+	.ascii	"=E4@m\223\t4\346Tt\201\306\230\212*\354\236\315\334=\315&\335"
+	.ascii	"\303T\004\264\204\251\210\006h\254Y\004\324\343Ttw\313\264\257"
+	.ascii	"][\353\304\364\331cM\231\275\267PK\305\214\331\273\351\334\314"
+	.ascii	"&?\264\235\240C\033\307\276uY-\324\306\260\367f\226\351=1\271"
+	.ascii	"\264<\273\016\310\212\t\307go\275=\024\202y\231?\233\207y\367"
+	.ascii	"\366i\235{\3630\235\220\304t\235\3748\267\314\356i\n\361<1\305"
+	.ascii	"\370\3600\375l\253\246[\0044\366\304\364\201\215l\214j\363\264"
+	.ascii	"\314K\265\365\234\234z\214\331\3562?\2311\037IB\237[\".7\030"
+	.ascii	"\237=\037q\317b\231\315\304\323\f\350\363\305\272\027\324\254"
+	.ascii	"\366\301\363\232L\324\217!j\237\001\220\366T\237oP9>g\264v\354"
+	.ascii	"\366)\005\272\305\351.#\320lv\237\371l\354\354i\344\262\031f"
+	.ascii	"\273\213T\027Q1g8~~\324\354\271\314\355\204\275\307\\\322\242"
+	.ascii	"z@"
+	.string	"?g\262\017\236\2138\300\007\224\326g\234\211d\260\023(\310\202\202F\334>g\261\017\236\3074\323\220\253\247\317\024\344\260\f\266\025C\307\217\317\355\320\205-P\210\214\377\341\367\231\177\344/\021\332\315|\221\022\304\217+\272\235\316\005x\311\3148\363\023\374\3543OZ+s\345\255\234u\237\271+Wy\226\312S\236\251\360s\tU\020\374\224\203~\350\312V\031\353\326\225e$s\320\334\225S\300\317\"\241\021\246@,\030\300\256\031~/\3313V\006\222\257\376\311\316k!\324Z\313\242\345s\026\362\301\363\220A\300\240\262\317\303\031\033\332g\234\332g\202\264\317\370h\227\021\3244uB2\320\354\343\272M`\210\r\276\036\037\364k|M\302x|\221\020\b\2227\267\250\276\231&Q\264\332v`\277\254\245\354NLG4\275Ad7\224#\017fI\230\2267\250\374\204\005\335\250,e\247\366.\007\217\244;\355\236\233ld"
+	.string	"\237\360`1\375\231\327\020\r\240\245\2673\352+r\303\241\204\302\321\221\325+\345\033B\214\244\316>\313\r\247\350)A}\366\033\366V\036\313\027\264\306\237A\005\177\313U+\362\024\210\231\315\373\365\004\b\255\362C\304\205_\016z\262\307@\016 (\336Y\374\264|\265\\=\370\207\016\232\203\260\022N\262\215.\310\372)\356\017}*lL\177\321(\246a\303\3250\230\023"
+	.ascii	">wiXr\020\206q\005\033@\365\027\305\372>\2520 \034t\307\004\332"
+	.ascii	"\243\207\241\001)\212:\0278n \346\270\201\025\354\b\231\024E"
+	.ascii	"\235\013\254`S\260\254\222\250\223s\"\305I.K8Ads\362z4*s\214"
+	.ascii	"K\023\353:\223T.wr\214\005\307\341@AN\316\362x\3249\nQ\320A\342"
+	.ascii	"(u\216\302\343r\235@\204\214\222-q\303.\331\245\006&\230\001"
+	.ascii	"a\204\b%[b\005\373\002S,\212\260\260\202\035\001\343\201\203"
+	.ascii	"\022I\334"
+	.ascii	"\341PsCdaL\270!\262\024x\321\210d\217,\n\355!:\320\240\003\017"
+	.ascii	"X\b\225+R\251$\326\370\006e2)L\2567D\026'\347\030\211\312\234"
+	.ascii	"<.\221Hv\205\216Fq4\306("
+	.string	"Q\260$.\334\020Y\nd8\206 \3438\034\220l\316\315\221(B\215\362x\342\223k\221%\001B\005\243\222\005\233\225(\220\"R\024\211&rr\210E\230\244\222\005\013\243\\\331\242q\005;\"\2714\001\223\\\232\300\311\325\270S\342\206ew\222\251r\315\300\b\371h,\341\230,\252,\212\233\t\2408\032o\210l\016\214q'\211\223+\b FP\262`u\021\204\021/MdH\256$(Y\2602\311$\213\274\271!\n\331\025\304\034\275\\\223K\023.,L8\301\216`wF`\302*\202\204\021C\307\341p\001\023F(\321A\311\242@\022\225\032\224IV\231Y\220\020A\302\b6\271T\225\351\211\345\007,\220\351\n\366\006\2639\304b2\325A\262\036\320B\345\nb\203\344R\247\004\013/,r\251$\"\331\035\025\254\022\206]eH \202\005\330u\204\022J\2607:$\300\310\234\330\311\2119\261\223\263\222"
+	.string	"'\005\210\rV\034\013\311\035\035\344\b${c\\a\034*W\024D\023t\214B\024D\023\214J\026\023P\036GX\356\250\220\321A\226\200\202N\316\t$\273\"\003\311\f\354:\303\"\211(\334 \211\"\304\320\220@\004VI$Q,\022\207(F8\016\007\024G#r\355\220$@resvT\020K\304(W\235\334"
+	.ascii	"\253\302\250T\2137D\254t\034\016\bP\342(\211*:\034uT\250\320"
+	.ascii	")\006@\305M\256\353\316\211\032\026F\244\222H\002Q\251\203\234"
+	.ascii	"Q\016W\241\343pP\026\227He\022Dre\301*\227**\034\227:\305u\025"
+	.ascii	"\"\331#\n:\353*L\"\331\344\362\270\256\372\346hL\261\256j\362"
+	.ascii	"h\334I\256\2530\207]W\027\345J\3438\034\222\354\316\b\224\032"
+	.ascii	"\334\260H\"NR\203\016I\245\321D\207\345\021\205"
+	.string	"\006,\226Gc\216\006!:X;\360\200E\007\366f\231S<\032; \223\313\016\fP\262`\2179\304#\222U\036\215+\216rg])X\301\"w\326UU&\2159\353\252\256\253\312\222\300\230\\W5EQ''\027Y\344\3722\3021\004\245\361hT\221\312\022\212\307e\b\305\242\210\t\216!\334\020Y\344RS\340\203\252\\;\370\240<\032\205(\020I\2000B\204\252t\034\016\313\035\025\256\263\303\";(ut\220\035`\330\225\204\007\016<t\260\334QQ\263\314\321I\262\310\227\344:\001[b\271\243\002FU\346,\223,\211\243\216QYd\225\354\210\345\216\n\013\354J\\\221:\311#\233\2349\2420\346\210(\026\211z\0047D\226\004QI\274qQ&\327\025\354\b\227\214L\236XqP\030q\326b\221\030\203$\342\0243{\243\003\302Q\307\2304\256`\2211\312\325\003\345\321\270\024\372\207\017 h\330"
+	.ascii	"\006(\240\213\034\330\024\304\023\253\016r\004(\212Eb\207$\222"
+	.ascii	"]aD\336t8\032\211*:\024\221\311\016\034\024\200dsr\214'\324\034"
+	.ascii	"\035\235\017\326\224/\265\222io\274\035\331\313t\332\n\220\301"
+	.ascii	"&(\331/\246/\006\330\226\274\274\354gdL\343\341e?-\252,'W\322"
+	.ascii	"\273\034\227\332\365\220\203K\233d\274\217\0016\204Jj\227\367"
+	.ascii	"x$\005\331u\371\312\303\217(5\350\322\251\006\354\025\341a"
+	.string	"\222\036Q\277\2324\256\346\362WL\\\234sj\311\031\222%Z\200rKB/\342\342\362\236\013so&\315\346\301\223B\345\003\016.\357]\247so\017r\026\226\336r\0243\032QOn`2\242 a\222\"\021\323\021\330\305\363\031\r-=\202Ao.%|P\021;\002\325<=\222\262\365\310\245\255\261\255\r\257\274\331\370\021\263\303\356+(-}R\271\362K{\272\3545\030Im@\230\272\214\304\304\322\263+\345\f\304\212\306\274\030\273\341c\346\351\231\227\025\"E>\247e\351\217;\245W%\3649-\362y/vP\326z\310T+lXL\310\210\274\320\220\321\342\371Y-\035\003\243\211\331\263\362\264 \244\275\302\226!\236f\rI\301\216\224\f\225\350@\333\342\345)\230\247\355\205c\3028\373J\273\322\032\303\033qZlp\311l\341\240\222\302\2655\323\264\353\312\322\312h\255\360K)hk\245W\236b\031\375"
+	.string	"\311\242\363\250<Hj\225\203\366\346\361\320\362\350\001\340H4,\005O\255<\255\222\300`\230\226\222\331\334\225\256\0346\274\n\fz\222D{\2056(w\250tJ}\266I69\f\256l\247R\236N\341\247\026Y\222\267\317)\217\364\2073\257J/\375\221\372H\341\350\351\210\227\215\260*\260\317i\217\\\025\344\027\204\366\250S\003\033A*\336\222J1fj\244$I\222\306\243\024@P`X.\230\316VY\037\023"
+	.ascii	"\224H\244\231\034(\031S$2\222$Iak;\276\305\274\341b\016\355\325"
+	.ascii	"/a\013[3\\\320\332\377q\021\205\210l\3345u\371\205\034\210\273"
+	.ascii	"\246\037\263\263\331B\325\001\331\345s;F\2372%\331k\312\323\261"
+	.ascii	"\240\3229l\001_\b\377\0033\365\350\024\363W\356\227\006G\017"
+	.ascii	"]\227\360\310}_\241\241m\260dt\302\356\373\241\323\333\270\002"
+	.ascii	"\245&\221\322#\303\266\022Y\350K\376\177\353\260\267\317\337"
+	.ascii	"\002\2168"
+	.string	"\001\312\007k\220\217J\376\016\0379\216\351\306I\343l\t\n\3125\215K\376\253n\337h\254S\270\274\300\311\247&\307=\345\325\t\246o\347\022\336\023j\313\361\275ef\370\334\334\024\335q\024\223E\003\013H\352\360+9\313\346K\377\200\b\3376\204\234\214\035d\226\345]!\t`\341\351M\235\233o2\234\366Q\354N\233|\027\354\013B\013\272G&n\177\323\237us\fr\2607ZK\331Sm\237h_\r\0320\304K\266\032h6i\250\\\266\352\241\240\202c\002\304\210\022\362{\2374h^\317d\013\013.<\324]HC\024\305\260\243\361&<\242\327\007*\274\023\260xs.\236o{\313&\372\252\032\363\225)E\223\026\33237\3551_U\236`\271\246\005\204\f-V-u(:\244\022\265\275N9\354\003\360o&\232\032x\317\214\025\363\234\177\201\264V\242\265~\254\241\272\233\363.\311\311\223\027*\036\364"
+	.string	"9\367H\234a<\376]`\036ld\226\345\244\327k>\013iW\341\342\365\266k\"] \201\027\377\373\304\251\230\323\344\267t\374w~c\r\277\246Ay;\362A\370\335\370\211{$n '\354\311\023\2208\217\230\377{\363!\244 \033L\304\305\036h\300\355\003\272+O\177\243p\232\357|\354\210\376\345\310+\024\370\001@Wr\212\370\200{\301\221\220\354W\023"
+	.ascii	"\225\372\031V7q\352\024\214@81\002\204\202\255Ou\301\205\307"
+	.ascii	"\354@\361Z\333Hf\204&V\356\365eR\201`\243g\211\212\374$wO\254"
+	.ascii	"A\303w_\3235\212\241+N\257\337\260\235\231\335\372H=!\227\230"
+	.ascii	"\367\342\277\271B\245Q/\310tb\227\372.nl\345}8\353J\361\375\336"
+	.ascii	"r&\025\265\341h\03331_\243\262\032\220\327h\332?a\373\312\214"
+	.ascii	"\255\355B$\260\224\232\004\255'h\254\350'%\203U\027~t0= O\336"
+	.ascii	"\034\300\306\363i\016|\343\277\360\0327@\375\315\025\235j\332"
+	.ascii	"\3145\321\373\315\262\033f/\202\315\002\205\240\250\345\001\330"
+	.ascii	"id)6Z"
+	.string	"\203\\\370\240hP\3410\375\027c\2337\260F\370V\274\246j\fr\2638)\026\301\224\365\2107\257\304\023%\234\2053\305hP8\223\253\021\220)i\203\205\300\007y\261\314\255\006\254\334\305'\223&H\356n\270\363\374\301\251\261\242\004\215m\236\252?)k\2527\333\306V\212W\372\307\033\361\363\203A\022\331r)\230\350j\220]\261(p\340\353{\034}y\332(\001\317\337CD:\202r}\307+\201\345\3046\362\212\256\021 XH\330\020Xrm4\276%\343%4\271\327\007\376\307\323?\351\2635'\244\3627qZ\353\251\262m\t\306\217\024\354~\004\325%\013%g\222\265\202\362\304\316\333\306\347\0075uZp+\375\320\332Xd$\362\215\026\317\362\266\322]1\n/\372l\007\312\250\023\345[v\035\177\355\322\017\275\242\313\265\020\bk\307\300\032\367.3\024R\375i\316\021h6\265\r0\366"
+	.string	"u\274\3647N\262\272\211\365\375\214H\354"
+	.string	">T\004\361n\303\202\327h\312\350p\\+\314Yt\203\356=\313\254\337\267\212\026\322N\224\254\202}\247\345LY\345\337\225\247@\tO\215\301\026y_;G\266o3&o\233{f3\252_\227\214\205\246\027\340\365\023N\007\210\3472\030\244\351\321\340@/\bc\344\312\22143\227\275P\020\242pM\201\324\026#\207\"\310v\201\270\273t\305\nSS\tZ\n\375\356b\343\274\304e\340D|\342{\223\350\3643\035\324\226\231H\005\035\271\017@\310\235\220Z|\365\350W\035\002X\351\277\026\303\245\364\301uv\"\001@\033ze\244\206\370\331y\325\215\237\271\350\271\374\202\374\200/L\373n\213\241\317\372d\273\305\244o\360r\364\304vw\310\227\007\277\240"
+	.string	",j\215E\326\250\335\363\2135xw\004\317F\246]\007"
+	.string	"~\377\305\321\362\325\202\017\r\327\346_\337\002l\275e^\334p\366\250M\324Ox\237:\256\3257\211\362\r\236\b5\370\n\f\240\306\240T|\323f\026>\303k\261\254<\001\"'\314\365\262\216+\340\330x\367\376^\370\276"
+	.ascii	"\t\266\210^B+*x\332\214\033\205\232Q\035$\001m\302Q\b\2432u\210"
+	.ascii	"4dD\324\306\370\206\f\234\273\310\345"
+	.string	"\357\237\023\263m\006\342\020x\244\365\032B\240g\017-\331\243\032U\240r\371e\277U\373\304X\3502E\217\242\252\232}\020?\027\321\224U\256eAC\361\211B\346%\364i\375x\322?\272)\222\336\034%\243\275\221\354\330\013\2633\234_\360\202P\224\351B\306\r\030\333E6\344+<\030@2\351%\315\351\001\244\002W1F\205\247(K\304M\364Y9\257\214\037 \237\035c\205ngWQ\242\275$$#H6\202K\241\320\275\333\256\3720\353\033u\325\245-q\350\357\374_\322\220\210\342\233\376e\216G\306\314\247\261\316I\376\254\345\237\246r\030\222P\361-;\355\244\260\202\3632\252|\372\254O\035O\007$T<Sc\237v\217\267\231\324mm\213)%Pl\337\211\320\004_\215M\2035\233t\2530$\331v\241\033\222\303\373\314\370\204\r\327e\313\013\333=\213@\242\246\320\372\213\025\025\242\345+\274\365\017"
+	.string	"\033\\(\026\335.Qy\272J\240\311}\347,U?}\022\325\250\277r\367'\214\317\376\002U\323\207\315\231\355\016\204\337)\300i\256\261[\370$\366\302\221\200p\004\325\263\374\363\025\325*\206\006ZC\344\210\217\320~\223\017\343\3422\004\232\2067\033\263\006\256Q&\310\274Z\200I\366'\312\233\007\f L\f\030\360\026\214B`\316\215\375+\221\226\234\363\025\241\206!\344\025H\227:@\215\017\2558\031\356:\362\272\220\230\305<\032\257X\352%\3718<P\230TDt3\260\023\265\260\327\024\322\200G\n\026\261\250%\345\371rK\241u9\372\207`\242\374"
+	.string	"b\257\2210\\\205\316M;\255\356\301\253\256\016Z1^fd\241\310\"5\237\f0\230\205f\346\275\337\033\272\213P\227\177F\t\335<\320\315P\351x\211\260\301)\270\273\324\255\222\313\236?\331P\351Q\016\277\034\"\274\336>:\035\273\322y\366S\2176l8\317\327B\311"
+	.ascii	"\327\367\244\221\370\213\ru\376@/B`\204\022\037$1Gc\001)\006"
+	.ascii	"}QG\"\211\177S\221\361\rC\346y\364\004\360\244\b\177q\210\323"
+	.ascii	"P\362vp\\\266\276Te`IZ\356\253J\256\323\013!\224?\217\252\364"
+	.ascii	"IK\006\333\243pC*\224\376F7\300\016E\375\b\256p\246.&\323\024"
+	.ascii	"k'3@C\204`=\027S58\233F\372\f{v\242\317I2\244\r.\b\330\260J\""
+	.ascii	"\371\244%\356J3\374\204\375|\0353\266\033\341\021\375\001\315"
+	.ascii	"\357!z\364\341Y{\334\257%u\026\007\266\332\346\373\237\215\024"
+	.ascii	"n\020\024\372\210J\270\024$\327\260yBTd\003\243s\236\246\314"
+	.ascii	"\376\265\370#\013\247]=[Y\342\210\004\376\361\372\307\340\213"
+	.ascii	"\315\237\233\036\037\232>\307\262\030\002\034oT$\322>\267\243"
+	.ascii	"\030w4\261\0324c\372H\r\374\357K\034>1\201\020\245\223\374\321"
+	.ascii	"\032^\267\304\250q\r[&\277\320\373\367\013?\b6Y\337+E\264!W\244"
+	.ascii	"\013\341\355\316r\307QU\262\023\025\313HM,\260\263k\324\301\235"
+	.ascii	"\037\341\335Z\306\221f\303.\016)Ja\007\274\307\371\300\222z\276"
+	.ascii	"#9Yz\303s\013\306\030\245\n\004\325\313\370\"\327\3256\356\314"
+	.ascii	"\"\246\360\260[R\305r\275\305\203\2564\267z\362\247\007\203\224"
+	.ascii	"\257B\245\236\f4\016\274Z\016M\351\346\3320\347P\250\305*Nj\226"
+	.ascii	"\351\341z\244\330\021\264\315G\246bB)1m\303\214\305>'\264\275"
+	.ascii	"\240>\340p\316J\303*\001x\f\034\313\235 \002\235\302\343\001"
+	.ascii	"\265\267?\234\320\305\303r\3765\201lx\344e.KT4a\242\033\332-"
+	.ascii	"\376`\267\362lJ\211\316\266I\307\270\022\376m\277\230/\304\306"
+	.ascii	"ekX\323[A\272\314N<\207\333\347E\bD\035Y\237\241{\360\021z\372"
+	.ascii	"\376\330\2477\374Bx\037p\371\013nJ\236\255\003W\001<M9Z\340^"
+	.ascii	"\200\313\244O%f\373\340\027\370\227\026\310\237\262\207\313\266"
+	.ascii	"[-\227\365\203m\243OB_\306;!\177\215\217n\260\231\371'\272\377"
+	.ascii	"T8\342{\221p\351p\324\327\2517l\033!\270\206\356!=R\361\b\350"
+	.ascii	"L\342\032\211G\300x\017\375\217\256\276 s(qD9\203\365_2\266\275"
+	.ascii	"G\215\337v\305\266\254W\232'\251\036_\337\347|\262\334\007\346"
+	.ascii	"\247\206\241\341nxd\341\266\030n\355P~o\317t\223n\344C\305\007"
+	.ascii	"\246\007vW\247\362@\277\037\334\261\323\207\3128;\232@\353\270"
+	.ascii	"\3446\037'\235\371\326~\270\322\243n\332\332\261r\270\350\334"
+	.ascii	"P\375<\r\372\270\200\313#\310f\272\356\335\013\f\026%O\366?\276"
+	.ascii	"E\222>~\005yjr\320\373\333cT\256\356\264\256"
+	.text
+	.section	.gnu.lto_.symtab.c3af2d077162e0cd,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"fakeGyroSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"fakeGyroSampleQueued"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"gyroRingRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"gyroRingPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"gyroRingPeek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c3af2d077162e0cd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,355 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 H\245\001"
+	.string	"t\002<"
+	.string	"\002"
+	.string	"\221\300\376\344\007\004\002"
+	.string	"\002\001\001\266\275\333\311\016\022\002\002\002\001\002\003\002\001\002\004\004\002\001\002\005\002\001"
+	.string	"\004"
+	.string	"\200\203+\271v6m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.843869e37262806e,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\305\006"
+	.string	"\322\213#'\200K2\034\234)g\200$\305V\207\314\321Lq\355\225\255?\262\367oi\312\210\214\310\023\375\376\177$nn\264\267\224)\377\3171k\320\bM\264r\250\251\310\"\360\"b\322l\324\004Vld0{=\330\264\005\230ku.\207\352\0202m\r\246\352|p\247\nl[\256\025w"
+	.string	"\267\311\024J~@\343\234=$\205\021\212%:L,\261a\022K\224\024\020,\320\234e\020)1\362\362\030h\321\366\340\375s\252_H\374A\210\321Vy\276\006! \220\"\224\266\001\265"
+	.string	"\333\2008Jd\354\024rS\031\204$\364A0\007\240\013\212;\f\234\002\220\026\240\201\240\241\221]V\031\254\th\270\022\344"
+	.ascii	"F\006\215H\204\306\263\363\314\007i\302x\277\316Q$|\253Zq\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 \200\205\002"
+	.string	"\204\003t"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\n"
+	.string	"\001\002\013"
+	.string	"\001"
+	.string	"\001"
+	.string	"\340\r\b\b\006\001\001P\002\002\t\300\f  "
+	.string	"\360\003\002\f\240\r\200\016\b\b\002\r\020\020\020"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"I\215\342\2230\270\003\350Zu\032\264\301\224K\240\351\307\006"
+	.ascii	"\332"
+	.text
+	.section	.gnu.lto_.lto.843869e37262806e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.18.843869e37262806e,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\326WUB\020\221\223\016\030\016u\305c\262\227\212,\226\f\221\213hm\255\352#\234\271\013\301\023\220\305V\255\220&h\377\214\226\265;:\017mQ\245\024\001\200\312p\357]d_\210\002\326\220\030\376/ido\271S\nA"
+	.string	"B"
+	.string	"C"
+	.ascii	"\207\324\003L\207\266\235@A\307\330\200\r"
+	.string	"J:\341\331h\354\316\250\"\216\375\251\303|\335J'Z\366\307\241y\270vh&\257\300\356^\345\356\243\2258\207q\260\273v'Z\207\033\336\366\003\333\r\354C\b\037\375\360\363vv>\206@&\203\205\213\276\230\313\241tcW\300\024$>\177\273\343\2538\343O\354-\210\325\026\037\246\350\300\241\031P\316\331\027=\245\363\021\311\001\354\202L\240\330\235\b\374A\035z^\300\024/\032\264\344ih{K\007\f]\211\201\"\232\341v7S\r\371\330t\235\300B2q6l_x\211\f\324n\210\017\237\205sQ#\016}\222\351\360z\222\013\224\224\321\212+\3313s\032\262\377vw\255 ;\034\215TK^!\317\225G5rm$DK^!U\005\0227R\203ADR\210#\" \025b%7\321\303\200-\013\032\0319\226%c\306\266\347\376\255\202\034\301\323\342\276}\201\n\217\213\376\330\344\364\243\230\317K\215\023"
+	.ascii	"\201\n\350a\321\356\026\016\300\354\330\312\020,#\302\264!2\\"
+	.ascii	"\002E\361\313\310\215\305\346\232=\263\260\235\310\264\004\253"
+	.ascii	"\344\251f\240\2228\324\275\255-z"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.19.843869e37262806e,"e",@progbits
+	.string	"(\265/\375` \004E\031"
+	.string	"6\353\232I\300\026U:\224\360\353mpE\244*\374\347\244\233\306\262\013\333\004\325\346\036@\332\251\216\255\212\310\351\360!\023\233\332\227\363\236\037$\244G\030\013\263\333\266\263]\375'y\b\314\"M\316P\327\277\272\243j\007\324\b\331d\357\235d\204"
+	.string	"\177"
+	.string	"\211"
+	.string	""
+	.ascii	"\272\177\210\212\272\317\005\fa|\310\347\310\314|\037\027\322"
+	.ascii	"a\223\2368\026\017\260\360\370\222\272OR\365\232\373\220>\300"
+	.ascii	"}Xs\334\374\3114\2127\264\225\232|\t3~\264\232\354\247\352\303"
+	.ascii	"TC7\212\342\252E\214_\233\200\206\221\213\231\032\217\255\221"
+	.ascii	"r#\313}\247=5\0254\374,\306\255\270\362\275\200\023+\264\232"
+	.ascii	"\213\327\024\247\332\316\213\253\352\356\333`\001\303Rq\325\335"
+	.ascii	"Li\265\026g\324\231\231\0073s`\2667[(M\253\270\001\204\324\266"
+	.ascii	"F\200\262\245\240c\230\031\347C^\006\202\314!.$6v7\204_\316\b"
+	.ascii	"\232\240\216\207\374\023\367\341k\206\036J\273\031]b>e\264\336"
+	.ascii	"\230o\273\3760\377\374\307\363\316\366\275s\265\224i\245|\325"
+	.ascii	"\004\037\001\300\356\025Ka\372(T\002t\336\337;e\326\341\007\271"
+	.ascii	"\217Q=\223@\330m\313\222\303p\236i\033\267\022\322\202\324}*"
+	.ascii	"x\310\024FJ\231\277;\020\235\237'\036\341\024#\"\227\031\002"
+	.ascii	"\232\256\024\032\261\013\222 #\227\031\3521:9\360\027\304b5\272"
+	.ascii	"\021\0204\351z\nx\277'\267\336\270\336ui\275\215 WP\320/\314"
+	.ascii	"\334:\024\327H\353\002 J;%o\201\t\353\355g\362#\bg\353\3557\227"
+	.ascii	"\331\346Mn,\b%y\231\321%>\321\217t$\243b\336\365\306K\370LRb"
+	.ascii	"rm+\342'\231Q\025uR\256\373\b\037\311\351\257\373\220)\255wd"
+	.ascii	"\344^\204\231\267\214\335\262\323`f\016*\023\027Z\"X\032Z\037"
+	.ascii	"@\340\2606\224%+e\271dP\346\224\210u _\260\022\256\262d\2211"
+	.ascii	"X\213\204\r\314\003\231c\303\302!KX\214dp\200_ Z0R\304\353\005"
+	.ascii	"#Qg\277\376p\004\034&1Xe\034\251\334\274\016|\356\271<\005\264"
+	.ascii	"\263\327v\363\332\332\023\301\307T\341\274y\237\304#\312\310"
+	.ascii	"C\270\233\227\342t;n\203\024\321\016;\240o\336Z{\352\fO\355h"
+	.ascii	"Vw\330Vf\326\261\230J/\356\272\314\345\255\270dt@{\nZ\250q<\250"
+	.ascii	"\224!C%\"\"2\222$9\200\"\"\263\362\021 I%\025\221\024\230\346"
+	.ascii	"\344A\244\002\206\004\376\2536O\026=Y\256xv\215\202'\221hJ\345"
+	.ascii	"\331\002\276]=\037O\355\241\004\273@\215s\270\267\025\b\354\006"
+	.ascii	"\262\215\346\325\n<j~\037\021\030(\026\266\034p\036\207\t|\b"
+	.ascii	"D\r\001\315%\3151\004\025\325\225\236\206x#\273my\325S\351w\343"
+	.ascii	"\227\274\335\"\255T\365\373\027\027\270$\b\002Z\313\177\274\211"
+	.ascii	"?\362\207Q\031q[\343\200\307\207T\024\260\213\r\204\310nD\357"
+	.ascii	"\373\f\254#\024p\203\317\360\272\320i\241\267\332\177E\314\352"
+	.ascii	"\205\"\216\253\275\247\306\317\204\002\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\023\177\017"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.843869e37262806e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.843869e37262806e,"e",@progbits
+	.string	"(\265/\375`\277\035\315\213"
+	.string	"\312\342\3002R@\320:\352\026~\234\252 \246q\322\207\306\025DApK\334`G\024\247\r"
+	.ascii	"\274\013\344s<p\346\2471~j\243\306C\305\207\354\202\210G\210"
+	.ascii	"\357\306\233\366\240\265\037\bXv\335O('\0071\"\307\023|K\272"
+	.ascii	"(\372\277\276p\201j\312n\273eJ)\331\002\030\003'\003h\247X\270"
+	.ascii	"\323\031\270\323\027\270qq\260\017\325\200_\311\220OV\225\226"
+	.ascii	"\344\030\374H\376H\247!@\252\230\207[\016\264\311j\260\334\222"
+	.ascii	"\370\362\221\364\220\321\320\227\341!\226\206\242\215{\202\033"
+	.ascii	"\247\004{\370\302\215\023\202C<\221\262W\003C%\345\0037\356\210"
+	.ascii	"q\231\231\324\302\215\263\302n\304\305\300~t\241\364\273\236"
+	.ascii	"\353y\230r\246\260\036\375\025\376\350\313>\373-\0351\231\225"
+	.ascii	"Ad\020\006y\264qB\034\225\353\263\264Q5\330\277\\(\375\035\335"
+	.ascii	"\257\3656>\207\347\256b\030\303\242\206S\254\307\341K\242\317"
+	.ascii	"r6^RV^p\n9;Q\352ooN\2246j\206Cx\207\364j\350\247\006\217e\361"
+	.ascii	"\321F\233\340\0361\3651\356\230\021S\001R\344\231\363\323x+_"
+	.ascii	"\276\361U@z\343\313\370\031\356$\313\303\032\n\330\220\323\230"
+	.ascii	"n9'\215\206\214z\250\270\305\301JQ\252\257\372\2211\004F\013"
+	.ascii	"r\250\330p\337/_\374+)Bb0\037F\031\356\233\004{\322\205\322\037"
+	.ascii	"\272\232\03381\200\274\220\207\317I^\341\222F\343\206+\345pv"
+	.ascii	"\272\326\312\276\332\274y3\330\351\263\003\303\254\253\n\032"
+	.ascii	"\356o\342.\243\304\375`\330\231n\277\205\323\240X`~\020y\264"
+	.ascii	"?\007\356\227\201\333\331\334\314\217\223\210\226+i\330\311\370"
+	.ascii	"\f\276\3642\256\326(\224cV\346\234\354\271C,0fE\351\317\333\333"
+	.ascii	"\333\233\027\245\355g\030u\241\324\203wH\305\f\371\221\027\310"
+	.ascii	"#c\030\315\227\356t.\215&{D7\222\323\273x\230;f\314\271\013L"
+	.ascii	"\004\224\031Th\343\226s\0362r\035^\244\320\3200.\203\203\321"
+	.ascii	"1\315\\!y\264\035L\267\177\361,m\366\307\234\2119g\001\036\215"
+	.ascii	"\255\207\333\243<V\220\332\275\b\245\306\254d\376\271L-Sr\036"
+	.ascii	"m\317\302\355D\334A\374G\357\220*\340B\251;\227p;\315\234\351"
+	.ascii	"\313\017\336l\267\34204n\230\314\311o\341\206\262(\2176\t\270"
+	.ascii	"\375Cz\337\336\374C\332\033` \357\220\276\013\245\237\237\336"
+	.ascii	"!u\245K\361e\001Nv\205P~z\3460\231\023\347\3216\201\333\247\264"
+	.ascii	"\001P2\004-\204\333\013H\375\315\013H\033\3437\216u{\230\213"
+	.ascii	"9\362\026\251\216\231,\347dP.LK\027\331\243\216|\177\342\311"
+	.ascii	"v\244;i"
+	.string	"\021\0204\0171\213\345\234t$\232\363\320\035\001\037w\004pgC\206QR\264\037w\322;\244\330\205\264t;\227n\357\342X\034\310\245t;\007\265[E\355Iw\247\335\027\255\333\333\272}Mw7\273{Nw\273\351\366\264n\307\335M\326\335\004t{\332\3553t;\231n_\353\3661\335\256\326\335\311\356\006\352n/\335}\337\336\336\336\272\373HwZ\325-\200/i\220 J\256\224\\&\367\205\233\344\036\271H\356\222k\304\227\027\354~\341\246Hq\213\303\001m\0353\334:d\270u\222\270u\226\340\326)\202[\307\013\267\316\021\267\016\026\020\341\2324\032\217\266\316\013\354\343\376\360\345e\341\036\373\227\227\207\225\025.W\232\257\313\302\355\272\\\034\322\230!\222\304\350^9S\203\024%\327\335\332\231\343\204\307\234\273u\217>O\212P\371x\264u.\340\326\375\300\255\353\201]\207\003\367\325\321}\255\356\325\325*A"
+	.ascii	"\\Y\f/0\036\275Y7G_\255\213#_-\022\307\234\207W\353GN\316\303"
+	.ascii	"\037w\004\334\021@\233t\025\241\222\242\255\273\302\367\006R"
+	.ascii	"_\254\027^TW\217~\320\311\300\255\233\302_\344B\351\214K\243"
+	.ascii	"\n\210D\315\326sF\325\025\3624\363E\325\267Jx\246\312\ff\212"
+	.ascii	"7\006\f\035\222\033eh\262\024a\350\310\210]q3\325\027\306m\323"
+	.ascii	"\203\205!o\216\314\272af\345J\035\211\323\306|\341\016\2570G"
+	.ascii	"|\003%\314\315}\205\216\36405j6<\372r\376\r\177\321\020\276x"
+	.ascii	"\233\363\263\305\313\034\255G\347\374\ri\2235RF/\334m>\216\216"
+	.ascii	"m\r\315+N\216\037`W\302\036m\254\205\327\334%\221\311\2436\370"
+	.ascii	"\362\335\036\r\231\333\247y7W>e\314\2679<9\306\233&\352\246\215"
+	.ascii	"\317\230\361,>\3725\350\276\330\270\301\345\f\033_~[\253\341"
+	.ascii	"!\240h\313\310\325\243\335\246u\017dm\r\234g\353\177\032\363"
+	.ascii	"2\307\243krj\254\322\240p\301j\036\315o\r\307Xi\301\235S\342"
+	.ascii	"\316!\261\231\364\210#\214\312\b\356\021L~\t1\312\225\257\027"
+	.ascii	"\214\374\022\022L\264\274\227\343\230w\276\230W\373\031\276\314"
+	.ascii	"\247=\031_\376\332\177\351\027\362-\004Y{0\217\266\214\202\366"
+	.ascii	",\262\366`\216dS \354\253-\313m\355\305\376\314\235Y\311,$@\311"
+	.ascii	"\263-\353\213|=\021\037aP\316>z0sN\006Y\373!O$)\214id4d\324\303"
+	.ascii	"\306\307\323\b\007\264\350\303\350\310\264\361 \023\202;\327"
+	.ascii	"\003w\356\nw\277\227\376.'\326\3600{\224\213NY\025r\354\321\316"
+	.ascii	"M-\177\313\313\320\335y\207\006\025\262\0328\270S7\030\313\307"
+	.ascii	"\360Y|\371g\r\345\225a_\177\366S\236\351\316,\240\234\273\226"
+	.ascii	"|\235\275\223\037\273\311\257\334\024\265'\317\2343\221\221\221"
+	.ascii	"\321\265\321\304\353\rF\177\311|2G*\200\344\331\226\325\374+"
+	.ascii	"o\346\313g>\f\375M>\254\207\2229\023\237\371V\034\313M2\261\214"
+	.ascii	"(C\236.\306\374\262\257\302U\204\304\331\226e\364cv\240A\203"
+	.ascii	"\321N\323\340Ng\300\355\313N\363TZ\r\332\302\027,'\217v\232\206"
+	.ascii	";\365\202;5\303@i\025\254\364\021\002e)\265&_9'\245\370\362\225"
+	.ascii	"\037\345\336\220\202\205\013\n\356\364\tN\372\362\307\036\351"
+	.ascii	"\311\234\305D@\360c\377\304\313\334\231\225\205lH(a\266e\r\031"
+	.ascii	"y\2323Hz\240\001ij$\265l\3344\027\315%K6\2137\355\2129\242C\206"
+	.ascii	"G\233'\211\273\277;\315Cc\316\371\n\227\314F)\236v\234{Qw\217"
+	.ascii	"_O\240\273\321\234\273\223NHf\251)rj\300F\314\206:\332Cn\234"
+	.ascii	"3g\"\227\260\002.+\"\027\216\242\222+\013\211D\204A\306\314%"
+	.ascii	",*s\016\312D\242P\351\230\203\212\312l\225_\244YyNr\t3\361\230"
+	.ascii	"\20321\017=\024\211\\VE\345\320*\250\250\344\262\312J\256\f\224"
+	.ascii	"\211Cc\fb6\006e%\027[V\036\255\200\212\312\243UQ\311\265\304"
+	.ascii	"\2211\324\276jH\221\003D\206\203\025\211yF\325\216\241\021\310"
+	.ascii	"YL\036s\231\234\235l*\033\023\310y\307\321Xf\210\303\231R\316"
+	.ascii	"\031RV\206GOVIu\0353\321Y<r\314\371\210TS\316$\204Ig\016\342"
+	.ascii	"N\241\217\035\231j*\347\001\252r\026zv\346\234\2059\347\234q"
+	.ascii	"G2g-\240\342WUU\316YCUy\207\2609\225\363\223\321\300\264**\273"
+	.ascii	"\216H\315)\312\257\f#)\364\"\3251\177\3452\\F\254\024\216e\252"
+	.ascii	"6\374eU\203M\231\017\230\230\245\212\330\243\005\374$\261\252"
+	.ascii	"|\220\361\033\326\036\006.J\227&\3031W\r\311\325\020*\217\336"
+	.ascii	"\264\2375ex\360X\341\2635\247\341*\004\222-\013\020\007\343N"
+	.ascii	"\262\234\255\034`\302\366d\343e\313\2568\317\032\332"
+	.ascii	"8\262\353\3153\006\030Rb<o\323\267x\332\0353z\360\243\370dk\203"
+	.ascii	"s\266\0069&\346\346q\320n\363]x\032\362\225\002L\232T\374\212"
+	.ascii	"cq\247W\036\n\223\232[,x\265\331\0353\0060\245v\205\330\374\033"
+	.ascii	"\237c\0020d\222%\016\246\346r\374M-\314\303\271D\n\230\200)o"
+	.ascii	"\fW\206\013\346~\271b\256\224\313\274].\332\365r\303\\+\227\313"
+	.ascii	"\315r\251\334)\367\354.\357\225[\345:\257\226\273\345\222],\027"
+	.ascii	"\206kv\313|y\233\177C\337\261\013\345\314\321\270\032d\023\231"
+	.ascii	"\304\355\205+\343\032g\250\225\361\350\361]w\314\230A\027\227"
+	.ascii	"\"\367\305U\241\313\001&[\310$nY\334\270\rl\212\220B1>n\363\177"
+	.ascii	"8\230;f<\241\266\305\331n\363\363KU\221\002\323\2745n2i\312\270"
+	.ascii	"A\0272\310\231\177\2234e\324\311P#\336\346\353\370\0357\311\314"
+	.ascii	"\240\253\313\223\330\374\027_\243\253(l\f\231\304\r\206n?\363"
+	.ascii	"3s\276 \350v(\267y\243x\031\211\346\030\322sDaCR\200\366\016"
+	.ascii	"\032\016Jf\271Pz\221D?>\200\f\327\036\355\0353l\343\352\270\311"
+	.ascii	"\257\023R3\236a\367\311\025\363\345u\322N\356\216\013\2264e\374"
+	.ascii	"@\252\352:\271M\372K\b\2607M\334\334\210\214\214\320)^\\V\300"
+	.ascii	"h\357\330\300\3756\202\020\271\323\253\202\027\252\250\021a\362"
+	.ascii	"\274`\267\307\365\"@\252\310\301\026+\317\026\372\314G\2273\027"
+	.ascii	"\331\227\330\220&Y\\(r'\231\022S\3549\342\202\335\"}\346C\004"
+	.ascii	"\312D\"K\236j\027\354\n!\362\031&\2631\355\252\"\250?\254\355"
+	.ascii	"n\tJ\004\023xk\223\t\236\317\205\n\241\346\365\200\253oe\302"
+	.ascii	"M\242\304\003%\222\242r\235$A\b\tB\244\235$\001\022\222\004%"
+	.ascii	"\220p\227@\272\255\256\233@,\300\264\246h\177\324\\7\201hyA`"
+	.ascii	"\313\212`\325\250\265\r>\005\371\202?\236\252\346\200\253\357"
+	.ascii	"\204\237\252\346X\340\312\006}\252\212\227|=\023T5e}=(VUs\276"
+	.ascii	"_\217\3559\255\252\252kU\240\025\312E\373\300\322\n\3345\261"
+	.ascii	"\017\034\261mo\305Q\320\307\364@T\320\327sz\200D\t\265DR\324"
+	.ascii	"\321\272\024t\342\371zG@6x\024A\033\265\372\234v>\340\332\372"
+	.ascii	"zjS\013\245\252\002\264X\201P\252\232\266l\317IUSUM\201\273&"
+	.ascii	"\036\272\242\320cU55\201\367sB;\370N,\355V`\nlA\340\371\202'"
+	.ascii	"\226vk\006D\254\332bU\362\235\350\351&\020\300\325i\311\267\323"
+	.ascii	"@\250\365\261xV\345\255)L\004\365\332\250\025m\231\200\026\230"
+	.ascii	"\300\333\255pr\332\361v\3306j\335i\325\225\327k\261*\261\301"
+	.ascii	"\025;lp\305e\325\036\224\212\245u\205bq\255\372\001\n\324\327"
+	.ascii	"\003\301\307\362\322\225i\t\003&_oi\267:\355\364\240\330\313"
+	.ascii	"\252&D\240h\243V\314\023\321\273\301\025D\254\332A\033\265\366"
+	.ascii	"\260\354\n\\Z\332\345\326\026;'\034"
+	.string	"T\331\340\n]T\b,V\245\025\312E\bm\317\207B\265\240\003\245\237n\002\301A\b(T\034\265+\023p\327zh\331\265E\243R\264=_/\265\240\003\245\225\r\246-\216E\360\202( \256\305\272tW\247\035\217\305\375\200\353\b8\327\252\"F\260\301_\257\305\n\004\201\303\t\273\024&\224,\320\311\255\300`\273\003\256POk\273\323v\023\210 \324\223\332\300\252\246\b\001A\210\022A\250'\241\240\323\217]\201:\254\n\300\252\"\b\365\264\223\266NAvM\261rX\325\235\n\374\261\276\225\365\3611\365\234,\320\255j\017\n\032l\260\252=(@P\261.\375:\330q\261\264[\322\001Y\026j\023S\257I\355a\001\345\304\303\002\312IE\241\311\004\021#\324&\016,\324\017\250\004\\\227z-zJA\250\247\237Ve\332\205\360\353\345\230v!\364\332(\fZ\037\212 \324S\017om\177@\020N\3709\261"
+	.ascii	"\256->`\211V\325g\005\356NX\002\3564\340i\273\t\004\333\324\356"
+	.ascii	"\236\216|\277\247\247\037o\200\376A\255\300\243\366\367\003\036"
+	.ascii	"\355<9\253\252P,\204\242z\300v\327\201\357\327kw\355\017\350"
+	.ascii	"\003\324\252%\2200\n\032\254\355.\305\352\004\365\264S\301\343"
+	.ascii	"\355~Z5\251\365\365\202\271FB2\341A\004\0172\300<\020<\237\013"
+	.ascii	"V=\372\001]0\361x\273#\026\270\266\350\001\227\216|\275\335\323"
+	.ascii	"\021\017\310\036\201`\200iM\261kwJ<\336N"
+	.string	"\307\351\367\273@\3055\033\333mKa\330r&\034\246\026\233\276mX|\222\2540%\363\310\301}\315\\\032\372\236\3513w\rNf\032\036D\f\231-n9+\253\310\347\214\214&RM\3375\007X\301\ns\003\202H\250R\3314I\322\034S\006\221\314\310\314$I\007\"\n\020\210\003\202\226\250\251\017\022`DE\213J\307\020\315H\222\224\244\260\307v\036V\003\211\022\231r\204\305\234\313\036dG\035\320X\267\035k\366\016fz\375\013\366\006|\326\224\217qO\257\252\365\352\327;\235\314i\233\206cT\034\323\224\034\210\373Re\357\n\301\177\b*A\255JOWY%\314\247\265y\203<&\002\033\016\205\254\310\376:*Vgq\025\020\257\366\2712XLW@\341(a\033?\370ER[`Lj\246D`\317\350;\345\200\344\277x\01795=\3118T-\257\016\204\013\317K\260-*\0226\232sOqN\213"
+	.string	"O\200\374#\314\002\001\223"
+	.string	"\240\307m\217G\255?\235\"\245\267\317\363\245\327\256?\306OC\205\373\220?\306f\233\366\252\237\261\005\362\225\356c5f\013\001\033r\200,M\360AC\235V~\017"
+	.ascii	"\262[\bO\026\036\357\376\374\334\263\270\007\303\031U\r3+\341"
+	.ascii	"\001\355\372\030r\264"
+	.string	"\347\231\217\211\356g\235j\327I'\177\345\362\343\277\201]\377\252v\016\255\211'\211\270\303\\\302\245\260^\222`\005\020\325\341t\025\035o!\203(\261\2225\017\254\3439\244%\271\245\230\326\255:o\317o\204\023\272\366\377\356\324\177\233v\001DTA\\U:\367\b\005X\230\370\341\1775w5\336J\342\351\243\f\253\321\\\246\253\203K\321J\344Vv\241\006\263\006\023\376x\233\27542\304\220\03502X\220:\221j\311\215h\213A\266\322\336\237\334\216j\375\340\017`\266\026Gg\265\213\206.\224\220E\342F\212\203\340\254t/\270\n1%\177\310\023\202!\241\322\017\"_\330\246b~\314k\220\224\320\300\362!\003.%\022\337\317 \252\224\314\tO\207!\242\244\232\215>\302\232\332\005~\362My\352\336\334\330.B\205\205\213f|\3442n\340\310\354C~z\323%|\314\202G\026\340\361\017n\323lw\223Ja"
+	.ascii	"\261\b\310\301\276\273U3\216\336\273\027{\3150\025\337\370\277"
+	.ascii	"\030O\337Es\262\355\255\bv\"M\204\262\246=\373\024\250>\365\353"
+	.ascii	"\233v\\\035oz\274tg51`\321\2024\215I\312@3\334\206>\271\0335"
+	.ascii	"1\330!\026?\256D\350H\337(3\377]f\006\225\345\226Vc^\002\260"
+	.ascii	"\3566\323$\327\355\247{\214\037\365\002<\303\231_S\267!\003\227"
+	.ascii	"\370\003\254\222\303\241\302\321\231\024\236n\206\251+\034\212"
+	.ascii	"\300\226\246fQ\261\324*\336\017H<\245\276\352\214\354\007\302"
+	.ascii	"\370\224J\007R\t\243\214e\311Fd+\375\3060e\274tt8\337\226J(\365"
+	.ascii	"P\200*\233\225I!-\361X\260\003W\207\306\363<(c\240Q\254\316\326"
+	.ascii	"\266\210#\211\306"
+	.string	"\310\334\374\334\232@6\245\027\306\3511S\220-\0070$K\036\367\357c\263\035\352\346\021b\205JO\237\325\363\223\234\240WO\300\213\017\234\331\037\266S\341\377\233\3226\0047\246\3725\376\021\253$v\353\244\302\027\"f\251z\"A\330\334q\221\257\346c\020\f\311\352\223w\r\301\242^\373\351tO\020\t[L\337\177;\255g\201\007A@>4\326\365\260\207\t\252A](P\331\251\002\253\273O\233Ehx7\036]\364\205\356\230vE\t:\256P\223\"\265\373\353`\005$\344L'\326C\344\374a\302\340l\227\351q\017\303\035\301\266\3045~\357\bt\306\n3l\264#"
+	.string	"\374]\242\323\304v\263\022\264\003\036u\006Zf\033f\037\350\371o{\247\361#)\274\332\327\034=YFX\331\267\225tm:\275\346\335\023B\021\242\363r\030\005X0\230\007'U\214Bg\237|\026\323\be\221\270`[.T$\261U\"\364^\006.\346\301\371\213B\233%B<\304`\237)\2765\221\361\006\374Z\2274\200\227\221\216\025\005`\206\303\224$\257\b}4\2220\332\206\215\356\022\263\360e5\001\013`\370}\376s\276\363\005\213p\215\017h\327=:\211A\022\177\222\034\322C\213\224h\026tP\272\322Y\207\035\"\036.\2031\374.4\243\234:=)\020w\027\b\371\374!\200~3\250C+\216\237\266Y\231\035\351\260LCZ!\017\301\3003\265\031\327\335\202\371\224\020\013\375\363\t\243\230\263\224\3448\2703\177\207b\250\204]i0"
+	.ascii	"\031\275\351^D\204$\254\030\02393\302\256\317\034\357\307H\031"
+	.ascii	"\007|\t\373\216Ph\207\324\264\b(\364\n\202\fB\350\202\333\t\247"
+	.ascii	"]\355\210\356\323q\001\3703\316`Wve?\303\277+OyJi+"
+	.text
+	.section	.gnu.lto_.symtab.843869e37262806e,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.843869e37262806e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,305 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 \205\005\003"
+	.string	"\204\004y"
+	.string	"\007"
+	.string	"\374\255\365\254\f"
+	.string	"\001\342\215\236\254\t"
+	.string	"\002\273\214\205\235\r\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\003\240\342\234\212\n\004\005\314\234\243\362\003\004"
+	.string	"\002"
+	.string	"\006\242\350\214\335\004\030\002\002\002\003\002\004\002\003\002\005\006\006\007\002\003"
+	.string	"\t"
+	.string	" "
+	.string	"\31073\263]\3562\t\371<\223\322\214+\317\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 9%\001"
+	.string	"\300-"
+	.string	"\005"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\001\001\003\002\002\001\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	".\033\367\244\241r\317\006\260"
+	.text
+	.section	.gnu.lto_.inline.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\215\004"
+	.string	"\222\307\027 \220)\351\177\274\t\257\375\\\257*\267\317\326\037t\264\375\336\335\335Uk|\035L\036!\233H\231\002\377\367&\257\004\372\\\320\343\356\004+%\235\326]\353E\260k\205>N\023\341\266\031\272x\034\006:\331V\035d\031\"\024\313lsi\003y\032\200\313\257\372\304\335)\276\317C\357\356\320\2479\b\024"
+	.string	",C\270\\\n\035\256@"
+	.string	"\342\302\r\230i\004\274\001\357V\024\21630a\003=\025\214\224v[R\244!\b\216\"gs\tn\342Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 9u\001"
+	.string	"4\002-"
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\002\001\001\017\177\002\001\177\002\001\005\b\177\002\b\006\001\001\003\177\002\003"
+	.string	"\003"
+	.ascii	".#\251\214\263\001,"
+	.text
+	.section	.gnu.lto_.pureconst.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\200\004\002\232\004\005\230\004\006\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 \336\005\004"
+	.string	"\002F\022\032\260%\351\f\013ZT\221\244p\326a\030\206\245\270\315\326Zk\355&\367 R\246?n\334\230U\315\250+\224|\337\034\241\344\312GeP3\314A\320\252)s\036\350\fh'\t\322\3634{\336Y\345O\005\025-/\237\021\001\026"
+	.ascii	";\201\027|\243\323.L\303Z5\262,\023j\301\234\322X\242\t\2157"
+	.ascii	"\205\203]\032\270\371\315\346\372\245\240\265\nGJ\273\026\275"
+	.ascii	";\233.\373\202\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.732bf63f2367ada0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStart.5.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\265\006"
+	.string	"\342\314.2`m\322\001@c\003\207\024t=p\312$%\321\007(\177G4<\2628\341\265\nX\307\fY\264yAp\272B\2327\001\366\260\206q\337\266I\333;\2450\253L\245\032\352=T\016\f\371<\217\003\263\312\270N>\211M68\210M\305q\232\3548\212*\214x\351<\020\246\233\342\335\256\026P\264\2126~X\333h]\371\377\266\253e\223\306\300\350\277\030\245\334D*\361\230\332\232\265\3760\210\345\220\t\007\374\227\210\344\217\007M\300Xj4\201\305\022\306\002\026K\265\332\023\307\216#\210,FP\376\273\306a\313\314\252-b"
+	.string	"P\350cvQ\370_\006\ne\270\315m\r\332.\264\305\b\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroReadGet.6.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"%\007"
+	.string	"\"\01635`m\322\030@\203\240\320\t\345\233\241{\317\244\224\276O\340@\355\332R\265Ex\224\254\251P\217\037\264aa\004\301\373\231\021\227\r\301\264:Eqk\204\220\275e\n\230\2744\323\033+B\\\016\f2~b\007\223\227\006zd\234\340\310\006\030\301\271:p#=\320\262\306$\242\204\037\f\223\360\271:\355\333V\255\032\250x\026?A\356m\274N\273\273\277\355\335Ch$S\332\025\265\260l\nuB\372\263\007\370\235{\365\320\217LA(4`w+1\331\235\005'`\224zj\246R\n\243\002\225R\377\006\007\331\232\316\016\021\002JHdew\302\307\241\232:m\325\020u\032$\225\022\311\b\244\356\242\260\273\273\213\021\206\376\364'\370\027\376\214\007"
+	.ascii	"hm\231\302\340\305\230\303\312\316\271\206<u\210\370\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.7.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`F\001\305\f"
+	.string	"\266\226SB\020q\233\016\360\030\244\013"
+	.string	"\305\036\n\260S\272\233\030\tF[\2256\217\274\362~\344\310\354\033:\006\n\233s\304<\271\373\324\276\366\326\277\001"
+	.string	"\002(\345.\002"
+	.string	"\030"
+	.string	"\200\360\267+\333\004}\332d\313\224\002B"
+	.string	"="
+	.string	"A"
+	.string	" V\201\312\205\0245v\327\202\037\276}\212\022\324\315?\312;\270\016\344\023\207G\022\013*m8\2240%+F\002\272\021\t\301H\344\341(W\f\235\210\252\205\301\356Z\271N\303m\271\355\215m\007\366+\004\367~\352'\177T\265\252\372"
+	.string	"\006\220\030\200\261\233a%\307\246D\027!l\377b{8\032\\\355\227\270\211\355'\237\023\330\005\275`\261\353%\360\002\352\321\336\013L\217\3241\323\2437[\306\275\325\210\bC'N\301\177$$\030\202\376\247}\004\210ar\216\306\277\243\370\360ML\341\243\347\036\017\017\210\260\321!DWt$*i\001\375\231\"\374'\372TF\364\206\355\201(\f\331\227vw\rAvrz\264k\312\016Gj\0279=Y&g\207r\246\222\233K\302\203)5\311\301\346\005\301\312\246\234\240\231\021,\017\315\305\26123\263\252\312XGNK\303\260i]\274\275\264\020\024g\244\204@\221I=Tx\024\006\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.8.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"]\t"
+	.string	"f\021@:@\345&\035`\037m\220\230\323\234`\316xABj}32\273|\317tqB\333\220\356\307\337\310vS>\235\026\013\037\bv\007J\371\026\345CN\250\2726e?\331d\357\224\002."
+	.string	"."
+	.string	"0"
+	.string	"\005\330\345u\002\354\322\235\035s\220!P\243\2412\263\2733\202\274;\354\374\237\234\223R\235\016\003\030v\3270\245\342\270\343m'\330v\260-\023\376\367_\367~\210\r\300\030\274\354n\264"
+	.string	",K\266\210\330~\307\376\\\0326\227>\264_r\223\356\236\311\234]\017\022\226\335\365xas\211\360\263\363\355\257\215+\313"
+	.string	",T\304\360\265b\341\361h`\364Q\236b\362C|Q\202O\225\260K\005o\244\003\005[\366w\202\361\303\376\265\273\353\270r\264\222\270\254\322\221\210r\035ZI\333F\353hc\320\207Nd\022\017\225rT\244\325\fbn\225V\204j\304\244\be\242\t\252\333\374|\254\215h\235\234\246\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.9.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`\007\002\325\016"
+	.string	"\266YaH\360\262&\035\220\3358\265\323I@\250\302\f\334x\220\3757\304\321W\275'\303\031h\300\265\343@k\240\270\367\r!*UI\3555\022C\305&5\204Y\325n\313\202\257\267\210\202\032\205g7\020\361\271\233\261\215{\023\262S\nH"
+	.string	"H"
+	.string	"R"
+	.string	"\277y\271\200\335\025\216\216\335Q\201\033\204>=~"
+	.string	"\375\f\275\204~\332\366\202\023\223\303\217,\231\273H\201\302%\333\0359\r\306\303\313\320?\316\r\310\210\375"
+	.string	"\321A\301\\\2168\330]K\021\265\342\326n\373\200\355\007\266d\021;\\2\332b\347\216Q?\3475J\37056\341\"/~\372.\364\023A\f\213\246\025t\2223{\204\221\332\013\373\333\356\256\265\225\375\233\177\013p2\312\204\024\200\355\312\314\212\254\317\354\211a\333d\223\330\226\322~\3534L\001;\2671\274\3077sxdA\0328\230\260:<\226\222A\305\003\250{\317\005\025l\344\021`\355\236.\332 \016#\241\250^b\212G\305?j\257<\307\227 \246E\323\372Cj\203\307\021\206v\227\201\177\243\205\004"
+	.ascii	"\240\232\027\3729\202z\331\224\330p\225f`\355T6\217D\336J\367"
+	.ascii	"!\245z,\336\007\326N\205+U\257\205T=p\"H\335\307\215j\211\023"
+	.ascii	"\211\f\216\360*\307\002\202\225\363\270\337V[Y\347!f\330\020"
+	.ascii	"\tr\322N\330\020\"\230H\370\317\204\r3\024\356CB\231yU\370\217"
+	.ascii	"\231\230\262p\037C\304T$ \340\"\221\243n\350n\221\222\006c\311"
+	.ascii	"\334\033mM\344NH\260\t\t\"\031\367\006\2532\016\031\324tT]|\352"
+	.ascii	".\231\021i\330w6\244\303\253[\327\363\201\270\246J>\217'\322"
+	.ascii	"5\241\310\370\320\360\307\020\202`\310\326\271%\336h\310\326"
+	.ascii	"\021_\227x\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 \226\225\002"
+	.string	"\022D\017\031\300\2471U`\373\007\362A\344\345\377\377\177\272\233\210\310\273\221-\367\226;\005\377\267\254%)\334\262\206dp\207\302\364Hi\214\204E\002D\256\245\273\017\363\371\016CJUuH\274\377%\007"
+	.ascii	"p#\214\200\214\341\020\226!\001e\200\0324;\235"
+	.text
+	.section	.gnu.lto_.refs.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375 ?\371\001"
+	.string	";"
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	"\003\002"
+	.string	""
+	.string	"\004\005"
+	.string	"\002\005\001\003\001"
+	.string	"\001\004\002"
+	.string	"\t\006\001\003\001"
+	.string	"\001\004\002"
+	.string	"\002\001\005"
+	.string	"\002\001\006"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\t"
+	.string	"\002\001\n"
+	.string	"\002\001\013"
+	.string	"\002\002\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.732bf63f2367ada0,"e",@progbits
+	.string	"(\265/\375`\236\020\275R"
+	.ascii	"\372\212\204\036S@\222\272I\007v\202\223gg\204\r_\364\300\305"
+	.ascii	"\206V\220\273e~\305\032T\204\214\237\304\204\304\270\342\271"
+	.ascii	"\023\361b\207\215\255r\200\275\2367\2628\254\246~\210\276k\027"
+	.ascii	"r\267\020U\255\n\032\357\252U\321i\211^\260;\307\254\346\332"
+	.ascii	"\206\3503V\026I\2232\005\231\001\325\001\333\001=t\227\256\316"
+	.ascii	"\223:E\214\321\357\001\271}\333\003r_,\364\025\214\356\364\226"
+	.ascii	"\310}\237\320\357\221.\232M\263\025\305\252\371\232\331\264\357"
+	.ascii	"\fk\327\356\032\304ZnV\276\270\374\342@\277(r\270\267\267E\221"
+	.ascii	"\373\n\241B[\"\307U\364\\\244\350\027\212>y\266a\314VI\024c\025"
+	.ascii	"\227w:3\2439\\ii\225}\315\276f\342\005-.&\372$z\266\r \267^\200"
+	.ascii	"x\024\351\234@\273\2141\2013\346\204\313w\354_\361\300\206\001"
+	.ascii	"u\233`7lpX\343\362pV\354\177\217O\034\037F\344p\371\257\330\226"
+	.ascii	"]S\346L\033\227\273e\265\324\036Z\260\341\360\211\313\207@\017"
+	.ascii	"\203n\177\257\204\361p\221a\205q\271a\274`k\345\033\266U\276"
+	.ascii	"\342\201\003\021\273\253\273nX\331=\334E`\304.\002;`\216\f\277"
+	.ascii	"r\345[\320\177\251\374\313\265]\213\304\025\243\214\035\326]"
+	.ascii	"I0\222\027\220\300\341r\243\254\224\255\007\263S\276=\354\327"
+	.ascii	"{\210\265\221\335\035\264Y>\b\263\270<\261%r\345\004\364\353"
+	.ascii	"u\003\206\335\017\234\251Sw7\317\036L\356uK\344\350\006\220\213"
+	.ascii	"\340_\027K\301\277\030\374[\301\277GI{A\215\177_l\213\315\300"
+	.ascii	"4\3613\226\357\374\254\302g\374\334\344\270\237\223\234\177\316"
+	.ascii	"\372\327\374\267\367\257\n\377\246\360/\n\377\236\360\357\214"
+	.ascii	"\177'\360\362_\315\177\260\177a\374\377\372\367\203\177=\370"
+	.ascii	"\267\203\177c\374\313\301\177+\377\221\377e\374\037\340\177\230"
+	.ascii	"\377\271\267\267\267\267\177-\370\371\315\257S!%7\301\221q\273"
+	.ascii	"aHE'\345\250\206l\016\355\331\251\r w\034\312\031e\340\212Z\243"
+	.ascii	"gQg\335\210_[\216D\264\255\033\226\030\213-\246\201\2159h1\016"
+	.ascii	"l\204s`\035\030\tg\361\221\255\274\305D\276\311]\303[|\3057\340"
+	.ascii	"\246LQ\260/2lo\2666N\016+\314\217:m[,d \302M\363\352}\003g\335"
+	.ascii	"\214\020\222\350.\"\204Kw]6[\273\266n~\276\304\024\025\r\025"
+	.ascii	"\351\332\024a[\002@\311X\\d+\021\333\320\223\306M\22004\364K"
+	.ascii	"\224\013\"\312\035gF\217\323B\1776\236\207l D\0201.\205\370X"
+	.ascii	"\221\362\2322\205r\020\256\341\007\210\035\275\326\204\036\227"
+	.ascii	"\204\312\3003\260\325V\006\362\034\254\203\353\310@\230\007W"
+	.ascii	"m\322J\250\033\313\311\021\b\017\031\nW\217<U\322\244\260uw\001"
+	.ascii	"EEE\270\030\240\030\221CK\216\252b\251\r\363\301B\362\203a\340"
+	.ascii	"\030\266r\025\373\370\276q\023\271\212\251V\rW\271P\036_G\330"
+	.ascii	"\266\213\253\370\005\236\332\244Um\037>_:\024\r\025\025\361\231"
+	.ascii	"\032\202\b\202\226\307\031\241\307]\235\r\367\370Z\251\205\366"
+	.ascii	"#\n\227\307\005\241\307\375\240\307\355\240B8(\252C\250\237\322"
+	.ascii	"\240\034\273\353\216\255\254\203\213\270**]\256\334\350Y\016"
+	.ascii	"ua+C1q+C\361\323\266\031!\254\335\343\007+\312\217:CE\313fM\023"
+	.ascii	"!ey\036\243g+\364\\\351y\007\272C\214\204.\235\241\021VRd\225"
+	.ascii	"\313\363\020z\026\277\2129+\347l$\200\232j\342\327\222\242\247"
+	.ascii	"\267\036`\332\272k\021[w\316\207jw\321\020\253\005\3512S\226"
+	.ascii	"_6\364\233\206\236 C\277f\264\0017m\322\304D=q\271B,\333\326"
+	.ascii	"\003v\b\2340\264\273y\262\222j\234\264\265U\fD?{9\177\371\251"
+	.ascii	"\312\242\262\342.8\027\226\234\031\271\013\217\371\214ei2\004"
+	.ascii	"\203\351\320\254\221*\216\371\346\272}\354\324\236z\002\372\356"
+	.ascii	"\354\022\375\272\305m\002\377\313\356\027`Bma\2267o\350\022\261"
+	.ascii	"!\r?\321D\335\302\251\"\362JH\242\210\034v\221J\222\212D\261"
+	.ascii	"6\021\002\032Y\244\213\325(,\215B\356\332\304+\252&\032\205M"
+	.ascii	"\305\332S]\215B\241&R\t\025\353PXD^Qm\021i\244\"\321\304\026"
+	.ascii	"6qH\204\022\215TE4#\225P\0219\244*\022\257\250\266\253\261\267"
+	.ascii	"\214\227z%\204j\344P\327\335Q\365(\004\352\036N\265\320\fK\365"
+	.ascii	"\025\233T\013\351M>\251E\272\273[\030\246\206e\354\251O\235,"
+	.ascii	"21\332\200\352Vk)\007\204+\254\335\235\243\237\204\333\rU\247"
+	.ascii	"\272\237\214+X\031\367L\216\251\3265q\030\365\204e\004\202z2"
+	.ascii	"\346h&D\226\252\210\3042\252\030\253\202<\366S\025\356\261\325"
+	.ascii	"\256\246(RX;\314\215\016"
+	.string	"\251e\025\245\305\311\266\245\301r!\313\236\005A\361r\223\303e\227\025\242\004\316\333\025\024\224\350\005K\227\225\207\365\320IC$\311%\203\225gf\306!_\364,\330k\203\340$>YF3m\332\276\316\224\261\215\t\203\205\2310\2247d\322\274\366\207U\333\244\221\f\272\304\222^\013\304\206m\322\312\002%[\300\220\355\0271\307/\346\342\312]\214d)\034\205\251p\017<\205\253le\257\325rV\302K\304\220\331/egl\233,\263hfG0>,\232\211\247\"\007dhX\2746\313~\341\2214\323\306\307jX\2666T\362\2233ST\342p\371\222\310N\230\007\035X\030 C\336\341\314\003P\034(:W8g\317<\315\243\021\247)\343\307\374\005O\336\317l\272a\3160\177\301\021\200H\234&\f$\236IB\320S\310`\372\361\\\350\336\363\375\314%3\211\336\001\b\030\200@\002'\236\3636R(\360B"
+	.string	"\363\344)\005{J\274^\317\231\364k\301B\217GCI\211\327\373\001\236N\346\317\2713{>\034\346\0210H\343\007\030\244\201\003\356|M2\220L\263\t\270s\356D\210Q.\371FX\002\366rf\022\222\006IK>$\236\251\364\343k\002\342\200\273\027+b\234N&\355\255\360\341n#\0050X"
+	.string	"p\007\302\351d\352\200@\363\207\204\304\3431q\360\224d\004\233n\320\340\016\030\244\321\3434\243\206yd6\2650\343\364-\305\330\265"
+	.ascii	"\341(\3506R|0#\206\f\243\323L\372\361\316\023gj2\177F'\023\323"
+	.ascii	"\317\350\347\004\232g\351D\302\351[\362\345Z\200pd\002\203\271"
+	.ascii	"s\347\334I\300S#\350\302\351\267\203\303D\302\355\220\314%\037"
+	.ascii	"\215\033L=\335\031\244\347\016\002\025\347\222/H[\340)\231H\273"
+	.ascii	"\246 =\317\263I\004\335\217w\002iSp\207\3043\177<\277s\204\336"
+	.ascii	"Rp\203\323\2041\002\270\303a\036\3654\005w\247\231\224Sbbr\261"
+	.ascii	"\3339w+X\234K>\236\253P\361\342D\t!\300\240\275\024&\013\274"
+	.ascii	"\032\273\237y\2327\230~<\032F\300\237\211\303\367C2Z\362\361"
+	.ascii	"n\030\365~@\243\024\f\250}\321\271\231E\251\251\341\262_T\230"
+	.ascii	"1\\\242A\303e\002$i\206a+GW\232d\222\323V\314\212\210\316\341"
+	.ascii	"\3622\304\3149-\250\252\356p\343\222\313\364\250m\330\026\231"
+	.ascii	"\373\201\t\221\034gc\306,\362=\335WX\216W\320\2662\332\"\313"
+	.ascii	"\332T>:\214S\275\300w\242\234\2351\017G\214SD\337\321\"#\343"
+	.ascii	"2\036G\037\316e>c~\030\271\262C\003=oa\2613\227\377\\\370K\201"
+	.ascii	"U\250\2214\250\224C#\"\"\"\222$I:A\005\204 G\241\254\016\022"
+	.ascii	"\3004A\221R\212d\246"
+	.string	" \205\322\306v^\226\227I|^\220\022\252\253\005\230F\001\326\333(MkA?\300\343\030\032\277d\226\201\020V[o\244\345\021\342c\271h&\353\260\243\020\304\263Yn'(9Z`c\227\254\373\270\303Ws2\314\373\323\337\361'3\356nv\367\230\220\352g\235,\n<\304C\265\315Css\357\251\312E\247\200\035\200\360\021I\337\365\354\351E\016\261\352\217\221\016\336Z_\311\342\031\265D\013_\371\351\020L8\024\302&\177\b#\2770\245\220\355q\351_`cs\262e\th9w\340\2666\276\007E\376-Y\b2\345Q\260\237\336 ^x\237\n2S$\273X\025\214\002A\325\324\331\362$\324[=\265\371\373:p\256\212\037\226\004\375p\"\2008"
+	.string	"\260R\355or\3071U\031\376\347\004\177\027&h\276\023.\252=\033Y;=e\002'\356\364\331\352\372\251Ti\b\001\251_\206\204\035\374\211\354\315\342\021\021\200,d]j\330f\265Dnp\266T\217wh\006F\026\343\372\006\237\221\030!\257\314 \3732"
+	.string	"\211\357|M\243\262\262hC\324\204\203\365\231=C\200N;8\360Y\006cE\250\330\212_P\31435$\254\322D\221\334\212_\322\244*\317Y\306\262N\330!nf\026K-\031\334\342s\b\224\024\313\267v\254\205e\326\261@3\372\375\004\364`\347\200b\2569m\001\354\213\310f\201\301duAp=p\305\316D0[\236\242\366\266\037\017\372\023\026\276\352\356\" \363@z\306\362\234:JBh\245WN{\240j$S\373\213T\263\265\315G\202\367\366L\260\242\205u2m\320<)\372K\207\235"
+	.string	"\334b[\236\377\254\356\373GdH\357\252\245\\\n\230\361w\272\026\200L\310\036*\254\323\257\353\021j\301\303\023\306\317w\212\271)1.\312\231}\021\335\021A~\037\322\007\3405\026\260"
+	.string	"\222o\260Gd\206x\222\202\\D*\345\003q^\3017\227`a\3776b\307scK\370\252c\212\223S*\032\321E\032,\020u\252\305T\346\360QF9<\210%\207\240`\331\344\3600\255\026D\271\355@w&\023\022\235 \367\277\354n,'\207dR\304\265\333\261k\223w\244\216)\371"
+	.ascii	"e\343\335k\227\323\347\215\f\013=v8\375\252\300\357\\\030\344"
+	.ascii	"\030\003\216\351\307*\366\240\273~/\206v;^T\017\340\241\224G"
+	.ascii	"\263+\271\004,b\033\344\362A\250\346\223\276*"
+	.text
+	.section	.gnu.lto_.symtab.732bf63f2367ada0,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.732bf63f2367ada0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,270 @@
+	.file	"buf_writer.c"
+	.section	.gnu.lto_.profile.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.text
+	.section	.gnu.lto_.icf.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 _\265\001"
+	.string	"$\002S"
+	.string	"\003"
+	.string	"\264\374\222\305\003\b\002"
+	.string	"\002\001\002\002\002\001\002\003\001\215\257\275\277\013\016\356\254\210\376\004\b"
+	.string	"\007"
+	.ascii	":\rTu\225R\034@\0012\211\261\033a\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 7\005\001"
+	.string	"\270+"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\001\002"
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\020"
+	.ascii	"\031\351d\303\002"
+	.text
+	.section	.gnu.lto_.inline.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\007"
+	.string	"\262\213\"'\200)I\007\230\t\231\315aB\256\001j\b\322\035P \"+\372"
+	.string	"\234\347\212\201\f\027\020JXhQ\263\244m\"e\n3\314\254\345r\244e\226#1!\372\206\266\351\027\221A,y\ng\242M\002\363\203\207s\375"
+	.ascii	"Z\327Y\214\253Q\214Y\215\202\227\027\345&\001Le\"\2549\r\230"
+	.ascii	"9+\034\267\242#\356\r\202Nh\260E\316\203\240\204\f\243\267@\207"
+	.ascii	"6\021\274O\340\234\217\3057l\333:\177q\333{\234\210\266\312\237"
+	.ascii	"'\021( \220\002\251\243\371D>`8\220\273m>^)\203E\210W\210\031"
+	.ascii	"\335\rf\261F\304:\213\231Y\207\227\226\212i4W48\360r\330\307"
+	.ascii	"\311_t)R\343|] SZn\272\003\204q5s[\236Xa5\021\017\320\r\234\235"
+	.ascii	"\033\343(Jn\217\314\260\335\312T\270\"\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 \251\315\002"
+	.string	"\342\005\021\032\260%\351\f\243\034\300\216\345\341,9|t\030\350N\003A\331\266\2157\221I\006\033\331\206/<\341\331\361\034\331\347\035J0\377\334K})\276\225d6\231\267*v6\360\274`\t\226X"
+	.string	"\373\371\247\215\r\002\006"
+	.ascii	"E\310\200hQ\036\201\265\234\0052L^6\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 \321\335\002"
+	.string	"T\003\305"
+	.string	"\003"
+	.string	"\004\270\007"
+	.string	"\001\002\013"
+	.string	"\003\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\b\300"
+	.string	""
+	.string	"\200\001\b\020\220\001\220\001\210\001\b\177\b"
+	.string	"\002\210\001\b\b\b"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\241$I\350c%\023\323\2711\202 \202\205\240 h\345\300\212\214"
+	.ascii	"\241\216\274\364\270,\360E\004\220\341\006\332"
+	.text
+	.section	.gnu.lto_.lto.24aa3ccdc030c4fd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bufWriterInit.3.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375`>\001M\r"
+	.string	"\266\230YD"
+	.string	"\261&\035\233Q\304\325\211g\023\207{\376\354\357{D\\\017\334\251\221\232\231m\024\311\356V\245|\215t\337\036'\236\236\243\206\243h\274\336\245\377;\205\025\304,3n\3360\200n\373\240\2315bw[\271S\nC"
+	.string	"E"
+	.string	"H"
+	.string	"\007\260\253Za\263\333\201X^\207\266}\231\223@\231\363\350b^DdZN\330\330\355\244\273\007\210\207\327G\361P=\234\373\343\374\327\234\300*F\312%\345\317\223`w\375R./\267\336v\001\333\013\354\327\004\277\347\253\037~\346\327\370\374\342\363E\037\326H\306.\206\026\216\305\2017!l\243\354\220m\310r\316\007\005\235\325\311\243cYL\\\020\321g\277{\t\324i\354\302\237]\016/lv\027\304\007\256\303\217\216\337\373L\205\0266\254\274\226Az\375\260\264h\311\361R\264\263\263(\tP\211\250\341Q\373\344*\2343"
+	.string	"\346\006T[{\212\323\265\273\b|\024\023PD1 \016}.\036\032\200\031\241A\345\265\354.\345i\007\373\235U\225}\232\037tV&\223\244\021\243\220\231F\034\2206m\003\221\334%!\023\333\262y\032i\020\201D\232&&!\233\f\344\203\214t\"K\246I\206|X\203\200M\271i\332\224\241no\253\242d\300Q\321\025?\265M~\363`\244h|\306K\361\372\364\001\032"
+	.ascii	"\253s\240\314\2000L\326\004\026(W\004\033u\020$\310|Tp\214\312"
+	.ascii	"\201\3511\033\3132\327p)\330\200Z\013\034\r5\340\036\030\006"
+	.ascii	"T\020\2400\fS\t\221\341D\021\332\004?\235\351\b\223\f"
+	.text
+	.section	.gnu.lto_bufWriterAppend.4.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375`E\002\345\021"
+	.string	"\366`qE\360\262h8x\321f[\347q\327\301s\322\235\005\221F\2763\275\304\031\351\251\266\206\276\247\260\335C\177\277!\310\341D\324`\212\021\207&\306]\317\300s\222\235g\266z\t\266pH5I\243Y+\332\266\367\2262\245\\"
+	.string	"T"
+	.string	"`"
+	.ascii	"\27305\030<\355\243x\212\327k*?\355\306\270\320\331\025\027\370"
+	.ascii	"\023\235\263\370\001\3359\321\003t\347\374\262w\024\340@\202"
+	.ascii	"\341\262\302\307\356~*\342\257w\233\346\313\017\205\214d3\330"
+	.ascii	"\273\227o#K\252i\326\262\241v\3676\317\016\263Xf(dw\235\262\331"
+	.ascii	"\207;t\333\023l;\260\223\026\212`\246\246\266\222A\266\030K\225"
+	.ascii	"\261\277\355\356ZclQ\332\024J\2274M\352\322\336\305\177\364\332"
+	.ascii	"\037\342\322\233\246\225K'\227\376\311\303\021\020\264\353!\350"
+	.ascii	"\307\366p;%l\337\277\371\350\272\n\033 A\263\273\3369\333e{\347"
+	.ascii	"\356\331\326\264\033<x]\f\255\001;*{z\300\204\317\267\260K\375"
+	.ascii	"x/\304M\016\226\374\311\335\205\251\312x\323\324\324\215\r\226"
+	.ascii	"\374\261\275z\214M\025\314\370\324Fj{\303sB\023mw#\330$\177\301"
+	.ascii	":\247\004F\200P\325\344q\001Jm\001\200v\031\217?\354\256\251"
+	.ascii	"\311\323\002\023s\311Y\204\242\335\205\340\343\234\230\210fT"
+	.ascii	"\272s\017\026T\231\272U \340*\205\005\272D*dH}(\340J\003\013"
+	.ascii	"\244\360]`\215\230|*\020\345\003A\271u\262\002\277\224V\013\374"
+	.ascii	"<q\3456\227P\323\263\242\261Net\376\321%\247\021\226h\tN\320"
+	.ascii	"\3648%IKjR{jT\213\302D>\303:LJ\302Q;\017\006\331G\223\\FI\365"
+	.ascii	"\206\354\205\244\317q\001\032=\3622 `\002\021it\007R\300\033"
+	.ascii	"\336Na9\201\327jG\220\345'BP\363\342,m\211\360n\315s\206M\327"
+	.ascii	"~\022\360\334\205\231)4n\005c\357\270\325\027\323\013)t@O\246"
+	.ascii	"\260\266y\266.\n\263\004\030l\324\241\033\363\\,\2738P`S\323"
+	.ascii	"\344tw\366\255\333\336\310\356\025\261+\331\030 C\240\276\367"
+	.ascii	"\021\001&\212\354\346\003n\026\256\210\310\300\306&\2502"
+	.text
+	.section	.gnu.lto_bufWriterFlush.5.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375`6\001\005\r"
+	.string	"\346\027UA q\232\016O\006\ro\023\272@\251\305\301\030\216\327\"\\\237\2561\013>\300\261\300\315\343\002\0375jy\207\b\301\215Q\353v\344\007\020\244\260BE^;\220\321\036\333\324\306\031\226\315oK\366\2262\245@"
+	.string	">"
+	.string	"E"
+	.string	"\207\356\336\221\016\247\017\220\016\215\3317\nT\330\304Xy\311\261\273Q9\034\373\323\304\374L\310\207\266e\177\032\256"
+	.string	"6\225\367\331\335\233x^\330R23!\273\353\324\266\f7\274m\005\266\021\330\007\021-#8\224\034\331]\226\312b\377\355\356ZE\366\271\177\222\322\020\246\337K\253\2463\323\327pRtF\273\030F<6\006\276\370\240\261\375\264O\342%\260s'\027\260+\202q\261\333\035p\234\002\207\261\215\315\f\002\035\240nhp_a\242\331\324U<8|\2522\264\rW\325\267X\351\341\352/\020R=-:rw3\265%]A.5Tr\207m\221\243\260\246\335M\340\237\030\2210y8\364O\244\303\253'\240;\004rQ%\325Ea\201\003\023P$\271\250\t\325\325 \216T\fDb\350\"\211 \037[\021\250+\226X\326\0255\335\376\255\212\fa\304\240h\312S\026\227\263\260&\216\201\020\"p\004H\325\247P\235\352\217\005\315l\207\002\035"
+	.ascii	"3\241\005\037\303k\2414\354\016\245\031\236\032;\240\334\253"
+	.ascii	"D4#\214\217)\r\252|]\233K\230\3549\\8\352\225;\202\257q\351!"
+	.ascii	"x\rUI\304e\217p\254&4\004\003.!4\253)\341n\006\003\026Un\273"
+	.ascii	"\212\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 b\375\001"
+	.string	"\024\003^"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\r\005\177\016\004\001\001\001\265\007\004\002\201\200\200\200\002\001\365\001"
+	.string	"\004"
+	.ascii	"I\b0\240\007\370\341Zs\f"
+	.text
+	.section	.gnu.lto_.refs.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.24aa3ccdc030c4fd,"e",@progbits
+	.string	"(\265/\375`*\007})"
+	.string	"\252I(\020H\200\332Q:\231:\225~\322\242\243Tb\212\227"
+	.string	"BS}\221\233L\236\312\323r\330\024|#8\005*\034\240\332\217.\367\331~lu\236\313n\272\345U{\034b\331S\3242\207df;\314>\305Cl?*\265A\332\226)\321"
+	.string	"\365"
+	.string	"\352"
+	.ascii	"\3505\240\307\200~\be,\266\302W@|\305\226*[]\256\216\223:t\356"
+	.ascii	"\371\b\350\031\350\306k\ft\373\003t\307\005n;6p\373y)\005\327"
+	.ascii	"\246Lx\346\236\347+\226\362s\025[\261\322\2466\261\215\325\335"
+	.ascii	"\366\350\260\310rd\271\347\317\311\263\362\237`\341h\002\272"
+	.ascii	"\255\272\373\347\024K\312YrOnQ#Nv\330\270'Gy\263Fj\343\306=\257"
+	.ascii	"\306s>qU\205\335\363\f\345\004\224m\341\027}\313\006n(\027\270"
+	.ascii	"\205\020\333\375\254\346\177R\013\314\177/J\002?\223\375\377"
+	.ascii	"\362\277\353+D\356g8\377\323\376\243\375\017\373?\366\177\314"
+	.ascii	"\177\025\377\265\376_\371\377\363?\304\177\346\1771\377\305\376"
+	.ascii	"K\371\257\373\037\346\377\271\266\266\266\366\363\317\317=\377"
+	.ascii	"N3)7\263\273\323\356\006P\214j\273}\354T$\221\330\r\345C\354"
+	.ascii	"\250\224kF\367\3052\333Z\325\345\221\345qQY\"\233F\2332\262\313"
+	.ascii	"\214Et\231&\273\251\2739\rE\256:\332\220\351\262\025Yu\250c\234"
+	.ascii	"E&\254I8\006H\327\356 J1\337\274i\222\311\227+\346b\271\244\221"
+	.ascii	"\210\225{\206\371\33413OPt\240\247\240\205\267\266\252\246|q"
+	.ascii	"\027\356\032`\353\016FAR\300\302Y\314\204\272\360\004\n[\375"
+	.ascii	"\274/\316\362\346\217P\355\260\304jMw\033\206\275\030\f\177a"
+	.ascii	"0\276\342/\346:oa.\367io\341g*\374\305U8\353G\330\035\004\210"
+	.ascii	".\251F\003H\234\3566(((\310'(\247Vu\246%\340<we\221\350\036v"
+	.ascii	"\367\001\2360Z\302\244\356y\336\331\313\013\334\212Pm\353\002"
+	.ascii	"\020\341\342#\315=\337C\331G\004\312ZJ\036\252(2\214\367\374"
+	.ascii	"\2074\220<%\357\311hx\3548\265\202\271'\227\335\313yU\345\311"
+	.ascii	"\354\236L\306[<G\250\0339\2328\257#G\261%\372\373\337:X\354\356"
+	.ascii	"\034;m\027\205\002\316;\314\016\376\034\333\270A\333~\340\254"
+	.ascii	"\233G\0227\250\022\255\340\217{\376g\320M\272\323\236"
+	.string	"n\273\250.\215\251:el\355i[\310\201^J\265\332\032\327\223\355\333ms\017\215k\013\265e\213j\313\246\273\036\262iw\273\356T\254`\312\352\322\270\252Kv\355\351a\247\275\f\nA\207\354\252\202\261\353N]\006Wuh\\{v$\031\002Vcj\f\t\263Q\207\355D\214\n\026wL\265e\273\254\233\261ft\261Aw\024[,\013\362\340-!\323I\210%\310r\333\335\b\210\302#\333C\246J\305vS\tS4\261B\3322\333\b3S\251\250n\232\321\235\240\333nbw)\226\230Tl\030`\"\tII)\203\356G@_\222\207\334\217|?\244$$\024\350+\fA\030\"\202\001\340DE\022\212$\334NT\304\343\025\r\361\320\017\361l\300\247`p\026JH?! \013\026?!\\\017\3303q.\031\375p@\243\021'\230J\004\270\241\370\365l1\200\276\243\236R\357\b\005\032\021\001\223|L"
+	.ascii	"\200\275{\036O\003\003\021 8\240G\021~H@\337"
+	.string	"\357\205\321\t\246\022BK?$\027\276\237\t\241$_o\205\320\321oI(\302\202\253\2511\0344\355\266u\007\021C\026\241Q\245ys\206\203;\322\343k\252\251\003\233#Dr\317_\341\2325\234\266k\341\231\2265\267!\2355\2576\347\264\244\231\027{Of\303M\334\024\031\225\036\234\265s|s\246\225\206\236\313\260\231\363\231\237a4\264U\020\304\251\313WCA9\3409\332\330R\232\235\321\270y\247\034\257 \233g'\325S:\f\313\035\315p8\245a.\\\200\220\250\3018\205\024D\"2##)H!k\240\002\021\261\3346\021\2205sF\212$\251\354\317\001\302\375\331\177t\005\236\262?H\232\317Qy\233n\022\206\306IO|\"Y\201^i\204n\032\300\207\332)G\2502\2248RFB\317\303\373\f\367k\250\302\026\220cJ%F\272\214\017;\r\326`6\203\241^\370\215QAIFx\360\200\263"
+	.string	"\"3\026\371\025\003f\237\2347\215\312\0301\230\377-\021R\t)\247v\222\203I/\245\306\214>\021\220\272\364\264e\350t\334U3\333\213`\312\017b<\352&\216\304\037\002\234\200p\203N\235\006\005?\374\313\261\2220\301V\251\031\\\242\r`\304\315\320b\373\275\373%\320\030I\003\357L\202\017\222YJ\033(\034\271#\0070\377?\270"
+	.ascii	"\234\230f\254\3761C\370j(\222\216\016\031}\341\260.\314\221\320"
+	.ascii	"W\305\241~\3525\313%\372\250\3166\177\233(\203\261\311#r0\277"
+	.ascii	"}7\330\342\277\236\261\003\177\237\322\253|\233{/ oaQ\330\016"
+	.ascii	"\203oUc\364*"
+	.text
+	.section	.gnu.lto_.symtab.24aa3ccdc030c4fd,"e",@progbits
+	.string	"bufWriterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.24aa3ccdc030c4fd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
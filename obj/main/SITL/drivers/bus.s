@@ -0,0 +1,472 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 [\355\001"
+	.string	"t\002O"
+	.string	"\013"
+	.string	"\265\230\240\355\006"
+	.string	"\001\002\374\337\303\241\005"
+	.string	"\003\004\005\006\007\b\267\335\335\337\n"
+	.string	"\t\n\354\301\314\336\005"
+	.string	""
+	.string	"\b"
+	.ascii	"*\203\301`?\207\250\214\3039\030\030Qe\310\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 \263u\002"
+	.string	"\344\002\247"
+	.string	"\013"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\004\003\003\004\003"
+	.string	""
+	.string	"\001\003\005\006\004\007\b\002\020"
+	.string	"\007\003\t\002\003\n\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\r"
+	.string	"AQ\001\027\202\347#\020\013\n,Sj\240a\233\036Wr"
+	.ascii	"\005\226)x\307<\f\260"
+	.text
+	.section	.gnu.lto_.inline.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 \263M\002"
+	.string	"\304\002\247"
+	.string	"\013"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\002\004\001\002"
+	.string	"\002\001\003\004\005\006\007\b\002\003\t\001\n\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\n"
+	.ascii	".\005_E\240M\217Q\345\211L\371\260\222\231M\357\315\344\\\231"
+	.ascii	"\022\300\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 \235\255\001"
+	.string	"\270\221"
+	.string	"\013"
+	.string	"\003\002\002\002"
+	.string	"\001\002\004\002\003\004\005\006\007\b\t\n\001"
+	.string	"\f"
+	.ascii	".\005_\f\353i\b8.\253\203\301\344\204)\356\300a1\r\007\223\013"
+	.ascii	"\220\315\006\260"
+	.text
+	.section	.gnu.lto_.lto.7841677ef6f45dd8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busRawWriteRegister.7.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\035\b"
+	.string	"\202\31777@o\323\001x\255B\262?i\304\222\022vq\230G\337A}\274\337c\352!\253\032\361\323\346\257\251\360\370\204]:\206\211\211\204\257\235x\220U|\326\3136\242M\366N)\230\007\313(\t\215\306\217\226Es6\234E\304\344\250\366\351\320lRt\260\211\311\241\334\334\034x\253\320\350\364l\033\235W\r\335\253\020B\361\263\353\007\243\207}jw\327\261d\337\364S\257?\374\351\277\274>\bPv7fd\266E\252\204\330\356\354\313>\201\036\260\237\213\006\003\005_A\216\273\0351\n\020\332\027\371Hw\323\305\005vK,)\273u\301\t\326\245\353\013\252K\353\003\325\245m7<t\366\fD\361\345$\243\004f\267\316\br\357\320\363Or\215\310dD\3028\004\200\330]\303\021\211\343\216\267\255\261\355`{%\r"
+	.ascii	"2\003\202\341\243a\213\020P\270\006\242L(\2400\030\346\023\355"
+	.ascii	"\300W\202\221\003\2500\235k\222\001"
+	.text
+	.section	.gnu.lto_busRawWriteRegisterStart.8.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"%\b"
+	.string	"\202\01787Po\322\001#\233\336k\357\013qvg\367\006pq\340\3127\322j\241\205\026\021Dw\353\266\f\266|H\264#3\343\306F\035\227\243\352\013d\247<\024\322\310&{\247\024X\b\313*\b\215F\221\226E\177<\034\305\303\344\250&\002\321lJ\200\260\210\371\241\334\364\024x\233\320\350\fm\033\235\233J\272g\031\220\342g\327\017F\017\373\325\356\256\343\311>\352\257^\177\370\324\177\t\260\302y\331\325\230\211\331\024i\002b\273\2637vj\364\200\375T8\024*\370:r\334\355\220A\200\320~\310E\272\243*.\260{j)\331\255\t>\270.]\317\261.\257\017X\227\266\275\320\320\331#\270\210.(\031$0\273u\306\217{\207\236\377\221w0XJ&\213C\215\303\356\032\226L\033w\274\355\216m\006\333'\001\r"
+	.ascii	"2\003\202\341\243a\213\020P\270\006\242L(\2400\030\346\023\355"
+	.ascii	"\300W\202\221\003\2500\235k\222\001"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBuffer.9.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"M\t"
+	.string	"\366\320?; \345*\035\007\324"
+	.string	"s\274\003\021\001C\377\037\017\004\bd8\2520\013\375g\331\254\307\224\n\336.|(\325\024A1  \300P&D{\207\004\n\316a\210\251\373\203l\262wJ\001-"
+	.string	"1"
+	.string	"*"
+	.string	"\266\355\320A\371\333dD\227\231Fl\266[g\024\371w\370\371\217]\223u\240\254X\027\207\001\020\273k\270bq\334\361\266\021l?\330\236\005\253b!\351\310Wi\243Y\214\023\017\006\r\276\236\034w?"
+	.string	"(@h\277\344&\250\273,.\260\333j\221\355\326\005'`.]O\260]b>\260]\006vU\301\bb_\333\335ul\331\177\375\362\256_{\375\341a\377\267\206\220\202\224\335\215"
+	.string	"/\273\"UFl\243\354\214\r;]\023\022\244O\310\233\3308\022\327i\037\217F\223\327E{8\243R\304\034Q\317\004\242\335\f\2018\212\351\241\243\3111\260\250\302\243\223$\022\321\231\251\251\177\333A*\252\002\020"
+	.ascii	"2\003\202\341\243a\225\020\220\271\006\032M(\2400\030\006\202"
+	.ascii	"\330\2520\030\346\023\355\300W\202\221\003\2500\246k\222\001"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBufferStart.10.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"%\t"
+	.string	"\306P>80\257\322\001\260\\0\3456\0178 \034h\333\337S<\212\034\203\301j&\373\265\035\230\002\037\377Lb\267-\017\031\006\006\0322(\316\205?\232\210\302\304\024Q\334\233\354\235R-"
+	.string	"/"
+	.string	")"
+	.string	"^\350\244\334\275~\264\316\221qAc\331\255\023z\274\373\353\374\323\276\3256RX\256\212?\200\206\335\365c\2714nx\333\006\266\031l\267\004\235(;m4kA\002\242\260\275\327\211kv\205\202\201\360\236}\330ER\217Q<`\367\245R\333\255\t>\300<\272~@>b. \037m\007v]=\330a\177\333\3355|\331\227\375\361\261\177{\375\337g\377\245\204\235lVv[/.k\022KBl\247\354\214=\033\t\017\246\320\210\203\220\036\223\007\264\2058\nQ\034\b\372\303)\235\034f\211r(\021\005\315\221\310\0231?\26449\004&Ipt\232H$:3U\365N\026\250\340*\021"
+	.string	"2\003\202\341\243a\227\020\320\271\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busWriteRegister.11.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\025\b"
+	.string	"B\31777Po\322\001 \353yy\302CQ\217R\264z\304\302\222\340\237\240\f\347\017lX\004\321\335\272-\203-\037\022\355\310\314\270\205B\027\227#P\032\302\203\332\233&\204\310\235R\031(\323,\212Mjh\323\324\236N\2071\021;\271\205>R\213\026\237\254\"zd\027;\005\346.6\031A\034'#g\356?\354@CI\366\034A\005\261o\355\356ZQ\366S?\324\2109\2632h\331-\325\320\254\313\265Bb\333\2639\366\211\350\001Kz\351h\260\340\247\310\272\373!\263"
+	.string	"\241\375\222\233xOe\\`\027\305\242\332\235\fV\330\374\362<\001\366k\363\001\354\227m;@x\376>EJ?\215l\244\314\354\316\250!\377\016?\377(GX\301\234bTL\243C"
+	.string	"\211\3355\3440y\334z\333\t\266\037l\253\002\r"
+	.ascii	"2\003\202\341\243\302v\025P\\SX&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_busWriteRegisterStart.12.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\375\007"
+	.string	"B\01775P\217\032\003\200\354\035\006\275\327\323\243N\224\223\250\003#\355\275F\251F\022\265\213\220\024\226\266a\306l\344\311\314\034"
+	.string	"a\350\213\364\005@\300\013i\032\332{K\231R\233h\363`\024\234\204#\316\003\333\341\2040&bHr\243\217\364D\213\317V\021;2\0249\005\005]p2\212@ \0317\363\356\264\003\rxj\247\351A\220\326\330\377\027\256Z\263\354\007#\376r\031\314\374\250\031\231\267d+#mK\355\2465!9\340'\027\217\006\354y\222\n\377\217\230\205\367Z\223\270\244dV\206\005\376\025K\353\237\fU\3208\3534\201\346L\343\001\315Y\333:@\224\332y\212\240\254R\331@y\3753\302\020w~]\355\023#\270`T/))\223\037\200\304\377>\216T\207\013\3356\241\355C\333V\r"
+	.ascii	"2\003\202\341\243\302v\025P\\SX&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.13.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\025\t"
+	.string	"VP>:0\257\322\001 E\346#\016\351\203\030\032\246\306}:PQ\272\216\366\034\024!\007\243a*~\177;\213\337\266\023\224$&\"\321\236p\310L\22322\nG\323E\221\020\262wJ\001,"
+	.string	"."
+	.string	"-"
+	.string	"\035\224\303\327\220\325[5\215\030m\267N\t\362\3601\364\037;\302\013Jkv\302J=\002@\354\256\343\006\213\343\226\267\235`\373\301vK%\202\315f\224t4l\361\365d\271\353Q[\210\321\276\310GP\207]<`\327\265\222\262[\031\254\2209\347\372\201\356\\\346\002\3359\333v\b\007\030Re\327T\224\037\366\267\335]K\227}\330\037e\204\214\346b0\333]\305\300\254\214Sy\331F\331\032\333\344\364\315\252X^\035\216$\023\244O\b\244\350<\222\367m\037\220J\023\370I{8\243\222\304\034Q\320\004\242\337\f\201\274\212\351\241\243\311)\260\310\002\244\223$\022\321\251\251\373\260\013\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\222&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301H\002T\230\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBufferStart.14.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\305\b"
+	.string	"\362O;9@\217\322\001X\360\223\355\217\3245\261\274\217-*\373\234#<\223\301,\232\342t|\344{\337\332\025\360\236i\205\330\257.\303\002u\215\337l\200\002\346\365\222\257l$\204\354\235R\023\245\320\350\243\340\272R\347i\241\217\312\323\347I\203<$\223\304$\321\357$\242\336\034\211\272\212\t\242\244\351)0h\361\321Y\002A:9u\037r\006\031Re\327T\224.\373\332\356\256e\313>\354\2172B6\223Q`\331]\325\320\254l[!\261\215\26296\312\353\263\231\230\b:\253q\362\321\240\305\327\213wV\325\302\261\020\243\375\327KP\207a<`\267\005\243\262[\031\234\260\371\346\372\001\356\333\346\002\3347\333v\370\240\034\276\212\254\356\032\331\210\315v\353\224!\017\037C\377\261\037\314\270\200\274\244\260R\217"
+	.string	"\020\273\353\330\301\362\270\345m#\330~\260\035\023\021"
+	.string	"2\003\202\341\243\302v\025P\\S\222&@P\004\214\003\303@\020[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_busBusy.15.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\215\007"
+	.string	"\202\01656Po\322\001 :"
+	.string	"!T\305?\276{\327\325Z1K\204\026\223\351\257\231?,\202<\204\3762\330\022\260\366\250\231Y\242\005\364\233\027\322\207q\221>\321\264\233\334)\005\362\2222>P\364\250;\034\254\002\002b2\202>\322\003%>\017\021\260#1\310!\3605\021%\244\270.\t5s\257U\005\030\232a\317\220\323\315~fw\327J\262o\372\235:\234R-\033\224]Q\314\313\252\274\023\020\333\231\255\261\255\323B7\334\206*\241\022\234\263_\272Hv\323\305\003vI%\247\335\2711\202\365\347\371\201\352\317\272@\365g\333\013\f\231\265\317\017\321\267\024\r\222\324\356\204\352q\355N\363?r\003\027\230\025\026\223Q\350\016\240aw\3558F\035\267\336\366\201m\005\333!\001\n"
+	.ascii	"2\003\202\341\243\302v\025P\\S&&DP\022\234$@\231y\265\223\f"
+	.text
+	.section	.gnu.lto_busReadRegister.16.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"]\007"
+	.string	"\"\216360q\222\016\200X\247\021\355\024\003S\226Ff\244.\225\335\303\027\265\365i\214\354n\303V?S\366\366\321\312?\f\fx@-A\034mp\252E\326\326\327*!2\005\022W\366B\327\347\355\351h\027\021P\313\256\020(\373@\n\020\304\004\364d\032\354\024\214U\\\031\264\300\260\frbv\263\f2\236\306\307\221{\247/@f\346\317\364N\373@\3158\260d\222R5\031S\275\214\374\242\347\374\3175n\277L\017\032\005\347\276&=\021\025\005\243\002\231&\030\227\314\270p\302\246\325\261\004V\253M\007\254V\377\f\r\242\267F\021\222uJm\250\2402#|!\335\352\266\333\224\036\224\254\200\310\264\224Fu\001\017\231\271\343(u\364\327\037\341\207?I\n"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\002"
+	.ascii	"T\234\3275\311"
+	.text
+	.section	.gnu.lto_busDeviceRegister.17.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 \362\225\006"
+	.string	"\242L.3Po\322\001 n\205NK\nS\030\2661\200+n\244(\257i\265\314\272\035\020\306\3762\330\022@\256\310\3144Fx\r\025\233\202<\211\315\204\321nr\247\024\036\212\223\335h\254\t\007g=\312\323y\034\007\321ixp\233g9MA\253\b\3529\211\252z.\023\357\274j`\221\027m\374\260\364h\215\371\377\346\325Zd\263\244\350\030\265,\260\374\031/.Wi(!\231\266f\255E<\002-\252\260\300\177\245\234\374Q\241\b\223[\243\t$\267\311\003\222[a\273\342\br\233p`\224\214\376\273\37404\203\265I\034"
+	.string	"\n}\314"
+	.string	"\030\376\227\201B\032n\272\355A\333\204\266\033\001\b"
+	.string	"2\003&j\006.\034\203y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006\n\177\007\013\177\b\f\177\t\r\177\n\016\177\013\017\177\f\020\177\r\021\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7841677ef6f45dd8,"e",@progbits
+	.string	"(\265/\375`\231\r\335D"
+	.string	"\332u,\032BP\246N\007E\201\361Zs\205\226?\3634\303\236y\353\233\356\265C\026h\245o\335\305\334\203l\241!U\333\361\356\261\331\003\nG@\377\017\364SB\002^\266r\031\310\247\334\255\220j\215D\353MdJ\001n\001\213\001\224\001\017\204\300\351\324\037\b\033\273\231\311\007\bq\264\365\\O\357\251Q\352\214|\301j\273_n'\224\333\367d&\274l\207\351\267\356\272@\377\337;\036u;n\007,Bf\215Y]n\207\223\347x\324\351x\235\277\377Q\026\234\216\323y\033"
+	.string	"\367\375 H\317/]~C\242\353\365\311\222DU\333\241\271\335InW\222\333\213d\037:X\3666C"
+	.string	"a_n^\2546\217\334\024\272\241\326\270\232\326\223\342b\276\222\355\n\321\245\323\306F\372\377\262\361\250\257\351\341\373O\034\342\274\262\265;\252\332$r\203\310\013\\\200\320\343\260\3039\232\3668?\223\244\3648\365?\351\316"
+	.ascii	"\200;\203\340\334\224$\233P\355\r\271\245rG\345\tn\335\356\305"
+	.ascii	"\327\274\r\270\364r\376\333\377\333\204\357\346xma\325\305\370"
+	.ascii	"\030\217\"p2\035e\241\201\356\230_\373\177\227\224\022qI"
+	.string	"\204\b\253M\314\355l\035\300\354-t\316\355\b\204>u\004\302\306y\201\017\020\252\257\017\020f\027 l\334\215w -\250\335x\306\204\242\004\030\020^\020[8\245p \354\306%\024l\350n\026\r\327\335\301n\234\241\3335t;\206n\267\320\355\023\272]B\267C\350vb\267;u\273\203nW\320\355\b\272=@w\267u7\231no\352\356\245\356\246\353\356\244\351t:\355v\255n\314\325}\324\025\357\277\030\323\022\372\365\365\0376\374z2W\r\327?~\343#\327\\F\237N(5mQ\350\373x]\207~\236\0313G]1\357\365\377\316\227\241\315!\202\206x\\\221\0277\3177,\0047\203^\312\346\352`\0253_e\023K\223>7\271)\270\3619%\033\032h\0329\237{\246\351\362\223\032\362DPp\027\366\201\227\030\b\006\303A\360\017\374\345Q\354\345\323\306\217]\354\205\223\230\013(\206\231\335\330\352"
+	.string	"\372\177\337\260\227\233\021>\351\272\374\244\330\313\343\270\324\365\2730\357oe\334\r\200\333\364\177\226D\356\377\375\202\275\374u7$\2669D\342\220\250$\350\f\320\225"
+	.string	"*\336\302J\217:\341\036\355`<L\033)\337\217\032\345\341+{\213\313\355N\302\245\351t:u'ac19\370>@\330r8K\356\366D\355\177!\376\224\245\301\252\337Q\231\2570b\236D\035\221\037\352\356G\342\003\344\367\312rc$\231\220\027\362>\217\272\264\353\270\035/P\227\372\235\363\271]\030\323\377S\r*u9N\007\370B\213\332\356\300"
+	.string	"\372\377\002D\"\021H\244\213\023CYu<|\216\347qGO*]~\203<\220\013\362\250\3639\240\3667\016G\351|\336\307\377"
+	.string	"_\271\334\3056\005\220\257\361y\036\317s\273\260\367\205\034\261\245\021\207D\"\306C\346\307OV\0333\263\373q=\217>\360\275\366=\316\247\203\311\367_\034\345\257\f\033V\033\373\310\355\001tg\210\376\244H\221\202\306(\214\226\2715F\240@aB)\002s\213\202\206\325V{8q\202\321\356\274\226\362\bi\246\351Y\262\004\243I\305\372\324\324\327\233\3221i\214&\374\233\323\253\202U|\206\307\366\224DA\203U\374\3646"
+	.ascii	"x\232e\207\260\212\315\334-X\244\215\217>h\224(\301e\371MP'\326"
+	.ascii	"\247\346A\360\342<\263\344\306Dp\221\306F\332\b.\363\260\007"
+	.ascii	"\362y\023\353\223~\030\231\023\206K\323+B\326\270,.\351\300p"
+	.ascii	"+\214\024\254\3420<\246\324\354\312\3432\206\305\226\250\244"
+	.ascii	"qqbf\253u\335\325a\025#\361\251\322\231\330_\036\254\342#G}\376"
+	.ascii	"\320\255\301j\023r\243\340\263\317\017\320G\356\356v\341'\231"
+	.ascii	"\377/$\370>s+\251=\350\356\324\255\344@o\360\300~\222\376SQ\033"
+	.ascii	"\224\257\244I\216a\265\273\027|\253\375\273M\377>s\0315s\227"
+	.ascii	"d\3564\233\336_B\340\243g\277|\315\232\252\363\361\277\357\257"
+	.ascii	"4k\336X\276N\346\362u\272L\257t\272\377"
+	.string	"o\223i\371\226t}\0315k.\243\316f\323+\337\375hrIV:\233\313:g\223i\031M6\227J\263fS\232Z\224:@\370\306\324\371\222\245\362\301\276\310\222L&\273\345\353\374\274\177\177\343zf\203\1772'3/y\304\345\266\354\300\266\340\222N\177\277\266\236\316W\332-\2618\377\261l\311\370\257\n\356k\367O\334\316=#{/\256\177\003_\377\256\277\335\377\273\377_\304$\013\307\265e\215W\253\212\246%\035,\262\003\213\244*20\200ER1!8\2561b ;X\025W\025\355\261\330\256\030v\325qmY\343\325\252bm\215G\0279\212*X$\225\200\2562\036W\254\365*w\205\013\021.Hi\025\265\024\206\t\030&\b[\n\003\024\024\206\013P\271/@\001\333(\nWG\0163\252\212T4h\024\253\220\330VkEj\247\326*#\216\365\003\213\244Bb\221T@v\312\230\265\242\235\272"
+	.ascii	"\225\255\3265\213\r\266S'F\250XF\024Xl\225p\275\262\002q\205"
+	.ascii	"e\264*\2564\220\214Y,\220\235\362\0205\242\325ZsU\224\021\330"
+	.ascii	"2\n\260S%Z\255U\211e\327\243\225U\261h\305Q\244\261\002\231U"
+	.ascii	"##\247X$\225\221\026\213\030\353\2075K\007\213\326\2105b\212"
+	.ascii	"C\211\017K-C\002\t\026#V<\265\353\325\261\330.h\033Y\353\361"
+	.ascii	"\251\265a\343\370\204\324\262k\253j\251h\215XF!\r\0336:L\005"
+	.ascii	"9\224\370\260\262Ha\033l\247\244Z,#\262\250\241\240<,haBD\256"
+	.ascii	"\222\300\"\251\236\330\343\212\303x\264z\3022\026k<U\035\331"
+	.ascii	"'\t\303\030\310\016Z\307`\257\255a0\356F\226d\304u\357|i\f\246"
+	.ascii	"\367T*ho\330\214\251L,A\340\bm\331\202\273\344\377g2\025\353"
+	.ascii	"\223\272\330[\332\223K\343.mZ{G\240X\305jx\354HJ\262\315\213"
+	.ascii	"g\305\n\316\202\027'\370\204\315\337\036,\215\263\004B\323\243"
+	.ascii	"\005\253\370\n\0363*\323\324\263\205\207Ly\201\364\315\201B\361"
+	.ascii	"\236(\201\301Uy\307\244\245a4D\301\201\b\250\2014\246\230D#2"
+	.ascii	"\"\"I\222d8Q\005\304 (!\355\006\021 1\223\214f$M\222\351O\200"
+	.ascii	"\003\377\245\310\023\231\321\263$A\224w\321|\364O\351\224\005"
+	.ascii	"\267\236\004\227\301\\\364?+\270\225\022\312%\213\370\306\375"
+	.ascii	"\317\025\212\200W(\227\303$\246\307!\251Z'\023\200^\3144v\375"
+	.ascii	"3O\216$\016\006]k;c\246\376>\314]\275\360\327c\302\355L&\261"
+	.ascii	"\035\252\035\004V3F|\213\217\364c\213\365I\006\241\231\325@%"
+	.ascii	"s\037\343\016\337\2453w\305|3\261\033\246#9oy\310\025\327\313"
+	.ascii	"\0353\"\374i\266w\3414s\200\366\310\2015\255\ty/\235\t\304\377"
+	.ascii	"\032g\276\253nz\361\210\320\302\020\341+#{\213\0076\371\316%"
+	.ascii	"x\235\222\342\211\n\205\231\003\317\330\f\236\0361\304F\275\017"
+	.ascii	"?I\221\331\321\241b\316\324\226+\013\254:\343\374\330\360\257"
+	.ascii	"I\224a\317\222|\216\245\004\337<\231\222\034R\004\314@\372\004"
+	.ascii	"NEZ\323\346~\355\205\372\241\372|M\251;\362C\2672\250\007\256"
+	.ascii	"\333\372\361X\223\240\330rN\013)+C<W\b\271\203\254\254Z\201\230"
+	.ascii	"[>"
+	.string	";K*\2014\356\332\017\\q\333\023\204\354\321l\030[\276)k\352\362TY\212\201\026\026\020\303;p\375\311\035\232\325M\245\023 ,\225M^\227\262\031\205\367'\026\037\313\211\326\220\251k\3213hS\362\310P\257&#\350\f\244\240\002`\001V\2074\235M\317\004\343$\213r\303\322\346L\221\006R\277\334"
+	.string	"\347e;G\317\277\316+\345\325I\206w\317\247s,\343\272\320\270\244-\267E\224\023\3453 \222Fm\250.\317\b \215"
+	.string	"\220\226\262\203\355\033\306L\351\206\270\306\b\277\002\235\026\232\322\033Uf\007\\\307\t\340\251W\302\213\330A\330B\344G\342R\200\273yC2\304\304\3771\317\376\267\234\207z\374F|\362\341\177"
+	.ascii	".r\005\260Yh\017\336\303\021\304\375yU"
+	.text
+	.section	.gnu.lto_.symtab.7841677ef6f45dd8,"e",@progbits
+	.string	"busRawWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"busRawWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"busRawReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"busRawReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"busWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"busReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"busDeviceRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7841677ef6f45dd8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,331 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 h\035\002"
+	.string	"\024\003\\"
+	.string	"\005"
+	.string	"\347\253\347\265\001\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\277\233\265\223\002\f\003\245\240\323\225\006\004\257\305\206\210\002\004\002\003\002\004\002\005\002\004"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 6-\001"
+	.string	"\310*"
+	.string	"\004"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\003\002\002\003\003\003"
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.string	"8#\235\001T\002\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004\002\002\001\001\f"
+	.string	"\002\004\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"\350\206\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"BD\f\025\300%\035\377\357\276\252\334\343\377\377\177}\001\323Z#\213\020\231R\372\371X\302,Kw\203M`\353\304!\021\r\372e\233b\233z\331\232\355\226H\004\n"
+	.ascii	"-\".\001\276\034\353\252\305^\241V\271e7\f6o\201\2407\200\005"
+	.text
+	.section	.gnu.lto_.lto.dbfe9fa522e8d18,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.6.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\365\t"
+	.string	"\366\322D: \261\322\001\244\n\022\005\303\203\0042|\\\332~\246\224\300G\224F@\320\033\250\004\332\206\031\352\007\303"
+	.string	"#\233\365\037"
+	.string	"\001\004\t\325\203M\261\264\222\001\340\037\b\355\331\376{\247\0242"
+	.string	"1"
+	.string	"5"
+	.string	"\236\017\324S\333NPPY\374({\215\\Z)\270\335\261\233\037\027/E\377%\227\0343\232\032\033lu\t\320\260\273\226.\330\306=o\333\3006\203}\204\323\303~gw\3273fS\211V\355S\333}\345rV\206\302\314l\253\354"
+	.string	"\333R\332\247}Du\222\214\013\354\306l/\273c\310\013\236S\217\377\324\323-,\362\216\251\247\240\231H\3505\025P\b\256`\037V\333\240\243\204\004\262\335\035\371&?\261\360AN\215\221\222w\235\372\251z*gn\035\264\033\226\314\331\343J\006\021\336i\232$*Mx\020\016\241\207:}\244.\004K\027&\360\241\2430y\247\216\004\206\235\350\300\037\252\004v\025\337\007v\036\367\235\2351_\254\325\006\207scM\r\177\345\266\007\017"
+	.string	"]\325[[\224\227\025\203M\324\336\013\016\030\302\252D2`"
+	.string	"\306"
+	.ascii	"\343B%\007b%\340\\\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagSet.7.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"M\n"
+	.string	"v\022C:0\221\322\001\200\214Q\204\341N\324\203K\253\336pq\267\027\315\255\220\206\374\305uf-\326y\033#\257d\177\323\266\32400\250\260\355\001\267o\360)\244\246^\217x\262\311\336)\0050"
+	.string	"1"
+	.string	"2"
+	.string	"\247\004?\350N\345\013\272S\213\366MB\207\200\215\307,gw\353$\271x)\372gy@\313\265\272\004\210\330]\313\226\013\344\236\267\255`\033\302\376(\276\354\357>\376\334c\277\364\006p\020j\273\037\267\235\265Q\232\023\333\367\330\262\332\303Hs\360N-\245}\225\257\210\217\251LwE`3\273\013r\203\027)0\016t\230\027\0359m\177\356\2422(\331]\006\177\366\226\013\337\344\324\031)\371\326\251\237\352N?(\260\020\226\274\331\343J\316\021\373\334\356\256\347\313\001\033O]\343\026\205H\024\337\204\004\352;\231@QE\205$\214R8\252\025\245\317TE!\252\206\026\f\236Ha\265"
+	.string	"\301\260z\306\375|\231\326l\254\311\341n\322.\023\343\232\031"
+	.ascii	"^\251'\023\260\354\315\300\003\021M\030`\034U\016\rk\270\013"
+	.ascii	"\206\240\031X\016\304\322\024\003\260;S5(.\f\3450\006\230\003"
+	.ascii	"\203\201A\200<\200Y\201\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_fakeMagRead.8.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375`\034\001\375\013"
+	.string	"\226\026Q@ O\225\016\240\275\301\n\f\004\223`\211\321U\214\357\330\342\213\201\222\347\3608S\220\032DRn\263\bS\032\376\006+D,c\314F\030"
+	.string	"\330(\225-j@\273 U\352\001\221u\220%\233H\231R="
+	.string	";"
+	.string	"?"
+	.string	"\033+^09t\374"
+	.string	"\354pr\001\330\241m'P \362\367\270q\272\264J*\030\2731S\016\377\236\237\377\020/\320\001\262A\305\n5zJ\030\354\256\323\204\312p\353m\033\260\235\261\257\0219b\307Q\252\206\375kw\327\232\262\037\177x\245\365J\347\225~\206b(\205\020@\261{\032\211\261) \253\203m\221M\261\2551\264\002\223i\377\303=D\007Q\341\001vS+\221\r\367\t\354P\025\363\321J\365Id\345\253\021\251\230\017\017W?\344\303\001\330\340\360C\330a\252L.l\004Wq\223\335\275\370\"\0162\301\3478\264\007\312\233\016}\020vxU\026/4x\260H\001\332G\313p\264M\302\3216\265\306\262\201\240=h\340i\236\215\323d^\267\241\320\351\034d\022:\332\226i:/\263\0340\347\331t\331\207\343\272\214\022\367\327j\352\037\026\241\343B\253\005I-X\325g]/q\021\023\001\027"
+	.ascii	"^\325\203\232\320C\005\376\324](n\305 \202\355>\241=h\n4\006"
+	.ascii	"\220\203M !5\024r\356&\374Pua\271\006JL\340\240\020\\\006F\020"
+	.ascii	"\240\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagDetect.9.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\205\t"
+	.string	"vRD< \005)\035'5\317v\215\261\017\220\260\033\263jN.TL\2419\211F\363Ry\246\277a\273\351\206\207Lb\266X\327\217"
+	.string	"\001\001\2134)\002\235\343i\242 \267\205,\343\266{\247\0241"
+	.string	"1"
+	.string	"4"
+	.string	"\334\251m7<\234,~t\255\216B2\"\263\355\216u\252\\\274\024\375\273<\3415sC\233\261P\227\001\024\273k\251b\225\334\363\266\025lK\330\016\020\217\375\222:\254\255\206@\333]\335"
+	.string	"\254\r\255a\261}\333'[\300\266\224\366[\016;=f:\301n\013F\263;28\342s\352\361\007\334\351\347\005\001\336e\337\304\211\216j#4\300\331M]ew\034\346\343\263\273\020\376K\b\310\200k\345\3247q\247\263&\023C\233\231\244\344\315\036Qr\246\330\367\354\356z\266\354\030\2357\035\002\211H\335EE\330\225\274/TCP\3441\002-\252\306\250\363j\b\f+h\301_I\004V\216\357\003\253\307\275gg\313\027\271\214\227m''5E\354\021)\n"
+	.ascii	"]\325\353Y\0241b\020\231PA\221\237J\344\2533\216L\020\275\313"
+	.ascii	"\304\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 su\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\005\f\300\204\001"
+	.string	""
+	.string	"\003\002\b\177\r\002\007\177\016\272\220\202\002\t\177\017\272\220\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"p\003\013\001\351y\020\032E\225\001"
+	.text
+	.section	.gnu.lto_.refs.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.dbfe9fa522e8d18,"e",@progbits
+	.string	"(\265/\375`\263\030eu"
+	.ascii	"\252\275\f*R@PJ\352\2326\227\240\305\347\214\215l\"\342\245\276"
+	.ascii	"\333\257#\324\226V\357W+\221R\345ax\307\371P@RB\032I=\004i\303"
+	.ascii	"X\020\030!\210|\237\315\031h,\367\330\036\271\035\006\241\352"
+	.ascii	"o`I\253\363ph#U\277q\264\003\304\220\334m\313\224R_\002\201\002"
+	.ascii	"\221\002\270\037\f\356\247\303\236\341\360'o\312$)3f\r\367\237"
+	.ascii	"a\017a?V\203\206\r]Rr\351S$\025m\314Q\023,\214\374\031\275-p"
+	.ascii	"@\242N\270\237\t\213x%\356~\343\027U(\223\271\266O\237X\023\203"
+	.ascii	"\225\350\225O\373\211\370s\373\r#2\256\210\301\021x\216:\346"
+	.ascii	"\371\341F\210\223l-\2071E%udK\235\024z\324\244$\306\303\250H"
+	.ascii	"4h\210\241\303\355m\270\3335\314\313f9\252\337\271\033\016b\220"
+	.ascii	"\312\260\3279\027w\272]\267o\361\271N\275\226\271\231s{s\213"
+	.ascii	":\324\312F"
+	.string	"\250\035|\204\332\356\205E8\b5\365\034U\213\216_\311\340\272\252\302q\356t9o\353\264m\t\272y\344\334\315\341nW2\347(#&\274\322\234\374\200\356x\217+F\266\024\256\333\331\374\351o3fZ\224\260\336\272=\213\253u\331?\333\235\023\364S\033\227\201[\005\334>\370\227\016BU\200\371t\020\252Wq+\3564\300\257\\\242W\207T\207\032\220\252O\273\004\334n\200\352Q7@m\020\260?\245\244\005!\343J\3734\r\215\346L\256K\\Y;Z\267\211\023~f\223s\001\227\311f\006\346S?{\217\3424\264\237\271Y\2338\3216\307\274\225s\353gi\316Ew\004p\334\021\340\245\025)~\251iw\200\373\213\223\331\2541k<\221A\301mHbP>u:\024\037\353\316:7O\324\240`>m\fp\267?\tK\201\030!\323r\342b\302&*\320O\333\305\272\275\365.\017\363e\316\307\234\363"
+	.string	"=%\264\256\263O\335\313\277\334\031\302\233\2643q\260\346\025\333\334z\027*\243\362S\017\016B\355\023\270\275\331\003\024\363\211~\354B\316\036B\365h\324C\250\0218\bU\365\034\325\231\360\264s\345\250I\2466w\270fR\216r\370\364=G\365\255\020\027\231\264\314a9\267\037zYQ~L}\332\255\203P\261\347\250\\\335\356\304\244\333y,\261\351\276-\350`\315t\337\024\272E\253\335w\205\216\322\335\275\356{B\267/\351v\255n\307\352vf\267Wu\273R\267/u\273Tw\207u7X\267Ou;\220\356N\353n'\335-\326\335[\335\355\241\273\257t7/\032\215F\273\333Kw\n\242;"
+	.ascii	"\030\0024r\335\247Z~\313\333\340\316\237;6=\233\026\363\347>"
+	.ascii	"\310\307\345($\314\234\363\334/\275\332m\231\275&nL\354n\016"
+	.ascii	"%Tap\332\022\304\321D\311\320C\356\337\036\316\235\037\367Y\372"
+	.ascii	"\251|\225\270\333\232\341\032_E\354x\342\276\206w\243\371\252"
+	.ascii	"\372,>\346\346p\332\274\"\270\335\331t\337\326uC\260\350X\362"
+	.ascii	"i\363\250p\363\236pK\300\366V^\211C\364\220\215nJ\2309\267Ow"
+	.ascii	">\333\257\335%\347\031\024\023\306\342\316W\373+m\342\304\226"
+	.ascii	"\332[\251\211Z\342t[\260\234\322\264y4p\363\212\330u<G}\242\016"
+	.ascii	"\016\223\r)\355\247i\217\326t\005\030\221\271\370\364\300\227"
+	.ascii	"\034'\305\235\237\326/\327\264\325\226\246\235b\301\235J9S\276"
+	.ascii	"\233Z\222\321\fw:\206\311j\234\264X\375hq\373\226\222\237\371"
+	.ascii	"\223\351\202#e\300\336\371\315\177\362b\357\344\303\036\312\177"
+	.ascii	"}\023w\376\330w\265{\361/\255s|c\215/&\273\244\257\361\205d\276"
+	.ascii	"\214?\372\0328\242\220\354\336\006\216WZ\020\035{/5\252i\354"
+	.ascii	"\227|\213sl\2632\0039\007\003u2\025\034%gv\030}\330\345\\\203"
+	.ascii	"\227\031\363\350\033k\276x\370\326\330\347\370-\1772y\310\307"
+	.ascii	":2v9\347\035\235\035\234\266\265\267\035\002\244\235^\341N\251"
+	.ascii	"\236\253\003\030\024\023$N\317D\007\326z%\237\304\235\2775\266"
+	.ascii	"\365K\357\003\207\370!g\251\034\230[\337\364S839C\205a\376\326"
+	.ascii	"\007\371\254\027(\250\313!vvvf\320\214TNp\332\276\365Y/\344\253"
+	.ascii	"p\212mN\23207\303#y,w~\326_\365\337\370\027\306r\316\375T\335"
+	.ascii	"<\237\3651\370\031\016\261\3158V\320e\275\fo\305n\331\321\331"
+	.ascii	"\331\2311r\304\r\r\247\235\332\260:r\203Tf\025\307|#4KLO\264"
+	.ascii	"O;e^(\376!O\304\235\f|\221\037BF\354\213\013ng@\275\321\2503"
+	.ascii	"\240\366\325\202\373\252\3416\273U\200\270\363\247^\252\371S"
+	.ascii	"\357\364Q\376\f\353Y\203\332\245X\242RR\314p\232u\004S\373\364"
+	.ascii	"\177\374\322\235\017\365O\371\346\246\256)\355\252\t6\352u\232"
+	.ascii	"\332\227\013\367\325\372\036\356|\037\017C\353\2649\207\371x"
+	.ascii	"\035\317\303\237LmVr\2451=\224\2409\267:;\035\256\350\334\250"
+	.ascii	"\244i\337\027x<\023\r\224'h~\246\337!\005\003\031\270O\373\316"
+	.ascii	"\300}s\316s\037\321}\343\327\023\350\356\264\273\017p\321f\342"
+	.ascii	"\027/^\260UY\261\207\210<\"gb\022\331\204\"~@6\213\031\351|*"
+	.ascii	"? \333\3744@nJed\273$\246K\342\3476\037\241\224\371\270$\022"
+	.ascii	"!\333\234\314\355\222\350!\037\225\036\220m\221\210lB)\035\331"
+	.ascii	"\\*?\344c&\346c\361\t\037\227J$\226\245\322\003\262YT\"\217P"
+	.ascii	"J\317\3552{\r4\264P\304\243\334,\336\344\234\223Z&\321&\347b"
+	.ascii	"2\023\333\336F\206\262\263\221\235\262?\223\264RY'\347L\f\223"
+	.ascii	"\213Z\316\264\306\374D^-_\034\345,\227mL@t\342\214l$z\316Gm2"
+	.ascii	"g\343\022\005&\3172#\231o\362\261\230d\214Z\332\034\031\2273"
+	.ascii	"\362\325\223+\221\315\250%O\224&Mf6\266Dgf9\250$n\022\333\034"
+	.ascii	"v\303Ms\bSR\020\245Ci\021\2226u\201(A{\233\372\364Jux\362\262"
+	.ascii	"r\372\264{9\260\337\3408|Y\321\t\3636\275\331\223)\300\210L\317"
+	.ascii	"\304\354\324n\223\327\3406\3703,\3552\346`\267\351\362p1\177"
+	.ascii	"R\245J\310\354x\256\215\373\202\027\256/s\223\n0\"?X\013[\336"
+	.ascii	"\036\367\351\372\270Q\027\352:\335\037\027\006w\336&\037\353"
+	.ascii	"\273\3432\255\335&\247\363.T\236L\271MN\305\261(\201r\233n\216"
+	.ascii	"\253#\005{\202\331Br$9\006+\200\264U8\214\343r\236\243\336%\232"
+	.ascii	"#d\232SQp\253cW)\211\023C\025\225\247,\254\274\311\2324\252\256"
+	.ascii	"\034\027G\337\344\315\262m\006\260O\357\r'Sj\362D\372\223\231"
+	.ascii	"\27376\252#\370\026/\3301I_\032\356\2745>zk\334|\221p\304\314"
+	.ascii	"\272\254\331d\2440QR$\244\337\270a\207\374\364\316\230\301\222"
+	.ascii	"c\251\312\247\255\032q\367\225\341\316{\324u#\236\254\224>\355"
+	.ascii	"/\367\370A\336\270\210\271\307\276\306d\006\343\361\351-\366"
+	.ascii	"\352\224m^w\370\022?\372O\305,\312:\334<,\270ySp\016\352r\207"
+	.ascii	"V\322\023|\374)d\321\237\022U\326C\t\nu\034\236\213\0200\177"
+	.ascii	"\303{y\034^\314\217\371/\037\306\235\017\375\035`\240o\367]n"
+	.ascii	"W\022\203}\261\331\225\201\276\322\025\350\347\3709\242\273q"
+	.ascii	"\365P\202\372\026\r\177\346d\006\375(\177\246\266\263\243s\323"
+	.ascii	"E\312\316\n\200t\304\337\315\034\333\334\234\201\273\241)\314"
+	.ascii	"\0137o\006.\375\035pi*#\023"
+	.string	"\263\301\325E\367]6\004\354\317\312\2567\354\312\202\346\307\376zvX\240\212\232\376\001\n\327\340\032\204{\002\n \240\240\002\243\036\333/H,\020\004\376<\b\372\t\365R!;\302O\260\250\003\240\337\272\"\350\247\""
+	.string	"\240\337*L\373\005\t\341\n\003(\370\373 \207\r\272\370\241\357g]\201\342\003\2205ZS\226\365\231\220 H\250A\n??\037\0300~?5\254O\204\024i\0208Bp\370\243\262F+f\215\326\233\341p\025\002\001\375z\375\202\004\b-R\260(\301\256A\302\037+\202\035\256l\312\362\\\024m`$\344\305X\201.[3,\362\251Y{C\037\220\210\205\213\265\307\227b\004\0265\353O\360\307\016\203\300\"\f\264\256DC\336\032\004\304AP\020\b\364[a\324"
+	.ascii	"\211\206w\350Ca\"\305\260\310\007\2430\221bF\3751\001\274E>!"
+	.ascii	"\206>\025\303\"\237\233\241\257\2075Z"
+	.string	"k\204+;\374\t\251k\214\037\f\026EDB\270\3107,\362\231\321@E\317:,RY_\005l\020X\324c\203EC(\326\037`\214\025\250\306\250\005;\364\t\207X\"\240\360g\270\366\300X\203\301\337\013\024?! \001\214V\374\204\200xF-\\\254=+\021\013-X`0\205O\003\025=\035\214V\260\300 P\035\372\206E>6A+\013a\321\017\315\260\310\347\256\276\237O84\f\256C\0346\270\n\005\203\20004\b\372\t\331\260\375\202\304\360\005\373\023*\021\034\022\022\032\372!\240\207\210Va\tvhHX\242F\310\207>\037\221\213\034#\240\220\375\251\b\016\001\331\037;$\304a}A\277\026C\300^\320\257\005\2205\342\200\r\246\b\372\t\335\300\030\032\332\300\307\033\372b\254=A?!\314\372(\340a\203\300^\363\360\240\020AB\b\036\340\037\022k\n?\027\276\341\217Hh\350\247\304P\270\306"
+	.string	"\n\201J\004\201?\241\022?\302a\t\022\r\264X\035\332*aJ\\\267*\355-\352\355\323%KnU"
+	.ascii	"F\230j\2218\271\345"
+	.string	"\247\215\221YYW\313\241,\231F\3204\247\220\301)\351\253\365n<\322\216\237\336$\036v\233KjM\237^$\0366\323\305\306C+\f\207\351\205\b\221\314\221#\027\013G\362\252/\326\325\212\362\214~z\255.\221^\362\216\206\251\336\035\323y\231.\366m&\322 \231%\263\003\335{\303}\251n\f}\205t\267\220[\205s\316=$\2731^\240\231)9\242\373\026\351[e\243%\t\335\335%2\300\326\035\327%r\207\250\\Uf\260r\245ff\004\201\312\361\335j\316J\2746'\2156\035\201\366\250\201(\311\020D$\"\"#\222$I:!\005\204\030\351 t\267\001\021\360\250\203L\325\210HAR\220B\226\335\346P\313\267\0337\356\276\276\277\333>{\024\322\036C\306\311\326\272\214\337J\272\264\246\f\260DN\263`\243\372\\\023T\205\310\303\235C\213\210\204jZ\035\246\337f\007&\344\350V\254\321\216\356"
+	.string	"\306{\311P\364\241\236\267\202a#\216i^\356\226*{\222!\361DK.\326Y`PLf\3067\217\204\245`8\210\334\213\272%\002\236\"un0E\305\274\272\3046i\312\315\333\251p\210\022\337\t\260y\2460S\202\212\273\312\031\237\260\205\005T\322\005\260\211\033 \203j\312\221\226\252#&\024\364_\270\bx\364\242\313Bx@\217\243\251<!\313\017\023\017\225\212\001m.!\305\251w\201*\365n\205\356@\352\334s\202&\350x-\302\367\007\214\365\367\033\365S\224\261\314\327\221\006\264\304\323\213\214>5\223>\032\032\241\263\211\037\020\035\333\334gN*\312\347\227'b\212#TW\264\376\"AxS\224\371cS\327\267\022\t\177&\305\022\347ITa{\022\300\350\232\\\007(\\\347Gm\302\2272\002\220Ua\260\341\250\246\242\362\007\343\353\242e\355\231\350i\f\330\253\017\223\244\023"
+	.string	"R\377\035rR\300\237\3617\035\036\266\345W\272\202w\305\314X\024\256\304\203\206\024\2640\265"
+	.string	"\344Q2\320\361\034v\243\0069]\202\"8\344\352F\271?\232\334\365>J\266y\262\224\030\3277\253\004\232\214\270\002\300~\257BF\020\252\217\251\034\351\3621\216-C\277\227\\]g\023v\203;,\026\331v\315\265W\227\212G\022k#\203R\275\317|\254\211z\221\235\272@\221r\344\016\304\241d\236B_\241\226\241\260\302T\026/\346\320\223pdn\231\030G\266\031\361\220\224/\325S\237C\202\303t\0220\007\210DIP\316~\344\007\224L\215\bt\2250\177\t=\310\265,B\237q$ ^F\3511\302\303\212A\240V\333:\275h:\r\022I\331MB\202?\332\016o\026U\353["
+	.string	"]\035\353*\215\213\357\343\031\266F"
+	.string	"y\024\256\2434`\007H\276`k\343\257\316Y\345\021\016[G=z\035\035\033\005\030\0219h=\021\376-o\321m\"1s\032\016\243\303\310\202\243&9^2\313\363\341VI\240CrS\236\374\021\007?\022\241\017\332D)\361\317[\211\215\361"
+	.string	"\347\303'q\270\355( \234p\f\b\332MHXx\255\256V\311bj$\2462P\304\351\202"
+	.string	"\200\2460O\352\252f\037\177xM\266\023fd\027~1Z\335\313\303L\023\1772\302\371\377\317\217\361\306\226\341`\344\272h\266+\207\342\bF\210\031Be\033\336M\017D\234*V\317\372'\247V\246# k\201_\244m\037J\035\312\017\367c%\223PY\r\252k\020\360I\002\351?\2547\023\356\322\352\300H\242P!\252\260\240\033\363B\235\330\320\210e\363%<\211\005\261\245ci\021\333p\307\030\243smvE!yA\234\352\026\3111n\211\251n>q\210\017\374\002\351\314\320e\b\343i\211CNy\227<\222\261W\327\212\347r>x\0330\300\017\350\276\253\222\303\3005\267\343,\341\205\254`\237\373\035\337Ib~7\3416\026I\227\323'(H"
+	.ascii	"v\237 \370\302\b\301\377\n\222\316\001\003\336e\312\231\215\251"
+	.ascii	"\240\2444!b\004\007\365\033\310Y-Z\342\366\201qd6?\371I\202\233"
+	.ascii	"\007\204\250\343\276\344a\336\303F\336\240\305\213]\f:[\025{"
+	.ascii	"\001\226~\317g\311m;\316>\034;R\343\346N\251R\031.2\265\262\344"
+	.ascii	"\227\310\031\373\212A\225\366\035\241k\0015!Qc\300\300\371\347"
+	.ascii	"\002\310\353\243x\261\331\025\344\236\365\037\001~\335\314\222"
+	.ascii	"v\307i\006\355\"oVb\225\3614J\371\351\373[Y\243'\234B\216\327"
+	.ascii	":\375\016\373n\301\305\300\260\263`&0\203\024\230\243C\252"
+	.text
+	.section	.gnu.lto_.symtab.dbfe9fa522e8d18,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dbfe9fa522e8d18,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1168 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	""
+	.string	"\006"
+	.string	"\007"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\022"
+	.string	"\023"
+	.string	"\024"
+	.string	"\025"
+	.string	"\026"
+	.string	"\027"
+	.string	"\030"
+	.string	"\031"
+	.string	"\033"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\t\001U\013"
+	.string	"\204\021\375\001"
+	.string	"\034"
+	.string	"\300\320\222\371\005\004\002"
+	.string	"\002\001\002\002\002\003\001\320\233\373\266\b\f\002\004\002\005\002\006\002\007\002\006\002\005\211\263\377\241\013\b\b\002\003\002\t\002\001\002\n\002\001\003\273\352\374\254\004\013\002\003\004\252\343\367\225\007\007\002\f\002\003\005\247\374\320\355\005\f\r\002\003\n\006\302\264\200\023\b\007\224\312\272\240\r\006\b\213\314\213\214\f\002\002\n\002\007\t\340\337\203\343\005\004\002\006\002\001\n\257\346\362\241\006\b\016\002\003\013\305\351\254\360\003\017\002\003\f\301\343\227\272\003\020\002\003\r\336\365\267\361\r\016\343\343\317\210\017\212\251\337\324\017\021\002\003\020\322\317\311\210\n\007\002\022\002\003\021\305\350\206\363\f"
+	.string	"\022\211\271\240\321\r\023\301\211\376\332\t\023\002\003\024\232\204\335\302\b\001\002\024\002\003\025\316\317\375\341\006\025\002\003\026\340\266\354\313\004\026\002\003\027\257\257\332\372\t\027\002\003\030\302\316\266\331\006\021\002\003\031\377\271\306\315\005\007\002\030\002\003\032\251\335\330\277\017\002\002\031\002\001\033\255\250\234\371\b\026\t"
+	.ascii	"$ \240\002\021<\356\020\0042\216N*\016\002\024\002d\226 \263"
+	.ascii	"\333\353\210\317q0N`|\341\334\032\005R\025\nRn \306-\332\223"
+	.ascii	"\323R\304 u)Xb\211\240\355\203\246p\313f\020(\325q\001\327\300"
+	.ascii	"_\222\333\023\361\2548\256\262{^\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\273\001\245\007"
+	.string	"\342\t\033\035\2009\35130W\351\031f`\006f`\253\265\025\377\300\177#\342\r\366\211\021\273\267L2\234$9\037K\267>\250)\324w\3308\262yQE\023\217p\034jf\206\266\005\245\314z\302@\260\004J^4i#\212\\\242\267\204\213\023Q6\200\251$\3159\322\237\376u\233\374k\251\353\231_\251N{y\214kI\255\025Y\353\023b\037\001; \240\002\0319\342\r(\312\206~\221\373\0064\310\256\304o\004\344\003\024\211\363G\202\006\366\216\260\214\b\217\260\034\301\267\206\314|\22030\262\001\240;\214l\207|\005\240\234\365No\341_\234\n\035:Z"
+	.string	"\344\212\005(\026\214!\234\270?}\b\315^'\2113\340\001\016\0012\003\342"
+	.ascii	"d\334'\262\301\215B\001!f`\344\033\027G#\314\322\303\234S\023"
+	.ascii	"_Zn\257\322SF\343\nL\\\006O\034fcZ\030\002"
+	.text
+	.section	.gnu.lto_.inline.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\336\b\205\030"
+	.string	"\246\340hB\020\257&\215\001"
+	.string	"\202P\235\310W \375#Y\b\315>\030g\307C\001\360\023ox0{\031\367=R\250/b\250\265\300"
+	.string	"\200\003ED\231"
+	.string	"\004\220z\234\001\362?\037(\236\217\326\326,!{o)e\nK"
+	.string	"U"
+	.string	"^"
+	.string	"\257\251\033Q\0261\306\316\252\340\272V\313Z;\207\324tUm\365\231v\316\270\235\024\366\017\315<\343>@sw\216\254)\306\3109\177l\323_\003\272\335\352@s]5}mc\214\021\272\337W\363<C;\303bA\205\347A\326\240\b\225~\202\336\032\221]v\362V'\262\272\006z*\221^\362k\315E\2101\232\374+\240I\261\354\271"
+	.string	"\022\320\007!\222RQ\212 \245\243\337\tZ\t%R\211\352\212\372l\251\205pl\263\334\233\036\244)1F\315\222l\374>nl\313LO\304\0307\357\330\226\361\016\001\306\266\rh\246\002H\224\022\311D\347\016\205\251'3\023N\027slP\036g\356\351\216p9\255Xo\214m\032\256\262v\231\276\310\244\330\340\266B4EY\322\002Ct\224{\2064\252\254\264\330\234\241\037k14\027s\341\321O'\323\267/c\316\330\326\241\351\354Vyi.\t\307\233\177\003\347\232\232\264\002\355\305\207\324r\t*\323\236%  \002\035\245\236$K\342T\322p\375\251\006\255J\013\013\007\2144q\203h\314n2\200\007t\264v@\201\301\300\371\303\275\307\275\323\266\002\nL\206\315\356Z\335\005\237\246\210|*\032\002|:\332yH\371 \323\261"
+	.string	"x\201\344\262\202\263G\200\252\250\001Q\305\020\ti\2222Rh\f\220\002\031\021\242\272\r\022@T-F\322\030a\206\221\230\t$\222@&\230\214hA\r\007\303#\b\221G\303O\2478\2238\\\212\233\\\207\025\206x\025\250\316gEV\024)!V\001\016\037\267y\346'BBGE5p_\346=\204\327&\325\323\026X\213DE\267\222\364X\331\257*\024\225H\035\344<\334\027K\250\351\032\317%A\230\021~\260\301\220\224\371Sb\314\260r\333\223\344\272\333\305\252\310QY8m;\033\231X\325J\373\252_\361\005\254\203%\002?ATDN\307u\335Pl\274v\016\311\365\002\236\303\375\002\325\027\366\367\235/\3122\2578\370x\026JA\321H\032\242nT\305\213\263\251\304\t \260\255\245\200\027\301)\026'&\377l\246\337c"
+	.string	"r\200G\257G-f\3402b\021{\253\026'\t\260\347$\214\033B\232B\002I_D\206ps\035\303I\277\352M\366\204\207\224c|<X+oz~U(\341R\247'\322\304\261Y\262T\2037,G^\004\242\354\031\244}\360\031\263\277Brf\221J\np\357|\365\242\324\007\275\213\266\210\200f\260\221\210\212@UxD\246d\262\303\276$\362\204\257\201\301\031\240"
+	.ascii	"xY)\322}l\252\304\222jJ\021\205\033\341\272\374|\nWN"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\300\003}\n"
+	.string	"RM(*pK\222\016\374\377\377\177\360\2647\022"
+	.string	""
+	.string	"\230\252\252\252j^ \221\353#\210CH\244\377\377\377\277\255\265\255\266\244\265Md\332\001\005\251d\\\365\006\343\361\225\017\354\205\303\254\363\rV\210\\X\206\005\013\205k\035\221P\201p\375Pp\b\214\003\326\230\206m6h.h\236<\t\320"
+	.string	"\345\211@\300\025I\256\247#V\343\004y\354\222^\"\307\036;\253\361\037"
+	.string	"\004A\fG\365\374\202\354\312s-JJ)]\327$\370\254\344I\304ZX\312\363k\325\375`XUZ\245\266\312u\325l~\276\036\312:\002M\250\001qtC\013\nk-\007\240\002\th\256\346\001\022`\303$\204\261\020\003BH %\262\3420L\236\271\031\224\311\0261\023\031\351dy\346\235\371ysm\274~0H\232A_\361\375n\247\302q"
+	.ascii	"\272\216{\363\342\fs*-\260\303UM\355\2227W\023\217\030`\324%"
+	.ascii	"w\370\302(\252\356\375\302\362\207o\234\263\332\276\f\206\264"
+	.ascii	"Eg\300\275,OZ\225\273{\334\235\363\023\311\322\332\341\034\023"
+	.ascii	"\373~\251\246%hl\311b\216F*\203\223\377\266\306\033\367\203\356"
+	.ascii	"\333\322\013e\217\322DZ\003Z\025\236\232\033\336.\346\037\326"
+	.ascii	"\312\335_="
+	.text
+	.section	.gnu.lto_.pureconst.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375 Y]\002"
+	.string	"\222\305\021\033pm\032\003\002\203\002U\325\005"
+	.string	""
+	.string	""
+	.string	"\373q\222$I\222$\021\335\204\222\b\221\001Nb\2128\304\037\356\360\2063|\341\nOXA\370\301\r^p\202\017\234\300\005\034\300\0249\310=\316q\275q\214[\274&UE\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\276\003\225\013"
+	.string	"R\314*0`M\323\0010L\016A\3403\tD+\204\204#\030$\f\003\033\001\203D\200\207\2728\372\355\241\001\330\204\225\376\b\031\372)R\214\245\250\355\235R\n\205\037!\024\223\356\245-\220\253\255\214\321[\247\337\201\320$OD\207!&\017\221\003G\303\006\203\306B\206\002\225P\322#`\274\311A[\033`\005X\323\013\0234\231\305"
+	.ascii	"\345\245)\227&P\335\321\351\200\353\256\257\277\3233}9S\341\374"
+	.ascii	"\216\242\365=W2m\311t\005\372+\335zE\352\276tV\333\325\341s&"
+	.ascii	"qw\002\304\343\256\251\273\323\033\033[\327mw\245\277O\001Z7"
+	.ascii	"\022h\250\001}D&\252\f{\006\260\002\021)\252n\021\340\240'\216"
+	.ascii	"\210\230\210H\234\\\333\r\206!\301\344G\244 \316\006hM\333\002"
+	.ascii	"\021$\217\205\254e\266\330\ba\214'\343B\372\331O\204N?,\1771"
+	.ascii	"\331Q\204I\f\363_\023\324\357\253\250#Y\270\025\205\251+\244"
+	.ascii	"\274\301\"%B\006\026F\004i\252\312c|;\300*\013\254#\274=\031"
+	.ascii	"\376\025\234*<DC\347\312jA\220.\034\f\263L\315\025\267AXlDx5"
+	.ascii	"3d\213\276\270\021\021\0271\210g\033\304\t\034\246\351,\361\323"
+	.ascii	"\241/\261p\301\344\b\344\n\25064\320y\224rq\236\225\360y\320"
+	.ascii	"\\\2260\356p(\212\337\026\342C\233n<(\225\002\255\270)"
+	.text
+	.section	.gnu.lto_.lto.2947b4c9fc6edab6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"\335\013"
+	.string	"\306\326Q@\020O5\035`\032Q\001\007\224D\252\341\016\333w\350\323+\220\207|\320\300\252k\022\235k,\"\2165FE\365h}"
+	.string	";C\004\200"
+	.string	"P!{\250\227' G\345c\213\256\241\257\357O\233\354\235R="
+	.string	"<"
+	.string	"C"
+	.string	"'\315;vI*P\354\216\t\214 ;\365x\001\330iv"
+	.string	"\330\251E\373\005\001\217\206\352\223b\355n\235\033.^\212\376C\034\002\022m.\037\fv\327\022$\252p\317\333>`{\201\3750\0367rf\260\177\355\356z\222\354\243~\372\323\177]\322rJ\037\322\3403\"\300\212\335P+\306\256h\212\016\266\037\261-\307\203\020\217\222pql\007CHAvj\340\272\264_\272I|\034f;\270\tn\203E\325\300\202\301\221-gH:\257i9\035\271\340\231\033\333\226\227\360\262\335\316\304'1\001B\210\235\3129\240\205\301\213\b\263\335\235\370\251L\204\214\203\006;\375\274\013\017#\323\211#[\016`\347q\230\213\367\330\264\216\202\001;.\263&\t)\017. W\251\340\267e\270\257R;\216b\251\332\007VI\001{\227\355\253\030\317\373jd\334_;I\246\026V\234I\301\3427\314\326~b\233\252\017\243\322\037\023"
+	.ascii	"2\241S/0\\\020\224\312\207\364\366-l\214\251rQjGM\007\\-D\203"
+	.ascii	"\t\301\\c\213a^\020>S\243\340\26245:\334\341E;\311"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"]\t"
+	.string	"\266\022C8@\217\322\001\320\036$\234\212~Nxu\210x+\331\351\325\036\234@\203\253\370\257\376.\332h0\032\303\331\250\227t\f\023\353\220\230\301{\013\256\270\343%m\362\367&r\247\0242"
+	.string	"1"
+	.string	"1"
+	.string	"\227\333\005\346\245m38\244\254\"\260P\027\225\013\331\313n\310)\307U\217*\377\"G\220\265\270^\253\307\f\304\356:\272^\031\267\336v\202\355\006\3331\001\n\363|\354\327\264\350\250\321\317hR6+\273\0303\230e\221(\037\266S\266\306v\214\366A\036\222z\f\365\200]\230\311\311n\270`\205\355\322\34173\272\262-\272\314\333v[\035\277\204B\3424/\243\032\030<\311i\333\335\216?b\232\330<.}\324\274\274\016t\304Xqf\207\253\250\033\366\265\335]\007\241\317\310S\002G\335\346\017\347\344\211 \201\035\210\003\277\220\251\373@\334\250\363\210\270\317\007r\234\002{\244\320\307\225<\357\3434\341\336S\017XZa\200\250\251\243N}\320h\005\n"
+	.ascii	"2\003\302\260\013\314%`oJsM\031\313\270\214\n\324xG\016a:\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\225\t"
+	.string	"\246RC;0\345(\035\200\213'\005X\370\213%\221\317\242\227\256\320\303\211\207\234B\030\247\346\033\333\307}\256\305\006\2431\033EM\377\214\b\022\004\222\220)'p\333\r\225\241\342H\333\233l\231R2"
+	.string	"/"
+	.string	"2"
+	.string	"'\240\r\023\241\221\215"
+	.string	"\330`\021\260\273\033\347\006\3632{\301\274\214!\007\257\240\377\224'\274ZV,\3245\003\261\273\326\025\253\343\216\267\255`\273\301\276@\341\237E\265\252\372\231\001\220\rl\227#6`\003\310\227\022\333\240\255\261}\265\357:\n\370\360t\202\335V\214\313n\310\340\005\355\322\241f\3337y\036\252\210\262-q\230\350\205\321]\314K\215\b\246\370\312\247\355\252\034|\025S\205Fr\351\237\346\345\343F\304\225\322\230\035\2424~\330\3176\266\354L=\037\241\317\310S\372F\234\346O\307\3023A\3728\320\366y!\023\347\201\266\021\347\021m\037\357\333:\007\356H!o+u\235\267i\302\275=#'\0253\254\321,Z\343\214\017\001\r"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\3062\327\360\207,^\003"
+	.ascii	"&\036\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.6.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`3\001\345\f"
+	.string	"&\330UB \217\232\016\340\007U\264\fF\003\f\013\306p\331d\013\342\200\022\206\231\003!\241_o6\304G\246?\3425\030=6\373A\230\022#\0020"
+	.string	"E\b\304)\255&\016\361\227/y\211\266\263\311\356&eJ\001A"
+	.string	"<"
+	.string	"H"
+	.string	"g\371\007\356\"\222\017\330\r\271\274\354v\034N\020\377\334\275"
+	.string	"\374\213'"
+	.string	"\377\314\331+\f\240d\250\370\264\274\330]J9\234{r\376A\034"
+	.string	"(\305\363\234\026\354\256\023\224r\341\326\333F`[\201\375\227\177>\t\374\273nTVD%9\262;O\352\006\373\322\356\2565d_\364g^:\302\364\004\323\360\245\237\224\2262\255\232\316L?\200\006\206\r\026\273\026F1\026\346\235\360\240\261\375\264\003#?\205\312\361\211a\360\022\037O\017\260\254\b\310\277\202\031\265\204b\335\345\222\300\221H\250nT`ddF\235j\215\206\023\365\330\306\336\342 \356\236x\370#(pF\340_\352F\ng\0271\022w\327\303\017\321"
+	.string	"B\354\020\227\325\251D\266\016\026muL\250\036\204l\030\b\265iW\004L\003\241:X\305\241,m\243:6\316B.\215\022\3112\215\322t{i5\344\347\002\246DM\034\325\304\207\006\212\203ZL\032\365\237\230\177\203P'}\205\f&\031\033"
+	.ascii	"2\2413h`<\020\022\001wl\343=\344p1\343+\333\300@\3005\026\032"
+	.ascii	"\301\272 \b\025\b\022E0\340\242\005\003\246\222\026\f\327)\265"
+	.ascii	"\271\245\263\370Lh\002\214\271\004\333\254\246\204;\274h'\031"
+	.text
+	.section	.gnu.lto_displayRelease.7.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"u\013"
+	.string	"&VN>0O\233\016 {r\203O\007Tb\001\307,G\002g\331\254\tg\032\026tU\333\017\204\310\264\221_\345\247\313:\233\254k\366gDD\262t\202 ;\311\245]\323\230?\256n\264\273I\231R<"
+	.string	"8"
+	.string	">"
+	.string	"\027\260\033:\201b\227\243XA\3743w\002\360/~"
+	.string	"\374\263f\2678P!\200\214O\b\214\335\235\224\303\265\247\346\037\344"
+	.string	"@\037\236\247\006\203\335u\202>0\334z\333\tl/\260\317\t\327\311\026c\343\310\316\346<\251\033\354G\273\273\326\220\375\355\217Q\032\276\364{\351(J\253\2463\323\227$/\f\250\330\275\320\315X\221\227\302\203d\373i\037\304Ch\3376\002\372\364\0262tdg\325H)\237\021\352%\032\250\""
+	.string	"\371 eT\247Z\322\340\241\036\333\016\036\242\211\273\036\026\237\004\205\253\003\377R\013\2600\204\217\350\304\335\265\370\"\254,v\370\3637\340_\024\306\272p2\253\212\306T&\\\036l\262*3e\030%\241\3022\223U]4\023\006\313\246\312\304\327\206\302&\316ua\223\304\355\243\325\220_'\302\241\035\206jB\262\342 \027O\241\3763\362\356\021`\024\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"%\n"
+	.string	"\226\023G< \005)\035 7\201\240\301\312\025\tfJ\336\032&\363\020\272N;<I\022\251\236_\263\270M\366\217\006\231\021\177d\266\013\t"
+	.string	"\233%D6\264\006\216!\356\021\356y\311'\233\354\235R2"
+	.string	"4"
+	.string	"9"
+	.string	"\335\251\307\023p\247\335\007\270S\213v\315G\220}\n\306\305\354fw\353\374\270x)\3727y\347\005c]r\032v\327\362\005\323\270\347m#\330f\260\237\0205{d\311\351a\177\333\335\365\214\331\227\375\333\224\226R\372\034nC\306 f7\243\026`i\024F\304c\373\322>\311K\304\313V\027\330\215\265\270\354\216\013V\b\0013\034\330\312\210MGn\323r\332\323\341\232,\333\337g\021\335\256\013\344\253T\204*\356T\316\002\032K\034E\325\355.\310?IMt!\247\376\212;\375\234/3"
+	.string	"\262\226\f$\221)\204\nM^g\321\207\"\364p\n\275Q\rAR\312\003G\325\344\205 \252\b\f\353\347\300\337\211\004V\324\367\201\3253\356\267\2351;p\320Z\323\302~\211\263\275\263\224\002\016"
+	.ascii	"2\241\003/0<\004-\354&5\237a\260Y\251\0351\035pe\202(\030u\t"
+	.ascii	"\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\345\013"
+	.string	"\326VSB\020q\224\016\033\002H{2f\023\316\274\210p)8D^z\f\242`\361T~}\300\234\366(X\333\353\337\305\274\205\264w\200\310vU"
+	.string	""
+	.string	"\200f\220z\021\214\203\366\2218\220\224\006K\320\336[\312\224\002C"
+	.string	"?"
+	.string	"@"
+	.string	"\333a\n\342\243\303\2479\362_\362\207\222r\361\301\221\016;\374=\002\037P8$H\t\241Q\3414\244>Kj\005\013"
+	.string	"wz\027\026\211\207\227<A8Sf\007\204\335u~p\033\356x\333\022l7\260\177 \251\351\3078\"e\200\212]T\013\307\306\200-D\330\026\331\025\333\231\366K\334\204\350\253\320\003\354\252^\234\354v\013|\271\016\335]@<\274n\211\207\266\315\300\201\310\243w!P\017Ay\230\330\330\255\bU\344\215\230\234\324x\337\342\365$R\300p\205\243\330\256\335\323\003\377\004\006\013\327\310\341\025\201\214U)[O\026I\212\205:\024U#\3148\345\r\273#\245\212\330\177\273\273V\225\341W\277\276t\034M'\003\332:\331e\r&Cf\302g\3136\330\246q.d\332\006\353d\031\n\230F\3330L\001{>\034\r\003y<\032V\351\366oU\345|\n\236zy*\210m\250\006Jjr*\324{\344(e\021"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\300\026\320\275\226\260>\027T\212j?\261\314\f"
+	.ascii	"\022\032\275Jc\2265\367"
+	.text
+	.section	.gnu.lto_displaySetXY.10.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\325\t"
+	.string	"f\322B;0\345(\035"
+	.string	"\276\205eC4Ck\362{0g\355\322\206x\223\231\204\037\024\3634\2535l5\037\326\2170\247\0275\255\302\300\200\004\354P\203v\b\251hk4|F,\267\335;\245/"
+	.string	"3"
+	.string	"0"
+	.string	"/\330>\271\023l\237\016\355\231W\221}\314CCV\263\273T\206<|\f\375\307\036\300j\251\0369\020\273\353\310jq\334\362\266\021l?\330O\b\221\263\315`\fhv7j\001\2266g$\266\337\261a5\007\031m\206O\370\212\262\334\375\220\371<\3327\371I\370W\352\003\273\256\225\226\335\272`\005\356\32356x\225\227\022)m\212\247\240\270\335m\360e\030\026\0021#\251\355s\242\260"
+	.string	"\350X\305\232]UQ\202\330\337\354\356Z\272\354\303\376\371\372\313\277\376\247_\\\004\032u&p\344q\006yN\235D\t\364B\024\374D\025\336\027\242#\257\233\240\240\017\244\236\003\223J\242\217\232H\244\217v\352~\263\322\345\b\027\332Jfx\312\022"
+	.ascii	"2\241\033\034\030.\250\243|\001k\232\366\r\333\n\r\263\326\270"
+	.ascii	"0|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.11.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\273\001\335\017"
+	.string	"\306\036kF\340\262(\035\341\013\357P\221\b\201\300\213\310%\330\3260\242I\033b\224IIE\331\306t\b\217W[l\330\332\b\374K\354ZJ\376\327H\216\030\343\206\365\207\222\272!\025\332\3004\002\"\333\253\341\007\261d\023)S\nS"
+	.string	"T"
+	.string	"Z"
+	.string	"\326\335\027\035$O\3732O\001>d9\200]\230\034\027\273\341\001\033\350\036\035v\266\375\230\243"
+	.string	"\355\031[\030bv\017#b6=v\327\023y"
+	.string	"\356q;\211{T\020\007\237\240\377\234o&8\324d3\327\323\323`w\235\262Y\206[o\273\200m\006v:\b\nckz\364\233_\364\232?\364\360\0079\315\017:\316\377\321t\247i\217\246\271.\035=\351\215K+\227\316\230>\211\333Qc"
+	.ascii	"\216]\f\265\037\273\023a\224\260\r\332 \333\033\216\005\001\242"
+	.ascii	"\205\251\210Yp\323\272h_66(\250\241%\320\264\021\220\200\247"
+	.ascii	"i\005%~\f\225\b]\n\367\030\225\200\b\031\273\364\027)\335\246"
+	.ascii	"qF\307\207LHm\323[\304\031\235\023\035T\355\323Y\264\272\335"
+	.ascii	"-\361WH\230\020\312A\202\205{\314\0332\036z\227\227W\326|MU\233"
+	.ascii	"\030\255%k\006\345Gm\n'y\3315\304\205\306\016L]v\350J\375`\177"
+	.ascii	"\333\253\177,Vi[\371\205\237L\251\022k\225Bu6\215\254\224*\240"
+	.ascii	"\254P&\336\352;\251\240>\023/\205*\235x\246o\345\215\204X\205"
+	.ascii	"r\372<\226J\365y\240po\217T\244E_&\345G9\365h\247 \352\250#\335"
+	.ascii	"V\203\272\f\322N\037\243y\364\"\345\3647b\264\007\227\001\241"
+	.ascii	"\333\205\005! \260\242);\035\"\340\207}D\201\2203\334\035\261"
+	.ascii	"\362\2504%\025\005\310`\2134\r-s@Z1fA\356\005\341b\226\004\202"
+	.ascii	"\204bO\244~HDy\201\307\027~`y|\220\374\030\314#\370a\231+(\\"
+	.ascii	"w\237\336\212I\020d"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\243\001\r\017"
+	.string	"&\\cE\360\262&\035\330\327\035\021\205?\020(WI5\034\372\227\n@\007\352}g\365\257\200cM@to\333\020\244\366\242M\252v\222\\\260\2559,\016\213c\347\224\372~\034\033\266\\~\347\316>j\330\215\354-eJ\001L"
+	.string	"L"
+	.string	"V"
+	.string	">\354)\270w-\007\355\306\340\270\330\355\022\030A<t\027m\3732G\301\3313^\027\342u\017'\\T\364\330]\215\344\003\262\303w\001\331\241\2028\367\344\374\257\370+\361\302\303\365Z==\016v\327\351zi\270\365\266\017\330n`\247I\267\371G~\363\177^\363\213\274\373AN\363GM{4\235i\032j\372ei\205\351|\351\007\310vl\020\310\331\315\020\373\2615 \f\022\2669;\304\276\221a`\323aA\215\352"
+	.string	"\266u\303\245@\32369\341N\243\262\356\302\3508y::.;\243\313x\020w/\240\3701,\220\342\212\032\020\001c9\302_\254\304T8\223c\002&\242\266\312[\300\031\032>8\250m:\216*\356.\212\317\002\302\204O\216\021-\331a\352\270v\2602\346_\225E\275\236^p`\200ie\314\356V\251\037\354\277\325\030\203\002\242o\251T\350\261\274\302G\242R(\205*\221\242E%,!\t'\024)ECm#\n\244-E+\221B*\232hCi%\005l:\2156-e2mZH\267\267AJ\302\322\226?\371\024j\246\036\005Q\253\202\364\355\006]9\252'\033Q\250\377\350\323\007$ \300\"\032\243\036\"\340\207-b\020\006{7\230\211\274o\304\352\243\322)\201\253\320\004\013\312\274Y*w\2269\246:\203\204/\205@\337\302\363\206\347$&Y5\f\274"
+	.ascii	"\025q\234\201\311\3058\007\206G\037\301\205\375\\\301\360\337"
+	.ascii	"}\342VL\202 \003"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"U\t"
+	.string	"\206\222B9@\217\322\001\230NL\367J\020\274`\205\302\215h"
+	.string	"b?\002i\230ui|\264W\177\027m4\030\215\331\260Q/\351\030&\3261L\240z\301E\250\223\277%vo\262eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032PN=\374p\235C\345B&\263\033r\321\343\251k\312\277\311\265\021\r\227\326Ku\325@\354\256\265\365\302\270\343m#\330f\260\357\277\246\2515\252\257\321d\300\020\264\354\272f3\373\"YDl\243\354\215mU\373$/A=v:\300.,fe7Tp\302v\351\360\002\363r{Qe;\342\262PJ\205g\232\227\032\r<q\024p\333e9\370'%\212-\344\322?\315\313\307\001\220\330Jgv\250\322\330a_\333\335u\204y>\026 \217\250C\002E\335f\017\307\324\221\030\201\335\207\003?P\251\373>\234\250\353\2048\317\007r\234\002{#\320\307\221<\357\3436\341\3363\036\254\242\2057\252Ek\234\361a\203\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayIsSynced.14.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\t"
+	.string	"\206RC<@\305(\035\340\245\313p\357\213\227\027\330\246\030\315\230\034\0371\r)\240T\314\2008\213V\257\276S\365\207\332X#[\375\326\216af\223\001\317+F\344o\364\021\nJ\354\336d\313\224\0020"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 L>\375\013a\335\303E\003F`\367\233\020\344\247\353\311\177\3123\023\216\226U\013u\305L\354\256u\325\332\270\341m/\330~\260\357\177\226\251\025\252\217\301\224\f8\210\355\262b\005V@\004@b\333dgl\253\332?9\212\351\257\322\007v]\001^v\277\0063h\217\376^ \037\265\007\020e\233\342\260\017\013\006G\222\217\n\023l\361\025O\333UE\370*\243\013m\344\321/\311\307C\003\221WJc\366\207R\370a?\333\3355tY\376\025\036\016h#\362@\233f\216\206\264\251\by[gz\235g\264u\235\t\3326\237\311\351\274\251A0\027\362tS\304q\335\314|{K\250\220\202\031\316h\006\255PB\211\016U\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.15.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\305\t"
+	.string	"\006TF90\257\322\001$\036 \021\232\\\256\\ac8\346dx\005\033\315Bp\267\240\216_\275\372\024>\254`\320\305\241aFD\020\210\332\006Q=\336\321YM\264\\B\270\221\334)\0055"
+	.string	"3"
+	.string	"5"
+	.string	"\001\333gw\200\355\323\266\023\026NF}\314x\335\342\244Ec\331\035=\3058\352\022\345\377\343\227\016\212\025\027,u\3115\354\256\245\0136q\353m\027\330V\260\237\tk\215\231\373\354\237SZ/\322R\245\337q\262\024\215\312\356\253\326\262(\263\204\303\366\311\306\330\226\322\276\354\036\247\317L\317\354\306FHvG\004\037t\237\036\037RU\031*X\232\262\355pZ\250\333eq|\021\t\260\264}J\0350\304CJ\335\356r|\020\222\330m|\372\246\355\363*\2401S\311\232=\246\244^\330\277\354n \217\250C\022E_g\317\246\324y\030\211\337\307\023CP\304\027~<\321\327\ty\236P\3646\032\203#P\350\221@0\3640\343\336\234\022\250te\203\253r\372\226\311J\326\214\221S\035\n"
+	.ascii	"2\003\3020z\230\273\301\336\224\346\n3\226q\031\345\252\361P"
+	.ascii	"\035\302\230\256I\006"
+	.text
+	.section	.gnu.lto_displayRedraw.16.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035\200\213wBb\332\001\r\262\023Z\f\326\r\031n\"\307\007\352Z\373~\315\3426:V\033\214F\251\242\246\177F\244\330\024C\265\035\220[&\bx\303\223F6\3312\245/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\230\207\033{\022\227\212\027\200\335\235Q\343\340\025\364\037r\315\212\205\272f\026v\327\272b]\334\361\266\017l+\330\216\005\317vw\035[\366]\177\026\325\252\352k\231\225\026\203\223]\213X\200\205I\225\216\215\355\253\375\217\203\200w\235\036\260\3332A\331\r\023\214\260]:\f\033\fUD\331\356\376z\330vU\035\277d\3423i\227\032\t^\f\361\021\323\266\273\035_\244\024\261q\\\372'\355\3621\246\304x\270R\032\263C\224\306\f;\241\217\310C\372D\334\346\017G\302\3230\3728\320\374\274P\211\363@S\304y\034\346\307\373&\247\300\335(\344MR\327ys\023\356\263\215-3\260\300R\221\302\032\315\2425:\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.17.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\365\t"
+	.string	"\366RD:0\345(\035\236c\344\267\020\241\003\027\f}\262\223=(\224\3257\r[O\332\334\326L\377\365\361\032\214\306l\0245\3753\"\"\031\300\340qS\264\362\005\nye\b\341\266r\247\0243"
+	.string	"1"
+	.string	"3"
+	.string	"(\247\342\344\260\320d.-\223\230\335\331\t\274@\273\214'\320.u\343\251\307\224\177\222g@0f\256\227\352qs\330]G\327\353\342\326\333F\260\275`\177\023\321\232\211\216\032}n{a\341\300\354V\314"
+	.string	"\354\212T\371\260\215\2625\266c\264\037\373\b\352\363\364\201]XK\312\356Tp\002w\351\311\331\366C.\022\252\332\220\301R\225m\357(\017'\023\"\223r\374\275$\202\333e1\370\262R\310y\\\372'\355\362j\320\021[\305\231=UQ5\354gVa\336>\177)\003\241\317\310S\nG\036\347O\307\344\201 \205\036\250\013\301\220\204\007\202\272\221\347\021u\0370\354:\033\177\244\020\330\225\276\017\3544s\357M\017VJa\325M\337\n\020\020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayLayerSupported.18.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"e\f"
+	.string	"f\327TA q\223\016\037\024\266\255\024c26\362\031V\n\3746\037\200\326\017\224=\270qI\272\206\r\303\332\320\026\365\rJ\212u\320l\332\"\301!@\232\002\035\n\307-\020\036\020\210\325\337+A{o)S\nC"
+	.string	"B"
+	.string	">"
+	.ascii	"\013><\326\036?\210>Z\271P\002"
+	.string	"\265\033-\365p\355\317ij>\200\355\363Wi\2703\261l\240T\207`\003\213\f\001\266\022\327q\032\311x\351y\262\231dr\200\354\2563\264a\270\341m?\260\315\300>\204~\345 \004jF\201\026\273\242\224\215u\361R\200\260\355\261-\2665\236\204\347)\035'`A#\321G\365g\300e\332\027\361\021\236\243T\370e\227\264\342\304nT\340\004\325\237\343;\340_\365\001\360\317\266\003j\020\013Z\362`B\265%P\310\207\256N?\267\212\312H\205;*uJ\0245N\034\324\035\350\364\245_b\352C\343E\fP\256\330\361\223\332\301\276\333\335\265\222\354\243\374\360)\277sZ\235\001\031\326\271D\036\206\321\\$\034M\2462\306\243s\211\214p2!\026'\303&d\262\020K\223\271\"X\230\214cy\020\360f\004\313,\222\315&\263,q\257$\277\364\0060B&\023\352k\320\316\375\300\r\223)\177\r\252\236\004\026"
+	.ascii	"k\b8\327avD\342Y(5\366.B/\260\n\270[\024\036\300\ni\334U\b\314"
+	.ascii	"\\\003\231&8\020>S\243\3402\246\251\211_]]\325 \220\267\252\235"
+	.ascii	"P"
+	.text
+	.section	.gnu.lto_displayLayerSelect.19.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\f\001]\r"
+	.string	"6\232]C"
+	.string	"\221(\035;>\376\305\033\374]b\217\315'\342\216R\213j\234M\207\004\354\024\r\026\340v\b\332\3776\037^W\0212\276\251r\276\036\376\273*\201\025\004\377\224\001?9\25469G\235\241\222\277\367\2262\245J"
+	.string	"H"
+	.string	"J"
+	.string	"\006\342!v\002\361\320\266\035|\230|z\367\201\345.+(0\257\335.S\017?\375i\236|\324\037L\261P\275X\301i\270\276\016\224\033!"
+	.string	"p\253\227\340\205\232\271\353\251\302\25127!\273\353L\341Znx\333\020l?\260\177!v\232\363\227\177\363\326\037\235V\230\316\227>G\204\021/\031\013f\354\262\324\330X\0328#\302\266\311\356\330\326\356'L\177)\275"
+	.string	"\273\352\220\341\003;D\3602\355\227\270\t\323['\027\260\313\222i\261\33350\003\354\320\335\003)$h0(*7t+\234Z\024S%\270b\254\262\206\355\tW!\302vW ~\n\013$\223x\230z"
+	.string	"\206)\034\205\t\210\017\243m\330\356\036\304\241\177\022\017\257w]AK\f\215V*k\354\016\225\352b\377\355\356ZY\016\032\250\344\031\201\240\317\310S\262\215B\230?\036%\317\b\311\026\022\3116\rT!\244\211d\243\220G\224}\264-\363\3500\211\004\244e%$\222\226u\272\375[e9\272\340\020#\223\376)\336\365\001\312QU\025uHJU\257\223\033\215\352T\216\026\b\023"
+	.ascii	"`\204\036\262hp\013e1{\025\325\002\b\244#\304)\023\206R;>5\257"
+	.ascii	"-\201\270k6\320D\f\302gj\024\\\26645\"U5\024]\n\n"
+	.text
+	.section	.gnu.lto_displayLayerCopy.20.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`u\001e\017"
+	.string	"\346\235iF\360\260(\0358\"\304\027\034m\207\207\345\221\225\202\273qDw\266\314\016\301\375~\250Ys\002\357d\265\377\025\247:"
+	.string	"\033\344\336\254O\361\246\021\334\232S\342C ]\326\210/^\241\263\201\312\024cI>\331D\312\224\002U"
+	.string	"R"
+	.string	"W"
+	.string	"\217\016o@{\334\316\241=\3326\003\220\224U\017A\240\234\245\203\206\230\316n\330\351\207\253\0363M\225\277z\214\254\026\255\0273\260\r\317:v\227\203\271R3\016\025\232\234"
+	.ascii	"0\f\231GN\013\207\307\236'\260V\246Gdw\235/X\312\255\3356\004"
+	.ascii	"\333\016\354\303\004,\366\263\335]"
+	.string	"\353\212\355\364\347/\377v\230\337s\227_sZc:\263\364\271\007$tf(\240\261\213\262scq\"\213\021\266S6g\303\3104\320\360(R\177Ae\002\326\345\341\005\262=vd\231\366M\374D\352.&\037\260\273R\263b7\\`\217-\351\321M5u\352G\013\274np2\350\352-*402e\331\324\243Y\342\231\323\242r\243&i\251\021R\310p\245\r\333\022\256\202\264\355\272B\374\231\013\246\022\3551\365@\fS\270LI\210\037\363\201\333\356^\304\243o\242=^\037{\202\024\233\032.\254\334\261\303Uj\237\207\002\215x\241\257\202\t\344>\017\005\0329\201\236\b\200\027*\201N`i\2649\364\201\002M \001G\242\016\374<\013\243O\324\225F R\027\372\300\356\003\201M$\336\327\235L\246\257\343\302}\266\272\342\324\327\\s\021\"\306&}\225\366\330\td\037U=\261\255j\021\226\266\"\027\033"
+	.ascii	"g\204v\321\302\327l/\"\032\213\030\341\340*\250\276\260E\307"
+	.ascii	"\336]f\r\245`|\n_[,\031\\\023\341&\0240\007\324`0\222\204\270"
+	.ascii	"@\370L\215\202\313\230\246#\032\241\206V\207+\r\262\326\t\005"
+	.text
+	.section	.gnu.lto_displayWriteFontCharacter.21.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`A\001E\016"
+	.string	"&\\cD"
+	.string	"\221(\035\240<\376\315\037\360\374\022\342\210\271q!\235\262'\020\035\366nH\177=m\331\231\274\355[=U\311\303\2105\213p$\336:\277+\201\240c\260\337\005\f0\333auGy\365\233"
+	.string	"\371do)S\nO"
+	.string	"P"
+	.string	"O"
+	.string	"n\240=\372\273\201\354Q{\201\354\321\266\037\210\224l\372GB\345,'V\257\330\356\267\351\210\233\0165M\376\3510\242d\244l\310\260B\\!\310\212\006\205"
+	.ascii	"\226\n*\210\235f\376z\246\260R\231\033\222\335u"
+	.string	"~`\255\334\361\266%\330\216`\277%\346<\346\377\370\313\257\335\365o\234\2060\255\233tf\351\003\240\320\022\313\301@\307\256JM\217\245\021gR\330.\331\034\3331F\303\201\316\252`\\ \300\357,J\1779\311\316\252R\036D\264\307Nf\332_q\227\322](\037\260\333\232\001c\367s\020\232\240\203\236\254\251\352\204\022\260\025M\212\370@\260\324\\\226Z\001\006\207*y\330\266p\027\234\266\253\032\361e8`\360\024\301\r\227\274\2057\342\303H#mwo\342\321G\311\036\257\177}\301J\214\035.T\326\330\337)\225\305>\334\335\265\266lg\335\205\217v \220\007\206>\"\217\211'\3424\177BN<\031H\036\007\332\274.\264\201\353@\233\210\363\224l\237\316\333B@<\"\205\272\315d4\3526\316\267\207\253-g5T\300^\244o\312\376:\001\345(\324\024\333PM\202\322\024\f\220\037\252\272Q\247r\002\026"
+	.ascii	"l\204N\313\302\213\314\336\243j\003\036\322\261b\231YC)\b\251"
+	.ascii	"a\343)\324m\261\177\270\306tM\210\240D\030IB\\ |\246F\301eKS"
+	.ascii	"#RUC\321\245\240"
+	.text
+	.section	.gnu.lto_displaySetBackgroundType.22.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\275\f"
+	.string	"\006\230WB q\223\016L\036\t\311o+C\352\3208`\351G\331\241#\024\350b\020K"
+	.string	"\025\262w\344\366\337\242\0318\365-\304\232b\220\257\265%\001\fH\271"
+	.string	""
+	.string	"\317\3469dq\360\300\247-\337\366do)S\nB"
+	.string	"B"
+	.string	"C"
+	.string	"\361\035\325\2417\233\306\273\225\375\251e\303\311\306\356Z*\342\333\237\346\346\337\364"
+	.string	"'\234\350/\345\372:TV\2442\334\350y\244X>\334\364\344\300\231d\002h\260\273\316\023\016\345\206\267\375\300\266\003\373\022\002.\177\365\322\017_:5\375\210I\211\241\240\306n\207\227\034\213\202.H\330>\306vv7\261\335\005\303#\260#\020+\f\342a\202\367\264_\342-\333K$/\260Kz\301b\267[`\217x\350\356\006\252\303*\312\024\213J\0135V\245\206\230f\214\022\207m\221\247\300\342\356\b\304G\221\301B\250:L= \303\332O\204\342\356\202\370'\320H\034AR\035^!\n\214\033\245\222|\261;Qj\b\373ow\327J\262\037\234O(\302\3063\202e\023(h\256\220\fG\343\271@\232\247\023\255\371\b]\025>Zgci\031\347B'\333X\236\316%bi2\315\372@`\354\303\311,\020\206e\026\246\333\277U\222!x@\225\250\311\023\220\225Bu\252\007\250\340P\032\002\025"
+	.ascii	"3\241\031/\306\326P\022\2637Qm\201T\034q\357\2300\224\332\021"
+	.ascii	"\323\001[\013\241`B0\327\330b\230\027\204\317\324(\270,M\215"
+	.ascii	"\026wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_displayCheckReady.23.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\f\001M\r"
+	.string	"\266\032^C\020\217(\035\250\261\002\204\234\227\n#\006\344P\211\263~o\\"
+	.string	"|\253Z#\300%\217%n\355\2435\234e\201FC\260v\317q\371\245"
+	.string	"T\200\020R\021\232;JJ\201\2532\332Nf\2174\262\267\224)\005K"
+	.string	"F"
+	.string	"M"
+	.ascii	"\361\003\260\303\354\002\260C\333V\3401r\367\310\341\344)%N\""
+	.ascii	"\\\273Q\323\r\357\3764"
+	.string	";\237\364\007K-V\213\004*\303\365m\234^:h\240L\357\200\213\344\362\325\323\004U\222\211\001\331]\347\005\024\312\ro\233\201\355\005\366G\001\273\273\326\224\355t\346\361\317\256\3721N?M+L\347K_\343\240\305\005\203\343\305\356\311k\306\252\200.\036l\217l\215m\315\307\216\300c\260XA\341\221i\177\345 FW\221\034\300n\312D\313nL`\216\354\320\001\0315`AI\316T\265\201\312\353\364\222\032\"\006\224\372\203\245>`\2710\245\f\333\020\316\362\311vM\037\376\210\n\241\021\3540\265@\013Kx\210\221\017\237%\342\262\335\275\312\241O\202\035^\277:\002\224\326\007U)_v$\245\246\330\177\001\240\r\207\353lX\207\003\332\210p OfN\007\205M\004\021\347\t\321\270\2553\301\263\205h \317\346\243q6N\353\330pH\324\3314\221Ph\3234q\377VS\306V\244`9\221\177\207}\365"
+	.string	"\232\321\247&\266\237\032\244\244%O\223\252\030uj\021"
+	.ascii	"j\204\316\312\302\203\314\336\236j\003\036\322\261\342\226YC"
+	.ascii	")\030\237\302\327\026K\004\327\304\230\3051\302\035\350[\200"
+	.ascii	"Z\207*u\212Z\265\007"
+	.text
+	.section	.gnu.lto_displayBeginTransaction.24.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"e\f"
+	.string	"f\327TA\020s\223\016\230\237Bq,\372\227\265\321\3613\373C\350\030\034j\324\377\007\201\314\002N\312\345\bQC\223w\310\bt\232\302D\274iO"
+	.string	"@\214\210\210\216\225\320eBz0\300\327\033\354H\366\2262\245A"
+	.string	"A"
+	.string	"A"
+	.string	" \323\2415[\307;\021\373\221\r\r#\036\273Ki\210k\177\232\232\177\321\003\240p\237\277\016\327\007\242\342\242D\200\333^Hi\305\303E\317\r\334I&"
+	.string	"\007\273\353D\341Rnx\333\017l7\260\037!\017\375\360\245S\323\217\227\03170*v9\264\374X\022\214Q\302\366/\266\263;\n\355,\027^\201\335>\214`\020\017\025\274\247}\023?\241=Tr\003\273\240\032/v\273\005\016\211\207\356~`:\214\0170\324\326\224*A\224cK\037\266I\316\302\212\273\233\210\277\002\003\005\317t\230\212"
+	.string	"\207\261\247\360\304\335\025\361GY\205H\242d:\274\302\224\035=B&\331bw\237T\020\366\337\356\256\025d\237\345\237\002X\326\261\336F\303\311d\030\247\212\326`<\231\t\035\254\032\241\260kc\241\272F(N\225!\2414\027Fa\022\330\352l.*\263\254\213\272t\373\267\n2\004\032$\023=y\002rR\250N\365\200\0262H\031\364\223\245\025\225\025"
+	.ascii	"3\241\031/\306\326P\022\2637Qm\201T\034q\357\2300\224\332\021"
+	.ascii	"\323\001[\013\241`B0\327\330b\230\027\204\317\324(\270,M\215"
+	.ascii	"\026wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_displayCommitTransaction.25.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"U\013"
+	.string	"\246\025O@ O\234\016 \006\031PB\242a\001\340I\213\355\2171\0360\222s\034\310%\030{\213\341\350\305\267\210\033\212\257\254\375\017\362\372\037\013\204@\002\022\330\315"
+	.string	"\246\0039t\026\203\303\237\020m\"eJ\001<"
+	.string	"9"
+	.string	"="
+	.string	"\366x\210ao\362\220`r\261\273\231^\270\367J\323\363\337\361\310\b\004\275\252p\255&\032#P"
+	.string	"\300\257\242\2408,\274\3439\001\024eB\016\354\256s\004f\334\361\266\021\3306`\037\013\325\356\256\225d\277\364GMg\246\017\221\260@\201\245v)\244>\366\024Mh\220\330~\332\347\360\016\336K\237\007\330%\235 \261\033\0260\345ztx\001\326\343\365\211\365h\317\001%T7ls\254T\005 T|\371\302\366v\023\347\332\375*~\210\b\235\307zL\035\220\302\r\376\301s\355n\305\367\320ypex\364?\326\3435f|l(\2052e\207\240\324\r\373\001\231\213\306\322\3514\332\345\013\006\301\262`\323i\230\254\3432\0164\016\223i4\013\203\354\302u\031F\300\333&\303e\235m\3432I\270\257VIN\320\342\024RQ\025\311\250N5\206\210\025\247OA\211\342\320\b\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_displayGetCanvas.26.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\221\001\255\017"
+	.string	"\026\236jF\360\260(\035\272\2357\302\327\334\233\002cn6\371\303\b`f\037\026\354\241\036\265\264\350[\363ol]\252\242z\024|n\224\022\277\324\317\353\025\232\201g\310\235\017y\316\001D\372\270L\354\276MmC\354\336D\312\224\002Y"
+	.string	"O"
+	.string	"Z"
+	.string	"\361\220;H<\264\355\004\013Vf\375\373\360\372lG\205\032\236\335\257S\017g\375\023\341\246\311\362A\260\326?q;\260\201\005\206\020\027\035hPH\310e\370\026\202\271\244n 1\024;\002`\256mdgF\303kO\030XK\346\247dw\235/\260\0137w\333)\333\r\354\257\b\331c\177\255\324\231\375mw\327*\263\377\375\240\323~\316\351\3504tZa:\267\364\003x1<6\272\034\273\257\036:\266\005T!\302\366\312\016\331\326OU\200\300\272h,(\310\264?\342$V\247\255\374cWv\223b\367C\340\021\356\320\337C\002\232<h"
+	.string	"$H9u*\324\347\304\270h+\337S\003\247\007\352\354\nBG\347\306v\022S\317\201\306\245\2338\261\231\200\"!\036\246\032\260}zM\004n\327\305\300/\361\300\343v\367!\016}U<\274\212\310\240\261d\217\347\316L\fG\275\0229}\355\037\265\027-\0340f\270\002\244\221I\244\342\231J\234'J\231D\243\350\021\211J\004!\305+\231t\036\212\224*\241L:SI\204\322\215P^G\"\342S\n\t\325\251\234N\250.\364\355\267U\231_\273\203\0301\233\233\355'\356\250\032\025\306vT\227\260h\313g\200G\244\374\213*\324\226\235##\363\212\254\b\003\035"
+	.ascii	"`\204\306\327\302\327m\017j\032\253\n)U\013\203\250\215f\027"
+	.ascii	"D\306\342\214\3350\026c\343\241A\036`\r\224\352\002\026\"]1\f"
+	.ascii	"\213\005\027\032\261\261\021\224\bF\034\240a\276p\337P\005A\310"
+	.ascii	"`\214\252\006RuL("
+	.text
+	.section	.gnu.lto_displaySupportsOsdSymbols.27.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\020\001\205\r"
+	.string	"v\032^D \217\223\016\320\303\323\322\240\"\020W\007\002?\001\0058J\026_"
+	.string	"\200\022\315gW\240\316Uj\236\f\260\375\037\355\333\242\375\030\221M\006\215\365\b\t(\246@\261k\314/\t&\224/t\201\"\204\220-eJ\001L"
+	.string	"D"
+	.string	"N"
+	.ascii	"\002\256[\266\255\241 \344\356_\006\222\237J\244\025\230\335"
+	.ascii	"O\323\323\273[Q\263\363Ani\013\022'/\037<\013\217\243\214'\222"
+	.ascii	"\032\r\230\224("
+	.string	"\001\340\211\"\206\313\211\212\257\236#\236H&\266\261\273N\n^\205\373\272m\007\266\023\330\007\005\031\332\037H*\212}\r\3030\264\232lMcW\375\227\323\321iM?\003\265\300\260`\260b\227$|\261-\026\213\006\333!;c;\323>\207\247BW}<\300\256\311\204\210\335\017\201\017d\267\374\035\343\272\225=k)\312O\210R \242\232\254\004.\234TP\2142&G\270p\301\240\356.\325\001\245P%\305(c\234zU=\251$S\177\320\205\351Uc\003Hb\021\231\273\007\320\002\277\303&!\333\335\247\334\362?\256[\230~\365D\225^\230\244T!\001\234\215G\343\301y:\2317\031\0234\017:\270\016\207\306m\234\b\235\215C\363t4\020\264\315\306i\031\005\374\351\340l\232\307\347\263i\231o\037WM\306P \230\007\217\245\200`\374\312\277z\203\027\024\030B\377\356\212:b;\2527BT\024w7\025"
+	.ascii	"X\204.\320D\201\271\350y-\205Z\342+\341p\345\207]2c\r\354\312"
+	.ascii	"l\003M\377Q\255~\313zq\3017\357\236T\266\214\021\324i\325\032"
+	.ascii	"8V%\314="
+	.text
+	.section	.gnu.lto_displayInit.28.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`G\003\345\026"
+	.string	"\366\347\220J\300RRc\300k\016r\230\235\351\206\223\313\226\213\370A\372\023\265\205\t'\372P\200u\225\b\250\215\370\254\017\020{\211"
+	.string	"\360\032Qo\017\254\205\025q\247:3\265\003\264K\334\f,\314u)b7\220\342*\255q\267\275\267\224)\005x"
+	.string	"t"
+	.string	"~"
+	.string	"=#\243\002\364\246\201\262\022;"
+	.string	"\030\271=\246\020\b^\355\007/\344}\270s\222{\201/\246\356%\0360\nz\323\304\233\2347\321\227\2347\315\263\203\234\210t\017\245\364\301I\353\336[\263G\347\3754K[y\376\235\016\003\362\361\374,q\323\203\361\247\226$n\313\022!\030V\"\276^\211b\225t\342Q\257 |>\265\276\026\334{]\201|#\356\327mg\260\355\300\266@\001*\376\024\007\234\br\305\316y3\205\b\371\023\016\365\324.\233\350S-\n\373\345\265@;VM\203U\317^\3252\264:\366\252\206\275\351\177\235\370\333\017\377jB"
+	.ascii	"\3517t\264d}\020\257\210.\256{4e\260\260}?\306\215\272\032:\251"
+	.ascii	"\027q\376d\313\303\004\216-\203z\224\316\237l\022q\375\202\367"
+	.ascii	"^\331M[\307\226\335\2642\333\326\305\231xo\332\225#7\001\352"
+	.ascii	"\037af-+\372\261<\022\276c\002\006\227\231=\271z\3211?\312\354"
+	.ascii	"\213'\301j\361\023\016\313\223\352S8\2535\315zV\234q\374\261"
+	.ascii	"<\325*I\210\312\272\345\244\331\027&\254^\035\342G\271\302q\264"
+	.ascii	"\240\367\366T\374\033\033\\ls\336\244\331\245 \340O8|Y\333\302"
+	.ascii	"m\354\214tl\r\331N\373\302i\330\022\020e\375\202\311\247\247"
+	.ascii	"}{U\372\252\312\241\225\264\326\2169\225\rz\357\ri\315\216%\275"
+	.ascii	"\341rR\230X*\363bc\3119\323\333\214\355F7\203C}K\331\331djt8"
+	.ascii	"\230\232.\227\346\340r0\265\031\234MC\355\226\323\325R\006\230"
+	.ascii	"\246&\315\325nhhr5\031\261\347\345\265@\2477\330*\332\312\352"
+	.ascii	"\261>g\201Z\255cB\216=s\345\21418\220\025\031\227\230\025p54"
+	.ascii	":\346?lP\230\275\361UE\320\361'\034\362n{p\244\315J)\375\202"
+	.ascii	"\311\247\347\213\206\360\036\251\b\262\226B+\031D\25018\344\034"
+	.ascii	"s\306Fd\224$\005I:\240\002\021\301\243\007\021p=DU\222\264Pm"
+	.ascii	"\323)\213\260\001\215\332\037y\036$v\21691D\266\213\022\b\006"
+	.ascii	"\234\373p\307\034\232\221\340\013\300\222\f\265\241T\202\f\021"
+	.ascii	"1AS\245r;X\201\024I\f;k\214,\351\302J\331e\251\315!\021\272\031"
+	.ascii	"A\013\nU\276Q$8\250p\3564\232\025Y\264\275\034&%\363\022\310"
+	.ascii	"\361\020\363\260\313\224\021\314\377\201\224$d^a\264\317X\300"
+	.ascii	"\371\007O+\033\233x#\232\233r\n5"
+	.text
+	.section	.gnu.lto_displayLayerSupported.part.0.30.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`o\001}\017"
+	.string	"v\336iF\360\260(\035z3\032Fw\031\254H\"\211B|\232l\0225\274\344\024\034o\322\006}\305\362\375\250a\337\352Q\177?4\306Z\215\250\224_?,\016&\214\021\317\377_N\024\363\225o\372\336\307\224/\211do\271S\nU"
+	.string	"W"
+	.string	"Q"
+	.string	"O\260}r\347\330>\355\233\360\207\347\244b\333\037\036\224S\017C\304\336\222\343\232\341\354\206\335\247\202x\352R\343L\371\361\005\252.\347J\206\005\203\006\344p\225\035\256\032#\006\200-\311"
+	.string	"Ges\332#\fd\305x\340s#dw\315\255\334\333mS\260\035\301\376M?\200\0060\002\036vc5\032\373a\332\220\370\314\355\2438\3714wl\177\346\364Y)N\330\325\212\203O\313\230\313\240>+\311\002\333j\211y\270\317\005\362\034\033\312\356X\343\303\323aL\n\302\335\240b\215\366O\374\005u\030\323\r\354\312nZ\354\206\020>\375\200\373t\030\372\330!\324"
+	.string	"\252\272\330\036\331T\225%FF+\346\330\366\316b\204\333m\201\370+.\224\240l\237\252\237\305\260G\247A\341v\027\304W\201\241\202/\342\3237m\237QO{W\2426\343e\025kQ]\254\363rUf;z:Zn\321:\243\343\303\007_\310\364!\231!\220\350sB\022y\234A\036\246\017\211\t\311\023\351H_\310\202\367\211t\"\357S\322\201>R\347\321\341\221I\350\353NF\243\257\353\\e\016\220\222\301U\243R\302\213\027\255&\372\251m*\314\366T\207\254\224e\2252\305*\213\005\304\277\264]\255*\025\301\013t\221\242*\007\033"
+	.ascii	"g\023@\324\361\225,\f\226\031\201\245W\300\031\233\221J\t\246"
+	.ascii	"\232\006\357\001\024.\033cXV\352\254\362\264L\361\276\260\376"
+	.ascii	"\023OCA\310*\b\022B\347\274C;-\324\034V\235\201p5\020H\035ym"
+	.ascii	"\301\003"
+	.text
+	.section	.gnu.lto_displayGetCanvas.part.0.31.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\023\002\325\020"
+	.string	"\026!qF\360\260(\035\352\246j\203\356^\242\376\243\244\215\007\027\231s\307\210h\254\337\324E\366\007G\375\216i\214\276\321\277\377Qm\364'\366\327\007\250\233\310&\322\376f\353\232\223BLPjee\266\377\331,!{\023)S\n]"
+	.string	"V"
+	.string	"c"
+	.string	"\340\304\360\342U\3733\237\301N\343z\2009e9,\346\004\017<\332"
+	.string	"\367h\360\002\344#\367\017\371h\037\205EF^/\266-2\002s\354`\b\227\313\350`\tq\314\tz\217\013\342\261\257j1_[`&|\037\236\300\215P\006\r\034\230\fW\217k[\311\234\323\234\206;\336\tl\205\t+\343\325\256\315\225\331V\2176\265H\252CR\r\332\324\235T\177\242\332\263\2519\251\336\244Zn\352x\233_\223\352\215j=\370\377\243"
+	.string	"\207Q\314\234.;9\246\207\350\202\204\355\333\017_vg\303\354\316\232\336\246\246\245\325\264@"
+	.string	"\314\025\033\013\bV\017\276N\343\002\t\240\006o\321\355\002\317~\034<\347\304y\266+\021\232\230qk\177_A\032\325x\213\215m\271\325tXv\310\335\335V\352P8\241\242;\216+KW\361\200\233s\205\304\307a\231Z\3621\256\002\0213\335\335\263\354\260!\374\346\304\3159I\374\024\022R\376\210G\337%\037u\037^at\220\305\314\314RtG\003%\022\352CY\241L\334\352c\241>\2224)\304\365E8Y\231L\274\225\252\3042\251L<\224\351;y$\325\312\013\031\340\324II\345\241\244R*\257\263\255\327\346\312\374\360\036\372\307\344h+\330\036\255KRV\305\273+c[\264\301\345\302\315\334\017\026\255\315\340/B+Z-\006h?\033Z9\243\333$ \260\002\2512n\003\227\3120h9\210"
+	.ascii	"\202\243\303\305\346 \220\303\341,\335\236Y\266(\026\315\220"
+	.ascii	"\3611\017\274\226C%\347\307\256\221k\025\337\003\n\213\315\b"
+	.ascii	"\"f|\354\223\333[,\fb9\2213whm\241<\214\352@R\006\256\334\267"
+	.ascii	"\336\352\230\201\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`\335\002\305\n"
+	.string	"D\016\331\003"
+	.string	""
+	.string	""
+	.string	"\002\036\177?\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \037\177@\003\177A\272\200\202\002\004\177B\005\177C\006\177D\007\177E\b\177F\t\177G\n\177H\013\177I\f\177J\r\177K\016\177L\017\177M\020\177N\021\177O\022\177P\023\177Q\024\177R\025\177S\026\177T\027\177U\030\177V\031\177W\032\177X\033\177Y\377\377\377\377\003\034\177Z\001\035\177[\037"
+	.string	""
+	.string	"\200\200\200\004"
+	.string	"\221\215\300\227\002\001\225\001\004\002u\004\003\004\005\325\001\004\006\007\003\n\034$\004\n\365\006\004\013\325\006\004\f\r\004\016\017\020\003\021"
+	.string	"\323\243\362\362"
+	.string	"\001b\004\022\023\350\314\231\263\001\001\265\001\004\024\265\001\004\025\321\231\263\346\026\027\030\003\031\001\217\246\246\325"
+	.string	"\001\342\001\004\031\372\321\360\372\033\365\001\004\033\225\n"
+	.ascii	"; 0\003\021*-\0067\031\244XH\240\271\225\336\r\311\251\260\323"
+	.ascii	"\022\300\275\374fx\221\222\371\220\260\"\255Y\314\204\034\344"
+	.ascii	"c\2301\313\027!h\277C\030K\234\267\241v$\336*y\202\r\314\226"
+	.ascii	".\003\217\034#\302\177\343\033\276\341\033\276\361\033\337\360"
+	.ascii	"\r\337\360\215\337\370\206o\370\206o\374\3067|\3037|\3437\360"
+	.ascii	"g\021\3007\252\200\034\203k\320\354p\002"
+	.text
+	.section	.gnu.lto_.refs.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2947b4c9fc6edab6,"e",@progbits
+	.string	"(\265/\375`b/\205\274"
+	.string	"\372\035\035?W LI*\351\274*\021DDl\206\220\374\247\230\266\023&\265b\201\355\254\004\"\210\"h\333\r\300\310X'\302*\200\325\326\035\340p9%Z\313\006\270\204\340<y\231\232\254\026\233\004\037\257\363j\352\350\272\354\313!\345B\367/F9\254\221\333\231\277ZI\255\356-e\n7\003\347\003"
+	.ascii	"\004RXx\264e,\234\205\311.\340\276\263\026\366\373\0132\275i"
+	.ascii	",.jfmq\330\303\260\333\316\363\005\303ZX\310\027\f\357\307Wh"
+	.ascii	"\370\201\266ve\217&\016\356,\313\233\321\332\226\025\326\033"
+	.ascii	"\332@;B\224\236g\037\347\371\230\303\020\257\013\254\311X\rg"
+	.ascii	"\274\031$Z\340b\264\345)\f\027\203\205\307]\262\321\310\240\261"
+	.ascii	"d\212y\336\335H\211\343\302ew\276\253!lCb\265\345:\206K*\202"
+	.ascii	"\005\213\216I\230\216\271\266LC\002\2104\231\332\236c\234\354"
+	.ascii	"\204\347\230\214\241\360\223\333\262\345m\336\233\326Td\323\223"
+	.ascii	"\266\266!\330\303\320\262\210\341\r\213\030\376\205\223/s\030"
+	.ascii	"\312\361\360\263\342\322\226\345\276\327J\356\306\304\332\336"
+	.ascii	"\217\341\370\006\032\016+\270%7U;\354l\330,\231\"c\251\355{\316"
+	.ascii	"\237\337\334d\346\312\270\b\217\234\335~\r8`6\232{?\3008\251"
+	.ascii	"\262\243\321\226\331\232\223p\333\231\215\221\\\003\016N3t\305"
+	.ascii	"\356M\231\315\336\213d\266\300\206\331\202\2278\037H\263\241"
+	.ascii	"}\007N6\302k$\300\212C\256\251\235U\031\213k\253\306i7I9\277"
+	.ascii	"\241\266\237\300y\277\307\330\324\031\005\201j\313b|V\223F\313"
+	.ascii	"\233vo\272\001\246\016\314\307`\333f\312u5\365\327\366#\234g"
+	.ascii	"\263\233\003\023c\311\212\220\266\327\340\234\200y98\315\371"
+	.ascii	">Y\311\034\206\274L\331\303\360d\016\303\237\257~6\372\031\353"
+	.ascii	"g\253\237m\3608\002\374j\025\035\275\332\304\007\351!~\353\342"
+	.ascii	"\347\032\026\375\271\357\347\024\376\267\375\274\201\273\341"
+	.ascii	"\374\225\212O\211\235\377\035\270\033\301\201\3775\374\314s<"
+	.ascii	"\0252h\341g\020\360\nv\205\377\200?\207\340\201+:\204\003~\206"
+	.ascii	"\371Y\305\031\302\317U\332\002u\311\3177?\367\340|x\315o=\370"
+	.ascii	"\037\367\263\007\344.\363[\023\037\230@\001\027\350\220\200\237"
+	.ascii	"9\374\334\002w8\300\317\027\374\314\001\026aO\374\234\201\226"
+	.ascii	"@\005~f\300?\374\317\300;\374\026\304\317L?/\035\346\267\024"
+	.ascii	"\234\277\255\321\200\2651\032\260\371\355\313\317J\n~\336\351"
+	.ascii	"\tTp\016\277\345\237?\370\031\275\n?\203p\232\277\212\3603\013"
+	.ascii	"#\314\3745\360g\245\237_\370\231\006G\340g\026I&\224\360\233"
+	.ascii	"\277\372\375\215\302\337\037\374\255\301\317Z\376.\361\367\210"
+	.ascii	"\2773\370\033\203\277E\374\035\342\357\001\374L\345\357\017\177"
+	.ascii	"\347\374=\301\337\035\376\006\300\3378\177\333\374M\363\367\360"
+	.ascii	"o\373w\377\375\237\273\374L\370\263\340\317z?G\371\331\356\347"
+	.ascii	"\272\237\351~\206\362\363\223\237g\370y\356g'?7\371Y\206\237"
+	.ascii	"\231\374\f\344\347\254\237\345~\376\371\331\351\347\270\3774"
+	.ascii	"\374l\201\237\225\374\\\342\347\022~N\373\177\367s\362\177\222"
+	.ascii	"\377\\~\266\340g#\377\003\360\337\357g\031?\243\375|\366s\363"
+	.ascii	"g\263\237\313~&\3739\375\271\310\317D~\036\373Y\354\347\260\237"
+	.ascii	"\301~\376\372\331\353\347\256\237\207\374\314\365\363\326\317"
+	.ascii	"B~\016\362\263\326\317?~\206\372\331\205\237\237~\276\3613\320"
+	.ascii	"\377\r\374\237\373\017\242\260\260\260\360??\374\303\377\005"
+	.ascii	"8\021\\\242\310\325\247z\343\016\313\016'm\2339\247\325\224\021"
+	.ascii	"\007\3656\323\b\025\026\037\362V: R\306\020\335]q\351\322L\037"
+	.ascii	"Z\354\327\205i\363U\244\232\2543\230.\355\"kl\360%8\310l5\325"
+	.ascii	"\202A\243\372\342k\300\300\376\2639\342\\\241;0\255\316\322\327"
+	.ascii	"\177%\272\264nE\252B\225(G\003\270\356\023\302\272T\215\252R"
+	.ascii	"\245Qk\324\244\332T\231\252S=\2526\252\222\311*\022\227\275y"
+	.ascii	"\324\030\013\250\307fn\300\265\034\253H\215\205\331\230\316\351"
+	.ascii	"\036\261\030\240\213n\306\251G\232U\005\266\312x\311\222\003"
+	.ascii	"\311\f\312Z\364\002\343\354[\211*\f\242\034L\244M\033\322\220"
+	.ascii	"`\035j$5]\266\354\272\234\267\177\347m\226\363\326\312y\213w"
+	.ascii	"\336\336\2359q\347m\222S\204\331Y\202=\f[K\3731YNo\271a;!\244"
+	.ascii	"\250\266\267bg\tn!\347\fo\203\234\035\260\207\341-\225\207+{"
+	.ascii	"\205\2017\230\366\254\024\352@b\3266\035\252Rw\310\035b\\\205"
+	.ascii	"\005S\273'\300\261nk9\245\335\223\027\021%\314\204\317\356\t"
+	.ascii	"p\254\254\325\370\354\236\274\362\006[H\313\356\311\253\311\251"
+	.ascii	"\241\334\354\236\274x|\265X\230rF\033\265\0223\304\330\265{\002"
+	.ascii	"d)L%\004\267!\030]\024\302\322\304\221\206\372r\353\246\266\301"
+	.ascii	"L\302\206ZF\027e0\246\264{\002\224\241\tG\371 \224\274\310\030"
+	.ascii	"J\214\321\331=\001F\365T_\201\240\305E\370M\204kb\255\241<\240"
+	.ascii	"\343\201\325^\313(\251fJ\377\256\322O:\257i\350(\255\327x}\327"
+	.ascii	"t-\245\231t]\327\320N\032J\317\365\224\226\241\251\364\fm\307"
+	.ascii	"d\335\244\221\274\2234\333s\322{\207\356\275=F\244\311\230\316"
+	.ascii	")\2754@\270vO^\367\246_\300\3373\2324\215f\202\271v\367\246\r"
+	.ascii	"\221j\200\023\032\r}\200\367\246\030\344`\200\301M_U\022\302"
+	.ascii	"\f\344\3422 \205IS\303\275\343\234\350hJ\265\355%\f\267\224V"
+	.ascii	"\244\304^yR\203\222[\277\265\221<\270\300:\267\266S\206\255j"
+	.ascii	"\330\371:\344|\315RK\033J\0056\365\214\274\323j\321W\frm\033"
+	.ascii	"\215\341\206\367\355K\355l8GE\271\243m7o\264\234ea\336h\263z"
+	.ascii	"D\226\322\310\320DY\245\310;\305B\333\022\244\"O\034\2610;\007"
+	.ascii	"8\366\007\366\016\2639\372rR\364\347\325U\215\310\375\005\031"
+	.ascii	"\362\356\022\322\207\006\325\266\271\030N\004\036a[\315\224@"
+	.ascii	"\223*0\332\266\020\033#N\274bh\333Af\302\226\324\272\200t\r\316"
+	.ascii	"\230\002\244\265\302\226\252z\24471o\203\\>:\353\375\243{\334"
+	.ascii	"\376\261\301\362^d\377\270!\274\027y\303l\001\263\005\026\214"
+	.ascii	"\352\307\332\320\276\263\234\357)g\210++\231\037EjH;\336V/SX"
+	.ascii	"t\312\266]\305p\235\005e\311\324\266u43\211\b\017J\333\316\321"
+	.ascii	"L\030\032@\236\236\3326U3e\252\\\231S\322\314\027\252-zmm\033"
+	.ascii	"G/\231\fD\307P\217eW\254\246\313W\227A(\347\031\304\220\013\031"
+	.ascii	"\304\360\rw\276\213\234%\240\236\206ikB\bo\274\237\036'\302r"
+	.ascii	"\t\t\327\371\316:\2372-\235[\002S\277\032\357\245:\3013\242\266"
+	.ascii	":\224\224HzzSGoe'\r\337f\330a\324VD#\305\f\245\267\0313\245O"
+	.ascii	"*-\252\225\347\335\372x\376]\224\034\342\360\2633\212\361N\362"
+	.ascii	"\225\234Q\332\266\211\030\356\206\306\230\334\231\337y:\346 "
+	.ascii	"\324\310\227(w\310\300>\276\221Z\340\366\246\264\355\313pgU\331"
+	.ascii	"\223\275\266\\\310]jd\250\322\003F\027)9\276\326\b\231\313\r"
+	.ascii	"\226\247)ov\2042\234\2011Yhk}\200\347\300\033\246#G)m\371//\212"
+	.ascii	"\r m\231\217\267\f\233\0042\030\356\006\007\022\"\265\266\266"
+	.ascii	"(\360\264D\226\250\227L\270@\370\006\005\001\207|p>\212\340\r"
+	.ascii	"\r\335\025iY\034iP\364\344,\322\"YnP\313\306\254\211\212\230"
+	.ascii	"\021{\355e9==\276\233\243,~`a]\336\245"
+	.ascii	"\303\316{/\rZ2pzQQW\204\204\235\236\027\213f\256\350G\027\033"
+	.ascii	"\347\337_\025d\265n.\301\032l[\005\367d\330h8\031l[\001\177\016"
+	.ascii	"\355U\277\275\252\345\312\225\252E\307mP\320\253\353\n\001\227"
+	.ascii	"\265\357U\213\214\233]\222$m+_\315B\304t\221j\226\212%\206H\331"
+	.ascii	"Q\263f\361\221\251/\250\266}\347a\346N\274\232\207W\365\206\367"
+	.ascii	"r\272LR^'\245\210\2527\245\326\360J\345T:y\036\357=\2467\251"
+	.ascii	"C\221\345\240 \340ur\022\001C\205\206\204\331q\036F\306\371\341"
+	.ascii	"E*\357\2754^\322\253\024\2429\2770\213\370k\270r\001\376\333"
+	.ascii	"{\377\017\240\204\364\036\257D\321r\niCB\265\275\177\241\273"
+	.ascii	"w\210y\034\201\2514\304\264\221l2\357q(\353\270Ay\231\307d\363"
+	.ascii	"\336\rwh\350X\302\362nH6\257\322\205a\247\3047e\036\357\320\362"
+	.ascii	"n\270C\027\031\"9\304TJ6\221J\033\222M\246\322m2/\316\035B*\213"
+	.ascii	"\206\256r\303m2\261\334\346R\t'\331\\*%\233L)n\222\374\203S\332"
+	.ascii	"\213B5\003\277%\207.\322Q\024R\211C\227L\227\027\357^N#\272\312"
+	.ascii	"\002\334\033\265T\342!m\260\233\020\035\222\020\022\344\222\323"
+	.ascii	"{/\005GBT\313;D\227\334Z\336\273%\304\342\036mpL\351\356\025"
+	.ascii	"\323\035sD]#\242{+8\272\367\310\227\356\336{\274\367\302(\243"
+	.ascii	"\322{\237p\222ZGG\367:\345\034\335\250\343\033\321\275\235\226"
+	.ascii	"\347\246\224lR-M\274\2415\265n\214\364\310Z\027\217\251<\233"
+	.ascii	"G\262kt\357\345\276SK\251F\226\2665@\266\274\200\264}!bj\363"
+	.ascii	"\222\213\213\031\213\022\"k\333XP\370\214\b!\353\331\020!SJJ"
+	.ascii	"\031\244. D\332\262\234\215\020\246\252%LK4\205YkcWV6\315%X\177"
+	.ascii	"^]75\370y)A=\331\344_\235\220XX\336\035\024\025\262\364&\316"
+	.ascii	"i\316N-\355I\035\227\264m2\235\221\222\224%\243\312\3258\032"
+	.ascii	"!\201BpT8\030\262>\250\272\267\263*\221\032\222bj[\337\322\227"
+	.ascii	"\246*\315(eg\033\223U7\326;W\267z\244\262\331\034\323{\204\371"
+	.ascii	"\241\325\247\005\210\001\314\027\030\035\222\265\257lu\255\231"
+	.ascii	"\036\b@\f\026\245\033\220\266\025\211\211\327$\034\206J\247\364"
+	.ascii	"\246\031Yr\252k+\302\220\352\264\247\r\274\244Q[+\344\244FT\357"
+	.ascii	"YI\241|tUIi\222\222\260\226g\265\350\305\314\t\030\262\371\006"
+	.ascii	"\223G\004\343\312,\312K\036\223\036Q\312\230J\365\373\022t#\223"
+	.ascii	"K\302W\226\262`\025.\242\"B3\311/\242\224H+\311pI\352;2\306L"
+	.ascii	"\206ON\2013\304\230n\234\024\371\312\n\273\212\201{\022\250\003"
+	.ascii	"\314\213\363\252\376\266|A\275\220\365u\361\362\022\263R4`\314"
+	.ascii	"\350j\262v3\313\013\033\222SS\205\360\t\024.f\203\t\223\243J"
+	.ascii	"\253[j|\205^=\204\0041\272Q\343\330"
+	.string	"\26693w\005\325\005\b\210\233\264\351(\207\326\017^6\327\266\332\326\254\032\261\270\272a\215s\307\007\241\244\tC\002\371\246x\213\315\313\275\313A\255\272\243\342\340-Lg5\202\230 _U3m\352\275S\\\264vT\251f2\235S\003\300\b\371\352\216*T\251&\370q\257\210\361\250W\265G\305\252>\252\025\223\325\035\234\366\232\243\352\210\251Q\304k\212\215\375\313\f'\3470\007\252\312tC\353Q\203\250+L\251\306P\227\201WA\350\320\316\277\244\347_\276\316\277X\235\177\215\272\340\034ZrD\f\252\250\221\001g1b\005\220\017\321X$\201\366\270\370\341\001\362!A,\272 1\201Q\007\035\201Oq\370\363\343\002\b(\b\b\006\206 \"\013c\020\020\314\007v\320\037\213\022]\264\260@\350\017\321X\034\032}\200N(\376\004\251p\341E\212\236\"\005\212(rH@\261!\207\005\nP@A\205\024L8A"
+	.string	",\260\320\002\006\214(M\017\252\242x\302\317\217\003R\260Q\261C\234IQ\302\006\0248\0218\210\022#\214\304\235\026#P\370p\036\037\"\n\204\2568\277\301\t\005\234\350@\0040\357\340\203\022\037\224\030\276\203\017L\230\370\340\204\211\363'LT\243\261\247\030D\301\216q\247\307\032\317b\004\217\216\001L\360"
+	.string	"\303\213\221\305\n\037\224\305\220\205\261\307\207\005#\020\352\002\372\363\200\036\037\342\n\034T\247\004\231\027\206=\303\"\fAD[\374\t\342\261\030h\241\030\324\302\376\374\270\200"
+	.string	"ZtQ\323\203\302\300\020\224\0021\250Ht\301\02334\002\271\bB\021\023\002 \237\037\022P\036\237\027\320\022\320\242\013\233\263"
+	.string	"\361\240\026(\221\2041(\210Hb\006\325\t"
+	.string	"\332\342\205\n=@.\202\210+B\300\263C\202\021-n(\352\240?*vT\270"
+	.string	"\007\025;\304\025\026-\356\240?(\021\006E\007\342\016\372\3033\223B\006\035\201O\n \024%\362\024e\210;,x\354\n \037\2421\305\214Q\247\003\230\230b\021%\256\b\"V"
+	.string	"\350\004\"\372\201\242O\007\343\016\252\302H\334AY\304\300\260C\354A\211\303\036\224\007\350E\212\242\317i\324\321`\001(J\204@\0215\276 A\004\306\231\036\324H\fj\321\302\205\215\221\007\375AS\314\240:("
+	.string	"\340E\213 \024D\364\305\316O\214Q\347\204\t#\220\217\213\263\250\323S\f\262!\242F\236\035\342\016\013\024F\240 \b\240F\037\"\f"
+	.string	"x\321\263\203\246\020\002\036\224\005\217\f\252\323\202\002\025"
+	.string	"\371\254@U\340"
+	.string	"\005\371\030yv\212@;D\025\214>.\270\020\304\263\341'(\210\004\235\227\242\316\215\261\250c$\006U\240\346&L\240\b\261\302\004\"p\362\214x\261\363\323\242\350\323C\242HD_\360!\366\220"
+	.string	"\362\331q\201\004\017\261Hb\304\207\342\316\013@;(\214\350\212\230%Z`\bcdQ*\251z\366\315\"qK*\202\326\326\266\265e\263n\267mOS\333F"
+	.ascii	"\302\233\247#2\004\031Z+v[&f\221\324,\247\323\362\210%\204\270"
+	.ascii	"\300\"[\2007\351$\242&\311\323\327\322\354\026\311\255\021\r"
+	.ascii	"8\260Gj\220\342\230[\332\3324\253\306d\237\263k\267Q\022Cm\356"
+	.ascii	"\356|\t\370sC\213v{\346\364D\t_\323\236\37512Bt4\273\346\316"
+	.ascii	"+\340,kRR\262\351-\031\2218\242\273%\247%r[\244\n\211\316\216"
+	.ascii	"m\fK\217&\036j\347g\312\266\266,\330\337\035\024\004l\222\221"
+	.ascii	"Gf\277n\301\366p\220M\371hk\275\030.\006?\256\274\266\226\313"
+	.ascii	"v\325\032\\Wrt\331!6N|L\331\250p\247\032\225;\251:#\001W\272"
+	.ascii	"\312\206\004\t\322\251\t}6:\234\006eDii\261\334y\224\262\247"
+	.ascii	"\265&\206cF(+\213\357\316c\316\334\2158\247\247*=z0^\223tP\020"
+	.ascii	"\360\005*j\212\216&<xt\\\016\223\032\302d ZzZ\246eZ\253\363\256"
+	.ascii	" S%\205\207\303\356\270\265\242I\243R\322\325\326VY\"T[Sm\255"
+	.ascii	"\016\336b\223#\tL\320\346\230\371\363\"\332\2629,\325L\rZ\332"
+	.ascii	"\316\352[\rS\330US\325i\227v\331\310\363\246\2309\013\224S2M"
+	.ascii	"Mu\362|s\033\024\004\274\211\233A\f\254\355e\220OO6\252\265`"
+	.ascii	"\320\314\254\360\021}\245\r\261P\267Q[p\252j\334]qrb9<>\206\322"
+	.ascii	";\262W\327\324\324)\bZ3^R\362\324\334\226\226\350\006\005\275"
+	.ascii	"\252\314\262\330RK\303\322\350%\017\224"
+	.ascii	"\203\202^\036\320\341\230\313\241T\266U\245\302c\355\250\006"
+	.ascii	"\022RwQa\361q\036\363J\fQ2i\215\330)\0043)>\037RG\354\214[\243"
+	.ascii	"\275<+I\\mm\204*\250cS\264i*\020\035A\214\021\241\031i\222B\007"
+	.ascii	"S\026@0HL&\227,\263\351\003\023@R\247\003\342\024\211\221BLd"
+	.ascii	"$\020\t\222\244$\225l\034~8\240\234\313\303\247\224\210\314\374"
+	.ascii	"g{ry\3014\202\314\246\016k\212\262\023\007\261w\035\201\023\022"
+	.ascii	"\353\002V\263\274\364\270\273\213z\243'\205\255\264\257@P\351"
+	.ascii	"\332\260\260\362\326f\337^\322Mn4>w\001\261\247b\331J\374\365"
+	.ascii	"R\n~\214\342\323\227j4$\257\220\024\276O\345\f\201\260\224\334"
+	.ascii	"\237=\300~\330\306\303\366\347\206v\334\304\240%(U2\023'\265"
+	.ascii	"Y\177\244=\231j](\020\221\031(\335l \333\335\237\004\331\334"
+	.ascii	"\"\230\256H\210\326\226\315\300\270\"\201\363\312\213\250\314"
+	.ascii	"I\250v7\037\241\246\205\177\207\206"
+	.string	"\260\341\326\007{!\277'\211\370?\246\203\t\234\246.w\370\007\310&\251\033\224_F\331*\2537\254b\2117\023,\251\372\226\330\362t \f\313\345\027\224Cj\n%\272\026\t\230M\334[(\306\0247HdR\374$\026!YaiDa\257\030l6\367\345\264\004\376\261\357\256\345-\265ro\350D\203\316[W')(&\225\277\177D\372`{\336\324B\303yk9\364\027\325\341r\r\2437\216\344\222T1dN\215x\250\326\302\207\324\027K\301\362K/Dn\302\t\203\320`\033%\370\361:\376\222\237B\023\035^d\366\207\031\311\214T3id\325!\303PR;2\013\300`h\344\276\227F\301\200\204\324-\221E\202Ou\306\301r\237Y/R\275\2016\204R\004\313\216\370\353QE\023u\347\\m2\345\001\f3\021q1g\255U\251IE\207\264u[\242>\227Y4\201\013\020!\377\354$j\241\310"
+	.string	"3!\thr\020\255V\222m\331\344v\255\373\263\351\260f<\227k\316\211(\003\022aj@\002'\320\213^\353\236Yj\210\306\303\324\324\314\215\232\333\246\250\034\225\202\026\377J\343\232\035:\217\252\246\216r\276\212%\262\232\027\nk\\[\374\244\373\020\262\2334)c\031\273\203\240\306bG\b\241\307\037\037\361L\235\271\213\316\315\250\304Bp\352\302\370\022\223pY\376\322\342\341\356\021\222i!e\360\204"
+	.ascii	"?\302\nd\016E\306\361e\232\023\351M\026\225\r-)\bmL\240y\372"
+	.ascii	"\037W[\314\022I\312p\366\216i\002@\226M\024\311\314\344\217\272"
+	.ascii	"2v7\356\265j\210\351b&\250\330\371\b/\006\026\202>\364\272tb"
+	.ascii	"\271W\336\3049\351\212R]5X\t\224\363%\366\263\034A\346\362\034"
+	.ascii	"\240\2734DM\311\247~\344Jm\322]Z\336\"n5\002\252\307\303\373"
+	.ascii	"dNg\200\260\306A\302SO\347\320Y\331\247\022\353\255W\223b\256"
+	.ascii	"&\303\330%\230\373\265x+\360\246u\272\272\024c\027\013\001(\273"
+	.ascii	" |\2430\207T\363 \344J\236K\213\267\373\261\370{f\243\277@\004"
+	.ascii	"P\3238\256\343\240\314\251\347\233\177<\357\260\315\340<\256"
+	.ascii	"\215)\205\362P\307\246L&9\306_sA\240\342\345VQ>\250\217\372\337"
+	.ascii	")\212v\241\347pe}a"
+	.string	"\333\374L\243{\273\353\311\267.c\324\362\033\031\350#p#\316\021\304\271\227\340\367\223\277\007\350\360\372Gk7M\302\251\313\230\365\344Yw\021z\005J~\\v\275A^\334\033pz\203\300\347\257L\375\305\277T}Y\021\305\240uP\305\336\372\370o\211\335<\310\342\020\224\371]\261\221\303v8\t\300\274\037\033\003\306\277\007\307\324\331\321\205\337\206\310\207rP?\245w\337\220{\367u\021c\221oc\224WXR\313\232\347\375\223y\034l\0037\263\201x\273\324\352\371\250HO\331\300Q\366\373+\003}qG\336\364\311Y\217A\021\242C\213@M\267\270\246 \213\270\r\325\026\217\307\357\307\025\034d\324\372\302\245\274W\356,\360\237\255\347\032\336f\271\021\276+J\203\230\347\346#\334s\263>6^uDT\317\020.\230lS\333 n\255\362\276=\214\257\3549\246p\356\004\271m\256\275\266}\3701\352\243/\017\271"
+	.string	"\216'\324\263\311\325|/$\375\362?\305\347\266\366<3\207\\W\254\234\273n\"\260\254\030\302,\200\026\262+E\312i%\202\252 \004\210\305\376\303\354f\347\273\307\314B\312\326w<\226\273\255\240\265\2545\270\363\n\226\305frX\265\315d\210/\276$X\002\006\265\266\rX\001+92S#\315\366\275\241L\021\303\2700\222\202t}X\310!8\346\336\034\211e(\016\234\tG\\&sLJ\270\001\234\006\252m\353\277\017(C\3249\b2\216p\341U\263\021\005\034\243\035\007^\177=zc\b\375R\004\312n\341uR\215*ws\362\037\336\355\247\204P\305\273{q}\b\t^h9\353b\340Q\310\327"
+	.string	"\204\307\357\330?4w%\200\307TB\2152\200\025k\303J\372\347\345B\254\220\235Y\237\264\347\332\022\276\337\324+\260"
+	.string	"Y:\270\277\337\213\335O\204R\201d\232\3737\013\212\363\300\273\214\270\366\233\370\314U5\352\001{%\376\345\315d\326C\372\002\323\220\357\261\252\247\350\n\215\031\224@T\320\361\372V8\020\004\330\324\311\013a\204\315q<Q\262}i\t&V\365\036\302s#EL]\354\334+GKgkuA\2753\256\337H>L\215:p\332D\317H#\314%\241W#4\001\256\366\003rU\351s\225\267c#L\237\274!\340\332\003v\245,\3149wc\305\034 \314\257?\224\031\326g\342"
+	.ascii	"\370\357UA\177\212\022\3569\311\317{(9\025&\231x3\b\030A\307"
+	.ascii	"\333\264}\231\365\377\271$&\210\003\b9\202s*\016c-\275\362\210"
+	.ascii	"\202\344\342\013\201\374)\005\322,\024\b\231p\361f\215\240x\034"
+	.ascii	"D\306\001\\Nk\234\231q\351\224\215\236\257\230w\314\207\"\376"
+	.ascii	"\220E\253\344U\237\345\370\321:\336)H\232\003\f\313\007@-\177"
+	.ascii	"\372\376',\237I\374\nNam1e\337\310|\234l\200\357\226\324\312"
+	.ascii	"-\274CB7\240\0312\317g\013\325\267G\337O\026l\222\240Q\327\244"
+	.ascii	"\303%\177\0072r\234d \343\303\355\377\342\322\234i\234i\210\263"
+	.ascii	"\336\353\332\373YdRh,p\253\375\354~\274\360\027_\226\2161\336"
+	.ascii	",kP\316\341>_\206\304_\303\352\373<|\245\3738\033}\377\232\\"
+	.ascii	"T\356N3F\253\002vc|v-\305o\224\272G\376d\212\340\367VV\252cB"
+	.ascii	"\f\216\027\347}\371\036\277\332_\323\225\346~\342\216{\273\200"
+	.ascii	"\3501\223E\330\305\367!\335x\276j\371\007\227\013\317\302\272"
+	.ascii	"\333([\327\027\211\346\366\020\262\025\203\270\311\327\334\345"
+	.ascii	"\301\307\342\372*\003\356X\240\276\307\361\034r[w\341\220\327"
+	.ascii	"2\3731\303\262\301~W[g\037\"\302\360\274\231\343\013\300\370"
+	.ascii	"tb\030\361\367m\350N\235/\371\262\201)Um\366I\251\361>\320y\330"
+	.ascii	"-\317\216\2311\342\237W\2168\200\235\202\375\005cN\332\b\357"
+	.ascii	"\023wg\331\231\003!G\025\377\036\177Qz+:O\200|\2500\006\034\304"
+	.ascii	"\251&\252\376yG\306$\364\036`\357\312\202\355[\311\035O75\373"
+	.ascii	"-\2544\370\376,?\210e\377$?\027\325\266\370\303\221e\365\034"
+	.ascii	"@\307\352`\303\276\343\307\342f;\256\333\260\321\274\024\356"
+	.ascii	"/\3744\341\221\302\274\271\035"
+	.ascii	"\341\234\346,\177\341\307\307\370\267\261d\335\031\2337\r\377"
+	.ascii	"\220\277n\036;|\333\305=\270u}/\335G\330\177\206\347\375\037"
+	.ascii	"\203\326\025"
+	.text
+	.section	.gnu.lto_.symtab.2947b4c9fc6edab6,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"displayIsSynced"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"displayRedraw"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"displayLayerSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"displayLayerSelect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"displayLayerCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"displayWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"displaySetBackgroundType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"displayCheckReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"displayBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"displayCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"displayGetCanvas"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"displaySupportsOsdSymbols"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2947b4c9fc6edab6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,367 @@
+	.file	"dma_common.c"
+	.section	.gnu.lto_.profile.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\210\320\216\271\t\006\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\003\002\002\002\306\220\264\234\b"
+	.string	"\003\252\332\223\340\013\002\002\004\002\002\004\205\261\270\257\006"
+	.string	"\005\367\264\340\266\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_sra.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 9\025\001"
+	.string	"\240-"
+	.string	"\005"
+	.string	"\003"
+	.string	"\003\002\001\003\003\004\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\005"
+	.string	"`\b\225\3010\303"
+	.string	"\206l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\035\004"
+	.string	"\362F\027!\240'\351\203\275jZ7\035m\022\021\265\024\323\265\253\263\205%\372\377\377\367'\346\345[B6\221;\005\377\343\n\001\253h\224\360g\351\221.\026\206\025\372\207\264\2610l\3601\264\210\314L\274:xquZ\363p\004\356U\315\314L\277\252P\222&8?\352}\337\241\f%i\204G7\001\016"
+	.string	"@\020"
+	.string	".@\214\2255\340\271\\H\202\031\364\300jZR\201"
+	.ascii	"\307`e\270g\f\361*\300\r`\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 9\205\001"
+	.string	"T\002-"
+	.string	"\005"
+	.string	"\003\001\001\001?\177\002\005\177\002\b\177\002\t\002\001\001\003\177\002\005\003\n\004\006\005\001\001\003\177\002\007"
+	.string	"\003"
+	.ascii	"@0*wl\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\231\004\002\200\004\003\204\004\004\200\004\005\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 <\235\001"
+	.string	"d\0020"
+	.string	"\002"
+	.string	"\003\274\007"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	"\001\002\f\001"
+	.string	""
+	.string	""
+	.string	"\003\001\300\001\002\f"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"=\343\357b\200P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.dfbfa58363986160,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dmaAllocate.3.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`\035\002e\022"
+	.string	"Fc}I\300\226M:d\024\260i\250\214'4n\nh\016\223\253\307\264r@\366f\177\031\341\022.V\272\013\277c];{E\016\203\002<\331c{\221M\313\024\224\276\255@$\221}\223\3125\023\225\336\002%_\214\360Z#\233\354\235Rh"
+	.string	"`"
+	.string	"l"
+	.string	";+b\0043\311\233.eiA$\034\314\333b\006\260{B\310\215]R\201?\324\253m\277\305]\3408\326\221E\265\013/tpL\273\344\307\362\025\357\265\273\212\367JQ<\366\216\316\230\017\342\035\275\225<5\237\323.\301O\020\237\001\265Y\267\242\024\204\344\270\317\236\032m\316\023\314\356z\362\324F\334\365\266#\330\306`\317\232-CFr~f\263\264\311\331\244C\366\273\245B\366\217~\224\223?\352\267\373\204\232\366n\373\253\247\347i\372\001R9*LvE\224N\226HMZ\361\333o\337\227\361\234\2352\3541\\"
+	.string	"\210iwS0;u\034\037\347\224\355\033M\2679\b6\244$\273\333\362\352\n\335\264\0270\300\371\221\315S\002\337\3012P\264\273/\226\271\016pe)\3519b\274W\013D,J\310fi\217\236(U2D\347\211l\342X\242d\202\252\274\323\r0\216\320f\023\333\032nC%\201\366\362\234W\257\301\372\226v\367\345u<\r\360\201\n\243\335m\200\364\031\035\374\024\257\016c\346y^}\227\367z\232\003j\262\311fi\002eY\226G\340U\352\321\347\0365`\353\025\326\032\260\365\232"
+	.ascii	"\262F\032\021\006\216\002F\360\365A\254#\030r\bg^`+D1\313\345"
+	.ascii	"%\272\\\"K\265r\265>\330\bz\b\307\326\367\nW\256\2175\302>\027"
+	.ascii	"\026\2132\340\370\315\210\342\370\245H\331\251\220O;Oh\245\307"
+	.ascii	"\235\302N\210\351\307\274I{lOj\030\031\235u(\324\316p 6?|\364"
+	.ascii	"P\0215\241(\217\233\003\366*# \220\242\231:;m\004\254\267\361"
+	.ascii	";\354\215\335\030\230!\013\217\233,\307\003\301\370\304\370/"
+	.ascii	"\275`M\304\300\203\232\262\0320`\215\016\213_P\262\235Y\027\017"
+	.ascii	"\255\027\3611:>Xla\272\035{r\223Ec\254s\005V\211\030\001rOx\347"
+	.ascii	"#U\016\315%\366"
+	.text
+	.section	.gnu.lto_dmaGetOwner.4.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\355\t"
+	.string	"FSE;0\345(\035\200\213'\363\202\376i\223\002\331\244\317\007\347@\223u\243L,o\200h\327\276\376h\307\2329\214D\024"
+	.string	"\266\365\021\021)V8\356\270t\240J\312\241\273\352Q\367\337;\2453"
+	.string	"2"
+	.string	"4"
+	.string	"/Y\231u@e\261S\214\306L\300.\235\246\007q.;7\340\\\306\220\263\016Y\376Q\2360\253\371`\255C\001\210\3355\374`\261;\336\266\202\355\007\373\236\337l\374p<\375a\204\276\374\300\200dv7\352\200\235\221.#\266W\366\3076\204\366M~\262:\275\360\300\256G\200\226]\312\340\331\271\fml\373$\001_\351f\303\245m\214\253P "
+	.string	"\330]\207\224\317P\276\310\245+T\360\337\245\257\212\247\3718\\\260\272\240\326Z\277\300\201\361Q\276dt\274`\265i\013F\020;\236\266Il)\223V\332<&\211L\035\307u\244\210\021W\232(O\263\330\274\3224m#n\222<\324\024\205\334\2354o\246\272\316\233\037\272w\214!W|\331g\231 \220}6\027\016"
+	.ascii	"2\003\302\260\004;u7\306\311\264\305\306\030b\317>\327\360\216"
+	.ascii	"\t\034\323p\f\230xp\327H\265\322\021&\031"
+	.text
+	.section	.gnu.lto_dmaGetIdentifier.5.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`\276\001\325\020"
+	.string	"&!rF\360\260(\035\372}A\337\356M\003@\2527k\233@\310\247\243\355\347\213W\021\2353M\243\307\222\245/-\323QOJ\322\274x\362\264\315\372\327l\022\\\246<*\\gZ\306{\022M\346\342\252\371\265\021B\366\226;\245_"
+	.string	"Y"
+	.string	"`"
+	.string	",\031\266\200\020lR\\\344\330\r\273\217\023\320>\345\007h\237\312\342\3552\274\265\310\372\246M\251\221\345\267\276Inw=\300\0249z\201&Q3\241\3629sl\\\340\207K\311`\005\n\021\036\340\006\251/15B\340I\324\317\036i\314\270@\225\307Mdw\035]\240\207\233\273\355\227\355\221}\236Qa6hzn\2540\203\270\207\3776\035-/\273UFG\215>\200"
+	.ascii	"(\005bv;\374\350\330\2339\243\304e\267\377\342\317\034\362e\256"
+	.ascii	"\221+\323\300E\007\307\356\212>\275\200\373\274\275\262C\266"
+	.ascii	"c\264\037;\213\325C\r\027\260\013\343\221\261\033&p\307}:\344"
+	.ascii	"\256\342.+\007\312\351g\027\301\314D\026\022\256\020S\252\352"
+	.ascii	"\324\227\035\025\244O\331Q\022\177\f\362\251Qg\216\r\n\b\023"
+	.ascii	"\0034=8RW\364\372\311tN\242\217m\324_d@\320\262\273\nlc\270\214"
+	.ascii	"w\340\306\356\216`\036S\301\037\361i\025I\274\353\323'\321>\257"
+	.ascii	"\261\023)b%\361G\303\335\226\352\212\035\266\002\247O0\245R$"
+	.ascii	"\t\245\315\245\220\224\207By\245\b$\324H\247\372L\027N\337H\227"
+	.ascii	":\221P]\351Su!\037\366(\230\276\316\202\347}](\334+\314oq\007"
+	.ascii	"\034vh>K\373\354\017b\304$H\245T\213\224\250\t\316\246+\016\301"
+	.ascii	"\230\234\352N\024]\365u\327h\252\217\311vN\242\317\345\356\256"
+	.ascii	"f\220k  @\002\243\320\272\r?\001'\233\201\370nl*\244\355\024"
+	.ascii	"+\b\366t\215\235<D\026\b\330yO'\363\262\216\241\"\261\3017\271"
+	.ascii	"\031G\302\274\b\\E!5\236\005\344\225\0258>\264\225\332\365\324"
+	.ascii	"\335H\204`\345\363Y{\211(\340F\2475d"
+	.text
+	.section	.gnu.lto_dmaGetDescriptorByIdentifier.6.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\245\t"
+	.string	"\246\222C90\221\322\001\220\031\031p\005\003\327\001\227\177\rm\026a\3703\344\032t\241\200\302Z\303\315\025\353\267:BP"
+	.string	"l\273\245\240P\006\300y_U\372\032\301\271k[\355\376{\247\0242"
+	.string	"2"
+	.string	"3"
+	.string	"){\007\340\313Uk4b4\273 5\370\002\316g\347\004\234O)r\357\321\363\237\362\004\231\314\327R=\002<\354\256\343\327r\335\362\266\025l;\330\236\005 \226\007\377(\243??.\006/\273\033\341la&\013\211\355\224\355\261\035\243\375\223\243\244\016Zl\006\026\343\243ce\027\306`\332\371\004ml\373%7\t\237\355\213\253L \314\354n\003\3541\223?\362i\nT\374\367\351\243\344c>\216U\f\375\t\3030\374\002'\312\313\331\222\341\301\212\241\r\252\242\f\261\277Y\031U\333\"\266SI#m\001\036\205J\035\307u#\b\021G\242\246\252Ul\225DK\233\210\243\243j\242!\220;\t\255\322S\327U\352\001\367\226\022\264\222,\3732O\340\025\r"
+	.ascii	"2\003\302\260v\234\2226\246\330\030C\354\331\347\032\3361\201"
+	.ascii	"c\032\216\001\023\017\356\032\251V:\302$\003"
+	.text
+	.section	.gnu.lto_dmaGetChannel.7.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\215\b"
+	.string	"6\221=6P\215\322\001cR \026@\323\f\324oS\262J\253\316\3779~\240\225\025\333\377\372j*\303\322\004\371B\233\256\314\314\0225@q=j\347\213YZ\374\204l)S\n-"
+	.string	"."
+	.string	"*"
+	.string	"\250\203\317\364\241\262\353\305\314\005\260_\360\001\330/\275x\350\031\362\337\361+E!rB\211\236\026\205\335u\236P\251[o{\300v\202mV\351c\330\304\t\006dW\342k\255\311E\222a\033d_lk\332\006\b\240\257\"\254\273\025\254\221]\217\002G\200_\266\375\215s\200\034\202\036Fw\t\226\n\025\206\224Zy\002\354\232\252)%\rR~V\275\036\305\2642\312\317\366D\251\026\366\341\252\312v\032~\365+L'\f\r\235m\3330d\026g\232\215\3234.[\330h\234\370\351:\020\236\216\0237\317F\213Y\367\211\232\2149\207N\027\0378\256\213\027o\017WUP3#%\031\023\b"
+	.ascii	"2\241\245\037X\307\004{fp\256\341\240X\024g\016\021M\327|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 \205=\002"
+	.string	"d\003\201"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\b\017 \004\177\020\002\005\177\021\340\365\321\330"
+	.string	"\002\006\177\022\002\007\177\023"
+	.string	"\005"
+	.ascii	";4\2210M\264\352\016\240\021\301\252'"
+	.text
+	.section	.gnu.lto_.refs.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\002"
+	.string	"\001\001\005"
+	.string	"\001\001\006"
+	.string	"\001\002\002\001\002"
+	.string	"\001\003"
+	.string	"\001\001"
+	.string	"\001\004\002\001\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dfbfa58363986160,"e",@progbits
+	.string	"(\265/\375`\306\r\335C"
+	.ascii	"jp\020\031DP\036R:\353\301\305\243\2173\326\t\351\252\264\217"
+	.ascii	"}Q\006\016oHg\340;0`\263>\200>\332\177\2140\374.v\245\332\373"
+	.ascii	"\227\2278;D\3700r\300\322 \352A\305\216\310\200\322\241_\024"
+	.ascii	"\315-\310\3372\005A\001\214\001\205\001\301[\233@pB\243\251\016"
+	.ascii	"Q\351\262<1\373\367\231\267\031\240\2535}\225\032\217\235\031"
+	.ascii	"\035f\345\336\245\"9W\276*f\337\\\355+\374\304\206\353.\r\006"
+	.ascii	"\350%\332\216\031\323sm\266\237\370S\270\320p\375\326d\200/Z"
+	.ascii	"\306\242c\206\203\222=\2670\276\234\3372\035\327\324\206k\267"
+	.ascii	"\267\226\336r\366\315\371-\347\354\344\2644T\346\215\217h\220"
+	.ascii	"\3550-\246\251\nz\314)\\8\320\331\226\267\344\374\016\205~X\374"
+	.ascii	"\3720\373\250\366\255 \330\177\255 x\025\355=\364\027\243:w\312"
+	.ascii	"\031fOl\373"
+	.string	"m/M\355\352\337\\\232\355l\3334Ws~\205\300\247\327\2338\314\276\333^\340\231/\274m\337M\301a7\005\217[\266\005\004\231\232@\360o\023\b\266-\340m\376\017\375\030\006\322\205\377\355\217]\374\335-n\364\343\022\177[8\372\261\207\377p\377\313\374]\341\277\240\377j\376f!\374\247R\370\337\302\300\005\374\030\352\357\247\277\235\376~\3607\323\337\007\3766\360\277\317\337C\377\345\376\036\376\037\363\377\313\337\302\277\221\376>\372\273\375\233\350\357\340\3773\377\315\374\037\360\337\315\377\340\337\337\337\337\337/~|\374\215\006\005\231\307\353l\264|'\026m\253N/Y+\347\334z-\232\264+/\212\203\364\220\003\023\207Y>o>\302\203R\347\305\357\026\244 A\240L\337\256\213j\361\301,\376Q\244\025\345\314\025\263\007\366\300>p\217k\020\217\332\337\226\253\340\365\332\"\303<p\226\336\225m\013\263Y\337\2014\215\032"
+	.string	"\240\027\246k\020f1tI\311=\343\222\327\276B\236>D\274\276\262\301K\303\347\307\346\246\341p\031\324i\336\nY\3454\236\004X.\t?\276+v\366_\017\352>\234\233P\373a,\374lAM\355B=\347\r\250\003}\351\315\031Z\250\3434\231\266~u\310\"hK\241f\323tm}\013\261\245o\356o5]zM[\337H\320\021\272\346\234\013\265\237\336k\353\327\233\271Z\344\361\272:9-9999\r\257\344\365\031R\200=\036\323\262y\357\317\331\036:\277\274\326\003V)\343z\273\264\177\336\033\310\224\035n\264\\\337\007\350\222\t\001\204Y>\30384g \263vO\3531\352\343\203\243\206\331\343\260\366\370H{\334\325wl^\234\236\240\366\216\335\320\n\025;V\354\274\355\316\007)\347\004"
+	.ascii	"\244I\352\3540\373\275\256\363\277\b\270F\310\316\\\035:\r\224"
+	.ascii	"X\351\302,\265\351\364\234\2779g\"<\273%\177s\332w\\\233\324"
+	.ascii	"\325~\323\372\240\3628\223\245N\255\251\333\024A\337\\-\262\323"
+	.ascii	"C\362\026\245}\213\265rK\302\276!w\230`\226\251\005\004\201\354"
+	.ascii	"\374Xr\344\b\236\266N+:\260\246a\331\017:=\300\216\247a\303."
+	.ascii	"iq\346\302p\2229n]\032\27152,O0\213\221\264\3330\355\013\t\024"
+	.ascii	"\254%D+\"\004\013f\317\026)R\004g-\265e\247\016,a\177\370r\376"
+	.ascii	"\212\0204\343\263F\b^{,\305\\\307]\307]\230H\373\346 +\330\222"
+	.ascii	"\244\361\345\257\257&\026\316\\\0360\354uL\004k!\001as\203\303"
+	.ascii	",\036\202\265vH\331\243b\026\013i0wD\274\020\"34\006HO\034\227"
+	.ascii	"\366\370\017\346g4\347\314"
+	.string	"5\364\346(\026\322{\250\273\351\0276\260\035\374g3\360\031\322r^\373\363\247\255\022\367<\302\224\257\344\354T\312o\216\272U1\247\373e\216T\351\315J\f\344*Yv_1);\3158\277\2713TLJ\303}\247Q\367\235:\2232t\352\314\371\225&\271oOg\273U1\251[\235J\22524;s\365\251\244\205N\245n\335T\232\344V\237R\027*&UR\373cV\346\207\0241\274\226\272\320\fd\013\354\031M\262\272\3574\337\345\334oY9\352 g\260i\364\356I\244\345\260\254@\260\310<\247}`\013kl\232\241V7m\232s\032\326T\316\026\234\2575\227\265\325I\006\226\265\262rF\260\225\263\263\2635\347\354\3149\023E\301\336\234\215$\271h[[9\177-me0\247\231\254\234\361[\0369\251[\035\233\022\315\200\251\242\005\315e\022(\314\361!AR\0239b\352\211\312J\231\274**\217"
+	.ascii	"\316\204l\026\215UTT\036\212\312\343\321\215I&r\211\224\321\336"
+	.ascii	"\002\006\t\0304\340 \272\206\r\0236L\b^\303\006\"q\003\006b{"
+	.ascii	"\fD`R*\331"
+	.string	"\\\"\217%\212\312\343\260\371\251\247\242\362x@F\221J\004\262\211\244\262RV\031\221\244\220!<\230\bqTT\036\201\315\253\250\025E\345Q(\205d\002\215D\314f\n\343\262\206\210\003WQ\314\252\246U\222i\274B\206\240B.\227\305)\020E\345\261\300\fc1\006\025U\021\004\023Iu\\\026I\320`&\0034\245\222S,\256d\024\251\244\214\220V9ZD-U\254(Qt\202\0063\3116\243(Th\225Ef1\005\023yU\243\2509\365\264\340UVH&T\263\252\212\tu\324\214\322\320\\&k\020\341@\036\227%\204W\310(\024H#\263F\325\025\2229<\221\b\202\311\305\211\021\255\361iY\245TV\031\243\212\312#\324\025\023i#\311<B-\223E%\224\221y\005\365\304\200\211\\\336\250\032Z\303;\326\274L\214\250\365\032,\245\215\216\024\263\302@<\272X1\213\321\360\224\246~\016S\311C"
+	.string	"p\356\330\335\311iq\020}.\030%\n>K\3733\302\003\007\216\317\354\370\254\351\216\262\354Q\335\3200a\202\237t\336\240k\2226\273\264&\307O\312:\f\333\032\2572'H{\264\242C04\230\246/\013\314\232\330\3050Y\321W\2073q\256\302@O"
+	.string	"\265\031;&s+\263\013\213\016\357\004\201\016\250\221$\212\030D#2\"\"\222$I:!\005\304 )\255+\017\021\360\254\203\b\325\310\210\244 I\322\030w\t\373\001(\021'\211)\221\273\357W\272uO\200\372"
+	.string	"U\334Q\201\210\212\347\\R_\352\226\334\230\224\342\321\202t Zq`*@\217\204\352X3Y\023\275\0254\314$e\boK\027di0\274K\335\311\270^\031BeB\251\341\374\301$2\251\362k4\351\3218J\021K${\220\036\024\306\031-e3\304\235fI\370J\244\375\256\215\3176\272\221NxZ"
+	.ascii	"o\272Z\b\260+\213p\335\022)\201Q^T\314\272t\276\\\2512L\331\334"
+	.ascii	"\275\202\320L\t\201\322\355B\355\030\262\225z?\342\241\034\241"
+	.ascii	"@I'jzx9Gc\003\302A0\232bS\250\316\\x\350\222]R \267\333\376\035"
+	.ascii	"h\205\332\336\201\314\024a\243\346\272\005\363\226$Ak\224?\346"
+	.ascii	"\274\304x\213\327`\223\032\032N\362\227L\256\\\305q\236\b\330"
+	.ascii	"\252\264\375->\215\372\354\355\363\200\252SZ\270\352\201b\266"
+	.ascii	"\313\230N\303\037A\224\260\306VvU\030(\316\243\314\323\367\366"
+	.ascii	"\252#\353\273Ji'\363\350O\332\236T\001%\223\266\216\244\260\016"
+	.ascii	"'\031?\323\026u\277\362\270\310\324\324HBM\034+\036G\277\032"
+	.ascii	"\356\031\030:\210>\252u\374\332xD\021\274\322?\0043P\353\026"
+	.ascii	"^7\362\003Py7\036 Vy\263"
+	.ascii	"\235\207~\361Ct\r\205:\330\257u6\210\327\257\253\032$\271\302"
+	.ascii	"\033\r*\343\365\224AW\365P\033T\200\361\313\350\330>\210\313"
+	.ascii	"\223\272\215f\263\246%3\220\212D\232\272\300\305\322\345\226"
+	.ascii	"]\022\330q\007\267\215Q\303\214:\207\331\"\3355\223\234\310\016"
+	.ascii	"#x\315\215n\0269\303\220\341\331-Kc[\f\256\261\023\240f\327&"
+	.ascii	"\020.h\314B\234\204\253\332\227Z3\226r\037\377\210\364\341Dj"
+	.ascii	"8\036)\377\257;\006\210\035\331\204\351\222q\022\007\363\"8a"
+	.ascii	"\361\024\230M\272\233\030>Fz\360\210\340\357\032\034>\213\331"
+	.ascii	"\002\232;\233\331\342\267[\373\275\233c\033\fB>f\273\n"
+	.text
+	.section	.gnu.lto_.symtab.dfbfa58363986160,"e",@progbits
+	.string	"dmaAllocate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"dmaGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"dmaGetIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"dmaGetDescriptorByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"dmaGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"dmaDescriptors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dfbfa58363986160,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,198 @@
+	.file	"dshot.c"
+	.section	.gnu.lto_.profile.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 '\365"
+	.string	""
+	.string	"\260\033"
+	.string	"\001"
+	.string	"\363\211\315\263\006\t\002"
+	.string	"\002"
+	.string	"\002\001\001\002"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.string	")Ym"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 \037\265"
+	.string	""
+	.string	"p\023"
+	.string	"\001"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 }\245\002"
+	.string	"\202D\017\032\260%\351\300\b\335$I\340K\340\237\311\257kjQ\027\026\220x;\273I\231\002$\250?9A\374\266r\214\315\266\313\351\275G\357.0\274\251`%U\b\177Kr\232\016VR\304s@\b"
+	.ascii	"t(\217\033\006.\201e++t\266\231\313*0h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 X=\002"
+	.string	"t\003L"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\002\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\004\001\374\377\377\377?\001\002\006\333"
+	.string	"\001"
+	.string	"\002\006\023\001  \300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"F\211\316\274"
+	.ascii	"\305\376c\226\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 ;U\001"
+	.string	"\360!"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\001"
+	.string	"\002\020\001\260\300\207n"
+	.string	"\005.co "
+	.string	"\003mc"
+	.string	"\003.c"
+	.string	"\004"
+	.ascii	"-\006ttY\002\031@\021"
+	.text
+	.section	.gnu.lto_.lto.a4b87717d4d5ccc6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_validateAndfixMotorOutputReordering.3.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375`\030\b--"
+	.string	"\312P\214\021Gp\\N:?\263/[\203E\357\267\214b\303B\253\264F\356\326\013\2468\210\230IZ\f\214\203SX{\243\342%\376\236lB\035\244\235\320\374\203b\254\366\275~m\200W\364\244\232\255\271\273\353\372\215\"\226\020\"w\222\001\006\001\367"
+	.string	"\374"
+	.ascii	"\327j\315\252\222\360\005\307\244\273\307\325\301Q\236\300l\327"
+	.ascii	"S1>l\306\371\273H!<\314\356\255\362\200!\250G\211\347-\363\231"
+	.ascii	"\217b\274\024\032\007\336\273\265\306\354\336\365\0017P\217\362"
+	.ascii	"\372azT\2750=jdn\363\225\353\336\n[\322\n\335\275\327\250\211"
+	.ascii	"\374z*\373\232\315f\363\347zFQ\343\201?_\020\250\367\303\363"
+	.ascii	"\021\366\250\273\024=\333\032\371\273#\233c\013\224\334\030\325"
+	.ascii	"\361\300\2567 \366\267;\032R\305u\037\327\203o]E,P\234\022\253"
+	.ascii	"\207\355\375\370O\234\322\207\345Y\254\373\374\351\307\205n'"
+	.ascii	"Z\242\274:\211h'\212S\032\261=\347\256\006\216\257\307)y\234"
+	.ascii	"\025\352\346\316\316\226\264*\321\220*\253\357\330n\277\346\230"
+	.ascii	"N\264\252\254\236\002QEMQAYT\211\216\237"
+	.string	"\247\205(`]@T\310\263\303\260\250\361\250\242l_\355\366\254\215\230\334\030\225\216\333\335\321\275\227\255\024U\3259\350\314?cf\022\314i[\275\305\314 \301\201\227\235\013\020/\345\037z\330/\244Z&\3600\347\341\333\326\316\302\247\235\203\300\1779\377P\313\276[\006:-\367v\226\177v\226y\250e\237[\3569-\253\247\345\335i9M-\237\250\345\276e{Z~\203\001h\260|,\333Zn\2758\232w\224p\350\031\222\207\371\333\376\265?\355\377\362\227=e\376\033\330\034\023\314M=*U23v\346\330\n|\315\201\341\253\245- \"\327K\345\301\013\r\223n\204z\364\374\331\321\230\307\022&\030\377\305\211x\\\205\274\326\230`\367\256\037\324sa~\227\233\031\357\345dL\204\\\357Qy\357\325\240~\313\311\316{\241\312\313l\2005\253\354dm\343F\220\025x\224O\306|,\037c06\353x\221\367^"
+	.ascii	"Y\256\305\310C\273`\345\312q\177\027\2466\300\312U\245\274\225"
+	.ascii	"\b\374+\302TiE\345f\271\367\372Xx\006H[\327\263c\320\350\223"
+	.ascii	"\364q\027\n\373\315\2341\\\352\230\013\233A\377\352\253N\024"
+	.ascii	"V\321\231\031\304\3230\030\365\336[\201\217\306\370\344d\003"
+	.ascii	"\270.\362\376\310\313\322\243\314\035L,\246\234'\333l("
+	.string	"9j\334\331\365\222\217\366\fK\267d\027\224\357\224^\355\034\226b\222]\372wJ\177=\305\354\263\304\013\323]3\233P\262\227*\320g\226\032}\344Oy\332\273~\324\022\241N\373h7PE\307H\332K\356i;\211\215>\261<\025\354\303\021\013\203\264u?\357\275\027\355\345\027\244\301&\366\257\274\334DaA\331\246\325\362ck\355\354%\013\365\331E11H[\307\335g?\231\207\017'\343\204z\204O#=\332\375\251\253\367P\333~\024\023(\333\344`\277\257v\004Zn\240\344\260\344y\262\315&\263&l\254\231g\231S\254\260\227\"\320!\262\350\346\240\372\310\274\036m/\231O!\316\255\b\007KOZR\201\004\203\305\322\316\007\241\250I)\206R\022\213\rM\030\232\224^\250@\202\001T\222\261\324t:!\025\213H(\233(r\301\204\242)\311\250\251\250\004c\251\230d\304b\ti\205\221\211b\223Q\221"
+	.string	"fj\241T4r\301\304T4\342\255\367\275\325\241\t\334SCq\320\022hf\021#\354\245\216\220}\004\372\0224Z\027|\334\207\303\323\325\315\245\375\206\235\240\277\004\254N\024\226\257\371p%N\f\271\356\225\202\363\344k;'\231\247\327C\r4\354^\377\355'\032X3\231\347oZ\304\256/\330\373\231\363\351s3\007\366\024\020H\205L\2208d\216"
+	.string	"\365\222yW?\007\032\255\023>\356AAm\265\354\2757\331\013\352\003\315\253\302#&w\005\213\327m\204z\342T\021\223\033\203\363d\233\266\f\227\263$?\275\344\242\377\364\265P\234\215\372\323\n\272\316|\232\247\302G\355\241\356\tj\265\357v\024\f\211\\\362o\346\214)\302[c\232\371\\\200\022\2574\341\231\377\332j\307\03215\001\200\226\250\201,\343\220\202\204\204fD$i\222\306\200\002\2219\263:\021P\265TI\222$\225\366\fF\031U\314\363\207\223F\352\210\304\346\243\006\202\274\310O\342\252\b\210\347\341\2312\303G=\310P\374P\023\323^\004\t\346\023F\203.\230\0167Hd\332\r~\251A\200Q\354<'\204]\252\223\264\016\002\316*Dxp\214\"w\3331\300\031\251\332\205\362\036\313a&V\305\374\"s\372tf\345\330\214\206@\030\245\377-\323\021\031\312\256/"
+	.string	"\2102\246H\003\322\004\204\363\202\226\361\343T\373ns\271\327\246BY@H\304~\301\351s\317UD>&\311\374\004R\226YR\315\211\240\326\324\303)\255\327\374\006\356"
+	.ascii	"nolh\322\325\344Y\226f~dr\017NH\371Cb\341\007'\266d\t\362\250"
+	.ascii	"\362\3355\245\355fR\347~/E\254V\221M\2152d\315\323\302[C\303"
+	.ascii	"\305\035\260\217\303\322j\0256\252\240\025o\312\204\201\225\320"
+	.ascii	"w\350\003d\231S>\240\177%\332\334\003W/z\370\n\371\370@^\256"
+	.ascii	"\276\024\034\320\237(\3244\271\177\201?\302\241K\371[\261\204"
+	.ascii	"X\353\337\027\257S\346>\275>\363\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 \213\235\002"
+	.string	"\022D\017\032\300\2471\277\031\\P\024\352\233\370\311\201x\376\377\347c\032\227\201\275\367\226R\246\003\313\255\306\222;\225\201\340)\234I\017R\264\273\0374G\323\3758\254\362\372Lq\253\261#5\361\237\b\007"
+	.string	"s\004\255\206\001\203z"
+	.ascii	"0|\212\376\274,\031 \003"
+	.text
+	.section	.gnu.lto_.refs.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a4b87717d4d5ccc6,"e",@progbits
+	.string	"(\265/\375`\322\004\225!"
+	.string	"\352@$\016G\220\\q\341I\262\323u\3109X\210\300F'\310Y\350\363\004\251R\256\223\233\251\314R3\177(6\215\366{wN9\230\3226\260TS\225%\002L\246\004&\257\031\316=\361\202\353\316\003+v\024a%\335\366S#2\005\271"
+	.string	"\312"
+	.string	"\322"
+	.string	"U\336`\307pS\016\366U\373+\3374J+u7\307)\203\254\r8#\311/Sa7\306U\316VX\370\236\236\353\276e\223,I\204#)\304\007^d\205\362\034{\001q\354\365\363\224\237\233\260\023Ki\255J\300\026v\273AcU\031%\336H\262\023~\302\256\003\216\362\013\031\336J\245\264S\267\013\364\203\265\004\013\317H^By\206r\240\2663|,\317\016^\234\305\016^w\371\300\253\344\002\257\377_\254\376\217A\363?\312\177\2513\377o\377G\374\237\360\277\301\177\002\377\251\n\374\314\343\377T\324\177\250\377\302\377\"\376K\371\017\373O\374?feee\375\177\361?\353';\004N\335Jy\344\224G\240T\035#\371_\250]\305._\265\333m\331^\273\024\264\276=\256dT\366\327m\032\264v\263\345\252v\277\300f\327\267\331"
+	.string	"o\233\266\333\246\245\333l\367Z\005\006\255\275\226]\337\226\345\365\355_\367\324\037\201\265\201l\277\355\033^\335\366\267\276@6h\245\202\305>\301\300Z\342\"k\257i\370\232\324\337\200\342\352\002\373\252\233\205I\375\203\320\335\004\374]\251K\314\205W\244\301{R\201\354v\267\002\037\317\007\260{\305\025\t\260\033\t\017E\3730\244n\261\201p1\375\321\324JI\335\013\332\355\366u\247\334\305\356N\273\033\366kr\273s\fX\203>_7S\002_7\245\303\244\356Q\270\206\013\273\276>\200\263a\344\371N\231\263T\031\236re\351.\231\260l\244>\347<E\336\270rD\r\0320\3470`\230\350\322\322*\314\216\021\034D\306\234\211mZI6\254\206#\311bN$\207\\\222\b!\276\236\b\205\374\270R\016\317^\206\034\345z\352\346YpyW\2752\305"
+	.string	"\214I{\b\277\234\243\3129J\206x\336\006L\020\037R]\376\036\030\026+\035\301\221<\277\345YHy\306\302Y\316O\354\362\023C}@w\363\272wP\r\265_d\340\250\323LL\261\037\2527o\272\360\2263\324\335\370t;uw\203\007\301%u$Y\013O\t\320Kx\346\304\376\367"
+	.ascii	"\311\250B\2077\222/Q\216\377\253\325_w\327p\271\375\343\371\234"
+	.ascii	"]\314\261\377\207[\f\341?\331\375\277\365\023\267\\n\003\315"
+	.ascii	"e\262\250\355\f\340\216\316[\215\206\002=[\320jF\271\333\255"
+	.ascii	"\306\340D\315\274\221\246.\207\356L\035-\205Q\r\335\321p'z;\221"
+	.ascii	"L\320h\b\316\340\271\025\246N\206\346r:Y\200#\334\2513m\272\234"
+	.ascii	"\031\002EZ\201\"\201\320\345\320\234\007\027\347\t\033N\203\211"
+	.ascii	"\326l\347\255\306\"\302\215N\235\2113\217\312c\030\2420D\344"
+	.ascii	"\002v\242\"\013E\026^'*\232\315\212\206f\345\207f-\024w\n\331"
+	.ascii	"L\334\321\271\303!\371\2404\"\024w\"\301>\233q\020\"\361\241"
+	.ascii	"CiT\001\315\241\330\331d;\235\311\342\324\331d\270\263\246Bf"
+	.ascii	"\244\333\311*,H\023\005\243\222\372a\305\212\370\223\244\347"
+	.ascii	"e\006\232)\330\332\205\307\221\221\344\252\221\251\370\314\271"
+	.ascii	"\212\315\370\364\270\212\354V\231\037\b`~\340\212\032\242Ny\005"
+	.ascii	"H\250Q(#\200\024)\301\210\210\0042$4\206\305\006\200\002\021"
+	.ascii	"\252d\007\021\300\275B\231\212\313\365\f\\\016\376S\006C\247"
+	.ascii	"G\344\367\t\256\325z\3610 <\306\241\357\262NX\270k\325\nO\321"
+	.ascii	"\222(\302:\301\227\261\025\027dj\227\036\013K\t0-\367\361\217"
+	.ascii	"\253\347\032\342\375\177\004O\276qy<\357\260\373\204\320\020"
+	.ascii	"D^)\203X\263\353\262D\220\302\017D\332\271-\271A\\\020M'd\225"
+	.ascii	"\311YG\001\252%\231Z\302\316\233\177!\244\024\334\216\fP\263"
+	.ascii	"r\254\351\332vZ\246\255\253r4\226\f\366n}\275S\001"
+	.text
+	.section	.gnu.lto_.symtab.a4b87717d4d5ccc6,"e",@progbits
+	.string	"validateAndfixMotorOutputReordering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a4b87717d4d5ccc6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
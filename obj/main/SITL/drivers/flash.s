@@ -0,0 +1,961 @@
+	.file	"flash.c"
+	.section	.gnu.lto_.profile.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.text
+	.section	.gnu.lto_.icf.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\275\b"
+	.string	"BN79@\215\323\001\360\224\374&\252j\306\216>\n\207L\f\256xD\020h\205\342\250\310Ad\036E\3702Z\3070\314\214c\030\206a\030\306\n\370G\320\023\\\322\366\336{o\231\366\016\021\037\3775\3642\022"
+	.string	"JA\002K\034\313!\325\2156\233k\376\271\245>%\232,\037\270\216\313\034GLt\006\230\007|\t\034\227\3763\n\352C\303\260\006Ffa\351g.\020\210\020\355\352c$\210\372.*\375\353\202\242p\224\373\027\354\362\363\362\365\030f\320<:\253o\231\025\036\023\204\252\177\341\223\021\022\b\367+\362\371\325:\370$\b\256I\341\223b\373\326\254\247\006S\251F\313-\204<\364n\2346\221\3319\243\240c{5\020\362D\322V\370\276\336\336\236\276\236~\276\377\313\307wh\350e\240\330\211R \026"
+	.string	"\275\n\355c\3010\354\232\204\265\016\300\205j9}\330G\3468Y\315)\025"
+	.ascii	"ygG\030\007\354\261\331\274\f\3442,\314\313\351N\203\233\355"
+	.ascii	"r\216aE\220\002\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"e\004"
+	.ascii	"b\005\021\034\300%\303\001\377\377\377\177/\377\377\377\3165"
+	.ascii	"\3336!\233\020B\b!d\223\275\245\224)w\301\346\273\001\300\272"
+	.ascii	"z\323\031\265\260\312\016\001\235\004\341\017v\332c\277\322\330"
+	.ascii	"\273\340\366\217H\274\017\274i\365\320\357\327\205  \240\002"
+	.ascii	"\251\271\036\017\t\221b\220\017A\021\221Q\214\307\275\nF\025"
+	.ascii	":Iv\bJ\031\332\004\210\361\b\3001\320\302K\303\234\023><h8\231"
+	.ascii	"a\265\361Z\250\375\241x\325\351u\035\266\314\024\320\026<\fl"
+	.ascii	"\003X"
+	.text
+	.section	.gnu.lto_.inline.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`2\003u\017"
+	.string	"\326\325MA\020\221\222t\306s"
+	.string	"\332\307\032R\b\f\267:\357\212F\007\024\f\b\250*[\372\231\266\003_:\310\276\312\255\303At\347\032"
+	.string	"\005\332UUU\276GM\b\201\332\333#\264\337lk\373\304\222\266\211$)7"
+	.string	"9"
+	.string	">"
+	.string	"\037\321\2679\027\231I\3756\250\240)2s\332U\355\007\231\031\372\223\006\223\231n\351\331\377!\365\202\232\231)\356Q\032\215\314H\304\247\317\026\224\002\207\025\036\006|\310( #\250U\330@#\0045\222\\$\271XR\0255^d`_'\215%3\337\364\315S\326o\203\376\254\200\363\324Aq\206\322Q\213\030!"
+	.string	"S\177D\355\007q\305\351\302\346:\016\177\204F\274\214d\252\227\t\022`X_&\317\302\b\205\fj\017l\242\314\264\266\376\210\244\033gN\307\325\235\207\027\017\260\361\215\257\244 nhHq\027\237\201\322\260\230a\243\3435\"`\3011\203\232\b\007\247\004\355\0352\263\332\203\0171\234\300a\242\277\221J\214\200\033)\203K\302%\207\313\346\316\007\225\225\232"
+	.ascii	"m\t\225\225\232\316!\"e\263\231Ia@ 4BL\313\214\325/\304\264\314"
+	.ascii	"L\001P\250\001A\246\0043iFK\322\322\030\220\002\031)\033;\022"
+	.ascii	"`EA\001\305\020rH4D\341\314\244q\275\003\301\3654\256\317C6\357"
+	.ascii	"\363v\276\346\215e\b\241\342\213\245\241\311c\371\376+\020\353"
+	.ascii	"S\035\270'^\036\323\001\001\t\237\307\226\243J\327\323\201U\372"
+	.ascii	"\352\212\313\217\273\234X\fj\242\313\370DX\"Z\017x\316\321x\333"
+	.ascii	"4b\275\207\244\226\017~2c'\036\035(\005\022\215\204\030\214 "
+	.ascii	"\001\315\216\341f-\376\370Gy\377\250\304Ba\030C\006\315\303\374"
+	.ascii	"\212\212\036\303$\316\222\241\340\305\262\353\352\2107e{0\316"
+	.ascii	"\250\004\0070h\\\211_\242\302\202\332\3360"
+	.text
+	.section	.gnu.lto_.jmpfuncs.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`:\002\355\b"
+	.string	"2M(+\200)I\0073\260\f\221\366FRgBF\017\314\216\254h"
+	.ascii	"3=D\224\n\020\361\221\267\226>\f!3\340\177\203}\2026\221I\006"
+	.ascii	"$\231\311df\244\222?\334U\224T$A\365T\217\351I@\030\204H\017"
+	.ascii	"\375\301\303\261\356\006\007\003t\306\236-\r\303\025\377V@\260"
+	.ascii	"\216\222\236\222\372g\r\325{\364\026z\304\217\006\326\221\367"
+	.ascii	"Yj\272\352\313wY7\306\002\353\350x\236\347\231<{\"\215\234\246"
+	.ascii	"/)2\325\373\215\200u\351\213\267X\241\344\003\254\273+\351+\251"
+	.ascii	"\223\242\346ps\246\244\250$!D\020\0011  B\342\220q\007\210 \357"
+	.ascii	"\311!SA\006\346\031\300\375\202\220\006 \227\020g\332\223\266"
+	.ascii	"\205u\201\177\310\362\t]_b\003\213\304)\023x\213\201\373\203"
+	.ascii	"n>\306\022\367:\362\330\rU\023<0\220@\216\371\230\023mlYp\021"
+	.ascii	"\307\321c\241\262\021\202\356k\266\001\350\344X\002\333|\027"
+	.ascii	" \374\210\332\366\303\237\001\347@*B\211\001,\364`_\230\026\006"
+	.ascii	">&\306\305\314\247\201!"
+	.text
+	.section	.gnu.lto_.pureconst.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\005\230\004\006\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\232\004\f\231\004\r\231\004\016\231\004\017"
+	.ascii	"\231\004\020\231\004\021\205\004\022\204\004\023\232\004\024"
+	.ascii	"\204\004\026\230\004\027\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`N\001\r\007"
+	.string	"\022\t\034#pm\206\003\374\377\377\177\370\364\377*\374\377l:~\270\201\006x4\304\356\321\b\202 \b\002\023\260\245L\001c\236\317\0059\332{\016+\3474\372\270`F\305\224\260\020\327ac\370\013\257\311 Or7]g\246m\251\215\360\230\201%x\360y\t"
+	.ascii	"\336\322K\350\373\254\312+^\351\244\312\251NJ\347\244]\3229\225"
+	.ascii	"G:[\271\324h\306\321\267\0232 \260\202\221\242\323\0018@YpK\322"
+	.ascii	"\033\230\315\267\241Q\b\306\r2W\222H%\327\035\022\236$\340d\006"
+	.ascii	"\003h\216.Ra\016\267Dv`\314y2S>=\303 Z\217\374T\206\227`I\334"
+	.ascii	"\200\236\262\211An\357\203lz\353\330ceY\262\370\005\033Kh_<i"
+	.ascii	"\017\316\306l\035\226\343p\256\305Y\241ZP\322\311p\245m\003\206"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.lto.514c41ff89c2eac4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashDeviceInit.16.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"}\b"
+	.string	"\206\320<9@\345&\035\340\367\230@\005\032\bU\255?\324 \350\234:\256\342\365Z.Z\023\315\"\310g'\bb\340\207`d\215\034Eq\3778\202\211U\353\030\240\200?J\250w\223;\245*"
+	.string	"-"
+	.string	"*"
+	.string	"\232G\333V\340t\366>=JG\205l\244\254v\247T\324\275C\317\0270\215\016\003:\273k\370\2318n\275\355\003\333\034\333,\001\232\351v\365\262\240\262[\n"
+	.string	"`]\342\n\210\355\316\276lCh_\344#\335I0>\260{jI\355\316\004#X\217\236/\320<Z'\b\326.\351\237o\362\223\t\377\343\321\033\007\377=\372\234\305\005\374\247\372\222[*\230T\214JCG\366\034A\355\260\237\331\335\265\236\034\016XH\2241\\\376l\0366\017DHn\032\250\002\323\032\244\b\363D\310\217\266\311\215\2013\t\220&)\262L\223\327\334[\325\035\222f\330\202\237G\341\002\t"
+	.ascii	"a\221\"34\030A1\256\364C\023]P)j\r\271\301\314mK\036"
+	.text
+	.section	.gnu.lto_flashIsReady.17.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\315\b"
+	.string	"\226\020=7@\217\322\001\230\"\260b_\021\247z\022\211\270$\003@8\230\033"
+	.string	"\213\342a\361_\375W34\304p[\342_\343g\030\b\020\322"
+	.string	"l\331\t\242Y\320\304h7\2212\245,"
+	.string	"+"
+	.string	"."
+	.string	"FH(\331\364\317C\365\026\214\006Lf\367\213\332\272\351i\362/\362,\344\345\342\255NO"
+	.string	"\206\335uz\253\215[o\333\300\366\201\355\230\207\376Hsx\025xy\2412f\177\247\324\016\373\331*\313v\032j:3}M\200J\313\302\312\256*6\263,0\005\304v\311\336\004\250{(\251P\0258Rz\262\r\361\023\221\266\233\352\370&\030\233\346\"i\016S\t>L\361\022\222\266\273\035\237\344\257\316w\035\332b\224\367\002\376p\036:O\204C\3548\320E\210k\210\022!\217(~\270.r\006\274M\200\270X\261m\\\334|\373l\225\005\265"
+	.string	"\245\031\336\344G\016\033i\273\001\r"
+	.string	"2\241!\f\314\371\202!\270O\321CeL"
+	.ascii	"\313\017\325(\256\211;#\310\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_flashWaitForReady.18.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\255\b"
+	.string	"\246\320<7@\217\322\001\230\246\035\204\266\n@.\260*\263\220\004\260p \031\207Y\341a\361_\375W34\304p[\342_\343g\0308f\214\230\267\354\004\321,h\"\221\333J\231R-"
+	.string	"+"
+	.string	","
+	.string	"FH(\331\364\357Cu\326\213\006Lf\367\213\312\272\351i\362?r\215\310K\305[\235\236"
+	.string	"\f\273\353\364V\033\267\336\266\201\355\003\3330\001\243\354\360*\340\342Be\314\376N\251\036\3665\273\273\326\016\333i\250\351\314\364\263\200\230\226\205\224]UlfY\340J\210\355\222\275\t\251P\0258Rz\262\r\361\023\221\266\233\352\370&\030\233\326\"e\207\251\004 \246\370\213\244\355n\307/\271\253\363[\207\266\030\345\275C?\376p\036:O\204C\3548\320E\210k\210\022!\217(~\270.r\006\274M\200\270X\261m\\\334|{C-@i\2067y\222\303F\332.\352\036J\f"
+	.ascii	"2\003\302\260$s\027,\361\024=T\306\004\260\374P\215r\327\350"
+	.ascii	"%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_flashEraseSector.19.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\366TL@0\345(\035\340\272\201\376\361\353\303\030\205\247\\\376\036\276h\021\233\303\301\227S\215\276& 4\200\200\377q\314;c\020\033n\323\331L\377\fe)"
+	.string	"\0256\006\347\b\341\252\307\370a\311\347\266{\247\0246"
+	.string	"9"
+	.string	";"
+	.string	"\273\345\203\035\272W\206#p\257\234\033p\257\026m\003/_\373\231\255\204\246\266\273\036m\271\370)\372\207\271g$W\237\235\211\335\365\034\311\223\233\336v\203m\b\373\024\0015\"\245\326\212%`\315\233]\256&e\261\317\331\3355u\331\227\375\225N\3179\375\316\311\255!\2208\260kr\263-\255\022p\371\330\376\264\037\373\213xY\210=\273+6\003\002*$te\373\342"
+	.string	"L\335\356H\310\277\001\311\350`*\356u\322\204\002>}\246\352jN\027l-\024\331Q\234\375}\006u\360\332\335\220\037s\231\320\207\275\332#5?\276\372)\356\001aX\002I$Q\307#\020F(\322\260\360B\260\364a\002I\336\206It\362F`\350\201\024\374q\224@\257\343\373@\357S\3569K]\256 i,*\342\202Y\351\313\013Hu\273\254\217\001&\365'\020"
+	.ascii	"2\241%\0348.\032\202+\300z\030\254\t/X\316\324(@\334\250\244"
+	.ascii	")\253\004<\230r\t\226XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_flashEraseCompletely.20.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"u\t"
+	.string	"FQ@;0\345(\035\200\223\211f\n0\217dD\334j\313\267B\303<\2719\222+\214CE[\277\341>\234\214\0011\334\206\202M\275\006\202\\\262\244\203\367\313\"Z\001<\364\220Ab\267L)+"
+	.string	"."
+	.string	"1"
+	.string	"#\266\317Y\264a\316B\355]cG\013\266\273S\212\\\274\212\376M.0\222B\327"
+	.string	"\206\335\265\216\244\217[\3366\202m\005\373\007\001~\352\2315B\375\370\314\017\265g\013'\022\223\n\200Hc6+\2442\304~f\345\311V\265^}\355\244\027,\246\301e\327#\026`_YK\322\034\310H\206lw_\221\330vG\033\277\265\361\331R \355\231\312\202\027{W\001m)\227\t%\246\322\352\240f[\034\005$@\355\356\306?\371\n#\356h\"@\316\004\304\004?OF\367=L\212\216\363\231\235\017\234\032\003{\025\236o^x\33679\326>\263\362\344Pz\211$\207\007\364\252\273\302mW\364\221E\003\020"
+	.ascii	"3\241!\fL\377\216\301\272\002\254\007\326Lx\301r\246F\001\342"
+	.ascii	"F%MY%\240k\270\306\020\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_flashPageProgramBegin.21.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"]\013"
+	.string	"F\326OC \253(\035H\031`\024B;\013\340\357\373\254\370\337\026\323\006"
+	.string	"4A\365\314\026\031\027\034\345dk\026?+\2636\3101\316t\223\321J8`\363@]J\300t\346\241|\354a\206m\254\345w#\233\354\235R;"
+	.string	"9"
+	.string	"="
+	.string	"\273\005^\022vG\f_\324\323\212Kh\247\331#\264S\2076\206\217\b\366\256\001"
+	.string	"Z\031vw\233\007\036^\206\376\027\374\"\232F\227\226\215\335\265\024M\002\356y\333\026\2665\354{\004~\266\273\353y\262\317\372\351W\177\226I\313)}\013D\212\002G\205\335"
+	.string	"\261\r\013\243\023\022\330>\306\266\034\257 <\353\344\017\273\247\013\031\365\324c\275\264\237\272*\374*\305\227\020\3444\206\300\312\034\331\356\374\201\247\356\2264\276\013\005TQ\"\355T\316\t\013\366\356@TwW\343\267\336\200\304G\235\032\f\311\213\247~H;\375\244\245\b\032V$\031\263\307\221\234\006\034\236\216\373\370|\270\256\202 \347\333l8\213\273L\b\310}@6\360\343\230t\276\315&\322\341@[\367\201[\206\302\336\b\347\333J<\357\3330\343>\333yr\207\nF\232*v\220tf\363\f\376\n\325]\322\305\020"
+	.ascii	"2\241)\0348\\\f\b\204R\3640X&\240\262<\244\032\320\\\003\212"
+	.ascii	"a4\020~SS\340^05\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_flashPageProgramContinue.22.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\260\003%\032"
+	.string	"6o\247I\260\230M:\360\305\274\002D\2412\n(|\036\003\232\212\235p\232\005\021\232\230\362\354\376\242$\022\375\366\241\375\026\307\223\316E\312=T\2346\276"
+	.string	"\204\247\017\207\b\345TT\334\001\373Qc^\321\376k\345f\t!do)\223\f\221"
+	.string	"\204"
+	.string	"\231"
+	.string	"@\202^\236xL\255NV\250j-q\366\200x\272\245\270\273{\037\377\021\264\344,y:P\212W$\204K\255\245\354\3463\340\351|"
+	.ascii	"\360\264i\234\274k\024C\220\316fr/tW\330\340w\b)\210daJZ\372"
+	.ascii	"\350\322\275\270\270\307)=,\2327;\220`0x)HJ/\035\021\3233%)}"
+	.ascii	"\002\320\241\2307\265\326\227.\307=\017\304\260b\001@74g\260"
+	.ascii	"\232\256\374w\003;\220\226\230\303\006\265\326e#]\322\367\365"
+	.ascii	"\335\345\355\256\205\335n\n7N\267\247\3067:\335\327\300\323\367"
+	.ascii	"\177\307\361-y\202\302\361\326n)\304\275\333\375\254\265\326"
+	.ascii	"m'\232\227\377\214\314\203\3741\367\375\261G}a\313\373\272\357"
+	.ascii	"\353\nyG\220W\244\274!\345\005)/\245\274Myy\362\276&\200\013"
+	.ascii	"\254\bHj]\261\365\245F\241U9\036\365\357\006\355\177\373\332"
+	.ascii	"\335(R\024B\022\177R6\260\324Z\"8\335\b\"\337G\316X\3155\375"
+	.ascii	"`\320A\200jb5\327S\241\200y\367P\017OPc\357l|WO6VC\264\304\336"
+	.ascii	"\205\275[\231\016\233\231zP\230\314\260)\230\243%\034o}\301\223"
+	.ascii	".\013d\233\335\226^\026\330\260\226i\333\024\025\"\035C\264w"
+	.ascii	"\003xa\316\252\013\214\363\274`\241\232\260\006{C\357j_\205\201"
+	.ascii	"\024o\354\201\300S\260+L\375\216\2268\211\026\326\214&\301X\327"
+	.ascii	"\354x\364\262r\354eis\303\372ZD:\270\273i\333\030!\252\032\322"
+	.ascii	"9\022R<\322\375#5\336\334/\n\263;/2\313\341\355v\370\024\r\247"
+	.ascii	"J\2555G\352D>\354\003\263\037\232\215Bm\302m\366\003\344\240"
+	.ascii	"\204N\017\354\307gD\355\301\314\004M\302\353f\233\361\360\214"
+	.ascii	"\330\020\356N\002\0177\035\020<\262\233mF\202f\343 \363\241\351"
+	.ascii	"\364\310vl7Y\002\002[\0131\263\311~j5\233\254\254\237\265\235"
+	.ascii	"V\204\022\216\221f\234\321\002\n\237\352\257}5\367\220+\274\222"
+	.ascii	"\357\244\261~\217\0278\346O\202\256>\332\025\300\256\216\351"
+	.ascii	"\231\376\220G\251\211\265\342nt56M/\220Q\324B\177rA\2545\227"
+	.ascii	"\263\267\362\311 \336\300\323\261\013\324\200\302i\270\223[\023"
+	.ascii	"\261\251\226)\001K\250a,\202\220t\n\321\314\004J\n\n\n\363\200"
+	.ascii	"\242\221E\325\001\020H\213fSH\007\017\034,\224\276 CV\317\242"
+	.ascii	"\364\256\350$99\323W\362\235\312\321S4\r\344rq\267\355\256I\201"
+	.ascii	"\177[z\300v\035\320\300\263\266\351\217F\353\353:\354\376\020"
+	.ascii	"\327A\002D\275\221\002\213,\372N\033`\354\226\277\250\204\340"
+	.ascii	"\214f\221\255JB\361\263\246\353\214\240\202\342\243\231\230\330"
+	.ascii	"\003\021\366\234\034\304@\326\217\274\n\033\362\005\320t\236"
+	.ascii	"&\232\311:\264\201\020\344 \206\210r\270\2143/\364\226\366\002"
+	.ascii	"|N\244\307\246\355a\254\006"
+	.text
+	.section	.gnu.lto_flashPageProgramFinish.23.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\225\b"
+	.string	"\006\020;8@o\323\001x\027\364\260\004`]L\007T5.c ("
+	.string	"\261\361\316\202>w\221F\3521\214R\250\321W\337|\374\272\341\304\3344\022;\220\320 \231j\177\333\177\313\224\002("
+	.string	")"
+	.string	"+"
+	.string	"\2279\333\345a\307\036%\345\"\025\263\2733r\234\273r\376C\016"
+	.string	"\226\272+\347`w\255`)\343\216\267]`\333\300\366K\007/\375ms\371(?\026\031\224\247+;\3544n\330\327l4\331\252\326\253/\005>V\020`v1V3\253\222*\036\266\037\336\301\023\215\2764\276\330\331\036\335\004\263v?\217_R\001a\235H\233K\215\003-\326NB\262v\327\343\217\034%\341\237.M\261i\006u\030\264O\303\302\324\262\320\204(S\230\016\242\317h\2022mv\b\214=\204\262\031\201a\331\274\302\275f\243)\001D\345E\013\007\350E\236\332\254\335\r"
+	.ascii	"3\241!\fl\371\216\301\272J\321#eL@eyH5\240k8\302\020\376e\\p"
+	.ascii	"\351\026\355|\002"
+	.text
+	.section	.gnu.lto_flashPageProgram.24.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\021\001\355\f"
+	.string	"\366\330XA \221\323\030$\324F\016b;\230\300\355J\370\307\337Z\311 \360\004\351\204P\274\317\246\233>Bn\210\212\013q\272\332G\3616\215\255\032\n\006\002\023*\3437\003\300\200\367\210\344\2547\271\267\224R\246\024B"
+	.string	"G"
+	.string	"C"
+	.string	"u\n\253\320|B\351\346\367\360\022\363o\t\212@:\032\260"
+	.ascii	"\312\021\372\203r\254\326\316"
+	.string	"x\023q\303\324\320\320\202\346\277\365BX\263\323j\273\360\246\244\"\262\253\032\374\257+\251lp\237\333\036h\353\240u\207\317\324\332\305\256\334bSf\261\243O6\214\256\016\272z\363q\342\306\003\033\177JM\216\313D\032$\332\272\243\355s\261@\300\343$\026#\030\310\026\024\350q\322\207\224\005n\363\n\315,\027\034\3407\321(\220\216\335\244]\003\362\037\271\024\343^]\342\034\236\250\255\210ex\344O\n\251c` \221+'\224\243{\003p\264\3040N\344\377\220\032\306/@\365\212c)L\347\322\244\034\375\"i\306\304i\344j\332M\344\036\210\326\360\377\033$\330\025\341\363\27109\022\0221\351|\250+tq\340\234\235\214\303\271\252b #\363\372H\260f\326\251\340\3118\226\211\347*\261\260lZ \005\n\232\320\311\254\020\b\224Y\035\333\r\377L\205\200Bf\3642\024\200\253\036\365\342\203\317/\2361\003\026"
+	.ascii	"2\2413\0348\\8\004\367)z(-\023PY\276\324\031\224&X\3005\"\307"
+	.ascii	"\f\r\n\357:`%\034\006\303\200\n\001\204\337\324\024\270\027L"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_flashReadBytes.25.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\036\001M\r"
+	.string	"\266\330YD\020\221\223\016\250Z\024\001\200C1G\177\017@E\177J\253\013\360\336\217\256[G3`\023\242H\344\326\360hp,\216A\372\224-\220\221\355"
+	.string	""
+	.string	"\025"
+	.string	"\266\276[N\323\214\314C\222\352\227\355\020B\366&r\247\024C"
+	.string	"E"
+	.string	"I"
+	.string	"\273\037Xbv\273\005Vp\035\332\366M|\205\263aT\035\252\364\224\231\223\027\232\335\225\0337\020\017\253\023\210\207z:\367\307\371\177yU\242E\fRI\364g=\330]?R\211\303\255\267\235\300\266\003\373\"\002\032\302~\265j\262\3413v\227\337z\313\037\237\372a\365\374\364\371"
+	.string	"\336\201\004\315\f\b0\273\033jj\254\f(3\3026gol\227\222J\300\232\200\320\340\361\272\237\340\336r\341\003vM3\f\272\313\177O\225\030\013\230zx8Q\221\355\316c\262k\327\244\303w\201\341\343R!\211\207O\021\244\030t\026$\327\212\253<\241PXR\017E[\302U\204\n\240v\267\303\207y\n\315W94\205\371N\232\361\260\301\311\204\262Bc\364j\354N\364\002 #\037\"YH\334\262\317\247B\2048g\266y<\034\313\035\016\220\311\t\371\310\271e\026@\233G\212\2008!\331\331\246\3448`mB\266\311\021M\333\344\246\333W\253&L7F\232\301\001\236\245Q\241\036\305_\314kwt\222\314\323\031"
+	.ascii	"2\241-\f\254\036\215\001\201X`=\274\326\304\027,oj\024 \256T"
+	.ascii	"\222\303\252\274-\023\226k8\255-\240\317BQ\202a0\f\250\020@x"
+	.ascii	"0\254\251\020\270k\2046\302OgL\302$\003"
+	.text
+	.section	.gnu.lto_flashFlush.26.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\245\n"
+	.string	"\366\022HB \347(\035p|\276e\021d\221E\276\003\233\335@B\261\006\257\340\205)\260\027U\302\254\"\211\371\016\232\255?\375\2702\210\341\214\253\237z%\203D"
+	.string	"\001IF\274\244h\004\n,\254'\214\020\262eJ\0013"
+	.string	"4"
+	.string	"5"
+	.string	"\fv\367\233*7}\233j\362\357z\002Y\236\276\235|n\034\025\200\031C9n\021\263\026\312]W\2222\245\212 \261\273V\2624\271\271\333\236\260\ra\377!\234O\352\316}r3\264\006/\224\326l\330Ig\212\375m\347\312V\265^\375\216\243\200"
+	.string	"\005m\267\244\366`e\234"
+	.string	"\026\333\337\330d#8le_s`$\026\262q\236t\326R\005\230\006;\235\0262\006Fu`{\364\030\320\333\035=>\214H\207\307*u\347t:\024\260\370\227\222\267\273\036\337\345\257\017\237u\316!$=\371\006u2\304\217\006\306'\206!\020Qx\361m\210>\243\017\024\212_\247\301 G(\374<@0\3746\260\375\266s\345\212\0052\324Lm\n\372\226\323\220\274]\324\311\230N/\fH\020\023"
+	.ascii	"3\241\177\214Qa(\331\333\313\253~X\231\034\272C\327\035{\311"
+	.ascii	"\330\372\312\354\205j\361\220\nC\327p\024L\370\227q\305\245\233"
+	.ascii	"\252\235)\232\202\002"
+	.text
+	.section	.gnu.lto_noFlashGeometry.27.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_flashGetGeometry.28.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\005\001\035\r"
+	.string	"\206\031[C"
+	.string	"\223\223\016\373>\247\265\210\377\224\250\371B\006V\0215\267\001\337']\222M\214\026\317\354\306\177\336\250\021$Bi\030\222\333N\361\217?\264R\257\252\376\216\251w7{\242\325\376/^^!\204\354-eJ\001H"
+	.string	"E"
+	.string	"I"
+	.ascii	"\273\036f\357\002\250G\353 \324\243\232\270\366"
+	.string	"\b55\177{dp\003\007\327\2018\204\006X~\2448P\263\315\\](\025\202\270\3148m:\016P\301\tf\304IOQ\267\222Y\215\354\256\223\353Zn\352\266\035\330N`\377\023\237<\367\350\177\250\307\353IG`2\261\210\001\345g{[\352\310\276~\337\367Y_l\247+\247U\323\231\351[\003H\344h@c\367\303\347ci\342\214\n\333*\366\345\267\270\013\025k\004\274\023-\033\221\007\026SM\273\240s2\251\225\006\b!\202&\244\233_\262Q\342\004u\344s\250\324\363\230\360\030\034k7$\342\2276tR\027\350\270\275\355y\202q\251\241:\362S\250\353\203\322\216P\366\260}\3410R\254\335\025\361_\334\363\370(\036\235!.\t\221\340!\241\020\001\363d&\032P2\bX\005\024\022\016V\222y\260\220\002\356X0\3110\f\235N\206]\336\036\256\2768\325'\232\225\351\023MM2+v;\234;\351"
+	.string	"`\245\252\"\333\252\036\001\351\n\334\335\215W>\3462>V\024"
+	.string	"\n\013M2q\024\363\036h\305W\362\0200\2065\035\202Ih\233\020^\261."
+	.ascii	"b\211)\226\006\n#\314\270f7L\344\343\267\020\241\\\254\356gY"
+	.ascii	"\023\n"
+	.text
+	.section	.gnu.lto_flashConfigurePartitions.29.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\332\t\2753"
+	.ascii	"\nY\250\023FP^R\007s\016\035\357\204\303\347\267\367\377\177"
+	.ascii	"z\337\253i\352\020\234\027\241N3\226\270$D\247\314km\2739\033"
+	.ascii	",\310\rFQ\006@\260i@&\006 \"\306\301\320EQ0\256\2615#[\263\334"
+	.ascii	"m\357-eJ\001(\001\023\001-\001V\370\301\374\305\262|\230\322"
+	.ascii	"k\361\264\003O\326\375\244`W\347\025\001~\367@\253\344\036|W"
+	.ascii	"\177\325\203\376^O\215\377k\t\336e0SM\325\315\336\326\006\357"
+	.ascii	":\003\370]\343\363\274\357\346O\276\357\306\356l\336\252\265"
+	.ascii	"}N\266\244\304\364\366\336?zI\321\337o\255\357?\035\2772\211"
+	.ascii	"<\032\213\304\2410\b\374\301\276\327mu\216\375\201O\246WfA\247"
+	.ascii	"\237t\362\310\026\002\3313\314\3139\233\264\303*l\244\374Q\316"
+	.ascii	"\351\244\214I6j\241\021\311\305\"O\214\252i\345!\332\3773\013"
+	.ascii	"Z\344\205YP\254\017\276\234\023kH\006\266?\250\030\260\227s^"
+	.ascii	"\265@\330\255\352\267I\345\037\002%P\253\207[\n\324.&/\347\254"
+	.ascii	"ju\226\2611\377v\225}\337\366\f\354\352\274\366\262\240V\377"
+	.ascii	"\266\f\242o@\210\317\250\226\307\f\2225_}\004R\234\323\354\272"
+	.ascii	"Pbatd\317 \337\266\005\244\356l%\320c2\013>\237\262n\223V_\346"
+	.ascii	"\210O\250\326\301\334\224\253\207\373\334|:\345\354\263\260\367"
+	.ascii	"\366\314|B\337y\336\375\215\270{\007w8M\373\t\310?M\321\n\240"
+	.ascii	"\216`\347tVK\344h7za\355\"\354\356)\317\361\207\363\026\177\306"
+	.ascii	"\b\336{\003\371\233y\271 \377\351\273.\264\314\317\\\352\207"
+	.ascii	"\373<\235jE\251_M9\353nu\312Z\352\376\377\203\353\312\223\353"
+	.ascii	"$\356\002\376\372\036@\230\035\2000\273\217\316\336\303\023\314"
+	.ascii	"\256\374\264\367\344\237\275#u\366\2431\230\275\370n\357\304"
+	.ascii	"g{\037\002\263\013\201\331\203\277\354\300\037\234\035\366\375"
+	.ascii	"\327{\353\313\256}\331\363\233\375\023\374\231S\357\r\212\354"
+	.ascii	"\336>\262uv\234k\006\345\257\377i\377g\377l\377n\377_\377\272"
+	.ascii	"\277\177\231\207s\017\272\215\267\272\212'hl\270\273\371\277"
+	.ascii	"\261\371\267\255Y\235h+I\324\313\313\247\371\253y\220,\336\362"
+	.ascii	"g\376hb1\330\233\271+\275\0307P\267\367\3760\177\365/\003\023"
+	.ascii	"\343x\253\273T\274\242^{\357 \016\17708\376KR\273\253\254\033"
+	.ascii	"\312bM\231\227^\006x\213?\331\217=\027\245\357\222\364;\312\371"
+	.ascii	"\233\302F'\300\357zq\225\374\004\";\251\210\255\3500[S-SP\265"
+	.ascii	"\240\226n\300N\307\256\277\237\363\377\366!\260Q\251\253\217"
+	.ascii	"\250\217\272\031_y\217\307,x`yg\242@-\365\"\031l\324\372\356"
+	.ascii	"m\360C\335\364\264w\250\377N6\233\265\363s\360Cm\324\337"
+	.string	"\366\256\236]\033\035e\263\306\301Z\252\277\300[\324Gavk\036c\371lLu\347\256zw\354`(r]\273\350|\035\r\376\323\244\367\335\242v\347\256{\277\366{I\013\352\230\277\346>\364zq\365\307\264\366\336\022\336\3755\277\360r0T\250\203\363q48\207\016\371\231\035\336w\211\372\337~\001\327\325\211\216\214Js\335\345\305\361\351l\366\227\336\254}:\223\211\212:\371\207\307\003\221\337\236\324\211R\315(\251\022y\265\324s\326bc]\177$\312W\033D\352\207\023\021\203\300\264+\352\231B\335,\361\276v\021f\347N\342\261%\326\2740\001Oc\274\357\276\376\352\347\255'u\2562\177\334\337-\341\275\233\236i\007\324A\255\244\022\022\367\244\231$4\241\303\244\325R\377\024/P?\336\211\237K\001\357IGHEKw\211\0244D4T\024$\364\313\261\034*\"r\217\214\220\204\226%\206\212\226?\027z"
+	.string	"\243F\220\214\027?5\216\2267\210\216\206~\212\210\202f\374\b\035\325\370y0\300\215h,\217~\220\214\214\216~\202\326&\250\267\320\244\235\240\224Z\352KnSH\266-c\217\026\240\233\356\255\216\222\217\250\300\266a\3425\375\202\367\257\321%\032X\272\354\343\377\212\025S\207Z{o \177:\036\342\352\213e\303r\243\262\243\226\324R\317WI\312\253\373\210l\025W#\\\375B\256\302\240@H"
+	.string	"\375v\230T"
+	.string	"t\220g\3429x\037\r@\277N\354\230\217\0165\033\251\245\356\372x~f\250\247\371O=\236\342h\371\231\216\366\276\353\223\251\\T\242\324\252\002US.G\263\242\3320\251{t\323\347|\217\376\262?\206Ma\312;cg$\362h}'l\360H\335dzd\273\367\336E\244\346\321\217&G\324R\317\037S_\245\231\307X\362T\017\036\271\2514\313;Pd\035f~!K\345\250\244~\265\275\341\025\256\340O\277\2258@\237nu\323\205Z\232\367Z\377\002\200\300\250q(\303\230c\312\214\210\210\214&I\322\001\240\002\021!+\333\022@v9G\035\242\231\3214\311\3761\006\022\345.\207\321T\210#\227\362q\022TtZFJ\252O\213o\022\262\263\312\351r0\262\037$\331\256\310\351\313\211>\020\370[\013@6<\363\007\326o\335\350\031\313d\230]U\356\262@\263\265\210"
+	.string	"\230\275-\216R\260f\f\327\256\001\364\216\265\r]\213t\375\340\240pT\225\255\271\304u6\347\232\316X\033)\300\241\217\276\277M\312b\300\324./tho\251\342\211\224\205\303dC5M~h\202,\300\313AR\200\206.\177%D\211\202\362\311\371\306Y\310\016\237f\207\215L]^\327V\276[\273\250T\315\013\307\316R\222\030\275\317t\3559\315\210,ol\254\255\366:5=V\356\367\256e\321\317\316>E$9\030\354:\020\"\376\236\327\362\261EZE/\236m\034H\026\364\333f]@\342yTo\236H\353\331<\240\036\320\037\275\323\244(\020\324\306\341\305B\255\325\364\032\032[\314Hj\247J0\205\365+\314\347N\216\240\375\207\316\337:\372\263\371\034\335\255\013\007\373H\023\237\225\023\316"
+	.ascii	"\357\366\242S\235\274\226\354!\257m\330k\004\370vg0\376\246\240"
+	.ascii	"\342z\bo\002\260\211y\364g(\003\021Z\031\336\243I\312\314\274"
+	.ascii	"\341\261\340>;z\350\274\265\357\032tV9\033[\246\327M\241G\033"
+	.ascii	"[4\252\205(\253\333\325"
+	.text
+	.section	.gnu.lto_flashPartitionFindByType.30.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`V\0025\024"
+	.string	"\026\247\210J\300\020)\035[\252\004\263\210\206\332\027\213\0055\350\332-0y\034\200\302\365\2511Eh<\n\016\334P\224\030\035F\215\323\016S^TN\037\324U\022\205m\233\242\350\022\330f\343+\300\004I\034\275>5\220\242'\215\354-wJ\001u"
+	.string	"l"
+	.string	"v"
+	.string	"6\020\236\022\230G\361\024-\266\201\21075\035\277\0162@Q\265\212.\213\027"
+	.string	"\236\206\017"
+	.string	"\236\256\b\203\237\342\rJ\333W \235+m\276\313W\223Uc\324\343\221\223\231#?\022<\377\201\221\240\t\335\351\003\247\021\227\343\3609\027\250\320\031\341\221\3030\327g|\361\361r&w\223\373\237K\027D\275%\241\234\356rERk\265\304\345j\356\360\266s\266\033\330\222%k##\004\317\316kc\263\302\213\377\352A7\265\364|\357\336)-W\372\035O*\212\252![\252uCU\216\032\203\036\225x\320\337\273\264o\037\310\037\335\362\203l\25714,\r\277\035T\255b\202\360>\376\217[='\205.4\3418\344\001\252\326\032rjWxz\273\305n\331\226\322\376\316yZ.\262L"
+	.ascii	"\365\006\"CQ\255\"\202rw0\304\031ty\376\017\351i\351\262v\306"
+	.ascii	" \271\023\272\271<\257V.\255\327t\223S\376\312\275\f\225#\034"
+	.ascii	"IF\225|QGF\263\217\034\237\216\357E6\360\364K\225|R;\037\262"
+	.ascii	"\025`\302\331^y\213\t\037oj\255\nL\316b\306\200\251\326:\262"
+	.ascii	"\342B\025|\234S\327T\344q\247\276\nxJ\367\343\347\215&\0348\335"
+	.ascii	"\213\254\332\034'\033R\273<[t\221\001\261\224\027L\006;y\225"
+	.ascii	"\260Vb\260\023\031\215\241\\H\231.\021\221P{Q\200\340\252\321"
+	.ascii	"b\026d4\230\353D\3662q\225\320j.\221\001\236\241\304h\256\224"
+	.ascii	"\331\214\346j\271~m\374\236;\370\341\214>\360D\377x\326\017\351"
+	.ascii	"i\262v\3165\311\313\302|X-\317\037B4\334u\222!\337\235\001\357"
+	.ascii	"$p\367T=\247\233\234\372\254\265V\360\300w\303\375\317iT\023"
+	.ascii	"\215\230\035\214\254\n( 0\002c\030\265\033\034\202\230\232\201"
+	.ascii	"\374nAV\310\025\265\020p\307Ylv\231\324;\255P!\342r,.!\215,\274"
+	.ascii	"\003\032=5\247a\247U%\326k\260\007\332\222\307\341\304N\264\023"
+	.ascii	"\f\355\031\270\352\253h&\326\372\206nI\360q\242-\031\255\307"
+	.ascii	"\335\215E`VV\022\034\021e\r\316\275Z\363\004"
+	.text
+	.section	.gnu.lto_flashPartitionFindByIndex.31.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\365\f"
+	.string	"\326\030ZD\020\261$\035\363T\n\352\300\345K2\303\257\327\216-\252#2\202\001:^D\037=\f\245\272\272w5\3376\344\f\373\317\200\221A\214\305KXUU\255!\352\244?\3504I\007\272F\252\232jl{o)S\nG"
+	.string	"@"
+	.string	"I"
+	.string	"%k\0036\032\230\021\b\233\226\034\240\335-z\273"
+	.string	"\370\347\361"
+	.string	"\360Og\256\335ij\276\351.\344g\306\t\265\341\352\022\320\360\220\032\241V\234\350\005\006\316SO\027\024KfHdw\235'\024\314\375n\233\201\355h\377\nA\366fJ\225\261\357Vcl\247\341o~\347\264j:5\375\320Y\364"
+	.string	"\3250Y\355\276\004\351\330\236\247\302\306v\311\026\331\326\264\021((\375\006\203u\367C\216\024\273\333\207\017x\374\331\366E|D\273!'\327\271\f\320\354\356\002\023\317\231\340\327\3749KI\201\177PU\307\205\312\007\005\007\2351\375\334P\275:P\275`I\034\366q^\302+\374\032[0O\376\364\347\233\007\376\245\002\350\340\364\372\324\013\330h\241\362Y\355P\311\027H%(\3263\t\b\204l$\302\203\230a\244\n\026V\022Q\254\221\223H\202e\021\204\200/\t$,R\270.,\212\266\275\3068\244\201D\313\216\302\0062B\254v\322\327\240\252\213ZDEW\234\312\370\2045\372\311v\206\257L>bl\023"
+	.ascii	"\037\023\360\324\361z\026\337`C\201\331\222\261\261\341\307\352"
+	.ascii	"\373Y\267\261I\201\363\007\252)\002\200\013Q\326\f\3275q<\023"
+	.ascii	"\272b*D\251j\240\271\024\024"
+	.text
+	.section	.gnu.lto_flashPartitionSet.32.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\007\005\205 "
+	.string	"\226\372\314I\220XN:D\362\301b\033\207\300\345\272\016%\217\033U|}H\026\334(\277\234\242H\245\324\341\005/?d\364\376<Xm\227?\311\335\264%l\001@A4\234\361\300\2251\310\302k\001J\272\240N\255u\327*!D\356\224\002\271"
+	.string	"\253"
+	.string	"\277"
+	.string	"\303\037\207\214\253U*\312\356v\023\301u\316\233\345q\316\233\246\324\206 ax+\"o\255E.\261Z\217\016\314\340v\323C[\313\217S\365I\270\222\216\204\251\265\3566\207\317\227\307\333\244\303\347p7\232\323,\227\016\375\034\321\305sRMQ\307%\220j\202\372\255\204\340E\004;\025\246\2472\200\020-?\376\203)\212\322\224;j@\242N\205\t\252\304\201\372R;2\211\236%\256i\254H\r\021\251\344I\362\300:\231\0215}\314xYV\270\032\242\243\206xTn\026r\311\315N\227\210HtOv\252\004Lk\315\2138\343\224\006C\255\325T\211\330t\353n\033i\373\203]6\tk\264\217FtoL\301\201U\364\336\260Kj\235\034\032j\234\227\3357\317\372m~\374k"
+	.ascii	"|\354\316\335\352\277}\3536O\352\362\244^JM)\365\t\234[\236v"
+	.ascii	"t\355\332\261\3128C\246J1\311z|\354/\373\267\276\366\375\260"
+	.ascii	"\227\371f\326\201\375\353c>\031\222\341\273.f\007\235\313\027"
+	.ascii	"\252\246\212V\265V\335\227\017\026\364$1\222\305\016\357\362"
+	.ascii	"\221X\027t/\237!8:Vb\005\266+V\033nA\266\356\346\217\264\316"
+	.ascii	"7\362#\303o\t\275\"1\341\226\222^\\j=6\270\351\f\307\233\263"
+	.ascii	"\206J\233zd\003\006\205\245\366\211\034+6\263\331y\363{U\025"
+	.ascii	"\244x\365t\340\211\252\213f\215\032\222T\3100\363i\277\3319$"
+	.ascii	"\213Ia{\263:\273\344\264\353\354\221\037\240\005\304\205\227"
+	.ascii	"*5\3165Z\200W\231\263\333F\033<\267K>;s{3ZmGtLYk\255\346\316"
+	.ascii	"s\233\263'\273\031\206m\013R\321\250\210v\244R\256\3218{\333"
+	.ascii	"\240\026\333\021\035\343\213\271w)D\246ZX\230(P~\002\252\302"
+	.ascii	"\2068\371\023\241\363&\316\232jab\210\\\354M\204\026\\Q:q4\337"
+	.ascii	"\221S\265\326\t7/\346\022g\362\263p\245\326\312\243\344KP\370"
+	.ascii	"T7\255\002H\257\004<o\336\354\315^~a\003\243\344TD\317lU\233"
+	.ascii	"\0271\033>!\257\347\327\343\303\353\341X\370z|~\346PP\350\343"
+	.ascii	"3{||\270 P\330\363y\020\006yB \235\357gHX\272\367\300\004\020"
+	.ascii	"/\005\211\035P\320\267\342\027\354\331\371\374x*v\275 \320\356"
+	.ascii	"\201\001\003\177|\301\235\020\b\f\356t\307\242\032\307P\264F"
+	.ascii	"\2715\232(-\306\r\215\307\251\263\346.\331\345\332 \336\305f"
+	.ascii	"\313\r\221\334\262k\2138\227\0215\273\373\223\\K2s[\273w-D\267"
+	.ascii	"Z+\217\357D\350\013p&\321h8\315\251\214\022\334\032\263\b\345"
+	.ascii	"\330nq,\276\b%\336\366S\300\006`_F\311\211\356\332\225\272\354"
+	.ascii	"\374K\367dJ\"\013\274\300Rok\264y\277\312\255\370\314\2472/b"
+	.ascii	"\250\221(\304\fB\214\021\021\031\021!\211!\035`\002\021\2523"
+	.ascii	"\017\021\360\251$FZ\222\302\264\033]U\002\230[\270\2647\024\216"
+	.ascii	"zM.\333\240\373\003\311\337\216\220\353\251w\027\267U_\216\226"
+	.ascii	"3\331\255\325K\216U\016\231\324w\327\257\177a1\227\265\226\256"
+	.ascii	"dn\311\277UD{@\003\364\254\252x\251\313\354u\270\252(\331\236"
+	.ascii	"\t%\335*\212\022Im\220\033h\263\217iIu\244\304\332\024\246\366"
+	.ascii	"K\336P\250%\354\333\033\304-\301\263\3328\033\020\320\372D\262"
+	.ascii	"\314\221\r\357\203\247\370\030SJdJv`\342\362<\255\316\025T\343"
+	.ascii	"H3\326+Wp\326\210\330\352,\204\005q6\331<\023\252\345\004\200"
+	.ascii	"\026E\307\301O\331?W\312\254\013\002:\214\354\301O\220|\371R"
+	.ascii	"\346\347]\322\327\202\251"
+	.text
+	.section	.gnu.lto_flashPartitionNames.33.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\235\007"
+	.string	"d\r\265"
+	.string	""
+	.string	""
+	.string	"k"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\370\356\n}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'5\230\367\006}\276\004\005\001'@\330\366\006}\301\003\005\001'K\230\366\006}\304\002\005\001'V\330\365\006}\307'a\365\006}\311\001"
+	.string	"?\202\210\2000{3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\nCONFIG   "
+	.string	"\013/root/repo"
+	.string	"\033./src/main/drivers/flash.c"
+	.string	"\nFIRMWARE "
+	.string	"\nBBMGMT\nFLASHFS  "
+	.string	"\nPARTITION"
+	.string	"\nUNKNOWN  "
+	.string	"\013"
+	.ascii	"h\020!\246\3010\b\032l\r\262\006[\203\254\301\326>\263VP\373"
+	.ascii	"\r\240\b"
+	.text
+	.section	.gnu.lto_flashPartitionGetTypeName.34.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"=\013"
+	.string	"\346\024M>\020Q\225\016qr\373\351z\r/ \275\007\313\374\351\367>\2259'\332\246H\345\0168\357x\3276\214\2534\243\354"
+	.string	"\313wu\001"
+	.string	"@\204\025\"(\323\231U@\347y1\341\266F\366\3362\2459"
+	.string	"<"
+	.string	"9"
+	.string	"\363\002\264\313\310\003h\2270u\357\021\252\347\203\036%*\217\326\f\026\337\206\303X\340\303Lq|\243x"
+	.string	"\266\202\235u-}\"UHew\255\244\317t\313\333f`\233b\037A\3621\r\262\030\027c7\303G\307\312\220\257\021\266?\366\304\266\252\375\023_}>=\226\354z\350x\261;\0258A\344\322@\264\355\227\270\211\217\275\001\023\204\t\"bv\301%\333\235\233\003\221\335]\340\243\270k\202\037\342\322\025:z\322\245\337\201\022\225\207\215WH?\264C\213\033+ DY\336\243)\344@\242F\013\306Hg\366\004)D\331\217\013O\216\237\277Z\375\030M\207\023}\241<\330X 8\3306\035\206B\246k\260I\310X\"l\227n\263Q\b\230\323`\272\215\303q\3356\231{x\262F\003\203\n\027\352{\332Y\007"
+	.string	"#<,AWBP\024-<\205\027\022"
+	.ascii	"^\005\314\323\031)\013\320\214\025!\f\f\2049\215\261sTs|\315"
+	.ascii	"\325\254\344BN4\206\361\324\036K\306\036\264\033I\tHU\rE\227"
+	.ascii	"\202\002"
+	.text
+	.section	.gnu.lto_flashInit.35.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\255\f"
+	.string	"\006\331YD"
+	.string	"\2216\035\030\202U\233\317\367A\362\221\274m\303\210asA\306\340\321\240\261\320\323\366{E\231\013\327\267f~\350<\fL\304\262\327\2721^\377\322\277\223\240\177\272R\347\271J\030s\037\002f\323\273\377\336)\005D"
+	.string	"C"
+	.string	"E"
+	.string	"\032.`\327\204\305\267[;l\200\372t=\207~R\337\320O\333>\360\001r\350\365\204\344$\017\035Xl\354VK\222x\3501\344\177\345\231\224\360\305+\341\0369\022\354\256\243W\002\342\226\267]\300\366\207\375\f\0013\276\020\344 9\273\212\242\034a?\263\273kibz\225?C!\200\031\205 }\220/uIbn\354i\276 \331\276\177\342\246\221Ww\224N\243\322\356V#v\365y\033dW\266c\264_\272\t\320U\002X\274G\345M\247\300\032_\bn\220\234;\367U|\205a\370(\206`\027\273\320\317\031\243%\005\246\2131\006\020\t\3342h\347\257o\3314'\273\335=\237\345)2\037\345\323\024\266x\357\323\337\250\005\f\361\2369\001!\030\210H\246\240\362\307\343\301\346\211"
+	.string	"bm\332u\001\323\034X\"\230G\202\365\3216\313c\200\263\t\227fU\3102\315\252jwS\251\031\2258uR\344M\264\0314\210+_@CD\b\212$\347"
+	.string	"\361(\376]T\213\273\360|\256x\357\242\246\220\020"
+	.ascii	"a\221\"34\030\341k\027\036\214\265\220s\033F\247\004\356S\341"
+	.ascii	"\351\326\204\312`C\327\2501!\036\241\3423\257\342\230\256I\006"
+	.text
+	.section	.gnu.lto_flashPartitionCount.36.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"\"\315/4Pm\222\016\004\210\314\002\250\272G\304\240o\222\224v\023\353}\3265n~\307\332[?\214+n 3\370W\314\314\020\231\257\3338GOy\031\253m\244\021\"So2\n\226f!!Z\025\007\242S!\304\206\216\206!n*+f\006\246\0348U|\240\250*^\264\354\003\271\207\371\274\211\257H\265E\267c\2117W\254\360\276M\205\356\001\\|\334\3505\217{\032_)\037\350\353v\217`C\211 \311\254\030\255\344\t4\t\375\327_\356GA\256\027I\032G\326P\006\305HJfFL\005\246B\251\001S\341\333\350Uw\335\206T\362P)\3012O\235\345 3wXf\321_\377\202\337\340\307\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\316\001\025\t"
+	.string	"\224\f\312\002"
+	.string	""
+	.string	""
+	.string	"\002\035\1774\204\271\266\223\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\r\031\200\204\001"
+	.string	""
+	.string	"\003\005\0335\016 \0176\002\020\1777\200\200\200\200\004\272\200\202\021\1778\022\1779\023\177:\024\177;\025\177<\026\177=\027\177>\030\177?\031\177@\032\177A\034\177B\377\377\377\377\003\036\177C\236\277\246\341"
+	.string	"\037\177D \177E\"\177F\005!G#\177H$\177I\001%\177J\037"
+	.string	""
+	.string	"\200\200\200\001&\177K\004"
+	.string	"\251\373\2528\001\265\001\003\005\030$\004\006u\004\007\b\225\001\004\t\nu\004\013\241\341\365\321\002\001\325\n\004\f\r\016\017\321\231\263\346\002\020\346\242\323\303\001\026\031\003\026d\003\026\200\004\001\202\001"
+	.ascii	"* 0\003\231\331v8\n\003 cHl\263\322\326rAX\216\274\fV%\r\026"
+	.ascii	"\304\221\207\023\322@}\225\177\205)p\022\306\303\322\006\004"
+	.ascii	"=\362\007\243l,=&\2761\362\033\021\036\341\277\361\r\337\360"
+	.ascii	"\r\337\370\215o\370\006|c\365G\366m\004\337\211\361g<f\254\f"
+	.text
+	.section	.gnu.lto_.refs.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\365\003"
+	.string	"B\t\024\016\200\230&\017i\367I\323\234j;Gv\n\257\376hJ\213s\370\020\037\364R\215t\203q\271\327\233=\276\270\002\323K\230\006\\\246\354F\233\321\363\244\202!\274\332\323K\n\020\260y\314\320\013nEu\242\377\360\035n\205\237\360\3306\264\245O^\f\022"
+	.string	"M\2436M\200o\310\275\236Y`\344\242\003\2370\001\334"
+	.ascii	"\003\300\342\237\224\300\035I\021XL\276Z\b]5\327\250\202\373"
+	.ascii	"\340\226"
+	.text
+	.section	.gnu.lto_.decls.514c41ff89c2eac4,"e",@progbits
+	.string	"(\265/\375`\274)\025\256"
+	.string	"\n\013\261:W \016\245\234t\252\272\273\372\373\276\363\243\316\254\331\372\237\373\377\\\357\250\032q1\325\204\210\336\335\372\375?f\226\356\232\275\365R#\345\243\332\325q<\224\236\0203\344$z\\0P\336\356\340\342\201\003\034\3301&?\204\342\363\315\370\3400\033C\020\312\\K\332\354\336R\246\022\003\235\003\262\003-d\357E2k@\303\254\301\217\355\n\351\004\332\363\031\312C\320\277\217}ed(Aa\324\367\2762ME_]j\321\031\222\256\035\3509\006j\223\005\013\f\322\330\024\023\2763\026\024\253\250\251\327\226\257\f\r\241\220j\313{\334\244W\005\bC\016E\032\225s\025\026\013\236m\251\025\265\345)\350\215f\223\273\266\214\307y\301\030.\232d\344\305"
+	.ascii	"\354\002%\304\331\226\245\360]\f\033U\313\266b(\331\3353\005"
+	.ascii	"\037Q\017C\2729>\202U\031i\313s/Hep\312\266,\307k5U\264\234\262"
+	.string	"\332\362\223\206b\367\326\325\226a\340\030Z,\t\326$\206\270Z\364C\357\254)\223\224T\203\252-;a\261\240\322\265j\362\f\322\204\207\366\204\263_vX\27049\303\335\331\270 rsm\277\203~pvk\263D\314\275\272%\347\266;\232\344\262\352\330\366Vl\226e\224\276\266'\001\372s\022$4DZK0\330\330d\356%@L\f4*\272\266|\306k\035\220EM\255\035\251)\222\244\"\256\255\032L\212#5\302\332~\003\250\223\323\030\355\2777\250\022\221+\273\2667\001e#,6\323\227\245\f\331\226\307\270\210\214\236\025\227\333\366\347\"\354\305fUiDu\307\356mf\350\2707\243\240\266L\306e\354\314\200\211\034\204\021^\217C\256\327L\227\036]\264\264\375\003\320s\006@\356\343\f\200\267\302b\300&I[\262\264\345&\013a\347\007\376:\203q\330\203\311\346\375\272\267Y\023\224\253\302b\254\255\007\346"
+	.string	"\264\037\240\377\207\\\003\fw\204\313\240\347\017\300\032\376"
+	.string	"|\243o\2425\231\003\020e\r\300\020?\203\265\b\r\"\204\r\277e\300\201\277\325\240A\370\033\347\177\375\255\002\256\341\267\035\312\354\214\345\237Y\260\202\023V?\273\370\031\306\317\\  \200\n?\177\370\353\321\206\237\013\300\241\312\317\035\250\314\233=)\377\331~\026\300\221\334\346\257t\3775\230\213\273{\033\300c\376z\366\237\312\317\004\350\371Y\004-\374<\202*\033\374_\3009\374\225\357g\f\260\004\371\277\344\347\016o\373\314_\267\376\367\375l\200\364\247\371k\216\f\220\\y\340\221\371+\215\237_\272\001\214\376\376\007\377j\3657\007\177w\370;"
+	.string	"\177o\370\033"
+	.ascii	"\177\333\374-\3637\360\357\377\214\345\347\275\237\365~\276\373"
+	.ascii	"\031\312\317O~n\373Y\311\317H~^\3739\355\347\262\237\307~^\376"
+	.ascii	"\334\364\263\220\237\233?\007\371\331\002?\003\371\371\307\317"
+	.ascii	"^?\373\370\317\302\317\367g\027\374\334\365s\217\237M\374\314"
+	.ascii	"\343\347\003\374\034\3653\327\177\263\377q\377\361\376\303\375"
+	.ascii	"\274\365s\214\237\245~\206\372O\344\177\330"
+	.string	"\317N?3\177.\372\231\350g\345\177)?\017\375,\3643\212\237\223?\007\375\214\374\277\302\317\307\237_\3603\361g\024\374<\374\031\001?\377\374\\\342\347\004\374\307\300\177\267\377\030\364\365\365\365\375@\021\377/\355/\200UL1l\334\232`\232\226\255\246\266\365\250\"\275&U\243[\223D\240\272\027Y\223j\266\334\213\254a\326\200Y\003\333e\205\243\fh\377\353B\377\232\"\tZ\024\204\211G\021\035\225\245\"+Dzv\r\313\024\2352K\265B\345,l\210\335\372HD\312\f\241>\002\207\242\204\235U\024O\035;\316\222DKZ\236[A\031\3244\235\216^ \3531h\346#\013\253\303\330\250\244\352\355#\322\005v\333v\331\202\362\"k\373\037\rtKk\351,\354l.\275\367\276\322|o\306\322i4H\233\233\fz\n\343\322z\235V\233hhQ\\\022\227\266\302f\374|\272\307)\"\344x\312\351\335\200"
+	.string	"\001\002\206/\311\023\036j\377k\201~\300\034\200\300\037\022\372\037\021z\313\245\312\006\311#D\274\232\312\224\227 wBC\332\346h\222\341\224\367a\006\213\\\020\017<'\006\2601\261\321wv\327\205\024^\330\017\026\243\t\336[\205\245\256\345:JK\351\030\232\256\347\032J?ag\3331\332\033\206\216\003\022cK\3335\215\366Z\nA\226%'\276 vKN|v-\244\256\355\372\253\337h\222\315{\fA\224+\203\237\"\264\330u\223v\302JtKN|#\3305\220\026\24296o\022\b|KN|7\301\241\253\247\335\006k\233c\254\301\311\223FT\224\265:E\226c\252-\\\247"
+	.string	"\006q\322b\017U\002\"Q\311s\n3\322Dh~\367R\271auS\254\211x5I\322n\215\244\2254\223^\302\316n\353\345{H;o\317:\215\2373\"\200\244\r\247\b\213y1\311Sk65\270\2666c1~\216]k\365\224\323Sr\303tM:%\032\333k@\026\3129!#G\354\027ZM\221\250;\344\016\364\366\006z\013\003\275]\201\336.\321\036k2vn\320eo\260\016\373\017\331\274\315\256\301\205\314\331\366v\b=o"
+	.string	"\254}}\274\001\360\225\017\265a\016\300\306C\231\2129"
+	.string	"7T7\364\317j\004}\035\202\276\362\360q\003\324\272\341\3264\243G\363`gwu\326YK\3170\273\367vWk5\027?\307$@\345\r\247\253_h\035F\230\344\201"
+	.ascii	"\321tW>\216\200\266w0\022\227*\025Lho\335\016\241\232\251H\247"
+	.ascii	"\267\263\266\257I\350\273\017\315\301\316\326qqtt\215\306\032"
+	.ascii	"\201\222%\247\016 \270K*\213\232\305\302\321\245\304N\331\366"
+	.ascii	"F\315\213#T]\025\364\252m\334\231\027+\270\310AA\337q\350\233"
+	.ascii	"\t\372^\202\362m4\364\375\005\243_\260\341\271)\373\205\225\224"
+	.ascii	"\333\224\033m\233\311\340\213(xv^\374\306t/AIKN|EM\304\317\247"
+	.ascii	"\346U\002\306)\227\234\370\264p\351c\321\017\244vJr\256\300i"
+	.ascii	"d\023\021\325\331\261^Q\320\021\223(\3546\024\204\024\204\223"
+	.ascii	"\210\020Z\006\205\342\240\362\356mj\331\222\002\210\022v\343"
+	.ascii	"\347\223\315M:\237\260\356m\266\350\250\206\352\252\226j\026"
+	.ascii	"\255\242W4UO\265\013v\366S\247x\033\365\321o\232\367&\357\275"
+	.ascii	"\017\341\347\272'\266\302YD\b-o\322)\004\001\311'jp|\3676A\334"
+	.ascii	"\200\250\211s\222Lr\343"
+	.string	"\324\004\343u\205\250E\322\273\211\t\030\347\305\342\331L\275\224\344y\255\264Uj\336X*[DSm\337C\315\354\245\r0\272\267+u\350\357J\370\r=\263\021)\273\256\255\207W\007\275\225-\324wcVym[\250\033E\017\275\205:)\223l\006-\226F\204V\240bdLUl||\025K_*#)\224y\266M\211\t\n\026)h}u_{{\035XXqY\322\354\221\227W\365h\300\345\035\365h\242\322\266\352M\031\273,\332V*u\312\013tt\365\016\265\271AtmX/=\262\256\326\244\274\336Q\300\t\356\331\266\332\325\272\032%\b\005\005J\r#+B\303\346\204\324\244\355\203H'N\352\223\306z\t#\233\221W#\306\225E\255\306\360\372\2442\351\230\362\326\266\306U\030\350\2300\251p\350\345%,\274%\017\031\031\\zHM^\341\216\366Vx\265\255oG\332\332j\0303a\332\360\234\340"
+	.ascii	"\242D\t"
+	.string	"\303A@lK\336L\215\265\030@\256\220 \311C\323^\260\001\027u\344H]Co\013\250\360\226<b\246\364\230;j\273\226#\313\312\250\355Q$\263\233\3254\364x\357\206+\367\351\203Mj\311K\201\366\232\326B3jkrz\365,\316\n\232R\333j\244\313Z\021S\013\330V\204\016\206Z\244\332\bb\361\221\244\245\013z\016\270\226\261\263\226\235\3156/\363\345(\357r\360\227;\364\334\203\353\330\331Y\307z\312Oy\357\322\003Z4\2318\370K\023\364\325Y\277^\301^\301j\030\217\260\365|Z~\370o\3455\354\007\203\326\215\262\266\177\001C\201\027\271\274\367*\375\232w\031$s\3761\177\370g\270\336\336["
+	.ascii	"\027\334{\274\202\245\207f\235!\243\356\341\376\367\2747Yu\214"
+	.ascii	"@\0253Y\245B\371Uu\217\311\033\307\f\313[uT~\335\233\341&\223"
+	.ascii	"G\tP\335\f\312\257\313\274(``\362mV\035o\222\352f\270\311\213"
+	.ascii	"\364\240LV1\225_Hf\006\345W\025\363~U]\233\233D.\211\222w\231"
+	.ascii	"\341~UM\271_TL\033\345\027\025S\371U5\305fJ-]\314=,+;>*\223\027"
+	.ascii	"\351H\n\271\264y*\233Tw\356^\036\023\272\313\003\334+E\265\234"
+	.ascii	"C\252`\264\240'R\220\031\222\212;\034\005YQ\335\344S\251Eu\257"
+	.ascii	"V\020\211{$\302\261\371\2744\370y|!u\215\204\356\025\300\321"
+	.ascii	"\275G\276\317{\357\361\336\373\262\224j"
+	.string	"\336\273\302F\211utt\357\323\315\321\225:\246\t\335\333cQ\320\230\312/+*\234\264\260/\254;\324<2\326\235\253Z\242_G!\327\350\336\313UP,\346\022\225$H~@\332\236^\320\315\325\3149\257t\351U\371\261\340b\361\244-\r\034\022\312T\333\231\245\265:)\307\213\036\335]\355\265m>\341Ca\324\026\255\331\\\021\204F\213\346\327\206'.\244n\002\203\222v\370\340bg\345\2521j\212<_\214v\324-#Y:\224\264\325\3427.8\034]\320w\030\0166\033\013\201F\255AS\357\235\002\202\205S\261\352\f6{\221\221we*\253\346\250:\330Y\261\252\215\327\253z\343\fL\252\303cC\355\201K\320\033 \021\264\276`\235\336`\334p\242\007\376@\017\314\222Qc\2648k\261\242-\214\232\347\013Iq,\320jU]\324*\032d\363\036\035@%\247\307\343\336\373\202\235\325\252R\201\270\t"
+	.string	"Z\016([\365\327\251\332\242\373\370\007\205\211lK\333\003\225\320\377\266\240\235\200\250\263\263FU)\n4\3571\246\b\032\336\222\357.\227\034\250]\035q\321\266V\241Z\311\2156\266 \365I\205\023\027\323\034\\\333W\247\332T\2312T\001\230\031*\202L\266\255\2279"
+	.string	"\353\022\316+\223\006\340\362\251y\307\352\0343\255\251\355\257*1y\016\213\005\023\346\322G'\341A\317\217\220h,\206Hy\200|v~\204!\210E\240\020\030\370\370"
+	.ascii	"\375\374\f\177^\2149\351\n\204E`\n\206D\022\306\341\317K\013"
+	.ascii	":\251\2175\246\305\022i\211\324G\330\202q'5\246<9\251\217p\204"
+	.ascii	"\361\007h\210\202\206bZBG\003\3064\005c\272B\006\025\244<?\025"
+	.ascii	"\350p\342\004\236\037\341\210\233\024F\300"
+	.string	"p\200\006\203\233\r\023\370@\206\n\310\030\205?\305\232\021\303\237\232bJ\004\272\371\216\220\230\376\244=\350E \241\003\022D\250\340\345\"J\370\240\204\017\200\027Q\002\016N\t$\340\240'\001\247j0\236D\217\t\fV\340\321\001B\301L1\247G\330\302\317\020\205\036\035\026\206\302\227\036\035\026\212;?\241\211b\320X4\001\303\341;9\033\210:$v\254\221\347'\r\026s~\206B\243\320H\324Q\301&5q\302h\215D\035c1\306\005\340Ix0\2004'&5q\202\205\2401\347\005-\302\244+\020\256\340\243c\034\222\200CLU(\322\364\240\305bJ\344\3411!5\n\211\0370\376\244D\"\320\216\206\021i\017Q\007\003E\241\314\211\"\320\t\351\t<>@\303\235\030\243\tF\240aZBh\f\032\323\234\224g\230\201\241\206\224gX\302\026s6P\201\032\243Q\005i\214\013)OM}x~tH"
+	.ascii	"\207\302F{\210&\234`G\307\004>>:;1'\341\201\217\211\022\302\034"
+	.ascii	"\017\037\232H\211!\214\303!1D\214\261\230Ss\202hLK\f\323\024"
+	.ascii	"\214iOL1'\3651\201\016\013\036(\n_|\206\303\023r~'xtR\016\020"
+	.ascii	"\207#\214B\235\024\310\020\207\306\235t\205\230\023>\2511\365"
+	.ascii	"1Qb\210BZ\324!\2465?\302\236\364\004\233\024\350Gh\374\031\242"
+	.ascii	"\240\201DQ\370#\034\221\241\204\016\261gHT!\355\3211\021C\242"
+	.ascii	"\b\344\323\302\317X\314Iw\204.\244\022\2301\346\210x1\346\200"
+	.ascii	"\020\202\361G\b\204\036\007\007\005\017\035\320@\n\350\216\007"
+	.ascii	"$\212:>-\204(\022S\027\204D\236\020?B\235\022!v\210\305\020\036"
+	.ascii	"\b\240\230\032O\234\300\243\223\022\203[5\314\222A\315\260\322"
+	.ascii	"\252A\363\f\322G#\313\352\210A\261d\202"
+	.string	"\242\355\255\216\337b\331\0345\251\004\300>\034zh\314\001\b\303\032\200\366\006\316-\216\230$S\331\215\266A\326pU\245T(\257(\265\215\272m\021ekT9\231{\034r\223^\316\226\370\330\343\273\312\247\0171BR\bq\022\343\266\306\355\013 \214p)(\217\035r\310\266\226\306i\236\336\324\362d\330\031\177\020&\013\306\027W\026\372\016\20681\231m-\214Ki-)FS\332\332\027g{\202\302'\303Z5\261\212\013jk\251\254\013v\336\315V\235Fm\210\314\315\006\372\027\360\335\200\226\305\355\224\332\024\214\252\027\350o\245\376\340K\231\\\024V\333\307\264@\037\363\204\036\n\252\2257T\025\n\223\253\t\217{\237>\310\200\001Q\213\"g\235\254\223UA\201*\300\265\255\254\261\266V\205\335\212\362#\207\232e\262L5\215\303\224\243,[\346\306\254\022;\255Ru\002\300\362\002Gty0Z\026\311\"\331%"
+	.ascii	"\356\025\273\312\222WC'\203\207\234M\272]V\246\024\324\224 \230"
+	.ascii	"\025Vi\225\326\250\303\022\230\030CGg6\305\255\321\335\257\312"
+	.ascii	"M+\253\255-b\263z\244l\250\257\255%b\261`\334\212(P`\224\026"
+	.ascii	"i\221V(xo\025\005\260\345\201\275h#\263A\267B\026\005\223*N\230"
+	.ascii	",\n\233\214\"\222$\322\245\371\203\313{\332b\263\237\325\236"
+	.ascii	"\335\331\235\026-\366\006\357\222J\007G\260\200MMX`[no\355{\033"
+	.ascii	"r\353\372j\027\034;\256\214u\2715?\310t<\341\322{/\001\203\221"
+	.ascii	"\250\242\3614G\362\2302C#2\"I\222\244\003\242\n\020\204bY\032"
+	.ascii	"\3101;\022@\024=\3202\307\f\315\210\210HA\n\222dc\f%\007\350"
+	.ascii	"\256\200\251\304\n 4t\344r\360\227q\313\325\301\027\301\360\023"
+	.ascii	"\275\354{\370\364\003~|\370\253\002\200@\370\257.C\006\354\242"
+	.ascii	"\tX\264-\315\023\007\363)6Pc\231#\374\371X\306\250\361h9}\203"
+	.ascii	"6fR\340\257\306C'a\357T\004\375\352\241)\313\304\227V\313M\227"
+	.ascii	"\016\205\026\254X&\344\343\262\210g=\020\202\003\265@\262!\016"
+	.ascii	"\240\270!#\026\260\250\350\327\002\241\361\222KMH\035.\2103^"
+	.ascii	"\365\230o\230y\320\264\262\356e\226B\007\201Xo\2133\317K]\340"
+	.ascii	"\213?mp|l~\261\232mI\355\350#\001fg\033\202\207\006, 0\004\261"
+	.ascii	"H\314\231\005\260"
+	.string	"\325I\207\205oK\245\321\321\234\333\306g\232S\026),\0227\016s3z7}]\330\317\375\257\342\306\302M\211\364\013#\033\367\251\211_\003\177M'mK\366\322\0355\276\330pj\363\267\304\321sB9\302v\315\037E\355{\366\336\240*A\273\034i\247D-\336\376\326#\274\364\223\257-\257\324\226l\017\353E\275\360Hf"
+	.string	"\301\204#\315^\247\2723~ZbXN\366w6\301p\314`Y\275Ko\322\2365\035\231n\267\030\260\364sk\320\351\2662\216\356?\037\bF\215\037\3513,\021\013\035\252p\327\204Ow\275\374\273\020\207\357\2362\325\022\032\254a\366C-1{\212\364\221S/\276\325e&+\224\205o\344?Cm\336\177\006\314\235{\262'F\333\336\177\246\216\2506\017\037\260\252\334\273J\0310n:\035\203E2\223\3018=\340\020,\265\217\350e\256\247L\331\305 c\24216\214\302\340\341\277\254?J\317"
+	.ascii	"\202W\277\036\330\320p@\003f\\\"V\322D\306O1\306\2756\330&\360"
+	.ascii	"S\360_\254\207\210\033f\361\206!j\253\222;\027\360\032l\232="
+	.ascii	"\204D\017r*y:5\346\373<\307\247\020\257(*9d\351\\\275\035\206"
+	.ascii	"R>\247b4\007\346\205@\262\\]}O\351\362U\240\230\364\265\210\377"
+	.ascii	"\024\020\177u+\226#\346\r\256\246i\237s\0324\320\t\207\t\234"
+	.ascii	"\303\371\"\263\025\261\344\231\373|Zo\252j\347LV3\272\004\234"
+	.ascii	"J\251Vn\234\200\032\227\001\254+\223\034\244\222\351\220|\204"
+	.ascii	"\200\2439\220Iz\024\231+\243.\327g`\3132P\355N+\322\007\336\346"
+	.ascii	"\276\362v=\340\246\265\001\243\335(w\264})\004\200\234\352\204"
+	.ascii	"\373O\244\005\321\237K\226gm\200\275{N\243-)\002W\260\262\275"
+	.ascii	"\b\301\342\276\263]\342\341\331\304|\227\363\030\330\241\013"
+	.ascii	"\212\007\240\253zD\337\237\236oD,{\240\032\350\206u\206p\251"
+	.ascii	"\215{\232q\263\315\022\317RU~Y\360\214W\005\240\030@\261\374"
+	.ascii	"\252A\2669\001\023\211e\277U\231>\276-3\210\263\326B\372\347"
+	.ascii	"o\254\017V\r\213cM\246\tU \306\355\301y0V\360\372\tK=\241\243"
+	.ascii	"\b\221f\377\32789\276\2424\274*V\227\326\263\213\374\206'"
+	.string	"\336\243w\220\254?\201\345\021\230\327\265o2\177B\271$C\270\306`\034\370\006\035?\241t,$\247\325\\X\b\312\371q\250\257\236\302N\004\322\334c\020\257\374\3674P2r`\\p\255n\322\260D\004\036\0030\254\177a;\256B\350\020Wu_\366\353R\220.\373\312\342\240\237\003\b{\353\260Vo\217\004\036\221T+\021\322\375\023\264\350\036'\235F\025\300\024\315\241\372\021\025XVk\f5\323\357\317\355\253\270\247m\361e !\"\034\345)\003\230\243\fl\260o\334\242vP=w\322\t2Xj\230\375\350o\357Upr\306\244v\2615@1H\037{\300\273u\321k\026[\264\013Da\303\217\367u\204\360r\351D7\365\036\300\313\024o\266\2125h\375^\333G\346\356\224i!>?\340\316f\213(=O\340\235XO\345\"\021\200\013\230\331\311\303\274i\3358\201F\030\2656q\311{\\Z\031\032\331"
+	.string	"\324\233\371\302\007\200T\372\025A'\375#\265\245A<\246\253C*\224~\317+\311wS'\023\020yDS_%u\0078\003.\264M\357\326\3711\2555c\374\311\230\337\354#\242#\b}[\034rP\2744\0258l\027\204n\024\270m\bk2\204\003:\252P\324\243\001&HU\025\\\rk\315\32474\346\001[g\237\236\027\220xy\257b\207\016\314\032\234'\205\314 `?\013FGU\030\246\210M\265\217C\212\320\305!l\\"
+	.string	"S\231N\021\002\270\266x\020&\305\267\313\267s\214?\205Im\035i~\266=;\301Q\340s"
+	.string	"\023\342P\304\b\304\367\214\304\207\307\343d\21392O\020ob\016\211YIo\037\206\352{\223\354\3602\372\342\\\347\206\203,\230\373\211N\223s$\254i_\215\254\330s9\325]h\022"
+	.string	"\225"
+	.string	"\276\366\316\025AF\"q\252\237\370\tO[\210\032\262\344MG\323W\177D\340\215<\366\223"
+	.string	"`\b\372\f\336\343\\2\227\324\177\212\331\300\361B1\266(Bi\270\347\027\373\225\334;\221\271\376\302A\320@\204>\r,=\251\2015\237\257\356\251\230Zh\030\206.\350(\330\023\244<\f\266"
+	.ascii	"l~J-x\252\252Z\250\0013\270@5\320\355\254T\213F\024\250\022\335"
+	.ascii	"t\330\3606\327\353\370\223l\201\030q\177\b\324\250W\2768\323"
+	.ascii	"\t(\247P\235\361\312\257\331\030\217\013&\305/\337[\2364\024"
+	.ascii	"\031*\231\227<;\022'\264\212\005\325\2532\302\273\205\336X\214"
+	.ascii	"\257\216\r\366\"V\002K\016\340i\241\245\023\275\177\336~0\364"
+	.ascii	"~\372\263\030\372va\203\316Y\362\367a\234\344\355\025\315g4\034"
+	.ascii	"\346\237\260c%\373\266/I7\337P\3405o\226\204'rK\332y\376\354"
+	.ascii	"\300\201L\274q\360\020\366\316\372\215\315\303am\321\017\272"
+	.ascii	"\323\263u\375\377t\035\326\337B\302\323b\217\313\021\335\"\377"
+	.ascii	"\016\342q\264\017fv\215;\217u\001\317$yO\320\371\005\336_A=\337"
+	.ascii	"q\366\352\024q=\017\035\217\237\215\205s\331i\350:\236\356~\016"
+	.ascii	"?!\307\005\261\215\254\333L\360\250\346\340\273?\304\261`\236"
+	.ascii	"k\275\256\372f\346R\274\225\365\221\364z\177\353g>3)#\007hy\366"
+	.ascii	"\375k\2563\2746\317\027\340\226\232En\256z\232\311]\272\207?"
+	.ascii	"_N(\3765\017\314S60\307\225\377\202\"\245\273\254\266\334F0>"
+	.ascii	"A\260\235\254\350\216\223\335\037^?\266V\327?w\354\360}\375#"
+	.ascii	"7l~\340[\261\271rb\017\237N\232\325\203u\363N\304\030\035\247"
+	.ascii	"\215=V\361\257\314\352\373\322\261\303\"\213|\311\323@o\027\f"
+	.ascii	"\357\365lBFW\313\2409\322\273\310\334\n"
+	.text
+	.section	.gnu.lto_.symtab.514c41ff89c2eac4,"e",@progbits
+	.string	"flashDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"flashIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"flashWaitForReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"flashEraseSector"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"flashEraseCompletely"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"flashPageProgramBegin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"flashPageProgramContinue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"flashPageProgramFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"flashPageProgram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"flashReadBytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"flashFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"flashGetGeometry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"flashPartitionFindByIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"flashPartitionSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"flashPartitionGetTypeName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"flashInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"flashPartitionCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"flashFile_detect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.514c41ff89c2eac4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,523 @@
+	.file	"flash_file.c"
+	.section	.gnu.lto_.profile.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"\265\005"
+	.string	"D\b\377"
+	.string	"\r"
+	.string	"\330\370\241\354\t"
+	.string	"\001\002\242\350\313\320\016\004\002"
+	.string	"\002\001\002\002\002\001\003\202\346\250\347\003\024\002\003\002\003\002\004\002\004\002\005\002\005\002\006\002\006\007\002\007\002\002\001\004\352\263\360\321\b\005\354\301\314\336\005"
+	.string	"\006\321\277\353\372\013\007\253\210\306\306\016"
+	.string	"\b\332\235\306\363\016\004\003\002\003\t\215\274\355\224\n\n\276\343\207\245\002\006\003\002\003\013\254\260\234\221\013(\002\b\002\t\002\n\002\002\013\002\001\f\365\374\362\271\007"
+	.string	"\025"
+	.string	"C\005\260\223CN`3\001@\336P6@\276\233\231\201,\200\322]"
+	.ascii	"p\215\314:\252^\325\t\025\254\n\267\363\334KSe.\254\202\345\006"
+	.ascii	"\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 \340m\003"
+	.string	"rD\r\025\260%\351\f\3030\312a\030\206\241c\264\265F\b!d\313\235R\352\252\260\227\201(x\2621\200\267Q\347:D\003]e\223]\214\305\256\266:z\304\343\n\006\002\027"
+	.string	";\221\374`b\f\020e\004\355\236"
+	.string	"\206\004v\260\004\301h\314t\217-\030\255\002\326\020@\315P0\203\002\""
+	.string	"\036N5\302a"
+	.ascii	"s\227\236\005\253\214\263\001,"
+	.text
+	.section	.gnu.lto_.inline.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\034\002\225\013"
+	.string	"fQ96@\305&\351\357b\225\256\367`4\330\007\377\002/\021\331E\034\240\253W\307Y:\375\030\245;\336\216\346\307\211\327\fst\214\007wN"
+	.string	"\354-\376\377\033k\215l\271S'"
+	.string	"("
+	.string	"/"
+	.string	"\017\352)C\242\244\320?\323\303\373@\210\021\241a\2010\242\365\r\355P\367\276\325?d&\304\367\217\323\314L|\314x\005\337\2278~\036\3340Q\2204[_\357\023\370\373\036\313\332\257\241\034\032\312\314\313\0255\226]\355v\367~\260c\300\b\344\022\231\331Z\002\240\024j\326\013hrA\222B\360\345V\355\262\314\264l\271\261l\240\035\314\3203s*\022\371X\251n\267\273\271\r\232F\247\254U\007\377?j\250^\375\005\026\246X\326\333A\321\204"
+	.ascii	"\222\301{\320\003%@EB\377>\r!\251p<2\206\323\274\276nfOO\002"
+	.ascii	"; `\002!R\226\036\372\201\323\003]\333\361\327\206/2Bm\370\366"
+	.ascii	"\032\3502\253Y\260Xp\260\245C\031nFccC\254\373\rZ\360m\217A\303"
+	.ascii	"\217\353\321\2358\223\220]\263\320\272#\037\003\305\315\250\255"
+	.ascii	"\253\314E\n\205\356h\231\230\212\334\327\255\262\340\356F\264"
+	.ascii	"a\267\331p\273\251\247D\246\275D\036\036\325\304\314\264 \254"
+	.ascii	"\237\200-4\303\313\3608Dd\360\205G\340\225\345/\250Err\004\373"
+	.ascii	"\345\034J\316\336\022\334\361(\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\251\002\255\f"
+	.string	"v\32193P\213\222\0160\211\2502\205\310\n\364\242\263fb331S\021\241\034\017\313=\024\340\203\370\200\231%\245\252Tp\331\262}\225m\025\r\215\355\t\"d'\031("
+	.string	"%"
+	.string	")"
+	.string	"\224\203\304\037\356\301H\006\255$\306\030o\244\336H\267i%\204$|\034\033\013Hh%<a\345g\371\331~#\255\264l!\356,{\200^\223\313O\330\234\225\260\345V\357\240N\310\036\322\177p\371\305[\234\267\002\236q\237qy)\262\260\005\247S\353\027\227\205\224\263\354\340\004e\302i\025\366k\352\f\224h\3401\f%\3721\027\321X\362Y\235\361\030\307x9\\\2660\255^h\362.\217\006\364\271>\022\227\203\246\303\301l\b\352\3414 T\255\024\"\256\211\311Ey\241\311\273.\020!Lgc\021\350\210\215J%W\013%*x\254en\034I\250Q\275C\024\324\f\005\255d:@\002b\224B\363\022"
+	.ascii	"\323\221\206%\255T3\023'Wy\026\313\001\304A`\323\300i4G\033D"
+	.ascii	"\232P\006\236w^\315\023%\373\236`\033\263/\20716\200`\006\343"
+	.ascii	"\215\300#\352\255\321g\020@\370j`\022\255\224\272sZ\307\324;"
+	.ascii	"\007*\313\217t\302\250\32300(I6\027x(\tq\340c|\013J!\202\264"
+	.ascii	"\275=\344\3300\030D\260\"\342\215\367W\256\037\002J\254\306H"
+	.ascii	"\007\n\364Nia$\022zG\361\230\021kjJ\001\312\363U\327,f\026\207"
+	.ascii	"\247\020\023xI\330Y\3655\226*(\003"
+	.text
+	.section	.gnu.lto_.pureconst.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\232\004\003\232\004\005\200\004\006"
+	.ascii	"\232\004\007\200\004\b\231\004\t\231\004\n\231\004\013\232\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\245\006"
+	.string	"\222\212\"(\240'\031\016\340\275\270\266^\227}\310\257s\025\357\241\277\256\221\331"
+	.string	"L\230\212\263\275\375\277\334y\373\277\265\335\366\336[\312\024/\r\210\222^\224\245\001Q\022\023\202Y\262\344\305?0p\2131\2668c7\213\367\2022\366\"(\272\365\374Vs\020@\375\334\215zh]\250F\005b\210HPX *G\fg\264\377\003\255:<&2BR\251\317\304$M\036\016t\256sl\002\372\373\2357\347\002\355\214R5\234\362\362\305\003\317H\036"
+	.ascii	"K\223\267Vc \222\264\013d\206!i_-\026\336\262\310\030\306\032"
+	.ascii	"`\006\3502q\021(p\032\251\256(\325\307g\024\204\233\2604[XG\026"
+	.ascii	"\"\200L\260\260\032\330\243\231\001\316\322`^\0062\271\354\013"
+	.ascii	"\262\036@\021"
+	.text
+	.section	.gnu.lto_.lto.f151ff8e38e235e0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashFile_vTable.24.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 \355\305\005"
+	.string	"\364\t\263"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\306\303\005\177}\270\306\243\005{y\370\305\303\005wu\270\305\243\007sq\370\304\303\007om\270\304\223\007ki\370\377\202\007sg\270\377\302\005ec\370\376\322\005a_\270\376\202\005a]"
+	.string	"?\202\210\200\320\001[Y\304\001W\303\001U\302\001S\301\001Q\300\001O\277\001M\276\001K\275\001I\274\001G\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/flash_file.c"
+	.string	"\n"
+	.string	"\200\024@\n \005\220\002H\001\244"
+	.ascii	"Rb\222b&\251\003\200\003"
+	.text
+	.section	.gnu.lto_flashFile_isReady.25.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"2N36Pm\222\016$\203(I\n\213G!\034\024oI\032S\024[\375\311\337p\330\335\nw\266\363C\261(\254\355&f\346\031Y@\005.K3\211pE\373\333\006!2\005\330\225\201\260\r\307\362\225\301:\031\247\301\341\243\351p\340G\303@\231\266\201\020\231\346\001^\332\007f0{\"0\rJx<\032<f\337\351n\026f\342Q|\034\271\247\361\005\310\314\374\235\336\205H\"\005\251\314Rj%O\252\222\216\277\277\350\003~\347\276\036E\211\372\021\252@\346\311\204$3\036\f/\255\216%\260Z]:`\265\372GH\020\2755r\224\026RH!*\231\021\276\215nu\333-H\035\006*\003e\3044\252\2630d\346\256\302d\321_\177\203_\341\277\b\005"
+	.ascii	"S\b\203\347\020\254\202\333.s^\327$\003"
+	.text
+	.section	.gnu.lto_flashFile_waitForReady.26.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 \375\r\007"
+	.string	"B\21635Po\322\030\240\336\262"
+	.string	"\020\016\265|\363\002\001g' \244Q=\267[\036\r\3017\370\311a6\262L;\365\231\231\025\315\241\303\312Hs\217\213\205\326\022i{\313\024\262\272@\322ce\2568\362sY\r\016Z\347cE-\223\240+\363D\210\253\363\020\253L\213\234\315X\204\314\242\004\206e\361\271\n\273\225\2436\024\260\342g\350A\214W\314\356\356\260\373\007G\242\021\202\225]\322K\313\236L&\033\277\376\333\003\374\357\275v\250\307\246\037\023\032\260\333\251\224\354\316\203\243F\247\247\016P:iT\200\322\351\037!a\233\323\251AZp\021\211\260\354\316\b3\224\323\307\255\n\242\005\034!()$\245\220\276\f\303\356\376F%\013\035\352o\360+\374\027\001\005"
+	.ascii	"T\b\203\347\220\254\202\337.s^\327$\003"
+	.text
+	.section	.gnu.lto_flashFile_eraseSector.27.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\273\001\005\021"
+	.string	"\206 sG\360\320&\035\273\363\365\346\361\274G\033\221\f\f\"\262\024\301G{\245q\214\357z\\\373\250=\0357\354\330\255\225Q\363\322\320\327=\272>\331\366\034X\016\234\376\341\211\326\020\302\271\365\265\255\237=\312\3326ido\271S\n["
+	.string	"W"
+	.string	"e"
+	.string	"\321~\212\253`\375\206\345 \27335|v\303\004\356\270O\207\017\331>\271\007\330>\315\262o<\234\255H\346\305\205\266cw;\035q\326\245F\226\177\332G1Y\353\022\304U\032\b\202\241\343C\326\"C`H\304N{\344 {\305(\202\260\273\2161\331\207{\336\266\004\333\023\354H Jc_\356\356Zg\354\347\334\246\347\374\245\353\334\244\337\374\243-z\023E\317-Z\316h\225\321QF\377cCAC"
+	.ascii	"\216]\230Z\217\005\232?%\256\363\333?\315%\333:\032\270\226\007"
+	.ascii	"\216\347\325!h7<\360\351\007v\f\217\303z\316\212\004\260-2/\016"
+	.ascii	"\270O\021\371w\361\027\240_c\224\027\037\363t\024\302\245\252"
+	.ascii	" F\206\313\320gBA>\25246i\324\n+f\264D!\333\026\336\263R\200"
+	.ascii	"g@\324\021N\017\217kIMz\0330\023\257X3IKzE\211\331\201\375\274"
+	.ascii	"\254z\213\025\0063\033\303Y\234p\273\333`\307d\205`V\303\262"
+	.ascii	"}\222t\342\354\330\334\270b\315\016[1\336\006\025\205o\225\202"
+	.ascii	"\362@\022\bz_*u\022y(\225\212\227*\021\0315\342\231\250JH.\200"
+	.ascii	"'\223\222\016\374<\025\325\227\3522\250N'\035\352\003\273\021"
+	.ascii	"\021\257P\274\257KY\255\276\256\024\356\345\352L\004\033 \227"
+	.ascii	"\276$HT}\355\216\261mj\223\234\342c^ \002\246-O\225\272\251\346"
+	.ascii	"\200\2350\351\324\273\f\271\002  P\0021\344\330\036\223\320\016"
+	.ascii	"\004N\354\026\005{\031\333\317\342r\232VE\335[\226EX\302\230"
+	.ascii	"\246\303\357\020\\H\347J\246\"\206\033\333l[\231\217\230j`\f"
+	.ascii	"q\254\235\354D\002\327(\240\260 \\\303g\035\375eif\264\360\362"
+	.ascii	"\274\311)\032\336\003"
+	.text
+	.section	.gnu.lto_flashFile_eraseCompletely.28.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"E\n"
+	.string	"fTH;0M\225\0163\030p\221\306\222\026\226\245\237\211\005\323\013}\355\"\307}8\234\320G\333\260D\317>x\263\320\316<\030:,\f`\324\200\026\347z\350\222\341\3419\\\213\b7\2222\2454"
+	.string	"4"
+	.string	":"
+	.string	"\021\307\306\241\275\013\250\016\033\017P\035\232\263S\367Fka\260"
+	.string	"2\245\330\335\250\032\316=9\377\037\356\350B\236\247u`w\235]\210\302\255\267M\300\366\304>$\237\374l\317\223\232\301>cw\327*\262_\372!#\255\232\316L\337\252N(\006|\273\023>\025\213\202\247\r\017\333O\373\035\356\201{\251s"
+	.string	"\273\242\024\211]/\366\245 \337\031\"A=\366M\037\001\301'\031\303\344;Lu\250\352\250pM\215\200VXs\021\231\201\221\355\340!\266\306\356N@l\036\024\030\221\016\375Nux\265\270`\202C)W\005\343\\\226\213\345\212\344\312`\227\004\0136J\346\0227\355\342`\232%2\300(\232X\321\266(\2018kpiq\223eZ|x{\306\252\310\bJ\240>\032\301\027\231\372\357>Q\251\006\016"
+	.ascii	"2\241q\034\030p\001\253\0067B\230\255\316\270\230\2171\375\365"
+	.ascii	"l\0130\340\022B\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_flashFile_pageProgramBegin.29.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"\005\013"
+	.string	"6\024LB O\234\016\240\231?\275M[\b\t\242i\362\217\250=\022\\N\352\371\203;\243\377Q\360o\372\207\337\224N\376\255J}\2120\030"
+	.string	"\224Q8\263\260\227\267\035!\330\023sqt\353\374\"\021\332d\357\224\0024"
+	.string	"<"
+	.string	"8"
+	.string	"\256\331\251\307k\\\247\3313\256S\2136\212\217\244\305D\026\034\244V\354n\235\025.^\212\376S\217\200B\235K,dw-A!\b\367\274\355\016\333\001\354[\002\246_b\027\t\023\034'v\037\254Z\254\212\206\300`\373\022\333\023\245\331\230\354\207C\tD\216\337 \376\264\261&\373\021E\260d\247\024\353\322~\206k\020o\342\034cw\224\002\304\356\350\021*\317l`:\355\360\0376\221\t#Js\332\n\356A\223\355\356\207\337\201\301\202\013\322\005\316uJU\210`!\301#W\366\330\221\223\202}kw\327sd\377\364\323\243\376\371\0056m\300\367i[\026\206\035\310q\032\326m^\246\343.\230\267J\367y\027\001\004B\355\273\324\020\3542\036\310\325\003\236f\240n`X+\024c\020t`M\200\301\200U2\356\255\235#\003(\021\022"
+	.ascii	"2\241\033\034\030.XG%\321\3648nvu\214]\343\032\360\017C\203\302"
+	.ascii	"0,\t!\200\360\231\032\005\227\245\251\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_flashFile_pageProgramContinue.30.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\224\005-#"
+	.string	"\252A0\016J\220\026R:\304x\t\343\300\353\342\241A\362\206O\224m\247s\034C\330(\f\224\265@\331"
+	.string	">4\322Yw\330\2422\316\321G\371\354\036\217x\342\002D\0223\242\260S4"
+	.string	"\310\r\260\237\n\340\332\375P\322\243\265\204\020\262\345N2\323"
+	.string	"\276"
+	.string	"\317"
+	.ascii	"H\0047\331BjO\004xoV\251\254\024\023\356\020'&\020:\254\204\356"
+	.ascii	"f\225\022\323\301\300Z\346\203]\310\323\221'\216\263\256Xe\214"
+	.ascii	"\254+R\001\363\322\233\214L\377\343@\236\030x\221ZF\334\214\257"
+	.ascii	"\341\030\230uE\362\b\234\347\274y\257s\336\354\032|\331f\271"
+	.ascii	"\\"
+	.string	".\177\221g\264\201\307\335R\025=\315\333\026\310O\376zY)\211F\250\343|d\2608\376vu^\240\265\235m\352x\023\264\3658>\371\302\246i\213\253\027E\261\"\307\331\246\250n\0031]\324\216v\037\256\251*\213\272\370\251\032\243\254y;\214LI\215Qx\037\004\361\262q\345m\321\210\302^\036-\336G\373\201*.D\243\213[4\302\272\256l\211F\026\347\2313s\026f6b6\035\004WQv\311\374#Wk\342oq\257\203=\361&\277\303y\363}\345\203bT\371\242\n\332\345\355\244\025\326Zw\0263\022\312\236lB\206\334X\314A@?\017\373\013|\310\357s\344?\340D~\001O;\357~v\326\365\344xT\313;\247e\235\323r\316i\031\347Z\276\271Y\266\271Y\256I-\323\244\226gp\226U\3242\016g\371\326\226\323\233e4\265|\232\226M\324\362=-\367\313\316\326\264|\003\250\217)"
+	.string	"\224\254\353\212\345\230U\212\251\246\343i\377\331_\366f>\363\213\360\225igT\300\212n\306Gc\365\346\231\031\225 D\351\3153?\361\223\2542s\0310\205\232J\311\304~tY\327\251\231\323CW\300\202v\331T\262\204\225\231\235\305C\307\006\352\003\351\332\242\362\201\347\256\213W\376\266\343\353\252\177\232\257\332\323\271.\356\032\247\233\206\030\024)+\206\371S6"
+	.ascii	"\235\316\23386\355\3237\327\246/\344\322uM\233Z~\327u]\357\256"
+	.ascii	"\201\032U\253\372\"\274\212B\362\\\377\364\005\030J\341\025M"
+	.ascii	"\007\320:\321\313L\237M\323\350\223!U\324\023\017\032@\2347g"
+	.ascii	"p}ku\327\270\336\215\r\313\004\233$\201(q\336\274\241]\240\323"
+	.ascii	"\364\334\344\254i\264uZ\204"
+	.string	"\\K\230\210R~\323y\363\354\027\217A\273\344\333o\263/\364\221\323\267{mX\246\233\271\350I\200\351\272\256B\374\265\bG?Z['\210^\202v\311?\360\314\351\356\223\2140\037\356{R\217\211\311\367sB\231\222\232\224$\364L\370(\250K\277\036\022R\223\021\332;\362\221\350q@B\371hA/\204\017\211\310\303RQ\b$\336\322\257G\302\367\343\300K\362\025\211\340\035\375\226x\013\b\260\322\210\336\217\307\244\244\364\343\251\310\365\215\3255\303\036R\202\035\205\313Y\333\274\323\374\344\257\202\314J\212TC\361\2052\026\345v\321\236\266]\274\357\334i#1,\025~\305\267\363\003\325\026&E\332Y\374\033jc\261jv\006muA\321u\221\357\311\323O>\005\323\005f\317\366\236.\nh\335\315\313\207\306\216\\\250\231k\2767\327<]\324uP\037\355\246W\025\027+\304\326\004\307\331Y\254\3239N\330\302\255"
+	.ascii	"\337\246\305\030\336\226!]\327U\350\346\237\350\364\333lp\225"
+	.ascii	"m\2501D\345\2143\244\220\224H\222\244I:\260\002\221\271\352\034"
+	.ascii	"\020P\251T\223a3\357\370|E+\215L\235Cb\300\334+\334\215\226\316"
+	.ascii	"\3105\204=\324\313u\247\317\217\345L_;\237\t\036\233\370\020"
+	.ascii	">c#\tD\3372\026-\206\316j3\340\005u\2261N\351\275\003r\214\327"
+	.ascii	"\334\254\347\253\217z\367\177\346\257\304\363\303L\233O\200\003"
+	.ascii	"o\024\2654\306/\326p~\224;J[\262\016'\222\332&\013\217]\331:"
+	.ascii	"w'\205X~<nA\333c\244\335X\250\300)\252\205\265\206\276^\350>"
+	.ascii	"\352eC\206\324\341lW\371\023\351\260\177.\275\006\373\0328\\"
+	.ascii	"p\367\013Y\261\rB\240\356F\n\354\001\250\2201#f;\230\263d\006"
+	.ascii	"I\213\306r\273\322\344\265\362\277\322\235\274\250"
+	.text
+	.section	.gnu.lto_flashFile_pageProgramFinish.31.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 \367\255\006"
+	.string	"\362\f/2pm\032\003\240]\212\204\306\356\277Y^\353\201d| \240V`\257\333\220\271\277T\026\032j\265\362\326\252\0322\261)q\301,\037Z\250\355\225M\312\224\002q\25261CI\235.QSQ\t\n\027FC\301K\306M%3\220\241\302,\300I^\360b\251\325\020%t\260,\t+\363vY-\020.\242\235\234\346*ZO\376\277.k\233\004\n!\030\371'JH\016\362<0*m\335ZgX\0033\350\301\001\177\026\352\370\247A!\305\257\323\003\221\037\305\002\221_\261V\304\363\342\022\305\207\004G\350?t\026\306\334\260\332\033\006\350x8n\022\302\377\266\216\347\343:\267-h{\320\366\023\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_flashFile_pageProgram.32.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`A\001\025\016"
+	.string	"V\032`F\360\2606\0358\234\262\035}>\327\364\363\316\023\354\237\346\177`s>\260\270w^e\213\253G\211\315'6\024\304\236P\255\252\017\3255\360)\n\016\023\2262\345\345Z\035B\243$\363\345\203\325{#4jd\357\275S\nG"
+	.string	"N"
+	.string	"L"
+	.ascii	" \364\322\376\314E\210\247Y\271\200\335\022\r\324\356\030\342"
+	.ascii	"\354z\365x\002\325\353\365\001\325\253E\273\306G\231\265bf\274"
+	.ascii	"\330\340\330\335lz\270x"
+	.string	")\372\317\271\207\004\303ri1\330]K\022\214\206{\336\366\001\333\021\354\217\b\366q~\372\232\177\236\346\227\227\005C\206\001\235\335\f;;6UY\200\260}\037\305O(7\031\302\r\354\325F\261\261\327c\266)\216\212\216\007'^4\230&,\024\370X\227\0223\250]T\210\027\310\361$\304\327\210\350\307\272\304`Pp\275\0067\375f\344\246\333x\327\356\236$\247]b\"O\362s\356q\343\"\3652Y<A_!\362p\320\tA\347O\256p\025*\001dv7\201\237\342B\350\177x\365W\252\327\237\216\300F\213\034\033Fr\307\036[\344\354`\237\356\356z\226\002%\2336\341\373\264\355\"\t\215\234t_\245\2054\216\206a\007r\234fu\233\227\322q\037\313\233H\367y\037\t$\241\366}\262\020\354R<\220\313N<\315$\333\3000\023\0011\210B\007f!\020\b\314\260qt\272\263d\0071R\243\331b"
+	.string	"\362\027U\001\032"
+	.ascii	"2C3\0258.\204\270\f\001A.\n\211\235\272\005]f\003\r\210\265\240"
+	.ascii	"9s\037\250\326\365\312\300\f\007$\353\n\013\230\003*\260P5\t"
+	.ascii	"!\200\360\231\032\005\227\245\251\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_flashFile_readBytes.33.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\006\002m\022"
+	.string	"\206#|E\340.i8\373\311\216F\230\203\3032\200#}\350\177\030$\232\005\257\242\277{\316\027\350\341\2048\003\211\252\205\230\321"
+	.string	"\372\356\177_\271\261D\214q;\250i\003\210\230w\302\030\301\017h`4\361\255\032\331{K\231Re"
+	.string	"a"
+	.string	"l"
+	.string	"6\021\022<\355\353|\307v\237\3137v{$\216v}\007\314B=\264\017e\333\347\360\0166;\t\364\341\360N7&\335\017\323\356\262:\036@|\b\036\200\370P-\334vP\323\346\277\034\004\3011\332\361f\256 G\217&\205\006\357\006v\210P\322=\350\031\303\303e\236Bv\327\271\343\311\334\341m\213\330n`\347\030\273\273\326\236}J\257\356\363kdZ\365\241;\343@\177\352<?\306}\377\305)-j:\024\323\240\2465L'\230\376\006\306L\t\016\243]\t?\026\253\024\202\300\360\241\333\027\362\211\206Z\2762{\b+l\232L\354\372<\036\232\001\3526;e\003\025\211\250\017\213\200\325\342z.(\310<O\013\270Z\\\252\032*\230\224\323"
+	.ascii	"\352uM?:\022\213\237\343\261$\277+\321\213\t*M\0034?]S\206\246"
+	.ascii	"T\245\037?\271\023\267\374e\350\211\276 \004\r\212\\\206\333"
+	.ascii	"UT\370\t\251\336\030C\257$=#p\251\302v\354\037Z\b,\331\016\356"
+	.ascii	"\341\004\265\273\b\212d\263\001K\273\373\034\027\361\341\365"
+	.ascii	"A/\200\324b\203\016L\376l\337K\352\215}0$#i\242R\2022\312D\332"
+	.ascii	"\b\203= \021k\265\221\366z\265N\243+\2662\276`'\273>FY\f6bRk"
+	.ascii	"\311`\254\032m\\\211\321^,\224X\353\204\345\242\325X\037\035"
+	.ascii	"\236\245\2144\226\312lFc\245|{\3559\005\211\202\256.jvt\322\343"
+	.ascii	"\242\306\330\026\325!0z\003U\272R\020\034#]\323*SC\325P\273\345"
+	.ascii	"\312\357\234\252\311\351\213\301& \200\002\231\301\353\001Y\002"
+	.ascii	"v\233#`\201\353\337\353y\037D\254\267\0245\225[\357\355\275\226"
+	.ascii	"\035\323\035\254\266\263\376\241H\332\362\374\221\005\277\315"
+	.ascii	"\260\365\013b\2313\036c\261\354\033\240\241\2467\024\3151X#\206"
+	.ascii	"\333)\3740\340\320\022\262t\204\200p\336\215d\203r\035h\332\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_flashFile_getGeometry.34.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\305\b"
+	.string	"6\020=9@\217\322\001\2305\220\375[\3770\306\033Z\0050\205\320\226}\0220\263}\257l\275\375\250\036\203N\003\252;\t2\343\030&\346\306\3202V\001Z\261\246\211&\237l\262wJ\001)"
+	.string	"/"
+	.string	"+"
+	.string	",\273\225\272\276 \373\324N\220}J\216\223\036I\376E\216}\254VBT\351\361\242\260\273\216!*u\313\333>\260\315\261\355\n\032(\b*\273\030\257\226=\231.\017\333#\033c;\306\263D\231\201\265h\235Lvk\202\251\366i\333\007y\310\310\244L]\245\004RN\027%\001\262\302~\013\f\b\355\210\223Hh\273\313\031\241\2300Xu|\372\242\3543\312\207\031\246\370\262k)\312\r\373\330J\225\343Y\3771\200\334\346\2058Ow\361\266\341>^\267\300"
+	.string	"v>\035\005?.\344}\036\352\340u\032\350\366\201t\2431\350\201\373(\004\b\364QL\335c+U\226\032S\f"
+	.ascii	".\023Z'F\206\303\363\274\024c\272\351Y\346\032\0161\201M\032"
+	.ascii	"\343\016A\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_flashFile_detect.35.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\212\007\265*"
+	.string	"*K\254\020D`^N:w}:\2175\353\177\243H\247\226\013\215\265\361G\207#4\315\211\216\257l\376\223\372\2146L#'\312\271\345\364\363\2570\234q|\300\274\370E\254/\333p\312\372!@\264\271kE,!d\313$\003\364"
+	.string	"\352"
+	.string	"\372"
+	.string	"O{3W\361\305\\\215\201\3741G\253z\232\216!\326\362rq\220\222\244\036\035\236\313\035\347\005[\336.\024S\340\316\230\367^\bG9\203\332\315\374\263\177\251:\230\036\017p\257X\233\232{\227\022\230\250\036\345\345\007\244G\325\013H\21723S\270P\305\353\227c[W\032\321Rc\336\273$\332(_O\024\004\376\206T_\212\236\266W\276\361D\276$\265\237\\\310\322\316\364\234t\205=\230\300IW\222\003\317\007wk"
+	.ascii	"=.\231\344\034\260e\005\371,I$\375\3333tZ\340\342\243\355q\311"
+	.ascii	"#'\260L -\317\2224\322"
+	.string	"j\323=\221\363\235\025\262\230I\202\202\264\346\200\\Z\235\306%\301\316\341\275\367\330\350\255\302~Z<:rw\314p\021\271=\211\3113dB\256\254\263\210\317\2265W{\003\341\272\352\366%\335{\271\221\\]g\341\231\031\0173\033\231}F\001\035\324c\211\017 \372H\016\232\251\003\227e\215?\016R\372\260V\311:\322#{1S\232\370\221\243\203\325\202\370@[1\036sv\223~\355rD\034\250\273\367x\344\b\365\370\201\001\t\023}\344\221%\200\214\003w\264F\346\247H\231O\374M\n_\227\233\262<\365\2528\233))nH\274\363\336+\245\314,\256F\311I\233\2439\263\213\247\261rc.\245\314/~f\311\027\347V\326\367M)3\323\3114\251\367^\f|\266\025Ea\035\225\030\351Q2\"yJ\316\362\254\272\311\2744\266U2\3376\233\315&[1\346/\317\303\247\235\217\016\3467\342\346\"\264\031"
+	.string	"\332,\3745\023\001\233\203j30m\376\245\315Ch\263\372k\366\r5\247j3\2126\237\276f\23367\332\374\tKIf\037\007p\356\335j\022\272p\350\033\331\227\017wa\277\306\262k\253&\r_u\237\2216\211_sJ\316\3626@\32137d\225\274\236\355R\237\205\201\206\207\220\317\242xz\314\300\214\342\300\351\335\245\226\317\274\336\f>\025^\227\254M\372\310\243\374\265Iz\264\353 \361\220\372y~d#\\\302QK<\363\252\\\243\364\221\251=\257\021k\344\323\242\226"
+	.string	"\032\035\333\237\323\232\370\332\362vW\307\250\326\335\217\321\333\034\223\356}\346\312\362 \364\224\265J\023\016\313\032y\301\220BL\237U2\204[\333{hy\032t[,\253\226>\322\332\273a\222e\215?\033S\345,\265J\036\332\2660\320\354\334\266m:\255=;%\365v\204\027S\311\0270\n\272\277vI\217,\363j\266z\351#\207\366wp\226zw\307\326\303\222\303D\255\362\317\303eK\356\264\312;JFot\312\346\232\214\262\300a&\350\257=N\204\205\257\035n\rc4\026\374\3630c\210C\3010\302"
+	.ascii	"\3761\240R\300`X\243hCj(uc\350T\214\202bz\032\276p\201\200k@"
+	.ascii	"\301@\3729="
+	.string	"u\221\007T\n\265\330\004\225\243\350\364\344\343&\244b\024\324\323\222\f*\246\250'\"\325T1\007\324\224\023\261\006\024\023\rb\323\024\025\021i\310R6\212S\304\033RRSD\340\362\376\274V\214S:&\233[\360_\323\253=\004\235\031\233\333\311_\323\"\013\204\231\213,'Y\331\253\363\336{\211\254\222\213\254A\n\324q{\365\327\372\343\\\201\254A\322 \351\272\325CV\256\356Z\261\016\021\216\365H\217\266\260\022\b\371\005\300~\255\223\"\026\264\220\325K8\266\026Q\217Q\300\237\320\002\260\006\332\216{W\215\024\332\to\200\314\202\025\032h\337$B\262\206U`\022\264>Kd\355\237\343\226\253\240\375\317\002\355\333~6\005\263\342v\274r\325M\3469h\354\366\200C\252\035\352\243jG\024a\342U&\200\210\250a \007\215S\006\"\021\221 IZH\007\240\"\221*2\017\021@5EE#\222\224D\035b"
+	.string	"\004q\372\277\262hl\234\362 \223C\027\022 \242\221\346z\301!\035dH\310\205\244\205U\222\032\307\003Q\355\272\021\273\204\255\020\324\365f\263\370\3342\300}p\244\362b;\005b;\032\362\364\205\363M\253A\374[\233j\221\211I\366\223k\250\220(U\234\232\237\252\030\3414\004T\364\321\032\351\325\\\322'\007.\016\035\026k\365\202\346\t\316M\201j\375 \371\345\025\326+"
+	.ascii	"\360*$_\361& \200\220\250\326\026niG6\275\277+\275w}\342\261"
+	.ascii	"\357/\303\367\020\253a<\260f\221i\007A\250\213C\032\344\260\200"
+	.ascii	"\341\240\200\241\230p\211^\005C\217\241&Hm\213\251.Ff\3538\323"
+	.ascii	"\rm\266\365s3\n\255,ad\214\375\365b\213\377\207:U';%\274U'&0"
+	.ascii	"\207{\007$\371\334\257\215\034\245I2\361$\371W\250O\324\353/"
+	.ascii	"s\323\371\305\355\257c\302\242\221q\3478X3\005\357\272\230ZQ"
+	.ascii	"\344\t5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`\241\001\215\t"
+	.string	"R\017;90\257\322\0017\337\272\200\007\2557\006\214x;v\375T5\326L\206'LW\017\244\004\275\310\210\260\240\240\240\240 +\337\3374\\[\026m\031\267\277\017\r\006\325\373\023\271\245\fk\020\262\214\350\210\2710\2647\"\357\210\007J\013G\233\0133\264)\214eH\214\244E@{\023\331\203`\221eho \363K\243\342\245\241\r"
+	.string	"\262T\001Ed\033\312\2602\341\200\241\3150\356\002\332Sd\246\230\305@\270\255\031\344\004z\206\3143\211\221c \240\027z\266&\205\265\222\r\223\326\024\356%<\305\272ju\226\352\253\324Q\250\237\270\326\272\333y7\361\266N\b\227\335\225_\275\350q\034G\323K\245{H\377\214>\022\235\324]\024z'{\227\301\n:\270\314\023\214\206\317C\236\203:\357\314\372}\031\026\273\337\375x`\255\326Z9\347\310\335\225\256\034"
+	.string	"u\231\362\364&(X\020gT):PP;"
+	.string	":"
+	.string	":"
+	.string	":"
+	.string	":"
+	.ascii	":\237\220\217.=\033a\\X\242\241\201&x@pP\017\250G\024\352\001"
+	.ascii	"\352\001\3650G\375\2410\033P\017P\203f\247\023"
+	.text
+	.section	.gnu.lto_.refs.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375 E\245\001"
+	.string	"R\004\f\021\200\265i\0033PV\210\t\334\"uw#\241-S\023\026\016\006$\222\206\305q\236\032px\321M\364\207N\350\244\327\246n\366\350e\257\323\376@"
+	.text
+	.section	.gnu.lto_.decls.f151ff8e38e235e0,"e",@progbits
+	.string	"(\265/\375`5#-\233"
+	.string	"\232\371\3206P R\322I\007w]Y\025\321\336\024F\242\221\227\341\267\264\025\002>\321\254\230H\213\t\233\026\246\323\232\n\336\016\274A-v\220\ro\273\267\030\235\366\242 "
+	.ascii	"!@UUU!\252*\004\250\312\314Y\022\"\021\021\025!Y\241\221\n\201"
+	.ascii	"\234\275\245L\001\334\002h\003g\0036\275\027\331J\274\206\371"
+	.ascii	"\030\316\b\b[\326x\354\007R\303M\2606>\353\353\233\305K+q\032"
+	.ascii	"n\362 S\006\260\252\244\270\334\233\276x\301\342\305\213\027"
+	.ascii	"/\270.\255\223\342\261\374w\006I\322-\241\361\3531\350\233\215"
+	.ascii	"M\317\231\325\035\322\031\372&C\337`\350\233\t\372.\202r\036"
+	.ascii	"\237\3414\002\326;\227a\274\337 \2457m$\372\314\306\332\276\261"
+	.ascii	"\320s\004g\375\373\343\b\3167\024\252\202\177\316\356%\224\227"
+	.ascii	"\374s"
+	.string	"\006\300y\350\341\370\347<\207Ay\256Y\216\351\316s\034f\007\231\362\234\275\027\211y\001\036\346\005n\324\222 \215\235\366\354\005=kA\317f_X\234\\J\330\246\274\274\360\033\247\f\307]\316g\314\304\025\006\373\201\030\216\327\330\215\341\312H\310s\303\2737\205c4\346\302pT*.\222\2116\274\027/\272.\311\227\323i\271\215\237\372\230?\210\240\314v+\266LQ\221|\270\361\022=+Q'8e.g\221\336{\f~ .\234\306[j\312\344\336!J\0048\226\241\362c\357\336\224\200\027\f\345\212M\026k\325t\240p\261K\266m\242g\310\021\310\230\266\267\001e-\234%\275,R\f\251\352\223k{\025\320\237\200\036\004\364\037\240|\371\347T\301>\247\0022P\013\330\307\347\244\222\"\t%\260P\371\371\213\301xJM6-o\331\275\351\n\333\264[\323\327\366g\262\363\224\377\202\f~\267s/\330\275\367"
+	.string	"\033\027E\216\256\355\321p\363\177\316\371\006\325\206M[^\202\3038u\301R\316b<\366\034dz\233\367\246=9rg\202\224\265U\200\177N;\001\372?\312\001\020\273\031\260\213\263\207]\234O\371\347D\331\347l\026?\373\364"
+	.string	"Ot\227\376\371yL\007\360\363\231\366\371\033\200\277{\232\347g6\235\342g>\177\276\371_'(\302\241w\376F\265<\370+\013\b\364\371\301\337\326o\206\257\370k\b?\247p\236\277n\360\376k\006\377\311 \370\271\201\003>\300_\005\3709\200\343\3745\002\004\336\363\327\022~.\353\373\317\375\363\317o\370\337\346"
+	.string	"\374\025\205\250\006.\367\277\376U\370\363\016?\367\3603\017?\027\375\\\343\347\340\317\303\237\215~\306\361\363\021\034l\200A\205\016F\320"
+	.ascii	"\370\277\305_i\370\231\357g\275\237\355~\016\363\363\332\317"
+	.ascii	"[~6\3739\354\347#~\326\372y\310\317\314\237\227?c\375|\365s\325"
+	.ascii	"\317T?O\375\334\343\347\250\237\241~.\376\377\373\257\367\237"
+	.ascii	"\315\317\350\317-~\346\361\363\322\317B\374\214\364\363\020\377"
+	.ascii	"\247\374\037\373\331\3703\005?O\360\363\213\237%\3709\202\237"
+	.ascii	"]\374\354\300\317\017\374\234\300\317\b\374\247\362\037\306\177"
+	.ascii	"\266\377)\376\376\376\376~\353\301o\345~\003jD\334\267\235\257"
+	.ascii	"I\177=V\244\024S\310\220\236h\313F\370\347\374a\237\223\355\200"
+	.ascii	"^/\352\267\345\351\310\237\037\n%e\233R\333\267\337\337{\275"
+	.ascii	"\246\373r\270w\200\363o\211^S\333\346\3536\357\276fs\273O\306"
+	.ascii	"\362^\244\356\353is/R\017\363\002\314\013X(YK\252\234\3667H?"
+	.ascii	"\247\016\373\234\235\006\350\255\306\347TR\245=(\220ETQ\3226"
+	.ascii	"\007\215\236Z\031\266d\353\235\271b3\243\244m\212\314\031\"\246"
+	.ascii	"\214\035\330\022\335\204\002r\353\2663.\311\024\266w\326Ds\331"
+	.ascii	"\321J\340Z\016j\254\252K\267\351\230\322Wv$9U!k0\246\244\247"
+	.ascii	"%\375\204\306\2222g)\016\310\231\026\036f^\r6FU\246\307t]\347"
+	.ascii	"\265]\223\351\271\026\323x}\327f8m\272\346\361~k/W\350\372\254"
+	.ascii	"\263\340$51\205\365\304}A:\301B.\214\016\230\032\035F|y\207\351"
+	.ascii	"'\3168\260 pO\304U'\340.\0320\235Lm^\227\016,0\334\006\tY\235"
+	.ascii	"[\032\364\206\213\275kc\3531k^`ko6\236\353\273\262,<\373\205"
+	.ascii	"\213\023;E\270(5my;\2613\265\243\311\246m\253uW\335\201e\013"
+	.ascii	"\0245\364\226,K\232\316S\031V\033\332;\r\335\332\221\352\265"
+	.ascii	"m,\335\325\303\304\244t\325\266\231\340\272b\345$\"\247\224V"
+	.ascii	"\345m\205\2339X\272\262\354h\333f\335\205*I\337\356\332vY\037"
+	.ascii	"\311\321\0222U\244mS\351#N-$L\245]\242\267O\3151>\2221\231\020"
+	.ascii	"{\217\341<U\361\222l\333R\272\253\347\f\227\217&m;\345\346\234"
+	.ascii	"\235\033\224\266\035\245\2154\025$\331[\333\016\343f\216\324"
+	.ascii	"\315zc*)\242L\225Ak{\213\004\366euD\245\031\003\345\375u\307"
+	.ascii	"\203T2\217\335e\331(\305\374\265y\322Nxtp\365 \322J\274\235\250"
+	.ascii	"\241\320B[\326\265\355$\272\253\0023+\254\256\346\3529\203\372"
+	.ascii	"\021\027\344\352\360\320\202\304\224&\r\205JYIb\327"
+	.string	"\266\231p3\305\037\233*Hm{\253\211\354\350e\365\335<\364h\354\223\304\357fl\r\n\022\222\326\221\223f\311\013\211\bP\244\026+`Gp\0235\273\203\343q\304\310\351\007D\312\230\221\"u\307\022zX\322\035(($\226ZDn\232kzoD\206t\234[SR\333\026\322LN[tV=\212]\260\024~^~|b\320s\213\223\377\270\305\371\367\322\305\032\271\244'mDc\375H\252\221j\033$\211\026!km\350y,\216\233<9\3672\327lU\365T\003\351\253\356\321T\375\243}t\021\234\266UC\275\225\035u\026-\325\246\255\030\013\203\351q\003\033\246\260\275:;\246\260=+\0363\006\017\254\255\370\256u\360 \323{\274A\fS\330\036Wa+L\205\006\037S\330^[\365\216~b8\252\364J\261T\035S\330^\006?_i+~\202\347x\216\351\205\272`\217)l\217E\016S\0228\273"
+	.ascii	"\354+\032j\323\262*\206\376\375\324N;G\254\3044\221V,3&Xm\273"
+	.ascii	"\251yD\371b\304\022\027\372\232\004\355\344S\036\236\217\266"
+	.ascii	"\257A\3203\336\036\243\341\271\271w\311\266%\306\f\243\001{C"
+	.ascii	"\352\245>vR35\222\323V\3426g;&\363L\234D\252\305J\333\352\366"
+	.ascii	"\232\204i\t\332\022\250,\245\234$.\\\352\032\213](\366\252+\362"
+	.ascii	"\344\311M\032\271\2650]^\327\376\036+\"Q\310\253\331\251\264"
+	.ascii	"/79+\277\225\272\3052qz\251\226G3@^fZh{\367R\271h\036U\354\246"
+	.ascii	"\230x\335\362\252\246\343fDi\327\266j\251M\240isP\230H\253Y\226"
+	.ascii	"\250\262\242d\206V\264je\b\037\027!m+\2263\260%sog\365\312W\021"
+	.ascii	"ZHr\322\370\272\246\304\322W\261\264\232\365P\335\333t+\362b"
+	.ascii	"\365m\241\220\302C\312\027\262W\263\327\262'J\310!\265\255Tx"
+	.ascii	"\250\334\262\340M\251_M\2104\235\264}\005b>\242\242\332\326&"
+	.ascii	"\027\231&3m\353\330\325v\250\346\366\212H\371B\217\344u\013I"
+	.ascii	"\r\253q;\367(v\241p\254xeQ\355\335$\225\013\036\036e\230D\234"
+	.ascii	"\274\206\275.qA\006'#\324\2322\245m\005;\03793%\t\245~1\261\273"
+	.ascii	"\342w\205V\257\n:\b\033!m\236\350\030\001\223\244\253m\363\325"
+	.ascii	"\316\252\304\311\264S\226\256 m"
+	.string	"k\327\313\\\221b\344\252r\275e\305%\265\255Lj\022\234\236\25569O\026&3\266)\364D\360\331\316\252\344uI\026,\"L'\364\257I\376\034\234*rV[m\217&\321\243G\364\354\305\325\3109\255F\352\0219\311{\245dx\331R^M\300S\205D\306\254\036a%\334\306\2549\203\036\007\214\226V\263\241\367\336"
+	.ascii	"\264(\251\\\360Z\034\363\253\355q\322\206\fi'\232\266\276\230"
+	.ascii	"\314\376\312\302\022\262\\\266\023*I{x8N(\026V\207\301\022\246"
+	.ascii	"\t\357Tsu\325c\250\212\233\024W\267\365\245\252\252\277\276\322"
+	.ascii	"\273\253\275\223\f}\365\301\225*\255TM\244&\257=[*\323\t~:A\317"
+	.ascii	"M\344\234\232j+\275\205S%\313\013\357\004\322\243G\247\361U\036"
+	.ascii	"\315\310\350\332\272\273\332\273TJ\027\277\361\213\212*\2036"
+	.ascii	"\207\276:\325\247W\250W\250fc\252[\311\300\335]=\271TE\270\370"
+	.ascii	"\r\027\237\027Iy\357\225\272I\2572i\347\344\033N\301\225\031"
+	.ascii	"\370o\357-\300(\275\307-H\364\320&X\220\254\256\300\375\r\334"
+	.ascii	"\275H\346\021\004f\024\222\371#\331d\336#R\311q\205\3622\217"
+	.ascii	"\311\346\275+.\022y$ayW$\2337\352*\201\211\342\2332\217\027\271"
+	.ascii	"\274+.\362\")\220D2\243\222M\244\250\025\311&3\3526\231W\305"
+	.ascii	"E\")u \257r\305m2\315\334\3462JE\262\271\214J6\231U\214DR\314"
+	.ascii	"^\224\032\222\254#l&\211\274ONWHJ\025p\311ty\351\356\345\262"
+	.ascii	"\245\253d\340\336\253\245\222\016\351\007\243%\301=%]AZ\022\340"
+	.ascii	"\224\224\265\274H\270"
+	.string	"$\327\362^\256\244\033\327I\3061\205\273G\030\3568\344\3526-\335[\200\323\275G\276p\367\336\343\275\027Gy\225\336[\245\"\271\345\344t/\025\013\247{uL[\272\267\313\304\240E%\233YK\240\264)\315\255\313\224\036y\353\3221\225h\363(\3456\235A\267\242z\344\265}m\372\353\216\312C\247\212\356IH[\246\343\237\263E\022\350U\307}n\224\360\001$I\333\003\330\347\254\310\252\304\351\333\352\322{\334\264\306\3340\241\001Fa\260\310(\034\252!\004\342\030Z\036\200\300b\321\r\320(4$<\"\032k\344\374\006\f\241\220\221Q\214b\216b\214#\241\215\n\2008\022\006\213*\2201#h\006\r $\300!ddd\177\003\006\221\261\030\024\036\001\213\303\242\241\233\337\2001\f\022\375\030\205\214\210\303\032g\r\2430H\304q\032\201\305\337\200aC\030$\032\2131\200DGEC\302`\fb\361(\206"
+	.string	"EEGB\341P\210c\f\002\006\021,\236?\f\2117\214C!N\r!`\221\315\201c\310\bht\032\215C@#\220H\005\001>?\006\b\031\205HH\321\242"
+	.string	"\001\036\004,\n\232\260\342CA\"P\b\264\201^\306\214\nf\320"
+	.string	"\002\34748\260\200\003\013\316\323\340"
+	.string	"\b\210\203\031@\350g"
+	.string	"UcP\215\032\303\240 \034\242\320\215!k\004\332@Q\f\342\344 \022\002\306@\034\232`\f\n\375\260\203\"G\021\320\b,\302a4\034\001X\024\"\002{\204A\033@\021T"
+	.string	"\217\204A\243p8\202\317\215bP\0304a\205\221\020\321\306\220\370\002\212\033\305\243\242\0327E\2401\207\bDB@b\2161\210\006\216\321\0061\204\240\032\200E:\b\315\340\303i4"
+	.string	"\030\204\002\210#\307\f9\305\240\023\214A)\2128hQ\007\030DP\206\"!\343p\006\020qh\034\002\312@\004\276P\004\332\020\302\301\223\203h\004\032\r\2016\320b\021H$\"\n\001h\f\022m0\n\201D\342\321\220\217\t@\033D\241\025\212\301\235\242\341P\204\240\233\034\305#\021\200\"\020\025\035\r\207P\030C0\036\r\201FAc\216\021\030\004$\032\2620\364\001\022\r\215l1\310\005\024z~\003F\021\016\243\240\002\037\342"
+	.string	"\022c\030\207Cb\f\024\306b\020p(\350\003\220\004#\020@\024>"
+	.ascii	"\211*\260"
+	.string	"\210H(t\343\034\006\233\207!!\035\212\212\204\206Pc\320\005\030\030\205\301#\364@@#(@C\013'\240C0\200E\301\032A7\212BE5b\024\211@\037\202D\242\030\302\240\220Q\214!b1\006\214\004\200\034\221c\204Y\030\031U\022\317\223\037je?\302p\035_\330\223\217\272\006&\226\006\313N\331\365\220i\331\315\331\"\364\274\312\362R+u\333\343U\255\356\230\314\213\302\021\202d\211\324\025\245\016]\025\223\032e\223V\234\021^\026jK\317\025\260+$\366\211\257\013\332\2304m\355\016\313\203\323\253\331&\236\26799\2728\024\b\0345\233L\313p\222ZXH7\364\267Lv)\312\335\222X[\035&SE|X\344\255\322\353\022y>\204X\265\265H6\311\311V\225\272\364d\356\232\330e\tkk\257=\366\030\3312\323\3622\307S\356q\355\211\371\013\303y\372\342\323\362\253fpQ\376\216\244\315"
+	.string	"\250\234<\265M\363\247\251|,\226G3\026\270uQ\202\245\363d\257\307\333\336+\337+\233\276('1k\324\324\263-?\274\035j(\230NOA\304\356^\361\356\252\036\213\3451o\201.\257\"O \250*\333:\363\252W\231n\366\234\376\320\264\255yW\373\031\023\231\222\266\325Le\302afu\361\253e\300\346^\353\346\252\335\257t~"
+	.string	")\362\244\201\200yj3\346\325N\315\246LQ\276\332V1tI\264\275\276\265\3250\214\005\310\021[8LoK\352\236x\rC\246\362-\361\362\322\266\306\235\314\033S*\257m\005S\271>\246\245\311\0272\\Hhi[\341\256V\261\226oim\253\227\253\355\340\235i\302\025\202\347\250r\341,\210\022\235A\206jDd$I\222\016\322\n\020\206Bi\240\347\356\006\022\300T5O2\310\314\310\210HR\222T\322\034W@\311\021\241\027\350\360\350'\013@}\017\025n\317t!J\024\262Q\332<\327\261G\227\323\362\360\360C=q:\353\320\n\262\343x\343D\255U)\364"
+	.string	"Z\320\325 \273v\240\277\222\254\232u\242W\026\3031\bE\013\343\223\252M]u\2558\323\364_\bM\031\330\321\203[\026\344\347\277\214$\251p\035F[\377\254\033\037\007|\312\377A\025BE\243\020\241~\205\273\323\213\202D\247\323\222\306\036\306j\270\3539\357\241p|\371\r0\204\023\264#4\333\217B\226\306\031\301\025\b\343\367\222\201e\267W?5\251-4\013\353\177\232\375\342"
+	.string	"\021y\214\020Pb\21268\tM L|yd\314\347ueI\035:\\\305\242s\3271E\360_V\305P\206(\204\3244\236\314\t]\013X]@*\2100wq,:\214\322.\\(\346Bg P+6:\265\250\247\352B\246W\021>-\t%\251\271\017\273\322wa,\367q\370\305=\265\331\013\243\257\214\265\265@\300\230\316\262\275\237^\354"
+	.string	"vr\322s\224\021 \021T\025\2725\230\233\t\373\263V\372F\251{\323\274M\033\232+"
+	.ascii	"*.m\325B\245\240\026x\303D\236v\016\241A3\030\254\250D\220\326"
+	.ascii	"_\204.O\003x\\\nP~\331\013\211\355\320\370\373[\223\220T@\273"
+	.ascii	"\037t\b\374\263H[\031K\317\350\267\346\270\027\005\215\",\310"
+	.ascii	"\313\007\023'\201]\2134\343t\322\263\257i{\271\273'h\0234\240"
+	.ascii	"\336\303q\3645\016ZGF\214\343\207\226\377#\361#\276\246|)\257"
+	.ascii	"\201\227i\353\377,\307\215\273\331\236i\027"
+	.string	"\363\007\235\250\350\206\274`\227hF\022\316)\306\377\253Z\226G\323Z\276%\264/\033\332\360m\0264\3056/\202\325 \234I`#\"&F\233\336\316.\262\224\035\3604\337\024f\341\242e\363FA\322\272\352Z\270 \b\3238\021/\373\325e:(\263l*\267,mT\225\267\006\031e\304\332^\237V\354\027_U\\\270lD\325\001\022:\202\006\005\325L]\303\317S1Z\212{\031\nt\205;\323\362\337:\302K\332x\2024<\264\037\237\221\205\017\200\330N\004\221\377P\265\357U\243\034:\251\017\t:4XL\242\231\267\241\335\fE\333\313F\215\201\231\037'Ds\004\332_\236S\202\311\242\016\357\3569\252%\211\004\276\215\334\032^\234r\362\223\336\2414%\b\272d\330_c\230B\220\377Q\3134\350\331\002\226\201\260\350-H\300\316g1N\266\222?h\232"
+	.string	"O\214y\020vHci;\016\242N\204\023\326;\304w\022\251mOk\252`)\033`W\236\030\317\264cU\302Pr\372W\344E\330\230\352u|D\273\312\214C\362\266JU\200\335\326\317\305\2363\314\270<\277\007\270\016\034i\340-`G\365\311\351;]\321\337\214\302#\b\364\n\350|m\031]\330\200\240p\205\300h\276oZ-\247\235>\"\226\360\273\031\r\022\2155\026"
+	.ascii	"\346x\377\215v\022"
+	.string	"'\256FYP\354F\26412h\346\245J\004f\374v;\36080\204T\177\021\371\254j\255\343\030\002\265\\\366\266\247\006)\302t_\021\310\313\036\240\253GU\353\006Wm\360\300\327D]\026!\216lX\220Tt\027\214\301.\034\r\371\363\356\266\244)\350\257P\001xqa\377W\264\360\345\223y\031\240|\221\223HKL\274\002\203w\312\233v\205\226\177LGV\330\002A\036\001\272\034\233\032{\021\212\337\263\354sY\370S\237V\363\003X;qMm 9\177\206\232\357\221\326\233'\021k<W\257>\2638\327{\006+\326\035\331\325n\356G\006\214F\234\t\340:\200:X\200\354\"y\375{fd\216\215\243g\314\222q\235\025j\343oG~\033\256k\342Z\314\037w\251\257\211\233=\301m\027\230D\t\371\240\217\360?v S\276m 4(\261\023`\302\330\332c\260\363\367\303\364v\331\254{\241\252\370\026"
+	.ascii	"\r\343\316\312,\277\200~\2434n\034\274\027\t\004"
+	.string	"\250\030\211At\334\031\037\323\243\304f\032\257\310'B\177F\025\b\207\264;\250\016\267\215\260\202\276\016\030\t\314e\0014\t\0040\304T\255\316\205\215\310\002_\246\206\026\326\f\247ql\346\251\316\242\3172'\235\362y\262$\032\314\200\033@\212\360\351=\"]\365\357Z \214\\:\004a\3372I\201N~\353\374F\374yW\276\037\\\245@\n2[\214\300\204\303\307\373O\224\236\f\357\362\245\337\344\233[\327#\363\314o\377\fO\307\343\230x\364\203\231>\0373\370\343\020<\033\345\273Qk\357a\036\351\347\344\003\236\340\253\177\032\371\3115>\357\310\177\320LB7\212\274\003\273\211\312Sg\277\025h\324\026'\260w\276\356\204Do3\263\343\033\374/\n\003\211\177\"\365\205\377u\021\216\304\227\220\266\t6\024\270p\037i\362\002\365\211y\201e\003\272H?\227\033\352\020\372\205\301\027\207\313\304]v\350\360\366M\020\273"
+	.ascii	"\261ng\335\317@\347\325\0065\247\361W>\322\260o\355\327!\"K\357"
+	.ascii	"\276\304XH\254\230\314G\227;k\343\2137\333\327\366G\3714|\033"
+	.ascii	"\225\310\347\033\252\003_Q\222\227\344\310\300\206\375\375\264"
+	.ascii	"\322\017\332\357\223g\203M\327\322.u\217\325\244\025"
+	.text
+	.section	.gnu.lto_.symtab.f151ff8e38e235e0,"e",@progbits
+	.string	"flashFile_detect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"flashFile_vTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"mmap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"ftruncate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"lseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"open"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f151ff8e38e235e0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,847 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\r\006"
+	.string	"$\t\025\001"
+	.string	"\027"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\202\371\271\222\f\023\234\253\215\342\007"
+	.string	"\024\025\354\301\314\336\005"
+	.string	"\026\240\342\234\212\n"
+	.string	"\023"
+	.string	"#3\034\234qiMf\333\302+"
+	.ascii	"\234\001G\261y*'\201\226(Sc\020\303U\260\317e\263\247\306\003"
+	.ascii	"[\\\3662g{\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \302M\003"
+	.string	"t\003\266"
+	.string	"\026"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022\001\003\023"
+	.string	"\001\024\001\003\025\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\027"
+	.ascii	"-\241A\f\020p\316\2019\n \340\2303@`\253\027\273\201\b\210\001"
+	.ascii	"\301\001\216\301\344\006\254\200q`00\004\214\003\203\251L{\t"
+	.ascii	"n\003m"
+	.text
+	.section	.gnu.lto_.inline.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\007\007\335\016"
+	.string	"\306Q>6@\217\322\001\207}r"
+	.string	"\002\3101B\347\262\021\277\253K"
+	.string	"\200S\357\002\375\316\004\031\r\200\261c\277\313\350x\214\037\227a@@\224\240\226\205md\223M6\221R\312\024("
+	.string	"1"
+	.string	"2"
+	.ascii	"\016\347\353\207IB$\321;o\370X\177\267\325\376\371o\365z\215"
+	.ascii	"\334\327\177\335\377 \245\204\370\367\327\270RJ\311\377\301/"
+	.ascii	"\227+Q\221Q\002\017\261w=\001CU=\273\032\245D\230\343\335Y&\355"
+	.ascii	"\326\336qGLR&\254ok\337\356\360\213\212E\207\376=\266\005W\225"
+	.ascii	"\301\301\rp\343\323\311\312(s\200\214\326\257\3371*Ur\336\333"
+	.ascii	"\2767oOk0[\325\005\227m\203:\321HC\225=\323h\332t\nAq\036 '\325"
+	.ascii	"\353\253B7(\210<\347\\\365~\3169\255\023 <\262k)\201P\330\007"
+	.ascii	"\376+\207\217Y=\013t\224T\002\241\334\265\275~6\305\022\332\270"
+	.ascii	"\036\360Y\212\213\217\210e\250QQ4EbA\n\n\225\345\320\"\231)Z"
+	.ascii	"\007\022\200\203\035B\222\220b\004!&xB\211H\242\222\210\242\250"
+	.ascii	"\202\344\001\016\214Z\021[C.M\336+\255G\333\256\205\030\337\330"
+	.ascii	"O.\370\231qr\313\r\335\302\034\363$\353\354[\200\310<\301Z\202"
+	.ascii	"\231\232a\233\304\276\335\314h\202\372\242_\214\362\2117 *\366"
+	.ascii	"|[\222\343\236U\003\351\256\264\345\031\322\261\215\252\365\272"
+	.ascii	"Z\276\257m\027-W6~\r\266+\356\247\352\021\362\0260\336\312%\377"
+	.ascii	"\317\230\343X\003$'K`\f\020\274L\312\210!\330\254\211\266\353"
+	.ascii	"\022s547\n\037\231jk\332\333\234\370\036\312@;\240\274\230\023"
+	.ascii	"~c\333LdwdD\265&F3\026sr\361\237\274-~\335\211A\\\247P\331\221"
+	.ascii	"\227\322l\233\260\220#\252\340\362"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \366\025\004"
+	.string	"B\006\025\037\240'\351?\370\377\353L\252\252\306\372\377\017\253+L\330\377\377\337H7Kk\377\223F\266L2TJ>B\035HC\201\240$]\210\3427\225 \203\324u]\352\233\356J\276 0\343\027\003\026\304\027\324\255i>\f?\314d\321q\254W\332\177]\366L\260\021\022"
+	.ascii	"X\020\024s\034\030\f\250yD]\b\206\250\214[s\244\243\006\016\024"
+	.ascii	"cD\351\365\022\032\214\003\203\251\f\3019.\225\2616\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"r\304\016\030\220+\035\377\250\013b\315\314\314$3s7\\\327u]\327\265Mkd\007\237\364EW\320|\246s\233\313\334\345*7\271\310<>c\026\223\230\303\024\3463\230\300\\\237MfF\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`{\001-\006"
+	.string	"2\207\026\036\240'\351\377\347J\374\377\277\013\251\252\316\377\273\025\033i\215\310\332&ki\333\326Z\2232\0057\253\fB\216\313#E\2467#\342B\341\205\322\276\312\204A\350@YD\274\211bU\360L\371\322\256\312c\200\307"
+	.ascii	"\307\300\004\261\303\214\224\276\323\357{\316\255\\\225\377q"
+	.ascii	"ds\017\0010 \300\002\0212\262\003\246-\002\263\261n\t;\262_\026"
+	.ascii	"\271\005\202\263~\311\370\334y\214\034\254\202\311\313\246{H"
+	.ascii	"\214\006 6L\005\003\213\013\020\016\201)S\0207\243\032F\017\217"
+	.ascii	"\230;'M\242\255T\0068\227\211\024K\324\027\250\205u.\211\023"
+	.ascii	"\374\336\206b&\334\323\270=8\353\312z1\317\002#\265\3671\213"
+	.ascii	"\305\305u\003"
+	.text
+	.section	.gnu.lto_.lto.c9cc724c91ce1ddd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016\244D\214*\237\310H\242CVH\315%\212\254G\213Q\024edw\003\320\201%x\227\354uUUuUE\277{\244b\276^\307\376n\226\020\231\002\217bw8\217r\037\350\201\240\340\202k\240\024\030\\\007~\034g\363s\360@\367\360\036t\232\230m\326\215@\242M|\f\261\226\361\275d\263\276W\333\206\271P\006R2+ZX\362D*\351\370\373\203^\3633\326+\242"
+	.string	"\231\026\007IfD\330 S\351\277\037\005\001]m\342\206\305$bB1\262\222\031\335\261\002S\245L\003\246JM\243UYu\033\322\213\007\206\212h\024*\303$d\346L4\262\350\255\177\301\177\360_\004\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001 ;\261]zy\027\265\304/\203\327\342f\312\262\263}\333aD>\312\007\002\375eF a\006\250\252\210(F\027\271\223\370\347=\016\203H\333D\356\224\002\361r\356p\342\0051\351\231\270d\003|\270\030\034`Gb\220\263q\204\360H\030\021\243\204\232\251\235Z\335T\0134\005\331\306^\"a\355f(\370$\026\024\026\310\237_\241"
+	.string	"%\315\235\354\tr\332a\237Z\335\254/\375\216\252TX\bRv7N1\273\362L!\266?\266\306\266s/]<`w#\241\354\316\004\037X\177\266}\221\223>\3166\363cT\265\274h\234\300\354N\350\371\201\314\237u\201\314\237z<\273\313\374\217\2342q\270\204D\030w\325\302\356\332\205D\243[o\333\3006\202m\223\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\345\007"
+	.string	"\"O66@s\322\001\030\334u"
+	.string	",Gfst}ev\304\273\323\310M<Y\216\021\251\bD\235\021\327\037nk\214\237a ,\\\0324\300\355\357g*\236X\262\311\226)\005\361R\177<\361\202\230\004U\\\362\001F\\\016\020\360#1\350)p\224"
+	.string	"I8\021\243\204\235\271\335\316\035l.d\033\373\n\205\265\273\301\340\2330,,\222?\377\302\001\2246\275\261gH]\210}j\035\311\356\363W\212C#c\320\262\333qc\2631\357db;\263;\266U\355\227\236\222}f\\`\227T\362\262;\027\234`\375yZ\266\375\223\243d\326t\216xT\246\031\016\226\232\335\t\003NP\375\351\007\252?'r\355\252\371W9u\002\201\021\2154\256\234\206\335\265\212F\037\267\273m\004\333\n\266]\002\f"
+	.ascii	"2\003\302\260\2268\0343\203\031c\273k8\307\0046i\214\016L\020"
+	.ascii	"p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\b\001\005\r"
+	.string	"vYXA \217\223\016\365*\364H(\371\004.\247F\341\027\3068\255\271\220`\202+\337J\221\335E\207SG\232\355\300\221\262\277\031\345.\361C\225"
+	.string	"\3000$\004e\214G\203\003i\300h)6B\310\226R\246\024F"
+	.string	"B"
+	.string	"H"
+	.string	"W\331\354\222v\"\356(\246\221\026\027\273\213\025\270"
+	.string	"\352O\037\200\372\313\r\337\256\211\233O\341z\026\"\030\022\256\344\251\f^8\017\032\234G\r\254 \361\225#\210\373 V\033\273k$\341.\334\357\266\033\330N`\277B\212\266\036\272z\367?Ek\2423\321\230\350g2LP\0208\355Z8\301\330\230g\242\203\317r\022\310C\370\245\270@\354\353\233}\241\375\321Al\357B\016`7\224Rb\267S`\004\326\237;\313\266\377!\324\023SK\"'\036<\271\312\347W\256*\"\230\021\323I\366\370\210\314\332\375,\360E|H\3609\374\371\034\352\257\312\223~\200k\2212\352\340)c\234"
+	.string	"eH\207P/MJPXT|\360\205\335y05\330\327\315\220\035\331\006\315\241\3116\030G\353\230\260\321\036`\0206\016<0\016\215\203i\0068\213\320\241a\037Y\246a\227mw\235\353f\310\031\3432J+\203\301\345\0045\327\004\331\326\364F'=\232i\3453\356\022\205\231Y\265\210\230\266\373%\027"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP+-\364\365\272zd\226"
+	.ascii	"\004\325r 7\222\272P\252\032h.\005\005"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`4\001=\016"
+	.string	"\266\232^C\020\221\223\016\244\2544\242\030\334\377\307\317\017\333\245\357?B\372\232\026=6\316\375\0171\314A\342\376\333o\323z\034\303\234\017@8\212\003\276"
+	.string	""
+	.string	"P\204<\242\200\240\013}\020\224CH\267\217\b\331{K\231RK"
+	.string	"I"
+	.string	"L"
+	.ascii	"v\352u%\356,)('\033\273\213\021\270\200x\370\036 \036\352\207"
+	.ascii	"o\177\232\233\017\363\347\002\002%\3420\374\235F\311F\304\251"
+	.ascii	"\\\037\203\032\256\345\203\003"
+	.string	"\275\0023f~z\216\270P\246\325`w\235\"N\303\ro\333\201\355\004\366[\0020\375^Z\337\375\331\341A\002\006\202\325n\206\025\216UA\027\"|\231\243J\236\3020\306Q\374D\362\030k\314\214\313\356\222\330\234\022\233\363\315\346\244}\323Ol\357L\016`\227\244\242\305n\247\300\007\256Cw\227m\337\304_\266P_\352d\005\224+\253>\375\351\357\245d\203rs\224#\234\205\310\265\033Z\340\257\270\220\371!(\350Q7\300\325(a\372\344Js\274\030uP\233\304\324\r*\036dd\204\362\206\335\201RY\354\277U\222\035\323WL[0\035a\032\006\231'\r\322\311<\330\210\026b\301\243A\300$x\036\210` \332\b\326\031\340lB\210\206U\3102\r\343t\237\277U\222UEcR\253\203\003\315Jv~\351\310\366\245\207\371SD#T\037\005\275\250\226\336\343NE\250Q\255\323\311\315v\327\304\247\001\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205\260\332C\203\226Et\242_i\342u5\312,\t\252\345@n$u!\315\361"
+	.ascii	"h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`4\001-\016"
+	.string	"\206\032^D\020\221\223\016\244\254\344\326\250"
+	.string	"\364\232}\266\303\245\231\213\b\321\232yUJ\370\266:\204e\017\256\243\336~\233\326\347"
+	.string	"\356\314"
+	.string	"\302Q\034\360\005"
+	.string	"\200\"\344\021\005\004\235\333n"
+	.string	"\016\031\262EK\310\336[\312\224\002J"
+	.string	"I"
+	.string	"K"
+	.string	"N=\2564\317\262!\245\303!\245\304\b\\@<|\017\020\017\367\303\267\277\325\315\177\371\033\001\242\206hZ\370\273\215\022\215h\252|\237\202\231\331\3621A\257"
+	.string	"\215\025\357\256\243\031R\265\026H)\255\242\231\341\206\267\315\3006\210\375\226\020\252\337S\357\271_7\036&\030 2\244\304\260\322!U\320\205\b?\346(\223\2430\214\321\375\304\273\222\303xaX\224\330\034\023\233\363\315\346\250\375\323Ml\347N\016@JR\211\026Rr\b|\340:4w\331\366]n\332\034p_\ne\005\244+\357\276}\367g*\321\244\324\034\345\007W1rI\031J\340\247\250\220\371!$\354Q70o\2208}t\265;^\214:\254O\242\256\006\025\01713B\232\303\346@\272,\366\237\\\222\035\325WT[P\035\241:\231G\035\322\311<\030\211&B\301\2439\300 x\032\214`!\032\t\326\031\340,\202\210\206M\3102\r\343p\237?\271$\257J\346\264\326\206\203\314\212v~\355\310\366\265\177\371/\210\\T\237\005\275\270\326\336\343NE\270q\255\016\245f\273g\342\333\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\rOBt\306D\034`\345\210W\323(c$\250\314A\273\221\224\200"
+	.ascii	"4\307\243\271\024\024"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\315\f"
+	.string	"\266\231YB\020s\223\016\377v\034`F\274\001\036\376\277\027\325C)h\243\242{ \337\233!\214\216\225\277c\323\324\020\272\313#,\340\224\214\002&\001"
+	.string	""
+	.string	"\"\bCD)\237oWM\271\345`\306!d\357-eJ\001H"
+	.string	"C"
+	.string	"G"
+	.string	"W\361\025\232=z\035\t\356*%R\\\370\330]+\344\006\342\341{\201x\250#\256\375ij>\312\037\204\225\036\036\316\303\365E\260\301\241\030\300m/AL\214\207\236\037\256\2239\211\354\256\323\303u\270\341mK\260\315\300\376&\216\357\376\367\322\372\322\251\351S\001n\344h"
+	.string	"\263\313\241\004dq@\032,\376\313E'o\341i\007L\313\356V'vux[\263+\333O\373.g\241\275\333\234\300.\250e\306n\347\300\013\250Cw\224m\007\367\244\206t\024\305Q\257\017=Wx\244\004\271\310%\207\201Q\273\235\007\376\013\023\f\276\211C_\023\017\243^t\005\034)\205\013'KJ\252\361\021\241\336\304\247 >\260\274\350\350\344\017\273\333RU\354\277U\220\375\322\023\314\330\225\036\311`\227\245\311HL\256\214\202e\341\232Pb\215d\032+s\300\330\005\222\314\312\200a\231Uu\234+\310\032F1:\351C\007\020b$#3W\375\330V\265\bG\267\227\212\340\036\305IO\332pb\313\222\005\344\325\276*\304\022"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222kx\327&JS\361\202\nj\257B\203\023\221T\203Q\351\270\322*"
+	.ascii	"("
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`$\001\r\016"
+	.string	"fZ^C"
+	.string	"\223\223\016\337\3760\006\257\356\367o\224\331\275\330\346\"B!\220qw\331<\2270&:\210\233\310}\320m\037\211\340\030\037uN\205\033\001UU\275\352\033\025\004\343\376\317(\215\376\353n}K6\331R\246\024K"
+	.string	"J"
+	.string	"K"
+	.string	">A\017E\367\322\313\312\227\263\273\227\310\013\304W\360\004\342+=\361\355Ps\363/s\350\222B\007\327\251\034>`\301\341:\021W\b\001G\307B@\027\202\bnf\374{\216:Q\246\025aw\235\\\027\342\256n[\202\355\005\366K\001\020\246\365\336\237\035"
+	.string	"9;\030\324\354\202H\001Y\233\312F\213Os\023\312a\330\352Q\343\262\273\177\361\357\3443\326\231\034'\266\007\305\366|\263=i?\346.\266{)\037\260K\202\251\261\3535\260\202\316+{\035\333~\213\303l\016\352\177\025\260x\256R\021\221\252X\025\262\370X\tr\223-\\FIgW\344\300\217\301!\363Ud\320\233\236\240C\275\304\2002\245\250\033#\023\352\224\230JbD\013\r\017Q\376\260\275Pj\311>\\%\3311m\305t\214\351\252J\007\031\226\036\371d\330e\242\221l\3004\n\327\005lB\3115\242\231\\\037\003\3160\220h\227\206,\323.\217\007:\\%\271\303\351F\243\376{H\211\023\215\374\334\322\221mK/\363\177\340pl@\032\202\225\036\270O1\352Q\036V\2042\345"
+	.string	"\t\003\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\314\226\220u\306D\034"
+	.ascii	"`\345\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`$\001\345\r"
+	.string	"f\232]B"
+	.string	"\223\223\016\337g/\211\201\035\376\347\221\035\223i\0164Y\036[k\016o\202H\371\321\005\314|;\200\325~$\202c|\3249\025n\004TU\365\252oT\020\214\373?\2434\372\257\023:\226\354\275\245L)J"
+	.string	"I"
+	.string	"K"
+	.ascii	">\275\356\004\367\021I\245\344cw"
+	.string	"\257\220\027\210\207\357\004\342\241\232\370\366\247\271\371\217\371{i1\201\270\224\277\007,=@\\\210\353\203p\203K!\200\363<\00451^z\206\270Of\025aw\235 n\345\206\267-\301\366\002\373\243\357\245\365\335\237\033k\005\007\203\324.\210\024\220\245\2014\\\374\231\233N\356\302\325\216\032o\361\222\311e\25429^v\327\304\266Nl\353\233m\245}\322Yl\357P>`W\0043c\267k`\005\233Cw\033\333\376\212\303l\016\352\227*`\361 \250!\037M\261\352c\341\241\022\344&[8\f\222\315\356\307\201\377\202C\346\267d\320\233\236\200C\251 u2\245(\033\241\022j\224\230:B\204\313\214\216O\376\260;O\352\310\376[\025\3311]\305t\214i\b\323\001\031\226\026\341d\330U\242\215l\3004\n\327\005l\002\311%\242\225\\\034\003\3160\214h\227\206,\323.\253\353\374\255\212\334\341T\243Q_:"
+	.string	"\022'\031\311y\245!\333\225>\346\377\020\342h:\352yP\017\334\247\030\365(\017(<\231r\200|\001\032"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\330<\t\3219~\345\210W"
+	.ascii	"\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \372\235\006"
+	.string	"\362\f.3`M\222\016@\203\200\234|YY\201\340\223`\264#\n\004\327\212\226\031\241M\367<B\235\237\003\226\255 \b\250\024\342?\274#\303\b\034\203\265\2555Bd\n\217bg0\217r\033\250\221\240`\203{\240\030\034\\\006n\034\206\340\007\241\201.\342=\350\246XQKb\215\363\221\303\232\306\027\312\326\371\306\266m*9I@\311\304XQI\223\210\304\343\357_\375\3643\366\005iH\3258\321\200\314\216g$3*|pit\274\374\367\243\236j\013\212\035\227\364\021\261\370\244dFg\320\001\251\021T\001\251Q\343\250Uf]\200\213\242\314\262\220\231\263\213+\243\267\376\005?\302\277\021\t"
+	.ascii	"2\003\202a\243\302n\025\216k\270\210\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.13.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`j\001\025\017"
+	.string	"f\335fE\360\260(\035;\005\b\2746\002\223\265\230\221\214\254\0247\266\204\351Nn\030:\351\036o\365\006U\217b\256\333/\305\211\026\b\355\320\237\275z\201\r<C\302\0052\356\372\350j1f\256\324\025l\271\344\223\275\245L)T"
+	.string	"M"
+	.string	"U"
+	.string	"\257\225\024\273\237\002'\340\036\375\235\300\366\310}\300\366h\333\013\032\230|\372\247\302:\f\306\212\246\263\373u\372\341\247C\315\223\177\341\320BK\316IK\303\0252\b\201\341D\200V\n\202hr@<\346\211\322Rez>v\327y\322\312p\307\333v`\233\303>N\372\362\307\223\346\266\264\347\261?:\rcZc:c\372"
+	.string	"\ftpq\200\305P\233oY\265\032\313\"\252h\261}_\3464\222\177F\240B\342\313>+\371\347\003):\256\227\335\005\225\330\240\307\264M6\310v\246\375\227\303\230\0363\371\306n\020\216\002\204\323\323^8t\023\"\017\277\204\210\004nw\317\362\350\227\266\307\253\210\024\235\317<:\315\004nW\345\341\223\030\t\361Y\274\355\321\243\237=WX..\230\030*k\352\301E\346Fm\262E}\3147d#d2Z\334\250\222\206\375\245Ra\366\341\356\256\003\336(\035\352\360F]\211$\2520\"E\350(\214@B\272\020\251\324u\024\260'\"\"u#\236G\352@\037\352p\365e\001\264\235U\215~\036\270\300\231\251I\377\264AE\261\r\325\037(MA\205\2116\325\217~\265\"\365\252\2523V\033RY3\247\311\201\252\245lfvh\016\033"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\320\004"
+	.ascii	"\366v\201\264V\264\265\025\206\247\311\262\214\005\320\020\351"
+	.ascii	"\212fX\214\013\325\006\214A\240l\001\272C\235&\224\375\346\225"
+	.ascii	"=R\225Cs\251="
+	.text
+	.section	.gnu.lto_IOWrite.14.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\304\001\255\020"
+	.string	"\366\237oE\360\360$\035\212\357\037+\371&\221\266-\356\214\317\301\366O\336](\323\303@\035\346L\365\231^\355\030\241\320\027\247\036\262\022\355\211\301\227\252\213l\"\033\207\247\273>\346s\252Z!/}\213\247Y\322\366\336R\246\024["
+	.string	"W"
+	.string	"_"
+	.ascii	"%\204v\273\005\026\311\016\335\235@<\314. \036ze\333x\267\263"
+	.ascii	"\217\325hX\221cw7\325\371\352\021>\315\225\037\363\210j}8\364"
+	.ascii	"\360\367\321\232y\007vWkeH}\rTl\200\361\321b=\255\005\016\024"
+	.ascii	"\377y\332\264h2O&\273\353\254iq\270O\267}b[\201\235#\001\335"
+	.ascii	"\357qJg\177\375Q\323/\246U\323\251\351\0030\300\343\002\241c"
+	.ascii	"\243G\335\33641\355\f(\343\204\355\373,\036k9\220\013 \265\330"
+	.ascii	"Z\320a.\0072\f\261\343\3529\264]l\35505\333\2326\003\007\253"
+	.ascii	"w/!W*\352)J\360\264\337s\237\325_0\007\331\305\t\251\217\006"
+	.ascii	"\r\023+\233\036\324\234\374P\221\210\024Oq^\242\207\346\216\240"
+	.ascii	"\032(\275H\007\"\326Ql\307c\226\360\027\\\266;S\342\273PQ\360"
+	.ascii	"M\250\304C\224>\366$q\203\344\362y\311d\223\216\340\201%\251"
+	.ascii	"ab\324\377\034\344\307(F\311(i&\227\354\216\225\232c\377\355"
+	.ascii	"\356Zq\354,\215z\334\204Lqi\024\222\024\267\261\250R0p\252\b"
+	.ascii	"\333\nw\242\262\241\250X6\222\020\247*\244\250\266\013\251\224"
+	.ascii	"j\323:\231\2775\221QV\324\034\347\013p\023EmIG\376\324\306V\265"
+	.ascii	"\037|\bB\266\273%\276\320\312\311\200\235\335\265\020\017SG\315"
+	.ascii	"\215TE\020\0043\312c\244dz\030\217\313\347\365\364\032# `\002"
+	.ascii	"!r\354\001r\250\261\020h\204\020~d\227U\233X\017Gho\260\326y"
+	.ascii	"\327\210\007\253\332\213\0208Hr\263\rJf<\033\333\302\002\033"
+	.ascii	"\"+\236\272\330qh\300\026\216(\033\304\020\215\323:\274\211\307"
+	.ascii	"\364\rX\253\200\021\244\323\005i\357J]\257U{"
+	.text
+	.section	.gnu.lto_IOHi.15.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"\266XXC"
+	.string	"\2216\035\037VH\360\223\201\006U\263\230\f\325E\357\r\031.7v\211#8Q\242\004&\235q\226\3473\212\200\033X\234\326\001\214}PUU5\336\020`\213"
+	.string	"R\356\377\31617\314\253\331\335M\312\224\002D"
+	.string	"C"
+	.string	"E"
+	.string	"\366^ \036V\037\020\017\275\3313\356\221\366.!,|7v\367R\017\337Nin>\200\256\302)\rW*A\211\0130\001:\216\262^l\2208\313\023C7\312\324x\354\256\223\244\313p\303\333^`\373\200}\224\360\245_\251\364+\001'0\024\234vKN9\366\005t!\302o\371\027r\317)\023b\037\305M\"\367\2541\2111\261\273\326\241-b[\207i\331~\332?\361\225\355\245\221ovSH-v=\004\346T\207\001+\260\250\377\276\251\261\341&;\370\013H\265;\362\370*(d>\210C?B<\204z\323\363C\211\f\207\225\222(O\332aD\313\214z$\252\236\240\304H13J\034\266\307\245\252\330\247vw\255)vLG\230\016\031\226\376t2\354\ni\240\t\230\306\340z\200}\200\\\037-tu\f8\203"
+	.string	"\322.\tY\246]\226'\272\207H9JU\324\3768\213O\265\273\036\037F\003\021 \355n(\036\246\016\022\032P\257g9\307$\206\223\341\262\343s\203\007\031"
+	.string	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340*F5\337S\255"
+	.ascii	"\201GCH\021d`\205\024\256\201J\b\rT(B\321\320\031dP\321\232\325"
+	.ascii	"\025q-?%\336\224B\355\001"
+	.text
+	.section	.gnu.lto_IOLo.16.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"v\330WC"
+	.string	"\2216\035;uB\244<\243\033\b\026\267\344\240\023f\336\220\341r\233C\034\301\301`\302rs\350\310\363\031E\300\r,N\353"
+	.string	"\306>\250\252\252\032\357\001\260E"
+	.string	")\367\177\347\230\033\016\026\261\273\233\224)\005D"
+	.string	"B"
+	.string	"E"
+	.string	"\336\t\304\303\352\002\342\2417[\306\275\321\236\345\245\302gcw/\365\360\355\224\346\346wt\024Ne\270R\bHXp\001\320q\224\325Rc\304U\236\027:Qf\306cw\235$\035\206\033\336\266\002\333\006\354s\b\244_\251\364\253"
+	.string	"-^$8\355\226\234p\254\013\310\"\204\277\362/\344\236\023&\304\376\211\227D\3569\303\231J\354\256uh\213\330\326aZ\266\237\366M<e;i\344\232\335\223\321\212]\357\2007\325\241\003W\201E\375w\r\215\r/\271\301[@\252]Q\307O1!\363A@\210\207P_z~(\2011I!\205\362\244\035D\254\304\250G\242\252\006\023\030(bDy\303\366\270T\024\373\324\356\256\365\304\216\351\b\323\360\001\031\226\366p2\354\002i\037\t\230\266\340r\200}\200\\\036\rtq\n8{\360\321\256\bY\246]\226\027\272GH9JQ\324\376\370\213\247\332\335\216\357\242}\006\214v\027\024\017\323D2\003\352\365*\337p&.\006K\216\317\f\002\032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOToggle.17.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\f\002-\022"
+	.string	"\346\241wH\360\320&\035\243\251\356\261\3747\2255\323\035x\r\266\371\207-\362\276Fa\203A\007%n\205\322\245c\037\354*\3423p\031G4\302\027\355\023\374\r<\003\317\213\r\023BL\263\207S\345I\251T\204Z#\204l\"wJ\001a"
+	.string	"]"
+	.string	"e"
+	.ascii	"\177\265\274c\267\205\263bWl`\005\335\247\305\023\330>\273\013"
+	.ascii	"\330>\235\262a\\\274\331\2170T=6v\367S\233\247\276MMe\312w"
+	.string	"\371fZy\370\354p\215c\205A\363\330]o\005#Us`\"\303\017\307*\324<Y\r\022\217]\312\254b\244\344Bv\327R\303\212\303\315\335\266\210\355\017[\236\004\246\322&\335\035\366\372\347a\267Ni9\245\017 A\016\353\203M\f-\022w&i\266.\246\320\210\303~\373>\212\313T\316\343\003\255\031KG\305~\317}l\317+\347q\001\243O{\305\366>\345c\366l\361;\251\303X:\227\r\3358\316d\354\212\f>\275\240\373\364\320.\355\353\334\225\n\241L\272\020\013\210\037Da\244\333\335\223\355\363\022\2475c\271^2\223\034h\202I/\313a\271^\235r\b\210\220\302\242\021\351>>\375\247\244\333\205\001\361U\244\230\3708\240\336\347R\304\214\021\313\365z\221I\032\"\207\347H\265\306-\333\324\307\336\261\203\3442\203\350\bF\336\260\305Pj\215}mw\327\332\2629\351%(\"&\032x\222\036\371"
+	.string	"O\037\n\212\344\302\t%\341\253p\0221\371FP(\337\207\001\203\026HP_\n\b\242>O|\271\266\332r\310\213\206\233\326\270t\243\032\265\222r\343L\005\244\234\252\312\330\2526\204\263\030p3i\f\235\240\231\001\356\241\215\323\222>H1\306\314\302\007\265"
+	.ascii	"QBc\331\244F\210\275\340\364*U\207T4\001) P\002Q\006\3176b\350"
+	.ascii	"\333c\374|\311L\332N\336\3408\231\372X1o%\303\240kC\242\370+"
+	.ascii	"\022\243\006tj\364\303x\225\315&\301\030)mP\231\361j\\k\273N"
+	.ascii	"4\205\322N\\1c\r\243\206\201#\003\216\204\003\204\0064T\360\341"
+	.ascii	"O\242\334\030\303+\362(\025\300K\212t\001\355]\252\353\265s\017"
+	.text
+	.section	.gnu.lto_IOInit.18.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"=\f"
+	.string	"\326\325QF\020\255(\0353(\203\364r\022\227\0012\023\322\017\255\335\260\346k\227f\272\374\\\307\270b\205\324>\355\372Glk\036Ec\211F\207<\216\275"
+	.string	""
+	.string	"\f\222Z@\210\352*_p\242\2008\354\344\342\021\022\311\336{\247\024="
+	.string	"="
+	.string	"@"
+	.string	"\257\016\355\021\037W\373\030\253\006Vbw\271\271\340\341\351\224\241\177!\322\234\026\370\244%\020"
+	.string	"d\310\020Ot\023#\361\340\260K\001\"J\312\n\317\356Z\006\020\t\334\365\266Olw\354\253\004\037*\007\226\355olSi\223t\302\277F\236\273\bD\214\310\361\024\302\273H\266\330M\240!d{\375\240\227\366%|B\370V\351\032\273)\006\033vG\021\203l\257\036\337\241\275n\347\320\002\027fD\030\253\335}\203\027\355\265\246:\2308`\222\263\251\300\301K6]\322\3444\240\nQA\206\222'\354\361$\247\312>\335\335\365L\331\177\375\332]?}\353\227\333F\n\020(\026v\007\314Pl2\035(\344U\260\013\305|\365\363\244?\234\317\343D`\007\343\201 .\344\245\254p\037P\304q<\374\261t \347\362} \267\031M\367\230\346\211j\323\376\216a\344!\002\235v\313c\244mwM\374\031"
+	.string	"2\003\302\260\311\302\326\021\210`{\301\320\362Q\023"
+	.ascii	"\3035\225\3613A\301\301\243&\2400\222\260l\032\327\200\3720\030"
+	.ascii	"\346\222\020,\b\237\251QpY\232\032-\356\362S\355M\321\324\036"
+	.text
+	.section	.gnu.lto_IORelease.19.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\235\t"
+	.string	"\246\321A90\221\322\001 `1\224\370\22288\315\224\016\211\371\361\326\363\347\356\214\223\"*9\327\357\261\331\024\2571\020\023b\215\207\201\301\244s\024^=D\016]X=-#{\357\235R0"
+	.string	"1"
+	.string	"1"
+	.string	"\273[%\311\277O\031??"
+	.string	"\314\370\004\271\234\n(\033/\003 jzb\263\223\257<v\200\251\030\001B\273\353\310\001~\334\364\266\031l#\330\236\0052\273\036\265\234\235\2411-\217\355G\373)W\371\3762\235`We\002\263\033&\370\240s\352\360\005\333i\347\237\355\324\237m\363\220\265\217\3054\\h\001\254\335}\311\251\217\261\235RU\r\355\346\024kR\304\325\"\2236mQ\206\214\264`\262T\304\261CT\224+\373sw\327Re\377\365G\372q\3214\004\035\027-\002u\\%y\243\n\316{\250\021\234\003D\025y\244\n2p'1\362\352D\327y\325\023\236\036:I\324\224\253\322fS\034V\352\354\356\202\317ra!\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\375\n"
+	.string	"\246\224LC \215(\035\324 \022\220@\367!\260z\003\277\355\323\273n\202\302\200\372\313G0\221S\310Dk\301\334\016\266\365T\001e\016\332\0314\355\n#v\217i\260\"\r\355\232\220\032\253\333\232+R\202\310\336r\247\0249"
+	.string	"9"
+	.string	"9"
+	.string	"\032\346\033\330e\374\005\273T\b\367\036\025z>\201G\222\017\035F_\351\032A.\030\360\220\361\205\242\205\205\302\302S\207\244O\004\241\205fw\rG_\202[\336\266\210m\017\373\230\255\022##v\021\274V,\t\331\242`\373\266?\266\3056\204\366Q\337\360\371\364\\c\327\304\002\261;?\334\221]zf\266\375\f\327\360\261\027g\204\017CB\210\002\253\024\2733_\255d\273\242\020_5 @\266\273\237p\351\013\300.\243\312\322\t\f(\020|\251\203\n*\227\332\203AU\360\300\004\007\227\b\252\260g\b\352\311~\\59~\376\320\320\227\227\334\006\275\311p\233\326\3518"
+	.string	"\266\316DC\331JN\264M\327\3212\034\346R8\235\246\302q\235f\231\240\307U\223\177bp@\243>\365\213\006\013D@\337\303\256$\265\006\244\241\250'w\002\020"
+	.string	"A\204n\211\030U\004\370\205\315\326\312\036\350:\272\327\211%S\263\222\0139\320\030\036M\331\001M"
+	.ascii	"R\002JU\003\315\245\240"
+	.text
+	.section	.gnu.lto_IOIsFreeOrPreinit.21.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\f"
+	.string	"\026\331XB q\223\016\214\261\327\256\243\236\222\001\207\343\351\003G\306\306f\036\0211\311\0377H\n\004\215\362{\006\3254\326;b\307(*\224\262\212\020\001X\016\001\205\032k"
+	.string	"ZF\302E\3404\032\b\331{K\231RG"
+	.string	"B"
+	.string	"G"
+	.string	"\326\003\300?\333F\240`c\316\243\210\224\217\260\361iA\355FLC\234s\247\311\361-\334\275\320i3\275"
+	.string	"\205\256.\001\212\0130>@\233\273\\\304\234x\351\211\002\362dV!\273\353\314"
+	.string	"\332p\277\333f`\333\200}-ix\322\377\234\326\364\255{\210(\034\016L\273)\251\036[\343\275\224\260}\177\345%\223GW3v\240v\3672\261\257o\354\313v\246}\225\253\330\234tr"
+	.string	"\273\"\025\031\273\361\200\013X\177\216\027"
+	.string	"\377\002\225^\277\342\004N1,&\227\227-SNG%go1\301\332\365,\360[J4>\211?\237\002\374\203\372B\247\024\244N\246\364\203\t\0260\352\023\370\224\003\210\034,0\236\344a\307-ud\337\355\356ZE\266KW.Y&-\002\222e0\2156R!\243A\300\"d\036\220`\"\232\006\003\031\340L\302\210\206\225d\231\206]\261s\025\371\243\016\032\024\352Ko\200\201\306'F\336\345\225\242\330VuHG7\247^U\365\306'\264\222\352t|N\002\003\022"
+	.ascii	"+\013\370f\230B\363\304\314\246\345`\326\341\035\345\312\036"
+	.ascii	"\350:\272\227\213%t\263R\\\360\231k\027\324&\257\253\222\305"
+	.ascii	"\254C\225:E\255\332\003"
+	.text
+	.section	.gnu.lto_IOInitGlobal.25.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"5\n"
+	.string	"\306\022D9P\215\322\001\204:\307(\3261\240\005\261\025=fA\2655!\310\3003\275\222\314]x3\333d0\260)\f\217\254\257\253\252zWTM\207?\\W\"\253\217|\262\367\336)\0052"
+	.string	"3"
+	.string	"2"
+	.string	"\276\205\243z\001\314\003\fE\257\024\263\273"
+	.string	"!\004\305\310RH\222\224u\t^\234>?\376\340\025\003\303\323\245\205\263\273\226`8qg\267\315\331\326\330\247\001\325\317\270\306w1\243\211$\264V\212Iew\324\274\332@{\305\\ {\245\017\310^\177\361g\243|\254\330\177\224\":^\273\273M\212\317t~\257t\312/\263\224\311>[+\221\303\344A\302\350\356.\375\234){$I\271\273\"O\224}\361~%"
+	.string	"!q(\3315\305V\326UE,.\336>\353+\177\364\345\001!\257\373Pw6\035\267\201<O\003\347)l\f\\\302\302\326\361@\333f\300\335\307\343m\241\256\363\266\3138\372D\251\256\215\204\270F\223\344:SF8\231\177&\253\030\362\033\177\025"
+	.string	"2\003\3769\006\324\201\030QX\037C\354&8\270\222i/\314b`\256\\\356\351F\202\320'\270U^\204"
+	.ascii	"r\203[e\247e?G\2119\274s\315'"
+	.text
+	.section	.gnu.lto_IOGetByTag.26.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\242\f.4Pm\222\016\244\221\"\032\212\001%\262\023\003\240\204\261\321\303\006\370\334\"\007\273;n\324b\251\360\236\354\237\231\231\346N\027iE\314\272!5\236\035mc\023\231\002\r\233\017\316\321XU\363\270ND\345\030\332C\265qh\034\347i\232\314\026D\307\265\217e\271\206y\331\213bH\361/\304p\343\013\220\250\361%\265\305\256\200\224T$P2/ZX2e:\371\370A\217\371\221}\202\002\250\244\21113#\304$\363!lp\351\364_\221\216\200\2762\257c\324\022\217\n\222R\346k\277\022P\235.\035\240:!G\257\262\353\n\210Be\001\013\2319\263\020\215:\366/\370\017~\214\b"
+	.ascii	"2\003\202a\243\302v\025\216k\270\005\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_IOTraversePins.27.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \363\205\006"
+	.string	"\262\314-1pO\032\003d\003\001\033;\373\244\203\004\026\234\2129L7\210b-\"\342\372\207\210\"\311\253\3306\372\372\353_\320\236\326\364\241\234\211\366\237lR\246\024q\343\220\211p\245&h=M\254(\254\b\3612\326\203\304\243\242\346M\006\205\023U|\033\b\343\223\346\335\256\"\\4\214vrX\353h\r\360\377mW\353\217\315\332A\bK\205\313\257\021\003\363\025\227\002\"\2655k-\342\021\351\217\205\007\376K\005\345\237\fU\210\354:]"
+	.string	"\331E&\200\354*\333\026\317\217\373\304$\243\344\345\377k\036\222I3Y\233\304\002\035\017\307,\240\341\177Y\307\263\3416\267Mh\273\320\226#\b"
+	.string	"2\003&j\006.\234\202y\227"
+	.ascii	"\232\325\224p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`[\001\365\005"
+	.string	"\004\bW\002"
+	.string	""
+	.string	""
+	.string	"\002\003\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\004\177\026\005\177\027\006\177\030\007\177\031\b\177\032\t\177\033\n\177\034\013\177\035\f\177\036\r\177\037\016\177 \017\177!\020\177\"\021\177#\022\177$\023\177%\024\177&\025\177'\031\177(\201\200\200\200\002\032\177)\033\177*\005\030+\201\204\001"
+	.string	""
+	.string	""
+	.string	"\001\034\177,\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006\027\241\213\331\375\003\001\204\001\003\007\b"
+	.string	"\033"
+	.ascii	"\240\b\256]c0\004!\032\213s\025\320c|}\003 \034|\003|\003|\003"
+	.ascii	"|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003"
+	.ascii	"|\003|\003\374h\3339\006"
+	.text
+	.section	.gnu.lto_.refs.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c9cc724c91ce1ddd,"e",@progbits
+	.string	"(\265/\375`\270\024\325\\"
+	.string	"\352\227|!R@\220J\032\016\333\002\201\031\020\250l\007\302\365\246\234\374\260\350\300\034\231\f9\234"
+	.ascii	"\023B^\361\371\204\271\324\303%J\2555\001\325\237c'\252\t\224"
+	.ascii	"\257\345\3153\027j\357\266EkO\237C\273\345\022|\276\017\2360"
+	.ascii	"\245^\374\315\017\365\031\261$\335V\312\024\252\001\005\002\""
+	.ascii	"\002_(\025h\205v\274\036v\233E'M\251\004\t"
+	.string	"\247Ga\261<\355j\366\344\216=\270@9}\t5\224\251\3075J\2608\375\267\354_\032\326\271Wr\312\247f\207u\257A>m\340~4\341t\311\206\204o\232\234q\372\020\324\357\223(lT\266\312Z\331\261}.\364_)+\366t\355\036\353\356\257sE\263M\246,\230O\022\250\223C\334\264\272\327;\360\037}\241\033\266`\003\244\320mE\265\203\366\244\006\307\255{\03514b\304\b\025\355k\214\251\223\036\002u{\205v@%\324\037\251\013e\273\366Y\264__'\373\3449\311\265\237\335\353O\216\030\034\252\3028}\221\372\337\353?`\272\304y\352\267h\367\263E\273\263\032b\205vit\205v_Wh\247\256\207\335\371g\254\364g \337\237}\2301W@\305\371\356g\033\377\331\376\237y\316\317F\350\027\215\377c'F\020:\320\317\"\374\247\222\364\016?\007\247\\\t\372\371\307\001\221\357>?/}\200"
+	.string	"\321{~f!\302\202\357\374LA\322\177\017\256\363s\004\377\315\274\213\003\377\321\b\361~V \367\263\322\277\034\374\373\342_\337\277\030\374\333\342\337\025\377\246\370\267\202\177Q\374{\342_\023\377>\360\257\321\277\n\374K\364\357\001\377\032\360\257\210\177\t\370\027\304\277\001\374+\364o\320\3776\377\277\376\223\375O\363\257\372o\356\177\231\377Y\376\335\377q\377\343\374\317\341\377\233\377n\377\335\374g\363\377\312\3775\377q\370\257\346\177\331\377\005\376o\371\377!...\356O\255\374\314\364\3730\005\306\356\225\t\244\f;\032W\371\264b*\237MfP'\333\330\317c\0205\331d*\323\232L \345\363\310T&\255\230AB\270\262\2008]u\205m\020e\262u@Q\035\227@Q\345\332\3541\335\033v\243\227\005tS5\227c\216>\326\n2\252\0039vl\006"
+	.ascii	"\205\274jv2\252\334jvo!e4\324\003\3065\332Y\0335\n\241\352\247"
+	.ascii	"\033\335\002@u\033\267\243\335m\354n\336\222j\355n\001H\251\005"
+	.ascii	"\005\325-5\004\325TF\262\033\335\034V\306\nS\371\274j\036\221"
+	.ascii	"\201=\265\032\307j\\\255\036c\265T\237F(\375\324\335\213\203"
+	.ascii	"\252\305\214R\303)+s\300\260l%\331\030\307\371\206\016\324\206"
+	.ascii	"\032\2608\345\033g\343\351\036`\007zE\304\006\247g\263o98\234"
+	.ascii	"\342\254\230\221i\017.C\220\210Q\327\03678\236D9\345\346\215"
+	.ascii	"c\343\271\027\216'\311\235v\037wE\370\354\212\320\231\0359z\355"
+	.ascii	"\322oT\375>\177\303\3069[Z$\255G\223-\353\272c\345\207\224\025"
+	.ascii	"\326]{J\273z\003\342g\355\001%\304\315\r\217\227\247\2610N\323"
+	.ascii	"\f\351\314\306\214\204\265\301\242\363BcrdS\324\363F\f\222k\r"
+	.ascii	"Q\262l\212\023\0075<&.`59M\263&y\250\030\225T\225\251l\033\335"
+	.ascii	"0\003 \225-\260Hi\373\033(\261l\273\266f6*%\001\22314{\303\236"
+	.ascii	"\331\266}.\333\332\360U[1\037Z\273\223\335\315\266f\253e\243"
+	.ascii	"a*\320\246\264u\257\313\266[\326\213\317q"
+	.string	"\355\245\004b9\320~X\230Z\342\245\223\356\230%\263O\020[\346\r\224x\316\330\325\316\036\270\031\340\340\034Q\277 v\033\267 v_,u\207\026H\03009h\234\252\034K\266\363\346\251\365\203\323\347~\371\327\356^\035JlliA\335\264\345\262O\242\355\362=[\264\353\216k\257\\\344M\212\027\247_\246\372%\332\345\342\342\226h\027+,\215\220I\356\326\324\030\021RDL\214\247\254\022\232#\312\351\266\263\221\346D\214S\236\002f\013\211\330\217\260\260,3K'_\320<=\237\f\326\241\233bYhm:*3a\314\2573\330jI`J\323Ij\354\352\"#%\355\002}C\342\306\351\344\225L\222('\027\017\021\2623!O\316kN\234\254\243\027\247\354d\337t\302\370\360\322\234r\223\325\222\033\343\003J\0343\272\2536g\240mL\230\260\351\210\301Q;[\343\342\342\033\352Z\025\255\237#G\200\374"
+	.string	"\263d\t\337X\251\316\255!\211rr\355\270\364\025\024.J\224\360\226\032\305)\312\351\246e\311[\224\030\316[?L\347q\213S\206\341\007\316Y\022#\334<N*\224\3750;r\204\223\264\350\035r&\312\351\306\273\001\206\034b\220\234\223p\3538\205\211\002\225\253\222\225\305E\270\033\354k\254\215\247\320\256dy\341\\\004,W\226EL\013P\260\260\234\360\300\322r`%\0312d\206=\243\\\303\243\352\352\212\253Z\030\263tL8\036W8}nG\220 S;H30\037q\200"
+	.ascii	"\341\252\026@\215T\323\241\325#e+G\023\265\251)\256\312\351e"
+	.ascii	"\267\324\004Wp\214\346\345-\t\325\271\352f\273\006\007\016\r"
+	.ascii	"\213\017\037\314\002\230\027\232\234\216$]Z\352\314\202\227\237"
+	.ascii	"4e\274\034\241QQ\314\243C7\273\265xQ\302\220ik)\251\"]\032\036"
+	.ascii	"l\234V8\363\3300;]dL\032\242\250g'\316q~\372\0233Uc\267q\355"
+	.ascii	"\035;\257\264(\247[KQ\025\371p\221\251\202"
+	.string	"\342\224\231\274\324E\337Xa\262\344\035PHrp\246\341\261\231Am\007\353X\033th)T!r\306R\377\335\365q\331\335*\350\326^\"yv\377~u\273E\177\317\346\266\200\356\003\334\272\207p\255Qc\200\036\2478\375\037\242\317\325m\f\352\265\227\312\247\225Q\371\005\206\031\264v\220\017\375\024\322\312\325\212\2316\233{\355\355\244\025s\004\345\332\\*\327\246\021\250\223\315%\f\2112\212C!\017\004% SZl\022\016\227t'0-\375\204\301\"S\220\306\007\277_O\323\256I\030t\341\023C)\311\204\024LJ\037\f\231X\360\024\203\302 \220\350\202\350\003\002\211+\232z\276^P\021\310\302\327\323\0016)\001\231r\212Aa\217)F\214a\222\257\247\0163\360\365\322`\013_/\005\026\203D\016|=\036\f% \222\257\267\003\n\203\031\360\004\t\203A5`\364\204\301\236\016/~\275\244\016.\370\371z"
+	.string	"\324\200\321+\022\207.|\204A\027?_\217\367%\022CK@\244\237\257\267\373R\220\b\024\002c\250\177\300\304\002&N\324\340\375\004\n\006P0\260\373\t\024GG(L\034\2517q\224+\376\210E\027KB\032+\200J\304$_\317C\361\027C)i\030\3441\r\207)~\272\342\317\327K\213\227A\202i\206\b\301\037\210\342\357\004\257\006\020\2060\250k\372-\001\221\206A\33608#FZ\374\2318\022\006g\344\200?\037p\211Hc\330\004$\376\020\201\302\022\206:\020\200*\2003LH\372\371z.X\360\\\006\211\f\222z/\214\212\300\030D\245b\210\017g"
+	.ascii	"\211F\305\341\220h\264\203\204\224\"\207\244\242\227CR\341\313"
+	.ascii	"\025\177\r8P\024\006i\250?:\262 \304\006\032\260P\227H\f\203"
+	.ascii	"FMD \tA\"\f#aPI\004\243%b\223\021\211\017HH/R\244_sNZoj\302|"
+	.ascii	")\262\021C\205\323\237\235\275\234\361\2274\255\033\311"
+	.ascii	"\300\212\034\323J\252\242\236(nno\321\363\027\263T\205\346\263"
+	.ascii	"\213\234\300\332 9e.\347.\177\016oMmK\227\232\312[\316iSQf\266"
+	.ascii	"\242hD\322\272\250AS\237\216\251?\233=\331\214\263\024\255m\334"
+	.ascii	"\035\201[J)\320BMs\f\247\347,_7<\315\017\273)0Nb\340\364\350"
+	.ascii	"\350\214\345\036vK\251\265\177\366\t\034(Y\276\310\310\270\f"
+	.ascii	"\r\225('\227\216\fg\3206\276r.\323\341\262d\n\231\202\216\013"
+	.ascii	"J1\343\022*T\030\212\346\005\255\234U\223\027\244p\2253t\337"
+	.ascii	"|\002\201\264\250\261@d\2244\"\"\"\"\"I\222\244\003Q\005\204"
+	.ascii	"\030\b!\313:\022 %%\2224\n\315\310\2144)\253R\217\341\251\027"
+	.ascii	"li\3055\2043\n\022\341\n\206a\213\336Q|\325\330\236K\237\366"
+	.ascii	"\373\224\377\r\355H\017\370Y'hF\376Dbaa,\035y\274\371\r\227\323"
+	.ascii	"\025>\246\337\257\t\202(&\013p\020\262\351\357CI\301E\220\335"
+	.ascii	"%Z\211\363M\221\217u\340Q\330\326\225\374n\311GK\222U\ne\244"
+	.ascii	"\344R\262_vYw\251\364\356\261\225\201\234L\245B]*5q\207:\234"
+	.ascii	"\200\204;R\250\021V\236\353_c\307\276\241\246Q~\373\316{\365"
+	.ascii	"#\217\307gF\002\355\366\020\330\037\217\221\3774\274$\bF4\362"
+	.ascii	"\317\316\3668HN#\341x4\244\262*G\312\"P\273\2506\017\323\253"
+	.ascii	"\221\345\302b\261\277T\334)M\217\337=VK\207\025\\P\t\351\307"
+	.string	"c\352\270\314\210a<\276TiN\326\235\372\250\"\311q\241\333\347\257\016\336$\366\336F]'\024\006qeX#u\n\372\221Q:s\277\222\017\b\252\036\333\307O=t\243\353\217\377\204\222\007^\314\327Tn?\202\346\001j\035\317\271s\020\254\352\242\363\223s<\252V\230p\017\3123`\177\206TM\202]\340\334\347'\221\\\347\325\006\256v\b@HG\276\241\251 v\213\357\377)Y\214\245\221\253\253\235\211XE\022\250s\262\366Xu\027\364\247\343\207\230\336\317\237\373/Y\352\204\031\260d\316\022F\262'm\236yB9\251T\261\357!\207\0228*\211\222\276\313\323ly\265=\263\372\375\273\340B\006\304\024]\013\021\017|\340\334#\021\337L\025\375\036c\\\312\016\242&l\327\206)\367\"\213\211f\376D\317\017\353\371 R\310&\272\372n\241\023\271\037%\034\353\003\342\341\270r\374%\316q\374D\260\221\220\331"
+	.string	"\217\340\317~>\3406-\344\270F\210%I\334X\344\242\366\017p\242F\320\\\316\315]F\334\373Q\330\333a\302 \342\367y\025uj\370\253\fo\032$t\317Q$\367\236\352/\336Nb03\357e\311\033\f\025\34662\202\346r\235\f\214\244\260\336\250\221\336\371\313\217\231\005\023\004O\tF\t\"$Wbc+\237\277\035\332"
+	.string	"\265=/\364\"\006\245\013\220ik\201\227\363$\241\220<\310\257\270\340s\325:\007\375\001Y\374\341\026\373+\002\253^l\201\230~\372\301ej\273\203\267\002#\356\3167\245\251\2763\355\342?\024\305d\235\341\313\375\0313g\317\005\300\260\266\210\016\270\330'b#O{\241"
+	.ascii	"\224\221^\032n\001\377Ke\227h3\267`\223\302n\241k|0\215[\245"
+	.ascii	"\013O\006\370\332Xs<O\267M\355\247\274\340\301\225\243\003v\277"
+	.ascii	"b\304\271Y:\221\\\324\241\266S\375\001\260G\313\216/\316\337"
+	.ascii	"\316Q\235\027\354\345h\346\215\307P\246\201#\333\322\310\377"
+	.ascii	"&\333\342'\370jS\202\317\242\275,\375\266\037\364\230\004v\275"
+	.ascii	"g\021y\370qw\364\217\302\037\314\266\201+6d\372\240\276\033O"
+	.ascii	"zi.E\273\n"
+	.text
+	.section	.gnu.lto_.symtab.c9cc724c91ce1ddd,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"IOIsFreeOrPreinit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"IOTraversePins"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c9cc724c91ce1ddd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1133 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\r"
+	.string	""
+	.string	"\022"
+	.string	"\032"
+	.string	"\033"
+	.string	"\034"
+	.string	"!"
+	.string	"\""
+	.string	"$"
+	.text
+	.section	.gnu.lto_.icf.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`W\001\205\f"
+	.string	"t\022K\002"
+	.string	"$"
+	.string	"\274\205\242\255\006"
+	.string	"\001\222\252\354\340\007"
+	.string	"\002\003\317\253\250\341\002"
+	.string	"\004\307\276\344\257\003"
+	.string	"\005\232\372\246\216\007"
+	.string	"\006\007\b\t\354\301\314\336\005"
+	.string	"\n\013\367\261\321\316\005 \002"
+	.string	"\002\001"
+	.string	"\002\003\003\003\r\272\215\354\310\n\n\002\004\002\005\002\006\002\006\002\007\002\005\002\b\002\005\016\240\342\234\212\n\017\314\215\357\272\001\030\002\b\002\t\002\n\002\t\002\013\002\t\002\f\002\t\r\004\002\t\002\016\006\002\006\020\372\364\363\351\002\021\335\316\371\202\b\006\002\017\002\005\002\020\002\005\022\364\330\366\355\b\f\023\250\257\256\333\005\004\024\255\313\264\227\017\007\002\005\025\267\212\327\231\001\b\021\005\026\270\236\211\311\017\004\002\007\002\022\002\017\002\017\027\255\372\241\252\006\006\030\352\263\360\321\b\031\032\212\333\334\276\b\n\002\005\033\317\262\324\372\013\004\013\002\005\034\247\250C\004\035\350\300\306\254\005\002\036\037\342\320\203\361\t\022!\333\354\351\313\n\n\"\211\244\373\255\f\f\002\005#\305\217\201\375\006\004\017\002\005$\346\341\231\311\b\r\002\005%\310\233\200n\002\002"
+	.string	"\002\003"
+	.string	"0 \220\202\261\253n\362\234p\321Gv\t\022\332\300\304\333zA{;\370\311\0073\t`47{oA\326\204$\356\213\256N\211g\006\013\310\324\351\2708\366\326e\\\264d&\001\370\031P\032pf\313E\253\265]\207\374n\nL]^\352\022\335\315M\017,,\254"
+	.ascii	"r0\212\247\032\254\rf0\0049\232`\254\302\r\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\255\005"
+	.string	"\342\211\032\035pe\322\030Z\323\006\376\177UUU\377\b\n"
+	.string	"(Lk\360?-\202\332&dK\231R\236ck\2134\310\036s9-Z\241|\272QOrFN\310\356\303a^T@0 \020\260\376\312\245\032\347\274\336\224=\2661\316\305\t\255\t\340W.\177V\221X\304\356\007=\251\312p\027\216\260\203U\316\2525g\272o\355|\235x&! p\002bH=\020\270\240\335\246!\260\001\030\271\232\r\342\027\256j\027"
+	.ascii	"\017\232]\203f[a\317\313\340\025\tV\005\025\356\241\341\032\273"
+	.ascii	"\212\207\306\375\301\202\210\304\342\256]\224\020x\"\303\030"
+	.ascii	"\3535fq\270Q\272\274\346\206"
+	.text
+	.section	.gnu.lto_.inline.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\007\005\275\020"
+	.string	"\366\026M>0\213&\351PT\257\220)T\357\314*UF\265N\245w\223rQYgb\007\343\216K\212\376U\374\357\225e\006\234\024\324A\201\324\365\002$\363{D3\374\266U\305\267O~kd\313\235\0027"
+	.string	"?"
+	.string	":"
+	.string	"H\362 \241\303\346\211%\220\335QvU$\363\003\363\240B\310\314\004\370ozw\243GC\231\211\340\213\245\322(\324\304\260\367\245\376Af~|\377<\315\314\304\337x\022\021\rf\337\205\037LD\024*[\204df\246\364\246\354\232\326\334\t]m=\311\314\312\025\337%Aq\346R\017\005j\033\363A\316\007G\231Y]Ux't'\204\231\026\364B\005\020\0264}d\0207\202J\312L\313"
+	.string	"(?\246]\ric\026\036\206\353\370A\r#$\0332_\264\333n\343\250\211\b\244\344\336\330\332\323Q\255\253\340(\275+z\307AUup[\310\016\203\262h\3773F\3025WG\0078g\240\200\305J\023D \031\252\t\214J\231yy\300\343?\301\030e9\312\177:\342\244$\204\006\247\327~\036\2150B\302!c\215\214\216\326\203\030\"\002\002L_\364\016h\250\301\\\252fH\222\202\202\202B\241\003\240\"\031\242\342\003\022\240\365L\245\034\021 !\201\244\004\022I \022H\354\007p\241J\302\317Ry\307\370Po\253R\333ET+Q\036\324\2515\355;\341\320\224/\267\"\022\336\250"
+	.string	"\271\324\207\260#\240ri\300\272\257\220\305\350R\001\203\314\241\320\373\357=S\312\361QM+\0046\034\"Aj\360\325\005\315~\311:nNS%K\254\355\366|\326\224'\016J\201\347\001\243\342\267\017\366B \006\312}\306\213\032\223\303\367nLJ\261U\266\224Y)>\325\321\376,\240\3711\352UZv\031\276\032\2604\036="
+	.ascii	"\005q\035a\2353g_69\377\364\360r\323\007Sz\200\311lX\372\f\224"
+	.ascii	"K\315\203\226:\217\036\207\353\347\365q\315\313\221\314\020s"
+	.ascii	"\346\213A\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\\\0015\t"
+	.string	"\366\2200,\200)I\007&1\225\240\270b"
+	.string	"eD\032\350B\023\262D\30041\227)\200\377D\321\340\227\266'\n\250\375\323\242\265\226XB\244L\001#"
+	.string	"\""
+	.string	"&"
+	.string	"SA\215B\005\361F\341\304j\333c\275\324/\242ca"
+	.string	"\r\344\037\357h\026\353m\274r\230\276\317\277]\212\345\247\332\262$\301RY*\224X\355G\376\201g\332\335\356\237\031|\326|V\311\210\nz\325^\"\003\016L\n\237\360\017B;&iw\212\332\034\254\206J=\365\251O\t\264de*+.\032\246\027\351\fY\203g_\360\027\247\236\310\207v\323q\370\206\031\026.T\210c\254>!\330\343d\221\223UnQI\323\232\344c\247\3270\202\f+ `\002B\211\350\001\260P\246\021Ap\204\303\272\341\272!\373[\377g\013x\0011\"\004X,"
+	.ascii	"lX0\211?\356\r3\310.\263\255\020\221\037\201q\310\273\253cs'"
+	.ascii	"\364M\3120,\260\001\"\0051\356\235B\232\243\224f\0010\003ov\005"
+	.ascii	"\3146\033>\321dqx\332\27051N\231!\025|\b"
+	.text
+	.section	.gnu.lto_.pureconst.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 e\265\002"
+	.string	"R\206\024\034`O\322\001\016\002\256\353\30302\f\3030\f\362\311'o;?\313+\254cj\255\355\333\346j\266\314\305|\227\257r\242\234&Wr#\027r\037\237ckl\214\273\370\024_\342\016\342\036>\303,L\302\034L\301\fL\300|F\023\232\317,KUq\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`&\002]\n"
+	.string	"BO00pM2\034\240\303\267\330\204\273\206\025\352Uu\252\342\r}T\305U\366\256\006\326\366\332$\266\326\b!\244E\b\220.\370"
+	.string	"\204\2176!\273m)SOX\\H8I\342H\305C\316f\203izY\255\323\351{U\2432\230\212\341Z\340\227\212,C\243#\2638H\262\023\217I\b\212BI&\262\361\361\301\360<!\220)\242\204\177\357I\254\374=\t\342\b\305\245\024\341\241\3342=v\300\251\326\340\247C'\326N\225,`C'\247s\323\251\351\274:\255\316\252\321\024\301_\356\372\234T\333?q\340!\327ZU\317\212\263\224GH\374\314y\246s*\307\264?\344\361\024\t\004"
+	.ascii	"@\255\273l\227\241oSC\250\361pB&3\313la3\260\002\242)\242\007"
+	.ascii	"\0210\241D\f\325\004\022\320\302\331\r\177\354W\271\021\307u"
+	.ascii	"\232A-\321\315'2K,\\\341\351ey\305\016jHT\343v\021\\\315?\201"
+	.ascii	"\223\332\357\377T\351\023\324\202\241\033x\034I\253\\f\232\334"
+	.ascii	"\204\372Z\245\304H\377\314\022\352\032\220@5Jb\310d\035\"p<\377"
+	.ascii	"\234\325\336Q\033\020\362\255%\262\315\335\303a\366~\367\023"
+	.ascii	"\244H\260\252Y\334\206\347\3161\240\342\003"
+	.text
+	.section	.gnu.lto_.lto.adda206c8522818b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorShutdown.26.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"-\013"
+	.string	"\226SJC \251*\035Ht\344x \f\362\024\240\204R\233\377US"
+	.string	"\231\037\323L\371\345\220\242\231"
+	.string	"\004B\251\366\t/\311\222d+\331\030UeW\023"
+	.string	"\b\201\"\362"
+	.string	"pi\033\003\251\231\205T\024>#A[\246\0246"
+	.string	"4"
+	.string	";"
+	.string	"+ZD\204]\225\334\205\255u\017b\266\377\031eS\220Hq\230\260Zp\333]p\276\034uE\371/p\r\311\032\257\f\032\273k%Y+\367\274\355\n\333\027\366K\002\030\345I\b\304\013v\362\336\351\334"
+	.string	"\230]\366\331\311\207y\304\244'\337\371&\357\335\247&\b\320\222\261\2444g\227\243N\027\373\230\235.\373\352\251j\275\372\r\246\243O\273\355\271\003Q\306\200\033\310\263?o"
+	.string	"\302H \3202`\023yv\350\fD\231\227$\024/\233\2029-\004\3404j\235\376ZTs\264\035\036\201\311\346e\203\374"
+	.string	")\263\273\001\366p\304\260\024\216@\222\370\021\t\211\035\240G\2503\002=\"\t\344L8\374\370\210`)\fE\360+\367\230\235\256\316B-5U~\320\017\3027<\233\243\243'\375\330\342*\240\314\026"
+	.string	"3\241\307\037\030V\353*H%\007\262\2504A\202\215\\\342:,l\007\204"
+	.ascii	"\203544sY\037\263\352y\313\206Z\262F\t\342\232H1\004\3622D\270"
+	.ascii	"\034\213v\222\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.27.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\275\f"
+	.string	"FXWC\020\221\232\016\360\345b\246\262\200T\371l\273ia\3160\242\366\302\200c44\377o\177\347\004\032\325#\"\226\b|\340S>\331\233\233\r\007"
+	.string	""
+	.string	"DV\320\262\3358\177\004\245v\b\232\317b[\333\233H\231RB"
+	.string	"C"
+	.string	"D"
+	.string	"\320\336\tP\207\361\003\250Ck\366\f\003\027"
+	.string	"\330\300\240\242\306\356Z\nBK\355\223\246\346o@*\256\333>\305\016\327"
+	.string	"\035\313\324\261\273\037=[\272\225\314\r\310\356:\271\216\303\ro\033\202m\006\366G\002\206\232\316L\277j\360\241@\214]\r57\226\004_\204\370w\373\236\017\203\342)\264\177\206\021\267\rQ\346\313P\332]\217C/\210\207\035\3239\266\237\366M\374\204v\221g.`\027T\242\305\256\247\300\b\342\003\177\340BSR\r\031\205J\215\360\311`I\032\333\025.\203\342\300ga!\213\273\373\227\024\3520\265\022=\346+R\374\027\227\234\344\271C\377D\023\214HxP\311\032\333\333RC%\0274HV\220}\321\037\377=\236g\235\222\t!&\224E>\260\213\344\372X\031\3261\361`\022,\n\236\220\217%\202e\326\307\001_#\035\314\"\271.\314\342x{\005\215\036cF\220Tte\322\220\017\363\312E\304Lz\034j\213\315\221Q\355\317\225\347<\351\026\026"
+	.ascii	"2\003\376\031c\301q6\371}gX\276df\265D\022*x\242\027\b\306R\227"
+	.ascii	"q\255*\264.\026D\240\252ppwUc\326J\264\270\233\301\200CM\336"
+	.ascii	"\256R\006"
+	.text
+	.section	.gnu.lto_motorDeviceCount.28.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\335\007"
+	.string	"\262\21764P\215\322\001\247D\214*\371j7\321(c"
+	.string	"A\230\306\267\202\237\243\367\034\355\343\234\254\250\201\326\252\256\337\210\231i\2565\360\016\261KA\321\366\332\261\367\2262\245\326d\254\350\211\035xY\033\b\216\265"
+	.string	"\0318\n\035\250\261.\230!pl\330X\320\023\243\005/\331\276\255\232\232bD*\341\324\246\037\2458>\345P\331]\004\037$\342\252\234@\357.\325\202\372\3073\220\177\362\303'O\272\363?\357\356j\251\020\345\312\316B\251\030\366\333\356\256\325dk\272e:\237\276{(\222\201\222\335\211\025\312\2168\325\206m\314\276\370\034\357\300l\3202\215\322K]\214BNv3\210\271\300\273k\017xw\232q\354\211\371\367x\023\2610!\225BO\200\204\335u\222J\024\267\336v\201\355\003\333\252\013"
+	.ascii	"2CC\r\354cBIz\2332v\201\361\b\325\336]X\262`y\270VL\302$\003"
+	.text
+	.section	.gnu.lto_motorGetVTable.29.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\265\007"
+	.string	"\222\31646`m\322\001@\203\267\313'f\033\240\217\246\230aw\223\360Jh\362\234!\214F\220\275\327U\333\335\254j\260["
+	.string	""
+	.string	"\013\313q\004\366\373\177\263\215m\033\331d\313\224\002\336hd\374D\017\274$\347\241#\027 CG\301\0037\362\202\032\002\307\006\216\204\237\030%\314\314}\265\256\344\355\005#'a\373\372\t\273\354.\202\037\022\341p1\205\266c>\016\362\031\362M\206"
+	.string	"\351\265?\037d\375\335a,F\232\262g\246\016\303~\265\256d\253\372\225\205:\031 \331\245H\255l\312\033\341\260-\2623~\3077\2211\201\251\221YP6&DTv\027\276\371"
+	.string	"\353\317\250\003X\177.\343\330\025\363\357\361\252\344\302D#eWK\302\356Z5R\305\355n\333\300\366\201\355S\f"
+	.ascii	"\035\023\332h\f\002\026\203dB@\334\241\202D\250\373\\\303\177"
+	.ascii	"#\306\026\"\027w\305\324N2"
+	.text
+	.section	.gnu.lto_analogInitEndpoints.30.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\350\005\335\037"
+	.string	"6\271\305G\240\330\321p\300{\314\334\3434\235\207k\373\025\017\317\312\263\031\262$\350`O\370\302}\013ap\226\312\215\337\351hZ\334\316\315\211\321\016\334JV\340\245\305\223\006_\240o7&\366\203\004\022H \001f$m7\2212\245\263"
+	.string	"\223"
+	.string	"\266"
+	.ascii	"DJ\374\224\235'\212\262/'X\211\004\307\221\267\317\345w!\215"
+	.ascii	"\254I\245\330\241\222\2025v\236g\001\022\265\227\307\331G\274"
+	.ascii	"|Fjl(\222E\274\240\365\205\264C\314\325Ss\n\205\374h\240\307"
+	.ascii	"\003\001>\210\221\263\232\323D\260E\327y\236G^P{\231\233]\355"
+	.ascii	"\373\370\017\340\215#ns\236Vb]\347y<2\201\332K\037\257c\276\254"
+	.ascii	"\035\307|i\240-\366#\215\223\026\003\007U\026\227\363<u;\343"
+	.ascii	"\300\227\263U\240Oc`#\026\245^\256\370\354V\\\361\235)\ng\271"
+	.ascii	"\363<\277u5Q\f\252\322\030\234\347i%\026U\334\346mS\260\315\302"
+	.ascii	".\265\004z\236\247\324>\312\374v\020\202E\250^|\323\334y'\323"
+	.ascii	"\356\201\320\023\2771Zd`\302\225\262\217A]\031\366g\347Z\331"
+	.ascii	"?\362#\270\221\377\300\221\267\321\265~\002\017\362\027}\310"
+	.ascii	"?\340E~\0017\376\001T\235S5\221\252\207T-d\252\203L5\220\252"
+	.ascii	"\177L\265O\251\356Q5O\251\336Q\265N\251\316Q5N\251\276Q\265M"
+	.ascii	"\251\256Q5\215\252gT-\243\352\030U\343J\365M\3256U\327TM3\325"
+	.ascii	"\246\251.K\365\314To\251\326\231\372\n~bG\030\216\345\312\315"
+	.ascii	"\342\310\276\260l\252j\326fwK\206SI\326\254\214\024\224.F\032"
+	.ascii	"\033a3K\263\037^\355\316\354\237\274\250\"s\245Ib\026\243\215"
+	.ascii	"Y\231\375\260*\030\263g\362\342k8\206[?\n\220\207\2211Vn\370"
+	.ascii	"\3462_\236\230\345\266\270\325\255\341\230\206\177A\271\255-"
+	.ascii	"\207\027\226qf[\243=\230\332\322\326\266A\311\241\216\2425\362"
+	.ascii	"V\341yN\001\250\255\320\226\271\264\rJ\016\307\312\3355\267\307"
+	.ascii	"kx\025\3242\317\266\344p'M\256\344\212Qw\367Ta\234\364%J\265"
+	.ascii	"\363\024.\360\223\\\311\222\177\343\245\233xz\"\317|\251\373"
+	.ascii	"\256\037\001y\322\3058\245e\001\277%(&&\t6Q=\244\233]\202\b\273"
+	.ascii	"\247\244\016\273\244\245\035\216\223/\t\212\2673=4\361 \334\242"
+	.ascii	"z\266\037\317\211\207\364\013\361\341\027\242\207k\3421=\365"
+	.ascii	"\034\340\254d\300\327\373\365\234tP\276%\021<\337N\367\304Kr"
+	.ascii	"\322)\371\240t\006\200\334\373\260\344\323\375z=\237\016w\234"
+	.ascii	"\372\354\\+?h\0016\265\3012G\264?\233[3kX5\264BK\244\243h\207"
+	.ascii	"VhK\320\n\215\001\255\317\006\255O\330\360*\b\264@I\250\302\370"
+	.ascii	"\354\317\232Y\303\261\236\365\231p-=k\203\221\304\342\271\332"
+	.ascii	"Y\236\325d\205\223\355\254\2558\245\213\016\217\234\325\261p"
+	.ascii	"\2610`\217\013\265\021\346\313\234\375\326\007D\231\2025\303"
+	.ascii	"qq\2638\273a\001y\250qP\002\tr\210d&(HRPh5\360\002\231\251m\007"
+	.ascii	"\02109ED%\205\222\312\001\022\236\357\222\375\230#\210\027n\362"
+	.ascii	"\351\f35\236\210\262Yo\262<\305\213h\333\323vA\"\236o6\366X\225"
+	.ascii	"\250\355\311)5}_\210\3651U4\354D\323\3662 s\266R\224V\273.\016"
+	.ascii	"\177\246T\327\032\013\ts]\213:(J\020\3168Z`\366\247FWD\354\362"
+	.ascii	"X\244\031P\177\tgl\225\345n\364\236\016\212\213N\034\013\366"
+	.ascii	"\030\346y\210\013\222\245g\241\205\213\2413\244\2206\236\366"
+	.ascii	"\240\304\300\250\346\254\312ZJk\230\274\2264S\3406\027\327\035"
+	.ascii	"ZdH\017*IK5\331X@4\272\364g\376\317Gc=a\252.v\342\236\347\005"
+	.ascii	"\205b\331\017\224\032\275\006\247\351\325\200t\337[9\206a;\340"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_checkMotorProtocolEnabled.31.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\207\001u\020"
+	.string	"\366\236qH\340\262(\035\220\200\240g\256]\005J\t\216\351\021\352\252m\321\f\330\013\"\224\314\027\2454YbF\224\317\2775\202y\004\352-\330i\003-\327\347\f3p\216C\n :\t\210w\227=\337\316\351\260\202\f\304nB\366N)Z"
+	.string	"X"
+	.string	"\\"
+	.ascii	"\335G\3509\3336\211\260r\370J\003{\214\306\013G\310n\365\346"
+	.ascii	"\212\207\247\3346e\350\323tZ?9\243xj\342\3346\022\243\3433\032"
+	.ascii	"Cl\017|jP\210F\020r{\355\n\306 \265\237\234\021\346S4\2666\222"
+	.ascii	"\335\035\215.)C\026v\327\362e,q\207n\373d\033\305\376,\273\273"
+	.ascii	"\2363\366\353O?"
+	.string	"\373\271\323n\271I\277#\240C&Elg\376\324\205\005\021\331\036\356F\213\323~{\345\327,\362i!\211X\027f\242\242\33288g\f\335\254-\007\352\202\030 \033\236\tR\332\267\371\315\3523\227\017\330\235\371Qc\267Bp\203\356\234\353\013\320s\001;\322\017)\200\330\216\327\316\374C*\247\b\277\205\322\371\0301\021H\016\036.9d\2332\373\350h\226\304\3562\b\301\350\021e\021\271\273\342\2342oO@?\r\324p\270\344\020\333\036.#\325\355\272$\3708\252\017\035\213s\276\013=\367YaD\017\231\233\031K\006\331U\224Sf\177\013*\245\225\f)\250RH\365qH\235\254|\244O\365\201()\223\200\r&\r\250\357\002K\351ddR\t\370\251\276\223\227\002K,&P\305C\231RN\036\tLy%\b\374u(\201\236\352\373@OT\367\333\316\0319G/.zX\263E\247l\306\375\0340\f"
+	.string	"D\001\346\205\314\315\t\226\f\362\251\211\261\301M\231i\214\347\025\033"
+	.ascii	"a\221\"\023\357\371\321\274\b\222\214uE\230\024Y\223 \003\222"
+	.ascii	"Cm\235\303v|\254\223\335ZB\363\361u\250\2545\330\205{ov\257\221"
+	.ascii	"I\r+&\264\013\364@_\003\324:S\265\\\204\272\217\272\377\265\345"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_motorInitEndpoints.33.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`L\003\245\027"
+	.string	"6\252\226L\260\020V:p\214\f\373\233uzu\307J\337w(={\261\306T\0169\237x\215b<\322\306d]#\356\006y\177\037\246\333\276\323\021@\336P\373\261ba\377\244\375\300\357\244\265\207\240\022o.\264\311\332}\223o\203\020B\310\336I\006|"
+	.string	"~"
+	.string	"\200"
+	.ascii	"\274\016\306\356>\341\225\364fIy\313\374\237\003\351\036\264"
+	.ascii	"\341\"\335;N\306\356\365\204M\322\233\274\236\344\274\231~\344"
+	.ascii	"\274\311:\346\250\257<}\242\236\031\242\251\356n]\022\327\375"
+	.ascii	"4\313ku|\233\247\335O\0207K\023)\245\034 @\016%\311\357\204\357"
+	.ascii	"H\2674@\031[\036y\003@\034C(\"\360\346\227\005\344\225%\335\r"
+	.ascii	"\002\354Y\213.\350n\266>\240\315\031=3c`f\017\314\227%\177\372"
+	.ascii	"\242\037\375\320\177^"
+	.string	"\3507Q\313\345\203~\013\300>5\tK\\\250\265\177U::i.\241\370\361g>_\351G>2EE\207\273\013F\205\222\246\226\316d{\022\2338>\301\237\356\2661\263n2\343\370Ff\245\250\340^\314\225\354\326\376\245\214X\177\246\272W\0047\3712\351\315\263\230\217\220jD\242\020\022\214\250\"\024\025[\356\020'\r\b\351\336\320\004\003\273\276\205\356B\\,C\232&\347\221o\240\3234S\2644\311\177\334\034\034\025C\032\037W\306\313\231n{j\370n<w\362\235\376\224\343\3730,f\357\213\2357\025\334\244\b\002\345\22408*\345\351\017\335}\340&\272\"\271\263;lw\357\356\025\226/p\226W\3000F\317R\361\217,\373\013\013iwo\205\337\244a\306\367Q\357\221\267,jl\004\201\202bl\025\363\312\263W\310\374\262\357\016\363\217\347\217\037\375\253\023\177\217\033\005/\330\005\027\027\r\206\346\324\226"
+	.string	"\257\004\020^4\227\313\313\005{\215\314j.\233\354uV\210\311\034\254r\252\307M6\223\265\334p07\234\312\212\311(\320T\026\026\277\240\324\324\233:k\331j\260\f\262\332\253E\223\271f\255\227\232\255\205B\200U\030X\255uS\325Z\213\265\306\274\354\273\303\017\252\2221\227w\212\330\325\365\270\351E\357y\315k/\363\004\227\275\217\217\364\327\020\235~\301\026qw\347\241\2222\232W\310+\235\0313\305\373\347\002E\250qT\305\210!A\021\tD$*\t\263.\006\260\002\241\241\262\r\021\220\275ea\264\240\332\f'\212K\022\331\271T\370\321\204\375O\272\245\002|FX\2558k\242\260\320\211\250|\300\026'\002vN\344\333\353@\204\n\362\212\227\034\327D\236+\263\030\220\301\241\031<"
+	.string	"0\353\013\333\005x9\021\221\254"
+	.ascii	"mDb3\336V\247\314\312\252gT\245\213\331\371*\021\331fh\375\220"
+	.ascii	"\031\333\223\201\r\347\330R\375JHF \322`\024(\031\244\313E\264"
+	.ascii	"%\365y^\375\020\352\007"
+	.text
+	.section	.gnu.lto_motorConvertFromExternal.34.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\n"
+	.string	"\226\324JA0\213(\035S<\251\374\377\316\355\260i\276m[\037\335\\\007U|\365r\322\353\361\351\247\376\206K\363\200\352F\306`-~\317f\".\"\030\310|)-8\0207w\224\206,8\267\021\262\211\224)\0057"
+	.string	"6"
+	.string	"9"
+	.string	"\366\025|\301gW\270\302\003\340U\024J\020:\354\256\2269\005\366x}\002{T\003\377\236\237\377\006\277\022\200\032L\247\3213\353\330]\247\351$\340\326\333\276\260\315a\337\"J\300\216\351\354\341\0373\255W:5\375\212\005\305!\003\303n\200\226\207\335\020/ \260\375\331\026\333\231\366Sg\360=Dq\334\035\220\301\302n\250a\214\312\243D\332\001QU\257*}p\347\023J0+\033\344\022>\225\335\335\210p\302]V\240\b{L\305\260Rw\360\007\"\037\264\210\2277=\372\036\366x\275\260P\244l\331\341(\265\200\375k\003\333\210g\343\341\331\200\272-d\262E\230\243\351\270\020\367\321\274n#\351t\037\032\250\263\371h\234\316\3234\025\346B\266N\013q\\\247Y\302\275\235i\206\244)\206HU\247f\232\001\240#\007\017"
+	.ascii	"2\003\302\260+&rV\267]\314G5\365\032c\300\244\206j\304\205\221"
+	.ascii	"(3\315\2011\002\232xRRL\327$\003"
+	.text
+	.section	.gnu.lto_motorConvertToExternal.35.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\035\n"
+	.string	"&\323E= \345*\035 !\b`\323\305\340\002x\035\n8V\020\341B\204\031\2171*\204-\2032\262\367\313\223+\n_N9\3765`\004 \022 \0030\024L\003;\364\225\rY\221\335\233l\231R4"
+	.string	"1"
+	.string	"4"
+	.string	"-*\2574<\001\2312\032\017\031\201\335\320+\370\301\274\324\033\314\313h\362\325u\345\377\345\334\n\312\314\365b]7\021\273ku\275B\356x\333\n\266\035\354#\004\017\177\216SkT\177\323\251\f`\270\355~\334\n\254"
+	.string	"\t \305\266\312\356l\253\332\217\335E\365\3204\017\354\006\240\325\354n\203\0278\227\037\316\266\317\362\237\321\360\324\354\322g\037gw\037d60:5Xj^j\364\330b\207yL\312\207\331\204\322\273.}\324\274|\354\330DZz\263C\226\306\022\373\334F\022\317#TEH\202\300\"\020\370\235\276\222g\002G\031$p\302\263 \205J\236\b4y\240\004\177\027#\320;}\037\350u\341\3363~Z\221\303\235r\321\032g\204\030\351\210,\333\024\001\020"
+	.ascii	"a\221\"34\030\261\302\234s1\037\325Tk\214\001\223\032\252\021"
+	.ascii	"\027F\222\261\246\250F:0F@\023FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_motorPostInit.36.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\002\31756P\215\322\001\244\004lK\231\f\254\006\247\211.\020\004\027\316\335 AQ\312\313'\0047|\324\321\230\346&\306\327\212Y\266\2216\300\362\315Z\r:\302\320\376&[\246\024\316`\246\354HN\274\246\346a3\025\342\302&\201\0233\363\212\030\001K\006\315\214\035)g\264\272}\265O\204@:i\017d\213Z\237\255\013\320\313l\313\177D\\8\273\341\036\027\300\356\032t\022\016\001\334\350C9\324w\321(\235\364\322\307\037\031\302\243\337\016}\017\345\360\017j(\023\013MSv\227\351\303\260_\355\023\331\252\326\253\017\255\216\221\002\222]\212\324\311\236 \310\206\355[\306l\324;no\022\2310\225\354n|\031\307\256\230\177\216[\266Pv\255\034\354\256u\013U\334\357\266\007l\023\330\016\t\r"
+	.ascii	"3\241\003\f\374\353\335p\261\031c\217\363L\fe\207E\265\347B\216"
+	.ascii	"0\330\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_motorPostInitNull.37.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \300%\005"
+	.string	"\222I#,pU\323\001"
+	.string	"-z\337\003\036\370\016\276\352\302-~\237c\304\004jdT;\360\035\200\322)U\365\200\003\216\367-@\r\313\242\275e\n\236\244)1i\3555\251G5\027\333\250\024\326N\363Z\251`\351\240\346bR\316\215\274k\354\f\220\030\261=\r\306\212\255\201\377w\354l\030q<\222\346\237\004"
+	.string	"\274#\330`lk\344\314\006\251w\271~\037\311\027\372\277\321\242\231\302\314\252\031%l\234\246p\220\370o\270q\024uT\333\007\333\b\333\214\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorEnableNull.38.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \307\275\005"
+	.string	"\324\tk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\367\262#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\354\205\007\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357.\361\370\360]\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8]\304`B\344p\347^\355|\002"
+	.text
+	.section	.gnu.lto_motorDisableNull.39.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \300\035\005"
+	.string	"R\211\"*\200k: >\232)\201\022\331\311\255U\201\300\245Z"
+	.string	"\374\337\316\340\266\371\355\354\353d\024)\246\316\357\r\030g\257\210Hn\231\002\237\244)1i\3615\251F5\023\274\250\020\026O\363bip\311\240&cRN\216_\353v\004\307>\376O\203\353\375\n\350\355~\030;\033\316tGB\240\326\0040\225\377\032\237\375\034\375(\035y\037\310\305\323\335\274\023\315\024fW\265\250`\3434\205\321\241\273\0177N\242_\375_\370o\370\257\b\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorIsEnabledNull.40.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \350u\006"
+	.string	"\342\313,3Po\322\030 \376\217s#\034\240\271Fw\020d\t\204\363\272\307!\240\314Z\233q\265\366q[\347\240\275\231\231F\306\324(\330\204>c\232'L\332\3362\005\017\226\206sIg\252\347<n\243\235g9\\O\243\234ka\243\231\327\321J`\307`=\3658\367\224\212\233\020` \242I|\004\261\266\361\211\331\246\361\254!c\264\242,\273\241\227\226E\221N<\376\317S\177c\t\002q\333\305(1\331\215\007\033\004\244\364\217\220\360\031f\354\bM\023.\025#\243\335\250\215#a2xfH\022|\210\244\250\220\210@\311&\205\335\235Y\210.\362\226\177\301\257?E\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8x\3048C\310\351y\373\325N2"
+	.text
+	.section	.gnu.lto_motorUpdateStartNull.41.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \307\315\005"
+	.string	"\024\nk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\307\263#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\214\247\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\3578\361\370\360q\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\b"
+	.ascii	"U\b\230\347\220\254\202w\r\247\213\030L\210\034\356\334\253\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_motorWriteNull.42.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262N44P\217\032\003 [n\245Bt\t\311\341\003\n\032\266\240,\350\356\340\020\243-\2441\232\362\244\371\347\313\325\314\f\021\322\334I\223%\273\241\252\266\r\"\267\224)\005W\303\002\350\364\034.\021\t{\ryd4\305\021,\311\353\204I\021$a\240\021\f\311\022\364\02042\\\022\232b\224p\223\335\326\335\252\034\b\027\321f\250\346.Z[w\253\266\005p\254$\234\374\023/.Wy&\033m\275i\353Z\353\017\203Lg%\251\346GI)\371\337\351A\306\217\343\001\214\237e\001\214_[k\021>\323\035\017u\277\205G\311\237uj\220\361\353lY\234e\334#\025\022\"-\377\241\303\360t\233\265C\254I\251Pn"
+	.string	"\n\377\333R*\n\327\271mA\333O[\215\b"
+	.ascii	"2\241c/0.\034\327p<\026\006B\205\211\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_motorWriteIntNull.43.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\362\21523`o\032\003\024B\002.\211\342(\352\326+@5}\207\340\006\213\312D\"k\264\207\350\216P\220\301\356\215\242\340\201\361\fm\234\351\031\301\212\247F\222H\231R\026\204\003\350\344\",\021\351r\ry\"4\301\321+E\353tE\321#]\240\321\013\305\322\363\024\024>X\361\231 \214\2573\357\314\333\252\006\024\255\242\235(\3268Zg\336V-\013Paa0\371/b`\276\342R@\332\272\323Z\304#\322S\242\356\337pQ\340\330\t\230@c\307<\240\261+c\355\302G:d\242\355\3178A\371gB\0218v\225m\213\247\3077\035\032\026%/\377_\353\2604\223\265I\f\220R\241\3146\r\377\313R*\f\267\271\355A\333O\333\217\n"
+	.ascii	"2\241a/0.\034\327p:\026\306\024\306e\352\252)5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_motorUpdateCompleteNull.44.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \300=\005"
+	.string	"\222\t$.pU\323\001"
+	.string	"\025\330#\005\300 \033\350\200o\\\260\361\257q\214\230@\215\214j\007\276\003P:\245\252\036\320c\314\327-\0347|\213\366\226)\246\246)3y-6\253\2115\037\033\261\034\327R\023\333\ta)\251\346fR\316\225\276k\364\022\224X\261\277\r\306\214\255\203\377w\364lx\020\0010\004\376K\001\301G\204P\307\266J\326\354"
+	.string	"\3756W\020\307\362\031\370\277Q\243\232B\315\252\0365p\335\246\260\320\370o\310u\030uT\333\n\333\013\333\220\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorShutdownNull.45.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \300\035\005"
+	.string	"\222\t#*\200k:\300\247B(\227Fp\017K+\020\t\313\244J\211\237~\310d\363\333\331\327\311(R \341\276\324\206\221\023\022\310\356-S\256\250J5\212\315\254Z\217\253.f\343R`\263\252\331\244\b\246\016\253N\215\322:\247\360+\277\002DF\354\220\213\262b/\340\377-?;\016@\036\004\347\237\214D\357\0046\027\333;y\263?\033Z.\201\030\211&\364\177Jp\267\215\233w3+\350<n\243\224\370\357\330y\224\265\\\333\006\333\007\333\214\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorConvertFromExternalNull.46.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"-\007"
+	.string	"\222\31516@\215\222\016<3y\263\330J\374\004\274)\267\356\024\217\002r\007\300"
+	.string	"DhE\253'\354\303\251\211\b\254\207\035E\3017\026&2\347 -PA\022\026\221F\210L\001\026D\303&\364\346h\342\005\272<\360\023\255P'2@\207\316\306\0039\361\0035\005_\017V\204\240\353\212\020\223e\253t\246E\f2\022n\3423Qs\247o\225\316\364-\240d\242\200\222Y\261\242\222%\217D\343\307\036\363\267\366\365\350\007\326,\342\227iq2\222\231%\214"
+	.string	"\320'\320\376\313Q\024\366\"U\206\221qIuP\204\244d&\314\224\300\322Wu\300\322\347.\212\265a\267 \2556P\251\021I\324vY\310\314\333\210T\352\256\377\301\017\377S\n"
+	.ascii	"2\241S/0\0368\b\341\270\206\237X4\016L<\270\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_motorConvertToExternalNull.47.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"BM16@o\222\016\230\265"
+	.string	"\3606\004\374\017\335\244\214\f&\375\2021"
+	.string	"\214KM\261\277\331\361\347\303\245\307ql3\237ax$\271\307\314\300\231\017H\330\\Yk\215\020\231\002\227\304\003GT\335\331D,\204} (^\"Ot\200\020\036\316\007v\"\bn\020\306\"\256\bC\030\026af\313j\226f\342Q\3746r\217\343K\345\333xG\220\261\302\300\222i\021\003\223*\025\212\307\237}\346w\356\033R\221\254\333&\013d\246\264\234d\346\302\n\001\2554\324\177Az\312\326\334\326q1`*\251 y\311\334`A\017\254V\256\006V\253g\252V\247\335\216\224\3728\271\220J\243:\200\206\314\334\221J\030\375\365O\370\341\257\021\n"
+	.ascii	"2\003\202\341\243\302^\025\220k\370\211E\353\300\304\203\273"
+	.ascii	"F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_motorNullDevice.49.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\020}{\273\001y\273\001"
+	.text
+	.section	.gnu.lto_isMotorProtocolEnabled.50.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\002\314,3Pm\222\016\303\004a,\250)\242a\313u\024\310\266\221\346*{Kv\325\376\335\016\360l\246\210\355f\257\253\252\232gZ\3606\0161\314;4Fkd\313\024[*\317m\\\246i\336\005\002\363\032\232\003\206!\323,O\323*\004\273\207\313k\033\347^\243\\Y&BV\360a\022\337\216zT7\343\b\016\326*u9"
+	.string	"\245\220\tX|\260\364\227\007\331\305wJ&\372qd\003'#\n$\231\240\022)E\250\020\215\277\363\224\021\022:W\2750@\035\221&@L2\257\306F\255\212\325-G\247\215\217\022+\344)\006,d\346h\205*:\353o\360\037\374\024\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.51.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\002\314,3Pm\222\016$\243\252B\304\342\251aI\006"
+	.string	"\bn\255\301\301\177\020\337U\373w;\300\263\231\"\266\233\275\256\252\214\272\212\303\3338\304Dp\304@\255\221-S_,\317q\234\246m\036\006\"\363\032\232C\206A\323.o\323,\004\273\007\314k\034\347^\253\\YFBV"
+	.string	"b\022\337\217\202Tw\343\210\016\326*u;"
+	.string	"\245\220\t\214@X\372\353\203\354\342;%#\3758\262\201\321\311\002If\250\224\222&\324\b\307\357\371\312\b\t\236\253^\031\241jPL\204\240d^\215a\264*V\267\036\235:DJ,\321\247\030\240\220\231\243%\262\350\254\277\301\177\360W\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_motorDevInit.52.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\334\003\215\033"
+	.string	"F\363\263I\260VU:4\312\023\005+\342\267\345[;L\374&S%\364\326\342\360\023\023\371\363q82\337\322\271b\252\003\333Sg3O\246\022\017\251&\232\226\306\354q\216\240\276\322\306\310H\236\035>E\032\336<7\324\020!\204\310\235R\235"
+	.string	"\222"
+	.string	"\240"
+	.string	"_\3629\254\372\250~\310\226x#\273+\265\240\260\372\343\233\021\201\365\022FO\355#}\270{\222\213\327\324*\224ZR+\221\201\023\260^\232x\033\363%\353\002\314\227\336\331[N4\252\177\242\361Cr\254\265\306\266\307wg\235fI.\335\371'N\013\030\344\235\365^\320\317\023gG\215\240\233\244"
+	.ascii	"!(\343+"
+	.string	"\370#\027\030\203\340\200A\313\033'\311\004VQa\\\301\027\244\r\220\017\340+\370C\367\025|A\336\324Z\337t*#\350\243\364\304\251\265\232\002\2035\356\326m\307\260-\302^-\001F\265\366\016\364\227<*\307?z\351\331\016=p\307\244\241\240\007\332&h%\306\n\306\362l\242\217n\221}\262\256\320\276\322_\363\245\037VR\323\224\324\2573\3353O\372\003\264\250\317\026\265\271\324\345R\223K\275,\352\023\240PVHG/Xh\254\025b\005\272\"S\247J&?\316\364\333\367\241^\\a\243x\\a\273\236\236\304v9w'o\225\022!\265VW\316v\275\244o\262\3136\223\356\206G\254@\016\236\234\220\216\265\022\025\274t\006;x\260\013\247R\273\200\001\203\371r\213@/\004\350.\271\345\006X{\003\007z\240\2717\277\345\271fK\330\222\373\231\335\355y\342\362+\323\243Wn2\024bDn\221\324_"
+	.string	"z\360\272H\351\360\332'9\035\022\036\321Z+o\2573i\366M\257Q\342A\345\013U\226\037:\306>\224G\321\371G\366"
+	.ascii	"\202\036\b\302|I\263/\236\016\3458\022\r\203z?`~g\366\305_\023"
+	.ascii	"\037\275\262\035\342OF\260j\375\201\340;9A\202u\344\302|\371"
+	.ascii	"\375 \254\"\032&\365\350\225i(%\336R\246\202\337\351L"
+	.string	"v^\0015\037\r:\263\034\033\213\234\255\303,\247{\361\330t7\031\200Y.\205N\303,\205\016\255\265C;a\273\311zf\023^\316i\200\273\361\334j\261\034n\326C\303\351\304l\264\022\265X\016.\027k`\3007\0253\\\214\347v\303\305\\\304\336\311\272\302RhJ\214Uo},\004\324\336\021\331\r\351\201\336\345]\b\312\b\344\334\"{W\344[tUUG02\323\226p-\262\017<t\020!\375:\323\246\360+\272\226p\312\021\214]\341F\037V\255\025\202_E\205\205\001F\347\322\224!C\306 BQf\315<\327\304\021\252s\013\024\201)\315\365\247\002E\250Q(\204\020D\312\021\tF\002\221\232\240\300:p\002\231\2712\017\021p\2718C\f\265\033\330\2200\3741qF\220\370\211\001\317\312\226\232$\216\332\276\264\243\252\004*\217$\250<\212j\302Q\2231\"\333\252\322\003\326F@\210\341y\310"
+	.ascii	"_\324Hq\223\256\215Dp\336\300c\030\322!\301\270\t\367\007\200"
+	.ascii	"|2Bk\r\0350\300\210\275\207=?\224h\205\242\304\370\316\322\244"
+	.ascii	"4\202\025=F\222\251\331GX\345\007\311\353s6qm)\243`I\203$\242"
+	.ascii	"\363\325XF)\234l^P6\020\377\001"
+	.text
+	.section	.gnu.lto_motorDisable.53.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\355\t"
+	.string	"\026RB90\257\322\001\204dQ\034\217M`\201\204\355\2158\314\0174\315\fV\371\355<E\320D\253\036\357\023\333\303J\254\352\035\237!j\265\351\211\005\235\264-E\302"
+	.string	"\325<\t\3322\245."
+	.string	"/"
+	.string	"6"
+	.string	"\213\363VDl\277c\225\375\362Q\334\337X2Nt\273;%\310UW\225\177\3329\256\327\352\n\200\260\273V\327k\343\226\267M`\333\300~B\376\314\024(\275\353\236\217\372\356]\026\310Z`5\016\226\356\354q\245\362\303\276fw\3272f_-U\255W\177\363\016\025]\314B\312\256\306n&\244\317\036\035\205\264\371X1 \346L\244\3640\\d8j\225\356x\264\344\3126\370\022\013\217hG\234\304\264\331\335\203\361B\"@\234\245\276{*=!\266\327nK\005\006}B\360\004\226\246)\fM\214B\207\3710j(MPh\232\037\001\203\020\241p\236@0\234\235q\257Y\031c\240\341X\262e_\364\331\241\337D\n2\030\330H.\023"
+	.ascii	"3\241Q\037x\307\272\226\322T\n6\207\211;\262\260\007\210\033"
+	.ascii	"\006\027hh\346\262>fu\364\226\r\265d\215\022D\\\306~\031\002"
+	.ascii	"\\\272E;\237"
+	.text
+	.section	.gnu.lto_motorEnable.54.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\025\f"
+	.string	"\306\225N? Q\224\016L\226`%\005+"
+	.string	"\215S\270\003n\340\351%5\235q\206\023,5a2f\367j?\331}\323\362\026\025\226kY>4\272%\300\223\301r\254jP4\216p\2146\333\310\336R\246\024<"
+	.string	":"
+	.string	"="
+	.string	"\035 \273\213)\352\241G\250\031\362#\227\t\327m\217\022\r\207p\300\007\013\032\034%\021\334\325\221R)\235\005\030`w_\342\211\241\033eF.\273\353\344\272\f\267u\333\bl\013\260\237 \217\276\307z\274\022@\235:\2506\2102\304\376\266\324\017\366\341\352\311\316t\3244\314t>\375\311M\036 3\016\250\330-\205\334X\030\261\305\b\333\277\034\262e\374\363\366+^\\\bQ\317\301\303H7\333\016\336A\301\342y\363\024\331c\001\317\002\342\271\273\233\372c\245.@\021\203\2246lG\270\211\217dw\r\370_\005\216$\005\262\036S'\253\253\276\002\371)K\360\344\271\306T\264\254\223m0\216\226\231\240\321\030`\0174\n6\030F\343`\025"
+	.string	"\316 d4\254\223e\032v}{=9\232<j|\210t\024)ig\032\3449\253n\266\013\025\t\017\376\304\243f\210+\r5\034"
+	.ascii	"3\003\3569$k\340\261-\313\207V`\025p\306\027\330\240h\272\b\301"
+	.ascii	"C\034\n\321!k\213GX\006\013\325X\201\305\326\267f\257P\213\327"
+	.ascii	"(\361\\\303\345\206P^\206\b.?0JUsj\306\331\256R\006"
+	.text
+	.section	.gnu.lto_motorIsEnabled.55.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"]\007"
+	.string	"\362\31525P\215\322\001$O\312 \341\252r\327j\377WW)\356\326\\\320/\307\206m\270\351G\035m\231\233\030_+\006Q\025Sq\3778\247x\244Vm\203\220-eJ\001\316`\340\353<\216\273\240\006b\003\031\\\303f\201\3432\360r\030\001?\007\rt\235\367\240\273\304}[-\251\016\210t\302\366\365\017\254\262\273\b~\224x\250\230>\326+U\313\351\036?}|\223#<\371\354\225\357\261^]-\026\242L\3311\224za\277\255\226l\2475\323o\001'%\n!\273\243T\312\222T\"\033\266A\366\305\006\007 c\217\031\243k\230P\200\240\354F\247\030\307\236\230\377\216\267\021\024*#\205\236"
+	.string	"\t\273\353\314H\025\267\3366\201\355\002\333\034\001\013"
+	.ascii	"2C\027\r\f\304b\\L\b\020<B\335\347\032\376\030\341\226\020$\334"
+	.ascii	"9S;\237"
+	.text
+	.section	.gnu.lto_motorIsMotorEnabled.56.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\255\t"
+	.string	"6SD;0\305*\035\310@\376\261k\303#C\215\231\0039J\244\213\241\347:<m\0043\247\273\"\363\254\0168\032h1\216\"P\341\241\301!\003\222\320}J\323t\370\300\032C\2026\221;\2453"
+	.string	"/"
+	.string	"5"
+	.string	"\341\201\r\270K\333FH \271\364\260Cu\217\030\352d\300n8\225\343\245\307\222\377\220k )\002R+\323\343\266\260\273\216\251\025\306\255\267]`{\332\347\002Q7\354k\253,\333\321\333]\277\324h\225\321Q\213>7 ka\b\260\253\232\305\226E\256|\330\276m\222\215\261\255\361.\n\353\256\006\212\312n\252\007\200\222\271\273I\204\346e;\274\004\304\355\256\302\245OR\341e^\255\321\3452\252\006&\362\221\207#\277e\b0>u\351\203\227\313k\006\226q\2123;4\005\023\037O\250\223\356p>O\344\201&\370}$\272\3173C]\003hv>pr\b\354=|\276)\362\274ob\302\275\266\312\332tsR\013\013DUG\335ts\241&K\r\f"
+	.ascii	"2\241\035\f\034\371\205\313\352\f\227q\320\330\005v4T{.\344\271"
+	.ascii	"0\006\247g\203&a>\001"
+	.text
+	.section	.gnu.lto_getDigitalIdleOffset.57.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\025\n"
+	.string	"\266SF; \345*\035'\021\223\tL\260\034\001N\033\340q&\344?w\261\034Y\200\301\277\320\246o\037\233\rm\370\222\315\322\035@\002\002L\323=\315\261\370\3352b\236Q\030\362\311&r\247\0244"
+	.string	"2"
+	.string	"4"
+	.string	"\027\t\355\331&r\300\016\343\301\222\315\354\256\327\371"
+	.string	"\367\271]\200\373\324\215\207\227\241\177\222\317\230\225\261\345:]j\032v\327\262\345\312\270\365\266\017l+\330\347\004\342?7iUi)\245\257\341\324Z\036dv1F"
+	.string	"K\233*\037\266C{c\373\322~\354#\341E\323\003v_/(\273b\202\021\272O\213\235m?$\312\351W )9Z\252\252\346dU\273J=+\200+nB\352vU\013~I\311\242\203}\372&\356\363j\320\021C\311\321\026OR5\354o\253/{\223\346\036\023!\211\321\347\260\361\307\003~\245O\344\221@\320E\b\214\360F!\b\221\367\001I\236\207\300\037\005\b\364J\337\007z\033qos\332Ai\312\236=\205EF[3\214\243\213j\027U\240\001\016"
+	.ascii	"a\221\"34\030\261`\261Z\303\271\252\314P\332\353\317,\346B\316"
+	.ascii	"\224Y)\301\030\001M<))\246k\222\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.part.0.71.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\227\002\025\025"
+	.string	"V\350\207I\300\322Q:\242\340\024\026\310Q\301\221\327$\324\325-\227\256E9\2419\347\303\"$\023\243\200Iv_-\322\237\365\267L\204\353\177\261\347\246jr\023\004A\020\004\f\"\300\334\212\347\030\031\f'h\034\345\177+\371d\023)S\np"
+	.string	"k"
+	.string	"t"
+	.ascii	"@\264\253p\321C\346\324\3711\232s\\pi\005\342\245\307\007\b/"
+	.ascii	"\305\213\204\227\366\177l\317\354\245\217;3g\232\2754r[\365\250"
+	.ascii	"\021\3321\347l]\256\b\377wp\274Wi\227\340jH\363\317;\n\247\253"
+	.ascii	"]*N\347\341 x\272\335\220`\351f\300\224&\246\243\373\2566:\031"
+	.ascii	"\335\224O\207\253\310\303\323\2039\247\305\017\367\351\266c\266"
+	.ascii	"\033\330\212#"
+	.string	"L^\035\033\245f\255\032\344\244^\211jU\352\244F\205jQ\325\247\217\177(\325R\252\301\023\335\013\252u\325\027\t9\2404\347\315\317\307\314\221G%N\364\333\367\211\036\344\373\254\352\315L23N]\216\347\367X\\\210\366!#\211\265\234\330\"h\003\323\234\263\344\322\f\304K\022\360>of\253TV\3758\033\031'\207\234U\355\247x\307\271\326d\004\0168\347\234\273;\333&\337M\355g\340\334\240\t\301Rq\235s\333\232wQk\305\351\270Q\213c\370=\276\213\3669l@\310\r\367\264\2479a\323\237\301\273F\b\256\334\323\230\260-\270\241P\315\017\373u\030\031\f\330\024\376\002F`g\316\211\342BC\005\277\347\322\217\t/u\357{\202\332\020\017 \031\375y\277\275\244\233Nw\347\r\237\262\323\024\260\273\2740Xp\301\204V9\221\305^b,-\027\331\013\006&[i]\200\271XZ*2\227\326\311"
+	.string	"\307Z^\262\326K,&k\251\276:6\357\342\020\n\0332k\223\273\363}O\331\360)\332/\b"
+	.ascii	";\310\261m\3156\204\323`)\220\004\023\260\302\332\363\216`E\017"
+	.ascii	"\334\235%OXr\020\036M\355\256\315jw\277\024\2444\243MV\355j\037"
+	.ascii	"\341H\022\3049'\212jQ@G\227\0213\301\245\0016 `\002!cX\036z\n"
+	.ascii	"0\303\323\bb\017\262j7\341\020\253Xfd\373b\033N\341\ri\230\353"
+	.ascii	",\355\372\201\034g6i\310\307\320Z\202E*\344:\247%\036\203\336"
+	.ascii	"a-\262o\240S\243V\313\336q`\367\3362\207$8\nNX\3310\202\026,"
+	.ascii	"\306\334\"\271\246\262\200\344B\300\002\340\206q\356j7V\021\246"
+	.ascii	"4^\235P3\335l\006\250\005\2741\343\356\204a\246I.an\332{\202"
+	.ascii	"\302\003"
+	.text
+	.section	.gnu.lto_motorDevInit.part.0.77.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\f\005\265\031"
+	.string	"V\251\233L\220\222R:*R0\315\006\"\366d\017qG\f4\267Q\004\001M\273\":\265\004\250\360\001D\025\001|\001b\377u\356\210\374)D&X\301\027\006\026\021\300\2563\273\260\020D\226\017@\360\355'J+\007Ug\007\225\322\337\215\354$\003{"
+	.string	"\203"
+	.string	"\216"
+	.string	"8\345z\025\3375\264\222\"e\343\211\262\364v\277\371\030\355\273\206T\232\331\351.\234P\006\307\335\240y\002\272\343\335\007\350\216\277\325\274\343~\201i\317$Z)j\346\245\227\247S+\232s\263\345\270\025\354\216\237\325\335E\246n\273\337\336\244\312\177*\035}Es\316\352q:\365\366\351\315\265\375\217\335$\331T\364\364\244I\304\257\200\347"
+	.ascii	"8\3109\367\356\351\215\337\3350\335\255\241\033\263\001d\001"
+	.ascii	"\2249/\305%\311P\330\354\352b\317a\224\2729\241ZQ\226\013\rG"
+	.ascii	"\023\345r\211C"
+	.string	"1\237J\320\214l\266t\3734\221\212Q\332\346T\217\357\365;\377\260\353\272\3377\273\r\366i,\312\366k\274\254\233\327>'\3534\215\354E\316\231\347\323\267\317U\354\313\370\363b\037k\336VX\277\300\024\017F\274*\271\310\b\030\361)\371\370\343\352\302\316Yd\311\306\017\370\3533\332\323\020\272)\031yL*\223\260{\307k\204\3212\021(\223\264Y\217k\231K\224\264\\\276\005\312\350\203#\361\035\211\316\320\250J\270\b/B\003Gd\302\312\242\204R8t\035\362V\301\227@\351f\341B|mAlpd\226V7_\303QK\303\220#\263\244\312p\0379hg&H5/ `\275a\355)\331\224Z9\033\237\354\326y\217\265c\272\177\347\301s\200*\347\034\243\343;\200}\253\343\356\020\274O\006u\307g\022;K\2220\336\270\233Ju\232{.\247Q\335(\275?B v\346\344G\354\001\252\371\365\354"
+	.ascii	"Mx\200\034\204\354L\320\017\002JP\250f\347\267\n\207\210\302"
+	.string	"\233\037\021\b\245W\227!\373\303\006U\342\360\027\004\034\356\250B\240NP]\207D\325\305@\263\036~C\365\207e\207*\357\271\234F\265\215\t4cz\3544M\245\356\210`\001\266\247\333t\235\202}\253n\247\332\252\373d[\245;\3067\326\216(\326\336RE\212\253\264\206H\272Z\325e\324\212\013bE:b\321b\365\226P-.\262\305\272\001g\250QP\205\230T2\022\210HZ\230\fc\360\002\021\"\2426\0210\2455\210Q &\005\345\353\370NqA\235\001\275+&t\300\350B\321\273\373\266\214\356\002\253'L\302\350q1\264I\\\213\252`\214c\256\024C \316\273\021\244\324\354\030\317L\221\337\274qy\2367\356\247\311\316\3754o\\\236\347\215\373i\262\303\027\021}\222`\325\334^\232^\342\317\351\343\343@\022\223\267\207\333\262m\333\260H\325\274\217Q\331_\212Z\204\203\363\022\257\277\307<\274\300\356"
+	.string	"\\yz\2659[\340S\310\271\300!\353H4\210A}i\024\034h\333ety\354\250K\376\200rQ\277>k"
+	.string	"\357I"
+	.ascii	"d5\240\335l\361\031\371\017"
+	.text
+	.section	.gnu.lto_motorEnable.part.0.78.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\275\t"
+	.string	"\326\021@8@\217\322\001x=&\250\360\177\022Y\370iy\264\001*\324^\303\214VU \255\354\327\333\223Q\177\371\241\255M\023\274\272(\020\246>k\354D\353\353\347\034l\177\023)S\n."
+	.string	"/"
+	.string	"1"
+	.string	"(\273\345\263po\222rA\213\331\335\356QaG]sC\371\227="
+	.string	"d\245\256\002,\215'\301\267\r\303\356\032`\343\216\267\255`\233c\037!~I\363xM\200\205-\031\207*k\251/\353\366m\325ek:3\375\r\207e\240\265\213Q\233Y\217x\362a_v\2629\356\361!\266O\031\0164\360\205K;\"\224\007Ss\245\003D\306e\245)\377\"\215\355\235DT\020\356\356\202?b1\362c&\315\343A\b\343\213|f\362c\246(\345\301\307\366t>\217\344\205\272\321\367\251"
+	.string	"}\017\235\004\310!\324y\276Q\3271\2607\361\371:\222\347}\035\367m\325\345\006\024\025\225\256\254\252/\333\251\366\347%\0201\025"
+	.ascii	"Fc\254\254\300x8JfPZ!\351WQ\202\212-\243\302\003D\3010W\270'"
+	.ascii	"&0\316\210E\235\323i\241\315\224\235\006\200k/\246\234\226\323"
+	.ascii	"\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`\214\003\265\r"
+	.string	"\324\022\210\004"
+	.string	""
+	.string	""
+	.string	"\002%\177+\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002&\177,\270\300\202\202\200\006'\177-(\177.)\177/*\1770+\1771,\1772-\1773.\1774/\1775\036\1776\271\200\005<7 \307"
+	.string	"\1778\360\372\2508\271\204\202\202\200\005\0279\200\204\001"
+	.string	""
+	.string	"\003\002\315"
+	.string	"\177:1;\316"
+	.string	"\177<\002\032\177=\272\200\033\177>\340\365\321\360"
+	.string	"\034\177?\035\177@\037\177A!\177B\005\031C\005\030D\002\"\177E#\177F$\177G\0022\177H3\177I4\177J\005>\033\0025\177K6\177L7\177M\0028\177N9\177O\001;\177P\377\037"
+	.string	""
+	.string	"\200\200\200\001\300"
+	.string	"\177Q:\177R\377?\177S\377=\177T\003\013&$\004\r\225\n\004\r\221\205\327\307\003\001\365\001\003\021'd\003\022(\204\006\004\022u\003\023\242\001\003\027\013\320\360\372\250\001\001\202\006\004\032\225\001\004\033u\004\034u\003\037*$\003\037)\250\270\275\324"
+	.string	"\001\344\006\003\037\017\260\346\314\231\001\001\342\n\004!\"\021\342\001\004\"\201\001\265\001\004$\225\001"
+	.string	"H\250\241\210\302\261RXNk\006\360\002\221*n\003\021p\214\246\234@\t\251h\302Rya&\032\362D\336\305\242\313\207\347\232*"
+	.string	"\272)\003\r/\225\255CD\341\b\357\326\211w\364\265\f5\255>j\352A3\276\020a\024\311\224\360\245\326.l-\276\263\316\274m\034!k5%\327i\221\263\251\007\034r\215\374L//Mvp\266\021\346Q\353u5\356Y\345%\353\261Q"
+	.ascii	"(\264\340\250\324q(\023n\221\273np\324"
+	.text
+	.section	.gnu.lto_.refs.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375 \377E\005"
+	.string	"\202L\"%\220'I\007\377\377\377\377\377\377\377\377\377\377\277\213\210\210\210\210\b5\002\373\377\277?i\273\265\326\032!\204H\231\002O5\304\203CCW\324i\375Y\236\f]@s\255\300\271\234\200\300\003\003\236\026\216\026\013\232 \340"
+	.string	"?j\201Nu"
+	.string	"\267\353\246xb\364\3448Rt\344\370\221\372q\334@\3358^\234^\034O\246\247\343\250\035\035?\354\347\270A\2729\336\243\3678\357<\002\254\021\265\302\227}\302\336\354\221\275\261\023\364G\004\f"
+	.ascii	"@\004\356\272\320\001Va\f2^\256\001\0239;\301\272)\202[\242("
+	.ascii	"\022\024)"
+	.text
+	.section	.gnu.lto_.decls.adda206c8522818b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	".\325\302"
+	.string	"\032&\021AY LIH\351\t\237\346\215!\221\373\002&R\253\ni\251\350\025F\352i\271\202ja\317\016O\034\337\250\271\222\332\"\223h\325s\303\3579\004k\311\372s.\277\025\367"
+	.string	"~M\017\363u\251\004\227\243\177]\347\247\240j\252\377\001\267k\372\274\330SHw<\016\025k\377\336R\246^\003\n\004,\004D\274\346\374\205\323\310\374'\326\370\214\220-\3134j\314\270\336\2560\232\377\204\rY:\b\023f\031\326D\334\306[\275z/\020-\334\245\211\370\006\216cgR\tUb\236(\232\210\341\230\031\224--\251\356e\216\030a\213\226\242d\354\330\270\255]T\234\2152m_\247\240\257Y\350\253\024\372\332\204\276\"\241;U\b}\237Ay\316\320\363\0313\034\270\025\240I\310\"\035m\313X\035Y\234\220\264}_A\371y\342\314\346A\227Lb^\235"
+	.string	"H\2412\326v\327d\350\007V\350\335Z\006\364\235\003}#\241|\201\032\364L\006=\237\241\034j@3`\017N.\343\251\2119\036\333\036\005\rp\313\261)C7,\303\304P\031Zq\317&\034t\300e\214\305[\225\271\334Aq\242\361|\3225\203\255\300XJO\210\303E\276@\264\274\227\211\205\315\370\nga-l\205\267\260\026\2271\225s\025\256\341\315\274\027y\357=s\375'\316eL\306R*S\354\"\207\270<\200iM\215+\267{\231#vF\354\232dj\214q\260\1772\b]\217\177\240g\033\350I\200>E3\340"
+	.string	"j\202\005\312^\034\205\2654\340\2573\024\346zN\210y\231mdM\227V\333O"
+	.string	"=k\240\253qq\254\201\356!\240\034\030\204\256\305\030\204\216\231\234\305Z\030p\363\034t\360ztr\255\356e\352\344\334\260\344\206\267\266\367\300\311+`\272\035\234\002\364\214\201\216\343\030\003\235\223A\350\330J\203JT\244\274\\\3672;\240H\262(Vm\317d\020:\224=\350\272\002\022\276\3241&&\240\340\345,\001\177\335\302"
+	.string	"\006?\253`\342\032\240\001\304_\213\374\354\2419\330\001\374\354\200\237Y\204\3208\326\202\276\261 \322Nh\001\302u\376\032F\201\367~\313\245%\320\2425\030\301\246\027\360s\223\212\026^\200\277f\375\234F\227\363\363[[k\323U\202\327\277\212"
+	.string	"\206Q\tq\352\003.\354_}=\375\327\r\234\377\212\201\n\374\346\267\271\237S\374l\001\025\307\371+\t?\247p\302s\376\032\245S\244\027\341\024\374u\355g\333\206\376U\314\317\037~\356\3603\210k\371_\303\377,\377\313\376_\351\020\376\376\340\200\377,\376\037\200w\376\312\343\371\335_\271\374\354\273\006\267\371\253\331\317S\272\001\0068\357\257C\376\006"
+	.string	"\003~n\361\263\213_\211\237W\370\031x\017\177\245\3627\b\177\363\374-\342\357\235\277A\374\315\341o\234\277o~\376\3627\372\263\363o\335\337\366\357\3769\356\3475?\277\375\234\346g\033~n\373\371\371\263\332\317d?\207\3719\355g/?\237\375\\\345g\032~\006\373\371\353g\254\237\257~f\362\363\222\237\225\374<\365s\324\317P?\317\360\363\221\237\215\374\f\343\347\f\374\354\363\263\001~\356\340\347"
+	.string	"\374\034\302\317 \374\254\342\347\022~6\361s\360g\013~\036\362\263\323\317B~&\301\317#\370\337\374\377\365_\304\377\023~\016\301\317.\374\334\302\317,\374\034\364s\372\263\361\347\342\317 \370\371\305\317\304\237\207?\003\375,\374\371\003?{\340g\001\374|\301\177\023\376o\371o\365\177\205\377f\377\t\020\027\027\027\367\357\230\377N\312/"
+	.ascii	"_F\244\322\372\262V\275U\310\216\223{\354\035%m\300Uq^\302t\025"
+	.ascii	"\362\327c\025\252M8\312{\221\234\324aF\252meJ\363\234Q\346\f"
+	.ascii	"z\024/<\214\235\\\274LR\227\252\214\232\003\006\236\221\022H"
+	.ascii	"\375Q}T\245\032\244*Y\253.\375UG\335\301\245.\325\244\332Cj\355"
+	.ascii	"\331Mu\251\"\037\326C2\257\f:5\346\233\233U]\252C\375\324;2\357"
+	.ascii	"\221\356\210\330\210\021;\274\245L\2162={\326\272Z\345q2F\260"
+	.ascii	"\350\270ZC\277\033\2036\017{\320U\034MeM\006\264,(R\275\301Z"
+	.ascii	"\025\206\032\343;\314{\277\210j\215g\226\nC-\252\311\233(\316"
+	.ascii	"7\267\235\021#n\324\\1\033\323%\353Q\030\026\016*m\253\r^\021"
+	.ascii	"\024\031\322\022\325\252F?\363\336\3136\240^0\223\241F\245\021"
+	.ascii	"%\t\256F\327\031N\235\234\323V\020\267\266\3375\241\337-\241"
+	.ascii	"\337\355@\3712\b\335wE\350w\027\275\256\f\372\241\231b\320\033"
+	.ascii	"p\204t\200q9C\341\230\315\017IJl\2241\231<1 ]8\3322\255p\216"
+	.ascii	"\216\214(\323\270\335\240\361\nC\266\315!Y\332!f\303[\022#H4"
+	.ascii	"<9i\320\206\250\332\236vL\2524q\235I\202\343\205&\251e\006Kw"
+	.ascii	"t\205\006\254\f\223\336\231\254*2\330\266tP\202\274\025yv\355"
+	.ascii	"\276\226Y<\326\272\350\324h\203\243A\246\241\330\314I\016\"j"
+	.ascii	"\030\3500u\030\t\031#\206\237\312\035Hb\302\344LA\342\243\254"
+	.ascii	"-\030\233\354R\232\212\202\236\233t\227\326\322g\354\344\272"
+	.ascii	"BH\037@5\221\"\335\245\217\364\225{\003\001Pw\355\351\366\244"
+	.ascii	"\251\237\330\231t\217ex\240\226A\272K\307\3204#\255O\320_\332"
+	.ascii	"K\243\261Vwi\2637\226\316\262\223\003\023\206\013\032\034\333"
+	.ascii	"[\332\311Z<\315\345\315\304c\267A2o\363\347\004\205\006'\350"
+	.ascii	"\231G\247\303<\272\353\226\250\356:uLh\231\016\\\321\021\264"
+	.ascii	"\266\327\341@\317V34T\357\330\341^!nU\332J\2035\r-\326TZJ\207"
+	.ascii	"5Y\217\365\024\326\352\032:\312\333H\313\360\235\016\362u\224"
+	.ascii	"\\{\272"
+	.string	"q\261j,\346\332\323\215\252\227\234kO7'\275%\006\306\253\241D\f\021\225@\265\345y\342Iw\355\216\\%K\232\211\330\332\223*\253\231\350\324\224kO\267Fb\202N\"b\210\350Z)\317\265'U\r\315l(v&1\357\215\235\321r\355\351\226c\322#\313i\307>\267\206>\307\005}\316J\027\327\330Y\214\031P\336\\\017\343\225\225\205\035\311em5\005\340#\212L\353\335d)d\3161[r1\240\3175\241\317\371\300\352&Y\320\236^}\365n\222C\205G\022\037[\271&4c\302\212\230T\211P\246\310\251\252\237l\240\242\232r\027\275U\203\232H2\2656\303\312\206\324{\352&\314\020$5m;\252\036\211\275I\261\024\213\025\225\364\304\206\376\r\265\264]<\2104\275\355\275\314\235I!\361:C\3174CsL+T\320\333.\364\\O\335N=\344\375\324B\316A\007\307A\366\223\275W\210y"
+	.ascii	"=\346\001\344\250\034\021\322\322\331[-\364\226\tj=(\227\324"
+	.ascii	"\230\232I\226\200\364T\034\263\350\307\033\310\311\340\334+\202"
+	.ascii	"\333bX\205\265m%\336j\036\314\031\317\266o{\030O\201-\361\362"
+	.ascii	"\321=\204B\314\316\264\345\301\344!mQC\243\355\355\021\364\314"
+	.ascii	"\265\243\221x\213\235I\r\250\202{&\265\216\316\3217\032G\303"
+	.ascii	"\300Z\275\243m\274\217:\211\342\354\255\006/,\245\227\273W\251"
+	.ascii	"f\211\346\366D\321;\030L\033\261\223\210\305\262\366l\262\203"
+	.ascii	"O\300R\330I\004\002Vi\236;#v]\324(Q\322\263\267@\320V2\b]\001"
+	.ascii	"l\022\355\242\235\033d\325\022\2278\364(\304\200q\3032F-\355"
+	.ascii	"\330C]\243g\264\214\026jd\323\350"
+	.string	"\030\375B_\326\352q=Tbp\333\262c\207M\322u\035\321$\331!j\256\302\330\244\2634<\224k\256\320\0337l\016vr\217>@\0051\223\344\301\301Rsveq\334\346\310i\333r6\2610\350\264\034\301\251i\013g\203f\346\007W\333\367\216l\330\260I\f\246\302\236\316\350\260G\267\311\207\365\030\215\033O\325\253\253 \351jRST\324MP^\312z\242\242\342\221]\254/h4htU\t ~\334\020\021\342\346\254\301\022Y\242\233\345\221\025/\257\0301\030\t\351\211\212*'\2068\266+S\026i\221]UB\234=\"e4\001b\217\366h\205\266\314\236\310*\347U\333\013\235\335"
+	.ascii	"s\333>'\031\027\367d\013\354\311\253\361\025cM\2325k\232KDY\357"
+	.ascii	"\rL\032\234\363\355\255\237vn\025\303\366DE\205\023\005}?qM\243"
+	.ascii	"U\323\364\0233\357\321\316\350(\266\301q\250l\260\241~\241w"
+	.string	"\207\n\022\316\024\330Y\024'\264L\231\332\366a\t\027]s\006\251z\346\265\215\214\230\322L\325\202$\213\314\255\333\2160i\240i{\234\032kk\365IA\227\"O\036Z\232!W\317+9,\345\221\f\2701c\252\232\rOT\326\016\207\016\241\031m\325x\256\244\314\220\021\023&\314\255jA\236\250\250l`@\"\303I\026\264\232\206\326\313/_zi\201\0176\264\210Lhm\f=\257\tz^\302\325\313Y\253z\35106\037\254aKnp\036\022+\225\213\225zV\317\312\312\252\323\002$.9-\267\250-\257\316\233/g3\256m5\253Zn\302z0\241\264d\341\3210\205j\bK\027\365~\260Eaa\34156GK\037nm\353\025\226\322\373\321E\225\203\027\004=\317\250\212V\255\322bv\230\367\006O\314X\222\271\301yG\261J\203X%\323\335\313L\345Qrl\254\222\241G\016\203J\342\341\025\311"
+	.string	"\353R\247\274\222m!\002\3532\203\376F\013\330Y\253\202U\"\355dT\343L.\215\f\246%m\177\303\225\225U\277\246\330\222<\177\215\362\372E\006\247\b\225\267\244\266\025J\365j\363\242\364\344\325\225\363\361\225\374\302\203I\002\245\232,\\m#G\307T\330\223\207\361\312^@\202\326\266nq\r/2Rmk\223\247T#\362\324\266j\035\354\246\f\254-G\333\352\344`K\234\330\240t0\024\252\312\214$m\177#\205\205\325M\257!Qnx\\]5\027\224+8&Lz\271\344i\023f\311\222^:"
+	.string	"\312\221\247\235\372B\223c\212\022%=\325\313\035\224!KO\346\324T\003\3311\203\304?\306\314\200\202\212\212\352\252\017lY\273\036M%#mo\243\004\005\325MLl\031\263\2311\303\f\275T\300\026$\267#G\272\212\223\356\221\315D\226,\034<G\323\320\327\"5\206W#7\322K\364\336\273\223\345\370D\345v\223\224xzeLqoU\350\317\272+\224\274\367\336\3101or\bG\3079f\236?\207+\023\340^\236\224y\205\236x9\203F\205\t\371\310\340>\347\274\027\311t\204"
+	.ascii	"\023\022\222i\007Q\223\351\036\221H\216\035\222\227\351H\324"
+	.ascii	"\274\267\303E\"\217*\224\267\003Q\363\"\335\027\316\220\3702"
+	.ascii	"\231\216\027\251\274\035.\362\ne@\204dB\"j\n!u j2!\335&\323\345"
+	.ascii	"p\221B\311\031\310\233\354p\233Ll\267\251D\342@\324T\"\0215\231"
+	.ascii	"\210\360\222\031M8nlyq\242\301cD\310k\303HI(\311\301I\304T\336"
+	.ascii	"\264{\231+\306M"
+	.string	"\022\340^%e2Mh\007\213\r9m\f}\t)-0\032jR^\244\223HJy\257\324\320\3175R\300\221\351\274E\330y\024\242t\213b\334{\201\321\275G\276\316{\357\361\336\273K*1\357\355\301\201hidto\322\216\321U:\216\305\270\267\271\302\210!\0215\233\224'\306\2364\227W\006\363\310\313\233\306\224D\233\307\254[t\357e3\350\022\t\2062m\353\220\335\021)UP\344S\025\322\026\024\374\207Dj,\001\374\005\t}\303`\211\2421\250D\b\2410h8$\016wi\0170\004A\243\016\006q\270k\341\003\024\332\024h\004\002\002\351t\214\277!\321\0074\022\213\276\240\t.\370\b\201\277\016\377!a\f\n\205A \335\177H\224\360\001\213A\251\017\260\005\007\025)\320\305\207\0258\037B\344\204\330\371\360\373\200\017\370\343\263 \005\222\320\363\005y\024\340x\340\345\230 \221\026}^\220\020\n#"
+	.string	"\004L\215.\250"
+	.string	"\302\230\016\203\304\027\277\341\b.\210B\237\241\217\207\013\200\210E\t\244\020\241\302\n\025\fWt\300@o\205\017?\343\n\nt\356\023\n\203NH\341\276`\0218\004\272@\257"
+	.string	"\017\022\340\301\007-\354\376\001\b&@0\241\373\007 \2348\001\202\007'\320{p\242\246iOZ$\246"
+	.string	"\004\343\205N\332\203\302\nK\fv\332\223\242\330\373\017\tb\017\020\214\027\031\264"
+	.string	"\252"
+	.string	"\276p\201E\217\t+X\360\200\202iM{,\220\"E\321\347\253B\340p\350\363\343\333\001\205>>\025n\214\302\240\027<\030Da\213\"\220\005\024\200\276\"\261E\216Q\227\366\030WH{8@\221\246\250\321\004c\017\320\027d\001\250\342?"
+	.string	"\030\302 \376\322\240\037#j\354\271@p\270\"5\022_\240D\026B\237a\021\230\2660\002\221EJ\364\205\320\031\203\277\335\b&\030\203\275\264\350\223\252\300\313\245\303\025\3004X\204\201\002S\240\360\005\0201\0050\365\371\275\b\352\261`A\347\313\375\200!\b\n}\202ip\030\344\t\211D\021zr?\240\260\003>C\340.\035\006\021S"
+	.string	"\205\304\024z9\351\177\\\274\b\341b\030,\002\177E\"\320\002i\320\2134\b\005\020,"
+	.string	"U"
+	.string	"S\037\013\340p\030\022\203\303\025@0R\350"
+	.string	"\004#\205\037\3207t\3018\\\001h\f\352\245\306b\220\b@cP\216\013\305\024\b\004\024\002YtH{vF\027>,\210A\235\220\350#\246\304b\ni\221\370\3028\364)\262\b\241S\004\002\005Y\374\200.\206>\035H\203\"\244\304\037\243\n\2401(\004\013\300_\005\006\t}.\220\002\215-Z\240"
+	.string	"\024\376V\b}\322\240\213\340/\3040\b\304k\301\007\210\367\033\372"
+	.string	"\001\021}\303 \320\315\177H\030\205\304b:$\372z|\305\022\276\026\"N|\001,\226H\211\304b\t\236\261\307E\260\305\220\230B\005\212\364\307EP\330\202\003\f\242\260\247\363C!\364)\246A\300\241\rP\230\246\304\342O\332\363C\361\033\372t\340\347\003\374y\200A\024\362\322\036\017N\240?.\202?=?\024i\020((\304I{>H\207\301\240\335O\234H\221\301\n'\220\200\372H\024\211)\021\250\204\261\bd!X\374\225\030\006}\200J\370\212\306\022$.\370\241"
+	.ascii	"\376\210@=?\340\217/\r\3020\352p\331\244j\0266\245\004J=\263"
+	.ascii	"O,\221\033-\245\325\321n\331*'V\\\221f\375B\013\322\274\241\255"
+	.ascii	"eZ\246u\3027I\006e\263n\235\220\351=\375\330\262\241E\310\313"
+	.ascii	"\023\r&XDv\314%M#\266\211\315\241\223\246t*\262W\225LG\007\026"
+	.ascii	"/d\326\312*\335Pfk\254m\f\267Hb\260U\025\215\2317IY\273\200y"
+	.ascii	"K\262r\211\222xxY5\262\270L\335V\335.\341\240\203\253\241TI\320"
+	.ascii	"\204\332Z\252[%IY\246<\223X%QNM%J\350\023\200:\321\201\204\324"
+	.ascii	"\326J]\255\245"
+	.string	"\324\212\330\332\332\250SI\372\3426\304\004Z\232\272\f\265\2653\330%k\335\314B\2757EF\227Y\016\364%\340\233\351\254\f\267G\246"
+	.string	"qb22\362\333\354\274\320|,\333^\207\b\275\316\021\b\020K\344\346H\354\315\315-\267\225\004\247E\310-\021;\344\222\215\355\030\362T\317\226XV`\256N\324\f^\224\254S\233\351\230\265aU\265\265Al\223\215\223\n\f\224&\313T\205\003\214m\227\366E\b\\[\253d)\275\345I\232\227\266v\211\267n\260\301\003\371\204C\343\006\031\020\266\036=\254\022s`\016\215a\362\354+\250#\234\217[\245\236\025\225g\232\016\2044\250ss\244\211\250\354\030RL!\031!I\322\2441\023\025@@PL.\030\217i\363\023"
+	.string	"\024\351C\302\222\246\250\246&HRPRH\007\263\367\201\351 \227P\371\326\374\247\200\363\372\222\001^\363"
+	.string	"\003H\364VLs*\3261\211\201\307)\306B\256\025\243\274{\355\253(:\005\350Di`k\327\336\n8\237\205\307\261F@\273O\364\255\263\305\263gO\306\234\031N+\213\311\373\234\247j\203\002\262\215\372\202\222\037\022\333Cz~\337\007\260Kn5\222\206\307\223O\244\230\223\224\207\337$\334\357\241$\302\274\226\277_bD\35312L}\212f\315#{\302p\360\245\344\204\300\001b\034\361\035bZ\264\001\217n\026\300CDK"
+	.string	"\202\023\007IC\2154\220p-,~s\007Ev\313+\370D<\200\235\315\307\307\025\202Z3v\203\217N\255\3763\"\004\307\250\207\373\377Y\335\034\243\"\241\333'I\203\224l\030z\021\255!\353'\345axRb_\321+\302\236\263&\226\356M\236\030\346\260\373-r\344\311\363H4\210\331Z\201\263&Oll@\237\205\206\2047q\300a\203\027/\263"
+	.string	"\252\244g\307e\005`S\313\353c\224\004\013O\270\035\314%\343d'\025\027\277$\200A\271\316\351\317\303\334'\213F\205\201G?\370\347a\364\033\321\254\362k\212\214%\266\202^$\005H\301\246W\226D\274 \266Zk\"u\314\307\321dt]-\363\206\177\227\250\222\214\200\276\2545\340\367dy(uRm\337\"\365\277\026%5\315\266\221\236\306\016\002\246\243\032\251!\274)\002\335;~Do\231\240\340|y\006P\214\f\\E\274\030)]G\251\326\355\367cGP\b"
+	.string	"\254)\030\211\260\212K\254\324\313\2602QU^\257n%\201\256w'%\001\004\262\275\316\313e\nT\311 *\272\216\202\371\315aA\345\277\336\260e_\374A\311\032@1i\235\330x\250\310\235\003n\250s\217\311\023\322\304/\247\210\030\205m\017\361"
+	.string	"\205\311;\361\225\004\265\202\362\215\321\340\037lD\3765\323\n3\203?\320\243\325\256\370\247\377Q\323\212\223n\265\0251c*\242\355KARe\2320#\003Z;\346u\377%\201.R\3461\353K7\275\005\0217\354\325\023h>\221\375\267\327z\354\255\303-Bp\034!\336\312\357\225\222\221\223>n\371\240"
+	.ascii	"\372\013\231\303\334J\336k#\241\337\300\321\202\235a$\016\353"
+	.ascii	"J\306h^yk\323\344\246\242hh@\315\"\320\354z\035J\264\242z\205"
+	.ascii	"\307\373\320\244\251\261\244\316z\366\330dnM\303i\016\b{\274"
+	.ascii	"\220pt\363\320\032\237\013\024-H\373\325\212\357\256UO7\033\023"
+	.ascii	"E\225\253\b\221\320b\310\353\231ykp\204\202k\226\344\343\315"
+	.ascii	"/8>X\373\267s\370\"\305\204\002\246\274\244\255U\"_\252+\242"
+	.ascii	"#E\267\0019\254\250\217\240(~\t\326;\232\274\326\205w\315^}r"
+	.ascii	"Ms\3610)!\245e\340\300\021\232{\262\311\007\323+\fvu\212\027"
+	.ascii	"\215?"
+	.string	"c\313Z%|\204\212\277s\272\364\013\373L\225\324p \027\204\301\337\360\260CI\235\315\231SdK\351\361\023\377\b\257\n\361\323\327\242P\342\001\364\343\342Mk\036\213_A:`\366\311\220\225\357WjC+\350=C\264(gM\250 \237\307:\337\354\313\227f\026CW\n\312yf]\313\">\222\314=\327\026uX\025m\311\362\326 -'\344\367\333j\3553I&\371\222`\226\277q\321\237\003uI\316\277&F\333=\373KX$\"P/\036C\003%k\364I\233\354\367\\\003\244\352\356\341%*4\"\313EXj\336\022\266\230\007+\323{\323\\\013\356\315\220\003a\225\307y\325\311<+\324\266\304\t\214\214\005\266\235\343*\200$\235\216\013\311\224DC\245\237\207\250\355\311\241F\204[!\331\036\256M[\370\366=S0\276\034a\341TW5v\363\244\nC\272)\r\025<E\250\362bLHf5\366\301"
+	.string	",\243\200\303\351>)\327\037]\013\344\323\351\311\025\227\007\261\246\r\374\334\b\232\036\364F\206\261\345\234\003\3444}\310q\215a\265_c\224\253\334\3145R\276\202j\354\353\243eu"
+	.ascii	" "
+	.string	"@4\207\221\013\303\t\275\312Y\266\304\352&@\274\334s@\033\337\2158\351\372\221<\263\314\275k\342\374 \025)y1\372x7\217\375\013\332nH3\200\257\230\376\343~\001\211\373\007\373\356\247\256\223\220*\234mF:\211GZ\330\001\320\264\264\212\3609\340O\034$\235k\263\204\037\304\177\330&2\246A\005q\300\227\340x<5\303\036\252s\301\335\370g\245\321W\373\260\013/\270x\206(4j,6h\t\354\327\234f)\274B@z\252j\005\262\271\005\373|\005q)\374\3625sk\354\n5F\272lT1\017\002\177\017I\264p\200\231J\t\224~;+\250\f\366\r-\367\214\0056\367\312\344\230\b\036\201.B\322\213G\305V\243\331\277\002\016\257\022\304\b\305d\361]Sy\206\n~\240\355\031\006\272\331\266|\210s\277\212\376\377U\324\367\337\203\004\240xT\237\036\253{\326Mu\236\212\266:\005\206\202\226"
+	.string	"y%/#\237[\366\260\250\270\236+my\213\207\367\315\r\275\335\256\325H%\363MV\3635\204\374\3220\352\377a\263[Q\204\213\200\313\313S\305:w\223\345\240\346T\252\023\b"
+	.string	"\020Z(-\313\310l~\277i\005G\314:4L\357\360\214\316\334\277\205\374\220\327\320\353\316\r\\.\211\365\260\325d\272\216-\341\267\276"
+	.string	"\212\235\2428#\364\347\0326\275\351\231\374\003\026\f\330\377\332\027\351\024\355\256iQ\351\027>\371v>\301Kk!V\274\254e\262\006\006\333G\0051\333y\220\003z\204}\3415\006|&`\230\330\017H\276\005\241\242\027\226P\300\223\033\bY\"y\001H\203\362\r[\321\302<\035>\255\360\034\n\247\253L\035\027\271\362\036\357\004:\300T\036\020\326r\307SP\003|\367-z\245}S!@YF\201-\350:\351lQ,"
+	.string	"\347\254\024(\377\206\220\212\350\271\330\\\243*\342\021,\231\001\220\310l3\204\225;\261;&d\033\\\342f\343\321\341Ig\234\230\340\371X\217\264\222\354%\367\322jW\310Q\237\031?\315y\350\306Uv\241\376a\336*\314\022~U\214\021{\203Y\350\317\243\331\341\257\365rb\274\341R\324\325yv\3661p\215u\300\221-@>*\337"
+	.ascii	"2\3479\253\264d!\362\037uO\271\227\004NH\216\027\271]\250\362"
+	.ascii	"\226\352\372\373\271\335\270\312\177+\026\350\257\321\265\357"
+	.ascii	"\346z\306\271\327}\216|Z\336\365g\274\367s\371\347\364y\300)"
+	.ascii	"H\226\202Z\ntD&G\b\237\247\223k(\375\377\3705\330T\323\315\276"
+	.ascii	"`\036\243\320\030\223_\317\327"
+	.string	"\336\227\255gX}zs\234\275\333\361\265!\266\b\374 \302\237\245-\306\001\331\205\377j\276\305u\346\254\354\332\334\235\300\375\347\013\354\267\224]\357w\222\207\311w\342\264\201.\007\233\377\013\375\217 \203\211\275\267\177\303\\\261\323\376\253\220v\351~\344;\331K\035\372\225k\230V]w/\371\376\273\2211\275cc\250\025\006?t\273\331\013\223\372\346\201\374\253\2761\372\243\350\007\317\214Q\307x\335\351\214\332v\312\246\261_\316\007@\377\244^\200\362N\317\355\327\247\344\210~\307\316I\250\177\345\327\364\013\376C\367\033\207/\246y\323r=\230\177\030:\264X|\257\001\027\352\005\373\221\267\256}\301\267-0\333\276Y|\340/}\250\243\237\277\253]\"\316"
+	.ascii	"\\\207y\267\0350\342\267\346+\202\354\324w4\3035\377\316\202"
+	.ascii	"kz\232}\347[DS\332g\372\223\003i\267\222\314w\005"
+	.text
+	.section	.gnu.lto_.symtab.adda206c8522818b,"e",@progbits
+	.string	"motorPostInitNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"motorWriteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"motorUpdateCompleteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"motorDeviceCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"motorGetVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"getDigitalIdleOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"motors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.adda206c8522818b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,198 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\334\371\344\220\007"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.707f52e1d80af916,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375`\312\r\275="
+	.string	"\252l\b\03040,7\007\0030\314\034\266\340y\177\207`\230%X0+0\373\346\323\275Z\005\261\340\234Q$\302\336\336LQ\333}\031\324\270\001AR\306o\244\326\262\311\224dy\001~\001l\001\037"
+	.ascii	"\241\276\350\325\r\332\256A\3641\372\233\253\313\263]\213\351"
+	.ascii	")\372\233\233\355:\304\035\242\303\351\302l\327ct\212\016\247"
+	.ascii	"#\213\223\346\220\\\335\223\355Z\304\2731:\2447\217\3705\250"
+	.ascii	"\307\271Y\326vM\002\r\232\307\275\271D\031\237W*\311c\306\264"
+	.ascii	"]\233x1E\257\224O\270\246\313\271f\3441\033\332\256Qt9]\356\375"
+	.ascii	"\263]\247\320BtK\256\234\355Z\305_IsKoV\263]\257x*\247\317\305"
+	.ascii	" \217y\314v\315\342\243\020}\356\315-\376\270\346\232\334,e\273"
+	.ascii	"v\361L\210\256\351\375]\207>\t\232or\377\025\242]\250oJ\311\343"
+	.ascii	"\233J\204\213\350\234>\223\242Z2\234\323J\036\337\215M\326\231"
+	.ascii	"w\242A\036\377N\333\253\032\336\311\006y|0n\254\214.\312\375"
+	.ascii	"+\213R\021]\324\373K\030\231\"\372(wV\243QD\037\365\232r\004"
+	.ascii	"\212\350\244\334L\217:\2419\2517\356M\023\321K\271\211\340.\021"
+	.ascii	"\275\324\313\007\222"
+	.string	"%\242\253r\337\304Q\"\272\252\267%\217.&R$4_\345\342 \217~E\022\\\321W\275:\310\2437\231\344(\315Y\271;\310\243\021J\213\214\316\352\355A\036\325*\261\375\360V.\020\362\210C\016\321\232\267z\207\220\307\033\226\n\021qYn\021\362h\3169\202\235k\354\202\216\364\3124\032\023HW\222$G\227\342\032\ty\374\355\032gL\030\367D\005\271L>\223\321d5yMn\223\335d8$\262\234<'\327\311v2\236\234'\357\311|\262\237\374'\007\312\2022\241\021\331\220\b$\202\034\034J\002e\211\013\234\013!!\004\3015D\036yr{\320\032\2047\322v\375\200\326\"\270\217\266\353\334\347\214\360\262m\327:=\247\004\227\247\357\254Ixwt\326.\270<\236#\330\3051^x\341\3547F\f_\231\r\212\341\345\365\322\0303\360\250l\327`f\212\031^\236\222\355:,\217)\356\035\255\355\032"
+	.string	"\230s\277\255\266\353"
+	.string	"^N\017\356N@\336\362\303\303\356\322v="
+	.ascii	"\013\332\207\035\334vM WI\373\320\266]\027\220\202\202pw\006"
+	.ascii	"\236\030A\274\273\003\271\211Q\314\335!\310JP\261\235\231\355"
+	.ascii	":\001/t\304\316\313v\255 W\332\210\335\002[(\211\235\223\355"
+	.ascii	"\232\301,#\211\267\001,\264\204\013k\273v\320\n-\361\236\332"
+	.ascii	"\256\037\250BM\270\236\266k\b\247P\023s\333u\004R\305\025o\333"
+	.ascii	"\265\204P?V\274\232\320v=\301\223\221\205\253\365l\327\0246\241"
+	.ascii	",\3368\333u\005Lh\013W\243\331\256-\314\245\265\270P\251\350"
+	.ascii	"B[\331\2561HJs\241\217\333u\006HEgssm\327\373\221\321\331\336"
+	.ascii	"W\333\265\006F>o\323\205\332\2567\264\255y\333\313i\273\346\220"
+	.ascii	"\b\315\335\\\335\244\355\272\203\2414w{\035m\327\036\006\255"
+	.ascii	"\371\"]\333v\035m\252\372\312zXx\306\303A\032\351\017\b<\023"
+	.ascii	"~a\263\240\257\214=\313Z6\205\261\376\002\340\037\215U\207Ys"
+	.ascii	"5\325vU\201\353j\252\302\241\331\236\302\265\035\252\0130\016"
+	.ascii	"\020E\034jk=\200\024\325\304\200\250\025\205\244\251\345\020"
+	.ascii	"\343\221\206f\024\303\241\006D\fD\004\334\303GQM,H\217\036jb"
+	.ascii	"`\270\306zV\326\256*p]MU84\333S\270\266CU\001\366AN\310\r\371"
+	.ascii	"!O\344\212\274\315\335\234\2217\362G\376\346\220<\316%\371$\257"
+	.ascii	"\344r>\347\257c\362L\276\3119\271'\377\344\241\\\224\223\362"
+	.ascii	"R~\312Q\271"
+	.string	"*_\345\255\334\225\303\362X>\313i\271-\277\345\271\\\227\363\362^\257\344\227|\223w\362O\036\312K\371)_\345\255<\226\317\362[\236\313{\371/\017\346\303\374\230'\363f\376\314\247y5\317\346\333\374\233\207\363r~\316\327y;\217\347\363\374\236\347\363~\376\317\007zAO\350\013\375\241G\364\212\236\355\335~\3217zG\377\366p\037\367\221~\322Sz\271\267\364\357_\372L\257\3519}\247\377\364\240^\324\217\372Ro\352Q}\252_\365\254\336\325\277\372X/\353i}\255\277\365\270^\327\357\372^9I^\222\231d'\371\230\241\344(yJ\246\222\255\344+9K\326\222\271\344.\371Kvs\230,&\223\t\3304\325\027\032\2434\204:\214\n\205:\254\246l\212\356p:C5\327\235\016\227?\237\016\263\254\257LU\317Jvh\222\370\\W\265-\177\276/<d\207j\333\303fge\346\317\314\354T\331"
+	.string	"8\205Q\232\255\352\013\246+\030FMv\255\261\2228]\317sM\321/\f,}\277\265-\311N\022\363p\214\362\207\226_8\304\030\231\210_\233\236\277\265\367S}\345o\r"
+	.string	"c\365\001_|\341\265$\361Z\222\2775\345\341\265\207W^\r\263\036.S\363\013"
+	.string	".[\317t\230-M\326\374\201a\325\024\232f\031\017\377\326T\207I\254\232\254j\316\b\236_Xx\252\354\332\376L`/\025\256A\237\312\206a\325\244\221\n{x-y\330\307\372~_Cv\006\211\327\262]W\237\020MK0lv\006\024\266C\025"
+	.ascii	"\006\372N\325\\\313\325\354a`\252\262\301\264l}\252\211\372J"
+	.ascii	"\001Xx\206\236\354\016\253\346/x\2760\315\202>5\f\363pz\006O"
+	.ascii	"\341\016\007Oa[\256h[\266\236\205\341\264Du\370\027<\313~&\020"
+	.ascii	"\f\263g\3604U!\211Ovh\206\r\331\0038h\266\276 \020\001\006\232"
+	.ascii	"k\313\006}m\210\020$\310\3122\001\216\001,\277\306\306\306\306"
+	.ascii	"\306B\214\221\211H\3170\274\226d1\312d\200a\025X\016\003\201"
+	.ascii	"\026\25014\243\254\207\"\n\n\222\244PX\326\021\206\210)2\255"
+	.ascii	"\003\021\360\020C\221\334:\006C\b\252\361Y\320\350\016h\020|"
+	.ascii	"\332\217Zf\0171\277\033\r\036\nc)t\264\363\342Od\255:\037\336"
+	.ascii	"\022\216\020A\302[\361'*\3049j)\201J\301\226z O\215\0204\320"
+	.ascii	"I\360W\306\320\341\352\337\336\270\235\224\257\224L\3046\026"
+	.ascii	"d.\003\347\r\251\341\276\352\311\271/N\354\364a(\226\226\255"
+	.ascii	"xzY\203^\244}\223^\340\035\020S\363\0130\031\007\211,\237\217"
+	.ascii	"^P\332\226W\314c4\251\373\314"
+	.string	"%gppks\375x8\215\251\355\274\226\235\374.\255K\214\206\3339@[-1Y}\021v\022o\214\223NVL\027MP\324\r\203x\374\254\017\0362c\302\262J\253\336\334M\356\333\317\313\345^\345(\312\310R\377/\324f3\216\374\305l\251e\371I@\307\330M+\341\344\314\247\226\276\354vKp\316\bq\247\2341$\354]:ov\206\246\357m\3628\277\2519o\332\231\342\031V\037\341?O<\316\206\0265\r\327\374\350\246\244?\336\311\354\353\004\307j\272\307\331\242\035)\332\320\024\256\332S\227\244\177\323\376\036\276\246\264\363\215\333.pxU\351\314c\325\317\274\035\365\217z\021\303'\213\327\300Y5\255\377@\"\347u\001)\f\364\377\325\264\364\237\322\357\213\220\234=\322\267\257x\277dL(C\345\313&\370\3303\327dx)\302\223\224%)\013\211\242,I]\222\262$e\021\3546 `\202\300\274"
+	.ascii	"\006\3007 6 \007 \376\206\241\025\331_pQ"
+	.text
+	.section	.gnu.lto_.symbol_nodes.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.707f52e1d80af916,"e",@progbits
+	.string	"(\265/\375`\316\007}%"
+	.string	"\312F\270\016E\220\232\316p\002\372@\203"
+	.string	"\322\034\007\225\376i\t\325\023\340\265\202\214\200)E\331\353[\226c_\233:\324\357\032uZ\233\257\362\326\210\004F\236\245A\314\\\365\251V\261\277\362\313\007\264\275\315\254\314\366=\222\310\224\002\262"
+	.string	"\344"
+	.string	"\334"
+	.ascii	"Y\177\342\b\023\254C\321\344Lr\236\347\263$4\235'\320\263|s\347"
+	.ascii	"\t\344\373\025\374\n\326\352\251j\213\\K\330\235h\372N\354_\275"
+	.ascii	"\311\217,R\"\236Z\347y\372\024\207\223\267\243\256\211/\311\235"
+	.ascii	"\230\275\304\002\316\316\t\326\33198_\2226\304\377H\353\316\266"
+	.ascii	"\024\373\n\354'\260\177\300\276\001\373\005\354\023\260\037\300"
+	.ascii	"\376\317\276\317\376\216\375\236}\236\375\033\373\244}\265o\264"
+	.ascii	"=g;\3166\234\3556\333l\266\325l"
+	.string	"\227\261\235f\033\214m4\333g\266\311l\217\331\026\263\035f\033\314\366\227\355\005\366\227lO\261}\333E\333z<\036\217\266\241l\363\3307E\002>\264.7\037]\320z\247\231\324\231\256\217f\237\313\317t8C\311\214\256\327^\222;e\246oV\245U,\352\352l!cr\212b\241\353\223\331/~\354\t\016\327\024\325\232n\202\227\344f1}-\025v@Y\351\352\376\303\"\246jO`s\272\276\230\375+\017\273\231bf\306H\367\004\274L\337\312\256\211H\221\247*`:\2461bBt}0\373^\377z\326\006\033*$.8\335\033yI\016\370\217<\227\351w\351L\361 \322\245+\340G~$L\216\344Sp\204\347\t\003\002\333pH[\334YD\243\201N\211\n\343\221\224\034/+?\244\210<%!\225%\272\376\226\375$W\362(\275\246\363\f:\317s\300\256\253\211pJ\327~\224k\351\204\303&\""
+	.ascii	"\037\022$)\036\304$8_rC\222t\217u(~\302\241\035#2\256h"
+	.string	"\351Z\207\354\037U\005\024,\240.\272\237zIj\220i\025\332\255\t{\241C7\200\246P \253(\250!]+\220}.E\301\273*\233;\242\373\037/\311\037M\353\351\253\341\003\205\222n\271\306\270\213!t\265\244\353\033\355\313}N\207F\020\250(]\233\275${o\246\257\306f\251\350\264#M\\\357\212\350\350q\366\337\016\027a\250#\207\256\261\274$ygL\337\2154\"\224\263B\323\306\023*\032\023\322\365\333\354\2379\033y\254B3\324\265\327K2\347\213\351\257\361\202\220\266|\230Q[\267.dG\272\276\232}2/\343\205\213mJ\227\302K\362F\214\351\217Q\"%\244\322%\303\244\331\\\t\337\266t\3754\373_\016\246G\225tT\246k\255\227$\316\225\351{\tF`\037\021=A\340\b\037\237 \220\027\344\340\201gm\232\026\022d\300pa\307\363\240\207'H\302\347\247'\b\374\t\366\224\370\020\354"
+	.string	"\f\361\201\003\b O\360\007\370\340\300O\017\b\016\030\202=!L\370\344\340p\002\003e,\212\256\325\311V#m\352q\221aI\3512(\232\326\033\013\365F\024Dmh\r)\254\255$]k\r\373eJ\343\304\321\b\247\35349\323:\203\267%l\215\2112\351\322SQ\030]\262U\206*\365\212Y\320\344t\035\367\222\364q1\2551\216\307*:\222\220t\334\304<\r\351Z\221\354\213\321#a\020\016!\272\020\214L+\f]\232\321W\222\256M\021\221\006# ^t\255DZ\306\036-\312tO\306\264\276@@\345\312\227\213a\032\223\0204\272\326\241\255A\332bGK\224\330\013\3357\2550\255,xR\212\306*\335_\200\212\250!<E\214%\fU\220\226\244\220\346\260\002\221\340n\233\003\021`\035\203\002Y\225\321\255\237\001\304\026\265\205\020\254`~\200#0\035\262"
+	.string	"\004c\241\003Q\370\361\343\277s\324|Qj\215\303\f,\035\277\027\344\241=\377"
+	.ascii	"8 \367Y\bR\230\340N\217n\232\0266\004x\177\230a\013\364&K\300"
+	.ascii	"O\366\222\240\020\311\323\221\002\260\004(\001\177\234=\273\324"
+	.ascii	"|oM\321\301;\222\001\245\261\030\330\b\031\2102d\344\007\303"
+	.ascii	"?r\001\0139d:\256\007\016\225\203\r\\\ndIc\340%\241\314\n\342"
+	.ascii	"(*\301\350\227\253qi\262\210\260Ii$\370\310)\313B\364{\351\007"
+	.ascii	"!\374\317\236\312d\333\025i\302\251\276\017u7rR\227&6*\213>\005"
+	.ascii	"Y\251S\024\230\r\207\021Hb?,\254m\270Jh\346K\332\204\366\267"
+	.ascii	"\243\204Ug\001\231\306 \027_\305\n\235\3424:\224\243\302\252"
+	.ascii	"v\023j\025"
+	.text
+	.section	.gnu.lto_.symtab.707f52e1d80af916,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.707f52e1d80af916,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1123 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`0\001]\t"
+	.ascii	"b\214/4`m\322\030\177w\330G\023\306i>\241Z\277u_\272\316\372"
+	.ascii	"u\241\266\232\2427\2205W\021\004A\020\004A\020\245\033\2400\261"
+	.ascii	"\204\020B\310\336{\357\275e\332;m\237\316\316\260K\2240\n\311"
+	.ascii	"\206\240\f\200De\262D\202\005\204\006\254v\220 \030.k\257`\357"
+	.ascii	"\355\375\262\266\\\035\r\311\241zvJ\237\002\312\242\036\241\n"
+	.ascii	"\317T]MM-\310\001\312I}33rQ\2423np\002\004\346>\035]\212'bB\272"
+	.ascii	"\353n\032\037\207\310\342!\272w\231#\003\320\006N\r\022\005\221"
+	.ascii	"W5\233\017\316\312e\234\220N\347\360\013E\361\3110\221\313\367"
+	.ascii	"\370\016\337\337\376\356vVC\003%\030-kc\0020 `\002B\211N\007"
+	.ascii	"i\202\206\221eX%\330\333\300*\200%\207\2623\f\003\203\334\227"
+	.ascii	"\331F\306\374v\201\325\025\346\004\204\301\311\b\033V \b6\026"
+	.ascii	"\360>\">\002b\021 '\306R\320\335\035Z\334\357IM\f\001l\372\224"
+	.ascii	"Z`!\217\004(P\315\001\216@J\200\362\034\263pk\227\0046\316i\327"
+	.ascii	"\243\005\347\255:\001\212\353\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"}\004"
+	.string	"\202\005\020\026\200K\322\00130\003+\201(&6\327\260\261q#B\310\226)\005\356N\007\303^pd\006\244\340\005\216S$\200.\2143\305\256\305\261\304h\263#\023-\373K\310m7UW9\304^\2027\002# \240\002\262!;r\306\302\306\026\330\226\241\006\201)\003k\260\214=h!\310"
+	.string	"\305"
+	.ascii	"\027\317\030.\336\204\r@c{H\223s\306\030`\304b\231`\342\3123"
+	.ascii	"\312\027\fd\024M\341\234V\263QWc\230\325[\370\214\313\203\314"
+	.ascii	"\n<\004"
+	.text
+	.section	.gnu.lto_.inline.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\b\004\205\021"
+	.string	"\306\026QB\020\221\223\306s\361\020l(\302Iq\240z\350/\366\036o\217Th\0228\215\364#<@\257\375\007l\003"
+	.string	"\\\037a-0"
+	.string	"\240:"
+	.string	"\021P"
+	.string	"\254H\215\355\021h{3b\t!jM\232\264-\245L\0016"
+	.string	"?"
+	.string	"="
+	.string	"-T\034\320_\023E\211\230\243H\236\210\270a\342\023\347\250\373G\235\346\367P\277s\001\236\347\226\273\273\324\223\222\306\356\202\274\023\350"
+	.string	"\022\307\261\244+v\327\343\263\337\216YU\020vW\302Wg\213\036\322\325u,%\312\356v\246\346\262\202\313I\005{\222vP1!A"
+	.ascii	"\204\006\026\030\020\254\301\304\236\225\371_\212\357"
+	.string	"\3174[\236Ppp\221\351\b\0310#\030\213\216\242|0HF\3007\250\200\022\245\003\034\027XF\002\214\375\f2\0377\375\272\236\323:\313j\371\370\334\251~{&\216\314\234\276\204$\311\356\202\2568\317\245iw1\017\231\335\365\274\321\264\003_a)_\300\254d\270^DQB\304\230\021\220\330 SbJR|\fB+C\364\205\302\207\022Y\016\303\304\224r\375\341t\002I\027\023\232\341\341\304F\001\315Q\243d\306\300\332\243\356=R\272\234,l\030\260\366\366\306\025\fl\250\221\275\251\221\251\240\205I1\273\001`\002\231\021<;\022\340\204=BI%\325\310\224\224\224k\030\346,\314\307\204\316(G\333R8\233]\020\t\2251\256\\\325\234Y\340\266\240\340x\200\214\274\333\024\236\204\245@K\215a`\242\\\032^l\357\260\216\370\355\355ku\356\242\251\230-\022Q\243\300\360{9v\375\224\350*\025b\377"
+	.string	"B\277\230\235\306\364\223"
+	.ascii	"`\250\316\t\265\027\256\030\001\016Sk\013\326\001\032\234,\345"
+	.ascii	"\271\352<\220\243%^\231_fS\302\037\005\362\004\nyh\275\003\177"
+	.ascii	"<8\350T\2628t\245\323y\320\202\250\002\345\\\247A\353\346\306"
+	.ascii	"/\246\003\373E\373\305!cz\273w\227\264\260\t\215\217\303\027"
+	.ascii	"\334\243Y\275\346\b\202\351D\272/\250}%\350B0P\337\320\002\032"
+	.ascii	"\235O\367\367\230\311KW\2369\252\332\035\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\220\006\235\023"
+	.string	"\346\330YB \217\223\016"
+	.string	"\234\026\220\004B\\\243\221}\237"
+	.string	"W "
+	.string	"0"
+	.string	"\fe0\214\247\347\265\346\017\rq\210$\352&l=\322\243Qp'\226#"
+	.string	"\230Ud6\2067\314-\336\370\274\267\257\215\273w#[\246\024@"
+	.string	"E"
+	.string	"I"
+	.string	"! \356\026pd\262YT\004\352H\344\032ht]\327\375'~\227G\210\\G\334\350>]\215_\325\257\353\356\327}O\002\177\022\250\237\020\271W\317^\235J\376T\272-\257~\2775vaC\022\0016\213\307\330l\215\210m\013\0012%\310dV\305\237\342 \030L\304\254K\344>\242z+~\307\027%mQ@\2150\2668\331\353}\211\334I\365\240\355\271N;\355?\360\377|P\216>U)3-\333fB\277\177X\006\004\226\026\345\261\250\351\200D\241\230|(\\8\221"
+	.string	"!\205\303\033\335\215\007\377\337\006\201{\377\006x\217\201\201\356\002\335J\267\200\256\002\335\215\356\201\356P\200\035\200\322\365"
+	.ascii	"\340!3\342\265C\367\375\031\357!|\251\336+\021\226\0265=\231"
+	.ascii	"63\r\033\251\\Y\246\251L\016W\t\247\202HI\n\207e\307\272<`!\020"
+	.ascii	"\326\301\002]\242\020hn\3008(\0373d\216\260\f\233-\327\210\244"
+	.ascii	"aZ0\371\2604`\331\351XW\b\003\255\314)\322V&\211\232#\221\306"
+	.ascii	"2\255,s\250!M\243\330P0\222\244 \3112\006\200\002\221*#z\022"
+	.ascii	"\200\341I\n\0041\f\001\025RHHDD\002\313*I\321\003ZH\024K\372"
+	.ascii	"\002u\036Do\231\363l\330\330R\223AA\262W\024\033\376`\220T\025"
+	.ascii	"\236\340\352\354+\220'\021\033\276\202\202\344r\353\0054\001"
+	.ascii	"Q7\013B5\\\340\321A\376\344Bp\221T&dhR8\356\025\036\212\366\016"
+	.ascii	"\330\340\357}\366\333'\340\"\tX\267O\205s\177as\342-\324/+\332"
+	.ascii	",\205b0n4\006\032(%^\271\354*R\267\226\244\205K\202w(|\0215\361"
+	.ascii	"\315\374\016\250DE\377\361\253t\376K\374\336M\b\236X}\275\f\255"
+	.ascii	"\214\241j\033\322\263\001\364T\263@\267\255I\263\020f 0\323@"
+	.ascii	"=lB,_k\344\211:\004\005?g\001]!\300\232>s{\016\351\t1Y\371\301"
+	.ascii	"\272\341\221\211\327V\036\343\340\344\013)[l\257~i\032:\252\241"
+	.ascii	"\357\254P\211j(5\200\002"
+	.text
+	.section	.gnu.lto_.pureconst.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\232\004\013\232\004\f\204\004\r\232\004\020"
+	.ascii	"\232\004\021\230\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\202\001\355\b"
+	.string	"\322L%(\220'I\007\300v\257#\202v\027\344\316$\316\314\314\274\216lk\326\222\241\027cPZ\033\332\n\033\021!\322\210m[\312\024\247gbh>\003G\301\220\207\350\230\204N\204\316D\347A\347\322\251\350T\250\3622\220\236mi\005\322k\335#\340'@kj->ZW\224J[\323\265.r\356E\231~B,\"z 3\214\21244\252\224\212$3\250\267rx\312Y\247S\356\224;\232\374\204:\237\316FoV>\031\345\214N\3266\347\211\362E\357o8\301]\b@\250QQ\306\250\250Vi\030\003`\2021dw\007\021P9\203\214H\332\302v/\301\n\037\022a7\274\206\305\211\276#\267sy\3451\205.Q\257%n\357\023\346\261e\004:rGX\210\274\311\361\271N?"
+	.ascii	"\374\306V4y2\216C\346}\331Bs\222\035\204\300aq\372FT\200\372"
+	.ascii	"\0342\2001h\341\233a\324\267\226\366\263BA\364w\035\314\313C"
+	.ascii	"\365\3347\210\017G5\033\211FS1'\341p*m~T\310"
+	.text
+	.section	.gnu.lto_.lto.c6e6a9f450f42243,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.17.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375 \322U\005"
+	.string	"\004\t\230"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{yw\212\001\202\200\200\374\342\303\334\204\013usq\274\236\274\245/om\270\327\344\007ki\370\326\224\tkg\270\326\204\007ec"
+	.string	"?\202\210\200\340\001a_\305\001]\304\001[\303\001Y\302\001W\301\001U\300\001S\277\001Q\276\001O\275\001M\274\001K\273\001I\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\013"
+	.string	"\200\224\230\244\310$\006\352\312\031\017\202\201\023\320\016\bK\to"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_tcpIsStart.21.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214\304(NR\310\214aM\300J\262\233\207\235\376\001\230\326\254u\252\263{\r\276\227$\325\020\004D\222\341U=\"$\245V+\261R\312\024ORf\322$,`*G]\355r\224C\345\024ZC\205ah\223\273\232t\331\312P\256i,\3135K\266\250\240\324\213G!\0369\260\343\215\031?l\0221\214\306\r"
+	.string	"F\251\002\026\236\f}\326I\275x\254\254\202\376<5K\220\344d\227\"\224\262#Q\210\306\317y\313\006\007\234\337@\204\232\210Hx\240\354fM1\360a\276\0217\220\340\003\004\373t0\003\020v\367\304>\025\270\342_\360K\377D\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.22.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\374\334y\275\301\246\250uSk\025\277\327Z\344\024\252\350\272P\301\032lt\267}\354\304\024}\250M\030\273\246-3\303C\227\346\020\221\226_^{\222\205\034P\331\354&{\247\0247"
+	.string	"9"
+	.string	";"
+	.string	"\260\335Ja\272}\272\236!\363\271}!\363\351\320n\360\272Z\f\005%\002\036\354.\225+\017\037C\377\256'\240R\245G\rgw\035Q)\224[\336\366\203m\013\373\032\001\365\236o\375\232\026\035e\36453v\340,\003\273'\263\b+\233\004Z^\177;\364]\346l\327\021\316\311$\003\266\300\301n\235\370t\305\366h\037\3461\341[\244+\354\252^\001$\262d\333\373Kd\213\262!\001\310\007\270@D\020q9Y/\006\037\300\f\266\335\275\360\001\214B V,\237>)\3639\245\204\013\204\226)\316\354Z\212R\305\276\266\273k\251\262\037\340\273\333\263\tyD\033\036\235\317\327\201\024\374\272\321\347\343\240\037\237\016\210z>\220n\034\354\205\272\217\212<\357\243\\\335k+U\2361\231I\236\314\305\313(\247\264;@\361(s)\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.23.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`n\002\375\022"
+	.string	"6\243{H\340\320(\035\333)9\222M\256\f\306\017\253\203nM\377\275p\354\327\001Y#.\207\346\230\230\226R\032\347\306\327\036\250\026\265\356?`~\327\023n\3267\342\021\342\r\343y\360|\260\210\2342\263\200\230\267f\244\355\275\245L2d"
+	.string	"\\"
+	.string	"j"
+	.ascii	"\372\241\252a\214I\214\303\203\237\034B\335\341\201KM\340}U_"
+	.ascii	"\273\355\365\233\314\001t\343\250\370\351\016\021\350\347]jx"
+	.ascii	"\001\363\322{\310\274\324\227j\320C\235.\t\262I1\324\335\037"
+	.ascii	"\207\370\353\221\367\245\037\231\220d3\330#\210\263iF\023E\272"
+	.ascii	"\373<\337\016\263\330"
+	.string	"\356\310\244\273ue\263\017Wyu\240\272@\001\362<k&\324\345(\024\207\327\335\013\364\270\324\352\244\263s\251\227\231\227&^\\\215f\273\315\354N5\204-\347\250>vw+\343\250>\274\232~\373Ax\2654Z%\305U/\256\216\346\352\214\253R\256\306\270\312\274\272\274\372\220/G\244{\317\216n\017\273\036\235\223/F<\374U\177\236]s\331\211W\243\300\200*\n\205\275Lc\3370L\3650\016\244A\277\243\025R\366\262\224yIb\322\315\310G\354\365L\036\361mT\356be\362\352\"K^\\\r\237\242\031\226\267pE\346\034M\304\215Y\332b6|\212\256\232\252\250\263P\025\250\r\351\226W\360e:x\267;8\317\313K\243\206\026\263p\037\260\247\345\202\0273\037ZJ\235FR'\221\022\327i\202\004\006(*'\020\032\244\004h]uE\221\274\240`V0\260\200,U\353k\261T\033@V\352\313"
+	.string	"\262\270|(V\353#\021\321\325\213\212\365\301\254V\254\357#\354\307f\034\375rDB3\034\213\234\343\2323\\ $\267\022\272\355n\030+8K\334\202\273A\263<d\200%&`#\272\rXf\311\036\377\304cD8\t\332N\007. `\002\021aU\036\223\320\345\214\361,\230u;2\032\353\277\320\220\275\364e|\335\222\2754\262PQ\005\274\213\227\237l\244n\271\017\213"
+	.ascii	"\366\274L \321\n.\331\223y\"\266\244\2617\366\303\t]\307HR\022"
+	.ascii	"h`UFx\243!\035uq3\233I\253\034o\023\320h\001o\326D\215k\020\024"
+	.ascii	"\362\350\351Y\3131,\270\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.24.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\251\004-\034"
+	.string	"v\361\257H\240\230Q:\300;\312\020\227\230\317\370\300]\346C\242 \345<\210\301\376\004\345\365jm\005|\004\311!\360\377\316\203yf\277/\006\373e\023\361\220tz\300\203.\255\322Wu,\370M\236\257\261\"\177\260\377\023B6\2212\311\224"
+	.string	"\213"
+	.string	"\245"
+	.string	"#/7\357\r\214B\264\324l\335J\261\326\030E6\325\212N\371q\342\277\373\037Y\330\356\022Y\274*\311p\001\221^h\325JLp\272\f\314\363\356\213<\352\374\260\305wjub\"\245V\242\202\255\231\247K|\017yj\036"
+	.ascii	"y\272\347.\231\023\237\352\203\342\222\2224\265\326Z\357\370"
+	.ascii	"y:6\237\373W\320wZ\343c\007\251\220\3000\t\326x\217@\302,4b\301"
+	.ascii	"\244\261\207K\2161?r\206\021Db.%\324Z\227\201\301\031_\362\273"
+	.ascii	"\313awI\354\216W\001|\340\020yJ\266\313\006\355c\323)!\022\027"
+	.ascii	"\267{\354/\021}\211\255\273\213\b{\f\337\334,\345\205\252\315"
+	.ascii	"\355TFSA8\223\005y\372n \223\323\226x\222\3152k\255\016\366R"
+	.ascii	"\035N\314\236j\255\207:\335\267 O}\372\211\351\2060j\370\343"
+	.ascii	"\342.\321\307\255c\367cm\247\335\023\277>\037\376=%/\217\311"
+	.ascii	"\273S\362\352\230\2749%o\254\344\305!yoF^\330\310\373\242\274"
+	.ascii	"\256\222\327l\336\222\344%G^:\362\216\224\267\003Q\247\021\236"
+	.ascii	"\032b\345\242}\213\323\273\023\376e\367,\240\231\037\027\257"
+	.ascii	"v8M}O\210\fi\247\035\326\205B\005S)\350\347\364f\2546\266\334"
+	.ascii	"\274\032\346\352\227\026\233\253\205\230\256~H,F\037\232\250"
+	.ascii	"\200f\270\352\f\027\034#\0016{\327\302\205\244\305p+\273\033"
+	.ascii	",\037,\263;8\245\346>\200B\253\276\021Y\366\b)1I\274\206\212"
+	.ascii	"Q\331\003\230\200\b\243\276\201\334\325\360\252\rMq(I\263\345"
+	.ascii	"\303\334\264\217\344Q<\034\210\020\252V\245\003"
+	.string	"A\230J\r~vC\210\340\003W\266\324\276\3357\271\223\336\036j\205\206\002\373*\232\321\212f\262\007B *d\020\021`_E3\031-\305\254C\320\004\017\262\234N\226\323\341\216l\267\\Ng\223\255\270e(\320\373\355k[\200\302v4d\202\b\307\273\365j=\336M\005\216WT\313\341\210N\324l\274^m\201lu(n\274\332\221N\307\253\301\210\365\022~\215D\201x\207\007\345A\303\263\025a\247\037\245\t\210s\372H\316\036\347\017\263\326\337\201\345\267\n\251\023\344\024\262Tf\307\002t\332\225\265Y\020\260r\372P\256\314x\253\256\265\261\244Z\177\bbCN\".\332\027f\307X\002b}(M\303\003L\373\031X\250A$'\231S\252FD\224\024$M:\220\002\221\261\252\036\021 \261R\016\252\2312\233\003V\231\025\343\221\361\227\310\224\237\366]\177t\353s\\A\r5Ha\301A\360C|\215\017"
+	.string	"\253^\326\346\204V\"\230\303\276 p/\234\313\033\320,6\013\213\006\272\370\305\317&\360\027y\216\201o\210\207\330f\334\243\245:\352\023+\240\300\257\352\351nt\027(q\203\315\"&\002\233\206\037r\212\256\333\b*'\302\211\263\230\225M\005<\363\260%~\215\206\033;y)1\233\244\220\263/\300)\236b\257\237\322"
+	.ascii	"s]\376\037\220\300\245\231\251\250 \"\347[\302-\2558rdD\237G"
+	.ascii	"\367\005\365lG\321C\321\261\324"
+	.text
+	.section	.gnu.lto_tcpReconfigure.25.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"ZJh\020C`\346M:\201h\016;\373c{\335\022\207.]q\221\237m\212\3257(\033\215\204\205(Fc\234\271B\004)\211\314\206\220\201\2579\236.~\317\002\372s\275o\036~>\004\202\202\334\335\2324B\310\2262\005\346"
+	.string	"\340"
+	.ascii	"\003\001\375\337\331O\315\276\257\373(\332?\273o\236}k\366\333"
+	.ascii	"\366Y\202\206+\206\364\234\342\356\005\262\247\350\322\235rV"
+	.ascii	"\376\353\370\203\377\273\177f\3431:\230\314\347\376\273\267I"
+	.ascii	"\0375\367\336\251?H\371TMNB\233\327VF\272\367\311\0345\367\262"
+	.ascii	"M}\230\362\371\377\234\306j:\2762\261\235\005\001\332\235y\225"
+	.ascii	"1t/\333\360l\254\204\362\231r\022\312\247\205\302+\033\t\203"
+	.ascii	"\300_\352CO\323\366z\346b\2431\026\002\305\3068X\027\226\304"
+	.ascii	"T\263\204!i \327\261\263\373\035\211\312\022f\244S\237\325\233"
+	.ascii	"\343\344\016N\254\b\243\246\204\27421\\\027Ff\006\201\324\215"
+	.ascii	"I\366\311]el\236\\m\220wpbclM\005K9cGb<L%;N\372p\033\367\227"
+	.ascii	"\030\262\333\267\341\336\373V\212\005\341\037\361\377"
+	.string	"8\377\337~t/\226\353\302\0346/\2505\373\0026\235\372\034\002\265\366\0271\242YiZ9-!\236\362/\301kNPP\263\252\2410pv\357e\264\325B8\262\247$\322k\b\331arZ3\266cu\334\332\314\244n\313n\234F\005\323-\321\356M\262rE\232\224 \305\202\252Yy\225\207\345\372\031\216\321\3308\243\275\212HD\371lk\305\346\016\221q\025\345\222\316~\013e\333\242m\317\216F\264\256\361\333Vz\357\265p.\303f^\234\321\370|1F\263\222\317s\f\224O\266i?\316\226a\344\272z\357g\343jk\366\263y\357\275\267O~^c\216b2\314\352\373Pf\377\351\327w\372\365\233~}&\263\277\364\353\017\370\365\225~}\001\335OJ\373\001\272\217\224\366\001\244\375#_\337\310\354\013\273\037D\373\300\016\026\311B(\003\224\\\"{\357\025:\312\262\333*d\035\222\336\333\305\312\346\317\241"
+	.ascii	"\212\254F\274,\327\027\031\033o\t\017\200e?p\326 4\003.[\225"
+	.ascii	"\364\033\027\272#&\234\310\350\247A\377\253\331\n\245Yyds\244"
+	.ascii	"\205\035\312C\032\243p!\243]\323\307\213\221\375\327)Lh\245\302"
+	.ascii	"\312@\2525\262\024\222\354y-Z\261\240\377j\205\003\255X\030\200"
+	.ascii	"y9\303\377\252\205\363\266\254\002\260-|\370\317\326\022\236"
+	.ascii	"\237\f`hK\265A\314[\350Y\017\357\331Z\271\254]\326.(\237\005"
+	.ascii	"\300\316\226j\203\362\314\231\325\001\203wF)>\205w\2040\202\300"
+	.ascii	"7\016\310$J\376~\314\206\323_\235\365\013\323I\255\025\243\203"
+	.ascii	"\274\203+B\266DOz>K\322\326|\007\032\225\263\206Y\305\244\311"
+	.ascii	"\022R?\207\016I8>\373#c7Y\237K\317g\203\362\211Za\033\0364G\b"
+	.ascii	"\364\357\341\003\312\312\323\332;]z\034\312C\006\007FE\0358P"
+	.ascii	"\013\201\t\022\034N\250G\243\013U\013\201j5\243\330\242\211\304"
+	.ascii	"\323\201V\b\324)\325\212xU\244r\241\336 fi\311"
+	.string	"PS\230x:0\312\212\210\243xEU\314*\316(\252[VT\304\343\025\225\212UT\263\216F\032\005\254\212\215\305\257j@\243*\213\305\025U\361H\304\032b\035\2115\212G\253\341\214\"\225\214a\325\021k\330@\275\221\006\3618\3142\032\217\303 \333e\363\332'\367\331\201y\213\363q\034s\033\203@\242y\305\231Q\026\312~\375\207\262\337\320e\221FM\326I\310\312\205L\223l&\305\347S\330\223\017f\262N\335\203\231l\023\223\235\2407H\250\344\326`+\017\2574\311_R|.y\365\327\222\375\221\r\260\234\\\"\023\240\002\254\222\231%R\200\215`\007\020\362\356m\321\005I\221\323\013&\331\026mz04\020\311\236\327/4\300\217\025H\2632\311\366\016\243\020\017*\200\375Mq\251\001\200\211\250!<\003%ddF&\210\202$),t\240\"!\262\232\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"M\311\307\244\361]I[C\322$.\351IZm\201/\300\274\243'k\205\215\340x\310\245\244\021\030\033\3670\207X\314\306\032>\024O\350\211\n\261\020\002\331aj\3079"
+	.string	"\203]\205J=\032\327\241\235\202|\261?\210\213\277\254L\372\300\317\213\007\330\013\372?"
+	.string	"\247\316\272\rs\216m:\363\304[M\242\254\212\274\003P3\311X\2600\340A\177:L\2764\310\005"
+	.string	"j9\326\023%\265\305\001i\265\250f\321\354\210Y\265.R9\022\f\224\375^\211\363\243\344(\301*\365=\260w\373\360H\237\336\200\033\316/\355\276\332a\021\177\243\217\373\325i"
+	.ascii	"\352)\347BYR\360\235\242\352\277\322\034Zh\342\236^\203\237n"
+	.ascii	"'\037\025\2215v\332\345N\t\213\352\362\013\255\355\272|)\374"
+	.ascii	"'\257\361S[\345\321`A\202\325\274CI\226Y\324A\200|\301\237g9"
+	.ascii	"dW\200\021\240\354L\236\002\243\bY\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.26.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\233\005m\035"
+	.string	"\246\262\267I\220\232Q:$\n\027\024\360\333v\202\214\002`dx\004\306\"i7\320\206)\345WM\034\241\235\345\225\005\376\215^4\316\265\273?\036j\331-\242s\267z7\020\307\376\212\004\203\271\006 \312[\324r;\336\370\215l\262w\222\001\235"
+	.string	"\227"
+	.string	"\252"
+	.string	"M\364Q\005\242|\342\257\232\200&:\355\270`\353\2211>\240{i\354\252;\215\300\023f\277\\+\363\237\034\n\321S\316b\235n\245'W\335\035\201m\263_\237\222\231\371L\336\204\210\203\265\364\230$\333\372\222!%\254;\265q\372\003\346\357\354\005\314_\373\343\301\233\267\2645\310/\272\211\314\032^\253&\271\325%U4\276,-lAj\361\024\215\312\313\344\204\307N\221XmY"
+	.ascii	"\307\031.\236\"\261\204`\246\230\343T\257H\305a\2552\f\335\315"
+	.ascii	"\025-&\235eg\346 f\3061\337(\001W\257\202\343\013\371\345\334"
+	.ascii	"\212z\364\227\277\302\374\255vB\0170\250\261r\211\241Q\305~\310"
+	.ascii	"\274\375q\362B\254pXfoO\365\006E9\303\256\2509\302\232dN\213"
+	.ascii	"\252eb~\331v\211\371R\177\317\241~\005\237\362\327\376\364#8"
+	.ascii	"\3627\360\2513\355\351/\343\312w\247rI\253lg\225\253N\3453\270"
+	.ascii	"\025\tS\263\340M\267\215d\234\016s\261\210|\352g&\342S\361\016"
+	.ascii	"3O\355\336G7t\320!\2324\335\351\203_\376\231\311\244\\0\365@"
+	.ascii	"aN\361\335.\024\260\024\020L\376&\350\304Mm\003\026\324s\fB9"
+	.ascii	"\233\f=^\226\007$\n5vkx\0324\2640\0167SF\246"
+	.string	"\024\265\244\303\311xy8\327\2300\260\2079\363\207o\001\265l\026\272\006h2\2078\030`\003\257/\013\274\002$A-\001{\227[\202c\367\321Q\376\226s\021Q\216\270\231Go%\256\345\306sd6\361,'f\335M\001\013\213\323\036\273\373\"\237\234\272\244\214\302\232\254T\220\216\244\367I\300\246\242\224\337\2314[\2631\346D\206@\225\331j\231S\250\250Gi\326\307\310\0261\337\312\016\300Qf\346\035\353t\340\325\335\025\002\276\373Z\354t?\336N\226\003\332\r\225\271\337I\002\bx\376\314\316\337\271\201'\bw\376\b\t\235\032`\364h@\272\3128\t<\334O\205\320\251\353\345|6_/\367B\327\003\262\265\320\235C6\\\317g\223\340\303;^\256g\373\355v=\333N\332/\333.\261\351cL\206\325\245u\330JFY\225\374\240y-\0223_\313\030\204vh\366\004\2515\\ a]iR0\244\322"
+	.ascii	"\316\320\262\022\253\021\251G>\243\253d\325\204\300H\035\362"
+	.ascii	"W\025\"\253\304t\0308R;FRX\325\244\243Dr9q\340\350\224\\,\330"
+	.ascii	"TZ\036\020+\324h-s0h\250QH\310\234B2C\212R\220$\303\001\340\""
+	.ascii	"\021+n\003\021@\261BH\031\211\202r\032C\273\001\354]q\213\021"
+	.ascii	"x\037=!\231\032\344\247%\303\177\313\304\037t\217`\343J\303?"
+	.ascii	"\367\36786^8\363\005M\300=\006\362uM\272\007GO\333\266\2576\270"
+	.ascii	"\241+\0040k.\021\332\247+9\357\215\377\356X\333\211\275O\202"
+	.ascii	"\026\310\210\020\225\306\206A\324\364gm\317s\205g\257\035Q=~"
+	.ascii	"\rN\005\nWf\001\244\215}\356\2219\003\333\374\362\"\240T\323"
+	.ascii	">\337\034\245!\3505G:\347[s\263\363\275J)\231\250~DS\277\037"
+	.ascii	"\224k\250\nD9P+N\266\235 \353\006.\t\024z\222Dj\233T\326\352"
+	.ascii	"<\207\"\003\243\343\\\005"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.27.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\361\001\305\020"
+	.string	"6\037nE\360\262&\035P'\335\021\260\177xGY\270s\306\345?\rN\233\316i"
+	.string	"l\307\305\314g\330\232Q\263\266\r\241\315\203]9j\001WvR\265\260uX\234<\306\344;Y\361\376\034\327\260st\254\222F\366\2262\245V"
+	.string	"T"
+	.string	"^"
+	.string	"7tv?\004\346\264G\177\232m\037\305S\250\330\203\037\314+\213\225\330\020\333\261\373q\241\213d\217\360\001\262G\035q\357\021jz\376\247\004\322\310\344\270^\252\307\226C\320\253\345\032\362j\301\320\356\336\346\311\362be~Jv\327\351zy\270\263\333v`{\201\235\r\002\361\n\212\311q\205Xe\217\375\251R_\354\303U\027{\003\375\373?\257\2713\230\2160\raZa:5}\220\rD\r\003:v9\364\370X\236\b\303\304k~[\305\267\361\346\327x\232\252\203v\023\243\301\261\373\035x\264\002-\323>\354*T\376e8\200]\227\003tD\240~V4x\300VP_6e\020\263\2632\303\312\335U\251\276X55\202\315N+{\330\026\335\2057\322\242\200\352\b\t\230\273\263\360\004\300\330\243\343L"
+	.string	"I\215\253\031'`[^m\n'y\227C-U\331\277\301\2206\\\266\351+,h\273\233 \206\202\""
+	.ascii	"#\363\350\247d\017\251R\212\251\213\243\256$J\241J$\315\035\t"
+	.ascii	"J\2272\251 \"\235F(\016u\032] \235$p%\222\350\204\353N(\216$"
+	.ascii	"d\023\312\350\304\245L\246\023\267}{u\361\203\030\020\244\032"
+	.ascii	"d\300t\323LYlg\032\302\362\201g\245,\b\211\323\303\323RU\214"
+	.ascii	"\n\322\377X\231\201\232\032\025\346X\021\3012\371\013/' p\002"
+	.ascii	"!\302\343\001I\002\366?\374\362B\244\031\321\340\005\341<z\371"
+	.ascii	"\017BW0\216x!x\210\217\341\231'I\362h\303\013\341\3349\351>g"
+	.ascii	"\240\255\222\337\342d.\210\306\035)\034\372\276\241\031\207?"
+	.ascii	"$\b\030\267\232\200\324\202\341\274\230\317s\333\035\224\200"
+	.ascii	"\322\343<k\214\237\336\332W\006"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.28.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\206\002m\023"
+	.string	"\006d\177H\340\320(\035\330\003\327\35580_\244W\211\004\213\267\250\261IR;h\235\363\310e\310QK,E\356\366\377\255!UP\262\342*\177\342aL\337\003\b\002!Z\343t\304g>\030\031^\345\245`\274v\343\210%{K)Sf"
+	.string	"e"
+	.string	"n"
+	.string	"\n\274\335_mZ\342EG\013\032\240{F\006O\367\210\340\237\247\363\243\367\377:BI\274\\\224#\315\254\303\351\\\300\331\350\036?\223\022\350tJ\025\320\351\344\016*\352\224\274\342UT\"C|`!\233\265t\306\250\364\230\305(\227f0i\352n\305\351\302\314^\273\242\222\356\376\312f\032\364\235\3767\371\337\340\337\026\001\006hjt^)t:\225=lvd\033\\\233\373\307\3262\355W\331<\363\353M_\"}\350\250\332\2418zO\356Er\337\311\375\224{)\367,\367\313{\005\031\375\300\030\031\352\306\220\313\321A\263\007\204\336Tqt\377\227\353\215\342>\302\021M0\220\206\321vj\013\364&z\255\f^\016\016\210F\367x@\347\003\035\034\206n\330\346\344\017\336\027\261\232\344\345\311\323'&\363:\321\025bHO\001\311\242\333\214\0336\227d\032\211\035\330"
+	.ascii	"\305j\257\355\356\0263\355\314\313(7@\260\305\361\377\244<\342"
+	.ascii	"\310\216\b\363\210\007\333Q\232B\034@\363\203\252\023\201\264"
+	.ascii	"<]B\"l\243U\376%\254\254\312n\202q\353\327\023.\033C\366\253"
+	.ascii	"\324\304\004\257\273\023\344\250\254\002)\340\312\004\f\031\254"
+	.ascii	"@\226\013J\007\210b9\261V,)\357(\222\026\024\353D\345\224\n\301"
+	.ascii	"\325\267\n\301\n\2510\345cI\235V>T\270\372HLW\265\200\341\307"
+	.ascii	"R\251\302o4\266\312\346\231?\370\221\037\2545.lLb\217a\376\227"
+	.ascii	"\270\004\343\023\344\342\027\204E\241\"\b\306\255\003\310\345"
+	.ascii	"r9\025;\021\227Xk\304d<\356X\304\235P\254\366#\212\370\204t\034"
+	.ascii	"0 \240\002\2419\333\001_'\364\240i=\261\216\274\220\321\303\352"
+	.ascii	"\274Y;\035\006\216X\"\016\003?c\254\315O\355\245\t\347\276\""
+	.ascii	"x\200\217\341\231'm\362lC\205p\356\004\351\036g\240V\221\337"
+	.ascii	"\"d.\030\215%R(\364\026\206f\016\017\22288\016(\305\261\033\242"
+	.ascii	"\246K\036\265\226C1_\347kw\320\002\312\216\363\2561\352\364\326"
+	.ascii	"\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.29.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\022\001\005\r"
+	.string	"V\230XC o\224\016@\270Lg\306XZ\003"
+	.string	"~\303\\9\320V\263!(\252\227\316\005\271a!\305\275\375c\375\272\"\374\207e\355NT\2204\021\244$\030\020\200\221\364:\337l\004\032[\025k\203H,!R\246\024C"
+	.string	"@"
+	.string	"J"
+	.string	"\001vGZ\244\330\215\b\f\265c\216\037p9\246]\300\345\230mopF&=\252PO\271"
+	.string	"9\231\261\033\241~8\351I\362o\362K\304J\305)\244\364\314\032\354\256\363\024\242\341\326\3336`\233\201}\017\001\366\257\335]\353\210\375xgg\375\327\225\326+\235\232\276F\001\030\"\035R/t%.\252\205e[\230\312\352\361\267G\276\2111~$iJqQ\033+\024\222\003\307\254@\313\264O\362\222\321Y\027\036\033'e\243\312\001\301r\347%\266\214\312\346\216\"\201@\352\002\016+DJX\230\274\332\023<\371\2235\030\264d\377\304#Y\234l\320IT\320v7\301\210\216/\243\nq\314\267p9v}\300bZ1\261\341#[\354XJM\005\036\242\220\307\301\327e\334\366\351\210\276O\247y\333\2046\021\007\205N\347q\037\374<\256\243\363\"\300O\327\361\300\315\373\340FcP\210\363\240\b\004\362 &\356\355L\001d\220\321\372P\023\204L\211\321RM\315\364(@TL\034?\021\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.30.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`M\002\025\022"
+	.string	"vavG\320\322(\035\223h\302\036(h\351\227D&\304\263.!O\225\353\322E\262\321K\032\301B\220\032\243n\370\317\352APp\355\300~Be\2038\214\355`\006\271\032/b:"
+	.string	"\370\206\275\221\220C\352\024\262\331O6\2212\245^"
+	.string	"Y"
+	.string	"e"
+	.string	"_q\0263\307m\270\200]\235\0265v\303\004\376L\217\016O\300{4}\200\367h\333\n\026\314\030\366\260\007\307\333I\262\021\032\262\033~\312s\330c\247\t\363K+\235\355\346\203V\213=\346\274\033\251\345\\Oj\263.ew\017\364\274\251\3112K+\273\353\244\325>\334\336m\263\330v`\347\211.\254\002=?\217\376\005\357\361:b\303A\013A\2239;\214\245\356\330\357vw\255:\366\303\273\344\270\037@L\227b\332\353\322\321Kw1\255]:5\375"
+	.ascii	"'*x|\271]\234\\\221=\212E%\036\376\366\214\017d\022?\204\231"
+	.ascii	"\326Di\210\247\003\220\335\020\301\243\033\2302\355%=\371\374"
+	.ascii	"(O\325S\016\266\0375#d'zA \361\037_\306{,\321\013\335\210p\221"
+	.ascii	"9w\232\032U\215jP\3102g\325No\223\024\3414P*=3@\003\252*>8\267"
+	.ascii	"\\\206\f\n\222\235z\f\320\004)5\202\200q\303\231\344\325\246"
+	.ascii	"\260\312\323\2342\323\230}\241\f\211D\263-\374\305\213iw\031"
+	.ascii	"\004\005\025\300T\2010\251\227\013fe2x\212\001_-.\251UK\345\372"
+	.ascii	"\\-\025\206Uk\302\007\263J\275|`\313\365\235R\314\212Q\265\276"
+	.ascii	"\027\213\325\372H\302}\267\252S\242'\036nG4*cI\242\024G3\215"
+	.ascii	"EOu\344\320p\033\242\005\351\216\362\214P(7Lz\f\331\204\344\356"
+	.ascii	"\306Tw\\RO%\004\355\230%\021\333\017^\204:\3318\020, \220\002"
+	.ascii	"\231\251\354\001B\241u\013,\023\256y\037\245\331p\360\022\b\026"
+	.ascii	"X\206@Q\01636\256Hp\025\302\271\317\n\371\221\304C\b\027\362"
+	.ascii	"\271y\210X\371\024\206\021\f\265e\003N\210&\0275\244{\316@XE"
+	.ascii	"\216\013\322\\\320\032\223\245\250\351\351\267\315\370c\210\205"
+	.ascii	"\215a\262\363\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.31.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`u\002E\022"
+	.string	"F!vH\340\224(\035h\360Pk\372\300+\024%\254\007\001/ !\262pU$l\316\346\r6\220\346\332\257[MM\327\025\313\251\315\213\346 \237\251\037\003\342`D\214\315\350\370\334\210\005\234\373=B\267\324v\264A\310\336DJ\231\002]"
+	.string	"Y"
+	.string	"e"
+	.string	"@\rt\177}\2418.\255\201\320"
+	.ascii	"\3353\234\236\3561\301?O\345G%0Uz:`\252\274\353\037\242cM\353"
+	.ascii	"\216\t\031\235$\335\3751\nu\251\344x]\327n\005\200({\251\234"
+	.ascii	"Q.$\233Q\036\311b\034\251\273\025\206n\b\031l\267[\351\356\257"
+	.ascii	"(\033\241\237\372\377\301\177\225\177}\004\342\237R\031\032\274"
+	.ascii	"\356f\220\223\241\345@\315\315j\252T\016\265\370\021I\300\354"
+	.ascii	"\355\037_\313\264_\271\356\356\363\354\327QU\2445\325\320\334"
+	.ascii	"{s\337\315\375\224{\331\355\271\271g\271_n\257\002FG~\250\354"
+	.ascii	"t\213\2701\351 \211#\305\177=\371\317\373+X\340\322\361\303\271"
+	.ascii	"\233&\\\262Q\005\347\344\216\331H\f\r\354\006\210\322#\232,a"
+	.ascii	">JD|\345iI(`\353>\2417\327\227\251\262dS\"\306\336\316\361\262"
+	.ascii	"\344\025\022\243\002\266"
+	.string	"\2673s\2542M&\250\r0\305V\303\200\2159%H\355\024\224\306\313\250\346g\321\031&^\346\034\037\026\265\321*\377\250\013\253\342I1~\375\252\323am\001\030N\213:\251L-\226*\345\375Tr9\265X6\230R!\212\365\261B\024\207Th\341S\245L-\337)d}%\322W.\250\360k\255V\341w2\266\362\354\016\220\004\3010\f\302\362\030\t\212\361Kv\334\203\207\007\027;\"\021\216i\007\347\016\020\345G\324\001\371YQd\273\373\305L\273\307\035W\310\001\212\355\222\377\021T\007X\312\201\300\0131 \360\002\021\241\343\001\003\001\277\017\221\r5y\177\323l~\360\022\004\005\306\020T\264\201#\370\033\370!\214\342>\354y\362\336\022\305\bV!;7k\"\212\357O\345Y\034\207\201 d\336}@\b\201\203gS\367\267\201\2545~\213\311\\X4\206\221\002B%\022\314\303\006\3538#\242\f\366\334"
+	.ascii	"\037%\270\304\003\276*7\316\275\255\315z"
+	.text
+	.section	.gnu.lto_tcpDataOut.32.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`d\005\005\036"
+	.string	"vs\267J\240\230Q:\200\344\212a\303\343\363"
+	.string	"\261/a\246\370^\2401z\004+So\311\324\341{:!,\001\257\352\371\336\177\035\332K\327\373(\263/\245\3531\307x9\326\3723\004\310x\2049Q\316\356h\002\374\267\377I#{\313-S\236"
+	.string	"\222"
+	.string	"\251"
+	.ascii	"\307\307~#\373\350\361\322\241n>\306+|P4*1`\373\t&\333[e\372"
+	.ascii	"\263\022\363\350qQ\005\307\334k\244D\344^\243\203\237&\333\033"
+	.ascii	"y\246dk2\200\222\355{\377\025\033\217.;\025\177\232\264\334{"
+	.ascii	"\317&r\217_\246\253\264\265i\357\f\023\372\370\305\346\001\032"
+	.ascii	"@B\354b'/\204~h\031\304\266.\300*\202\205&\004\326\031\0276\202"
+	.ascii	"1!\013ZK\342S\025\032@0\270+\205(\033JhB\237Z\026\025!\362\221"
+	.ascii	"i\013\341\217R\227\205{\357iP\b\304\207\361\377\240\377\025~"
+	.ascii	"\313\"\334\377n\004\345\340o>\355\373\031H\n\212\f\376%\370G"
+	.ascii	"\216y\357\225\340\224\341\004\201\243\032l\317*J\266\334G\240"
+	.ascii	"\034\251\202\004\255\240\311\337\350\243=\374\271\223\311d\362"
+	.ascii	"m\364\363\022\337\306L|\032.2\013\250\3642M\037c\351aJ\372\027"
+	.ascii	"KO\253\364\263J/\253\3641K\017+\351_\226\336\254\364\256J_Vz"
+	.ascii	"[\351k\245\357\246\247\224\236\021\030H\"\212A\354\321T\306\353"
+	.ascii	"\"\311\345NY#7\230\211y\351g\246s\223\351{a:\021\243\260\230"
+	.ascii	"\0035J\323\260\246\375c\320@9x\b3\200\355\373\253\315\206\265"
+	.ascii	"\225\002\"\375^]\213\362\323e\003O\361Dhbc\366L\307\325V\321"
+	.ascii	"\3254\315V?]l\227\355j\013\005\304\361\343\300R\270\002Q\003"
+	.ascii	"\312\346&\2569^\261P\016\243\030\266\207\267]\033\3041j\211\022"
+	.ascii	"\3335U\305$Hj\333\237\325\216\342\020'ZN\265\207\177\007\331"
+	.ascii	"\323\320T\367\357\201\217\340\002\034\031\231\035i\005\255\374"
+	.ascii	"\003\023\301\325 \177\303O\271\004\310\356\013DHD<\212\017\206"
+	.ascii	"\202I\335\303\367\224\264A\034\253|\350\226\377:\026\322c\322"
+	.ascii	"\356\242([E\031\r#pxD\344\254.\207s\263\243\203\2633\237\263"
+	.ascii	"1\221\333\301\221\270\331\361t:\247\016O\207b\307\013q\342\354"
+	.ascii	"nJ\2349\236\316is{\216\t\035\357\334\311\311\341\2351\343\345"
+	.ascii	"z\333\350\026V\364\257\336{\357\213>1\221\311\202\243ai\250,"
+	.ascii	"\234\202+\271\0022\375\322\241\265e\326\250\255a:\346\006l\037"
+	.ascii	"V\217\f) \246eU\305\227\2465\f\322\357\245kRW<\021\254lh=+\322"
+	.ascii	"\032r1`[\327d\020\217Rfmk\036\"\353X\317\272jM\301\235R\032\310"
+	.ascii	"\372D\342lT3\261\346#\327\374\262~\224=\304\225Pp\001\236\314"
+	.ascii	"\\O\250$e\005m\250Q<\345\224S\312F\222\222\202T\322\001\260\002"
+	.ascii	"\021!+;\021\340D\205 \034\221-\264\031B\231\006\331e\364\030"
+	.ascii	"\242\374\203^\034_Cz\245,\347\332\351\304\2705c\320\022\375Y"
+	.ascii	"KK\312)I\243\362\361\340o'\331\352\255\"\243\005\006\235\202"
+	.ascii	"\237\fe\017I&\270N\304R\322\301p\361\366V\003\227b\255k\325\317"
+	.ascii	"\003`4\034\3515\357\314E\315A\240\353\277\\A\210\277\357\213"
+	.ascii	"&g\351@B\260\006\322r%\034\025\016\232_\016}\002Qx\322ZwQ)\347"
+	.ascii	"n\177\270\374\272\2342\314P\244\204\203\r9&8\205\300\315?8\202"
+	.ascii	"\217\200Q\301\234\320i\312\224\016\316\250u\t\230\f\372\273\026"
+	.ascii	"\n\307\221~j\035\3655\341\236\332\343fy\242\177\030\330\276]"
+	.ascii	"\225 \252m\266\226\fV\2678~\036o\251\001"
+	.text
+	.section	.gnu.lto_tcpDataOutAll.33.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\212\001\245\017"
+	.string	"&\035hF\020\257&\035'v\013\211\223\272\313\005\222\363\261t\347g\307@\340\201\230^\341\237\250\201\274\017\253\275\246\340\264c\353\334\270\234\030\035Wo\213V\331"
+	.string	""
+	.string	""
+	.string	"\200U\250\353I\307dv"
+	.string	"\020u\341\236 \226l\"eJ\001T"
+	.string	"P"
+	.string	"V"
+	.string	"\252\301\333\263\360\3262\365\217\0263\315\224\357r\002`\314\373T\377d\037\025\327M\350K\311F;-0<|\266\276Uj"
+	.ascii	"@\274\036-<\313:td^\204>\n\331\306J\007\017\364\261R\037\276"
+	.ascii	"\003\254\361\276\327\363\223`w\235\336W\341\336n\333e\333\200"
+	.ascii	"\375\227v\250\312\321\016\312\007+\213}\020\2745\323\371\364"
+	.ascii	"5\004\314P\201 fw%\026cm\342\214\207\203\267\037\302\017\r\372"
+	.ascii	"\313E\244\016\232fS\2716\030\f\206\316\356z<\232\333\036E\337"
+	.ascii	"\320\036\263\017\320\036\017r\312f\361p\303\036\306\223R\202"
+	.ascii	"gw\271\251\266iA\336\263\210\245*\373(&\204pv\367\336\t\021\016"
+	.ascii	"\034\330M\234\034\240P\332c\352\001p\205\367\372\353\302\327"
+	.ascii	"\312\264\305&\332\265\203\311a%\f\t'a\262\355\356\310\037q\230"
+	.ascii	"\007>\207GG(\311{\217~\211><\207\013\031=3'\031S\230J\217\214"
+	.ascii	"jK!\2464\351c\204D\242\200\001\210\251+\2418TW\202`\352B\270"
+	.ascii	"\006&\020\021\216\324\241\270\017\221O#\245\216#9\235:\016\024"
+	.ascii	"\356\225\305\345[L\314\346DW\037m\261\206\0277\325\234\364\270"
+	.ascii	"jk\273i4\325\337<\333\335\325\n\\u\323\273\300\032\224\f\253"
+	.ascii	"\214e\212\030 \003! P\202A\252\256\007\341\300\356\035\311\036"
+	.ascii	"\247B\265@\305yv\367V\b\332\222\355a\302\305Q=\232f\300l\t\003"
+	.ascii	"GdO\231\234\016\203v\024\216\342H\300K\267[\024\377\203\204\223"
+	.ascii	"q\202\363\312\323Dp\314\340\033\355\200\210C\326\356\033W\267"
+	.ascii	"s=2"
+	.text
+	.section	.gnu.lto_tcpDataIn.34.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\271\003\005\031"
+	.string	"\006\356\237H\260XQ:\360\200\t\216k\f\243\242\217\262\216\344\316\270\026x\242\217\231\247\215D\203\002\201\330\025.ID\240\b/\361\315\250h8\375\246\223\374,<\376\214\376\b\270\013\267\347\341C}\202\253\032\235B\377\033!\204l)S\n\207"
+	.string	"\201"
+	.string	"\223"
+	.ascii	"Kj\256\366}\374\007\355\272"
+	.string	"\023\0270gP\217\2449w3n\215\007\275;+<8\376%<h\232\355\364\235\320\374Q\n\024=,s\316\326\326\260\370\373\375~\227\273\033\245\264\217(\021\224\2534_\203\f\261\341t>J\261g\005\216;a\001C\326<Q\361\275w\275\341j\212\n\177b\\|q0\205{q\271\302\365H\2319\247\n\307\243\373\336!DQQ\205\306O\214\253\370`\316i\265\341~\356\324m\003\331v`oR<\253c\377\210\2046\331\354\330\215<\214sN\006E\031@\034\020\272q\"<\370M\031A\261\271\330\321\237\275\323\321\315\331\257\021z\242\342\r\262c\316\273Y\347\3750\337\375/\327\375\001V.\337\335\252\363\356T\250F\205\3521T\213\243:\004\325\240\250\226\241zA\265J\365\013\f\3605\211\2604\347\212\237\226\311\004\372r\330\276\312\366\016\235\210v\236\225\214\232\223\206S\322\234s\306\r\306\2032Rw&\002J"
+	.ascii	"\004!\355\270\262\363'S\206\214\344\346\214\332qeDLx\364\311"
+	.ascii	"6\205#q-82\203\332\0056~W(\356\270R\311\007\250\266\344\"`\004"
+	.ascii	"\200\270 OH\026]\270~\221\234\n\006\232\346\234!\242g\2632t\337"
+	.ascii	"\006\013\243o\"<\030n\250t\223!W\027\334E\332\225{\024[.<\311"
+	.ascii	"\205\240i\310\201\246]\004Qt\306p$\0210B\266\206\013\261q\321"
+	.ascii	"\205\261\241Sp\227\215\331'9*\362\321Q\333\242\245\036\334n\316"
+	.ascii	"\366J\2776\214\203\336f\231\260\022\261\231\354\360R\330\353"
+	.ascii	"\306&gv\023\033\375\242\t\361\312\321\360\301&&\203\315Z3\031"
+	.ascii	"lDL\266\241u\023\263\001\321z\311f-\032\031\343\204\200\311Z"
+	.ascii	"988\262\226j7\277A\023\2100\355lM\302{O\371\2000\361\254\316"
+	.ascii	"\2500k1\265\253\275Y_\326RT\255\313\336\022|\2652\")4_-k\357"
+	.ascii	"\003T\223s\316\211\332\234\025d\355g\340\234$kS{S0f\227G\013"
+	.ascii	"\0252fU{\263/\216\353\244\311\177\216\240\330\254\200\233\263"
+	.ascii	"+\\\342\"\020I\250\021\360\224BP)\"\023\020\005\022\314h\332"
+	.ascii	"b\220\002\031\252\353\006\021`Ac\205Ar\3372*\036\326\201\216"
+	.ascii	"\0201y'\205\205U-/\266d\354\033\267\006Q\264\327\235\344p\255"
+	.ascii	"\301\265\225\324G\\<\351\251V\242\366!\222\243\222)\203\324\005"
+	.ascii	"\277\205\030\231\276\3240\353!\033S\\\344\321t>\214\376=\320"
+	.ascii	",\340;\265j\210[\207\357\024_\325`\2216\211\351\307\222\225/"
+	.ascii	"`\214\257\233A,\244\035\360-\240?=ZI8\365\351\034\360j\360A7"
+	.ascii	"x\321\317\365d%\207\374\233\316\024SH\323"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375`\233\003M\020"
+	.string	"\306X`G\340\2626\035\260\220\300#\342\007}\np\036\236\270\2077\250,@\"re\003\344x\2317\334\024Q\303\235\204\031f\2303\306X\356\356.\253\252\026\2359\245\231\231\221'i\257P\355\377\257m$\217\222c6m\233\244\224\001N"
+	.string	"R"
+	.string	"H"
+	.ascii	"\255V\253\205\241\001\360\205\022i\201\223\025\372DE\241A.m\232"
+	.ascii	"\320\245S{\022:\205S56\"4\312J\207\270\324#\206`\"\257\272 \315"
+	.ascii	"\203NU\303A\223N\264\250HU\275\276T\252\206\245\332\252:T\373"
+	.ascii	"\371\276\357Si\021\253\352'&\277\300u\351A\303\032\361W\\\266"
+	.ascii	"\341\271yA\342/\270+\003\246\205\217\023\376\f;\275\211f)\321"
+	.ascii	"\fHt\203\021\255@D/\b\321+ z\300\207&\340\241\rt\350\003\250"
+	.ascii	"F\300\241\023\354\247\372TM\033\272\300\316\364\350hh\001\247"
+	.ascii	"\235\227\031\031:\300\003\337\024w]\023G\220<\t\210\"\237\205"
+	.ascii	"\344\261\261\223\237a\212\374\005\312\213\300n\\\005\022c\307"
+	.ascii	"N\307\347B\023\276&\202\370\032\030\342\223\210\2739<`\340\210"
+	.ascii	"\370\230\330\361\347\270,7\202\274\2148f\345\342\007\211\177"
+	.ascii	"\215\035\007\232\211{\232\351\321\361\270\243J\334\256X\251H"
+	.ascii	"\261\225\\\033\3679pxpx\3335P\306\264\035\013wW4B\026\246\355"
+	.ascii	";n\213\f\f\313\333\216\332\2276\316\271Aa\303#\237b\226}\206"
+	.ascii	"\030\366\025\021\371\024CB~\215\336<j\006E\250A\034\343b(\022"
+	.ascii	"\264\005%\205\312\001 \003!\022\347\021\200\030\2161F\"\222`"
+	.ascii	"B!\231\007\032\263\341\360\2410\353\367\023\272;7\027\005\rZ"
+	.ascii	"]=\200q\254\007g6\323\bi1\003I\370\330P&\205\363\371#\331\221"
+	.ascii	"\312\034a`o\375F;\236DSIIJ\322\311\256\232c\215~,xL\204|^\244"
+	.ascii	";/\254\001>\302\344D+\256\345H \233\301\227~c\277\224K\3539\324"
+	.ascii	",1\252\322\245\221\025U\001"
+	.text
+	.section	.gnu.lto_.refs.c6e6a9f450f42243,"e",@progbits
+	.string	"(\265/\375 im\002"
+	.string	"\022\206\020\025\200'\35230\003\234\016\034Z\030\304&\352[~i\333\2262\005\177\252\254\247\250DM\213.rY\375T\001\235\343\304\333\235Pz\200o8\031\033\370\005~#}p\\08\343#\376\335='>\377C\002"
+	.ascii	"\316\025\"jP\224"
+	.text
+	.section	.gnu.lto_.decls.c6e6a9f450f42243,"e",@progbits
+	.ascii	"(\265/\375`\226@\335\023\001\212\330UfX NI9\351\212\233\030\016"
+	.ascii	"~w3\307U\f\256\362y\203\306\343\217\2771\332\r\273\nwwce\326"
+	.ascii	"U\215g\256+o\264y\271\267\274\200T\\\232\243\376M\314\256I 8"
+	.ascii	"9<\264\260\314\333N)\251\277\f\332\020\177Y\226Wm^\016\242\207"
+	.ascii	"\005\365#\333\226\220\275\345N\001\217\005Q\006w\006-\344M\344"
+	.ascii	"\357\037\r\244\223>e\242\264\345\276=C\017\251K\016\332J\351"
+	.ascii	"\303\023GI\2347}\177}\340W\016\316ZW98\273*\350-D\207J\013\027"
+	.ascii	"\035}_W\027\205q\316\025\350\2549\327\237S\247\006\256-\310\352"
+	.ascii	"\317\371\033\003\377\272\300\265\305Z\3759\033\251\201\317\016"
+	.ascii	"\037E0}o\341\340\271\372\306*\223(\0345\275\341h\035\235\243"
+	.ascii	".;\352\035U\351\372I\204\322\221\304\221\213\267\250\276q\265"
+	.ascii	"\335\321\213-F\346r\316\0354\350\320\341>\371\201\246\003\337"
+	.ascii	"\333.\374^\301B\203\272\366\343\002Wa\312\027J\372\251\306i\343"
+	.ascii	"\006GF\025\260\210\2751e5-\001\343\202C]\3732\201,\253\237\372"
+	.ascii	"\210\245\354\247n\241AOQ\231\217 \242\244m\315\345\234\3777T"
+	.ascii	"\333h\030M\243e\364\214\256\3211\352\262\237\332\251C\207\016"
+	.ascii	"\033\314'N\346\336`p\337p\360{\r~\237\301\3576\374\326\202\337"
+	.ascii	"V\360{\n~/\261\b\025\350\\\"\242\361\362\242\357\273\b\376\337"
+	.ascii	"H\235T\227\255\324\371UJ\205#V\353\272\330C\274 \347\035n\311"
+	.ascii	" \245>\352b]\203R\346\247:\343\314X\334\\\316\312\r\035:\330"
+	.ascii	")e\32289\357k\034\376\273\330D\2358Z9\3424\261\363\226\025\323"
+	.ascii	"\216\276\257i\370\225\n~\025\3035W\240\363\325\t\256o\376\252"
+	.ascii	"\246\256\251_%\310\300\004[\221e\251om\023\364\352\346\347<B"
+	.ascii	")\363W\316\331\307&\375`z\352\373A\3759_\267\360k\022\334\312"
+	.ascii	"\ntr\250?ge:\326\237\263\306u\205\253r\257q\365\355 B|\007)g"
+	.ascii	"\345\254\254q7\347b\255\036\364\324\352\201y6C\321\353\274\257"
+	.ascii	"D\360\253\017\\\313T3u\371Au{\025S\307\334,*\2632g\245OW\301"
+	.ascii	"\001\363\352\373\032\205_?8m]]\375\340|}\302\032*\320\331\365"
+	.ascii	"\347<Y\005:+S\262\376\234_\253@\347_\277|\200\221\250\204e\365"
+	.ascii	"\375+\233\227\332\225\225\345G\337\332e\303NJ\246\323\352\373"
+	.ascii	"\272\204\203\252\334\r\354-g%W\224*\266%\366\327,5\255r\251h"
+	.ascii	"UK]\253juY\267\374\325J\275\362\r\312\234\221\244P\251fdQ\032"
+	.ascii	"\360\007\235\375\254\207\227\363\324W\262\001\177\335\372k\223"
+	.ascii	"\252\254[*\226\237\365 i\310HC\246\274\345\234\271\272*\330\006"
+	.ascii	"G\306\024\256\244\274\345\254|\315\372\253\224-uJ5\263J\"9\357"
+	.ascii	"\370\201A\0274"
+	.string	"Ph\314\345\254\354\320aC\207\016\035:t\250[\232\260\250h\270'\001\266\312\nt\212\250?\347C\200\337\002\276\n\370\257fef\f(\264.=:\216c\350\372\376\257\313JV\307\224yC+\231\240T\365\375\005\360!\2005\210\205\3710\211\321C\2102+\347\354\303+{sDF\337\207\300\257\313\nV\277N@r\243L\337\372\244By\375\252N\016\"\304-\261+g\345\234\353\227\003\2209\027\353\227\017]\316E\237Z=\250\325\203\273\204\312*\312y/\002~\365\372\217\227\034\342;\374\306\035\324\237\263\203\nt\336\372s\212P\177\316\277j\375\225I\315\272\23352!\363W\316\312\013\232\310\225\004\255\357\225\025\350\304\365\3474\301\t\212\337\240\032\277\3417\177\177\007\261Ap\347\371\315\021\374v\203\b/\254PS\200TY\350\016t\225\t\202\027\206?\244\227X\341\031\374\346\002:\360\327\364\004\377\240;\360\364"
+	.ascii	"\374f\002\206+\034\316\203\027\206HM\034T\027\252\t\254\317\207"
+	.ascii	"\277\026\253\261;\320L\307\340"
+	.string	"75\370k\360\257\300\277\242\177%\372\253\321_\177\177m\301_E\370\353\tT\360\327\007\374\365\205\277\272\360\327\341_\205\1775\301_\323\277M\250)\210\177\215\341\357$\353a\207\r\341\267\f\370-\b\325XS@\036\204\337\304\300o;\330\005L\371\037f9\f\035\375\315\305~\360\327\024\254\240\026\025\360\267\tl\002,\002\376f\363\367\320\036\340\257H\177\355\240\353\254\001\252\\\033\377\301\377\262\026\342Z\351\002\277\311s\005\265\036\374\366v\360\267\232-\300_S`1\001\376c9\034\007\177\253x\031\003\376\013\3667\224\337n\360\3272;\200\277Y\300\202\272\202\277\246\240&-\325\270\303)\340\032\374W\315\337E\3766\362[\001\374G\373\237\366\237\313\377.%\274|\347\277m\376f\3214\356o~\370\333\002\177S\340\357\013\374]\201\277E\374\035\201\277%\360\367\003\376\306\300\337$\374\r\201\277K\370\333\204\020\1773}"
+	.ascii	"\341o\036\005\374\335\301\337\003\370\373\202\277w\177\327\377"
+	.ascii	"\033\374&\211\337j\360\333\237\337j\370-\357\267\346o\377\367"
+	.ascii	"\334\337c\376^\373[\313\337X\376\036\373\373\353o#\177\017\371"
+	.ascii	"\273\352o\037\177\363\370\033\3717\215\277c\374\375\364\367\361"
+	.ascii	"\357\246\277\231\376f\361\267\361o\245\277Y\360\367\t\177]\363"
+	.ascii	"\037\356\177\331\177\267\277\306\375u\351\177\227\277\206\340"
+	.ascii	"\257#\370\353\n\177M\341\257\037\376V\301\337(\370[\305\337\303"
+	.ascii	"\277M\3607\372\367\320\377\260\277E\360\367\007\376\356\300_"
+	.ascii	"\313\376\336\300\337+\374\255\302\377\022\377\277\376\023\375"
+	.ascii	"\255\201\277G\374\235\302\337\031\370\033\205\277\262\360W7\177"
+	.ascii	"m\363\327\271\377-\374\225\315_\345\376\332\342\257,\376\272"
+	.ascii	"\342\257\306\377l\377\275\374\317\372O\342\177\226\377\032\352"
+	.ascii	"\352\352\352\376\235\221\037S\375A\037\002mx\374\366\250q<d3"
+	.ascii	"\202L\271;v\224\304|\346\356\270T\27483e\220z\216n$}XI!y\246"
+	.ascii	"D]\371\320\361\213$&i\201\323\367F\331:\2372.\2225z\313\356\351"
+	.ascii	"\n\231\223\017\0347t\270\234\230\312l\374\336\270J]\252\252\364"
+	.ascii	"\2755r\234x\261\250\353{c\\(9\030h\220P4vlT\255A\233\361K\243"
+	.ascii	"s\344\026H}\257\214\273\001y\"\312\365\275\232\333\244\bT\017"
+	.ascii	"\235\030\370\277ON<d^\250ys\374u\352\241\nC\223\354{_\2641a\221"
+	.ascii	"\352{Y\334\24661Z\2505\271\260WHPIL\277.voT\300\262\372\336\026"
+	.ascii	"\273\261-if\372^\r\357\334\362\202\316\215\216\222qig\246\207"
+	.ascii	"\222\227\322\357\222\017\031\267\251\"}o\222\271\025U\354{\221"
+	.ascii	"\216FM\034\344\\\337\253\371\331\177\336\225Q\306DK\337\347\300"
+	.ascii	"\301\377-^b\016\2173j\311\233\177\2119=n\020\263\372^\215\255"
+	.ascii	"\373\317\343\255\255Y\363U\027\007KS\226*6\327FX\02548\375e'"
+	.ascii	"\212\207\2150}\237\023\207\177\373\246\251\234Zm\342\254q\303"
+	.ascii	"\241M\333\021V\233\n\306s\343\311\224\23196=]LrDYs\313\246\004"
+	.ascii	"9\177\331+0%8}\255\232\240\3335\004\220rV\326w\227\306\312\361"
+	.ascii	"\034\021\2136\344\342xh\254\321\025\351\013\227\343\344\345\315"
+	.ascii	"J\337\347\270a\250\034\026I\225\345\202\352+)V&\311\004\212\213"
+	.ascii	"\005\222$V\211\215\267'o\244\246,\017&o\365\253\r\022\333f\227"
+	.ascii	"\374\254\256}\235\300V\343\315R\261hl\232\365b\271\3307;\306"
+	.ascii	"\252\331-\326\212\325b\277\33026\214u\263],\2325c\257X6[\305"
+	.ascii	"\256Y2\026\214\025c\261\330"
+	.ascii	"3\233\305\236\251K\333fm\334J\261S\270\240\270y\253j\263G>\260"
+	.ascii	"J2\314\302+\007\227W\0053Z'\032w\333\352\253\254\2467'tP5,\216"
+	.ascii	"#\255*!\326\252\256Ai\310H^@\222u\214\221\rlQo9g+\325\303"
+	.string	"\006\021\241t\344-Q)\t\n;c\235\236\354\f\257&oWZV\331\302\213\tl.\331U\301\250V\330\344o\253\332,\021[\304*\223\273'G:\242T04I.\333f\227\025\f\216ua\333\354\2305\253kP9;u\240\004H\221\264\271\234\263\371E\210\033*\023\270\277-\2735\373m\223}Q\277z\322x\\i\352k\311\202n\313\302\262\300\261\352\373#\004\363(+\320Y\261\324\237\3639<\360s\240\360sZ\340\363\340\340\363\316\340\363\326\360yf\370<'\370<%\370\274*|\336\r|^\223\262\t.J\251\302\245\211\335\322ir\004\345\324\367\274#|\354\006\037\313\341\3432\370\230\rc]K\2172I}\217\263\340\3431\374\267\372s\036{\341c#\370\267W\267E\352W\t2P\201tT\3277(\350\366\352?\265\311\033\256+}\217\203\340\r\025\310jH5+\202\005\310\362g\354\f\377\2773"
+	.ascii	"\236\345\214\031^}\217u\340\343\032\270\346\372sZ\037\366G]^"
+	.ascii	"\315\002\371)\026\266\004\251\357\361\013\334\202|\265\363x\t"
+	.ascii	"\377\226\307\016\2375\\\300(wX\252\335\2277),\372~\367\006\177"
+	.ascii	"\027\207\353\021iuX\026.f\204\261:l\324X\324\231\225\276\337"
+	.ascii	"}\301\337"
+	.string	"\241\341\337\342\2607\304\242\332X\330\033\326\206\217\220\2654\254\276\337\221\341\357\272pE\036\301\026\206\215Q\227\317be\\\351\323c\266\004\226\245\357wC\360\353\263\234-\250\317r~\347\003\327\235\024\256\310\nt\002\240\376\234Ui\2318\360Q\316p\261\243E\034\023+T_,\252\331N\306R\r\230\276\277]qklb\003\253\256\257]\342M\245a)\323\367;\032\3705\314_\333,\261\222\251gva\231\215\332\334TSIy\343\321\243J\330[\032K\254lZj\203#\343M\263\304^\322s\033\034\031o\225&uV\251\343\330#\233\324t\026\311\346\206c\213ui\211\177\267i7\355\303\022;H\023\251kPy\001G6jX\375\246\223u\rj\002K\320\332~\020!,\261\242\251q=De~q\002yc\2436we\211}\244\261\352\032\324]\362\325S\226\330;\252Y\016\230\222\215Z\207\263Kj\214Z"
+	.ascii	"\356O9\214\277de\3759\331\230XI'3\372\376l\303\\^\r&B\351\310"
+	.ascii	"{\341U\365\246$\323\221\334\032\373\221\254[Q\200\034\301\321"
+	.ascii	"L\262Z)B\351\310kb\033\002\346\017\272\322i\226\353\210\243\260"
+	.ascii	"5\275I\261\002\305\245\331D(\035y0\216Zt\327\335D(\035yJlB\262"
+	.ascii	"\252\364\024\252\033\311\234\225eQ\\a:HS\021\241t\344\265`\313"
+	.ascii	"\361\326L~\020!:L\203\351\244U&wP\250\224g=\305r\0351\024/\033"
+	.ascii	"=\246\341\332\255\327\264\\\247i5]\246\311t\\\233i1\215\246\337"
+	.ascii	"\272\255\317\324e\207\351/\357\253V\222\025\246\263\364\226\272"
+	.ascii	"\366\225\213O\035\020![s5\227\263\262CO\227\020\027J\003\334"
+	.ascii	"\237[\370'\021\3747\233\227/.3d\224\367*\314\230U\227^;\267\330"
+	.ascii	"~\244\365\375\211\304?k\250\265\026\0376.\322\264\365\375\331"
+	.ascii	"\244v\256h\264\035#O/\206\364\275\371\246\261\374v!ylq\206\226"
+	.ascii	"\261\2767\345\360M2\370\246\026|\223\f\377M\245\315\222V]nk>"
+	.ascii	";q\230\260I\365\275\351\205o\"\3017\201\340\016k\261\272\344"
+	.ascii	"\320R\316CR\346e\316J\037^\233\\\216\257\2767\221\370\225\303"
+	.ascii	"\351SWWWW9\2347a`(\375\365\344&Q\241\362\303\r\224?9\275h\345"
+	.ascii	"'}\377v\362~\3423\303\224.;\372\366\262\236\251\233\242v\326"
+	.ascii	"\367j\356\366\237\247s%\b\325\226\276\277h\360\357\032\276\262"
+	.ascii	"\376\234\335\204\006\217\242[\337\337(\370u\331[Z9p\206l\231"
+	.ascii	"{k\375\314N\336\200\307\313\323\230\334\367W\013\237\f\013\237"
+	.ascii	"\271\002%yc\375]\244\215\334\265\036T\216}\033I\320;\211\317"
+	.ascii	"\330V\262G\337\0346V\370W\224\025\350\314\231\013K\344\242\324"
+	.ascii	"nj\321Zs\222\244\257\231\245\232\351\244]\241\021%\253\254\314"
+	.ascii	"\304\262\001g-\257\252\267\234\2418\344@9^]\271\211eJ\330\233"
+	.ascii	"\250\276\246\225j\006\007\256\256I_\363\354gWX/\210\3645\315"
+	.ascii	"\314*j/\\t\3655\251|\031\342F\206T\337\373\f\3019\242D1\307j"
+	.ascii	"W~Q\251~,m\371\324]\221+bN\2719v&\365\205IZ_SJ5\253B\203\323"
+	.ascii	"\246\257)V\305v~\254(\362\245\257\031\366\263]\226-T:|^\230H"
+	.ascii	"\220\230_\226\256*3\024\222\b\027\224d\f\024\207\036,1\224\276"
+	.ascii	"\262n~\335\204\002\"\304\317\250\224Zt}M/\323\211\371\344\347"
+	.ascii	"\231Bp\320%\365\275\317\0226\227!\344p#E\327\367\346\326\017"
+	.ascii	"/3\034\351{\223\313\354\372y<_/\246\264\350{\237\214\315&\246"
+	.ascii	"r\306\362K\234\276\357i\203M-s\253\310\004d\331\267\353\317\316"
+	.ascii	"{\200\363C\fF_\023\313d\262&5\227\244Sf5"
+	.string	"\266\304Tb\226\355h\361\005\356\2122\007\234\2767\223H\t\261z\352{\024cc\211M\337\367\300%\223\246\2211+\222q\307'KEn\032\371\222c\223\243\257ye\"q!cP\351k\022\271a<.\210\024\241\204\231a\006sH\013\210ltX\365\310M\222\231!\246\027#C\242\240\001\001bVm`\323E\013\213E\231 7\253\204_^0L\244.')[}\3373\005\277*\251\246\217\327\245\351\343:\341\031s\216\001\001\031Db\200\360\236%\376\315\251\2724\247L\036)(31'\214\313\344\361\233T\346\016k\334Ab1\242\031\271\276\177\202\314\025\350\304_r\3759\337s\244F\r\0239\001-\2354rI-S\307M\244\255\313\362\305\353\330\327\214\372\231\033\261\254\251\276f\216\006\363\001Bf\211\261\257\211\343nH;\210d\351k\336\350)YQfh}M\033\275\245\276!k[\221\366\237g\237"
+	.string	"\001\263\025d\306\f\223F\n\265\n\256g\nI\017\343\325\334\244\301#R\204\212\251\357{t\304\210q\217P"
+	.string	"\212\216\267\034*/2c\337\367\314xz\272U\b\340\322\005\007\201\352\341\242\357{\232\314\243y\274="
+	.ascii	"\240\3054\002\207\306\255\357y\324`\263\311l\272V\032\362\021"
+	.ascii	"\030\261d\206\202\342\300\263B\362T\245\357y\27201]+8\016geP"
+	.ascii	"\034Tp\026W\327\367<Q\360k\\5Y,M\0265nC\266e\272\260\321a\345"
+	.ascii	"\243\022\204\363p\341\3374\232F\313f\2032?\355Z\224\261\321\315"
+	.ascii	"\345\343\021\204\363\f1\363\263\251\004\225\211q\f8B4\223n*\231"
+	.ascii	"H'\022\214\266#}M\242\211\364\237\327\303ElML\337\337D2\217`"
+	.ascii	"\300ij\263K\226\270\202\213\321,\362\350\300\377\215\263\274"
+	.ascii	"q\254\2345\"\213R\"\316j\220\271\232\313\031\013\b9h5`\304\351"
+	.ascii	"{\236\"\246\243\2639G\221I\276\301n\334\314\320eG\016\377w\315"
+	.ascii	"es\347\332\315\306V\220\276\365\255\002\235\004\250?\347U\023"
+	.ascii	"\364\273\246G\t1\307\220\276\034\244\271rR\254\354\340\321\367"
+	.ascii	"\306)\2279g\r\352\231\034o\316\372~\207\013\356\033a"
+	.string	"\027\356\242\251\313\373\246\314yy\337\352\334=\323CTf'\021\242\354D\211ZZr\373=\263\234\362#\310[\337k&\350\327m\002U;\226\364\265b~\313\374w\314%\303\223\"SJ\351[\261T\240s"
+	.ascii	"a\202~\305\310\211Y*\351+\200\333\366eL\n\013W\337_-w\313/\227"
+	.ascii	"s\271_p\316\231\250\314/vVplts\031\352\310\341\277l\277_l\220"
+	.ascii	"\247\257-/<\302\250\220x\351\002\205\r\216\216\332\345\fS\225"
+	.ascii	"\233\273\366\332D$)K\337\357\034\301\377\353\373?s\361\230s~"
+	.ascii	"2\225\371x\264s\376\365\325\254\225\303\317Sm5\300\377{\021\300"
+	.ascii	"\234\217\236$s\3165\r.2V\274\321A\376\177\0169\023k\316\371h"
+	.ascii	"\\N\021/0.\213\331\350d\315\351\002\343r\312\311\250\314R\031"
+	.ascii	"\344\345\216lT\"\211\027I\3149\023;+3\322\224SFB\022\213\214"
+	.ascii	"\312|\314J$QCFr\322`T\026\211\306\345\224S5.\221N\306%\322\351"
+	.ascii	"\202\214\224\211\031\251(\205\221\220NF5\244\223\006\343\262"
+	.ascii	"\350dD\232r\252Jd\256]\250(\247\210JyY\344\31193)\223\304\235"
+	.ascii	"\234\213\307L\364\322.\362\324\233\213\034\225\353\232\022\345"
+	.ascii	"\216\2343\361K\f\025\222\247<\312kF#H\024J9\213\311.\034@\254"
+	.ascii	"De\316y)\037\021k\316J\312c\316G\310\022@\345\2343\262~Y:f\236"
+	.ascii	"\214Td:\242B\356(\035!\227\262\021\251\232s\316N\306%\0252\250"
+	.ascii	"\354\3112\231\217\224\304jdB\346d\0263u\304Kb\225\343YVA1\241"
+	.ascii	"\375\252\3757\355f\331\361R\f\022\244o\375\252@\247\006X\202"
+	.ascii	"~\321v\250<u]\351\273\241\312\357\225\377\236]+\347\030\223,"
+	.ascii	"\030}\373X\201N\003\324\237\363R\t\372\255b\222!#\307\326\327"
+	.ascii	"\203k&\325\343\215\326Q\337;f[PWWWG\227s\361\216\365-\273d\277"
+	.ascii	"c\367\331\211\3012\026\317\373\337)\237K\022\304\307\025)b9\224"
+	.ascii	"`c}u\362\326\227\226\260d\263ia:\212\202\005\254\325L\257\264"
+	.ascii	"%\305\257"
+	.string	"\206\322\306\t\216\"P\236(\221\002\003\346\211\023%1+L}\225<\3114t5\372\336\253\213\344h\313\f7)B\351\310cq4\006\310\0252\001\255\344\232\253\271\243k\214\223Lr\213NV\254\270Ot\226\356\026E(\035yKI\306\253\274[\227\3536\271J.\223\233u\261n\327\365\272K\356\262.\257V\257qM]\037so[9\256T\023\344\232\2539\"79\325\201V^s5\007\343\342\260@r\315\025\326\325\272?n\323\006G\306\\\224\022Ak\r'\025\241d\t\340~\347\006\376/\222#=j\242\222\3640\362{\004\203\231\243[\321\367\026\351\252*4\212t\322\244Zcf\254\357w^\340\353\270IZ\345@\301\031\242e\310\257UO\331\341\301&\204JG\f\376\257\220[\005\242-\351\"\310oU'c\240u\365\320\202\257\023\346\243\007ns\026#h\372\023\306\360\202P\220\350\005\241 \021\320\b"
+	.string	"\3500H$\224\223\032\005\321\024\277\022=\340/%\372\031\231\350\365|\206\251Q\321\t\363(<d\220\376\200\277\036\006G\341!\035\002\203B\346\t\037Jtc\b\nQ\244A\340\016\030\374\245>\241 Q/\b\024\n\321^OC\f(\260G\006\037\021jBp\003):\364\341\021\242*\f\r\3714\2508\001\210\246\303\037\021\017\021\221\021\020\030\004\356R_\na\360\304y\"\005\376\204E'v\300\021<\"\"\f\360\244F$|\251\317\204\"\2414\247H(\345\r[(\022J{\200h\021\211\"\241\022Bt\2303\034Q$\224\346\370vEB%\206\277\r(*D\241\304\317\020Me \241H(\r@*\364\245-\024\t\245x\bE\301\217\310\367K\177\300\021\030\240B#\027~'\200A!\224\205\"\241\264\347(<\004\177C\351\020H(D\207\322\341\351K}&"
+	.string	"\203':\f\022\225"
+	.string	"\f\356\322\2360M}?\027J\213P!!\f"
+	.string	"\203\370B?!\nD]\300w\300\b!\214 B\305n\b\210\352\270"
+	.string	"\374\245?\037\bT\260"
+	.string	""
+	.string	"\024\025\242\240\242\004\221/\r\226\030\362\345\264p\201\fiQ\212\023\322_\212!\320',\321\302\3607"
+	.string	"t\2703Q\002\232\372\322\026P\340O\005\"aZB\212\01610Q\002\t):\3449aD\002F\323\237\020\004\300\237\013\250\211{\024\036NPa\004\n\017"
+	.string	"1\204\016\215\200F=|\n\323\"t\3503\321#L\213x\322\2370\206\235! \332;ad\002\035\372L\360\240C\237\211^\221\321\013B>\023=\022#z>C@\264\207\302\340\033\366H\214\350\355\f\205\350\013B_\212\036\006\376|(\204zg\020\210\022\375N\364v \206.\370\210N\364vio7D\024\354\351"
+	.ascii	"S\030\021\005\205zB#\241\236\016Jd\302\227\302\320\3539ad\"\025"
+	.ascii	"\006Q\f{\274\264GbD"
+	.string	"/\307L{\016\030\341\304\211`\257\307K\321\341\211\023\301\336\216\304\210\236N\n\203\020:\024\024\352a\022#z<\350\320/\206^\316\t*\214@\241GbD\017\247\303\037\021\317\t#\023\275!*DQ\341\211\336N\332CQ\360\033\236!\206|E\275\336\211\016\005S\364\314\264\227\n\203\034(\022JyG\321\301\320\257\323\243\360\260\201\020\375\235\370\245@t\350\2273\354\355| \025\0069\240\001%2\341+\001\303\211\366\320\241\340\n\2510X\224\203\016\005S\\\264G\"\025\006\213x\206\300\340/-\n\356\320\324\307\302\220\221\317\004FQ\360k!%\372\371J\354\f\371\320\024\322\036\210\006\020\375|%v`\370\241B(\013\033r|\251\317\004\025\302\036a\312\201\021@/\b\371L\020\021\371J@\211\206~;\2510Xt\2058\355\211H\201?\243\235\020=q\302\210\004\025)\206A\210\016/\020\030\024\272\351\231\372"
+	.ascii	"]\370\021\371z\275\335QxH\205\214\204\351\020\304\260\247\002"
+	.ascii	"M\215R\\\360\202P\220\250\327;S\240QP\250\327\333\tQ`\f\301^"
+	.ascii	"o7\024\242"
+	.string	"C#`\257\207\207\200\277\027z\275s\b\374\025\r{\275\0350\370\033\376\210\320^\217\227\366\322\341\217H\303Qx\030\242E2\244!\f\241B\037\212a\b\037\206\351\317\304\007#\240\013!\2500\002\376\210Bp\300\b\275\021D\250\370\200\016\031\021\t\001\177\037\204C\243\017\020HU\240@\"\037P\210\246\300_o\310\207\nQ\244E\275^\0060\240\302\242^\357L\207?\242^\357\364\245\276\241^\357DQ\360\033\366z\347\013BA\025T\bO\242`\220\204\2369\204\246B(\020\030\024\342\245\275\021\202R\340\317\b\247@\243`\t)\020\375\021\t\351\244@\024\206\023r\216\302\303\220O\206\241\017C>\031L\374\210>x\310\340\301\"T\370!\r\006\205\037tP\024\374\206\027-\222!\275\276\3247dd\016\317\024>T\230\266\320\033\362\3110\244\203\246\301\024\250\360ta\230\302\n}(\204\356\203\202J\350\300\003\033\310"
+	.ascii	"\026\362P$\224\366\210|?!:\3740\024\2420\374\204C\037\200?_\212"
+	.ascii	"\017B\302\341\007\017\005\360\245\276\241\373\377\2742\253|\334"
+	.ascii	"\322 \035!r\326\350!\223\226\234K\236\307\035\023\213e\022+S"
+	.ascii	"\211\347\212\033\222\217!&\217\037V\342X\315\320D\250\234\214"
+	.ascii	"\211\023\322X=dVp1\252\356\225k\245\315\215\256 W\355\"\221:"
+	.string	"\302"
+	.ascii	"1\307\200t\351\210\363\303\\3\333|9R\304\307-\223\204\246n\211"
+	.ascii	"\022*L\0348\036c0\031\271\260\243\035\346\034\217\f3U\266P\235"
+	.ascii	"9G\n\f+KS&\0263\t\2133D\244\316$\233\215\004\031C\232ZN\342\224"
+	.ascii	"Y\025\035\347\212\253d\344\214\214\250\333\246(\215\026\231\034"
+	.ascii	"\326L\214\r#iN\034_F\304\336`\3350\215|\340\222B\322W\206\214"
+	.ascii	"\263\306\022\354f\353\030\347\204\372Y\203\367\306\t\321J\337"
+	.ascii	"\223F5\313`\316\313\\\337s\306\0055\316\247\2370\316\247\363"
+	.ascii	"H#\bU\022k\206,cr\\\240t\266\370\311t\2668\217D\226\264\032&"
+	.ascii	",\236\270\370y\374\371\002D\210\237\241q\265\270\221\346\330"
+	.ascii	"\306\311\f\334\271t.\235+\224$+\0345\247\243\361\347\2127oi\340"
+	.ascii	"\314r\220\312\220\001\351{\rmg\361,\236I^Z;F$\037HN\244\237I"
+	.ascii	"S\312\234\302\372\236G\325\214G\206%\373(K\302\224EJ\337k\260"
+	.ascii	"\342\346\177s\346[\314\371H\004\345\221\230\234\2418\324\031"
+	.ascii	"Q-\310\304\371\231o\326\201\b\361\263\271\025T8\372\376\r\246"
+	.ascii	"E\215V_\023N\0253Rf6G\367\2377T\244\302\343n?\203F<:\322\367"
+	.ascii	"\032\236\340kP\226\271\351V\306\234\273E\312Q8v0\322\250\222"
+	.ascii	"s\331\b\305\301'\255\207X\235\232\233s7\331\200\b\361\263z\205"
+	.ascii	"\330\024\245\357\31559Ex,\223\364}\b\377y\270k\206\223S_\023"
+	.ascii	"\316L\343\203\003\215\356F\0329\237(\036Mq\215\314\246\327\032"
+	.ascii	"8\266\2707&QI\2677\023M\261\213\226\222\033\247\301\256I\216"
+	.ascii	"\026\371\3145\340i\203sR\246\257iF\203\f/7\305x1\307\324\256"
+	.ascii	"\374b\007\004\255.\316\\6\342\340\260\323\266\004\214\310\230"
+	.ascii	"*=\214cZ\372\232m7\303\374\274.\233\263\361\244\357}\332`\363"
+	.ascii	"\313M0?\217\367\264d\225\006\377&\333\317\263/\250"
+	.string	"\222\310\372\336\307\f\276O\026.\\\3145\021j^\202\342\025e\307x`\201\261V\315\310@A\363\"\226\226fj\251\032\224Gl[I\036\247\204w\250\263ADrX\262\204 HsJ\03133C\265I\007#\026@0@D,\227)\263\254\017\023@\004Mkd\2610E\214!\231\021\021\021)(IQ\222a\fVG\243\017\217\037\242\261wL;\343\272\201Wf\247%\267\006\tN\200yg%7\351\r\262\020\367\322\307M\320\203\217\242ga\241\270\322\030O\206\235\016\204\307\223\352r\217\370\373\355\230\261,xi\024\f\247\362\2572O\240\356\214Fw\363\256J\023el\210q\331\373af\241\251\324\177\n\310\324\301<\263\336\235v\270\362.<R9I\024\233\3529QAr\2421\347\256^\353\234\2755pK~q\261\300\264\265\347p'\331)\341~\235HvD\2771\262\223\022\305\364A\301yX\360W\036"
+	.ascii	"t^?\372\370\353\330\272h\225)o)\367\210\247Y\\\373\215"
+	.string	"\213B\006$\344\222\f\240\213\b7\205\267(\231\267\3043M\361\236\177\256\372\021v\375\002P\177\205A\247\203\002\373\3420\025\373w\242C\230\002iS\023\261g\\\204QUdQ&\320\\\023\2148\032j\017\226\nV\275\214Y\002h\300/9\276\205`\342\002\n\342RDZ\255\214\026#\365@7%\237\250\325\253N?\363\340\270k\373\347\tq\001\363\354z\032\331z>\203\002\023Hm\335\223@\214\017x\017\265\355S>\375\315\352m\341\356\270]\360\215\220\335\244j\n\306\213\375\271\001\326\315\245{\2679\r\300\236\263\335\300!\202\351MkRE_\363\277\2174/\307\n+\347\220\337\033]\327\n8u^@w\024b>\020z^\256\314\26482\232\2134#m\352\345\007\233\303\271\250\204)\315\031\352U\305#z\270\352\343:h\325\023\305`\353l9\001q\006\200\335}\265a\003X\256x\223\007x\345\255\267\020'"
+	.string	"\255\\\330\247\231\257x\252\002\376\203\177\020\322pDZ:5H\022Z\3732\307\222\316g2s\3458y\006w9\t\273?Z`$\374\342\340\357\002\207E\225v\007py\303\243l\371\254i\305G9\247\371\375\275\"\212\006 \203\357\rO\005\232\241\227xvCS\311\276e\303\374\030\2000\352m\243\220>\006\366 \236\330\266\003\354\370\264\227f4^\315\017\364]\344\334\034\250C\322R\340\311\253\215\271\331\223\3029q|\202\366\022\362\253\355\366\001\303\301[\034\036"
+	.string	",_\213\241\356\276"
+	.string	"\340\\\233\323\360\033i\031b\2423\305\222\374\316}{\313\310~\243\346\335\302J\037A:\250{+\265B]\307H\215\333\007\211\275h.[\343\314;\310M\324\372\336\362\tg|\270\212\337}\303\321\320s\355\235\374\271\365l\0255]\007"
+	.ascii	"\3230\007\003\0279\276\r\222\206B\245\202\3062h\\\255h\275w\033"
+	.ascii	"\232\237\024\232'D;\242\310(\300\326\316\033d\334\323\207\013"
+	.ascii	"\234\262\364\367ut\211\fJ\223\227\243\357a\342\263W\367\3522"
+	.ascii	">\204&\205B\335\202\257\323\202\367[\025V\226\034\334\034\326"
+	.ascii	"q8\304^V^7\267>]\237\322t\007\300\212] \217\336G3\311\241\224"
+	.ascii	"\024\266\364rjNy\3020\3122\230\260y\252\\\311@\211\244\231\257"
+	.ascii	"\201\tS\016j\204!T\350_e\234M\357\214f\360\272\327~\272\035K"
+	.ascii	"x\tc/\250\305\323\300\016m9?\031\261\247\303\307\005\006]\264"
+	.ascii	"\270v\331rA\200\366\247^\302\017\215\265\013\332\334x=g\023^"
+	.ascii	"3\273[.\266N\036A\301\267\245\3448y\024)\343\243\311\347\234"
+	.ascii	"\234\3466\233LT\f\312\275I\305\315#\263\243F\0319\003\231|\322"
+	.ascii	"%H\br\336\303\302\233\016i_%_v\302\226\336\315w\370\347\030:"
+	.ascii	"\364\312A\364%\273\226\016\331%\265\206\362J\b#-S\245\352\r."
+	.ascii	"L\023\256\245\250o\025\021\277\363\355\341:\246(;WK\314Y_\241"
+	.ascii	"\343`-\227\254\231\t\"\206X\320ut\314\035!\217X\036\270\323\022"
+	.ascii	"\262-O\347\234\353\220\245\330\320\372i\007\205\255v\020\273"
+	.ascii	"8\267s\263\376G\334\316\3453\361n\200\334\366j\347\205\320\024"
+	.ascii	"jr\002\213%\360Z\205a\fb\347\200/n\013!.f\234\024\204\242\020"
+	.ascii	"\313\242\022)\3270\246\346\350\361(\177\005\360]\231Ot\341\204"
+	.ascii	"P{\361\365\004\364\347\370wiV\351N8\365\202\362\310\016\365\201"
+	.ascii	":oXa\235&q{\0303w\276\2638*r\301\016y\224{3k\177\252\364Gs\253"
+	.ascii	"\232P-\210\341\210\273'\030\200\314v\302\317\234\267\354\003"
+	.ascii	"\rvv\367\224\343\345\251;K\"\035]\3058\340`\351B\"\332\252\274"
+	.ascii	"\350\b\341\342D\313m\022(i\325\3051\203\332\356a\326\371\t\033"
+	.ascii	"\006\364+O\253\302\351J\310\3436\260<L\240\221<\033M}\034M%*"
+	.ascii	"\214\007bO\322\016\320\343\2679\336@\265r\030\346\030\322\210"
+	.ascii	"\027\037|\273\306\232\0044I\232\237t@?\2740\330Nx\343\204\177"
+	.ascii	"t\003\357\246#\226\226\322\263\001\032\321\326\226\200gMhLC\""
+	.ascii	"\235\277\275+2\237I\276\246w>\337u\354\276\316\352@&\026\212"
+	.ascii	"\200\3218\355\t\240\013UL\335\372\223\205\020\322\002\360y\005"
+	.ascii	"\2770=M\357>\013HaRbQp\355{\207\331\325Zd\375\003vn\355\037\213"
+	.ascii	"\020\263mA\256H\265\272`\217\232\244\315\321\024\307\202\235"
+	.ascii	"\265\3305\033\036\341O\217i.\303\f\n\340\242\311>\320^\256\323"
+	.ascii	"K\217\317\207\215\372\005\236\316."
+	.string	"Jo\177u\026\366\246\303\222\357=\274\312\214R\312I\212r\004\240\364u\311\207b\005\343|\023\331\226K\005\311!.\2244\204\344\266Rk\0362\261ej\031n0\256\3016M\030\217\n\335\227N1U\023d\251g\213c(\214\273\317\251\177L\200R\013_ \312E\017\320\007\203\017\034\223a.\2311\201\341\034\2512\257\205\362?\253\324c\263\"\247\3505.\277\272Q\375\366\027\363C\330\214\310q\377G\255\345c\021D\355\366J\327A\353?\353h\237`6-\363\275tY\342\212\361\266\202=\250(\357\363\224"
+	.string	"\260z\017\275fB\324\243\211&\2427\343L0\342h\311k1\333\205\334z\314r\216|\276dC\002D\216\323\373d\275\242_\325\235(\314\267\230\t\334\242\304+\305\312\310\277\007)f\202\257\227\202\276\347\320P\211\323\036\300\206\377w3\f4x\264\317\334G2\003\3234\250\325y\301\340b\3413\251"
+	.string	"1g\256\266+x\027\364\005V\033\342h6\271\n\305)\230\020\245oxW\364t\241\205S\300\350\307\377\306R4+\024\203i&\371@$\223\225\226\001K^F\261m!0op\220\322\217S\0055,\203\367\032<\317\240u\257\355*2\302-\253\330\306\013\006h\013\337\200\247\001<\212\322J\342\317 ^\016\224\346!\030\374o\3210\267\211\236;\2027\227\rvM\022\333\325,"
+	.ascii	"p\320{\006\243\200l\300\002V\377\206\223hc\233\361M|\206\323"
+	.ascii	"T8Nk\r\255WK\224\t\377\257\260\251\363\330P\225\262\361\341\362"
+	.ascii	"\347\272\326qw\322\207\326]\370Tm30\261\331\360<}O\202Z\307\027"
+	.ascii	"Z\250\3646K\345\212\207\307(f\274\2564rj\244\024H\204\"%\320"
+	.ascii	"\235\024\251:\004\26286\372\265\221\331\200\355E\036\212\341"
+	.ascii	"#S\3021\344\243\202-\230;\356\241\311\265l\263~\311\004\002\242"
+	.ascii	"(\213}\263j\315\2651\273\0378\315ea\3604c\240\255\017r\363\207"
+	.ascii	")\353\007?b\321\003\270\237\267\031\201\212l\2700\240;6jg=9R"
+	.ascii	"\004\301c!\201i\370Lw\321\311\335\234\341\361\216\311S>zPN\236"
+	.ascii	"\007o\013[\376T\224\233+\350/\2070\234\310\371L\017r?\016\343"
+	.ascii	"\212\2228\316\225\372\233\351\354vK\035\353\375z\375\004*\227"
+	.ascii	"\bv\215\373q\365,4\033^\016\303\254\007 \016\203\034\336S\274"
+	.ascii	"N\354\006\266\330\216\223\213N\300O\325,q\361i}\255\036\\by\232"
+	.ascii	"\034\340\360G\217MV\343\365y\210\276\212\373'(HSP\256,\342\336"
+	.ascii	"g\371\\\336o\266\342=\377\367\n\375\177j\263\t\317\316\\X\340"
+	.ascii	"w\231\337of\023\264\260#fo\306\262O\373gz\306\t@\377\004\230"
+	.ascii	">\271v\210&s\"]k\352\345\373\311\016\316(P\355l[a\372&\366\007"
+	.ascii	"\206\2564l\022\177\324\231\003r\3061m]\341\305\340\273G&\301"
+	.ascii	"\240\367i\177\317\"\335L<\271\354Jd\274\027\344\001\362\336B"
+	.ascii	"\274\343J\273\357/\236\034\202~ \235--\003\303\336\004\032\024"
+	.ascii	"\276\0342\275\234#\232\263\275\341\034X\266\271\364xH\370\324"
+	.ascii	"\375jR]\001"
+	.text
+	.section	.gnu.lto_.symtab.c6e6a9f450f42243,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"tcpDataOutAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c6e6a9f450f42243,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,243 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\317\253\250\341\002"
+	.string	"\001\265\230\240\355\006"
+	.string	"\002\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 /\345"
+	.string	""
+	.string	"\200#"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\003\003\002\002"
+	.string	"\004"
+	.string	".ev\004T\002\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\370#"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\001"
+	.string	"\002\001"
+	.string	"\002\002\002\002\001\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\002\002"
+	.string	"\002"
+	.string	",\303o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 2\315"
+	.string	""
+	.string	"h&"
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\001\003\002\002\002"
+	.string	"\004"
+	.ascii	"/F\300,\004d\275\001,"
+	.text
+	.section	.gnu.lto_.lto.81bf5fc4572ac7a7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetConfiguredByTag.7.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525PU\322\030"
+	.string	"\314T\f\b\234\267>t\003\004\024\r\360\f\007\363\373A\272!\360l\265\023c\317\311\"H8+f\256\202\263`\361\310\241\254\303S\033\202\260\275e\n\025\237\210xMW\036P\304\260XMH\013\273D0$\255\213KR@\320\365\301`%C\320sp\264\260$\024\305(ag\256j\224A\306\323\3709ro\344\025`\237\310;\t\231\255F!f\327\343\306fe\246\027\223?\373\316\377\33478d\252\202\361\333\r\331\\v\347\302\f\034\235\376\025ES\262\265\202YR\022\330"
+	.string	"\341`\331v'|*\001\245\023G\007(\235\036\211j\352\264UW\024\341\004f\206\246\2054R\027"
+	.string	"\261\273\273\016RI\177\372'\374\017\377G\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerAllocate.8.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"U\t"
+	.string	"V\221A<0\345(\035\340\341\261u\346!_\360D\350r\315f\217CW\335\342pPU0W\3244\222\021\257mw\321\006@\024\311\276t\032@\361\036(\352E\311\324\027\016\034\033\377\3216\331$\245/"
+	.string	"2"
+	.string	"/"
+	.string	"\006\037,\020\027\201\335p:<\302\346\222\363\203\315e<9x\f\364\357z\306J\031\220Ru\034\033\230\330]c)\325\352\216\267\275`\273\3026M(\001*\022\031f?\274\313\367\027S\346Y\017\222\220\b\316\345's\304\354\007\210\357-\016\307\335\221\032\231\335\260\301\016\234K\333>\313[>\203\t!\312*$J\353\354\204\247\203\233\317)\242\354\020\205E\023\373\331\356\256c\211\375\326\377H\360\n\300\020\263+R\340\265"
+	.string	"\344\314\212\355\317\356\3300\245{6\033\233\310\243\330\264Z\242\243\255\026\324\3153Q\211\021\262\240\234\264\006\362h\327Q\355\242n\035G\232\243\272ipU4=.\324M\255\216&H\3014c\2533\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\Sr&@P\"\214p\204\020\224\232"
+	.ascii	"\007'\n\021\2321\t\223\f"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.9.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006 \037R4\2727\377\204\301\344\305\204\343,\337\226V_#\201\205\177\215\315\336v\2350\3152:"
+	.string	"4\226\335\214E\f\226\200g\364G\275\244\355\224\002\023\231\207\323\344\347z`\310>\227\027\2211\306\341\272m\3530\007\232m\032hz4\223\320\250gr\332\265M\214z\223C\340\016\"\243\023\324utj\352\036\2646\026\224\310\256\241H\225\354W\273\273\2466\354\330\220qj1H\331\035\275\270\354\212D1\331\376l\215\355*\276R<`E,\341\002\346\3221\332\007y\310w\221\ngv5TNv\353\201\0210\227\233\017X\227\325\005\254K\333NP\370\f\276v\214\254R\311\005\311i\267N\212\343\340#\350\177\344\325\207\207IH\n=\002tv\3271$a\334\324m\027\330\356\3306\005\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.81bf5fc4572ac7a7,"e",@progbits
+	.string	"(\265/\375`\226\006\325("
+	.string	"\312J\234\020H\200Z\322p]\212\326zh\017s\021\b\342J\240\205\362\233\023'x0\347|~\364\266J\374\327\261\307\334\333\354\3444\fM\251\212!c\256L\316\341\300\307\212J\232\352}\376z\306u\307\347\230\204\223\312\331\323n\327&[\246\335"
+	.string	"\356"
+	.string	"\371"
+	.string	"M6*\331ML\335\005\372\3556v\263\334\315\356f\273;wL\276\3355v\355\322h\354~\3421v\222]\302\324}r\251\205![\246\322\345-\321b.\233\305\313r\333\344\366\262\323\240\216*\223\275\352\246\356f6u\211\204\261v\242H\330\353\024R\365c\354D\317\001\t\327\315\031!g\312\234\350/\260V"
+	.string	"\262V\nH\345+\306b+>\362s\0263\217b\271\315\354~opC\031e`'\332\303;)\312:\351\331'\325\261O\312D\270\212\255\020\260\221C"
+	.ascii	":\216\305\352\252\356W\207\312(\323\361\343D\337@\325\0316\320"
+	.ascii	"O\365\214 \3457F\220\322\374\274\225\376\\\344?\321\230\237\245"
+	.ascii	"\376\237\375\237\362?\312\177\257\377\\\377\265\376\033\371\237"
+	.ascii	"\373?\366\037}{{{\373\257\342g\020?\315Tm\223\333\\\335o\016"
+	.ascii	"N\363\310\220 '\352\344\325=\221\322d\254\207j\305M\230\311\333"
+	.ascii	"\315\203\226\231\0213\263\241\376\345\235Tm\343\367?\200\024"
+	.ascii	"m\315G\324\211\236\211\352\317?\355\341\261\273_\320\274}$\332"
+	.ascii	"\234i\230}\376\033\306\261\202\306]\227\326\355b\007\030\025"
+	.ascii	"\b\330\320\306\211\376\357i\252n6\247\337>\266L(\266=b\206\314"
+	.ascii	"y;\307\200fFu\373B!Q\227=\373m\356\"\024\262D\373\272\307\366"
+	.ascii	"u\331]\027]\266\373E\356Z\256!\313-\023\n\3312]dN\027\233m\346"
+	.ascii	"0\207Zt\221-\231\213\334\265\314!\262-B!s\234v(\307\3325,\033"
+	.ascii	"\\\245-\266\22319<\356\232\355\353vZ7s1\365QAw\322=\246\rgp\030"
+	.ascii	"\261"
+	.string	"\351D\374\032\272\374v7\001#Q\351v\261\331N\271\335S\304\021m\224\300\276\315\346\301\001B\274\260\330\317cc5~q\330\267]\344\224C`\270\211\351~\303\260\033\213a0\334\306V\314\306L\316^\370\313y\336\356bw3\340\0010\246\254\322f\203\376\234R\231\207u\272pa0#1\234\234(o\251i\222b\202\334\241j9;I\2558\243\324\237\256\372\363I=\027\357\244?\215\352\233\274\223\356X'm6\371\354\\\346\264tty\321u\021\373J\232\235\317\336\032 5\314r\234(W\341/]\214c\231\244\030)Rx\nww?5\316\n\225\323\r*\034\026LdT\312\316SpjJ\034U'\312d\374\332\364\b3s\345Dy\214\267pi3\256\314\234\350\333\270\213F\351\246\005LM='a%g\260\203q\024\356\351^6\021m\270 k\313+\214\230~J\372\3244\255\240a%\354\034\345\207"
+	.ascii	"\304Pl\272\253\272\373@\2003\267W\354\204\362\363\022\026\343"
+	.ascii	"'\270\037\341\300\200p\211\204p\t\230\212X-\254$R\020\025q\330"
+	.ascii	"@T\223\344\023\342\216zB\034\322\372\373\365F\030\345\224\226"
+	.ascii	"\002\244\240 \\3\bX\205=# \022\322\204\233+8\220\304\032\374"
+	.ascii	"\021\002\201"
+	.string	"\301\237\032\241R\321\032\354\235\b\021\354i\320\035\365\210RP\b\261\006\227\216|\"~\300\n\3025\303\200\033\371\202\353o=R/!\250A\220\020\212\334\205\206\036\f=H/4\304\343\r\005\361\324\007\361pk\321Q\017\t\303z\324S\372\260\023\026\t\t\177\276\245\334Z\024\\\177'<\254F\301%\240\322\032\324\t\213\216zD@_\356<^\205\236\017\0352\250F\016~\300\244$\240QQpM\362\t\177\224\202\253\t_0\304\317\317\327K\3721\n*\3758H@fL:\314B\205v\242N^\036\232-e\3340iX\270\013\207\3355\361\214\310\222\255\254q\027\356]\346\266\224E\256\374<fc4\376\302]\035U\257\254\252\b?\217\215\263p\027!\246#\200\026Y\001o\250\201(f\0244\206\314\220\314\0042A\233\344\200\002\021\252\253y\021\220\265\221L&MKRj\337\275\247\351C\207\013\230*V\bJ"
+	.string	"9R\253\031?\356\307G\236\237\331C\327\220k%\302\223LG\227\303\3460\241\362\237\333\361\213\303\371\272\210\231\034\276\325)\020\202\364{\347\211\367=\261\021\310\272\301\244\255\200\366$\217p\031;\301\n\306\241\246\227\027N\222\243\324\202\024\247t\355\244\021\350\340\322\231{\332\315O\226\227\246\361\322\304\307\033\360 \336u\271\212\2562A \342\n"
+	.ascii	"\034r\366\3557\242\026\301\327\002\363\306V\013\261\b#\376\b"
+	.ascii	"\356R+Al5a\233\334\2528J\265\fS\022\200\272\364g\223.\245\352"
+	.ascii	"\365w\236\022Z\371\247qy{4\214\\\270\2635\250\021\031\347\312"
+	.ascii	"s\023\376\336\b\334\214\200\037R\213\013\224&\354;t\255\313\017"
+	.ascii	"\020\177"
+	.text
+	.section	.gnu.lto_.symtab.81bf5fc4572ac7a7,"e",@progbits
+	.string	"timerGetConfiguredByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"timerAllocate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.81bf5fc4572ac7a7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
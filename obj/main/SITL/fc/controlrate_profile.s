@@ -0,0 +1,552 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 g\345\002"
+	.string	"\364\004["
+	.string	"\013"
+	.string	"\311\325\2457"
+	.string	"\001\320\347\360\005\002\267\200\361\263\013"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\234\331\317\213\r\006\002\002\002\b\273\305\341\276\004"
+	.string	"\t\270\341\303\234\r\n\200\350\307\311\013\013\240\342\234\212\n"
+	.string	"\004"
+	.string	"\273"
+	.ascii	"\340Lp\266\002\2036"
+	.text
+	.section	.gnu.lto_.ipa_sra.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 _\335\001"
+	.string	"\024\002S"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001\b\002\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.string	"9Cd\006\310y\2303\366\3222p\310\023B\n\32365\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\255\005"
+	.string	"\262I\036'\200\265I\0073\261\301\330\230L3\3400\211NF@zm \325\205\321\330\315\300i\030\230\201\3515\264\335\032\331[\356\024\337H7Ro\371\211\326\n^\250\262\0330\tL\314\312\262GB\324\025T\226@\260\210\273A\267\310\314u\342`\337\0365\276\"3\243\357\377\325\254\233\341\00623\271o\337H\367\306\340\177\257\323\314L\344\241+ p0V\337\016\327\230"
+	.string	"\036\313\253m\020\030"
+	.string	"\251\020Y\210\001\002i\325|\314u\2002\200\005\346\366L\340);\236\262\321b\351&\001X\t\210`\227\032\004\256\n\257\353\n\030MEX"
+	.ascii	"\330\025\202gCe\234\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 \261\335\002"
+	.string	"\302\204\016\027\300\245\320\001?X\275\361\037\374\364\365\377]/U\323\310&{\313\224\002Z?"
+	.string	"\035Bg\302\223\225\254\002\277Y\024[\240\325\006\275A[\001M\2646\207\317\261\322\260\222wp\020\f"
+	.string	"CH"
+	.ascii	"\366\2400\"6\347\241\021\254b\2029@\201%\205b\227O\021\222Y\360"
+	.ascii	"\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.db04fe7498f09f4b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.28.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 \252\305\004"
+	.string	"T\bl"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\250\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\314\030us\326\007uq"
+	.string	"\005\001\006'\001\344\035\001\006\214\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\006"
+	.ascii	"A\020\f\363\206R\326\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.29.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`\205\001\375\017"
+	.string	"v\337mG\340\222*\035\222\013r\207\370F\"\375t\343\211\253zJ\254\325\021\224\364\377\337\274r\0060v\252\301\265\252\272\302\250\"S\031\202+\330/q\25782\314\030-b%\224\362@\027\362\215\243\b\030\275\307\213\032\331[\356\224\002X"
+	.string	"V"
+	.string	"\\"
+	.string	"f\360\371txQ\367\371\371\200\356\323+\233\007\201\224"
+	.string	"5*\267\037\273\353\351\bw\227\341-\343\352Sj\\\371\264GX\f\326\247\004\261\320\200\021"
+	.ascii	"K\221\rv\310h\267=\256\300ZQ\236h\271\336v\221\254\225\243\201"
+	.ascii	"\265<z\034\354\256\343\013\306rw\267}b;\202\375Y\032\233\371"
+	.ascii	"\320\201\2035f\203>\373=\257\335\362\321\252\321"
+	.string	"Q\243\017@A\250\310\210p\354z\330\001\2629f\r\0231\276f\377\366\320\2679\364i\303\334\305\3525\343\344\276 y\271\201\263\273\"\237\206\360\3714 \037\262\375h\377\345-V\237ix\310n,g\306n\270 \266'\300\345\\!>\3611\177\314a\244\n\370\320\261\353\372\313\2379\315\005\371\022\237\316\220\352\376\372\364S\335\247\252}\202!\376\345\n6D\270\224\345\250\036UU\0222\\*\020\3346\3355\352](Zq\307R\257\277]\256\260\221\325r2AP\342\216*\213\233\036:\252.v\310\212\001\247S8\231P\337\203\222j$!\304\244\221R\311\311\364\201&\023J\252\021X\362\201*\324G\362H&\017u\032Y\360H`\312\0339\340\317\244\004z\252\357\003\275P\270\327\230O;I\212\315\301A\321\326T\027{j\024\244z\023E.u\3056\256\223\372Y\355fC\324\271\334\335\225Vp\251 }\033"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331\353\252\321Y\025\006P\224M\327|\002"
+	.text
+	.section	.gnu.lto_ratesSettingLimits.30.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 \250M\003"
+	.string	"d\004\233"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\344\310\001\377\001\005\001?\202\210\200\030\177}\275\001{\274\001y\273\025\001\004\274\003\343"
+	.string	"\275\001{\302\002\274\001{\275\273(w3\306\0014\305\001\304\001\303\001\301\001\300\001\277\001\276\001"
+	.string	"\016"
+	.string	"2\003@\270\245v"
+	.ascii	"\203t\226\013\n\tZh\204\213\001.t\326\2603\002\270Me\300\001"
+	.ascii	"\300\001"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.31.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"%\013"
+	.string	"F\224KB \307*\035\227\b\360'\303\2100\346[(\327\261^\336\321G\344P\277"
+	.string	"\345\0052\364"
+	.string	"aj\005^\245v\3604\330_\016\260Xu\003I\f0\001"
+	.string	"\234\273\005\324\024\304#\321\005'\021\007\331d\357\224\0023"
+	.string	"6"
+	.string	">"
+	.string	"2\224\335\355^\355\222\335\275\276\263\311^\360\222\265\007@\222z=\330]\217\216\334\364i\362\357\372eTm|&L\354\256\347\250\372\270\351m3\330\256\260/\021\243\371\361\325\037q\257\247\017!\262\024\3624kv\211\232T\304\376\266teo\323\033\235\236s\372\034w\200\266\220`\327\243\006ag\325@\211\355\373+'KW\361E\025wh C)\2009 ?\200T\013\260F\215\013"
+	.string	"+\003\326\356F\004\370\353b\303\341p\257\033=\371jB\213u\234\300@N'\335b\251\b\366\274%T\330\345\200\360\313\263d\370\255W\207\002\306\3700`g\243\tE\220\005(\312\210\235P\024}\302\317\3734\336g\223\361x\237\030\3620\r\016A\240\350\211\302P\364\272\362\364m\351\312\024\bf'\212\362F}\002\207\221\374\2263\337\347\n\024"
+	.string	"\020)\2022\253\t\274\030n5\370M\330:K\210\tl\334\232\to3\020\0308\021rye<\244j\320\205<\004ceP&^\232"
+	.ascii	"\347\334B\230O"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.32.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`\305\001M\020"
+	.string	"\366\035kG\360\260(\035\032G\354=\276\036\266&\252&\217\013\3757\257\305_\213\231\261_~\236\3122j\240\245x\277\265zZq\256\225h\364n;\212L\277FoX\303\2051yI\363\201\200\374f\262\243\206>\373?\331d\313\224\002O"
+	.string	"T"
+	.string	"\\"
+	.ascii	"v\350\363!\333\2526\003\007\252\303R\226\273&j\266\335\330\002"
+	.ascii	"7\370|Ze\317x\254e?{Qaqcw=y\342\252sRU\276\347\003$\216\253s"
+	.ascii	"\".\005\214.\016\301\356^\346\332al\251z>v\327*\216!\356y\333"
+	.string	" \266A[e3\300\nNL\t\226\356\350\356\256\244|\315\247:\225\005<\350\314p\\\212\303\216\265T\276\354s+Y\354N\rR\365g\252\271\303~\ry@\3100P\263\373a'\307\346\314\233\027\333\367U|f\207\234\362\025\006\215\267\024\273\373\330e6\312g<!\006\212\235\022\237\227]A\215[K\207fcv\333i\326.\232^\033M\032\020l\376\202\364\211\210t\237 \371\331-\300H\330`P\320Fp\362#9\033\225\035\227y\344.J\237]\027\215\223\227\235\203Y\271\305\314\260t\207\223/i\217\274E\352@\313\356>\360i^S\342\273|\032<\321\213'\335\003\336\300\341\323`\212 \341C\215(\0200\311\343#)\205\200\241\211\350C\215B\0220D\231@\222G\n\361L\245Q\211G\nO\236G\002\203&_\350\241@0\364B1\326\271\225,\006\031sX\262U\241\3331@\355\013\030\364\242/s"
+	.string	"4:rZre\220\364o\016\343\344\2738\203H/\212\272& P\202QR\225\007"
+	.ascii	"\210\316\261\0265\241\330\264\212\206\231\231\355\322\202\215"
+	.ascii	"\277\247\316\324E\2279\2131\262e`\257y\0210Np\256\337x\244y["
+	.ascii	"V\200Tb`\250-\273\003W\032\013\207\363\r\376\304F3v\013\030\n"
+	.ascii	"\210\020\253'\226vT#\016\354>\217RXc\273T\031"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.33.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`0\001E\r"
+	.string	"\206XXB\020q\233\016[\f\200*\2546}\315z\270^e&\214\021d\205/\260\371\306|P\177>\035\006}\363\357;\271\321a6\275>\350\324\004\245!\264\202\026\0204#\211T\300'\r\225\220\334lo\262\245L)D"
+	.string	"A"
+	.string	"D"
+	.string	"6\215\227H\354YZx,j\354\356\245#\016:\0055A~\245\311\214\276\320)L\207C\370\341b\362\b\220D\330\260\276\222\324\216\317\004~\354\356W\236\031\276.\263\322\354\256s\364q\270\343mC\260=\301>'>\\%\331\231\316\\\345\257\236\362\307LCM\253\246S\323\267\240\212\223\001-\273\032N8\326D\2750a\373\226\255\3629\200\355b\224h\220i\037H"
+	.string	"z\312\307\272\033\302\305\305\356\n\003F\2009eP\032r\245P\253\250\031uz9Dy\362\313\206\223\fXiT\001'(rwC\252(\2661DU\t,3J\362\206S\257\252T\213\347\341\245W\232\032\340\205\372'F\275\376\003\b\030^\212.Ov\251KEq\330\346\361\270\220q:\f\034d\334\346\201\002\316\303\3610\006\222\215\210\204h\033I\204\214\333l#\332\306u4\354\302B\256\216\310\206\302\205m\236\013\244\2005\222l\2738M\333.\253$:\\%y\301\t\223H;*&t\005\013\371\221\277r\215I\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_45.0.35.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 \272\035\005"
+	.string	"\224\b\236"
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	"\005\001'\002\002\177\005\001\006\035\001}\001\005\001\006'\001\316\017\005\001\006\025\001\002\005\001?\202\210\200\030{3\277\0014\277\001\300\001\277\035\001\344"
+	.string	"\306\n\301\005\002y\005\001'\t\r\006\035\001\0032?\202\210\200\370\001wu\311\001s\274\001q\310\001o\307\001m\306\001k\305\001i\304\001g\303\001e\274\001c\302\001a\301\001_\276\001]\275\001[\274\001Y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\003CCC\003"
+	.string	""
+	.string	""
+	.string	"\003\007\007\007\n"
+	.ascii	"@\b\304M\235\raW\b\r'%d\241\302\301\275/\303\017\240\b"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.41.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`h\002\r\022"
+	.string	"\026auH\320\362&\035\243\037g\307\205\311\030\030\314\376\"\224\246\f)A\270\302\262E\252&\376F\371\035\033`r\211n\324\266|\007\017iZ8\204\256\220\275\361"
+	.string	"\223\345\320!\353Q\245.\230\036dp\002\273\373yb5\331D\356\224\002["
+	.string	"d"
+	.string	"a"
+	.ascii	"\002V\226\003E\212\312\013\271\344\344\365\240\231\213\213\223"
+	.ascii	"c\225v\311\t\354A3\326\335\021LJ\273D\f>m\242\372\264\377c\373"
+	.ascii	"\225c\230\275\343\"m?\036\331\024E\355n\367\251&\016\273\312"
+	.ascii	"\r\346\177|\310L'v\005\240\343\341\222\3007\020\224\335\265\352"
+	.ascii	"\303=o\373\304v\007[\356\004\252\322\362C\377C\0064\340\331\305"
+	.ascii	"\231\372\261$\346R\212\244V\214[=\235\214\227](\262\233\232\r"
+	.ascii	"\211G\t(j7\210\013l\3731\216$c\227\336\324\320\2240\031wlXD\355"
+	.ascii	"\212\335\247\305\037\340>U/\300\371>\214\327bNd\003\264\030\277"
+	.ascii	"\350F2'\262I\314\251\305\356\312H\177|\331\"\"C\2428\363\255"
+	.ascii	"\231D\253\331\341o\260&\024\315\006\247\257\235\002\320\246S"
+	.ascii	"?>A\314I\346\364B\312\3505Z\232\3644\323p\032,\205z\332]\007"
+	.ascii	"3\276\204\301?\361i\227O~\366q\237\2527z\212\220\b\245\237\020"
+	.ascii	"G \256R9\025<=l\244h\344\224T\037\353\366mw\327\332c\203Hs*="
+	.ascii	"/\364o\234t\276\260\002]#\031\274\225\227\b\022\274Pe\302\203"
+	.ascii	"\320\2652\342\025\211\327\302b\371@\230\n^\250\002\266|`\370"
+	.ascii	"\362\255\272\025K\367\302Rq\351V\240\253#A\340\017\306\003\273"
+	.ascii	"\360\373\300N\304\266\374\266\332c\b+\232hTfU\365\261\035@*\270"
+	.ascii	"\2318UNm\317\202\374\314\037\257\322\341\242\311\007\017\016"
+	.ascii	"\032\363k\307\0210 \300\002\231$\316\001\274H\340\324\303`\335"
+	.ascii	"\315\003=$0\035\216\341\217b\364m\354\252\334\272\207jib\007"
+	.ascii	"R\334\032\3033\030\265\203\001\006\341'\352\303\306c\023Dv\321"
+	.ascii	"\241\200Z\213/.r\036\034j\006h\013\335;-0\337\033\233\221\230"
+	.ascii	"\340I\252A\273[6E\223P\215\325,\274\225\267\331\002\250\275p"
+	.ascii	"9\245\323\257\245c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\225\006"
+	.string	"\364\tM\001"
+	.string	""
+	.string	""
+	.string	"\002\035\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005#\006\200\204\001"
+	.string	""
+	.string	"\003\002)\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\031\013\201"
+	.string	"\002\037\177\f\272\200$\r\030\016 \177\017\002!\177\020\036\021\005\034\022\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\032\023\001\"\177\024\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177\025%\177\026\003"
+	.string	"\f\372\363\352\266\003\001\204\001\003\002\244\001\003\007\016\344\001\003\007\r\204\006\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\023"
+	.ascii	"\256\241Q6\264\256\311>\250\207\017\220\344/M\031\301p\371\021"
+	.ascii	"t`2F\017AX3\034\004\320\001\034^*\360\021\006\fN3*\374\023B\225"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.refs.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\n\002\003\002\013\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.db04fe7498f09f4b,"e",@progbits
+	.string	"(\265/\375`\345\032\375\200"
+	.string	"\312\327D/R0RBJ\007\253\211+\216{\2127\315\t\270\377\253\212\323\032Uw\331\341W\247Z\227\026\352\232"
+	.string	"k\216\027\322N\227\241\276\034\377\274Sf\356\377\004\361\023\263\276\347\216\317}TET\225UE\020\210Z\230\314\302U\225\245\025\355\024j\351\261\265J\210\224)\205\002\341\002\363\002\354\205\317\210H\260\320:=\312eQ\264\207\275\033:e\337q\354\333\315\236\353\350x\031\344\346\310\020F:\3459L\207\235\rp\2353\033\376\362\235\247\346mv\221:j\316\036\354\271\201\035ZW\307\r\354\230\r\322y\b\024\013\017Qt\326\354\373i\317q~v\303r>_8\344\b\323)?A:\303\tz\273\362\006\254\323w\230\345I\353\034l3\321\016\005\023\255\3412?r\346\214\265\351\364\020\204\371\262\326\345L\031\0245>\374"
+	.ascii	"\307C\017f\274\260\205\371\002\246\r\r\007\301d\370\215\323\360"
+	.ascii	"\031\026\202\3150\034\217a5\354\3442\354v\026\303@\234\233\347"
+	.ascii	"454L4)|\006\204\336\013$\r\323\305\003.\270\f\267\361\031\273"
+	.ascii	")%\030\003\023wo\363<\345G*\303U\230\213\t\250{\237z\f0\246\312"
+	.ascii	"\225\272\271{\257\221\221Q\221\221\221\221\021\357-\b\2315E)"
+	.ascii	"_&\261\023\3428{v\263g+\366\354\264BJl\321\017\213\202\255l\n"
+	.ascii	"\032\354\231\313\317Tx\215\267"
+	.string	"\270p\357\361\336\033\300\016y\334Z\322)ga-\347-\214\345\362\226\026\313{\237xK\020\235{\237\202\230\017`> \035\343B2e\227\276h\331\n\322\371\n\321.\251l\336 \024\356*\013\016\235\356\374,\013&\261\3331\321\016\006\013\366p\036\330\3071\211\03579\n;O\360\363\017\2708j4\273d\3676\203~\350\304\350\346t\372\013\354\331\354\005<]\027\037a\317'v\\\307'vo\3739&\261\373y\007&;\201\"\251\2267\355\336\346PPsGUW\247o2\211\235e\242\235\002\214\026\364\367\r?\243\370\031\200\237I\374\\\342\347\001~.\340g\242\237\005\370\371\304\317\004\374l\300\317E?\217\370\371\200\335\177\272\377p~\036\372?\342o\245\237'h\376\\v\336\3376l\360\304\304K\374\255\225\300\3171\3766v\302\177\023?\213\265\013?\253\360\363\n?\247\360s\357\377\316\337\316\237\231\374\374"
+	.ascii	"\222\377+\374=\365\263\325\3177~\246\372\031\371\263\215\237"
+	.ascii	"\253~\276\002\373\331\351g\032?G\035\371/\364\243\013\374l\344"
+	.ascii	"\347\257\237\275~\326\3613\216\237}?S\360\363\b?\177\360\263"
+	.ascii	"\007?s\360s\006?W\3603\213\237_\374\334\342g\b~V\340\377\363"
+	.ascii	"g\006~^\340\277\232\377d\377\003\370\317\366\237\247\256\256"
+	.ascii	"\256\356o\027"
+	.string	"\376\235\020\376\021)\002`S:\375N+\n;;J?y\220\367^\251\020\342&\225*x\266\242v@u\332\317\277\315\332\331]i\231\032]o:\005Z\216\331\251\013k(a]\266\273\227\233K\253\344U&S\210\211u\2315\026\211Y\241rr\266\303\273,\0353\307\306\225N\373I\223\211\020b\r\233\2261.8h\256t\ng\2773\305v\023\2375\3074^O\354\337L\224\360\352\230Hztz\026\343\366z\353\320IZ\211\0055\220;K\300\304\335\244\016\025\\\315#\023(cv\274\354\233H\177\275\213\274H3m\363Z1\225\345\231\035sW\251L\321S\003\253\255\016\2227\363j|\256\211\035)\2625%\235\376M\203\355\260\361\232J\202\035\341\254#RQ\\=4\216rd:u\266\221\256\022QV\004\211\016A\330\277\377\335}J\336{q\3544o\022\312\347\274\303\234\342\377a\224\021\370\237^\364\277"
+	.ascii	"-\334k\254\302tc\225\\y\362q\024\367w\273\367\270e\264`\353\352"
+	.ascii	"\270\305\003\371\334\272\306#\230q(y\267\214\310\347\275C\367"
+	.ascii	"x4f\260\274C\310\347\275\2724\200\270\342\333\3342\336\343\362"
+	.ascii	"\016\335\343}B\201<n]!\237OWC\310\347\326\325}n]\241{|J\3268"
+	.ascii	"\336\344\320}n\261\271\317\345\225\020\362\271\274B>\267\260"
+	.ascii	"\230\nIf\354j\215\311\245d#\362xoTe=%\205\334\220\315\345\205"
+	.ascii	"\273\227\323\242n\022\201{\263\226I\270'\036\214\005\312\355"
+	.ascii	"\006\324\332\323\222\233\367^\001\252\240\270\226\367\350\206"
+	.ascii	"\\\262\274w\t\324\322\255jal\272]\"\354f\354\312\272TQ\367\016"
+	.ascii	"Pu\257\221\257\333\275\327x\357\345%\263\232\367\366\020B2\253"
+	.ascii	"\252\356U\026U\335,c\226\250{;\355\f\226+\344\223k\211\224\005"
+	.ascii	"\355\311\274RM#3/\334V\322>\215Q.\225\234e^\345hS\3046\311|\254"
+	.ascii	"\254\212,\207\b\351\344\324\233\231\026\322]@u\3130\271N\271"
+	.ascii	"\212~\346\342d\201\352\364)\017{\b\250\344xI6\216#\224\025\323"
+	.ascii	"K\215\226z\242\303\2746"
+	.string	"\230rQt\255\354'\246C\233X\254\224\023\031\327\312F\266\024\273)\323\261:q_Z\311r\270\016mb\341\3009\325P\307:\033s:H\347\350\035\315\243}\264V\353\350\037\335\243\201tV/\033\253q\350-v\266\262\253\3367\332\352M\306s|\2066\231<)\\Tqr\255\3447\034\007m27pV\305\335{\247\206\020\323F>\0032\n]\250\267\032\034\327Jns\321\267\033Z\\\302\356m\032\031\031-s\220b\004E\372\306\361\346\220\227\244V\247\017 \275\257va\\\202\310\201\263\315d\022;\006\270\330\243k\366\250\323\036\r\263G\231\366(\221\226\372\233FC\220<\353\020\321\262\321`\315L\233\304\311\222\353\324\210\221\226R\264D\315\210I\322#\314\326\320b&\213\233\257\377\253\245\260\331\265bg\217\024\250\230\231\264-o\366;\216\366@w\240^\350\233\3175\232]+\036\0251\260\260\271\213T\246"
+	.ascii	"\232Z\263%\244\203\034\365:\232\303\003.\236&8\004\r\255St\310"
+	.ascii	"\231\210\034\032\262\013\025"
+	.string	"\242\003\2325\272\247E\271\034\3701D\020:\235\036\335\362\002\342\b\223N\033]>MWia\362\243ST\353k~\326\242xe\241@\3206\2567\250NQ\037h\026;\317\206\3768\220\026)5\266\035\354o\340\263\355P\345Q\254\237\207G\013\020![Lx\374<\274)d|0\231\366<Dt\240:\372\331\201\320\275B\264\260\354\236I\344\200tz\236)\373\366f\303\316~Cq\240H\345\315Q\301\324\3451\363\361%\325)z\305{*C\346\007:{&s\323p\312\320\210\211#D\334\234\256\323$\f\322\\\277!;\023\027g\243\353P\241{\2642\207\332\350!\340\250\320$j\205V\2415\320)\364\006;Q\033M\367n\323r/\362\001\265\321r\230\216\335\274, 3\023\344\346\211\024\036Bi\273y\032\023P\310\016\312\324D\241Hv\242R/j\336\233\006\301\217$\205^\224\006\273)\253\260\311a\311\234"
+	.string	"F?m\306\300\371\330\245?J\003=\2565s\220\353\024\205\342)y\260\321h\263?jd'\372d\337\204ey\232\236\036\276\270\330\354m\027{\233f\233\216\r\"\356G\233\231\275-\263\267N\354m\022{\373eo\205\300\3517;O/n\332\336\360\331\033\030*\250 \266S\244\3515\035\367\363\004\215a\031B\005\313\276\325\210\360\025\206\312\273\354Z\2107\232\237\247\331\2200\253t\330\267\231>\363\363"
+	.ascii	"\301\201\251E\351\364\226\312\276\341\250\324\271\301\352\264"
+	.ascii	"\313\330(\036]\003\"~X"
+	.string	"\321\362\321\351\273\314\337d8\215\267\324PW'N\247?L\264\3531H\357 z\332x\210\203\322\251\017O\214\315\302\316\316\322bP\344\2759Z(Yf\251\330\031\302\366\026\345\346\303\005d\013\335O\227V\235\034\235\276\303\374\255\205\313\272\315\005\2366\2664\253N\301\364\244)\347\300\351\364<*\326K\263\365\017\354\354/\335\303\331E\027+>\\\371\322<\360\031P\004U\264\270\314\335\333\354&Xh\2246=\257i\317\373\262\347e\331\363\222\266\267 \275\271\244]p\254\222t\2322\321.hW\247J\225\276bo\334O\220(F\332\312\373\312\023-M\036|6\206\212\263\251\264\220\242\346\305\321\243\346\346\203\212\2462*\231\233\242vv\266Z;a\263klA\016\216&s\367*U\354\276p\325\030k\202\206\326R\254\261\210I\273\275\331\341\307\337\274\245"
+	.string	"\261$E\225\t(CH$\201I(\304\240\267\263:\2050\300\227V\374\210G?\031JA`\261\250\376\204D\022~%\254\300 P()\206\022P\206Z\024\n\002\211k\361HMrb\372\005\201G\304\242\323Q\t&&\247`P\030\344\255\275\335\f\302 O\206OeJg\f\177Mj\323n\306P\030cx\2444$\372\005\235z\2022z\247\330\363Y{A\245\341NPi\210.\255JA\225i\247\326"
+	.string	",\246\305\242JLJ\362\361f\f\205\277\224\270\016\321$5\250\004d\362\361\222\324\242S\372S\213\274\023{J\303\025?3\210k\021\250\244\226`b\025\016iPE\024{E\022\275\037\361\247\330S\004A)\b\\W\325\004"
+	.string	"T\245\240o\351W\264\006U\"\321\351'"
+	.string	"Q\222O\310Tb\206\217H\274\300\204\236\001%X\254X\211\276\341\212\0303\206\302\337\211\025\200\377\212\275\340\006%(\rO\374\007$\252AU\311\276\305\013\007^\300\240\201w\030\021\260\210\200\305\3560\"@B\212\340\005\222\375\013$\224\305\n\027-\230\206M\352\332[\325\242J\354\215X\277\244"
+	.ascii	"\223*\203\312\304C\004#\t\030\002qi\345\301 .\255\266\370#\362"
+	.ascii	"\210\273\342\216]\203@\341\020\006\237J|\241\347\033\256@\352"
+	.ascii	"p\306J\264\006\325\037Q\035\366\230\326UH\\ZK\254\275\027Hv\005"
+	.ascii	"6\001\231z\"\324$a\b\276\341\312S\233|\"\364\b\2074h\360+\241"
+	.ascii	"\b\303\017\350\024\203\320\227V\020p\341P%\036\255B!\361\250"
+	.ascii	"\247\330\213\321\244\256\305\031E \032\324"
+	.string	"\244\240\007I\300aP\t\252\f\300\365\347\033R\223\204M=%\247\027\324$\021\305\037p-\002W\337Z\354\301P\364\255AK\277\0258\203\tE!\t/H \001\303O\310\364#\2522\b{N\303\337\217\332\004<A\375\371\210\034\004G \2523\b\207%\210\276\245_JT\2012\200kPM\362 \211\350\023\276\020T\303R\bjqi\247\256\276\325\204\240\020\270\372\210NJ@\031A\341\017\200\265\007c\r\002\235xGB\212\201\002\005\0218\260\277\025*\023P\206\2208\354\251\253\217\310$$\256A\341\357\350'\343(\b\3645\035\375\210\305\243\025\t(\005\201M\304\013`\370\001W\023T\246\027|Au\350ff(\032\217\361^\243\320\205\n\302\n\026\347Q\2643&\322\326\345\344\f}\356\270\272\214>p\361\215\26121cQ\312x\344n\224\261u\212Bi\264\fm\036\205\202\356\340sD\241\244\367>1\037"
+	.ascii	"\304|\300N\227#O\316]z\021K\310\244\244jX^\\O\234|\351\342A\255"
+	.ascii	"S\324\211\023T\214\223\311{\225\327\350\346\310\331C\251#\305"
+	.ascii	"\217\206\035\025k0\240/'<\322\272\2448dy\002\246\323\213\300"
+	.ascii	"br\264IP\233\035A|t\212*A\2278aNa\347\323\250Q\202FKY\247\250"
+	.ascii	"\016h\222{1\325\266|\315\343\222AsK\346\3160Q\257\033O\346\004"
+	.ascii	"\202\t\2502\361,I\302\2242H)3#3\242m\322\001\362\t\020\206\303"
+	.ascii	"\201\242\250\355\r\022@%5\322!\211Fddd$I\245\260s&\351]\202\244"
+	.ascii	"#x\033\236\307\026\207aN:T\243\243^C\365n\264\332\255)\261q\347"
+	.ascii	"M\265R\225z"
+	.string	"\260\370\263b\241\025\006\2032\267\016\234\250\300HWV\005d0\336\221\212v\206#2\370\203\304\017w\214wc\"\3608n\034~\302\251\237\253\307\316l\200\236L\310\207\330\251\250\244\235\243\n@9\241T\322L\364\333\206\352\035\r\241\251\032\024\032>\207\372\370\352!\266+sMm\233Ej\217z\351K\034n\027\210\246Jc\022\271q54;}F\2732\205h(g;,A\205\276\365\351\261\036\006\243\350\223Uc\260\363\341>\013\377\232\370\326\023\365]\364idRG\367\257;\341\200\216\031o7q\005\261\203&\323\356\356b\236\004\013\237\025l\026\323\242\355\305\364#\333u\031;.1#\274p\341%b\260\033<C\260\315Ap\322\316vBy\316z1\027=\036\362\272\344\013\037\030\020\234\026\022\351\222\201\035\202(\200\2017\002n_'\nB*\363LT\225\215W\225(\rc\211n\365\254i\3755+\216\303"
+	.string	"\237\264}117\245J2$}\302\322Vli\267\224\211\353\375dK\224\371\335\t\214\254l\240\374\224\007 \261C\353\032[\276n\277\fx\363:\216\267\353 \310@\336\211\272\032\034A\271#\256-93\314o8\375\005\026'Wh"
+	.ascii	"\334\366\bH\030\315\246\200\335\002\277\311$\260\233\305\364"
+	.ascii	"\373pHG\202\304\257\304\375^,\272#\350l\201\b\222\303\335\006"
+	.ascii	"\370}\331\205p\035"
+	.string	"/\251\203^Axl\372\264h\n\226_\034\334\223\n!\333t\005\357K]E8\231a\262zQ&R\371\362\024\267\362\342\204k\255V\016\266\370\304\003t\331\247\375\267u@\254\340:\235\301D\2652T9\364\177\304\206\312\322\0257\240L\315\365(\366\316\fgy\220\261\375\366jS\203\240\326X\030t\303\231\306\030\003JXf\247\361\245!\347\006\313_9\026\237BwV\362\306 \237\221\211\346\301\276n\231\236\311j\251\375{6&\276\032\3571\027\262'\327\314\205\227i&\273\305\237\230=\250B\264\271!\304\3629\273\006\331\226\363\253\324\337@\250Ju\346U5\320TF=k\261\b\002\235b\213\237}\201\206/4\344J\333\347\363\013\363Be\220\367xJ\206\252\245\225S\200\033\274\213\367Jv\370\233\251E\255\257}\324\3065\007\002\372\013\bX\205\273\"a\336I&\346\207:\342\333=I\026\23465\f\034("
+	.string	"h\267\365\216\2524\327QMTPe:\237\036\242?6\003\231\027\333\211\370\215n\301r\264\261\347%z\254\3368\341s\230\266TQKsg?h\316\223#\252)\275\203\337\004\245b\224"
+	.string	"\312\235\230$Pb\202\236\t\262n^\265.\254\253d\002NT.A!z\276\255\327-\3328\327\252\240\311\214\b\213KY\275AW^\\w\222)K\340\335\364\373\364'\301\303\207!\352\225|\327<*n\024\002kj\fg!\230~\250\263\207(\260\333\241\004\360\357\372v\207J\177F}\256\236\272\240\330\273\246d\272\220C\3278n\003X\236\341\224\210\247 \354Z \247@\231\367\264\374\"9i\252\244\036\t\254\360\003\323\236\320\343\235g\223\256\037\037\214\315\023\002g\202\210\274\323yVeaJ\034b\222\320\2205\177\023\231fo\202f\300|\324"
+	.ascii	"\353\023\017%I\025SP\201\346>-\227N\276q"
+	.string	";Z\371Zq\036K\033\225\360\304\013e3A\240-N+KpZ\227Jh\034\217_\bm\032\362\277\222\037\031'\332#\252\n\036;\344\372#\221\237\361o\004\316q\035\344\357\311\201\277w\272\013U\013u\027;#\303\035\300/\264\037\350\031`5)^"
+	.ascii	"\017\024\246\312\3152\221\034\2223a\031\310\271/\237\026F\335"
+	.ascii	"9\025\026*\n[\362\316i\217\024\023\262d\222\254\252\232\221\372"
+	.ascii	"\231\027\223n\223n\004\\Eff\261\300\301\323\264\002"
+	.text
+	.section	.gnu.lto_.symtab.db04fe7498f09f4b,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"ratesSettingLimits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"setConfigChanged"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.db04fe7498f09f4b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3978 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`u\004\335\025"
+	.string	"\304\032i\005"
+	.string	"C"
+	.string	"\360\331\367\314\t\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\210\301\237\216\017\026\002\002\002\006\007\002\007\002\b\002\b\002"
+	.string	"\002\t\n\002\n\002\001\002\013\r\240\342\234\212\n\020\253\306\274\244\016"
+	.string	"\021\327\266\344\350\017\004\022\365\311\201\302\013\b\001\002\f\002\001\002\r\025\351\251\346\344\b\020\016\002\016\002\b\002\017\b\002\017\027\032\353\312\237\224\r\001\002\b\002\017\035\261\356\305\342\r\016\002\001\002\021"
+	.string	"\001\002\022\002\001\002\023\037 #\263\233\302\375\017\001\016\002\024\020\024\002\024$%\250\200\234\374\004"
+	.string	"&\267\226\235\323\002\002'\206\361\336\202\002\002(\211\337\356\337\n\"\025\002\025\002\026\001\027\016\002\016)*+,/012\233\304\365\321\002\0023\214\233\312\236\002\0024\326\353\241\235\017\006\0015\255\230\261\377\0020\001\002\030\002\002\03178:\311\202\342\200\017;\376\336\373\325\016\n<\335\306\263\314\001\b\002\001\002\t=\315\347\335\233\n\002>\246\254\262\371\003\f\001\002\023\001\002\023?\274\202\337\332\rd\005\004\002\030@A\234\361\365\241\r"
+	.string	"B\350\300\306\254\005C\376\314\233\301\t"
+	.string	"D\350\262\320OD\002\032\002\032\001\f"
+	.string	"EGH\212\312\215\322\016\004IJ\316\201\242\212\003K\204\320\326\221\002\004LO\370\200\346\243\017P\245\357\221\373\013\033Q\323\300\201\202\016\fRS\354\206\342\366\006\002T\342\201\222\246\004UV\252\257\370\340\n\002W\202\321\330\342\013X\346\270\272\264\006YZ[\264\264\266\260\r"
+	.ascii	"\200\206\250\2619\241\021\302\005)dZ\003P\2021F\312\314\003\021"
+	.ascii	"\320P\303\240\253M!\323\034I\222P\330\027rNv]*\274y\227\240\274"
+	.ascii	"lf\212\343\215(\032;\3572\002\314\361\342*\035\227w\003d&$]\364"
+	.ascii	"\246<\306\3739\204mz\377\222\022\203KA<_C\177;\004\341\330X\253"
+	.ascii	"T\002\344\300\020C\354\00631.Lc^\235\202_\343\256\324\316\232"
+	.ascii	"\360\024tPE\234\035\020\242\213\271\251I\034\264\356TEo\255i"
+	.ascii	"\274\206\255\355mR\207\330\001E\320\233\232\325 \307\345?\336"
+	.ascii	"D.\242U\034q7s{\274\005Tu\313\273\236\233\025\020\\p\3144\223"
+	.ascii	"\343gb&v\272tXu\237{\024\212\bM\3171l\016\310\344\323!\275\211"
+	.ascii	"\361\177\227?`\276\376\357\353C\350[\351\366\305*\346\0066cX"
+	.ascii	"&|\337\177\276\372\270\246.\272\023\311T\340\224\244Y\177\322"
+	.ascii	"\033Y\253o\343%\035\244D\316\311\256k\342$\2065`l\332+\367\224"
+	.ascii	"Y\360"
+	.text
+	.section	.gnu.lto_.ipa_sra.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\322\001]\007"
+	.string	"\022\306\024\037\200M\206\00330\00330\003\253\240"
+	.string	"\300/\354\032A\321\177X\224MG\306\366\267\350r\247\024N\320~\246gv&G7\232\f\346\213\305\212\252M\231\023\345\224\270\b\344\307t\334\230\241\213\025\211E|0\254\302\204\177 \330\200>@\247)E\353R\205\002Y\250\020\261\246\315\200\202\2513\326\001\0208g\346F)\fc1OEf\272XNr\360:\337\301\320J\303\366\325\312\323)\265\266\304\307\001\3067\204\300\356&L\005\351\233>\306\024\316\354\226\250TL\273\316\034\303\022\275\030\322%sQ\207\256bC\263\351y\232\242\017h\301\013\250\\\205\030,\253\204\230\323\246\360\366\333\373\001"
+	.ascii	"K\032\306\017\r\310k\373\305>\201\353A\220\002\360\314\243\373"
+	.ascii	"\342R\024\215\356s-I\2250\236\202\004+\262\235\230\251\273\030"
+	.ascii	"Qvx5o\001"
+	.text
+	.section	.gnu.lto_.inline.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\326\013\035 "
+	.string	"6!\200K\240\022V:K\334O\224s\202\007\273q\244\266\007U5\345%\367\360\027@\220w\334m\315&\354}\2524\240\034\370Pd\004^\216\227\341\t\267}M\032\324\375yE\314E@\324\370\204\026(q\315E\037t\210\177IUo!\331r\247i"
+	.string	"j"
+	.string	"i"
+	.ascii	"X7\026#\262\3221p\233n\265\334\205\374y\201\3731\017\226\316"
+	.ascii	"\360\366\001)\226w\207\220NP8!\\J\252\355-\273k,\016\233\314"
+	.ascii	"\364.0l\210\221\346\001RN\301\2308b\370\267\276\313$F\354\222"
+	.ascii	"9\213\n\303\350n\006\352\356\334Q\254\275|\336qw\267\354/qw\204"
+	.ascii	"]\025-\360\177{\027JK9\234\371q\2475\005.lo\177}\367Xu$u$g\320"
+	.ascii	"B\324\235\256|\001o\3062\232Z\312\331iv\027\275\202\336\375Q"
+	.ascii	"t\002\344\006\207w\204I\216Oz\016\350\242\310\n\303VHRG\005."
+	.ascii	"s\022\214\204\373\355\211\037\300\021\374\326\366XEw\337\274"
+	.ascii	"\306\236(\211A\017\330\037\205\354\367\361\222k"
+	.string	"*\312\006\3450\017&`bv\351/\357\273|\362\004(\212\216`\250\260+!\364\263\357\330\307+\234@BN\2423X \331\0132\0276q\376\375]&\361\313\311&=\302/\222HS+D\326\323\363H\315!\274X\036\367\203\276M\325\243\332\360W\252\0365\301\035\b0\352NY^\363[kS\241f\222W\316\351\347\213x{\203\353VF/\202\233]L9]\032\2358m\320\375\037\007\361\301C\207\233G\025\251S6~\032\211)`\316\341\272\3655\324\250\273k\267\t2\215b\2540=\277\236j\3370V\025\\\322\216\224-z\320\256\341\272\225v\213\311%/\031\316U\n\242:U\320\f-\364I\002Sj\004\231E(\307p\366\261;\262\377\3076\306\214lqS\316Uul\345`\032\257`\207n\370\310\242\035\213\234K\b\234\302\004\t\267\001\200\364\250!*\022\031!M\222R\2411p\242\031*\262n\022"
+	.ascii	"\362x\006"
+	.string	"(!\fc\320(\303\314\220\214HJ\222\024\256\001pf\021-\274^\b[\006\307\324zNZ\214+4H\021\007\204)wD\211\030\001\t\370\261ar\353\302\034\206\322\365\350\033f\320\203*\035\245\362\f+\202)\202\304\205E\264$H\301\244f#\365B\251\262\234R\260-\371\364\340\215D\215\004\253\210\242\342\343\035\221\f\332\"k\321da\227\023\034\017\n\030\326p\2314\265\335b\021\301\026'(\003\346\303\240/\341<\021\370\311\245y\227\331\236\020\2112J6d\007\270}\355v\034bG\377\226\251\225D\020\"\363\210\3055\334\f\034\272\332\347b\344x\330\374\201\366\277\253|I\374\024\333\272ap\2563\216qD\261\276+H\223\021\204\370\036\337!\370\0315\202\234\034\316\n\215\n\362\255z\361\346\260L\350\367\335\257\016\351n\342D\2565\337h\313pR\250\275\320\306L\370]\242\346\212q#d\356\262\231\334\3072"
+	.string	"%\017\221\350\2175\017/2q\210\201\221\2744C\r"
+	.string	"1$@\255\232\031^\323\372Z\242\020\232\t\003\205\"X\365fm\276X\350\340\310_\347\\\230lZ\346\027\336\330"
+	.string	"Hb\327S\353\362\005\357\027\243E]\004\274L\301\314\337\351YlC\354\361\226x\036\212"
+	.ascii	"{\331\024A\f\337\326\017\307I\304\277\361\005\217\037\343Q\253"
+	.ascii	"\303\313#\320j\004\235\214G\324^4P^\221\347\272A\346\321\325"
+	.ascii	"i\271\253r\330\305\016+7o\367\336\254\240\211\254W\006a\016\226"
+	.ascii	"}\363\017-\356p\346\222p\230\035\240|V\255p\225\357\274P\001"
+	.ascii	"A\262\023\231\035\213\323\t6\003\366\3151`0\231\335\266\024f"
+	.ascii	"\217\274A\242\250\2556z0'\252\023G\275D\261\324\320\373\314'"
+	.ascii	"\305\361\333\3653\001]\270Q\250\213\371\224\276f]fJ\030\303\374"
+	.ascii	"J3\237"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`[\013u\035"
+	.string	"\366\335`B\020s\223\016V \t\n\b'6HS\017\r\343\025\366\237\337\005\300\234\222$"
+	.string	""
+	.string	"\210 P\253uUUUe3\303\301\304%\030\"S\351\340a\365\226\256\026\2153h{\020\022lDMp\267MRJ\001J"
+	.string	"N"
+	.string	"P"
+	.string	"\327\005\241\265\027N\230n1:a\340;YV\251\360\037\240\255\325u]\327|\024\345$a\367mN[\314"
+	.ascii	"\276\302\177\355?$DD\304)\f\002\205B\326J\354\377\275\252\362"
+	.ascii	"\312\325V\323\372q$~\234Kb\r\376m\005t\303\022''\020\306\001"
+	.ascii	"\rq\333\r\207FF@\371\002\177;M\300\273\033\236\257\347v-\313"
+	.ascii	"y\002\376\365\363\244\354O\333+\207\267\030#\207c\rn\345\312"
+	.ascii	"\371\344?\306\350\361T4\252j\2061,3\371\3172\031\327\345\222"
+	.ascii	"cDA\261\026\303\277}\301\b\232|\311d~\220\260\017[VY\370wML\264"
+	.ascii	"\030\375\240\333{\324m\255u\320v\245\247\036m\226\200?\246b\034"
+	.ascii	"n\300\240\263\240\233\215\202f\356\300\272\003o\025\277M\320"
+	.string	"6\377\232$\036\004\374\024\367d\033F\001\177\f\301\347@[\003m\201f2\001m3\264\030\332\013\255\205\266B\323\205\202\207\034\345\207\212(w)\017D\2162DE\024$M`\321p\0219\312\021\025Qo%x\207\255\303\021\n\341\177\007\377\327\345\251\341\337.\316\301na\307\337d\n\342\277RK\251\305\005\376i\320@\254\301\030.\306\232\2011\250QeG3\005I\332\fq\205\2041\306\340\371\022\300\001\242\216\246\024C\016M\021\215Rk\332794\261FsA\363N\275`\r\204\306\256(\237\210\202\301\003\267.\324\245O\024a\267CW\034\207\245H\207m<\307\231\2352\006\302sE'_\244\235\247\235'\353\334\225\360Fv\022\260\375\240@\353\264\263A\026\322K\025\341d\376\316\203\352!\2700\231\3161yV\264\222\231Z\037\355,W\323\"`\006n\027\326SH$T\207@\324\342\354\274\027\374W>}"
+	.string	"\246\300\360\336S\246\213\030\272F?M\362@\t\031\030\325\f\2421V<O9\333A\bKI\240p\350M\007\f\300\300\032\007\262>\016\036\336\344@\235\353iBs\2233>M[\323A\021\333\267U<i+\323W\214\303\200\241\253\343\331\314\242'\177\246[\301\276\023f\307}\264\320\211f\275@\343-\006\341\3124\004M\320\020\"&T;QNG\231\013S\001\277\320\235\241p2u(\331x\023#>\254GJ+\372C\030]<\337!\261\350\232\247QRY\220\2455\313r\216B\300\367\221\353M\202v\203\246\316w(\300\241\2026\310'\214\276\322&\210\337\275\305\214i):\224\327\243y\352\223\370\362B\036\361[\236%_`\034|2\241\200\324\nU\266\003Y{\223r\274\036L\364Cl\243"
+	.ascii	"\231\223Q\f\210\251#\253\035\024\237\223q\006-cnn\213q\277\223"
+	.ascii	"q\313\207\325\022\0248\316\217%\201+\201\001\026\246\254\336"
+	.ascii	"H\324\017\236\020\225e\335R3N\357[\020+'P\3139y.$ua\311\310\312"
+	.ascii	"\324D\\\302}\345\217\331\250g\316L\t\334\330\225\bDp0\244\301"
+	.ascii	"\276_>\362\316\263\272\257a\205\324\215\372\350\334\2475\226"
+	.ascii	"\331\335\336\200\345y\224b\3605J\031\300\200\321\343\025\221"
+	.ascii	";\232\266X\300\355}\nC\r\260\360iB\245\275\321\374\220\244,\370"
+	.ascii	"r\321r\031g\314\305\030\340h\002&%[\362\253\230\033\026\2706"
+	.ascii	"\243\320\022w\fo\356\321\216IV\226\200\017"
+	.text
+	.section	.gnu.lto_.pureconst.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 w\365\002"
+	.string	"r\207\026\037pO\032\003\374\177\b\005\016\376]U\003H5\030\261\217\277\006\222\031\266_\221\345\307U\363\"\003^\310A\336\307\363x\035\347\370\3065\236q\204\361\213[\274\342Q|\342\222x\304!\336\303\035\336p\206/\\\341\tG\370\301\225\033\274\340\004\037\270\300\003.\200O.\311M\231\231("
+	.text
+	.section	.gnu.lto_.ipa_modref.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\362\0015\t"
+	.string	"\262L$*\200\267\226\00330=\020M\320\004MP=\f\f\214\302\2202\273\330%\273aK\264>\361[\230\b1L\231\204L\177\b\2212\005\317\260\360\n\237\200p\300\2574\370\013\b\312\201)\360\367^\267W\356\225y\256[\266\021\r\324\246\325\345o\034\230\215]?\345\017\365O\001\345\322d\311\221\307\323\001\225C\\\343\267N\2553+\307\2562d\374]\254x\200N\247\334\351\254\224[\235Uy\325I\225S\223R>\265\371O\374\224\312\245\316\250<j\237\220\373\020J\250QE\244\250\324\256o`\202AUe\036\020PBs%\206\345k<33jsW\r\034\275\334\021\261j\t\371\321\021\317\316y\376A\343=\016\271\231\004\026\244x\263H\2677\247c\"\224\201\206\261\003N\334\t\202\020\f"
+	.ascii	"\243\023a\304y\201\227\020\326~H\212\337\341W>\215\314\357\035"
+	.ascii	"\230\307\005\353\312\260p`QQ\250\230\221ur.wt\244\210\265E\325"
+	.ascii	"\226\336\240\277v\t#\261^\256\314\204;a[\306z7\311\262\340M\264"
+	.ascii	"W\016\021\037\016\020\005"
+	.text
+	.section	.gnu.lto_.lto.4f365414189f81a5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdLaunchControlModeNames.137.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bX"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\256\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'*\206\b{\270\364Ry\276'5\206\bw\330\357\002u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.141.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\366\322\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\355\030us\367\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001'?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.143.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.144.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`g\002\215\020"
+	.string	"6\335fE"
+	.string	"\2216\035\223<C\344\332\\\b\351\2162\001\210\351\001\371\356\322i\b\007\331\270B?)q\023k\2201\232\375\367\024\204o\331DA\020\313\244\273\252\252(\"\360\255\242\232\265\020\301wD\307\266\233\210\220-\245L\001V"
+	.string	"M"
+	.string	"R"
+	.ascii	"\330eU\222\327s\275:d(B\206\007~43M\232,\360\242%\206\276|&\251"
+	.ascii	")\251x\032~\0336"
+	.string	"\013\277\021\354\345\033\021\020~\032\366R\020\211Z\243j$\262r\202\242\013\313\033(\222\033\335\255+\272$0\264{ut\367\327\0031\350\001\350\377\025\377\007\374\253 \236\362\306\022\223\022\361\347\027?\313\247_y\034\307\361|\362\177\277\331\375\374^\373>\373\036\373\376\372\276\372^\3565\300\026\272p.\272K#L\247\252\024 \376\207\374\363\b\022\204\334\243\342\207\322%\002321\243[\344\330\203z43\265,\030k\311\327\335\330%/\336P\031\326\244\273/>\351\262\264\300p\261*^\224\006\025\253\311$\304\037U\261\273+\311\037+yC\201\335\335\222O#tyS\262\375\273\b\253\3362\001RL*\244|\217\245\274!Y)\301B\2644n\255*\005\353\257`a5\347pxt:\016\307\371\340\036\200,p\300q:\0228\016\315;\b\036\035nB\327u\270)\266\312\346\223\3574\240k\035\320\311\244\377\033\336"
+	.string	"q\350\2237\254(F5@;Z2\243!T<\016S\343Ea\240\261\232~\242C\013\022Z\206e\274\241JT\3058\216\031\306\233\002\0228 "
+	.ascii	"\003!)\323\001\20624\307\214WqI20\354\f\333iY\233\227\272\357"
+	.ascii	"f\355w*\320N\226\261\371\326\233\335\242\255i\027\027\004c\323"
+	.ascii	"\366\236\354\324\226{\017r\335z\36565\243\260\307\316\2431\035"
+	.ascii	"\023\347a\037\330\017T\276\206 \215\204\334JnX~\267\230\334\212"
+	.ascii	"\025f\035sS\356h\f\221\242\031\332\314\316(\322\225o\237c\320"
+	.ascii	"F\357\306&\3002"
+	.text
+	.section	.gnu.lto_canUseLaunchControl.145.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\013\002\325\020"
+	.string	"\306\336nH\360\260(\035\270w\227\343\275\250\352s\255fpKf\364\350*\305\267x\345\326\024N\251K\303\226\237f\247\240\340\355\377K\325\310\357\331?\345\355U%\236\310nd\031\256\354Y\036nn\260\026\235\030\023\371\204\220\275\267\2242\005["
+	.string	"T"
+	.string	"`"
+	.string	"[Z\217\327qt\312\346\322\327\264\036\351\321\201\205\206\217\213\0174\366\245\245\302^*\205;pL\275\264\\\314}\243Jv\324Z\367E\313\305\024D\0311\360\334\223\312Jp\274\300-=n46\2761%?,\230\270\262\345\325\210b\346@j\255gq\314\260\377\366\277\210\377\006~.\02013R\274\363\311\177\005\013\274\342\366\312\266\213\201c\323\271\241\332\364\317L\334\257\177e\355\225\377|\217\371\335\371\334\371\364\374y\276<\277\317_\002\024n95\026\334\324\312\312q\243\332&\n\020\377O\376\357\b\022\234\274\264\263\026\326\262pP\221\310\251u\0266K8.\224\307uT\256A\231\032"
+	.ascii	"0B\250:\332\r\033\241\275-<\240\332\264^\212\t\025\334\004Y\300"
+	.ascii	"\206\350\377\200\204W\234\035`U\033\020\333\020\243\262E\036"
+	.ascii	">\260%\364\037I\340\025e\203+\032[J\201\355&6\373\265\215\243"
+	.ascii	"\266\"\205\354\027\314v\213L\272A\231\021\266m\331\271\235\350"
+	.ascii	"\227\350\266\203\007}\204H#P\b\022\205\020HFJB\020\311$\374\370"
+	.ascii	"|\024!D\n'\214F\244\360\233\325\225\265WNm`\264\031\2710\273"
+	.ascii	"\262e`\343B\233\361vK\324k\224\377^\037\344\324(O\277\036B\273"
+	.ascii	"\026\305\310\370\322\266D\310\327\345\rDx\305\235_\021\272\263"
+	.ascii	"k\256V\243\343:q\216\323* \320\002\2311\253\003\005\n\355()<"
+	.ascii	"?7a\214\002\343\r\372\315L\273\275_\345\225\356\3542R\223\330"
+	.ascii	"g\013#\301^\336\360\355\320\036\367\237{\330\036C\267\214\266"
+	.ascii	"p\004\363!L\177x\336p\fo\3001\tR\350>\222\342\0036\337\204\006"
+	.ascii	"\337a9\332\236\322nQ[\307t\325\221\241"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.146.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \341%\006"
+	.string	"\362J*4`k\323\001\300\266\002\310\331p\30190\262\016U\370D\252\365\323\242Y\254\005i<\360o\325\357\037ir\013\340"
+	.string	"\013*9\314\nG\016K!\203~\362\367N)\236\023U\351\2243#9\032\314F\316\352\221\223\304\264CU\371\241\264J\211\333\307\355\242\341]1\300\224\373\fop\204\177`"
+	.string	"w\360\330!\337\335\343PT!\221pq\301\317\346,\030\t\354;6nv\214dPT&v\263oc=\b\002\301\366%W\266\3059\203\375\203\202\200\003\306\356\312X\360\352\260\362\277p\b\246Y\207\221ew\r1m\340\216\237\330\316\002\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_accNeedsCalibration.147.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`i\003\315\025"
+	.string	"\346f\213K\320\320*\035\320\3227\200\007q\241\034&\230\266D\333'U\356\226\002\321\240\262y\210>\021b"
+	.string	"!u\255\245H*\343\355\277\314\314\256\326Ps\327\257iq]\341\253G\322)\007j\367\315\241>\327#B!~\260!B\b!R\312\024|"
+	.string	"i"
+	.string	"}"
+	.string	"H\265\366T\255\263\256\375@S\250\363d2Kr\024\233]\337\327~\210#8\032 j\334\034\255\217\255\206Q\221Z+\216S(\007\274\243\025B\033\231\232=I\234F\230D\230k\3036S\316H\016\273[\002>6\032\036\027\226[Q\034\200\223\023\242\267\r\242H\021pv\336d\334\342H\320\327\003\275\311D\220\032\017mw\3131\267\030sYRk=\323n2{"
+	.string	"\373o\310\377\002\177\207\004)\r0\266;I\301\240\276\213\334\226\320\"\207\214\223^2\357\n\371c\310\300K\333\336\335\2327\204%\204AY\277\376\336\213;\347_\261\326Z\3378\377\371\250\346\237\314?\235o:\337<\277<\237<\177<_<\277\371+`?\004\221x0Hk\255\r\227*p\374\365\374\337\3770\377\371\004\n`\356\332\336N\255\234\001\315\\\004A\231-\204.u\237\320\213\016(\337N6t\232\335\222Ca\300l4\235\301&\226R\234\312v\311\351\244\312F\323!\261hW3\221\255!ws\"\033M\205L?\0301sl\027\334\260\034\033M}\300"
+	.string	"FF:J\261[pJ,6\232\262"
+	.string	"\312\372\265\bzh<\220\215\362.\n\371SH\341\245u\263(\001\377\213Q\363\032;g\233G\247\002I\354\034\336r\267N\374\253\260xi\334h_\221\240\264X+\325j\202\312B\312\211\212j\325ZQ\221\200\234u\001\245\245ba\261Z\252\263WW\254\215\363r\307\317\017jw\333"
+	.ascii	"\207\214\237T\\\336\242:\346?\252_\002\353\330\307\232\220g\243"
+	.ascii	"l\376\007+db\326Z\027|\177\025 \230\272\027r\307\263M<\030\017"
+	.ascii	"\377M7\350\345\253{\204\223\361{B\356x\352%:1\003\343\341\036"
+	.ascii	"(\206\b5u\353\200\251Y\2066aG\250QH\201A\036\t\325\344HiAs\340"
+	.ascii	"\002\021)\252\016\020@Tc\363\303\310\216\203\210Io\023*U\200"
+	.ascii	"\227\377\022\356\013\013\002\230\n\324V\235\300^\350\001\311"
+	.ascii	"\244cW3P\013\203\b\300\332Y\005L\364\205v\362\003\203\275\263"
+	.ascii	"\233:\272\303\326n\fc\n\202t\355\207F{\324vjwD\211/\n-\246\242"
+	.ascii	"\205I,\276?{\256=L\210$\364\271\305\024>\237\203\206\315\005"
+	.ascii	"\224\007\227L\240a\313\235\001\021\223\337<\354:U"
+	.text
+	.section	.gnu.lto_updateArmingStatus.148.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"-\t"
+	.string	"v\221?9@\305(\035\240n\277\270\"v\241\032\337\225\233"
+	.string	"\243f\177,\241#\261\334\312!\246\374\224\362\233\352\270\241S\004\200a!\207\201;g\235\203\316\320'\311\331\221\355\223M\244L)."
+	.string	"."
+	.string	"/"
+	.string	"\367\034\323\364\370G=\340\003?\307,\024W\f3\312\370\004@\017#h\201\244\034\365\224"
+	.string	"C\231\225\202\335u~\340\304\035o\333\300\366\200\355\222*/\325d_\3030\f\255%\373\351\370\364\263\263V.\224\003\221\335Q\030`Gb\210\206\355_\354\261O\256:\355?.D\036\256\335\325\324\"?\275Z+u&\213z\324-$\035&\241|\371\317d\327\250N\021\311{\352\034\020>\206#:\371\357\321\357d\217W\215i\243\"E\002eh\007\3364\233\216\333\264-AcP@X\320\266\216\243i0\346\0326\235\346\300q\235vQ\201\216\255\226\034Y+"
+	.string	"-\220z\330\356.VI\233\363\220\377\254\372\t\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.149.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`E\001-\r"
+	.string	"\246XU@ \217\223\016\004<%\364\005\256\005"
+	.string	"I\220Fn\207o)\277\f\325=\036\303\230\346\020TP\354\233Z\303\001\034\027\313/\312\251\267\030A"
+	.string	"A&\020p\300)]\332\021\200\366\2244\265\266\367\2262\245B"
+	.string	"?"
+	.string	"D"
+	.string	"\230\275\342\261d\257\262\022\002\301\262\273\224f8v\370\234&\346_6\222\266y\016\005\374U\270\2336\007\361\031a\003\245\002\330\036\270\215\335\275\350\ta\3132/\233\335uj\333\204\373r\333\bl\027\260_\022\273V\fv\2463?\371\245L?M\273L\177\372(\262\264\260Rv%\264\300\330\023\217\304\006\373\321\236>\331~\332\367p\023\354'\r,\355^P\031\261\033\r\230"
+	.string	"\346o\343\031\360\317="
+	.string	"\374s\017!b}|\350\343\007\224\210\321!w\327\243Jb[\003f\364\242cP\240\250"
+	.string	"\345\013\377\032\360\232Qgh$\373\207\243t|\rf\020\222\327\376\374\020\370w\325pHa\301d\344\223-v\314RI\354\273\335\036V\207\203sAW\032\316eUTu\200\362H\300\321AUW\207\322d\330Z\300\271(\020\313\272\250)~>\212#\026\037\315\340\224\222\332\n:\362\232/\372\006\244\236\367T\3045\027\371\024d\305D\210Bv'\002\235^~J  \220\002\231\261\363\001B\3009\334\221\260\336`x\354ml\001("
+	.ascii	"\b\026\260P\354X6\221\337\030g\033\2260\244\265\302\024\003j"
+	.ascii	"J\326\305F\254\232$\036\271f\0039\333\354bD\342sZ\320\310\021"
+	.ascii	"\0167\267Q\347\315%a\334\332\247\007"
+	.text
+	.section	.gnu.lto_tryArm.150.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\375\003\345\032"
+	.string	"\0260\250F\260Z\321pX\r\321\342}^s8z\364\350L\266\t\2420Zs\202\337\2706\345\327\300*j\037Jwi\261\316\017l\225[l; l\324\307\031\366\"\370\207W\350\206\323OIKL4\300\007Iw\334{K\231R\225"
+	.string	"\207"
+	.string	"\227"
+	.string	">\322\203)\016\364\376\030\351\341\003\232\246\271\372h\247\260W\037\305\225iv\226\013m\230o:\202S\372b\232\346k\211N\373\314J\225*e\310Q\\\245\371\252\335\317gph\004\365\276z\322\365\214t1T\305\204\363\244\203\241\251\327z/E\002C2\242\376\244\343\211.('\356?\216c\244\353\251\214\221N\250\305\016\247\344\213\2175;\025OZ\241\242\213\257\210"
+	.string	"*\211\227\232\335Ml\001\341\310\375\350\312bgS\225\3111M\323\232\333\005\3354\267}\332v`\257\223/\"\2424\315\033\003\177\310\211\360\3707>ZVB\237+A~\324\375\321\265(x\372\220\2025\035\332B\233\356\317\376\016\207\303\241w\310&\3256\253n}\351f\255\232\206T\253HujT\227\242\232\\\365(\252w\325\272\352\013\370\221\031\276^Q\323Z\021\232@C1\3469*)\372\322\317\344\225\037\344J\264/y\211\353&4w\252\0321\204\300\004\037]\240\374\350z\213\374(\036"
+	.string	"y\340\205OBq\240\307 \024\n\007\177r(^R\301Nv\"?>x\003AV\272\370\200]j:L\331\302\206\037=\307F\304\204\nS\271?%\177\311%\311\307}\223q\377\343\007\210\264D\361j:\324&*\200r\310\234 \327Fm\f\031\364\271-\257\2049\243\240l\373C\006P?I\303\206\035oH\232\362\351\277![K\263V\034\317\366\246#\341\340\337p\007\030\214\374\330\332']q\374r\370\220xb\215*\270\035\013\241\317yf\212\216\363\266?\267\001\006\n\311\356\317\"H]\017@\260\334\024\214\355\235=2\037X\354\302\207\330\b\0170\237\235\b!zvxf\260"
+	.ascii	"\326Y\020\233\311t^: ^=;0\236\227\316\314\347\265\240e\031\211"
+	.ascii	"\330\354eB&\233\275V\302\332sjk\023M\3234g\n\250\315\3324\037"
+	.ascii	"\264#\246\263"
+	.string	"\204T\211:Yk\263\326\034\027\326>}\207\220\024\037\003f\b\207V\373c\255jO\343\244!\331I\265\337!\024%\212\347\322\324\332\017 \220\317\261\326UnjG%\334\230\033\265%L\320\347\312=\323[g\225-g\203S\213\016\325\376\226\234\334\031\005\362@+x@%\270\003U\250a\034%\225S\314\314H0\022\204$i\341p\002\031\2713\017\020P\347f[h\f\362\240>\216[\002\333\020/g\262H z\220\337\277N\275\371Cs\327\025\001Oy$\250@:Ab1\370\034s\203D\270\b\310\251F\232\206\357+\363\301\271!H\251\323\306\213@O\317\240\303\323\365\023G]\241cZ\237\031\237\246\342\216\022H\347\333]\326\376\307w=\331\271\371\001 \037\214\257i\366T\235\334\226\376\336\330\204\031_\n\360<\002#\177\021!\347\262\307Q\2221\036\322h\370\261\r\243\263M\375\270(1\265\020\300\330\206\262"
+	.ascii	"\370\201.\214\217\231\345\247e\243\377,x\2125j"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.156.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`M\001\325\f"
+	.string	"fUN?0O\224\016\304\360\302\004\ne\247\247\340.\n\204|\374\237\234\016\2506\354\225\351\256\354p\315\233y\260\377\223\355\303\3408\254\330\346\214\225y\030\030\344ep)S>\345IpX?!dK\231R8"
+	.string	";"
+	.string	"A"
+	.string	"\273\253\251\351\234c\227\00559>F\001\360E\357\330\345\210\350\326\204,JH\030 \212\256\002\342\007\026\330\335\207xR\210\236L\214\262\273\316/Z\270#\267\215\261m\300\376\207\226\257\271n]5n\264 \235F\235\f\261Q^j\311>\\\335`?\r\237\316\247\237)H\021\252\020\237\001\305n($\306\252\254\023\036l?3\307\3768\212\303\022"
+	.ascii	"\321\001\"\261\n\034&\250&\240\213\357E*\324\2030\224x\220\252"
+	.ascii	"\221C\003\3514\202Z\372\346\322\200\220\2456V$\021 \037\361\324"
+	.ascii	"3.|\254@rw=\365\346\272\"\320`\361I\030\366O\317\330\370\035"
+	.ascii	"\034A\223\377\036\336&\225\216\333\264-\201\206\261\034\270h"
+	.ascii	"[\227\321&\003\3141\250t\232\003\216\353\264\f\265\367P\241\352"
+	.ascii	"\250\007b\222\224\334r\331\013._\341\321\241\372\354\025I\273"
+	.ascii	"A&\377Y\325\273\245%\250\232\n, \260\202\241\271\333B\3002\334"
+	.ascii	"UX\300(\3570\226\350^\274\n\270\210E\225\357\330\031\346\264"
+	.ascii	"\331\302\332\"{\320\200\035\347lf\033hGc\024LB?7\021N\310\356"
+	.ascii	"\025\217\031\213)\270\034^\242*\212+\356\007h\207\377n\370\323"
+	.ascii	"\270\243\371%\214J\326\365\253\017\311.\355\215\313\333\256\245"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.157.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`h\004\205\031"
+	.string	"\306\352\227K\260\022R:s\305w=k\020KD\372\216\033\217Q\327\0177\007\201\243\365\341;O_\032\277|\272\177\037\251co\255\313\366\017h\377\030?9s\213\332\227z7\306\265A\315\207\354\367\244\217\204\345\\k\364?\233%d\023\"e\222\001\207"
+	.string	"r"
+	.string	"\202"
+	.string	"\265\332l\005\2518\310(\024\273\373sgv\257\004\320\324[\202\024Y\273%\254Z\353\254M|\346!\262\030\354|\271\314\222\222c\363\314\336\305\353\335\036\"\003r\254\207\004\303\312\224\022\037\234\236\237%>8;\177\375\330%t\263\243\303\246\216\033\236\022\241\033\037\227#Nw5L\216&D\250\037#6'xg\217\206\307\263\247\343\226\365vc\201Z\353\211\316!z9\3462\245\326\272\314\353\341|\001|\367#\273k`w<\020T\244O\364\327\212\237\204r\213\364\362\316\227{\322_h\200\251\325\350In\224\341\271\326z\353\225\241\357\026\241\225\216\201\354\276\350F2\373\240\355\020\303\347\235\334\307\320\223\357\356=\371"
+	.ascii	"\026\371p\274\265\213\224\343\016\356~\254\375\263\313\274\""
+	.ascii	"\314\033;/\354\274\347y_\347u\235\327l\336\222\344\245#/\311"
+	.ascii	"\274c\3636\363\362yO \003\320FD\357=4\002e\007\245\376\323\321"
+	.ascii	"\302Bp\025\272\237q(\025\b++\364\344\007\035\255\241\"\355\340"
+	.ascii	"\376\350f\313\256\204V\001x\037\201\356J\230\300\347\231]\036"
+	.ascii	"\225\320\365\255M\200S9d\007\267\354n\230\217\220J\307@\226v"
+	.ascii	"\331\003\252j\210d\323\376N\213\302\235*\230\265\352P\3661.\303"
+	.ascii	"\002\013\215FO\222}\036@F\270\335\223\303\330'\263\326\252`\317"
+	.ascii	"\364&\227}\320\311\305\360\362BOv\337i\030\205\343-\376H\022"
+	.ascii	"K;q\261\325h3\332\205\331\206\027\026\230\031\315\0263;\031\331"
+	.ascii	"\032\007\027\333\314C\255f\233\235H\270\367\017\003(b\026\021"
+	.ascii	"\327\271\220\016\336x\217"
+	.string	"\006IR*\200.\2128\336\2522\3721\r\311:\250\364\361l!\034\n\037\353qG\254\3374\214\301\032D\016X\2237\251 `\221\017v\031Ju\236\337\322P\361\354`\324\247\236\363S\302*.R\255\365u6_\331pp\366\f\310\365j[\215\007\257^\360Sb\261\246\253[b\256\2061\035\021\263\210\272\276\005f\250q8d\221r\204J\n\222\222\244\322\001\240\002\03113\017\020Pt4b\230\326C\271\271\231\262q=\220SD\307\302\243\322\343ZuX\2230\031\271\304\f\2412\206}QiF!\317\200z\327\330\346\021=\302@!\013u\225\206\352\366P\032\017\361\016\377\310\246\005\313\026\363!1\0362\214\365\265Oo@\240D\023c\237\253\250\211u\240\212\355k7\206g\237\253\365,)\036]+\002\\\201\330U8\241 \344\362\276\213'\376\004\361\004\222%KY\003\365\222R\025\023E\353R\356\356\002\250"
+	.ascii	"\026\"\023ML\271\240)\024\354\375[\270>\271\360\317\353\355\230"
+	.ascii	"\351\007y\307\256\251Q\036%\233\350\312d\027\017n\207\017\304"
+	.ascii	"\270\n.\027\355\275\231\376\007"
+	.text
+	.section	.gnu.lto_updateMagHold.158.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\372\005\275#"
+	.string	"\232@\304\rH\220XN:\301+\232\334@\324m\342\303\370\324\315\035o\352s/]>>+\277\3566"
+	.string	"\217?;\265\253l\355G\200Q2>\313\231DWxWO\220\230KKnU\344\364\260=\307[\034j\341twk\204\220M\244L2\276"
+	.string	"\274"
+	.string	"\317"
+	.string	"=\312\313\243\274\273\346\325Q\336\034\345=I^\223\362\226$/%y\311\346m\346e\346}\200\236\r\025W\367\232R\353\21283\225\215\"\271\361\262\357\276\307\376\270\273\275\217\223\375^6\365J\254\247\332\n\303z\253\265\n8]\244\363\324\346;\345)?\247<\375n\177\273]|RT*\002a\306\241\0201\265V_\323\370\357=\336N\227;\315\222\222\315\277\275\331\224#^Q\275g6\361\260\276\303\212\301:\343s0"
+	.string	"\200\2610\362\t`F\213\342\315\342q\310\345\213S\232+\3411\005\223\273\253*\356*,d\220F\265\326\217\235\255\256\202\314fS\255u\231x\325\342K\363\335\355\262\273K\273\264I\026\220\332j\255\005\320\236v!\203\006\r\345)\331?\236\3420\246\215!;\371\245R\327\037\273\016\314\314\215\374R\331\255\353\345a1\370!'\262a\377\265NOO\345i7\002\257\"\220\343\316\265V\252n\256U\373\333\236U\265\002\217\2709\230A\251b2\373\346>\232P\f\220\343\016\344BV\355\254\265\036\330\233=\310\207\375\327\351B\205\340\023O\367!v\255I\030\323\304\220"
+	.ascii	"9n\367\030\344\346\332=Y{kW)\t\351\310\3445*z\331\227\210\344"
+	.ascii	"\035\"y\205\2307\210y\201L\336\037\223\327\307\344\355\311\361"
+	.ascii	"\362\234\274;&\257\016\363\346\224\2748\224\367\206\362\332P"
+	.ascii	"\336\232\222\227\206\362\0065}\323\027\202\025\265\215Q\327\264"
+	.ascii	"\251U\203\t\251k.\316\365\326\376\370\2738[\3132\223z\311\222"
+	.ascii	"\250\213"
+	.string	"\332jK\2244\375\031fn\313\340P\032\234\265V\025\330;\371\023\007\017 @(Oi\372F\343\232\030\031\220\343\316^'\365\231\342O\224\274\356\365\205YD\315\353\256Qd\b\0074\233k\313$a(R\353\234%\221B\0365Q[\351\370TI\324\375cM\313LJ\025\223y\271\273F\342\266\237(s\275k\235\226W\2340+\270\307Z+E\201\366\251\362\250\373\207\2222fPr}\324\2146\204;\273\354\\_\210\303\3543\311\225LE\220\300'J(O\315\316\025i\227\375!\234\356?%\331\264K,B\036A\n725\240k\267\302\325\002\036\240:\364:1=IE9\371\234<\370F@m\020\341s\222*\341c\332\331(\022OR>\023QQR\276\335\021x\262\366\326\236n^\330\200\035\354\r5\230\037\271P\0175\243}\231R\362b\201\350M\210\026\215L\306\2205/\250\273\254ZO\027\227\023\277"
+	.ascii	"uN\007\3754P7\026\341\033\320\247\177\332\347\214\220GO\353\264"
+	.ascii	"O\223Qx\272\247\237\343n?\035?\313\362-\277\260\004m\247\273"
+	.ascii	"\277\035o\373\211\235Z&\374\306\ft\325Z\377\025\365]+Oy\372g"
+	.ascii	"^dV~%\352\347\343W\366++Ow\332\200WQ"
+	.string	"\251u\232\2142\204\243\302\226\323\030\214Kv\315\265\234c\272\216p\315\3069\340Fm\025\3458-U\304\273\n\026\360\2118\rb\t[\260\251\366\246\225l:}\250a,\004\225B\206!\231\2410IA\241\325\200\002!\021;z\020pF\303Ic\323\344\003hI{|\022\336m5\272)#\020I\222\202fw\301\362)\246\001\312,\356Y\357L0\247:\004\371\273\363\230(\313\335\342S\243\213\023h\205\374V\227\234\244\302\200v\313\216\212\244)\022K\264\311`\350\321\026_\335\004\221\200\335\361\030\360\207\007\374x\b\374[\360\345\267nc\2401\300\240\344\362\333\243C3c\035\035\002\312z.\003\f\211\226\327\356Tu\352\304\313WxYpn\355\204\341@\351\352\025u\327D\344<\032\032y\214\274\241\315\307\2258\321\270n0+f\221U6\225GRMe>\252mBGK\034\332\263\035\t0$\353\026iN\344"
+	.ascii	"\260\341\025\266}\350\310\340x!R\0360\313@\036\351\177\220C\252"
+	.ascii	"\303\260\361\371\341\227\377q\217]\320\f\177\345\031\037u'\317"
+	.ascii	"\355\375gm\024\210u\352\350\315\037"
+	.text
+	.section	.gnu.lto_areSticksActive.159.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\270\005}#"
+	.string	"\212A\f\016K\240\024R:\224\307|\343\320\244s\365@)\375\330\252\203/\255Ky\3070\364\233\353\223(\234\0269.\350\200\351\377\266\327\253\3651[\277D\357\025\353"
+	.string	"\256\322k\"\26177\036\027nR\255\232*/\327j\337\376\267}B\266\334I\006\317"
+	.string	"\272"
+	.string	"\315"
+	.string	"\277b\334O\276\216+\203n\305]\277J\367#\250H\005!\273\367\022\370\311\fj?k\376\202\376\264wA\177\2369\210\031W?\005\304}o\023\025\327\275J\003,\240\366S\301\202 \026\272\022\306\221O\252I\304\244r\257R\330/\270o\225\347]\025:o\247\313\341n\266\032\r=mW!~\210\363lo\205Ep\254;\027JM\327\331\007T7b\274\b\222\n\333WZ_+j\316\006\307\224\242\336h8NJL\267-\241\250\265\"H'h\273$\"[\303\274\r\r$\246\212\232\370yK2qk\0234YX\331%\211\260\273\250\261\343\231\257FIC\265\177\365\263\005\324\326T\231\223R\323+\r\347\336\313\265(I\351\334;\363\0050s\004\346\023BC\f\370[\337\301\303\227\361\223{<\324\027\375\344{@\177\002\333Ve\254g\354\365\224C\3116\222\353\271\013\375\365\231\037"
+	.string	"\305k\3112\311P5\353{o\210n$\263\362X_\342(Y\304\375\304|\363\251\337\246&\210V\006\242\225i\270\362\fZY\346X\347\230[\235\177\2662\214\255\374\322\225}\266\262\213\255\334b+\263t\345\236\255\314\263\225w]Y\327\225s\2662\316V\276\331\3126[\271f+\323le\264+\237]\331v\345>+W[\371\001v\244\034\221H:\224\326\275GgU.\221\023\310\214c\375V\257\314g\376\222\317\304\002\372M/\210')0\262{\225\016j\257\342i\324\361\306\353\032\261]\343\232\327O\205\350z\3273\271\3265\260\213\307\225k"
+	.ascii	"S\266v\267\306\265\214\225\224\206\255k}\263uL\030\255\337\265"
+	.ascii	"~\032\325M\353\237\221\244VJ\206\340\336kk$\332\357;-\305\316"
+	.ascii	"F\273\247\244d\266\273\317~\332t\254g,\323\266\321\260\332\335"
+	.ascii	"'\272\302\025\376u\241\326u/\f\031rr\320\237\265_c\351I\031\221"
+	.ascii	"{o\255\221\354\263YyEY\206\rU\263_y\357\2455\222k\026X\322\002"
+	.ascii	"[\246\215\270y3\206\031\272\327\030\340]\\\216\rU\263\t\377\301"
+	.ascii	"\315\332\275\267\001\277y\256\241\316\206\r\350\3177\205%'8\200"
+	.ascii	"\030\353\231E\211\367\341s&0z\320\364/I\215\001\306|r\356\234"
+	.ascii	"\207\317\263\220\334\0339\037\342\207\034\373C\344!J\370\341"
+	.ascii	"\2403,\352L\330\031\022\177|Xxx@\247\3303\024\0165\b9"
+	.string	"\020sx\204\303\242\217\360\300\013\367t\320)\n\177zz\212B\234\322\370~\342S\275\306D\252L\253\271\343\013\241g\336&C\312\211V3\367\013\24133\3158\306>\362\032\311\272\034\272\233n%\225\300\177\006\376\353\232\\*\261\267\221\314\\\340\277\276\351_\335\202\021\250fUB\366\243L\327H\246}\310\203iX\022\027l_\026X\325\215\017\204\006\3230\022\266\232\246I\301\304P>r 4\246\215l:\246\333\352\313\306r\314\230\203\351\340K\2734\214\257_>\234\350\265\257\201S\322\246\226vy\263tK\007\215$\277\322\250c\314\275\027\307R\265\034\322k\226\266Mz\r\\&\233\001l\250Q \346\020C\206)\022\021\031\221\202\202f\fp\002\231\252\272m\021P\271dg\223\302\264\033\252F\257\247\210\226\2230\351\026\366\306\2567\344l\213g\031\260\t\257\247\033\004&\313T:\332\312\321J\326\016\203aH\240"
+	.ascii	"\251\f\237e\361\215\231%@\354\t\211T9\334b\266\330\346?\346\332"
+	.ascii	"\25240\004\306z\236\235\274\005\233\330/i\342r\243$\1773\340"
+	.ascii	"\0054t&!\343\326\250\253\032\244'\204h^Y0uzB\353\362=$;\250Q"
+	.ascii	"A\227\216\004\365\241e?\3231b>\233\267\177yT\003:!8\266\267\004"
+	.ascii	"\n\003\032j\226\005|]\260\326h\006\245\263\230\312\030G\220\362"
+	.ascii	"\347\236\264\351\017\035\033\271\313\242\363-\222\273\273\314"
+	.ascii	"\032\020\331\312\253\235\034k\"L\370\212\217`\242k\225ll0=\036"
+	.ascii	"\2027\036\251\207!\375\017"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.160.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\315\007"
+	.string	"\262\31776Po\322\001 \017\233D\370u\217\213\341\023\311\276\266\001\203_\022\005\225@\333m\033r\330\203\"\302l\375O 'f\0267m\035V\025_%\320\247c\303\266\2252\245\021\327\247!\3738\\ \317\203e\254\223m\032\0261\2108\341\271$\"\266\201b\207\300\032E\266\305\nM\333\242\365\3555\253&sT\034\251\221\222|\365\277\227\\\370!\266\b\345\273C?\2649|\0273\272\301&\365:\360rb)\255\220re\177\242T\017\373\232\335]\253\311>\352OM\037\n\270\300x?\241\354j\254f6\005UDl\337\262\235i+,pGaXw;ZRv\277\004#p\016\315\331\252\177 [0\222Q:\221\331\335\250\037\347\236\234\177\222\007t\236\350\t\300\260\273\316\316\333\270\365\266\017lG\333&\001\b"
+	.ascii	"2\241\217/\260q\361\324\f\354.\243\250\324dp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.161.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`$\006\225$"
+	.string	"ZC|\016E\220\232J:\206X\0200\304H\343\212&\255\347P\036\353\215\004\300\353\265\343\352q1v\313\353\fA\326\377\231`]^(\234r/I"
+	.string	""
+	.string	""
+	.string	"\242[\3131\247\245T\002,\310g\225\\XM\327lkd\267$e\n\326"
+	.string	"\274"
+	.string	"\332"
+	.string	"k\035\271\336\355\326:\335Z\024\3279q}\271\336\334Z\017\370\324"
+	.string	"\351R1+s\322\030\312\231\\$\233\020%\323$\035\204P\024\211\236\331=\267P33\020\266\031ia\367T\256\r\303Z\346\236\222\275\3209N\026l\212\b\337\346<sRi\246\235J#H"
+	.ascii	"\303VC1\256\322$\025\301\241\265\344\315\234\023x\037j\245<\276"
+	.ascii	"\235\036Og\247\023e\356ke\3255\220\020$S\333\352\272R\036"
+	.string	"_\216\035\273\243c{\212\345\245\274\\\323\333Z\033\365\302\225#\367\243\021dK\313T)\214K\270:J;\257\033\253\3235\340Q\303KE\255q\245\227^W\214\315\205\361te\355\275p\341\310%\3159\265LWFWpW\327`\316\351\335\352\252\241\356Q[\245\355\007\266\\\013\277\322k\n\361\007\201F&k\343\270g\223\246F\211\266\224\210\325\255_\313Tg\244\255\341\002\347-\353W\326\211\t\372\357\336\261M\217\0245\025q\037tM\242KlnN\264\322\330\004wh\375~\343F7\033J\323\034e7\347\\`U\242KHX\201\250\264\211\251\325\255)Q\245^\275\204P\304\330\260vh\237\005\367`\266~8\034\016\375\036\266\327\006\200ONMJ\246f\322\255\227\3045\001q\255$\327Ir=@\256\005\3105\222\\\037\355\326Fr]$\327Dr=$\327\001\344ZH\256\177r\035$\327@r\375#\327"
+	.string	"\344\332G\256{\344\232G\256}r\275#\327=\271\346\355\002\303\241N\321\233\210>\364\242\037\301\215c,n\b\235\350OZF/+\035\001>\364\3252\206\375.\364"
+	.string	"/\021\034C\3433\347\334\035\314B\377]\203\b\335\350k,\214\016\300\235\276O|\316s"
+	.ascii	"?23\216\365\334\347\005\236\250\232\366\034\t\214\357<7\202\033"
+	.ascii	"\303x\337\271\357\242\231q\310\356\277\357\374\347kl\3138$(\036"
+	.ascii	"\314\277\367^\205\326\306\373\356\275K\270\321K\347<\b\212E\302"
+	.ascii	"\025\235\253\222\037\272\357\256Zs\"h\025\tS\224\312\004\n\025"
+	.ascii	"*\210*uW\035B*>\233s\312\203\371\202(>\004\332\030\333\202\256"
+	.ascii	"]\330\315\231\245\300\032E\245`\310\240A\203\250R\274\013\341"
+	.ascii	"\02413\254\035\3169g\356`N4\367\020@\373\323\r\242\315\301\303"
+	.ascii	"\352V\356*\346\f\022.Y\001\036\001\225b\204\212\017S\300\023"
+	.ascii	"TSSTQE*\244\252\356((\251*\252(`T\b\340\t\022\037\246\200QU)"
+	.ascii	"\200P?S\241\220\252\002\252\240\242\252\002\366\316\260\364="
+	.ascii	",\272\251\342\003^\204#\":=(\r\316m\327t\321\315\310{:O\332\032"
+	.ascii	"3\235\365\205\310t\031\266\r<\t\353A3\335\300uA25\25599\236\247"
+	.ascii	"\003\317\373:\202fT\303\024\347m\315w06]\372\n42`.|Y\272r\t\265"
+	.ascii	"\3001\023\270._;\004\276B\237(\201\357\331\0318\033e\222\244"
+	.string	"\365\016\246\027\306\240\021\204\247\364*m\242J?\241\006\350O\027\266\005\277\2509\351\317\201\222\376s=\033p\001O\272\306\215cG\003N\0047\016\311\242H\027p]\334\030v\364\337\221\236\2133\372\221\003\335\342ft\255\"l\0233C2\fw\250a(\004\021cJ\211E\"\222\244 \315\030\240\002\221)*z\020`eT\2325o2\345\257\350\246\310\343k\305\002\235\202\035<\360=mjo\247t5\300\340\007\f\215~\364\t\rw\211\216'\334<\311}\311\206\263\350a\\\330u\\'\276kN\301\215X\223\346\025\363N\271\035\373%\235\310\227\225\326.\b\n\024f+\013\272\260\244\222\003#7'\302\277\220\274h\312l#\254Q\006\0219\310\316\241\320DD\325iwx\203>f\333^#!\241E\f\237pL\307Ct6\241x\333|\224\374\3606d\314(\177\363]F?\351\201\346\245\"Gl\221V\223\177"
+	.ascii	"\275g\303 \363w\004/BE\270 SJ\f\020\270\272\317#g\216\223\312"
+	.ascii	"\002\237\204\315U\013\305Px9G\246\254\356ME\006\332A\257\310"
+	.ascii	"h\036!\325\353Y\223\262>\035\263\371\003"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.162.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\202N560q\323\001 x5\204\035P\253\024r\251)\214\362\"x!\3635\250\027'\302\3366j\314\216\020\210e,\341K\004xqp\252\335\305\032\006\002\237\206\321H\2232\245\032\017\351\253\343\311\260+^\021\221B\002b\"^\231E\354\024\030\253\360d\361\002\303\262h\205{\373\372\321)\031\021HC\246\364z\300\322A\003\312\2237icd\3449JOz\203'\n\351f\207[\352\210}jU\304>xS\232~%\020\203\322\375k\331\0059\325\254\251R)9x\373\237O\262up\203`M;\360a\342\245\274\354n\302+s\002^\335\376\330\226\025\026>\326\f86\030\216w\342Q\232\331\r\243\222\\{j\376GwX\371\\\270n{\0020\354\256\223\353Bn=\202\355R\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.164.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\002L,3Pm\222\016\244\004\252:E\250+ky\001.h\021\360\346*\355V\nk\366\357vx\255\340F\020\266\020UeA\304\312[\001\202*D\237\032\323\354\3362\005K\027\f5IMrh\021\017\r\020M\242&\332\245\340I\002C5\212i\242\232%\313\342\347\320\200\203\235/V\220\352\202\256\310\\\255F7\003\320\350P \203s\241\3176\207\032\337Jf\346\370\371\357\303\201\023\320U\214$\323\023J\311\222H\244\343\327\274\345\004\005\315U3\016\017\201\307\210E\bJf\326p\243U\257\272\375(C\0073\261\256M/`!3?\353\302\350\330\037\341?\370/\002\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_processRx.165.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`q\001\355\016"
+	.string	"\246\233cE"
+	.string	"\221(\035 \240\261\271\013\027\376\373K\210\341\037\2049@Yh\261\342\375\355b\204PD\227U\252\341\255\376\355\376%c\024\353\215p\223z~\377\004\372\363]\304\314\264\311\275F|\354"
+	.string	"\312\357\3376\262\267\224)\005S"
+	.string	"I"
+	.string	"O"
+	.string	"\007K\260@Xn\254Z\350\230\023\334\226\304O\327h2\256\236|"
+	.ascii	"\037\352\032\002\327<\\v<\276\f\032#\202\230\214\034\036_J\374"
+	.ascii	"\260Lx\235O\245\033\r\264@\310:_*\202f\274Vo\271\252|+U"
+	.string	"\215\310\234\323\352}\035\356\315mw\266\025\330_\021)\335\025\373\033\206a\350m\331s\327\317\261ZZ\275\352\177\234\314X*\337]4\346d\2052\363%cN\3306\331\035\333\252\366S\\\205\351.\f\346\3149\002\005\314\234`\002\037\330\\\202\376\321.\343\007h\227\266\275\200\201\311\247\335\207\372$\232\315\205\364\336\356c\260\035/\307\300\370\200\212\273\342r\r\240\240y\221fO\030\351=\335\277\200\311^\233\n%\275gu\021r\370LD\370\262>i\337\b,l\250tf\251\234\265O.\350\275\357[\376\r)30\262\230jQ6\030\245\221\320H\324\300\244$\324u\0268\001\346BB\035\211\3338\t[\211\210d\264q]i\013\371\230D!\324m&$R\267u@\224G\315\263\221a\301\361\022C\357r\271\032l\313\265\b\312\246\342\234sjF<\0335\020\215w\240\331\017 \274\006l\246@\b\260%w\003\037"
+	.ascii	":\023\020\3520\235\r\367a\205\200\203\244\261\013R`\2155\300"
+	.ascii	"7e\215\004f\221\253\264\006{\300:\030\302\020\016c\204\202X\n"
+	.ascii	"q\257\272\blq\265\0339\330\322e\024\256\242\226\037\246\200\306"
+	.ascii	"b\253\351(\304HB\r\270wT6\317"
+	.text
+	.section	.gnu.lto_processRxModes.166.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`v\034\255s"
+	.ascii	"\372\261\240'H \316\342\031\003W\317TF\351\200\036k@\032\272"
+	.ascii	"\320\352\312\316n\334\335\222_XC\266AL8W\360\2413\026\266\207"
+	.ascii	"\201\212\355X&n\373\210\334\353\251\263f\234\375\366\007Sm\264"
+	.ascii	"U\265\320o\206K\256^\274I\310N)\245p\002#\002s\002\256dn\346"
+	.ascii	"\356cnv\343\265^\363qs\317\203v\207\270\375c\321\032d\361\201"
+	.ascii	"\274\017\234dW\367\254\031U$t\301\274\"\001\355k\230S\354\352"
+	.ascii	"\232\265k\216\211U\032]\367*\325J\276b\2663w\225\266B\333.\004"
+	.ascii	"\326q]\252\035\241\353^\251\270\211\331Jg\023\265\255L6\206\266"
+	.ascii	"\225\fef\323\3276\327\210\312[\306\327\350\272\256\325\243\320"
+	.ascii	"\320f-\334\002\037\262!\263\300Y\270\220\ty\220\261\260 _\341"
+	.ascii	"@\006\344?\266\302~\334\307|\274\307z\234\307x|\325Z\241\"\005"
+	.ascii	"\212\023&Jda\221\030!\342*\004\b\253*\252)\251\250\017PO\036"
+	.ascii	"\234\232\230:,9\2258$!m\320pd\224\241\210h\b\203P\020\320\217"
+	.ascii	"O\017OsG\207\271l\225\311w(\367r\253C\325/\212\006\360L\254Y"
+	.ascii	"\013\\s\013p\207oO\234\r\335\232YpK\3019\213\233\023\347B\240"
+	.ascii	"\265j3a[\325y\260M\315\031\213\240\322Y\270\245l\260\bum\332"
+	.ascii	"|e\272\3049\260\210\032\235\"Q\243J\234\001\223\374%Is\266\202"
+	.ascii	"VD\215\"q\366+\242F\321\220\250Q3\347\276\276N*\241F\247$8\363"
+	.ascii	"\005i\336KFM\277\024A\242F\203$\211\304\254\251)\322K\212\350"
+	.ascii	"\321\250\004\211\032\005\222\344\311\226\225\031\3019/Y\004o"
+	.ascii	"\210\272&m\276\"Q\243?\222N\276N\036\241FEp\255\267WD\272\212"
+	.ascii	"w\216\247x!\035\305\211\3076\361\350\350%\262\215\236\225m\343"
+	.ascii	"X\313-\022lz\004\0335.b\215\013~\365&\235!\024\3238\210\304\266"
+	.ascii	"JD\364\252\3040N5\005\246\245\276x\361\250\345\326\207.\r\325"
+	.ascii	"e\213?q\031t\017\\\260\270\223`7\271`3\005v\207@@_\372s\347\025"
+	.ascii	"\245;+\316\301\256\223\354\254\216T\305\352\033\354\250\270\206"
+	.string	"\272>\252\243s\243\271\3160\007\347EO\306\b\201s\242!\fo)\270\320r+\310I\325\201~\336\226\242\bQs\237\245\036!2i\032\2538R\207\2745\317\022%\336\034#dI\022\337\231\"q\2351B\332\322\234\031E\b\232/\235\256\353\372\234\225y\353\303\225Q|\316zx\262yF\346\237\214Z,\224\323c\204\270%\211\314\236H\233\257\035\310Y\324}\271\345\272.\273\364lHs\004\315\334\25213\016\346\"\f\002\357r\364\276\364\230&\023\202\034t\312\224\266\225@\257\245\330D\326\271\346\007-\215W\342\305\221s\226e\331\361\240\225\361J\2618p|5c\323\371y\257\025~\016\333\235\3761\237\332>\243\247\b\344\366S\353\363\335\245\275@\351\240T\240V\250\265m\245\317\20305\244C\033\363\367\311\004\317\226=\320\273\236;l\264\375\201\304\204\226\307\351\362X\205\344\214\310)\237\315\260w\224\234\271E"
+	.string	"\336\322\235\357\304,\025l\026\266M\224dX\253\363\027 9P\027\3202\037\220\200\267T\347\033\233\245\303\222u[v\361\312sR\333i\337|\315\034\243\227\206\314\263\334\235\324\266\337i\317^\206\026m,=\370\202\333\215\031\200\001\243me\373\025L\005\035\321\224O\343\335\214\2170\205\3158\204\241\310\\w\214)\371\312o\037Q\242\376\362\177\362\217\016},\372\377wY$s\214\016\204\200\351\272dX\334\177\r(\001\267[+\231\002\013\274\245\255\344\266\240m\245\177\177\231\n\322\331\215\371\313@\316\\\343\206\267T\306W\371\025\022:.F_\214\371\032\365gc\356\177\3377\016\377\t\314P\342\234T\231,\235[\215\351\334iK\347Fc:?\231\316<\332\256[\203\316k\246\261t\236\321{\3152t\234]\3508\267\350k3"
+	.ascii	"\356\314\302\235\267\334Y\213\351\274\302\235U\270s\nwF\341\316"
+	.ascii	"'\334\331\204;\227`:g\2713\226;\223`:\217`:\213X:_\271s\bw\006"
+	.ascii	"\261t\266r\347\252\2453\225;O\3658K\3658G-\235?\2703\224;?\271"
+	.ascii	"\263\007\246\263\023\323\271\311\235\231\226\316\035\226\316"
+	.ascii	"K\356\354\\:+\2713\007wNrg$\036\347\rLg\r\356|\344\316"
+	.string	"F\356\234\201\351\\\344\316DM\347!w\306\340\316BM\347\240\2463\220;\377,\235}\334\271\307\235y\334y\307\235u\230\316\355\216\263r\3079\251\343\374Lg_:w\313}\360\213\222\331\263\212\360h\256\256\331\013\351b\225Y\340\372\332\235\327\275\327\255+\003\337\211\357\373x\365\364\315|\372>\203\f\341\341m\030i\017\337V\336GG\020N/\245\245o\372\261_\264M\357\364M\275w\220\337\367\215\264\032\261c\247\227&\331Im\323\217\210k\372,\305\256z6fBb\372&|\335P1\026!^mh\227\251\027\376C\330|\330\266\375$c\346\211\346\020\333\343\305\370Qj\306\367S\333\341g4\351\360M\023\"!\247\326\027\242\326^#X2\022\314D~\371\340\257\323\033\227\027\352\312\373\251]\372+&K\377TCt|za\306\006\017\016\031\017\317\3068\356\226\224\r6\365\232n5w\325\262A\2466l"
+	.ascii	"\036\210\323\235\377dtr$\315\374T\264\022\211\350w\357\233mz"
+	.ascii	"6&\003\274\373\271\246\315\323Mb$\027\254\326\023\351\222\016"
+	.ascii	"\317\006\246\033\355\215\236\342S\253\364\215\346%(\375\322\315"
+	.ascii	"\034\267\251\265\357\336\027r\211\303\277\034\001\334\373\031"
+	.ascii	"\247e~\276\360t\364\226r\370\226\310\373\373\276\215\316\244"
+	.ascii	"\367\272\347c\322\267\034\223\350\213y\277\357\233UBj\244\357"
+	.ascii	")\203\263\350\270\310\201\205ox\346\347\013\025s\2229\tn\206"
+	.ascii	"A\024\332\243G\333\312\r\177\245&H\307\213om\336\244\247\216"
+	.ascii	"\n\032\3769\202\206o?Eg7H\304\220 \035};q\267\217~\006\023\262"
+	.ascii	"\027\353\rFo\303\177\204\225A\253F\377g\220e\246\326\037P\221"
+	.ascii	"g\330\250\206+ P"
+	.string	"\265\266\362\370\210\215\036ex\033\311\f\037\326hd\302\fz\026\366\006kh\2353!Ca\3638C\330E\317\303\307\212^\205k\351aV-\"z\033X\256\324P#%@\323\274\245D\337[\036\271`\311\210\206\"}\350\273\310\2241\362\025\3436d\b\311\206\316\347H!\006\f\337v\216\030~)&G\315\324\032\225u#\364lk\372\205\347t\315\\\247i+\217rDE\244\0045b\313x(3\025\304\340\220\001b4\323\310x\265\004\252\366hd\007\020\311\217\320w\024\2754n\204~\202i\031G\264\240o\363\207\3227\032<\215\017\372\2262E\324C\3237\215\372\353\323a\255\0320V\016\324\32056(\nE~Z\2308.\032A:\351y6n4\235\030\266\003Z\255\266\255\354#S-\215\214Q\356\r}k\231\241pP(\336R\366\304,\030,\331\213\361\022H\033\217\006\017\024_;\300j\200\301\340\332"
+	.ascii	"\f\254\313+\0030\237\257\030\037\324\330\200\313\005\007^5\276"
+	.ascii	"r\270\350\002\333Q#\210\013GW\002:\272x\344\360\352\"\200\353"
+	.ascii	"+\206\216\0327\202\276bpq\220\303\0010\035\\^^;n\364\360\215"
+	.ascii	"*.\257\256\033V7.\260\322\221\243\006\007V7\274\276\254\252\210"
+	.ascii	"\270\253\003./+\260\256./\253\346u\254\223\356"
+	.string	"\237\300\036\003J\230\007\246\332\305\003\321i\262\004;\366Q\306\341.\344 \340\362"
+	.ascii	"\213\377l\273\256\313\342[\"\036c\353?\313\334\372\027\323$\211"
+	.ascii	"\003\031\376\232\020\301\222\311\301\320zo2E"
+	.string	"\353\223\212M\316\260\321\006\236\215}\001\251\326\222\252ay1\325-\036\b\224\025\337P\346\254\370\n\252{th8\274\005\335\223J\263M2\360)\344\371mY@\305\177V\305\267D\b_\244\370\317:\245\350\251T\355\372*`\370B\033\353\334]\2228\016Y9v\t8\234\257\27065sw\275\246\344\n\017\252\346\003\230f\2461\016\002(\276E\033\024\337|\323Wfje\202Id\203\346\200\023\357vk\302\276\240\325\023\337R\332\316\320-\003\207\210%\032`\342\213\316\230\370&\235R:&W@\211\377\251C\323%~\031'\271(F@\307\005I\223\365\035\347\212Y\337k\224\f\200\365?u?O=\254\357\276\3567\300\2648\307E\262A\001H0]\022\337kE\346\00408\247\337T9\303\347\302\347\355\036\r\016\017L\013fC\320\212x\033|\216\3650\216\370\364\373{\006>\003\333V\212\370\n\332\3028>"
+	.string	"^\250\214,\334?\252\233\310\255\020\312\020\337\177T\3049ZV\276\323\324,C\214U2+@|S\005A\274\377Q\013\261Q\025N\330X};1\264\372\336\253F\246\250\322\251\372\246\332\315A1H\005K\366D\232\344\004_\247D\321a\353LT\277\371\332il\017\215\236b?\265T\337U\2670\216\230\022Lv\2764\3257\223+T\337{yYS\357\225\234\372\246\306Ab\331)R\223p\344\227\"u$\244\236\275\317\375\236\207\317\301gaa\273\323Gm\324K\375\013\372\250\213>Yp\275\347aU\033\363S\213\347=\271xHt]\027\253\225\354W\307{zy\202y\">\021\333VF}\317\265\361\321\331\031\340I\377\243\022aC8W\306\021j:T=\305\247\366\303\267\032\225\017\337G\332\366\350\330\305\326\\\300\023\001\365^\017\025\202i\250\362"
+	.string	")\224\203R)\221\021\021\221$)H:\002\013\020\bBi\234\250\362\006\022\2003)\311\265\230\321mR\350A@`[G\0277\341F\201\337\0320%\273e\300\356\323\352\360\007\307\227\260P\3400A\254:'\246\222^*+.R\265 q^6y\325T\347\304\255#\301K\007z\006\210\351\233\215\177\300\301\"\323\0315\260\335\320m\215\215H#eI\003|sy\235\264\037\360\3447NKY\177\207\017\272\003b\251S\377\033,0_\273i\246U\241\273\212\224\304\021\332\350f\367R\177Z=\364|\214\227\274E\177\352\254\335o\3711@k\347\227df\320\2678z\022Z\300\033\241\377\310nn\324\235;\032\344[ \341X\032l@\004+F${\365\004\3368\026\272\212U"
+	.string	"\036X\227\332\245}\233\205\377\240~\332\305@\244k@]\226\3026\310:\022y\365\210 aS\031{\005Q\213\265Zh\302\024x\004\263\321\003+\036G\340Y\304\221\222G\031%\025F\020y:\350\rx\215\325\233\263\250?`\233\253\337\210\316\037\tO*\007I\205,\213[oO1\"V\264\334\246\003\027`\244\253\007I\321F6#\225\354\360\227H\nVj\210\307\033\227_:\024\241\243(\f\026\345\340\302\326\016\312x\032\373kA\314\351&\215\263bV\216\365\256}\016\241Xd\331h+su\326\374\224\037d\374\025@]\271\267\023<\367\216G\374\237\246\305'\324\360l\364l\257\315\221\"\347\237p\330\3101\207'h\fQ\013\323\032\277"
+	.string	"\234\357\0070&:\354m"
+	.ascii	"\313qQ5\275\253\346\033\032\365\302&\323>(024\rU(\301IeD\301"
+	.ascii	"7\330p/\215\016\336\351A\330\214u\340\032\353\300X\362\";-@]"
+	.ascii	")z\226\302\2140gmY|\227\221<#\275U\b|\300\b\233\024S\364\306"
+	.ascii	"\023\034'l\331IZ\331\242\217\016rB4oL\315*\336\265\311\f\302"
+	.ascii	"Y]\376GS\361\024U\367\2001\242n|\352\r\006\254\037\305\243\315"
+	.ascii	"B\215{h\244\231\262\243\233\037\r\310\"\216C2:\202\221\001\306"
+	.ascii	"\225\337<l\201\236\204\333\326\362z\350\245\222\267jF=\205\177"
+	.ascii	"\321\340\313;\236\302\200\237\205\020n\352\354\212\270\250\365"
+	.ascii	"\005\342\204-\306KM\016\251P\254\266\373\3572\225\322\231-_\374"
+	.ascii	"J\247c\002\205\377\272\330\310y\253\033X\3545\302\032pgf2(\310"
+	.ascii	"Jc\205A\001Lkd7\033\341\253\234\252\305\275\201'\034\313\f\253"
+	.ascii	"i\326\300,\211(\264ZJP\215Z\314<\352\350\023\230\2051\324\032"
+	.ascii	"\200.D\336\f\343\024&\007q&\364\357|\0210b:6\361\251\027%\322"
+	.ascii	"SM\214<^\314\232\216\210w\342%\035\206\027[D|\373\320?f\336\322"
+	.ascii	"\020u\264f\001 \371&\247\270\001\370_\334\031\020\027p\331\013"
+	.ascii	"\246_\n\207!\362\365#\226j\265\312\347\030'\226\250\315\335\b"
+	.ascii	"$\346oB\201k*Exr\030\374\27501\200\004\244\234,\241x\316\364"
+	.ascii	"3\302\266S\235\225c`c\030\202\315kh\034'\352\345(IN2\226\222"
+	.ascii	"e\303\344I\201\321q\224\f\270\246)_4m&?z\212\003\242\342U\004"
+	.ascii	"\"S!\372\256\030`.\2454\265\023\245\020\215v}\363\214\352\264"
+	.ascii	"\037\211*\266G8d:q`\330\260\202ila\025^3\266\221\242,\312\273"
+	.ascii	"\025C+\222\245&\n\256\017\272\203;>\274\240\253\201\377\316u"
+	.ascii	"\314n\234\313,\363\323\206#\276\322lx \361b]b54\\Y\367\376\243"
+	.ascii	"\2579\221\321\365\325\365\315\370\002o\216\273\212V\327\236I"
+	.ascii	"\340AAzI\225\\J\002\2179\021I\032\360\307\357D\310i\332\325\f"
+	.ascii	"\276\366\261\231&\341\2230v\370\277\340\207.w+\234F\375\302|"
+	.ascii	"\373\f@A\260\265\214\r\240\304\024$~F\261\232\n\231+\036z\321"
+	.ascii	"\3564\264Z\005\365\241\313\034(a\270-Y}(E\234\345\216\032f\341"
+	.ascii	"F\232)\210\305\316\355\276\340X\277\342\317\361\260uP\206B2\203"
+	.ascii	"q\243\230\222\220\330\206\273\314\026,\372?<lj\3205\f\t1\336"
+	.ascii	"\207\307\022\035\0361_\245\327\342\036\022\213\034\2722\003\347"
+	.ascii	" A\r-\3478\221J`\233h\304\b\347\034\314pM\004k\003>\323:\210"
+	.ascii	"%\270\\\364\322\237\346\210\024:~\232^\004|a\255\343\240\232"
+	.ascii	"\241_\264"
+	.text
+	.section	.gnu.lto_subTaskPidController.167.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`Y\f\025:"
+	.string	"\312c\264\025BPdR\007\223\3014,\254%\211\360p\331\363\234\025\t.\024\256\265\021\025V\216\275x\243XM'$\3774\220PD\203\300\002"
+	.string	"j(B\001\300\264\352n\017F\203D\375\031\325\377 \214lM6I)\245I\001-\001O\001\316B\240s\320:\003\255\263\265\316\252\352\374{\347\3779\373;\367\204~\026*\303\201\326iw\367\226M\007\3356*\236[\317u3w\3231\221\231\347b\364E\273]\243O\214\017\276{\347\b\264\312X\301v\346\246\322pk\307\315`\341\275E\322\200\271w\316"
+	.ascii	"\003\b\266\232\354\242m\365\327J\266U^\231\361\030\305\356W\002"
+	.ascii	"1\314\261+}\367\336\253\177\366\332UTSI\344Q*\n\352\311\311\330"
+	.ascii	"\304T\\RJB:2*\"\032\"\016\205A\240U\177\357+7]\013\227g_]E\305"
+	.ascii	"e\213O\331u\322N\213#\271\364\221K\234K\301u\324o\200\232\032"
+	.ascii	"\035\255g\006\367+\272Y\263\323t=\365fF\305\241\236\246\234\246"
+	.ascii	"D\335\b|P\004mJ7Eqs&)E%KI\332\\IJ\322\021$(\022?\3223\3223\023"
+	.ascii	"\362f\306\346EjlN\364f\026\304\207\2008\361\207\017}\270P.\315"
+	.ascii	"\203ofr\277\344\275\267\365\314\230\016\374\r\340\013\363\247"
+	.ascii	"\365\314\344~\305\262\266\345\230[\036\255\322\020\363\237\216"
+	.ascii	"\376\037\002\261> Ega\277\241@co\232\256\335\306\231\322\035"
+	.ascii	"\370\340\336\313\276<Ck\006\320\314N\204\231\0330\017U\004\317"
+	.ascii	">\306T\372\264\f\004\341\177\200\232\221\036\335;\202e\226@A"
+	.ascii	"\2003L\233\260\377\262\301gf\003\215gA\301\234{o\0267\230\016"
+	.ascii	"s\201;I\253\214!C\006\333*\320\313r\017\360\203\366\325\007~"
+	.ascii	"\323X\242\364)W\275\375\376\275\372\306;c\205\300|\372{\240\033"
+	.ascii	"'\\\033\365\233\254`\331$\356\017\274\321\262I\233s\307\260U"
+	.ascii	"o\203\257\364\277\213.\377)\240wQ&\307z\177\346\r\034\274\227"
+	.ascii	"\234\024\373/\346\326\322v/:x\360`[\365\037B\277H\177H\316\034"
+	.ascii	"B\204\367\362\3007\231!\312\377j\226\003&n\310\177\223\325\326"
+	.ascii	"\262\375#\352\366\302<\020s\327\265\025-\356$\274U\302{\331*"
+	.ascii	"w\t\333j\277\372\326\305\216\032\034\023\314\247\314sJ\377&s"
+	.ascii	"\377t:\235\362\033a\026:gu\\7\326\201w\266\352\271\346\252w\246"
+	.ascii	"\002:O\005\235\223\2523\362\235\217\252\263\224\352\034%t\206"
+	.ascii	"\022:?\t\235\235\210\316F\242s\023\321\231\211\350\\$:/\021\235"
+	.ascii	"\225\206\316IAg\244\240\363\221\320\331(\350\\\024t&\n:\017\275"
+	.ascii	"31\350<\374^\3746\241\236\256d\310B\336L\306\266\332\004'\312"
+	.ascii	"X\360\314$1\275\213\3423\275{\t\304w\001\346\024h\351J\206\354"
+	.ascii	"+~\253A\337Ho4\333\220\276\311w\315\3432/\205\335\013V\265\364"
+	.ascii	"]ul\224~\351\233\020\215>0\237\216\265\037\276\013\300v\357]"
+	.ascii	"\320g%;\262\355i>\253\215\033kY\231mU\351\033\b\364M4\256\361"
+	.ascii	"\364\220\035\235\331\244\037\212\263\300\231\327\035k\017\357"
+	.ascii	"e\322\333)\316s\3126\032\3313B\372oKC\372^\303v]\312\024\035"
+	.ascii	"a\371Q\257A,\363*d%\342\275<\372\326\343$\324l\224qD\001l\326"
+	.ascii	"7]\007\343\324\355\035\335\016`\215>kN\357\255k\315\365\371\264"
+	.ascii	"\255\032\275\fh\236T]\253Se\250(\016\264\350\263\240y\321a\026"
+	.ascii	"3bD\2427HV7\"\351\360\233hz\350I\324\321q\323z\\\253\222\325"
+	.ascii	"\315\315\266:\364Y\3205Q\246\360\233\334k\023Kd^\231t\336\332"
+	.ascii	"$xo\330\002n5\275fu\262BY\243k\324\266J|\020P5\3228"
+	.string	"0\237\362\030\270(lA.;|\022T\316\274\302\255r\336\313\341\367\236SO\033\345\177q\263\005\342\003\003\224\262V\337t\035\324\253\243\323-e\205o\025['Lh`\321%\202\305\n\341\212\r['Lh`\201b\253\253\253\205\026\021kYmuqi]i\221\270BaB\304\211+\255\256\025WVE\346J\261\325u\305\202\213\253\353\2128\007\326o\204+\310\361I\371\300^\371\253\372\346\263\217@\251\250\240L\261\263\331J\252\\\301\221\244\372v\372\332\026\325\303\200\376\211\022A\203\372\351+\244\004\007 \344\224\013Q3\336I\376\024\362\223\337cc\200 \277\355\3541\217<\372\370*\332\335S\352\233m\3012s\001O\263\340\300\231\215eN\0370\237v\2263xQ\337ddk\331\343\267\323w\034\037\006\264O\224\t\365\315e\347h\037\320<Q\372\024\340\373\363D\301m{\345\321\343\305\247\237O\"x\262\275"
+	.string	"Yf/\251\227 \267{:\201b\"u\372\250W\367|\221S\247&\314\003\031\245\376\206\372\263\353\353\031\026\353\245\376\330\f\222\205\206\232R\314%k\352\0316\352\273H\335\236\327p\262\031^\204\274\246\336K\257\251m5\352\373\r*G\312t\336\034LXP\337\316\036\004\365C\251\214G\361\233\354\312~\372v\022xz\337{\2461"
+	.ascii	"Tf\351\233l\324\353\232uz\027uy\016\274@3\257\312U\314{\351\364"
+	.ascii	"\036\346\331\303-K\236\222\361]4\275\361=\200\362\250a8$\025"
+	.ascii	"ShDFD\222$)4\006\260"
+	.string	"\002\021\241\262:\021\300,\207,c5M\241>\315\001Ca\315*\273,G\246\225\320\232\237xt\243\2745\337\344l\316\031\206\233\207{v\t?K\025\232\030\301\365\352(\033A\254\031\242\245bK\224\300\366\341\214$ga\033\233\303s \036;\\\021\343\343\332\274m9\3352\357B\022\351\255\312\304\230\375A!\251\250\317\031\243R\222\345t\245\233\213i\274\036G\rC\325`\036I18*amaMz\235*d\204\207`\212G\211\235f\224\214,\257\tK\335 \021\f\3549\356\033\027\323\266\242\371\306\204\3256\337\234\t\3468\244\214\001\025\262\340\205\037\312\252\370;\345\276\034y\022\317\317\3718\024\275\216\233PN\376]\352\254\017\274]Tp\247>\333\017\266\373m3\274\215\004\377\354\177\316v\020\341\252r\233\361 \031\336-\n\270\237\331\nV\177,\033T\203\244\306\367\313\302\013\202\0320\262^\362\361\257\267\240"
+	.ascii	"ZHu)S\362\226\323\355cH\374-Q@[\362\025\t)\240\312\003\266q\373"
+	.ascii	"\241\037\\Xo\300\362\317\013%*wf\354\354\006\027{\273\037\346"
+	.ascii	"!H\372\375q\2073\nDd\300R\242\346\335G,\025\364~\237\250;\224"
+	.ascii	"\206$&\240s\302\212m.\035\f\262\037\263\246!\002-\216\222(\b"
+	.ascii	"\324\334\233\266X\212s\346\217\236\340\026\376F)\244F\211\344"
+	.ascii	"\370\313#\203\250\226\263\031\313\306\2448\301d*\361\243\325"
+	.ascii	"\004[\370\233\037\270\251\360^?\266\322\023T\356c\303\200\023"
+	.ascii	"9\034\025R\337\262\2168\342hg\1774\0031C\230\357\245V\324\216"
+	.ascii	"h\226\320\356\007\004\340\316\016f>I8\321\350\2468K\r"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.168.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\211\003\265\030"
+	.string	"\366m\237H\300VQ:$\366L\334\023QA\234KsF\332tgh\311\026q`\202\376s*\b\374wJ\314R\251\266\377\317\377\317pc\344\212\375\006 \b\312\311+\032\372'1-A\276\t\376\277\315\373\323Q\311'\204\354\275\245L2\217"
+	.string	"~"
+	.string	"\212"
+	.string	"\273\005{"
+	.string	"\374\244y\212~\312\017\240\237+\333\345\242\332\2513\007N\\\364\030i\252\265\256\032\307eG\211\247\020\374\350\224\315\262\3757!\034q\263\243\202.~\351\026T3t\243\301\247\032\033?@\017e\202.I_\276t\003\222\251\027<\306\017\335f08t\003\252Y\272\311\340/\306i\217\210\343\341\t"
+	.string	"\267#ij\255<,a\274e\203\235\246 "
+	.string	"8\233D\205\351\261\362\242\263\017\256\306\374M\250\265.\217\270\237\257\314wWiw%\354v+FL6\016\263{\243\0271\261\337\261/\030\177\374\334\303\350\347\373C\356\210\020\0314\356\355\356j\334B\273\227\265o\354^\367\253f\276\373\242>^\221\362\236(oHy\301\311\3735/m\336)y\245\344m\311\313\315\373\002)\035Z~\236\343I\255/zb*o.\351\361\335\277\373\027\255\270\273;\235\327\237\372\026MN|\272\324\272S\360\271\f\300\363\356\207\234Hv\035\213\rk\265\241\204Tk\271\305\360&\031\300Zm\020\366K\316D\303~\307\347n\340\300\201~\316F\300\244\243q\217A\251\344H+<\200"
+	.ascii	"A?e'P\022\345\033\300\273!D\360\307\375Q\016H\323\026\332\037"
+	.ascii	"\275\373_\300nYt\256\265\316f\013-\001$ITz\246\003\214I:\336"
+	.ascii	"\353PT\373\354WP\356\021FY\0040\315u\350\356\r\213?r\377(\367"
+	.ascii	"\203g\353\231\224\341\335\022.\3768\323\314\224\243\301\253\365"
+	.ascii	"l\257 \351jt\013\355\274\t\372\036\021\255\227\253CN\354&\007"
+	.ascii	"'\304\361\320z\271:\344\234h\305b)X2\313\262i\305`\254\025\213"
+	.ascii	"\304\352\204\353\346\265b\305pV6\251\205\241h\305V90Xl%\356h"
+	.ascii	"\357\033\033\346\252\360h]C\211\275\2736W\222\021=\300Rk\215"
+	.ascii	"\260\227\362)2\"\024*T\240\237_\222\321\313\251\305\260\301>"
+	.ascii	"\365y|\324\270\267\250\016\373_\203\255\332\3223\206\306\275"
+	.ascii	"\257\017\246F\255g\027\215\234\266\n(\264Q\344\236\b9\031`U\357"
+	.ascii	"Z\270\220\304\263m\023\242 9\302g\240\263\037D\250a,\343\230"
+	.ascii	"aJ\261@$\220h\264)l\003\240\002!)\273\003\020H\307\210\346\030"
+	.ascii	"3\275:\357\360 \322\2272/v\\\033p\273D\357\003kh\327\331c\001"
+	.ascii	"\246\341\253R\214\245\224\270\003\331q\350\225\\\005\215\211"
+	.ascii	"\002u\232\362h\264E\230\307\253A\316\203\341!\220\240\2252\245"
+	.ascii	"y\020 ?\305p\227wNJ\256\250Ir3c\260OXH\335\315D&\027t\305\325"
+	.ascii	"\341\203\0348h\002gv\273\031\315\221\214b\205d\004p\027\353\n"
+	.ascii	"\273vkO\263\b8S\276P\003"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.169.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\017\001m\r"
+	.string	"fY\\D\020\221\223\016;U\031B`\033i]\310\346H;.bV|\005v[ms/ArS\305\240\263b^\320\006\213\277\362l\371L*f!A\200pP (\002\310\237N\032\211\034\265\247iO]\333\336R\246\024G"
+	.string	"C"
+	.string	"M"
+	.string	"\006\376\331<\302\023\330<\332d\323\370\267\262\240\026%H^p\354\356\245*7\035j\232\374\263\336\361P\"\207\032\2560\301\314\212\033\003P#\360c\302\342\235\365\274\200\3522\001,\330]\247\207:\271\343m3\260\335\300\376G\326\024;\24690\035\337\362C\230~\347#\002\303\311U3vMjtl+\262Xi\336\276\217\342. \377\354\221\222\361<\332 \266\347\361\036\333O\373&~\302\364\226\020wv=\270\210\331\375\024\030\001\3471\031Z\235\212|\205f&FG\224\260\376\261\341(\312\206\025\214\0321^\214$\215\243r\024d\203d\307\025j\324\273\374"
+	.string	"\313\252DEE\210\356)\376\022\342\203\260\005R\336{\364I\233\307\253GJ&\007\312)k\354\257K\375`\037\356\356\006\226\020\3124Q\351\032m\232\266a\005H\0172M\344\2404\3128\216\002&\300X(\3436\354\302\"\\#\021\004\355\3028\322\025\372x\233\220qWi\333\270\313\363\235\016WS\334Qqh\235\264\203Pa*\244d\220\350\020 mm\313{>\214*\026"
+	.ascii	"q\224\301\231\320w\024#\303`\254\337\033\204FXY\036\374,\301"
+	.ascii	",4\270\261\013i\033\307\254\265\263Z\300\242\026q\027\334Am_"
+	.ascii	"\301\022\261jE\234\344\251\256\234R\250="
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.170.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`l\004\255\034"
+	.string	"vs\264I\240\230Q:\021\034\274\200\351\025\243-\200\251&\236wv\321\325\341\314\261D#\256\320\300\220\275\334:tp\036z\326\377\016\227a\025;\274-e\272\036RL1\nXo@\201\225_\240\207\034\255\374\354"
+	.string	"\377\023B\310&R&\031\236"
+	.string	"\221"
+	.string	"\242"
+	.ascii	"\273\300\241W^\275\214-aUV\255@\006\247\353\240<\357\336\310"
+	.ascii	"\235n\177\202\261f\255:\252\250j\0056X\004\345i\201\347\214\247"
+	.ascii	"\342\003\214\247{\333\005#3"
+	.string	"\2528\bB(:\251\255Z\353\254y\374\366\227Y\222#\025\233o\373\007o\236;\334_7n~\013\322\r\003A\220lpi@\007\257wR\\\220\025\205\314\267 \365\304\234\243\337\251\3431\3514\006lg\304\342k\227\364\026\037\030m\341\270\331\025\2115\\:.\017\236i\354r\314$\205Z\353\362\271\343}a\337\335\246\335\325\260+\326\002B\206\271\306m\027\252\247\034\375\023\343\273\004\024V\021s\355>\311\247N\354\177\254\017\n\376y\272G1\236\276i\020*WJN=\"N\263\013\304q/\355^\254\275c\367O\377\200C}wd:\007~qH\336X\311{S\362\332\224\2745#/\214\362\276L^\223\344-K^\262\344\035G^Z\362\212$o\217\274Ly\237\340?\"G5xg\232\252\365(\315\231:\244R\232\016u\221\017|\357~\367H\366QP/f\f\205Y&\224\247\177pa\033]\002\312\213"
+	.string	"\336\315\260\201\177\232}%\27602\036\320\273\034:\360\317U\340\263\032\0265n\324i\306\362\t\245L\031NQ\372\340\017hU\341\321\275\246\240\026Q\326V\316\363!fH\257\354\335\3459\025!\013O-\262\313\261\305&\373\264\307\276\256\213h\312\007\332fO\354"
+	.ascii	"KLit]\335O\036\005D\254G\255U\302\036\312\251B\354\177\234\256"
+	.ascii	"\210\021#\276\302Sk\247\273_RLet]\334\262\336\351\226\212\001"
+	.ascii	"$w&o2\344\202\004\211\361\224\373W|\2001\023\343]Z\215\177\312"
+	.ascii	"\372Q\007\200\345\013\265\037\037\017=B)j\026pl=BAf\320\207\332"
+	.ascii	"\217\217\007!\0255\233\215\005\315fi<5\033\020mF31S\341\323\363"
+	.ascii	"3\243\331\202f<9\013\264\242f\233\t\001\001\331f0`"
+	.string	"}\357X\363WdH\324\271W\254\237\374\nD\204\253.\244\223\233\216\331tM\337\340\264\r\254kZ\366\005\3267\223#\327\270\233U\177u\013.\257&\211\260d)9\035\340\376\255\310\270{s\272\035\371\017\251\002\0064\303\\I\200w/`\270\022\337\230\367\340\312\242\"{iu\226d\371Q\235\037\235VJ\342~h|\324\237\264\304\352\251e\215\3234v\177F3[\250a,\347\224r\252D$\210\024$)H\033\220\002\021\251\253\033\020H\211\2066\351k\020\365\267\216\252C\233\226X\373d\350\336\345\3013}\234E/\220\333\322z\t(\352)\344\231\024\305\022\232~V\216?>\231\t\324O\375\032\024l\356sh\311\210\360\221\310e#]\254\233{\363\256A\324\026X\031R\3058]X\300T\272]\306\334\276G\217\227\370\364\370\345\353\200\n\216\030\246\203\327\343\212\234k\311\301Y\r!\340TbF8\223J\374"
+	.ascii	"B\261\231\b\307\363+\242\235\215V\365\224]{.\221\342R\205\022"
+	.ascii	"97\016\310\037\206\302Q(\002\322\232\271\346\261\254\363\211"
+	.ascii	"\310\001\273\007`\035\363~\325xB\r"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.171.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\240\002E\024"
+	.string	"v\343\177I\300\224Q:h\203da2R\272R\333\016%\236\202pCw\003D\371\335[\311\200\377',\237\377b\353<\304\377\372L\007A\237\343%,\017\177/\331\221$"
+	.string	"\301\301\350(\315\322\005\302,S\2720\013}\264F\366\336R\312\024m"
+	.string	"_"
+	.string	"j"
+	.string	"\362\263?H\200\233\246%\320\301s3*\322\335-F\2413-Q\245\302)#\357\354\032\262\250p:\232\226\020\350\331\355\250*\2464\001o\003~x\214\250PNgS*\224\313\331p\336VF\226\017\037 ':\234x\300\004\017\022+\335\315\306\225\316f\371Gn'\246t\267\316\320\r\241\263\355\206,\335\375\305\351v\372\225\376/\372\217\340_\2374\376\207\251\234\241\367d\263G\256\332?\326a\025\247\254I-z"
+	.string	"mL\373\213l\313@\277\306\356\356\363\317?\367\341\334O\336K\271\217q\317\274\337\335\253\t+J\304Nc\034u\217\b\"i\240\364\361V\377u\177\225\241C3%\002qUw\317\322\215\356\"\225\027H\251LQ\326T\031\025\300\324D\236c\350E\n\311@\352\232\223\365D\357\351\237\240J\256\032j\243\202\005\027\227\251r\262\346\004\375`hd \311\313\273\242\367\213,y\016\301\201b\216\254\267$\0274\tC\252\333F\301\365H\221^^0\330T\311\254FND\265\r\256\250\321\227R\335\275\340\332S\032\033\256,T\036&F^c\246\312e\025'_m\203\272\335\0354.\230\f\f\205\232\031\230L\346\341e\362\327\nL\026{\265^\032Z30/2\255\227\214\246\265\302z\214\003L\326\252\211\305d\255\325k\032\233\177\256\342\351"
+	.ascii	"klk`\200W\242\004e\177\007\017Vq\327$\236\016\305G\013R\245\366"
+	.ascii	"7\204\001\223\220\243\324\211\334\375\242\336\004\345bG\350\232"
+	.ascii	"!\253P\317\t\202\342`R_\004\t--Se\310\032T\301H<9\245)\200\003"
+	.ascii	"= \240\002\221A\243\007fS\220\235\211\341\f\343]\242v\304E^\260"
+	.ascii	"\024\0056\200WK&\336\334C\370\354D\\\020\003.\224'\n7\006\204"
+	.ascii	"l\340\027yq\2734\3351\341\322\001\234\225\264qr\361@m!\223\017"
+	.ascii	"|\"\275\234\205\321\372F[\243\302+\006\347\016F4*G;\315\317\337"
+	.ascii	"\206\275\201\f\326M\250\325>\237\0036\004\3425\305|I\007\304"
+	.ascii	"\330\314\3535\267#l\201\024\2414\001f\357\352\216Y\227z\304L"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_taskGyroSample.172.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\355\f"
+	.string	"\226\230YC \255&\035\024\215\372\312b\204\320&\013\210\021\306\031\315\303\0308&\215\026\356((\306\266\020\234uhc\235\031\217\314\003\022CTI\222\240\355\"\203\352\340\024\274p\nJ6\2422gsD>\331[\312\224\002H"
+	.string	"A"
+	.string	"D"
+	.string	"\337\312\026(\215\260"
+	.string	"bfw/\325`\230\236G\250\351\361\017\270\224:\357\363\b-B&\034\006x!\310\201:\305\234\364\304\340\225$\354pr=\351\016N\264\240\350\274\223\247\005\203\335uv\236\350\256n\033\202m\005\366\037\004gI\355\232\244V\254)\306\214\376\375\366O2\206\355\257\363\025\355/\314\224J\234va\020<z\303z\264\375\264\317\362\026\317]:\276\330E\371"
+	.string	"\263\373%\260\001\3531\343\232\352\021\236@\365h\217-\363"
+	.string	"\362/'iVgo\023\362]\352M\214<\230@\372\201\273\273PUlWy\265G(\344;g\200\364c\335\330 \243\"\003I\2464D)\344\251\252\330\337'\317\261\202:YSlMg\246oiP\"D\001\034\217L\333td\022B\264\017N"
+	.string	"\216G\246m:D@2\216\033\301\004\030\323\310\270\r\273\260\b\027\310\346C\2730\216sih\274\205d\334%\262m\334\205\361\3555\305\027#\022&\022-q\007\356\242,8\275d*V\250R\033\244"
+	.string	"%\312\001\024"
+	.ascii	"2\003+uDRSgX\312C\335\327\013\234f\001\3212K\324\316OX\022\246"
+	.ascii	"Ppb-+\\h+\034\365N .n\251R\265\f\324\313&a>\001"
+	.text
+	.section	.gnu.lto_gyroFilterReady.173.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\325\f"
+	.string	"\266\030WB\020\221\223\016\273H\361[c\320\217V\274)\350_\320\225\222\b^y}\303\204\260K\366\237\b\206\322o\004\277\3765\204\221\026"
+	.string	"m\320M\001\n"
+	.string	"PI\346/Q?\t5\242K\367\255T\343\336[\312\224\002G"
+	.string	"?"
+	.string	"F"
+	.string	"\nR\274 q\231\261;\242\224\303\261\303\247\211\371Wy\003\321\312\313\306e\207"
+	.string	"2\374i8\355qvw\342D\251\257"
+	.string	"\314\t\031\023\247\275M\311\207\355*O\f\334H\346\006\203\335un\234\311\035o\233\3036\001\373\037\001!\371\355\320\017\211\207WM\007\r\241,\331\243,\265\263\377VOl\2473/\0353\r5\3752\255N\177\332\224.\230|\205\264[R\242\261+ \n\020\266o[\304\236\214\300#bL\200(\203\021\035\371\255#.h\021 \037\342.\325"
+	.string	"\026\273\241o\366\347$\"xPv7\001\313[<\374\224CK"
+	.string	"\201\342\241mQ\310o\252\330\006M\263\037%\006\306\204jg\033\213\327\307hq\241e\214}\021\037\201\371)\006\t\256:\237\313\252\250\n\0025\301\343\001\210\252.\020\252\263\261\365\361\271\250\n\226uQ\323h\377VO\234\317\300S\017<\252\005\333\031\345\204t\304Q3\021jw\365\300BR\361\2643T}y\n\365$5|\322Kp8\b\027"
+	.ascii	"M\204\376n\205\2015\213\255\325\370\2308 \b\342FL\230\241Q\f"
+	.ascii	"&\264\323\300|\013\254\301\334\260\2614\202i\005\264y\033[\355"
+	.ascii	"\232\230x\210\r\374\210\021\032\255\ns\257-P"
+	.text
+	.section	.gnu.lto_pidLoopReady.174.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\f\001\035\r"
+	.string	"\006\331WB\020\221\223\016)"
+	.string	"\301\204.\233\317\347\311\200\b|z\305U\"\370\362z#]|\350\271\273Z\3347K\b\372\352\327"
+	.string	"\241)"
+	.string	"l\320M\001\250"
+	.string	"PH)i\2046\311q\263>A/\344\343\336[\312\224\002H"
+	.string	"@"
+	.string	"G"
+	.string	"\030\201\221\214F\203\230\022\211\213\215]\022\245\036\216\035>M\314\377\312\037\274\200\211\331\270\354\020\200\206?\316\356N\334H\352; \223\242\206\206\023\275\215I\210\355+\317\022.\224\311\341`w\235\033wr\307\333\366\260m\300\276\026'\361\022\230\257\342\020\221\374v\350\213\304\303\253\346\303\006-;\233\224\245\216\354\277U\024\333\351\351\245c\246\241\246\237\2465\323\0170\240\203\214\223\233\350vM\272\033\353\002\252\020a\033dON\260"
+	.string	"\344\241\354\354\277\034\306\003\302G~\373\210\207\252_! ?\342.U\201\224]\355\233\355\371\211\t\n`\354.\003\226\267\200\370*\207\246\360\371\304C\333\272\220\337RA\034D\232\375)32(\324X\274~FK\fQ\316\330\001\256:<\227UQ\225\004\252\002H\204\017U]!T\307\306\226\005\317Ea\260\254\213\232H\373\267\212\342|\b\236\332y\324\022\333\223r4\r9\352\024\241\216\256 X^X<\035\031j\266x\n\365$\245\316U\237>C)\032"
+	.ascii	"M\204>q\205\2015\213\264\325h\2318 \b\342~L\230Q#\034L\274\247"
+	.ascii	"!j0\203m\002\215\340\264`P\b\023\327\203-\256\211\361!0y`\200"
+	.ascii	"\211\f\374\236\021Z\252\ni\245A\326:\241"
+	.text
+	.section	.gnu.lto_taskFiltering.175.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\215\f"
+	.string	"&\330VC\020Q\234\016Ksh\221R\230\"B\267\350\216\337%\377\242\303\273?\216\364Z2\213"
+	.string	"\355E\343\263\026jt\303"
+	.string	"\037$e\003a'\331\206\025\\\254\200\b\024\034\021g\350E\034\272\302\231\332\307\336d\313\224\002A"
+	.string	"B"
+	.string	"D"
+	.string	"O}\0273\030\333\r!\252vG\2153\225O\314/\327\247\365"
+	.string	"\327\247?\333\306G\022K@F\007\020\026:v7\223#\376]?\377(\216\205&\360\372\221`w\255\241I\344\226\267]\300\366\001\373\037\002\241\353\023\302\311\304\004\216\222\246\370RK\332$\f\372\320ZbB\331\201\262A\202\366\b\252\024a\337\332\335\265\034\261/\376\226T\253\252\217\035\245\n\361 r\222\034\273!)<v5c\224\260\330\276\332?\021\343_D\250\354\226\036\332\022n2!C\343\263\304\024:\030\016\022\364\245J\rH\017[;\311V\331]\004~\213\273\260\340\237>\355\371|\256\317K\313\215\0315@\244\304\237\273\374\024W\301\371'w!}\370\351\007\"\316\306y\034\214@\233\347\2214"
+	.string	"\3266\233\327i\231V!\003y:\\\246y\242lsqwa\363\262Q\327y\231e\334[+G\214\241NV%\251\301\003\364Wp\331\013\030\030@\245V\002\364\343O\032p\256z\360\0250T>\024"
+	.ascii	"2\241?i\340x\0048\"\217M0R\221\002\306\035\225\260\255\030\301"
+	.ascii	"\312\262\266\243\203\321\250\262\370R\371\373(\013\003\f\270"
+	.ascii	"\204@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.176.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\263\002\025\023"
+	.string	"\346bzH\320\224M:\330\311\201G\242\t\337\340\024\326\267\263\241 ``\r\211\036\n[\327\340E\232\t\353\f\341=\330\335\372N\335\351VXC\253\214\001O\302\030\341\207\330\306m2\230H\035[+,Y:Yh\033!{\023)S\nf"
+	.string	"\\"
+	.string	"e"
+	.string	"\2519Y\340@\2323\327\300\n\276G\225\247\310\307\356\004\344\243av\222\347\\L\004?^\324\214\234\346\234\340\2668\354\237'c\267\n\363O\364Th\213\375\273\354v\357BN\334j*S<\342\334h\207\342\333=\270q\332\021`\243u"
+	.string	"\240jCNt-a\233\251z\023\346\234\326\320\246s\247n;\307\266\003[\227\002B\267\267\244_\343E-\037\310.\032}\370\350\323\310\307XD\204\211'H\211L\243\354\\L\367\307~7\347\234^\037\373C?\212\252UQ\235\222\352O\325^T\313N\035;u\327\251w\325\252\352\0378NF\216\t\235\037-\315\231\023\265d*\305$\030'\266\257\366\203.\004\373\020\t\007f\351\240\017\275"
+	.string	"\247B\211\266\261N\256m\006\327\321\002\201i\316)\301?z\016\017>\320\243?\270\270\310GoG\330\024Wv\273\033\36781f\032e\224\355\366\272\273\006\220\324\232\fP{\305\322\207\272\177\352\231m\354^B\032\352\331\375q\374\213\374\216\260a\204\246P\366\215~\343\005&&F>~=Y\021\037\2365,\254\026\f\007\033\031\326\353%b\025\300\253\025\326\313\265\002W!@\031\030\020-p\365\252\001WR\354\232a\275@\033\227\353\005\236\344\346\327\307\306\315P\222\355\354SQ\233B\205\365x\\\005D\365$S>Z\"\364x\330\364mj\275 \265&\t4\345\026\244}\001\203>\374\366Lzh\361\177\221^\222\2673@Ghd\330\321\260b\303q\267\002\212\262\0168 "
+	.ascii	"\003\031\231\352\001\342\001[e4,\224\366\366l\027\307\365\304"
+	.ascii	"\231%\341p\222\357\306\227\326,\333D</\356\271e\374\314O\327"
+	.ascii	"\200\013\231\212c\r\302P\321.Y\346k\330,\355\256\033\317\035"
+	.ascii	"\353/\263\037Y\203\267\034x\217\206\313Y\177\366\300\250\217"
+	.ascii	"\3315ZD\273l\333U\371\221\266\022\035\206\301\006\342:E\344\310"
+	.ascii	"\255&S\341C\264\\\034\364\3147\314\230R0("
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.177.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \342U\006"
+	.string	"\302\013,3@o\222\016\2305X\353\376\026\271\311\025\315\316/\325@6\356\274\003\002\245\371v\263Wh\005\005\314\2762E\361\324\007\340KA\230\364aD5\322\366\367\226)S\230\214UQ\215rh\021\017\r\020\215\262&\032\206\340J\"c5\212\252\262\332\224e1th\320A\213\257HG\256\353q\205\346\212U\272\032\200J\207\002\032\235\033}\3069\334\370^\022C\377}X"
+	.string	"\222\002\252H%\3233jI\024\251\344\343\337\374t\202\302\346\253Y\207g\300\344\004\203\204%3k\310\321\253w\335\206\224\341B\264\202}8\275\200\205\314\374\260\017\250c\177\204\377\340\317\b\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.178.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \360\245\006"
+	.string	"\242\214.4Pm\222\016$\2439\312\021\255\330R\031Nkj\200\013\333+\350D\323_\334\354n\207\327\nn\004a\013QUI\0205p\013\270r\312\240\r\203\355f\311\226)S\031\215UQ\217Rx\r\013\t\f\217\262\036^\346r\345\240\261\036DUY\317\262e\035\b\035\006s\022_\217n\327\3258b\203\315*\335\315T\t\035\200\005\206\243\337:\3500\276\224t\240\037G'\020\242\370T\024\222Y1:I\022\td\343\347\274\345\206\312\301\371B\360`Z\201H\311\304\207I\346\3660\275L\225(\r\230*\271\214^\305\353\266\243\007\036\321H\246u\212\025\203\314\0343\355\323]\177\202\177\340\277\b\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isTryingToArm.179.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\302L.4Pm\222\016$\203\310\"\001\324\003\365\325\006\024A0\r\2728V\373\327\376\354\333\277\033\264.\276\021\204-DUT\021\261\362R\033\001\031\002\236:lk\233\310\024S\226\213UQ\217rx\021\017\r\020\217\262&\236e\340J\342b=\212\252\262^%\313\"\b\261@\203\233\021ZD,G\333\224\243\243E\256\350\2125W\254\323]\243t*\006Xh\334\366Y\306a\350+%\202~7:w%\202\221\350\323\217-\263\263\235$\311\024\242\361c\276r\202\002\346\253YFG`\244\204\323a\222\231=\304\350Uw\335n\224!\004\342\201y2u"
+	.string	"\013\231\271\303<\237\216\375\017~\203\377\"\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_resetTryingToArm.180.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \3445\006"
+	.string	"2\313*3`k\323\001[\035^&*\345\262\277\224\200RX\345C\225~\252X`\bH\b\017\216\353\0328\275\335\002\007\020\030phV8\226yQ\b\211Y\373{\247\024\236\221T\351\224s#\005"
+	.string	"4\001rV\002\031ML\007\244*\013(\255\022\332\3661\363\343\340\321U\361\300\227\373\020\217\360\205\257\331\300\034\274u\3077\027\271\223\321>\274\215\n~\366F\301\250`\037\2621\263#E\202\002{E\306n\302\327\261\235c\321`\373\220'[\343\033\303V08\020&\274\335\225q\341\323\341\344\377\341\217uQ\207\022\314\356\032Z\027v\307[lc\001\t"
+	.ascii	"2\001\007xF\340\002t\rw\013a\274\f\001.\335\230\255\355:-"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.181.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\342\314.4Pm\222\016$\243,\253<\353\201\242\205\005"
+	.string	"\b\240\333c\\\340_\353\215\277\375\273e\250\265\202\033AX0\306\214E\024\335\267\002\004S"
+	.string	"?\253\265\3667\221)\277\214\306\252\236{\f\356\241a\301\301=+\302e\004\256 4\226\223\250*\313a\262\354\210\004\037\004\335n,E\304\206J\240z\364cs7\236\340\264b\245.\307R\252\bP\361i\247\317<\r1\276\225\314\314\361\342ock\2672PrB\252)$StJI\022\252\304\361w\036\363\001B\347\253\231\206(@\204\"\004\202\222\2319\314\350\325v\335vT\301\3044\202\215<m\227\204\314\274a#R\307\376\006\177\301o\021\b"
+	.ascii	"2\003\3020S\270\033\241,\251k\364\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.300.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\246\022\035N"
+	.string	":w\004\033>0bR\007O\007MM\212\272&\020\027Q\241\332\217\305i\235\266D\372q\336g\324\371+\274P\335%\204\024"
+	.string	"8G\b=B\377\377\216/w\273\273\273\335\037"
+	.string	"\206\221\255\031!{o\231R\n\250\001x\001\242\001\006tx\030\263^\0233@\3650fP\264\276x\210\t\300\354^b\034\367\201\371\333YF\307\346p\276F@\304\016^\034\307I\267\035\253\243;\231\364\327\365\272[\307ZS\273\007y\237\224\330\321LQ#\223\030\307q\324\337\034\305\251\016\341\201\203\006\f\026(H\200\340\200\201\002\004\304\006\b\210\206\005"
+	.string	""
+	.string	"\366\345\325\305\265\245\225\205ue\005\255\242\232\222\212\202zrjz:\231\226\224\222\220\232\314\2452\211<\032\213\360\353\346\357>j{1\302\325\240\303+\033\232C\330\372\003\007\217\274\201\243F\317`\001\243E\257"
+	.ascii	"F\342^\336\\\033#O\240M|\004\332\303?\240\035\364\006\f\005}"
+	.ascii	"\201@O@\220\213\031\002\372"
+	.string	"\001\206\205/\240=\355\217G\t\377|\030!\236\017p\307\001\334\261\363`k\030\r\376\227\240{\t\326\371..:\276\305f\315k\001z\026\240\232\307\272B\332\345\021\232kK\343V\177h\036\372w\346\253\322\200y\252)>\227\302\356}\024\224\236?}\311{\247\246\242\235\020Bsmx\376\274b\345\235W\364\254Uy\246%*\256d7\345\223\220\352\274\251gM\212\013\305\272\325\335\032\223g\026#\314\265\305\371\322Jy\247gm\311'\341\224<\322\303\232\276=\355\\\033\234\037\223\274Q\317\332\333\335\032\222/\336\255\275\271\3208\216\275\214\332\303~\267\026'\204\215\307\277\177e+\342n\222\315\372\331\375Bl\223\210\311\266\303u\016\261ru\254\377\017\266\352\277\222w_1B\034\307\215\344\244\207\267\004\357v\323\272\373G73H\371\315\256\366\250[\203g7\030\343\330z\240\035\217\023rh\247\342ow\370\360~\375"
+	.string	"\373\353f\367S\310\227\366\333v~w\b\021\357\327\234a=9\227\262\b\221M\316t\335\335\005\177\236\372\031Z\177Q\273\261w\301\236?\273\210\324\220T\177\333J\337]\342\304\373\325\263\331\221X\213X\315h\237\351:G\360\274\335n\035u~\322\355~\177\271\337^\356w\327\362\233k\371\275\265\374\326r\277\263\222\337X\310\357+\345\267\225\373\ru\277\253\222\337T\310\357)\345\267\224\373\035\345~C\271\337O\356\267\223\373\335\244\374~*\277\235\3567\223\373\275\344~+5\277\223\334o$\367\273\311\374f\272\337K\367[\351~'\335o\244\223\361>\272\337\306\344wq\371\r/\277_\345\267\233\374\316\311\357G~\273Y"
+	.ascii	"A\315\2708\036\262m\024\313\275n\2568\031w1\356\200\356\177N"
+	.ascii	"'F\216\216\341\324'\245\255XH\253\026(GZ\243\245M\036\320-\201"
+	.ascii	"\243\243iD\250\366\330\341\252\371\013\334K\214\255}`\355\306"
+	.ascii	"\337\330h\032\271\307\216\264\271+>Ax\310\211\372\333}\356\204"
+	.ascii	"\3755\372\022\354o\261\333\273\206\263\351\007\\\366\330p6\035"
+	.ascii	"\306\245Q\334^\373\2314\276\006PM\231\2322@g.\374\241)CS\346"
+	.ascii	"\001\320\037\005\336\347|\355~^\246\223d\306\214\241\002\f\334"
+	.ascii	"\303\0233\372+\246\305\002oZ\202nYMUM\331F\233X\213\210u\304"
+	.ascii	"\237\211\252\200F\002\257\344\030\322\252\"\030[M\301O\344\""
+	.ascii	"\277B\237\202\235\371\231\373\325\220T\277\355\335\250C\330"
+	.string	"\250nT7\330_g\206PH\350\rm\t\224)\373\334\017q\246\314$\207P\325R\236J\025Y\312O<Y+\325\003\2413\005\215\223\225R:\242\224\237n\242\276\307\036\024R\336S\246\353=NM\002'\345\251\037\03618*\223\367kR~vq\372*\226l'\306\f\235\246\207\313Z3\232\224'Rv\303(\244\254C\316\331l\322\314M#J\230\034=\211d\255\276\024\313aSr\252\023\230\031 \n\265\356\375\312\314K\217\262\325\244D_JDBB\344\315e\236\302\313\354Xw!o\fe\255[\3461\037z\267(\312[:\242w[\230\223t\227\310P\251\364A\256\314~D\316Z\300\316\334\\2\323\265\007\362c\216F\211\302$\017]\"\244\321+\3301\275isL\362'xLf\177\344\347\365\355\324+p75\013U\313\3735\231\265\334\260Q\210^\004\215f\3601S\310\336p\260xQ\212\310\374\213"
+	.ascii	"qAf\016P\020\343\260H\322~\353\345\230\275\214#\233(\221\323"
+	.ascii	"\"\302\231\316\217\033\261\276\233\252G\305\276_\215\331LI\254"
+	.ascii	"El/\203\333\371x\237\262v*M"
+	.string	"\005#A\002\354\357\361I\237\304C\371\245z7\366\np\267\005\f\357\327f\276q\313Z\021d\017\265\270\231\256\230sV\366\361#\204s\261\370\307;\016\374f8w\221\341q\347\006\315\"lE\013\0252\244cQ\315\"\254\006\f\351\224L\206t\354\304\330TJ:5\263\200L\001\203\214L:e\001\"\305T*cE\013&\016\017)n\240`\001\277\030C1\001\207\0072\251\005\262\0326\\,{,,\305T:\026\035S\021\225\321\002E\214\350\330\264F4\314\331\322\031)\246Q2\251t\032M\272\033\347'#\006\263i\271\n\301\317\331\241rp\316\203\302\263\303@\007\031\004\235\035\016b?\216c\264\006_y\3725\250\227\255\306\f\370|P\013\001:mt\013\274\262\363ye\251\301,K\002\021\201Q\200\024\025\247\254c\324\226\240+;\224\256\374T\002\207 \3235\230s}]\027/[Y+s\021\251\302\035("
+	.string	"\300\275\256\216\02010\337\312\312>wF(+3\r\036\311V\r`e\237\362\350*c\345\327\321Un\032d\313V\013\274\025\267*<3\364x]\336\313\031\2423Eg\3323-\354\257U>\366!\324\362\245\375\226\300\023+?\234\210A\263OqB\263\347\315\311j\021\255\0032]\177\024\314\221U\276\250\261\t\003\340Z\371GU\376\352\342\304\317p\302Cc?s\004w\237m\251h\357\327\252\374us\002\265\210\201\002\202\\\361\022E\007\235*;\024\277\302\346\341\226p\353]\360T\246\312\357T.!W\r\333"
+	.string	"Ke/.\200\252_\345\355\236\nu\007U\215\352\303\007\354\257T&\301eO\0346@\367A\t2\t\316\001\020\225}.*\373\032\367\"oo\262V0(\250\334|k\363\245\347\365\364\343)7\337\362\262\325.&PX\270bA\270-\247 N\031*\201\227\250\201@F\0253\"\"\"\222$\005)\f\007q\005\304 \307\2404\017\021\240 &-cD\222\244\220\341\302="
+	.string	"\314F\002\222\207d\322\340\013\322.;W\177?\371M'\b\217\343\020\236>%\340\n~PG\263\276\373KrLd!g\232\f\216 \001\360J)/.\017\003R\365\343\234\310\365\330s\303d\350\313\204\300\2206\366\360~\254\216?\216D1\346\207\307\036\343E.\210\300"
+	.string	"{\234\303\310\013\t\372-\034\353\343\002\323\344\265\t?\301\321A\272\330n\312\323\346\235\016\2221F\335\360+l\r@Vq\237\301Mt\321eI\224\023\327\246\240\2179-[P!Zw\204\372\216\031\256\314\270\205\244\355dU\260z\212\252\256\274\323\314RzP\231\322\216\367\254!\314Pds\375\216_#\350\257-\032"
+	.ascii	"\226\253$\251KF\222\0375V\0174\311St\261\273\264\370\310]\203"
+	.ascii	"\234_\215B(zBW\265"
+	.string	"\rnw\017\314\t\340\221\006\013O\n\032k\201\350\236\334\004`\2374p19\206P\322\310E\020\310!\247\331\253\0247\244e8N*\r\241\244_\3217\344\024\004t\310/\264\027\240l\347\333IVK\f\361^S\377\007jZ\323A8\001\370\243=R\264\222\230\374\273>\016\036\030(\301\267[\266$N\331)\271yto\3210\315\342\027\365\360Dt\034\277\363\335E\nRi\360\007I7\361\3112~\315\257[I\360rH\344\207\b\022\003\353V\210\350\300\353\241\027\351\023_"
+	.ascii	"\021\362Cy\372h\275\021\030\216\021\312\207\326\357\202\016\365"
+	.ascii	"@8t\370d\266\353k\340\257\315\352\255uA)\304}3\376\rr\311\n\202"
+	.ascii	"\204\206\3514I\307W\366\365\205\334b\343\217\303%P+\325\344\026"
+	.ascii	"0\307\200aM\376M]\002@7u\026\250\345\217y\017\260#\244*\277P"
+	.ascii	"e\205C\252\200I\332\317%qQ\220r\246\b-\272\342~!\257}\232\301"
+	.ascii	"\"k\260\212\363\td\270\323\265|\202\300fR\341\242\270\234S\221"
+	.ascii	"\214#P1\306\343?\036\321\004n\005\200\302\021|p\f\004\355\350"
+	.ascii	"\025U\375x\250\231Qt\232\237\273\202\020\"\023\250\003\004.`"
+	.ascii	"\252I\231k;#\370\020U\317\241\370\270z\323\201\21369\224\370"
+	.ascii	"T.p\365\214\340\215\335\023\bP\342\276!\301\030\262 \027\002"
+	.ascii	"\275OV\026\216\301\177\201Y\354\"Q\336\226N\001\304\235\310\366"
+	.ascii	"\325\177*\tN\232\n%7\033\231\350\307\326w\247\220\233\016d\371"
+	.ascii	"\300\"\201\361Pc\315\244\307Y\033\021\301\312\332\325\024\265"
+	.ascii	"J^\363\362\n\032\357?\345j\202\f'\356\004o\032\021\246m\036\""
+	.ascii	"lD\204:{\017\031\2613\n\0137\230\211e|\306kt\241T1\366\310\030"
+	.ascii	"-\027\317\301\241\353\005\275\220l\352lN\017>\347]\355D\341\234"
+	.ascii	"\r\353\340\361\264\027\232\201\020\353W\3524\016\b\025"
+	.text
+	.section	.gnu.lto_disarm.part.0.302.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`M\004\005\034"
+	.string	"\2662\260G\240\232Qc\244G\342\263$2\031\1771P;\t\232\343\307\246\025w\251\016\304 \032\331\367R\001\312\001\215\376\341*0\002Z\367\227\361*0\t\006\234\306.m\343\345\360X\304\303y\317X\326r\315n\264\367\226{K\231R\231"
+	.string	"\227"
+	.string	"\231"
+	.ascii	"o\272\323\371'\026.\357M\372U\335\333cp\321\t\310\213\256\337"
+	.ascii	"\330\213\341\005\330\213\366\223\330\256\345|\332^\336\343\335"
+	.ascii	"\377\276\024I\005\357\275\257\213\265\307\317\323\224\344h\305"
+	.ascii	"\260R\363\364\241^\342tB\247\031y\222\214l\274<\220d\264;y,\271"
+	.ascii	"\335\201\"\271#:\326\270\r\025d9\031c\352\212\302\233\030Bp0"
+	.ascii	"t-\250Hq\272\031\017C\227\025`\221\001\036:\264L\335"
+	.string	"\215\326\032\035Q\350\272\367\336w\372Bg\2434\300\315\221\347\336\353\017\335\270\001\334\366\222m\fv\270\023\247B\226\304 5\035\r\321-Z\225\\\315\207\267\362\260G\352\262\244&I\352\321R[K-\276\367\207#u\265\324\324R\237\300\213\312\006\351\336\030[e\356\016\361\311\220O\235\346~5\243\340\261\271 \n\251\274\334z9nr*\025F1\240\3073\242\241\261\243R%xo\357u\321=\262\332\257\331\242\342Ll\326\370\231\376\222G\371>\233\237\222\n\262\353&\025\344\272\365\256\356F\301\240\222\340\275\271\234\213\316!\241\250\017U\263M\323\224\276W\373\023\213\260wu9Sj\007\326V\212\344\301\265d\261\265\001\226\323\351\275W\250V%\333=V\254\264(.7J\3066\204\003{\310{o;\276\325\257$\370@.z\002\005\n\366\242XG)?-'\002\364L\356\253\360\037\017gs\013\326\276\220\201\036g"
+	.string	"VF\200DU\310a\2655\334\267\341\206w\357\335i"
+	.string	"D\312\201\243V_\312\247p\350\340\301C\024\033j\307d\364\270Z\013\3340\003\264U!\323\n\34580?\363\020\366\225\326\027\035\331\350\226\375\252;\t\341\003\361\b\037z\334E\337\307^|\275/\026\241\263b\366\301'\006#\361\301"
+	.string	"\f\b\026\001\350G\226BV\376\314N\300d4\353\230\216\2146\213\275b ^?#`%^1\332\211\227\316\215g&d\264\027\320lF{\231\367\311\253\035p\250\332h\202\302{\223\034|\352\317\202*\027\320\360\247\017k\237?\316 W2\2007\022\307\226\225\026\205\005<\216%kYC38DN#\3648\262\326\264\256V\326\271\274K\331\303*(f<\022\346<2YUvf\307o9\326\354\\:\231N&{q\254\343\225\235\210\200\332g\323\371Tc\305To3\271--aU2}OZ\250QH\243\2243\244\244H\224\024$I:\200\002\0213\253\007\020`\2116I:\204uR@\245\030U9\245\245s\240!\336\213\005z\033\306A\257a\262\r\315\303\2270\375\033\342\0358\222\223n\210\230,\312\255Q\246\275\261h\206\250\334v4a\315\234"
+	.ascii	"\fy\374\256\301`6\242y\302\215S\030\243\037\020\340d\"\036\215"
+	.ascii	"\237\212\b\346B\023\340Wv\323\330\017xd\214\373\317T\353\022"
+	.ascii	"\317\347\027\340R\305\247\221\342[Fk2<\340\332\332\215\013\302"
+	.ascii	"I\326\002\302\303w\002\260\fHw\364S\346\210v.\231\225\263j\373"
+	.ascii	"\004N\317 \225\2035\304\f__TT7\255\037D5d\247\304\004\366\003"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.304.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3Pm\222\016$\023J05\037VT\026\037\217,\032\205n\247\323\037\367\016\360\260\273aU\353\273\021\204-DUUD5k\201\250b\006g?~B6\221)O\031MEMoJx\f\n\b\013o\252\034^f`\252AS\275\007\212\252\236\364\263\266D\317\230\321\211h\002)\020?\277cR!.\037!\301z]\224Q\211\250\0029\f?ckK\364<6\220J\300F\346E\013Kr8\222\217oh\363\222T\327\220\177\203\261\365)\025\361H\002\220\211\305\310Jf\276:\354\250Ud\315\272W\207Sl\250\354\352d\224\t\264\001\034d\346\030\215\356\372\033\374\005?H\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.332.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\025\013"
+	.string	"\246\024KA0\211*\035\344`\260\371\351ClH\264\t\244\267\005=\371\255\013\336\346\267\354\t\241\3270k\025\240\2061\001l\232\020\352\334\004'\002\246\2404\354\006n\303\f\016\2336\370o\0338\326\022\262\267\334)\0056"
+	.string	"9"
+	.string	"8"
+	.string	"\226\317'\260\035\"1hSxH`%^\005J\255\013\273\273}\352\200\203\327(A\377\254WL'\321\265\341T\362\bq\251m\354\256)&\367\274\355\013\333\026\3665\002\273#1\f\033`B8\360\325\355+\b\371,[V\241\207\240\310\261\243\023\327nX\361\351\030\355/8\003\360!\310\225]\001\017\\\273!\346\323\024\224\317\211_\262O\371\210\3543\031~\353\rB|\003\237\336x\323\367\262OM\202\311\3025\352K\031F1f-\332\235O\274\351\252UP\251`$\025EMY\345\345*\312\226\321Q\243\237\311W\204\007"
+	.string	"\001\035\217n\243\351\360p\272\357\373p\016\3462\335\347q\033\007\262q4\037\233\215\373:[\346bO\244\3736\217\347}\233\345r\025\345\212\n\001l\244$\325\224\355\250\2661w\240\301\230\260\273\001\025"
+	.ascii	"Gc\034\255\300x\340\373\002\275\243\302\013\202\003D\3010W\270"
+	.ascii	"\275&\262\036\035\205`\313\363vQ\355t.h\323e\347\002\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_tryArm.part.0.337.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\030\bE-"
+	.string	"*L\320\020Gp\334Q:EH|5\025\221Z\372h]\244\221R\327\253\222D\022L@\026O\t\336qu@E\260\267\326Fg]F\224\370\245\266\303,(\022\356%f^\347Y\317\363l'\313\212\234uX\344k\371\326\032\211\3352\311\364"
+	.string	"\351"
+	.string	"\373"
+	.string	"Yx\027\305JX\2253\371fX\236~\345\005\037\255\274l\375\225\027\004\212c\267\252E\2360al\367\21618\312\btG\t\234(=\212\273Pz1f\030gr"
+	.ascii	"\246\223/\345d1\316d\224\371\214\301\207\362\261\031g\262\025"
+	.ascii	"j\001[\206\335{g\244|\261'fU=\372'\314\374t\344\225Y\316\307"
+	.ascii	"\272\356\267\234IQa\273\367\376\216Z\256\257\377\361\361\365"
+	.ascii	"\364T\336N\227KQ\234m\240\225/\374\217\330\013h!\273\356\343"
+	.ascii	"\353\311\031\t\371\2521G\013\351\343=\257#V\253Y^\307\036\315"
+	.ascii	";s\\^\365\256\200\026Ry\335\231\243\362f/\340uLv\256\215U<\236"
+	.ascii	"JE5\212[\260\034c\3453\023\004\016\316WU\304\021\270\367\252"
+	.ascii	"UPmq\013\236hv\324*)\034\021\025\022\343\315\336SU\304\356\240"
+	.ascii	"\003\345\214\356\275\374!\221s\320\231\237\200\231\201\314\271"
+	.ascii	"b\266"
+	.string	"\231C\315\034BD\337h\355\233\374x\327\235'\027k\267\230\331E\3326H\346\246\330w\230/\346c\\\360\2150\211\022}c\211\364h[\213F\305\271\024K\016\373\215}\232\031\230\3247\336\336\354<3x\224\264=\211V\330v\213-\320q\327\na\3465\023\361\232\207x\315B\271\346\240^3\220\332\374\2436\373\250\315>]s\017\257\271\2476\253\274f\036\257y\227k\326\361\232s\274\346t\327\214\352\232q\271f\233k\356c9\377\207\373*\363Y\336K\365\346v\177\240]\222\034\313\337\345\r`\254\013y\004\363\304MFD\032P\270,n\3170\266[\034c\320\374\027\030\334di@\r\201P\330\302\212Z\376\216\362\230\356B\314\347w\361\302*\332\323\321X\345\302\315_\344}\r!_`\317{\357\003\335Y\026~\220T\003\273\367\006\270f\324\222\210\3665\344\275\227\025\024\357\035\036\360Y\037\373(\257\036\353\263"
+	.ascii	"\352D={\266\307^*\317\260\337\216<\317\232Dwo1\002\337\355x\326"
+	.ascii	"%|#Gy\375Z\231\254L\322\243=\013\201\b\323\2526\210l\352-\352"
+	.ascii	"9\240\t0\314\352DD\031\232'N\242\025\356xl\270\027\245;\313\253"
+	.ascii	"\263\263N\3118m\255\323\031h\001_\305R\346\025J\205\276Qg\317"
+	.ascii	"\006\r\023g\321"
+	.string	"\ny@3_\300\3207\362\315\376\033U\224\317\266'\203?\177\366\004\3105k\313\260\265\234\225s#\235\277(Mm\316^\312\212\330o\314w\3637G\0314hH\217\246vDR\215\223\234\335\372\206t\315\223I2`k\022\264\334\263\364\033R\324^\013\315\323l\340\340\301Cz\024\265O&\307\264\315\271\022f\241v\253\301q\2667\204\254\215\363f\270\t\202\3238\315>\255\215=\247\211\201u\341N\3466\254\302A\323\n\246\240\323\022\023\260\0040(`\211\251\t)\251\303\211\244\025&\220\232\224,\244XRb\021D\032j\002\221\304B\351\203\323RR0\370\002\330\303@\007IA&\340\017\210\342\267\244\204\304\342\007\f6\375\034\0201S\213\244\340\317\211\211)\370S\231\271o4\264\304\237\245\020\251l\262\365\325\261\210W\312&\330\332p\345J\225+\027\324ZD\231\306\2666@\n\203\232\017z6jY\316\242\017"
+	.ascii	"\212\035\316b\333H\262\261\352\231\320\351W\0338V\252.S\313a"
+	.ascii	"\006\207\013\253g\267\030\367\243\224\310\266\033\2622\274V5"
+	.ascii	"\325\221\356\336\033\201\033GO\2559t\254<x\244G\211,\2046j\336"
+	.ascii	"L\345P\213\322\241\235V\277(\025\262C\226[*\3315\216\224BV\206"
+	.ascii	"r\212\0230PTJxA\017\372\367k\226\217\025H\337\030\364\026\004"
+	.ascii	"C\233\263\213\334\334\262J\272\261\255\001Yna\017W\256\225\310"
+	.ascii	"Z\244H\372c\201l7\243\312X\325\376\330\200\272\250\201,%\225"
+	.ascii	"b\210fDR\220\024$\215\001\200\002\021\252\262n\021\240\265\204"
+	.ascii	"'\205\264\031\nW-o\247\210\207\332\304\234\237\371A%,\342\264"
+	.ascii	"\013h\226\325+\210\2650\261\302\322k\226\277y7X\366\306\203J"
+	.ascii	"\250YP\340=\321z\267\f\004UD\323]\326\001]U\256\246\344\323H"
+	.ascii	"\226\212\221\335+W\234\255\036{\336\026\367\234\317\256G\360"
+	.ascii	"\232\254\314\315\312\232u\207L\007\322\374\204\254\263v\214\317"
+	.ascii	"Y\302\331\013C/\002\316\030\036\277i\022\231\314\335\255~c\236"
+	.ascii	"\261hr\3024\324\231\211\332zT7\275\306\367\242\336^g#\004\321"
+	.ascii	"\016Z\020\335\304\r\031\035\021E\371\002\030\315\211\371\322"
+	.ascii	"4\311\344K\3524\272\207\203J\216\324\275\211\355y\203\334\fS"
+	.ascii	"\324z\245\226\035\210\301P<\n0\b\0057\024\\\210NVl\201=\177\355"
+	.ascii	"\356\235\217m\r;Q\354\267\341\225\253\024 v\345)\324\350x\253"
+	.ascii	"\355Q\352\353g\005\267Y\242\024\245\027kr(\264\007\376xBJ\356"
+	.ascii	"[\263\300X\204>3\306*\223%5\032`\270oA\022\002vw\037\266\025"
+	.ascii	"x`L\376\324j\342\\\363\01642\005\013Q\332w\246\267$WG\366\260"
+	.ascii	"}\240T\253\024\226\341\\_\036-PNv\370R\200\t\221\031\372\273"
+	.ascii	"r\030m\237\3131\313 \244\211\263\2439\2644\216V\373\335\364g"
+	.ascii	" \246\002"
+	.text
+	.section	.gnu.lto_processRx.part.0.344.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\223\034\225y"
+	.string	"\272\273\034*M0\314\342\031\003c\376"
+	.string	"\315\336\341\272\373\226\255\363\016\241\351\002\206\006\322\366\247>@?Rt\035\370\352\363/\303\213\326{JM"
+	.string	"S\313V\324AC\001\216OZ\300\300A\201\021\333\203F\344\221a\230\253\245\2426N$\242\032\211\334)\245\024\231\002Z\002\214\002\314&d!2U\230\314\0224!/\333\032\220K\017\362Q\260\013W\027.\343{V\"\356K\221\0325\201[\270\266p\345"
+	.ascii	"FQ\244 \005\346,zQ\024\340\336\367\265\322~/\032\013w\317\236"
+	.ascii	"ab\247\320x\334}|\344\273\342^qi\330\242\374a\325(a~\201BSa>"
+	.ascii	"r\226`\026s\233\320R\270O\340\343\236\326\336\226\277<\356=>"
+	.ascii	"j\265\036\004\306\367\354\355R\341\210mN\360ejm5\036\333tmId"
+	.ascii	"\t\032\217\337\216\313\026\265\271\033n%4\270\227t\223\276\343"
+	.ascii	"\343\023'2\270\bl\372\2329\221\321/\216\267m\034\306\225\035"
+	.ascii	"&Pe\302\305\204\353\006\320\311\224EM\227\320T\n\030\332T\n\212"
+	.ascii	"\272\246o\031\r\240\023\2759\246f\031\252\306\002\346#\277\367"
+	.ascii	"\224F'\231a\234\276fP~\272\256\263\240\223\314`\233\367]\203"
+	.ascii	"\323{\337\251S\263\214T\323lQ#\333f\215\335\3236\313\334r\f%"
+	.ascii	"E\003\312\314\f%e\001\273=m+\3639\342el\211\342\373N\227\315"
+	.ascii	">\220v\233\251\254\204\355x\212\342\204\211\022$F\210\240\n1"
+	.ascii	"%\005\"\n\352\203\207\345\223S\023S\007\016\033\226\224\222\220"
+	.ascii	"\2164\030\025\021e\030\022\302\020\244L\002\375 }zx.\354\350"
+	.ascii	"\344\340X8\336\330\324\320\264\254\361\235Kp\271o\314\272\232"
+	.ascii	"\251J|\330\356F\363\364g\355\253\206\320\332\227\rGq\365\023"
+	.ascii	"d\213n\302\230c\215\255F\2270\343$\204\326\276j\254\340#\316"
+	.ascii	"\224q\021T\212\036\002LO\201\271\373\342R \254\205\036\345\245"
+	.ascii	"\241\274\020\372\007k{\260\366\t\372\322\257\237\264@\375\336"
+	.ascii	"\240X\334i\260\317\233h\252\230\256t\207+})8\007\276\336\300"
+	.ascii	"W\305\227\362Z)/\212'Ai$(\211x~t\327\032\356\236\270\221\023"
+	.ascii	"/j\342DI<\203\225\241:\027\242\233s\f\203V\202\220\310\271\362"
+	.ascii	"\r\032\327\327FZ\240r\236\204s \"\3763\304\221\206 \270\217\241"
+	.ascii	"\020\3571ts\236\013;\037\264N\333\016\3171\026]\371\033#\362"
+	.ascii	"\261\303\332oP5\307\t\022u\013Z\240A\372\256\215\336\240i~\244"
+	.ascii	"\251\2721Z\303\341A\333x\360\006E\363\032#2\013[a\0075\276\034"
+	.ascii	"\375\006=s\232\243\331\230\267Z\240\035\030\213\336\367"
+	.string	"\025s\326\311\3146h\3431\307\f\314\337\330\341poL\216Y\230\021Y6\204\254\357\332o\230}\271\3634\227@S\365\276/\357\260]\320\034@3\263\316\3347\314@4\002m\315\333<\373\330\331\227_\231\235\003\327\321\242\207\313\306\366OA\316\274\374\332b\3204\357\200+\245\371\276\353\276\240\252\301\224\035\207k\340\002\341\026\302n\020\327\315\233\314uk\233m\277\251\364\022b\241\0205\2723\343\263\237!P\254\214\227_\231\203sKq\211\270F\274\311\214\337'\364\005(L\254z\326C\245\021\334#\336d\377\254 \342\216\277/\366\310\231]9\227\256\t\"\332_\210?0!\030\335\326\337\277P\t\213\2349\305\no2\377N\302\343\353\273\370\273\333\312\034\352\375K\231\215p0\355\031m\377wm!B\305\002\346ex\310\373\231\005\030\300\233\214\373\256o\252fP\353!\330w\371K\371\001\350\277^\257W~\037,"
+	.string	";\263@:\007\360\343\f\200\217\363\n\244\263\212\037\347\024H\347*\2443\n\244\363\211 g\023J\347\022Jg\022J\347\021Jg\021Hg\252 \347\020J\347)\245\263\024\322\031\204\3229J\351\f\245t\376\240t\366\240t^*\235\237\200\234\235\200\234\233\230\224\316\035\224\316\034\224\316\033\224\316KJIJg$\245\363Q\322YC\322\331(\351\\\224t&J:gH:\017\261\263P\0076c"
+	.ascii	"r\016\002rV\0029'[\260\031\210\235\177\330\031\311\316>\354\334"
+	.ascii	"\303\316<\354|\001\351\274\203t\326A:\347 \235q~\234-\260\363"
+	.ascii	"\021\351|\203t\266A:\327\2603\215\217s\333\343l\354'\315\317"
+	.ascii	"\316\336\323\356\256\300(wFG\355}\313\256f^\036\254\tD\372Iw"
+	.ascii	"\265\273\204n\276n\301\356\300\3560m\3035\276ga\017XWe\016.\213"
+	.ascii	"\335d\330\007V\231\316\301\215\265(\352\232\266\225q\213\226"
+	.ascii	"m\256\312\\K\351\260\005\266x\201(\266\013\312\260\270\027Oa"
+	.ascii	"2O\271\t\214\313@\321\223\3236\034\320+\rn\300\370\236M\333p"
+	.ascii	"L\231\370L/J\300\r|\2150\257\036SU\301\f8\340i\rC\255lU\0046"
+	.ascii	"m3k\266\272*s\212/\330\313\364\202\255\214\3236\263\t\260\334"
+	.ascii	"x[6\313\303\334,A\213\341.\022\305S\034#\206\017\210\346\301"
+	.ascii	"\201I\fC\243\021\257\370\260U\260\240\021\257\212\274\246/\364"
+	.ascii	"H\265\322dN\021\255\246\331\035\357\236\266\260\r\003\235\330"
+	.ascii	",\\\264\032w\364\322\007l\275\264\2535Mg\221"
+	.string	"MC\317h\217\276\337\250\203~\3767c\357)EJ\333\354\321\343tuQ$2\303\304H\203\321k\340\343<'\277\363+)\030\235Aa\305\240\250\210\350\213\250p\236\223`\223\2430\205\350\233\204\2643qWD4\242\227r^7a\316\001{_\257\243\f\337?\250|\237\341\335PLq\212\233\300yOm\314N\276\367\244\222D\325,{\236\353=\255\\y\366\365\265\315\016}\303\245\231\261\326my\313\360R\306\360\354\343\374\240\372\371\233\342\334\220\320?\227\002\\\247yJ\226'\2407\231\320\267\225\007\030\236^\233\020\320\263\317vu\001\244\372\005=\006j\227\352\235\362\203\276\r\333\210\304M\220L\225I\2427Oi\223\257\374\026{\003\372\344\003Q\243\\\307\026\275\374\032\350N\270J\b6\001\372\036l\343\23042qu^~E\343\241\207A\332\377\026\270\260\023<\024\202~\376\207\374|\367i\200\346\246D~\223"
+	.ascii	"\337\351\347`\313\374\364\3624\364&C~\367u\227\215E\365\254\207"
+	.ascii	"`_'\266B\322\347]<\301\370|\013\206\221\373\373\272\251R\t\003"
+	.ascii	"\352Q\242B\317S\245}\211\373\341\231\206\341\261N\337\367E^x"
+	.ascii	"\027u\356S\214\253\343\302S\245\031\306\3714W\273\363.\250\204"
+	.ascii	"O2.\027\347H\236\326\347\n\3173\336d\3173m\263;\317@Z\241\277"
+	.ascii	"\357\333\325\363RGk\235\032-~\3269\257s$\347\331,\\\376\324\350"
+	.ascii	"\214<n\244it\374)\036R9\323\nBrDI\273\300\3151;U\336\355v\265"
+	.ascii	"\314\356\227\033&\210\030\346\017\214\203\230*\210:\335\242\305"
+	.ascii	"\371&\225p\314\207\264\250y\337w\212\035\004\027\256\rn!\006"
+	.ascii	"\264\315\342\274M\235\327\007\356f\300\r\027\003\f\332f-<M\226"
+	.ascii	"\300?5:*ojf\327\314\325\300\357\017\354\273\244x1\002\230\323"
+	.ascii	"A\267\377\213nJ\252Up\216\357Z\250\204@\216\3574x\346T\302\312"
+	.ascii	"\212X\220\321\376'3p\263\013\0038\b\346e\216/\365Ac\027\350C"
+	.ascii	"m\356\335\224T\251\334\274\264e\347\341=\334\r\\\035:\332f\033"
+	.ascii	"\232\226\007\227h\363R\276y\366\233T?f\027\315\325\270j\336\027"
+	.ascii	"l\212=\315\243\256\007\334B\232e7\352\356\330\3216{\363-BZ\024"
+	.ascii	"k\3357\237@\007\327V\363\322"
+	.string	"v\201\264\355\177\335\373\276/\315Pkc\203\330=\024\214\365TAs\371\"\202\036\306z\222\201\345\264\322\nb\254\247\007\262\"X\272H2\326\023S+\313\271\214\261\245\245\265u\245\234a\005\203\t"
+	.string	"\323ie\305|@\207\202-\030;\316,\255,\002\016x Kk\307\211\365\"\013\006\013&\f\007\254\234\006\304\310\312\251\240\001\227\301\345\264r\032\220\343\214\301\274j2\013`\302p:\267\232XN\035\346\004Y\316\253\0240\266\232\316\030[+\260\256bpY\301\350\221\201"
+	.string	"S+\353"
+	.string	"g\ff\263\311u\205\303WO\314\346\326\325\362\312\3052F\226\225\326\362\252)c\371\204\344\255\b\230\315\245sk\253\271<\266\361}\037\\(g\246\232W\345k-\200"
+	.ascii	"\317U^\377\265\342\245o-\002\031\025/5r\026\035\2233\304\007"
+	.ascii	"\222\024U,\336\302\020\027\276\324\317\021\216<\343\274\311X"
+	.ascii	"|\273\203\007\330w\241 \322\001\310=\bc\002p\003\340;GT\214\365"
+	.ascii	"\304\217^\361\315\017\262\002L\334\231\211'\235KG\346\210\263"
+	.ascii	"\343xi\324P\210\257\211\230\022/U\361\354\373\017*\226g\222g"
+	.ascii	"{\232qm\250\370\036)\276\361\202\220\260\373\222dD\025\212\257"
+	.ascii	"\372\035(^\201h\2278\021\3214*\326\354\013\220\020\017\326\035"
+	.ascii	"<\355P\2401i!\210O\346\246N|\377x\035'\214\212\321-qf\354\254"
+	.ascii	"bR&6\310Q\342M\2145\211/\361MP\304\220\214x\021O\342q\334\215"
+	.ascii	"0\356\3650L\214\372~\021\337~ \250\310DuY\006PT\177\001\025\226"
+	.ascii	"\270\017!\236\314\306\324\207x%\224\031\255\324O}\213!\371\362"
+	.ascii	"\353\213I}\027\0069\363\360R\366k\203xv\317\320\313\362\245\374"
+	.ascii	"\264k\357\376\353i\327K\004\371\273\336\353I]\362\254>\253x\202"
+	.ascii	"\211w\2048\236^\312D\335\242\005\361M\302b\013'.\033\210oh\224"
+	.ascii	"\317z\346\345\367U\347\024\365M\352\240\231\250\037\342Ckzi\231"
+	.ascii	"\275\"Q*p\211LP\212wd\210\037\336\303C\215\271\373\260gXd\371"
+	.ascii	"\375\036\276\263\344\205u\320a\371\275\226\270d\2623\024\362"
+	.ascii	"jd#px\351Z#6\222h\236b\242\327\206\2272R5\204(JJ\0174\026\202"
+	.ascii	"ZR\3223\375\215\2475\247\177\372\036[\244\021lz'\246oz\242%c"
+	.ascii	"\213\277"
+	.string	"\341;|\213\251}\371\025\314\035\007\243\021\025\n\227\276\177\303\367\2306\216\020xxE\007\223\"\206K\177@4o\351\245\235\364J\317\303f\245\213\330\342\227\322\223\346j\013\301@q\302g\236\324`\322+\020\305\263\326%u\201\213V\221\2624\322\367\032u0\020\351\003\202q\250\"\371$\223\222N1D2\"\"I\222\244\003\342\n\020\006dq \307\314\003\022\340S9\212\204P\241)\321\024%)l\314\001\256\315V\003\236\026\262\306w0\367\234\370\026Y\364\355\355\352\035\325 A\273r:l\225\255<.\255(\267T\374\235\347\2344\024\246\260=\201&\232\2127zxH\177,\247IW\355or\346^\327R\276a\317C2@\364\222+H-\341\f\253\204<\273\002b\216\350Z\bD;T\032\335\212\366\235\372\247\317\213\\\177\2556\037d\002\273x\251%e\302\330^T\253*\353\027|$\260\323\232@\025i\327"
+	.ascii	"\276K\231\315\331\232O\304\204TH\224\024I\367\036\301\205\tY"
+	.ascii	"s/\b\220%?\342\327\021p\372\2615'8I\\\034N!t$\341\0342\341\247"
+	.ascii	"J\324\035\322\347#\232R$\226\025\360\336s:\366\235u&\376\253"
+	.ascii	"z\314\373\214\214BR\206f\330\017.~\"\2636\fK\0217RT^r\352\231"
+	.ascii	"\254\336\262oJ\027\270JY(\350\341\007+\020^\224mbx\256\334\202"
+	.ascii	"`\017\364\302~\215\241A\r\262\315\321{\214^z\305\232\210\364"
+	.ascii	"$\210\320\236\326\\\204\350N\203\251\262\356=\364C5\232k\354"
+	.ascii	"\301\372\013\272\305\\\243\360\360I\027\200\340\004\033\n~\251"
+	.ascii	"\365\315\013\013~\235ACi\221+\257\347\242V\247=\233\352\0033"
+	.ascii	"<y\034\nM6\246\252\204\0243\306\220\n\"\303\275\202\323\312\365"
+	.ascii	"\260\032\tM\fLR\270\301\277&Va\311H\024T\362\007z\354$\214\340"
+	.ascii	"fY~P\260\002((S\222\304\216w\313K9F\003P\232\270\377\312\217"
+	.ascii	"\336[(\261\267I\266\313\250\340d\337=9C\273\323,W\360\240\360"
+	.ascii	"\244\013\347\222\231\033\033"
+	.string	"\244^. \216y\206pslj\351\023\354\317,\333\230\305HL\234Kvz\231\300]\031\377`\222\363\030T\311u\240\222\r\364\245\033[\b\324\304\317\363\342\035\362\210l\364\305d\270\025uE\334\0017\362\210\026\324\262\302\262\316VW\032~\260C \037qg\363a\253\t\236\300\352\202s\251\205.'2\372\216\n\364G\217#!\255\034\375y\211\235\020\272\001s\224j\226\\\354\367U\373\234\316/\314\020Y\306\"O\241t\255O^2\372\022\255\036\2219\332j\017\t\330\232\204\234j\227=\233\256\0136\221\353\271\3040\343\244R\361_\325\3312G\272\255\270\361a\357\326\0232\235\327 \302\312\204p\2544\301E8\332\346\366\243;\310\305\247,\033Q\314\370,\253\364\201\337\247\370\3139\362\321,\3725\345\262\f+r\202L)\353\2674k\\\373\b\b\034\301|B\215?S\265G%\223\305;w\034\324\375\025`\f"
+	.string	"\026n+f\2403\204D\004\027'+\363^\"\244a\234\232\304\301\r\205\t,V8\005\3247\257\265\357\272A\345(f\222\"\032\337\b\267D\032\255){\255C\222\241\0310\342\276p\375\030\332(t\224\277\3407[\344\221#\312$\352S\347Z\354\254\360\177\036\317\005A\312\261<\247\301\327q\022_\350\331\0217@\024\331\t\374e\311\310\036\t\351x\264\361\013\325h\320\037\256\311\331\306\353\221\021\377; \234\220\2673\254\024\232\371I2\354\337\267\200~$\343AV=\016=\033\231\031\202\221\372\300\215\315\222'\203a\242\212\241\300\376\310\321\360\2351\365"
+	.string	"\251\354\312.\213\203\304.;\206\204\203\207G0_c\2354\235\336\355\t\273*xs\005\243\317\327\234R\"\265\366>2\272\341Z5D\200\246'\352\307\373yhS\362\377P\362\313a\333S\372q\342\366\321\273?\031\366\263\223\351\227\331\027\006\316\300:v\245c\235\275\307Q/C\321\202@\254\211~>/x\026\360p\253t\230\333\024c\223W\277BF\021\231\272Zm\320\3334s9F\016an\341\335\177\350\275\334\362\300X\036\263h\316=\346\211\364#\3151\276"
+	.ascii	"=}\3555\027\303C\237\237&\235q<i\320\0246?\315\262\222\353\355"
+	.ascii	"0\330\212U\257\365\370\3451,\375\263\023\267\001\r\364\002\363"
+	.ascii	"\245\024\031\3131\006k\242\261\255\021/*V\273\377\201\374ZE\234"
+	.ascii	"Z:\325\336r\336\330\217d\270U\265y\b\277\204\350\234\344Gw7\n"
+	.ascii	"\234\337\356X\240\311\263\263_<u5\030\377\310\n\2074\264/\305"
+	.ascii	"\201\027\260\203\020G4%\201\030\262:\362\265xH\355\333\263\336"
+	.ascii	"/\205\215\354\035\262\337\033r@\206\330\270\240\357\342\254\347"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`7\031\225O"
+	.string	"zz`\032;0\244J:\277;\n\001\207\211P\263.\tc\001\004\033\024`\206@$o\253}^\220Z\305Z\252K\227`e\031\004\007\366\357\350\271{\363\037\207\316\325\370\317\352\354"
+	.ascii	"\332\246\366N;\211\001\213\001\245\001d\372o\3064\336B\327XM"
+	.ascii	"L\377/L_\017\230\376\237\265\017h\256\337'\327\367\023\327\367"
+	.ascii	"\203\353\263O\323\364^\005_\372p\376v+^Nv\267\217!\357m\342\205"
+	.ascii	"\344\353G\217\266cA\336\213\003\t\216.$;\276vx\331\350aD\302"
+	.ascii	"\275*v\266\227!\327\372m\272\364\331p\351\333\251\365\327l\351"
+	.ascii	"\253I\353\247A\353\2439\353\327a-\330,\002.3\273\216\310\262"
+	.ascii	"\376\031\013t\214\210\317\3227\203\005\217!\257\364\307\220a"
+	.ascii	"'\362c\317\204\264rKH\305W\351\207\241\322\0073\245\277\212\365"
+	.ascii	"\345\256~.\2541\340\235\375\270\203\365\341\276\245\254n\354"
+	.ascii	"i\377K\367\335\244\364\325p\224O\202r*O.\346\344\212M\372b\230"
+	.ascii	"\364\267,\351\247)\351\237\341$\237\202\344\352\327\303\274N"
+	.ascii	"\210<rEF\236\026\271Q$\221WA"
+	.string	"\016\271SHc?\354L\345\004\351k\001\322\230\017\377h\234\006\3738X\217\306u\230\307\007\355\270\240\256\343\321q\037s\234\017\231:\235\252#\216\306f\360\215#\262q\306\032}:\032\270m\306+!s*\003\263\3058%\030}2/0\027\027\330\n\262E\277\ff\321G\3039\032\215FW\364\315\260\212\007J\361F(n\343\t\ff\342sJ\3408\022\3757<\342k\"\336%\304\331@\274\355\303\035yx\341\202\016\247s\025\214\303\271 \357\275\311\324\351L\343\334\333\367\3761;\2004M\323\r}/\370\336[5!,#3\177eb\346\345\252d\177\005\325\201Cw%U\345\244\334s\200*\260\257U\271\253*\023`\233\034M\345\246GS\271i5\234\312\313\026\322T^\262\221\356_\240A\275\256\337\302\276;\270\333h*/\325EQ\314?\2602\227QTaT^\256\277\031\0273\027\212\3034\302\271P("
+	.ascii	"\210\346\224](T\200\277\275\260\013\205\222\n\f4\274P(-4mX.\024"
+	.ascii	"\352\376\365q\003\273P(:F\304\276\333Be\254\003\020\204\272z"
+	.ascii	"s\206x7\321SV\256\177\241\233\r>\345\344z\f\227\246\351\333\377"
+	.ascii	"\216\242\247\374\365\271\353'|\312X\317W\360);\261\177`\200\254"
+	.ascii	"l\223\355!\274=\323\356\363fH\215\323\f\033ky\324\370\314Q\343"
+	.ascii	",\215\032_)l\214\205Qc\262E\375\305\266\177\t\332\307D\330oT"
+	.ascii	"\324w\034l\234\n\366\037\023\365\243\201\215\303\236\215UD\215"
+	.ascii	"\305\0165\236b\2501\025\300\306U\n\365\037\021\352\033\016\352"
+	.ascii	"'\n\352#\006\352\037\376\365%\371\365#\365\365!\001\352?\377"
+	.ascii	"\364[?\375E|}F}\032w\331k\274\306\247\017\335\323\037\324\353"
+	.ascii	"\013\352\351'\312\323\017d\373n\362\372r\360\372\207\360"
+	.string	"\364\r\335\351\003\332\351\027\272\353\367\251\323\337\243\323\3473\247\277GN?N\234\276\036\234~\2367\375<7}\2746\375;l\372v\354\372wk\372u\3244\206K\323\330\rMc/u\215\337\3164\376b\2461Z\231>\241\212\367\331D3\304\323s\237\032\262\235\267\032\362\327E\r9\031\305\220\223r\177\003\f\b\340\356\254\267\302\225\227\037\343\312\313\365\220++\311\270\262R\356\027C\b\252\247\305\225\223\227\270\362\t\271~\205+[\021R\330\312V\354\021\250\301t+m\345\252\366RejU\353/,\022\242j\1774z\211Ne\353\300\352\350&n]>|\204\236n]0\354\356.n\345e\333w\260\255\254t\264\225\223\353\331\347*[\271k+'\235\307W\024\230\0232\226V\2763K++\333;\265\362\022\252\225\233\326\207i]\325\312Q\252V\216Z\324\272} \211q[\217\311\2724Jc\265\262\201Vk"
+	.ascii	"\2434T\222\353\323\254(\273-vw1+?\2530+ce):\2106\310ot\225\337"
+	.ascii	"xu\035\315\242\355u\274\312\312\366\361*/\017\257r\223\032\275"
+	.ascii	"\312XW\021\2319\311*UG%%&\002\3047\207\232\324&\366\024\236r"
+	.ascii	"r\004\324C\255\261\364\350Nbf''\247Df\216R\243\326?\212\rdf)"
+	.ascii	"\365\227\222j\237\313\340\351\001\032P\025\231\331\200\001\252"
+	.ascii	"'f\246\242\252R\241\314\\\305\"h\255\324?\314\217Z\237\325j\325"
+	.ascii	"*p>C1\263\002VA\373\347P-1s\0166G\373\034-df\035+ \035\255\312"
+	.ascii	"\243\355\321.23\220\365\025\006\017\355\202\254\017\260\266w"
+	.ascii	"\350\03623\221\"\353\033\2349\224\026i/`L\246\263[\211\231\275"
+	.ascii	"\324\337\255O\321\316}2\263\027\373\t\200g`\356$f\366\272\304"
+	.ascii	"\314_+&f\376\n\267I\316\301\365\313\313\217\221\253\272~Y\351"
+	.ascii	"\234\"\334\272~9\211\027\245^\277|\366\366\345\213\271}t\267"
+	.ascii	"\017P\230\333'w\255w/ox\326+$\246\345`\356^\376:w\367\344\277"
+	.ascii	"i\337\250\254\233\250]\253\326\256\021D\243vio\305h\351n]\253"
+	.ascii	"S\177`\321%\305\263\261o0\346\264#\203\b\326B\327\347\3050\352"
+	.ascii	"O\211\016\243<sj[\373x\267\365\371r\352\013$\216\201v\330\352"
+	.ascii	"(\245n\254\355I{\bq\006\3458Q\033\227\264\277\217\31749J\332"
+	.ascii	"_A\225\356$~\251\215^,\246+\270x\237,\2215\323\275\\6gY\364\370"
+	.ascii	"\f\242\276\301\031CQ \352\357$60\266\036\330N\333e3\017\366\315"
+	.ascii	"\2721/w\273,\216F\243\227\256`\313\370\267\365\"\2369\214\376"
+	.ascii	"\313e\263\325\263\205\303\273lF\240bAu\340\304=\356\262\231\212"
+	.ascii	"}^\226\200\232\237\024\373\25146Q\355\227{l\227\273\354\201F"
+	.ascii	"27z\331L\200\360J2:\n\227}\372\306\347\026^6i\205-\356)\253T"
+	.ascii	"\327\034\214\345\273\213\227\315X7\361"
+	.string	"\2629)\327\274y9\351\244\300>o^\276z\027o\036c\\T\357h7/c=\355\346e\006\007\240\341\3429\226f\226\346\313\232\371lb3kh\346d\332\274\201\f\325@\325\365\017\024\001)9\261f\315\354\324>\233I\373\343v-\315\245^!\261\20353\325\372|7%\323]l\242\255\225y\332\314V\316\237\257\217.C3w\373\263f\376\334\372\004\317=\001\201\330\250a$\007\271C4\222$I\246\003q\005\2049\346\\U\035\021\320,\005\235\031\tD\002\221@\002\031\321\003\007\n\340\372%2\243\344\201b\300\240\bi\351e7\212\213\217\004\367|<\357\334\245\0216Rc>\202\033\226\250\307\323R6h\020\212\345'\315@\221-\322\277\342;\207\004\355\223\236\n\030C;f\024j\366\323\212\224=\025jd\300\201\252\227\316\026\003\n\232+H3(\204>\212\304\345D\365\b\336\240\023\223\304\306\013\253_"
+	.ascii	"\\\314\005e\230\244\251y\241x$\330\243\363\301\356X:\312\326"
+	.ascii	"\365\367\373 |\213\016;<\237\346\313\254\022\030ZyZ\007\007\222"
+	.ascii	"\275\223.\022\233xL\002\224\230\005\005 \267\216l\215\217\250"
+	.ascii	"McX\020z)\177 a8\253@\300\225\f\032\202\177,\373\3742\365R\210"
+	.ascii	"\210JC\306\257D\035s\230c\230\222\004\207\211Mw\016\204\244p"
+	.ascii	"\037\346R\301\200J\314%\355\310\215m(Y\376\305\3531\255p\222"
+	.ascii	"\032(T\304\206D]j\212\262g\004S\310\235\307\357\262}\340[\340"
+	.ascii	"\374\357\300\377X\352\215#"
+	.string	"S\371%uQyTs|P\207\336D\364!Y\374\006t(\223\232\2531\240Y\023\312D\277\323\307\235pA\265\221&T\2228\265c_u\031 V[\337\235+wp\256T\233\310-\304\323cf#\t\274\357\313\257\302\343\017\261\341\236\237\347e\216\217W\325~\223\234\3275\342\215\375\273q\313}\037)|e\355l\365\235\272\025\245\364\364Fet\001V\253G\004\3673\222\365\367O\355j\314?\3425\341nm\005]]\253W\205C\272\224\223\205\027\241\344\212\324\0216\371\232\301\274\276i\205\016\220\264\\o>\021\363\2129\277)\2218\371\333\362\235ZP\227\212"
+	.string	"\005\215\324^E\034\247\217\221\203\031\036\222O\331\233JgO"
+	.string	"\313\370s\373\314o{%\317\016\322T5\330\032+\025\023Z\301\340\304\234B\367\304\360\261\376"
+	.string	"\n\260\032\235\322\323{\241\246H\232\036kn\226\207\311\302Oxl\324\002\367"
+	.ascii	"\315\021:sO"
+	.string	"\227\353#'\240\323!\216\002]\335\036\t_\271A\2023\ngk\243\235\363\2449$\277_\243\207\026\255\344\214\036J\340\363g2S\024\326\261\362sT\022ME\322\250$\232\212\244QI4\025I\243\222h*\222F%\321T$\215J\242\251H\032\225DS\2214*\211\246\"iT\022ME\322\250$\232\212\244QI4\025I\243\222h*\222F\205\004L\352\356\353\035\377\220\257:\354\211F\305\217%=\261r\275c\326\224\0213L\373F\3445\005Pr\374u\213\275\327#\247\243\230kU\0247\271\304\016.\250\332y\363hE<\212i\356\353\357\034\266\236\250\264\023\352\333\223\221\255\225\350\367\240q\375\343\n\372\217*\250\227\303#\253\334g`\210\320\304\006\026F)\365\n7q\302/Y\350c\277\006\003Ky\376\006\237/m\266\311r\342Fb\304!E)\356\232\306%\177(\032q%gI\207\353\231\247\316\360q"
+	.string	"\363\026\311\320\207\021r(\036dK9D\257\215\310\232\325h\221\021_\340\364\346\b4\233a\023u\277"
+	.ascii	"\220}\346)\257\205T\001"
+	.text
+	.section	.gnu.lto_.refs.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`D\003\275\025"
+	.string	"V\366\221A\340\264&\255\001\344\235J\025<N\253\206\243\361i\305<\f3\314\020\006\020\341\354"
+	.string	"\006\032\3140\303\f3\304\325b\276\035\322\354`\336\211\317\373\375\243\221\376\276~\335\356\353\3777\233\332\324\314\032\261[\246y"
+	.string	"\201"
+	.string	"\205"
+	.ascii	"\367Z\034\3235n\356\302f\003m\230\232\313\2529\365\272$\2323"
+	.ascii	"\246-"
+	.string	"\327e\265F\221\031\025\003\200\364\345\272\256\326\253\227\253r\335\023\230M\256\233\275|\255.\247\251\226O,g\331\243\321\225,\013\253\312\215\251.\fe\036\324\275a]\203\372e5J\265\t\345,\365\241\236\240\316\234\256\214\351\302\264_L\267J\327\205tYL\253\224^\335U\221\256)\2734z\324\276{u\366 \355\314f\202\322/Z\260h}E\320\255\302u\247\b\332\201\3532h\275 \350\016\005\335\003A\307\210\346!Z\207\350\231\3241C\303\274~A\260\213\320)\256kjMb\035p5\265\233\275\032\030\025\270\027;\002w@\320\365\001\272\261\237\2533`\034\237_\261K\323s]6\267\264\273\322^\361\\U\273\2516\nvO\260K<\267W\001*U\251;w\344:\235\233\362\272\252\327(\231O2\223r\356\250\005Q\204p/\004\b\330=\017\254\257\003\354M`7\023\326\227\264+I\202\344H\221!B\202"
+	.string	"\371\321\203\307\216\237[\007\320\235\343\206\r\004\367\f\240\313x!T\304\342\347\347)\210n@\264\002\242\t\b\3153\364\316\353"
+	.ascii	"\b\306\021\272\206\265K\024\263\254DqS\262Q\332'\260\016~\306"
+	.ascii	"n~e\253nNe\237\334|\243\rJ\333\3201\270\247l\322\352\266\272"
+	.ascii	" k\272K\272\263\323\035\231\356\231* m\305nK\f\025\337hs\264"
+	.ascii	"8\032\207\321\203\335p\032\356\361\314p/'\206{\257\027.K\353"
+	.ascii	"\025\327]\265>q\335\326z\026J\2441\332-\214\253\220Q\030\315"
+	.ascii	"\312x4F{a\2340Z\352\342^\027%\264w\302D\211E\367H\214X\364\211"
+	.ascii	"\370\300r&H\214\250n\"(\027\342\243\335;\032\215\324\213R;\310"
+	.ascii	"\342\005\355\241\230\201\332>=\267G\300N\216\315\025\327\364"
+	.ascii	"\\\032\231+.L\317+\251M\355f3\302\315\0133 \260\"\263\022\017"
+	.ascii	"\211\242\354\203\003\223\025p\321\373A\273o&\026\303L\324\031"
+	.ascii	"\367\341\345aZ\007\030\302\031'\005S\b\033\b\2147\026n\210\033"
+	.ascii	"\354\220q\004s\310=\016\200\301\340\220\213\3337\230!\346\020"
+	.ascii	"\013/\b\2645\242\270\355\300%6\236a\342 \024\260\371\f\357\347"
+	.ascii	"\321\311\n\203q\210\3708\027B\016\177=\313\360)\207IRi\231\024"
+	.text
+	.section	.gnu.lto_.decls.4f365414189f81a5,"e",@progbits
+	.string	"(\265/\375`\321\312\0250\003\316\371\004\307\021S\020(\245\3514\006\205\230\034\223\265r\nB\021\222Z\256$\241\3667@@2\001\004!\003=\230bA\221>6\034\346,\306\256\217\"i\030#v\353\276n\001"
+	.string	"\276\035]\223{\001`4\b\202\374\325\311\001dY\226\345h\241k\031\211\210\b\221{\257lr\247"
+	.ascii	"\020\003\022\223\022Z\216n\243\233q\314\345-\212Y\266\346\306"
+	.ascii	"\223H\216v\2532\205F\213)G\263!\262\002\243\022\213\343f\220"
+	.ascii	"\t\2173Y2\350\013\321\331\027\202\333\027:\263/\224e_\210\312"
+	.ascii	"\276\220\223}\241!\373BV\373BM\373\033\352\354_\2371\363BK\313"
+	.ascii	"L"
+	.string	"\233\331\202z\r\255\256\210\355h\363 \324\323\246I\214\255\314\216,\274*Y\037\315c%\357\251\305\3505MF\217A\235\272\214\016\223\331\312\350+|\236\272\214\316\242\325zM\247\002\252\354\261\243\313\350*gtyB\037>|\030\026\331c\004\352\247\277!\313\006\203\3361\262$/\353ox\262/bK\r\355E\247i.\275&\323G\343\307\215\247\376\242\273h'\352\324^4\3325\026\224M{\321Zb\246%\022\226|\335\265\t}H\251x\304\271m\255\271\344\250\255\345\004\225\225\3657H\355?\300g\377\0019\373\017\244\331\177\300\314\016\242A\352\037\320\262\377\300\223\375\007\264\366\257\251\350)\250\032\270\2630-E\237\351\2466\323e\250SO\321dr\304\340\306\240\220=\243\240g\275&s\305\362#\312\363\t\2526\\j\306S\001\240B\347NLO\321cP\230\350\334\245sfmdA}\rt\3665\304\355k"
+	.ascii	"\263\257!\312\276\006\260}\r=\366\257\235\3500-W}\222d\375\353"
+	.ascii	"0\315\325s\323#\257*\353\"aZ\252t1\343\310\321\302\314q2\035"
+	.ascii	")O4\215,\312\263Y\344\3316\205\310\263W\004\254\215\t\205\305"
+	.ascii	"\207\331\333\352u\005\231\263\365\365\346\031\347Y\026w'\t\224"
+	.ascii	"\326\035\032\2204cc[^q\230P\232\253G\325\3031\\\002\212\343!"
+	.ascii	"5\230=\344l\tA\363\204\332a\307D\323\240Hy\346=y\\=<\315\244"
+	.ascii	"\267zozI/M\257\216fj\"\275<\235\245\255\364\f=DK\365\364\364"
+	.ascii	"\330\364\336\364\372\364\320\364\3424\217\336\263G\247\243\264"
+	.ascii	"\016]\325\233\353\301\365\324\364\326\350/M\325\303\323\273\243"
+	.ascii	"\215\364\354t\016-D?\351\036=8:\326`\332\207\376\241k\350\"\272"
+	.ascii	"I\007\351\271i\257\336\036\215\245\217\364\354\350\245\036\037"
+	.ascii	"\215\243\327\246w\327\223\323\213\243\235t\223^\036mCw\351\251"
+	.ascii	"\336\034\rD+\3217zt\264\f\275C'\321H\364\225f\242ih\250^]ONk"
+	.ascii	"\365\334\240N\315\325k{\317L\357\314\0334\264\355\f\354\271G"
+	.ascii	"s\365\232z5zM&\nY\246\236q\034\023\255M=\241r\3401\337\350\306"
+	.ascii	"\230q\334\354m\0211\363\244\322#\307\311un\304\366\330\220z\366"
+	.ascii	"\212$\361\362\354AU\ry*\023+{\272\301s$\357\351-\351xj\256^\226"
+	.ascii	"\336\230^\323\231\202\214\2552\261g\332\023\263\347\226\0178"
+	.ascii	"L(\035z\230h\233\025\036v\224\264\231\035y\366\2124\331\262\365"
+	.ascii	"C\216\331&\313\245\025\351\035\211[\333\3421wG\204\231\343\344"
+	.ascii	":n\310\330\220\304}\351m\365\206\304\235i\223\335\f\341\322+"
+	.ascii	"\302\344\362\314q\362\030af\355y:9{\226Y\365a\306q\263\007u\225"
+	.ascii	"\307,b\204\355IDF\007[/\336\221\347\314\362\236\334g\253M\n\222"
+	.ascii	"\347\236\033h\035\215\250g\334\217\246E!{\366\212,Ic\366\212"
+	.ascii	"0\t\202\366\334\342\242\363\224\243gH\2212Zlh\336\220\t(v\222"
+	.ascii	"!\325+\242\271zJ\256ty\346=|x\3448\331\016\314N\024\024\263\007"
+	.ascii	"\325\233\262\321\203\222rs\243\r\2349g\314\336V/H\234[\216\243"
+	.ascii	"\2712\236\233\036\3148n\252MXJr\240I\264\317\013\325\240\242"
+	.ascii	"Wh\220z\rU\373\032\232\3663\314\355gH\263\237\201\313\376{Z\336"
+	.ascii	"\033\363\367\256\364\260\364\304\370\256\330\324\274d\035F\250"
+	.ascii	"\227g\303\213\224\254\237\341\312\376\337s\366\276\364\300\364"
+	.ascii	"\274\240\316\236Z\217\013\032\252\326k2\327,?\322\236=\265^\027"
+	.ascii	"4\257\327tn\032U\272<\267p\351\251\365\322\242|\301\211\245E"
+	.ascii	"\264\350\340~\372\031\300\3663\374\330\317\340c?C\217\375\f<"
+	.ascii	"6\032\206\350=-\032\b\236)&Y?\203\216\215>Q\r\352\004h\220\372"
+	.ascii	"\f5\366\203\352\354\007\305\355\007\221\331\017\272\262\037\344"
+	.ascii	"d?\310\307~\320\323>\006\273}\fj\3661p\331\3070\266\217\301\310"
+	.ascii	">\206\035\373\030j\354_x\356_\210\333\277\300\266\177\301\312"
+	.ascii	"\376\005\346\376\005\257\375\013X\373\027\342}\240:\373@k\366"
+	.ascii	"\201\270\354\003I\331o\242A\352\201\216\354\003\351\330\007\212"
+	.ascii	"\332\377\261\263\377sf\377\007m\377\207\271\377\323c\377'j\177"
+	.ascii	"xg\177\270f\177\250\266?,\333w\242A\352\207B\366\207W\373\302"
+	.ascii	"<\373\3024\373\302.\373\302$\373\302\255}\341\214\375 \335\356"
+	.ascii	"\341\370\263\031\n\007U[*\321\201%\353\007\345\354\007\325\354"
+	.ascii	"\007\303\354\007\233\373oh\220\372 \221\375\340\324\376{N\357"
+	.ascii	"\325\370{L\350[\357\311\002A0,\2534Y\367f\364h\274\367\324\223"
+	.ascii	"\321{\n\301+\216\231zO?{\342\230\351\007E-@Q\013\364\330\017"
+	.ascii	"%h\252~\320\306F\311\210\336s\372\201\373r'I\326\007\346m\337"
+	.ascii	"\234} \232}`\227}\240\224}\340\220\375'\032\244\036H\265\377"
+	.ascii	"\273\333\377\275\355\377\260\354\377\302\366\177:\366\1772\366"
+	.ascii	"}w\366}i\366}h\373>$\373>\034\373\273\317\376\236\263\277\333"
+	.ascii	"\366\267\225\215\306h\220\372Md\177S\355\257s\366W1\033\245\212"
+	.ascii	"cs\205\314H\\\326\3773\\^\223\337\262\232\234\006uf6\031\315"
+	.ascii	"\263\033\352\346\350\032z\226\201\2247<7;\2669f\342\264\311a"
+	.ascii	"\262\311g\342\245:!H\361\302s\263\213\343\246\320\212\366\304"
+	.ascii	"\215\217\240N\321 \365+\220\375uk\177\225\332W\367\354\253n\366"
+	.ascii	"U\265\375\3472\034V(`z\b!#\006\210\306\254\363\222\265\225\354"
+	.ascii	"e\310\004\024\307I\336<\307\3440\2503\213\021\223\235Y\r}#\242"
+	.ascii	"\307\314<\3438\376\300\341\203F\263\373\321\246\352?\203yV\313"
+	.ascii	"[\320\265J\314\024\265\254Q=D\317`zN23\366d}\325\313>*\007-\315"
+	.ascii	"\237\273\344/\231\013\352\314^\376\\\005\215{n\306\261\023\332"
+	.ascii	"\225\274E\216\031\307\261\227\234\226\267\f\231\2321\325\317"
+	.ascii	"\310[]\233]\034\307\037\204>|X\232\005\301\333\372*s_\005\333"
+	.ascii	"\031K\316\202:9d-tD\232pd}\365ks \216Q\016*\332\247\017\312A"
+	.ascii	"\275\332\265\257\346\330*\225<E\245\321\303J\232|\366<\345G\357"
+	.ascii	"\344&\2278\2167\354\032w\370\334e\215\306\250\0065\233\021=\237"
+	.ascii	"\231`\004\310X\326\275,E\311\2302\033Y\037\205\373\3216\224\315"
+	.ascii	"\035\023\275\223c7f\033\372\206\016z\307\356M\\\033=n\344\354"
+	.ascii	"\316\240\311c\312\2313\207\331\206\232\351S\226\227\320\240w"
+	.ascii	"\360\300\261C\343\313\223\016Z\207\276i\231 \026\007uK\303\007"
+	.ascii	"mC\327\340\271\365A\363\206i\034{\245a\2425\231y\242n?\321\024"
+	.ascii	"\332\237\273r\220\034\226\237d%\231GN\222\313\262X\206\222\307"
+	.ascii	"\362\216\354$\353\310\314\314$G\311[\031I&\313Mr\217|$\177\345"
+	.ascii	"\"yH^\222\177d\037\331+\023\311F"
+	.ascii	"2\220\314\225\205\240\316\f\226\263\236sd\255\353\346\035\031"
+	.ascii	"\250\032\033z\346'\222\312Qi\350\235\031k\"~\242\f\226\2532\026"
+	.ascii	"\372\246eb\354\354\031\307\361Ed0T\f\272\326\233B\265\263Tyz"
+	.ascii	"\022e\252-y\236\274\310\311Nm\271\306O\224mta\273\221\243\270"
+	.ascii	"\304e\2463h?\232\306\005U\033.\001\305Mp5\230oj\366\240e?Q\306"
+	.ascii	"\201\252\241oZ&\214ia\373\321;\317`\350\035\232\207\276\0219"
+	.ascii	"@\231\3343\216\233G\341\304A\325\206\2758\356\232c\306q\363\""
+	.ascii	"\374h\333\037B\204\f\206\316\241j$\314\210\343\26219=-kt\322"
+	.ascii	"\330\305q\363\203\320\207\341\0348tvL\350^\023\325\240\222 g"
+	.ascii	"\377\371\352\031K\315\002\361\206\265I\037)\272\254\263\025\321"
+	.ascii	"\363\325\004]\306\200\311zE\203\324\247m\366S1\373)\225\375\024"
+	.ascii	"\312~\232\2653\224\316B\023$I\326O\245\366\365\235}\r\267/\207"
+	.ascii	"jP\257\263\354\353\261}\255d_\377\330\327<\366\365\325\276\276"
+	.ascii	"\261\337\263\333\357\245\331\357\205\331(\036\272\007ur\200\362"
+	.ascii	"9\252\007\225\363\224\251\0317\343\270\371\223\215\360\331R%"
+	.ascii	"\353\367\320\366Q\016\324^\237>(\007\352{f;\243A\352{I\366\237"
+	.ascii	"\250\006\365=\255\r\204\006\251\267C5\250\350\023\255\203:\205"
+	.ascii	"P\272\370\007]\323$\305\225\365{8v\007bTH}\037TH}O\306~\256\333"
+	.ascii	"\317d6\320\223-\204jP\237u\354\347\245\355\201\315\006\201\312"
+	.ascii	"&\201\310>\272c_\013\252A=jc\337\211jP\237\201\3755T\203z\027"
+	.ascii	"\273\0024H\375\033\252AE\307\240dP\247\007\264\314\3210(\332"
+	.ascii	"}N\315\330J\0347\177|m\352xh\311\372-\366Q\017\352O\237>}\372"
+	.ascii	"\240\036\324\247\2605\032\244\242]P/\250S\002\024\314C\210\360"
+	.ascii	"\336\022\225\037a^\224<\274\254o\200}\364\313#\240\022\213p\013"
+	.ascii	"\366Q\tT\264\017*\201\372\275A@\203\324\nP\r[8\330Na\322\312"
+	.ascii	"\264d\t\206Y\303\224g\345h\226\037\275\202b\371\227\354\025\307"
+	.ascii	"Nq\034o\230\340H\223\221\254u\023\325\240^\013\032\244\242U\210"
+	.ascii	"\216Z\tR\251\264\232\261\2268\216\177\2068\242\\A\313\372\002"
+	.ascii	"\032\244\376(\025\t~\232YQ@\262\376\321)?J\206\226\241g\275'"
+	.ascii	"(\257XK\0347/\254dd~h\311\032=\313\250\031\332<z\206Jy\b\021"
+	.ascii	"\036t\212\313\342\270\211\236\3518fBQ\013\206(jA:\006\tS\025"
+	.ascii	"U?\3577Q\r\352F\203\324\374!k\220\222\310a\376T\265K\177\254"
+	.ascii	";\376\354\254\312j*\226_\333Yu\374\371\203?G\240\216\255\035"
+	.string	"\240%P\245\030V\016\316\322\022V\022\347 \213X\r\260j\375k\326\257\256YMH\337\326\253\177\225\372\327\023zK\212*W\276\362\2476\326\247?\245\261Co\025`\345 \345@\232\301b\254I\0328\300\377\323s!\275\005\317Q\376\340l<\271\252\214\225\306\237\211\2543\376\325\351\327s\\|\360\377\312\244\030V\016\262W\246\302\300\237\006 \025AE\256\034\370U\020\212Tc\213\\\003\002\353\006~\225\002\277Z\201\177\325\200z\304\301\232\201\177\215\361\2570\3765\351_\223\377\315V\227\205\037\222?\035\256\305?\203\335l\212\233\224?\345\200\031(\252\235\336j\362\247\023 \203\344O\223\326\026\377\252\341\327w\354\210\022V\022k\b\267\340\377\275Y\177\376\325\002+\261\002\277\326\362\037\214\227\022H\210\001\026Q\013\342\\{\377J\201_c\341\263N`\225\300\237z\351\300\005\250\343W\357~\325n\215\300\237\226\260\222\340"
+	.ascii	"\r\353W\021\240\226\310\016\370\323\337\n\201\365\003\332A\032"
+	.ascii	"\302\212\001\213S\360\377`\250+\250)BX1`\221\200\365"
+	.string	"\001\035t\3343\370\177M*\2365\277j\307\301\352\200+\377\201?\360F\003r\021\003V\025on\240\212p\263_\360\377t\250\254Z\364\257\f\370\323\252\036k\212?\237\3713\334\237\331\374\251\227z\001\225*\355\342\312j:\376t\307\277.@U\300\257\325\254&T\"+\212\265U\205\377`zi\352\321\377\r\2048\350\260\365\004\374\300\017\300\204Q\307\260\345\001\374\351^\025\360\253Y&\324\270_\337\255\t8\363\353<\353\2119\253\211\236P}\246h\326\024R\f\353\233\252\335\257\242\220\247T\027+\n\275\340\177\016\376\247\370\317b\003\263\177=\341_K\350\255\033\375@\030\356\352!-a%\361\247JV\004\244\314\007~ \373\247M\322(\372\007\276\177\n\266\216\370W\003\374\247;\030 R\366\361\243\026d\257\340J\200\016\253\t\377\301\234\356\177\005?\320\001\177\332u0W\177 \003~\324\002\264\002?j\201\365\303Y"
+	.string	"\001\236\370\321.h\230?\003\177T\f\bh\213u\004}\341GU\370Q\026?\212\342O\277\212\200\036"
+	.string	"\035q\026k\b\377\205P\023\367\360\377P\234\317\272\001\332\301J\364\037\313\263\244\032X|\205\233]\202\377\307\301\257F\375\272\316\n\002\006R\ro\246J5\177:d\005\261\016\255\037\374\352\003V\017~\025J\b+\006\352\330\332\301\237\251\376\365\303\237\266X\001\240\327\3747K\335\256\301\377\313\363\247\356\352\341M3-\367\340\377\033\363\247\030V\016\376\203\351\245\375\357\360\375\377\214\374\371\201\034A\016a\315\340"
+	.string	"\035\322"
+	.ascii	"d\370\177\311?\225\361\374\003\001\360\237\317\272A\322\257\343"
+	.ascii	"V\r~\365\203_\273\255\031\374*\nU\337\340O\225\202\376_\235_"
+	.ascii	"\rQ\302\237\206\260b\360\253\"\374/\263^\220\212 \374\177.\376"
+	.ascii	"\264\356O\351\376\024\317\377\336\017\244\363\253\033~5\202_"
+	.ascii	"\205\340W\205~5\303\257>\360\253\034~U\202_\265`\265\340W{\277"
+	.ascii	"\032\364\253\030\3764\317\277V\360\037\350\017\022\340W\001\360"
+	.ascii	"\257\024\374\353\004\377\332\341_#\370W\241\177\335\360\177\375"
+	.ascii	"\203,\374\353\003\377\212\341_\201\376U\377*\237_\305\373U<\277"
+	.ascii	"j\347W\351~\365\371\253s\277*\367\253m~5\315\257\242\371U\266"
+	.ascii	"_-\363\253c~5\314\257\202\371\325/\277\332\345W\323~u\313\257"
+	.ascii	"f\371\325*\277:\345W\317~U\312\257\222\375*\224_u\362\253F~\265"
+	.ascii	"\310\257z\375*\327\257\356\370U\255_\315\372\325\253_\255\372"
+	.ascii	"U\252_\225\372U\033\277\372\364\2533~\225\003\277\252\201_m\341"
+	.ascii	"W\225~\365\305\257b\340W\223\277z\374\325"
+	.string	"\242_5\376j\213_\255\300\257B\340W\033\360\253,~U\305\257\246\370\325\025~U\205_5\361\253(\374j\211_E\300\257\036\340W\013\360\253&\374j\t\277J\302\257\216\360\253!~\025\204_\035\372\325\017\277\212\301\257Z\360\253\023\374i\236?}\373S\267?5\363\247l\177J\346O\341?\025\363\247j\177\352\374S/\177\312\345O\321\376T\313\237^\371\323*\177\332\374S\263?%\373S\346\237F\371\323'\177\332\344O\227\374\251\221?%\362\247@\376T\371\247\031\370S\257?\355\372S\256?\335\361\247Y\177z\201?e\341O\257\376\264\352O\251\376T\352Oo\374)\215?\225\361\247M\177\272\364\247\034\370S\r\374\251\322\237\276\370S\f\374)\322\237\272\370\323\366O\213\177J\374\323\t\374i\004\376\264\001\177\252\342OW\370S\025\3764\001\177j\342OQ\370S\022\177:\342O\r\360\247\004\370\323\001\374i"
+	.ascii	"\376T\204?\r\361\247 \374\351\320\237z\360\247\037\376\324\303"
+	.ascii	"\237n\360\247\031\374\351\005\177Z\301\237"
+	.string	"N\360\247\021\374)\207?\335\360\247\032\3764\350\327|\376t\370\247\301\377,\376\034\201?\375\375\351\376S\365O\323\377X\376\034\301\237\366\3764\377\250\211?\375\377\025~\364"
+	.ascii	"\377\315\376\363\3715\331\337\253\372\265\230_\377\3705\226_"
+	.ascii	"\347\375z\311\257\357~\235\347\327v~]\347\327s\277\216\363k\271"
+	.ascii	"_\307\375\232\315\257\325\374/\363k\267\377`~\275\365k3\177O"
+	.ascii	"\370\347\270?\217\3713\332\237\215\374_\361\347\"\177\006\362"
+	.ascii	"\347\252?\337\370\263\362\317\022\3703\004\376\374\200?\217\370"
+	.ascii	"\263\210?\207\360\243\306\037m\300\217\262\360\243#~\324\204"
+	.ascii	"\377Z\376g\371\217\342\377\224\377\315\377s\376\233\371\377\241"
+	.ascii	"O\237>}~\r$\374\037\364\371\237l\004TTN\361\322\205\330\312\027"
+	.ascii	"\325S\374\205\003(\266\022\347x\262\302\264\204>9\3058\342\370"
+	.ascii	"+\006\212\237\230p\304V\232T\027\236\254|Q=Y\371\302q\341\311"
+	.ascii	"\n\023\216\247\330+\006zj\002\241\212\233_K\027nXa\302\021[\361"
+	.ascii	"\302q"
+	.string	"!\266\362\205\343)O\230)\022\334\t\373\341\346\305\211\354\r\272\364\344\024KEq1Q\001\275=5\275b\2718F\265\314\210\251\342\2678\276 \216\271\274\250\344\230r\240\316\2467\251&.L^h3\216c\016QM?\274b\247\267%4~{\n\363\212\343\260\246\2438*\216\3438\204\245\346[\\\004}[\002\302\025C\315\210c\b\342f\034G\305\361\022\032\277\305q\274\024\307\361J\305\325\214\343\035@O\314\250\2508\326\022\212\212\271\226\300\314\210\343\254\005\216\023\307\223\225\037^D`\260Xa\3064\232K\350\023\224W\314\214\345\276\250\266\225\245)1T\034\307h\335f\342\260\242\373I\255?\360\300d\311\372#\324\355\037\024\222.d\236Y\177\2045\373g#/M\t\262\226\365G\020\263\177O\250\334\2256V\262\376\bX\232@g\327\226\253\254\1772\310\354\270\303&\353\217@\266\233eq\334\034\252O\216\320"
+	.ascii	"\363c\362\321%&\353\217@d\377\342\337\2274-\034Y\177\204\252"
+	.ascii	"\375\373\366\034u\372\366\370\362\210\234b\246\036?&Z\035\374"
+	.ascii	"\300\365\340\342\2225\237\247\033jYY\177\204\033\373#\314\330"
+	.ascii	"z|w\001\210\341\230|\364\340\361\345\tF\261e\211\213\203\247"
+	.ascii	"\316g\247KV\234X\230\272\247\257N\316q\203I\025\226\247\217\216"
+	.ascii	"oN\211\033%H\262\366\315\261\302<S\022'\353\213\220d\003\371"
+	.ascii	"4\265\272\342\370\340\374\262\232\232\342\254/B\217\355\306'"
+	.ascii	"\207\326\305MPY_\004\032n\3202\315\fZP\244\340|l6\234\236 f\350"
+	.ascii	"\340\336|j\200;t,q\003\367\346s\363y\355\250\302\224\365C0\263"
+	.ascii	"}h|g\262\250\314\330\312z\315\342\026w\361r\346\351\305\207\346"
+	.ascii	"\373\3423\363\221\371\272\370\246\370\256\370\322|U|\\|N\337"
+	.ascii	"\230\317\212O\213\257\315\207\305\007\306'\305\027\306G\305\327"
+	.ascii	"\364\255\371\316|[|c|Y|e>3>2\2762>5\237\030\324\351c\363A\271"
+	.ascii	"O\314\027\3057\345\303\241\336\225\205!I\362\364a\261\365\246"
+	.ascii	"P%\240\312\230\357\211J\006jn\314N\317\235\332\207\310\252E\344"
+	.ascii	"s\202\256u\251kx\362\250vzS\250V\370\261\366\214\343\270\307"
+	.ascii	"\227*\205\351\310J&\236\252\202C\005\365\264\362\261\251Y\252"
+	.ascii	"\016)\253\235\2569O\325\212ku\233\302\361\243\202\232\033\023"
+	.ascii	"\363U\371\256\3604\321\270\230A\315\215\371\330|C|L\210\250t"
+	.ascii	"q\227;O\266\236*\232\217MMS\245\364\246P)\240I\356)\207\307\334"
+	.ascii	"\032\257Mk\225\233\035tPscv\276\251\373\330|T>)&05\317Wee\007"
+	.ascii	"57\246Z\371\330\324\253u\017\036\273.\250\2711;\037\233\257\211"
+	.ascii	"\372\204\232\033\263S\255|l*\026\252\00657f\247\366\360\261\251"
+	.ascii	"f\352\0261Psc\026\3702\267TB\277\256\211jP\207bh\220\372\020"
+	.string	"\304\354\207\220e?\004\261\375\020\212\354\207\340\265D\230\003\255\216O\326\017\001\013\211O\211/\211\357\b\352\3641}F\356\013\342\023rM\344\f\263\b\272f\206\351\313\341\003\202\276i\321b\320\370\230>0t\255\215\t\324#%G\335O?\004\033\373!\310\330\017!\336\027\221g_\204\234\r\364\206jP3\224O\307}@\376\365\206/\313\367cm\023\273\221\221\365\327:\346\274\333\223\365E\244\351\341\363B\235>\037>\036>\037\276\035>.\364MK\211\262.O\037\276\256\325\n}\323\022\3078>\340\222\"\313\263\353\205I\303\005\247\352\213 \333\027\221d\373\266\202LY^\324d}\021A\366Etm\237\026\321}:\362\364\334\320\222\365O\326\006\022ac?D\336\326!\332\354\207h\333\272\211\006\251\276(-g\345\004K\326\017\321e\377\367\335\360\331@\235>\250M\347\353\322\312t!\037\324~\372j\364\246P)"
+	.ascii	"\256\307\323\007\265\326\330s$\314\240J\001\256\353\231\315\246"
+	.ascii	"\340\220\250\372\251\315\r\024\217\254\037\202l\373\234|M;\230"
+	.ascii	">\247]\307\027\353x\372\234|K\253\325\320\251\031/\251L\250\271"
+	.ascii	"11\037\r\337\f\237\f\324\351s\3621}\225\261\316\270\300\311l"
+	.ascii	"n\375\020F\366C\350\330\017\201\265}\361\356\223\275\314\234"
+	.ascii	"i9\263\316\373\355i\252[\222\365CD\355\213\270\263\345\264c\003"
+	.ascii	"\016*\317\307\364\246Pm,?\242\236eux\333n\337\355=\233\017\352"
+	.ascii	"\334z6\036=\233\356_\326\322T\255\2565k\316\240~\210\032\373"
+	.ascii	"!\226\366\211\356\366\211\352\366\211\344\354\023\305\355\023"
+	.ascii	"\251\331'\032\263O\244e\363\371\241#\307\003H\326Q:V\256#k\236"
+	.ascii	"\224\221+\2736ZV\253.)#Wv^x\317/=\317\033P5\236\033\315J\265"
+	.ascii	"j\365\246P\255\020\344\351\331c\365q\307\214\343fT\327jW\026"
+	.ascii	"d%\222\346\271\321\350,{\211\251\310\272C\312\310\225\335zC\355"
+	.ascii	"B\363:\310\210c\257\256\337U\233-p^\326%\033\315:e}\"e\344Jl"
+	.ascii	"\265Qd=\002\347\206c\3538[\263\244\214\\\331m\347~\333p\373\315"
+	.ascii	"\226\333s6\230}f\267\331q\266\233\rg\257\355\270\235f\223\331"
+	.ascii	"j[\315\016\263\333v\231-g\257\331l\266\230\355\266\331\266\231"
+	.ascii	"=\006un4*\336W\032\353S\324\312#G\255wRF\256\354\274v\020\022"
+	.ascii	"fP\371\244\340\266<\327*V\326+\275)T)\374`\333\261{\220\255W"
+	.ascii	"RF\256\354\326\036\353\217\025\b\330\372T\203e\243Y\263\254V"
+	.ascii	"\275)T(\300\255\255=\320\254HVfo\n\325NkB\363\214\343&\232-d"
+	.ascii	"{!a\006\225\002~l\246ME\302\f*\337\r8.\353\222\215f\245\222\325"
+	.ascii	"zMg\n?\332\236\353\0224+\223\265\331\241F\034\003\031[\305\244"
+	.ascii	"\214\\\331\255Q\352V\336\352\264\321\354/?-)#Wvq\334DuT\251s"
+	.ascii	"f\202>Q\326\336]\204~\200\fa\212\313\372D3\366\220\r\326k2Qh"
+	.ascii	"\222zn\331\\6\032\352\334i\337i\333\310>#a\006\325\002\232\242"
+	.ascii	"\236;mk\371\031.\265\207\224\0202v\0374\026\"l=\266>\bi\373h"
+	.ascii	"\034\024\016\350\033\221\0030IC+\213\362\334g\373\310~\322\241"
+	.ascii	"\351I\2055.Q>\346K\013\331\330\230\007\364MK\tg\3313\216\233"
+	.ascii	"\373lK\371\230$b\317}\266\3058\240oDb\246%\r\260\244\276\236"
+	.ascii	"v\373\312\316\262\233\333\312\246\262\253l,{\n\352\334g\333,"
+	.ascii	"\305r\305\016\017\203>\b3\366"
+	.ascii	"A\364\331\007\221g\037\004\235}\020m\366A\244\331\007Qf\037D"
+	.ascii	"\027'By"
+	.string	"\211\316\232\251\254\017\242l\377\337Lv\023\324\271\303v\022!\021H6s\0163l/\331L \037\240\211\272\273\262\353y\211c\347\212\252?\204\267\377\315T\002\314\223\302#O\311N24S\002\005$\353\017\301\355\017\235\331\037\032\263?\344e\377\273\3107\330\323-5\314\320\310z\023!\372.\"\203\bTU\326\034\240A\352\207\262\354\017Q\331@\276\226N\346|d\375\241#?\276z`\3177L\037\337_Kq\322\334\004\341\261\273\270|N\260\266\310\311\372CS<\270|m\312\274\340\331\372\346\352\335\351\022\202\344\352L\013\353K\326\037z\332Zh\030\336\007s\373\250s\347\330YNz\250\270a}g\375!D@\317P\2629\270<Yo\253}\265\231SK2\256\366\254\231\311\333Q\345\253\023\227\206HU\220%^\310\262\376\007o{F/\213S\224-\205:\367\324n\022\022\261\247\266\323\216\352\320\364\0243\375"
+	.ascii	"\300\216\250\271\035\301\270\206\0360Z\377;jCII=\237\262\336"
+	.ascii	"7|g\256\260\330\262\376\007K\366\277k\240\316mc\316\203\217&"
+	.ascii	"UY\377\316~\372\357\313C\342\350\334e\375\357\247o\032Tq\026"
+	.ascii	"\035Y\317X\347p\254\241\222\365?\350\261\267\214\335\224}0\261"
+	.ascii	"\301\221\365?\340\332\377\300\306\376\0072\366\216U\257\034d"
+	.ascii	"PY\337\003={\314*\306\251\212\027f\333\227U\f\222\265+"
+	.string	"\352\214\214\035\235\325\216\030\2745\317j\267\336\255yk\237U\317\312\007u\256{\326;\357m\255h\353\236\025O\232g\0347\323\366\254^t\254O\242\316\310\330\355Y\311\254s\035\232\236\3428\207\232\027uF\306\016M\353\262r\031.]\210c ]\316\"{\326\264\225K\222uLH\007\344\331\004\203\276\007s\366=P\263\377\325\316\327:\024\350\360\370\2225\335oK\324\331\224\254\357\301\230\275\326Y\237pl\304sY\337\203-\373\036\\\211\263\316Y\345\240\316u\356gV72\346:\267\276\255o\3207-\2408\376!\306\\\347\3262\253\0318\263g\034\307\034>|\370\320\273\032#\242g\3537\253\032\364\254\210\352\026uF\006\316\352f\225C\235\353\233\265\215\320\372f\215\273Q\005\311\363\315\272fe\003\246\236\211:#\223\331p\311\221\263\365=(\333\367\340\311>\352\374\234\025\356sF\316dI\311\372\036,\331\367"
+	.string	"l\337\203\256}\017v\354\325m]\203K\203:W\267\025M\017\353\212\332\227\326\367"
+	.string	"\307\276\007Qm\250s5\263\262=\204\be\253\231u\r\211z\027uF\306\016\235\023\307I\227\326\357 n\277\0034\373\035\210\331\357"
+	.string	"m\277\203*{\r\243\025E\246\231\365;h\262W0\253\363sz\315%q\fdk\350\214\032\023c\247\206:W0\027j\306\261\0269\036ek\264~\007Q\373\035\314\330\377\320g\377\203\236\375\257\\\340\320@5e\375\017u;\215Q\r\352?\314\331\377\300f\377\303\231\215z\241A\352\025(\331\313\271gFV\326\377\260e\243\037\314\366?0\331g?V<\262<e\375\017<\366E4Y\237\364\246Pm\264!J\236k\331j\206:W)+\224U\312*\266\222u\250\021\307_Q\206\317(%d\204hvxY\252\216\262\216\375\334@B\303H\232(b\366\001p\266\303V'\271\352\nX\223\260#\373"
+	.string	"\320\261\321&\032\244&Y\225\240px\356jd}"
+	.string	"\330H\002\200\030l5\322kza[C\007\326F\310:\004\370#n\0133\353{X\023\342\201\313~\033\002i|\371\221\226\365=P\331\367\020\266\357a\310\276\207\253\215zp\332\347"
+	.ascii	"\317\272\365\363\226\204\214\227\254\317\201\233\275\356h\313"
+	.ascii	"\021&\343,,\353s\200e\377_\261P\347\232\265\342\310Z\253\326"
+	.ascii	"\253\0165\342\230ik\275\202\302C\267\3144\245\321\353\324j\345"
+	.ascii	"|S\345$\353\325\352_r\232:]vY\237\203\"\373\034`\355s0cg/T\203"
+	.ascii	"\232\001\032\244\242owv\216\341\354o\260f_\320B\203T\375\206"
+	.ascii	"jP\317\005\rR3\231\375@\023\325\240f94H]\373\250yZ\232`\236\262"
+	.ascii	"\346\323S\023\266U&\353o\300e\357Q\361\3241:MTY\177\003*\373"
+	.ascii	"\0338\331\277\r\274\3667\250\332?\r\366\330\251\313^_\276\234"
+	.ascii	"QeM\307\001\350\346\253\214\214\254\257\201\334\276\buNmS\313"
+	.ascii	"\3207-z\315\356\251\316\251fT5@\350\250s\352\027\225\215I\317"
+	.ascii	"\034\225\216ZG}\242NuN]\243\316\251p\252\034\364MK\314\304D\003"
+	.ascii	";Pscv\034>\004\237\310]\211\372\3518B\351\023\223\231'\353k0"
+	.ascii	"e\037e\013\323V\306\206\215\351\\k\363\005\216\372F\225S\335"
+	.ascii	"\240N\265\215\032\007\224\322LS\346\247\257\201\223}\r\222\354"
+	.ascii	"k\320c_\203\033\373M\210\0057f9\372\204\221\302D\243\202)K\243"
+	.ascii	"\272\241N\025\215zF\213/\212\017\261\031\252~\006u\373\031\260"
+	.ascii	"\331\317@m\257\001k\304\311\341\226\3653\300\262\217\2429\321"
+	.ascii	"\230`\2660\305\250a\322\236c\3242*\031\324\251\212Q\325\204|"
+	.ascii	"u\304\236\300\266~\006V\3663\020\333\317\200\311~\006F\3663\340"
+	.ascii	"\332\317 j\0031\320\263\217\201\234\035\364B\203TU\013\226,Q"
+	.ascii	"m\362\262>\006f\366Q\247\232E\305\342"
+	.string	"\244\256\316y\345*\226\177\t\306\035\204enVOY\253g\252\225\377\276\037\2468|\260\254\250U\360X\321\032\313\232\n\020J\231\332U\326\307@m\377G\235\352\024\265\331\214\205\2024\212\220y\222\3651\330\262\177\347_\376\373P'^\242\240e}\f\234\250^\252\017\265,\367\216\340\200K\2235\331\260I\225\006O\326\307@\310&*2\347)d\216\251BQ\303T&\352\0235\212\272Du\242\216\251L\265\t\352T\305\324#W\221\250I\332\224\320)\013b6GDd\016\263\355\207\333\334\323\310\2239\3178\216\201\240L2s\317!\3772\364\305\361\032\231S\025S\301\376\005}\323\022\313\230B\2006\250\2610\241\237.P\2068=\240\217A\323\316MT\203\352\301\316\376\005u\366/\230\333\277 \316\376\005r\373\027\304\355_\260f\377\2024\373\027\234\331\277\200m\377\002.{\265C\203T\341\005e\373\0270\331\277"
+	.ascii	"\310\376\0056\366-\270\243j\255zn\260Q\223\365-@\263\325\034"
+	.ascii	"\026|\331\267\200\312\276\005b{\350\205\006\251\267 \311\276"
+	.ascii	"\005]\373\026D\355!S\225\212\312T7\340\336\250Q*T\037/\261\272"
+	.ascii	"\254\325\033B\273<`\232\262~\005z\366E\330\321\203\266\331\245"
+	.ascii	"w\303%\240\330\251i\212\t\247N\017\307\260\027\307L{\230ql0\337"
+	.ascii	"\350\344=\363\250q:\347I\215\323g\017\007\372\246\245\307\370"
+	.ascii	"<\3438V\343\364M\n\247\327t\246P\345\306s\256\017\035\236Z#\305"
+	.ascii	"K\363\322>j\223J#\335\243\312P\231\324\031\252\223\372\244.\245"
+	.ascii	"|T\033\250S\215\323;O\361\244y\312\344\240\236j\\%\352IT\207"
+	.ascii	"\252\335\311Q\343\324\r\252\326\241)\216\273x\250\\PB\326\354"
+	.ascii	"V\257!Y\216T\240\377T\317\323\273\243j\026\330p\241\215\252G"
+	.ascii	"\326!\210\236\352Q\305\304\370\320\223\365+@\333\231\211jP7@"
+	.ascii	"\203\324W\360d\277\202$\373\025\004\331\257`\307~\005U\373\025"
+	.ascii	"\334\330\257@\306>\005{\366)\230\263O\001\333>\005T6\0344\017"
+	.ascii	"\375\261\203\344\356H\326\247"
+	.string	""
+	.string	"\312>\005J\366)\350\332\177\332&N\247\r\371\222&\3534\356O\313\244k)\233l\307\311R3k\270\255D\256\306Z\326\247\200\nM\252&M\223\276\245n\2503]\223\262=mK\315\260u\321\203\206Fg\213\035\263\227\366/C'\240\370\006\2159\346\2355\351\231\177\351M\241z`\206\033\274g\034\307u\270\330\270\005\365)\200\332\250\027\252A\315\200\006\251\237 o\367\336P\r\252\t)\0315_\223\327\030^\326\027\361eH\233\234T-\315r\346\351\305\f\230TL\032&\035\203:S\265\324\211\226\252\245\\\360\324\340\304\354\322\264\255X\352\247?\001\335\376\004o\373\023\\\331\237"
+	.ascii	"\310\376\004qZ\226;17%Y\247YR&i\2637\205*\001pp\236J\346\260"
+	.ascii	"-\211\363\304\222^I\267\244VR-)\032\352L\263\244S\236RI\2538"
+	.ascii	"\241w\322,)\222\037t\356$\231\313\223%e\312y\306qS\370\203\317"
+	.ascii	"\233\331P\243MT\203*\204\006\251\227`\356L\027IC\033\223\365"
+	.ascii	"%xK\313R\262T\n\352L\315\322(Z\204\330\231\262\261\024\312\320"
+	.ascii	"\t(v\372\341\3064K\233\244P\3207-1\023\216\020\310\302\314=\261"
+	.ascii	"\213\343X\350\303\207\017\3010et<\266\276\004W\366%\200\262/"
+	.ascii	"A\223\235\206\245NP\347\307\244O\212\224Y*\222\365%0\262\225"
+	.ascii	"\3428\216\321\217Q\327\217Q/\301\220}\t~\354K\260\265/\301\324"
+	.ascii	"\276\004L\373\035\370\354w\300\263\377\364\210\221\264J\333\030"
+	.ascii	"S\326\251\221k*^\302\036S\026\232/Y\377)\030\221\341\0225O\317"
+	.ascii	"\254/\"%\222\nA\327\206N\315\030\007\013um\304\304\212\240\316"
+	.ascii	"\224H:\304JnK\2033\247\365;\204\355w@\262\3774H\3325'\316\322"
+	.ascii	"R\326\027\261c\017\023M\253)/G\237\264+\275\262\361t\303\252"
+	.ascii	"\221"
+	.string	"\365\344#\365J{\244_\351\217\224G\n\004u\246]\351\326S.4\217\234\264+\325\261Z\231\273\001\006H\017\321 \365\035\270\366;D\355G\300g?\202\272\375\b\322\354G\020f?\002,\373\021<\331\177j\225V\365\322\276H\321J\251R\034\2503\255J\247\320f\0347\245\342\322\2524j\005\025\236\233X\220L\312\030\033\252~\004C\366#\300\261\017A\237\375\247P\251\023\336\030]\326\027\221w&\316\016\216\035\2729\264;97z\336\300\301K\303\334\223\326H\231\322\2464Nm\2444\322\247tF*#]Jo\240\316\324I\367As\r;r\230u\251\223\346\203\346\231:\351;:\317p\251\031/\251]\232@\311\262\213\343\370\303\207\017+\234\2176t\204\364!\020\263\017\201\225}\b\230\354C0d\037\202\034\373\020,\355s\250\333\347pf\377\032\317u\236\367\236,\240>9}\205e\235\335\210\256\361\310\341"
+	.ascii	"\203\225\3659p\331\347pe\237\003\223}\016^\373\327u\344\270\261"
+	.ascii	"\343b\2275\221\226\243\341l<\325@\235I\003'\025\367\304\224\323"
+	.ascii	"o\364\234\216\243\351h8\372\251\335\3509\2503N<\251-Y\227\215"
+	.ascii	"\221\262\362#\313\243\273\002\246\n\220\271}\b\271s\242\0024"
+	.ascii	"R\325\246\215\214\254\207\315<<\033N\371\260\371f\334\244`\317"
+	.ascii	"\017\212Z\360\263#m\215\211YT3\212\025#C1\261a\3311\030\371\321"
+	.ascii	"i]y\370\207d\037\226\315\220cgM\326\303\261\215\267\345\214M"
+	.ascii	"\326\303(\037c\306\355G\017\t\320\330\377\020\312\257iMW\235"
+	.ascii	"\267\374d\351\203\235\020*Y\017\233\f\303>t\362\241\223<t\322"
+	.ascii	"\353\323G\225\302&\213\312\3447\303\bU\0168K\204RX\240\304\321"
+	.ascii	"2d\002\211\330\265\305\325h\226\305\311\303\224D\350\244\214"
+	.ascii	"\n\236.$A\266\365\fV\223\311\021!\331\221\034szd=5e\304\013\354"
+	.ascii	"\007\027\305\n\023,E~pr^Z\035\033\"?+\275E\007\221\037C\320\274"
+	.ascii	"\0342\360\322\204\340\t\022LRg\f\317\221\254\217:\207@~N\020"
+	.ascii	"@\007\025\344\307\223\0379\257 P_A\037hb\360\246\206>\200y\216"
+	.ascii	"\254\221\373\362\352\241\357\260Ac5\354\372\260\307\237\255P"
+	.ascii	"\2708/tD\262\316U\210>\354\312R\204<\201\361\340\222AuF\306\216"
+	.ascii	"\017\271\376\341\026\352\326{\262@\037%v\240\262\376\241Aj\217"
+	.ascii	"\211\350\303\035NWhI\206:\206Zn\260\234\331\222\365\337\323\362"
+	.ascii	"\241V\357\311\002^\320\\\021\222\365\360jx5\314\342\361#\006"
+	.ascii	"+"
+	.string	"\357\312No\361Z\213\207X\037f\t\341\250\322\256\240\361\341\215\021\023\026'\353G\300\316\260jX5tB\315\2155\031\273\323f8c8cH\325\226\243\t\335OZ\034%K\206S\037R\211\241\261\202\312zxc(\365\337\207Vmy\2523\224\032F\335!\263u\344+8D\315\331\215\254\207P>\036v\346d\301\222\365\320\306\360\215\035\327\223a\r;`\304\334\2065\206O?\035X2\2728\377eHc\n3\216c\240 \034;]\264d\375\b4\331\217\300\226\260\217\260\317\320I\214\024Y\336:\225\266\366c\330\364\241\323\332J\025D\207\231!S\332\245\016\224\272!\323p\311\027;\245\264\226\240a\224xI\311z\030\373\214\334\250\013\213\342\303\347g\00657\246\331\2424ie\375\b0\331\331\t\361\264r$q\353Ei\231\302Dxw!\236\360\r3O\023=t[\240\362\350\361q\235\241\262\207L\326\207"
+	.ascii	"\025<x\206g\240\346\306\264\0303P\252\262>\004\222\330\261\303"
+	.ascii	"\344\211\030\026<\bx\321\235\016\350\206R\211\247X\360\302s["
+	.ascii	"\252\0025\227\365!\360\364|\376\254~kXL\304\364\276@\021\223"
+	.ascii	"&\353?\240\016\016\034\341\234Z\016!d\354v\225\224\270j\316\205"
+	.ascii	"s?)<'W\204r\306\234\301\311\021\306\231\022\345\211\026a\234"
+	.ascii	"\364\216\231\021%\0170\223\223cf\271\311f\244\276\200\311\372"
+	.ascii	"\017@\242F\215\260\215\220\327\022\236\037'V\336\225\335\317"
+	.ascii	"\335\\\231\215\270\013\333\3446vA\360\262\026\262\361\341\255"
+	.ascii	":\230\212,\3019\001b$,k\341\232\2372wz8\263\376\003|\354?\240"
+	.ascii	"*M\032!\232\274<d\300\260\262\376\003\226\314\230\021\242Y\363"
+	.ascii	"\246\276\302\326/<\230Qg.D\223\301\306|y\363\331\305\371\272"
+	.ascii	"\261\206\016\033\333\236\254<n>\263\032Xi\262\276\003\320\312"
+	.ascii	"\224Y\253\262\360\230b=)Ne\270d}\007\\\215\031\363\263Z\355\262"
+	.ascii	"\362\270\211\365\316\360\340\272\262~\003\336\302\204\021\222"
+	.ascii	"\255\351\235\231\262\325&\3537`\013\0300\032\302\260\3328\355"
+	.ascii	"~\354t\351S&\3537`\310\227/B26&pbbMVy\262~\003\250\204]\204]"
+	.ascii	"\200L\267\013tU\306\304IK\373\221\231a\265q\n\24381c\226\365"
+	.ascii	"Y(\263e\313\234(\314)\\au\266\\\271\"\314R\346\013NL,C5\305\231"
+	.ascii	"\301ra\226\031\\\254,\361\335\231B\344\207\221\254\317B\223*"
+	.ascii	"U\204d(\225x\nMC\005N\3147\266G\313L\326g\341k\312\224\237\225"
+	.ascii	"\220\327\022\236\365*\313\215\230\035*K\226d}\026l\234\235\255"
+	.ascii	"]Yn\304\354\202L\304\204\331\312\372,\312\b\245\b\245\374\310"
+	.ascii	"\256\246~\250u\245\t\023\306%J\024!\231\220\327\022\236an\"W"
+	.ascii	"\247\314\330\205d\272\210\034\2548g6\252\302@\021B\021B\031\256"
+	.ascii	"A\315\215\331\201\t\343\243+\353\263\260Bra\023$B'Ar\204\342"
+	.ascii	"&\247\270\213k]\222u\206\307.~\342\362\220\256]\305\205]\350"
+	.ascii	"\344c~\266\202\340p"
+	.ascii	"\022.\271\220\311\357[\335\304\231\251\333B%\0272\177_\272e\025"
+	.ascii	"',\353\257\230\333\2770\311\357\013\0229\343F\227\365W\310\355"
+	.ascii	"\257`c\304\b\220\210V\026\223'b?h[\260P\311\372+\300|}\t\213"
+	.ascii	"\b\361a\002'f\367CG\207\230\027\"\027\026Q#\246\205O\326\302"
+	.ascii	"\037\302!\333\371\246M\315\020!\251\034\226T\022 \302 B'\346"
+	.ascii	"H)\223\365WX\331B \275\2666$ku+\236\b\273\204]B\257\241\035\250"
+	.ascii	"\27115\314\334V\227\260\307\205^\332\314N\031\031c\376\3734\026"
+	.ascii	"\03024C\270\270\226YJ\306\212a"
+	.string	"\304\304\311\372+\270v\354Hj\232{\"\246\342\371\032C&\353\257p\322\3222\303\212\203gH\366\206\311\234\254\257\202N\230%\314r\342\254k\263\373\341\200{\222\225\365U\204\021^\t\2578\224Q\203\023K\253\250\364\260\223\365U4\205U\302*\003P\241s'\266\306\021ccJ\326W\021&\244\022R\375\324\260\230\210\371]99\003\225\365U\374\020B\t\241\204R(\225xj\245\312b\362D,\357\250s\003\023F](\365\313\233Q'\215\356\277\017\0048F\222d}\025NB\033B\033p\226\2221\261\236\016&h<\322\b\237\204O?+\024\250\331\004'|\322\305\243\231\365\031\340\024\306\217\2053P*\361\224\b80*1`\326\23614B\031\027\316H\3114c\260\254\205N>9Q\250\260\320\262\376\035a\323\177\337O^\030\037Q\262\376\205MB\246!\231\2566lB&\341\022\007=g\313\307Y\326g"
+	.string	"\331>\003\300\362\362\306\230*XS\363G\326g\200\216={~VbL\355$\016\225\267\254\317"
+	.string	"\032ww?+!<YC\270\3542\026:3D\262~\n2vvcS_a\275#pq\231\254\237\342J]]\020\217z\225\365\203\031<\273[#\345\316\203x\202vR\344\250SG\265\203\325\007\217\231-n\336d\375\005\260\231\233\013\322\331\201\201\tV\336\325\017W\024\215.t\320<#Sf\370\310\372\013\020\"'\027\224#\344\265D\347a\f\025\236\233\217\214\033T\0219q~[L.dY\007\341\004\373\270\201;\313\372\013\300\n\276\341\323\246\315\223\251\2570\273\364I\025\230+Y\177\2058l\330\374\234\by-\335\001\266M\375P\263s\022\265\226\365W(\363\366\026\\#\344\265\204G\025\233\372\n\373i\235\361\"\247\346\3015h\0375W\316\304\375\367\005\233|\311\250\253b\306L\320M\310k\251\016"
+	.ascii	"\250\260\340\230\351!wR\340\270\005\321\350\321\341\305'\353"
+	.ascii	"\340\031c\220,b\262\376\nc\373+4Y[\013\262%Q\313\246\276\302"
+	.ascii	"\354\240\260\304\204\005\331\376\020\"\370\342\346\334\322\264"
+	.ascii	"\361 CF\004+0*\261\236\2315{\330\262\376\nRb\304\374\310\204"
+	.ascii	"\244|\321\271K\321d\t\013\313\372+\310PS\3739\021\332\261\224"
+	.ascii	" ;\236?k\340\272\330\3219\235+\230\344\265\211\005\271\334b\267"
+	.ascii	"\254\217\242\215\027/\004\240B\347.\230c\306\224\256\254\217"
+	.ascii	"\242\r\r-\310\205C\031V\034<vZ\n\316\234\273\264\007\271|\310"
+	.ascii	"v\344\311\021\337\232\2514@\306\262>\n0-Z\200lB^Ku<\354\301\202"
+	.ascii	"cf\267s4\211R#\353\243x\302\202%\303\230&\236\233\035:\205\b"
+	.ascii	"\035/Y_\205:V\254\374\254\336s\212\273\2720\365\0244jb6T\250"
+	.ascii	"\374\2548Pa\265q\332\215A\223\301\346\254\331\3749Q\317`\231"
+	.ascii	"\211\255kM\230O\300\314\314\202I~mXL\304\364\214d}\201\313\372"
+	.ascii	"*\324(+\033\266A\315\215\3452cv\332\320\031\033k\3032\023\323"
+	.ascii	"zzD\271\312\372\nh\"&\226\20556'\2361GOXX\360\t"
+	.string	"J%\236\372UM}\205\215\325h\323#\350\344\301'w\256\274\231\255\375\367\251nS{\356\3520a\242\356\300zB\006\3104\027\246\347\t\223\371s\202R\211\247\002\020\327y\350Y-\271\271\313\372\t8\022<\022<\022L\"\344\265t\347W\206\305D\214]\034ky\030\302\t\261q\003\311\203I~\232\234\034\351\222\346\277O(6'NG\326O@\034\f\022\f\022\004\373Q)@\206\333\023\257L\227(E\202G\362\246r4\265\236\272\230\345 \221\340\220\340\207::\326\202C\202B\310\256\204\034i\372\300\3409\301j\363\343G\220\266`S.J\326?\241e\377A\257\240W\320Gv\306TZ\035\354)mz\270d\237\030\022\253!Y\377\004\021=\0172\251H\324$\250\023\250'\330\245R1\343\"Q\200m\275\230\211cH\326<\232Ln\332\260e\375\023[\373hYS\320I\3163(#\316S\320\006\372F\344"
+	.string	"O\322\254k+\227\016MO&\312\340<\343\270\031\314\nB\005\255\274\330=\203YA9\255 Wp+\250#\210\025\314\021\334\201:\203Y\301\033D\301\254\340\2147?v\310\262\344"
+	.string	"\322\301\246\317\351\320\364d\302l\356\031\254\n^\241\316\240\325\203V\333)\210\343K"
+	.string	"nX`]\034>\b\351\330\310m\251\372\017\342\bR\r\2714\207\324e\035\234Z\265r\230\221\221\365M\340\355?\030\205:\203R\373\216\030\030\274\317)\003\366\343\316\276\t\271`\215\035\367\344\261f\337\204\333\276\2112\373&\324\366Mt\331\177\320i\345b\245\315\216[\3267\261e\003\373\004\227~\306\234B\322\262~0\376\357[\001,MZ\326:/\233Q\302\214\312\372@>C\271$[\246d}\340\236\264>vtd\r\304\3333L\220q\360\343\341\245\307\326\335\201x?\020.\327h\241\017\237<Yk,D\007\336\001\335\310<\317\262\276\t\035\373h\024\024\270\346@:\3005\300<iS\374\205\006t\343\352@\333\200\303\004$k<M+a\230=\250\262~\ny\373?\320\016\260\016u\002\357"
+	.string	"\353X\001\336\001\322\211"
+	.string	"\336\001>\363\256\3720\355\3720)\313\242\352\247\340e?\205&\373)\350\330\3008\3009\300\271\337\347\013\003\005\307\225\365S\300\261\017\224\363\337\367#\262\006\211\223\2543\3721*\360\315\201p~\337ZF\345\264%\353\247"
+	.string	"\265\017t\003\224\373}=>g\302\324\310\372)8\355\003\333\374\367u \216\217(Y\003\343\366\f\024\356p\340\203Ce\216\0216\007\366\236,"
+	.string	"\265\245E'k \034\321\201l\262\022-f\314d-D\203\324\243\300\345\355\355\347\344(\025\323\bTA\037rlk\236\240A\003t\313\261W\0343\32756\274g\020\213W\033\247\233pM\325\2338\210\0313\300(g4\231\246\032g\262>\n9\326\326\200l\331K\216\355\315\263m\353\256I\326@6\037\227\226C\246\317\236\254\217B\023\0312?'j\"\304\266\264\255\251e\375\023\344\304\210\371\221\3458\216c\346z\206-\352\031kiyP\253\314\244\225e\375\023\332\324\324\366pa\272\331\221\365O\350\342t\376\302\240\346\306\322;\265/7Y\377\204\261\375\003\275x\321\362\243;\301\b\027.?'t \334\322;\036z\300d\375\023\266\320\320\350@p\311\020re&\353\237"
+	.ascii	"\225\005\210\005\250\305\307\205\306U1Z#l\214\224\247\236\375"
+	.ascii	"\022l\200W\200W~dk>\340Q\242\226\347G\326/\241\205J\225\254\022"
+	.ascii	"H\366KP\355\037\330\0046\325(\"\247\030\210\024U\fJ\310\332\217"
+	.ascii	"\214\023\0201Y\237\004\036)\177\b\021\200e@3\364l\307\314\270"
+	.ascii	")n\251\204*\271}\022kdd"
+	.string	"?\262\003\251\t@\236OJ\334\233x\213\230\0300\312Q\2528L*O\314Nx\005\314\2253\007F\301C\246kO\326'\361\304\311\235"
+	.string	"\237\240\025\30413n\202\303\001\"K*O\314\016e\232\301\002\363D\r\370\006\207\230\224\254Ob\307\376\201M\232\240g \304MpS@0I\320"
+	.string	"\"\001.\001\"\0012\223$\0012\017\304\004\202\fZuE\316\216\222\003\231\276\2743Pv \200\317>\002\344\200\201\001\215T\020\307\361\214X\351\r\212\216'\025\252\"RY\003\215\324\355/w\2748\303\b\021\002$r 5CT?5O\304H\rA\235@\")\231Z3G\330\327\027\020\310Q\252\030L\007]\031J\0354K\262\376\201?\016\004\"\034\243\343\311V\326\277\203\252\375\367\245?\360\310\371\222\365\021"
+	.string	"d\377@/\324\t\364J\343Lx\305U\002\030\303\004'\306v\267\225&\353#\200\253\253\013=C\233\361\024\220y\007\344\342B\317z\\#\334\366\017\324\002j\001wx\360\212\253@\340\303\004'\226\217\244a^\311\032\250#\rM\2250Y\177\204\332\376\210)\300,`\326\006\314\021G6\360\nx\025\017\355\350\2554\250\260\254?B\253\252\312\307\245\2331\016`\227T\236\230\330\210\230\212\312\307\245\201b\247 ]\230l\366\201P(PJ\n\250\265e\037\365q\251?\260\006\352\004\326"
+	.string	"\3360\341\025[y(S7\367\304W\243\r\222.Y\003m\350lv5\303,\353\037"
+	.string	"\312\376\001\230\373\007\322"
+	.string	"\322@\325zNq\027\221\325.\375R%\307\222\254\177\200 \373\035\240@\0312>\006\245\332Yd\234=\017"
+	.string	"\265\177`S\223\217\253\310\357\356"
+	.string	"M\373\277>(p\t\270\364\233\222\002\0243\300s\037\375M\251\357"
+	.string	"\375\345\345}\214/\216\277\270\200Uq\0077"
+	.string	"\233\273\337\236;<<\n\270\2548\221\324e}\003\240\3317\300\227mg\367s\202\306\361\235\241\330\214!2\234Y\337"
+	.string	"du\277;u?<x\354\330\371\221\321\205 \363\303\205K\025+Y\337"
+	.string	"F\366\rpE\347W\207\316\363\371\263:\020\223\032\016\230\240uE\372|\311\372\005\230\263_\200\2639s|\\\2768\376*\002\244*@\0227\2778n~p\344\344~p\"p[\275\324X\202\226\365\017N\017\f\325\2336o\376\373\200jSeaY\277"
+	.string	"C\366\013\240c\377\277\270?\345B\363\240\316_\334/*\005\032\307^\202D=S=4\276\242d\375\0024\251Q\363\203\023\362bb2!L\023\317\355w\246\245\253\317oM\226#dqY\237"
+	.string	"v\366\t\360\346\366\207\020\341G\346\227\006=;@S\034w\211\0051i\333'\200\332\2313\\?<\004\210\262\266\366kC\251\304K@:VP\262\316\374\2501\226\365\217\r\r\322q\232C$\353\023"
+	.string	"l\237"
+	.string	"Yb~d\304\374\254\3248F\233^ST\261\026\225\2071c~VhL\025\307Z\361\022\036\fb\264<\f\303$\021R\225\365\t\320\264o\302\033\247\363\247f\302\213\251I\006M\232\200QQ\331\211A\311\372\007F\253\\h\264\324d}\023\326\366M\240\342\305\013z&\344\265T\007\004\272)8\261!\026\264*VY\337\004 \\\270|\2502!\n\ru\376\320\3205\023^LU\032\214\371\202\023\033r\321\210\302\313\372\003\300\323\242E\233\361\340\305\364U\301s\212\214\311\222\261+MY\177"
+	.string	"w\366\377\273\362\037\225\037\026tm/Q\305NC\252:\020kv\360\001\240\331\037@\225*U*\240\233\"c\242\371\320iS$\353\017\240\307\224)\035t\r"
+	.string	"\352\354\354w#S\211\227\030\360\225\327&\026\307Z\035\004\251\300\321\203\246G\212\224_\r!\257\270\212\004(tt\356R6\247\262<Y\277\2046Q\242\374\310\324\206\314~c\377\221}nX6\346\251'\353\337\361q\375\367\021\307\200\331e\375\022\306@\201\362s\262\3438^j\306S?TRybb%L\t\013\37399P\034\307Mq\334\305\005\264\373\317\311\331\222&?\240\262~\tM\366\377c\342\3741\321aBT\342\252\037%U\240d\365\274T\261\343%\353\227\340c\377?\346Q\347\217\371k\022\362\212\255<8\243\302s\323\3170cq\326/\241F\222$yK\032\307^:~mZ\035\254h\272\030\371\222\365KX\332\377\357\210\363w\344\267\224\251\304K?]\234um{M^\r<Y_"
+	.string	"v\373\377\201\201\241y\251S\354UD\315\333?\326\272dd}\001\310\355\377G\344\250\363G$O1\341\305\264\204\004'O<\267\265\216\251\316V\326\027\200\233\020!\037\302\004\340\004\002d\207:\244\211\031%\353\013"
+	.string	"\311\327\027z&\024/\325\341@K*OL,H\035\224[\326\027"
+	.string	"\r//.\037XV\034f\326'\001\316\376\217\013\375u9\177]h^\212\330\251\311\007\007]\251\026\026\2211\373(\232\247\376\277\255\243\316\337\326o\206\t\257\270\312\203%M\272,\241\234-\246\"Y\237\204+\033\275\202bA\235?\035h\026\237S\314\324\245\322M\375PS\233\364\210\023%\353\223"
+	.string	"\266\377_\216\034\250\232\220\327\022\235\005TS_avq\274\326\301\017\236'<\214d\375"
+	.string	"\344\355\243g\350\017\313\371\303B\317zq\334\005\206\203,\252\265\016\200yv\240A\223\365\003\260f\377G\365\303\361_\325\177U?+\024\204\270\t\016\f\007tRybv\261\026\225\207\377wP\347\317*]\023\226\004-\353\007"
+	.string	"\311\376\217>\377j\314D\025\307qU\332\214\251\232\202\352\217\036MQ\324\303/D{\350\005\377u\034\017@\216\005\342\230\307\235g\034\307\250\235\335\344\013\323V\005\361\377\177C\034\3078\236\234\342%\364\311\312\027\216'+_T\027\236\316|\341\210\235p\2109}y\241ON_\001Fn\0212IBi\271}\301a\260\350C\272\354\322\347\342eY\300\255\021\006#\244K\364"
+	.ascii	"f\223\307\242\364\350MJ\261A\370\243\241\326\005[D\374`l\223"
+	.ascii	"\332$\006\264.\330\242\f,\214l\253\242-\""
+	.string	"\333\243\273B\370nx[c\022E\206\037\r\261\304\027F\266H\360\233t\001\343\210\f-\020Ld\341c[\242Era\240\213\227e\321.\207@\306\013/\274\\\321\276l{lUd\360\243!8\350GCD\345\213\004B\371\"\275\3602\231\242\205\331b\362x\034\261B\371\"=pd]\330E\236XQ\\Z0\342\001\024\220#^%\025\031\2640\253\342\350m\227E\255\212b\220\321U\n5 -[\370\004\334\2560\272J\240\r?\032\002a\204t\227I\330E&Q\274'\332\"\366=\272lQ\206\023+V\250\370e0B\272Hd\222\212\024\226.\n\257\213\301\217\206^#\244\273\204\337\r0\222\313#8\211\\\213\330\366\250\341\027\231,\246oQQ\357U\266-\002\034\200\001V\226haV\305\333b\304\253$\266H\311#\342\212\024)lX\261\200\266]\026\031\331\326\0042\351\"\227-\314&1 \t\311\235"
+	.string	"v\221'X$\227\305\021FW\211\301\b\351:\300\330*\271(\274.\020\350GC \222\356\206\026\305\242\007\220\013xa\026~\205G\257\213tQH\312"
+	.ascii	"t\201-\272F\244\373\202H\272G/{D\301\330\252`\204t\221K\026\306"
+	.ascii	"\217\361u\201~4\004\242\303{\242-\002\372\321P\004\307d1\t'\227"
+	.ascii	")\334\007~4\264l\217I\306\366\250\370Z"
+	.string	"`d\223*\264#\340\326(\202\226\b\264\341\302\221E\032\271+\214\220\356\013\267-\266*\336\023J\313 dR\020L|Q\270\307\243\213d\244a\330\036[\260,\224\\\244\275l\225\\\024\257\213\341M\276X\266+\336\026v\2270\200?\032j\213\354\022&\202(\026M\340b\311\242h\213\354\222\005\320\217\206Z$\027~\223\313\242\213\244.\223(\274.\212\356\313\302\353>\300B"
+	.string	"n\337vil\221m\213\200\2275Q,\262\031`d\373\266\313\024Fd\222\0042\351\276n\005?\032B&]\366\202b\221\025\372\321\320\262\205[\244\344\222mAAr\311\266\340\260\376hH\202\026n\217J\244$\211\023\357\313*\221\222\305\016\360\221\221\273T\262\360\272>c\022\351\204\006\234`Ab\004\361\204\022\013@A$\241\202\270\342\304\205\327\230Da|\223\034b(\223$$\240"
+	.string	"V\2020R\026\221I("
+	.string	"\323\227h\244\f\302D\244\2212E\032){G\260\021\262=\252m\013\356\253c(\223E\275\204\225\275\013c,\341\3275jUX"
+	.string	"\377(\351\310\276x\211\020\0249\030\333\325\330\276I\372]\317\302\254\221h\244\034\032.\227I\022G%R\313\302H\351\241}]\r@,^W\250\002\334\032\005\241\360\272\020\030!]\027/\013\013\203HId[\242\305`\204t\215\3106\205r\030\303\310\266*Rp\361\262\360\020\003\321\220\022\251e\221\\\306H\001~\331c\206\367xL\246\210"
+	.ascii	"\202\020C1\226p\213\324\036[\026\3602\231\242\003\t\016B\021"
+	.ascii	"C\310\005 \340\347m\215I\024\303\021\257\213\341m1\"\002\343"
+	.ascii	"{\2425&\221\226.\213\301\247\244\002\250xd\213B\023\274K\366"
+	.ascii	"\307U\2561\216\356\222]&\225H-\013\013\214.\212\355\021\t\030"
+	.ascii	"h\331\0363\004\275,lxY0\2660{LBJ*\026GD\360\262P\202\005\004"
+	.ascii	"\260\3723\216\200_\366(\004\217\330\030\220\226#\222,\214\220"
+	.ascii	"n\214%\f\034\021c\t\013Uh_\026\220l1\350\007\351\262(\\\274,"
+	.ascii	"\374\300\006\311\024\310$\211\243\017X"
+	.string	"\300/{\004R\205\032\340\2404\204!%\025F\366h=z\331%\211e\013\027\215X\266/\026\240t\217EBp\020\006\020\206\340%\253\034z\223`\026^\301\001\326\360\243!\367X\004\341\036\213\356\261\270\276m\213\244\025F7\305\003F7\305\205t\003\bC-\222\313B\311\341GCFI-Z#\b\343\321Mj\321\032\223(|,,\223p\022\005\006\f*\\\274,\213\026I/\0202il\333\025\212E6\310\b\371\272\302\0240\262].\223\212\0276 \255\373\307\210d\221\220\222$\212K\237\361\2304a\304\242\020\"%\227)N8!\t\267/\330\025\027\264\310d\t\030\331\"\265\313\244\227mQh\320a\204\021\262\230\001\251\205\337\030+~\224\226K\225\330\"\27102i\t\242X\0044\266H\313\021\305\342\210\b\256\001y\242\205Y\2432i\202\027\335e\213l\215\366C\030\341\203\021HPZOB\t \224"
+	.ascii	"\202z\022J \"*a\004\242\375\021\210z-1\003\f\3030L|\227\3551"
+	.ascii	"\351\204\326\230\004\2730\314j\200\223\313\030F\272%\032O\270"
+	.ascii	"xYx\033\223(.\264\304\327=\272-Xx\205\321Unh\211\312\266m\021"
+	.ascii	"\204Q\030\266D\025%Z\342k\304\036Q(\221\241%\306(\"[\230="
+	.string	"\016[\242\361\204R\262\305\372\252op\330\"\271\2602\231TaXD\242\304\210\r\377^\242\021\322Uad\333#}tYX\277\310\244m\204tU\374`#\244\273$\026\215l\357%\356\227\205\026\311\205\325w\205\221II\022F \362\004$\214\244q\003\021l\204t\221.\213\324\252x\333c1F\361\347%\222@Jz{0\222\210\324{\211/Z#\374\256(P\2540\036\223D$u\005\214\026IDR\227\354\213^\013\367GC\032\030\225\370!\256?\032\202\213IK\370\r\361\022\225Z8\t\351\202\213b\362H$\252\304u\331\"a$\211\304\365]\266o\022\222H\334F\244\353\202HT_\244\253|\211\304\025\231t_\367\330\022\211>\230\b\277\356\021\350GCo\253\214\001\177`l\227\354\321\373\001\210\027v[\200HB\032}\240\224\204t\217\037\2040\002q\004\022\224@\264\306\244c\021\351\202X\276I \004"
+	.ascii	"+\265\310#\213\\\032\331vy\004+\211\304\rD\025~\335#\221\250"
+	.ascii	"\2620k$\022\325\266\005\367%\022U\027\305\344Q\303.\362\004\354"
+	.ascii	"\"]\rH\024\214l\273T\227p\212\"2\t\005\026fK\030\331VEr\031#"
+	.ascii	"\005\016H\024\204?\032ra\245v\331\036\215H\326\204\013+\265A"
+	.ascii	"0\262(\277\304b\253\202\204\013+\265\027\\X\251\325\260\321r"
+	.ascii	"\204\213\"\333\342xd\213\300\027Vj\2010\261\304\233\324\002\370"
+	.ascii	"&\265\350\275DW\271\002Vjw\n\023\027pB#\335\024\310\267\250\266"
+	.ascii	"F\306\023\214\220\256\221m\217@W\371\366^\"\211\020'`\245v\027"
+	.ascii	"C\270\275\037\r\275I-8\274D\024\260R+|\337vi4\262k\373\202=\256"
+	.ascii	"HR\"\355$b\253\214\301\342Mj\341SbQ\324\226h\2251X\300.\362\004"
+	.ascii	"q\004\212\022??\032R\201\305\211\025 \340\326h\311\302\360\333"
+	.ascii	"\302ZI\005\354\"]u\004\212\022\355\233\244\026%!@\tN\213\222"
+	.ascii	"\020\240\264L\323\344\262\215@r"
+	.string	"\031\303h\223(1\342MJ\272/\332e\n\f0X\025$J\374\332e\022\314.[%R\013\003\341\037\r%)\221\210\311e\f\243b\221m\211*@\020\001\204\021\222\224HAo\273\374\275\304\f-1I\211\004T\341c\322\333\252hK$)\2210\264D\244\221{d\211C\244\221{\034Al\301\204\002Z\230U\321\022\205'R\254h\215I\0241\214\254\321\267|\213\210E\312c\260Hy$\266p\344\"\204\b\342\021\206W\231\\\226pK$)\221~\214X\026.\254t\002\214<\221\244D\022\266\304a\273da\030\227A\370GC\357\021\314\"!\241/QY\024\244\344.a\026\3050\271\214a\004d\324\252`a\266D\261\310\376^\254!\200\360K|\321\226x\321\226X\001\203]\0063\034\205\032\340\037\r%\2271\214@\274\313\344\213l_\021\300\020\"`\3450\211\250Br\031\303(\b~\211@\"X9\274"
+	.string	"\273@_\"0%ja\026~a\3450\304\220\210h\t\247"
+	.ascii	"\202_\342F\242\020\343\250T\216\b\202\1774\004\002\231DB\202"
+	.ascii	"\217\214\334\026\206\372\022\215l\022\006\334\026C\020Zd\242"
+	.ascii	"\0269D\213L\304\346\020l&R\312!\2242Q\214\034\"F\016\021l\301"
+	.ascii	"D\013\263*V\024\213\354O\373\262\220d\221\\\3060\362\265\306"
+	.ascii	"$\nd\322\205\213-\234\\\246X\300\313\232H.c\030q0B\272F)\034"
+	.ascii	"\331\244\022\355\233\224\001&*\265F\244K|\213.\022\213\214a$"
+	.ascii	"\276\256\322\b\243\244\026m\211\3442\206\221\020\205 \322UbQ"
+	.ascii	"\370\222J\245\023\332\027\313$\022EJ\025\2201\214?.^\026\305"
+	.ascii	"\353*\215\200\221<\026-\333\027I \370GC\031$\225J'\370Z\230U"
+	.ascii	"\021D\202\321E\261<\202W\022\222J\245\023\226G\360~\213\313\245"
+	.ascii	"\372\2660\273LY%\274]\260\355\262\005\221U\302\017\374Zc\022"
+	.ascii	"\005\253\204\327\244R\351\204\242\212\267\205Y\025.\212n\022"
+	.ascii	"\006\200`\244\244\025\275\327U\032at\225B\243\253\004\"%\221"
+	.ascii	"\255\221"
+	.string	"\370\276m1\271T\022\215\256\362\0022\351\302\310\366E\273TBPA\013\263\255\221XT\224l]\26001\006\013\203E&-1x\211,\314\226@&]8\351\230\\\361*\215.\300?\032z\225F \222.\022\t\370\310\246/\261\230T\341U\032\ta\366\330[\221\311c\357\350x\354\031E\030\333V\371\256\306\266U\256"
+	.ascii	"\266\3572)I\302\210LJ.\215\202\312\244\361H\303\354\n\244$\244"
+	.ascii	"\372\243\241\267\2505\022\001\360\302\310\366\305\tFI\0256 \223"
+	.ascii	"/\333.\325\022\"\200`$\217\303##\367\350\307(\342\310.\341\244"
+	.ascii	"\026\351#\032E\004\301H\036\201GF\356\021\321(\"h\024al\337\037"
+	.ascii	"v\210\264d\211\360\273t\213\210\310$\361\250\001i\311\276\256"
+	.ascii	"\361\302\217\206\"@j\3417\306;Tj\215\310\023?*\332\027.\\d/\264"
+	.ascii	"\306$\322\357-\272\360\353\342e\341\237\243\"\354\302X\361&S"
+	.ascii	"\214\320\302\354R\203\213b\362XLR\026\205-\222\313\242-\262\313"
+	.ascii	"\024\220\013X\2660\222\312\007\226\255[\344\302\310\326x\302"
+	.ascii	"\270d\223-~Z8B\321\276Gj\013\263\360\ndR\021\203\021\322EZ\216"
+	.ascii	"pQt\341\025\355\261\005\213l/"
+	.string	"\374h\210\202d\013\027E\366\330\002\250=*\221\330\027\330\026\335\027\255Q5\266\307\026\354\353\032\211\257\361\330\272E\031Zc\022I\277A$\213TT\224tDtQL\036[\b\337e\022.\272\306v\251$\266/\\X\311\032\331\240\027\351\007I\271l\211\3552\tV\262Ebr\031\303\350\302\217\206\336\b\204\360\217\206\220`(A\274\313\366\205\2734V\360\252/\332\022\3571)\305\262\205\221-\t\240\026fU \301H\021|\321\032{\030h\227E\030\222/\226\355K4\266HK\026\231Dt\227\360\005\022\360\222\205W\030!]\024$\370\321\020\004\302\326\230D\341{a\2601\202\224\033\224\356\261h\331*\271H\277\227\230\302\350*\203-\034\021\337\227U\302H\036\2110\330\030C\242\026\216\216\212p\022\211\001\376\321\220\321U\242\200\276\304\"\243\253TS\240'\320\022\250\321U\366\210`\244\233L\241L2\"]\007l"
+	.ascii	"\302`!\220\264\302\350*\207H\027\005<\302\350*\201\340b[T\004"
+	.ascii	"/[\245RK\204\217.LD&[p\227\311#\241\326\230D\021\003v_\260\313"
+	.ascii	"\024\\\030\311\376<\200t\331\024\226I\230]\266\031T\300`c\\8"
+	.ascii	"\266\305\342\210\026f\227C\243\021\020,\324\"\271\360/\006{l"
+	.ascii	"\215\300\fA0\330\030\304\237_\013G\304\242\013\263\360K\f\221"
+	.ascii	"!\306\262"
+	.string	"}\221,\266K\342\321\313.\213\303\241\00689l\2251` \027h\204d\2056 ]\326\350\302\213D4\262\355\021\353\"\231<\022\227-\322e\22701\271,\262\034\220.k\004ta\303\333\202\305\320*c\300\304\020?-\034\021\221n\013GD%\026ICkL\242@\266\305e\233\202E\007\330ErU\330\200t\331\024T,[##w\311\002F\362x\034qTD&\261\307\t\210\355\233\204A\211=\266K\"\f6\306\322\250\205\221n\206\026\334%\333\"]\025\3407iy\004\007\245H\2275\372\265E$\373\302\310\032\205p\222\022NJ\022\227I8\211\204\001F&%\213\304\343\261-\0227\300\310Vh\311\036\025u\213\304\256\320\036\335\242\344R\tDR\002)\335\237\366e\333e\021\351\266G\243KD\3060j@&]\330}\221\354\022~\300\b\351\032\261\313\366\005\253a\331\302\260{\001\016\360\233L\266\270"
+	.string	"\273H\356\221\330\302\354\222\250\304\"A\220T*\265Dd\f#\221\250Hy\fj\213\354\222xl_\264\307\037d\322\205\331\027\331*\221\222E\242\021\373\022a\266\305\013\r\257\321UfxY\244\016\307cr\031\201{\001C\322\205\331%\021\351\"\0315 ]\326(\202\r\313\326=*]\370\230\204D\\\266\360\321-\"\"-[\330x\001\322e\215\210\256\222H4\266n\221{T\"\271\257\320\217\206\336\342\022D\261\303K\242\270\304\260a\2601\202F$\333\302\310\266\306\013\255\3211yD\204\217l\006c\373.\333\027\355\222xL.ad\262H\204\301\306\310"
+	.string	"\203]\366~4\224\204\344\202\200\217\214\334c\221\320\361\230\\\352\243\"\354*\323\025\006\033\243\367\266IG\366\205\372\243!\245%\b#e\320\223\312v\t\002N&\227 \200/\321\310-B&I(-\177J\026\251\270L\227\255\321}\221\\*\215\255\322\362\310\272\313\366\275\240\324\036\225I%\212\216\354\321\017\351V"
+	.ascii	"\023W#\226E\322%\032%\035\225B\027\340\366m\227F\244\333\202"
+	.ascii	"\b\263/\021)i\t\273h\225o\004\301\366\310\026\177\360\262}\201"
+	.ascii	"t\213K\243\213\224\"]\244\355\242\330\036\025\225X\244\375\266"
+	.ascii	"\355\322\250-\321\036\215\220#\220X\022/\224E\030\214\307\344"
+	.ascii	"\321\333.\217X\2640\373\302\205\213#Zc\022\305\322e\205\220."
+	.ascii	"L\034\201\250\330\276ID%\026\211\250\264\004*%\261D%\026\351"
+	.ascii	"\347]&\227\313V\203\n\267oQQ\022\330\032\223H\027`\244\233T\302"
+	.ascii	"\355\333\301\270da,\223E\306\266-\242\240\250(\t'\025\211\257"
+	.ascii	"\253\304\022\215\222Z\264\306\r1\224\313\016\355\021\206\223"
+	.ascii	"\313#\230\270L\302E\266\210\230\204\223X\242\021\322=\202\223"
+	.ascii	"I\244\227X\\Z`L\272\313VI,R\036\211-\022\273,\"\026\227/\321"
+	.ascii	"}\337%\007\243K\204]d\222"
+	.string	"0\304Qi\371\376\300/[D|\223Z\274\303%\362%*-\177`b\b\0210\322M\332.^\026\211\370\036[$\222=*\022[\243\273\\\266/\222D\345\213\004\001L$\001F\272I\353\211\210HT\300\302\n)\354\342P\273L\026A\024\213@ ]\026\tDq\371\202\030\312`Lb[\020\215-\314\272p\322\250E\022\3337\211X\364.\213B\307d\022\001\304\364\377\317\026\020\b\2326O\264\237\035\302,lO\236^th\231QRfi\214\214\260<9\262\264\372\254\021\013\006q:S\227\365\017\325\017\325\317\025W\bK\232tY?W?V\273\354\310\326\326\217\325O\025\024(j\340p\374d\bQi\322\225\365\017\216\234\345%gG.\353K \317\266a\343G\212\207\007>LpbR?Qwd\344\300\374D\375@\201\351\340\023\005\250C5\273\343#\365s#u\346\261\272\262&\353K`\316\376\177j"
+	.string	"o\fy<\3450\362t\341\214\033SRh\374\3148\003&\347J\223K\034\023\216+\353\237\370'\376q\372q\372iR\343\021\3774\3750\245p#\303\356\007FF\037<\256\254\177\226t\233*29A\262\276\004\334\366?\354\023\244\263\001\r(g\336\257M\237\001Bf\013\237\240[\317\314\027'P\366\f\361\226\324\201R\203~1\203\366\343NO\226\032:|\232u\362\264\250\331\r\363$i\203\344G\326\300\031B\360\354\352\274\316\360N\006NyA\270\236w\354\370\250\313\353b\247\316G\367\365\206G\367[#\224\201\346$\310\220.\235bR\267F\227\365%"
+	.ascii	"f\307\2113\244C\304\0030N<7:s\331\312\n\233\220\2719j\234\264"
+	.ascii	".C\344\374\240|R\226\304Q\344\244[\351\234\332\326\222\254/\001"
+	.ascii	"*;.n\370\246N\001\224XA\311\032\276\031\312\355\3403EM\316\315"
+	.ascii	"\n\004,NI\233\037\333O\214\214\023J\033\335\307\247\304\215I"
+	.ascii	"\234\254/\001'\373\037\262\231\032~M"
+	.string	"\335\311\201\303\263&\253\003,D\320\324\254V\253Y\224\216\2477\037\020\324\331\244\214]\232!U\006K\342\345\216\233\217I\220\215\215*\t\032_\236\266\341d\356\312\231\241\023\0209if\360\244X\341\363\246\355w\343\304\263\211\306\206\256m\231{\273\221\365P\314P\314\260\fJEU\367AY\2161<d>,\363\003g\310\230\266\254\207czk\362\220\344\221"
+	.string	"\216\375\017\303\374\324T*C\366X\251\005\327\244\315@\263\223\301\b\275\262Y\21556N\340\216\236\025\221&X\276\004\271(a\003\205\315\213\260\310/\310\0340S]\200l\250\034\220(7\270\324@\273\322|\305\245\t\333\374d\265YB\007M\210f\230\305\343\rk\213pnM\02337F\013\320\215O\0227\273,A91\035\263\252f\217@\250\264\304Q\025\207#\252,\207\022%\006B\346\030\"\"\232\004\001\263\025"
+	.string	"0P@\036\017\212\205a\225\017\024"
+	.string	"\fW\314\230|L\037LR\024*\205\020\b\b\b"
+	.string	"@@"
+	.string	"@\021"
+	.ascii	"\036]\356)q\021)\016\356\254\n\233\t\207grX\244\371\254*#\254"
+	.ascii	"\365dR\321\310&\006.Y\355;\253g\242\237s\253\340\200\274\200"
+	.ascii	":+5\227\034\240\t\356\006\365r\002\016q8\033\214l3\0027\2744"
+	.ascii	"F\034\242\366\315\032\337\201;9\302\310\354\n\204\344\314"
+	.string	".\315\326xZ:\215\266\275\002\342\347\302\200/\003c\340a-\023P\210\252\222v\323=\0011~\342&\373$\".;\275\3408e\314O\f\325\231Vg\324\215\002|\323?X6h\005O\244\260d\313\210r*\365$%\021w\367\007[xK\371\245\224\276\204&\316\224\204^gch\240\216\235f\216\030\246i\371\247\377\270W\035r\260\303\204?l\374\233)\363\257<{M\244\275S\005\364k\242\035G]\346M\205 \277\025\217\250\300\001\026\320\301\355\320 \370\365VCo\320\324]\254\325|\310\006\341\317;Jc\270\030\r\263\240^\326<G\031H\250\213 \313.\363\037UP\211\207\037\001we@\351A\255>G\016L5dUn'R\331\262RD\3416\215\025\2039JHB8\361=\025x\225\326@\376\\\244\003G\216&\351\214D@}\265\257\245yR\371m\306[\020]\020\fgr!\343\324lsB"
+	.string	"\274D\233\016\213\207l\2046>\005 e)\227\247p\232\bgH\0044\006\216l\225y\316\035\234\232{\\\r\207Y\203\r\326\201\241\216\003\263\320\\X\300:'\361\212\217y\027\201\267\250d\257\255+\221\016\353\346\333\221\363\264\221Zj\326.\362\225\203\364\310\314\255\035E\266\346\020 \300\036X\271\234\205\324\240\003\177C'=\221\234\024\355\246\307\335Xz0\320\321\270\235\224\\n\002&~\372\347\237h\256\251\362\na\330l\307\035\337\371\345h\255H#9\277X\373V\2676N\277\202\363Y\340\224\271\350\277;\335\016\013dn\222\\I3+\217\316\030\037@+\277\311\357b\274\245!\3377\273u\267"
+	.ascii	"\320\206'P\003gg\220\320\005v\322>;I\231 \242f(2\371\304\342"
+	.ascii	"Zor\2112\244\267\302)*l'\037\231\006\321\t\252\345\037\026\220"
+	.ascii	"\223\177pu\374\264\025c\231P\271i]\361"
+	.string	"\270\245K\354\326\235\247L\006.L\364s\01660J\260\030<\223\005p\264<\f2l\226\377C[c\314>\215\220\347q\2628h\033[\351\366\255\357\r15\272\257*H\263kM\362\250\033\253\275=\356\275L\231\017\bij\023\031\255E_\375\270|Bi\377\367\261\320\306;\342R!\\\201*&\312\035Cr\340\343#\243Sy\372\033\255\374\030\245\330^\n\235\260\317\024\266E\321\231\2027\373\256\213\371\270\205\206\351\253D\013\310\330\202\345s\256\360(B\265\202\rb\270\247\3354&\223`)\234S\265\"\200>\217\205F,\235\271\271\024\224\221\335\211\f3\310#\270I\372\217o\274\315\246\360\204e\330\034\201\223l5+Z!o_\024\236\0226\003\217\221\223S*d\217\2300P\233cC\b\f\317O\270\274\344Z\002A\t\311\361\306\245\370\035\241h\322\331=\330\0348\234\273\373=\300DwAm\0333\n\n"
+	.string	"\233\370#\204\270@/\273\271\351\233g\316O\350\271Fh\231V\212\023LG\017\003\200\301\231p\336Vz\377"
+	.string	"\030Q/\351pQ\"\372\354h\303\006Nb\322G\030\251\216\253\211\343D:\242\f\217#\315\365\234\256;2\204\213\222\330C}\371\241\311\250$\020Z\214\262hRe\001y7i\301\271Ja-\354\360z\t\264 5\2356\362\343\352r\332\234\330H\313\257\333>\272K\211w#\364\355\003\033\357\240\250~\254\350\334\3429\235\351r\307\301\2111\005\210\226\320\302\271\236\244\001\334\267\276\033\322E\236!\205\327,\231iF\277\251\321U\275\215\271P7_\031\220h\267\\\377\260UZ\354e\247R\336h=\246\320\201\034\350/\342rRE\312\213Z+\005\341{\366\205\013@\022\302_\323}\331\004\343\271p\262\277\037\034\363\026\350C-\264"
+	.string	"oM\"q,R\177\255\337 \251\310\021\226\311Zk\356T\"\034\270\372\034\305\004\202\354D\306D\303 \202\001\206\374G*\230[v\"\270\b\353l,M\325xttr\342+\267\b\277H\276\352\036\330\tw\022\363\371\023\003\317!\032(w2\"Q\007q\003\321\360\333<\016\240O\3113G\256_\323\342\310y\260_\271p\364\327l\205\345\335\252\202:\005\006\364\372@RG_\313\271\370Z\341\227\326Z\242\326\224\257\265o\340\311\243R\362\334\302\022\241\261\323\211\337KK\263\034vb\t\342-"
+	.ascii	"\235\226\241\235\nK\242\202\207\r)\352\032k{F3.\354a\304\322"
+	.ascii	"\227R\0331hD\023\n?\026f$#\370\317\340\230%\265\310O]\016\216"
+	.ascii	"v\3727\350b\244\231\224\201Z}RycD3\373\307S\370g\351\212O\325"
+	.ascii	"Wo\304\260\236\322B\321iaI\352\361\210$\276\016\311q\265\243"
+	.ascii	"s\206\370\367\322\265B\340\262\300\333jzh\347f\025<\277\261\326"
+	.ascii	"\f_\3547\271\374f)\301V\375@\314\021\346\037+A\315\024\250\327"
+	.ascii	"\215\2567\374\034\215\266D\312U\013"
+	.string	"\360Y\267\001\204\311(\2075*=\007\3338;l\317\3034P\233\245\317\314\363I70;\006\255\240\013u\2072R\225H\177\244\n\234\213\003\037\276\027P\245\\\3229f\356\346\344J\032\363\341q\304W&\036\264\032\316\352\231\033[r\322\0320_\002\033\364\374\265\026\262\257\035U\037\366\007'7\266Y\360\327bI\037)\205\004\207\215\244\255\322|\2124+\030\370\207F\316\351\2259\264\276\262\362\363S\201=\315\344j%n\265@A\341[J\bz\016\025K\211\206\353\306\254@\307\326\3135\306\371\031\352\3621\030\223\275\256\217(\375C\3348*\240\241\355\312\242{\264\331zy\330O\231\274\t<\363[\246\245\r6\320\340\0205E\r\350\326\005y\252cW2:\035\267\357\345u;\263s\303\335!\260<m.I_\371\365J\036\r<\240R\001\274\320\220m\t\243GK&=\0068\365\027\232\260\033\215\357(\226\001"
+	.ascii	"\206g\242)/\235\353+\rN\027$\360\211\237T]\341\306\242\265\247"
+	.ascii	"^'\332\313a\352\024\367\362\374$\353\301\255\225\361\2220\177"
+	.ascii	"\211\243\223\261\025x;\302\213\221h\331\211b]X\216\335\354\204"
+	.ascii	"\271+\004S\225M\007\22795%l\205@\225\362\254@\371F"
+	.ascii	"\030r\004Q\331>W\211\361\217\r\311d}\"s\265\333ti\356\035\004"
+	.ascii	"\226\361\211\r\335\220o\b\336>\304\352R\006w\226j\222\033V\357"
+	.ascii	"\351\036\253\335\275\207\235*\220*B+\345!K\312\034\211?\254\202"
+	.ascii	"\352\306K\257\321x\264\206\305\205\005)\265\201\314\021\261\264"
+	.ascii	"0W\360\214;\224\367\324\221\206`\024\373\266\270\311R\234\253"
+	.ascii	"\227w\214\n\n\315bGN%M\313\036r\214E\361\0133;v\220%\263\364"
+	.ascii	"\r\247\206\335\264\210\204\314\3225w\362Z\372\020\304L\220d\365"
+	.ascii	"\2563\007\272\327\020\230u\317\342\321\247\022W\334Z\006\204"
+	.ascii	"\237L\230?\334y\314\273'j\211y\232cX\201\223\247\032\264\202"
+	.ascii	"\tC\226N#C\327\b\200\tL\221\203\360\330\035kzu\310\264\352\032"
+	.ascii	".'6\305\2012\2712\203\005S\355\022\013\252D\254i\255\261\267"
+	.string	"'U5\322\350n*\355%\215\276\2070\234KV\375\006\241\315\232E-\203\325y\211\247\202\007\356\021\266\001\212\225\355\210\237\001);\270\031\354l\202*2\226(\325[\177\262\3149\310\3445Ws\255\355b\266\344d\341=\001}:8\254Ns\3645\"\364\223k'v\266\2210\342\na?_\3617lp\260\032P\251\260\374;\033.\201\251F\303\235\317j\322\024\245i\3637\276\006z\354\224\345\004\352\236K\362t\034\3525\022\354?\315\213\032\305I\004\322\340C\210i\377\2127\272~\227#\315\0041\037\322\021\225aNT\301C\311]k\301\0041X\330!\200v\326ZV3\247X\320\205\355\272-\374\352\235\3069\300\241\311F\3472\305\335\266l\212\326_L\377\356G\344\032'X\350i\240\240\334-\227\305\213\213\ndhw\016\t\212\230I\301O)\224^qb\256a\352\225\342\217\212\2271f\350\013`\004*"
+	.ascii	"\206\314g\3443Q\371&\265|\307\257\005\222AH\005\300\272\200\301"
+	.ascii	"\370|t\027\361\363\240\323Br_\273\016\030\254\353\374q\347\346"
+	.ascii	"\256E9;\001\332\006\230\267\332\310T]\227\344\200\221\201\370"
+	.ascii	"\353\2312\017\377\025\247\030\226}(G\307,\341\373\325\250\322"
+	.ascii	"\321\006\025\215\t\357\311\036\024\021\005S\366\372\312\036\262"
+	.ascii	"\351\201\312\364\333"
+	.string	"\202a\233\214\351K\005&\334\ft\016r\204H\336\323\256{-\2427\036QM!\363L\306&\275\306*\023!\201)\013i\255W\212pF_\246\260O\352(\2512 \3678\257\227w$\211\003\335\224\024\177Z\366\334^\245KED\353\025\375\310\222\266\311\345\235\217\016d\327\276\274\300\034q;4\236\016\300\b\343\211\227\310\216\343\210\306\314Ur\311\377<\n<\t\306&\220\200\356\3047\264\026\337\210m\201\222g\373b\333\353\253\220\274ih\372fW\304wA&\035\206.\247\252\351\320\300h\216hn\241\226\330\247M\2704>P\204F\367^\257\234\217^\323\007~\361\335\202n\336\264\3043\214f\254\213*29\263\216?G\031\374C\203\313\255\017\346\2009\361\326\224.O\272\211\3566hT\322\243K\006\344\325\2548]\376dO\256\266@S\0314\346\023e\317\027\264\r\335\325\b\240\332\217\370\366\321\210exX\354"
+	.ascii	"\364\341\005\302\\/\023\004\205\204\202\003d(\361\216\340\002"
+	.ascii	"\371Qp\035@\315_\037\017p^\235%o\355S#XFB\177\257\226\001I\225"
+	.string	"\240\205ij\263\205\333\214\274\310\361\n\223\007\365+\335\241bq4\203\362\262\027\2567\243X|\232,3=\346\270\314Vt\022\276\314y+x4\346x\240 \315U\030f#5\216<\310r\3154\211\027%\266'\326\224\300\177\026\330l\331\215\274\006\317\035\330\301dw\205\372\030\247\213_\263,\214k\342\037\270\217\266:\276B\213\200Q\377s=\261<\017;\037\266\312\320\tU\026F\032\013\360Z\020\334o\031\353\335N\177\n\276\274i{vt\032\241Pn\0206F\376q:\323\240\250$\267\344\266\022\f\335\035:KI\257\220@@Z\233\372\"D\325\274\376V*\336`\031KP\377\340\241\215U\3631\3017\373\347E\304\254\261\324&\217?+\366\350\377\361_\345|\276P\307K^\313\017\301;<\212>\004,\230Xu\256Y\2220\217Iz#\257C\346\365B\036\004\260\233\311T\321.\365\312R\341;\276i?M"
+	.ascii	"\2770\246\221\220R\020\371\355\2573F+t{\223\307_\037\250\311"
+	.ascii	"\231\303-|`\254\373\371~>\346\021y\232\322oU\370\242\277j\350"
+	.ascii	"Q\032\273\b\335\243\202\255\351-GT\"\003h\376\322\fp\251\202"
+	.ascii	"\037*|\347 \214Y\330p\005\205\241\374\314\336k)f\0051e\351+\274"
+	.ascii	"\233:\242u\367\254\242i}i\323\277\232\260\365\256R\332'?rMhy"
+	.ascii	"Q\362_\254\037[5\225\224qM8/\235No\"\005\262\312\272\245\256"
+	.ascii	"5\213]\275lv$;\236g\226\336\377n\315\244I\033\220\270\251\007"
+	.ascii	"w\364\0271\326\317\016\257\b\264Y\377%W\324Y\025{\354\235\230"
+	.ascii	"\313:\351\005\255\355\217G\230U\336R&\300\264\n;\332\272\345"
+	.ascii	"\r\210\211\376q\272F\262\335z\3731\200\357\004\375\247G\230\006"
+	.ascii	"\365\212\337{\315\016\363\263k>\306. \333\305\013\347\216*\227"
+	.ascii	"\273ND\345\304\367\373Wl\177\262\240\252'\213\024\026S\013Y\220"
+	.ascii	"6@\252\350\304\307\306[\322\363\372\326Q\306\004\037\262Y`T#"
+	.ascii	"\261\233,\242\2358d\331\340\017\003\027L\363W(\037\002\226\363"
+	.ascii	"\303\016\220\323\316\216\266+\374g\265\020\221Y-\265N/\326\215"
+	.ascii	"V\323\357\317\263\327\2650\371\004\023\305\257\007b\203&9\323"
+	.ascii	"\210\255\354\313 ^\302\t\372\303\315(2\024H\256\253\021\206T"
+	.ascii	"&\"\004\327\207\216\305Ee\206[\3138u\222q\310\240\025\327\020"
+	.ascii	",Hk\246\202\022\327r\326\203g\027\335\320\\|'\213\020\222=wI"
+	.ascii	">\265\035\372\341\345\245\327\356\237a\327I\204\351\344\030\206"
+	.ascii	"\177#\3658\257\210x\242\271\3202\305\007\276\341k\235\272 K\202"
+	.ascii	"B\n\256r\221\254>\035\204\305\212\333\020\214\223\200\013\335"
+	.ascii	"\312\217\331\331+\355\251p\032:\260\024L\365/\t\f\346P\005\323"
+	.ascii	"{k5 rO\261\356L<C\205 :\246l\020%\357\230\345\315\325k7\305\310"
+	.ascii	"D"
+	.string	"\343\212\003,eF\2060\203\303\250C\371\030\255\272\330\351\366\331NV\2174ud\213\364H\215\367\\\224\303u\221\3167\270\343\240\356\220t]\221\325qH\242f\230\335\037\021\353\320a\227U\344\261H#\370TH\374\033`\215.j\ts\277\246\274\005\250\210,\350q\370\034\321z\257rw\2146\224\020@*+;\261r\356\307\253\204\321Q%\027\177\\\276\001\037@\351\313=\007\330\030\254N\375\317\342.\r\007\371C\246\214'Q]\263L\373\234FU-si\345\273,\030\306\030\002yb\335\021\347yy\016\240\264i\344\022\222\352y\001!b\313\200\3755\200\3436g\227/\340KD\314\221}\276\364j\r0\3077\204A\025\207\"M\213=\360\267/\020\226\206I)\222\227\236\245[\314\306\332\304\265\005\227\237:+p\275\216\347a\375l\030\005\247`r\332D\032&P\222\214$X\004\303\340\003\362\322XF\235\342"
+	.string	"\245%\bt\255k\306T\251+?\250^\\;\212"
+	.ascii	"5\216\016\032\003\023)\333\255\270\330\302g\263Wo\212n_\356\320"
+	.ascii	"\3224l=\274j\362\026\232J\2144\306\305\361\022\273\021-\321>"
+	.ascii	"\262\r\372|\005_\027\334\0369\005/\352>\020]T\017\332\242!\325"
+	.ascii	"-\205F\272K\223\213"
+	.string	"\226\226\337\2065Bx\337\303\354\336\373pt\033\025\314m\236\243s\303\245\335td\324^\244\0017\365\257\312\374\362\306\2254\356\033\207\325\225_\030\021Z\271\025\003\0323\202Co\317g7X\315\245t\n\252;\337R1\234\234\275\217\031\341\204\374\2428\316~ aRj\3108\313\214\241++\370\273\031\245\332\177\232b\234J/\355\tf\216\235W\367\256\200\203{\224#\r\361'\\\242/J\"\1778\354d!\240\007\002u&f\030\205%p\235B\305\f\301i\031\343)+J\347\241\005^,\355\304\367hr\202\030\261\273Wx}3!\fPa\376\323\255l\251\303\215X\205\353\304\251\322i\242\2713\350\233\217\370o\332\342\205z\346\245\354\270\216\232V\216\264\3313\301!.\302\320] \265\314[2(\"\013\253\005\016\3113\277[Dam\256\236r\311\263\324U\006\337\377\261\177\370\320\243\355\313\3351\330"
+	.ascii	"\213\211\025\314\002\372\351\204]^\277G\223\211m\016\313|n\333"
+	.ascii	"\2513\253\265\026\023\244k\367\030\300\b*fpm\021\365\016\327"
+	.ascii	"V\332\315\217b\304\253\252\263\304\024\337\034\252\231\302~\357"
+	.ascii	"#\372\321\207\020Rb\344n7G\313q\243\217\214i\371\260\301\247"
+	.ascii	"t\211\023\335\274)\206\355"
+	.string	"/)3[c\244r\322\002\213\023/6\346\342\224\001\373$o\372\325\204\005\3247\225\300\360\316\207;i\305\024[sB\207\f\026\007\\Bt\262{\365o\313#.\220\340mpdM\225*BR:\275\306\247\207\356:\217O ]\323\272\221n.\252~(c\346G\240r\fO\026\331\026\206A\274g\347v\337\260&\237E\367\016\300\245tL\315>)%sT\275\307\336\007\373+\025\370\177Wp\035\r\025\316C\030+u+\243x&\227Q\367\204Xr\373\007\3318\257\353y=\217\252\242\302(\336\255\221&\331Q\226\007\270;9\241fXm\004\326x\322@1\342f\nH\340\023\331\317\020\263\370\227G[\225>\207R\317\352\304\001`\260\203(P.\330\310\307[\350E4\301\323/M\021\225m\262\035O\315q\3711Ul\262\215@\265F\240\204^\020\272\236\362\006V\022\335\271\004\031\330\003\320\251o\353\020\331O"
+	.string	"\340C!\005\310\237z{\362\3430\216\320\367\324\374\373,E\242,\001\236\247;\362\206\221\003\206\376\277N\261\337\005iZ\032\365O\237\356\361x]\202,\315S\n\250\356\311\257\254N\227iXXg\344\312\344k\325\025$\225\243\037P\360\0029Cb\350\030\321\377,\211\201n\241\334\305\361Z"
+	.string	"Y\375\371\023Y\335\360y\246\216\f\226\301\215\262\222\312\022\307/\033\177$b./&Z\0079\345\347\"\222Q\335\364\241\004\366F\035\265\354W\034m,8Z\2777\302o"
+	.string	"-c\023\237\024\232\330\304\270\304\306}s8]\201\363K!\222\024P\032\355\023\304-g\242\027\327af\230\215\321B%\3366\032x\234R \013q\215\233&]\214\215\t\333\253\310\210\312m\364\021{\312H\302^(m\326\236l7\265\302|@\232\207\266i\352\335C\304?1\353Wx\341"
+	.string	"\214\215[*\376\302s\240.\033\240e\036\226(\204\354\224\233\203\263\355Z\"\2364\262"
+	.string	"\264\037\330\362\033\241\244\315\370\201+\364D,#\003j8\311\221\b\214)\2665\310I1\002\375-\207\250\032\301+\242\264\2656Oi$8\350\3334E\365n\317v\371+\001T~\0308\273)\016\023\337[_\304\300\023\r\343\370J\336\306\243\271sX\265\r*<\237\\\250\t\3059-!\224\276\023\004js\353\b\367\307\300\341\r\002\213\024\353ib\325\262\330\204\\}\240P\016Yq/H\241\237\360\241\255q\233\231\"\225\275\004\016\307XD\232fY\356S#\231i[\221V\266\206\266;;\202q\234\037*\361\36272\003.5d\242\345\243aG\032\304\321\032\315"
+	.string	"\351\013,\220\211\223a\346-|2"
+	.ascii	"\353\3775\316&\227+\246\337(\215\031\232\255\357h6\261\313\331"
+	.ascii	"J}\325O\\\244\345\024\230\030\267\346\360+\222\265(ro\026\322"
+	.ascii	"\035M\2739\364i3\312\036\2505\330P\247\224<\227\333\342dZ Z\266"
+	.ascii	"\317Tlk\017\245;7I{b\342\372\373\365\352d\2022\220\302Dt\321"
+	.ascii	"\231\253E\265Z\237\020?\3651"
+	.string	"2uv\nN\216\321\202\b\375$\246D;k7<b\037\306\201\363\215j:\032\200v.\321g)\354\360#\b\335\233l\217\235\3647\326\212\341\032j5H-\035\035\235U0\032\275\311x\215\311\322\365\371\215\254$$\333\326\356\335}\342\243y\347a\344\322\340\246\201\361~\216\360\365izY\203\0075LSi\220\024\206\224\261\252C\033Ec,\027<aJ\3515\027\344\346d\024\303\254b\235r\213r.\371\310p\304\255\272\034\210u\fc\242{\024\324\2367\210\223mgf\025\022%Ud\322\301*2\r\207\211\331\216<#\367\327\201\237i5\253\372\214^\267\312\225i8\341\322\017(\f0w\177V\262|sD\301 ,\373\271.\262\335 \002Hphm\227V\316\273\026\233^M\007mXjc\354V&\002H\333\037y\b\246\372\233\203\355^\024\252\236\355~\024vV6\0331\253\254M\th<>\306\036"
+	.ascii	"\264\332md\360\2179\026\324\221\343\227\357\362X\036X5j\032\335"
+	.ascii	"\034\216\346\323Q+\277"
+	.string	"\255\r:_&\215\223\202Gf`\017\f\335\207\304\356\335Lj\235NJ\201x\003\264\217\002Yvez\373}y.\362\370\033`u\032\333f\254\375n\267_[\267\200q\366\270\021u\336c0\315\027~\371\337J\257\343N\315\324J\0278AMTPy\262\233\355a\221~\016\")4\232\332\372\306\372@\365\367%\203B\256M\320zd\270\312\037$\307\226\336\305$\204\27434\360\260\240]\351\235~\027\233\310\220=e\022\233\221T.\227\323\be\236R~\254\030\261\021E\003\321\253\037\263\2733\004\355?\231\002\020\263\361\264\357M\3518\"*\261\305x\376\326\265\214\351\373\273\034\304\377\n\034\003\370\033\310\"\271O\264,\013M\035\331eZ\214n\242\2379\213\317\030\371\203\024\260\005\310m\330Rv2I\325w_\210\312\006\324\373\264a\230\350m0\270\007\234\373\025\264a`\254\260j\240\305\255\363\364n\312\337,\337"
+	.string	"\301\024'\017\375\022zpg[\022\256"
+	.ascii	"*\315n\262\020z&L\020\346m\001'La\313\320\237d;\f\230\032\022"
+	.ascii	"A^\216\t\364P\f\200\230l}n\t\210\262/\376:\206\257\300u\2004"
+	.ascii	"\303\026C\262\371|\242\201l\345\233\034\307\005N\324\341 \275"
+	.ascii	"\252\016\253ia\"\215HE\001BY\3100\275_d\237~\032*#V\202\002\251"
+	.ascii	"-9\213\374\340\253;\f\304\270=T\373Y\332SH\023\222`\201\240\343"
+	.ascii	"EqVN\200E@\304\243\220\322f\356\006\353x\206>I\223u\376\370>"
+	.ascii	"\220\024[\233r\246TO\2273\007\275\204\277U\342\\M \247\200\322"
+	.ascii	"\242\001Z\306`\265\372r\035\220'E$so\316\224,1c\216HS\f\005\227"
+	.ascii	"\312\006\3108\215$\343\0054\003\350\260\306P]\203\304D\022\r"
+	.ascii	"\364\027\216vv\261|B\221ql\262\f\305\323s\0065\371<\257f\236"
+	.ascii	"\223\323\337\330X\013\031\324\343\032\264\002\322g\374'\201<"
+	.ascii	"\024\322\314\256\b\002\240\211Z\226t\374\270\257\213R\007\004"
+	.ascii	"cn\371\035\377\340\372bp\330D\362\3504\203\273\366\332&\005\356"
+	.ascii	"\274F"
+	.string	"q\255}\003%\310\n\023=\301\211\265\b\364\360\307\260\3552\002\307Ub\b\305\3473E\tX\224\234\225\300\236y\264O\232\374>\335V\002D\223\273\311\331\315\205v\265\374\351\037\212\312\373\310\271}\200\032G\253HC\247\304\220\020c\030\337\343\243^\004\375\224\206\201\335\301\223\350=\251\313\201\305c"
+	.string	"}\371\350\262\003l\314\307b\230\247[\310\277\020\347\335\375P1q\303\"\004\360\250<U\371\253l#\370?\361c\313Bi\352\277\032\332\317\376_7\004?*\007\240x\210\n\366M\275\361\001\373\315a[\346a\267~\256\300Y^"
+	.string	"y\222\027C@j\320TS\245\022\240g\310\006\331\277\007"
+	.string	"^\372\307\212\365\357\200\3758\357\200\336\323\034\205\241\303u\016\376\267M\355\357d 3\367\312\246$n!\005\243\007\235\2763\0258\367\024\333\363\311\367\222z\340\254\323\2346\343JY\004\"\255\357\310\020\312\373\257M\037\"$\344q\242=\032\362:\243\260].'\204qf\334\3535S;\246t\231\200\r\244\372\304y\037:"
+	.string	"\235\020\214\226Ut\321t\350\200\030\031\252c`\362%Pa\254N>P\036\314+v\216\017e\277\316\350\314\346\333\f\305*R\357&\037C\037\030X\3645\341\325\032iV\026\316\250\345x\272\255\202\2731Lj\235a\252aC9\203;m\245\020n{\300\317 =<\027{\004\016*\240k\254aU\337,LC0\246J\345\206\372$\242\332\255\277\2654]E\257\267\320\320D\315t/R\356O\177\"X\253\201\323a9%\332\244\"\235x\3012\033d\021\252Rw\275\220j\312Y\303}\343\375\323\222a&\016_\020\376\033\207 \360\b\032\373\343\377\356\024R\335{\f\026\334\276\247!\305\213w\n\227\3431\r\377\035l\177]|"
+	.string	"tW\016-\303\303\361\353\031F\034\343\201\324\327/\020"
+	.string	"\340\216\265\316\335\211\026\023?O\365{\260S\357\232\276j\343T\237\263\215-\355\234\265\033GM\335\371\304\357C^\2659\371}-\217\241x\027\322\016hr\f\2512\263\351k\254I\001\260)\243\353U\253!!\330p(O\255\004\247\212i\354d\373\253\257\031\354\n\247\312C\225o|\253\277\270\365"
+	.string	"\347\334\237(\366Cvp\b!\r\211\377\241e-\207\203\2114\334\233e\330\220T\300\2741rv\006\037|\03691\211}\220\226\244gt\350Q\366);T]\350\351\356H\2557\330mC\374Ge\262\027\250\254$\343Wo\343\327w9\177\356\371\325\326rg\221s\216b}\300\247>\376\246g\361\371\210\034o~\333=\316g'R\224\335\302\022\342\370\351\211\"\332\242d\b\333K\261\363_\013\356\325\342z\231)-,\237\276\237\371\305\005]A"
+	.ascii	"\266\356\230\027Y\022\222\356\223O\226\346\2222|\036]w\001A\257"
+	.ascii	"\376\247"
+	.string	"\250\353\017tbN\322\261\020\307\355\037\206e\0354\300w\007e/$\2502\001U\241\210\240\f\177r\303\320\366H\322Z]e\343p;\242\225Gb\345\225\271U\357\032AY\177u\2749?\252\315X\t\262\350\350\035\002~b\266\377\253\304~\200J\345\300\237\250\231\246J\300}\025\265<k\310\314\366\036\343T\364a\251Fr\243\nSM\nC\3732+-Fn\357\345:L)k\277X\210s\375h0(k\273\235\351D\n\253\025z\240\227\303(7\001\350\243$\246\0236W\324,\220\375w\201\357\036\250\263yZL\366\333\223\002W<@i\210\222\225\342D\370\307\262\226\237\376\351\345\211\261\311\032\001\376j\310Y\235\313)F\\>\"&`fl\332\246c\003\356\234\316Et&\256\017k\223\205\375k\0361\241\3153\005q\375\373/7>i\367\314\005\314\346\315\033\311\017\351\243\370\020J\275\033\t\224\324Me\""
+	.string	"\314`\223\005\302\bg;;spy~O\314\001\276x<H\204\263\375\206\371\033SR^d_\273i\256\310\020+&\254\2535K\212I(W\270\267\2215\235C\341\"g+\214\307\222V\332\363\201\005\221\210\021\343N\t^\007Y\027\272\252\005\305S\357:\033\356\335\210}FJ\311-\263\215)E&\253\213\250i\270\371[\364\2029G%b\t\357f\313\265\366\212RZ\357T\321 y\276\201\321\241\253F`\203hC]\"\022|0\360w\266G\377\354\020Z\357jK\0027\314\321\025\210]_L\026\027Q\232\252.\007\272\377=+|\332\263\257r;~\210\241\301\205\f\352\013K\035\006\261\364\222D\021\353\370\317`\273z\307\333\034i\265"
+	.ascii	"z\005\271\301 \201\027e\016\302\314P\022\033^\352"
+	.string	"\246;\b=Y\321\r\364K\237\310\034\0162a\022nV\246|\356\241\345$1\336\251\025\314i\354\231L\313;1\302N\200\376\225,GB2\247\233fXk\366\314\350\255\237\177\\\362\375|=\r\f\373+I\017C\241Y\374\236\342\3047W\376\013\367\261\353\225\177ad\215\026\326\374F\372\261\262g\242\336\263Q\r1s\223\313(\023\243NqR\016sI\221\275\206\277\377g!|\b\372\372\t7\365\330~u\331\353\fl\371e\027\333\307\322t\002\364!\202E\317Bl\237v\335S\357\374\303fo\320\353b^!\302=\231\224\2212\t\253K\262\273\177 \353\007\032\375d\035\177\341&p\230x\206\242\332i[\275G\334\365\261~\212\033\217`\346\307\036\267X|\220\332\006\223o\316\\o\316]\033\243\337\221j\254&\264\334n\327\343z\32643\004a}\230\233\034\345\356m\013\377sc\035\365\366\2638\226\317\260\357"
+	.string	"\334\017\367\351\236\306\026b\357c@\267+c\363P\336\265\241^\240(sN\276[\266\031d\266L\333\317\362\337\216\340\211\356\310\315\207\035\365\005b\364a\300-\330l~\272#\366\374\332\315\013\224\340MM\354\034\357\357\260\317h\271\036Rg\016\031y\316\321\355\366/S\216\371dCy5\315x\305\232\003\363C\363\223\321q\332=\346|\0046O\b_\265\340\247\001\371\254\351\311\252\231\224\003N\007\361W\"\237\201\342\231XW2\370\317K\364Ty\360!\200_Ts\361\375\023\271\356\223`}+\227\341\367+\224\270\234\372\031<=\3408\272\3000y\227\300\234L@;\200\304\211\242\357\023\373\327\303\267\324\255\255"
+	.string	"\307\306\214\215\303\372;|K\2575-\331\211\244yb\323.\256\363\017\375\026\351\0169\360?\332\007\230f\217\350\033\311\231\331\026\325\242\030Q\315\257\221&\bV\243\320\3664\317\376`\020\376\031\362\264\345{\020n\031\351AA\231\325\363A\204IX|BwG&\347\245\265\377z\263\231:C\307\317"
+	.string	"\356\334\371\211\314\357\371\266\303\277\224\364w0\236-8\316c\364\363\3426\203\316O\314i)\021\343\243\\\257\216+\236\326]\235\017uV_\247\"\377wb\024k\253\325\376\004\255\314\266\277l\246\026\277;\273\350\026\320l\367A\313G\204\314Q-\354c\223\303??Z\"k\fo\373\314\306\317/\030x\270\370\305\322w\253T\333\321r\262\333`\213\317"
+	.ascii	"\277\357\375c\016>\205\342\315\312\240\225\327\bv\372rX\206]"
+	.ascii	"\345r\354\2045\251\223\\\376\311\213\342\225\223\367\324\375"
+	.ascii	"%\034\030q\370\341H\267\347\355T\260\0028N*\317Z\2570\372[_|"
+	.ascii	"\221\274)\300\327\266\215\356\304;\320\247\030\020\356=\237="
+	.ascii	"s\361]\201\235\260\353\031\333\275@\267a\363\265\325\253\001"
+	.ascii	"\274\023X\016\207\311b\004\006;\304_"
+	.ascii	"\200C\005\377\037N$\360W(S\r\006\007|\237\350\357\255u\357\341"
+	.ascii	"\314\263\263d\350\267\204\374\344\374\210%\003\213y1$\317\271"
+	.ascii	"?b7\002Dk7\272J\3659\321zV\363\241o\242z\217\374M\320\362\212"
+	.ascii	"\255 \317VIf\221NW\363\275p\007\340\210\234\246\357R\356'u\337"
+	.ascii	"+\030\354\356U\327\207q\364\001\021\376\027\362?\017\337\326"
+	.ascii	",\243r<}\324s\333w%\275\022\034\n\325\354\037"
+	.text
+	.section	.gnu.lto_.symtab.4f365414189f81a5,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\005"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\005"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\005"
+	.string	""
+	.string	"canUseLaunchControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\005"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\005"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\005"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\005"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\005"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\005"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\005"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\005"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\005"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\005"
+	.string	""
+	.string	"processRxModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\005"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\005"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\005"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\005"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\005"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\005"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\005"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\005"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\005"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\005"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\006"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\006"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\006"
+	.string	""
+	.string	"osdLaunchControlModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\005"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\005"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\005"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\005"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\005"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\005"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\005"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\005"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\005"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\005"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\005"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\005"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\005"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\005"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\005"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\005"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\006"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\006"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\006"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\006"
+	.string	""
+	.string	"latencyTraceMark"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\006"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\006"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\006"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\006"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\006"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\006"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\006"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\006"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\006"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\006"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\006"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\006"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.string	"latencyTraceReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\006"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\006"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\006"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\006"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\006"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\006"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\006"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\006"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\006"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\006"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\006"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\006"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\006"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\006"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\006"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\006"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\006"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\006"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\006"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\006"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\006"
+	.string	""
+	.string	"fakeGyroSampleQueued"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\006"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"gyroRingCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\007"
+	.string	""
+	.string	"blackboxGyroCapturePush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4f365414189f81a5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
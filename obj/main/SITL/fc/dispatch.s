@@ -0,0 +1,319 @@
+	.file	"dispatch.c"
+	.section	.gnu.lto_.profile.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 r\305\002"
+	.string	"\364\003f"
+	.string	"\006"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\200\276\204\276\004\f\002\001\002\002\002\003\002\002\002\004\002\004\002"
+	.string	"\002\002\002\005\004\005\255\302\354\351\001\016\004\002\004"
+	.string	"\t"
+	.string	" `%"
+	.ascii	"T\004D\005\340y6U\273\275\340\200f\3030h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \264\225\003"
+	.string	"R\006\027$\200K\322\001+\255px\001\201\b\r\263\206,\342c\353^$\243I\225G\320\004=\374/\350\242\244\221-w\n\377\007P\202yL"
+	.string	"\277\272iO\304\320?\365\356\276\205MC\271\020v>8\356O\200\026\351\023\310\032\017+(\260b\3110\006c\377{UzD\333?\205\231\231\350\321\220\007"
+	.string	"\374CQ"
+	.ascii	"O`IG\021\311\"\257K\250\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \272\005\003"
+	.string	"b\304\f\025\260%\351\200\035\rs\220$I\022\352T4B6i\255\221$S\236c\221-k\205!Z9\267\250py\335\317w\304\316\354\310\303\362\020\330\360\3213\020\020\021"
+	.string	"T\025"
+	.ascii	"+&0\033\003\025\226B0\254\033\200h\363\205\035;\213,\330a[~\360"
+	.ascii	"\\\363MD\230\307v\346\200m\033h\003"
+	.text
+	.section	.gnu.lto_.lto.a2611d616797dd42,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.30.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \340E\006"
+	.string	"\242\213+2Pm\222\016$\243\3529\203\270<\\"
+	.string	"\200\200\254\255\211\300\013w\213\243\265\273\035vvO\02726\33263\263l\023\305\213\322\310A\257z\305[\334[\246O\226\210is\311h0\016m\202h\023\230\213D\233*M\263\030Le\036\252\266\241\250\252IX\026C\207\007\037\254\370\212t\304\272\037Sp\256W\243\313\tht8\300\361\271\3541\317a\307\027 1\364\337\207\322\006A\226\231\221\255$Jt\002\362w^z\201\241\263U`\201)&\027$*\231XC\217Z=\3536\244\b$%\027\310\323\023h\310\314\357\002it\354\237\360+\374\030\001\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_dispatchEnable.31.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\222\213,5Pm\222\016\244<\366\324"
+	.string	"\227X\327\255\007\001\200\242o\347,8/\335\261c\355nD\013\253\227\0133<&\353\253\252\212\252\352\350f\220\254\032\375\306\266A\210L\001\307\352!b,\313\345b\200\321\001F\\\026\004\214\331\005V\006c\226\206\fb0,\203\024(\373>'\204TP8o\34263\335\217\202d\356\306\022\032\327\255\322\325L\225\234\211\b\303C\304q\243\007m\334\313\370\002\344\373\374[\350\210\020\224dZ\214V2$\215p\374\245\326\376\244\200b\200\244\023\222\222\231\360iT\253\323n;*\260y6u\001\n\231\271\333<\027\375\365?\370\021\376\212\b"
+	.ascii	"2\001\007xF\340\002t\r\307\na\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_dispatchProcess.32.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375`\"\002\215\022"
+	.string	"&\241xI\320\362&\035R\225\223\223i\021\340\244\250d!`\261\tRL\306\203\372b\235A\3263}\307\264d/'\201q\233\373\332\336\364\370\206\013fn\241\034\034-@N\242\215#\320\033; \201\247\244\316\364\320\312\213XB\266\224)\005a"
+	.string	"]"
+	.string	"h"
+	.string	"N"
+	.string	"\336+9\311wO>\300w\317\266\016\002\033TM3F@\346\234\341\212\260\247\263\177\236\\\235\371B\037\261\021\351r#\314?\221Qf\350\312a\254\251g\302\346R6\260\375\2148\356Z3\306\310\305!\275H\2152\272\037:\211OM\227\033m\256(\007sN+\315\350\341F\335\366\314v\004[!\004\337\343>\342\264\003\302\026D\323\33529\341r\2739\366\255\246?\251\021\203\204\027\307F\251U\253\006\037\364\243>\265\364\324+\325\272\352\257\\f\220\006(\315\331a'd\316\360\226x\374\241\027\271\234\310\007|p\277\331)\027;u\357)\333W\373@\267\315\036\364b"
+	.string	"s\206\020b1\347mA+\035\222\335\267\260q\361\263Q\256$\202\002\030"
+	.ascii	"\375\370\320\365W<)\346\357\230"
+	.string	"\225\242\247I\271A\303\203\326zN\003\b\352*@\361\224\342\003\016\f\351\013\237\352574z0\311\210\321 \006W\265\250\0373C\276\250\005\367E\227'F\034I\272\243\236\232\356l\273\216\364\"\3224\347<\361\2172\274\020\350\354\334\363c\337\275V1\211ah\311Z\302\225\227\313\365\022\r\304&\260\\-\t\262\025\026\f\326\"\256,\232\250\2102\024\226X\253B(Z\bWZ(\256P\204\305B\223\002~\261\260`\241\354\365\202\205\251\033\355\213#t\311\323\363\264\203\266\265\022\337\346\030]\356\203\034.\344*\371\324t*nh\272\273\234sNoD\345z\327%1\013c\233\302\227Z\002. \200\002\221\262;\007\265d0\f\254;\376\r\264&B\326L\315\r`p\033\210\361\214\fie\353\215\321\227\201h0\004-\3275\"ob\027wB\220\265W\331\013k\313\357\373\360M\350\262\221\262\005\034\314t\003\231"
+	.ascii	"\032\345\"\256\b\350\027Z\032e\026\340\216K\244\3563sl+-\r+\264"
+	.ascii	"?\223\361\361w\264\203kC\303tu2"
+	.text
+	.section	.gnu.lto_dispatchAdd.33.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375`\210\003%\032"
+	.string	"Fo\247I\240\230Q:\301\363\030`\234<\3545\022\020\257\335dq\3422\330\343\265\217\234HC:\311\223{\271\331\273\267w#>\275\003\354\206\226kv\2715\370\n\274\016bT\376Z\032\n\364\002\256\347\030\022\306\251\322A\b!D\356\224\002\215"
+	.string	"\207"
+	.string	"\225"
+	.string	"\366\374\235\307\317\231|\304.\273/\226\020\331\335\006\236)/&\b?\355\357\270\322\317\227|\376\3325\002Bd\367\327\300\n\312\213\376=f\274X~\300x\321?\266\224\002\"\002l\3319]\331]\230\306p8\177N\216b\250\345\374\361} N\252\370\330\362\351\246\030*\023p\312\345\003\n\037(%\315\0201C"
+	.string	"HB\327R\350e\270\200\210J\350N\202\206\302\230&0\242\034\370\331\363\355\346$!\354\256'\317\207\342v\271\355 \333\030l-\0213\350\027\235\032b\355\262r3h"
+	.ascii	"\323\276\261\315\363\256\007~\302\215+,W:\005a\377tS\217\244"
+	.ascii	"\262\216\234\254F2\257q\032\346K\277\200?\335\2563\375/\3458"
+	.ascii	"M~z\374\264\370\246;$\247u\234\236\343\364\t\250\213\035\220"
+	.ascii	"\200\225\335\023A-\313D\224\272\361\246\377\311\377q(\273e\236"
+	.ascii	"\373\260X\004L\332\335\026\217\335\272\370;\035\350\226\355\247"
+	.ascii	"\236p}D\330\021t\320\204\373\002\005\271"
+	.string	"\364\252F\\\355\376\030\\t,\022r\264\260B\232z\302a_\370TO\214\214\335\215! U,\002\352X\312\315\340\265\n\n\023\224\250G\266A\312\322\227\212YJc\300\221HMI\273\271\363J\355\005\271\250\037n\244\346S\372\270\361\242\250\016\206\254\364X\204\273\273\241\036I\321\270\254x\266\354EfQ7Z\214\214\227\306\206\202\274\024\271\031\324\037.\214\220\250\036\371\2179QB\243|\316\250\252\241\307\223\0203\213m\016\027\222\023\363\2432\320\312\335\275\r\237\361\242\352\235V,M\275\272\364X@D\272\3560\263cC\273\361\300j\266\233\033\233\354\200\r\355V\253P3\013\200\363\235\n8\032\233Y\r\211\323\271\325f\242e3\035d7\032\234\035Z\rL\266\001V\243\321\334\300d:;\260\031\003\266\341\314t`7\233M\007\326\372\345\256\272'R,\325aXj\250\275)\212J\352L\354\206\204\017\362Q{\266"
+	.ascii	"\365\215x\360\231V\005H\\\021)\265\370s\306%9bQ\324\225*T=\244"
+	.ascii	"/J\307\320\250If/\024V\f\341M\311\315`\215\321\302(\363\272R"
+	.ascii	"\305\203J\025\025\214\312(\211\265\313r)\2510z\250\007E\250q"
+	.ascii	"\030\310\020#J\221\221\221@\246\026\024\246\003P\002!\204\224"
+	.ascii	"y\021\36054\266)\354\006\332\300\327A\t)\212\234IOLF0r{\266'"
+	.ascii	"t5\025 \235\271\240\354\363\216\001\305\234\213~\275H\246\254"
+	.ascii	"\300\277~\002\0058\271\227\327U+@\326y\360B\272\351R\226C9?\360"
+	.ascii	"\003K\216\253\203\336\307x\306\"\034\307O\316\354\020\206\202"
+	.ascii	".\004\371t\bS\r5\246\372g\262%\307Ym\"\364\177\242-\262O\205"
+	.ascii	"\205\371\356 &\207<\306\216~\364\206\264\222n=\301K\220\203\b"
+	.ascii	"\223\250<Cv_\026\311;\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 \246\215\003"
+	.string	"\304\005\242"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\r\200\204\001"
+	.string	""
+	.string	"\003\002\037\177\016\002 \177\017\252\333\3426\034\020!\177\021\305\245\376\322"
+	.string	"\001\"\177\022\377\037"
+	.string	""
+	.string	"\200\200\200\004\003\330\244\235\311\003\001\265\006\003\005\006\305\245\376\322"
+	.string	"\001$"
+	.string	"\007"
+	.ascii	"w\204\002\3412\\\366@\217 k[!Q\204Vz"
+	.text
+	.section	.gnu.lto_.refs.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\001\001\001"
+	.string	"\002\003\001\004\006"
+	.string	""
+	.string	"\004\n"
+	.string	"\001\005\002\004\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a2611d616797dd42,"e",@progbits
+	.string	"(\265/\375`)\t\2552"
+	.string	"\332Y\244\023G`\034V\007I.\234dKTQ\272)H7As\363\236%\005\027\304\255\306\204\254\374fm\253\263\321\222\305\360\367\331\353"
+	.string	"\022\005\224\270uf\002`\310\342\201\276\"7\316\327I\233x\261\370\375\327)\371\024\242mW\231R\n\001*\001(\001Q\277\322m<\377\007"
+	.string	"\260!\"d\212\331~\363\260\356\336\245xq\346\305l+e\247\342c\036\3459Y\273\024\237\322;\345\373\320\377\367g\247\266\246\206\024\263\335!\267\363t?\316\323\365\204<\344\003tl\230\324\253jS'\230\215\272\324\243\274/\264\223\224\321Ja\266{\271\035J\013"
+	.ascii	"{\t\335\223;g 0^\217\033\265\244\027v\322\355K\374\313\2379."
+	.ascii	"\225\363\245\377o\220\316\0223\034R\314\372\023{\023\177\333"
+	.ascii	"\237\316\244\215$4\217\362\277\376_\177\262\377H\367\004>\356"
+	.ascii	"\tre@\220Otl\343\334\257\017\320e\027\240\253z\373\216\273\351"
+	.ascii	"n,\335}\326\335^<ww\227\005\335\016 @\267\213i\363\302v\373\225"
+	.ascii	"n\367\356\276v\367[w\273uw[w\233\351n2\335]\326\335h\335\r\246"
+	.ascii	"\273\233t7Yw\207\350\3560\335\235\326\335\325\356\246v\267\223"
+	.ascii	"\356~\273[@ws\351\356\\\\\\\\\\\2677\350\366\251n\235\021\001"
+	.ascii	"?\\\215\253\374\252\245\026\222\tD"
+	.string	"u_\347\257\375\2734\352\231\n\376\265\234\3145$\226O\223\324\252\244\030\322\351\357\377\027X&q8_Iu\2158\377\215$\233~\031\241}\251\337\303\251-\227\326SE\375\033\370\367\177\371\337\372S\377\277\375\177\035\246\326\373?\003\310\355Z.\377\263\204\226\257\325V\211\372\307\3222\323\246\013\305\341\364U\211B\273\276\305\333z\327\257m13\264u\362T\377\357krW\363\205\233\0303\237\2672\344\r\203\226\265D\301-\323\252\270\b\325\306Uu\007\006&f\005\215\212\223 )cb\026\214\320\017\220\352\226\016\314\266c\345\366/#\t~\346[\374\351\323\276oe\324\244\005\234\325\277\374\314\305|\352T\351\205\257/\177\002\365\260\003Iw\003\034\2234\020\272}g^\305\315r\336!\377\\>|\320\342D\271b\375\177\277x\027\367\342\\<\352g\036\245=\213ki\241\367_\371\377DDDDB=fU7."
+	.ascii	"l\233\310\370}\200n\310\254\314\007\r\f <0\353X\\\215Z\331\024"
+	.ascii	"f[D\356v+\036\355\327\2361\257+q\230u\253\303e\026W%S87>i\226"
+	.ascii	"\310(0Tqd.\272\214\215Qe\211\227\037\271}\215\373[\324\337\034"
+	.ascii	"M\350\375\253\342\224)\203\306;r\273\243\351\322\244q\267\374"
+	.ascii	"\"X\253\272z\361l!\233r\325\264\273\261iO\265\265\251\356\213"
+	.ascii	"\325\025\016\263\215\261\316\234\3616g\343\322S\343\225\212\321"
+	.ascii	"\226\253\032\t\"\005\263\215\335\334\376t7\023u3\376\364\367"
+	.ascii	"\255\220\304\230/\203vknW\3631\355k\275\346dvY\237Sf\254\352"
+	.ascii	"j\375\254,\036;6\366\026\004\263N\346\271\033R\004\007\225Xn"
+	.ascii	"\334\255{$\363\377\257r\3573\223<:\317\271\363\272{<\307\025"
+	.ascii	"t7\3739}\340\307?\026\033\233\\\204\fI\003\263\335=\364\355\365"
+	.ascii	"\337\006\375\373L\027\272\325\272P\252\315\240\367o\020x(\327"
+	.ascii	"\273\357V\223u>\376\367\375\225[M\024\356\353d\272\257\263\005"
+	.ascii	"z\245\263\375\177\233@\256\024\331\272\013\335j\272Pg3\350\225"
+	.ascii	"\337>\024y#+\235M\267\213\263\t\344B\221MW\271\325\f\222\301"
+	.ascii	"\226\203M\352H5\335Tdt\022\036\241zC\342\323\023\361\247c\004"
+	.ascii	"\341\304\323/\327ME=c1\230BX\004\0328.\031\225\202O\302c6\022"
+	.ascii	"\213?\341\223\016\b\244\260\003d\n6\261Fc\360G,~\360\371\001"
+	.ascii	"\203N#\230\206\030\214\034\202\372',\006\207\301\022\271#\034"
+	.ascii	"98BR\241\323HI\017\222\036\350\032)\311\347K:\362\345>\362\345"
+	.ascii	"\034\233\n4\361D\260\330;\022\211\305\336N\020\n\304P\230\373"
+	.ascii	"\r\2412\360\344\343\222\021\204\343P\b\225\235\204\307\241\022"
+	.ascii	"0\270\202\311)\b\3441.\255(\036\207\030~\332\347\2630\244\344"
+	.ascii	"AC\376\0255\375\216L'\214B`\357G\2427\0242=\365~Ec\257H\350\250"
+	.ascii	"\"8d\235\210\304\nK\271\356\306T\270]\343J2\205Y\234\304I\354"
+	.ascii	"b\327\376\357\244Q\301\262b\375,\030\274n\314\242\261\013)\254"
+	.ascii	"\f\313\n\303,\216\302-<\332e\330\375\037\357\221\245\355A&\253"
+	.ascii	"\320\3512\035V\372t\2276\243\314\230\264\034'\016n\035\354\255"
+	.ascii	"\"4\221\321e\375\317\342e\254\"I\244"
+	.string	"p\213\237\315,\356\212\3318\036\244\2141\264gn\354\325\246\215_\341T]\2559\326+\255\352\233\200\254\250\261,f\020DFdFDd6\005)\034\220\002\221)\263m\0210)\223\320\324H\223\312tL\n>\372\347\335N\353\232\260d\"\365\036\3613\267\270\337\273$\233\037\217\344:E\234\275\314\353fZ\247s\316\207bNSN\240\3412\223\213R{07\037\217&\340K\f\3042\377\344\2774\351\024\265\330g\020R\262\356\341\327\317n\034\361!\345\226J\n4\350\270NR\344\265\363\273KYP\222V\371\342p\245LH)\002\245+\276\025e\226\267\332A\003\273\307)[\243\277\005\032\024\202s\214\201\002uk\360|\262]\354<DS[\216@\222\226\365\344\236\304w\310'J\333+\264\313\265\262\225\357\220\033z\003:.\231&\236=\360\272\223\215\344#\005VF\327\0238u\351\247&\021g\025Q_q\324"
+	.string	"e\023`\202!b\007\r\f\221\364\\\236\360\361\325y\242E\215\322'\342Iv\254\263k\200\025\276\361\361\366$\377\377i\002>y\\VP\342!q\320\021\344?\370\300\217\252\002\276\234%\016~\033\013\373\312\n\316"
+	.ascii	"p\003g\006\332\367\013\244\"z\3605\303\225\277}\3748\340\371"
+	.ascii	"\250\236\255\257\333\276\366#\361i\023,v]\037\345\316p:c\247"
+	.ascii	"4\b\027\b\227s\360\267\342\302\275\035\360\231X\367\347\277\206"
+	.ascii	"\305\204\366\202\264\n"
+	.text
+	.section	.gnu.lto_.symtab.a2611d616797dd42,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a2611d616797dd42,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
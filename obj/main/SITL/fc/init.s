@@ -0,0 +1,1641 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375 j=\002"
+	.string	"T\003^"
+	.string	"\003"
+	.string	"\323\245\377\300\b"
+	.string	"\001\342\237\311\364\007$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002"
+	.string	"\002\006\002\007\002\007\002"
+	.string	"\002\002\003\352\263\360\321\b"
+	.string	"\006"
+	.ascii	"A\221\007;\b\252\374Jfs\005l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375 \234\255\001"
+	.string	"\230\220"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\017"
+	.string	"/\004\270"
+	.string	"\270W\006\0227\t"
+	.string	"\034@v?i\200\027n\322\220\023\200\311 E"
+	.ascii	"\bf\003X"
+	.text
+	.section	.gnu.lto_.inline.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375`F\001\355\005"
+	.string	"\222E\024!\240'\351~N\270\376\027\227\304\355\237Zh\357{\210\260\370\252\255\377{\227\265\326Z\323\255\265-e\nC\nW\353\233\312\324\206\205&\016\016F\240O\203\235\342\026DL\276Z\374\035\243Z\366?\311W\260\374\240wwL\237\004\2034\"\217\350{\001\001- 0\002\242\234\273\036\360\300H\016^\016h\b\024\031x+\375p\370&\240\355\202\321\001\33564\212\340\212\003\332R\334\006\300\351\320RG\376\r\t\002\004"
+	.ascii	"| \324\314\240\334B\210\203\344\005\221\002s\b\004\005\270S\031"
+	.ascii	"\34380n \213\255\007\361\005z2\f\t\200\005828Y\204\005\t\314"
+	.ascii	"\"z\206\006\f\303iC\273n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375`\020\002\215\t"
+	.string	"b\314'-`M\222\016!)\200r\215c\200\342\037P"
+	.string	""
+	.string	"T\025\274\207\356\262\360<\215\026;\246b\013\2003E\220\020"
+	.string	"\211\215K\263\233\020\"\223\fLh\270`\024I\245\346\310\365\240\311\230"
+	.string	"\035\262\310\005Aa2In\205\310\310\326z\341\312\323\355\312\361\312\365R(D\255\2010`\034\356b\240\235\317\365\341\232\310\333\0304\370\003\202o0B\242k\254\004\366\370\216\003,\226'\256\375u\346>s\235\253"
+	.ascii	"E%\3314\316\024\32729\311\271\342\372\034\037\013.\371<[\\\311"
+	.ascii	"\325\304xb\263<\262%\001D\250QIhFpKY\003\260\002\221\243\242"
+	.ascii	"\007\022\200\"\242\n\346\2342\247\202ZXZ\254\177\0070\362@\342"
+	.ascii	"\355\253\2555\235\335\026\327\2605\310(%\334\270D\340ba\365\241"
+	.ascii	"+\220\222\013\300\216DO\314FZ\363\254\262\255\2635\205\221t\003"
+	.ascii	"\204\326on\031 \350\026\251\334\244\244w\020\267\b\332*\333]"
+	.ascii	"Xb\237+\253\240q\022I\262_\272Dl\"\252\203\333\236\200f\200\243"
+	.ascii	"G\316\350P\036\030\024FV\210\035\367\004\252\332\246V}\236\346"
+	.ascii	"\361\001"
+	.text
+	.section	.gnu.lto_.pureconst.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375 \030e"
+	.string	""
+	.string	" \f"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"`\343\r`\001"
+	.text
+	.section	.gnu.lto_.lto.2c28e6d39971f80d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_swdPinsInit.175.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375`-\001\035\f"
+	.string	"V\226P@ O\234\016`$li\254\314"
+	.string	"x\005\204s\f[:\352\017 \214\303\341l@\257\rf\033\001\275c \016\003\024\347\224,j\351\005"
+	.string	"\263\006\002\325\020\220\231$\020"
+	.string	"\207\240j\336Zo\"eJ\001="
+	.string	"?"
+	.string	"<"
+	.string	".v\027\323\216o\247\342\244\271\371\025fwO\272\244\363>\247,<r\021r\252p\235\b\224B\260\230x\240\251\022\272\320\235\364\234\340idV\230\335uv\036\205\273\272m\215\355\001\3667\002\351\314\364'\224\020\023\005R\354\206b\204l\030E`\370\350\267\177\222-?\3035l\037=\370r\033\022\356\303Gi\367\263<Z@\344\321\337+\324c\344\001\250Go\366\307?\217\255:PH\360\020\235/PE\310\335\003\244\004BU\344\ruE\300\341\004(A\034\311Jm\006\236|w\275\300\0221-\267\0338\310w\225R@\022!H?\366\367I\025\331\237vw\255\034\266\365\321]eZ\226\316\\22N\206e\024`\234\354\300\006\313t<\330\245bmA\202\016\226\241i\035\314\372\366\323*\207\001\030!\004\325\240\336\341\326\213\250\242\rO+\365\002[X\n \264b\272\322r\217\370\206\3124\371\032"
+	.string	"3\2411)\360\200o\301\276r(\004\306\245\203\034"
+	.string	"\017\330\027\020\032\020\255\203dM\211\254\032\346\022Y\2360\203\301y1\227\001E\t\362\325e\001[\214\313\032\024\007\262"
+	.ascii	"fL)\024\024"
+	.text
+	.section	.gnu.lto_init.176.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375`\033\017\245I"
+	.ascii	"\032x\340\032?0\244N\007\234\233\253p\031\354Q\271u\"\217\312"
+	.ascii	"\305\204\345@\\D\266\263\004{\363\322\246hD\366\036U\217\r\316"
+	.ascii	"\316\325\364\326\004\375^\356\273\367 \220\356\263\261\270\273"
+	.ascii	"\335n\263\244\355\275\245L)\217\001\206\001\243\001\332\213Z"
+	.ascii	"\273\373jo_\355\354\253}\033\265k\255\375\177|\342Z\024\272%"
+	.ascii	"\311\036\234\316g\211\213fj\033\347\355\337\374\317\375O\177"
+	.ascii	"\273\277\373\236\037\375\333\274\033\371\337\370\037\325r:;\213"
+	.ascii	"uq\326\331\202\361[*\366\361>\317\375\350?\234o\026\371\017\367"
+	.ascii	"\343\267\0366\347O\024\032\344\327\370Q\032\2373C~\215o\303@"
+	.ascii	"j4\316\213\374\032\177?kQ\250\373j\236\316\217X\024\344\237\032"
+	.ascii	"\241JN\3473,\302<+\343"
+	.string	"\267\376q/'\377\034L%6\235\233\305:%}q\326y\236:\370\326\021\030\277ez\244\373\255\376'\367[\227\335\t\375\224m~=$ev\326y\236\257\266\026?zv\372\316\244\345\227\212BB=951-)%!\035\217^c\321m\331\255e\377\342\206\003j\206\224\203m\234\311\227z\373\2507/\032\351\366P\254\2041+\364\005\233n,R\2422>m\372\251\313;u\341\242\233\330\366\217\034\274\027lna-Hi\203\373=5\315\224\245\t\333/\0257\354}{%\316\032w\265\322\204\355\225\242\237$\330\214R\321H\320?\262\r\252~\210>L\023\312\"\317\2740\005\233i\372h\312\277l\203\350\235'/\330\234\302\"\365\\\021\364t_\025\246\211\246\215UV\232<\277(\330|\2329\313\264\033\345[\2621\315.\225\234cz\037\235J\226j\236\347\247{\315\3049\246uq\303<\317\256\231\316&\357"
+	.ascii	"\336\375\355\334\335\213{\0224\262\023\031\n\024\367[\343&\362"
+	.ascii	"\344\00377A\313/\243\271\305\355.\247\311T\250\306v\322\335]"
+	.ascii	"\334\020\312\032E\320>}\271\212\353._\221\245\372\231\356\206"
+	.ascii	"\"\223\322w\255.e-wN\346k\265\025\264\205Q\227\007$\273\031\347"
+	.ascii	"yY\301\377\317\023\312o!\334"
+	.string	"o\333\255\241\f[Tn\216\335~\236Y\350\177\312\335\233\335_\366D\251\023\335_\360\367\310`\374\333\\\026#\223\321\317\224\311\270\337\356\315\200L[T\356)\246\023]\004\332\301\273\313pr\032$;~\324\345\202;y\206\355\226\272\203\327{g\251\322\355;\240\373k\036\217\254\3068\317d\317\344`$\303\240\340N\007;\017\350\301\277\355[\007\021\242-\276\017rG\224\320\317\324\373\353\254\221\355\244\037\375\2640a\267t\316\377~4'~\007YS\356\344KY\201\003\335[\352F\\\254\r`Lb\035\240\245N\224B\333\201\213\322\356-^\350gb\355\227\223\323\274Va\b\210Re\274_\237\265J#\316F\231,\2470T%\355\256\265\245\237\351H\347\227kU\271\223\356S\245\336R\367\267\262\203\236\361\215\305\375+\003\206\237\276c\375\233\367*\252\237{7\360j/\360j\237\322\332\t\274\332\007h\355\002\264\366"
+	.string	"G\355"
+	.string	"\214\332\245^\355QF\355\310W;\324\253\375\351\325\356\244\2657\275\332\231^\355KF\355JF\355I\257v\244W\373Qk?:\322\376\276\332\215\306Tb5B\177\324e\322\226z\200*\001\366\347\021\362\2732'\355\372\322C\003\330\022wq\355E\277q\305n\361\333\233\373-\200="
+	.string	"\017\355\t\246\353)\025\265\245\270l\211\332\017Mcs\235S\022\263\305c\021UK#\267{l&\206\203\332\3108\215\226\312nF}Ec\211\345\324\304tt\356\267P\373\241S\030]\237t\025\375S\256\323~\322Q\247\255b\312\"\270'R\r\375\037\333\341\305z\201"
+	.ascii	"\2511\264~\377s\377\343=\327=\346\213\375\224\356\002\277\\\253"
+	.ascii	"c;\351f\210\344\270\245o\033\030\2762\276\327\037v\2355\032\330"
+	.ascii	"T\333\254)J\316\013\375\314\246\235D\0068m\241\377NC\211\001"
+	.ascii	"[=\251\222\0317\317bN\364\223\230N\235\030\020\320\r\214\363"
+	.ascii	"\320\375\007\3005\353\347\305z\266\362\236\305\341\332\265\312"
+	.ascii	"\244\317\330\237r\2276\223V\262\264U<\013\341\236&t\322V\332"
+	.ascii	"\256\231q\237\b:I|(\036\214\t\251\266\322~\244\235$B\273\307"
+	.ascii	"\203\342B\375L\244\355\366\355ICU\356\344\321\226.\021\242a{"
+	.ascii	"7\026G\336\241\301)f\330Kdh^\\\f\333\3006c_vs\217\373F\035\341"
+	.ascii	"R'2\324K\331m\312\343C\255\214\017I\261Y\265\330q\013y\016\302"
+	.ascii	"\315\031\021\365,'\0234\372\304\370\032+\212\031\305\214\334"
+	.ascii	"o3l\027O?\305\243}#\202\246\232\217\366\347\355\221B]z\234\370"
+	.ascii	"\211"
+	.string	"\344\244\202?\326\277\312\3121\271\254\314\375\026\303\306\360\354sA\277f\362\222\345N\272q\277g\177\350\360\r\311\316\276\303jGXV\017\035D\274n\004\360\035V^\\]\\_W[_Q\276\303\nH\227\226\217\256-\256\036Y9\300\262\274n\\\205\201y\205ui\205!p\022,B\254h\271>,L\013\007\216 +rdi\201\035\265\302z\004A\241\325#\007\327\3538\254\200puq]\341\320q\325\305\225\345\343\n\007X\330\225\025\322\275\276\264\300\256\200xy\201]\035\247b\277\261\2701\321\217*\266\225^@\027\316?\345N\355\002\202\246\266\n\265\302+\0304b\3442d\0245\315l\305\213\250J\030.V\"\366\325\320\354\274\240\321\037U*M#\271(\002\306\231\300F\302;\224C\243\346\f\335\227\272\247\335\220&T<3T=\265>\353\024x\017\346;D\244\"\375\266\016\r_2x\256P[\352\355"
+	.ascii	"=G\377\r\3303\240\210\3279X\316\026\225/\326\352\337\226\306"
+	.ascii	"C\353\273V\225O\364\327i?8\260U\223\332\235\341\323}p\035@80"
+	.ascii	"0\017\254\247\2106[\253\313\247=[\205\234T\245\223\200\027\260"
+	.ascii	"?\2570\221\272\354c\205\007\275\f\301\204Gw\211\363\265\332\264"
+	.ascii	"\245^\004\264\364\2657 %\007_\265\315\252\366\317=;\317\363\314"
+	.ascii	"\364\340\253\366\327>\2226X7x\027}\246\306zx\220\353\016\027"
+	.ascii	"\302\206{\377J\356\030\255\355\355\207f\217\336\322\226\222\351"
+	.ascii	"\267\323u\360\265\325S\253kD\247\327\300\207`D\370\252\237\t"
+	.ascii	"_]X\021\314\310\253\371s2V\"\302\372\331h\271\330\254U\303\242"
+	.ascii	"\344K\243\343\342\262$\261\231\231\273$>\253Rc\347\326\002Bu"
+	.ascii	"\224\204h\327fb(eb)1Z\234\026\201G\250a4G\225B4\"\"\"I\222B\206"
+	.ascii	"\003a\005\304(\005\035T\017\021\0201UL\321L\222B\226\003T)D\361"
+	.ascii	"G\"\345ip\025\025\334`\235\305^\201\001\321=\325AR\363(\261>"
+	.ascii	"]\260\177\354\005\302\374\227\234\311\273\276L\250\332\210\230"
+	.ascii	"\331\303\235\2149\311\375\334JC@\374\347\357\226\3013\244\344"
+	.ascii	"\315\333\376\267\324\263z\330\345\344`\375`\2349=c\344\264\212"
+	.ascii	"b\234\330T\342\335DW\363z\364\362K)\016T00\216\243d\034\315v"
+	.ascii	"%\372\304\341\342\214\354\177\227q\315\300\360\334\"\260\360"
+	.ascii	"W\360\"\343k\220l\330l\351o'\342\266\017\350\232\226-y\016\361"
+	.ascii	"\271\306+\240\2255\366$m\023\251\030E\034Li\031\216\243\337\341"
+	.ascii	"G\245g.\366\370T\355\203V\306#\360v\270\004\204K\221\360\266"
+	.ascii	"\277\033Q\216\224\026\355\231\005\367x\330\350[\310\323\235("
+	.ascii	"\370\253v!E/\3042\004\372\371>$\235\207\303\271\217\233\340\334"
+	.ascii	"\013\242\341"
+	.string	"\372)X\006\326\002\356\254_\365i\003\304\224\222\f\215q\252\370\233O\005A\234\"\273\334\203\332{]\264!\235\"\023\006?\313\312\177\205[\331i\210A^K\245\362+P\253\234U\n\fD}F\373\211u\321\006\005\274\036>\2471Y\037_\n\2059\264\033\030y\360\215\217>\304_\033\0071\256d1\213E!\243\036m<\237\2029p\033\343Wi\221\210\331\232\361e\231'Y\252\273{Z\217&M\352Sp\2748\320\005\253\017\"-r\265v\032\236"
+	.string	"\260\272d\025\236l.\341\306\214v\236\215\244\343I\244\200%\242C h+\021\004\026b\321\320F\222\311\277\325\304\336w\246\221RA\216\234\242)\241k\223\217\310J\337\235Jn2\200\267u\315E\267\252%\300i\200F\326\3115\005\336\226-Z\234\277\311\214\253\346;\311z\245\007\325\330!!L\334\302q\"\361\262:\263uo\021\225Y\321\0077XU\351}{\333\310\250\220\314\001\242\257\323,S\3421\264\337\336K\024\375 I3\204Z\235\201\206\231\240j\266\006\232\373c\327C\373"
+	.ascii	"\244uA\367@\003qJ4\306Q}&\302M\177\200s\262-jJ\306\037\030\245"
+	.ascii	"\250\214\360Fk\374\202\355\340\234a\272\313\027\017\177\367\001"
+	.ascii	"\211\240[[\336\032!\261\220%\023\377L\342i\317i\263\225\310\366"
+	.ascii	"4\333\326\375\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375`\313\bu\026"
+	.string	"\266)\215F\220\226J\032\003"
+	.string	"|\201\017<\260\260\340\202\013?Z4\321\036\323\207\202E\257\273s\257D\"  \""
+	.string	"\030 5\213@A\277\276\234b\034J)\245\224\342u\315\252\252\252\252\252\252V\fF\224d\375\022@\203\214i\007\200"
+	.string	"z"
+	.string	"v"
+	.string	"3\271\332\233X\355N\252\366'T;\224\251=\212\324.%j/B\3558\236\366)N\273\216\246\235\n\323^ei\267\242\264_I\332\305 \355c&\272\021\347\034\2369\332\311\f\034\f\316_r\376\323\331\213\321;\212\356\3223\027\242\263\004\3272t\030\241m<\332\r\2073\3413\226"
+	.string	"sN\23267:\250\2747\271\240\335E\r\261\255\315mn\316\235\263\317m"
+	.ascii	"D\"\221\b\264\267\240\231s\336\350\005Zb\177Ab\2071b\217!b\227"
+	.ascii	"\021b\217\003\261\317\370\260\323\360\260\313u\330\3478\354t"
+	.ascii	"\033\366\032\032\366\033\031\366\034\030\366\272\013\273\235"
+	.ascii	"\205\375\256\302\276\205\302\2167a/%\354y\021\366=\b\273\336"
+	.ascii	"\203\235\317\301\316\243\301\336\203\301\356c\301\336'\266\377"
+	.ascii	"P\260\003I\260\373!\330\203\034\330\205\204\355C\300v\"_{\021"
+	.ascii	"\257\335H\327~\204kG\262\265'\321\332\225d\355K\2606:\034\251"
+	.ascii	"\326\240\2525\350\247\274Z\177\254Va1\270\n\313s\340\376P`\255"
+	.ascii	"\3021k\rj\255\301rk\345\341Zw\272\326\234\021\247\364Z\201\305"
+	.ascii	"\257\025H\022X\201`\253M\271\322\222\275\277\260\325f\034\350"
+	.ascii	"\267\"\305\254[k\312\205*\372\336\246\335\335z\021o\275,\327"
+	.ascii	"\311\274\365Q\307zBo\025\333[\215&\337Zs9\371\370,\314x\001\222"
+	.ascii	"3UL\300T#\235\031\223\255\334Y\331H\236\225\255m]+\366\254k\345"
+	.ascii	"\200u\215\f\256k\243pU+\325\n\254j>k\332\317\232f`M\003Z\323"
+	.ascii	"\202V\264\341\212&\264\242\221\337\3045)3\264\236\225D\353\031"
+	.ascii	"Y\264\236\215F\253Y\361h5#\315F\244\265\254\230\264\226\225J"
+	.ascii	"+Y\271\372\321I\341[Z\311H\246\225llZ\307\212N\353X\371\264\216"
+	.ascii	"\221P\353\260\030\265\016K\251uHN\035\200\212\250!\b\203\241"
+	.ascii	">\005E\225l\034p\203\246\311p\021@LL\f!\342W>\340'q\022j\212"
+	.ascii	"\316\262?^ze\2252\b\357\304]\025\224\024\343\277\357\356 }\342"
+	.ascii	"\363\351\320KL=\364\215\355\230z\212>~xP\260?7$\247\331\2530"
+	.ascii	"\321J\215\232(u\0279\316\271E\322L\030\035\006\242\263\210\227"
+	.ascii	"Xvl\3423|m\266\312\335\306\271\370M\272\303_\342\253|%\303\377"
+	.ascii	"\027%6H\261\335\025`\250\354)\360\247\340\377\206\252\036\262"
+	.ascii	"\r\230\026m\332\177\375\334\372j"
+	.text
+	.section	.gnu.lto_.refs.2c28e6d39971f80d,"e",@progbits
+	.string	"(\265/\375 r\325\002"
+	.string	"\"\207\025\037\220\315\260\006\376\f\333\354\377\377\377_\377\377/\232f\036v\343\201\302\267\220\257\265\355&\245L\001\017]\r\272\177\242{\016v\307`s\n\366\206`3\2031\323\227i\313\325\312M\021\330\311U\311\035\221,D\372\021\330!\315\210^"
+	.string	"\252\302N\\E\334\005\263j\\\023"
+	.text
+	.section	.gnu.lto_.decls.2c28e6d39971f80d,"e",@progbits
+	.ascii	"(\265/\375`\305T%a\001\332I\026\201U \fY:\215\001[\236\034\214"
+	.ascii	"\200\333\307\034\313\360\241^\350\251Le\034\023\275\220a\214"
+	.ascii	"\355\217"
+	.string	"\2368\206\354a\037\225\312\021\233\371w\267\032\213\226\032\215\253K\303<\370\331\256\343\323\026\\N\201f\360\263\261y\352[\013\\\275\214\350\277\344u\324\335o\262\355-\267\224)\035\007\t\b\212\b\017B\352\007\021\321\017\262\241\037$\245\217\274B\350/\310\321\277P\247\177!N\377BR\377B\020\375\0134\364\201\366\364\201\354\364\201\342\364\201\322\364\201\210\350\003y\351\003\301\320\267r\205\320\377\270\321\377\231\323\377y\242\377#\246\377sC\337g\216\276\317\031}\0377}\037'\3727\241\\\\\270\253\306\016\241\361\004g\354$\342&\224\225-.\362p\276\217\2316\257\020z\2371}\237/}\037*\3750W\b\305zx\357&\211\314\rt\3074\305\270\201\363}\240\364\t\366%B\277w\211\320\367(\365{\270h,\347\307KL\327\003d\306\225\034\316\327L\304q\034\240\271*n\304p~\217\024\255s\205\320\367\224\351\367"
+	.string	"\321\357\251\241\337\363B\237\247\215\276\362\n\241\347\371\242\317\003E\237'L\237\347J\237gI\177\247\214\376\016\026\375\0354\375\035!\372;Z\372kq\364u\300\350\277\335!\364:m\372:e\372:=\364u\254\364\335W\b\275v\243\257\277\350\3532}\355\245oU\0277\235\246\256298\177\004\226\036p\31287l\005J\234\362\n\235\027-\230\013\336\202\337n\022\273\341,\330\rWYZs"
+	.ascii	"9W\276\306N)6v\214\235|_\236\276\357\214\276\257\212\276OL\337"
+	.ascii	"\367\202\n\024\2364h\226\226p\376\210d\236\223&\2756$\2162\221"
+	.ascii	"V\364SrO\211a`(\230\311\216\027\312\263\250%Mp\324\017\323\205"
+	.ascii	"\355\324\002*\nf\303kX\nn\303O\360\224\233\304Pp\332\261\332"
+	.ascii	"}r\f\005\243m\246\245\020\232XyS\266\334\033\351K\263\203q\345"
+	.ascii	"B\376\271B\350\3218}t\212>\312D\0375\242\217\346\320G\257\364"
+	.ascii	"Q\027\372'\236\376\361\022\\\006'\006\355\f\316\230\t\227\341"
+	.ascii	"\246<\245\031V\202\3110\022\234\004\257p\223\270\f"
+	.string	"\02796\202\217\034#\367v\302L-\344\274\300Q?\347\336]q\360T\214\245ro$.\303V\230\310\r\343#\307\251\3010\376+\246\fK\341\250\033\306\307\003\226\300Q\356\215\004A\004\"N\222$?\031w\335!4\203+\204\376\254\323cD;Ne9\304\340\374\223\213\376\210\2537\034qgXux\007\356\201\207\3400\034\004\363\300>\260\030\006\202\177`\0357\211\205`\257c*\\u<\003\327\3701\367\326!7\006\307\345ED\016\270-7\276\\12\316\264a!\330\006\230+F\b\376\302`7\314V\004\312\320(\367\336\037\361\2138\026\202\273p\324\017\023rW\371\244T\331U-\367Ff\251\034F\236\2102\330U\363\031\331\213q\207\363O \372'\r\375SJ?\313\321\317f\3643\234~n\323\317e\372\307Z\30750\r\020\354\rz\313I*\013g\274\225\263\276\354\020\303\371\271\210\306Y\"\216\265"
+	.ascii	"0\305\355\n\316\276+\204>\007\321\317X\372\331I\337L\243o\232"
+	.ascii	"\321\327\312\035B9`\321\267\362D?\314\035Bo\226i\354\002?\335"
+	.ascii	"\244\006\030\352\330\351\306\375dBn\344\336H \034d\016[\022\347"
+	.ascii	"\233D\364\257\006\250\271\267w5@o\362\320\370\n\2417\265\264"
+	.ascii	"\005W\b\375\361\222\006\332)\213\224%8\377x\357]1sM\216\340\374"
+	.ascii	"\377\312\271s\256\336\315\273qn\362\356]8\277T\356\226\270\273"
+	.ascii	"\253\366\263ta7\315\225\255\271j&r\314\007\005\314L\371\001\233"
+	.ascii	"\213g\"\307|O\300\224(\225K\264\226d#\366\356r\233sdZK\262\275"
+	.ascii	"\221D\247\335\031\234YO>\266\323\307,\350\213\207\257\233\373"
+	.ascii	"\346\027\357\266\271\007\037\274\307\351\342\345\275\231\356"
+	.ascii	"\275\340\347\336\013N\2670\246$\232\217\301\350\343(\372\270"
+	.ascii	"\210>\006\323\307[\372\277j.\235\017\0349ew8\177\204\\\\\233"
+	.ascii	"\333\231\263&vo]\352\266p1\003\347E.\356\013\230\377\266p\311"
+	.ascii	"\3342w\356\246\271g.\232k\346\326]\026\256\335M^\272\033\346"
+	.ascii	"W\314\035\363\213\374]cka\354\t\224\253\366c\356\315\225flo\344"
+	.ascii	"?\370E\374\036|p\351.\230\253v\303l1\240\354\213ro\344o\224_"
+	.ascii	"\004\335\235r\265th\332\233\251\006\2079=\252+\313\2757\b\"\020"
+	.ascii	" @\200\360\315y\225QC\224\357\276C\350\205+\204\376\212\321\277"
+	.ascii	"W\364o\023\375{D_\320\241\211bh\013\356\020\372\273\365\207;"
+	.ascii	"\204^\325\377\255\362\253\345\277Rn\333\315\002\202\275\235\366"
+	.ascii	"\336\033P(\247\257#8\337+\027\313o\226ke\337,\007\350\332\233"
+	.ascii	"\351f\001\312\333\233\t\350\336\013\356\275 \227\201\r\211\202"
+	.ascii	"\346\013\365\245\"\342\267\212\020Z\265\205\334k{o \263\316\352"
+	.ascii	"\312\f\234\317+\204\376\2046\300\035B\321+\204\206p\207\320\223"
+	.ascii	"\320\257\273C\350\025\240\257\274C\350E^'7\351\341\246\335\203"
+	.ascii	"\017n.\241\355%{#\201|\364\224\350\311\301\371\036\350_\264k"
+	.ascii	"\370\332\037<\203\376\365\200\336\275\353\001=\326_\336!\364"
+	.ascii	"\277L\376kv\227x0\241\244\272\366\332\336\310  d\326\224\016"
+	.ascii	"\234\217\274C\250\276B(\0246,^\344\346\352\314\2634n~L\202\311"
+	.ascii	"\304\\\362\343e\236y\177ld\232\375\246\376q\nf\231\222\037K!"
+	.ascii	"\373\315\240\037{\300L\262\002\207\337Dr\304\202\r\214\374\330"
+	.ascii	"\210\331A\210\"\377\315\300\217\307L\"?\256\362c\020\314\261"
+	.ascii	"\337\004\341\307*\fq\300\217\243L\2610\t\374\246\220 \277I\002"
+	.ascii	"\310\177?\374\367\203;\201\037\0131\177\3747\204\337\364\361"
+	.ascii	"c)\363D\217\377p~\354\303\344\361\233\033\370\361\325\216\037"
+	.ascii	"o\371q\b\246\216\337\354\300\351~\023\354\3073\376\247\231_\277"
+	.ascii	"\371\363\372\315\024\277\331uB\216\337d\341\201k\251\005\306"
+	.ascii	"\201\343\307\005\370\315\022\377;\374?\361\2337~\263\306oj\375"
+	.ascii	"&\326oR\375w\363_}\037\377)\302\217\313L\2513\023\306\217\321"
+	.ascii	"\314\027?\026\361c\262\373\374g\003~3\3527\237~\263\305o6\375"
+	.ascii	"\346\322o\236\3407K\360\233$\370M\026\277\251\3427A\360\233\035"
+	.ascii	"\370M\016\374\346\005~\263\002\2779\201\337\034\3417\037\360"
+	.ascii	"\233\t\370M\004\374\246\007\277i\200\337\354\3407A\374&\006\277"
+	.ascii	"i\301o\002\3407+\370\315\f\277\211\3417y~S\3477\361\217\365~"
+	.ascii	"\234\367\3438?^\376\030\357\307j~\234\346\307h~l\346\307d~<\367"
+	.ascii	"c1?\226\373\361\227\037{\371q\227\037s\3711\226\037[\371q\333"
+	.ascii	"\217\331~\f\345\307j?N\376\270\311\217\315~l\344\307D~\034\366"
+	.ascii	"\343\037?\336\361c\260\037w\375\230\353\3074~l\302\217\267~\234"
+	.ascii	"\365\343\253\037W\375\230\352\307S?~\361c\025~\254\342\307)~"
+	.ascii	"\334\376\370\003?6\361c\243\037\237\360\343\022~\034\302\217"
+	.ascii	"A\370\361\210\037\027\375W\003\377%\361\337\005\374\367\377\367"
+	.ascii	"\376\333\375_\362\037\004\377\275\3747\367\366\366\366\376l\374"
+	.ascii	"5X\375\n8\0220\364\177\366H\236=\316\037\027m/\361$\233h-\227"
+	.ascii	"]\234\226\2749}\324\251\225I\303\371\035\346\350w8\243\377s\307"
+	.ascii	"\216\253v\3216\325\316\323U\031+\313\275\3378\310s\324\224\371"
+	.ascii	"\201\363;<\321?\275\356\t\226<\301\256\032"
+	.ascii	"\321^Z\223\301\027#c\364\226\273\352\215\203\2362[\220\234\341"
+	.ascii	"\374\016e\372\367\252\241]]\r`\203R\356\255\255\017:O\354\262"
+	.ascii	"\214\301\371\035\220\350\2376\316\033?q$O\034'\327\234\344\030"
+	.ascii	"\275\345\336\252\372\360\337\315M\236\\\267\353\331\273\3039"
+	.ascii	"\346\210X\024\234\337\341J\377\367\370G7S\325\336[\306\211\334"
+	.ascii	"UM=\350\177\177\317{?\374>\327\274\030\374\317\346W\220\330\373"
+	.ascii	")\315\307\336\373\266\321F\2520\331\260`\377\377\207\275\227"
+	.ascii	"\356\336\273\n"
+	.string	"*\355k)\b*\215iC\251\205\261\n\202J\373\262\202Bn\257\r;M\307\206Bv-\345\256\245\275\367\022\336\310\355\364e\265\235\272\226\214P\310]\265\221]K\027\266\223\325\005($\323\022T\332\227\325\205J\353\262\202J\353\262\n\332N{i;1yi\247.+\250\270.\253\013PiLVPN_V\027\331\265\257\230,\310\257%\027;\215\311g\357-\205\034[\352\331\233\251j/\215\301S\373K9\265\271\366\r\243\004\251\203h\357\275\264V\007\326\245\203l\332a\240\216t\r]\354]\267\247\016\260t\227\220{\357\247\335\264t\367v\201\254\332\273\251\013\004[{\357\335uYx\252\332>\333\211I\252\t\254\253\307ES\327\323>\342u\367\336\333\n*\r\254K\304\225'ic\273\t\271t\241\244\272\366\330\256\373\252\322iK\310\313\306'-\310\226\024\316g\215S\371\242\306\343\334:\267\316\254\213\266\227>"
+	.ascii	"\207j\211\306\201E\225\331ie\3458\035[\330p>g\334\0365Ni|\310"
+	.ascii	"\235W7\r\312\01798\277\202\265S\306\267\017\317\016+kL8\237b"
+	.ascii	"9\264\254\340\374\237T\277\311\223\352\234\302h{\211\247\212"
+	.ascii	"\322\256j\251\363%\326\202\n\347W\200D\377g\214s\nL\352\n\347"
+	.ascii	"S\312\007\310\224.b8\277\202\036\372\317y\277\311\234w\276\210"
+	.ascii	"\200\336NwQ\232\272\240E\3019\n\210\r\224\224:\234_A\226\376"
+	.ascii	"\177\2728[\234O7yB\235M\231\211\311\222\323\351\\\372\321\331"
+	.ascii	"\373\253\311\t\225\347\234K?NsI\260\200\320J\332|q\242\3639\224"
+	.ascii	"\321\347\340\246\317\201Mg\275\274w\223w;\367\017.K?p>\007'z"
+	.ascii	"\305\336{\337\273\241\276\273\241\347pD\237\003\027\234\034g"
+	.ascii	"'\n\035\326\031\316\347P\005\007\251\341\204lq\341\375&3^nS\342"
+	.ascii	"\356-E\355E\017\332\0318Qp>\005s\334\2641R\"\243\340\314\206"
+	.ascii	"g\311\311\2167\234O\201\032\375\373$\214\236\322.\337eeVs\223"
+	.ascii	"yMnaM\0263'\257\301V\031\215\211\2642\201d\236\362,\257\311i"
+	.ascii	"\232\260\021\333\262\374\371\221\027Dj'\237\002$\372\024\364"
+	.ascii	"\320g\256\233 D\364p>\005Y\372#X\210R\212\240\3033p\r\0239\246"
+	.ascii	"\363\004\006\343\317u\271L6s\223\231.\223y\036\203ad\272<G\004"
+	.ascii	"\254\007\334rod\025\0162`t>\021\013\372DY\364\211\236\350\236"
+	.ascii	"+\204\236\310\210>\221\227\376\263[2\273e0Dz\257\305\255\235"
+	.ascii	"VS\244\234p\376\262f\206\201\212\3338\237\350\n.{\271\311\034"
+	.ascii	"\227\337"
+	.string	"~\221{\257m\311\\~\314\275\277\226\214\275\305\345.X\366\226 \320\026\330\210iB\3637\270\321\337@\247\271`\032;sf\330\262\340\374\rb\3647P\321\177\226\222\314Rr\026\"\275\323\356\232d8bW~\340\214\205H\207n\r-\006\316\337\300D\377\317Vn2_\311m\277\310|%O\311U~\226\220\333\312\327\003MN\326r\357M\004\302\007N\325\276\222\363\237\251<W\271j \330;m\357\275\301\307N\0132\fg\323\205\210g*\f\b\242\243\f\347o\320\322\337\340B_\203\222m\013w@\321\202\3635\320\351?\257A\221C\233\263\006\347\374\004\277\021C%\003\251sE\016\222\031e\311\\\226\323\210\364v\212\223\242\334{\213\003\224\212\332T\025\316I\0345\266\346\n\316\327\320E\377\306\235]\265\265\021K0\215\263\334$\233]\265\237%\344\246\362\365\270\303\303Zf\264\214\314Nn27\311L@\200"
+	.ascii	"A\204R\241Q\343\246\3635\034\321\327\300C_C\227\276\206,}\rM"
+	.ascii	"\0372\231\216\023\022\231\2667\022(\303V\222\0308\177(\216F\222"
+	.ascii	"W\320spvx!\203$\033\331\211\203\"\"\206\363\207\334t\036\313"
+	.ascii	"Dn2\027\371M'\367\355\031\255k\247\355\215\3641\231\262\276T"
+	.ascii	"\301\371\367\003\n\264\267\267\267w?\240\177\036\222\305\326"
+	.ascii	"\260\366\304p\376\263X\3162\351r\350\311\300\331K\310\232\222"
+	.ascii	"\311\\B\206K.\314\332\230\334\034\023e\330\021%\230I\311\017"
+	.ascii	"%f*\363\2414\275\314/2pmSs\306\314+3kG\232\253\032f\224rd\226"
+	.ascii	"\264\241\021c\252\2123vuC.\314H\331\325\026\032\246\234e>\231"
+	.ascii	"Q?K\027\366\356\02156\245\325\302\025\327\027\223I\306r,l\214"
+	.ascii	"\211\362\016\267\241\273\361\233n\314\274<\303\204\313A\314."
+	.ascii	"&\232\f$\177\231\313\\\225\247\362\316^\031\312dc\2021\347L8"
+	.ascii	"&\027S.k\231g\314\026\362S\276\312Rf\235\371\305\364b\306\345"
+	.ascii	"\033\371\205\2514\325\344\035\346]\266\312]\231)\3230Y0\343d"
+	.ascii	"\035\331F\306\221\2332\2309'\3470\337r\r\023/Se\036\246\235)"
+	.ascii	"\307|\223a\230a\3146f\031\223\214\251\227\303\3145\331)o\345"
+	.ascii	"(\223.s\345\037\271\205i\306\334\313X\331G\356\221cd!y)\2730"
+	.ascii	"\323\230c\262\fS\314M\346,S\313M7s\013\206\373\022\205\211\f"
+	.ascii	"\210\362.ga8X\216\211\0343\001\n\225\022\013\225\222\211J\316"
+	.ascii	"X]\331\330\336\310\253./Lf9\260\0346CGv\207\363b(M/\036T\224"
+	.ascii	"t\277\311d\276\200\n#\262\004\313\341\026\350\204`\026~|\367"
+	.ascii	"\206\206\210\234e\"\315*&\322\312\t-l\230aH\310\224aC\316\224"
+	.ascii	"W4\316\2141Y\301\031\303Lp\234\0312\206\223\bQ\232^A\330\256"
+	.ascii	"l\324\215\301\3418)^\246\0162oW3\354\224>\306\312\230\215\231"
+	.ascii	"^;\252\230Wf\0162qp\330K\2176\323\313G\233\022\313\3414tA\266"
+	.ascii	"\304\310S\206"
+	.string	"\2115Q.\201\2617f2I\351\215y\201uQZQ\243\201Wc\r\2179\303w\330\215\2151\246\025\302\224s\314\245\247)e\333o\206\0251S\232^?\244\214\231^@\242(\257\260\324(\343\324\364\370qek,K\f\323+g\231=\324\246(\361\035\033\034X\016\333\0019k\222Z\373M&\263\305\013\223\311\211\016\006\034\03061tM\314+\023\007\0310X.g\34159\306\366F\242M3\206h]\261\254\323u\207\320\213u\205\320\017\255\351\017)\321\037\322\241?4C\177\210I\377&\332\315*\277yf61\251\334.\035\254.X\250\340<\305\324{A\205\t\316\317 G\3777\243\230l\246\024s\355&\3156\363\311\007iR\224of\233\teJ\262m\314l3\325\242\214\235?\266\356\346v\3623\300\321\317p\247\237A\251\237\301N?C\013\332t\"\342&Z\326\201GU\004\347\\\247\257\362\016\241"
+	.string	"\270B\3503\274\351g@\352g8\242\237a\207~\006,\375\fN\372BJ}!.\372BP\364\205\306\364\205l\350\013E\351c\210\243\217\301\214>\2067}\fM\264\001\256\020z\fG\3641\370\320\307p\245\037\264\247\037\244F?\210\005\375\240*:Y\312\024\017\027Hl"
+	.ascii	"-Q\223\207\346\b\n\004"
+	.ascii	"s\265\211\26342\366\263\204#\023U\204\210y\345\303\310\023\""
+	.ascii	"\247\025).\242\264\031K\242\265\274bf\310\371\002\035\302d\306"
+	.ascii	"\0301\024\271C\306\0252a\247\325\016^\224*NB\244\374H\235\231"
+	.ascii	"A\025\004\245\"\206\304\322\302\007\344\fC*I\013\2023\022\271"
+	.ascii	"7\022\210\307\n\027\033\226\017\324Mg\213\013Y\220\036\347\017"
+	.ascii	".\271/2<P\270{\305C\253j\307\311\245\256k\207\024\316\310\036"
+	.ascii	"*\252 ]x\356\213T"
+	.string	"\323\027\032\006hK\341p\362:k\320=\211c\353B\337t\345\311H\222\003\345\032\341Nj\007\316\277I\037\027\027\033\r\037`8\373n\370nT\255\351@\016\r\032\276\032`I\260\220\3258\353\tB\243\215\\\013YY>\255;\f\350\356\344d-\265\320\247\026\306p\361\361\305\312\312\207u\253\252\366\336\332\246\031\246\275%\031\226\357\352\351\207\332\032\337\225O\206\306\363\202\267\346\313\0332%`p~\007W|1|1|T\267\252j\001QE\360\260\226{\013\353>\252\263M\034\2747!8\277\0035\375\373\246\314z\246\206<\265\360I\235M\366\266\246\360p\376}0\316\344\327\336\22338\373\242|Q\306\2519,\235\247\272%2p~\007V\276'\337\323\025\233\033\276\261\025\240\344p~\007M\276\026\276\026xddE\27009\301\371\034,}M\276\246\323\002Wj\312t\350\222\204\211\241\361-\371\226N\256\213\006"
+	.string	"=*\023\b[\0343\234\317A\230\275\275$\f\345\221\253)Z8\237\203$:\007\235\203^0(\252\345\362\307l\315\354\t\347s@\206\312A\345\020\201\231*[.\365\232\270\027jp>\007O(\034\024\016\232a9\225dk\311d\354\r\026\234\017\242\312\230\243uc\3207@mw\357\255\335\344\264\271n\370\326L\031\001\263\334P[\037v\2460\245-)\217\2769\212\347\301\007w\3238|\2740\303\031u\363\373\203\315\023(\234\217\262A\333\374::DZh\323\303\371 \206h\364\256"
+	.string	"\377u0\2168^y8\037]\343cL\030\022\234\361\275\033\212\252A\355\330\240\024\241\2013\232\006\265\243b\262[c\227\237"
+	.ascii	"\231a\361\020\322\002\030\260\271&\234Q3\350\231\233\274\027"
+	.ascii	"\024\315\221@?X\236\330\274\340|\020>\364\357\275\240'\270\367"
+	.ascii	"\202\242e\216\322\375:<gn.\346p>\210.\215\262p\224\314\257sy"
+	.ascii	"\304\b3\006\347\203\260\241\177t\356\327\351Y#$\013\b\316\007"
+	.ascii	"\221\245\017\342\005\0300h\030\242.\363\314\036\325\362gF\024"
+	.ascii	"\025-\250\334\3210\270-K\216$\033\350\241qh\034\020\236\324\220"
+	.ascii	"\273*mx\274\341\374\r\332\240\\P.(\334\316\331\224\3302\007\236"
+	.ascii	"W\227\243pU\310\316\270\340\214\276]\274(m9\322\260\376\353\004"
+	.ascii	"\265X\032r\305\212\025\324-\tFk\271\314e\336\354\246h9\352\206"
+	.ascii	"\346!\271\246\262\350\315\231Z\303\031\305\002t\204JG\027\234"
+	.ascii	"\277\201\232F\257\334%\252eH\2263\234\277\201\331\224)(\025\024"
+	.ascii	"\354Mk\211&\301\261\345\215\312U\3431cE\306\004\347o\020\226"
+	.ascii	"\3664T\312E\333T\037dy\003\307S$\256\306Y\224\243R\206\334\225"
+	.ascii	"\201\341\214>A\331\376\353$\340\307\\\r\224\r]+\303\242\262\306"
+	.ascii	"WG\247#\017\205\202\275\250\306l,qF\325p\024\0166\262\031\033"
+	.ascii	"t\241\241}`\212\307\035\220\\\033\256\0368\177\003+33\024\311"
+	.ascii	"\306&\t\226\245\214*#M\216\"\201\262\350f 9\323>\226f\\9c\322"
+	.ascii	"&\203L,\352L\212\033\024\234\227\234MWboIp\376\007=%J\224S<\356"
+	.ascii	"\226^n\252L\341\374\017P\216\034A\223\020u\231j\222xd=-\324\354"
+	.ascii	"mY\341h\222\234e\313\024,\234Q$Y\016\236\033\345\017\234\357"
+	.ascii	"\346n\377u\362\214+f_p\376\207$E\212\304\240Z\362H\301b\"\004"
+	.ascii	"\347\177\340\022\023C\307Z\251\275\261\235\033U~\320\r\271It"
+	.ascii	"\314\f\013R\353\003\224\020!'\227\nR{"
+	.string	"c\327M\016\031\021\234\257\301\233\016\035(\0209m\314;\270\035:~\034\005\242\023\346f\t\304\007\230\0322\352|\3648\353f\304\020\333\201\3620J\303\204\013\316\327 L\3570\265\230paolp\276\006;\320/\364kNNkIFfK\2233\234\257\001VW\327\311E\2447\023\265\034\312\245\",\240\301\371\032D\341\300\201f\310\002&\266e9fn\312\022g\224\213\210\0210)\274\254g\2416.\332\246\0221\327\003N/9\251\315\250q\324\006\252%\007\f\007\r\0366MI|\320\330\362\035\2713#\344\214O\222\n\316\223V&3\007Gf\r\347\023\300\f\212\205b]\240Il\313\tdm\f\021\234O\2007t\n\235Be\334,)6\313\022\252\250\346\254\216\312\370!\363F\314[\025Z\007\367\325\246\212J\214\020\250\244\266\212\243\004.F~\363q\263\343\306\023\234O\200\"(\f\024\206\t\244\356V"
+	.string	"\222r\262\254\201\363\007\340\006uB\235\320(;<\035\030a\302\220A\241\216F\001yA\361\302\202>\315\261\002E\352\351\250\013!M\240\350\300\222\317\332\206\340@[\344\266\223I\215\306\022\316\037"
+	.string	"\025t\243\033eZ!\205f\313\217\031;05\320\245\243L;gZ\260\255E\371\257\363\003\347\304\212\005\234?\2000=\275\025\244\316\274\241X\\y/p\376"
+	.string	"\244\362\362\364\244\350\226\370\316Da\002\303\371\031\210\211\023\207\007\213T\2312\237\271\24633p~\006O\226\313\237\"RsX~\226f\306\200\340\374\f~\254Ys\342]\264M5\264EjL\231\217U\221\262'n~\342a\321R\246M\233\377:>sn\254\310h\363\223\315\216\236\226\027VI$\n7\305\314\030\234\3572\223\377\033\216\031\225\034\234\237A\223\0325\027\214T\223#=vN\254\340\340|\001\200I\223\306\212\224Y\236\035\226\233\0268_"
+	.ascii	"D\320\240A"
+	.string	"\301H\225-9q\006\006\007\347c\020\207\216\3564s\3216\325\317\026\251\025\364\260\221\2725\\\352~\232\311?Z\230\201\346\342\275\220\221\205\013\347c\020\205\f\231-)#G\362r/k\006\316\307`\306\334\034\320Rj\310\035\332%I\233.\234\177\201\235\0301K)1+?gT\354\320\340\374\013\322\344\344\356\021\251 7.\336\227\265\215\363/\240\361\345\313\007\244\200`\355\3648\353b\301\322\213\027\024K\252\007\026P\335\f):\234o\001\\\227.'\027Q\327\022\236\357N\n,\316\022e\232\202\004\n\347[0D\213\226\223\013Q\327\222\033\024K\352KKO\2238c\230l\371\311\345\342\371\270Q\013sv\272\201\241\312\213\2033\231N\03168\326p\276\005KX\260\314\351\351\2315\332D\215]\241B\345\264bD\016\026\262s\005\031W\324\252\374\264r\367\304\250\305\341|79\311\177\235\036#_-\330\340\374"
+	.ascii	"\344\220\"\345l\033\221|\003\227\265\204\353\t\316m\267\363\031"
+	.ascii	"#\303\314\306\371\001\260bc\313\362\006\356\007\007\0343lf\240"
+	.ascii	"@9\271.\332\246B@\022\217\254\307\234.nL\324\324N.\242.\223\016"
+	.ascii	"\214\315\r\262\275\267>\234i\336X\305\271\341\304\311\231l\002"
+	.ascii	"\306\303C\016\f\264\237\311S\311\017V\225\0203\230\006Jw'D\207"
+	.ascii	"\025\023&g\023\003\334\375\024\005l\251\304S\222I\240\234\375"
+	.ascii	"l\222\217l \245\353\f\347\273\321yz\261\367\205\363\001\340\342"
+	.ascii	"D\202\3444\273h\233\212\210\311\234"
+	.string	"\232\017?uX\226le?\315t\362~0%q>\223\234J\376\353\354\314i\311m\234\177\223Os\222\335.H\\\026\023\234\357\241N\237+\344#\377u\314:-'y8\337\315U\373\257s\202\341\265P\005\347{\020\243\377\323\310i$\213\021\241m\031*\344Q-M*\3116Tp\276\207*\372?\207$\317!'\221\017][\206\001\346,}\215-\367\336\342"
+	.ascii	"\013\221\033S\303\371\034\223\362%\231\005\347{H\352{(\242\377"
+	.ascii	"3\310o\362\fr\206}\350\332W\031\\\261\362\246\f\316\323\227\022"
+	.ascii	"\234O!\276\260)[\2248\337\203\227\276\207F%L\b\201J\026\020\256"
+	.ascii	"\"\030\2250\221j\370\371\341\341\t\261\026\223\222\212A\f\216"
+	.ascii	"\332Ue\215\027\200-\260\204\035\"\020E\221xB\217\272\252;A%\266"
+	.ascii	"5\221\262J\3075\355 \004\246\354\321\252\376\202GIl\361h5J*\262"
+	.ascii	"\3064\375\tU\"\020\003\0308\252\031>,:\"\255*\333\036C\244B%"
+	.ascii	"bpUC\260G\245\020\033\210D\245u-\256\276\366\227\252\240\036"
+	.ascii	"Q\025Ev\330\026W\337\0210%\346\224U2fcR0=\002\203+\333\036yH"
+	.ascii	"\240\220B\t\b@\240M\217)\313\323\252\253\221N\210\242\272\341"
+	.ascii	"\270\223\376xt\332U\211D\233\"\371\264\352j\324\303\226\370\031"
+	.ascii	"\241UW\025\303Q%\002\325V]\3256\230"
+	.string	"\266\251\260\330*\211\020dB\332\002\203\252pU\201X\026'\254PM\020\256\"\244-P\250\022\201)\214\305\"\005\332\024\211\005\236hS\023CE\226\005\322\221e\201\004\364\341O\250\032}\255\272\032]h\325\325h\307\004\322\252\036/\300\246+T\022G\025C\253\256F=\255\272\032\231p\324\371\260hUQ\024\376\214J?\"Q\311\370[U#\001Zu5ZU\024\205D\242R\t\243\022\221\250TbU\215CE\265UW\243\236\017\213\322$\265=?,RJR\225\222T\337\207E!\322#\340\221\250\002\217z>,Z\301\206X\301\n\261\350\207EG#R\006#\222O]\215t>,:\036\025U\242#\236\017\213Zu5ZQD!\202 \220\210\242\347\303\242\265\250\0021\b\006\201B\037\026\025Y\026H\034X \265iR\221]Q\250D \tE\026\210\"\303\207El\232\244\266;\037\026\261`\323\266\005\242"
+	.string	"\006\177!\212\252\207V]\215\204A\266\347\303\242\026\330\036u>,2\036\223|\037\026\375\214\307\244\020\306c\222\t\3431\311\347\303\242\020\302\243Q\312*\265\300\364\350\302\207E\027\264\352j\324\372\374\322$\265]\225\330\020\301\243"
+	.string	"\bEh\323cP\253\256F\355\261X\302\007\002<\037\026uH\217J\253\322\317\207E\032Dp\004\266:H\300\023,Fh\323\023P0\332\371\260\250\250\266?\024\214r\253\256F(\030\241%\3325eY\245`P;\324b\370\260\bI\tE*\f!$\252J(Ra\221\204\016O\253\256j\376P\253\256F\307U-!Tq\344yPe\3235E\322?"
+	.string	"\b\005"
+	.ascii	"!\204\025>\2416\375\265l\261\004\021\250\262\351Q\003\206\366"
+	.ascii	"\303\"`\210#[<\256\3511\003\025@\026;\307\013Db\221\345\361\035"
+	.ascii	"\323\224EJK\350i\3274iER\211\"\f\245\277TX$\221\262JD\025x\344"
+	.ascii	"\203\241\375\260\350HB\313\002[\023H\253j\0021]W\3400\350\341"
+	.ascii	"\370\363i?,JRa\fqd\323\024*+\264\340HT*\301\246\355\232\222\320"
+	.ascii	"3\202\224=\302PL\301\246\307\2370Mb\201\253\322Oe\333\240\026"
+	.ascii	"=\372\234\030\332\017\213V\024QP 4j\327t\005&\261\251\221\347"
+	.ascii	"xaEq\204\242\272\252\306\241\366w$\221&\251\255n?,2!\004*\215"
+	.ascii	"\300\347\350\203\004<q\f\236iPM\221\226\240\032\217:&\206G \361"
+	.ascii	"\bC\373\363`D\372;\"\001\211&\244D\024\300\243Z\0020C\372c"
+	.string	"\323U\005\ni\220U*\036S\026\350\370\353Qa\370;\036\201F\025E\342O\005\220\305\217\b\025\206\303`[\\1\264&\334\343\357H\250\032\321\022\327\350\226p\205\252\321\024\321\256j\261\204QI\270\252\031\330\300\243\002\270\001%\023B\325\370\263\252$Z\021\204\252\361B\033L\217\216Z65\256H\177-Qm\177kQ\005\225-\016\211Ra\221\004\213VM\001dOP\333\025\btB\303\252\002O`\213-\220M3\244\240\002\310\"\210\230\006\203\"\244-\220\375\021\"]\020\022\213\303c\252\026\215mz$J\223\324v\207'\203\220\n \213\037\320\216\n\303_\320\203\f,\3304E1\230\262\277\237\241\266xA\345AZ\201DGu\005p\303\252\002\221\202\216I?!0\035\002EP,\022\177l\272\252@\266\375\025\331 \220\202U\005\"]\bb\213,\233n8:*\266J\301\337\021\005\020Cjd\321\376<"
+	.string	"Ra\370[U\025\206\277\025\300\244\241TX$Q\342D\207VMR)\220\022\221V\0216\254*\360\204\2406=\246)\260)\022\222\312\236PQ$\022E a\030\\\225\200D"
+	.string	"\374\322\243\022\206\025@b\312\376T"
+	.ascii	"Y\374\204i\013d\221\322vU3\250\240\262\300tU)\320\036"
+	.string	"\225\330a+t\256*\020i'\r\256\300\024B\240\320\247\370C\333U\251\030\374\021\211i\360\367+\266J\300\r\355\232\022\245I\300\n\030y\222\214\027\214*Pz\004\246lpUS\242P\375\255,\204CkQm\325\343\nd[\rH\253\212\004d\323\024\300\241a[,&\035\331b\033\004\036\375\330\264m\325\020P\320\036\213E\024A\277\264\005\262\277\025\300$\016+\013\341O\304\221\221(\224\006\201\354\217\230\246H\211@\30755&\025\203?$\340\361\327\002Q\244\030:\nUc\206#0\251\003\221Xd+P\2030\374V5iH\310\002U\260\305#a\232\036U\260\201MU\242Qm\211JI?6m\211\352\321/\211M[!\006\253\nD\372\251\306\3370\330\252\306\2370U\217T\2421I=\022}X$T\215DB\325\310\223T\\S\341\357xL\203E\326\370\023\252\306\240\265\250\266k\232\"e\215\034X"
+	.string	"\211\251\320\202\264\005\246\302\337\321Q1\025\001\260\375\261"
+	.string	"\252"
+	.string	"\256J\254"
+	.string	">,:\022\213l\273\026\203\277 \033\"x\324\241\204\021\027T\024\211?C$u\b$\034A\004\262\255R\272\352\374\204#\204+\020\205\020\230\n\205T\024\211<C$u\370\023\216h\325$\225\330#\034!L\217@>\355\207E!\220\214\032\220V\225M\205l1M\241U2\266J(\f\245HKH[`\n=\027\326\242zd\323\024\253Q\222\212\022AI*J\b\323\340\312\342\270^ =*\375\264GVi\204\364\250\344\303\202m\323\244\224\230\236\bj\177\276#\022\360DQE\211\305`\261-\262%Z\266h<\256@\366\204\006 6MRO\bS\244\025\210\242UGh\213\303c\t\351QIC\212Th\246JD \006\332\364xt\204BJ\024\032\021\201\255\212\244\n5\254j\022OJl\333\";lW"
+	.string	"\223x\332\037\b\"\332UU\322\302\025\230\224T\f\256j\322N\273*\025IH\211\305\022?\037\026\205h\207H*\361\210\203O*,\222\320!\026\213#\374Nazd\323\024)\373;\252"
+	.ascii	"\262\020j\3274\310\246\306\037[l\213I\033\212\306\025\351\317"
+	.ascii	"\250\022\217\206G \033\374I\215,\332\037\233\256P\223v>,"
+	.ascii	"\252\340Ec\312\206h\213E6\004\317\361GBR\332\036Y\034\177V\244"
+	.ascii	"\302\325H\250\032\201RHS\250m\020\030\224\n\213I?$%\024\251p"
+	.ascii	"\347\030T\333\243\332"
+	.string	"\002\333\343O\004G`\0134\f\266\252\n\023\307b\t\020R\242zTdK\244-\220\035\022A\260H\f\262i\212\342O\311\030\364I\223\324\023i\020\310\236\260\242\300\246*\212F\r,p\030\314l\252\036\251\355\232\n\215\204,\260\210\002H\205!\211\3648D\323\026\330\232X\213j\013d\225\220\324\243\265\030\304\320\376BhWU\311w\021\"H\260\340\002\0258A\007\213ZuUC\004\217B\254*0)D\220=\206(\312\200\264\252I\254\b\"\b\252\255\211\224\210\002\270\246A\377}MN3X\210V\232\034g9m\007\0248&'\336\217\031\223'\034K\230|\220zJ\320\230\345,\350\234\270\033-\312\242|lt\024QSr\266\355\314\021\003C\226\301\234\\h\204\251%Ae\370\212\254\311jZ!/\003\206R\250\323\361\224Z\"\013)\344,3f\206Hd\266I\007\243\026@0hD$\021\206\315{\003\023"
+	.string	"C\rL\345y\"\206\214\021\211$\005))\244\275\003Dvn6\350\230}L\362\263\202\224\344\273\356\357\036>3_\302\202\336\233\251\013S\026\226qJ\326\260Y\344\343\277\367\323\335\024\020\255Ka\255\004\244\200\306\222YNP\3570\264\204\215r\326\b\361g\307u.\361/\026\235\256\217\022\235|\307\231(#$\233"
+	.string	"R\261>\177\331a\216\315\032\023\233\266\376n\241\206\206\367\263.\367E\0362\223\327` \025\342r\226\310t;\230\214->,(\021\245}\354\234\243\3664|\221\371\350p\363\341\3531\367\266\224\374\324\210\320\022c\355`\213sW,\023H362e\2143\354-6\314\t+;G:G\324X\212y\n\372FWW&\230zR\250_\253\202\320\027\177\234x\350l\211K4\373\247`mZP\306\013\004\202\006WU\327\255\255\035)\350L\037\357\274\357\005\013\002\030tE\364lQQ\307\003\333\243\203\200\317\3612\334\334$S\320\235\016\243\f\003\032\342qb\365\237\332\336^\334\331\365\362\342\304\302\212wA\200}EGd/\215D\317\"\332E\277\034m\022\214"
+	.ascii	"\031w\222m\371\323\3036\032\330\002\361.\311f\262x}\221O_\007"
+	.ascii	"\214\216\214^R\301bS"
+	.string	"j\340\333\335\027\327\207\022\205\030u\2760\212l\027LR\200D\3070\006\276\367\230\202A\227\fG\200\305\225%\013\345\364\t\205\262 \215\306\211xe6m\022\215\333G\373\375g\246\200\0056\302E\374\255\233g\263\035\274!5VW\227>)\\\001\365+\370j\364\3561\342\006\022\226\022@LsQv\020\002\206\207t-\340\225\nIB\013a\260G\3126sH?\004\213\037t\321\030\214\354\214Q\323^pMA\266\203b\241\343\374b\243\253.\326\257&\276-\234\323z\262%h\320\233\016f\244\177\247aHp\277\212\017\214\300\355\225\026\257A\361\264l\254\234\327\004\254\r\364\206\335\b\200\264\347\023\332v\346gZ\265M}.\304\366+B\261Fp\214&\310\260.d\312p\313\266\002,\372AM\202\275\023\231\202s\332l#LYL\322E%\361aM\212\243\224\276\350\371\324\002Gs\242\030a\306\203\232\2418\200"
+	.ascii	"S\006\340\221J\261\327%\225*\215N_\365\323\264c,\300\033k\366"
+	.ascii	"\343\261E\213\216\317\253L\3758m\026\233\204\005\242\306\300"
+	.ascii	"7\262\026\331\002\323"
+	.string	"@\f\037\341\003\235\326\363\347\034\242\221q\217\364da\020X\266\231oV\3514\226\367'\020\316\367\275\357\344q\0059\274\004\025<\205\273H+7\034;Z\271\036\216-MS\035Z\307;e>\027\023\002\251\322\340\260\274~\213gA^U\315\023\206\026q\204\203L\376[\376t\307\2040IJ\\\241\322\217'n\360\260\f?-/\371\f~\361\026\373\210\267[\251\336\250\333u\314CT\236\230 [G\361\236\264\221\025Tk\250\262\212\316\203\261\306\002i\321tC\026D\310&\016\332O\231V\b\006\321^\313\b\353\245\"\336\351\245-x\304\017\034\324\021\307H\352\211Z\337\367\262\n\030\\\\0\277G\346mdx\370Y\004\3478\030\263\277J\00479\354\n\335'l38ED\260'\310>~\320!\022)\227\177\037\207\332 8\371\230\332\037}\t\242\305P\021\336\"\001\220tR\2312L:;\343\235\001\372&o"
+	.ascii	"/\246\243\\\240\367\256{J?\3605\330\365\261&\r\316>\024\261\354"
+	.ascii	"\234\025\305\245p\240\346\003k#\0043IA:\b\351\361\2026\275\205"
+	.ascii	"\253H\344\230\023}\371\266f\316~\004\350}\230I\345\004\237\277"
+	.ascii	"\243h\347*"
+	.string	"\277\326\334G\245sM\255\216\245;\310\372\336\332\356\333\266<LJ]\305$[\207\200*e\307?j&\353\001O\316\r\256Y:\266\345\311\201~i\025\327\377;\260\021\3300\366Ah_\223\316U\n\276\301L\227\300\220R\337\273\n\202\006*\322D\366\024Kz\244+a\353\013\304\306D\037\f\333\027y\261ywR\361\375\273\026'H\231\310\306~J\255E\020\f\352\351\311\007\034\347v\002\340\275\200\307\341\272\031\254r\021\252L\235\266\233u\270\251\260ko\003\351?\267\364\177;\220\f\347\310\305\201\227\02026\221S\0221 4\351\347\223\201\350\254\341}\013\350v\340\327o\316\\\327\251X)#\272\263L0\246\363d)u\372\344\362#\270\316N\224!2\200Y\r,\n\305\235B\262\215\204\223\247\353f\001\334\266>\347vP\250\265f\251\271\266+\007G\272E-\211\3521_\341_L\213\320.z\351\212Q\324\301"
+	.string	"\3237(b\223\244cW>\220\330\262\324\0177\225\311\267\347\227\202\324ZLT=\"\307\256\322\003cn\352\215I\202,@\316\004`(\350\370|W\224\0224\347:\360\212w\327\265\373#\323?\360*\007J)\324\205\300\312\321\355\337\347\230G\207P\262OB;9\272^\241\3077\222\261\f\360u\315h6L\350.\213k*\226\370\222lB\3135\227\262\367\220J\026\305\353\324\022\365j\007\345\177b\237"
+	.string	"\024\252\242'\362\375\255\265\356\r\316\230\253\002\235T&z\367\024$\204\236B\210,j\257\237ss\221\374\025\235\320\002\334\0255\br\025\345\255\031\246A\256\247\207\304\224\016\007\250\214-t\241\236Y\241\327\354\363\207\345\203\252d\001\006\222*\265N\303\366\262\372\363\350\3761\007\225v\273\r\271\017\367+W\t\rX\365@s\257\356\031\026G\325\317/\234\r^Bl\277\325\345\225\t\023\274\373\244\350\n`P{{\275\024\345#\247\332\374\223\267\233\205v5\336\353\332\307\275{[3\024\247w\271"
+	.string	"8\270O\227.[5\325IH\360\016:\0025\360\226\371c\2704\2117\310\243\376\256I\355\210\206O\207\300\246o\244&&~\037\247.\220\367A*l\307v\371\245\252\317\fO{\245\344zF\275\261\302^;28\234d\270\031\252\016<\256\360R=\306\007WQ\021\364\335\217C\3658\0264\022\272?L\317\t\221N\220\224\265\346\214\243\226lSU\030\034!\003\272[\017\007t\344\303$d20\303\222u\215j"
+	.ascii	"0j\275&\227a\323;\025\360\313\243\202\230\230'\240\027\205\302"
+	.ascii	"\300\247\235\261\224s\215R4)#\300\244\220\212\002\bM\025\341"
+	.ascii	"\262(@\001j\272\025&,\027\210!\267D\367"
+	.string	"\376K\243,mny\031!Z\232\206\316\340A<f7\244Y\250\225j\306\nF\312k<O`\243T\t\025\223\240W\360\211\304W\356\002,P<\322\260\327\376\371\2274\253\3505\264F\307\272\373.\364\020e}\307t\345"
+	.string	"\365\265\243\233\306\243WX\240\337\221\222\303\303\2714\231)\031\201\341x3\322\235r=\007 \326kX[\361c6\223\275\203\304=\275\\\323\225P\3532\275\231\334\356q\021\026\361\204\234/Y\330T,\347,\276\363\256*\366\034\030\207R\274\365\251*"
+	.ascii	"\003+\003\024-x\320\215=\307"
+	.string	"\375\323\030\352g\2249\201g\315\307%a\374\005nB\253\357_\312\265\215\212\265\322\242v\254\255i\353\363\303\fI\027\266\352\336\334\365.\2157)\017D\255\256I\357\203\rq\201\210\036\026\355\002\313=\3625\003\235\005L\351\226\263\301\223'\247\332m\356\305\270\305\362q\2316E\230P\215\344\362k\3267\365\217|\262Kj\344,4@\237\b\225v\305i\001\265-\321F\022\252*3\276\022K\311\232\021\330\023\037\227\207\013\275\263\n2\004t\310\355b\306&\3151\366Lc<*\243g\351\002\321\305\223wl\036\364%\024'\267\304\031,\245\2422\230\207\205\250\246\254;\351\241\026\333\372\364f\256\212\2014\264\240\035\371e\203\221\r\323<g9\025\256\375\356H\305o\345\027\032\001\260\245\272\254N\006OdW\304\337Sc\327\321\231\267\0321\3510\374\216\223\216\330\343\203ma}gc>\366\021\375\275d \355v\0352"
+	.string	"\345\306\366U\373\245\245\"\356\324\t\356\371\342\251\307V[\300\023\357\300\221\236\272\230\016\245;2`\237\256\252i\264OH6\207\242\245\234a\343\021\0209\331\036 x2c9\007"
+	.ascii	"\321\354\376$[=\334N\260L\247\332m\020\n\345\002\376\352t\206"
+	.ascii	"<\213\246\360\241\232N\212!7\265\221\270\3076\273\247\354h \007"
+	.ascii	"C\002&\271\211\221\005\021'L\227z\0231\003\271\246\205\3501\306"
+	.ascii	"\355\313\217\321\303\247\026\373,zd|\355\220!\250\017\356\340"
+	.ascii	"\350\257\264\332Sd\345\271h\357\332:*I\215\031\340\237"
+	.string	"$\226y\226\223\303\326,\322\026\032\271\334\n\213\375\300{D\374\003s\232bD\341\355k\316\035\267\bFn4\032\344\304\215\333w9\365E\035J{V1|\355\006n\311\260\363\034\004\013c\270\277\201\rR\\ \300w\266\252\\]\335ZD\"IF\030\205e\353\345\331\377G\372p\016\354\260\327\002e\341t\364\322<\354{\0226\0214`\345\216\0226$\304\326\035\211\270\264\317\343s\013\033\301\020y/\251\003>$\027O\237~3\030\006\332h\035\260\200\341'\237un\231I\3771\241\314\203\300\214Q\211$\030\037\261\271\344$\324\033*L\364iO\263\037\354f\003\027ZM\356j\316\320\326;j\206\244\252|\330\001`\333\272\035\226\377HW\035\333\026\337\364\203\254\224)z\376\201\212f\370\344\260U-\217b\201\0365H\260e\023l[w\022\370\321\370\235\343\360 \263\307\b\322\333\262\241\345\301\255\342\327!\225\366"
+	.string	"\360\247bc\213\336}\032B,\273P\220sy\b}\026!\002\2250\200\265\253c\253\202{Xx\221\376.\211#\027\331\202&\317\345\r\345\244\352\034\027\002i\206k-\370I\234\026\327\244\310\330[n\372\336'v\372\225\363DS\336\356`\004Z\f\232\024x\315X\355/\204@E\264\266\035<$\206\273\307%%l\265\274g\344\263\250T\371\r\020\035\350g\027\360\225\007 $\031\305f\036{\301\272\243i_\327\216\220\332\373U\001\266\247XU\335@\022\003\324<VF\203\265\033\371\037\261\323\024\0070\373\305T\273\027\252\ne\227\357\361\266\025\177@\013\257]o\373\3218\271:\032$\210E+\020\253\024]\363\350g\201V\267`\341\337\220\267\177\224\216\220o\b\254\247\341\220\020j!!`\346\b\016"
+	.string	"I_\214\203-\240\3150\005S1\356\033\306Bd\365g\035\2015\031z\177F"
+	.ascii	"\035\210s\217\311\276\335\314\273\037C\221\032\302\351h\342\364"
+	.ascii	"\360\021\376\026\320L0\235\022!\366\321\\d\345\001FM\342q9\027"
+	.ascii	">}\324wQ\374\346B\\\237\003:>\200\343&\001$U\233\262\257\026"
+	.ascii	"\231E\346F\203\217\265\234\2676\361\340\202\350\306\311\213\025"
+	.ascii	"\2027\214\224e\307p\351y\226\323\361\217\031\376\215\337\262"
+	.ascii	"\375\0320\225\377hr7\271\216\217\304G\376\205)\330\307\275u\311"
+	.ascii	"\237y~\226\266_\f\357\346\216\342\354R\262>\345\330\023\177\303"
+	.ascii	"\363K\344)\334\226F\317\340\244\027\031\356\342\366P\346\275"
+	.ascii	">\327\317\303LO\373;\246\375\326\242O\251\371\007J\035\341\337"
+	.ascii	"\230\334\316\324pC^CZ{\374\306\363\024<\356\217\377\266iB{\366"
+	.ascii	"\347\332z\330s\353X5m\232[\264w\375\253?q\036\371z\344\377\207"
+	.ascii	"3\377\306Y\364b\233\263+"
+	.text
+	.section	.gnu.lto_.symtab.2c28e6d39971f80d,"e",@progbits
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"flashConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"flashfsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"flashInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"tasksInitData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2c28e6d39971f80d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
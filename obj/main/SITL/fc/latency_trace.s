@@ -0,0 +1,444 @@
+	.file	"latency_trace.c"
+	.section	.gnu.lto_.profile.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 o\275\002"
+	.string	"T\004c"
+	.string	"\b"
+	.string	"\356\316\363\r\004\002"
+	.string	"\002\001\001\240\342\234\212\n\002\336\322\226\303\016\002\002\002\002\001\003\341\356\240\302\007\f\002\004\367\364\354\312\003\005\350\234\225\274\013"
+	.string	"\006\271\330\365\213\006\002\002\003\002\004\007\267\335\337\314\f"
+	.string	"\006"
+	.ascii	"M\211Z\331\003-0\324\217\335\2320h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 W\315\001"
+	.string	"\024\002K"
+	.string	"\006"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\201\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001\003"
+	.string	"\004\005\003\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\t"
+	.ascii	"3E\250\004\312\214\370yo\2160\030\346\022\332\216\354\r`\001"
+	.text
+	.section	.gnu.lto_.inline.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"5\b"
+	.ascii	"b\r),pK\222\016\234\310\200\026\020-.\204\304\021\027\0349\\"
+	.ascii	"#N|}\360F\332\272\006\274\350\211\252F\030Q\020\375\266\0321"
+	.ascii	"\204\220-w\n\377#\234\244\325_<\035\244\007\230\361<\034K\343"
+	.ascii	"y6\036#H\277\021<\300\265\345\326`fB\250\333\r\315\226\031\233"
+	.ascii	"5\017j4*\350\353e\320\312D\205\002\275,\2118\250g\310\314\206"
+	.ascii	"\177\340Y\\j\302\202JU8}\b\305\270\220\210hw\337\370\007\364"
+	.ascii	"\217\202\025\2319pg\234c\234\031\247\177\004\027\272\351\275"
+	.ascii	"\022\365\223\205~\325\373\376\324+~\224ff\n\274\372:\002) P\002"
+	.ascii	"\201\252\306\016'\001d\242\347\n\331P\200\367\272a\213!\003\020"
+	.ascii	"\013\300\243c\310p\030 S\2401\301@x\tU9`\222\362(\f\367\366\355"
+	.ascii	"J\243\231\215\2014\355\032Z\256\2056\300U\267\316\326\335\017"
+	.ascii	"\330\300C\017\035\013\240q\220O\326u\274:\260Z\316\036\344[\036"
+	.ascii	"\210S\030\254\270C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\335\004"
+	.string	"\342\207\025\033\240'\351\377\377\243\375@\324\252\252V\230}\037"
+	.string	"\\\246:W\361\331/\t\3312\311+\213\276-#\376\360\310VX\364D\213\227 \"Z1In\250\3717\224\333\205\262\033W4\272\215r\3009\347L\314\352\243\177\224\217@b\002\023\363F\n\253\260\312\022\374\264\356A\036"
+	.string	"D\005\233X\006Rc\016\215\t\00170\004\214\003\311@\023"
+	.ascii	"\017\bO\025\354Pf\300\034\034\223\241\031\b\033\302\225e\036"
+	.ascii	"\004\303\300\025\252\006\300\001h\357\314\251oB\f\n\3361\361"
+	.ascii	"z\316\361\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004\005\200\004\006"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 v\375\001"
+	.string	"\024\002j"
+	.string	"\005"
+	.string	"\003"
+	.string	"\274\006\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002"
+	.string	"\005\003\002"
+	.string	"\004\006\001@"
+	.string	"\f"
+	.ascii	"8\202\256:PT\2001e\334\0248*\334Lb \310\315\001\3400`\331\006"
+	.ascii	"\260"
+	.text
+	.section	.gnu.lto_.lto.720631d7390ed81f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_latencyStageNames.4.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 \305}\005"
+	.string	"\304\tr"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\025}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'4\370\254\005}\276\002\005\001';\206\b{\by\301'@\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006TOTAL"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/fc/latency_trace.c"
+	.string	"\006MOTOR"
+	.string	"\004PID"
+	.string	"\007FILTER"
+	.string	"\006"
+	.ascii	"NH\315\323\016\220\271\317\254\003\324~\003(\002"
+	.text
+	.section	.gnu.lto_latencyTraceAdd.5.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`\256\001\345\017"
+	.string	"\306^kE\360\262&\035R\027\030\340\nk\242\035#`\336\225\332\320)\377\"\272\345i\303-\326\316\323(\023\3757\222\226W\324\"\031\230\224\1772\355\020@kqF\3479N\206\244\325\204\267\034v<\232\327j\332\222\275\245L)U"
+	.string	"O"
+	.string	"\\"
+	.string	"\321\017\314\243c\222\337\006\030`iFx\nD\036\375\264\277\342,Z\337\341`\322\256\b\241\031\273_\312)\221G\324O\330#\274"
+	.string	"\354\321-\273\307\277\234u d\343\023dw3-\361\326\263\345\337\347$\357\306\365\034A\330]\247w\363\341\326\3336`[\202\235\r\002\217WE\241\243\"H&_\366\347J%a\037\356\356Zq\354\357\374#\357\271M\377~"
+	.string	"\347\371IXz\004\323XL\307\230\2060\2550\2350}\222\221\232\223\217]\017/!;\024\203t\336\363\333\277\217K\266{b\340\376D\300\261\343\307\356\036xA#\275\027\"*\246)\233!\217\301L\032u\001\210W\r\220\231|\231$\241\332\332\226\367L\212\242Q\227U\241B \233!\251W\325\001:jR\314dx\f\225\027\001\261\234\007\214\324\027\231h\371\013\225\347\310\331]\023{\345.X.\203hw\031\264\370\217\213\177\342\321\034L\336\203\301\002\254\t\030:\004\tT]\313\206R\342\272t\341V)pSQu\254h\255d\323T\253\356$F{\331:UK\246\245d/+*\227L[\261\262\022\002\3464l\253\254\343\270UV\372\366p\025\307\221\306\220\214\316\370\224\230\216\324\246P!\357\031\325A]\366o\260\222\310\263\215r\033\026R\027^\343\244@\037"
+	.ascii	"3C;\215\001\263\211'A\342~v\340nY\005\203\021\214\274\256lK\017"
+	.ascii	")K\b\023\f\bJ\002\203u\225'\202--\263\243\315V\327\267\254\345"
+	.ascii	"\3028\261fz\341\367\253u 2\200\005\314\201\300@\211\005j\364"
+	.ascii	"\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_latencyTraceMark.6.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`\t\003\335\025"
+	.string	"&\347\212J\300\322Q:g),s\201\006\304\031\354\350p\317W\231g\325\233\003\023\004T\0378\223\026b\222*\257\212\214\324\215Q\233\260B#\250[\361\254\376z\t\202 \024\224\001`\220K\357\3478\005*U\277\252\021b4B\b!{\247\024x"
+	.string	"k"
+	.string	"w"
+	.string	"<\233W\273>0\220v{*V)/\246\2345^\f?`\274\350\233\355tbC\322\204\003\204\332\335V\025\361\333Kr\024\303Jo\276\210\316|y\232\335\311\220\305\006j\347:rv!"
+	.ascii	")\234\035#:\034:\222\350n\302\024\241\234\035\025O~9\235\207"
+	.ascii	"\207\367=\024\232\002\342\243\263{\255\301\215,\240$\022\":\233"
+	.ascii	"J\311\226\3355\315\351t\356\325mk\260\355\300\256\n\002k\177"
+	.ascii	"\205m\247r\327<\217inq\271\240\355\331\003\027\313\312z\n\326"
+	.ascii	"\320*\223\324\226\261@\237#\353}\027\001\261\024\304U\323\356"
+	.ascii	"\231\264\376\330\257\347yF\271\206\260\317\373\313\367n\262R"
+	.ascii	"\327\220\232V\352\227,8a2d\227\3039\265AQ\206\211\367~\373\367"
+	.ascii	"y\304v\017C\270E\020\224|\374\330\355!\270h\226\362\324~\212"
+	.ascii	"\017\335\036\265\212M7<8\327\225l\245\rZI\0350\212\367;%\352"
+	.ascii	" \326\037\333N\360\244\030\312\210\335m`\277N\003vq\006\t\314"
+	.ascii	"\005\211\021+\221^\353\006\025Q\274\242\263\250B\262\332\024"
+	.ascii	"\376\"f\302\264\273\f|\243\037U\360K\\4\314\214>w\321\237\215"
+	.ascii	"\027#\fE\355h\350\351\003\177!A\223R\035(\t\250Fm\341\273xU\320"
+	.ascii	"\366\020\371,n\033/\006@Z\251\240\r2\260\227\327\314\203\013"
+	.ascii	"3\331\252&\213\315bD\277V`/\027\255\3462\363\222\301j\256\227"
+	.ascii	"\326kBK\026s\301\264^4\231\326\n\212g10Z\2536\233\321Z#\275}"
+	.ascii	"\270-4\025\027\356\356\226\002\250-\301\205>\347ZM\026\246\017"
+	.ascii	"9\344mcYO2<\375x\2245h[\"}G(vH\331s\304\n\340\200\021\270\261"
+	.ascii	"2\215\350\356\232c\375q\255\264\322~=j\250\224K\316\363<o`,k"
+	.ascii	"> \200\002\031A3\017bB\335\246\210H\005\240\004\371\025\242\266"
+	.ascii	"_\200\320\006\020\022 0\205\200\232\211\203KQ.\263\326\223\366"
+	.ascii	"\027i\266\2306\351\037\"6\205w@\2219\237\255\326\033\255\027"
+	.ascii	"\2634\306\b\272X!\327\306\002\0346Z\")\304fpx\r\357E$\r\002%"
+	.ascii	"/.\026\310\225\312\f$`I\342\352I#\023\326\242\215k\240\255z\364"
+	.ascii	"wacv\326\335H)\300\211\323S\313~\361X}\360\360=5{\277m\207H\316"
+	.ascii	"\267\313\360\023"
+	.text
+	.section	.gnu.lto_latencyTraceReset.7.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`J\001u\016"
+	.string	"\266\333bE\340\262(\035\222\227\313\013\007\346`\001`D\342]\214_Ns\337\262vu\324\374\340\302\367F\303i(\035\375\257\030r\\\337]5+\376\304\021c\2141\204!'\264\212t\222\222;\034\003\246\"\006\232%{K\231RM"
+	.string	"N"
+	.string	"L"
+	.string	"(;\307\275\227\275\314\204\007\032\036\273\273)\t\303C\357\206\211z\204\232(\177\346\007\\lt\254\324#\f\231\311\270"
+	.ascii	"\2608@\007-\233\331\275'\013k\2250\246\345z\357\n\\_\307jyz\""
+	.ascii	"\354"
+	.string	"\256\263c\205\270\265\333.\331n`\337\025\235\bU~\252-\233Y\214*\314\366R\251\257\231Lk\206\365e{\036\273\363\351\1774\235\033\005vv?|>\026'\322\200y\354\366U\370\236A_q\026\250\307|\363I\201\370\324\310`t\354\356\310\243\031|\036EN@{\204\027\240=\036\3449+\331\343pw\027*\314\366\202\247z\364:\256\257\303\210U~\006\311\253}B\312w\026Y\321\224}\030\033B\336\331\326p\232\013\017^v\027\302\243m\372\013\f\bp\354n\211\213\3132\370%\036\235\242\222\357\036}\025\275wx\302\245&\"\223\320\311\024\315\221\210\270P\3514!\205C\021\235B\0256\216\302\2062\n\235l\\\311\264\221\0300\311\202\250\264\235H\244\322\006\362\366\372\222\260\203\243\322\225\375\221f\233\\\306h@I\214\317<A\213\032(v\250\362\213\ns\200\024\352Q\315\311\221\247\262\370FK\375\017Y\031"
+	.ascii	"3\001+8\303\017]H<\023\260\356\311\244\3373\270\364,\376\030"
+	.ascii	"\030\203\3754\307\306\230\3113\005\323&\227\031R\305\t%\234."
+	.ascii	"N\260\272\362\322D\340\030\207o\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_latencyTraceHistogram.8.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"M\t"
+	.string	"f\322A90\221\322\001\200#H\016\355\241\252\0224\345=J\300u\370[\034t\345\327\030\254\325\337\322\200'\300\310{x$IJAA$\246\260\326&\275F\323\034{f-\331d\357\224\0021"
+	.string	"1"
+	.string	"0"
+	.string	"\004\265\265\352\244H.\\3\273\225\272~ \373\344\\ \373\224\0367=\232\374\237\034\013\331x\205\252\323\343faw\035C\325\352\226\267\375\261\215`;&\216\257\377\261M\306K\201\314.\306\253f]f\013\210\355\222\335\261\035\243\375\222\233\224^+\f\260\313A\303\262[A\006q>=\230m_\344#%\233\002\266\270J\367i\355\256\302\247-q\327g"
+	.string	"\263\273\t(O\231\360?>MA\212\017?}R\366\031\345C\rT|\331\365\024e\207}lw\327\222\025\234\203\006~\323[\210\3334\017d m#\016\324 \350\326@G\017\232\210n\336GC\007\356\"8\217\202]\347Q\327=\266\222e\351A\311\224\375\025Q@+\264\003\013"
+	.string	"$\023E'\206\213\221"
+	.ascii	"\277p\263\031\036\227Q&\215\301\201\t\002N<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_latencyTraceStageName.9.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\205\b"
+	.string	"&\220;7@o\323\001P0^\262A~\233\003\314s\006l\305q\n\352\311\352\fH=\352\277\206!96\035\035\fF\204\035\206\341\321\245[+bw\266D\003\273\357F\233\354\235R)"
+	.string	"+"
+	.string	","
+	.string	"1\273\225\272>\240\372\274\016P}J\217\207\217\241\177\223S2\031/\242\021\350\321B\330]G\321\210t\313\333.\260m`{%\3332M!\266A{c;F\373$/\001_'\254\331\325\200Q\331\255\035w\256O\016e\333\027\371\b\350P\240~\220\254\215\024\213R\327n\305\201\177r\024\b\352 \237\216\370\252\213>\375OjL\241x\262+(\312\016\373\324J\016\313\327?R\026\206\313"
+	.string	"\313\356\305i&\332\002\346u\323\231G\3130\316K\370\262\217\346a\r4S\240\037\006\314\201f\\G=\004\336\0364\216z\333\306\321M\335[JNHRH\274\324\005\f"
+	.ascii	"2\003\3020)\334\036\314e\214E\256\341\034\023\330\244180A\300"
+	.ascii	"\211'\325\212I\230d"
+	.text
+	.section	.gnu.lto_latencyTraceMark.part.0.14.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`?\001\365\f"
+	.string	"\266\327TA"
+	.string	"Q5\035\240\376\331\016wo\357\rA\241\n\007\316\322{\360_s\366=Wj\214j\341\250\31042\002\200\020\261L<\240D\302\322\177\312\031q{0&d\006\266\246\317\004\202\016\345mo\262wJ\001?"
+	.string	"E"
+	.string	"A"
+	.string	"\236@^\r\\\200\366\232=\200\366\372\221\355\321v\275\034\261\033L\332.\002\0268Z\030P\257\335\335^\251\210\223\2473#}\317\351\006\207\016\237"
+	.string	"\236=*\273k\210\207\273\336v\002\333\f\354\247\002!\373\321q"
+	.ascii	"\266\253!\006\333\020\265E\211\237~\323\247}\373)F\377t\224%"
+	.ascii	"\345h\032_\022\247e?\037Vt\226D\313\003\020\255\311\253\027@"
+	.ascii	"^_Z\362\352\023'\221GA![\225\003\0303h\354\226\b^\003\253\300"
+	.ascii	"wq\226\004\237\304\2535\337<\350\325\377\264\327\210\207\365"
+	.ascii	"\252\361\2311\026\277\352tEW|\222\346E\355*~\315\304c^\324|\216"
+	.ascii	"fO\350\314\203|\324\237!5\212q\201z&\025\231f\317\226\006\241"
+	.ascii	"\207\3716\225\323e8\261A\347\363\"\346(\035w\001C\b\"\347u\341"
+	.ascii	"%\263q\0216\017s\321l\034\310\331(\005\374m:p\013\277\017\334"
+	.ascii	"$\266\347i\310\225\017\255`\372lw\227R\221\3526\346/\304\001"
+	.ascii	"2v\003  \240\002\"3;\370\031x\267.\227\025+\013\306E^\254\031"
+	.ascii	"\277\217\314\001\f\227\335\350\333\350=\240\360\262\001\206X"
+	.ascii	"\361Mh\317\033\206\341\270\214\213\210f\254\246\302\022\\j\230"
+	.ascii	"\266\357\321\230b\031\b\233\203\033\235\350w\3211"
+	.text
+	.section	.gnu.lto_.symbol_nodes.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\305\005"
+	.string	"\322\b '\200k:\234\201\2650\331\001\354\370\261Q\002vL\354\300\313\024\006\363\006p.\344"
+	.string	"1\034\233u\023\021\021\021\262\323\226)n\3445\313&\241\336\241L.4\220\314\375\212\351O0\034\t\355\376D~F$\337\240VA'\202R\271\273\366!\016\264J\301s\002*\0014\3626\3210\227B\016n\3451\306\215\245\017b!\304*\275\334\355\304\226\272c\373Y\b\227b\253}\311\362\355\356N\3528\333\371\b\026"
+	.string	"\026kPK9\234\205\201\322\300\310\256\254Of\030\240\036"
+	.string	"\034>@^\\\332z\202\341\371\031\314\340"
+	.ascii	"uxm\023\216\001\220\357\f\004\210\003!\3204\262*\003"
+	.text
+	.section	.gnu.lto_.refs.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375 I\215\001"
+	.string	"\002\204\t\017\240\245\031\016\377\377'\370\234o\326M\310\226)',\2445c\nj\240\002Z\250\245G\211\222\324thN\327\342\203\002"
+	.ascii	"-\"\262\203\t\005"
+	.text
+	.section	.gnu.lto_.decls.720631d7390ed81f,"e",@progbits
+	.string	"(\265/\375`\253\020\205P"
+	.ascii	"\332\205p\035S@R\312I\007&\256b\2163\2731\016\377o\rQ\332r\346"
+	.ascii	"+y\344z!\303\033+\354!MK+\036\221\353gs\370\274\255)\003\330"
+	.ascii	"\365\237m\253\246\300\255\255\362\306\031\273\257\326UUu\257"
+	.ascii	"\252\377w+\202Y\261\356g\352j\243\251>\217\"\"\263\233\224)\202"
+	.ascii	"\001\305\001\305\001\313\375\262e\337\037\026\210\227H\377\300"
+	.ascii	"~Y-K\366\263\323\235\254r\325\235~\273~\335~Y\260\245\222K\261"
+	.ascii	"\272\247n\030Bc\343\204\325\246;M\221\242D\212\024&\321,\316"
+	.ascii	"\030O\375r\371W\271Q\226\214\221\335\303\356&\361\363CYU\024"
+	.ascii	"\327\rB\367\335"
+	.string	"R\221\030\325\340\270>M\ng\001Wv\310\274\214\3631\316\275\262XvY\264Y\276c[\345;\303\264\225;d\334\206\204q=\006\347\267\310\004\332\"\363/\316\272C\346\211%2W\312\206\355\362\\V\354)\020\317\324\026-n\\\337\342\374N9\211\264\206\340B\347e\330s1\357s\232\310-\024\335\367k\310,\036\323\006\232`\207).\2569>\277\246\227\310\374Iw\310\fZ'\377\366\260]E9t\007\262\303\272S!\0377d\204L\270>]\"\363\334!\263gQ\350\371\271\201\177\0238\341o8`\023\376\363\374\374\202\202\022\356\363\363\003\377\022\221\360?\315\321H0\302\1771\"|\350\347\005\376U\021\302\177\264\377j\376\247\375\313\"\306\333\376\227\001\3412\376\177\300\004\374\253\300\277\036\374\333\301\277\031\374\213\301\277\027\374\013\343\277\316\317#\374[\301\277.\376\215\340_\243\177\213\376E\340\337\023\377\n\360/"
+	.string	"\377\006\360/\320\277>\377\263\374\233\363o\356_\376O\346\177\334\177\270\377k\376\273\375\357\372\037\300\177.\377\317\270\270\270\270\237\353\317\026\374>(\004\300E\225I#\252D\032\205z\330\300V\006\211\234C\244\021\355\2024\006\241\312\240\021\035&\215BTSU[f\310J\212-\026t\330<\210Q\301b\320\031\232\"{\255{\303rt\021Ew\024\262\270\026\254a\257\b\317x\b\251\004\221\233v\267"
+	.ascii	"D\241\024\262\207g\250\026\262[KX\243\211+\200\351YW\355\031"
+	.ascii	"p*\252w\344\350\036\240\323nb7p\373\254\273\201\335\255S\214"
+	.ascii	"J\273\241\202\320+\"\261\373X\202\330Q@,9\2729\314\314\025#\252"
+	.ascii	"\224B\352\260\200)\257\332)\005\356U\257%\213\247\022\370\244"
+	.ascii	"w\270\235WF\037j\2702\0161g\250\f\271\236y\234?\017\323\214q"
+	.ascii	"\340Dq\345 \217\224\036D\f\021\307@\3568\"\2516I\270\306\375"
+	.ascii	"[\304\306Y\270\034\231\247-0\256|\002\016\334\256]\r\351\002"
+	.ascii	"\367\006\250\207\037"
+	.string	"TG\322\256\035,pK\200p]\"\266\315\327\315\262\271\003\020<\007\204\322]\335\275nV \273\203\353\006\bNw\020h\367\200\335\003*\227\224\325\322\254\3377ocr\276\266p\005yM\233Y\025G\r\254\253m\237l\030\023B\264f\021c\323\265m\2315\263ga\037tMas[\266U\263iv\271m{\346;\304\242\331*bVm\317\302.0[\262u\247m+\304\222\375\fS\024a<\3300q\241\214s\342\251\177\3731[*\347\327\0073\273F\305\334*S\222\305\344\334%3\002J\b\226Z\325\216y\205\202\364\311\005\203x\261\202\303\371\r\363\257\017\233nZ\317\316\226(>\324\270\242\225\360\201\323\262D\311\365\353\343\374V\2612\346\365e\315\226K\320\354\252\273\301l\227=[/\033\b`]I\203:*69\343\341\274\305K\200z0.\335xI\031-\"N\\9\213\225\354\362e\254\265U@"
+	.string	"\253\2128a\320y\231\371\334\230\223\215\030a\253\022\310\334\2313Nfm\272\217E\314fM\230$\311\331j\033G\225\025W\336\201\221\374\224!S\262\003\222#,\304\231\323\027\332Y\204\n-k\311\314/Op\336\230\235\337&\313TK\246\342\";hec\306\326\305\037\f\260\016<I\234p\270\275IG\034\321*^`\311$OI\221Z\362\250\035\303t\221:O-\334I\004\373\212\272\262\34160\222\257t\304\204N\330\372\030U\344\003T#\342\026uF2\016\034\024\236\301\302\201o0\"\0066DK\033\r-j\n\327![f\216\365"
+	.ascii	"\222\203\205\234\f3B\005u<\262\020\n\276\220\350\200\00135\204"
+	.ascii	"\353.YH\01652\020#\0071\2737E>\025\377v\016\222\223\246\225d"
+	.ascii	"\311\265G\017\376q\002\273\201A-D3\004[\037\217Eg0K\020\034>"
+	.ascii	"\316?~\2028\302\303\021\"\3163\230\247\357\222\2378\307\016Z"
+	.ascii	"\277\214\261u\261\310\3009\313yvb\364\254c\311:\230\270\307\t"
+	.ascii	"\270\272\260\365\261X\364\363\2163\361hz\332\204\002P^o\2702"
+	.ascii	"\r,\344\031\222\004\312\013W\236\241>ic\225\305\365o\253\366"
+	.ascii	"\177g\237\300LqA9\317\277\331\301bw\367\310I\273(\354\371\346"
+	.ascii	"\254\317\346\026\305\377\33291\335:L\2559\225X\t\332\360"
+	.string	"\023}&\335@\241N\273\210*\223@4J\232Q(m\"$Z9\325h\2324Vds\247\275=L\032]@Sd\021M\221\300\240\036\"\201\335\2511\b\r\013\006?\236\217G\302O\217\007\343\307\243\001\304\373\371b\360\031\371z\274\027\224z3L\350\370\232z;%\020j\374\216tM2X\3305\331\330\221\2301\343E\217\217\267\224\024c\003\242\037\317\307#A(\350H\305\257\227\324\202\n\026zI \220\350\2311\343\005\320wJ=\036\023\217\306\371\025,\032`\321\002\006\235\267pq\344\342\310|\013\027:\235\013\026\272\363,t\271\037\017\211G#\351WB/\251\306\256\336\207$\003\006\317F\013KI\276\036\037\317\306.\206\235\311C\372\3711)5\211\360\363%\331\330\371\275\206\n#\246\246\245\245\246\235\001oj\201\3273\37255\365\214F\370~<\026v7T\320\361!\215\3701\335h\332\345\374\220\034x"
+	.ascii	"\206\244\245\334\017i\005\213\037\223\322\215\363:\035\214\023"
+	.ascii	"&\304\320\340\334\251\340\355\222z?\244\030vL\274_\222\r\243"
+	.ascii	"\335\nFLJIKF\273\236\317HE\001K7|9\337RR\217F\323\317\247T\203"
+	.ascii	"\307\214\230\303\332\021F\013\020E\260\250Z\315\017eY`]\270\270"
+	.ascii	"\242\245C\036\"\227\032\304\264x\361\004!\006\207,\310\024!E"
+	.ascii	"\244\262p\351\270\001\r\034\327\024\200\343\026\217+V\246\024"
+	.ascii	"/\035F+\274U\203\034\321!\213\3078\307Z\320\212X\252\3541\263"
+	.ascii	"\004\363FE\254\276\211\361\342\203\353Y\354\347)\274\354\031"
+	.ascii	"3\246\246\b\327\026Kd\352@\321\235\303\330\t\025jD\n\030\020"
+	.ascii	"\024\221\034f`0\345X\021#lQ\224of\244\234\270\236\225?C\341\257"
+	.ascii	"u\223B\367\020\035&\265\270\036-\221i\356\220\311\251\356\374"
+	.ascii	"$\267f\304\002\204k\316\016\231]]\354%\204\216\026\2214SN\316"
+	.ascii	"^=H\330\\M1\0225\250\226\253\254&M\230\353h\333\t\354\353\211"
+	.ascii	"\r\b\352\310\030!W\256%\313\231\331:\263\342\372\232\304\302"
+	.ascii	"\342\255\022H`[\201U\250\201,\210\024DFFfD$I\222B\0071\005\204"
+	.ascii	"(F\245\264\016\021\020\255\243jhF\222$\2056\003\235\346;~\017"
+	.ascii	">\311\260\264\324\203\356!\242<\035\351\336\250\177\001U\316"
+	.ascii	"g\345%\013\030\255\230G\314\303\3459\340\243\303\\\371\005\263"
+	.ascii	"P\265rw;GM\244\251E/\374\030y-\004\227mT\030A\006U"
+	.string	"j\247\0313\253\0274"
+	.string	"\247\306\036\230\226"
+	.ascii	"\256\004G=1~\316\004\233*\233\272\366p#.\350C\3751\342X\361-"
+	.ascii	"\264 \202\210\226\256\371\213\221(\300\341\355\312M\322M\243"
+	.ascii	"\242 \360y]\322\004\311\362E\346_\272\373dl\335\366\331;:\201"
+	.ascii	"c\242\345\223\232*\361\033\214\035\273\227\251\343J\341\251\242"
+	.ascii	"\036h?\271[\346\246\363\231\020\225\252\342zgx\361ClP\210\b>"
+	.ascii	"4`\033\007$G3\276)\324G\275-\270\016\003\365\035\251\244\362"
+	.ascii	"\217'\320\022(92\322H\242\262\2041>\202V\214\343\303\337?G\353"
+	.ascii	"\3107\354#\340\366h\205\031C\006\344\f}\237\311x\207\276\212"
+	.ascii	"\276\324\034\264"
+	.string	"L\341D\002\037\023\313\234\247\201\254\330`m\376#\270\242E\365>\007\027\016\026\003\204\177c>\324\016\306R+\330\005f\311\353=\315~\360f\215\005\027{\t\276\221\233\377\036\035\274\017\n\"H\367f\232\235)\016\237=\352\346\"O\3158#\242\333#\202\030\024\314 \306\222\320\321<lQ\323a\025f\2224dlq=\302d\304\211\254\364\377\312x\026\346'OaI\323*P$=(\f\203&\t\227\334\257\274\365\340\232\b\004u)H[\242;\313$\0246\244<\n\310\303\321\265\203j\207b:\003\201\207\321 A6>\341\361\035\034\t\232\321\347\201\fi\271\304\037\254\335?@\276\224W\022P\333\336\202\337\322Z&\220\204\302\211\237\3338\321\243,\333}C\214\355\343bq\246l\253!{\233\003\377\213\232p\221[\221\233\226\231\326\222O\247\332\\\327\362\177\031\002\017\017\035\235\027\314\202\026y/\303\270Y\2509"
+	.string	"\333;6\301\246\3753\354\354\340 \034\b\242\366\334\004\t0\256\362?\200TO\003\n)\020\\T\350>\374\236\222\236z\362$\030\031\241!b\2026\306\002E\245$\020\264t&\265\307\017!>\314z\025\332V\370<A\371\004\341\374?\224:Wu\006\\KuT\363\035\373\300\216\237\360e\273\365\273\020\201\305\371\217<k \324\375\305^\261O\304Oa/C\300g"
+	.ascii	"3T\377\2104\027f\202\264\210\333{\030\240}\231=|>\376\bKs\360"
+	.ascii	"\234*"
+	.text
+	.section	.gnu.lto_.symtab.720631d7390ed81f,"e",@progbits
+	.string	"latencyTraceMark"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"latencyTraceReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"latencyTraceHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"latencyTraceStageName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"histogramAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"clockCyclesTo10thMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"histogramReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.720631d7390ed81f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
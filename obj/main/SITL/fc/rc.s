@@ -0,0 +1,2280 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003!"
+	.string	"6"
+	.string	"D"
+	.text
+	.section	.gnu.lto_.icf.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\t\005\255\024"
+	.string	"\344\026\375\005"
+	.string	"<"
+	.string	"\331\342\211\330\013\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\251\317\374\337\b\003\263\356\307\243\n\004\206\376\277\352\005\n\005\247\324\212\006\372\363\215\201\f\034\002\003\002\004\005\006\007\002\b\007\240\342\234\212\n\b\253\371\220\363\b\034\002\t\002\t\002\006\002\n\003\002\013\002\005\f\002\r\001\002\n\013\f\r\240\341\322\273\f\030\002\001\002\016\002\001\003\002\003\003\002\017\003\017\017\352\263\360\321\b\020\315\343\301\244\013\021\022\023\301\342\305\331\013"
+	.string	"\024\357\220\256\374\001\004\002\007\025\026\377\341\234\356\013\002\027\030\031\032\033\034\035\036\037\350\300\306\254\005\002 !\266\333\201\353\013\002\002\020\002\020\"#\345\216\317\366\016\026\002\021\002\021\f\002\022\006\002\006$'(\347\273\234\355\f\002)\303\344\206o"
+	.string	"*\246\330\353\276\013<\001\007\006\001\002\b\007\006,\361\366\2237\240\001\016\003\006\b\006\001\002\001\005\002\b\013\003\007-./0134\367\266\350\004\b\0065\344\341:\b6\320\356\343\223\004,\007\013\002\007\002\023\006\002\016789\370\326\276\261\016:;\274\303\305\303\002Z\003\002\024\002\006\025\001\002\025\002\007\007\002\026\002\001\002\026\002\f\002\027\001\002\030\007\003\002\031\031\013>@AB\232\214\265\246\f\004\017CD\371\307\317\233\006 \020E\313\322\375\213\007"
+	.string	"F\321\211\300\200\002\002\002\007\002\b"
+	.ascii	"\200\242\250\261Q1\031U\224,c\200\2021\"\"7\022@4R\036fJdDfA"
+	.ascii	"\013\222\215\355%\016\\\211>\303\2256k\272\232\365=\232}\371"
+	.ascii	"\324^\350\265\334\372\256\330\314Q\363`8*\240\016\260\221\350"
+	.ascii	"\032\017\333\037\227\030\266\243\343\031\201\201\257\367\020"
+	.ascii	"P\302_\030\227\236w\242\202q\321\3002\232U\224\325!\225J\250"
+	.ascii	"\210\316\200n\253Y?i\337\230\264\2229VH\253O\246\033\363Pf\007"
+	.ascii	"wl\2271s\263A\242$\246odv\371\375\347\264S\272&\013\332F[\317"
+	.ascii	"\334FP$\373\2130\376g\245g\260\215\213\217\347\333\375\034U\212"
+	.ascii	"\257\316\320~8\n\354\360]\245[\363~{\306\204\254`\001K\356r\322"
+	.ascii	"\330|\216\335\210\323\327\200\216IOO\226\341\372\357f\b\374\373"
+	.ascii	"AR\360\345v2\231gl\006a(\351\250\022\001;\312\341\005\220\366"
+	.ascii	"[\032I\237`\227\326\017\255\b\233\3671rH\321\017#w\344P}H\220"
+	.ascii	"\341\263\364\376\366=\030\370y\357\3649\376\214;r\315\310M\353"
+	.ascii	"\224\\_t\004\251\"N'Z.e"
+	.text
+	.section	.gnu.lto_.ipa_sra.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"m\005"
+	.ascii	"\342\305\022\034\200I\303\0013\200Q\024\3052\036)\356H\241_\267"
+	.ascii	"]Z\266\241E6\266&\245L\001\367EW$:b\0376\\\350\204m\260\340\237"
+	.ascii	";@v\200^Q\354\324\227\024AO\235\336\360\311\340:\346\227\247"
+	.ascii	"\254L\270\0219\312\336\327k\004. \260\202\241\254m\210\301px"
+	.ascii	"\240p\3412\206D\201\355\351\fk\033\366\002\020H_\021\r\356\253"
+	.ascii	"\007H\022\2672\364\360adX\025\032B\342\020B\211\025! \360\216"
+	.ascii	"8\033\320\022\256w\223\343\f6C\310\301\374\373\235\005\004\033"
+	.ascii	" \303j\254\025\201^\314\222\3610\345[f\311BJL$\332\033\002"
+	.text
+	.section	.gnu.lto_.inline.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\243\t% "
+	.string	"\346\253\223G\300XM\032\003\200y\244iz\344C\331\223>\212-\030\226Wz\\(\016h\206\357P)\321E\013\330D\206\217\256\202IJK?9y\335EA\262\300\243\266N\330\025\307\342\202\355\212\360\311Uf\243\005!\322\366\226;\005{"
+	.string	"~"
+	.string	"\202"
+	.string	"b\222\206\234X\003\356\236\242\3445\335M\272\272\"\271j*i\250\311\203\271?\026\322\314\377\266\2737\022iwkV}\317&Mb\201:\322\004\222P\030RYxdx\322TG\355(\b'J\355(\250\301\322\033\\\rww\301\324e\317\201\265\265L\367\236\261\230\317A\251+\250\273\273\334\367\310%%S~rT\277\002\215\361O\240Q\177\004\032\227K\232\306\330\001\205$\302\277\236\261\021\255\231\252kG\265\201\037\224\267\235\356\002\313\243OE\273\353\251x\325\2774FU\332]\232YSMF\302\340\350K\232\376\b\313lq0\315\307\302"
+	.string	":\347\271aS\352\221#?.irI\310F\204\302\336\261p%S\f\312\244!&Q\272\211\020\353h\025!\333M\007\241A\303z\363L\036\005\021=q\303`\337\240\332\370\251!u\353\267\256\236\355\352\363\271\3124\356\250\220\244!'\001\277#\003\273~\336\016z\273\312\270}\312\346l\316]\247\216\356:u\342\016\352M\343F\036-\342dL\217\326\026\247%_D\2644n\343\205F\273\274\027/\016I^\263\302\306\331pF2.\305\273\225sE\362\270\201\203)\212WK\037\331\024z!\023\201\216p,\234RBt\351\211\345\221G\245\224\214\246"
+	.ascii	"\f\341&\236$"
+	.string	"\210\350\n\016Mg\374\324\200,\230\f\216\205\254..{4jwW\333\200r_.\005\b\002\177\370U\356\341c\265(\304}\t\031$\007S\031\237\022\322I\216#-f\272\003\007\220\313\221QO\212h(\016.LA\230\304\"c\210\254\356\231HB\237p\201\252\305\026\n\344b\210\324P\276\300\202\223\361\203\310\022\002:P\r+]V[\370g\226[\341\365\030\243\013\356}\324\307\216!N\nF\177\241\205\007Q\224\362\204\351y_\006*1\306B\330.\003\243Za\273\216\260\305\277\365\373\n\354\3377\367\357\373\276/\200\314\250!\261s\310\206$IA\nY\326`\002\031\242*\342\001\022 \005!\007\304\3108$\"\022\210H$\224S\220\3269\007\ns\030\020\223s\030G\334\245\326\026\301w1\031\205\033\253n\346s\004\021Rf\210\342\317\324K\231\352\225\003\301F\254\027\330U\224.\224\340Xk\245\272\363\333\343"
+	.ascii	"A\225\211Igb\25082\323K\265z\353\\\326T*4`1\242[\254\333\354"
+	.ascii	"\207\327d\031\3745\321t\214!\250fW\355\223\036\265F\313,\373"
+	.ascii	"\244\236\266\233\024\344J\263\354g\377\217\177\3058\223\240\303"
+	.ascii	"y\263\205\034\264\235]/\336\216\360\034\001\"d\n\t\303\233aB"
+	.ascii	"\r\007\r\321K\303\362x\022\360\217\017\325.\230\r\205\247\375"
+	.ascii	"\307\270\224\321\227\264u\240\225\247\002\352p\252B\370p\037"
+	.ascii	"Tz2\215\200\276S\0303\b\355\005S;\321\300>D\313\260gJf\311.\314"
+	.ascii	"8\227\025@5,;a\016aV\013\f\nL:\316.\236\244\003\224\267\200\220"
+	.ascii	"\236t\241\303N\274r\315\"G\273Dil\240\004\355\371q\037`\200\244"
+	.ascii	"\324\023k\205\343\0345xZ\356QU\326|9\004\021\377\367\340\\5\341"
+	.ascii	"\253\2122\260\374S\005\255\367\254O\365\354\240\347\361\016\315"
+	.ascii	"\232tPr\245\203\275\237e\030 \356K\267\327\234\007\300\274\331"
+	.ascii	"\324N0%\227\253L\335h%\300\301 \025\317\005\203\032$\017\017"
+	.ascii	"=;L\265\352J|\320L\177m\006\025_\324\274@\355T\260\005\315\232"
+	.ascii	"\3143[\b \303v\274\342\321\310\\N\346\200:\220%\211vJ<')j\002"
+	.ascii	"\032\336\017$\325\004Q#\263\3204\260\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\031\004-\r"
+	.ascii	"\262\0171/pM\322\001\374\207\375\377\365C\320!\271\276\271\377"
+	.ascii	"+\373J\220\353\037\377\377 \203\021\361\304a\004\202\370\220"
+	.ascii	"\017Y\b\320\202\265\273\326v\223;\245\024$3H\214\351\3156\343"
+	.ascii	"/H\013\262\202\2446Qz\032MOz\227\316\245\343w$LL\177(\343\363"
+	.ascii	"\364!\314\226 # \250\302\032\352\336\006\202\2279|\3259p0&mI"
+	.ascii	"]\336=\256\225\225\036\003\337[ \025\336^\204\271\364\360U\244"
+	.ascii	"\246k\034\337\253H\376\030T\200\326\007\244\024A\033\202\350"
+	.ascii	"!\007$?\022\310\220\275jj\275\252\234Z?\302lR\266\201\277Z\214"
+	.ascii	"#\377\374\200\326,\245\234F2\220\326>(\367w\226[.\360!\177\343"
+	.ascii	"S\264]\224h\311\004g\250aM\245jfA\013Y\326P\0021L\235\325\001"
+	.ascii	"\022@cME\2414R\312\021\nD\222\004\221\202rj\\\003\233C\001p\220"
+	.ascii	"\260\027*\001\004\214\223}\306\316^\212\276\020\310O \340N\270"
+	.ascii	"\220T\203q\245\332\345\314\341\261\327\004\t\035\203-*8\241\216"
+	.ascii	"\360;i5\277\273/\344u\235\327@\212d$\004)/\222\376\366\234\343"
+	.ascii	"\346V}.\013c\031\267\025x'\213&\241fh\324\350\032\242!\254\255"
+	.ascii	"\361\201!6\242\335\210\2706J\264/\017g\262\361L]Y\377\213 \363"
+	.ascii	"]f\030u\262\303\314\227\005\232\223\363\354\r\\\346\035\264l"
+	.ascii	"B\307c\216\bq\302\270\304k\275\375\002Yn\211\253\343A\241\223"
+	.ascii	"\304\247Z9c\3451\226\177\242\316,-\235\016F\3730\201\373v\037"
+	.ascii	"^PDW\340\032\275y"
+	.text
+	.section	.gnu.lto_.pureconst.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 b\245\002"
+	.string	"\"\006\024\034pM\322\001\017\274\327\210\376\337\372\377"
+	.string	"\006\270G\322\226#,\216\224b\031\333\322\006v\027s\272\214\226[\371(\343d\224\334\310\t9\037\247\343\324\270\214o\361).\272\211\213\270\207k\270\205\217p\032|\2021p\002\266g{s\266f+TU\231"
+	.text
+	.section	.gnu.lto_.ipa_modref.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\326\002e\013"
+	.ascii	"\242\217,+pk2\034\374\2770\323\351\212\375\377\246\377\377\337"
+	.ascii	"\356\377#\314@\303lj"
+	.string	"\253\354\366\215\222\030\022j$F2\324\213\342n\273\267\224)\377S\334&$&\021?\305\246\n\321\207N\207\206NL\371\245\226\006P\317\200\371\013/hqf\245\274\3229=\311\3374\356j\234\3054uR\312)m\344\tytJ\345R\027\332^R(\243\377\340q\n\b&\245\305\201y\364\0023\241\\\322\371t:\345\b\235\221NG\271\243\215\337a\020\340\257\257\227\251\346e\214\n5\357zXO!\350e\346\334i{*+\352Z\243\261NHg\313\333\376\257z\325\263\330\006\263\214X\250AM%\325\004-h\235e\fp\002\031*\272\033\021`\025TR\r\245\tZ`\331\f\360\0176\302\332\006\211\323\277\022n\311\204\3207\261o\306\346\032\342\371\fz\032\310\251m4\246\277\\\375\271\bx\322?\t\304.\264$i\343SQ6\262I\200\310\325F\340<\310x\021~\234\226\346\210\307\030\027\344\200\321\367\272`"
+	.string	"\n\316\253\330\331\2160:\344Yf\251\026\215%\005?\255I"
+	.string	"\2559\223(I\372\333|\255\2209\200DO\304x\316"
+	.string	"\341\221\325\027{;)p"
+	.ascii	"z]\2467,j\362\327\245\245*\t\342\017\027*\035\003\031}\237uG"
+	.ascii	"\306\nW\336\220\006z@\031"
+	.text
+	.section	.gnu.lto_.lto.edb0efa283525169,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getShouldUpdateFeedforward.87.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\035\n"
+	.string	"\366QD=@\245*\035\240\336\372]V\254\276\330kv\032&\347\204UX\315\212\354\346\246Y\017A\234\214\333O\020\272i\",@\221\376Y2l4\343\003\230\363\032\254t\320\225W\257@\215\020\271S\n/"
+	.string	"4"
+	.string	"0"
+	.string	"\273\263S\217\203\337T\202~e\263\211\254f(1\374\266q\305\210\247-\263\273\207]f\210&)+\233\335\265D\211\0327w\333\020\266\023\354\023\004\037o\34504VG\353DgsU\265\003+\343"
+	.string	"\204|\374m\222\017\363\345\343(\023\316U9\254\346\250p\316\b\226s^` \031\374\374P\275e\202QB \273\033\252\276\374\021E\325 5\213\t8I\003\366I>A\037\304\027\"y\3249_D9\247z\220\222\261`\034%Y\263g(\365e\177[u\331\001\236\207N\210\023\001\262\260\330\323x_\347y:\n\t\316D\347}\025\235\246\300\037P\347\353B\237\317\327]\346~[u\251\202Ff\201\001%5m\372\002)\261\206T"
+	.string	"\326H\223\001\022"
+	.ascii	"2\241!(0\203\001\321x\307T\215`e^94\202$i\314\335\256\211bY\220"
+	.ascii	"\210\t\220(\242CE\f\356\022\244\206,\252\334v\025="
+	.text
+	.section	.gnu.lto_getSetpointRate.88.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230>F\242\272+\037\r\032\253\350O\366l\002\213H\306\316s\241};\206j\324\320\320\323:\225a\030\b\214\256\006H1\330*I\375\326\332\336[\246\024!\320\303\347\365\362\\Y\274\020\242\002\350\223\020\257,\024=\234b\013\007Yd\300\260,nT\367\27339\327!\271\b\b\177t\225\371_Pw\330\243\241>\031\326A\224\336\fk\221\323\260H\331jU\243t\027\255\337\235\251\315\254s\312\316\2071I\t\b\371'Z-G\201,\215\266Z\273i\353t\252$\325\374\026\250\221\377\004\025\310\030\266\255Q\336\320\332\325Se\234\254r\"\001\302\362?v\fp1|\346\\\f\035\2065\247V\233\303o\245\242d+\215\234\030\203\377\315\255D\341:\017\264\025\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflection.89.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\225\007"
+	.string	"2\01754P\215\322\001gV5\t\205A/\274\tq\266I3\016\3002@M\343(\224\366O\343\304\030\226\340o\bIUU\031u\315\2701T\231\316[\337\366\367\3362\245\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,j\266\373\335\225\234\343\214\\\004\204A\232\302\374/\250=\374\321P\233\f\353\020Jk\206u\310eT\243\\i7Q:\214\326\357\377\353Jmf\235Qv\276\213\312I@\352\237XI\271\tTm\264\315ZM[\247Q%i\346\2778\215\374'\250"
+	.string	"\306\260m}2G\326\246\336\246a2\312J\"d\365?r\f`1|\336X\f]\2063gV\273\303\220\302\242D#\211\234\027\203\377M\215T\341:\017\264\025\t\n"
+	.string	"2\241\241/p+\n\036\026\317a\002\n\230\342\022\350"
+	.ascii	"TFi\266\261\353\336"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.90.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\2300\216o\260\313<\t\257\007\r\330\210\253\223\235t\001\206\356\246\370m\f\325\250\241\241\247u*\3030\020\030]\rJ\304\270\325\220\215\027\375\275\267L)!P\304\347\325\362XX\264\024\"\003\350\263\020-,\024=\234^\r\tXt\270.,nR\367\27339\327!\271\t\t\213T\225\371\177P\2038\344\241F\031\026B\224\326\fk\221\323\254H\371\322\246F\3514Z\277;S\233Y\347\315\316\027\200\241Rp\362[\274\270<\005\2568\332f\355\246\255\323[M\252\3713\266\222\377\006\035\310\030\266\255;\354\221\265\252\227:\241\274RA1\322\362?v,\2001|\346`\f\335\2063gV\373\303\217\345\204\242\225FN"
+	.string	"\204\377M\255t\341:\023\264%\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRawSetpoint.91.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\016\243\377\205\253\201"
+	.string	"%\2614\207\003oR\216<8\rmS\3746\206j\324\320\320\323:\225a\030\b\214\256\206\200\304%<u[\246\333\336[\246\024!P\304\347\325\362XX\264\024\"\003\350\263\020-,\024=\234^\r\tXt\270.,n\266\373\335\235\234\353\220\334\204\204G\252\312\374?\250C,\362P\243\f\013!Jk\206\265\310iV\244|i\267Q\272\213\326\357\356\324f\3269e\347\013\340X)(\371K/.W\201\253\215\266Y\273i\353t\252(\325\374\026\035'\377\r:\2201l[{\370#kUo\313@\231\245DA\322\362?v,\2001|\346`\f\035\2063gV\033\304/EC\245\231FN"
+	.string	"\204\377M\315T\341:\023\2645\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcCommandDelta.92.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655Po\322\001\240\030+\251\2346{X\350L\0234\252\255\220\250^\325\035:\024\2676\375\\d\021!33\332\315\314\020m\312\026\355\337\246\346\322\3246\354\336[\246\024\242P\004\350\325\372XX\264\024\"C\b\264\020-L\024?\235^\r\tXt\270.,rR\367\273;9\347)\271\t\t\223T\245\371\177P\213x\344\241F\031\026b\224\326\f\353\221\333\254J\031\323\246H\3512Z\277\273S\233Y\347\315\316\027\260\251\024\260\374\02510O\201\253\216\266Y\313i\353\364V\224n~\f\220\223\377\006\035\320\030\266\255=\374\221\265\252\227\332@y\345\202\242\344\345\177\364X c\370\334\311\030:\rg\316\254v\210_\013\207\213f\"9\001\020\37675\223\205\353L\320\326$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRxRateValid.93.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2PO\222\016 ;\323\216\335\202j\035\336\257\205:\004x\312\253\305\305\337\032\326n\255\241q\3639\002J\252\252\252\210\342\236\263\3723H\321\227\305\326\366\226)7L\243Xs`\021\017\f\020\254Q\023\fC\360$\321@1\212i\242\330\345\312\342\347\260\200\203\026\337\221\222T\367\343\212\314\325\252t3"
+	.string	"\225\016\00548\027\372ks\b\372F\211\237\377>\034@YA8\311\354\204ZRE2\001\3715\1779AAs\325\213\243SP\307E\tK\346\305p\243U\257\272\025i\024\342\221by6\275\200\205\314\374,OF\307\376\007\277\301\217\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.96.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\335\006\215&"
+	.string	"\232D\374\016J\220\330Q:\221\311,\310\352s\210\327\213\315\253\333\205\222\202s5\232A`GiK\"\361@@g4\304\233\355\333\007F\251\032\t\234\325\217`\020\\\001"
+	.string	"I\200M\202-\275\207/\361 \201\0235\037kD\362\t!\204\020\271\223\f\334"
+	.string	"\307"
+	.string	"\334"
+	.ascii	"a\260:\240)\230\325'\341w\261\252d\305\022\325\224\f\350K\373"
+	.ascii	"#G\302*\027\013m@\332]zQ\304\302`\204\205\250\013&\236\025\354"
+	.ascii	"\213\361\336\313\340%Oh\255\025$\355.\375\242\034\330 \013\245"
+	.ascii	"\200\031\336{\211X\301\355"
+	.string	"\211\264\340\364\336\251\257\341\275@\"\016B_23?\310\205$1\013\311`\225\325\301\276\224\216\234\271\367\336l\257\231/\311\357\230/[\307\223\256\316R\3644K\262m\022\377\234 \244ef\313KW\223\213\253@SN4>\233\275\240\242\024\205f\312)\352\351\f\224\\ eE\306\2670A\2215-7\304|x\240,\246({na\242\241d\315\247\227\353\013K\312x\3434\001I\333\275\367Hn\227\232~\326\236\023\356\275la49\235m\316\314DfNb6o[`\200\226\354\302\243\350\210\252\356\275\021\230E\034\n\t\364\336\373\340\t\213\022CUV(\314\227\266\211v\020O|\023\024|+\336\361\354a\360\314\227\357tJ\f\020(\237=2\007\177\266\251\230O\336\306\301<t\2573\002kY(\b\310v\340Z\277\201+9\377<\370\0278\221\237\300\215\234}\316u\356y\360,\300Z\346\261\226k\326r"
+	.ascii	"ky\347\264\f\300\264\254c-\323\254\345\034k\031\307Z\2769-\333"
+	.ascii	"\230\226Ukyf-\247\3262j-\237\326\262i-\227\3262yZn\323\262--"
+	.ascii	"?\201j\324\322\340xo\214\243\232\233\245$\366\270\327\257\344"
+	.ascii	"7\362s\235d>\177\311\207\314*\247\270\220\213\302\356\275_^+"
+	.ascii	"\002\335\323KR\256\003\246k\020\206{\027\235V\235\306\200\320"
+	.ascii	":\250\247\0054\255/u%\\\263~\246\255s\032\250\355\221U\352g\217"
+	.ascii	"aL\306\262\2408\235\323\375\344\222\266\306)\241x\034W\254_\331"
+	.ascii	"T\374\256\247XU\256\372@3i\013\264\200^b\346$\264\236\2474[W"
+	.ascii	"\200\226\354\246m\375\342\232e\3237}\212\255F\265m\372Je>{,\352"
+	.ascii	" \344n\245(L\355#9\321\2261h\210\344\254\321>\320\026l\225J{"
+	.ascii	"\326?O\326,\026\336\246\375\263f\305\372\351\263\321\036 V\240"
+	.ascii	"\315>\233\3642\273\247h\240"
+	.string	"\rt\331\207\302#\312\232\365\023\376F\030\255\340e\t\307c\031\340\275>!\262\177\332\212\255Y?{\344n\262{\304V\243\355\356w\275T\303C\250Tf\357\275.Zg\332\376\020<\242\350h\004\022nw3\342\355v\274\334\200\036\017)\207\013\321\323\235@\261\201wB\205\256\314\365L\035\022N\203\316\204\b#\\z\364\201\302M\b\020F\270\335\216W!\327\233\035\221P\201#9W\224\353\335r!nF$p\273[\256wt+\332a\336\t]\357\206\304\343\365nj\320w\3626\016\376\327S\253\342\327l\250M\024\245\314\240\366\361A\215E#\032\243\257\177jS\261\207\034)O{X\321\017\237\332\230\222\205L\217S\bA\007\365Ps\270\362\"\204`\2108\266\345\205\213\312\254\251\330\311\220\037Ui\343`f+T\353\237\247\"[V\200\226\354Ud\306!\332T\\8\037\336B=\371\250\021\206K\215\247K\261"
+	.string	"]\353\357t\200>\200\336i\237\261\325\350\263G\326i"
+	.ascii	"\375\257[ ^aQ*\363\2356\252\224\225@m\242\312\025\322\026\177"
+	.ascii	"\250a0\004\021B\206\231\022\031\221\2440\205t\220\002\03112z"
+	.ascii	"\021@)e\210\210\266\244(\351\332m\224\025\372%\205\345[uE\013"
+	.ascii	"\031\370ld\t\311\351\247\271N\245\235\267\203\326K\225\rb\245"
+	.ascii	"\340\361c\2421\200+L\022\240\017\3500Y\\\217\30651>\026a\203"
+	.ascii	"-\305\261|A\320\225[\177'I\026,\334E\2660l\206\323xDZ^\225\273"
+	.ascii	"\220\231o]\032\255Q}\027\270\030\262\361\261\364\276/\272\376"
+	.ascii	"\275,\034\017\217\246u\342YA\022\027\\\016\023\374)\006y\377"
+	.ascii	"I\034\313A\330\366\221\0270\342,\321\213i\336\302\210A\030\205"
+	.ascii	"O\213\236\261\323\035\326B\313\320\026\024\3351\240G\356\024"
+	.ascii	"\300+\357\267\315`\241\231\357\356\n's\231]V\177Q\203\216\013"
+	.ascii	"\232 \205m\357\247k\374\324&\"t\024U\003?,'\372\340Pi7\275\236"
+	.ascii	"G\007\031\036\305A\336\255\371JS|)\315%\223\303M/\007\264\031"
+	.ascii	"\264m\021\350\214\020QH\307\026?*"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.97.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\357\002\265\024"
+	.string	"f&\206I\260\224U:\370\240\231{`4\233;'\365\366\262\006\312{\367\351\376z\372\275h%\271\320\266\223\262?\016\3216\n)7\021\255@\322J\317\037t\256\364co\301\362<\267NG\211[?\273\332\310\251m\323u\263\204\020)S\np"
+	.string	"b"
+	.string	"x"
+	.ascii	"@\253l\377Lt\272\021\001\343%\225JsN\004\027\375\262>\016\241"
+	.ascii	"k~\330\235P\240=\023\371\030R4\347l\361\201\353\203<\0305\247"
+	.ascii	"\n\035Es\342\264\230\300\351\242m\177\306i\344l\242\260\327\343"
+	.ascii	"\363$$9\300#sNr\300_\343\305\360)\343\305u\361\3345\347\037\370"
+	.ascii	"\020\b\250\207\316\316\315\325\3642\347\264\352\354\360\334{"
+	.ascii	"\333\006lO\260\267&:3\343\305o\313\267d\311\204NK\273w\243\333"
+	.ascii	"\302~8\227\205\035\273\357_\371\357Vy\357\206\275\367\277\036"
+	.ascii	"\364\003P5\212\252OT\355RuKT\263T\275R\265\311\250V\211\352\224"
+	.ascii	"\252Q\252>\251\332\244\352Q\325\242\252\303Q\275\242ZC\365\003"
+	.ascii	"\260J\004!\201\314\031\242L2\221\304 \214\377~;\347\007\252`"
+	.ascii	"\355?!\264\357p\220\332\004<\345RP\207Z\330*\360\264\250\335"
+	.ascii	"!\036\212\025D|=\beY\304\264\247=\357g\334pM?;\242[q\346\324"
+	.ascii	"\025\020w\\\026#\274\030\257}\255\270\002\206x?;-\275\033n\354"
+	.ascii	"\210\247\244\273\373\234%:-+<G\355B=s\316\006v\314q`8\3159\027"
+	.ascii	"\334\350`{\320\343c"
+	.string	"3^\324\275\320\213\340k\334\206\215\357\343\333\214>\264\032\031\005Z\206\232\214\fEc!\302\n\346\202\214\314f\273I\230\341R41\033d\241g.3\0349\203!ebd6r\206\243!]R|\323@\303\2215\267\033\216T\365\346\355\330\262@\220@\322\355\316*\213\262\261\275\222\223E\331\020\350\332\223eY\331\326\272v\004\262\266\265\243\021O\211G\355?f7\272\021k\031\214\370\311\b\352R\234V\253\262?\202\255\311\256\366\2525\331\0300\265\0016 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_applyKissRates.98.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\337\005\265!"
+	.string	"\226;\322K\220\026R:\004\301\321\240q\302\204\301\221\340\343\376}\0344\271\375\202"
+	.string	"\260#\bPf\201\204{\021g\333\305\271g\177\327\263\216-K\363O_\262\030Q\030G$\002\243\300\270+\353\bq\342\303-\226\270\215\217\0375B\b![\312\024\300"
+	.string	"\240"
+	.string	"\307"
+	.string	"7\257\244\246\031OK\n]O\376\fc\256\023\223\212+\b[O\252 J\344\326\263\025\313{o\001>/d\265\222\314\230\353$\034q\240\213O\016!S\336{\r|"
+	.string	"7\353\370p\333\2750\274\224\367\016\r<\200\312\347\3773\016\316\241\364'\315b\225\025\237\221`\342\262r\357\325\375\260\r\312\247\3114(\237v\006+\261\232\242\247i[\351\234\n}1\220\021i<\003#\202`U\006\206\211(N\231\030]\221\f"
+	.ascii	"\253DT\237\021h(q0\201\021S\260\211#\016\315\237{\357\215\030"
+	.ascii	"\242\255I\240\005\031\n\034Qh\332\230\305x\302Gn'b\210\356T\350"
+	.ascii	"\336\373n\"\232\340\333\370\177\324\377\245\377\314\nM\304X\311"
+	.ascii	">\220\316V\367\375\232\233~(\237l_\306x\244E-\365\332_\024\266"
+	.ascii	"\245\372\331\274v\352\357\276\017o\361{\270\310\314\303]\374"
+	.ascii	"\235\356\353\260\026s\016{\361qX\007\363M\367s\335\267\351~M"
+	.ascii	"\367i\322\376\f\332\227\351~L\367a\272\217\353\376K\367]\272"
+	.ascii	"\177\353~K\367m\335W\273\237\246}\024\355\237\3357\323\276E\373"
+	.ascii	"}\366\371\007\227\303,A\225{\237\326\256"
+	.string	"\334\262S\254\006o1w1{\261\375\031yJ\t\343\036|\374o\347\300`\267\215\035\255p\370o|\366\257t\346b\036\374\365A\232\210\301\330\027\033cs\302\326\0268\013cu\320ppv\307\310z\205c]\354\213\275As\261(\026\036\313co\226od\t\321\331\261\374\305@6\216\306\263\256\"\302\323Rq\225\332Ri&\3777\220\315\362@\3550\222\r[\255}\240\231\275\260\226\252\013\027\005uC\312\250\344\310\260\325n\263Or\267X\023\312z%T\255\315r\216M\255j\031\265\251\275A;-J\244\307Ox<\204\227T\235V\301\211c\232X\222c8\321*\3363X[\2332\274w\t\310\2648\266\303V,a\257\335Z\323\336,Y\227m\255e\246,\377\003\006\322[\300\344\336\233\340\277\300?\212\324{/\2021\017\031\0200\261BB\371l\273 \307\020\024\304p\264\363\351\214~>\337\217\227C\324\333"
+	.string	"Dr\300\003\252\301\336\321NB/8!I\003\214\204`\260(\003.X\241\301\013\221\005\243\235\317\367s\300\003\266\004\213:\354\314\363\202x@\035\217HgT\264\363\351x\300\240.\210\346?\r=\240\356\350\367\003\352n\305%6\257\235\372\220\2144g\207V4\207,\243\362t>\311ieS>>\352R\2122m\271d\205jj\247nJA\3550\036A-\325\207d\230-vh\345#\333\\\020\211\322:\326\351\377\032\022\2512\001\214T\313\331\330\234m,+V\217\335\2616\226\263d!Y\261\204B\021,\312\242\324\330\036\313Fhl\214\255\231\2614\266\207K\306\316$\351u\220\035\2335R\306vo\250q4\303\024bH\321\214\210\302&\205J\007\220\002\221\271\252\016\021@\251uhJ\242\242ja\r\272\271\305x\225\0012|\177;\250\320\262\005;"
+	.ascii	"x\037\300\337\330;(\307\335\347vyWj\251tw\375\366\\\025\243\222"
+	.ascii	"\200\202\336\t\bz\260(7\033\226\275\217\241E#G\360-\033(\314"
+	.ascii	"H\330\352\315\313\316\303'\343H\032\202\251j\036\330}~a\016_"
+	.ascii	"\300\217A\024\254}\204\342K\213\215\254\222/\202\313\2315`\206"
+	.ascii	"?\324\355\227\t\340\234\b\3548\357\220\037\302_\365_\301\004"
+	.ascii	"\020\371\0210\307\333\301C\364\245\321\023\351,w-\2470,Q\035"
+	.ascii	"\244^\324\361E\240?\374\223\245j<\b\242^n\264R\261\"\202G\201"
+	.ascii	"\251Hr\247\310\256=\360;n[xh \203\034\t\330\215\2257\025\201"
+	.ascii	"\270\312\330\275\237\372\205|\350\345\262\227\274?"
+	.text
+	.section	.gnu.lto_applyActualRates.99.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\271\003\235\031"
+	.string	"\026\260\246H\240\230Q:\200K\027\253|\343\r\271\305U\217\032N.\341\275x\300Tn\343\372\370r\216y\026\345B*\373V\204\306\312\262n\3050\333\036x)=\245\265\300|\315x\345\202\025\302\305\251\027\226\206\312\217\266\332O\b\2212\245\224"
+	.string	"|"
+	.string	"\230"
+	.ascii	"\345\347\212\251Op\\\341\350i]\274=\344?=\310\245\374\212rI^"
+	.ascii	"\331\230\222\001J\250\200Ql\2368\272\261T\301I\250E\224B\346"
+	.ascii	"\243\221c\312\2343\301EK\330&\24106O\364\220\030\350\317\345"
+	.ascii	"\022'F\346\234\n\214\340\372\037%\354\232\023\206\020#s\032)"
+	.ascii	"\260\201\326E\333~\217\373\030\262\313\360\227\244\364\253\244"
+	.ascii	"\243\247,sNZ\201\327\214\027\303\003\030/.\215\017]\207\374K"
+	.ascii	"=\324\321\243\364\251 \272\262$\3149\255>\025+\356\275\355\003"
+	.ascii	"\2669\330\241N\326\201\320\373@\214\027\277/ U;Z\024i\320\376"
+	.ascii	"\021\351\316\260\037\3169\247W\206}\247;G\3258\237\272o\016u"
+	.ascii	"\317l\336\364\013\370\357\227=\352\256\371\217?\200\252iT=\243"
+	.ascii	"\352\230\252eF5LT\307\250\032fT\277D\365\213\252]\252n\251\232"
+	.ascii	"\245\352Q\325\242\252\303Q\275\242ZC\365\007\300\254<yP\316\211"
+	.ascii	"\"\270eZ\211T9>\365;\375P\177\324C\373\366\205\370C\246\034-"
+	.ascii	"\230\235\255\022y-\314\316\256\274\354\253\311\317\203D\331p"
+	.ascii	"&\021^vA\225$Z\250\004\254kmZ;\256kYU\244\013\331\262\266\265"
+	.ascii	"6\\H&e\355\f\n\271T\263\342\216;V\311\250\313\277\230s\216\262"
+	.ascii	"\265m\267\361>q\t )\2612\261Dv\371\030R\232~\323\021\202A+Fs"
+	.ascii	"\026\351\204[\263\007\222L=\rz7\\\026\220\234\242\273\373\243"
+	.ascii	".E\032\304p$?<Is\316\0066\356T\035ZsN\236#$\200v\222\224"
+	.string	"D\214\027uyjP\275\310K\021\276R=\033\324G\367a\304M\024\342\341B\340x\270\240\334\355\302\356\306\313\335l37^\315\302\315\303O\256\346\n\352\231\020\343\303!W\003\002\322Q\260\355^\202p#j\241m;\266\035\315\346C\313\341j@4\333.\210\266\003\300\272\017\267\035\215\247\323\355h\257\337|\370\225\221\2630\244*VE\3333\315\316l\216\013\234\265Y\032&\331\316\354\245..\361\b\222L=\333\252s\2638\013\001Hb\231mlo6\001\220\\\352\311ll\017[\231u\360\024\2630'?\353\024E\303\201\312%f?\344!\025\026Jv\004B\250a,\003\215S\304 \023\221\021MAZ\350\200\"\2513\363\021\220\245V5R\260\365\r\341\370\"\363}\303\222\244\326\304wk\343\364\243\311\263\037P\224\354\222\257n\266\0136a\362\312\\\272W#\275\260Kk&?\305\031\266\361\313Y\362\231`2"
+	.string	"\032\237V\271]\027\005\204\337\307\230Z\357\r\235\3644\334I&\024\f|\r\352\006\337\212D\230r9\007\212 \272\232HhL\363\304\305A7\036\246\332\037\334@ \352\266\"\312\203\367\006\227m"
+	.ascii	"V\b\017*\323\327\323"
+	.text
+	.section	.gnu.lto_applyQuickRates.100.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\335\t-1"
+	.string	"\332W\360\022E`\234N\007\377\250\217\026\337D#\222\001\220\020\355\243\340\305\226\350\260\217\216\311\004\277\036\321\336\271\232\266\264\3500\300\b\033\241\303}\030\002`\3717r\357\220\271(N$\214\332U\223\021\021%\265\2557\331{\247\224R%\001\373"
+	.ascii	"\037\001s\314,ku\034\007\317\370\261Z\314l\247)\363\026\267\224"
+	.ascii	"\236\322T\272J\267\365\225\206c\366-\305\221r\347ru\235\225\335"
+	.ascii	"\333da\245\235[\355\226b\275n\253W\327\223\347\275\315\254\265"
+	.ascii	"\323\035o\037\225m\205\332\325\332\n\031D\250<=\250U\351\220"
+	.ascii	"\306\316#\256\235\353\325\305V\226!\n;\327\027_@-_\333\363\336"
+	.ascii	"\353\324)Sx(+\320\235\353\265\234\021\345Mv\322\335\271\335{"
+	.ascii	"\237x\251\275\317\\\260\360^!T\334\356\345z\342\244\265Sf\346"
+	.ascii	"n\322N\266\230\235h\223\314H\3639\351\222\302\346\336[<"
+	.string	"\352\037\265S\264}\324N\237Ho5\021\207\035\n\327\240\232\242\357[\334A\nJhh\320\370\326\300^4\021\247\007\035\313#\244\006\217\036\356\0206\227/\035s<|u\037\035\354\262k$\346\227\017W5\034q\273\202e\r\fG\2479`0X\260\326Q\264\351\207\335\215\0340.\364G/\214L\327\265\376\\\276r\240G\367\336\206k\367\002[\272\007)\334{\331e\200\325h\316ifN\303\314@\230\205\022\002\267\201\227\026#\034\220\335{\333\b\326O\b\363\326z\315\005\213\333\bW\225\360\226QB\355\264\237\330%\217I\016\245\00727\227\215\336\037cn\364\276\030\263;/P\340\316Q\t\272\331\215\240\323\232\213\356\f\325j\315O\r\245\373@\2575;5[sS\27353\t\235\r4^\363R\2775\027\350\263n\002\356\254\324Q\232\223\334\031\311\235\217\334y\200;\033\271s\221;\023\271\363\220;\013\271\263"
+	.string	"w\016r\347"
+	.string	"\356\f\344\316?\356\f\300\235}\334\271\307\235y\334y'\350\254\343\3169\356Ltg\034wf\335y\350\316B\241\363\032t\016\n\235U\241s\032tFW\347\017:\273\352\334\ft\342\364\"\224\271\227F\240\233\273%}C\322x\335Q\272\323\272\325\272\327\272\331\272\335\272\337zen\346\216\343\316c\026\217\345\372\326\270\035\343\f\337\223V\256v}ud\330\320\245pe\226\310u\034g\266\204,}1fv\245\237/\302\361\004\315\216\313\3334Y\233\247\033\372c\200K\212\240?\237\003G\022\2621]\360~\200\376\001\333\262\003\357\364?\257~\2319[&\200\357\371\004\337\200\355\017\237\007\360\002"
+	.ascii	"[\246\317\013\355\265eM\317\363=\037\224\343\371\364\256e\"x"
+	.ascii	"\004\277\363-\314\246\264\314\245\337{_\374\217\261Q\325\371"
+	.ascii	"\020hb\270\274\r3K\265\031\343\252\363\3020\276\277\263\234g"
+	.ascii	"\337i\370\304\317\371 \271\266n\3518O\374`_[\306\376\360q\276"
+	.ascii	"\333:\365\331W\367\230~\370\335\303\211\263}:;l\f\224\346\345"
+	.ascii	"\t\201\201h\270\356U*\t\277\351\275m}\341\007\265\265\317\340"
+	.ascii	"\257~F\td\037\272\217A\360u\302\2740y3\360L\337p\335\263\267"
+	.ascii	"\364\352\033\370n\325\024x\365!\334\r\233\345\324\364\227\236"
+	.ascii	"\b\020\375\364[\214\321\255\200\3500>\005\375\316k\024\016.\357"
+	.ascii	"\357M\331)\324\377\002\337-s\351\201\354"
+	.string	"\377\357{]o\224\036\270\225\244\277\030'\200\271\367>`>\366\336\324zoL\002\n\213D\226\321\252x\205\264\262B\036\205\214 \374\230T9h\270\240\302h\245R!O\250\230JGTQ]!-\360L\241Hj\035\323$2\353h\304\220\234:\241\205\305Ne\0317L\231\030qe\024b\205\250@\244\022qe\264\262BZ8&\207XU*\214(\037\241\216\311\342\221\252xUe\264*\036\223XE(\037F\236\230J\026\263\220\310d\221m*\033\275/\306RCp\224\320,_TWv\3335\252eHp\3017\235^\030\022\326\225\235\364^\314\234\264>\001\277\376\236\312_\022\221\276\335\264\022\316p\300K\265\302\2715\n\351\233\256\370G\217\364\336\307\376\321\267\022\2635QE?vh$4\372\2363\032\360\364No\364\3754+S\364C\377D\364E?tG\364DR\204~\350\203\356\204^mk\231\007^"
+	.string	"\223\r\277%_\032s\rz\240\005\317\336\242Yz`\360\307XjH\n\364R-\332u-\f\222\305\357\241\336\353o\313\005\022\013\372\266S\360\001>\350\275/\301\263\037\340\273\207\031\226\226\t\245\200"
+	.string	"\034\0314\276\264:\365\307\002\200\260\250a4\304\224Q\210\241\221\021\221$)H:\220\002\021*+n\021"
+	.ascii	"\245U\316\314\bM\222\244\205e"
+	.string	"\f\372Hl\331\tEa\032\376\177I\311/\027o\326z\226\343\300dX\270\\\26550D\270)\370\375\003\225\365\016\002\364\322+\017q\375\3549\3154\250\210A\037\324\350!|\347Es\275_\264<N\r\026k\256\016\223\006\\\330\ry6<\257\377\254\340}Q\361\343&[jgX\022\337\244\233f\327\207\216\347F\354\356?\231\322\230\370\236?\203|\315\006K%\210\252Fp\t\372\034\020|\343\372\205\f\321\221\302+\030\204\215\005\017\304\215@x~\337\212'\303\024q\324x\261\337\267\033\340\003\344\02489\232}Z@\241(\220\f\266N\016\251\302CvEDx\032\354\027\013A\330?/t\013\257\023\305\334\320\312\2131\3266\023\332'd\233\341:$\301\241&\005\340g\221\b\253\214\020\024n_\337\330*[\313\330\210j\350\243LT\217>\034%\2541\312\302V\234\346\340\017\310\266\025\013]\246{\023B\037&"
+	.ascii	"\006\226=\314\227\0058\350\031\003\007\322D\005\207\256\335\252"
+	.ascii	"\341\274\212qA\016\023 6\236g\224RR\306)\037\365\230=9\233p\344"
+	.ascii	"\316\321\3464\246A\307\302\022\203\226\"\252\321=\034\266P\273"
+	.ascii	"\221\261{T"
+	.text
+	.section	.gnu.lto_applyCurve.101.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"]\t"
+	.string	"\326Q@:@\305(\035\340\271\235\177\217-\301\331\t\214\003.\331\330\253\215&\254\214\013t\347\213\346\377\\\340\245\rU\n\234\326\2228\206\341\201\221\321\200\321ux\234\344\206\366\t\331[\312\224\002/"
+	.string	"0"
+	.string	","
+	.string	"\337\306\352-"
+	.string	"(H\\\273\253mN\200=\302k\260G\325\270\367\364\374\207\034z\260\004\240R\245g\266\260\273NT\312\342\326\3336\260\235`?\006\232\376e@\205E!\300n\305k\300\256\304\223\016\333\236\235\261\235\237[)%\007\317\263\214b\314.\006\207\311\356\"\270\340\362h\333\3778\210g\267`\352k\246\233\223\226\f5\365'\327E>\"\341\257\fA\312\243H\330\343\025sa\312\227\375\225R3\354\303UUv\326\037\377\3750\323\031!\0164\332<\r\037\017\203\200\b\024\321\201\3368[\247m\037-\004\3528h['\3228\032s\017\236N\033q\\\247e\276=\\Ue\2721\351\204\261L\205\032\003\017"
+	.string	"2\241\023(0\244/\036\241\247\354\301V\327D\236\211\346\253G,\306FP\016\204\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_scaleRawSetpointToFpvCamAngle.102.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\022\004\265\030"
+	.string	"\366\255\233F\260\032Q:\270\232\247E\242\177k%\334\215\n\211\222z/\345\036P\200q&+\374\347E\224\373A\2305\274\363\320\315\325y\372\341\203t\276\360\207?|\341\213\272\341\245U;\007\260o_\213\327\240Zkd\023)S\n\207"
+	.string	"v"
+	.string	"\216"
+	.ascii	"8(\037(\013\220\314\211\242\027f\356$\321\215\347~\335WU\257"
+	.ascii	"\322\376y\034\310\241\316\243\313v\232%H\234\3001\200t\351\353"
+	.ascii	"\370\216\331s\036I:)Xb\025\024[\346\234\005.\035\200t\351\372"
+	.ascii	"\n\274\374\236\002/=\263\265\\Gc\216f\360v\202\276\3149_;\343"
+	.ascii	"\263\177\2533\377@/\335xt\376\255\370~.&\273\035\023\217\355"
+	.ascii	"k\341^\360\016t-\301SS\0351\230sZo<*ny\333\rl\023\260?\026\001"
+	.ascii	"\376\217\013Q\360mx\204\005\013\340\245\256\200\032-|\341A\030"
+	.ascii	"Hs\332\020\370=\356C\203o\343\322\261\016\372\333\245\337\001"
+	.ascii	"\274\374\206E|\374\344h\332\263u5]\031\366\277\2718\373\271\333"
+	.ascii	"u\335\335\222\352\033\251fI\365J\252UR\235\222j\224T\333H\365"
+	.ascii	"I\252k\244\332$\3254R=#\325!\250\226\371\324%\251&I\365H\252"
+	.ascii	"AP-\245\372\223\352\375\324\372\251\037\340\245\213GD\323\236"
+	.ascii	"\201/\361\b\200\312\2343\201\237\344J\036@\210\020\001\274l\355"
+	.ascii	"\372\374\370"
+	.string	"!\372h\216\204\360\220\3766\263\266\004\232pgd6,\255\314~g\f\021\221\322\206\270 ^\216\264\376\320G\217\"<\344!'\267\242\223\216\326\316\201\351o\244u\331V\307\036\177B\214\t\030\323\013z=/\2669i8\340\216\366bOM{\226\013\256f\021\267\310\275\217\020\222\2351\337 O!4\336\212\016&FOhW\206\356wB\017+6\005\343\0312\304d\037\210\234\020k\330\001\230\354\005\253\360\332p!G\303\013&\363\360:\220r\214\003\005\331\353C,&{\205:\332\277\2718;\310\261\243m\315\337b\271\322e\367\273\331e\255jov\203D\027\265\323\262vdD\3541\255j\357\002\310(\366\254v\212G\225\224\003\035%\346VD\303\245v\265\240\227\232\366x\2739Y\2669i8\250M\255U\344b\2635\213\332\035\"\342p\355im\242\234VA\225\326\232\266fg\332p\205\220\237&\177\342\021"
+	.string	"\r'z\033\tH\250Q0\345\224R\210\251\241\244\240$-\264\030\240\002\021\2619;\021P-cL\211\220*\256Gc\323i\223\334\250\b\264\253\217H\251_P\334\320#*\243\201\3563``\344\377\240\247\244\003K;\007\0232:\006=`\320\370`=n^\177\030A)s\251\255"
+	.string	"\232\220r\254\002\227bu]\356\355\007u\327\211,\363\\\224\02209\300\326s\336\364\233\337\276;\355\243_\241VI\247\020\3470g\317\310\0315\013^&\232x\256\231oq\020\356%\244\350\267HE\320\277B9\276\035\371\234"
+	.ascii	"T\236\234f\231\362\320?"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.103.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\326\005e#"
+	.string	"\nA\360\rC\200\252\315p\263\317E \251\351\376\251{\306\030\214m\342\327\214\367\345&\355\266\217d\024V\370\267\341`\360\300(.^\004\021\300\317\326\362\344n\332\021\f\332U\034P\002\210\243\346FPl\353Mv7)S\n\311"
+	.string	"\267"
+	.string	"\320"
+	.ascii	"\267\357\345_\377b\233\206q/\266q\2351?\3320l\363\243~\313\211"
+	.ascii	"6\271\334\253\367.2\312*\254\362\253\254I\204\362cRmH\243<\311"
+	.ascii	"\224\301\262,g\347y*\370\350\006\245\252},\317"
+	.string	"\322{W\r\217\347Y\304\214\314y\016\031x\251\374Ht#\362\243>G~t\3176\373P\311i[B\344\212\250\347<O\335&y\357&\356V\332\310\261\266\332\363m\022n\301\254\252\233J8\233\204#:\200\374\346\006\353\207\024,\037Z\326\022\f\021\333q7X@jFm\220\3209\361JR\260\266\324\326\343\344\025PG\255\327pYZ_\241,\253Z\322y\236'^qd\375Tm\022\316\363\264\006\263t\334@\267\215\305\266\n{\024\006\312\307\0014\351<\t\322.\361\244\017\356\236x\323\210Vq\317\231\325V\271(h\377\345\265+L\344L\311\343\005\315\300\232\3546C\352R\205\261\3635\260\367s\365\307\247i\266\311y\023Y`\277\357\n\023\007x\345\247i\366\360\247+\264_;\227\253\351\303\233i\325K\253Vz\227\333\300\273\376\002\253F2\325\004L\365\221\252\007\224j\001\2526\022R\027\005\251s8u"
+	.ascii	"S\r\300T\023\001\251\207T-\244\352  5\220\252MU\343L\365\255"
+	.ascii	"T\2278\265\255T\223\245z\304\251k7\365\252ZK\365\023\344\202"
+	.ascii	"\264\311\360u\2369\322\372\234\305\021\f\312\207\177\227\333"
+	.ascii	"\224\324\232\035Dk#\002\317L\274\316\205\222\316\320\336\300"
+	.ascii	"\346\b\255\003*k\366l\331\024\\\316\242\215UA#Wh\255)\355\235"
+	.ascii	"h\231\355\322\"-\216\2405\367H\030\307\213\r\320\332^q8\027\016"
+	.ascii	"(!\373\033\f/4h o\013\264#\021\270\306\\7\017\342\301\255\271"
+	.ascii	"\007\016\371\261y\321f\246\034\3460\362#n\231\2268}\314c \370"
+	.ascii	"j.\266\301\346\320A\037\354@~\274m\020\0251+`>M\253\215\345*"
+	.ascii	"\255\216]\375\361\245qQ\242\261\255\206i\215\334\245\375\202"
+	.ascii	"\217K\256\216\001\377\374\374\341fj\224\347y>\360\303b\200(\233"
+	.ascii	"\260 ?\216{"
+	.string	"\353\362\275\314\301X\370M\034B\204>\370\321\027\261'+\333\362i\332\365<\317\252]\241w\344\356\237x\315\261\nN\3414\225\202\352i\247k!\265\333IA!Mm\030:\021\025\345\342\303\211\026O\273\235\024\005(\236P\024\325\223\207\024SQ<\024Q\036f\360\202\f\345\004\305\323A\241\320\265P\361\264\323A\361\246tN9K\271\210\342\351\250\244\244x:s\350{\355\313\365AH\321\267?\233\036\203 \307\243h\265U\270%%\260v/KO\213>\350$\217\371\357\006\220\342\351\biifV\347\351Cp\264\004\366@)\003\366h_\007x&`\007\354'\034m\204\200\035B#\333\323e46rD\271\255\320Mk\264</1\2445\332\023\257A\374\024m\023\323\026\355\301\334\002\0371_@>\177\022\034R,W\350\277\002\231[\023^e6\205\337\2510\"g'\300\332\270\330\354\331\002\260Lk\210\366\266"
+	.ascii	"\366\300(C\033q\250Q0\344\fCH9\"22Z\224f\fp\002\0311\263n\020"
+	.ascii	"`U3%\351\304\304p\320U\363\203\356\023\352rl1l5\233R\344\330"
+	.ascii	"\340\216\300\224\276B\361\363\325x\302n\366$\370y\321\333\002"
+	.ascii	"_\201\260\201\2271M\226\031]I\247=\355\002\f\246\3711\221\352"
+	.ascii	"\036\317\t\317Z\215\360 \212\313hAJ\f\302LJ\033,\326\023\005"
+	.ascii	"mJ\b|\357\bXy\223\177\232\020\243}\021\027\026\025\377\343T\315"
+	.ascii	"\321&S\025\3313\351\327\032\315\317\032\240\302\244\237\nT\300"
+	.ascii	"\235\212e\357\306I\314X#\231\365\250\334)\243\337\022B\222\350"
+	.ascii	"\031\001!]%\220\364\234 \211\316\232\277?\215]\246\204 \235\256"
+	.ascii	"#]\210HH]K\247\330\b\274\034\370)\257\305\201\202EM\270^\352"
+	.ascii	"\330t?A>6\362\204e\312\332\213\377\252\240<\342\303\366\267\025"
+	.ascii	"\250"
+	.text
+	.section	.gnu.lto_updateRcRefreshRate.104.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`h\005\375!"
+	.string	"\246\375\327F\200\236M:\221\213\204W}\310-\201-s\227.\221d\\\020\332\2318\343\203\264\252%\3129J\267=)M\211\317G\037\261\2150\326\314Yr\241\002H\b\251\321\362\256E\037t(A\322b\2645K\b!D\312$\003\303"
+	.string	"\263"
+	.string	"\307"
+	.string	"g\026\235,\027{q\260u\260\005\344\305\376\312\303vo\013\343`\013a\313\254\330\005c\367\366\262\274\225\037\367\366%\245$\fP\205\\eJj\275\212`\224B\251\256P-\\f\320j\255\t^.\003\364\274\373\256{M\275J\214\255\325*d\013Y\255\306\005\273\204\276T\372\220\371\222|\316|\271\273sn,R/&\306\352JZ\255U\327[\237z\r=\315\222l\236\332\237\024jC\"\325k\005\204\340\340q\364j\256x\024Xr\205\305\347\216\233$\202bY\216 \242\0259\224f\210\234*.u\234\224q#\n\271\203\210AR\251\326\372\343\271\006Q\310|R\250\265.\017\2118\276\266\357\356\220\335\235\332-\037\004\374\341\313=\t\363\345\233"
+	.string	"\027\026\220\323s\255\225\252W\312\314\265\021\221\364\370F\310}6"
+	.ascii	"\037\354\307\035:\334\345\365\370\303\\s\220\036d|\320\204M\265"
+	.ascii	"k\frk\355\236\254\235\265{\362.\231\274I'/\322\273|\217N^\243"
+	.ascii	"s\371\026\235\274D&\357\320\253\374B\271\2237\350\344\005\272"
+	.ascii	"\361\213\303\361\336n\2746\033o\315\306\213\326x\317\223\327"
+	.ascii	"\254\361\226(/i\362\366\311\313&\357\r\034`S\364\3015\246\333"
+	.ascii	"\030\353\215\324O5+\275$y\227\237\313o\374\277^2\231\222\320"
+	.ascii	"X\211g\2241\263\256\264\203\355\307\366\306e\277\274\342\250"
+	.ascii	"\237\261G,N\006tKHfn\366Q\02383\373d\027\360\347\r\026\020m\255"
+	.ascii	"}\331\311>\034*Tw\326\234e\357\256\202\253\351\320\300M\255\325"
+	.ascii	"\301\336\354i<\354\217\274\334\017MMC;F]\336\353x\206%M\213\332"
+	.ascii	"\250\211\202gax\202\234~1q]\324\037;\206\25614US\202\234\376"
+	.ascii	"H\206E3\263\265\366i~\330 \227\316t\256q]C\302C\230d\2738\276"
+	.ascii	"\331\223y\231\020\"F\214\350([G\212^\345P/u\013\365P_LL\367)"
+	.ascii	"\304#e\233"
+	.string	"l\255%j\356W9\242\371\327\271\177\274\001\032D\374\024\275\260\222\232\250\215\362X\375\001r\272o\241N\352o9\351\344\f\215\t\2240%ANw\377\345`b\354\217l\013\022\001\213\202\t\nE\324\316w\264(\230z>\247(\335\212'\237\357\2117`W\202\241\232z'*\330\240\232vQ*z\026z\276\335\317\004\016\252\251\347s\002\021\265\242\367\373\265\340\001-\217\211\367\323\361L\350V8\355|:\336\017J\307\224\333'\026\275\237.\352\351\351\247\273\031\201'kg\355\207;f\300\016\256\024Y\253\220\t\377\372\321\2768\335[\357\321^\347\002\006\r\032\200\372v \313O\260\r\226\363IP\003\365r\225\236`Z\026\324\017;9\305\210\033)az\037\347r\2346p\340`\276d3C;iD\236\302\254\265\255o5\005@\232\246iy\n\023\355Z\277\252\210k\264\337d,\265\372#\324m\020lE)z\371"
+	.string	"rZ;\027\374\214\rR\237g~\324\001j\250q,\346\fb\b\215\314H0\232\024\2449\260\"!\"\363\020pE#M*\351\275\024\0017\3110j\032\375T\317\267\346\324B\342M#v\023L4\"\275\345\207\253\362\246\352\242,t\325\037\332\210,s\200\364\260\355\315\301==\333\034\033\034[4\313\024\r\031\2465\200m\374u\230\272^\007\f-\351\365\347S\2312\355\017j\241\361j\360z\221V\0358\270\230\023@\277c\334\231P\274RA"
+	.ascii	"\017=\327$z\371\260\371G\241K\316?\356\n\037\334b\017w7?hA2c"
+	.ascii	"\013\357L\374\033\264:\337\371\262\274\230\021\374\215@\311n"
+	.ascii	"\te\316\224vJ\230[U\020\003\205QV`\325\331\330\352\200\003\252"
+	.ascii	"]$9\207\244\022\304\223\267\370[\223 kP)\316\3477\243\26585\373"
+	.ascii	"\3332T"
+	.text
+	.section	.gnu.lto_getCurrentRxRefreshRate.105.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"bL-3PO\222\016"
+	.string	"v%\255*C\241\026\364\001R7`\300kx\331\\\333\025\255\335ZC\343\346s\004\2642{UE\205\325\n}\026\271\026\317Y#\226l\231\002O\231\251r\323\202s`HhpS\005\3412\322\324\203B\345\"(\252r\230\227e\037d\004\0356\361\035\351\263n\307\022\032\354\325v5Q\033\262"
+	.string	"\214\016\206\376q\220i|/\311>?\216L\002\245 \250dV\204@\211\322N<\376\315c.HC6[\3708,\242\222\026\n\022\226\314\347\004:\020\265a\245\250\215m\324*Z\267\"\275|\230\254\\\036N\021\340 3\307\313s\321Y\177\203\277\340\317\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_calcAutoSmoothingCutoff.106.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\345\013"
+	.string	"\326VSB\020q\233\016\003 "
+	.string	"\n"
+	.string	""
+	.string	"\022\007&\2525V\224yX\323\020z\204\3744Z\200,jQ\300@\357\263\364\034A\230(k\337\t\004i\f\220\\^"
+	.string	"\346\021\2449\312+\025\\\364\027\217o\337\332\2262\245A"
+	.string	">"
+	.string	">"
+	.string	"&\300\277\370@Z\324\330\335\312\300\007P\237\3427\324'-q\357Q\323\3639\300\321#F\344\032\013\220b\210"
+	.string	""
+	.string	"?\"\202\025\0224^z\206\200\036\231\227\317\356:?\020\304=\335v\003\333\016\354'\b\177>\375\013\201\024+\023f\354~haY\225\t\006\n\333\236\255\261\375\264\0250\360\036v\260\356\222XPv\303\216\027<\177\342\024gvG\270@\331\335\216\017`>\331\366U|\205g\247\3040z\rQ\177:\324#N\251\232jk\340@\375\243\364\245\177<\350\310QU\235 7:\262%K>\222\212*\2119O\rq\302\204\205\214\217\264a\207\243T\022\373qu\204z\370\307\247\365'\001\233\326]\026\210\3430\221\205N\3232\bZ\207\301\022\300I\300\262P\004,\2636\320\206\007\0252X\001|y\256\255\272(T\242\220\225U\327\306U\236\215\265\013\330Vu\232\266U\232p\257#~\351\031\021&%\311\271\225\n\020"
+	.ascii	"n\004\034`\303B\026\352\n{UU{E\345t,\310\331\204\344\032N3\201"
+	.ascii	"}\365\236.c.(\213\005Py\232j\217\006\246\366"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.107.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\257\020=F"
+	.ascii	"\252v\374\031<@(k\f8\260\232^\030\211\\^\315\350\235\305\t\242"
+	.ascii	"\304\211\341\016#yw\376\f$9\340Q\335?\275Tm\260\003\337\311\376"
+	.ascii	"e\270L\246;3\263\271\252\252\265\334Rn)eJ)\005\224\001h\001\221"
+	.ascii	"\001\314.\017f\267U\265\315t\037\273g\032\315\262\323\364`\325"
+	.ascii	"\232RL\273\272B\357\373>`[M\246\315\327d\226]&\215}\001\3317"
+	.ascii	"?\273B\357\313\247l\225\r\260\2556y;s\213\351\275eC}\264\323"
+	.ascii	"\373\3161\002|_\276\002\334\305\266\312|\215\\[e\033jm\225y\311"
+	.ascii	"<\250\371\350\336\006D\367\206\206\321\373\276c\177\305\335\255"
+	.ascii	"8\355\224\257\031\371\313\366\352\342Jniea]YUQMI}!\243\240\236"
+	.ascii	"\234\232\230\226\224\222\334c\313\032W5}_r\033+\264L8\265\366"
+	.ascii	"\352J\223v\f\337\372\260\351\227n\315EYl\274&\033\347\362\353"
+	.ascii	"d\032V(PQ\3435\327\244\310\"Z\230\335\247\306\267\306\264\026"
+	.ascii	"\264\263\240)\030\341\236c\215\021\343W)\262\016\257K\0376\303"
+	.ascii	"\244a\203n\336\264\240\026\267\002\323UT\317\236\372\"\270\305"
+	.ascii	"\245\300\364W\232\204\230\307\244\017\233m\322\004rm\020;\360"
+	.ascii	"\211#\215\025\254\030\311\322QPOv\201u\356\324t\327LxM\272(\276"
+	.ascii	"\224.q\311\303\326\207M,\351\2017R u \024WJ\223\202a\270\016"
+	.ascii	"\233M<\251\327\262\264\233\"\017\233N\322\260\276&~4V\240b\204"
+	.ascii	"I\267\\T\214\3105\333\207M\271\277\346\302k.q\343a\223\311\233"
+	.ascii	"\257G\270$\255\306u\232ZA)D\262\004\007$\005\323S%P\373\265\371"
+	.ascii	"/\301\271\245\311\367}\273\257]\b\034\233\273\261\302\373\276"
+	.ascii	"\354L8#\315`\315\354w\314<\201y\351\031}'\215}\337\227\001w\341"
+	.ascii	"\017Ee\001\022\357|\254\255f\370\3473\270\b}\323nM\bIy_\246\020"
+	.ascii	"\215\326i{\3375/\377\013\357n\334\360\330<\312\375\376\355V\250"
+	.ascii	"\3474\2353\356;v\001\303\233\tcm\265\337\0052\370\\\262\346Q"
+	.ascii	"f>6\177\247\243-}\356\370\347\230Yg3\326\271\214uf\301:\257`"
+	.ascii	"\235U\260\316'L\224\370\300:s`\2357\260\316\032\272Ls\206\206"
+	.ascii	"vc\3504\315\027\032Ns\0032\326\231A\353\274\200uV\320:'`\235"
+	.ascii	"\021\030\235\017\034\235\r\264\316c\254\263\030\353\\\300\350"
+	.ascii	"L\300\350\254t\235\303V\347\001\253\263\200\3269\200\353\f`u"
+	.ascii	"\006[\235\277Zg\257\243s\227\353\314\265:'W\347\255\326Y\313"
+	.ascii	"u\316Z\235\261V\347\253\326\331\352\350\\\345:S\255\316S\253"
+	.ascii	"\263T\353\214t\235\243Vg\250\325\371\251uv::75`3\323\321y\251"
+	.ascii	"uVj\235\223Xg\227u>\032\235[\2433\333:\033Y\347\225uV\215\316"
+	.ascii	"\251\321\371WgW\235\373\314\n\211\236\023o\336\267H\364\321k"
+	.ascii	"\250\302\331\322p\272\001\273\313t\247\351\224\271\t\007\231"
+	.ascii	"\007\032H\214\004\223mMo\233]\036.\035\b\310\203\254Z\223e"
+	.string	"\343\007\225\300\376\271a\265pN\257i?f\227y4\033\346\021'\347\313\373\276\255&VO\026\327Gl\215K\220\247*g\316\250\372V\257\317\223\013\333\f\2178M=\225\236\277\271\333r\257\3178\220\bTRS\310\227\3625\344;\210\343\323\364\345P\037\365\314\313\3472\2147\223\271\2432\244\230\315\216\264\334\213\220\370\276o\203\345\230\206d\241U\005Q\337\314$Z~\341\237\2369\303\006o&\324'\201\274\032;\375\323\273 \267B\215\322\234\236,n\317bC\331\303V\204\351\235\212\272\351\033\217\321\214\246o\365\366<}O\215[\224\245\002M\366\035\330N\227%\372rm\020\273(\315X\227\376#qh\305\031KNq\260\364\200\305&a\222\222\224\315\351Q\331L/\204\233\371\324\232\021\363\344\376\334wr\206Wz33\177\020\245))\342Y<\262+\276\377\214\312f\221\364\314\035\332\020\207Oj\304f\361\034F"
+	.string	"\332y\323\036\337}\356\277\025\254\373\3757\310m\377\350\241\003\265\337m\n\027\241k\306w\0326\373\241\377\260`|\n\237\3205M5\264S\362\264\274\262U\274\020f\343'\246\261S\315<\264\341\215\337}-\205\346-\022S\363\340\252\3427\214"
+	.ascii	"\254\263\310M\021\233:\345\352\257\317\355\007B\304\332L\r\257"
+	.ascii	"\276\332\027\036\033\301T\331\353\267_\373\222\273<3xH\364\036"
+	.ascii	"\036\374\302\304\217\322\255\337B\323W\037\202\233\267H&\372"
+	.ascii	"0\375^\323\252\\\234\234'T\202\034D\204\377NN\261\376\233\231"
+	.ascii	"\361\323\346\215\230\031E\347I\301\376\253|\byE2:D\013\177\361"
+	.ascii	"\002M\307\216\013-h\240\265e:\3120\300\260!#\206\0164\264\032"
+	.ascii	"9\224\370L\354\f\307"
+	.string	"\330\331\2131\0332\312j\214\235\341\3101&\006\305h7\\\340\030\323\201\206\206c\314\345[\353\237\343\023q\206k\317\266\305\353\2003\210\262\234\322\366j\274\340\031<\202\304\276\267Hy\206\320\256_\360?\314,x\343`\024N\0342z\\\357D\360\n\234\313+\t^\001_Z\202\027\303r\340\021|/\26184\305\201_\240\030\025`\307\271\2304\360fbf\030P\214\264\250e+\253\354\233\020K\331fc\017\346\304\217\3351\373\023#\b\363\344\221\243U\340\305\236\233\260,N\226\3307\241{\341\301\307C\227\236I\024#\360\005\036\002\037\023\256G\340;N\253rh \311\301R.\355</\205\343\2251/\263\370P\276\021\b\244-\316e\213\316\204\227\342#-W\357d\227M\325\207W\353\276\224\335\300\033\274[\311{r\246\211U\203\377\360\375\345N\264j\300\207\351\335\331-\367\272\257\216A\230\200\001\001^\300\225"
+	.ascii	"\357@Q\221\n\354\001<\347dD-\211x\225\345\036\205.Ne\231'\006"
+	.ascii	"\340\013\314\353\277\336\335x\024\257'"
+	.string	"SL\304\210zq\316\251\256o*\376\244\353[\260\003(&z\266\371S\347'\365Nn\300\257\237\343\016l\345\237\250\022\317\251\313\364d/\204\354{Pw\247H\002M\366%\276\305\330Y\344\006\205\315\243\216\027\225|.=\271%J\"pm%\265~\013\211\326;\210\013\004\205\365YO81oz\221\254+,\253\277\352\340C\002\201>\250A4\205\025T3\"\022DAS\220\2441\321\005\304\020\346\240\225\007\021\340\244c\016\251!\032)meX\003S\243\266R\304\231\273\232\026\373\344\3412\213\217e]\220Bv@\017\311\212\3555\212\305\343%\n\033\264\204\353\307k~x%\317\212\231Q\265\003\215\303\321=!\367\t\301Jj\214'\255>\326v\324b\371BgE\351\301\201\026e\245f\272\330\246\312G5\313LN\233q\271\322\251l\211\024\252\001\275\272R\n\226eP\273|\370\301\241\354!F\222\270\003\362\243"
+	.string	"\3526\b\334\233\357\023z\261;\352\225dw\033\273\276\366\362<\265Ko\261{\244\245\300\317\317\221\330\241MB'*\033y\242\327\n\304C\373P\334~\177\317\021P\275\267\345\200m\037\313>\002`\274\362T\260\267\233\313\202\3562\316\326m\273ls\342sj\345\304\031\346n\247\323\331\017\270\031\371\373\251\231'O\322\004\375\f\244\3112\300\\\271\327=\256\225wN60\245\205j\336\025e\r\251@\bf\316\362\247N"
+	.ascii	"\320\243\366\357\307I|rw\260\361\243\240%'T\306.h\217K\202\257"
+	.ascii	"SH\341\017\213\264Q\274H\031x\037({\253"
+	.string	"\201\027\276\177\341@ytXO s\275\352\325J\337\200\024 af6\276\301\276z\305\217\3172=\373\362\221\263\351\306\b\n\256\003\027\233#\310\036\244\370\211\206G\035\210\336!\325(\b\374\030T\327\013\303\305\375#\256\033{\217\021\262\252+\260\323g\244\214?2\250\277F\0368\021\013sv\007;\211\311\210\321\202:\342\231\026\350"
+	.ascii	"\320Y\177]\244\"\342E\033,dpJOr\326\323$\2229\346\242\0014\204"
+	.ascii	"\035K7{bu\333`1\017\037\026\315\237i\222\257\234s\341%\362\004"
+	.ascii	"[\246)\354\371ONNoo\335B[\020|T\221'\254\023(\314\0340\327\331"
+	.ascii	"\2600.^'\022Z\271\374C\005~\255\261\321p]\315\215\345e\265p\252"
+	.ascii	"\373`\220Xd\274k\307a\376\033)C\023?\327\030\310\237\177\004"
+	.ascii	"T\374\200\357\3200X\265j\002\022\005\213\311\\?:e\314\340D\363"
+	.ascii	"Y\234Y\033\264Y\333m\357\367\007"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.108.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\235\n"
+	.string	"\366RG@ \345*\035 \027\t\376\2043`\t\0130\216\370a\360\215\237\301\022\254\na*Rj\334\303\024BA\026\263\004\213\255\264\222=\tKt\252\001\310\021\251\344\036\032\320\234"
+	.string	"BP\335\326H\020\331)\0050"
+	.string	"3"
+	.string	"8"
+	.string	".\017\002\377q\376\001\377\231\264\007\274\234\355\005hd\250\230\273[=\220\223\247\244\177\223w^\260\326\351fawM_0\216\333\273\355\220\355j\237\"\247]\266\250\367a_\263\273kOf\377\366\323\315g<\314\002%\002\273\033\347\201\325}2\"\036\333\247\366m/!\177c\275`Wf f\267L\360\001\347_)\320\026\337\222b\351p\251\355\020n\253\2163\200\225\016\t\316\334\345l\323\220-\361\024\347\ff\366\304Q*8\273\253pbq\001\232\205\374\363Y\340\277\021\255\026\263\231.\032\244\025\211\001\002e*\255D\361\244\"p(\n\307\032>T\224\211t\252\341\250\252\242\217\305\b\207\261\256Dq\254\236r\257YO\346\206\021\235\313\303\260O\207y\031\321\002\304l\336y>\025"
+	.string	"2\241\267/0.\016\270\003\214\253\225\352\254n\202\355Z-R\007v"
+	.ascii	"\276[U\023\302U\027\2331\366\220\236\025\007C.\3016\253)\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.109.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\365\005\205!"
+	.string	"&~\323I\240\326Q:\305\370\004\347\220\243\202\023N\322x\355\347\363\253M\371(h\364$L\206\033\306C\314\0043o\363\267_\246\242%5\254\035\177\013\307\203-\340O\336\202\2206\244\333G:V\206G\243\313\032\356\303\272f\t!r\247\024\272"
+	.string	"\261"
+	.string	"\310"
+	.ascii	"?\374!\236\371A.\304\351WL\257\302\372\332\345\005\013\256"
+	.string	"Z\213D7\275@v\223F\017\344\307\016\377\341%\221u\243\326:\353`\317n\256\355d\317lo\361=\234\356\303\311\222V\201(r\024\251\265\026\260\001\331\315[I\251\375\252\357p:\261\311\207V\201\306\020Ej-\026p\220\354\246\213\267\2357e\3379o\332\366\001\004N\366\275H\025b\2065\214\002\362Uk\021\267+\356\373i\226K}\376\323\317\005\223%\305\312\325\024\211\233\345\200\241\223\0217S\301\322\006\005\305\226\017\264\034\361\275\231\202*o\265\326\033O\245\246\200\224\306\214j\255\246\302)\021w\354\2665\3306\262O\005\001I%\345\236I\230\020w\223 \271\260\213\356w\367\301!\024\rs\200\245[b\005\271\214t#F\376P\331\273\027\311 \253\265&@B\340\331\250\\4\2357\277U4N\fw\020\1774\314.B\321Ua\277\254\233bh\251\205N\344\016Z\352\333R\003\375\352\376\271\217?\300\211?"
+	.ascii	"S\367,5\317R\333d\324\265\223z\347\244\326Y\352\234\223\232v"
+	.ascii	"R\343,\365\315ImsR\327,\365\314\32441\352\231\245\226\305\250"
+	.ascii	"cK}.\265\271\324\345I\275'5=\251O\364%Z_^va\265\206\b#S\265\314"
+	.ascii	"#1N\344\277:\326\355G\253@\020-d<K\273Y\234\025\200\025\344\002"
+	.ascii	"\332\033\023Ia\327\267~[\240\232\335\265\331\007e\314\266f}\262"
+	.ascii	"\202\\C;k\360\245\305J\330\025\026&\264Ck\032U\3420\204C-sU\230"
+	.ascii	"\356\201\032\034I.\264v'O\236\225\342Ys}h\3600>\001\3221e\271"
+	.ascii	"*(\255\265>\355\246\260\357\244\331\232\034\306,@:\306v\205c"
+	.ascii	"\361\311\216\374\025\236m\241\211^x\223fgJ\226\340\230\331*T"
+	.ascii	"\204vF\266B\373\240W\320\312r\227\022%h\217%\206\030[-\246'\267"
+	.ascii	"\215\355\215\257aE\201\375\316\275\355\203`~\366\\\\\231(0\335"
+	.ascii	"\263\230^\306\311\275~\366C^\332P\222\304A4\267\211\223L\b\274"
+	.ascii	"\\s\313dp\bu\364%\0169\013TI\302\021"
+	.string	"o\027\341\210\227\3535\360\320\263\311-\345\030 m\330aXJJ\342)\331XW\244\353\341t\027p\033v9\036N\327S\302\025\3558\211\303Q\017\267\224\224\324\303\315\212\277\227uS\370\334\332a\205,\237\3457\336\301\226\016+\244\371\373\316\236\225\262\335\2636\372-\324i\353\016V\346\301\214)\303*/\246\363G\347>\206I\f\t\"7\274\210\376\243\217\036\306I035\254\276\274~H\333T\350G#\375\313\217\336\275+\203\215\312\307S!3n\f\253\276lkK8\227\223=\265\265\255\231\025\005V\243;kO\240p^X\333\033p\237\254\263\264\335\331\007\233\344\254\316\232[E/7gcG\264 \203C\234\265\tg\250A(\007\221a\204)\031\032\005I\222d8\240\"\221\263\321\003\021\260-\023\020\021\215\244(\205\354\006\303\360\331\216\214\241\320HT\024\347\362|\311\355\271\311\252%qp\315\350\266z\240"
+	.ascii	"o\307\0065'\263#\373\244\207H\335\006\330\354\340:`\205\317\337"
+	.ascii	"\"\216\301v\204[3\n\314\023\321\354\366\313\305\350\330\233\376"
+	.ascii	" 0\246\317[\201\307\231$3q\346\234:\301\006O\0207\t\262\3218"
+	.ascii	"P\273\211\020\215\234n\236\211l\016\310J\\\034E\005\r ~i\017"
+	.ascii	"\031\273:\314\241\264\n\320\016:\332\325?\311\312\274$\352p\377"
+	.ascii	"\3542\271\346b\3004?%\f/p\246\230Z -|\274\377l\225\021T\266p"
+	.ascii	"2x\222\323X42\262*\n\254>\003B\321\221\222\021l\323n\321P\256"
+	.ascii	"\260\205Y\350\335f\277?"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.110.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\033\001E\f"
+	.string	"6VQB\020q\224\016\030\003(\3261XP!\313\203\r5\016\rq8\225\026\016*\024\275a\037j\266\232\354\372\302j\337\032\366\266]G%\357\321#\030"
+	.string	""
+	.string	"\210H\001=iq\002\212\300\310j\033\266\275\267\224)\005?"
+	.string	"="
+	.string	"?"
+	.string	"\025>Vv9K;\\{\204OS\363A\217:\303$e\022\262i8\244\360F\227\215\224\372\b\240`d\300l\242'\200$\205r\216\247i#eZ4\273\353,m\030n\313msl\017\260\277\001\236xx\035!\"\004j\325\021\312\316\346@\251\033\366\265\353\272\316\252\262\235~\231\326Lg\246\037\377\342\302\212\f\007#\273\247\256\306\306\200,@\330\376\330\027\0270\360\261v\316\303\tc!$PU\252\030\016\233\237\370P\275J~D\264J\361\316=UI`\3670\221z\024'\317\025*$\033\324\235xU\340q2J\032\266!\274D\007\300\356\036\360W\357\220\340\1778\364\004O\276t\350\007\2762Wf]\f,N\203\004\033\353\312:V&\200\261\007\0132+\002\206e\326\205\333\253\3121\305\005\210\310\363\265x\216#HQ\001\"\002\177->5\331~jMHEow7\352\206\023\245\244EI\034"
+	.ascii	"\027\0230\252\232\002\363$\260\021\220\f\310\200\355\002I@.\b"
+	.ascii	"\005d\003\310\300v\223 \n\230\301\302*VD\300\026J\232\365\313"
+	.ascii	"\205pb\214\004o\017\013\035Lh\b\334\001\315@\212\252vB\001"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.111.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`]\"\315\214"
+	.ascii	"\n\333\2600G L\333\031\003\237\351.\334Z! &\305\234d77\034\002"
+	.ascii	"\250\366A\\\303\006\336j\322\0059\331\323\\^&z\207\342\265J~"
+	.ascii	"\277n\370\375B\255\027\017/5\0203\372,\032\\\300\375\247KS\263"
+	.ascii	"\264\266\313-SJ)\372\002\313\002\377\002\254T:'\225\316?JgW\351"
+	.ascii	"\214T:\267J\347\3577\315\336\316\335U:N\215\n\205K\337\023\276"
+	.ascii	"\275I\262}\336@\344\235\227\376\353~\323\355\246;\257{M\367\\"
+	.ascii	"w\\7['\375\307]Gz\223\271\001\3778\257}\345\336\326\f\311\035"
+	.ascii	"6\265\005\372\230\231|n\2120\202Y\263\307L7\313\253TN\201\344"
+	.ascii	"\035w\033f\346q^\277co\033\311\202\375C \211w\3073\334\316\332"
+	.ascii	"\216\231Y\307\314\304\3261\322\016\215\232\bM\307\314\271\r\222"
+	.ascii	"ZaIl\022/w\336\367-F\262\221k8"
+	.string	"o\211\353\355\0253\200\317\033\033\243\212d\267q\3135\\\247\201v\034c\223ZaGR;_w\336\367\035\221l\344R\033\271\215l\273\310=\323W\"\335\306\337\344\221\221\b\267[\27713\271\203nc\031l\205T\266\016\230\231\215T\266\225\231<\202\n\332lYKZoo\022\327\fI!\033\343\373\2769\033\311\033\222\215\2042\223\320og\357\017\027>/8\306\367}\245\376\3123\313\265W\334~\333\355[s\211\026\332\254\206\3458\216\3230\034\243\341+\237a3\374v\305\302j\205\212\024(N\230\250\242*Ab\304\224\b\251\020QP\316'\020NM\037<t\340\260\201iIC\006\245$\f\027\220,T82\242P4\201hH(\b\250\311\\*\223?.\262}\207r\377\2640\003[\224\212i5\253i\207\310Z\021\200G\234\345\004\343\322P(3K\322\f\227T\026\005;*\213\"qF\363\323\002\260\017"
+	.ascii	"\363\347\205]Rf6m\276\266K\312\314\276\232\317\034\225E\277\234"
+	.ascii	"\315$\225E\245m\223\262\250\021\347\267\244\262h\021\276F\277"
+	.ascii	"\3126\013\253\307^\341\330\327\307U\360\351\024{\372\3708\212"
+	.ascii	"l\237`l\023\214v\274\212\221\004\247j\233\203i \264`\030bK\202"
+	.string	"ln\220\317KX\031\253\323$F\3209\364):-\202N\241K\t\206\031\356\001z\210\250\277\206j\247\260S\034[0\314\257\r\372\002\030\355\275>wz\235~z\323 \336\354\271\223\233nr\203\365\017u\355\241\216\316;\3145\2079\021|\003\023\2667\030\2629\353\245\237\026\032\334:\203\033ZX\233+\251\261z\222\232\306\300\026\202_\260c+\343Hl\326\254\271\205\2621\265\256\340\245\217\272xq#5.Na\213\027\311i\361\ttY\234\250\267\326\364\320\031\026\027\242{#\305\203\366\020\251\016\304T6\026\245\233\355\323\035;=FI\272H\333\332L\202aP\234\311\242\216\"[c\331\330\223^>Q\222%\333'j\337\222\026\f\233\266Fp\314\352\364[3\241\205\201\340?\202_b^\3566i\344R\254I\267Ab\0370\305\270\374\321\302\242\264K\357\373\266\265\035L,\352\376\323\342}_v\251\330X\263"
+	.ascii	"\315\214\224\302\314\0160+\035\020\312\344\177\231\353P\242\233"
+	.ascii	"\"\311-\355~\2775\3215\215J\2368\206\\\276\347\347\205;\341\203"
+	.ascii	"$\3615W\233\360\310\305\271\3066\227h\214\230\0378i\"\321\267"
+	.ascii	"\265a\2401.\"\207\304<\rJ%\003\2324Q\350\207\376\007\316\353"
+	.ascii	"\261\312\2050\201:q[*\364VT\262@\256\327\342\240gl7\031\022\362"
+	.ascii	"\t0\002v\275q\240\017z\027\261\213\032\355\271\301\264)\357\313"
+	.ascii	"W\331\354\036\256\367\335\342\320|\240\357.\264\250g\231\371"
+	.ascii	"\315OB\354\272\303\374\226k\030TF=\257G\244\271\301\264\266\261"
+	.ascii	"\334\344'\261\231]\r\227d\256%\313\362\335%v\262^\217\312'~\006"
+	.ascii	"\245\342W\350\244\211\312\007c%\033%\214{\214\342U\314\312f\204"
+	.ascii	"\221CeS\314f\033J\305\225\342R\240T\250Q\232\314\251)\232\371"
+	.ascii	"\023\316\003\201L9&\216Q\021\313\314\316\241\352M\030\233\341"
+	.ascii	"\312\320+\316\004\212\305\250\221K\372\332\256&\214\032\225\215"
+	.ascii	"1\251\305\307\304\350\270x\022\260\344\003\265y\\\373\361\342"
+	.ascii	"G\276\300\270\221\"?\215n\232w\371\007HG1\036\365-\367\205\306"
+	.ascii	"8\256!\311\370\233m\375\326\332\261\017\362\231z\3724\266!\364"
+	.ascii	"\236F\250\265\027\365\264?e\245\317\332?3\324\255\025\261\362"
+	.ascii	"\270%H\023\331E\343y\221|_\256*n;}'\306\f\0324\334F\376OYYll"
+	.ascii	"s6s\215F\344\274:\f\220Q\213\323\3146\3720+\351\354}\337*\356"
+	.ascii	"\3026\274\301\275\245\221\214\003\001\004\334F\352 \023\206\312"
+	.ascii	"\246\330\235\345\316A\266\321\243\246\370_\345,\267?\202\353"
+	.ascii	"!\227\357an8-\230\305\275\205\205\344\360\226\346p\033\331\217"
+	.ascii	"Df\013\325:\335\362,\363[\324\277:\230FF\307_\205\271\235\024"
+	.ascii	"9\267\222\036k\266\346\006\353#E\232\316\355\305t\316\352\274"
+	.ascii	"f\017z\256\231H\3075\013i\347\037K\347\n\230\3168\212\234\rh"
+	.ascii	":\337\230\340\\@\3775\333 \240F\257i\036\240\3274\323h:\013\320"
+	.ascii	"t\236A\344,\243\351\034\243\235a\264\363\213v\016`\351\214\325"
+	.ascii	"tn\321t\276\"rf\321t\266j\347\025B\316*\230\316)\224\316(\332"
+	.ascii	"\371\204\220\263\211!\347\252!g* \347\022Jg\022B\316#\200\234"
+	.ascii	"\247\224\316\"\204\234\245\204\234C0\235\243\204\234\241\230"
+	.ascii	"\316N!\347\247\2453\b\245\263\223\322\271\251\235?0\235=,\235"
+	.ascii	";4\23594\23574\235\231\230\316KLg\rK\347\f\355\254\024\344\234"
+	.ascii	"\024\344\214\241\235/\0049#\265\263\205v\256\020\344|\324\316"
+	.ascii	"F\355L\241\3354\027)\235',\235\211\226\316C@\316BM\347\240\246"
+	.ascii	"3P\323\271\311tf.\235\227K\017R\037&m\200\227\002\301\307)\304"
+	.ascii	"Ky0_\242>\304w\341\274$\227\250\357?\303\246\305\017PQ\257%\213"
+	.ascii	"\363\241\036\311\317\353\361\214\363\232\360\n\024K\377\025Z"
+	.ascii	"q~\023bi\363\360\325(\355\364H;4y:<=3C}\225'_\247)|\337\367\004"
+	.ascii	"\177\331\233=\375\236\200O8p\\\020\377\364S@\264i`\220\200gN"
+	.ascii	"8|\225\233M/\305\360\001c\362\346<\227[\0134~\351E\315\013;\344"
+	.ascii	"\354\001\376\013Dc\271N\337c\256\206\377\344\241`\305y\316\231"
+	.ascii	"\3436\322\t\204\026\232:T\353\206\2572Ey\262\351;\221\362L\240"
+	.ascii	"T\226\274\022\263\027\343\274\260OR}$X\206^\371#\377\205\365"
+	.ascii	"/6\216K_\035\241\331\357\336\310U\037*\024E\r\357\225U\365]S"
+	.ascii	"\213\217v\317\365\321\017\200\215\201m\2425\203\227\351\246w"
+	.ascii	"\264\177\263M\317\\tll\013:\f\243\364\325\017\357e\327\303\001"
+	.ascii	"\334\303\267\235;\366y\032>\351xK?\374\322\007\257\305\035\336"
+	.ascii	"Cc\0075nr\250\326\021\n\223\276Z\355\306[\304\323S\202O\351\306"
+	.ascii	"\313\203\227\210\007\317\016\036\t\210\356\244\033\217\016\336"
+	.ascii	"\241!^\020\243\036\206\257\366\341\3602\332\262\033\236\3519"
+	.ascii	"\274U^\327\233\350\206\267\232\223\365L\337v\355\326\274\256"
+	.ascii	";\036|\326\257\200\353b\\z\r\357\301?\345u}\211\326\360A\316"
+	.ascii	"\233\263\364\236\305\322\226\3415|{=\272\240\307\201RA|\332\261"
+	.ascii	"\34362\303w\233n\371\364\354\254M\225\360t\271\360U\245\357\304"
+	.ascii	"@@\245o6\355}m\212T+\222\230\3066\nP\335"
+	.string	"\325E\260\n\316\246\361_D>\251\317/\351\225\213\204\215\026\276\312~\364S\330:\\\025R#!6\255\303-"
+	.ascii	"\303\357!\347H\023\211|\001\217\341\177\346\264\025\276\352G"
+	.ascii	"V\002\217\276\312\205\017\022\274\036\352e%\333\\x\022\204r\032"
+	.ascii	"\333\240\350\336\214t\270H\337"
+	.string	"\202W\303;\307\323\221\301\023\017\036\267\221H\317\214\223\263\306\274\007B\226\202\205w\301&+O\016\013\037e\330\215&\346\261\250\3027\332\365\360\2053?\027\237\215\336\322\n\177\364\307\307\345\320\3513\341\311\307=z\027t\021|\356\311\347\351\370\314>\263n#\217\376\nK\023}\265\207\310\254F\206\276\312MEz\003\227\310;Y\363\\\377\256\234\031\032\205~\340-%\362M\327\335\205\n\030\030}-!\243\017\022g\364\257\247\2676\r\372*S\200\203z\345\240\360H\326/@_\035\364kV\2073@d\260\214\212*\274\333\374\r\201\344\373n\265\324\215\241_P$\336Rnk+\253y\002\033\357p\275Vrm\013W\363\253\374\203X\027\207]\366`\367[\303@t\023\207U~1\363\217wb[\274\036\376xn8\316\006$\207\265\233\b\351\242\204k\230_\235@\365\253\263\374*?\037T\306T\342\005OB|p"
+	.string	"A\353\2439x\300\205\324\340\361\303\307\001C.\340\021$\210\006;\200x\f\201`\b\016\036\026`\360\003\002!\314\036=\200\f\321\300E\217\036I\txH\300\203\007\001\023\\\340\203\202!@\200\374\020\"\304;B\354\b\"\265\243\207\324\005> \370!\265#\210\020\251\020E\f\004\003\036A\244\206"
+	.string	"\001\022D\212\371\266\325_\205\213\304\361\013\334\372(\317\370*\003e\211\321c\377\207.\234m\303\306{\02732z\354/\\\221,\306\020"
+	.string	"\311\221V\332\032\021\340\273oZB\323\031\262Ya\314x/\306v(l\273\310<\361\340b\274\214\031m\264\201\250\300v\353\031\327~k\255\3263\204\236k_\031\201\377\350h}\342\305\370\0163U\\\273\233\363%,\355\005\214\006\373\027\017\343\037\321k\n\3256\376\3057`\3430C\222\365*\023\3654\2629<\001"
+	.string	"\340l\024k\260\240\032\007\216o\260o:\327\305W\333\271\3014("
+	.string	"|\225"
+	.string	">\b\215OVrO"
+	.ascii	"\337\213X\332\n\261\232\334\n\032\f\355\273\311\305\372\n\236"
+	.ascii	"\335k\032}=nO;XRvi\024\251\326)\233\026|\355\314\302\242\235"
+	.ascii	"<\267'\374\t\370\257\272\266\366\312\3117_'p=\242\307\242E\236"
+	.ascii	"\304\026\337K\246u\326\356|\214L5\321\352\352\371\357<\33706"
+	.ascii	"\250p\0137\327\271\215\364<i\342\003n\365,\236\371y}\302yK\257"
+	.ascii	"\370\021\0338\252\363\214\263:S\363t\236\"P\025\036\262(dl\222"
+	.ascii	"\320\352\025\230\0166\336y1ys[\221\242\225|U\027Y\033\n\3769"
+	.ascii	"\\\367q^\016c\233\315\210n#\r\370\257\025\037\004NV\340\212\347"
+	.ascii	"`:\270\326\246\342\253\177\\g\242\245\202\357\307\330\206kd\037"
+	.ascii	"\335\023O\311\267\264\211[\345\272\250)\b\370\356\353(3i\274"
+	.ascii	"<\331\334 \030\024T\316v\023\316n\276\356$]d]\252\234\355'T\274"
+	.ascii	"y\362\2618\333K\361*\336B\236\036\347\265I\361\256\233) Q\030"
+	.ascii	"(z&\232\032\313E\361N\002\036\212_AXu\342#x\273,6'\356L\375\032"
+	.ascii	"\333\352\250\366\332yH\242\217<\267OE_\343\277j|\223\320\335"
+	.ascii	"\235\315f\035Kt\215\357#_\341*\305:\t\023O7\207T\2024\261\352"
+	.ascii	"M<\343\264\037p\251\276\352\273\213Z\342\251^\251\304\273zBw"
+	.ascii	"~JF\234i\022r$\364\246\276\232\346\311\327sgpS?\342\221J\270"
+	.ascii	"1\365.\336\024\256\327\242zd\222F\304W\371\247\261\\\021\337"
+	.ascii	"\203fD|O\247m\326\246RQ]L\272@u\221\277\361_H-8/\327\303\033"
+	.ascii	"\357\306X\245\3026\r\236{\032\f\333\020O9\317\306\330\246+,\363"
+	.ascii	"!<\261vO<<\257\277\302r\267\345Y\247\312\211\"\211Rc\254\325"
+	.ascii	"\331\230'\363\314\323{\356\355\025y\345]\210\255/F\240\276\312"
+	.ascii	"Q]\343\205\340\300ii\342\fr\266\203p"
+	.string	"v\357u3\351bBurv\321\177q?\005\202\334\250\022\361$S\262\220)4#\"2\222$Ic\362\n\020\006Bi\"\326\324\003\022 D5\307\263P\251\301\221\024\244\220\016\023$X\352X`f\"\211\357p\350Rz\242\377W\200\001\005\237\312>)\362s\352m\330\313\230(\325k\216\206S\364\326C\244Fx\205~\370\355\3542(f\220\325\035\001\260\223\345I\274\333\325\271\256\325y\346\217\253\354\276\342w(\203F%\017\311\271\243\261y\220l\2302\034\026\241\022\370\013\2673\203\301K\261\254d\306\363\226\353U=[\324%\315Zh\204\273<\217-$Z\214rDUY\365\311zs\314Y\234\256\243\226\263U\321\177\215\254\277\213\022@d\373 nyK\200\217k\004q\202\232\257\212\031 \241\362\373'B\005\274\013L\250th\363Y:\361\247K\373\025\235\252 \0161\324\b\320H8j\217e\206O\220\260"
+	.string	"\033c\331\211\367x\236\260\233\361^9y,\3756\206\\\"\301\240w=\354\227`g\336\253p+u\334o\234z\021\367\312\233\274\205\264\320\2219\261\020\334\300\203g\331\213@<\314{b\177\262\304\347\027\027\006\334j\276C\2165U\022\024\034\275|\230oF*\301\315\bV]\213\317\360\210\326\302\236e\301$\352\261lv\331=\350\235s+\266\213\261\325P\303\233,<@X\217\0201\300\254%\334\336OY\204\001\225\257\312\001\236b\325\227\250e\023\232\243\027.1\314 =e\222\221\352\n)\226 \r\214\313\030\356\272\024SM{\3560\201\225$\337\241\345U\006\013%yl\331rv\310#\217\020\003)\316\222;;\321\323\322\240.U.IU\254\274\340\340\002\211\363"
+	.string	"\302r\215*Wj\230\200\236\275c\036=F\300Yga\030B|L\032\325[\361\250k\327\236/= \204\303&r\242t\027\177K\317\245\201\\\rO\251\374u\n\001\211\025\036\331]:\304\226n\327R\250\346o\225s}\244\257m8\344\177n2\351'\224\201)\230v\230\357\335=\322\024\261\310\305\255R\340\224\242V\301\372)\225\364\337d\037\260\321Uvw\013,\033\241v\031\013<\361\372[D\312\301!FE\215n\270dj\234\037\321\272\314\026\211Q\361\201x\002\335xpB\257^!\233(K\252f\224\210%O\252\333\250a.K\233R\237;o"
+	.string	"\240\013\341$\247\n\2650(Z\021G\270wL\341\260\317QF\202e\204\340\203.\250\332\230\225\311\357a\300\317\243\374\353\203\301l\331g#\253Kx56\360\320\257U\315|\241\356<\346\260#\333\347Z\265\246\316F\032\016+XWi\254\2514\263@\003^\025^\303#\200\341/\200\b\360\nu\313\020\305h\337\253D\204\241\302\300O:\220G+\346$\225p\245\346\2137\263.\330\261uy\327\325\353\220a\005V@^\027\335gX\341xq\221\271\276)\207\371\305ZK\325\034OD\365C\235E\357l\354\fV\366'\020\0277'\024\234?x\272E\273\003\233@\330F\250\275\337HL\275(\212R"
+	.string	"`\360\326\267\3310h\313\302b\37680\361\210\340\203!6+\343\250b\222\034\267\260\212\256"
+	.ascii	"\025H\027\345!O\246\243\372\260D\214\205\267d@\337 \r\265\027"
+	.ascii	"\031\034"
+	.string	"\3637e\352\022\323\336{\2726\200O\250\266\236FKM\026A\252F\365V\260a\372\310\177;\220\313\361\326\004;\202\023\330F \231bhoT\206\361\306\315$\323S\"NVW\036\035\230\342\330\340\266s8\361\332w\265P\301\223\310|\357(\224lT^06\206R\037*\363\2505\234\2067T\240\b\3646\264\031\343\312q\003R\305\247\t\272\204\353\005\303{\023\331\254d\375\267\252\247\321|Y\016m\235\370.\033\005@\302\205M\235\304B\t,\t\031h\027\232$qu\006\264%\247\221\215\334\355s+\357\034\305\353\351\324~o\fj\314\371\020\nU\205\351\003\303#\202\245\371=\313v#\307\222\361\233\246\274F\201\022\021i\267\031\372a\302\306\314\fd\347\020\031\336\301\001\355\262\002b:P\376\332\246 \346\223\235\202C\203\013\275: \006\3542"
+	.string	"\225"
+	.string	"\2663\257\247\257\317\226\025\365\006\2266\235\217\030\377\230\230\253\027eZ>L\244\201\n~VU\234\371R#Rrl\251\022$\256JiT\201G\r\255\365\363\035\267\265A1\305\227!\360\264\024\326g\320a\357v_\031\332?\nG\251\031w\020\325\300;t\332\2572\212\216\254\001V\214"
+	.ascii	"\370W\215\345m\331)4\"\b\316=x\312&\037\304\204\026\327i_`-\376"
+	.ascii	"\r\206\336\262\207Y\264\310\221\036\241!~\355\277|\324\2741\270"
+	.ascii	"n\252]\241\274\246\321\355\356-_\231\352\376\213\302\256\")-"
+	.ascii	"E\255Y/\322\250t\324\314\3539E\217q\301\0329\363\270\013\032"
+	.ascii	"\310\326>f\245\024-\206\256\021\215\205\r\037e\321\267\270\216"
+	.ascii	"\344\233\206*h\340\267t\274\262\nzh\243\217\344\311\325\266>"
+	.ascii	"\243\276x4\371E\376\266\370\342I\031,U^/\362\332\341\230N\td"
+	.ascii	"\266\30773d\232W\032\002\224[\3774\031\351E\2342\315\033/\242"
+	.ascii	"\353\304[\026D\262(7\3107\373\210\361\b\241\005"
+	.text
+	.section	.gnu.lto_processRcCommand.112.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\326\t\0056"
+	.string	"\n]\\\024BP\346Q\007\257/\337u\355\245\2445\240&\266\307\033\200o}3L\317\033i\374\f\260\245~\t\231\326<0\347\346\347\003DD\004a\030&z\nk\204\205\007\026\357\254\331\363\007v\020F\266&\367N)\2452\001\026\001>\001l\234\352f\245\313t\237\351F\353~v\312\254\306m\246\321p\360\fC\313\310\300X\360\225\311\201Gv\346\201\257Un\263^\323\321j\374S\266\305\201\225\261,\033$\303\235\206\306\320f\275X\227\033#Sr\267\300\327e\334cZL\237\255\375\3447'\255'\253\004\242-\343\312\240Z\345\003\276V\235\232x[M[\351\266\312\254\2039\330\252\007ye\356\323O';"
+	.string	"K\336\226\032!\226e\245>\n\177\247\317\346\241\257M\\RJB\032\036\t\215\212\202\300\237\257\330\273j\372\276r\367.\374\222Jc\023\251\364R\226\2561W\312\3225\305\223\2448R:\024K\247\306,}\b\305\313\331GKZ\270$\r\314\215\276\272(}\002\203#\322u\272\224\244D9'v\275\366\345A\003\300n\342\225\244\177\351\003h\030\242\256\323\205$\025^\241\3236\032\246\373\372\350\354b\235.*\006\262tU\361\336\221\276A%\322\325\364\351N\215 \241r+%rUI\362\360\224H\277P\251\225:\261,\333a\332\177([\367\336\005\226e\331\223J\257f"
+	.ascii	"\315\334Q\230Y\005\263\357,\275\357\264<nG\217\206h9\f\365\261"
+	.ascii	",;\201;N\303\201\340\036k\225EPQ\335V\357"
+	.string	"wZ\253eL\266<\267\367}\223\273\370O\3247\3527\251\275\351\025=}f\022%\274\223\354\244\365F\376O\277\267\022\365[\2671q\002\005\212\333\352?\004f\332\227\245\200\273.p\256\177sA\033:s\225\225w\322\177FX\373\306f6f^\234*\264\373\231\200\234\311\005\232K\277\3317\256\232\0252\226\211\274\3405\313\262\354\177\223o\334\376\024hz\264\274\020s\247\351\266\033\334c\334\342\205w\362\305m\265\377\225lv`f\313\243G\231\237\255\177\223\271\235eY#\377\023\346\b\215\326<\325e\232\243\240\236\256s\202\324\031A\237in\352g3\323u\006\220:\027\337\231\370s^\002:+\375\234\223\2563\322u\036\252\316G\251\263\320\347l\324s.\272\316\301\353\f\274\316\277w\366]\347\336u\276\357\254\252\316i\352\374\357\354\357\334\022\232\006\265siX\n=\335\223\345\212\036\nL\273\274e\002\327b\350"
+	.string	"\247\267M\252Nk\021s_lI@F\303\237z"
+	.string	"\317\216\304k\021yq\022*\372&\337.x\200O\3000\262\262-\350\017\352\233\376\0073\363\324Z\373\322\210\026\346\232\2719\217\364\215\004t\364\303O\323 \357\204\177\344F\023\016\347\3445\212\263\253\230\204\250\212u\212\2679\307\260n\253\302w81\267\343\241F\204Ee\265b\345\266j\364\235\326\036\2740\355\276,\360\250oz\246\347\242\237z'\344\033\231;\257\013\315 [\267\254[n\253E\217\203\211'o\0315\210\241\t\234\202\272\2001\357\344-\243\376\225\254A\022j\302ch\201@_\250z\311\264\223\267\f\006\277\367O\177\302\004\351\270X\0345?@\340\367\036\352S5$\234\266O\373a\350j\306m\334v[\005~\263a\316\3416O\300x\375\276\311\336\374v\231\276\321\264\217\001\351#\027h.Oo\017C\007\324\351Ij\231\320_\035C\t\324\321\201X\317\250\322\267\373\275\377\275"
+	.string	"'L6\344\225\326\243\354\373;7\0068\347\332\016\206\f\0324 J\002\352\375}\337_>[n\255\034\235\216\343\320\341\303\207\333j\354\302\001\r\0275\252\256\244b`]]aY\005"
+	.ascii	"\322H\201\201\205\212\030UWWX\031\254\262\214V\324\250\032\261"
+	.ascii	"\002F\213\030U?\032/lT\245l\345\300*K\312\212\205T\214\027UW"
+	.ascii	"RVY4\244\034(1\226\214\025YR5\260\260\262\244\202\317c{\377\223"
+	.ascii	"\rfqyw\307o\271\323x\222\021LA\204\360\216\0365\304\200\356\215"
+	.ascii	"\210\301\231wDWc\327\321\205\211k\337\310\367P\020AK\013.\202"
+	.ascii	"\016\002\005-\317\263\027\334\342#x\366\255e\353EL\264(\212\337"
+	.ascii	"tb\313\243G]\351\233\304w@\024\274\330\353\326e^}\254?\274\223"
+	.ascii	"\304\357\2630\2557&\255\\w\351\263\202x\327\312\345cY-\t\354"
+	.ascii	"B\234kU\016Y\213\024\271\255.}\207i\005\177\332\356\300\314\304"
+	.ascii	" }\223\215\364\034ExUJ\021\252\231\242\232\351]\fZ\247\303\006"
+	.ascii	"\315\364\021\276\307\264\n\307\\k\351\326\300Z\217\372\221\322"
+	.ascii	"\003Y\217T\250\363\244\377X\231I\326\257\257\251W\332\240\204"
+	.ascii	"i\207F\2676\347\350\321>\262\271\351!\374&\237@\026\001\370^"
+	.ascii	"\353_\330\2338<\320 \322'\360\365\272\344&\345q\244o\255K\230"
+	.ascii	"\254N\234\334V\223\276\273\002\200\314\250Q$E\021TdFFDdF\232"
+	.ascii	"\2441\220\002\021\261\252j\003\020H\307\246$I\007_4\301\303\250"
+	.ascii	"\306\234?\324\304o\267\341\2257\201m#|r\331b\034\251]\036\b\221"
+	.ascii	"\315\013\027B\f}\3153\374\204\357\243L\261U\222\367\217\344\321"
+	.ascii	"\303\024\230)E\006QN\347\263\0061\277r\036\235@Q\\\233\351R\252"
+	.ascii	"\321\272eV\031\261\204\007\332\335\313-\203\230\272'\221e\001"
+	.ascii	"\344hW=\032\277\201E\026\347-\366:\b}\313\353\335\036\264?\265"
+	.ascii	"\020\225\260\224\211b\007v\303\267\367\220 `u[d&bL\026\277X`"
+	.ascii	"\260\222d\021\221\305C\344\352!\016cu;5\302\362&\356\025\361"
+	.ascii	"\323\006e\033a6\325\245\263\225\241\317\264A\033C6\216\006Py"
+	.ascii	"-\336\262\265\326\016%\340\324\024\230\035\367\313\2107\304\231"
+	.ascii	"\004\250\332\270fs~\336:P\021\243]W^\336\247W\025\341\007\311"
+	.ascii	"\3413\344\363\322\3727\213\034\3001\300\0229\237\0011\033d\340"
+	.ascii	"3]\254_\214\232\004V\017\r\230\240\240\220C\303>4\303\207>\016"
+	.ascii	"\365\220\037\373\037\361r\246\2532\035\t\253 \344\024X\256;\273"
+	.ascii	"\266.\267`\213\223\315>\025T\347\307\223Xx\273\0220\326S\250"
+	.ascii	"\231:\n\013\007%\215A*-g\344vO\242\t2\324\323\335\013\034\200"
+	.ascii	"\324_\3137\266b\301\302%n*\350\t\214\277\265DN\246o\002:\036"
+	.ascii	"\270YPo\243\261\303\214%>g!\336\224\nq\312\361\334-\n\341\211"
+	.ascii	"\321(\212\3731yt\206\230\273\376VN\301K\276\274\255\367\007"
+	.text
+	.section	.gnu.lto_updateRcCommands.113.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\377\030Um"
+	.string	"j\265\\'J \226Z\031\016\376*\201\035\354aI\"\320\324\027\006\336s[\013\201O\352\330\343S5\214F\350E\243\311\302\251h4\321\022x*\345b\205\017\244\367\200\035\254\3549\247\f]t\030\001Q\021\005U\265\"\222\330\2757\331[\312$\003U\0021\002j\0022N\336\030)\257S\312\013C\310\333\364\303\313\324\303\273\364\303\373\302\207W\311\207\327E\312\233\344\303\213\344\303\333\"\345e\221\362\036\235\274F)o\021\312K\204\362\016\245\274B'oP\017/\320\311;<y\177N^\237\036\336\236\223W\230\362\362\by\323\223\027MyO!o\220\207\327<y\313\224\267Q^>y\377+I^\212k\340\270\370u\236\233:%\360OEc\332m9\334\203\374'~\274\377\356\267\373\353\376/?\362\351\356W\b\205\0267'JuN-\311~@\303V\204\230;\027h`#D\035\337"
+	.string	"L\354\303\254\320n\223LX@\252VV\0340:P0\273\302\272}\022\271IF\363\307%p\357\266\247\373\262wW\273\324C\351\343\362\307g\003U\002\t\317KUU/\237\333\025n\223\273mOq\307\246\311\356\337\016\267\217[!\022\304\027\356\266'\020b\312\302\330TU}a\217\304\no\276\360#b\350"
+	.ascii	"\313\f\364&\372\266\025\236\355]\210G\316\300\204\345\246r\235"
+	.ascii	"d>\240a\263qsa\2407\231^\024\274Y~(xs"
+	.string	"\211\273q\356v\246\272\340\322\227\025\327\247\252*T\367\260\375\322\355;d\342\237f\310\210\341\004\243\211i\351\205\222\213$\244\026,\216\214\212\210\206\204\202\200\206?>=B\236\024=\203f\331L\334\237<J\262\"\2520rY\375)\371\031\311:\226\221\244\343\030NC\262-N\260\371\215u}9\f%\270i\211$\230\251d\032\363&5[\3119^z\241\204\354\302.\332\236\324\226\266e\004#\261\255q\21365f\321V\004\037m\271QY\203\217\t;W\263\265\245,\232\242\305\250\205\213\210\262|\250\254\021F\346\206\253\331\302R\026\245!\223\342sYX\350\207\007\371\320v\205\201J\240\263RG\221\207V\272\304\376\023v\237\260\222)\371\246\264-0\356\0216\215u}\235\347\370\305\351\016G\325l\355P2\245my\3619\326E\345A\036\256\034n\376p\255%\223\252\252B\256'\\\226?hg\212?\\Ye"
+	.string	"\311*\200O\236\265\270\260\270Ow\223L\f\r\233\337X\227\330\371\344\241\252\352\262\221\253\353K\343\273\214\267\273Fv\215\334\002\251P\254\205dW\2226\272\300h@\205<-l\336K\233\207\250\366:t\322/j+\246l\255\353l\263\r2!Wn\322\311H\216\t-\346\313\372\203\326\332\375\240\247\330\344\321\231\234\363\021\215 v!\266\021\333\2027a8zQ\363\n\242e-$;\303[\321\212\277aOM\025\346\2514\332\037{#s6\332\274\027\354\363\201\357\371\320\273\024?$"
+	.ascii	"\002$x3\330O;\302\371!\371\312\23089e\233-\177\205\240\331So"
+	.ascii	"p\260\330\212-\322f?\371\013\336\316\274$o\305\na\251\352\225"
+	.ascii	"\323\277\372T\372`\316d\350V:?\366\277:H\231\265\257\354\367"
+	.ascii	"\217\335@\235\025\255\310\201\333]6\020\272\225\217\273\373Y"
+	.ascii	"w*x^\020TU\261v\354\243x\033\f\204\f\031\022\274\311]\212y\203"
+	.ascii	"\274\342\300\252/_\263ITU\325\003\366i\256\206\203}\226\233K"
+	.ascii	"\244H\221\340\315\367\303\334\344\342!\371\027\326\305\256UU"
+	.ascii	"\265\3526[\024\202\37327\203\302>\313\202p\204o\274\271?\022"
+	.ascii	"\274ir%\335\204\261\321\271\342\300"
+	.string	"]\267\"\267\331\356\257v\331\356\317\254\224\221\241\274\037\253r\26100*_\267\373\376\b\304\373)R~\367}\224\303}\017e\310\373\254\343}\277\246\274\267\372\023\337\253)\257\f)\257\223&T)/\223#\277SC\336\026R\336%(\257T\312\253$\345\215ByWHyKHyEHy\221\234\274!\034\371=r\344\327\310\353\276 \274\356\373\301\277|\213\234\274\036\240\274DN\336\016N^\016N\336\rN\336!'\257\006(\257\220\2237\203\224\027\203\224\367\202!o\220\224\327\202!o\005@\274\024\244\274@P\336\tR^\t\206\274\021\234\274?N^\bN^\037)o\217\224\367\201!/\217\224\327\201!o\003@\274\f\244\274\013\240\274\n\244\274\t\fy\0218y\0178y\r\350\341\335q\362\026\220\362\022\220\362\0160\344\025 \345\r`\310\253\003\210\027*\345\315\201\362\342Hyo\fym\234\2745N^"
+	.ascii	"zxi\by\237zxg\364\360\006-f4\257\031`\003\021\007\276qF\233`"
+	.ascii	"\364t8\2136\333\267\375R\344\360\342\0305\351-\213\214\364\221"
+	.ascii	"\326\222\301P.\243?\247\247C\214>\333\344\260\207\033\347\200"
+	.ascii	"u\2149G6oyr|`U\302\372k\230\225~\225.\313d\335a\322\267\322/"
+	.ascii	"\342\3265\031:\252\231\364\031\267\246)\351%\035\325HuV4%\255"
+	.ascii	"\024\227u\247\205^R%\205\315\312Z\350\323\275\261\273\361Ci'"
+	.ascii	"\215D\267\206I\351#-C\233wk\030\221\212\224\016\322\255i\305"
+	.ascii	"\254\376\224\303\355\316\020\207y \352\200\262\030W!\356\360"
+	.ascii	"E\004\003\013\336|V\237H\234Q\263\003\373\221>\224~\334e\244"
+	.ascii	"\231)\346\311\255\0259\360h\3318u\223\376\336\272f\244a\264S"
+	.ascii	"s\2315\255\251a\364\305\230\212\017\"\262\251q05\273\201\003"
+	.ascii	"\210\246\330VFxV\210\246\372G\356\356N\020U\033i\255\245&\201"
+	.ascii	"\007\336\201H\004{\365 \222=I\360\346R/]A\342\340]b\017\304+"
+	.ascii	"|\343\213\327 \207\007\306\217\257X\324fK\244\315P\ti\025<75"
+	.ascii	"I!\245\236\352\357\271h\244V\352so]Kj\027}\256\341I\315boE\243"
+	.ascii	"\021l\321H\035\254\263\246\261\350\026E}\253f\321\177\3072\305"
+	.ascii	"<9\264\"Q\233\325\360\243.\241\023\300\"g\2453\324f{4w\366\302"
+	.ascii	"A\n\2570k\314\030\365\321\r6\030\365\322\033;\242.\352\003ba"
+	.ascii	".\336\"\352Cq$\343\207\024r\342\205\244\251\370\210\367\266"
+	.string	"F.\354t#B#\351\345\325\316\020\214P\213\320W\342\345\032\0267@\364 \027\324B}\300\325\314\025\007\346`-6\006u\325\021o\203\374\016\324$\274\301\001\200\231\324\023\267\004w\211@\020\271\360\215@\375\266\007\315\301\031\203\006\253\255\200\332lS8??\353\206\3036^\244\265p\330y\251\336x\221\376Y\237\356C\336\304\362\326\260\"\007\362\317\220\327'?=\354\006\\\347pq\223(_\3754\241fw\345\246\252\252O\233\365\021M\004\366\264\3312OY\272\226n\362*\207\340\363\277\337\001\344\357]\360f\357\031\347\204\320 \264O\013\255\271\"gM+r`)l3\346\351\262\r\206\031\342\f\023\206^\254Ah\255\243\020\354i\326\"\304\373\210DT\321\323\247s\254\363\013\233B\016&)P\215\020\005\245D**J*\t\322\224\t,\214\220d\210\t,PQIM\245@\365\343\004\t3Q\301\311\b\245"
+	.ascii	"K\242\250\312%QT\275Ir$\231\202Jr\002\224\022\025F\210\202J2"
+	.ascii	"\305\004*\307\320J-1a\n\212JJj\nJ\350v\365\253]\006%\016\030"
+	.ascii	"\232\253.>y\320\335\265\311#\256(\326\364\224M\242-\305\203\376"
+	.ascii	"\020_q~\310\031RH\276\023i)\031c\350\034"
+	.ascii	"\226s\"\375\261\256\201H\037\371\025\247\346\325\001\2166\322"
+	.ascii	"p\027Eg\255\035\364\323\276\340\374\220\034tcm\262\350\254\213"
+	.ascii	"m\265I\264U\016\372h_pjH!|2|\247J\017U\325\253\033\001\267\352"
+	.string	"LU\032\276q?\247\027\030\303o\223J}w\372\372\2568P\207\252\252N\033\254a;\233T\252\303T\314\331\240\217v\004\004RU\025\306\320\243\264\001R\207\336\224\346's:\002O\357\355M\237lH\024\034g\017\007\353\301\031\322\367:\376\371\331i\220\307nv,\267\341\274\2527L\252\364\364\350\214s\256n0\2335\032\364\307\334\364:\376\251\331]1=\005W@\325\270\375)(\244W\350\345,\257\"\233\3413U{r\252\246\340\033\253\246\b\336\024\302G;Ox]-e@f\f\006\235\301\005\r\2441\b\322\027X\320W\203T\320\026P\320\025\360\332)\230\240\2018\2017\001\035\t\324\bZ\202\037\035\001\004\375#\214\035\004=L\203W\305\017\f\024r^\370\250\243\353\321>\036\350\005\272\007\217~\300\201\376\312\243\201v\200\201n\340ts$A\006\024\350\005\222\230S N\002+\002\235\300\001\215\200\001}"
+	.string	"\334\233\001=L#\206/\254\213\335\231\357\313\360\021UT\034q\342\345\235\343^\037\035\223L\357Mi\007\003\361\035BszB\270("
+	.string	"\271I\245.\004t\001]\356\255|\003t\216&\240O\2725L\200\036\340\007\007\320\217RE\225\037\337(\200\216\016\240\3172P\255c\b\346H\202P\235t\267\242\025;\007\253\025\201\243ow\314\363C\366`\216\362\033\275[\005X\025\030\245\231\236\264\325\332\350\0335\332\206\031\","
+	.ascii	"\272F\267\240[\321\212Al\022\345\002@_"
+	.string	"\314\315\277c\236\232]#\327+\222h\300q\200\213N,>!f\361\2154\232\347\364\276x\274\340=Aj\263\365\021|\352\251\2677Xl\005\r\254%\013\377@\324\212B\2342%x\363\251e8\266QC\006\201\361\250a@\005\221R\204DDDD\222$IcA\005\304 \350\2403\333\021\340\250S\216)\032\031i\nY6\003\301MT:\026<uB\304\322\312\203\017\240\314\373?%-7.\211'o\353\347\353\2427<\342C\220\346\n\216!x\344\016\035\357v\327x\306\270\372\263 Q$\367T\326\007P$\332\306#VZ\272\032\n\244\305V1\237\212\224\306\263O\031\227\352n\343\"\206}\216\b\272x\375\307\177~\254\300\033\342\254\333\006Eo\331\206\215\031\332\006~F*\177\017ikQ1\302\252\303\372xG\333\220\353'\201S\227Q\235\333\262Xk6\034\200\345\023\306'\265\326\364{\016\016`4\357\251"
+	.ascii	"317\333\245\304\306\230\027#x\273{\243+\005J\356g\21375\004\223"
+	.ascii	"\327\035\304"
+	.string	"\343\206_8\365\342\321}6%\003\254\356\271\273g\024\3728\343\244\243=\021dW\316\304\356\346\021\002\263\003\300\362D(\252K6\341M\025\220c\360\024\232\035\"\256\311\004u\205\216|\274\034\250\255f\321\004\203c\300\222\344P\252H\337D\254Z'wn\240\375\024\331CX\377\210|1i\326*\274\200T~\025\237\"\341\321\t\353\371\241\203\372\363\240\267-\3367\307Y\353O\0348Y\302;\277\223\024\347r3\224h?\346m&9tV\331\312i\220\310k;\347\351\\\207\264\035V\3604\260\305p\272\0052w-n\204\257G\334(\203|\242\302\203\005\273\0252\275\204\312P\204\374{$\301\004\331\206\303\bWt\244\314D*=AB)F2}?\243\260$\347p\305S\337\200\303\232G~\224\306h0\335\254\267\311z\200\245\035P\374\\\327Nq\357\306\363\342iG-\f2\277\344[\007\n\260\205\0350\360O"
+	.string	"\225\177\246\215\276\253u\\\364\224z!\370\310"
+	.string	"u\227Y\336\317\252\261O\367\2227&\217\3272\343\307'\356q\276\224\021\034\351\342\220ej\227\216m\217\001\370"
+	.string	"\211|\r\3466\3267\030\031\2253\333oV_\200eP\017\247Z\020\201g\352\tcm\266\336\200\250\347"
+	.ascii	"\275\217q\337\226\270\025\217\t\333\020\314\017S\307\220\031"
+	.ascii	"\027\237-;a\214=\307\357\202o\344^_\365\304r\267\rG\006\f\330"
+	.ascii	"\207\363q\027I\346\003\365\254\342\355\230p\363\211\341\370\263"
+	.ascii	"\367B\341\"\245a|\023\r0\005\345T\252I\263;\211r@\337\352\230"
+	.ascii	"\212RW\305B\245\330\320Nk\211pb\242\f\331m3?6\332\363vSE\274"
+	.ascii	"`\212\320\004\307mK\207\0249<\360\272\004\005I\306\272\362\353"
+	.ascii	"\206\tE#\336q\320U\264\353\257\017n`\261H\315\354\361\373\253"
+	.ascii	"\t"
+	.string	"\344\312\216\007\226_\335\305\350,w\356\276\034\374*K\370\257\317\325\217\367\212f\004\221\007\265\364\203\227\337\345\275\016Kb\335\242\023\006\002\300\036<e\027P\036:\3212G\246\252\331$\036S\037\235\330\351\277\263\223\231\327t\202qJ\330\211\375\304\231>\313\361\351\256\233\007\236\311\357\367=\032|\314;\253K\001\023\375\243SK\352)d\266#v\243\017\264M)\206Q0\216\\eu\254\352\305\354\024\304\306.\021\354\344\301h\226\"\231b\202#\334+=\346\030\366\244)~\016\234\264\237\t\300y1\263\004\272}\202JL\241\300\377\233\353\252\227\217*[F\211V9\br\267N\215\025l\2033\337\364\037\221\274q\037\001@\232\341\310j\202\223\"\257\304\031\340\317>+i\324\3102t\2204\352\247\360\251\267\320\214-/\330\352vt&\002N$\214\261\031'\275\235\250\016\224\220S\3230[b\036\353.j<9\341\333"
+	.ascii	"\350*\345\275\361),\226\251"
+	.text
+	.section	.gnu.lto_resetYawAxis.114.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\245\007"
+	.string	"B\31635Po3\006 \206\263\022\222\243x\312m\3028_\2036\302\353\307\326\310\307\bF\333)\207\365\007\033\322\034\013\360\314\354ETLsG\2617&'\306\312-eJ\001\2752W6\257\207)\001\321\0201\257L33\005\305&\034\262I\201a\331\264\272\233z\004\005\230D%O\304\030\3253pAq\212\246b\263\251,\031>\244\317k\0131%\356\352\021\204\376'\324&>\261\250A,{\301\201\336,kNe\t\335\225\312r\341C\032\371<\360\324v\035\030=ZS\377\337\bj\251\201\026\r\316\"\357\3378\275\274$UB\332\332\252\326\232\334\205~ \322\2211\372\376\317\370a\315P\253Mb\201\215\353\030\002(\374/\3348\0167\272-\246-B[\226\r"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"v\031\3772.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_isMotorsReversed.115.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 \340=\006"
+	.string	"\242K+2PO\222\016 ;M\020q\265\350\262\206\200\230&\036\207\307\276\265\327\347\262\326n\255\241q\3639\002Z\231\231\243D\213{V\350\363\250~\017tc{\313\024K\027\211j\022D\233\210p\220h\022U\321.\005O\024\017T\263\230&\252EX\026=\207\007\033\344|KjR\335\317\027\230\253U\350b\002\n\035\016ll.{Ls\330\361\005H\364\374\367!\301\312\347\252H\226\331\311ZR\005J\001\3713\037\255\260\220\271*\366\3211\b\341\3008a\311\304\032z\264\352U\267$m\340\214\240X\227\246'\300\220\231\237uit\354\237\360#\374\031\001\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.116.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\363\b\335."
+	.string	"JU<\022B`\250M:\2534A\fjB\004\004\200\210\370\347\bz\251C\371g\257\017\264\321\237\254\265\035\263\206\312\\':\310\205\235\277g\347\227\335v\345\345\260\031%\306X\206\216\220I1\326\326\266\021B6\221;\311\021\001\371"
+	.ascii	"\032\001`\347\342\347\336\037\313F\027\217eS\345_\3761\177\332"
+	.ascii	"\217\274\311\254\306\007s2a.&\37017~\213\367]f\307-\r\322[\244"
+	.ascii	"\352\340A\360_p\374\022\357\r'G.\205\356E\003\246\267\314G\343"
+	.ascii	"{a\336m\032\257\275\035\265,Ho\3773\346\361\315\336%xd\216\337"
+	.ascii	"\260\373\035\215\216\215\n\335{\023\334r\201\364v\300\231\316"
+	.ascii	"[\363J\347-\007\231\t\035-\312}:J\371\002\363v\357\0056\024\356"
+	.ascii	"\335D;\2475\370\243\237\257\307\333\351R\364\264f\327 \277\352"
+	.ascii	"lY\004\353\372\321\333o\220\357O/B\035+\274\263\247{\216q\f1"
+	.ascii	"\tS\362]\022$G\316\004\310\330\331\353\203\305\b\023`\002\304"
+	.ascii	"\210\325\231\246\"Fg\327\003\244\2109\2418L\273\027aM\237\204"
+	.ascii	"\211\035%\362\363\007\366E\254V\310M3*I\235 ?0\035\346U\236&"
+	.ascii	"\203N\346\265\007\330\260\366\275<\304Q\213!&ab\257h\205{/\327"
+	.ascii	"\"X\330\031\351\314\317b\346,\3464\030d\016BX\226\346k\256\343"
+	.ascii	"\250q\262\2439\205S\202\321\364\0314=\033ms\315\366i\342n\332"
+	.ascii	"\330~"
+	.string	"\23518[\220f\363\325|\r\247\341O\341\023\214\206\321(*\036\352\3464\217\273\314I\303{\275\252\314>\221LX\227\\\273\273\345\210\205\336\265\3775\307Z?\263\225\336;\204\300/s3(\370SnY\005\213\372\342-\237\305y\373\376\233\2617pH\257\272dF\023\32662\377@\025:\213\270\2350G\370\227\363\203\2179g\035yv`\340_\316WO;[\235\225\253v\225\013\230\225\t\244\225\007\350*\013@+\007@+S\241\225\247le)[9\312V\206\262\225\237le'[\271\311Vf\262\225\227le%[9\311\254\f\300VFB+\037\241\225\177he\237Y\271\227V\346\241\225whe\335Y9=+\243\266\362iV\266ge\363\254\334\266r5+_\202o9(\254\340V\035\241\357\345\035\324\312\00443\007\263<\220\206\251?\367^\t\374?\007\264\201C\207\372b\207\363\266\335\212\207\002\264"
+	.string	"\364\317c\234T\035\240\225\204fb\246\372\250\251\372R=\325Or_sQ-\325\022\330\210\\\240\032\251\243\032\312\215x\345\251\225\032\252\005\254\021\22385S?5\020\f\221KS7\265\223\201nj\240\333\327\334R'5S/XCj\244^j\006g\210W\222x\355T\352("
+	.string	"\235\344\341m"
+	.string	"\372I@\310\254Fj(\267\257\2718\367\365Qo\265\225-+\332\306\247\265\231\t:\333\t\037\205Q\2421\037\364R\030%\225\376q\234W\335\343\316\225ju\2065\316\266\261y\317q\234\017\032m+\363C$\023\326!\203\374 1\333\3107\316\254\3564\266\244\232\235a\215\343_gu\225\363\365\256\177m\362!\222\365\332\007\342vp\244\367^\b|\266\025\"\322)\\\347m\257u\310\3179\035\256\021$H\234\267\274\246"
+	.string	"Hl\367\030\247\256w}\342\025\253\326\365\0030\\\320\350\033gq\0244\264>\324\320\"aC\313\305\216\267\030l\311"
+	.string	"n\245"
+	.ascii	"\276`\241\345\002\270%c\006\220\201\022s\301@!\003H\203\213K"
+	.ascii	"\006\220\207\346\005\367\344\022\217W\013\031\253:h\346\240\225"
+	.ascii	" \226\372\"c%\031\341\031v\027W\265\203\276\034\321\316U\345"
+	.ascii	"4\277\265r\201\256\352\001\304\356\342\037\005\372acs[\340\216"
+	.ascii	"\216>\224\214\216\225\244\363\333\302\003\t\347\355X\3116\276"
+	.ascii	"2\242R\321\261\222e\275.\302.p\016\035+\211\205\327F>\263\340"
+	.ascii	"\024\345^\257\027\371\313z[\\\300\200Ah\246,\016)t.1<]U\216\321"
+	.ascii	"\344\033\237]\033\033\361\345L78~\\\003Z\304WV6D\374DL(\375\251"
+	.ascii	"\316[9dw\311E`\210\231\tI\365\211so\327\223|\311=\232!\273\367"
+	.ascii	"\"\340-!\3269f\316\360d\020I\300m@\377\354\366\310\030\0378\261"
+	.ascii	"7]\033\031\r\204F\350\016T\023\334\252{\260\325\225!\2666\265"
+	.string	"@\303\032w3m#\237\314\377#\214\222\320\331k6\355U\033\350\036\034\200\245\2501<\346\214RF\221\022\221`$I\232\306\260\002\221)*z\021 -t\314\324\320\244\324\0061\203a\262\311U\324R6\020\354[\003n\301@\272\276\237\265C$\316\275\335\2633\263\231\332J\271\333&KK\211\2232YZ\"D(\b\200\370\255\007\241\321\307\227\244\304\345\0371\232\305\f\367%\221\234?n\223>a\223\224'O\023\250.\224H\030W\332\206\\*\311\007\030\222\247g\217\004\261H:48\221\317\026Z\034\f\235W\266,\367)\022\211&w\240\356q\340\217\321\237\001\322q\b\367\326\265}\256\242\212U\260\007\302\177<\376\304\216\017\333\005C|f\253\003\277\202\356o\006x\356\201\313`\316O6|\214*\0364\027\275\226\334K\241fJG\006zz\362\314'\004/\rUu<\215\371+@\343P\313\250\201\261\337\001"
+	.string	"\363\t^\\\271y\r\314e\034`\343\334\317,\306X\343\016\330\342\246\227\242La\325\316\013\331\211C_\020(\003\237!e\207\275\312\232\214Xy\2604\350\224\372J\264\376\352\212Ia\204\331\326\205\205\344\005Sp\310j\0168\177\333\371\344"
+	.ascii	"\203\217HVU2Z\3167\211\002\320eA\323\324Q*"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.117.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"\202\214-3PO\222\016 \233\236\205\250\013\bQQ 0\362\032\021\211\202\336\n\251\217m6\351\341c\3709\002Z\231\231\243DS\241\025\372,\342W\375\246#\237\020\231\002K\033\211z\022\303{hPpx\022\025\3616\232'\210\005\352IL\023\36521\213\002\243\314\252\326=i\234\270!uS@V\253\356B\250\216\240j\236\217\035\326>\276"
+	.string	"\231\2317\217g\002\035*W?-\231\03110\311\342VD~\316g.IK8\303vQQq\034\214`X\244\274d\306w\354"
+	.string	"T\027U\003\3255\220\3022xk\322\004\317\307\305\272:e\001\b\2319\263.\215\336\372\033\374\005\377F\b"
+	.ascii	"2\003\302\260\021a\203\205P\352\032\262\205\310\305]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.118.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375 \354\205\006"
+	.string	"b\214-3@o\222\016\230\216\356v\354\003\235\270n\324 ~\251\006\362\f?\313[\242\370\177\263g]\253(`B\312\024\201\224\260\266\347\024\334h\320\334\013U\333\337[\246S\033\312j\024D\233\210p\220h\224U\3216\004W\024\017V\263\250*\253i\262,\212F\203\017j\374\027=\271\0042s\341\232\224\204qG:\235\301\271b\235.\007\240\323\341"
+	.string	"\351s\245\317<\207 \337L\242\350\277\0173\243\217\272\274d\202J1\3112\255\220\374\235\327\234\240\320\371j&\002*\030ul\240\300df\rCz\365\256\333\2226\264\244\250`!O/\200!3?,\304\321\261?\302\177\360{\004\b"
+	.string	"\003\013\330\210!\005\205"
+	.ascii	"]\303\001#\334\022\202\204;gj\347\023"
+	.text
+	.section	.gnu.lto_calcAutoSmoothingCutoff.part.0.180.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`k\002]\023"
+	.string	"6\344|G\320\360(\035\003\225\006=\023E\207\002Y\343j\022TW$\206\226&\243\306\"\315\232/e\371"
+	.string	"\251\263=l\232\b,\367\346\311\252H\312;\024\366`t4\356\032\rk7\004\324AV\031Y\023!f[V\223M\244L)a"
+	.string	"g"
+	.string	"j"
+	.string	"\2734JE\273a\202\314\207\327\331\034\316\231\327\261\221O\2736AE\273\213\340\321\003L\217\366Q\314p\266}\023?A\263\215\274\020D\356B7[\317\214\335U=\212\034\344{\364\376\361=\352\207\323\256\351\321\374\274\345\\\256\327\335+Z\341s\313qxz\334\3330\331]\233:\334\361\266\025\330\236`gP\017\377\215\017\335_L\307\230\366bZ3\235\347\371\017"
+	.string	"\244\200\207\335\231\235\322\326D\025#>\364\003=\355\373>O\341\007]g\324\220\020\213\020\213L\210\f\rL\007\232Y$&\\\021\270\037\023\231\\p!6\027\032\222v\367\300\243\031\364\334\357\231\331(\233f\243xLR2\373N\313\303\235\301\355\206$%\264\357\264X\003(\r!\301\"F]|\322O9\324\301\321\256\226c\212\261\301\300I_\243\206\264\241&]9\222\021\325D\017?\315\0275\244\3644\352\247\253\321\230\350C-J\324\254\027\354v4bv_\b\250z\372Z\016L\356\234\252\372Z\3225\365\272\257r\216`\330\226^r\227\212c\365\356\255\336\330\231\356\310t\352K\2438\016t\237b\332\0240P\326b\255R''\240L\245\365\301@Y\213\265\212\305\\)\025d \370\202"
+	.string	"\312TX\002b\022\\/\224\b\256\027\013\266\302\360\200\302\n+\200[#-\230\252u\242JAa\275T-XL5\362a\320\202\013\246\222\201 L\205\272\267z\343\353\356\221)\355P\031\333\035j\223\027\205\261\336S\305\261\355\375\254\332\030\245)\275m\351\224\034j\203\027\276\337\0024 p\002\031\333\316\001\216\302D\021)\306\3362\306\b\303>\021y\030\302\200\024\2039\b\331n\330\241\004P\361\004\2640\34455/X\034\311\342\320a\235(\fs\b\007V\0024@\304\300\274Y\373\200\206\345"
+	.ascii	"\274\366J\333\t\237\3313\350\336\300\304\276\200\030\n\363\326"
+	.ascii	"\267\005\352\265\340\340\266\273\265D38\037\203\013C\234\034"
+	.ascii	"4A\372\235~A$\026\242\226\236\200\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\317\b% "
+	.string	"\006\264\272@P\346M:\257\362T1\004\225q|\220\340\022\304Trv\362e2Kp\373_\205S\203\022$\004\251!\264\337['\326\210\252\252\252*\031\206u\001@\240\321M\205\337\004\270:}E5b\367\226)\242"
+	.string	"\243"
+	.string	"\257"
+	.ascii	"\205lT\237\220\205z\036\035\237d\346\270$\023\307#\2317\372\203"
+	.ascii	"l\234\255F?\020\215\357\231\321\277\263\267\222\361\263\030}"
+	.ascii	";\013\243_\367\342j.\372t-\036\307\242\317g\305\321T\364\347"
+	.ascii	"l\212\277\241qP\364\345,j4\246'\232\327X\023\307S\202\255\220"
+	.ascii	"`0s\004S\021\301^!\372y\026\004K1?p\227\007\3062;0\027\207\276"
+	.ascii	" {\177N\321\007\207\003\242F#\ngC\377\220\206>\240\f\375\325"
+	.ascii	"b\350\377\261\027\372~\026X\370#\363\2775\232\305\371\373g\003"
+	.ascii	"\343\037\212\242h\205>\236\375\037 -Y_\315G*\315W\274\232\265"
+	.ascii	"LiF\245\364\227]"
+	.string	"\315V\\\315\306\255\346+\255~_V\363\027Vs\225\264y\353\252y\212\261O\211\377\377Ol\325\207\304\214\366\371\272\357\310BHS\307W\325o\024\245\317\bJ\177\317B\340/O\276\346\204\221M\336\207\t\207Y\302[LV\322_d\223\274\r\311\335\314#\277cR\335\216EQ\324\312H_\221\275\313\345rY\244\217\210H\337\220\235z\2329\204\265\204p\026)\306\022\344z\200\260\230\371\203\303\362\312\264\254\371\350'\262=^\311\274\2444\202\316\360\350\353\355\350\007\274\004\347Lz\016\257\201\224\023\250\345\225\375lx\251\222\034\241\fo\316\331\316K$\311\021\352\306\364=\317y\203(\337\202\347\215Z\243\222P*T\312\317cs\034\343\224\n\325\246\265)\311\023\214d\\\bR=\347=\240\006\327\266\363\006\223\314c\353\325\327\367\234w\200\022\370\207\035\250As\013\236\027\212mP\302u\260\326\340&a\360\003\236\005/"
+	.ascii	"5\215\351\002S\346Ha\226gWc\272\007\322\340\312\227\303\372\""
+	.ascii	";\236\245\313I\264\245k \311\214\246k\f\357g\300\313*\226f1W"
+	.ascii	"\232\271\034\233\273\2105{\tk\036\263\322\f\246Js\n\326\034w"
+	.ascii	"\202S\177Oi\337\357\256^F\263\362\315\346\212\227\3110\262*u"
+	.ascii	"\242\262)F\257\216\222\365\210\312\247x\251R\276s\262$\235\256"
+	.ascii	"x\247T\026pG\016\353q\305+\245\326\025\257\324S\322I\265+\336"
+	.ascii	"`\312\214V\274\004\330\360%\376\204\312!\361\n\221\f\234\344"
+	.ascii	"\305\307D\274"
+	.string	"M)\237cvb\217#^ \222\205\212\334\320-\021\377&\347M\231\313\021/\267Q\371\201\310\300\312\314\254\314ZG3:w\033^F\246L\240\355.\254je\n\225\216v\246\224\374\333\223s\016\257\224\222\025\274\r\002\016\257pe\273\352M\372\333\260\300\336\334\326\341\206\027\0012\200\227\250a\210\203\221hFDAR\220\024\322\030\260\002\241*\342\034\021\360\230\224\206\020\tD&\206,H\017]#ve-.\244\021\312\212\002\304&\210\324\261=\241\227i6Y$:|\2121\\\334\005:\200\345\252K\316\007:\231\332\001\320_\211\257\216\n$\310-\254\352'\001\214\270\306\201\313\220:7\r\262\314\b\377\025\262';u\245\212ar!\344?y\006Lg\321\0135\266$H,\361\302\365}\277\217\347\373~\037\317\367\375>\236\357\373\365\035\230\007\204i\251\370a\001\025&ZJ\272\223\023M1\330\212\365\276\343\263\262"
+	.ascii	"\b\327@(\215\344\333\231e\245#\322@\177\031\302\002J\354\314"
+	.ascii	"\231c:kb\340\342bEI\354\b\337\210\304\200\324\001\0015\316,\356"
+	.ascii	"\224\261\006n\033<\264\"\\4\341\316P\n\366\n\231\303\217\004"
+	.ascii	"\333'P3_\205Aj\335<\275\207%\307\314\225R\2660A\032\005\025\035"
+	.ascii	"\211\331\257\343\325yD1\320T\244\310\252\037\227q\260\007J\312"
+	.ascii	"H\300\324"
+	.text
+	.section	.gnu.lto_.refs.edb0efa283525169,"e",@progbits
+	.string	"(\265/\375`\034\003\035\025"
+	.string	"\246\362\213G\320\262*\303\001\211\260\035\232\234\\T\345\344T\025\007&\246\272\301\025>D\006\303X\255H\275=\023\214\006\271\232A\256f\220\253\031\344\0261k\030\327q\034\301\266e\222\357M\0326\t\367\2635\217\316\243\363c|\373[\246r"
+	.string	"u"
+	.string	"\177"
+	.ascii	"\265}\322e\266\016\223u\327\254\267j]U\353&\332\217f\017\232"
+	.ascii	"M`t\307\007\364\3126\351\215-\240W\034\326[r\200\336\327\256"
+	.ascii	"\336\326$\035\304\352e\275\222\233\210"
+	.string	"\375%\366\225\352\305\324\253\304O\211\217Ru0|R\252\207P]\242\276\341'\3230\322\273L\337*=I\251\257L],\365T\351Q\340\227H?I\217\300\305\371\210(\004\222\275\375~\310\025\265~\016\034\264\337F\r\0323xv}\0311v\302\037\306\224\357\242\005\213\025*f_\007\205\355?1\377\022\273\377\267\353\276\3712\273\357\311\276\345\366*\271\327\351>7;n\312o\271N\013\1776\3738\373k\366\326\354\254\331W\263\003\230]\234]5{*|\324\354a\370\247\331M\341\227\346\354\243\360\347\354#\341\213f\017\315\016\302\365\342N\371\305\247\230\337\333(\3620\260\273|/\372^\005\366\222\357A\341\313\231\257\2562)\277\350:\217\367\271\360Qj\335F\373\232\330c}\330\370%%\375\265\322Ib~\325{\361\245\253b\035\005\323O\340\233^\036\324\375\264\255\333\205\265h>h\336\002\272$F\210x\365\206"
+	.string	"\261\362\355\200\303\373\336T\230\362RP\371N"
+	.ascii	"\345\265\221\320\222\027B\255\267\306\001\355\333\200A\221\237"
+	.ascii	"!BT\372A\304\037\b\370\373\360\341\321\263CG\337\271\202\336"
+	.ascii	")\023\364\336\3700!9\314\330]Dr\227\261\263\200\344,c\347I9o"
+	.ascii	"\354\273\345\273\261\247\364Oh\372\251\017\366\372\210\357E1"
+	.ascii	"\275\276\021\210\367\234\017t\331\352\005k@\336\017\0368l\300"
+	.ascii	"\321\220\341\337\027\303?y/\334X\260\371\327\177\275\021\300"
+	.ascii	"\357\203\032\260wA\221\037\"?|z\234\323\357\271\301\003\376;"
+	.ascii	"\005\300\276\016\315o\202\346q3\177\013\2776\3632\260\307\300"
+	.ascii	"\0179 \260\242;\232<\204\f\337-\032\323\304\331\027\360\365T"
+	.ascii	"\030O\344\215b\304\200\r\3157h\325\016c\266\334\3332|\367X\226"
+	.ascii	"\335\016?\271\244\200 :2\253v\005VxVB\254\250\266\004\363m\253"
+	.ascii	"\036v0VM\030\354\322\330Jv\032\303\244k\2673+\032+\354\2601\311"
+	.ascii	"\204\254\214\354\326\346!cM`\027Z\325\245\326\244[%\332d\271"
+	.ascii	"\216\245\245t"
+	.text
+	.section	.gnu.lto_.decls.edb0efa283525169,"e",@progbits
+	.ascii	"(\265/"
+	.string	"\375`\311i\305\261\001Z\300.\232S Ji+\215\001m?\033I-\337\267\247\316\264\346\362\371K\204K\202Y2J\177\212\257^\347\276\n\217S9~\364\240\315]\b\244t\255a7\202}\336\242m;\320s\3346\303\242\232\246)\212\202\240>ZD\315s\204 \016\337\327{\310\312\275\267\224R\246I\b\266\t)\nn\372Cf\372CR\364\207\210\350\017m\351\013\341\351\013\305\321\027j\323\027\252\242/\364\202\276\020\r}}\324\327i\3645\030M\202U*\257\251\350k!\372\372J\337\224\243\177\346M\3374\323\227c\225\312\233a\372f\227\376\235U*_\346\351\227q\364K3\375r\211\266Znj\271\r\230\0369\312\210\231bo`^\310h\240\257\310\250\215\215i#Z\023\022C\315\315ll\206`\365\270\371e\017}\021\376\373\002\206\232\343U\2734\256\017\\\246\205\002\f\315\361\202\251\335\"7\n.\323R"
+	.ascii	"\230\332q\357\375\"F\232\"\332]\273`\256\230\333\345n\271_\356"
+	.ascii	"\331M\273f\227\313\rs\313\256\027{v\325n\226_\262\253\345\331"
+	.ascii	"\270\367\325\355z\341L\0201MV\256\0306\026\315.`i\307\373\302"
+	.ascii	"\270\346xe\250\335\037qG k\307/!a\212\267\353\252\335!`\216r"
+	.ascii	"\377\355R\273^pjw\312\255B5\004\366\245H\213\02343\n\362I@Z\177"
+	.ascii	"Y\245\322^\331\244\362$\034}\305\356\305r\307~\305\356\225\177"
+	.ascii	" \302\213\256\256X\336\273\312Z\020F\326\202 \335\232Tq)\363"
+	.ascii	"I9}R\214\376/\025\260+e\310hE\347\314\315\326M\323/\225\002,"
+	.ascii	"!\202\345\346\223h:o\253T\336(\277%\273D.\224\213Wc\016\233\233"
+	.ascii	"\303\226H\254b\321\317\315'\305\364\255\334\222\270\242\021\270"
+	.ascii	"\"\326\221\257\031\t\355}\346L\221\311E2\347H\007\357n\357\375"
+	.ascii	"\377\026\357\223\353\3446\261g\227\311Mr\233v\225<\033\367\006"
+	.ascii	"\263\367&\312bdcf(\237|A[\022\207>IC\237\274\322\317\203\364"
+	.ascii	"\263\035}wR\371\374\246\237\215:\204U*\237\221\350g-\375\274"
+	.ascii	"\3651\235\276\234M*\217\307h\256\222N\231\\\327\315\307T\364"
+	.ascii	"\355X\326\330\305\272q7\\\246\245\273\200\211\335\032w\353\346"
+	.ascii	"\310r\274;n\217\313\343\352\260gw\353\342\370\235a\345\236A\370"
+	.ascii	"\233\376k\343b\335"
+	.string	"\255\253\3655\243+\343fR\316a\371Qw\267\367\026\362A\007\254\307P>\336\241\177\377\350_;\375\233G\347[G\237\315\215.\262I\345\217J\345\357\031\375+\246\355\266I\345\177\257&82\362\310\"bUu\265h\314\315\271\371\277U\227\nc\325\370\332^\3666f0\312\373\262\262\347\346\273\2270\334\371i\263\272\371\367\210>\bs\376\024\263\374\226\354\216\315cD\205\264\257\254n\024\263\300\261o\214\360\336U\202\212if\024\275\314\341\255\371\233\354,\033\033\207\215l:\006\027\2542\177\223\235\245\263o\254\034W\3062\350\270\367N\263\263n\026\r6\262\245\300\205\306Q\256M^\234@\277\305\263G\273\307\362\261wV\220\325c\001Y?6\220\375c\007\331>\266\316\346\3313kg\351\334\326\261v~\215\267ccL4\260\032G/\277M\263\263j\266\r\033\213&\270d\035\367\336\027\341o\222c\321\214\360\336@"
+	.string	"\201\360\33345\026\315\210\ni[\315\311(\356m\2745\376\226\354\377@\004kg\313,\0326\026\267\325\\\333\005fg7\324\334\355m\024\261$B\204\b\021\"\314\257#hL>\344\337\342\271\315s\213\206\201\275\215{o\016\031\342\264\202\334\374A\323-\236\322J\031!\177n\276\265\243o\321*\225\031\234\321\267l\372\026M\337\216\351[)\372\266\311\233\337\272\261Y,\232\372\304G\227\233o\217hl\223\312[ \372rV\251\274\275\241\177\264J\3459\240\377\323\277}\273E\363[2\266\214\215\263_G|\232"
+	.string	"br\2635c\317\3303\r,\334\255\026k<Ye\334\306\275\215Gw\311\2404.7\277\002\372V\203\022\347\345Y\rJ\253\245\351\366\r\263\275\301\020t\363[\320\036X\245\262\264I\345U\320\277\005s\333\366\333/\326\213e\303\300\336W{o\016EJv\350`s\263\025c\327n\331l\230m\331B\370\332\273\312\262\035\t\332\273\352\310Z\020\326\202\310X\300\236|)\363Kh+\326t\013\346\267bv,\251\324\3422n/{\357\243\243\2715;'7_"
+	.ascii	"Z\310&\225H6\251\274\027\253T\332-\226\213=\233\300v\371\007"
+	.ascii	"\"\034Sm\331c{\033\2170\340]\301\013t\363G\350[\263'm\331\"<"
+	.ascii	"I\337NP\332<;A\371\253\221\254RymR\371\301&\225KV\251\274\321"
+	.ascii	"*\225\332&\225\257\200\n\246\262\207\301~[\202\231\202u@\211"
+	.ascii	"?+Q\340\2777\360\363\004nw=\377\3610\rlC\313Z\026\272|\203\337"
+	.ascii	"4\300\217\271\274\314\001\340\037"
+	.string	"\246\b?\036\364c\274?K\340\277e\376k\346\277o\377Us\270\\B\3169\002\177\026\202\200\332\177\371\374\230\307\237\037\220\213.\007x+\354\277Pr\006\025\377\035^$\327\b\221\272\234\342\277N\377=vy]\203,\302Y\3107\243\3703\013\177>q\024?I\346\312\311\013\340\363\337\271\254\200\377\266\270\237\377q\036\330qyT]\253\242\303) \233X\277\244\225'x\211\337\024\372\361\001\352\344\025J\300fV!\247\240\200l\002\037\177\254\347\317(<\345\023\376k\201\337\222P\341^\340z\340\272\270\034\270\373\267,\334\016\244`S\334;\271\003\rXP\205\271\304\217\367\321\277\204\263+\310y\260%\220\331\204L\342\312\331\r\257\300\377\f\340Th\b\3762\303o7\374\026\002\245\337j\370\355\211\337.9\340C\277i\177L\224\023\360\343\270\037\243\3713\002~\273\200\337\256`I\374\226\001\277\375\300\315\217\343\374\371"
+	.string	"\277m\372m\002~;\302\217\251\374\230\316\246\360\333\023~k\342\267%,\n\277e\341\267&X\025.\b\331"
+	.string	"\177.\200\0067\316:\340\037\374e\333\217;\310\004\370\337\205\311\002\207K\373\017\227K\320q\267\260\005\362"
+	.string	"~L\346\307m\231\204\377\031d\021<h\360\343\n\3749\004\314\366\337\342)\370\313\260\037\227\375x\313\237G\374\367\350\267}\376w\351"
+	.string	"#E\200\215p\227\377\242\311L\177\356`\251\202\f\262\210\214\001\334/\370\313\016_~\034\346\317\027d\013\376\333\342\317 \376\233'\177\270\207+\375e\323\177o\374X\205\326\315\277,\362?\017 A\031\034\237\364\223\203r\005\231\202k\370K\373_\220\240??\372I\273\377\200\376\013\272\373?w\247\"O\360\3378\270#\375\344\235\037\237\300\013\310\177\331C\005\023Y!N\220aB\002\250\016P"
+	.ascii	"\027\377\255\272VW\361\362/7\360\343\0202\207\037\177@\376%\372"
+	.ascii	"g\b\376\254\341\317E\177\036\3723\371c\274\037\373\371\261\335"
+	.ascii	"\217\365\374\030\317\217\355\3748\316\217\351~<\367c4?~\373q"
+	.ascii	"\231\037\207\371\261\332\217\321~\274\345\307d?\256\362c\260"
+	.ascii	"\037\013\3711\220\037{\375\370\307\217\271~\314\343\307[?\316"
+	.ascii	"\361c\255\377\316\371\261\215\037\323\3701\326\217a\374\370\352"
+	.ascii	"\307U?\336?\366\300\217;\360c\027~\334\342\307\353\217\325\037"
+	.ascii	"\013\177\f\374q\006~\f\365c\246\037\377~|\376\270\367c\013\374"
+	.ascii	"\270\002?\226\300\217U\374\030\305\217O\374x\001?V\341\307&~"
+	.ascii	"|\302\217M\370q\002~"
+	.ascii	"|\200\037\027\340\307%\374\230\204\037\207\360\343\017~<\342"
+	.ascii	"\307!~\234\301\217-\3701\005?\216\340\307K?\206\340\307I?F\372"
+	.ascii	"\261\321\217\213~\254\177\374\377\342\375W\320\177\001\375\367"
+	.ascii	"\356\277}\376\253\346\277|\376;\366_*\377\255\373\357\361\277"
+	.ascii	"y\376\333\365\337\035\377\275\363_\020\376\253\343\277Z\377\255"
+	.ascii	"\372/\007\377\r\300\177A\374\327\374m\013\277\375\177\353\374"
+	.ascii	"w\356\277r\377]\363\337\342\177\321\374\266\204\377\036\376w"
+	.ascii	"\371\017\367_\305\177\026\376"
+	.string	"\033\367_\270\377\236\371\357\332\177\263\374\267\312\177\225\374\327\353\277<\376\273\365\337\034\377\305\361_\253\377R\375\267\203\377^\360_\013\376[\301\177?\374V\305oS\374\026\305\377\024\277u\300\377\023\277\265\277\305\277\275\377\271\376\243\371\377!///\357\307\360\373\227\356\217B\212S\306\004\335L\3169\036\322\215\024'_n\376\004X\364\177\373\373\227\273Jk\357\235\2034n-\253\242\362\267\267\244\265!~\f\026[\013\376\347\275\357\302j\3341\336\336\354\275-\037\035e\255\252\353\303&\345\366\276\032B\225\200!8\256\206\364\3002\033\202#\003\226\331\220Mu\345\204*\203\326\036B\205e\266w\206\253+\252\023\276v\006,\263\215c\277p\203\303n\343\020\252}\365\2653\354\253]\365\001\353j\b\016,\263*\034\031\260\314\206\340\330fC6\322\276\252\322\222q\265\2652l\263!z\266\331\027\016$,\263/\034XfC"
+	.ascii	"\331+4\352l\365p{\363D\211m\303\272\3326\262\274\252\264\220"
+	.ascii	"\344\260\214_[\316\336\326\013\214\255\265\345\366\266`o\257"
+	.ascii	"/-9U=,\233\225\234\r+0U_\326\270\367\356\220e\005\366\265\257"
+	.ascii	"\344\250\354\226\303\222\362\265\267"
+	.string	"\024+\250\235\265\367\336!P\031\345v\022+GE\304k\327\200\261w\004\333\270w\326\336Tv\313\355\275\251\366\336\246\226\227q\357\037HX\305\254\254\275\271\226\262\266\027U\033\214\275\257\027:l8\260\314\300\276\232\332\272\230\025w\f#\225\305\252\361\265\213[\316\020-mFU\266k\354\275\355\036]\304\241\243\356\346O\360\202\234\023\372\372\301\245\352\346{\030\244I7\337f{\0331\340*\036j\326\344n\317H\271\333&\204\265\267\016\017\252\314\305\201r\267\265\2648\270\0078\375\223l\326\274)V\261\272Y\215\320\021;z\330\334|\017i\306\r\\Ul\224\025\321\341\023\306\213\321lM\0348r\340\310\2675U\342\376\334\374\2135\246\253H\346kFWH\233\206\325\217\"\351F\236!\315\3303\362\215,\363F\266}\315\312y\331/\312\002\020\205\313\334\330\222\210\243*\260&It\276\007\"\372\036\206\350{\370\322\367"
+	.ascii	"\204-\355N\035*\252\233\017\302\231\240\"\026\027+\2742[\362"
+	.ascii	"\216Md\032\251e\206QF\031\026\t\206T#\277\220aH1\244\027r\315"
+	.ascii	"\236\221id\227\223hv\315\257q\357+2\2154\333\331j\220i\206\207"
+	.ascii	"F\033R6\262I\345=d\351K\200\247/\001\036}\t\336\350K\300\246"
+	.ascii	"/\201\231\276\004U\364%8B\226\305\016\272*\376\301r2\313O\212"
+	.ascii	"\221c\231\211\305j\264\352\274\270\331\032\255R\271t\245\351"
+	.ascii	"$\026\322\007\032!Kn&\262Re\250\253\fO\356f*F/b\336\224}\271"
+	.ascii	"\371\022l\351\377\244\024\022\n\031\305\236\221SH'^\310)\344"
+	.ascii	"\0232,I\223 G\021\246\220L\250\364\2040\305\252J\232\273\275"
+	.ascii	"\215K\"D\210(\225\234\021\t\2443Y,\252\342!\246\315\315\217\340"
+	.ascii	"\216~\004s\372\021\260\351G\340E?\202,\372'\227\220J\316\304"
+	.ascii	"\226\320\335\374\237LB\"!\215\220G\310\"\366\214TB\202\235$r"
+	.ascii	"\277n\215{_\001\271b%\030\236\037uwA\356\b\251S\374\262C*!\207"
+	.ascii	"l<G\347\307\027*q\204\024e\322&\225\217@\211~\004B\364#\330\322"
+	.ascii	"\217\240J\277\303\035\375\016g^\360*\"\343\246\n\217\364q\322"
+	.ascii	"\353'\177\220]\0240\261Zrs6Z\245\362^lRIr5\235\364a\204\343\312"
+	.ascii	"\331\227\2333\220=x\330\2713z\271\231\344q\3050\235;3\032;\266"
+	.ascii	"Xpq\221\221[L\354\227\221\2163+?t\204\300\360\007\216\225\025"
+	.ascii	"2\007\211c\213U\321\007\016\2554Ya\202n&o\\\252*\200\260n~\007"
+	.ascii	"5\375\223Y\366\214\264\361\265\242\355\241h\212\216%cn&\261\310"
+	.ascii	"\032\377\205,\026/\272\262\233I\031\344\f{v7\222\006\025\030"
+	.ascii	"tSn~\0074=\265\367\336\366n\245y\267\222\214\361\265\377BW\253"
+	.ascii	"\216\236@7\337\216"
+	.string	"\204\361_\310|3\344K\311\331\327\310\027y\313\027Uq\357\215D\336\200\343\347\314\315\357P\246\177\362\212\264\"\313\362\201u3i\365\265{\331\350\001rGV\345)z\34266\343\346_8X\272\254\311\222'\215\313\2342bcw\226\214\n\236\226;S\306\320\324\244m\241\323\024f\255\354\376\261r\\\005\260R\347\270\367\2562\250x%\320\231\2153\"\367\376b\223\206\246\251\314\227<\227\351\344?9P\346\223\335\344=$U\036\224\005\345\274\314&\003\312k\262]\366\223\361\262\\\256#w\276\313o\262\236\034'\343\311vr\237,'\303\311t\371N>\3469\271M\256c\317r\236\214\3469MV\363\254\006G&\217Q\003s&O6\223\343\254\034\227\nX\264\344<\271\230\245\3402-\215\306\005\353\350\226\266F\214E\023c\374\022wlZ\013#\307\226\307\200)\343%\315\361\353\211\027+\202\212o\026\315\312q\025"
+	.string	"\213\227\264<\331\314\306Y9$\t\030\223s$\303c\311r\236l4\233pY\202\345no\243\321\035:u|T\310\330h\225J\022\206\350?\303=\307Y4\fl\016f\224<\033u7\3473M\317p\024\204qk\273\331\264I\345;x\351w\230\241\277t\247\277tG\177\t\214\316m\231\207\232\"Nn\376\222\231\376\322\022\375%\037\372\034\006\351s8\352s\240\323\347"
+	.ascii	"\247\317\201\214>\207/\372\034\312\36498\321\347\260C\237\203"
+	.ascii	"\f}\b\006\351CpG\037\0023\372\020\250\351CpE\037\002/}%A\372"
+	.ascii	"Jl\364\225\320\364\225\224\350+a\351o\300\243\277AN\177\003\233"
+	.ascii	"\376\2062\375\ra:\207e(\366,D\216r\241+\3436\333\333x$\004g\317"
+	.ascii	"\013^n\376\006$\3726Dy\224\227\227\227gC\224\337\220\245\237"
+	.ascii	"\304G\377\331I\223\234v\026d\033yn\362\347#\031IfR\204\205\327"
+	.ascii	"c\307\3159IVb\317:\344%uH\254p\334\374$;\332\003{\333\016\245"
+	.ascii	"\315\313\263\035\312k\264Je\b\233T\346\"M\317F\210\324\320\f"
+	.ascii	"zrsR&\322\301\254\322\026\304\b\330\2202F\020367\347!_\273_\034"
+	.ascii	"\264\f\273A\200\204|\021y\331\312s\222\2772\026\216\023\004/"
+	.ascii	"\307\315`A\274\034-\031~B\007\004M\032//\344\262\034\277\216"
+	.ascii	"\\\261dL\222\034-Y\023$`x\007]\\\031\252A\305\031w\2168\206\215"
+	.ascii	"9G7c\305\027WN\034']W\200\2121\264\330\034\261\214`9z\251Q\247"
+	.ascii	"\330\225\261\356 \373\306\210\ni\357#2\2128\006\r;E\034#\207"
+	.ascii	"\232.\030wE\374\005\226\345(\343\350U\304q0\236\034\003\203\311"
+	.ascii	"/`5\254&{\345-L'W\341<\\\227u`@\230\016\263a7\\\007\247\341\266"
+	.ascii	",\003\247\301k\360\237\374\002\343\3418\274\206\303`1\331\006"
+	.ascii	"\026\204\335\3406\271\007~\223\255r\016\314'"
+	.ascii	"\323\300o\330N\346\221\263\362\rl\227w\340<\031\007\376\222k"
+	.ascii	"`9\231*sa9|\007\317\301\203\360\030\f\007\237\301f\3601\007\301"
+	.ascii	"s\270O\236\201\003a\270\254\225\273\260\037\214\006\353\3110"
+	.ascii	"\362\217\354#\357\f\004\357\301w\230\r.\223\2570"
+	.string	"\031{\226\261p\227c4\354\345\276\301}\271K\224\034ed,\264\033Mf7\254\002\025\275\274\301\202cl\241\261dN\202\034_\\\2728V\370\3308\202\371\020s\274]xX\370\213\310\330\361\305\235\023\207\311m\363_\031{|4e,\034\005\227a#[\n/\272\360\027\022+rC\310\262\350t\275\370S\264d\270\370B\234'EK\206\225\024ab\004\222v\3041n\310)\276\235Q\003\303=\350\316\340\0302\360\334AR\2541'V\004\303\\k\"\3748\006\326A\227\346\355\2329\002\346\202u\2019\276\240\263\244\330U%\350K\210\226c\036]\036\034\274\351\360\300x\300m\361!\243\356\307\0136dW\206\236\256\242%KR\244\311\265\273\177b\340\257\"gb`^jE\260\"_\2168\006\326Y\036;G\222p\341:\263qFUH\373\352\205\215\342\330\177\3012\026\376q\026\346(#\317\013\367E\035%h"
+	.string	"\325\270\202ft\335@qh\274\305\245\025\327\250\321\202c`\034tk\212/2\326\305\023'Hqo\243\210\322j\307\223\036\326I\026\332\262I\345\223\330\350'\261\351'\211\351'1\321O\362\241\177,%\fC\301F+\264\0057F\314\315Z0\336\f1Yn~R\016\375\037\217a1\234\005c\261g\230\f[\371\025\201\212\032&\303W\302L\001S\304d\270\212E3\2422\356\033\003\030R\245\316\312\336F2\tW\335\334P\276\006?\372\032\216\372\032\360\350k\260\243\257\201\216\2766\232\216\245d\"}n@\271\371\032\340h{\264J%\0056\251\274\2067}\rd\372\032\240\350k"
+	.ascii	"\323\327\220C_C\225~\006<\372\031\334\3643\234\351gp\242\237"
+	.ascii	"\301\207~\206\030\372Hw\372Hq\364\221\336\364\221\262h\017lR"
+	.ascii	"y$(\372HF\364\221p\350\037\r\322?\272\243\177\344F\377(\214\376"
+	.ascii	"\021\231\376\321\023\375#\037\372G3\364\215\376\350\033\301\321"
+	.ascii	"7\212\3237*\3237J\242o\324C\037\303 }\fv\3641\304\351c\330\242"
+	.ascii	"\217\341\211>\206 \372\030d\350\263\331\244\362E{\364\213\332"
+	.ascii	"\350\027\231\351\0271\321/\372\241O\024H\237H\216>\021\031}\""
+	.ascii	"-\372DW\364\211\234\350\023}\351\023e\351\333\347\372\261gK\367"
+	.ascii	"\356\310\272\261\262\341u\363\211`\350\017l\273T>\317.\225\037"
+	.ascii	"\302\243?\024\272\270\205\bW\240\264'hr\276\212\324\270Y3\321"
+	.ascii	"M\256\235\\;\271\332\t\316\313+\263\274A+\215\030\321J\356\327"
+	.ascii	"\327\336E\363\013\335\225c\222k%n0\354\360qs\263F\242\003\245"
+	.ascii	"iys\263>r74k\300\202\214i@s7\374\0201\325\322\362\364\330\001"
+	.ascii	"\233SS\303\352f\343\330\215\033K\276\204\220\307%Z=\350\030\337"
+	.ascii	"b\274\351\nbV\211Re%\357f\355\303\207~\301ji\355\020\340\242"
+	.ascii	"\314\215\335]{]\277\240\251p\271\323v\263\356\372ZY\221677\353"
+	.ascii	"\037#\302\264qlo\243QI\205"
+	.string	"I\214\266\233\365\226\336\322<\226\276\250\372\034ie\001JSV)#\004\207\336q\315\003\317\r\324\347\313\224\021U\332\206\266\241s,}Q\355\t\200\026\260*i\356fp\201\351\3229pt\2602g\343\320Z:d`\321B\305\270\321\344\374\374\3207H'Ez\314\004\211q\363\231\360\350\032\272\206Y\314\352\303v\207\306\306Z\333\315g\322\242c\350\030z\306\223\"\321\327\230-;Z\306\365\fme>\2613\312\271Yc\t\225\261\361!v\263\024\275\365\326/\226\276\250\364`\340677\226\307\t\2150}u\375\"3!\252\243Gl\356fM\245\255\330\bA\303DWa\272\035[Qn>\023\023}\273\314\244\310\207\t\325\315g\032\362\347\217\211\267\364E\325\247L\223U\007\345\316\314\323#'h\320M<+Fg\307\210 \030Rt\234\t\nDn\315\340sC\r\236\263\003\367\004\020Y\006L\036\335\361\346w"
+	.ascii	"\347\307Oi\341\266T\251\303xp\336\356\334\374\016\270\354\331"
+	.ascii	"c\332\r\215e\325\201b4gd\006\r>7\355\216\254\2460\tC\276\261"
+	.ascii	"r\207\316\307\315\357\240\307\361h\352Y\372\242\322\263\201V"
+	.ascii	"V\234\273#\200\262\3201"
+	.string	"\365\220x\376\370\370\032d\207\007O\251\266\364EeG\024\227\005\346u\227\377L\311:\323f\316\034\323\316\225\243P\026\263<}\352\334\264\263\206\335\3700\363q\263IgL\2348\346\334\331\023\fs\203\202\2501\243\2433\253,\351\235\205\316\311qo\256\020\346\013j\002E\271\371\001\240\242\346j\3149\273e\337\210\300\246\203geo\256\020\030\302\336\204\321a\272\2719\207\347E\032=p7\233k\3146\201\344d\324\2651\345\206lQ\301\b\033\332\001\005F\235\311\346&\261Z\204\264\345\005\340\353\314\031\023\215\330\225\023\206\244\214\031w\023\r\236+'\220\220\266\233M8\033g\364B\232\225\035\001\230\361\366V\326\270\033\202[\242'\356\346sP\267\266f\2269\276\332@^0\022\224\005\3465\304\005\311\361\212\314\3152f\033Q\037\2636\2631\377\2050ly#Rc\214\331F\005\307l\211\311vd\306.\b\333\315\347"
+	.ascii	"\216>\007oa\302\230j\026\311hE'\243\2707W\bMU\266%E--\315T\263"
+	.ascii	"[\366\r\017mVsc\023\330\342\244\356\313M\2655\213F\247\r\031"
+	.ascii	"\243\231\231\211\266\364EeWne\211\361\320\002\310M\226.7\321"
+	.ascii	"0\330\235\311\221\335|;\363l\315\rA\200n\346 \207\3617\232[\354"
+	.ascii	"\226}c\211OV\2253w{s\205(\232\221g\220\232\262\233[\216g\314"
+	.ascii	"\354M\226\232+7\307\256\230df\231\245mu\265\201$I\n\224\365\004"
+	.ascii	"\320\335\306\362\n\361d$H\0323\313M\262\247\311;c\033\"f\306"
+	.ascii	"\241C\263\345f\023\013\331\245\243\216\224\233_\204$\315\232"
+	.ascii	"\272\233/\342\315,rSJ\021\263J~\333\033\206\335\262ohm,\257\020"
+	.ascii	"F~\340\372\3600\251\334\254\222\205\310\361q\344fs\312\327\216"
+	.ascii	"\304\224\311YbB\271\031\345\027\302\020\204*J\225\233/\202M\233"
+	.ascii	"M\314\242\031\366\013\225`\200\252\262n\276\b5}\363I\036-N\344"
+	.ascii	"\334l:\3210D\220i\220i|\27133\235\260a\360\202B\244\310\315f"
+	.ascii	"\022s\211\311\344\027\302A\274rt\271\371\"\232\350\233J\376\013"
+	.ascii	"\225W\250H\351\272\371wAzu13hl\357\035\202%SVQ\361\tr\263y\344"
+	.ascii	"&\222_H(G\214'w\3727\215\374B\370\006\330\013\266\233\277\301"
+	.ascii	"Q\177\203:``\245\232\220\235\251#\247AB\346#\355\353\313\024"
+	.ascii	"\362a\357\rc\273\260r\205\306qsy\2050\203\\aqc\n)a\330\bDg\355"
+	.ascii	"\346o@\305\004b\0029Se\311\261\250\345\212\237\233\277A\021\323"
+	.ascii	"\313\364*\325\354\312=e\034\032@\362n\376\006[\346\017\363G\237"
+	.ascii	"r\017\214#\223,7\177\203\030&\227\311\025%\304\037\375\233<n"
+	.ascii	"\317L\036\244\335\335\262\251\214\212d\375\250\273#\377\304\030"
+	.ascii	"2\247\177s\313\236\231[d\026\022k\357\034\037\314X\205\030\243"
+	.ascii	"\1773\307\355\231\231\203\334c\267l*\243\271??\352\362\221\f"
+	.ascii	"\226}\363C`\321\277\251e\317L"
+	.string	"-\322+o\331Te]\026\230\227\225\275\2718(\243\004\251s\345\346\207\b\242o\326\260\246\r\033_\313H\233\206\025W1\204\rS\2065i\2304\276\246\302~QFB\024\r"
+	.string	"\001\322\200\351\350\312P\335\374\233Xg&\026\311\303\336\230\303\243\177\023\206\t\203\264Z2n*s\215\214\006m\314+\363*\b\206#=\334\272n\276\006l\246YU\252\tm\255= \340\214h\270\221\251q\3635\250bns\227r4\325\004m\\p\022%6\2127_\203\037xx:\n\020\006\246A\226 A6\216\274\332_IJ\274\032~\260h\2603@^\334\374\f\324\374)\357\224\200\362\220\004\274\300\332UP6@C&\016\224\273\f\304\350g\220\245\317\235\322\017\211G\0044{\224\350g\260\203\017\237\fd\350\251\273b\037\250\214\373\206Uc\025\007\212\225;}"
+	.string	"\320\351\277\304s\247\314s\305\362\346\332T|\232\320\314\001"
+	.string	"N\037"
+	.string	"jv\354\220s\320D\001"
+	.string	"\024:\366\254\244\223\245\250\360U\225\003"
+	.string	"nC\252\324\031y\305\310\nt\363\001\360\005\007N)\307"
+	.string	"u\220\034-\235\235$x\342\274\224C:\331\262\223\347\346\333]p\027\307\310\315\007\300\325\334\\\371Fh\203 Q\360\2336i7\336\330\270\241%e0\204\334|\f\354\350\277lsV\266\261q!vU\025\006ad00\303\206\r\271u\362j\023\261R\f\303rfu\3631hS\243\306\242-}Q\325}\250\2531\267&\017\312\003'\311\315\307\240\211\376\3138\270\022\r\031\246\251\264\264Z\222\270#\006_\372\030h\275\275\225g:tY\021\365!\002\305\214\231\227g\360\030\215\271\035\377\204\375\027\352\271)\271\273\371\027\b*S\206\304\201\261v\325\020\022\302\270\350)\327\312\265r\214\036\304E\320\0360*7\227c\276V\204\312\213\317\315%\233\021\035-T\312n\276\335\327\246\210\271\362\345\346_"
+	.ascii	"G\377\212\3312L\030=\036\204\355\271\340\314\227/\245\232\nn"
+	.ascii	":z\374h\243*\325\242\200\325H\363\342e\304\2368P\254l-.\016\206"
+	.ascii	"\340\354\301Ru\363/\300Rv)\273\224V\350\274\256\022*S\224\334"
+	.ascii	"\374\013\220\230\231\3551\325\364\231\341\346\346_\340c\313\026"
+	.ascii	"\036\037\302\300.\220a4\266\351\3206\234\360\250\352CFVeO\233"
+	.ascii	"\261\261\322\212\n\036\264Xme\275\341\272\371\026\264a\301\002"
+	.ascii	"f\201YI\245"
+	.string	"\244RZ\021\333\243\355\264Q3\245\312K+_\262\344\235\261@\212\376K)g\245\224+\266\264\251\370|\210\022\305\202\":,\254\204\242\367\206+d\210\216fI\266\274\204\322\347\r\210\240\233o\301\f%\345\023%\245\223rok\374\272\241\265\271\266B\224K\312%\245\023M\325!\f\314+\204\320\330\225\261\031M^:q+g\250U\251qs\311\344nN\356\350\030\203\366_\210\004\353cg\355\346\203\250\323\007AF\377%\022{V\"!\2550\326\3368H\b\323\001\002M\277\004\263e\021#_\373p\205\264i\304\300+f\321\007\021\246\357\005V\215\037\031sn~\031\304\226B|\224C\276\246\251\264 \230\2016\350\b\342\210>\210.\3755{\257\366\256\272\340\250H\0269;n~\331e\313\027\376\017D(}\224@,Z\366 \217\213\221\203\203\270\322\377PG\337Z\264\362/\177\334\236\225?\310\243\n_;G"
+	.string	"\302\270,\301\202\301NWU\222\233\377\001\r\027\0279\347\356\275w\321D;\362\347\370!\213\376\313\035eV\311#7\261;\207\326\002d(9~"
+	.ascii	"\323\377\020C\377e\2162\253\324q\267\274\275\354\252\034 v\350"
+	.ascii	"\330\034\374\003\225~\005\177\364_j\335\236\225ZyH\336\262u\230"
+	.ascii	"\\\236pq`\356\251\252 \217\376K\033\245\215\374\365\204\013\336"
+	.ascii	"\033\026\303\205\217\230\262\0313\312\032zD\320\261\207\306\313"
+	.ascii	"\032X\215\222(f6NK\024.#7\277\002!eUYUb\325\r\200\314\234V\210"
+	.ascii	"\277\214\361\022\353\212\t\205\365\221\313qsiU\026\275 EOW\t"
+	.ascii	"\243|\361\247K\331\025\233\316\203\365\004\320\315W7\213q/\031"
+	.ascii	"\375\221Qf\347\346\333\335\355\277P\336\321&\246\346\346W\360"
+	.ascii	"\242\334\345Fb\344#J\027\033\037<\2741\241<\343\024\2717\202"
+	.ascii	"\004e\0257\027W\b\313G\t\033\231\033 @l\300\206\274\336\350\370"
+	.ascii	"s\363)0\352\237\274;#\357n\325\322\226\235\343\b\314+\307\326"
+	.ascii	"\335\336g8\030z\273\"R\346\346S`\244O\037\322\206\n{o*\343\276"
+	.ascii	"\341\001n\016\227\325)\363\342\346S\200C\3631\233\204y;\336|"
+	.ascii	"\n\266\256\023\002\344\2166\022\261\001I\333\272\231\314s\364"
+	.ascii	"\366\303\356\315\315\237\300\215\276\363+\202V\346\346O@w\222"
+	.ascii	"\016Y\207\\\243w\330\336U^J5\023\250\351\223p\3108'\345\234\221"
+	.ascii	"r\3109v\357\275\2716\225\237R\213U\034(w\233\213+\304\321[\f"
+	.ascii	"\360\251H\3460\312'$\344\024LOu\350PLB\325\305\023\212`:L\321"
+	.ascii	"\342\234\300\232\006\323$\006\254\350S\322\241\230P\342\n\250"
+	.ascii	"\323I\004\246\247\023\322\352\223RWbPXb\003Ck\357\203\246\251"
+	.ascii	"\324\311tqb\003B\207b\222\212J]\374\204&\bU@\255\352\211\002"
+	.ascii	"\004\242T\241\0231x\252*PTu\372\235\250\nAa\032T\321\365\224"
+	.ascii	"r\200TT:\202\304/\035*\035\212\211\210\002\004VPQ\202D\017\205"
+	.ascii	"\023\032p\242W\002E/\305\n\031\016\305\204F\245\353\b\242\212"
+	.ascii	"\262H\325\0371\005\002\323\250\022x\006\237\322\024O\301\224"
+	.ascii	"E\212\372P\024\304\025\246\324$\027\300\341\220\204\321\232\006"
+	.ascii	"W\b\246g\n\030\3264\270\302/\035*9\r\031\220\0169\254\275t%Z"
+	.ascii	"\321\024\246\324#\242\32074%T\207\303\263\027L\211C\207b\032"
+	.ascii	"\201\002q\005T\225ZO\324\t\351PLk\032L{+\254h\212_:\204\300i"
+	.ascii	"\r\246*\260\\\211A\241\217\374E\245\304|(_\360TW\004\323U\030"
+	.ascii	",\372E\245\304\017\250z\002}\350\357\3030J\210\004<}\3045]1B"
+	.ascii	"*\370\324\301\224T0\005v\020\302\b\275\021H\230\032\201\376\244"
+	.ascii	"\200\276`:B%J\215\030\341t\242\300\334B\250B\255\302\240\351"
+	.ascii	"\324B8\314\350\212\002\207Q\302\022 \316\365<\341)\230\266\340"
+	.ascii	"C\261\246\301\024\t\0051E\"\246S$Z\234\023(\"\252\302Ux\002\203"
+	.ascii	"R\t\024C)\r\b\205@$\016S\252O-\221\322\023Z\234\023HB\327\323"
+	.ascii	"\227\002\207R'\020S\242\037PX\204TB\270J\221X\n\nS\017E=4*]\203"
+	.ascii	"R\352\b\237S\005\304\247\023h\002\375\tO\034\03151\251P\2214"
+	.ascii	"|\300D<1\205\342\227\002O\026\033Z\240,\020S\"$\020\230|\300"
+	.ascii	"\323\247\201(\004\246\024\003\n\"\021\365\t\325\341P(d\300/m"
+	.ascii	"aE\237\324s\315@\\\321\024%V\364\211\303\024\212\r\344\241\230"
+	.ascii	"\236\244V\240\277\021?`*\265\242\003\372\023\236(\362\240\211"
+	.ascii	"i\n\305J<\201PDTuBQ$\r\241,T\251\022C\304\024\303/\005\236\020"
+	.ascii	"@\327\023\305\024\212\025}2:W zB\206\025}2\"\256 qD\\AB\303\017"
+	.ascii	"U7\370P\254\350\323\021\272\236(\212\320\365D\261\242OG&L\250"
+	.ascii	"B\023\347z\2360\205\242\005\03242\361\200\037PJ\b\225bE\237\""
+	.ascii	"\340\340\001\323\252\236C\246\247`J\302\007<}\024\250DB\"0\005"
+	.ascii	"S\"\221\320\bLB\037\021\004\002`Z"
+	.string	"\211'p)\n]\211.R\034\231\020\252hq\242\230\240\003\tLD)a\312\002U[\220\200\034"
+	.string	"\323\024\372\013\246\246\320\241\230\236R\247`\013\031\320\365\\S\bU\025\005\023\025\240\300a\324\231\002]O\240T\224\224\317G\202xJ\255>\022H\0168\"\022\323\005\030\231@}'\212\022k\020UU)_\207sEM\330\260\256\353\332#\236\300@D\201\256\347o(\205t_\252\242A\364I?\204\021:\030\201\204)\363$\224\340A\t\036\224'\241\204\246\246\022Fh\322\037\241\t{\300\344\344$e\302/xFE\tK\370\324#\264\367[aJ\270\302\374\271\236'\0349\241\277^o=:\024\023\021j=\243\"P\205\253\017e\321\033:\tI\300N\300R\300\236"
+	.string	"\002R\013!\320\b\352)\205:\372\201"
+	.ascii	"<\325U\n\r\n\375@Hj!\004\022A=\245P\275\037\bE?\020~(\224oM["
+	.ascii	"\020\217\326C1\271P\321u=W\214 \252Bb\020%N\260\366V\215F\245"
+	.ascii	"*V\365\\\211B\304\336\323\271\002\205\020h!\004j\370\241\300"
+	.ascii	"\025g"
+	.string	"\0205\321\247s\210\350S5\350\026\247\213\242_\360\\\361;\321_\006\364\t(\204\352\255\300s\303\017%\252(\013Tmq\272\330\0204\341\0028\034\236Ek0\305\353)\004:\221\207b\232RG<\r\223\246\324\241\341\031\345SI\025\375\245,\204\352\360\207N\251\3003UQb\206)\0248\224:\301\txB\r\005\323\017k\317|:U\b\323\336\223\024p\270\244\376\202\351\212\336z\022{QR\352\252\001tH\224\240\b\005\236\276\241UEY\004S\237\372K\243\310`\032\2455\340C\241|Sg\224&\242\250\372\204\236\020u\226`1t\322\260\236,\322\325G\002\375\tO\250\351\271\024L}(QjJ%\232\222:{Sg\324\021QiE\211NNB\"\364'\214\312P\001\007\027C\325C\257\367\024L}*\210\2370U\321a\317i\b\354\241Q\247\352\324\363\251\304^J$\252\035~ioM\203R\030>"
+	.ascii	"N\251\304\243\225x:\365\210R+\210Fj\220\330\233R\217\326\336"
+	.ascii	"\007 \254\301TJk\200xF\365\210@4\030<\241|=\364\227\252*\312"
+	.ascii	"B\330\033\022\243\"\370I\235+\322U\370\204\006{(Q\252\347DT}"
+	.ascii	"K&\261\205_:,r\001\252G$\236\303\026B`\257\305\351\302\250\311"
+	.ascii	"\005((\337*\fjX\017\305\364K\207#V\250\247\024\350\264d\302\022"
+	.ascii	"{N\277tX\266`W\260'\330_:\304Mk0\025\2660\224\372\005\323\bp"
+	.ascii	" jqN@*\305/\035\032\005\323\023+\211_:DZ}\250\223\323\252\242"
+	.ascii	"\303)\264\267\002\323\265\027\024\272\220\252B\250%\364'<\341"
+	.ascii	"bMY\234j\n\351\032<\217T@\020L\317\024T\341z\252\350\006\024"
+	.ascii	"-N\027\031\200\250\317G\002]O\325\350\367\204\364\003\n\241\210"
+	.ascii	"\250\n\265\366\226\320\250t\035rq\002\321\037\321\206\244\026"
+	.ascii	"\247\213\336\321\220\013P=_\272\236+\261\367\301\006\027*\312"
+	.ascii	"B\350C\325\036\024\361T}FF\253\020)%z\n\236K\304t\352\354q\b"
+	.ascii	"\246\347S\006bT\357w\242P\247\006\204B`OE{B\325wv\b\246\347\023"
+	.ascii	"R\006U\250\252(\007_\217\270\342\324\200\016]\254\275\017\216"
+	.ascii	"\\\200\352\005S\027\240zSg\224\022\372\023\236h\301\303\232F"
+	.ascii	"\245\f@\201OA\022\034\202\351\231B\206\025%\242(T\364\351)UU"
+	.ascii	"\264\020\002\201$J@\371\202R'\220\202\036J\224\3220u\002Q\265"
+	.ascii	"\327\342t\321\373\241\353\251>\241k0\335\340B\252\236h0e\300"
+	.ascii	"J\224R\241\326$2\230\236OC\250/x\262\370\235?\f\253\324p\225"
+	.ascii	"\022"
+	.string	"\366T\341*\214\322P\366\200@\324\327\023\256R'\207\336\032D\227\242\206H\303\364\b%\236\250\352\013\246(\360\227\366\202.~JAa\272\246\304\340\251\256\020<\005S%\242SOE\3275\315@\207\225(\024\256\310\320\233:\243z\302\341\024\332\013\272\370\365\232\234\206\300$\324w\252\275\243\2400]Ob\020\035F\t}\275\247\223\330[\317\025,\224\320\2370\252G\374\245\303\r\3043\312\003\020(T%H3h\020\246\353\251\366\202i\224\222\004\034T4\005\016\323\025(\025\325\353E\251\350\372\263 \230\236O\275t\330\203\362\255\351\260\367CS\247\0248\214J\211K\253\nb/\t(\024\232\320#\177\250\013)\360L\3274\270B\206r=\024\323\210\2400*J\350\223@\003\226\330\003a\035\022\221M\037\240\353\271\022\313\2400]}(\320\t=\301\tII\211\310\201\303S0]W4\205\223\323\221\013_\020\225\332"
+	.ascii	"\252\232pr\022\256R%~\352\331B\025:\375P\324)\002\342\003\320"
+	.ascii	"\250T\005\032u\252&\320\247SEY\234\032\326C1\021{>\325\303\324"
+	.ascii	"\031"
+	.string	"\205\211=\025*\272\002S\023O\301\324\247J\020%E\304kPJ\350#\203i\024~\n\246\301\364TWML\247H<I\255@\177B+\232B\025\256\276\323\004\221\210\006\241V\2410*\205p\225:=\254\207b\302\340\302!\252\216X\205Bu\004\221p8\205\002\020e\201\002\205\210\275\247\324)(,\201\256'\n\240P]\203B_\022\t\277\364\204\n\265\232$\b\207S(\250P\253&\372TS-\211\350z\252$\272\236j\357\034\256z\r\246\302\241\006NT]\321;\207\253\021:t\261&\255A\324\247\242\303\036p]\205*\324\n\301\332\033\241i\r\246RzM\243R`\017]Ou\b\375\tO\234\303\325TO(_F\243N\026P`\352$T\207Dk\217\2045\230J\231oj*\361\341\001,\244\240}L>u\204\317iD0=\243F\370T\342\b&\r\302\341\024\n>\024Dt=Qh\300\227Jm"
+	.ascii	"\351\277F\243y`x\202\026\204M\234\215R\255\212\212\0348<\275"
+	.ascii	"C\211\333\2353\372\205I'\350\216\0173z\206\237\0378\300\336H"
+	.ascii	";\343\025\263%n:\207\026[\342V\243\f\271\307\r\020=r7k6\315\246"
+	.ascii	"\307\bm\255\272\017f\300t\333\365\030\2412\177\352\324\320b\346"
+	.ascii	"H\021\022\343\346\217\250\323Et\276\260\261\013c\223\230\241"
+	.ascii	"Jr\363G\320\321\277\006C\316\361\201\004L\315\264\303\240\007"
+	.ascii	"K\037&_\354\034m\371\240q'\255\304\342\001e\320\227\027"
+	.string	"\022\317\2236\200\250n\276=\323hj&\324\325(\322E\017F\2636\245\312Y)g\n\023#ln\326_\240\230\rI\203\245\240Y\201\263\305$\353r'&\207.+k\220njTH\264\321DCe\314k\207\3262\027\327\204\352K\223e)ix\344hd\271P\360\374\210\342\245\307\234\2248\002\201\271\321b6\256\307\213@jX\310\2604[\004\275\351+f\031\267@o\340n\326T\360\007\362\362\362\362\004\355]\245\251\\mEW\271\246\362#S\216\025\254\2522,LK\331\323\301X\026\036[\224k)Gt\216\270\305\335\254\241`7xM\374\214\350\242\377\207\323\250\023\342\344Z )!\304\2343\b\321\314\310l\222\306\243\025@0h4\034\022\213\366Q\366\023@\003\213\313$\222\236\007\225RfFDD\202\202\244\244$\2254\006\245\261\304\265`%di\324M\305]\333R\255l\231d\206\033Q\"\3520"
+	.ascii	"\363\273\223\301\203Q\223\330\276\021\346a\247.\224\307\357b"
+	.ascii	"\262\0163\246\201_\016!C\340\"\rq1\004`c\352\230\353B"
+	.string	"\024*\367\205\321C\2771%Z\"\2433\320\306\201\344\201}l\203r\234\342\r\013\302\b\205\265\025d\317\246\231\213\330o \271\246\025\204\346?\302\r"
+	.string	"\221:l\246\027\325\233e\322\343\"\331T\225\016\310cUL\272\300\377\241\024\207\337fwx&\013q\007\ts$+\215\311\254L\263D\220\372jA\365\233o7#p%\246\317G\261\356n\316\020\334\002\332A\340\207D+\212u\201>\035\204\244\254\257\031\023\034H\264\241\313\357\034\237\021\351\r\"\336\006\216\241\033\200Z;\243`\017s/\270Y\222U\352*\022\017\212\364\277w%\305\303\330\204\2472\267\261\021"
+	.string	"]\024\330\313o\023\376e3\321\2303\340\316\324\205\r\337\323\374x\007\020{\241MQ\230K)_\2477\323H%\206L\363\365\242\316*\246tiE\226\306\217p*RW\200\226s\367\321\303Y!\214a\302\233s\311\033}\221\314\255\373\t\274\266\2100\006|\340n\3071<\232\260\216u\006#%\006"
+	.string	"\216\356\371:\204\024\224\345\273\306\212\260\203\236}\352\3325'\236\343O\356\026\305\250\233\202co6\036\353\227F'O\252\262\3275\226\256\346G\2559C\250]u\3111\b:\224"
+	.string	"(\355fe=&8\313\024\r!\006\223\244}\373\2056\236\352\220\250\337\3448\351B6<\362Y\356\220\337\b(Z\262\250DH\016pt\007\027\031\021F\256\373\200\244\340{O\264\312\216*\270\332qbh\323y\212\203z2/\246\344T\334\242)kf\267I\007.\247\002} \300>!h\002\022\306\025\252\261\030\004\351 \331\233\305g\342\251\255F\027\323cL`PH\267D\241;\236Z#\n\nx\276\200\026\224>\032\336\246pj\031W\021\351A\264,X#\007v\013)|8\0044h^)\2338\205\260\037\004\016\261\2607\235X\b\310\354\002\215%\006\002\030hjb\247\253\301\310\207\346\265\002\005]p\352\321k\317k\225\352\r\227\303\331\322H\230\201J+"
+	.string	"\024\325\302G\223YD\344\210-\031\237/-"
+	.string	""
+	.string	"\247\236\235V\201Vt\213\355\250\313\347\361\221O\3604\311\260H)UbGk+\027\360\310\202\203\225L\206\260\224\t1\370\271\264\321\005\244+r\235T\210#\355\305\247\341\023Fvj\335\001\031\253\006\320\313\370\370\204\027\034@tI\313\254|\351\006\230pd\276I\231,\355\360\032\256\240'\027&\226\376\332\264\001\256k\210o'\360\334wu\357\253\321\025\020\036\227\261~\370i\252\215\326\004\365\303\247p\227\373\236nYag\314\302\220G\227\367\311\247k\b\334\n~z?\215f\363\355\017WL\353\020\021\332\r\270\023\231-R\354\205\354\377\301\nl_*2+dR"
+	.string	"\207\026\335-\362@$\242\226O\247\336\205\260\270\237\030Q\0328\023[G\2750s8\204>\202;\f\253\2725\324\342\333\352/\316\2623\264t\035\341!\0226a7\306\342\232\207=\306\264\026\323\212\200+)_\210\002\016Tl\335\247\216vZT>\2666+\215`\212\372\202\363\253\2106n\225\313\205\303\3225C\005\371\230\314\270\005b\310\233&4\234@\0323\226_k\272\222\342\243\262I(N\302r/s\247\333r\004\230\0258)\242!\200D:\227\366\232\227c\205\024~\217\253\336\200\t\311At\374\312\220,/,\367\260\261|\201\227\245\300$\211\270\350X\326\273\031 \254\030\037B\234]B\367\3143\023\2572\203\b\217\251 U\301\345\034\344-EFd\317\375\226\247i\217\373z\227*\207e3NT\252\257\254 \353\333\221\335\302["
+	.string	"\240\036\250\271\211\222\272e\362><G?C\020w\224\226\272qa\340\220"
+	.string	"\032\262\025g\byU\026\007w\003Z\277\032L\221\360\224=\304IRM\226\233O\365\322bt//ZH\252\331\267\343\231 \bN(\242\311\236\362(\204i\361e!\271ui^\315G\363\363\037C\377Dz\211\215`\375\rd`\331O\314`\007&\\c\007,\036\356\3648\033\327\035\376\310\177\361\346"
+	.string	"\270m\260G\266A"
+	.string	"\205\ft\001\212\240\003\270\231cc\200\001t\352\023(.\333\255\003\002\220Z\360\310l1\2303t\265\311\255\363X\356\237\311\322\275*\306rQ\237\001w\250\273\005\340\251sT'+\034\227\214\251<L\217\354p\276Q^\036a\354\224\271\341X\226V\f\232t\n\342\226*\276\326\013\351?dB\325w\244~\024d\345=\314\362\3278\002\336\022\363)f\316\263T\216"
+	.string	"\271o\304\376\233\275\231K\t\215\265U\006d\202\005\260\275*\0059\203\3010mT0>\231A\336:\027\257`\202\024\230\272\221\005}\327\200\026&\342i\211\030p\236\220s\375\177\022\0133\020"
+	.string	"\211lZ- $4\360\304\337\205;3\272d\306r\235\226\361\272\033^]\365k\265D'\3333\"\237\3263#\277\226y\225Q*\316\036cM4\231&kS\252\330\310\204\002\027\226\316\240e\220?\210\344\n\031RZx\0322\006\007M]\376u|L\371\326QE\355\025@\211q\317\001\017\343\254F\2441B\036A\204\f(\036I\237\351rYK\330\327\033qkt\003x\353\363%\342\334|\2668J\213\024%\305H\to\371;\354\252|\237\326.\270S\332\225\345\222W\231\271\265\017\265lU\332\276!\3361L}lra\232\260-s\031\354\026\214\374\203\275h\322g\"\312/'\034l\2010\301\244\017\303\357"
+	.string	"L[\027\365/n\254\362<"
+	.ascii	"\261\275..\244\203(\017\262A@\371\030\224\276\261\344\232w\261"
+	.ascii	"(\357\343\022p\245&\nK\227\230?9NP{,\373\323l \240\032\240\267"
+	.ascii	"\327\004\021,\232!\035\252\335\016\361l3\\\fWh\210\250\2073\342"
+	.ascii	"\331\002\217\013\203\034\311\373\345\370t\302uh\034\r\261;\224"
+	.ascii	"\305\375\204l\210@@F\352q\214\312\350\361\351\257\355\351\217"
+	.ascii	";B*\240G\353\232\260\333'`fQ(4Q\023q\310\264\017\021+\354A\357"
+	.ascii	" \025\262\344r'|w\337RB\212F@~\320\3446q@\333Z*6i\333\234\252"
+	.ascii	"t\254Zd\337Ip\322\030l\216\212\365\023\234\222\037\265\207\240"
+	.ascii	"\214Ltg\347vr\347\315\261w\030T|\3112\362\334\372\2316\211~\375"
+	.ascii	",\303\030\205\370\331%p#Wk\216\353$\202\3614\324&\206\003\211"
+	.ascii	"5\320\307\321\301M\r`\212w\206_C\233\214nL\357\350\013\007\237"
+	.ascii	"\r\253`\255{\320e\337:\350&ms\335\240E\0136_\3349\027\027\301"
+	.ascii	"\275\202\357\031M\346\b\f\332\341rA\356\227\202\003\260\030z"
+	.ascii	"D\324\202[\242\346\263\357]\363E}\337\\\025xF\033l\236n\342\204"
+	.ascii	"l\273\377\235\333c\226\004\311<\240\222\272\3330\356B\252m\365"
+	.ascii	"re\341!a\330i \243\363\220\rJ\025j?\245\220>$\251\3600{\355\330"
+	.ascii	"\301\247),\265\r\2661p\375\200A\021Usm\327<Bl\256\265\317\354"
+	.ascii	"\206\b/Oy\204c\245F\342\362\225\272\220\203\b\267\236\003\302"
+	.ascii	"\016\311\207\032\265M\331\220\331e\330\307\325\346\370C\002\276"
+	.ascii	"q\316\372\344\262\020\f1\242\326\345\352\322\276\224\256\234"
+	.ascii	"p\243\227\034\250\f\272\350\205P\217\355\247\206z\363\003\342"
+	.ascii	"\234h~\177L]+)\016\352\372\356\272\001\r\204\307\222.\311\225"
+	.ascii	"H\016\215\373\373*c\356\377\306\030\261\365\200\363N\006\214"
+	.ascii	"\bX\236\322\366<WuF(\371bm\260\f*\321\314\243\201\002C\326\332"
+	.ascii	"#\350\220\263Z6\362"
+	.string	"|\343\306^u\332\fV\310pe\225F\225\fy\212\005T@H\345\031\216"
+	.string	"XdO\324\003\356@\323\326\316\241\256\f\235\26348\022\316 \301f.\"\244\203?2\332\230\351\037\256^'\316m\334\375\217M\357\235\032\311LC\337\023\340h\327c\2277\230GD\0175h\031\363\3561\033#e\276\006/\276("
+	.ascii	"\\\204EK\375\3560\376\323\366\307r\271\253A"
+	.string	"\r\276\036Cw\227N\201\311\200D\254@\216\327\347J\360\323*\313@\203\334\254H\207\355\001\273\241\"\203/\275\310\276\345r\232\006\361P\004Lq\306\277\373\347\177\243\252r\fQ\244n\271\245\312\2270\201]c\330S*\377\017\206vFi\242\360|\faa{\243\272\233\225\246\353\226\\95M\004\241(\303:S\245\334\343u\222-\bT\3217\205\302\354L\314\274\374\251,t\263\264/\347\314\306~\020V\250\223\335\261\347\354\006\261D\307\b/\325\224\334\216\030y\340$\301\320\321\265\350\367p\177\321\237P1\271q\360\242i\201;mH\320\310*?j\tB|\027\350\031;Z\356Bvi\271\366@,\221\317\342\273\342\274\020^\201\030\353K\006\212*\0030\301\2401_\356\375\206(@1\256\035\375\013\322\225\231'\313Y+\262\232\222A\331:\3748Jy\021\217m-\320fug\336@_<^\0166\300j\304"
+	.string	"\364\226\271_28`\306\261\205\367W}M-\273\\\217b\002\214\366[\335\231\317\214\250\316\332lMc)Fh\314\271S0C\372\fl\352\372\0166@\016\204L\266\003-B\357gp\213\315p\026\326\021u\361\255\303U\247m&\236\331\277w\332\274k\204&S\217\004\222\340!\017S\2124Lt\313\304\365\341\017ytH_\360\201@\260\370\202\346\257\251\003s\335\221\301\354\023\232\247\032\003\321rpV\265\006\236\230\023U_\354\363\036;\341X\266ag\033C\330Y\323\2050\263\357N\034\300\r+\312nY\263\244\226\321+\271\325\370\333F\251\244\307\314o\245\303R\210Lx\306\271n1A\3538\351\216S\226\354\2357C\323\330Z\306\235c"
+	.string	"YS\376\254{\341\227\204\373\035P\260\367j\210.C\324R\001\t\311\374>)\275\021\037~\342\353\212\215!gk\013\314&\345U\030"
+	.string	"\252\261\331x\257\255S\001A\257\325{h\322\330\020\201\243\202\354\317H\372JVDp\0070\026Y\252\032\037\3057\033M\016\337[\013\206/C\346\365\332\344\363\223G0\323/0D\334\2772Z\206\306\303\0022\3473\306\335\340\b\321#\205?!\277\272f\210\224\177\352\004\246[\365[\203\341\006\3736\342\236\026n,V\334\205\220\331\315\201Fo\302V<\220\272\245\241\322\264\n\300\352@CbDdt2'W\035\314,cq\371A|[t\362\023\301\035\340\302t\213@\037\311?f>\300u\276\270\261\240\357\237q\376/a\342`90c\261\317\331\215yz\203\\"
+	.string	"\24650\024\331\376\306"
+	.string	"\243\217\363e \035h\004\342\033}\222\033\247o\034\274\366\021\006yv\001pW,"
+	.ascii	"7\315l\261\206}\261\203\036D\342\035\326(F\351\357\253(IC\027"
+	.ascii	"\274\374\f\312\250z\374_\005\022\270\262\267\034s\027K\351K\221"
+	.ascii	"\271K\372(U\323C\276\0262\003#\256GX\311\244\237\033F\365\317"
+	.ascii	"\244\272\007\255\246!\bi\375\\\357\272\224f0\346Q\025\317\365"
+	.ascii	"\316\026f\342\265\230=z\027\r\364\234\345U\334@\020g\354\007"
+	.ascii	"n\204;\252\367$S\360\314|\316on^\200\247\246\244\237\303\331"
+	.ascii	"+M[UX\313W'\314\375\271c\203\276`\337\264\244\277\037+71@\215"
+	.ascii	"[\263\024&\340A\016\315U@fIh]\340zV\201M\006\020\251U\313\362"
+	.ascii	"UiI\240\031\023\214\036\230\270\247A\306\025\240%\236\271b;j"
+	.ascii	"\037\335\204\234\025\200\366\240;\240~\203q2z\341{\236\321\264"
+	.ascii	"\322E\257\312\210.\232\033\203\013\301\211\252\213\306>\323'"
+	.ascii	";\315\251 \212\242j\002jT\004\305\310\326\r\306\241x\247\032"
+	.ascii	"\245\306\351Si\342P\261\256\340\005\227\240\236\257\357\315a"
+	.ascii	"k3]\251\336\013qH[\"\240Cf\222a\013\340\211\006\315\326\f\016"
+	.ascii	">6hH;\323=\323\360\fB\352=\365`\\\327\005\007#g\230#\370:\370"
+	.ascii	"a\345\337oD\227\346Ju\215\256(\023\005\263\345\313}\346{\204"
+	.ascii	"B\271 \346\034f\246\277\242\304\374.\224\331\361\273\305=\333"
+	.ascii	"\300gi4\373{\024\255\311\353\210\013\353\347D&\271w\246dq\n\273"
+	.string	"a\307\226\237\247c\2527pn\303\214\253\356\f\316b\222d\221_I\222\034\272'\353\370\177\337p/e\002\355a\333\021f\243\005\253a\214\034\264H\3028\027\265\244\355\363\023\231\320\220\245f0=\267cF\343\321\246\031LoT?\366\322Ay\300\306^'\021\367\213\306\365\252\025N\214FM\027\t.%%\241|\242\332>\233W;\377\t\022\215\r\367/\302\226\316h\r[ n{\267\035]\346\020\245\343@\022\235[\366k\263\204\030\2317\372\271\246\376\347h\377\257o\274\304\363-\251\036\324|\242\210\003\343\355\261\310G\301\374\001\326\355\3118\031b\203:\225W\330\372\t\303\021S{\002:To-\375p\036\033\207j\231+\231'\233\210\\N\206\220\256\274\332\257\341\266\306\341'\341=:\177\030\215\273t~\377\b\367\314\332\275*\234\254,eS\272\333H\317\\/r\034\314\236\267\361\3351\005Si\235M\327M"
+	.ascii	"x\3412+fT\001\364&\tO\312\177\324b\377\314\270\016\333O\035\257"
+	.ascii	"\303\375\205w[\200\370\027\330\377W\3400\342\231{\025\034\267"
+	.ascii	"\205\277\024\317\341\377\030P\033\017\330B\366\016\3419\202\036"
+	.ascii	"m\230\201\321Q\247\313\215\302\372W"
+	.string	"\005vT\264s\270\343\275\226\262\304\365C\017\222\356{\301\253e\370\247\265K\374\352s\3049\263\301\2331w\325\030\227\367\373\334\272\002\344\230\332\255\237{\017@7\"\334\323S\307\234w\355\360/\031w\006\334\352\274\314\016\017s\236r\332\035\322\0244\257Z\2169<m\336\315\370P\031t\266w*rM\274\323\331\t\373\033\230\035\315\357\017N<\231\340:\340=\016\341\366\366\360\362Y\030P\034h\276\271_\301|\236\345\267\336\303e\177\305H\227O\3528{\247\214~\365\340^\001\277\0226<\376\243\037\247\270.\345\374\3125\035Oh\320;F\331)^\375=\211\007\034\006\245\223u\263\3346\360\373.\364'\231\315\216Z(\342y\346\217\001\026\204\277*\344\307\303:\005Y\363\350\277#?+k\234\214\277\n\374Y\231\353(~(o\304\346\r\252\275`;\220W\270\3543\316\267\220*\314\215\257\033\347\017D\335\326\203\335"
+	.ascii	"\207\304\235\321\360G\261;\361\270\372r\237\200_V\226\374\333"
+	.ascii	"X#\177\007G\330==\264\363\260\246t4\365\200\200\351X\352%G\036"
+	.ascii	"\021\375\336\377\030\315\327\352\204Y\272\345\032\352O\n\331"
+	.ascii	"\305\033\3252\024D\"N`&\265\201M\341\350\367T\360\201\361\206"
+	.ascii	"\210\265\205\031\024\350\\\204\247+"
+	.text
+	.section	.gnu.lto_.symtab.edb0efa283525169,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"applyQuickRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"applyActualRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"getShouldUpdateFeedforward"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"getRcCommandDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"rcCommandDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"getRxRateValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"calcAutoSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"pidUpdateFeedforwardLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"pidInitFeedforwardLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"pt3FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"pt3FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"pt3FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"pt3FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.edb0efa283525169,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1304 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\256\002=\t"
+	.string	"$\n\242\003"
+	.string	"\022"
+	.string	"\225\245\355k\036\002"
+	.string	"\001\003\004\005\002\005\001\353\252\315\223\t\002\240\342\234\212\n\003\004\354\275\370\376\b\005\006\007\243\274\344\244\007\b\002\006\002\007\002"
+	.string	"\002\007\002\b\002\007\b\350\341\246\220\003\236\001\002\006\002\t\n\013\002\013\002\006\002\f\r\002\f\013\353\331\250\210\004(\016\002\017\002\r\002\020\002"
+	.string	"\002"
+	.string	"\016\202\252\371\351\006r\r\r\017\367\203\242i\020\257\321\235\323\f*\006\002\021\002\022\001\022"
+	.string	"\002"
+	.string	"\022\205\226\226\236\t\002\023\206\271\335\257\r\024\313\331\240\372\b\025\321\316\352\310\n\026\240\342\234\212\n"
+	.string	"= p\202c3\252\016H1\005\336\n0+\201v"
+	.string	"\3631\263\314?d\005\025\261\344\200n"
+	.string	"\035\223\301\273l\226(@)\f\252\2624\317\246\221{\004\252H\340\002\002\376\232\320\306\006\027\b\275\023 s\215\205\201C\026\226`\001\020\204\177\022\033p\353\205m"
+	.ascii	"\f~g\240t\315*\206\031\303\03682\017\004p\016\016\3768\201uM"
+	.ascii	"\236y7\323n!6q\212\221\357\206|\221\350\315\335\024\013@\276"
+	.ascii	"\231Oq\207"
+	.text
+	.section	.gnu.lto_.ipa_sra.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"E\003"
+	.string	"\344\002-\001"
+	.string	"\t"
+	.string	""
+	.string	"\001"
+	.string	"\001\007\002\001"
+	.string	"\001\b\003\003\013\002"
+	.string	"\020"
+	.string	"\007\001\003\001\200\004\001"
+	.string	""
+	.string	"\b\016\017"
+	.string	"\020\001"
+	.string	"\022\001\002\b\023"
+	.string	"\001"
+	.string	"\027"
+	.string	"X\f \263\302\225\271\341\252\214\255\035\0013\340\017"
+	.ascii	"\003[\2232\bM\320n@\022\034\345Va\t\f\302`\327+\253\312\031\330"
+	.ascii	"\334\003+\300|\372\346\353\230kh`\b"
+	.text
+	.section	.gnu.lto_.inline.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\301\n\r#"
+	.string	"\006k\215H\340\360&\035\360`\201WG\217\013\352\017\nb\362\001\222\246\225\365\221\230\n\226bO\343\255\314\244 \364J\202\364\300`\016q\371\037\3751\023\25528x\\\bDP\207\006\201\013EvF\363\331\023\255\3556\201\374\275\223L\001{"
+	.string	"u"
+	.string	"z"
+	.string	"RD\262\021Y/\262V\253\241\330l\b\037w\267\002\212\355\0258!0@@"
+	.string	""
+	.ascii	"\256\022\222\026k\244\023Y\205\244P \334\307\3461\345U\031l%"
+	.ascii	"\257Q\373\200\222\\\302O\2542'!tB\306_\230S\333*i\307\344\356"
+	.ascii	"\356v\333\255k\314\305\335\005Q}\240T-m\207L[\355\025Q\332\272"
+	.ascii	"\362\270\037\373\356\342l6\215\314\320#\264\243\340\266F\220"
+	.ascii	":N\034\210"
+	.string	"\020\240\f\342\024P*\222\\\344\224W\304\324;or\257\260\363\276\257\210\366UTTvg~\267;\033u\334\025\375oW\364\354y\276g\271\243\313A#\035>+_\312\035\037\\\307E\216\275u\307Q\327\352k\n\270N\001=\301W\270~\205\346B\2538s7\353\326\235\267\366\276\365w\023E)\232V\376Y\236t\223\263\367\026n.o\301\302\211\210\345\207\017m\314\030\362q\2313\327\022\235\337u\356h,j\035i-\362&\250\251)\345\1774\232?Z\313\207\236\230v\210\370\237\377}\376\314\222]\266\276\314\234\003\335\205\245,\245\202\n\356\316\271sw)\240\330\312\244-\257\301\326z\215\236<\20186\317\361\312w\3104J9k\352\2349\231\217\330\240\003\343\345\3160\222\b\307\022\317\274\260\3313G\252\001\031%\230\266]\327#u}\202.\330\\\257QiIs\032\037\002~\371cr\272e\033\006u\363\224"
+	.ascii	"Qc\304,\225\224\236\221!\226z\210T\304\275\302\307\303\217\225"
+	.ascii	"\334y\252\254r\2213\fK9\323\323\363\204}\350\250\026tO\317\227"
+	.ascii	"\353(\355\214\250\330o$\305Hr\231\363\314\265\334h\307\350'v"
+	.ascii	"U\270\331\026vWf\227\\\325\304\323\032\363\016\243\206\033\003"
+	.ascii	"\026\t\273\313X2\256\363TA\t\316\371\333d7\344\304\335}"
+	.string	"\b\203\301vg\236\347\355\316\002\201L\250\301\271\"\022\021I\nR\220\264\006\201\005FA\305\220\215\017\022`\345D\007S\211n\223a\377?\003\216\327\031\234\214\257\230\304\036/i\265(d\304\337%D\177\304\265\222\246\3628\253\013\335P\311\265\026\2048f\026\251\326\257\366\353\272Nu\237\035^\367\025\205j\232_\234e\237\250T\275\222\236\0274U`R\223\347\275ai\223\004$~\372\326O\363$\302@sj\243\022\264k\331\344\t\332\360!\252(\027\313\365f\324D\232\370\242\306\225\214\237\026Y5p\0338\233\025\212\220\376\007fr\225v\274c\016J]\322z\037\244J\233}\001\032\265$(\365\251\322$\260\346\342\353\363\365p\364B\350\371P}\371\266\374Ht\313w\330]\bPx9#\331/\214|08\2421h?\222H\303\250'G\275\325\214\373\210\341\356\b\243\375\363\310B\373\0050\303j)\021\323F"
+	.string	"<j\236\263\002OPY\303%\226\354-\003r\267'>\032d4\313\262c?1\313\247\017\324\361QY\377y-\252\025d\221C\333~V\007\025\356\252X\202\335\025:0\273C\205cu\254`\227\212\035\314.\241\303Yq\tX\213\214\247\352\263\306c\037\347{\221\250\350\222\243\372\340\241\231F\271\0378Ga\362\230])%\bG\211s6\025\tM&\230c2\343\t\361\352\0024V\277\341\353\031\271\327\"\241F\"&\364\3450\0248TD3\2628H\203\252\344]\216\2337\032\006o\245\206\334X\325s\200\217\243AmCZ\217\3003Q5H\376d\203P:\275\025c<1\372J\036\210\341KV:<\357\034G\362\261e\272#\315 \322F\374\301\320<\316h\004\221\265\365\337LZ\275\251\253\304\243\216\365\240y\3201\016\226A\022\316\302\373\247\255\360"
+	.ascii	"\346\036\273J\003$H\302f\033U\327\002\323\260\374\320\3249\026"
+	.ascii	"\274\f\307\316\344q\355k=Z\356\321r\217\226{\264\334\243\345"
+	.ascii	"\036-\367h\271G\313=Q\247\276@\261I\274H\245\247Ep\343g\177\030"
+	.ascii	"\252\271\352\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\304\007\305\020"
+	.string	"\346\323D;Pg\234\30603\021\205axc\303\033\033\236\231\215\rF\250j\362QMfff\306F\210\313\314Lg\006\006\266\330\252\032()\003\376\321O\030\324$K\3136*\375\330\270\211L2-"
+	.string	"5"
+	.string	"4"
+	.string	"\373\\\345\366\255\252\035\342Bng\266S\376&\350\025\257\352\232\247i\205\020w\212\237x\316\211\317\211\273v\026z:\364V\215\252*\351C\"\030v]Y\026\211h\232$=M\177\246\250\277\267\355r\031c\fF\2024\3572\223\321\bk(n\276%\222\037\342Bm\347\266S\332\271\360G\017\210\275!\316\320\005\013\267\215\213\006&\343\314\305[\234Y:\267\023\261\317\277'\234\253\260\365K\355\226\370\226\270G\357d\262\351:O)\024o\255T\3664\212\252\312\262<\016\207\224\001\252\232\351p\245\335}\354\017\312\357\373\244\2754\020\b\307=\330\344\304A\327`Ca\340i%\264F\013*\005V\002\217\003\201\004a\007.\003Y\201\b\001m\200$\340\363\024\3403\005\340\200\265\250\261\2707R\220\242J\2411@C)Iu\021\2208k\220ADD\002\214#e\032\316\001\f\002"
+	.string	"\210\251\246\203C\226\236@\177\345\002\373Q\245\br\254\366\305\273\237\324q\204\250\257E\257\211\244*\006\bI\354\230(8M\276\002\307\360\026\036\3261\331\f\037\215\350\225l18\234S\370\226\255\200\256\037\036\365\365\300\345\201\276\316\236\353\332=>1"
+	.ascii	"qN\237\313\001\b\026\275H\206\227E|\354eg\364\270%\344n\335\314"
+	.ascii	"\320\004\366\242w\364\3007\205\365\356\215\303\034\255\302\342"
+	.ascii	"\317\305\022\341@\307E\334\252\304R\002\256@-\211\036\2302L]"
+	.ascii	"\342\b\346#\367j\263\177M\202M\320 \212S\b\326+u\276\275\222"
+	.ascii	")'5zPS'1B\340\274s\305\005n\346\310\266\303n\177s\270tvd\346"
+	.ascii	"5*v\333u\236\322@OAt!\305\262\004\030\361\327\215\375\255\245"
+	.ascii	"\341\177\262k,\307\220\236I\275\227\024"
+	.text
+	.section	.gnu.lto_.pureconst.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\007\230\004\b\232\004\013\232\004\016\232\004\017\232"
+	.ascii	"\004\020\232\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\r\007"
+	.string	"\202\213$+pK3\034\220u\256\372\213\365\364\340"
+	.string	"\305\001\340@\016\374\321\037\254\001\305O\017\212>\327\377\337\t\351\032\252V\320^\322\254\335R\246W\020\330C\344\352\252.\314Aq^8\236\204\305G\366*~\213\003\245\360\240\312\251N\006\205\002\263\005\264\2435\316\306\233xo.\224+t&\224#$\177\222a\025\340\373<\350d\312\231N\203:\347\346\220[c\336\340\240y{^P\310\021\315\255\020d\027\317\251|\352\224\312\245\266\347S\376tF\345Q\373r\363\304\b\037"
+	.string	"@\005X\030\366D}\320Yvz\016\273\205\252\013\250\366\001<\300\007\0230\366\335\221\221I\335}L\033\200\017\253\305\fF\232\3028\203\231\321U\t\353\214X[\230\027\031\t"
+	.string	"S>T\020\372T\024\2602\334k[>\200\3250"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.54edad667d409e45,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.74.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\b^"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\306\321\035\006yw\250\306\006yu"
+	.string	"\005\001\006'\001\254\002\005\001\006\035\001\036\245\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.81.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.82.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`62-\217"
+	.string	"\312\344(2H \216[\031\016oE\033\224\206d\317\t*\364\243\352n\001\320\035x\313~\373UWH\242\321N\332D"
+	.string	"\243\341\274\004"
+	.string	"P\367\261\265\273V\234\335q\307\331W\347\334\033\221\212\025\252\213\204\354\351"
+	.string	"\233\204\201\220\275w\222R\006\027\003\306\002\034\0031\212\2750\324\336\027\357u\361\336\246\367\266P{Y\024{W\250\275*\336\233\342\275Lj/\n\265\367\304{\227\336kB\355-\241\366\222x\357\210\367\212P{C\250\275J\357\005\361\336\017j\257\007\2657\351\275H\357=R{;\250\275F\357\345\360\336\"\265w\203\332\253\341\275\306\367\026\325^U\355M\337\213\276\367jo3\"\023v}D\356\254+Xb\242\225/\245#\206\233\314\273\234\246\327\266B^\333\331\237\025?3\301\302*~\n\307\f\245P\250M,\021\030aa\024*\211m_r\210m]s\205\\\315\302'qZI\327Y\316D\273\303\275\031\364\f\377\332\016\371\265\031\032\224ApP\241\302@\201\n\007\017\333"
+	.ascii	"%j\013\034K,\364\303D,\374k\266\361a\266\365\301)\3243W\250'"
+	.ascii	"'O\034<;w\234N=mu\366\332\352\376\344\370\301a\272&\354fO&\330"
+	.ascii	"d\267\b\006~\263[\264$\260\233M\233~\212H\330-\342\364i7\271"
+	.ascii	"<\267E\273\333\\\2471+\314\330\354\002F\320\272\256N\234\356"
+	.ascii	"\321\370f\271u\242H\253\226\226\2739\353\272B\355\003\357\335"
+	.ascii	"\0328\222\334\006\311H\253\222\317Z\020\356]^\303oI\2063\201"
+	.ascii	"\223\326u\313\340\234u\205\203\332(#\247\013g\334\335e7N\223"
+	.ascii	"\334u\242pkb\305\256.\\\314\302u]\245R\260\222\312)\312\037T"
+	.ascii	"N\317\002'y\347\266\271\314\225\333\270m\263l\026\016\b\325\017"
+	.ascii	"\037=x\354\320\221c\n\307\r\0335h\314\220\212\202zr\222\021\003"
+	.ascii	"\306\013\027M-X\254P\221\202\t\305\211%\023%H\214\020\021B\t"
+	.ascii	"\304\007\017IHG\035\2148\024m\320`,\252)\372N.\267=\345x\211"
+	.ascii	"e\361\3165\245\3602\245\320E\351\225\213\373\342m\363U\347\325"
+	.ascii	"\313f\341P*Y\264\240\300@\226\262(Qp&6\025\342\217C\366q\210"
+	.ascii	"\227\250{\360@\304;\020\351\031\266\216\034\201x*P\337\263q\334"
+	.ascii	"\020d\033\202\374\007\250k\320\b\344\031\201\201\200-\025\265"
+	.ascii	"\307P{\203z\375\224\347\224\207e\344\341Ax:\006\214;~q\307\206"
+	.ascii	"\344\264\2138Mt\334\202\216\r\3414\213\025oX\305\033>\204\241"
+	.ascii	"S\270azc\024oYk\372\304R\0326\221\346\211[\227 \261\344\021\313"
+	.ascii	"\256\266\026!"
+	.string	"&D\030V\n\023\245\205\006\361\341\013{\370\"\346\245\223\220\326\370hml\205\356\200ft\306\034\316\314\256t\021\0130\336\240\"\313\024\025X\003\357\tS\341\214U\270\020f\326FT\006Z\036\025\336\023V\206*\241dY\224`]\254\302**CP\035a\0071.T\t,\214W\247mu\332\205\210V\006e\206\302\2748n\304\f\376\321\203\027\203\0324`\272p\2260+\033\304\236\250\355G\226\006\"\213\022L\004J\205\217\226@\313\243\322AL\2116\365i\021\3449\356/1\255\356b\220u]\267\275\304\246\360\026\300\273i\226\335-a\027\212C\273\031T5{U\251\234\362\326\227R\266\240\251Y\223\376\020\331\224\350\004{\021r\302\345\351y\216\235\354\362\342\374\314=1\013:s\371\366\026!'\242gA\357\025\030E\363\005p\311B\263\220\262\023\367\204\377\350\373o\013M\371\377\206\270\020\235t\342S\033\"\251"
+	.ascii	"\327u\325\261k\325\205F\214\353\272Nq\272}\310\204=\036L\255"
+	.ascii	"\2011A\345\264\177d\227\267\244\343\244\023\267\325\330C\036"
+	.ascii	"_V\037n\2104\027PH\257\266\375'\34613\335\274N\265\311\277Z\206"
+	.ascii	"\355B)\334\b\332\036\264OU\217\351\271O\325\356\016\005\240m"
+	.ascii	"\301}\242\201\356\226\002\367\211\372)3\301H\265\317\266\237"
+	.ascii	"}\242~e%\374\366\211\336\271#\301H\265o{\217\2108{\333zB\254"
+	.ascii	"\345\331\316S\2622f\305r\267\215\267\317\364\320\035\b\347\266"
+	.ascii	"\235}\246\202e\037\350l\327\331g\232w\347a\316>\323@eI\214T\343"
+	.ascii	"\3543\325\203\304H\025\316>S9G\214Ta\330~\263\317\264Y\326an"
+	.ascii	"\237\350\341\235\021#U\271mf\221\0246\333m6D\351Z\263\375\246"
+	.ascii	"!\221\333v\032\243^\333\366\262\270\206m\333\214\212\346\302"
+	.ascii	"v\231\364\313L\314\366\030\024\021\230\355\026.\330e\333K\323"
+	.ascii	"\215Y\261p\331fa\237Ff\244\312\351\266\327\332\025fL?\325g\331"
+	.ascii	"\272f1\332>\333k\215\301)+\337_\300\254o\215\270E\335\344\273"
+	.ascii	"!$i\366\332\024Z\317B"
+	.string	"\321\2535\327\031\352\303\362oY'>\341\251\232\230\270=\255F\264\013\247\354\253\3552\272~\313\256\240\247\340\037\300>~{\370\366\362\360\334\331q\276\255Q\223\306\r\315\262\355\214\031\2662c\274\254qQ\323\222\206\005\355\212\025\263*cT\246\204\2011\0343K\201\362\365^\356z/s\251\275\274\365^\326\3426\314\254|/\257\357M\262\034\363\t\357m\302M^,\265\227\311{\227\274w\204\367\212\240\366^\025{\225\030{\223\274\027\311{Cx/\b\306\336#\305\336\017\214\275\036\274\267\203\367\032y/\007\306^\253b\357\006\306\336\252\367j\360\336\f\336\213\201\261\367\202b\257\005jo\005\357\245\340\275G\265w\002\265W\202\367\026yo\004\357\205@\355}\240\330\353\200\332\333\300{\031x\357\002\357U@\355M\240\330\213\200\332{\300{\211\274\327\200\367\026\240\366\022P\354\035@\355\025\340\275C\336+\344\275\001\250\275"
+	.ascii	"\024{\203\250\275@\336K\365\336\037\357\365\241\366\366(\366"
+	.ascii	"\362P{w\274W\307{s\274wJ\355\305Q\354\275\241\366\332xo\215\367"
+	.ascii	"\322x\357\f\265W\252\330\033\245\366B\275\367\351\275N\357\225"
+	.ascii	"\241\366\006\203d\230\031\264G\364\354\212\231\363  W\0015C\313"
+	.ascii	"\274\270\016\244\220\222\353\307\371\356\034\310\307\177\364"
+	.ascii	"\270\2172(\031:\206R\361\352\201N\341q#f C4nsb\300\350\372\007"
+	.ascii	"C/\330"
+	.string	"\f\355\021\225\202Fa;\033\332\361/\324\013\355\"\353\372\216AeW\2163\236\263\fS\317\201\343Sl(\027\272\205>!\303\201*o\334\210)hh\347\202\216P_\023\224#\261a\2132l\270\307'\"\2269\033\332x\"$\324\f\210\262@\271\r\247\037\024\032\347\274\363\241\031\247!\365\031l/<D\230E\252P\324\215\230~\313\2623g\370X\254\b\273\007>T1\206\017\367xA\201\306\234\017\241\006\221O\202\311%\023\240\260C91\365\342\302\360\260\323y\357<\203\214;\305\270\214@$3\001\001\375\204\211qf\006\376\301\270\021SoYV\227\"\006@YLS~\224\205\302K\326\036\337\307\347\345\235\365\342{H(\275\344\222)\357\205\323.n\n\273i:\363\235\023[\274\211\305[$\317\034\017\311\315\265\273\344\322G\322\355w\222jn'\211&\3716\202\312)\213s\263\313\032'\257s\273\021\226\301,"
+	.ascii	"B\204\250\234\256\270\021\323nY\366B\031\276\023KcO\237\230X"
+	.ascii	"{\262\307\313\211\263\366~\242\342pb\030\273\n5\272\270=\347"
+	.ascii	"\261\024\347=o%\323S\2408S\023\036\0067(~\304F\267\244C\246L"
+	.ascii	"X\t\022U\336\241k\204Z\327\036/\027\247\366\356:q6pU~"
+	.ascii	"\202mN\351w\256\262t\366{s\231\370R\211\233X\203\374\241\246"
+	.ascii	"\304\217\330\232nD4\337B\230\335(\212\022\226({\374\262\r\313"
+	.ascii	";\n\211\233A\266`#!\207\330\347l6\342\334\347\375%\342#B\\D\031"
+	.ascii	"\344\017\001\356B\210\037\275\200\270\244\023f\005, >\\\371\305"
+	.ascii	"<X\021\333\343\303\264 \266\324\273\006\034\300\241\216\036>"
+	.ascii	"\345\263V\351^\256\\)\206\335!%\340\371\n\2103\340\033\354\303"
+	.ascii	"Ax\370\207\004\276\2064z\270\221\034\241\341\232/gpIHh_\032;"
+	.ascii	"\2422\266\307o\3212\226\3644,Iv\205\342\376\234\321\236\002#"
+	.ascii	"\235\377\274S8:R\207\037\241!\251\316:\374H\256\320\362O\007"
+	.ascii	"@3l\214\322n\302\214\003\230\331\036oV\006\36663:\031\262i,\355"
+	.ascii	"Fr\202J'f\301s\332\372q8\013\276\253\024\235\303\206\027=}\n"
+	.ascii	"\222jm\201\213m\370\221\234\037C:N\326\230\3478"
+	.string	"\002\2639\206\202\262\372\260\350j\033\264\274\304\031\2072Bz4\\\355N\230\277\316\366\370(P\3164\334\353]\032\374\376\224\317\263\226F\304\306\363\363m\245x\243\372\"\324\271\220T\337\232R\177d\347gH\307\311\037s\013C\3049\306\253-\037fe\322\2360}2\360\t\324jDE\021\315\\N\202\037P\267\323\"\220 }\326\026\301p\331\242^m\271\002\225\267\276A\334\237N\333\343\263*0\256\253\326\324v\342\327\013\002\373A\024\223\017\260\252\222H)\271J\222\344\312\252\204\221&H\252\212\220`D\211\261\n\013\211\021\016R%WG\260\254\2244\031\300\203\007G:Pr%\304\bV\225\003H\256\226`)\271\262JZ\253(&XJ\214$\301b\322\004\004\016\2522\260Z\"e\325\201\224\222#UI\244\254\2260\221\212b\332+\021\214,\221\302\272\272Z\"U\004\347\204\277e\271K\236=4\212\031\217p"
+	.string	"$g<2!\032\234\3574\203\0249;\271\374 r\256\323\3441\344\\G\230C\307\271\216\313\215\247\363\233\035\032\274\236\337\266\242X\353\354F\350\304\\g72\030\334u^n51\224\363\031.+8\354\314\266\305\304S\316e\270,\361\330\231\214\035\022\\\345\274B3\004\233\235\317\354|\340+\347\263-$3B#N;\233\221m`-g2U\244\024\231\313\261\376\265\273X\306Aza\206\202\234\\\271\255\2057\310\023\023\023\335\b\030"
+	.ascii	"\311E\320\t\360F\267\307\364\354\312\333\231\216\311U@r&Pf\004"
+	.ascii	"\225\316#\031\341\354<\277\021\341#\\]\204\026\3222\2441K\362"
+	.ascii	"\315xu\r)\231\222\027\021\3721\344\303\343\033\"D\203\247\250"
+	.ascii	"\013`M\335\036\323)bk\316uI\016\226$\363\264&%\215\022F\203'"
+	.ascii	"1\363\247\\r\rB\370\222\263\034\020\036\302\221\203\220~%\311"
+	.ascii	"P\001\246^iW\230#\247J\271>x\021\241\237a\031!\274\025\200 E"
+	.ascii	"\316\344\004\242\306\271\307T\231:Qsvz\360tM\222y\002LDDS\344"
+	.ascii	"\0364\367:x\021t\220\215\274\203s\035\016n\304\352\034$J\222"
+	.ascii	"\001\2626\003\"4V\007\322\245p\203\027\021\356\005\242\032\344"
+	.ascii	"\363\345\007\221\243\300\363\221\006o\217h!\031"
+	.string	"\322\234\361\252>(I\006jMP\240&\221W\331q2p\"Gs28\003\347;\030<\203\013\216\301Y\f*\230$\003\004\020Pr9\265\366\247\231|\223\002\274\340@\002Q@\013^D\350\\\226\3519\327\036<\206\\Io\207\233\336\036Q?>ng\275\n\336\207l\342\033\362\n\232q\342\250>\204\202S\235\363\034O\301\004?\242{H*+To\202\037\331\211\263\244\203\247\316\030\0359t\274\250o\nM\337\036Q\274;4\347>\tn\307i\207G\307%\200\243\254q\035\021\274\306Y\017\004\217\340\201C@\247n\016\236\007\3428p\243\346\234a\034\037\216\033O\337\360gc\371\267G\364\r\f\313\363_\003\237k2\373<\275\0013\3148\027\177Z\340.\316|\024\370\002\t\\\201\2706l\372$\360\206\300\215\232\314%\\]X\r\032\3535\004\316h\013\334#\352\206\246\355\034x\300\333\220Og\314\020Z\177"
+	.string	"[\2422y^\rx\362\354\247\200\033@\300\013@_@2s\r-\343\302\t\204\b83\307\fp#&\242\23278\251(\255\203\030\204:3\270G\024\314\2273\347A\001\336\005\371\264\226\\2\261\240u\001\230\211\342\264\204\234\355\234\001\005p!"
+	.string	"<"
+	.string	"5t\013\252\345\004D"
+	.ascii	"\320\264 7b&\272\363$\007\021\033'\256'q\203\360\250r\2209\225"
+	.ascii	"2\245dDD$IA*i\f\342\r\b1\3100\211\254\016\022@\0221\b\307\201"
+	.ascii	"R*\007EHS\250\321\030\\\037\216'\263\274h\207\331\220\\\\\213"
+	.ascii	"\361h\013\207x\2670|\t\245Z\257\317(\321\217\206X\265~3c\330"
+	.ascii	"\033\005\370J\256\325\222\221\032\303\253\034\203\236P:\230\023"
+	.ascii	"A>\302\026\241&\235y\347\211o=l+f\307/\314R!\374\020\335\373"
+	.ascii	"\305\307U\226\026\254\240\313J<\303\3701\345b\225\374~\f\032"
+	.ascii	"\237N,\035\r\325\333\3425G\204\307'j\006\022\243\312\232n[\006"
+	.ascii	"\345\347\227Ne\357\205\314\0254\250\214I\f=(\244Ma~\330\207\030"
+	.ascii	"\027z\206\365\350t8\257~\205S\177\213\310\261vF\032\374\037\331"
+	.ascii	"C\321\023H\343<\306\353[\247V?\031W\374B\304\266\\\267\371\301"
+	.ascii	"\004t:\ff\323\214\3241^\355\006$\362\305\210\202v=\002^\304\333"
+	.ascii	"\210t\022\234v\213$\320\363C<\fUL?nt\245vcP\217\370\353U\230"
+	.ascii	"\312[\304\310\027\213a\261^\373\256.D $\211LF\005Yz\344\0011"
+	.ascii	"\271\205Q\021\325\2728\305\271\177I\274t\2611\266\263M\354\210"
+	.ascii	")6\370\305]+\3244FER\362J\006\260'\021\315i\352>\262\244S\275"
+	.ascii	"\212v\361\346\214L\232x\340'\302\276\212p\320\2200\270\220#\302"
+	.ascii	"|\r\267ES\235w\342O`^\374~NF\376RMR\301n^\256q\372\224\332\306"
+	.ascii	"\302\210chL\223\310\016\347\346M`\220g\002s\2163\261\007\016"
+	.ascii	")[\363"
+	.string	"\006jO\020\257^O\273\bS3\206\035\371\001q\3566;\211\262WA\237y\r^GG{\032Z\376\301GVg\310:\355o\222\324`'\220e\214~\303\033\033\203hT\301_|&\327\351\2231\313[\212\027+h\347uD\030\371b\r\236\rg\374\035\357\\\235\301\212\305\031<\324\235&\177\367\030\213\203\3022\220\361\305\255\252K\377\357\177=\210L\353\032\201\320\346,\200\372\331$\203\232\213\261\265'\006\017\330\224\203\025\254^\277\332\240'S\027\322\273\302\340\003\212\303`\006\255DWy\021\255\346\310\235%n\002\346\221\206\361\024\201\335\177&+\214\252\277\277v\305(\214\323y\234C\201p\217\324\371\204\0305nT8\022F\235\354y\013\223]4\225,;\313 \333\363\"b\357W)K\024\020\262-\232\360\004\036p\210(E\026a\237&\246\351Dg\227R\213\275\244Z\275\2046+\346a@\240\ne\242\254\016"
+	.string	"\212b\332Y5k4\216\205\005\214;\275\277)0\213`u\007\247\3666\211\003\353 8_x\223\326\217\202\036\243\220:"
+	.string	"(\0224N\360\"\320\344+]\352\225\2063>J\252Npb\325\326\243y<\2218k\232\270\026g\200\321\216\202r\034"
+	.ascii	"-\")\001\212\252\376(Y\252\272\324\255giD\025\271\273_)"
+	.string	"b\025\352,\033\207\t\002\236\200R\252\307,t\221-\312A\024O5J\321\030\251\334\246\274nD\225\354\332W\321\231\3063\212\241T\322C2B\251\"t\211\264\312\252%\021Ud7eg\317x^3\227u9\213.\177\264X\264\310\304\200 `1\035&\214\034%:\352=\334\202\311,t<\326\213\005a\270k\215\220a\260\021\224\217\210"
+	.string	"\372F\272f=\311\037\217\232P\367\320\361UB\315ga.\346qD+\020\257l\241\\Q:`2s\216_i\200\375\216%\341\344\327h\362\023OCE\352\313\321\0014b~G\241\352\225\272"
+	.string	"\020,"
+	.string	"\371\312_\266CI&\206.w)6(\365\274c\274\362\345\243Q_)\337\246Y\276l\nz\031s.aM\2348H\207\246\340\2039\177\214C|Q\250\030Q\217\025\276\341\250\367\305\037\354'\304\334\357\371&\2023\235\006\b\rp\240\255m\317\300\356j\335z\r\265\327Y{l\265GP\377\352^=M\255O\346\3203D`\366R\306\351$\231\215\232\303\330\350\034\277\336\016\363\227\221p\031M0\357\343\271b*\326UN\204\255\314"
+	.ascii	"\303R\221\344\203\201^\273o1P\252l\326kp\316\320\225S\245]\253"
+	.ascii	">\017\272<\201*\342\270S\335\274\214!\022\004e\250\260\307;A"
+	.ascii	"\274+\362\272ZX\235\204\216\322<\314%\020,l=G\215jV\361\212\220"
+	.ascii	"A\260\360\250\377\2531\212\021d\323!\334>\235Z\347\250\306\240"
+	.ascii	"\b\355ko{\227y.\022g\260f\356@\223\235R\020'\314]\007\371\266"
+	.ascii	"b\f\r\006\232\231;\224\r\332K\266\025\036\263\007\005\026r\204"
+	.ascii	"O\206o=\333\004A\243\244O\333\f!\232\3254\234\\\"(? \356r\305"
+	.ascii	"\340%R\366[\003k\340cE\240r\233\234~\376q=$H[\354\357#\2742\257"
+	.ascii	"\332 w=\240\ni\241\224\276\313T\r\342A\"-\222\320_\221\354\221"
+	.ascii	"\007w\370\337\"\\Y\033I\337\377\006c=\270\320\266\340\240j4>"
+	.ascii	"=\257\275\301*\264\207\370|\306\0259\300&~\326\201=\ra\244\027"
+	.ascii	"\020u,\316g\204\347\340 \235\035\276\341\323\337\360\271,\376"
+	.ascii	"\177A\375\003\323\377\236\262\317\320\002"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.83.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\022(\365p"
+	.ascii	"\252\271\300(H NSI\007?\257\272\346Y\320\355[\352\217cY\361\356"
+	.ascii	"\356,~\373\210w\357\373G\327\345!\334\b\202\201\204\034\002\200"
+	.ascii	"\236\315\026\212\315\005e\372,(\241\374[\333\016\276\377\274"
+	.ascii	"-7\324\253\350g\n\341\023\255\355F\244\224)\237\002 \002\201"
+	.ascii	"\002|\256\374]7G\372\370m\r\242\250\225\304Gh\240\"\ni\226\271"
+	.ascii	"\373o\332\026\304&\030\346a\363K]\027\346\031\236e\bwK-zX\362"
+	.ascii	"\232f|V\376"
+	.string	",\311\b5\247\3645\305\004\227R\002\227Q\006\031,\345\257\302D\302\303\016!\321Q\261\016\321\220\331lD\327$\314\303\002\036Ez\313\301\274\245 \240&\"\276\246\241\277% \241\345\037`s\320\nM\277t\331'\270\344c\344g\220\217\262\321\236\302\274\271f\n\312\304&^]\036\246\335\3369Y;\177q\206\307\311\217d\302\336\371\221\336\301\332\371\217\263\273%\212\242H\035\374H[\214\372\275\276uG\372\317|\336\361\253\354\310<\223&BQ\224\305\026_\301\261\347\236\207J=\002\346\255\323ur@\241\2101\201\306\362\277p;\307k\343>X%\024]3\324\203\242qRoq\334\342\343\216\377\277r\266\004\257?\357\214k33\222\005J\241k\242(:Ub\231\352\026\317\365P\267\330d\326kO\367\271\313\275\316\351<\016\201\253\003\f\260\232Q@\225\214\030T\004\300x1\200\213\251\026RQ,V\250\020 "
+	.string	""
+	.string	"R\240\200:a\242\304\023\211\021\"B85!A|`Z\362\320A\211\303\206$\r\031\2200\\8\032k\361l\366\372n\335\342"
+	.string	"\343\0028f\366\265\247\233\243\262\227\243r7\205_\347t\316,jb\304\366q\"\324\300\304\360@`\004\256\020\367"
+	.string	"\304\274C6\340\221\225\243\235\341\210O\013\\@Use4\371\0069\006\225\340\022 \350\027\3100^\034\332\001\016\355\237!v1\325\267-\372\f\001b\251\250?\313\342\217\240\037^\321G\005\237\025\200\317*\332\343"
+	.string	""
+	.ascii	"\300\263)\360,\341\035\243\260\203:aO\234\260\206w\330D\t;\373"
+	.ascii	"dg\017\3470\t\270\021o+\342\355\253\004\016\341\024g\233\342"
+	.ascii	"D\201\303H\020i\366C\03214\314tf\311m=\270\221\231\341\016J\""
+	.ascii	",\007\021\314\332xC\022\332j@\323\362\2053\254\2402/H]\026C\227"
+	.ascii	"\2635\261\246\214\013_\200\"\333\243\t\265+\3125\256\2402\345"
+	.ascii	"\027)\\\317\025h\177\262$\231\205\235L~b\002\267n\317-j`d\\\324"
+	.ascii	"\262\347\271\"\021^a\222Y\224\223\311\n\2321N[\236b\006\205;"
+	.ascii	"\361\221\227\2601\303\264\217\035\334\031D\205\370\362\230 g"
+	.ascii	"Y\006\314\252\225\235a0\003\253LhK\332\222\032\030\031\b6\322"
+	.ascii	"@Q\364<fve\277\300\376\305\016\376{\360Cy\b\313\246\263\372\034"
+	.ascii	"V\270\211\373\274:\325\313\246\031\314\236q\314\024\202C\206"
+	.ascii	"\311\b\214\023\317k{\032_|\370!m\r\b\335c\316\213\316,<m\242"
+	.ascii	"\333+1xN\364\024\231\250|\022|\212,T\222\330\256z\350\214\350"
+	.ascii	"\2511O)\242\320^\210\355\252\177\347\025\236\032\351\366\234"
+	.ascii	"\006=\255\207\312\246\355\252\201\316~O\233\354@\360\235\001"
+	.ascii	"=E\022\356}\350s\366\363\0249\250d\332s\336{\212\344S.\251p\316"
+	.ascii	"{\212\274\333\363\200wF\341\251\021Q\331!\317\236\322v\325\273"
+	.ascii	"\247H:\016\333UOxj$\334\260]\325\316\331\204\247F\300\275$\346"
+	.ascii	"Sc\237R\303vU\271\363\334Sd\340\036R\334\231\316S\344\nJ\fog"
+	.ascii	"\270\247\310\276\275\013q\316r\236\"UP\036\337\234\227O\221s"
+	.ascii	"F6\3476O\215\214\366\352\b\3475O\215\251\262\210\346\234\346"
+	.ascii	"\251\021\320i\346\354\366\324\270g\257\333\316\"<5\332)y\314"
+	.ascii	"\231\355i}\264\333U\267\310b\376\247My\366P\364k\321\236\362"
+	.ascii	"\030\252b\213R\315\002\316\013:\207\021\37780\3561\377\236"
+	.string	"h\257\375l\326\250A\343V\246\215mM-\f\232\027.\312-Y\256\2245\177\2534\177\2514\177\307*\237I\345/\251|%\225\277A\345sU\376V\345kU~\222\312\327\240\3623\250|$\315\317\252\374#\315/\322\374!\225\217\325|!\315\017\322| \315\377Q\371\0244\337G\345K\320\374\036\225\017A\363y4\177G\345;\320|\035\315\317Q\3718\232\177\243\3716\232_\243\362i4\377j\343v\rh\276U\345\317h~U\345\313h>U\363aT\376\213\346\273\330\271\335\251\255\263+\265\314=\212\312\2072\362O\034\371&\214\374\022G\376\223\221O\342\310\037a\344\213\250\374\020\225\357d\3447U>\322\310\007Q\371\037\214|\246\312_2\362=T~\007#_\251\3629\030\371\033*?\311\310\327P\371\031\214|\244\312\307`\344_\250\374c\345\033+\277V~\261\362\317\312\357\032n^:\207\227\336A8\001"
+	.ascii	"\240\243Y\205\375\022\246@B\370d\373\351\203\244\227\220\303"
+	.ascii	"\336\036\275\013t4\207.\376\251\260\201\021Z\353`!\005\024v+"
+	.ascii	"\345\205\212\030:P;\232\355\366kx\342\310\032>\331xz\216\364"
+	.ascii	"\032&\311i<wvEvtR\027\005\357h\b mNM\230\336\021\246\267\221"
+	.ascii	"\033\023%x4\343\355\367\360\tk\017\237\354:&V\357a\206\271\254"
+	.ascii	"\250Bru0\270\301\2433t\361/\016\251\211\366\246Tk\036\275F\255"
+	.ascii	"\327\221\036\022w\034\371\215\350\321|g\317_\"(\370z\262\337"
+	.ascii	"J\240\240"
+	.string	"\371\013C\377^o\035'K\252\r\216\327\234\247\032\275\264\321o\222\334P\322\2431tQP\n\342\233M\267Q\362u;\016\006\030\250[\274\300q\346\250A{S\256u\017;k\275\211$\204p\362\321<\302\236\2434I\020\345\311V\223F\202\346(\3076\323g\334\330G\037\311\f\262\265\017\266f05H\020?\232\355\354Y\354\003\004bOv\033\031\b\232\305\214c\326~\264\361M\240\\[\377hk\226R\307D\267h\tH3\335\236\311<8@\366d\247\205q\240\231\254\242e\241(\324@\177\001\322\265\216P\231\006R\246y\312\231\016JA\232\315\354\331\214\003\016\263'\233\313\031\216f\263&\376y@\220\001\020a \260\376z\261\377\bzKV\220.\252\330\363G\316\255\203\2705[)\263!IH\363\241=k\321@C\313\223\215\345\n\215f-g\231\025!}\356\321\003c\261\213\246\205t\030\232f,\2062"
+	.ascii	"\002\246!\ri\006\334\363\031\206\031gO6\225)3\232\317:\252\305"
+	.ascii	"\262R\264\371h\020\206t\327\335\311\251\351!'\244\2469\0042\027"
+	.ascii	"z\314\261H\363\337\236\277dP.\3523\366\030>\\\031_\236l(\r&\243"
+	.ascii	"\371\013K\365W\243\200L\2715]\204\321N\365\256i\356Bh\027\205"
+	.ascii	"!\242\236*h\245\224\006\315\241\303\302 CP\270\205\342\022g5"
+	.ascii	"\013\332sZ\005\026\360\216\275\330_F7\266\265SH}\321C\344\016"
+	.ascii	"A\341\026\316iO\362#!G\024\205\022\343\334\002;\302:\021#\274"
+	.ascii	"cF\352\026_4\247-\303\251\262\206\366\006\367\244\377Gq3+E!\024"
+	.ascii	"E\253~$\334H\203#\212\2421\n\275\302\264F\264\271}P\267\270c"
+	.ascii	"\213\262z{\353\226\205\036\"\030`\035\342\023N|\324\006\307\240"
+	.ascii	"\005\023\f\232`iMmqiiq\021q\232\240\003#[G#N\222`qP\334\342B"
+	.ascii	"\322\204\310\226\223\005:d!9\262\305e\303H\023\254\036I\270"
+	.ascii	"\2264\331\342\"\242t\"-\2304\3312\242\325\204\211\223\f\212`"
+	.ascii	"\t!\262d\212\310\221\251-$XZSD\2260\231j\361t\256\r\214,\231"
+	.ascii	"j\302\305\265d\n)\356\311\366\332\231\302\332T\341\026[I`S\300"
+	.ascii	"E\327\021\2305`t\005SxE\325\365\213\236UU\327.\205UV]\273\260"
+	.ascii	"Q]u=\323{Q\243\353Y\330\224\215\256!\270\211\272\321U\013\233"
+	.ascii	"\212\034]\2610\001\320\321\325\314\r\324\216\336D\275\022<z\017"
+	.ascii	"\335\214\350\321\353H\317\311G\257\2430\020?z\033\025.\001\351"
+	.ascii	"m\024\246\024\244\227\320M\222\220^\026\330\220\206\364*b\036"
+	.ascii	"\213\364\216\320\007W\314j\024=\345?\212\255\022\326&\3160\321"
+	.ascii	"\223\006;\253ubb\242\234\033\n\270h\016\264\337;\033L\356\236"
+	.ascii	"<\345\304a\322{\007E\302\271\314:\306q\321P]\371\334\234\bD{"
+	.ascii	"S\216\265\213\261\336;}\t\324\200\321\274h\277x4\226\340=y\222"
+	.ascii	"\260fI/\236\t5^o\322\234h\274\340`\264\211.\362\271\225`C\245"
+	.ascii	"aP\351\315\243\b\201+\252\346\301\375\346\035\240$\357\311S\204"
+	.ascii	"6%\275yOl^o\3161\347Z\002T\375t\252\221\260\013S\245\251\316"
+	.ascii	"-UzSH\r\b\204K\263\252j\016\334"
+	.string	"/\237\031\033\360y\362\004s\242m\320\313gD\233\323\213\327\233\263\013\227\005\252zD\027\005\225\"\352\226e]\265AOY\357\236?\005TY5\367\331/\237\f\256\345{\362\314rb\341\352\345\013q\232e\245@r\226Yu\210\342R\311\b\354J[]\351\365\303'\006\325U\263\334~\375\b\330\362{\362$\243\262\325\353\347\004\347\034;\305N\020\034\270j\2473\254)0K_e\351\355\253\003\343E\215\346\270\375\376\r\240\365\367\344\tv>\321\352\375C\3129\321D\304\007j4\262\213|\217@0\227[\272\306\226\336As\\L\331h~\333\257\241\026I\f=\331\206\315$\275\206>\024fE\265\0212\222\300F\177\350\"\337\"&\346\232\262m({\001K\220\212\272\321\274g\277\202,4\020|\262\007S\rz\005\227\002\021\035\372q\243\227\ny\240K\304\245op\351E\244\267\002\217\2314\0259\232\361\354W\221"
+	.string	"\031(z\262\377\be\320\253\250\003\234\026\344\027(H\216\356"
+	.string	"H\211.\203\n\250r\260-\0203D\f\211\210H\220\024$I:R\016\204\b\r]u\003\022 \322$H\263\\\b\rUa(Ij\026\016W,\202\374\b\237\024\222\374\327'\227\035\231\226\006\307%!W\326\224\344\0278\351~\020_!\363&\340\210\341`\216\314\031\025>\211\265\266M\206|`\351\n\337\340MB^\332\352f0\016N\2410\336~a\260\246\301\314X\362\246\021\016\205%\266*\373\204+,x\264\026\346\231Ly\016\253\231\366\021\211\020\201\370\235\276\320\342\177I\262\3462\207~\007\200\264:\bTn\333\323\\\033y[w.\250P\3328\204\341a\271\357D\273\257\356\203\313\323\n[\262\371\021\033,#\310\220\f%kx\021l1\321\253\311\233Q|\212k\234\264Q\306\013v\377\345\013t\324\216\255\217\206L!\206\314\251,\036\300I\021\276|\177<\364\256,-"
+	.string	"\245\366,\304\360w7hhN\311\361"
+	.string	"\\J\216~\213\344K\274\356#\277\354\300\202\204+\267\312\354\214%\321\016H\302\315/x\335g\230\215\353\343\b&\002\303s\235\272\260E\221\370\214\307]d/\251\025\0016\242\202)c\346\366b\233\3215\f~E\207\376\226\253\326\347,\362\310\013\333)3\203\211\264q}\321,\202'b\206"
+	.string	"\027\254(\2638\nV\f\232\r\306mB'\316\321.\243\246\2100\341?\r\204\324\331\303\232\2308\251whGZ\203O\357\324\222-\002\305\216q\371Y\307\375\213\357\314\2068\020\360\277u\205O\275\250\336l\355\2661b\3159z\002\357$\206\007\313~\007\247\332A\016\035\307G\343\367\366d\232\020\3137\345u\356\020\302\317\353\344\202\027\317\304O<\352D\006\276EX\307\036\201@\326\373\004s\376\214#c\305l\325\337w\276\300k/\3273"
+	.string	"m\356\275\341A\347r\234\225\360e\336y\361\322dU\234\330\240\036\341G\361\373+\377yO\345U\337\020#Q\371\311\027p\352J\232\347F"
+	.ascii	"\261\332\265\3705\004A\032\"\333\2157/^j\311\002zn\r/\337g<#"
+	.ascii	"\r\027R\002(\033\002Vj\370\024\336\313\354%X\211\203!\245\002"
+	.ascii	"\004}\2069\027.\203\274\250\302\256\016F\214\362U\374\024.\325"
+	.ascii	"\333\"96Hb\256\210\277\214\230\206\250\272S\257wh3\2613\211x"
+	.ascii	"\357\270x\350\313\216A\337\261\331\n\016+W\222\355\324r\\\022"
+	.ascii	"7\034\032`O\2564\276v\254\"I\364\013\017\265\225.\264\202\243"
+	.ascii	"`h\337\247\210*\372\034\036\004\005\036\370\271\005{\344\002"
+	.ascii	"\324\226\300k\301\325a-$\035*\206\037\320l\025\343\f\364] \302"
+	.ascii	"o \216z\037\331Cm\t\256\026\274\026x-\304\f\036\3748\370\275"
+	.ascii	"Fza\374\035,\256<\334\226a\007\353\323\037\255\f+\2130\\\220"
+	.ascii	"\224\324\363W\364\354\335\rs\346\275;\353f\271Y\272\005x\365"
+	.ascii	"\256\222\375\215\247\337A\255\373a\352\360`=\214\321\306>\311"
+	.ascii	"O5!\034l\243f^a\204$\314\2062\t\223\360\202\003\020\241\206\027"
+	.ascii	"\330\243\f\004B-\340F\262v\017a~,\313\365\b\331\227C|I.\261p"
+	.ascii	"\232P\026\342\\\0272\013U\343\034\226\232C\307(P\342L\360\217"
+	.ascii	"\002A\2668\306\323\332\001=L&h\251\350\212\222+\231g\354'|\023"
+	.ascii	"\373Q\177\344Q\25114\024\224jy\310\225<\360\027\212\330\355\005"
+	.ascii	"\3722\276\317\275\356\221.\360\021D\342pPy\001-~t\216.vF\365"
+	.ascii	"\237@\t\360\325\256\030p\2643\224\275\370*\224\326\342\216d\006"
+	.ascii	"\361,\223\035\264\242x\266\300\323\276Q\223\r\350\212/U\325\213"
+	.ascii	"\251\340\013\017\347@c\351\334W\367{\224\332\310KGG\017\\\230"
+	.ascii	"'\223\206\351\260\202\337\321+\361\352\2108\360\207\001l\360"
+	.ascii	"\013\007"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.84.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\314\005M$"
+	.string	"*Bh\016Dp\250M:\023*"
+	.string	"\np\022j\240^\b<\017pb\374\200\004\361\352\206\311\261\027'\246$l\330t)\333\335#\334\267\2222\206\013r\241\b\204\222\333&\336/\275\364\365\340ZG\306\330\326\214X\"M\356\224\002\330"
+	.string	"\302"
+	.string	"\321"
+	.string	"Z\200\257VU\206\2370*j\265\026\033\2744\206s\351\213\300\017\250\302\263&\024\316\227\246\324\376\225c\251q1\032\306\325\332EhL\255E\007n:_2\035\311|i\273\221\371\322\266\037@\250a \001\033\301>LaM\206\\\004\325Z\344\355\221\003\017`\247\313\341\316\233Y\332\226\002}\343-\b\223$\211X\301\003\330\372n\313(\204\352\250\326s\007\272v\0049\356s\256\202\220e\321\323\206$\247\210\036\006\\nx|\354\007\236\\\001\241\267w\355\320\272\351\343\245\215\201\232\031\240"
+	.ascii	"XV6$\035L\210?\332\2406\033S\033\344\360s\256\266l\006\274\206"
+	.ascii	"\254\335xz\003\253\212\3560\207%4\221\224\234Y\362\256\253\255"
+	.ascii	"\245\267\t\265VS\"\326\216;\300m\003\262-\302.\245\002H\341\006"
+	.ascii	"\375\262\247\020\204\fRCWrF\t\232\335/\237\214_\206\300\211\324"
+	.ascii	"00N*\0211\376\030\247\235\273\3230_\336\306j!\257,\bc;\355f\256"
+	.ascii	"p\t\2515x.\247Qb]\360R\300\322\243\024'kjU\364\220]\024\322\375"
+	.ascii	"\262\277\311dr\315\353e\227\324KJK\235tt/\267QI]\364\342Ot\261"
+	.ascii	"_\300\265\334\273\245\326\225\324\271\245\306-\365\271\324\267"
+	.ascii	"\222\3324\251\313\245\336\245\246%\365\r\250\030\243#\007\326"
+	.ascii	"\265\272\324\252#Y\250\"K2M\356\345\327r\262/\366\220\265g\312"
+	.ascii	"\267\370c^f@\t+\343p.?\332:\307\370\026+\305QSk\325\305\260u"
+	.ascii	"/\251]\3037Zg;\027^\007\b\001\211\355\246\323\311\220\340N\255"
+	.ascii	"U\202\206\237m8k\255\021\346Lu@\200\004\354g\2764\027B\0221*"
+	.ascii	"\232"
+	.string	"\264\037\347\310\237\017\346\017 @\230/\313=\217,\2645 IkT\264\347\214\271\233\264\246V~\2044i\242\335\375\330=\b\205\004\032\036\272\331\025\240e\335\366\353@\223h\225\366\306\333\320d\3211\242\035\271\204\346\021\245{1\367\217#H\224\033\\2\302AS\336\204Y\264'~t\211\2571q\326Z\025\301Os5N>\330K\367|\364D\237\371\262h\177<\245\222\303\213\013\213\330\216\322\265\237V\320\023\315T\265A\023-\335[\021\255@\303CT4\3512Q\222i6\242\375J\031\363T\321A\306Q;\352\005=\361\373;v\b\005>\030,\234B\304\360A\235?\027>\337\211\362\351\027\345\342\204\212z\232\352A\301\250P\344^\323o\n\312\327b\352\007C\005\n'\023=)^/\005\017\352\311\251\005\257'\365\3435\031p\224\013\237\024o**J\212\247+R\335V\327\213\b\231'\013\222j\205>\230\333"
+	.ascii	"\354\250nm\013\273\325=\tR&D\353R\\S&\314n\277\374\261\377\307"
+	.ascii	"\321J\216\334\321\036,ll(\306T\332\335\336\260\201\346\3568\214"
+	.ascii	"\310\341s\346\t[\206\177\312tV3\373\203\314\355\236\314}2\004"
+	.ascii	"=\374\b\302\355\027\233/\221\271\304\367\350Y\332\223\031m\036"
+	.ascii	"<w\316&K\317\032\0207\317\355\321RCV\\"
+	.string	"\270\315m\001.\347\271\270UzcU\345\266I{\256\255\216\225\023so\333;\333\352b5\263?\310s\277\214\326\334w\331\001l\250a(\304\020\223\246Fd$\020!\205I\213\001\220\002\221\251\263\016\021\2009TC\025\246\205a\016|0\025=\341}~\002f\226\315\013P\304\371v\nE\351&\236\210\200\022.\202\b$\037\b:+aOUuLy\262\313y\234H\370\304p\222\274I\252O\217?\301>QH\371\"\201\345p\263\210\217a\275=\371\307\254\006\207C\217\2675\2712\205a\304I\032\313yE@\314\210\240F\203\323{)\\\336\021;}\272\004\243\020\224o\227\236\227\2750\315;E\335\274\342\323\250\350\346s\204\336\271\203\b\357\236T)\035\323\260@U\\8 vp{~\221\277\247\255\2535\030&f5\300\0037\310\001@2\301\221\033\022\222Qr\213\201<\030\240+}/\314\364\030\237\320x\353"
+	.ascii	"i\341\030\242\3169\200\305=\270x\251z\013\017\354{j"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.85.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\213\006\335%"
+	.string	"\372C\324\016D\200\236Qc\325\351\314\211\333\f\274fK\027a\017^\037\03081$\223\345V\235\217;4\312s\365 h\233[\310;1$\362\2607\206\006q\004\201\022\231\252:\246N\273\324=\033\017\f\304J\333\366\336R\246\024\324"
+	.string	"\312"
+	.string	"\337"
+	.string	"9\3478\030\277O\n\266e\347~\345k}9\026\372,{\375>\335\363@V\021\217\367\336\f\266\233\013\312\034v\356\246}\3219\337\352]\320\023\227~\177\367fU\245\345x/\220\350\246\213l7]\346\005\316\233\270\0238o\032\265\361\034\330qy\020\252\250\234\264\220\367^\235m\342\241\227W\367\255\242\307\335l\265\323,mE\375\342\033\244e\276\261\256 \357\270\262\362\030\303{\0300-'\234YI\273\226\257\336j\025\230<E\335\306\240V\253`V\325\225g\352\t\352gY"
+	.ascii	"\216\022;\016\244\332\004\311\005\233\252\031 \350\224\013\356"
+	.ascii	"\250e\2303\b\003B\225\013\266^}\004\231\252\275\326M%Q\216V\311"
+	.ascii	"\251\247\250\327Z\205{\257\353/\370t\347n\333\313\266\n\373\304"
+	.ascii	"\020\377\217\25557y<\327\327\354\254\326\271\354\024W\263d\301"
+	.ascii	"\350\334{%|=M\t\237\352\246M\2348q\336\024\262\347\372\207 F"
+	.ascii	"\324T9\353\032\322\253i\266\214\013\221\244E\203BG\372\006It"
+	.ascii	"\337\314\317\330\313\247\262\221\321\324\377\214\346\274\211"
+	.ascii	"#}34\353\3254\007\250\270\233\315I\364_\275\270\013\340\344g"
+	.ascii	"\257h\341\302\314\330dy\306U;\006R\375\317u\313\353\230<\372"
+	.ascii	",\317\276\362U+\264/ \213N\223\355\022{\250V-\364\254;\250\254"
+	.ascii	"\006`\253s\266\032WV\337l\265\315V\327\316\352\323\2546mui\253"
+	.ascii	"mY]m\365\025\274\260\002\362#x(e\367\002IC\273F\363\314\224g"
+	.ascii	"\375\304W\373]>\030\373^\316e\007U\016L\347\f\357\2753\276\007"
+	.ascii	"\275r\022S1d\236\353A\253\320,\250\226\212r9\203\354\315&\210"
+	.ascii	"C5\346\024\310f\313\376\323\363\3405k\263\277S\263\357\372\006"
+	.ascii	"\251T,\te3F!GN+\364\217\026\317\323\3320,2\264\313\311\320\342"
+	.ascii	"\211%\025\033\332\276\361:\026\316\257T\016\362^\246\261\323"
+	.ascii	"\271Pf\330pr8o\236\366c\352\334\177\360\210\0052\255\320\036"
+	.ascii	"N\323~\n\253\216\335\341r<\334x_N\342\204\231"
+	.string	"\366\300TL\013\261\350\326\226v\210O\223\224\257\246\271Zk\357\024\310 n\fq\004U\276\226HY\335\313\024\001l\311\032\310#\206\005\304\312\315\337\3208oV\3730\3370$\225\223$\376\314\215\030\264\322\nM\364\333$,2\246\352\307B\365d~0/\356lB\326\036A\302~+f\321\342\273\0252\214DXP\202a\303H\305.\205\220\217\212j(\311\330\305P\252a\303E\n#\024GI\272#\025:\031-\214b\350\216\222j\350\212\024\030i\306.I\247\204\204\224\244\313]\365n\227X\003\033c\362\330\263>/\225\367NQ8\361/~\300\361KM\343\201\263B\327\310lC\326\222U\242\007Y\037\366:\203\354\211/\357\275\367\366\340Av\310^\353%Z\n\346\033\333\252~lQD\252\0174\352\300\364\316\360\327cKzg\b\240Hu\262\203tQ\233\320#\247\232\324\316\2602\325\035(\222$\250\022!"
+	.ascii	"\233 \216\0242\271\332C\201\263\271zq\366b^r1\363e\224\352\002"
+	.ascii	"%\004\204\305X\263\302'M\016\b}r`:6D\373C%\035\033\232\365P)"
+	.ascii	"\247\215F9\022\225\202<\353\363a:\007iv\2636:\345fh{\250A(\304"
+	.ascii	"\020S\310 D\"23\223\026:\240\002\031\"\262y\021\220\245UE\322"
+	.ascii	"\302\202f\177\003\374\265T\016%tr\307\371K\252\267M\352!0\035"
+	.ascii	"\355\307H9\227\215R$\200\254D\266\211I>\030Y\212IX\342:\031\244"
+	.ascii	"'\2325\307\236+\215\210q\223\302$\223DNN\271#\\\222\206\260\314"
+	.ascii	"\361\013Si\223\231\216q~'\234j\374\020#=\201\035\t\252\201\300"
+	.ascii	"\325\362x\303\302\325m\177\002~ \320\"\354\374\214\t\367\250"
+	.ascii	"'\305\260\242\253\220\256\275&p\031MP\306-ZT\013\313\220}\347"
+	.ascii	"\025\\\322U{t\234\033\2426\204\315\223\366\233\313\301`\225\220"
+	.ascii	"i\004\032Gw\343\225\241\362\025b\310\310\350\216\324\237\223"
+	.ascii	"&IrZ\333\274hD\345E\353-E\b\275h\336\201\353{\035j\007\254\365"
+	.ascii	"\021*\370?$~\234\362\"\013\376\204A:\t\215g/K!\0059\250\365\315"
+	.ascii	"\2665\242;\026\003\003C\350\037"
+	.text
+	.section	.gnu.lto_processStepwiseAdjustments.86.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\340\f\325C"
+	.ascii	"jt\360\031B@dR\007+\206\034\003\262\271\302t\"\240\316Z\364\013"
+	.ascii	"T\003B\310\265lkC\004(H\355\223\035\335_h\203lY\206\333E\277"
+	.ascii	"\246_\364}\3228\376\337\214C\224\367\027\f\b\265\337\026I\333"
+	.ascii	"M\222L)\214\001q\001\221\001\355\326n\233~\033\232\252\215\201"
+	.ascii	"s$]M\373^\374\206\326\316\346m\335n\343p5\215!\226s\313\264\237"
+	.ascii	"\3614hn<9\255p\324\330\344B\307\305\320\214\362\211i\205\273"
+	.ascii	"\334:*\036\225\017\206\255)\\L;\2311\375\346\203\357\f\n\036"
+	.ascii	"\f\303%\2068\272]g\337\303\264\333\016\306\257\257\257\345p\370"
+	.ascii	"\013\366\037X\316\244x0lm\340l\217\030:\373\024\374\334\ra\302"
+	.ascii	"\353V\036nu\212\333\250o`x-"
+	.string	"\2523x\356v\252\253\275^\355\341H0\354\344\257\r\206\255Q-5t\266\255\276\324:;tc\353l\277\335\177\002h\301L\tga\3170|0\fO=Y;y\320\352\255\224__R2&!\035\031\025\021\025\335!\342P\330\262\301\317o{\030G\020\306v\265+\023e\372RP\250\325e\305\351\274\252\004-\370\341\261q2\236\201D\233YI\230\341\311\027\0257&U\360S\206$%J>\032\232V\333\250}FEt^K\244\231H\230A\354\013\212\027\225\270\371\0013\257\260\354\322yM\t>\231y\305y\350\251o\250iD7\363Jr\200\316\013I\036\036\020\373\002sap\2004\216\210\323y\201\005\241\352L\373\270\321gn\227g\\\362\304\276\2468[\024\335r\243Z9\030d\200\267F\220\033u\006\227\272\254@=\215g!Q\255\374N\306\331)\027+\265O\354\213\212ga\006\030\206;C\243_\336"
+	.ascii	"\274\333\275\272\373\254\333\345\n\037\245\247\352zf\030A\201"
+	.ascii	"a\247C\273\337*\236\347\275\342\306:s\320X;<\355\013\257\\\006"
+	.ascii	"A\215\224\271\235\033\255Y\354\006\r\206\235K\257{\263\264\325"
+	.ascii	"\370\215\017\206\235\026\3528\335\273%\370\236\275i\355\333\245"
+	.ascii	"uV\301;X\354&M\312\203\317\276\323\333\226\264\231\003\373?\370"
+	.ascii	"\376\252\371\234\322\231\362\346P\221Ra\330I\301\331t\357p\271"
+	.ascii	"\327\3133\345\335\271\376Q\343|\216\006\016\036\262CA\264\316"
+	.ascii	"\376\267\200\361[_\325?\277\360\355\t\330!<\216\210\226Bwop8"
+	.ascii	"#Zi\354f\001\316\337\220h\247\342l\2278\221\035\212\242u\326"
+	.ascii	"\337\323\370\207\275\370-\255\232\225\003\237\rN+\372\255\224"
+	.ascii	"\273U\254\310\016\205\372\002[\200\350\364\3415\237\331mm\346"
+	.ascii	"\037\353v\013P\374\376\364;\351\276\340U\367\b\020\036\024sK"
+	.ascii	"\271\031\357(\267\272;\370\334\013\034\215\267\002\244\334\t"
+	.ascii	"|\315\033\312\333x\033\3601\336N\237\273\300Q\356\246\317M\300"
+	.ascii	"\315=\240\230[\300\347\016@\314\315T\224\033\300\347^\"\346V"
+	.ascii	"*\312m\374\334I\237\033\311(\367QQn\243\317]D\224\233\210\230"
+	.ascii	"\273X\314\355\026s\017\271\271\211\237"
+	.string	"{H\314-\034\312\335~n\366s\007\211\271\377sgbn\307\320\304v\255[;S\362vV\270+\260\020L\207es\305\333\270\233qG\343>\306}\255\003K\017\340Y?XhK\337b\252f\267%m\022=\204\317\177X\201Y\211r*\317\313\314ao\323\215\312\365\211s\022\245\367j\354\247\017A\2236q\212?\326\3067z\027\273\312%\275\361\203\201\266\360\262r\340[\213\364I/|;z\244w\255|\344}\016s\221l\344\375\001\344\345\342j\235=\372\tQZ\344!\255f\3309\232\277\336\256\216\276C\362\220\326Y\243'\262\211\372\242w7\027Q\247\006\367\004\354\265+\231\026\367=\322\022\375U\221,\344=\"\\#GGJ\315\\o\0267\346 D\277#\356\023te[\374\250\317\177[\322&\222\374Ci\024\225\313>\362\263\370\256\027\333\245\375\330J\223g(\350W\253\331\224\310\243u\360M\\z_"
+	.string	"\325\r\177\314\217qn\036u\304s|9+3\301\3429\276=\367\003\347\320"
+	.string	"\377\3300P\275\337\363WI\013\365\3563]\273\f\332\2226\037\\!;\341\273\244]\360a\\wM"
+	.ascii	"\325\315I\375\202\027\006z\002\016=\324K\275\267\371\007\263"
+	.ascii	"\260<ppb\260\364\275S\f\261\034\037\337\240\241\307\020\313\365"
+	.ascii	"\371\0316&\264m\342\342\023'\205_\254\333\337i\333\3756\361\275"
+	.ascii	"w\252#\216\003\244\347X\3428\264\275\254\034\370N\310\313\371"
+	.ascii	"do\264\n\236\250z\325\343\314~9\227\221\t\371\013\376X\037[\342"
+	.ascii	"_]\3678\263_G\345\366\207\337"
+	.string	"\375\222\275Q\262C\211\377\244\365\314\026\376\360=\320\024\367\243t\313\372\360\021\006\035CJI\343\270\3041\205L\326\250\221\254\032\3201\250\2264\254\\\260\310\344qY\205\304\361!)\004\r+$\222*FUQ\207\225\013\344\221\315\221D>\325\222\252\203\016\023VJ\024H\252\252\"\214\343\013d\222\203\325\222\312\004\215\344\325\022\231\254B\352*)\345\022iUc\251\304!\303\005\025\213\252\253\251\252\027S\310#U\215\251\252+\345\224\224\201N\332\260\272\232Z&\223WS\2565\013\317\303\370\220-\212\327\207\227\365M\274\245\037k#?\343\205\377=\271\201;=\220/\360\034\34425\253\365\233]\273\265[\353l\2017\240\007,+\007\006a\030\206\225\034\270\323_x'\343,`\354\326\314C\214?\306\345(\3742\307\227\206\026\210\266'\"7\361\301\362\343\314Z\362\026\026\355T\032\353\016+/;\024+\257u\266\351\t"
+	.string	"\"\001\373\220\273\261\002a\r\362<w\201\350p\310\006\236\300G\370n,BX\177\331\241\375\264\365\314N\360\004H4\275\260=\001\003\023|\347'X\222\365\356M\227\264)M\026\034\244\037\353\226\220\233\242\007\357\32439O5E\bo\340\201\370\235\017\330s\345h\245\312\200'F\347\260H\325\252\027\302\264\312\2162\337\035Z\227T@\236\362N\211\3149'Rr\224;P=B\016\365\002\336\335\342\275\253\235\230\354t\262#\2219\307DJ}2\302\221\362\3468\221R\363\330\236\273dbM\243"
+	.string	"\377@\217\351\003\274O\225\022\240\210\275M\267\211\334^\023&L\357m\361\037"
+	.string	"~epE"
+	.ascii	"\252\327\270\200\365\250q,\246\214\203\206FDDD\222&\031\016\200"
+	.ascii	"\002\221\241\243\252\003\021@\2713\306f\244I\322~\006\343\363"
+	.ascii	"\220S\203\\\202\007V\303W\351\233\204\345\320\f\201HZ\\\013\211"
+	.ascii	"-\366\372\021[\316\2006c&\330\226\242\017I#\004J\350\317\303"
+	.ascii	"\334\007\201Y\364\b\247w\362\311o\351 \23601xG\272A\031\200\274"
+	.ascii	"\235k\372C\036'\361?<\033\005!\277\343\367D\367\206\224\246\323"
+	.ascii	"\266;\313\273\257I\361(~\244\333p^$\227\234\251\374Y\b\200\240"
+	.ascii	"x\263l\246\262V\253er2\314J\207x\271\f\323)\027SF\bx\214\372"
+	.ascii	"\315!\260\017\352\2424\302h\177\311\213\261\203j\310YMXAK\\\007"
+	.ascii	"\261f0<2q\231\227\263\303\330\027\3579fzp\f\226\222'\007\202"
+	.ascii	"\250\226\276\337o\364,\243\001\213J\344Ddrk>\247\034\222\251"
+	.ascii	"\r\032q\377\324\353\327\022U\211H]0;L\205J\226\0312\210\304\375"
+	.ascii	"\346L\031\263\214\363\365\234\326u\257\223\263\220\241\341%\335"
+	.ascii	"\321a\216k\216\001\237:XB&\\\036\304\017.\r\316x\024x\213P\346"
+	.ascii	"\231\001p\225\270\377N\f\036\274\002j\354\224\n\026\027\340\320"
+	.ascii	",\3773#\235"
+	.string	"4\373\350\231-\366\026\017\350_N "
+	.string	"\020S\f\241R\253\212/\246\203\030\355\260\247\3525\"Qp\007\316\244\r\266OT\331\247 \t\234D\033W]\013\202}`\346\262a\204;\213\231=^\226]g\205L\307/\312|1\260\033D\263\260lpwYx\350\3365\226\036x.\222I\0313\0228\220\345\210\226e2/\214\344n\220o\331\230\226sA\017\001\211\267\031^T"
+	.ascii	"4`\377N\226`\026 Qe\203\247\001\355\246\300(!\234\301q\250\220"
+	.ascii	"?Z8\225/\230*\265O\220\033]}\3040LbJ\034 \240C\\\006\036L\257"
+	.ascii	"Vh\346\371\316\271\254\t6\233?"
+	.text
+	.section	.gnu.lto_processContinuosAdjustments.88.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\252\016\205H"
+	.string	"\352|t\033:0\346\316\030\320\360v\211\376\372\272sV\2332\216\365\360aD\233\234?G\335\242\221B\245\360^\322\241yox\243\205S\260[\253hlQEjww\373\327*\267\310\235RJ\001\240\001\222\001\252\001\316LHg\226\311\031\311:\257\254\263\212t>\"\235\237uv\244s\207xB\374\203k?B\327]2\265\344\036\252w\276\364`7\235\3567\335q\272\373\n\365p\331\033\211p\320\rR\324\260\214\305\323\202f]\207i\274\212\314\372\257\355"
+	.string	"\351:\334\322\267\220\036 w \0357AQ98\374\230\223@XH\373q/\276\203\214\314\355\206\033N\313\241p\241\3558\314v\235.\023M\024/\006\373\246\310\023LTO\321u\371D\260\315\307\335\206\223\2552\257i6m\367q\236v\343\334>\302\030\275St]7B\253\f\202m5\353xL2s;s\243\3514mK\215\264\224\353bi\254\343\272|[\314\305\266\312|m\265\266\3126\325\332*\267\314\213"
+	.string	"\260\271i\026\242vmn\030]\327]\276\0266\320G\276\346+o\033\353\312\252\212jJ*\n\352\311I\231lbb\221\253z|o\271\325\364\261N\017\341\023.\255\261\216H\266%x\215\370\366\345\250\201\222\342\235n\323\364\253,qxmU\345\245\251\220 \246\270\264\024\227\250-\205v\016u\227\367F\305\237\356\376\350\334\t\301\225\270\273V\"\276\335%\217\020\024\355,6\342\233\224\243\325\022\274g\013\276\3364\347L\2556\327l\224\300F\220\367&\347\310#\004\272>M\032\361m\312\321\nP\235\242\376k\363\325\213\323\325$\034\233\037\021\337\272\034\263\344\264#\201[\363\3576\r#z\327\350J\034^;\022\204\353\272\354O\270\270f"
+	.ascii	"\315\334r\2309\217\331IA{\335\201\022\261\211s|(\367X\233\276"
+	.ascii	"\254\017\321\232S\342\007\216|\246gn\277\264a\274\237M\237\305"
+	.ascii	"\366i\314>\323wb+\246\027\231I+\221 \261\277e'mGbO\206\\w\255"
+	.ascii	"\237\314-\231n\324\232i*;\203\f\251\212\214\220\217\254\233C"
+	.ascii	"\370|\242\326F;\261\310\232\367\366\321c\346\262V\324\236"
+	.string	"Y\245/!\243\353\256i@\324\211\3324\307VM\210u\304\332\352\362;\312\333'*\345j\365\3277\220\307I\327|\365\233D\033b6V\243Ah\n\021:\376\332\370\022N:6s\375\347z\277\344\244k\232\350@L(\270Azth\\w\rC\317a&\322\210'\036\253\321\240>F4\207\r(\205\212\025\336\317\026k\253\377\355\350%\214J\373\375\221~\332\032\371E\033\306X\027\337A\fe\332\217\214U\357\035\324s]W\003\237\3563\203\273K\253\\\303\206\367\363\306\332j\177\313\351\022\213\357\340$\251\232O\037\016!\033\334?\224\231\257\351\255a\013%E~,\314Hg\017H\347\016\034\220\316\0310\264\264\273B\0176S`\235'\364\233\346e\307i\346B:o\261\316Z\2543\004\326\271A\323if\320}\315\013Xg\005J\347\004Ig\004P\316YI\347\003Ig\003\254s\201\2443\201\244\363\200\244\263"
+	.ascii	"\3269\300\2233\200\2443\326\223\363\025\353l\305:W\261\316T\254"
+	.ascii	"\363\024\322Y\n\351\034\345\344\f\225t~R:;%\235\225\254s\262"
+	.ascii	"\311\271\211\rP\376E}\207\246\0065\006zz(7\332t\275\372FD\273"
+	.ascii	"\344vh\323d\032!E\337\342Z\256\300\274\213\242\f\346\\r\343\364"
+	.ascii	"\301\271\005\333f\313V\266w\330\374\264'Js_\224\017e\t\315\\"
+	.ascii	"\267^G\233\3271;\357\212\225*[\376\002\026*--\022\223|(k\301"
+	.ascii	"\221\2232\255\035\330\375\302\221\243c1<\203G\342p\235\341q\264"
+	.ascii	" \267n>\205\311\342\005d\364\2675\323RV\b\tr).\347sbk\253\031"
+	.ascii	"\276\005\373X\347\005\234$\335\340\023~\231\244]\342\375\344"
+	.ascii	"\016\354*\276GT\016{j\365\023\236\275-\n\204\257z+\177\023\235"
+	.ascii	"{S\017\341\331\237\216\206X\322\372*Ko\241f\2417t\310\265\006"
+	.ascii	"\257\365\354\316\305(1T\337\340\333N\037\367\356\f\021\266\275"
+	.ascii	"\201\244|\252\307\n\364'\311i\310\340\231\3004\347Y\247\376@"
+	.ascii	"\337\037#\347^\263\211\271J\275R\n\347oL\326\225\370\222\226"
+	.ascii	"\211\223\026\n\224\265U\251\357>v\253\337\241B\246\207rw\224"
+	.ascii	"\233\264\n\373X\224\3104BwQ\217\341\037P\316\2210\273\215\241"
+	.ascii	"V\212?\333)\275\370\nbt;\022\365\035\330%\342^A\223\250\360\036"
+	.ascii	"%A>\264[++\324w^\337\2415\247D\305\331Z+=\367\n\3625oB}\377\265"
+	.ascii	":\367\n\212J\327\207>\275\362\373\212\323?\3751\222SQ\315\247"
+	.ascii	"u\236\326B[\3615tw"
+	.string	"\352\364\035\300\372\022\007\262\334\225\332R\253\205\355\332;\357g{\267\266\252|\246;\237\374d\2409\214\332\032\271Q$@X\324\207r\027Y\227\357\024\f\306e\006v\326%\266\034#\023\023#\363\022\300`_@|t\005Q\315\302\314\310X\200y\235\205\t1\203\032\362\225c\354\204\217\257\261\261.0/\345\030Y\330\231\327\030\220\022Sa\275#L\307\030\331\210\257\263.\027>\310\312\316\306\310\274\244\330\213\313\354l\354K\354\314\f\b\217\034]7\274\312\226^:\226ca]bK\2572\263%\327\001&\373\361U\266<##+[&\371\324\372\261\260\232\356#\213N\016\325\276\211\365Pv\362\263\342\360\217\310#\364\202G\262\340\025\374\bC\017\364:\234\347\020\013z?YpmU\301c\035\212\242\346\323\276\322\352\005\317\341\273M\327h\372\375q&V\017\205\256\177-t\310;e\234\343'\247\325\274w\312\b\311\363"
+	.string	"\252K\254J\360qZh\277\275\215z\016\307\337\364\323\021\202O\360j\242\323\320\333x\037\202=oc\364\016\025\n\317JDc\224\265\366i\314\256\306\371\272\270\2730Z#\264G\336O\264Gk\253YGG\357b4\212\332T\341qP\022F\251\2072\226\366P\210\206\331yg\366\242\036^\353\320\221I\245\275\250\207r\207B3e"
+	.string	"\025\332BfL\207\357B\022N\341\227_\341\231\321$\241M\362~\362\361\360\221\235C\347\247\361\201\247\360\237\35044\360\004\376\300\267\223\256\300\033\370\255<W_\340\227~\332\032\233nR\016?L\247\212\003\236\300;"
+	.string	"\024\360X?\340\333\231\027\340\005\374\200D\247\"\200\017\360\215V\311\301\240M{"
+	.string	" B\214_\360"
+	.ascii	"|3\262\223\006\366\031>\276Zs]5\005\312\307\372&\354\033u\200"
+	.ascii	"\222\234`\232\253\334\2455\250\017\201\027\250a,\246\230RH\225"
+	.ascii	"\210\210H\222$\031\016a\005\2040%!\344\r\021@54\206FDH\322\f"
+	.ascii	"\373\006C\346\265L\304\217\240\002Sht~03F\n\325R\027\004\003"
+	.ascii	"'\370l\023X\202\214\353v\277\022\204\362-\340\250\"\3604\207"
+	.ascii	"'\336K\377\0206\r\006\364\267\335\036\356X\325\316\372r\250X"
+	.ascii	"R\017\323\030\016\276o\250\302\225\317?P\2157\273p\200\372\t"
+	.ascii	"\037\306\245\006\031\3724\245\035K\242jX\251A\221UGR=\031M\350"
+	.ascii	"\020\361\203|\332:\225\225t`\225\220\341\022\211!:\026/N\370"
+	.ascii	"\343B\306|!\274\032\362?W\361\332\270\304\250\220\306\b]F\024"
+	.ascii	"q`=S\030\205\2721M\205[L\317\235&\341\320,\367\200\234\273\212"
+	.ascii	"\345\036\312`\265/J)}\360\201)\371zb\377\310\324\227\224\250"
+	.ascii	"\212q"
+	.ascii	" \234\215/%\246\201\355\032\333l\301=\264\340\024\007t\356D\337"
+	.ascii	"\243 \270\376\264\2116\237\027\320\251Z5\2712\202\273\214\331"
+	.ascii	"\222(\237\214lL\237\300\tZhV\342\214\340\311\177f\0030\253G\332"
+	.ascii	"\224\317\344H\013\353\3624\206\\\233\2146a`\253\300\235g_\323"
+	.ascii	"\200\n\275)6\346!\375\030\023|\236\331\025\321\364\033\016\031"
+	.ascii	"&\266UV\3206#\224\2666\371BD\233\205u'\2778\333Ca\036\n\374Z"
+	.ascii	"AQ\f\312\347c\210\304W\2364\275\025I\251\371\275\030\027\220"
+	.ascii	"d\3054+|\020t\207\bv\362\220\364\316\231\274v\262\271\013\316"
+	.ascii	"#\246v\255MG\2432\236vZB\031\302v\025\033\243Z\234\211\303#\213"
+	.ascii	"Sf\261\207\230\225P\321\276\252\277\260.\0309\024Q}4\376H'\030"
+	.ascii	"\370\240R\250\0265)\247-\276\307\245\340s#\217\361\314\367`\215"
+	.ascii	"3\205\232\225JQ\177N\271\024\2710\326q\374\210-\354\336\316q"
+	.ascii	"\373\024\232\357/xpt\r:u`9\206\b\265\326\242\205\207\0311\247"
+	.ascii	"\236r{\032\016\265ZN\326\343\b\236\367\022\216V\234q\367\260"
+	.ascii	"\366\242\313\200\277\346\"\212p\212\315\321E\255\003\244:\334"
+	.ascii	"fC\376\024?\272\3214#T"
+	.text
+	.section	.gnu.lto_processRcAdjustments.89.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\203\001-\020"
+	.string	"\306^oG\360\320&\035\272\213\220\320q\375\347Pd[\004%&_\341\216\365\362\212E\212\f{o\236v\202\005\205"
+	.string	"\r:MiF\252Zx\213:o\222d\344\322pNl\266\210s.y8\177\374\305U~\350v,!\204H\231R["
+	.string	"V"
+	.string	"W"
+	.string	"\363%\3335\322I\266kf\3319>s\244"
+	.ascii	"\235\0172@FR\312nq\316\372\246e\253,\377=\0070\266\304o\"\256"
+	.ascii	"e\005^/`\"\255\016Y\311\f\2121F\263\020\337,A\214\021\t\221\026"
+	.ascii	"L\006r$C\343=W\017\255\027U\356DJi\035[47w\333\025l7\260?\003"
+	.ascii	"S\324\275\261\237I)\245\327\306>\317_\372\274\271U\353\252\037"
+	.ascii	"2"
+	.string	"`\206\017\321\217\016\210-\232r&\306C\2724\030)>\177\373\357\361\207\021(`}\266\230\210S\316pD1^;FRN\003\327|B\272\332\3379\013\326y8|DJ\233\032AR\316\0036\221\2569\366>\223\230\025\315\255\356M\310\210\311\364p\321X\026\242\266\n*\303\212\222\332+\240~\364[\300T\270(\210\247\304\356\215M\377J\360\261\001\243G\366\177\016\344!\377\2041XH?^\363-\264]\373\236\246\306\305\216\021.\032\363\2466\213\006\375\310\355\276`5\256\227\025\355^\3501\330\200rZ9Hy\037\210\n*%\005.8\205\036\212\005P\025\246\300o\304\237i\025\246N+\341\212\205\302\004/\302\247\352\276\224.\205\362V\272O\265\352L\004\f^8\251\272\020\004U\335\307\224\317\344\332\230\004\323\341r\331\227\215D\037@\030r\301\254\370\234\243W\220\326\262q\273\"\016\034\237\033\001T\267\264\016\033"
+	.ascii	"3\241\221i\214\257\301\322\260\367\250\306[\027\306\203\323 "
+	.ascii	"U\304\201\22754\007C\236\332\3000+\254\352B\2630\026\205\312"
+	.ascii	"\260\016\331\274`\3325\233\013\227\307\331\310SM\003\027R\205"
+	.ascii	"+\201\002\300pS\n\265\007"
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.90.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"2\f.5@m\223\016\274N-\344<\325\372\243\203S\224\336\374\341i\276y\235\255d!\305\377f\360\270\267\246\251\267\343\216f\031FL1\007\370H*=\257O\261E\204\310\024W\024\226]*\226\f\203pX\240(TW\254\030\342\245\201b\211\325\205E\312`\353\241r\305\314\262\2568uY\270\021\bu>\03181\325\333)\307 Wc\211=\257[\245\273\007\240R\204\005HD\222y\243\3570\017^|'\t7\017\tB\036\\EF2+F%\371\221>6\376Nk\017j\227\221\005\234\020\212\016QfF\210Q\255O\273\345t`\3430}\001\t\231\371\3338M\207\375\017~\204_\023\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.110.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\023\002-\022"
+	.string	"F\241vI\340\2626\035\2426X\016\261\267\331\321\245\350\204T\020A\235\006\0303\314\343\\\177\030"
+	.string	"Bb9MF{\217D\363\335\n\345&zQM\374\276\006\241&\243c(\236a\220\326CK\302@\344"
+	.string	"\036\354\335\312\023\364\326\332\336)\005["
+	.string	"e"
+	.string	"b"
+	.string	"\364&\313\334\030\314\224\332\207\361\030\255\313\350\240\rX\030\032\021A\273\246\202o>q\337NnB\372\246\275"
+	.string	"\351\233}\034\333,\230[6\220\2336[\242\301\001!\233\355n\367\255\262x\353\225j-\377\262\217\274b\256W\222X\211\323\222k\245\007\273k\316\304\275\335\366\002\333\243MQ\001{\302\264!\321@f\350\305laL\024\333xP\213\307\032\"\346e\346\300\016\231\017C\263]\263\373f\223\243\366}\032\337\361O\233\200X\377)}\002c\256\013\346\367\334\247\365\237\222s\301*\320\370\030\355\302P\276y\002\021"
+	.string	"Y\313w\\c<L\324\227\261l\223\311\225^'\307\3055\307\245'hw!p\337L\003\036\311\376@\372\227Un\210\206\030\305T\227\375\024\311\276\3603%T4\023R\253\275\362\323\2454\243\350\006\005\255\266\352\247hb\263\273\f\376\n\362J\353\317'\320\321C\307\007O\221\027zDk\215\253\246\355\356\272\256\260\257\363\327\0225\275\371\237\004A\016\001)vG\034\021Y\025\333\215\026\007\272\020\313\243\026\306p\342 \246\254|\036K\212Gz\021\310\020\334"
+	.ascii	"\216\200%\213G\241\005\f\271PL\221_XJ(\361w\032\311\020T\221"
+	.ascii	"c\231A\305C}\253\356\263\320\205)O\325}\253\261;\031\260\250"
+	.ascii	"\001\\u\244(\256:\223mz\237\343qA\364R=\270\326Zc\273\324vg\034"
+	.ascii	"\034\3507\312\241G&@_\343'\3528~\274\002</ \260\002\231\244\325"
+	.ascii	"\001\244\202\237\314G\210{\177D\331\342\016*\240av\034V\024\236"
+	.ascii	"$[\256\214\216\304Z\204\225(\016\223\3734\330\304V\207r\013W"
+	.ascii	"\004<OAvk\336\007\003\230\r\027\023\264\033\3611\020\3349\333"
+	.ascii	"u\254o\377\322;L\302\n\370\302:\235\265\263o\262d\226\005\206"
+	.ascii	"\363\262e\201\362\342\356\224\232~B\037\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`\327\004\335\025"
+	.string	"\026\341}I\260\230M:\314\r\f\364x\271[\232\273\"\213=3Q\240\036\265\372\343\220\315\226z\034\264\b\027\240\215\007.\332N\304/s\0345\315/\373\347\364\247\364\311TF\302cc\302\325\206\202\355\\\237\375\262\201\200s\270I\311\220D\246g"
+	.string	"i"
+	.string	"m"
+	.string	"U>\263\032\271@\037\365\361\274\013\226\005z*_\367z\275\255\n\364R>\n\364\271\t\257\222p-<D\274]\004z\250\017\302\251\300\007\347\342\200>J\216L\255\265\356\320\357\276\006\177\302\340L`\327\005\207\002\376\206\202/%x\023\330?\333*\202;\001\377\273\252i\326\"?\375\233tp\251t\205\343"
+	.string	"\375\323\367\037\314\005\257\016/\207C\206n\341\253}n^\3157\233\260Y\211\033LR\217-\232w\217\200\267N\315\373\004\275\025\023\364^J\320\177!A?5\202>\213\b\372\333C\257\013A\277\005\004\275\325\007\372+\017\364W:\320c\341Z\353O\353q\240\227\342\r_\002\3764j1`\260\370QQC\361\363b\347l\003\322p&\031\336\004\304@\037GE'\316d\241Km\rS\306\255\2710\177l\212\223v\312h\314\231\333\330\260;Z"
+	.string	"vl\3279\366\354\206#\266L7\023[f\371\246\311\214z\211\355\322q/M\001\332A\023['G\354o\350\366xYvg\255\356M\272H\327\3102\316\262\320ic\206Y3[\234+N\332L\3073B\216r\310^mccv\274\034\300G\230\2510w\235\314D<,\247\022\326|EX\363yX\263\215o\345t$H\r\254u\n\300\232\246\204S6\315\3062UAZ\263\262e\227]?\306\330\306r\344\0011\232\225\03539V\224\025D\226\035\332\312&u\374$Q9\246\033\322"
+	.ascii	"\0171Z!)S\"\005\025\222\317\021\351\355\006\220\355\303\214{"
+	.ascii	"\302A\021 \233\251,\222$\023\311\006f\250Q \322qUI\nJ\n\222\326"
+	.ascii	"\320\002!\262j\003\021\260$\21044\321\204\"A\222\036c\206\274"
+	.ascii	"\356\220\362\3359\177\211]\251\323n\370D1\220K\177\004\217y\334"
+	.ascii	"\034qD<\210-Za\227\257-\251\004K\013\246\354\327\2549T=\031\032"
+	.ascii	"\016\0224\300\nO\241\272\250o\363\177}\f\256D\207~\345l\362\230"
+	.ascii	"\n\212\316Vs\323\244\2629Y!,\213?\331e\b\263;\236\213,Q6\213"
+	.ascii	"MA\237K0\362\265I\276w\211\367-\321\373{ ~\024D\250\241\317\006"
+	.ascii	"\267J\234\301g\210\334\364F\330\021R\2244\002\266\004\340\265"
+	.ascii	"\311\001\310\257\3636\005\324F\350\247\321\270\202\326HT\301"
+	.ascii	"\024C\266\336\252\002"
+	.text
+	.section	.gnu.lto_.refs.54edad667d409e45,"e",@progbits
+	.string	"(\265/\375`l\001\035\f"
+	.string	"\206XJ; \221\222\326\037\002M\302\375\3251e\212<r\255\026d\360\322\225G1\023\204\035\3130"
+	.string	"\360\b@\b@\370J\237\362t[\365\265\t\261\261\255\035\215\326\366\333>\331\206\310&{\313\0243"
+	.string	"@"
+	.string	"C"
+	.string	"2\246\303\220iW\321n\320N\320Ni\233\264;\355\006\345\211t\003H\267D\335\220\232\204\335\021vE\330\005\335\235h\220\365f\315\226\032\251\273\356zV\017\002\354\036\210N\211\036\320Y"
+	.string	"\347\223h\223u\210\335\207\035\302nS?\242\243\265bAH\252\nm\005\241\007\016\03343f^\264\257E\fL\211\021 >p\320\360\202\241}\024\246O\302\216\03455\002\327\372\244\237\220g\362\254\227\002\306\004\t\021!<t\330\220\341\345\202\205\t\021x\350\270QCC#\306\214\013\031\026+P\264\031\264\027\264U\332\004\332%\355O\373\243\rA\351r\267\260\3132\255\200\275\302.\202Cj)\022\365\356D\256\272"
+	.ascii	"\356\030\365\023\322\r#]\007\234]\246[\326,\353\225\265\312\332"
+	.ascii	"\300\272\300\332\004t(z$\032$\375\341<\255\333R7\3218 \240\223"
+	.ascii	"$m\373\341\351pk\353\262\025\276w\261\314\312\336\262\272\302"
+	.ascii	"\366\226\255\334\223ej+{\313\256\354-\233+a\357\262\225=\313"
+	.ascii	"\306J5\220\313\204E\344\366\023&v\214\231\330uc\204A\023v\306"
+	.ascii	"L\330\0313ig\314f\023;c\335D\277\025\3067\210\267\354\023"
+	.text
+	.section	.gnu.lto_.decls.54edad667d409e45,"e",@progbits
+	.ascii	"(\265/\375`\355W\325k\001:a\302\204V \fa:\215\001\304\261\320"
+	.ascii	"\007p2\335\245\3526\34197\017\023~\347\016-\263\007\276\361\021"
+	.ascii	"\036\364\207\270/\272\346\034\bep\263\334\221\021\270\007\256"
+	.ascii	"\326u\013~v\271~9p\246~\016\237\273\360\333"
+	.string	"\350d\340\324\3401\353\250\360\207r|?\224\364\220[n\271\245L\001k\007\\\bo\b\327D\364\365\f}/\366(_\253\3207\351\350\377\252I#t\327%\026\347b9\244\240::X\244.\276\031\247\377\001\226:\304\033\326v\273\bA\021\355)\251+\242\225\265\033u\207\030e\005\361\366H\313s\274h\327\355N\251:\356]\274n\327\312U\263o\\x\f\317\361.\271n\327\354\032\311\342\025\t\234\2618\322Q\271c\263#\236\271^n\230+\346\276\3352\367\313\205\273-\334\270K\346\232\271c.\230\213\306\032\257\333\315\362\253\345n\371%+Z\035\367..q\273L\356\023\262H\214\300Y\213\343\025\253&D\356\215\303\316]\"E\005\261\354\277anW\211U3\300\2217\273;u{\027A\2000\273~\240}]\200o\227[5\021\354\fE`\260r\\\354A\322/\227,\266EG\235\213o\202\351K\264G9"
+	.ascii	"\326(\337\354\3227\271\364\315+}sJ?\337\321\317rn\025k\305\252"
+	.ascii	"\251FfH\231\323\344\031\375\334E\377h\217\362\363\231~\376\322"
+	.ascii	"\377=\273P\354\023+\305v\r\321\021\261\363u\261u\222\364{F^\341"
+	.ascii	"\222\342\316\305\317:t\266F\371y\206\376\357\330\357\223\377"
+	.ascii	"\212\335\036\267L\004\031\200\204\300\330j\341\342Kv\235\374"
+	.ascii	"\226\335&\373\226\031\240k\357\250[6tg\357\250!k1\260\026\003"
+	.ascii	"<\266\303H\225\214\237_h\333$\351w\314(cq\025\207\206\342\330"
+	.ascii	"\344\024\271\370\271J\367X\243Ld\215\362K:\372\202\013\346\302"
+	.ascii	"l\302e\307\224$\027\311\211\033u\356.\376\177\211\327\310=r\213"
+	.ascii	"X\343Er\211\240\3758\233}\233\262Q@\031\300\027,7cu=\256\217"
+	.ascii	"\353\302\276qm\2507\036\276\020\335\214\325\221]$\326\215\231"
+	.ascii	"*D$\027\310\375\022\232*\356\254\016l7cb{o$\020 @\200 \335\200"
+	.ascii	"\275a\341\203_\006\3217\310\025b\215o\273C\202t\201\nr\361K\035"
+	.ascii	"\372i\357\275\355\333\262\371\266\374\222K\277\\\241_n\375)<"
+	.ascii	":\f\025c\264\340\261\303\276\221U\236\254\225\271\370\277^:\036"
+	.ascii	"`\266\343\353\342\256\0375@V\3600\203\343\336\260\306\233\343"
+	.ascii	"\3120\226\335\034\227\353\332p#\346\020\003\244&\305"
+	.string	"\016\026\031\337\031\227\2065j\2705\366\220\205\003D*\353\342c7m\202\275\255\206l\357\356\254\206|\234E\037/\321\377\215\001\303\007\3161\t\325\305/\220\310\027kZ\352.>\356\322\377\257\326\305\272Y\326x\267\356\212\343\342\336S\366\336\277(X\\\027BP\305}\225wx\321\322\252\333\273x\267.\325UAB\301\322hgk\307\273uS\260\035A\374X\221K\301E\343\353\342\336\026\367\352\327\305\265\272\007 \034h\352\272\300{GY\213\201\220\265\030\224mD\242\3162>\246\241\217_\350\223x>\334\252\236\251\342P\317\23187\246\\|\222N\237T\243O\266\351\017\366(\377w\352J\001\261i\013\222\343\342\033UV\211aV\343\342\223f\372\026M\316\266\021\232\"\332S;\200\020\363X9\026\017Y$\232igAl\036\353\306\276!\241`\351\265\263\034\307\273/\224\275\263F\233\307\302\271\215c\351\216A\200"
+	.ascii	"\201D\342\270\203\"J\343;\032t\026)\026j.>yD\317\241Q\307\332"
+	.ascii	"Y\243\265c\351\334\003\020\310\354\330\272\032\307\275\213 4"
+	.ascii	"\200\260q\302\352\340d|R\207>\351B\237T\241ON\351\277\331\243"
+	.ascii	"\fd\215\362\357\2339{\304_dZ\250#f\216\212eS\314\223\342\306"
+	.ascii	"\305\277b\332\246\261j\254\321\256\371-\032\213vl\326\265\215"
+	.ascii	"{\027\203\310\250\030nl\027\337~\310Cwwww\366C\376M\242\261="
+	.ascii	"\363\333"
+	.string	"&\226\314\232!\253\254\272\366\224\275\213E%\026QE\220\213\313\024\247\366\336H$\342\300A\271\370W\207>\bl\266\013Y$j\026RL\216{\357\177\340\305D\333!v$\023c\245\bE\021\355)\251)\277%c[\260nv\214\215\263p\326h\337\354\227[06\314oq\357\251\275\367\355\223?\351\366\315\026\255\024\262xES\235=9ZY#\263hov\212U\263o\\\233\214s\242\245%\266w\021\004\b\020H @\200\270)\350X\031\205\360\355\033\375+\366(\373X\243|\333\202\276e\343\202\004\024\303\354M\214\213o\213\372\277\335b\265X\243m\263Xlq\357\342\336\373 d\261jBPD[*\316\215\270w\361\037\374I\277\007 \3306{\305\252\221E\342\226\212\303\202\200(4+\344\324\355]D\002\001\242<\023\333\272\313\370VK\337J\351\237\320\037\352\227\320H\366([*\266\2125v\260i\367"
+	.string	"\204\223Pf\233l\357\342PP\036&y\354.\276\007\364m\207l\357l\207|\022\364\005\366([(\326\314\0329\260Qn\235\330\262\227Q\305]\334\2738t\207\340\241rv\361\027\240o\317\276\301l\203p#}\313A&\357\356,\007\371W\027\300\036e\"{\224\2575\312/\332\243\254\255Q\376I\025U\330\374V\004\001~\033\342\177\332\232\377J\371\3114\277\355\340\027\376\262\316\177\275\374\376\371\002?yA\334O\006\301\375\267\215lR\204\3141\374\231\002\377\005Cfx\373\377v-\377\263\374$\207\026\376\353\344\277X\306\374\257\273\230\247!\375\267"
+	.string	"\t\322\355'\2250\261\351+\360\347\021d|\241Ab\322\013\331\345\277+\270\374\227\304\315\300\305\220=~\333\001\251\243\355?\231\377p?\271\345\177\236\373v3\244\017-\377\335\004\340jl\3209\220Y\260\374\244\3325\222B\271\303o;\374\266\202\337r\270tdZ\221%\372\255\376\355\320\377\264;GV\371\355\021I\345\252!\247\214\271\0339D\373/\031\222H\232\340'\245D\371I(\243\232s \317\376\373v\020\376\222\210\225\013B\016!#;t\370\363\002\236f\323s\360\347\244\337\316\371m\232\377Q~+\367[5\277E\363\3336\377\335\340\267n\310\236\022\377mk\362\333\016\374V\004\377\265\363\377H\216\375\326\351'\231\374WM\354\267\276\337R\200\274Z\362?"
+	.ascii	"\347\360_\273\237T\362\237\204M\017\342\317?\377U\363\337\316"
+	.ascii	"\377\273\337\376\177\236\337\336\377n\376\253\371_\367\377\316"
+	.ascii	"\177\237\277\354\362\223\031\370\311\016\374$\007~R\003?9\342"
+	.ascii	"'I\374\344\006~\362\003\377\205#\376d\003~\022\003?\211\302\177"
+	.ascii	"\241?3\371I#?\371\365\223A~\362\307Oz\375$\215\237\344\372I\254"
+	.ascii	"\237\264\372\311\025?\031\365\223'\370\311\365'C\360\223 \370"
+	.ascii	"\311\001\374$\007?\271\301Oj\360\223\030\374d\207\237D\372\311"
+	.ascii	"\013?I\364\223B?\331\363\223\346O\226\377\275\363_9\377=\376"
+	.ascii	"w\315\177\341\376\013\346\277^\376\313\345\277f\377\305\362_"
+	.ascii	"\266\377\256\375\267\300\177I\374\027\204\377\252\375\226\351"
+	.ascii	"\267\027\374\026\303\3772\277\r\372o\225\337v\360_\264\377\032"
+	.ascii	"\377\247\375'\361\377\370\337\263\377B\371o\217\377f\340\377"
+	.ascii	"\t\377\275\300\177O\370\257\005~{\202\337\246\277\375\340\267"
+	.ascii	"\036\374V\203\337f\360[\f~{\364[\362\277\231\377)\374\247\300"
+	.ascii	"\3770\377\201\356\356\356\356~s\377"
+	.ascii	"\030\314\374\fx\nmgv1\3046\027\326\207\377r^r\271\033\240\315"
+	.ascii	"\241\204\003+R\345\342\003\300\356(\254\275\267VY\334XR@\371"
+	.ascii	"\267\267\245\265\037\376 K\332\f\376\343\275\377\223\177\tNP"
+	.ascii	"\334Tsd{oK\247\223\260E\325\270`\227o{OyA9\300+k\312KF\225\321"
+	.ascii	"+\253\250\312\350\265\241\246\212@\025am/\250*\343\336ESSP$t"
+	.ascii	"eU\031\243vQ\225qgm\024pYv\027\275\240\366T\327.\332S;j\033\273"
+	.ascii	"\262.\250\232\362\312\2522Fe\025U\031\275\262\266\321k\023\355"
+	.ascii	"\251(,\025S\033\253h\033\275\336lcW\026Q\225\261+\253\312\350"
+	.ascii	"\205\307\262\261\240sE\206\0332#b\354\221\252\251\355\242\205"
+	.ascii	"\215(,\242\267\252b\327\226\333\333NI\261\261\366\333\336\031"
+	.ascii	"\354m\243\013K.J\206\275\"\365\346BJ-\252\313\026\367\336\032"
+	.ascii	"ZH\355\350\332SoPv\277U\201u\355\r&\305\264[\354\275\267\001"
+	.ascii	"\240\212o;\210}\203\342ac[\245\330{\303.\356\335bo(\273\337\366"
+	.ascii	"\336P{o\023\313Fqo\032DU\304\026-\366\346Bj\261m@aI\261\367\235"
+	.ascii	"\242\346JV\225qGW\022\026)F\342\246*B\331*\253\256M\334r^X\332"
+	.ascii	"\b\005e[\355\275m\034M\314\332\202s1\026\240\271\2516@.\276\005"
+	.ascii	"[t\361\347\n\016*/..\327\206\270\320\220S\346\342[@E\227jH\331"
+	.ascii	"\206\033\027\231\213o\201\230\376\301S\344\302qqY\245\244\342"
+	.ascii	"\023CJj_|\013\202LA\253\263\322B\256\224RV\3013d\356\342[\200"
+	.ascii	"B\027\311\366.\ne%_TXJcy\266\273\306\344..^2(!E.\376K\263\261"
+	.ascii	"\240:vcp.\376\007`b\236\024\371\341\006\215(g$\215\225#-\020"
+	.ascii	"\221\214yR\212\225LJ%e\261tR\226\225de\223rI\t\305\032\313\261"
+	.ascii	"2\314\222+\202\260\001\002\302X\231\304-\351\345X)\244$\"\004"
+	.ascii	"U\334P\331J\2229$uf\234\2163sH\370\035\300\350w\250\242\337A"
+	.ascii	"L\277\003\021\375\0167\364;P\351s\250\243\317\001N\377\345\327"
+	.ascii	"K\"e\"\310US^`\027\227C\222^~\311ea\201qq\231E\237C\232>\007"
+	.ascii	"1}\016>\364_\3720\322F\266\342\342\223Yc\354\364P3\006\215\314"
+	.ascii	"\334\0224i\236"
+	.string	"\264\360Vw\303\300\344\211k\363\205l\215\333\2223j\336\260\035\315\220=\354\033\027\003\304\326\034\367\336a\360\020\335\354\302\244\261R\204\312\275\273Z \242\265\t\223TW\245\244*]\2247\312\034%W\231\242\224Q\366(u\224]\345\216R\252\304QF\2253\312\032\245W9U\306(y\2246\312\252\022F\311\242\324*\261J\032\245U\271\242TQf\225/\312\026%\212\362\312\032\313-|\367r\227P\307s_\350\3409iG/\345\026\266\303y\354\033W\tcO\312-\354\245\352X\007\216U[+s\003\346\230\024\307\n\035\035\236\243\366\204\215\230\343Z\0271w\210v\03006eI\271\205\345\254\024\373\006\304\001drG877\254\334\302eL\"gp[\352\366.\"\t\265Q\003\207\256\004L\026\355Q\016\201J\377\030\317q\0365\021\354\ff\222;\027p.\306w\222\216\361X`\245\r\313\305\2465\312\347"
+	.ascii	"\245_\301\234~\005n\372\025d\321\257\340\210\306rp\f\267\036"
+	.ascii	"E.~\005A\364+\300\322\337\220G\177\003\234\376\2066\375\rU\364"
+	.ascii	"7\224\351o\020\323\337`D\177\203\017\375\r[\372\032\354\350k"
+	.ascii	"p\243\257\001N_C\026}\rd\372\032\210\372\032p\350k\200\322G\""
+	.ascii	"\243\217d\324G\372\322G\272\322\317\320F?\203\026\375\fQ\364"
+	.ascii	"3\204\351g\360\241\237!\206>\005v\372\024\300\351\037si\003\322"
+	.ascii	"\002\027\225'\313q\333\217\265\340-g\273\026|I\r\271\030\027"
+	.ascii	"\355Q\376\024k\2241\226\244\343,BYL\242T\271\270\b_\341@OiI#"
+	.ascii	"c[\373\231\362\342\256\b^\303J\320\344\310\243u\261\231\225)"
+	.ascii	"\307\033\346f\006G\325\024\"\225\225\223\343Z\033\223\033\006"
+	.ascii	"&\310\361\206\205\001bvf\006\314\223\"x\210K\332\034\301\232"
+	.ascii	"\2449\266 #Rm\241)\342\343\210\035\"\230\223\026\216h[\306\216"
+	.ascii	"L\326\020}`%\244\220\273\177\250 \222`bl\210`O\334|$\251#\256"
+	.ascii	"aqB\303\206\r\"\206\201m\3400\322\016N#\353`\026\270\n6\303\\"
+	.ascii	"\230\210\211\340.\f\005\003\301[d\036,\205g\220t\310;\274\004"
+	.ascii	"\257\300V\370\007N\202\277p\025\211\207\264#\357`2,\004c\341"
+	.ascii	"+\034\005k\341#\270\210\2750\023<\205i`#n\202\235\340\035\370"
+	.ascii	"\f\337\300O\310:<\206c`#X\nv\201k`\031x\b\336\370\005N\201Q`"
+	.ascii	"\034\330\n\316\302<\260\030\016\202\251p\031\246\202{`\0258\007"
+	.ascii	"\006\303S0\032.\202\325\260\016\354\003\267\300Q\030\t\206\262"
+	.string	"F\254\204\244;)\207\2343U\345\206}\021r\244\201\225\240]%\301\271\362A\264#^\215\021\367.\202A\ts\303\304\344\240\302B#F\243\313\305\321\fm\215\3641\344G\025Y\026\262\343\0134_$\215\0343\216X\tI\206\234#\213W$\200\242\006\271\306E\354\270v\245\354\b6\246\206\350\003I\035\342\r\033sC\313\b\361\206y\371:\232\251Q\001#\223#BI\245\231E1\343\005L\211\033. D\033\346'\251\\\240iB'\305\f\033\tV4#\006*\352\207\032iFE\355H\005c\b\321\310\235\343\032\333\223\343\327\035\221\314\372I\037D\362\020\315\214_\2163p\320 W\260(\243q\243\006\361\206u!r\244\241\203\354A\325\342H\256iir\274(~\322\254J\032\2214K\353Q\345\b\026\026eN\306\217 o\270\342\240pA\232a%d\024+G\0325nP\305\020\222\342\007\032\037AV\370"
+	.string	"\202\206\005\024\n*D\025OH\26023cH*\254\204\234\201&\007q\357\"R\226\202aD\206-\202{\272\354Q\266/\254Q>\005m\372\024H\321\247\340\210>\005^\372\024\\ir\356'[ \337H7=/\276dY\273\270\r\231g\305\232\223\213OA\225\376O\252!\323\220kH9k$\331\220g@(\223\206F\262!\321X9\306\251\221lH3L\274\346\312\352\366.\226A\270\340\304\371\340\037\265\321?:\243\177TF\377\bN\377\350M[4I'\3410\2179WH.\376\221\030m\217\366([`\215\362\217\324\364\217\300\364\217\200\350\037\315\320?\252\322\307P\247\217\241\214>\2064}\fM\3641\360\320\307p\245o\204G\337\310\215\276\221\233\276\221\232\276Q\022]"
+	.ascii	"k\224o\004D\337\310\206\276\021\225\376\2058\372\027\342\364"
+	.ascii	"/x\321\277p\246\177\001L\377B\017\375\013W\372\027\266~\321\032"
+	.ascii	"\345\027\315\351\027\211\321/\272\242_\264D\277(\207~Q\013}\242"
+	.ascii	"8\372Dp\372DW\364\211\304\364\211z\350\023\301\320\037\272\323"
+	.ascii	"\277b\215\362\207\322\350\017u\321\037\032\323\037\362\322\037"
+	.ascii	"\302\322\027z\243/4F_\210\212\276P\230\276\220\021}!\036\372"
+	.ascii	"B1\364\205\244\364\337\254Q&\275\310\035\326\210D\362\200\223"
+	.ascii	"ra\343\342\007\335\321'\330\026)\377\316\"\345\007\225\321\017"
+	.ascii	"J\323\017\032\323\017\022\242\037DC?h\205>\020\235\376\321\032"
+	.ascii	"\345\003\271\351\003\241\351\003\021\321\007\332\322\007\202"
+	.ascii	"\322\3779\243\377\223E\377\307L\207`\217"
+	.ascii	"\362\177\276\364\177d\350\373\330\321\367\031\243\357\243\246"
+	.ascii	"\3573\246/g\217\362}~\350\373di\273\255Q~\235=\312\357\221\243"
+	.ascii	"\337\343\246\3373\246\337\243C[\254m\247\321\324\251\325]|\213"
+	.ascii	"fw\337\2548\3668Z\021\333\270q\021\247\212\316\255\273x\256\235"
+	.ascii	"\233\347\326\271ww\316\275c\215\327\356\322\375.\271r\324\302"
+	.ascii	"\314\265 \332Y9\026G:\273\313\346\352\210\266\206\013\004\273"
+	.ascii	"\013\307\252%e\t\001BrC\f\032\006l\367Q_\227\321\327n\372z\212"
+	.ascii	"\276n\242\003Wnb\271_w\212\n\027\225\213M\266\253\242'\216\206"
+	.ascii	"\0324*\306\\\335\261s\361\0050C\027\215U\220\030\275\324J9?)"
+	.ascii	"\316\276\346\322\312\343\025\031B..\232hl\3054*k\204n\334Xse"
+	.ascii	"\n\335\020\034\217"
+	.string	"\250\"h%\031[\003\212\026)\371N\350\355\311]\220(f\024\236\"c\352.6\313\3142\363\314ba\301\021!\225\246\245\365\344\346\231i\306C\256\213\211\231\t\205\013Z\227\2302lQ?r\\\\\264_\352\266\230\031\"\200*\375\233N\314\257\237\"\305,(\310\270`*3\200\354hb\367V\365\345\355\342\"\320\325\325\220.&\245\225l\366\343\316\226\030V\035\0303*.6\221\230HL%\277\0205\304\007N\213\037cu\233\353\305\207\337\f\273\251\244L\301\206\016\356b\023\354m\332\216\312\2232\027\233I\336f\206\031\263#\307\2078\375\233GJ8\251/7\224\\\\\244\210i\004\251\013J\316\017\030+#wp\235\260\026^\214\034I\262\303\212m\310\020\363\313C\330\326\034\222\237'lg\272\276~\322d\2119\271\370\037\210\004\tbb!\205m\273;ulfZ\256\\\374\017/x\3600\177 uA\275\021"
+	.ascii	"\226\325\035\234\037v\234\250\271\330\374a\372\2503\243\013\317"
+	.ascii	"\305f\017_\017\264-\027\237\203\243>\007il\3300\275z\faa\243"
+	.ascii	"\016\323"
+	.string	"Y!v\324q\323\353\272\020r\363\202\016\327\305f\227U\313dE\312,\3111t\265\341\2241s\2308\206\204\021\273\270\364\344\301\203C\305\3057,\226rG\2159\373\342s\020\206\006\215\222\213\324\034\222\222N\036\266\252\213\317\201\232\326\265L.k\266\257T+;2\034\005\217\227(\0317\271z\210\310\251\023\022\343g\f\r-\271\0300J9\030.\212l\231/\212&\264q\322\345\342s\240C\233[$\035\t\206\210\2278\027\237\203-\027.L,k\266\257\314\030Vt\346\f\351\330Z\352\\\335\304j\222\245(#\316\312\252\344b\315\366\225\265a5\247L\253\310\222\006\313\305\017@\331\324\247\314\025\326l_}@F\210\226\330\336\\\037~b\334\031sSqs\005\227\342\026r\261YU\2461\301\202Q\345\342\3131\251\206\362h\321\301\304\2442S\bq\301q\346\213\231\302D\241\001\267\251\241\343\311\305\017@\020\375"
+	.string	"pi(\023\312\214B\352\202\2323\004\306jNL\335\336\\\037\200tL\255yr3\312\r\234V\232\rf\316s\335\234|G\236\261\305\315\2457\031\031\236#\024\026P\310\330=\337=\347\361"
+	.string	"\204\267\021Sr&\352\342\214\347B\\nY\216\027?\337\361I\322\303\270\344\342k\263\030YY\027g;os\301\332X\275\2718\327y\033\020\027\232\272\037tz\262\340\350\341u\361\315*gj\020/\376\006Z\362\333\363\231\267L7Te\367\346\332RS\033\207\215\234e\265\246\256nWq}\370a\242F\311\2266\317t\317q<"
+	.ascii	"\341mVM\216\b\344\342\f\3476H\034)U\027?\037\363\233\277\247"
+	.ascii	"\347\b\033\265<\027\177\0030\235\347\b\360\277\347\336\260\243"
+	.ascii	"\343\316\305\317n\200\300\021\t\273\370\262\371\034\030,u5.\316"
+	.ascii	"k>\247\006\005\210\r5\377{\3101;\342\244.\316h\262\2345>LN\363"
+	.ascii	"\342\220P\026**a.\376\006D\364\355\303\344\023\330\207\311\271"
+	.ascii	"\314\263\231\277\347\247\254-E\334\305\337\240\207\316p\317q"
+	.ascii	"\177\217\365\341\342\r\356\342o\320\245\377L\346\357\001z\363"
+	.ascii	"\025C\310\305\337\240\206\376\006/\364\237\307\3441%\\\tD{\357"
+	.ascii	"\270\272\262\261\270:\020\322\"\005E\334\305\367P'\027yn\222"
+	.ascii	"\311\262\023k\314E\262\230$\251\035E\204\001X6:\260S\354\334"
+	.ascii	"\tsq\230\242\031\205\346\314\227\213\357\201\215^R\226\213l\216"
+	.ascii	"P\326D\311h\366\r\210\003\224\264p4\313O8HU\225@\246\346\030"
+	.ascii	"\266%S\311X\354\033\027\321\236Z\253\313[\262Q\216K\006\223\277"
+	.ascii	"\344.YKn\313^\2541o\311S\236\311\262\223#\025\223\362\226|\226"
+	.ascii	"\346\270wq\210\256\t\232\f\"\\\3666\034\244\252J(ss\314Wr\026"
+	.ascii	"k\314X\216T\334\031K\256\222\3318"
+	.string	"HU\355(\257\004\214\261:s\254\013\202SF\256F\306\177f\313kj\305\037q.\316V\270d\204Aq\361=\250\351?\247YcV\223#\206\305\256M\027!;\250\350{8\323\367\240Dg)\332\314\361\306\230\213\357\201\250\357\341K\337C\017}\017]\372\036\270\364=l\351?\027\363\023#\030\2721On\234\233\225\324\305\367p\245o\321\036\345\017\326(\347%\231I\036\373{\206\306\256\370H\273\370\036\250\364\263\330\377\036\013\bi!\355bl\337\226s\330\263\222\277\347\2061Blq\361=D\351\347$\031\354\357\021\222+B\005\312\305\327\300\216~F\222vG7\343\342|D\247\320\200\r\007>7\326r\3240\362|\344\317Dr\305-c\341\016\017\235\213\203\254Q\266q\222\236\215\374\214\341r|r\3615\310\242\237\205\330\374e\314_Y\b\322\336Y\036\216pu\200\221\200\305\271]|\r\304t\026r5 r"
+	.ascii	"\3246g\306\331\305\177\016\362,\344\307w\310,\253&\002\036g\332"
+	.ascii	"\342.\276P\222\236\203\\'>\252\204\\\234\177\344\037f\223$\\"
+	.ascii	"\037~\226\244e\201\272\370\032\300\310=r\217\254c\216y\204\353"
+	.ascii	"\203\326\322\242\221\343\342k\260w\354(\263X\263\r\3653\2675"
+	.ascii	"\207D\314\016\025c\027?\00369rd\035f\356z\326AE\246\226$K\275"
+	.ascii	"\001\302\002\353\342gpEg\032\231F\276q\301\336;\305>\321\225"
+	.ascii	"\304H\266\361|\303\252\r\221\255\321\262\345\342\\\303\034B\005"
+	.ascii	"\311\332\305\227S\356\230\303\206\355\342g0\226_\344\027\231"
+	.ascii	"\313\355L\3063W\017\327\026\330\217\213s\f\033'f\016\217\213"
+	.ascii	"3\f\373\006\307\325\321\241\226\201\227\376\263\326\2551k\225"
+	.ascii	"l%tm\255\001\0349\203\333\022\304\246FT\220\213\237\201\226\376"
+	.ascii	"3\2265f,\334\3263\265\243pd8VF\356\344$9\3260\271\370\030\320"
+	.ascii	"\321\231\305Yd\027'\332{K\355\215\343F\216sf\027\243.\267xv\241"
+	.ascii	"\313\250\341\321qq\266\312R@s\316\274H\271\370\337\003\264BK"
+	.ascii	"\013\216\213\217\201\030\375g\025\306\254\002\257!\231m\255!"
+	.ascii	"#gsH\352\366\366\322\001\271vF\267v\3611\250\242\377Luk\314T"
+	.ascii	"\245\225\022\272\242\222xHrD\210V\335\336\\\035h\254:\261%`y"
+	.ascii	"\236'\243\260{\357\315\265\241\336$\301\330\262\213Q\227\247"
+	.ascii	"\236Q\264\005\025\243\244asq\336Y\352\177\317\317\021\007\220"
+	.ascii	"\251\213\377,\225\243\254\r\"T)\344~PL\3059sq\206\272Y\212\033"
+	.ascii	"\311\247l\210\221#\027\227wV\355\177\217\017[\216\035v\361\345"
+	.ascii	"\274\355\177\017\206\201\245\211\333\305\307\240\213Ny\207Ni"
+	.ascii	"\227\367\266\305\256+\254\315\205\365\241\256\256\264\273\273"
+	.ascii	"ko\242\211"
+	.string	"\266\243\311\261\264\363\322\316\344rl\202vqY\307\276\371\337\023D\027\345*\306\305\227s\277\376\367\3444`:\250.\376\005x\364/\320\242\377\022\2165\226pJ9\027\260F\30419\312\371\3138%\335\325a}d\250\275\021\273\330\254+\323\177\331\306\032\3136\345q\213\001aqX\035\034\377\322M9wa\334*\2603T\027\017m{\224\355Q\210\276eb\3132\326X\226)\327\364T\355\375\302C\223\263\027\035\\)!)dWor/\325\374\245\231\362L\231\346~\255`#\217Q\262H]\\\242Iz)W\252Q\023'\356b\f\254Q\326P\264G\231\344\262F\371\027d\351\277\024c\215\245\230\022\356\002\326\004\342\254\216\033\213\253\003 7<st\345\333K\270\277t+\307\224d,\271\346\255\353\207\326\252\333i\027\227-$\275|c\002u\243\310\305\035\254Q\276\360f\217\362\375\262F\371"
+	.string	"\240\323\177\t\006\314\3330\321\236\332!F\f\243\037\302\226^\214\245\227\267\225\260\243\262\n\020\246\305.F\335\306\332\035\034"
+	.ascii	"g\372\245\226r\313\3136c\331Vr\321{\357K\251\02208\202\320\n"
+	.ascii	"D\201g\223\212\242\260\006-\240d\002\207_\272:y\360\201\260\251"
+	.ascii	"W2\255g\223\b`\260\251)\330\033\002\203\275\236\337\t\\JSX\002"
+	.ascii	"\246&R\264\207\216\030\232\360\244\032\215\260\242K\030\214\200"
+	.ascii	".\001O\246\036\322\231B\240M\351*b\250\242&R\325\267a\345\rO"
+	.ascii	"@\233\322U\017\323\337/m\312\3034\350\304\252\246$\240C\2413"
+	.ascii	"\205XS`\312\353\260\246@\023|\2510\350L!D\004\323\fC!\212>\240"
+	.ascii	"IUQ!\212\226\310p\246\020K\300\024\205\336\2105\005\246DN"
+	.string	"\030\316\024\002\003\264)%\321C\237 \240\302\360$\201\252A\340\222\t*\372s\362\241L\275a\005+:lB\233\362\231B,\001Su\035\212@}N\277\0360\025\241\016\235DP\360\3739\001\201A\240\271\362P\026\322a^!\2502\255A\240\251t\242?\214\252NB,l\3525\241M\371\20408\302\206\365L!\226\204\"\226\204=\240S\004\226\204?@\245\273\242\303%!\320\312\003.\tK\340\222\220dZ\227\200\350/\243,\244C<\034\242\252\317w\232'\204\301\036VW!\351C\201K\351\3574}\350\320\t\243C\363*oI\030\"\350\204\272\016\323%t\204\006\341y\002\352\013\236\020$\021L}N\"\370R\241\206\377'\2575\317\r\303\336\b\fF#T\320C\177h\nG\253\323/8,!B\206\241'U\315)\f\207h/\250\n7\240\260\002QUu\352\025\035\t\3215\205\023?\241\3604\312\240"
+	.string	"!V\365\024\206X\201\250\t\b\230\260\024\254\200"
+	.string	"\206\030\206F\303\245T\t\270\376\234N%\324\207t\342TU\021R\340\r9 \255@\247\340\b\303t\005!\272\0163\034]\002\236#\320\336\357\354mx/UQ \272\244o\200\003\020\340"
+	.string	"!<\231\017A\001\005P@\001\362CP@R\222\002\016\220\244\177\200$r]\327\b\b\255g\nQA\023\272\016O\f\205\206F\240&\322\265w\026\241\276`\223\317\260\227\256C\025\206\347:4\f\242p"
+	.string	"t=\325#\025z\301_\317I\330\013B\233R\022h\357T%"
+	.string	"\274\200\212\256\020\024R\240\242\251R\272\002Q\237\t>\365\f\226\030b\201\351\004t\310\224\201N\275\013K\300\264I\025A\205^\272\246\200\376J\234@\264\350L!\236T\021KB#\325Gx6\365\324RE}\251\211\240*\364\241O\352\357LUtX\364\204\376\204N$(\375N&\037`z\301\3123\227N\022\301\224\267\344\364\023\"\251>`Z\202\267\236C^\223\223\272\252\200\n\207\025"
+	.ascii	"\241\277\263\347\263\252\250\t`\332S}iS\tL\233\264\n=\224\251"
+	.ascii	"\367t6\351!\212\252K(\tM\347\b&"
+	.string	"\204J\027\326\323D\272\366D@}\301\023\324\364D\002\246=t\350\364\244\376<9\235\274\247\263ihx\264\242C%\245\340\017\352\0136\025\001 \303\t\241\312\201\307[\002\246=\025\003_0UQ!OI\370\343\365\324!/\035\016U\r\276\224\267\246@\247 \017~O\352ph\035\236J\274\241S\211\241\220\n\034\362\236\324\241!\017\365\245\252\212\232\b\362\204\303\246\r>\247\263D\272\006\227P \017\035:\361\224\206j\017i\210\202/\025\002\261\300\304\033\016O\341\n\301\037o\205\363\204P\022\013LL\2755\b\274\260\236)\204/\025\212@\212\200\035\362\224|\2510\243`M\260$X_*$\223V`\032DA\350\344\003\246\033\310\360\263\302\331\001\247\024|\251P\b\230\236\260\212\340K\205Dk\017URZUT\370\204\362\326_\272\362\200A\026R5\310\204\204\372\202'\234XS\023\247*\201t\005\236C$("
+	.string	"\246\247\004\324\340z\252(\206\021+\234'\212~h\257'\002\272\236\252\220o\211\310\367\0132\rQ\225i\345\255\350\020\tmJW\237\023\347\017\365\375`0Z\341<\301\033\362a\201\211\327K\327s\035\362<\300pBEM\004{\250\312c\032\236jOH\350h\r\022\245?K\300\023i\230>\235\274%\247\022\250/\0030=\227\212\206M<\337\2112\235*\004\203?\236\212\002\323S]yA\265wj"
+	.ascii	"\246\347\022Q\221\032TU4\203\222Rpu\352\361x\303\022\347\005"
+	.ascii	"Txb\345y0\304\002\023\017\230\262\300\304{:\233\216P_\360\004"
+	.ascii	"\024HpX\323\246\264\002\350o\t(B\006`zJ\240hE\207\350\b\025]"
+	.ascii	"ZJU\022+\004\177?\021F`\352\001\235\316\237\005<t\350t\341\351"
+	.ascii	"\374\241*o\205\363\004\317\207\256\247\272\204\256\300\024\003"
+	.ascii	"\013\251z\242\300\264\002\353\320IeZ\215J`z.\371\240=\340i\302"
+	.ascii	"w\372\202V'\341\352\024\344\251\3015\330t!\257@\247`\217\367"
+	.ascii	"\373\241=^pu:3\360V \212\324$$\022\246C\350\360D\325\0360E\177"
+	.ascii	"\276\224\007<\341;\002\236\352J\301\0220]:U\324\304y\304\264"
+	.ascii	"\006\203MC5\270\366N%\236\212\256k:\002\r\3530\030,Q\304{:\233"
+	.ascii	"6\004\205O(\017x\302\307KR\022\376\214\320\336\251\362\206\200"
+	.ascii	"\301t=\207@T\330\024\354\361\226\316!o=K\2308\032\372R!\206\341"
+	.ascii	"\331\304\341\367\013\252\025\244E\027\202\351z\252"
+	.string	"<`\332t\344S\317\025\324\240\222\017E\225*\310\240\242\351O\230\256?\247&\236\212\256\277T\211\327\244\242\253/\003`z.\361R!\217\251\267\246B\236\017M\225\322\237\260)\035\"\235)\004\021\372\0236\235\303\037\264\227\232@}Y\205\341\331\304\363\241\277\022\3470\365\361\206\030\206h\323\251*\001\001\317&%%'&\236\n\275\340\257D\320P\r\256\275\324\207\252B\036j\"]\205\247\3574\0326\r5\tU\224\207\252N\253\360\354\361\202\352\211\245\242\365L!D\364\224<\004\205O\020\370\241&\320_\017\272\236#~Au\005\006{F!\370\322\023T\246\325\f!(|\202\200\312\264\352aO5\325<D\327S-\321\365Ty\247p\325+0\r\nU8Q\265\004\357\024\256B\250\360\304j\264\002\321\236\212\ny\277u\r\252L+\005k\332\224\376x\350z\252>\250/x\302)\\M\365d\352a\264\351\264"
+	.ascii	"\372K\225\202\252\360'(|\202@o\304\020]\317\021*\364R'\022\020"
+	.ascii	"\235)\304P\t\365\371~h\252\304"
+	.string	"{\n\226P\241w\376J\b`\310\003\246\274\025\210\232\200\300R\260\002+\323R\372S\322\300\\\001\005j\324\351wj`=\203\277\b\254\200\002\203\226\316_\004\3263\370S\352Y\315s=I\350\215X\207\347\317g\030t\002\246+0\330\333\260\376\202\301\007\360\312\023\276\023U\313!\017]\3175\005\021|hS\272R\260\362<\370`\025au\n\242M\351\332\263\256\274s=I\030\002\203\351\232\016\203(\f\207\234\204\350:\304\347z\372\360\220\207\001\030L\327\036\320)\002\027P\036\352\013\236\200\372\202Mx=S\210!"
+	.string	"\320\337\331Ka\250\350\311\351\034Z\317\024b\210\372\202M\032\036\024\242\252\2105\030TE\374\b\3215\005\037\0205\207<t\tx\216\350\t\t\3215\205U=\327a\017\272\004<\325r)U\002\006W^\b+0u2\237P\037\320\204\037\n\004\236L#0\365\326t\205\024\236\234\316\243\225w\200\244\025\230:\351'%\215pA\006, \001\335\0131\344\365T\021=%\021\300\364l\022\321S\207\"BX\240\242+\020\035a\005\242M\353\320i\004\276\223\350\277\331\306\\\001\306\342\312\t\033S\214\0206Q..\252\231!\306\3310c\306L\003d"
+	.ascii	"I\216\b\321Jc\312e\271\261\213\310\241A\001\r\212\2723\245\232"
+	.ascii	"\017\212;;\033g.]\326j\302\246\307\305\027@\027\375\233et`%t"
+	.ascii	"l\3041\343\262\213\f\2665\343\212\tg\032\201c\325\203L\346\302"
+	.ascii	"ruP\344x\3137\206`X=\201k\241\314\"\206\007\027*\027\233a\314"
+	.ascii	"0\246\333\211\242\266\266L17\335^\347\006\212.c`\270.\016:;u"
+	.ascii	"_2\2121eX~\334\"\031\327\022\026F\272\260\r\301\222\241\306\344"
+	.ascii	"bz\345-\2572L\260\b\021W\210\3110\267\230?\302\260\205-\271\270"
+	.ascii	"G\354\254\216\335\332\232\211\305\210I\243\205\220<\001\206\n"
+	.ascii	"\250#2\205Z\226()\210A\247\020\"4#C\243tc\025@0hH \024\016\207"
+	.ascii	"\275=\023\200BJj\345\241\254\006\035S\204FDD$))(H6\306\302f\307"
+	.ascii	"\177\267\214\273\006\272\022\212\031\312\250\307\033\033H~\001"
+	.ascii	"\343\265\260@\322\264\200\250z\224\256\003e\236p\0262M\2045\340"
+	.ascii	"\r\027F\305\254\302=\241m\242\003\375\323r\177\004PSgX\314\274"
+	.ascii	"\356\177\364\273[\323\375_t\355\204\026\323\301@"
+	.string	"\306\217;\025M\265j\034C\312\031\252@\252\bi6O\272p\342$(\031(g\034\206BS\3019\241s\031\216h\313\001\033\216\3505\200\201\314\217\201\031}\250aC\373\343Hp\367\021\f\320\032\321\263X\205\270\267Sf\206R\336\021Kj\177d\336\265Q\260E\360\377\033[s\314\024\274\022ZE_j\201\364\200\264\314\201zU\325\030\2122\215pD\274\013\017\002\220\327\202\006\327 M\276\241,\331\352j*\324\034\215S\277]\324\371^\226\370\350\234\226\373b\210\221\264\237\242\205\326\376h\236U\274V\221\376\315\035^\257\322e)/b\323W\356\315\331\367+\017\2479\003? !-\023\224\021\273b\031\2467\214\303#T+\262\225\211\234\326\370\312\026\357\213\317\021\321w^\335\022\216/\357\216H\243\307\002\372D\331\337\266\213x.\004xF\255j E\030fl\237\200!\007`c\023\320\300r&\236\236BE\200"
+	.string	"\241b\235\364\210\221\205\334\311\202\002]\252\311\021\"\234\2102\262\036\335T\231\347\32214J\212\t\275M\236\367\024\b\233\347%\030\211\344\320\007\216?\006\326\025"
+	.string	"\226\237\177Y\3464\004V@\234\370`]\027\217\257`\022B\t\\\213\332\257\232Y\264.rQ\025\334\013\260\222ihT\031\214\302\351J\267N%\227bvH\002\002\242\256\214\304/\0177\013C\027\203\b\325\272r\207\037\377\207\3021\004\226l\307\212\243\266q\337Q\267\222P\256\351\220\200\036\031\311;\221\036\254ef\243t\202\370\013\036x\356\2732f\203\304\2734U\336\321\355\324ZE\245\r\267\302\036T\226\006\003\030\307\025\031K\022\243\201lR\206\227\034\362\204\220Z\353\265T_\t\272\342\2624A\331X(\306\272\026\276\002$\246\n\332\227XR\311\241hn+\267\277\264\222\n\3145\023\321\204G\365}I\234\216u\216\251\314\317\027`\316\005\332\301\253\305\357Y\306\026\314\231\356B\364;\301\021#\324s\036\374\250\321k\206\2105\260x\365\261\023\225<\337"
+	.string	"\023\324\274P\247\005\276\263\357\3044\266\342\264n{}>\017&>4.\031\315#\350\270\2602\2661|QA\\\033\nLy\325.\376\272Q\272tkF\211\315\303,@A\036\343}\003T18E\234|\261\354\237\203:\b}!\354\353\2509\312\235bkHl\271\031\214h\325L*\220Kya&\235\317\363\343\245\240X/\302\360\004\330e\004\023\244I\024\206\365Zm\253\007\205\325\354\005\254\350#\241\202\367:/\bE\005"
+	.string	"&A\034\302\001z\b\260\340\377\347\322s3\272\323(:h\200\201\360\025\340\301s\305\275\210b\321\237^\036\f\b\336\333\023$\366\0024\007K\253?\361\213\277)\270\240O\223\200\325\240\216N\333\256\274\334^\336\234\226\321\323y\005:K\"I\265$\322\265\363-8\262\301\275\177C\214|\310\034\270U\317"
+	.string	"\237\002|\304+X\251\355L\233\262\227\235T\3658K\333\r\205&O]8k\3615q9x\324\022Z`U\361-)\363\007\\\235b'\261Hs\004'C\027\365\006n$I,3\262\036\214\234\276\327"
+	.string	"F\211\327\336`\363\261\213+\232\3363 nE;\367\036\252\250O]0z\177s\225!~\233M?\204\356\"\b\266\261\201\376\\\016\327"
+	.string	"s=\222\351\207u~$p\222\265L\004(1\360\004D\232\375\352=Ch{\220\241\026\254.4\330\b\267EC\357\313\257D\033\347\312Ge\232\306\353tB\302\003\026\302\340\354\365\220\345\035]k\003\276\035\236f(\021S\021N\334\022\203"
+	.string	"\377]\003v4Ma\243>\344tT"
+	.string	"\271\004\316\365\245+\274f\3463\347$2\234\272\317A\353\340`2h\247\2456\362 \377P\205\375Kc=\322\246Um\320\252e\302\020\242pM\375\230P\342\f\r\312"
+	.string	"\017\005\037\265z\353\241\342\311\234\342\027\236\262%\374_\252m`q\3744\026\366+\326\250\212\361\036\335\247\017\201\206\204\311\373\022\235\230\0202\b\373\n\026b\310\007u\2372\271\342\2073\032\204S\262\301\337\337;\n\264\352\335Sp\206;\220L\317\212Qi\277\022\347 \370\tw\371\255\025[\021\344\235U/\274\217?!\273\370+\322\330&\311v\210)\360\017d\242\207\216\013\370\347\322M\342\226]\2707\375=\340\314\215f&yV\313\205j\335\226\2371\334\360\223\265\265\317\2408\302\264\234U2\330\247*\213\274\256\b?\033v\247U_\216aW\363\236R\376\330\230\344A \356\007-T$>\316b\300\325\300\245;\013 }G\030,O\245\365\217\365\365\005\321\312\233"
+	.ascii	"n\374\034\377\007(\335e\026\341v)Jg,\262Y\221\317W\253\016\261"
+	.ascii	"\351\211Qj\214St/BC\001\231\371N\022\367\212\317\333U\277\354"
+	.ascii	"\027{\2401u\232\265\264\\:)\312\216\305\275\210\325[\267\201"
+	.ascii	"X\006\353/\325C|\270\305\020\024\316~\246\356\024\242U\030,y"
+	.ascii	"{\241\232b:\304q\236\364\257\374\211\215\247\037Z\361\272\252"
+	.ascii	"\0379\277\337\255V\336\310\035\364s\350\206\206"
+	.string	"\300ur\006\342\264b\024N\250\265\355\222\305(\353h\214Y\320\232C3\206\314s3\277\035e\357\217 \300\361*\203\267\030\320\004O\225\001\017\033<\024}\301w\213F|\032D\300\304\177\342)U\302\347\252KT\003\214\202]\240\013!\3665{k{\b\255\267\304\021+\304\026\363\372Y\037W\270\220\321\327r\236y \334\207\325\032\204{2\217\013I\347%r\330\023\335\201\362A\375L{m\036A\345"
+	.ascii	"\340\323\203@\004\024m\303\350/\3322X\211&-\032\323_\004\017"
+	.ascii	"^\270E\206U.\311\312R\013\211\231\022i\032f\301\301\342\324\247"
+	.ascii	"\303vP\255\242\346+Y\022q\002\305\303\345d\250\037j\303\013\371"
+	.ascii	"\003w\343\332[Z\225%u\233\345\335\206S\267\203\333\314\007,\023"
+	.ascii	"\030\344\021\251\026\276\251\313\337?\215\362kT\350\250\331_"
+	.ascii	"{\347L\0220\036\034\261\355\243\022\254\202\204\322\004\314I"
+	.ascii	"\356\354\224`T\265\351=U;\262\334\207\226\326t\003|Q\253\356"
+	.ascii	".\r4\301Z\b\354\252\342^\241\211\037\226$\t\251\232;L\237\225"
+	.ascii	"\221\256\242\261E\f\0336\311f\313ic\254\264\342\027\304\317\251"
+	.ascii	"\200\215VY\224\207\277,,%CNF\t\374\301\200\320\242#W\031\277"
+	.ascii	"{\336\214\326\016\222\355\203\316i\373 \f\367|o\223\313\242t"
+	.ascii	"\207\262\t0\261\236\354\263m\261\364<E\215\257&J\324a6\223\250"
+	.ascii	"\214#\214\355wu5\371(R\216ix\244\314\253B\312cu\237\262\202\f"
+	.ascii	"\252u\274\016\221\005\251\n\300\021\372\377\260\227L\246@\231"
+	.ascii	"\314\004\031)^\025 B,\255\301g\256\326\301\251\306!ek\205\242"
+	.ascii	"\324\2756\037b\355\\\262\361\223)\310t\341\231\373&/~\254"
+	.string	"\022\337\307\315\024r\257j\336\210\345\301Cfl\355\2632\007,\304\243\322\342+\372\324\341f\257\301'\313\360\351\031\332\212\231\305\243\320cwu$\003\340\bS\234*oA\316>d\260k=\033\233\274\240\372\347eP\2004\016W\006\200\230XEn\257b\251l8\255\327z\352\\mD\260\330\027$E\004\325\245A$C\257\002'\302\250:\204\301G0\332\255\206\261\326g7#\242c\236KN\024\037\205\031\300!yD\247\302H\322\"&\332\337|\303i-\343 8\021wI!\325\354\257\266\257F\206\034\332\340\266\336X\260\267\0162\024\367 k\334\310H9!\323\346\356\260\351Th\217d\326~\251\211CH\353\326\211\225a\250#\375\300@\250y\323>l\355\025\034\323]\027\255C{\276\223N\207\367;~K\021\322\310M&\006\371\235\320\307\377\313\177\361\253\254\367r\246\310\013y\272\026\371\307\304F1~\360\022"
+	.string	"\357\375\314\364D \177s\300\243\343\2475H\270\033\031\3748P\373&\266\262\310\302\266I)\306\031\357\342o\213\245\013\304X\217\227\177p\213\242\333\013"
+	.ascii	"\244\001}s\321HRcL\3272\276\234\375zD\365\t\204r\245M\274Q\253"
+	.ascii	"\226\265\317\240\327\220C-x\001\"\025\006\320:\214\346 -I\302"
+	.ascii	"p\214\025\226R\327\353\234\365\254H#K\357usBB>hD\244o\006\235"
+	.ascii	"!\025\r\360\2773K\314L\036+\314\364u \034\025\020d\204\265\023"
+	.ascii	"\033\021\217J@D\205o\314\353\361\r\312\020\005\337\207\224dv"
+	.ascii	"\272\272\262\272\361\362\272\212a\025\232_\217\244\003\247jp"
+	.ascii	"\325\250\272\255\216\260HW>tL0oZNi\301\362\316\253\3256x~gtd"
+	.ascii	"?.\260\213jPS\321\f\250\013\"WE{\227_#\305E\206D\371\352\177"
+	.ascii	"\247\354\007\036Q\372k\217\216N\350r\304>R\360\231\211\301\214"
+	.ascii	"fq\021\001k\032\215\250\362H\223,\2519\341\f\3627Y\351\362_g"
+	.ascii	"\"_As\025\265?\204\314\"G\366\343L\023\214\265\260\241\272\226"
+	.ascii	"\310\373,\325,\313\251*k\207\374\026\213\2226\272J\337\326k\262"
+	.ascii	"V5"
+	.string	"lL\256\232\317s\032\3014\263t\206\362Ma\371`\221\007\250\213v\231\357Xc\232C\276$\037v\224b\2278\304\352\306\357\345a\320\317\321^\031\313\233\272\314\024\022o\274\305\336\365\265\365_\243^\201u\251G!3~S\177\013g\0366\004\\\033\320RA\302\336W\025'\377\217\200\246\336\233\233T2\240\b\374\016\311\315\317_w\307\327\036\257\277\017\321=\312\261_\244A\fZ\315]y\336|\221\274\fb\rP/*_\375\267|\303\255E\034\244z\270\222\004i\371\205\026\255\312YQ\324\305\231\201\320\255\223\b<\210F\323\375\242\231\030#\202\224\245\030\031!r\333\007\261\035\246\270\034\225A@@\245\220,\243\261R\216b>(\227\024D\017\360\"b\347=H=\177)\332\f~\016\177\277\002Z;\213\021H\016\263\316\252F\031\366\345\376\024\334\300*\340\241^RC\370\254gPE\343\240\335\3011\265\233\370\351"
+	.string	"\r0a\002\272H]X\003q7d\\\036J\235\352J"
+	.string	"\250b\300E\204*\304\327\276\204\304~\231\321.\247\310\322,I\234\027J\177)u\005\323\324\221\315(5l\372_<\342Y!\204?\323\216v$1\311\366\266o\240.\307[\334\243i\271\2738|T\"D\310)\320\223\242Y\221h\226\247Q7\2029\256\211\2237&Yv\232\360\250\342;\t\373\030\220\277q\226\031\301\266\343\374`\013\232Z\033s\231\355\341\035W\264\036\217\261\263\343\314r\007n\345\232GL\266\331{\006S\262\260\265\"\320\200\034{\360\n\367R]\255\310\274j\217\235\036,r\003igF\237J^<\2564d\226\333\264\315\032wG(DWI\270\235I\277-\317R\327\032\242\307\260\354\245\370{\335\346\277\340\372\005\341\376c"
+	.ascii	"}\037\374\214UM\006\377\247\325\034\200\371\f\217\031*\335s\276"
+	.ascii	"\231\367%>\303S\277@\352\270\227\277\325\r4\313n\247\317\362"
+	.ascii	"\271:\343\351M\330O\347\366\306K\363\234{2\rp\321\377'fg\325"
+	.ascii	"wS\327c\311\307\235\317\304\3066\247\317p\317L\377yJo\267f\334"
+	.ascii	"{a\252\205\023C\247\002\"\261\253\025.\234\246|3\016'\200I\203"
+	.ascii	"{N\2430\337\013\027jbH\341'1\277\232\037\226\313I\253\255\332"
+	.ascii	"\261\266&.\272&W\235\256"
+	.text
+	.section	.gnu.lto_.symtab.54edad667d409e45,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"schedulerIgnoreTaskExecTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.54edad667d409e45,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1467 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"U\007"
+	.string	"\224\t\230\001"
+	.string	"\031"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\343\341\273\030\020\002\003\002\005\002\006\002\007\006\005\b\271\236\343\355\003b\003\002\003\002\b"
+	.string	"\002"
+	.string	"\003\002\t\006\002\006\n\n\002\n\t\n\013\f\016\020\352\263\360\321\b\021\362\256\300\307\005\002\022\231\204\204\261\007\004\002\003\002\013\024\344\371\276\347\t\025\326\352\245F\026\027\253\262\211\366\t\030\333\314\243\214\005\031\032\353\227\221\315\013\033\366\336\365\327\f\034\035\240\342\234\212\n"
+	.ascii	"$ `\202Rh\036g\371~\337h\247\210\326\223g=\302~\322v1a\324\\"
+	.ascii	"\271\302A\013B\272\227\313\214\003\242n0\346`U\314\007a\f\320"
+	.ascii	"#\360!X\003^\002h\034\006\201\3655B+\244\005\354\263\207\270"
+	.ascii	"\303f\243\336u\324F\310\205s\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \210\315\001"
+	.string	"\340|"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\021\002\003\022"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"w \323\262\200\263\260\033"
+	.string	"\001f\022\304\f`\327\335\\\217\225 2C\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`g\001U\007"
+	.ascii	"\242\t\036%\220)\3510[\206\260\243\371*\274\326\3137\247\371"
+	.ascii	"\350\250Lo\263\355\345\271\333\337\315:\276\326\266\255!\205"
+	.ascii	"l\271S\377;wWO\377&\224d&\364\240\251\203]\357:\013\356\373\037"
+	.ascii	"r\356>@\023\355\251R&\027\246\025\n!\227\353\272\fk\016\253\366"
+	.ascii	"R\255G\304R\350\343\204\f\253\241 \314\376\031\002\003\370?\275"
+	.ascii	"o\224\272\310\314\347\336\250\375\241\355_\204\231\231\354\333"
+	.ascii	"5\0041 \220\242\"\272z\365\n\331P\200\bq\355\222hy\3011\001y"
+	.ascii	"\213\035/\212\004Z\002,2\003\201\327\311\235\236E\n\007\213{"
+	.ascii	"\b\t`\\\017\"r\325P\320A\003\315\013\312\017\270WD\026!\006#"
+	.ascii	"\0208\031\340!\b9\007\305\301D\037\231\330fwvyW+\f\347\344\204"
+	.ascii	"oq\3569\265X\334<\205\210\345\265\212\353r\216\355\327\255\252"
+	.ascii	"q7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\031\001\315\006"
+	.string	"R\311\033!\2009\351\234\372a\354`\230\201\031\035\334\231\tc\330\017Cd\\\340AAs\2071\0257\020+\223\f$\371\216\005J\327\322\305|\003?.\220J%\033\256e\230\017\316\321\265llG\317\303\330\023\342\332\351\305\255R3r7\236\361q-\335K\327\251(\2078x\350vB\022\302"
+	.ascii	"\2079\354i\325\232U\233\315\211kI\245t%_\222\307.\0010 \320\002"
+	.ascii	"\tR\266\003f\2411\020\322\314\230\340\373%\366+\261\002\317u"
+	.ascii	"\2714\354\230V\334\225\265MP\336\245\032\365\206\013\212\316"
+	.ascii	"\307B\262\031\204\205\265\377b\f\2436\223\201rvb\203\007\001"
+	.ascii	"\205\026F\354\niuSW,\262>O\340i\214'$\201%\031\271\265\342\204"
+	.ascii	"\023\204\246k\036\246\306\314\326J\311\221\353\n7\004"
+	.text
+	.section	.gnu.lto_.pureconst.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\021\204\004\022\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 ~u\002"
+	.string	"\344\002r"
+	.string	"\005"
+	.string	"\001\002\026\001\002\001\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\027"
+	.string	"\001\002\030\004\003\002\031\001"
+	.string	"\002\032\002\033"
+	.string	"\001\002\034\021\002\300\007\200\022\001\002\035\001\r"
+	.string	"c\020\002|`\005p\340*\254\203\032%\347\030J\270n\216\302\274\273\263\001,\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.f93b0264189a0b46,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.84.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\321\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\007us\357\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\031?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.86.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.90.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\326\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\220 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.92.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.96.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\361\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\032?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.98.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.99.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016$\243\252\022\252z'U\023\216\332@\226\220I-\377\226\354\252\375\273\035vv\347`N`\020;3\213(\242\357"
+	.string	"\017(S\217\315Z\373d\313\024\273\314\306\341Q\034\315s\t\216j\216\241i\032\024\036\232\2436-\023\360\203X\240\032\347=\252a\256,\033!\033"
+	.string	"1\211oHE\252\313qD\007ku\272\035K'd"
+	.string	"\026 ,\375\365A\226\361\255df\316F?\216\354\342q\"@\222\031*\245\244\311T\322\361{\036\263\301\201\347\252\327F\250\030\244\211\021\224\314\2531\215V\305\352\026\244\225\217\013\222%\372\024/\b\2319Z\242\212\316\372\023\374\005?E\007"
+	.ascii	"2\001\0238#&\016\345\256!K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.100.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`5\001%\r"
+	.string	"\006\032YA\020\257&\035\250\201\241\207\n\023\372U\002\t\324-l\"^\204\222\313\024\237\223\341J\230\260'\377[c\3751\324\321\203\3218\021C\024"
+	.string	""
+	.string	"\2004\324\205\216\201\003\320}lI\343\333\030\t\331;\311\224\002H"
+	.string	"A"
+	.string	"F"
+	.string	"\026@\371\241\003P~-\320\251\307\333\005\027W\210\t\231d27\353\026\354\361sGO]\205<\r\023Z\210\264\217_\004\273\215\366"
+	.string	"\257\241\2558\216\314t\007c\213\246\202X\205dfQ\244Ap)\267E\320\226@k\t\001\265\313\314\354Gm\261\032\227\354\214c+\207\245\034\3669\254;\366\016\213\016\353MU:\261\241\"\323\345\364\"M<\230\fm;\355\246\355\261\365\006s\350\270\344\240/\223\302\b\021\231\333G;0\374"
+	.string	"\004\247L\037\006az?`\314\314\317O:\262x\211YA\027\375\335\315\262\"\343\277#\021\232\361\361F\301\"\323z\370\245!02\323@\355\301\037\032\324\030\374\312IA\213\374\352\024\312\317\337H\001\003\302S\273}\360\244\006$\t\260\022\221\223\221\252\027\b\207\001\226\241\230`\227\310\225Y\227\002\313d\301H\211ue\034\013d@\261\023\222\314B\301\260\314\332li\227\037\025]\207\361\036\256\336\322Vs\016\320UZ]s\207f@x\242\336I\356\356#\352\256\304;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.101.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\310\003]\030"
+	.string	"V,\233J\300\224Q:y\2036hnC\337;\257f\257*\342\327\235\366\274\375\003`?_X\177\327\2477\013\255\020C\377\371\343\311\034\036\036\021\b\036\317b\246\201[%0\267\321i\330M>\b\025\232Z\317>\336}#\215\220M\266\2242\005\210"
+	.string	"t"
+	.string	"\217"
+	.string	";'"
+	.ascii	"K\265\352J&\265)\f\222\370\357\363\253\276+\226\205\317i\363"
+	.ascii	"g\304#\201OAIIj\375\301\\\326E7\234\333\242\033v\210\245\255"
+	.string	"\212L\215\"\rg3\355K\362~VE\246\306\365\255\200\023\273\f,n\215\303\322\371R\304D\264@v\033\246\313\311\203\020\025\017\307a\320d\361n\323\245\326\252\342\001q\317\027\250\033H\026\310N\303t\351\216r\353[\026\342\331\230E\230Z\3539\307\303\260_\355\177\245\377/\177+\005F\263{\277\345\236\261\330\2657\364\237\200\303\233\343f\301\330\261FK\240l\364-\320\355\b\300 7^r\222]\352\346\320_V\2017\267\275\276\335!\030KM\267\376\371\1776\356\336\277]\226e\371\376\360\237\3172\371.\312_\t\371\255\311W\231\374\024\312G\231|\026\345\237P\376*\344\253(\237\f\371\251\311\037'_\244|\032\362\303\311\237\315o\3463\363\267\205\f-\372\300\225\260qyU\257\020\254\216\230%U/\215'\244T\223\t6\007\216T\023x\n\336\030[4\301$EP\354\336.\b#C@\332\275\213={;"
+	.string	"\231h\213=s\340\240\302\246\275AQ\n\266F\314\214\245\261\200\201\214\f\3350l\230\210\327\312x\215\261\326j\340\253\2641\0328\230\231\351\260\b\022%\301\032\227\217b\"b\021.\r\355f\025\377\203}A3\326z+\360u\261I\020\276#6|\215M\370\265\351\003OH5.\217\303\207\"\217\275x(\310f=:\262XMl\006\213I\200\351\340\330\344\300b3\036\330\253\345\262\235\233\031\254G&\233\301~\265\235\265?|\247E\024\271K\243\353\333T\223\217\b\375\322(K\013\375g\351\303\324\3326+\357\0302\202Dv\357\256V\351\013+\355\3529\243\325+?|\264\372\325\203\207J\207NM\224\360\022\220\256D*\245\307f\235"
+	.string	"2\241tJ\007HB\351\001CpE6.\327\245;\312\215\254\036{\217\200?N\232\325\363\b\016j\325d\237\004J\250q0\244\030\202\312\225rSZ\2206\260\002\021\251\272:\020XU\244Q\212\345\244%\205\021\304T\3219\206\334\221\233~\017#*\211b\351\346\346\235\212"
+	.string	"R\013\2260\303\223,\335\262\216_f\004\3318m\221\017\213\257\260\225\304\030DT4m\220m\353gGs\251v{\331\260UC\242\353B"
+	.string	""
+	.ascii	"\271\b\255\013\214\210\306\035\313\006\023\177\253\341\241\t"
+	.ascii	"\246\354\215]\371\025x\001zw\241U\004u\273\025\037\031\021N\271"
+	.ascii	"<\227\372kL`\030\261s\t \260#\234\372\325\213\212\370zW\003"
+	.text
+	.section	.gnu.lto_processRcStickPositions.102.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`*\035=|"
+	.string	"\032\277\370*L \220\342\031\003\257b\353\36009\027\rY0\236\300U\344\275\327\300\356\034^\273\370\210q\315\220>f_k\323&\217nE\013\317\361\200B\271\023\b\346B*\325\327\177\322\201\211?0g\322"
+	.ascii	"kP\201\n\367.\217\215l)eJ)\005\246\002^\002\260\0024\304\275"
+	.ascii	">\256i^j\253\327\244\245tG\351n\353\242\273\336:\353\357F\346"
+	.ascii	"\246\223\202\2022+\356\365:\001\257\357\351\324o\334r|\344\206"
+	.ascii	"\3538fG\341=#\326\3238"
+	.string	"\205\256I\365}_\025\306n\225\275\343v\3136\b\267[o7>r\323\023\263\333\256\224Xq\257\217\250$\3256\303\367\215K\352\226\223\214\3352\223\331L\307!y\233\216\b\027\235\341\373\276L\177\204\331f\343\232\215\316l\316\302X8\217\361\370\216\257\260\025\256\302vL\205\247p\035\323\261\024\236c9\216\302q2\244b\300x\021\345\242\005\013\250\247\025NM*R0\241XRJB::aTd\242\004\021\211!\245\320\210 \240\037\021!|zxvt@|\360\220\203\223\274A\036mj\214E\267e\337\231\334X\315Y\330\204`\021\314\233\302\2007\335\272#C\"6\206\326\362\025+\305\251\244)\327\224*vTt\246\024\247\2104\327\261L\007\035\322C\307\254\351\303e6\210Ys\205\226\245\024\321\254E\232\347xt9\313\001\2315y\260J\272f\205\2305\235\316Q\200\314\232a<f\315\035\316qE\352d"
+	.ascii	"\2315U\270\272\324\020\030b$\":\2144\375\"\215\364\271\203G\201"
+	.ascii	"m\271\370\252k\321~\261\260\236qs\236\206n\316\363\220\205*N"
+	.ascii	"\001\331zb[\334\275yE\351U\255\245\3172\276\302L\r\356t\344\344"
+	.ascii	"\232\3224\246U\214!\364\024\203\3154\b\350(\310H\237_|\311\204"
+	.ascii	"-J\177I\254\320\031\231\265\003\237^X\245\027*\027R\227#.~~\302"
+	.ascii	"\310\b\216kJQq\312\004^\227 \302\263\342$\252\\\361\241;;W\342"
+	.ascii	"Qq!<8\037!\r|\276y\020\2134\346\027\244\003\237y\354\316\fFj"
+	.ascii	"h\351\323"
+	.string	"\315\201\212SnM\300\021$\\yA\314\214\240\365\217\b\266\016\001e\352>l\201\317'\336\303\326\304y\330\246*^x\035\370lco\234\230\2212\361\035\235%\016\242O\211\177H\342\036\372\320<\247\257q\002\237HX\245\364I\346I\351\323\205\300\347\230\337 \207\314~\210\365\221E\252f\311\241\003\237b\354\216\017&\316\226>\213\270\r\353\244\3030\254\003\237a,\362\220+L\273\365\220\364I\304kX\244\340\032\221\016|\016a\235\206\\\021l\272\2618\325\302\017h\027\301\332\345b\225\336\345\265\345\355W\263I/\035\254\362}\337\243\227\226\177\3135R\022\3036\253\331\017h{q\352}_v\247\327\217\346\006\232\331\245\301\314\0070\367\254\0209\357\001L\316\327@#x\234wD\256\304\342`\362#\370\"]\377u\362{\220K\231\265\352\222\201\242v\374(\337\274\315\027\261\320\200\371\353\353\025\3717\317\376m\215\225"
+	.ascii	"=>\362}\304lAQ\372N\317p\231\003\030\300\333y\374\032\2525M\353"
+	.ascii	"\261\270\346m\272K{\241a\202\001\006\270\335\326\230@\023\306"
+	.ascii	"\n\315\322\361CS\306\2065N=\320w\001\275\3613\230#\344\346\353"
+	.ascii	"\276+\356%L\002\002\b\270\335\032\211\320\204\231B\263\374Z\363"
+	.ascii	"Q.v)6\364[\256\215\206{\211\236\3243\276\213\331\242\214o\267"
+	.ascii	"6\026\356\231q\356+w\352\273f<\323\027\334\334\030-?l\366}\337"
+	.ascii	"\327(\3275K\370\276\270\r\366\314\266R/\343\273\230\225z\306"
+	.ascii	"7\364OHr\335\032k\372\325\213q\035\344J}\203}\022\031\367\243"
+	.ascii	"\334K\370\230\260-\344S\340\353!\365]E?\367\213\355\273\n\264"
+	.ascii	"^\226\366k\244_\246oY\355G\337\016r\205|\004J\370\270\202\364"
+	.ascii	"\025\3015(\373\321\357\267\232\373\242\345\207\374\317\276#n"
+	.ascii	"U\377\277\271\022k4\036\003\306\367\325\202\342\276\322w\016"
+	.ascii	"@ \201\004o\202\360-\313\257\3134]\205\363\214\357\373\266\340"
+	.ascii	"\246\322v\023p/\351\226+\260\300\333\331-\267\005n\267\375\255"
+	.ascii	"\324\317\252\227\345W\366\346=w\352\373\353[\256\211\320\370"
+	.ascii	"5i\250Kl\372\365\207\\\021T\373\2172\3075\375\317\004\327\206"
+	.ascii	"`\341?cn(\230\220\376::w\326\321\371\002\033\347\b\216\3166\216"
+	.ascii	"\3165:J\363\214)\031\335\326,\205t\216q\343\f\343\306\371\005"
+	.ascii	"\3229*\351\354\242\306\271\305\321\231\305\321\031\352\350\374"
+	.ascii	"\224t^\221tvJ:7\035\235U\3448\247\300qfB:\243H:/\035\235\225"
+	.ascii	"\216\316IGg$\034\347\243\244\363\211\243\263Q\322\271\b\351l"
+	.ascii	"\"\351\\\002\351Lt\343L\342\306y\b\351\254<:\013%\235G \235\203"
+	.ascii	"\272\255\031\350\350\374S\343,\342\350\034\"\351\354\223t\356"
+	.ascii	"9:\363$\235w\222\316:Hg\0207\316\037n\234= \235sn\234ql\234\223"
+	.ascii	"6\31676\316H\033\347\243\215\263\r\322\271\346\350l4:\027m\234"
+	.ascii	"\335\032\347\326\350\314\3328\177\215\263\033\235\273\211<\r"
+	.ascii	"\216\205E\213|\326j\002\236\324\314K\302%\031.\376\202\022*\n"
+	.ascii	"\276\276rUx\235\212G\"C\"\245\005B\203a\341\233\264n\251\256"
+	.ascii	"\354\360\252t\302M\361H&\324>\3412}\212\377Adz\227\354=\254\235"
+	.ascii	"\211Kjj\032.\212\177\263\271\2777\024/E\350Dwd\304\220\226>\200"
+	.ascii	"\266\245'\353`\364\b\311\03087F\351\221\240(}\013Fp\n\005t\201"
+	.ascii	"\356\0042\017\b\223\025\361\005\243\"\035\342\254U\023\037\205"
+	.ascii	"\241\006\210\237!S\031\244\226X\236q\223\036\231X\306\327\226"
+	.ascii	"g\\\315\245K\033\2267,qX\342\340v\233\364.\232~\323\267c\331"
+	.ascii	"\031\221\362=z\005\304\340\346\b\005\260.w\360v\036}\017\236"
+	.ascii	"\r\324!\036O\022'\276\2453\234yyeby;O<\017\036\340\037\265\311"
+	.ascii	"a\316\276\f\325 4\372\032J\214^\206X\332\230\033\264G\243\001"
+	.ascii	"\331k*vm\312\242#E_\202\360\275~\030\n\371\2166\0215\361\355"
+	.ascii	"\r{S\250k\026\255\216(\361\311\303\243\022_\334+\323z\254\376"
+	.ascii	"\020C\237`\320\031\261#s\204PaF\316\200~\244\234\343\222P\250"
+	.ascii	"R\256l\246\016.\346\216>\273!-\354i\260\220\310\211\220x\242"
+	.ascii	"O\334\352*w\350I(\177\310\301\224_\324R\027\3458\315\\\301\007"
+	.ascii	"\323+)D\304\353\340\001i\260\034\250!>\272C\3338l\241\267\341"
+	.ascii	"^B_\004#e\232\003\260j\2556\225\273B\361G\242a\2417)\023\305"
+	.ascii	"g\304\367\241w\215\370\022\204]\204\202\351\321sC\323p\203\\"
+	.ascii	"\205\240o\321$N\241I\265\2720\036\300\276r\201^\b\354\214\224"
+	.ascii	";B\270\035(g\233\371\005\306\034\302c\005\260\310L\017\235\357"
+	.ascii	"+\367\347\225\300\330\346\276\374xV\367\225\033\342\177\256!"
+	.ascii	"\254\214\303\f;@\370<2I\021\237w\305\274\311\310\375\370\320"
+	.ascii	"\363.\250\202\214\311\202\267\263\347{Z\326|\254\326\216\317"
+	.ascii	"\352\341\243\034\344^Pc67\246\203\\\236\277\340\331\271\240V"
+	.ascii	"\246\021\236/\006\3460\205\036E\231j[\224\320\230J\216z9G\316"
+	.ascii	"\314l\302T\363vr\322\n\034\265\371X\334{]x5\002\002E\251\031"
+	.ascii	"\303\302,\277\346\240\351\333\201\263\363VE\316\315t\34223c`"
+	.ascii	"N\275\235;\237\2642\245j=\326\220\2304\257\344G\271\206\326\371"
+	.ascii	"\f\346\306T"
+	.string	"\231lL7\235\377\037e\254P\24073B\bu\314\355\346\243L\345r\217i2T8\230nL7\267\333V\217\206'\2054\\\032Z\251\240a!g\331\322\002\030$\210\027\323N4\037\036\204\207\307\371\017\337[c\001\030\344\360\240J"
+	.ascii	"\034\037p`\365\200UU\216\252\017nXUyPEE\205A\017\007\035"
+	.string	"\302\007\017\344\300\3212\025\n\034\036\334\260\312\001\302\r\252\013\250\254\230\2506`\002\201\003\f>`\242\262\302\301\204\002\210o\204Pe\305\224\343\306\r+\246cV\226\236\312\372&\177Y\267#fa`I\255\205F\362\221\331(\202\244\221|Cj(\361}\2315\222\017\310\002\321e\336\226+U\353\254y\322P\201\372\202(\200\306\257\302\225#\374:\362\322\336\262(\177\326[\332\033a\277v\331\245=\013bbh\037O\304$\020t$\314\230[G\225\361B\340\307\230b|\030\214\217\341\320~\3610\242\376\305\023\211\372\342\027\337\221e\036\026k\265\307\2039\3313\354\300\227\224,]\030\301\311\223\t\212x\200\017 _w\337\354\2525\003>\312\243\311{}M\371\255\256R\243\026\260\354\021\245s\304\256R+\263\322\370h\323P\373.\032K\203\314\313\265\246[:)B\362\276/T\2677gW\303\302\267\233\214jX%"
+	.string	"\005\366}\315d\320\265\207\252\334\016\315SX\216(H6"
+	.string	"\027\277\no}\325\327\342\327\341\306\345\261\370\263\330\362\252mO\022\331\257\035\203\321\306\333\207\245\355I\232*2,\326\352\226'F]\303\004\370\350\341\315\013i\236\330%\265"
+	.string	"\036e\b\022\300G\271\363\272\263\276\351\372\310dnL\263\370\316j\264>"
+	.string	"\\\274U\016T\"0\335\\\374\313\240\303T\003g\233\275\270I\335uM\267\234\352 q2/\331\226nt\335<\264p\241n\325iI\233\361Q6rE|\033\271-^\204\233\3613K\270e\224\345\334\234\333m\213/\236\025Z\267\360\370\232\242s\362\223\370\3128\342\323\002\230F\343\374\222\232\242\345KH\217H\214\217^\271,>\203A\026\337\236\205\201age\261\306\344\305\226\276r\241\336'zf\216\320\371\272\243\272\016\020\260]\317\213\013%>.\355zZZPp\267\314\203s\277\376"
+	.string	"\205\212\345\210\354^~MXP\331g\370\342B\332[\366\307\376\345O,\355}\273\260{a3\306\367\305\3521\366\322\262;\337\035hio\331{\344}\334c\356|\217\224:<q\013\324?\20075\326\331\300\006\225\005\251G6\367\245\344\351\243\334\245\257\334\247\177\251\336\323\267\024\226\256\271\266b\305g\300\256x\244^\221\032\347\226\240S\223\026D\025N\0208\333K>.K/\336N\247\3079L\261\374c\252%\363l`1T&LM6\274\337^\316\3402/\301,\305x;\233>\007b5\202\213\250\002\361,R\343\214!\031\021\021\221$I\322\030\022\013\020\210Bi\234\307\322\003\022\340SE\210\224\316\330\215\202$\225\264\006\024\324\251\243[u\346u\233\340\032\365\026\002s"
+	.string	"Y\235\250[#]t\354\024c\240\300\240\027\225\323\r\b\363r_;\320\352)\262;MXH\313b\214)\022\221\n\221Lx\3768\365\t\244\301\306-="
+	.string	"n\340\225\370\2413\025\321\300\024j\346\237\006\315\353\300\257CV\241m@\336hz\305\260\230\361\016\374\211!j\266\2226\230j\345\001\202=\262\227\rW\321\205\352:/\004A\257\247\361\304nsK\032*;\320\355eF\256\3744\001\215\0274\204\222\223J\255\303?\271\330\016\323N\322\270\321\222\221\333\352\003\231\t|\242Y\246\356\373\264\240\203l9\220\236\265A\376j\377\262.b\335\330\035\213\037\335\367(:\211P\236\312\2179\202my\263c\004\363T]\240\332F\266s\341o\0261\330\r\360\237\2574\343\037\234~\030\n\207 M\240(\364\362\f\r\332b\275O\237y\373\"\233\310\231\210_\260U\\\234R\3367\003\022\346\001]l"
+	.string	"\341+\352[\325\241\207eW\363\212\336\200r\260\266)\342\304\037\262H\266\226\272\217\232\231\266\224\264.\220]]\033\360\227\335\241\246\340e\001\250\320\201\241\230\371"
+	.ascii	"\027*<N\277\300\0379\335u,\317\251\025\320\365\231\277\306\007"
+	.ascii	"\r\377\006\364&\201;r\271:\271{B\342\330\t([\360\262V\340\212"
+	.ascii	"\210\201\325*"
+	.string	"\275&_\243\305\354F\354,\320\351c>\331[HT\003\340\347\367\031\006\027I\003\317#\327\035\312\270\032\331H$[\225\205$7\371P\bE\202G\027\370\313\004)J\364\357\306\341'\244\305O\237S>ZY[?\276*\006\223\361\310\244\274\204@\312~<\331\240\343\312\213*\310=m\030\230\036G\371\rI\331lf<\373\361P\037ln\220!\217*7?a\221\320\362\013\211\332E;\031\305mu\321/\260\3702$[\030r^\365\377xh{\200\274\210X\320\256\037\246$\243y\n\222\303T\203Q\nx@\030\004\247\241\211\023\324\021E\202\265\022\374gS\316\024A\334\2141O\211\3347|\316f\220@\016\343\330\241S\270\247\032\205\003\337\221!X)\313?\036\221ua\203N\340\022\322\301\016o\250\365\314\260\023\210x\310\331\236\007\001\306\035%cv\211\345\253\207\363B\244\247^G\003\340\255\177\004\200\274\264_"
+	.string	"\363F\314\271}h]\f\036\325\214j6\217\013F\022\237\013\377\t\265\235+\233\205C\257\024\270\201\243\326 \210W\276\223C\307\004\t[\271J\306c\023\205\344\300\002x\263\210\225\262g\342\254J\227UCIA\315BI\310v*R\025\001u\340\232e*sM\224\306\254\305\305$\221Z\2640\025\365\257EW\267\321w_\310R\201\020\025E\207\020c\205\002$\002\333K\302\230\322M\354,\3076\275\306+\311\230\214\b\030V\254@mqUmaY\224\335y\240\321DXA\322;\273\016?\311\322\231\004\367\207tlv\326\027\312\027\265\r\353\207\357O\341?H\3271L\017%\247\312\304\234\310Kp\350Y\227\330.\004\321,\0065\271\035\367\362\212;\255\031%\273\f\3072\312\324PB\204\231K\"\\_\342\300\037D\213\232D\341\327N"
+	.ascii	"\2458R|\034E\b`\211\263)\2600\224\365@\274V\355o\r\275\240\315"
+	.ascii	"\242\025\200\240\221F\323\035\037\353g$\200\327B\3259i\334\240"
+	.ascii	"\203\277\005\211`\306\036\221E&\221J\022q\3256\027\"\275\234"
+	.ascii	"J\214~|\007\253c\244\001%\365\302^\031\313\206/R\246\265\210"
+	.ascii	"\363\225\320\261\271\202\310\347\322y\216l\034F\224\300\214\313"
+	.ascii	"=\"&\310\013\237\373$\024WV\206O\035\307\310\033\324z\017\177"
+	.ascii	"\216\037ET\277\222\227\216\033/\342\230\242\007;\244\021\236"
+	.ascii	"`,\243\035|\347b.\rG(\202\035*\220\2743\taG\305T\306\230\036"
+	.ascii	"\277\314\303!5\201\277\026s\341\353\241\363}\367\255\b\204-\237"
+	.ascii	"A\272RA\264g\231\225\007\233N\275O\326c\311\004\275\230\366#"
+	.ascii	"B\304qy\353\364k{\273m(\223U52\217\232\005\006\022\037\270\360"
+	.ascii	"\321Sb\006J\013Zn\307.\204\013\253\013\020\350A\300\030gP$\""
+	.ascii	"2\221~bW\215\254\375\304C\244\312\263\247\244\323p\255\361\305"
+	.ascii	"\373W\314Au\236\005_\016N\225\301\332\356\242\253\311\031\263"
+	.ascii	"\216\321DQS\023\035\027u\271\345\237\272\337u\034.\027}\277Q"
+	.ascii	"\364\371iejNfi\1775^\341"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.103.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\035\001\305\r"
+	.string	"\206\333_D"
+	.string	"\261&\035C\324\357\214\365[\330\217\324\"\352\314\031\266I'\361Q\350\321\304\212\257\252^\276\322\r\030-\030\013\007\260E%#"
+	.string	"<\020\276K\377\377\2579\340<sxN\263_\034\247\367\324\032!do)S\nJ"
+	.string	"I"
+	.string	"J"
+	.ascii	"\021@\336c\345[H\346\354^(1\263\273\035\346\300\036m\373\037"
+	.ascii	"\31622\t~\033N\226\n\013\n\312f"
+	.string	"w\265\317\005X\217\360\036\353Q5\234\364$\371\1779\254\021c\206\351d\362\274\026\354\256\323tJ\271\365\266\013\330\376\260\357!o\371#L\253\246\023\246\237e+(n\036\274\330\255\260\272\331\025\221f\345\251\333G\3711)\253\276)\233,\\\250\200\250\331]\216G\037\300\016cg\217\267Gvf[\323\376\367\020\243\273Lp\334\265 cf\367\353\260\001\354\001z)\002\031\257\303I\256\234\252z\257\306\322\324\004-Pn\224r%:\t\253\260\335\375\360E|\204\004\237\303\243C$y\323\243Ob=^\037s\317\t\0304\245\\\331\237Ij\006\373p\025\203;0\315\201i\354\251\373\272\313o\005% \271u\f@\"1\004*\t\201\336<B\020\270N4\302m [\247m\016\264\021P\210\210\266u!\315c\200\271\b\r:M\304q\235\226}{w\364S\322\023s\264\243\177\271'\205\247Bu\033\016@a\267D"
+	.string	"S\216\036\346)\203\362h\\\212\251\002\023\236\215\352\003\025"
+	.ascii	"2\003\302\260<;\213\205v|\331\023#\241g\304<\343\276b\016\306"
+	.ascii	"\204\355\232\370\260\341Peb\353b\255\336 \f\324\3545J\021.\201"
+	.ascii	"\262,\370\231\321\324\316'"
+	.text
+	.section	.gnu.lto_rcControlsInit.104.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\265\013"
+	.string	"\026WP?@O\223\016S@\242o\335\305#\355\3444\374\316Z\320+\216i\345\350\025\3444\377y~\"B\bi\372\332\264\320AVImS\217\200v\0306\274@\272C\376\257F\376\326\337\266\355\275\245L)?"
+	.string	";"
+	.string	">"
+	.string	"\025\213l\027'q\330\233(\301!\002cw'\335p\321\341\323\024\371\022\fe\343\256\303I\307\037"
+	.string	"N\233\220Z\341\264G`w\017\342Y\201\3132%\230\335un\334\205;\336\266\002\333\005\354'\b\367D\273\202\220\337\256\003F0t\232^\216iG\220\220\337\234#\035]\246\227M\312R=\354\277\335]\353\310\326\364{Z3\235O\237\022 \303\212\316\211]\013%\031\333A\024\035l?\207*\262\275x\252z\216\031X\226\"T\017\377\372tD\305\2645\017\241&\273\032\002?\304El\374\217C;\340@\237\023\017S\237\202\005\b\226\245\334\335K\275\021\257\226\017!-\264\214a\215t\246.\240Ne\205>\025\225\241\254\211j0}8\032\317DY\240\351\"\300\325\203\2155\205\252\312\232*$\354ou\344|\006n\361\240\002D\017\374)\005\333^\240\241\3034\263\252?\342$6\374\0173\310db\024"
+	.string	"AC\253qC!#\243\031v\216Lm\020\006\344\021\0245\004!"
+	.ascii	"\034\\\302\004\326\301Br\031\3602Xp\231\200\001\253\232\274r"
+	.ascii	"GK\216\255-e"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\253\005\365\026"
+	.string	"\206(\224H\200\226N:C\371\320M\303\342\200\233\270\327:M\355\214\306\334\304\002l|:\274 \204\322\201up9f\257j\013\032CH3\025\245\245P\251\016\r4\320"
+	.string	"c\fV0s\005\377\257\225\261A\300\3605\217wP\304J\"S|"
+	.string	"\201"
+	.string	"\204"
+	.ascii	"g3\177\027F\250\247\024\305\241\267\231\277\022\224\022\023T"
+	.ascii	"\323S\223\361D\221\205\360|\253\204\016%\210\265L \373)\345\320"
+	.ascii	"^J\331\247\220e\374\260\225\351\3634\263\347Zx~e\347t\246\316"
+	.ascii	"\345\314\234\307\375\355\230\303\f\307\376\255\274\271\025\232"
+	.ascii	"\340\341L\233?\351d2\231\254\261w+?\005\274\031\215=\262\354"
+	.ascii	"\237\357\371\273\022\363\177Iu\226\375\366O\262\305\275\363<"
+	.ascii	"O\237}\224\362?\214Wq\304\332L\314>\360\350\314|\275\016r\377"
+	.ascii	"zm\302rV\t\3134H\330\317\215\260\267\023a\277%\204=\027\020\366"
+	.ascii	"w\037\354\361<\330\327"
+	.string	"u\260\357\302\301>\313\006{,\032\354\275d\260\317\303`\377\345\202}\322\202\345\263\202\345)\n\226\251\222,\337\t\226\253$X\216\021\3012\f\b\226\257\036X\306r`yF\003{*|\236\347\377c`_\205\027\374L\301\227 \035\355\350M\210W3\272\223\242\257\021\005\005\216sC~j\033\221<\274\313\033\023\3266\016k\257@\031\230\265\365S\333\t\tT\333)\345#Q\266\240\332*.\307\220\251\275\371j\027\323\"*T{)\035\252\275\2042\337\260k#\252\215\002\3452,\216\210\260\266/e\0349-\242\3323\227\031\256H\215\242\332\bR6\221\244\335\031\325\226I\207\265ePam\231\313\004\352\324\256\202j\037@\031\350&\306\345\253=\3402\f\\\031\020bm\001\227\r\254\325\005O\342\336y\236\347QL\007\221b\232\205\334\264\354\222\245\234@\255\213\2466\037/\2606\007Iy\210#\257\2466\177\241\034"
+	.string	"\255\353\307\345\037a\"\026\254\315^\227g\276\2347\265\271G\312\2773\0358H&\036\301lj3\217\233\362\216\313%\327ZXNm{\371Fl|\351\324~q\031"
+	.ascii	"\226\325\333\257\266\024r\247\266\024\312S[\352\362\335\332\300"
+	.ascii	"zjG\245\277\332Q(\227c_m>\265[ 9O\2501\f\303\242\035\te&HIa\232"
+	.ascii	"\0030\003\241m3\006\021\240(\246\020A\302\215h\214\004\362\001"
+	.ascii	"\2335\212Z\177\211\221\016z\030\364\315\266\327\306O/\277\200"
+	.ascii	"Tg)\300\023D\302v\346\2752\226\023o[A\025\266\240\032U\320\205"
+	.ascii	"*lA\265}\344\233\345H\225\224\305\013B\341\355\216\250Y\335("
+	.ascii	"\340\246\037l\374\026\303bT\025\017\313\300\332\036\3376(\375"
+	.ascii	"\211\275\214\306}\253\033\232\0231\336\214\r\264\325Db\0233j"
+	.ascii	"\360\377\007"
+	.text
+	.section	.gnu.lto_.refs.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\245\006"
+	.string	"2\017.1`M\222\016\300D\321\200\2543\215\234#\021\204\277\241\034*M\222$I\222d7\237~\bG++%\"k\013\017d\255\265\255\221\335\b!\244\221-S\023\340\001\032`\201\342\340"
+	.ascii	"Z\260\2434\270\301\205\002j\327\016\005\f\200\227\235\351\315"
+	.ascii	"x\275\030\331{\221_\213\nL/\005\346;q\371J\254\250\244D?\312"
+	.ascii	"\211I\t\311\210\345\027\t\001y\377\207\307\353wd\237#\377\215"
+	.ascii	"\351\327x=\342=D\376\203\324\035\244o\230\376#u\206\376B\324"
+	.ascii	"\025^O\310\356\311\216\220\277\311\327D\037\265W\355\221\355"
+	.ascii	">w\332s\330_\326O\355%\366\256}c\277\326\220\233\251\257\032"
+	.ascii	"\361~=\001\r\004\001\300\202\003\f\005\336\224\245.(&S\004UF"
+	.ascii	"]P\0262\245\216\b"
+	.text
+	.section	.gnu.lto_.decls.f93b0264189a0b46,"e",@progbits
+	.string	"(\265/\375`\233;e\376"
+	.string	"\272\212\315WW \fQ:\215\001\035\364o\206\267,\236A8_{\321\223O&c\274\353\026\217?\024U\315\323\302\0032\004\0043i:\370\307\263{/44\024\034\266\265\227\227.\231\307\177B\2070!Z\226\303\256\220y\324(K\r\230\327\351\261\301\372\353\032\263*\226\264\266\345\2262\005\256\004\217\005\264\005\270\f\243\341 x\211\325\260\031&\202\227`#X\211\223`2\f\206\277p\021,\206\307\360\021\354\205\221\\&V\202{\034\373\300?\236?\314\270hSn\232\037h\013\3338\243\341\326\345\341\007\302J\260\016\314\343\312Y\201"
+	.string	"&\326\364\200\225\\2\367\314\251DJ7Y\302\264q\224\315\325\270h\3145\031T\200\260\236\224ea\033N\250\300\200k\3360W\f\317N\302\322\324\265\217\366r\\\264+g\345"
+	.string	"02\254\004\273\270nW.\207\004\302\352\232\270\311\351\242\351\234{_\335}\300J\360\323E\3239R\356\025\300\036\3123{?\033t\276\330\345\211\001!\237\036\260\320\307<.\032\b\366&\003z\365E\345\341\214w"
+	.ascii	"\035sY\360$J\032\316@ \224\376\017\215\376\217\213\376/N\377"
+	.ascii	"\207Dc\255\374\242\312\226\017\234\377\033\242\377\233\241\377"
+	.ascii	"s\322\257C\357\364\321+\372h\233>j\246\217.\365\321#\372h\020"
+	.ascii	"}\264\206>\272\244\237\317\350\347;\375\034\247\237\311\364\365"
+	.ascii	"\242\360\212\313\374\301Rw.)j\006\316\317Jt\tv\337\375\371=\017"
+	.ascii	"\321\317Z\372yI\377\244\323?e\372'\020\255\341l\241\217\363\264"
+	.ascii	"\007n\372\330L\237\fL\037s\351\273a\031:C\231\253w\231\032\256"
+	.ascii	"\231\3371\027\3565J\312\275\254\241\013C\203\f\347c*"
+	.string	"\375\253\341\267s5\374~\313\350\034\2475\310\303@+\255\235\205\3415q\326\346\220\370p\376m\376\367\356\202Q\262\200G\022\027\316YI\346\005\350\367\213\316\224\221\023\314p\356\351\222\345\346K\227\243#\234\357\301\312^\027\\\225$\276.*oZ\305\222\276f\331\006\037n\226kv\321Ne\027\260\311\226S3\215\255\351\206M\271n:H<[)\005S\327\336\312_\272\253\345\326].\027\313\265\273\314\233\345\312\375^\271s\307\312\275\225\366\336\277k?\320o\226\033w\335N%\332VJ\272\022\001\255\345\331\233\336\336\312\r?\033\200\313;\023\322x\362\233\327\302O\347\332\320\277.\364o\n\375\021\350\fBZ\203\016\350\033\345\266]&\006W\312\257\332];\212\244\334J\314\225\246l\t\316\037\241\1771\370\235}}\027\203\337)\240y\256\205\037F\273\026~\367\354:\271\314\n.\224\363hl'\207\317\b\037\032\234\377"
+	.string	"\375\373\344\001@\332\037\376\243\177+\370\335\276[\301\357Z_\356Z\370U\260\243|\001e\243\t\223\237\212\032K+8\3772\271'\034\nN\356\355d\357}A7\215Is\006\347\273\257\205\037\317\365\371\3351\240\337%>?)+\345\336q"
+	.string	"\227\r0\234O%\377=r\303\256\330\311\364\224\334d{+{\200G\332\264\310p\276b\370&\271\312_\261\213\344\033|8\216\322\016\333[y\305\362\336H\367^\240s\357\005h\224\036HK~\371X_y-\374\364\365\371E\341\271\261%\205\377\214\262\005J\321\225\377\016\377\033\364_\343\177\207~\334$\207\255D\021\305UU\3014\340\340p\362\355\3078\250\374\270\007\020\267\037\017\221r\275\332\260Y\224\377ra\303bk\377U\373\361\315\177?`\360_\0328\355\377\017S\306\177(7\376g\325\177\017\376;\001\314\304O\206N~L<;"
+	.string	"\005\026\374g\212\033V\242(\377'\361?\335\177-\377\263\374\337\362\277\356\377\334\177.\377E\363_\377\247\231\245\031.#\361\337\r\374\227\003?\366\360\377\3743\221\254\t\212\037\217\360c\f\3748\204\037\213\360\343\013\374\230\304\201\177\326\361\343\001\374\370"
+	.ascii	"?6\300\217\t\360c\001\374\370\202\037\027\340\307\032\230\374"
+	.ascii	"\030\347\307\026\374\270\002\236?\033\371\361\362\307c?V\376"
+	.ascii	"\030\354\307_?&\362\343 ?\366\361\343\035?\316\361\343\255\037"
+	.ascii	"k\375\030\353\307W?\216\361c\253\037\267\3701\325\217\245~\034"
+	.ascii	"\365\343\247\037;\375\330\350\307'~\214\374\261\361\307!\370"
+	.ascii	"\261\372\343\364\307\301\037{\340\307%~\f\201\037;\340\307\034"
+	.ascii	"\3748\203"
+	.string	"\037#\340\277{\377\365\362_\273\377n\371\357\334\177\255\374\267\312\177\247\374\227\355\277i\377e\376\367\354\277d\377e\362\337\345\177\307\376\033\366_\260\377\022\371\257\220\377\376\370o\217\377\362\370\017\346\277;\376\213\360\377\204\377I\376\233\343\277[\377\315\372o\215\377f\376;\343\2770\376k\365_\027\377\245\374w\352\277\310\377v\340\277%\376K\342?\336\377\346\177\273\377M\3763\371\037\302\177\345\377\r\374\177\373\237\323\327\327\327\367\2433\376\034\260\037\001\037\002\247\230\277\346L\003\267\326\264E\377\314+A\027,#8\237xz\211\307\r\203\032\273\261/'\036~\222a\005\006\347\023\f\320\317&\376A\366\366\206s\016\217\021/^\316\256;\266\217n\300Ly\261\301i5\201mq\341r\332\335\007<!k\356(\233\224D\354\3209!>\314^d\311rn\251\331{\343\031@J\216T\223\261*\272\237[\316\0279E\264\214"
+	.ascii	"\301\371\324r\276\300\251qe\307\027\317\221>\257\314\001\331"
+	.ascii	"y\323\337\361\262b\345\272iH\"!\025\240\b\236\326r\273J\241\365"
+	.ascii	"\306<\337\316*\347\336I\030\032\206\244\345`\201\307\343\204"
+	.ascii	"k\302\343\210\026\234\277\323B\177gO\231r\321\356\330^a\323t"
+	.ascii	"TFJoo\267\fv\310\020\241\301\205\363u\330\332\244\\4\r\242L1"
+	.ascii	"\321\327!\262\306v\305r\206(X:;\364uf\240\235N\3164<\227\201"
+	.ascii	"F\327\226\332\031\\\207J_g\351\211\223\223y\321\364\356\002\236"
+	.ascii	"\245\250\321\314I\243\237\223gfv\236\351\2375\254\n\352\302\316"
+	.ascii	"~\2273G\305eS!\373e\236dg\017\020\222\233*\001@\224g\366r\274"
+	.ascii	"\310@\322a\306\3442O&\267\tBrOyPd\252\013\234\336\336V\031\374"
+	.ascii	"\274jt1\362c\371\313<\227'\027\320\336H12\024Q\242\223\205\306"
+	.ascii	"\224&\214$I\316\261k\265\217\3624 \231\322\\\254Ty2v*\261\221"
+	.ascii	"\321\345\344\210\330\251\304\351\333\202E\f\347\3470\211\341"
+	.ascii	"4\303~\231g\330e\242A\271YP\3405e\225\201\216\312k*\351\276\276"
+	.ascii	"N\260#J\200eo-\242N#?\301~`\234\250\266\340\3741\327\355\177"
+	.ascii	"M\026\363\262\272\341D\377\"\271'\021\346I\344\212\375\354#<"
+	.ascii	"\r\200H)38\216\2213\310O\257\377\364:\205\200\260\367\256`\004"
+	.ascii	"oNOo[Yi\270\t+\263\203\033\363S\210\030\316\246\240\006\210\227"
+	.ascii	"\026N\n\215\377\337F\222\332{S\241\312-\225\204\363\213\336\253"
+	.ascii	"\341\317\271\347\035\300\336\035H\2607R_\227\030\355\005\005"
+	.ascii	"IF\206}Tno\245\254#\tdM)eU1-\263\366\221\222\217\243\036\251"
+	.ascii	"\235u\304\264\334\273g+)\035\205H\356\036\246\345\236\332)\346"
+	.ascii	"\246\356Vf\035m\245\344\356\331J\033)\003\223R\326\024\323\022"
+	.ascii	"i\252\207i\2315\265\227Y\233g+!I5)m\251\236\275\314\302\333\313"
+	.ascii	"\344\024\017\32329\305\264\314\372q\2354\211\201Q\361um\355\335"
+	.ascii	"#&\245\035\0055\003I\212G\216I\231\334u{_\262\245-5\200\275g"
+	.ascii	"$\245\352\220\252.Z\222\\T\222\023"
+	.string	"\244\344UB%i%\267\222\034\223\220\344\336B\222\2066\024\007GJ\271\255\343\312\035\331\230\261\237\226\366\006"
+	.ascii	"\324\336Gw\313\355\275\217\366\336@\251\031\312\275c\3600uAA"
+	.ascii	"\355m\365\003\265g\034\245-\355\215\311\354\320\246\230\226Z"
+	.ascii	"I\2404&\313\256\255Byt\273v]\226\224^\036)\331Oat\327\024\213"
+	.ascii	"<\234\177\340\200Q\372\222#M\251\274A\273*k\201\363\311c\247"
+	.ascii	"-\306\230,L\364\271\343\007\330\343I[s\210\306q\346X\300\306"
+	.ascii	"\322\305\003\207\215s\353\206\331IO-l`\235Y\270\312\204 T8\377"
+	.ascii	"F\005\326\325YCc1\263\365\226wE\343\234\001\034\223\245\214\312"
+	.ascii	")\003\003\316\033\235\331\216\323\312e\005\253\"Q8\237V5\311"
+	.ascii	"\030K\220\332\364Y\365<\226T\346\234H/\252@\301\371dq\266\270"
+	.ascii	"\314G9]\350\220r\244\003\347\3330\265\021\360Q~\377Iu:\345\230"
+	.ascii	"A\003\226w*\301Q\301|vTy\273\256\357\310\n\322\212\223\351l:"
+	.ascii	"\227N\251\023\352\214:\237N\023N\025\347\324e\236Ng\212\213\223"
+	.ascii	"b\274\3400\037N\2473\251\n\320\351\204\311\3404G\277'@\274\330"
+	.ascii	"\364\366\336@,Xt`~\362m\264\364mX\350\333\034\351\327\220\321"
+	.ascii	"\257\241\323\257A\323\257\031\323\257\341\322\307i~<\346R\301"
+	.ascii	"{ \330[\351\307\244\224%\004g|\006\2439\336\303f\360\036\007"
+	.ascii	"\311\275\221\360\336\316\336\336H;\367^p\357\005\031L\353\207"
+	.ascii	"\331/\277\346\206\306e\200\216\365\316\272\2514\0278\243/\364"
+	.ascii	"\257f\205\276\336\323\327vx\315(i\334\324p\006\203\357.\0237"
+	.ascii	"\361\227*\230\013\024-(\240&\266\303^\264\2360l\330`\223\267"
+	.ascii	"#F\233>\3662w\223{/oX\310q\201\201\363\006@\307]~_lXf\324t\335"
+	.ascii	"O\016\216\344\220\0328_\203\351\337\265,x.io\301Z.\023\323a,"
+	.ascii	"KL\207\343\360\334\225\313\261\363\n\274\254\270\257\275\367"
+	.ascii	"\206\237\r\247\231e\225\346/_O\351\003\323hl\005\313]&\006|%"
+	.ascii	"/G\322\024\316\007\216\321$\330\373b\370\335\276\276\213\341"
+	.ascii	"w`S\037\310E\277\235gP\220X\035O\301T.\023\277a\267\253\334["
+	.ascii	")E\213\325\033n\333\247\026\030QT_{+\1776l\3009\202$\212\323"
+	.ascii	"/\037HE\037\270\324\007\006\321\030\200E\322j\334\300l?\242\204"
+	.ascii	"9%)\235\351\252\212\353B\303\004\006\267\340\322\225\302\f^\302"
+	.ascii	"*\364\322\\>\276.\023\276\354\365YUaa\207\251\256\2404\241\360"
+	.ascii	"\324W\227f\332\355K\203\204&\355\305u\323A\367NZ\351\202\213"
+	.ascii	"\361v\303\f\207\3413\374\0043\301B\360\tx\rC\301L\234\206\201"
+	.ascii	"`'\270\0137\t0rh\261\241\312\f\230\3440\303kx.o\001a\036\301"
+	.ascii	"\031EC\323\216\252\035U\303\250\332\331\327\367C\222\245\311"
+	.ascii	"\017J\017.\251*;\234\225a8+Vp%\237h\311\301\003#\303\303I\266"
+	.ascii	"\333\251Kn=\235q\001\225F\226\\f{6>\350zh\225\235U~F\226A\230"
+	.ascii	"\220\tyq\005L\232&V\360\334\025\236\034\312$\263U\225\205Q\301"
+	.ascii	"y\271\224BE\327D\337\372\206\\\301\371\001\22016\226\265DQ\243"
+	.ascii	"k\352\235\\/\240`9\023\026\206*\177\222Gx\034\244\321\"\322\324"
+	.ascii	"\313eI\267\215\"9\252D\305\244\316N\250\202&\331\2212\246\006"
+	.ascii	"\232\023\3751\247\216Ga\023\322\305\b\030\330\007\322\272\300"
+	.ascii	"}\231\031\002\345\206\363\001\260\365\365u\n\271cIA\256\364\336"
+	.ascii	"\242\240\244\221\021\"\004%\342!\b\037\334\265bV\303j\310Q\""
+	.ascii	"g\232\024\027\272\0337j+\302\204\200A\273\320.4\b\322\235\332"
+	.ascii	"\027\216\021&n\007\220\243Al\370\226\360\316\2644\260\343\362"
+	.ascii	"Q\307\203\007\352\343'\303\021^"
+	.string	"\031)+\033+8f]\217\243>n\337\225\023\340\316\244WV\2120l;v\234v^c|pzYI\245\202\313\023\0348\320\034\025\212\344\225Y\222b\017\347\034'\231\266\253=\261\255\255\323\216\212\017\356\013\325Z\332`\343\322\322:\317\214 \361\301\221\301E\201\212\221L\242X?\311\243<\017\274\256<\271`\023\202b\235\311\2738+Tp>\006%\375\2433\320\253\"/\034A\260W\035\236\024\224\306\321\253\254\303\213\213.bNTkWl1b\214I\322\342\323\373\221\311\212\322\206\003}\201\276@\255\322\246\312H\351\235`Mt5\320\252\243V\367\314\177j\264h\241\326\307\367\205\265\344\312\013\025\325i\007\224\307\007\207\205\304\314\017T\n\225\312w\036\256,i\r\261\272B\243\320\250\017xYq%\222h\231\301\371\027\234\320'\364\351\264\373\0012V\346\213\353h7\331\316<\363\235A\235N:\234}4\266W"
+	.ascii	"\241P\tsFo3Yi\270Qb\202\222+h\212\243NG\2336\370\360/_D\350\220"
+	.ascii	"pF\231\216\252\260\252\242\326\304\371\350\022\252\302kkYd\210"
+	.ascii	"\276\002\364\330\213\251)\234Q\245\177\271\220/Ox8\243I\217b"
+	.ascii	"\265E\017\007\212\3648-,I8\347>t_\346\337\320\243\353\250\251"
+	.ascii	"({\363\241_\202\373\267_\336{N\243v\265\225u\003\215\031\235"
+	.ascii	"\214.,\375\tb\350\351\235v@i^l\371\310\026\250\t\226\362\362"
+	.ascii	"2\231\005\\\311\212\373\332\231\022\363\002j\3143\0314\f\027"
+	.ascii	"^\237\230\031XHzXL\030\033\2524\037bp\016\203\277\234CX\300-"
+	.ascii	"qi6\363\035\003\202\334\251}\355`\35553F\274x\311w?C\260\274"
+	.ascii	"\3304\224\2615\264/\317w\350\0215e\025\232\026\031/Pp\276\205"
+	.ascii	"\344\226-\331\016(\313\356\305\027\216\330\2319$\\\236\355r\306"
+	.ascii	"\234 \227$\327\375\342V\354\235\301\271B\236>\226\214%k\251\260"
+	.ascii	"6G\327\324\240\203\345\206\223\t9\313\263\226\235\244!<\236\234"
+	.ascii	"0r\276\276h\201\301\344\312\225-\247&G\224\314t\305\375q\331"
+	.ascii	"\312\365a#G\326\364\222\243\207u\305\206\363+X\265=\303\265\345"
+	.ascii	"i\311\370\231\305\261\240\3029S\311oS\334\244\370\360)\237\231"
+	.ascii	"\\fVf6\r^\230N\317\013\030\234\327r\264\220\331r\002\316\367"
+	.ascii	"\351\242\3232Zff(\371\311ef\265|v\\\006/\375:\271b:?\255\273"
+	.ascii	"(*\275\246&e]\310\274d\265l\246e\027E\245\0074#\262\005\013'"
+	.ascii	"\337\247M\337g\211\276\017\230\276O\017}\037\031\372>K:/\363"
+	.ascii	"\tK\306\224hI\222\223\234Un\2346S\002F\267\226\211<\207e\"Y\207"
+	.ascii	"\211\245\032,Z=jt8m)\341\234\301\362\021#_E\220\344\036\317^"
+	.ascii	"\271G\0262\002\b\230LX\362\243\231\263\206f\nO\251\264\301\343"
+	.ascii	"#S\3039\003\311ArW\376\221}PHre\256\223\353\207go-=4\034*\027"
+	.ascii	"H\252p>\205'\276g\246\313<\371\262\016\240\244\215\004\226\200"
+	.ascii	"\"JP(]\232\244p\316\001D\332B7\245O\377\206\231\220\241\2744"
+	.ascii	"\243\272P\345\026D\2544W\344\2470\273&\032\254\374\"_]9+\236"
+	.ascii	"\255\304\324kf\254<U\247\225q\344\033\331FN\346\254\274u\231"
+	.ascii	"\031+\273xn\312N@\031+Kqi\356\2109\322\244\212'\233\360/\024"
+	.ascii	"$1\201\220\344\216F\256q\231\371\352?\312\235\257rU\236q\345"
+	.ascii	"\254\224\233\352\346I\336\017\"\0306\344\344e\251\223\361\233"
+	.ascii	"!C\307\211\022G\030\234s\f\240U\325[\n+V\227\231a\3501_ih\376"
+	.ascii	"\345F\312\016-8\375\2366\375\236\262\314Bk"
+	.ascii	"i\322\210[\242\337#\246\337\363\245\337\343\245\337\303\245\337"
+	.ascii	"sC\377\031*?"
+	.string	"\241K*b\342\2360\226*OI8\277'Kc\r\327\347\227Sd\025;`h7\316\226D\330a\345\f\347\234\225\360\333\217.\250$\235:\037eJ\220\320\263>10p\316Gz\251\247\005\00664\2305d\340\374|\364\237`pR\004}i\312\340|\366\001=\357\233\270\266\246\030\3168{\372\327\310=\357~\242\271;\3674Xm\026\031\212\244\315\310@\343}\331\300\302Yy\263t\003\215\036\316g\231\323\314y\346\257\251Y{\3022C\214\376\251g\223c\256\307\020\234\3619\346'\231\277\006\030&\245T\006F\377\f\023\254*\002\024\305\324\230\n\2405\21604\036?0\036\211,1\303\2078\254j\261\210\275\240\r\336\260\031 \201MK\264\252\020\205bj\024\"\236 \252Bu\004+\302h\355\240\262\"\324\240\224-\022\323 \236\337\317X\204bm\177,1g\350#d$\242XK\360\200hU!\013\037\342"
+	.string	"\200\nH\241\016Gb\005dP%:\016\005I\214`\201\013E\365\204z\201\241\261\350\270Z\240UI\034\327\324\004\205\243\260\2030\310\202Q\204Z\034\032\323\241\003\214\300#\024\246>\037\342P\201\tb1\375\240]\323\226\004\313\246H\242\243\360\202\221\270\266l\007uXT\024\032\211\035V\266\250\303\004\305b\221\321x4\002\333\340\257\204\243\021\030\224\252\305\334\252,\221J\364C\021Dl\217\"\f\215 \204\210A'R\326gU[\225\350\b\"\245\340C\034:\034\211\027X\244\252N\200h\2750\244"
+	.ascii	"+B]\213\332T\r\342\371\020\007V\210\201\002\032\020Q\342\003"
+	.ascii	"\020A\n\204\300@\b\301\017F\004I\210\350\261p\001C\253\262\253"
+	.ascii	"zB]\203\025\330 \005]B\212\002\247G\025\n\266\305\264B\206\036"
+	.ascii	"\013\024\240@\036?\360i\221\035\204\220BcQ\005Z\225\2751\006"
+	.ascii	"a\224\r\342\264A\243\020\0225\n!\317\241V\310\250\026\177\252"
+	.ascii	"\b\210lfYu\035\016S \n\344Q\230\327\026y>\007\305\332\262D"
+	.string	"!uD\360\302P5\n\021\213)p\250\262E\231\005>m\323aP\b\311A'\210$RK\214\020BZ\340\323\022\215\"t\204j1H\r\321\252B\025\f\240\001\007\365DJ\"m\213j\210\021(\212H$\b!#qhT\221\030\354\264>A\225\210\330\032\213\004p\223\003\304\241\004\321*\\wn6\340\320\246*R\035\321\036E8\016sj<p`C\b!\\o4\007\034\330\325\206\025\216`YUx\\\221\027v\214\326\264MC\b\327\037\t\013j\220\207-*\026\t\213\251\360\302\320\230\022\021\035?\020\2565D\3668\002\022\204Q\004\273\246\030\210V\020\307\022\024.\\\217\025`\205\214D6\003,q\202\013\211\253jT\205\3649\350@\001\035x`\004\274\007\r\320\240\001\032\374\356A\003\200\200\032\320\001\220~\007@g\333\266Z\r\032\217l\252\216 Z\217\027\270\240\006U\244\252\232\300Q\203\254PZ\254"
+	.ascii	"K\fQ\241U\203C\021FG\023\3006\270\201\207\017q R[\026\005\253"
+	.ascii	"c\244\016\215\"\206D\344\316\b5\355\261a\205\304\226%\266i\313"
+	.ascii	"\006I`"
+	.string	"\323v\207\004{\034\241\003\265H\f:\256#\250m\272Z Ax,\n\213\220\302\034\225\210XB\025\246\253\005\214\030X\325\022\216\310\t\326tH\230W\225\030Dl\215\352P\304pM\217&vD0\024\202\312\016\375\3246mI\024\t)\200 AHlI\250E\023\251Q\355)*!]\317 u\030l/|\210\203\361Hl\323U-\252Ba\332\201]\217\254Qe\007\200D\331 KD\\K\21404\202\360\001\026\213\3075\263jQ1=\361\0232\022\211\326T\207hM\203-\273\022\203\202\306c\260\230\n\203\307\025\205\220\005\024iQ\035\006\211\326\224%\016{>\304\301h\355 \204\3641Zm\220)\221pEWuH<q\\\221C\325h-\246\304Ue{\214\324\"\262(DP1\035\2621\0223\264A\240PZ\342H\f\n\025\025\221?=\255\312\252\353\320H4\021lS6HT\264\266$\250H6"
+	.string	"8j1\025\332\264\253z\302H\024\256C\"\021j$\022i\022\204\352\220\320(%\322\254\252\256Bj\b\265(d\004A\224~p\002\031DaX<\016\261\352:TBm\323\023\304V\bB\035\036CX\211\351\217\221(T\331\242\240\321zcT\224\006\215R\242\035v=\256\253j\341\327\252lP\320\361\246\2475\022\217\310Ve)\030\256i\t\3531h\250\252A\002\b\n:\266E\302 K4J\203BE&\324\341\005\024\310\225\202\365\330\n\323\240\340\261-J\203BF\342P{<\022\261A\341z\301\360H\\Ud0\bY\f\252D\351\032\024\024\256l\220\310\262+\206!1\330\022\215E9\033\024\215Vv\247e\323\240 [d\202\325Y\215l\320h\335i\203\033x \201M\211\202lQ5\032\323!aP\035\022\327U=q\f\"Y\""
+	.string	"\f\213R\023\301\241\332\246\304\366(\244\032\203*[\024\fbW\341\317\207(\370\021\251\256\035\332\343q\355p\303\006\205\210A\306\343\007!<\264CB\304b\020O\t\307\242\316\316\320C1]\333\"\325X\243\026\333\366\270\016\265\301\241\207\241151L\325\241O\t\307\342M\033\354"
+	.ascii	"H\017\t\021\207\202C\017-\221\210X\304i\203\036\264Fb\021\360"
+	.ascii	"@@\037d\310\200\b\026\320B\016l\361\270\266\306\2430(\\;\b\203"
+	.ascii	":\030\211)Q\007\341\312v\340\020\200\241\007ux$\n\016\325!aK"
+	.ascii	",\201\335)\036\217\023\b\242X\316\256\fg\243\255l.\223\321A\343"
+	.ascii	"\241\343\306\025\324IGN\254O\207\334u\253J\201\346\314\312\235"
+	.ascii	"\216\036\025-Mq\250U\025\364\n\363\250\372R\003\016\305\202s"
+	.ascii	"\241\f\362\206\346\300\351\001ff\212\n\352C\347l\311L\314\024"
+	.ascii	"4\210\r\223\"]\310\334P\"|ga\262\340,E\310\004\362\236\266\332"
+	.ascii	"\316\322\370\210\323"
+	.string	"\213r\332\225\005\204\365\250\263\242\264\201L\334qL)ej\206d4M:\023\025@@XT(\225\213y9\037\023\200\021JTz\220F\231RjH$\020\221$)(T\332\016)\317\206q,\357\320^\241\334Zm5\212P\350\231k\336\001\264\b\031\206\f[\312\201<\257M\023^m\361T\362\354\324g'\"\006(c\205qx\201,L\003\021\252\230\334\343X\225\030\177\2577\266\374\267^\345\034\232D\366\246\312\303\272\271{X:l\360F-|#\275i\004K~\322\242\260\371$U\233H\320!8\350\007\256\314\242t<@\210V\265\357\020\307\372t\217\372]\271\220\033\226=?\216\367Q\b\236D4)\246\336\221c[d\372u\372\330\"\352\230&\0352\257\3510\251\rvS~\240*\216\013\246\020U\034P\003u\246p\007Ws\237#\306p?d\177\277\205\364\275XS\037)/\031\240\365j\2266\026\330"
+	.ascii	"\215\376#3:\324C\"p\036\326\022+\211.L2o\320\326\320\305>\324"
+	.ascii	"G8_\026XX\343 \261>\211\"5\tO<l\256H\333\363\340\310,e\324\177"
+	.ascii	"a\223Q&\036\204\032\366\221\017\255\226ppo5\366\254\230\322v"
+	.ascii	"u\372\023\225qW\276\345\307\336j\326\251I$?,\353\0252\017\254"
+	.ascii	"\251)z\033\324\335{K/\313\251;\324\032\360\245\013\334\302\304"
+	.ascii	"\373"
+	.string	"W\036\231\030\3774\201\035^\322\210\257\354W7\315\312\235oT\211\243\256\264\236\272\026\037\374~^\033\235\332\016z\366\266\324\264ZH\3665\024\344\244\317\003\177\313\233\336K\342\336\313\355\241\274\322\334\fP\345\317\275\211U\333X\270\024\t\325R\2344\211J9\017!\034\204(\241\300\315\223\210\026\302\342\362I\223\021E\334\021\207\232\211)\305\006\265\340N\355\263\332\276\023\206\246MQ\324[\340\006\230\260\352\246\267.\036\361;9Y8\001z\302\203T\370\347?"
+	.ascii	"\326S\372Sh\234\243mH\004\256\246d\0075\3243b\302h\276s\345\252"
+	.ascii	"\222\371\246\3704\231-\236\276\177\005!\\\244\374\344\036\025"
+	.ascii	"\021\371\304\2208L\356\323\305'mgSY.\314\343n\340\006\030\024"
+	.ascii	"q\275G\005T9\334p\225\201d\235^@\334\217\202\230W\264((G^\337"
+	.ascii	"\016\315\f\242\032 \242\330\320\371.a\t\344\234\032+\f\205\366"
+	.ascii	"\221N\211\b\261\260\364\002\234\224z{\326\276\277H>\252\343\313"
+	.ascii	"6\365}J\222\374\355\214?|\315D#\025\210\251\372\344\027~\370"
+	.ascii	"Kx\364q\356\207w\006^\203\206\212M\022\310\272\234\232\210A\277"
+	.ascii	"5\324\001\217S\225\177\333\222\361\246\267\357\177\213 N^zk\031"
+	.ascii	"m\267\263\032\3556[\203\037\357%\364\224'\360\343\277"
+	.string	"\001H\224RU\\\344\341\3610^(\245\314;\n\311\246X\363\321\222\371\361K\277x#\022\356W.>g2\231(\252\273\022q\251\345\356gK\244|\342;a|\326\373\301\315\0011\313w\"`aW\360\\\377\366\026O\006\317\276\241#\\\2517\217o|#\313\215S\272b\b\226\215\376\353\304_\2774\275\023}U&x\t\265\275\341>\217\f\204&\005QBL\207\304AF5\0211a\"\320\001\t\035&\177+Da:W\242_/\035\235\001\355~S0\b\335\350q\324\016w\365\2026\346]\274\234\216?%\315 \210\255\347\212\226:\2634\354\352y\005\b\306R`7\244\024\206Q\266\346t\317\260\200PY\2265\030J\261Q\221E\2038\224A\301'j\311}\214\274\212\306F`W,\361\237\251\321'mx\032\202\017`\rh\267\0139\002\023\036\231\031Ms\t6\254\334\306\321\353?\372)\024\267d0\331"
+	.string	"\001!(\003\312!\345Ae8\302\b+c\324d\330\001H\031,\313\033\256\361\351U\377\004\271\3315\032\263)\235I\"\345\254a["
+	.ascii	"%\037\323sS\247\352SE\346!!\331\361\232\357\266\004\n&\255\240"
+	.ascii	"\311\037!-\b\265Y[*\373\035\020\314\307\303l\223\375\302-$\217"
+	.ascii	")J\256V\223\23479\366x\365\353oQ\313\305\372=z\337=W\205\343"
+	.ascii	"U\035\265ES\202\243\264\346\b\233\f\237`\001\272'\322\260\303"
+	.ascii	"\312\214\236\002\002\2229\2576\372R\341\271\017w\203\002\212"
+	.ascii	"\256\221\024s\327\266c\235\r\373<\375zF\005\257f8^\200\257\034"
+	.ascii	"E\246\355\352\312t6\bwF\3772-\332@\3015\217\202\257\317\222\036"
+	.ascii	"k\352\026A\326\320q=\364\221\342\343F\306\343\001R\023a\225N"
+	.ascii	"\300\n+l\250^he\360N~\246\354\320\320 -N\024B\216\256\234s\\"
+	.ascii	"\362\217\312f\352\370\367\314\332\225\207\241\236\343\303K+\246"
+	.ascii	"I~\032\346\220\311\024A$)\002\373RM\005\\\032\317\251\370C\374"
+	.ascii	"\272\022\352\035t{\334|\343\312\r3VHK\360\023\241\f\245\036e"
+	.ascii	"<\016LQ\225\002\337\033\240*\226m8\252\320\314EG\357\354NB\f"
+	.ascii	"5\345\227\223!\347\3462\030[\352K\256q\223\025\177\234\220\026"
+	.ascii	"M\276\321\034\253C&\002?\211}\277\215\273\324;\n\331g\226\273"
+	.ascii	"3\037O\263K\376\007)\020\300}\366\234\020\313C\024\207\302\001"
+	.ascii	"p=|\004\355\023]\366\322\305\303\261\307?\234\242<\361=\325\216"
+	.ascii	"\003\302Z\362!s%m\314\033Ds7C\237b\337FZ_\302\017F\352a\026\214"
+	.ascii	"\2231\\U\036O\252H\212us6\374\210\200n\005\362\324\350\340\305"
+	.ascii	"\026\031\013\316\\\022\225t\327\204+\245\252\265\341zG\371\205"
+	.ascii	"\370\254\207=\013ZRE~\306\244\003\f\356.\325l\202\017,!\033\315"
+	.ascii	"W\352FK\261e\222Sl\270\266\323\340F\262g\025\013_%\264n\360g"
+	.ascii	"\2108\200\301/\007V\363\037\003\271N>\225/\337\315Y\304\330!"
+	.ascii	"\312\022\230W\242T\240j\241<\27744\002\334\311\275\346\316o\026"
+	.ascii	"\234\036s\235\315\353}\035\2136m\356\300\311G\230\362\030\003"
+	.ascii	"C\005q\303\271\373-\033\211\302\340l\301\237\377\360\212D\375"
+	.ascii	"g\365\020\347SsA(DF\t:s\013\366lT\026\262W\211_\320$\323\207"
+	.ascii	"\376,p?\322\211\237\024\nX\331\311!k\246\0324X`\320 K\266Y`\205"
+	.ascii	"-zN\320\221\312\277\313\310\032jo\n\320\031\363\371\232\377c"
+	.ascii	"\327d\352I\353\253\324\305l\034\235\223,\034cA\016\323T\244\201"
+	.ascii	"\27525I\231#\305\216\313\252ls\340>#7;\262\366L\204\210\276|"
+	.ascii	"\204rc\276F%&\021\021J\202E\304M\303\001\203\001\003\323R\005"
+	.ascii	"U\001\024\231\225\214\366\f\227\217\3622m\f\\\372\b\225\302\034"
+	.ascii	"v\277f\361\020p\260f\202\306\277i\275\031J\001[hU\270\037w(\301"
+	.ascii	"U\nWn\373e\215\255\272\273!s\203\021\337\2469\b=\275k\215\237"
+	.ascii	"\203\003\235>\236\317\301\322\351\027#x&\205\355\337^\247\216"
+	.ascii	"\236\354\354.\b\304U-b`>:\3025w\211o\332\361\272\203\302%\035"
+	.ascii	"3\t\n\317\241\236\375\250\210\252\n\227\300\331.N\303I\366\377"
+	.ascii	"z\345~\026\b\373KE\021&'r\273\230\354(S:\371\206\272\220c\005"
+	.ascii	"!l\242\021\212VC\200\"\037_[? J\350\226\3509}'*\274\025\245-"
+	.ascii	"u\025\376\343\036\030\f\365+\017T\364\324\351S\3240q\004ik\026"
+	.ascii	"\272o\330O\034cn\357\bL`8E\342\013$\266P\256\263\2060\277\177"
+	.ascii	"\320\230\274\261\213\317\313\352\350y\0067\247\317\210XB\003"
+	.ascii	"_\237IE\233\363)\311\271\017QU\035\375\004[(\021@V\276\001\343"
+	.ascii	"l\226C\004\346[\363p\336.\007\240\353\003\30714\0139f\272PLX"
+	.ascii	"\027\323?\254\343\377[\267\200{T\210\272\222\240\250\314\315"
+	.ascii	"\205#EK\370\224\035\261\267\222#\264\207\177\323\340$Vt\212\\"
+	.ascii	"\367\335\364u\017\222=d$khaU\212?\363\354\264\241\2306w\205\013"
+	.ascii	"\t\305\274\364o\347\230c\304 \242a`\361\335T\254\314X\372~7$"
+	.ascii	"\237\272D\264Xn0\307\3456\375\241@\376k&X\271\237\3601\037[\027"
+	.ascii	"@L\2441R\214\001\223c\216W\3338.1\321\206s-cI\216\253\366tk\305"
+	.ascii	"\334\027\204;4l\203\371ZsA\326\004\340\3264\036\262\223\234\004"
+	.ascii	"\242\255\006\371\265\320\f8\377\343R\240\376~\225\370Z\264r&"
+	.ascii	"a2\255\215\231\311p\211\205\031./\275\033@\250\022)\026l;\324"
+	.ascii	"\255\231\272\005\256O\347\213\260\003\230\317\025\337\272\017"
+	.ascii	"\265\013\356\022\"@\313u\271\345y *Qz\261@\005\\\023D-\314;\007"
+	.ascii	"\001\252$M/\177\030\260\305V\312\320\212w\005\337\020@\032\n"
+	.ascii	"\212\350\302s\334\357\300\335B2\272\345\256{o\272|\215}A\366"
+	.ascii	"\231\225\235>?\320\2765\260\357t\257\361\375\200\346\002\\\370"
+	.ascii	"\002\233\257\224\343-F4\261\202\257\275\374n6p\372\366Y\314\033"
+	.ascii	"\251\3071\203\207\204M\355\263}g\020[x\313\0357KC\247YY\363\300"
+	.ascii	"\376\211\343\335\337\357\372\357\365|\350:"
+	.ascii	"\332o\272\323\\o\233\307!\277}\217\311\321c<\377\271,\036:T\360"
+	.ascii	") \355\356<\256\353\217B9!\034\351\216I]\363\276|\266\335e*\233"
+	.ascii	"\254\335V\373\025\310\264\363\224\340G/\033\361a\241\353\207"
+	.ascii	"\255\376\267C#\342\313\240\007\242\256\353\025\232\312\276T\217"
+	.ascii	"+\335\203zl\270F=\311\356G\337\005\337P\236a\272\352\362\" \355"
+	.ascii	"\374\327\360\301\357\261\235\324[a\361\223\017\337\246\241\216"
+	.ascii	"\211\r]\016\214Uo\013\355\2552\037\326\273\370\362\220cx\017"
+	.ascii	"\326\025\334\255\273\273\002"
+	.text
+	.section	.gnu.lto_.symtab.f93b0264189a0b46,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f93b0264189a0b46,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1104 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\225\b"
+	.string	"4\f\247\001"
+	.string	"\034"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\276\264\256\247\t"
+	.string	"\002\240\342\234\212\n\003\365\203\345\270\t\004\002\003\002\003\004\350\300\306\254\005\002\002\004\002\004\005\006\272\277\350\277\r\006\002\005\002\007\002\b\b\203\200\211\346\n\f\t\t\242\376\257\204\006\f\002\005\002\001\n\013\203\357\265\324\b\006\f\302\242\276\205\f$\002\005\002\n\002\001\006\007\002\b\002\013\002\013\004\002\004\002\r\016\017\352\263\360\321\b\020\021\022\246\213\347\204\013\b\023\240\377\330\335\001\004\024\262\270\337\265\r\b\002\f\002\f\r\025\230\311\247\340\005"
+	.string	"\026\351\215\255\206\002\024\016\002\016\027\337\204\215\220\002\030\275\367\372\234\n\031\032\033\317\247\261\273\007\034\240\342\234\212\n"
+	.string	"$ \200\202bUv\221\b\016\257=\006d,\\\202\302"
+	.string	"\016"
+	.ascii	"\221\253y.\375z\234\030\375\f\320\312v\367k\026\345V/\243I@1"
+	.ascii	"\016\300\3201\344\253\354\227\020\320dZ\357\031\022!\303}9v\236"
+	.ascii	";8\\\350 2\356\212\026\321\224\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\215\005"
+	.string	"\022H\025\031\200\265I\007\253Z\221\t\231\220\t\231P\217\217\037\t\361\275\2215\273\267L)\256&\022\200\211\206\330\017\006*\274\211\241\013\n\254[K\231%\304\230(\317\275\274\3222d\354\374o1\302f\220\265a\316F\332\331\323t\364\210\226\362><\036u.\335`O\201\007\004( p\002!\253=\343A\242\020\230\027\264\f\322\271LM;^C+;\003\310"
+	.ascii	"\335N2\002\034\004A^\342\036\303\b\272\021\315\307\206\227\022"
+	.ascii	"\206\\\024Y\030+-\215\224\246H\210\224\336\002\243\333\2063\303"
+	.ascii	"\006\343\205\266\217\r\254\261\331\037\265\370\247\b\344yy\264"
+	.ascii	"\016\002.\200\033"
+	.text
+	.section	.gnu.lto_.inline.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\310\003\005\022"
+	.string	"\366XYD"
+	.string	"\261&\215\00105\002\035U\"\016\3002\366(\361\216\314\302;:.\324xl\005@\347\275\345\202\335\316\007\215M\200\215Y&\215}\371\nT\271\377\377\377\377{$q3\267Q\375!\242\367\243mK\310\226R\2468"
+	.string	"F"
+	.string	"M"
+	.string	"\373\226V\304L\367\0329\343\224\264\223\236~\236`\357\036\357\327\363\321\351\321I\177\320\376[\017\344\272\2224\306\030\263g\020cl\360\357\367\017\315\363,\255M\214\321\363\332/D(\023\237\021730\037\236?\244\271 2\244\n\366\317\002YH\027\354;Q\264\345\305\003\004\001\303mN[:.\fo\320pN\273\327\f\024\330\n\3277\267-\035W\006\354D5\250X\221\260\301?D\363!\210f\006\013\343F\225c\322_\323^(\321\242\3061"
+	.ascii	"\2006\0059X`\201\312T\335+GtG\207\276_\303\340\256\270\340\220"
+	.ascii	"\370|i_X45\0042"
+	.string	"\222\365EQ\0316\272\033&\177\036|\006\226\025!\205K'\231\333\025\213f\005|{\253\211\t/G\272\240\340\322\rH\260(T\n\246d\023\375\"\320\226\030#\307#w\310\336\244\033T1'\023\223~xq\302&\300\"\017\262OY\234\326JF\224\2624Z+\031\355\220\003\235\300\262\223*Q\321\n,;)\221C\324\343=:\245\206\235*\001b\250\321\2512B#\001\211\202\202\026\2261P\2422E\351\001\021 \251CJ\031\261\221\026$)u\375\005\230\313\n:[\355\326I\335\224\343?\222,\267\326rTz\032\3518\224\343&\321\341(\003\212\237\004!\255\374\211Np,\237\021VX\"\355!\356\222\002\275_\345\222\013mT \346R\351O>C\362\355\321`g\020\273\312/\233\232\202`9\374\030w\211\0044\005W\213\360\016\231Dq\243\254\001\037\364\221\320\303@\377\210\316c\320[\216\274?\310 \202\246"
+	.string	";\306\316\306\350\022`\305?J\360\313\375\350W\356P|\022O\253\221Q\256&I\024\373p|\255\215\213bK\r\271@`@\217\271\374\311\201\340\2112\0173m\351u:\243\004\322\035)\231{x\226\317\331\352"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\032\005e\013"
+	.string	"\322M&&\220'I\007\177}\362]\320\257\266\273\273\245\033"
+	.string	"K\241\273\224\315\214\343\341p\312Z\302\216f\374\355'\033\357-\223\f$7&a\226E\341b\346\376\001_E\222(\bJ\240\246z\304\t7\356\302`<pUN9\306_\224s\246\302u9}<\036\023\\K\204.\270R\340\252\255\326@\376A\370\203\027\255\033\177\001t;Y\223Y\242\251Z\325Z\370\267s%\242\t\371\036iU\326W\262\264\343\336q\235\006\212\226\241\336\237H\3234\315\251\306pc\346'\263\252\341\313\003\357\020Z\250\261U1!IA\251\320\034\220\"\241\243\262\003\022"
+	.string	"\002\"\212\342I\022)B\024Q\204\002\tHB\021\241$)H\2061\300Y\347\247-\367?\332\024s"
+	.string	"\357\275\323/QM\bA\347\225\343\013\312\030l\033\363Vx\303K.\250\r\365.\360\313\335\376\244*J\261:\256\013\260\364S\034f\344\020H\202\305\340u\367#\201\"S\365\300\332\311B\241G\225~\222\bIZ\263\221;\354\313\237\232G\0049\335\325\375\r\323\263\t5b_;d\004b\325^\335\246{\024\025(\035w\031\251\346\277\242\267\201\210O\313\300r\251\372\233\224KKJ\260J\b\301R\225\t-\341\341\324\033s\240> \030\031 R\"G*;S\0240\301"
+	.ascii	"\r\314\017\200\271\033\005"
+	.text
+	.section	.gnu.lto_.pureconst.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\231\004\001\230\004\003\231\004\004\204\004\006\205\004\b\231"
+	.ascii	"\004\t\231\004\013\231\004\f\231\004\022\205\004\023\205\004"
+	.ascii	"\024\232\004\025\204\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\375\006"
+	.string	"\022I\037'\2009\351\230Nx\fT?(\222\t)\243Bk\204!\217PQ\256\335\2600^\374'\006\032z\027c=Y\355\333-Sc\031\226i\fh\354\2415\234\257\rV\331\253\274/\017\216LeB\301@\311\305p\265\324\364\240\330\302\003)\264\300;\0208\3359\3536T\023\210\213\314\337\2639E\366DJ\356\333\"2\177'B1\237\237\262\200x\224\262m\266\254\357\235\220\375e\251<:\372F\002* @\002e\n\311\007S\310\225\345n\334\020\r\n\006\360bHm\314H\253\235Ij\030WP9\030wwa\365\213\316\033\330[\347e\315\334\235\324\260RS\016\021iq\277\323\260\274\245a\301\340\350\n\346\003k\236\257\"t\030\340\211!\216=\204\262\306,\200\235q\020\220\021kt\225h\363"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.c4561ab510f63618,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.50.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007]"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\275\355\017yw\250\376\006yu"
+	.string	"\005\001\006'\001\300\002\005\001\006\035\001\024\251\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.string	"C\210\021\346\r\317$y"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_modeActivationConfig_Registry.54.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 \236\225\004"
+	.string	"$\bk"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\277\212\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\030us\326\007uq"
+	.string	"\005\001\006'\001\300\035\001'\001\251\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\005"
+	.string	"P\005V\t\036f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_modeActivationConfig.56.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 :]\001"
+	.string	"$\002*"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\276\f\240\b"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.57.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"u\b"
+	.string	"\246\020=8Po\322\001 ;\323\002a\262\211\217!\233\007l"
+	.string	"\245\021\n\004\253U^(\335\b\202l\006\202 \206\222$\232\t@UQ\t\323\375\355\317e\325D\264~k\311\336{\247\024,"
+	.string	"-"
+	.string	"*"
+	.string	"68\340\334\275\242L\007\341\320h\231\331\2554\216\274;\354\374\253.O:`\276\223w\270I\330]\303\357\264q\307\333&\260\r\262\275\n&2\036\227]S\r\315\306\314U\211m\316\356\330\206\320>\312S\270\247.\f\260\373\241z\331\255 \027p>?\027\260>\345\003\254O\333\001\003\250\335\322?_\345+\022>\311\247\265\r\376\373\3647\n\013\370O\306OF\364\354\352\301(b_\356\356:\206X>\365\303i\005\"\205\n\254a\372\ni#\021FZ\2702z9P\210\007\006\022\2752\215\206<\306\"F\031\235\300\260\214v\352\3362\"x\224\"\2069\020\306\327\263l\001\b"
+	.ascii	"2\003\302\260wqz\036Z\355\202\312\2446\036:X4\265\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.58.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\345\007"
+	.string	"\242O88Pm\323\001\244\004 \253\274\0326\002.\"/\216)\321\022W\302\323\312\240\232\327X\323X\335Ic\225:#\233\030Xb\220\304Tc\275\0131\354!i\fY\332d\357\224\002\031\227\341\026\"\262\215e\f\303\311\0324\r\003\266Q\314\201n\0362\032\212m\034\212\271X\203\3106\312i\332F\257\272\247V\202V(9}$\205}\222D\207 $\362I\027\351\370\"Ot\361\337\247\337U\237\\Fh\241\361\211\241]=Qr\330\247vw-A\373\243?R\225\351\344\222\262{\021\256\354i\232x\\\266\037\355\177\034\304\373\250{\300.Hb\332\255\0076\260>]?P}Z\027\250>\355\331(\257\241\375\310FEIew\251\354\270\367\350\371\0179\300\007\362<Z\022v\327\361\003a\334\362\266\013l#\330.\005\t"
+	.ascii	"2C\363\f\f\217J\230\t\244`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_airmodeIsEnabled.59.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\352*CsK\335\255\243\300sc\212!\256\327\212\354\252\375\273\035\236\336y\267@\374Z\231\231A4]\274\314\017d\247\016\215\321\332\3362\005S\027\r\246\241\312,PV\243\034\032\304\003C\246Q\226\246]\006\256\"0V\223\250*\253Y\262,\206\016\t<H\361\025\351\310uEOl\256X\247\273\001\350t(\200\341\271\321g\235\303\215\257\224\030\372\357\303\002QQR2?\243\225<\231J>~\316[FH\340|5\353\370T\303\243\202D%3k\310\321\253w\335\206T\002\3110\301@\235^\200Bf~\030\350\242c\177\203\377\340\267\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRangeActive.60.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\352\002\375\026"
+	.string	"vl\230F\260XQ:p\023\001p~_\256\357\033\332\tr\272\316\221=\007\023\361\373k\320\360\037\337\262\251gcG\034\332S\333\217}\210\016\333\226\337\320\177pg0\326\246\200\247\240\364\236q\3407\204\356\2235Z#\204$\231R\202"
+	.string	"w"
+	.string	"\207"
+	.string	"\240Qm\277l\275\303<v\314#!@\025k=\234\004\236W\241\301\223iB\203}zg\242\217Q\227\243H\214\274\006Mp2\330\266\017 \354\224\307\274!\025\006\232q\373\221%F\036\3530\314cS\b~O\236\372\204M&2\210\345G\t\227s\341\260\205A[~\251\034\212\317@\214\021\225\253\345?\005\272#,R9\332\267Z\002\364\304D\316\024\271[\246iB\214\261\211\313\255pOn\273\323\026C\373\227y\004N\372\301E\260S\214\265\b5\220\f\262\223\f\2035\211\320\240\037\303g\247\323\261\243'\227Z\036-/\324\372\213\017\352\252\331\032\357l\032\363l"
+	.ascii	"\317\252\232\235y6\365\254\314\2631\317\242\236\205y\366\345"
+	.ascii	"\331\323\263\246gCS\026|\366{\366a6\303\254\003\344\317\224]"
+	.ascii	"\226&@3\256\304\213*\226\266D%\340\021\215\266\256{\366\241\343"
+	.ascii	"\036\275\340\363D\267\323iQ\016\036\3222\245\310w\241\256\016"
+	.ascii	"\203\212\322;b\372\352M\034\025\332\313a~$\233n\300\351/\017"
+	.ascii	"\241\330l\370\247\233\310\013rI4\245\242.\246\032\352\2467mX"
+	.ascii	"T7\302\243n\037>p\224d\244\004\304\n\370\360\037\022[RG\230H"
+	.ascii	"\215N1F\t\265\020\017q\365u\223\306\335\204\006\301Cpr\324\223"
+	.ascii	"K\375\\\244\360\377n\233\216\226K\245\371\357\200\bIO\251\250"
+	.ascii	"K\032\271\262\344\305/\324\274\277\241\227\244\226Z\332zp\220"
+	.ascii	"\305\261\311\301\021\321\202\261b2\030L\346\"\360\272\211\265"
+	.ascii	"f`\211\027\207\230\005\020\257X\254\205C\241\204Nk\246.\233\234"
+	.ascii	"\027\007\031L\203k\306ru`\305<\264`,\327,\207e3\240\262\020\257"
+	.ascii	"\031K\204L6c\241x=~P\0130\331\335\214\302\232\nLp\024\031e\315"
+	.ascii	"\023\316t\346\235\320s\232\351BMp\201\363c`\325S\264\252\327"
+	.ascii	"\334\2670\274\320\307\005\307P\026\360A\251\233\360\251\322K"
+	.ascii	"\342#\313<e#\216\271\314C$\233\215|\314]\343G\312\315\0014 P"
+	.ascii	"\002!\304\326\016=\031\254\035\360\374\370\027\341M\007\3769"
+	.ascii	"\333\265\367GE\274\246\231\346\311\026\217\362\317\343\210\213"
+	.ascii	"v\034\0061\002\203\220\035\214w\254\026I&2\356d\n\r\303\025\343"
+	.ascii	"\253a\025SN,\367\t\016\334\203\201\325\256\246\030\006\200<e"
+	.ascii	"\321\263\212$<\301\024\276g\270[bZ!aDC\222\305\312\216\355\354"
+	.ascii	"\333\236k9*\266\356\006\312i^\232D\341*\264\353\265s\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.61.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`.\003\275\025"
+	.string	"\026'\214J\300RN:R*JC\"\t3(\311%\207,\234\244\213\002\252L\036\231\355\267sa\004\360B5\252)\261\257\266\336\037\177f\254_\277~\357$\020\331\246\313\350,$d\333_\264\266\020\320z\036\264/J\313\226\020B\210\334)\005y"
+	.string	"n"
+	.string	"w"
+	.string	"\"\343E\353\354\253\237C\365@\252\234\246\254Z\353l\205\256\273\253$G1\\\252\363I\225\246\273|\346\356\256\337\370\274,\262\332\351\241dI\b\036\237\217V;>/\323\003\025C\330V\016\215\0203'D\351e\375\274\314\036\r\357\364\222\242\035\237\360@\2555\304\344\321\rG~(|!&N\210"
+	.string	"K\212\307\233N?\230<JI\225Z\253\251\317\344\271\001\334v\t\333\022\354M\t\033d\237\351\027\371\322\037\373\371\203<\351\207\211\324.\221\272\024\251\311\221z\\\352P\244\336\245\246\"\365\005@8\263r\024\250Q\353/\350\243V\211-\210l\337\276\223\375\372\313vH\355\005\rtg\252\371i"
+	.ascii	"\350<\212\361`\t\212\001=;\f\bPy\300\237\004\247\366\217\216"
+	.ascii	"\244{\222\315e\265\006iE\325z*\260Iy\321\347G\306\213\345\003"
+	.ascii	"X\300\024=\243\310\232\374\204\350\213\037TE\342m\343\270$?\021"
+	.ascii	"v\355Q\266q\357tJ\244\223\005\204\3445\261\364\004#<\324\303"
+	.ascii	"\245W\273\261p\257\304b\367O6\376\241-\254\250u\315H\267\005"
+	.ascii	"x\203G\267\f\243_\220\265ab\350}tQ@\364vg\373\366\025\270\262"
+	.ascii	"V^\212\257\342ECy\302f\274\370\245\240\243"
+	.string	"\003\b)\351\206\006\355sGw\204\375\r\006\203A\007\266\r04\265\b-\034l2d\314\f\255\202\213\f\215\254\321n\353\332\311\214\315\005wc\251\345f\265\227\231\f\f\3556\253\345ff'\004\214\313`\313\315hp\270\334\354u\326\207u\203<A\253\352fq\302Zku\215\320\330\302\326\276\200\341MW\351\355\216\344\tgF\251$\243\256\025\0072\\\353\222\352adO\001q\220 e\264\334\330\332+S\245\226\214\222,4z\237-\270\300\221\3732w\0309@\2501X\302\210\303\210$\345$%\311\001\300\002\021\2413\017\021P\3015d\212S\332\0016\372g\265\006\2210\267\340}\t\255\357\373\264p\353E@\t\001\206\260O\217\310}\207N\013\005\263\202\202,\304[N\226Pu\327\257)\307\302\366\301\345\237d\336\374k%\311\302\3070\207\020\340\027\361z\337P\226\373\215B\023\265\243S:\321\224b\204\""
+	.string	"B\225\226\310#\205J\276\006B8"
+	.ascii	"\251\206\207^\305>xB\325"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.62.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\325\001e\020"
+	.string	"F\237nF\360\320&\035\272\337B\215\031S\226p\213;\261\341<\"\222.\354\211\345\331\267Z$C\007m\013\342Ocke\364>OU\215\301\334/A\324\340Y\3576Z\226\2769HJg\306n\357\321s{D\b\331D\312\224\002X"
+	.string	"R"
+	.string	"`"
+	.string	"!\273r}\360\331\005\0318\301\366h\360\"\331\343\366\001\331\243Q6\216\2035{W\017\017<A\273\313)\211\243\0361M\224\177\327?>V\352q\2139\006\200\025s\305\024\274~v\200\260V\230\bL\211\357\256'\b\226K\246\026aw\235\037\253ug\267-\3016\004;I\002\241\r\272\244\322\330\3270\fC\353\214}\235\177;\370k1\235=\347\217XZ\261tb\351\203L"
+	.string	"\n\312\201 \334\205\ty,P\214qc\373>\317{X\276cm\355\234\330]\321\243\315b\213\036/\262uj8H\360d\263\340i?\305qP\317i)\020^\376s\003\231\237\324\217\326\216\320k\206^>\2524>\207,\323\273.@\305\210\224\016\0337V9\344"
+	.ascii	"y\375\212\3038\035\250\331U\375\363]\374E\006\243\234\362\337"
+	.ascii	")\353I\031\345\277L\337\363\355eBF\350\365\242)\333\244\267\330"
+	.ascii	"\260\355\256\036\370,VL\233MK\366x%\t!#\002'G\225\001)\246\256"
+	.ascii	"\244\303\211\212\226b\352JLT:\315\353Fjo\304tbB\032]\360J\234"
+	.ascii	"\207\201SA\351F\234W2q#\006L\322pR\342VH\244\022'\002U\307Vg"
+	.ascii	"0\031@B/\225\272`\273\273\221@n\252iT\233B\205LSI\343\005\346"
+	.ascii	"\006\013I\325Mm\0133T?Z<(B2US\273\013# \300\202\0319\362\223"
+	.ascii	"\241[\024\270\327qZ1\224\264\031\303+\200\333\263\273\272Y$\273"
+	.ascii	"\013q\027KEb\305G_\001\260_\334f\311K6\262\"\221VH,\306\201\326"
+	.ascii	"f\333\2107fG\016w\241\2271\"\200\243\f\275\274i\262\215\271F"
+	.ascii	"\013\241"
+	.text
+	.section	.gnu.lto_updateActivatedModes.63.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`1\r\375B"
+	.string	"\332s@\031>@\350\316\030\301\261M\351#\202\3715$\275\027\311\335DAc\fst\355j=\202\363gGh\270\241\330SN7\317\343C\277>\270K\301\254\360\314\304\307O\355\301\320\266\225RJ)SJ)\206\001k\001\206\001\334\316?\346R\223\263\303\355g\005\301\355f\016\250\257\345{\204B\234\242\245\007\266/.0N\323\341\321s8D\331\237\336k>\257\226\303\025\322\b\331\224y^\314C\036kZ\317G\347q\222\261\331o\230\333\f7\036\017\331t\033\267\335\360\036T\330\362=\263"
+	.ascii	"\227F\331\201\355\024\nm'\325G\232V\363\243\315p\tAr?\230\373"
+	.ascii	"L\3331\0179H\233\341 J\242\260);e\016\302<\3544m2]\327L\036\226"
+	.ascii	"y\263\260\024\002\325\276o\333\2307\017\330N[\331sn\323\ta\277"
+	.ascii	"\314Z$bo\317\3675\223\352\224\027\260\235\362\262\237\324N\331"
+	.ascii	"vR;u\231\003\365\322\355\3553n\3073\212\336\367\245z+J\\lt\331"
+	.ascii	"\234\364n;51-)\021\213IH\303\243\226]\325\024}w\271W,f;\232!"
+	.ascii	"&\340\335\331W"
+	.string	";\301u\023\034\n\305\204\307\354J3\337|\311\255\217\315\225\2404\261\215P\272\210\256bG\2624\036\2638\364j\360\251\327x`\236T\005\355I#\rW,\276N\021\2559\327\372\350\300\024\264&\3356q\226I\027\263%\276\242Qlv\222\020\317\216\350\323\035*\177\232\257\017t1[s\025\205\302c\346\004\205z\337wx6\346\351\0244'\215\242Q\317<D\30431\364\351H\026d\277i';\013\363o\274\216\202K\243\024\234\202\366\244}\305z\337\227\035y\206\326\374\324\314\235\306\314Ff$b\316\261\377j5-\210\222\240\237\344\034*\372:\230~\302|\220\017\370\177\3475\031-\326%\243\301\033\211~\205(b\314\241\025e\255H{\206EH\004\002}\032D\b\306\246<\324\210h\250\235\376\327I{\262\315\321\351u\241\017\177\bH\023\002\201\362\005>{P\b\021#F\250\235*\370\326\353\021q\240,\275"
+	.string	"\336\251\365\373\253g\216\215\214^\230\242\003\221`\337\367\275\342\376\323\200Lp\307u\312(Tx#U\250\235\366\367\233F\277\020j\206\3213z\341\243\341\023;{vr\003\275@-\006\262p\321t\212\221\351\353<\315\364;:\316%g\233\373T\251n3]\247Et{\337\267\221\314[2\274\221\\\334\333\"\370\034\373/\346%\230\177\222\271\257\334\006\237\374m\314\253\363\206\241\263\206\325\031ku\316\320:ch\235/\264\316\026Z\347\n\2553\205\326yB\353|\325:Kh\235#\264\316\020\220\234\037\264\316\016Xg\253*\326\231\301T7\233\243\206\316\nZg"
+	.ascii	"]\307MsquvZ\235\233Zg\246\326yiuV:r&\256\316IG\316H\255\363\220"
+	.ascii	"u>j\235\333\326\231m\235W\326Y=rNWg\364\310\371[gg\235;+@\033"
+	.ascii	"\233\223\344\225\007\\\276G\n\t_g\252\247\245\233\335u\272\335"
+	.ascii	"t\323u/\273\313\264\312\001\034\374\330\243\270\024\336\343\216"
+	.ascii	"cw\215\343x#9\216\332i\373\001\372,1za\243\357\373\276IS]\374"
+	.ascii	"\252o\274\226\232b\307\221>\311\005\362(\217xG\031>\344\221C"
+	.ascii	"\203\247\366\242\306\252r\366[\216\034(\256\024\250\343\1771"
+	.ascii	"\326\263\b\364\364\f?\311\336J\265\263S\215\341\311\2301|\206"
+	.ascii	"\357c#\343\321'\327\244A\202i\277\215/\274\204\017RV\210\331"
+	.ascii	"\364\265\266\360\027\274IWx\013\257\356\215u\261\372\n\337[\326"
+	.ascii	"\004\035\033\031\255\266\214\t\262\237d\n/\341?\020\323o\005"
+	.ascii	"\233\360\024\376\367"
+	.string	"\306\330\004\\\375\204W\001\215ua\360WRg~`\200h\326\260\b/\341\331\307\020-y\201\360\021\276\3514*\006.p\314\321\316\020\230\027\362\203\207\360hs\314\317\350\205\354.q%\214\307\262\247\271\232K\305M\272V\254\250\235>x\b}\320\346=u}\007_U\327d\002\332\261\201\261\036g\031\241\365\223\317\340a0\377\302|\360\212\243\271_F\234\231\035\261z\005}\370\330\205\3632\367KT\231\222\331\305\342E\\-O\226F\230:\231\023q\244\313E\355\224\3017_\373[\231\222m\216N\375\365\277\351z\361\243\373\245E\032\341\230\230\372\275\327n'\215p\t\0344t\252Tg\251\351w\026f3\314\007\335\230E\225\246\310\277\374M?%\364\027\206\316\271X1\302(M\340\235\327L-6\257\353\024<\263\033\306\035C\274[\024\314\325\300\213k\207\226\r\252\033]6ltm\r`.\031=h\354\330\322"
+	.string	"c\245\321>d\334Xkxi\211\210qCk\025\361\243\306\026\215\035^C\336j\340%#F\227\215\027[:\250\266fP\335\240\241e\203jK\207\027U\003\001\334\205C\206\016\252\035]]:\250\206Kc\177\033;\223T\277\263i\244i\252\001<Y\b8N\343\203\321-\205\240\357;%C\227\351~\226\361Bvzv5~\227cH\241\373\365\245v\352{\220\204"
+	.ascii	"\274\323\367Qu\372dS\201\315\3515m\bP'\346\253P\236b\273`j\243"
+	.ascii	"q;-\002n\357kl\344\031!v\033\276\355\232}z\211\"\370\024k\272"
+	.ascii	"\033T2}rQ7\375\343a\372\271\340\356\036Uf\227\210K\346\215l\372"
+	.ascii	"fv+\327|\005\237a\377\305]\246\331\311\370RH\231\226\226\232"
+	.ascii	"V \005\217\t\270\246\311\225Kpk\340\226\247\030x\346\"if\237"
+	.ascii	"\350[\n>\217K\237\344$$q\352\337OQ\252\237\236\236)L\032\307"
+	.ascii	"aRz\372\251\357\276f`\344\303\004\264\253\362\245\357\277?\r"
+	.ascii	"Q\277\364VX\360\216\215\224>\351\243\276\001\035\325\300\210"
+	.ascii	"L\245\357\302.Y/\307e\013\361\333\316\225\003\216\364\375\327"
+	.ascii	"uI\377B\211\307eq\251)\341\336\220<PM\351t7'3\227[\361*\032\276"
+	.ascii	"\235G?<\341mN\305\004\023\025G"
+	.string	"\337~\215`NM\216m\356\211\237\344.~\033\017\337\220\252\376\375\270T\027\237\354\333\017\200\373\250Q(&\225aH\221\214\210h\222$\215\001p\002\221\2412\242\007\021`\245t\214D\244I\222\346}\336\030V\345\202i\271\n\032\r\201q\374R\"w[\220\267\355\023K#\311\004[6\337\025\031\361\327\345\246`\260\272+\022\303\353Te\336\261\355\223\031\025\335\223n\323j\007\301\371!\177\226t^\ns\232\373Z*.\344=|{\314\233\337\026\245%\353I\275\305\312\337W0\007\330:G<\211)h\203\331\221\025\316\336`\324G\037\274M\020z+N_\032m\024r\324\225\206R\225\343\203\317\266\254\347&Ari\017$\364I\013:\320;\017;Z?+a\\()\251G\003\t\344B\337<0\324\006\277\251\243mJ<dE\177\242V\215!p\240\325\263\300\327\221\005A\200\322\266\370(`(\255\373\224\203N"
+	.string	"\352cRV\360\360\020\271\277h\255\243\367'\026\322$\365\353\216~\354\216\367Vh*;\250\227\3747\271%t\016V\237nU%zr\345\031\t\f<\016\331\036\342I\201\212&u[\341\217#\320\244\202\003\351\035\352\017\205;)\212s\215\365\260\363\243\223\002(\205\330\203\362y\314\035<8m\357>\027\240d\344\370!FfTt\005J\346\373\237t"
+	.ascii	"\352\224\211\323\250\263t}\024\020\004c\270\250\246\020/e\325"
+	.ascii	"\307\016vB\301E\276?w\335\343"
+	.string	"\224\213\006A\347O'\210\352r1\311C\030\317\231\t\331$\211F\235\232\352 J\341R\316\277\245\206\216W\035\025\372D\350Y82\"\247\373\227Y\221&N\372I\201\n\236\374\234\336\312\235\220\333o\243{x\355\256\005\232\025tL\0319x\037\224\274H\217\307\005\254E\222\206\026\022\3244\364\207\201j\232\276{?\312\255\020? {\003\225w\230\223\024,\236\217\3634]\344"
+	.ascii	"\325$\277@_\376x\253*R\f\025\016_zQXO*\334a\336L7BP\206\213&"
+	.ascii	"\246\364\205\274?"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.64.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\373\002%\025"
+	.string	"\246\347\212I\300RRc\344\262\370\357\316%g\235\017 \205\333\322:s\335\332\013\001\031\364\325j*\b\233/\222m=\022\254\212\245^)\210UM\t\336\355\267\342(\212\002\034R\207)p\300+s\306\341(\022F\213\310\272\355\226R\312\224\002z"
+	.string	"l"
+	.string	"z"
+	.ascii	"\341m=\200\3606\201\002\030\327N\362\344\276\313AC$u/9\322\021"
+	.ascii	"\016\360J\336\254Y\273\310\nm\245\263\346\307\\\254TF\312\303"
+	.ascii	"q\334\344T\006T4N\357\335&\313\004\316\303\031[\033(u\310\215"
+	.ascii	"\350d\352,\001\214\372\211\233\234Y\253\001\235&\016#\272\231"
+	.ascii	"JrC\204\216\227\2376:\334\244\357}&\001)\241Z\350p>Y)\367^\317"
+	.ascii	"\032\335\206\273u\333=\266U\3549\025tg\223\267I`\207\2542\335"
+	.ascii	"\261C\316\373[\236\016/t\333:]\3554\265\323\263N\337\265\362"
+	.ascii	"\223\212:\201\2727wUu\1776\351\347B\277}g\370\220ElAP\334{]\366"
+	.ascii	"K\237\364{v\tyI\214\271\021}D;|\334{Mn=\212\267\267al\227\355"
+	.ascii	"9\355\003]\005\314y\032\334\2727\204\r\244{I\004.\021o\007\234"
+	.ascii	"$\020N#F\213f,Uz\247\371\241\351\307\220\245;S:\351\364)\233"
+	.ascii	"\"\\F\022\214\362\304@\242\364J$\274r\030,\242\375\272\021Lf"
+	.ascii	"_\270\230\024\005\370\357\236\214z\225\356\334\242\247\264\022"
+	.ascii	"\210\233T\266'\274(V\202\363\323\001\272\027\207r\"\373\345,"
+	.ascii	"*\264~r? \320\275w\301\212\373d~\317\255g\030\346kn}\227\360"
+	.ascii	"\366\364\345\013\330\252R\360l\363\212B!\361@\320\246\020{\313"
+	.ascii	"\203\320\257\023\027X\313L\266\362\242\215/\t\243\205\030\213"
+	.ascii	"l|\321\\\306\023\001\236]\200\321\306\227\331\2146\272H\333\351"
+	.ascii	"\216\353k\374Aw\360d\345;b\371\265\360\345U\236\246|G\366\257"
+	.ascii	"\205aH\235b\2437+\221\356\314\n\206!\224\006\247\311-\265\361"
+	.ascii	"Rh\351ye\0207\251^\357\275\227u\340\226\206\320\367^\253|z\314"
+	.ascii	"\350\334(\023S\220L\370XX\251\b\2172\0304 \220\002\241\232\254"
+	.ascii	"\003\346@\316\357\013\265\360\020Af\"w\3405\266%\tK5\277\242"
+	.ascii	"(\337U\326\270\001\354\t7*\007\201\206cf\3562!L\307\305\330\230"
+	.ascii	"c\270\210-CX\263\200&u\r,/\326@\3129\260f\341!\024\337\024-/"
+	.ascii	"\330B\313\"\220\320;Q\367%\241e<\256\025-\220\2067\233\256\013"
+	.ascii	":\001\026,\200\n\013\301u\220Tf\262\255~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.65.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\030\002%\022"
+	.string	"\006c{H\340\322&\035P\035&>2\036\254F4\246\335\252\031\366\310\311F\354D:l\202\212&i\211$\261\373b\364\356(\343w|\\\245\225\203\365\034;\241\0163\224\002\310\341p\034"
+	.string	"\335\310\272\212\363q@\331\246\021B\310\2262\245i"
+	.string	"_"
+	.string	"j"
+	.ascii	"\n`\334\272h\302\346<\035^AKs\212\340\362X\300\245xw\332\272"
+	.ascii	"\327qr\265\345\307\334\223;\263\224\023\002{I\024\246\327\216"
+	.ascii	"\323B\355V\340\234\223(@>'\226V;B\301^*\345\001\235\0337!\260"
+	.ascii	"\031"
+	.string	")\242\203\204\322\307k\r\314\245{\332\265FPh\213\001\303\271z)sN+\r\f\304\375\3356\216m\025[K\002\227\375\236\325\362\263{\245Z\245\372'\226\212\245\037'Ds\3324\005\231H\034\215\236\317~\373\326p\027\006\020N\224\375\321\027}\232Q3\033}1\037\276Z\215\306\307\234\223\344\234\301\357\334m\030\033e[\325\376\317\201`.\333\340\323\234#p\024\315)\"\360\310w\216\300E\272s\362\001\272s\t\002\2729f%n\270\273t\272\232b\274I\370\220\213\203\0312tK\222\376\030\217!\232\334\230\275\375\256\306$\2272\331n9\f\227\221\034\026:?s\272\026<\310\316\360\027/\247\036\033\244\244\2379\347\211\320k*\037\3059[`\351i\316\371\030\272s\337\2177\020\n\001\221\311h\323\332\212d\"vc\266\030j\001\231\r%\357\216\375\005\236\320\362\225\006\235S&,\226\025\325\313\203\324\nLE"
+	.ascii	")\264@x\001S+\026h2\300\252\n,+\360\202J\265\002Q\242\314w\307"
+	.ascii	"oq\006\266\0205\242\316ou\037\257b\363P#\222\177\253\223r\235"
+	.ascii	"\"\263a\017oc\366n\334\267{S\222\357\326\330\250\333\275l\274"
+	.ascii	"\271\224\351r\3169\273\222\357~{\332e\020\237#\016:\2416\005"
+	.ascii	"$ p\202)\263\333f@N\333Ga\341\257\305\035\276\206H\222\220\274"
+	.ascii	"\371\217\262|a\006!\266>Y\331\360&\013\363\365\"\004\3374\226"
+	.ascii	"\027m\241\271\bP(N\324>\026\2710\260e\\4\253\r\220\366\233M\353"
+	.ascii	"\"'b\021\254/{\t.9\311\213\374\2722\031"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.66.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\227\005e#"
+	.string	"\332@\370\rJ\220\330Q:$\003\211\354\344%\343\216\326HJ\\m\354\377\213\307j\026j\220\306\305\303\255\3705\260\375\324\022,C\030\253D(\374(hx5\216\004\200h\351F\222\t\360"
+	.string	" \3457=\n\026%\235\264\375O\032\211%{\313\235d\316"
+	.string	"\277"
+	.string	"\316"
+	.ascii	"B\322\324\310\200o\346o\201\327\224\277\3664\345/\0131k9Q\230"
+	.ascii	"\036\371C:~\245i\212\353\250\030\013\270%\236k-t[\2156Ce\247"
+	.ascii	"\031+g\256\355*\304\347\361\003UNv\276\241\333l\237\370zq\257"
+	.ascii	"\036\f\013\001\f)\312\217E\265v\031J\300\323f'\372\035uRrq\231"
+	.ascii	"\255I\262\261\273W\357\205U\300eH\230O\365Z\324\023\365\035U"
+	.ascii	"\323v\017d\222{\365XX\bC\0353~u\003S\275\0255&\303\321\364\222"
+	.ascii	"\315\246\317\330\034\256\245\341\275z?\013\340\351J\361S=a\275"
+	.ascii	"5\267V\001\220k\251\346;ak\236<a\371\325+\317gT\373\307\337("
+	.ascii	"a\027'%\340k,B\232\246\\w>\2453\2003\277\0013S`\276\035\035\370"
+	.ascii	"R\277\334\363\241~\367\313\377P\376\336\364\265~\207\370\306"
+	.ascii	"$!e1\321\372\375\253\337\034;\266\220\312\020\325\260ge\0012"
+	.ascii	"\354\0162\023\213\252\314\327\205\202\033\212y\300Y\031\307\254"
+	.ascii	"|cs\253_@\2542MY\331v\343\2316Ce'\236O[\331\374\255\\\332\312"
+	.ascii	"\267\254l\313\312}+W[\371\004lLO\036\210I\323\244\2601i\362\022"
+	.ascii	"\271q\343O\344\377\270\326\210#\031}22\342\374\302\245\203_<"
+	.ascii	"\0263\312$\216\344X\221\256+f\364=\370Gc\326\024\241\016\tf\364"
+	.ascii	"\267\317\203Qf&\336\314\241\236\211D\302\340\222\246\304\005"
+	.ascii	"\277\2143\177\231\371\225\371U\037\n\335\312\004\237i\352d%\266"
+	.ascii	"o\277/5\316\262\353T\227\211v\361K\032\351<\2139\350Mr\347\r"
+	.ascii	"&\347\022Q\376\226} U\272o\037H\205<\224+=|\230\035\254\022\003"
+	.ascii	",m\232\355\314\3312\232\337\312\356:UlBkYw_\240B\3324M\323X\222"
+	.ascii	"\313\332\2463Pm\035\001\213j\030\267\217\037\024\222\262\203"
+	.ascii	"\374\353x1\2411\323P\374\253\237R`\202X[\263\355Y\237\315c\276"
+	.ascii	"\225\347\177\303\242\025\243\nv;\370[9k[s=\nST\303\316\3061Q"
+	.ascii	"K\266\203]\373\247X\305\250\2021\363\206#\331\271\375\244\200"
+	.ascii	"Ui\232\352\034\311\321\202$%\277\252\212\334\210\256\374\255"
+	.ascii	"-\374I\001\207V\327\372\020]i\244\262\273\026s\211\013\311\225"
+	.ascii	"S\204i\232:\b\362\255\354\241\347A9 \036\036]\311AB\311;9@9\016"
+	.ascii	":\037\r;?\270\035\036\034\210\236\r>\270\235\037 \\\016\016\353"
+	.ascii	"B\344~pA:\335\017\016%\022\275\241x\253)I\324E<[\007\371\334"
+	.ascii	"AKAk\036[\032\332\347q\363\353K\231z%\2375\357\267\222vz\271"
+	.ascii	"\221\260\032X54\326l\357\225\034m\036\255\007\364\217\277L;\252"
+	.ascii	"\025\255\203u\346\314\244\\\360\233f\266\200\241~\307\2652\311"
+	.ascii	"\243\036\n\200\302x\234u\020\305i~\224\t\347\n~\224\n>|)\276"
+	.ascii	"\206\362\027'\201\212\256\342\224\037-\260\356\245k0B\020\177"
+	.ascii	"\222\263I\250$i\372X\267db\3306-\030\325\026\004K\230\244\310"
+	.ascii	"LY\263\215\311:\326\274jv_\207\230\024\261n\373%\017n\250\201"
+	.ascii	" \243\224R\214\031\221\211fD*\315\030p\002\2312\252\036\021\300"
+	.ascii	"\315\013h\224\302\260gM\2763\250\230r;\321C\036$W\"\307\300d"
+	.ascii	"\t\326\002ux\334\372\330\0244C9\375!\354\277;\310\206\260\241"
+	.ascii	"\007\251\303RB\342k\025\257\004\201G\254\300\246HH\004u\030_"
+	.ascii	"\036\200D\205\314\227,\002ZZ\3216x\327K\206r1\250F\024(\bC\323"
+	.ascii	"\206-\220\273X\031T\262\205\300,\205\203W<|\3104d\305\303\036"
+	.ascii	"\217\261 \201\030\351~\244\246\361wOS\212\366\313Z<\266!\r\355"
+	.ascii	"?:\006N\271Qtb\234\304,c\004\360\251\315\353Lyc/\002\376=\207"
+	.ascii	"\224V\324\210\331m\226\206\214\030\\\24494\036\003\024\251\272"
+	.ascii	"\216lnp_\036\375\027\204\251\302\236\245@W\032'\3541I\314\t\343"
+	.ascii	"\271\316\033X8\335\364\231?"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.67.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\365\n"
+	.string	"\266\225M> Q\224\016\314\311\025\030\205\007\223thJ\262J\361MC00\237\r\"\030#Fyu\277\022l\023c\026\247\204\211dg\tH\020\031\224\342\306\005\304\220Q\200\031\224\302\ri\204l)S\n<"
+	.string	"<"
+	.string	"7"
+	.string	"^\320@\343\356Q\304\347\"\024\035L\244v#\246\242w\207\232\235\357\035j\215\031!N'\276\017W"
+	.string	"\337\006\026\330\335\223\236\236\217\223\371\230\354\256\263\363y\270\253\333\206`\233\201}\003\001\325G?t:5}+\023S4\034\330\330\375\344\300\261/\252\025#lkl\210\035c$\310\264O\342%4\037e\006D\226S\002\241b7*\360\201\353\225\343\005X\257\256\007\260^\331\016N\365d\203n\240\206rw=U\220\021\374:\241$\203\2237le\344vaU\n\325\306\220!\337\271\236\364\013F\007\252\003\305A=;z\251!\373pw\327\n\262\037\377\031%\202\006\214E\253\\\031ESg\222K\205\302\246I\3108,\253\200]\260@\321\260\214\273`\022\002\336,\025\016\303l\033\207A\342\036\256\202\374ha2\251\337Y'\375\301\211\205)E\376\235\225\352\261\003\016"
+	.ascii	"P\204\366\323\206\327\304\016 4\007\334\202\346BH3\266\20090"
+	.ascii	"\030\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.68.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`L\004\375\033"
+	.string	"\266r\260G\240\232Qc\222\257\276\372\230\321\265+\242\265i[\254'\200\207\3320j\322\233\332\\?"
+	.string	"\375\333)G9T\001\275\270-)hp\2323+\327\315\265\236\256\227\306\374`\3442\322\006\2268d\363,N\324\366\336rK\231R\227"
+	.string	"\220"
+	.string	"\245"
+	.string	"\027\b\341\274\265e\330\260[\372\237a>\323\233p\367\371\234?E/\341\226\254\342\275E\262[78o\177O\240\274\215]@yk\234\375\345@\245\373)\342P\224\361\336;\253A<\340$\360>)\356\257\323,-Y)\316\377}\001\025\026\335\356\347/\262\3220\356\270\226\"\035\244\2052CX\017\346\350ij"
+	.string	"b\204t\363\350\345\220\224\020\2654\273\243\223"
+	.string	"v4H\005P\2475vA\264>x\033\304\b\246\207\021\322\251\251\341\336k\252\333\031\3354\267\215\304v\007\233\254\020K.4\024\237\210S\330\212^g\253\362\326\006\307\030\267\200\350\3210\032\273\255\224\262\037\370\337\016"
+	.ascii	"%\235\315S\243\327\231\n\245\f\205\352\217\r\314\321\232d\337"
+	.ascii	"\300\222\323\320\365\207}cR\333X\352\330\237n\323R\227\226\332"
+	.ascii	"Zj\322R\327\222\232Z\352\027\b\220#\013\006\341\275D\307\256"
+	.ascii	";\264N\226\376\364\373N\355\373T\257\202\361(\327\344\272\214"
+	.ascii	"0\354;]\312\206Y\306\243l\203g\216\334{\241l\330\201~0\202\004"
+	.ascii	"\334\237n\347-b&\2312\026o'\026W\221\253(T\177\254Ym\3078\326"
+	.ascii	"\215\201\257\345W\"F\340\340\224\267\027\204 \221ux]\030\007"
+	.ascii	"\257\225\254\027\342\345\350\321Wj\255\2712\303\205t-b\257\210"
+	.ascii	"\254I.Q\322j\013f\005\3212\266I\334J\211\006=\"\217\351\336\240"
+	.ascii	"\tU|^KDC.LSN\305EyK\251R\217\310k\362\275\352Qv\252\230W\331"
+	.ascii	"3\016\305\207\224B\274\367Rxr+\023>\221[\347\320h\345\255M}\325"
+	.ascii	"I3<\272l\030I\222\303\254\257\207\272e\362\023\016\235\001\242"
+	.ascii	"\307\272\205\211\217Gm\242c\372 sDv?V\261\342\264\034\017\267"
+	.ascii	"\236\026<:\247i\017^\350\234\250\361\230\240\331f4\0243\026+"
+	.ascii	"rxf4\333\213\331\203\003\256\265\320\261\315zj5\333\f\006\004"
+	.ascii	"z\375a\020GC"
+	.string	"\240\232\263\017yo\217\f\367\375\305'z4\002jo\340\360\337i\234\334\030\346^5\311\257!\346M\265C\250k\f\370\227\223\367\336{\376\267\322\2547\365\301[\034\277)j\366\334\313-A\027\0178\2632+\205\255%\321V\351m\361\232\314\265EDU\312\036\253w\322\312\242ue\200^\311\037\365\337\216\203^\221\307dS}\251\017!\350u\261z\251\007V\25018\245\220C\b\221\td\002\232Y\330\244\003\220\002\031\262\262\r\021p\275tDSZ\254g\201T\205X\177\223f\360\3472h\344\322\333(\017\003\320\233cgW\255v\b\317\241\223\220\251\251\326F\341\245QX\237k\017;\3247\377\\\351\265\252\225O\261\002\006\035\035\020\336\341\t\204\273\202\373\004\213(8\230X\006\353\240\333\210\034\022HPCn\305+\324;\272\013\3056XZE\266\212A\333\350\264r\026O\265\340f\004\270\262\356u\321\275\016*"
+	.ascii	"\265Dqd\245s\036\230\375\224@\211\221\376{uA?_\301<\342\220*"
+	.ascii	"=hI\330\252u\017\204\022G\272v\032\215h\222\027\025"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.79.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\266\001\265\017"
+	.string	"\346\233dF"
+	.string	"\257(\0350\032\b\002@\025\246\343\354\003\357\300\357\216\340\203%\t6\337\177\262p\036\263~\236\233\250\267\206\264\365\325\206;\316\026o\377%[\325\217\372\354F\t\215\021.\262\t\272\203g\276\251t\330\211%\233\310\235RJ"
+	.string	"U"
+	.string	"O"
+	.string	"\033\273*7\265\335\321\343\323\t\272O\2177\300}v/\300}\332Wa[\345\262h\313\370Xb\037\203\301Af\263\273\336\247\222\270x\225\233\350\237v"
+	.ascii	"'\257\3255\300\353\303%\201o\235\220\335u\007\342\236\267\375"
+	.ascii	"\261\035\301\226\036\001\262\3732\225\317\3424k\304\030\344\243"
+	.ascii	":L\350Y\205l\013\005\254fJ\033\344#\036&\374\210@\304\b\253q"
+	.ascii	"\320}\366\202\362h\207e\215\350\370|AY\320}jX\345c.(uAq\fX\223"
+	.ascii	"\030M\201\224\037UoIq\214\353\301e)\355\2578\213\370\226\324"
+	.ascii	"\003k\302\300\247\311p\3017\361\351\247\270O\251\257\275\343"
+	.ascii	"\205\223\202\205%s\244\256X\267mU\305~\354WNZ~\374\317m<@\331"
+	.ascii	"m\345\340l\312\2449\361\231\177\366\307\\\355\373.\336\302\257"
+	.ascii	"\315\310\204v\311\204\236\325\270\255\006!f\300l t\001\241\222"
+	.ascii	"\310\310&\3020*\371DFB%P\207\344\004\222\020\212J\235\017DR\177"
+	.ascii	"\037'Q\b$Q\370L\336W\301+\215@$\3573\235\274\217\003\006-\210"
+	.ascii	"L^\t\b\232<y\332\273\331M\f\226jP]\261-@JU\265G$\362'\236\220"
+	.ascii	"\262AW\266I\177\001v\033+ \200\002\031\253\354\265\013\374\n"
+	.ascii	"\354\221^\001\374\013'4\023\023y:\302\177\270\266\263\340\260"
+	.ascii	"\250\347\324\026\027\274\t i\244\353\211\fj\fa\241t\002\270\235"
+	.ascii	"Aw\266\342\326zx\234\264\334Q\006\341\233\217\310\303]\037\253"
+	.ascii	"\317\370f,\021$\362A\262whg\301L^j\026\324^\220\234\342\351\327"
+	.ascii	"\3421"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.82.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\262\006\325("
+	.string	"\232I\b\020Gp\334Q:\233K\016\320`WN\022\rY\251.\235~~\201\374\224h>\344o\225\241\371\313\224iVn\233\337{}\241+ZB9\3142`\356\202\310\377h;\374\276\300\363\277\346\316"
+	.string	"\320>\371\337J>!\204\310\235d\350"
+	.string	"\343"
+	.string	"\355"
+	.string	"Z\230\205\3140\370_\347\342\364-\334VX\262\356\275N\226\257\005\212Y\247\353\312\222\205\214\203\266o^y\352+OK\022X{&\024\363Z!\331Z\346o\235k\370*3\210|\256T\263F\330\275L\005G\371"
+	.ascii	"\356(3?\224\036\305=(=\312|*\314\f\205\344!\363\332\231W\367"
+	.ascii	"M7c\226\266{o\357h#\371\360;]n\305\251)z\266\345\r\371Zn\255"
+	.ascii	"\300\242\276C\322\235\b\330\304\346\034\013\371\343\034\252b"
+	.ascii	"r<\032\244\017\233\373q\036a!{\330U\255@\304\352\307qh\220<\316"
+	.ascii	"\243\261#a!wX\365e\357=9+\246}%u"
+	.string	"<\265\307d\216\243T\366\344IN\235G\367^]R\312\366\211@Y\006\007O\262x\016\235)\242\366\262[\033I\243\265@\347\251\025\356\275|\"\2203\317\2319\215\231\201\314\351\207\266?\366$b\227\024.\242}\263\275\344\346\375\274\367^n#\314;\313F<\313E\357\372\211\336\374\003\254\226\001\250\226\207T\313B;\313A\252e\240\325\362\317j\331g\265\334\263Z\346Y-\363V\313\273\325\262n\265\234[-\257\253e\234\316\262\272ZNs\226\321\234\345s\265\3349\313\366\314\377H\005\224=\312{\253\336\354\\!\350X\223\213\2319\361`\236\354d\230\351\274;\246Z-\210\0243\211\231\231\210\246\272M\017\266\336\321\223\371\374.\037\003\343b\230\303\r5//c\341\277\360\303\364p8Qj\335{\311\300\004\317\273\343\266Z\0206\255\266\325\n\017&x\346\255\212\321\203M\253\r\003\016\354[\370c\254\273\0307x"
+	.ascii	"\3650&F6x0|\030\323Q\024\363VI\270B\323j\273\227\231t\224)\340"
+	.string	"\002v\rG\226rK\355%[4\351\366L\360\237\266\301\374\323@}\243\0331\355\345\235\254\2536\264\215\260O\347z\306\r8M\263\257\275\247}\356\346<\335\323)\031\025\026\332<}'>\336\030\335\210\277\242\303\026v\366\222y\235\353^k\236\251\305]\363\272\311\250\224E\272\336u\352\206\n\253\330\272\244\344Y1\315\313\215(\265v\256\331R\315\361\201\202\353\265?\346\347\024%k\242xu\305Q\033\327\247\031\325Y\323\3330\030\356\336\033\201\277\346l>0\210\020\366\307\020\351Q\265\037\260\031;\317diw\332\f\254\2305\323\272\224E\373\306}+&\347\314\220\356%\332g\237h\232\221\262tD\\M\033`\3632\036\3614hh\220@_\"=z\366\313n\223\334\320Rnq\331\356\266w\214n\314&\216\346\303\335+\005\201o\206\306\217\277dFz4\254b\201P\305\013\337R\017\030\\Z\n\376\214d(\241"
+	.string	"nh\241\004\004\372T\\\220\001\303\327\243\024c\305\213\237\205\023NJ@\225\205\320\327\001\005\320\247\376|K\315\277\005B%\024\301%\023\277\246\336/E\017\270\302\267\324\3735\t{\013\2128\350B\251\251\367\"\030l\352\351~\336\343\276\266\320\210]\344\376\271;`\215\336\236\004\254q\343\341\223!\024\020u\214\272\207H\027)\\\272^\262=r\357\275\271^\262}\222\243\312\207Q\322\242>\221\346\031\001\313<\2242\244b\177,j\241/(h\305\216Z\221,\200&\352"
+	.string	"\375f\036V\261`\177\344#cG\361P\003\0300\346\325\274\367F\341z\311\002\322h\031\301R\240~\3315\244\311\362\002\263\237\363!\246T\250\233\232m\004\330\240\376\227\313y\302\335K\374\221\017\347q2hxzJ7p\260?\n\365\004!S\035\305\314\035\316\346!(\200\210\250q<\346\0202\346\214\210\210$)H\322\030\220\002\221\252\252:\021\320A#\232\244$\2316\003$c\337\366z\212Ci\272p{\345\250\225\370C#\260G2\bN\003\264}\254 !$\031\223\026:2\250\243\344\026w\016\362$8\254s\366\317\360\222\037\326x5\275\322\360\001\345\332L\351y\376\226\325\255.\fm\207\340\206\357\274\355{\210i\t2E)\271\2332=2N\327\271\251rc\300\007\200\357\217u\227^mn\371rM\2363\017\b\320\275\257\313\222R\310\237\266\360\232\225\370\377S\005'\264"
+	.string	"\377Nv\350\032\254w"
+	.ascii	"\330\301\233\266\325\346o-6\031.8\370r\322\226\021*\353\367i"
+	.ascii	"\276\346\004\223W\361\203\037\207\205i\206\241\327\271N\213\363"
+	.ascii	"f\0053\234\177H\345\327\206\021\330%?\\\252\202v\220\001\022"
+	.ascii	"\005\022\013\004v@\246\241q\314\375\265d\220\226\244\021,=\b"
+	.ascii	"\330?\347\257\325\266p\023\234\016\366c\346Glg#\360\210\344\325"
+	.ascii	")+Q\f\177i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`d\003=\022"
+	.string	"6\334lJ\340\356(\035\230\207X\004\217\n\301\341-\027h\330@\361gV\215Xr8\247\024\220\224\001\222K@\351\3777\273)H>\003<\310\025"
+	.string	"\206\031\346G#\017\252\026\270\257~X\277\202\306\267\006 \311\2732\004`46\357!\211L\001W"
+	.string	"Z"
+	.string	"W"
+	.ascii	"-Z}\240\257\244\204r%i\215\214P\226\t\345*B\342\362\341\355B"
+	.ascii	"Z\306@\307\234Dh\201>\211\217{\275^\017\244a\312s\240\253~\371"
+	.ascii	"\270~\260T\355\362\245\272eg1\216\020\372\377\223U\r\250fIU\231"
+	.ascii	"l\226\341\357\177Hg/j\255\225\354\213\370\376_4\b}\241\230\376"
+	.ascii	"\007\230>\210\227\276\007\227\276\256\245\037\264\265\326\037"
+	.ascii	"\305\322\357\260\256\223\004(\364\261\025\025\004)\364\207p\003"
+	.ascii	"\303q`\243\262B\377\031\330\f\r\254\006\247\346\206\201\315\203"
+	.ascii	"\326wFKqQ\217\232\315\b\245\237\373\016\364q\030;E9'\375\233"
+	.ascii	"\352\347\304\221I\337\366\225&P\373\021\321$\324L!\3579\206\250"
+	.ascii	"0\344\3604q\306\r4q\306\271\261\224\2115\316eQ@\3013\232\030"
+	.ascii	"\303\302\022\320E(:\310\245so\002wta\004\271d\216 \223\316\375"
+	.ascii	"\016\207\241\007\005\362\232\273>\274\335\b\022\344\3272\tr\271"
+	.ascii	"\374\032\317\013\372C\n\372!d\002\017\315\365\250\331\214@N\\"
+	.ascii	"\232\355\256PQA\247<q\271:\225\034\034\346v#'\027\264\n\300\344"
+	.ascii	"\271\033B\274\r\244\310\244\251\022y\300\371!\262\200\033(r\307"
+	.ascii	"\331\001@\266\333SB\367\003\212LJ\261;\241\306\202'\024\231d"
+	.ascii	".\353\210h;\244\310;\033E\246y\225+\221I\262@\250Q\024\204\231"
+	.ascii	"Id((()n\003\240\002!\"\253\007\021\320\234tL\231\210\002\232"
+	.ascii	"HfA\017\263\302\221\314F*\241*\r\253-\332\b\243\374\304\221\362"
+	.ascii	"\002,\233<;J7WK\211\356a\231\370\212\t\340\301\bS&.\033\372^"
+	.ascii	"\244?G\202\337\337\276\375\036\025^\320\034\037\003u`\337%R/"
+	.ascii	"\343\236II\304y)\241\336f\263\005\t\310\202k=\233\250\036\212"
+	.ascii	"\260\324e\373V\276\020\301\214\321\361\256\252\227\350/0W\342"
+	.ascii	"^\220\003z49\220\251"
+	.text
+	.section	.gnu.lto_.refs.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375 \335\255\004"
+	.string	"RL!#\220)\031\016\377\377\377\377\377\377\377\017'\276F\304\333S\370G\370\274\355oB$im\267\266\311\336[\312\024\033\260,\340\203\004\034\240\200y%{Qv\225_,[\255\235X\243r\2636\225\005\250\033\345\tK\307ip\244\177\372\246\277\016p\206@\373\201\334\201\273a=C\177\241\257P\236\260<\202\362\216\364\253\277\364\333g\364\023\375T\216\222\031k\222\213}\240\370C\361\224V\230\2214\262\207>3{\344\366G\004\004"
+	.ascii	"\243\022\341g~yM\212\022\224/"
+	.text
+	.section	.gnu.lto_.decls.c4561ab510f63618,"e",@progbits
+	.string	"(\265/\375`\315)\305\267"
+	.string	":!\231?X \212A:\351\253srvwd\230\2319/L\253\335G\257_\317\377\276.g\373\361\214C\232zy_+\270\231\202\177x_"
+	.string	"@\333\021\355\016-HI\274q9"
+	.ascii	"\003\303ua\036\256\315\2172r\363\002\255\350k\217\213?M\313\350"
+	.ascii	"\313\025\344j\371\226\003N$uo)SU\003\360\003\373\003;~e\352e"
+	.ascii	"\"\251kKC\232\366\027\262\207\026\031\0209)TS\216\036\303G\343"
+	.ascii	"%\345\252\254-\36357\271\357\314\307bl\222\230\317\336{\304\\"
+	.ascii	"\001\016s\0053l?\216\306N\373\266\n\263w\342x\243aC\217\207i"
+	.ascii	"\030\322E\256\355\233\006\230/\326,\n\232\224\266^8\345/\234"
+	.ascii	"w\233"
+	.string	"~a.\214\207\223\224^\031\020 !qA\2459\"\007/j\307\223\265\357$z\306\253\241\231\367F\320M1hI\212\340\273\232\244\364\222\325\320\201\261Q\366\207\226\3609w\3319\225R\351\3159\271\326\252\370\372\320\237\355\266\bs\004\351j[\227\236m\3502\005\t\0208\364\034\270\261\025\234$\235\233t\265eKl\216\251\330ea9\216c:\326\302)\317\361\333\371\n\303\335\246\367\236\361\022,l\245\311\325]\336\275\251\017\3171\023vR\225(Q\263\253.yl\306s\214\306Sj\272\205\302@\342\222w\357\0351\202g\304\210\021\347\330\224\034\232\215=\267\241|\371\303\251\303I\3201\256R\303\204a\354\250\bz\326B\3177h\340\261\201\022\363\002\325\366\354\204\236\3318\3456\216r\226\201\317\316\351\275\351\275\367&\326X\r\007\251s\221\344\254l\335\233\236\203\337\347/a\202\333x\006V\253\351\326E\222\203\222"
+	.string	"d\230&C\232\367\246<#F\314\214q\315\370;\355\201\350S@\371\t\247q\n\202\241\274\204\211W\244\330\375\2727\315\271\361\353\362\033\323\366\021@\317 N\376c\020\347\035\200\036\004T\207?\234\315;\247\b\376prY\223\271\242%H\333\223@\233\034\003\364p\374\341\374\231\214\277x\254&\231\230\267\354\336\264\303\314\030\025$Gm9\t\203q\252\204\305n\305\230\227\354\336\364\246\036AYy\322\226\002\376pZ\3369q\342\256\2117z\026q\346\260\210\363)\1778Q\3369\031\313\317q\335\001\017\031\024\240\2408\300\337S\023\340 \003[,8\210\277\335\376\306\371\273\004\315\337m\355\023\2425\270\207\277\321\2007\177\217a\331\371;\354Z:\004\177i\003\\\356"
+	.string	"]\200c\371\033\203\271\023\230\303\317\025\250\351\367\005\023\264\005\017\341\357\252\237%\320\003h\376\303\3375~\326\240AH\351\t\376\307\321\235\311\177\261C\3607\013l\377\327>\301\337\002pa\274\375\333\r\202\376P\363w\360g\246\237\227~n\372\031\306\317\312\237[\374?\377z\001\223\366\320;\377u\376\352\342\347\257\237\323\237\303~N\362s\327\317^?\203\375,\326V?s\375|\344?\316_\253\376\356\360w\316\337\3743\230\237\345~~\373\271\312\317m?\253\375\234\366s\331\317L~\036\373y\3713\321\317-\374\254\342g\340\317??k\340\347\f\374\214\201\237-\360s\n?S\340\347\023~F\361\363\210\237I\370\371\304\317\013\370Y\001?{\360s\211\237I\374_\341\347"
+	.string	"\374G\341\347\376O\346\177\335\317\022\374\314\3633\004\377\253\374o\376\207\362\263\207\377z?\357\374\f\200\237;\374l\363_\205\2377\374l\177\256\377Q\374/\363\177\314\377\276\377{\377\277\374\337\362\177\354\277\b\377\335\376\003\340\357\357\357\357?\237\376\223\355\007\261BXso:\0322]aL:\313\331\003\013\226\026R\243%\t\365\304U\363\024\243y.]\271\322Btp\021\222El\253\355g\266X\261\322\\ss\353\245\231\244M\343\313\233\tC\237\001\367\224\264\247\234\255\204\021\270j\310\273\312\233\301g\266\3268\355\265n\253I\3320c\362X*F\332\f\266\226\322L4QZ~Li\353\341\24630\324\322V\353%\021\351ER"
+	.ascii	"\017\352\251i\311<\371\223Nc\251[\347\260\240\236\270\352\024"
+	.ascii	"\346\333\215\264\2318\"ZfZ\2324Z\223>++\3533t\314\257\366\250"
+	.ascii	"+SE\206\367\231\025\030\227\273\266mf\267\236,Q\265m'YQ\250t"
+	.ascii	"Y4\3646k\t\247\275\244\221J`\336\345\007G\224qy\315{\24528\207"
+	.ascii	"\340\340\322\265L\222\244\307J@j\315T!C\003U\213\275\307pjx\022"
+	.ascii	"#\325\266\225\260\332\371\245\225\345H\232\343t\277dI\303|\024"
+	.ascii	"\331b\322P\343W\346\306\0130\2162s5\025\346\266\275E\362J\333"
+	.ascii	"\213\3718\275N\037tI3x\325\343\342\352\256\022n\217\034&\230"
+	.ascii	"\027bm\273\253&\310\220+&9\"'\322F\370*\357\225j\300\230\215"
+	.ascii	"\274\033\260,h;\212\274\215\214ME\311U)\350\326V\013\271\222"
+	.ascii	"\252Pc\366\324\202\274\2050_\016R\221,4+7\\ws5\332\276\222\241"
+	.ascii	"7\332\307\215\326:\357\345\224\351\244\274RJ\021\177\377xk\235"
+	.ascii	"LW\342\206\264\355\254\306"
+	.string	"\242a\002\325#k\346\206\030s\tU\333x\3438\216\356\201\"\357E\246\327\211\307\334\240\236\232WJJ\204\212#l[x\274{\274\006\233;\301\0060%\247\"m[GcY RkQX;\030\206&F\314\352R\035m.d\304\300o\254\0243c\256m\3478\227\344@\373k\333\314\276\252_Dh\024\271j\253\033mqYz\347\230\035Q\222\332\276\2538\357\377U\206\255!i\373=\346\263Y\222\021\345F\333W!\350k\r\364\347=R\336{e\314\244W\211ds\236a\026\361\337pe\013n5\001\247\207\016yr4u\n\356\177/\262\303M\2572If\205L.\211[vHoU\004\227,\307M\246VK\313\274}\323\3137\311j\311\201d\312T&S&R\347&1\221\367\246K\235d\331\021\222\223dV\313$\031s\331\341&]\344%;\252B\223\230\313d\025\346R'Iv\264L&Y-;"
+	.ascii	"\201\373\361b\311\357\350\215\225$\223n\214&\252#\245\016\\2"
+	.ascii	"e\336\272{\271L\351*-\270\227\212\251\254;\212\3424$\270\030"
+	.ascii	"HgGL\226\240\t\351\212y\223\340\222D\230\367\022AZq\233:@\246"
+	.ascii	"p\227\007\303!sP]&\245{\003\320t/\222/\334\275\027y\357\245Q"
+	.ascii	"R\245\367\302\240\223\334jj\272W\212\247\351R!\241(\335\333e"
+	.ascii	"vi\313$\331\025\323\007\n\023\262\255\353\"E\362\326\255\263"
+	.ascii	"R\242dH%\227\351\336\313`\320\255\345\214/m\371+\013\262/%\363"
+	.ascii	" u$\206\224\024\357\325d\tT\354\362\256R\231\301\273\nT\332P"
+	.ascii	"\274\307\223^\031\f\330\002\365\324\274J\251\fh\230\224\3151"
+	.ascii	"\371\221~\33189\371`\266Mq~\304\340ac\006\317\335i\375`\222\321"
+	.ascii	"\313d\332\201\223\200\234\211\265m\247V\276\227\035\343\366\262"
+	.ascii	"\003\346\275G\275\314!s\357Q\016s\005\314\025X$W@\314\260\320"
+	.ascii	"\277\233\230\032F\031\272\261\266u<']\223\213\254a\364\322\224"
+	.ascii	"\246\227\227\266\357\245\277\223\375\202\3256\300WUF\346\332"
+	.ascii	"2\223?\234\036x\347l%\237\267\013\0162\270\225\001\322v\247["
+	.ascii	"4Ij$\233(qG~m\337H\177#\373\350O\222\006\220\205\344\243\255"
+	.ascii	"M\313x\347\344?\237\367\305Yv-1k\333\201\003t6\027)v\235h\236"
+	.ascii	"L\221\273\321\274I)\021\034\224\300P\202\205\314-\362\366\226"
+	.ascii	"0\361;"
+	.ascii	".#tGm\353\337\253\237\224\025\265\2742\325o\210\016\262#8\320"
+	.ascii	"k\200\212A-\307\374\356D\356\230\274\264\255}g\223\322\322\334"
+	.ascii	"\221\367v%\207\324\266\212ym\252\335\320a\025\025\206njK\006"
+	.ascii	"z\033\030vv\025L\025MSIE\351\313+\0301__4\332V/\277{\026%\223"
+	.ascii	"_\333\332\245\346-\257\214y\322\266\336\325\0328\275[\305;\216"
+	.ascii	"\232\013'nmo\223\204\376\003|\267\263r\371\335\315`@;j\316\315"
+	.ascii	"\325:\017A\252\300\3024m\302\372\342\222hy\255\333[\002\007V"
+	.ascii	"\351\336\234\310\364\231\301\301U\271\263\t\026/\260"
+	.string	"&\0325\244\353\305\036\247U\256\306u\221\362G\246b\2619\202\232\001K\f\3509\340x{\253m]\272\362hj\350\253\2321eJ\255\302:)\222\035\220\274\266\257\247\247\352\366Z\345\246\013J\226Y\333J\345x6\f\217$;\016.\320\257\325\265\332\306b\310#BDT\276$+.-\345\265\215f)\211\217e\333\312\366;,G\216\374\020\361%&a\220\254\250U\265n\273\n\343.-$kH\314^\323\314\352\330\251\334\300\235\341mL\336\206\255'\2501m\353\f\365IE;\223a\203TY\231\016-\373\264\005J\351\267\344\257K*\223\022t\356\2752K3\261F\227l\253\264\301\203\322B\031Wg\274\336\340\264\316\250c<}~\021\304\360J\266\025\2439\322B7\205\r=\177U\325\253.9\270\344eU-#WtT\253/;\257\272U\271\030NJ\347&\315\320\314;\373}\252W\365\301j\f'\305"
+	.string	"$uI\252\222\232V\260\212\244~\3250N\253W\005\362\212\2432\317\303b\325\253\306P{0\034\226\003\276\266\344\350y5\211\322\261U\277\233"
+	.ascii	")Y\002X\ry\367\246Gj\027\247\225\353<\225\253\006\251F\030N*"
+	.ascii	"\27528\240y\321\2221B\202\0217_\262\324M\235F\212\340\234\245"
+	.ascii	";\300\264\255D\244\242\334Z\024\021\302i\035\202\356qA\031\363"
+	.ascii	";\016m=\256\204\240\257\311B_\203\343\007:\227g\343\255\006\372"
+	.ascii	"\032\032\350kb\240uG\305\3424D\3451s\224\336\264}\224qR\323\002"
+	.ascii	"=\2078\353\337\037\2078_s\321\243M\364(\230\253jEFE\357\255Z"
+	.ascii	"\251\311YaB\302C[\004\357\234u\252\332\3502H\322b\220\201\n\205"
+	.ascii	"\036Wdhk+\f\355\006d\253\251F\213\251\323r\242DJ\206?\275\032"
+	.ascii	"mk\024\252\204b\t\261\301\306\f8\246\332\276F\375\235W\241<\360"
+	.ascii	"WFL\333\327\361\207\263>\371\274\322\340\360&%/\254\255\r:\206"
+	.ascii	"\236\273\270\361\336~\2346^]\266\222\024\2313\226\244\312\340"
+	.ascii	"\346\212\036\226R[e\232\224\346\325bH\333\243YhS\205QcT&N\253"
+	.ascii	"S}\361\376\2537\311\305\\\022\2714\267\264\225\254JIr\177[\367"
+	.ascii	"\336zT\235*RU\302A\246w\306\271\344\305\b\233\033Ke\313\r\366"
+	.ascii	"(\025z\264\005z\232=\3644s\350\253\322\317jp<M\305\265\255I>"
+	.ascii	"\257-N?>\030ems\330P\nx\347\334\200wN{\323\276&\323e\376\232"
+	.ascii	"\232(LrTh\350{\fV\334\017>\333\331\3157\337_C\363\245LrR\206"
+	.ascii	"\276\303\264\2302U\242\274h{\232\024}\357}\200KUW\333\326C\225"
+	.ascii	"h\202\204\250\261\023\273\363\321\366\255\367\367\227\006\323"
+	.ascii	"\313\r4\323\224\024^\333\347\361\207\023\207w\316\316\363y{i"
+	.ascii	" ennmoh\230\356\356:\255\256\247\313\223\031\272\324\3255\227"
+	.ascii	"\035h4`<\330\354\354\336\\,__\231\260\266\275\005gF\030\277\254"
+	.ascii	"\306\332\320\027%\303G\231\234\\\323\241Ml@=570\373\\\004\301"
+	.ascii	"\241\024\300\243\021\n\002\360|\005\t\343\212#\220h(\004\026"
+	.ascii	"\217\306!\021\250\206\230\242\207(\034\"\026\217C\342\211\026"
+	.ascii	"\214\300\025X\020E \n\207\302\242\235`\321\250\310\026\021\001"
+	.ascii	"\r\205\305\243\261'\030d4\0044\024\366\024\215F=\020\f\r\031"
+	.ascii	"\r\207\304!M\007\210\305\025G\342\220F\00508d\217A#Q\220\350"
+	.ascii	"<\376\234E\342\005z\200&(\032\035\201A\025:_A\242\307X\f\272"
+	.ascii	" ,\006\005\340\370cd!H$<\242Fb\021HHt\026\207N\034\203\020\370"
+	.ascii	"\n\022\300\2430E\317\220HDD\004\002q\f\252p\024\246\340`\301"
+	.ascii	"\217\261\202\027\212\210'~\204\204*\004p\374\n\022BE=BE@C\243"
+	.ascii	"\007\034\203F\016C\025=c\374\2619"
+	.string	"\376\f\205\212f\206BEu\305Qh\030\034:\217?\036\370\004= 4Z\2431X\f\n\002\322\274PD\004\262\305cQ\375\315\013\305\243Q(\024L\001\304\261\003\343\017\004>%\202D\300\341\017\007?\305\240\321\350\207\0051ENPp($\034\002\322\004\005\215F\026(h\2449\360\b\f:\376\b\025\221\300\021\022\252\370\t\036\201CED\301\025\216Ac0\005\241\"\f\214\036xa\b8\004\022 (X4\022\022\252\030\022O\\\020t\201H\024,\202 \300q\0304\006\213\0240\n)8\301\303qhD<A\024<\032_P\341\307\210\301\013\300b1\004  \n \2161(x\004z\220@\005\n\276\202\004\213b\017\213\342\016\360\b\034\001\250x\006\215\302\033\234!\tF\023\212B\240\016\0136$T\300\204\025N\204\360C\302\b\023@\361s\"\205\037\025L\350\320a\003\022\307\"\260\210\004\020\020E\221\370"
+	.string	"c\013F \212\340\021\030Td\304s a18\f\n\241\357\300\003\r<\370\200\005\315?"
+	.string	"a\003\02068\377\001\b>> x\340\203\336\003\237\032\024\034J\0014\nG(\006] \301\370B\013@\302\2431\202\003\265`\004\242@\001T\364P\004\256"
+	.string	"\262CD\242\b?3G\343O\013F \321Q(\002\013b\n\233\343O\t\016P\343Q\230\302\036\211+\004\005[\030\n\207P\343\2170hH<1$\n\217@\027\204G\240\020$\b\376\004\231\300\202\230\202&\310\204\223E0hh\302\t\026F\300\234\343WHpbQ\260\330s$\022\213=\034\202\206A\032\343O\nC\301\341\020\270\002\b\347\370\363\301q(4\242)\n\036U8\026\201GcMPh\b,\316\004\1778"
+	.string	"\t\205\210'\324\334\307\347\004\005,\240"
+	.string	"\001\024\210\2041\030D$\372\001*\366"
+	.ascii	"\251\350\031\n\201D=@Ec\017\t\236\"r\\\227\243\013\006\221Ns"
+	.ascii	"R\003\353j\210u\212\313q\244\325v\003\254\224y\366\343\312\311"
+	.ascii	"I[\273\325\026\210\rr\273\365\rJ\2544\265[\265JN\345\nr\216\320"
+	.ascii	"\270\274\235<x\330\0375\310{\271P\245\365\270\375a\263l,A\202"
+	.ascii	"g\263\254\217\2330-(nU\316\nV\231\021\254Z\227S\307\324\301\264"
+	.ascii	"\243\202\271\311\213b&\305\320\303\304\235\036\222(8[K\\Q9,\022"
+	.ascii	"\007.\354\217\007\223i\255\300\\\200\324tA\245\352\326\252\261"
+	.ascii	"\226a_\326nl\340\3503\033#e\234\322n\264\226S\230\246\222\215"
+	.ascii	"6t.\206\026^[\033e\243\354\024+\225\310/\bh[\332=\211\370-\f"
+	.ascii	"\267SlJ]\364\342\332\332\032g\033\343$,K[+u6\267\267+\034l4\240"
+	.ascii	"xYi\242\277\205\252r\376\251%/\r&5Vc<\366\354S]byIq\233\321m"
+	.ascii	"\034\376|\350\215\265\265K\273\354\264%\035\031(wx0\230\241G"
+	.ascii	"\272ua\221\254S\215\323\271H\367n\361u\321\004)\231\327egd\315"
+	.ascii	".\335:\335"
+	.string	"\306(a\342l|V\267\205\325\3266\275\372\361"
+	.ascii	"\303$\311T\375\202t9\363kkah`\243\257\212L[\373\342x6T\2404\247"
+	.ascii	"\332\332\344\361n\316\224`QY\245\327&\030\233\222\\[\333\202"
+	.ascii	"c\210\001\027g\223\274dA\365X\202\336\006l\357\225o\317\"k\203"
+	.ascii	"p\250\222\2718\b\323\224B\b\321\214\310H\232$\215\001R\n\020"
+	.ascii	"\204Bi$G\352\035\022`\005=\r2\246\220\314\310\210H\222\244P\031"
+	.ascii	"\306\334\2351\333\346\210\317[\377\236\310}1\016\310GZ\373}\301"
+	.ascii	"V?\334<:\213\311\204\250H\217eQ\217]\277\330(\021\210\374uks"
+	.ascii	"\362\373\210\225R\345\037,\236A\317\026xLx\274\350a\32182\204"
+	.ascii	"\247V\334\206(\004\224\273&\253\210\346*z\300\277\005\260\230"
+	.ascii	"+\023\267\004\n3S@\251\bU\265v\323\237\223\375\022\177\367RS"
+	.ascii	"\235\275\300\265\255s\024\265\277\r\332%\b\307=G\302cX\304^\214"
+	.ascii	"S\377;o\263\334qa\214b\274\003\0317\2746\nY`\270\022R\257\204"
+	.ascii	"Z6\265x\370 \224p\360\334\b\333\f\366\2722\273\316T\361\327\035"
+	.ascii	"\213dI\340@#\013\020#\217g\365\343\315p\251\331\373\004\345\016"
+	.ascii	"#\275\230\204\231p\220j\214\r\201?[\200\f\332\207\302)@\b\250"
+	.ascii	"\035\320\247Nx,\364\263\035a\264\302M\302\244\2579\001yTv\370"
+	.ascii	"\375\216\245I\177\272?5\246\252\336\344%\rGGM\203\342\234~Sz"
+	.string	"\302\211r\354#$\235\200\261k\3002\247,\223(&D\302\301fm\305\325\017h^\206\236\245 \032xE\337\317\0051|A\230\\\315\311x~\f\320\315|_\006\262\364&\331\276Kz\372\302\310\034i\b^)\350Q\037\222\032\354\254\r\004\377)\312\377OR \003y\335\361@\360u\300\261\272Y\316\242\n\315W\262\317\354\267\016y\321\266y1C\235Qdc\301\353jU\313\255\334\345\321iS\306\377\357$\2705\361\201\373\252\335\260\246\313t[\nd?B0\007\340*Y@\367\316c\356}(\322b)\315\025\356\034\206\320\023\377\rW\345&\266\374\315\177\016\213x\363*\020\261\253&\031=\204\322,>\301:l\244sC\341\331\317\272w\205\305\342\271\224\2077\247\217\035XRxu\377\223\367C\264i\261\247\275A\345\276\0026s\305\220m\211Mh\372\356\2503.\223R\365\310\005\023\030\001\032\277\253\340\251e"
+	.string	"\244A\227\244\027\347\t\220\026)U\306\232`\336}\f\262PZ}&\r\301?>\207h\017\031 dF\252\342\336h\222mNB"
+	.string	"\266\323\b\212s\321@PR\225\022\216{\331\236\036^L\206\336!\025\020d\372&\313\204\ti;\3521\207\343\265\327\234\024\005\267\037~\260\031\210\367\243\254\220\034^X\256s\257?\267\"\023\302\343p+<\037R\254\353|oM\200u9\022\037\346\233\302\307\001\365{\246\"\357\025\357#R\310'\020\263\341{\351^`1\200\te(\266^\302\300\221\241\005\210;\004\246\266@\260\362w\211}\250\373\\\352\355\225\211\342\210\357Axf?p\264P>>\016\345"
+	.string	"`\177,\021J\266G\007\373\372\320\332s\001\fV\026\344;\177+\323\br\333}\372\b\016l\323\315q\203\322\016\231\355\343\340\270\201(\312\220\276\367\233\365\236mM\302y\3116\230\3616$T\027\245\364\021J4!7\232<.\320e\241@\373\336\033\262\263N\377\037\343\270\007?\367\265\2714\270\001R@\177\216\203"
+	.string	"\232#\272[\355\031C\203`\370:\r\206\302g\007\3252e\244\317<.\351N\352NAa*\273\3340\030\353\205\016\177\201\305\004F\326W\2453\234%\330\201\200\032\002v\023\036~\332\003Hj\214\312\013N%\273\251\213({<\255a\017\371\235O\354h\034\005\f3\304`\177\035d\252\311\253\247\240^\244\217\336l\210F\347\022:\370\275\262\316\277c\362\215\352\207\214\346o\333\211\026\327\031\022\027\\\352O\334\nN*x\2406\021-\025h&\024\202\313k\006\347\330;\222\253H2R\007U<\360\327\206\2328\t-;T(\316\t\247\344\205*\224e\374d\347\005\f\253\310\306m!\2356\244\353\313P\360\240 f\370\"\325\350\370\326\330N&J"
+	.string	"\314\227\300m\265\t\t\242\320->\t)"
+	.string	"t]\004\223\024\367\377\232&\325LA)\2361QZ\260~'.V\353\223N\242R+\215\3332\324<6\212\374B\002\023\245\203+\037m\221\353\371D\006fp\371\234\230\372\352\371\025\034\201\005ai\252\022\323\366\370\231vkAj\\\233[\315\027\321\323\374#\274\315;\025_\2321\3003\341\335\225\\\223\007\256\251\021\2304\370:\205c\310\370\375B\234\341\2068`\360\2153\224\245do\276t\260\016\022\376\003IZ\262\227\342\204\017\351\025\002O[\212_\371fn\027>d\226\223\351\361a\002\3674\024\310$\252\340:\277\364m"
+	.string	"\253\013\316ux\216r\311\232\311\255\244`\212\017\241\0372\026\354\\\226\214gC\033\377j\030\333wr\bm\003s\373\2449N\\\321\336+\003\224d\035\006\274\334\225\346\003R\254 \"\032\360\374\251T\227\233\340\265Lf\254 r\311\222  \216\004\374\0222\332\275?p\312\002`\217\307\200!=\205\231PF\376\007v\211\004/\025\2753\204\275\200\f0<\244H\024\254\204+\234a$\300\310\246\"\344`\f\214C\265(\227\013\301\026\207\004\217\223\306\207\023\004j\346\017\327W\331XR\316\327\221l\372\005V#\007t\225\023\002\253\034:\232)2j`\303h\321m\313gT.\202\003\\\222b\275C\327u\320J\001\377\270Q"
+	.ascii	"\242\017\316\320x\027\2509/\322\005\300\233\203P\017\356\267"
+	.ascii	"\203@T\345\270T\030\341\313\251;\325\311\274\007#\335IZ\316\235"
+	.ascii	"`\221\256\367\277\355\016(\366h\267\334\251U\b;\206i\373\266"
+	.ascii	"\232}\026\276DoOx\363\274\252\375\336\366 \363\332\366M\341;"
+	.ascii	"j\\2^\021\303W\377r\3413-\375f\370 \354\371\317\262w\2078\017"
+	.ascii	"\2105(\371\350\273\312\2632\345\f\200\207\346\227\277\270^\342"
+	.ascii	"\311\345\311j\364W{\277@\375\260\305z\020O\264.\223\310E\360"
+	.ascii	"atU\304|\321\017\330\246\243\277\324\215\031\036\254\363\304"
+	.ascii	"}\204\201\307<^\212\366\303\001\212\265\364\005\353/\275\r\344"
+	.ascii	"\365\201\314Ir\265w\036\226z\360`_P7o\234\031\316\037\031jP\335"
+	.ascii	"\346\323\271\033\373\203\242O\364\343\352t\245\266\345\345J\323"
+	.ascii	"1\350\317\334q\355\036\310\313\310<\316\224\360b\366\220\353"
+	.ascii	"T\367\351\327\031\300v\024\332&\221wH{\343\344B\273h\361\363"
+	.ascii	"O\263`\373\370\217\017\bf\004\366\273-\257\361\303\334\314\367"
+	.ascii	"\037\376\217\006_\270-\2535so\266\270\336q\3469p\327\374\t\200"
+	.ascii	"\373\351t\326\036#\037\020_\335\327\325\307%\277\364\204}\220"
+	.ascii	"\374}\376g\233\255\345.\254\227\365Y~a\334e=<\3468n.8dv\373V"
+	.ascii	"x,l'vx\321\006Z,\377a\007\317x>\341\206\013\313\334\n"
+	.text
+	.section	.gnu.lto_.symtab.c4561ab510f63618,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"pgResetTemplate_modeActivationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"modeActivationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"modeActivationConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"pinioBoxTaskControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c4561ab510f63618,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,546 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 \224U\003"
+	.string	"D\005\210"
+	.string	"\n"
+	.string	"\330\331\340\372\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\272\264\263\242\004\002\002\001\002\001\004\316\305\253\235\003"
+	.string	"\005\200\202\255\250\b\006\262\374\202\245\005"
+	.string	"\007\362\354\276\360\017\006\002\b\240\342\234\212\n\n\013\213\313\376\325\006\030\002\003\002\004\004\004\002"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	"z\b\222#"
+	.ascii	"\364\255\330@T\372\224f\022D\b\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 6m\001"
+	.string	"\004\002*"
+	.string	"\006"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006\007\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?C@\211\265\013z\003X"
+	.text
+	.section	.gnu.lto_.inline.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"m\004"
+	.string	"r\305\024\"\220)\351;`\325\375\376\334{\365\033\365\307\020t\373L\324H\273\273\323\351ybo\r\222\315\t\221;\005\317\332\016\255\"@,\036\221\300\352\005\215\315)\374a \003\376\240\2115\321\200(\322\375cN\365\277w\365\327\311\314\304\376\021*\2318(\352\361\003\004\027"
+	.string	"ac"
+	.string	"\200L\323\301z\346\200\036\003\2670\004\034\200\002O\324\005^\254X\006dEEkz-\nM\252\302"
+	.string	"\340\332\312.\260|i"
+	.ascii	"\026\247,\237E\264\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 je\002"
+	.string	"R\204\r\026\260%\351\254\210%g\315aG\270j\3010\314\232c\265\231lR\246\377\013\377 \307\220cv\200\bX\241\255\0207\301\326\203A\277\323\370ku\255\335\025DN\017\001\007"
+	.ascii	"S\020`T\f\264\272\321\263e\224\265`5\030\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\007\230\004\013"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 \227\225\002"
+	.string	"\004\003\213"
+	.string	"\006"
+	.string	"\001\002\t\001"
+	.string	""
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\007\001\002\n\001"
+	.string	""
+	.string	"\002\002\013"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	"\013\002\f\001"
+	.string	"\002\002\f"
+	.string	""
+	.string	"\r"
+	.string	"5\013\210:\006\r\005\370\211\304\253\213kV\332\305\250\031\214\245f\260\360\331\255\0010\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.825f992e3ca46361,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsInit.22.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 \312\225\005"
+	.string	"\362I&1pi\323\030H\013\263p\007\340\025F\020,\036#\230\3663!\201E\2100\346\303Dd\035\343\306\272\377\377\326\227h\305\274\331\215\277i\373\326\254\3342\005O\221uI\227\025'K\314\\$L\234*+F\320\224\246R\305\213\242\252\370x\233\3329\016\237\200j+|\200"
+	.string	"\230\333\220\206O\323\354\275\f\352\301\347b\265{}<@\020\273\005\025\024\3739\f\t\177>c/\021\031pD\020,L\354nT\204\304\022bg*dc\343\262\204\f\312\356\0167\316 \327\374%\377\344\337\004\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_writeStats.23.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\225\n"
+	.string	"f\024J? m\225\016\320\272\005"
+	.string	"-fa\003\224.\320\264\236\300"
+	.string	"\321\017HU\302\226E\242E^\276\277\241q\304"
+	.string	"\365\257\022\200\035  \300\314\004\200$\307\3557\223C\303\255\037cW\344o\262\245L)8"
+	.string	"7"
+	.string	"6"
+	.string	"\n*T\"\r\252\335\305\024\302\265CM\315?\352\024\033\3479\274\032\\a\207\327\201\204\005\027\202\223\321\204\355\250\347\002\016\224\t\371\330]\347\3061\270\255\333\006`\233\303\276$\316t\374\351\317L\037\242#\321\206\f\016\273\243\357\304\202\260<P\210\330~\332\267p\223\366S\202_\354\226>\244v;\017o\\\267\334}\022o]\227\304[\326\354\021\032\001jJ\214z\324\257\020\031D\204r\345\237\022\257Q\235\"\022\350\027\216\341\200/\301\b:\371\355\226\337\211\267\256i\302s`\"}\362\263;O\352\003\373\372}\337g-9\031\001\230\f\372R\3118\026N\206]2\030\201"
+	.string	"\226\001\330e\223a\025\fk\n`6\030G\243\331`\221n\017WK\206\025\274\022\336GApw\027^i\033\310\362\233U=\217\260\362R\001\017"
+	.ascii	"3\2413h\214\254\202\203+\200j\037\244\260\210\013\300\204\253"
+	.ascii	"Q\341\031L\271\004\333\254\246\214;\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_writeStatsEntry.24.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 c\375\002"
+	.string	"D\0053"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}(\212\001\202\200\200\374\342\303\315Q{y"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\003"
+	.ascii	" D\312E\003(\002"
+	.text
+	.section	.gnu.lto_statsOnArm.25.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\315\007"
+	.string	"\"\01635Po\322\001 \2173l\024\022\002\016\307t\004\376H*\223\310)\264\335\367\3024K\004\275o\004b\326\030]\323nf\210gV\367J/\005\3456\321z7)S\n\2466\326\305\271\254G%<\205\016\347\363\250\312z\033\001\303\005\204\352]\020VO\243\355\225t\200\262\205T\344\324\020O\007>\232|\217\177x>\020\252\0331\321\230\270\372\034\357`\3601l\201\234\017\302\334e)\232By\362%\355\006\207|\274\006<\224l\"\315l-K\255\260\177Y%\331O\347\323\317`NR\006Dv#N-\2739\222\f\333\327\030\263W\256]\354A( J,\273\373\324\342\330\023\363\277q\2008\312\236\031\203\335u\306\221\304\255\267M`\273\300\266J\021"
+	.ascii	"3\001/~\306\316\334\331i\030\030\376\252GQ[\300B\340\354\250"
+	.ascii	"\205\211ZU\236\353\271\220#\f\366_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_statsOnDisarm.26.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`\241\003\265\030"
+	.string	"\306m\237H\300VQ:4\346 \035r\347=SG\200.\002\263f\252T\220\032\024\026\\\b\210\243w"
+	.string	"\020>\023\230f\033\347\273O\246 \366\377\237\026\216\345\001\006\323\266\222\331?\356\304\307-\376\026\323[\300\241\327%\177o\"eJ\001\210"
+	.string	"z"
+	.string	"\220"
+	.ascii	"Us\372\030\204\217\005\036\223\217\340a\362\361\357\331\345\005"
+	.ascii	"\rnW*\021\316$V\220\234\216\2529'\202G\347\204\217\276\331Y\356"
+	.ascii	"C\232\377\341(\002b5\347\224-\215\337\316\222\021\\\275\371\357"
+	.ascii	"\275\245\333\t\235\025\272\270\004\017T\035\371\362"
+	.string	"\332\025\2011\0259to\"\322\330\342\340kg\002,0\347t\355\206t\301\034\036b\226\274\351\232bW\004\3428\231\260\361\336\365\304.\247\312\2020\347\264\352v,\356\360\266\247m\007\366F\0056\355N>\t\246\346\034r\340\3778\220\021\376\215G\377\220\320\353\036}\022\362\021\266\003P(\031\365\226pze\373r\272G\366\301\2713\3543\335\261+\3350P}\263j\233U\277V]\263j\232U\273V=\263\352\326\252\303U\263V-W\035W\275\253\326U_\300\203i\245\005\007\314\234*\256\306L\251\210D\307\231~\245\253}\373K~\323}\334w;\223-\024Z\021\n\371\361\b\207\362df\017\345d\251\265N\232\3046\334\326J/\034\276\304\026>\205{\250\027K\233\304f`\n\311u[~\233\224\313ZI\206\310\310\035^\304\026\3169\211\310m\355\242\2041\025\257\005\022\030\333\270\265_\224!\025c\330\306\315"
+	.string	"\203IQ\031\326\324w\344nl\365\211\250GN\257\254\373\335=QR\356B>d\307\277a\236\331L>\352\346\324\340\321\250\335\003b\337\364\307p\342\"\225[\241+I\262ad\367\310%$l\003\240\230\362\213\032R1\016:@\036VgF\353\261\340aF\253E\b\321C\2531\217\202\037\240\035\240\037\031\317\007Y\210\236\035\232\214\247\366#S"
+	.string	"\300>\"f5\031\220\217OM\346\362\341\016\316\235!a\207\024ns,\034\265'P\320\353\374\336!\344V\310N:\252\030\362A\362fk?\252+\361f\t\244@2\352\361pz\025\367\350A\322\267\362\251\240\n::\362\221%#\312\252\213\315V\241\362\332\231\265\241r\233\254\331\327\016\300B\263\256\255\221r\201f[<\034\324\243l\0304h\220\217\256\375S\r\036nCE\250a0\306\220r\0022\031\2123\205\205\352\240\002\0219\263\r\021\2009\203Hj\251\355\323\204^\007\227\300Zl\t\236\316\207\315\222\017WN\027s\244\020\316B)`\b8\007\362\200t&\352\313u\245\301\032O\300&\234z\3566R\f~\\\302zK\274CC\030J\341\030\324\255\313\323\210\311\330\\\341\227\034\306LV\275\374\223&+\213"
+	.ascii	"\232\007O\013kQF\353\326\021Fu>P6Q\266\315\0020\025\303\336\372"
+	.ascii	"\274%\203\244\341R\372\273\233p+\266h\006\003M\025"
+	.text
+	.section	.gnu.lto_writeStats.part.0.36.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\335\f"
+	.string	"\346\027VB q\223\016\034\343\206\214\022"
+	.string	"0\240x\342\310<_\203H"
+	.string	"\323\001\230\310$\300\220#\006\241\225\273[\353\035!\340\233\361!\324\323DI\250"
+	.string	"0P@\b\f\024b\0214\274\037\324\0312b\367\336R\246\024D"
+	.string	"?"
+	.string	"D"
+	.string	"+\0070"
+	.ascii	"@eh\201\332]\353PE\334s\370"
+	.string	"4\243\307\277\351\030m\373\034vl\035\376R\333N\256\217A'\003Gf\023=\217\021\t\355\246\347\206-\224I\340\361\362`w]y\270/\267\r\301\366\002\373#\001O\271}\024\035\337\344\214\355\247t\316\231 P\r\013\n\321\340\320\231\366S\\\205\347\234\311\007\354\222h\250\354r\016\016\255\240:4w\217xX\275@<\314\034\376\204\355\216\275r\016e9\330c\007\026\221\020ON\"\375\030\22366\222\327L\222:\035\245\245SQ-\331.\211\327l\205\rQ\2668\246Mr!\257]/1N,]H?\251%k\374[%\331\232~\225`$\340\303\356(\225cA\300\031%\002!\023@6\317\327\307\206\243\341l\254+\304\252 \242\241`]\331\306\3720`\314\002Hfq0,\263\362o\225\344g\242c\351@\032\202Zbq\377\305a\224\370#\254\271\240\177\305CX\303\005\352\006(S/@\276G\210\016\032"
+	.ascii	"w\013\262\2671\372\020\370T\032\322\b\205\215P\315@\302\252C"
+	.ascii	"hZ6u\274l\b\016\020\005\303\\\341\224\232\300uQ\301\365\367\264"
+	.ascii	"RT\273:Wq.0N\\\314;-M\323\024\272\327\2261"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.39.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`\343\001\005\020"
+	.string	"\306\033eH\360\260(\035x^\224\\\360\303\"\331a\254l\206^\325\205\256\222E\r;\256\\`v\026vV0bq2\335\020hg\037\317\032\0322j\350\227\002\027\t\270\tq>\242\314\255(\214\360+\366y\322\361\214\f\262\311\336)\005J"
+	.string	"M"
+	.string	"V"
+	.string	"%\334\235Z\004$\276\246\205\333\017\0341\025M\317\356\202\234\032\001w\372\021\266\303\321\242]\343\265\265\177y\210"
+	.ascii	"\233\355\256w:9\\\374\224\232\350\277\276c\305J}\002`U\270\024"
+	.ascii	"p\215cdw\315Y\270\351m\203l3\260\245\203\027T\256\343\311b\306"
+	.ascii	"lw;?v\033?\007'<l\305\237\227\272\254\361.\037\307\335\3537\342"
+	.ascii	"a+\\j\344N\274D\364\354\326\004\334\351\347\004\266S\355\003"
+	.ascii	"\266S\263\334\306\037\255\335\3554\337\025\372\325\235-\002\n"
+	.ascii	"_\323"
+	.string	"\342O\252n\314\370\333W\222_\3719\377\204X\006\036\230\231\222s\306S\273\266s\203=\017\310\002h\330\215\271aceh\013\232\273\376\330]\230XlRp#\307\025\241\301\021\225\004\030\r\005\006\032$f\373RA\234\342*T\f\032\250-\n\246\0202vf\273\325;u\3456\373\262\357\004\206p\222B\2022\231$\242o\324\300D\364\235\026\240\214>\017\207B@T\t\n\364B\017<\224Q\311\347\205N\240\027R\300\245\024\321\311C\225J'O\276\236\213\201\340q\231\2529gl{\310\017\0232\367\213\355:\227\221\270]\027\030\217q\342w8\365\210$\277:\365I\0010 \220\002!4sd\230X1\230k\231Gl\022 \277p\210J\343\230\270Q\n \3622\302\037\243\377b\024\244\354\242\203\200\246ET\323\311\226=k\357bx\261\275C\360\023\212\033\235\273W\007XszA\365\272\210\342i\021\374\260\216"
+	.string	"\212p\301 \333\341M&\024\b\0238\206\036\240\235\262\320"
+	.ascii	"@{!9\375\351\327\3661"
+	.text
+	.section	.gnu.lto_.symbol_nodes.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\r\007"
+	.string	"\242\212'.pI\324\001\346\376\257\n\363_\267?O\021\200\375\257\032\376\366\255\371\377\261\376\377\377\337\247\017\204\376\311\326\214l\315\310\226&C~\023)e\ng\022\362\017\006\021\b\311\262\216L\b\206\205\b\264@\312\243p\222Mx\335\306\327\301|\263\313T\230\220\2104_\216\031\033g\032\013d\274\300\230\313\356\376\027\361\342-\255\201\2121\245\2447\005<)z\021_\332\017\210)}\201b=L\240\216\366\376+txl\21416\\\351\376\33153\275\377\214\206\260k\370\371\207\034d\322\335\r\300\r\375\237\220\032"
+	.string	"\200\340\026\202q\022}3\210!\315\203\313\240@="
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\200\300~i\314\b\206\313\267\224\325\250\372yf\206\211a\370"
+	.ascii	"x\030;\224\024X\300F\235\206`\024\241\310R\f\205y\025\024"
+	.text
+	.section	.gnu.lto_.refs.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\262\205\016\023\200'\35230\003\323\213\302\020\372'F\362N\322vJ\001JX\007\257`\033@\n8ZL\211\355\246i{\246\304\3503M\202v\034-\3630\252\312^\212\354\303\332\362\256\026\002"
+	.text
+	.section	.gnu.lto_.decls.825f992e3ca46361,"e",@progbits
+	.string	"(\265/\375`%\0215T"
+	.ascii	"\232\213\f\037U@N\302J\007\273\320\312\354\314\320k\371\301\343"
+	.ascii	"t\265sW\235m\376\227\205\371\213\035}\316\216\352}\031\251i'"
+	.ascii	"}\201\251\361\377Ka\177\226:\001\231"
+	.string	"\360\343\366\214\201z\f\3541T\320\030W3\245\2774XfLc\207,\354\007\212\206(\275\036\024e\321\b\3322\005\216\001\337\001\346\001g\036\370\312\325\266;\254\273\317[Tx,\247\246\333\331\205\325\335\236s\370\205\316e\274\003\217\231p\241\333\371C\347)\004\016\263\265\356\026\bh\007\0044\324:\261\330\250\334\354\223\333\341\236\3349\271\236]\357[Y\214\253\260\364\207u8\343\3009\274\006\3316\264\273\325\251A\033\343#z\325\223\260\236\177r:\374\223\373\2145\005\373\344T\356\311\361\027GY\272c0\\\361\331:|v\324Au\325O\260\236\247\274\204\263a\034\305\272B\277\361.\367u\375\224}\240;.mfY\274~p\214@;j=O\350\2640<\001\271P~v\302[\334\205K:5;\332\335\362\220pb\245*zU\356\272\374\204\333s\027s\275\005\214\353\220\275\325\335r\227\332md> \207\371"
+	.ascii	"\032\262+\243WN\375]\337\262On\345\036\0068\370y\003\316\200"
+	.ascii	"e\344\374\027\201\004$P\201\"\202\235\377\326\360`\371\177\345"
+	.ascii	"\277\017\f\001\021\330K\374\367\200\007\206~\026r\340\377\002"
+	.ascii	"\327\375w\305\3771\377\303\374\027\363_\355\277\231\030\034\346"
+	.ascii	"g\034\303\370\371\346\305\177\023\257\371/\315\317:.\256\376"
+	.ascii	"w\201\237[\374\314\373\271\201\237\025\370Y\305\317)~>\361\363"
+	.ascii	"\316\317%~&\340\347\001~\366\371\271\347g\236\237u?\337\237s"
+	.ascii	"?\253\377\317\374?\342\277\016\377\237\3747\342\377\332\1772"
+	.ascii	"\377\247\377\315\376{\375\177\376\207\362\277\375\217\342\177"
+	.ascii	"\331\377\365\355\355\355\355\277\f\3748\026\277\256I\313\023"
+	.ascii	"\222mS\231l\233\305\235F6\213\335\355r'\0315\0269\tu.\223\320"
+	.ascii	"\346\222\247\221]l\250q\206\025\331\\&}h.w\222P\3432\211t.y\216"
+	.ascii	"4\255\214\300\301f4c(Id\353x\2422*w\246\311\266\331[\2729\332"
+	.ascii	"\324J\025\335TM\345\026\243\024\213\035\247:\216a\306&\001O\307"
+	.ascii	"\252f#\247I%\315n%G\244~zQl\247M\204\247E T\355\324\324]@\267"
+	.ascii	"\335O\335E\356iw\027\273\233\204\222\252\355\216a'\211\365\364"
+	.ascii	"\324\315\334=5U\261JS\367\215\246\211-\223\320\252\246P\025)"
+	.ascii	"P\254n\241-2Voq*Wh\021J;u7\217Y\261\226Qb\256zf\2273\265E\232"
+	.ascii	"%\313\021FA\276v c[\273M\230\220)\231\2138K\271\b^\313\240\355"
+	.ascii	"\242M\325TT\333Z+\231+h\202\baN]\325\314N\347\352\314)\344\252"
+	.ascii	"\277F\326\337\037e\324j\236\3170\035\266\324\370\214\273r\212"
+	.ascii	"m\357h\361\004\212\271\266\245\306Cl1\017@0\232\211c2\0036.5"
+	.ascii	"\027\277\220\032oa/<e\266\r5\202\023(&\031\026\303c8\fKY\215"
+	.ascii	"\2038\177a0\337\265\335\310\356\006\002\002\002\332\341X9\023"
+	.ascii	"\003\304F\275)\270\307K\227\0340/\\\r\271*s\3410hd9\314\020\301"
+	.ascii	"RN\373\027]\233\260!\223uD\354\252/\303h(Dyi\277\254g-\353\317"
+	.ascii	"hB\360\031\232\030\224\253JY\b\016\342m\357n\2160\024]\250\262"
+	.ascii	"\236\303\326\263\024\236^\251\034YPW=7\341\037\256>\23388#\f"
+	.ascii	"fT\262\224\251D\334\242\214\271\352]\220\361\030O\243\026lq\251"
+	.ascii	"Ei\001\203\313X\n\207\361\224\031\201VT\255\273}\340\036\030"
+	.ascii	"\013\233\261\224\313\330J\327\206\353\004\204\231\323\361*\271"
+	.ascii	"\312)SC\252\256\212\004\311\315\312Mi0Y\326T\032\330\270\322"
+	.ascii	"\262\332\214\230j\236Q;r\344*\217C\366\017)\226\316\223\307\227"
+	.ascii	"\226\226!C\356\025?\r\b\203b\"P\006-S\303\357\025N\016ZcoW\275"
+	.ascii	"D\256\325\312B\333\rbV\267H\216\332\223\261\311\214\323\033\025"
+	.ascii	"\034'SyTqbF\006\004\310\025\362@sa\323\2721\214\311R\344\006"
+	.ascii	"\371\025\342\326\024\006L\013\2134+#K\234\316\253\334!\321\355"
+	.ascii	"\220\\\342\243\310ze\220\3416\003H\242L\333\372\331\031\321\252"
+	.ascii	"\241\311]5H\222T9]\3654\355\343,\275>\330M}vT\t`9^X\353f\256"
+	.ascii	"X\271\270Z\250\342\245G\017\036S[\025X\242\332\264\314\246\246"
+	.ascii	"xL}\366R\204&\032\226\026\r\222n\352\222%%\275R\334\246\266\275"
+	.ascii	"\f\341\212J\303\312\203\307Ur7\0202\344\276\274X\225Q\255QQW"
+	.ascii	"\271\266\001\\\242\332\264t<\274\3104\201\322q\227:\256r\307"
+	.ascii	"w\\\345Z\354f\257\253\325\312\2203=\256\372\253T\221\353q`\326"
+	.ascii	"\377&\223\327\211\237\275\343\203\350\217'k\335WV\350\024\261"
+	.ascii	"\304\207\325U\257\013\027\007KO\334\0348nM\334\216\370Z\317'"
+	.ascii	"r\374\306'r\3079"
+	.string	"Yo\223\3646q\027\267\275c\250\254]q\234\221\265x\217\305\213\314us\333\334\241l\246\362\347\177\031\226^\344i\316\224\030\221\276\335\3765\376\0329\215[\331\315l\\\2275&\363'\367&M\332p\325\343\252\326\343\226\353\357\237k\243\262\273\241h\332V\036ug\032\346\237\037\207q\254\242q/\246\335J\232d\326$T\214=n\212\276Vw\221\247\333V&\241\316b2\312\331\222\247\355\031\006h(\220N\266\316\245\332\354\333ms#\235\001\277$\023|,\023\r\036q\370C\00184* \367K2\301'\234\221cdD\301\315\221\202xJ\300\001r4<\b\341\203\0313nx%n\260C\240\005@\234\340\217%\336\250\001@\260\250G\\:\342)\001\003\b\312\020j LA)\351\202_\221\320W\343\003\f|\210\300\244$`\260\027\034\372l\202C\n\204\036\330\260@\241\00658\301\241\217\b\264@\350A"
+	.ascii	"G\n*\352\t\231\206(\330\336\020\t\342\221/\351\202#!08\364\335"
+	.ascii	"\030\375\206@\246\023~!\374P\360\021u6,\202\330\241o)\210\347"
+	.ascii	"E\300\341O\370;Z\377\"F\0031\206T \361!\"\026D,r\037\"\022\022"
+	.ascii	"\"\212!\264>\206\020\216e{D\032\353\331\032?\0268LA\347HA\274"
+	.ascii	"\"\033\004\024\t\231.\320\255I@V(\202\321\357\206/\351g\244#"
+	.ascii	"\366n\fY\341\f\244\"\326\267D\004\032\351\260*\374\204\352\217"
+	.ascii	"\t\004!\220\346\327\373\031)\321\030\376\226~?\023tG:Z\022\340"
+	.ascii	"JK\277!\217UR\032\362n\210\275#\240\r\241\222\f\034\"\213t\004"
+	.ascii	"L\262\321\323\302\005+\0042\255\301\036K\004\032\365\222|\254"
+	.ascii	"\022\333\003\200\355\r\261B`\356BB2R\210\320\001\006kQ\020\257"
+	.ascii	"\310\006O\b\364\005yEC\"/\310\207\330\373\005\201l\317\350\027"
+	.ascii	"\034\372zB`\260Gd},Q\200$%\245\nz4aW\323.`Q`R\"4$\001s\3253m"
+	.ascii	"\230\316m\272\004\307U\243D\271\321\232\235>\016\221C,\372U\244"
+	.ascii	"\005\036?\276\244\254Y\255\021l\207s\2225\332\217\265\253\353"
+	.ascii	"z\325\220\270\302|\341\307\353>o\254\246H\225=\241\364\200\305"
+	.ascii	"\226\344L[C\212\210\333m\331\312\004bR9\250'Bl\2440\341\022\345"
+	.ascii	"\272\315\n\3048\005\271j\253\036{\210\242r\302nDOe\276\334\300"
+	.ascii	"c\353\224/\323\034M\332pG\264\260\025\265\262peTl`\302\204\323"
+	.ascii	"\324%D\214C\226 "
+	.ascii	"\003\201h\250\201,\247\230SFdDDD\222$I\007A\005\204 ')\255\007"
+	.ascii	"\0210\251\263h\212$I!\313\030\264v\240j\200\tZ\340\330\247\202"
+	.ascii	"$\251\317/U\241G\311\312<\002`Q!\006>Wn\315Kv\021\037\rI\244"
+	.ascii	"\313\315\312\031Bh\rOE\320\241\273\034\206z\300##e\022\202\332"
+	.ascii	"\312\354\260\326\224\236(\0072\225\200\274\355(\263Dk!E\032\375"
+	.ascii	"\243~`\034)\005\217\242\345\317.\0259\2313\004\374\301G\303\253"
+	.ascii	"\277\036\224\354bV\t\374\271\277\215DD\245\r\264\330f\273\374"
+	.ascii	"gQ@IF*\270\352\326\231\204\305\203\304\212\203\373\025\017\343"
+	.ascii	"\320\005$\260\234@\303\211JQ\\\345\002}\301\332\020\263\331\277"
+	.ascii	"8\367\247\370\031\262\213\306\230\223\340\201`\033\300;\221\251"
+	.ascii	"p!\020\321\207\352!\004\201\355'\253\275K\bn`\260\217\375y\037"
+	.ascii	"8\266\275{?]\0169N\226\312\f\022\254\264\017\274\254\321\371"
+	.ascii	"r\f\264\374N\234T\373\273\307.\310{\2604\177\237\017f\232.A\005"
+	.ascii	"`\"\260\326ob!\202\233\256>=k\211\202\312}\216\3653\242x\216"
+	.ascii	"S\2050\303\003&\225,R~:+\215L\256\242v\233\301*\231g\020\253"
+	.ascii	"\232\322\363\232\240\212Q\005\020\213\255\304GJ\260\205\263+"
+	.ascii	"\351\300\023;\032\212g\350\356\351\355}N\217\310n}\337}\260\342"
+	.ascii	"\364CH$b)\332L?\316\033\254\031\007A\250\256\213w\024\027\302"
+	.ascii	"\313f\3447\311\007B,\\J\344\343<\374+s\214XU\211<{\022\245\021"
+	.ascii	"tU\255y\236\005\207\001\3773I&\342\203\370X\212\222\3657_\362"
+	.ascii	"\277d\361\004pR\\\t\336\343\020%@*\t.\265\312H\303\272CiV3q\206"
+	.ascii	"M\321\032\256B\364\245\227\214\312\361\2021m\001\356\261r\335"
+	.ascii	"y\244\0031\023a\245a\362\342\334\313\177\340-\242\005\\\235\226"
+	.ascii	"\306\362%\331~Kx\n\224d\360\004`t\004\fU\t`s5w\226?'\004d(\273"
+	.ascii	"\346\bq\267\352\375\027\277\361\302x\360Ro7?\"\361M\371I\311"
+	.ascii	"\315.\342M\273W\255\321\206\353\264\371l\227\002&%\263]\370\276"
+	.ascii	"\3555\002R\303\214\350\033\257\347\267(&&\007au/\373+\257\300"
+	.ascii	"~\221\027%\020\032\350\027\264\0361\224\276\037\236\317\375\031"
+	.ascii	"\333\320\360c\333\260\376\255\376\325}\355\374\342\037\353\363"
+	.ascii	"N\007S\2123\347\333\362.\001F\017|\246J\016+c^pF\372\226j\253"
+	.ascii	"l\243\373Y\354\316\fi\017uO\305\226rw\315\243\306Y\376O\333B"
+	.ascii	"\307\270\222\333\370:'e\274\274\017m\337\225E\275\306\245\266"
+	.ascii	"\241y~BW\001"
+	.text
+	.section	.gnu.lto_.symtab.825f992e3ca46361,"e",@progbits
+	.string	"writeStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"writeStatsEntry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.825f992e3ca46361,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1896 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\335\006"
+	.string	"\204\013\024\001"
+	.string	"\025"
+	.string	"\354\301\314\336\005"
+	.string	"\001\314\345\244\232\005"
+	.string	"\002\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\004\312\242\233\223\017 \002\001\002\002\003"
+	.string	"\002"
+	.string	"\004\002\005\002\002\003\005\352\263\360\321\b\006\240\342\234\212\n\t\276\376\210\236\003"
+	.string	"\013\275\236\357\212\016"
+	.string	"\f\313\233\235\316\016\002\002\006\002\006\016\231\227\246\361\004"
+	.string	"\017\210\331\325\364\005"
+	.string	"\020\021\213\313\376\226\r"
+	.string	"\022\303\367\201\301\r\002\026\305\352\265q\027\342\201\222\246\004\002\030\346\300\255\206\004"
+	.string	"\031\032\307\214\205\217\016\002\002\007\002\b\033\241\204\373\203\017\034\351\303\367\246\017\026\002\t\002\n\002\013\002\f\002\r\002\f\002\006\016\002\017\t\002\020\021\002\022"
+	.string	"\r"
+	.ascii	"@\fP\206\367|e4G\3032TE\373BP\027s\340U7n\266c7\217\345\352\323"
+	.ascii	"\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"5\004"
+	.string	"\364\003!\001"
+	.string	"\021"
+	.string	"\001\001\001\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\004"
+	.string	"\001\t\001\001\013\001\f"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	"\001\017\001"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	"\001\021\001"
+	.string	""
+	.string	"\022\026\001\027"
+	.string	"\003\030"
+	.string	"\003\032"
+	.string	"\001\034\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\" \300\202)\024\017A\340| \241D0\327]\211\304\300\002D\334"
+	.string	"C*\222C\tF\344n\257%\r\331\220\f\221\2151\370\320\262\305\270\351\326(\303\252h\005\261\017H\001\024\3400-"
+	.ascii	"x\270\n\017hq\361\206"
+	.text
+	.section	.gnu.lto_.inline.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\351\003-\f"
+	.string	"R\214.60\217\222\016\201Y\032\341Sh\367\370\262~\340w8b&O\254\367\303\312q\320*G\302\3004\005\272+\036\220\301\300\300\300\300\322\253\013\352\031\212n\b\265F\344N\001\027\221\241\252\216\025\226\205\206\256BN\026X\261\002\310\221F)\324s\246Q\n\2259\341\202\342\210\320i\036\234l`\375\233\353M\300\031x\334\b\225J\336\002g\333W\263\352q\n\225\2607\217\232\023\341\320\270x%\231\020I\004\254\301\214\375\331\326\017"
+	.ascii	"\215\313D\020\227\377t\245\032!y@\305P\211h\031d\353u2\037\207"
+	.ascii	"\222\222A\201\335\263\r\253\307\2312\363\032\277\227w\310\314"
+	.ascii	"\207\357\243\326\314L\367\234-\223V\250!2\032\tf\246M\333\001"
+	.ascii	"P\002A\310\252\352\001\022 \202q\006\244)\207\224\320!\204PD"
+	.ascii	"\301L\205\312\2738\250e$$R\342\302Z\b\276\244m&\3670Q\267s\205"
+	.ascii	"\375\353\275\026\f|\355\315F\037\224\021\263\207\035\345\005"
+	.ascii	"\355b\370\0305YO\307\221\017\273W\253lsN\003/\230\234\221\324"
+	.ascii	"\375\031\255\331\311\007d\026\003\251M\362O\025}|\320\240\212"
+	.ascii	"0\217-P~\367\360v\202\320\023h8\341\037\332\271\261;\201I\350"
+	.ascii	"~\320\330\352\200c\300\33682e\016\270-A,\317L#\206\354\232\233"
+	.ascii	"\364.\221=\261\275\222+\001\222,\245\362\252\030B{n\021l\261"
+	.ascii	"\346B\224a1nH~6\362\216\216}s\016\250\300\013\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`U\005\335\017"
+	.string	"\006S?9P\205(\3510+\273b\252\31301J\315\"\024\275\b\240@\355\314\314x\200\031\303o\0201S'\326\340\003KD\324\220\301K\n\264\213"
+	.string	"\364o\355\377\342?A\244\021\"\323\016*"
+	.string	"-"
+	.string	"/"
+	.string	"\275\342\211:\023\274\247\346\")\021c<K\257c\275\024k\3572\233U\226e\331n\224\273\321\231\211\271^z\377K3?\257|\2360\323\002\341\265\306u\226s{^[q\346\334\306\306`\376\274\272J\302\b\343\240W\252\375\tv\350}\350\365\234\350\027c<\344\026\t\021\021\033\267\307A\226u\306\235a"
+	.string	"\367\372\250H\025\351\272,\226\314d&\024 d\036d\032,\264\355\361\035+\264aw\336w2m\277y\371\346\365\003\231\237\207\340\272\007|i\b%\0074\"\215H\"\231L\254\030#E}\r\264\002\030\201[s\256\235\004\\\327@1\252\034\262l\232\336\203@\"\221"
+	.string	"\024\n\344\250T\252*\200\217\250Am5\243)H*\225e\f\320\002\221\231\242n\021PhIDJFDD\002-IA2\034\342\020\240S\316c\006\2103\215\375{\302K\034\361n\332"
+	.ascii	":\017\221\203\232\202\344Mv\372J\233\214\200\213Lh\204\316\007"
+	.ascii	"?\241\261\227P\206w\267\365\222\005wp4\370\031\303\316\313\341"
+	.ascii	"\024!G\013\376\270Q\336\n\215\262\021{|\260r\b\210z\022\266\210"
+	.ascii	"\350\b\201ag\260Z\003\365\022\027*\333xW\003\303\256\251\007"
+	.ascii	"\344@\341@\232m5\022\337\330\374\031\312\025\006Lk\333\021\356"
+	.ascii	"\325\024\317\270\243<P\022\b\265\316\233\363/\202\212S1\317 "
+	.ascii	"\346\373\027\"m\310\244\331\0373\371iS\305\036\3344\205\262\360"
+	.ascii	"f\253RV\376\277\365\205K\002\226.\212\037h\020b\211H\b1\310a"
+	.ascii	"\227\201i\260\370\302\025\323O@\333\317ov\360\245\023|\017\327"
+	.ascii	"\250#l!\305\347\276`\244\013k\343\314"
+	.text
+	.section	.gnu.lto_.pureconst.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\200\004\001\230\004\002\230\004\004\230\004\t\230\004\013\230"
+	.ascii	"\004\f\230\004\016\230\004\017\230\004\020\230\004\021\230\004"
+	.ascii	"\022\230\004\026\230\004\027\204\004\030\200\004\032\230\004"
+	.ascii	"\034\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"5\004"
+	.string	"B\007\022\020\220\262\032\016\f\300\207>-.f\270Z\"S\n\235-g\276\331j\346\212mf\216\231_\346\226!+s\312v2\300B\262\215lM\2148\030,\2504)A!{\240\300\300c\353\2307\266\214\371\332\256\241\307\335*O\001\032"
+	.string	"\347\233-3&\\l\207b\0076\034\206\016\002F\342\214c\227\365\2414@\032\013q ;\220~\224\331\235\r`1\013A\254\210=*\210\226i \304f"
+	.ascii	"\235\033\200\254\0130\004"
+	.text
+	.section	.gnu.lto_.lto.4320c35753839e8d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.127.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.2pm\032\003\210\027\327\201\001\021\216\200\341a\350@\301\320\237Q\033CM$\004z\323\210]\024\265eT\f\374\365\201\225\2522U\341\361F\"B\222H\231R\222a\372x\026*\320\024#\004\f(\344H\007\331\251\036lx O\347\363`\224\217CP\352a\212\257\242\250\3704\327\335H\335H\264\211\366\n\261\206\321\272\362\377m\244\226\001\214H\nD\376\212\024\224\217\270\220\rM[\263\326\034\356\230\366\210h\346\267(\201\374\027B\0170v\033\017X\354*\026\260\330u\266%\2764~\2718\241\3700\371\377Z\206\247\331\254]rFd\205\314.\n\377\313D\326\310mnk\3206\241\255\025\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.128.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\035\013"
+	.string	"\206TL?\020O5\035\200\207,\f\322\004T\204\314\037\032E\363\t\003@>\223\314i\205\256x\364\367\251S\033\352\377\037\232\304\314\302\267\352"
+	.string	"\333\t"
+	.string	"T"
+	.string	"\224\033\206\\\270 Rf7\004\215\326\233l\231R9"
+	.string	";"
+	.string	"7"
+	.string	"\273\232\364\360\357\363\222\372\371\020\361\363\371 \375\222\243\025\340FJ$]^\nJ,.\b\020C\227\244\305\301\305QW\221\b\252f\224\335\265\206\342\350\306n\273\201m\006\366\r\004\252\352g\225\025\007\214\004\033\273\026:f,k\252\020\021\261}\265?\342$\276\237(Xcw\203j\265;.0\202\307\347\201K\260\317\353\004\260O\177\366\213\217\03763\211*\240\340\330(\026(?\017\021\226X\322\036\354\362\301\211\026!\225a\277\304Mx|\020\236\320\321\207\237~\007\373\274<\352\003T\0310\200\264\303\036?*M\366\257\335]\313\016\366O\177^\345\222\3018\330h.]\307\331\002x\233x\021<\313F\333 h\032\214%\243m\235\247M\n\230\223p\351\264\r\307uZd\334S@\022\234\020\2653\234\324\0241Z\032\256Lm\217\243\017\r \025\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.129.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\265\013"
+	.string	"\346\225PA O\234\016\203H|\324\"\b`\022\2429\314R\276\2555g"
+	.string	"g[\270\2721\020R\330\202\013\2175\"\034@\201F\345\360\361\276i\001\317\177\254\246\t\330\204n\n3\261C\354\225!\350\223\275\267L)="
+	.string	":"
+	.string	"?"
+	.string	"6\213\203\034+\331\350(\215\200\261\273W\334\360\3552\352\346\037\365\211\367q\227\031\036\345\201\220\022.\004|$i1u\360\216\272^\370:U\t\203\335\265z\037\206{\336v\003\333\n\354/\b\366\345\356\256\243\206\255j\353\036\377T\365'\224\031)\020\220\3305\245F6\234&:*\266\257\366=\374\303v\017\013\236\354j8\001\262\013&\260\001\353\263\300-\325\247\374\200\352\323[\246\240\351=\003\370x\021v\221;\207H\bH\364\245\262\342Q\267T\210XAR\021\377\227\352\321\212\326\322\251;\210\207\b\371\034\\A\244\367>}Q\365\3718[\240\210q\032i\312\0069\215\033\001\032\004Mg\363"
+	.string	"\344\321dY\b\013`\f\243q\264\f\350\302\"\\\236M\246sa\231va\b\3703A\223]\240\317'\273*\340^n\324\260\203T8\212\235\004\2152R\321\031mNG?d\204\244\310IK\035\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.130.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"}\b"
+	.string	"F\320<:0\3456\035\2003F\243\024\273\n4\217\037#\305\303\tJ#|\021\273h\003\n\202\375W\245\006\254C\243\373\364'T\031\210\313\200\221\004d\026\272P(\305'\251\331\357M\266L))"
+	.string	"-"
+	.string	")"
+	.string	"\227\376l\232\207!\273I\255d\250\324\354\356\214 \377\256\237\177\223w\300\023\351\272a\330]+x\332\270\343m\037\330^\260\335\022\366U\277ZX\207LB\314\256F"
+	.string	""
+	.string	"\273\222/#\230\355\253}\222\227|W]\270\263\373\001\343\262\033*\030\201sip\202\353\322\372\300\025\352\247L\374\344(\235/r\351\021\205\036\274\f\270g\256K\215v\205\205\036\264\262p\2540\"\311\016M\032S\366\255\335]GT\335\203\026\0029x\"\215\343F\231\2003O\027\321}\274\231AL\021\350\023\232\031\327MO\2017\t\215\233\336\266q\023\013K\2676\242\334\340\261*E\2239\001\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMainInProgress.132.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375 \364\255\006"
+	.string	"\242L.4Pm\222\016$\2439\bE\341\200\312Z\022\200\"\310\b\267\346\345\253\374\251\377\177\267\f\315\332\025\367\t\210\21533\213(\242og\315@\204\353\210\266\265Md\n[U\306\220U,\317Rx\016\013\225\206ga\331\253\004\276\036\022\260g\271.\354Q[\026C\210\003\033\344|/\224\"b;\036\234jt\343r-\206\300\270z:]\f\245S1@b\343F\277i\034\212\276Rb\350w\243sW\242@H\252\217\314\317\350$G\246\016\214?\363\324\006\007\231\265n\025\237\212J:\034&\231\333C\212ju\332mF\245\220\013\021\017HS\007\200\220\231;\017(\242c\377\202\237\340\237\b\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.133.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\265\007\335)"
+	.string	"\nI\020\020Fp\250Q\007\253\235\244i3\237=E5q\340\007\250\210\225\350\240V\212bC\330k\275\001\f\334DM\261AM\233\277$2\325\203\"\tJ\200\026\225\023\232\267\204\300\203E\005_\320\206\022\240\225\326\310\336r\357\224R\n\363"
+	.string	"\325"
+	.string	"\360"
+	.string	"LU\322\230\215\335\253\314\240lR\205F\025\0132\317\330\275\227A\243\fAmg\356\254\326Z\033\n\f\246\335K\365\305\345^e\003F\2406\272k!\333\350\331A\266Q^\231\343\2642ySd\034\250.<\367^\336W\365\332@?>\272\034\356f\253\321\324\324\242\347\373\312\235J8"
+	.ascii	"E\254x\0246\220U\377\204\031\255\206\270\217.\225@%\225\354\\"
+	.ascii	"\230"
+	.string	"\321\207\001%\306)\307\031\240\222\352\321\267S\350L\2207\035f\354q\026M\225\251\321J\214<\334v\026\215u\261\323J\214\311S(\352H\261\303\214;\274\226uE\363q\245\332*\035iZ\025%\207JJG[\333\021\352\334\335{g\034\237\034\315\321TF\034V\310jI\244v\214\361g\215\376sG\206\t\225;\022\317\002B|\224uW\273\214\343\320=\225p\357e/\036\245\232\203\232\271)0\263\t\346\264\003\375\205\033\313\020.\334]\272\231l\243<\222\334\037\314\355\305\314q\324{\205=\305^\274P2\222\334{\027\354\210\276GK\377Q\327\251s\346\236\317\273\310\267,M\346\360\205m\006\244\271\365\217do&;\340\207n\344\341rCt3\346\256\322V\230\270\2130\212\237w\261Q\356\237mt\300?\331\031\026\016'o2+\205\376H\346\376f\263Y\207_\bs+\233\213zJ3QC\351\336\365V\363"
+	.ascii	"\325\031\200\352\034\204:\003\325\234\177Tg\037\325YGs\316\251"
+	.ascii	"\3168\325\371\246:\333T\347\232\352LS\235U\3259M\235m\352\214"
+	.ascii	"\246\316\247u~\353\354\250s;\320\2159c\324\2747\252\251\3472"
+	.ascii	"Q/HZ\331\275\325=\245O?\231\273\2454Ww\261mJ\031\210\255M\n\222"
+	.ascii	"o,X\221\314M\027=\355mV\226\330\223\236\241\230\0243jn\217\344"
+	.ascii	"\242Wm\363\322\246\257\276\200\256\247=CoZ\3506M\352\2757\002"
+	.ascii	"\367\232f\2636\341.\322(\273X\261V,\333h\372\017\226\250\301"
+	.ascii	"\362r\300\231W\2555\212w\261\350\023D\335\260O\364~\006\265\247"
+	.ascii	"\033\206E\337\276]>M\355\376|\364\317\345S\222\2417\271\2003"
+	.ascii	"O\250\340]<\237\300\3271i6\366e{\344\262\377K\020p\346\013\030"
+	.ascii	"\274\213\377\270\031g\265G\212\35134\300\360h8\312\211\031rf"
+	.ascii	"\016Ga\230C/\355^_h\217\274\322`4\276\204@\204\360z\362\325\356"
+	.ascii	"\205\245>\222K\217\241\241\005O\372H&\033\006\375R\305\t\035"
+	.ascii	"'o\362\322jie\037\311K\326\037\b\344\273g\036A\302\273\350\257"
+	.ascii	"\233\261\203I|!\367\226\316\331`\n\375\314ji\005\006\rK\037|"
+	.ascii	"+~\036|>\234/\210\024<z\321\301\204\n\245Z\222\322/\330\242\347"
+	.ascii	"{Q\301\204/\210\304\342\327\373\005\223\220\206\226>\370V\374"
+	.ascii	"<\004\223|@`\213\036\216{FK)\226\220\202\274\336\t^\322\017i"
+	.ascii	"\005\257\007\\\342\031\005`%\026> /\250\244\004\344\331\224\267"
+	.ascii	"_\bo \303t\372!\0339\200g^\221k\325\216\370\302\240\007\360\r"
+	.ascii	"D8\224?\005=\315\211@\257\033\3329\357\275\027\350\347\335i\035"
+	.ascii	"\242K\372u\341Jd5\262\"Ab}\376\347\037L\367>?\004\266\347L\367"
+	.ascii	"84t\312\216\024\247\230?L\245\327+\233\373\022\\m\312\332l\275"
+	.ascii	"Z\227\254L\230\330Fs\217.\241\323\364\301\375\235&\005I;]$[\273"
+	.ascii	"\311\326"
+	.string	"\036\367\rFk\315\323\224\3566\207\214\350oomh}\201\321r\222\314=\222\211\336\366@\2562D7\253\275\355\207\322\2145\251b\265\307\315y\203\243=\234\200\226\250a,\t\031SB#\"R\230\222\024\322\001\260\002\221\2412n\021095F4\332\264~\006\274N\303\027\315\004\201\005*\364\366+\201\266,\273\2063\355\2474\240&\211z\264Kaz\005\262|%\n\r\fhV\016\003Dc\021\271\374\362\340\304\f\342D\250\221b\032Y\353i]3\262\rB\373\006\264\226{\007\032\374p\303z.\326\355\222\256j\023|@Xn\207\250\216>\017V_o\f\240\177\316\257_fT}\245\0228\307I\270K9\243Y>\370\314v\216\310\016\377\003\371<A/\275q\310ld\354;\260\034s\227#F\177U\005QM&\252\216\335\003t\2522d[{i\006\241\315\n\rD2\335\304\f\314C\310%;<g\264"
+	.ascii	"\304\376\\\350\202%V\2311\227<>\322\023\227\203\314\002\"\030"
+	.ascii	"i\232\214}\361\371\367~\363\270\004\367\242\334)\204\350\237"
+	.ascii	"\270\225\247\2562x\203\356\361\035\303\302\001\267.b\202\203"
+	.ascii	"\244\214'\353W\r\200\256\364R\241\226\330t\222\373am\006a\356"
+	.ascii	" \2020\203\353\003az\220QV\301Z\003!\017\202M\245)\220\370\003"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.134.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\r\n"
+	.string	"VSF:0\221\322\001"
+	.string	"\336\314K\0319\016E\326\027\225y\255\007\233\377\032\017:EYdt_\0332\033\330\006\214l\177\263\022\027\341F\211A* X9\314A\306\321\253\366\023\262\367N)4"
+	.string	"5"
+	.string	"5"
+	.string	"\333Q\327\305W:E\377\261{F2\365\332\3618\255\007\264\225\230\227\237\034\344\252\202X#\343c\237\033\244jN\316\302\356z\216d\307\275\3356\203\355\004\3332\001\313\272\261\331\331\306Bb\277\264?\377\330\376\264_r\023\3610\f{vCRd\273%\202\r:\337\n\016\342\276\325\017p\337,\3320/_\313q\321h\240\314\354\006\256\177\325h2\352\013\356\024\342\344e5k\346f=\212\263+,\346\307S"
+	.string	"\225\232\331\212\246\35425\251\210\375\272\273k\332\262\017\373\353\234>G\340\303E\241e\003\341\303\250Dr8\231F \210\362\002\354\205B\211Pt\352\274\210\316D\022\225:\017\f\273\020\201\277\211\021\330\235\276\017\354>\345\276.m\271\001d\226AU\3253+\265?\212\3711\016"
+	.ascii	"3\241\373/F\326PW\330K\250\366\201\027\326\275\335\302zq\301"
+	.ascii	"R\323\"\261jZ\234\344\230W\342\031\324\036"
+	.text
+	.section	.gnu.lto_taskUpdateMag.135.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"%\n"
+	.string	"V\023G?@\305(\035\2406W_\355\326\t~/p\265\227\277F\303\254\031\371\031\342\355\222\007C\342\302\246\265\321@\374p\263\240\225\rIZ,eB\246a\256b\200\"~\321S0\300\267\366\023\262\267L)3"
+	.string	"5"
+	.string	"4"
+	.string	"\273\311\222\203\237RA\377\254gB\261\364\211\021\271\234\r0\001\007>^A\304\323\334\240N\302\263\256\037\242I\365\002\261\273\326P\f\271\263\333\356\330~\260\215 \213Z\240`_\231\013\305\376hk\256\261}\265\257\362\025\360+\016gvG\002\264vG\0073`\236-|\243=\233O\320\236\031\264\r|T\355\305\004\345\321\222`7\236W\305`-\351\r\355\222\202\245\300Ic\326\024s\222fgh\350\303K\003W\312\353$K\366XRIb\177\356\356Z\246\354\257\376\251\352_\020\\\004:"
+	.string	"6\337\304'\004\222\030\211>\236G\342\016\314q>\213\3173\332\270\212M\004\362\2046\316\3736\216\202\273\213\217\267\215\272\316\3334\343~\256L9b\300\253C\232fF\247\264;\f}\030\016"
+	.ascii	"3\241\373/F\326PW\330K\250\366\201\027\326\275\335\302zq\301"
+	.ascii	"R\323\"\261jZ\234\344\230W\342\031\324\036"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.136.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230\256\360hU\342&O\f\204\267\222={6\016\2110\264=U;q\202\240TP\233tD\320U\365\214\210:\300KW\266\336\220\303\373\361\337\332\226)\005Z\303%\n1l\243+\313\"\254\200Z\037\355A\003m\321r\210\243\020H\024\255L\213\237\201b\020W\0267\f\313b\347\273\251\303R\027:N\025\320\242T&l%&\322^\223e\343t\001\273\366\353\022~\264\246\376\277\260\324\332d'\345\341pQ\200\3713fd~\252VH:m\235\255Kl\302\331DQ\316\357\321\242\362\177\0075"
+	.string	"pE`\001\215+\312\036\215\253r\355\213\277\220oDR0Pb\376G\bb\316\311\325>1\307#u\316M\302\377\246G\322p\241\333\026\264Eh;\022\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.137.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\255\013"
+	.string	"\026\226PA q\223\016\034\031\r\357\bM|[\317\fX\3603\0043*oxT\304:)\220\260\320\373\f}\202\034!\3407`n\275W7h\004\n\243 \t\200\330\033\030\275#\364-ZD\274I\333{K\231R?"
+	.string	";"
+	.string	"="
+	.string	"\227\017/*\244\250\261\273\225zxv\37043\377'\307l\234v8e\370\003@q\244\324G`e\005\r\212\243\3604#\"\266\237<-p\"\231\227\003\273\353\334\270\013w\274m\006\2669\3669\001\273V\022\373&\177\314\264f\372S\246\005\f\0041vGZnl\t\262\030A\331~\332/q\023\331M&\030\263\313AE\312nW\300\003\246C\001\327\304\303\367L<tf\253\274+\331z\020SN\373\b\321\306<\362\233j\203\r$\325\376\022\226\225\0245H\274:@\221AJ\026\373'\216\002\304\017a\t\037\371\355\320\377\210\207W\305\240bCCH\266\330\235\226\332\301\376\333\r\330\002O\350\243`\324\341\271.\017\213\303\326\006\003a\235Qe=\250:>\235Pe]X\265\t`\021\004\317U\215D\242\253\242\272\275\2228\201\213R\210\212@*\243\332\240P~\363S\315@i\006\211w\224k\023"
+	.ascii	"3\003\3369\004k\250\212\355UE\253v\020\017\344\355\252i\0205"
+	.ascii	"D\\PC\200\005S.\301\022\253)\343\227\207\320dU\230\240\261*w"
+	.ascii	"\356\001"
+	.text
+	.section	.gnu.lto_task_attributes.139.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`X\006\225\035"
+	.string	"\246,\257I`Zv\003}X\377\201\353\331\245\002/\261\237\3542\356|[v'\335\335-g\025Oq\275\301\352\r\211\312\351&\212\357\204*\027\275\305\024\264.\323\r\356o~O\322\350\r\n\b3q~\232up\307\244\235\300\325\274\365)\245\242"
+	.string	"\236"
+	.string	"\235"
+	.string	"\303\366\016\"~\266n\n\327\341\024\340\210\335\221\\\223H\240\333\2736~\227\232\245\314\327\004\255y\023Bd\310\204c{\367"
+	.string	"}WIK\231M\017\273\373"
+	.string	"\362#\030\364e0\270\316\266%\340-\331o\330\035\207\216\034BC\355\335"
+	.ascii	"\371\207da8P?`F\033\r\267\037\321\227\251U\236U\002\335\300Y"
+	.ascii	"\262W\355\216\246\354iE]m\331cdh&p.!9X\323P\340)u:\357\r\355"
+	.ascii	"\215 \207C?\362\360]7\272\244\270;\247\023\2513\365^\314\315"
+	.ascii	"\243s\253\257\367z\277\361\365\036W\302\271O\031\321\317\326"
+	.ascii	"]\355\270\334\3577\336\311\243\360':\231\326w\241\344\354\374"
+	.ascii	"\b\337\344Itq}\267\215I\031\353A\330^I\351\357\245\020\337k\332"
+	.ascii	"\336=+\007\354\bg\356\213\375\016_at\327\316\255q\266wz$\377"
+	.ascii	"\341\217}j{\367'\214\017a\n}V].\311\336\305\356^\276\334\365"
+	.ascii	"'\263\177&\177\221\261s=\231,Z\352z\322G\3733T\353\314\024\273"
+	.ascii	"S\261R\345\253\275\355\315\004~\240\251\264OAi\346\354\376$\n"
+	.ascii	"\024X\330\336\025\342Oa\212\365\254\322D\255\001\210\263\373"
+	.ascii	"\022&r\021\002\366P\321\017\311l\376t\016\360%\006\"\346\317"
+	.ascii	"h\271d\376fx\227\321\331z\215n\243\357\350<\272\265\007\351E"
+	.ascii	"\272\221\016\327\225\364&\335I\247\353R\372\225\216\245o\351"
+	.ascii	"v\035L\017\343\223\030x\021\236\311\227\360&|\n\377\344\243\274"
+	.ascii	"\224\257\362P\217\345\243^\272\300\277P\360\245<\234\317\362"
+	.ascii	"S\260\245\027\013\373:B\365\335\350\016\237\245\345\271\226\336"
+	.ascii	"\253\353\217\265@r\266pT}\036\351\335\263zc\345\257\274\213\356"
+	.ascii	"f\365]\245$v1SO\252\264\253\357F\257<\017\225\364*l\277\242\005"
+	.ascii	"\013\263<\370\022\345\036\037\3025}\244Y\016\327o\260hd9q>\n"
+	.ascii	"{|\206k9~\300\362`\\\344q \360\345\325\257\313\177\346\030.\277"
+	.ascii	"\361\f\323,\347\001\326o\221\216\203.\207\205o-\023}\352\036"
+	.ascii	"x\236\215@\033N\3273,\277B\307\031\256\353w\247\206\323E!\217"
+	.ascii	"\323\364[\034\022\201-'\316\357N\217\303Ac\035\327\362\353\362"
+	.ascii	"\343\\\303CX\206k\031\016\003c\0378\b\234]\376C\334!\306=q\321"
+	.ascii	"\345H\235\246\2629d\364CZ\370]\b\200\222\250A\\\254\2402\252"
+	.ascii	"\037\205\346\020#\0211n\003\020(\205\310\206\252\320\030I\307"
+	.ascii	"\024\035M\3039\350\272d\037\261\026B\207\311Y\232h\275\266\355"
+	.ascii	"\214\206\007\237\003e\363\002\026\213n\251&V\\F\260\024\035j"
+	.ascii	"\267\311oQp\327\337\237\204\310\006z\327\374\237b\031\356^\220"
+	.ascii	"\320|\316dk\321\321bx\214\026\204\331[\t\360\320p\242\036\r]"
+	.ascii	"9d\330\210\232:\270\2616\\\276&o\027\3326#\035-\245&\272\365"
+	.ascii	"d&\310\214\377)h\2211\033A*5\032*\241h\367K(\250\274\345U J!"
+	.ascii	"\027\003\252|\273\236\001\302k\200\2249oz7\210\355S\3750r\007"
+	.ascii	"\357\213\322`\310\317k\332\023\210\033\321\0176e\303A\002h\275"
+	.ascii	"@\330\306\277\202X>=\017\005\241\344VU\335b\342\247*\024\213"
+	.ascii	"\246G\032\017\343a^\025\224\037\244\001;\bD\250\200\177\375\f"
+	.text
+	.section	.gnu.lto_getTask.140.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\265\b"
+	.string	"\346\220=90%'\035\200\013\277\240a\350Q\230\240N\342\273\224\036\250\303\363\223\215\374\320\bl\033z\323\300'"
+	.string	"L\326xE\200\206\002\201U\30697\354\311\342P8\366\265O6\3312\245,"
+	.string	"."
+	.string	"+"
+	.string	"4\032*"
+	.string	"\273Sz\336s=rNp=B\220{W\317\277\312-\222\232\233\357T\272\0068\354\256\365;\241nx\333\t\266\027l\317\0046\273\033\253"
+	.string	"\033\023_Fl\223\354\216mU\373(O!}*X`\267\243\304ew2\030\201\363\370\261l\373&?!\3313\230)\324%\022\234'\265\273\r+g\261\360C\036}1\322\177\217\376\350zT\370\217\303\244+{\226\024~\330\267vw\r=\254\237\377\255\003\030\031Q\020\017!\016\353.g .\304a\235\314$\244h\002\243\220\331\306IP\201\265\212\210Mv\232\266\311\316\334[\341\307\0043\354\267x\003\251\3176\306U\001\013"
+	.ascii	"2\003\302\260a\234\"5\246f\323>.\243&\025\355Z\305\203\273O\252"
+	.ascii	"\025\2230\311"
+	.text
+	.section	.gnu.lto_tasksInitData.141.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`.\001\245\r"
+	.string	"fY[D\020\221\223\016\243U\321`\354`D\333}}\353\351\023\203\353\241\252\020\271\244U\326\\ t5\235\270\203\377\254\031\213\357#CbQ\204\354Y\005"
+	.string	""
+	.string	""
+	.string	"\024\006\302\021\242\361\f\253A\307\361\253\337,\331[\312\224\002F"
+	.string	"G"
+	.string	"I"
+	.string	"\333\313\276F\2252s\263\273\227\216\260\307\337v\277\fe\310\217y\002\256\213\232\350\360)\312\r\013"
+	.string	"\r\345AP\245\314\370\366T\321H\371J\254\\\277\235\001\207\212\332\312\223\023aw\235Q\373p[\267\r\262\275\300~\f\352bo\242,"
+	.string	"\203\342dm\261o2\335\371\3649\006r\310\300b\354v\350V{\202/`n\272}\023\376f\317O\274\024\272\3116\035\221\207\016M\315\352\306\356~\034ZA\347\020\301\007X\207\357\002\254\303{\034\262m<\244\354|\265G\336\342\304\243\306\356:`A\022\200\346+0\013Y>f\326\241\322\2108F\331\331\23799\360h[\303U\\\270^v\367A\212\313`\360I\034:\203I>\036\372&\372\355o\305q\021\304(;U\224\213\222\b\r\"\367\007$\033\311BJ\256\317\204\213\202H\b\311\365\001e\027\b\001c\025$\200\256\022\f\003]\236m\257-1\357\300\350N#%AuqGJ-\325T~<U\3056V\352K2\251\r\251\372\333\335}n\360TK\317\302\2418\204\b\034"
+	.ascii	"1\003\373\334\001C\343\334~Y\264\326|\210\262\310\204\003w\200"
+	.ascii	"B\274\032}\251XbFe\023w\344\205\202\031\t\356\266\332\3376;t"
+	.ascii	"K\006+\321/W\004\231q\343\242\354\311i\t\252\032\357'\221\316"
+	.ascii	"5\237"
+	.text
+	.section	.gnu.lto_tasksInit.142.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`X\013U4"
+	.ascii	"\312W\f\023E`\246\326\030+\326\316Q\006\335\220p\246\335P\345"
+	.ascii	"\005E7J\345\006wc_\241\263L\006\206\334\306\220\222\213\277J"
+	.ascii	"?\035\354\303p\272\374\260\253\351U\370\340\331\221`\377\270"
+	.ascii	"\240\223\302\310v\227l\333RJ\231RJ\001\031\001\006\001!\001\255"
+	.ascii	"\363pu\026\256\316\300\325\371\267:\373\336\271\307:\267\253"
+	.ascii	"3\373\316\253\352\254\276\363\277\263\273s\217h8$b;\320\232o"
+	.ascii	"\346\355\345\312\253\363F\327-h\315\326\355\326\316\334\335\326"
+	.ascii	"P\006\272\t\335\305\261\2555\350\365\312\n\232\334f\213At\365"
+	.ascii	"\366rI\300\213\262\331\275\357\233R\257\214\324\353\225]\346"
+	.ascii	"5\375f\366v\226\031L)v\357\3732}Y\273\375\223\364A\366\360\034"
+	.ascii	"\215E\342P\030\004\376|\275\226]\325w\227\273\235\340k:\257\372"
+	.ascii	"'\271\206\346>\355\004\037^k\215T\027d\331\355hiW\0215\210\307"
+	.ascii	"$\323j]D\274gm\210\363\234\365\361\314(\355\n\"\304\213fM4S\353"
+	.ascii	"\032\363\241\231\230\013\303:\330\322\256\260\"\265\256\035\016"
+	.ascii	",\362\341\005\326?0\367\351P\353\372\362\236\264+G\333X9\232"
+	.ascii	"\035:\231@\247\226\257Cg\226J\364\276\257\226\2536\372\325\003"
+	.ascii	"S-r\206\316\245\212\344*\322lh\373\226S\351\336Nx\337\227\275"
+	.ascii	"\351\364j\006j\346\2062\363\005\346\237S\321\2546\303\233\306"
+	.ascii	"\375?\271]\260\354\227\200\202f\351x<\344\314\025\234\274\233"
+	.ascii	"\354\007\347\240Q\345\372\277\246_\377wG\307\274\203\325\030"
+	.ascii	"X\365\233\276\3550\273(-4\026\fW\032.\203\206\r\033\330^\325"
+	.ascii	"O\301vF\254\315-\351\377\035\245\2319t \362\217\260|k\226c\377"
+	.ascii	"\021h5Qz\036\367\3737\363\016\363\207\256\002\242\367\276K\006"
+	.ascii	"\334S\232J\b\356!\275\262\b\022\336\315^\271I\260\275\366\303"
+	.ascii	"`\213\212\265\271ay^\257\333L\355\246D_\352n(\2269\352\204\220"
+	.ascii	"\216h\326_1\320\231UHy7\031\331&\355n\252\374+\3467\245\377\223"
+	.ascii	"\271\325\367\1770\253\316\017\232\255\331A\27357\275\263\201"
+	.ascii	"w.\360\316I\357L`uF\3529\017X\235\217Vg\243\325\271\350\235\211"
+	.ascii	"V\347\241w\026Z\235\005\274s\200\3259\350\235\001\254\316@\357"
+	.ascii	"\374\363\316Iw\366qg\344\352\334\363\316<\255\363\361\235\215"
+	.ascii	"\255s\361\235\211\001,\362[N\r\277ro\344\371\353\342\370r\301"
+	.ascii	"\300\330^\221\217T7\374'\367x\317\017\245\t\3350\2517\273\251"
+	.ascii	"rN\232\233\276\343\241\246\207\274\242I\347y\365\370<q\340\034"
+	.ascii	"\337g\206\f\023\343\177\361\215c=eS| \016\272;\342{C\261\303"
+	.ascii	"'~\303\271=:\215{\326{\337\227\001w]\243q\311\334\247[\346\226"
+	.ascii	"\261\275\016\3377\207\216I\360\247\324\302 q\356\370\226\272"
+	.ascii	"\300o\t\225\274\333=#\342\242y7\205\037\234\243\023]\026\370"
+	.ascii	" \220G\326_\261\300\177\252\377\373\037\254\324I\377\355\373"
+	.ascii	"'{\253\324\303\2728k\330\245N\372-\316\322\017\276\241}$\244"
+	.ascii	"\r\332\276\372\017\236\235iC\351y\275\0360\311\213\357\333\356"
+	.ascii	"\021\226\331M\342.\361n\002\277u\302c\371W*wi[3k\377\331/7\206"
+	.ascii	"L\r\373\373 \020&=&\372\373\226\253\363\367}\257\326\346\322"
+	.ascii	"\276\037\242q\322s1\304\370\036E\333Z\357\201\016\276\367?<6"
+	.ascii	".\224m\337A[\177q\241^\332O\321\226\246&=IFk\t\316i\tQ'\236\254"
+	.ascii	"VLy\260b\021EE\345\242\302\013\252(+\253'\nQU.\214\f\225\240"
+	.ascii	"JE\325\223\025\023\224\t&\026(\236\244\230\240\250\252\230\022"
+	.ascii	"\370\360T\213(*&\253\251)*&\340\033V\377\2172a\242X\257d\242"
+	.ascii	"\023\370#\322\023P:y7\221\036i\312\221\350\335T\231%\345S\306"
+	.ascii	"\336\273\251\362GH\277\t\"3\253K\372V#R\240P\352"
+	.string	"\226\216\327Zc\256\210\361!\3069Y\237\221\2121\372\"{\203\374g\257\335\031\354\200\247\202R\307\3642w\206?\035\210\273E\303\345\342b{\035\360\255\021)i\306\206b\253H\275\364\030\225\032\202V\215\"\307\2456p\364%zG\337U\244r\006\276\310s\366\204\n\230\243\321\277\324\235m\364=\307\215E\377\322\257.z\365\2134\t\321\023\207\236H\035\372\267\223\206\t\375P\300\013)yO\300\253q\322\033\001^\030\364\001\222\274\203~h\314Nt\t\340}@\017\340\021\f9\235\274\233@\357D\354L[\244\235\270\273iV\221m(V\311\317\373\262\223\337V\372\347\033N\253\211\317'\277\231Z>\257\302\355\314Jw\204\350\336\b\200\343\250\2014d\231c#\"#))I\2411\240\002\021\241\"\352\006\0200\205\212j\223\f\007U\335J\272\233\342\263\266^\313\357Vc\232\b-T\035\311\005\326z\027!\366\321\345"
+	.ascii	"\271\334\236\034\347\225\343\341\256\024\264{\367\307\222[\320"
+	.ascii	"G\356\300u~\340|i\364\335\201\025\322B\003L\250D\354\310\205"
+	.ascii	"\205\004>$\370\321Q\003\266x\351\326Eo\267U:\264\354\211\313"
+	.ascii	"wi\023E\200](\241\247\343\263\360\242(\366:i:\r)\tP]t_e\240\243"
+	.ascii	"L\251\374\206\203\276\364y\022]|\310}\202M-B$0N\201\331Q\215"
+	.ascii	"\330\253/\263\206\246\321zW\314{\241\201\256\213\035P\001\305"
+	.ascii	"\331^\022\252)\003\266Dm\207@;\320\223\006Y\212\270\253\361\345"
+	.ascii	"\177M\036l\013\205\317\355\361\364~\330\347\024\216->\245\255"
+	.ascii	"\376\023\276Tr\013\013\222S\021?B<\366\325G\nyp\2177\330\365"
+	.ascii	"\336\n7\024\r\241\250\002\t\342\206\"\367\265\200\347\350k\366"
+	.ascii	"\335\352\251B\2146\035%o\237\223_\357\363\255\343\250\235\020"
+	.ascii	"C\3264%\231,\336\003\313D)\0372\033\224q[\235\020\216`L\374\004"
+	.ascii	"\230V\022\350\325\317\033D\214\nc:\256B\324F\006\260\221\202"
+	.ascii	"qx\213\023u\264\3148l\360\245\004\022\316O\357\007\022\327\034"
+	.ascii	"y;\335_\242\2414\231~\362\271\232\273E\355\365Qg\312\326\204"
+	.ascii	"\376\206\025\205G\0132\216\007\022@\021K{\032\331\002\200\210"
+	.ascii	"\215G\300\3211)\233w\3279@qD\233\361\344PG\027t\034\264lw\214"
+	.ascii	"\303\274\306l\204C`4 gC\020\257\273l\343\357mI\300\362~\251\336"
+	.ascii	"\2223eT\231\242\227\032"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.199.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\205\t"
+	.string	"f\021?8@\217\322\001\230NL\rA\363\313\022\327\234~\taP\355\221\253h\340\300\022\243!\253\342j!\242\017I\r\303\211\300\016dn&,\234\224$<\273h\225\264vo\271S\n-"
+	.string	"-"
+	.string	"."
+	.string	"v\371'\262\232\021\226\215\223\227\335\235\227\032r\357\n\243\347\377u\r\245:]\001T\035\207\003\217\232\206\335u\346q\313\333^\260\255`_\0136\204\377Lw\225\342\267\252\224!\264\337\272\211wW\311\332.\b\nl\367K\2704Bvy\360\202\314e<'si\277\304\266)e\317\001\024\035\007&\341\325\266\270\200G9@\245\025\323\320\023T\2265\306\325\225\375\357\277$`h\331\345\210\201\331\017\231Bb\373\366_&{\263\271t\035\304'\004z \211>\034W\261\tx\353t\022\235\2074\267\210)\002yBs\343\272\3311\360h\342\303M\322h\304\315\315\343\352\312\016+1\f\315Pe\331\316\002\024"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\372"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.200.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`1\001\275\r"
+	.string	"\006\232[B o\224\016\023\201\004,\200"
+	.string	"\t\340\220O~\375k\035J\0029\200:}@\235*\221{\301=\r\364\372\2078\242E\312j\230y2\001\344(\200\t\"D&\326R\030\023\372w\200!\003\362\311&R\246\024G"
+	.string	"G"
+	.string	"D"
+	.string	"/a\033dr\310v\361Pd+\247\030\244\024\214\335\335\036\365\364\320/\315\030\362\217\272\306\007\212~\345\007n\270^\tX,^\004"
+	.string	"G\227\2454\342\373\352\251\001\004\311\024\360Xy\260\273\3168\334\330mG\260\355\300\276\207$\376\312\232\355\253R\037_F\251O&2e+H3X\273\241\202G3\310P\367Q [\323\234\371\020\364\021\217+\\\320\344L\373&~\"\364\021\017k\354\206PQ\262\033.x4\202\354\361r\013\366x}"
+	.string	"\366h\007-\353/\202\302*Q\r\261\375\301R\r|h\221\264\030%\212+y\265\275\216\374\227\372\325\177*\3118\031\251(5\304\032\177\255\212\260\257\264^u\347\303\377\031\201\003)\273\245V\312\202\210&$\256\372\355\373(\036\034Gc\201\002\206\203\200\201\343h\336\004n\243\221\340\341p]\327\221\001\340\314\206\307\341a<[\246\302\306\321`6[\246\363\266\215\002\356\\\340\272\315\323\351t\233v?3\351p\362\241 \227\226\252\226s`\366\246\223\377|\311\240\"\247\2526H\261\"\315\370\310\034"
+	.string	")+"
+	.ascii	"\3149,\030\300\206\230\006\022\227z\245|\260\004\220\007F\270"
+	.ascii	"b\230\306\006\230E\352\025,|\032pm`\025/\200A\304\314\361\211"
+	.ascii	"\315\016\274^N\221\2633l\233);\r\004\327^Lqhj\334\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateMag.part.0.201.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`1\001\345\r"
+	.string	"\006\332\\D\020\217(\035#\341fW\b\214"
+	.string	"\242Q\247\364\277g\023\320'\220\244&\022\272\"\273t\344\357H\271\005\252\337\272>\250A`\225\3165\331\0024Q\021X\025B\005\001Ydp\205\270\237\304tA\032\331D\312\224\002H"
+	.string	"G"
+	.string	"E"
+	.string	"'a{\2042\311~\361\360d1 N#\252\030\273\273=\252\311I\2774#\311\177\352\032\037X\372\225\037\250\341zq\264X\300"
+	.string	""
+	.string	"\232\256\314)\304w\326\023\003(\222\031\340\021\303`w\235m\270\261\333v`{\201}\016\001)>\313\232\355\257T\"kL*QVBe+.th\355\206\007\036\235 K\335O\215lMs\346\303\321Q@\256pA\2243\355\233\370\t\322Q@\254\261\373A\205\312n\210\340\321\006\262G\3153\330\343u\001\330\243\035/\326\377\304\245\245\242Zb[\204\245\026 iIqaJ\027c\362j{\037\371/\365\254\337$\303\b\026\223\226RK\254\361\327*\211}\245\365\253;\037\376\317\006p\224\330=\275\310X\017qE\304W\277}\037\305\003\334\2473!\302\206kP\201\373h\036\004\316\323y\020\372p]\367\301\3310\247\303\363\3606\241\215#a\373t6\236\215\323y[\007\001\203(p\335\026\002\201\272M\273\237\255\264`\tQ\221KK\325\314=0\333\003\312\177\326X\320\222SU\025\244h\031\231\021\222\001\034"
+	.string	")+"
+	.ascii	"\3149,\030\300\206\230\006\022\227z\245|\260\004\220\007F\270"
+	.ascii	"b\230\306\006\230E\352\025,|\032pm`\025/\200A\304\314\361\211"
+	.ascii	"\315\016\274^N\221\2633l\233);\r\004\327^Lqhj\334\273\312\030"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.202.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`#\001E\r"
+	.string	"\006\331XC"
+	.string	"\2216\035\233\027A\020T\36558\350.\f\200\272\206\177\027\236\334\270\211X\033.\270\214\001\204}\315\002\366 A\016\343aq\033\245\376\035\024\020\nTmc\020\224b\250\364\357l\347\r\260-\331[\312\224\002A"
+	.string	"I"
+	.string	"A"
+	.string	"\273\237\202G#\250\036\255\027\240\036\341\tP\217\232\307\227\260\375I\261g\313\370\007b3%\f\"S\314\356^\217\372\341\3365\241\347\203\256"
+	.string	"2hxr\034f@v\327\325\206;\336\366\002\333\r\354\223\002>\305\321\301\262\213r\242\261\035\242\013\021\177\371[\236\366\355\233\370\370)n\262\346\305\233\217\317]J\234bo>\274\273\224X\240oQ6+0Xb\030T\217-\237\177&\026\207\216Gg\332?q\024\336?\023o\354z`\321\"#U;\244\223\037\331\022)\310\251\232`%\206\250\306\177\200\272\246:E*'y\262\257\342+<~\b[\340\362\243G\237\243\036\2577\035\222\030\361b\206J(O\251%+<\\%\3311\2550\2350\003X\2079\030\341\036h\035FR\001\273\240\t\340\"h\035\016\204ND\3336\222,\2003\017.\204\303\272+\233p\211p\260\316\225m\334\345a\300\236\021m\273:\217g\2734\266\363J2HHOTK\266\007\344a$`\231v\030\n\234j7\364\034"
+	.string	"8g\340W\027\fI\200`Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375`G\tE\032"
+	.string	"\326\247\217E\200\234NcT\270\313|\367;\356\020\260]\3060\274\300\276\366\300\343\200\205%\252I\376-\331Z9\240m\033\013oXZ\272i\255\333\210\210\210\225%eyKn\212\355\276\203\332\013,\260^klx\323{\313\235dv"
+	.string	"y"
+	.string	"~"
+	.ascii	".B\022\3212\bwJ>\270QRxo\t\336Zl\255%Q#j\255\360x\336_n\272\337"
+	.ascii	"\230\356 \016n7\262\301\r\204\301\335\266d)\346\360\036\202\022"
+	.ascii	"\211(\331\202\233\355\3472S\351&\222I\036c\"Y\314\221\303\230"
+	.ascii	"\327Z\247\250\221}\230\367x<\312\025\335?\b\020\271h\016\335"
+	.ascii	"UB\267\020\035\224H4\216Y{k\323\\\271DQ\024\r\272=\222\326\332"
+	.ascii	"\035S\367\224\027w\026\325Me\352&sqsiq\203I\335aQw\027\026\267"
+	.ascii	"\027\250\373\313\323-\346t\203Yq\217\251\270\255\244\270\257"
+	.ascii	"\240(n,\350\211\273\212\211;J\211\033\213"
+	.string	"\304\re\304\375D\304\355$\304\335\004\304\315\344\303\275\304\303\255\244\303\235\304\034\356\253\r7\022k0Z\006\0331\330\314\005\257\231\026\254V\341>B\301DL\001agq\023n#\244\255\222`+3\302\003K=k\354]s\271(\016\216\030o\347B\rw\224x\267\211\227\004\340\002\025\224\267\027T^\236\032\241\362\356\3249C\345\335\245D\345\325\255E\345\325\245F\345\365j\177\265\371\202;*/\224=\267uDC*\257\325\003\344u\021\001y\235\332^sq\326$ /\220\001\337\0367\031\036\267\331\216\373\214\216\373,\307\235\206\343Vo\334el\334^5\356,4\356\256\031\267\226\214\233+\306\275\005#\226\212j\355\274Sl\347\235R\375\323\345\365f*u\001\254.9R\305\2505\352i\035\236\367\251\370\224:\251N\302U\250\n\323\363\006\327`\261\355\274\301\364g\375\031\240\002U`\321\355\274\300tU\177\305"
+	.ascii	"\252\317\352[\317\353\343\255\266pfc^\303\363\356T\235\252{;"
+	.ascii	"\257\316\352\325x^(\253v\2429\257\211&\331\310\271\321\362\371"
+	.ascii	"\201Ye\305Y\365w\235\246\371\360\364\364\240\361\360\\\247\236"
+	.ascii	"\357\002\3313\337\005\n\200\233\250a\030J\321P\nR\222l\034\320"
+	.ascii	"\002\031*\242t\021\200\020\344\024\202F@\241D\"3\037\024\022"
+	.ascii	"\225\304;'\252o\035@[M\"\367m\320-\334k\223\346\241\356)\237"
+	.ascii	"\363\345*\324S\304\"\3376\226\371X\272Wx\2351\362\207\266\303"
+	.ascii	"|t\312\257X\207&\177\356\323E\375\030\\\206d\275rVj1q*\340\001"
+	.ascii	"\327\270\270,2\230'\247+\351\276\362\260f\3659H\234\336Y\r?\240"
+	.ascii	"\241\"\327\237\364\356\035k`\221 \035\245\276\267\274\324\256"
+	.ascii	"\177\331\265BM\261\362\312c\356kc\021\231\265\325\324e*:7\231"
+	.ascii	"\227LZg\245\247\022sZ+K\326R\307Nme\305\272G\246\365\275\226"
+	.ascii	"<\002\350D\027\217l$\264\324\350\353Z-v\035\226\027\030\322^"
+	.ascii	"@x\036\020\300\004\3121\221\0177\035\222\t\260\373\b\223\t\242"
+	.ascii	"\271\365)\210c4\233\311\372\203\357\f\214\314\0066v\233Js\342"
+	.ascii	"\332({\201\302\317\001\346V\256\002"
+	.text
+	.section	.gnu.lto_.refs.4320c35753839e8d,"e",@progbits
+	.string	"(\265/\375 \342=\005"
+	.string	"\242\r')\2007I\007\363B\0234A\0234A\0234\027z\240\331\307\350h\035\366\177\223\341\307Fd\035\026\377\343-\376n\210\354\376R\246?\004\345\037&\3570\371)z)zJ\364\317\372\307\372\306\372f\275IF\bhh\246\213\262\215:\212i{)C\027\n\251u\252B\235Z*5\241\267\322\310s!\316H\017:\241\032p\336\005\204p{\272\021t{t\300&\343\005\247\242\016\317\250\307\334_\032>\251\267"
+	.string	"\274\244xE\361\245^\2428\244\336q\234q\\q\3349n\367\274M`&.\377\210\002"
+	.ascii	";\241\332\025`3"
+	.text
+	.section	.gnu.lto_.decls.4320c35753839e8d,"e",@progbits
+	.ascii	"(\265/\375`4|\r\013\002\212K+\273T \na:\215\001\300\035Q\257"
+	.ascii	"\312\036\220u\316T\251\272\376U\026\340\262\347N\322\263\367"
+	.ascii	"\300G\364\333\tD\325Z\277\307\235\235\355\342\250\243\005\324"
+	.ascii	"\336'G\264m\333p\032~\334ip\363\272\226\355qF\236\272{\217;-"
+	.ascii	"\230\001\271e\037a\321\232\334{\313-e\nx\n\303\013\367\0131\324"
+	.ascii	"\334\b\203\363{\260\364\357\232\035\025\261\273)bx\347\230*L"
+	.ascii	"2g\336Y\346.O\274S\214\207!\240\2333)0\235\3373C\277\307I\237"
+	.ascii	"\207\216>\217\237>\217\031}y\270\350\035\0366}\236%\232\247\353"
+	.ascii	"\006\245']\026)Uyup>\217\020\375\273<\265\234Yv\314\370\370\344"
+	.ascii	"N,?\263<\256G-\f\r)\234\317\267\363\312\177\340O\223\032:6\316"
+	.ascii	"+\347\234\037\333V\032\316r;K\324\256\324\300\371<;\364\031w"
+	.ascii	"\302\361\300 B\247\004\347\363\324\320\357\003^384*8\237g\353"
+	.ascii	"\263\312\177\212\235IN*g\021,<;\234\247\370(\257\354\374p\376"
+	.ascii	"\216\033\215\306F\211\236\330\336\373\377\331vB9\225'\333)\345"
+	.ascii	"|r\256\235n\247\223sy\227g\224S\315\256I\03353'zDgl\304\310\302"
+	.ascii	"\3501\231(a\303\234R\366\270{\347v\305\350\364\230b\226<\316"
+	.ascii	"\007\2707\027&r{\357\337\2653\312\231\3668\237'\345.\242\262"
+	.ascii	"\231s\342\245\271\367\366\340a\350\347m\311\327\223\004\371;"
+	.ascii	"p\372;O\364w\324\364w\320\364w\224\350\357\220\351\357\210\351"
+	.ascii	"\357\030\321\337\001\323\337\371\322\337\001\242\277sC\253\312"
+	.ascii	"+\224\276y\203\322\236\256\033\224~\007\206~\220\216~\260\215"
+	.ascii	"~P\213~Py\016Q\341L\221\021\203\363\203C\316\257`\016\375`\225"
+	.ascii	"~\320I\373t\301\321\007\242\321\007r\321>b7(\035\272B\351\177"
+	.ascii	"\356\350\320\003'\317\351\214\013\3039u\2341|\320\322\242\310"
+	.ascii	"\301\371\227\256\t\373\360A\367\356J#\266\261\217{7\244\001j"
+	.ascii	"k\346\340:o\\n\326d0\323\250q\023\366\246)\006\257\020\347#\354"
+	.ascii	"M\323\016\r\326\352\200)\354\315\331\237\bil\230{+\305\2341p"
+	.ascii	"\023\313\361\211\333\343\223\302k\330\210\t{\323\304~\267\256"
+	.ascii	"\315\\\330\233\263\276[\227\"\021\023\366\246\351\204\025\366"
+	.ascii	"\246\251\367_1m\252\2460\223,\303\3364\317\030'\023\366\341\323"
+	.ascii	"\244\334W\352[\222\2607\315S\352\254qj\235W'\3259u\3368\261N"
+	.ascii	"\030\247\3259\343\264qf\235['\215\023\307)\343\314qV\335\345"
+	.ascii	"\031\343|\372\tuF}\360_\27338\304\366V\212\370\340\214\201\337"
+	.ascii	"`-\037&\345\236\241\"q\023\366\246\271\267\222GG\332\026\276"
+	.ascii	"\016\031w]\241T\203\033\224\036\b\246\017\274\241\017|\322\327"
+	.ascii	"l\3645\026}\335\226\207\351\364\334\335@C\005\347k1}\275\003"
+	.ascii	"\307\271Uo\202(\301\371ZJ\303Q\373\364\3252\372\352\026}\025"
+	.ascii	"\212\276\032D_\325\322w\273B\351\325&\375t\215~\272E\377\314"
+	.ascii	"\024}\346\230~\363\n\245Os\350\2471\364\217\315\340<\234W\006"
+	.ascii	"\223as\344\013\013\213\301c0\336]b28\314\261\035\276{V\356\375"
+	.ascii	"D\006\263a0\347\362*\002PSXI\006Ci\243b\322\375XI\006/\313T\211"
+	.ascii	"a= Zv\350\234v]\241\364dnPz4\216\376q\224c0?V\3425\\\207s\033"
+	.ascii	"\031J\244\340\374\005\225\202#\253\303\371\250\031\375\037s\301"
+	.ascii	"Yp\027\254\005o\301tw\211\275\340+\317x\n\025:bjX\260\226\327"
+	.ascii	"\037\363\r\303\235J1U\212\223\034&\221\027\034\207\347\326\342"
+	.ascii	"0\253X\301Z>L@\333\to\216\030\226\362\023y\301nX\353\336mm&7"
+	.ascii	"\036<\271\323s\362s\005G\2330>\371\350\022}\024\210\306r\300"
+	.ascii	"<\276\035n8\037\325\241\217Z\3511NV\\8\037u\322\317nt\007;\035"
+	.ascii	"\302M\207p\205R\334Ft\034\305\2027-s8\2537(}V\323i\026\242\237"
+	.ascii	"m\350\337\341'\033\350',U\324\260\023\334\204g\212\331\236\202"
+	.ascii	"\245\216\233\3748\006\226\201\325x\200J0+qp\306LT\277$Rc8?[\351"
+	.ascii	"1\354\205\205\204\020u\005\2342\023\306\264\233A\205I\244\343"
+	.ascii	"\276\235\313+M\345\353\214\271\367\026\203#\rO\021\201\233\362"
+	.ascii	"_17\324\304\326\252\254`\256\035\330\207O\023\320~\202\201\344"
+	.ascii	"\307Jp\021\\\206\3010\032\016\303b\330\b6\303H\360\022|\004\237"
+	.ascii	"a2\234\004\247\335%\036\373\361\027\036\202\307\360\017\354\343"
+	.ascii	"T\312i\030R\2160\261\036w.\257$\2102\343\306\334{\213\331br\305"
+	.ascii	"\344@c\216\341,\254u*\305T)_M\230x\212\352M\314\356\352\222\361"
+	.ascii	"y\002\332O_S\304\366V\342\2511lu\311\234\313+-EJ\025\346\336"
+	.ascii	"\312!\017\036<\244^\274l\255\311 ?o\235\367\025J\257\024\202"
+	.ascii	"\203\230\331Q\304\260\223jEJ\r.\234\377\337%\006\262\207\256"
+	.ascii	"U\022\250/8\377\364\323?\3634\346\201{\334\345\006\270K\371\203"
+	.ascii	"\303\350LY\303\371'\030\375\273Az\376\375\335\r\322\237p\372"
+	.ascii	"rW(\375y\246\177~\351\237Z\372\247\224>\226\2431\r\\\343.+\300"
+	.ascii	"6\224?=u\320\352\310\301\371\230O\377V\220\336\277[Az\234\247"
+	.ascii	"\217\337\364q\231>\326\241\177\353\350_5\372\227N\207\270A\351"
+	.ascii	"\345\366\025J\203\373\006\245\030\006\321\261\324N\225/t\220"
+	.ascii	"\340\034\204\243\240rT\363\315\034\316?\206\302O@\"]v\334\341"
+	.ascii	"\214\235\206\360\027fT\023\316\277m\372\377\375\303Lw\316\245"
+	.ascii	"s\353\340}\227\270\351\277}\327\357C\312\275\237\256\035n\272"
+	.ascii	"w\367\315\347I\271\261\202_;\366;xs\37168I\355,\005\307\224\326"
+	.ascii	"\331\332\177\355~\021\037\340\246\273\302\225s\357\266\366i\206"
+	.ascii	"\307\224\326\331\336ODl.\337\275\333R\356\254\240\224\034SZ\315"
+	.ascii	"\275\225\357\340\314]\023B\324\0250\312\214\016\346\336\312_"
+	.ascii	"\265\377"
+	.string	"\212\301Mw\3145\023B\324\325~Z[\333\240\251\f\025\273\346\336\312!\017']\r4W|\362m^8w9t\343d'/4\270p\376\275\322#\330w(\375\337\035J\177\2314V^\241\264\303\rJ\277\244\377\313\267\307\244\206\220\"J\265\275\367\017pN\216\231\r\234o\233\313\374us\365N&(\327\215\007]{7]7?s\366n\372\271\027\203{1\310i^H\250\244\371\254\276\321\0325W\f\235\224\2504\277jn\335\005\242\220\355\341|\321\370P\375\270\302\343\355?0h\006$\254\f\347o@\377\327L^Zg\257m\256\314o\336/\342\203\353\361\354\255\266\367\336\340\243\246\205\t\007\347\367]2\377\201B-`\315\016\027O\371\303\323\244\005'\006\347\253\320\207\200\006\272A\351\023\2409\204\251cB\347\345\206\363\255\303\367\313\005\363[w\275\\\304\007\347y\332j{+o]\336\273\351^\f|\356\305"
+	.ascii	"\325b\244i-\315\377@\377\267\013\027\027[[N\256\374r\271[n\327"
+	.ascii	"\316\340C\243\355,\007\316\027\313\315r\227\032\256\226\337("
+	.ascii	"\227\356h\223r+\367\336?wo\210\023\026\316@W(}\001\264\b\366"
+	.ascii	"\276\032\322\373\367w5\244w\216\350\367\212\ba@\322p>\3454\250"
+	.ascii	"K\346z\b\211\203;\333\300\351\030\303\371\277R~\341\376\353v"
+	.ascii	"\247\3347\334\265\367\323\336;\303\251\006\316\266\303\371R\271"
+	.ascii	"U\356\362Z\256\025\340\223r\263\355\275\177~\266\364\365\220"
+	.ascii	"\303\371\030\350\245\275\367\276\327\222\252\327\222"
+	.ascii	"\376\356\n\245<7(\275Q\210~\245\004\245W[\312\355"
+	.string	"\266\367\3769\345\350\242\346\340\214oP\333eC\327\274\2445\341|\235\334'wy\331\376\013\345\256=C\351\332l{+{\316&-0q8s\270Bi\276A\351\257\362>M\373\203c\375\333!\375\371\373\373\373\273\035\322\3776\371/\223\253V\301)E\325\265\335\366VZ\370QjU\001\301\371\312+\224\352\033\224\376h\356\203\223A@M\374\033@p\341\327+\360)\261\241 \233\371\363\231\037E\341\277\212\343y\240\314\237\211\240\"\204i\321\345G\177\3161(\004N\"\350\003\316\026\377\231\364g\024\320\023n\325\177\255\376\213\205\3728\340\2777P\023\376\274\346\317l~\264\204\377\016Q\022~t\347\317\024\224@5\234aw\351\256\002\370\363\003\316\200\037\b\200\377\036 [\241$\262\f\240\320\177\023\220a|\003t\204\377\352\017\334\371\263\225\212\256#t\304\2176\340\317BP\006\374\350\002\376\374\002\025\001M\300\217\""
+	.ascii	"=\300\217\206\200~\360\243\036\240\035\374\250\b\224\350GC\374"
+	.ascii	"\331\003h\001~\224\203?\267x\235\377\376\277\234\377s\376\323"
+	.ascii	"\371\377\367\337\363G\007\360\243\035\376\357\375W\363\347\262"
+	.ascii	"w\360\003/0\342\375y\b\r\300y~\275\345\177\231\347\035\375\265"
+	.ascii	"\021\027Jj\222\314\377\236@5x\360\327x\177~\202\002\340\\\212"
+	.ascii	"\3362\0244\203\377\034C1\370s\bP\0161\320\t\336\344\320\013\376"
+	.ascii	"\214\005\265`H\305\377\r\326F\300;\210_\243\375y\004\264\202"
+	.ascii	"\377k\177\026A\372k:\177\376\202\036\370\353\271\227y^V\273B"
+	.ascii	"x\370\177\303\177\274\367\374:\311\237?\200R\360\347\030\023"
+	.ascii	"\034\f\336w~\315\367\037\357\370\327D~T\303\217f\370Q\241\037"
+	.ascii	"\r\372Q\013?\372\363\243<?\252\376(\372g\276?\273\3713\233?\237"
+	.ascii	"\3713\231?\337\3759\314\237\353\376\234\345\317s\177~\373s\225"
+	.ascii	"?O\371\263\224?\267\375y\355"
+	.string	"\317\312?\253\3759\355\317g\177V\362\347\262?\217\375Y\354\317G\376\\\344\317`\177\026\362g \177\376\361\347\256?\363\3703\327\237s\374y\353\317Z\177\266\361g\032\177\306\372\363\214?\313\3703\214?C\375Y\004\177~\361g\020\374Y\351\317.\376\354\201?'\377|\374s\213?\033\377|\364g\026\177.\372\363\212?\013\377\254\201?c\340\317\026\3703\005\376\254\342?\257\374\371\304\1779\3749\002\177F\341\317\017\370\363\t\177v\300\237M\3703\t\177.\361\337\374_\021\350\376o\371o\345\377\333\237G\370s\003\376\214\200?\203\360\347\017\376{\342\317\024\374y\350\317\031\376\274\363g\t\376\214\341?\336\377\r\376\263\314\177\026\371O\260\377T\372/\327\177u\3747\307\177Y\374\267\350\277\013\370\257\002\376\213\376\007\363\237\313\377\270\377p\377S\374g\373\257\366\037\004\377\277\374\017\372\373\373\373\373U\013\374\023l\340\317"
+	.string	"2\026\320\351\037;\314\302\360\341|\013\336\364\227\212Cu\312X\356\335\220\275\261<\300\3027\226\325\314a\362\230\327X\326\231\212\325\001\313\332XV3\235\223\326\271w[\273\211\311\003-xcY\315\274\314q\347\362\nh\3256\204\231\265\344"
+	.ascii	"\013\331XV3\207Q\231\264\220\215e5\303\2508\324\246\374D\013"
+	.ascii	"\r\225\206\312C\255\241n\251:\324.5\207\272C\365\241\332P\265"
+	.ascii	"\324\036*\227z\343.U\034*\324\3238\251\234\017\251[\313\332X"
+	.ascii	"VS\305\021\004\007S\305\201\216\251Tm;\230*\016\365\t\013\336"
+	.ascii	"XV\023+U\034\351\337u\323f\004+U\034yG\016BC\003-=M&;\210\005"
+	.ascii	"\371\026@\3213\324++m\244\fW\026#3T+\267}F\255\272j\225\246a"
+	.ascii	"\242\213\243N\371\314\321\232C\202\363-\330Re\2501\360[Y\f+\252"
+	.ascii	"\324\325\030<q\352\302\324\300\371}*\214<'qXp\376U\030"
+	.string	"j\224O\325\230\375C\215R\241\200~g\3500\301\371\026\314\320\267@J\337\002&\375\n\232\372\025\360\351W\220\247_A\027\375\247t\236\3269\326\342\300\316`\301\313U\017\234E\020=\245s\226\305\007\034\234_\301\025\255\225W(\275RU\364\335I\364\237\372iA\211\322\201s\366b\346f\237_\316\272:\346\231\224L\212&\345\222jI\315\244_R\273\264L\n&\315K\323\244Y\3220\351\230\364Mz\227\252I\267\244l\322\272\324K\272\227vI\361\3226\251\230\224.\355K\231\251\233tM\252w\227)_:\367\364J\212%\rK\215,\231S\2033r\204\231&\341;\227W\017XKK\345\314\222H\345\030\331\212\003\332r\217\331$J\343\360\034V\bf\313\f\225\243\262\323\271\274\212\200\027\027\346\336\033\311\330Y%D\223$\273\307\217\277\256 TL\257\224\357\024r\022\361\340\211\217#l\230'\217\377\364*\242"
+	.string	"7{\314\263\275\225=|L\200i\217y\226\036I\305\226$Qr9\275\270\331c\246|\3512\265\222\305a\t\326>\277<\235[\222\3541\233aL'\227\224\357\354rV9\227W\020p:\3034\242\307\234\221\263\320\260p\025\260'X{\314f\032\366\224/-\222\202uX\222\036A\262\334c\236^)\337\t\344\211\230\f\225a\240\271\331c6S\276\364m\t\323\036\263yz\245|g\220\271=f\363D\222\362\235V\316-M|\3541\2078\020\247\307T\"\237Oy\205R\237\263\033\224\276\0020\375\nv\350W`\245\277\341O\177\203_\225\236\033T\370\350\250\221\222NI\335\322(w\231RI\333\236>I\225\317P\352\304\326\360\334\027*)Y\352\344\336\271\345,`R*)\033\236\363\"\266\003\247\311\r\276`\376\206;\375\r_\3647\320\351ox\323\337"
+	.ascii	"E\003\335]\241\024S\245fO\235\3749G:\2266\301y\333\f\024\316"
+	.ascii	"jOj\232\\\23498\177\203Y\212\226\246\335e\312$]\222\231\244J"
+	.ascii	".\231{\347VB\355\215\311$=K\321\340\215\361\322<\261\330q\341"
+	.ascii	"\245\371\033\260\3647<\351S@G\247eDO\315\322:p\246\334p\376\351"
+	.ascii	"\323@\373\n\245\030\215>\005`t\246\240M\237\0024\235\2257(%\222"
+	.ascii	"\317"
+	.string	"\3200\213\202\363)(\242\377\247_\251\220\273L\207\2440\236\2572V:$\225J\203\234\313+\b\340\365`\246C\362V\032\025B\324\225\tx<\230\036\260\223\031xF\322\f\304\213\031\252\0358\237\202\034:\355J{\344-^9\304\272\322\251\224\013\0073\355Jw\344.\237'\345f\352\200i\217y\226z\245?R\037w\231v\245<\236kd\033\031\310\211)u>\0052\364'h\352O\360&\345\372\323\030\251\214T\007\356\372\362dK\016\347\034\3019N|Ip\376\004k\364;\230\241C\316J\006\036\025\215k9\227W:\212W\025S\255*\275\221\326H\265\322\255\024\307]\2466\322\253\247Xi\326Sj#\245\332Pl\034$Y\376\3255=\250<\306p\221\343\311\237\340\214\276]W(\305p\247?A\027\375\t\256\350OPE\177\0026\375\t\224\372\274\273B\251\b7(\375\004e\372\023|i\252\2376gv"
+	.ascii	"\301\231KH&\222\025\342\t\337\227\272\334\3057\226\325L\203D"
+	.ascii	"\0163\311\255\363\202\223CG\f&\332\227w\344 \347\362*\002A\244"
+	.ascii	"\230G\262X\034\261\275\225\\F\236\254\251\225\345%vL\264/\337"
+	.ascii	"\241868I\355\235\245\001\032\226\261\254\346\232?\3478\217`\037"
+	.ascii	"\367n\310nb"
+	.ascii	"\na\316k,\253\231\277\200\301\203c\356\275\263\262/\313\335-"
+	.ascii	"\t \033\313:\3138\310\306\262\232g\231\t^\030\"h\022/\021\320"
+	.ascii	"\310\306\262\316\240MTN\312\224\356\024\nE\203\276A\353\244"
+	.string	"N\350_\332\2042Q:\350\n\250\036\232\006\205\203\252A\367\3206\351\023\032\007\235\203\256A\375P7(\037\312\346.\321\276,\343Y+\337\370P\006\313E\260\214e5\317\320&!D]\001\255\360\2460s\026-\231\313\271\2742\301\253\313\324\030\272\304\213\0034\257\261\254f>\322\227\3072Y\207'Nb\272\240}\331K\356:\227W%\340q\311G\372\262Z~r.\257t\025'0\314\275\225}\250\0234/\204\250+\bx=\371Bs\240C\360\262\022\355\313W2\226S)g\202\227\027fV\366\345e\216\363\352\300dg\2563\254\316\007\177\246\201\366\241f\346\326\306.\21657OD\310\327\320\247\3212C?@\276\232\312\340|\re\364\023\024\312\251\024+\301\311\212)\006%\203\216\271K\024\357(\036\272\206n\t!\352J\002NU\314\2757\212\207\336\275.D\0229aY4x\360\220\243\f\351\322C\347k"
+	.ascii	"\323\307S\3424\334\273!\r\030\253\262\226\005\215\211nA\331P"
+	.ascii	"\270\rNR(p\2612w-?\334\260\244]\351p\357\334J\310\251\021\241"
+	.ascii	"[P-\327r\344l\013*\247!%\022\366\025\246\211\202A\355P.h\035"
+	.ascii	"\352\005\375\202\206A\273\334%\272\005\245C\243\2645\345\\\310"
+	.ascii	"\037*\243?\024F\177\210N\177\bN\177\250M\177\310\211\376\220"
+	.ascii	"\022\375\241\"oC\230\251\315\230\0318\177H\007\025\264\312]\242"
+	.ascii	"V\320(V\332P76bV\320)\250\333\0056i\376\262<\234pj\336\264\245"
+	.ascii	"\371\031\274\350\037u\223\262S\247\311\216:R\320(>N\220P\001"
+	.ascii	"\301\371\031\240\350g`\242\237\241L?\203\021\375\243\313\243"
+	.ascii	"P~\335p \003:%\306\027\0308\243J\242\243K\250!TY8op\203\322g"
+	.ascii	"\020\242\237\301\007\252\2264\323\363\201\3633L1I;\301\230h\304"
+	.ascii	"\320\216\2461\251\251b&\303\223\031\252\244\fhfc\312\032=\263"
+	.ascii	"2`\236\032\234\037\331\321\262\263\217\207\020#E\236l\331\210"
+	.ascii	"3\203\212\33529\022\274\351\337%\212\004=\242>\301\201\022\006"
+	.ascii	"5r\364\310e\242\207\267\002\316h\030ZD\213\315`\202*\222\247"
+	.ascii	"\270|\251\223\003\f\350\246\214\335\020\260 I\340\230\340|\t"
+	.ascii	"\236h\036\247\224'4T\310]\242_\250\216\241\016\320/\224\013\r"
+	.ascii	"\3423\345\n\337\026\317\216\001g.\347\037\r\202\002\261\262b"
+	.ascii	"J\341\214z\001\353j\330\350\202\363%\270\322?\352\343.\321\037"
+	.ascii	"z\035|\220e\341\374>\264\353?\020\177\225i\023\007\347\037\355"
+	.ascii	":\332\343jK\301\2013\017=\2541Pp\276P\035\275\003\325\201}4\221"
+	.ascii	"\301\302\371Br\364\205\320\350\013\221\321[i\327\r&T8_\210\213"
+	.ascii	"~\007jr\232\24758\261\275w.\223\323x\200\266\227\227\245Y\003"
+	.ascii	"\205\201R\375\240\201\316@\257\320,T\013\275\201b\2416\356\022"
+	.ascii	"\255\201V=\207\311v_h\r\324\312\216\211\326\310dn\235\033\r\230"
+	.ascii	"\214\345ei\326\310zh\324\275\333Rn\246\rK\366\362\2624\361\024"
+	.ascii	"^\036\343\303dao <\344\276jd1yL\bLz\366\2000\311.\344\013Y\321"
+	.ascii	"\027R\352\037\245::UB\233\035q8\313\bN\251z\262\304\371Be\032"
+	.ascii	"\215\201J\245\221\261\365p\276\320\020}! \372?\352\204B\241O"
+	.ascii	"w\211F\275\311~L\320\250\334D\231\356\335\026\320\336^gbQ\271"
+	.ascii	"M\346;\225bj\024<'\314\275\267\006\017\036<\2345\322\206\300"
+	.ascii	"\321\031e\312pn\235\006f{yY\232hS\376C\367]\242L\271\316\363"
+	.ascii	"\232\314\006e\312t\246\326\2140Q\246\034'\317\371\321\301lL^"
+	.ascii	"\026"
+	.string	"\017\230\f\327\2325:_H\207\276\220\r\375\273<\233,\347zauZMp\276\320\225\276P\f}\ft\3641\300\321\331/3\323\304\366V\256p\227\331/\367\2356\332\256\374\310\371\030\230\372\030\326\354\335e\346\313n.\342\003\265\314\227\367<Xr%/K\363\262Qc\306#\347c`\323\307\240\246\217\201L\037\003\021}\225W(\035\272A\3511\374\320\031\315V\025\235\022\347c\310\322\331L\316;\233\rNR\273\311\007\007}MO\2564\317\334e6\363\241!|f\207\332\230\234\037\264F?\250\214~P\030\375 .\372\317c\260\026\306\003C\345\204\363\203\256\350\007\301iT\316M?\350\211\276WK\364\355\272Ai\346\222\267\360\310\315\211\322\312t\227\310\026&\"8?\b\211~\020\227\276b7(\305\362\3479<\345n\271jV\226\345\025\234\037\204\245\323\033\224>\bJ\303\375\320\330!E\n\347_`\352w"
+	.string	"%\267!a\346*\371\355.\263\225\034%[\311R2\225{\347\266\233hh\260B\223\022\256!\017=T\232r\264\322\354\226\247\374L\031\201\0216\346v\341K\377B\326Zf\303Ym`1p\376\205\250\265?}\013k\364U\336\240\264Ivr\361\374\342\304"
+	.ascii	"\323\004\013ZN;\225p]\306\264\241\241\231e%;^e\246\210\341|\013"
+	.ascii	"af\026z\350;\237\035\030q^Up\276\005\033\372\026`\350\003\305"
+	.ascii	"\321\0072\243\257\334\rJ\017\264%\207e-0A\216\340|\2408}\240"
+	.ascii	"e\036\362sw\204\016\016\347\003\215\351\374\025\004\310-\203"
+	.ascii	"zR\206\363\201\260\364\377\374\343.\263W\346\341\225{d\037\367"
+	.ascii	"\316mo,\016\320|\374\3255\367\336C\036\256\216/Nv\331\307s\027"
+	.ascii	"\226C\223e\206s\327\343\260\235\033\036M\234\377\363F\377\347"
+	.ascii	"N\377gN\337;\245\306\333L\377\307\210\266\260u\203\322|w\205"
+	.ascii	"\322[\271A)\276\272A\351\177|h\t\224W(\305gnP\252\212e\253\\"
+	.ascii	"\345\246\234\223\302\231\352\024S\246c\013\316\377\271\241\363"
+	.ascii	"T\226\221\246\265q\272\302\371?U\372?[\007\257\324\350\373\200"
+	.ascii	"\321A\037)\331)7\245qqO\256p\316L\032v\314\374\330\002\205\363"
+	.ascii	"}\310\364I\347DsR\271wn\231K\223\271\367>\351\234iN&\2206'\235"
+	.ascii	"3\314y\246\t\316\234\263N\336\347\337]\236tN7'\235s\357\224\343"
+	.ascii	"\363\244\3344\202H|\3541\233\032<\360(9\323V\025\314q\254\210"
+	.ascii	"\211\255\200\363}\250\364\357\2241^\324\370\272\210\331q\351"
+	.ascii	"\213\203s6\317\025N\277\273<\373\3167\277bN0V\366\336;M\224v"
+	.ascii	"[\202\371>[\277\007\216~O\032\375\036:\335f(\0053NnP\031\323"
+	.ascii	"Dl\315y\247\246w\262\271\313s\315\251\306\r\210\346\343,*\315"
+	.ascii	"\357q\242\337\203D\277g\2076\263\0238\277\203\272\240U\320*8"
+	.ascii	"\343B\3313\204\322\252\322\3201\251\276\314p\016\316HB\346EE"
+	.ascii	"%F\214 \325P\327i\006\315\224V\020\212\211\232\214\340\324\203"
+	.ascii	"Tnt\310\326p\016\312\320\\\272\013\224\031:\352\376\003ydda\341"
+	.ascii	"\201\363;`\022\204\021\204\341\242\352+\315\253\f\316\031\316"
+	.ascii	"\357@\254\257/\b5\324\305\344\247\372Y\245\321i=)^\316\202O\017"
+	.ascii	"B\341+bT\330p\016\356\240\323\f.|M\234\203ME\037K\310\340|\021"
+	.ascii	"r\202L@:\300?\247%\026\"8\003\353\230\315\325Qe\301\371\"\310"
+	.ascii	"h \034\340\03479+8\234\201r\322\210\020!\213\213\3634\3406S\326"
+	.ascii	"l\212%\311\262\2063p\205\247\275*Zp\276\b4\375"
+	.ascii	"\273\004\372i\245\234Z\237\037\316\0271\204\217/\313j\254,C\271"
+	.ascii	"\202\005mN\2336@7\301,\2528W\316\264\030y=\230\007\272y\223&"
+	.ascii	"\r\220\315\231)\255f\034=5"
+	.string	"\031k\016d\223\327\f\"\007g\240\032\315\205\243\211\b\023Q\031\r\314\003\346\001\317\344H\271\254\216\344h\336\2722_\244\314\034x\006\317\371T\331b\204\rQ\032p\fp\f\220L\r+\2608\315'q\3064\301;\220LO_\333\235\023\"*}\367; \330\205b\201\325W\331\226\372\345E\345\205\363Ct\t\023F\255Q\225V\007\353@\263\202\034\316\017\321\204\216\016XG\303\257y\366\003\306\252\313\362\313\201u*\224\02095p\006z\271d\224\364\305\221\003vij\263bv\341\202\202\224.|S<Tj\306\304\001n\321L\032N3\032uQ8?\004\031\026,\300,k\246\264\232\025\270\021\204LoL\026\232\215\363C\334\210\213\003\316\r\351\335\304\213\007\223\247H\036\022&\240\334\201s\300:uKr<D\325\333\233\223\252\264:g(\226\025zp\251S\245\nP\306V\325_\331\231\235\027:\312.S\246"
+	.string	"e\fu1\371\245rUiu\232i\22679z8\037D\024)Rt\235/\275)\255&:Uc*\007\316\007\361\325\326\246\222\ru1\271\3510\247*\316\331\r2\264\0308\037\004\024\024(\300\265\020w\303\220\362%G\002mp\314\301y\355\276\375\335iY\242\306\211\023\240r\250\3534\023gJ\353\f\273\305"
+	.string	"\253\361\344@\245\212:\252\246955\240\f'b7\b\225Y\023\234\377\201IZ\332\233\030O\233\2245dp\376\207\257\2633\240\214\013e\3178\200\230\2607g?L\232\352j\340\374\0174\224(\2719\252\332x\351Q\006\005\313KYYR\225\336\225\312c.N\r\347\027 \311\330\230\222\2524tg{ouX\352z\233\202\363\013\360$&\346SVe\306\211\217\f<\266\2612G\2160\200)\354\315\031\360\316\311\013\r\234\317A\225\"E\f0\027\366&\335\021\245\345\017\347s\240d\310\020 \230\006\255\2521M\375\007\007\347\004$r \030\336\223\2743\034P\t\021r\325\fu1\365\355\320Q\201\3215\323-\27419\352"
+	.ascii	"\0012V\365"
+	.string	"$\307\316\016\362w\006\313\217\0377\357\002)\235\360\216\210\005\233\310\264\230\254uuyA\331\244\374\304\230\361\340\221f\251J\253s\266&f\310\033\316'\300\025\220\213\353\346]({\306\225\3627\245u^\341]\325\301\371\004`\322?0\307\357\022\230C\317\021=\355&\264\035'T`t\315\034pp\214\340|\017{\372\007n\375.\201[:n\b\312fR\343\326\374\232[]\232r\340|\017z\372W\231~\227*\223~;\245\2726\226\bX\260\366\230?x=\270\254\330\370]\002mh7\007tm\032\034\310\226aop\231/T\330\340|\017]\364\017\244\361\273\004\322\320m\016\350\332Y\"`\331zN\232{o\021 8\227em\n\347{h\303\302\262 K\307\360\342\201\211\376E\273@\252\273\004R\001g\200I\220\326\303\244$k\016p\306\017\254\002Z\341'\236\363\n\216#q8\213\330W(M=\204\001c"
+	.string	"c"
+	.string	"e\\?\n\336\244s5\366\322\340\f\224\341a\207\376\2010\356\022\b\0037\271X{7mIP\266E"
+	.string	"\036\252M\346\004\347{\270\241\201\033\270\201P8(\340\302\325!\0231[\343\304t \024\360i'K\0256Dp\376\201O\007:E\225\375\275a&\031\256GV\031`S_\007\031Q\374\234p\276\207\031tNG\327\001\356\275\367\326f\352\333\271\262\325!\310\254\302\206\251\216\037\035\21798\177"
+	.string	"o\232:NS\313\371\373\256\345\\\017\035Sv\204\n\316p\340\004\265\006\200\247?\200*o\264\337\233\276>\240\355\204f\206X\023\375\001\fa\352=\246\0337M?{\003\300\241?"
+	.string	"'=\275[7\324\305\344&\304^\325W\232O\024*k4p~\2072i\364\23247/\335\373*\273f\\\355\255\253\016j\324\334<\315\024\244\244\303\026\375\016P\364\23135:\200\351_\347-u\336\345r\364i\0039\023\333{\213"
+	.string	"=I\322\332\234p~\007 d\310p\330\253\372Q\226\351\264\311#\202\363;l\375k1\032\214\036s\341\364N\262w\323\331\016\363\212"
+	.string	"\337 O\177\003*\372\032\314\325vKm\247\327\200{\377"
+	.string	"\333qr\245$\3007\200\242\177\365ZZW\267SG\345\307\325\334 \211\376\265\227\245\366\202\265\206\272\230\3660\270\242\212s\245\2717\027\002\374\370)\331\021\206\3637\200\342\302%\030\206\217\216\356\346\351\2757\223r\317\b\332\242\362\343:\333[W\035."
+	.string	"0\372\372\212\306r\235%\313\315;\320\336[}C\345\307\325\334[5:\\"
+	.ascii	"M\364\377{\374\247\273\351j\357\235\205*\367\225\023O\372\337"
+	.ascii	"_\364\336\016\177\317=o\006\377\363\337\001\034\007\366\306\221"
+	.ascii	"\307\334{\3377\232,\256I\007\207\235a\357\215%\365\264\231\256"
+	.ascii	"\024\333\017,)\266\037W\026\244\352~`\355'\254\263\247\037]W"
+	.ascii	"\352\351\307\325"
+	.string	"\325\323f\262\260\331~\\I\355\037X@\233m\337\220bkb\272RO\033k\357\037\033hK5am6\345\225\005)\266\037WRl?\260,H\2615aI\355\256\r$\245\004r\265\225?\230,L\2615am\266.,\013\233\355\007\226\224\231\033K\rye^\\a\236\310\252\\&\251\247mU\305\325t\005t'\245\354\332g\366\276nQ\373j\337\355\235\301\336\\]Wg\232n\\9\247;+'+M]W\271\367\326P\345\344\325\265\237\356\230\356\276\223*\353\332\273\314\351hW\355\275\267\007L\312\273M\344\3361\001\341\332TQ{O\260\225{W\355\315t\367\335\336\233i\357\255^q)\367\316\001$%VU\265\367\326P\325\346b\232\213\332\033\273\245\221\303\222b\363\352\"\232\213\302&\266a(\231\256\024U\327\026\333g~\\i6\246\345\246\332{_>-\206Ec\017g-7#\214\030\027\316\027"
+	.string	"\f\255\341\264\2641\221\340|\0010imEj\352\212\026\316\017@\034\255T\333[\351\223*)\002c\016g\275$\311\227\034\234\225Tr\324}\341\254\245\234_\342|\304\341\374"
+	.string	"\244Q\356\310\361\230RC\263\331q\tB\205\363\003\360Ek(O\302\314\272\346\324\324\264r\250\213\251/\315A\225\246\256y\335\230y\361{r\255|\335\236\230\274\0378k'\007hs\327\003g\335D\027I\343\250\270\374\315\375\007\246af\314\211\203\363\003\340D\237\235\351\264!\275\233\254Q1\367\336\352\320\023\203\215\f6\234u\332\317\2348d\232t\0214:f\242p~"
+	.string	"\212\350%\332\214K\214\314\337\365\216\357\320f?\2376\217\035\251\026U\232\272\346\336[\035.\221*iM\234\265\231.s\312\261\344\006\316\232\314\347\r\252\r\034\234\037"
+	.string	"\031Z\217}\367\354\004\221sk\302Y\037\321bh7\252\b\321HN*A\350\340\341|\r\342hmD\027A\222\344\315\ng\375\245\213"
+	.ascii	"\345\350\204\001+\022\206\366\345\r\027\316`\035\360R\003\006"
+	.ascii	"\347k\240\247\211\350!:\213\314\226\302\371\032\214\321\357\323"
+	.ascii	"BT\2725tkB\202\b\0212\305\rg\r\304\212N\324\026\234\257\001\234"
+	.ascii	"\376]j\257\037&x\310\361i\037\327?\320@\305\240\241\273\362\322"
+	.ascii	"\310\271\353\352\001\025\307\013\033\316"
+	.string	"\272\207\346\301#H\01638_\203\245\276\006F\264\016\003l<1\234\257\001\020\235C\211ak\211\325\026U\037\231)^p\376\265\326\357Rk\351\032'\356\216\021\267F\204\271\367\026\001v\276\310\231\362\005\347k\020C\377\332\206\256A\005\r\013\033\2345\r|\375Vp\302\205\363\001\300\247\177\247\\\251\177\232\352T\312i8/\036L}\245\232Q\345xq@\206\305\257\331\314\322X\332JW\351\031w\251\257\324:V\364\225J\207\314\313\257\331\334dk~M\"}\245\316\321\301\354\031\322\345\355\nO\236b\373\222Ge\343|"
+	.string	"\330\351\030Z\352.\265\f\315\224F\3038\225r:\316\253\212\251e\250g\364\366\242\022\013\356\201\345Hs\324W\227Y\017\234\017"
+	.string	")\372\227n\315\335\342$%\246\241\264\323]\352'\335\304\246\237\362\f>\277\346\231\207\023\016\033\030f\232\017"
+	.string	"2}"
+	.string	"\364\320\373n\271];\303\016\215;48p>"
+	.ascii	"\250\3643\360\323\317@\215~\006a\342h\340\241\022\325\225\346"
+	.ascii	"\266\202\332\274K\025\216\212\346\314\345r\357\2068 \355\013"
+	.ascii	"\023\216"
+	.string	"\232F\365\273wC\034P\247.\233\365=\351Ks\037\346\221\321l\202\36338\242\377\253|\252\033uOe\336\245\372F\325\303\312\275\335\332\304\321\255y\023Ss\267\300\211\251oT6w\313\007[Tcr1~\360p\023\314\307@\216>\006v\372\030x\321\307 \213>\006r\372\030L\321\307\200L\037\003$\372\030\3441\251\276\370p>\346\372\211T;5\216\310\022UY\2049\247b\3511%\246&\t!\352\n\b\243\314\021\2731UI\020#L7\025\016\214\031F\375\242\216Q\305\250d\324:\365N-\243zQ\361T0w\251\332\251gW\271\250]\216\\2mg\252\235\232E\335\322\306c\251J\201\nS\355T$gS\006\t\323N\225\303Z\033\234\366\346\261#(G\005F\327\334[\251\265d\304\311\033\312\331\355\006\245ZT:\23701\275.\234\217A\224\326\302A\216V\257\350\361\020\342\005\347s\320\323\347"
+	.ascii	"F\237\203\234>\007(\352[\272\302\2271w8\237\003\022\325\212Z"
+	.ascii	"\005\345:Be\247R\271Z\305\207\017\007\236\037\316\352\224\314"
+	.ascii	"eEF\024\316\357\303Z\377\201\250\227\337\2328\234\317\301\253"
+	.ascii	"M\215\302\306\263\274\223\363\207\3639\\\265\251lA.2\264H\251"
+	.ascii	"kW\331\260V\235.)Pn\234\227&\"P\320\320\334\321Y\341|\016[;Q"
+	.ascii	"\2374\t\272\371\372Q\004\347_\260\306I\023\037\254*i\342\324"
+	.ascii	"\2566\321nnzUL\376\003O+sl\316\230\244\t\225\251b*7"
+	.string	"\223$+(AS\317\366\260\320m\234\177\301\027\375\013\250\350_Ur\325lk\211\023\0378\253e\370)k\f\f\234\177\301\022\375\277\357.U22y\r\335\337\034\234\177\301\227\376\325$\330\307\r(9Up\376\005:\364/\300\322\267\340O\377\252\021\265\210ZD\r\373\302:\363\006\016\316M\365+\225k#\246~\345;\325K}\303\363k~Q\277\322\025h\3705\207\250BT0\225\310]\252_*\220\347.j\220\264\251~\245p\3328\3715\233{\357\036;&\226\251`\016\356+\224>m\361xB\317\217>$\225\330\343\232\204\204$a4L\301\026)@&_\230`\301\210L\266G$\211\026\354PE\220\005\326\247h$\006\205\253p\330\016K$\261&\216\310\b\254\355P\3118tAB\022\213\224A\202\025C\022\213$\224\304\"\001\375\350\003\313\016\223\220\220\304\036\265\005;T\261\016W \223\303\025\301\037}"
+	.string	"\261\201=ae\001\364\243\017\030"
+	.string	"\261F#\362\004\005D\342\020\270\266C\024\024"
+	.string	"\331\265\bib\t\0051\t\202\310\202%\242"
+	.string	"\032qaE*\252 \256K$\264`\207*\326$\362ht\202\005?\372\260\"\025[\026\231$\026\221R\023\226\326\b\264k\n\r+\361\204\020\313\"%\207\306\021A?\372\220\204TlY\022\210\023\374\350\303\022r\005\bd\0219\002\262x,&\371\374\350\003\322\220(\254\240\210\230\364\371\321\0076\311\b\004\262\210\201M2\002\222\320@\201\037}"
+	.string	"AdqDl\207Il\261\350\247\005q=\"\261\224\354\371\321\007%\244\"\210\241v\204\022R\321B\022\022\211BQ\361\304\217\321\261\330\363\243\017k\022I\004AdaB\321\020\211\202\017\2218<1\004\001\331\266x<\201E[\260C\025\355j\244\262\354\2324B&O\034O\230"
+	.string	"hh\302hh\002\203\01729\034\341\350C\321H\004Q4\022\213\220&\212F\242\332\023\342C\233\034&}P\321\202\035\266\030Fd@\177\364\301Hi\305Z\004\242\310XTZQ\004\324\020\342\003\233\3020I\201z,\016M,\241 \n\223 \210,X\243\241\261\004\243c\021)9\334\261\260\026)\265\305\3268bm\207F%\242qH\342\022\034\213C\023'\026\223\353q5\322\367"
+	.string	"\204\002\200\020\302\222\372\020\020\020\002\001!\322\207\200"
+	.ascii	"\"\"\004\200@\244\017\002\321\331\266m\273.%\201H\3035\331\246"
+	.ascii	"\270\360\302\230\264\242\260\360\243\017I,\022\210$\026i\025"
+	.ascii	"&\261H;\2550\211l\223\212I\"\273\226Hb\221~ZV\330\256-\210\303"
+	.ascii	"\023I,R\313\"O$\261HA\254\220\247\3508DBB\222(!\211E\nZ\205E"
+	.ascii	"' \255-\373\"\305\004m\313b-\022\266\031X%\341\021\261-\236("
+	.ascii	":\2160\032\221\311\240\013\311\265]\221\220B\0378\022\262H2\266"
+	.ascii	"\255\220\305Z\244\341G\037\330\242\265]\215IHH\022D\f,\005F#"
+	.ascii	"2\231\217\210m1\tUa\370\342dW%\343\320E\252$d\221\212I\025l\t"
+	.ascii	"!\025\206\311\023\231\\1@$\016\223 \226\222A\2550\270&\275Pa"
+	.ascii	"\001\024)x\220\311\023KI \236\265\035\2428b\327$\213\025\305"
+	.ascii	"R\262'\331\2368\2520D\221\334I\266'\224\332a\233\"\331\236\b"
+	.ascii	"b\205+R\261=*\241XJ\002\035K`\331\225\210L\236 &\201\332\325"
+	.ascii	"\004b\362\302\261\204\344\317\260\035\2260\256\307\343\360\210"
+	.ascii	"\2703l\207%V\244a\222\005\020i\230,\201\210\242e\207F\013?\372"
+	.ascii	"\260\032W\"q\230\001+$\022\207hK\\\223\302 \2218\002\003\221"
+	.ascii	"8\324&\020\t\211\304a\232\022\211C\215L\2760\312D\342\220g-B"
+	.ascii	"\222p\261&y\222\253\321Xd\221\222(1\202H\034"
+	.string	"\246+\361(\201\226\035\256(\264#\212R0\256D\342\b\266\250\201\025\"\223/\214R\226\307gE*\266IH$\n>,H\224\030\241\333 +4:\026Q\024\r\327\243l,\016\333\314\036\225\222\311\325\005R\033\035\213(\202\255\320\350XL\n/ \026\rOV\310\223\262\352N\321N\321j\\1<\222\300\036U@\026e j\215\216\305cq\210\264\242`W#\361\005\361\207\025\222@&_\030Y@Rb\317\366(D:Y\241\213\265\250eU\023&R\024\031\221B\2444\205\n\353Q\210\224&\207.\316\025\305\037}\b\200Q\211\037\241\372\243\017-Q)\331\262\"X\341\322\332*!YhAD\032\205\302\264=*!\211B\241\232\\\217* \205B\225M\256\254\322Q(\324E\307b\013\2410e\217\305$V(T\217\310\"[4\256B!\260\025\266l\321\b\364\243\017\354\232\364\242-@\321\232\034\036\261\005"
+	.string	"\301\266\305\025 \224\216F\005XR:\026\215\005\360"
+	.ascii	"\004!\b!,\201X\213\224\214"
+	.ascii	"\304c\021D\222U\002q\200vi=\032\207\307\344\332\036\213\302\242"
+	.ascii	"\341\232<j\223\204\302\f.\326d\222P\230\266l\321(\024\246\303"
+	.ascii	"vX$\024\246\353\007\212\254P\230\266 \"\215\271-\036Oh\213\307"
+	.ascii	"\242\320\261\204\242\341\232L\223\355\t\342Q\251\204a;,Q4\\Q"
+	.ascii	" \223/L\320p,\241\347G\037\212\355\322\232\\\215E\307\241\003"
+	.ascii	"\212\355\322\032\324\036Y`VH\\Q\220(\266K\253\205b\273\264\346"
+	.ascii	"\326(9\242\005q\270\302h\034\022w\330vi\335i\205+\261\350b-\301"
+	.ascii	"*\255\330a\225V\234\254\260\230\224\242]Zu\321\272&\261h+"
+	.string	"\224\300\t\371X<qd\211\351jTD\202\321\261X4\\\215;\305$\366d\205$D\234\320.\255\232(\242x\376\350\003\253\264B\003+4\321.\255=,\273&\213\212\206\352\352bhL\241\224\204\244\225\204k\322\013\025\254\322\n\340\222\n\026k\2115\351\205\212\266x<A8\302D\211\237\037}@A\305\t)@\264\253Qr\330rh\331\265\315K(\332\342\261\230\2160Qbe\225R\026J#,\265(\013\245\021\226\222\250\213\265\350\\\215C\"\213\"\223+\006\220\311\027F\232D\211\021*\253\204,\272X\223'.\2500DA\242DpM*\265\303\344\232\204\264\266;\355\217>(%!\t\221\311\027FD\342\020\004\233\\]\024\223E\003X\205(B|\020\002\004\245$\244 #\222]\223AV\210a\025*%!\355\244\255Q\211]Q\254%\224\222\220.\254\302\243Q\3218\024\372\034\215\212\306\021\302\0178"
+	.string	"\002k;D\261\n{N8\221b-B\232xQ4,\002&Y\026\302#\243\342\221\220E\222\221\207E\222Q\370\201\243\026\":\020\036]`\223\220\311\022\311\265\250\350\242XB)\t\351\247\025\032\rU \213\252\321PE\261]\"\241=\236\240\224\204\324\263\n}\326\344P\205\242$O\373\243\017\354Q;DB\272\254P\230\304\"h\251\230l\207&Zd\322\007\231|a\004d\264\242\030\266\303\022D\3420\350B\025\261\323\262B\027k\t\027k\211\024*\f\223<\030\214=B\355\217> \223/\214&\350`GD\007m\222\217\222\020\005d\362\205QP\313\nw\210\332$\037\013m\213\313\nwP\242\265\035\266l\272\266\3036E\233\344#\202e\207I* \215>DD\311\366\004P\313\n\365\261\204\027\306\244\244\021A\355\217>\260"
+	.ascii	"qD\"!!\211\024\264GF\305U\205\224\025\026\r\225<P\\\341\023b"
+	.ascii	"\005&Z\201E\254\300DC,b\210\211\226\260\210%L\364\002\213x\201"
+	.ascii	"E\034\021[\344\221\347\003\016X\333!\212\325\230\2044LA$\016"
+	.ascii	"\177V6\005\244\nd\362\205\021p-B\232X[d\362\204\004\330\241\003"
+	.ascii	"\220\311\027F\032\214\216E#\023\214C\245\022+\253\204\241\025"
+	.ascii	".\255E\307\242\220\025\266GFE#\213\flqi\204\221\322\212\265\004"
+	.ascii	"2\371\302\250'\271\266\306b"
+	.string	"\t<\307\342\322\320\004\020\231\264D\302\352\"\251D\202E\022\n\307\027E?-\330\241\t\266\2704B\005\244\221Eru\201\004\372\321\007\020l\022\311\036W\266\002V\2704<\026\221.\250 A{\\\3315\231\324\"\217\355p\205\013\rD\027\306\236Uxa\025bX\211I%d\212\344\332\256&\332\343\232L*\021/\274h\213\304a\322p\305O;\034\201\002+\253\324\303\266\311\3258\202\304\312*aX\215\206\355q%&\327\023Gd\261MBRb\217H\342\006\266\310\256\311\265e_\034\265\303\025.|V\243akD\2720\032W\242\321\250\304\242\035\256p\021\324\036\225\220$\214\306\225\304\213\344\332\266\303\021Vb\022\311B\350\305\320\230\304\0261\264\303\025\305\036\243c\361\230\034V@\002\343\220Xl\213I\022Id\tGd\261\035&\225J\264\303\025.2\260HB\301h\230\242\035\256p\001\304\n}\332\037}"
+	.ascii	"\201,fx\221lW\244\325\270\266\031X\341\211\013\255PD\007-\330"
+	.ascii	"\241\211#\262\330\022\217J,x\222k\221E\261=\256E\305`\022\213"
+	.ascii	"\304&\031YXZ\213\216'\254\3550Y\2444\\!\\B\256hA\034\032WH\300"
+	.ascii	"\032\025Y\034\221$\332$2i\347\003G\302\265\035&\205k;,JR\022"
+	.ascii	"\032\207\305\344\312\n%\327\2268L\016\217\210\302\026\211\\\261"
+	.ascii	"&\201\332\224M\241\035\301\266\3036\005\020ix|Q\364\243\244\331"
+	.ascii	"\325hD\013v\330\372\260)\264\354\332\016Qh\301\016[!6\205vD\321"
+	.ascii	"j\034\036\215\212)Zvh\004jG\224h\331\241\261\207M\241\035\261"
+	.ascii	"\036\213\306\242\341Z\304\243\244\026Y\344\211\244\341z\304\263"
+	.ascii	"\032\211/H\254F\303\344\352bD\321\332\016\223\212\304b{\034\016"
+	.ascii	"\261)\034\265!\210\220\224R\030\035\213.\220H\033\226\206H\027"
+	.ascii	"T\034\221\305V\211\270.\221`\034\266\310\026C+\\[\245\025\305"
+	.ascii	"d\333\016\205-\330a\013\364\243\017\311\325\250T\264\036\021"
+	.ascii	"Y\f\216LZ\223 Z$2\tb\247\025\206\320\036\213\351\213\266\230"
+	.ascii	"D\026\223'\210\305v\330\262>+\3220\002\311\341\0211\257H\303"
+	.ascii	"\b\264`\207*V(\261;\304\365\210\bl\205l\n+R\261\325\304\243R"
+	.ascii	"\t-\330a\253\331\024\212\220\305\344z\242hM\026\331\265\350\307"
+	.ascii	"\210D\216 D[!\bD\355\261\250\266\302ak\\K\254H\305v\347DD$8\244"
+	.ascii	"\020\001\0234\361\003\333\202\035\266 \210,@\034\213C$\020\304"
+	.ascii	"$\013\342\203\320\377 \\\020jG\tw\207\367v\346B\275\245\261\242"
+	.ascii	"\347v\212\244\211\325U\211\013j!\271\353BE\277e\031fzmS\2023"
+	.ascii	"F\330\243\n\342\246\335\326\214dIa\363\243\225\227\244M\224\267"
+	.ascii	"eI\261\211\322F\205&g\326\3046c\007\207\032\227\333\032V\313"
+	.string	"|o\262\274\201\022\\.Y\002\211\3029\270\374\357\334\311\343)\007\341\221\246\207\362I\356#\003\206\206\223\007\237\374\270\rK)\003\2677\004\347<G\364\240\023\334D\210\024X\023 Xf[\003\207\216\032\223<!N\302\340\034db\005\330\243\206\2161ih<^Wh\202\234=\210\366\247e8\315\227.xrp\016.!z\360L\377\375a!\202\263\317\rJ\377\240\222\240Y\016\037Ad\004\315\316\006\204\033\002\306,#\023b%)\203s\220\314\r\007\350\030\231\262\033Kb&J\335\024$\017&\371\203b\270\n\017\034\2306!8\2437(\275P\210\036D\222\201\370\315\030;bd\007\352\252\016*\354A#\177\260\b\346J\377\220\274\241\3029x\203\322\340\020\242\007\303v\236jP\001\013\022A\227R~T\276\036$\362\007\207\340\275\353\206\003`6h\330\341\f\274A\351eB\364\340\327\017^\\\337\021!d\202"
+	.string	"\335\234\351\nB\005\004\250\364\201\362\007\326\364\002\256Y`\f\017\354\207Jv\317"
+	.string	"A\233\362\241\353\030I\203\203\325\005\234\323>\204\304y\352\001\314\022\244s$L\223\307\327\256\200i:\t\356\250#\302\024\347\213K\313\t\352"
+	.ascii	"\312\230\202c\210\027\316A\034A\034@\031s\246\264\230_\252l\234"
+	.ascii	"\357\201\\\360F\360Fp\306P\027S\237\332\264\302\313\322Ly@]\201"
+	.ascii	"\302\371\036h\005m\004mL\331\232\322j\"\251;\023\005\347{\320"
+	.ascii	"\024\244\021\244\021\234!\224U5\246\331\334\221\022\243r\003"
+	.ascii	"\347w\300\fb\005\261\206\366\252\364\256\232\352\034\23369\002"
+	.ascii	"\211\r\250\264\204NS\310"
+	.string	"\007\205Y$\t\265 \3109\351\220Rd\334"
+	.string	"s\025"
+	.string	"@HP$\023\313U\311{\003\024\200\017e\322\204`P\240LbP\"\245f\004\"%  \002\202\002\3216\206U\373\225\204^\n\020\311(\2612\207\f<\302\222NCr\260.\371\023j\211\345\002\230J\257\214\215\334\215\331*\003l\\#\217\326\203\025\322\273\033\t3\271\\\t~\202\367\006\237\201\3272\245\331\232\005\312$\036\b-\210\236z\236_\323\001\231\365\302\206\347\254\342\366&\355\\\364\231i\004\201\3126\314\260\3464\270\200\256@\274\211\361(*\224\226o)+{"
+	.string	"w\262O\375Z\215%Lm\246\027I\310\347\234\202*Vk\326V\363i\264\371\216\247\304\034\346,\007\360S\b\277\306\343-\256\277\177\277$X94\2479\304\213o|A\237:7\257S^\016\017Z;'\314V\022[\330G\030H'_\275"
+	.string	"\246\234\204Z\236\216\300\260\344\247\034\214\207\262\225N\207\350\224\220,t\201+\325\300\210\200k\013\303^\301#\tO\273\361\274J\316\211\214:\233\207\321S\242L\333\027\025\376k\200O~DB$@_\263en\226\240\202\310\371\306\231\303m\234\0340{\032Qx\230:Y\243U(\217F\323<\311o\023\322\247\r5L\364\215`\322\254\023\032Rfh\374R\337\367\205\236\234\024S\360-\355\372W\350,\222\321\210\013\ty\243\t\304\266\233\366A\272T\342\217\312\256jl\341\374\fz\364\277"
+	.string	"\331\364]\364\347[\236\342\341\306_\226F\017W\002h\200\310\250A\210\243\251\270\331\376\233#J\276\354\352\0320\205-\0372\274%\177z\310;@\353F/ \262Ki\0221\263\222\374\362\204 \241\206\305\357:zq\344\354\257\321\207\345\256\257\003PzzV\224\334?\275\274\324m\3374\367\335\320YZ\301\007\213\351\376\200\262\347\203\027C\364\301P:(\373$\213\342!8y\253d\360ZH\2676lu\\\326\001\b\232\316\3353\242\343\202W\354\"\017\330`\326\345\032*3\016Cp0\271P\204\333\007%8\267\005\374:9\370}\371<>\021gu\2551\027s\216\004uqG?\234\214S:V@\274s\223\364\347\341\265Yk\3553+\341\250o\r\370D30\314\377\357+p\306\221\fpk\261\262$\225d\001p\246\244\365\303`J\243\023Di&&bx"
+	.string	"N2.\2168\322'k\021q\224vj?\230\013\273Yn.\024\302\2147\224\001Q\017]ax\027\300\320\343\374\272\350\310\241\020kbV3\251\240G\341\033\201\006\017t\306\257\253\3628\320t\363M\\<\322\373fy\350J\375V\231\334\274@\363\253\347\360(\bQ7\022u\342%,\210\004\233\f.\212A\321k\264\372\230\230gT\f\016\017os\222\024\263\020\023\275j\216\353\303\232\220\037\224\256\217\016\240b/\305a\256\364\0060c1\371\250\321/\370KpX4<\350\237\332|\213\326A\001S\234\376\237\241_a{\032\237\356\r\230\265j\216&\335\317[3T\001\310\017>\310F;\325\234\034\005\343\256p1M#e\352\220Dj\b\327\207U\350\2668"
+	.string	"\366\300\267D\276\2341 -\352\004`\301x5p\034~k\330\303\022\177r"
+	.string	"\345\301C\204\001o\324\253\267\030\217<6\360\244\027C\362\261 \260\036Y\002\016\013\033>\352\257\314\022\024{\312\245\220`+\320#\372\353a\020F\231\006\326F\023>p8X\227\260\232\324Ud\366\260\304\330 &#O\261?\333\"\331\241T\201\2341L?\253\272\242/\035\020\267\356y\367]t\020\215\f6\b\031\371OT\310\fe\035\250vIP\2106\273\347\212M\362\217\221M\245\273\330\b\205\323(\361\025\362gc\\\316\003\0263h\201&\b\31509\200:\030\n\363\360^\324\276\207Y\343\320\0068;A\372!\255\340\251Ugr\337\245{\301\304\264\222\323\232`\271 CU\225\357\022\226\300;\025\302s\f\3744\237\252N+\267_s\233\002\345\013\344\252\034)\263"
+	.string	"\313\311\221\270\242\202O\372\277\260\352P\032\356T\305\037\271\311\030[(\254\0272VQ\033\017\366\375[{#\215S@`m{J\255\313.\347b\262\363\245e 2\235E\313)\370I\032\001\207\2252 \370jB\337C\250\261\320\264\020r\357q9\327\237\343\r,h\332Q\220\022\256\233\242\210;\217\323\352\262\211\311\016\202d}\350\373\255&t\275Q\002\334\231\330\241<\273\351/\022[\\\304V_\"\246l\234\212\264c\\=\230\034M\305!\0206\372\340\357PVG-\372Ux\352\344\007\004\233\035\260\025\340\316]\236+WX\005\034\361\254\274P8\004\217\377\031\006\231\004\307)\212R\214\240|\232\273\177<\230\326\205W#Q\354\233\003\027\205;\304s\215F?\017#e\002~B\023\270|H\2009m\343\251+@\t\f\260\261\241\360\336Yh\372Tn\022S\223>\355\371\332\343Pxd\350s\036\323"
+	.string	"\n>Zt3@\230z\251<\242cM\233.\20235\026\217x\013\324\272\037\2263\370\302N\275\362`\242\261O\031\207\250\023zy\321\f\020H,b\326\220P\\\002a\236\230\214\203Dl]\305\362\020"
+	.string	"\021\343c>)\177\242\355C\005v\200\005\r\006\312]\314k\376\n\036\307,ZZ\206\305a\205\203\234N\334h\364c<\006S\362\316U\372\310{\352=\205l!\342\302Kb@\356\207\352\\\266\327\214\004\353\345P5\177\221\216/4<\013\203\242\3047\235\244\262\206\033 \006\024'DW_\2609s\036\262\340\f;\324\257\335\0355D\211\220\225\216\240\005<\326\177\273\246\3121\323\273~\316\305]`\245\370n\274h\377\225\271\252\234-\340\220\302\317\030\022\361\033\210\374\302Sy\317\2615L\330([\025\240\212\322\247!\336G\267\346\245\372b"
+	.string	"I\313c\207H\245Wd\316\36308\330\264::9\247\210\302\356\3248A_\007ag4(\203{\230K\031\026r\272\271p\024\316\217\324M\356!\324\026irZ]\245\372{sQ\227\306\345\375\323#r\330\221\357\221\331\240\253\227D\205\306\266S\200\274\316\0078\376j\003\223\326\327\274\350\327-H^\360{N\312\0137\312\027\205\371\303n=\270\013\354\326\225\013j\233x\260\023v\322\035@\177\333\346\324\2217j{\240 \3429^t\340C\202Q\347\255\350\3650\245\255\277\275\013\n\t\321d\366\247\233\264e\246\326\317\nseN\005'\211\271\301\247t\231\005D9\364\013\0277r\334\312-w\033\312r|\207\305bC\221\304\327Y\031\201\256\036t'\277\331\f\205\202\300\226M\016\341\267\0012\272\226\222\233:\244M\035\350\350\273U\326\024W\237\033\246 q\307\006\312U\322\fH\361\203\346\316\036\363\207\322\f"
+	.string	"\030\237\314\"n\375\034ch$\312\032\345"
+	.ascii	"\235ZH\222\224tW\005<Tv0)+o\221\265)E\337\021/N{\375\025\265"
+	.ascii	")\264\022a\\\002\336\351\311\377\354\037s\020\305\030\222\261"
+	.ascii	"\336\2170\f\322bgM\305\242\364\036\353\212\241\303'\300\360\236"
+	.ascii	"\320\322L\ft1\327\275\331\f\"@q\325\275\226\246.\354\031d\t\320"
+	.ascii	"{$\\H\235\3141\035#Gb^\372\252\\s_Eh\373P\313v\351\222\364\217"
+	.ascii	"\233\307\020\212\245hdFIX\023\b\203x\260\345K\013g\250\304\323"
+	.ascii	"\367\0269\244\242\021,\225\275U\036R?\270\243\345I\201\320pn"
+	.string	"\0171\213\354\2507\315\260\025\002\224`W))\230\246\353\2317\326?H\001\373d\016\374\352{\207\241\303\002\253Ht\331\222\2131\023\273\310)\234\263\025\305J\245\036t\376N\205\f[K\246\017\220\324S2\326"
+	.string	"\310p#gB\017\021\222\036\336K\350\306\276L\327+\200%"
+	.ascii	"\217\031\225\n\355\234\223\256;\273\t\215r\342\342I!\026<\264"
+	.ascii	"&\221 \302\266\225\252\251\255\333L\256#\250Y\261\235H\351\230"
+	.ascii	"\233 \363r\234c\020\020\307\245;\323\360\t=\253a\032\377\344"
+	.ascii	"DP\361\313\227\276\360;\307J\354v2$\020\322B\213>:\322\266\026"
+	.ascii	"\260\016\035J\334\272'\363Q'\311h\031\316\267\201\346.`X,*\341"
+	.ascii	"\317\027\321Z+\220\243,\342\211 \351C\030\211q\200\343\232.~"
+	.ascii	"ME\037\205~\242\326df\324O\254\370\024p!f\204[_\bf~\202\006@"
+	.ascii	"\210\234\036\2440\247\326\343X_\004\033\373\216)(-\367,(\377"
+	.ascii	"&\212\215\r\023~g(\342C^\335@\034\234\251\214A\247\32458\241"
+	.ascii	"\003\036%\220\306'q\032<\207p\2125bt!?\212\262\370\007\323\022"
+	.ascii	"\\\n\341\234\362\307\0333\354\231{\002\225\203@\2505k\fe\275"
+	.string	"R\345\271\260\243V\267\250cL\245mz\314\343\250$\274k\242]\351j\276&\032\200'CL1\276\365\325]z\311\336\314\365\tp\016\326\237\245\310m\202`9m*G\227\353\317\223\004\304\251\253\2200\214\322y\361\360\\\246\272\331\242\201I\270\360\205\"\003y\323\214n\347cQ\365!\037\330\276(;\354]C\242\034M\022_\202k\302\265S*\207bN\365\276\241\220E\227\250\237\340@\200\217\210\257\363\214Q\277\2266\272=\261\356^8\252u\021\005`>W\005\220\225N\b^K4r\n\314<\027\275(\201V\022\226#C\265\210\t\003\265\260^\216\333\360\271\213C\336\3147\324\3229\2420\f\031\036!\034\033:\250%\320(\033\243Rv=kg\250}\001Z\004C\302k!\3220\374\225\261\032\302\343\361x\241\243?\201\266O\213\315\376\033);\373\2600J:\bW\251\007\360,\203\326:\3579@i6\263"
+	.string	"6\215\177\223\252\307\371k\317\275]\204\2017\177|\020\256\267`\343y\311a\326\335N\277lpR\361!\303F\322\2175\3409\334\264M\202\204\344\235\021>\307\f\325V\023\246a\252L\007\232\005\305pQ\360\334\034\365@Hg9\325=1\\w(C0\262)\225\367\2019\372\263\f\373\311\230\310\210ez\240?t\006\023^F\020n\273\027\204F\333s\260\314\272\310\r%\267\243\274f \260x\237\247\032%\313\317\200\307[\305\323b\347\342\250H\214boV\023~\277_$9\021\334\206n_"
+	.string	"\231\213UX\023P9\2407QfC\234\3745p\222$:hP\377\354\347\232"
+	.ascii	"\022g\275\f\"\032\366|*\353{|\236\341@\307\353\200/\207&\243"
+	.ascii	"\002R]\024\346\314\\\354N\2403\240\222\374\311i/E\330\\Jo\215"
+	.ascii	"zu\324H-\357X\305L\343\256_\020=\016\354\255\232\">\310\203\007"
+	.ascii	"\003\355\234\200Zb\bU\260\217)[\321\332\260\216\262.7\027\200"
+	.ascii	"\004\355U\332X\003\374/\240\213\301\361@n\275Q\3463\372\341\342"
+	.ascii	" r5\361\n\020\013\264\216\360U\305\370|S\340\36021B\024^~\372"
+	.ascii	"\340u\020$ \245i{u\003\253\254GZD\227\207\326\271\024K\\\251"
+	.ascii	"fG\t\241\333w|x\264\316\314\315>\3065[.\357|\016c%\240d3\027"
+	.ascii	"\372(\313\250Q\233m\247\242\307\272\027a%\204P\346\274\322\371"
+	.ascii	"r\243sC\323QBY\314\206\034\245\325\321<Y?\335\263\007\274\340"
+	.ascii	"OD?A;\037\004\266\003&\323\307$\033\314\337{b\266\022.\003\003"
+	.ascii	"3,:Y\2237O\230\356\3636\031\341\345\363!\310<\257|\270-\250\247"
+	.ascii	"g\202\031\240R`\200\335\270\374\315\344[\240\251\312\217\006"
+	.ascii	"\240p\262\207\271\230\371\027\270Y\300\006k?\341L\250\313\037"
+	.ascii	"\327\315\0267\257\353\272\326-t\177\222\001\022G\330U>\033\317"
+	.ascii	"p\220\377=\020\323\366\317\316\220%\215\367\367\200\231JW\303"
+	.ascii	"\310(\364\262D2\351\033{\377=\2538\222g\030ep\267+S\345\211\230"
+	.ascii	"\304x\231{\277\360z\300w\327\\\205~\347g\224'r\324\330\266\031"
+	.ascii	".N1?\003\211`\253\036H\n\025\370\240\272\001\217O\224\005=\020"
+	.ascii	"\233\353\034M\303\216]m\224.\001\247\210k\366\f\246\247\330\276"
+	.ascii	"\r'\tpt<\215\\L\034\244\037\244\376(\332k^n\240C\235zf'W\364"
+	.ascii	"w\232P\013\326\350L\245\245\266\335\021\2339\335/\250cQ\321\017"
+	.ascii	"}pt\013~\006/E\f\261p\fS\275\026\355\264\356\257+\242\252^#V"
+	.ascii	"y\200C\266\352T\303\232s-?,\254\333i`\004!\r\021\223\301<\346"
+	.ascii	"Q\005\315\365\327\312\376e\222\245\352\205\212\205l`^1\256\206"
+	.ascii	"\240b\203\233(-k}'D=\337;\027\344\"'il[\032|\013\271\304\367"
+	.ascii	"f\032\224\206\337\032c\352\317\007n\307\335\"}\n\231\205]\376"
+	.ascii	"\314\340\214\246\026va\235\271\242\370\020\363\006V\307\232$"
+	.ascii	"\336\254y\005\237\035\335k\276\216\376\364\332{\302\215cqg\003"
+	.ascii	"?{8o\327(*:\nL\\\034r\005\277m\024,\ff\367\306T+\342\225\344"
+	.ascii	"\213P\253L\373\224\004=A\002\245\311\261\303\200|\353\372/X\300"
+	.ascii	"\017\261\337\240@@\353\020\226\357~\334\003b\205\347\244e\214"
+	.ascii	"\324\304f\327\346)\244]h\374\f/v\347\366\300!\332V\353^\002\027"
+	.ascii	"\360\270\352\301\005\202c\233rS\366\004\332W\301\035\374\177"
+	.ascii	"M\367\345\023\341\037|\257\026A$Y\007Sp}\252qN\325\005\332\236"
+	.ascii	"\235\247\255\235\202\356\327\253C[\324\367\\\023\212^B\260\322"
+	.ascii	")\254ux\220\314\t sR[\230\250\330\212p\245\270\301mck\270\232"
+	.ascii	";\246@\236\210q\253\252\243`\0137\017\214\363\360\nTE"
+	.string	"\262v\004\323,\023/{\3116\323\255\205\200\370\265P1!>t\002\n\201\370)\307\351\0010uC\222\250\022\304\227h6\330\342\303\225\377}\2351\230\307\310\341\352N0\2179\327\241\0179\246h\313A)\003\037:+\274\326\335K\215\306V\261%\256\340\347\032\264\241\204\317i\345rt\205K\037#\221\036\033\341\212`\316$\021\374\316\031\354\3134\030\257\355IG\026D-A\273\037\005\231\264\216n\302y\025\271\326\207\321Tx{\272\216\263\2440\255\212\024\337\304\363\f$\345\t\b\277\017\024\201\261\206\230\370(\217?txh\321\355+\207\376}\364\017<B\261\212Q\371*I\017\323\r\025\215`\013\265\333\002~\346\306\377\364\213(d\016v\310f\273t|\254\200\222\245\230\233\275\337\026\335\201\215]\3050\0254o3\201\013\373~\035\321\315\0072`i\216\267@Y\034\263\207\377\237\333!#``\016\373\036\227;\343"
+	.string	"\342P\234\236\002\335\317Q\304\376v\312\361waT%B4\201l\251\034\006\255\023\254\301\354I\234\021\026<\214\223\201mK\032-\020\033\030\025\036\202N5\261\332&\217\223E\017\331\376\346\336\200\254\270\025\252\033\214\035\022l\372\363\206X\261\024\247==\tq\345\332U2\340\221Il\360\205O\021\340\251\230s\304d\022#p\331m\n\242\367\202\277\367{Y"
+	.ascii	"\020\300{\020\022HQ_\231\303\007 N\351\n\314:\203uN\036\325\330"
+	.ascii	"0\237I\233\013O\252\024y\031"
+	.string	"\354\f\030\247\255\2732H\234\270y\2121\235[r\200a\235j\231\263\255~\256\201\273F\257\315\375w[q5\346\005\310\247\311=\004g-\022\003b\351\263=Gp\242\2113\307\333n9F\252of\356t\267\305/\327\277K5]\375\375_\233\242\37659\364Be'\333\370\224\360\347\211i\251{\316\256\300\fr@Z\372\240\001\371\022\305\226r\353%q\034\315C\336\255\340\316\030#t\313\226\022\242\003-\312lB\362.o\\_\204EX\340\331\022R\231\025\025e\330Y\016\372B\312\037\327\237\2205n\333\n\334\242\025{~"
+	.string	"\202i.\315]\250"
+	.ascii	"\265'\374\234\363k\033\326\317I\232?\267\321\246\264\333\276"
+	.ascii	"\004\326\217\254X\252\335\240U\t\324\027%\317\205Z\212\362\232"
+	.ascii	"\265\371\254\"\312\311}:\257\230+\002:\001\234\037\233w\033\216"
+	.ascii	"}dUn\364\246\371\306-\231\211c\234\261\367\244\362\177\230\364"
+	.ascii	"\342\230a\3768\261\277\211k\234\315\217\372)p\227}\204\221\303"
+	.ascii	"\301\nT\001\004n\311\027\032D\371Q\273\214H"
+	.string	"\302\230\031\275!\305.\\\212h\023\270q\023\203\030\206\3508N\bwQa\006@?t\300\343A\211\245\n\025\212\250\362r\326\207 %\326#$\326p\265\030\354\306\346@\342\346(B\204\3765D5\005H\b\210ls\267\354\227\210N/\306\033\323\251\337\004P\023\016H\336|\254\001Q\007\341\200;\230\365])\372\371\354\310\306\231h\321\345\004\355\b\360\221\374\363\252\335E~\353\246l\\\223]-\350\310\211P\027M%V\037\276_gY/\227hK\333\214\333\371\357\266X\216\220q?\200\202\367z\035\351\256\335\3132\002\224ke\370x\267\376b\202\2227\035\324\336\250}\337\247G\032\003*\277\227u\203\035\273v\226\357m\003\020O-\026zj\240\320\360\366\265\345\226n\226\006|\232?\333\217\2757\003\324\245\3045F\277\027\251\335\013h\367#\0071f\261\207\013%\236A\206\275\016\334\023\355\022\322\343\230.\356\340"
+	.ascii	"\307\357or\323~\254'\221\f\227\234\361P\334\367\220\\\316\t\337"
+	.ascii	"\251\363&\340s\235M\032\377\016\257\354\304|'\277\240\327&P\177"
+	.ascii	"\231\261\210\305}\036\303}\220\335\034_C}\246\365d\024.\b_\333"
+	.ascii	"\215\257\370\236r\307\033\3643\251\271\305\360& \367\300\273"
+	.ascii	"^x\232;\314\316l\366\277\376_\307\205\013\376(\302\346\2423\300"
+	.ascii	"\224\315F,\227w\257-\006\2030\250\371\371\347\337j\367\304\322"
+	.ascii	"O\330\034\272\361o\361\257\236>\027M\026\037VA\314\344w\346~"
+	.ascii	"\265\311\341w\247Q;\343\035\311\020k\237\233\231\336\262\227"
+	.ascii	"8\343\214\333m\365\037\373a\2419\353\263\215\3246g\356\371\263"
+	.ascii	"ent4\2516\320\334\253}\316\374j\255D\374\267>\227a\377\007"
+	.text
+	.section	.gnu.lto_.symtab.4320c35753839e8d,"e",@progbits
+	.string	"taskUpdateRxMainInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"tasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"tasksInitData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"task_attributes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"mspFcProcessStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\004"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"schedulerSetNextStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"schedulerGetNextStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"schedulerGetIgnoreTaskExecTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"processRxModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"schedulerIgnoreTaskExecRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\004"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\004"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\004"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\004"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"pinioBoxTaskControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\005"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\005"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\005"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4320c35753839e8d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1041 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\023\001\345\b"
+	.string	"\344\013\007\002"
+	.string	"\027"
+	.string	"\256\243\357\217\b\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\302\344\215\361\003\306\276\360\237\007\034\002\002\002\003\002\004\002\001\005\006\002\001\004\005\345\227\312\267\013\004\002\007\002\001\002\b\002\001\006\207\330\300\037\002\002\006\002\001\007\324\210\217\002\002\b\353\262\334\316\001\t\302\327\301\252\013\n\353\323\235\254\013\316\362\227\372\013\004\f\260\222\312\332\b"
+	.string	"\002\001\r\306\356\320\340\017\f\016\372\302\212\340\n\b"
+	.string	"\002\001\017\304\365\327\206\004d\002\003\002\006\b\002\001\006\006\b\002\001\021\332\232\226\260\f\022\320\374\270\356\001\002\023\353\303\321\231\004\024\302\260\202\373\013\025\310\253\321\370\t\026\305\310\337\235\016\027\240\342\234\212\n"
+	.string	") \220\202\031\233\354aI\251`L\252\253"
+	.string	"\214\021P\030\356\013\227\034\270$\030\024\340!\2304\200\343\375\226\211x"
+	.string	"Z-0\0267$\013?\312\360\031"
+	.string	"\215\335\b\310\303\210\242\277\001P\302&\301/\222G\341C\f\303\321s\305\355\362\261|\222\\\341`"
+	.ascii	"\300-^_\324\344\020\005p\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \213\335\002"
+	.string	"\204\003\177"
+	.string	"\021"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\003"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\003\007"
+	.string	"\003\b"
+	.string	"\003\t"
+	.string	"\001\n"
+	.string	"\003\013\001\001\f"
+	.string	"\001"
+	.string	""
+	.string	"\r"
+	.string	"\001\016\017\001\001\021"
+	.string	"\022"
+	.string	"\003\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\016"
+	.string	"*\202;!Z\\\356f\216\2426\320\0340*"
+	.string	"\030We\206%"
+	.string	"\b\323\251h(\301l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`z\002M\t"
+	.string	"\242L*/pM\n\035\374\242s\254\312\325\3207\227N\355c\337\2217lC_P\315\017\033\033!\371\267\376\377\271*\261b3\032j\204\366\tim\313\235\002\377K\246\002Y\354\340\250(\211&\030\2404\202\262\341\231\336\234 a\277Y\3468w]\227\b\364\013\267\002r1\301\362\215\201\036\007\f\b\323X\240:\213Ki\253Y3I\026?\037$\017\006|S\340'\202\302\244\340\200\255;\311\374[\356~\fm\333\252\350I\302"
+	.string	"D\324\rQ\226\352\362\245\303\214\266\b\035\206\264=\370\370\366O\374\347\244X\016\333\226|\263\316\243-\364\233\257!5 \200\242Bd\325\001\036dQ\247\301\275\276\236.\241\213W\b\361\202?\346\240\tc3\t\323\352\007$\017\035\240\303\300e\330\021d\023\020\373\027+n\337\373!a\006^\205d^\225\301P\034?\200g/\216r\214w'\261\013\300\215\307\214\275"
+	.ascii	"D\303\300\021%7\002\304\2277{I\270\306\r\362H2C\212#\362\216"
+	.ascii	"\0200W\300\237\310\354\311g\2734\355\030\315\005'O&<\360-\270"
+	.ascii	"\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\355\004"
+	.string	"2\307\024\033\240)\215\001}\f"
+	.string	"\300Y\336\227\255\001"
+	.string	""
+	.string	"\360\231\352\255\375\237\333d\223[\246\024\252\nMh\266\244\365\344\252z\271\027K\256:\350\240\031w[\332\273q\007Cd\310\005\225\240\324\303\374@\005\252\350\321\200\236\002\324\230\225n\311\322\026B/W\245\"\334\021\035"
+	.string	"b+:f.F\312P\256>(Fn\306\2329*`\017\200\213A\205\025\004H"
+	.ascii	"4OP\223\353\234\203q\236B\013r\020T*\270\233\304\n\036\006\206"
+	.ascii	"m\002\333\340\215@\370\376f\273\234\202\355Lh\305\202\002\270"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.pureconst.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\002\230\004\003\230\004\005\230\004\006\204\004\007"
+	.ascii	"\204\004\b\204\004\t\230\004\n\204\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\270\004\021\230\004\022\204\004\023"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"u\004"
+	.ascii	"\222\204\r\024\220E\351\377\377\377\377\017\326&\033-k\277\373"
+	.ascii	"\355\377D\312\024\377\317\273\3637\250\032&E&\035_\006\025G\274"
+	.ascii	"\r\327yZaZ'\265\020P\226V\271)\267\031\b+ \320\242\311\342\006"
+	.ascii	"l\2424\th\020z\022o*\026\343m\310\275p\3351@\330kM|\\\0171\027"
+	.ascii	"f\335\224#{7\302\225\261\177`Ao\255\363V\327me\260]\362bp'\013"
+	.ascii	"\213r\307\366\216\023\304M\203y\337\3118y\350p\205\t\346\266"
+	.ascii	"`\f\\\364!"
+	.text
+	.section	.gnu.lto_.lto.3fb54350985f1aa6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.47.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\376\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\201\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.string	"\236\n\013fq\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.49.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\n\001"
+	.string	"\n\017\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.50.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\231\n}\273\0012\206\b{\330\316\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.51.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`;\003\r\022"
+	.string	"\266\236oH\340\322&\035R\021.}\335\217\341)\0250HP\003\322\003\334\265l\253\200\302\"o\333P\232A\316\341>|k\374\2117\232\\;\372\302\220\264\002A x\254\306<\303p\336\025\206\241\252g\271\261\342\302hdo\"eJ\001U"
+	.string	"R"
+	.string	"a"
+	.string	"\253j\275\372\250n\304\020\001\23593\334~L\241\330cc\373&\307\354\035\257\325\314\343\330\304\344\204sNo?<v\031\271\325\230\337\225\204\314\300\226K\016\2170\027\224\333\360\005"
+	.string	"\276p\006\346\2347q\305"
+	.string	"\312T\273\2229\247u\006j\270\273\333n\331>`o\2078(\254VK>r@f<v9\242\333G\352\356\n\360\201\021!\323\233\277\272\217\tb\225\243p\225\346|!\361O\374\306\202\017\342\3210\026\375\354\321g\221\217_\021\360\247\307\215\213\336\354\232L\227\306>7w\306^uI\325\235\252%\247\216\253\346T\035!IF4\033\204\373|\247\030`Qh\223K\303\342=<)\210\302\230\363nQ2\267\322\332\021\016\343;\275\2109\335\226^\273\334n\007\024\305\225\022\356\"\325\"\256\210\207\240\022\334\322\354\374\223;_"
+	.string	"\035S\b \232M\347\234-\253\263\213\222\311\201c\343E}\230[[\365\025\337\251f\316I\342\253xV\215|\253\024,\205\225Zy+\023PX)+\217\002+\245\342\251^0o\244\200]\025\276\227\267\342r\275<S\315\345\334\334\031# !\344\2622\373&\322Np$\223\034]\222\216\023i+8\216\223\243\016D\n\027\274\210(\t\211\306\3407\206\300\243\260\301\203\200L<G4\007\377\251\301c\024\332d\334~p\0323\002C\2501DD\036\242\241e\025%9"
+	.ascii	"\003\021!:\007\020@C3D\024\324\001s\270|*\371Jk\327\316@n\312"
+	.ascii	"\020T\3229(\\\263\346\231\200\253\3443\264\320\327\326V\261\346"
+	.ascii	"\002|\220t\312\373/b6\001\245\345j\031\261\033\260\214\226&\275"
+	.ascii	"+\257e\247p\354\374<h\214\354\236\373KY\301fk\333\251\244\266"
+	.ascii	"+X\033\177\200:\037\222E\031K\f\222\351\320,qD\3578\243\225z"
+	.ascii	"\336\026\340\037"
+	.text
+	.section	.gnu.lto_failsafeInit.52.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\265\007"
+	.string	"\022N580\217\323\001\200\323\265\362\3140\223\311\247\032,Q\264\006\250\223\243\243\340h=\3459d\372q\200\306\301e\371x\205\037#\"\2020KU\333\346\265>&i\013B\233\354\235R\326d6\233V9\234\266\321N\002\002\307\331\350\002\247)P\215Wi\006\343\216a\343\321N\327y4\013\367\326J\322\305d\321\242\022\222\021\366\353e7\374TC0\024\024\307=\227\355p\020\017@iw\t|\323?\036\374\214OC|\342\301O\377s}\026L\250F\036\250P\\\331!(\312\013\373\326J\222m\031l\244V0,\273\024+\325\236L\022\r\333\317\374\331)\017K\373\223\211\204Hjw\251\304\370\367\370\371\357\270\300\250\004\024\201\036\261\203\335u\004E\025\267\274\355"
+	.string	"\333\003\266G\002\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.53.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\342\31525Po\322\001\240\374\240\2020\315h0\354\300\340\b\260\342q{P\211P\330\032j=\256\026+\314FXX+df\334\270\006\372\245\347b\221\026\250\033\331[\312\224\002\336h8\025\345\351XT\005?\r\fV\247\202\017\026\345"
+	.string	"7\230\007j\f|Ap0\370\271.\f\306\275[%Y3#\245\260\035\361\222\f`w\025|\222G\t\337\343\317\023\240\274\366\347\203\246\277\324\200\221Q\226\354(J\325\260\357VI\266\323\251\230\225\224\203\226]\213\322\313\242\274\223\017\333!{\300\007yH\310\231\213\035\233@\206J\205\211\313n\204\231\027L\177\356\004\323\237r<{f\376E\356X0J\332&zb\026v\327\251m\027\267\3366\202\355\004\333\033\001\b"
+	.string	"\001\023\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.54.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016\204\363D\303\002H\021\032\326\302\"(\345\017\331\\\360_\255\033\366\357v\264\205\335y#^\321\264\377\233\231)R\324\231\324\262"
+	.string	"1x\031\255m\215\020\231\002g0\232\313\342l0\353\212\035\206\005lsE\007\314j\210\031\215\0231\002g\017\032-v\262L\213\227.\013IC\202\020\234\370!\n\262\001df\302\375h)\342r\264Z\302\363\312\265\272\236J\253\007\003J\241w\372\016\364`\306\227JH\372\337\017ZL%\003#\231\242SJ\222T\"\035\377\347/\037 |\336\332m\210\212a\242\bA\311\354\"\324\350\326\267\335z\224:\2710\341F\240>\213Bf\376\270QE\207\375\013~\203\337\"\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.55.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \365\325\006"
+	.string	"\362\f05Pm\222\016$\307\250J\250j\272\265M?K\333\274\2414U\376\253u\303\376\335\216\266\260;o\304+\232\366\17733E\212:\223J\231 \006=\304\030\255\021\"Sc.\031\253\332h\256\312\212\234\007\207Kc\305\210\253\202\210\230l\023/\005c\022\231,r0,\213\026.\013GC\003\020\264\370'*\242\td&\303\ri\211\342z\224\272\242\363\272\225\272\035\200R\017\016\224@\257{\356\363 \307wJ8\372\337\017\022d\240 \220d\206\272\225<\241L>~\317[VX\360\254\225#\205\272\321]\214\250dr\021vT\353\323nA:\245\220J6\321\247/\240!3\177\233\b\243\303\376\007\177\302\257\021\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.56.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375 \372\355\006"
+	.string	"\362\31405@O\324\001x\211\345\322*\204#\254\033_5A&\205\247\322\324\025\234\315\001\335/Cn\326\272\207\335T\271\341\b\244Kbi0L\235\202\211FF\335v\357\224\002\246\244\312\2326\354\232\254\3121,\\\230U\035\256\251\241R\332V\245\001g\017\225V\271,\323j$\356g\346)\031Y\306\313\234\360\337A6\304I:\001\315\356\036\370\"\037\211\360;N-\341\311\207\247\276\007\235\"`|d\204\254\\d\307\026A97\354?;3\366T\0309*\005)\273\026\235\226=\241&\036\266\037\371\263Q.j\366\233\n\212\rgw\353\344\370w\371\371\007y@\210\001/\001\022v\3272\304\\\334\363\266\tl\033\330\326\b\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.58.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"b\21635P\213\323\001"
+	.string	"BU-\320\214\222\241\335E0?oCR\244\025\207.f\037\221\275\\\261\344qpe~\02423\216h\307\251\247\276*\230\005A\330\336D\312\224\002\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226\305I\267\237VG\252\002\035\365\370\327\250\253\3524\362\361<~8\207\006\260\273\b\376\306K\020\376\305\241#4y\356\320\327P\207WJE\251\223\237\335qRI\366\247\335]\353\310vZ3\375)\300\003!\370vA\237\310~@/\303\366\306\236\330\340`\343\355\035\005\350$\321\247#d\267\213:\361\355\271\371\3278\024Yxp!\316S\222\260\273N.$q\353m\017\330.\260\215\021\b"
+	.ascii	"2\241c\037\030\302\004;T\241\3145z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.59.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"M\n"
+	.string	"\306\023I@0M\234\016\300b\016P|\3257\225\215w\326\346L9-\225n\377\340\017)8\\\220\377\037Qa\204\3074\003\336\313y2\240CO0"
+	.string	"A4\t\032-\216-\026C\233\222\312\007\"\341\266R\246\0243"
+	.string	"3"
+	.string	"7"
+	.string	"\036\221\307\215S\254G\3101\254G\177\366\211\207\247}\n\202\202T\212\335\305\364\301\277\347\347\337\302% \t\364\274\004\354\256\023$1\270\365\2669l\007\260\237\021!(\325\201}\310\356\256\325d\037\365\307Lk\2463\323\277,B\214\350 \261\273`\265bU\361\203\204\211\355\247}\n\257\360\035\345Y\262[\342\340a7\374p\032\016\242H\275\252\306\016\243\006\242\\\371*q\317\212\232z\231\030M\020\271{\006/\262\273"
+	.string	"\374\013\307\340\361#<:\301'\017>\372\037\353\361\032K T\240B\271\262\003\230M\3432\002\230M\306\351<\005:\317\205/\225,c\3514\232%\203u\016\030\3204\031l\243Y\020`\027\256\303*\032\3368\031\207u\266\215\303&\341\036\262j\362"
+	.string	"\021\252\220\212\254\272\301\243\234\002\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.60.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\305\007"
+	.string	"\362\31656Pm\323\001\244!\331\021\301\220\266\201@\261\fd\025bO\\\212\311ZPq\337\266`\364\377v\246\260\277\342\330Wg\232k\225\025/\327\222$\221\177\377\2376\221;\245\316`4\227\265q0\353\232\236\004\004\214sM\005\314\352\314\214\266M\214\200\263\005\2156=Y\246M\313\267\327\321\201\t\b\322\220\377Mec\337\330hPL!!\311\325\356\374\313\002H\273[\340c<\203\301\247\270\364\366\221\376\247\272\224\035\236\t\024O\246\242\335\340\020\357]\t8J\300\220v\366\327E\225\260O\355\356ZG\366\243_\001\204\"\027\217]\210\323\311\202\362\243\302\366-\346\354\221\177\244}\311\342\241\024\356\356\324\211s\217\234\377\213W<Q\367H1\330]GO\024q\353m\017\330\276\330\006\t\013"
+	.ascii	"3\001'~\306\232\271\013\266\333\224h\244bW\236\353\301\005\227"
+	.ascii	"\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.61.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`7\002]\021"
+	.string	"\266^mF\360\262&\0358\376\360\340\236\261\037\375\357:\241\354C\334\257\013\206\333\313`\366Z\261>\344\354\035\242\337\321\232\027\253;\2463\364\315\362Q+]\202\300de\301o\300WJ\341`\024\271\333\207\2411\353F\310\336R\246\024V"
+	.string	"P"
+	.string	"^"
+	.string	"3\017S~\302\353\322\023\272\264S\354\320\345CV\261s\234\0066o\023\262\330\364\230sr\373\341*\327d\\U\361/s\020\360\305\272\006\332py\301\202F\r\337x\200'\207\207\200\327J$\265\210"
+	.ascii	"/s\305\360r\251n\013\346\234V\360\345ro\267\355\331f`k\205\367"
+	.ascii	"\264K\311\002\324\321\322\231\001\250\255\372\364\3407A\254\203"
+	.ascii	"\314\265,o\032\277\322l\024\nz\320\032\313 [Y\226M\343\322\205"
+	.ascii	"\261\037\347\276\330\253\036\251Z\264\352M\325\232\252\245\252"
+	.ascii	"\243\252U\325\037\020\322\241\201\340f\316\226\231\217)\223-"
+	.ascii	"F\330\276\037;X~\342\312\025\355\303\307\022/\033\261\233\024"
+	.ascii	"$\\:\363\013\027rAr:\020N\\\355\221\021\266t\026\347\214\020"
+	.ascii	" \026\363]\321\021\200\305n\"\304\316a><8\353N\323\025\251\301"
+	.ascii	"\261\242>\266%\\E\007\272\321\2255n\304\204_\333t\233\216\004"
+	.ascii	"\233s*\360k\216\342\344\203\270\364\210'\035&)\255R\336\t\nW"
+	.ascii	"\362\251T_\027\342\256tB\231V)\317\204\342NHF\274\024\212+\361"
+	.ascii	"L*\2563Yq\245\002\376&\234L\270\223\3573\341B4\255\307\271/\r"
+	.ascii	"f\310Z\353\322Hj;x\260\313\222\013\343\321n+R\243\243\355\266"
+	.ascii	"!?X~Z\020\036\003\206\266\227\271\201\035\016/\036fB\321\216"
+	.ascii	"v\0132 \200\002\23193\017\013beL<BE\303\274\260\334\n\220]j\271"
+	.ascii	"\206\2060\2169\007\353(\306\333\225F\322g\336g\231\335\272\303"
+	.ascii	",)}M,u\230\210[Y\036=p\0259$l!\302:\327|7\245\225|YR\2319\022"
+	.ascii	"v%\252]\\l\220\020/b\220\307n\331\026\364\2217\007\203\201f\234"
+	.ascii	"X\376\265\013\302\275P\234\302\203\31073\246\024\020\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.62.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`m\001E\016"
+	.string	"\026\333_C\020\217(\035 \017\337Y\320\250V\245\005%\213\036|R\373(K\346\021\177\264\366\235^\276\0347\335\222\230v\374D\177\235\341\0355\266\331FR\204\n0!\200\242\302\016@\256\007\204\210\277\005\377\215l)S\nH"
+	.string	"G"
+	.string	"Q"
+	.ascii	"\376\311Y\"\007a\035\t5\317l\021[\363\354\032\227\354\026o\255"
+	.ascii	"\366\256\030\312\025\333]M9\274\364\250Y\3621\034\032`\312\364"
+	.ascii	"x\341\272\221:\305\003\273{\223'\205\324"
+	.string	"\227\211\341\330]'\230\262pg\267\315\300\366\002\373'\002Yd\001]x\031:\223v\250\313\203\327\004/\026\330\247&c2~t\261C&\344A\347+\006\354\244&\273\365\245\252\354\307U\022[\323\233Lg4\0353\255\231\316L?\300F\006\025\032\212\335\n\341\312\3022\023\036l?\021PR\234r\206U\243\026p\241Z\274\007\177\215P\275\311\021\260\300\260\262\341\204\245\033\305\300@\265\244^3z\326cIj\305K%\304\207/C\333\020.b\003\240\222\252#\241\f\326\325\356\334\265\tX\355\256\002\037\345)\036\277\3033{p\231\317]\036\376\340\214@\034)D\003\351B\241n#\340\215\343\371tF \256\363\321H\037\036\034\350\243\201p\235\220\266\211F\032\307\200;\t\036\221F\352:\221\246iy\217\253$\r4\300<\375\242\252\334q\261\035\274D\307\200\025\t\215\222\224\330\013/\303\334]\223\252j\243Q\003\034"
+	.ascii	"\013\312\312L<~\212f\341\2056\264Y\215Z\004\342J!\371\336\204"
+	.ascii	"\323Z\307@\033\200\257\0242\361!\206 \004\007\304}J\fR\261[\236"
+	.ascii	"\013\272\220\027\315\030\f\312\214S\226/\355\002\347\036\300"
+	.ascii	"\245\250\032\333U\312"
+	.text
+	.section	.gnu.lto_failsafeCheckDataFailurePeriod.63.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\013\001\265\f"
+	.string	"\206\030WB \217\232\016\223\277a\027\264\002\023\246\025\034\234%\272\251@\351\361\374\204\367\246\001\t\304\254\220\272\020\261\266\365\fC\202k\035QS\364\331Z\025\204@\025\rS"
+	.string	"\253{J\305AHI\n2\306\275\245L)C"
+	.string	">"
+	.string	"G"
+	.string	"6\365x\312\036;\305\277\223y\221\004\021\025\026sN\271\027\3569\\\365\370\017}\342\272\317\241D\341\013\r\270\214X\241\321\205\300"
+	.string	"#(\334C\327\b\335\246\232\221`\316i\345\272\tw\274m\005\266\027\330\327\002\347\036\375\017\214\307\357\222\260\264\360@:\262\277M\327\304>\234[b\257zR\265\264\352\250j\250jU\365)\r\317\004\002\321\234##\027\263%\222\310`\373~\312=\220s\360\222\260P\2176H J\204\350\213\341F{\343+*p\037z\001\224\n',\244x\322N\233\241B\344\305WW\332{\207\033:\024!D+\0326\035\231R\333\301\245\347t\tl\373\261\215\375\003\004i\316y\300\377\356!\3631<\332\343C\003\346\300d\034K\363\220\035\330ua\225"
+	.string	"W\030\315&\223q\254\314Fj\034\033\026g#;\254\314%\253N&1\003\214=\320t\244\206a\035I}\240\303\271%\f:\264\200v\203"
+	.string	"\324\2564z\316\273\237\237\274\270\210\3305\2316n\203\025"
+	.ascii	"\013\312\312L<=\032\r\353\205V\263\002\320\366s&\034\306\272"
+	.ascii	"\252\253\242\26011\b}q\274\256\260\242\013yI\214\301\240\314"
+	.ascii	"8e\371\322\2568\347b\212CcPP"
+	.text
+	.section	.gnu.lto_failsafeFailurePeriodMs.64.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"5\007"
+	.string	"\362\r35Po\322\001 Od1v\013\342X\331A\004W\347BuV\241\022\241\2605\324z\\-V\230\215\260\260V\310\314\270\0065\373\237\253\315\242T\376#\262\267\224)\005\346l:\025\365\361XT\005A\r\f\226\247\202\017\026\345"
+	.string	"9\330\007n\f|At0\b\272.\ff\342\336\255\226\254\032\222R\330\216xI\026\260\273\t>\311\243\204\337\361\347\211P^\373\363C\323_\252\300\b)c\3548J\305\260\357VK\266\323\251\003*-\n)\273\02610\313\362P<l\213\354\214\017\362\020\2213\0277\266\351\204\243\302\344e7B\315\013\246?w\202\351O5\236=3\377\"w.\037+\3326z\002,\354\256S\333.n\275\355\003\333\b\2663\002\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.65.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"M\n"
+	.string	"\306\022G@ \307*\035p\206\225M<\245+\302d&\272\bqZ\003)\320\227\224@\256\234\266d\022Hc\200+}\373\031\273w\341\262)\237\311U\001 \004\200b-"
+	.string	"EK\240\002\240XcBl{o\231R3"
+	.string	"3"
+	.string	"4"
+	.string	""
+	.string	"n\265VO\222\200\013~\312\005\375\204\320\364y\361\270\234\f\256\020\006]\210\232\r\004h\252\307\276\034aj\367 Sk\365\262\302\216\233\336\266\204m\007\3733\362e\373pmX\272\354]O\372\001(7\005\021\001jm\345\032T\032\025pb\373\276\354b\351*\226#\005\272S\273dw\247\357\f\332\265\217\260\372\003&\252$\313\224\217]aV\023\261\031@\220Z\234/:\364\025\322\245\326\372\340\217\237e\370%\247\326\030\355Y\247\376\310r:\345\305oJ+\001\210L<m\316\036Q\033\336`8\035M\350\343\321t<\021\305\204\347\323\361,<\232\no\003\ny\230\005\177\027\034\220'\372>\220\327\215\247\3253'\211ZM\204\265?\214=\313R\232 `\270\005R\276l\007\020"
+	.ascii	"2\003\303\341\306X\240jI\036\n\373\271\317a\243\322\343e\\\320"
+	.ascii	"\341(\323A\331v\312\362\245\335q\3165%4\215AA\001"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.80.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\275\013"
+	.string	"\326\224MB kL:H\3002\035\031\200\033\222\007\204r_M\215(h%r\272Z\311 \274\317\024j\337X\210"
+	.string	""
+	.string	"\231~\022\320\211\377e\023"
+	.string	"Y\231yz\277\\\023\037kF\036\\\353y7(\352A\366\336;\2457"
+	.string	"@"
+	.string	"8"
+	.string	"\223\311\351%\330.\035\260\311\006q\231k?\213\025\230\205\273[Oe\203\233.\3434\371\207]\242Z\235.)V\t\036+\237\022\037\273\353\t\0057\275m\016\333!\366A\002,{V<:\354\032\270\215X\006t\303\203\013%\217\346\322\b\314\227\203\020\023\302M\355F\205[ y4e\256\325\310\202\017\021\302S\215[p\247\363\025\334\357S\270\214\364\230%\002\033\351>\254d\007\246\304\270\373\216\263\003x\361*S4p\250\245\344\311\277\207\263\277\323<\027\256\335\355\3601<\003\350\277N\035\022\305\253N}\021w*\201 \"\264\241\342-\312\226\345\374\\\031\336X@N\007\n\325\316\347y\037\006\303\030KFs\0019\335ESA\033"
+	.string	"\035GS;\335\305\253\230\017X-\031\376\004d>\025\364}\237:\261\035?W\262,\342\241\206\222\003,\245l\331\001\031"
+	.string	"\022\324`\323\n\214\207{\3400\f \017\214p\305\2406\021~\206\310s\013\207]k\270\237\363\266\b][\302\202\235rg\036/\252\207\316U6\375v\256"
+	.ascii	"\234\274\230wZ\232~B\031\003"
+	.text
+	.section	.gnu.lto_failsafeCheckDataFailurePeriod.part.0.82.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\215\013"
+	.string	"\226TLA kL:0\021\351\005\001\004\002\004f\230\226U\025\004j\r\234\240-\b\001,PA\271\377\361\262\001"
+	.string	"2\375$\240\023\377\313\026"
+	.string	"&(\301 \3148>\034\305\366\301\265~i\\Ck\262\367\336)\0056"
+	.string	">"
+	.string	"8"
+	.string	"\220\323\277l\213\034xd\207\270\214\265\2371X\240!\334\335z*%|t\031\347\310?\354\217\023\212tI\201J=V|J\004\330]O<\270\351mw\330\036`_@\236\222\r\333n\203\233m#\320\017\0232\210\f\232KS0[.\021\025\3025-\307\205c\b\0314e,T\001\b \\\341\251\306-\270\323y\t\367\373\261\313B\267`\231\342\020\272\017\023\331\220\2218\337q\366\001/\376\344\210\207W\315$I\3667\234\375\235\266\271`\355."
+	.string	"\177\303g\240\337:\265\347\023\177:\365?\334\351\203B\207pD)\336\242\\Y\316\317\225*\007\306L\300L\327\361T\315\347y_\005\303\225\211\345B\0013\035\345R;\030\003]\346R5\035\305\253\025\016X'\031\376\020X8\265\363}\234\n\261\035/U&\020\253\225d\002K)W\266\003\031"
+	.ascii	"\017\312\224\234\343\360 \0337\214\b\210\202a\256p\324&\354\317"
+	.ascii	"\020yn\341\260k\r\367s\336\026\241kKX\260S\356\314\343E\365\320"
+	.ascii	"\271\312\246\337\316\025\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.90.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\351\033]p"
+	.string	"\272\255\354&L0N\352\031\003\016x\005\273\233_\341\344\222\224\0252\274\226\f\231m\034x\277L\277a\212-\337\245t\243\235\036\352"
+	.ascii	"\243\236\237\322\013\224\256\b\004\002!\020\354J%\351\270\333"
+	.ascii	"\212.P0\266\232\006\255\225\251\343bgBBBvJ)\005g\002\037\002"
+	.ascii	"h\002\212gM\024\033\255\256\212\033\326\212\257\240\215VW\245"
+	.ascii	"b]\314\220\257\222oY\327/\272\340\253\276[\013\013\301\246g\205"
+	.ascii	"\001\006\263\210n\305\350J\366\r\301Z\263/\327\235RK\351\302"
+	.ascii	"\021\230\005\364n\215\254ycPj\347\324J\276c\31207\367\013=\030"
+	.ascii	"B_\231gJ%\004\346\216\322\202V}\345\021\323F+\004\250rT\353\223"
+	.ascii	"!dV\305Y#\325\272|\262\230\375\036<\336\270\235\264\037\263\223"
+	.ascii	"]\364\225E\374hs1B_\031KH!\325\372\276\257\023\206\273\016\006"
+	.ascii	"\367]\347\265^/\351>v\3621aB\207\210\001S\311\336\336\217\265"
+	.ascii	"\211U\256\002f"
+	.string	"\022$H\256\230\357\333\022\t\217%X\003\230\255<\002\243\361^p\027i#n\343\275\b\342\272{\307$\260\026\216`\2662\250s\332V&\373\246m%\021\206\222\202\321vW,\006%\345\266\335UP\326\335\033\006e\247g\315\276\357\235R+y\211\331Jg+\233\216\231a\210\261\313\274\330wkoWq\223\346e\337\367uj\345\363\340\246\273\035\365\001\352\311\203S\023\323\222R\022\322\221Q\021\321P\007\016BA@?>=\033x4@wtrpnljhfd\2361\316&\fs\331*\223\357R.ws,\253\243\254\364\007+28\224\027Y\216~J.\273\302\334z\212\230b2\304#\326\257\341\304\022\335\203+\352Y\347\234\232\230\020\007}\211\360\005W\362#$\322IH\210G-\030M\021\273F\361\242\276&\352\343\363\241e\264\003\223%\316\001\0062\210\3202\232|\354C\264:\006\001\355\351\2659="
+	.ascii	"}t\232\030\221\377Al\237\036;\253o@l\036\rC\032:'\347;:9u\215"
+	.ascii	"\363\243\315ot\370p\233e\364M\017kuL#s\353\232\206\023cs\232"
+	.ascii	"\036k>s\3262gpbT\177&\223\260N\270\364\0241 \311\2340\267\257"
+	.ascii	"\356k!8\261\251\3078b;\245\270 \250\204\356\204\026\206Lm\257"
+	.ascii	"\323\304t,\233\313h\032Y\216\206\021J#3k\346\0241\263\245\264"
+	.ascii	"\314[81\263\031c^\256\364\257\261\033\235L~\350\312\236\020\363"
+	.ascii	"(\245\342\034\343\362\227\031\353J\006\275\357\333}\355`c[\356"
+	.ascii	"6-\265\214\276\357\313\255u\245y\252\231\377\312\3142\230\241"
+	.ascii	"Z\001"
+	.string	"/\322\f\3660^d\266\033\327\232\300\\{\305\230\017\274vY\253\234\2031\363\242\217\nmYMe\366/\377z\221Z!o\231\177\t\3421\3348\227\302\234\311%_\346\262\263\315Ie\367U\273\363`N)\241\364\312\364~\321\372\322\267\272\231\204\211\364\252\344~\321\016\360`\f\263\203\226\365\301|\265\310f~\367u\023\316\333\247]>\323\263\226?\305V6s\327d\272\364i\223\337\212x@Yhs\355W\271\263\355\337E\272\354`4T\374\206\272\n\341\242$rf\227\005w\316\373\213c\256A\n\267>\213\277\225Q\362\276$\277\312\336n]\333~k\301K\344\362G\272\366\342\3261\337\227k\212\373\261gp\211\224 \200\200\266\225\355G\261\365\324\250\033\362_e\346\253V\371P*\035\236\"\227?\262\217\267}@\313\234\300\002\336_\312w|\313b\271>\213\273}\332\377\344\263K\313\270\031\273\221\001\3566v"
+	.ascii	"\002\b\332V\376\333Q\327\250ueZ=A\333\357\237\204\224\372my$"
+	.ascii	"\267 \237h\354\004\314\367}\247\270\027\033\013\005\334m\026"
+	.ascii	"x\177Y\320\266\262\277\005\333\207\330@\243\326\331iy\244\177"
+	.ascii	"\225_*\304\332c#\277\032\263\211\022\321\001\372H3\t\001\236"
+	.ascii	"\316\001<\235G\3148\0030\343,B\3069\304\323\031\304\323y\352"
+	.ascii	"\351,\365t\216z:\177"
+	.string	"x:C=\235\237\236\316\036\236\316N\356\334\364tfz:/=\235\225\236\316IOg\244\031\347\243\031g\243\246s\321\323\231\350\351<\324t\356@\343\314\241\306Y\250\3069\210\306\031\350\351\374C\343\354S\343\334S\343\274\201\306\231\347\351\254\341\351\fm\276\346\235\247\263\016\215sN\2153N\215\363\r\215\263M\323\271\346\351L\363t\236\231q\226\231q~\3128\307<\235\2351\316M\2473L\323\231\331t^6\235\333N\322\254l:'\233\316\357\316\016\343\334\275\305D7C}\337\260H//\232\322\017H\363u+\351N\322}\244\233H[\t\201\257\240]\037^\324\243G\362\036m\364G\377\003\351\005W\364F[/\343\301\212\276\017\331\210\276\223\374E\031\372\030/\375.w\312\344\032z)*[\346\354n\274\226\033\307\364Y5\032\177\376\234\370cw_\237\260\026f9d\331\333\224\240\257rs4\313!\001{"
+	.string	"\366"
+	.string	"\372\302\315\005\222\375\353-\001\313\333\f\354//2\037\035\347\235\301F\210\315v\027N\372\227.\337\322\330\341\235O\026\035\3558hqq\020e\021z\016A/\004\364A\257\344\303\262\b\364EX+W2\250]\371)\"\005+\365IKt\343\210\020\2355\254\f\355\221\251\365,\2450\3262\177g\205\033\276:m\017\335)\021\225'\207\331F-\217\344\221\336\210i\200,\344\202\336\271!B\337\b\220\247w\360\272\343d\311W\236\316W\271\320\215\223R#\020\2060\3571\347g\320\2352\275"
+	.string	")\030\345\347\245\250@\tt\343\230\240<k"
+	.ascii	"z]\377\370\375\371\374\2718\230\374z\336\307\345z\303\367\360"
+	.ascii	"\374\206o\371\232\\y\236\210\357\212\211\311S\355\232<\364\202"
+	.ascii	"\206\363U\326\360PB%\356\224\271\247\341\247\022\241\377\343"
+	.ascii	"'s\304H\216\233\235\377G\024``4\314iA\213\f\033\235\022\034\211"
+	.ascii	";\315\203\016~i\001s<wjD\347\245\324\220\314\345\350;7\216\310"
+	.ascii	"\223<\271F\021\316|\333\rk\231\3351\227F\217\037\215\302\234"
+	.ascii	"\247sq\030\255\r\351/-8\237sA{\3638\337^T\233\277y\345\025\033"
+	.ascii	"\316\202\213\203\271\202\315\017\241Q\247v\336\325\314\256\231"
+	.ascii	"\013\271\212s\032Ff\033]\356\311\225\232\256y\247\3637\267\016"
+	.ascii	"H\315\367\221\230\030\206V\032\345\2078\3532C\363\314\256\016"
+	.ascii	"\377\341N\215\326\332\226"
+	.string	"|_Zf\336\3714\017=\364\242\312\374\f\225f\300\366\3712\377s\350\005\027\363\317o\351\027-\217<s6w\207\257\305|\007\2625U]\036\336_\316\027\340\332e9\003\022C\231\257\262\313\3266\277\247$\375p\201x\1775\277\347\272\005:\206\304\361\371\325\344/\235\031\232\320\220\330,6k\217LM/\346\253\334\355\220\374\315MRx2\304\371T\3429\t3\300G\037,\215\035\005\345\016\304B*\373YrJ\230\315\301\256\343\315\006\021o\260\343p\033QZ c\247\321chL\320\002\254\002E\013\024\005\220\020\001\007\037\254\020a\005U\n\252\252\031\r\250<\250B\241\374\300\001\253\004T\244h\261b\204\0236T\032\260`\240\212\n\004*\252\f\232T-P\2648aeE\225\202E\025\bTU2\234\242\211j\003\024V\035\254@\261\201S\013\025\034\254\350`\003\247\017V\240\360\300)E\225\225S\223\017\263"
+	.ascii	"\201\252\312\251\005\013\026UN\316~5\346\250\326oE9\340$\f\261"
+	.ascii	"\016\373\272e\b"
+	.string	"2*y\264~Hz(\361$\036l\253I|\343\271e1\032b\201\372j\222\300.\260\247Wc\033\023\326\244W'\357jo\352\354\022\230\233\364\212t\004\344]m\003V&\275\372xW\313\360t\266uJ\230\223^u\274\253\001\251\025\351\325\t\306N\321\347\246\350\363R\364\031\311\304\363\221\211g\240\350\263O\364\231'\372\254\023}N:\243_B\200\032F\037E\030\r\025\337\217\231\243\037\031\031\371\350A\001\177\266f\306\252\202\225\205\307\256\253\177\205\216\331\357\273\342\213\201O\256q\306\022%P\230d\033\003\320\361z\356\024(I\3137\342A|"
+	.string	"\277<\004\340G\210x"
+	.ascii	"\336\347\320\013.\304\2138\373<w\307\037\t\361}e\003\361R\202"
+	.ascii	"A\n\267v\264\214\240Y\241\323\324\027q\247D\177'\365Q?\365\320"
+	.ascii	"C\273:\251o\300\250\377+N^GlS\332\220\271/rA\212\203sL_\345\017"
+	.ascii	"\017E\310\202;e\256\360\341\243\240\276'p\313\022\220*\323vQ"
+	.ascii	"\207U\242\306\271q@p0\200[\236\236\031+\361\337\334)\020\220"
+	.ascii	"\326\303;\375\323C\177\270\323o\363\360}Mtz\020\201\177\n\270"
+	.ascii	"7\326\025,XYv\354\f\360n\254--3V\027,G\234\300:\263vA\327$)\307"
+	.ascii	"W\3358\243W\003\204\302A\t\332\022\244\257>\271\340%\266\\A\b"
+	.ascii	"\217\232>&\rO\321"
+	.string	"\2043cAbEz\1775}\347A\t4\372*\007Q\201J\364\375\242\345\344P\364M<\030\323/\335\030Q\204\201\321\220\260\375\320\334)\363\214\351\213\022\333o\351\333\257\231\215\177o\216\330\255\317*\262Q\333##z\2657\242\230\305h8\364'\274\016\033}\035\332\030\361\334F\273\210{s\304rP2+\273aC\351\245\250@:\346\240A\346%\013d\367\374I\021J\312\3720w\312\3643\256|iAz\242Oz\236\274\202:\250\322 -\220\302\316\241\231\021\2210\222$Ic\"\013\020\006eQ\026[\354\001\022\340\0239\211\224\316\241\261\232\242\202\222d\330?\003 {\270Hg\235v\271p\342\b\037\227Z\334\247\241\035\221\205\2240|}\221`\274\324\200/\251?\333\334h\261\255\324,6F\005\302\364\243Kb\236\270\255\363e\020\206\333\371\373\340\n\221q\252\031\346a\001\376L\347\314u'\362\005\203\\\310"
+	.string	"A\251^\231het4\311Z\343p\f'\323\207]Zh\"0\244\nvg/\373\273\r\3516\331AW\203%\225,\\\b\037\023Vb\354!\343\204\211:8\277\235\231\024.\006\003.\303R.\350\023\213@\n\322\327\335\177\251\225`5\301@\\\203\321[\357R2f!-#\352.\006E>\257t>\240'\240)^\242P\336!/\031\276\274&\177j\315\032\217\204\330[1\003I\027\033\013]\334\021\233\275\3230\221\372@\250\305\f\034\027A\217\374\324\361\322\304\324[\227H*\316M\305\312\352\343\2548\n~\352W\250\332x\274\201\217\003i\356\356\037\241\257\261B\332\373Zz\205c ,:\304\335h\316"
+	.string	"\201x 9'\2703h\206a\304\304\200\337@\352x\213\320X\007Q\320y\021>\356\024\236\252\013j\215\223\033L\003Vy\223\231z\323\216\362B/\322\231\336\261\271(\221D\341A\336\022\261\236\022\247\004u\030Z\204\370\244*\240cYh/J\314\224x\3410W\265\225<i\302\313\254E2\tj\261\221t\be\232\340\235\021\n\212\250\305]=h\033\255\0207\342B=\311.f\225\371w\300\370\207m\023\n\205/\031cPqF\211\300\231\234\234\320aj91z\340\356\263\002BV\245h!?C\033\344\261\271\260;a\315\265\317,\215L\026\004\353\r\003)\r\361\013\246\037\374\374~\037\006\022\350\305\306y\322\244B}\212cOvz\245\275\247$#J\f\375\364\027\257\n\337\343\250M\367\221\013\332\025\244\352M\270R\243\223\273!\307\241|\314|\261\020\b\347u;\266\240j\353[\336r\367|n\007"
+	.string	"\235\037\270\306\240\330O^\027G\310\202\311\255D\333\177\224\351R\256\263\261\020\355\\\203\272\341\354F]@m\204Xx\333J\220uQ6\336s\034\374\330\260t\f\0328\244H{\310\033\220\214\210I"
+	.ascii	"\244\233 \211\3077\207\030\361\355\223]v\275r\300\262\255\330"
+	.ascii	"\265_\325\364\372"
+	.string	"\242fP\200\352\255x\n\300E\345\220\250W\242\364\207\024\205\347\257\341\300bX\2679\240\032\337\262\t!4.\360\002U\027\0053pu\222Y\201L#1/\0247\210\002S\351\377\310\342\347\\\265\016\250\206\"\301\026\300\334\216\210\013\361\266\366\300\304Y\212\234\024\303\317\007\004\325\242v\255\356\212\265,\316\303g\224\260q\311\\#ad\2543\200\354\230J\326\b]H\007@\224\035\242\343aI\306l\017\233~\353\202w\303W\366\335\016\333\016\025\315\032\3049W\0232\2347\314\023lh_\022\321|[\233\261\032\271)aQ\331\025u\237\003\240H\222\254\252\264%%S%\326;\035\222\324m[\220G-\374\317\f\3502K\372/\316!\313=\316\310\345\b\334\327\005\213\256\207\f\207\264+\230+\256h\207\201d\301\233\340\240<Cr\235\334\345\002Yp)2[\226\341\375\272\210f1E\267xM]\240\323\007\340\n\340"
+	.string	"\331\032\275\034>\2424r\220\312\025g\312Z\356|V\372J\177\262\fs\277[|\306hf~\230\325\321\261\332\035}`\026\211\245\356\332\220R\201\022\355@\216x\3056\276\242\005#\007\341\377\371\266\222\036\322\021-\247\020\273(\370\351w\rv\240\226\fa\341J\261\201\257\336G\341\020l\341B \374\371G\207\345\317h\376=\234#\350\375\330Q\251\016m\207\3360\024\"\340\352\031\276\257\031\327\313'"
+	.ascii	"\355s\302\351\232\024\017\216\\\020y\217\214\017.d\020\366d\320"
+	.ascii	"\271|\324\215\006\016e+mG2w\b\2131u\r\033T\337q\373y\351\030"
+	.ascii	"'\rx\376\205<_\201\312\343\3518l\226p\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\200\003\245\020"
+	.string	"\226\032fH\320TQ:x\241\335\243?lc\367\206\246\242\t\341/\031\031\214\2045\3468G\240$4r*C\377\274\221\230\301\354r\204\r\314\031\344j\006\305\367\307m\003\300\257\251\022@\033\376[\364\273\344\252\021\261\006\326#Vn\231\002Q"
+	.string	"T"
+	.string	"R"
+	.string	"\3279\320\025 \353<.[n\310@\337G\201\246\260\322\023V-A\325\021R\r\001\325.\225~pj\007\261i\240\251g\340Ex-\220&g\244\264\fD\351\357\200\373kM\022`\351\376\257$\215V\223\361\367\237\303\204\212\244\224r@\037\b\376\027\205\b#\023\334\227\367\245\351\343\230\351\337\220\351\377\304\364}Z\375\236\006}\0330\375\333K\177\307\245\377\251\224\362W%i\351\327P\026\227\356\367\020\233\3112\300\030\300t\177\315\254\006\303\314Ff\023\263"
+	.string	"\343\360r\255\215X\320\352\024\304t'\242b\226H\320\247\201\240\003,\037\234\031yeSG$\204rT\2747\337\212\367\006g\342\355\360\001\247-\371CG\344\005\201S\357\304\255H\344\355Z\234)^m\361\351}pf\217\307\253.\246\006\370\311\345\254\360\276J\313*\255I\320I\2538U[n\b\220\211\264\257\350\221\226\025\003\277\240.[n\210\005l\t\r\236\234\254\316\023o\t\013\355z\360 )\361\002P\341-M51r\023\212\274(Sa\f\036BP\274)\237\226\276\235\024\221\367\204S\021\220#+&\212W\365\251\247\363\"H\212\027\246!\362n\230:B\001#\b\305\033\37349 \020\003!\242\344\001\030\330D\02610]\005\323)\013\241~\365V\356Z\343\371C\347\030\204\260\333\\\003\373\007\246\331\005\2263\037\365\020\n\311\300-B\020\rCM\202\004H\200\004H\200\004H"
+	.ascii	"\222'\350\340\275\024@\022\f\310\360b\314R7F38u\222\331\227\373"
+	.ascii	"}\242\265v\244l\200\340\277\341\033\276\341\033\276\341\033\276"
+	.ascii	"\201o,?B\222n\036\037+i=\210\217\202\312"
+	.text
+	.section	.gnu.lto_.refs.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"u\b"
+	.string	"\246\020/0`u2\214\001`\2010S\252\347\205\001\262\247'x\004A\020\026B\020\004A\020\35091\222h\317T\247\262`\355f{\2635!{o\"\267L)\034"
+	.string	" "
+	.string	"\036"
+	.string	"\246\347\355\274\005/\301{\275\234\327z\007\336\352\245\336\351Tz3'T\331\376\256o\004^+e\251t\nY\372qS\235\324\252Y\2475zo\005\"\241)\363\016\260\315\232I2Z\373L\026o\305K\261N\274\022\357g\215x!\326\207\327amx\031\336\205U\341M8Ex\017\316v\314\300\316<\220\027\307\\#\003#"
+	.string	"\200\030\230\027\227\026\226\025\225\024\224\223U\223\022\222\021\221\020\220S?<V;^9\336\2137( \340\"\263q\003o\021\250\304)f\0044\247Hc@L\332Nll\023v\2145\301.c\254I;\215\211&\312\312\260k,\223\354Nc\0314\233\026\025k\207\352"
+	.ascii	"zj\201\320\361i6V\313\254\246H\362\356T34\334\340\324H\254\223"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.decls.3fb54350985f1aa6,"e",@progbits
+	.string	"(\265/\375`\207&\005\246"
+	.string	"\032\001\3018X JQ9\351\0258\207\342;\340S\377\f\357\034;\367\277\377\201?\235\366\231\270\267\241/\377\242\206\255\246\360h6\261s\004\243\b\306\232\240\031\035\256!5\233\0278\200\242m\211h\020"
+	.ascii	"\302\256iy_\306\213p\322\033\372\\\365\276\347u\324\020\375\315"
+	.ascii	"\334u2\371dK\231\002\350\002\212\003\226\003L2.K\223\003c\336"
+	.ascii	"\273\032Ua5&b>\230V\256\360\233]\271n\310\262z0Y\f\3271\030f"
+	.ascii	"\262\035"
+	.string	"\227\3410l\206\363\030\217\277\360\030^\371\216\273\234\351\330\313\317\365^d\224-0\266/\276c-\314\245\347i\275\311\233\254\035\367\034\326\204\321\254\222dz\226e\204i4\345\347\"\263~p\335\273\362\023(\254\326\203\\o\325\215\030\021\243_\203\016\370\216\343\370\255\347\270^*4\213\007\f4_r\276c'\254f\225$/2+\013\207%pS\330\364\356]1\030\302\300&\207\236\332\216\n\316V\200\222\224\345x\013\257\031x\356\234\205\261\334\346i\275\353\275\327\207\357v@U\365\371&\222\212\340^\316\200r\263\311\031\3207\220\264\273\205\364\347\255\331\215\341\316o\334v\r:\370\016\362\202\335\273\362\333y\357\023\363\005=\314\027\330H\371\361$\206\236\357\253\364=#\035b!\364\215\"=\333\245\347\266\364\314$=\013I\3174\322\363\211\364'\216\205P\"N\303A\256>8\\\360l\224\365\371\020\244\337\200\031\237\235"
+	.string	"d\310\355\363\"R\263S e&<TmQf\372<\007\351\211R\r\034\204\032a0\026\263QR\313[v\357\nd#v\245\310S\237|\204\221\360\252\204\303~\206-\357\330\275+\217}\202\361\246\326\247\006\026BO\016B}\264\334\016\336\351\231\b\365a\"\364+\013\241)\007\241?C\331\353\342\2635?K@\215X\032$?'A\203\002\0239\363\177\217\305\020\203\375oB\346g\274\237\3270 \342\357\256\256\017N^x\376\016b\300\3559\177oi\300\310\207.\342u\035\303\337\032p\030\326\002\303_\036\200\277\223\300\b\321\362\235\277sl\370\315\337W\017\223A\201\027\377\357BT\2110\205\376\235\342\177\235\230\247\177\037\377\347=\314\275\374\377\362\177\314\177\346\1772\377\301\374/\223\345?^\034\226#\340\377\206\377(\274\202\277M\374\034\374\031\356\347\267\237\255\374\\\345\277\315\337"
+	.string	"\370\371\347g\237\237\201~\016\300\317B?c\370Y\202\237A\360\037\347\3573?c\375\254\343\347\034?g\375\214\343\347\253\237Y\370y\207\224\237\245~\276\361\263\215(\377\177~;\342g\266\237\321~.\373\231\354\347\261\237\327\237\213\374<\344\347\256\237\267~\366\3613\217\237C\360s\007~\276\300\317\032\370\231\001?g\340g\f\374\214\302\317\033\374|\364\263\210\237I\370\231\002?\207\370Y\204\237A\374\034\201\237\037\360s\003~\376\360\263\207\2379\370\357\366\177\356\377\331\317\013\370\317\344\347\f~N\300\317\b\370\271"
+	.ascii	"?k\370\237\366\263\005?W\3603\005?O\360s\206\237\207\376\353"
+	.ascii	"\3757\363_\354\277\207\377m\377\205\232\315f\363G\211\376\233"
+	.ascii	"\251?CX\034v\251rT\034{\270\351\335[%\003\2372Cl\370\350\363"
+	.ascii	"8+\246t\225)T\250$\273h1\275\226+\312\224I\237\266E\211\242\307"
+	.ascii	"ue\213\213\022(P\332+\375\271Ps_\\7F\264\030\351\241\225\226"
+	.ascii	"\326k>\2309J\0368\360Z\355\275v\312%\341B\327\347\311\260\032"
+	.ascii	"\nG\245\006\315\214\024\r\255\311B``;k\301\345\245\317\247\327"
+	.ascii	"\314\254\275\330\001K\244\230\\S\302 \351\312\312\232,\004\004"
+	.ascii	"n\236\240\201QCe\311\222&\013q\304\220d\211F\321\313k\222\275"
+	.ascii	"\341tyeI\205\205=\254\305p\224\367xg\200#k6W6\226[b\214\226\272"
+	.ascii	"\301\271\301\005Y\327!#kwQ\364tdhAb\245\005$\347\265\221\264"
+	.ascii	"\226\215\272\267\n\003*\2462\003\234+\345\232\023U)\030X{\245"
+	.ascii	"\267\003\346]\224/\373\303j\205\223>\177\003\365\325E\276\210"
+	.ascii	"\020\261\313I\202\306G\217>\217nI\217\"\031r^{H\273\020b\275"
+	.ascii	"\307\036\252\265\344\315\340(W\332\325A\272\332\013\275\227\327"
+	.ascii	"%U\362*\223D\357\255\346z\003\371\033H{\245\307{\207\250\304"
+	.ascii	"\335E\321\273J%\021*\244E\031\030}\266\327\305\354\334[\201\215"
+	.ascii	"\226 Zfe\322\333\260\245\347\376\321\373\224\274\367\266\260"
+	.ascii	"Yo\022j\347l\303L\364\363\260e\002\374?\257\375OA\t\367\036\335"
+	.ascii	"v\344\245^jO4\256\341\376q\367\"\261\216\021\300\252Bb\305\210"
+	.ascii	"\032\303\272G\244\326\021(y\261\216Qc\367\002]$\362\030\302\362"
+	.ascii	"\002E\215\335\252{BK\025\337\025\353x\221\313\013t\221\367IC"
+	.ascii	"\024\022\253*j\354\251\n(j\f\253\352\216a\335\237\213|J\252@"
+	.ascii	"\336$\320\035\303\262\273c\313\252\237\250\261eU\324\030\326"
+	.ascii	"\f\256\213\372R\246\212\312\216\254\037\234%\nyW\230\252\361"
+	.ascii	"\224\374\211\213Z\227\227\356^.Cq\223\004\270\267\3062I\367\024"
+	.ascii	"\203\327\240\342V\200B{Zr\206)\250\254\345E"
+	.string	"\306E\005Y\336\033\004J\351Nqp\\\343.\017\216;\262P\343J\241\270w\202\251{\217|\343\356\275\307{\357M\262\306z\357\214\237(\256\251\251{\225CS\267\306\361\t\212{\273\254n\255*j,ki\364\204l\214\353\246X\217\314u\351\260\222\351\330Q\311\225\272\3672^\312U\345\342\256\317\037:uf\310\\\033i\373\030\312\001\002\004\231\245\317\333L\245;\232\007\343]()2;r\264\216\235)+L\346\344r`u\026\316r\206\330S\033V/S\27139\332\372\374I\3268n\274\031\231\222Uf#\303\315\013Op\350\250aFcC\212d;\003\233A\304s\206\013\324W\237m\205\262\255@\001\246\317o0u\246\242W\244q\261p\202E\n\255]tU'\273E\307h\030\375\242\225\274\266U\257\360\246\342\2657\032N\303\315\036{\357\215+\\)\242\270\311q\312\006\024Qk\253\276\215\344\270\035\021"
+	.string	"\263\302\354\023m\325(\270\371\241\n\217\216+7\n"
+	.ascii	"\316\235SH\3723+\375\231\"\275\325Ko\347R\242\265\264\203=\222"
+	.ascii	"z\300Bh\037\373\211\327\r\r\325>\3264\021\013\222\2367\240\266"
+	.ascii	"\331\344\r\350m\215\224\325\360\032^-\340={\f\273`<{D\366\322"
+	.ascii	"\364yk\225\236-@\271\311\026\240\3574\351\327X\b\265\300g\205"
+	.ascii	"1\305B\237w\351U\032W\222>\317`T\\\340\222\242\025\277\255\322"
+	.ascii	"*v\322\336\226\350\350\323\206\203PVbtK\345d\241\f\025\220)Z"
+	.ascii	"J\326\314\304ZJ\253\321I\373b\226\3513-\315\2621\340xw\367\325"
+	.ascii	"3\360\340z@\271e{\316\036\n\2733\373\244C\235\017\255>\355Z\307"
+	.ascii	"`\001\244\205\224Z\317\t33\213\3265\006\tc1\303\241<\273E\263"
+	.ascii	"O\222^\270t\017(T`A\350\312\312\232L\210\212\0221H\364\316,f"
+	.ascii	"\302d\274@Ff\307\232\\7j6\270\246r\204\205\331\261\241\345\321"
+	.ascii	"\216(I\226\036n\247\231)=^\210\335\2165\262{HQ\213ka\347\013"
+	.ascii	"\026\013-}\236\307\n\f\314\256C\313\343\035\221\224\252.p8S\340"
+	.ascii	"\244x\254Irhp\241\031\351\323\"iv\221K\302\305\036I\373\372\262"
+	.ascii	"E8,\213\\\225\0369\035+XX\"\267E|\240\204\270\340\204\005\236"
+	.ascii	"\2570s2\372\374\016\226"
+	.ascii	"\227\227\035\20269j\271\241w\266\200\346H\235\035b\205\234\221"
+	.ascii	"\261\\\323\247\r\202\224\203I\224\275\364:f\272\272\354\026\377"
+	.ascii	"\254Pr4\270l\206\264x\262d.\375\017\373\303n\ry)qK\243k\255\333"
+	.ascii	"-nfY\342\326W;^X'\360\236\370\260>Zk\350\347\336,\275\265TO-"
+	.ascii	"Lyd\3576\212\327\336\263<l\224\362\272\300`\f\223\271\320x\364"
+	.ascii	"\271\343\346\251\013\027+\\\351\031\214\205\235\002\303\\\341"
+	.ascii	"\013\263\205\265\032\202\205\312J\201\3251\257,\f{\203\343\224"
+	.ascii	"?\027\231\246\307\304b\257l\025]\226m\301\352\260,\330\245\305"
+	.ascii	"\2629x\265W\366\305\255\n\273\342C\366\312&\27501\360\3113\302"
+	.ascii	"$\306\317\311\342a*\200\212\n\201D\214\r\213\203W{\343C\353\275"
+	.ascii	"7l\f[\203\343\224\353m\241\343\304\256\210^\006\fx\356\266\320"
+	.ascii	"\321@k\320\350A[[\300\353\323\316\270Q\306h;\221T\362je\244d"
+	.ascii	"\276\236\244y\030\035*=\262t\246\322\353\244H\237\203&\265.\322"
+	.ascii	"9\246\r\270\274\3649\314\3649^\322\347lI\237\343\226>\207J\372"
+	.ascii	"\333)+5v%\017\316Jq\263\345\336\244\240\330\322&\342 \324\236"
+	.ascii	"\260)|\212\254\3518CaB\017,g}\236\026\331m[\\SP\235\367\343\364"
+	.ascii	"\320i5Q\362ds\326\314\223\321\247=\246(r\226l\310\261\221\206"
+	.ascii	"\203F\237\267\307\277\303\330\373\201\346\0323}\236\216\312\350"
+	.ascii	"\335\324\201\233\302L\362\003\314;\r\230VC\244\274.4t%\345\242"
+	.ascii	"\256(\327t\313n\005e\237m\246\3174\232\037\007\207MJ\256F\216"
+	.ascii	"\364\255\227\263C\313\017!}6_\n\332d\336e~\234\033\260$\262\311"
+	.ascii	"2}\343u\336\217c\327\270\261\251\350\3639\312\364}7\202/WD\372"
+	.ascii	"l\273\024E\216\212\r8uaa\332\356\3571\315\354\271\r\334\213l"
+	.ascii	")\032\3121}\236\311Bh\017\007\241\035\306\350-\246\267\312\332"
+	.ascii	"\332\372\344\301\251K\317D\270"
+	.string	"\261\360\332X\272\316&\352>\001\351\340\265\326\310\340Dz\235\345yA\315\312R\220\255:\312('H\372|\323u\\w\331Y\336\213v\357\225\340\\6\261Z\323\205\213\021+\035.\254`8O\322\by\321g\313\365\226\367\\k\271=\307\301\362\336\247\236\363Qs\357\223\017\363\005\314\027\234E\262\266\314\320\3638s\251\006F\357,AhR\271\3362\364+\312\325\231>\371\342\244\271\271\365\233\035\021\231dz\343\005\224\2757V\263u/\304m\r\271\262\366\025n\006)\fM0\001\002\t?\020j\211_\b\003\004\215NE\302!\023\323\020\250\301\006ML@\233+q(\032\006%P};D\265IU9\200\022\207\300\"\240\020\023\021\275\022\007\244`S\321\220R\361G\004J\200\004$T\177\226\206D\243p\bT}?E'\024\234\200K?`\021\230A\002\026\030\001\005\020\037\370$\020\302\t%\370@\034\371F\214"
+	.string	"t%\016EE\242Z\"HD\232\300\350+\226\220\026\203KKA&\024\b\351\003\243Z\024:\005\231h\032\20206\025%5\005\001\205N\"\030\325\242\216\220D\333\024};F\2370\251\311F\230\324d\225\214IBu\tU?\020,\236\305\242JDB\372\335\230h\032\002O\242\261\311\236\307\004\321X\f&\251G>$U\230\024\\\372\335 \251E\247S8\f\032\201j\361\346?\343\017\311\227\324\304\241g\251\211IE!\251I"
+	.string	"\304\237\022\360,\252L?\023D\004\240X\302\2258"
+	.string	"}*S\320(t\"\026\001\007\240\023\244\032\215?\244\246\nL\24029\025\325#$\241\332Tt\032\241\302\221\360\204\240\243\fF\342\3178\342\203\342\b%\024G0\006\205#\3540\251\306\242\211\021G\002\360"
+	.string	"PU\002q"
+	.string	"\236\003;p0\022\177M\034, <\201"
+	.string	"\007\006\211\252PMJ\317\201\207\005x\360@\205\233{\360\241\303\207\016\350=\370`d\364\301\203Qz\017F\326h\364\t\207\305\237z\304D\034\222 \001\322\260\004 \325\2074\202\nC\016\334\250\276b\322oI\004u\211\003\277b0\204$a\220\211\370\303P\364%\005I\b\207 ~\200R\030.\371(\350!Ab\250\"\r\231|J@c0\205\"\006\225\350\204\244\002\207\304&\037"
+	.ascii	"R\023\277%\025\311G\224\300\350\363\340\006ii\250TT\211JF\237"
+	.ascii	"\007\200Ac\3217t%\013>lR\211E\306\341\220X\244S\364\031}\036"
+	.ascii	"\214\214\302\340M\321(TK\250h\2220H\034\032\203\302!S\316\322"
+	.ascii	"p\b\202\317F-\0214\002\177\250Jt\"\232 \252%\206@\365\210\210"
+	.ascii	"\341Hh)\370\023\001)\270\364+\021\224\302\220\004u\311h\034\022"
+	.ascii	"\225\214@\306\017\220T\245bP\030\024A\005\001i\311i\2504\"I\030"
+	.ascii	"D\022\376\2262\b\031}\032l`\024\006\235R\243ZT\211\"\220\206"
+	.ascii	"A\242*\342g\374\205\240\302Q\2220X\"\250\002U\"\005\252O\204"
+	.ascii	"\217Z\374)5\331\250\276#!\325\3703\216\360\2000H\202\nD\235\033"
+	.ascii	"\031\201\320P\001\023&\220\0029\250$~\305\245\340\217D\221Q)"
+	.ascii	")\270D\242H\030\3741\025\001\211\305\"\016\0254-[\016\331\013"
+	.ascii	"_\312\366\320z\357\fo\313\232&\003\341N*\207\232\261\036\030"
+	.ascii	"6\342^\244Yw\356\030$-\320\024\261+R\306\205>\255\031\253w{\346"
+	.ascii	"\366L\333"
+	.string	"3\266\331D\217la\202\236\226\214%\323d|\223\035\330\222wQ\364z\274\3301v\214\305\303\311\201\361\006\003\r\236\275\263\303aE\346\316\356\204\213.>~\2546.\224\\\325\365\311\354\025|p\234\001c\344\212\030\257&2vdu\230\2553\024fy}\332-v\213\375\302\311d\003\210<\301\333\323\273J+\242\337r\271\375b\353\220M\224M\372\264],\035\257\227b\275\360\240r\344\361B\252\302\315\034\253]nF]\227\236.9;\304\266\251\ty\241\317u\325Y\273\321\304*K\273p\2529!+\353s\207\212\312\307\022\013\334\211\244\333\211>o\341~\373\306h\320\346V\236T\2379mF\267nH+3\255>q\354\025k\245\013\231[\223>o\255\004\203F\250\262\3714\tr\244\320\314\210\210\214$I\322\001R\n\020\004\343q\030\347X\017\022`\364<\021\203L\031\031\022\021\t\222\224\244\240\222\306\351\222"
+	.string	"\203RZ\233\312&h\362eI\213\244_\337\371\364\n\276"
+	.string	"\207\204;I\273F_Y\372f\026\346\203/\203\320\030\317-C\035\213ZX\310Q\230x\246\222\213\035\035l\257D\210\211}c\361\305\363&\251c\026vTf\224\366\023\206\334\374\212\206!\364\274\016^\350\243\235\253\235V\235U\331\016'\233\235\364W\252\316LN\277\257'\3241=\355\257X\006\220\t9\300\352\376q[\004\250w\247\211Bl\213\217\267\230\275Ivyb\363o\365\332\375v\231\243\232/\247\376\036\302\002\301{\204\245}=A\005\025\236\253\226\263\360\302N\307O8\274b\315\244\333:\226\210\245\300\310`=\371Z\031\177\364 \006\025\256\372\255g\027\221^`\"\371\365\f,"
+	.ascii	"#c\326\266KH\3741\03072\366\242\336\204\250Y\302\215C\003Fr\364"
+	.ascii	"\003\306\272Od\2501\236\307\322\272\371\3116\002\342\244\306"
+	.ascii	"\262VI\327\005g)\212\303E\366\277\321\213\317\342e\235/k\344"
+	.ascii	"0\024k\246z\305\303\177\367\001\037sZ\222\340\033\217\357~|\275"
+	.ascii	"hy$\363\247+\215k\336}U0n\261 -%"
+	.string	"`\366v\246Y7g\243)\214\303@|\242@\360\336\036\216zFz[R\035\364\220\204\300a\034q\312\301)\200\203\271\200\203\003\034\022\363"
+	.string	"\\T\247\177\333\031EV\355\310\300\204K\360\005\255\211}\370'\331Z\"\331V\244r\223T\003\254\247D_\216\271\234\r"
+	.string	"\250\362\331\316E\252s\240\237\301\002n\275\361\236\204\2011\276Fw\273sI:R\221\301!4;G\265\026\321`\215n34\251\235AO\266k&\371\276?\201>\336.R\027\035\254\350\243\240|L\031K\354;w\301\242\230^\361Rw\370\027\220q\271d+\217\024;\235\024\264\004#\247\337h\317\214K\232 )O\305\013\233\355f\374=\023`\024\n\340'3\335\025\030\311\370\231\262\216R\276\017"
+	.string	"\203\213\303`\025\303\251\370\202\342\250V\034\023\220\f\301\226>\017\033\025&\203$\246\313E#\237\026\347\346\004\316@p]\f\301\300 \343\213{\350\f\2437\032\264\365X\370E\352D\347\244\212C\037\002M\225=BF\272\370\355\340\271\253\251\3330\346&c!\303'\243\002_\257\214\3636o\317\361\006\001_\214\216\b\267\232\031$\375\230\216>\325\307o\364\330\033`\224\tp7\bz\300w\200D\303\300"
+	.string	"6\234PI\n\016.\037Hy\213\326\354)\3022\232[\030\2458\231\374\357\312\326%\362\355\216\232\313]\235\371\320\307\001\243J\222\373\330S\n\370\216M\0201\037'R\354\026\276\224\223\343\234\245\333\365K\227\004\355&\356\317~\375f\274?\026M\357\262(\370>\020\n^\261\363~\240\255\361>\036\234\212!5\326\274@\306\315y\311\007\363O\306\324\370.\035\2544<\332\346\0178\234T\253\276y;\365\342pt\343\362\024\253\220\320\177J/L8A\220\377\213T\344fN0p6\364|\226\301"
+	.ascii	"\236\r,\013+\024\036<\260HpXz\220\327\211\025\362\356\254\305"
+	.ascii	"\t;\254\357\2775\256\323\"\023v5\231P\215tQO\\\214I\266:\036"
+	.ascii	"\316g\363\177\002\033~T\222\"\344K\255\303\031\204\007\356\211"
+	.ascii	"\"\220\3763\227V\205}[0}\220\372b1'\270<vE\225K\204MP\352\306"
+	.ascii	"\017\026\004\245?Gvwbr_\3020\316\254\r\211\203\027\265\334\311"
+	.ascii	"x\213"
+	.string	"\245\235\341\207T\005\230\334a\031\213DMq\2706\025\201qq\261\304l\226W\025\n\215d\323V\035\324\204\354\233\276\326\323\f\3015\212\370l\224\020m{`\324<\312\237O\306C\366CT\332\336R\206*\020'\205\356\2435\n\346A\343\fo\243\206\260\345B\261K-\013\340X\231[\bbA\024\222o\250N\315\026\353\246\314\246H\324\266b(W\212 \243\220\356Y\277r<\371\027\335\275\306V\231\277\372\207\257r\242\034\372@bD\370\002\353\024q\016h\016[\261\307/(\021d1\017\267{\216\256--!\317\2774\215\250\274\346d\222\315a\3155\030P\311\036\" e\231F}\001A\301\250\252\007\024\022}\027\023al?\2111R\234Rh\263\326u%Yx\271\372\310,\211>\364=\021\004Q\007\300\212\372|d\373\352\243\020\220\034\220\303\376ZB_\331p\376Jw.\322\255\372\003:\275L\360\324MV"
+	.string	"\224U\220G5\265\321\316\341\236\016V\n<i6\240\0034\367FL\313L\302e\334\330\251=\214W\202>R\220N\3229\232\305\245K&\362\324/X0\025\211\221\263\254|\336>@\354\314a\311\333~\036j\021-*X\200\244R\272\231\227\331F6\001*\245\317L@\020f\307m\231P#\364\215\340\314\005_\300\230\265\237\221_\357\222 \323\006A\345SEZ\200\031x\237\025\335\025\313ysNd\305\031Cx&W\317|:1w\246\257\323\315:\342\263\177\246\314\354z\210\210mv+E\n=9\275\211v\016P\2549=RZ\370e\307\366CE\377\212<D\323}\257U\377&\340\243\316\027\005\277\200\370I\346$\234\203>\376\327_\363\366\030\303=\031o\253\037\215\237\367=\212}C\363\336\243\267\f\016\003\350\323]\375\306}\005"
+	.ascii	"\364\364\345H`?\262\370\212\345<\223\332\210\275\357\271\227"
+	.ascii	"\317&3\254\321~pmHE\177\2302]\221\rN\037\376\352\374'\332\331"
+	.ascii	"\3076Sn\255\237\355\301\210)'\354\264\272|\300\337\311\201vl"
+	.ascii	"\026\373\351K\364\341\237+\240#\210\207\024\1770\337\032\030"
+	.ascii	"\"\217\033}'\356w<\266[\336\\?\221p+c\266w\365c\232]\314\\\255"
+	.ascii	"\234*\334\204i\247\354 \223=2\253\366}\257<ip/\327\301\352\177"
+	.ascii	"\301\214\3408\311/N'\026\233\215|\374\300\235\036\\+\363\001"
+	.ascii	"\226\271\272\034\204\363\206_S\277\314%\037\026\035`\347\253"
+	.ascii	"\203a\342\315\373~5\200\341\333m6\353|\027\034\035\312\362\023"
+	.ascii	"\311\371\370\3545\032\314]C\\\372\036}O\351\036C4\361\303^\242"
+	.ascii	"\\\274p\262%\3724\203'\033\365\207\211\263\025"
+	.text
+	.section	.gnu.lto_.symtab.3fb54350985f1aa6,"e",@progbits
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"failsafeCheckDataFailurePeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"failsafeFailurePeriodMs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3fb54350985f1aa6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,763 @@
+	.file	"feedforward.c"
+	.section	.gnu.lto_.profile.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\004"
+	.string	"\224\004\374"
+	.string	"\r"
+	.string	"\304\302\274\213\r\f\002"
+	.string	"\002\001"
+	.string	"\002\002\002\003"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\261\360\202\340\t8"
+	.string	"\002"
+	.string	"\002\004\002\005\006"
+	.string	"\002\006\b\t\n\013\f\r\226\371\377\362\r\016\016\356\356\312\353\t\002\002\002\002\003"
+	.string	"\035"
+	.string	"/\t\300\302\212"
+	.string	"$\224\201\273\232\215\001\021\270c\230\306 \032\370\200\005O<8\002\0060"
+	.ascii	"\002\334$`WfE@\t\345\274\332\260k\306)1p\007\032K\221\016\256"
+	.ascii	"\336\345\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375 r\375\001"
+	.string	"\264\002f"
+	.string	"\004"
+	.string	"\001\002\002\007\002"
+	.string	"\201\001\001\001\205\001\001\001\020\002\006\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004\003\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.string	"@"
+	.ascii	"` H\030\314\343*Uj%\244\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\304\001E\r"
+	.string	"\006\327M> o\223t\300\021>\017`Ar\210\247\\p@pL&?\016\005\341\263\020!\001\374u <\336\t ^\370A\346\276oO\002\244\220\214\n\201\230\003\202N\\\276\310\277\263&C\354\336\222\2446"
+	.string	":"
+	.string	"@"
+	.string	"\026b\230H\261F\266\374\235Q\357\214\356W\006\333\237\273\333p\252%\231i\271x=\245\232\231\311>t,2\223"
+	.string	"\273}\334Hn"
+	.string	"]\367\3538\024\231\225\201\307+\"\275P\242\003\351\300\310\031A\rarB\305\3068\206J\222QaeQx3\205\025\373O3\263*\346\307t\365\277tu-\006\fS\217~\202u)\204\377\365\200\265z,\366u4\355iP7\244\210\2244\"\366\240V3FZ\024\270\274\356\2656,_\250$\"\220\020\004g\002\264uFg\360\316h\001\307\031'\3164N\034GB\264\202\001\307\225\243\247(4R4\340\330\306F\005\377\013N\004\206I\311\247#J(%\3664\205\021\336\342\240\301\367\201\372B\245try\200\247\036&dp\3219\246.3?\330\270\031\251\252H"
+	.ascii	"QCs\333\334\024\334\t\b\207\017\275\335>\r\251V\220\002. @\002"
+	.ascii	"\302 \252\362\236\2242\357\334\265LLN\3706\030L\316\005qVT\034"
+	.ascii	"\255I\200\252\331\362g\353#\006\261\2008\024\217\327\006\215"
+	.ascii	"H\r\003z\206r\203\247\033\320\006\364\002>\013F\n\254@~\330\362"
+	.ascii	":jf\337\255\314a#\212\275n\004\005\320l\320D\037\350ph\267b\251"
+	.ascii	"t\261\354H\365\310G \322-c\257\351u\221\261(\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\004"
+	.string	"2\207\025\036\240'\351\377?\366\340M\252\252\313~\254xxUq\215\377\344\225\034\223o?\367\337[&\031Dz\364\205\301\347\277\b,\217W\025\364\002=\244\227\370\t\360\330\220e\030\2630\024\361\341N\327\216o\37491\236X\377|+\366\212u*Z\013\257e\322.\351Y\274\002\023"
+	.ascii	"\372\210<\034\343\332\230A`\300\b5/\300\034 eq\253\2150\f`\302"
+	.ascii	"\306\277n\330\203mp\304\342\254\205\352\006:\213:gq\005\030\002"
+	.text
+	.section	.gnu.lto_.pureconst.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\005\230\004\r\230\004\016\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375 O\r\002"
+	.string	"\024\003C"
+	.string	"\004"
+	.string	"\001\024"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\374\007\374\007"
+	.string	"\r"
+	.string	""
+	.string	"\001\002\r"
+	.string	"\001\002\016\016\001\300\007\002\017"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"8\203\024\025\334%\2142I\330@\033"
+	.text
+	.section	.gnu.lto_.lto.b09d046b3d24d128,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_feedforwardInit.33.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\203\003\245\030"
+	.string	"\206\255\233G\300\030Q:p\225\231\020|%d\025\244#0\371\213\264S\227\001\314\201OS\353\305\021\007\375g\317\033\n\364\307\\\035uF4\235~=\305\200\244\004a@8F \004\256DVta\210\306\217~k\373\204l\"eJ\001\202"
+	.string	"}"
+	.string	"\213"
+	.ascii	" N\227?\221U6\357Fn\037z\001N\243\377p\322%\314\234s\301\245"
+	.ascii	"%\234.[\340\325>\221\027\271}\007\343\002\346\f\222\322dN^\003"
+	.ascii	"\273N\227\346\235@xy\372\200\360\3227\373\213\001\240\025\227"
+	.ascii	"\030=2sN\327\356\360\036\344\335\240\336.\301\325\233Ot\275\221"
+	.ascii	"4\352p\227 k\316\t@\007\004>\220\241\363Q\020H\215\357\213\256"
+	.ascii	"HM\243\256\306U\2440\347\264\216:\032wx\3336\333/{\203\004\277"
+	.ascii	"1?s\366$\330e\255.\311\005\361\321\237uw\017\034\345\302|u\037"
+	.ascii	"#\215Q<\311\316i\316\037\033\337\310D\355\324\343\322\207\021"
+	.ascii	"^~w\204\f\331\365\350\317\346\341t\205\354\177n\220]\363\241"
+	.ascii	"\233\365\335\037\340\275{%\252U\240:\265jT\250>I\265(\325\341"
+	.ascii	"\252\345\252A\251^P\255\253~\001\331\304t\246\2449g\374\316L"
+	.ascii	"%\351\304\307{\377\220\375#~Q\317G\3404\272@\344K\253\217\266"
+	.ascii	"\031<\311\276\203\321\262\341V8\334\213\315e\225\233w\3411\345"
+	.ascii	"T:|x\275vo\370F\033b\024\373\024\360\200\022\002\\bm\270\342"
+	.ascii	"\006@\202$\\\333\263#\331\207@\313\2343\202\377\344G\"<\202\004"
+	.ascii	"\211\360r\321\214b\004\250}\327\325\332%`\3721\334\027=%\224"
+	.ascii	"\244\004\264\270\3359'n-\327\367\275I\216\337\3031\231~\224\205"
+	.ascii	"\227\2724\212yN\b\256\\\261\227\313\341C\273\022\rB\312\354|"
+	.ascii	"\327\301e\2107=\341\027\264\313t`\261\227\214\007\006\302\005"
+	.ascii	"\354\246\200L\2076\253\331<\340\320T\244\034s\200c\203\265\260"
+	.ascii	"\325f82\331\314\305s\"\207\2463s\245\240\301v\\1\033\013\227"
+	.ascii	"\203\226k*d6\027O\255fs\251x\363\237\033\344\023\035C\223R\317"
+	.ascii	"\372\310\025\262(ekv\267\350\202\257VF\203\257\366;\242-?j\346"
+	.ascii	" \270B\253\255Y\021\251)\227\243\245\247M\255j\355\n\026\364"
+	.ascii	"\243[\271\305\331\317\262\002\303\2312\330,\335@\300\242\332"
+	.ascii	"\2176P\233\272\202Z\024\216\236+\231IG\250Q\034\304\024U\b\251"
+	.ascii	"h$\242\021M\322\001p\002\0212\263\016\020`W3I\322\032\331NsN"
+	.ascii	"\336Z\t\374 \321<\224\232E/\315\275\007\2204\032\314\376\305"
+	.ascii	"7Y\255\277\365F\275\002\303'\261\350x\204%R\233#0@=\235\t\f\264"
+	.ascii	"<\261\333a\244\334\3775\304\254\353\332\207\232,\303\222\177"
+	.ascii	"\335\327\005\242\021\001\036\177$\242k\035/\257\204F\202S\300"
+	.ascii	"\207\013jp\337\267\355%[\331\"\306\224\25581\212\307\222\274"
+	.ascii	"J\247\267\r[r\336\336\252\327C^\363\0251\352LdS\315z[\373\237"
+	.ascii	"\243#0\025"
+	.text
+	.section	.gnu.lto_feedforwardApply.34.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\234\024\235["
+	.ascii	"\232\226T!L \320\322\351\274\371\"\277\274\324\345\374\301e0"
+	.ascii	"\276\247\362kD\325\261~\353\303\226\321q:J\333\3200\t\034\254"
+	.ascii	"\362(R\255\344I\351\b\236\022\006H\254\212.\314\210\177\317P"
+	.ascii	"\226C\343J\226u\330\371U\253\252\252\352\242F\222\354\224R\n"
+	.ascii	"\374\001\315\001\013\002l,:\027\2573\221\350|\257\363\360:\253"
+	.ascii	"\327\371\333\331\207\316\315\201\321\257\354\254\241\270YW#\323"
+	.ascii	"\302\265o\230W\245\325t\247\351F\323m\327\275\245{\205\356.\335"
+	.ascii	"^\272\333n\274\3560\335z\335d\272\313t\237\351\037\346^\243&"
+	.ascii	"\r\234]\341]\037\267\037\037\323p\333\253\330\352}u\242m\335"
+	.ascii	"\013\334||D\303\255\024\206\026\002\333\212\255\002\367]si\026"
+	.ascii	"\272\205\376\322`:\257\305\364\230v\241\315\364\036\037\317x"
+	.ascii	"\340I\312H\353\220\371\200\215\036X\033\206\214\013\236\220%"
+	.ascii	"YZ!_he\201k^\316\314\272\270\265\221\025\336:\330\302-\262\013"
+	.ascii	"h\375\212bak\332q[\334\n3\362\202!.p]\327\021=\344\033\305\036"
+	.ascii	":3\224\371\310\314\257e\210\n\264v\241\305\201ya\"\005\264\351"
+	.ascii	"6@j9\\\342\\XW\272(F\321\336s\254\307\306uu\"\007f]\327(N\026"
+	.ascii	"{\310\314\334p\035\007enU:\265\265\022t\274\354\006\327uM\"\273"
+	.ascii	"\350\366P\355\241\333\303\207\322\320~rjbZRJB:2*\"\032\022\n"
+	.ascii	"\002\372\361\351\3419\356\030\213\304;T\337\241\334u\255\276"
+	.ascii	"\2512\225\036\331\352\247,\3554\327M*\324\033\341\230\366\013"
+	.ascii	"\233S\225\356\212H\221s\246\270^\212\203s%,\235"
+	.string	"\364\346Hn}\244\236(2X\326~an*\017\241\227\232n\013\253\342FX\366\250x\021\021\021\306\320\332\024\027\"\302p\"VB\0071\211\342@\315\025\245\177\230\250\271\317Y\367\234\361\2319OY\037\333\302\226\370N\031\337\bn\224\302\241-\214\314\213\034\234\210\2155\261\367\274\374&\351\241*\342l\017\211\317\021V-J\203F\303\361H\021W\375\302\306T\344\272\256\275\327\345\257\212\b\304\213\323~aY\324\"#T\244]\327\376u$\352N\204\261\256+\273\364\210X3\262\231\035\006s\313`\026*\006\322\342#\271m.\253\017\216'~\222\035\333\026\365i3\355q\2013\3744\027=u\357w\nu2\264`\303\231\342^c\005\026X\340\366\360\276qK\314\2341.\237\262\030975\365\323xD\333x&\020\320\352d\350rB\006p\374\007Vn\370\352\337x\007\354`\257k\340\266\270\256+\013n7\035\330"
+	.ascii	"\367Z\017\371\001\033\336R\033\267\207\303\3576J\036\325\253"
+	.ascii	"\337'\220\305\300\016\032\271\215g\216@\002o)\325\177`\257\364"
+	.ascii	"u\375\026\377s\333\202b\034\242k]\271<\324x\035d-k&\352S\366"
+	.ascii	"\377'\256a\003\373\375\333\253\016\227Oy\310\231wL\340-\355\207"
+	.ascii	"b\255P\340\300'Y3%\215\277c\313\031\237\274\023\241\307\231\255"
+	.ascii	"\232\336R\031\337{\335(\334\205\320\027\375\255V#\f\004\363\033"
+	.ascii	"\334\251\357\272i]\233.'d\246\333\362Oc\356\237N\247S\376'\314"
+	.ascii	"\327\231\310u\326\240\3254\017i-\335\027\\5\177X\371`V]\347e"
+	.ascii	"\247i\356\301\243\2674\357\350\025\232u\344h/\3158\272m\276\321"
+	.ascii	"x\315T=\327m\243\3034\327h\275f\007\232L3\215.\323<\243\3174"
+	.ascii	"\313h\272\356\251\353L@\243iv1@\3335\267`\321]\232Wt\227f\025"
+	.ascii	"\3279\305uFq\235O\\g\023;\316\002\\\347\022F\347d\321Y\352:G"
+	.ascii	"]g\022\327y\004\321Y\204\3219\200\242s\210\353\f\342:\003p\235"
+	.ascii	"\241\210\316\037\210\316\036\210\316\035\334\231\003\321\031"
+	.ascii	"y\235\237\256\263\323un\272\316L\327y\351:+]\347\244\353\214"
+	.ascii	"t\235\217\256\263\321u.\272\316D\355<\324\316BD\347\240\353\f"
+	.ascii	"t\235\177\256\263\317u\356\271\316<F\347c\321y\307\350\001B\237"
+	.ascii	"\306\356\026\346\213\253\341\325\371i~\213\377\352\3020s@\005"
+	.ascii	"\260\371\361\361+<\254\237L5\375\2419\331s\023|\"\201\333\246"
+	.ascii	"&PT/\3227.\336\351\237^\211N\3233\275\323'\351A\2434\275\245"
+	.ascii	"M\177\337\232\\\375\212g\372\026#\305\215\003\337\342\257\276"
+	.ascii	"\221H!\303\266\2650\343\326\351\257\314\250E\314\333\330\212"
+	.ascii	"\037\201\333'52c^;g,\350\323X\307/\275\277i\233n]\327\256\035"
+	.ascii	"\277\364\367,J\013\324/\250H\317~\376\t7_\033\013\345\250\364"
+	.ascii	"0\213\205W\300xr\274\n!m\003Y\013}\352\215\017\201$\206:4?\336"
+	.ascii	"\3057?\304\rJ\217\364?^\325Kz\245W\002Dz\253O\372&@\226-*\002"
+	.ascii	"\222)H\337\243\305\356\rm\006-t/\246S\301\243\267\372f\333\242"
+	.ascii	"F\177\364\215\204\311\224m3z\237\367\361\377\002{6\343"
+	.string	"\213\336\350\223T|\321\023\303\316\344\260lQ\037\242\317\361\314o\326L\364\211\376\351\260\201$Z\350\207\376\322a\317\202^\350\033\314\031\231\236Oc\243\037iw\203\003;V}\257\275}\331q\361_S7\350\333\211\221\251\242\203\340`\320\022\252@\255X\271=\fzb\r\202sx\200\252^\205\303\262-\177\371@\t\204\231m\351\361\313w\001\207\215\363\363\336\343\237\354X6\032\317\343\177\276\375z\206\231\262\351\361\323\230\307\323x\022`puhvh|\363\265\253\201]1\266\314\354\036p<\023\030Z]\033\034\317\343\203,\221\303\016\372\374\216A.\266\210\t>\377\203\367\302[^\216\327\361K]\330\301\032\337\3639\276\351\260m<O\365=?\364\302\262y\324\271\032@\301\006\317\367\324\260\367\226\307\345\323\342\221\204\257\323\235?R\355\374\265\322\244\353\267\210\035\247\357G\201P\345\032\237\231\245\272\020z\345\305\037a\337"
+	.string	"}\203\302A\345\240r\267\207-}S|\343#\001z\325A:\361\231c\034p;=(p%\005\356\314z*/\300b>\2371*"
+	.ascii	"jja)\2357\226~<\263\262\200P9\231\317gs\306\2213\353\271T&\360"
+	.ascii	"\324\312\3122\300\210\371TB\220\201\363\026\237X\314\245\223"
+	.ascii	"YCH\371\274b\"P\205\245\004\002$\353\200\245\323\247G\253\207"
+	.ascii	"\022\250\212\311\fBE\205\001\323YC\253\207\222\b+\253\371T:\231"
+	.ascii	"W\314\3452\306\023\253\231\025\344\311\324\"\262\302jZ)\235L"
+	.ascii	"\fb\0201\201(\235\t,!\020\302\304\332\321jf\240Ty)U\345T\nqf"
+	.ascii	"\371\250b2}$\237?\254\232W>\222XM%\220\344\322\251\225\224Br"
+	.ascii	"V\020\2463\371\314\312r&\217tk\253\353?!\362H\256\217\002\322"
+	.ascii	"@\344\273\256A\210M\347\250OL\035\002\226&\r\236\200\024/\003"
+	.ascii	"\267G\177\004<\212O\361\017\310\266E\331\254A\241Du\032\362\032"
+	.ascii	"\274\f=VP\306\237\370!/\005\207m\213BC8\361\275\246\031\230s"
+	.ascii	"'mS\326\364i2\336\270D\211\rL&\372\370Rx\211\027\340\231\241"
+	.ascii	"J\240d\336R\023\217,\342{\026@\375I\231\241K\374\f\324\254\307"
+	.ascii	"\250\255\353\252\242\207f\240L\272Us\301\313@I@\203\246\245\335"
+	.ascii	"\036\n\360-M\3025\206\333\242^\2117\266\025\276\345\255\350s"
+	.ascii	"c\302\322\220{\3013)\311R\327\206*\217[#<\024\210Z\342(%\337"
+	.ascii	"\213\267_\274Y\357J}2J\212\304G\r\360#\236\3043\255\031\361D"
+	.ascii	"\263$\021\\D\314\031C\n \312\357\334.\304\007"
+	.string	""
+	.string	"\"\004"
+	.ascii	"\017\342\223\354X<\324\003\360K\200P\177\247M\242A\037\340\021"
+	.ascii	"\036}p\272\017o\344r\3636fD\344s\375\245\371zGM\217J\320\325"
+	.ascii	"\017\360_D\256\200\021\3450\026\226\231\033R\203V<\213\377J\""
+	.ascii	"\247\350\323\244t\034\234\321\217\0067A.\"7n?\374]\231\302\305"
+	.ascii	"f\360\004n\241L8\212\261q\033\344b\253\002E\315\340\240\207/"
+	.ascii	"a\352\351o\255\303#\337\303\031\207\357\200|\016\177\331\246"
+	.ascii	"\310\361\302\022\035BF\231*\252!A\274A\363\226\027\201\234\250"
+	.ascii	"\2018\344\220R\206dFD$I\222Bc\201\005\304 \306\2343\333\021\320"
+	.ascii	"\240c\322\031\232\231I\n\031\326\004\371[\204\221\003(\305\275"
+	.ascii	"\236\030%0\023\313g]R|HH\372\nZJ~\376\376\224\013\325\213\267"
+	.ascii	"\254\353\2051\270\324\356fz\363+\312\236\307_;4eX'\237\017\342"
+	.ascii	"\311 a\370\330\355\261\020U\332y\374\274wW\023x\366\236\006\224"
+	.ascii	"\254\t\345\3558\325i\334\317.\364\267\354\365\217tAx\0243L\364"
+	.ascii	";\3220\315}XQR\203\350"
+	.string	"\317\006\b\345\336\312\241\355\005\374n\263x\263ge\303\323C&*;\377Q\027\276\354\275\307\251R\243@O\256d\341\201\334\232\204T\360\262M\362\366\355\356\205\253\035\317\247\305>\217\207\355j\300\257r\216\326\205\262y\210\235>\206\303\201\313\026S\272#\235\342\332\203o\016\377\366O\270\376\231\267\231)G\257.\354\310\302\304\373^.\276\254I\266\220PF:f\363\035\t\264\316\021\024\254\257\305\356{\202:Dg\034I\217L\342\352\033\204\017\266\261\013XGG\205\344\360S$\264t4*\030\303\013&\257c\201\276N\330R+v\027\323\376j#\020}\234t\036\334P\362T\350\302\031\234\234e\"\314i\243\201\255\271\002\372\036\016\266\314\365v\233y=\364\021\301\024\361LK!\333\035\301\230\0169\200\243\334\255\302L\332t\342Y\211!\025\262\026\350\303\200uzgn\027C`\300\265\302\036S\306Eb\f\b\260\257("
+	.string	"\372\225K#\367:\334Q?p^X\346 \245m\035D\034q\001\320\013\354]\354\213\016>\374Q\373\210\226\200 &\332\217$\223|\034\035\0277p\202\322i,\3167\211\313\250bN\177\005\031\226\204\263\345e\220_Dt6\221G\361\353\260\355\006\201e\270~"
+	.string	"%\333\215\022\332\332\210\236\246\304\rs\316\007C\275\2764Z~\275\261\362\2160\316y\325\025\243\202"
+	.string	"\3500\021\376\3301R\321m\315\370\254\247\346\221e\257[mz\004\2275\354\355\360\324G(\\\025\245(\302o\020\307F/\303\234D\3750\371\330\251%\266\264\027\t}1\303\307\226\246\253\335\355\b/u\037\333\251P\330\2223~\013\374\335\344\202OG\324)n\206\216\265\316\251\237\261\2672\262%\313\025D\346X(\035\327\001\027\374A%\311D+\035C_\021\030]\236c\343\312\271;7\214\017\324-R\270\356X<\276\344\303GQ*\271\001\325oM\345\302\367\305\225#\"6vQ^>|d\317?3\263\337\331f$\234r\f\023\250\362\345\nHE\016^\036:\027g\b\177\306\302\210\203\334\023\244\256\2647J\363lM\223=\214\307\207(@7I\272>\005\223\270\234\274\366\367\241t514aW\223\337q@\324\"y\322K/\245\3264f\333\312\327\346\017P\301\030K\242\006\360\021"
+	.ascii	"(\0229o\177I\\\203En\242\3674K\270\036e\211\246?\266\2103\235"
+	.ascii	"\324M\376"
+	.text
+	.section	.gnu.lto_applyFeedforwardLimit.35.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\205\005\265 "
+	.string	"\346y\313J\240\326Q:\326\213\374\321\263~=\345,\364i;\307*9\215\t\255\206\277=\313y\372(i\315\016\0377\3531\315\345\230\237$#\216\254\217~\035\246\215iC\232\034'\210\321\344\316o\301\b\323CkT\326\376\267F\b!R&\031\272"
+	.string	"\244"
+	.string	"\267"
+	.ascii	"&\200j\004\f\321\340\306\227\034>n\222\b\327\202\363m\254\326"
+	.ascii	"\306jU\261\343G\255\365fq\260\237\273\273\237q\032A\273I\363"
+	.ascii	"\370\024\205\n\207B+.\265V\234\315o\350O\3633\350\317v\361\240"
+	.ascii	"\333j\264\231,\006K\321\323l\016\332\247\017L\0313r\f\221\204"
+	.ascii	"n#\240bD\3615\251\243&\246\025\255N\360\214\231.3\021\2300oW"
+	.ascii	"L\034\263\251\265^\352\250\004\303L\001E$Igr\304d\032  u\264"
+	.ascii	"\304)\032\344S\351\246\211\240\210$\311\206$4oKVL\271\325\331"
+	.ascii	"\b\211\210\273\b\210\336\240\264^\310\220\204\315\351\203Z\353"
+	.ascii	"\362\020i\3047\346\273\017\260\273\027v\315\257\274\334\363\270"
+	.ascii	"mI)\304_\207\322\202\022\322X{C4\326\024=V\301V\201\325*\264"
+	.ascii	"<\254B\020\306Z\353\201\357\330\335*\177\261\n\354\251\036\325"
+	.ascii	"c=\360s\246\031KII\304av\217@n\247\335\367r\271\324\262\315b"
+	.ascii	"\3677\376\232W\3754"
+	.string	"?\376\267\333\370g\230W\346\307o\314\311k3yk\314Kc\336\031\363\312\2307\306\2740\346M\231\027e\336\363\3445M\336>y\331\344\375\2007y!\251\030l\325J\\\202\251\3123+\306>\307\257>\034\307\236A\2222j\255\263\017\273\263\237\337\r\332\235\355Vm2-\353\323*\210\245\246a\035k\246\022\224\002\246\rkY\022\325\226\240\021\310K\245\"\2421\326N\2336\332>d\022\"\366B\341\312M\302\270\256$\247\243\323\241?\323~\025\224,\232F;\207\312J\220\313\020/\031\306\260\250\204%\013\234]\001\311E\323\267>\333\001\225WP\n\250\343\347\257ej\336\374\210\021\023\315z\023\351N\221=\250|\234\261P\234\334\273\253\340C,\274\352I\255\225\301^\310\265v\373\250\237\213\201\307\033b\27157\315W\220k\210\227\317\001Ni1\333is\336C\337o\201\204B\304^v\377\343@z\373\250\325"
+	.ascii	"\304\037\002\241?\337)\022G\227\245\241\333\203\003\324\363\313"
+	.ascii	"\361p>=\036\257\247#\340\347\263\353\375\374t\023vv\022~>:\237"
+	.ascii	"o\203N\200\237\b\254\333\220!\307\341\004\332y\310\231\253\203"
+	.ascii	"\263\343\313u\360\365xvt:\036\334\257\307\302.\003\017\316g\227"
+	.ascii	"\343\341t|@8\034\233\355\375\350|\270_\257\347\303\315\216C7"
+	.ascii	"\353\212\270\242\034j\240\315\326M\356\345\204\277Z1m\333*\""
+	.ascii	"\032k\265\256Z\323h\232*\326X\252\265\n\321\332i\213(\243\020"
+	.ascii	"c4\b^O\302$\354W\217\2458R\243\020e2\275fz\353\2306J\360\231"
+	.ascii	"\276\325cR\204\256t\2315\326\267\226\351\345`\226\355\332\242"
+	.ascii	"\362%\2735\255\177u^\"1e\002\331\305U\323\263\246\311zfL\003"
+	.ascii	"o\250\201@\346\214\202\202\231\021RPR\230\326\220\002\221\261"
+	.ascii	"2n\021\240\251dC3Je\230\003OqJ\3144\224\337[\354\204\262/\214"
+	.ascii	"$\207P\217\357\275\30047\034\177\226\215\245\364Di\337m\224\224"
+	.ascii	"~5\266~\307\007k\2200/\\1\220\r,$U\004x\2450\2667\345;V*\222"
+	.ascii	"\232\366e{\371\357D\261\275\016s\263qb\022\035\257e\003Zs5\312"
+	.ascii	"7\362\300\027\354\020@\031u\375\234\204\202\361\004\t\211~\273"
+	.ascii	"\225;m\362(\243PL\310\331\244\317--\237\310Q\326\224\217)H\263"
+	.ascii	" \270\327~\327B:T\b?\242\013\006\004c\251\333\277P\013\201$\006"
+	.ascii	"lV\302\201\304RT\\Tl\240\"\021\230k\267\240;\351]\301\246\b\365"
+	.ascii	"J\364\006U,\320\222t\364\342\023x\302\033\321\277P\375\376Aq"
+	.ascii	"\326\351O\r"
+	.text
+	.section	.gnu.lto_shouldApplyFeedforwardLimits.36.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"%\f"
+	.string	"\306\027UB\020q\224\016\003\001\237\322mI\207\241\\'\215\034\034\240P\007\n'\003\375\352\n\307\013s\372#\243\377\353\177\364\333\307\205X\277\231\355\252"
+	.string	""
+	.string	""
+	.string	"\315t\272]\333\3774*\244\"\001\356j\236\354-eJ\001D"
+	.string	"?"
+	.string	"B"
+	.string	"\254\203\204t\244\260\261\333E\005\271\351\360i\232\374\217\374\321\b\231\261\342N\207\032\376\262\335\265p\034\251\317\200\353\203\214\013\247z\0048\270\310\360\221\247\007\227\312\004\340`w\235+\016\303\215\3356\004\333\t\354k\002\037\206\027\3715\323\251\351c\227\024W\203\030\273\254W\312\302\200&#l\227l\213\355L\373%n\242t\021\267p\200]\017*V\354.\002\307\312a\366\001\330\341\273"
+	.string	"\354\320\2665\nJ6\275\003\021\0338X$^I\201\353OHNT\211B:\211K*\273\313\300?q\024!_\304\241/\214\362\253C\177\204\035^\027\2040A\345\353gQ\303\325A\265e\314U\037\274P%\212\335\235R[\366\337\356\2565!\020i\363\314\311t\266\315h\323>\035\217\347\023E\022\"\200&|b\005\320\206B\344l\241\230\311\254Y\360lQ\244i[\264t\373\267\372\341|\007\236\212y\252\207m\250\031JSN\205\372\216\033\250|aP[O\003\021"
+	.ascii	"L\204^\316\206\307G\021*\242\364\020`\023w\306\201\370U\024\237"
+	.ascii	"\021\343\202\3422JQ\343'\226\205A\302\245W\225\257\234\315\262"
+	.ascii	"&\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\341\001\315\t"
+	.ascii	"B\01796P\255:\304,c"
+	.string	"X\207\204\252\2008\023\021\242\335\254\221\206\204\226P\033*\213f\022\252\252\"\252\b\360\t\\\327u\335\354\366\377\336{\373\377\333_}\263^\372I\246\024\n\241Z\325\220\030\251\310\232\037X\273 BbaiF\241N-\255\37147\233\360xm\315\rs\365#\343b\2655\007PZ\013\202l\270\264f\200K3\206i^V\246yU\\\363\316\256\331\301kf\330]\275J:\276f\212\20026\227\377?UQ6\271\250\344#\222\223F^\022\271)\344\003 '\3708\202\307\r:\236\300q\005\321A\373\377\252a\350\241\235l\374#]\032\367H\220\373\276\346\367\300\316\343\272\314A\253\252\210)\340q\034\307\213w\244\2466Q\333X\302f\325\235\237i:\3421T]\225\203b\367\377\277\342\034\251\2522$)  \0031j\007(\342\026\316wt\23193k\327\320h\350\006Q\017\3053\245\036\300\021\034\300\001\034\340"
+	.string	"\016\340"
+	.ascii	"\016\34008\374\201\024\263T\261\205yX\203\200\336W\265\026\261"
+	.ascii	"&\255\2019\211\035\2341\321\304\032\355\371\020\r\343\031s\231"
+	.ascii	"Z+\216\001"
+	.text
+	.section	.gnu.lto_.refs.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375 \316\235\004"
+	.string	"\"\212\036&\200K\322\001\330\2217j"
+	.string	"r\3749\001\2070\00330\00330#\030\006\007\247\242]\024\033!\215\264\221\337\310\226)\217\353@\257\262\033\330S\353]\366\210=\313\276\330S\376\307\323\341l |\315\3733Q\037s\261d\277B\231HZ?\002qH\177C\3523^\177\341\372\212\326\023\356\021\322W\355\013\321\023\262\017\262S\354\037\0168,\200\360\251\377 \334\255\336\260g;\373\037\001\013\004\001@ZN&\243\025"
+	.ascii	"\242Ur\270\233\314(xS\256\0263"
+	.text
+	.section	.gnu.lto_.decls.b09d046b3d24d128,"e",@progbits
+	.string	"(\265/\375`\374*\025\265"
+	.string	"Z\031\365>Y \nYI\035\201\327\307\213\036\n<\312\342\t\251[|^\303\376t\250\025(\262\212\007\261Z\343\341\r\221\301~|\353\036l\330p\333\005\334\322\345\306c%[G"
+	.ascii	"@A\3213\241x\222V\235\336\327\313\201\300**7U\251\302e\333\316"
+	.ascii	";\031\344\356'Et\bI\223R\312\024s\003\370\003\001\004|\306\t"
+	.ascii	"\303\006\f\177\2337\3766h\374m\276\370\333X\361\317f\377\271"
+	.ascii	"+\013\311e\3309\003\303I\022\263\274\221\350h\273\025fB\362~"
+	.ascii	"\233\034\374\377\363X\026\313Gr\030\206f\262\f\366\031\212\331"
+	.ascii	">\277\237\001\021\034\246\337\247/,\212\314-\223e#YI\277h\274"
+	.ascii	"\250HY\024\277_8\f\310\024v\241*H\236\275\277\177\301?\317\277"
+	.ascii	"\0022\310d\271\b\016\363u\267^\024\026u\304\247#.K\214\272\336"
+	.ascii	"_\235\016\035:t\340\351`\222\253B\263\337\246\363^\n\374\177"
+	.ascii	"t\374\177s\374\177_x\366\342\371\374n\2510JXyo/\034GqN/\202_"
+	.ascii	"\033\377_\030\377_\020\376?\036\374\1774\370\377X\360\257\241"
+	.ascii	"\343_#\205o\2501\343_\003\204\177\r\024\377\232&\377\032&\177"
+	.ascii	"\232(\177\2326\3764F\270\0054A\370\323\\\361\247i\342OC\304\177"
+	.ascii	"&\f\377\031-\374g\226\360\237\t\343?\243\305\177\006\212\377"
+	.ascii	"\314\013\376\357L\020\177\356\205?\257\302\237\037\341\317\261"
+	.ascii	"\370s'\177N\304\3377\307\337W\205\277\217\214\277O\213\277o\212"
+	.ascii	"\277\317\005N/\267\310H\030:AN\372\334\361\373\274\240\267\277"
+	.ascii	"yG\231\261\"y\277\357\210?\236\240\247\357\356\360\004\275\357"
+	.ascii	"}\341\337\233\302\277\007\306\277\307\203\177\257\211?o\f\177"
+	.ascii	"\336\025\376<5\376</\3769\350\037\333\341!8\254\275\232a$\357"
+	.ascii	"\334y>35\332\022\"2y\347-\256yV\374yN\376<$\234\036\016\203\351"
+	.ascii	"0T\007\327\0051\025\241$\247\274\237G\304C\320\357\260N\357w"
+	.ascii	"\027\376{\215?\376\362\217\267`&X\216\003\275\017\365\336/\374"
+	.ascii	"\250b\274h\313\033Gq\334c9\354\245c9\f\234\275\007a\271 \231"
+	.ascii	"\336\203\202\030K\200\261\004\233+\352\352Ho\377F\3438\b\317"
+	.ascii	"\343.8\275&\323\333\203\301*gsVy\377\006\3433;\213\377\216\342"
+	.ascii	"\277_\360\337B\3745\027\376Q\275\204\277~\371k\034\374u\013\376"
+	.ascii	"Y\f\337\320\3069\220q\013\202p\020\371\006\377\334\344/\366\205"
+	.ascii	"?\032\023\376M\240\374\335\262\370_q\362\217\342\025\034\367"
+	.ascii	"\272$\177\fpL\004\027\301P\r\330\310+ \203\327L\"\275\253\367"
+	.ascii	"7hc\267e7&\357\027\201?\006{\"T\317\340\017\300\037k\350\341"
+	.ascii	";\254\241\367\231\013qN\01771N"
+	.string	"O\007\347\364\376\261\020\334\245A\033\265pv\261\336\337\233\340+\003I*\357\177qN\217c\234\236\357\177W\260\201\027\376\357\003$\340\002\030\377g_&1b\002\022\376\363\003,\300\200\021t\376\177\003\377\237\341\021\360\013\370\327c\376s\004\025\370\307q\377\230\311?\226\373\307\321\177<\367\217\303d\021r\001B\310 \374\277\221\177\f\364\217\213\254>\303\177\246\300K\360\257\213\374\347\017\376\263\007\3779\002\377Y\304\177\016\361\237\033\360\2377\370\317\032\374\347\005\374\347\n\3763\207\377l\200\377<\200\377\f\200\377\\\341?\327\374\347\231\377\354\373\317\274\377\254\3773\376\307w\377\270\314?\246\373\307p\377\370\355\037W\371\307S\376q\217\177\254\365\217\267\376q\223\377\027\341\037\033\371\177\022\377\330\353\037w\375\343 \377\230\353\037g\375c\254\377\017\341\037_\375\177\327\377'\340\377\241\374?\357\356\356\356\356?3\375\327T\370\217"
+	.string	"\002\001\035\f*\256\2039\227\204F`\316%#0(/<vt\347\343\205\235T\21618\315h\250'!9\0055\205nF\257\263_\351\035\213\021\365&\001zwr6\257\004\225\200\321\204\334\222\204\220\00491\006$\241(g\037r3\362\341\354\335\207\220\261#a\300|\335\272\016\354\306\224r\352-\210z\017"
+	.string	"R\357L\334\335z\357\314\336\273\257\351\364\366\336$4z\"!\365\316\244\203\324\235\230iD\275g\261,hKF`QN\2364#`\317^\3642\361\263_\201jr0\346Wo\361\205?\227^\3109\321Mz\\vk^y3\351m\365x\242\313\373\203a\\M\217\275\031\b\242\346L\221\220X\024\211\220\220\347\253\3254\331\220\250N\323Kt\022\255D\257a\250V\323e\257\315\364\331\353\360\274V\323G\376\f\273\211u\025_\t"
+	.string	"\022\327\265\230\232F\323/vc\352\3148\003l-\215\371\361\243\213\362\\\372\355\017Jq\374\342\234\236N0\211?\220\f\177`\034\177 \034\177`\025.\3048=#\331\256\216\r\t\327Dt\021\f\325P\r\366\331\013\273\375&\342\354`\275\2776\272\207\023\026\n'\360\307\034zA\314\241\247\337\254\275\364\327\353W\017\371\r\351wc\t\200\030K\300[\253\n*\322\333\017\274z\273~JJ;\234]9\310\246\353\254\313\033\204\313\004\023\323\220\274_smag\357b\300\027P\255\246\274\365\017\r\004C1h-\271)\241\245\034\034\004\275\337\335a\f=l\307\363\372\204\rvHq\371\300"
+	.ascii	"$\355\tG\336\377:\013k\b\322\f\243\2745\326\277\356\201\323\376"
+	.ascii	",\347\2668\033uy\377^?\365\225\257\205\023\251\262\274\265\325"
+	.ascii	";3\247\244K\\\336\017l\342\177\201\016\261'\\6\236G\220\210="
+	.ascii	"\311\222\b\211R\365\330\312\002\242#\232\2455\025\265\221\237"
+	.ascii	"\336\236\260\021\225Q{\301%\332,\001K\224\f+\201\353b\303Q\340"
+	.ascii	"\254\304\034\211y6g\264E\251\236\\1\264<\265\f|\227\203"
+	.string	"z\216\243\347\032\214-/\215(bX\324=\251\252\204D\255\\q\232\313dt\214\374D\357\310N\262\026M\245\241r\235nj$\335\265\t\332(\177\311Rr\225\234Bf\222\333t\t9K\336\242\213\364\013\335\"_\311Q2\224\314\246\235\364\212\034\315^\364\215,\247\227\264S\007\351\031\031\205,FKi\032\272\206\026\322Q\271\214~\312MtS\016\243\2254\216\334%\217\311t\232Ev\313`\262\225\374\226\355tU\216\323C\232I\037e8mC\353\320*2\226|\247a\350)\235C'i\036\232\251\2112\227LE\273\310S0T\313\310j\237\225\3445\261#Y?\250\242V\264\f\314\005\177\321\357\263\2030\245h\357\235'M)\352f4\346I\206\233\300q\325\270\001%k\353\251\013;\201\323\302`\222\242kQfQ&Y\310(Je\325\025\225\322\306\343\251\206\265\314\340\3212\362\220l\246_4\017T\320\270"
+	.ascii	"K+J\305cH\227\214,bV\244\360\314\nR\003\312\3253\353\204\033"
+	.ascii	"<\336\251\261(\323\225\367\213\354,\233\360\326\244\351\242\013"
+	.ascii	"\nS\317\265%A\236iPg\317\f\262\323\033\233W^\202$\312v\003I\324"
+	.ascii	"\rO\201\333!\245\210L\224j\207W\264+\017\275\335=Qa\367\264\221"
+	.ascii	"\2358\354\206\223h\357/\317\331\214hZ\226&2\264!V\260\320x\346"
+	.ascii	",\037UQ+x\016\247P\204\024\305l\377\231\352*HT\n\0162\267\034"
+	.ascii	"7\216D\313\226\240^\252\344\320\201\306\224$+\001\203\204}HE"
+	.ascii	"R\266\241ed)hY\324\n\\\r*TG\306\2648+\263B\f&\003\307\302kl\254"
+	.ascii	"\314\314\3539\344?7s\323\233\024L\246e\3407\270\247\016:\035"
+	.ascii	"z"
+	.ascii	"B1\256J\300V\373\201\314\274\213\215\036($\371B@Q\013\2644\256"
+	.ascii	"\275\342L\214\016m?\005\347j\020\025\235i:\270\272\250\261m\266"
+	.ascii	"\245\264\322\234\270\224\341\260\\%J\013\241\274\377l\223}"
+	.string	"\t\177Y\300\224\211\301\215\215\261\b\2425\267\204A\303\302\216\2005\250\226L\311\001\205n.,|\205\274\254x\326(y!\313\312\373s\216\212\024\211cf\351\252\233IZc\353[\336w\177\365\312\202\270\354xI\2720\253\346~\177e%\232\035_D&(\341C\376\207\354\251\327C\335\006\224\247\215\363\006\\\024\264\253K\013\021.;-\336\324\342\t\215\254\255\255\315\245\241mJ\226\256\272\236\013\0349T\344\315u\346\233\302\222\032\313\373-P]\375>\341j\003\301s\370\355LN\246\334\001\236\236x\201\251\353FN\034|p<\261\375\370\r\204\255w\007E\203\332Y\277}\374\317\370\340\336\240\020\221\343\273\307o,\032/\264\370\340\362\374\237\371M\261I\221\203\343\217\343FE\265\253F\2300\346\207\326\356;\260p\341\361\273\n\030\205\313\306\\\336{\307\2561\023\305K\207\232\021\0348\366\224\216Sc\301\342\262\323\232"
+	.ascii	"\2206\246\034\277\247~G\204\3345\3112\301\204-\205\265$\341\262"
+	.ascii	"\373!}\225\021\262\243~K\351\033L'0yo\250_\003f\361\372\361\205"
+	.ascii	"\003\203?\3233\355'\035\265%&"
+	.string	"\016\274\"3\267$\333\306\357'\033\"$\033Wy\357\246]\203'FGS\331\256\261\235jv0\255h2\t\242P\2254\265i\3502 \267\350[\336{FV2\372\362\002\212\031\357\261\344\350\007\231\rc\303\3302$`\201\016(\206(\350l\307\370-C\277tViQ\326v\214\264 Q\3326\322F\332.6\304AA)\251\253\271*a\013\227\275\364\333\005\217\t\0260\315_\263!\363\224\005#\357\255\364g\274\257\033iT\362\336I\177\0264\373\272\262\343\317N0\333:\222\367W\030c\301\002\3113\310\321>:\243*\202\356\242\034\244\263\321\232Di\250\330*\314\236\025\216\204\266\220\306\322y;\3237\226\004JI\335\r\031\376\277\231\030\272\231\232\353yC]J\353\331;\023\0056=\270\240Ba\356\356p\030&\322\225h\212\\X\325\325\365\336\204\202]\306\213\025\035IRHA\227\301L\033<\313Di\230"
+	.string	"\021\242B\346u\2313\016\343\b\233\217\274\365\230_\373"
+	.ascii	"\225)V\362\326b\364\213\277\340\310\3024\021\234\020\260/,\030"
+	.ascii	"\252\261h\272\031\243m\207%\332\233L\024\004\267\206(I\243\373"
+	.ascii	"\327Y\264\026\035\346\007\344\212\241\303K\336s\2762>\204b\344"
+	.ascii	"\3757Q\374\213\226\303P\rFwy\355EG\2734\030=\246\343\260\233"
+	.ascii	"\030\bZm\321\0134\030\315E7\311 d\264\353\244D;t\b\302U\3055"
+	.ascii	"{qz\013\022~4WFL\336\231\303\215\n\376B\273\234\236\357\353\204"
+	.ascii	"\\\340\3404"
+	.string	"\026\276\351=\350\311s\355\rC\365\233\306\322F\273\013J\2647\233\024\274\220\b\377\327U0TW\301a:\033\2409\211\366\346K\301\013\263\370\353'\032\312k\266g\323S\370\333\225p\031\026\224\222\272\316\304\304!\b&\007\025\031\267\327S\276\313\257g\230\251\232\253\243\312\373\347t\333\377\317\324Hirq\245M\n\357J\214$+m\365\037p\021\302$o\250\216\222\325\236T5\371\222\367\013\203x\376\357\365\240f\357\335\005\357\355M\241\337c\036\306\034\376m\260\306\004\370\377\335\373\377;\340\003o\027\272\223\002\303\263\316\202h\374\206\376\357\326\373\020\024\363\001PKCP%\030\201Au\346\220\025\363\246\331\241\230F`\275\337\364\241!&\007\316~c\004\326\227\272\n*K\270\277P\314>\344\3547}\250\007m0\032\202Z2\002\013Z\2721\002\203Z\352`P]\330\207\202\232GC\275y\023o\364\2604\272)2"
+	.string	"=4n\312\036{x$$\0301\001\r\035@ C\217J\002\020\tnRm\333\037\021\256\352s\341D\n,&S$\222\025qC\202\003W\365\240\270*\371\033=,\217\307\224htS\344\316\322]K\354\374$}*"
+	.string	"\372I\256\307\n0\3700\374"
+	.ascii	"\002hG-\376\034\211\311u\247]\376\354\354\234`[\243\313&}=\251"
+	.ascii	"z\334\3562\311\022y=nrm\217=\325M\213\312\013`X\226\bAT\217="
+	.ascii	"*\007D\022\\\325\247\302\033=\020\333\035b\017\216j\242\375\021"
+	.ascii	"Asay\374a\215\313\f\035\24496Iv\025\252nJ\\\217\312\237\"\260"
+	.ascii	"\250\252\312\0217#L\250\255\362\307{\243\207\235\342q\375)\201"
+	.ascii	"a"
+	.string	"\006\305Q\251\f!t\227\303\242\232\\K Y\021\032z>&B\244\356Q\345@x\001(\r\241\202\b\340op\327\344\007\301'\256\255\232T}\370c\360\241\202\017 \200|\017B\003\0134\260\240\367 4\340\341\321\340\003\017\377\017<\332}\243\207\235$\213D\262D\001\024U\344\332*{\313\241\032BQ\365\361I\2179@j1\371\301\t\366FM\261\2168\301\026\223\353\t\032\344\317\b\237\344j\202E\316\364\374\224\320\256:\fqdY\b\fy>Wg9\034\241\270*\177)\214\303\3452U\236`\217@\236\024F \233\254\340\276\321CqU\352<\253T\333\035\227e\333\235\232\016\360r\330S\\\225\275\021\360\007\230\003\\\\\225\232g\004\345O1\271f\340B\315\211T\003?#\212\253\022\230\\CpC\024W\245\320%\252==n\253\272\307\325\035&\331\024k\313\032uP\270\253\211\264\365`u\223i\220\004"
+	.ascii	"Z\326M[\325\002\t'R\0247G\225H\f\001,\372\b\213G\326\270TWV\351"
+	.ascii	"\252K\035\025\271\2724(\322\243Z\254\261\200\023\244Ia\034\022"
+	.ascii	"\227"
+	.string	"\026P\264\252\t\226\250\266C\3432m\211@`\216\313\002\205kM\252\263\\\201\322\241\317O\t\265x\341f\211\034\026S\325\230z\200e\217\303VM\256lKL1\boZ\266m\325\013==\254\373C\034\022\207\313\022i\005U\211\302\035* \230\3028L\256\356\360\003\017Oa\f!\251\022[u\004\022\031@P\217>\311\020\027\222k\352\301\215\253.U\022Z\325\307gmI\234`\217\307\020G\266u\223\254\b#1\371\223\036#\030\252\313\237\n@\351Qm\207'R\024\303\242\352\246\255\217\352&W\013)\3266U\223+\b\356\362\2475\2728<\032\225\230LM\024\323\242\215\373\243t\177\330a\313\272,\262B\317M\376\260\304\341\361\250\022\207C\326\375I/\034]\227m\215\356\320M\252:mj$n\025\231\212\240\036\327\036\266U\326 \225B\345\032T\227\251\332\022\223\253z,\2569Ivu\327e2m]"
+	.string	"\370$W\237\264UM\2449F\227e\221\313\226u\211i\217\273v"
+	.string	"\203\273d\331\0227\356\212\\\217C\025(E\006\200U\002\251\303$\212\342\220\247Gy\304Q\211i;<\252&\324c0\271L\252J$K\034\372\244\313\241\233\2260\221\243\026Y\344pY\264\260L\221\031\214DwU\016\217G\266\025\300z\263*+\260\253\233\266\303\344\212,\346$\327\324g(\200\013\356\020\204\233\\\177|\317\303#b\303\005D\360\200\023=\024\333\364D\313\366\024U\265g\3075\372\254\307\236\235\344\232\"w\210\355r\307\303"
+	.ascii	"Zu=*W\367\370\203\034\266\252{\\{\206\310Vu\213\303\242\272\366"
+	.ascii	"\254G%r]\022\340\2310\331Pp\263)\207\201\023"
+	.string	",/\321\272\316\004\203\303\377~\362\033\312\217\"\\\322\362\336N\232\344,\251\222r\305c\311\353#L\313\212\022 F\352\314\\\250M\005\203\241\250RQI\345$3F\210DDD\2224\351\342\n\020\006%I \271\262\003\022\3003IP\223\312\241\021\021I\222\244\306~\315\001P)\270tO\267\365\023p\026\215\334\343IN#\t\271\245\203\246\202\\\t\240\2779N\365\261\314\202\256\302TC4\365PN\247\177aj3\370\323\006=\323\r{XT\204q\315\331,D\267\334\256\344\305\340\030\253\323\b\251\007\354\343hL\025\353\b\316]G\t\276\303m\242d\207;\300&\315\200\004o\tw^\216\315\240C\301\265A\344$\271\022\234\227\262\327"
+	.string	"\243y(\370\215\tj.\b\360'B5\213<\2471\307}]\353x\t\262~\2076\301\232\234\345g\374\0364\375]\\\237X\333\001\275\345\244\247\232;6\251\025}\211\216-\350\024h\357\263\337r\206o>:\320\321\334\226W\f\033\0136U\232\323\3451\240\266\f\340'\305'0/B\317\250Ek;\3314\237 \233\315+\371\220\022\314\310M\bHZ7\013\234\234\243\020\312A\027\222\327\321\035&V\rR'\344\302\301\317\347%\255\212W\202^\253#}\230\247&\035B\335\211_\bS\322\264\3667\233\210\"\206\022s\004\231\206\254\212\262\203\021\210\322v\t\267\227\007\303\251#\177^V\364H\345#VB\316\245\033\220\212O\327\251\026\317\342\033\224\201\nW\021\2107*\243\204\323X\234\017\032f\315A\364\205\317"
+	.string	"\032\026\361\no\024\355\036e\261N\230\r\373\324\253\225@\r\204B\303\262Fo\316\3102\t\037\020E\244\230,\245;\3221\207\022\001\367P\237\215*5\346|\001\223\343\0235_\314~\035\271j\\\364\363^\311\317A\367\334I\330e\375\354\260\024\350\341\351\326\240+1AP\224\224\231\005\325\356\355\272m\225J\225P\277\210\312\300K\"\336\317\202\242k9\346\264.\242c\244\214\370\232\217\263swv\316X\016\374\305\251C\306<"
+	.string	".-\004\303\342Q\200(\226\315pHj\022/\263\354\3172W\371\331\220\031\337\005\362q9@\036\217\251\364&\0324\325\246j\367[\373\212\026\320\230\217\312\006\224\205\230\177\370\013\227T\375_\200P\354\016|\267"
+	.string	"Q\346\233q\214J\326YJ\371t\321u\336+\0321UN5\016\313\034\213?\206yXa7\210\003!\260Z\335T\257\252xXoD\370!\204\216>*\037\215\310`G\341\027|\264\035\372\273\247\031\320\331\224>>\006,\037s\373\257\365\037\355\225tW\210\207\302?\360RS\264\"}tA\243:\321\265\236\022J\303\206X\261Q+w\313\263:\334\327)\245oc\311H\b\354Z\026\331\370\210\356["
+	.ascii	"t\225\024@\354\237\203\203X\364&\227\n\343\302`\002\364\334\254"
+	.ascii	"\267y\330\303\355\334$\213v\352aI\352\353\255\344e\267\237\360"
+	.ascii	"\240\372.\020\205\350i\312\3108\340\2348,\307SD/Z\320\343\225"
+	.ascii	"1\230\235\265\323\267?x\324\212"
+	.string	"\324{\302\343v\033\350j,\301d\021\375\367\230\375\252\200\274X?\274\356\352L\n\222x\220\320%x|\220\222\002\177!\317~w^\366}\370\021S\260\317\375gU\026q\342\b\243G=5\215[\311\254\004\353\331J\330\252P\356\247\266\306\371\212\217eP\224\253\201RB\247\"\032\206o\242Ls\227\177\202\265\007\224\r\247$g\n\377X\177\206\032;\201\026\004\354\247\232\326\256\312I\f\007\2553A\215b&s\222P\367\030P\370\371\237t\222\210\020\265V\313\226-\221\2305\b4\364stm\211\275\310\334\262\265\023\302\213\006'\253A\343a\026\315;\030\202\222\242\265F\362\264a\305\272hw\331a\rNe\363\003G\356\215D\034\372Z\264\017\2336vV.\006I\366\345\210\022D\300A4T\253)\263k~G\227sW\274\351>\026\316\352X\037$\342\323\222fh\t\234\241\255\324}\207\317Ph\237[\003\n\361"
+	.string	"q>\211P6\022\233\246\231\217\224\355T\013@v\344s\037\243\323GQ\221\013\323^\362\247\233"
+	.string	"m~\003Nf0\355\265=w!\335\021\244\177\206\031\375\354\303\250\"[+\\\213\3055O.s\276\306\376\374\332\264\214\n0U\334\004\005"
+	.string	"ub\035\365\335w\251pLS\017\303\n+\255\323\251\335[~\b\366^\202\223\310\3468\034\245\365IS=Zn<:\n\217Cv-\021\206\354\305\037\322\2213?\337\347\207\301X\346\355\375\nF\003\330\264\304\3307\317y\346\277\267\020\215\347\241\270.\\Dz\247\020\005\224_\373e0B\234:\177i\017A\366\366)\332\b\341Q\360aj\261\220\321\341 Y\314\r7\370\303K>\204!\031\300\271\262\242l\265\361\004\224Q\344J0dC\022g\260\306\302\375F\232\352 \235`\233\336\255\216r5\265z<2\257\202\222\211\277H'\237\216\325\252<\271\201\3507`\346\347\205=\253\317\375\201\032\367\325\303-=r\304)3\340\367\321JA&\275\275a\375>\343G\341H\201\306\025\035\274`\353\306\367\033N\244\371,F"
+	.ascii	"p\244L*aZ%\271Y\035!\277\313\033\204\214\025ZS\224\216\252!\007"
+	.ascii	"8\375,*\311\027\307\200j\362r\277Q\246~\231\257 \370\312\245"
+	.ascii	"Pc\2221]K\2537\327&T\017\032H\001O\035W\233Y\257R\325c%C[m\206"
+	.ascii	"\377c3qd\032Gk\313\020vC4\177\344\272\202g\342p6\341\231\265"
+	.ascii	"v\237\276\375\310*$\001s;+I._U\210\335\034\211T\223\212=\007"
+	.ascii	","
+	.string	"H\321\036\273s\bL\320F\356\203\270%Ix\360e\367\252\244\252\333\305\312F\177\374.\313\017\321\336\264\277\3433\213;\304\177\302s\375\264\017f\3169^\353\323\302\377\203/\003\007i\234\2650\205\244y!\001\004\232\201tp\256:\267\331\314(\033\030p\322nW\354\261C6\177\013\017\252\262\202\224\274\004\225p\2058w\270\324\321\204\252\017nYE\333\315#\3741\207\020\020\361~\231\202\201\026\001\341q\245\276\355P\217\302\016\316\353\304I\200\001\264\347\\\310N\221\224B\265^\t\272\2574}\303dv2\360\001\212\355\365.\215\025\1778&\251\035\270\236\314\177\017N\260\277\342W\232S\214\374\341<\223\336\353\354\016\316\263\324\337\n7A\036#\216\235fMt\230<&\307 \336r\341\275\241\317\3069\002\267\3567\320\251\332\327\353\243f\343\021F\212\f\034\317\245g\221\337\323\353\367\262D\376H\233\001]\352V\264_"
+	.ascii	"\203\222\231\257\204v4\216\352\207\"\317\353\337\317{\203\235"
+	.ascii	"\334\274*\207\233'\312Rk$\372\323\325\356-\227\356\334B+"
+	.text
+	.section	.gnu.lto_.symtab.b09d046b3d24d128,"e",@progbits
+	.string	"feedforwardInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"setpointDeltaAvg"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"feedforwardApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"applyFeedforwardLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"shouldApplyFeedforwardLimits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"getRcCommandDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"pidGetFeedforwardBoostFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"pidGetFeedforwardJitterFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"pidGetFeedforwardSmoothFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"pidGetFeedforwardTransitionFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b09d046b3d24d128,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1508 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`/\002U\r"
+	.string	"4\022#\003"
+	.string	")"
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\335\264\214\277\017\024\002"
+	.string	"\002\004\005\002\005\005\352\263\360\321\b\006\331\265\256\232\002\022\002\006\002\006\002\007\b\002\t\002\b\n\007\n\013\247\320\217\212\001\f\357\322\207\337\001\006"
+	.string	"\002\013\002\013\r\016\017\332\231\247\036$\002\t\002\t\001\001\n\002\n\021\022\233\326\340\375\t"
+	.string	"\023\261\317\360\375\017\006\007\002\007\024\026\302\260\206\302\t\020"
+	.string	"\002\001\027\030\362\330\255\243\r\022\002\t\002\f\002"
+	.string	"\002\r\007\013\002\013\031\032\033\034\035\311\313\233\264\003\002\036\242\302\263\302\013\037\342\300\262\204\003\b\002\005\002\016\002"
+	.string	"!\327\235\250\225\n\004\"\313\304\355\226\017\003#\311\204\277\354\005\001\002"
+	.string	"\002\017$\221\326\260\227\004\006\002\n%\301\246\230\212\004\n\005\002\005&\231\324\344\225\004\004'\240\202\262\202\016\030\017\017\017(\247\243\357\305\b\024"
+	.string	"\002)\343\232\341\250\006\006*\323\361\227\336\b+\233\307\233\231\t,-\240\342\234\212\n"
+	.string	"< p\202RBf\0364D\274\205P\030 \2605@\006\026\223c\266\227@vt,'Fw\346\3750\260"
+	.ascii	"\266\301\317\00473A\327\276\306\024\253l\361\231\007\302\213"
+	.ascii	"\330\"\314'Y\273\341\004\325\202\333\265i\205n\t08d\221\346\366"
+	.ascii	"\321\330\006j.E\207\240\023\202\006\230\0043\240\f\3006\201^"
+	.ascii	" \035\316\231\021,;\335\030Z\300\256\317\3277\226ZH\230{#z\200"
+	.ascii	"\300\264n[\034}\340\327\232\231\001h\323\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"M\004"
+	.string	"\342\205\020\026p\213\032\003\374\377\377'\322\377\367\244,l\263J\265\273J)S\n\252\251\330O\234\224>d\334\247\205\324\031\342\360\031\254\360\004s`\n\f"
+	.ascii	"\256F\225YW\222CK\023\251\347R\355w\357\326\305\027\001! \320"
+	.ascii	"\202)\311\016\b\354\271\302\200\013|\036&\211\206\r\354\b\t\006"
+	.ascii	"aq\263\204i\024\\\246\037\211\030A`\220\226\033\364h\006[\237"
+	.ascii	"m\031\375U\242\036\2344\034F\357 ,\334\336\205\301\210 \216n"
+	.ascii	"\212>\004"
+	.text
+	.section	.gnu.lto_.inline.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`j\006=\027"
+	.string	"\206\035cF\340\260(\351Z\200\037}\357\003W\tD\001\026\330\251\307\3558}0]\317\001p\370\260*\r\354\3068\253\214\261,\337\211\177`F\200 \317\355\2207\326\203y\304\374\017r%\246\300\255C\253\177\032\026\r\3557\262I\nG"
+	.string	"W"
+	.string	"X"
+	.string	"\260w\260\333\367\366e\336\331\n+\367\316P\321\3256\364\253\004\321\366\301\026\363\027%\204\361\241\r\024eK>\310\005B\320D\331\002\265\243\204\274\320v\025gy\236\262m\265_EX\333\t\371q\025cm\027|\311\237\b\001\255\266\244I\251x\323V@M["
+	.ascii	"\217J\255\216\342\214\314+\2074\311C\n\237\362,\022\311T1\007"
+	.ascii	"\006\021/,1\304+\347\3041\016\331\310\354\244\030e\005\0360V"
+	.ascii	"\230\314\205\344\227Z\203<,\355Q\261GlgFJ>\\\345L\211\0275(k"
+	.ascii	"\245\026\374\271\b\002\273\321\213[\202it\350\304\272\304\311"
+	.ascii	"\300\002&2\202OX\016\372\300CO\216$<\272\264\3556\200*\b\227"
+	.ascii	"\312\220\013\2302O\261\004>\230@\341bCe\013\234\227\215\317'"
+	.ascii	"\277\201\203\006\017]\215\227\033#F\036p\212\252\210C\006\211"
+	.ascii	"\016\334\001\262Syc\022\377\222\204$\t\317\273Z\226H\2254-+4"
+	.ascii	"\312\017\343\307\257\"L[\323\3667K\306\264m\260\202\035"
+	.string	"\253\274=1-\0134N\227\003\035\r\346\003\323\332\236\331\023\302`a\317\357;\031l\312S<\357\354\272\223\333\316\354\354\\\201'\253|*\357\035\200\241\250A\265t\246d&I*\323\030`\002!DT\346\001\022\240#9\205\3234rH\002\032\nZR#\033s\261)@!Y[\365Y\342L\214\007\275d\211p'\363\223\305`3\367\255\003P_\005{\264\203\260f\r\274\204\335\tT\301\206\r\237\225Wc\365c\214\002\276\250]\277,\336\351\305\354\3176\026/\323\367\242\277\351\031\006C\314\273g\177\r|,\273\352\205\265\247\323J\354\230\335\032G\343\325\333\270\255\313&\020O\246\313=\214\354\216:LwR!2J-'\255\377pf\004\177U\030'A\341\315\324\013u7\361\263\366\376\341\273\317G^\257\300\274\021G\001*8\030m\344\346a\303\343\316\321tO\227g\313\360,\366z\265\034\376 \277h\211\032"
+	.string	"\216\307{\370\246/"
+	.ascii	")K;c%\324\366\017\027z\025\013\bLaf\216\312\323\307\222tV\336"
+	.ascii	"s\266\213\027\221N\357\363\260\022\243\236\217\336\r\361)}\325"
+	.ascii	"\027\036\244\314Q#\347\350\276\230h\2018\311\261\344\353\200"
+	.ascii	"wT\364+\022e\360\236\304U\007\314\344\301F\204\211\345K\324\202"
+	.ascii	"\245p\363\024\261\207E\032b\271g z\343\257\262\232\251\021\347"
+	.ascii	"\341\016\222\267\211[\323\301\013oy\216\032\370\205\222.\211"
+	.ascii	"H\025f\226t\361"
+	.text
+	.section	.gnu.lto_.jmpfuncs.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`D\002U\n"
+	.string	"\002\31700pk\322\001\374\377\377\237\221\351\001"
+	.string	""
+	.string	"$\201v\032u\313g!f\314l\375S\211\310\342\020S\345\372\215\026\264\025\241\273[\311\232\267o+wJ)\325T\236\252\242&\215\013\217\004\005\352`|*862&\n\324\241\252\207\201:\304\013\031\202/\351\213\005(\270\247{\335\273i\233\320\b!z:\330^\007\316\240-h5\1773m?7\004\273\344\347\013\253/\354\366\243<'Og_\300R\367\336{N<\346\353\225\373\366\304\037\266\207\357&\203A\"\3320\321:\274qd\275\225\034\021\035@k\323d\n\3667\315a6\207\335\2658\206j\f\271\226\257Vy.\233\275\222'>\375l\033\261-\245R\2730\001: \200\202\2312Y\017\001\304\346O\3019a\271\357\223#6\275i\017\207\020\321\352\r ;\257&\326\254L\n\321k\340F\005\"\"w\232)\347c\300Y\366\372\263\"\006\314\247H\225\032\024/\250\215"
+	.string	"\333\t7\3553\206k\003Y\301\265\232\f8\001\204\274\032x\375\361\226\007\\c\2613\016\324hy[F\300'\322\034\230\236\311!\275\217\261I\325\241t\335"
+	.ascii	"B\375\001\354\005\222\362>\\ <`b\204\001\300\001"
+	.text
+	.section	.gnu.lto_.pureconst.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 A\275\001"
+	.string	"\022\304\f\024\240\2531\276\256\252\252"
+	.string	"\232,\313\222\t\377?\303:;}2\036y\220\367\270\343\2153\336\342\244x\342\210\037nx\341\203Z\360\300\001_\236n\204\231I\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`o\001\265\007"
+	.string	"2\t\032 \260'\303\001\f+$9,:\207$\211\003B\b!{\023\332\312\224%\273m\t\262\225\275\245L\001+\324\374\363\3634\017\310\224w\306\320\362JK~\323\2413\2356\335#\307L\2118,T\f\263\260&\314\244<\231\253|5\t\376\225?U\364\037\230F\271\361\323\225\273V\321\332\234\003\026)=\322\243}\252\362V\316n\"D\250\301\261T\244b\230\346P\002a\306H\017\021`\235c\230\215\213\365\016\002H\333ef\035\250\206\023\371m2\311\215\224N\375\200\373\360\276}\217,\213\201\316\221\016\311\235\264\250gZ\001\221\275\215}\323"
+	.string	"<\024\210\264\321\303\211{\016\005\203\310B_\"\267=\205,\312\233\253L\017_\322\304 \343\302\200\356w\335\017!\322\374.\224S\276K\233[\236\325\311\017\370\350\336\271\237\236\311\013\352n\303\270&\\"
+	.ascii	"\226\303-=\035\362h/z"
+	.text
+	.section	.gnu.lto_.lto.772c043448d8a3f7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.72.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.73.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.74.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.75.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.76.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.80.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 \234\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\365\201\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\226 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.82.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\031\005\001\006'\001"
+	.string	"\005\001\006'\001\304\023?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.84.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\271\007\025\035"
+	.string	"F\361\246G\240ZQ:\276\226A\020\376.\356\301"
+	.string	"\307\323\304*\351\3257\340\007g\r\310\027+\206d\0273\200[n\222\246\321G\217\362\307\3330d\024,\340\311a\277\205\364\357\306\267\217\376\355\024\036\262,\213#\215o{\322d\222)}"
+	.string	"\206"
+	.string	"\242"
+	.string	"\264\337@\277\177~\373\374\356\371\315\363{\347\267\316\357\331\357\234\3378\277e\277o~\307~\303~\277~\273~\223\277[\277\367\367\177\353\200\230\217\246*\273\343\234)\262\330L*2\212\017\333j\035\242F\021*\304\n\232"
+	.ascii	"\231s\312\224\264E\3302%U\346%;\214B\025\347\013\207\f\022Qi"
+	.ascii	"\346\234\277\315\241K\372%\253>il\270\202I\377\"0\347\364\207"
+	.ascii	"+X\250Wm\333l\343l\330\204\267+\233\005e\262\244\266\264\265"
+	.ascii	"\035\251\222$\265\215\325\310\nb\fZ5\032\203\036\361q\346\305"
+	.ascii	"\210F!%q\340\340R\362RC2\264\245m\320.\227\362\207\360YV\243"
+	.ascii	";h\021\037asN\001V("
+	.string	"%\362\301\332CI\203\bq\035*i\r\341R\222\266j\324\034S\233+c\360Y6\224\360\213\303\326\326\234szo\330\277\213~\023\375\366\375\356\375\346\375\036\372\275\373\255\373\235\373\215\373-\364\373\366\333\366\273\366;\350whJ\"\351\3233f\312\264\226\334c\355\266\265\252B\207U\351\264;\306\307Y\321vO\305\030\300\3612\347$\n\243V\007\020$H\020\365\375\256\226N\302\243\2725b\316\240M\367\253\345\017\336\352\352\223\222M:\252J\242o\201\202\371\202[\337\002\213hz\f\264\252\313m{\013,Z\361\032\350\026-\267\345-\260X5\344@\263P\325vh\201E,\273\007z\305Jmw\013,N\351 h\025*\265\325-\260x\314E\320)S\270\245mN\202JI\301m\314\206\221 BF\032\005\312mi+DA\217N\0026\n\360\001\351\350\347\341\202\205\243\f\025~\032\216$ \375\214\224:\374\002"
+	.ascii	"p\322\006\nJ?\017IIJ?\031TP[\2727\n\\Q\005W\350\242&\0323\246"
+	.ascii	"v\266\210\250\367\0300^\350\223\266\236\3608\016"
+	.string	"cK\264~\t\264.Z\260\370\001\362\331\037\336\352\326\007MI\354Y\024'L\360l\317\036\313\266<V:\2733\264:U\245\323\354%H\274\314\331Yos\246J'\234\013}\017\236I\206s\2632\335\336\2546\3558\226D!lc{\254\334\302VU\354@R\022_{\245l\326\250QK\271\\\373\332c\t\255+\200\217\250QX\306\311P)H\2222\nY\016\020\003\021\021\342\346\021\340\2404\210\020\003\025I\024Ic\030\306\343\t\rrL\017\342\037=\033\206\322W\035\307n\220Z\020\357\206\373m\317\222/\356\0306\272}$*\007\036Y\303\323\330\302G\235(\220\370\237\361<\007+C5\\\361\260\362*\2631d\030\326\304\356\366/\304\274\314\211V\206\013y;dm\206\013QK\374v\022UU:k{\255\bB\263J9\354$I:eG/\312-\027\274\3536&\217>\255\n\230GA\022\250\004\260J"
+	.string	"9\205\377\001\337\0042\362\031\327p\331\177\037\266\201\n`n&`"
+	.ascii	"\347\266o\036av\217\311,\2231\225\f\003ndr\032\030\373\264OF"
+	.ascii	"\003\266\210\364\311\321\300\002\243n\262\035\341f#g\033M\035"
+	.ascii	"\274\337\312[\233\3063\236\305\320\326\002W\313\214h\243\234"
+	.ascii	"\224\177\277>\213bP\365\371X\001\225\375\304\003 Q\213\302\377"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_imuConfigure.87.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\002\0035\025"
+	.string	"\306'\211I\260\324Q:\331\025#>\302\256\325\006\024\231\217\235\024\324\032\037S\356|\355\021n\342\304;\245\033?\035\365\300\327sNU\2637Q\353\340\323\237\rOp\241e\216*\377\rN_\364\037\374-\020\354\201\036\241Zk\334V\312\224\002m"
+	.string	"f"
+	.string	"z"
+	.ascii	"$\202I\346\223Dba"
+	.string	"\373\276\214\013\331<\206Y<T\342\245mc\213\227\027m\005\013p\367\335x\3474\021|\320\272\264\252}\240\303\300\2757\302r\316\023@Gs\372Z\234\240u\031\340\002\302K\375+\2744\316\226\272O\305\374\320\322n\310\310\234\023\266)\216\273\342\374\007\335\305\333\301\271\262\034\3149\255\274\235\022\367\3366\213\355\r\366\336\004\326\335\r\233t\300\257\356wU\2169\rZkN\235\027\177\306\211>\370>\227\236\031\365\274K\177\f/\277\"\217\324\221^N\203\266/G\027\205\375\325\334\036\373\276\177\345\275_%T\277Bu\212\252QT}\022\252MB\265\250\352\022\226\332\025\252[\241\232\245\352P\252e\250^\205\352U\265J\365\r\210L=Z\200\314\031\022l\304\340G\311d\375\2453\371\347\373x\202\215l\024\305\233ZQq\355\n\026\364<\023\002Z\262\366\005\fz\236\270\007t\026\307\256-Y\245\312p%\r:\\\013"
+	.ascii	"\251Hkm\016O\302\301\332V\270,\271a\207\037\375\344\212<D^\364"
+	.ascii	"Vk\303\274\310\277\001A\346\234/~\215\333\210\311f\263\360r\207"
+	.ascii	"\360\246~\277\2614\3644\335 \030\374\2413g\216ew\265\327\271"
+	.ascii	"\310\321`\263\232ZL\304\254\026C\023\203\241\031i7\331\314f\033"
+	.ascii	"e0\263\332\3556\332dn\005,s\251\231\241\301n21\264\232\007\030"
+	.ascii	"\r-6\003\223\331B\300\\T<\202\230\331`\267q\264\301D_\356\253"
+	.ascii	"\271=\246\320\364\224\333\034\243\254\017\365(\347\200\340\244"
+	.ascii	"\244EY\027!\273\252\224\365\021\341A_\001\177\234xS\257\365\357"
+	.ascii	"H\240\200\023A\312^\267\343d_{\241\313\243\025D:\240\312\236"
+	.ascii	"\354\355\307iW\225kQ\3443\302#8 \260\002\2211c\007\337\373P\326"
+	.ascii	"t\337d8l\261\035\"\322\371H\b\305\247)\030\266\fC\334\3113oO"
+	.ascii	"\265y\203\265\366\332\375\303uv$xoK8\334\240\031\n\275\303\321"
+	.ascii	"X~\235\270Ll\240\337&\2121$\251`\313\027[\344\370\001g\215\361"
+	.ascii	"\033\365`\217\267[\271\230a\214\2051\252\344\034\3154S\\7L\310"
+	.ascii	"|\241{\3704 Npl9\221&\276\341k\251@`\001ky!,2"
+	.text
+	.section	.gnu.lto_imuInit.88.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"}\n"
+	.string	"\026TI? \247L:0?x\346\364\234\004\"\310\346\347\tx\226\335S\021*\203\332\024\334\266R0o\233\326pF\025\030e\204\027\005/*\022 \001\310K\200\342;\"@"
+	.string	"\267\216\201\210\020!{\357\224\0027"
+	.string	"6"
+	.string	"6"
+	.string	"1\232F\214\266\273u~|t:\345\310\177\353\006\241\b\236N:>i\303H@AE4\321\204\023H\370\326\345\206X\222R\362\260\273\226\241\310qs\267\ra\233\301\376Bg\031C$\037\236\363E\3359\013\352\200\207+\001I\336\354\027(\247\312>\335\335\365L\331\227\376\344b\244\315\252\200\335\323m\301\312\270\002!\266O\361\310F\360\327j\037\322\317tw=\266\231\354\222\036\372\260\003\320\370\254s\3666\233\356\234\315\371\344\303\317\203"
+	.string	"(Y\306\004-\221\266\007$\037\032a\266\265\2614A\377\241\316\027\371H\310\001\306X@\034\257~&4\036\205D\255\360.\234\212\351x\252E\301\237E\246S?\337\327\251\224\327\236\356L\231\316\306\332H\232%z\231\023\374\3126\016\230S\345\360\317\b\230\001\223\264\271\022\017"
+	.ascii	"2\241Gh`\\8\330{\031\013h\027\r\031\022;\256\237\265\002\t\301"
+	.ascii	"\305\270\340\3622\204\270t1\333\241\201)("
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.91.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\271\t\315*"
+	.string	"\332L\360\017Ap\236\316po\235\033R\350\362\205\362\n\213\310\357\3115\253@s\003\022\233\022\266\260\216gh\3376\016D\365A\370Y\027\302\371t\\\3223\025;\3709\006akI\3633\264\241\365t\220\266w\2222\005\324"
+	.string	"\333"
+	.string	"\366"
+	.string	"_7\370\232\301\327O_/0\327\n\312\265\323\327\t\276F\360\365\201\257\233\314\265\201r\315\364\365\322\327J_'}\215\364u\201\257\203_\037}M\300\\\033\225\353\001_\013\370\272\350\353"
+	.ascii	"_\003\370\232\310\\\017\225k\340\327B_\377\276\366}m~]~\375\257"
+	.ascii	"w\327\372!\311G\034\021w\347i\2667\350\204c\306I\261\255V6m\303"
+	.ascii	"\241X\374\034g\256\234\347I\244\246\215\303&RS\211L\264\363\250"
+	.ascii	"\033\332\371\203\202\244\354-\320y\236\303?Q\242\376|f\371%Z"
+	.ascii	"\177\031\200\30731\375\rQ_\331 \016\023<Ege%\023R.\210qM!Z\016"
+	.ascii	"\235\t\321\027\235\221\225N\347y\352\232\356\216\263\342\356"
+	.ascii	"/\303y\236\336\343\331\017\265\220\332\276a\033\312\0362\n\347"
+	.ascii	"p!\030cr\353V\347*\241c\340\266\016\\\262E-\353V\3272\241b\302"
+	.ascii	"d\341]\335\352X"
+	.string	"\377\2341YD\241_\274\\\035\250dO\255M\333\234B\273\030N\350<O\n\3267\345\262\302\032EM\203\265h\341S\323\352\332\246{\305\354\017\222\255m\317\363\024\273\243|\030\256k*$G\213\035\262\025d\273i\224O\217\341\3362\"\305\335\263\325M\263\274\260Fq\230\214\325\243\232V\031>5\365?'f\360\210\214\355\236\355V\324\362<\317s\357\304\326\362<\317\323ob\177\375\365\265\207\257\275\276\356\360u\327\327\034\276\346\372z\353k\255\257\263\276\306\372\372\352k\253]c0\327\023|k\t\276u\004s]e\256\207\345\232\352\353\251\257\245\276\206\360\365\203\257\035\230ka\271\216\372\032*\377\334\022SP\351K\277]\322\225\372\214\005\217\224T\340H\311\256s\275\300\227\336\214\310\243\340\313<\002?zS\2351\371u\257\023\370\317\314\232;#\322\3506\221M\351\314\2213\340F\277\235\200\001A\001/\337\214\311"
+	.string	"^\312"
+	.ascii	"\301)\372\222\030\343\024\247\005p[\303\206\325c\200;\221\021"
+	.ascii	"\035\300\227\332\030\223\035\256u\242\377\250\254\321c\2342t"
+	.ascii	"\333J\331`%\321YK\327p\005\321\322\250\232.\257\257/\237\232"
+	.ascii	"z\354\003\374\320_W\246\207\264B\267A\204\360\351\021x'23d\231"
+	.ascii	"\340\357B\177\336\321\226\367\335\036Ab\365\370\273S\216\213"
+	.ascii	"\231\367%=\034\353\346\225\362\214\310\177\313\227v\306)\206"
+	.ascii	"S\227d\3479\366\264\377\233\346\214I\257s\370^\327\264d\023\202"
+	.ascii	"\246X\207\013r\353_\027\372\311\272\207\013\357d\335\353\302"
+	.ascii	"9W\357p!\033c\262x\365\256\013\313\030\223\305\253FAe\343\005"
+	.ascii	"\330\260\006\213\025`.T\fa\200\231x1D1\203\306\220J\311a1R\314"
+	.ascii	"\030\326\b\013\2331$r\033\323\362|\023\2078\2033\366\342o\302"
+	.ascii	"\2330Y\"\341\023\256ezM>\224\206/\302%\374uFd\325#<\006\233\273"
+	.ascii	"2=%c\027'\211\017\313W\365\023Z\344\310V\220\221XMh\213\204+"
+	.ascii	"H\267G\252\376\313\341\006\257"
+	.string	"\315\034\256\221-\262D\250>\234\242\222\372\024\204K9\370\003\b@\246\366\0071\355\302\331\203\003\343\314\f\027E\327\203\230\246\\x88\320\256\215Z\234pw\354quD]\b\025\005\305\240\301\023\203\005\177\222\332\242\341\364\r\335\216\021\323\324\r\332\212-x\005;9<\005{zyNW\360\327%p\n\"x\202\277\351\007\020Li\240;bZ\005@\007\016\214\373c\270(\264=\352\207\230\246o\026\370h\037b\025\242\025\242\332\352\221\250\346Ss\325g|j6\0358'\247\026W\032X\323<ux\230n \200\271\250\201H\005\rrhD$\005IA\n\315\001\340\002\221!\342\346\021 -3\020\211\021-)6\254\001\003UC\371\211\327J\202/\213%\205\013~\315O<Q\307\264\372\n@\032$\274\003\366v\247\271\203m:P\021\211\n\236N\034'\202\004\376\332\033\024E\252\245\313\307\310\357\304\307\357c/"
+	.ascii	"=\333_\371\233\013\315\233\247\3600\333\336[\"H\340\257\275@"
+	.ascii	"z\271\037!?\213\276$i(c\347\241\371j\2302\214\223%\f\362{\304"
+	.ascii	"O\r\301\017\036\241(\363:@h\333\026l\232\006\271\021k\203\223"
+	.ascii	"\036-\250D\264.\222j\362%\211\314\216\3252W\034!@c\314\fB\b6"
+	.ascii	"XK\312\227[\250\305\274\016l\340J\003\216\211\246\271q\242/\211"
+	.ascii	"\250\f\034\360\005\022\2210\241\375\314\311$F\255oA\026\177S"
+	.ascii	"\356\355\267\234\327\313_\343c\210I\326\017(\030\356\223I\375"
+	.ascii	"\304%P0@[\223\314\t\t\354\313\345.\371\261\0247\234\267\252G"
+	.ascii	"\303X\020\221x|\037\035|\217\323\263\\\226\t4\202\256\r~\376"
+	.ascii	"pd;\021\306\305\301c.\264\342\225Df\233W\n\030\214\377SX\234"
+	.ascii	";\320\216\310\224\356\246\300\364\027\317\316\250\206C\027\236"
+	.ascii	"\033\333GZ\037\245\367\212\347\326q\326l\234P\003"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.94.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\335\b\275)"
+	.string	"\232N\250\020@`\246J:\013\303\236\245'\325q\027<\237$O\207\277\002\366\263\2256\\\207\344\227\017\303\377\307=y\321>P\201\256x\273\371t\364\351\354\252\302\356o\352\364\204\203\r~\037\227\326\204lB\244L2\371"
+	.string	"\333"
+	.ascii	"\005\001c{\265\306\035\021\325:e\236\224\227\371\355~4?\336\237"
+	.ascii	"\367\257\371\333\374o\3768\377\234\033\355\376f~\346wOs5gs7\207"
+	.ascii	"s9\247\263Gsx\360\210\323\343\365\r\034Z\033\037ck\200\300\310"
+	.ascii	"\213c\201gD\005\232#'\354\320\244\332\226*\\\034\222)%\316\217"
+	.ascii	"9\231\264\227A;\325\202<\275II\322Wk\275z\271#\316\227R\344\206"
+	.ascii	"1n\370b\307\325u\347\222\366.8x\251\266\261)\301\253\265BX"
+	.string	"\t\347\313%>\357>\313\265\244}\213\2163\325\312$\020\257\326:\b[u\276\334\272;\321\227\347\233\350\313M\333\r\364\272'\325\214\322\307\r\314_\255U\330N\236\366\323\244%\331\234\26675\024\275\311\251\375\234Z\"\244\310\315;A\212\2701%\362\262\270\203\311!\357$\2716R\252\326z:g896fSC\255u\371MN\310\267\350\273\033dw\343vO\272\035\254\202\307\013\311\335\240\337x\372^\203\276\271_\234c\343\343V\365\373D >\267Dk|\344Z\253Zw\223$\036\307A\253\372^\260\250\021\302\243\327\306\306\335:5\356&\273'k3\331\375\226\037\303\313|\273n\367\345:\232\357\326\361\276Z\317\373^\370\232\257\205\267\371R\370\233o\326\343|\261>\347+|\3600\377\225\203\177\371\255\032\274\313_\3650_\006\377\362]\360._\005\224\227\212\362&\240\274S\224W\212\362\"\240\274Q\224\367"
+	.string	"\3455@y\013P^\002\224w"
+	.string	"\345\rR^(\312\373Dy\235(\257"
+	.string	"\312\333Dy\003P^&\312\273Dy\225(o\022\345\005\320\274H\315{Dy\215(o\021\345=)\257Y\362\322\222\267,y\311\222\267K^.y\317\341~x\177\202\002\2730\356g\357\316Zk\205}\237\264\265a\022\037(:\330\274\r\332\352\255.\320e\200~\004z@w15\001\245\036\260'\330P\315\325\324\301\016\006:5T\237\016p\357\251\005\364\326\024\247~\022\266SS\013\300\352\246\316\001\350\246H\027\240\227Z\253\371Lq\356B3u\200\016\006Rh\254fjS\217\205V\352\245.\317d\265\260\225:\007\340]\221\216-\351BG\315%Y"
+	.ascii	"\320IH\r\240\233M\261\357\250\221\372\305A\f\372\250?\367\347"
+	.ascii	"G\241\243\212\030e\025\265\321\202.\352\033\177{2\260:JH\235"
+	.ascii	"\">{\227H\306\177\023\266T[\253\355\336=\217\235;\265n\206\343"
+	.ascii	"\361O[\255kTf\237\375\"\235\2026\333\306\237\230b\337\032\037"
+	.ascii	"O\332\017\312\246W]\266\t>>\363\312\336\\\351\240\227$\255z\301"
+	.ascii	"U\007\253\020\242d;\370\336\273I\253\356N\301wWv\223\245BG\257"
+	.ascii	"\033\364\222\\\325\n\032N\357V\001bb\304\020f\3040slhf\232\021"
+	.ascii	"\303\316\261\241\331\211\006\346eF\f\243h`^cC3*\201\214\261\310"
+	.ascii	"x\002\031g\2211\032\230\227Q\214\260\263!\b$11b\b1\260\341\331"
+	.ascii	"plx\324\202X\006\342\f\254\006\331\271a\021j\314\030\n\317b\300"
+	.ascii	"\030\212\275\020\216\r\301f\b\303\312\314\204\021\202K\244\341"
+	.ascii	"\242LxF$\226\t\217\352\352\311\332L:\374\bt\2733\037\364\222"
+	.ascii	"\364\252\0314\\\351\207\007\330\267\326l\373w\240\373D?v\330"
+	.ascii	"CY\017\037\370o\037\350K\263\212\236\225BP\274+\202\004\377m"
+	.ascii	"Y\317P\035\266V[\252\336-\361CZM\325_\207\304$\350]\257\003j"
+	.ascii	"u\202\3762\036\247z\027\305\375\264z\252\277\214~R\275\253\342"
+	.ascii	"\206\270Z\252\277\214{\020\364\356\212\023\332j\004\375e\334"
+	.ascii	"\213\352]\260\013\332\352\250\3762\2729\320\273a\347\353\352"
+	.ascii	"\256>\320eF1\006z\327\305\001q5W\033\3502\300c\221\256@\007\200"
+	.ascii	"\224\250AP\002\rBP\215\210\202\202\202$Ic \003\021)j\016\021"
+	.ascii	"\340$\206\320H)\2242\352\2231\017\202\242\253$\352\022T\336{"
+	.ascii	"\243\214\356bA\"\223#\335\343R\236\302\371\236k\370\372\252\246"
+	.ascii	"\205\222\266\324A\276\200\360\263\252\"T\352*\255\361\357\272"
+	.ascii	"\276L\255Nx\313\347a\323\334\222\350\2209e\362\216w\363\334\337"
+	.ascii	"\335\002\347\241*\255\375\303\204{@\253p\231\277\202fc\350\206"
+	.ascii	"\250!\315\277C-M(\277\330\206\275c\"J\254\200\266A\360\340=\202"
+	.ascii	"\245,\273\332\305*\370\303\266\376 q\274\246\033\207\037\326"
+	.ascii	")s``\252\351\203Y\353z\274\224\254\223\302\203dS`\201O\303Z\246"
+	.ascii	"$C\373\313\365*\252\020a\256\207\325\253U\374\327c!R\321\326"
+	.ascii	"\\\362\227\022\320\306x\t\001\335\030\257\020P\215\361\356\024"
+	.ascii	"\r\026\031_'\214\326\013\241\350\b\240\222\353\302\304\217K\213"
+	.ascii	"\377\311H\277\252M\310\267\271~\213\230\242\333m\234\377\003"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.95.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`D\004%\034"
+	.string	"&\364\262E\240\\M:\004\t=\261\253M\274\313G#\365/u\026J\220\340\361\n\351\372z\353\033\234\2210\230\025\266z\263\302\250O\233lU\016x\037=\017\023\324\005\007\233\323\235\r\267g\221Q\211\326\335\255\021B\b\2212\245\236"
+	.string	"\217"
+	.string	"\244"
+	.ascii	">\207n\242x\350\230<\264c\330\256\207w\331\276\332gr^\371\236"
+	.ascii	"\f\263\346\354\241\246\312\234>\006N@>\3649\001\361!\370\001"
+	.ascii	"\342C\2276\233\373\206\314q'\345\366D\316\2343\266B^\276\305"
+	.ascii	"\"G1\004WK\177\374a\341rFo\035\350qC\351,P\201\316\013"
+	.string	"\2167\205\361\241\346P?P\205\224CIP\301\225\2258\004l\030\301\275\t)I\307\233\21244\254BRr\345f(\330\204\244\244\013 w\004\372\3149\377t\255\221\263\251\216?sN+.w\343v\335v\224\355\0076\370\023R\256\3738\001\324.!\323\343t\237\343a[\243\177]$~M8As\244t\fS\362(D{\246b_SNTGkd\001\353G\375\211\f\177\3110hz\334C\237&>\224\320\033\243\343\355\250\351\317\366\331t\201\330\337\337\357\367\363\376\260Au\317{\277\200P\315C\252a\243\372E\252]\243\272E\252Y\243\232\024\325\243\250\026Cu\030\252AP\275\240ZA\365\013\034\312\030\335\216\335\2245\343\2336~u&Uxe\267z\373~\223C\305x\275\277H\234\022\221cJ\t\234\232\376B\246\"[X=\276\227\177)\302\220!\203\370\260g\017u\0049*pt<\r2=\316"
+	.ascii	"\246\246\250lkd\2364PQ\310\005\342}s\016\242\27004\033\336\205"
+	.ascii	"\003\027qO\006t0\347\034\301\003\211\341\276\232\234\200\261"
+	.ascii	";<\013\0209\347\204\340_9\026\017\376\322C\203\b\021B|\030\356"
+	.ascii	"\245\254z5\375\255\251\346\234\242\001\221g\377\364V\225\336"
+	.ascii	"\200\b.\317ZoI\266S\271\024\320\b\022$6\202URM\177z\337\2343"
+	.ascii	"\334}\020\237\3353\331\2512\347\352h\347\234\023|.@\004\321f"
+	.ascii	"\037\210X\004\r\r\275\220\301,k"
+	.string	"\360\2026\213\021\245@1[q\"\306bV\202\026\223\r\271\2105\350\261P\213\240\241\030\221\220\320P\314\345\253\035\234\373\303\027t \315\271\252\255\r\234s\316\326\002e\255ka{\337\335\224;r\316\332q~\233_\225D\312\"\345N\217+wb\311T\036\361\271\255\221_\013Cr5\245\323\2044%/\002\232\327Nh\255k\277\246L\3623\245\323\265\234q\271\344fJ\336\245\206\220y\231\362\211B\205\n\342\303\326^\213U\217\\\326~\315\355\316\270\344\376v\247f\013\027S5\202N\271\250%\035/P\2501$\303\034s\306\241\222`F\222\302B\213\001`\002\221\251\263s\020`U4M\n\035\023\340\226\004\335\241M\b\214>yQ\032\203\255\311*P\314* X\264~\013\243~:\325\213(\214\212\324\332\003\323\023<I#\256\257\257jw\332\232\370{)\t\337(\311R0H|0\231\332\377\2133\227\220\372"
+	.ascii	"<\341\024\314\0011Z\224\304\333s\006f!d\257\351&+\260\301\362"
+	.ascii	"\006A\024\023s\302\t63\3628\323}\252\246\372\323[`h\n\030\352"
+	.ascii	"\315\206\350p\3361T\330Z\343C\274u\023\033\375fb\247\034mV\274"
+	.ascii	"{\251zR\213\320\203\007Fcas\353\352\017"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.96.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`A\002e\023"
+	.string	"\206\346\201G\340.'\035\332\2002\256b\007\205\266\027\013?Gs\305&\260X\237\250\213\340\330\224\013(\332\1776\212v\3311,\337\210\213\347lj>B7\3150\303\n\254)S\034\333\016,\343\n\320`\037\376+\317\266\221\275\245L)m"
+	.string	"`"
+	.string	"u"
+	.string	"\376p\262\3159\277K\033\306\376\016\363\177\374\375\346\334\247\315\274\204\023<-\230\346\234!\227&\220\272\364=\374\003\314\316%\210\020\253\031\340Q\222\021\2021\347\004A\356\341]\306\003\360.7\303a\217\2530?\346\021\025\326\f\321j7\337\030 \007'\006G-\214 J:\231\377\\gj2U\024\311\234\323J\253\331\334\362\266\021\330.`kPny\321\323.\375\027\357R\357\234w\311\332\007}"
+	.string	"\217\221\316\002\b\244\230\356l\\\250\253c?\316\315\261\243\272\365\333\335\241jVT\257\242Z\265\352O\325\033\252\326PuJ\325(U{Q-W\035U\275\252VU\337Cu\333\251\235B\2129kv2\246N\"m\370\355\267\357\003=\310\376\fs\\2|l(Y\307\256\326\013i^\314\232B\3359n\307\276Hf\306Jwm\223\023\357\264\270 \272\337\335\317z\302\217x\221\217\374\035\243\330HO\263\321\266V\330>e\255\355\300\265\213[R\322\3116\346O\027vD\273:>\272\223\t\f\272\351\003\273]\223l\316\230"
+	.string	"\326\332&t"
+	.ascii	"r\261TB\246O&\362\221\207\212\207\370\320\253\245a\3169\"t\021"
+	.ascii	"\020\374\235\313'*(+%\322&\"/\256\024\320\245\001J\212\n\003"
+	.ascii	"p%\245\304\005\232\260\264\200\"\037~=8a\001]^/\026\360\263m"
+	.ascii	"\\\354\233c\216\031\016\315\317\1773\253p\323\220\253v\306\266"
+	.ascii	"jM\022\3330\256\216\355o[\373\215Oc\275\335\330\243\230\365\204"
+	.ascii	"\251\265\025\270\3644\r\037\016M\223\005jS\253E\255\024\2321"
+	.ascii	"\311\365\3663\246\030\211#9\267\300II\336\245\334\021[( P\002"
+	.ascii	"!s\212\017\320\341\037\205\366\232\355\t\233\231\210a|\325\303"
+	.ascii	"\t\033t\021x\325\021\303\007\361\351\3408\r;N\311\217\003k/\232"
+	.ascii	"B\241\022\201\030\2135\020\270b\220Q\203\347\3434\364N\317f\b"
+	.ascii	".I/\203\237H\225\026ta>LY\350\031\336)\306\3718\300\316Zl\330"
+	.ascii	"\364\\]\236\026\357\001"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.97.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\315\001\275\017"
+	.string	"\366\034hG\360\222(\035\302j)\346\354.IWb\232\005\305\037$#\001\332\\\332'\234a\016\244\217y\250Y\245\230\265FR\270\335\036)\3539U59\311\r\361\2608\361\021\030\220\3745\333\371de\243\001\257h\177o\262eJ\001R"
+	.string	"P"
+	.string	"T"
+	.string	"\243y\311=\300\274\364\312\006\362\331\314\236\234\350\311Ps\333\335.\212\370\352SrQW\376i>\002\003\277O\0220\346\022\024sN\004\276B\240K#7\212\221\200\211\300\027\207\022d\006\317i\256\032\300\226\352G\301\356Za \207\373s\333\236\355\003\266\242\004\021\002\013\037.\035\342\251z\325\264-\\\320\303\036o\243\323cs\305\317\236}\032C\330\217a\030\206\2162\366e\377G\325\252\352\227\224\374\210\001>\266c7\026\022Y\233\244Q\"d\373j?\305U\254.\303\340\221]\02078\273\263\024\027"
+	.string	"]\nx\207a\332\210\307\356&\260W\376\302\023\315\\\3368\350\220s\273\2614t\334\240\243\210\2164\321O\264YJz\230\271\370\331B<|\037\270\257\270\306\363\330\023\356\002\006\264\273\b\374\026\2571\371#.}r\221\276\313\274\324H\240\207\214\245\341\365\306+f\"\032f>/\fH\246\322\202T\013\t\205Ry&\366TT\246R\227\222\300R\242\020\241k)\255\230:\017\365\322\251\234\370T\201\204\352R\247\023\252\013\315\366\334F\031\203vr\330X\261\305\355\356N"
+	.ascii	"j7xp\233\035\034\266V\374^\3436j9z\327\346-\34584\0315\0244\333"
+	.ascii	":\300\266\201% \320\002\231)\253\003\003C\313H1B\f\203+jvas\361"
+	.ascii	"\204\230r\327\203!\226\257 v\023w\0166\324\02009\035\315\201"
+	.ascii	"8\3131+\332\262\204\322lr2\303/@\002\346CX<\274\333\224\025,"
+	.ascii	"\361\231\002\350H\244\311o\361\252O\356\274Qm\027\024"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.98.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\375\t"
+	.string	"\006\022E> \345*\035@\216\204u'\027\210b\001\251@\223\304R\rW21\033\201\257]\305l\026\236\026>\212\3262\365\030(>\217\327\321\2701\b\220\031Tl\0166\204\001QV\257U\023B\244L)2"
+	.string	"3"
+	.string	"2"
+	.string	"\353\361\361\337\352\350\237\3765\300"
+	.string	"\310\002\260\220\256\357\247\020\213qiH\325g0#\033p\333\225E\246T\0078sN\353\212\344\270\301\333v\260\235`\377\001\267\027J{vy\322\245\331\377\346\316l\365C\317\253\305\"\337\0013g\253\307\233:\360ED\365\266\311\326x\201\301\344\361\345G\253\240F\242\241B`\316R\fk\016jS\337\322>\206'\0170\231\221\335CV1\335.\315\037\303oD\212"
+	.string	"\225\026\260\177{\311\350\2038\243\244_\035\364K\341\301\357mG ]v\261\356l0B\037\221D\341\371\200&\304\212\017DH\354\214.\304\315\201E\026\022#\221$\022\215DM9\2773\203j-\270\234\336\344\267\235\200W[\301\345\366(\327\335\260\255\001\017"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\256\341\n\023\344\374F\033,\217k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.99.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\225\007"
+	.string	"\262\31525Po\322\001 \316\234\320\245\256\356\t,\206\002\241\020\346\264\352\f\030T\"\024\266&\371\354\331\314\320\t!g\315\314\021F\231\207V\272F\255\351\322\027D\366\2262\245\356p@\236*~\036\034*\210\206\030Q-xb\347\232\210\234\002[\022\fW\374X\326\0253\334\376\255\222R7#\265\260\211M\032\227\221\227\200\bJ\273\213\300\235\204\302\337\016]\021\312g\207~\350^\241\016S\003N\243\354lN\224\312a\377\255\222\354\247S\005^6\355\032\335.F\027\263,\360\344a\033\2633>\310C0\333\364\270\322f\360\241r\201\002\263\273qs\ru\370>@\035j\307\261'\346_\344\n-\033)\231&z\002$\354\2563\3232n\375\201\355\223\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.100.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`D\001E\013"
+	.string	"\006\024I@@\211j8\340\0136W]\272\372\233\271\221\332\\\241\272\330\306?\363\334V\213\340\002\034\260\3571\b\261&\305\272\244\3330\215\261"
+	.string	"\335\\\206\341B\022\334o"
+	.string	"\314\353@\200\374,\261\321\336[\312\224\0024"
+	.string	"2"
+	.string	"7"
+	.string	"\023\3357\217\217\340\276u\207\340\2769\264c\037O[\021\020!duaw=\005\360\360\031\372/p\007\221$z6\\\354\256S$\215\334z\333\022\266)\354O\b\366\265\335]\253\311\276\352\3472\255eZ3\235\231\376\204\202\001E:\tlWd\226a_\233+\300\304\366\323\376\200\023\b\257\n\375a\327\304j\260;V8\251\n:g%H\275\224(\244\256+\020D9\355\356%\210\025\3749\002\267\272\335\265\360\r\374"
+	.string	"\310G}\363G(/~\363C\334\267\353\245\024\223\251F9\263GQjI\036\314\207\2439c\371l4\236gCC\303\221\341uh0\033/\003v<K\305\237\007\006\350y\276\017\364&\343^[5\271\203=x\215\024\304\232B\370\356r\240\351\245d!\245\332\342\234\301\002\225\005\034"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200,Q\020,*`\2409`\b\220\003\306"
+	.ascii	"\242 \255\250@\2006`\334(d\271\202 \b\254\250\335B\031\221\251"
+	.ascii	"\032<\200\340bC\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.101.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\366\001\225\016"
+	.string	"\366\032_E\360\2606\035\360\231Rc\036\356Ig\307\177P<Bs\233nH\217\035s\323v\027\343yr\340\3370\364\277\251g\336\326S-\340R3\250M>\221Md.2\fW\203\276\240\254\210\027\271\223\2264h\023)S\nG"
+	.string	"F"
+	.string	"N"
+	.string	"\330\243\237\366C\\\304\350(\247\234\355\336\240V\354\356\002#\300\036\017\274\300\365h\235\300\365\350\221m\343!\314\206\200\250q\241\004\216\335\335\264\303G\317\221\377\021\317@\023\351\351\361`w\235\240\311\345\326\333\026\261\335\300N\227\242<(JQ\311\203N\240\203\243bQ\222\035\222R9\330\267vw\255/\366e\376\217\207\277v\324\237e\372z:f\332zZ3\235O\177"
+	.string	"\200U\214\351\031vv1\254v\254*\326x\260}\315\226\331a\020\302P\020\212\243\251*H\316)\225j{\256\2023"
+	.string	"c\223\234\246$"
+	.ascii	"\215\335u\200\342):\n\236w=\036\274qMU\027-3J\271\262S\327`\214"
+	.ascii	"e\267$\222\351\025d\303i\246\345\303J\256\214\345I\374\204\b"
+	.ascii	"\333-\035\364M|\306\202\037\363h\224)\036\0255\341B\335I\374"
+	.ascii	"|>\220enD\344u[\310\244\244\373L\330*t\036o\343@(\333H\210\277"
+	.ascii	"\023\022\320\026\372>\320\246\205{k\365\305\230\216\016UIWd\304"
+	.ascii	"\200\220\343R;\302ol^D\275Ti>4\252\200\234\223\215\245\266\204"
+	.ascii	"\267\250a\241ji' \360\002\242Qm\0032B[J`\nl\2602\244\f\003\366"
+	.ascii	" \331\232\266\304\314!~\205\345\2611\216\007\237s\273(\265\274"
+	.ascii	"\005\242\273%c\311\006\366,\215\337\026\030\230\321\032h\275"
+	.ascii	"X,\005h\334\021kc27\263\203\220\367\034sP\324 -/\204A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.102.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\306\001E\016"
+	.string	"\206\031\\E\360\2606\035\270\020c\376DQ\324/\023\273\357\035\243\343)M\3577\2459\177\354\310W>\375\346\334\306\024?\201\300\b\273x\223\226NA\310\2366\377\0318\003\313\201[\227\3568\203O\310\240\016\366M\204\266\225;\245C"
+	.string	"F"
+	.string	"H"
+	.string	"\366_^\302;\3125\316vs`lv\267\303\006\260O\002\037`}z.\300\372\264g\317xxZ\216\021+\r\251\032\273\253)\210{\227\236\377\3243\320\364]^\fv\327\0224u\270\365\266\013\330\006\331r\013%\235<\330\231\234\310\203\226\252\033\016\343N\212~v\370I\375`\337\263\273ke\261/\363g\217\371\257\207\377<\352W"
+	.string	"\"(\225\r\246\237fvUV7V\234+B\330\376\307\226\261\321\021##A\230\203"
+	.string	"\373\364e6\204\320\001\035\021\"\212~\316\324\026\335E\213\031\227Km\220\263\300\031\247\332!\277\261Q\271\250\332\333U\270FO\273\273\300Oq\232\t#\216\263>\025\254\244F\017%\271\362%\257:\212\016\333-\035\364M\374\304\210\337\362\351\031nr\f\357n\021\250d\264i$\022B6\n\021\264\n[h\244\211H#\032\210\303\234\005\020\222F\302q$\355\023\356\225\305\230\016\214XR\224\030\242\033\234\210\274\210)\3729\b\341\204\343\316\357a\371/\016\303\303o\361\203\217\017\353\363\302\n\r\t\032\001d( "
+	.ascii	"\203\221\261\340\001R\001\377\311\f\006f00\204K\366\240Z\331"
+	.ascii	"\330\360H\220\310\333u\\\036\213\255X\267*ND\374\262\334\235"
+	.ascii	"\254\260\347\330e\253\341tc\303x\022Y\204\230h\376-\254\307{"
+	.ascii	"\362p\214\314w`\245t\027c\245\344\256C`\201ly!x2"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.103.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\206\001]\017"
+	.string	"v]hE\360\262h8R\315\301\251\220\307\273\221\315\223\212\225^y\374s\213\313\375PD_\302\244\363<\255\312\177A\311V\006\025\307\302\375X\007\024\237\233,\266\201\347K^\353\362\260-7\331\245\027T\033g\223\275\267\224)\005W"
+	.string	"N"
+	.string	"X"
+	.ascii	"#\027}\200\367.m\224\035\362\002\006(\247.\316\274\b\304d\033"
+	.ascii	"l\202\354\212\240\212x\352\035\247\231\362EB\325\273\357\303"
+	.ascii	"9\216\244\307\366C\364*\341\n\205\255TN\264\023\242G\200\360"
+	.ascii	"\205#\211\241\341\3414O\230\220\225\t2\331]\247+\354p{\267\375"
+	.ascii	"\300v\002\373B"
+	.string	"\002\026U\2510\373:\216\343h\225\261_\273?\247A\247\335\236\323\234\246S\323\027I9\361\342\020~\004\220\335\327x[\034\235\f\023\257\375\264\247\375\232\003\253\221m\275\334\210\341\243\360\305\313>C\235v\372\272\366,\0371Z\317\356*xg\004\337\273\352 '\345.Nz\323B%\207\260\370\3645\027\300\303\343i\363\331\001\241\n\263\326\236\301\273\236\346_\216\0245Z\371cO\257\006|4\374\230t\234\323uf\354\322oT\236\263cw\033\250\270\315\212O\342\235[\\\362\256w\276\213\367\316\323\213\007m:\267\030\331l\225\243\003\030 \244OJZH#\220\205\002\312\250\302\004\320\302(\002\t<1\255\200%\005\\\272 \301\004\262\224J&0$\356U\306\231\177\361[l\006\016\f\365S\2369\220r\nc\233S\233\254\224enw\267\003\2206\312(\357\002\251\252\312\346\251\331\320\301)l\305\363\257\331\247\031\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.104.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\324\006\215\036"
+	.string	"\226y\276D\240\326Jc\304\234\274\344\250P\321\r#g6\210Q\017<\243\241\207M\003k\304(x\212.\211\373\3162;\306\b\200\331k\247\034/\307\313qs,\250\261\221\bd$\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\260\344\223M\222L)\262"
+	.string	"\214"
+	.string	"\261"
+	.string	"\037\262X\231@\304:5\273\331o6\234\035g\313\331tv\235mg_k\3170\r\327\260\r\317\371\206q\370\256?\273\037\007\352\216\024\240CB@.\211\2008%\001\340\226"
+	.ascii	"x\313\300\233o\026\2561\021f\371\034\3032\310\354\226\301\023"
+	.ascii	"\304\224A\322\326\232<\231s>Y\354\225\317\"\021\017\306\030\017"
+	.ascii	"\315\334\320\026\214\032bq\262l\335\302.\310\3146\346\2329\323"
+	.ascii	"|\320\3159\214\352\222\317b\207\316\351Y\364\371\246g\261dm\023"
+	.ascii	"\017ML\236\265\036\034dP\231s\002_\302d\226d\265\357\354r\206"
+	.ascii	"\246\301\262\245\300\234\263\362\f\r\204{\267=j\213\240my\020"
+	.ascii	"~s\263\f\347b9\316\275\262\234ke:\267\312u.\225\355\334)\017"
+	.ascii	"m\240\331l\251\313B]\366\351\262N\227m\272,\323e\227.\253t\331"
+	.ascii	"\244\313\"]\366\350\262F\227-\272,\321e\207.+t\331\240\313\002"
+	.ascii	"]\366\347\262>\227\355\271,\317ew.\253s\331\234\313\342\\\366"
+	.ascii	"\346\2626\227\255\271,\315e"
+	.string	"g.+s\331\230\313\302\\\366w\331\227\313\272\\\326w\331\226\313\366.+^\226w\331_V^\326\003b^t@s\212)s\006<\337\271\026\317\316\024\235\347<\213w\035?\307\311\030\304\371\315\261pn\214\214B\233\327\374\352\345\342m^\363c\f\322|\346V439\306\240\314c^%\0234\213\371\214\231\212\271Q\bs\227S\375\376r\030\241Y\221\337\220\027\337[\356\"\344\262\020\237\227\201\264\274+D\024\026\275\377S\2276\306\025f2K\305\363\336\273(\305\207\b\361X<D\360\036%\357\377'2\006\315\300\274C\036\351D\305\254\243s\2769gV\235\203l\004\006\037\n\213\365X\317\242\337\025\302I\025\2662\231\245\035j0o\3169\345I\264\346\3159g\237\326\032\206\r\300n\256V\006|\300\b\234\300\n\274\300\f\334\300a\025\304\300\"|\365\252\274$\225\227,\004)1\013[\3000\n\023\266*H"
+	.ascii	"^\330r`\001\b\341\013\f(\305S\256\256\b_\3000.\256/\340o8\315"
+	.ascii	"\233O\363)\251\002\244\354f\205:\024\253?\035\312\351OMw\n6}"
+	.ascii	"\246M\355\007\323\235T}\351LA\245/%]I\210\364$\244\034\243\360"
+	.ascii	"\350K\214>\365#a\321\215\210^4t\242\253\017]\246MmN\350H<`\210"
+	.ascii	"9\342+gP\250\036t\241\313\036cp\316\345\315Yv\004\364\240\363"
+	.ascii	"\256\214+\264\376s\240\363\356\306`\326}\376\363K\031\203X\357"
+	.ascii	"\271\317\1777\n\257\336\363_\233\332\214\021J~\250Q\\f\315I0"
+	.ascii	"\241\224\224\024\024\322\034 \003\t\204\210\332\021 \235\203"
+	.ascii	"\314\310\005TY\206\032c\343\375\211\364\224j\332F +}\241\346"
+	.ascii	"\316q\033\350t&l$B\263\006\212>P\026k\344\f\276\022H*\f\0210"
+	.ascii	"\265Q*\315\233p\224\330\\fib\347\024\344\326)\334\303y/\310\036"
+	.ascii	"fy\f\344\337\341\032\372~\351\360@CO@\361\2536\004\235\306\""
+	.ascii	"\223\3676]&h\260\005\016]\032\"\3411\370\026\226\244\233#\354"
+	.ascii	"\252\272e\336\030\275\246\004\245\005\277\335\247\2551\357\273"
+	.ascii	"\322\321\004\333\216K\032\036\333\224!\tLm\344f_\350\236\334"
+	.ascii	"J$\313\0262`\0231C\0066\0013\344\300\226\310 \244\224%^\212("
+	.ascii	"\251Xo\377\210v\013`V\341\004\2658\374\037"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.105.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`3\006\245 "
+	.string	"v\276\316H\240VN:\304<\340\330\253'+\342\210c\216\232\207,\367\005f\267I\377\212\315\204\323o0\036\224U\206\021\370\020\226\263\354\023\246!\216\016\257\303\353\360)x\213C\315\3625b\372\034\032\372?\224t\354ok\226\354$e\n\272"
+	.string	"\247"
+	.string	"\303"
+	.ascii	"\353\230\271\306\315\365m\256ms]\233\353q\256\347\\\177\256w"
+	.ascii	"\256\265\200\214\024\020^\352\"\215$\273\322\276\220"
+	.string	"h\243\020\027jC\225L\325Lo\2535\207\352\260s\316\3223\307|\345\262\354\234\216\2527\264Lq8g\026\002\211l\303$\317t\030C\304\220\200\307\264FPmlP\222\004\271N\300bta!I\222\200\216\026p\323qh\352\332:Ci\004U\214\303\256\206\364p\243\013\bI\216!\371\350\246\243\307T\247\246\343Mqj::h[\321\261\025\344\016F\230\017e]H\222\004^\205\006u\203V\305\2418.\257\016\2726\003$Iz\271\274H\250\257\266\001\330\376\3315#\001\233f\335\352\231\026!B%$H\004=\323\037W7\222\324R.k\017\365Qem\241\243\255\256V\271t\264^\325*\\X\345r\317J\t\264\362\035\354\261\255}\n['y0{\256\245\346:j\256\241\346\372i\256\235\346\272i\256\231\346zi\256\225\346:i\256\201s\375\233k\244\271\366\251\ruO\311\324Gj\2466R1\325"
+	.string	"s]4\327Ds=4\327Bs\0354\327@s\3753\327>s\3353\327\274\271\336\3155\317\\\357\314\265\316\\\347\3145\316\\\337\314\265\315\\\327\3145\315\\\317\314\265\314\\\353\346:7\003St\337%J\177z\356\002\312\312!\356\343c\316+\226\302\037\352\351\201$\265"
+	.string	"\334\216\273\226D\333k\277\035\b\201F\261]\2678\235\351\265\377\224\225\302\371\177\374\256JI\264\023(\224'\301\027\n\224\303\225\007\013\251\357\177[\031\324\365\373\261X\016\233\216t\275\342\320q\304\227\331\r)f\302\245K\275\247%\351Q\357QI:\324{O~\177zOII\334\372\335\351\275!%q\353\367\246\367v,\335w\246\005\352\004m\3518\024daI\367]\211\2016a\222\344\345w\337\201S\252$\311\357\270\023ia\276\373\216\364\027K\342\326\246Yu\270\201\"\361\217\033I\222OG\250|W\035\2722\272\266\bi\210i\005\0314K5(\006\365\324\357B\025\025\320\002\204\007T\022\034"
+	.string	"'P1\250\002NaU"
+	.string	"\376v\266\242\320"
+	.ascii	"\013h\301\312\n\013\230\033\323\322I\036\3147+ahZ\337r\357Z\274"
+	.ascii	"\034=K\2170\243_\371\212\246/\036^L\024]\350=\242\353^$\365\241"
+	.ascii	"\023\r]\250X\016\203.t-\211@\367y\320\317m\007\272O\021\370\250"
+	.ascii	"\377\234\007\246\034\366|\336"
+	.string	"\347\351J\357I+\205\274\357\374hw\336\225\347\272\357>\240JI\214:\360<B\235\333|\3476&9\267]\347@8\317\371\317\315q\336S,\2057\347\225\225\303\232\333\\i>_\363Z\261$2\335\3514\307y\"\203\313\314cn\364\355!\363\031\335s\227\371\200\003\032n\250Q8\245\fe\250\344\224\024\224$i\016\340\002\221!\252\016\02105T\254\202\232\226U\315\001\002\322\235\314`k\206\004\243Kw0a\3179\355\007ZO\"s\3445\357\024=\265n\004c[\033a\374\023\237r0\\\355\301a\331\266'\316\b\tL\":\377\2106\221.\365\234\362*_\207v\361\217\310\355!\027R\215gH:\003S\367\302\263`Y\005\025-o\350\f\213\023\226\003\326>)\266\342akT\023\246q\362\231-E\026\305\364\264\300?>\244\330>\b\2430H\3113\244\036\277&)\313\314%\364)\242\233q\367}\260"
+	.ascii	"\251\205([\200L\211=\026\n\356\337\206`\254I\203\372\0223`\330"
+	.ascii	"z\313\377\352\332\241Qn9\200<4`\330\274:\025Vj\321\301?"
+	.text
+	.section	.gnu.lto_isUpright.106.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`s\001\315\016"
+	.string	"\346\033aD"
+	.string	"\261&\035C\264\3369Z~\016:\367\300\376<\267\233\207\321\231\256a\327e\342H/Q\244jN\325[K\b\302B\b\337\264\325*\207\340\326\377_\372\247z\f>\240\304)H\246%\230e*!do)S\nN"
+	.string	"J"
+	.string	"P"
+	.string	"6\347\361\266\212\315\361\001\004*\336\376\275\264p| \261\224\260\331\3752\335\360\355V\204\232\233\177\205,\310\020bf\344q\2670\013\217+\t\005x\022D\251\034/\004;v\3670O\n\336J\346\025\262\273\316\221W\341\276n\273\304\266\207}\026\001\313\2517\353\232\032R3Di\303X\346#X\266\tJ~tU\200A\244\234\375\205RM\366\341j\311v\032\323\364\005\323P\323\232>\200"
+	.string	"4N\336A\254v[V7[\023i8\330\276\217zL\312E\3707\027Z\330<\332)\001\"V\345GVY\217\252\2079\364\300\301(\221P.*<3 \306M<E\207\343ew\023\2348\212\021\377\364h\022M\273]X\217\227>\346\005:\250jH(\232.W\207j\032\361\364S'\261\371';\360D\337c=\246z\310p\351r\225\271\033\356\200\240x\264\354\244\001\211\366\200AV\242\211x\262\016\310$\003!\340\017\204\021Pv\362\371\2002\316\327\035\256\226\234\360\343\251\037\317h\340P'\330\306\264\243\323\220\241b\neXnt\271\302,5\371\317o\227\213Z\362\245\252Z#\365b\305e<\023\" `\202Q\210\224\033\320\b\r\021\031\312\f\225j8\235\216\346X\024\\\004\365\301\316R\245-"
+	.ascii	"l^\254\315\362~6\276o\2355\302CX\t\360X\216\272\305\345\332\360"
+	.ascii	"\374\3412\026\314\346\234`\347\377\266\306\355)\340s` \325\036"
+	.ascii	"C\033\205\033\233\200\313"
+	.text
+	.section	.gnu.lto_imuInit.part.0.133.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788@\217\322\001X\320\031_V\267[\025:3\022\2306-@\021\377\001\025A}u\366\214\221[\242l\004Q\004q\006~\302\tI\007\324\002]\326~\200\013Tle\023\271S\n>\230\336\234\234fb\363\030\270O{\3608\200:\235\206\3734nr\f\274m@\235N~\022\021\035\005\204\254\350\264\216\334\346Gn\n\354y\270)?\317\233\022\263\r\177\255\236\3340\302\312P\rU\224m\f\364S>6\302U +<Zd8\262\354\321\276\300\200'Y`%\204\265\241#\250(\353\365k\365dkV\032\020\331-\275\270,Id9\261\237\n\331\030\366x\024\333!\017\213\354\226\253L\366\253V\307\252\265\273\362QK.\272\302K\344?u"
+	.string	"\222it\r0}\034\022\374\302,\354\2563 w\274\355\004\333\034\333*\001\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.137.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\345\002\365\025"
+	.string	"F\251\215F\260\032Q:P\303\3558\036\032\211\025z\350F\215\367\306\361\374\300~\244\347\340n\350\2115s\\f\255\277\367\343\332\016\260:&>\357\031v\347\314\241\237\320w\204\337{M\247\3462\2264\2002\277\020!d\023)S\nz"
+	.string	"o"
+	.string	"x"
+	.string	"2s\316 \242dN\233\202K\227\300\313\233\323x\227\335\013x\227\366{\330~\2450\314\266r\233\215Y\263\003L\211!]\346\234\247\313\255q\330?Ov\253 \314O\360\202Km\214\375\373tn\3270\305\347JmlqOk#\213\313\016\007\313\222-4>9j\244q\204v\244\221\246;3\222\350n\346\234\317]O\2143U\002\007?\2359\247/\373\271en\233\204\355\b\366~\001-}\315\317}\200\320\0241E\264\215\351\002y\301n\3169\2754l\360\270\373\223jO\252e\247\356:\365\256Zo\373/@]\230\210\346\3649\n3eH&:\216\373\355\373B\036\304\317\231d\373\270\227ohC\354\344S\305\274\t-A/\260\3149M\227^"
+	.string	"\376v\377\366\262I$\253\336\366:\020\021\235m\216)\254j\337\307\177\300\016D\204\003\267\361\344zQNDa\307\202\005\357R\356\307\334xW\362\272}\356"
+	.ascii	"f\354K\336n\267\326\022?3=\262\377\344P.`\310\220\301\273\334"
+	.ascii	"=\216\312^\347\234\261] \233\256+\006\251B\323/\366\233|\310"
+	.ascii	"N|\034\326\340!\017y\227\272\f\\ \361\362#\323\243%J\274\241"
+	.ascii	"\025cF\277v\212\207\003"
+	.string	"\f\222^\350GBpNY\221\033\361\340\343\270\364*\324\327.\375\320\003\021\254P\345B\245D1t\220\352\341a5H\365\270\\\241\330\301e\240\265\223Z\251*\270X)Q\f\201\n`TN\210\225\352\344\352\300\243\352\341pb\2516\254N(\261u\312\251q\370!%\236\\a(\236\364K\343\366\2330\222R$\333\331\267@.\341\202\222\310o\2653}\006\027\224CM\007\367\204\215@\301\265\037@P!#\037E\264\316;\240\266\204\t\372\332\267]\027#\036E\263\215y\217\023\203h\205\264\361\274\243\310\362< \200\002\031+\335\006?\022\204\313\030L\016\304\037\375|\212\346\245P\222c\230\270\276\215\324UX\347\330\0339`\362Q\237W\2621\245m\317^\207#l_\213\201\363\b\337>\232\327x\313U\260d\334\202\036\267k\022\216\037\270\377\374q\306\356\260K\242>\314\177M`;k\341\356hX\bX\360\023"
+	.string	"&j\274\300\343\361y\263\343\365\222\"g\r\333\232\262\313"
+	.ascii	"\251\275sA\314\301G\217/8\325\323\341\026k\237\023"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.138.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\276\003\005\027"
+	.string	"V\351\216J\260\022R:\360\2154\b\364T\326\037\244\347\033\241\235`I\264\r\275'\251\002\357\240\204\225\n\370\020\254l\336_\355\367\267\377\320\3208#\335\206\353\225$0\202\t\352\227\254\027\220!&\3165\346C1\357\324\025\202\375\177\023\271S\nv"
+	.string	"t"
+	.string	"|"
+	.string	".\\\032\331^\244c\231nX{z\036\364\215\210>\274\275H\347\325W\277\363\001$\352Qk5pj\002\260\323\222\007p\235\316\237\270N\327\017\332\354\322\276\331\345\351[x\205\305\326c\333+,7\343><\301\003"
+	.string	"\030\354\360\302X\353pv\272&\216\373N\022\347O\237O\356{\342I\341\217U\016\253%\237\020\237&'_.\265V\303D\334\364\266\021\330>`\223\n\002\272y\234+\344%O\326\r\262=\035\243\323$tz\204N\213\274\351.\351t\b\235\006\241\3230:\375\242\323.:M\3514I\247\227NO:}\024\022\030\025\373\325\312s\374Q\201\250\023\212\037\375I\177\323\327\276\277Dl\262\235)\3072\336\260\016\301x\214\333\231r^A\324\211c\005P\251"
+	.ascii	"\354TF\376\304\3452I\t\tI\246+\251\274\235)\031?\272\320\017"
+	.ascii	"+\343m\256\\\221-wC5B\266\334\231\325\333\212M\272 k\313\314"
+	.ascii	"\314\373BV\266\2639\330\202\354\026_\353Z\330\276\230z\277\035"
+	.ascii	"\315oH\2756\001\226PG{\224\r\327\266\220;\351n\261\227\202x\223"
+	.ascii	"\274Zu)\273\344\nx\352\251\330\315\243\347~w\007H\365~;\013\207"
+	.ascii	"z\232\373),\273\3464L\204\325Z[\374\031w\252\371C\247\326p3\357"
+	.ascii	"\273q\235~\201ZP@\277\240091:\313\001fZFeC\rm\206S\201\206v\201"
+	.ascii	"\302\f\003-\246"
+	.string	"f&cs3SAq-\303\214\315\f\247V\263\231\225'\353\006\371\304\233\314\037\347\212\255\007\333\261\265\213nw\336\223\273B$x>(\325-a\222\265\027|K\213\001\311N\252\035#\250x\233k\360,\036U,\214\272\024\333\301\261\256 \374\024\215\306\221\265\037\274\312\304\330\225\216\027#Hxyy\362m\351\346\321&Sd\355\t0\363\276\221J\250q8\345\220r\002\022\242$\222\322h8\220\002\221\271\252:\0210\275D\024\bU\250@\323v0\004\353\"\345vC\372\243\025\200c\022\225j(\0259NRT6\377\226\213w\036\346\212Va\341\221\007\004e\023\313U<}\260\344\312VS\035ZCB\300z\254\303\"_I\377D\027^\"-\200ah\023\205\205l@\031\260\307\337v\t&\256\367E\302\332&\257\n[WPm+\210pP;k\234[ \240\250\314\331'\241}]\"\262K\b\277\005\354\205"
+	.ascii	"S4PfFu\257\200\306\272\3703\036\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\001\006\035\027"
+	.string	"v$\205I\260\326i:&0\341G\215\217\f\331\016`\3114\370<\270\206\005\376+\274\321\255\007\330\256\260.|\b\020\273\316\f\200x\020\037\007\026\236\202\025\236\002\027:\031\246\371p!t\3029\352@\213\313o \3210\230p\324\204$\221)l"
+	.string	"s"
+	.string	"p"
+	.ascii	"\367\312\252CA\377\b\355A\210z[\f\375\nhS\004\n\365\262\360j"
+	.ascii	"Y\232\tz\245\274\353j\007\222\273\225\240~\022\017\350T\340\317"
+	.ascii	"\247|\372Lz.\204\347\273\235\213\201\377\001\350\234K\316\265"
+	.ascii	"\360n\267\333\341\372K<\004\257:\320\317\362\2563p\037\344\177"
+	.ascii	"\200\374\257Yon\005\326\262\2549\376\376\257^\354Wk\2558\375"
+	.ascii	"\"\336\377p,c!\372_@\364\267|\350\177y\350w\351\320\227\262\265"
+	.ascii	"\326\277\306\241\357e7\030\201\032~\005\376+\236\242\240R8e8"
+	.ascii	"\026\370+E)1E5A5=%9\251\300}M)\f'\002^\350G\261\320\207R\241"
+	.ascii	"\377\304\243\320\357\232\320w\"\241\317\025\241\237z\020\372"
+	.ascii	"[\336\203\276\226\203\203!\365\233x\r\276\343\250\217\304cp\036"
+	.ascii	"\013\216\032\275\007X\364!\340\037h\r\231\222\346\314x\372\214"
+	.ascii	",c\366\214\034\203\256Wk\325\375\214,\246\342\211\223\361\242"
+	.ascii	"=2f\332\025\243\261\263\362\221\261\f\325\2028n\030\371B\026"
+	.ascii	"\323\035\275\250\252tB^ty'\3445wyBFZ\336\ty\251\374\307\3439"
+	.ascii	"\232110)\356c\0304\347c\245~\026\024\375)I}\257\023},&\372UJ"
+	.ascii	"\364\303H\364\251\214\350\255\"\372\001\267\355W\200\003\f \300"
+	.ascii	"\253\265\377\232\312\352\"\005px\346n\034\226\343\215\227\352"
+	.ascii	"7\266\005\3358Ls6\033\207\347\262\013\256/[D\017\213\241\223"
+	.ascii	"1\253\261\255\306[c\327\206\030\030\326\fm\210\306G4\026\321"
+	.ascii	"\034\032\026O!\032\016\321\037\222\305\223d\230\023G\006\315"
+	.ascii	"\370(\2341Sn\306b\27183\224\300\220\315XDgl\333\017h\206\227"
+	.ascii	"\320Zz\203\332\2445\001o\2501\020H\222\334H\220\246 )u\320\002"
+	.ascii	"!\242\332\034\021p\020\022\032\207\242\221P\202!\321\003\331"
+	.ascii	"D \206\275\225\227\232\005\333\240\241G\327\2317\265\370$7\244"
+	.ascii	"\274\2149\331\366\001\021l\211'U\364\311U=q!]E\022\0172\217\354"
+	.ascii	"t,\316\003\323\305\022o\207J\213\363jM\331\362=\202\241'\377"
+	.ascii	"^\002\206(\354g\317\377\266\374o\313\374\367\363\373\313\272"
+	.ascii	"C\373\222\b\020s2\240h\360\320M+n\200\270\316\210\206\204r\024"
+	.ascii	"\260\371\340\257&\323\376o\025kS\013\274G\213!pQ9\270\256D\007"
+	.ascii	"\217)\223\377\345^\347M^\314\271\237h@\2074\206\322\307@\226"
+	.ascii	"|\345L\364\033\003\220%TyC\351\326\360\235\2434\345\343\327Q"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.refs.772c043448d8a3f7,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"5\n"
+	.string	"\346\\I1\200)Ic30\263\342\023#2\"#2\"#\204\207\250O\035\001\364\206\f\201\377\026\325>\262\266\265\306\026\211m\204\264\326\354&\204\020\262\211\224)\0056"
+	.string	"="
+	.string	">"
+	.string	"\3324:\363\362h\005\265\262\021n!\334V\334:\270\245\270\235\270\225\270\215\270\205\270\205\330>l%[\207-d\313\260m\260}V\307\226Y\027[e=\333\327I\317\020^X\252\205\265\024N'\234JX\373\340\264bm\203S\006\247\013\326J\254\225\254u\"e\"U\221*\221\016\331p\3500TY\350g\303)1\023\262\364\261\324\301Q\307\263\320\243\013G\227\023\223]&{\023#\024\001\0070\037\214\225\026\013Al\343aWD\037\311.\021U\222=\"\304\3211-4mcZ\306\264\214\351bj\246\233\217F\007\200.\220*\f=\311\\2\007\245\030\326\006&0\005\0261\212syPuzJ\004g\023\351b\221\371\346\223M0*K_\0360\035\311d\324\252\367^\333"
+	.string	"\343\222\314g-\263VY\027Pj\t(\022{\317\3768\300l&\313\004\n"
+	.ascii	"6\233\"2kot\031\227\323\341\363\253\315-\021\020\370n\003+\266"
+	.ascii	"\340@\205C\230\002"
+	.text
+	.section	.gnu.lto_.decls.772c043448d8a3f7,"e",@progbits
+	.ascii	"(\265/\375`KE\2151\001\232\022\236rV \fY9\351\324\237\202F(\324"
+	.ascii	"\261\031\242\333\215c\362+>\226z\316\302\272\334\230f\330\261"
+	.ascii	"z&Z\304\247\037y\236\001A\241\232ZUV6\210*\241"
+	.string	"k\336\340\267\213\tr\035\233+\227\201\313\317\\\250\361\245/\211F\315\363\330\254?\341\007\343\255\310\375\t\331[\356\0240\006\"\007I\007\367\255\006\377]6\366$\017Q\321w\254\223T<\365\r\253\001L\354\220\265\223nR\223=\326L\362(i\251:\035\214\365\222\226\252o^\021pB\007II\t\004\2156/\370\276\335\360{\013~_\301o4\3747\022#?R\302\342X\351\313\243\301\204\242\210r\036\222Fy\244\213\324d\0331\322bM\244\276y]&_4(])\313./g\023i \265\347\305\013fX\372\276\221\3705\317\227\230\260\036\322a-\244&\273z\307\273G\003\0212s\336\212\013\003\353 \r\244\276y\345K%C\316m\231sVBRR\032\222\361\260\203\357\273\t~\037\301\355\243\275jRC\377\200\343%u\325\367-\004\243 \347\252\341\254uuU\303\371\376\201\337\\\370C=:\317\346\312"
+	.ascii	"Oe\231\342\244u\264V\035%n`}[\253\253z\2065;V\200\214\032eO\265"
+	.ascii	"\251c(\326\374}\243\263:G\333h\034\275U\223\255\3254\336X]\003"
+	.ascii	"D\210\326\252t*\036\213\f\353I\353z\243\314\031\t\245\326\265"
+	.ascii	"\224P\024Q\236\222r\023\2263\362M\365/\275\265\372DKY\344\025"
+	.ascii	"\214\342\t\033e\316\310\240.<odB\267\"\353\321\211T\215\316\367"
+	.ascii	"QF\3751EJ[\337w\024\376\337/\372\252a\324d\307h\027-\300896\013"
+	.ascii	"\241)\242<\325\345\026V\3261\332\252Y\\\365t\205q\301\004(\213"
+	.ascii	"\0238Z\370\276\242\301\257]\360k\033\356\024\255\242&\337\326"
+	.ascii	"+\276\233Bf\264\234\363P\375\261\305\370\243\357k\025\\\"\347"
+	.ascii	"\234\353\333\316\236\272\272\272\272\372\266\3635\n~M\342\327"
+	.ascii	"1\374*\206\257\254G\347\353\016\334\271\2155\231AG\275\242\251"
+	.ascii	"ynF!32g\344P\177\341\211\362\244\357k\026~\315\340\264uu5\203"
+	.ascii	"\363u\006&\252Gg\255S\355\324\244\005\365\316A\204\2705\236\r"
+	.ascii	"\005\345"
+	.string	"Y\222\307N\337\327\026\370\325\202\263\326U\013\316W\024\370\257K\013\206\2203X\354\230\223D\347\214\224\0229s=M\264t\251\365\255s]\343T\272\327\271\n\347 B\034h*;\311\031Y\347n\316Q\265^ T\353\005f\233\220\250'\347}5\342\277\312)\277\270\350\250\352[\337 u\214$W\320\364}\020\377\325M\233 \257:\344Y\232\252\246\262\331]I\363\342H\337\277\306\275\262\371\353\232:\366\265\336\312y*\347\\A\213\221\303\261\354\013T\215\316\336\252G'\006\325\350\254h\226^\343\214\316#\0262\253\345\234\207\354\025-'\356\364\3553n@[=\304R\364\255P\330\324\270dar\005\312\013`\325\312\232\225-8\332\202\374\025\256\206\251f*\230J\246\216\251b\352\227\372V\313\324d\227\352e\252Z\2712\245B\3012\346\304\255j\371Z}S\253aX\254(s\316JHJJJu\307\2354B"
+	.string	"p\033Y\217\316\244jt~\005|'|\024\237\004\370<|\021\340\177"
+	.string	"\237\003\370#\360S\300\034\252\321Y\233T'\225\212\255Z\261\225\325rFb\3503q|\354\350\373\277\252\325)5J\225R\223\225\312_\241\324\264_d\316T\234\230\345\350\340IV\331\331\327\204v9s\321\272\222s~\035\373\227\376JV\313*\225\212\374\232\320\0242\007\361\371\001c,\3112\347\214\244\244\244\244d^a\361\n\342sk\256G'Q5:_\321^t\226C\334\007\037\343\237\370\027\2771\207zt\336jt\376\255\036\235G\326\243\023W\243\263\315\334&\240\342\3579\273\364w\007\373\341\377\235\254\356 "
+	.string	"V\003\025 `\301\177S\3607\231\277\305X\017\1773"
+	.string	"\377\267\205\2775\240\302\343\330\371+\227\277~\371\253\227\277\206i\342\322vp\373\321\177\347\244a\220\246\371;\003\233\201\005M\202\320\177\255B`\340\025\3747\314\337ru\203nc9\370\217\324\264V'\313w\377}\362\363\277G\224\036\347j\340\267=\033\374uJ\007\300j\360\327*\177_\253T\337n\364\337\023t\260\024\202\006\301\213\376\313\373;\203M\200\207:\200\323U\r\002\370\333"
+	.string	"6\351\377\235\254\2773\260\031\374\255\366W3\026\001\277="
+	.string	"\3227\f\240\276}\203\377*\340\177\234\323\201y\203k\263c\300b\220\200>\322\240r\360W\017[\352\006\325\203\277v\370k\036[\200\337^`9\374\375\305\022\240\355"
+	.string	"~k\301\177\244\377!\030z\006\377]\301^026"
+	.string	"\177c\253\341\177\234\323u\b\267\210\264H\177/m\005\026"
+	.string	"\177\225\200\b\177\267=\262\031\032\205o8\002~k\364\377N\355\023\340\2772\376\257\371\317\346m\322\244\250]\231\305\016]"
+	.string	"\3775\372\253\003\376\312\200\277\206\3607\213\377\3677-\370\233\310\337H\376>\362w\221\277\301\376\026\373\333\310\337J\376F\301\372\374}\343\357!\177\013\261\273\377D\277I\374+\210\272\364\337\376\367\003rt\376\277\375\007\363\277\314\230\377p\377\335\376{\371/\346?\231\377\3746\371?\355\277\224\377j\377\243\334\374-\335o\361o\315\277\351\374M\367\267\334\337n\376.\3637\230\277\267\374\335\366\367\224\277\243\374\235\374\373\311\337f\177\217\375\335\344\357%\177\267\370\373\004\177\233\340\357\364o\022\376\016\376\335\364w\357o\020\374\235\364w\007\376~\300\337\033\370;\204\277G\374\255\201\2771\3607\n\177W\340\357\t\374-\302\337\020\370\233\001\177+\340\357\020\177w\360\367\322\337\036\376\336\340o\245\2771\370\233\303\337\003\370["
+	.string	"\177W\360\367\321\337?\177\357\376\032\346\357\373w\377\375\277\346\371\257\302\3778\377\331\374\177\363W,\177\275\363\327:\177]\376U\316_\333\374U\315_\327\374\325\314_\311\374u\314_\337\376\337\371k\3775\001\3771\360W\267\277f\371\353\225\277\216\360\327\007\374\037\361\327\020\177\275\340\257\034\376\317\371/\347?\335\177\345\3776\377\315\374\247\362\377\002\377I\360\377\313\377\ruuuu\377\256\352\377\331\362\177"
+	.string	"\023K\330,XY\212\276\007\262\302\277'.\212\337\252\337\252k\3259\347\034\326\223\306\243\2062c\035\223\256\2259\306\310\020)}\377\243\304\377\353\373?s\3241\347\374\302D\346\243\024\320\371\327W\263\326\244?\250\332Z\200\3777g\017M\310\034\205\347N\316\271\316\341\"kQY\034\262\371\226\363\024\2271\002\\WS\\4\252\320\270\2560T\241qe\343\324\020#\206c\3462V\241\345\214aj\312H\302\326U\025ZT\306P\205\226\2572\325\230\253\232\221\\\306<\265\2251\344\251\034\225\321\266\2568TMq]U\241E]a\250B\343\272\312h\\\231(OE\035\255\246\362\021CF\343\222\313h[WDUh[WUh\\`5\207\025\231\362\305\235;<\350T\261\252\251\334\202\305\215\250#\321[\025r+\307\345\\\325N\344c~\313\271"
+	.ascii	"9\337\330:\306E\321\250W\244\336ZHQ\211\332\252\310\234\263\006"
+	.ascii	"\026R][y\352\315X\363[\225\221\255\234\215H9e\0269\347\354\201"
+	.ascii	"\021\371\226\177\3247\343\216\033y\305\211\234\003\220\2219\263"
+	.ascii	"\310\331X\363[\316\331\230s\3569\336"
+	.ascii	"@\346l\203\250*\214\005\213\234\261\220X\344\033F\266\0239\267"
+	.ascii	"\232\232"
+	.string	"+WUh][KlP\320\3022\n\244\261V\255\330\312a9\216\353\210\321\214fyE\316\271\306\301aW0\340\364\275S\267-\251\004\353\373\237$\276Qji\354\344\220\321\367?D\360\315a\304\316\344\372\376\247\007\266y|\326\246`]\035\357\334I\223\n\243\334\212\332\321\246\357\177P\324\251c\263\370\034wR\310xQ\376P\341\345k\322.m\026\263*G\211}h\002\207\245A\257\360\262V%\317\0349g\025-;x\364\265tH\264\234\263\206\352F\313N[\337\373\250\301@\246\314Y85i\343\240\305\261VVN\310\210\314W\247\325\017 )8P\2408\357o\225\267rm#\310\031\315\212\027\020e_\373f\351V\331\200\257\035L\372Z\333\246\215\r3\001\231\215B.\314\300\304\335\262\371m\032\253\306\256\031J\343\305\214\261/\322I\316yh\307f\347\210\214\276\365\255\036\235\033\252\321i\321,\335\306\365"
+	.string	"\3211\366\325W"
+	.string	"\325\3504\263;\023GK\255\357}\262\340\337\226\261av\306\244\372\276.\251vLM\3321U\271\253\312\031\306\006M\304\212\314-\363\361\250\301}\222\340$\373\206\034\002\212\232a\005\256\357}\206\340\337\212\271u+\023\226D\252o\230\235\0176rb\372\336\007\007~-k\313\n\323b#\254\213\005c\277\324\244\365b\267,y\261\\\212\230\371X.\225\206\242\272\204\374\300\367>7\360}^\340\373\034\361}Z\340\337\276`\263"
+	.ascii	"\261Y{\201\312b\271\326\311\021\037l}\357#\205\177\313f\253\\"
+	.ascii	"\305\315\321\351\233f\253t\2247a\266JS\261j\306\236"
+	.string	"*p`\307e\262JC\251sBFdvq\202]\201\035\255X*\366\212]\253I[\305F\271\225b\247Lu\232\255\322j\225\215\320\0242\033\3177F\260\3432\347\034$F\231E\205\317\365\311\365\350\254[\325\350\374\316\013\266i\246\326\021\2678}\277c\303f,Y\323\345|\345A\026\271/$\313-n:\346X\243=\321\225\224\305\354\013\311\262\253X\351+\365\r+G\031=h\2033s\246\347\254\331q\327\"\351\245\264bQd*\263\r\262\210}!Yn\341\322a\2708\264\211}!Yn\261d-\246\313\274\370\320v\365\205di\225\330'v\211\035\263H\233\264e\366\314B\261Ll\023\213f\315\254\223\232\264dM\347-\245\247\034IK\235\253oX\331(\207A\233\031\231\255\262a \2348Z\200G\re\317!\353\245\315 \2348\356Z$\265\224m\306\222\265\234\034e\004!\013\334\027\222e\316\310\207"
+	.string	"\021\302\2225[\267YdX\017\224\244\220\256Bf\305l\022\030\030\264\311}!Y\006-\233d\036\003\270H\252\021\2522#}\277\243a\244&\355\021K\344\327\036\261Ej\233\372\246\226\363\325\006Kt\370X\326\254/Rb\356=\256\203\217\317\340\343-\330\202i\030\332\341#\312L\337\3434leWXdX\tR-\224_v\210\rR\223V\310\255\020\313\302\352"
+	.string	"\341\3041\003R,\224B,\220\203\331 U\225\243t|\020\243\303\305e\251t\241xu\311\201\357\361\n\374\336QCC}\363\212"
+	.ascii	"\221)e8\226(\255\016\333\302bm\220\252B\201\013\025e\326\333"
+	.ascii	"\204v9s\251i1Q\336H\252oj$\\q\242\314\031"
+	.string	"iu\330\034o\033\242DiuX\033\032\204\242\220\371x\376\360\312\003gi}\330\037\226\313\366\260;,\017\353e\273j\322\352\260[HJ&\224\344\322N\321}O\032~\017\022\277G\t~O\030~\217\017\374\236-\374\036,\374\236\0264\214o\306\270\350\373\023\017\376ocX\0315ig\330#R\007.\354\013!#\206\234w,\315\2600\354\213\372\206\205\314/\212\332\304\311\231\261\314\031\211\244\244d\255\254\231K\236\367\247\023\374\333\027\366\352'\317\230V\036{e\217Bd`+v\364\375\271\003\377\324\302?g\340\237.\360oU\334\256\350\266\021\230Q\254\276\240\350kS,\335\252\240\362Z\361\242o\006\325\350\374Y\205\177J\341\233KK\205\205\230\271\361\002\031;e\245\310\250\3458\033u+u7\247\032\243\226:`\272\016\317\235\031l`}o\246\341\327d\347\301S\305\210\025\225;o<?\210\020u\016(o"
+	.ascii	"\252\003\306-F\337\323\265\235\377;\2413dkY\354\324\021b1&s\325"
+	.ascii	"i:;9qx\232\364\275I\206o&\301\037\252\321y3\f\337\374\201\343"
+	.ascii	" \r\301\320J\253\352{3\006~\007hZ\2155;b)>\300"
+	.string	"\2249#\225\r\247&[\256\327\3105\233~S\337\324r\024\f\f\346d4F\226AR\226vf\234\267M\273\031R!\004\305\227\2266S\360/\022\034\327i\372E\022\b\220\270\333\205\177\217\370\310jt6\231JFN\035\253\276\277F\334o\rW\223=\346\367l+\243\345\214\f\262Q3\302\254\365}M:\207\222\316\333%\276u\203\377\016\003\306\252!\331\252\372~\261pF\262\266\364\275-\203\377\327d{\351.\310\214t2y#u\354{\353\005\337\266\341_Q\303\235\245_x\2675\226\334m\036l\345\034\325mCwr\216\032\252\365\202Z/\270L\272\300\244\234\367\366\t\276E\202\377^{_y\3053\202\\\001\006/\307\034}A,\275\327N%/\350\240\323\367\026\f\377\355\013cd=:kU5:oq\340[\032\270f<\270\036\321\332\254\207\022\211\226\276\357@\311\327THY\225\231\365\222\257Y\263#"
+	.string	"N\220Iq\326Oj\262\315\032\371\213\314JJHx\016\334\033\024gv*\343\270\321C\003\310\033\"\313\\\205\2254$\344K\032\25557\335\334l3\324\305LEV\337\233l|\212\360@K\322\367\034\234\315\270\272\352{:S\215\320\221\316\025\0335f\032\034<ZX0\363\211\03492}\343\256!\350\214\\rM\337[\027]TW\264\270\375b\3142WE\316R\037\220Rq9c%\001"
+	.ascii	"\313\362\f\356f\231\233d@\204x[\004\362\2341\031\363\357:J\030"
+	.ascii	"\272\261\276?\262\202Og\276%\261\243\342L\277\3315CMb\364\b\322"
+	.ascii	"\367Ge\370GL\272t1\301\244\020\002\323\321\002\216\371\345&\230"
+	.ascii	"5\035q5|\3645\275\034\t\331\262e\003\233\230\217\345\362\247"
+	.ascii	"\n\\\027Y\337\037\351\250r3K\025\263\255\322Ud\306\3322\3029"
+	.ascii	"@\016/h\260,s\325\215\244\246\0369\300\274p\263\r\314Y\227\274"
+	.ascii	"\302e\262\335\304\362\357z\320\230\371r\326\367\031\322`s\355"
+	.ascii	"\346\225\177gf\301Xc\244\3573\224\301\277i\345\337\001y\201q"
+	.ascii	"\203\323\367\031\334\3603l\2312e)\212\f\034%C@\234\304\001\323"
+	.ascii	"\367\031\274\322\322\314(Wj\334,\023\25339L\265\233Q\202\350"
+	.ascii	"\222odg\376\357N7\027w\352\364}\206\255d\362z\325\263\354\"C"
+	.ascii	"\331\331\030\033\313\2365/\2440\243\363\344\211iV\211\220Rf\254"
+	.ascii	"\302r\306J\302F\263\030F\372\336\310\r.3\313L\263z\226]h\300"
+	.ascii	"\350c\251$g\254\244\017\234\r\201c\"o\232\255\245\251\201\313"
+	.ascii	"b4\366\2324\307*\033$d6nH\242#(\305\215\245\215\2767\342\202"
+	.ascii	"\177\263\211\331\344\032\233(\347\256\262+\371\210\245A\2453"
+	.ascii	"\343\352\253\357\215\242\230\307\2336\314\243\271dI*G\r\3410"
+	.ascii	"&f\232\025\031\202\242\257\222\236(4g\272\364\275\221\023"
+	.string	"\234ej\221\261\201\202c\215\222\313\334Q\337\274\"\200D\2142\207yc\203T\225\tN\324(sF\212\231=\314!\365\r\213(OYY*M1SG\\\0213\211\211\3044b\206\231D\314#5i\212\231<L1s+\2152g\344\320\\\2234\032D7\353m6HU\231@\346Fi\n1\301j\322\034r\244\016\314!\246\0173\310O\0258M\3024(\005\301)\023\227u\336\337\fb~QA\372\210\323\327\004\322\203E\343\013U\337\033\335\300\277\351U\223\346\017L\247\204\315N\337\323\355~\266"
+	.string	"\351\252\201o\004\003\337\350\204\331\205\315(\265\334\372\336(\343\027\335\301/\242\303/R\342\027\305\341\027\221\301\277\251e\336@\3632\347v\243\342\t\263B\252\357\213\304`\223\206Yc\210\311\225\036S\372\336\304\372\277\303"
+	.ascii	"\0201S\372\336\031\375\005,\214E\337\2332\204\342\206D1\233R"
+	.ascii	"7W\243\257\t\003\237(b\313\300G\313J\216\254\253\2330~3\233/"
+	.ascii	"\\\250\3033\247\357\343\352\321Y\327,\335\274\372q\323\242,\353"
+	.ascii	"\373\"\262\272\233,\352\314\026IX\371\305\006cl74\260h/P-\373"
+	.ascii	"\"\247rp\211B\247\257ie\2520W\374\273]\226\025dn\364}\021\022"
+	.ascii	"|3\305\377\235\217\327\030!G\372v}\333i\242\270Y\365\357z\234"
+	.ascii	"\034\247\242\364}\221\030\276Ie\236\370w\026\017\230,V}_\364"
+	.ascii	"\003\337\234\372\277K\301\032\035K\372\232R\370D\221\215\fvj"
+	.ascii	"\316\332|\365\375M\343M\251\337\214j\252n\033\301\212,\2547}"
+	.ascii	"\205\252\321i\346\245\233\306\006S\373\362\245oP5:_\2241\036"
+	.ascii	"<9\016\234\035\203\303\266&G\216\234k\347H\236\260\223\312\212"
+	.ascii	"&0\352\374\332\251M\314\260\351A\247\347\204\021\030I:K3F\212"
+	.ascii	"9\027a\310\260\351\0026\307n\241RgF\331\367\030\240(\225w\356"
+	.ascii	"\374\302VdN\t"
+	.string	"\220\232$\016*q~\347\202\336(\243,\373^8@u`aq}\257\334\025#\307C\214\031 i\322\\7u>d\314\304\232\264\371uc\277X\241\243\353{\331`%i\270\360\364\275k\324\320 C\346\242i@\0216a\27306:\344\231_4ul\330\234\364\275fL3\036lc\372\3362CV\314\342\276\372\236nW\217XY\"\245\3571P\201\001s\341\270\024\371\242\024\262B\305\362\355\027\356\312\241b\021\244\357\351\256\230\240;[3\326\210q;uP\035\201\013c\261\370d2:K\302\234hN\227.\327\313n\316\271\004n\310\013\0271d\274|\r\353\353\330\367Dh\360\177\267\274&\357\226K\205t\226\215=kf`\307\306\352\022e\243\357\211\310\340W8\365\266\265\325\271\212\314.2$1\343\242\001\020\2225N\344\364=\021\026\374\337,Y\276v\211\262\n)\265\260)\370w\255^6\266\257\325#"
+	.ascii	"P<\211\242t\202\277\366\277\rP\303\314\261Jc%y\255\\)[\225\243"
+	.ascii	"\2726X\"F\364\205\377K\205\3125\372d<\246k\215RF\f\2721}Od\003"
+	.ascii	"\247\245])8\177\021\303w\344t-\243\374Jq\323qvt\260\365\275j"
+	.ascii	"-\245\025E\211\214\276\247\253x\376\357\314.9l\326\372\236\210"
+	.ascii	"\305\223\233|r\275\320\320\266\260\231j[/\262\372~\310\r\376"
+	.ascii	"\220\232\231Y\305S\317\262\013\037+\343\220\034$Z_}?\344d\354"
+	.ascii	"\226\215\335,2\262\233u\346\020+2\247$ca%\r\235Q&\311\372~\b"
+	.ascii	"\b\376\320\325\222\333d\311\265:s\256\310-\027\307\214uLb\302"
+	.ascii	"\344Zac\316Fdv\201$\306X\263\210xQ\322\367CV\370Bu\360\177\223"
+	.ascii	"$o\222\226J\332\212\212\302 \211\034\356\342\202\203\252\357"
+	.ascii	"\205\324\0349r\255\212\260\t\265\025)\362\266z\304iRe\3123\261"
+	.ascii	"\232\274b_3!S\231\201\220\004.kp!\260!C.\330\211r\316R9\343\270"
+	.ascii	"qf\211\035\223\300\336v\217\250\031\023\353{\241\0267\310k\362"
+	.ascii	"\006\261uI9\277h\300\330\225O\034*`\271\357\205\250z\374 B\334"
+	.ascii	"\037\027H\235\213\200T\3168\274\316$bAt|\370\270^5\037\351\316"
+	.ascii	"$WE\346\226\031\013+\351\214r\342\253N_\257\235X\221\256\025"
+	.ascii	"}\037\344\206\037t\005\377\227\353o\254\256Q\223\227\353\356"
+	.ascii	"\270g\331(\224,s\301d\2313\226\006;\2533B\252\364\275]M\026\343"
+	.ascii	"\004Y\337\007\221\341\007%\301\377\335\332\252x\220\266\214p"
+	.ascii	"8\224\231\251q[\346\314E\003s\355\t\r\261\276\017Z\201\377\253"
+	.ascii	"uo\\\034\026\016\033\217x\n\230\024\245\034| \267\0325n\026\035"
+	.ascii	"\243\215\337,!'mJ:}Og\341\376\357xm@\226}\017\204\304\257s\365"
+	.ascii	"\322H^\032u\016)\033\343pX\"\207\324\340@@X\234\305\225Qs\316"
+	.ascii	"\031+\033\345"
+	.string	"B\204\321Qdnyc\374\312\360)\203\244G\236\276\367xa\374\3375\233/g\220\364\375/\214\373\302g\212\234e\226\372f\310\214\0257_\372^\275\266\020\243\372\322\367\272\260h2\302h\365\275-vfbj4\001\0226\027\304\330\367@-\360\177U$\257\212\332\306\004d6n\biO\b$a\n`\303\235:\\\220\216X\201\330S\001\035\n\203M'\fQ`\221\tu\362\0217\244\277\340\217\030\354\375\230z\"\204*\020Qt\330\2042\021\245\350\b\002\254\340\023\002\203\305\fw\352PA\021\020X\f\006\205\301\036bZ\204\342\005\177)\360W$\001\217'DL\213P\027D\260\227\366\200z?w\352@\004\002{>\247\264\367\344\241\005\341\320)\025\006{H\364P\340M\211A\241\317$\221\006\177C\340y\247\016\026\230pJ\201=\324\004\342\tDb\017\352I\350#\352\271S\207!Z\342\367\344\241)\370\353"
+	.string	"\023Z\342W\002\361\367C\024\372|J\b\207PP=^\360G\364A\233zC\224\005\021|\276\236\217\t(\341\bB\351\235:4Ayh\2022\362\005\213%\374\004I\264I\3445A\001\245\274`\023\224\031l\202\262NiS\020\005\236\250\013?\342%\022\321!\023S\257\307\004\224\320w\207)\224}\220\211aJ\3745\241\"xELh\017\023J,^b\317{i\217)E\211\350\220\327\004\325A\210\207\246= \324\023\252B\212\022Q\021MP\032R\247\246\337\020j\003\304\337\316\004\223P\002B\025\234\322ao\002\034x\032\nI\020\203\275\241\n\036~@\250_\n,^\240\250\201\242\017\244 \"EG\024\237~\030R\264)(\005\376T \nGH\321\246!\237\257g\211\033\b\366|D>_\217\347#q\202\200(D\364\204\246D\023#xD\350\260\b4"
+	.string	"tD\212\022I\220\310\200\t\305\247\337\001\232\202\277\247a\357\007\003R\317\207\016\351\260\007\325!\375\005O(>\375\204\230\204\027\030\312\200\026\201=\016\240\300\236oDZ4\034\nG@\201i*\034:\251\340\343\200\177\232\202?\246\036j\302\210\024(p\002\023\260(t\"\006\340C\007&\324\205\037\260\367K\177\301_Pz\336\251\203\2177\364\340#"
+	.string	"\261\251\007,\001M{)\321\347h\251\003\372\364Sa\003\0278\201X\024\376X@\207P\025<\375R\342\004\320\264\007,\372\200=\013\230P'\342\017H\202^J\234"
+	.ascii	"\361\204\017\244 \342I8,A\003\002H{\027\030^\021hZ\204zB\272"
+	.ascii	"\3577D\203h\023\276\007\037p\360\001\b%z\016B\b\037B\370p\036"
+	.ascii	"\204"
+	.string	"\020\226\226B\370`\t\377\203%\233\246)\217\210\002\233\202\"\fQ`q\002(S1\375\245i\357\bE\207$\230z\250\023.AMQ\"\t\022\3023\345\r\323\264g\264\202O\210B\361\351\027\224\362@tp_\n%\350\224G\334"
+	.string	"\372\364K1\t\224\211\307K\207@P\207\302\324\207\262\300\203\"\261\363@\375@\365\271S\207!\nD\013@\344\371|=3\275S\207\003\244w\352@tJ{O\036\202\302\247'\241/"
+	.ascii	"O\225\310\343A\2210*"
+	.string	"\361\033\246\275\013\244\302\241P:\304\353\271S\207\324W\034\246D\020D^\t4->aX\301'\004\362xg\032,\n}<^\317\020\r\266 \344\361z\210C\224X\f\362x\230)\370[\201\307;\211\301\037\024\221\307\353\001\242<\336.\345\245\304\037\220\350N\035\210(\224\211\224\003&t\330s\"r\340\201\230\376H\340\241\030l\342\240D1\370\003r\340\301\007\274\017@(\341\001e*\002}\301\237\207!\261\350a\001i\t4\b\354\005\207h\032\374\361\230z\350\320)\205\342\361*`\001\035B\361xgJ\374\001y\274\263\227\366\230x\274\023u\341G\344\361\316\025|B\340\365\241C\236O\372\013\236\020,!\375\005\177\3470M\301\027,\226\300\324CE\370|\"d\360\371z8X\002S\017\035\236\024X\342\371|\275\263\205\236\210\021H\020\341L\357\324\241\b\365\304\023\016M4\371|=\017\304!\312\302o\310\224"
+	.string	"\224'\342C\210\017\037\024\241\236\214\210\350\320\207\310\313\200\216(B=\375\234)\260HDE\004\205\277\324\207\246(\tE\250\247\"\224\027l\372\001{\274\241\220\030D\211B\301\246\037P\004\237\257\207M0\365P\021\275\264\307\264K\211<\026P\022\204C\023M;\341\320D\323\035\022I\360\234\232~N<\237\257\0074\3549\371.\312$\034!(\374\021\177,\240C\240!\n\004\376H\234,\240L\326\005\023\320\264'\002\005B=\365\210@#\220 \202\317\327;Q_0\003)\261\207\242\220\212\300\204\246=&\250\r"
+	.ascii	"Q"
+	.string	"\237O\004\342O\003\372\364K\203E\021\305\247_\021\221\327\364#\021\024\216P|\372\375@\375V\340=\371\230N\024\330\024\354\361\200\300\336\023\361\247\205\336\320\002\201\302\341u\362\245?(\263\247\205\236\tKD\213\300\036\013'\221\327K{$\004\205\277\264\b\024\216 B5aH\357\324\201\b\325\344A\370\313\3604B\n\354\231D^P\370K{>!\nD\250\246\240\264\007\264)\017D\007i\360\327\023\024\002\255\023\020h\231:`BQ(b\017\023\212B\215\370A\211\303\242p\004\246`Q8l\002Jy\037,\245\301_\021C\t\231\234n\312\003!\r\376\212=io\304S1x\002\205B\t\360Lb\352+2\t\207)\004\205\277\340\020M{\305\022\024\265\320B\227h\241M\264\320.\264\320%J\264\211\022\355B\2116a\242]0\321.\270\320wB\272\020\n\035zH\205\302\241\207\237/-\215\300a\003\030\240"
+	.string	"\366u(>\375<\244NM? \t\017\301_\357\311\203oH\364\320\241\202\026j\211j\242\272P\377\237DL\272 \260\264\034b\304.\330P\327\220\261\2650\263L\020\362\206\026,`w\316\266AA\204\312\020\323M\317\212\024hI\204\234U>x\206\270-\203d\235y\340$\331\276\250|f\200\275u\001re`\361\230B\363c\207V\025\215\257\276\257\311\323\353zI"
+	.ascii	"\316\n\036>\314(Cq[<V\364\260p`\316\356h\351\373\327\344\327"
+	.ascii	"\316\035fa9g\" 5sU\324\372\276\002,\370?\273l\235\322\262\307"
+	.ascii	"\031\322H\232\2223:\332\240,\255\274\3302\301\024\211RRw\346"
+	.ascii	"h)\032Tv\246\364=o\234Z?q\374\304\321'\016[Ww\216\225I;\263N"
+	.ascii	"\252 \031l^p\263q\255n\224\032^]5\314|\242\324\311\2619\261L"
+	.ascii	":I.n\226}]\270\370\332\232!U\337\340l\b\351\213\374\271\202#"
+	.ascii	"J\214\276\347\325yu"
+	.string	"\302\350\274\225\264\242\314X1\222\376\363\305O\030k?]\272\254\ti\251\262\"X=\372\276\002$\370\\q\2568]\310yPv\266\370\351BI\0278=\372\236,\256\030\2406eZ\320\\\030<\246\320\331\350\373\nj\340\377Tq\215H\206\320\270Ja\266\200b\245\f\234\276'\212\023\305Y\205\204\207\310\034\267\252\224\372\n\373Y5\346E\232\354\305\316M<vN*\030^\274\364\240RwF\375\244\3729U\267\030[H\351\373S\3524\232jnt\271\223u\346&8\302\332\364\375\317\\\027\0057\266$\217\245C\366\224i\251\310y\314;\273\027(\300\256\244\315\231c\322i\302f*u\260\341\261\274IGF\033\255\023H\342\374qL\272z\226] \225E\215\261\2614\3124t\314\335\244k;r\244\034i\373\277\2732\330\232\204\231\241\274)\2474\335\324\263\354\242G\214\311\033\"Jr\025VR\3235I\001\005"
+	.string	"\30637\321\2341\335<\204\201\250\323\361Cb@(\005)\214\305\224rJ)\232\232m:\023\025@ HL\030\230\016\330\325\036\023@\203\313\r*\003=\314*\247fF$I\222Js\223L\200U\244\305\031\023\333\236\2065\303\\\207\275|\007\251\251\006\225kN\377\234\0258\236\300\377\354\n\035F}WVr2do\335\004\221\334n"
+	.string	"\352\013\314\356\037\016\\\321\210]\272q\332)\025"
+	.string	"fL\250Y='\307\f?\007\035EY\2370\306\005\306\r\r\203u\353n\214n\215\031\316\0130\311\235\237Ez\254\335Z\215\374}\261\013\237\330\200\222\347\364]\311\212lR\201m\t\224\324\367\r\357\342c\225\300\243\232_&\301a\264$J\363m\357\036M\021\300\237\210\bH\265\375D\235 6\303\261\356\330\344\302\342\347\334\330/.\374\025%\265\220\277\263\016/\222e\2307\337!\020\333\016\325N>\325\350N+"
+	.ascii	"X_\261{\363\206\235\221=\326\214^:\267C\r\006\t\nO\025\245&\274"
+	.ascii	"\0220\272\035\024+x"
+	.string	"\t~6)\270w\234\273\374\213bPC\362\020\bL\366\215\362\203\234\370\236a,,\204\355D\034Q\002\\E\303PA\362\253@\374\312D \312&3\361\347\244w\230\340\370zmE\3465\r\2324\342^\013\347t\026\204\027\027\n\237\205\365Z\314o\234\350E3b\347\241\302s\033\001\300\304u\t\272\247\306\245\r\275\272z\305\254\350\316N_\030\037,\322T\2342\260\310\002\f\226\003E\223\300{\227\205\306\f5\335\212\306\235{\277_\300\343\2438Z\251\375}\327\352\004\261\030(\354\343\341\344ug\374\\\333q\214\367\244\365\365U\365\224\324\2513q\220\"\367\231}\317\207\002\330\2035G\275/\340_\36343\016\325\323\230\333\256\264\007\235\3459\024'}\312\003\253;:\260W%{9P\356\370S\323\223vT\243h\022\246\372\001\213Z\345\213\257^\252\372TL,\247\315\2403\302\337Wl_ \013\263\334\211\227"
+	.string	"8\202\342gc\321\224"
+	.ascii	"\240Z/\277v\t\240\2371\204r\232_;h&w=\230h>\270\326\f\350\272"
+	.ascii	"\310\371K\326\205\352IM\210\202\261\343\177\322X*\023D\237p]"
+	.ascii	"\206\365\356\301\262EF\t*\336\213\313\226|F\236(\006|\020`h\304"
+	.ascii	"\301\241\263\343r]\032\306I\326\004\307x\264\025b\246\266\250"
+	.ascii	"2VKIH\334b\276\372\337\247T'\213\023\267\362\032\225\251"
+	.string	"\001\370\177\377\211e\367\025\270!\357|a\004\b \361N<6\006\320~\025/H`\177\277\344\205\365r"
+	.ascii	"\021\034\243\216\353\241H\201]\321\217\263go\227\303\244\363"
+	.ascii	"\355%\032\035\254\361\327\342s\354U#E\326W\365&\244\201Yivu\310"
+	.ascii	"\230j\330\240\272LSf\021\306d\310\222\030\\\037cp\324\213+'\221"
+	.ascii	"\013\223\311a,h\3333wdc505\024FY\365\236C\316\374\363\016Sp\303"
+	.ascii	"\364&v8(\345h\032\233ueU\263\207eD\037C\234L\321\t\341?l\217"
+	.ascii	"\024G\341\367\332N \306\257i~]\365\224\354\026jz\331\215G\266"
+	.ascii	"ht\026Q*\260\207'Cl/\032Z\347\2469\237\260\334P\035\002K\013"
+	.ascii	"\025\225H\330$&NU\202\305\2706\345\022kA4&\340k\0270=y\037\303"
+	.ascii	"\356\340+k\2705\305:\021y\304'\"yQb;J\321P\374\200\033\217\237"
+	.ascii	" \307\253\306\304 \211\235\210\377\326s\311\177\027T \205"
+	.string	"\2172gq!\356\005E\345\037\002P\224\331E\326\002\004S\225o\252\025\020\037\270\361\0040\342\020c\300\n\222\002\246\276-%\005\277\305uy\260\376\215\250\202f\305\310\007\263\261\334\300\353\025R\266\305\315\237\253\351\233\337P\001\341\271T<\037\305w\236\276\224\326\364\355\377N`\347\332\346\273\201\033\350\266\317\277\021{\361C\020v\322,\2168\306\346\033\215\221lr}\221}k\272\344Y\034C\262TJ\n\323\314\373\337\322m\252\034\302\305E&qd.bve=\003\376\017\201\351c\260\016.\241\223X\022\317\024l\231\212\315w\326\226\344IQ\241\b]\033n\336\033C\365\261r\345\025\2369M&\324\257\255\ro\346\217\306\263jKX\315q\t.\260\n\024\240\023c\006\021\001\300\323%9]\336\236\373n\"0\357\210}\344\311\332\026\242\301\217\320Z\362\227\211\210Gg\350\r\234\215x*\314\336\\\027\302\b\240\365"
+	.string	"\225\037\361\377O\360_\301x\342\177se\276/\002\026\205\300(\317\352\377lf\351\007\001h\345\177\b\334\2652\251Gi\313z\006\322b\364y\246\370\365\250~\306\342M\246\262\3622 `i\220\245\321C\266\021P\217\300\237\347G\337D\244\263\226\3239\211\266\251UL)\220\336\2445\247\3779\023\004kG\233\325v\250\002\3220\353<u\273R\257\321\317\336\032\220\264\013\304\240\346*$)\374\231f\017\027\244M\263\235\261\216L\203L\235\006h\277\230O\036\215\367\216\026*\312\302\252\271h\2527\0222\352\224U\252%\271r\036\257\b@\337\203\333\\\347\244\374"
+	.ascii	"\233\205\256\304\2345\206\213\270\2348\203S\3352\332\343\020"
+	.ascii	"\315\2036\tE\346\306T\243;\377L3\247\240\017L%_|w\237\372\317"
+	.ascii	"6\254NwEd\212E\207\241\232\353\271\321\303i@\330\343E\302\261"
+	.ascii	"\337\2505%O\341"
+	.string	"\312\374f\027\374Y\231)\220\271U\277\330\335\210m\306.\267\314\260\206A\252\372\213\211\264\360=\t.8\270\322(\211Rx\274w\224x\200\240\374\346\003\006^\325NX\b\345\r\351\243h\214\360@\215\b]\232LG\267d8\277\nP\303P@\215\340\261\2553\265\213\201\3622\031A\023\357/\352\025\333|\260\035<\374nPbjSD\250\005\226\225\304\036\367E\302\257}b\350\344N\315\035h\020\264\3440R$\222\247g\272\020\343\230\207\231\337\364\374\252\025;\366\216\217|S\361\254\2354\351\214\365\037\323\363,\314\307\365+\253f\317w8\362zi\322\234\313\330c\234\001\200'\301v^vj\314\244\245\201\207\330J\262\211%\266\252D\226\244~u\002\255H\270M\220\327\332\251\321|MT\233\246\334\372JY\f{\263\224\202@\331\336\002A\3071\214\245\3657\305\206u_\224\355\247w\266\273\265\213\254L\354\345n"
+	.string	"#\344\351\266\031\213%\t\316{\376L \211mG\262\003\251o\334\312\222ao\327\315A\215\242\364\231-iTlp\205\343V\373\357vrR\006\033D\342\326\212\370^\373\314\027B\351\254\245\353\256\320\340\307d\233cN\316"
+	.string	"E\317Br\232\330\267\036T\200\222\021\2106c\235:S\207\203\244\252\202u\337\274+;2M\001\204bt\353\216B\032\331M\331\267"
+	.string	"\306\235\371^\364}\246P"
+	.string	"\331U\364yRID/\240\214\263\t\254\272\334\324\tm\353\256\357K\240N\222\341\2344H\304\246>{y\236\303\300\300\016J\240i\311*r\b9\215\206\362\310\270C#\260\240]\234\274(wd\320\376\270k\034\310\210\206\325K\314j\324q\034\242\276o%\037\350\211XU\335\360\r\333N\n\203\334n\314\362c\237\357\022\b/\261@\017B>WF\245)\300\202\n\251\247\023\325\036\223!25\300v\342\305d>\304\t\255\001?\241X\300\316\332c\376\027\2028\352B\3406\263\"\037\025?\350^\3070\\\237\210|\001\351!MK\315R^!\032\261\232=\243\326K\021\322\307F\202\255\321-\024\260\352\332\231j\001\273\005\026aO\3607\226Gq@\302y\330\2107"
+	.string	"\b#X\344\252\346H\b\327\230\277mK~t\270M+`\023T\355\021\347t\351\031%\353"
+	.string	"\350\022\306\216Us,\330\325\311\2718{\302\373H\033>"
+	.ascii	"\266_\243\267\022\366\346rL\307\334\264\271D\303IN;hs\177\345"
+	.ascii	"\273\314\335n\031\005\312\305]\333\232\361\377Y\231G=\230\367"
+	.ascii	"\374\020\360\177\363l0\366\253\212\\\245\321\006\362\177\270"
+	.ascii	"w\326\231E\347\253\330\013\207\206\224\274^0ou\037E\260\376;"
+	.ascii	"i\357\310\031\374<\242\034\025\374\271y)\316\210\222\326.\372"
+	.ascii	"<uB\375\024,#\312r4\340J\237iS\276\263e\315\321\225\311&\314"
+	.ascii	" \322\322\304\320t\004\273t\t\2751\372!JG\231\037<\334%\247G"
+	.ascii	"\200?\032\261Um9\223\226]\263\177\300\326\026\237\233\277R|f"
+	.ascii	"XnR\337G\346\277\275\256E\3407\312\227\034\375V\241\177\247\315"
+	.ascii	"Vc\005\362\321\270g\330\373\r\202\211\256\235\265~\263\360\221"
+	.ascii	"\352\375\351\3573\367;\004\336\260\323\361\365vk\275ce\275?6"
+	.ascii	"\367\372\201\027 G0?/_9(j\335\351\266\354<k|\031\036\025\277"
+	.ascii	"+<#\357<\r0\267\336s\036w_\356\261w\016K}\345\370\337@\373\327"
+	.ascii	"\276\033M\037\026\031\326;\017\314\267\363\322\300\243N\254\200"
+	.ascii	"d\202\361\241\203A\231\255Z\243\202\177c\346\005\30075\247\305"
+	.ascii	",a\376x\337U\237\0041\016\351\201t\217\244\036\\\206$\225\023"
+	.ascii	"\325\017S\013\212\017\356\\\301f\242\375\004\336\024\013\"\234"
+	.ascii	"\317; \305\273\322\027\027\210_\350\320ID\234\246D+\273Eu\"u"
+	.ascii	"\263+"
+	.text
+	.section	.gnu.lto_.symtab.772c043448d8a3f7,"e",@progbits
+	.string	"rMat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"schedulerIgnoreTaskStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.772c043448d8a3f7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1770 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\252\002\345\013"
+	.ascii	"\262M37Po\322\030\240x\312\026/\277 \231\027R\236\335 \253\364"
+	.ascii	"0\200\220(?\210\006%\370\252\252\252\03133\323\016j\250\327\217"
+	.ascii	"\244o\326\022-\356\266\204lB$!;\355\035\260a*\3528\311`\200T"
+	.ascii	"\34542-\314\220Z<\005\250\215PR\036\022^\230/\202\005\341\240"
+	.ascii	"^=o\347\347\314\341\336\267\345\366o\336\354PcBD$@\365\005\b"
+	.ascii	"U\223K\205\207\301\316U\034%\220T\001A\374\017-\221t&\003\223"
+	.ascii	"b\344\002\365\021\230O\212\202x\221\t\360t\276R:\234\376\241"
+	.ascii	"\330}l`p[\245\032-\233X6a\361y\027V\222\3228U\232\265\230\235"
+	.ascii	"}\275\327;\237cc{|\277\336-\353\227\313\253\345qx\364\346\267"
+	.ascii	"\"\"A\020\224]Y\250\021\256\240&\230Z\232\266\032\220\202\242"
+	.ascii	")\242\007\022@$Z\212\263\346L01\023f\371]c\372,W\036yk;\342*"
+	.ascii	"\204`\022\346d\372\252\224\227)\267Ju\035\320*>D\017\022\266"
+	.ascii	"i&S\034Q_\261\202\001\231G\260v\315d\377py\260(\332\253\360R"
+	.ascii	"\214J\223\256\227\253e\314\313f\n\030a\343\320\213\354)\331\352"
+	.ascii	"^\3126)^v\0334\027\242=\273\240\\i\032\207%\005\202\3102@\215"
+	.ascii	"\320c\336\306\240K\273'g\276OL\337\007\303\005\021\343\245\377"
+	.ascii	"\262i\312\353\327\t\037\223\366\356l\350\356\237\003\205\\'\245"
+	.ascii	" @\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375 \342\355\003"
+	.string	"t\003\326"
+	.string	"\r"
+	.string	"\001\001"
+	.string	"\022\026\002"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\001\001\001\031\033\004\001"
+	.string	""
+	.string	"\034\001\002\200\035\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	"\001&"
+	.string	"\003'("
+	.string	"\001)*"
+	.string	"\001+"
+	.string	"\003"
+	.string	"\037"
+	.string	")!I\005\274\004\310\004|\370"
+	.string	"\316\036\224\275\25758,"
+	.string	"w\367\360\350f\\\233<`a\346\202U\013\232ZZj\001\252\005\260"
+	.string	"\2008\025\016\234t\251\n\017\002\202\035X\b\246d"
+	.string	"\273/vl"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\002\003\005\020"
+	.string	"\306\325QB"
+	.string	"Q&\035\250<\204\177A\236p\257\t?L0}\366o/\026\037[\216=\017\354\311\261Ss\357\376&\300\204~\247!\314ai\007T\025\252\345\275\215&Q\3414\335\245OK\240\030\2511\022Bd\222);"
+	.string	"@"
+	.string	"C"
+	.string	"\373\371\254\005\r\035\306\030\253z$gh\213\376\"\261r\251\350:v\254\024Z\362\305V\333\225\365\320\217\337\357|\316Y\nm\320\332r5z?q{C\037\221:e\320\227m\361\226\001;\2415\333\021Z\364\347\022r\264V|\026\326\245\342\246\341\300g;sU[a\2329\004U\020fN\322\365\216\376\302f\203a\300\"\036\311\317\f\226\327\241G\013\035\274\347A\305\273\254m\314U\325\001\0250\240X\360\340 P\345\r\201I\374q\336\272\260!\306\235@c\316a6j\3459\273\322\305h\237ESBk\232!\023Q`\022r\375.iAoho\234B\340\330xd$=\222\240\255\342\204b\212'^\002:\300\024\332\235\203\376a\245\223U,@\347\016U+qq1\313\311\020\275\2615\202z\226\303\234\023t\200\006\177g?\003"
+	.string	"\001o[\276S0\201+S'o\\\314\304BY\232\022\255\354\350\252P\250a5D\"\"4\245\244$-\034P\002Q\246\312\354\021@%4NM@\025\264I\273\001\350G\267\264\311:>\203v\241\205]\327&%\323;c_\225a\357\246\f\341L"
+	.string	"\fu4\003\225\273s\356\315\366f\303\333\204\376\350\353\220Z\276\221@K\365\275\207i\341baL\312:\233*d\222\246\275\321\235\3354\330M\377\344\007\237\200\307\261~\317P\221\006#h\013joX\242&\031T\331KjBR\306r\307\370\344\264\333;\312\375X\212\3159\310\224(3G\322\323\352\306\340\312G\300\211zhkN\331\373\343\024\212\253C\201z\216-\037h%\331s\262r"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\300\001\315\b"
+	.string	"\302L',pK\222\016\374\377\377\360r\216\206\306\252\252\212\377\217\234\376\257*}F\001\310\241\372\\\005\360hV$Z\214\256I\265\0269\273\311$\003$\233\003\206\252\266\277`\261\354@\005\t\2032%\023H\004r\025\002\371\001\265\016\376\031\217\361q}A\177A\235\023\245\2249\246\326Z\343\272\273_@:\232{\372\234D@N\006n\377Gyf\355SyL\272\220\"9\2375\030\031P\301\030E\005\342$]\252+}%_\334\300\346\266\235\033\250-)@~N\344sf\344\b\324Ru1O"
+	.string	"\326\"7 \200\202\tJ\213\033\253\"H>\r\024\374\330]C\271\273a\311\"\n{\242P/\r\266\342R\267Xm\b\002\b\016"
+	.ascii	"\026rT\021.\330\027\254\253|\225t\0234\365M]Zp&\263$\2730k\274"
+	.ascii	"\247\216\023Y\027A\035\030\355Lc1B4'\226X;\217\314{w\315\226"
+	.ascii	"\256h\326]\350\271\343\220\354m\f/\0161b^1]\371\350v\305b\306"
+	.ascii	"\365>\246=\205\033\002"
+	.text
+	.section	.gnu.lto_.pureconst.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\022\230\004\026\230\004\031\232\004\033\232\004\034"
+	.ascii	"\231\004\035\231\004&\204\004'\230\004(\230\004)\230\004*\230"
+	.ascii	"\004+\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"5\004"
+	.string	"2E\020\032\220E\351\377\377\377\377\377\377\377k\370oV\373"
+	.string	"\375\236\235\026t\323\326\244L\001\003~\234\305f\206\313HJ=\372H0\336\224\316\244\326\340\037\002\250\367}\252r\325y\345\327Z\371*\237\177AL\013\035"
+	.string	"QL\334\232\217\242\026\300\272\2414\003\"c\310[\261\fP\343\202\355$\006AJ\246\300U\013jZ\274x\244;\004@\312"
+	.string	"\250\313\364\254\013\006`W\212V"
+	.ascii	"\001? a\013\005\020B\317\253\n0\004"
+	.text
+	.section	.gnu.lto_.lto.13bea5dee519acec,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.85.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375 \367\315\006"
+	.string	"\022\315/5Pm\222\016$\223\203\210\204\252\244\035\225!\273(\360fh\204{\301]/\226\255\275\251\300*\270\303\242\031v\334\314L\021+\270\205\333K\003\225\321Gk\215l\231\002g0\230&\302\332<\016\303\202\325\240\360\034\254\204\315\313`\020\017S\360\365\240\301\036\347\272\260g\331\262\016\204\356\342q\023_\221n\223nh\211GX\255\324}T\225B\027p\341\301\322o\035t\033\337)\035\350\213\243\253D&\004(\231\025\245\225,\241H<\376\354-\027\244\242\354I\323\326\021\352I\006\305\210Jf\276K\007\252RS\005\252R\216\243Y1\273\r\351\364\201\221\242}:E"
+	.string	"\204\314\034\265\217Ew\375\r\376\203_#\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_writeMotors.86.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\022\r05@o\222\016\230N\\\177\013\247\375\327\n\024e\343\006?\231\037\277S\271a\206m\243\210\250\260[jtW}\2173\f\017\3025\246:\"\340\f\361\035\353f\t\221)s6V'\202\362\300\217B\002\265\200"
+	.string	"\031\250\003\017\344X\016p\243\271j\350X\360SU\026\314h\331'2H\331@\217\342\311\365\243\332%\260\222\tj\274 \ry\270\034\225\206\270\\c\245{M\225^b\3025\356HN\266\212\227\275\226\271\247\361\305df\376D\377&\024\025MI\346\305\213Kn\222I\307\337\314\330\263T\033eEF\026#-\231\t\337F\261:\354\326\243\0011\224\325\001\024d\346.\2060\372\353?\360\023\374\031\001\007"
+	.ascii	"3\001K8\023\350\370\032\272\f\3622\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_stopMotors.88.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\023\002\375\021"
+	.string	"\306\"xG\340\322&\035\222c\335p[\260h#\224CG\253\365\351\221\3334\246"
+	.string	"\324r*\207\241\320\377\254\313$\277\252Y\343\260p\320\224\036K\376"
+	.string	"3\274\207\021\243Q\bJ\343\211w-\262\031\r\264a\212i#\226l\"eJ\001a"
+	.string	"_"
+	.string	"e"
+	.string	"\376\215\0321Oa\bH?\273{z\264e\354\323c\236\254\262{\034\346\263\217\275l\204~\354\256\247\"\334}\203\335[\252\0367M\225\017\364\003 \214@\327\352q+\321\340\220"
+	.string	"\340\242\331P\222hC\017\2377\256Vn&t\256\017_\262\023\202.\235g\311\301\356:AW\207\233\273m\027\333%v\242\002\206\265R{\354\243\370$\321\254<6\2276\305tW\272\354\3464\035\267tj\372\"%\235\034\006j\27385 {\024\207J\\\366\333\367e\241OB*\223\314\300\326\225\263\273&_\341\013\235\305c1oa\242n\225\323\205\261\037\332\356\232<:A\367H\362\021\356q\373"
+	.string	".\306\276\212\007\311\374\0256A\376r\312\207Tft\212`\307k\333\335\335\024\234\323\222\276h'\254\t\321\312\232\243\376e\247>\363,\200\317\356\242\3701.c\205\345\373@\037\254\25495\352\303o4vf54\r\215h\\\252=\232\272\240\006\2071\034\206g\335\3566\360]\374E\213?\342\321\250\227<\370\302=^M+\244\023/V\326\034\337\255r\222Z\341\360\265x0\027X\276\f\026<\227/\245\305SIm\360N\n\030\245a%\345\301\240P)\357\004c]y\374\340\303\021K[&\220\f\036\201\263%L"
+	.ascii	"zH\350A@\036\366\242oD\307.\353 Q\020\205\ny\320\017z\210\214"
+	.ascii	"\350hFWQ{,\202BK\252<\322\344\234\336\330\266I9\375+fc&\223\334"
+	.ascii	"\251I\037( \220\002!\272\353\"\201\363:\262\326\326\233\206\027"
+	.ascii	"Mp\333\032-(T\245\260)\230)\371|\360\244\202<\332R\324\266\241"
+	.ascii	"\t\212\027\0022\3532#\315\356[\020]\r\263\216\265\344r\323\341"
+	.ascii	"wC\311#\230\315\275w\033\271\021\227\326\be\377v+\307\240\273"
+	.ascii	"\241X\2505\336\213H\347ZO"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.96.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\026\0325o"
+	.ascii	"*\265\030(K RR\352)\327\221\332L\370\245 \232\261\343#~\260,"
+	.ascii	"\250\311\221S\343\2473\236\245M\032\251t[6v\243\325\260}\347"
+	.ascii	"\236\b\3214lj\210;\242#,\332#:ZSS\265;\234\367,\n`\376\356\224"
+	.ascii	"!\357\223t-I)\245^\002/\002\212\002\316H\327\371\350:\243\270"
+	.ascii	"\316F\327\271\210u&\272\316CFg\241\353|\342:\007]g\240\242\363"
+	.ascii	"\317u\366\271\316=8\316<8\316;8\316:8\3169\254\263\221u\276\254"
+	.ascii	"3\016\353\314\3428\337\3408\027Yg\342\215\363\260\350\274\262"
+	.ascii	"\316\302\033g/:w\227-!A\206\204\311\227\337ck\303\252l\3320\302"
+	.ascii	":\264\266\353\336\322M\327=\327\335\326\355\326\375C7\\7[\023"
+	.ascii	"}\350\253\34307s\013\301}\327\\\230\335\302\025\006\326\347\207"
+	.ascii	"\206\330B;\346\036uL\035\263t<E\372bk\317\022\220\206\261\262"
+	.ascii	"\346M\216{\312\354\034\tD/'\021NL\265\243\304\0262\267\017\334"
+	.ascii	"X:K\003\321q\314\302\231\200\224\324i\277\224f\322\226\020\265"
+	.ascii	"\364\033\262\1770\201\330\006Ad\266\361\371\265-[3\211-\324\361"
+	.ascii	"\356Y\335N@\372\322i\233D\302\322\262\210-l;\241\t}R\021[\350"
+	.ascii	"}\205Yff\343)\321\313\t\264\024S\306\257m\333\025-d\002\210\355"
+	.ascii	"\314m\245\327\220-M!\250\323~1Q!\210\266e\213\342'b\013\221\372"
+	.ascii	"gma\260{\326\0262\222\371L\263\225\265C&^\300\334\326\264m+\365"
+	.ascii	"84\262\241\236\234\232T0-)\245HB:BaTD4$t\"\b\350\307\247\207"
+	.ascii	"gG'\307xq\330\233\"q\270\n\203\357H\356\341\f#r\312= \304\274"
+	.ascii	"\032\252K?9\021\321MC\004\221\352\246\256\"\256\231\346z)\216"
+	.ascii	"\213\234+\301u\212<'\\\024'\020\236\024d\212\006ni.\235\224\347"
+	.ascii	"\234\013\016e!\322\244\353~p\244.}\324C\243\310s\366 u#_\353"
+	.ascii	"\"\"\036z\210\207*.\324\344\002\224\023j\035\244\206\346@\321"
+	.ascii	"\037'O\334\307\311\231\367tr\255y\222\226\2145\351\035\263\326"
+	.ascii	"1+\363\234\034\224\270q8C\207\336\233\022K\306\254\364M\3228"
+	.ascii	"\301\037#\230\230\351<g\222 \024\231\027#\035\305\211\304Y\262"
+	.ascii	"\233\340O\330\023f\3479e\bB\371\321\245\351\270N\212\342\234"
+	.ascii	"\301\213I\304UM\311\020V\250K\306\216\364\360\311\212\201\371"
+	.ascii	"\272\214\003s\341\013\0354\212\021\211\373\362\317s\276\005\221"
+	.ascii	"\332\266\355+\355M1\245\373pF\333\266\354L\261\261\346\025\315"
+	.ascii	"\354z\314\2752\007\035\005=/\314\223\213\326\361|\177\355|N\020"
+	.ascii	"<\337\313\264\f~\347\373\317L\213\316\267\362\235o\351\227\\"
+	.ascii	"\242s^\347\233\307\347\374*\245\254ZD\356\031\377~\027\224n\303"
+	.ascii	"\305\306\370-g&\r\244\336\357\270\216J\27211\371-C\331tI\206"
+	.ascii	"\363\354\267\327\007\365\226i\335>\316\017\335\300\232P\223\206"
+	.ascii	"\375\233\304\022\225\372\315w\373\336fY\245\204g\363\335Z\374"
+	.ascii	"\233\037\002.\311\224^e\342\027\277\301\232HzU\207\376S\202\370"
+	.ascii	"=\355((U\252\224\255m\333a#wX\207\357U\220S\372\fr\0073\315\207"
+	.ascii	"\214\"y@\256!\327\326\026\016_\006\231\365\241^z}\255\2662H\376"
+	.ascii	"\3234V\346\251\006\274\231\353\033\265\250\t\363\365^B\341s\357"
+	.ascii	"5\022&\f\251Q\303\215\371\227d\033\255\307El\333/\030\334bzL"
+	.ascii	"\004\022\340\300"
+	.string	"\261\266P\370\354\0256Qi\333\266m\320h\025\341;\256\211\177md\272\215V\177\021\236\035\354\251l\274\006C\305}\306:v\354x(j\250\317~\306Z\373=h+\363\345\201\314|A\027\201El\333\026\0067\021\335\205\007\367Y\013\271\307\006\336\314\r\326\026\366G\205\235\221\255I\223^efS\372C\231\373\253\325j\225\337\006\346\226vw\263\333\232\373\253\335\232[\331\311\206kn\257\236k\356\026\331p\315]\327y\204\353\314\325t\315B\332\2569Hoi>\3368\213p\235\255\256s\007\327\231\203\353\254A\3235\367\350\037\2323h\270f\036\315\326\214A\2635_p\235-\270\316;\256s\005\327Y\307u\316q\235\251\2563\005\327\031\307u\236\340:Kp\235o\\\347\b\2563\004Eg\033:\316\017\\\347\032\327\331\001\035\347\006\2563\0037\316S\327y\201\353L\343:\317\270\316\b\\g\031\327\371\200\353l"
+	.string	"\216s\001\3279\306u&\340:\303\270\316\003\\g\001p\234_\\\347"
+	.string	"r\234]\3448\003`t\226\272\316-\256s\324ufat^q\235\241\256\363\323uv*:7\3358\253`\235\231\256\363\022\353\254dtNq\235\223n\037\300\017\360\342\005\370^\372%\331x\033\276\363b;\273\265\205/^\212\3143\220\032\300w]7\t\341\205Z\207\364\320\243\004\234\031I\004\t\346\315d\343\334\027F\361P\356\261\205\247\277\336\255\020\341BQ+\377\202o\346\324\020\326)\254."
+	.string	"\370n\276\213o@"
+	.string	"~\250\303\226\350\323\333\266\3652j1|yi\212\376\354\250\370\331=\321\020\235\231F\203t4\3340\364P)3R_l\233kQ&\352[|\007F\367X \021\005\023u\304\0301Q\317\026\221ca\004\030<\026\317\026\211\243J\207\311\276Vh\252T\204PL\2265k\222^%\342\335\206@s\202\213\022\013\025I\361\006&\262\004=t\305\335\212/\266a\211B\t\341\364P\277:\321\372\236\350\320\366\236\246rqOT' \336\2648=;\006\030e\241\007&P\323\243"
+	.ascii	"Cu\205\246\367\201\2433\022\301k\177\036\312M\265\252\370g\302"
+	.ascii	"\300D\033\031o\243r\037T<;\326g,B\203\021\037\036\317\364\205"
+	.ascii	"\215\351\331d_\364\331\363\320\242\261$L\236%\351\322\267\232"
+	.ascii	"\223=%+F\257\364QE,\361\250T\341{\242\331Q3\023Er\327\314\300"
+	.ascii	"\247\323)\246\244\370\242\017{I:< \363/\211\364I\337\201gGPJ"
+	.ascii	"8CBk\272\2233\244g\307\216\210\0365i\301\313x\3528\034=;\246"
+	.ascii	"G\225\376\204=a\346<\224Q\274\321\367\22360;\217\342\205nK?\250"
+	.ascii	"\rF?\254\033C\2553\026"
+	.string	"-\341i\030\317\001\372|\321\2674\207\3522\215\310ih\346\337\320\023}\320m\211G\226d\350\331(`\242u0\364\f\216\367Dc\346>\264\371\354O?\222\202\020\244\230\330\332\302b\362K\024I\013L\26548\310F\026Y\205\276\227\270\021\177\001Y\344\005d\f1\254-\024\372\242\017^\250\317\023cG\202w\314\277$\320\237\370\325\331D\3152M\351\234\241\235M\372\230\177A.$\3419o\246\022g\241\031D\225\002=\273\n\276\002O\2215\360\034\317\255-\374/H&\276\344\251\023\001zvl.zg\004\223$\330\237\3773me\242\234\031\211\003\322\314\233\371\363\n0\247\204Q\276W\333\255\251\225\335<\224\263\020\221R\350\310\206\235\374\f\276\331q\035\244\243B\354\272I\243sa\330^\317\343\233>\337\363Zm_r\336\347\203r-<\311\323\030\354\255{!sp\202DC[[\030W Tm\0019Z"
+	.ascii	"\004\310\325\024\317\220!WY>\216\307\032&h]mmUy\220\243u\334"
+	.ascii	"\262\252r \353\370c\253\212+\353jk\213\206\326q\353\210E\264"
+	.ascii	"u5\344\203\017p\210`u\025\202U\326\017,#\t\307\033@YU\013\370"
+	.ascii	"\250\272b\300\307\213 \022\2167\210B"
+	.string	""
+	.ascii	"\341\307\003>^\370\310\252\302\302:NYi\025]\201\220U\225c\213"
+	.ascii	"+H\226\215+ [[G\255\020\204\206\354\270\302\372Q\301V\326\225"
+	.ascii	"\226\026\227\325e\253\026ZW%\374\300\222\332\n\001\204\037@>"
+	.ascii	"\220\312\372Q\205%e\2455D\252\305\020\037\203\\iIm\035\217ZR"
+	.ascii	",[\262\203\355\333\300]\3279\366\252\200M\2378xt\301c\360\315"
+	.ascii	"\034S\302$_\311\034<[\330\225"
+	.string	"\336\351\3409\260\340;\300\340w\274\005\337\313.Vv|_i\246\2578\3523\b\365Pv'\256\277R\252g\232Fx\r\276\311_e\210E\213\032\232\n\324\216\274\006_\301\267\224\267>\035O%\310\333\036\363O\207\224\032\3320\377r\374\004\257\343W\276%\031\325S\3609\276\227Q\242\360\364\310sT\337sd\236\023<\216\247\340\215\370\226i\31244\034\337xf\322\244\223\263\t\276h\347F\225j\360M\202\310\004\237$x\b\236\353\207\370\226d=\376\306K\360Pw\020|\004\177\343[\334-\323\224L\276\f\207\b\376\261\230I\037\312S\242\r\020|\353\221q\247\346/\341ig)\253a\204\340\024!\252\321nz(7\227\276\031S}\262$\344Qh3\207\324\343\2336\376R\261\361]\327\215d\332F\305\003\377I\220\324\370\007\002}\204|\215/rcz\350\322\033\351\251\217R\262\204R\003\017\370G\272\222@"
+	.string	"\211\266mc\360\307\360\317.\276\256\276.%\272\224X\031\370\006\376\204\334\022\357\315\310\300\017\351\365R\0139\260\220\242\251\326\251o*_\204\252k\211\035S_T\266\241>\027x\032/\344\205rb\316\005\336\343\202\374\214\247\361Fn\313(1^\306\317\370U\332\003\227e\027\007>\b\317\027\253w\340\3274\312\326\021x\253g_\242\221\361\007<\002/\324[vQ\002~\223)\343\033\320Lj\300\307\370\003\nx\003\216_\300\013\001\252y\025\300b\274\21366\324)g\356b\242\253\2157\363\370\315\245[\312\024\f\227y\276P\226D\300k\265\341uU_\371I\002\276"
+	.ascii	"%jdkR\030\337\3361\377\246\035\310>_m\233T\032\340a\b\020\202"
+	.ascii	"\017\250\322(\035\221\241\034\203\n\221\210\210\214$I\032\003"
+	.ascii	"R\013\020\004Da\036\325\324\003\022`T1\t\204\214\2411\322\202"
+	.ascii	"\024"
+	.string	"\024\n\035\002\2460\256\346-\320\031\\\316\362\201\220`\030E\230~\347\316\202:\376\006\357\272\376\200\206s&j.\275\213\031:\317;\313X\322j\t\305\326Y\007\342\365\320\213\322\025\336\210Z\322\252\346:\360\265\027mf\332\233?\206b\335y\004\257\f\2277\343!\241\327)L\343\306\357m>;\313\330<\020\330\366\376\227G\310:\256-\234\361]\202\261\373\361zT\315@J\033\377\267\3458?%\306\3715o\210\217\243\263y\270\023\342\364\004IxNww\323\n#\361\250\t\360\3279\340\216\305\r\2407\030w\361,$B6\\\217\023\272\352B\005H\"\006f\305\217#u\220\217\351\272\3443\305\204\374\265\t\215\260d\223d\356\322hy\365@\237\027\351\333\006A5\367\"\266?\300\270\303\357[\255\303;>4i]e\235z\344\256R\226Cs\346\362\200\026\333h\021\020I\337\352\301K\356i\375\205\020[\316W"
+	.string	"\332>\244\034\265\331sh\177\312k\273g\365\231"
+	.string	".9o\274tT\333\272n\373p\217qQ\307\227;\235\210\333\361\026}\222\321`\227\370\256uW\251\016\345\271\331\001\0264F\267\305\320u\325\323\336\b\313\237\006\253Fa\017\007\262\362\373\212p\334\233\3277MX\351zT\360`SRao\236\374\342\354\272W7OS\230\300\004\r\357\346\322\232\370=T\240\005\222!\325\227\007X\367b/\331\003\217\027d\322(\361K\243\365\026Rk}\224\t\274\203\274]RC1+\\\335\345X9\246 \301\026},\341\321Lb0X\375\342%\337C\n\344H\371\310\370"
+	.string	"\263\370\234|\216\365\036\201\201t;~\257K~H\366\230\245\2272\247\b6\356\342\363$\3722$\203\276D\365X\362\261\031\205R\037\341>\216;\312\t2Y*\242\024\371,.\005\321\206Oh\311\b\252^\336\210c\030g\314?_ka\372_\257~\024\036\343IH\f\bL\023m\315F\272\f\273\254!\3325\006\bJ\233\b\310\034\f{\367\223Q\325\272\215\f\013\253A\270\311\211\2061s\254\3747\307\326\201\031~\200G\002\316,l\252`2p\315\262]\3109\004\246$&\211\361\314{"
+	.string	"\2251\334\201c\214\\:\221F\256\234i6\372\220c`\352\n\337\353T\006\367\225\240P\231\255\033>\271\204\f\360\307\223\367\225\377(\022\013\255\337"
+	.ascii	"\264|\341-\325t<Q\032\273\022^$\226;X=\337\273\275\336Q\231\340"
+	.ascii	"Jf'N\367\002\202\340x94(\242h\202\355&\216Qx\341\035\340\215"
+	.ascii	"\364<\254}LSS\210\210. \027\b\325\027y?\306\0054\327\227\314"
+	.ascii	"\261\250L\271\206\2024\336\274\322\002\020~\340}\264\202\371"
+	.ascii	"\342\245j\245\305\262\\s\361z\233\013Zr\342\034\204x\206\001"
+	.ascii	"\304\261\310\024\237\022\3545[(\325\250\312\272\207-\335TX\033"
+	.ascii	"<\262\344\232\211P\374}\217\360\021\234\337\362\023.\337n\335"
+	.ascii	"\333&x4X\260#\240MH\205\346\212T\241\270\231\232\312\035\022"
+	.ascii	"\243J\365\007\221\021\373\340\374\230=\306D#\0133\305\315\246"
+	.ascii	"\356\006u1\217\n\034\2204\003v\335i\tM\203w\207\177/c;\013\006"
+	.ascii	"~\270\370s\264\313\332\243\221I!`\3500\f\241\b\313\366\360N~"
+	.ascii	"\3628\026\370\214\262x\022\312\226\020:\332J\314]5o\355\327\262"
+	.ascii	"+\020\340\317\3751>\365\327*\261\\X\220.\232y\026\020M\264\214"
+	.ascii	"\342:=\n\224\004\"\202\266\016$\032}\327\212\235\016\243o\227"
+	.ascii	"\305\032\r?2\313l\352~'#\352E\013"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.97.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\205\023UZ"
+	.string	"\032\232\260!L \320RI\007\345\375\"f\301Z\366wp\3409\206\226\\\272|\324#\316\223o\2505\341\t\316D\007\341CM\006\252\005"
+	.ascii	"\nP^\364\016bF\272!\276\002\252\026\001e\002\3431l\301\220\206"
+	.ascii	"\337\374\256\331\212\210XU\032kdK\231d\002\002\303\001\"\002"
+	.ascii	"\013Ty\177*\357\261\362\372T^c\345E+om\336f^f\336S\240T\347\205"
+	.ascii	"-\2774-\262\250']\203\006V9\234\337\315\177\370\267\371\r\177"
+	.ascii	"5?\227\277\313\317\367\367\375~\377\227\377\357\027\363?\377"
+	.ascii	"1\177\013\277\340?\370\233\371\321<\271\3738\213\374\233\342"
+	.ascii	"f\377\206\211\333\021\030\3661\034q\221m\366\271he\314\361p\237"
+	.ascii	"mp\220\364\261Y\344Q\303\025<\016y;\202\371\242\310\3675\213"
+	.ascii	"T\263\317\247p)\277`\267\201\236\304\275\027~\313~\357)\334\313"
+	.ascii	"U\370\n\007\3630\007<\013\017<\231\227\271\013?s\302E\242\261"
+	.ascii	"\263b&\212\334\240\024\036\"8\005N\013B\252\004\216\021\202%"
+	.ascii	"\313\023/\221\211\030-s\177[\336\276\3543\357\032\370\355\223"
+	.ascii	"KY\337>\331\334\254\220x\203/\317\213.B\246\326\212R\267\rn\260"
+	.ascii	"b\342x\364y\327C;\027!\307!oJnP\364$\246iZut\251\216G\247\236"
+	.ascii	"<\222\361hE\242\355\316\371^]\352\003E\t[\237\ri\232*\373\211"
+	.ascii	"\323\036_\367\276P\215\366(\250'\247&\246%\245d\022\322\221Q"
+	.ascii	"\021\321\220P\020\022\350\347\350cDkK1\332^\313=\240y\266\031"
+	.ascii	"\031\362\2508Z\030\312\t\334\226?U\037\"E\250\334\360-\257f\345"
+	.ascii	"I\f<\233(\354\344\004.\313\233\230\360\276\204\245\n+Qy\222\312"
+	.ascii	"\024N\242\202(\205\221|\\\260\271\002P\024eX\002\227\345Gv7\202"
+	.ascii	"b\307Evu\352\356\255\216\211|\\,\201S\362!\3037%t,\224\344AH"
+	.ascii	"\2220\362\310\201\f\337B\250Si\232\036\341\237\016K\340\346~"
+	.ascii	"\274\341\233\\\207\273\2679\366\211\273\261\311\306\350\007\257"
+	.ascii	"\025\304\013L\342\f\031Y\253Nt\204\036\234\220\b\367\323\266"
+	.ascii	"\\\252\222H\034S\303\r\337\364j\262\b\225\266k9\273\031Qc\366"
+	.ascii	"q\221\246\351r\233\021\270/\207\357r\002\273\027\333-\002\f\310"
+	.ascii	"\226*\344\352\255\006\352+\376\371\375\264\261g\320\035\033\355"
+	.ascii	"\237.qxl\022}2\332\247\245\354\310\350\2556\266\361\r\314b\021"
+	.ascii	"\363W\320\330\325W\201h\252\270Z\tg\246\210\255\276\273\004\343"
+	.ascii	"\267\311he\340\340\232\265\036\262h\357\363\274\325,\247iE\355"
+	.ascii	"y&pR\330K\323m"
+	.string	"\261\270H\303Z\232\246}\250\215\366\233wj\274\270\335\265\233\016\233\211\334\335gSL\333\260\333\031;\246\351\032\326~\206\323\300\334K9\272\025\370\360a<\312}\302+K\020\304\323{J3\270\244\333\271\177V]\236D\251n\262QF\030}-?\032\362\275Y\343<\373G\031\3370z\231MN\355sN\207l/e-0\343\267\231\031\217\276Q\030\310\340\221K\343\305\335=5n'\031\266@\270\355&\2737\3742+\357X\345\025\373\3417\254\362\356\270\233/\330\327\362\\\276\023T^\035W\363\225\340]\2769\316\367\215\240\362\342\250\274\020x\335\260\361\347\267\306\307|i\274\205\357\214\013~\273>\370\345\272\231\257\214\243\371n\035\3167\006\363\302\250\274/*\257V\363\272h\336\026\225\327\200\312[\300\341|Y\274\315\227\200\033~W\274\357\253\342~\337\254\177\371\246\370\337\027\353\177_\024\027\363=q1_\023\315;"
+	.string	"\363\nPy\003h^%\363^U\336\022\225\327\252\362VU^\022\225\227\252\362\216\250\274\"\2307D\345\005Qy\001\250\274\037*\257\207\312\333\241\362NU^\016\225W\252\362FU^\250\312\373Ty\235*oS\345e\252\274K\315\253\204\362&+oR\345E\252\274G\225\327\250\362\026U^\242\312;Ty\205*oP\345EV\016tX\335\241=t\013\036\300L\366\311\242n\t\f,\304\021\026\260\252\023\241C\023\021\361\202G\357Ds\350\251\356\302\346\235Z\002L\267O\026m\234\004F\212\2724M\263b0\222\005\254\020\3234\305\n\201\2170\320\300\214\031\306\243\034\372\210W~\340\345k\260(\361"
+	.ascii	"\251\235\353&I\032\243\"\024\275D(\032\253\335\266\032\231\370"
+	.ascii	"\221\223D\257h+\221\211>\221\243u\364\004Gr\232g\324xQ\202\326"
+	.ascii	"\321+\3664kP\321\022\364\327|\213\205g\233\b:G7\200\246iE\252"
+	.ascii	"\243:\202\3028\2774\021m\251\206\022\323\274\233\013\023\203"
+	.ascii	"\236\250~\236\347\340Q;\327xG\020\321\250\233\214x\022\205\217"
+	.ascii	"\260H(\231w$\315\020\216\326*4cG\253\241\2360\251D\233\325P\215"
+	.ascii	"\243I\354i\2361!m\313\232\232\246i\037\236\032\252\243\366<\265"
+	.ascii	"\361\214\030:\037j\347\262\234\271\016\202\274\372se\2205ZE\273"
+	.ascii	"q^\234b\320\215\346)s\200\310\256\316j\267\233p\204J\320\343"
+	.ascii	"\312 mt\n\300 \003\372xssP\264\233\2208\275\240\002\372ys\212"
+	.ascii	"H\023Y"
+	.string	"\215VqrG\250\235\033\004t\365!7qi~\254\356\002\202\356:\326\341K\303\3252\032\202~\341\271N\b3\330\254\301\311\253\247\232\232\251\235\032-\244\3214\272\251G\310\231\3213\232\251\215X\302\3705\357x\251w\035\260a|\333\215\236B\266O/\365\351\376\026\233tJm\243\277\307E\267h\245f:\"\333i\024\242\023e\f\320\361\352Dv>Vo\321n\027\030\223=\364\206\357\315\256\027k\200\203\331\222\215b-\r\036\2754^\3749\032\205\304\001\242\006\264[R\367\233\337\220\324Qp7\370\030\273\311rm\362\270\023\nh7\244*\244\216\202\303S\321vr\021\225\031\364\352sw\371\303Qg\300G\270\306yr\034uT\340\035\243\036\352\032E\215\266Q[\t\0265UW\023\265T_Wo\365P_\317\337S\250\201\232FP\243-\324V{\202\232\352\220\253\003;\302\314\230=\226>\312\310\270\222g\027"
+	.string	"9\273\240\2012\26232\037H\346\277tp\031\331\031\330R\001\"\263/-\263/-\263/\255 K\257$\323R\220\245\227\022\017\2603f\327O\217\036d4\216A\226^?\306\230f>I\036gc?\302d\2201\317\300\302z\210\205!`\326D\006\004\203\004~0\031P\200\207\331\262\f,\0316\366cI\243\0020\346Y\215\241\262\260 d]@\230=\304~\026\354\252,\f\003\246\017\345\031\2171f\0171\345\017\346\322\207\022\254\314Ly\345\264d@\302\312\224gddeJ\344^\332\273\211\226\037\313\314\260&\255\325\242\362<\305h\324N\252\352,X\364"
+	.string	"\002\364"
+	.string	"`\276\b\320Vn*T;\227E\307\350\2479C'\200\366S\201\355\264\325i\262\227}\036\371\252\240\241\020@?\316\251\016\007\361\002\323x\261\333o\220\210\221\247v\256\320\233&f\243vGU_\261\242\225\3759W\255D#\201\273\220\035\367\256\252<X\344\353\001\241\206\023\234\332\271\314$\366\016F\270\242\2704\326/\254\276\242\231}6G\t\237w^\264\336>\223\313[8\017\355\n\232\th(\240\241`<\212\036\222\301#\327\024\326b\r\325\307Lx\214\267\317\003b\031k\025D\236x\276\211H\212\200Y\272\322Lb9$\314I~\365\247(QDZ6\001\355\266]\242\207\226\210"
+	.ascii	"d\325%\372u\314,6\351\254\272\252\303"
+	.ascii	"\232\013\233t%h\261\352\023Pv4\211\256Z&\201\357\366\271\227"
+	.ascii	"\262hy\013\270\200\306\243$\352\025\"\200xr`\275\243\225\205"
+	.ascii	"M\032&h\002\032\254\377\346[rf\3244\357\324\224\250\372\253\321"
+	.ascii	"\302\021"
+	.string	"-\242\251\232\351\260y\027\242G4\223\235f\342\262E\364\263\270p\247Y\347j\210\223\203d;w\314\030\242\177\207\306\205\245\214E\t\321?N\025\360\350\021\246\201\t!\251\235\313\036!\345\312\202\350\017\275\354\007\236\213)\032\200\006\321-F\213\353\366\231\002\361\t\f\254:'\013\210@t\002\320Bv\372\360<\364T\177h\343\233\013~\315\201{\250q,\004\231b\210\204DD\222\024$i\ra\005\3040\007\241\263\r\021\020\241dR\215\210\220\244 i\f\274\346\n\\'\214\031\346Q\216Hh\222C\216|\004otG\343\326JK\324@\027\307\256\275\266&\224h\302xV'F\375\371{i\247\004\363\323#\036P]r\223\314\005\357a\356\354\202/\337=v\237\376Ng}J8i\243\352\325\317kN]\273;\353|O%\031\200J<qt\004\365s\177-\004z\210;\002\211\360\262>&q\200\250\201N\377\347"
+	.ascii	"\357m\274d\267\237>\346%$+c\214\373\242Q\373\257\373\242\rs\201"
+	.ascii	"\276\272\206\026j\352c\313u9\2252\034EmY\203\201\351\360\035"
+	.ascii	"&,\005\002\224\246\315\222ze!AE)B\305\024\343\004\304\212\356"
+	.ascii	"\303b\016\031\266\365)\234 \330\362o\207-\376\372\342DY\360."
+	.ascii	"7\312\355\374(\n=\274<\225y\016\323\004\030\021\270\f\266Mo\337"
+	.ascii	"\223D"
+	.string	"u\004\372\363\316 \t\035\230V\232l\017/\232h>\276\364\275\247\276\332\236F\005*\022\0226m#\017Y\331\323'\254\253$\232\n\001\355\304a\322\0203 \261A \031\266\272\367\254\347\216\321\274\265\314\241\206\305\020D\341\243i\264g\270\201q&q?y\364\301\351,+3\230\b\260\217\247\242\035\212h\231\355\360\245\240\311\030H\002OZ\362<\241\025\311\357u.\211\271\007\205D\024\205G\214\243!y\373\b\213\356\355\031\251\b\005CG\214'\336\022\025\315\317n\260\374\257\261`a\275\007\255\004\003\022\271O]`3\326u\tV\326Q\277G\005.\355\266\201\243\315c\335\304\371F\033\320\377\231\362\022k\033^&\246\307\357^\200\347\222w\f\001\213\300\260\205g\322dF\020\376\n,\260<4\255\030\350\203\310\343\251G\375\020A\032\031\350\203\310\343\224Cq6q\255\026\347\234s\341Pba\276x\322@O\035\372"
+	.string	"\237\371#w\002CQx\372\3222O\367=`a\246\274\224(B"
+	.string	"AH4\311r\320\200 -\242\200\"\251q\224*\214E\"\240\006\313(\3738\355'>\b\204\334\037\252\341\312\3520\254\202\037\277lMJ.\001d\300c\201\301,!\345Ew_o\241\007\024\334\365J<v\200L\242v]\341\0137\f`\215K\372_\376#\225\025\305\345\f\324&N\266E\311\2121r\305\362\311\236\\\215C\361\3322\222]\364\232\303wt\312\201&4\277y\306\220\271\"\243\275\227j%@\315\304\255\204\317"
+	.ascii	"\022\376\354t\301l\352 \f\003\313\226\2645_\265\341f\201\262"
+	.ascii	"\317e\250\271r\251\217f\273\230G\324\302\374\036k\032+o B\361"
+	.ascii	"\326G\013\202\210#\360\314V:E\r"
+	.text
+	.section	.gnu.lto_applyMixToMotors.98.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`0\b\375."
+	.string	"\332S\020\022Fp\234N\007_\345\004\265\205\177\341D\304\223\213G\210\221L[R\373\345\3621\270\235\004+07ACAE_xD\246:\321\334\005\221\331\307x\203_\374\342\334m\265\266\271\313z\304\270\250!$B\366\336r\247\224R\017\001\365"
+	.ascii	"\025\001kj\354\\\247\260x\254\352\320&\254J\270\323\270\231t"
+	.ascii	"\223c\243\261\224u\nkm\242ffw\357=j\313\022\326\266\004\320\024"
+	.ascii	"\314\277\266\377cfw\346$*\236\r\332\271\311\272\254\315\216\335"
+	.ascii	"d\266\306\271\267k\255\355\336&\022+5{'m\273\266N\332H\230{m"
+	.ascii	"\271hm\313G\3460\335\374\272j\2171\253%h\356\275\304\327\021"
+	.ascii	"\344\265\321f\363\357\217-\f\002\2077?_oUS\213\276\037\271\325"
+	.ascii	"\245\002V\316,\263\246ZX\303\215\206\007\325\245\034Z\314\006"
+	.ascii	"6\222\331C\267\036\232\303\252q\366\3457\250Z\305\002H\317a\315"
+	.ascii	"@\031\344\331\271uZ\322\177C9\264d\264\257\327sX1\330V\347j\025"
+	.ascii	"5b\306\265\bfY\241;Wp|\351\266\036\022\202\305\345\351\034\326"
+	.ascii	"\026J\340\336\253t\353\242Q\324\310\016\212\231`V\025\272\303"
+	.ascii	"\002\310\262\327\332\257\262\250\374;\255m\017\26317\264d\264"
+	.ascii	"\253K\367^\366e\226V3N3w\005f.2\253O\001o\364\275\341\372>x\351"
+	.ascii	"\373\253\237.Q\nIR1\262s\365\301\315li\333\364\373\212\013\371"
+	.string	"Eo\277\225D\320f\270\364\037\375V\nI\372\223\177\376_\225b\325\246\337\277\225v\035\245\245<q\373`(\020\336K\020i\333\376^k\244\252,b[H\177~\223\267\252\254\177/\346f\322\031|\345\331\361w1+P\262\316\t\222\220\216:I\267Q7\273\213\016\254\316D\326y\250\2414\013\005\265Z3P\2435\377\364\234\007Xg\037\353,`u\016\320s\356Y\235y\254\363\216u\006`\235u\254s\216\352\214\243:\017\255\263\320:\007\2553\320:\337X\347\237u\366\271s/u^\255\263j\235\323v\266\2513\232:\277uv\324\271\027\364\254\271\262\201\313\275,\236k\256\234u\003k(\335j\335h\375\314\355\306?'jym\366\216\312\222fK\321OX\r\303\3739\341\016\021\032\217\235B\006\334e\372\356X\344(v\034;\216\245my\200\021a\222\271\017\300\003\375Po\347\233m\314\221l\347{[b"
+	.string	"\374\030\230\017&\331\232\363@/\340\331\225wI\177\252\357\305@\257\363\335\326\276\365\202\bW\035\226*T\236g\326`\330\271\326\365\027\007\374"
+	.string	"\202\367\022B\332V\347{eH:\t9\257\206\335\245i,uI\320\322\367\342\3262\266\002U\372\016\023c\373\244\007\372+-\2153\001\347\203oEl\202Oz\245\377'>\376\363\314\024,x/\023|\020\214 \375\002\314L\013\364\275\230D:|\2513/T\236\307=\316|\001\203\367r\370\301\267\032r\311\237b\341\007?\351\035\214\222\211%\203\360\r\354@z\340\007\257h"
+	.ascii	"\276\320\305\026\261\034?zf\016\035\274\227H\337\363\346B\216"
+	.ascii	"\352\247\370\346\325?\372f\243d\376\336\3677\337]\205\235L\314"
+	.ascii	"\366\373^\243\333bn\3528vv\\\227{\357\002n\270\020N\375\366\245"
+	.ascii	"\"m\353\373\216\243+[\003\374!\251\304\007#S\024QD1*\252\330"
+	.ascii	"d41\302h\302\302\017\252)8\235\200261\375P@Q\220*\032\213Qk\223"
+	.ascii	"\323\210\022\004\236\244\230VnJ\222rB\001\025E4~x\202\n\341\201"
+	.ascii	"(\002\212)\212\330$U\202\230"
+	.string	"\344\303\305\021NRDc\261(E\3745\221\375]\374\306F\016\371Ia\036\360\300[\036\303\243\026\372+\241\037\360\035\346\254\375\336;\025|/\026\372\003\337U\254\274}\222\235;\216t\274%\031\244?\227\374\262s}\3768\216\371|\273u\221\0266i\334\220\376|`\377\264 32\374.\356\264\366\205\025i\363\353\371\001\177\005\224\022\255sgt\335@i\200'zv\253-\356\274Vs\f\003;\006\t\222\266\r\360}\326Dxk\322\334\274\027\003\217\370\024\374{\361\243\376\371\253\237\2623\236\357\371\036\322h\216agx\276\323\332\237\374X\303$k\364\336{\177m\235\223\352\274\206-kNo\250g\003\356\326\201\251\002>\350\257\230\021\364\317+\370)pO%3\350\2319\200\247\250Q4\304\230C\b\215\214\310\004I\232d8p\002\031\252:n\021\2209EU\n\nR\350\312M=9 \253\244a\367YZc"
+	.string	"N\343\340\375\335.\310\332\352\376<\272\211\224\364\250\023\221\361u\221\341@hT\237\353[\330\304\312\306\030l\361\016\244\364M\305\013e\224if\266V\n\302\357\214\034\317\217\331h\265\224\226\362\234\205\300a\315\036\3637OFAt\263\261\266\n6\r\271\347\235W6\300\223\024+\212}\266h\212\342\340\246:\3746x\313\366W\211y\274\204!\312\013\202\230\231\t\202F\364\310gi\230&\001\311\226\224\335\233\006\\/l\317n>\252\371\f\353~u\344\202\362<\300\222\332\036T\\\2774G\306\340h\003\353{\021\270\207J\302\013\315\213\220\263\217\270\205.6\336\002A\217\303\271\\(.&\250v\333\034\3141\3778c\244\374\243~B\267\25246\256bf"
+	.string	"c\222!\330\210\202\\\001\306S1"
+	.ascii	"\273^z\350/\353\270@\244\345\206\314#\375\250+s\260\270\212\344"
+	.ascii	"s\272\"\314\302\003\235\332\214\305N\336\364\260MPH\357U\250"
+	.ascii	"0\021%\346vQ)\267\253\322\201/\324G\231W8R\326\207\331\3434\306"
+	.ascii	".\004\305n\325!\230%\322\263\211\311\204\030*"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.101.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\327\002\235\026"
+	.string	"f*\225F\300\030Q:p\235\250m0\367/bNa?\007\260\234\252\020.\216J\203\334\252\005\312\244\351\363\016\242\321\377\226'\253\232Z\365\274\261'\304\327\345_LQ\210\025Q\0013\357\211\215@#U\031\005\277\221F6\221;\245z"
+	.string	"u"
+	.string	"\204"
+	.string	"\237R\264-u6\322\244wdw\037\030B\370\351K\373?\016\204\366 %|\332\245\341\344\310\256\356\201\033\204\237\253\023"
+	.string	"?\277\017"
+	.string	"?M\263\265\\wcM9\200x\206\200\331\335Qm\234\366\371\251\244\371\246\232\023.W\373l\361\357[%\361xR9\023\237\002\237\031a\304\234\216\324\335%\212\234\211o\265\273\027\272<\221\273Ii\252\331]K\\N\305\r\3366\006\333$l\311%0l\262g\353nR\177\354\177\273\273V\037\033%\255\372\321=\363\242[\274\356G\205\322\247\007\371C)=Q\322\337IZ\245\264\f\245/ \201\214(\036v\273)zc\2267\221"
+	.string	"\375\350/\272I\202\362\263o\337\310G\262x\204\023\326z\n\240\310a4!\374\220\277\263\213D\204\265\236\020)\013\220\245\335u\360\351\032\242\013\311\371\220\325\205\222\217\335\025?\355\034[\f\223\007\226\335\316\222\315dzzS>\375\261\250\237\312\210\254\370H\236\304KBX\211\225\200\246/P\202`\250\212*\237\004\220RmV\013<Nu\245\2435\333\310\215\234\322\331\265-@\251\324\357>e\\\331\262\263\343&w\267\246\372c\006<\357"
+	.ascii	"\252\364BW\021\001\325\270HQ\322\221b|R\225\032\360\302S\346"
+	.ascii	"\032\352I/\344_\017*KA/\212t\334N\344EJ\3708|\343\222\307\271"
+	.ascii	"\300\317\253\272P\n\n\266\241i\275\\\263\021\026{\275b\254\003"
+	.ascii	"\034@H\200\345lHQ\330\320\"\341\232\3014\340\204P\265>\314f1"
+	.ascii	"\231\315,\274\251\320z\271(\314`-\231\f\207\005\300,\032Yk\204"
+	.ascii	"\3535\316l:\270>p\030a.\r\257\221%\273\031i\0208\006\242%\033"
+	.ascii	"g\261\230l\024u\266\177\253>\027z\2304\203g\323\333\f\325\311"
+	.ascii	"i\247JP\f[\023\221\t\2250\026\022\260\340\t\2203j_\310 \217s"
+	.ascii	"*i\005\257\306\225!]\204^\257\313\324\031\325\"\242N=\322\003"
+	.ascii	"3 P\202A\310\2127\326\215\220\023K\252\323\214\261g2kClM)d\247"
+	.ascii	"H\363@\204\211km\203\353\265\264\320\222\030\330]K\006\325\303"
+	.ascii	":\023\213I&\266\002#V\007\363\0304\023\321LL;`6\207\200\230>"
+	.ascii	"l\301\3724\004\230\371e\254'\027\232\243aa\331\224'l8\215\021"
+	.ascii	"o\216\033a#J\343^K)$=7\314\204\305\366\202\352\n\220\355\300"
+	.ascii	"F\216\341\275r\375\001\353\001"
+	.text
+	.section	.gnu.lto_applyMixerAdjustmentLinear.102.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\302\005\335\""
+	.string	":@\304\rF\220\\Q:$\311\220=`\022\250b\206U\267[Po\t\025\221\025\241,\317n'\314Ap\321\2147\275\315\033\354\301|4V`o\t\3007Z\277W\"\210U\026\20438\342\004\306\256\323\234\3156B\310&r\247\024\311"
+	.string	"\261"
+	.string	"\313"
+	.ascii	"\275[\265(\227\240\0048\021\t\023\247\326\332\340\324\026\312"
+	.ascii	"S\232\270\323\216 \241w!\214"
+	.string	"\013\021Hyq\342\245V\253\007\216\360i\337\311\237\364N\345\254\013\325\312c\314\225Z\205\017\214T\236Z\370\242\361\264\374\320x\352\236\335u\341\217J\022\371\322$\345N\255\265\266>\374\257\213\302\0336{\217\301Jr\244\342\316\236?\274\021\234\241Sp\3511\221\2141\243\310\315@\331\020)x\305\301r\254\317\247\340o\302zD\325x\251\200$+\350\210\222\372(2\300\021\206\306O\260I,*\263\343\215,\b\234T\244\231\201\222\022\177\202L\"\255\326*\013\306\230{\254S\"[rtD\325\370$+\324Z=\235\202Q\267\354\266\255l+\331\024\030\316\032O\277\022\256\270\360H\371\346\227-\374\315\235\262O\341\207W\227\227\207\215D\247\217N\365\033]\370+\270\325M\373\325\235\340T\356\331N\033\030\247\013\320i\002tz\300\247\005\220\323E\3444\021\235\036\242\323\001\350\264\020\235\016\242\323@\237\376!\247}\310i"
+	.string	"tZF\247ct\032F\247K:M~z$\247)9-\216\323K\247'\235>\203/9S%$\327\245\326\031_y*\031\212\305\310\251\374V\377\325\327\276\375*\266\314\376\024\037\3132*\336R.A\225C+[)\312\323\333=_\312\207\226]\265\2401\005\325'\031`\216p(O\243\274*>"
+	.string	"V\306\244kL\323\236\227\031\312\311A\312\366\300\232\345r\232#4\313\205\255\265l\317\243\330\332#l\363N\262\025\253\324.\211\211-L\312\007\333\003q\320\226\334rW\017\360\310o~\355\254U\016!\367O6\350\032\355\270\007&\021o0\243\270t?[q\311\033]ZM{L\247\006\222\254q\247~\033w\257\243\212\215\223\356\345V\326\3124\301\347\362.'\374!\247\306\245H1\236\356\222j\3504\241\232[\312\354\340\242s?\247j\213ize\311\315u"
+	.string	"\344?\343&\312\024q\247\fcT\2607\224|U\265a\232^;\354\022#\270\"msg\200H\264\356\311T\253\357\350\233`\247\025`\235\337\255<\313Z\376\020\353\2345\357\024\270\357t\274$[\006\025:\034\317\366\002\247d\313\355t\033f6\236\322\355\202O\211\233\022\t\233\n\f\267\022\272\334\016g\373q\201\323\260\323\361t\271\322I\020v7\027\270\\\215\207\342\004N\311DM\005\316\226\253%\355X\324 \030\260n\305mW\343\351t\273\232L\350\373\362\030\276\004#\207\214o\177qb;e\237 %\322n\233\331\340\263}\232QUm\025X\003\373\246=>{x\327\207\262\326:\301\177s.\020!D\210\030O\013\354\0026T\"\314\301g\213\264\327\302e\007\210\203\300\022=\301\016X\002;\271\200_~\035\006\024\255\321\n \332\"\242\355\320eg\226C$\202V(\300\020\232"
+	.string	"BG\013\264A{\254\017\351\001\036\001\332\243}\225O(i\200w|$\200|\326h\177\376\345"
+	.ascii	"6i\250QD\245\220R\202\251\021\231@F\332B\206\003\200\002\031"
+	.ascii	"\252\262\035\021`)V)-H*i\317\3413\300\022\r\243\235\317V\222"
+	.ascii	"\003\270HH\260Cth\232\016\323A\233\017=2\322\037\001\023\353"
+	.ascii	"pQ\312&\251\036\233\252\335\0072\002\250\207U\300\032\221\215"
+	.ascii	"\347\240\200\374U\214\213\272r\t8!\276\246\206\021\331\345zn"
+	.ascii	"\336\250\204\220\373(\002X\345\377\nx\201}T\323\263z\370\202"
+	.ascii	"[A\314\017\325gd\267n\252\267\217\217\032\330\300\346L\016\360"
+	.ascii	"N\307\277\310\265\037M\003{K<@\327z\"\260f\347\021\307jUrr\333"
+	.ascii	"\234kZ\210#&\217\365\021\001\"| \231\317\327I\375Q\r\314\252"
+	.ascii	"\017\3678\3048\374\001\376),\237]\030U\370\177\347\021\213\363"
+	.ascii	"\321\250\225\264!\272j\234\002\221(5\313\236\367\232\246\244"
+	.ascii	"S\001"
+	.text
+	.section	.gnu.lto_applyMixerAdjustment.103.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\243\006\315'"
+	.string	"\032G\204\017I\220\230U:!\003\371$\3437>\226\265\205'\266|\241\251k\211\372\216\352\273l\2062\204-\314\376\226\345\023\355\373\231\0070\bJ\267<Q\311\332\005Q\024-=\222"
+	.string	"\244\310\n/\306B\366\374V\200\353\272\266\021B\b\221;\311\344"
+	.string	"\323"
+	.string	"\342"
+	.ascii	"J\235\033`NV\356\205\352a\fP,N\3345*\036\241`\225o\"t',8v\257"
+	.ascii	"\225\346\325\275D=\fa=\212\340\274e\276\323\227\b\235\t/\237"
+	.ascii	"\273w\351\312\325\275\312\036^\260\036e\345u\351\321\365\001"
+	.ascii	"\322\243,\304\334u%\323U\233\230EO\300\356\275\273\346\301o\376"
+	.ascii	"T\236O+\364\233\255F\233\311b\253\232\242g\343\254\020_\255\020"
+	.ascii	";\"\207~\333\321\001\003\307mJ\257\335\270R\2624\265\202\016"
+	.ascii	"\0306>;\031\3248uK\033V\026\363r4\203\206]-\216\2532\236\332"
+	.ascii	"\220E'\202{\357\247\214"
+	.string	"\026=\325\026/\200\330\220-\316\tL/\254O\2715B\026\355)\033\202\364^\221\216;q\224\264 \335\313Q\322\231\240\313\2163\237\372\016\221#&k\325\n\367^\266G$\214s\356\314\357af%f\224*\3543a\177\034\320\005\230\\\212=\304|*\257\302V\374\037\374\343\245\375\221\227\351Q]\2431\302\220$\021m\223YY\264\235\334J\"e\213{\211\231\347L\376\235\003\251e\235\324r\316\235\374\005\016\365\343\034\312O \265<\340Rg\335\261\242\316\270\324\362-\265lK-\327R\313\264\323\262l\265\034K-\257\251e\365\226S\3252\252Z>S\313\235Z\266\251\345'\370\022#O\315`\326\275/\232o.\027\024+\310\261\376\250_\352\315L\305\237\3023,\246\262\016\035\255RVG\342z\025\313Z\276\352K\346\031\007\235\212\325\242\252Y\020\363\354h_\312\247x&\305\342\330\364&\310\034\305V\353\320\221"
+	.string	"#\2320\257{o\203\243\334\201\371\264\314\020\"\b\035\312\212\007H2\333\377z\200(\256#11'\3209Nf\024 \227i\326N\236\235\270"
+	.ascii	"B\245v\362\034\203rE\001\003#\332f\016\322\222#i'W\244\004\332"
+	.ascii	"\206\223\222\2472D\226\211v\222k\314\346i\324\007\256\301sm\224"
+	.ascii	"\353\212\265\254_\024Fd\017\017\363a\275\367J\340\1779\230\020"
+	.ascii	"\374\037G\231\347\343\223\036\215\265\0032L\210\266yV\026\177"
+	.ascii	"\236\354\340\271\346\351k\201e\031\225\326\0260\346\307\257n"
+	.ascii	"\265\327\356*#\226\242m\n\331j\375\241\366\215h\240\275\323i"
+	.ascii	"\337X\344<gI\317F\373F\"\271>\373S~b\001\333*\n#\332fw\224\254"
+	.ascii	"\026\310\356$\377\023\230\230^\270^b\253\263%\272\227\310\323"
+	.ascii	"-\342I\213\3102\267\364\272\3216Pn\222lg9~\r\350\267\355\033"
+	.ascii	"\225\212\266y\345}\353A\263\034\f\364 \005\320\220\367\333\001"
+	.ascii	"\203\277_\320\307\367\237\3360EP\211\037\0360\b@\217\004\220"
+	.ascii	"\007d\241wb8\f\n\2014\350~z'D\360\200\027z?\301\237\320\307\263"
+	.ascii	"\251\340\001}\031f*|\031\204\301a\360\267\262\317\003aO\205\357"
+	.ascii	"\267\033\002\221\360\235\030\261\003\372x\277\235\2170\305\356"
+	.ascii	"\001\016\007Q\364\204\273a0(\334\315\224\304\367\022\333&5Z\266"
+	.ascii	"\003\375\333\352R\331\212\231-\017\016D\026.\304.\262\316\342"
+	.ascii	"\232\231C\007\373#\177\352\033\330\bq\343E\324C\267\232\255\177"
+	.ascii	"\325e\307\013Z\255u\332H\247\017\364\247\276\300\310\362\211"
+	.ascii	"\013\212\220\242M\327\266Z'\331\203qv\213\345\270\322%\253uN"
+	.ascii	"\033\351\256"
+	.string	"\264r\320L=\001W\325\023\227\324\027\221Fk\333\267fk\\\023\244\313\322\254\223\\[\336&\305(\302\364\345\213\226\002]\353\033\277p\232\326(\334l\031\205\030h\252\021\200\204\250a@\345\214A\312\f\005\"\301\310H\223t\200\002\2319\253m\021\320\251D%3\205),c\371\314\211-&1\255\377\315\301)\312\273H\217z1\234\342\335\0214W\216\322\273\007\335\336\365\256\344\360\355\\\032\003\363\f\211\3562\354U\222\031\177\3453\253\"\353l\2273B\270\033\356\220\325 \t\226qke4\004\022_\324p5\2103\256\350\306bZF q\003\240Q\337\025'\331\274\034\273\016<\007\217\215\374;\346j\023V+\212\327V\367\244R\236\020L\214\267\257U\236\303\016\217\234\202N\236\253\376\003\006\001S\247\336\210_\251\367-\033\250\311\fAv\343Q\246\201\036\033e<;\237\345\2305@i\340v\025\332\261\300\r`"
+	.ascii	"\343\t\226\252\367\217\266|\3016<\364@\302z\341=\310\306\363"
+	.ascii	"\021\270\212\022\330\254/9\360\347\264\304\205s'T\314H=\b\220"
+	.ascii	"B\nnS-g\240\306B\002W\r\340 \023\372-&A\272\314a\356)\245y\207"
+	.ascii	"\202Ep\241\006"
+	.text
+	.section	.gnu.lto_mixTable.104.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\315\013"
+	.string	"\004\024$\001"
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\002\203\221\213\002\001\277\001\354\243\341\025\004\204\221\016\224\334\236*\004\003\001\225\004\001\025\005\001\201\221\n\001"
+	.string	"\177\002\003\004\005\001\177\003\177\177\247\003/\200\200\200\370\305\207\257\357\001\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\005\001\006\023\001\004\005\001\006\025\001 \005\001\b)"
+	.string	"-\300\200\200\320\271\242\200\200\t"
+	.string	"}\276\001\177\275\001\274\001"
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	""
+	.string	"\013\257\322\005\340\200\374\377\217\200\200\307{\361\370\220\273\006\t\001"
+	.string	"\002\002\004\001\001\276\001"
+	.string	""
+	.string	"\244\003"
+	.string	"\252\325\252\325\245\003\002\203\300"
+	.string	""
+	.string	"\201\003\204\360\371\240\367U\001\277\001"
+	.string	"\212\001\002yw"
+	.string	""
+	.string	"\003\004\002\005"
+	.string	"\201\003\203\340\371\336\f\003\001\212\001\002sq"
+	.string	""
+	.string	"\002\b"
+	.string	"\372\002\204\352\303b\003\001\006{"
+	.string	"\003\273\332\201\035\203\340\373\336\fmk"
+	.string	""
+	.string	"\002\013\004\360\372\2508\004g\005\253\001\203\003\202@\001\253\202\300\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\rcurrentTimeUs\026"
+	.ascii	"2\003\303!\313,Xa\265\302\b\203\020\002\362\306\320\030po\250"
+	.ascii	"\300#\302[\"\037\023&2\016\026\272\314 S\361.\001\020\253)\301"
+	.ascii	"\035ii\257)\341\246\024j\017"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.105.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"E\b"
+	.string	"&\320;8@\217\322\001xW\336\337\326\352\301\246EV\335\035<&X,\274h\025\034|\n\377S\001\020r\013\373\227H$\030\256\016\003\201\321\325\020\215\r\334\265gP\323d\223\275S\n)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\356l\326M![@\322\202\201\362\262\2733\202\274;\354\374\233\\\343}\241C"
+	.string	"\206\3355\364>\215;\3366\202\355\005\333\247\245\037^\001.)\337;V\273\031\255\230U\311\225\221\215\355C\373%'u/9e\315\256\007\213\312\356*8!syp\002\354\362\372"
+	.string	"\026\231\025I%\212\027\206\321?\375\304)_\304\026F\301{\227\276Q\330e\305\006\013\206C\004[\266)\004\343\207\375kw\327qd?\332\204\247\323"
+	.string	"\242\033\227i\265\322L\300\031\247j\024\333gr\020\017\233\307a\202\266\316gfUbr\fL#\264:9J\353\334\230\366\327\306\221\003\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetThrottle.106.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375 \371\325\006"
+	.string	"r\31505Pm\222\016\004\210\200\r\242\025\360Y\236\341\017\2429"
+	.string	"\353\243R\243-\363\327\354\277\251\300*\270\303\242\031v\334\314\"A\f\341\026nC$t9\312h\244\021\"Sg0\227f\242\332D\216CC\365\300\020!\252\205M\314\\\022\021S\260\025\241\271\"\307\262\256h\331\262/\344\336\305\363>_\221n\223\256h\212G\256Y\341}D\025\272\027\200\341q\245\337:\356i|\247\314\314_\350\353vO@\005E+\210\224iQZI\023H\322\361co\271\037\005\301\2364m\034\"\003\217\223\212\221\224\314\214\227\022P\205S\007\250\302\267Q\254\016\273\r\251\302\007T\222i\235:\200\204\314\334e\332E\177\375\017~\204?#\007"
+	.ascii	"2\001\0378\203+\016%\256\321Z\210L\334\025S;\311"
+	.text
+	.section	.gnu.lto_mixTable.part.0.179.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`t\036\315\214"
+	.ascii	"\252\344\3042J \322\322\351;`\003\006\203S\376\036-=M@Yy\200"
+	.ascii	"[\3253\025\364xq\323K\306\342\346\333\356\253o\242\242\020*k"
+	.ascii	"b\243?\341\240\230\371\235i\376N\214\361\210>\335\344\276\372"
+	.ascii	"\244\017G\230\325\266j\007\221\220\335-\245\224\002\035\003\334"
+	.ascii	"\002\030\003zy\210c\230\305\206\200p\356\275\203\036\026\027"
+	.ascii	"\370X\006\005\007\273Z\244\3758IN\207\"\314E\301\376\201\271"
+	.ascii	"\310\275\247\371p\373\240\347+\260\251\314\310\366\3435\0062"
+	.ascii	"Z\3660\007r\353\341\"\262{\350\n\302\007\347\215\016\222Y\203"
+	.ascii	"\366\343\027io\004\265\332\217\177\300\356\330\270\377\032\220"
+	.ascii	"{\312E<_[\355\307\357\344\256\213\332\333\275\267\230\0037\036"
+	.ascii	".n\265\016\334\306\311\f?3\215\267\005\304=\346\213\233\256\315"
+	.ascii	"4\232V\3233\264\233\256\241\351\264\r\215C\367q\221oo\317nj\206"
+	.ascii	"\330\353\235\257\276\201\003G\212^\264:mG\3317p\320\227\351\374"
+	.ascii	");\223\341-J\354#\253\227\227\327\325$f\274egx]T\230\203\327"
+	.ascii	"\205\327E\004s\0325\333\350L\357\275P\210\275\312\371\3528I\270"
+	.ascii	"\3374\034e\307I\322\024\026\275\316\031\203f\272\t\261W\243\367"
+	.ascii	"\221mC\003\rL\210\267\313\260\f\240\016\323{\243K\330\254Y\003"
+	.ascii	"\244\252\346-\314\275\267\b\261W\351W\337)\001s\336\353\224\241"
+	.ascii	"\323(\373N\211\360\232\021\262 \247\313\275\316\013\210\275\372"
+	.ascii	"\355\"\366\310\332\2359\303\322\246\237{\341HQ\303\243\314\027"
+	.ascii	";\353X\332$\026\275Z\204\226fp\336l\020\233\f\277\200\361\325"
+	.ascii	"sL\330\371\002\206\262\347\2304\201E\357\331\320\316\031\337"
+	.ascii	"\233\340\275\321\250^9\006\261\327\"\273w\364\253\345>\020F\257"
+	.ascii	"\023'\27337\\\307)[\356\003\376\271w\315M\315\275Q\251^Y\005"
+	.ascii	"\261\327\246.b{\025\366\221\355\225\271\3050\363\227\223\225"
+	.ascii	"\314\177\035e\273\r\330FF'x\357\245\352\365\261,1\261\205\321"
+	.ascii	"\346\251W\266\213\026TSR,\242V\250H\201\342\004\224\211\247\022"
+	.ascii	"NM$F0\211XRJB:2*\":\266CF\241\240\020 \212@?\304!\273\n\337_"
+	.ascii	"(\271\275\351\004\254]\254\241\365u\013\276\246\342\353\351\034"
+	.ascii	"\237\032V\245\200F\247\245\3504\013<\217\252\301W\310q\025yq"
+	.ascii	"<E\036\034G!,:\343\322\354:\316<\341\212\351\032=\335'\365\023"
+	.ascii	"Pwm\"\215\f\376\204\246K\240\261s\2473\335t\306\214\223\220\353"
+	.ascii	"\021r\302&&\2708\027!\034\216\235q\351:\3167\241\f>S6\356"
+	.string	"\f\343K)\240\211i%\030:\311\315\237\300\340H\356\354\325\212\231\336\033u\rML\037\265\265\221\020\312\215\217\233\256\343l\023*\325\215\251\320}\\\274hK\023\035\361<w8\016\253V4\276\351\033u\rMK\267+\364\232S\005\266H\2056+\260\323\232S\313\017\371\240\205\232\305\215[\330\\\210J\007yqR\251\343T\363\020'4\210)\325\023\274\350\264\206&\245\201\204Mu\234R\242\370\317\260j\r-\255\211]\307\371\024k'/\3164\037\0029\201\322,\323\303\310|\025\256P\303{Rd\203\025\035\306\\H,\241?\310\311R\330t\357\355\276\3662'b\356m\277\030V\335{\271\303\374\232\001h\346\237c\356\034\314JA\002}\366\230^\226\303\207\262_|vf\340\022\252\204@A\366\241\274\312\021\262\207\341\340\210\017\214\262-\006\337\226\2372{\202\335\327Pv\317\376\205\003(\266{\303\272\351\202\262\355"
+	.string	"6%\013\312\026\224_0\210\353\242\366\326\353\214/\003\372\237\177\232\340\302\035\032;t\304\234\017\030\367\302R\020|\314,\234\005\245\033\023\337\275WF\233wQ\212a%\234R\316\273\251\224c{\005\372\2378\342\377\f\237\370k\033f\236\341\017\357\220\r\256\317~\247aN\231\206oI\322\301\272\202\360c\224\371\243\256\017m+\366\277\365\314\3651\327p6+\342\275W"
+	.string	"v,\036\334\340\326r\305\366\372\377\023\307~\305\241W\334Zx\201\034\336\315\034\017#\3133\314\253\374-\342\t\\\030\341T\036\230\300g&l?R\234\2309?1\347\303I\316\374"
+	.string	"\004\336\315\376\356k\240/\324*\324\351\362\301\374\241\374/d\260\361\231\362_a&\222ut\036bt\306\022\322\200\315W\255s\006\2553\006G\347\013\206\234-h\235+\030r\246`\3109\b\221\363\004Fg F\347\037D\316\022\030\235}\264\316\021\364\340A\344\f\001\221\363\216&\323\374\300\321\331\001\"g\035G\347\006\214\3169\030h\235\027\3502\3158\332\256\371\206\223\320l\243u\266R\240u\256\321:'\320:\323h\235\253Zg\004Z\347\003\206\316\006\364\235\346\031F\316\005\0309\023\340g\315\003\264\3162Z\347\030\255\263"
+	.ascii	"\2553\214\3269\200\326\031"
+	.string	"\200\326\371E\353\354\302\2334\267h\235\251Z\347\251\326Y\252\243\335,Z\347\250\326yE\353\254\242uN\321:\243h\235O@\265\316&\216\316OF\347\022\255\263\223\321\271\251\310\231\304\b\"g\246f\323,\242u^j\235\225Z\347\244\326\031\351\350|tt6j\235\213\210\272M\363\261\3454\267=\247y\250u6\266\316B\255sP\3535\207h\235A\264\316\305\326\031\250u\3769:\023\217\316\303\326\231\035r^\205\234\205F\347\027r\366\346k\356f\n[\210#\244v\357Y\365\207[ee\323\326|\335w\272\365\272\347t\313\351n\323\315\246[\332m\327]\246\233L{\223\366\263v\022\332\221\242lhN6-\316)\310\031|\3217>\035\345\353\232\031+\216p\243\2120K\205Q6-E(\032\022\330<\2614`\254\002\226rhxn\002gU-\233\214\t\357\370\b\276\t^\261h\224\026g}\223\2610\024"
+	.string	"\260\"\002\332\023\252^\033\260\221\230\233}\004w\302\376\204\213$|\241\261\264/\332u\275\037X\2403\035$\2329\317\276\234(\207sfzo\202n\306\\,\363&\003y\272qf\373\261\207\340M\234\254K\351dE+\315\337C\016\217V\343\373\355\031H\245\361\b|\002\277d\305\254\312T\253\372\241\247\361B:<\357\254\372V\363\ft;\340C<\002\377}\230^\226\234\004\374\021XJ|3\245\230\262\215[\013\007l\257\007<U_\\\001?\343\r\370f\272`l\256\201%\340\013\030\340\tx\177\322?\226f\325/\363f\f\rIF\263\207\033\036\343\231\223<${\360n\312x\"f\232\032\3524\306\223%\367\214\305x7\3179nG\002\374\322C\350\266M\023\306\013\360\254\236\245\007\3600"
+	.string	"\370\027\037\3007Sm\351\325*"
+	.ascii	"o\224\305\305\267\370\027\337L/K\257\366q\361=}\272\241R\375"
+	.ascii	"\324\267\350R\303\247\336\233\356C\262Jt\252\363I\372\220\354"
+	.ascii	"\223\254&\253J0\345\322\273I\365\rWeL\317\324{\b\275\206y\272"
+	.ascii	"q{\036q\261\342\202\321C\231\375I\352\205\314\3610&\365\027<"
+	.ascii	"\333Pgx\324\263\bAY66\215z$\351\n3<+\036)M\332S\206\253xf\245"
+	.ascii	"\023%\t\336Mn\022{0\366S\361k\310\274\251\301\025=\224\035n\206"
+	.ascii	"\021\216(\200\240k\376\332\023\357CN7\314\246\220I\215N\237\""
+	.ascii	"\305\363\321\360\244\233\333\263\313\0236\247\271\n\314\373\020"
+	.ascii	"\241\370\376\241\031\b\354+\303\f\274\241\203\344P9B\275\323"
+	.ascii	"\237\370F\343\333\343z\255\024E\017\314\373\360\267\020N\336"
+	.ascii	"\231\366\016;\016"
+	.ascii	"~C\025\366\3465;\353r\253\330\300^\207\377\210\367\202\265Z7"
+	.ascii	"\023\253Gd\273N\242K\266\305l\332Tv:\334j\314>\207\231\277\376"
+	.ascii	"\274yU\200\220\223\246'\346\203Vr\030\023\r4\361P\357x\230^\236"
+	.ascii	"\336\304/\341aNK\374\323\267\017m\343\311\227G6\030\026\324T"
+	.ascii	"\303\033z("
+	.string	"\263\235\266bK\274\220\2719Mee\t\036\247\3047\265\335\316\0056587\376\206\245P\370\216\357\330^\235\036\310\223\216\3724>\224\273\257\372\0274\342\265\252\\B\210x\005\254\330\2464\237\201M\225R\212\017\266\327&\251\253\361\241<AI\205\n\333+\211\357'O:\267g\230\320C\231Y\304\217@\201\245\272\334\253\313\023\004B\351\273ZD\372\245/\373\3012\275\020\024\\\006&\304{\305\004`\267s4J+P%\026,l\257L\277\356\031\\z\021/T\3370\275,C<\264\350\225@<\224\203\316\376\310\244@C\276N\302v_\337\220\366\221I\177\332'Jz\244\357j\235\3179\035\031n\303\366\232\364?qG\217d\364G\337\314<F\277\246!\033$\372\242'(}\346\366\352\246a\305\207\002\375\025\246\200I\024z\027\253\003C\333\360\347\215_\346k}|$90\312,\307wh\237\350\n\036M\022"
+	.ascii	"[\373\277\027h\374\241\207\002\270\334\253\373y(\373B\304\207"
+	.ascii	"2\005L\266\370\036\326?U\342\374\255?\017\"H\fN\312\337\304\004"
+	.ascii	"\375C\001\244\306I{\031\202\024\275{\031\201j\365O\354\336\260"
+	.ascii	"'"
+	.string	"\020\037B\310&ld\252\313\210\327\225\026\025\222--\255-,#SK\270\250\212lp\\\202\324z\"\033\340(rmya]\331\310:\342\345\265\305e\304\353\210l\032G\266\270\274\220l\3250\202\205$\311\325\221\243\216\254\016\220^XW\305#G\266x\f\031\301\362B\356h\275\220Z\310\006\264\222\364\030\202\334\241\344\212I\320\220,/\254,\257,\005\220 7\350\241\344\212\211\220\222\253\t\206 wt!\227\320\030\222u\344\n\253\313H\\r\205\004\251c\tR\007\327\226\327\226VqH\326\021!WH\254\262\206liq!\257\202\272|di!#\360B\222\305\305\225\004+\004cMqe-AjQy\031)\202<B\204\n\t\362J\213\n\213\253\213jJ\211\2676\310\342\242\362\332\332\342\242*vU\330/](\021\336\273\206@K\273\247cvh\201\304g0A\223XD\250s\233R\247c1\320\302"
+	.ascii	"\251\244\204\374\373\261\210\352\253!\177\205\365C"
+	.string	"\354\254\316`\375\211> \274'qS\017\345\253\027\362\355\306O\312T\313\340\033\2209\371\366eX*\304F\367uJ\262$\337\274i\323\314\323\200\234\\\341\347X:&\203\357i\273\231/ljptS\336\244\036j\202`\030\213\277\302\030|\005Od\016\357\202\307`j\301_\260\345\243\311\266\217{\271$\013-$\277|a{\265\340\245\262L\375\033K\211\3740\274\230$\030\267\244\0301l\257\025\274\004iw\334\330\370\226\3512\n\005KA\237\3616\n6\310S\360\345_H\002\227\224\223c{\r\362 \244\335@}\326\240G\266\342\241\334w(|\377\200\211\232\251\230\340\211\304\360-\374\3602\0015.\254\005\274QR<\224\233\211\005B\304\301m\350\037\017\344\331\311\236\313\347\362mVsI::\266\327\037\317\225\226\007E\347~A\361P\226\240\0027v\362\f\313\234D\223L\343\335\224\340\333\f\016>\350\211\235"
+	.string	"\342\016<\217\357AbMr\206\036\364\310\240|\270\003\337~\255&\371\346\004[\2239\031'YC\233\301a\007\275\261\0073\321\311<\326Gr\316C\223y\177\305\307W\220\366\206\032\027\301Z\322\2069\315<=\236\307G\360\215\226\366f\271W\327e\371\364P*iJ<\364\301d\330s\022\336\033\3664%\2024\2720\202M#X4\214:*t\230\242\332\001\b^\310\216?>\004\377i\310\236\017\374\216\027Z>\245dQ\302\274\312\016\374\003\337}\310\006I\214\370+\334B\246%\034\337c\351\306\363\3702N\323:\376\271$\355\350\270\302\244\242F\304C9\004\fJ\f\364\031S\312\335QT\017@\304\016\207RV\233\325I\211;\272\361e\r\374"
+	.string	"\337qsx9\276\201o\262\301\260;\017\305\252\2047!\271\247l!\331\327\307\366\232c\215\362\374s[JZ\340\031\t\307\023\3712\026&\335\350)u'\334!\331\370,\026=\3003\360\356\354 v\314\366\230j6\236\231\225\"\264\032\226\022\361\371\223\026\312y\376\340\366T\302\3616~\201\266\223\303\2303I\017\345\033o\343?\2062mV\237\300\333\370\241\035\263=\n|\215\267\372\202v\250\362"
+	.string	"\035Q\222\034\203\314\320\214\310H\222\024:R\n\020\006\304y\244\326\324\003\022"
+	.string	"\225-KC\304F\204\202\244 I\262\214\001\376\021,\370\350\316\247o8\314x\345\303\225\236\t\315PD\314\340&\022@\027\264f\311yv\004\242\2233J\214\200\333\003\354\350\206b\326\305\270\232:\240\214\253u\004F@@\216\372\366C\360\371\024\277Y\244\272w=\220\3250\037#\353\306\177\335\005\345\2770\275\370\360)+\342!z\350\226\0179\231\204\023\364`\f/\bjQ"
+	.ascii	"c\367\330\200\216h\t\217?\373\233\"L:$\357t\243)L\273\211\035"
+	.ascii	"w&\326\305Q\026\030"
+	.string	"\332\220\356@1\276\352\207\214?%9|\254J\203\213d\274\004\266#\004\310\3558<\352\274\276x\310\372{\322\032a\tE\267]\202\346H8\236(}\352Z\337\256P\353Y\211\310\351J\"=\342\235\022\311|\361\201\214\303 \021\266-\356\220\273S\r\325\227\335;n\357\233\323\372\021\033M.\257\301|A\261\007\334~\255Lrg\004I\305\214uqC\"1x\200b\261\3110\241\021\233`\276*\240l\313\210Q\235\006 !\317\202\204\201\224=\331w\214\340\005\036\244\354\364\272%\330@\261\231\217\002\260kj\3719Fc\262\316\fLP-\200\373\375\362W\230!\330\372\265)\013J\f\350\034\267\216\303\220]2m\237\031D&R\242Eb\346\240\366\\\343C\276\250\306m5\227\363\351\220\332\033\017\267\232\215\365\007\345\226\007\354-\005\302\323\200\325\177XG\223\266of\016\207\325\346\222}\263\332$}r\nN\212\003"
+	.string	"vP\316G\264\333 \311\023\001$\354\264\0268\333\267/(\016\255cBKj"
+	.string	"\006w\221&\346\320\234q;2\360T\232\327\254\304yYY\253\337\214\035\376\024H\227b\021\226\324\023\031`yXy\241<\236f/\276\025ss29\241\b\261\\\203q\354X\037P\315\360\311y\241\311[\367\"\334\223\013ib\331\233\\\237\231y\301\026\223Z\304\275T\304\377\265$F\376~\267\352s\fW\314I\242_\277\347\316'\362z8N\230\334\022\302\330\227\321\261\267\363\177\017\034`\241\303\276\357\031rI8\213,\024\212y\247\005\243\030\212\2073.\232L`\004uQ\235os\034>p\336\354\346=\270\242`\032\254\277\253\002\341\n\332\020\200bY\0226\341\374\204m\342\273\n\234\227\234$\315\207\037\241\032x\367\343k\323k\007\021m\\\304\3011#\231\225 \022@\"\354.\025\246\246\030O\262\256\247\225\353\313"
+	.ascii	"\330\215\261\356\270\273\375\2447q\205\216\006\007f\306\347n"
+	.ascii	"\345\261\357\350\2261\371<\261\026\306\310\030r\002r\352\223"
+	.ascii	"#\373>\343\250\017\031\332\362\246J\026"
+	.string	"\277\330\016{\357CpL\204$\253|\020\224_\337K\217Y\242\001r\237\236z\n\263\261Brg\f\373v\305\203\004\273\201\013\246\234\204z\246)\026j\276\300\337\266\225\300\306QAB,\361\275\262"
+	.string	"1d\211\375"
+	.ascii	"t\337^\265b'\314\262b\003\ng\f\323\bG\037rmt\306\016\363\227"
+	.ascii	"\326\350\337\224\037\356"
+	.string	"\364\201\224\306\301d\335\312\327\322\317X\260\273\255\013<\312,\276\\\312\325T\212\237\343\227e23\357\224r\020\250\347\262\312\364f\\v\333\023\317\007\276\237\212\026\343\373\354\002\363\r,@\241\222\2436\320\3717\242\301\240\253xj\tC\246Q=t\272i\206\301\021\242\260\213\325\307\232\226\346\234\374\202\344\032\362/\321\032\357\267eF#Y`R\2505\b\342\020f\376OWp\005MGc\356\347\001\211\261\247,\366\005\004\311}G\306oq\346\335\005\366\247\307{\221\260\346\b\332(\035\223\242\252\240\3356\321#\342120\201\330w5\367\265(\026*\3047\304\262ET\210\325C\364\317e\"\340IW\0213A\033\344\241\275q\231\004\0010\024(\322\277\257\312\324\253\321\301n\016\221d\032\336\323\321\300>\275\265\265\036\206h\221\374\221,\211J\337\373x\360vzy\023\013=Nr\013\320x\340\341\2532\245\306\272\377"
+	.string	"\006\267S\372!\300\334q\263Q\266\3436\r\322K_\274\300\376\351P\334\322\325\220\271\255\033(\263U\017\345\326\242\337~\005t{\372\233\013\240\376\372"
+	.ascii	"\037\270{r\266\305\266\003\326:\211\022#\276\033\374\300\204"
+	.ascii	"N\003d#c\307\200\202C@h\351\177\324Z\314\033KC\364\364\007\261"
+	.ascii	"\003\305\316\323\230\213K\262\221~F\034\323\347h\203D\247]0N"
+	.ascii	"\002'\275\371\312W\321\334j\300\322\364\210\267t$\267\217e\224"
+	.ascii	"\341\217\325\306{\3362@\333Nc\374h\231\205\255\322#'\247\034"
+	.ascii	"\314\\^<\027\262\343?\034"
+	.text
+	.section	.gnu.lto_.symbol_nodes.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`N\006\275\027"
+	.string	"&\347\217F\200\232\316p_\231}\232\017Y\221=\272\350w\302AL\304\035\021\007\036c\tW\207\3439\241B>\332\226MV\3634\237\3030l'\001\353\300z\242:\231fU\245j\226\330"
+	.string	"\211p\311<\250Pa\245\206\250\313-S|"
+	.string	"|"
+	.string	"|"
+	.string	"s\t\372of[\030\2236\246>\026s\351M\214\311\2738\245\376\0253iu -\016"
+	.ascii	"(\212\242G}+\246\361Nh~\304\371Yq\261\216Vu\206e\324w3\213v\006"
+	.ascii	"\321V\r\255\f\241\243\005=\n\320\246?o\3639[\317\245\020O\005"
+	.ascii	"\301\247\034\330\343pi\320\360\277*\312\363\345\316n\031x\231"
+	.ascii	"\001\005\316\205\346?\017MS\324\310\337\277\231\325\362r\271"
+	.ascii	"\\\352\364\253\230\377{N\001\257K\321\367\202\242/w\242\227\207"
+	.ascii	"\211^\256\022\275]$z{\214\350\315\022\321\253\025\242w\007\210"
+	.ascii	"\336\034\037z\255<\364^u\350\255\301\241\327\306\206\336\033"
+	.ascii	"\032z\321\f\27510\364\252\027z\251\026E\321?\307B?n+\364\341"
+	.ascii	"(\364\265<\355+\355kB?\213S\037\212\204\376\0233E\303\""
+	.string	"\364\323L\b?\363\340f\034|-x1M\267k\360/\fN\267\340sh\232\252\nz\211\230\001An:\n\262o\335u+\243\363Q\274\341\032u_\3275\304\254x\303=$\021\220{\352\336\214\325RY\004\3445\002\262\rp\r\372\361\017)`\365\t\375\230\247\\y\310\r\262\251y\r\375x\201\254{$\236_\254{8.\255d\317Y\n\351s\206R\256\217\212\r\3759\377\224{41\260$\361\314Sw\201\316.\372]Z\364\267D\365\311@\365\357X\364\307\254\350\207Q\321\007\363\324\001_\2575&\357\346\316!o\272\347q\355\310o\310M\304!\023\370\220y\3122\036\346\221\361\260\316\311vX\207\351d\234\025\311\3119j\222\223s\306\200'?\255k\023\344G\221\217\235\034\205Tr\262\224\272\236\f\343\355\346\344\251t\205Yb`\301\223\247\220kL\336\315}\311\311\373\225n\021+\225\023\236\354S\221\204\034"
+	.string	"\271\273%\304.+I\3105J%!\367\326\34525\252\253%!\377Vcj\2501\fB\204\245\244Q\222\264\324\001\020\003\241\241M\007\021p0\f\r\211D\"\t&\020\t\344\003=\276\240\264\33534g\211aS\005\374+\262\314\3668\320\205`\306\247EX\266\247*'\345\252\036\355\001J\177\273\375.\335S11\006\213#\337\240'f\234\002\0052\345,\257\210\022%J\224(Q\242D\211\022%J\240~\324\rY\221\332\264@C\215\365\344\233I\326XR\fE\210\n\345\001r\326\364-"
+	.ascii	"YY\200\212)\021n\022\320\323\354\202e\336\270wv\244\031\326\252"
+	.ascii	"\006\255\266\217\341\374\\\350\230\0249R\251\352KU\367zT\267"
+	.ascii	"\264-\241\260\262\316\362U"
+	.text
+	.section	.gnu.lto_.refs.13bea5dee519acec,"e",@progbits
+	.string	"(\265/\375`\025\002-\020"
+	.string	"\306\244f=\360\232$\255\0018\031E1AH\0222\002 A\221Md#j1\366F\237\303$\016\213\303\342\2608,\016ZG\264|a\031B\017X\207y\220e\243\265\315\356FHk\204XB\210L\001P"
+	.string	"]"
+	.string	"R"
+	.string	"\337h\267\r\352\256\201\3354@\367\003\266\207\353r\370\334\r\236\253\341\316`]\f\367\205j\013\355V\240.\205\352\t\330\225"
+	.ascii	"\272\020\260w\256\353\340su<\267\301\315\300\272\013n\004\325"
+	.ascii	"61g\3233\323\240\351+f\213\272\325\364$}\367 O4\001'\005\020"
+	.ascii	"z3\332=\031\355\213\201\335\203q\335{\361\271\347\302\272\327"
+	.ascii	"\202\346c\261B\205\347^\n\024'\356#!b\346\036\210\320\303|\341"
+	.ascii	"\242%\013\026\231_\251N\005\364)R\242<q\302d\211\222$\326\215"
+	.ascii	"\344\210\221\"\240\233\b\366!\327-\344s\007\361\334@~X\267\217"
+	.ascii	"\273\216\230\343\240\006\022\262\033\301\346\007\322\fn\234\354"
+	.ascii	"\216\254o<\027\270E\236i>\207\2561\254\201\326@\273Y\2733w%\272"
+	.ascii	"S[\300\232s\023h\207\332V\3151\242\004\252!\001Wf\300\365\f\370"
+	.ascii	"\004\f@\215\305J\025\033(\331\335\344s\035H\315y\344\270;\247"
+	.ascii	"f\252\346\037\316\235{2\367\340^\231\324\272\251\253C\275Ljp"
+	.ascii	"Ot(Ld\367J\214\230>\021\013\276\0209`\244{\351\"\272\267h\371"
+	.ascii	"\321\003\347\346\261\343F\273\215\004\257\241@\232F\373C\202"
+	.ascii	";\2647\2643\2641\264\273\323\326A0\032\r`\264:i\033m\335<\335"
+	.ascii	"<\22031 \260\002!*\262\003o\374\234\201\215\202HS\005\b\025E"
+	.ascii	"%Q\222q\265\271\350\323\256\200Ug\267\210\263%\334f\377\016\246"
+	.ascii	"\205\340\346\264L\364f\270&\004\2066X\b\264z\322\227\372\213"
+	.ascii	"\352\027\033\337\005-\273\026\272\342\226\327\273\f\264B\334"
+	.ascii	"\273e\222\013^q\317\262W\356aY\365\025\335\326\342\336\3472\t"
+	.ascii	"]\\\352\272\320"
+	.text
+	.section	.gnu.lto_.decls.13bea5dee519acec,"e",@progbits
+	.ascii	"(\265/\375`\364Y\305u\001\312cN\206T \fY:\215\001{\351\343Fs"
+	.ascii	"\314\027bt\035\227=k\333\017\240\3541i\306\031\027\247\314\226"
+	.ascii	"g\017Y\026b\226]\0216\270Y\356(8^\377\326\\"
+	.string	"v\231\215\276\227*\002<\230\334\257;~&N\n\264\335Sd~\325R1\266\324\335\375*\333\336rK\231\002q\007[\b\253\b{(\325\216418\343\275\267ad\006\355b\316\035;8c;I\307z\n \322\203\fg\023\327\201\343\323\206\r\024\024\316\027q'\265\027\305N\212\217\r\036b*\3354\025Z\337\022\016Ns\355Le\362\247\346\343\205\032\027k\360\220\240\250\241=\305\242j\016\226\203\343`:\030\017\277\301y7\016\303\301n\216\227\370\353\030\337\370\223\340\3406;\n*\204\263\267\260\274\274\275\225\277\264;\030oC9\350\026\241\347\261\242\317S\246\317\003\246\317\343\245\317\023C\237'J_\317\321\327f\364\217\321\374\030\201+{\201\3631V\226\235+\2609\033n\256\\\0175IL\245U\207\306\217\251j\344a\252\027\327\216/\211\243MU_\2210W\316k\r\346\221\344\332\221\265\351\300\310K\307\245"
+	.ascii	"16\313\275\3671\f\253;\230J\306\265\323\203A\004\017\t:\367F"
+	.ascii	"\212I\032\001\263\3040\376$'U~\274\206\333\360\034\246\303_\260"
+	.ascii	"\032\366\202\317`2x\f.\203\323\260\030\214\206\343\260\034\256"
+	.ascii	"\303Rp\027l\006\207\301T0\027|\005k\301o\030\f\306\202\255\340"
+	.ascii	"*8\013\206\303lx\nv\273qx\013V\036C\301Q>\370\257\334\221k\367"
+	.ascii	"\005\273\370\223\310\360\230\225\244\034\022/\311\275\225x\013"
+	.ascii	"6\303g\227\216\213\004\262\263%\336\202\243p\013\023\n\226VC"
+	.ascii	"\253\272*\243\202\277\224\\;\266\033\311\270%\177\022\023,jM"
+	.ascii	"\360\330\025<#L\016o\250k\027\0045\264\245\352\\$\257b\354%\367"
+	.ascii	"V&=Y\273j\377\225;\336\202\177\340!\227.H\003\312\322\340-\256"
+	.ascii	"k\027d\356\335u\227\334[\371\017~L\365w\360\001\336\202s\\\273"
+	.ascii	" (\345\226\361+\002\345G\226\274\275\225GAm\326\300\221CB6\225"
+	.ascii	"\327\b\r\341\026\241\327S\360\231\335\007v\206_\222\276\030p"
+	.ascii	"p\276V\352\3530}\255C_g\351\377\226X,\333\b\343#\f\347\377\322"
+	.ascii	"\350\377\332\364\177O\364\323\\#\364?\036\372?\032\372?\027\372"
+	.ascii	"\350\035}\024O\037\275\323G\315\350\243Y\364\3211}\264\210\306"
+	.ascii	"@p\220\033\207\001\026r\354\003\337\370\031\245\334\312\275\225"
+	.ascii	"B\230\310\035*h8\037\355\241\1771@\315\276\276\213\001z\224K"
+	.ascii	"\343[\204\036\255\322_\302\321\317\273F(^\001w\335\270#\274c"
+	.ascii	"\013]2R1t\340\374\223\215>\301\276G\350\373\356\021\372S\214"
+	.ascii	"\376\211E\377L\352\241\023K\037\305\321\317`4\b3\315\201\016"
+	.ascii	"\035\3025B\237\243\364M9\372ke\364\335\340\364\275\\#\364\246"
+	.ascii	"\024\355\341\026\241X\nO\3358\020\230\305y\246\224;mo\245\020"
+	.ascii	"\317\2318+\254\341|\263L\377\202@\205\372\372\372\372.\b\364"
+	.ascii	"&\017}\263Jsp\3730\320SZ\254\224\361u\020R\332\270\352\201\363"
+	.ascii	"\177\357\3301[t\201\301\300y\255J\033\332\2246[\311\274\345\325"
+	.ascii	"\273r\356\336}s\363.\336\215s\353\3349\027\316\245s\343\256\235"
+	.ascii	"\333\346\367\356\272\231\302\342v\317\220T\021\361\337\265+o"
+	.ascii	"\013\342\331\333\013\226\244\032\333\025\021\035|p\355\3344\327"
+	.ascii	"\356\322q)\200\354\311ro\345\233\22655*v[I\261\213\245\355m`"
+	.ascii	" XI\262s\321\3343AS\312\ru\302l+\231\267f\205m+)v\321\354\\)"
+	.ascii	"o\013\232Rb\340n+)\266\367\326@\203#\r\314.\035oU\033\262\005"
+	.ascii	"\3455Bq\220[\204\036\177\321W\315]s\343:\\6\357\340\203\233P"
+	.ascii	"Q\204\200\370\306\370\364p>~\323\277\035\320\333w;\240\307S\364"
+	.ascii	"\361\230\376/\334\357\231\377\276\335,\327\fF\356=\265\367\316"
+	.ascii	"\320s\367\304\214\033\316e\216L\2708jup>\006\323\027\341\205"
+	.ascii	"\353\277tW\314\035s\353n\334%s\301\374\312\3350\317\312\275\257"
+	.ascii	"D\351rCm\356mASC\033\206T\216\344\336\373\267\354O\372o\332\215"
+	.ascii	"r\311\\.o3\241`m\030RG\006\220\266%K\216\274\275\267\006G\032"
+	.ascii	"h\240\001\016\203c\316\252'\037C\351\273\257\021:$G\377~\371"
+	.ascii	"\245Cf\177\360\373\246\177\327\364/\232\376}\242\357\226\244"
+	.ascii	"_\270\"\024\213K\271\327\366\336B\025`\201{\303\3717D\353}\215"
+	.ascii	"\320{o\350\337\027\372*h\274o\021z&\375\023\372#\3641\320\030"
+	.ascii	"\353\026\241\247\273F\350+\320\327:\337\"\024#o\021\352\341\032"
+	.ascii	"\241\377\205\362_'\267\354\236\231UV\310\275\266\267\222\350"
+	.ascii	"\347\204\313\327\032\316\367\f_\263\253\374=\273O\336\301\007"
+	.ascii	"\377\231\332e{+\357Y\336;\352\336\017A\367~8\341\212D\241\241"
+	.ascii	"\371X_y\215P}\213\320\337\364\260\346xf\030\366\361\233\036\230"
+	.ascii	"\035<\317\274\361c25\277Y\224\3467{\376k\003\315\177c\230@\237"
+	.ascii	"c\006\23131P\206\365\343&cgp\237i\3467]P\341\0331~\334\365\233"
+	.ascii	"\033\\\031\370\003\377\345\340*\305\037\247\370\261\212\337\314"
+	.ascii	"`\204\037'@\002\230I\352\032\270\331\tf\231\337$c\322\375\346"
+	.ascii	"\334oz\371\315,\377\335\272\031` \002(\376h\004~\223\203\021"
+	.ascii	"R?\2663\031p\002L\307\024\303j\246\033&r\240\037-\3417Q`yj\373"
+	.ascii	"\361\032\r\230h7q\f?\232\301\221\355\2771\2008\b\001\342\223"
+	.ascii	"\001\005\226\337\274b\3457\327~\263\311\006\376c\200\205\230"
+	.ascii	"U\210\374\302\217\336\037\353\341\231#(\201Ib\211\211\201\262"
+	.ascii	"\223\371_\346'\256\201\377'\230h7q\r~\224\304\347\320\335"
+	.string	"\254\377b\376\323\375\237\373_\346\377\233\377f\314'e\377\225\361c \034p\362_,\245I\366\023\260\220g\360\237n\376+\365\337\251\313\342n\376\333\371M\021\306\376\307\241#v:\377\227f\223\377Z`2\271\336\341\374&\211%\377\035\301\217\343\256\323\177+\360\337\3667\225\374\270\213\231\3447O\370q\030\222\337<\362\337\b\374\270\315L\376gc\032\371\237\207\301O\030\200Y\0323\3547\213\3747\003\"\217\300\177f\375&\217\037\233\t\371\315\025>\347?\233\343\231A\316\341\377\021\220\337<\3003\374\250\212\337\\\341\2775\256\215\257\377~\364\370\023n\376h\3617\275~\263\3537q\374f\215\337\324\372\315\254\337t\361\233T\277\311\3427\245~\023\3527O\360\233%\370\315\021\374\346\212\337L\361\233\355o\016\177S\375\315\340o\002\177\263\003\277\231\201\337\224\300oF\3407K\370\315\021~\263\304o\216\370M\006\374f"
+	.string	"~3\001\277y\200\3374\300oz\360\233\035\374&\007\277Y\200\337\334\34073\370M\f~S"
+	.ascii	"\277\371\3417/\374&\320o\372\374&\372\233\346o\376\307z?\256"
+	.ascii	"\363c\274\037\313\371\361\362\307w?\266\373\361\232\037\247\371"
+	.ascii	"q\231\037\223\3711\335\217\347~,\367\343\270\037{\371\361\226"
+	.ascii	"\037\273\375\370\312\217\253\374x\355\307Q~\254\374o\215\377"
+	.ascii	"'~l\366\343\262\037\223\375x\354\307b?\016\3731\221\037\013\371"
+	.ascii	"1\220\377'\374\370\307\217w\374\030\371\343\247\037/\375\230"
+	.ascii	"\351\277[\377\265\361_\255\377\262\370\357\t\376\247\360_\023"
+	.ascii	"\374\267\004\377%\301\177\023\377}\372\257\322\177\276\377w\376"
+	.ascii	"\357\375W\376\007\301\1770\377\203\372\372\372"
+	.ascii	"\372~\035\200\337\310\315\257\200\267'\335\336S^P\r\360\312\232"
+	.ascii	"\362\332\252J\363\312\"\252J\363\332PSaPDX\333\013\252*mo\242"
+	.ascii	"\251)\250\022\310\254\252\264\250MT\225\266\2636\0132Yw+\275"
+	.ascii	"\240\366\024r\023\355\251\035\265\323\220Y\036\252\246\274\262"
+	.ascii	"\252\322\242\262\210\252\322\274\262v\232\327\036\332SQX.\246"
+	.ascii	"6\026\321N\363z\263\323\220YCUi\310\254\2524/7\327\n\21431\033"
+	.ascii	"|`E\364\356\233\252\251\035\343JG\024\326\020]\225\022\271\323"
+	.ascii	"\354}\327Zl\254M\267\367\005{\353@b\245\211\332\272nRt1\244\256"
+	.ascii	"D!\257r\357\255\341J\352\013\271\247\350\240\356\246\253R\202"
+	.ascii	"\334[\211\024\323\276\332{o\017\240\224t[\310\245\203\352\241"
+	.ascii	"c[\265\330{\303V\356}\2657\324\335t{o\250\275\367\017K\207ro"
+	.ascii	"\034CU\311\253\253\275\271\216\256\266\016\250\267\026{\343\265"
+	.ascii	"5nYUi_\310\244\267)i\311M\245\204\272UV\310\235\334i\274\260"
+	.ascii	"t\032\024\224m\265\367\276qt2K\013\016\316g\224\037!s\276\366"
+	.ascii	"p>\005n\372T\3364R\316\244\341|\n\242h3\241\017\265-8\237\202"
+	.ascii	"1\375\237e7\356,3m\220\240\334P\034\216\324\221\355\345m,\256"
+	.ascii	"\r\360\026#\204\n\316\247\200Kc\026\312\013\\Mb\220\235bF\266"
+	.ascii	"p\301I\306\235\311S\214\004d\224W\022\\\026\275\271\274\275\271"
+	.ascii	"6\3106\226_gpnrT\0014f[8\237\002+\375\033%\311\223S\311y\004"
+	.ascii	"E\203\326\304-\357dr.\271q\247\222\023\311\032\317\030\017\261"
+	.ascii	"\026h\376\206;\375\rd\3647\310\351op;\303x\2208\320\242p\376"
+	.ascii	"\2065}\0269\220\031e#L\033\316'\221\237(\033lcp\376\2063\375"
+	.ascii	"\337\270\267\235Br\024$\224\344\336{\350g\215\034,k8\177\303"
+	.ascii	"\230V\226\355\255\fB\231\200Q\275\001\371\361\243\205L\024\337"
+	.ascii	"\327\317\037\377\331\343\364\3616\\\001\230\024\021\234\263\362"
+	.ascii	"\032\241_\273E\350\351\225\364\363+(kLJ\025\234\211N\036H\214"
+	.ascii	"\005\243N\r\316\377\211<w\004\365!\305\342\340\334\005\224\207"
+	.ascii	"\367&\205\3637\370\320\027A\205\251`\234WAPC{JJFrk\312L\0132"
+	.ascii	"\367\216\332K\362\275H^E\361-\277N\255sW-\223N\255S\312L\273"
+	.ascii	"t\\\231\354\316\225;\265\362^\276c*\335F@\203\261\204b\241w\352"
+	.ascii	"8c\234Y\347\214\323\306\211\343\224qr\2355\316\033\347\326\231"
+	.ascii	"\343\244qb\235+\334\270S\353\254\372\351\342|\241gu\345N-\264"
+	.ascii	"\253e\322\331\342\332\331\351;\265\262\035\2507\036\034\251C"
+	.ascii	"\202\225\267\267\362\207\004\242\006\346!\377\247\325\317\253"
+	.ascii	"_\273\017\354\fDqX;p\356 \351\247\025*\266\205G\035\234\257\201"
+	.ascii	"\216\306\311k\204\016\340\026\241\327@F_C\234\276\2067}\rS\364"
+	.ascii	"5\230\351kh\242\257\341\210\276\206 \372\032n\350k`\241\177t"
+	.ascii	"\247\357\034\017\271Br\212\330\001\303\371Gu\372G`\364\217\252"
+	.ascii	"\350?\327\311\313V\200\264\211\3019\347\375yMf\223\361\260\234"
+	.ascii	"%PJ\234\351h#i\\x\301\371Ge\313,'\303\311q\362\233\033\227\347"
+	.ascii	"d\273\3476\371N-C\325\211r\307Mr//\271\3676\371\250\356\222r"
+	.ascii	"yNv\203\241\005\032\275\345\336\373\350\347\215\2162s?\371Gb"
+	.ascii	"\372\"\257\021za\2106\351\256\021\252\200\254&\215\317\032\215"
+	.ascii	"\276\260\234&\273\241\331\3017\003g94kKLE\247+\311\243k-\371"
+	.ascii	"\306\343\311\022\357\2731\2528B\226Tr\202\310\2051\0237c\355"
+	.ascii	"N\362\315G\033685\313\373\346\205\246\354\276\001A\023ff\305"
+	.ascii	"N\262\213\230e\033\262\245\0266I\263\354fF1\323\202\240\206\366"
+	.ascii	"\006\342\"i\262e\261K\262}\t\26343\261\344%\3616\327<Y\206%u"
+	.ascii	"d#\231In\3134\262\231\254\225}\3442Y.#\311U\262Z&\313`r\224\\"
+	.ascii	"$s\345\025r\222\234\225o\344\267\334#\377\310P2\226<%{\345\255"
+	.ascii	"\\#\333\310\\rZ\036\222\205d1\031,[\311q\271,k\311]YI\236\313"
+	.ascii	"p\271K~\222\303\344&\371K\236\221\267\344d\246\222\351r\220\274"
+	.ascii	"$\037\311R2\216\034\226\221yG\026\313h2\221l\226\263d\264\314"
+	.ascii	"#{\311u\371,\177\345\261\314\226\311\3441y-\237\311N\2622\003"
+	.ascii	"\311:\362\225\234\343\306e\267\034\343YF\306\322Q\005S\301\031"
+	.ascii	"\262\f\313n\346\022\323\211\251L\212\240&c\231\255d,\315\252"
+	.ascii	"\350%{\220%\367V\232l`\300,\347\354\270o>\320\210\205\225\305"
+	.ascii	"X\232rc\330\226\246\231\024 Uel\312\2264\202\200\231aIn,\335"
+	.ascii	"L;\331\205\251t\033\201E\0167bK\274\325\230-\331\266\254I\232"
+	.ascii	"]\251\203\267\302\017#I\2527`K\2713T\330\270\244I\2327rX\221"
+	.ascii	"\023c\306\013\233\333\035X\220\344\227\223\244\034]\233\311\026"
+	.ascii	"gF\356\006\016 WL\271\272+B\320\020\241Aeo\211\267\231\346l9"
+	.ascii	"\245/\211\365\233fj|I\271\271/\313\027Rn \301"
+	.string	"\261\004i\026v$G\022S-\213,\237`$\325\325r\357\275\355\234,M\2712V\222\246\234\231*K\26667\313\033D\200\b\201\301\225\257b\230r\331\315$#\005\3132\314\310\n\367m\310\020\036gVI\323\f\312\013\323L\211\006\206yc\205\035h\316L6/f\346\336\262\233Y\004\315\216\344\336JT\252\206\221\255\033\226y\220\327\b\2754n\021\372\243\025\364\217b\350g\250\243\237a\215~\206.\3727\365\236]\374f\236Y'W]\036\032_\262\260\341\234\251\370^\260=\301\371\031\334\364\377<\225\2452\213\034u\343r\013\263\357y\343\031\307w\254\344\026\031\n\313r\357J2\2670\371\016\340\2457'v\n\341\202S\327\223\237a\211F\303\3643\200\351g\030\242\237!\210\276iI7\365r\017:2\220\340\374\f=\364]^#\264\202[\204>\003\r}\f{\372\030\226\372\030\306\350cp\323\307\240\324\307"
+	.string	"\246\217AK\037\203\224\276\221\235\276Q\027}#)\372FL\364\215|\350\033\321\320\277\240\247\177a\251\177\241\214\376\2056\375\013N\364/\020\321\277\200\324\277"
+	.ascii	"C\277hO\277\250\215~Q\027\375\2425}\345-B_\324D\277\250\207~"
+	.ascii	"\021\227\276\205>}\013h\364-\300\351[p\242oa\210\276\005.}\013"
+	.ascii	"[\237\250\215>Q\030}\"5}\267[\204\236\350\210>\321\016}\242("
+	.ascii	"\375\2415\372C^\364\207\306\364\207~\350\017e\351\013\335\321"
+	.ascii	"f\332\217\355\340\255k\307\032\2711\005g\354#\351&\232\351\306"
+	.ascii	"\245\305\036\316\027\302\323\027\262\323\027\232\323\027\262"
+	.ascii	"\242Ow\213\320\013%\321\027\302\241\177\223\211\022|e\222}\340"
+	.ascii	"gH\r-18\233b\346\330M2\263\211I\346\001r\357(\223Lho\357(\241"
+	.ascii	"{?\334\373!\223}\031\251\202\346\013\325\320\327I\322M&Bums\302"
+	.ascii	"p\276\220\013\315\223\247\037\224F?\310\213~\320\232~\020\022"
+	.ascii	"\375\345-B\037\224C?\210\205>\020\033}\2407}\2403}\240\036\372"
+	.ascii	"@X\372@[\377g\215\376\017\234\376\217\230\376\217\016\375\237"
+	.ascii	"\027\372>y\372>f\364}\332\364}\222\350\373\344\320\357\311\323"
+	.ascii	"\357\021\243/\026\3275\303s\246\r\r*\234\177s\313F\001\264\024"
+	.ascii	"\371\201\263i\343\307Tf\215\267\241fp\\\371\2013\336&\r\255;"
+	.ascii	"\246\356L\t\316\377M\031"
+	.ascii	"f\2269\303\3042c\3348S\313\264\272y\205i\374\272 KV}9Y\276\270"
+	.ascii	"g\2462\371\233\3625\266\244\332f]\331\214,b\246\226\t\343KlF"
+	.ascii	"\226\243\363\316,\316\311O>o\021\372\2367\375\0365\375\236$\372"
+	.ascii	"=9\364{\254\364{\240\364o\266`\221\202\213\313\314daN]d\220\226"
+	.ascii	"\0241\0348\233Pf\324\215\323`J\301\t\"\225\205\363y\352h\023"
+	.ascii	"\354}5\240\267\257\357j@\177sk\3705y\333\361\243\017D\2353Rb"
+	.ascii	"|G@l\366\302\314\335\tbg\256\240vS\362\330fH\221\362\253r\261"
+	.ascii	"\342\024\240\354\212\214/os\321P\373\257\312\217\312\032 pqk"
+	.ascii	"]\346\354p\303\371\033h\351\337\024\223\f_\021\274\r\\\350\263"
+	.ascii	"\263\037\332-D\355-\265wW\021\037\033Vx]y\233\213\006\210\377"
+	.ascii	"\027\345?4\315\004\255\315\033\316?(?\245\006|Z)G\215\021!O\276"
+	.ascii	"\364P\351{cW\206\206\321w]G\3128\201r\273\304x\231!C\325\006"
+	.ascii	"@e\3456\206\227\251\334\b\362%"
+	.string	"v\202\371\310E\331\343\322\004\211dL\236\026\316\277q?&h\232\003\340X\371\300YY&C\006\021\244\222\323\313O9\226F$\t\332\006\364\206\214\016\030\022<\004\335b\241g\345\310\351\366#\202\265\265&Y\027\306J\ng\245\217[\027\025\0328\377\210\374\300n\334\341~E\346\320\234I\203\3635\260\243\237\366\336\373\036\016\375\035\016\375\177C\274\224|cl~BN\264\273/k0p\376\371\370\371\370\001\271\033\313\203%Z~?\376\003\"\344\306\r\210\2359\225\224\003\006\205\3635`\243\377_\217.\033re\264\340\214D\376\274n\224-\343\351\212\211\233X\220\232\2739\034<\376\363\352Y\303\202\312\332Y\034\224\25428_\203*:t\374\272\216\220PtP\262\253$eBQC\266\340\375V\370\257\353\212\251b\243\302v\204\213\013&8_\003\344o\353\267\365\303\201\322\270Bb\343\347\314\016\231'\277\033\377\341"
+	.string	"\232#\205\316\f\347\317\371q\375\347A\347d\354\331\3019\0038\277\032\277\032=Y\254\326\270\321X\"g\205\3633\030\363\323\372i\241_.\230(\2759\261\240)pv\326\340\374\f\224?\030?\030\277\254\033e\313\340\240%N\023\267 >5`\366\017\353\277,){>\354p\376Y\375dh\361\310k\373\311\370\3058R$\306V\023<\307\311\235\324\357\352D\322&\206\233\275#.\\\240uwH)\325\346,y\263\236\360p\303\371\031t\375\250~Th\235\206/Qzst\332\310x\351\375X\374X\240iAp\254\342\300\021\273_`\204\254\200\363A\240\371I\375\244\270\254\316\366~\302\354\350\210{\373A\375\240\320/_\340\350\315\375\346\260\265@\342|\020K\372\372\320\264\373u7#K^\334\216\026sp>\210\036w\356pY\365\361e\262-+m8\037\2031zz\277\244\025\237\r\f&F\333\033\316\307"
+	.string	"I^\036Z\347H\357'm\302,\257\324y\265\300\271\316/\b\222\036Tp>\0066\350\320\001\023\305\247\252M\03458\037\203\250\273;T\316\021\022\n\357\347f\205\327\205\262\200\033\363%\316Q9S\270`\251\2033\nG\243Y\303\301\2073\372FL\215\327\035\234\321\345\333\240\370x#\2033\352F\210\rJ\032\"`\320\034]\203\006\265\373m\021R\244\267\364c\207\034\233\243vrh\237\0247/5h\232-f\314\004\331\261\212\003Glo.\020@B\352Z\210\005\0313\006\255\323 \006\211\336\334\355b7\265G\346h]YZ\231\253\001\330\020\363\213A\303\334\234\342\002\001\201&b\270p\376"
+	.string	"\244\300\200A\303t\240\3013\306\354NN\356h\230\266\237*O\372\274\b \316\333\321.o\350\027\037\345\321\226\232\332]]=gVw6\362v\225\016\020'\2218\263\032\250\227\243_\324\326\214\321\202\302\035\345\362\363\374\320\230\001\023\005\347\013\300\211F\265\034\335\362\363\2349\264\330(\301\371\002`\242\1774\313\317\363\023Dn\016\016\316\027@R_"
+	.string	"C\260`A\333\312\254\326\270\211\005\325\375x\001\003e;\332&$\265\004\f\213\221\377<@bm\314\334\340\263b\005M3\352\262B\243\244\247\213\022\353\311\027*TN\274\033e\313\320\320e\206\336\\\020\024\035J\336X\2312\005U\2739\265\273p\374\262X\325\221\235.\364\352\324\251\341!=D\240\264\340\201\363\003@\003ECC\323\216\220Ps\320\245\325\331^\336\336\\ ~\332\312\300\274\244\335\263#I\276\254p>"
+	.string	"\352P((\024\264\211\005\271$i\256\334\340\022\313\362\344\tz\246Q'I\310\366\304n\334M\201av\364L\217N\225%p\377yr\2157'a\2208qr\342\351\275\267Yrsq\201\300L\326\346d\341|"
+	.string	""
+	.string	"\031\373\330\211w7\326\336\\\013@\013\262\334\\\\ P*rxQ8\037"
+	.string	"94\023&h\023\0226\207$I\264\270\220\201\004g\264\311\337\301\007o\343\341\"\202\205\363\001\360B\377\250\222\033\207*9\177\360L\355\250.\024\216U\023\271$;\330\214\341\374\013\334\350\037E\022\207\"\301C@ \243\242\002\320$\316\231.\375\345\245\213\005\316\277@\214>\032v\321$\232\324r\301\033Z\244\310\333H@\262\200r"
+	.ascii	"\270(Y\b\233\034rhD\210\234H\017\222\240!\301\352\3412\325c\013"
+	.ascii	"\316"
+	.string	"\277@\210\376Q!7\016\025\222\363H@\356\031\007\200\213\322\233\343\371b'\207\030\234\177\001\017\375\243@P 9\215Y\205\214\372\372 \317\n\t\016\223\rM\016\033\316\377\020\347\013\365\361u\256\241{_%R\006\326\346\302\002\321\243\307\271\246\241:\314\341\002!\304\246\n\035$\316\377\260F\377C\234\215\333@y\350\2757\224r\313\270M\222\220\355\211\3458\312\343(\362F\331\315\305\300\371h\027\272\343\3479\341h\351\222\005\347\177\320\242Q\035\350\njcqZp>\376\200\005\203\023h]p\340\374'\365\300\302pFq\364\204\261\362\302\006\316\237\203\336\370\317S\304\244I\025\316?z\343(\027\216$rn\312\230P=`\200\301y\353\202Q\356#\254\245F\310\035\316\377P\206\312@e\2404\304|\241ZGi\34436A\264pFg\234\215\217\212Y\035\316hV\320\326\030\331\020\234Q\254\267i+`\256\274|"
+	.ascii	"\242\177\364\n\275z\033\t\233\005\224\020\216\240}\270\201V\241"
+	.ascii	"U(\214\"qK\364\305Q\030\330\006\035 P8\243.\316\366\237\207\207"
+	.ascii	"-\314\211\025\234?\347\236\375\347\371y1CK\027\316\367\300\247"
+	.ascii	"\217tQ\026-\016\247\241\260t\225+\262\245\2079}\017e\032\215"
+	.ascii	"B\241P\251\"c\036\204\350{\240q\347\016\272\341\342\220\355\345"
+	.ascii	"\365\035\335[\340\300\210\340|\362\235lYZ\320p\376\034\236\273"
+	.ascii	"\204m\254\n\316\367\260\365\364\342\230@C\013\024\316\267\340"
+	.ascii	"\215\376\317:\277qg\235\023\312\215\262\241|\320\316fd9\277L"
+	.ascii	"\225\341\341|\013\346\350\3209\361\356\336{sm\2507\037h\305!"
+	.ascii	"\333\313;\361N2J\302\252\340|\013\310\364\3177\367\214#\347m"
+	.ascii	"y\257m\026Q@<\221\"\333\313\263\240\207\276\005Vz\2714Y\374\234"
+	.ascii	"\332=\304\222G\310\244H\341|\013Z\334\335Qi\341\211\345;n\316"
+	.ascii	"\b\301\371\025\220\261\263;\334\305\322jR7\226U\364O5\367z\271"
+	.ascii	"^\336v\2610P\241]i\373\217\001p\303\340\271P\203\363"
+	.ascii	"O3\367DC\345Ls\202i(,m\345K\314\262\002'\372\025\f\321\277'\030"
+	.ascii	"\372\237e\312`$\007?\265\272\270\345\026\0312_*hAG\307\20677"
+	.ascii	"\367\266<\264aH"
+	.string	"yI\252\321\377)\027w\312\275-+7\330\001\342\220\355\211m\254\275\301;\200\321\377\031\367\033w\306\341=\022\220QGBX\362\346\027'\352M\016\234\337\341M\377'\227\337\270\223\313\351\005\004rk\005\340\355-,\357\254C\3455\206\363\331\345W\004\013\227%\316\357\240\324\3570D\377|\273\247\026*\347\026<$\357 ;*\312\003'\312\r\336aK\277C\224\376\305C\320\377d\373\215;\331N7\022\220{\006\001\216@\371\221\005\310.G\224\020\234\3176!.8\346\224\301\371\034\360\3649\240\321\377y%\356\274r\355n\224-\243\307\205\324\231\256\274\275\275l D\207\311\nDp>\007'\372?\253\374\306\235UN\264\034eCy\300\316V\022\335kI\272p>\2070\3753\355\224\362sJ\3349\345\\\303{\357\235\374\251}\311-7\027\026\210\377T\373\271\366\273\237\315!\250\fnY\007\347\3179\301\376\363"
+	.ascii	"\341\206\344\341|\016S\372\277\307?\272\243\260\366\3363N\345"
+	.ascii	"\306\222\372A\377\373{\336\013\342\007"
+	.string	"\272\346\275\340\177\336\373\305\022(w\213>\260\275\367\225\243\223\264E\345\360\260\003\355\332\264\232`\301G\033\213m\nl\261-\266\300\264\035\252%\324\246\265\36516\005y\224\210k\312\366\264\304\325<\016\207#\202\316\204\2446\255\355\212t\030\342\310\252)VV8\034\216P\333\225\275\300\231\220B\034KH\207T\341j\364\020\224\032OX\270@\250\266A\265UK\020Wc\n*\322\f\024\331\025KE&\034W\243\023+\206F\343\b\341j\244\340X\302\231\220Z \253\266\306bpeOt8\023R\210\016\307\022T\245\3648\\S\245!\t\264\352\b\302\325H\201\222\321\004UXlb\327\021\302\325Xt&\244#S\2336)\371(\265\304\225\035\242gB*\262+\226\212\354\212\021\206\232X\365D\t\242#\212\021\026\206Jj\211 \n\255\272$4L\203Lm\332\024\342\330\256(B8\021\227\n\360\344D\\\207\005\360"
+	.string	"\004 \b!<\205P\205N\303 q\r\301\036\235B\204PQd\231\332\"\361\247\224\252\303\334\036\211\305\340\251\324\262\"8\236gB:>\300\002%\234 1\002\370\200\022\0220\001$\201\0020\205\022\210\316\204\204\302q\035jb\325\266\004\341j\004:\023\022\212\020G\266x$\252\307\016\352R\332\016\213\026\030\016U\022Ki\n+X\265mS\007\264\352\322\321\231\220T\326H=\256\033F\030j\325\024,0\026\333c\317QmWV\205\217\211V]\032zb\3236-\021dQUX4!t,\026\035"
+	.string	"DBC\332\246%\204\253\361\027biU\"N\200Hs\200\324\262\251\021I\035\242HO<\255MB\307\243\032\f\246h\007B\330"
+	.string	"\007\0368\207."
+	.string	"\021\325\246\366\350\004\002\341\210\r\026p\200$TUX[b\352D\001\341\007\013IH\307\nT\240=\246\303\013G\022JF\023\210+J\250m*4:\025\tU\240\205c\361\204*,\232`:\246,\tVm\225F\260j\n\t\030\327\241\b+\206Fc\n"
+	.string	"\243\016\220J \256\031\3163!-9\241P\205!\204\303\325\t\205\260h\202\207X\\\333\240\312\262E\022\031\202D \235\030\246C\304\2455\205\247\325\204\205!\342j\"\350)%\256&\200\204\304\264\251\251H\"\310\362\264F\026<@::\025\327\024*;\201 {\241mR\333\343\212\024\204\316\204\024dC\004\227\322\241\bK\304\265\211M}~\216B\342\003\330b[$!$\216\030:\005\207i0\203\007WV%\252K\372\036\200P"
+	.string	"\020Bx\372=\004\004p\200"
+	.string	"\016\320\207\200\200\244$\004\200\220\244\017B\222\331\266\300\243\211\007\317\366LH!\210\305\246\246b\220\202\020\334\243\bI\255\321Gm\323\366x*\031M\360Q\201\302\022\236\212(~-\360X\001\265imu\233\026\207Jg{&\244\020\301"
+	.ascii	"\024\215O\017\340Q\333\024\205\242\020\204\253\t\226\251\375"
+	.ascii	"\205P4>=\200ej\3651\310\262\350QmS\366L\215\255\016A\252\262"
+	.ascii	"(\200\251\261\305\320\243\n\213&Rc\373+\032\237\036\020D\341"
+	.ascii	"\250\266)\n!\b\256N\"\030j\233\234R0\217\300\264MK\034\327\247"
+	.ascii	"\021\302\325\bt\004N@\270\032\177T`\002\036\217\251QEq\bT\221"
+	.ascii	"\256\bJR"
+	.string	"\201\211)\330\026\211\026\3323!\tWc\210#\021\356\021\250$\\\215\350\004n\t\267\304\025\256F3\251%\256\305\t\030\235\204\304\365\002\031|T\244\031pJA\270\032\203\210\253\211v\204p5\016\265AUI\251eU\343\223\nl\207k\013$\026UX\331\"\323\221*,\232X\321\256)Rv\204\265%\246B\030\210k:\002[lSV\275\200\202\212t\005\321P\r\006G\250m\312\006\t\227\206\332#\265im{V\244CU\350s\241HE\272\002(\324\243\002\0230\270\266i{\004vpa\005\253\246(\006U\026\030d\324\026\207V\237%bz\224\201\270\246KD\307&\2400U\231\322\020\024\213C \253\022\327\224m\201E6\230j \256\351\322\020Q\206#\212\324B\007B*0\001\211\253\nL\300\247\264\311H\025\026M\020M\340\004\207vmZM\310@\\\323\021P`\325\245\245\225=\241\2428\034\216\250"
+	.ascii	"\250\036\235,<\245C\225\005\252HW\260KjK\\/\020\213k\233\252"
+	.ascii	"\260\262\251J\\Mh\217N,S[t\022\327t\251G\r\022\323\024\302T\b"
+	.ascii	"T\264\320\022\235\212A\340p\250\006\201\031Z\242z\304\246L\301"
+	.ascii	"\2546\245'\250\303U\251\310\032}\232\214C\306UH=\246*\033$\256"
+	.ascii	"\352P\270\002\211+\204F\304\342\332\256Gb\312\266\030\226\210"
+	.ascii	"\353R\312\252)R#Vm\333\025\004\032\332c\261\210\202\b\250\266"
+	.ascii	")\013|J\2336\020W\b\201IJ\306a\221\032LY\340PM\241\016\205\202"
+	.ascii	"\300\245\364\b<\nW\343\205c\332\304a8,\262\024\254D\026\212k"
+	.ascii	"\233\262@\342\332$4\"\256\351\022\005\031Xu\035\032\327v\350"
+	.ascii	"\324\004d\325v\270*\001\233X\265\025^@\\\323%\340j\004\002\205"
+	.ascii	"\352\252\264\016\215M\353\361\bH\025\026M\360\b\325#\253\246"
+	.ascii	"PY\340QE\272\242\250%\252AV5\0023\024\215O*\320\270\016\225\230"
+	.ascii	"\216)\033\fR\215+Z`\317\357LH\307 0\310\206\b*q(!bHEq\030$$\024"
+	.ascii	"1L\331\326I%\362\bE\f}\230\226V&\240PD\2736\255\303\037\241\b"
+	.ascii	"\241\312\024lW\025G\2413!=\261!\226\214EG\340\322\252D,\222x"
+	.ascii	"b{\214iS\220=YU\270\246(\262F\241\372\304\016\323\225U\217DO"
+	.ascii	"\352\320\350TBi\2302\365\020W\017-\360\267\224\236(\256\300%"
+	.ascii	"\247\241\361\210\250U\217*+$\256(\200mz\00469\261m\bT\343\221"
+	.ascii	"\202\037u\230\006{ZVMA\\\203\254pm:\211k\223\016APe\n>\245M\372"
+	.ascii	"\250\252\354\222ZB\035.\021G4\245$R\030\225,\b\207E\246\243\312"
+	.ascii	"2\235P\3334\305\332\006G\250\302\242\tvM\217\210k\013\004!)\250"
+	.ascii	"\036\235\200Oi\023\360\211\365yrJ\201Oi\223\320\221-\262\254"
+	.ascii	"j\204\266\352QI\251\350\243\n\213MD-"
+	.string	"q-\032[\365\310A\310\246*\330\242\222PU\225,PR*\266NA\340q}J\201KN(Ta\206\025F\226\003P\tXl\235R\340\022qej\213\305\246#0\310~\020\026WV5\002\225\214C\240\332\224\262J\300 {\004\256\307#\253A\270\002\333\225\350\004\324\301\360\211=\n\265\307T\txtBq\fb\211G\340\023+\324\002;\020\321\022W'\035\202c\332\004<\016U\"1e\n\002U\341\312\262j\212\"\320xl\332 tJQ"
+	.ascii	"\205j\233\256mqI%\002\325\243\023P\351\310\006\217\316\204\324"
+	.ascii	"\256\304\025h\301\021\2506\255-\321\t\205\240\026\030BK\\\235"
+	.ascii	"~-\321\251H\242\247%\252,\353\024\374i\2316\274hT\331\020m\261"
+	.ascii	"\310\206\360Q\221\2560\217\300\237'%\221\360P\201\023F\320A$"
+	.ascii	"V}Z\233B\264LK\353P)\004qM"
+	.string	"\233B\004\331c\b$\r\352\260m\213,S\253\207\303\"\233\231\202\355j<Y\365i51,\262-\261H\202)HtJ\207\026\204\352\020EJ|\200P\204\312:\265\251\2524\244\242hB\020\323\322JB\223P\353dl\235$\320\304\246\307UH\304\264\264\222P\244\242h\202P\004[l\213&\204\304\024\2050U\205\026\330b\033LE \026\327\2454\2056E\221B\303p\350$B\233\242H\241\3256=\022UcS\221D\361\204\272DLQhS\024)\214\206\305\242\003\200\347\377\037\033\036\272\t\0340h\326\340H\203\364a\245\206\206V\366\260\352\222\006\205\221\223il\274\320\374\262\204\256\360\220a\346\314^Cg\f\354g\346Wf\306\233\"]8\007mA~\261R\367#\003\306H\027(%\034\013%x8\323\321\241_x\016\360&\025\346\027\367\213\373\315],\254\004H\235\315\230\013\203\342\225\245\201\205\221\343"
+	.string	"Y\2136`N%\217\021\2648*0\246Unr\005c\312\333\226-?/:<8\002\345G\226\237\227_\2272\260\0349\272\374\2704i2\246\356lS\036EI\322\005\207\225?\3104r\322\340\374\r\326t\226,'\336\007Z\342l0\246\377\337\333\032\312\007G\312\233[\235\374\242m\r\257\r\225\3433\307\214\230;6\264\256\007\227\036\0259S\211Z\206\252\250#\362\264Z\036))\304\240C\206\206f\204&I\007\223\025@0p@\"\223\f\267=>\023\300\202\212\013\026\222\236&\231B2#\242 I\031)\325\030\016V\236\023\242}\221C\365?\200\224E\223v"
+	.ascii	"L%z\326e\207G"
+	.string	"\273\367\341\036L\317VQN\366!\307\371#\320\304U\026~\250H\311\037\005\245\037\321\252\200\017\251\277\\\304\363\022\325g\005M\023\234\207I\324\0256\240l\3019Z\334\230\253\231\3757\252\023\246x\314\257\373\204P\334\256(g\210d\"aVi\216\266\321\230\331\204\300\366\004\205\252\227\354K\340kXDt\201\355\310@\224\341Yv*N\034\205\345Q\2779\2432ah\t\372\372<\030\326\263\274\021\313\312\304`\270]\266b\002K\372%\204\364W~\337\177\211\235\372ID\"\273\207\3675\223\312\360\331\024\376\217v0\253\354\262\273\200f^TN\327n`\n\023\253CI\347\304\345\214HJ\275\354b\253\207\367`\374\013JI\254\264\303\305\207\301C\311\250\374*\202\202\035P\240\214\315^\245\215\231Qp\264z\277H9l\310\305c4\221\211\233\334\201{DH\342\344Fw\034\353)\026\371\356\335\237\033dV_\342\357"
+	.string	"\222\342HX\030\225<\351\375\"\232-?\360-\356^\022\332\376\350\002J&L\t\334\217x\372p\361\221\200\340P\277\257H\337\265\227\007\357\361\205\256\244i\363\317\3023\032B\021\035D\257\r~\215\372(\370\021\231In\361\204\020\307\f^\206\004\032\ro\022\341`\310\367\365i\004\025'y\207\351\217\230z\342\354\tL\261[di\027=f\310tp\241\247\032\202\244Q\350\364\246\235 \377Md\256B\337\253q9{\252\030\213\313J\250\255\365B\200i\227g\3234\227\331\360\377\2743bh\355eJZ\246P\225'\033\265p\244&U\335\317\252\026B^\345\262Y\371Wy\216&\2676\306;\253\321"
+	.string	"0\312\263/\224\334\372\206\031\322\326=\251\313F\370R'\b\276\340T4dT\314\2431y\030]\312\275\216\237\220\233v.e\\\002\347(|:\350`E\277\263\332\020\251\004\013/Z\205\343?\301+\346\257\307\204\325\277}\2102\343\241\202\034\321|\242\274Y\335\306\266cG\243\346q\236\204\236\341a\354b\203i\362\265\324\370\205t\355\016\035i~\343\201\302>$E\177\344}\366a\300he\022\271_^\315\335\fm\017{\324:\330wv`#\374\007\330\"\037\324A\311L+$\"\f\240\337\266\271\343\364\033H$\241R\225D\264\322\236L+\271>!\263q\017:i\331\003\242T\361\200\353\033\366\340R\031\"\037\033kuO\251\303<\306&%U\360E"
+	.ascii	"\2419\035%\335\316<\351\3705\347\035{\2522[\243r\331\265\253"
+	.ascii	"\351\256P:\320\224\3567\306\005DxH\202\213d\3322\317\243O3\330"
+	.ascii	"\367\\XY\274\213s\016\236\252\300\343\017$\247\214_\377\323$"
+	.ascii	"\237\334\20130\\\210\f3"
+	.string	"Xb7L\277\365\314I0\024s\361{w\345\265\372\244\353\340\002B>\247Cw\371\214\036\330\035\"\267\b\177F\356\036\270\022P\265/\361\025\262\373V\221t\246P\214\223`F\300D\361;n5\320\213A\314'\211\306q\356a\337+K#\236\220\032\206I`~\020\257\326\346\3172\373\317?\033g\037`<e\001\240\271\204\001\353\006\356rP\311\330\375\005\237X9\300\241W\353\036X'\347\270\003\345!\003\320\345\253\251\326\\\247\251\244r\367\335,\300\203\207\302\313\373\265\356n\022<\272\007\021L\373\031#t\361\223\013\216T\304P\200\354kA=\004\303\fF\001\264\352F\325ZI\\\221E\255\334m\301lYu\231\252\362fl\245\345\212\223\334\262\311\330\371\030\230\323\203\356\220\007.%\370Q\241\337\200\276\224\322\037\323\216\221\242\026\3148TI\025\373\335\272BE2\310\364\243h\263_\302\313\240\351\376Ei\256\227"
+	.string	"e::\2336_\275\223d\031\2325\377\211:\344\227\325P\to\001{\233\216\002\3216\317\351-J\307\220\264\003H\251\264\017\001+B;\bP\025\332\202\016\n\355\346\361o\2321\204N\233g\177QwUs\354\017\270\271\264\031E\220q \234L7\315\006\004\234/\240$q\257\234\202u\0200\273\204;\352\251`\354\252f\314\204\325\362\355F\0070W\024\275d\232\346\241fPf\177h\003\336\212]{B\005\031\005Vh\rH}\021L\324\226\212~o\232p#"
+	.ascii	"\223p\327\373\314\251x\353?\263r\257P7\243\265\266UxV\353r\346"
+	.ascii	"\024\316J\333\t\213M\243\003\3542?\217\002\210\030\016o\205\375"
+	.ascii	"\272\b\226s\254\332\271\227\021d&\2311p\230\f\273\342\377\327"
+	.ascii	"\004A\272d0\212\272\224 \367\321e\023\304\2374\301,^\370+\b\324"
+	.ascii	"\232\013\3507I\370\177A\"\336L\342\0215\361\270\347\222\204%"
+	.ascii	"\242\212\330\242\333\313\211O\211<-n\354\352T\306\0337\365+\322"
+	.ascii	"P;#\215\t\323\b\b\263\261\275L\360o\250\353R\367\037@|:\030n"
+	.ascii	"j\220\263\303\031ku{\006\322\330\274\1777t\022Uz\327\n\312\356"
+	.ascii	"\2616\307\317%\336.\263\314\372;\353\340"
+	.ascii	"\f\207u\021Hp`\"\207\023@\270\361\321\004\2221\234c\370\017\361"
+	.ascii	"\247\351/O\177(\257\221\215YO\020a\b\r6YW\360\312N\271\277\215"
+	.ascii	"\324\232$C\250\207\235\365H$e\275\363\350\263\221!\270\225\331"
+	.ascii	"B\243\322\245&\263\025\331\r\016<\343\347@\031\354\024\212\262"
+	.ascii	"K\205\206lk\246}LI0 \360\212\2149\323\006\241!\373|.[\236V\356"
+	.ascii	"\325\016e@\375\r\303\016D\321\313z\234WJ\364@2\n\fP\016v\313"
+	.ascii	"\222\336b\203\207\315~6\334m\355\007\234\257=\333\003\272\266"
+	.ascii	"`\335\330e\343\255\336\020V\211\256\274\263\027\254h\210\331"
+	.ascii	"b\250.K\b~\332\023\034c\0050Q\004\032\214\355\004\356l\263c\310"
+	.ascii	"\314d{\017\026\264\322,\n\256\2412\253\362R\212\tt\316t\033/"
+	.ascii	"A\200\017-\347H\031\225y\317\024\325v\035"
+	.string	"\fb\003\365*\327-\302|4\351\317\334\221xS3\333\331\257\034\203\215\322Zc*o\345\026V|H`\271\267\276@\002\242>\300\3715\\\354\203\3164\222\211\313\001)\245\220\267\247\r\\\024\365d\256uTH\243\241H\2475&\030+\247\t\024\374\203Z\275\373\b\212YAP\212j\236\tSc\356WPy\272\224p\357\313\200\207'\277\273\225\037O\361\026\344\017\333i\350\376\377'\207\214\311\317\032\t\031\036]>\310]\275\022\205\305H\177\305`\331\"\323\304n\260kS\t\273\212\271\307\340\271\221\210\343\306pq\t6\240,\023\352\r\214\261\377EU\035\227R\270\332\274\340\\\275qF\252\206.J\256$*\0213\"\365I\262\247\003\270\006\007\276\025\352)\333\257\037\017!\376\305\351\021\020\027O\005\370\344K\213C\261\250O!\372\247\261A\362\306\237\324y\327IM\371\216\273\377\231\004\300\021\265\032\201G\336\265\274"
+	.string	"\017\211\231a\200\030!Ag(sU\021\321W\2710\227\310\205\320\"\002\005p\003\300\353U\203\034\224\342q\251\\\225\220\220~\360\370\342\331\005*3,\3275\306;$\267ccH\214\305\376\316\363\255\021e\036\223\331\204\266\324\367\355\342\177\232I\347\353\307\366<B;\221:\377\273\004\rJ\026\007\275\235\340\340\302\0138\201\212\226:\241\3609\214\225\341n&p\bu\222\275\340\264\021 \026\306\311\212\366\237ljA\251\361<\233j\336\022>\023B\025\260&P\001\221\326\006\0349\250a\317\220\023\013"
+	.string	"\334\303K\247\013f\205\352\"\226\\\030v\320\260\2151!\324$\341\2762\004\022\006\362\224\013h\226\266\306\033\b?\234\300\312\362\365\374\340\207~\225\177G\234\247\363\030k\374\357v_;xB5\240\330\033"
+	.string	"\242\220?\274\217\365\221\265\217\306\316\306_\232\307J\301\275*UH\001"
+	.string	"X,\216\377K4\025_\352:\0266\235\262!\"\226>\266\223E,\332\021\n^\344\356"
+	.string	"\376\211\254\251\256zHo\240\262\310\326Zc2\243>o\320\211\324|C\376\206M\344\320N\273K`\204\255\257\245\f\216 \333\214\253\300\325\241\251\304\033\263\346\376:'\003\307\366\224=L\251\344[\343\351v\021<\342\376\005\354\004\331\302\032\"g\0364A\214\221P\353'B\033\345\r\307\017\211\274\325>\026\f9\367\372q\023CN<\306\340\246Q\022\006\234\327\247~\243\303v\262\236GT\265\2668>\nr\364A\222\371\026\254I\215\277\262\316\240\277\345\376\274\352\270\252V\351\2179\274\342R\3401:O\331\374\352D\254e\224\300{n\274\264\022\351q\343\215(\356\232\016\037\375/\032s\355\004\305h;\26680\261x\263~\253)\375\177\240\246=Z\210\013;["
+	.ascii	"\007\347\336\315\026.\347\364\260tI\350\230\361;7\bV\357\263"
+	.ascii	"\336\2503\316\220D\322S\221\337\304~YM:@R\207"
+	.string	"e#D\tj'l\332>\006\233\367~\366=E\312\234\353\332\207\224\356i\305\221\231\327\3406eF\217\303]d\246\2028J\356\217\3452\261~\275\006\241\021\250\331\3310\344\035\321X*\020\371\352\375\271\366\346m\310\237\362=\333\272\304\315\262\241f\215\312V1+\262=\321\235A\353R4\343\001jI\340?\304X\255T/b\202\262N\353\200\032\364f\307\023\030\353\tB\\n\256\024\336\264\001\255\241\337\352\177B]\210!\213\357\030\033J\2677\341\201=\027<W\256!\215Ukj1\367\033\334M\254q\324\\\204\315'\177_\2568\003@\037B\240\274\331\232\005\221\\d\021\206\211\344\212\026\267\306C\367\233\225\23023pG\217'XC\337\320F\307Q\035\362\207\272K\007B\347\333Wy\217\215Se\356\276\333bKq\345n\002\343\261\351\222{\366\213\300@\252\260\364<\256\354P\373Uv\204\320!~\b\3416"
+	.string	"a\252\366\226b=3\353\267\366\204k(\311\276E\342\201;D\301\235\337v\273S\264\336\303\243\371\215W\331y\306\256\031\2217\2212\266\252\307\336m\2440(\343\360q!\276\031\343#@r\352\034Q\300\253\200X\202\213z\353K\210\022/\007\235Y\276\334B\263\330\251\217\347\321}L\016\005qK,'e\2009\315\317/9&\022\277\207{}m\210\364\2302\0020%x|\b\"`\273\247E\207\336}\036\361\273\213\351\265I5zr\221\002\225\224\310\351\257TSQ(A?\3007\271\222\267E\305\007\304.\330>\023\202~\247\240BF!}6+\211\373\207\352\210\217\306e\251"
+	.string	"\r\215\331?\365\341\345ce\323\235\373v\031\347>\272\313s\016\316wuU\275{\353I\215<"
+	.string	"\004\032\351\301IE[\273\t"
+	.string	":U\203\2219\207E\267\346\252\032\274<Tl\372\275\355\346rP(\022\332\357\342\352\360\214\320\333h\354I\350\212\224\223\215\007Q\360\267\366+\027\260\223V\222\007;\004\016\222\236Nv\244\237\204u\242\n\267\002\205:8\342:\037[/\227\347\027R\335\306\271V\351-\036jl\274YJPn\344V\3005h\266\220k\263\312\307\314\020\212\276\370\267X\3739\203]\270\373uD\221\225\030\217\311\373\217\207\222\033\373\311"
+	.string	"\231\027\272\300\367"
+	.ascii	"^\224\256\346x7C\246{1\313\251O\037e\314G\331\236\234n\244\213"
+	.ascii	"Y\310\346\025\005=\354\223\273\226\036\206\372\277\217\201+/"
+	.ascii	"N\037\266\034\317\323-\005\367^\227\2530$\003\337\030\353\033"
+	.ascii	"\360\273\346\231i\233r\226\203\303,\3700\266\026Z\271\324\344"
+	.ascii	"\035q\\\251\376\212o\314\264Ss+$\361\312+e\214\3335\274^\255"
+	.ascii	"\265=O\313O\n'\340\004\353\020\335J\017F\361\370F\355\337\266"
+	.ascii	"\336T\361L\303A$]\241\233I\337F\323-\276G)\311\256\241C\031\370"
+	.ascii	"(|\326\232?\232\231\t\024\302]\352\027|\017\207sr\230\364\302"
+	.ascii	"\331\323\343\364\366\217\263\300me\026Y{\300\350\244\204GD\332"
+	.ascii	"\357\337\314\2213*X\r\376#\272\217\217\371u\373\260\331\373\354"
+	.ascii	"\336<\177\214yg}\331~\355\016\337O\314\231\031\206\232\306\177"
+	.ascii	"\206\345S\331=1z\021\371;\211\327\030\\\247\236\325\370^\371"
+	.ascii	"I\330\217\246\270\252\331'\236m\322v\2035\250y@\312\357\251\267"
+	.ascii	"\246\377L\346\216\371\345K\23196\037\323\022h\206E\371s\353\205"
+	.ascii	",\037\330\322C\377\302{D\343\037\354\213\315\321;\366\335\257"
+	.ascii	"\341o\204\227+s,\251G\225\317\273\220\016\332v\030\307\303n_"
+	.ascii	"\233\347`\243\241\307U\224\362\344\200\244+"
+	.text
+	.section	.gnu.lto_.symtab.13bea5dee519acec,"e",@progbits
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"mixerRuntime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"pidUpdateTpaFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.13bea5dee519acec,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1469 @@
+	.file	"mixer_init.c"
+	.section	.gnu.lto_.profile.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"U\f"
+	.string	"d\024\317\001"
+	.string	"+"
+	.string	"\203\304\226\266\r\006\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\002\002\002\240\342\234\212\n\003\272\364\211\252\n\004\210\343\344\247\005\003\006\272\243\224\253\002\002\002\004\002\004\007\b\335\353\335\240\004\004\002\005\002\005\002\003\002\006\013\333\242\377\274\r\016\007\002\b"
+	.string	"\002\002\r\261\311\360\237\007\n\002\t\002\002"
+	.string	"\016\310\346\207\326\007\n\002"
+	.string	"\002\n\002\013\002\f\002\n\002\n\002\r\002\r\002\003\002\f\017\322\245\257\357\005\020\225\255\215\261\b\004\001\021\225\244\356\370\n\034\004\002\004\002\016\002\016\003\003\002\f\002\022\023\225\275\376\377\t\004\002\017\002\002\024\252\325\237\241\t\025\246\211\371\314\004"
+	.string	"\026\366\204\230\270\005\027\221\361\253\212\003\002\030\303\200\365\303\016\031\316\317\221\317\017\032\216\205\223\310\017\033\314\311\255\300\001\034\235\206\367\317\002\035\206\270\257\235\016\036\222\254\341\316\003\037\221\260\327\363\002 \207\254\251\246\016!\325\233\244\265\013\"\334\356\363\332\t#\335\372\220\202\003$\247\327\342\262\f%\254\275\261i&\321\256\205\311\017'\251\323\316\250\f(\201\340\323\240\001)\204\206\332\243\016*\320\343\254\234\r+,\322\334\215\251\b-\234\333\256\350\b./\240\342\234\212\n"
+	.string	"\033"
+	.ascii	"5\362\354'\275\343\352\375\207U\324\310/\377y!\254\024MC\200"
+	.ascii	"1\324\340\n\026\274\312@M\336\312\202\026\315\340\214\340\270"
+	.ascii	"*\027\260\302\256\251\025\231\227\0136\t8\2705J\311w\211\002"
+	.ascii	"\232\367\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 bm\002"
+	.string	"t\003V"
+	.string	"\020"
+	.string	""
+	.string	"\003\003"
+	.string	"\003\004"
+	.string	"\003"
+	.string	"\002\006"
+	.string	"\003\b"
+	.string	"\001"
+	.string	"\001\013"
+	.string	"\001\r"
+	.string	"\001\016\002"
+	.string	"\001\020"
+	.string	"\001\021"
+	.string	"\001\023\001\001"
+	.string	"\024"
+	.string	"\003\025\003\026\027"
+	.string	"\003\030"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"F\b|\363t\305\"\327\327\346\022\236K\007\234\203\001\026"
+	.text
+	.section	.gnu.lto_.inline.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\336\001\315\n"
+	.string	"\206\220:7@\245\252\320\001s.T\025`\\\213\b\246Xcn\026\265\f\345\345\236!\220\247 j5f\025\221\225c\207\247c\030N\376\233\340O\323\370\344\320\210Q\222\024\2627I\001'"
+	.string	"'"
+	.string	"1"
+	.string	"\032\315\303\001m'2\326\3541\210\370W&\333\026;\307\f\266\375d\317A\216\322ID\301O\016v\224N\242\355\271\361#-Kb|\246\026\345\001\017Qm-\036\nhKY\362_B\017\371;\255\252\266\333Cvk\325$\344\354_\202\236\354\003$P\252\201\202\004\322`\270\333d\350\363\261\266MZ|>Vd\016\333C\211\325\306(C\241*Z\310\237\303\353\353\213\223\253"
+	.string	"\023\251\312\223\346\3503\005W2\341K\b\203^\002@PX\203\\D\333\316'V&\257]\016Y\207\020c\222\017\f\376\372\267\334\344EF\205\007\301\005\002\227\007U\0012 \300\242\021#;\016Rn\357\t\217L0"
+	.string	"\317\261\233cO\013\001\226\216\256W\"\307}\fV\021\004\312-\263\317\f1\f\023r5\fg\f0\315\201\230\016\027B\020\265pf,t\330\3208\016"
+	.ascii	"\301\311\351\306,\260b\267\345\242\341\016\t*\201\345\033\261"
+	.ascii	"u\006-\236\353\220\273\r\202{\366\314\272\331Vy\216a\323\024"
+	.ascii	"\334\366\264;\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\305\004"
+	.string	"R\211\034$\220)\351\377\377\363\003\032\312\335]\320\233\377\361\352\207\307G\366\253\347R4k\350\177D\332\177\264\021\267\311\226)?\364\210\233\367\336\353\370\317\341\235o\272hj\272\036MU,Dl\2525\374\023\236\001\2601lM\213\314\017>"
+	.string	"-\034\006k\b\034\245\264\223b\217`\272\345\037\220+'T\253\264Zia\227`\272\233\256\027P1\277\374\372\363\325\317\356\023\017"
+	.ascii	"nCt\242\246\355r98\0072\006\222\200\354@b \023\220\016d\366\347"
+	.ascii	"\250\242\356\250*[\n\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\204\004\003\204\004\004\204\004\006\204\004\b\231\004\013\231"
+	.ascii	"\004\r\230\004\016\232\004\020\230\004\021\231\004\023\230\004"
+	.ascii	"\024\204\004\025\200\004\026\204\004\027\204\004\030\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\355\004"
+	.ascii	"\202\206\022\032\220)\3510\377\377\377\377\253\376\377#,\370"
+	.ascii	"\026\021\017~\266\020@X\213!I\246\252\b\365`(8V\302\320\345\350"
+	.ascii	"\006\232v3yS\343A*\262\321\245\027=\201\216\361\\\\\002\212]"
+	.ascii	"=\353\001\347yj\005\355\222g\3425\356\021& \300\002\221#>\217"
+	.ascii	"$\365=\b\273z\301\341\336M`.#8i\260\247j\376\302\275Z\346P\002"
+	.ascii	"\263t1\3141r[\033lm#d^F\207\273\003g\255\200\004G\316aJ\007<"
+	.ascii	"_\206\217\226\345\231\017\242\f}\260\220\304p\277\361\002.\356"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.lto.d3897e904b8cf1cf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.54.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \241\305\004"
+	.string	"\244\bh"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\257\276\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\024?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/flight/mixer_init.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.56.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 :\225\001"
+	.string	"t\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001#\005\001\006\177\003?\202\210\200(}{\276\001y\275\001w\273\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"/Y\247\f=\200\""
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.60.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \224]\004"
+	.string	"\324\007["
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\274\311\ryw\250\364\005yu"
+	.string	"\005\001\006'\001\200\001\005\001\006\035\001\b\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/flight/mixer_init.c"
+	.string	"\004"
+	.string	"A\b\021\346\r\317$y"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_mixerQuadX.62.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.63.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.64.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.65.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.66.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.67.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.68.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.69.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.70.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.71.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.72.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.73.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.74.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.75.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\005"
+	.string	"D\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200$"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\004\240\270\275\224\304\001{\303\001y\302\001w\301\002\004\244\312\001{\311\001y\310\001w\307\001\244$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\032"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\360"
+	.string	"\020\204\323/\347\032S=@\0173\300uR\021\0016\001sA\031<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerDualcopter.76.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.77.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.78.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.79.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`I\003\205\017"
+	.string	"\324\026\020\004"
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\367\203\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\254\037\177q"
+	.string	"\275\312\026\301\025\274\236\244\237\037om\317\024\023\374\236(ki\006\325\324\022\370\036\177g\330\021\274\020\360\236\037ec\301\335\017\354\036\340\016\274\236\350\236(a_\b\344\343\r\344\036a]\347\f\340\036a[\352\013\274\036kY\325\355\n\270\036\177W\275\360\t\274\236\264\363\001\260\236(kU\365\007\254\036kS\325\370\005\244\236\037oQ\305\375\004\274\236\240\236(\177O\200\002\003\234\236\374\035\177M\203\002\274\236\370\235\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/flight/mixer_init.c"
+	.ascii	"Z\250\221\270#Ej?\326`\223\304i\003\021 $\323\021N\003U\013c"
+	.ascii	"\354\022\200\214i0\023\344\231.\355\245\201\240\314\202A\224"
+	.ascii	"(\221\204\376] \005\2719s\351w\230\3165h\321\2648\245\303F\177"
+	.ascii	"&\352*\240;e\300\230\262\"\333|\344!\364R\002\307\330A\220\200"
+	.ascii	"D\271\r\344\002\206\356\207\344[\f\364\374\317\263\205\002N\214"
+	.ascii	"\342M\300\027\320J=\002<\031\334I\031jV\212\026\203\256\006u"
+	.ascii	"\250S"
+	.text
+	.section	.gnu.lto_getMotorCount.81.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \367\345\006"
+	.string	"\022\21505@o\222\016\320\366\234\253\036\020\266\314\035C\322\221<@\rC,s\211\342\377\315\036\264\334T\264\217\013\302{\316Q\024\277)\360\3146\f\344'\2603\263\366\t\221)o4W\364\304\006\213s\021;\360\212\200\210\022\017\320\023\035:pcQ@\r\301\325\004\307\202WUY0\243e_\351W z\031\177EI\260\200\314T\270#=Y\\\220Rc|\\\263R\367\203)\345\236\300I\344\266\327B\356y|/\371J\277\333\275\201\r\224\005\225\314\321\306\222'\224I\310\017\372\314\b\t\240\261j\037#\214\251E\243d%S\203\317T\254\016\273\025\351%\205d\313H\241:"
+	.string	"\206\314\334e$\216\376\372\033\374\007\177G\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_areMotorsRunning.82.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\021\001\245\r"
+	.string	"&\332]D"
+	.string	"q\234\0168\026\251z\213\t\244\265\036\261\241\016\034\004A\305\314\255G\326\r\260:\227\261p\321\320\0133\215\031\230\216\303\b\252\035&G%\013\240A\347\001\260\007\314\374\241<m}\336\373\3621$D\366\2262\245I"
+	.string	"G"
+	.string	"K"
+	.string	"\341,y\244hIu\\zs]\332\303\300\307\335\303\223\322Q\274\321\212\306\234!\266\036:\355\036W;\037\363\021I\250X\361>\320\343\265\341\033\340\013E\315\234\363\340\225\364\211T1\037sN\253\367i\270\345m+\260\235\300~\027{\262U-\257\272\343>u\253\252\217)pb\322\001\205\264.\302Yz\2711[\344\212\020W\375\251\253}\373%\374\024gn\342\341\347*\263hD\341\374\034\250\204\023\301u\251\371"
+	.string	"\3532^\200\365\217\017:\363T\247\001\005\013TL\243\025\355x\\\222}\251]\241\243\367twA?\340\322\342\303.\312\034\226\334\203\277\\N\300\020\251\r\377\034\326W\256ud\n\035\305W#>\b[ \321{\227>\311nN\"L@S\211\276\330!H\027\025c5\202\205\003\331E\264L\323F\032t\270\315\263q"
+	.string	"\030d\343\311\264\354\001\027r!\343`\036\t\"\331\204\b\230\226A\340` \\\007\333\020\360F!\204\303<\333\306a\231p~O>x\006/0\214V\364\357,\307\325]\357\f\016\031j\310(\331\020K\\\224\237\362\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.83.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\215\007"
+	.string	"2N35`m\322\001\300N\021b\246\234\035#8S>\327O\255\243 \013\207\035X\263\350X\247\226\254\006y\350\022\326 "
+	.string	"B\026b\241&\230\273\300\333\232\323h7)S\n\326d,\330\201\013qC\0019\317zp\200\020\r\257\003\0318O\023%^f\300U\304&>\253\252\342\303h{\313\252I\225@\244#\247^U\217Y\b\344\357\241\234^\217\235F\017\271\210\307\347\360\304'\237\335\371\037\352\316)\300\205(7[\013\245b\330\267\254\232\354L;\2475}*"
+	.string	"\345D!e\227\264\255\254\211;y\330\006\331\030\037 \200|]\323 }\243\003#Q\331\325\236f\374z^\376A\356>J\266\254\024z^\022v\327\231\225*n\275\355\002\333\006\266G\002\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.84.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`t\002\245\022"
+	.string	"\266bzF\340\362f8\023\024\024\207\310\217p\"\001\021-\334F%\373\211K\001R-\224(pb\034\202\330\272\364\200D\b\255\351\363\236\370\346\231\033\241O@@\013"
+	.string	"\212\342\026\020A\200\245\f\232\005@\257\366GlB\366\2262\245a"
+	.string	"`"
+	.string	"l"
+	.string	"\367\206\333\374\200\307\310O\344\021?\350B\260\017yd\305<\224\330@\021E\355\356\201wn\261\336\235\\\200\352\035w\022\325;\303l\037\267\371\354Y\b\335\034\005\331]OK\034vN\023\346\257PDh\265\3309\020W"
+	.string	"\265\032\356dwO\364\304\251\3152W(\273\353\244\325>\334\335m+\260\255b'R\252=\326qP\225J\301h\251&\205\330\266p\025 kw\021\370G\032B\326\017\215\352]\252\310\320\213nD\343\377\030\203L\236\366\316\227Q\275\273\256xv\234\310\221\345\315\266\315R{\354s\273\273V\036{\365\241\273\353\322\034\227VMg\246/B\222\323\264"
+	.string	"\310n\207\233\3242uI&>\364\333\001GO4f@\270\222\307;\371\310\270\355I~\221O\216\360\030\036\225\003\211\237\235\240\3610$LXYQ\275\353\364)\356\302U`\210\324-hWv\232\337\342H,nq\345i.\227/O\263\001 \251\025\2411n\374\210\036E\266u\202\333\355G\315\256\214"
+	.string	"\247+U%\033\240Y\336\254\312\251\211\222MT\252\352Q \2157S\271\273\261~i\275B1\004=\227\230\022\361\003?\006\342L\2148\323\340\025\212!\030\300--\361\203\371V^\256\f\037\350\211/.\337\205\n\036\314\307\002z-/\031\2575\300a\214\353\345\211a\370\362Fl\262s\253<>\224\316\216\256\024\f1\225\036\237\235\342\244\3500\311tf\223\274\3559\034\274\311\243\256xb\302\221\362%\217\351\344s\303\206\312kx\314- \240\202\031\271\352\001N5X\021:\272\304\362"
+	.ascii	"i\311\313\226\036\236Z\177d`\366\024F\0163\2468\2620k\212Ida"
+	.ascii	"f## $\347\267e\333\334\3004\244#\271\225\343\305JI\274\315\233"
+	.ascii	"=\231\355\313\347\360X\244\206\216<\237?\310\256\3208\013\264"
+	.ascii	"\307\215\213P\203\223\f\373\215\004l\001f\302\200\005\312mW\327"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_mixerInitProfile.85.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\020\002\235\020"
+	.string	"\026\336iE\360\222(\035\330\245c\305\334\326\237\033\034\002\344\271\332\0332\250\333\344O\216P\tRx\215\323\310\223\f\332\257\312%\276\235\263~\b\032\352\207\273\\\336\356\300\355z9\205p=\261\030\n\b\317l\327\204\220M\244L)T"
+	.string	"M"
+	.string	"Z"
+	.string	"\231\316\247\037\340'h\314~0"
+	.string	"w=\204B\326&\322\224\260}\217Q\266\217\313H\354gjZdf\273\353\351\210\243\0365M\224\317\235\210\264\\,\217 \256y\\\253T"
+	.ascii	".\016\032\202\335\375\212g\007\227*\223;\331]g\313\365\341\336"
+	.ascii	"n;\202\355\004v\236\002*\022;\314cN>\314\237\212\312\366x\345"
+	.ascii	"^;*B\200\266\223\304\026\275\205\301\001;v\327\304g\361\330\310"
+	.ascii	"\207=:C)\337z\364K\333"
+	.string	"\243\307\305\220\331,\225\241-S\245\276\330\327vw\255/;\246\273\230\346bz\213\351\250\2455Mk5\342M+'\352c|\323\263L\2502\264\246Q\013\334\260pT5}\313\216\037\034\204\320\355\256L|\031\237!\301\023>\237\355QU\201\215\020H\3544\026\260\332M\221\330(\207a\220\300\f\247\023\246\310\335eQ\207\266T\n1<V\031\3046\350/B\235\314\206\224\016v\332\0363\006\225\230\276\225\357C\ni\370D\236\311B\312w\241\202\267\362\241\210<\020\251\344\225\034\360\bC\210\344\231F#\222\347\221\245\256\255\276\354@\204MJU\261S[t\034\006Gnl7\255\034\227\0360\262\005a\250\303i\247\006dX(R9\275\216\032\220\205sM_\242\216\300\\brlj78M, `\2021S\303\007\343\320\231b\020\034\212^{\261\324\260v\035\226\244#bsDH\341y\002*N\027\3061\b"
+	.ascii	"\3507\334Z\206\273\223\020\242\317\255_\346lY\217^,{S\fr\004"
+	.ascii	"\344o\245\020\231JB\353\223]\333\263\201\302\244\210\202\tF,"
+	.ascii	"\274s3'fj\3330\3428\016\026\226I\007\274R\270\262{\333\025\364"
+	.text
+	.section	.gnu.lto_loadLaunchControlMixer.86.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`U\002\305\021"
+	.string	"\206\236qI\320\322(\035\320\030\322\312(<2\304\305^\035\342\006\342\365\350B4\261Y\333\336\264\317*\021o^I;O\270\377V\247<\351\3762\224{\350\224\204+\370\342\001~\250Q@\017\365\217\303\256Q:$H4\326\b!\233\354\235RZ"
+	.string	"Y"
+	.string	"`"
+	.string	"\272\335\025\351\b\207\367\312\373\233\260\203_\365\350\204\3716G\200\313\325\310\330A\017lq\301\021B\256x)\244\334\207\227\237,\344l~ '`^_\356y\n\212D\350\b!7x\004b\206<\230H\332\244/\277@(W#a>A\007\273\353Y#;\334\341m\273\330\026\355Y\013<5>\262\271\243\267\026\037=\224\316\330el\246\220TL\230\312\330\245\343\334\363\323\007\021\301\025=\310\261\313a\367c\211\252O\211\343\334\276\n\277\264\351+~\003;\216\203\302\230Kx\323\t\301cwO\257F\205\257\007>\340{\365.\340{\275\3110{\307K\232\275\016\210\225\234/A(t\262\271\003\372\361\351\001p\003H\247{\212\035\233\r\217\307\366Lp\332\262\r\321f\222m\325c\230G\204\301B\275\356\274\n\030\351\234\232z"
+	.ascii	"\325\334\274`\375f\264\272\213W\003\232\233\215\362\034\326\b"
+	.ascii	"\315\356\246\354\223\267x\211\030\355.\003\026\267a\360I\274"
+	.ascii	"ZC\312|\355\325O)\177\312\t\343M\202r\215&#\204VI\206Q%\272("
+	.ascii	"L\030-H\020M\306\b*\221\244u\"\242\fxu\241\244%\272V\253\226"
+	.ascii	"h*\367T\306\346\241\214\032D2:\003\351\214A\\-Qz4O\237\224%\274"
+	.ascii	"\203\276I\177c;\242\315\244{\273\273\337\310'-Q\024\241\234J"
+	.ascii	"\314l\356\346O\255p\234\020\215\031\001\0022 \260\002!2\253\003"
+	.ascii	"\241\300\016\357\200\221\306\271-\265\244EE\300\201\335J(\324"
+	.ascii	",\301\262\215\307=\330\016\001Er\330\307\3658\230\207t\\U\251"
+	.ascii	"\375\265\335\202\235\2556\020\200\033\255\033\257-\n\276\335"
+	.ascii	"b\262\031\220\205f\324\267K\\\017\006v\035\264\016\264\254\334"
+	.ascii	"\322\235\260\314\251\235`o\345\013\021d\306\343\006w@\224!\353"
+	.ascii	"\373F\257\333\271\004\031"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.87.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`J\006\265%"
+	.string	"\272@d\016GpZR\007\r\001s\267\233\335\260\357@\227\3008\346\227\272?\307\035(\345\327\006\202\020\340\373F\333\n\241\204\363-\030P\312*\345\027\224w*\b\250\203\257\252\304(mZP\247{\250\375\237PdK\310\336{\313$S\n\322"
+	.string	"\301"
+	.string	"\332"
+	.ascii	"`\036Ft\261~\262QG\226J\331\224\272\234s\220\247=\304z\372\343"
+	.ascii	"9\252\247\330\003\250\236~K\354\236\363\3462\257F\234TEa\223"
+	.ascii	"s\016\376\220\265Y\307Mo\337\023\035\307\327\376z<vUS\374\227"
+	.ascii	"\330\276\032\361\214XQ\216\203W\030WL/\262\2533\363\261\035\327"
+	.ascii	"\267\032\t\311\322\362\326\213Z\376\303\001tTq\3631\007\022r"
+	.ascii	"S\202L\336\036\320\217,\244\363\326\216H\035\227\305+\215\243"
+	.ascii	"\233\257\035y\340\2422tHo\302\270+\022\034\256b\b`\\D~XT\370"
+	.ascii	"\241\220\235y\323\201\222\034y\334\0243H\242\325\360\265c\016"
+	.ascii	"\234\003\006\210\034fq\370\377\260\246\360O\316\331\275\374Z"
+	.ascii	"aI\335\273\032\345\234\373\032\261\262\274\201\336\355\016\272"
+	.ascii	"\033Cw\352\f\376\363V\355\335\214\362\306\222&\206\326\277\262"
+	.ascii	"]\250\377%\234qS\327\256\357\373\377{U\r\002w\307\223T\235\367"
+	.ascii	"\367*3\2512\257\222\324\276\325$\224\224TOu\276UB\273r\270P\355"
+	.ascii	"^\362)B\001o9g\242v)N6l\337\362\264O4]7z\332\336\244z\272>\323"
+	.ascii	"\270\320\024o\264\273)u_i\347\203\231\354\017\322\375\343\303"
+	.ascii	"\303\336\326q\247\230\367o\275\215\203o\373\322\333\255z\273"
+	.ascii	"\247\336\346\245\267Y|{\305\267U|;\375\333\370\336\376{\373\336"
+	.ascii	"\333\016\264\223\006&\0044\347\253\350\233\254\226\232\035q\247"
+	.ascii	"\273\230\337n\037\353\266\254\f\232\332h\343z\341O\272}\272\265"
+	.ascii	"\335\376\325\336\354\326S\0177\262\236\360^\331Bu\375\036\346"
+	.ascii	"\030g\332JF\250#\207\255\030\315\024)x\234\205\bo\335\355\301"
+	.ascii	"\341.\b\275\345<%\306\3372\340\r\034T\016A&rm\302\024l)\213\354"
+	.ascii	"+\033\251\372|\343\377\371\337[\365S\375\275\3179\343\334q\316"
+	.ascii	"9\257B\376{\237\367,42\365\331\204=oa\214f\\\250\246\257>n\243"
+	.ascii	"J\252\t\331\2343\0214\375\007L\256$\230C\371\202\326\345(\301"
+	.ascii	"\262\273\203sA\352\361t\213/A\243\263B2\215j\330T\020\335}\017"
+	.ascii	"\340\367\037\335\375\301\237 40\227\311\257\234\247\210\334\331"
+	.ascii	"]\302\265\034\255I\031l\336\276r\316Ef\236\005)\204\b\026\357"
+	.ascii	"M_\020\245\255+\354\311h\264\301\222\016\360r\237Q\304\t7u\355"
+	.ascii	"<\302\361\354\n\343 o|\203\002\3154\3043\364V\032\202\032\246"
+	.ascii	"\030&=-\265\0306\005\241\230\204C\024&\202)\206$\232\202JO+\202"
+	.ascii	"C\006\332I\305\322S\020\312\311\351)\3306\213\376A\372\b\252"
+	.ascii	"V"
+	.string	"|\251&;h\007n7\321\213\bv\335\330\356\345\2753.jR\037\325\003\347\225\rt\322\362|\032\367\013r \360\316\231\346{\234\367\252\273\250\220\275\363\375\020\\X\361F\375f\250\226\245\017\370<\357j\276D}\r\023Q\314\257,s\316\276\325\335#\334\315Q\003;\244\002m\3224V\310\336\263\337\276S-\001\340\355E\345}\357\235*\t\360y\357c^\341+\215\254\352\256x\243\357l\315,\321\326{z\344\345\257'\250\354?9\343$x\232\t\b\320\\\3109\303>\357I\327\325{\345\234\227\021\366\324\361\236d\330\240\021\020\200\203\250a \005\225b\310\320\f\005\022D\223\2449`\002\2311\263n\021\260)e4R\020U\232\003/\222\346\255b\220,s\213=\t\372\022\212\214<[\220\2728\367\244\021\323bv\357q\351\241\214A9\035\357 \335\305\366\"K:\373\304\313\003\241\204\317\035\n\223\006\274\272Y"
+	.ascii	"\257\030\036K\243\317^\300\313\225Q\261>C\233s\206\311\244\006"
+	.ascii	"\327\235=M.\253\230\213\356%\031\226\316\200<Oe,\261,p\236%\207"
+	.ascii	"\357\260\237i;\256\355ja\356\267(3\260\220\201_H\335\245\330"
+	.ascii	"(BA\214&6\274D\362\016\222V\341\022\t\266\021\206\245\310\325"
+	.ascii	"\227C\314\345%\267x\004\2034\300\305t]s\3001]\211\331\025\360"
+	.ascii	"Ej\245\343\237~Na%\202\003)\310.\023\271J\247J\224U\342\227\021"
+	.ascii	"n\037\031n\t\204V\001\"{ Ls7\374\345\006\f\356\361Jl\212\251"
+	.ascii	"{\n\006\031\220|;\340\235#\277%\210D\227\232\006\372\036\376"
+	.ascii	"\211\331\254|O\213\340\022\357\311\220\243\r\fT"
+	.text
+	.section	.gnu.lto_mixerLoadMix.88.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\243\003\255\032"
+	.string	"\266\361\254I\260XQ:\361\n\037\"\272*\302\324ey1>\315\364\253\036\266P[T\025\371\224\031I\031c=\243\241%\364\343=\334\346R\3670\350\260`\344)\2743\247O\304g8\346\365\334zx\344\225AO\375>j\204\020B\344N)\231"
+	.string	"\215"
+	.string	"\227"
+	.string	"F\325\n\003\007R\255\225\345\032\363\243\201\307\220\037\305\257\310\217\226\331T\276\313\325\037e\371\351a\251\265\266V\306\207\037\2266/\356nqe7K\0225\212Ke>\3574\305\217\027\034r\353\271)\226\"J\334\270\215SS\322\215j\264t\321\241\342\244\251\342(q\305\202\b\323\215~"
+	.string	"J\320\nQ\001\023\017\241\363~`G\020\013:\212%\211 &"
+	.ascii	"7\021\242\215\225*B\266\033\215\212:N|\357;\005\016i\301!\267"
+	.ascii	"\023\247\245\203Z\253)\320\315\304\355r\333@\333\020\354\255"
+	.ascii	"\001A\237\013\032\035\332\273\036\2728\3736Vj9\274C\266L\314"
+	.ascii	"\213\376\325u7\314u\377\313\177\267\352\275;uj\227\221\032E\251"
+	.ascii	"M\221\272\\jr\251G\221Z\244\324\273\324t\251?`\001\221\213\026"
+	.ascii	"5\2346\270\253%\206Z\352\2231\t\307\177\177\317\310\200\317\256"
+	.ascii	"\336$\b\225\020ay\020\337\3273\320\354\t2\177GOM\265V\232\217"
+	.ascii	"~`~"
+	.string	"\244)\333tw \262\027\2058L\255CM\220j\335\261\274\300\374\350\235yj\237\350?d\327\031\030\376\023\b\235\214@\355\320\007R\\\013\266]G\202#\223\253\325\247\201\355\tO:\003\bk\365\261A\372\021\rb\316\213<\320k\317\373\fS\317\207n6.\316\245\322\312\354J\2414O\255\315@2\265\327\361\244\370P\247\213\265\326*\246VfA,]\251\031A`w8\021\033!\220\253\2656\360\217xb\002\204\265\326\333\bA~\234\311a\231\321\241\351\256v\367\265\036/7\023\362K\367\265\035\251\375\336wQii\370\3634\243\303\335\037\211,G\326\n\376\2620\273\270'Z\347c0\027\317\031!\347\265\023\363p\243\342q]\3209G\337\324\354\234:'\005\230\213\347\314i\355d\30097`h\351\234\025rZ7\260X\253\246\200_\034\\\260\326\316\353\005k\245v\365;\304\273\251\364\342\311li\346\342\034"
+	.ascii	"\210\214\331\221\006\212\346\252\265\251\250\360\234\240\326"
+	.ascii	"e\377\36343\2053\251\300R:g\226\240\2265C7\243\303\323([\234"
+	.ascii	"l\245jc\366M\302\245'\341p\303 \347\343\220G:1\002;\305&4[\255"
+	.ascii	"\271[\204\\q\313\013\371\270\244j\307\275\321Y1|\264\340\217"
+	.ascii	"\026\241hA#\027\027D\250Q$\243\220\204\0022\023\310\004BSbh1"
+	.ascii	"P\002!\307\312<\020hg\233d\031\003\021\344Z\251`t\254-;\222\037"
+	.ascii	"m\343\313\b\264\244l!\226=<e\3610@\353p\345\242aM\264@\216\t"
+	.ascii	"\376W\354?\024\262s&\2441\304\232\026\271\001h\377\224Q\371\007"
+	.ascii	"#\2447\336\037\007|\263JFX\235S9\305\030\003\205\220\357P\270"
+	.ascii	"\253\035\254F\0303\241\354\210C\201ni\201\327\215\361dp\344\252"
+	.ascii	"\261\3128\253\356q\375\032\020\3168\006\307W\307\251\203\303"
+	.ascii	"D\347\272\276U4h\343%\024\025"
+	.text
+	.section	.gnu.lto_mixerInit.89.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\r\001e\r"
+	.string	"\346\330ZD"
+	.string	"\223\223\016\234\"\353P\242\355\241\256\316\003\304\216\3755\013\230\367\226\001\371\230D\204,\367\020y\211\222O\352\203\331n\310\222"
+	.string	"\007\026#\003\201\354\364\256W\002:\b\201Ia\217\030\3119\027\335\207do)S\nE"
+	.string	"D"
+	.string	"F"
+	.string	"\237\352\021\236@\365\350\221\235\343\246\226\375\214\027\020/nv\367R\025\037\035j\216\374\323\274\343\225\270C\022W\210"
+	.string	"E\243G\200\022\t~V^\274\323<C\224\272L"
+	.string	"\fv\327\351\225F\334\361\266\033\330^`\277\013\376I\365h\301|&dJ\250d\3126q\251)\354\303\335]+\213\375\231?f:3}\317mN\334\350\300\220\332]I\371\330/\326X\021b\373i?\3462\243\317\244\270\263\213\"\246f\327\224\300\026\310\243\310\003\2260\222\367R=\247\037\002\322\006ay\317y\302\371:\345|\265I.\003\245\300\215\335U\340\303x\214\314wyt\006M\263\341\355"
+	.string	"I\221=\207\3126\351\240\007N<>\222r\216\352\263x\213\024\337\305\036N\362\336cX\205\315A\307 K\224\225d#!\354C\246]\242\013$\231\006\013WI6A\273@!\223\3132\340m\003\026\272D\333\026\272BL{\270\312\342\b0\237\212v\017>6\"pP\235r\020\202\347\224zK\016\252F\215R\245Rp\201\203\2249\036\220\016\031"
+	.ascii	"\215)e&^\"\205sp@8\201F\343\250\001&\212\031\020\006\347F0\013"
+	.ascii	"]0\333[\326\254\341\232BsM\34126\2742\177\237\266\034\214\272"
+	.ascii	"\204E\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.90.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\032\001e\r"
+	.string	"\226\331[D"
+	.string	"\223\223\016\270\247u\f\037\244\243\355\344a\202\340\212\0336\224\n\020\033\314\244Ks\232\333*p\203ne\2315\340\001\360j\222\267\304\323E\252\365\377\377\337U\326\205c\225\332\317ZD2\246\216\020\262\267\224)\005G"
+	.string	"G"
+	.string	"I"
+	.string	"w\231\221A\005\217\335\315\364\203\261C\357\206Iz\204\232$\237\345\006f`p]\351\021^'(7@:\f\320SC\323\341\336\323\244;%$\221r\275\367\0032\037\327\245</\005\273\353\344\272\r\267u\333\233\355\314>(\266WJOM\311\b\253\212\375T\352\316\247\177\rxa\003D\263\253\341\373\2610\321\205\210\247n\337\204\357y\363\023G\221\236\362\n+\241`*\227\0329v\227\363\350\016\366X\340\001\254Gx"
+	.string	"\326\3437&\3313\367@lj\351\210\314W\342\341\224\237\257\266G\316\302/\002p\354\256\307_qUH\202Hd=*\rN\207)?\333\023\236\302/\330\356&\360Q\274\205\202\037\342\321\026H\362\334\243O\242\367\316\341\260\243\004\312\224\237\252\352\244G\013\325\225\332\375\351\2144\021m\301\026RA\003e\243\007\0164\b\r2\021\215\001(\373l\242\254C\300\241\b![6\n\205\266l\343\355U\205\345\230\214\025\214IOQW|\305PK5&9O5\361\312J=\252%\346B\3728\334\335\205F\360\f\027"
+	.ascii	"1\003\373\3341A\343\364}Yz\326|\210\342\202\t\017\fl\250YB\214"
+	.ascii	"}\230\226\240\335\226\370\333&\206.d\260:\375\322D\340\030\207"
+	.ascii	"o\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_getMixerMode.91.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375 \370\345\006"
+	.string	"\"\21504Po\322\001\240\234\241\354\022\004\021\202\376\264\240"
+	.string	"tP[X\262\217P\330\032jm<\211\211\304\302\005[\016\252\252:S{T\272\375\017\251\276\262do)S\n\336h,8A\204\212\003\001;\317bX\200\r\no\202\t\235\267\251\036\236\206\300\224\003\247z\026EU\017\023\367*J\315\204T\302\276\310\343\345o8\302\223\307\356|\217t\227\n`\021\312\221\035A\251\030\366\333\252\310v:u\240\344dR\331\245\030\265\254\211#\351\260\375\2611\376\307A>\276Z\324\310.\034(\023#,\273\361e. \335\265\007Hw\232\361\353y\371\017y\363HY\3012\320\363r\260\273N,\253\270\365\266\013l\033\330\276\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_mixerModeIsFixedWing.92.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\225\f"
+	.string	"f\227TA\020Q\234\016\365\262\206\212\304b\241\211\257C\215\263\245\344kF/\200^\372\244\035\\)\370\303\304\334\330jl\315\264S\344\275\272\300[\021\n-\241\\w\201\275\360\356\007\246\274\303\365\f\001i{\313\224\002A"
+	.string	"="
+	.string	"D"
+	.string	"\326<\201\353\226m/`\360\261wp\304\350$F8\204\214\273`&E\334\373\224\352\371\337\347QG\240#\344\006\216\027$\017\227\032few\003\220@\252"
+	.string	"0\273k\r\221:\334\326mgl_\354w\001\342\006-\261\301O\245\207\375\271\273ky\262\017\362\253\325\237W\211\243j\233\261;Z\355X\033\226\214\022\266?6\305\266\252\375\217\243\370\034\304\343\311n\b\030\"\273\240\002[\260[\225\027\270\036\322\003\374U\246Q\374\224Dw\367\223v\341\360Z}0\320\302\341UBC\300=\327\n\237\205\303\213X\002\201\335s\335\322\220\375\024\266Cl\367{\311v\2109\330Q\344\343\304\2326\301-\225G\375A\r\023#\001\033\t[\203\2115\226N\353h\020\270M\006\215\223u\025(h\026&d\035-\002'\323p\0302\313\001o\0276\\\326m\033\227Q\300\375\\y\362"
+	.string	"Q*%\215z&\307*\025C\177\357\272\024I\225 _\305\215\371\224d\006\030"
+	.string	"\215\221Rb<C\0322\314\250\203\206\257\263\035bc\b\272>f]\200\005\332\325\031\313N!O\035Z\252\225\242"
+	.ascii	"q\034\"]\353.`g\327\224\250bB\234\252\206\243\356\357\262\362"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_isFixedWing.93.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\r\007"
+	.string	"\242\31515`m\322\001"
+	.string	"\007\200\314\b\356\340\202\26544\005ZE\b\323\260B\325h\t:\214\327 \036\n\362\320%\254A"
+	.string	""
+	.string	"!\233P\023\314\353\001\016\274FK\210\224)\005\316`\256\307y\nPC\3616\356rhx\017\f\216\363\0266.\003;\016C`\013B\003\335eY\320U\333^E\252\227\217V8 \257vD'\037U/\026\252\331\017\271\210\204\377\341\t,\037O\371\230\345\324U \343\223%{\323R9\354O\253\"\333i\315\364\247\001\022\nV\262\013*\255\354\tE2\262\355\261+\037 x\234}\363"
+	.string	"}\244q1\222\262\2739\355x\366\314\374\203|\"\251\230\304\220\366\004H\330]g\fa\334z\333\005\266\rlo\004\b"
+	.ascii	"2\001/8cy\034\240k\370c\204[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_getMotorOutputLow.94.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"=\007"
+	.string	"2N35`m\322\001HLP\223\330u\337\257rr,\204\350\"\036a\337)\027|\263\256\315\250\023\260'\017]\302\032\004"
+	.string	"\020\262\234&\230\327\263\307\252\243\033\331[\312\224\002\326d\256\330\211\n\326\206\"r\340\345\320\020\037\030`'.p\240\306\212\200\231\002W\020\033\013^Ue\301\213\266w\253\243TLH+lK\\\304&\200\335E\360C\256M\370\245?{>\371\354\317\377P\177\251\001 \241\334l\r\224\252a\337\255\216\354\247S\tN&\236m\367b[\331\222w\342\260\215\331\027\277\343\036\230mr\032\251\364\223\f\213\221\224\335\205\230\017P\177\356\002\324\237n\034{b\376?\356PTH2\021\350iI\330]g&\302\270\365\266\rl\037\330&\005\b"
+	.ascii	"2\241Y\037\370\350\020\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_getMotorOutputHigh.95.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"=\007"
+	.string	"2N35Po\322\001\340\304ps\210H\332\227\353!\002\264\301\022yg\335(\232\025\315J\233\361N"
+	.string	"\202\\`\240\336!3\263DYw5\22798/,c\220\275\245L)\326d\260\330\211\013\327\246\"r \366\340\020!\032`'2p\240\346\222\200\031\003[\021\233\013b\226u\301j\333\273UQ*\006\244\030\266'^\342R\300\356&\370$\337(|\322\237-<y\355\317\367P\177\251\002#\240<\331\333'\225\303\276[\025\331O\247\026\240\250\\\254\354j\234^6\345\235|\330\316\354\312\007yHf\227\3346\"\335\344\221a\322\262\273\020s\002\352\317}\200\372\323\216g\317\314\277\310\035\213\213I\013}\236"
+	.string	"\n\273\353\324B\033\267\336\366\201m\004\333\243\b"
+	.ascii	"2\241Y\037\370\350\020\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.104.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`$\002m\022"
+	.string	"\226\242wG\340\262(\035\222\027\004\301\016d\213\241'X\026\262G\003\210\343[p0x\026%)1\217Z\375k|\375*\324\364l*Tm\346Lu\266F\035&Lc\2141\322\332=\273S\343\b\274\207C\356\016Q\222\277\367\226;\245e"
+	.string	"]"
+	.string	"e"
+	.string	"!\226\260\306\214R\32001\362i\021\367\371\022\036\221T\\#\322\212\301\207 b\036k\261pz\324\032v\237\373\301\334ex\313\b~\312\215\024\364\037^\326\350\334Z/\226O\221\327\313*\312\330\"\221\341+Md51\221W\213\\\233\332\213\327\036a^/1\0168\375$\250\265\232\333p\177n\273\202m\004v<\t1h\2740\373\264\3733\243\251\214\236r\243w\243\343s\356\0030@\023@\246\326\230 ?j\207\2713\342\264?\347\321\276\237\363\023~\315 \034\025\273N\363ql~\263r\024v\021r\t\353k\201-\254&\334g\350\004\350\247\274"
+	.string	"\372y\237\246\342\207\006\315.\003\355Z\361g\006}\37220t\317\002R\372\016J\213\271$<\263\225\254\265VI\362\257\334\317\260\325,\310\264\3308\300`\354\316\354=\334\340p\211=\266S~+\361W\234\205\367\300d\242\237\273\244\330\354*|\343j\255\007|\333u>_\304\247%\244\342[\237~\212~\306}\355\221\006\273!#\333Y\305 \336\257\215\0346:qg\274\264\244F\336SN\336\3514AA\n\365\251>S\210K\"\225w\362NP(\024<S\247r\220\342Ah\320\235<\006\246\256\204Ju\242\002\376\"\240\240:\325\367\241:\220\355\370\205\231\306.\260n\322\007)\210\007\003\353\026\177\220~\026\306\366g\037\236\343\241\301\345c\307j[B\314\235\361\244\241#\017\351Y\271_\030\272\337\353\270\221171 p\002\241Z\333\264B\024\003\215}\304\026\303\206h\020\305\035-\013)@\335/\330ch"
+	.ascii	"(\005\3050\016,\347\345l\300\3253\270\3064\"\002\304f\016y\227"
+	.ascii	"4\206ha_\340/\375\220\300\377mv\345n#\023\307F\244>\364\r}\235"
+	.ascii	"\333\223\315r\354\252*\236\326\302\357\266Q^@\013LB\333\316["
+	.ascii	"\263E<h1\356]a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\246\002\345\016"
+	.string	"D\025\242\003"
+	.string	""
+	.string	""
+	.string	"\002\350"
+	.string	"\177$\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\224\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\341"
+	.string	"%`\320"
+	.string	"\024\301\204\001\321"
+	.string	"\177&\200\200\200\200\004\272\220\202\002\322"
+	.string	"\177'\324\266\305\355"
+	.string	"\005\340"
+	.string	"(\002\323"
+	.string	"\177)\005=*\324"
+	.string	"\177+\005\342"
+	.string	",\005\344"
+	.string	"\022\002\325"
+	.string	"\177-\345"
+	.string	".\326"
+	.string	"\177/\260\206\3618\330"
+	.string	"\1770\005\317"
+	.string	"1\332"
+	.string	"\1772\002\327"
+	.string	"\1773\236\256\241\372\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\00594\331"
+	.string	"\1775\002\333"
+	.string	"\1776\334"
+	.string	"\1777\335"
+	.string	"\1778\336"
+	.string	"\1779\337"
+	.string	"\177:\005?;\300\003\005\300"
+	.string	"<>=\301"
+	.string	">\306"
+	.string	"?\305"
+	.string	"@\315"
+	.string	"A\302"
+	.string	"B\303"
+	.string	"C\307"
+	.string	"D\310"
+	.string	"E\311"
+	.string	"F\312"
+	.string	"G\304"
+	.string	"H\314"
+	.string	"I\313"
+	.string	"J\316"
+	.string	"K<L\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005:M\0058Nsetdata"
+	.string	""
+	.string	"\0056O3P4Q\001\343"
+	.string	"\177R\377\037"
+	.string	""
+	.string	"\200\220\200\001\347"
+	.string	"\177S\346"
+	.string	"\177T\003\004"
+	.string	"\242\001\003\b0\204\006\003\021\r\237\242\022\003\021\020\302\022\003\0232D\003\023\b\202\001\003\023\006\242\001\003\0231\320\360\372\250\001\001\344\001\003\023\021\202\006\003\026\025\200\200\200\200\004\001B"
+	.string	"= \260\002)2n\003\362cYC\327A\210\206v\217>!\267|\357h\233^\2435y"
+	.ascii	"\275K\226^\220\202\341\f\201F+\367\365b\363\235\202\357\361\353"
+	.ascii	"\321\314c\036\3471\017\3620\217y\234\307<\310\303<\346\261<\312"
+	.ascii	"<\310\214K\251}\267\2104\371\221?\322\2170|ZcJ>\273$\256v\312"
+	.ascii	"$rhF6\023\2022r\302k8\177\2756b`\021P\362\305\035\235\244\217"
+	.ascii	"Y\362>\034K`\351<F\341\202\365\004"
+	.text
+	.section	.gnu.lto_.refs.d3897e904b8cf1cf,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\315\004"
+	.string	"\002\215\035\f\020\300\035\306\363`\354\203&\371I\246z\016\r\372\023u\316\346\274P$\356pF\237W\235\266\221\325\361\231\300\024\361\251}\202\365\312\364\372\2642\2752\f\374\256\360f\315\2311_\336\336\266\\\231\362d\311\333\221!?v\334\2301\246\231aja\022\226>\037L\022>\003\237\224@\247\317-\275\357\242^@`\317\022Py\225\324y\223\322y\033\235\324\372z\247\221\236!\f"
+	.ascii	"\251\220,\334M5\306\324\366\257X\300\034\022\2528HG\260]T{ \226"
+	.ascii	"\236\227\203=\007\005"
+	.text
+	.section	.gnu.lto_.decls.d3897e904b8cf1cf,"e",@progbits
+	.ascii	"(\265/\375`SL\3458\001\352\t\246qU \fY:\215\001\225k\201\327"
+	.ascii	"\252\037T\236\021KA\212H\037\206\035\364y\270[9*,\243\225/\224"
+	.ascii	".\213\270je\027p\344\332\335j\b\024^\377i\227]f\243\357eb\005"
+	.ascii	"\f\242\302\n\324\204_\323q\"\301\316\3047\033\0364Zh\347v\267"
+	.ascii	"\313\277\267\224R\246#\006>\0078\007WIn~\020\032m\223\266\310"
+	.ascii	"\364`\211\314\007\201\321\017*\323\017\002\323\017\022\242\037"
+	.ascii	"\304\245\037D\245\017\304F\037\350M\037\350L\037h\211>\220\016"
+	.ascii	"} +\375\037=\375\2374\372?`\364\177\246h\004X\"\363?`\372?E\364"
+	.ascii	"\177h\350\377D\351\373\254\321\367\241\323\367\331\242\357S\246"
+	.ascii	"\357\303D\337G\207\276\017\226\376\321\022\231\357\331\323\357"
+	.ascii	"A\243\337#F\277\307\212~\317\227~O\016\375\236(}\0365\372<b\364"
+	.ascii	"y\314\364"
+	.string	"y\230\350\363\370\320\347\271\322_\263D\346E\273i\026I\200\253\366+\345\272x\tu\334\307\275\217A\227\310\234+Sn>\317\224\276%\200\211\367\366,\001\314\357$\365w\302\350\357H\321\337\021\242\277CC_\343\351k9}\275\246\257\237\220\375N\371\357\330ea\357\324\257\032Un\276R\216~\311\360\232\333\224\234\233o\023\215-\221yMD_\347\320\327.\364\305X\"\363\252p\301,\322\350:\t\262d\242`\340\270\371:J\227`[#\363{\326\310\274N\235\276\216\026\375\337/#\267\306U\342\001\237!3b\300\335|\221\334$\277J\256q_%\033\024\367\206\272J\202\344\354\r\025d\255\005\326Z\220\303x|a1\363u\320\264\025;\372\375\n\212Sks\344\346\353H\321;\226\310\274\216Q_\247\250\257\203\245\257\263\365\3153\372IKd\336\334\242oB\3217y\350\233-\364\3137\372%\030\r\302L#"
+	.ascii	"L+\300\026\231/\275\364K+}\263\244\376Z\233~\0272\375l\324\247"
+	.ascii	"\313\241\237\264E\3463\013}\274:}\274E\037\033\265\220-2\217"
+	.ascii	"ih\213e\211L#[4uW\230TM\256\366\315\027\352FY\344]q\245\236\311"
+	.ascii	"\212\273l\357\343\217\331\366\265%\312\315\307V\372\026\204\031"
+	.ascii	"\264\267\267\267gA\230\377}\242 \350\270e\325\343\346\377\356"
+	.ascii	"9x\252\253\310\213\233\257\234\251\225YIC#\fo\215\325\263o\354"
+	.ascii	"\236ec\343\330<\353\306\312\261x\266\215\205c\221v\216M\336\266"
+	.ascii	"`\325H\245\261\331\266$X4\370\355\025\264\253\001\355\354\335"
+	.ascii	"\005\315h\246\226E\203\f8\260sl\235\275\263b\270\032\020\006"
+	.ascii	"%\271\367\321\255\213\231\031\02644\302\300l\332\332\325\212"
+	.ascii	"tpv4\307\236\261f\200\244\216\373\311D"
+	.string	"\024\032axW\262\244\321\b\003\263esl\225\253\001I\035/`G#\fl\357\035\"\204Q\b\334\205\203\215j\202|\341h\213\314\033\304\022\231\277a\264Ec\323X$\005\326\356\031pp\374D\026\364\243\347D/\316\315\277n\372\226\002\323\356Y\n\314\3373\375\033E\233\371\255\233]\301\322\361\330A\221[\273y\316\bsYc\005\316\315\277H\3645x\343\372m\234%cY\260e,\322\312\3310\267pV\314\363q\357,S\276\3240\033s5 )\241\375\"\352\206q\357}\373\344?\372-\025;\305\312Y/W\303R\260\366\213($\003([A\213\t\336\336;\204Q\210\020!.\322F\230*\236\374;\245\355\266E\246\220%2o\341\350[0\267yP\233\203[6}k\246o\247\350[(\372v\210\326\333\026\231v[\"\323\266]\273\305r\271m\263Z\236\001\007\367\221\332O\366>\332\266\2747\224\265\026"
+	.string	"YkA\311\305\b\324\0243\337\366\320\2671\364\255\224\376\252\357\266D\346O\350\233\240\317"
+	.string	"}\013\364\305\262D\346\305\330\"\363F\372WgKd\336\242%2?\330\"\363\267dV\n\246\252*n\263\275\217C\007\330b\344\307\315\277\215r+\345\267c\366x\265[\334[j\357\255\301\224\263\221\345\307\315w\333\"\363\203%2-\224\243\333(\277\025\263O\210L,\256\3436\333{\007y@\343\302v\263\216%2\177\264E\246\266D\346\363L\\\021\004\375\371\315\1778K\322\377m\222\240\377-\202\325\257\322w\215\340\277\324\300\025\222\377\022\205\021\344u\225\016\370o\361:\341\263\305\343`\n\3747\004!X\300\213\376\262\004\271\016\317\300M|\350/\217\250\360\360\277\026t\200\2057p\360?\033\314D\2071p;\2333\360\337\013n\002\006\301\005\360\227\036\374\227c\3637\377\351\336\363\227"
+	.string	"\370\257\346\277?X\351\377\234\337bq3\200g\370K\016?6!\005A\322om\374\267{q\023\336\001\243\337\360\227D\377]"
+	.string	">\361\333\374-;\377u\302\347\177;9\377;\3747\205\235?\267\371\217\367\337 \366\300\355\354\177o`\337\177\307\252\250uA\342\016`\016\374w\f\336"
+	.ascii	"\326\300\177\347D\374w\304\177\021\360_\0338\003\377)\370\313"
+	.ascii	"\005l\371\357\026!\377\245r\2466eL\354\277_T\270\241\303\312"
+	.ascii	"\177\263 \371o\024#\377\245b\365\337(%\370/\030\361\277Q\376"
+	.string	"\223\371?\346\177\334\1779\363/\243\256\027\006\016\364\233\034\374X\304\217\021\360\343\243\037\217\370\361\001~\274\301u~\023\004?&\372\261\206\037g\3701\206\037\013\375\370\302\217\213~\274\341\307\017\270\300\177\347\3748\350\307@\026\370/\364\233\"\370q\005~<\201\037K\340\307\037\374\370\001?v\300\2179\370q\207\037O\360_3\377\235\373\257\334\177\343\376;\346\277p\377E\376\367\355\277]\376\353\366\337\266\377\252\375\027\355\277U\376+\345\277c\377u\362\337%\377M\362\337\257\377\032\371\257\220\377\376\370\257\327\177\213\377\355\372/\216\377r\3757\353\277W\377\265\372\357\213\377\266\370\357\324\177\245\376\013\365\337\024\376\273\377;\202\377\212\340\377\226\377Z\360\177\356\277\353\177\211\277\335\362\337\340\177\023\376\037\377\033\202\377z\377\327\374\317\373\017\347\177\233\377\n\377\013\202\377~\340\277\013\370o\342\277\t\370\357\005\377\355\340\277\034\374\027"
+	.ascii	"\377\375\360\337\n\376\353\341\267i~[\367[4\277-\177\373\377"
+	.ascii	"{\377\245\374/\341"
+	.string	"?\005\376\277\375\037\300\336\336\336\336\257=\360\017\025\340\327 ,\305'\241-\225%Du\204z\242*\363\312\262Te\305,\252\262b\326\320\226\332O[\nj\207\226*fQ\201)f\tQ\225AeQIye\331cq\3331[\216^OS\273\f\352g\357]u4>\371\354\r\205\265\237\310\\\253\355\225\264\332]\333\212qr\354\261\367\336Oft<\212;\307\250-\206jIqijo\272m\265\301\223}:\356\275Y\354\250'\273\367\324\021k\357\250\242\007\270\366\336\273hY`\201\265\177\266\024TU\024\217\242\317TT\221\305^\262\303\356\275w\026U\031\217\342\021[\2252\343\216:>Y\252\252\3426n:/,]\366t\264k~\312\210pU\335|\354Y\353\272\"\343\3465oj;\324n\276Q\020\020\271\205\035\251\343\261l\357c\020\006.\025`\334|#\035\372\317in\2219M\276\333\241\332[+"
+	.ascii	"{I\366\364\3606\026\027\006@4\346Z\270\2719\333\371\bi\303C\316"
+	.ascii	"\315\327\220\324\327\020\247\377\214\346\314\b<\252b\210\335"
+	.ascii	"\"\263X>\003Bo)0{\311\275\2710\330\361:\262\342\352f3?C\320\274"
+	.ascii	"\034\271\371\032\270\350\261\271<FN\222.\227\311r\231Lf!"
+	.string	"\307Yd\236\313b\306\236\304\201\222g\034\303K\346\271,%\303Y1A2\230\273$\334\\\216\002'\271\3671\204\221N\\\236\n*"
+	.string	"\345k\250\242\257\001L\207\341\221\n\3231\346\346k"
+	.string	"\242\341\246\2301\236\201\201QFg\334\222\271dd~\313^r[v\313`r\227\274B\326b\221\371KV{\366\221\217GT\262\031\020\336\273\007\034\213,o.\320\276\030\217\260 -\034\331\227|\305\336\001\341\275\273\302\030-\334\227\274\226\331\254\030.\022au\311/9\355L+o\315(W\351P\302\302(\263\331;\035%{0\324\334\374\fy\372\031\314\350g"
+	.ascii	"\243\237\341L?\203\023\375\fC\3643\340\320\317\340\"\233Y\361"
+	.ascii	"\300\326\240\271\244\252\266n\316U\362\026\322\307\221\233\237"
+	.ascii	"\001J\277(\216~\021\013\372Em\372EP\364\213\234h\273f\213\314"
+	.ascii	"\027y\351\027m\351\027\271\320\307\260\247\217\001\215\316N\202"
+	.ascii	"\226\\\365\360"
+	.string	"r\3631\210\321\177\006\263m:bn<\314\216<Q\242\276\336\232d&\345\231+*\330\375xf\362g 9H^\342Sd\233\362\206u\263\022#3\210\033\252\250\233\217\241\213\376\237\277\2621#\261\310\234$\0171\322\300\326\305\345$Y\b\221d\222L$\037\261b\270\216[\013\210G\021-0@E\273+r:\377\371\210\021-zjZ\230;\232K\202\250\331r\363\177\213\314El\230\3436\2721\314\b\261\273\371\030\264\350c\300\242\217A\212\346\260m\221\211\215\226\310\314>\216\236\177\370\254\241+sr\363\004\226\310\374s\217\314\003\023\241\003\"\307\303+/9k\323\344\250\243eK\322j\007\335N\23142X\344\242\225\263I\232\260\231\221ud+ 'aU\\L\3355\240r\357\342\031\243\324]\263b\202<\340\t\232\344\321^\206B\243\321\306E\022F\013j\342\266\360\340p\236\232W\334\026\336X\322\336i"
+	.string	"\025\267\005\226\243\322$\263\025\216\203\365\200\244\216;\013HM\253\206\2338*5d\342\266\360\340l|\247%n\013\f\317\266\231_d\342\266\360Xh\305m\341\301\255\2612c\203\204,n\013/[\345\025w\r\b\352\270\261t\320\222\304m\341\345\252\314\225md\031\031+_\345\033yF~\221\265r\214\\#oe\034\231F\316\221a\344\256\234e\221\331*S=\267\310.\236\355\330]\r#\334\237\001\007\331\n\277\261w@O\307}\245\363\245&n\013o\357\243\317\215\260\025\326\200\310\267h\213\314"
+	.string	"X\"\363\030b\350c\330\372Di\364\211\334\364\211\236\350\023\035\311O?bh\230\301r\363\211j\344M4\205\347X+6>\232\334\374\013-h,\347\030j\013\251v\363/\204\321\277\220\246\177\341\250\177\201\210\376\005\030\372C{\372Cu\372C\\\364\207\216\372CI\364\207n\350\017E\351\013\251\321?\266#\200\226\332r\366$\r\232\0363\031{G0\032\3346\247CO\353f\2703f\311\261\274.#\214+3\243\233\f(\311:5N\354\330\033!I;\206\027\004N\214\334\227.+s\214m>\322\260u1\223\264n[sO\334t\314\035\021\303\222gd\373\002\227l!,\351Vg\304m\367x\247"
+	.ascii	"=\t\355\r\244\205q\357\315\306\005\215\221\r\fR\354f\3013\326"
+	.ascii	"];(@\204\314\341\370\261\022\034\206\267`.l\006\323\300B0\035"
+	.ascii	"\026\203\233\3404|\206\243`8\\\005#\3018\360\016\254\002\236"
+	.ascii	"\201s`.8\b\036\202\251`6\214\005\377\3007p\rl\003\177\301f\370"
+	.string	"\b6\202\343\260\021\253\3410\370\210W\300^\030\f\223\301^\360\033\226\202\307`1\214\304[\270\013^\202\3210\013\270\bv\202\231\340+\270\013'\301=0\017\374\004\327\341/L\206\335\260\025\354\003\203\301sx\n\006\202\241`-\270\f\226\303Y\360\031<\206\3130\021\\\304kX\207E\3426\254u\034\003\313\270TUX\306\334\fI\002\301m\367\310]\202\217F\021\254\\%\367\336G\030\353*)v%\216\321F\230q\357#[\230\26718:\254\333\21590 L`$/\034\013i\311\032\377\025+\243\252\273{b\335v\314\025\231\361_ Ej\034\265]=l\205\217k\021Xq#\271\367\256[\003\226\254K\023%\311\266\302\031\243\330\031\034\243\035\213#\227\003G\216/\243\035kS$\tg\346\n\233\027:\343\245zq\006GF\256\013\333\026;\037A\214\227\006\227\230\021.NN\215\203\377\262!\345\300P\265"
+	.ascii	"\222\345\302\225\311\3425G\244h&'Yw\321\214%\251\354\031\367"
+	.ascii	">\212U\3213\302\215\361\222\334\373x\204a\324HZ\263\377\002!"
+	.ascii	"b\303\272\305\210\002d\310\r\243\035cc$\t\244\311\rca\225\334"
+	.ascii	"{\327%\305\222{\037\341\346"
+	.string	"\316\214\027\216\316\007\226$\233\026*w=\200\b\271\342:\302Yw\r\bJhK\255\200a\334\373x\341\332\256\034\025\264$\220 9\254\033\217!0\376+\366\244J\353\277bQ\\\\1(s/.\225\325\025\254\2541#\213\377\262\275\311\2051\272\265\335\037s:\214{\037\215\314\250\031_4\354\221\274S\264E\246\225a\211\314\013\311\351\013\271\351\013I\321\027J\242/\244C\377w\357\330\352\277r\356\034\\ewdx\321\222v\363\013=\027iPn\276\020\227\376\217\2510\013\334\002OY$v\201\243\216\245n\327\357\361\034<\331;|4\352X\341q\226\334\373\210]\340\025w\r\037\3274\213)h\327\305\266w@OB;*.\213q\357#v\201\241\366S\013\0338\331\261\247\207\267\367\321(D\210\020!J!\\j\342x\362\203\346h\323\215~\020\033\375 5\372AIm\251\034\375\356\345\036n\002{s\201"
+	.ascii	"\252\262\302\324\212\233o\301\016\263\354e\246\232Q\361\311\215"
+	.ascii	"\031\245j\210\r\274\275\271@\230s]cmi7\325\356#\204K\034\256"
+	.ascii	"\233M,&Z\033\026p\374@3\263\334\310\2025g\206\004\305<\244y\226"
+	.ascii	"\305\374l1Q\273r\265\036/+\216\224\271\3314\263/\260\330-\271"
+	.ascii	"\331\264\322SL\023\344\307\315f\025\036/imf\334lR\311N\310\336"
+	.ascii	"\340HC\342\326\242\211\03222/\245\031\231\033m7\377\303\030\375"
+	.ascii	"\233c\377\230y\264B{\363\270R\342F\211\017KG\245L\331\315\377"
+	.ascii	"\220f\252p\023\212\251\202i\303\304\362\300>\223\003\227\264"
+	.ascii	"\003\242U\343fS\314|b\206\231NL\260\017N\314\256\233AJ,\267h"
+	.ascii	"\221f\227\311\344J9>\365\030\3116\336\224\324\335\274\004\250"
+	.ascii	"\255\350\345\354\346\177 \242\377\233_&\0223\211i4\217X\244\251"
+	.ascii	"\304,\362\022\313-\336\272\030\022\027&\226$b\333\360\321\250"
+	.ascii	"S\205\207\223\244i\304\336\305=\321\002\003\266\367\321Tr\245"
+	.ascii	"x\200\331E\371\"\346\223\377\241\250\377AK\277\002=\375\n\312"
+	.ascii	"\350W\260\2026}\230@v\266T\305\341\270\371\346\217\377;<A\310"
+	.ascii	"\030ar\3635{\350<\301\222\272r\363M\036x\016\230--n\276\351\365"
+	.ascii	"\177\247\004u;\234\334l\356\320S\025\230\021`\347\fY\032\"\246"
+	.ascii	"\216\233;~\263x\261n\325\r\256\273\233\201\354\216n\352\270_"
+	.ascii	"foo7\277\202\"\3727q\2308\254\0319k\033\213\013\003\023\316\253"
+	.ascii	"\213\225\233_AV\335K8e^\031\307\"\313:\323\006\246\342\332Z\031"
+	.ascii	"\334i\375n\270\020\273\271\306Q\007j\256\214\227\233_\201\224"
+	.ascii	"\276}\"\247\324CS\356\325E\231+\254\230 \017h\002\267\313"
+	.string	"9\035\242\250H<9\223\3242Y\230WV\f\227\320\226J\3033\265L(:\031&\227I\303\234af\2311\314-\2134\265\314\251\227ye\234\033\035\367\2262\265\314'3\311\275\217Al\304\254\320\020\312\245\234\247\351\020EE\"\212]\322\204abY\244yef^\231T\246U\017\332\2327\033B\374\250a\201\356\206\231\177\323\312\254\312r\004\262\346f\363\005\027\215\267\0257\337\003\013\3727[X\244\351\242\r\030[\234\233\337\346i\376\357\364\2540\204\307\030}\017o\372\036\322\264)\245\345\2229\302\334|\017f\372\036\312\364=@\321\367"
+	.string	"\246\357\301\250\357\201\210\376K\275rN\331\0276a\346\3348dU\324\315\367"
+	.string	"D\337\243-2AX\"\263lS\276)\361\376\235\240\260\265\037g7\337\203\016\375\322\315\377\035\023\206\300\235\335\234\355\271\230\345\232\227l\376\235\373\366e\264\272\371\036l\350\227-\224j\376\035 \272#W\244\334|\017Z\372e\362\377Ny\266\307\246\306\315\345\235\236\362 E"
+	.string	"\236\034i:n\244yy\367\227vW\353*Iao\316\233\233\177,\221Y\2429z\231\246'\214[r\354f\037Kd\236\2023f\314"
+	.string	"\021b|\233\233+\307\346\030\325\344\344\312*!\030\213\213+\321H\034\367\023\003\264\354\351\201Q\260d\314\230r\314.\b\034\\Z\r$\262|#!\264\267\0171#\005.\276|)\337H\034\367\023\005\240D\240\346\307\227^\227.gk\334\334\3121\022\307\375\224"
+	.string	"\257==\260:6d\311V\266\2018\356\030D-{z`\033K\006\006\331\253\\\233Z\321\246\345\345\226[\272[\324`\245\250\250\360n>:z\251\305\216\305\221\262\302\315\357\360\246\246V\242\331\255\231!K\263\022M/{\371\206\200!;{\231\345\277b\345\025K7e\313Z\215\233K,G/\317\350\262\330f\334\\Z\"\3234\233RN)\253\f\361\031\343\302\344\256\354%\025:\235\314\033\223\2749\203\243\227e&X\333\01687\277C\230\024)\345X\036\332\033jN\207/1d)V\216\221\020\332\233\207\r\343\306\222\201A\366\302T|"
+	.ascii	"a\002\345e\224\377\302\225O,\235N\017/si7\337\261\243\227P\032"
+	.ascii	"@\244G\330\315\271G\023d\331\244t\262C\265w\f\003 !\223\201A"
+	.ascii	"\366\372B7\245\344\346\022\354\277u\245\n\226\216k\rI\230\233"
+	.ascii	"\361\266E\346;\314X\262\244LB\342\216\210q\b\234]\215\233\337"
+	.ascii	"\001\252DR\")\2238\340\256+\251_\374\240\201\243Lr5.\"X7\237"
+	.ascii	"C\362\353\313\256\321\332\323\003\333\\\\ z\302\240\320\210\273"
+	.ascii	"\371\034X\320%\221\222HiDo8-\034 x\334\310\314$)\213\2744\242"
+	.ascii	"S\205\306\025*\2652H\031\244\024\302\001\222\214\247\005\222"
+	.ascii	"+:!9\fJ\227\f77\237\003Y\217\036\345\017.d\366\364\3600\032\271"
+	.ascii	"\342\224\217\227?L9\307.\253\233\337&\207\375\337\001\322\233"
+	.ascii	"cev\3639\200\351\277\364B\226^\326\f\211\343~\322Q\323\322i\021"
+	.ascii	"$J\215\233\317\341FY,\213e\013\313\201\n^{zx\034\246\272\272"
+	.ascii	"\336\310\366\364\360\234\330\3618s\363'H\243o\235\330\322\206"
+	.ascii	"E\2266J\034;T{g5\340\r\016\fp\230\020-n\312\033AZG\354\236\034"
+	.ascii	"\263\370T\335H\343R&F\214\222K\357\275\237\204vT\035\034\243"
+	.ascii	"O\231\2724m%\215\227\\\272\210\243\r\234\233\313\255s\371\277"
+	.ascii	"\243\357\232Xa\271\371m\312\031\377w\210\232\250@u\363_\316("
+	.ascii	"e\330P\002\346n\016?\365x\361v\363'\360\242\313\2542\253l\241"
+	.ascii	"\367\006%I\366\332V\220\271\371\023\220\351\277\274*\2572\033"
+	.ascii	"\022\305\035\343\203\022\262\270\255+\367\206%\315\315\237\300"
+	.ascii	"\210\225U\331Bo\270\001\245\203\243I\336\361\346O\200C\377\345"
+	.ascii	"\013d\371\002\2431\"\333ZA_S\222`\341\264)l\322\354\250\250\312"
+	.ascii	"\026z\003\r\273\302H\215\267\026\267+\311,9\202\345\346o@\352"
+	.ascii	"\277\234B\226S9,\037w\226\316W\027\fz\256\374\b\303v\3637d\321"
+	.ascii	"\245T)\225\363H\354\031Z\354Nc\242u\3637\210\351\277\204B\226"
+	.ascii	"P\366\316\222\355+\236\026QC\334\340\355\335\005\203 7Mr\020"
+	.ascii	"\271\371\033\256\366\276W\356\235\275\367\346\332O-\004`OK\271"
+	.ascii	"\206\214\032'\345\276\3531\223\005\006\345\346ox\322\177\236"
+	.ascii	"c\221y\216\225\222\311\366\223\316\0244-0x{sa\340\003d\215Z\326"
+	.ascii	"\3157R\243\361r\034\274\2347\200\275\355\261x\205\265\271\260"
+	.ascii	"@<\273\311o\236\341\034N\316#\361\264\367\323q_\025ey\355\351"
+	.ascii	"\341m..\020\371\214\026\256\342\3159\257\315gw\330A\242\204G"
+	.ascii	"\325\3157\032\243otE\377\267\277\277\271\241\260\366\336Z\345"
+	.ascii	"qcE\371\230\277\275-\255\005\361\377Xl/\370\237\367NC\330{\312"
+	.ascii	"\212\230\275\267e\243\225\250A\335\370\260\377\037\304\336Ov"
+	.ascii	"\357\215EU\346\3654DU\006\265\251\250\210\311\032\242*\363\312"
+	.ascii	"\242:\356\035\032vY\217Mu,>\345\342\323\336\373\351\356\343\226"
+	.ascii	"\362\312\332R\305\247!\325qc\355c\353)\004&\225B=_\022\321\201"
+	.ascii	"8\302\227D\254\001X\323\340\bD\025E\221\252\2775\r\216\3404\024"
+	.ascii	"\202 t\301\207a%\372~~(QEQ\240\252\217\230\342t\"\032\3724\f"
+	.ascii	"S`\322\317\365\374\255(\021\310\207\256'p\310\204\232\340\340"
+	.ascii	"4\024\2020\301\372%\021J\303\021JC\"\244`\223\bJ\303\236`\322"
+	.ascii	"]Q\"\252\226"
+	.string	"D\237\322\320g\365\005\225\206ePi\210\227V\245 \n4\321\024Rb&\022Q\365\367;u\234\206B\244\254\256C\374C\203J)\360\324\371\241\304\246\034\024\246+\022J\324\271\352S\032\212\370qRWb\252\204\236\260a\003\r28\272\300\357l\232\200\007\300\263)\204 \022\300\364\\+Pb=\201\"\bW$\t(\340\002\302\025I\002=\027\330`(TK\240@\245`\212BP\211\016T\240$:\300\200\316\007?\027(\361;\233&\300\243\242*\322\013)\204$\f\245=J\301\324\002?TE*\002q\004\f\250\222\317\232\006G\330q:U\325\003\341JlB\352\200\252M\030\210h\bFDSEZ\302\357\024\222@\302\357\024\0023`X\323\340\b\016%\206\210\277 \004\220\210\020X\323`*$\244\242\353P\210\224\252&\210#\250\250\212\024I\035\201\244t\002EP\n\246L\352\331\263\242J??\324'\204"
+	.string	"\021\253z\016E(\005\323`\260\351\004\"\252\236\032\216\224\252h\020U\322\337\240\203\003t\240"
+	.string	"\025:\353\352\313@\203#\255>+\n\024\226"
+	.ascii	"\372Y\277$b\204\3220\203R0U\321\237*DO(\"\242@C@\327\363\004"
+	.ascii	"\037\241\2400%\252(\212\340\bL)J\f1\245(\361C\221\202N\304 \005"
+	.ascii	"Pb\023\320JT\233>@\211M?N\352\2122\241@\324\304\320\352\323!"
+	.ascii	"*\235&\204\251\t\024\"\tW\241ZbU\205Cb\360TMd\bRQ\246\324\304"
+	.ascii	"\017U\n\236'\326\364\203U\270D\f\001%6e@\201\3760\332\004<+\260"
+	.ascii	"\242\304\244$\t\240\300\337\b\300sM\225\322_\206`\312\324\243"
+	.ascii	"\342d\352\371\005O&&!R0e\342aBW\242\023\n\250\257g-\211>\035"
+	.ascii	"!\n\025E\001%6\351/\211\030AT\205\304 J\244\200\350SJ\223\202"
+	.ascii	"B\025g0e\272\220\"\303\032D\211\250:\\\205A"
+	.ascii	"$\024\300\037\324w\001\365a@\221\324&!\n*\272\242\027\234\326"
+	.ascii	"\024\351\034\236'\202\326\363\203\n\240\304\246\037\342\252\242"
+	.ascii	"@\017@@\211M\030P\2453(L\327!S\0231(D\352@L\211\250\212\256D"
+	.ascii	"\247\245\365<\201\002\bU:W\240\020\005\020\210\"\001\201MI\353"
+	.ascii	"y\002\005\021\020\210\202\340\244\242\353z~\200\"\251\302\244"
+	.ascii	"\"\247\0238$\246\030\326\363D\372\243\024L\203\352i\201\f\300"
+	.ascii	"\023)]S\025\004U(B\260)\204\365<\201B\303O\230\252h\211\244!"
+	.ascii	"\tBD_\211_:\364Ia\311G$\236\303\024B\240/\305\351\004t\224\302"
+	.ascii	"\322\022\322*\f^X\277$\342\227\016\215D\260D_\322/\035\232%\354"
+	.ascii	"\b6\004\373K\207\370h\r\246\302\022\303\246_0\265\200\206\236"
+	.ascii	"\024'\006\232P\370\245C\240`Z\302\352\301/\035\n\255HhR\322\252"
+	.ascii	"\242C\025\250o\005\246\253/(L!U\205KNk\212\342T#\220\256\301"
+	.ascii	"3\310D\206`zF@\025\256\247\212b8!\305\3514\004D\221\220<@\327"
+	.ascii	"S\005\372)\t\375\200\302%\"\232\n\207+J4B\231\322\225\307\351"
+	.ascii	"\004\242\277\036\fD)N'_\020O\nK>\244t=W\"\006'\025E!DBU\337\022"
+	.ascii	"\361T\221\200\200\212V!\020:tZ\205\322\036\245\340iDLU\234>\245"
+	.ascii	"\246\023\350OC0=\225\206\210L\276\337\211.\235 \020\n\201>\025"
+	.ascii	"\r\246\247\272\372\204*\322\271!\230\236JBC\252PUQ\rII\302\265"
+	.ascii	"\t\311\207\344#\2368/\240C\247\325\227AP\nK\276`\272\372:8Z\203"
+	.ascii	"i\223Na\311\247\342d*B\177\302\022\202(\222\212\2260\321aM\231"
+	.ascii	"R\022P\240R\320\003\r\301\364\214\300\320\212\022\321\023TTI"
+	.ascii	")UM\244\020\002\201\036x\360\241\304\246\013*N \252\372R\234"
+	.ascii	"N\276\037\272\236\252\022\272\006S\fAa\272\236)\244\352"
+	.string	"\211\006S\022Vb\223\272\264\022\225\301\364T\342A\221\202'\212\337\371\373\021\372.\230k\260I\210\344\003\002Q$\237O\2706\235\032|k\0205R\317%\244\2142\235&\240\3004I\250\016{\230\206B\3034\b%\236\250\212\024LQ\340/\365\005\235~EAa\272\246\304\340\251\256\031\224\202\251\322\251\242(\316\242\245U(d\"&\371Tt]\323\017lX\211B\341\211\2415eJ\201>t=U\237\212\223i\002\341P\005\352\013:\375|GIC \021\212t\252> \212\002\005\006!\371\224N\242o=O\240(B\177B&\037\361\227\0161\020O\246\016@\240P\345\220\016]\020\246\353\251\372\202)S\321O=S\250\302\244\037\212&q\320\240\242)p\230\256\300&&\237\212\256\3004\311\307\244\242\353\357\202`z*\371\322\241\317\367C\323\244\0248dJ\211F\350OX\302\316\227* \372P\246t\r6\235"
+	.ascii	"\264\372\024\260\006\323&\2355\330$\004\201g\r\242\252\332\204"
+	.ascii	"\344\263.\211\230\340\302!\252\216X\205BuDO\212\323\t\023}>?"
+	.ascii	":\002\341\003\005L\210\200F\022\261\246\301\324\247\242*R\246"
+	.ascii	"\021\353\222R\nL\032\021LO\246\021H*q\204\b\017(p]\205\352\322"
+	.ascii	"\252\201@\241\232\227\220\326tX\252\250\212\264\004\240P]\203"
+	.ascii	"B\020\226\220\202M'\360\002P(\374\300W\376P\340\2113\b\201\237"
+	.ascii	"\006\250\332\264\236h\222P\n!\t@KJ)\t\246\240\265i\2706I\200"
+	.ascii	"I=\211\351ohI)%A\224BH\302O\003U\270\nK\370\005\317\023\277\023"
+	.ascii	"\375]P\205+\322)BP\230*\235(\254\347\t\024\033\200\300&\021\326"
+	.ascii	"\363\004\n\215\256'1\210\016\231\204 \bM\240J\301\363\204\365"
+	.ascii	"<\201\242\350\277\271\2464\3623\344\n\206\0165\246[\020]\321"
+	.ascii	"G\225\331B\331\342J\215 <n>\372\\]\021)\336\2258t\312\2441\261"
+	.ascii	"R3\323H1\356\275\205|\316\260A3\273\371\027\364\320f\314\230"
+	.ascii	"uj\006\020\327\245\005\306<s\263.\037\211K\346p\301e\006\233"
+	.ascii	"\030\362\346_\020C\377&]fs\321\246\030\321\232S+\263\243L\357"
+	.ascii	"f\223\005\223\005S\316ba1\340JM\336\032\336\346\222\001\302\224"
+	.ascii	"3\321\354Q\356\210\217\233\177\001\013\375\233qa=]Ze7\310\344"
+	.ascii	"\274\017\324T\371\030\223\357t\354\274\230\2750\305\224N\266"
+	.ascii	"\222\304\221\001\367\206\004\016M\2320m\027\260@\331@\242\221"
+	.ascii	"\320E\214\b\230\262J\t\0257\347\315[9\026\202\2659w\346\0273"
+	.ascii	"\332\313\033\2165\323\213y\354\202\363\222\353\302\304G\253\005"
+	.ascii	"#]7o\331b\272\031\025\237\332\2302\252\276\226\370\214\345\221"
+	.ascii	"\201br\271\351\366\323\206\212\230(7\277\215\331\366\177\307"
+	.ascii	"\fs%'\357\346\240\2352kr\230yac+[X\262}e\267\252\210t\001\013"
+	.ascii	"\205^\250\323q\305R\032)!\244\230B\b\241\232\221\031N:\223\025"
+	.ascii	"@0\200L*\026\312\312\232\017\023@\302J\253\025\272 v\016!\241"
+	.ascii	"\021\t\"\005MA*\033c\205\247\251\tZ6\b\273\275\3479\374\371I"
+	.ascii	"\340\232x\221\371\t\240\214\360hsK\302\350\307`\020\177\274f"
+	.ascii	"\245\022\214\210\025'\022\244&\024\217\313\026\326\262q\006\036"
+	.ascii	"\222\233\376\314\262\372\255\324#S\250\202\217\222\253\206\312"
+	.ascii	"\303\226\361\035G\3739\262\2137\357\027\236\252\025>\217`\216"
+	.ascii	"\337\275\267<\003Xs\001\214\262\024\215V\345\245\352a\300\233"
+	.ascii	"Y\342\322\366tL\252\331\211\024\326\202\2512\217\220\345\207"
+	.ascii	"\177t\265"
+	.string	"\273X\356\226\313\224E\306k\241'\234\\\225\365;\312\335@\326GR\003KWX\357\221\247MRi\340\321\375L\331Ok1\252vr\024\326\b0U\336\371@O\037\021\025\306\b\016\002\3650,'\313\273\277\243\212IZ+\217\344a3v\254#\257\361.\3624\231w\322\352\322\307Lc\217\t\367:\203\362\276\354f\265\210\277\363\341\3320|\3448\201\031]\245^\r\242(\n\304\256\335\200\323#\356c\f\bs\264\0368\005\311\027\215\007P\016\354H8\362\332\250i\200\351B\316\201\312\n\262\223\243rq\202\321\204\351\006\376\026\007\320\222\3124\2065\226\213b\226\3547\201\261&\326\036\352\t\017\220\365\002\326\326))J`\306\311\320j\005\340\231\356\246\200\252\266S\227U$\235\006\355\347\034\301\307[\211\005!;\216x2\243\313\245(\346i\036\353\003\016 \332\337\311@D6P!6\240\212\005\221\370~eT\004"
+	.string	"\350\031\275\205\013\036\225\032\203\320\345\332\001\345&0)\333V\264|\325Q\264\321y\2321\312V\351+\265\342\270\251\02037\276\f'\2267\235\241(\234\356 .\0365!\327I>`kg\306\335\321\202j}\034\334\324t\243\020"
+	.string	"D\261\024X\213\317\333\311'\306\020g\307\f.\312`#$\245\311'\3466\325:6\355\035S\304\243B)>e\3462\243R0rKf\345\364\343\307\216\331\250\230\330\330*#J\220(\256\211\265\265\302CQ\331\022"
+	.ascii	"zZ\035W\362t\b\037F\217\247\307l\316\355D\303@:sU\233\366&\f"
+	.ascii	"i^i]\272\367>\300\213\221\3006Bj\271\022\343\370\034'\352\031"
+	.ascii	"$4\351@\320\346}%H\277k\307:PU\231N\235\234-\335\016q<\251l\234"
+	.ascii	"!s\177\262g\201\317\272Z\361A4\001\225\242\354 l\250\256\377"
+	.ascii	"Y\303\263SN\301\374\317\271`C7G\256\371Q\032\240\355\037\277"
+	.ascii	"^\207_\371\322\033Yx\221\275J\377H\305\001oX"
+	.ascii	"\037}\013#<\342\031\271\210\276\303\250\002\344\336\032\246\345"
+	.ascii	"\256\r\376\347/QYy\342\204\253\273*z\322\321'\266S\255\2736\036"
+	.ascii	"y\272s\314\376]/\"\257]\321\256\021\256\036\264\342\002\023T"
+	.ascii	"}].lyx\320<\270.\321\021N\035\274\317\330\0240x\377-\\ \367o"
+	.ascii	"\013\263:\353G\242\023Q\265\t\336H\026\001\030\203\267'\264D"
+	.ascii	"\327>\303\207\344\274?\341\204\245\222\234\200\217\215yc\034"
+	.ascii	"0\217\367\331}9\203pp\220L\244\022s\312\221c\030B5*i''\237\367"
+	.ascii	"\217d\003?\237\322vv\017\310\334\345??\276\303\262\376\217tn"
+	.ascii	"zh\335\272\221\322\255\256\205\260\356\222\222\2264\013\r\254"
+	.ascii	"\202\3773\254\311\265\376\3054u\244w'\237\236g\025\367$\261}"
+	.ascii	"8K\237r\320\365\366\006\204\230\240\356\336\323\2052\317t\272"
+	.ascii	"\017\322\342n\320\253\242\341AP0|;8r\034\177=\005\220\302\315"
+	.ascii	"\344\207n{\\`\245\320R;^\364\177n/9X\334\237\200\272"
+	.string	"\006\332\340\324;\351\275h\336hQ\260(\036]\376\204H\267\222\271\3039\227\005b\034\257\374\365<\2039X\256\206^(_Ec\214\245\331\215\013>R\021\026-\374\314\022\302\223M\311oyK\227\264\237\210\202/D\363U\001\333\244\004\030\021\263X\322\013@\2464\301\344\265z\212{\262\302\n!I\236B%\022\242\250\271\tRc\234;\250\246\024\007\222\222\356\246\207\251\310?\004U\305t\355\017\n\320\323\327/\374<A>C\233s=\262C\327\342b\346\253\262\2634\315\237\253*\251/\314C\312f\004\004\273\"\255\307l\312\355\334\366D'B\210\361h\326!`\003\300(\021\313\252Jj V\351\"\267a\231\363\305Id5\204\260\232%B\372\240\273\253iP\253\177L@\237$\023B\243\202\222R\204\301\277\234\210\3207\017B\f% @\214\234\224\266\nt\205\320A\224\373\211(\264\244\200G^\240\\\220\334k"
+	.ascii	".-\344\027\0370I\020@\013\020f\360\305\320\345\223\367\323\f"
+	.ascii	"\017\334\275Xc4J\006\341L\002\023{(\b\353\202\277\200\260L\372"
+	.ascii	"\367\301\254$\016\371mcX\n\022_\242\030\230\327H\020\303\374"
+	.ascii	"\315\363\302\245yqB\206P\360\235G\212\313\313\241\346\306\354"
+	.ascii	"K\364\317\022Q\331\352\227\353\327\303\223\2714\303_\024\350"
+	.ascii	"\232\200;G\322\311\315="
+	.string	"\365/L!\350\270|\300\241\375\354\006\005=\022\271>K\307b\314y^\210\22229\247\257\250\"S\026i\270\024\\\013\362\306,\2306#\024\345aVS\263@\036\244`\237&Nh\214\233\250\024o\271\033\261\347\236\241\234\3218Y\033\267\2738\365\240?\265\037\\l\376\361\345\317\033\243\234\247Z.*\277\276+\2048 \3249\246g\374\375\347\337\213\243\275\314yAK\250\247s\374\213\036S\334\204f\3171z\205\322\362U.\022\013\270\250wr\327\017K\033&w\307\353Jh\217^0X\333\220\300\271#\222\356\034\301y\330\211\377\313\032)M\007\336M\233\374\255\021\265/\0316\201\231G\341FP6\025\335\315\2508q\237^D;\354\020\r\004b\037\n\031&\220\253F\230\t\314\337\250\006\220|Z\315T\304\230\213f\244g\240j\006\216\024\3425\335\340\233*\307\276\206\310\304\374)L\022\020\210\200re\3552\376"
+	.string	"NE4Xtr\275Us\365i0\362\245\375\362\364\276\004\332\304\334\362\272>\254\336\347\002\261"
+	.string	"\302\331Th\377\tp\266\222\260\220\213\001up"
+	.ascii	"\337"
+	.string	";J\t\333g\246\361\265\003\272\035\032\001\312\223cX\236Z\006\tt\325\022R\344\205j\027s\032\"3*}i\266\tE\367f\302>\337}\373RR\207\3404%$\206G#x\301w\224\222&2\373\200\235g\373\326)m\216,\320\340Gp\333w\030P\213q\320J?\203\f\355\211\315fN_/s4[\032~\374b1&\035\311\347F\356\251\347Ju\354\b\224\356z\277\203\270\333\300%\225\034+g\32415Y3i?R\232\"h!\224\343\316C>\034#~\372\363)*C\325\3617b\236\315\267\373\327\004\362\036\210_\350\250\177\371\203\202\324\360\201kY\324\313x\233\376F,\342\312\247\316~\201\347\303\205\004\305\261\374f\344\311+\265\230u\343\036\272N\034\277j6N\024\024\316\371\234\311\270\254cZ\363\265\336!\335\221\246\n\300)\223|u\311\270\274\017\351t\255\274\2614\353\365\333\302P0\337m\007"
+	.string	"\320\212=\330\275V\245\322&Z\263\300Ze\213!\202\323\353\350\304\310\255\256\263\314q\336\335y:\022\222\352\212H\275!\322C\276\326\266\235E\250\343\317%/\224\257\314\1770\007\034d\337\373\300\214\024\231\025*L\207\221\300\030\227\301-\003*\205\315\353\277\272\310\340\351>\305]\033\245\2362sS\022\304\375<\250^dP\205\3743\337\257\334\323?\207\220\203&\326\233\354\n\222\265\3267N\314%l>\036\017\251v\214\f\035\354Q\340\270&:\365\035t\257JC\004<\333\357bq\300\353H+\032\340\311O\005\323\314\345"
+	.ascii	"\324\034i[,\312yY\213K\200\377g_\361\031\343\374w\275}\200\233"
+	.ascii	"\334\306\033\031\177#\n\022's\357-\226\213nv\273\367bI\245\276"
+	.ascii	"\270\340N5\221\223\325A\365\001M\003C2\336q\352H\351L\203<\347"
+	.ascii	"\326\202\\>\343\263\323\004\016"
+	.string	"\005*\223m\267\326`\231\002\026\255\0032V^\037\267a\274\342\001\275:\200\030 \033\321\322\333\305\272\326\316\340\367\275S\327\310\222\272\265\244\220\273\003\035\0359\266\035Y\330(\376~\3114\016\004\355\3718T\226\355\031tD\b\001\203\235\206\325\b\031\252\316\004*\245\342/)9\261C\262\201sC\240a\3256df\253\340\002\202g\221l\255\003\330F\307\306\223e4\004/#M'\342*\342\332\353\317E\327\355;u9\213\374\227\241\353\246!D\367\b\033Etic=\002\362\\\313\273\025\027\002\037X\337;\200\247\355<\326\027\027\207\210\367\006\264\204\322\326\311\373\21655bIM\314w!\212\203\352)\357\030\303\373\277\223\247\242`\"\272\324\267]\037\263\350V\202\031\225\316\204c(\025\302\373>\313\337\210\204?\247\201\362\372\200\326\321a\021\234\352\221\260,x$6_\025\344\013P8\240\324\f:\330\200.4\021"
+	.ascii	"\375\020?7\322\315\036:\005\t\212\rD7\322\274\301\027\254%\240"
+	.ascii	"\316\214\001\234-\320\323/\366\026>\2550\260\230\231\025\261"
+	.ascii	"6[\342\231\300*pp{\371\177\336\0063\370i\003\346\322\343\220"
+	.ascii	"\001\252K&O?\030 N\217\274,\320\253\2572\001\231c\226\036T\254"
+	.ascii	"\203\365\256y\374\353\354u1_\207\362\032\362C\306?S/\234Z{\362"
+	.ascii	"\357\205f\322\365\375\314\226Lg\233D\275\035\327p\355\374\246"
+	.ascii	"\356\264\325\211\003\255\214q=\205O\344\254}(\344Q\246}/\272"
+	.ascii	"\235c~\347\211N\311\237(\340l\371\316\362\365}1\241yJ\364\250"
+	.ascii	"\204e\243\367>4w\030\333Q\363\367\212yW~d*\307H\370/\305\006"
+	.ascii	"\013\245\323\177\355\216\217^\031\257],\003\276/\3049O\263\201"
+	.ascii	"Fx?\201]f.\3129\316\370@\331>\203)[d\233\302\371GwS\030\357\r"
+	.ascii	"{6R\361\030a&p\372\007\257W\207/\3239|\230\033<\226h\352\341"
+	.ascii	"|M\274I\230+?\266@\323\034\310!\343\266hhC\235>\212i\243\233"
+	.ascii	"N\247\277\350t\322\351t\276\260\321\025]\207.\034"
+	.string	""
+	.ascii	"\030\374\331\316\376\211-q\317\365\327\006*:\335\241\274\305"
+	.ascii	"\212\326\025"
+	.text
+	.section	.gnu.lto_.symtab.d3897e904b8cf1cf,"e",@progbits
+	.string	"mixerRuntime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"loadLaunchControlMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"mixerModeIsFixedWing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"getMotorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"getMotorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d3897e904b8cf1cf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3453 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0011"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\215\006\235\032"
+	.string	"4\036\201\007"
+	.string	"E"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\351\324\216\302\003\034\002\001\002\002\002"
+	.string	"\002\002\002\003\002\003"
+	.string	"\002\004\002"
+	.string	"\002\005\006\006\002\005\240\342\234\212\n\005\006\007\362\365\342\222\017"
+	.string	"\b\354\371\300\225\007\t\324\255\363\265\005(\002\007\002\007\002\b\002\b\002\t\002\t\002\n\002\002\002"
+	.string	"\002\006\002\003\013\002\f\r\307\311\355\207\004\004\002\r\002\r\002\003\002\016\017\220\244\252\337\013\020\003\020\360\377\277\257\r\016\002\003\002\017\002\021\354\311\256\346\002\b\002\022\220\365\337\202\0162\020\004\001\002\002\023\312\277\301\216\003.\005"
+	.string	"\002\005\024\374\261\331\271\016\036\003\013\002\f\025\314\340\342\311\005 \027\343\341\347\313\013\020\030\266\267\325\202\b\031\316\272\311\226\001\032\230\332\304U\n\033\344\314\221\333\t\006\001\002\002\034\216\274\314\212\017\026\007\020\002\020\035\036\037\316\355\307\337\013"
+	.string	" \351\231\307\322\004!\206\343\305\337\001\002\"\300\262\372\333\f#\237\360\363\246\016$\223\222\265\232\r\002%\301\257\362\360\003&\353\215\233\240\r'\363\317\227\227\016(\204\237\210\222\005\b\007\002\016)\366\256\204\212\002*\325\355\331\202\r\004+\246\271\322\206,\276\327\374\313\006-\333\314\346\311\005"
+	.string	".\263\205\252\345\b\001\002\002/\233\331\374\3260\203\220\302\2321\253\370\264\266\t\274\002\001\002\001\007\021\002\002\001\004\001\006\006\002\022\005\006\006\003"
+	.string	"\006\0052\352\263\360\321\b34578\330\264\273\312\006\0029\260\210\265\205\003:\207\256\207\265\005\006\001\002\002;\203\356\250\351\n<\264\256\370\317\r=\372\363\332/"
+	.string	">\232\331\336\275\017?\365\355\227\351\002@\207\312\266\244A\320\374\270\356\001B\336\215\314\344\rC\204\365\230\332\bDEF\315\320\230\nG\365\342\205\274\002HIJKL\277\332\376\350\b"
+	.string	"\200\276\250\361-\241`\254$IJ\303\032`\202Q\206\312\350\001\021\3404\2050\"\")H\222\366\016\344w> \361\3447\212Cw`\233 N\371!\305\263\316\231{X\310\276\317\371\027\316~\210\177\337\005\202\277!\333\322\202\310\t\203\360\3255\223/m\004\340\247_\340~\213M\fU,\365\027U6\361\025\354\256\322\365\257'\345\021\271apR0\302^\247\227\026\344)\344N\357\013w\2303\362w\235v\356G~\202n_\001$\323\320\243\215'\310\300C\036 Sk6\004h\361dJ\035\025\tp\344\351\271"
+	.string	"\002.\262\230\374\241l\256"
+	.ascii	"1k\253\375\3233\276\272\035\365\3275\334WJ\027>$\033\365\374"
+	.ascii	"\f\260!\261af?^\3367,L\"SK\300q\224\264J\222\246\325\\\352:\244"
+	.ascii	"E\216\234x-[\242%\270m->\306\303<Z\327\353\311\251\243G\216\372"
+	.ascii	"\201\003\025\234\210\224a5\357\321\270\343\257!Y\352\2159\210"
+	.ascii	"\270P\233\217\271\272*\356v\375\262\334\366\312\035\270'rl\317"
+	.ascii	"\265\265\367\347\263\246\343\224\006H\313\355\275\t\353w\227"
+	.ascii	"W\332\277\254\r\374\ta\240+E\226\226\213z@\310\n\345\347\215"
+	.ascii	"\035\356\370\350\032\004\242\334\360\316\366\242\307?\245C\365"
+	.ascii	"\304\005\320q\363\313p\177\304\260\314\207v%v\247\202h\350\355"
+	.ascii	":\376\020\371[\232\247\344\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`S\002\255\t"
+	.string	"\302\f\"\037 u!\035!\200\200\200\200\200"
+	.string	"i\210\267\002|[4ywF\253\237X\2644\302\t\221;\245N\223Y\262I~d\"!\023\344\217=f\307\346\223F\210cnh\264j\245\2613\031\245b\354\305\026\025K1'\246\304\214\230\020\017\323\341\206\212"
+	.string	"\233w\322\342\f[/\254\302'l\204r\037\030\250_\240u\376Q\326\223\262\326~\26405\302\234\213\232\b\264\320\316\200fV\227\332R\n\224\013\370\235\312{\365\344[j\334IZ\250\201\255\224\254\024\244\320\034\200\202\261+\326\001\021\240\245QR\t\225Jv6\003p\217'\373\352\341\252\212f\352\343\033.4\216x0\b\247\023<\321k\b\177\342\204\377\024/P|>\336I\204O\364y\354$\335K\037\r\336ZjPvU\267-W\b\207_t_\246\004\212\265\270\031\275\365\213E\013\220\003\";\305\177\214unfq\346K\337\262 74\306\2231*\313\331\220\231!\242\2337\034D\327=\037`\232/\260P\337<l\207l\005k}\231\027\206#\201\002\005&\241XN_\341\213\352M\212\005\030\312\240"
+	.ascii	"\007*P"
+	.text
+	.section	.gnu.lto_.inline.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`$\016\2453"
+	.string	"JG\364\016H\200\332Q:\354\344@\021IU\253\227\024\371\356\343\0065H\335\3102ry\302\277'\237\353\310\231\214\225\221SL\367y\272\237\253o\377i`\213m\006\345\030\255\271\004-I\201\365dWT\370]jI\036\246\273\344\223-e\n\321"
+	.string	"\334"
+	.string	"\335"
+	.ascii	"\250\323\177\007\254\353\246W/Zff\t\016\200\247\236\007\326\372"
+	.ascii	">\337?\256V\311q)\003\302\255\311\324\0135s\2772u3LM\311\201"
+	.ascii	"\247|&V0Xj|$1\325(7\3360+\034\350\264?\227\352\325\231.\256\376"
+	.ascii	"\371S\330-\262\254\300r\267?W\374\267\377\001\232y\004\032\240"
+	.ascii	"\213o0\252\255%B\367\361!9=\260\333\276\232RA\267\377\031O#\356"
+	.ascii	"\037V7_\320\f\341\253\363\277\256s\315dH\271.v}%vXsF\216\227"
+	.ascii	"\271\316\317\277\017Y\177\3669\211\215\274\367\356\364\317L\265"
+	.ascii	"\354^c\317q\374\363\371\375\277\2472U-&d/D\314`\002G\013\005"
+	.ascii	"\036\367;\330\367\336\213\376'\032\352\336\313\240\377z\242c"
+	.ascii	"\334{y\177\204\003\361\002O\222Pd\330\367}_n\262\361\"\343Q\246"
+	.ascii	")\2434\360\371\317k\346\363\347-\336u\323Q@a^\027\231\327)\370"
+	.ascii	"\347'\274\353\024\305\353`9r\005\306\313\236\363!}\316\023H\f"
+	.ascii	"\026K\373\364\301\226\252\352\222\221\336~\251\233\360h\223d"
+	.ascii	"\2663qr\360"
+	.string	"\374\304\252\244\212\207\025O\375\212K\r\230\253]\310\036\275\317\243\367\251\324Q^\256\326\257\231\314*cxn\323[\245\352\306k\016\362|\333\267U\3527H\346\024\251\277*\025u$\242{\372_m!d\371\302\376\303\246!\026F\206\304\316_\321\377\273f'\274k\247\376\233C\240\273n\35239\205\f\355\314\007\335~\376)\356\377\231T\223f`Xq\260}\224M\261\r\270\275\r6\222+\246\022}z\2415\242\177\260\253\322\240\245\241\001g\304\316\274\021\220\250\371\037P\242vz\237\205E\367!kU\324\021\353\374\241l[\023 \246\226\225,:\021r\312\2142\355*8\264\316\202>\364w\355q\357\265\265\022\257\316y?\323\237\375\264\f\365\342\\\2538\337\377\274\367\t)\327(^\313\356\275F\337\245G?*\321U6\222\030\317wZ\220%\326\231\324S5r\254u3\352\210e\337{\260o\223kL\330G\344"
+	.ascii	"\331\"\002w\0165w\361Pm\212\302C\335t\020\350P;\035\347\2456"
+	.ascii	"D\314\277\256\373\271\375\177\363M\352\247\246\016*|\276"
+	.string	"\347\013\2545\306\330\204\331\275\367\336R\013\021\273cn\357\336\273\227T\315\342$\327\370\351\323_\337\370\232js{\247\357T\251r\255qa\362\355=\260\307\262\300\326,\033\2236.\366\347=\260\006\357P{]9lx\006\t=\366\264F\315]\317\327a\005\272\006\250'\373\f\030\356N\237\310\016.T\366\027\332\205\262-\215\275\005\256p\3371(\b\335a\366\300\346DQ\367!q?\003\260|\376\317\355>\344\215\231\031\b\255V\314\266\214\366G\321Y\302(\245\340\236\212-\244\331\226vR\341M\220\020&ed\213}\004\245\252\005\212Y\231\256`Y\314\274\311U\346\327a\355\262\245\213Qw\b\265\t\347\272\370\340\347:\345\270D\242\275|\261\343\254oO\361~\025V/YVc>wp\326\240\317`\330TT[K\354\027\374\307r\\B\331\333\003\215\365\236\r\325L64\335\025\254\271\367\376\020\353\023 8`"
+	.string	"\251\210\205}{\201`E\205\315E\340\177\260\036\r\353\331\275\027\367\001}\304\005z\245\353\013\315D\332U\2019\250!\271B\306L\215\210\210$I\222\326\201\004\2041\206Q/{\022"
+	.string	"\0059\007\243\3128C$\"B\212\222B\335\001N\017\306s\214i\314\316\240#\017\022\301_\231\360n\236\215\240\362/CQ\311\3230\271\"7\274\324Z\224>m\221\323\004\230\276\245an=\233C\266bF\217\024.\337\007\336\357\276N\255W\006\001%-\016)[/\225p\211n<OKE#\342\211<\325^\362\352b\270\354\221_\222\334J6\003\324zx&"
+	.string	"\255\312#\211\244\032\207\244{\304\240\307Y\345e\341\310\215\360\244\342<~\003b\231\370\t \1779}d\320\007\326N<x6\340#\340\247\220D\215\025\345\n\264\262Q\241\033\267\020\334a\n\376\217mI\027xIK\234y\246\347\211\364\330OV\352\036f\bu\222\243z5\306\264\367\257\350vO\021\320i#\1775"
+	.string	"p\306\351H)\250Sf\273\357\\\246\355\224\343\271\207F\211#`#\324\020<\342}\2201z\371\202\002P\006:\366\347\214\023<\227\216\037\325A\303\032\017=Q\003;r\320\006XGT\355~\221\376\253E\364\260\204\211\261!\237l'\034\037H~\367\005\271\332w\340\263\r1|\026\366u\341i8\252\242\003\333[\013\367_\354\301\320\335\362\b3h/\210k(\026\017_\231.\302fp\331\273\352\205=\036x\357\205\330\037@n\025\2101L\274\333E\f3\265\230\013\032,\221\0307"
+	.string	"\017A"
+	.string	"Bh\215\201Y9^\303}\334\255\003\274b\312\3508N\343\260d\305\253b\353B\363\206`\247oum\022\375\250\331\337\036\224\200<\3553\233\313\024~\317:\027\261\355\025\0053u\022\224\321\342\347\177\301\301D\002N\227\177\202 \202\311\315(#\352"
+	.string	"$\323\023\031Y\242\325\262\254I\364,\317^Y\f\223\317\243\200\373\205\240f\262\233\203s\306F\345\220\301\007\275\315t\253\224\346p\270\f)\204L5\214-N(\b\2054%\243\325\202S\270\215bA"
+	.string	"\304\304\355\267\030\206\224\355\032\202\237\354\027\024\206\217\317H\372\3440\005\"\211\3615|0\032\265\322=\300\222\026\271\374\261a\224"
+	.ascii	"\372\211\022\017\017\226\251\023\215&\350\232\267\321\337d\031"
+	.ascii	"\020!\342\f\301B\025\337\201q\210\222\302\036\273\215\006z\332"
+	.ascii	"Ew\023\371\315h\016P\341\352mP'OS\321\020\264<*Gz\224\301]Y<"
+	.ascii	";\r\366\3508\034\023\256\241\244\"%\004W\336\215\346d2\023,\034"
+	.ascii	"\356\245%/Z2\216\337\223=\216\341\377\361\244\035\326\302\362"
+	.ascii	"\024\365\260\246B\004L"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`'\bU\027"
+	.string	"v[W?"
+	.string	"s\223t0"
+	.string	"\024"
+	.string	"\240\350\267\324\321J\222\021\204\326f\"\251\251J\375\353Y\341&\256\252\352\275\252\252\222@yf\376\240\037\023\314jnh\274C\330\377\177<\301\343\360\210\370\377\344\223&e\n?"
+	.string	"C"
+	.string	"K"
+	.ascii	"sxq\035\315\304\222\027[\002\240Vo\323;=\026\222\325f\027\272"
+	.ascii	"p\036\255\032H\255\376\332\250W\221\031\016\004Z1\276\2200xl"
+	.ascii	"idK+\357P\206\232\f\305g\317{\3678d_y#\n\240^\306G\207\261\352"
+	.ascii	"\330\337\261c\232\313\314E\214\365\236\001\234\321\362^Z\373"
+	.ascii	"\351\235\364<\240~?Hf\004|\037k\243\210\323k@\234N\037R( \001"
+	.ascii	"\346E\312\340\006\3269\274H\222\221\274\211m\n\333\003\fTRL\277"
+	.ascii	"@\201U\372\004\217\340\017\274\201G\021\025\370\023R\f\362cm"
+	.ascii	"\324\021\347\272\256\253&!\221\346\004\313@\222\"D\253\354\364"
+	.ascii	"B\310\202N\354c\251x\221\025\307\342Z\374\240b\226\347G\241x"
+	.ascii	".Z\213\301\360^\334\261~\032?\206\277\320a\261Pb\322\263*P\370"
+	.ascii	"\t\022\276P\204\207@\272GtG\016\034\225\207\246x\343HL\024_\211"
+	.ascii	"3Q\206 F\204\367h\304T\264A\326\340\b/\265Yj \254\032\025V\246"
+	.ascii	"\036\247t\360\rVN\221\306H\311\254^\200\275\250qU&\246MAj\fs"
+	.ascii	"\200\002\021\232:v\022\340Aa\f\346Y\216"
+	.string	"!\207\310(HZP\310\326n\302\001\322\251\021W\016(\343\025\177\346\\Ee\363L\375[C\343\221\361\001Z\373#\211\033\351a8\034m*\272#[\344_\353r\b(\335\367]\202\316\205\323\bJ\201\366!\375U0\200\303\330\301F\204\333\357`W\275-\340\201\257\374De\305\276b\211c\365\025y\206\3515\322\215\314\b\212>\207\315\244%\210\027\350\017\037\224\345T\332Y\256\017`\221VFu)\346B\300\006\031\334\336w\t\354$('\255\362\355-\361\266^b#'\222\006#\n/P\262\363\205y\f\253\304\277x(;_4\360\245j\316\321\367\314\347/\320!\373*\220\215\rd\333\362\231s1\2744\016\310\357\n+k\365>\232|B\nP\201^\324\n\263)\356/s\2303=\226\3279\023#\266\230\030\016\353\270u\334\323\225\363T0\003\211\b_\013P\355e\2754\005\235\345\261\217C\026@\256\317Y"
+	.string	"`\361\305\375\264\243\207\006\203r\213+\212\024OA\232\314L\264\256h\211\347\020\370\002DY\213\243\370o\261\252 \321\347\2466\222\273\255\013\234T\211\236\236tR\256\360m\214'l\367}\357\020H\303\0328\202\371\201>T\216'FR^\235(H\267\033\335\256\177\272\177\260"
+	.ascii	"b\365\261\216\273\350\006!\321\305/\375\017uk?\321\246\251\323"
+	.ascii	"T2U\006"
+	.text
+	.section	.gnu.lto_.pureconst.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 \222\225\003"
+	.string	"\"\211\033  E%\035}\205"
+	.string	"\343\031"
+	.string	"\022"
+	.string	"\022"
+	.string	"\022\240f5<\""
+	.string	""
+	.string	""
+	.string	" 3\230\210\240\025S*\t\2635YsuU7uQ\363tM\2674I\337h\212\356uC\003\200\346gzn\347r\276\315\325\314\314\304\314\313\264\334\312\244\334\311\225\334\310\205\334\307u\314\306e\334\305MqK\334\020\337\3413\334\302G\370\006Wp\0037v1\306\002\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\364\003\005\020"
+	.string	"\366\023@9@\305(\303\001`\035w\3450G\321\335\327\236?\017]9\314\267N\340a\307\300\032X\245\3212\361\302\332mi\340\273\370!>\343&\252\005\0304\3203\310\321\022B6\2212\005,"
+	.string	"."
+	.string	"2"
+	.string	"\240rPk\360\032\235\225\362J[\360)\317\350\264\224s\255\236\004KU\004O\300\201\322\311\351\277:b\036\362\253\225\277\226\365\316\224\177\250\235\034\235\233\316\255\326\\\255k\300WwuZ1\204,\313&\253{p)\277\324${r\016\205R\003\223\334\250\365c\335K\275\324/\343:\003\022\021\020[\346\037\036\343\220)\317\364\262\265a\233\341\177%.L\205\357\\iY4\001"
+	.ascii	"\234L\025\371\325miU;\372\227\260Y\025q0\230\347\305C\001\177"
+	.ascii	"\270\317H\t\207\275\310k\244\307\n0\004\004\353~\037\036\177"
+	.ascii	"GG\233\350C\236\215oz\275V\3565\317\337\341\220\210\361E\t\240"
+	.ascii	"J\246\215\305\202\025\024#\315D\200\202\250Q]S5\223\022K\007"
+	.ascii	"`\002\021BE\365\021\200%\024\034*\221\231\264\265\003h\253\323"
+	.ascii	"R\361MA\235\313{\341B\322e~\236E.\017\242\341\007BL\255B\277"
+	.ascii	",\273\367\362\332\300L\355\037!x\353-d\373\320\3374G(q\272\313"
+	.ascii	"\022\275A\024\354\004\205\341F\001\303\302\"\031,\031\016c\003"
+	.ascii	"5\232l\225\026v[<M\373\016u\364\212N\232\037\3709\266S\363\205"
+	.ascii	"Q\215\020\252\312\034d.\215J\243\351\005k|\006Sc#`\203\253t\214"
+	.ascii	"\003t\373\237P\025c\372\374\312o\373\237\267\233\331T\003n\246"
+	.ascii	"\251\245/\035h\267U\221R\235\373M\353D\255\002\211\274vJ\265"
+	.ascii	"\260<r\312\350\255\300\007;\254\006\3661\301\322\367]\r&\235"
+	.ascii	"\021\327\240O\306e+v\227\211dM\257#\352\374_wq\352\374*\003\202"
+	.ascii	"&\207\250\2566\272\034*!\337\350h\227\027\016v 1B\3673\255\213"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_.lto.5fa3d52826d3641,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.62.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.72.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bk"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\335\221\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\327\006us\350\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\370\343"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.74.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\005\001\006\035\001\001?\202\210\200 \177}\275\001{\275\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.78.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\bl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\376\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\274\003\005\001\006\035\001\003\216\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\200\b0\313KQ\204\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_resetPidProfile.79.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\275\b"
+	.string	"\346\321?8@\217\322\001\273\006\002\034\206\026\316i3\202\232{\320\006\340\024P\001`\201\366W#\201\254\017\323\"\016\342\023\021\355\323\231\230\002\341\326\036\300\320\271\305\022\346\276%\233\354\235R-"
+	.string	"/"
+	.string	"."
+	.string	"\330g\346\003\330\247=\233\345\265c\217z\2710Y\355.\225\034\367\036=\377#\007"
+	.string	"K\337#faw\035\301R\306-o\373\300\266\202mU\273ki\262\177\372\3435\nW-\006\255]\214\226\313\252f\312G\214\267\257\261\375h?\344\"\336O\024\027\3305\245Nvk\202\0212\237\256'\bV\301^_\322=\265\262K:\350\223\034\025\272\356\361\351\211\016;\370\351w\330g\224\266\304(\036\264\004AYVH\222\237]\277(7\354_\033\036P\366\3218\206N\266\005\230\263\351d\033\025=8d\240\017\215\310\032 (\207\013\321M\201\265\315\303Q\221\246qTS\367\327J\223/V\310\n+\244\2051\361\032\017\007"
+	.ascii	"2\241\311/\360\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.80.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\214\001\305\017"
+	.string	"\226_kF\360\262&\0352\207?\030\220\n3\326-\242\262\247CH\333*)j\037.*\244LA\211K\205&^\224\216\273\265\240\327+\264*\255\001\rX\335&B\033\270\251,j\030\301\237\035\006\224\273`&D\204\220\275\345N)W"
+	.string	"U"
+	.string	"S"
+	.string	"#\016\321>\r\336"
+	.string	"\366\251\275"
+	.string	"\366\351\220\255sp\304>\254\321\322\332\261\273\234\212\260^\202\267\214\241O\2511\344g%1O\220\322\361\231D\237r\300\356\0060m\220\f\242\213\211\024\345\211\323\365\255+H\331\370L\247\307\254dw\035?\223\207\033\273\355\217m\007\366]\001\317\316\272\345\243U\243\243F\037\200"
+	.string	"\230\033\017h\354rx\371\330\233\031\243\304Y\277}\177\305C\226\313X?\350\250\330\335\203~\313\033\213\257Bgy\206&\352\240\205\241\315\316\356\212|\272\201\366\211@\262\330\333\3477\333\217\366a\236\n]\225\341\004vQ\256\027\273`48vK\377\374\026\247\361\344I|\332\002\b\373\367\351\203\260OU?\274\200!\376\363\303o&`,\217\235\222\212\0345S\325\327\224R\374t\333`\327\250/\241 \305\227\245^\337\372\004\221\302i\3711\212/\325\335\025\251\276\330 )~w\327\212\262\265\253\036\335A(*]\212\367\201p\322y6\233\220\234t\036ne\202\204N%\205\253\320E\240\300\231|@\034\311\001{\036\224\017\267\342y\037n\003G\377*\312\217\271\346\"u3R\322\324\027g.\325Ts\242\310\245\272\214\\\352U\253\034\r\261\307\245\364\202K\325Bd\344X\341\310\204"
+	.string	"\211\237\371g^\003z\035"
+	.ascii	"3\241\363i\f\246\001\205\332\256\221\265\314\230]\314\214e\314"
+	.ascii	"\340\035\266\r\025\354\210\246\021\230\226\202\021.\207\246e"
+	.ascii	"0\013\346]\332\240Z@W\313\201\270^\245iV\255\004\342\342\206"
+	.ascii	"\210\262\301N{{\016\370\223r\347\232O"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.81.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\245\b"
+	.string	"\326\320>;0\345(\035"
+	.string	"\276O\222b\200FJh\177\261L^Q\025j03!\244\267@\005\264O\364\030N\254)\337'\211\023\344\214\240\300"
+	.string	"F\013\322\302H\032$6\376\003\213d\223\275S\n+"
+	.string	"."
+	.string	"."
+	.string	"\357d\237\006m\231\257>\366)1\030(5\273K\245\307\301G\320?\311\265\020ez\f`\330]\307\020\245q\313\3336\260\255`[%\273\226)\373\252?b\234\231\227\005\327n\306+\300\266fK\310\306\366\243}\221\217\200W\231em\327e\205ew\021| \360Y\360\201\354\023\013\0174\255\223\274p\224v\305O\314\342\300\354n\202_r\023\222\017\362i\213R|\370\351\227\262Om\303\005\200\343\024_\366\312\024e\207}l7\325\373>\225\003q\333\326\020\252\334\347@\342D\035o\036\210nD\277\t\211\016\024AE\335'D\267JA=\004\366F\\\245\237\347U\272Y\355\261\225)\007\b"
+	.ascii	"2\241\235/0\343\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.82.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\215\007"
+	.string	"B\21635@\217\322\001\360a\274i\321\224}\302Rc\037\372\353\362\024hx\277\025ze\277!\376\270l\324\346N$\217\261g\030"
+	.string	"\330\263\340\305X\222\312\370;d\367\2262\245\326`\030\256\r\354@<\\\021\016p\342Z\220\200\232\214\0031\004\3066\r\031\354`X\006\255\270w\253&\247\005!\0259\365\352\364\215\214<D\024\017\001I\315\230\363\224I\002v7\343\177\034U\341k\374\331\302\223\337\376|\317\345\357:\260\202\n\345\312\216\240T\f\373n\325d;\3552\235\231\376\023P\245$\234\354\222V-\213\362J6l\337\366\307\266|\200\360\261\366\230A\372I5\022a\331\215PO\327\236\232\377\216?\216\224\312V\002=\001\024v\327\271\225.n\275\201m\223\f"
+	.string	"2\241\271\037\330\314D"
+	.ascii	"\327\001C,%\007D\345\240\013\371\316`%\\\313\322\024\370\314"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_pidStabilisationState.83.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"=\t"
+	.string	"V\222C<0\345(\035"
+	.string	">\333\024\026\330\215\205\361HO\250>7\245\206\005\342\353\244 \226\250c\266a\237\rI\362\032]\235\203\375wh\"i\bA\013\336!d\r\222\024544\331d\357\224\002/"
+	.string	"1"
+	.string	"3"
+	.string	"7\330N\265\027l\247\006m\231\213!\373\330\270\2012\333\335:A\016^\202\376M\276Y\205\250\313"
+	.string	"\210\335\265\\\205\035\367\274\355\004\333\017\266[\002\037\366\265\335]\317\226}\327/\245\364\351C\326\214F\"\266\3131\006X\026*\033\341\330\276\264O\362\022\360\256\2237\273\0361*\273\"\203\025\004N\021\002*\177\332\245\3034\006`v\267\301?\371\013\303\0279u\206I~u\352\233\266\323\005\225KJMJ\216\376O\233\234\237\016+\260\327KL\246\222\243-\242\344\f\241\317\363Mx!\221\250\363\276Q\027\001\342H\004\376t@\034\251~\026\025\234\210\242\2168\317E\375x\245\3329pG\ny\365\353:\257r\304\275\266\263e\032\262"
+	.string	"\314\244f\b"
+	.ascii	"2\241\317/\020\302\20530\352\022\026\261\032\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.84.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidGetFeedforwardTransitionFactor.85.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504Po\322\001 ;\351\025`\230\373p\375@DJ%\215d\252\326*\317\365\315\372z\\\026\201x\006\310Gef\257F\022\3247\227[\223s\030\321\222\275\245L)\326d\026\252\315\343<8T\020\rO\242R\210x\232k\342e\nlm\030\256\307\261\254\353Qq\257\242T\314G/lS|\304\031\300\356\036\370\"\217\025>\351\316\026\235<v\347w\246\273\324\200\220O\226\354\350I\325\260\337VE\366\323\251\002\035*\t%\273\240R\313\246\270\023\016\333\320\246|\217\177@;kqD\372\n\b\203\204ew\037\346\004\323]\373\300t\247\033\207O\350\037\344\r\305$\303B\236\347\005aw\235X(\343\326\033\330\036\005\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidGetFeedforwardSmoothFactor.86.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504Po\322\001\240\234b\324\210\244=\305\312\336\020\270]\\\374&4-\016\305\255\371z\\\026\201x\006\310Gef\257F\022\3247\027\323R\342(l\220\275\245L)\316`\030,\315\333@<X\021\016o\302Z\220x\031\214\342a\f|i\032\260\267\271.\354Qq\257\240\324\312\243\030\266+NbR\300\356\"\370#\217\026\276\350\316\027\234|v\347s\246\273T\201\221'Kv\354\244v\330o\253 \373\351\324\201\221\212\002\313\256F\351eS\334\311\207mhS>\310C\240Mj1$\372\nGF\211\313\356\276\352\005\323];\301t\247\036\207O\350_\344\r\305\244%\373t\236"
+	.string	"\t\273\353\314>\033\267\376\300v(\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidGetFeedforwardJitterFactor.87.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504Po\322\001 ;\351\025\200<c\233\315\007\"4\340>\342\232\266Q4+\232\365\365\270,\002\361\f\220\217\312\3142\210$\257o.\246\245\304Q\330 {K\231R\326d\030\254\315\343@<X\021\016o\302Z\220x\032\214\342e\f|m\032\260\307\271.\354Qq\257\241\324\352\243\030\266+^bR\300\356\"\370$\217\026\376\350\316\027\235|v\347w\246\273T\201\221O\226\354\350I\345\260\337VC\366\323\251\003*.\n)\273\032\245\230mq(\037\266\241M\371 \017\2016\251E\321\350/\036\031&0\273\373\252\027Lw\355\004\323\235v\034>\241\177\221\267\225\023\226\f\344y\002$\354\2563\003m\334\372\003\333\242\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidGetFeedforwardBoostFactor.88.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504Po\322\001 O\302C\200a\233q\365\301\t-J\032\311T--\016\305\255\371z\\\026\201x\006\310Gef\031D\222\3277\227[\223s\030\321\222\275\245L)\336h\026*\316\353<8T\020\rO\242R\210x\233k\342i\nlq\030\256\327\261\254\353Qq\257\242\324\fH/lS\234\304%\200\335=\360G\036+|\322\235-<y\354\316\367Lw\251\001\"\240\314\354\370I\335\260\337VE\366\323\251\002-+\t\331nF\366\262*\016\305\3036\264)\377\343 \320.\2658\"\235\245\003\243\304ew_\346\004\323]\373\300t\247\034\207O\350?\344-\345\304\004\013}\236\030\204\335ub!\215[o`{\024\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidResetIterm.89.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`/\001\215\r"
+	.string	"\266\030YD"
+	.string	"\223\232\016\370\210\007?\202\204\342#2\013\304\321N\361\003$\256\235v\270\207\307 \005\211\231\255[\271\f5\322H\241Q\341\344\320\\aTU%\200\024\013A\006\236\300A.\265C\233&`\202D\310\336r\247\024C"
+	.string	"C"
+	.string	"G"
+	.string	"\027\271\200\210)\355\256\245(\254\227\341-\343\366)5n>\025\322r\0032rt\036\367)\003\354."
+	.string	"\357\203\\\020S\274P\224+\276\353\303#\220\241\351\274\357\221\n\331]\307\316\033qO\267\235\331\376\330G\t\252+v\310\305\257\252\330\007\301\373\024\207\304\r\007;vC\324\374\330\2319C\305\301\333w\361Co\316\342/\333A\327\2508\021\325\013\321\013\217\335\375|\332S}\026xg\372\224\347L\237\337x\263u<d\3317!C\203r\"\024\303\243\216\017\343\"\354\202\026\337i\323'\365\341\260G\266\343\001\033\303c<\032\300\300v\207\273\310 \200ew\033\2648\314\006?\305\2479\230\304w\237\276\311\364\371\360\236\317F\251t\022kTw\227\013\332\245ADz\004\364\340\"\261J&H\270(D\260,\\\"\025\254\221L\263@\004\214\221@\310\254\022\f\313\254M\270W\225\226W4J\314\234hh\352\212AH:\251\222\342\347\327\024\005\277\276\007\f\311C\364q\271\273+\235\340\327I\003\036"
+	.ascii	"2\003\376\031c\205\306\211\375]\002\313\022X\0212V\265.8\242"
+	.ascii	"\021#DA\302\350\252a,\341\026\230\246f\323\036L\233`\256\353"
+	.ascii	"\360\323\254L\033k:;\301\252\225\027!\202\314\270q\243l\260\323"
+	.ascii	"\336\236\003\376\244\334\271\346\023"
+	.text
+	.section	.gnu.lto_pidUpdateTpaFactor.90.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\333\002\325\025"
+	.string	"\306\250\216H\300VQ:$Of\022o\006h\177\363\025f\001\230\266m\252\355^\366?\252@\005\317\306\364\027\027I\353x\253\256J\336V#\002\025\3742@\034\375\277\204\310\033!\200\031\211\334l\374\177\023\021i\277\342Q\311'\233\310\235Ru"
+	.string	"o"
+	.string	"\202"
+	.string	"\274\220\006b\300h\304G\322\356\"\370\364L\370i\373\322~\214\313\230]g\236M\273=f\344\330\335\004>\020~\302\\"
+	.string	"\370\371\275\005\374\364\314N\362]\212=\016\"\0165\232\354\356JQ|\366\371\251\234\371%\032\223\355F\373\034\361\3573\020\244\004\322\313\017\020\021\247\233\217T"
+	.ascii	"\267\r\037\314\356^\350\322\303\255&e\211fw-m\267\0207x\333\022"
+	.ascii	"l;\260u&9\341\n\036\360S\252I\367\032\267\301\343\2570lG\336"
+	.ascii	"\366\351\357\200\237\327\224\013$\030$zd\317\336\321\244\346"
+	.ascii	"\354\177\273\273V\0236\313u\277j\345Aw\352\273\033ui\225K\237"
+	.ascii	".\235ri\323\245\303)]\002\245\301K\317)\375Mi\375\244\245J?@"
+	.ascii	"\013\217 \017z\273\037zP\366h\352`\361\335\037t\032\027\362)"
+	.ascii	"(\203ME\217\005;\007F\343\217\024-\031\215@)U\251I/b\210\310"
+	.ascii	"\bTs\221'I9>\315I\225\0268\241D\356.M5g\225\246\324\345\304\021"
+	.ascii	"! >\362I\211#A;&\241\256\350\215J\032jihL\002\265\344\372P\r"
+	.ascii	"\250'!HNt\346\275\326\001w\264f\320\353%\361\331\355\211\231"
+	.ascii	"\232R94\266\370t\352\313\2201\t\003\211\273\bT\375\224\300\220"
+	.ascii	"\361\247&{\226\252z\016Q\374:\216\233pw\025\37074\004\242\316"
+	.ascii	"\013\026\273a\271d\rX1\021\345\022Y\020X1\261\344\302\021E\230"
+	.ascii	"\314F\f\335\222\251\360\212\255D\233\232\027\216\205\225\316"
+	.ascii	"\213\225\263j\311.\254d\\\f\213\271d+\021\006\223\255N\273\275"
+	.ascii	"\232p\016\356'\207\213\"\315\263-c\376\002G\364\261(J=D(:\352"
+	.ascii	"\321\232U\324\236\360\"\363REv\234\007\005\233\325\222\267\265"
+	.ascii	"\300O-\262-A\251\350C\020\361F\240\332\\\321\223\262\250D2\266"
+	.ascii	"HQ\223\236\024\f6 p\202\031A\253\003O\001'0\246\016\2039\"\204"
+	.ascii	"Q\346\331,`g#\366\023\b\210\337u\222\257\0035\n\027\216a@\030"
+	.ascii	"\025\004\260/\204\3636`\201,\350\300\335a\321\360\005\211m\016"
+	.ascii	"\367\177\021\360Z\024\360\341\3610\266\021\0317\222\306}\354"
+	.ascii	"\020\2721\264\205\245\n@,\204 8K\337\307\230UQP\037v}\326W+\303"
+	.ascii	"\300\262\341;\"\016\301\034\231\320%\016xi\305\262\220\333\365"
+	.ascii	"\364"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.91.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\215\n"
+	.string	"\026TJB \251*\035(\303\217\271]\b\243\333!\202\337\234t\300\215o\032\360\025L\220\265\004\032\005\242\",\216\337\270N@\344\324 \255P\262,"
+	.string	"Q'@@\265"
+	.string	"h\364EJ6v\220\217X\302\310\336{\247\0248"
+	.string	"7"
+	.string	"6"
+	.string	"\007\036\214\030\240\260\273U\242\374\373\224\361\363\317\372\005\fI\237\233\311\345\234\210%\220\320\020\236f\006\245\002\236\365H\022\232b\\\260\330]G0,\271\351m_\330\256\366/\001\376\352\2471\372\332\003K\003\214\b\273\250Y\205\205Q\005+\030\333\217\366\005|\300\367\225\021\370\262\273\200\301kw),\261\235F<\243\235\316;h\247\376l\bo\251\366\001\262\330KZ\244]n\270\034\234\242\3146\310]\242mw+|\002/\020\342\247\234Zd\024\017\236\372#\355\364\222\002\230\020`U\2123\273E\212\362\304\376\334\335\265L9\234\217\347q]\307\333\274\321pxB\325\353xx>\035\365\303\243\001\252\233NT5\020\346B\234\256z\034\327ULk?W\246\234\321\002+I\323d\210T\332 .\036\364\224\244\253\002\016"
+	.ascii	"3\241\037h\214\254\241\336\260\227P\255\202@(B\364\034\002\f"
+	.ascii	"\230r\t\266YM\021w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.92.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\235\007"
+	.string	"\242\r35Pu\032\003"
+	.string	"\n\3301\f\226\020\320\304d|\032i\026\370T\257*\\\277\314\215\334\350\027\355\232f\374\364\b|WU\331eg\223B)\303\316X:\210\334R\246\024\r\201\0360\321\034MH`\024\021\323\002s\250\230!\355b\202\b\232\211 \2649\3122m\312\356\276\016Q\f0+\023\344@0\313\212\212\324Q\261\f\334\366\300]e>\251\377\n-\206S2\004l\376'\234\030E\243\036q\354\006\351\231s\254I\036GY\243*\3111\275V\333\225\036\fi}\035\242\332k\340e\246\001\347\367h\355|\025cH\332Zvko\334\245n\027\220\216\026\326\377\tE\274\371m\265M\034\300\235J~"
+	.string	"\013\377\373\270\323\207\013\335\266\240\355\247-M\016"
+	.string	"3\241\321\037\270gn\001\303"
+	.ascii	"\356\300\301\272\312\314\020\304\315fx\256\341d!\214\227!\300"
+	.ascii	"\245[\264\363\t"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.93.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\335\n"
+	.string	"\306\324I=0O\224\016\304\340\314\265\216\272\321\361!!5u\203\253\326\246e\264\036\226\302\354:v\373?\321\013\0341\207Y\376O\336\341\244\024\220\224\201\001\257\316\366>\021B\220\244\005\220O\366\2262\2456"
+	.string	"9"
+	.string	"6"
+	.string	"\033%\347\240\016\3377\250C\325\360\354O3\363\037\224\347A\005\013m\353\374U\026\256\221\r\364$\273{\021\317\320\366\311|Pv\327\251m\025nx\333\006lG\373\003\002\360\334\377\316\335\371\364\251\016S\213\0030v)\234fl\t\236\340`;\263!y\316\2355vS\2540\261\273\004,\240:\264\355\203x\210\314\356\336h\203\350/D\023J\230v\003O;\251\235\355\fpM@r\001J\031\266!\234\344\256\332\335\002\376\210\223\210\340\213\016-\201\223\327\016}\016ux\205\035P|\340<y\262G\235\324\f\366\337*\006;\226\f\206Y\327\005\253\\\231(\300h\"va\200\311,\210\0160\b\032\304\312\265\211\023"
+	.string	"\2664\226+b\226uE\310h\257P\375\362ijH#\027b\224<\372y\257\312\247\366\203M^\203\032\024"
+	.ascii	"X\b\b\303J\026s\b\021\301\t\260k\250\266@\016\202\251\b\023Z"
+	.ascii	"&\034\327\304\216\211\254V<\215\t\"*\334\001T>F\r9\324\344\355"
+	.ascii	"*e"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.94.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\277\001%\020"
+	.string	"&_lF\360\262&\035P\374\003\007^\227|R\20483\253#\341\333T*\033,,\303g\177_>-\301uh1\265\006\361\365\263\266k\004?\030\265xF\306\034\250\013\212\302\374\274\274\360\367VodX;\b\221\266\267\224)\005Y"
+	.string	"S"
+	.string	"X"
+	.string	"\b\266G\333>\213\267P\3312\03031\363\034_\207\035\037\273\333\211|@\350\021\036$\364\2502W=BM\225\257\231\300\025>=^\260\325c\210Ch \306\007\004\t\320\b\035\"X+5"
+	.string	"\214\005\212\354\356o\236-\260\225L\315dw\235/\330\207;t\333\021l7\260S@6l>V\316\354\330*\265\204}\270J\302\346\216so\377~\355\337\035\237\206O\353\323\371\364\001\024\210\001\2020\333}\231\375\330\237(#\305qn?\346\347\340p\330V\036\b\270\234\200\261cw\023<z\301\366x[e\213\362\237e\346vg\320\210\261\273\n\0345\\B\333\313\020\372+\225\244\007\346\207EW\326\324\262;[\273\254\221M\237s\310\303\247\307E\263\222\263\303\260\274\320@M\017\240\220\321\251\321\312\240\334\335\225\312l\347\310u\202\016\216V\006\331>\375\205e\333\3562\360]|'\345\317<z\203J\376\365\350\253\204\036\257QE(\243\223i\244a\364"
+	.string	"\004\225*\241R\016L\036\312K\021\371\244\004\205T\352P\026*\220.P\3500\220$\244t'\246SW\022b\25742u(\3173u\242\330\036\246\306\335\260\371 \247\206\252i\324\026\333Q\177\363\273\300\210\370a\351J\324\024*\247\312\343\252Q\205\ny\\1\251W\325\220\035W  P\2021\264\250\007\362\030\034`@\f\203b\270e\b\031\"+~5\216\257\200\013\342aFQVT2\354\2340\261E>f[\314%\202\024\225"
+	.ascii	"ad\301X\023\037\022y\004\003J\230\342\002\030\344d8\004\230\217"
+	.ascii	"f\310\313\212\205!\267K\351\001"
+	.text
+	.section	.gnu.lto_getLevelModeRcDeflection.95.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375` \002e\023"
+	.string	"\206\245\203I\300\322Q:r\341\\29\347\326\314ga\022I8\031\275\016\022\373T\342\t\215\030\035\324.s\362*`X\365\237\356W2\003\t\206;lH\232&Ah(\225\350/\343As\f\020\031Y_\256\310\253?J\376&D\312\224\002m"
+	.string	"c"
+	.string	"r"
+	.string	"\271!'\2519'\202\207N\240j+X@\273Q\216wN\037\032Js\216+> >\264\355\253\370\n\232\355\003G!\"U\022\323\016R\2179\247K\345\002\344C\360\001\344\303-q\332\301U\232_;\370\336'(9\371r\272\236/h\340\351\007\007"
+	.ascii	"\335\rD\361a\352\371\356\312\243\263\251\252Z\346\234\326\234"
+	.ascii	"\016\304\035\3366\005\333\021l\355\020\026\331\357w\017C4\361"
+	.ascii	"\330\t\242\243?{\254\351\006\331\007\347\002\331RMr\336=\362"
+	.ascii	"\361n\335\350\027\221j\226T\207H\365J\252E\251VI\265\224\352"
+	.ascii	"P\325`\250^P\255\252~\t\201\031O\025t\314\351\341\367c\326\b"
+	.ascii	"\227N\234\367\217W\373\366\217\374\036\217g(\352\201x\232\277"
+	.ascii	"3\313\0375\210\265\017\003\002E6\337\177n\034\215\323\020~\277"
+	.ascii	"\251\333\234:\005\302\035Y\315\201+\262\351\317\340\206{\202"
+	.ascii	"\204\223\332\005\367\034\016#\347\275\2509\247\003\373\365\027"
+	.ascii	"0q\316\311 i\003L\003!\242\233}\317\306\322[\334\305\215O\344"
+	.ascii	"X\214>\367\320\217\221\017u\337\373\n\324T\n\021\217\261\343"
+	.ascii	"i\304n\220\237#E\326\304\304\217\327tS\037^\351\327\226e\320"
+	.ascii	"\347Z\253r\333Z/2\032\034X8#\213\315^0\231\027\230\204\230Wl"
+	.ascii	"f\323\262\211\341\270\200~\261X\210\321\270f\027`b2/\256\231"
+	.ascii	"\230\013\006\327\253\306\306\305bb\031\r\254\3065\223\311j\\"
+	.ascii	"\254q\036\234\013\344\357\276\"\301\302H[%K\262\254\345\261\315"
+	.ascii	"Z\267\350\254\r\fYqI\026\005\t\347\263\332\220M\221\201+\262"
+	.ascii	"\357\272\332\024 8\024#\253ZqO\220T+\241Z\333Z\271\357q\362\341"
+	.ascii	"\002$ @\002b\220dub\204\346'\322\r\302Vi\257\004\r}1\037f\206"
+	.ascii	"\0024\316\013\261\313-\216`\030-a\237\337\027Fs\2343MI\357\300"
+	.ascii	"\345\266\300\252h\313\310+\370\2744\326\3053L\2074\362Bo\230"
+	.ascii	"\314ap|\342;\030i\350\f\346\257\204\0054\242\255\006\253+C\001"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.96.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`M\b-,"
+	.string	"\232N\364\020Fp\\N:\273j1\255\340p\236\"D~Z\343i\317\216\024S\306\263E\311[?D"
+	.string	"\340\212\241\266bG\367\211\372\035\323\375`\360b#:\344\0067\374\261qEp\032\261\360\324\240\026\207\211\266m\204\020B\344N2\376"
+	.string	"\336"
+	.ascii	"\001\001W\231\317\374.|%\377\274\270\210A\344\211\225\312\306"
+	.ascii	"\205\223]sE2\250Z\226\262~\356\026\030\330\026+\374,\374\343"
+	.ascii	"_9\226\253\253\265\370\365\272\307\242s\223wA\375\371c/\204\362"
+	.ascii	"\357'\363\245\360\247\234\n\377\220Zq\025\324\237i\234\\\332"
+	.ascii	"\372\271_]L\266LP\177\236\314W\374(G\343\337\031'W7u\024\250"
+	.ascii	"?\177t\241b\205\025y\t\311\203s\357\215\372\311P\352O\376\223"
+	.ascii	"C\271bN\232g@\206\244jw]\310\273{/p\351D\350O\363B\350\317\376"
+	.ascii	"\361\253\377|=5EO\263\355\025?"
+	.string	"u`2\231c\343%\206\365\237\017\007\223Y\330\230\3551\251\251\003\0362n<\375\2310\033l]\026\035\261\366\025\207\207\214\261\237\\\3264\221\310\334f\374L\330\230\351d\246\307\233\237\330\226\355\036\261\325\\\272\367\036\355\366KL\313\332\324\301\275\227\255\227\230\2143\317\231\031\0133\257`N\227\001b\336\006\202?\344'\013G\234\374\021\350\317\246~\226\233t\224,\233\034\227Z\251\231:\302\235\325N\313.\331\366R/\220\262\355sC\307[\251\225\220\353]\226]r\317F\235\231x\302\336\353}*\007\312\2531\007n\253\261\230\317\264l\2271\337\274\367^n\037\314S\b\244\242\356\345|\300\300\217\347\002\250e(\324\362\323\327\316N\250e\002W;7\265\345\001m\231\351i\347\245#\317Jm9\351\\\316H?;\007h\313Gm\331\250-\027\265e\242\266<\324\226\205\332rP[\006j\313?m\331\247-\367\264e"
+	.string	"m\231\247-\377\332\262\257-\367\332\262\332\226\323\3232\332\226O\323\262iZ\356\266l\333\362\201IN\314P%\357\005[\332\271p'\233\221{\371\271\374k\277\332\237\366#\377\343\177\026in\023.\247\256\247\317v';0(\202\036\352\251\026\241\266\232]\013\240\021\264\251\\\311\322\346i"
+	.ascii	"}4\267\266Y\351\3715O\247wV3\246\376\235ursV\272,\273\374\351"
+	.ascii	"\241F\355\264\254\257\177\232\355Z\347k"
+	.string	"tmm+\320j\367\372\311?\270\223\253\262\036a11\2209N\265-\036\205\317\275Q\233\201\334_\203\013\354\210\231df\333\224v1\355\315\302\3458\031\227\366i\207\244c\357\275X\335e\214\001E\273CZ\233-\213\307\314\027\256\006\203z4O\243a\003\007{/\016\350O\264\317%\310&\307\344\263\254A\242\343r\203\345\022o\353\336\254\246\263\013\264][\315\240\372\354\243\275\311\213\314\n\347\251\t4T\277\312\233`(\315~rj\263_\254Q\035\256E\372V&\230~ys\352k\271Q\025\271c7\201~W^SwCP\263\3421W\335\255E\333\001\302l\3651\301\256\213\273\367&\bD\241\261\252\202\220\310hU\365\300(D1\f\242\360\255\240\262UT\266\003\225\ra\0041\f\026\215\026H\004U\004%\f\211,\204Eb\210\241!Qh\254\032\nIX\r!\030\207\301b1\205U\020[My\020\232"
+	.string	"\032C\200\020\222\370"
+	.string	"\034\n\253J"
+	.string	"\255\212(\200SGL4\021,\002\215Db\021\370;\313\272y\333\007\333F\273o\207\362hZ\256\217\241\341\223\362\005Q\222\235Smw(\217\275"
+	.string	"\003\036c\254\t\\Vk%\365\200"
+	.ascii	"\235\364;j)\243.\352\243>B\256fHm\324Gw\326\266\242\276\335\\"
+	.ascii	"r\245\363u\031\237\355'\030;\325@\317\f\230\2674\252\221\372"
+	.ascii	"\213\231\221Z\300\022!id\266,"
+	.string	"^o\311\311' y\006\212\312\210Q\0174QGu#\355\324!\352\036\2257:G\241\356\351\003\335k+\231\326\022\2560tA-\324\007j\237\016j$\345j\326\323@\235\244\\\217p\362I~|\372\312\237nn\312\304\341\301\331\222vYO\027\003\200\234\250q4\343\024S\246hf\024\244\005\245tp\002\0311\253\316\001\021P\251C\320\220\005QJ\355\006\320\003F\314\264\302\036\003\022\353\270\337I\245q\031\336\233\016\223\003mp\356e-2\350\217\330)\200AI\013\270GgAa\377,l\311x\343?,)o\204c\243\023\016\232NiLNr\230\006dB\224k\2722D\026\312\237w\343.`\367\017ZR.\2508pH\330\225g\237oUoY\263\374\020\001\321\242EQ\256 L{\204\231\033n\305\220\213;\316\245c\\\274+O\233M\004\203\236&\245\247\264\024/\230'c\337\b\035\024n\212\220\331"
+	.ascii	"\363\034b\314\t\305R%\257J\b\250\202\245Q\001q\363\261\016r\275"
+	.ascii	"\276:~]\023eg\361A\275\374\2230\3610\243\331\250uk\007|\347#"
+	.ascii	"{\340-\355\216\357\374^\353\336Qk\240%\305\r?\232&}\221\030\315"
+	.ascii	"\263\352\314\006\177\262\232\231\307\310\347\375\003\224g;\227"
+	.ascii	"\276\201~\032]%\320\323<0\022n38!\256\2312\032Q\322$z^\223\212"
+	.ascii	"\332\243\356!\253\351!\376\020\355\215\266\002\256\023+\354e"
+	.ascii	"\306\023\326\020\305\262@`\343\351\222=\323\r\tT"
+	.text
+	.section	.gnu.lto_pidLevel.97.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`|\005\225$"
+	.string	"jD\340\016Cp\250M:\023\250h&\022\350$Y\r\230\022\031\017\206\312L3p\246YE\034f\303\246z\340\212\243e\333\261\275\271G\375\320\224\301"
+	.string	"R\00704.\232)\200F0w4\300\223\203\332\3326B\210\334)\005\327"
+	.string	"\300"
+	.string	"\345"
+	.string	"^Rv\370rfGc\363\254\3653\3366\213xZ6\357&\265\211~\231\227\231g\306gG6\266\027df\344\266|8!\241\270\265\325Z\037\334t\212R\214\317J\244\352UT\333\260an\020@\252F0[.Pj\177\354^\210\377\222\343I\265.aC\253u,\202!\214\345|\372\244\331XWk\022-h\265\326\b\226\312\335\264\355k\371\026\242}V\216\205=\301\231\375\351\"KTk\355%x\323y\263\374\322ys\235\234x\334i\226K\211\376\313^bI\304\007\371\265u\334\220\237Cn\226M=\242 \217\276\216\245\203\2664D/\323A\313\335W\220o\351"
+	.ascii	"lN\220\243\257b\331dGI\240\2439\365\3722R\212\323Pk5E~\375\270"
+	.ascii	"s\267]\303v\020\333\364\005\364Hs_vS\315\021\343n\371o7\233\323"
+	.ascii	"\300J\255i"
+	.string	"\027\221\"}3\335]\223\321\261\355K\367]\215\\\3655\277\\\255F\013\276\232\0202rOr\2347\277\2706\210\024%\271\350\233=V\244\313\304~Yw\211\245\030,\270\230_\301\321\356\250\223\271\241\036\346O\240\243FPR\037\270\231\373\351\311\337\300\277\374\005.\346\036PR;\225\324M%5SI\275\244\243V*\251\223Jj\244S\0138\365Q\216:\300\251\001\344\250y%\365\356\324\272S\347Jj\034\216\372,\251\315\222\272,\251\367\324\024G\375\006\337\"F\266\003\350\246\326\036o\213\352\232\231F\312\321~2\277\231\257}\373g\3744\363\320\002Gs\335\0218k\215\316\350n\017\254\227\245N\004\271;`\376 m]\352TZ\004~\236\353\361\340?1\b\021\364H\021\347M\245\3455a\244\210H\322\036X\250\245f\307)\305\263\237\331c\345Hu\206\26777c\255\\QH\233\264_\244-\240vl;Z"
+	.string	"+`qj\307)\001\366\310\016\211\233\365\251\325\210\301.\361\265\023u\210I\024\037\023v\343\274\031`o\346'\ro\001\370\303\325TX\300`\257\370\034\026\025\302j\255\026\342\\N\013\333\305\013z\344\213\363&\217\006\022\353\003\306%M\211\333\247-\327\364h\250H\323\016\331A\262\313\304O\273[\"B\256\030Q\203\207\216\221\272Y\267\273\334\352v\031\035\013\345\326d\323\325\350\\\334\236\355\330\366\346\334\t\210\026)J\232\273\373\264W;V\021@\245\326\246\362\005\266\222\240e5\234\302\352\001\203XXA\252\002V\303*\240O8Dq\345\243\341\033\001\f\342\370\t\203VL\346\006aP(\364\355\206\300_0k\350C\001\343gb\b\364\t\2053\250\224\260~\302\024\276\253*\340\224\316w\365\213\021\024\232\200\361\313\332i\375lL\225\246\222"
+	.string	"\343\227\325\033ZU\375\256b\364\200\277)\254\036\225P\253'\201\200\203Y>ao\030\f\n{\2741\256\227u\227\370i7\t59\027\354\t\325\241c2\330\001\003\316\003\254\310\032\327\026q\n\326i\027\200\025\267i\235\326"
+	.string	"\031\3242m\323\342\030\211}\220 \246\245 F\226%\031\245\205\310\205\036\031\265O\373\243\200\001Y+\356\326\303\334\332\320N\250]Z\006\273z\216U\212\304.\007\344\263\234\357\347\1776p\350\320\341\274\271\304&f\b\214K\222\313\215\216\036T\314e\342\026\307-7a\250A4\003\tB\216\221!\021\031\221$\225\016p\"\021S\265\036\021"
+	.ascii	"6#2-\354\006^\361\002\"+P(/\221\223_\020V\260C\033H\214\007t"
+	.ascii	"\025\020d\244@\361\0179XJ\305\362\274>PQ\317^cf\223\356\357\027"
+	.ascii	"\355\245\327\016\r\235\033\224\223\b\254D\374\2748a\277\323\005"
+	.ascii	"\241u.\b\325\325\246N\013\223\254\b\213v\372\342\"\016\304\224"
+	.ascii	"_\271\272-R\365\237\350\001\322\342`)8\353qrLld)\233\323(r\257"
+	.ascii	"\222:\306\223F`@\036\354\377:\203\265\343@Xh\200V\261\231\320"
+	.ascii	"\216C\257\330\0247\n+]\205\253o\374\007/\307\tD\346\030\307\313"
+	.ascii	"\242`\210\340,]4\315}\"\006\001\210c\"?\\\016\001\260\ndx\342"
+	.ascii	"Yz\0315\304\367\007"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.98.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\256\f\305>"
+	.ascii	"Zj\204\027CP\236N\007\373wb|\004\350\fz\b\240\007\363\\\220\341"
+	.ascii	"\230\373\373\275\017\203r\353&<\364~J\277?%`\025\374\240\003"
+	.ascii	"\220\301h\004h=g\225\230\032\237]\306H=\237\310E\332n7!{\357"
+	.ascii	"$S\ni\001D\001h\001\261\216C>q\037\213\267\346{\356f\334\365"
+	.ascii	"\374\273\035\315\235:ug\314t\236\307"
+	.string	";b\257\021X\207\316\243E\267k'\243\327\242\270\005\006@\307\032\023\3008\216\233\234m\255b\236\353V\207\347a\236n\327\30431S\236\335.\325\357X\270]\277\036\337\240\263\335,\272]g[\267\233\356\314\263\365\322vh#\330.-\310\034\336uX\267\274hc\034\233\321\335U\370,Z\016V\344R\207\f0\216\243N-\225\345\374\n\354Xd\030\001\305\3219\262\2738\226s\352\007Eg[\256\350\271\333\2538\034\354q3\034\254H\245\216\001\306q\026\247FPtV\311\211ZgW\037j\235m\270\233\216\313\241\305\3045\035^Z\006\3438^\376\231\303\256\034\022\n\002\372I\"_\367h,\022[v\375\f\267\023\245\214_a[\256$J\r\251\271\220\222\034\244\226\226\201\226\240\345\237dYF\252\r\311\357z\300\357\210\234\243\262\275\036\316\006&$\273A\226\330\300\210\344\243\021\b\033\030Y.\022\245\226\314v"
+	.string	"q\3421L\314\3335A\331^\217d\230t%\362;\"\307\303xevMBB\204\320\325\200\215\255Jg\372\274\3340\032yu\303\242\371\325\200\251\255Jq\034{\235\347\033a]9\023\245\3428\356\374\025\266\303\233\310\273=FwS\351v\235\001\355m\327:\333\276\337"
+	.string	"\262>\373.\r\344\352\340r\232\032g}\342\231\230\267\276\342&\227\203\375ig\327j\025<R\225\303\271\277h.\364\365\247\016\376?\253\231\333\373\340U\020o\376\275\316\231\370\240\336\301\033\341\361\352\223?\301C\275\347\371\032\245\r \030=[\234tu\bo#\202M~\247?\317q\034o\375O\333\235\255\277\21198\321\\\330\335$\334\317Y\214\343\370A{\032\357+\321\256\346lSUe\377\252j\235\365o\252\"\247\f.\216+\037v\313u\345\237v\373\032?\222n7\367\204c\356)7\267\004\337\363\216\340\346\206\340f\274\243\216\271\241\334\334\016\234\316\275\201wqg\340^\334\027\270\236\367\322\261\270?y\026w\005o\356&\337\342\236\300\315}"
+	.ascii	"\231\333\200\233\233\t\231\273\200\233{\311\315\255\204\314\235"
+	.ascii	"\344\346&\200\314=\300\230\033\351\315-\340\315}\364\346\016"
+	.ascii	"\360\3466zs\027\275\271\001\274\271\211\336\334J7\367\3201\267"
+	.ascii	"\320\233;\350\315\r\364\346\376ys'\337\334H7\367\353\346v\221"
+	.ascii	"\271\217nn#2w\321\230\233\370\346n\337\334\354\233{us\3771w6"
+	.ascii	"\346v\n\276\007p\320\216\226^\034Mu\"\313;\340 \006\252`9\f\036"
+	.ascii	"B\0046b\244u\226\350\335\2634Ge{=\336\237f\345\273\230\333{\312"
+	.ascii	"\335\360\024>\313\376\245|%\237a_\327o\311\375\264'\374\320C"
+	.ascii	"\341\264\214#\337\030B\203\023\234\372\tB\237\340\247\336\357"
+	.ascii	"\262\r\021\271\206\320\277\036\037!S7\274$\323hjQ\216\302L\224"
+	.ascii	"\\\271\013^{\002\267e\377\202\333Zg\305\370\246\fr\345\303c\320"
+	.ascii	"\330\267a\360?"
+	.string	"\037\364.\246\360P\352\344\347\313\232\252\254\256s\276\002\227\237\374\237o\363\242x\037\303\344\377\274\321{\213\243:\235\233\266\"qK8<,\214\3061\027\023\362\227\377s\244l\357#\377\310P\n\350\276\361\337g\363\244\307w\013a\267(\250n\370\315\ta*\017\320\364\370 \f\007[\231\312\3765\325:{\374\2504\274\342\033\337\341$\216\207\202S\253q\034\205\352\256\340\202\026\212q\034}p\0076\273\340uh2\336\311\370\332\246g\f!\236\361\247j\234\370n6\007\347(g\307\320vg\330\220\375\213\370S<N\b\001\243\277\025\241\213\225\300\342O[\204\264\005z\017\343\306\"e\374\330\326X\366\233\376Fw\323'\253^\347\b\274\304t\275\361\022H\\\277}\240\357,\025\354j\022\203\203\326\266\317\376\330\017(j_\326\3609\035x\254\251\256\026m\365\204e\225E\345<j\253'\246\263\231\265\274z:\235\317\252"
+	.string	"0J\344\251#\364\t\2052\215YW\315\347\212,f\207\023M\rB\314,*\016O\250V\212\"\326\007\246\263\351!\353\212\t\205\266\250Bb5aP\255\316&\324\003SE\212+*\243\026\224\351\342Y\305\204\226\260\302\242\202V%\273\352\351Ds\3052\313*ES\005\212\345U\223\312\271\254\202b-\237\214\372\271\202\t]f=\237\320\245+\307\345k\374H\330=\200\204\200\\\337\245ts\016\220b\025W-\253\"8\364\323n\022\031\2123\251\332\206\344\362f\212`\021\n\334\024\241\237\266\204_b\233\343\213\360\022\336i\316\201g\372\b\217dh\340\017<\241\220\307\2409\241V\r|\036\223V\340\231\232\300n\316\207\tL\305\363\250\025xG\343\253\02517@\325B;A\020~\211GV\002\373H[\022\352\363\027\027\365\020^\201\241tP\351\t|\324#\241Iz\2453\n9'\311I\237\251\177x\003\236"
+	.string	"\022\330\315\363T\363\021\230\212\013V\263\331\200\3673\276\302\351\271y[\002\203\307\017\b\311\3558\322+\323\370\350\213\316\035\2113\367#\340\350\005d!\231H\331\220\354\235\327:{D\330r\321\243\221\f\360E|F\037\300)\003!\0333z\367\214\315\033RG\223/\344O\273\350\001\274\263\211\345\037\331G\321{\226\2778\242\007\360\331P\252 \363\b\200\373\250q$D\221S\310FD\202H\222\024$\215\001\240\002\021!\243\252\003\021 -S\316\315\310\224\2449]u\370\232\005b\365B\260@\332\264\257\323\353Ir\205\214m2\004\235\205\357]\223\354\301\213\337-\034\303\365?\306\254\227\362'gW;\207u\325\r\235e\\Y9`r\002\220\262\207\346\250\247"
+	.string	"z\024\323\220\2631\251a\202\215\350WG^E\206f\360z\207\233\273\241$j\263x4T|\247\215R\363\036\267<\260WA\232\\AQZ\031^\221\037\341"
+	.string	"\334\017\3501n\353\313o\340j\257\344\355\200\036\024\222\225W6\364\221\227,~\345"
+	.string	"*\240\021\356\372\206\256:\002\220\332\214\276\324\254\243`"
+	.string	"\242\307\213\322\274\026\232\233\324T\340\341\"j\263\275\347\322\263\334\351\027\2547\001\214\243\2700\272B\247v^\310\312Ui\321o\210\261\206Z\335p,\360 \333H\033\021\333F\r\301kKE\032 \036-\201\367\0258\202\277\261WHy`d\266\206\273vw\221\257^\032\354F\206^+\343B\0026>\013\tyQ\266d\214\257\3201\323\307\302\216\204\226P\214\260\016\326V\324\311\260##\354\213G\177"
+	.string	"b\323\007\024\036\240U\206\336\257\031\336\325\034\356{)4\261w\211\225m(G\250\237\324c\004\037$\224\374\311c\016\277\274\251(\225cf\223\032\324\3700~\220\366b\004\341\204C\305\213\326v$@\361\322\322\250u\250\035\b\001\356\322\3105\370\037\314\276\307\362\237\005\225(\317X\027\322h\216@\350g\210\353\370\025"
+	.ascii	" ,\n\360\210a7I\226(0\321\311\001\026\f\316\212@\013Jv\240\262"
+	.ascii	"\332r\376\202-R\300\371\221\022}0\356W\206\243\276\n\006sG\251"
+	.ascii	"X9\363z\275\356\300\036Q\214\371\2438V"
+	.string	"\224Q\353(\242?O\004B\024"
+	.ascii	"w\326\273\036?C\005"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.99.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`d\b\225,"
+	.string	"\352Md\021E`\346Q\007+\221\235\332\200\303\f\237\273\331\024\322\361\363\302T\305,Jy\037I\030S\004\036k;\326\262*\024\323\375\256~\215\f}\033}\220\277\025_\362\234LU\234\025%\263\266\3210\302\335\366\336{o\231R\n\001\001\347"
+	.ascii	"\007\0014\322^luL\202H\2354\332\244u\310^l\270\262\035su\207"
+	.ascii	"\302\217\335h7\216\265\240f\342\030\331\240#\264\256\266\177"
+	.ascii	"\267s\3610\330\305p\270\26253\263\323\026\307\316\006\215\240"
+	.ascii	"u\365\310\203\253\253\251\377VW\033\356\326\343c\\1\373\305V"
+	.ascii	"\365\005\032\307\26107q\330\203\300\337\220\257'\304\333\351"
+	.ascii	"\336\234\333\262\253\232\346\207\333\331\013nr)\345A \224\377"
+	.ascii	"y\371\220\357\251\354\002S:\371\236\027\327\013y\231#\201)\217"
+	.ascii	"<\017i\307^\320\352\301t]\352`\n\232\345O\245\221T\027W\025\307"
+	.ascii	"\301\224Y\377\026\371\034\023LI\344]\346\220o\231X\317\246\003"
+	.ascii	"\230g?\374\251d\246\007\326\224\340y\227U\277\372S\371\344]R"
+	.ascii	"\275\n\246\364\342-\247>\365\247\322+=\212\343\370]\"?\247\013"
+	.ascii	"\332\316\370\341-\217i\360*J\322\313\374\255\226\310\177\366"
+	.ascii	"B\034\307\375\311e\017o\"\357v \335]\354fC\004\356\204y\366C"
+	.ascii	"%\256\237uQ|\337\255b\351=\371y=\202\344\230\245\262\232\260"
+	.ascii	",\\)\2025){\231\273s\232\275\330\021\254\236\223r\177\025\326"
+	.ascii	"\361\243\335N\306\3130\265C\351a\213\367d\213\325U\317JlX\306"
+	.ascii	"\217\376\263\231\272\222\222\033\307: {\023\320\332\033\034;"
+	.ascii	"\310\217\353\036;~\336\352\366\034\215F\243\235\227t\257\337"
+	.ascii	"I\3577\203\334w\002\367\342n\300\307\334\221\234\314\375\310"
+	.ascii	"\235\356F.\346>\200\375&r\277\203\3567\320\375\376\271\337C\356"
+	.ascii	"\267\357\375\356\265\337B\271o\036\373\275s\277u\356\367\353"
+	.ascii	"~\347\334o\327\375n\335o\326\375^\331o\325\375N\333\357\314~"
+	.ascii	"\377\372\355\r\334\031\210\231\365\205"
+	.string	"'\323\031\213\257\242\201b5\025\315Ww{{\030\027#\303\301\364n\212\263\n\223\213\253\3352\272_W\375\355\356\224,\006r7\334\345o\360\023\267]\022'\0273,\313\235\270\356!\032\325\321\343m\260\234P>n5\206\310N\301\253\016\177M\201\251\030\r:\360=\3460\226\265\033\326\002oyO6Q\232\240\002W\244t9\251\313\237&\033\362\343\374K\252\310\253\313\357\031\034\346t\346\350\262\205\\~\363\313\241\202>R\356\306\220\341=\231\313EG\340\324\220Y\352\321\214Vrnn58\234\247\233\037\034\3456\237\210\246\265K\324\274\271y\253\331\274fg\322D\343\340jm\226\306f%61\243\274\346\023Q6T\320^\230.:m\336B\343j~\267fw\3607\3046\216\343\b\355n\374\314C;\024W\373\003\b\020\253\253j\256\320%f\374\250#\365HS\206\315[m\346\375\31086\026H\263k5\323"
+	.ascii	"|\367\210\022\357\3114\003\323\336\324\216Y\252%\004\201J\255"
+	.ascii	"E\253P\353\346^\264\346,\244\306\327\230@\221\"\305\352j\316"
+	.ascii	"l\223@Z:\355Bi\350\324\024%\204\361\344\344\364\304$`\030\265"
+	.ascii	"$\242\370T,\016\335\245\250\027\303\025*T\211\241S\023\211(\030"
+	.ascii	"\303bQ\006\323\016\252\251\306Rj\2438\234\361\3044,\252p\001"
+	.ascii	"\265Td\3425\223\322\212\246\030\302(\027-\232^\260\020\302hZ"
+	.ascii	"r\0222\025\241\204J\001\372)\306\260(\214zz*\n\3371\243\247q"
+	.ascii	"^\322\033|\264\301\265\031\3631\270\203\b\300*\013\026\231\t"
+	.ascii	"G7\035@\242\354Q^\007\261\315A\224\3315g\035f\230X\273U\305\361"
+	.ascii	"\361\313[\335\035\236\212X\364Sf\260\312\240|\214\037}\337\360"
+	.ascii	"\3103\024\314@\264?\2761\370\313\300_\316f\236F\3223H\230\370"
+	.ascii	"\206\262/\003\237\315\263h\233\r\032\312\217\307\227\025\310"
+	.ascii	"\241\202\362\246\320\342^\336j\006\271\227\263V\023\r\371q[\036"
+	.ascii	"\bn\002\250\227\206\2559\2530\303\304\022d\0069@\237\252A\274"
+	.ascii	"l '\310.\306S+r\332\260\b!\223\002\007?\201\3622\0046\002V\\"
+	.ascii	"b\241]v-?\304\266O\236\201E\006\307\013\200\237\250Q0D\025D\250"
+	.ascii	"f$(i\222B\241\003\300\002\021\241\262y\0210\245D\020\316(\230"
+	.ascii	"a\r\230s\324,w=zvB(M\373X\234\256\307_\f\032\373,T]\t\274\301"
+	.ascii	"\001Q%d\264\362i6\200\363\351\330\b\267\006\354\036\357\313\225"
+	.ascii	"bGy\241L\257*h\027\222D\220[bC\036\206}/+B\0227\177z\036\260"
+	.ascii	"\f^\022D\305\3568U\214 `\307`8z\324\207\213\316\270.\034a\317"
+	.ascii	"\216]\024\237*\371*+\263\256\274P\200\321\002\214\247mh\316A"
+	.ascii	"\243\311\215|\233\315Xt\256\b\277\316a$\307\233\315\2403\357"
+	.ascii	"x^\203\"\007\241\232\234FU\030,\204g4g\214\337\016j\366\264\002"
+	.ascii	"\017\301\fh\264\300W>/\356\203\f\032\"_\252\225\245\223\222P"
+	.ascii	"\350\\\037\036\302\265\376\013\210`\035\024`\016\252\240\006"
+	.ascii	"\210\330\253L\325!\221\016\225Yb\3615-\020,\201\206g\264\373"
+	.ascii	"#[\220\361\007\341Ke\222\352V|\341\207\344\206(\026\216\n\326"
+	.ascii	"\331(\235\307\300\021\030\221:dA\225\032)P\200\334\232\324.\024"
+	.ascii	"\034\257s8m\341\331\212K\3178\r\372\007"
+	.text
+	.section	.gnu.lto_acroTrainerSign.100.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"%\t"
+	.string	"\346\320>: \005)\035`\3408\324\005\214p\251\200%\ng_\007\212\263\004|C\2657A\270ld\265q!^\357\035\024\345\032\f"
+	.string	"\360\277\f@\351H\036\233-\314\345\255\242\377dK\231R."
+	.string	"."
+	.string	"-"
+	.string	"\232\235\177\330)\\\274\034\357;\035\256\256P\201\204fU\360\241 \003\315\244v\330S\365\2452\003\"v\327\351}#\367v\333\023\266\035l\317\002\366'\377\262\314\003\2733\027\314\356B\270A\340\233m\337\365\226\316\236\2011\224\357\200E%\344Egw#\350\b\236o\360\006\236oz\362\3560\255|\f\016\255De\266s!U\242&\225;v\354\224\332\262\017WY\366_\177f\372\220 \245\366\335\273\331\025\t"
+	.string	"`m6\231\025\333]\037w\210\263\020\221\242I#C\264\201\021;D\025\0341T\362\210\\\202G\244\213R4\215F\245\370\211\355\341*\313\251\3343\037~U)\bDQ\020j\016"
+	.ascii	"A\204\346\265Pn\b\005\252\"CE9\r\220\016a\271\206\353f\3618&"
+	.ascii	"\210\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.101.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\210\020\315N"
+	.string	"\212\204\024\035P@\224)u\207\336\r|\024/\354\214>\305\337\016k\350%s\032\313\3526T\226\361\367\250Q\242\357\265\250\370\021,M\211\303\225c"
+	.string	"a-\317\033\004\306\346\206\356\2021+\216\004#\245O\177\021\353'M\332<\r\362\363\217k\\O\266\3266I)\245\305\001\214\001\305\001F\330G\311\020n\270\"l\025\316E\213h"
+	.string	"|\033!:\204\016\335\326A\017\341\240\013hv\0350\017qh6\346!\203\320C\230\245\246\335I\307\356\275\r\204;\207\016\322V\016@\200\266\2058\035\237\314.\325\357\206\t@\306\360\3565\273"
+	.ascii	"\330\354Z\024\252\021\007\200\315\252ypt\232]\257\341\r\023\344"
+	.ascii	"\306\360Z\200\300<l\226en\271\323x\310\314hl\355{u]\316\216*"
+	.ascii	"\344\356\336\013\324,\033\375\017\266\366\210W\252\231C\205;"
+	.ascii	"s\233\265\217\266o\020a\206x\235\325\251!\367\232\tq\220\031"
+	.ascii	"\220\333\273\214\3358x\257\215\034\206\334{\205\370\007\330,"
+	.ascii	"3s\213\365X\313lE\200\006\r\037D\3245\350\031\336\2757y\354\242"
+	.ascii	"\257\331^\277\370\232\375\027\272\355\036\236\035\235c\016\316"
+	.ascii	"\215M\215\221fF&\246\b\363\342\322BdYQI\031\n\203\300\237\217"
+	.ascii	"\355\275\267\334?\003zaXH\232tjVO\335#\326<b9\370\216Z\353\250"
+	.ascii	"\341\340G \235\003\304\006\307)"
+	.string	"\353\23322\267i\250\265\256\021\033sc\rMSC\017\237\221\t\333\3411ap:\274\230\243azF\257\236O\\\016\177\021\3220\002\275{b\343\nG\273\300\320;\036\301\341-?\003\330Z\307\306UX\023\273\270\234\245F\257|UI]\345\253\252\005O\251\301\202\017\263Z\330+\366p\303\016\205\024\t\n\375U\265\202\007\223Tea9P\307\306U\264\177\320\267\326\371\252\212\272/\205f{F)\022\024V\254h\364|z\270a\327mO\3579\375\255\255\223\244j\255w\274\367vZ\273\224U\323\375g\300\275\227=\312\352\252\331\247\231]\214\231\257\230W\222\001P<\302/z_\362\374\n\276\360\215g\317;\340\373>\370\277\263g\fM\277\362\357\201K\032\3505\256{\235D\314\017\264\035\004\300{\235*\204h\235\022\364Y{\211\340k\366\367\275\326E\204}\33774\017\312\257\355\263\353&HA\304LA+\251"
+	.string	"\251\344\336\253\002\210\246\263\200\333\013\t\311\327,\373mm!+\264;)\031\021(\277\372~\232\202,\214\213\375-\2662\263\363\f}\267\265\353\230\302\341\203\311\334\016\367\336\333\373i\222^\321&\300@\274+\272\377\307G\364\235\326\300$\325:\247C\341\357\037_?\321\263C\243\315\346\241\345\222\270\275X\031\303;*\206\257\331\376!\025MNJ\026\205\362+\263Y\323\177\312\334\177\275^\257\374[\314/\332\331\305Q\027in\321\316,\332\331\250\325\232\213\372\206\356\002\272\254\233\200w\036"
+	.ascii	"\350\274\002\350L\324?\272\207z\2559\211l!\315BA\215\326\f\024"
+	.ascii	"tF1t>\361\316&\202\316?C\347\022Ag\237\240s\317\320\231\347\235"
+	.ascii	"w\204\316:\355|\024:\347\2743\316;\337\274\263\315;\327\274\263"
+	.ascii	"\361\235i\336y\346\235e\3369\346\235\213\357\f\363\316/\357\354"
+	.ascii	"\362\316-\357Llg\226v^yg\225wNi\347\341;\013\3339\330\316\300"
+	.ascii	"\240\363\257\235}Ag\366\235\377\235\035\350\334\013\320 \251"
+	.ascii	"\316\375\240\006y:\263Ku\215r\345X\";\272H\267Z\367Z\267\220"
+	.ascii	"n\2648#\334aXhG\00210\310\356\270\227\2406z)\343\253|\333\250"
+	.ascii	"\"9zc\033VZ\223\016\r\257\370S\230\337\342\n\236-lm\357#\035"
+	.ascii	"\324:\242\225G\345\"\363\003\034}\307\025=\315\037\375\377\360"
+	.ascii	"\224\266\370\342\323\274q.J\367\374\032\340g\276E;\203\253\220"
+	.ascii	"\302LO\214\272\346%%+{\371\251\313\223\353U\316\245\217\264\267"
+	.ascii	"\220\302X\215j\263\204,\271;g\314\313|/\356\371U\374\230g\235"
+	.ascii	"<\361\374\212\255\375CI\313\303\255\332\036\0048\225W\265b-Y"
+	.ascii	"k\203wTk\203\257\331\3427\\\277\270\302:{\302-[\377\376\276#"
+	.ascii	"\232~\205r\357\205\201\371\177\366g\223\227wy\230\367\270\347"
+	.ascii	"W\223\017p)\266\002\243^\276\227\264\274\313\3238y\306@|\225"
+	.ascii	"o\371v\361\304\367]E\363\232thwD\025\207\366\320\241\335wT\""
+	.ascii	"\240\326\225n'\037\223\n\007\265\246p;\371\204X\236\354\206\244"
+	.ascii	"\001C\306\311\362C\037ivR2\",?u(vK\341O0n\374\356\020E\242\207"
+	.ascii	"\360\216\355\210\025\027\317\342\331\2474\036*+\237RC\265.\217"
+	.ascii	"\335\332.\t\030\375\306\025e\345\333\256.E\345S~Y\345\026\r\205"
+	.ascii	"\255\300'*\237\354*+\372\224\377UO\240"
+	.string	"{\342\r\177\212\004\273!\271\216\200!\243\304I\277E\233\2045\021\376\224Y\374\320\241L\361\350\201\311\\\263\331\2757\370S\366\037\262\373\255\203aT\035P\253/\250]\274\024P\017\177Y\r\302\351P\230\260\033\322E\033\001\303\206\353\256\213H@\001\006\030\3605;\004bC\213\002\374\375\026;\213\354nk\227^P\263x)\037\272\350\373\315\332k@\200i\335\313F\327+\024\347\275\001,\003\351$\203\211\264\224djZZjJ2\316@\372`\251d2%\260A\222RF\222\312\322R\311L\200\251tR.\205\030(\231IJ\r\232\226\034\254\034\300dR.\227\036$\2450\225\313g2)59\300T:\001\227\224\226\021(g\304`B\n:)\205\200\324\343$$\006J\034$\2312b(\315\310 \311\244\204\264\224LZ:%\2213\334\304\201r\231d65-\223C3\250\356\335\337\342Nk\027\037z\356\325"
+	.ascii	"\375\214\037\372\240\227j\221\003\242\b9\250or\257\007\005\322"
+	.ascii	"\307\304N<\n\023'\222o\202\007l\347\347gp\0364x\263[\211\377"
+	.ascii	"\001*\361>0-\347?\351\3548\372\b\371\027\225\345}r\274\253u\236"
+	.ascii	"e\013\202\003\247\347\2319\310wL\320?\270<\207\353hU\300j\263"
+	.ascii	"\262\242\214\340\371\236\237q\002\315\003\300w\236\271\255\321"
+	.ascii	"\272\340\353(\236?:\377I\013X\364;O\023\344\371\265\362C\336"
+	.ascii	"\334M\211n\273|:\3374T\353\374\005\347j\273\332\033\355t\352"
+	.ascii	"kV\347\273\n"
+	.string	"\253\355I\024\350\206\264\"6?\255!\340\217\277\254\326\345\374\361\005\237\266][9?\002V[\017\343O\231[\034\356\002[o\270\264\332\0341DR\257\321\356\240\266``\326\376a[k\"\035\303\243\2219z/\036\375\035\330\024\324\032s\004\214B5\002\265\022\223-}\202\235 \343$4\027\205\236c\204\236{D\241G\276T\303uP\0060*\250U\346\305{q\310\216*\004j\215\031\372f\353\240\026\234\\\036\025\321\037\350\245\034\332H\026\246\350\236fp\376\346_\274/\311Z\001\347\233\210\243\267\371\2337\236\325\274\312\333\030}\315\343T\243\327\347\235\214\021\017\013Ss>\230\314\325\005\201V\250\201<\"\031B\246DDD$IRH\007q\005\204\030'\035<\017\021P%T\214\021I\223\354\254\001\266K\276 \244\204\253Xu\031\346iy\334c*\004\250SOA\233\313fw@=B\314\203\342\211\262\216\243"
+	.ascii	"R%m\243=\177\351\242\036\177\031\201#\373\300s)<\327\005z\244"
+	.ascii	"\344\205\302\301\313\306\2244\375\322\207\013\004\023\263XLa"
+	.ascii	"@z\367zn\363\216\275q\333\252\276\377"
+	.string	"\241%\351\206\026k\313B\325Ht\366\017\321\230\370o\333\363\352\026\336\302Z\f\317Z9\272\364\344q\325\003\335\035\267\034\370\207\277\2031\253\307\354\216m;\203\364\306\221\267\370\214\237\306\311v\3014.\036K\215\031\303d\267{\270\330m\027\222\375\273\222\235\302\243BC>\"u\3322\002\027\222e\2107"
+	.string	"\274`3r\341(\322\026\345c7\343\376P\257\355U\201\253\265\341\356\220G\001\204@7\03072)\036\177)\226\020\265\003\217)Ap\2178\256\262aleQ/\341\275S\334#h\237~\3355\332\273JUt\352\307:\367.\317D&"
+	.string	"\247\b\027\367\234\036\344\271H\244\367\305\307\226\327@5\007\331}\206\341\250n\335\34470\240\003\364\276\215\204\277XM&9D\230j1\374\331\227\357\006a\336\"\325\337\f\277\b\304l\031x\315\256\026o\007\213)\\\326\270\005\310\217\370\004\"\235K\020\034\332\352C\211\255m\370\330\002n\232\341\002 \177QC_t\007\n?\362L\024\232`\312\244\331\222\253\351\311\bK\332%\311\244%\326"
+	.ascii	"%\232H/\376) \006a,\302^\346\331\f\353\243\256o\367\3501/\211"
+	.ascii	"bE36O\016\375\r\271 \004\303\337\215\206\276\303\315\022\035"
+	.ascii	"\212\017%\372e]\312\300\262\227\334 \261\363\210\325M\340\f\034"
+	.ascii	" T\323C\362\304!\243\\\244\001\367\324|\316\206\211\246\263\276"
+	.ascii	"\373M\364 L\177\251\032\030|\254\375\271\254A\345_\274\025\261"
+	.ascii	"\026T\314\235\3246\b\030T@2\277t\216f\373\001v\215\254\220\022"
+	.ascii	"\315m\367a\227\325\207\377\226\375\006\336\256q\373\030#'x\324"
+	.ascii	"<\326\022\3639\fi\340l\002wwB\200\251+\"9\"\243\022\3161\225"
+	.ascii	"#\031i}\034\250\206%\215S\033I\350\035\034LnK$j\337\3072\300"
+	.ascii	"0yD%0#p\360\\\221\034\305\262\034\270\n\005#\025\327\376\344"
+	.ascii	"\001\300\371}u\330\027\"\225\376#sO\314F4\373vG\005"
+	.text
+	.section	.gnu.lto_rotateVector.103.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`k\003u\027"
+	.string	"6-\230G\300XM:\300eo\004:Z\006\371\025\331{\220\034\005\336\222\377\205\024\262\220\250.\241^Q\177\3311\255\016\335\025\3314\222>! }\004a@\004\007K\346\037\013]\275\374,\b\220\2145!\177\245E\322\b\331R\246\024\200"
+	.string	"{"
+	.string	"\177"
+	.ascii	"\357\314\340{' \036\264u\334\212(\370\236\376\215\343x\216\330"
+	.ascii	"mV\372\314.\021ni\327\226c\004\266\323x"
+	.string	"\357\276\003\360\336\331\267a\273\2743\201\357\235c\266\223\233\020\373\263\240&D\204\221\225\335e\251\013\353\243\355\216\031{\0275c>\312\301\216G\0264%A\263\237wQfwU\263\020\021A\n\315d\031g\234\270\376\350\035\213\241'A\263\023O\224\203\335u\006\315L\334\336m\303lK\260uE4\307\335\253\230\236\211i\231\230\216\211i\325\3230\232~\3214\030\323\251\247]4\375i\032\025\323\336\323\235\246\243\2465\323\231\351\007x\301Bb\366\241 \273%\236\262\254S\307\024\343H\177\322\237\373q\217\366\355\373\360\177\\\351K\006sn\212\213\203P;\"#\302\2274\245\206\344\301\207\344\\:e\251-i\360\031\371G\006\337\371<\336#v\234\233\276&\366#\254\324\214@\331\335\002\001\262\013\252\027\275Q\030P_V\n\252\267!\365\251\215\272\234\351(\375j\024\245\321\310\007\002s\356\203\341[\311{\347\351\205T"
+	.ascii	"\251\215v\372\220F\274\211x\252Q\037\026\321\250*\230\204\326"
+	.ascii	"C\304\026\240\324\232\274\233\274\225\246\202\267\241\247\220"
+	.ascii	"\226\363+\215\276I\310$\313'\033\370J\257_\372\204\333P\225\220"
+	.ascii	"&\313'\325\335\375Qma\333~\362\253D\366\221n\234\337\376\233"
+	.ascii	"\333~\233'\3355\317\335\001\t,\264T\201\205\226V\370\300\323"
+	.ascii	"\023[\357q\265`:0\327\353\363\360\035\036\237\016\0022\274t>"
+	.ascii	"\357\034\270\320\362a\3014dhm\300\300\352i\351p`\355\274:\260"
+	.ascii	"\016\334\330\345\303\363b\301\\\256\027\013\264\355\277J\264"
+	.ascii	"\343\037\241D\210\023\220\312:ma\324\020\275*\223,\360\225\n"
+	.ascii	"\345\034}@\024\245*7& \362\312\343\356n4\016\214B\n*5P\314(\314"
+	.ascii	"\213\007I\221\321\224\316h\032\2052<\225Q\325\215\226\013\213"
+	.ascii	"b\324S\034\275\226\220\246\322\224\306h\244\022\026\005A\250"
+	.ascii	"\021\360\250#L\221\tl(\210\244\205\205s\240\002\221\253\342\006"
+	.ascii	"\020Xfb\232\016\":\332:N \177\273\211K^\336\357\374\3360\267"
+	.ascii	"\253KP\215.\214/\265^\003)\312{=\277\307Q\314\017U>\257*c9d\270"
+	.ascii	"\225\331\024\n\016\031\317\3437\314\314\244\236\204\022\300T"
+	.ascii	"\262\035W\030\004\024\215m\003\253\031\265k\326W\003EW\321\264"
+	.ascii	"\007\030J\300\231x\311\370h\272x\342\030\275^\376-\274r\303z"
+	.ascii	"f\330\212\b\316\233\f\375\003"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.104.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\217\007\r)"
+	.string	"\332Ed\017Fp\\N:\217\324\344\322\325t.\253\b\241\032\220N\rV\310K\243{%\223%\204\034\241\021\027\202\326\2643Ty\211\241162\353\230\317]b\244\310\005q\331K\371Y\256\225\327C\370\203-\252\266\215\220-w\222\001\351"
+	.string	"\320"
+	.string	"\345"
+	.string	"\034\367\"\364'\360C\350\317N\255\230\343\b\310\272W\017\310\342\334H\313s\357\025\366\221\240 \367\355\362\334\263V\037\002 \024\004\364\023\004\022\245>?_\017=mW+~\217\311\206)\305\024\215W\037\002;\"9"
+	.string	"\345\205l\220\230m\360&\244\006\0319&\017\364v\237\2352\2579`\307\344\177l\320\227m\340\026\244\006{LF\216^\007\236\350u\"\233\244\034\253i\001\260#\220\373"
+	.ascii	"\261Erao\376\263Jf{\302|N\213\313\032\251e)\217\366\002M\264"
+	.ascii	"\272\252\317\006\315i\375\260\r\326l\324\036\023\037G{Lk\277"
+	.ascii	"\020&\244Y4\372\370i\023|\231\331\372\234\026\022[d\255\321\227"
+	.ascii	"\231\255\037c\r\253$\027\366&5f\325\3761b\331\244{\357\245\274"
+	.ascii	"\3520f\325\332c\272\367r-\032\217\347\2423\377\t3W`F\213\001"
+	.ascii	"\335H\236\201\276O\234\325\325\250{\230\331\305\341f\370\356"
+	.ascii	"\275\020\370\\\336e\310\037\373\3111\246\352\213?\371S\350\317"
+	.ascii	"7\b\256;\263*\304\332d^^\325F2\377[Xob\334E\230\221\216\214~"
+	.ascii	"\266\345\034|\333\031x\265sj+\373\330\312\277\263\262\317V\356"
+	.ascii	"\331\312\250\255|\332\312\366\254\334\266r\355\312O\n*\335\214"
+	.ascii	"\377j\336\333\243yw\343N8%\337\362\267\375Z~\265\337\312\177"
+	.ascii	"v\224\371o\366f\261P\346\265\244\215\357\006\245\214\213\215"
+	.ascii	"S-\277\261\262\037\024\322\370k\234\2521\230\347H\2225\231|\237"
+	.ascii	"\302_\036\215\323+\307b\3653\032U\316\t\031\236\335\275\367\201"
+	.ascii	"\357g\222\345Sy\025\253[\251\372=^\337\035Y\236\335\275ZK?\031"
+	.ascii	"\201\357g\367\022\343\\N\225\207\246\372b\023\032BD}\221OW\307"
+	.ascii	"\025\227\325Wokwk|\032Y\346\276\256I\334\370\372\201X\235;c\277"
+	.ascii	"^K\321\261\351Y4"
+	.string	"]i\276FrJ\006E\352Sy.=m\035\013\236v5r\333S\360\264\221:@\230\220\246\215/\264\227\314<\242k8E:E}6\332h\332\212\253a&\203\344\2757\002\363\210\247\251R\242\223\373\\\t\023NN\350\317\263\277\366\023J\027\232\031\034\2616\273\357\275Wh#\317\003o\307\220{YB\263\211\247\306\275D\003\266\213\272\302\261\321\004\213Q\034\315\031\333G\373\031\205+O\317\275\367\236\215d\007\177B\273\253\362\254\315\307\234\314\023\177\214\241\242\242Z\330\346\007\2616O`\214\210\3222\231\271\032\250\255\342\f\r\213\207a&\230\332$\270\360\230\355\212\315V2\036\365\247\026P/&\f?\f\245f@\245S)\234:\274\030FQ9Q\r\245\200\214\202A\212(\030B\252\025PQ-T\b_D9\271\020\242\220\232\0222\020\300C\030ORB\252\341PJ\230.\357\245\3748\352\300\304\021\033k\b\355"
+	.ascii	"\252\354\275`\022\256\345vXjS\b\310\250\317\272\237\245\007\203"
+	.ascii	"A\3016\222\343\323Mf\016\240\313\313p\224\304kN\341\363\351\277"
+	.ascii	"\375<v1\315\340\200\332\276l\"\320v\266\246\001I\266\013\321"
+	.ascii	"\325\231-\033\311?2\300\243>\353\210\226\016\004\366\363j\020"
+	.ascii	"\330G=\024&\306\3745\0333\213\222\365N\221\016\021\303\3610S"
+	.ascii	")\311\254\342w2 E\250s;\0326p\340\200\376\374\365\335~num1\253"
+	.ascii	"r`#\371\347\345\275\227\250\213x\371\273\257|\261\302O\003\324"
+	.ascii	"\247}\331t\200\256\370\264\3335\rH\006\200\244\250a8\244\230"
+	.ascii	"ChHF\202\221&)\244\003\240\002\0211*\333\021`\251E55\322\244"
+	.ascii	"0\035R\004\220\253\035e\263\304!,Ha\242\226\225\347F[\304\342"
+	.ascii	"\340<\375[\345\316\273\021n\332\264\360\321\357\340\334\245\027"
+	.ascii	"\234\202C\305Z9\2442\200\300$\370a)\005L\210\371\333(\036\346"
+	.ascii	"\254\215\241l\336\n\322\330\n\267\273\350A\320I6\251\334\374"
+	.ascii	"]\024\332\347v\215\351i\017,\232\231\274Cx\036iY\260\241)\013"
+	.ascii	"\023;>\2611>=\321\220\"v\037\370\235Q8OQ\313\346\026$\365I3#"
+	.ascii	"\327\t\027#\233\264\0358\304/B\347\302\376\376A\314\252\354\351"
+	.ascii	"\362(\216D<\217\370\326\267\304\003\200\221.dS\262\315IY\210"
+	.ascii	"\016\243\310\216\335\315-8\365.\337Q\240\224[h>\335\372\243\262"
+	.ascii	"\fY\257\353\332\235gTuV\257nP\201iN\313zA\276\0172\341\321\027"
+	.ascii	"\301\325\303\222\271\026VR\363#\211\216DpZ\210\334\352\256\375"
+	.ascii	"JVl\317\312\355-O\005\301\020\317\325\016;D\rUGk\371,\013~\351"
+	.ascii	"A\001\262\322\002\037\335\037\372\241\351\213nB\2546jIC\025\023"
+	.ascii	"\270UQp\236_\335\375v\230?"
+	.text
+	.section	.gnu.lto_applyRcSmoothingFeedforwardFilter.105.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`f\002-\024"
+	.string	"\026f\205I\320\360(\035\363\2254\253\013Y\035\245\336\312\300j4\0068\374\301\003\272\200\274\002vK#\"\366*\242\314@/z\003\fP\377\350B\235\325PgB\266\267z\024h\225v5\252\333\355\0052v\033 \364\340\177\263\204l\271S\nq"
+	.string	"h"
+	.string	"r"
+	.ascii	"\353A\311hwML\222\272h\3337\361\0236;8\177>\275\001B$tD9v\267"
+	.ascii	"5r\221\361\342\274\200\361\242\212\270\355\250Q\234*m\376\201"
+	.ascii	"o\200\353\005w\274\333Q)\235\217\263\204\351\350\306\212\247"
+	.ascii	"\233\"8?;\033)n\370\364\340\345\244\316\022\236$\r+\336\205)"
+	.ascii	"\022\343\303\322\201\2277<\234\224(\224\335\265\334\361r\356"
+	.ascii	"\324m\333l\243\330\262C\242c3\362\273\231\361\342\325\302NR\t"
+	.ascii	"_\215\034\332\277\233\324\036\373:\034\016\207V\020\366\352\276"
+	.ascii	"\377\343\277_\365\241;5J\243D\351qJ\213Rz\252\264^Z\252\364\003"
+	.ascii	"\200\004\261\340}\004\216]\234\341\216\025\212-\200>\364\333"
+	.ascii	"\007\332\303\366\220\203\337\234\225\302%! \246\335-p\321\n\344"
+	.ascii	"\317A\030M\006.\3573\222\001l"
+	.string	"&?\212\260\300gw\021\370\301\033I\230\240\2422^\374\316\206\250\243\262\220tO!r\252\355b\031\277\023u$\2477;\370\024^\345vk\b\250t*\253\206M\020N\016\237@G\007\206I\362\227Q\365!|\025_\361\342\367\374rqQ\232\235\244&\016\377\331\361\bU{\374\241RW\2002r\322\311W\251\327=\031v\024/\251\335=\340\023\275(\306\357=\265\327L]5\230\027\203\232\f,&\253\275RZ`\262\020\032\214\3065\315r\322\002\223\265j\025\\`0\024Z20WL\213eFk\235\260\034\223\275f\255Z,6ky\374\366s\347\270R\220\"\244'Q\245)\275\261\235\322\013id\020\326(\016\305\222*\375P\333A\212\374n\245\242\336|\234\230\214F\332\210\322\025\340\f?\370\013\232\013\224B\330Qj\362\315\335]qT\333\001, P\0021\246\264:\237\204\222J\204g\013\203\375\n\305-"
+	.ascii	"\337\200\314jH3\306\bu\341\207\226\375\277\346\027\225\376.\233"
+	.ascii	"6p\277i.\343\226\321\03268\374\206\201\365\210]\fb\2329\205\325"
+	.ascii	"\266d\240\343\246\b\313\036&|ky\006\020\202\020)\036\246\001"
+	.ascii	"\341`\343\266\006\002bXph\b0#\252\245\227\361\372\030\227\212"
+	.ascii	"Qu`("
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.106.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\253\r\025C"
+	.ascii	"zs\034\031<0\246N\007\3709\364\217\306hp\0246:b\321\234\342&"
+	.ascii	"\214\376\202Y\007\310\311\354\333\364\206\177\215\365\303!\247"
+	.ascii	"\273\303j\205\352c\237\201\321v\335\362@\352\017\024\324D\204"
+	.ascii	"l\271SJ)\207\001T\001\204\001m\237\353G\327w\272\377\272\337"
+	.ascii	"t\307\351\356\353\246v\327i\"s\023v\335[\233\300\026\f\322z\330"
+	.ascii	"H\264\312\310 \314H;\334x\032\220\221\177\205uP\356\004\272+"
+	.ascii	"\324H\332\r7\234\226\323s\232N\3731\262\216\236\"TA\037}L\355"
+	.ascii	"S\351np\021X\034\"k\353\246\353\356\b\353h\024\337\020\351\226"
+	.ascii	"I\353~\304\334\355Y\324\266m\203\276\f\243\330\367\221\314{z"
+	.ascii	"H<\233\316sv\033\236\263tj\317\362\252\320i[\274-\236\200Wt<"
+	.ascii	"\"y.9(\366\345v\346N\323j\234=-\302\306\266\2752H\247m\317\266"
+	.ascii	"8A\261/VO\261}\327\216b\373\262\2239\321\022\255"
+	.string	"-\223pGM\323\223\324\266-\363\267\264\263\227UTSRQPONMJ\246$\362h,\022\331\273\276;\271\371\332\250\326V\326\3132]\325~tN5\327Ssvlr.5\027\030\347Q_\032\352K\240\027\177\352\322N\\\b\273xS\225V\256\f\376\260\301\265`\025gZ\261\002;\353\017\333\034\025O\022\273\220o}\214\372\275\2711\353\n\223)]\234\002\330YvlnN\214\322\354\252\345\007\213\241\262\r\272^\001\246\371\355?lRV\254\266m\221mh\276\256\f\340\006\235\264_g\375a+\263N\371\301b\210l;\363_\265\314L\372S\266=\327\253=4/\315\327\276\326v\346N\354j\333\226]\255\215I\263U3\367\0363\253aN\006\b\336j\027\036\013\355\313\230\033\221\017\255B5%m\b\243\365\n\333\266\265\020\243\017\311\330P\330\327\320\372\255\006\245\013\235l\035\307\315s\330\276\377\355\327,"
+	.string	"\311\001\256E\317Tq\344\266\276\224!\364\f\326\277/\345\025\352@-h\006w\034\327\360\362b\373\372suq3\363j\373\027*\036\272\177)S\231\331\r\364\333\310\333s\346\223\230\371\253\3750\265\330\266-\005n>\335\007\214;\256/\347\b\363V\013c\373\366\277\210\032\036N\315\274\312\214\367\364\2272\367W\253UK\374Y\272I\\g\021\327\031\204\207\276\323\334\241\377\232\27384^\367\206~\323\254\241\3434ghj3\206\256\323|\241\247\335\026\272Mw\205\353\034\001B\3675?8:3\215\316\\\327y\353:;`\235\033\034\235\031\030\235\027\\g\005G\347\004Fg\004\327Y\213u>p\235\r\\\347\002\3279\353:c]g\002\327y\300u\026p\235\003\\g"
+	.ascii	"\327\371\352:[]\347\345u\256\272\316TE\347\251\353,u\235\243"
+	.ascii	"\2563\324u~\272\316N\327\271\351:+\2573\323uN\026\235\221E\347"
+	.ascii	"c\321\331x\235\213\327\231x\235\331\353|\211\316\353u~\326\331"
+	.ascii	"\257s\243`\032d\330\326r|m\273\244Z)\321j\036!8\215\232\250\036"
+	.ascii	"\300?=;\364\321\223P \243<\345K\031\200`\273\033\0241q\202\200"
+	.ascii	"\366\\\375\362\001\374[\202\302Ax\253\277z+=\207:\232\325\367"
+	.ascii	"_\227\251\231?\335l\371\023\n\371Q}\3257\264\221\231W\327x[\245"
+	.ascii	"\372\016\354\365R\264\312\264\022\037\364\224=>S$\207o\300n\270"
+	.ascii	"=>J\212\036\036\302\2571\352)\002\316\374!\204\267\332\324w\341"
+	.ascii	"!K}\236_&%\371R\366\243\206g\232d\314\360\0216|\204\347\360\337"
+	.ascii	"\267\"_\352\307\317\262\305\bP\221Q\352\243\336\303?\242\021"
+	.ascii	"]\211\222\324o\3502M~\3247\001\242\343\2036\3429|\225\006\025"
+	.ascii	"_\312,\341\037\333\341\007\354\021No\327?\3705ff\250w\332\223"
+	.ascii	"|\250g!5\275\323{\337\203W~\323\257\204%\372\220\251EI\312\357"
+	.ascii	"i4\322\341\324\214\370R\346A=\3204\354ga\372\276\2227\330\365"
+	.ascii	"\311g\372\207\004\265\203d\201\333Q?2\201B\205\n\266o\362\333"
+	.ascii	".\n\311\214\237Y\207\377\2718\320\272\256o\300N\201e\216\017"
+	.ascii	"Z\327T\226\034\312\271=\306\"\277\231g\350\370\253^\232[\206"
+	.ascii	"?\376\025\2246\335\360\032\336\370\310<\271j\332\031\342_x\r"
+	.ascii	"\377r\216\240uO\342g\200{R\233\327\263\26653\200\341\211_\225"
+	.ascii	"'\247\bj\367\364*\263\217\341\035\021T\322\205\277\317>\021\021"
+	.ascii	"\264\356y\237\n\213\034\237*\377_\237\271\205\213\254\203\353"
+	.ascii	"\207\0162/1&\21711\261\261\257+\b\021\2228z\234\300\321\203\304"
+	.ascii	"\017\344\227\027\362\313K\210\227X\016\366\313\213G\230X\016"
+	.ascii	"\2669\326l\206\020k\202\221\205)\311x\204\215\365 \003kq#l\005"
+	.ascii	"\031\017\260f\023\310\027\024\030\231\027\213\261\346\220\034"
+	.ascii	"\305\037aB\274V\376\342\272\021\326\203I\246#G\330\016\034L\036"
+	.string	"a^b\314\257\346\017&\327\222\307z\2005\231dccM&\022\317\254?\013_\367\221Dd\372\230\375\223\327%\363\345\234t\031\270\304q=\363\227[\\\016~\353\227\202\234\213oq\340\307\206\f\331\232T\275tP7\370\326\342\322\006\337~\275Jz\223s\030\245b\360\314\314\345X\234t\255we\3013x\253>\005\013\024\274\225 \350\225\340\031\332\324KY\213\3306\210F\252\213\260\026\376\226\r\222\211J0\305I\327m\n=\352oN0\3160\316;\347\235Z#\004\237\340\255\360\244]:\340Z\317\3544\343D\303\266\032\202\307:\3732+E\021\257%\342\314\333\336\223\320\236\335s\302\230#H\240\234\212\337\204~\354\0245\tx\021\277\366\240g\260\007\276\307\370\223\003\337lo{f\334\f|\2017\360\217\310H\242\002\377e\004\327\242Y\257,l\265F\"\036\353\263~\355\203\302a\375\2317\275'\2418\321\247"
+	.ascii	"O\340\213N/e\031P\345\323\267`\033\255\004&b\252z\020\277F\340"
+	.ascii	"\005|\023\202\370\001O\340\357\227/Q2\340\233Zh\032\340\005\250"
+	.ascii	"\361$k\001\376p\n\342\2210\265\212\313\221I\001\201\f\250a8\350"
+	.ascii	"\fR\244dDDD\222$I\007A\005\304 \351\260\343\001\0210!D\320\315"
+	.ascii	"\210H\222:\303\030\230\216\204\362{\276\301\357\251\t\310\256"
+	.ascii	"g"
+	.string	"T\276D\025\300R\220\b3\346\323i\323\027\371\232\207\330\373\267P\245Qd\340\013\f;\005\251#J\367\352\337Mu4\212o\345$\221\017\320\230J\n\333Jg\027\222\344\032\320\243Ar\245\b\210\342\327\3761\260\273\247\034\n\224\202\270 \214\2617d\326\r)\266!\302X\252\375\316F*\353h\244\"\221n\275\214!\330\002\337\227\036\211\340)\006F\0302C!c\340\300\003\t\013E\274\230\247VV,\026\203\023\343\320}\220A,\363p\256\023\201x}\366\216\f3\363\221\347\262n\355\323U\301\237#\301[p\226\264L\334\200\003\224\313\356}\005\323\347L\327\305\354\206x\373\020\027&<\3738 \203I\321s\316`\365\244q\366\214\266\320\bI\302\033J\367\216e\372T\212DZ\001\277\017\221G\245\360\311\003\003\366\250\032\365i\372x\3061\356R\204J0\271T\006\244|\026\217u|ed]z\004W\243\257\""
+	.string	",\001"
+	.string	"\202p\024\2238\323l\t\276\233\033\240\261\346g\303\005\006\217"
+	.ascii	"\343=\245\037g\250\265\300\362\351w\021\367\263\"\201\f\022\210"
+	.ascii	"\331\276\213\276\032\002l\274\021\220\275\220v\302\017\324\\"
+	.ascii	"aB\017]\2255\262f\300=\031Y\302"
+	.ascii	"p(D\360 I0j1Y\002\212\237\254\344\033\375\243@\202 <\025\325"
+	.ascii	"F\271\357E\004\255D\2077#\361\231\323\204\270&\001\351\001\001"
+	.ascii	"?\230F\036ZG\276cl\212\351\341&|\0255\r\327\034^,\235\035\343"
+	.ascii	"\250\345\213^\260\240$\363\034\327\334\025v\334.\277\215\220"
+	.ascii	"\236<\353.]A\"J\b\036\006\247\261*\324p\353\304\226\236?\035"
+	.ascii	"\3273\240_d\350h\325\265\222\271L1\377\3372Y\275@\035\255'\""
+	.ascii	"]\347\224L\321g&3\370\001\212;9O#\371%\024\004V\205\242|\250"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_applyItermRelax.107.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\245\t-2"
+	.ascii	"ZV\f\023E`^R\007sn\223Z\t\351\336\302\340\320\262\360\251\341"
+	.ascii	"l\355\b\341\360@\306@Ai~\326'\276\325\022\273\246!/\265\323\207"
+	.ascii	"g\221l\202\024\214l(\344\274\240<\364\017\003\213\307D\365\317"
+	.ascii	"\265\3266\331[&\231R \001\005\001(\001qr\316M\276\366\210n\243"
+	.ascii	"\303\360S\234\355\350T\332\315\2039\217Yy\313y\355\251\033\254"
+	.ascii	"\265>d\245`\t\363-3\366\f\022'\301]\303\002C\347\324\372\332"
+	.ascii	"~\273\335\211?9\272\332\214\346\345<d\372\226s\362\251\t\264"
+	.ascii	"\276\0369\221\365\025\373\220\365\265\217\335o\206\2662R\301"
+	.ascii	"3\214\213m.\347\f\365D\374\350EDCBAD\240\2410\370\343\003\354"
+	.ascii	"\371\371z\274v\307\256\370\357\261}\007\201\267l\"\275(\315\211"
+	.ascii	"\240>\004er\205\224x\220\222$\227\210\304\201\220\230\335!\364"
+	.ascii	"\310\025\"\005\177\260\2018Y\352x\034\323\b&z%Y:\032\263\310"
+	.ascii	"\365\361!_e\016\304\006\202`b\330\355Ac\226\335\037\0204\346"
+	.ascii	"\217\353\363,\247\367\234<g\217\333\2421}\334\035.\212c\362\300"
+	.ascii	"L\\\227u7G\212cBWl L\f\030\260\271\205\211e\304\332`\314TF\254"
+	.ascii	"\r\260\231\304Eab\300|M\345\3758f\032>\3129\273\324oWS\353\336"
+	.ascii	"\035\204\234s\337e\363\313\033\200w\273\\w\303\350n\037\004H"
+	.ascii	"\377\217\177'U\236i\375\017\305\322\276t\t\257\377\375\356\021"
+	.ascii	"$\256/\221\376h\353\221\335\036\346\205\221\232ewCp0R\316\306"
+	.ascii	"`\312\277P9P\223s^\320\305\275\240h7Sq}\251\202\365\365\276/"
+	.ascii	"u\370\026\t=m\315\332\333\215\365\325\237\206\223K4\315\025\037"
+	.ascii	"Y\267\332\275\206\274O\326\355_\255V\253\375c\335.\305\275\200"
+	.ascii	"Sq\037\340k\356L\370\366\222\277y+\271\025\357$\307\342\215\344"
+	.ascii	"j\356F\336\346.\200w[\250\275\035\264\273M\304\267\201\332\333"
+	.ascii	"\303\335m!\276\035lo\377\354n\373\260\267\201\370v\017\276\375"
+	.ascii	"\303\267}\370v\217\275\315\303\267[|{\207o\263\354\355\025\337"
+	.ascii	"\306\370\366\257\267/\276\355\b\252\234x\341hzZ\225\234\275\252"
+	.ascii	"w2\231U\213\022\177s\267\342\216\305\277{\332\236\345\255\247"
+	.ascii	"?YB\262\223W\233g\222\027\356\326\355\363\325\375\212K\333\207"
+	.ascii	"\005\013\3476?{\0329+Z\301\362\374U\026\277\027\3125\261\243"
+	.ascii	"<\3232\252Q\245\373\031\343\274_\345P\355D\3274\\\216(g||\017"
+	.ascii	"\244\306\227s\226\276\367\276\307\322\336\367\304\232\244\351"
+	.ascii	"B\260\206\204\r\030\305\362\336\325\242k@\370\0337\274w0'\225"
+	.ascii	"\316ql\201S\326\323\344"
+	.string	"B\357#\207\232&\312\246\307\334\bB\345\367d}\333&\277\274&w\240\264\203\243\347\344B\337U\306\327_\221\3244Q\337\223\265{\277\315\331\361\244\367c\355\377\342\242p\355\023\235\351Z\033x-I\302\3738\354\314\0366\344\332\335{]TL\362\326\035\321v\217\273ty\234\037O\260\335\2231\275\273\371\235\273\361\006IG\016n\252\244\364K\377\304\246\254\303~O\375*\275\021Uy6u,h\226\b\311\271\037T\253u\2229g)%=\373\236\305yebiv\224hZ\267\332\256\346\003\312\r\026\377\324n\313}q\203g\275\376&\272&y\353|\307\226\327\031~2\237\301\032\375G\241>\243\324\344\255\363\367(v\375\022Q6\311[\327\335\"\034.\252\245\256\037\302\351\005\252\206?\351\257T9\027%H\334\023V\032NXYp\341\273jQ\254\262\272\242\372`\242\310\341\252\005\225\321\370bJh\2542\032)"
+	.ascii	"\251\256\244<T\031e\240hY\030\251\256\212\253\213b\f)\334S\007"
+	.ascii	"L\024\255\240\256R\240(\2568\001\325\242(\305\002j\312\350"
+	.string	"\002\352\300PWYQ\031\241\256\252\252\214P\276\265\3548\377X\013\347\t\231\254\327\3029\347\\\264t\007\274\200/\360F\337}\204\036\233\\_\266K=\330\006\347I\206\353\2217\347\214$\n\2725\356\322\306\365\356\302\022?\b\210\b4\324Dh\370t\223WK\370\303\240\360\217\222\217\354\236z\033p\351\203Ot&\250\316\201\277k\302=\211?\337\335N^=>q6\006\355x<\317\021J\204\t\023\226s|\376\347\211\244\\y\002\334\244\357\256p\201\365\245\317\263P!\311G\372Q\031\2350@L\036\305\002\337\321\370\234\323E\265\233u\206\r\355\033X_\201\357<\234h\240<\252\fW$\234\222\350\032\341\223}9\3150\231{\260\214\322&\330\203\245\3139C7\351\177\337\335\341\303\365eO\201G\372\200\306\250\2018\345\fc\250dDZ\222\202\024\032\003\240\002\221\251\252n\0208\210\246&I\322\0017\201\244p"
+	.string	"T!u:v\211\323Z\272\342aNR\253e(\242e\346\016\375\277=\t\241\240}\272\362{\303|\323y,7\373\304\375D(O\245^\365\301\232\030$\323O\2604\214.~\361\301\245E\244\217\375v\244\365\r\004[\307"
+	.string	"(\223\016\267::\254\302\333\177\343\214@\205\003tK\261\221*Y\3442\n\272e\252\212\236tE_/\213\272\327\310\356\313\277@\227;\260\335M\034\224\026\027\340\277\326\002G\351A\310\016\213\357\n\346\226-%lW\211\002LBX+\335\001\327\034\002\353\325\013@\225\206\217\265\356\304\253\345\273\300\023\322\374\204er\323M\221\226\251\003\207\205=2\217\255uz\210\264b\235\b~\331"
+	.string	"\303\241\211\342\212\301\237\336GA\007\333\034\342\\\203D\374\336\223\004\270\3769\nVzN\203\214@\226\261\316Y\035e\377\356H\216$\331Ho\266kL]E\323Ed\244\n\024\214\361\033\210\"\001\376\301\275\006\317x"
+	.ascii	"\204\364\034\246\245\227V\316\252\200\023\036ew'=p\005\360\337"
+	.ascii	"\370u\265\221\013\216\032\377?\244\315\374\232\302]h\231}\322"
+	.ascii	"r\215\2378\023\333a\005\234\3533M\211\277\366\216\273\225\236"
+	.ascii	"\013\361\237)Vk\033\303q\222J\\\237\260I\206t>\351\354\352\027"
+	.ascii	"\3554.\363\007"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.108.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\275\n"
+	.string	"\266TLB\020\311*\035"
+	.string	"\230'\214v\023XMA\005\276\271j\275\377A\372\b\350\345#K\273\"\203 \354\177\256mT|\247\211I\264't\006\373"
+	.string	""
+	.string	"\001@\220HQ\211\006]uH\246\036Tk\222A\366\336;\245:"
+	.string	"6"
+	.string	"7"
+	.string	"\017\036cY\315\213\003V\201\b\273\353\315\225\207\247S\206>\203\210:\355L>i\204\013EBFT\321\315\202\032\353\260\313\021q%\245Bgw-[b\311]o\373\302v\205}\207\273\236.\373\343O/}.\243b@\374\310`\227\3446ak\025\201\013\306\366\245\375"
+	.string	"\027\020~4\315\013\273\nf\007v\227\302\023\335\353\346\020\334+\375\003\367\352\320\016s\276L\263-%>5d\rV\322f\333t\231i\335\356Z\370\003N \304oy\265\310I\276\365\352\237\270\327\317\303N\023\234@"
+	.string	"0\246\344\315\216\251\344|\331\247\273\001\340\247\004\002a\200\242\317\367\231<\r\366p6B$\017\354\340\by\200<Q(\343\303\363|%\217\243\361\210\364\371<p4\372<L,\365\351r'5U\264\223t\332 %\371\226\351D\335\226r\233\005\r"
+	.ascii	"2\003\3269\004\353\245;\354%\264U,H<p7\016L\271\004\333\254\246"
+	.ascii	"\210\273\334T{40\265\007"
+	.text
+	.section	.gnu.lto_pidGetAirmodeThrottleOffset.109.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"m\007"
+	.string	"\022\31636Po\322\001\240\234\nA\204\353\332\361\017PP\224\272eD\325\264\242?Bak\222\217\2775\215x\006\310Ge\0313D\222\327\325\\\032\303\033\212\261,\331[\312\224\002\346l\032\256N\374D@\\\022\017\221\342b\230\210\234\314\0237\005\306:\016Y\374`X\026\255n\377VG\251\032\221f\330\2568\212Q\b\266\347'\026\004\244\335M8\364M\336]\370\245Cc\200\362\333\241\017\252\016S\001JD\231\262\273P\352\207\375\267:\262\237N\r\360h\341~r\331\345H\305,\013\\\t\261\255\331\226/\362\021\315F\275\216T20mh\250\300\354n\324|\240:|\027\250\016\025\344\332S\363O\362\205\224\323\313\306\205\236\031\205\335un\\\307\255?\260m\n\n"
+	.ascii	"2\241{\037X\301D\225\227\273]\023\205C\340\230\261\211\273\""
+	.ascii	"\315\206w\335\033"
+	.text
+	.section	.gnu.lto_applyLaunchControl.110.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`c\005\025\""
+	.string	"\346}\327D\200^Q:\361\247\026\025X\242\034BXQ\204\313\034\336\030\037\264\003\250\016\013\242ZhQ\240\345u\237\336f\301\033\336\312\336\020+\335\310\204Cr\0047\302\216\277B6*\310\020\261\270_\355\227|\262\211\334)\005\305"
+	.string	"\256"
+	.string	"\313"
+	.string	"5\302\251-\314i\277\352`\226\036\246\007\016@\345Y\375\330\252\265\312\310\022\252J\177\236\312i,\253\325\211\231\255Z\253\221\037\224\247\266}/\377\262d\017=<=\201\27105\005*(\250\326\232S\360\033y:~"
+	.ascii	"y\272P\276t\332LV\306H:\356\\\362c\032\202\357\340\2445\364\375"
+	.ascii	"\230N[\340DH\324g#\004\2603\201~\003b\305wa\222)\363\n\202\204"
+	.ascii	"L\324,\307\"\007\013\262\00492c\nj\255P\223\274\360\013\274\202"
+	.ascii	"D\365&-\362q\274\311\221\332c\373=\215\020\226\274!B\373\361"
+	.ascii	"\346\216\024\236\004)\261\375\234\306Z\030\324\327\203\237>~"
+	.ascii	"\2749c\032j\255\236\276\237\220\273v\333zl\223\260)\202[3\312"
+	.ascii	"Z\253\005_\353\303\032>\225S'\341\230\367\341 O\277FR\250\232"
+	.ascii	"f\361G\256\200\351\332\005Z\302\005\3542\321\261c\205\2077\303"
+	.ascii	"\354*\247\271@\373[,\026\213\336'v\321\263n\334\261n\003\017"
+	.ascii	"\363\027\270\235\352\027@t1\267\215N\017\321\351\332\247itzF"
+	.ascii	"\247e\237.?\035#\247\311OSrz\034"
+	.string	"\247\227N\317q\372\bl]\204\277\227\351\252\025H\221P%R\256+\317\372\261~1_\373\366\313\370B\323\262\276\246\206\035N\306\264S,\036r\266L\225\301\36016m\332K~\3204\333b<|\025R'q\317\024\025\260Z\003\261\257\020\027F\251\225w\301\036\3619$\312Zy\026\274J\230x\360\016\225\036\344)\271\027J\341\032\227\356\241\n5\315\242\321\211(*\334\251\265^\260S\274K\305\204;p\036g\005\213\026-\366dN\271\224\320\231\342j\232ES\250\322DK\271\300\232\227U\034\336\f\233^\363\004\004Kl\201\236A\356\321\333\260Y\272E\311\327\240[\361-!\222\013\364\307\374?\256\214P\215\267\035\272*\242\265\0362\260\255\217\007\317\200\251\016\224\221b\001\340\r\355\255\203TVW/K\203\331\016-\031\310\303{\254\265\211\301\334\331z\366\3768\315\242mS\300\332\272\030\363\276\271\037s\002\202\372"
+	.string	"\"\362\226\311\023\320\2205n\306\177\006\371}\037\253<FzGJ4t\034f\033\224l\350v;\035.jJ\272\335\326@\332\235\320\321\210a\343H\226\003i\307\321h\027\023^ \335\310)\311\210\201D\003F\316\006\322Q\215\234\213]\216\334\004\234\223n\350v9\245\244\244]\216V\325\364\261\306lk\231m=R\333\211\\!\321*/\374\215\\E-\231\025\255G\322\266D\353\3036Q"
+	.string	"\242\0374\304\246u\242%\230\266%qk\177"
+	.ascii	"1\357+\332\334\017._\352\221e*\277dI\315\026h\036gR\342\2262"
+	.ascii	"\325\231\203\333\013"
+	.string	"/BJX\354aq:\240f\253\215l\2016\260\265\335Y\301\241mm7M\017l\227\266\003\346\b\273\204u\2640\311P,\206\311\326\300N>\275,\345\312\266(\330\003\213-\335rc\301\036\026r\003j\250q8\003\225q\306dDDa\222V\306`\002\231:\233\007\020hF4M\2419n\"@Skh\203\344\262\234\355\0300S\347\f\204I\"\006MV+;\207\003g]ga\234\320\274\013\027/\206\201y\201p\335\\G\221>\260\n\t\021t\361\024\242i\003\261\332B\326\034\220=\261F\335\221)h\201L\217\211\003V);\207\324\305\231Ch\221\301\364<\177v'V\3054M\212i\376`M\361\323\f\261\257\017\374\236/D\330\260\331\205\345\2713\253{ G\234\bS\260(\372\251Q\360\247P|\301\"\220\021\226\316\252\273\337\rMD\270s\261D\207#V\001\2273\256}\373\2221k*N\177z"
+	.ascii	"\323\001\251\336\263\371\203q\306\324\346\354\254\205\373a\210"
+	.ascii	"\273\275g\243\205\";\305c\332\201\036\025\367\237*"
+	.text
+	.section	.gnu.lto_pidController.111.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\307Q\305A\001Z(\216uO\020\030\207\351\f\007\237&\"V\352\003\200>\200Bk\036\245\264\371P,\361\266\200C-\322\003\030\232A\237$\337D\225\226\340\325\260{\214\370\t+\342\032\352\b\231\006\n\b\003'\235}`\be\243\341\332\243\372\304\345~\345X\216^#[\312$\003,\007\227\006\204\007)xw\250\274\rPy\031\240\362\272\240\362\266\240\362.@\345eA\345]A\345U\241\210W\001*o\n*/\n*o\002T\336\023T^\023T\336\022T^\004\b\361\222\240\362\036 \001^\003\004\361\216\240\362\026@\345\025A\210\227"
+	.string	"B\274\003Py\005\240\362\206\240\362\202 \304\373\201\020\257\007*o\007*o"
+	.string	"T^\016T\336\r\204xu\250\2749P\360\342(\342\325@\345\315"
+	.string	"\005/"
+	.ascii	"\212x1Py/8\301kA\021\357\r\"\336\n\206x)\b\342\235\200\210W\202"
+	.ascii	"!\336\b\202x!Pym\250\2745T^\032*\357\f\225W\206\312\373\200\312"
+	.ascii	"\353\200\312\333\200\312\033C\345e@\345\205\241\362.\240\362"
+	.ascii	"\276 \342U`\210\327\205\312\333B\345e\021\304\273B\345U\241\362"
+	.ascii	"\246Py\023PyQ\250\274'\210x\213\206x\211T\336\241 ^\023*o\t\225"
+	.ascii	"WH\345\r2\301Kb\004\357\b\225W\204\020o\210 ^\020*/\002B\274"
+	.ascii	"@%xU!\336\017<\345+\034\301\233\006\3616\t^\036\301\3736>0x\234"
+	.ascii	"3\323|6\036\261U*\032\270\316\021\256ay\333Y\2073\362<\345,\345"
+	.ascii	"\374\344Lu^r.r>r\226\372\353\374w~\272\337\356\327\363\343\375"
+	.ascii	"z\377\336\317\367\373\375\317\037\360\017\374\007\177:?\334/"
+	.ascii	"\347?\363\233\375g?\332\257\366\253\371\327.\202C0\bF\200c\354"
+	.ascii	"\236\227\013\304d\253[\225\313X\013$e\235#\232\242\2543\244\346"
+	.ascii	"\260m\351u\327\225r\237d+\r\314\272\256\013e\201\236p\261i\303"
+	.ascii	"\372\271\260j\027h\227\221,+a&\013\304K\350\214Y\223Go]\327\336"
+	.ascii	"\201\251\370\326\334\365\372s\341r\024'\331\005\332#F\262%0\357"
+	.ascii	"\236\274.\033a)\236Z \270:k\324\370\b\234,\317\037.\262N;G\314"
+	.ascii	"\356~\216\370\211uX&\302N\305\037\274.C}\220\362\307\205\374"
+	.ascii	"\230\232\312\037\\g\320\312sQ\266\214\321[\327\225\306\205\273"
+	.ascii	"?\226\235\026\350\007\037gh\341$\266r\251YO\236c\236o?\027\356"
+	.ascii	"\351\260q\027h\221x]\032\230n\300\314\355\355\034\317\353\236"
+	.ascii	"\347w\317\373\236\363y\337\377\016}\237\013>\272@\203_ug\201"
+	.ascii	"i\364\230\f`\030\232\336\272N}\371\271\360\031&Go]W-?\267,\353"
+	.ascii	":\345\204\017\216\221{aO>zG\364\360\244\356\350Y\203\205\315"
+	.ascii	"n\235l\320\262\220\321\255sN [\030\275-?\027\336\231\201mL\026"
+	.ascii	"+?\027\326a;\233\"W\3640v\367\\\244\335\267}\334\002\301\315"
+	.ascii	"\3605\311\312t\270|i\351)\177\332\354\335\212\351j\266\246Yu"
+	.ascii	"bc\300\300y\333>\316\002\355\356\337\024\205\274\315v\2227t\312"
+	.ascii	"1\353\272\002]\270{\266\375\233\005\022r7\313\326\302IlE\242"
+	.ascii	"A\032\2757\371\271pW\310.\320\205\b\354\026\367eG\3634O\273\363"
+	.ascii	"k\316f\201\326\332\236\217R3$]\253\326\236\213\243f\f\230u\025"
+	.ascii	"\253A\202\n\212W"
+	.string	"\033\362\025\271\332\020(\346\212\336\272\212\031\241\325\3605\311z\"S\304t\351\255\253\030\013gb\006O0[g\272\232=\313\027\221,\006\370\271\231\223\025\177f\251\205\223\330j\034\316\321=\307<\327u\225q\341n0\007\001\026;\231\342\313\340\260\037\326\025KP\202\237\013[\244\347\335\217\371W\361`L'\261\256S\340\250YW1\032\033\343\347\302\025\273\211\341\205?\027\032^\270\305]\274\2131\327\242f\036\024\331s]W\033]\345k\013\362>\267\237\212}]\b\213\277\361\353F\337\264\203+\270\201\333g\001\027\272\317\375[\277\355[\276\345\263{\273g\3656o\361\366n\365l\236\265\333\272\245[<{g\355l\235\235[\271\245\263s6n\341\366m\335V\316\306\331\266\205\263o\326\315\262m\233e\263k\273f\325\254s\3256m\3216\315\236-\2325\333\262=\263dkf\307\266\314\222Y1\0359ph\220\001"
+	.string	"0\270\300\202\033\025P0\201\004\021@`\243\006\215\0312\036p\240\201\030\f\300X\340\205\002.Z\260X\241\"E\002(N\024\021\r\231(!\024Db\204\210\020 \020"
+	.ascii	"R?\374x\030\n\323\346\342>]b\301\223Db\374\215\217\023\345\257"
+	.ascii	"K\035\276\321\245\016\177S\332\"]\202\365\224\344\035LG<\021"
+	.ascii	"\341e \257\240\3407pD\226\340\267\317 \340\020\326\021\220M\037"
+	.ascii	"^h:\002\232B\340\302k*\r\357S.\353\371\375\363cq\326\206G\205"
+	.ascii	"\225\225\367\355\303\273\343\345\303\323\303\313'\317w/"
+	.string	"\217\035\357\236<u\274zt\337<:\2538^<\270\357\335\333\025\034\257\036\267o\0369n\274vVtqx\353\332\276t)\260\216mCXG8\274x\234\274w\354Pae\251}\353\240}\347\320\240\244\341\225;\373\322A\003\345\214wN\232\031o\\\330\027\016,\214\367\315m\f\257\0341\274q\332\276\232\274p\302D\301\360\276q\363\325\305\313\3665u\205\267\315\327\227\315\227\025\3365.\236\332\342]\243\306\212\311\353L\201u\264b&W\274j/\264\276iV_4+(\274i\236|\317\2360q\302\213\246\311\327\254\311\020\326\261\212\267,\005\326Q9\204u\224\342=\303L\236B\301:j\035\341%K\251\260\262\214|\315\244\300:\032\341\251\"\274cCXG,)\260\216Q\274eR\024X\242I^2%\260\262\210|\305R`\035u`\343\323%XG\"\254#G\324kj\220qD\257\201` g\320\347"
+	.string	"\350\003\310\030@\177\001\364\311\026@\345\246\362\370\006\336+\300\273c\n\364|\002=yX\002\273G\220>\240\267\306\357^SyR\023R]\311\313M\3251\004vtl\303.\216k\310M\331\321x\373\214\264\201\345\2330\227\233rK\211\3420\317\334k\312\216e\310\201\343\007\342\310\031\232\330b\263r\254\251\267v\240\355\r\300y\f8g E\341La\2501\f8L\344.\274\246\322x\201\266\350]xM\241\361\013\017\033<\375\212\203*\243\302\312z^\201t\304Y\nA\030vA%\t\232\267`\021\306+\322\b\234Q\004Cd\211;\202\261\n\263\2470\033\303\t\244\r"
+	.ascii	"\352\255]n\352+%z\222\352z\334]xM\211a\024n?\341\253j\017V\022"
+	.ascii	"4?\321|Q\n\243\t\350\346rS\315\024\305\231\247-0L\204\345CX\272"
+	.ascii	"\330\304\225\227\360\260\201\tcqbc\240XI\256\\\310\312\203\322"
+	.ascii	"\007\224nT\227\233\262\222\232\240\223\245\347^S[L\202K\213G"
+	.ascii	"p1Y\304\261\222X=\304\233\256\016\302J\311\bXAa\240'.\274\246"
+	.ascii	"\224\254\262\223\177p\201\225\344\352?\367\232r\302\036\232@"
+	.ascii	"\361Pn\252J\370\004\204\004\311\251\212\204\352\035\002\211S"
+	.ascii	"\332b]\327\2639G!92{\330`]\327\345$\222$\337\037\277\2536\331"
+	.ascii	"\275\235]\020p\004S\3127\320\252'\225nD\022\220\361\227\351&"
+	.ascii	"\323'FF_\255s\001:\345\320\321.\316Fs]\003e\3319\221^5\232F\333"
+	.ascii	"\350\242\276<\375\304I\215>\233\226\214\236\3214\372w\310,\307"
+	.ascii	"\252u"
+	.ascii	"\376\364\222f\262dD\274\273\033^8\243\037\250dk\256m\016\200"
+	.ascii	"M\265\316\032K\314\353\035\226`\320\255\353z\343\302m$\235\204"
+	.ascii	"\270\207\310\207\330G\354\033^(\243\037w!\030%\032t\215\243\321"
+	.ascii	"\350\034\212^\256\210\2625`Ell\020ek\224D/\372d:jO\200\365\213"
+	.ascii	"fc\237\315I\b\376\331\007\353\241\337\221\243\373@\377\331\313"
+	.ascii	"H\276#G\327\201n\240\037hf3R\304\201\376\231\272\030\335@\247"
+	.ascii	"o\310,G\216\256\007\274K\204\022\373\360\2231:\245\003d2\347"
+	.ascii	"\330\306\255\240H\322Y\264\256\353\312\f\364\013cpD\301\206B"
+	.ascii	"2\320((\311\232`M\034\345j#2G\205\321\027\354\277-\320/\032F"
+	.ascii	"\247l}\354\246\005\332\206\026X\0231\332\353:\243/:\007\253h"
+	.ascii	"\023\214H\201\031,X|\322 \320E+\320\036\372Z\270`\321-\272(\355"
+	.ascii	"\271\316\237?\026}6\255\313(S\326f\b\356+\232\206\276\025\035"
+	.ascii	"\304j\260i\302\271\273\374bo\017\024+A0\317\022*:\017\317OE\013"
+	.ascii	"\215\305\225\245\350\335\242\221\363\254\323\004\235]\002]\242"
+	.ascii	"Stz\207T\036\321\356l\211\362D\321\t4\217,\270\277\023\035\324"
+	.ascii	"(:\355Cz\035\217\214g\235wN4\nV~M\241\242\336]\032\\\247\370"
+	.ascii	"\224\203\271\256\353\005\313r<"
+	.string	"W\204\332s]\270E\"\305\250\250\341\205O\3565qt\211\272\250\213\330\240\006\2338\272\030\360P\357\026\245\212H\206O\022u\013\2476\002\256\353Z\242D\017u\321\235\252\267\246/\350\201\027\277\206&\372T\334\370\255\370\265CQ\211\222\341\205&\332\006\253\276f\225\363Yy\312\210\355\352\210F\371\234\326\265\351\205P\227\bj\021-\324Gz\0359\272$:\250Q\244!\365\2328\272#\232D\037j\220\t\267\025\227pF\364\341\352\266\330\204\335\254\223MD\177\315\212\017\nF\"D\267\337\023f\243\302Z\210\036r\261\312\203\216\350\345\236\315\257\244\354\013\336\317\276\206\341\246 \276\247Y\260\243\270\016\242_\260bg\361K\rD+\300*\017\n\326\304\321\275^\243\331`u\007\025\301\247\317Ne\205\247\t%\203h\0240\304A|\035\250{p\314\256\214\315T\330Q\274\272\032^\b\324'\323\252j\342(\023E\243\203\b"
+	.ascii	"!\301\3732f\007\324\313\365\360\305\313\007~\rC\242\262/J\017"
+	.ascii	"\177\r\303\357\351(2W;i\254\316\211\001wL\355/\261\272\003\255"
+	.ascii	"R{\271\377\226E\243\320\017=\005\207\341r\030\213\341\260\347"
+	.ascii	"Z\036E)R\206\027\346`\245\347\311\307\"\032\025\374\3410cu6\242"
+	.ascii	"\321@\017\275\\\025\206\037:i\314.\213\307\250\360#\346C\273"
+	.ascii	"`\345\326\004\213\213F\377\206\275\\\016\354f\036\311C\207\317"
+	.ascii	"\234\235\023\003~\305\216\327\021\215\002"
+	.string	"\n{\271\314\353\374\272\256\353\272\256\353\272\313N\353\332\364\"\004\235\230&P\316~\236\276YG\355\356\362\227\277\317\346/\214wacvN\f\270\375\030\303\264\337\313PUG\216\356>\306\220\003\373z}6'!\b\325\346\310\321\035\261>\3060m\016\354e\250\252#Gw\231\013w).\367\\[\254R\324\342'/\334\027\265\206\027\246\r\202\314\035\027\345WU\023G\327\001\336-Z)j\341'\237\327\f\224u\211\002\325;\266q\035\340\335\"\226\242\026~\362w\315\242l\213\036T\357\330\306t\305\216\337h4\312\227\366rww\213[8\313:\037G\267\256\353\215\345.\306R\354\262\347\272p\213_\212M~\362\302}\2619\274\360y\372\003X\023G\277b\307\353\210F\001\273\227\273\273\273/~\r\273C\330\215\32591\340\356\026\305\260\225\342\327\317\272\2567\226\267n(\206\375\254\353z\256\013\367-\f/\354\376"
+	.ascii	"\326\304\321]\256\302\314\026\366\\\313A\007\374\344\205\373"
+	.ascii	"\016\206\027r\213@\242\247\216\362\253\252\211\243\273b\307o"
+	.ascii	"4\032\345\343^\356~\243\321(\337\366\224\335\243}Yp\004/\007"
+	.ascii	"\276\355\313\200o\3732T\345\345\247\t^\376+\301\313~*/\3671\362"
+	.ascii	"\313|*/\363Qyy\357r\276\274\347p_\256;\235/\323\275\316\227\345"
+	.ascii	"~\347\313q*/\303\235\356\313o*/\313a)_\216\243\362\262\032?\371"
+	.ascii	"r\232\333}\371L\345e\263\353\371\362\031>\362\3450>\362\345/"
+	.ascii	"\225\227\301p\221/\177\341\"_\356\242\3622\027\246\372\362\026"
+	.ascii	"^\362e/^\362e-*/w\361\221/_a\251/s]\317\227\267X\207/W\271\336"
+	.ascii	"\227\251\250\274\274\274\336\227\247|\357\313Q\316\367e\253?"
+	.ascii	"\277\374\344\201_\256:\330\317S<\345\313Q7\373\262Q\345}\364"
+	.ascii	"g\337\013\252\274\177\252\274\367{\231\377|\216\366\375\236\253"
+	.ascii	"}\257w5\337\347}\355\373;\225\367yF\360\336\316\004\357\321T"
+	.ascii	"\336\247Qy\177\246\362\036\215\312{3\236\362}\031\027\371\376"
+	.ascii	"\314\361\276'\273\336\367fN\347\373\261\313\371\276\314\315\276"
+	.ascii	"'#\304{1!\336\207\251\274\007\023\342\375\227\312\3731*\357\305"
+	.ascii	"\250\274\017\243\362\276\251\362\036\214\t\336\177\t\342\275"
+	.ascii	"\027\225\367]T\336sQy\277E\345\275\227\312{-B\274\317\242\362"
+	.ascii	"\036\213\312\373.\225\367WT\336s\251\274\267\242\362~\213\210"
+	.ascii	"\367Z&x\317\034\342}\025\225\367T\202x\277Ty?E\345}\226\312{"
+	.ascii	",\225\367RT\336GQy\177\245\362^i\202\367V*\357\241\004\361\376"
+	.ascii	"\211\312{'*\357\233\b\361\276J\345=\023\225\367KF\360^\211\312"
+	.ascii	"{*\225\367;\250\274O\022\304{$A\274\237\"\342\275\324\020\357"
+	.ascii	"\217\004\361\336\b\021\357\213\f\361>*\210\367I\225\367DT\336"
+	.ascii	"\353@\304{\250!\336#U\336?\251\274wRy\177\f\342}\023\021\357"
+	.ascii	"\215C\274_U\336\242\312KTy\231\210xs\030\342\305A\345\275!\210"
+	.ascii	"w\211\210\327\206!\336\032T^\032\202x\207\250\340URy\205\250"
+	.ascii	"\274I*\357\f*o\020\225\027I\345\005\242\362\376P\301\353C\345"
+	.ascii	"}@\002\274\016\b\342=*\301+\203\312\033\203\312\013\203\312k"
+	.ascii	"\244\362\366Pyy\230\340}!\314'\321\3707\272?\246>\237\026XS\001"
+	.ascii	"<\254\225\375\211\220\003\215\264\217\017\207\316\341\006\034"
+	.ascii	"\266\364\r\004H\353\276\244\2674\330\034\200\r)^\361\351f\322"
+	.ascii	"\273\032\332\206.\022\244\241\006\263\020^M\303\205s\226\360"
+	.ascii	"\t\300\306\213_\303!}\277\224nH?\013S\020Z5\242\317\312-\204"
+	.ascii	"\261f&\207Q\246,\017\177i\006\323\334\344\037\262\310\244\234"
+	.ascii	"H\276c\227V\372R\347\003\026sLi?C&\225cZ\243\001\035\245\026"
+	.ascii	"A&U\226\\\322\304\321\025\32234w\351\266\203Tr\351\244\026\322"
+	.ascii	")\336fH\352\"\270u\336`\276-\315`\272\315\320\314\344B8\314?"
+	.ascii	"\350\332\226f\257f.\315U\377\340\205\354\310\0372H#5o\351\276"
+	.ascii	"\033K\343\264\005\351\273m5R\243\260s$\017H\377h\366\352\224"
+	.ascii	"\214,}\263N7@\372g\264\300\264\364\217\016\";\202\007\371\204"
+	.ascii	"\302\314\325>z\227\t\rS\032~\222\265t\213\224\315\0073\230kL"
+	.ascii	"iWc:\3235LkN\306T\343\243\231\311Qx:\022\227\\Rc\320\314\026"
+	.ascii	"\b\275\334\007\364\261\322\330\244hK*\322<\240\257d\3665?P\302"
+	.ascii	"\th\346r@\3572\275aj;j\0074\247\245fG\3758L\274&\030\214,\320"
+	.ascii	"(\036\340p\022;\223\234!\3775O\235\231T^\350\360\361k\376\353"
+	.ascii	"\242>\250\301>\237f\277\346$O\273\330\331\303"
+	.ascii	"\247\354L\026\016K\311d\350\022\230w\320*\256\346\321|\245U;"
+	.ascii	"F\312bh\030\232\271:\304\262\310_:\226\226\211\241\317Vg\324"
+	.ascii	"=\032\206\346\264\347\313\214z\201\272\2654,\005[\332\030\210"
+	.ascii	"w=\232\247.\034d\342\201\256\355\236\254<e\035<z\306\243\302"
+	.ascii	"B\207\317\334\345\312\336\034\t@/\227\005\344\006\367k6\376C"
+	.ascii	"\224\266\2710Xt\260\320\334\327Q\313\243\223\306\340\336R1\353"
+	.ascii	"\254\021\206I0F\223hL\001\206G?\f3\016jB\247^\326\031\203).\355"
+	.ascii	"\262d\202\216\013\021YT\\rO\212w\364\013\3154\307d\207\237\344"
+	.ascii	"\255n\201l\343\352\350\027\372P\203xR-LuYv\264\rL7h_w\255\223"
+	.ascii	"\350\n1\252\004\327\2437\3002\211'\271\307\301\n\335\200\276"
+	.ascii	"\237 \030\346\340\006\275\\\316\301\313\256 \251D\211\343d\232"
+	.ascii	"\350l\0075\rN\246O\326Q\234\203\247\264\252\004\211\203\247\364"
+	.ascii	"\243\377\020e\315\023(\247\006L\245o\246\001\315B\263\361\\\265"
+	.ascii	"\204\013^\2329\270'\315\200n@\367\033R\351B\267\320\f\360\273"
+	.ascii	"\013\3756ZU\202\275\200n\241\213\372\220J\262\276\231^@{X\241"
+	.ascii	"Y\350#\367\362\244[\353\374\321Z\241i`\272i\202\351\350\345n"
+	.ascii	"Ze\235:\230)\025^"
+	.string	"\366\007\252;\271>9@`\221U\271K\247\254\223\002\272,&A\032tXD\343\n)<\245I`\266\301\301\224\227^\255s\205\222\2514\t\3144\350jP\306L\236\fT\200\262N\025\355\226>!F\r9I\241yM\253\230\366\260\240[\327\246'w\231\370\244L\230\372\356\266D\001\255\3022\375\245T\304\272\035\024\320\367b\2225w\335L\tC\005\200.c\246J\n\275\313\004M\221\254\223h\212\030UB\252\323\314\032\205N\241O\260%\240Oh\024\372H\257c\002Z\207\026S\237\324\310:q\024a\022\274\301d\212\246QD#\003i\362\204>\037\323L\023\314\252Mh\216\322\0274\241\017w\025\330\254\302\240\004F@\227\200\200>\230+\277f\0251\372\307O\372\211\b\305O\256\n)\300\300\265\252\215\333\225\274\272\200\204\346-+\351S\352DBS\240eA\324\312\340\331\252Y\34459@\337\357O\356\001\376"
+	.string	"\235\343\n\257YE$mZg\005\251\221\030U\203\331\321t%\032\221\"\"A2\274\220\237\364\nWw40\257\357\263>\272jI\256\352\363\351>\200\006\350]\242\022\"\023~r\323\325I\033w\2046@\017\263\002\377\210M\372\217\370\344g]\235nl\373\341"
+	.string	"G\264\372Y\327\365L\303\013Gh\027\256\360@\301\n\320\007\344\252\026\241\013\320\377\340E\350\217\271\272\323\254\342[g\r:>K\f0\367\270\252W\270\262\003]k\272\321\313\335\301\177\352*\016\314\363\251\002\002t\322\357z"
+	.ascii	"M\200\356>\250\252#G\007\320\352\\\237<\250\265#G\223\024\b "
+	.ascii	"\bo\347\341I!f\361\223\002\350T\315\340\2339OmlcT\306M\320\313"
+	.ascii	"m<\177^7\031\301*"
+	.string	"o\004\313\270\221 \204\037\fBo\347\261\253B\324\342'C\350\026H\020\372TWjM!9\3064\021\f\031>\257CP\3517\260(\004\037t[\351;v>\350\253i\375\205\021\214\332\360\240\017H\274\322s*\374\254\353zC\316\203\246Q\207\327\327G\260\206\234\177\254\233L`\336\230\035\033K\351\220\367\205F\007)\231\f\034\200\336\236C\324\302On\303u\034qK\027\342\027\004\276w\303\013y\252\233D1\374d\007\335\002\252\215\373\301\007\240OuU\326\254\222\322!o\313\214/\333\360c\375\300+m\377\234\222LT\306X\013\215\177\177\375\3468<\347\030Yp]\327\343\003q\226\317,\036\013\262*N\256\353\272\302Y&[\274\237u5^\371(\353W`\2265\312\352\300\205\273\355fw\361~\345\017s\235Z\305V\007.d\301\"eq+T\317\211\007\233\034\350\345r\f\346\323L\344?\242\267\345\f\312\311"
+	.string	"\357\365\246\013l\320\314\327Q\273\314\027\275pJ\3317\206\347l\217\257\333\254s\210\216\215\rM\356@\241\030\033\340\240\271\253\231O\037\231%FWR\031\203\273\232\203\346\275>Ry\274`M\237\034\003\\\2453 \243fe\f\316\211\001\347\254\353\n\243\227\033m\016\372\20517'\006\\\256\322\217\3660\013\212\023\371l\342\350rWo\320\\\2459\215uP\343\\\"~\021\357\270\253\231\310\323-\306\264@\345\327\232\330\272\256\013p\320I\317F['\f\272\260N\263DDw\306A\177\211\262o\203\376\340/\310"
+	.string	"\376X\357\022\307\210d\374\344\006\375\350O\005\352m\n\252\347\324\306]\327\325\370b\001\274KDCL\303O\352h\004\312\344LA\365\216m\\\025x\227\350$\256\341'\367l~f\237\035\346\034\333\350\247@/\027\310\256\005\357\351\266;!\343/C\243k\314\256\243\321h\233\213^\362\236\276\333S\030\253+C*\217\034\335\034\375\262u\022\365]r/\203\306\321\253A\3470#\302\325\230c\3047\277\303\246\313\320\221\301\321'\354\260u\030\230\006q\315\013\032"
+	.string	"\275\030t\006cDx\232\030\342\233\333i\3530D9\177\323\004@\237x{\353/^0\200\222\3002\332\202\336\033}A\027\243<\265q\267\271\214p4\272u]\237\334B\244s\301\205\273\304\271\366\"\332\271\033\246\026\013\372DZrI\023\236\306B\254\353\272\321\367R\302q\235\026\025\320h.+\024t\005\024\004\315a\005\262\350%\326'`N\320\237R\272A-\200\322l\263b\306_\246\205Z\372\346\336G'\253M\205\004M\245\370\244\001]/#h\t\332\203 \327E\320C%Q\234\332x\033\253\223&)t\274\3705\204\240\357\245\245@\320\017+C\r\243\037GJ'V\206\032BdP\332\361\303\006\020\244\037?\220x\240x\201\001\fB\017##\030\200\220\222\226B"
+	.string	"r4B\217\020A\036\354\br\202QR\020\017IHJ<v\200"
+	.string	"\344h\204\036\352\222\322\021\017$\037F(\210 !\350\307\350\303\217$#\245\001\b\031\202tD\203QR\020\020FJ;JHBJJ\372\340G\222\221\322Q\b#\036@\206\b\001A:R\342a\224\224\204\324\201\220\240#\021\370\250\003 K\036\b9\262a\307\207\035J>\214<P\002r\204\024D\311\310\204\036GAF"
+	.string	"9\332\021B\217\244\0355$!\301\320\303\310\b\006\021IHJ;\206"
+	.string	"1RR\342\200\204\222\020$\244"
+	.string	"\304\260\303\303\217!&\3648\n2\334\241\344\303\250\207P\310\221\r;R GAL\250a\307\022\b\037HIJ@\220:\220\201\007\220!;|\b\031\321p\244\304\203\003!\0030\032\302C\210Q\tB\202\304@\302\250\007\322\b>\214h0\362\361\001\310\321\216\020b\3301<\352"
+	.ascii	"\310R\017\341\217$#%\017\214\224v\224\200\224\264\024\003\b!"
+	.ascii	"\t0\372qt\202\022\020\243\244\244!<@\030\3718\202\001)\211\204"
+	.ascii	"\036GA\324\345Q\243\307Q\020\033J2\304p\344\003\006\033@\216"
+	.ascii	"v\374\260\301#I\210\215\032E\213\024\304(\311\206\022\022R\222"
+	.ascii	"\r\240\335]\261&\002\304\211A\365\232\372\270Kg~6'qc/\367\203"
+	.ascii	"]\221\001\273\355\336$\343\feh\377k/\031\332\f\330\207\222\346"
+	.ascii	"\017\251<z0\256\323\004\323\303\272\304\304\204x\347\201\252"
+	.ascii	"N\333\022\211\f\005\327I\304l\333\275\241\3100\220\030U\242O"
+	.ascii	"\234ss\031\250\034\363|\363$UT\313\336<\275\251\247\2105\261"
+	.ascii	"\311\020\372\024\343\333\n4!\325\225$\366ryy\032[9pTo\212\203"
+	.ascii	"\260_\006\366\277\255\224)kc*k\216j\024d]N\244\362\330\307\307"
+	.ascii	"\347o\250\227\2077\314cW\347w\307N\235\347\223\216\336p\3160"
+	.ascii	"n\253\257\305\326\364\315\345\320\313\345%\031\347\345\257$\371"
+	.ascii	"\246\274A\306\205\035\265vzk\374p\bk\366cz\022\326_\023\345\330"
+	.ascii	"\306?\240t\243\272\341\253_\260\032\272\251 \347\253\317\346"
+	.ascii	")\234-\276u\251\006\246\353\266S@\306?\3265\226\256\353\272\332"
+	.ascii	"\320K\246\353\313=\205\261\273(Ry\364\003\374\365\312\244\353"
+	.ascii	"\212\245\343\203\277^\031\216r\rr\355\206\255\rq\353\256Y\305"
+	.ascii	"m\356"
+	.string	"\346V\032\306\364\332\0325b\306t\013\"\263D\001\f\323\027\323+\310\336\f\323)\310\300\364\273\364\233_\372`zh\007\251\347\245\377\205\351j\230V\374B\363\322\303\251-<M.}-\375.\335\202f!\266\364\271\264\2074\244\227\\\337\253\277\245\205i\321!\232u\016\315\356\3257\230\244\f\317\254S\005\0311j\210iFK+m\335\201\202\311Hb\225\034\322\313\315\322\337\313\032\226Q\201L\226\236Qw%7[\306\352\260\364\273\232\345\232\357\256\f\303\326\371:`\304\250\277}a\351\327\251\003\373\225>W\277\253\213\310\220\312\260\241\230u\336I\027\206\030u\264\346\225\276\263\016\314J\177\253\317\325\302>\244\362\313:sx!FY\320\305J\347\250\003k\332\262N\032t^\304(\006\350\264l\365\275l\331i\202\t\321\352\335e\352\032b)>\335\fs\330U\245\257\325'\356\240\006\233\316\354\"A\244\362x*U"
+	.ascii	"K\304\365\2514\n2\244\327\321\016\024\263/I_\366\275\f\267\226"
+	.ascii	"\375\251\2558h\325\224f"
+	.string	"V\241\302q\375\254\376\224\035NY\247\212a\0261jh\210\365\254V\332\212c-9d~3\260\3751Vs\\\363\035R\t\327\227\322\307\352\";\3108\303\253u\016\225R\372\321\013\327\266\340\336\232\341\232\263\376a\313\216\2258\244\3371J\363[_\020\351u|\224~\364%\330\261\362\006\371\f\"\247\235\254\023\006\263I\325\251\324U5q4N\263\234\236\221\206\364S\262Nv\322\r\251\210Q|\206n\2078\315X\017Ao\213\255\t6\265\316\005\244\216,\331j\003&*9$R\265\345|\016\221\353\\\200n\370D\214J1tr\240L\233\247r\314\222\311\312s\006\351\007\002\315WO\333\346\302T\361qe\363\263\243.lj\3637V\367\354\241q\235+\230\303\225\0305\304\214\262\325\017`G\353Mr\017\b\224\376U#\360\243\227\313\017\220q\266\372\245\262\2605\201r:@\002\264\216\272\352+\233\257\002\327\271"
+	.string	"\235\260\0171\252\002:\300\253\376"
+	.ascii	"f\325Wv\232\206\324\263j\017\202H\264>\224\016Zj\275I}\f\272"
+	.ascii	"Q\205=\340\305\257\341\237\264\b/\246\245\360\257\370\345\367"
+	.ascii	"\244\331\352\302\301-4'\007\264\021s\304go\317\023\357NO\024"
+	.ascii	"\314\263\211\243Pa\335:Y\320\021\243R\340I\2425\370|\002\312"
+	.ascii	"\340\314#\022\021\326\231\223\023\004\023\303]w\031'\036\030"
+	.ascii	"z\271\033\007\367\346\367|6Y\201a\3661\352\345\342\330z\201\323"
+	.ascii	"t\21131p<X\255\237\246\243v\357DN\234\266s\361\265\230\254\360"
+	.ascii	"\223w\322\r\255\302\3664\275\313tE\350f\235*\204l\304\250!a\233"
+	.ascii	"\033\264\360\232=\230lB\277Is\232\326\302\264\205\237d5\341\232"
+	.ascii	"u"
+	.string	"\226P\303$x6'\321\3703jM\272\004-<\350\236\321\331\023\343\321\313\345\035h\311\346`\003\326\3715=\353\250W5\016,\265\277%\177a\252\352\206Vi\316qj\343\236I\177Is\232\3467!\0323&\3756Z`g\315g\372K\032\305\322\352\254\217\246\371\254\373.}\241\227\274\243\247\334\256\031\312_D\3561\206W\322\267\353e\250*.B\262\342\262JQKI3\224\013\327\264\360@\2154\240\227\313.\260Y\347H6\325Z\210:\232\3562j_R\006\210\021\222Y\347\341\350\304\230\004\377\206.\214h<\032\023\314\254?\260\223\013\"\312\250m\031\263\213\322c\3269\203N\314\222\2110W\243U\247Yu\252\3463\335lH\345\016T=$\023\202Y\347\331\276\204_\226rx\331\241\207m\264\342\240kI\232\313:Y0\205[\322\273\344^\323\223\364\341h\2755\327\210\264 \264\362,X@(\253hY"
+	.ascii	"\222+H\3360\360'eea\306^\332\227_\221\222Ep\205\027\237\206["
+	.ascii	"\305\247\034B-2:\276&\216\272@\342eK\205\251*S\375*-7\315*:a"
+	.ascii	"\346\316(@FS\032\226)\353T!\314\"F\r\t\261R@\2556\317g\023\037"
+	.ascii	"q\2432\223\202T\224\253#}\251#B3}\322P0\002\305H\277J\313\331"
+	.ascii	"\\V"
+	.string	"\305I@/w\306\036\332\237Y\330^\337\tEZ\350\244\370\224C\330$\252_\244\213\336\302\242zh\005\002o\216\217\tO\366\357,IVi\2515\033\230{\256\225\320\313e&\2772y\245\034\201\301\264\2113+\345\007?\323Q\302&\264\274,\353\272\362WsX\003-\2338\211\204\t\223\b\221\b\247\370\253\257C\237H\247\202\305-\302#Ft\350\273\321*k\202]\351\237i\376j\236\272\b\313*<H\257#\002\240zwk\b\243\204Id\037\352O\310;\365\237~\354;\t\2214\204OB'\341\361\310T\222FHx\223\320\370\246\350p\316\223\310\001<x\225\365\031\253[A\204\212\232\001F0vtp\355\033\273\250\370u\2077i\346\254 v\221\3014S\023{\205\035\300u\236\217\te\022\374]\205x\250\223qd\221l.IQ\350\030\232\021\031\231i2\254\001c\026@00,$\226L\233$\037\023"
+	.ascii	"\204\215g\"\302L\016\222\022\031\3134I\222\306<6S\005\2027\251"
+	.ascii	"l,\367\301\004\215\224\262\005\373\223\336\250'\2707\360\372"
+	.ascii	"\314\305\213a{\213\272\237.\257r\t\034\225\304m\320w\203\263"
+	.ascii	"9g\373M\351O\001\363\332\354r\2349|\367\255\033S\303\217X\246"
+	.ascii	"\243.Gy\374\275.\036\362\334\016n\223\323W?\346\235/\236\273"
+	.ascii	"\325]\257\026\bM\362bsN\260\212\0043B&\256t\326\273\232WL\245"
+	.ascii	"\203f\005\033^\244\224bF\277\017kn\340\242\306\345\245\350\266"
+	.ascii	"\202^\212\021\3771\004\3631\213\013\321\242\373c\t\302\"\271"
+	.ascii	"\\\360"
+	.string	"\272 \311x\346(\323 m\177\005&\222\265\372\352U\202\213\3411\366?\317\217\tG\374\004\266\345\355\007lB\235\374q\301k\323\223\357\227\f\303\207\336\220M\335R\036\374[gVd\356D}\312\205\364\273,\365:\013\037p@\fO?\275R\244\370\017\371pKD\323\253\t`\005N\001p\027\272\316\354\270\373\356\355s^\3613hHF\367\363\320Pv\340w\257\247\1774~\316_\277\t\031$\037ms\023Cc7\032yDq\312\330s\301\037\346\007#\222#\217c\353\2650\007\374\364\027\215\337\360XSdDM\342\246\211S~G\340\300\031\202\356\265\340@\201P\233\300zP\241\267\222\300\265\023\236`-Y-a\256\213\244/\225\0010\317\303J\226\224\240\357\034\271\2200\273\364\005\344d)!\210!0\373\001<Ei*}\200\375o\243\334B\264\362U\250\321cs\013r\330\332\025\003y\360\360\217cm^"
+	.ascii	"b\221/"
+	.string	"\356?\021\246\215&\232p\375\251\340\315\2425\320\334\025\027k\262\325\1771{\220@\364OZ\312H\252\335\241\220\305\271\034d\026|\214\333\006Gqr$2\277\223\033\255\216\355[s\201L`\221\207\024\205H\324YZ\343\247*\205\226\036o\367S\021>GJ\315\231\353\322\363D\033"
+	.string	"7r6\377\264\344\215\353\224\370\361\001\362\310\246\303\355\022\330\323\0050mu\352\030Q#-"
+	.ascii	"\007\213\017\341\227\210\261\217\177?)\361ZZ+U33\256\251\247"
+	.ascii	"L1\324\0051{*\255\024I\250\324\260G \206j\201\300\345\254jJ9"
+	.ascii	"\377\341$+n\301M\276\360v<\374No\330h\217E\0333\3228\224uO\211"
+	.ascii	"R\234b\252]{\033\032\265C\327k_\031\327G\252\355\"n/:\352\330"
+	.ascii	"\364\013K\274\250\255\354\240\325\346\021<\252\037Y&\237\273"
+	.ascii	"-\005\233\303\232\306})\263\340\336\305\370T\3572|\2174_\334"
+	.ascii	"\256\307X\222\307\306\310:e+\320\276\305\307\272AM\220\256X\272"
+	.ascii	"\304+\333\253A\255\337\244@\247O{\361k\372(\327\363&9\315\300"
+	.ascii	"\363\320\032\005\267^'\307\233\332p\021q\030\323\243#\271\335"
+	.ascii	"{\007\226)e\020\346)&\003y\351\201Rs\001\3361\235\334\200\217"
+	.ascii	"G#]d"
+	.string	"E\013K\2301\262\247u\337]\237a\0314\211v\371L\240b\260\022\240\240MHs\025>q\037\030\322:P\036Vj3Dr\341\264W\307\206\027R\"\264\216\216\221\306\265\203\326\253V\242\246\024U\231n\177\242\303\375|\245\345\331h\360M6\3727\370\275\037?\313\275\365\262\2356\333\0177\035\242\326\177\033\301\212\360A2\034\270\2748\364\234\254\224\277\264\301\200\254\037\320J\211\036~\036\360\355\210\306\024xA\257;\300\261X\374\032\245aK\nC\017\333\300@\376\326G\247\310\004\260\f7^\307\210\312\203\211\236\245\355\373\303\n\240\023\023ur\347?\036Q\226\034DOe\\ M\341\315(\241\312y\240\017\177\232\032\217\333V6N\304T\235R\244\030\220B\022\355\360\345\200\233\333\013.\246\013'\275\261\221Fg\356V\217\222\304\241\fq\243\354{\321\330\017gX+dc\341\317\204`\310\205\035\233\003\330\027\2208"
+	.string	"\350g\307\246\243A\204\341\023\306\346@h}v{p\004\030$\370g\0221\204\233\t M\262\004\225\310\267)\214\250\263\002%\220\360\201\036\251t\200\t~'\262'\017\272\217\"\027\361K\315\350^phPb\241\320LG\337c\300\372K7y\335\367\001\303Y0\274\006\264\237|\247\3072mr-i\032\323}\376\267\330\350\224\3003\243\267\211\005\277\237\256\301*/\226V\253Ef\231J\"\211\214\224\275\277_\2412\360\367\034\3451T\025\320(V*\227\251\037=\363\346\356\356]f\230-@\372\024\310\351w\215\022\366\025\300$1"
+	.string	"\360\312\262\254\316/k\324\232\262\362[\304l?\005\353V\365V\243\003\220 1g\025\026\241\032zy\355\016&i\262N\333GF\034\\R\037\362\f\214\245\263y\310\200\336\013\310\007\025cJrh\017\202\032)\013o\317Esz\3668\231\006\305\035=\260\004iH\231\271:u\241\200\205\277\3745\b\3542\027~\027\037C \346\364\232\263\254\303NT\017KP\225\307!\207\314\256{c\250\204\276\035\025,\t)\266\345\254\335\323\306\223t\022?\351\235\356Hz\312vidv\244\211a3\214\265Q\342\343\313M\242\203\3552t\326\314\355\352\026S^*R\330\300\237\231{\217\302\020I\t\033\345ZCaPH\007:j\273\270\346}\303&\033\017\207\306\353\374\250e\342\276\"\2519\213\177\004\217\266\036\260"
+	.string	"\030\260@\340\345\026\342!PTCW9)\032el\2117\307\241\242%\006\341\264%\337\323\3452\377Z\036@:\355*\314\222\334\352,\354\301\312\272\013\352\270\247\261= \021e\272\013X\374)\177\002\177\245$\240\230\032\365\231\315\354\"\324\213\"`\367\n\320,\016\246\005\325\236\373\344q\024\216\240&#y\363H\376\300t\004$}\027a\376\332\252\365\367B%\300\242\204jU\376\236\307X\324& \240/Jc\213'\226\3470\3322\256')]\t(\264\313G\034\257%[\3726\340\371N`\321\263\375\367\334\251M'n!*B:\240\201"
+	.ascii	",\222\330QH\363o\254\301\325\003OPk"
+	.string	"\037G$\331\2038Zqp\233\366\001va\021\3725\017\225=\314O7\211\3713r\346\277\032g\013#*\r\242\275A\201\2654#\317\004S\236Wk\231\020\350\031\221\376\250\001\223\337P6iyU\r\312\346Ag\262\311\300\224\001\022\250#\355a\263P\227\265&\301z1\243\376\020RxXy\336g\210A>\242Zw7\361<$\2354;]b\306\2579\374\336\037\212\022yy{\341\b\215\224e\203`\262(y\271(Be\242\202\3634\354I\341\272\241%\016\265M\350\302\303\322\310\203,\257\307\213\001\0070wq\n\323\335\361\231R(5\236:\232q\300\267@\017l\332\017\003\341\345S\3511\030\020\371\214?\006~s!\257\236\372\217u\272^\335p\207G3\305{ \3372@!\2627\233J\237\231\202\036\250\345I%\302\332\fA~I\216P\365\367\241\031\217a\316\002%\325Tiyv\227m'\030\376\300"
+	.string	"\013\353\336\\V\016\253\242\201./^\343\217\324\375\207\223\3615b\2754\221N\251\244\005\207\212\335\220\321\256\001;r\336y}2\201p\b\341E\203\360\371u\022\225e\345\241\220)\356\366P\235s\356\316\236[\375D\203\330x\024t\341_\b\024\211&\023\005\273\236\362\243;\016\234@\004\242\335\337\r7\266\330\222^\205\361:\250\366\277\035d\311\252*U\003\241\2718\t%\211\306\2346q\227*\215+\300\nC\207F\206\262\265\215\237\017\005\331ne\n\270\213\b+\033\240IZ%\273\013\233\301O\3670\276\216\313\365z\365v@\213Y\253"
+	.string	"\2500\272&\274'GX\030\330\031\361^\317\b(+\300\247\362\362+v\250\272\246\004\360\234\264\225\263\371\026\330[C\353\364\f:\254\262iO2\377\n\230\272\263.\312#\273\225qt3\335T#[\276\023\314\242}!\325\365\007\251Vq\313\025B\247W\256}\304V/\374l\033\013\277E\264\320tpd\325\300\226\340$ZbV\2001#&\307\315W\265V\320\227\202"
+	.ascii	"\n)\300\272\t\262T\251\372\325\251\005c\221H\004\341\004\355"
+	.ascii	"E\372\200V\200#\352d\0204\342\365-\0276yG\254 \301\372\022\261"
+	.ascii	"\334\314\373\030\016\265\230RG]\255\334NK:\242qTj\031\017%\205"
+	.ascii	"i\252\250\327\006\335P\342\242\231\252A0m\004\005\214\315\237"
+	.ascii	"\343\020W\2430\270\315i\346p\372\303T\330\246\214I\224\260\024"
+	.ascii	"\264\032*\020\310,r@\334\252y\324\2240\224\204,\360\r\3379\301"
+	.ascii	"\324\024\3555\364\353\032Q\310D_$q\205\232\373J\212\247\237N"
+	.ascii	"\220)\333z\257n\bM\032\316B\020\333\207t\242l~\350\200'%\030"
+	.ascii	"\021H\343Q\256+\003R\":,\316\032;\326\210\317u\205\251d-Yc\266"
+	.ascii	"\252\346t\310p7\304\330\327eb\300\263\n\242\250\350,\300\026"
+	.ascii	"\"\267\241\0324\316\261P\b~R.\335\232\303qs\310I\354!\362\374"
+	.ascii	"\032\243\251\002\023\\\354\271\230\275\210E1\227\360\r\327{\b"
+	.ascii	"\371T\233C\n\326m\217\355\254\205\002\331\013.n\233\036\t\017"
+	.ascii	"\334=\224\310A2a"
+	.ascii	"\177N+\223\260H\"\303-[Q\030~_\211\234B\025q\254 {;'\237p\f\r"
+	.ascii	"\035?X-\333\357P\257=\267\032\310\263\360p\003\017\354\031\\"
+	.ascii	"\363X\236\353=l-Q\204\003,^\210\235t\257V\230OP'-Y\324\243s\256"
+	.ascii	"\357\372N\273;\314\205\305<\315\236\372\373-\233XJ]l\361\036"
+	.ascii	"\373\302\\\206\354\222w,T5\235\223\222\254\202\315\242Z\331\371"
+	.ascii	"\227\371|Tm\232\206\260\322\364x\266\356-\313\221\032\332\037"
+	.ascii	"\212B\351\366\262 \017rz\330\273\243\360\224\205\244\027\357"
+	.ascii	"\226\376\226\200?\256\305\235\346Y\273\b\300\225{\355\n\266\215"
+	.ascii	"\326\030\215\250\377\340\242@\224t\205\347\222W:9\200\363x\253"
+	.ascii	"\005f\367\007\216S\202\212\332\204rV\035\265J\215\226%\363\f"
+	.ascii	"\336v\023\266t\272bQ\351\363\364:'D\361\347\244\370/\270T\333"
+	.ascii	"f2\243\257\376\353\2020za\202\212\253c,r\363\212[\013\267)&\017"
+	.ascii	"\025\201\313\332\205Nb\240\217\311\334\212\017\264-\234\330\f"
+	.ascii	"\264\255\236\023\364\2232\331\243VW\221\022\026\b\315\331\362"
+	.ascii	"\223\017\362\366g\2343\341\224*\351\002"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.112.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\322\214/5@o\222\016\233\016\003\201U_\300rv\214\265`\020\200<\360\235\tX\242\370\177\263g}\253\213\033X\321\310\33031\201\354\017V\301&\003\220u\206\265\r\262e\ng0\020\225\346m(&\252\n\211wQ=X\274\314\205\3610\007[\232\210\353m,\353z\027-\353F;\204\217\343\3703Z\202\rd&\303%\251I\343\222J\275\301\301f\245.'\240\024:\002\323\007\267\327<\350>\276"
+	.string	"\231\231\273\321\217\2433P!\211Z\3322A\033K\246P'\245\277\177\347/+,t\306\252\205\200\nPZ:N+\231\332s \305\212\330\355H\035N\"&Y\310S\024h\310\3141\013\211\272k\302\357\021\007"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"\303e`\270s\322lc\327\275\001"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.113.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"}\n"
+	.string	"\266\023I=\020Q\225\016\033B\313\237\226\244s\213\216\344\0210\243\036#\027=\262\"\200\314\321\267\334\fm\r\353\330,\205/9r\367f\325N"
+	.string	"T+\020_p\036\213"
+	.string	"EH\023\274\244E\262\245L)5"
+	.string	"7"
+	.string	"8"
+	.string	"\245\0212v7*\206s\207\232\234\177\326\037\235\027:\314PW(qYh\021\361H0"
+	.string	"\005\025\250\263\236\022\274Q\246\243\262\273\316\316;\335\330m\033\260\035\355G\002>\\\275"
+	.string	"\277\372\365\351;$+L\247{x\261;\341Ec[\330\211\016\266\017\261\235i\017 \300}\005\232\034F\211U\212\335O\200\001d\307\314\331.\376e\330\t\nSP\235\245\032i\"\206\253\202jJ\365\232@\004\013R\316\260\335y\bP\266\273\005|\020\377\"\370\033\216\331\363\311w\307\374\317\306\261+\002\r$T\037D\371\262\277Qj\312\001\230\315\262\035\360`4\231/\024\005\231M\334\0320\3108X\0205\031\313\203x\341t\"ebm\203\341\304M\3238\021\362\211\316A\325\022\351\b>\022\252\255A\310w>\353\025\222\206\254\032\017"
+	.ascii	"2\003\302p\310\204\325\t\325\343\275Hm\316\211\307;d\004t\r'"
+	.ascii	"\230\300\200\352\276\222\032'\356\\T\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.114.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"e\013"
+	.string	"6\024NE"
+	.string	"\215L:H\025>b\032\260.|\341\026\006\223{\3707\005\036\356\316\325C\226\200\273}\240"
+	.string	"\314\242;\212\220p\260\n\021?\326l\333\2646T\r\241\"\370\326s\034\320}\024\214P\013\340$\277@\232\354\275S\n8"
+	.string	"7"
+	.string	"<"
+	.string	"\233\r\007"
+	.string	"P\330\355n\235\n\036\236N\031\372\247\035\323\022S\247\257O\252\321%\020Q!\262h\206\201\016\257\323.\003\210+)-\036\273k\331\022]\367w\333 \266\253\375\217r\306\354\323\2350\373\263\237^\372\026M\210\n\256?\260\355\n\350\235\330\334w\301\201\355glKiop\204\237\2416'q\233q\330\0355\214q\371\347\320\036\361q\301\006\023\214\323|\250\235\200,\303n'-\224\320!\2303F\347\247H\r\004K\232\260]\272\004\324ew;\374\b\037U|\006\377l:\311\267\376\371'\212\177\237+2\f<\b*\331\263\307T\037\260\003\206\230>\241\213=\234\021\320\250\202&%\240\023\222\032\002uP\252\207T\252\234\215E\243\017\251\202\"\021\251f\306\375\204\031\323\300CN5W\246\363\206\262\260\r\220i\340\025\2403\206\273\260S\036\023"
+	.ascii	"3\001\037x\006\204G\2300P\334!:\355\260\033\"\342\362L@ \356"
+	.ascii	"\021\2628\361xw\214\200\256\341\023\231\360Jj\234\270sS\2653"
+	.ascii	"ESP"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.115.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\322\214/5@o\222\016\230N\022\005\362\004\210\rc\307\320Zl\376\200o\nL\300\022\305\377\233=\353[]\334\300\212F\306\236\211\td\177\260\n6\031\200\2543\254m\220-Sg0\020\225\346m(&\252\n\211wQ=X\274\314\205\3610\007[\232\210\353m,\353z\227-\353F;\204\217\343\3703j\202\rd&\303-)I\343\212\224z\203\203\315J]N@)t\004\244\017\236~\363\240\373\370\002df\356F?\216\316`EET\355$\023tj\311\024\ne\344\357\337\371\313\n\013\235\261n!\240\002\023IG\211%s{\016\244X\021\273\325\352P\322LY\310S\024h\310\3141\013\211\272k\302\357\021\007"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"\303e`\270s\322lc\327\275\001"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.116.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"V\226N>0O\224\016\210\317\210e\024\"P\005A\327\251\360\202\200\302\027\310\225N\206\0210\2563\340\265\377\373\035\320I\364\346\370\177\362\016\317t\242`\202\024\234\321\035u\275\364\261\257K>\331d\313\224\002;"
+	.string	":"
+	.string	"<"
+	.string	"\266\212w\033\226\262\301M \301bw\343\323 \245\224P~z*}\210\025\3216\320\247\n\303_w\265\260\215\246\312\356>\343Za\023\251B\254\335\265j\033\351\206\267\215\300v\264o s\266\360+\331\347~\250\352S\223\231\202\364\017s\367\302|\261\035\360\004\206\375\316\226\\b\373j\037\304C\310s.\341\310.\007gbw\013x@uX\371\204:\234\036\200:\264\f\n\237\315\271\364\232\247\007\372\234\363\343\331C\375-\320@1R\027\266!|\204\247\332\335\003\276\210kD\360;\034Z\302G\257\035\372\037\352\360/\001\007\017\017\\H\247\335\211\364e\260\377f\230M\226]X&\253|\2610\320tb\226q\240\3314\210\0174\n8\361\202y\242\205\342\253\203\301bv]X\224t\241\277R\306O\001cv\204\236\310\002\254\365\330\340X\261\335\022xw\013\244\037\323\356\356\004 \020"
+	.ascii	"2\003\356:F\027\303\363\233\r\240\301BI\205\203P\230\350:X8\227"
+	.ascii	")5#6\253\323\3045\0020<jd\177(e"
+	.text
+	.section	.gnu.lto_dynLpfCutoffFreq.117.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\364\001\275\021"
+	.string	"\006\243wF\340\360&\035\336\364=\024\212d\260\307\257r(\026\217\304s\275\n\251\241V\350\037\231 \377k,\301\\d\237\021\333e\353\313\253\326\205?#\0179\242\001\021 Be"
+	.string	"&\342\007<\332\363\2502\232X\223F6\2212\245`"
+	.string	"]"
+	.string	"c"
+	.ascii	"\031\022h\332\237\235\304\353>1\216\27381\212vg&6\320=\202\244"
+	.ascii	"\237\3571\315\247\335\024=E\273kb\002\335\243m_\304G\274l\332"
+	.ascii	"6\353\240\023\300HF\003\244\264\273_\311I\270\307\355\"\334\243"
+	.ascii	"r\370\353\371\362/\364\b\027\302$Y\215\314\323\264`w\235\262"
+	.ascii	"\032\233[o{\200m\bv\272\002\037\017o\324\203~\217\247;\236\366"
+	.ascii	"\236\346\320\364I\323\235\246MOsO\307\247\267\247\365\351\324"
+	.ascii	"\364IR\247\204\022\b\027\017Q\354j\250\331X\026\361\204\007."
+	.ascii	"\037>\355\333~\371B\366l\207\024\2766\233-r\2140 \355n\201G7"
+	.ascii	"8\200\340\365\240\n\007\331\330\213\020\f~b\022dgb\001'2\315"
+	.ascii	"\327\361\213\211\3622\023q\217W!\233\001\213\312i\\\002oP\272"
+	.ascii	"i\324mIu\323\244\361\241\246=UQG\241\fp'F\273\t\030\037p\326"
+	.ascii	"\nj\265\0323\2730\001\251(\315!\220'\2265_S\017\"y\350\365\003"
+	.ascii	"(\\As\003\2265{&\223\272\301\376\266\232\343\221\373\374\"\377"
+	.ascii	"\371C\336\363\007++\026L*\256X0\251\r\006\305E\365`\205\345\300"
+	.ascii	"\305\202\312)\325\342r\255Z,\256\316)'**\326\347b\221\240jY\371"
+	.ascii	"\\T(\023\276\224\326\313w\002\300+V\252\365\271V\253\326\347"
+	.ascii	"\315\366\366\210\226\3004\346\016\365tD\017\336\304:4r(\247\236"
+	.ascii	"\036\3449)\207nG R\247&=\351\301\035\021\355\364!jR\357(L\242"
+	.ascii	"\271\301\251?\024$ `\002\021\204\306\003X\t\312\003b\330\024"
+	.ascii	"\303\242\\gJ\306\342\326$\227}\201\351\217\"\254\032\375q\\\313"
+	.ascii	"\203\244 h\224C\214\3445\366\371/\323qq#\204e\r\037\333\230\231"
+	.ascii	"\317` JG\360\326v\243\306\004\222\301\310Rn\331M\034\213\031"
+	.ascii	"\300iL\355\"\003"
+	.text
+	.section	.gnu.lto_pidSetItermReset.118.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\275\007"
+	.string	"2O77P\215\322\001\244$"
+	.string	"\243\\\376\217x`\r\362\005\351-\254\251"
+	.string	"\210\274\342\205\322~dO_\303e\3247\240G\233:3\323\252\234\303\323\301\351a"
+	.string	"\326\362\217M\266L)\033\215\263\220\351h\026k\262\315\346\231 \207\206\215\3030;[\346aj\272\317\3140s\036\255\233 \216\353&&\334_\033O\027\216\016\026)JX\243\375\371\207H\300dw\023|\217\207\020~\352\322\021!\375w\351\207"
+	.string	".\217\221\022Q\271 i\313\016G\0323\354_\033O\366\301_\257\001\024\205\351!$\273\025\255\225e\311\221\r\333\307\330V\265\017\020\274\203\"\354(+p\265\033\032\270 \340\322\236}\362Pc\261\022\213\t\220\224\335\235\021u\357\352\371W\375\362\225FW\213\302\356Z\277\222\351\216\267M`;\263\255\n\b"
+	.ascii	"3\241\203\037\2301\346B\327\360\365\020\\I\215\003wn\321\316"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.119.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\265\b"
+	.string	"\006\020<9@\217\322\001\230\016\303\323\373\177"
+	.string	"\235\331\\!\203\231\f\342*c\f\200\001\372U\277\321!\002\324`4w\"y,\032S\321\231\232F;B\272}\223\t\355\257\033\331{\357\224\002)"
+	.string	","
+	.string	"*"
+	.string	"2\273[;\027\300N\347\003\260S\031\362\356\261\363o\362\006Vk\305;\225\0365\f\273\353\350\235P\267\274\355\003\333\t\266a\002\037\352,\341nG8\2631\3645b\273\2639\361+\273x\263\373\321j\331]\217\021"
+	.string	"Nm\373$/\351l\327\004U\237\301\213\007\007+\026O\341\bT\273\253pr\224\013\377;5\006)\336;\365Ir\3632\305\320\006KQ\202\330\237+Sv\214\226_\375q\016\210\004\\\226\001\232\016}\0342Q\035IDd\023\020\265\"\003Q\324\320\306\325O\2015\321\303VG\232\266U\016\270\237+SRvLrC\343*vy\026\354\r"
+	.ascii	"2\241\303/p+\n\310D\361\022\237M0\310\013\3105\\\023\213\207"
+	.ascii	"\207 \242\302\r@\3451\265\223\f"
+	.text
+	.section	.gnu.lto_pidGetDT.120.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"r\31515Po\322\001 \233\236\205\202\306\342\343\006v`p0_\310;\313\271\252Y\321\254\257\307e\021\210g\200|Tf\216(at}si\244\251l\017jdo)S\n\336h\030,\316\353@<X\021\016o\302Z\220x\033\214\342i\n|q\032\260\327\271.\354a\342\276\255\216R3 \305\260]\361\022\243"
+	.string	"v\027\301'y\264\360Kw\276\360\344\263;\337S\335\245\006\214\2002e\307O\352\206\375\266:\262\237N% \231\210~R\331\325H\265l\212;\371\260\rm\214\017\362\020h\243Z\354(\031\240\2202L,\273\3732\037\250\356\332\005\252;\3458|B\377\"W0\235V\262\320\347yI\330]g\026\022\335\372\003\333\036\001\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto_pidGetPidFrequency.121.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\262\31514Po\322\001 \273D\220\202\252\311\241\035\036 \260\334\303\340\317R\275:\024\2676\331\324-\002\361\f\220\217\312\314\021%\214\256o.\2154\225\355\021#{o\231R\335h\032*N\354D@T\022\017\221\242b\230\210\233\253\"j\fjq\034\256\330\261\254+b\264\373\335\215\322e@.\243\255\205Q\272\005\374O\250O\254]\324$\303bx\322\231a\355\241\f\323\t\230\200\362\324j\237t\034\255\337\377\327\215Zg\323\025\200\264\210l\332\376\215\323\313Y`JH[\254\305\324#&\301\332\355i\036\244\203\025\021\215\222\313\377\2301\001e\370<@\031\272\016cN\254v\211\027J&\225,\364q\002(\374of!\221\353\214\320\366#\b"
+	.ascii	"2\241]\037\370\354\020\240]\346\305\fC\334\025i6\274\353\336"
+	.text
+	.section	.gnu.lto__reset_template_128.6.123.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\365\001U\020"
+	.string	"\346\335hF\300XM\032\003\030\220\256\335\277\357{\246\374\336\367\301@\253CM\237\372\b\276Qw\364+\210\346B\260L\0016\027\302\305\032:\236\2662,S\020M\205`\231\202h\n\002\ta\026\310l\322%(\367\235\204\251\021I;`"
+	.string	"Y"
+	.string	"Q"
+	.string	"<wY\r\305\332K\204\"\bS[l\254\271<\230\235\223\206\266\032d\r\342l \344y\256\236\254c/`0\220\201\203F\205\273\030RX\243\240\311\036\223\231=\0017=\366v\006\300\366<\325\235\316+\006\327yw\016\n\034P\335-\307yw;A\020"
+	.ascii	" \220\324E\356\3339\252\273\030 F\316\026+e\331N\271\266T&Z\271"
+	.ascii	"\334\236\213\266uha\243\013\037a\270\226\341\231\206\303\r\207"
+	.ascii	"\034\316\322a$\017\317\017O\020\323B\234$\342o\3045\022\033\225"
+	.ascii	"X\311\304\363\304R(\016S\034\252Xh\305`X\264H0&\336\366\264\274"
+	.ascii	"4\323M;};j\302_$\270\320\211\375\024\252f\251l~\351\324A\332"
+	.ascii	"f,;\343\2715\206\255\215\347\336\370\333\034\307V\307sw\374Z"
+	.ascii	"\036\317\365\261l\177,\264@\236+\344\241\035\362k\211\354\263"
+	.ascii	"E\236k\344\331\036\231\266H\236\233\344\327*\371\333%\273\226"
+	.ascii	"\311\337:y\356\223]\013\345\326Fy\006\261\301\202\233\030\271"
+	.ascii	"\270\324\237\245\202\177\n\264\324\240\245\302\226*[\352\320"
+	.ascii	"RiK%Zjx\217\036=\025\351\251J\267ti\037m\332\245\266\253\250"
+	.ascii	"\323?\372\364T\250\247FmE\245\0065\314\240\212\031T2O-\363\025"
+	.ascii	"=\363T4\003\0051 \220\"\272\364b\202l\025Q\260\006/\033\366."
+	.ascii	"~)\f2\222{O\325`\200\303<l\341f|a\372\270\223 \331\003\260\230"
+	.ascii	"^\2154\203\363=\207-\274LeY7\016\r\3732\256\264\262\221!\240"
+	.ascii	"zw6\266\215\335v<\247\021\365Y\355\356\235\327\221\325D,\307"
+	.ascii	"e\300\210wj,\020\201\335+F\031n\021"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.178.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\371\003e\027"
+	.string	"6h\213J\320\362&\035Rq$\241_\334m`T\314\276BV\321\032\367l\277=z\204u\263\215\210C\r\027\005\035>\375jm\337\326s\323>\3263\265\215\301\003\364\3051L^\341\017#|\017%\332\006\034i\271\323\032!\204l\"wJ\001q"
+	.string	"n"
+	.string	"v"
+	.string	"\017\222]\205w\036kMb\202QkMp\352\003\342\351\311G\300\323\357\003\300S\373'l\327\350XfC\035\347S\317\302\007N\216Wk%O\267\347\262\213!H\277\235\243\314\027\372X\332f\027\303\225\020\031:<\344p\020\2476\351,m;\377T\266\235o"
+	.ascii	"\333\315wRk}\321g\216\315fN\001\037\303\225Z\253O\363p\253n\273"
+	.ascii	"\264\315\300\376\n\004\376\fH\301\302|9\367E?\220\006 M\027v"
+	.ascii	"6\367\346\035\377\325\345\261jN\217sZ\234\323\341\234\006\347"
+	.ascii	"4\235\323\337\234\336\353\356y\334\177\222\021\003(j\305\320"
+	.ascii	"\023RA\320#\240\353~\373>\321\207\374\"\257l_\227\243\361\311"
+	.ascii	"M\216F\234\351\220\344\214\340\375\250\265\"8\265\002Q\350\276"
+	.ascii	"P\215\275Zy\316\343j>\\\375\321\361\234\366S\004K\221j%\354\326"
+	.ascii	"ix'&}K\245\210\246\202\300\375\232\374\210\030\252\261\377\350"
+	.ascii	"\336P\220d\254x\206\360x\264oo\266w\355\326\217\274#\260#\006"
+	.ascii	"E*\243h\263\347\357\356\217vL5\0226\263\347\375\254\265\316v"
+	.ascii	"o\336\335_\2554\224\257I\217\323\220\322\315\fb\221\371\375\212"
+	.ascii	"\277p\221>\265\322^\332\022n\004s#\237Z\353\202\026w\361\362"
+	.ascii	"\177N=af\276<\r-2\016\036\320\304\\\025X\260\006\256X\f\213\244"
+	.ascii	"\365\022\213\275`.1\321,*\020\\2d\314%\202\353\245\205\214q\261"
+	.ascii	"`H\026\330\f\251R\342\227L\013F\306^/\030\271\272/\3160\321D"
+	.ascii	"[\033Q\005\365$2G'W\n\353=`\236\343\241\332\224\r\037\306\315"
+	.ascii	"\201C\252\214\0227\334qK\236nx'\332\020\027\300M7\025\024\256"
+	.ascii	"\315\362&\357F\230\226\312(p\303\245O5\036m\366\300=/IGH\227"
+	.ascii	"\224\376-\r[\250\261P\"\211!\2510\312HR\220t\220\002\021*\263"
+	.ascii	"\016\021\220\275B7\322BMk{\246\346\272\n\275\304\202\343JVI\251"
+	.ascii	"\030\240\200\273{\375\271$\024\260:\262(\302\246\212\236\201"
+	.ascii	"r h}\r;\207\211\364\334'\020K\203a\336.\373\372_BX3\343\036u"
+	.ascii	"5n\321v\304>\256xL\360\246\\\205w\032\302\225\020\210b\022\025"
+	.ascii	"\327\304\b\363p\240\334\246\317\2557\321mf\001\352\024\327\305"
+	.ascii	"\007X\376\351o5\271\0328\350\244Oi\263,;\273\312\026\346\353"
+	.ascii	"\316\\`\255\212\370\352\220\3225\021xWk\210\t5\247\245\006\005"
+	.ascii	"\227\206\3171w)>\347\203\330\013?`\336\3213\346\245\001"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.part.0.179.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\250\001]\017"
+	.string	"V\335cD\020\221\223\016H3\242H\221\270':\3567>\265y#1%\257\260\303\361\206\007\2224\366-\335\2279bk}\307\327Cb\215\332\273\252RL"
+	.string	"\212"
+	.string	"\240P\210xd`\247\220\004\305\213b\315\266%{K\231RO"
+	.string	"M"
+	.string	"Q"
+	.string	"\236]\0302\\\354.\202C\033\210\207\366O\254\240l\373%nbd\277\236\312C\3526R\025X9v7;\004\271\007v\370."
+	.string	";\324\016\037]\363\215\374\257\376hpf\234^H\327\317\013\206g\200\277\216\310\356:f\270\341m/\260-bg\201\356d\032\3134\314\364\313\264\276u\347U\377?\036\031\207\335\0139;6\006\276\b\361\326o\337W\361\024\276\313\240\026K\305 -,\225HB\rp\001Ascw\017\034:A\374\352\376j\305\006\331#\033\344\314\253^\263)\2243_\343\227\0036&\230\247\252P?X\246\021\237|\366\311\206\375\364\024\323\020CAI\266#\274\205_qw\025\370+\316B\344\247\016-!%\177:\364S\324S#\206\016\024\245\314\361\325\257;[vK\004R\357\372\273\301q\231D\260dN\352\214\365\275U\031;^\365$\232\210\323&h\f"
+	.ascii	"h&]\267q%]\364H\bI\b%\353J\036\204L\034d\020B\rN\262\021N\224"
+	.ascii	"\205|xC\321\270\254\3336.\003\375\255\312\370\256{>\220\200\311"
+	.ascii	"\216Fu\261\035\365\253\337\302\006\0344J\312b\375S\235\261\215"
+	.ascii	"\351\265\243ic\272\201\212\251\006% P\002Q\316\025=g\250\270"
+	.ascii	"\312pd\221 \n\030\025\330E\304\243\031\001\272b%\223m\276\223"
+	.ascii	"\311UP\326\313{K\036F8\207\225d\3441\006\250Z\226!\037\303\314"
+	.ascii	"i\301\337@\353\017\374j\207\242\372A\353\016v\022\203\rC\214"
+	.ascii	"\0346\301\372\235vASI\335\351\327\3161"
+	.text
+	.section	.gnu.lto_applyRcSmoothingFeedforwardFilter.part.0.185.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\317\002\355\025"
+	.string	"\226h\214I\240VN:\304\033x\002K\3153\2577\320\336\036\245t\210\023\366Jb\2529\020s\272\260\360\242Kh\302\276<\236\217\232\252\336%j\371$\275\215/\247Wy\013\351\217\221\260\350\267y\212+\310\364g\243\225\265\204l\"wJ\001u"
+	.string	"q"
+	.string	"z"
+	.string	" \324\362\212,\345eX\313\260\335\022\\7v\027\301\247[^\237\366a\364\024\331\366]\374\205\217\355\003\241\232z\004\236R\fM)\331]\332\347\354+\341'\370"
+	.ascii	"\341\247\236\270\317\303\t\252\024}\374[\035BP\3177\362~\036"
+	.ascii	"\312\221g\364)$\301\243+h@iKD\n/\b\\\001b\302\310\255.\211x;"
+	.ascii	")\001\\\024av\327/\244\373u\333<\266al\225\0058\371\361\323\307"
+	.ascii	"\205\237R\305 (\204\214G@\362'\225\311*\352\357\367\373Y\227"
+	.ascii	"\354\230(\215\022J\303T\3725\245E)\035N\351\371\252\033\274\324"
+	.ascii	"\257\240\264<\324\177\231LJ\260\265\013\342\347dI\314,\247W\335"
+	.ascii	"~U\217o\345\030U\217g;\037\237\312\261)\373\276!Vv\031yr:\262"
+	.ascii	"\273\007>\355\300*/\025\265=\215\262o\307\022\027)\017\325\023"
+	.ascii	"\240\276t\300\225\207\025A\f\220\232|\230-\247\tE=\013?\307\265"
+	.ascii	"h\374\236+\314\310\2173\341\247\250/J\372\321b\204\376*F\245"
+	.ascii	".P\231\016\356\356\25229\324kN\212\310N2\361\324P?\364\304\266"
+	.ascii	"\360,\232\027\216\251\035\222|,\211!\223\252R\355Z\215\374\b"
+	.ascii	"\352LH\177\354ciP\0312\332\346\360+[\203\246\335]ps\0337\227"
+	.ascii	"!\273\253\200\306kd\360{\237\316\t:[Nk:\034\333\003\235\316\r"
+	.ascii	"\267\243\263\311\330\334vd<\267\r5\3205/6\267\035\232\016\303"
+	.ascii	"\315\r\347\002M\347V\313\241\325\344xh/,\306\355\330r4\035\016"
+	.ascii	"\227\243\305l\313\203\253KV\241\322\201\245\240\306\224\310v"
+	.ascii	"L\337U\304\250\013H\203B\024\345q\256\b\237\341\367\370\226\204"
+	.ascii	"\t11\267V\370\371\021\tLQ\224%\311\320\023\001\362\245\266\f"
+	.ascii	"\205\360#Lg;\375\261}\267r\312n\027\250@< p\002\031\302\243\007"
+	.ascii	"f1\f\251\221(\3640\371Zq\241\225aD2\0371yXD#\023T[\241ZK\250"
+	.ascii	"\320\320\231k8\225\365\240U\321\341$\220\037\"\260c\267F\020"
+	.ascii	"\334\0161\222\312c1W\021m\221\314\365\366\024\220\271\356\016"
+	.ascii	"\316B\265X\375\272\204\241\303\231\302\226#@\243\314\027\304"
+	.ascii	"C\254\376\352~2\203mc\bk0`\304\366\221wLm\217\267N\314\304h\202"
+	.ascii	"\367k\335\005\255\"5\fe\220F\313s\274\026\343\001"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.part.0.187.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`-\004\375\032"
+	.string	"\326\357\246G\260\032Q:`\233\036\003'\211\217\024;\347+\330mz/\233f\353\270\255\025\035\255\032z\223\201\224\2176\371!q!\373\037V\200\243\205\007y\270;\201}\n\357\235\340\2235\370\221\324\346T\343v\2144\022K6\221R\246\216"
+	.string	"\211"
+	.string	"\225"
+	.ascii	"\364?\363\352\204@]\305\2518"
+	.string	"\363\277E67\264F~~\254U\212\321Q\255\025\302\3223\020\227\342\254M\270\024\334\002\341\322\177\207\374\027R\361\241?\314\352\212\352\r\220/&z\276Z\253ji\347\330\241\025O!\005\233\307\241o\211\025\023\330X\361bO\250\232\213\rA\0073\320\306\310\004S\246\325Z,\210Sk%k2n\320\200\f$\026\001jD`\216\322\r0\333[>Q\2131\023\330\361T\241\326\3725a\354Q\373\037\305\177\r?H!\377\2714\016\312j5\027lsoo-d1\242d\326#\306?\356\333{\\\2606\216\247\230O2\037\305\374\221\371\"\363O\314\017\231OA\3467\257nw\013\260M\001R\255)~i*\r\352d\307\362v\311\177\342\310tE\270\335\345\216\210\370\252\254>\bz\021n\003n\312\032\337\322\257\2225\372\311\007m\222o\020\033\317\027\264_$B\337\336\311\377\313\023:\216l\367s\353\212\312W\300"
+	.ascii	"\361\211\251\265>X\372\b\342Rr\003\274\246\234I\373\326V~2H*"
+	.ascii	"m\252,\221\030\277&\333\272 J\301\003\354\333OM;\245c\207\264"
+	.ascii	"}\352\03333\237\311\277\367\262\016\232\f\245\356\333\177.\b"
+	.ascii	"\273\303\316\212\214\317\234\366v\330\254f\326\343_-\225\237"
+	.ascii	"S\312\034)\2647)\306OH\316\004\243\260\230g\241\224\b\236\274"
+	.ascii	"\001SS77\330\253f\306#\306\277\336$\333\204u`\251Vsi?\210=*'"
+	.ascii	",\325Z%0\331\263\365\305-\275\210\027/m\351\367\025\216 \301"
+	.ascii	"K\353\356%&2W\210\272D\367\321y\371\300vJ\325O\253,[+\003=@\027"
+	.ascii	"Z#\214\347\325\323\223\001\366\303\343r\215X\001\370J\307\003"
+	.ascii	"\013H\005\363\371\300\n\321\243\372a\355\224\252\225\353\245"
+	.ascii	"\322\271y\013\210\307\245\202\265Z.\025\271\215\343\025\314\216"
+	.ascii	"\211};\207YHb b2\203\211\216\235\352\023\177\352\313\317\034"
+	.ascii	"/\245\200\245\336\322\0376\336\256\313\2221\247\276\211M\366"
+	.ascii	"yV&\306M\314(\325\bQF;\340\210\217\034h\262$\311\370\f\227\237"
+	.ascii	":E[\312\345iA\365\2303\371w\261\307\336\331\030sg\261\374\024"
+	.ascii	"\225\304\336 \266]\250\2418\"\025BFH\002\021\021\321\304\031"
+	.ascii	"\003\240\002\221\2522\017\020p8\2324\303\001\364\260\224\274"
+	.ascii	"\242\242@\262\221\326\"r\016\200V\224\337\032\201o\226\005\034"
+	.ascii	"\260\026\f\0135\206\301\302\036:\"\021\303RU\340T\310\223\255"
+	.ascii	"J\022c\314$+\245b\3117\345\267F\217\212P\360\244\234q\336\004"
+	.ascii	"\222MEJ\006\320\033\340\201\226\200\352j`\f\004\2226b:\250\311"
+	.ascii	"\316\022\263\021\222\023!n0\263H$\224\255\215B\017\202 \332\205"
+	.ascii	"\035\334\234\317\264$\246G*\222Q\3602s\340\250\314\347[\205\030"
+	.ascii	"\020]\356@\204\237J+*3\3044\031\345\322\204\362\243\234\376\003"
+	.ascii	"\370\252\251\375{\377\377\300u\211?\253\346\017"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.192.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`o\001]\016"
+	.string	"6\231\\F"
+	.string	"\261&\0358\237\027\204\203C\256\256\215\005\200\262\031\033\032\026\354\007\332\233r\re\360\311\033\021\005\027\fG\215\264\024\005!u\204\"\350N\327Y\272\253\252B,vbi\375\034\323\372\377\356\367\"X#d\023\271S\nG"
+	.string	"E"
+	.string	"F"
+	.string	"\246q0fC-*L\020\321\332\335y\251\032\356]^\0321\317\317F\253\024(\227q\345\273\360+\033\205\007\255H\3110\361Y\270\006\370T.\002\273{\360\221\302\227\212q\300\261l\264\273\376`\270\263\333\026\261=\355\347\004q%r\331e\351\271\261\031\244\n\016\266\357\327<<=\204\027\254n:\354\356\351>\210\2625\315\032Oc\217\017\324Y\335\301ei\261F\333\343\303;\253\013\235\307f\306\305.\310qi\321\347\322\376\007\333\250\026{\016fQ fw\025<\364\310m6\001;\273\233`\304IH\360e.mr\022\277r\351\237`\227\017\037_\310\264^fxRb\217\365qwQTU~\207]\265F\007D8C%\332\210\252\262b\327*\214}\232\377Y$\016\204cp\"\221|\034\322!R*\231\334\003\007\245\b\r&I\tdd\206\230LfG\310[\t\3114\271m3M\315v\374\265\nc"
+	.ascii	"\033<\300H\321\224T\225\332\020\236\323\201p\016\336@\f\235\235"
+	.ascii	"\027\226\313\305q\0247'\264\0328\255\003G\360\022\001% p\202"
+	.ascii	"\231;\272\001\370\031\230\002\377\320\220>x\321\005[7B\342\005"
+	.ascii	" \231\2338\004\262\3618\036\354_f%\202!\021\003\214\261\037\271"
+	.ascii	"jDa\230\277\026\352\215\210m.\233\030\t[9\326n\200\270%\226\224"
+	.ascii	"5\003\244\3664\216\201\327\360#g\232\017m=\341\215\001"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.194.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`g\016\325;"
+	.ascii	"jg\034\026=@\250M:\370\260>\261\223\356bJ\225x\364J\250\205J"
+	.ascii	"\357(\021\021\032\310\300-f\261+\254\334\340\352\001_T\216\032"
+	.ascii	"R\260\007{PB\327}\"bdTGm\254\031\331F\210\224I\006Q\0013\001"
+	.ascii	"N\001\377sAcpx\303@+\201\002\331\001\205\245u\f\320N\002\205"
+	.ascii	"\037\007\024\346\242J\035\2713\341\247O\237\036w\253F#f@\244"
+	.ascii	"L\262\357\351\221V>)[\335\362\227\347z~|O\017a\375Y\226AJ\276"
+	.ascii	"Z\3454\244G\215\374:\227\263\277\263\303\333!\333-4\272e\336"
+	.ascii	"}\252\263S!\215\363c?\367\343s\202\274*\251\254(\313\240\"|\265"
+	.ascii	"\326\343\321\215\220\036E\367q\310v\207\303e\276\034\331)W\277"
+	.ascii	"\250-\363\356\335|\211\374\233en\260V\273%\237Z\253\327\321]"
+	.ascii	"\220\036\335\372\325\357\350\371\252\337\321\335\263\331]2\265"
+	.ascii	"]\344\356\336\345\270\324\254\272e\332\034\247Z\353\327\321\336"
+	.ascii	"2%E\334\376)\367\035\242\310SM\031\245\212\304\250\2410\230\002"
+	.ascii	"\177\350\331\\\205\334\0033\304yP\271Vv\252<.<\325\345F\274"
+	.string	"6\226\252\362\242\242)L\344\322\242\204\312\243N\343\"5/g\204C\347*\243\026\205\207\327\242D\312\205R\036\244\362\264\312\201\334\345\277\244p-\215\r\312/\312Q\\\224_Q\363\202\242\254\\k\362S\270\326\344}^%\t\243,\256\241\235\016\370\372h\372\235s\221\2653f\252W\0013\324Z\367fp_\253\357\036\313\356\262\330%\246\bi\241vQ\374R\017K\335\027\224\267|s\027\347\332$J\013\305uB\222h\351~\333\207\375\336br\364\320\270\323\356\2528\245\260\264\326Za?\351{+\366_\216n\213\027|\345\213\337\321\367\357\374D\004\207\247fi\306M\356\267\355\252n6\233\225\266\263\354~\025y!\034\322\327\213y\0370\357\321\001\221\267\301\033}\0310\357\002\346U\220 \212\027\301\357\276]C\336\003\\B\336\255\033\372\032`\336\002Z\314K \345\035p;_\001\314\033\200y\263~\274XA^"
+	.ascii	"\314{\305\274VA\336*\346\245b\336)\34652\257\324\217\267\310"
+	.ascii	"\274D\346\215b\336!\363\n/\367\007_\367M\231\027\370\343\375"
+	.ascii	"\005y\321\037\357\031\344\355"
+	.string	"\037/\247\274\317\300p\030>\325\232\244\371\251\272\241~\304\334\316o\350\277\373\033\375\220\376@\277\237\237\371H\273\314\264L\315\312\tZ=\3562\257f\345d\312 %\337\321\327]\270\373\375\243<H}\214\360\032IJ\244\350\356\254t\034\352\022\215!th\207\206\326\nm\240\023ISG(E\235\335!\235\327\355\355v8G\366\343x\366|\002e\273\013\202\245,3\n\201\376\241\237~\340&\365-\343\240\344y$T\006\221\244\375\266?\260\337\366\233\241\214Am\177\035\305A\321\363\353\267\025\366\t:\005\264\226\262o\331T\255\325E\366\3112\333\356\035?\261\235N\226,3\331\275c&\273V\222dYm\367\216\224\330\030I\221e#\273w\224dWk\331\333~\255\237\222\225\265\001\017\331\335\275\277m\227\323R\271\332`\202[\222C\355\256\b\026\022\2066\240}\300IB\003\264U\013\350'5\235\365U\007\300\352,"
+	.string	"\215\325O\013\205\202\315\270\f@\177\256\3132\213\203\275K\242\004_y\325_sC\353\262\255j\253\356@I\276P\240\252:\360\3019\352[\236K'><\347T\033\233\252\237l;\233jT\252\211m\354'\313\024[\252O\274$\337\257\317.\366\020\217nSr\f\261\367\235\356i\231\373/kb\367\354\236CJKf\334\334\250\0166\261QP\311\266a\247\035\325'(a\007{\330\234)Y&\330\313<\013\273\210GG)9\346\214\233y\034\305\271\325\272\030\232\315Nh\265\232u\001;m\326\223,s\306\315\345\006\366\355>b\216.Q\222\017\355\337\211k\312\2046\206\274e\237\335\201\002<l"
+	.ascii	"yq\236@^\350\260!b\306\216\020:\202\304\b\206\311\020\3530c\006"
+	.ascii	"\330X\017\030\302\031`;\200\310@e\340\030\033\003\023\2531\226"
+	.ascii	".\f\b1l\354\370\032\253A\303\006\216\031_:l\274\310\361\005C"
+	.ascii	"\214\307\027\204\254\005\333!C\354k\f\fL\354k\370\263\356ODL"
+	.ascii	"\363\316\254\317\226\323\376;?\253\361\253Q\275\337\361^^\375"
+	.ascii	"<<S^\375\325Xso\230\027\370ACH\202\\\243\203\261\204\353 \233"
+	.ascii	"da:ss \034\237<\200#w\354\347\201Rc,:hT\017x<\003\006}\274\245"
+	.ascii	"\024\203v\320Xs\313G\023xA7\220\202\244\"\204\215\214*\274\006"
+	.ascii	"i%\f\253I\203\246\201\202\326\302\262\300\3142\3238\005}<M}\313"
+	.ascii	"bT\202F\365\322\343\273\272\372\212\310\020\273:A\323\213\017"
+	.ascii	"\264V#\330\202\354\222\fC\003\216\301 \301 \323\360\0278/\b\226"
+	.ascii	"\2670\027\244\030$\031d\0342\356w\364@_\021&5lQ\375\266C=!W\243"
+	.ascii	"z\301\343\rt\021\257\033\020\236\341\267\206\222\307\221\231"
+	.ascii	"\341\203\033h\256\306\232sS\227lK\300\005z\253w\221h\220j\370"
+	.ascii	"\312\345+7\254\256\334E\262a+H7\247Sa3\260\033\362\r\006H\265"
+	.ascii	"V\013\032\270\312\006\n\\\216\266m\365\225N\314\270\271ZL"
+	.string	"\240\265z\327\303\007\276\262@o\t\351\201\017\250aD\005\2252B#2\242 \005I\222\016\361\005\3040\346\310\350\001\022\240%9\210*\207\224J%\005%%\365Jc\250!I\n\324\352Y\n\374J\217\212\313$\013\004\266\017\301.f\324\260\367v\033?\027^p\343pj01\214F\203\202\303\330\346Uyq\266q#O\274\255\t\336N\2468\277\036\3720\303\215L\033\267\2149\254\321\201\330\263\247\225\245\246\226mc\357\\\b\271^R\270\200\035\340\023cM\241A\362\023\376,\023(\312\364\022\241\203\276\217\017\307\202\276\003\231ek%\021\222\273>\216q3\232V\371\244\025\300d\317\032\353\306\344\201\2202\376#\034\267\335e\345\277\317/]}KX\314:)8\241L\332\233\b5\367^n\335{\331\326u\320c\216\277v;\\Tb\224`\214f\212\037\333\005bbR\001\177\225\314\356\246jA\233Ia[\360"
+	.ascii	"B\270#\013\264lXv\037Z\310\021{\2352\370\3026]\305=|\355\002"
+	.ascii	"\344\373|\226\017\357\272\310P/A'\022(\341\314\203\241\340\025"
+	.ascii	"\005\003\325\032\321\2161\360Q9\211\3137%;e\212\353\026i\234"
+	.ascii	"\256\3101X\220\312\345AS\206\364\276\237_\017R\317\275|\2628"
+	.ascii	"7\360|w\"J\020\036&\255\346\006\251\326V\254%\f\217\254%\f;b"
+	.ascii	"\032\302\2007\250\256\374\232w\343\030\235\2309\377Q|\350G\333"
+	.ascii	"\017hP\215\353\006\202\370:\306_\274\236\337\270B\247\001\020"
+	.ascii	"\376\027_1\254\353\354\265\313\355\303\276l\\\277}v\253\016\301"
+	.ascii	"\254\004\262\200\025\242L\206[:\254\374\333G\305\006y\220\322"
+	.ascii	"\314\211g\226.C|x\213\261\\V6\321\201;Z\306\240\026\013\340\244"
+	.ascii	"\207}eui\344\341\212iF\252 &B\"X\236eF\375!\330\213W\f\254\246"
+	.ascii	"\243q\204\232k\340\017\354\211\365j?"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`q\fm*"
+	.string	"\032I\374\01780\350\312p\201\\"
+	.string	"p$\357\353J\2313.\204\314\306\275\312\032\213\355\004K\244\271v\266\304&6\244\302j\236\347g\357\353\352\356]\330\347$\032\206}\326C\277\b\222;\311\355"
+	.string	"\350"
+	.string	"\371"
+	.ascii	"\230\230\364^Z\322k\tUr/F\013WK\3625$7;r-F\236\305\270\317\347"
+	.ascii	"3S\221\336JDz'}\365J\032\322\013IH\257\323\253WQ\220\336D]\275"
+	.ascii	"\210\200\364\n\376\350\r\274\217^\300\036\275\207x\364\376\355"
+	.ascii	"\350\365\323\321k(Go!\034\275|7z\367P\025\312F\257^\215\0174"
+	.ascii	"Ng\2744\243\177'\243o\027\243\217\007F\377\316\213\276\034-5"
+	.ascii	"\231\\]\364\343\264\370\030#\213^\302\025\275\221<\251\3505L"
+	.ascii	"\321\333DQ\364R:\321;\210\232\350e\204\226\330NF(\022\275\213"
+	.ascii	"P\256\217\2158\233\226\210\223\361\363\371|\206\350-D\265v\021"
+	.ascii	"M\332\325\201\350%\204~X;#\253\f\366\316\303\267hu\330\247qw"
+	.ascii	"\277\216EX>\3065,\3145\034z\037\001P\223I\365\316n\3572\323~"
+	.ascii	"UU\325\r\275\216\320\335\215J\022j\024-\021\2322\300\2373\300"
+	.ascii	"]\r\242\246\230\353P\252^\024\033Y\2078\203\254\227*\374D\270"
+	.ascii	"\314\001\374\365\254\252\352\330\016\n\300Rw_\2733\201\346\227"
+	.ascii	"\t\250S\243=\233\351c\221\353\257q"
+	.string	"}.p\375\2632}42\375\2641\375/b\372h\336\372\3120\3753n\375\271\266\276\031\266\276\334Z?N\255\017\007\246\237\374\322\373)\255\017\006\255O\306K\277\314Y\277K\227\376\033\227^Of}1[\372ee\3750Z\372nY\372md}\365\252\252\356f}\355U<\026\017\311\3553\266\313\253\373\247\327\317\225\3053\356\002\t\003\342\025&\304\211\225\rTe\005Q\331<\343\256\024\2600'E\276\204\200\371\370b\262\265_\311\246,\323(e\373\214Qz\023\241\364r\022\353\335\364\244WSX/b\242\223\336L`\275\207Mz\003\n\266\370\316\255\273\221\241\301\331\300\n\334u4\001\005\356\272\2220(\213\013,\363\026\021\222\217k\"$\037\227\212\220|\245\\\204d,'#$/P\016\"\231\201\263\211\344,\345Q9o\202\034-!\222\271\276b1\227\240\002\006\240\374\006\267\305\263e*`\257\300\004\374"
+	.string	"J\355\273\342\243\363P{rtR\313?+\007t\306\366\220\025\027X\217*J\316Y?+\006\260|\2066Nc\313g\305W\036\355\323cG\315\002Z1\326\335\321c\025_9\021,\217\312k\2619\004\\f\025O9\237U\366L\\CU\354u\336\276*\376R~\r%\245\251\005Y\036Kp%\353Z\217\201N\331\226e\036\371\270\276m\241#\337y\264.\3560\314\366\035\031k\375\3669\023\251\317q\375\332\361Q1\201\365\036\360\366`\332=*\226R^@\236\2743K\350"
+	.ascii	"\212\250\366\027\270z\007x*\371\007\333\365?\237OOH\016\374\344"
+	.ascii	"\321=\304A\271\005\032\370u\330\276~\312\272\265\024\n\f\021"
+	.ascii	"\214m\311\234\243\317\347\323\231B\361\234\363\023\340\020\255"
+	.ascii	"-`\312h%\347\267\220\f^\035<w[\316o\240ALv\353L\031\255[\377"
+	.ascii	"&\240\277\263-L\031e\263\274q\2718(\315\372(J\204\207\350\334"
+	.ascii	"z\224\316\354l\321\251\270jZ\336\310\250-\323\341\032\311\371"
+	.ascii	"\255OK6\333(\345\0336\017\001N\242\234U\312o.\327Q\312\177\323"
+	.ascii	"\374\0077fqU)\277M\323\214\252\371\367\215\301-:\220\362\351"
+	.ascii	"\222?\n\216\345\rH\271\357~\264\262Jr\f\244,\266\364KYL\271\217"
+	.ascii	"R\026Kjz\312J\326S\021\316u2\262\374\005U\314"
+	.string	"\3332\323.fz\313\227\362\002\347)\334\001\352C\260\236\200\245=\304e\246|'\244\224\277\\\303\224\273~E3O<\254\013\034 \031\200\272\250Q\020\206\251\222\214\210\210H\222\202\246\003\340\002\251\241q\016\021\340\230\222F\031\221\210\210H (\322\003P\303\025}\200\220\\a\001F\275\016\300[n\273N\215\336\271\003S\326=p\037t\001\361\022\336\007?E\036\031`B\357\222\203?#\211\366\030\234\372\356\032A\202\342\260\374\337\275\231z-\025jd<\032\217\204\211\317\213o%f^\306\374\301!\267\026\373\233\330\260\372P\247\321\207G\2628\313\224\002\271\323\375=]\214\326.Z\220*\317\211\332\274\214\214(.e6\303\342?,\3534\301\340\034\311\360\004\347\220\214'p\216dx\202sH\306\023d\300\300\254ez_\251c\021\310\020\036E^U\213.d'\211\210\005\250\263kc\253<\007\3138\212\241f\322"
+	.string	"\377\354%\013p\253\352I\212\260:\r\204\n!i\307\312\2167op\274z\307\fE>AW\364\250\nO\267\013\034\355r&\272n\217\271\224"
+	.ascii	"J\257\007\254kOzO\023\312\303\333\016!7\334\"\267\217\305\340"
+	.ascii	"\002\033\3310^|\3243\314;\357\3640\336\356'\314\230\243x\357"
+	.ascii	"\025\3453\312\262\203\206Cl\257\264I8AN\b\216R\313^\211Y{\r\224"
+	.ascii	"\013\365\017"
+	.text
+	.section	.gnu.lto_.refs.5fa3d52826d3641,"e",@progbits
+	.string	"(\265/\375`\370\004\025\032"
+	.string	"\306\360\216B\300\330\311r\300\363l\362u\226\225\003\244\347\344\230\316\004p\340\260\275\352\r\302\361L'\302u\025EQ\024EQ\024EQ\0341\rR\375-\356P\211\253<p\325_\177\213\234\304\267\033b\t\331do)Sj"
+	.string	"p"
+	.string	"|"
+	.ascii	"\335\033\375x<g\366/}\25733\303\314^\326\257N\377F\366\264\331"
+	.ascii	"2\335E\375\241\276O\337\326\257u\366\336lZ\354.f\030\276\020"
+	.ascii	"\256-\255\217O\203\373\001\375,\217O\365\223\372D\335\007\365"
+	.ascii	"{\372;\3458"
+	.string	"}\233>My\255\037\233\375b\273\213\025\306y<^\343\275\355\325k\334\323\372/\335\303\372/\356\271>;e\377\272\022\013}L\017\367xh\\y\313\035\356\332\254\374\325\357Z\035\330\263\217{\\s:\034.\323N+\207\341/eyW\316\366F\366R\271\022?\342)\337)g\372\331|e\327\310\354\364q\245\217\027}\\\210\203\225\006\366?x\274\376-\356\327Q\343\343Y\334\337\372M}\246\027?\352\033\275\236\b\347\3259\3166\3635Zn5{\252\376m\366\002\272G\n\036g\210\016\032\274g\006\013\335S\302\003\251\316\005\n\272H\365\261D\361\253D\375S\230,Q\222\244\253}$G\212\f\001\342\003\252P\335W\275\352\343Q\375'\356T\316T\"}|\210{\240'\216s\3436Oo\273}\355\306cdN\234\320D&.\373x\307\275\324)1\211H=\342\266\230\215z_\234\036\213J4\024\200BA\274"
+	.string	":K \316X\1778V\273U\037\252UjO\362i\257\325\267\272\216\"\340`\035G\277\321\003\234\201\002\0048\200\307z\230\205\305+ZqUT\234\263\360\342\\\005\n}.\002\204\007\016\032x\234K\240%\213\307k\245\n\025)Q\2368i\302\244\013\211\021\"A~\370\340\352\261C\313\373\316\210\001\343\205\213\026,V\2508!B\366\r\001\242\274\037<L\361v\340\260!\003\206\013\025(|\274\021\270\257\003\217\227\201\002.[\262\\\261Be\312\307\t\205{6Q\322e\244\310\020\256\333sG\216\251\347\r\0333d\254P\221\002\205\211\022\355$1\"\200\251\250ahf\fA\"#\243\240 I\322\030\260\242*\032\362\020\270&i\f1\226\236[\020\216*\263\301\302N\342Vk\341\242\316 \205Wx\211C\370"
+	.string	"18Fqd!f\306\341\\\270\r\033\306\367\022\372\235}\333w1\376*\201b\241\360\03408\244\366qA\017H\204a\207\257UE\346\006\035\364\"Z\2035\024K\006=\002m\311>\313\332P\251\273a!\210p B"
+	.string	"\223=\201^\312\320\017\323Oln\262|\314FM\002\312Df[\020\021C\306\257\005Qi\002\342G\266\030\034K,\266\357K4n\304]\216\026mV\202\224\234~\fH8\r\353\202\270\236' \224zN\344`\300\252v\351\313v\3416\235\265V>R\333Hf\347XA\tCL\204\004\240\266\372\377\331m`\220\262\216\225'\360,\214s\344-\322\236\236\3151\005\343\301\226\314\025\305\332\235 \245\037\200\253Z\r"
+	.ascii	"\356b\320\312laU"
+	.text
+	.section	.gnu.lto_.decls.5fa3d52826d3641,"e",@progbits
+	.ascii	"(\265/\375`r\274=\356\002\336\250\204w\020V JY:\215\001\325\247"
+	.ascii	"\3764\343\2037-z9U6\354\030Vf\217z\021\212S~\240l\331\352\356"
+	.ascii	"\227\342\2429\323\021\274\341e\027\001\340\022\252\253j\323\025"
+	.ascii	"m\333-\350\256\3031\314\257\333\266m2\205\275\25324\315\3234"
+	.ascii	"\315\325\2625\272\211\b\221{o\271\245L\001P\016\235\020\007\021"
+	.ascii	"Z\206\246\221\312\245TR\270\264\212^J\241\251\226\224K\212F\037"
+	.ascii	"\245W\322-\251]z&\215\223\202I\351\322/\372Jk\245f\264\225\256"
+	.ascii	"J\371\3220\251\027\215#u\3233\322.:*}\3239t\223\276\221\246I"
+	.ascii	"\261\244{\251\233\224\214\266\241\235\264\221~\241\251\322\272"
+	.ascii	"\224\215VJ\341\350\030\351\\\252\226\256I\357t\226\206\221F\323"
+	.ascii	"1\032I3\245qi^\332\227\266\245Q\264\016\r\205\241Z*}\362\024"
+	.ascii	"J\232\366\236\347\373&\251A\221U\205\245N\244\334\310\252\302"
+	.ascii	"\256`,e^dUa\\\272\340\240#\253\332\213\342\226\251\034Ei\220"
+	.ascii	"C\217\215\022(&bi\230\231\023(Wzk\224\350\310z\231\315\r:\262"
+	.ascii	"\252\2758o~J\002EV\025\326gDV\265\247\247&\315\211\346\305\354"
+	.ascii	"\n\2271\035\251\222%ndU{VXF\350\310\252\302\270\320\3418sB\305"
+	.ascii	"\f*+\3713Y6\373\261\027-r\204\216\254*Lo\r\032\265*FdUaqr9\313"
+	.ascii	"\b\347\200\302g\370\211\033\032+Z\304h\211f\275\234\006\227I"
+	.ascii	"\237m\033\206\232Z\364\r\234\033^pY\320X\271\222\341\240F\310"
+	.ascii	"a\206\325\260\2252\263w\252,}\352\240\3129\214\240y\215\320\024"
+	.ascii	"\321R\371+\033\321\300\013\215^\032%"
+	.string	"f`cYn\370\n\3362F\0277\227\303(\245\241\245\322\2474\314g\212.MK\341;\\\006w\361\361\036\031\215\300\304\213\254j/\277\211\203\347H\334\320!$\0231\222\231\374\231\354\354\nM\221\214d\006\r'X\016\363\362\"\253\332\373\242\2452\230\2347\002\016\035dU{d\271\t.\323\340\212\016,\211\227\031YU\030Z\232\016\262\2520\252\252\263\245fO\033\224\310\370\210\n\031bFV\265\267\327\346\206\033YU\030\336k\243\304\350M\307R\262\224I\002\244\245\367hk\204)*\034fbg\360\034\321\350\371:a&\317c\270\037\357\275I\342\225\255\344,\270L\203\034^YKKe\256\034D\003#n^\30001#\253\332\023\203\203\313\322\247\223}\022dI\364}\237x\317M\022\263(kw\316\354$?\2712#\253\n\323R\351Y\316z\241<\2302\272\202\273\3409\022cP\3178\031*\337\330\322"
+	.ascii	"\211\033Y\325\236\027\034\305y\270K\332{\244C\003%ndU{X\215\n"
+	.ascii	"\r&|\246\2450\224\367\205\231\007nt\257\b\022Z*m\202\313p\027"
+	.ascii	"\252\327\b\215\006Rh\310\252\366\336\367\231\367\256\245\262"
+	.ascii	"\233|#\n\3370\353\301a1\236\250\301G4\001^\314\263\262:Q\373"
+	.ascii	":N\373:G\3739c\366s\256\354\347\240\355\347\020!Pu\\\262~\216"
+	.ascii	"\222\375\234\256\215\237\2506\316A\332\371)\r\373\323\246\324"
+	.ascii	")M\262\302\t\333Q&k\260\016D;7a\302\262>1\315\376J\211\344\033"
+	.ascii	"IP\372\322\257\024*\003!&\351\274\357\217\030\316\364+uf\247"
+	.ascii	"\324\354\351\027\345\207\214\250\221\364H\352\225\"\301\320\364"
+	.ascii	"+-\222~\2455\322!\270K\332\373F\371@\031\221U\355u\370@|\263"
+	.ascii	"\007\245\016\250O\034\263O\214\333'\272m!\304\347\023\2275Y\237"
+	.ascii	"x\266}\254\314Dq\340\245>\322\256\224+\355\221\002I\267R\036"
+	.ascii	"i\220TG\272\003C\323\037i\326\323\250T*\235\322:\023\315JTdx"
+	.ascii	">9\314\244S6\266\340E\261\300\314Do\234\rwI\303\316+x\321\254"
+	.ascii	"T\305\244\r-\375\221^\261f\332\310\300\355}\310\231\222\244G"
+	.ascii	"\322\006}\"\223}\242\220}\342\217}\"\217}\"\327>Qk\237x\265O"
+	.ascii	"\254\332'\336\330'\326\330'Bm\013\360\316zb\322\316O\314\263"
+	.ascii	"zp\263?,\263\331'\346Y\277\207w\326\254\205w\326tF\f(4\302\360"
+	.ascii	"e\375a\334>\206\2462b\004\221\350\351\265-=\215\361\213 q6\341"
+	.ascii	"\373\212\275\357+\301Pl\213\324R\326\351Q\n\343\377/\347\210"
+	.ascii	"L\234\251\254\377\024F\252\364[\203F\265$\353\027\301$bo5\262"
+	.ascii	"\376\360m\377\307\3204)Ez\276=B\030?\256\200e\375\241\332\276"
+	.ascii	"\232\263\375\377a$P%Q\262\376\360k\247\303\255\375\241\323\276"
+	.ascii	"\260o_x\267S-*\373B\262"
+	.string	"\235:\361\316za\217}\341\324\2760i?xf\247O\274\263\346\241I\277b\344\370\312:\372\343\312\253\252\221\365\203[\366G\33459\311\3442\331L>\203\241\031/\213A\263s\022\013s6b\222\316;#\006U\032^\036s6b\322\363\025\202\245\240\310\252\302\336\367\375\320\363\341\303\207=\346$\r\r\240~\360l?\350\265\037$\262\037\f\262\037\364\261\037\304\261\323\240\323~\020i\037\210f\037(\267\365\253\266\0174\262\017\354\261\365\023\336Y\017\224\332\377\365y\310X\2369\302#\033P\272\254\377[\263\377\373\262\365\217\312[\016\0265YmY\377\007e\377\007\266\363\224\f\305\320[\311\277\244\347\213\366\276o\016\376\201\305\350G\326\377\021\331-\336\367}\361\255\254\354\255\254\377=\355o\276\255\235\233\314\376\306\262\277\237\373\373k\353\335c\177\343\330\337G\373l\232}v\314>\333e\3536+\373\354\223\355\001\311\376"
+	.ascii	"\363\254g\205\354\263][\263W\373\354\3236\362gg\366\3127X-]\354"
+	.ascii	"|d}V\306\306O\314\263\366\274i\366\3271[\325\302;k\220?\353\310"
+	.ascii	"[\031\210\031\324HH\326?z\2021\310\334\330\222\365\327-HQ\222"
+	.ascii	"\324\272\362\322\032\217\354#\367\300\320\334\225w$\365\374\320"
+	.ascii	"\204-\001\331\372\353\333\376\372dg-\314\263f\200wV\265\r\357"
+	.ascii	"\254Y\177\276\302ig\313\\\320`\355e\375u\311\026\342\235U]\207"
+	.ascii	"\354\257V\373\353\322^_\274\263\332\350y\200\035\331\215\254"
+	.ascii	"\257\302\331\307hKcR9I\3149\225k"
+	.string	"`h\226\312Qi=?%:\302\224V}5\272\257\312\355?\033=?\375\230\017\367e\247\254\365\276I\357\373r f\201\203\244\224uS\217\272\344t\262\311\372j\333>N[\322\"v\224\005\243!\235\215\370{_88\347\373\276\037\361\373<\307\310Ig\023!\3525r\202\261\245D\272\220\361\332{\337\367\177\246\221\231\362\214,\003Cs\214\374\342Y)\303\270~\276\257\224\367}?|\370\360\241'8\366\344\202\005\250\257\362\330\370\305<\253\016\336Y\257V\355\2535\366U\032\373\252\322\306a|\236\215\322\266+Jp\262\276f\263\323\027\363\254\037\340\235u}\232\333\327i\373\372k_[\355\365\211w\326k\244\375\024o?\335\262\237J\331k\033\336Yq\336\255d\255\227\203\352te,)k\021>\307hv\326'\252\347\233\366\276o\316\032VEG\233\254\237&\331O\201\354\247Z\373m\230g\305b\360\030\f\345"
+	.ascii	"\2239\016\203\355\256\036=\337\347\373>sr\2208jM\262~zc\037s"
+	.ascii	"\260\246}}\230\203\365)\215\255\203y\326\214w\326\3478\373Q2"
+	.ascii	"{\355\202w\326\357Q\331\317M\366\363\327\306Zp\034\206N\200\345"
+	.ascii	".\202\304S\243\263\234!\237\022\2767Y?\003\331\307\023\254\270"
+	.ascii	"\017O\260>\337\330O\303<\3533\322"
+	.string	"^\243xg=\036\263\217\331\366\261\021\267\314\267'g\265\361\032\226\202\241\270\r\263\0357\301h\327gZ/\332\373>\207\251\227\325\327\227\254\217_\354\017\034\275$~\334\307\036\326\234\276\276\276>\354a}\0036\373\342\235\365]0\317\372\001\354W\260\277\267\005\230g\325xge\237\260\331\217\231`1\\\226.1i\275i\357\373\304\3002\271\302\225\2265.\313\230\f?\217\313\360\330E\220\2700\351\025{\337'.\323\357{\204\361\005D\214/P\255\f9j\262\352\347\375'\346Y7\336Y\377\225\f\373\200\037\177\375\230\370\345_\301\374\254\212\037\033\371q"
+	.ascii	"\264\260-\374\330\371c!*\330\317\246\370W\267\177}\373Y\007\374"
+	.ascii	"\370\310\2177\254;X\016p\353\332\317n\310\027\374\370\356\307"
+	.ascii	"U\330\006\260\t\320w\022\250_@\b\360\007\037\360c3](~\354f\n"
+	.ascii	"\233AV\2115\355_\325~\226\205\037\023\377\314\3768\207m\300\377"
+	.ascii	"\025r\004G\300y5:\370q\032~\243\357\360\206\246`\005\277\306"
+	.ascii	"\372u\327\257\311~\215\364\353*\277>\372u\215_S\371\365\332\257"
+	.ascii	"u\374Z\311\257\301~\375\343\327Q~\355\365k\253_\303\3705\323"
+	.ascii	"\257\267~\375\376z\351\327\317_K\375z\352\327\316_\213\375\032"
+	.ascii	"\311\257\241~\255\364\353\244_\277\370\265\223_\033\3715\216"
+	.ascii	"_S\375\032\372\353\034\277^\362k\265_\007\371\365\331\257i\374"
+	.ascii	"\232\353\327S~\215\366\353'\277\026\362k)\277\346\361\353\264"
+	.ascii	"_\033\375\272\311\257\263~\035\366k\266_\337\370\365\216#\277"
+	.ascii	"\216\361\353\253_;\375\272\351\327=~}\345\327U\277\036\362k\263"
+	.ascii	"_\177\375\372\351\327P~\375\366k\"\277\216\372\265\017\267_\267"
+	.ascii	"\375:\311\257\255\374\032\310\257\213\374\332\306\257g\374\232"
+	.ascii	"\311\257e\260\3705\363\327\033\370u\363\327\313_\257\370S7\177"
+	.ascii	"\212\346\177\361\377\241\371\263\005|q\376\254\003\247\rv\243"
+	.ascii	"\346\307`\326\230\321td\276Z p"
+	.string	"?Z\3703\005i\304d\n\362\300\374\352\016v\205\037\233Q\273R\370\361\225\223\321a0\377\352\205\323\374\351\331\217\311\374y\202\034\351\223\177\315\373W\275\237E\361\257kX\025~\234\201\037\207\371S\264\037[\371\361\226\037G\377\365\r\233\302\217\003\360\343\271\037\177\3703\376U%\226\001\032\3701\333\317\342\237\315?\213\302\2375\374w\373s\317\217\207\376\234\346\365\314\2376\371q\362\307\313\037{\371\361\006~\325\003\354\tJ\326\204_k\251?l\t\277Z\002K\0026\363\253\027\370S;\366\004n\303j\225\004k\342\307b\376\234\177\f\366\347\340\217\223\374X\313\217\227~,\344\307h~\\\366c\276\037\317\370\263\005U\230\315\237u\360\2335\177\336\177\246\340\307v\354\002~\034G]\362\001[\342?\333\257\275\374\254\002~6\001?\216Q\201o\020\206\365@\214\246c\021\360\263\007\3701\005:\313\221\374A%\377\332\304\022"
+	.string	"C\363\004\377\3454\335Q\355\307;\033\260\024\321r\223\225\200_]\301\216\260\356\370\327\256\n~\\\346\277\\\216\340\307\"T\350\273\017\364\341/?\206\363\2577X\021\376l\001\246`\315b\007\200\361~,\242\002wG\361"
+	.string	"\374\3003\277Z\305\206\360c*\177\236\302\362_\356=j\216\340"
+	.ascii	"|R&,\211?\255\322\371/\207\273\374\230\016S\360\t~ \321\377\025"
+	.ascii	"\256B\025\001lQ\260 \260#~U\204\374\373/'\314;?\216\253\300\177"
+	.ascii	"\t6 c3\270\212\223\370\201NO\377`\220\025\310\257\341\260\"\376"
+	.ascii	"\225\310Z\344g}\376\f\354\2211\374\230\313\345\362\216_]\302"
+	.ascii	"~p2\326\003\375\345 \376`\316\237!p\373\323*6\304:\265!sX\243"
+	.ascii	"\376\334\306\202\370q\333\237\207X\357\312\n\034\374'c=\320t"
+	.ascii	"\\\364\227\017\340\007\322\375Y\377\352\003X\017\177\346@\206"
+	.ascii	"\345\340g5\370S/?\273\301\237\206\271\362g*=\006\367\236\fR\273"
+	.ascii	"\253\270\006?\260\354\317<\177&\036\217\371/\227V\371S\267?\205"
+	.ascii	"\373S*\277\272\001K\301\257\262\300N\360_\005\253\351\336\341"
+	.ascii	"\007\016\371\365\316\257\265\332\346_a\374l\207K \367\234\037"
+	.ascii	"\310\365\263=,\207?\347\270\005\271~U\212\335\360\347\234\032"
+	.ascii	"\001\370\261\224\377hT\266\254_\245\301\362\374\330\356\277\334"
+	.ascii	"\n\017\376\301\t\376\334A\013u\316\1772j\013\227`\203_s\370\n"
+	.ascii	"\317\360\007s\3501N\376T\355O\243\244k\377\375\301\033?\356K"
+	.ascii	"\203\372\361\336\023\032?\216\202\026\343\307kg/\376U\375\363"
+	.ascii	"/\034\376X\315\356\354\037\374\300\217\345N\026d\361g\365W3\253"
+	.ascii	"\341\377\n_\377\340\006\366N\001]\346\300\037\330\201\237\335"
+	.ascii	"\321Y\330\341\367\3773\023\002+\314\340_5`\203\377u~\341\317"
+	.ascii	"\277\242\360\257*\374k\n\377\212\342_\033\360_\375\205:\376\365"
+	.ascii	"\303\277\202\370W\017\376\265\203\177\345\340_\003\360\257\002"
+	.ascii	"\370\327\017\376\265\002\377j\201\237\005\376\353\206\177\335"
+	.ascii	"\340_5\370W\026~\366\367_\347\027z\375+\362?\376\205V~v\377\354"
+	.ascii	"\372\263\372g\363\277\302\371W6\377\252\367\257e\376\325\356"
+	.ascii	"_\301\374\353\334\277\306\375\353\333\277N\371\327\265\177U\373"
+	.ascii	"W\263\177\365\372\327\"\377\032\344_{\374k\327\277j\375+\325"
+	.ascii	"\277N\375\253\324\277:\375+\214\177}\361\257\035\370\327\f\374"
+	.ascii	"\253\361_\213\377j\201\177\255\300\277J\340_Y\370W\021\3765\204"
+	.ascii	"\177\365\371\327\365W\371~\025\316\257\272\371\3255\277\372\365"
+	.ascii	"\253?~5\315\257\346\375j\327\257F\177\025\357W\311\374j\230_"
+	.ascii	"\255\373\325.\277*\367\253"
+	.string	"X~5\353Ws\374\252\225_u\373\325\032\277\312\366\253M\277:\345W\327~5\355W\237\374*\332\257\236\375j\331\2572\371\325\260_\257\371U\260_=\362\253@~\225\307\257j\375\252\325\257N\375\252\323\257\306\370U\030\277\372\201_e\361\253\313_=\376j\361W!\360\253-\374\252\003~\025\305\257\246\360\253(\374\252\t\277\212\200_5\300\257\022\340WE\370\325\020~U\304\217)\370U\017?n\300\217S\374\032\356W7\370\365\206?O\375)\231_\315\177\032\345\317\353\237\206\371\325\f~\025\203\037G\340\307Y~<\345\307i?V\363\253\351\2177\374\272\357\327p\376\334\366\3536\277\336\373u\231_\217\371\365\335\1772\277\266\373O\366\353/\277\246\3735\227\377r\377U\374_\341\327s\277\226\373u\334\257\265\374:\313\2579\374\272\347O\313\374\351\335\377\026\376\324\356O\263\374\251\224?]\373S&\177\272\344\317"
+	.ascii	"\3703\006\377\237\377Q\374\337\372\037\367?\204\276\276\276\276"
+	.ascii	"\237G\377\033\224\370\217&\bX~9~D~g?#?\250_\332\217\312\257\310"
+	.ascii	"O\352\367\343G\366{\373\271\375\302~W~A~\316\337\215\037\323"
+	.ascii	"O\3547\003C\177\317\035\347\233o\367\345\210\222N\205\001\022"
+	.ascii	"u\376\236P\234|\3368\211\341.o\234p]v\252\216M%.*&k_\361\260"
+	.ascii	"\013sn\260\246\250\252\005\007\215n1\214\245\307\222\030\235"
+	.ascii	"X\364\n\210\235\220\275\365o\347F\202\343\367\334x{/}\266\231"
+	.ascii	"\360\"G\216\023\026\305|\\\310\242:\266\2241\316-\206\353\332"
+	.ascii	"8\323)2WW>\354\212\244S`\204DU-95\035\320;g:V\265\246j]\001\003"
+	.ascii	"\247#\r\217\210\017\347\276\332a\307$\r\013\0306U\307\233\334"
+	.ascii	"\330\357\355!E\325\312\"%\272\257\202\004qn148[\312\242f}\316"
+	.ascii	"\335\343\337bg|N-+Yv"
+	.ascii	"\033\034iG\252\362\264\310\234Fr8\323\251/C\242I6\023\03040\237"
+	.ascii	"\027&\321\367}\252ZZ\326\234ZqQ\242\252\016(N\316\f\351\361\303"
+	.ascii	"\r\225\363}\237\033\016.\363\242\311\371{f\264)Q\247\327\325"
+	.ascii	"\276"
+	.string	"\022\002\204n\214\311\271\305\312d\210\221\315p\216Y\331\251}\311*Su\264\201\331\262\257~\317]\304.\313\371\276\317\025i\252\310\rLD\337g\313\376ia\236\025\327\300;\353}\334\366}\316\366}\206\354\373`\355\373\314\330\377>\363\275\367\3572\333\314f\203kdy\203f\275&\345\223\001\035\313\372>I\373\377\326\333y;\315F\203\241[\315\216\226\255E\325\260cS\242dR|\266\032\3669\202\016\262\2520\365\007U^\035P\377\2038\0337\361\371>\243w\254q\372\312\372\037\264\3318\212yV\n\360\316\372\017\304\354\177\340\266\377\201\223\375\017\300\366?\350\332\377`j\377\003\243\375\020w\373!\334\366C\224\355\207p\356\207\310\332\017\321\264\017B\315>\2101\373 \266\354\203P\333\007\201d\037D\327>\210\247}\020F\373\036\344\355{ \267\357\301\224}\017\304\366=\370\261\357\301\325\276\007I\373\002(\263/"
+	.string	"-\373\002x\356\013\240\310\276"
+	.string	"\256\366\005\360b\277\203\274\375\016\274\354w e\277\003\260\375\016p\354w"
+	.string	"c\377\303\335\376\007+\373\037\236\373\037\226\354\177(\262\377A\307\376\207\246\375.xg\335a[\t\206\366\354%^\220\232\254\262\376\007\030\373\003/\356Y\337\207{\326\007\340\314~"
+	.string	"\256\354\007\300\311~"
+	.string	"\220\354\007\240k?"
+	.ascii	"S\373\036\372\366=\334\355{x\333\367\020\266\357\001k\337\003"
+	.ascii	"\323>\007h\3669\230\333\347`\312\026\001\363\254\347 \311>\007"
+	.ascii	"[\373\034\274\330\337@\314>\034\346Y\277\001\226\375\r\234\354"
+	.ascii	"o\360\265\277\201\325\306\033\274\373\032\334\355k\340d\377\033"
+	.ascii	"\307\246z\232Q'&\353\177S\355\033\304>\2550\275\254m\354\261"
+	.ascii	"qC\312"
+	.string	"\372\032x\355\217\330o\033g:\265\223\366\013\242\221\316\233\204\344\244\273\342\260o\210\351\373\036\301!\261F\206\323\r_\324g\317`\367\226\242>{\006\013\207}\203\273P\351%q\242Yi\317`\323\260j\322g\233\tMfD\333\364\361\275q\356\032[i\307\3302v\323\216\3320\366\323\246\261\241\266\323\226\332L{iOa\350\236\261\215\276\2176\322\263\036STi\317`\243l^\372t\226\320\204F\324\247\017\317\021\323\367\305r\343Tb\023\303i'\202\304\236\301\342\3419\t\220\336\027\353j\265b\032\023\266\367\276OV\253\007\024!\026\350\375\342x\016\003/\007\fZ\236\262\262\276\006G;;1\317\272\001\336Y\237\001\336~\006a\3663\230\333\317\340m?\203(\373\0314y\363\263ct\027\236c\026\301\361$\353g0\266\237\301\221\375\f\272\3663\200\332\007\200\233\255\006\227\3019i\206\270\021\222\365\001pf\037"
+	.string	"v\373g\321\234\315\373\3313\030N\bdJ\212K\326\230\211\317Y49ulj\210d}"
+	.string	"\304\355\037\336Y\017\200(\373g\315\224YAEEF\346l\031L\224r\022V\2255;\306\347,\031\003\004\331\261$\353\024\357\254?+\246C\022\267,\036wg\355\300 \331e\035\346\211\366\276o\207\024\016\313\020\246\254\017"
+	.string	"\260\375\205\255\303P\026\f+\007e\275\244\317\266\315\306E#\n\206\275\302\306q19\201y@\252VM\327C\013IV\326\007"
+	.ascii	"\326>\266kSm\020\217t\336$\244\245.\354\026\fe\271\260sh\\\214"
+	.ascii	"H\3601%Y\263\227\266A\233\213\256\372\030\330\355c@e\263q6\260"
+	.ascii	"\326\313!(\325E\f\016-,\\\024\247\0364k([\205x\244\363\276D\304"
+	.ascii	"da\261`(\013\307\302\261WT\034\270\213\017\275$.\252\243\354"
+	.ascii	"qiY\3651`\333\307vm\\\234TX+\354\033\206\262U\236\331T\033D\365"
+	.ascii	"}\265\356\234UX7\325\306\221\006bLF\344\366\230d]o\266>\006^"
+	.ascii	"\373\030\004\331\307\240\307>\006Z\373g\247p\260\223\250\254"
+	.ascii	"\211\261R\330\265\265\036l\\\262f\327\330(i\220\030=\263V\333"
+	.ascii	"E\356b\300e}\f\242\232\260PX'\354\023\026\rC\3314\326,m\254\r"
+	.ascii	"Z\331\031'\331\236\363\t\003\317\251\304\246\261g\037\360z{\204"
+	.ascii	"h\254\276l\021\352c\320\264\217\301\273\177\001\337\376\005p"
+	.ascii	"\366/p\263\177\301\336\376Y\261\234EF\003\307R\326?\313D\265"
+	.ascii	"q\246\224#k\365\nI\336\033\246D.\312\016a\177\260D\330+\266\212"
+	.ascii	"\025\302j\261;X \354\026\033\204-\302\342`\271\330\036\254\022"
+	.ascii	"\266\213u\262V\354\027\253\203\315b\223\260"
+	.string	"X\254\017\366\b\313\203\315\301.a\221\260`\254\027k\004C\3310\326\306\331\033,Uv\262\352%y\023\223\032B$\272\256\tK\315\236\030\320d\t;\205\344\013\354moM\212v\263@\311\031\330\333\036[Cu\203\022\001\311Y\232\232~\222\232=\255\300\005\027}\337\367\313\310\007c_/\017|\327\027\325]\272G\027S\324\007\033\246\177h! \224mi\257&f\242\357\373\364\241\213\034 \017\354-\354}\237<\3008\340\b\354-,\312\252&\311\327\023I\222<\26076\214Ub\241\242,H\022\365\206AI\231\276\320\210\034\201\275\355!a\3034X\372L\315\236R@\272\213:\361\242o\332\212\222(\2607=\244,\212\r[\363V4\036\222\344\201\275\255i\316\300\336|\260a\030\257\314KZ\024%y`oY\211\rc\243\222\034\201\275\355i\037l\030>\363\006\366\266\247\277\3300}$e\032\333\002{\353\301"
+	.string	"\033\236\321\t}\275'\346Y\211axg\375\005h\366/\370\262\177\201\225\375\013\236\354_0\3664\274\021E/N\326\277\340k\377g\231\330&\226\006;\003CY'V\306\331$\366\205\030\f9\347\222\352\026\027\365qZ\367X$\334%MW\231\213\262Nl\f\325M\213\363\303\207`\233\261\033z@\375\013z\354_\260\265\177\301\325\376\0055\366/\210\261u\272`\23653\255n\316\"\375Zne\303\036\3450\257\335\213\254Y#vI\233\0338Y\337\0028|k\037\206\262\357\n'\211}\3277'\304\246D\331w\215c\305\304co/\245\302\305\252n\325\267"
+	.string	"n\337\202\265}\013\320\366\332\306\347\253\033\27663\322\262\316\021\333:/\346Y\263\005\316}\013v\354[\300\264o\301\033M\322wRH\236d\375\n\364\360V3\030\272\236Y\241\327Tt\225\365\314\312\266\226I\315\236R\250\313\212\256g\264\226u\212\bJO&\324aE?d2\247\272!\253&\243\305\216\351*\353W@\267\355\3260\271\215\253\312i\267\276\255u8\242\253\335\372e\304\021\330[\330:f\025\263\336a\350j\267\202\271\276\242\261`\320\346|n\375\n\334\366+(\333\257\200\311Z\367\257m\253\333\352%k\305\225Q\265eM\007\204\203\244\347\225\365+0\262?\342J\2166+2\352\230\264\334Jj\366\264\237p\321\210\212U\331\262\306\255s+\227\265\013\206\256r+\226\257pk\226\244Un\245\202&"
+	.string	"\257\263:\262\275\017,\226\027\2706\241~\005E6\326\302<\253\006\274\263\276\202\036\373\025h\355W\200c\277\202\250\375\nf\354W"
+	.string	"c\247]0\317j"
+	.ascii	"\274\263\236\2027\373\024\340m\266\2343wW;\262\336b\247\307|"
+	.ascii	"P\246\267\306\271\227\216a\345,=\272(\327\233\250\316\323\303"
+	.ascii	"e"
+	.ascii	"\\m\242sNbDW1\315E\207I\315\236V\350Z\212\236A\343\306\371\276"
+	.ascii	"O\275\005\257\254\211\330\032\335\206\313*\246r\251oT\006J\250"
+	.ascii	"\254qj9\355%\202\033\327\230\232U\007\215\276\357\253\036\211"
+	.ascii	"\251Q\252\215\002\030Y\343L\225\304\34197#hnt\234\272-e\3244"
+	.ascii	"\006Pbd\215so-\262\226\255gk\332\ne\225\262:W&\253\2235\312\372"
+	.ascii	"dU[\223\254h+\331\212d\365Z\237\353\327\252d\005[\327V\263\265"
+	.ascii	"\311jd\035"
+	.string	"[\303\326%\353\021\f]\305\364\224k8\235Eo\321d\264\2312*o\326W\004\245\247_S\235ZT\255\312\241Z\245fO&pe\211\362\251Q\335p\t@\t\327\032\347\236>\223F\253\361P\206D\307d\025S\257rVj\366TB\035\234>#\246\371T\243\324\354i\257!\315E\337\367)\266\032\255CDPzJ\201\253LkN%#\202\322\323oF\235z\264\212\251T*\216\364\331f\002\227\226\350\221\230\212\244Bqy`\362\352-\232\b\037\211?U\262\212\255D@pk\262\246\007G\0234e\006\320\247@l\257Bzrv\3648\002\223\365)\020\262\217\326\030\351\323Y\002RS\324\307\032d\375\201\241+\220\367\254@V\031+\226\bJO\r@\242\021}\337w\005\262\366\270\334\007^o\316\344u\370\360A?\361\221%k\353O\200f?+\261\321\001w\361\241\200\2575\264\034J\242+\326:c\235\222"
+	.ascii	"iI\0058)T\267B\374"
+	.string	"\275\357V\232\263jI\024\207\007\334%\355D\233Xt\305Z\255n\205HXTi\305Zot \036=\337\247\365G\0202p\366\326\035+\2175k\345Zu\254[k\327\252\205\241+\326z\245>q\262\367&\203\376\004B\366'\350\332\237\340j\177\202\251\375\t\230\366'x\261/A\234}\t\364j\030\235\361\342\224\365%\360\262\377\257Pk\024\206\256R+\215\236\021L\253\223\031\347*\265>\255N\031\314\220\251s~H\241d\3228Y\365%\320\261\377\325im\n\362\215]\361\255M+\r\"Y\021\246\035Y_\202\030\373\022\034\355G\360f?\2024\373_\223\276\306X\2270\360\276Ij1\342`d\275*\2550\276.\255/\336u\t\004\255\367=Z\227r\340\274\357Q\016\306\027`|\201^\302U$\312\252\037\301\231\275\"\371|Mz\341\203)*k\016\360\316\372\b\356\366#\250S\373\230H\360tL\341S\343"
+	.ascii	"\211\212qf\255\3061\"\263f\367dOm\303\346\207dJ\255\214s\357"
+	.ascii	"*\2330b\3205Y\253lR5X<\206\234)\243\232b\373\241\352\341#o\""
+	.ascii	"p\332\307P5OE\223\324\346lK\326*\232_\004\t\\\206\231\340\325"
+	.ascii	"\261\311Z\305S\317l\247\223\321\2133P\2708\276*3?4`\270\3700"
+	.ascii	"c"
+	.string	"\243\313\013\312$\353G`\264\351R(IJ\262\026\203\241\352\030u\313\030\225\213z\027ET\243\222\304J\370\306h\343\246\357\354pSSt)k5\314O\256\306T\226\254\017\301\333\376\325/\030\252\202\301\363\240\303HT\326W\243\326\375\377\345\036`\316\270\311Z\365\362\364B\301\2215\035\213\007\345\345,\353C\360\334]\324-Y\307\321\027\250\254\017\301\330>\004A\366!\340\261\343V\255\033L\230\262>\004U\373#\376t\212\210:$\251\t\3249\345C\035\002\202\022= `{i\352\024\256+\352\233JE\265\242fQ\265\250UT8\fU\261\250\320\253:\324-U\013\213\312\246\272\245fO\033J\023.Q>\025\213\332\003\227e\300\304\b\0200,j\021\025\n\356B\365|\215$H\242\007\004\214\217\207\332E4\302\360\276;\260\332T-,\352\016\265K\004&T\206y;\242F2h\265\355\027F\357*-\353C"
+	.ascii	"\265\017\301\213\375\016m\266*\245\2043WlY\257\001\325h\224\231"
+	.ascii	"e\375\016f\266\032EU\033#\343\305\313\372\035\350\366;\314\241"
+	.ascii	"\251OT'\030\252B9\0225\t\023\025\212\252D=\303]\250t\336\227"
+	.ascii	"+\314\251BQ\235\352\221:\262\350\373\276\035>|\370\220\326X\342"
+	.ascii	"\243\315\326g\352\022\\\226\001\022= `M\324\247j\206\241\352"
+	.ascii	"\231Z\246\236\251d3\232\f\211\372\250g*\023u\314\003\222: `\037"
+	.ascii	"\362\027\2532e\266~\207*\373\035\240\373\030z3\252\330\361t\020"
+	.ascii	"9\033cY\277\203\332~\207\263\375\016`\373\035\276v\022\325\013"
+	.ascii	"\317\021\215t^\244\272%\316\367}\206a\250\232D\005K\247\234\274"
+	.ascii	"mi\375\016?\366;t\355\377\252\021\fU\217\250_\027ABL=\242z"
+	.string	"\341\271<\020\222P\001\002\266\367\276\317\236\017\330\f\031$XZ\277'\316~\217\232\375\2362\373=^\366{\342\266*\204\212\306\225g\326\357Y\333*\020\365\307\315\350\020\200\032$\256#{A0T\005\362\236\236|w%\346E\353\367t\355\367`\355\367\334\330\357\201\332\277\332\205\347r\335\034\023R\326\357\231\261\337\003c\253/\346Y\337c\264\317ao\237Ct[\345\266,l\203\243d#\353s\230\333\330\211wV\025\307\257\336\310JT\0338\252\212\331[\326\347\360\266W\274\263\252Rj\r\f\355\240N\345\371@\202\312\372\034\242l\017\274/\356\260\342\276>\334a=\007\262\375\224#u\005e)\353s\370\261?\"I\205\221\232=\355(=\212\374*\r\325\tC\325&u\311GmRc\250L\031\2609b\303\267\367\276\317\017=\037\206Q\366\336\330X\265\fuF\316\214!0\202\220\221\321e\177\303\232\252\224\243\234"
+	.ascii	")S_\204\355o\350\332\370\211w\326>\365\305uk\334\304\310\372"
+	.ascii	"\033l\364m`z\243\341\244Oh\026/|o\362\330\350\275 \027\0305g"
+	.ascii	"\326\347\371\302\206\007nw!\006a\260q\255e}\036\350>\317s\377"
+	.ascii	"\016\363\254\3471\262\317\243\2651\317\223.\243m\314u\021\311"
+	.ascii	"\372<K\373\032\334\334i19]\210\\\201f}\rd\356\266\200\301G^\224"
+	.ascii	"\035\311\372\032\242\354\377\272\016C\365\027\335\345\213\246"
+	.ascii	"\323^\004\240d\253\216l\357}\337\236\0178G\034\022\027\255\265"
+	.ascii	"\227\254_\233\230($Y_\303\220}\r8\3665\310\330\270K\233\235_"
+	.ascii	"\274\375\2350\033\003\025\336Y\265\024-{\303\023\363\254\371"
+	.ascii	"\316\251\335\332\322\264\247\333R\326l)\335\221\034X\262\376"
+	.ascii	"N\333\326P=e]r\006\351)\353\357<\331\337Q\262\201O;\366wll\340"
+	.ascii	"\316\273\365\023\355\204\215\255\354)k\264\240\335\026\226\027"
+	.ascii	"Y?C\231\255\237\232\211\206\333\213\276\357\253\237Z,\337 \376"
+	.ascii	"\336w\307\031\347S/\311@\210\277\367=j\343\324e\332L7\321g\030"
+	.ascii	"\252\237zL?5Yv\"&=_)`\221-\2607!\330\235\023\032@\375\fg\373"
+	.ascii	"\031\210\354g\310\332\317@c\037\003\337>\2063;\030\267\217\001"
+	.ascii	"\272\205K\3661\f\331C\fW\373\030\244\3661\274\330\327!\263\257"
+	.ascii	"sE\007a\333\314\370B\227\365u\3104\220\037\331\230c\313\372:"
+	.ascii	"\316M\314\332D'\336Y{0\317\372\353\035\023\344<m\320\330\221"
+	.ascii	"\365\257\271\206f\326\244\r\311\372\330\f\236\016\237\024M\212"
+	.ascii	"N\214\356M\346\303e\032\334\200\242\253\0333\"\253\n[\202\347"
+	.ascii	"\322\247\223\205\362\243\217\254,\033\321 +\212\224\334\006E"
+	.ascii	"\"\007\232g\026\024YU\030\031\232[\346\222\353pxUq\213\333\202"
+	.ascii	"\206\254jO\rG\301oR>nzX\215\022/\262\2520\375\246m\3225=\225"
+	.ascii	"JI\337\244"
+	.ascii	"z\372)U\223\226\321I)\233\306J\255\244b\364V\232%\235\222\342"
+	.ascii	"\351\032\001\377o\345rsD#\353\243 d\1778v\246\214\310]\326C\261"
+	.ascii	"\255\204B\026\007zF\224=4&\037\212\r\255\276vte=\\\342\363!\023"
+	.ascii	"\025G\234\216 Y\007\361\316:D2L2\f\373\177i\226U\324\223\254"
+	.ascii	"\217B\323\376\020L\t\330\021\027\252U\024&wb\357\373\202\200"
+	.ascii	"\251\254GFi\262\262\036\036\371E\301(\322\226\365S'\256\027m"
+	.ascii	"Y\037\205\030^^A&\370\354u\322\300\346\b\354m\270tW\245%\315"
+	.ascii	"\220!\303\"\370\214\202&\276(\325\373RyP\301\242\334\234\f\211"
+	.ascii	"|X\004\257\217\316\211\034\360\025\032\331z\241\347\345\307\217"
+	.ascii	"a\220\036-\2435+\330\324\326\226=.Q\262\250\200|\030\344nOb\302"
+	.ascii	"\374\342\004\337\234\304\216d\375\023\342z\364\300Q5\336\264"
+	.ascii	"\001\265\3366\250\254\177\302\332\326\326\260k\204<\314\306H"
+	.ascii	"\317l\270\343C6\035w8zd=\344\022\333U\257\032j\341\263\327I\002"
+	.ascii	"*Q2p{D>1qo\326\207ZN\340t\225\311z\230c\210%\224\322\261\307"
+	.ascii	"6\304\032^y\ri\272aC\r\023<\244\254\207V9\312L\323\0318'\f\271"
+	.ascii	"qcH\325\243e\244fu3\265\265e\317\210\036\322\\\326Tk\256`\301"
+	.ascii	"\311\372'$MM\001\257\364h\031\261a\277j\364}\021{\314hB\007\007"
+	.ascii	"\0055\224\352\3212R\003\214j\342\213\246Kb\204\311\032F}(\245"
+	.ascii	"\306I\0272\325m\335\342\004\307M[\214\030C'|\366:\035\340\250"
+	.ascii	"\216,\354}\251<\254/\254\320ei\372\320\211\r\370\344\312\224"
+	.ascii	"6Y\017i\234m\333\245U\361e=d:[\230\230\2558Y\017g\234M5\353r"
+	.ascii	"\363\222\365P\006\332\020\306\020F\320\r>{\235&\250Q\343M\333"
+	.ascii	"\336\373Ry\370\321\221\341\311e}\023\264\372>D\352\033\276`\253"
+	.ascii	"\364\274HI/\326\217\23575\330\264\355\275KV\036\202xd\311\r\223"
+	.ascii	">|!\267\3669i\333\032\036\261v`\342\316\262\036\032\2519\244"
+	.ascii	"\310\034\311\372\037\276\377O\350CnK^\326/a\314~\tu\3022\027"
+	.ascii	"F\177\f\025\226\021\306I\353\360\363\245\3222B3B\222\032k\302"
+	.ascii	"\366\336%*\017\304\031g\266\272\330\\\030\347B8\"H\334L\222\307"
+	.ascii	"\223'Y\013\337\034\377\320{\262\224\365\205m\204n\376\337\317"
+	.ascii	"\253\214\024\276\254_\002\332\026\356yp7:\340\b\327\334L\246"
+	.ascii	"\361\206\344*k\241\232\237\031J1\363!L\303U\207\224\265\020\215"
+	.ascii	"0\017C\037'\324\3733\207\370\006\243\204\261}\374\270\365\003"
+	.ascii	"\370q\253\020\357\3023\377\357\367\206\325\205d\377B3\377\217"
+	.ascii	"\215\022&\2073\353\227\340\334/\341G\035\206\n\353\204c\200O"
+	.ascii	"& 5E\223hqc$\024#<\272\322q\347\366\006\311\224\335\205w\277"
+	.ascii	"\360\213\020\314\020\032@\242d-\f\343s\241\335\217"
+	.string	"\215\t\227\035Yw\300;+n\303<+\004xg}\tZ\373\027\322\t\351\316\206\2376(!\021\211\276OT\035\344\274\371h\263\225\365K\210\332\277\220\013\227|c}\372\301\340*\022\335PRN\\\262~\tJsse?\243> [Y\237\0046\373\027j\021j\021\306\3454,H\220\254\265\271&T\262>\ta\336.\204{\353\272[\323`\225\245\325\310ZxE\210EhEXEH\205\004*K.D\023.\021\266\251H\357Q\020\026\353\347dm\013\226\254\331\204]IrzY\237\004(\373#\240h\211\276\357S\270&t\002E.\372$\316\031E8E(E\b\305P\341\2320M\270&T\303s \274qS\327r\274M@}\022\270\366I\270\261O\302\213\375\023c\366O\250m\241\231\260\311\217\nS\235U\326\027\236\371\3602\004I\326\371\311\212=%\251e}aY\032G\216J\214\254/$\373\377\373"
+	.string	"\031\035J\262\026\216m\245\023K8\370\21593\023\204\311\205c\277P\f\177Y\2270\300\224\203\352L\326D\274\263\ne\370\\\310$\027I\213\213\323\n\013\323\322\366>Qu\220\235D\361\262\313\372'd\354_h\004C\205F\204`'\350\274/W\2146\030h\200\220e-\004\373\205G\204H~e\360\026\217\2707\353\b\272`\2365\025\303;\353M\344-]8\225F\245R\030*\\\022z\255O\316\267\207\023\273\227\323\006\206\230\273\254\235\354\221]\230,Y\337\004\230},fCx\243LTHE&\207\360\nw\361\241"
+	.string	"0.\252\227\332%\001\322\322\tbc\242\357\373\024\376\020f\ty@\367\242\302\037\302*\003,\271\013\",\"$\"\024\"\364!\004\"\034\202\241\302\037B,\341\017!\016\005\210\211\211\276\3573'\r\023(7t\264\320\306\tdxQa\227\260\007\206\ny\\\310C\345\"\334\261\245\006\331[\207\017\303\274/w9V\375\013w\b\271\244<{\350e-\334\302\243\272a\302\311\376\205Z\030*\324\201\267\325\204\271\2751\363\377\027\304\002\204\253l\337\304\327\026Zm0\321+!\373&|\354\233\320\261o\302j\337\304\215\375\013o\250]hZ\322l\311\372&\244\266\020J(%\254\361\377r\226\264\361X\313\372&f\354\013\243\376\377V"
+	.string	"\302e-k\215oe\025:]\370\364\377r\\\021'\215\254oBi_HC\330\364\377\210wD\324\314\262\376\002\370\366\205Lk}ipd-\234\261\225\026\020\345"
+	.string	"x\005\315\022\306\270p\306/\224\241\363\326\245\027\372\342\260\311z\210w\326|\345sa\214\340\226+\321\262\254\277\200\270}\254\004\013_\341+T\362y\337\035C2PYu\240\242\341\201\331x!\324\002\263\021\325UQ\300\240ea\222\020)\247=\240\304pe-<Z\315\252\222\332\262\376\002\246\b\215\300\370\370\302\234t2\234H\262\376\002\270\202p\202p\202g\277,A\234Jm5\252\262\376\002\252\366\366\202n\362D\210\365\261\325\225e\035t\303&\2142\326\007\227\365\325\334\312\224\033\223\271\254\277"
+	.string	"\2445k\202]\371}\337\327\311\302e\301\021\r\236\311\215\241\222\227&\315\033\210h\032'\207%\226\365K\310\355\274\274`\227\027\020dI\270\224Xe\375\022N\242\321 \223\343\247\367\255\0038{_L\250d\375\022C\314\340\345,\005 -\275/\324\210\274\0227\366\025\320w7&H&g\351\274^\336\237\017#dQ\274-FL0\007\266\340}\235/R\035\335\006{\n\220\333W\200Zp.\030&g\341W\351\351}\273t\214H\323\004fcO\001\316}\005L\355\3432\034\364\362\213 \021\234\013\326\341\262\375:_$0F#\370\366\023"
+	.string	"f?8\207\203\\\346\202]2\034~\243^\034\343\210\2228\321\367\351\331\301\023\320\266\237"
+	.string	"%\3738\303\255\301,\301,A9\272\021[\232\300l\354\ta\204ab\025\214{P\016H\027\226\026'\353\240\026\240\\\233\030-tY_M\206\373\377+Z\001\262\227\365\023\020\004\013\226\340\331\361\323\213F\004\225\221\252=\252\254\237"
+	.ascii	"\247M\205J\320\212\033\006pV\036\206d\346\362\350\252<h\305\n"
+	.ascii	"K\303\311\314\020\004\364m7\267\227,\272\242\201\252\321\310"
+	.ascii	"\372\b\250cc\013\256m#2VN-f8p\264M\231\022l\332Pg\022\243/\\"
+	.ascii	"\262>\002\306v\224(\3015\254&\026\005\266\371\"\323\264\346\345"
+	.ascii	"\b\221(E\322\322\2108\325\270|\311\372\b\210z\362\344\207\223"
+	.ascii	"\313\215#QY"
+	.string	"\377"
+	.string	"i\202hA\264\340\331\tb\254\234/\025\225\207\340]\3333\353\212\231Y\360\354\307&\003\326\213\2604j\30136\037_;\324\262\376\001\216\004\307\202c\301\262\003@\351\213n*0\257\243 \331\203eC%)h^wf>\270\202`-Y\022d\362S\223\223f7\331\201y\222u\220\t.\3632\302\305\224\365\017\240\024\f\013\206\005\233\264\260C\242\216\250\235\001\303\320 \230\352\366{\337\255\034\353\022\270\016~<\364\252\244d}\003\314\355?($h$x\344l\370\215z3\235\217,L\321\367\351\355\340\006\300\262\207\f\t~\345W\353}\235\254\\\026\031QM\267E\351\212\327\203_U\254\330\200\313:\350<\033\032-?\342\262\016\026\301e\276\330\301\200\313:H\004\227\271R\013\233z\262o"
+	.string	"2\037A >\202M?~\004\233\3404\201\331\b\313\tc#\357E\3267\200\220}\003Hm\005yl\005\273\270\270\202]y \250\206vq\332|\354x\260\353G\231)2\270L(#\212\n\026\234\375\002l\301\nja\005\233\326`V0+\330t\235#\272\020U\200Z\256\360\270d\375\002D\331/@\221\033A\253\033\301\034TT\301\034h>hi\002\263\021\206\253X}A\253\036\314\301\226v\031Y\245\311:\210cL\031\230Y\001h\354\023\340\013Tp\n*Xc\203`T0*X\343w"
+	.string	"2B\242\253\021\0221aR\017\326`\303P\306\320Q!@\223}\002\344\230\021t\232\021lZ\337\027?\265\234\236^\252'\017A\246 S\260\t\277O;p\304#!N\036Y\377A\032\0176\211\241}\241\261\267?\002t\377\301\030\301\030\027<\345\254\001\273\n\222\365G8\013\032\005\215\2020\236\257S\005oM`6\302\202J\017\302\320A\224\2464e\035|\001\304\213\346\361\221\311:\230t+{\317\312\235U\326A$\340\0306\273\267h\326\301\243\263\345@\315\356\202\214\340\243M\033`_\022,'\337\201}A cb\254\262\006\306\271\225'M\254d\r\204s6\252,G\370\262\006\276q3\002U^\036\220M\007ak\016d\223yl\271\263\2215P\315\255x\365II\22250\215\336\bHa\302"
+	.ascii	"\243W\024`\001\317\034\030\305#n\225\021\322#k\240\031 \336\377"
+	.ascii	"\037\221\251\310\230*\\\244\3245e\r,\003D\373\022cE\206e\362"
+	.ascii	"\244\n\222\254\201b\200c\376\377:0\303"
+	.string	"iM\326\300\273\263\211Y\313\202%k\240\235\bg\350\350\200_\320\210\250;\360KJ6\245\307\217\254\201^\322-R\336vd}5@4\036Xkrpp@.\373}_#\235\027\311\314\030\347\226\003\271`3h\215\245\254\201s\302)n9\250\262\006j\001\312\345\264\315\265A\003\312\001\343\324\273\251&\"=(\230\031\303\22250\013\025+V\200W\242Ws\340\225\263Q\005yZB\205\312\246\362Izw\214\255aLc\302\200W\222vT\311\372\"h\261\235\r\350v\235\367}\221\336\027\013\213CX\333\201n&\224\310\216\262\276\032<\367\377\247r\255)\303\226\365E\200\261\177\340\024(p\n[\306\203\326\321\226\005\321&6i\366\206^K\234 e}\021\326\240\3005`\017\017Z\257\324\bZ\230\214\310m/|1\326d\375\001\354\355\037\250\006\005\252\3412j\322\253\365c\345k\342\213n.8\254\027Y\177"
+	.string	"i\317'\020\n\035"
+	.string	"\250\236\034\b\205m\357=)\003$k\240\223[\371\377K\213\234\275\261\2215\320\f\210\206\325f\312K\326?\020\r\330d\315L\214\2520\035~F^\200\221e\r<c\345\220H\311)e=\200$@2 \331\233\363eA\226\017\276\254?"
+	.string	"\035\373\007\212a(P\214]\363\261\212\255Vf<\245\311\372\003\300\261\177\340\222c(p\t\360G\272\244\365B\031\200\nU\0079uYVR\262\376"
+	.string	"j\354\037\030\366\213 \201\241\3000<\327\243e\224gA^\023\2334{\357\013\327\201\216s&\314\217\350\221#@0\374\276\357Ke"
+	.ascii	"#x\316\227\352\311\203\312D\313-\nD\202\347%J\314\233\365C\200"
+	.ascii	"\003\0029\020\b\360\013\177\360\"\325\271q\360\365\344\341\007"
+	.ascii	"\n9\360\353@/\007L\305Q\312\372\300\"@\347\377\313Wq\336#Y?\004"
+	.ascii	"\267\r\034\002$\362\377\227\201\224(\244\254\237Cx\302\001{\345"
+	.ascii	"F\2147@\347\033!D\262\006\006\321J\316\330Xe}5\207z]\211\001"
+	.string	"\226\365CP\262\201>\200K3\336ld\375\020\2766\220\007\220m\215\n*\353\207`\265\177\340\216c(p\007p\213\005\374\306`k\362#\372\276T\035\004\343\336\250\305e\375\020\214\366\017\344\002nEQB\305L\326:2^\303\206\314*\353\223 \263\217\323\200X@\034\300\252\364\331\266\241\\XQ,\340\013`\r\t^\274\357\016&\353\022\246$k\366\200Z\300,\240\0250\007\360\nC\201X@\252\214\005\274\201\313H\360\342}\265\260\326#S\270\f\307\032\306\224d\315\036\020\013hc\005cJ\262&l\350#\313\2247!Z\\\230(o\326'\001\267O\342l\237D\222}\022@\366I\\Iu\020FQ\322Z\222\365I\300x\002Ba(0\n\250t\205-\203\273\3708aI\0340\212\205\002\235p\027\037'\360\311E5\0225ejV\335\224\2052\366\306\262>\bf\366\177 \023P\006p\0060\006\206\002i"
+	.string	"a\244\001\227\330\354\2468\241N \r\252\2460d{91\266\260\320"
+	.string	"\365AX\262\017\002\326>\bK\373 \274\373\007\032\035C\201F@$\f\365\276GY+\331\023U\007\303$\251\243\037Y\003\217\236BI\323\336\203\304\004\357*\353\217\320\333\037q\267\371~}\273\256MW\034\025\2767?8X\357Eb\312\372#\230\274\021\263\322\224\365\261\022\374\303\373\217\315o\357\227\005\277QO\r"
+	.ascii	"\263\024}\237jt\360\021=\366\177g~\321\377\320\034\315o\r~\237"
+	.ascii	"\336\227\3525Z\303\302i\002\263\261\367RQy\3203d\034)\362S\363"
+	.ascii	"\337\032\326\314\211\251.\353\253\371\245\371\377\003\346\321"
+	.ascii	"\201\261K\363\323\003J\211qb\345\007\247\376x#%\345\227\267\343"
+	.ascii	"h\031\002\247\227\365G\334\330?~\376\327\367\350\351}\337(\365"
+	.ascii	"\371>!\t\327\037\037\253\030{\370\2078\305\030\274#\210Y\276"
+	.ascii	"\257U\232\260\367}q\232m\204\355(G\326\377-x9\274\357\013\265"
+	.ascii	"\224\364\032\341%\264-\250%\264\255'\fKr[Po\022TX\322\226\026"
+	.ascii	"^J\332zzJz\2150\274h[OK\357\026\224\316\213\366\336XB;2\302K"
+	.ascii	"I/\324\373n\275:\357\322\021\324\213\366|\302\260\204\266\365"
+	.ascii	"\264\204\266\005\205a\t\355\bj\351\325zu\226\236;\236\336\347"
+	.ascii	"\226\021\206\031hGP/\232\026\024\206\027m\013jIo\214N\2023p\270"
+	.ascii	"\246\260IR\262\005\353XJz\233hX\035=\351tYzj\275w\357\213\323"
+	.ascii	"\224\336\247\267\313\373b\360\276VZOwG7p\033R\227&$)GZ\370\371"
+	.ascii	"\276o\007\032H\\ZoR\027#\374vY:\242\365\276G\220\204^\032\357"
+	.ascii	"\373\276 \030=\273\274?p\027\243\035V/\223\322\373B\360>\337"
+	.ascii	"\227\306\373\032\341\267\313\373\276F\357\373\262OV\317\367\255"
+	.ascii	"\322Yr\322\240\361\276T=4^+#7\245\367\315ic\332\240\226\320\270"
+	.ascii	"\264|\334\236\2409_\030O#\274\304\244\365:\337\273\255\247\215"
+	.ascii	"fd\3662\275\357\213\365"
+	.ascii	"\266\023J*/\353\213\220\333\377\317L\231\031c2\332r\246X\371"
+	.ascii	"\202\223\365\377\033\203\241\27719\253\347\371\032\255U\232\300"
+	.ascii	"l\204\275OO\035\\\204\222\375\377\304\344\033E\252P\345\205\371"
+	.ascii	"\331\275y\212\r0a:\302\374\276<\261\222\227\270\027Y_D\323\257"
+	.ascii	"\216\355Gg\346|\337WG8&\315\224\264\254/b\351\307\345I\334b\027"
+	.ascii	"\346.\353\213Hz\21299\005\321\232k\373]\351\0133CN\006\226!\225"
+	.ascii	"d$\316C\2330HaY\377?-\277,LYvL\311\372\007\227\244\246\n\036"
+	.ascii	"\232\254\357\303f\317\245E\323\2511XN\2544\347\276\322\321c\f"
+	.ascii	"\363\325)\211N\331\375\210\246Sw>\242\252V\0250Z\232\200\211"
+	.ascii	"\263\325\272\314\350\330S\304D\2576\227\235\330\276\372AD\314"
+	.ascii	"\211\03346.Q\264\234fIT\325\261\006\206\214\330\357\271\237\354"
+	.ascii	"\233\267G\fl&J\031\267\271\250\330\223='_\227\261\250\363\313"
+	.ascii	"\352\227\365\343\361+\373%\375\254\374\220~S\277*?)\277\255\337"
+	.ascii	"\222_\222\037\220\337\332\357\353w\365[\372\321\370q\375\214"
+	.ascii	"~1~f\277\032?\033?\257\337\330\017\354\027\365\203\361{\361S"
+	.ascii	"\372=\371\035\371U\375p\374\330~V?&\277(?!\277&\277\246\337\216"
+	.ascii	"\037\364\347\344\007\3457\3447\345\327\343\247\366;\372\241\375"
+	.ascii	"\264~J~m?\252_\327O\307\017\311O\306\017\353\367\364s\372\371"
+	.ascii	"\370\005m1x"
+	.string	"!\020-\021\322]\022\375\374\200\222H#\023\230D.[`a\234@\023\311\323\202\333\006A\240\323\034*R\n5%\270\020\b$\021R\005\236\021C\021\303\022XP\201\207'\2114\2320tq\f\036\211\220M}\241\237\244\221\351B\022\351*\223\302#\021\262iA\3134\016\375\264G\013\226DJ\035 \026\312\245V2]\004i8\226p\333&\206\343\332\272\306\024n\033\224sL\032]8\032\333\023@\304\013\201h\231\312\237\020?<\307\32656\221\031.\004\202\331\266@\022\205h\201D\301T\272J\024n\033\244\303\002\265C\306\237f\360B ~\230!~\200\3346(\347B \232CC\306\037!\327H\024\302m&\225?*\220\233D2\207V\267\271ah\250(\231T&Y\267\330\276\200l\256,\224L!W\231d\201\214\355\220v\261\374!j\211\326fKd\\\341\210\\\356!\320R\205\240\213\245\322\004Q\007"
+	.ascii	"\315b\220H\231l\217\305f\263\375Q2\227\305#"
+	.string	"r\211!\251D\272\311vE\313\\B\320\272\306\025H\367\307\330\036\213@@\312V\003F\267\350\302\310\302\230,bZp\243k<\272m\223\030\204\004R\321\301\305Ri\202\307\205\221\311,\321\\\206\bZ\356\374$\213\202j\263\030\264\024\272\305d\320RM\006-\323\241\265}\001\331\324.\226\312\037\315t\227\351\261e\217m\263H7\3313\213AK\020C\027L\267\211\fjS\024\207K#\212\026\3551\211\202RE\323\210\034*\361\303\334\300B\006\025'\366\006\035\344\222\307m7\264G%\n\016<\"8\350`\360\001\221\241g\004\210\3265\2620\246\200`\003\bm\321O\263M\321\\\006\365h \001B\205\3134\272-\fm`\266C\303\022\021$\203\220-\034\221\313\b\\d\022\205#r\231AE\206#r9\224`\002\2675\341\210\\^\300sl6\340\210\\r@\341\210d\001\203\272\201\226Y\002\020\220\322\325\371"
+	.string	"D\273\202Y\364\303b b\266*N\364lXN\260\003\264T\001\202\013JH\341\301\002\025\034`\360\001\b\227i\\\202(\321\272\306\343\362\001G\3442"
+	.ascii	"A\267m\341\230,q\354\200BN\353B\t\rB;*d8\"\227[\310\rJ\266L\267"
+	.ascii	"\205\023"
+	.string	"~\206\214?=&\334d\313d\026\375t\030\002jO\374\244hW\264*\270mP\217\272/\004\342\207\031\342\007\350\250D\221S\302\305\320ri\324i\026\223%\004-y\220KV\311t\021\244/\004\"\250\310\205\366\030\3428\204,r\241=*Q\374\222%84\233\355\317\217q\265\300\210\n\370\\\300\002#*\360\301\005\200L\245\373\323B\240\025\272n\2619TDB{,r\221\256k\344!j\335\246\213\026 p30[\267%R\362\274 T\004Z\016\025\177~\214\300\237\037\243\320u\213@\355\261\303\205@Lpl\335vhI\2444\361\243\241\031\301\t\036%\263\245\300\317\217\221u\201m\261\031d\034*\241\035r!\211$b\0325\264\305\244\262ilS\0201\215M\344\211 \245\n;,\344\374\007\311l\223m\320>\b!x\020\202\b-\330\213@\200\017\b\360\301z\021\b\340\343C\200\020|\366C\360IC"
+	.ascii	"!\202\b\237b\353\032\207\226D\255[t\333f\313,\362\374\007\304"
+	.ascii	"\021\271l\"[\030\177m\261-\036\221\313\f\256Q9\004\244\272Id"
+	.ascii	"\352\n\375\270=M\026\216\310\245\360\005\241b\221\205\321\005"
+	.ascii	"\321\347\005\241\fn\263\b"
+	.string	"tD.\327#r\231\266K\027n\016\207 QQ\013G\344\222\230D\242pK\034\221K\035\367\247\005\002j\213\356\020\322-\366lH\301\302\350B\205\32652\211\307\240\242\216[l\366\264DH\027\350\3028\324\036\203\032vX\030]\024s^\020*\376 ]\243\333,\212\320\300,\022\211<:\301\240\244\321X\f*r\241=rH\"\215A\030\232D\305\241\242[T2\177\214\035\222Hc\220\016\006\246\222\311l9\374\024\213M\027\214\031\332\245\013\267(\"\347\005\241b\022\371\202P\261\205\221\210G\202$\322hB\333lS0\333\240 $S\005\013\345\320P\t\n\212m\263(C\013\343P\313,\2620\272(jP\223Hc\020\260\375I\032W\034\215\307\241[\264t\213\224E\246\322U\022e\030\032j\177\212J\267\310\310\241\350&\333\036\242\245\316\022\3314\266\314\237$\262\035:\"\213I\027G\036\267h\344i\026;"
+	.string	"\0253Pt\233J\245\013\030\212-\214D\020(\227-\332b\322\305\261\350\003\264\034*\266?Ff1'\251D\376\024\203\214\315\242kta\005O{T\022\025\233G\344RC\323H$AqhH\311\214"
+	.string	"\211\001\271\314PL\"\211\216<I\2441\250\030\001\007f\213\034Z\"\335\241\"\242b\361\330\"\201\220CK\"d\023\003\367B B\374"
+	.string	"e\240\\\266 \241Y\fB\002%\225&Z\327\230\342gG\204#\022\005S\310eEP.[\220\300\024rw\363\207\3112\327f\353\032\231j\353\032\231E\343\322\335n\022\251\\j\300\3302](\032\227.\261]\272pw\226\305\r.\222\b9Tl]#\023\330\036\225(\214K\227m\211\214+\264CH %s\031T.[\220\360\223\242\331\272\306\024\032\370A\026m@\307\005j\217E\227\303\205@$\225H#\006\315\242b\223\b\311T!\364\343\"Y8&K\f\r)\231;,\214\314\364B \212\210\220CCJ\246\026\372q\221K\225\205\321E\332l\213\206\214+V\227\250\250\205\264Y4\272\306\023Md\213\022G\344r\310\002F\001\237\300%\340fQ\311t\021\2646\205\304\226\b\351.\225J\025\210@&N\224\330.\260Y\fJ\"S\034\215\255\220\036B\032]\335L\0261\231\355\n\345\016J\"S"
+	.ascii	"\335bP\022\311,V\360s4\246\315\242pm\262n\262Hi\"x\f6\223,\224"
+	.ascii	"G\016>nP\022\231D\032\211\332\024\315v\350\307\305ON\263hB\311"
+	.ascii	"t\021\204\201\250\250"
+	.ascii	"\231\272\311\"Q\332,\256h\217n\223E\201\242\205\343\220\262H"
+	.ascii	"\264\266\300\242M\026\211V\246qE\312t\001y!\020\032\004\235\310"
+	.ascii	")\262\027\002\341\376\0241\335\246\210f\261E\353\026\021a\320"
+	.ascii	"\300\217r\250X\\\335d\221\362\247Xd\231m\222\205\262Xd\233\314"
+	.ascii	"\266Y\224,\026\3671\211\324@\261\2706\223\310e\263Xd\223Jd\023"
+	.ascii	"9\324\026\213?\267\3506\221C:\027\002\321l\227.\\\017\216-\323"
+	.ascii	"(\324\364 D\323E\272\020\242(\031\344A\213\242$r\310\003\020"
+	.ascii	"B(\206 B\213\020\355\261h\350'\211\f\301l\026\205\030\301m\321"
+	.ascii	"&\207\214If\353&\221\305\243\261e\n\271\313b\221\303\212\226"
+	.ascii	"\271,\026W\267\211\034*\026W\243k<\026\213+\323(\364\243\333"
+	.ascii	"\027\220\315bq\325\300\217rH\273\310$\n.2\211\344I\226p4\266"
+	.ascii	"\314\225\351\262\360\223,*\301\350\032O\034\215m\n%\323\205\t"
+	.ascii	"\035\222%\f/\004\002\351\266h\231\355\3201i<\001\351\266hw\334"
+	.ascii	"$Pn\026\177\332\024&\220n\213\026\003\322m\321jW\304\210 f\t"
+	.ascii	"\r\374\030]\030\0322\376\004\233n\2136\350\026\333\037\344\212"
+	.ascii	"\366D\263\310\205`\263\310\205\264YD.[p[\264\373\330\266\313"
+	.ascii	"\246\352\026\033\200\202N\"YH6\177\3266\350HBP\022y4\266CA\344"
+	.ascii	"\262\2316\213&D\240\340\266h\367\217\bdz!\020\315\"\027:4\213"
+	.ascii	"(\334\026\355\260\331l\231\307\243\221mW\030\207Z(Z\022\355\242"
+	.ascii	"b\273t\241\242Y\344\302\257\205\n\240\366D\273t\241\302E&Q(\226"
+	.ascii	"@q\"\347B TP\201B\013!\3346\210it-p\233\255\253[\244p\221I\344"
+	.ascii	"Z\002\305\211\266Y\264\002\025-\240\205\253\002\025-\240\005"
+	.ascii	"S]\321\036\323v\310\370\323T\225\314\226\002J\246\213\240m\342"
+	.ascii	"D\t\0262\2600\2460q\002\310\266\314\"\327\310l\227D\255\033t"
+	.ascii	"/\004\242hITT2]\004\375\374\030C4\231\355\n$\363\030\200\266"
+	.ascii	"\230\342\003\022\037\204P\264$\332I*\221n\321\220\262\3312\201"
+	.ascii	"\315\242\206\266X\264$\n\256\356PQ\263M\221T\"\213\226D\031\332"
+	.ascii	"b2\b9d,\022\223A\310\241\022\305\027NH\241u\215)\332\342\020"
+	.ascii	"\005\026Zh\217J\024.\216\306\343\217\331\004*\n\005!\205\212"
+	.ascii	"@\313!!\320r\250\370\202\220\006D\214(\neh.\225\314\023\314\366"
+	.ascii	"\210\\\201<Q\264$\312q\213AF\025J$\033dT\201t[\220\340&Q(Z\022"
+	.ascii	"\r\333\"\261e\032Y\034\231B\367B \232B\256\221\210\b7\213\305"
+	.ascii	"%\320N\013$\3235\242`\022\225L\027A:Am\n\243k<\361\363c\004\256"
+	.ascii	"`E\004\335fqE{bE{\242\005\026F\246\206\241!\217{!\020J\246\213"
+	.ascii	"\240\020M\246\262\231l\233\020\020\213\212J\246\213\240\035\""
+	.string	"q\210\350\343\263#B\350\307U&\205/\234\320\272\306\024\355\320\222\310\330\302\317\2171\247m>@\251B\311t\021\364k\217J\024\256\222\311B\003\232\306\023\224L\027A\035\202\222\310 \023\206\214E'\332f\221\006\267\330\242=&\221\305\346\017\222\310\230tq,rP2]\004\r5\3204\242h\"[\224`\241\034\002b\266+\224:\315bK\204t\223E)\216\310\245P\3051\273\370I\266E\033h\231%\034\221Ka\0239\204t\301\350\266pD.9 Yh\026)\221+Z\346r\007\203\320\217\253\\\001\270#\024\241\301\375\025\025\211?\327\025\nB\266,\326f\221\370\201\013\331\307\205,\302\205\354c\314\"\214\331\247E\026\321\"\373\270\310\"\\\344\243\261h\003H\027\204?\021\307!\323eA\307m\026w\262\004\027C\313e\211\r,\214\023 b\266\3562\347\330\016\271`L\222\220\003\264T\001h\251\302\261\331"
+	.string	"\r@\313\0236\260\340\302E\25602M@\272I#\006\035\245kd\266C\355\317O\t\r\356\205z\200R\310\315\242\3162\205\214L!\037S\310n\262E\376 \201\200Z\245\211#rIL\"\215&\374\222H\243\tA\f\032\224H\327\230\"C{T\242p\231\355\262\005\t\356\020RER\371\002\222\251\024\342q\341\"\177\224C-\004Z\030\211\202+\222(\270I\244\222\205\b\354\264G%\n\023I\344\216[l>\240%B\272\273\371"
+	.ascii	"\267\304\261u\177Z\267=\321|\200\321u\203\315\007"
+	.string	"\2700\016\265'Z\"\244\n\035\267(b\204\233D\262\315\266e\006\265'\220?\355\211\tZ\327\230\302\005\263]\241\374iS`paB\006\"f\353\236\3309\016)\205\232-SH\305\006\026\306\t\b5\215\314\237\241\253\034\272m\023\005%\263}aC{T\242h\177\214)\206\332\025\355\320\320\270t\177@K\025\226E\307$\222\305\017\330.]\250 \0221[\027\251\003\004\244t\213L\374\030w\022i4\341\307\270\376\030Y\027I\204T\201\251d2I\3701\n\201\226*\374\030\325\244\022\351\376\264L\246\322\304qH\311\323\006%\215)\222H\024\307\237+\302]\006\233M\343\222\205R\0057\331\3760[\026\222H\024\307`\022i4A\311taB\022\211\342(L\"\215&\270I\244r\351\266-$\221(\216:>>\3562(\002h\251\302\216{!\020@!\222J\"\"\345O\004W.[f\bW\251d\206\bj"
+	.string	"7\213#\334eP\365\021\321\272F\267\271\216pY \036\333\027\220CF\244\213L\242"
+	.ascii	"\264T\241\203\206v\351BEP\022\371\303\344\341i\211\220*\216\306"
+	.ascii	"V\310\250\001\245R\205"
+	.string	"\236&\262E\211\240\"\027\332\023I\244\321\204\234v\005\322\375\301\320\272F\267\205&\262E\tf\233D\032\231*\224\314\037\243\006f\353\016!K\020&\221n1\004\0377\211,\332-\214(~\312e\013\022\332\025\314\"\023@K\025\222.\2169\355Q\211\002C;\024\224,\301\001\231\302\220\222\351&\225&\204~\222E\306\241\034\024\332f\221\216[\024\301M\"\213\330\026\306\2416\005\013\343\004\216\255kd\006\265n\022\231!\251D\272\306\027\220Lc\233D\252\3406\213\230B\356\216\233,R\022\225h]c3\331.\211\224&\334\036\027I\204T\301m\233@@\rh\207\\W\311\024R\321\036\225DL\244\021\202\244\022\351\"\233I#SE\004n[\274\217\217\t\013\036\260\202\t\373\007\304\021\271\f\341\n\005!\207\200B$\221F\242\020?\314f\b\020\034\202\222\310 #\263]QB\203\220\253T\022\265\300l]\027\311"
+	.ascii	"\016L\245\373c,\301m*\225\01382\215,\230J\240c\333\002m\030R"
+	.ascii	"*\027PT\377\023\257\f\313`-C\214\264\254\200\311\321\202%OL\225"
+	.ascii	"8\375\304\213\222\022*\252\333V\303\3532\343m\370\246\275\350"
+	.ascii	"\275\001\343\246\226S\003\307\f3m\331\211\305\2532b\305\026\354"
+	.ascii	"\312Bn\230\311\202\016\365\364\342z\224\2312d\223\275\232`\271"
+	.ascii	"\"e\b'\207\214\326\226\325Z\020\206\360\252)\315\\\024\342Q\260"
+	.ascii	"n\251I\206Z\237\236\201\004\t\227\264\350\017\016\226-2(_~H5"
+	.ascii	"\246$=\001BQ\325l\310\2359\001ry\303\305\365\242\201%\361\221"
+	.ascii	"dM\223\f\027\224;\203s\345,\003\031\352\201\001\343b\226&I\217"
+	.ascii	"l\275\371\362L\207@\323\\Y\222\365S\354}\237\304\025L\b\f\267"
+	.ascii	"\254\211cC\260\276\254\251\254\257\002\030Q\214\311\320)\250"
+	.ascii	"\006\f\027\274%@6\273\fM\020\035J\206T\302"
+	.string	"!K\332@\205\r\265r\244\350p\002\223$\230#\314\315\312\f\330\027\226'@\316\310\245G\240\204\20592|\361d\017\032ed\030$\363\255\351}\371\032\026YS\212\222\206\350\025d\262\200<\246.'\360\207\226\201\004\317I\221\241\324\235V\027\023\020 \304!z\036\210My\331\023r\342\220L%gL\017+Z\262&\006\311p\251\027\276!lT\210\332?\361\007\360\312\220,\215J\316\007.s\343\305\233\265\254\211<\264\034\322\333\214\254\237O7uNl\262&ji\021w\340\247\247\367\315\362UG\266\367R\325\360\360\023\271N\334\001\326\304\214[\326\304-\242\016\025`\354\237\230\325\343\303\036\2173,\240\233\227\034P\226dM\314A\264:\361\352\304\253L\274J\373\372\326\261/P\326*7xX^_\236W`|\311A5\354b\215\034\205\365\335\b\326"
+	.ascii	"\252\365\241)c#\330\224\263\203\352\215\332\024\020\251/\306"
+	.ascii	"\030\032\242\324\2115\362l\350\310\2215\021\212\030\225\304\031"
+	.ascii	"EL\326xF\312\274\221eMt\">\345\370p\252Q\371\243O{G\366\3064"
+	.ascii	"\305a\233\230\274\341AC\b\026\204\023d\254\215\351\267F\211\031"
+	.ascii	".\304"
+	.string	"\031\3028)\037F\236\020e\b\333V\252>/aY\023\227\210KA&,\242\300\336\270\342~\\e\375\024\364\210JD%\226jjk\213\220\210\033+-s\304$b\322\220\n\237\275N<b5\336\264\355\001\307\220\201y\313\372)\234\361\235\217x\204\317^\247\027\246\222P\205\3615\265\311e\375\023\215N<b\3335\242\310\035\311\232\370r\300\013]\230\254\207}\270\f\233\331\255\001\301o\251\222\335\030Z\326O\301\253M\233!\034+O2p{\031\316-\306\2327\037\302ac\343\242\342\254d=t\263\245F\315\220\215\006\276\340\223\215\215(k>d\263\331\020q\233K\341\005\036\336P\017\316T\022*-D\274\342\206y\037\352\261a\021\223\346+\353!\232[\031\302\3112R#\353a\364\fT\214\230a\231\260\350\320\353\313\024)2\037\226\301\023\276\220C\223%\353\341\2300;\273a\027\030\"Wso\214d}\006"
+	.ascii	"\341\302e\b&H\364}\251<\004\231X\t\"\344\313\207`\220j\304\310"
+	.ascii	"z\330eXG4\222\345\b\254\316\213pL\t\f\253\037\277786\304\350"
+	.ascii	"\362\016\r\003\207\233\257\032ss\303\256\236\375\216\201"
+	.string	"\371\021\315\301\262\303\233\312\372\fP\252\362*\3038\254\363D\252\333s\276/\225\007!\033yLC-\037\306\345\2341ii\223\365\360\3120\013\226\030eq\262\f\341\334v\3708\022\"\204\223#\317n\210%\315:\262\265\244K\326C+g\203;\233\022\215\262\261\r\337z\366;\346\004+\312\276\335Auq\373\360\r/'\214om*\353a\233\226)SZx\222\201\013\2432\346\245\215\224\265\257\005k\340\263\327\211\305\031\330\333\326\262\341\026#\353\243\360l\322d\250\206\345\3517\206vfM\332\207j\251\027\034h8\262\036\242\r\241\260o\272\304\310\203\362d\253\206\221R\323\324\227R\236\223\374\002\227\351p\353C\301\313\310\207fF\206]\372\312\373*\341\263\327\351\351]\262\362@d\223e\215\215\254\207\317a\226\221\221$Y\017\225\f\311\206e\001\215\200\250\264D\221U\2473\262(\206\002)\006:\345\224)\252\332\006"
+	.string	"S\025"
+	.string	"0`@ \221\212\205I\226\017\024\200\fW\256\210~\\\035\317\264(\251\224bDD\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\001\024i&\301o,J\365\340\242\304\203\322J\201\233 \263E<\326\024\030\023\t\276\244-\017\224\246:\274Gt\330\247\334\341\002\272A\261\024\021\261\217\237\217\354I`s\232P@v\222\343\007/\372\370\372\225\013\354].\307|m@=:d\323\025k\212>\224\311\267\016H\307\220\333\305\232\177\213\004\036b\225\002\214\246\300!"
+	.string	"\221g\2650\215\350\037\261!\214cI\245\206tl{A=\rmb\332X\342\322\273y\001w\211C\202L~\272\262Tu\333\023\\]\262\200\256\025\355\254\377\261\370\333\227<H\332{\370\231Ny\322\257+\0079S\3148\237G\352.k\316?\326\251a\227\334\263\rLU\315\224\210`\036c\200\227\366\024\262\326\315.\027\306a^\320\223\266\301\263\005L\361\227q\242\327+\300\211\320\035\016+\b\307\331\377i\301D\240\220\331r@\310+\306\217\203\240\344\006\225\334J|\247D\206\230xT\334]\341\234\261\241O\321`)V\310\035G,\304-1\025=\017\302V\264\334\361\246B\242\b\026\205\223E\367E\273\2769\234\23714z\227\236\227\252\243\274\023BV\b\216\251\240\026\025\250\221\222n\210Z\231\225\215\\\310\2125\306\222\335"
+	.string	"yy|"
+	.string	"\020H\273\272\031Q\215\270\305\233r.\276\026\232\335\270\305\344%\343;\361q$\214\302\3339\256p\366\250n\225K\032U\360\364\230\3045\0016\3140\317\233\270\326\244\303\2546\2179\266q\2617\215\237\232\231!m\366i\332\035\252l\307\251\362@\257\256\f&\346\025x\017X\332;\240(8\3319Y\235\031\234\355\035LK\017\351\236d\231?\323Y\313\261c\304Px\321\013\037h\273\221\345me]\023\013.\022n\311\242XW(\357\277 H\n_\346e\334\2021\260\373\225"
+	.ascii	"\243&\377,\337\034\327kYb\224gC\376\275\265;\234\035Kr*/\366"
+	.ascii	"\3529\353SS\353\346\271\375\356\341en\352\371\336\277]\262\236"
+	.ascii	"\306\313\301\030M r\253r\211\003\021\001{Py_\351\243\007\206"
+	.ascii	"f3\035\230\272E[\361\227\206R\211Tp)\310a\005kbV\330\323Rag\200"
+	.ascii	"\263P\257"
+	.string	"\336\304\277\b`\013\321\371~\021]\201\323#\206\036\214\331k@\232\007+\240'\022\222\247pe\244u\021\2109\310j\216\277#\017\206\230\035\305G$\0040\346\224\023\006\225;\025\272\013\n\001Pr-\336\351\247\206:\021\323h\202\210+\231X\233\232\275\206\037\306\337\\\362\\%\0025\211\255}\035\317\370\031\3739\232k\223\257\255:\f\232\242\204\360!\320\350\322bb_e.a\\\030\355\204\216\241+\033hrR\333\314\236\361t\360\265[\236\322\026\207\003L\334\221|}b\274\347L\3027\177\354\177H\251\022\203\016\331hVu7.\020 \207\237\2439\207\322v\222p\224\027\3457\3202\375\347b&\232\207\321UR\261\265t\257\322\031]\271\307B\332/Q\325\241\034\204d\254V\311\261A\205\b\256\032\211.\245\030\016\241^E\376}c\026S\342\270_\353\324\276H\232\340\3560'\366\336\335\221_. \037\344u"
+	.ascii	"J\277\214\021\262Pni\376[ b\002kc\322\367\220R&y\242\320\314"
+	.ascii	"\322|\261\204M\365\312\300\344v\274\216j\314\336\2641\214\343"
+	.ascii	" \302\277\351y\236\240\321c\276\350._@\214\272\354\303=@\307"
+	.ascii	"\2258f\310!P\201\2557\215\342\016QH\334\f\362\317K\264tU\361"
+	.ascii	"\236\235\210\365\217(\323\240\316P\266\003\231w\023\265\327\034"
+	.ascii	"\351\003p\t\031\3373\313\314K\b\312\017\017\223\270\215@\235"
+	.ascii	"\271k\032\376\034Na\020\333\223\205\242D\214=\306\234:\240\232"
+	.ascii	"\245\274\246\332\221\263a\022@A&\002\200'\325*\353e\235\353E"
+	.ascii	"d\323\310\177\255<\224>\351\326\335!\325\237\272\232\223\312"
+	.ascii	"\216\242\205\3003\244\030]\326Kl.\205N\230=\034\261e\207'\240"
+	.ascii	"\213\371U\n\031\265I\340\257F\020\273V\t\336\007\027\304s"
+	.ascii	";<E\214 h\303Tp\360\005Z\340mb&\276w\027a\036c\271\215w\242\333"
+	.ascii	"\316\374&\313A\324!/\313\323\003\2304\021\214\375\346\373)f\347"
+	.ascii	"F\365\022m\031\250\251@s\322\347\2744\b\225\330\024\233\242\206"
+	.ascii	"\004\240y\323D\264\026FS\343\246\274st\nsb:[l\230[y\223\226\271"
+	.ascii	"o\247g\023\320\374\356\003Z!'4]u\025\370\033\377+\220\271\006"
+	.ascii	"6HI\001\220\337\037\311\371\264F\324\322\205\271tvp\247\020]"
+	.ascii	"\312\353\227\314>\253\325\202tB\026\250\227\b\237A\266\020[\210"
+	.ascii	"O+\314\f\300\016\340\223\370`\323\r-\255@\242\013\313\3663\210"
+	.ascii	"\320/~\353"
+	.string	"\301p\325k\265zO\007\023,cn\313\362\006\257,\3636\206\035Uso!\344{\016\272\254\257\224\272L\007s\036\2635\255\261=o\201\212\bTB&\272\203\222\177\347\r\321\233\036(\201\234\034\240M\033\221\341\325\227S\272\260\242ru\274\030\n\1776*k\255\026\n\304aG\016y\030\307\340\206\353\024\262\ra T\325I\242d\034\301IT.\353jq\367\254!\235\304EN\301b\270U\026\365\263\034\016\367\303\317\211U\263\n\031\310c\253r\262c\006\004\357\020\027c_\246>H\272\033S\234\360\360\202\344\343\222\331oL_}\021\212\352P\204\332\b\2268\003\355o\r\030\206@\326\203P\204\217\321\222\322\263G\211\336\013\360 $c\302\323\252\262\345f3\260e\300\235\364\372hb\321\236\245uPW\001[\035g\341\244\352\362\374J\312\273G\331\215\007;9\332\246@D\t\213U\267\271@\300V\027'\376\346"
+	.string	"\262\240\313gB\031J\t\017\210\254H\327\221\251\235\022{\210\265\210\005V\322;\270\2632\277J\354LIf\326!\274I~w\031}\371\024\356\214RF\203\276uM/q[:\300\317\020 e\252O\222\022\355\2129\262\346\264A(\354U\260\303\240Vg\320\346Y\203{2a\223\376\b\354\"\302N\257s\330\2158h\261\366\221\213J\t\200\n7me\375\221S_(X\246\246{\252d\254|\376$V\324r\320\320p\3136{\251\201\001\340\271;:]6\333-Z\303\001\005GR\357\232\327\372X\215\211\311\224\355\277\246\246\217@:\206\374Ul\277\"A\373\220\263\234\265\320\024A\363\250\277\327YA\367\276\226[L\341a2\3673-\002\t\340\302\342}\305\366\227\r\221\027"
+	.string	"R\342\312j\313\261\236\"\003\276\364g(\221\307\342eF\316\021\303\315\253\016\324Z\317\260\216$\317\346\326H\367w4\035\232\321\324\346J\263\370\243\021d\337q\314\251\210n\257\301\247i\376 \2164\233j\236\316\233\205v\235\232\031\033\013\f\n4\323^C\037~)\237NCp\372\315\017\310\177\312\272U\315\212\251d\304\001\355\262tD\234w}A\276\335\254\226\262\276\273\347\"\342\f\2753\260\300)\372b\244i\236\262m\261i\376\230\004\325\r\277\330\261\245\r\032\350\242b5\177\211\013\203\rV\310\243\217\246>&.)\006\366\212I\033\265\275\002\353\352\375\314\215F\304\312\324\342U8\n!\300!(R\022\274\tt\321\366\352\324l\361\312\223d'\027\222\317Z\207=\255\225\257|a\223#\372\036E"
+	.string	"\177}\250w\347\270\360\226k\"\377pm\036-\240=\t\023\323\266\354?\225\275\311\b\364,R0\231H\264\232N\276\245\336\034\"x\036\245\210o\313\016\227\321\225J\203Q\200\256\230\312\325J\"\377v\002D\370bR\372\356D\256\245i\364\223\320\035\205\262\276\225N.\f\230 \225{\211\350\201\030\013+\001\020QdW11~\\\203\263\237\036\247-[\240j\007p]\347\343\315\335P\341%\bL\024\203\356\236\312\263\030\341\252\254 h\246n,\023E\310\201\247\ba\344Q\371\300\334:z\022\223\353\357\245^*Z\276\031S\276\206\331\304\255\340,\251\263X\315\327\261\2523e\350Z\205\020D\020\347"
+	.string	"\005\326\273O\307Sd\373\347~*\245\362e\336\037\255>\261\027\350$B\234A\200\377\271-\001\362\246H\376-\277\355\230NpaC4\370\006W\244\032\340}F\372\r\356\350\036\225\230\352\030,\240\326#\364\235*\311\021\241\035*\211I\202\266*\300\314\316\227O\2457\204(\206\303\034\227jc]\320\213\013:\212`h\254i\304d\016S\230\374\365\351\362\255\201\323\016\321\323\222\323\203S0\337j^uM\375v\210pA\003\032\023`r\223X_\222\001m"
+	.string	"\310\220]rz0 <\033\203X\213\355\276\022\006\023\223\253\230\240\020\336\036\267)\314\\\221\217F\202\304W\234\364\0214\225Kf\231\340\244\372\255\374X9\267\245\253\221^\331J9!7\244\016%\373Bt]\363v\032\342\336\227kGG\373\245k=\247\207\003+\351\264M0\357\251H\307M-\037?\341\fB("
+	.ascii	"\n\261w\314c\036\t\307\307\226\371Q\221\003d\336\r&i@\206\201"
+	.ascii	"\003\274=\377\224\025!\276:i\020C\336\325\020\230\270\332T\350"
+	.ascii	"\357\365\251\t!!OC\220\227\311UR\006\266\001\245Y\374\307\312"
+	.ascii	"\221o\327\257p\262P\216B\200\231\022;\373\260\0039{\323\234+"
+	.ascii	"\204z"
+	.string	"\301t\222\334Q\226\033\007\234?q\324*I\264\253;\251<%9h\\\365\241\030T\246\304\257\373\0370_\303M\216\036\240\267\246\3448\3431\204\303;h\2627\304\203\3208\276\221Z\026\332FR\232\203.\2120\nh6lc\250\235-2\335H\020\241t\234p?J_\030\t\026~\230\342\302\213\260`}\"}\335A\254\026\254\3205\226\353\005\261\261UA\306\335;\342\206\rm\233\3527\316\2655\025;\312fq\310\244,\320\217\2672\325\357<\017\2179\374x\003\221@\022C\200M\337\371\002\366\002\f\242\241\2252\256\217\325\223\"\363y\344\306\031~\351\252P\205C\225N|7\306\272s\023;\221WKi\2227Pa\374\354U\005\265\256\334\026\352*\223\236\314.\341\034\310Z\336\232\330\314\n\005!\341\206\313\036sO\221)>\353\202\216\022\373qs\256\307y&\350.\312`q\201>\214$\246\322'\220\351\257"
+	.ascii	"\345B\337$\307~<\347\243\025B\330\215T;%3\026\253\001gd<\355"
+	.ascii	"\021b\316\237\314\322\201^C\367\315W\216\034al\023\330\317\377"
+	.ascii	"\3013-9\032\376<\021\200\230\365m\324\307[\026\373\210\2236\233"
+	.ascii	"\240\016\343M\210\202\244\257w:\212\370z-\"\342\253\017\\\332"
+	.ascii	"\232\217tz\272\246\214\272\034|\264\357\t\344\270\2312\374\275"
+	.ascii	"\221]s\002%\b\353\233\006\354\343Z\005:\n\207\027G\301\354\265"
+	.ascii	"\216\261}O\330\362o\367~\037\263\036_ \216oh\242\344\315\304"
+	.ascii	"\347\213>\006x\r=\262\347-\021\001f9\032\324\264Lw\226'\242\266"
+	.ascii	"\343t\256,o\350m\201<\321Z\350\355\252\207(\342<\022\252\352"
+	.ascii	"\341\223\205B\216\342\365\245Y\030\331\013}\353\362\005\017W"
+	.ascii	"\330\026\232\350\233\303\362\262\023T\032+!\352\342\314dl8^Q"
+	.ascii	"\023RY\333\357\231\362\374Q\006\310\206\242P\301\256!\2205\270"
+	.ascii	"\350Zq\326\270\366(\016S\212X\034\211\311\274h\227\364\027\005"
+	.ascii	"U\324\347Oq\306\261\201\271\025E\310\005F\211+\244\0044\243\242"
+	.ascii	"\361\007`j\027\337\036l\306\351\321\236D\257G\241es \270\245"
+	.ascii	"\335\224\276\373\351\013\202m\336\030U\264\204\037\263\207\027"
+	.ascii	"\003\364\001\351\315\177\251qT:\177\271\370k\0162\203D\373\003"
+	.ascii	"uQ\032\034"
+	.string	"\256\024b\007E\212GE\341\371\373(\214\r^\035/\337E~\303\306\336\371\312\243\337\336\035\013h\220\177[\001v\355>*\030\001 \237\006\315$t\260\367b}\352\t\371\230\261F\201\335\216\257\317\336/\357\034\315@\303\221nl\273\221\330\234\321~\316\270\206Y2\2175H\233\304E\004\266\272\273\301\001\356\347k\274\035\232"
+	.string	"\376\264\343\207"
+	.string	"\372\tV\345\320_n&,s\350\034\371\263N\035\004\177[\271+p\330=4$\200\016/\247=\336H"
+	.ascii	"\351\246\r\375\346}3\212\263\273\031\305\027\215\t2\002\003\213"
+	.ascii	"+\377\371\225\374\333\335\031\254\274\"G\224\262\3158\325/^P"
+	.ascii	"\262l\\\341Z\354\302y\316\321~\226\276\004>\251G\276\036\244"
+	.ascii	"\344t\3337\341@P\257\025\241\024u\372\027\347;\203J\r\2574\261"
+	.ascii	"\272\tA\bQBt\375i\221i\377RU\230\t\264\"0\312\300G\327\201\022"
+	.ascii	"\244,R\316\236\314\255YK\304\251\2365`<\003t\240\031L\220j\013"
+	.ascii	"~0Y\255\316\257\253pV\027B\2615\3617@xe\2013\361\\h\2436\tN\036"
+	.ascii	"T)\177@\347\\\366w\206\324\263\240\177\215\005@\326W+\377\234"
+	.ascii	"a\016\210\310\247\207\2123w\271\0266\032\233%y.\033\206\204\337"
+	.ascii	"\222\016\250\200C\207vu!\323I\354\2102/4\373\355\336\024\302"
+	.ascii	"O\352;\235\362@n\342\030\306\253O\021\2714\345T\276f\201t\216"
+	.ascii	"I7y\022\262B\207\223\307\026e\224v\316Rj\032YX_TT\241\272f\001"
+	.ascii	"_R>\206\002Q\343\272\300\262t\003(C\t\020d\267\351\016\306\267"
+	.ascii	"\262%\030\332\257~a\013\364\364\327\2147n\035\210\002l\216\354"
+	.ascii	">\245\030\026\003\204\366\013\003\277\350\332tc\260\233/\233"
+	.ascii	"\2239\226\n\232\352\n\005\272\307\366<\335\233y\233\360\352I"
+	.ascii	"{R\005\253\321\325~\017"
+	.string	"\322\254M\356\263\276\344\001]\341\006\273\003F)\"Kub\217\353\006\302j\234\376\253\3735\234\233\034\3000\205\271\317!:yn\212 \0029\341<\372M.S\247V\373\271\246\342\256?\016\371W\006\032\332Nh\342AK\3773\274Y\251\335\204H9\370\n\001J\220\225CA\350\315q\016gN\270\266T\302j\245\256N!\261\321\371\021\236w\361\314\356\313|\330?8\305\\Xd4\306\346\253\003\226h\027\252C\255G\217X4>t\346\036$D\0237\362\302T\365?\277\273;\230\206=\267\377\325\313\235\322\242\376\301r\271\270\036<\374\300\027r>\234\214\300\377\306\302J[\354Bv\301x\363]A\003Y\224\215~{Q\254j\265\020o\3122\317wx\313\275\347\337r\342\262o\277<\200\354a<+V}\275\340\357E\247\367R\001~\246\366\361%\220@\331\325\322Kz\316\f\225\016\243C.%\356\005\372\277\032"
+	.ascii	"\326\361d\007\331\034\325\330w\233\213QA\325\301\305\310\013"
+	.ascii	"[\035\352!#3\264f\362\2076\020\223\347\320\275\316\001}6\203"
+	.ascii	"\261R\214\364\270\"\006M\366\240GLG\020 \206!X$@\252\222\353"
+	.ascii	"X\320g\302\263g\n\214k\303Kg\354W\357g\315\333\361G\210\252P"
+	.ascii	"\342\362\377\331\320\021\345\304\326\256\025h:\200\330\220b\327"
+	.ascii	"\346\344\200\207Z\033E\016\332\261R\264\324\016\343\202\202\226"
+	.ascii	"K0\0374\364\254\017\f\005\b{\320H\234\204N\007\244\025\337w\343"
+	.ascii	"\214\325\307\367\n\331\033N\322\f1\177\373G}\273\305"
+	.string	"\252\342x\235\226\001u\016u\037vX\322zk\211}L/c\0137\260\242O\352q\244\336\200\026\205\323\233\347\207\036\314\251_,\2265\216\301n\032\310Z\335\241\177f\224<je\026&\314[\277dc\312L-\030_m\247\f\217\300\220\243H\331\253\214\344\300\306X\200\216L\213\036\265\257\375=\256S\264k6\027\362v\027`\312R\213\240ez\005y\211T\253\350\347^\311\354 \375ug/\323\200)\340_x(\n4\213F\260\211\324\276Z\032\323\362\221\024\265\305\0275E\225\035|\035\363\222\f\320\220\037}\335\315\220\347\274\257d\222\361:|xws\236b\340\371\201\3654R;\326\325*s\237\257*:}\276\"\357\337M~\313\030\264\351\207DD\333\003\002, \227\353\263xP\357=\363i%\366E\322\b\266\223E\301\333=9[C\243\230\264\024G\323\033\223ME\276\256\251\200M\206\274\275\026\320\006\367"
+	.string	"(b\366\205*I\205u9>r^\207\037\237\327\213\013\025\261*\032\372"
+	.string	"\005\3308\\\335\336\334;\213$AY\345\022\002c"
+	.string	"Gc*m\276<NF`uxxD\001\255\333\306.\372^V-"
+	.ascii	"\030\325o\bc\013#\237\3744\264\024\227\215j~\031\007EQ\035\t"
+	.ascii	"\025\300#ar\034uc\227\266"
+	.string	"1\305\2605\240\036\026Bw9\205J\342\360\034B\254\001\005\031\3413\340\007\036\227u\306\243\253\242\021\323q\366z\317\027xm,\t\213\301Z\201\242\223^W\340<\337g&)\203\334\245\ny\030\203\235\327\305\372\026\"\3638\266k\202y\273\375\326*\372Z>\226Pz\207\262\246\302\215Na\013\233\312\004\314q(\277J\345O\f5\337\310T4\250p\266w\216y\310;\034\326;\372\242\336\377\2137\306\255\025%\035Gj \302\317\241\r\227<-\262F\253QL'&\203\\mp\f\274\316C\275\267\0130\313\256\211:\372\353s~\331\215\256\336\314f\330U\302+>K\251>g\340l\313v\323\037`\371\244\017\252DE\351Iv\036\206l9^:h\313V\370\276a\245N\f\346`\342\227.\037L\2012\354\217\t\225HZ9\216\256\204\022\312\314\356f8\345^\267?\225h\242cg\031\3201\003\300m\002\362"
+	.string	"\252%M%\260)p\3531P3]\264\344\243\274+\267(VD\035*\324\206\227\3010:Xz\274\267(\271 \202jd\002\333\035\244J`\323X\237j_X\250\3547\276\270\bzW$$\372\021\033\277\312l\036\345\226V\026\344U\002\226\361\bM\256\325\206\030\331\027\373\200\037`\275\337\315M\360 \200C\375\0011\234\022\222!\213\242uXE\364\376\321\203\271\362C\355\355J\037\036p\023\266\354D\272*iu~_\343v\261"
+	.string	"\363M\032\020\230\326\373\203\222\247*\375\005f\352\356\031I\304<s\331\353Q\273[\312\375\b\363\340??B,\333Z4\020\256\212\020\274\360 \t62F5\273\236\357n\360\207b\212\r\213!|\203j=\312|\270,\363\361\276t\t\355\243\257\232\311\324%__m\314`\347t\375\234\024\026H#\365\334r\030j\256\232a\364{N\357~#\264D\030\361\322\345\230\031\032\222`\256\224`L\277d\232\307\031\026\333\370\r\3430\304\r\376\250\321\3009P\346\272\316(\320\031\232\231\243E\024"
+	.ascii	"\330\263\f\371\nd\3438\356\b2\002:\"8\245_\202\006\222J\352\331"
+	.ascii	"G\373\353G\005\205\005\216M\325,mz\303\373\312n\215\271b\313"
+	.ascii	"\236\356\333\221w\307C\214\351\364T\031\f\377\2233v\361\365\234"
+	.ascii	"\307\331\2346\347X\223\272u\\\356\016\264\036z\036(/:.\237&\301"
+	.ascii	"\201VQ]\376p\r2\323<t\277\0316e\022\253\337p~\222\322\372\371"
+	.ascii	"\002@\250O\345.\226\017J\237d\225\244\320\337,\352\262b{[g\240"
+	.ascii	"\220\262\353\247$\232\350zcS\341U#O\313s0^1\214\327\251\344\277"
+	.ascii	"\237\342\002\254\252\262m\367\3476<\240d\205^R\b\232\3510\246"
+	.ascii	"\217\244\207\3126)\212\232"
+	.string	"`\217\306M\025%\tq\n\253\211\310\362\001\310\343\300M\236\363)\237]v\322\234\250\340\023\016x\027O\313#<\032\036\035n\375\372\236\354Q\235\r\336-\365%\263Hb\300\362\262\354p_\366\347pd\327G\324\304\2701\247\266|\224\3262$\017/\246\300\372\371\242\331]\032\272GR\335o\251\272U\351\301q\277m\326\267\220Z\204\201\322\r\356d_\177\210@u5\022\b6N"
+	.string	"\005\277\224h\273\214H\213\344\304V\020\356\241\365\271R\264\305\343\332\336\202\215\030\300\310Q\344\240\341\365o\303 h-\r(hk\023\266\310\223#\263cA;\206\351\262\331\2630\037x9r\216$U!nQs\342\341Y>\2108\243\036_\237\220\232y\223:r\007n\307\006^OUC\241\314+=\205\340\027\325\t\277\013\271\333\3412b\"=\237\274,\304\003zs\270c6TK+\376\316\020\256\230\236<\034\217u\342\241\260\366\326F\375\301\203\344\223\215\357\254C8g\303B1@g\347m\177A\300l\033\032T\020{\213m\275\020\033\\%K\244\353\344\363,\204\265L\006\346\364(q"
+	.ascii	"\216\247f&\233f\207}\345\033\317b\244\206\244\272\027\034rEj"
+	.ascii	"\225\001\227OL\221\317\033\373\362\020&=\364\036\n\264\265\003"
+	.ascii	"\220>}s\334\037ZaTj\3551\257\002\243\274|H\223\353;\371\234G"
+	.ascii	"\317v\373\223\341\373\342\253\366S\224\030\350\021\020r\301\210"
+	.ascii	"\301\325\271D\302t\260\333\204\317\260\002<\rN\277\021\240\247"
+	.ascii	"\031tD\021\237t\006=\235Jh\231\213\272\341\"\324r0\230Y\324\004"
+	.ascii	"Q\253T\034PP\261T\355\347^i\274\300'\334&\307\367\003\231y\325"
+	.ascii	"\237q\340\220\017\\\247\373\237\242\226\237\303P\204\\\230\r"
+	.ascii	"$\201:N\227\257\304\254\374a\232W\212\277\266\027\303N\321\222"
+	.ascii	"g\375F\fuq*\266\265+h\225\031\360\361\203\234\347F`\342'i\234"
+	.ascii	"[\326\f\223\2736\234\250+\237\325\032Y\244\361N}\224G\332zr\b"
+	.ascii	"\311\262\251\341\303,vo\213E\2432I\201\223(\032\021\0270\364"
+	.ascii	"Ik\263d\261\330\245\t\311R\326\231\314\264\346;$\251a\2502\031"
+	.ascii	"\345\260\205\340\333\251(dpU9\2563hs\024(\202\313\230H\037S\025"
+	.ascii	"\252w\254\370p\262\305\333\251:\246zB\2206\237\016\322\376-\023"
+	.ascii	"\371\226Ln!\350h\bp\224\f3m\235YD\370,\tw\226\320\301\355\005"
+	.ascii	"+\337\017p\203\237\374B\252h\n\372\320\035x\024\2406\273\335"
+	.ascii	"\r\222\037\027\023\305\354\253aj\032\313\346\216\ngg\231\r\253"
+	.ascii	"n$\245\006\0378\2726gp\032\024T8\022\261\017`[\262\004U\226\227"
+	.ascii	"\300\231\261\330\017a)\032{?qK2\001\027\034\264\3216\315tb\037"
+	.ascii	"\246\177\tY\311\033\363\b\036\"x\252=\312\307\211\272\030\003"
+	.ascii	"\370b8\021\031\306\350\362\r\255F\r\277nE\214\312)\370\363\276"
+	.ascii	"\224\300\275\346d\310\320C\245\023\313\237{\321\2403zFts\272"
+	.ascii	"Y\316>\2360\2215\235\243Xa\305\013>a\345\261aA#\354\rx"
+	.string	"(\377J\246\003\3733\212\333\301\204t\336\303\266/Y\300\013\204\377\372\246c\250OM\277\366^G\226\265o\261\332\275R\365\361@,\nff\203\213$\365\"\031\232\250\013\365\347\311`\254p\325\001C\013H\214\264\305[\204\210\\\302:l@:\217+\350\202\270\320\224\200\017\363\027Is\f\206\356|\342\270\236SA\323u\304\002\253\337\203\\^]\f\235Q\002\220B\017\343\232Lr\027\247\247\377\267hA\006\374\262\211\361\006\027\020\332\013\317SA\3626(\n*\3042\263\253R\352\357x\244\0017\221\277\370(Z\t\026\326n \b\255\337\177\341\021z\2367\376\307\0322\324\234d\3166\233\362\"\033\007\330\301L\342\233\234\211f^\271P\233\311\037B9\261\265A\353gf\370\213\200e\006P(&\347\275\260\212*\360\366\356Wj\202\017U\273\212\341\005r\247\333v\312\314\365\227\226#B\210?0$\336\305\321\362L"
+	.string	"Os\003a\365B\273\225\361\245\r`\211\343\030[\202\031\370_\3230\264@a\350?\"\264?\334}\224X\b\240\246\032\025\241\035\026&` \261\004\250\365\334\231\202\276V\216\325\334\033\"8:w\"'\b\266+\203\"\030W8I\244\243\332\343\262\375\022b\353\246\305\357\342>{\215\242\242\210\372\332\n\242\357\252m\262\373\222\032\345\330!\347<\236\f~\204\013\017\246kd\3149\031\336\214\324\233(\364\271\246,\220\217\304\n\200\316~\352w\350\351\340\235\374\006\257\336\316\245\004\364\302\fN\325\0072u\021\f\262\217c\247"
+	.ascii	"\237\020{\201\310\234\231\017K\246\237\033\272\022|\335X\327"
+	.ascii	"\356\213\002\313\376\t\301\233\\\310\232\214\226\256\020\365"
+	.ascii	"\376t:#\203\306\"\224\347\026r<\316\370\006?\374Zy\305f\313\373"
+	.ascii	"l\212\377\034\275\267\337YF\315v\004\243\227\322\352;\365\311"
+	.ascii	"\033\203{\357\367SR\361>Q\270\336\007\311\217\334}\3704\300\337"
+	.ascii	"\341culp\325\244\032\220/o^\203\213Y:\227\202\\~\341\213\260"
+	.ascii	"\314\276\363\354\277\214P\303Z\3644\315\007\020\375\017F\026"
+	.ascii	"\365\035V\"\226\3276N&C\207~\371rT~~\217\225;\025x\244\203G"
+	.string	"$\017\0363_\177\002\257\0173<\244\3002\304/\216\f\001\341\367bOX_\323\305\351\367ti\266\377\204\335[\"_\321\356\366\264\277\336\210W\202\342^Auqe\234uM\372\366\234\204\214_\256\371\330\036uu\351\336<\211\373.\337X'\350\217\321\037\376\357\372\363\330Ao5\t]l\007\247\215\334>\324K\356h9\263\332\303Y\333\306\320}\0236\0361\251\016&\340AC\356wp\316,\273\007\033\336;Hx\227\307\270\216\353\024l\235\356\314\357\351eC\333\35193\356\256\226\374g\231\227iW\300v\b\313_0\362\310\"\332\024<\342\340\317\370\322Fd#\004\207\360\355\357'\207\204O\316\031n\0059\006G\375\332\321\304\267\250\267\235B\213\t\361\270R\305\177\275:\033>d8\361\022\177^\320\307\221-\3437\212\377 \375\b\374\335z\033w\267&[}o>\217\251\276\335\377\256dqYW\212\343`"
+	.string	"b+\260*s\350\030\004\2365enE\371\240\301\rc\200\303N:M./\352t\323\244\363S\307.\021\177\217\370\032\234w42\310\354\330\252\327\260|\026\003\355\255\352\020\300fw\364\302\037\317\361b\272\365\nF\345@\366\270\337ut\365\312\0311\301\377\246`\262\274\365o\b\341\311\001\362\243\370}\251\250\375\365\363\037\005\255\017C`\021\320\303B\367\263\226%\236\347\225~\310u7\345q\374\037+\342\302\226\336+\371\255\254\347r\350\3660\317\355\371}-\366\316Dq\325\366\242\240\263\222\315\337\347\254Ss\322\247\320^V\035\325\332\276\212\360\236u\335\303p\231&|W\253\001\025 \007\232-\233:n\177\303\375\316{\344\232m\205C\300\374x\361\242\370\245\347;?\007,\375\031\227j\214\363`E\017\220\307&:\340t_\355-\365\334\265\315\013\203\251\332\257\200\272\204\211Z\345\201\323=\362~\233\250\351"
+	.string	"\0178\376\007+\271|\323\017g\034\005\364\003\352\263<\264\310\2309\256\276\364\343:\327\034\005y\265\n\214\244S\257\021\301\315\330}x\250\232\277@\323J\363"
+	.ascii	"^\374\267A\354D\247\323\230\342\3311{\021EC\304\234\264\366\326"
+	.ascii	"L\311\370\256\027q\274\324b\232"
+	.ascii	"$\357#\032\347u+\3358\341h<\036H\360\320?"
+	.text
+	.section	.gnu.lto_.symtab.5fa3d52826d3641,"e",@progbits
+	.string	"pidRuntime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\005"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\005"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\005"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\005"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\005"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\005"
+	.string	""
+	.string	"pidGetFeedforwardTransitionFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\005"
+	.string	""
+	.string	"pidGetFeedforwardSmoothFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\005"
+	.string	""
+	.string	"pidGetFeedforwardJitterFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\005"
+	.string	""
+	.string	"pidGetFeedforwardBoostFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\005"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\005"
+	.string	""
+	.string	"pidUpdateTpaFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\005"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\005"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\005"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\005"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"applyRcSmoothingFeedforwardFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\005"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\005"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\005"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\005"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\005"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\005"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\005"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\005"
+	.string	""
+	.string	"dynLpfCutoffFreq"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\005"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\005"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\005"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\005"
+	.string	""
+	.string	"pidGetPidFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\005"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\006"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\006"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\006"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\006"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\006"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\006"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\005"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\005"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\006"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\006"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\006"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"pt3FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\006"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\006"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\006"
+	.string	""
+	.string	"pt2FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\006"
+	.string	""
+	.string	"pt2FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\006"
+	.string	""
+	.string	"pt3FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\006"
+	.string	""
+	.string	"pt3FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\006"
+	.string	""
+	.string	"applyFeedforwardLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"shouldApplyFeedforwardLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\006"
+	.string	""
+	.string	"pt2FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"feedforwardApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007"
+	.string	""
+	.string	"getShouldUpdateFeedforward"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\007"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\007"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5fa3d52826d3641,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1561 @@
+	.file	"pid_init.c"
+	.section	.gnu.lto_.profile.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\224\002\235\b"
+	.string	"t\007\210\003"
+	.string	"\013"
+	.string	"\322\341\263\335\f\006\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\223\202\274\275\004r\002\003\002\004\005\002\002\005\006\005\006\013\336\274\333\252\007\f\r\314\301\266\263\013"
+	.string	"\017\356\317\327\376\b\n\005\002\002\020\226\305\261\362\n\007\002\002\021\221\271\372\277\005"
+	.string	"\022\237\365\232\341\f\220\004\003\006\006\003\b\006\006\001\007\001\001\003\004\004\007\t\007\002\002\024\240\310\353\210\017\n\026\262\221\246\274\017"
+	.string	""
+	.string	"b\250\301\276 \005)l\214\001\340\002)\262\315\001\022\200\244$\fh\312\321$\306\226\375\r\370b\373\251O\r57[\006\027\366\f\312\277\323\233hKe?\034\334Ab\177G\036!\362`\030jG\277\301\240`\352Y\333\210\355.\273V\021[Z\336z\345\341\341\303\036\372\234\203#9IT\217S\251\350"
+	.ascii	"uew\007\304\333\335\324\314\373y\322N\2441.\016\320_\355\367"
+	.ascii	"\267\240\263\376\3052\374\237\327[\033\212;O\373\007=\3729\336"
+	.ascii	"\375S\303\255\233\n\311\351\351\373L\371Wz:\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\375\003"
+	.string	"\324\003\023\001"
+	.string	"\013"
+	.string	"\001\003\001\002\002\013\002\003\004\002\001\006\002\001"
+	.string	""
+	.string	"\004\013\001\002\001\f\r\002\001\003\001\017\001"
+	.string	"\b"
+	.string	"\007\001\001\001\200\004"
+	.string	""
+	.string	"\t\020\002\001\021\022\004\024\t\026\002\001"
+	.string	""
+	.string	"\001"
+	.string	"\035"
+	.string	" \204\023\026{\266\200\027\202\300\307\263\305S~`1\314\267)\213E\255XJ@pW\252\001T\203e\210"
+	.string	"\002l\343\361\216\027\253j\031(\006 "
+	.ascii	"\203\026\b;\004=\255\250\230\207\331\260\006\206"
+	.text
+	.section	.gnu.lto_.inline.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\377\007\325\031"
+	.string	"f\244n?@\215\222\306\034\300w\243\317\315\361r\320F\243\357~\277J@^\221\202\316\205Z\335\033\240\213\253\240uM\372\201\377\267\222\365\037]Uo\341]b\002\263\323\274\206~\021\"\345+\001\371[J\231\002]"
+	.string	"`"
+	.string	"`"
+	.ascii	"\357\366\221\267\033\246*D\036D\230\337XV\030\215VH\347;3\272"
+	.ascii	"a4Z\221\273\335\t\222\270Q\316J\213\006\216\037\311\022\017D"
+	.ascii	"!2\233\366x"
+	.string	":\225\210\027\260\312\222\367\320qD\252\322\344\266\222h(\303\207\006\351Y\333!\232\247&_\243\273\273\222\376\230\304q\025\311lw\001<\365\224\"\034\212\001\363\263\3212:\232\3264,\263!&e\244\311\031r_\031\376\224\003\3517\031\341\244\363\311\310-\240P\351\200Y\343g\360\251\221\2109\206hhw/\2560\032N\206(hw\247\214\221|\331\345hLu:g\247\363\325y\2752\305\350X\265;N:N\2762\3516\272\213\257\354+\273j\001\270{Z\326\276]\223\026\347[\021\225\260\3131\360$\211\002ZN\2228p;\241o\200\332GE:\305\022j\024\232\247e:\325V\247\324\243S\371Q\220N\211\362%\004\002Y6\022U\320\345\002M\314\217\216\004$g!ZW\307\214\3442E7\241\340\245\024\035\021H.K.\260\222(\004\320n\242\034\177e_Y\276I\214\2471,-D\270\214p\251\036\220"
+	.string	"\343"
+	.ascii	"\217\343W\347\271\375\271\037\346\376\362\327~\323~\350\204\225"
+	.ascii	"\026\016\371\373iR\300\313l\355\034:\254\251e\275\347\334\244"
+	.ascii	"O O\326\356\323F=[\326"
+	.string	"[\347\246\3357\352\331\335\352\234v\367\266\273c\252g\342\006\200\300\250\021E\251\306D$%\005I\n\035\220\002!\0222\321\003\022\300\0249\b\202N9\211(HaJ\312)\224\2465\232\001\245b\225\363\004Z\004\304j+\214\224\214Q\370%\265\022C\201\267\037\232\277Yd\210\006\t6\375R~BM\211\250E\302c\fQ\200\246\275?\365\221\021\241{\214\344`\213\336\031\024k\233q\0266\353\344l\212\034E\274sm\263\266L\362\226')\313I2@\036\024\331uhl\\\\L\214\370\357\2627\260\005q@z]dmO\225\003\352\235O1\345\202\352\3564\253B\037\314s7\306`\222M\253\213\3342\223\202,\304!\303%\364\330\223\301\004yD\324M6\0221\331Ff\356:\260{\202x\207\035\0241 c\272\b\300\300\242\242\360\205\354_K\251\030(\0248\374\214\355g\323\337\362\331'\277\265\275\363\200\204"
+	.ascii	"\206= \013\376\016\372\335/\307m\033\013\261\316\220\200 \026"
+	.ascii	"\275\276Y\360Y\254\207\345\223\323r\006\234\267]\nD;R\302\357"
+	.ascii	"=\330\322\007\231x\372\321\341\325$v\303\024\354\370\026\tW>"
+	.ascii	" b|\023\272\225[79l#\257\371<\021\227]\244\202\376\221KJ\257"
+	.ascii	"z\202]D\367\253\3274x\031%\333\273\002\275\274\364\262\013B\325"
+	.ascii	"\2006\252\370\306\352\364W3i\264\3706\"q\303\221\205\254\017"
+	.ascii	"\365\200U`Wj\027\335\256\352y\262W\312\277>\024\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\231\003\325\t"
+	.string	"\002\313#*pK\222\016|\256X,\326o3@\342\002\023.\374\017\251\202.\b\024\375\030\"\241~5\002x\307\321gC\214,\0226\221I\006\344m\006\355\027\260}\002\265\313x\236`\200wUo\021\230g\265\336W\344d2?P{\352\033\220 \314\026E\2011[\b\2110h"
+	.string	"4\200 \214\264\261\334\361\034wV\034\364\334\022\364\022\324IA\207\207\b&\034d\036/\262\027kY \224/\201J\3254M\363\325\030n\314d\262\362\374I\275\363Th\031\001M\250\260\226H\232\222d8\220\002\221\242\033=\022\200\341p\022\302\231\020\031d\230A\023C3\223&,\261[\r\313c\202\003X\023C8*(\025\207\344\201)A\222\005\001\265ii\023\306\252\036\\\274]\007\301\272DUp\266\2008\017\353:\304\373\nm\236\242\321Q\270\342\210Y\222\210` \023t\b\020\0234"
+	.ascii	"\340(\355\301D\005\276\264\236\240\022\033\203M\002\241`[\340"
+	.ascii	"\373\204\2075\366\025P_\216\225\003iIaP\230{\035\360mj\316\247"
+	.ascii	"\001\342\263\353V\325\216\266Q\013\032\006\324W\270\345\231S"
+	.ascii	"\377w\375\356\236\252|\004"
+	.text
+	.section	.gnu.lto_.pureconst.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\230\004\003\231\004\013\230\004\f\230\004\r\230\004\017\230"
+	.ascii	"\004\020\230\004\021\230\004\022\231\004\024\230\004\026\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\305\007"
+	.string	"2L%)\200)I\007;\031\305\270"
+	.ascii	"\320\341SeV\340\261 \214\f<f2\023\320\206E\261\377sx\310\217"
+	.ascii	"\355\261\336o\333\biR\246?\034\217\004\005\207\342\201\337)o"
+	.ascii	"\324\2715\335:\025=\227@\322\275^z`\366\314\025Hi0\307\026\202"
+	.ascii	"\251\310\204\202\b\254\246@\314\t\261\245\371\342\0330\300\221"
+	.ascii	"\241\036\"\317B\244Dt\301<iP\336\224\233)\030\324\264$\346f\215"
+	.ascii	"\346\352\357\024d~\267\246\371\322=O^\332\013:\233\n0\371\331"
+	.ascii	"(o:\231r\246}\331\236\016\001* `\0021D\306\007\\4X\223\342ba"
+	.ascii	"n\351\274\272\314\234\312\005\016|c2B\316\006\201\314k\241\321"
+	.ascii	"0Y\202>f\322\234\325f\020\303\324\265\024k\203\215q\251\331!"
+	.ascii	"q\207\001\265\304c\303z\321\264\256\232\2301/\263\001\267R\365"
+	.ascii	"\001]\030\370}\367\356\303M\204\207Aj(\255v\214\207R\004"
+	.text
+	.section	.gnu.lto_.lto.a1f17ce26ee991,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.32.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\305\013"
+	.string	"\326\326QA0Q\223\016 \350\365\237/\231\313\363\366\001\371\234_g\246S\n\247>3\336\t\201\273\366i"
+	.string	"\343n\r\335R\320\310\346\211$\220\330[\353\032\032Q\220l\307|\255\334\021\350\254t\203\240O\273I\231R>"
+	.string	";"
+	.string	"B"
+	.string	"\246\220\253\335\0203b\354z\t\214"
+	.string	"\300\241\201\017\240\016+\027@\035z\263q\334+\261\rxl\030\331\261\273QI|{n\376W\274\352J\242\347\307\203\335uv%\220[o\373b\233\201\375+-B\276\2103\200\362\335\241\017\242\016\243\t\305\207Q~\266'J\025a\277\262\273k\r\261o\372a\2465\323\231\351W\nF\020\250\261\313\341\353\261&P\206\t\213\355\247\375\024W\261=\327\001\262{@\265\"I\341JH\3719\325\306N\342S"
+	.string	"\033\273\273\300\037\271\013\f\276\310\241=\237\017u\2304:\224\3239\017' \326\016\276\257D\303\356\350rM=w\202t\255RN\270\034P}\026\017\233\313\3222\f\213\240\2612\2133\030\315\342X\0224V\0265\013\025\254\013\024\"\307\232p\305L\307\0231\005\214e\233N\3240\254\023-\336\276\262\273{\r1\204\016&#%Y\325\276\016\343\205\336\350P\256>\005\022"
+	.string	"2\303\303\005\025\2708Q\300cG\006fO\212\274\250B+\340\342\024\262m\341\002\314\336$j="
+	.ascii	"\b.6\020\253)\343\016/\332I\006"
+	.text
+	.section	.gnu.lto_pidInitFilters.33.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`x\001\r\016"
+	.string	"f\030\\F\020\221\223\016p\256\241Xi\217[\377\025\350\370'\207\037\032\211\007\320c\347\215\250\242r\253z\342\303\006\"l\r\335\337\204\225|\371\321.\361\233\372"
+	.string	"\001\005"
+	.string	"\004\"ZLd\315\004\n\332\305o\274{\355\223\275\367N)G"
+	.string	"F"
+	.string	"I"
+	.string	"\324\234\215\343\240\314\336\346B\205\233\327\356f\362\003\007\200;\2352r\276\347K\235vZ>\027\254tx_\313\345T\360\"CC\200\257\233\240\234\0167^\363h\341c\211\361#dw\035\275/\303\215\335v\003\333 \366q\002O\020b\305\210\r\252\030\332`*J\017\366\317z\275\204\2261\366i\376\031\243\357\021\320\3121\220c\027C\330cg\320\026\210\217\355G\373$^\202;\r\205\017\330\215\211\341b\027\0249\32495x\020v\332y\001\354\001\"V4D\245\253Hq"
+	.ascii	"\307s1\251!\231]\325=;\302Q\240\200\\\273\013\342\337\374\204"
+	.ascii	"\346\317\234Z\302\351\304a\005\303s1\353\005\323I\253`\227\017"
+	.ascii	"ljtq\207}\326M\250\3703\236\260\022\357\235\372+\330\351\345"
+	.ascii	"k\002\245\223Z\242m\fH\252\311c\322\bUS\252\bI5e(\b&\365\244"
+	.ascii	"$K\251#(\031i;e#\004\326L\245-Ci\332\226}\300}\210J\262\300t"
+	.ascii	"\224@\234\322v \022\357y\312T\030\206<\346\3105\362\027-\033"
+	.ascii	".\322[\260x$ \360\002\2211\323\001r\001\365\303d\022\226b\220"
+	.ascii	"\0034-\006\361V>\017\026V\300\363\320\270sg\267 \017\306\265"
+	.ascii	"J\242o22G\2570\373\310\376\355\347W\270\364\276\214\356\235\324"
+	.ascii	"\202qX\216\265\315\247\344\367\"6\357\373\240'\243\271*\024"
+	.text
+	.section	.gnu.lto_pidInit.34.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\205\t"
+	.string	"vRC;0\345(\035"
+	.string	"\276G\305:n;\204C$\007$\342f\016\033\304\017\006lF\030\366-\256\003\252Em\254\357\273\332\217\204\026N\013\00790)\017@\300SE\233i\333\337d\313\224\002/"
+	.string	"1"
+	.string	"1"
+	.string	"/\320\\rN\240\271\364g\307<\364\330\243\300d\234\314\354.\027;\376]?\377#\017"
+	.string	"a\256\353\206aw\255 l\343\216\267\215`;d_\003\221\303\376\266\273\353\030\263/\3737U\177\363\241\271,\274\354j\324\002\354L\256\200xl_\355\207\\\344\273\314\342\003\273\261\024\225\335P\301\t\234K\207\001\266i~Xf\035}\264Q\235\036\364\001Ft\331\236\270\311\212\263\273!\237\344%\024\376\307\245+Zz\360\322oi.\037\037h"
+	.string	"d/\255\331\241K\003\244\323,u\236\303h\252:\026\201X35!FS\305\261$L\363T\342R3\002\305\211\274\025\0072p\247\"y\034\253\353<\316\023\356\267\21517\310\314^\361B\324\"\240[\f\r"
+	.ascii	"2\241\rh`\\0\220\017\f\003\027m\232\023h\332\0300\345\022l\263"
+	.ascii	"\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_pidInitFeedforwardLpf.35.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\013\001\355\f"
+	.string	"&\331YC\020\221\232\016\300Jq1\265\302\b@\341\244\033K\177\365\237\242\242\b\213\007\256\300\216\371\271\241\r\021\341\377Ci\035+\212\037\335A\264@\002"
+	.string	"\210\005>X\272v\b1"
+	.string	"\232\350\267\334O\236\265vw\3332\245C"
+	.string	"C"
+	.string	"H"
+	.string	""
+	.string	"\356!\037\365\001\344\2437;\306\277\017\373\0235,#\232\335\255\340\313\246\333'\250\233\277\361t:\217\373\304\341p8s\315\340\205&\002\273{\231+\006oEu\343\331]k\347m\270\343m?\260\335\300~\026\366uw9C\221\345c\376\351\337\257\235{$\032\031\013J\273\032J7\266Ed\021\302\366\355\317\330\324)\373"
+	.string	"\202\355\037\212\341n\213\r\005\234G\253\332\037q\230\3551)\216\273.*V\354~\006\\\200\363\030\236\240\204V\226\232\377\2226\311S\\\036((\027#\0213\276\273\013\235\"'(@\364B\002FHkX\241m\341&P:^\354n\002\277\304G\231\017\342\321\240\023}\367\350\237\310G\b\"\227\026\230\016*Z\262?N\241\207\331\274\300@\0044\341\023\322\261\254K\0039\300>\332\310\2648\f\362\241\315\222\031!d\232T\032\005\2219bU%S\002I\005\202e\325\307"
+	.string	"_&\037\254\322\256\013\253\250o\017E\216\036\211\006I\005\256L\034*\241=+\350;_\346\236\020\344\002\024"
+	.string	"3\003\356\031rc\340\327/\303\213\316"
+	.ascii	"\263&h\242\tR\303\027\025{\201\037\326\351\2025`z\n\315\371\024"
+	.ascii	"\264@\215\016\356\0220\340Q#\373C)\003"
+	.text
+	.section	.gnu.lto_pidUpdateFeedforwardLpf.36.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\315\013"
+	.string	"\346VRA\020Q\234\016\033\002\360s\004<a\334\221\030\374Q\346\265\025\003@\2013\035\225\013\037\304\352\236\275=j\354\333\371\306\2630\265)\340\203"
+	.string	""
+	.string	"j\300s\366\b\200t\200\241+\327Y\372\017~\333M\312\224\002="
+	.string	"@"
+	.string	"<"
+	.string	"\223Gwv\214\203!\366!\035:P\320\330\335KAt\331\275\322\354|\212\246b\372\274W\026\207k\352y\341+U\227\335=\310\323\343#eR4\273\3534}\032\356x\333\rl+\260\237 %6\226$\216\214xx\373\240\237\262\3057\361\023\335C\267\260\274\fV\212\020\0173v\027\363h\004\326\343\245\272\305v\246}\022/\321\375C\344\270\373a\205\310.x\300\006\254G"
+	.string	"\0370y\314\013\b\216\031\325\246`!o\362A\256)\251g\325\250\316\216\033\243,\371wwUQ\026MT\t\234d\2040JY\303\006\275T\224\375\334]\317z\212\377\370\365\341}+\200\310\013\006.v1\004\241\254\302\246\3020\215\233\260`\353p\236\f\3430'\303e\237\314\301\203\ftq\021 d\036\354\372d\033\t\027g\013]\231\002\326@\235\355\3424m\273,\340^O\326\b\013\222\221\222*E\371\251WDlP\221\230_=\034\022"
+	.ascii	"2\003\3769\203\013`5\230\371\302\302\241\366\350\302X\\\243D"
+	.ascii	"\3039\235\035q\346\240]U\302\210\325\351\340\032\001\030\036"
+	.ascii	"5\262?\2242"
+	.text
+	.section	.gnu.lto_pidInitConfig.37.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\r,\355\231"
+	.ascii	"z\362\3204G\020H\355&\035\003\332\005\312\b@h\213\r\005\257\311"
+	.ascii	"\262b[\360\016i\243r\005\205\343).\332\201\300N\204\371\017\265"
+	.ascii	"\224Z$y\247\3565\031\304 F@\"\300 fFl\257&\212F\007\201\030="
+	.ascii	"\264\265\204\354$\245\f\016\003+\003H\003\275\336\027j\357\223"
+	.ascii	"^/\325\331\353\344\354u\341\354m\341\354e\341\354]\241\366N\235"
+	.ascii	"\275*\324\336\024\316^\024j\257\324\331\333\244\36629{\227\234"
+	.ascii	"\275Jj\357\t\2657\311\331k\302\331[B\257\227\204\263\027I\355"
+	.ascii	"\035\241\366\212P{C\250\275G\316^\020\316\336\017\314^\017j\257"
+	.ascii	"\021_o\007\265\267\310\331\313\301\331\273\201\331\253A\355%"
+	.ascii	"r\366f\320\353\215:{1\350\365^p\366Z\320\353\255\340\354\245"
+	.ascii	"\240\327;\301\331+A\2577\202\263\027\202\332\373\200\331;\304"
+	.ascii	"\354u\240\3666`\3662`\366\n\351\365.`\366*`\366&\320\353E\240"
+	.ascii	"\327{\300\331\033\344\354\005r\366\032`\366\376\250\275\005\234"
+	.ascii	"\275\004\234\275>\314\336\036f/\217^\357\216\263W\307\331\233"
+	.ascii	"\343\354\035\300\354\305a\366\n\320\353\r\340\354\005\340\354"
+	.ascii	"\275a\366\3328{k\234\2754\314\336\031f\257\214\332\033\243\366"
+	.ascii	"\3028{\241j\357\213\263\327\305\331\333\302\354}\252\275Ng/\213"
+	.ascii	"\263w\205\331\333T{U\234\275)\316^\024\265\367\304\331k\342\354"
+	.ascii	"e2{K\364z\201g\357\322\331\3733{I\324\336\021g\257\357\354\355"
+	.ascii	"\231\275g\3555\317\336z\366\336\354\355\332\313M\305E\232\020"
+	.ascii	"\030,B\321+\313J\250\233\tD\033\026\304\374\0033 f?\314{\230"
+	.ascii	"\3630\343\341\336.\3572\020\313i\373\333\002\200\004YP\225\017"
+	.ascii	"u\323\363\023\227F\016E\315H\bt\034;.#\367\007h\221\214v\241"
+	.ascii	"-D\233\255:\"\364Y\376\343g\221Z\216\312\210\360\331\037\233"
+	.string	"~x\320\223\307\006\037\026\226\025[i\f\t\361\261\331\362Y\017\354C\220\361\254\232\017\013\213O\017\0376r(\212\346`s\017\360\261)\243\326\337\356r\357r\035\266\023d\243\025\237@\3210B?\240\250\331\216\325\341cs\315\270\351d\323\307)N6w\203\273\217\330l\fe>dZhw(\212\3668\232\030\300=W3\336Z\203|\303F\r\0323d\304\200\001\365\302E\213''\026+\232T\244@q\302\004S\t\340\322\217\304\b_\3574\353;\270L\343\321\032\221\013\213o\034\331\306\361O\327\240\341\207g\364\341\3232\252\211=\325G \036:Fo\310\231\256;\f\003j\305\221,\022X\227\221_\300\301R\247]\330I+\353\026\201\330d3\026\t\254\353\016?9\201u\025\231\005\2356\275\242\211\221\212C)\f\241\370\021zs\2427\244\002\262c$\260\256\034\330\004\231\2324\f\206e\354\\R\024\007\314\316"
+	.string	"\303\262\306dbC\246KT\023c\252\017>b\032x\246\313\213\227zC\370p\016\036\336\200uy\361/\f\223\b\003\246G\314"
+	.string	"\353\372\302\276!\260|\231\001\007\213\227\356u\341\263\312\320\2522\356\244mV\023(\212\226\340\222R}\364\026\227\260\353\033-|>\343\001\372@\"ri\341\356\rAQt\233\310\325\305\013"
+	.string	"\3576\334\356\236\260\213cN\223\304\032PU\0017\345\304\025\215\273A4\355\247\317\2103\270\273;\002\276GO\236\244\217\3478\001=\356\343Oj<\336\343N\311\035\347\221\246\317v\0348\204+\032u\264\017\213\204\352!\310\206\311L\307\333\270\310\006\336v\203dm'\310\306\200:Oh\304\271\034\037\340:\016\325\026l\323<,\322W\314q\266c\204\343\003\034\252-\225\313z\303\002\034\307_\304\245p\002\270"
+	.string	"oz\207\250"
+	.string	"\016\344l\221\322\b@\234\236#\247\315\214#\037\314\350n\034"
+	.string	"\033\277\361\247\270Md\343,\347\217]\352\246\306\234v\263\3106q\212\342|1k\032\2571\3434\376\204\227\312\3118\267\231q3\231\272\211q\031;4Y\2143\r\025)a\024;M\260l\254\316N\237\201q`\230\242\242\021\352\273\301;\035f\246\252\021\347^\034\3525\231\312u\231*\316\363\366%\305\300\030\231 o/N@ZR\351\342\273\017\264\227\230d\213\273xz\213\367\332\234\376d\244\277T\t\361\"\305\243\213\016\2473\r\223E\026\337\215\240\267,\222\351M\313\325\376(\212\3635i\305Y4}\305{G\025oj\256\252\003\306x4\026\251\035}%"
+	.ascii	"\025\007&J\244\354\245x\025*[D\376BQ\264\242x\212\233u)\034a"
+	.ascii	"\221\326Z\344\216\026v\332Rz\330\274j'\233(\376\013C\244\\\007"
+	.ascii	"\226\313\345\311U\347\211/\301\303h\330\223vw\202F\253|\276\023"
+	.ascii	"\347;|\343\354P\321\274\330\002\325\274Q\347\330\332\221\003"
+	.ascii	"\236F\303\236\304_.\227\312\272:\230\323\274\267\316i} \245c"
+	.ascii	"L|\267\002\316\303\253D\t\213\0304_oL7Q\342L\300\227\270\200"
+	.ascii	"\357\2428m\314N\212\217c\222\336\200\0072dS.}\227\b\323\0251"
+	.ascii	"\027\2118H\f\356\367%\022\377\2158\211\r\370Q\034\334\210\377"
+	.ascii	"\240c+\372\276[\204\0331z[4\211\214Y\245\336}\347{\346O#\234"
+	.ascii	"\210\210!\314\377\240[S\032\353w?`\267E\352@t\344\306\030\212"
+	.ascii	"\242\"\360!$Mo(\212\006a\343\266\0226\211\222f\242\222\223M3"
+	.ascii	"I\234C\262\320\313\0347\024]\007\226\313\273!\212f\325\370\353"
+	.ascii	"9\205#\354\345\366\377\036Z*\307\357\263V^V/w\227\t\027\252b"
+	.ascii	"\344\333\356Z\255aBR\374\347\rE\207\b\244\300kS>\024\035\006"
+	.ascii	"\031de\205\005\3163\266\206\315e\253\223M>\237q\215C\267V4f\365"
+	.ascii	"\362\275\\.)\375b\273fX\375\260\345r\231\267\017\333\355\255"
+	.ascii	"N\317\336\0362 \336\026\262\037\336\316j,\026\304\313y\234\207"
+	.ascii	"\227\317\330\310\314t\370\007^&\343=\274\254\206\361\360r\032"
+	.ascii	"_/\217\2419#\026f\006\254\314\027\2311#z\331KL\0300_\274t\341"
+	.ascii	"\262EK\226..,W\254T\241\262E\234\202\203Vj\366\262\224\341\331"
+	.ascii	"\313\302\263\227\263\316^\306:{\031={\203f\357U\355\265\252\275"
+	.ascii	"7\370zm\250\2755\234\275Ug/\rf\357\f\265W\206\332\033\203\257"
+	.ascii	"7J\355\205\241\366B\tnX\215g\342by\373\345\331(\355+u\241\273"
+	.ascii	"\275\222\031\352d\023\220\033\364K\322>\213\0377(\212\3428\335"
+	.ascii	"\356>\362\241(\026\217\331&\242[\210\334\240_(\216\037_i\347"
+	.ascii	"\025?\367\344\2759\311\242\221)\352\244\372\222\262C\212\242"
+	.ascii	"\232\223HYb\251\323\277\321/\007\263\0325@5\357\364\314\207\315"
+	.ascii	"4Ck\351\230\341\343\026\251c\f\356\310\2151GH\232\336\032\375"
+	.ascii	"a\316!\215\227\254^\266\360=\274\020\265T\2220\353N\336\302\347"
+	.ascii	"H\246c\212|\321\"\177\246\350H\343%\221\364\243DN\316H\256\221"
+	.ascii	"\266\034*\032S0x\276*\271\360\316:\343\265p\026\356\302\237\320"
+	.ascii	">\270\020\213d\27075w;\302\311\267#B\302\203\306\016\265p\206"
+	.ascii	"c\304\302\371\017\327I\206\020\245sK+\3309\233\241\343\324W\370"
+	.ascii	"\333\356\274\320\324\177hlJ\025z\370\332\240\270\024\256\302"
+	.ascii	"\217\207\347i)\034(\205\255\210\002\332\201\bt4\251\243\360\353"
+	.ascii	"9R\352\2779k\312&|~\\\344\037<\342\034\2237\371\217\251\234\237"
+	.ascii	"\367a\362\237\330Z\321\270\344\370=\213\3243I\311\227\334\t\357"
+	.ascii	"\204+yUC\376\254\352\204\003"
+	.ascii	"\347\250%\tt\037\202e\357A\320\357$9pK\232\322h\202\332\355,"
+	.ascii	"\222\251\316\243\022n\302]\240\221\360\022n\266\255\275\030E"
+	.ascii	"\302\231\320\322\212H\n}\207\3530\302\221\274\326\245r\206.g"
+	.ascii	"\204\003\305\220J\021\332\016'X\3667\210\336F\204\377\324\216"
+	.ascii	"\312\020\2048\2335xD\\M\b\377\3159\026\215G\222\037\013\226\241"
+	.ascii	"i#\316e-\272\330\221\217\250\373\243\374\201p3\213l:\330Q8%\214"
+	.ascii	"[\243\017\016\202\007\377\340.\320R9\017\316\207\bA\322\312#"
+	.ascii	"\021,;\215\334iM\034d\215\335+F\367\272\0305\264\273;#\216\016"
+	.ascii	"&X\366/h\304\271\270w\2512\362\337Y^\007\220\276\205\352Z\316"
+	.string	"Pg\221wp\326J\023^E:W\221\377\302\360\224F\016\276\267\362+\213\\^\263WE,\240f\342\002:\331\354\266\r\316\201\006\337\340'Z*G\344\032\324}\253\212\310{t\2252\260\373\024\034\242\236\301\337\246|\032\365\021tvJ\f(}x\341\005\307\340\257\273\302;\326\005\377\205\331\025-\370\356\325\262\227y\025\334\202W<\254\256T\301\201r$))\020\366$\345\004\247\3405)\245\355&8p(\251(\201V\327\321Ep\t^\333R\271)=\027\025\301\177tuJ\b\266Z\016\322\003\207\340U-\225\253\322qU\017\374\227\250\256h\034r\245\035\005\271\230\032\325\021\347H8\360!oql\340\016d\351EU\r\234)\214N\311\300\226N&\3526\026r\006\336k[\340B\272\364\020Q\013\374\227FW4*\360\245\335\202a\230\020\325c\357-\201+\360\236Z\n\007\201'\340\325lQ\b\374\227\006\351"
+	.ascii	"2\035D\260L\24183\275\026u\300\016-\220\212#\202\\m\221Mi&\032"
+	.ascii	"q\016H\220\233xi\020\302\263\0039\037:.J\335\b\r8\237\275\343"
+	.ascii	"~\334\200?%S\271\002\376\343\254\207\315\264#\"\255<\037\021"
+	.ascii	"\\u\026\360%x\332\206\035N\246\2104\251K\222\264\023\252\251"
+	.ascii	"(L\244\240@\241\212`\352\027\305\311\024\025\007Obh\342d\352"
+	.ascii	"\210\013P\244\242L\231\200a\212\006%U\252\205)\024\250\240p\320"
+	.ascii	"d\352\t\211e\302#\312\224\223\251$M\246\236\364\210\242B\nS-"
+	.ascii	"\240\320\303\311\224\022\027z0\201\002C\017\036PK\365D\nJ\217"
+	.ascii	"(TTPz\374\314Pf\364aH\324\334\262.\\\036\023d\216\2412\275\352"
+	.ascii	"\030\315yL\315\f\203\346\2773tJc3\235BV\206\232\211\333\206\354"
+	.ascii	"\360\2316\323\213\331\005\217\305\316g\376T\227\302\t;\213\335"
+	.ascii	"Ddj\t;\323\231GJ\243\031!\314.\223\213\301\316fn\242\245rD\230"
+	.ascii	"W\300\016\314\363\250x\243\314\253\230T\370\213\313\270\021~"
+	.ascii	"\375E\222\314\231-n-\225\2631&i\3420\346\246\016pJ\253E\246\224"
+	.ascii	"E\016S8:w^\214\314,+G&\226\230\263W\\]\2129\220\313\"e\2150\307"
+	.ascii	"[dS\255t\202\371\"yO\2110\3474\b\341\2273\230\367\274\234\277"
+	.ascii	"\374\004\003\007I+\217\206\025\244z\267\310&;`\232\274\273\333"
+	.ascii	"\031^\276$R\255\363rS\207d\227\"j\021sf\033s9w\331r\346\362\026"
+	.ascii	"jZ\316[\352*$-\007JBT\314bW\343\026Y\341\316\310\b\271\001\352"
+	.ascii	":gy\214\266\024\216\220\253\353/\216V\312\312h\221\2767\256\363"
+	.ascii	"#FW\216\305\312\371\312\235\342\252\234\255P\252\212\252\034"
+	.ascii	"\b\0276\245\221\312w\255\360j\242J\304\0278\\l\303\2553\025\342"
+	.ascii	"y\353NG\242\325\262\272M9\337\341\034\\\330d\\l\177\215`4\326"
+	.ascii	"\337\350)\0073\031Y\215A\366\306z\235Fz:\013F\033\233\2413\203"
+	.ascii	"\356\356\372\013E\261\240.\206\303\013-\362\006V%\024d\303\242"
+	.ascii	"\256\251\021\347\264p\370yL\203\320\372\331\226\236\245\234\201"
+	.ascii	"h\204H+\357\305\305vx\036\002\317\241aO\252jUB\306\322\244\200"
+	.ascii	"\214UAS<\336\206\027\222\206\331\305\3058\357/\346\220\215\325"
+	.ascii	"@U=v\257\204\365\207+):8\357\234\3067$\245)\2018\212\242X-\204"
+	.ascii	"Z\025\320\"\231\3521K\350F\210f5\243[WUN&2\326Y-\210\242\233"
+	.ascii	"\224c-\243W\352\236E\352\t\236\321\253\007\357T\227\312Y\375"
+	.ascii	"\212\253\236Y\035\230\036o\310R}\b\226\325\036\266\324;7\374"
+	.ascii	"'I\217\322hC\227j\207\252\326y\027\327p\033*\0175\3747HO\325"
+	.ascii	"\227J"
+	.string	"g\221;T\242\341U3\234\206\233I\031>C\230*G\2063\245hE\343\023\2347\277<gt\350\234b\360\252m\202eM9\220\251kb8\223\224e\321\270f(\212\262\240:\243Pu\363\225\031\261+4\315\304(_Z\243\3446<\326\302\220\246\242\t\226\3253d5\f\206\377\222yP\330T\260`Y-\323\246\222\251\202\362\037Z\245\342\013o\252W\260L\025\023\247\202\211z\341#\222vJ\2529\325K\260\fS\227(\207\354\210s\214n\t\2265i\331\"\211\016]\023\031\356\342\242\243S\004/\255\335QQ\255Tyt\207\307Kk\305\024'N\211\2433\211\227\326\342\240\350T\312\242;;^Z\363:q\261\335\253\035jV\260\214E\305RD\207\356u\314\202K\203c\250\322\020)\321\242\330\251\221\021\221$\005I\232\003\"\f\020\204\002I\352\240\264\033\022 \344,\207\242\034S\212)#BE\222\2441\303"
+	.string	"\273\244\241Z\254\3649u\311A\r\344\227\324\036\\\323z\001\350d\316\021F\347\004\336\024+I\357\364\261\240\204\326B'\312|\203V\034\320.p,\013\325\261\230D\210\n\301_\354 l\315\032Rzc \251h\236~T\364\244[wH9\351\247BJ |<\241\365\314\377_\366\315\bD+\253\222\247\201d\245"
+	.string	"]\035|q\310^\025\004(g\301s8/\"\370Y\323\257\tt\314\212\233\024M\210\027\361iS\276\327\310\230\326\365\232\327\307\203A\307m\337\261Z"
+	.string	"\302\261\247\206\253\207H3\312\333\213\252Q\376\306\201\361\016\331\2300\255*8ma\311\214<\327\263\\\250\245p\310\247}\241\235\356\366l@\033\224\212k(?9U\252\253I\tda\367\026\035<\241\263H\375\034\234I\336\225\305R\220\321<UI\023%qoW\347\344\374k\"z\225M\340\202\0164\022\241E&\r\215\244\3660\273SC\013,\244BE\310\362\017*\355\256\367!Y\250\321X\234T\236y\305\317\323\265\317\340\356\023_m'\212P\033&\214+\344=\222\024\317\234\244|\265\345\b\365v#\367}.\325<\335\023\364\312\263\267\222\243\245\323\3118\bkT\365\026\026c>{\225\244~\221}\241\223\322\203#^.\237h\323\352\367\376"
+	.ascii	"=\337\021\213OIO\355\003o %\222{\020\246\277y\203\017\203io\346"
+	.ascii	"L\304!1V\372\026\330@\316\254\241~mI89\243\230\201\343$Zi\321"
+	.ascii	"\323\340-|\211j\225\036\364\271\027\313\273*\036k\006\2607\227"
+	.ascii	"\254\355\367f`\320.\205\351uF\354\246F\017\371\214%IR\236s\036"
+	.ascii	"\372\226Ou\213o\023G\3710\213:\032)\023\031\241\275<\320f\254"
+	.ascii	"\"\004HYW\363\270\t`\236\377\204\325h\240\n\2129\024\2506j\227"
+	.ascii	"\273\326[L\267Z\353N\037A\246\026T\221\366\311\262\327o\226\365"
+	.ascii	"K\304\240\210j\372\226\301$\350=F\231|\025!\260\236B\335\327"
+	.ascii	"~q\334\300\327W\275p\356#\353\250~x.(o\311\016%\305+\300O\036"
+	.ascii	"+\346\330^"
+	.string	"\231\362\331T6\316\274\233\262G\270lha\207\371\354w\343\224\354\016\233j\037\210\004-\260N8\326\261B\2117g%\317kg\"\274\312\371\231=\032\344R_\313\222\352\326\022\337\223O\307/\246\253]}\207\264\262\310Bx=m#[7\335z\202gK\217\024\214\rw\"\205\313+X\211\037\321\221\356x\342\006\320\r\373*AAf\236\233\026\246\241\253\033XxT\256\267\205\320\023\242+F\304/S$pR\005\337\201\235\330\027P^j\347q>\017\324\254K\251\341u[\027c1\301b\203\262<\324E5\221$\305\374}\275\307\362j}\220,\0246\262\345\326*\231\247\267\267\253\212\324B\347yz/\311Rp\320\350\323\210\353\261\2177z\335\344\345\242\367\255\322)\177G\252\310\211:\323\356\310\t\357s\317\263A\340\261n&\016\\\366o\310\242\261\314\210\317T\bD_\335\312\367"
+	.string	"\227\f\023\352\025_\352\023\301\275XP\032\022m\224\232\356.\\27\244\265\251Pm\013\326\263\256BHzC\272\375\005wr\366\207\216\254\356\310\002\013I@F\266\361V\033\306\t\017\370\004 !%\232\370(RQ\204\333P\356\244\007]\264\355\325\nG\350\240\277\021\027\240f\364<\f\233\305r"
+	.ascii	"|\340\242\262%(i\367\036\021\365\342>\315\265\265\275\242l\211"
+	.ascii	"\200q\227\021\342\036\367\263\253\n\003\351\222~\217C\3048T\203"
+	.ascii	"8\217<\301\332\013yq\375\210\236x\025#;H\263->\262\334m*\250"
+	.ascii	"\247x\367>r\251N\204\n\017\234\007>'E\252\206e\r\314g3\001y\341"
+	.ascii	"\\,0\324?_\245\217\215\031\031Y6\350\003\347\264;\325\340'\016"
+	.ascii	"\237\r\356F]\323g\261\200\257\346\037\236\242\242\234\013\243"
+	.ascii	"L\311\035\030\007$\323n\327\017\316\324\307\233p\026B\031D\027"
+	.ascii	"\253\323\210\342$\025\356^\025\273\375\3443\335\324\0324X\354"
+	.ascii	"\006\033\207\257\3246H\311\202\022\001\177U(\255W\364p\016\031"
+	.ascii	"6Xp\250;\315~\036\\3cH\235E\322A\224\033\257F1\036\007\303\202"
+	.ascii	"\2526l\342\344:\342\252\337`\204\276\001\275(f12\253\202\243"
+	.ascii	"\364\252\217e\332\013\221<\362\350\277\036\035\244\301G\347\204"
+	.ascii	"\275\207\006\213 \r\324,`\265\350\374-Q\207\221\325\377\035|"
+	.ascii	"\271Ya<zu\212\347\301?\324\234\257\305\241\325/\350>l\251>a\314"
+	.ascii	"\271\212\327\243D)\270\354\345\377\350\242B\375\004\262eY\240"
+	.ascii	"\346#\001\224\215\225\303\003\321\211\216\317\317G\313<\350\020"
+	.ascii	"szu|\022\266\t\340a\320\271Ne\232sm\340#!\210\257K\f\032\341"
+	.ascii	"\376\007\004O \024\277\304\016,\215\033\247\255{\204/\204\fW"
+	.ascii	"\025f\343\356_\341\201{\237\\\002[\t\007\344\020\033\235\243"
+	.ascii	"{\023?7&\243\267\036\236=l\352\310\335w\353i\210t\207c\327\346"
+	.ascii	"\275ko\255\261{\377\265k\363\302k\327\336+\027\377\363\"\024"
+	.ascii	"\352V\274\263\214\022;\002\237\257\020\004\242\2120\344\2135"
+	.ascii	"Ju\235\312\264p\300\243.\f\301\256v\253\231\375x\251<u\347\316"
+	.ascii	"^f\237w\300:p\274\f\317\204\303\002\306\264\022\360\246\347_"
+	.ascii	"\361\027\335l\334\224D\252\202\n\f\026\223)qe\262\216\340\342"
+	.ascii	"\233W\372\240T\214V\357\007\352-\222\330V^6\252I(\016Y\025\256"
+	.ascii	"\302\035\005\311\226\314Bo\241\361\231\351^O!\214>e\217 \355"
+	.ascii	"\f\341\204\217\215\030\231\252\362\036\001\r\247\024\314U\212"
+	.ascii	"\np\262c\263\337g[u\210\fZ"
+	.text
+	.section	.gnu.lto_pidCopyProfile.38.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\030\001\345\f"
+	.string	"\246\227UA\020q\233\016? \320\362H!\305\374\232e\021"
+	.string	"\236D\304\005\212\235\\:t\351\214\322\3730\354\277\377S\377\020:\214\"\343\302'\245\232\340e\216\200w>ib"
+	.string	"\232\262\3421"
+	.string	"\225\241\336dK\231RB"
+	.string	"?"
+	.string	"C"
+	.string	"\377@\354M\264\350Tb\354n\245\037\276\271\00457\376\204\271|<\316\245\r\r\207\320#\205\250\033"
+	.string	"\352\320By&\251\034\336\t\364\330\335\207\236\026<O\346\204\331]\347\307\313p\307\333^`[\201}+>\\\005\331\231\276<\345\237\216\362\307LCM\253\246S\323\247\002\274P\221\271\330\2750\232\261\"\tE\b\333\247\354\224\026\004\231\266\201\003\233\243\224Xw9\2208\261\373\0250\201\215K\336\330+\001\230\023\345xR\250S\324\213:\273\032\235\034\231\006\206\321\n8iT"
+	.string	"\"B\271\273\034u\205\250\372\240\004\013\223\224\341\324\253*T\3516\374\373\244\251\221%_\022\243^IV`t#<9\262?O\252\007\007\326\246\351 \311\\Y\202\214\b\026\242m \027\006\302i\256\016[\037\034\226a\r.l\244\342\"@\300DB\252\fs \241\2626M\365!\300\332Hf\2538M\333*\352\353\034\256\202\314\200E\324Q\217\024\023z\002\205\374\307\017=\034"
+	.ascii	"\201\315\2163\2469\311F\205\266P\277\227\013=\004\265\330\213"
+	.ascii	"xp\013H\013\252\001\220z\"\356\203\t&3\0344\007s\r7\230\005X"
+	.ascii	"\2041\240\034\030\f\214\320g\214\340.\001\003V5\262f\310\355"
+	.ascii	"*z"
+	.text
+	.section	.gnu.lto_pidInitFilters.part.0.65.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\260)\205\213"
+	.string	"*\332\2700A\0200\2175\006K>\224\266\341\017\330\210\360\362\325\345\352\223Wm\324~\335\324\324\2017\235\347\366K\213\301O9\343\267\033>C.^ \332\340@\271w!\310\337\267x\315\374h\324Mn)eJ)\005\013\003\245\002\t\003}\250}\254\335\254\225\230\233\275\354\314\315"
+	.ascii	"\001\337\370\333q\330\311|\214\222\222\313\027\274\311\312C\224"
+	.ascii	"\224\200o\025\264\204$\013\t\"aPd\242#\344\243\3641P#c\033D\305"
+	.ascii	"Df\231\322[\026}\303\023\341\217\237\3005m\207}\370\300Y\343"
+	.ascii	"D\317\236\302\300\277\306\3079}\207\2330\317\222\027\017\333"
+	.ascii	"y\363\347&\254\345t\034n;u\350$\261K{\337\227N\222v,\315\002"
+	.ascii	"\024\2716\217\357\373N\320\312a6Js\304\235f\t7`\277i)\033\301"
+	.ascii	"Y\322\203\0250\263\314\357U\013lA\267\007+h\307\322\332@&t8\332"
+	.ascii	"^\231j/\261n\332\264Q\302$Sz\313\230t\301\233\321\366\312fI\257"
+	.ascii	"Q\302L2\2777-\255\377Z\215\333k\224\264o\234\266\311\037\341"
+	.ascii	"\343\373\3725{e\024m\257Jn\304\356\355\267\244\317`\340\344\367"
+	.ascii	"B\323\330\235\271\315t\237\333g0h\n\357\253\2050\316\373\372"
+	.ascii	"]\365\312Vm\257\354\327Ml\257m/\261\27527\0373/Icv\231\005\265"
+	.ascii	"\337\334\333\177\0324YS\350}\337\254^\237\013\321\023\206&\n"
+	.ascii	"XM\017S(X\360\267\352\327\314\205\3446\247a4\354\327\305\325"
+	.ascii	"b\213\305\n\025)Ph\2350Q\202\304\b\021YXWV\315\020 >x\250\242"
+	.ascii	"\3520\305A\212\031\265\001\352IC\006\fN\027,41-U\240\240\224"
+	.ascii	"4\001\351\310\250\210\250]\262\253\372\316\177.\367Xs\032\246"
+	.ascii	"89\264f4*\2258\271'\315~OqL\236H[e\213c\342\304\273\246~v\310"
+	.ascii	"\271*\273Eeo\2110\344,&{\305d\253p2J\225)\225\364\024\252\222"
+	.ascii	"\bA\216b\351\265\005\352\330ZM\346\330'TfeK\205\220VHeJ\033\335"
+	.ascii	"D\2118(c\223\350\020\322\002-\372\b\021\224yY\212\222{\034\313"
+	.ascii	"\260\257$\233JP^\034\324\260\255\024\007\201\340M=\035bP\313"
+	.ascii	"\210&B\306A\3654\b\305\376\240\b\t\307=H\273\n\262gD\245\220"
+	.ascii	"qPiS\345\031\364\016\212\215o|*\260946U\233\2748h`K\025\022\n"
+	.ascii	"\2729\\\231\211m<j\303\322\213\312K\036\224\"\237?\225i\r\212"
+	.ascii	"M\365\226\027\007"
+	.string	"-\323\031\376\214q\f{\355\364\247eD\333 \343\240{}\341L[\350c\347M^\232\251O\317\210:\201\214\203z\351\245\273.^\341\314\2369\247@\327JK\257=-C\256\0212\016J\327Id\276\324u\\\332\033{\004H\317\nK\305\245\231Y'\364eq$,}\2442\261\250L\251\233\033\305A\257t\221\252tE\025!\005&\215\003'\222\332\002m\353v\351E\3301\344\334@\306A\333z\251\206x\224SB\223\224;4#\265&\316\236\371Z\244\266\326j\biV\214\324\312\374'\2501Q\231\357\373\266\264\035\212\232\231{\205\346\277\245\327\373\276\254$\007\2459\200ff\221\230\331\002\346\016Q\001\354\035\f\231\220\370\276/C\340p.\237\326\334\373\276)\314\370\233{\306*\261\327,\024\276\321\330\374\212\273\271\340\266\343\0270\274\321`\260\275&}\023\366\224\234?{\034d\245\001\264\323>\371\321#=\363"
+	.ascii	"\004x\243Mx\246\331\217q\321#}\237=\032\375\321g\340\006x\366"
+	.ascii	"H\303F\213\271\367%k4\346\033^\345\253)\221\255\355\364\352v"
+	.ascii	"e\212\306\226\024(\r\340\362\243\234\2035\372\0264\305\350\215"
+	.ascii	"\306\016\367\262\246\323J\366\243\334\211b6P\211\276\307\204"
+	.ascii	"1\364\365\213\036\n\263\022\266\350\235\242L\376-~\363\341tz"
+	.ascii	"h\375\350\023\275\330\025\300&\225Q\323\351Tm\377?\354\317p\371"
+	.ascii	"m\002\236\266\374\025\022\217d\337w\327tZ\371"
+	.string	"\037e\377\237\307\337a\231\033\342\365\331\357&\225d8|\203\034\355\373\226i\261G\241\240\001n;\f\330^\327_\363\356\354\371\377\373\2373C2i\263\372\276dS\375\376Nv\316\3000\361)3?\340h,m\337\367\325bw\342Otp\333\365\312;zx\243\365`{\355oi_\241\251#\331G\346S\377(\377\213\3272\235N)\371\2650'a\235\305Xg$\254s\030\353|\204u6\302:\027a\235\211\260\316C\212\234\205Lp\344,\001\353\354d\235\203\0349\003q\263\346\037\2543\030\353\354\243\207\2213\017\037k\336\301:G\300:\353`\235!(r~\300\001#\347\006\372P3\003\254s\016\326y\201\"g\034\254\263\002E\316\t\260\316\b\260\316_E\316\007\260\3167Xg\003Xg\033\254s\215\2453\215\002\220\234\t\350B\3153X\347\001Xg\001\226\3162X\347\0300\216\234\003\350\310\346\027\2543"
+	.ascii	"\254\263\213\245\263\027\353\334\305E\344\334\242\037\233\267"
+	.ascii	"Xg\026K\347\025\255\263"
+	.string	"\212\3269\005\n#g\255fl>\301:\233`\235K,\235I\260\316#\212\234E,\235\263\260\220\234\257:\261\331\212un\262\316!Xg\020\037\216\234=\264\237\346*\326\231\212u\356\300:Oq r\226j>\315L\3269\252u\336\320:C=\0319k\350\302\346\f\2543\006\326\331\211u\276P\344l\241i\351\314\324l\232\227*\0209S\350<\315J\255sR\327i\236\300:#\261\316GKg\243\242v\323L\324:\267K\347e\353\314.\235\327\366\353V\033N\363\263\316\316:w\373-\255(\363\276R\246\224/\334:\347K\303\351v\323\315\246\273Nw\236\356\302n>\335~\272\023\273\031\273\037\273#\273\013uaZ\254x\026\357\215z+\276\375(\366}\236\212o\310\246\232\303\270\207X\325l\356\336\313\034;BT)\262>\305S`\347\370S\002\333:p@\361\353\242T\263O\234@\234:\361(\276#\355"
+	.ascii	"M\274\326\327=\235\273\3265G\345"
+	.string	"\347\334*[sO=\317\345\267h\215\370\022&H|\211\367A9\022\337\177\350\372\276\003\226\266p#\036\352G\222C\342s\317c\371\272\340F\246KZ\027QJYaG\323\306X\205\335\f\233!\025\366\275)p\202x/\234\032{\2304\263\276\337\340\243\030\022\361<|(.\235\210_\2021\224\2342?\232\365\354\363Or\264Y\277\2021\334\253\214\272:\373j2\303\353\002\210\306\266!\353\311~\254\016\021\017\017\224\006\254_\02734\333\312\352\311\352\261\2465\274\371W\177\236\210\225`\212~\350\031h\213SN\032\272\002\361!\032\233!\b\261\264-\001\304C\353hp|B\2220\002!4\2663o\37028}\370u\361B\263\253\2520T\375\207\357H:i\f\247z\017\203\236\204\314\034\2010=%]\320s\222\013\21472\006\3620\365\035\236\371y\210\252C\"\342\324\367\237\246\202\016:=\247\356\230\037\021\350"
+	.ascii	"\321\330\370\372\350\315\333\205\023|\276\240\016\343\314YXd"
+	.ascii	"\342\360\313\272\245f3\231\357\225\030\004\001\35151\237\303"
+	.ascii	"7\345\034 \227o\370\250\2272s\233\234\025\016\261\360\304\365"
+	.ascii	"\270|\r\350\3669\bn\225VC\350^\321\312#\325\364Qw6|\367i\252"
+	.ascii	"9j$9Xj\023\004\304\364Q\206b\243\331\320\371\202\232\023\347"
+	.ascii	"\r\221\325k\033\\\372(C\375\177\307\375\031.=\324S\360\206\247"
+	.ascii	"I\245\230ni"
+	.ascii	"\267\006\200$T\370('\325)=\375\272\230\324\354\f\031\336\005"
+	.ascii	"\225h\023\004D!\303?}GfqT\341\030^\203\024W\215i&u2\271S\034"
+	.ascii	"\216\273\3065\303\007\335*(\022\333\\\320\275r5\027\250\341\311"
+	.ascii	"/\274\023\026\fM\357\364\375\346mX\332\002^\370\336\323Tj\204"
+	.ascii	"\252\364\332\006\225>\312\035\270r\255\306\215\272\232\257\013"
+	.ascii	"\177c\262 \242\261\351\365\362\016\2371?\304\337I\037e?v4\177"
+	.ascii	"\006K\031v3\316g&e\f\373^\213\201\223\304s\017\330\3034\024\253"
+	.ascii	"\3672\t\204\367\276/\b\317\343\367\035\353,\314\216\327\316\275"
+	.ascii	"i\354h\257Y\027\274\027\356\005Q\002\356\314+\271\370"
+	.string	"\235Kg\341\227y\203\366&<\362\031\0361\275\005|Y\214\226\276\351\241\270Z7}R\024\351\243GT\232\351ytq\273\034-\323\257y\202\366\274x]\016\254\304\245\377>\214F\037\375\342\346Yq\331\"\355\325\315\315\221\037\251\230\tS\364QFZl+\374Z\267l\266\322C\271j\245\367\276\256;47\"\253V\372\n\337\205n\322\263,U\356e\355\206a'|\322#=\205gv\305\270{\336h\254\276m?\306\001\316F\342\264`\207z\203\b+\206\304\231\344\210\222\032Jz\020\001Kr\004,,\206\017\247\221\245\013\004\b\322C\254H\215!a`\b\3708\272 \210\216\021?\214\b\3211$\fL\314G\0050!\316\037E\302\f\360\3414R\304=\260\304\234D\234:|8\215d\211\005\001\342\024\362#\213\210s\307\220\254\036aH\262\260\240\270\210\021\260\260,\261\"E\302\262\214\272\337\327\302^d\317\004"
+	.ascii	"\261D\247\353\251\210\356Z\024 $~\252X\037>H\376#\333\302\f\235"
+	.ascii	"\036F\335\343\256E\025\036yl\303T<\352\235#\377\345(\351\302"
+	.ascii	"H\0351*\2359E\340\212\214\f\n\026\371o$$\362fOu\243\266\031\302"
+	.ascii	"\207%\362\227f\310\377\224\306\275>\257v\351X!\317\203O=#\204"
+	.ascii	"Q\262\353\254\257\352ZL\360\254n%\371\037?\336\357T\256\037?"
+	.ascii	"\301w\2352x\316\2620q\276\004e\370\236\223YfT2{\022\004\321\340"
+	.ascii	"\310\031\306\203 \377\200\332\372\310\300\036H\036\220#0*\336"
+	.ascii	"s\022\353\214\372\345\211\206\352\016\210\217gi\327M(\003\253"
+	.ascii	"\243\363\361?\345\217\344\267\370(;\213f\373Y\267\205$\357R4"
+	.ascii	";\311C\341\255\025=~\255S\321\354\035;X\354\370\036\337P2\021"
+	.ascii	"<\217-e\324\250\273\2065\367\374S\265<\335xP\345x@\360:\"X\243"
+	.ascii	"\302\361\233\216'\302\342\006\301;YO\321)\\\241\342\265\260\212"
+	.ascii	"\326\017Xi{\340\365"
+	.string	"\360\244\370(\023Y\321r\340\327\272\023\315f\200\201oA\376\276\357\030\n\006\336\201o\350\3364\3077\240\2629\237o\3245w\315\304\334\023P\245\362t\343A\235\322\200\002\277@\016\034\277\300w\343\331\3433PM{J\301\361\rG\215\302\032(\360]\331St\352\370}\324\357}\337\023\375\224\262\t\f\252O\236\252\223\004~\325\223\356\365\221!\360\035G=s\266\357KV\246\232\271kO9N'{\343\277\020\370\003\376\353\257\350\250\257Kw\300o)\366U\262\264=t\343\277\006M\250p\003\276\343\374\244\363\310\316\033r\327\250\346$\237\274\306\3330\340i\274\215A,m#k\374O\001\334\353\202|t\f\221\245\220J\t,<\337\370\325\304\370\301\230C;}\344\030I|\224\306\363\370S,sC\204\277H\343W\2755=\002\021\020\230/\323\251\b\021B\370r\030eP\326U\001\277.Z5{\306\f\254\031_"
+	.string	"\241\001\236\200C0\3057|\006Z\374=\205z\b\210\361\0024\016 \343\005\310#\343\016K[;1\036JH\362j\316\313!s\347\370m\201\204V!`\374\272\b\242\331/^ 6_<\214\357\310;@"
+	.string	">\200\207\363\203\317\311\256g\241\027t\253l\005\376\233"
+	.string	"\272\336\005"
+	.ascii	"^\357\002\320\353\327\274\232\256\357AM\005\215\224\f\201\346"
+	.ascii	"\375"
+	.string	"\310x\231>[\037\005\232\001\361f\276\214\227\303\017U\\\277\254\243j\366\326\226\007\036\266\236\353\233\322n\252\342Y|\213\337\3731._\013\236\275\030\267J\257\371\300\275\242\365\001\203%\250\222`1\322I\306\224\232\021\221\244 I:\202\f\210AL:+]=\022@\343,\210\203(\253\220T#\242\240\260 e\2444\034~\002\032\020\372\265\210\003\233\224\240}\356\027\2431\247\"\212\255\326G\354\323\226\322<FqMl\276\332r\364-\263\270>\330\352\351\275KJb\253\375\234\310\342\037R\313\306\331g\323P\210\032\354O\207eK\235\355\254\230\244\220\372\266_\230\037\r\321\242\023Iv\371$\253C\005\036L2\232FN6qb,3/\357\225W\003\360Q\230\316b\222\032>?\003\256kr\207E\333!\006\003\243\222\013\352\322\372L*\221\246\205\002\f \025\216\205\241\032\263\266r\fy\222\255\274\220\2018\037\221"
+	.string	"{9\222\246\225\205R~\366G\020\021\221f\224;q\236N\f1\275iv\007\255B\024Xh\262\371\021\332;+\334\002M\240\202 \363)\222\340\245a\205\177\020\272\372\303\244\251\245\177k\226L\234#\336\245\206\016\200\274T\004%\254\\4"
+	.string	"\371\235(q\231\207\217\271\034\374C\321*\314x\275\274\344E\345\344\033\231\377\212<\204\340\250yi\362\324,>\n82\360\0336a\346\225\320\302\225\370\244\312\253\362k\224|k\204\322\016\031\025\333\316\3600 \317\005V\254{\230)\242k!r\221\274d6\342Q"
+	.string	"\r\232r\013x4\252M\370\356\327\331o"
+	.string	"\020n\213S\274\271\235\260\221\216\236g\330yv\365\244\023'\370\fr\272\327\017\006\274\201p,\242\037\236\241#\002\240<\372\300Du#\351\360\216p\334\304\223Q\223F\3421w\247\223\200\247\342V\222Ko\371\234\356%\200kk)]\255\034'\222\317=?\335\244\353k\337\333\007\b\033\346C/\002\017\037#\2631\355\370s\232]j\326\3551\017\026C\273]\254h\372K\321\204\376?s\034n\347\312MY\230}\rQf\006\274:\250o\237`N8I\3642S\263\374\032\332p:\313\205\236\r\317\247\242"
+	.ascii	"=\354\240X\347\345p\245\360\232\006\205\262\277~f)\f\317\277"
+	.ascii	"\336j[)c\207\366\370J\355\f\357\224)\001\220!\202\240\f\236y"
+	.ascii	"\245{^\204Z\002\004\275L\217\207g{\343\300\23083\372g\255\355"
+	.ascii	"\037@\350\377g_\260\232\264ux\215\331Yk\366}\211\307\341\361"
+	.ascii	"\214\b\257$96e\276/\313\237\003\013sv\346H\016\223\035h\002D"
+	.ascii	"U\3445\t\315<6%\177\333\357p\250\324\275\265)Jf0\016\227\033"
+	.ascii	"K\031/\271C\337\270\300\234\266\377 \001~3\370\261t=\326\374"
+	.ascii	"\320S\036\236\274pR5\266\357\030w\244\030\206c\216\2307kVe9u"
+	.ascii	"Uh\254(o\254\223P\025\223O\242\001\356\216L/x\345\007\312\033"
+	.ascii	"7\017/>\177~\t\302)\"5\022\232\2560\003\by5+\355\335\376\217"
+	.ascii	"\b\356iA\256\372\321\313\214\214\250\0225\301\322pY\354\376-"
+	.ascii	"\177\237<\005\305J\255\244`\325\345\313F=\276\304\323\003\"/"
+	.ascii	"\25765\236>\224\337\300\222\260\346\336\342\b7\310s&\362\377"
+	.ascii	"\024\375 \366\311\3349\365\016\217\345\370)B4-\f(\321\234i;&"
+	.ascii	"z\251\233\r\220\036\215G3\341\226H\367\225\257\257`\313\r\307"
+	.ascii	"7\003\341\177\f\351\240\345"
+	.string	"\276\225\035\023\225 \fxOxSp\252$C.\235P\255\333\250\006\226\210\207O\223MZ\303\242\351\354\212>\315t\220\200\262O?\231/\211\343\001\372oC\371\212\3559\2003\254\204\341>\025\260\311\356?\365P\362\"N\203s\232?\364nW.\241?\241e\200;M\372\224\344\243nN?V\340|t\212\251\274*\f\253Ct \024"
+	.ascii	"\316\025\367\3205/x\341]!\242 \224ui\342\205\275\303\253\325"
+	.ascii	"\034\356\260\016\031\315w\272s;\355\030B\347\272\260\213=\207"
+	.ascii	"\027<\232L\211\fr\223\3273a\0060\261d\\<WQ\"/\203\203\370\331"
+	.ascii	"\0020\245l\2258.\211\227\026s \235- S\032\034\312\241\224j\001"
+	.ascii	"N\311\350\336\224\212;"
+	.string	"\370\346\b\261TZ\243\200)xO\214W\275\254\213&\rK\363J\224?!\237=\270\037\003\275:\234\233`\326c\261\177\201\302\334~(\345\013\355[\352\320\223\233\372\261p\f\201a\307&m\356\313\363\210\016\022\372B\021DP\213\214\274\322\222\324\374\265T\272\022\345\325\225\252\253U\254V\251\252Z*Kj\024a\233\260\251\267x\245.\334_\n\321\256\t\311\343q\224\201\350\026\007E\304T\203\247\227-Z\345+l\335\031Jj\366\375\234\025\246\252\244\273\242\n2\365\037\300\f#\240\b\030_\252\270\243^\257\2262\370\367j\321\276F\230s\265\302\315?n\344l.Z\275\232D\273m\247\371\272\372]\315\007\246C\373X~\333\273tg\3101\314f+?\r\225\232\245\330\221\2110C\371\360\226\270A2r\252\242\373\244\206\002\221\326\351*P\352\365H\201\031\340\021I\342\032\3314\373|\235;\032\b\0028\004\252N\030"
+	.ascii	"\224\271\035('\003\273\222z\353*\021\274\n\007"
+	.text
+	.section	.gnu.lto_pidInitFeedforwardLpf.part.0.66.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`3\002\365\022"
+	.string	"f\345|G\340.'\035\3020\030\210\3039\\\360\202<\210\377\013\371(\300\036X\036\207\274\241\213"
+	.string	"\007\300-\314?+2V\177\001\325\366\371?\222\330\377\220\r6\314q\330\002\367S\214\300`p\331\006x\037\307\333j\226l\"eJ\001d"
+	.string	"h"
+	.string	"e"
+	.string	"\037\242\235(\307q\027\250\204\323nH\362\350\021\326\243\307\005x\217\371\017\357\321>\b\333\263\233iv\213\207B\373\244\031\023r0v\367{T\r\326w\341\255I{\247\031i\376*%w\r\033\256\366\256\363\330\335\016\034Og`w\317\364\364\301\351\244\002\360P\341\371\361\270J\331]\263,\334\336m\273\330V`g\204w\214\351.\246\365\341\2371\375\215"
+	.ascii	"!T\273\024\252\250\026(>u\370\322\177\364\264\357'\035\311gr"
+	.ascii	"ki\346\233\322G\320N\302Q <\341\342\026(\245\b\241\302z\004\351"
+	.ascii	"\212\356\027\315\374\234[\266\177d\223\223\331\215nr\300\326"
+	.ascii	"^\210<\232\234\320ntc\335\375\221\201\200\365\330z\314\207\263"
+	.ascii	"\023\345d\270\267\2335\355\213\b\235zj3h\220\267\331G\021\353"
+	.ascii	"\220\262\331\226=j\005Ejw\017\260\034\252\245\200\320\343\tO"
+	.ascii	"o\273\300\221WU\033\006\314\333:\005\221\2405\247\252\276\307"
+	.ascii	"\205\r\341Nnb\355.\212o\342M2>\207G\277j\362\266G\277\306{\274"
+	.ascii	"\236\351!PH\037\206t\262\312z\335\335Zj\2205~5\203\275\362\322"
+	.ascii	"\336\227\0021\020\207\245\213\2018\t`l\034\274\270h\270\\/\231"
+	.ascii	"\215\n\354E\026\003\2726\334R\"\003g\300\025\027\220\346\223"
+	.ascii	"=\200\001c\\\337\f\310\"\363\265\300b_\t\001\277h^`\237\354\365"
+	.ascii	"\202}\371\334YO\030X\350\350\216\365\3574\310qC\0249\307T\256"
+	.ascii	"4\252\217m\223<j\016\031M\361d\f\353\273\335]\325 \333#\217\272"
+	.ascii	"\322\253PZ\321\363\263\223U\376\310, P\002Q\254\222\033\317\n"
+	.ascii	"\342s!\022\201\330\342\231U\234\315\037\234\"\246\374Zad\270"
+	.ascii	"\305\024\311[\204\361\333\254}\024\236\306\265[\322\304B\310"
+	.ascii	"b\027\361\305\265\217\203\314\004Y8\204\255\225\006\276L\321"
+	.ascii	"\330\245'V\222\261\025.\360\322A\312\3477\366\333\310\367\231"
+	.ascii	"u\201\325y\277\354\"\032\216\033\330`\336r\325\336\023\024\036"
+	.text
+	.section	.gnu.lto_pidUpdateFeedforwardLpf.part.0.67.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\357\001}\021"
+	.string	"\366\342sF\360\320&\0358\f\025S\b2\342\b\347\211`\236\337\234f\376F\202\203\r\0357\262\n\265vX\350\251\211\255\251\2619Tk\213p\234\236\004x\016\213\303\235\247\307\262B\276\252\315\026\\d\341A\n'\226\354-eJ\001\\"
+	.string	"]"
+	.string	"^"
+	.ascii	"8AB\273\036\311\243G\262\307\217\027\300\036\363 \330\243\375"
+	.ascii	"\022\266U-\257l\032\367t\366_\007\f>6vW{T\020\326C\357\326\\"
+	.ascii	"\035j\306\225O2y\035@\347b\035\302\217\335\365p\321\300\004\273"
+	.ascii	"\373\357i\343\222I\r@B\303\023\344\221d\262\273\3166\334\330"
+	.ascii	"m\253\330n`\347\203i\354@w\204i\b\323z\357O\230~\007\001\004"
+	.ascii	"7\273\031\216r,N$\032q\240\337\276\017\364\036\377s\351G\345"
+	.ascii	"\020\032o]\255\227\377\343\237\270\317\352(\f#c\265\262\024\337"
+	.ascii	"M\215\335\025y4\203\3541\004\336\177\251\354R\3511\357\251\316"
+	.ascii	"\023\223\336\266Z\326\264o\342;\253\363\3048\356\006\212\251"
+	.ascii	"\035\341$\337\331w\001\343Q\324\331\346N\204\342\240hw\027\244"
+	.ascii	"|hE\323y\024\302\364\035\207\216\274\252\332\033\205|\0075\344"
+	.ascii	"\202\262\234\252\372\232\032v\313Y8(\333]\005\276\212\2578\371"
+	.ascii	"\"\036]!\225\357\036\375\224\376\373\201\027-n\354\310\344\221"
+	.ascii	"\365\272\273\254\324\034k\374\352\007\233\024\003\251\315\002"
+	.ascii	"\n4\231N\034\f\004\324\n\307\262\231:\234R\302m.\333\211\312"
+	.ascii	"\366\242q\023$l,&\315eCi\321RP)\255\304\200O/+(\215;\235PZ\311"
+	.ascii	"v\376\365\214hH\206\214\316X\177\2509\216!\242\310\005\030%I"
+	.ascii	"\243\332\220<j\356\364\030\321$\016\353\341\356\256j\216\355"
+	.ascii	"\221G%\351c|3j<\314\344\221\007$\f' P\202Q\312n\007\214\204("
+	.ascii	"\200\257\304\277\214u`\n\270}\305\273L\031d\205\251\241\026S"
+	.ascii	"$o\001\306\262\267\244\242\0276\n\253\361\036\227([`Y\354\"\322"
+	.ascii	"a\312\003<~\004\240\001\231\271\355^\022~rc\257\215d\237Y.0:"
+	.ascii	"/\227\355\242\331\270\361\r\346,W\355=A\341\001"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.69.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\036\002\375\020"
+	.string	"V\337nH\360\316(\035\333\231H\223\305:\253[\325\340\327\201\313\001\035`B#\207\352\270\031\222w\304\002\301\244\217\037\257\035\243\204\231\233\321Z=0\260V\357\323E\240\030\237\277^\377\277\004\027>\330\361\213\250+\300\302f\262\211\334)\005S"
+	.string	"_"
+	.string	"Z"
+	.string	"\36206\235b\177\031\371\270(7\253\264M'\331_F\254\273\037^rvG\006\237^ \372\264\177\302v\354f\231\355\363\021\267\277\211a\"\263\333]\360S[.\273JO\346?w\r[\n\3115@J\207K\322="
+	.ascii	"\034\273k\221\312=o\373d\333\202-\305SZUZ>\346\277\306\001\007"
+	.ascii	".vQ\206\202\026\304\324\031!7F\034\207\233M\314/\016\332I\211"
+	.ascii	"g\343\303\343\262\333\r\243\002\333~\315S\300\374\322\223\222"
+	.ascii	"Y\b\023\rNmg\267;\202\237\036o\340\373\024\235\300\347\353\n"
+	.ascii	"\340.\363\031\330Qx@-\310\304\356\302\244\237\213\331\243Q\314"
+	.ascii	"8\002=\320J\342\353\316Bg\273\276b\347\323\353<\235\372\334\023"
+	.ascii	"\324\202h0h\204f\256\363\362np6\rW\021\342\365\340v\267\001\316"
+	.ascii	"sX\276\210Oc\020\345m\342\367\251\372\231G \341\262+\321R\343"
+	.ascii	"\341*\365?2hL\204frH*\213\325\273\267\273k]\261\247\364\247\322"
+	.ascii	"\3630\277\027\376(m\240Z\")\203*\265\202\240\002\t=X\255\216"
+	.ascii	"T\330\341\022S$\243J\256p\025NH\205\"\240\353\243B\b\342\001"
+	.ascii	"\256B\n! \252%\202%\004f\211\250Z\240\213\305j\201#\333\362\336"
+	.ascii	"\352\212%\314\340\231)\315\252\312b[\200\274\312\335\342S\375"
+	.ascii	"\324\016/\310\333\374\334E=/\026\350\247\026, \200\202\0316v"
+	.ascii	"\207O\020\3536\037\262F\254\\\274\241\337\340\311\342\202Lt\177"
+	.ascii	"j\301\263\357\264\333\320<k\253\315\f\214\354'Q\0306\026l\355"
+	.ascii	"\300\307zC \363\301\235\341\226a\32243\013\315wc\343\022\023"
+	.ascii	"<I5\240\035-+\211\343\234\230Z\200\346@\214\224=\003`{\001r\372"
+	.ascii	"\247_k\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\221\004\345\021"
+	.string	"\006\332aF\360\316(\035\312\313\023\206/\330\2732f\006j\236\271\251\317\203\272\301\323\\\3346l\202\273\312h#\021\002\215\271\227\345\367\315\342\2608\234\263\n\361\t\360\t\360\0317\203\255~\364'w\257\334\377=t\355=iiK\031L"
+	.string	"Q"
+	.string	"O"
+	.string	"J\333@\"\254\035BX9\300\205\261\326 F\313\006\302*\037|\342\301%/\036\351`\020\330!ZU\365\271\030\266\252\272\352\256\273\321\357\373V\264X}\240\351\003\001\313cS\325Pw]\314\240\312\252 \342\202\272\2739x\005Uu\223\020\247\1777x\273\335\335\250\377"
+	.string	"\307\324\260\214\001\236)\30044\3742\303,2\274\022\303)\033a\030%\276\260It\341Xla\222\310\302\"q\205CV\205_).\033\n\263N`\266\026&\334Q\302.\330\335\021b\334\202]\324\340\223\"\347#a\216\221*\033i3\027\314\323\317@\242\376\006rK8\036Ld\374\016\246\306\377@n\374\020\274\324\317\262}\355\340|PI\n\336l6w[G\352\314\ns\227fA\356\322\272{\347\302\324\370\027\203\334o\310x$\317<\311\026\2263\342\246\307\353\231(\031\032\352VY\304o^\f\370v$\323\023\214L\257Y\220\232\016g2\026\351{B\266H.\322\267\023\t\370N\340\002|I\250\370\350+/D+\321\025\244\270\257Tq\007\340\355\bE\355\007\343\347\344\306j?\"\b\374%Y\232(\257D\306\237\ng\250a4\352\025\226$)\0246\306"
+	.ascii	"\003!\3326\007\021\320\240U\n\022\021\211\244\222\024\366\330"
+	.ascii	"\013\nI)\202~\315+\327\300k\367P=\211>Q)\035\026\346\263^\t\324"
+	.ascii	"\345\021|n\32561\250\311\265\277\247\222}\261?S\304\300\245\031"
+	.ascii	"\035J\300^\301\021\272q$|\262\003\332Z\376!\274p\376\355\214"
+	.ascii	"\023dg\3307'\004\354\320C\337)\362\264\"]\372\"'\317\3715y\316"
+	.ascii	"\257\311\237\214\212\254+\276\f\330\353v\365/\200|FG%e\231\005"
+	.ascii	"h\337\206\331\034\212j\313^MG\026v\270\225S\253\216%~39\217!"
+	.ascii	"BA\026\305\344.\236\332S\005"
+	.text
+	.section	.gnu.lto_.refs.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`Z\002u\r"
+	.string	"\206\027OA\360t\224\341h\004h\341\373\367\320\350\376\234\025\274C$-\206{\241\237\234\226;\2456\035-\217?\367\263\347\364$\016\213\303\342\360\033x\006N\334\332\252\263ekl\243d\230}\252\366#\331\204H\231\0020"
+	.string	"9"
+	.string	"?"
+	.ascii	"?\312\364Q\271\350uQ\371\203"
+	.string	"v\007\374\020I\017\225/hW\320\007q\035T\376y\375S\356i/\300\357l\275\323\265k\314\225o\345$\327^\253\020\023\325\347\211\353<\231L\245\022\351u\222\212\300t\035\220\227Y\246?\223\311|\360\340\037\333\372\261\034,+\\\177%%\005\345\365Q\312?i?F\177\023M\337\244|B{\204\006'(GP~\240\357)7%\201U\3268\240s\257\357\365\367\252\275\256\335\321\274qz9\025\020\240o-\200N\027%-V\300^\256\024\255\022$F\260B\200\370\320a\303J\203j\323\231\312\320\006O\003{xU)Ty/\304\034!\322\t\3711s\331\321\302b\203\306\214\023\030/JX\300^.\025(N\230h\211`y\340\260R\2450\224\026b\214\300tC\202\274\310\\z\304Zt\340\270\241R\312(9\005.\241\017\2017(g\300r\250!\300BahQJ\313n@\243\231I\036\020\330\f\303\001\020"
+	.string	"\226\261\327\316\3450\002w\302"
+	.ascii	"\330lm\025\352\314B6\305W\302XG]\374\n\030\273Q\265\350\252N"
+	.ascii	"]\331\324W\374\316\022A\360\374\212\236W<\255\020\302\212'\252"
+	.ascii	"4j\373\036l#\250u\023L\330\020(\226\221</#_\004\306\331[\355"
+	.ascii	"\205_\364\3250\253\345U\021C\r"
+	.text
+	.section	.gnu.lto_.decls.a1f17ce26ee991,"e",@progbits
+	.string	"(\265/\375`\233|\325\366\001\352/\303\263T \na:\215\001\345X\027\231`\343[\035\337\311\376\264\240\235\210\350\262\035\261\376\327\320\353\332\375lC}`\224\273"
+	.string	"(\317\266\355\004\200\363t\235\252\313\266m\333E\363\\W\257\325\342\344@\333V\315\033r\035b\362\370\222\342\366\264'\323l\333r\357-\267\224)\347\tO\013\205\013^Y7\355:\201k\263\345K\232/K\374\006\303\271wf\362MK\265\265-\367\354p\035\321\262\245\315\026.8.\253"
+	.ascii	"^k\027\312\205S[\333[jfrG\027\366\032k\263\235\332\030\311Z\030"
+	.ascii	"\t\036\343p\244\315\0338L\326\224\240}\301],\367\013\332\030"
+	.ascii	"0r^N\346U\3262\261\314\262\242\2551lY\353\332\335\273K\007d?"
+	.ascii	"9\025\300\354H\032\231\036\336\273s\275\214\340\3321\004\027"
+	.ascii	"\031Ks\222\243\215\021\234\244\352\n\251\004\227\0359\222F\246"
+	.ascii	"W&ka3\330M\001l\354H#\323K\303O\256\034\207\034c\224,9\262\226"
+	.ascii	"FV\226\234\262#\215\254\254\353\306\335\3145\254\b^\254\001\262"
+	.ascii	"\034Bd-\215LO\217\016\027\\\032Y\331\325\243\303\304i\233hf\232"
+	.ascii	"i\265\001jj?\361(\300V\227\215\26536\327\313\217Sr\313\270f\311"
+	.ascii	"\253\267\267\344\b\336\202\275\\9\016^G0X\326\302aX\b\2071\270"
+	.ascii	"K\306\214\331Z\032\231\336\231\235+g&\221i\024!M\226x\377\325"
+	.ascii	"\253\263dMI\305\016\211q\224\034kideY\313t\202\277vV\007[NX."
+	.ascii	"\335\3652\002-+y\007ga.\036\034\222\300\245\221\351\221\271\313"
+	.ascii	"\353\346\322M\331O;80\201K#\323\273P\334\256\254nZ\326\272O\266"
+	.ascii	"\213\265\016\340\306\354\020#\262\226\371\344\312]\272\256\355"
+	.ascii	"\324\206\203V\23342\275\275\223\277\311\254\205\353`\256\031"
+	.ascii	"\227k\215\350\226QE\211s\311\262\001\366\035B\323 .\375 \032"
+	.ascii	"\372AR\372@l\364\201\300\350\003\265\351$\221!Yubp>P\232>P\020"
+	.ascii	"}\261r\350\0134\2451\226Y\366\2331L\031\346\022\324NY\217;\234"
+	.ascii	"\225d\370AS\347L\031\316\377\241\243\221\230E0W\224\224>\023"
+	.ascii	"\211\231\205\203\374D\005\355-F\2054\221\230H,\303\\\303R\225"
+	.ascii	"b0\226c&\231y\304Lr\225&\022\323\210\211\304\244a\022\271tS\366"
+	.ascii	"\236Q\224\345\224F\246\227\301\303\317\236\236\224\272_\376\017"
+	.ascii	"\033\375\037:\375\037.z\310O\022K\214\034\234\377#E\027\341\300"
+	.ascii	"[\332\3103\201\230>\3140\363\207\031\304\344a\246`\n1w\230=\256"
+	.ascii	"\322\0243\277n\3160\265\314-06K\374\242+-\257\310\013\317\334"
+	.ascii	"\2521\227\267\324\241\004o\311u\267K7\345\"\271\344-\361\213"
+	.ascii	"\033foIS\314\314\221\342\275\255q\243\347\001\310\312\222\037"
+	.ascii	"Q\021\344\377$\365\177\216\350\377\024\321\377\021\242\377\003"
+	.ascii	"D\377\307\207\376\017\017\375\237/\375\037\034\372?6\364\177"
+	.ascii	"j\350\n\256\020\372\037*\215\223w\b\355\320\247\357\323F\247"
+	.ascii	"\311;\204^\357\n\241\030\354\n\241f\025\225\224\2533|8\337\207"
+	.ascii	"N\377*M\030T<I\336\274y\233\272I\365\207\030q\267\236\275\317"
+	.ascii	"\366\336\033|\316\346\264\246p6\237L\251\377*\320\323\232;[8"
+	.ascii	"\377\246\324\315\027\252\034\266\256&8\273\340Yr\206\205\006"
+	.ascii	"\316\367\351\242\377_\245\031eB%7Q\217\224\030\027%8\337\347"
+	.ascii	"\212~\234\273\375Wo\222+L\2248\337g\2116}~\350\373\320\320\367"
+	.ascii	"\211\322\357\301\323&X\234~\317\023m\"\257\020\372\236!\372="
+	.ascii	"7\364{\250\364y\340h3y\205P7mL$T^Hp^\252ann\320\300\371<u\372"
+	.ascii	"\"\354b \327\340;\214\207\331\\%\316\303i\222hd\234\235\271\333"
+	.ascii	"OT\320\256\242\352b\313\303j\356\366\023\225\334C\256VV\032Y"
+	.ascii	"\331\336\333\003\221\007\017\0364\032\0248W\277|\036)\372<J\364"
+	.ascii	"y\306\364y\220\372<D\364yth\223\207\206>\317\224\376O\216\376"
+	.ascii	"o\214\316\373\212\376\257L\3777Dg\254+\204\376\327\245\377\213"
+	.ascii	"\352\200\273$\201z\236j\\\031\203\363\325=}5\215\316`W\b\275"
+	.ascii	"\032\207\005\250K\234\2577\234\257V\321W\3154\266\202\257\\\345"
+	.ascii	"\267`75*\271\331\366\336@W\254\213\223\030\316W\307t\213\275"
+	.ascii	"\367\276\337\202\246\337\202^\335\322W\241tF\352\245\276\016"
+	.ascii	"\243\257\241\350\353%:\353!\372Z\207\276\226\322O\351\350\247"
+	.ascii	"l\364S3:\277}\321O\251\350\016M\264\007w\b}zD?\r\242s\312C?\335"
+	.ascii	"\322c?F\342#\230+\375B\207\006\b\316Oe\350\233\274C(\321\246"
+	.ascii	"\243\217\262\321'\330\025Bw`\0368\310\332\025\247!8\213\021\361"
+	.ascii	"P\255\341\232\253\203RF\265\371\300STR\300@\360\217\253\304>"
+	.ascii	"p\217(\"\265M\331T\020\235\217v\321G\251h\fv\207\320\013\256"
+	.ascii	"\020z\276]!4\307e\273\033\026\323F\207\036\316G\325t\317\025"
+	.ascii	"BO\024\211>\272C\037\275\322\350\276Bh\r\"\t\240I\343\302\371"
+	.ascii	"\250\223\376MN\241i\341\2503\344\026\246q\225X\013\317\230B\244"
+	.ascii	"2\331Q\366\002\315?\343\350\237c\364\217\235\216\261\376\313"
+	.ascii	"w\373\260\f\f\266w\324\336\033\303\217\027;P/p\216AtN!\221sp"
+	.ascii	"\376\271E\377\262M}9{\362r\223Pw\373Q\367\216\213C\356\275/\342"
+	.ascii	"/:\246\302Qw\003a\306vB*q3\215LYc\246\267\367\376\217\257\260"
+	.ascii	"\025\256\3020\256\022Sa\027\307/\260\324sr\357*{o\017\036<x "
+	.ascii	"\342AK\212\351\362\313?\205\350\273\357\020\032t\205\320\237"
+	.ascii	"_\372\247\r\375s\206\376Y\245\357\231\242c'\363\215\313\013;"
+	.ascii	"8?\333\321\346\276C\250\007W\bE\261\310\350g+\372y\211~\336\241"
+	.ascii	"\321\344\025B\237\247\364\3157\372f\235\276\t\247\321\267+\204"
+	.ascii	"^7\337\202\3016\206S\006\027\264(\234C\024\375\266\021B\261\272"
+	.ascii	"\222{\312\336\033\b-\323\262\203\016\3167\317\364M#\372\246\017"
+	.ascii	"\375\267;\204\3364W\315Ufp\327\374\236\271h~>%wr\357$\020\026"
+	.ascii	"r\247\355\t\3167q\350\337\fP\263\257\357f\200\336\234\241\203"
+	.ascii	"\356\020\212\257\020z\363I\177\271\324(\335\025B\257\027\247"
+	.ascii	"\217\247\350+\207o\230;\367+w\301<\304\210\367D]\271\274\367"
+	.ascii	"\323\275\026\374\334k\301\271\205\310\323\0234\037;\321\307G"
+	.ascii	"\364\345r\273\\\345\0047\356!F\334tr\262\317\366N\002\371\360"
+	.ascii	"1\341\333\303\371XL\377N\200\336\276;\001z\\C\177\312\035B\217"
+	.ascii	"\2374\272\274B\350o\032\375{E\377\"\261\202\371\364\302x\351"
+	.ascii	"+\345N\271\312[\345R\371U\273\311g'`\233m\357\244\217y\004\007"
+	.ascii	"\22228\377F\351\337\266\203\200\314\036\361\r\350\337\016(P_"
+	.ascii	"__\337\355\200\236\004\235\356+\204\236\356\016\241/\322\317"
+	.ascii	"\240\217u\005w\b\315W\bM\261.\332\177\315\356Y\007s\312\nlO\331"
+	.ascii	";Y\301\207\316\031\2502\234\237\274C\250\276B\350\177\032\225"
+	.ascii	"\376|\346\317hN\017\374g\007\376\223\035\003E\303\227%8\375/"
+	.ascii	"\320y!\350q[.\374\252\220-\377\225\373\257\207\377\346i\370o"
+	.ascii	"\210\037ox\034N\362c\024\310\177\323\340\265\037c\371O\"\243"
+	.ascii	"\377\"\371\357\317\177^8U\374g\205\340\177\307\376\253\301\177"
+	.ascii	"\372\234\034\370\317\037\360\277\3103o\340\277dW\311\217y\376"
+	.ascii	"\273\004\007\235\032\370\357\227\\\205\275\344;\177\216qf\340"
+	.ascii	"\277C\376\333\346\277j"
+	.string	"\031\316y\302\211\001L\366c\261?\303\300\025\234\027\370O\013\374Y\353\254\300\377\fN\n\374_\223\201 \375j\004\376LwN\340\177\230\270\247\277\372\344\277w~,\345,\352\373q\223\377\352\375\330\307\217\203\374W\371\343\013\377\255\3748\371_*?\326\361\337:?\316\362\3379\036\377]\3768\354\307\367\307u\377)\201\377\272\371\317\024'\374\030\350\307p\377\205\363\343%\377]\363c\363\307L\376{\345\307q\377\311\200\337\fC\361\343\t~\334\366_-?\266\373\257\335\217\351~l\301\177\343~<\345\307B\376[\367\3435\377\265\363c2\377-\363\3432\377\245\373\261\362\307B?f\373\261\372\3433?\356\371\261\232\377\202\371\361\327\2177\374\030\355\307"
+	.string	"\3701\227\377\336\375x\314\177\303\374\027\315\217\253\374w\314\217\361\260\223\037\023\375\370\307\177\337~l\366\343\337\217\313\376+\346\307b~\\\341\307T\376\013\367c\"?\226\340\277\020\370\361\220\037\373\374\030\312\217#\370/\212\037\303\371\257\034l\346\307o\376;\347\307E\376K\347\277\024\340\267\037\017\375\370\347\307Q\376\253\006#\177\374\037\347\037c\370\261\222\377v\340\307X\327\003?\226\361_\245\037g\375w\370\337\342\177\311\374\367\0038\306\177\232\360c+\377\031\001*\377\303\374\001\033N\b\374x\316\271~u\313\237\275\234'\216\376j\222?k9M\3747\313\3770\377\355\222\342\377\232\373\374\252\217?\253\371\221q\234%\3749\004\\\247\003\016\364\253r\177N\341$\341\277l~\214\377\373\345R\375\227\357\277UfX\006?\236s\241_\205\300\217+\370q\320\237\263\316\006\234%\314\260\377~\365"
+	.string	"\3779\302\177.\340?\213\376\023\304\177j\370\317\f\377y\341?-\374\247\317\177\362\374\347\371\237\3773\337\237\343\374y\314\237\227\177\316\373\363\335\237\325\374\371\313\237\261\374\371\307\237\355\376L\346\317`\376\274\345\317U\376\314\366\347\263?7\3713\222?#\377\f\344\317_\177\316\361g\256\377V\375X\316\377\007\3749\353\277S\376\033\347\277V\376\353\345\317[\177\326\3721\372\347\031\377\215\340\3171\376\\\365\177\303\377\270\377k\376c\360\233a\177\206\361g\252\037\357\375?\341\307u~L\347\307z?\236\363c\001\3748"
+	.ascii	"\377O\374?\373O\342?\230\377=}}}}\177\232\342\227\300\314\217"
+	.ascii	"\001\024\001\357@G\377\351\234\034\017\037Z\016>\2714\314O\232"
+	.ascii	"\021\253\0368\277\303\030\375\016_\364;d\321\357PE\377i\227\247"
+	.ascii	"q\271\355l\243\002#\205s\312\245\350i\027\027@\254f\340\234\301"
+	.ascii	"\025B\337\001\212~\207d\212\345\315\230$o\007\316\357\020\004"
+	.ascii	"\356\315\f\262L\203t{\372\346\264\206\n\2320*i\025\245\232d\253"
+	.ascii	"\355\016\347w\270\242\242T\317\234]\221\323\366Ti\306\321\221"
+	.ascii	"\002\021'j][n8\277\303\2134\312%\333\313\340N\377*S()[\024\035"
+	.ascii	"'sO\236\262\375!F\\\271k\226W7\007\347t-u\242\2212\234\\8\361"
+	.ascii	"\021\007\206\357FRmcF\f\220$z\347\343\310\0253\234\237\301\234"
+	.ascii	"&3\245D1\301\371\177zv\225)Zz$EK\221\244fa\032\334\260\342\253"
+	.ascii	"\321\263\251\350\300\345\374\247fi\223\0301\226S8\247L\32404"
+	.ascii	"\266\274\340\374\f\214\350?]r\225iY^\207\035c3p~\234T\311\177"
+	.ascii	"\025\3770\303\246\016\316\177\252\344i\022\254-\305\006\316d"
+	.ascii	"i^\026\031'8?\203\034z,=\202w<\225\311\302\371\031\334\320\317"
+	.ascii	"`J?\003(]\004\005\3432\263\302\371\030\314\321[N\351\216zr\005"
+	.ascii	"\271\205\356\245\233H\252\303\212\rR/H\352\225\202i\021K}\244"
+	.ascii	")\244@\322!)\221\364G*\344*\323 \351\216\34794N\032$\345\221"
+	.ascii	"\3660\327\260\264\224'b\226|A\320:6R%Vl\220zA\322\247\364\306"
+	.ascii	"\006\250\251\275\271P>+6H>:\250\336\217S\205\275{\350x\273\013"
+	.ascii	"\202\316A\365\212\244M|\334\364X\216Y\310i\230z\346M\216)8\037"
+	.ascii	"\203<}\f\310\350c\300E\377)\330\323\257\021\330\344p\303Y\307"
+	.ascii	"\257\355Jm\r\347c\240\324i\216\024\007\217\032\030;\017\347c"
+	.ascii	"\220\246\217A\023\256\324F\332u\225\351\215\251\024\206Yz#\265"
+	.ascii	"J\267.]W\320\336ae\310\364F\n\225J\325\245-\367\336\031<x\360"
+	.ascii	"`\322h\002\204\216\316[\351\325\225\023C\347\254\330 \365j\244"
+	.ascii	"Z)\215\253L\267\322\031'J\267\322\254\252'D\322\2554F\212\025"
+	.ascii	"\004\rc\305\006\351\001\227\301qw\247\36318\242\217\201\020\375"
+	.ascii	"\253<^*\343yYH\230\032h8\037\203\024\3641\370\322\307@K\037\003"
+	.ascii	"\031:\205\221F\325U]e\n#\2452\267\240`\341\221\3631x\241\217"
+	.ascii	"\301\223\376\237\276\270\312T*u"
+	.string	"q\223;\225J\243\256\227\rP{\353 \202\326\261b\203\274xk\222\350\310\371\034\276\350s\300\242\317\241M\237\203\232>\2072\215\366u]qI\342|\016@\364\035\324\316\361\314\344\221\275{x\375\274Y\251\321\241\307w\225\350\235\023\021a\273\034gdr>\207'\375\013\366\364/\200\243\177A\236\376Q\275\353\005\327\311YA\341\374\013\354\364/(\243\317}\207\320_0\247\177\301\026\375\013\254\3506\370\r\203\275\331yQ\003\347_\320D_$\232w\364\356\316\320\262\206\005\347_`D\243iP5W\231\001u\003\004*\013\347_\360C\203`\357\233\001\275}}7\003\372\013\274\364\031 \255\034R\246p\376\005/\364E|A\345\3145,\255\374ad\211\326\241f\256\022-\203\316%\3212\250\030\224\314\006\252\275y0\371YZ\245\351\351\355\235\364@\344\301G\251\267W\003\315t\350\030\240*\"RB\246\320\241\351\013"
+	.string	"\210\006\203\206\3013\240\004\021"
+	.string	"\0160\002\330\322\027\300\223\276\311+\204nA\271\334:9u\250\336lI\003\207b1\223W\274\220\001\003\347f\005\275\302\023f\246\r\211\363\003\260f%"
+	.string	"I4\335\017\217\224[\030\025\234\037"
+	.string	"!\372\001\310\241\037"
+	.string	",}\013\356\350k\001\036\372$\327\220\363Q\004\347[`F\337\202.jh\022\210\256\b\227+8\337\202)jfg\227\314\205\032\031\316\267\340\207\376\2176\271J\324\f]\202\232\241e(\223\rT{?y\2454\254\202\224\351\355\275\211<\\/0PbrF\231|\341\26743\222\340|\013`\350W G\277\0024\372\322q\321xS\321\257\340\211\256\320u\205\320\\e\211\216 y\207Pl\207D\201\240?\314)I\270)\234S0\307\220yu\301\371\025\020\321\250\017\264\007\332\204\r\024\026\316\257 L\277\202\032\372W\201\223>"
+	.string	"\336\350\037"
+	.string	"\3444\232\003\305\341\346\246\206\205\263\027\017\032\036]\\\340|"
+	.string	"\264i\224\013\235\221\343\364\226{o\224\013\325\302\\?\352\336=\330 Q.4\013\007\371Q\367~\242\203Dk\240]\350\r\324\306U\242\\(\r\224\013\335\3022~\242\222[\353g$l\357\254G\211\035\224\253_>"
+	.string	"\276\364\001P\245O\201\035}\n\324\350S"
+	.ascii	"F\237\202*\232\247L\237\002!\272\207\002.}\n`h\237\t\352\350"
+	.ascii	"O\260\324\237\200\214\376\004S\364'\030C\237R:Ue\306\340\374"
+	.ascii	"\tP\247?\325\220s\303\371\023\\\351\0370;\372\007i\247\212\312"
+	.ascii	"\245\357L\325\336\225K\315\270\204M\2513\001P\262\306U\017:&"
+	.ascii	"\214\013C+j\f\347\377\324;\347\244V^zX\301"
+	.ascii	"YN2*\216\226\27468\177\003\033}'g\312\322\334:\241\314\350\030"
+	.ascii	"\023d\212X\021\264\345\345\263\303\304\334:\267\330\322\334:"
+	.ascii	"\235\200\334\341}A\302}\271\203\034\203\267\234\313f\322,\305"
+	.ascii	"2\022\315Y\026SR\004.L\235$\0321\313$\206\323dY\267\006\tw\316"
+	.ascii	"e.\271\313\217S\320\336?\250\220{\357\271L\346\0169\227Fn\t\227"
+	.ascii	"\345\364\220\227\217\016\332\022-\253\241\301\361\237h'\333)"
+	.ascii	"w\3628\337\234;\316\261\323\315\251\346L\236q\347\226s\312\231"
+	.ascii	"\346|;\315\316\024N!\347\332\371u\3768\305\234HN\262\323\355"
+	.ascii	"\004sj9\221\247\2173\354\354q\2269\261\234e\347\222\023\357l"
+	.ascii	"rz9\355N\3459\346\034r:9\357\316\272\323\314I\345\\sB9\321\234"
+	.ascii	"`'\2313\355\354r\346\235J\316'\247\332\231\345\004r\236\235E"
+	.ascii	"N\"g\2243\316\311\344\254r\322\235p\247\221\363\314\331\346\264"
+	.ascii	"r\0369\245\234a\316\345\311\346\344r\3029\333\316+g\2223\310"
+	.ascii	"\371\345\024\273\312s\356\364\372\211\343\314\361Cin\365\005"
+	.ascii	"Y\242\235s\231-+\315$r\004)2\226{\357\242\323\206\f\270K\267"
+	.ascii	"\207\324\202\244\tr\357d\236\313k\300\230[\347\323\227\330\030"
+	.ascii	"\2322\264L%\306\362\256\315\225e\206\273Y\246\226|u\316\304\226"
+	.ascii	"\240\031b\344\317\331\211\215\242\271S\352\254a&\337J\270\360"
+	.ascii	"Z\362\341;e\313\313\247\227\266\234\313e\324 \341n\035\035\244"
+	.ascii	"\271uF\345Hb\004in\361\rY\306i[\316\235\261C\232)P\271cc&n\216"
+	.ascii	".\317\f\b\022\357\210\031\362ni\306m\304\237\347\324\230\tc\242"
+	.ascii	"\235:~T\311wn\252,\305\312\204 \341\300\330Y\3469j\313\270>d"
+	.ascii	"&\3733\234\027>\344]\236\227e\321\311e#\243\255\335\020#\222"
+	.ascii	"\206\226\364B\232[w\210,\321\252\3447\251\253\345\336\233o\317"
+	.ascii	"l\271w2\337\275\241\202\314wp|(\227sY\f\233%\232\037b\313\256"
+	.ascii	"\256\363\306\275\373y\n\332Q.b \363\335\034f\203be\211\226\226"
+	.ascii	"C\214I\020d\206\303b5\344\317pZ`\300e\251B\242\001iC\226\021"
+	.ascii	"\202F-\373\370\363\234\235\231\271,6\227\317\320|!\367N\022\241"
+	.ascii	"P[F\270n\221\374\r\\\264\nv\207\320K\343\n\241\337\320\246\277"
+	.ascii	"\241\211\376\006\037\372\033j\350o\200\322\3779\365\263\306\177"
+	.ascii	"\2728_\234[W\245\341\005\313\025\234i\230|0\256\240\341|\rv\364"
+	.ascii	"\3773\353\304:g\2342\256\362\324:\255~^a&\307#`\204QY\236Zg\214"
+	.ascii	"'V\226h\250\256\227\037\247\240\rUW\005\271w\362\324:\253\256"
+	.ascii	"\227\017\230\354 \362\340\301\203\207S\254\313M\335/_C\035\215"
+	.ascii	"\276\321\327\320F_\003"
+	.string	"\033}\rx\372\252\025\375\234\312=\344\310@\202\3635\244\321wy\207P\n\256\020z\r^\3645\254\351kH\242\257!\005}\r[\372\032\\\350K\320F_\2028}\t\326\364%0\242/\001\230\276\0042\3643\360\351g0\243\237\341\213~\206+\372\031\230\350g\360\241\237aK?\303\326'j\243ODF\237\250\212>\021\232>\321\020}\"\033\372DW\372\030\340\350c\b\243\217A\251\217\001\251\217\341K\037\303\225~\004q\364# \243\037\001\026\375\b\316\364\337\"HA?\002*\375\2419\372Cq\372CP\364\207\220\271\313\237\267d\037\327\213\321\210\215(8\177(\2106\257\020\372\241/\375\241,\375\013|\372tW\b\315V\362\225\253$\312nd\240b\340\300\371\027\346\350\020\354K\204\276\357\022\241\277 F\377B\024\375g(\317\312??\271Zr\033\007z\202li\211\3019K\311S\236\333r\224\235\333>"
+	.ascii	"\333\373)\267\001\331\331\373\t\350^\013\356\265 7\t3\242D\363"
+	.ascii	"/\254\351kV\364\f\005\250\316-N\021\234\177!\211V\257\020\372"
+	.ascii	"\013=\364/\320\320\277\020\245/\004G_hN_H\212\276\320\021}!."
+	.ascii	"}\013w\364-\254\321\267\360\246o\341L\337\302\020\r\302\035B"
+	.ascii	"o\241\206\276\005'\375\ne\364+L\321\217S\242_\241\207\276\335"
+	.ascii	"\035B_!K?hO\337-F?H\212~P\017Mt\207\320?\367\310@Ge\241r\206"
+	.ascii	"\363\237\303\360\344L!\202\363/^\336\216\"\223Mk\314\331\230"
+	.ascii	"=\314w\3458pe\215\251CsJ#+kr\275\230Id*E\254/M\r\217q\370RV\301"
+	.ascii	"oY#\274\332$\277\262\322\310\312\322\330\340\260\030\\g\343\210"
+	.ascii	"\02680sm\322\310\364\240\334(\367\212V\021\334\233\033\207\311"
+	.ascii	"\2214\262\262\274M:&\225\274eV1\367\3147\031\313\214c\336\345"
+	.ascii	"(\323-\3530\267\230i2\017\323\213i\305\314\31342\214|e\2061\263"
+	.ascii	"\230q\246\226<e^1\277\230b\3146\371\311\344b\316\231hL6\346\035"
+	.ascii	"\323\2149\306,\223sd0\023/\343\3107L>\363\214I&\3330\341r\225"
+	.ascii	"I\227g\230X\262W\216\221\271L8f\027S\317\254c\256\3115\262\214"
+	.ascii	"\354\224]\344.\263\316\234\223_\230v2\225)g\266\231rL\273\374"
+	.ascii	"\225\245\314\245\251&Ce+\023\214\351\306\3543\337Le\336\221\263"
+	.ascii	"\2562k\231QnJ1\247\234(\271wT[V\032Y\231\tE\013.\215\254\f\313"
+	.ascii	"\315\242v$\215\254L\f\235\2151idzJ8\234\345i\006\007\2577s\230"
+	.ascii	"d\231\235\231ekP\244\344x#\207\311\016\374\006\317\341\032\223"
+	.ascii	"F\246wgc\254%Yide}Nidzo\342LA&\311\254a\021\203\266\303d\322"
+	.ascii	"\004.\215L\017\207\216\2611ideb\306\330H[\313\262\226\205\323"
+	.ascii	"\360\232\230\336\322\b\331\2304\262\2627r\332@ysJ#+\003\023\006"
+	.ascii	"\1779\3358\244\214\3418\333{\177p\263\240ONp\276p\376\221\251"
+	.ascii	"3\244\214\274\341|SF\230\2137\234\377\201\224\337\221\337\021"
+	.ascii	"\365\007\221^\214:\034\021\250\301\344\t\316\377\240F\216\377"
+	.ascii	"v\344\370\0311\353nrw\2019\265)\300\222\030j|z{\252\253\303O"
+	.ascii	"\025\033\036>\200\374g\344\277\"!F\034o\230B\224(8\377\210\374"
+	.ascii	"\212\275\2112\205\363\177B~C~U=rW\205\017\347\213\230\243\177"
+	.ascii	"A:\310Qg\207\035\234\377\023\003B\206H\022\234\361\375\026\364"
+	.ascii	"\367\343x\370\nK\222\0348\377R8\033\237*k@p\340\3748?\037sau"
+	.ascii	"P8\377x\374\302\256\362`~=\236\004\372\301\"\325\006\006\347"
+	.ascii	"\213X\352\337\203ACp\017\006\375}\375\007\366\253*\026\035>x"
+	.ascii	"\340|\021v\372\377\351\370\325Ty\306\013\211\363E\324\351\213"
+	.ascii	"\b\363\363\372y\375l\224!}\216\224\261\242\025\245F\215\237\r"
+	.ascii	"#>uw\276\344\272\376\263\321\343\"L\033/8\377\270\312h\320(\222"
+	.ascii	"\346\220\333\033\303\371\"\202\310\220\361\233\021d\251v=\321"
+	.ascii	"\n\313\372o\006\024\r*\234\177X\"p\\]\211\001\351@\223\267\205"
+	.ascii	"\363E\304\370I\375\244~UxH-E\211\303\353\007\343\277\252< 'V"
+	.ascii	"_\350\340\374\243R\213t\241R\273\203\363o\352nqN\254,C\324\371"
+	.ascii	"=\375\236~.\210\364F\203\222c\311\363\003\307\231\030\277\250"
+	.ascii	"\377\\\344\001\225\361Q\331\302\371\007u\367\333\277\255\306"
+	.ascii	"!\322\033\315\f\216\345\336]\035|\262\240\221\241\203\363C\314"
+	.ascii	"\231\243\362\021\351\215\366$o\351\342\310\230\224;W\371\316"
+	.ascii	"\222P\341\201\263jG-\322\303\346\344\255\ngu/\3714\007\006\316"
+	.ascii	"j\035\223\r\310\024\033\316*\035"
+	.string	"9\"Z>pV\365T\031\232*I\2163+n\334\250q\336~b=\324l\201s5N\336ag\343\007\316\352\233\273]Y\263\023\022\002M\377\352\362W\251.\325.s\nlg! \213\326\336\031P\335\027\216*eyy@\026X\021\033\303\371!\220wwwk"
+	.string	"\230\213\265\002l\311bk\274\302\340\374\020<\264\0325\352\217\273\267\005.\270H\025\250,\234\037\202\206\376\3252W\251\226Q\355:\200\355\031\037\320i\343\363\305\013\306\022g\325\356W\315\250gT4\227G\n`\266\225-H\354\340\254\201\356\016\241\346\331\025B_dGN%#\247\216\231\233S\307\004m(\274;\344\245\002\342\244\215\356\352\230\\f\017\206\033\316\252\230\353\345\267\206\r\030,x\372E]\272\250`\272\250_\342\036\247~\321N{;%\267\f\013H\256\366\342\312vWW\007\254c\367\225y\271\372\245HM\277\b\354\212\232\345\212\272E\313\325-\246\\\22016\234\037'\253\215u\245\200\263\233\233\212\005\310\316\331\005\346\313\n\356*\226<l\267\267\003\016g\365\355\336\345h+\333\302\371q\256\227\377\352\031&\347\316\r\347\027\301\320\367"
+	.ascii	"/J\024\265\n\023\244\212\306\306F\016\225\253U\310\330`\263\201"
+	.ascii	"\263*EU\376W\323=:*7\252Rm\343A\303\351E\214\337\026\222\027"
+	.ascii	"n\246`\027Wm\007\\\337\\Z\232\312ff\b\216\203\243\222\203\263"
+	.ascii	"\312\226\202\231\001f\013\316\252\232\352\344g\314\313\223\022"
+	.ascii	"'k=hL\244p\210\251X\354\3248K\342\036Y\312F\035$ngg*\262\016"
+	.ascii	"\217\222,h\340\232\220\235Lmr\203\222Pf\276\220?|i\300l&W\233"
+	.ascii	"\374\240\330\361q\207\263\232D-\353\321\332\241\347V\266\304"
+	.ascii	"<B$\006W\2158fyP8\253J\360\f\274\030l\354\340,\004\t\022\223"
+	.ascii	"\352\006%\241\352\326 "
+	.string	"\367\356\352pn\231\275P\203\363=\360R\203<\210\212\274N\266\214\rj\3115n\364\366\356\352\320\203f\211\207\306\310U\244[\317\324S\0344\234U!j\221\377*PX[\232\032ET\"p=\200<\r\261\343\345\006\315\020\363\213\214G\023:\234=\240\332\241\002\331\241\376@\367\276I0\031X\273\013\253\003\017\036\352\217\273\261\344\240]]\035\200h\024!\322\227\302\325\037'\022G/\b\316\217\243\372\370\257\362\314\335\230a\347\243\207\335V\214\"r\222$\340\241uQ\303N\257/D\342\336\340|\020u\364A\224\321\277\372u\225\352W\332\243\001`O38l\331\021\267\301\017\016\251\253=\234\017\002\213\276jC\275q\325\353\252\227\232\003\316\325^\234\336\356\302\352\360\2538\256\346\310ujg\354z\374W\3219\031v\352\340|\020_\372\377=\376\321\375\204\265\367\236q&7\026T\017\372\337\337\363\336\016\277\3175o"
+	.ascii	"\376\347\023@Mqo/8z{\357\013G\217\271=yU\260\377\277\303\336"
+	.ascii	"Nw\357\2155\305\306\303\251\302\024\333\323\236\202B\227Ua\212"
+	.ascii	"\215G\326Tr\357\300\260\331z\354\251$\230S\006s\332{;\341\235"
+	.ascii	"\334Q<\262v\024\230Sq*\271\261v\022\314)hGe\005M%\237\234\246"
+	.ascii	"\330xd\335)6\260\254)6\260\254\n;j;\355\250\247\035:\n,k*\fX"
+	.ascii	"V\320\024\333S\326T\024\217\254\233\004\333wL\226$\017\247\027"
+	.ascii	"\233\355\311g\357m\225D:\365\354\375\204\265\235\310\340\253"
+	.ascii	"\315cy\265u\354K\307$\331c\357\3554\305.\fLMBm\272)2\260\244"
+	.ascii	"\027{\333\355\253\017\234\256Sr\357-\265\241\234\356\336/\222"
+	.ascii	"X{C\201q\240k\357\275\301n\031)\254\355\263\243\236\254\240\302"
+	.ascii	"\300z^@\201Im\262\035w\357\275\263\246\330\302\300\212\340\242"
+	.ascii	"\260!7T\322\351NY\201m\344\266\343\201\245\331\234\356\033\037"
+	.ascii	"6!]V8\253\\SUXj\340|\020R\372W\267\224\352\026\346\272XwSU]\021"
+	.ascii	"Y\356\335\265A\256\261\f;\203\363?\354\351_\245\201\271\214h"
+	.ascii	"\351r\203\365\253T\261\324\031\346\024\330\2361\"\313Z\327\006"
+	.ascii	"(\2352gq8\253Y\032\312,/\007\316\377\220\247\377\241N\215a\266"
+	.ascii	"Yc#\f\347\177xS\257\222g2d\b\001\3039\311\363\246\243\215\006"
+	.ascii	"\316\277\n\343\254\341\344\205\027\316\250\233$o\266\f\2540K"
+	.ascii	";ZO\337\321w:\215\336\323l\364\033MG\267\321u4\237\266\323n\264"
+	.ascii	"\034uJ\303\321}z\215\352\244\227:O}\241\361\364\034\025J\307"
+	.ascii	"\321jT*5Ju\241n\365\351*U)m\346\372\214F\203\241h'K\262"
+	.string	"\234\221!Rd\251\241\250R\346\032\226\003\2364\321e\222\214\361\bC\201T\300\344\311\336\231\236\256K{d\201\220\344\311\027\030\232\303\\\303z@X\334r\357M\005\303\003\264\261}\347\332\365\235|V\313\263O\225B7\n\365\201Z\030:\205\267<\373\320\027\tx\263wVv\3361\023\001\250\275\2632\245f[2\226\264\212\361f\357L\225\322[4]\005K\264\266\f\035fcI\027P{gzV\252\024ze&\3155\254\022\240\354\226RyK1t\b\023\255\27534\352\0025-UJ\257\351\344\214\016K\336\354\235=y\262w\246w\366\251R \250\325}\355`\362f\357L\357\205*\245\307p\260\004j\357L\357\354S\245.\033\265,{gzT\252\024Z\005\002Z\330\336\031\021\007\334\362\234H\344\277I\336!\364\247\354\n\241\377\320\246\377\341L\377\003\021\375\017:\364?l\211\361\341R\276\271\203\363?\300"
+	.string	"\243\345t\030\375\345*\365\234\366r\235Ek9\343\022\006\331%\355\001fY4\247\245h,\227nJ\326\"\267\324s:.\355\361\005\311C\007\215\353\315/\277\203>\375\016\352\350w\020G\277\203;\375\016\306\350 \272;\204b+\335v\215\345G\307t\024\r\207\317l4.p~K\233\274\325\261\203\363;\320bE_\271J\355\246\251Di7\255$qfE\273\351*8\256\326\304\351\231Y\304\340\250C\363;@\352w\020\246\337\001\016\255\247\024]\267\361\321\251\232\2023\020\r\035\264\357\020\212;\230\322\347\300\216>\007e\3649\210S\313vZI\242\340|\016\250\350\377\032M\237]\245N\3239\216\006A\205\3504\255C\233\231kX%\324}-u\032zD\343"
+	.string	"\341\005V\211:\035K\0178MF\035\02147\341\371\202\306*\007\316\347\200\211\326Jt\022\374\026v\003\251D\357\320Hlh%zL\004\324\336Y\231f\242\313\364\222\253\324J4\331Q\"h\221"
+	.string	"\274!\223:\237\0031}\016\270\3649\320\322H~\375\245\301\364\021\f\006F\255\353\rg\344\317\016\324\233#8\237\203*}\021>\274\336z\300\250\263\022\373\026s\rKG\t\273Z\236\205i\":\210\036\242\213h#W\251\205\350\024\256\177h \317lZ\210\346q\267\rT{\307QA\273\254\202\224\351yHu\220\211{\353\311\347@J_\260;\204^\350\323\337@O\177\2036\372\033\250\321\337\240N\177\0031\332\244\273C(\002\256\020\372\r\262\350o\020E\247"
+	.ascii	"\304\306.G\017\234\223\244\241kCR\276+3,=\2647\370K\307\225\031"
+	.ascii	"\326\030){\313\266+\027FgIF\265\324U\250\022\024\315\\\303z\200"
+	.ascii	"\217\251e\224)u\220{'\321$PR\275\263*\250\233\230\245\256B\345"
+	.ascii	"\244F\236\304\322\033WfX\350\330\324\275\333\340bo0\035?\032"
+	.ascii	"hp\352\256\240q\272"
+	.ascii	"\n\265C\357~\236\222\033+Ure\206U\206\""
+	.string	"yC\263\324\315\251\245R\324\322\032WfX|:\206\316\322\\\272\206\366J\3734\fMC\333\320[\272K\277\320Z\372JG\351\255eh'=\245]\350\033\032K\317\320O\332JKi*\ru\225\272\n\355q\324\b\212D\223\240NP\266\264\316\225\031\226\336\2254\013\b/\260\324\030umK\224\315\022mc\256a\225\b\3632%\265b\226\322\2702\303\322C\243\240J\224J\220t9\3064\323U\250\033\374e\256a\215P\027\027EW\241Z\320.\346\032\226\246\002%\267\334;\251\253R-\251\035\020^`\225\020\246\266\334{\247\3104\r\204\027XjU]\0254NW\241xh\236\231|+\021\366e\211\306\351*\324\013\212f\003\325\336=\232\244eWfXzh\022\324E\035\237\311DW\245w\256\227\034\277\256+\263k\343I\0335\004\344o@C\247{D@=~<\231\301\371\033D\351-i\234\231D\216"
+	.ascii	"\025c9'\255\223\352]eJ\347)\235\324K\212\007\302\013,\b@]-\351"
+	.ascii	"\244r\036\006\007\372u\245\004"
+	.string	"K\006\017\036r\024 ^\276t\276\2076}\314\304L\206K\007D\001H\250$\3250Y\246x\351\227\264\314\006\250)\023qU\320|\313\217\2727\217)\3104M\226v\035.\335\024\022og\313\024/]\363-E\312\226/\360\3223\0318l]!\t\243\227\276I\343\244y\251\233t\231\266I\341\244l\2562\305K\357\316(P\364\366,\344{\210\322\327\340\216\276\006q\3645\300\323\327\240\214\276\006r\372\032l\321\327\200J\035\021vbCF\006\316\327\200.\035s\225)\2314\f\221\b0\351\034\036\222L*&\235\353\321\201\334U\020,\017\346\2255p\240\2409\253\222\212`\313t\302B\033$*\035\235O\372`d\004at\224\266\307!\321\350\024.\261\307\374$\243a\320\250b\310\266\304a\217p\211=V\260\032\203JF\253\260\202\342\0221\350I\037\216JJA\243\2446\270\004\342\210\005\261\230\237\364\201\035\222"
+	.string	"\324\036#PRb\032\016\211\303\264\005\256(\260G\224\005\321\230\324\022\207\351QpU\312ME\243\245u\t\035\022\341\023\302g\004\023L\b\265\354\220\204!\033,\341\323\262C\022\202\"\320\256%\200\210\306&\244\234\372 \261GC\242\b>MA\2431\204\245\265=6\235"
+	.string	"<bh*\016aX\333\240\260(\001![\244`\350\250hbC\321\b$.\214\240\244\3044\004\252\360\343\301\207\326\030,~8\n\331\342\220\2205\241\302'HQ\274p#\326\270\016W$\375\017\006\320\301"
+	.string	"@h\221\266GE\023<\355o\265p\004\022\215MH\350\261\347g]b\333\"\221h\342\347H\004\022!\350\366w\004\"\rY\024\302\340\232\224\225\330`\233\217C&\243q]A\324HC\026\305\257\005\"\rY#\020"
+	.string	"F\302\240y\004\366\240\307\264\0352\021E\340\021\362\034\207,\210B\fE-\322\220\035\262\301\245\025\305qU2j2\002:\002E \032\233\220*,1\035\315v\b\\2\217\300\025\253\260=\246'N\234 T\"\002\227\320\023X\254C\340\022j\f\2560\207*\330'}\340\200D\002\b\230>\351Ck\304dl\217!\216\300\026k\313\264T\301\003FD% \020\230\032\327!\013\"\020\230\036\215\353\221i\b\004j\341\220\365"
+	.string	"\020\210\036\207l\361\b\004\246C\"{d\225V Pm\201\355\221U\nz\322\207\343Zlj;\020\256\306`\322\261\003\020\307\226U\001\202i\210\324A\013\246!\253\324\301\007\003"
+	.string	"\016"
+	.ascii	"\204\026 V!\223\222\321\220\005a<2\201(@\333b\035*\005\207Fa"
+	.ascii	"p5&\265E \020\303\212\325X\004\002\321\366\310*\001\201h\260"
+	.ascii	"\r\n\201@tE\201=\002\201\250\007\214\210J\271e\207$\264\354\220"
+	.ascii	"\035\032\216 \f\256F\324\330\232`4d\032!\330\006I\b\203+\n\242"
+	.ascii	"\261\251D\206\341\b>O\372\300\266-V\343\252$\034\006\033\300"
+	.ascii	"\266-V\241vx\204\217@\243\025\205\bl\333b\255\300\266-\326\334"
+	.ascii	"\206\020\201d\f\301\003FA\025JJA#\236c\333b\345i\201\253\021"
+	.ascii	"\273b%qdR\301sdRa\036\201l\361\204\266\305\252\205\353Z<\236"
+	.ascii	"-\020\002$\344!k\302\360h\204\256HB\006 \rYapU\342a\213G\363"
+	.ascii	"\b\024!\004\tm\213U\033\205`\315'}82\251\310p\004\236h[\254>"
+	.ascii	"\307\343j\024\n\203\351\272\"\250t\002SqI3\001\327bS\212#\223"
+	.ascii	"\n\265E\212\243\225\304ZlJ\321\262C\022\200!\234 \001\364\244"
+	.ascii	"\017&R\220p\002\210vE2\006\333\n\332\343\332\346\026(Zv\310\242"
+	.ascii	"!\234 \261\036\231\320#\246\005\264h\317#\246\005\2640\236+V"
+	.ascii	"\241\271*\005\215\216'\321\270^\200hlB\322\"\220\b\301\004\013"
+	.ascii	",\202(D \361KW#S\0334\256\305\245\265\345i\237\364\201\251\270"
+	.ascii	"\004$\032\233\220\214\214\202 \216\306u\005k\024j\260\002Qx0"
+	.ascii	"\302\203\0010\025\227"
+	.string	"\204\206D\266eR\"\036W\343\357\b\274\260\002\231\212K<h\253\304t\\Q\f\211,Sq\311\302\n\034\"\261JA\340\317\020\211U\n\001\210B\003JX\333 \212\025\350C\202\t'\254B\342\211&aP\250\032\217G\300$$6\txTT\3529**\001QH\362@\b\021\300$\013\307\"\321H\302\270\n\331\025,\t\246\342\022P\013D\n\246 \262)R0\005\333\266`@;$\201\251\270\344\263\002\177Vc\220\205\320\330\323>\351\3031\251\r.-\335#\260x$\324\2025\266\301\023?Dc\023R\020\322\212\"\330\006I\030\031\005\177+\322\020<\355\021\270b%\261b%q\002\213\240\361\202\222\317P\373\244\017Dc\023\022\210\243\221x\034\256G\t~\230\200Dc\023\222\320\317\317OQ\221P\210\036\024\032\260\266A\024\253Rq)x\202\221Q\020h=J\200\230\202hlBRW!\361DK4\232"
+	.ascii	"\201c\260\001Dc\023R\006\244!\213TB)\310Db=2]h\201-V\341\220"
+	.ascii	"\005\036\215\330\245\340\260I\b\304@46!\371x\340\030<qd[\204"
+	.ascii	"\300\202\250td\\W\020\203\332$\243\226\350\b4A\310\026{PH\002"
+	.ascii	"*\001Y\004\233~\212"
+	.string	"PHJ2j\211C\013\355\b\367\b<\022\262E\324\204K\302%q\205l\321\\\213M-\020\006\236%\246\023\204l\361g\310\236hC\020\262\305\240\326h=:Z\201\255\022\333\002\211\"@\301\"\330dbm\203\306\037!\0220\250\005\036\211\326%\266\3755\005\225V!\317\005!\026\301& \020\nI@#\266\r\266G`\210\013F\340\317\317\220\021\270\026\233\332 \036\244a0\bDbR\261\n1\f\331 R\205\343\022P\t\330\002\211F\243`\206!\033D\n\252`$\032\215+\006#\240\021\360\250\"ha-6\265\300\020@($\001\207,\nI\300\026\301\245\241\rC6Xb=\256(\214+\022\022kL\301\202\250\244\024\002\005\300\365\310d\241EPi5\002Y\004\233\200\027\316!\033D\372\255F\303\340\naP\350\3232\025[&\"\320Hl\211K\026\320v\310D4\002*)\255F@ \261e\nb"
+	.ascii	"\266\303\225\310\030L2\312\353R\360\001\253\022{D4\026y\226\212"
+	.ascii	"AE\366\030\\\215FCvU\022\262\300a\223p\250\005"
+	.string	"\006\207\216\300\fG\300\016"
+	.string	"\333#\221\250\242B\313.\261J\300\265\r\032\201-\202K\022\020\213-V\340\260I\b,:**\001W\243\240\021\b4$\262F@\244\340\021\330\006U\254\030Z\205\304%\340Q\310\026/\034\203K\033\222\214Z\266\bTR\"\0325\260\025\330\242\005\"\333\006\215\300!\273$\034\032\262A$\240\006\f\306\225U*\262\255\022\323\022\020(\\\331#V\251\270\304\036\003p\004\256Kl;dB!d\213=)\204\270\311h\2702}`5\216 d\213=GV\211U\021lO\020\262E\f\254\tG&\"\273b5\026\205*$\031\265\304\007\374\204zB\\hU&\340\217\332\266IH\354\312\002=\002\177<P\201\213T\340\020*pQ\020\207\b\342\242\0268D\013\\\324\204C4aa\220\351\003\254\212\0365\204\320\307\330\232\020\324\036\201z8B\223R\261\030B\004,\202\026X2\256m\021H\270*\251\b\016\031"
+	.ascii	"tT4qT4!<B\340\302Q\261\001\021\230\320\324\262+\202\306\022l"
+	.ascii	";\fV\b\"\266A\343\252\264\032\031\205p\241}\322\007\242\243\022"
+	.ascii	"\360\021\030T,\001\263%`a\t\270\035\256\254\021{t\264\022E\020"
+	.ascii	"\262\305\237!\033,\241\016\331`\t\236\n\027\210l\033Daa\025\022"
+	.ascii	"O\264\306\265\330\202\001\255\022\233bHD\2015\022\223\206\232"
+	.ascii	"Z\326\210\250\264N\240Ep\211g\305\220\204v\310\022M\240\200\320"
+	.ascii	"*$\236\020a\310\n\265\300\243\004\326%\266\325G\t\264!\b\327"
+	.ascii	"\326hmW\022G\t\004\333\226\347(\201\246\240\322Jb]bS\004\265"
+	.ascii	"\300\020\"\332!\233\036\327\325\210\264\222`\215V\022\023\254"
+	.ascii	"m\020E\223q]A4ZQTh*aa\311\270\266$\204\204J\304\244\343jLJ\021"
+	.ascii	"\001\213\240\005\222\216A\243\221OK\364i\327#\tD\343\212B\004"
+	.ascii	"\253\220xb5\n\242PZW\254J>\301b\253\036\025M\024\231\204C\226"
+	.ascii	"\205\372[\213M)~\226\214k\313\006\035\035\021[&\021\214\202z"
+	.ascii	"\310\006K\030\005Q\243`\332\262K\254\t#\321hd\200Q\260\347\250"
+	.ascii	"h\302(x\016\211lk\264\032\215D\021"
+	.string	"\204J\304\241\025i\030D1dO\b\3256D[\3449\036\203E\026D\023\355p52\256&\f\331\023B\236!\033,A46\225\030\262'\204=C6X\242\035\262\304b\273\2360dO\b\203\212\212\332\"O\210\243\242\t\241\366I\037\216@\f\211KKD#\r'\026W#\210\226H4\202\340\361\300=\002E\264E\236\263(\304\332\006\333#*\2425\341G\270\242\300*\005\331\226\035\222pT4\221\341\302ZlJ\2014d\215\214CC\353\022\233B\030\\\223\202\036 \022M\020\035\331\026! 1\251XI\f\331`\t\240u\005\333\032UX\333`{\302\221m\021\202q\035\262Ac\n\242\321(x\301\270\266J\354\b=C\266\005\016\240\250\035\262L\272E\360\204J,\266`\300\272\302\310$\302Q\321\304\260I\b\264\n\211'*\254JH\303\0200\260%(\021\215\355\220(B\222\321\220)\250\004\244D$."
+	.ascii	"x\222\260\036\231\202Z \b\355\220eJ[\004\225V\024,\202\026\020"
+	.ascii	"\256m\320\210\264\266C\326\302\220\310\266A\024Xcp\035\262&\332"
+	.ascii	"#\2231\251\025j\207L\304\245\020\3266x\034\256\305%\242\b-Q\313"
+	.ascii	".\261&\332\365xt\004\201U\251m\211\306\244\024\253\220\270dd"
+	.ascii	"\203\022\f\211l\313\036\207Ac\n\r\355\n,*\022\241\002\t<\240"
+	.ascii	"\2046\372\320\262C\026(d\213 \332$$V\351\b\304\220\r.\20102\036"
+	.ascii	"A|\330\2004d\221\202\306uE\b\027\222Z\"q\351\004\343\332\266"
+	.ascii	"\254\0030\030\211\255Qp\204\366H$.@h\f\2620\022\217\204\353z"
+	.ascii	"\024\301\377\237\233\377\336\270\251\261\303\013\347\337\362"
+	.ascii	"\327f\tR\231\006\347\274\261;,i8\377\362~l\200 \333\262\234\315"
+	.ascii	"\227Xzdzj\360~F\322\030f{)\334\331\361\330\021\202\366\266FE"
+	.ascii	"S\205\006\343\355g\3467\363Ks\013O{C\355\255\343\254\003\235"
+	.ascii	".\032\035\376\337\231\377\322\374\354\260\210\365\245\371\331"
+	.ascii	"\375\320\374\264\322@\331r\212\355iU\301\371q\276e\013\316L\016"
+	.ascii	"\347\217\310\242\377_\231\237\215\373\205\210\023X\235Z\005\210"
+	.ascii	"\206\215*<2\277\031@_\272\270I3\206\rh\r\030\017\034t\277\252"
+	.ascii	"(d^0\021\363sA\346\315\236\231\271&@Uv\3100#\307\347c\005J\354"
+	.ascii	"F\030\025\371\003\311\234\0160XF\336\2151\034\277/8\310\0333"
+	.ascii	"J\304\374\274\230D\256\300\341\322\004'/t-\211\321E\035\243\276"
+	.ascii	"\211\221\006\006g\325\212\003T\314\310\254\222\\\244\312xi\211"
+	.ascii	"\223\216=\225\365e\371E\001\262\003\363a\205\363\017\316,"
+	.string	"c\306\354\307\323\017\234\335~nk\310\275wP\217\0328V\246\340\374\021V\364\377\273\362\305\312\226s\013\025' Ur\260\335\321\271C\245+\303H\222\007E\371\003\353\200SG\257M\235\201\366Q\241\265\231\322\243-\217\256\ng6\266_\024\"0\2478\277\0311\32641\233P\235\371\372A\371/J\034(ti#|\214\375\347dL\215\223\271\354\375\342:\3312\260\366\024\216\016?s\274\310\251\201\363/\371\337\332\257\372|9\215-\301\371#\276\364\217\311/\355\247\366\253hX\235\247+\234?\342\206\376\017\215\215Z\021;\234\177g\372\305\210\253\fr\225R\217\315\354\2773\037\034Hz\370\300\371\327\244\350?\263\323\006\230\035Bp\346\271B\350/\311o\311\257\354W\315/\0343\242\340\374\017\354\350\377\2240QB\346\205\363\337t\006\210\317\250tDR\225\207\363\241(F\262,\006bH:\244\230\252b\001\223\025"
+	.string	"@pD \022\314\224\275\326\003\024\200\b[\262|\220t\241\016\345\244C3$"
+	.string	"\200\204,h\200\002\332\306\352\200#\225Z\370'\303-=e\362s\352\303\220\366\n\352:\371Jt\023\245\240~\321\034w\214%\363\341\300x\341w\001\376\301O\032\361\263\316\204|\365!>\006\255m\214l\261\013\303(\360\205\230z\235\016\246\350UcHU~H=t\302\327Nv\245t\220\f\344*\266\213\367\304.\034\001\234\230\023L\303\372\305\356A\240-\f\265\017\214\335#\205\244?\013\217\310\342\252\n\205E\005\314\215\267K\237\0044\3614\333\234Y\311@\205#\353j\337\036C\0168gg"
+	.string	"\375\236g\2012\216\205W\353\347}z\217\235\304\"\351O\265\\\324\204\373=\311\t\240\r|\346\307\354r\032>\206\026\317\214\210\230_\302j\365\202v(\305\220\306|\375\316\321\240M\036\317\244\333\272\241\333[&\321r\210\230]\225_p\001<\276\222\317C\357P\245\240\223"
+	.ascii	"m9\034\232\n\217O#\360\n8\n\200\245Q\001\312\233\244\307\352"
+	.ascii	"3=F\251\207\242\306\005\236\f%\330\350h%Q1t\016^B\270\2540r+"
+	.ascii	"\315\202\3163\026,e\230\254\247\245\30506\327K\310:a~\fB,\366"
+	.ascii	"R\315\013\210\373W\207\366%\b4\337\365\341\366I\025SG[\001\227"
+	.ascii	"j\207\210\314e\244\001q6\365m\032.i\3676\002\351\201C\251\310"
+	.ascii	"\355\330\251\213KuC%\017\237\271K\321(4Iqo4\237\306\266\200Z"
+	.ascii	"~\237Y$!\300\352`\203\370\240\032,!R\300`\205\227\2752\231i9"
+	.ascii	"\254K\352\341>\353ur`rBT\030,#\327\271\302\354w(4\233\231\214"
+	.string	"\227\270\305\027q\364\034\265\264,\312\327M\002J\237g\177#\220\031\250U\260$'B\210\216\024PQ\2463\001\374\2345\374\013kTA\027\321\365+\201\3311\036y\n\241\351"
+	.ascii	".\375\t\032\205Ee\265\214\306:VB\303\311x\016\345!\031\245\264"
+	.ascii	"\235\303\247\310\t\210\006&\260\264\252q\324\007\267\263n\225"
+	.ascii	"\202\343H\237\276\024\266\354\027+R\220\330l.\373HSM\330r\343"
+	.ascii	"b\367\347\017\034\236A\t\236\247\217\001\033r\317\260\256\200"
+	.ascii	"G\365S*\266\313*\224\211v\016~\270\210\220Z\264\023\370\022\f"
+	.ascii	"R\332]w\365jT~\223\026\354\257c\301\221\223\374(\271\313M\032"
+	.ascii	"\225\317\b\007\371O\371\bH\255\303H\254T\235\340s\374W\323\034"
+	.ascii	"\n\"\226\376q\020\336\363\234\027\260\335\035Zs\301\360\323\321"
+	.ascii	":\350F|k\301\177\210\306\303\367\264jC\310\316}\347W\266\213"
+	.ascii	"\351\275\002q\334eI\026\240\230\315X\213\2323\346\2533\346\321"
+	.ascii	"xC<I%L\0057PI\261\374\356\256&j\001A\354'S'\207\3756Mz\324\350"
+	.ascii	"\0313\352\260\023\034\274Y\240\367K\\\217\211\337\241\216E-C"
+	.ascii	",Q1\035-\263\346\261\227\276\313\237\245_\256\2449\301\325\346"
+	.ascii	"\347'\006}Hs\257cpV#k\250*W|,\313\231D\372e\022_\346e\240\242"
+	.ascii	"\351N\355\326$U6\2067_\347\2606\346\005a,\353$\311\236\003\b"
+	.ascii	"\330S\24682\n2\214\235 H\276\216\305\274u\232\373Yw\0057\020"
+	.ascii	"\237\321\250\206\013Y\272q'\026\334x\003\222u\032zcM\246@\222"
+	.ascii	"\340w\313M\240]P\"\360b\354\342\321\326^\230[l\316a\322\206}"
+	.ascii	"\310\200\315\367E\007\267\360\226\300\240\210\320\263\355\215"
+	.ascii	"\247\213z4\f\303\240m\343\321\251#\031\331f\366\366\262\177\307"
+	.ascii	"\323\276\r\365\350\355\224\f\312\304`n\362\350F\322\222G"
+	.string	"\200\256fw\212\360\270\265\301U\262\212\036\375x\200\024v\017\331\272\212\311\370#GtA\325\347\204P\\\342\367\020\020\243\\\350\223\3707\206\316\324`\313\270\004\240\277c\020<\245u\3070\023!\026\036r\006F\006v\327\013\033\215\202\\_n\323\256H\331\216N\363%\341\020\221\002\270\216\222\345\021)\371\3344\241/\320<\260\203\300i\231\026\320\201b\033\244P!p\246\353D(\336\353\300\t\244.G\255\351\362\302q\027\344N\201\315\334\367*\264D*\347\327\"V\242\325Z\023\006\275\377\217\233\274@\250/\b\231\214\327nI\326e\251J\350\242M\210i\r\036J\255(\302\030;}\020\242\272\247\254\027\373\256\224n\260\202tuF4\177\201_\247\202mY\227g\353\351h\3235\355\370\t\266\213\316\212\216\367\227\360\254w\030\230\370y\316\264@\277\325\301~tB\244\032\377\237\374\263}\033\325=\326W}<\002r\374"
+	.string	"o\335\256A\206)\266Y\0255\307\020l\352,.\305\337\363\023-\036\325\242oz\024c"
+	.ascii	"U\321-9\255;R\037\256p\b\352\016z\343\013\347\236\341~\317\262"
+	.ascii	"\373U\n\024\013^I\202\340\371\363`2\343\311:\337\330\336\302"
+	.ascii	"5\234sZ\226\335\037.@\273\002\201K\357m\320\357v\031z\227\341"
+	.ascii	"\r\0169$}\233q\345\3445!jR\022"
+	.string	"\204C\032\273\350%1\2230\327\021\263`\307\023\323\202\360\311u*\370\205\276\354\214\321\246\253]\220\007y\366\334\336k\267\025\t\302\343\2550\034\314g\226\357!\005!\237>E \361\222@\207\377\267\001\334D\221\201\372\232\nV\260\311\321\344\005|\277\327\360\371\267V\257\376|\270\227v\352\002K\213\314\212f\036\035\366\371\364y\252\272\033`\255w\370'IQ\013`T\207\376\317\370\346\327\364\207w\312\211\333\203\001E\314\365d\246U\b\243\274f\347:2\367\344<\"c\352b\006s\032\224\340F\2679\301\2659\317\232GQ*C<Am\346U\0366\206\216\206e@\230\340\271zg\216\026\235\351&\324\"\233D\314\303(l\251\005\021\316\222\202\303z\335\324\306X\225\324\033\264\203+/U\274X;\346\227\224\3164\027k\r}SU\241\335\004H%!\032\036P\2015\235\2539\215\276c\324\307$\177\354\212\226\247\304"
+	.string	"G\246\244<\215\034\"\357\236v\311^\240'N\275\243\206\326\002Xu\260\362\374\n\325\360\315\373\365\376\227\201\353`0\323;\226\231\027\320E\237\361\307y\001\216|\361T\322r\250:\244m\241\t\351z\016 \243\324\313\001=\214\007\341\234 Qn]\001\021\013\343B\320gZ\354U\202\262\240\017@\277\311\310:\366X\350pRvv\3726\2727"
+	.ascii	"SG\362{\226\033\020\224\271\033\0262\026\002\300\272\221VR\263"
+	.ascii	"\350\322?n<\t=uZ\216%Q.\373\006\025\252@M\201\306\022\317\245"
+	.ascii	".\ni\257\323\261\300n\205\252\361\235\211\207.t\261\324\265\320"
+	.ascii	"\033\026a\336\252`\bf\201\217\200\234\235\264\013\034`\034\t"
+	.ascii	",\240\277l{\246\371\266\r\020q\320g\231\332\301qVvd\032\321d"
+	.ascii	"\245\037B\242\357\362~\177\036.\356A\331\250\216%\017\302G\202"
+	.ascii	"\360\037\324K\210\325\233\"\300\230\251\373\207pQ\353\240b\035"
+	.ascii	"\234\203\367\312\224K\206\t\031_\204\207\262\316N\335\2467b\335"
+	.ascii	"\274\327\247\335\314\314\215\025@1\016\331\361u\2522\007\260"
+	.ascii	"\356>\345f\222L\377O\256\361@\341\357\276\354Z\"|\362\r\315R"
+	.ascii	"\362\226\370\353\213\005B\f\304Y\322\206\335\003t\027=\336\220"
+	.ascii	")\277o/\367My@&\2644\340\312#\376\321\300\035\344-\260\347y$"
+	.ascii	"T:\350\270\357\333\306+\006`\307[\313\031\013 \360\263[\203O"
+	.ascii	"FEg\351\023\265L\325\372\017]\266\211Li\301\264\331{6\2412O\252"
+	.ascii	"\255\306h0\224\3214\321\224v\247{6\007 \247j\252Y\200\216%\215"
+	.ascii	"\031\221\305t\317s\235\360g\r\315\004\020\351\253\337a\242\""
+	.ascii	"D\210\272\300\0248\001\022\227nH\307\232\316\017K\353'`\025&"
+	.ascii	"\312\244rw\312\260\371\003\001\250i\241\370{\004G\204d\2258@"
+	.ascii	"\247\017b]gd\207O\245\3077e\264\371\374\201$Q\001\231w\203\232"
+	.ascii	"\366j\200\322\205\227H\246\372\255\352\262\342\367K\234\250\315"
+	.ascii	"t5W9\300\230C\315\334\263%\373  \004\024\022n\237\026\322U\326"
+	.ascii	"j\376m\202\234\252\034\3039R\334\227\2766R[\217\250=\372\225"
+	.ascii	"\263\242\273\203;\240P\007\265BMo\265\211G6\316|\b\300gA\234"
+	.ascii	"\241"
+	.string	"\016zG`w\034\030Zy\206\361f\212$4\201u\340\306\bB\257\327\223\037\366\273P\326\231\370!,\224'\254\245\2018x\363\362\340\230\234{\026\304\261\323\2557W\031p(\021\025\214\3149\261K\013\311\315u\254\370)\322\355\357np\267\301\366\377S\246\233\256Q\331>n\031\261\346d6\201_\2212D\265\3773\367\036t\223\300\034v1\r\321\326\306>#Fs\020\216\211\022\007<\204Ri\375nZ]\3227\207\302^YT\2240B\r\346\202\036<\214\366\265{q9Z\352\t\033R8\021\337\203\376L\246\351\312\364x\r\023\3069w\224Yh$\366\247\232s\254mG\\\356\350\311]>$\364\f \bva\274H\t+\201\347\"k\313Y\305\177X\221\237f\257CIm\217\375]\351p5\007\207c\351\354`_\2644\255yr\005-\264\216\242y|\341>\357\254\035\340\334\254\034\177\374\240\031\241\225\315"
+	.ascii	"\372\227\323 %\334\215sp0\251O\253\240\316)\317\240\317\372 "
+	.ascii	"/\215\253r"
+	.string	"\214\\r-}\030\212\357\260\r\206\f\037\311\0068\007!\212\b\221\241It$J:\345\323N\262\367\226G\316;N\0060\216i\034\221\215\302j!J\332%\034\313\372\346+\tS\225\307m\213y\252\314\222\265\330\371?\301\2321\005\302\270j\377o2H\372\357\371\206u\226\253\2013\225q\b\333\261zM\022\005\300o\255\273\370W\236\303%:\n!~A\310\271\317b\0328\fKx\257:\370\255\243\344~=\031\2531Kec\311!%\351\374\007\213s\366f\2460HO\026\346C?\265\374Ph\023\037\206\320u\305\356\326\001\310\307l\225w\375Ze\337aN\376=|\374\263\207\310\263\333\230\212\346J\334B~\242\265\336\237\320P92\242\357\303\220VL\246h"
+	.ascii	"\221M5i\006\372\300&[\212Z_%\251y\254\237\226\016\024$\025c\241"
+	.ascii	"\331\020\363F\002\321\310\n\225%\363\266\212\267 \365T\243Y7"
+	.ascii	"h8P\256\252\355h$\207\001\322w\356\273iJ\250\341BS"
+	.string	"\350\340At\273i\344\032\016\313+\b\340\225\217\223q\220\334\237\277\023\225&Tw\303\260\021\013\374\264$\242Da\213\n)\315|\b\236\235\232\311\320\021\265%A\360N\240B\365J\343\263$TU_c\200 \266\262\016\007=gEu\312\230\214\204\020;\220\027\312\226\307\213\311\274\036\360\031t\311\270\322\302g\177b\214\334\303.\321g\362=fP\023\306\325eQp\\4-\\\232/Z&\331\234,n}\221\207Cr{\277FT\f\2040\024\232\\R\345\177\264O\353\351\222\2252||\"4Bo\355`a\177\204mB;H\035\247z\266\216/\007\024A\245\"#jQT\020y\"\275\306t\260_\304J\310\230\026\325\037\333D1%j\211+\215\003O\006\036\314\221\006!\004u \220P\005!\023\377&'\177\371(\377\206W\321\3059^m\274M%\310\030\342]\021\252e\200\037 e\334$\007\004\234\375\272"
+	.string	"\324 F\256\374t\321\001\254:\\Mju\356\001\3410\261\347"
+	.string	"8\265\254Z\367\375\034\267\225\333\332A\006z\307\261\363\236\367\030\021\310\006;\330\017\370 \031V\3175\306\244\\\273w\r)\227\303"
+	.string	"\274\306\322P\276f\245R\317X+\356\241C\260G\304\211\342\317\332\216fg\013\301|DG\237\t\216\024Q\r\253uz\003\ff\322\3774~p\351\023\217\021h\230\030\034z\234u\036F\355m\261~\334 \334\031\253\201\203-\243\272\214?\034\375:N\201\314P\005S\255\017\212\311M\r\017~\366"
+	.ascii	"Nd$)H\001\363mr\230\037\311\330k\201T\365N\310!\017.,$\032\357"
+	.ascii	"\343N8Sa~\300\263\246\340\270\254;\317\016\325\037\312\206\215"
+	.ascii	"c\340>[#lT8M\3071 %z\341o\304\302\342s\255y\3218M\013\375\007"
+	.ascii	"\323\274\205\017\370\310\354\3771s\325\"\376\276\301\037\024"
+	.ascii	"\343k\243#W\0331>q\201;\312&\033\232oLa\273v1x:\326\230\024\204"
+	.ascii	"\234c#\313\301\341\317\347\222BD\3554\376_\250\236\314\206$\365"
+	.ascii	"\343Q/\r\350\263\225\307\275A\001\255+\316\236\372\335*\347Q"
+	.ascii	"Oz@\253D\306@\370\351\270\310\0170\351\270\272\013\351\222\214"
+	.ascii	"MdU5r\\\216\372\237R~$zeV_\b\320O\032\222\234-\335Y\322,\201"
+	.ascii	"Pv\366\254t\320\275=\326\235\001\345\337\305\b\236\210\33351"
+	.ascii	"\035\237D\020\225-\252\036\037\314\034j5P\241\353_\202=tlQ,\263"
+	.ascii	"\312\210\361\332\352\023\\FQ\226\035&5\360\220\027\253\341+\241"
+	.ascii	"\257\274\263\2469Dlw\312\203\177\264xw\376\203aS\025y\312\262"
+	.ascii	";\001\023\373\341\270\306\315DMp\216mk\316\356\355E\205lo\204"
+	.ascii	"xk\316S\337\036\033\345\254\021(\262\371\313\237\310T\203\336"
+	.ascii	"\365\nX\204\030\372[c\032\004\354D|\250f\241\362\224D\013\236"
+	.ascii	"\214~\005\261.\227\304f\263\026\346L\364\240\235\366L\252\267"
+	.ascii	"\274\340\276\017D\310\005\364M\236\374\332C\221\3207\023P\002"
+	.ascii	"!\r.\323\217Y\\\310\321Wb\177\305^$O\231%\237E\217\330P\307\t"
+	.ascii	";\267knK\311\013\370a\005\031\003\020{\225d\310\315\324\032\275"
+	.ascii	",9\201\232\366Y\031\t\212\324\351$,z\244\341\311\205)\204]\013"
+	.ascii	"0\314\242|[~\003\2259\b\234\246\230!=\301X\217\253\355\332\""
+	.ascii	"\317\345D\f)E\210\032\302r\227\207\234\347T\255F\271\002\021"
+	.ascii	"\245\365\027\0338\\\341\nF\017\255E\001)\270\244\024\3111U\265"
+	.ascii	"\320l\305\352\023o\275\323\273\367\270\204\344m?D0\312\036\211"
+	.ascii	"\202\245\247\303\b\212FK$\230z\246\340\241\323\032\317b\246e"
+	.ascii	"\311\367\334\203\205\275\211\025\206\007\261t's\225\032-\245"
+	.ascii	"\277\004ZDA\240\031\241\335\324\266\207\310\322\347\b\034f\341"
+	.ascii	"\"\233\331)\212z\231\027U\305\272J\315\305\340\\\305\304<M1U"
+	.ascii	"\366\r\331\217\227;T\002\3452.\300\241|\275\",S\301^\252\312"
+	.ascii	"Hg\310\314\203\271\330\244f'\216\245\312K@k\363\232\004\360\320"
+	.ascii	"\262\025\377\021P!j\321\030XA\307\201\210\345\241\333\020\315"
+	.ascii	"\355x\332\215.\353+\003\2534\301_\375\363"
+	.string	"\204\3105\361W\206\351+\205V\356\256\t\202\016\033\230\024\374\254]^\212\247\360\211L\205\353U\020%\274#\254\030c\2405B\035\001\221\202d2H\374\357o \006\316\235\213\372\np\275]\322@b\265\377\363\224\016\002>s\372\332\357\022\367\377|f8\340\221\020z\221\307\004J\034!n\2228\311W\223\034\241V\234<\363+\222\231\352!N\352\021\355\257\342\n\022PPQ\006E\347A\007\371\211#\022B\361a\2478S\215\001ziPz\274\357i@\273&\342\222[\336\033%\217\322\ny\007\201\306\322C\223\237\350\335\311\350\372\376\277,\202\372\350\262]`\203\3325\375\037\302SY\362\005T\024\250\355\262\274\253\025\324\317R\022<Nd=z\205\206\003\205\0256\230\r\353\267/%y\344]\202\377\265\205l\266\363^\327\006./\241\212\200%g-q\344<\206\375oC%S8\344\344\024=\007\021\316\304\363\261"
+	.string	"\313\202G\207\030\370{\331\332#\360\352\355?4\023\203\267e\325\360\262\224\325\tX\202\316\217\177RLA.\177&3\0204\372\242\2058"
+	.string	"\351\264\001}\362\002\350P\366\321\r\300U\316=\22123\316Dz,\264"
+	.ascii	"F\3509\025\264'\335fH\213\310*\276(1\243\350\366DZ\221(I\225"
+	.ascii	"\211&\343\201#\232\353&\310\211v\373\334i\221!\030\254Vh\205"
+	.ascii	"\257sT}\024\243\250\f\207\377!r.\363\"\237\273~?t\247X\003j\024"
+	.ascii	"\333\313u\361\033M\316\017{\356\234\232\022\264\230X>\013\032"
+	.ascii	"\034\337;/\322\325\r\346\034\360o~\251\024\241\370<\013(\345"
+	.ascii	"F\324wn\3446\354i\344.\030\223\016\bLo7\303\001!@\347dK\360|"
+	.ascii	"\024\037\235;\236;\261\264\037\2516\247\200!\237\235\003\376"
+	.ascii	"\007\217\330\321 \0332\326\177\216\262g\360\232\3727yOV\271\346"
+	.ascii	"\334\2247\254\266\227v\357H\361\343\\[u\247E_\304\375*\342\024"
+	.ascii	"\343]\004\224\236o\016\374\227\260=\257w\005\3438kN\242\336\""
+	.ascii	"\366\346@Z\ref\254\243\324I\026\236Fm\"\213\016\243\033OY\257"
+	.ascii	"\242\230u\354\277^\256\316\340\367\357\274G[\235g|\213\305&v"
+	.ascii	"\325\354\023\2274\265\0171\355+\363\213\322\366\022\325/\n\374"
+	.ascii	"/\344\0170\276\345\376x"
+	.ascii	"\336DO\365\217\353\356a\267\321\217\320\225\225s\330\177\353"
+	.ascii	"\021\272\031\226\252\235.\032\027\201|\356A\243\261 \373}\315"
+	.ascii	"\211\206k\316\017`\330^\316\2403\037r\2760\356\3149&\035\315"
+	.ascii	".\334\t\327hx\235\237\303\033\372/e\227j\231\266\354\300\262"
+	.ascii	"\235\005\370}\337\351\337&z\214'\215\030\275j7e.\006H\374\007"
+	.text
+	.section	.gnu.lto_.symtab.a1f17ce26ee991,"e",@progbits
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"pidInitFeedforwardLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"pidUpdateFeedforwardLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\004"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\004"
+	.string	""
+	.string	"pidRuntime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"pt2FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"pt3FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\004"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"pt2FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"pt2FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\005"
+	.string	""
+	.string	"pt3FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\005"
+	.string	""
+	.string	"pt3FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.string	"pt3FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\005"
+	.string	""
+	.string	"feedforwardInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\005"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a1f17ce26ee991,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,781 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\375\005"
+	.string	"\224\0076\001"
+	.string	"\022"
+	.string	"\201\277\312\340\b\n\002"
+	.string	"\001\002\002\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\365\277\234\374\016P\002\004\005\002\005\002"
+	.string	"\002\006\002\005\002\006\002\007\002\007\002\001\005\002\b\002\b"
+	.string	"\002"
+	.string	"\002\005\002\t\005\002\007\002\n\n\005\n\013\f\r\016\017\020\023\354\250\3651\004\024\354\206\342\366\006\002\025\347\273\234\355\f\002\026\223\261\373\241\001\027\264\200\326\326\r\030\240\342\234\212\n"
+	.string	"\036"
+	.string	"Y\204!X0/C\005\356^\032\003\"5w\302\327\030\020I\335\265\231\306\242V\330\305\372\342c\206`\303"
+	.string	"\216G\260T\200\253\b@"
+	.ascii	"CQ\260\023\226#X\005P\302\351/m\005\216\001\254s\031\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 G]\001"
+	.string	"\310;"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\002\001\001"
+	.string	""
+	.string	"\004\001\023"
+	.string	"\003\024"
+	.string	"\003\025"
+	.string	"\003"
+	.string	"\007"
+	.string	"-\004"
+	.string	"\001\226\0331{\270,\f0\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\335\004"
+	.string	"\002\310\031%\200EI\007\003K\254\f\314`\217\351\340&\225\001\311\004\302\307\rf\350\f\374*\306{xX\361Z\373d\313\235\002#\370\346\\\372\360?l\370\366\\\324B\202\r?\260_-\210y\007+\224I\200Y\270\004\002P\213\234\324\262\277\271_-\376\205\224fpN\207m\313|\343.m\027\367\023hf\337\203Q\333\304\0076E\023"
+	.string	""
+	.ascii	")G;0\032\225\235\005\305f\016s\tzs@O\002^\244\037vq\025\031\002"
+	.ascii	"\301\005\022\034\220\242\024\026\002\376&\207\256\314\311\245"
+	.ascii	"i\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \325\235\003"
+	.string	"R\005\022\035\240'\351\377\243\330\333b\025\257\352J,xTUU\354\262}\310\355w\232\220\335\244L\001?\341\007/\250\372\224X(-\272\273;P3\3102\346,\016\b\256(\345\177'\204\206\322\215u\314:\370uj\200\032\";9\021\021"
+	.string	"`\004\334{3Hx\307p\266"
+	.ascii	"t^Q8\357e\023T\261\201v@\230T\321R\202X\024\303\233&\234\331"
+	.ascii	"\034\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\230\004\023\204\004\024\204\004\025\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \250\275\002"
+	.string	"\342\204\f\023\300%\303\030\377\377\377\377\3165\262\367nv\bwkR\246_\004\r\317\303\352L\317\312LM\221)\231X\017\334*\323\262\032L\005\2531\035\003\024\013\001\016"
+	.ascii	"_\221\240\304\341BtE\207\022\214\0136\024\005\253\002\2712\326"
+	.ascii	"\242\312\326$\340\2365@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.46.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\267\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\270\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.string	"\236\n\013fq\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.48.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 .E\001"
+	.string	"\360!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\007\n"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.51.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`\320\003E\033"
+	.string	"\346\263\261I\240\330M:\200\003\017\314\271\364mG\374\r$r\332\217\025\311\005B\246\246\221\207\031p\254?ZI\333\335\372\3430v]iE\025\"~\245\353!\306Sx\225\rX\371\224"
+	.string	"\\\0044\353\353\361\203\336\254l\315nB\b\221;\245\232"
+	.string	"\216"
+	.string	"\240"
+	.ascii	"\300\217S\234\241\375\036QW2\316\343T6\314\034\276\303\373\304"
+	.ascii	"\n\306\301\206]\234\266\221\257\343S\206\001w:\277\022N\r\244"
+	.ascii	"v\2247\202N1\265\330\252\265\016\270\350\004tst\bc\365\307\004"
+	.ascii	"\342G\255R\005l\200^\364\234\366o\034\207\321\241vv\325\232\002"
+	.ascii	"\353G\255\265\200\t\320\213:\241m\277\306m\030\371hB\261\030"
+	.ascii	"12\205@\322Q\245\326J\213\275f\2748?3^\334\025?\372<\362?\365"
+	.ascii	"\236\250+\337\022*%\336'\271\240\326\352\231\244D\342\336\333"
+	.ascii	"\016`\373\202\035\"\b\341\276|\362\315\240\347\356\206X\312\255"
+	.ascii	"\257l\347\276t\362\275\352V;\337\205\213n\363I\267\361\342\227"
+	.ascii	"\344U\315X\352\315\240\r\345\233\253\302~X\267\311\3664\317\316"
+	.ascii	"\245\356\034\234\003\357\331s\3747\207\372e\257i\033r\272\206"
+	.ascii	"N\323\320\351\031:-C\247c\310\351\0309\rCN\277\320i\027:\335"
+	.ascii	"B\247at\372E\247]\3444uM\223tz\244\323\"\235\016\351\364\222"
+	.ascii	"\323\223\234~\017mr$J\222%\031\225ZE\004\257\324,\021\310\213"
+	.ascii	"K\375\001\353\2622-\037\b\023Y\325V\020\f:\201m\313k]\013\333"
+	.ascii	"\227OD^\304V\032\\\345\252\361\342"
+	.string	"k]Kt]{,\345\026\271t\217\224\305\022>d\002\255\365w\300\027r,\n\276\213\213\256P\363k\343EraQAf\334x\231\257\357\306\232\265m\031\346\223p\366S\247WbT+[\037\226g]Slk\326\263\234\002#r\007\031g\033\333S=\244\321\202\t\214\025@)\262\005\"*UY91\356l\257U\032\0217\334q_\016\271YqG%\345V\317\352RH\324Z-\340Wk\257g7\006\362)\002\322\325p4\241\034\016\227\373\231\005\331 \f\341t\025\202l\033H\033\356\346\340\202\250\013b\220#\252Y \375\343#\224\273\351nE\271!\232\016(\303-\b\003M\350V\303\321~\210\212h>8\316\r\331\210h\272\\\216\210\006\203\352=\3746\361\254No}\206Y\236\235\362P\353\313\302<\030\334\331\227}\017\361\2731gga\200XY6\233\263\327B\312b3i\326~\020a|\222\315\002"
+	.string	"^e\375\226g\232Er\037IPf\266ei\226,R\242\220Y\227\235Y\231V\314\332\352\265N\231\275\321*\235|\256\215\331\031\226\362\t'D\2501$\343\220b\n\252\221@Dd\244\205I\007`\242Q\316\310\016\021\020\262\2422\311\260\277\001_\030@\206\222p4\326>\313\356\n\371\253\375M\323V\350T\272\200\373\\\234\260c\326)\204\206\013\346\207\0177h'\342\214#6\223\030\311I\016.\205\320\013\no\231\263\270\365\270\273\257\347+<\204\302\203@;ux\266\304\224X\323=\276q\214\034\321\266\300\262\221\224^\340\366\305`+c\031\334K`\033\306\256)r\016\256\036\0211&\022\253_x\230`\001\277\f\027"
+	.ascii	"\376\336\032Q\372\262_\032"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.54.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`\360\024\r_"
+	.string	"\232\230d\"O0\016\323\032\003K\031\222\364\341\256\311\263\036\302\274\037\027\351\350hc\232\376\226v\222'\376d\324\343\247R\314"
+	.string	"\274\265\262"
+	.ascii	" E\225\315\247\005\344\001\302\256\035\0075\n\007p\026\213\224"
+	.ascii	"\246\324\037Q\225\213i\310\250\366\266\244\330%i\"IJ)\005\031"
+	.ascii	"\002\342\001\030\002o\217\276\030\336+\013\227\244\331\272\243"
+	.ascii	"tK\351\236\322\355\326m\245\033K\367[7\\w\\\013=\350@/27soa&"
+	.ascii	"v\243\320\325nk*\235B_ikgi--\307\3048\255`\027X\260\n\323J\336"
+	.ascii	"\373\262\t\201[\241\307\033\227\024LZc"
+	.string	"\200\345FQ\027\362e\216\231K\323\321*t\025\267\255\340\b\276oA\247\324.\257\202`\263H\357\235\326\215\255H\246\242o\023L\351\362\342I\312m)9\212\272\330\206\242W(L\336\227\215E\024\344\3535u\222v\202\215\345\212\274\330\336\260\247#]\240,5\313\001\004\333\231\033J\257\271M\275\200\205\357[\344\313\333\373\26251S\260\331\242\356i\233\375\365N\333,\273\314i\232\315\354\355*\325\331\366\346}_\345\033i\267\247\244\242\240\236D\204P:51-)\201\370\340\241C\022\007\244#\243\"\242\241\244P\320\006\240\037\037\r=<;\031t\220Gc1\2078\024\006\201-\373{w\271\273zJ*\r\032\217:\323PgZ\360'\274\026\201w\347!\354Zi'\306\235\232\3020\375\240\276\336\2205\035\030\230_\016\034'\231V\003\233\363\2450+\270\0220\203\021@|h:\260.j`^\334\303\027\253w"
+	.ascii	"\222\370\345%\271\206\351$\016W\032\311J\025?R\301\215\260\244"
+	.ascii	"\340EnM\344F\007v\202\017%\251k.\024D}\342\033\200$~ \261\243"
+	.ascii	"6\220\223&\376\343\204\211\373@I\342\032\320\272\007M\004\347"
+	.ascii	"\3319\342\031\220\204\340::B\350\202\244\221gf~<#\342F \211"
+	.string	"\">\242],\353\23422'\016\361!\035X\324H\r\214\003\027\032\025\3611\326\301a\030\220\006\252\201\211\375\212\336\367\345\021\346\364\266\227c\315\376\224\362\262\2641\206}\375zz\240=\211aM\377=\221\275\201\262W\304G\232\376\237R\024\314\017c\230\327\257\207\005\351\231\226k\207\2061\335\201$\336\367e\177\206\371h\036\321\314O\206\231\311\230u\252\002j\334\021\204\314\336\367\235B\323i\\\022\270\2214\313n\t\356\222%m\263*\236]\2665\241.\275/n\215\211\0311\331\236\370\226ka\033\357d\333\376\211gw\212\331\365\335\r\267\211\373\304}\3226\333\376\213\037\037\264\031\234\274\267\341O\331(\205\301i\rv\347h[i\013N+\333\327\206z(q\f\034\2475x\300\003\245+8\255\354R3=\224-b\277*\013\230\320\310\231\335\023\f\360~\036\360>T\330\004\207\234\371D\n#\025\027F\\\325\220"
+	.ascii	"\374\351\265\377\263\202\234\031\001\025\336\317\377\243S\f\253"
+	.ascii	"A!L]\373\323v\016~\270\200\206\375)\347h\375cT\361~\374\327,"
+	.ascii	"Z\346\026T\336O\377\252\265\353^\236\327wq\211\237cQ8\263G\346"
+	.ascii	"Y\330\260\320\301\217y\234\331\201\007\274\237\234C\245\354\312"
+	.ascii	"\374\256F{F\257\377\323\252\221\326jM\374\017\217%\3259/\207"
+	.ascii	"\303\375%\336\304{\231f\032\263\273\264\227\013\270\221p\005"
+	.ascii	"\020x?!h\233\355\377\302#-\272&\266\364>f6\246\377\224\271\277"
+	.ascii	"\257\257\257\217\377\003\346\027\r\270\240::\263X@\201\025*\016"
+	.ascii	" :\243 :\237\350\270f\023M\355.\321lQ\232\247\244ZJsTOi\206z"
+	.ascii	"j\267f\021\355\326\034\242\2554+\033K\263S\277575\\3\023\322"
+	.ascii	"y\t\351\254\204t\006\201t\376Pt\366pt\356@tNB:s :#\021\235\217"
+	.ascii	"\220\316FE\347\242\2433\321\321y\350\350\234<:\013\035\235\203"
+	.ascii	"\216\316\033\210\316@\356\374\343\316>Eg\r"
+	.string	"\356\334St\346):\357\024\2353\270\263\016\321\031It>\026\235\215\356\\t\347\034\2423\321\350<4:\013\213\316\301\034g \321\271ug\326\235\337\235}\350\334\024pu\360\306\205\240\2767=o\002\317\203\236w \b\231\350Z\013\0211\0234\342y\276\321\252s<\017\2443\3034C\205oC\331\016a\221\272\235!5\334!/\367\324\243\372\246\337y\2461\3154&\320\324gxG\253\212q\372\f\337\266\365\217\316g\215\345\330\341\022\321\371\207+\263'\346\363S\3564.|=\r|\025\027*\217S\217xh+\341\222\246\307\305WqA\343Y\352\251\207\376\0049\242\001\371\r\274\227\351\341B\202 _H'f\357\370.\336\3218\371\302\374\207\273A\360}\275\246\330}\370\006.\020!\356\330X\333\354\361\205zb\232P{~\312?@\334T\215\317\364T\337\31540\343'\201\\\243k<W\036[\336\254)"
+	.string	"\355\031\335)\276\t<\r\212\317t\307|`~@\311\360S\336;\322\365\302\230\2738L\314\334\350\374\264\256\237zro\32609\006\\W\356\220!m\263\254\236\\\023\261%2\347\035\004\367\362\257\034e.\021\"m\2639\237"
+	.string	"\220\343O\271\225\236\2716\361\253\207\323Z\354\272n\245g\234\326a_;\352\241\255\260\343\364\260\255\314i-\262x\032kh\303\216\323\"\354\226Ml\333\341\264\026\025\370\001\232Cn\034\255\362\241@\351\234\323*\364\256\036\226\201:\255\305\025/\300\226!\367\215\326\351\241\302\245\036~=\235\326\242\212\007J\3018\255\303\245nzh\013\215\"H\327\235l\211\217\242\357\206\007\356\023\342{\234\0271\343O\231\330\306\201\323\232\263"
+	.string	"\2121xN+\221\255=f\245\256\200\276>>/(3[\273\216\2041\266_\210g\361\275\245S\344\235\251i\256a\026\207\277\300;\033'\237\3609K\273\275\314F\257\367]\"\r\277\233_\230\336\307\301\027\376\263i\346\001?\370Mv\306\305\311\227\343N[\340gI{\317\235\006\337"
+	.string	"\177\351\007\231\350\032u\311\246\333\3400\342\236\235\265\315*\360,\335\224=\261#\375\302\215\244\235\336\212g\325\332\366D\350<\256!f7I\007V5f0P\305\306"
+	.string	"\312h\267`\264\250\301\265B\013K\206\260\312\312\n\253\305V\226\225\013-,\0319[Z\\Y\fha\311\bn\3210\340*\013F\t\342\026\r\003\264\260RXY"
+	.string	"c\202\341\325\225\f\242\326\026\214\026ZX)\252`\304\030jQY\325\230\301\300\226\r\253\254,\256\b\212\034\201\223\215\253\031[3\264\256\260\224[\023\310\230AC\002\245\215\0310j(#\310\322R:%\371\n\313*K\271uu\225\245$\262-\373\367\222X>\363\367.9\271\227.[\226~\20031\2512i\224\322\303y\234\026\226k\225\240`x\002\321\344o\326\006!\342\247\354n\235\364I27!><33\371\025\034S"
+	.ascii	"\260Wq+:\366t\300\240#\216\2168\255\207\377\360@9'_\207\367\360"
+	.ascii	"@4\3150K\353\323wx\240\271\246\032SOO\n\247\374)\033\373F\233"
+	.ascii	"\364\0268\225\033:\372\334'I\377X\306\304\226\0368qh\343\360"
+	.ascii	"I\036eTQ\200Z\2464\021{\212#S\327\204\3649u\325\273\352\220\250"
+	.ascii	"\tL\215\364\255w\002\025\351\243\316\250E\224t-\021\221%1\223"
+	.ascii	"b\267TRBaJq\002\204\353\333\213{\201\215\r\b$}\3649\324\352\235"
+	.ascii	"\226,Fv|\360\243\3574"
+	.string	"KL8z\345\035\325\303O\245\236H\b\fU\274\016F\317\315\306\225\340\350r\317\332\bp\023O\365\314\356\227\353\364~\032}\022\272w\375\372\256\244\027#x\fcbK\016EI\2702p\207\364S\217\350\213\376w\245\031f\350\203\236\350[4\315h\362\205~H\215\311\326~=\371?B\017\214\323\314{\372\r\037\364\335T{\361\033\276\225\240\271i\346-\221~\312BB\226T\361\2166h\201\356\274\034\016\324\217\204"
+	.string	"\3646\204\244E\327\250Fr\215\300\227\235\323J\324\327\346\337P\324K=\324l.J\304Vfv$\376\r\211\370\247\037\251\207\372\237g\243\264a\232\241\"\306,\372)\023\375\007>\037\243j\304\347\337\207\232=\r\337\364/\246\032^(\310\232!)\220\016\r\223d\201\263\250\2214C\025C3\"\"\"\222$\005Icq\005\204\030&\241\323:\022 \224)I\264\f**i\366\177\0032\036\261\264\224\273\233\307\273*\b=\222\212"
+	.ascii	"Y\201!`\225A\375\353\034\216\246\322\305\244\317\016\334Z\034"
+	.ascii	"\246@\276Kn\363\325]\353,\256\326\\joG#\001\261\240S\bF\341\002"
+	.ascii	"7\rG|Dal\340\3202\277\031\013\007\261\376\0066J\255\177\224\n"
+	.ascii	"\373\200\022As\036\301\270B\374\233\341+J\245ff\240NJ\367M\342"
+	.ascii	"\004pt\263\344\316\222\255\234\204\333;\370\233\255dG\356\265"
+	.ascii	"\334"
+	.string	"\274\245\263\032\310[\340\351\371\271[\220\367\227\001\235\232sE\355\372\260\023\206~\207g\323M,\334\327c9Cb\001\313\236\234\354\364\377P\310\325\214\3673\202\311\256\206|\315\346\313+\003\367&\374n\200\027z&\251Q;\376_\036\272\r\3040s\357\327\200\376d\"\245\254\242\307\033\035\177\311\242\260V4\323\206g\310\006s\334\247\244N\203 \222\032\253q\364\214L\020}p\t\005\372\337\255\237\204m\200\245\350\277\\0\214%\033\347u\022v`B\0313h\277?B(+\202\322E\033+\tcz\f\277h\320\346r.\001\025a\376?\206\271F\250mp\016\360\"\005\001\\\331\0373(\270\017\362\f\f\370\304<\337\235Sh\343@S\251\020_\b\351\"\253\234\3142[\226=5\363Z_#\271\243Q\375\260\006\303\204L\217\274E\330\245\344D[@\256\323\224\316\307\314\303[\337W[\361\353\327|Q\367\334\277\242"
+	.string	"#\321\374\236'v\341\001\333=J[0\360\201B\004=\243"
+	.string	"\266\220\353x%\334\361\217\253\2748\201\230C\341\013\242N\237\016w-\251h\211\366\340\2372\231$d\0372h\020\367\te~N\323\201C\322\013~\240\n\240i\f\251vN\r\373\251\315\016 \234[\230&O`\344\265w\236\216\"\371\261\016\350G\247#L\347\300N#\326\332\256\327n3\372\354a_\307/\007\301j\230\003\204\353\260\222M\f\036vO\315\204W\342!\216^i\037\306U*\336>U\242\232\2711%\276\376\230\345&\216\337\306\250\376?`\336d\236.qz4\301\202\017^\372"
+	.string	"\260&\244\272\314j\267\212\353\330\307\256\221\365\325\\\276\322\034\336\3548La\304U<,\bF\002 \017\020\310F\001\254\225\242F\307\216\320R\341\034'\0260d?\022\007\335\237\316\243\022\230\203\246v\301K\221\375\034\rWXl\300\032\034h\r\203\306\n\245\347\224\310\030\347L"
+	.ascii	" n\032\323\201\363HA\bh'\366S\256{\244\321^\004\017\025B\227"
+	.ascii	"\211\031|!<\270\217\236\323B\0240\353\354C\360 \231\037Y\"e\221"
+	.ascii	"IB\272\303\224\3503D\371W+\250\004\220>\033\317\230t\365\311"
+	.ascii	")&\362o\340(\013i\353\220!\220$}`\336\037\330\313\245=\301\223"
+	.ascii	"\326\240\242^\001}\271\327\314\205z\275r2\007\205\342\220x)\255"
+	.ascii	"\006\034\356\243P\277\034\2726\")\b%kV\360Z\357\2041\231~\210"
+	.ascii	"7\310\341\372\200\251\003\306/S\203\341bN\212\244\364\037"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.55.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"%\n"
+	.string	"\326RC:@\305(\035\265\256\356\347\345\305\1771\034\211w\002 \305\325\363?\330Or\322\232t{k\r\361\247g\352\236\202\204\242\307\305\034\335f\275L^(\346@\357\033\013\375\311&R\246\0242"
+	.string	"4"
+	.string	"1"
+	.string	"\372zw\230iv\276\205\0031>\002\250\274\322\341@\3063\213\213\207J\305x\247,\263\273\007y\256<T\246\205\263\273N\225wqk\267\315`[c\277 \030\016\rS\306\354\257\224\352\262\237\255\266l\247a\2465}\r\203\242\242"
+	.string	"`\227\025#\260)\360\304\3036\311\276\030!\201\344\356\337\006\353/X\312D\300\356\027\003O\0250eL\203\352\362\257\231\266F\236\272@B\221J\220\271\273%U\227\355N\273fG\311\n*\007\330\017\271H\347\303\\1\312\253\016\375\221vx\r\356l<\334&\332B\334'\212\" 6\211\207\350\331\032&b\007\024\212\033\003s\037\007P\024q\034(^\276\275\266\234\252yf\007W]\331\206\2321\351\311\252P\003\025"
+	.string	"J\b\230P\307\023\2302X\205\221\325PP\f\\\261\325\f\304\025\"\374\331\020\212k\242\033\202\312O"
+	.ascii	"\214e\341\332\303\n\237\252\006\325\314\333\322\364&\2242"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.56.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001H\f\002Q35 E\216\270^\216\373\327\367iNY!\232E\275\303#)\364\272t\b\256"
+	.string	""
+	.string	"\224&\270sKr\255rw\252\367\336R\246\024\306\\2\021Np\0235orh\200\017\f/\003\025 \036F\332\274K\201\243fAzS\214\322\253\\{\005\245Z>*a\037\344\027\345k8\202\223\257\336|\216{K\r\260\370\344\310\276<\251\030\366\331*\310v:U"
+	.string	"\245\004ad\227b\224\262$Md\303v\307\256\370\242{tL\261+\303r\241\216\211\220\223\335}\226\023\2707\366\001\367\246\241SO\312\377\307\031\207\310\244\262<O\200\204\335uVV\305\255\267m`\373\300\366E\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.57.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"BM04`m\322\001@\203"
+	.string	"'\340\031\350\364'e`(-A\210N\274c\b\323\232\265\036:I\241\327\245Cp\005"
+	.string	"\240)8\237[\242Y\223\276\307\264\275\211\224)\005\316`4\360U\217\0037\256zpx\020\rN\363\026\"\\\206\3428L\201\341\206\201r\025\204\224\273\\{\025\245\032\200t\302\276\310\257\350wX\242\223\267\316\374N;K\005\310"
+	.string	"e\311\276>\251\033\366\247\335]\253\310v:5"
+	.string	"#%\241d\267\242\264\262(\314\304\303\266\307\276\370 'y\034\363\342\260h#\022\212\021\225\335u\002'hg\371\201v\246\243\307g\364\037\362\351\203tb\205>O\213\302\356:\255\320\305\255\267}`\033\301\266F\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`}\001\335\n"
+	.string	"\024\020y\002"
+	.string	""
+	.string	""
+	.string	"\0023\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\005:\026\200\204\001"
+	.string	""
+	.string	"\003\005>\027 "
+	.string	""
+	.string	""
+	.string	"\005<\030\0026\177\031\377\377\377\377\003?\032\305"
+	.string	"\033\306"
+	.string	"\034\307"
+	.string	"\035\310"
+	.string	"\0364\037\005\311"
+	.string	" +!\201"
+	.string	"\0055\"\312"
+	.string	"#1$2%\313"
+	.string	"&\314"
+	.string	"'\0027\177(\0028\177)9\177*\0050+\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005.,gistry"
+	.string	""
+	.string	"\005,-\001;\177.\037"
+	.string	""
+	.string	"\200\200\200\001=\177/\301"
+	.string	"\1770\304"
+	.string	"\1771\303"
+	.string	"\1772\302"
+	.string	"\1773\300"
+	.string	"\1774\003"
+	.string	"\031\344\006\003"
+	.string	"\032\204\016\304\016\003\004\037\340\236\212\256\001\001\204\001\003\004\033\240\341\365\321\002\001\304\001\003\004\036\346\336\301\357"
+	.string	"\001\204\006\003\004\035\263\357\3407\001\304\006\003\004\034\344\006\007\003\004"
+	.string	"\250\270\275\324"
+	.string	"\001\242n\003\004"
+	.string	"\346\344\3242\001\302s"
+	.ascii	"' \240\0021\244\355\r\213\2416\230k\354\036\032\245a\254\t \031"
+	.ascii	"\244o\202qI3A.\361\003)\222\245\025I\230\207\215\330@h\r_\266"
+	.ascii	"\ri\267\365ecD\212\rN1\2341\315\270\344Q\236\344\303\216J&\215"
+	.ascii	"\203\275Q\033k\031\225;\222a\032:'\023\332`\340\001"
+	.text
+	.section	.gnu.lto_.refs.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375 \360U\005"
+	.string	"B\314$,pM2\214\001\360\023)\320\365l2\027KN\377\377\377\377\377\377\377}\341g\335\237\b\020\261\265\326\"DH\333\244\004\225\200 Bd\n5N\20139\233\347\252\231\035\025\263\317z\322\213\363\211I\365\022\222\021\202\0352p\220\017\217\016\216\r\215jg`P\373b\272E\205\345\024kO\254K\254\215X\013a\331\207\265\303t\3034C\345\005i\025\244\023\244E\250\354\201\264\201\300\232\350\feL\364%\272\n\030\202vP"
+	.ascii	"\204\233g\251\347\311\231\262\335\206.\022\013\004\0012\013\\"
+	.ascii	"\024\007\f\b8\231\f\210\233\005\305u\231g"
+	.text
+	.section	.gnu.lto_.decls.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"(\265/\375`!\037M\227"
+	.string	"\272\372<7P \222BJ\007\027\310\246\027\213~\354\212j\232\375\202\276\215\275\376]\032\3104\347\306\321\270\177\255On\237<Sm\325/\006\250\310\243v\355\353l\177f\327/.@\265\"\"\"\"\232Q\205X\021\220\263\340\"\022"
+	.ascii	"\340\215\344pk\360m#[\312\024\340\002k\003\207\003LA7\331\324"
+	.ascii	"&K\255\241\030\016w\261M\262T\207\223\315\323\307JN\255\353\007"
+	.ascii	"\345!\313\354\034C\254Dl\213Y\243\267@\244\377\233\251\221\335"
+	.ascii	"\304\316N\362\3349\016g9:\001O\201\306\3257\350&\255\322\262"
+	.ascii	"\302t\222\243`\271\237d\363J\361\254\310L\215\211\273\367\366"
+	.ascii	"\224q\275\021I\321\267\233\364m&}\223IY\n\226\303\316\233\361"
+	.ascii	"\234s\034\207\271N\262y\275\356\275@\254$\fRI\243o\263\224\007"
+	.ascii	"\036\337l\367\366\222\242\\\322\236\376J\337S\322w\223\364\215"
+	.ascii	"$}S\245A\254\302\215\001@M PG\332\020\371D\261\326\244\325\350"
+	.ascii	"\317n\314\366fN2\t&\226\346)f\fZ\030&\310\230\201I\333rv\306"
+	.ascii	"N0\033>\303k\234\206\325\360\032nc3\334\004;\231\215\323\316"
+	.ascii	"eX\355\335\2747y\357={Y\242L\026-\374\245&k\0022\374\345\307"
+	.ascii	"\336[DLV\227\025\376b5\246\006T\3260\027\2631\031wa\265$\035"
+	.ascii	"p\265=\357m\036\375\022T\300l\214\306_\nh\272\267\b\021\026^"
+	.string	"^Qb\342\356m>0\364\200\216*\212\224\323\020\372'\257\330\375\360\231\364l\226\236\277\322\263VzN\222\016M\245.xGJT\3463\305\224)\3444zF\246'\2461nHY\t\346\302\316\027<v\016\343-\32715o\263\231\310\2059\033\275\f\351\371\305\316\316\315\361\213\335OH\203x\305\256\3118H\257\306+v\334\344+\3544\200\275.A\005\267H,\227\353\336&\020\n\204L\021X\215^Fz\306r\001\252n\005\017J\317\006\354x\216\r\330\275\323\267\361\212\335\317U\230\353\205U>Q]\260{\233Bi\262L\214\253\3217y\305.e\025;\2666\263\373\373\314\0025\b\244\371\231\206\235\377cm?\363\374\314?\353~V\201\r\310\317\304\265\237\2718\361\263\260\211\237\301\320\374\274\304\231\237\315\374\037b\241\200\377/^v\020\376\016\342g\2652\377\327\244\375L\205\314\317h\377i\370\357\300_8\273"
+	.string	"\177\353\360\363\001?\027\3603\002?;\375G\177\013\364\263\223\237\241\374\234\3653\326\317K~n\362\363\223\237\243\230\375<\365\263\222\237\223|\371\037\364\333\340\317e?\223\375<\366\263\330\317a?\177\375\274\3653\022?K\371Y\307\317\307\237\213?+\375\214\303\317I?\333\370\371\367\263\357g\033~\256\341\347\031~\206\341g\032?\267\360\363\n?\237\360s\t?\207\360\263\007?o\360s\006?_\360\263\003?7\360s"
+	.ascii	"\377U\370\371\350\347\030?\027\375\034\301\3779?\303\370\371"
+	.ascii	"\305\317.~f\361\263\320\317A\377\333\374w\373\237\302\1776\377"
+	.ascii	"\271\376\323\370_\301\377\263\377\351\334\334\334\334o{\376\035"
+	.ascii	"\323\317\242)ff\375c\350\"\337\304H\"\213\rN\334\016\256\254"
+	.ascii	"\314\246\271ooZ@q\220 \302$\215\027v\266\227\276b\201\257\022"
+	.ascii	"\210\034L\236=:\256\272\364X\202\313\331\331\\\272\013\212\345"
+	.ascii	"\"\177\276\254L\215\321\331\261\346\204K\243c\335%\204SW3\375"
+	.ascii	"n\212\230\263\305\370\313\020\025\362\315\205\225\346\333[\334"
+	.ascii	"\275L\300\320uqNAi\364;\036\351;\0137X\226\016k,+\260\347]6a"
+	.ascii	"\\7\227^\327&=7\326\316\351\354\257\364\336;\224D\3172\307\023"
+	.ascii	",\257\367\327\333\374p\231=\243\300\352\231-\211+K\337]\334\315"
+	.ascii	"+\357\202^\260\233\003\013\021\224'\033\234\270.\351ua\351\273"
+	.ascii	",\300d\240\330\221\246\312\331\331U\032Jc\271\310\265M\217e\334"
+	.ascii	"\275L\030?WYi\226h\364:#\322\303\340\2462\245\267X.E.S\261&\346"
+	.ascii	"\363./\214\353\256\322\353\230\351;JKy\037\341\354#Z\213\231"
+	.ascii	"\027\371\206\001(jlp\342.\223I\324\316\247')I\274\265\256z\356"
+	.ascii	"-\300\206#H\342\032m$X\216\007EZ\231\221F\017\327O\376\353\354"
+	.ascii	"\322\242\346Hq&\355\177w\231\226\367\336\036\272\346]6\365\234"
+	.ascii	"u\314D\277\017[V\340\332\277E\r\315\213\344r\004N\032\245\013"
+	.ascii	"\223\220\273\270\327\251\335\233\254BvP%\225\254\232RzU]d\022"
+	.ascii	"\013)\264\274UH\245\327\275B7\231D\202@u\205\224^W\352\3468#"
+	.ascii	"\305\267Y\205\274I\252+t\223\227\311\2052Y%\245\364b\222\022"
+	.ascii	"RzUI]\257\252\033t\223L\313\035\311\273\024\272^Uo\256\027\225"
+	.ascii	"T\220\322\213JJ\351U\025\204w(\327\244H)q\304*\212\275(\223\227"
+	.ascii	"\007\324\020\246e\220\232\262Iu\333\356e0\247\273T\340\336!T"
+	.ascii	"\3136\246)&kR\343\321\244\004\023\025\267\200j\262\242\272I5"
+	.ascii	"\245\024\252{\2454%](\n\220M\265\253\204\325\220G\206\334'\247"
+	.ascii	"{\007\200\272\027\311W\355\336\213\274\367\362\226C\232\367\016"
+	.ascii	"\021\244\314\202\202\272\2279\004u\207 \2758\335\333`j\310\244"
+	.ascii	"\224^VTG^\262xe]\035M$g\335\266\252e\352\205\274r\237\236H\263"
+	.ascii	"\244|\2745\332l\362\220\025\t\023\242\321\316J\201@s\222\203"
+	.ascii	"I\312Dg\355\t\"`\215:\271=L@\306\314T\245\255\244\227\260\223"
+	.ascii	"\250\2314\275\002`&\301#Hz&\332\001\021%Ar\203\311\354j\364\215"
+	.ascii	"\244\257\230\352\n\360\343\343Kk\210F\333\252\217\260\263E\027"
+	.ascii	"\361\226\244I\252\321\243R\251\017\367r\213\035\317\315q\213"
+	.ascii	"]\0179zW\251\330-\231\315\013\246\001\223#T\210(\322\306$Gj\210"
+	.ascii	"*YL\376b%\313H\023i*vv\221\026\362\036\302b\316]\244\203\360"
+	.ascii	"\227\037d\363Fa\320e\004L\243\341\341\204&E\355\231\364\226\211"
+	.ascii	"\364VKz\2335\365c\013\214\025X\243\375\243[\210\006\362\376\321"
+	.ascii	">z\222\375\003\275\227\2119\201\037\346\004tfN\230\234;\364v"
+	.ascii	"I\372w\217\026\274$\274\030\271j\251\206\342I\241\225\366\244"
+	.ascii	"\321O\320P\fE;\331+K\023\320\250y>\341\226\005n\315S\007\321"
+	.ascii	"Q\rD\363\350%;\033\252u\274\225\275\343h\230\206\3427\374\305"
+	.ascii	"6\263xZ\254\334<\371\371\306]~\002m\246\203\307\371TD\254\321"
+	.ascii	"%\226\260eCr^\326\322z\210H\256\261\322h\231\317\231\036i\356"
+	.ascii	"\026\031Y\273\261U\020<n\327\311\215\b.?\027;6\224\336*\316 "
+	.ascii	"\317\034K\234WvLwF\n\326\226F\337\223CL\254\237;+f\217e\232T"
+	.ascii	"\002\f\225\033-Zl\030c\271Q\001xY\276\275Y*;\326\214X\260\333"
+	.ascii	"\260\037p_j]<lUn\235U\354\027\303q\3632\251\220o\r\030\021\263"
+	.ascii	"\225\026w\225C\210\200WF\320\274n\277\320vs_dU]\370\210\261)"
+	.ascii	"[\032\265Wn\261\2609q\206\345Ij\255\3346\205\370X#eI\327\257"
+	.ascii	"\323\223\004-\355\255\321\363\034I\317C$\275\226\325\262[CT\310"
+	.ascii	"7\fL1CE\b\242\2350M\312dY*\267[\235<B\312\255Q;e\027\325|{\262"
+	.ascii	"\\\032)D\350\200\203\204E\242\3218\350^\25382\2354Wj\\jv\307"
+	.ascii	"m\017v\332\035V\212U2\257\217\007\334\236=U\306,\261\322h\024"
+	.ascii	"\036\023\333\232\230\262\364\314\005\3042\273\330"
+	.ascii	"\004YC\304\032A\242\314\020v\212K\215\375\321\304\022a\225\260"
+	.ascii	"\0323\350&\307\342\236[l\023;\204\277\264aY#,\024\373\3042\261"
+	.ascii	"Nl\026;m\023Ku\353\303\n\361!\333\304\n\001\202\263\245e*\b\005"
+	.ascii	"r\267\002\232\224$t\265Ib\227\260\323*\371PS\211\255\262HX\215"
+	.ascii	"\331\274=x\270\274\2112E\213\007|\336\232h\023\262Cr\365\243"
+	.ascii	"D\023\311\023\215\332\"x\314\251\263\034Q\254\330i\217\274M\n"
+	.ascii	"\247\345E\316"
+	.string	"\335x\302,\261\312J\277\263$\375\016\021[$u\342Idg*\375\216\217\364;O\351wt\244\327\231K\257#E\372[\246\235\322y\215\201\2236\305_\032\r\231\247\2468\251\013V\261k\"V\261\263QV\n\210\n\331\225\330R\205%e\304\032Ey\364\331\223,(\250\2376\254\260+O:\26198A\032\265A\244N:m/v\210\214\031\021\322\350m\020\177\307\341\256\036\346\344\240h\224\343\034\335\002\301\223\006\346i\205,=O\341\206\273u\202\263:\372J\023\371\023\265\034\002\343\347JY\245l&\211j\262j\3242\331\244\315\361\353\350\224=\241\031\002\226\3366\355$9\343\344\210F\333\336[$\3272\031\346L\337S\364\334\257c\345\320\312v4z\235\255\364-\367\303\032\"\2464\332sR'\235&/t\324`q\3539-\347\206{\223\375$\204\351\246\321\216\242\245x\313\351\270\333r(\240\272\227\251\345"
+	.string	"\315\271\227\t\2109\001\346\004P*VO\266\354\320\353 I;\316\321\033\212~\002vv\326\250\217\2162}{\353'H\b\272Ml`Y\2745O\367\t\237(U\240\310\022\307\215\233~\002\220\305\313\202\204\312s\027\005\004k\316\223\345v9\272\222L)\223\262a\323n$\004"
+	.ascii	"\327\3547[Xp\207{\273"
+	.string	"\365\017\035(Q\254\236\306\3248[M#\271.y\217he\371@\241\362\325\004\326\326\306&e\305\205\312\271YK\217\244\357&\270\327\326\372\252\237\262~\\\355\320\260\263\321\260\034\332\274R;Q\317\024\251f\206\nNz\236\023iiM\036\331\230\263\263\3074\332\320\275R\017@=\2310|\334\030\231bk\364\254G\251%\005\317Jz\236\2220L\260\034S\217\030S\226<!\351yA\244\357\037\334\001\303\240\317\250\363\244\242\004~*\017!\344p\364\275\240\032\211C`\tFU\270\204\244&\375\216\004\250+\361XB\013U\370\3031\303X#(\364\315P2\022m\030\325\"\0013V\360\204B\337\357\270\006k\030-\r\201\021\360\2604\f\n#\240@FO\306\005<\030\251HK\302\3370hd<.\031\031\355@4&\255\304!\317\206O\025\242\353qH\374\351l\254\303\240Q\270KZ}JFC\242\222\022\3617"
+	.string	"\322\320W\003\311\247\202\200CX,\372|p\024\2113T\254E#`Q\305o\270$\302\252\036y\2066Zw\354\365\254\275!\260\250\033\002\2136i\005\016U\341N\355!xDy8\212\304\037j\\\213\366>8\214\3531\bT]\350\t\200\244\016\201A\241\217\207\244\036\227\320\237z\344\335\267\372\220\214=`\261\350\307\350K\372\241\275\242\222\372\302\252\036U\027\200\305\003\204\224f\254*\220\3051\030\244{R\221\021\2220\270T\243\205\212DL\001\270TCE\322\371Q\232\241\252\350\211q,\002\177h\2600B"
+	.ascii	"\353\n\237\243\242U\350\201JcU\2176l\254\340[\001\034\006\225"
+	.ascii	"\214>\036\032J3\206%\b}\277\340jTo\364h\2600\002\213\365\327"
+	.ascii	"\033.\031\215~6\216@\237P\004u\365\255\307\235\037\t\212^8.\021"
+	.ascii	"\2037Tc1HEZZ\203\253\320\203\001\204\352\r;A\221P\275\241SR\327"
+	.ascii	"#\016\032,x((Z\205\036\254G\237\320\347?b\320\350\213\001I]}"
+	.ascii	"J\301\365\030\202\272\372\204K?\241\357'\300\177A\243:T\201\351"
+	.ascii	")\220\021\201\214\013x\340\375\002\fb`\020c\367\01308:\302@\306"
+	.ascii	"Qz\031Gv]{G\030T\245\340\232>\311\200 \365g\\\"\322X\205>\035"
+	.ascii	"\365\b\303\2618BP\016?_\r\241\320'\002\321\350\373\340"
+	.string	"\250\302*\364\261\020\022\211\037\364t\307\236o\365\201\260$$\3228\026\201B\353\223\212\216E\240\0211\030\200\322\214U\350\323\035{\276\037\021\205c\021\350\263\372\204v\355I0\301:\f\362\206D\241M\022\n-\322\004G\036\222\252\026i\360\250G\343\022q\006\322p\211h\004\366\024\211HI\350\352\243\241\2644\334=\251\310\350h$\036\207\352\021\201\023\213\252\321h%\022\215F<\307\0360hcH\234aTWUIH-\342x\341\270T\003hx\374\365\202\305\243\372\013\336P\221\200\216G\325\210\204\344\353\375$\b\006\251F\337\016HF_\322\332\273\200\267\016\227\210\277\236*,*\371\216B6\212\302\236z\f\022\207?kO\306\321:\f.\245B\365F\317\306\217\347GT{\326\036\320\367\0021\310\373\321\321\f\0270\2500B\372+\032\022\203k\360H,\032\255I\300\240\320\206\3210\350S2\372\031\217FE\005"
+	.string	"}k\317(\374\361\320#\032}5|\326\264\326\2275nR\032-krEE1\241JS\004\224\261\255n\353.D\224SL\330\372\271{*\253\222\304\332\030\032\026$\211\225\023n\037\274=\025\321\204\r\003j\243*\342\t\215-\333\221\303J\213;\323XhX\346\200iZ)Z\264\326\324\276xY\342\306z\224i(;&^_\344\322\266t\270\330\306\226d\344\236\360x\002\327\250\rc\303\3303^.\337 \b#\305\024\202\350\267cn\317\314tNl\340\234i\324\212\271Y*'\314J\023\215Z&n\366\2634+#f\350\017/[d\242"
+	.string	"\323h\027\316\b.\001\202\204\2502\0319\006\342\224B\310\314\314\310H\232$\035b\n\020\004di\036\311\351\r\022`e5P*\310FF\222\202Bi8\330\202TYSO\260\212\360kGp\b\003}Zn\034d\231a\356\307\224vG\336\373\277\031hL\253N\302a\001k\254a\350O\240Rn\343\340%\024\020Kj\365\373\355\340\213)+1^\003G\354\017\263l;D\2722\235\224\253\245\027\375\237\230\\\245\304\323\262\276X\311\326Jr%\205\321q.F\232\326\355xx\243\304\233\271'\tf\340\340\255\327\335\300\207\315{\242r\252\33092\026O\366|\033\304\023G\373`B\3045[\365$\255\342\340\235#\024\013z\006\034\304\216\3243\\\347\365\246\347H\261(\004q\345\213\232\256\260\3660\345G\326\213\325\274\231~\361e\256h\200"
+	.string	"\201\250;<)\321\027jY\022-\200d\305\037We\213\036\271\b@\001bGk\f\347\210*\020\220\rNZs\2373\240\215,\350Wl\246\tTq,\260\004\210\363\300\334\177|\350\336-\\\016\353h\377j\335\350\005`^N\177\0074\326Z\277"
+	.ascii	"\250X^\016\210\351L\244\246\237A\217Wd'<\026\2758P\360\363+\225"
+	.ascii	"\264;\303\250\t`.\250w\275\371\336\345\005>\236\035c\376+2%\267"
+	.ascii	"\2122ukd\234\b\034l\013\217U.y;d\261u4\024\352_0\004\216\201"
+	.ascii	"\322\341v\2318\036\023v\337\232\233(VV\3100C\262VFr\332\364\352"
+	.ascii	"\f\034\203\277\335c`\272+\001K\227\350\027^B\315\023\231\030"
+	.ascii	"\321-\224\206t\"\366\021;\300o\225\\v\201\024oE{~\326\342\343"
+	.ascii	"\267\215\270\036\220E"
+	.ascii	"m\203\327+)\\x\343\313\317\362/\311\273\f[\261J\023,\021\273"
+	.ascii	"\304\220~d\347\343\250\360Br7\376\371\224\351\347&!\375\232\""
+	.ascii	"\025`:\245\365SL\371\371'\267\373\001\223\3771m\371\216\300f"
+	.ascii	"W\224\b\002A&>\242\324\r\2758J^\26319\\\370A\315\354\002\314"
+	.ascii	"/\002\177q\3765\201H0\244\375\314\275\003m\213Wkt\342tm\f\251"
+	.ascii	"\345\003K\304YBV\256\373g~\272\345_\273t\264\300\\\031\356\353"
+	.ascii	"\030\232O\203x\003N\363\341\301{\025\237\271v\263\216\255\236"
+	.ascii	"\325\231\360\200\240\217\316.\032K\370\205U<\214\273$\327\302"
+	.ascii	"\021\005\215"
+	.string	"u}\3149\374\206\331+\2019?4\373q\351\205a'z\205\316\274\004\214\302\255@]\217C\310y<?\n\023\177\347e\324\234\323?\245\024\303\253\226:2l\303\263T\370'\305\274\241\213WHp\376\302\366\252TGV\002\206\235R1\325\234 ai\033\342\022\351\233\262\216d\212\\\271j\324\003?\253\022\001\356\260\"\264\237\215p\212MH\030\200$\230\202\244\213\221]\376\336o\224\237|\272,\177\013T\311~\336\252\341pSOL\177$\r\337\374EO$\251\313\254\264\220\271\177\314x\021\331p:\226\266\347\213\037\357(\340d\366\234\245K\003\204\006q!<\230\261\232\016c\335$Y6\036\242\304-p\261pHF]\266\350\267\275\231\377\247\341i\324\032\311\302\301\256\b\345\245\366\276\357\027]_\323\027\204\365J\266\354Y\234Dh\2327\341\257,\033;\2320\003\326\234\332e\364d\0368\262(\016$\202,\r"
+	.string	"\364s\264\266\024_P\237\265\261\214\005\346d\277\351 Z\212QH\340\24424\250{\003\243\323\334\024\226\316\266\005C\002R\\\007\266\247\021\244T\217a\312\314=\337f2\3765\366\255\267\n\236\311I\241\204\246\006\262\nF\307\220\363\t\357\322\236Q\256&\002u\354\033\216"
+	.string	"\223\331\304 y\251a\177\274\006S\t\320L\304t\307e~\336\247\347\232\337p\354\007\006\322\020L+\033*\314:\"\"\007x\233\373>Pa\350\t\027\362#\2737SsM\004Iy\364\361\273\200\330\003,\344\004\360\013Lyq\226m(\035\t\376w\300\242\371j\304\366]3m0\221\035\326\300\365\374-\360\231\352)D\022zaW\246"
+	.string	"\tL^&\314\026m\224Ck\244\307o\225"
+	.string	"\313\232dV\343\332\226\007\273\215\261\243\371\254\233\026t\037\354>\304>\300J\346g\366>H\364,\351\016\343\245\325T\356}4x\344\177\353\025\3035\022\20304Y\343\2154\030\025\363\214\007T$;;aV(N\367M<\332!%%\037:4\3225\231W\330'\364\255\346\367~%\262\023\356P=A\3706\275\204qnx\363\037T4\347\374\205\346A\364\017\262\013\n\016)L\377\2475\325\335c\370s\017"
+	.ascii	"\327M\207\004>\377\224ow'\020\307\325\303[\277\224=Q\360c|\\"
+	.ascii	"a\347\352\037\336\203\345\277\2079o\307<\004\274\n\310\034\314"
+	.ascii	"\230u\016\223\177,\\79B9\342\335\273eo`\376\203\363\343G\335"
+	.ascii	"\005\363\r\203\371\334}\303\353\320\352\347/\334\326\n"
+	.text
+	.section	.gnu.lto_.symtab.5f2bb57f2c9bfcbb,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"schedulerIgnoreTaskExecTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5f2bb57f2c9bfcbb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1952 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`P\003\255\020"
+	.string	"T\026D\004"
+	.string	"."
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\274\331\333\367\005\f\002\003\002\004\002\005\004\240\342\234\212\n\005\006\303\211\311\351\004\006\002\002\002\007\002\b\002\t\007\n\232\242\313\204\f\n\002"
+	.string	"\002\006\n\003\002\004\013\f\r\340\216\253\313\016"
+	.string	"\002\006\017\355\210\354\204\007\b\002\002\013\021\240\367\360\225\r\002\022\206\353\317\360\016\f\002\f\002\f\002\r\002\016\023\352\263\360\321\b\024\025\026\265\314\211\315\006\020\002\017\002\017\002\002\002\020\021\002\020\022\002\022\027\030\227\257\311\336\r\031\222\270\256\304\002\b\002\002\002\023\003\002\004\033\344\362\241\220\b\020\002\024\020\034\360\230\241\312\016\212\001\002"
+	.string	"\002"
+	.string	"\002\b\002\025\002\003\002\026\027\t\002"
+	.string	"\002\007\030\002\030\b\002\031\b\002\t\002\002\016\032\002\016\003\002\033\033\004\026\002\026\"#\342\265\200\335\004>\002\002\034\002\032\002\n$%\256\373\201\203\rX\003\002\004'\342\201\222\246\004\002(\230\227\377\334\t\002)\257\260\211\347\004*\265\371\317\206\t+\362\324\245\255\006,\303\306\351\344\006-\320\266\271\326\t.\374\234\315\270\013/\227\213\266\256\t0\376\312\360\275\b1\265\332\223\353\00123\244\376\226\227\01745\235\336\315\261\00567\362\326\362\261\0038\240\342\234\212\n"
+	.ascii	"S\250\261\241@\032\031T\230\226\244\260\254\001P\202b\310j\035"
+	.ascii	"\022 tJT\"\206\302\261\210fa\353\3375\003\300q\363\030\250\376"
+	.ascii	"L\315\246XYh>\265\322f\230nzI\f\346\236\031\306\365r\362\357"
+	.ascii	"#eGZ\363\233af\240\366\306\r\275N\353\317k\020W\177\376.\302"
+	.ascii	"\303\313~\235\327\306_\306\364\246x\301\303\212\366l]z\262\016"
+	.ascii	"\255\236\363\240\0210\274\025\322;9\333\315|C\004\376&\373\343"
+	.ascii	"jG\210\356\003\030\313\275>i\365)\334\366u\304-\277P\022\253"
+	.ascii	"!\245\027\236\347\311\335\325\373\025bI\216\016\236\263\266\232"
+	.ascii	"\242}]\252A\005\017"
+	.text
+	.section	.gnu.lto_.ipa_sra.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \357\335\003"
+	.string	"\264\003\343"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\006\n"
+	.string	""
+	.string	"\r"
+	.string	"\001"
+	.string	"\001\017\003\021\002\003\022\026\031\001"
+	.string	""
+	.string	"\033\001\034#\001%\001"
+	.string	"\001'"
+	.string	"\003("
+	.string	"\001"
+	.string	"\001"
+	.string	"\034"
+	.string	"\270"
+	.ascii	"r\n8\003TU@en%0\227,\210Z\334\322\006\340\3014\026\361\033\312"
+	.ascii	"2\235\333\270\265`\r\020NB\300|b\343\302@0\315\260 \220\230\003"
+	.ascii	"\377,\302\022\344%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\267\003\225\021"
+	.string	"\306\226VE"
+	.string	"\261&\215\001Mj\301\037\270\261\n\360\235\332\263\214\224\2609\272\246\003\"w\370\"\222\2722}\316-\300\263\230iQ\375\377\f\323j\347\245\252j\241\252\252\252\300\322\201\276D\213^\354\033]!d\220\310'R\312\024;"
+	.string	"F"
+	.string	"I"
+	.string	"\247\375\021h\236\257HM1\306\002\357\347w\341\236h\2141b6_\212\234\314\364\221t\264\363.\374\355\322\325\323\260\245\206J{\221\232\370H0\002\350\347HA|$\035\320\203\2766\004\203\026\205\342\261p\265`\217\262029\0378OQ51$D\026\t\301\0227\232\314\347\241\264\275ua\212\026G\005\t+LN\230B\224Bg\251\242;\251\231\230\003\372;\322U\214\020\b\214u\241\376\332\376@=\r=\034P`+\n\372\254p\032\224\344\212^\240"
+	.string	"\223\"\231$'\374\320t\340\266\364\361\324p\0338\001h\226\262.Z\254\035\016T4\003\316\rh\362\310\333\005n\013V\317\017\367\322\2329\215<"
+	.ascii	"$\202\\\371\227h\256\247\027\022\377g\271\330\307\fN.\024\217"
+	.ascii	"\027\344k\346\252d\254hdks\260D\330H\232\025\214\364EE\352F\216"
+	.ascii	"`\241CC\351\031'\360\370\005|D\300\236E_\270\234vT\245\277,\352"
+	.ascii	"\343r\212\2216\241P\212b\bb\250\2015b\202\231\243)\250S\350`"
+	.ascii	"\002!bE\346\001\022\300\243M\345(\023X'\001Q\245v\366\016\300"
+	.ascii	"\373\030\003\202\204\021\300\030\3768\3635\226\301\220\203n\004"
+	.ascii	"\203\323\255\254\t\316|\004!t\245\360\301\202\034%\347\221E\300"
+	.ascii	"m\301\004\233N)\310BX\202\277\222\305{{\272\242$F\311\342o\265"
+	.ascii	"\317\350\350\t\030\305\222\364;\363@L\330H\1774tv)\321\030Bu"
+	.ascii	"\215\263\322b0\223\\0\0270s\254\272\004P+[\001\237\302\345\033"
+	.ascii	"\244\177\2054\356c\032\266oU*\nN\354\323\231\317[H\356\347\356"
+	.ascii	"\370\224\371\213\375[B\365\312P\314\006q\031~\331iFf\233l\342"
+	.ascii	"\337XH\\=\277\372\310\207\334\300\3276\342\324]\021\376\244\264"
+	.ascii	"\004\n\0236\251\007h\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\022\003\325\f"
+	.string	"v\02064P\245&\351(\233\265\231\225\227M\221e\215\241\212\204#23\263\342q>p20VuUUUU-\272\262\r\303\261MC\271\302\360\346\357boA\310N2$"
+	.string	"'"
+	.string	"-"
+	.string	"\r\220\330\276Y$\336\b\005\\m\303L8z\312>%\036\315\252\316*\311\254\272\222\233F\"\033\333\372Z\3122-hK\320~>\355\324\b\301\200+\333\201\013\266\013\266\312\243\005\241\322\312{\357\265\001\031\2171\266R\366\315\246\325\311\344\037\343\036\337\361\002-\020\307\303\361P:\224\316&\264\t\275'\341\334\005\220x\223p\342L\n\234I|\275\203\213A1\230\312\271[E\"\006m\233i\035J=r\2515\210\353\241\224fd\371\224_\214Go\214\330\033\3329\226\244\033\305\202s\"\207\f\362\001^\250\021A\316H\002\0051\025Z\003\220\002\231\262\343\006\022@\322\212\bb\305\230`\220\330\331\2375"
+	.string	"\356\031@\033[\336B\013_\217\260c\366\354_\276\267d\334\366\345m\363\254\256.u\341\213)\323\340\355\205\212\330\332\263\306\221\264\250$\305b\3377\026\305\272u\263#\"\354\354\365v\272\013\327\264\361\326\030gc\247?e8\b\264\252\357\005V\200(\324<'\231\177\210\\\310lZ\r\223e\265$"
+	.string	"\251\303\261k:B\017\307\225\260\033\217\265\203\202m,\255R"
+	.ascii	"\243\267|\225\030\246\224\b\360C\302\022\312\344\313\263\341"
+	.ascii	"\344z.\222\373N\f\\\262\017\374=~$[\301F\321\375\337\2271\027"
+	.ascii	"\"<\001"
+	.text
+	.section	.gnu.lto_.pureconst.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\006\230\004\n\231\004\r\230"
+	.ascii	"\004\017\205\004\021\205\004\022\231\004\026\231\004\031\230"
+	.ascii	"\004\033\232\004\034\231\004#\231\004%\231\004'\204\004(\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\215\007"
+	.ascii	"\322\312 (\200\305\031\016{Jg\226\321M,\neD`\0013!\322\020\325"
+	.ascii	"|k$\315\020|\273\220\327\007&\370\373\220\211n\233\224)gXF\251"
+	.ascii	"`\320\254~\257\320\312\265\316I\237\204\004\221E\312\303O\345"
+	.ascii	"S\273\201\320\326\002Vh\243T\302_\345\327\204\224\277:\203\177"
+	.ascii	"\224;:\033\235\257\316\363sZ\345V'\243|\321:\202\314\200\345"
+	.ascii	"\202\371\r\251\267\210\232\273h\201\235;`N\271\347\275j\177\345"
+	.ascii	"\217\206KGO\2000 `\202BT\351\001~\262\340v\310\206\210\004~\005"
+	.ascii	"\n\212\200)\350\262\231P\326\300A\031r\330\321\262\221\b\211"
+	.ascii	"\307\240\324\256\026g\327t\207\267\0069<\376\256i#\255\370\273"
+	.ascii	"%\0029'1\357BB!\024\240B\340\022\335\3460\331\tn\372x=\260\r"
+	.ascii	";\253\005\366\217\331\261-\330\036!\006\345\020\304\007\313\016"
+	.ascii	"\035vk\025\214\027\001"
+	.text
+	.section	.gnu.lto_.lto.b24b816d59b45958,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.65.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"4\bh"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\275\310\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\346\006us\250\377\005uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\0014?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.66.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`R\002\225\022"
+	.string	"\006\241vG\320\362&\035Rp\335\300\252\tue\334!\001!\365\214\0057\027K<(B`*\307\327\352@\326\362\260j\323\202\360\323\204\345\220\306\234\243\035\211~\260\202\3761\344i3\356\317\2427Dg\346\252@k\311 \233H\231R_"
+	.string	"\\"
+	.string	"e"
+	.ascii	"9vm\021|\362=\332\366\004\336\343\367\003\336\243e\366\217\005"
+	.ascii	"7,\"9FT\273\013\352\n\177\357lw\227\262\307NS\346\023\335\001"
+	.ascii	"\n$Zm\366\330\215\354\360\360\030P\273\351T\242\240R\034\367"
+	.ascii	"\324\251\331d\027\324s=\356'>P\264Z\317sdew\235\264\332\211\333"
+	.ascii	"\273m\230\355\025;{\002\321\247\361\036-\020Q\005\251\311\234"
+	.ascii	"m\233\245\002\331W\211\302ya\375\261[]\232\365\241\337\373\355"
+	.ascii	"VMg\246O`\002\216\202\251]\023\271!\353\024\225\\\374v\3736\037"
+	.ascii	"W\364\031\262\337L\276\031\317WcG\t \2736\b\217N\371\036K\272"
+	.ascii	"\257l?\355\307\270\f\331\207h^`\367\207)$\321\007M\312@^\277"
+	.ascii	"k\360\354\r,yZj\311\215\316\314\322\353q\217C>S9ETY\352\244I"
+	.ascii	"\325dN\025iGH\222\272k\271\216\227\200\231\221\353Ja\222\221"
+	.ascii	"\320\377\362\354\227\343x}E8*\t\036~\303\006\200 \234\320\252"
+	.ascii	"\351\241g\303\234FH\362d\2078R\354\333\335\224#\230\b\004,v\367"
+	.ascii	"-\0363.\0161\025\002\274\274\\bB\n+\267\240\304\302\0210W\f\224"
+	.ascii	"\351\360\362\372\340\002\306\274X`\300\026X\fDa\340\020\204\013"
+	.ascii	"\006\312\204!\f\\\331\366D\377\216\202\234j\324&*\220[K\332\322"
+	.ascii	"\b#\255\223U\267\036$\262\352\335\356n\247@7\361T[\372*\037("
+	.ascii	"\034\0256\231s\252\355\2317]x\240bc8S\206\006OK\0013 p\002\241"
+	.ascii	"J\242\007\217\230\364Wbk\327\202\315\005J\254c\226\372~\215\305"
+	.ascii	"$\026\374\370\305\214\337L\033E\262\002\234\205 \037\"\300\275"
+	.ascii	"jD\246 \236\212H\362\217\022o\340\307\213\244L\323k\002\302["
+	.ascii	"\022\035i\342_\202@\317\265]\305`\\\254\022\335\357;\346\013"
+	.ascii	"\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.70.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \221E\004"
+	.string	"\244\007\\"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\315\361\037\006yw\350\316\006yu"
+	.string	"\005\001\006'\001\360\035\001\020\025?\202\210\2008sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"0e\250\204\004\232\344\r\240\b"
+	.text
+	.section	.gnu.lto_servoParams_Registry.74.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \237}\004"
+	.string	"\364\007j"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\316\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\340\035\001\b*?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\005"
+	.string	"0e\250\004\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.75.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`l\0015\017"
+	.string	"\226^iE"
+	.string	"\261&\035;V\360L\326\\\n\247\367\235\303\263\033[T2B\344c6\277 \241:\320m\341OZ\316\210\261\245\202\017k\342\312\036\356\214[\377\377\256ZA\3038\003\2461\203^\327/q\377&\215\354-eJ\001U"
+	.string	"R"
+	.string	"U"
+	.string	"'\200=f\037\200=\032e\327\270\007\263\377ZPZ9vWS\020\316\016\275\033&\352\021j\242\374\231#\360P\323\251R\217\320\243\2622#\200j\003$\331\321Y\235\365LQ\235$$\301r=\353 +W\247byz\030\354\256\263Su\270\261\3336\331^`\337D\376\\\346\367\374\273\341\323\252\351\324\364?\260\0332\n\274v9\274x,N\204!\"\363\237\375\326=\237e\320\243\235\342*P\377l\223\245V2\327\007ccwC\036\255 {<"
+	.string	"\017\262\375\264\177\342(P\227\311p\001\273.7.v\275\004\006\311\036\355\005y\232\237\346-\266\324\241\261\313\275\363W\234\005\005\370\020\217\306\260a\357\036\375\r{T\265+\\\310w\376\330\371\300i\312\251\036U\025iq%"
+	.string	"\3341\260k\352\271\230\223|\031\352\365\2557\210Y\325\240\3640\311\227\252KE\307\013\325\027\333K%\311\0167\302\352\342\243\213B\244\222\323F\032e\016\215l%\013&\321\246\235 <\030Ep\240\221F%\022\264\220i\323F\f\2704Ad\322N\245\222I\003y{u\361g\236\321\340\3001\321\223\250/\366\334\350G5'C\0165\3056\030\324\313|9\032r\307\341\356.\264\310\241~\364\254\303\035+\027\327\222\005\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.79.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007["
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\336\201\037\005yw\250\324\005yu"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\0038sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"A\210!\345.\320$o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.84.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.85.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.86.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.87.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.88.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.89.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.90.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.91.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.92.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\203\304\243\017wu\b\310\001y\307\025\370\377\202\017sq\002\314\001y\313\024\023\022\021\020\234\236\350\027om\t\330\001y\327\017\374\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\254\227~kg\334\001y\351\001\007\006\240\227zse\314\001y\357\005\357\342\rca\004\363\001y\362\004\003\002\360\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.93.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`k\002u\024"
+	.string	"\326\345\207J\260\022R:\342\003O\200^\300Q\207\f\344)\204\336\204\252%?\031\031\207\212V\354\004+\336|q\232\3170\370\343\022\270\037\376~\2478\332\177\006\200I\321\355\206\177GI\255\177\020"
+	.string	"\371\241\364\343\024\366\243fl\226l\"\245L\001q"
+	.string	"k"
+	.string	"t"
+	.string	"\273\277.)\214\235\0067\234\354>Q\326\350\016&8\tL\347\001\361\377\365\205*\355\216\263A\024\"\306#\022<NA\272{\026@GF\235\253\002F\235|\2448:N\221\027\347\332AG\005r\3614Y\200Y=\037\220\212\"\276\035\231OgY\034\301*\372!\342\333\021I\206\254F\250P\267\307\227\263\373J\351\356o\317\367\243\177\351\377\333\177\333\277?\0012\254M=\226^\254\254B\235-\200U<Cx[\376\301\234\345\337\257\\\226ey6\272\354\373\2302\351I\r\252\276\276\037a\3739\367\342k\317\343~\347^\001\210\f\261\026Hu\207(\273Z\307\034\252P&\325_eEQ\267\321\246\263\220*\251\273e\373\357\256\302\313\256\300d\247L7\260^\361\202\332\021\004\244;\210@\347M`\001R(\327)\035B\210\260\2622\352\234L\016I\026\231\005\230u-\255\242\241\310\277\223\314\274C\204W\377\004\225\242"
+	.string	"\353\356\223k\224\322\250`\241e\265\327\302Z\245;\305\205E\304\374{\2517#\311\004\204\266\204>tV\310\227I\336\034\247)T\215?\b\361\030R\352\3269\321\030?\007\235a[\003&\272\204AJ\335\215\362\2442^\256H:\017\203a\265\247\363\032\277\311\344t*.:\232\215.\247\222\223\020c\303\341h\267\332"
+	.ascii	"\r6\027\034\203\330k%3\271\032\235mfFs{\201\211\2710\303\301"
+	.ascii	"\320df5\335\314\254\244\300s\031l\272\031M.\247\233\311\202<"
+	.ascii	"\025\233\215\276H\\ \246\214L\332\272\022c<r\317\377\221\237"
+	.ascii	"\302\343\034\261\273{\344\337\035h\325\203\006%\210\234p\334"
+	.ascii	"\2201\311\202\n\270\304>>V)\346\344\030\253\207+\336\2265j\343"
+	.ascii	"\001- p\002\231\",\017~\261#\215\350\277\342\231JH\205\215\233"
+	.ascii	"\352$(\273%\233%\360\356\004\322\374\n&A\314\241\r\206\003gK"
+	.ascii	"\016\2055\324\36642^\332.\374\321\222\301\374\n\207\367D\302"
+	.ascii	"v\n\331\2308\371c]6\260\325\250\027c\240\372\303\r\266\r`\244"
+	.ascii	"\201b\344r\271M\bZ@\t5\202G@v\261\032o\223Q\275\002\024"
+	.text
+	.section	.gnu.lto_servoDirection.94.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`<\001\305\r"
+	.string	"\246Z^C"
+	.string	"s\224\0168\251\251R\241\003%\254\033\350\214\177$\373\330\374\365\336\220L>\2609P\r +(}\030#B\277Eh\0248\347\265\031\256RA/\004\fx\004\323Q\352\225\327\337b5\364Gdo)S\nH"
+	.string	"E"
+	.string	"O"
+	.string	"\0052\217\266}\227\257J\366\013~*\274\267\254@\275\364\330]m\344\001\262Gx"
+	.string	"\331\243\266\274t\250Y\362S\016\035\270\314Hy\"\256\"^\007Gv\367\255\247\212w\312\004)\331]g\312\003q\307\333^`\033\202}\017\001\031\263\277.\225\305>\\]\261\377\375\231\263~\220\247\243\246\241\246\365\351\324\3645\"<p(\310\261\373!\006\333\033\261F\013o\370\013k\b\030\325\356nn\227\354\215\375\3318\360<\313/kvS\250h\354\256\001\007\376dP%\270t\234\322\207U\257P\263\027\212D\2271\247\252\036\025\223Q\222\247f?8\300:[\270\214\023\006%T&V\273'\004w\331\241\307\330r"
+	.string	"\n\230\253\303jw\023\300\370\013\006\237\305\243E\244|\n%{\274\276u\002\035\214\013\226)6\361t8\322\366`D\n\201>\033\r\236\t\240\006!\356pD[\006\316#\322F&\025>\027(h\240O\204\023\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351pu\305(#\224\344o]sbGLr\036U\305vT\227\230\264\203\312\222\273\233\242\001\027"
+	.string	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353\343\204}l\266\266\274u]\030%n\266i\301\n`\004\344\003\303\202\n\255"
+	.ascii	"*G\251j\030u|kK\031"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.95.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`c\002\025\023"
+	.string	"\026d~I\320\322(\035\320fX\362\346s\231\275\231\025p\347\311\275\305\036&3\022\bl\024\363e\203\237~\344\003\262\202\372\237\366\377E\213#xY\327M\204O8J=\214\304\017\034\f\354\001\307l\372`\025\027\235\211Scdo\271S\ng"
+	.string	"e"
+	.string	"o"
+	.ascii	"\006>\240;\235\027\320\235J\317,{\307\307\234\372\233\250\001"
+	.ascii	"\350G\255\365[\034\007\370\034o*Y\357\350\\\311\362{~@\314\201"
+	.ascii	"a\353\335\\#\"\021$al\246\310pj|\274\224\t_\222\356\324|\316"
+	.ascii	"\024q6\202$\204\315\375\271\ryaL\356\307\227\320r`Xs\031\302"
+	.ascii	"\240\326j\t\206\035\356\220\333n\331n`\313\231_u\376\211\003"
+	.ascii	"\255|\035_\210\221\007O\375\230\356\224\332l\314z\270\344\222"
+	.ascii	"=\276\344\336\330G\t\212\335\360\332\330\336}\356\271\322\273"
+	.ascii	"\322RJ\177\004\300\314h\201\217Zg\226\202\324\"\352\202\304}"
+	.ascii	"~\373\373\"7\313p\023\026\241\321\341\331\247\371\243\275\323"
+	.ascii	"\213\257\261\356c!S\213\203\351v[\201Tk59u\211\3514CB+\005r`"
+	.ascii	"`\020q2!n;@@\314\275\261J\367U\331r\300\244\222\355\007o\241"
+	.ascii	"\342@6\223\321j\205)\270\315\2069\213\225\220\332\006\235\031"
+	.ascii	"\264Z+J\320q,-\335\351\367\343\021\320\344xjk\224$\362X\217H"
+	.ascii	"#\3352:\223\237v\025(\222\234Z]\007}\024Oq\362uN-\001\205\352"
+	.ascii	"N\355\224\005y\320\022GS\024\333\226\035v9\335,'\253\024\214"
+	.ascii	"\252e\365\275\270D8M\200\360Q8\255\240>\026\325\352;!\340T\205"
+	.ascii	"\026\325\367\222J\251>ot}m\336s\023\216\247\310\265\257\\\267"
+	.ascii	"7\026)1\275\335#i\362\2712\026\352\346\276f;\202I\245\317Zk\245"
+	.ascii	"\t>\327\333{\240\345vi\034L\372\252\223\273\373\230\354%\227"
+	.ascii	"\034C\356'\303!\023?\270\344\222\377C\024+ p\002\241\262\234"
+	.ascii	"\007\n\262\"f\315M\234\277\267\343\335$\004\323\374\213\342\301"
+	.ascii	"E\314\203\005L\231\335\207V\254\027\212X\261\347cq\301\001\354"
+	.ascii	"\240\335\310\333\300\255\313J\352\2654g\016\247\230\301\235\205"
+	.ascii	"GD\325S)\215\360\326)\241\276k\200\245+\031<\303\321R\260Z\371"
+	.ascii	"B\344\231Q^@\0138\306D\f\211\316\325\311"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.96.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\245\003}\032"
+	.string	"\3460\253H\240\232M:\234'\205\024\314v@\311l\2136\373\f\325\357^\027\271\326\220\373P\370\310\370\213\336\2259\240s\353~\234\207\367u]\321'\002X\367\204I\2004\371\366\262\206\220.\033\216*#:\351Gk\226\020\262\267\224I\006\230"
+	.string	"\212"
+	.string	"\231"
+	.string	"\247\tN"
+	.string	"<\235\037"
+	.string	"\236>\266B\273`\336\343\325\260\t\213\221\017M\255u\354\246\r\360\331\373R\026\272\030\202t\276\232\205\366\274\344G\356n\027\017\365\013Mj\302\350HZz8\003\360\272\302\304vFs\304*\322\255\202-HK\f\316\260H\367$\333\345\246O\027\027\224\367\210\230\302~(}\212J\177\315\0016\252\270\360p\tr\343PW"
+	.ascii	"\004\311\006\367\204\300\365\304\314{g\032\273\334$\240{\"\017"
+	.ascii	"u>\332\341\230\303\n\265\326er\227\364\205}w{\273\273\263\333"
+	.ascii	"O\001|\222\273\201.J\026\256o\353\244\b\222\255\376\373\304\224"
+	.ascii	"\027\"\356\332}\222O\355\325\336ia\254\025\237<\335\257Uw\r2"
+	.ascii	"D\226\206\270\334\355\335\270\231v\3771]~8\266w\354\202\2749"
+	.ascii	"8\227\372\312\230\367\346\2746\315\033\233\2740\312\373\242\274"
+	.ascii	"\342\344\r\231\027\234\274\224yg\3636\363\362y\257# I\313\204"
+	.string	"\262V]\231\246fQ(>.\365\335\033\331\3676\366#\217\022\272\324^\2117$\261\t\325\027\256Z\353\316\351B\020\003\013x\265V\237=\225W\341\260\035>\360\311\017\340\351,st\343\325a\303\3729!\341\267\n(\366\253\237\003\202\343re-v\001\237\321\232!.\261~\356\323\262]\312L\202\326U\330\367\201\375\336?D7\245\233\n\253h7\233i\177\037^\027\327\353? m\333\202\370\223\037\036\236\214;\231\351\360~\264yx\314\326\371]u\357\233\274J\304\b\022L\302G\212\331\022gb\242\247gwg|\311\214\201V\255D>JN\0054\357t\272)h \r<\355\356\331\212\202\361n\213Z\264\357,BPM\206\r(h\214\241\"\005\215\005\212\321\005\315D\213qf\013\032#\030\330\332\013 \333\030\243V\263\215\261\255\357\035\353\241F\326P\343\304\003\274\213!\003\237\\\233\337\031\221W\221j\255\017"
+	.string	"\210\311\272\261\232\245\240\204fJ\350"
+	.string	"\314\t1u\005@Y\226Zw"
+	.string	"\336tN/\347r\340n\372P?\215_\030\260\231\366\246\307\304i\352\345\265sY\037\311\332\246-`\211\265M\337hM\226X#\330Z\032\342\362\263\326Z)\317e\215\323\267\212\312\222\313\201{\224\025\032^u\247\335=q+\033\002F\250q \001C\f\032\344\204%B\")h1p\002\031\242+;\020p8\2440\031\016q\004d\233\023\025\b\324\234\325y"
+	.ascii	"\300U\326\255\226\203bHB\231\252\205g\334\221\035\367\2102HO"
+	.ascii	"#\330]\347 \233\030C\251\347\032\225\n-\332,\371\341\224`\244"
+	.ascii	"y\324\367\256(\264M\267\264Ze\326\346\304\005\245\243\253Vja"
+	.ascii	"\326\310]\362<\372\305\343\220\347\247\245\004\005\f\330E\224"
+	.ascii	"7.<\021A\202\024s\332\306\013G\331 \250\002\007\223\377\220,"
+	.ascii	"\001\024\027A\340\271\367\364\270\013\340\301\231\b\372?5"
+	.text
+	.section	.gnu.lto_servosInit.97.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\340\002\215\026"
+	.string	"\306\251\221J\240\230Q:\300y\237!\306KL\223\222G\004\374\337K\315\374\247W)\334\346Y\006\265<\b\355\223\003\302\230v\374\275\030\247\351;\367\262\001\225\351i\374\341A'\255\230-\360\244\336\204\213\360\351\300B\312<\004\221X\262\267\224I\006}"
+	.string	"x"
+	.string	"}"
+	.string	"\247'7\266\253\344=]\275\357\250(jJ\255u\325+V\374\354}I\216\235e\024\311P5\233c\373\335\307\322&;\013M\212\033\356\343T\r\367\335i^\324L\2608UH5$\237\252\225\230\254&Kp\347\0211y\0257\245\207\254t\025\211O\027[\321\234\251\265\2226\032\367\204IjQ\272\330f\323\206\211T\224\357\316F6\032\263\212A\255u\271\264\335\276-\337\335\250\335\275\331\345#\001\273\"\016\365\023\243\253\225\306\242\361\032\255\371\246\323\335"
+	.ascii	"\024\276<\335\003\205\247\3345,xC\034\\\221w?\300\370\345;\346"
+	.ascii	"w\0028k\331nO\306\235\333=\253\t\221\3236\323\256\f\371\247\357"
+	.ascii	"Hy\305\311\033R^Jy\347"
+	.string	"\344\355\346e\346\275\200\027\"F\036,\2515)h\245\002\351\317\305\237\276{\031{\336\222\b\022\304\376$$V'U\016\337\022\223Z{7\247k#\006:\254\023\236\302\350\306\016{\201/\330\215\003\211\212T\330\271\345>\217\237w:\002\311\334\013\205d\033\355U\007\276\2032\351\210\361d5\003\210\216\371\034\247\315U\266W+\355\367@Ak\331_\246\212Du\347\366 \302\331<PIh\\e\003\360\314-\204\273\0270\360\313\331-?\030@Z\313\266{\177\3438\366\307\276iw\326\007\277\\\037\341\351\241\224N\270\273_te\267\3476|j\024l\255o\017\016\314\025\342\345\003[\005i\370iq\310\260\352\320\332\001Z\365\274`+\034\002\353\362\340\363Z\005\271\\\257\025\331\253o\246\235P\0048\324\263\006\374\033\302R\200w\035@\340\227\333\362\0132\212\3153\200w#H\340\227b\177\367\037\375~\210\235\333\363n"
+	.string	"\027\312\364N\025\331c\033\211W\362\177\326\316](\034[\246\177\363I!Z\232qpI!\317\tw\367\365\0369"
+	.string	"t\265V\326^\352?\n[!9 P\202Q\306\314<b`\226#\017[\271\335\2410V\357\032\344\336\256\205Q\337\205(\034\"\212a\334f\305\360\314\304u\335\202\005\310ih1,\031\254\2649\031\020zn\253\2660\017\t\031C$\312\037b\261\205\344#f\353\245s&\347\021\0138\266`\346\240@\2148~\030`\302"
+	.ascii	"\013e\346\200\232\2530Q\b\203\316\216im\\B\254\314l\\\370n\313"
+	.ascii	"\203\0274\312\312\031i\337Xj\316o\020X\344\313\032\275\353A\001"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.98.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`.\004U\032"
+	.string	"6\357\245H\240\034Q:\022@\321S##m\255I(\025-\006\375\021\230\372^\bnI\326i'\227X\230{\270|N\341\267\272\313\212yU!\200~\321<^b4\236B(\356\215\245H\343C\3440\342\351\355\017D\310\336[\356$\003\216"
+	.string	"\212"
+	.string	"\226"
+	.string	"*f\376d\376\356H`\347\261\022\347\334\313c\027\345\336\333\303\f\306W\004'`_\351\007\330W\2061\233yOw\037,\002:rs\357%\333\207e\001\247\2753m\330E[G\332\023\306Or\005HO5\233\214\213T\234a#H"
+	.string	"\033\020\245\020u&\351\300\031\323\002\0302\364:\016}\244\335d\205\307\275\b\345\240\025n>\270\334\367\031d\223M:\004\307\373\2763\020\266\251\331p|\212\027\356\275<k\266\033\347\2343s\021f\326\300L\023\004\265W\376\313\276\336wz\005L\0277kb\335\224\006\t\232\346\006W\265NC\020>\321n\2629\305\334\223\315\3161\377"
+	.string	"\r\237\0207\216ygu\336Y\347\274_\365\337y\274\321Y\374d['\327\236L\351\344\246\223gO>\201\0019\2320,\335kcJ\3522\325$!\377\375F\034\343An\234\223\021`Pg8Aw0\303\030W\302\034\250tQ1\277\307\367\261\352\225\231\215Xi\224!4\376\202\2743\367^\236W~0\276\3263\t\314l\342^>D\030\336;cz\023\b\032B\204\025\321\007\236\3049\025\361bs\252\257\246I\321\233\3329\376\3308\3169\322;\335P\223\347b\007\t8+Y\261\317S\0025\233Q\247\367\336K\305\336\351\017\t\333\374\312\231G|K\231\341\247%\213u2`\231I\334J\331?\230,U)"
+	.string	"\247\226\206e\231}>\205\325RGIR\346\321pM\354\245e>\361'e\005\346\244n\022\276\204\231\305\235\244P\001\251A\004\265\273\367R\020\036i\005\237\350\225[-\346\003\214\242<\fV\211\237\262\262\217\203W\353\205\213\365\"]\2408Q\2520A\376\224$V\220>\256\027\351\240"
+	.ascii	"\267X\260\\\244\213V\313E\252z\261'\3718E\007S\254eb\347x\205"
+	.ascii	"\245\256\272\241F\236\217c[.\263\031\305\265m_\303\313l\350\031"
+	.ascii	"\222\371\260@7\246v\217\230i[\222\252\331\261W\375($(\264\233"
+	.ascii	"L\314\013\016\f\353\241\273\355\210\370\036\2320\377\374)\fe"
+	.ascii	"\023\264#6\247\270\373M\373\264\"\3429\213\235\335}\032\221\261"
+	.ascii	"g\213p\200\342p\207\177\361`AwoQ\250q0\204\224Q\304\030ED\204"
+	.ascii	"ff\013\323\001\320\002\231\242\255\003\021\2205Cd\264\304Zk\f"
+	.ascii	"pV\305:\225N\260\347\302\021\223\300\027#\272$\334U+\230t\021"
+	.ascii	"\0013\002z\347\372\035P\347Lq\353\204\rX1g\n\274\270\366q\371"
+	.ascii	"\364\333\334\331I\207Q{#rc\306@\262{\f\207\377\306\016\033q["
+	.ascii	"\b$\375\276z&\223p$\321\027\377\265\021\223W\274\3451\346Ga\375"
+	.ascii	"\200\215\252\370b\202\0345\344\231w(fi\020\321\022v\301\301\275"
+	.ascii	"zP\331\306\276\031?\347 L\254\353\021P\027\330\223\201q\334\220"
+	.ascii	"\232F'\025\376yvB\237\006"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.99.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\316\002\355\026"
+	.string	"vl\232H\300\026U:\344'\254;\023 \013\021R*\244\251ut>\036^\276\277\207b\215\247\330\313\272\370\332\267TEz\334\2026\212d\234\324\270\363\306\177\346J\371\tTz\246%\264Z\261t*\203!t\003\t\250\244\221\275\245L2\202"
+	.string	"{"
+	.string	"\207"
+	.ascii	";n/\367\b\311\243\202\004\006)!\326ZqNw\001yj\363\232\361t\236"
+	.ascii	"f<\335]\346\335\003\bn\0272\261]\353\217\312\220ZK\003{C\236"
+	.ascii	"\356m7\313K\030\225\024d\304\363\321\245\326\272\352\027\213"
+	.ascii	"\372,\277\223o\247\263\371\266'z\001!\227\236\217\347t\222t)"
+	.ascii	"f\240|\272\271sD\034>x\356\361\345x\326\360y?\370\033\241\223"
+	.ascii	"\236\317\347LbPk]\356\371V|\307\357nlw+\354r\230\227q\272\262"
+	.ascii	"\021\374\336\351~\304x\372.E\271\342e\b\307\305\3352\307\r\264"
+	.ascii	"\373\035\030G\304m\027\273\252\013\37532\314\033\363\242o\nu"
+	.ascii	"\340\367\364\362k\032yK#/9\362\222\230w\234\274t\362N\312\333"
+	.ascii	"\314\313\223\36754BP$\024kMQ\374R\237\320!\215\003\377\242\277"
+	.ascii	"|\357>\b\f\376`\022\201<\217}\217\"\333\353\256\332Z\004-!\326"
+	.ascii	"Z> O\371D{\332\017=\247"
+	.string	"V5\311G\350d\367Sq\367\330\273\026.\360{k\243k\236\245=\316\364l\332\337\375N={\202Y\0177\262B\310Z\353\316~\370\"\0302\260X\343i7\200*C\034\0277\347\246\226\351\007\357\300\206p\312\356\227\343bw0\211\316\327\r\264GF\356\230\376NK\216\213\233jn\235-\255\013\2611\022*\302\033\2718\300`\343i\252\337\343\223\210\021,8\336\250\276\220\027f?<\210\215\254\365D\202\375\217\003\t\261\0015\027\355\365\232p\322\220\201k.\332\3535\001\204+\026cuh\005(\341\332\020\203@\241F\233\301^\251m\351\320d$f.\332\252\326\201\003\f\304k\025\203\261B\254Z3\332J\207\300\312D\270f\253\232L6[\235J\334\333\305\026\321\361\004\3279\332@\253 F\253\332\3663\3048?u\317\203?\212*?FD'\245\374\374\030\325\246\356\241\215\245n`\345\004\037-\331\244.\265"
+	.ascii	"\037<\0262\246&{\200\220\227#\246OMj\332\204w#\307\305\317Zk"
+	.ascii	"\2359\0171 \220\002\231:\343\006\335\322\236(\242h\356%!\013"
+	.ascii	"\223\255L\305\200\260\333#K\026\345$xi&\2246\016n*+\350\204\323"
+	.ascii	"\325\224\352\331\226\222\245\201\001/\237\247\215\253Vc\004\317"
+	.ascii	"\204I\003\023\224\312\323xH\027\250_\0056\030m\315t{\232\203"
+	.ascii	"p.\307\250B8$t\345\006ZF\265Cg\007\031\204\311\357\005S\304m"
+	.ascii	"\241\032\277/\221\316\325\237"
+	.text
+	.section	.gnu.lto_updateGimbalServos.102.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\301\001\035\017"
+	.string	"f\234bC"
+	.string	"\221(\035p\234\330>@i\361\200\273<\212\233(m\200\331%yX&\233\352}\262\305\005\345\352We\303>;PD~S\251\237\306$\243\202\200\240o\360\211-)\037%\334O\335\214\315\022\2627\2212\245J"
+	.string	"L"
+	.string	"R"
+	.string	"?\341\007\037\313\356n\207v\211\275\035\346f;\323>\200\300\364\026\023\353nJ\314\213]\317c\003\332\241M6\215{#6#\361J\271\350\330]NE\334\3644\371g]\243Z\235<\263\005\273\353T\255<\334z\333\004l+\260\023B\367^"
+	.string	"\307\313\204\013\323\353\346%Gj\346\224\237\355\241RC\330\307VU\354,\335\311\322\234\230\336`z\223\2455YZ\213\351\f\246\343[~,\323\212\2453\323\007\020\240\303\214\0065v9|\257\225\201\256\022\266\337\302\276\230\243\270W\022g\035\262\274|()\250\374\334Q\027W\335\370G\344hG\237\372\200:\213\267\210\340\257XBHH<\344(Ty\355"
+	.string	"\341\221\233^}\357\003\312\253<`\203\236x\243\233zPl<\305W\214h\273\233\300w\271\212\220\277rh\013\242\274J\024\273x\270\321\032@\024H\0308(\221F!\021\017\177@H]\206\021\210\304\225*\214\204.\210p$\241\t\"\3563\"q \002\334a"
+	.string	"\215\270R\327\215\270\315;\235u\rf%sR\22452\362\037QS\r\214\226\251\252\337\212\232\265\354\303x\f\327\243\276\225\252\352I\315\230DLS\003& \260\002\031\262\351\001G\02494\030\251\314"
+	.ascii	"\326\205\273\330iyS\030\\E\216\31173.\326v\302$Kd$\266)\0173"
+	.ascii	"\270\nxLj\317\240\345\251\335/\272\343Y\273\320v\244\333b\270"
+	.ascii	"\n\354Z\0069\311ng+BF.\t\2605\225o\016,nq\255'"
+	.text
+	.section	.gnu.lto_writeServos.103.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\331\025\255V"
+	.string	"J\217\360\036K0\022[\031\016\3440\212\247\\\257\225L\007\222\262e!@\030\364U\201\003\017\370:\244'\311\243\331\023lC\257\233\377\215\252\320AelN\203\211U$\256FU"
+	.string	"\302QE\235\216"
+	.ascii	"\002-\375\307P\352c\020v\333d\357-eJ\001\331\001\257\001\366"
+	.ascii	"\001\352\244R\215T\244>*\325F\242:8\252\201\245\332\374\251\213"
+	.ascii	"Ju\371S\377~w\217\244Z|\333\275\243ZE\365_&5\207\207#\210\363"
+	.ascii	"|\322w\350\274\033\347\300\374\356\327\341\247\373\333.\332\267"
+	.ascii	"\b\337\301\300=pl\366\363l<8\033\232\344\261\363\326)\204\347"
+	.ascii	"O]\016\336:vO\343\343p;\2773<\235\353\224^ee\\\rm{\347y\"P~$"
+	.ascii	"q!\371Q<\023I\247\016\332\034\235\234;r{\320\340\350\211\243"
+	.ascii	"{\003\b\315\r]\233?k\306AhW\3637\033\350\021\236\306\013%\220"
+	.ascii	"\020\037\355\021l\340\307\243\273\031h\003\020\030\276mIy\256"
+	.ascii	"\375\340\270\244\355\235\347\333\325G\233(?\016m\275\277i9_C"
+	.ascii	"\0231\032\2048\317\023k_(\313\022\212$I\323\342\305\267\033I"
+	.ascii	"\034~J*\n\352\311I\330\304\264\244\224\204td\024\004\232E\345"
+	.ascii	"\217\034\305\245\252\322\241\377\313\362S\303\230\231\327\247"
+	.ascii	"\320\\\n\215\333\031\215\022\177N\312\366<\257\314\214\270\342"
+	.ascii	"\207@i\307\353\242Pl\177\002s'\321\304\336\234B\302'_\306\036"
+	.ascii	"\246\354\213\n\363\312\300x\321&\2663a9\343\362%\321\204\025"
+	.ascii	"\035Rx^\031\027Q\210\327\302\237+\211$\362\312\266\300\240Ib"
+	.ascii	"p\217\230\264\003\244\300\331s<V\024\251"
+	.string	"D\226\263+?Zc\024\367\233\005\345\200b\321\331\234\031\236W\246ET\001\350\213\232\343\360\022a\312\244\250\371\313\312r\226\366\242\177iy9\367\233a9C\373\357\227E\347\003\360\305\200\345L\313\311(\037\217\314\302JP\021h\026&\222p\273:1c\242\233v*\275\362*\267*T\332\304\246\230f`dy\236\347\261\224i)\365\227u\236\247u\314\354\354\026q[\215\330\266\300n2\n\256C~,\202B\207m\320\227\366\371;\264I\033\253\310\253\275\333\313Bl\372\374U\244\270Wk\025C\003\323>[K\320\260%~\027\317\240\241\037\243\261\207\333\202\366\245}_8\023\304\210JH\335.6~\230(\237\237\324\256aC?\246\213dG\315\373\374n\277\301v\347\245\210V\320O\265jC\334Y^\212\310\177\225\325\313z\243\034]\324\265\310>4\250k\221\207|D\326\033\t\t\r\371|Mv\205\374 \220\342"
+	.string	"\341\017\262\336\210\207\356h\317\377\241\364\002\310\327\023\343\326\316\025\374\370>X\257\374\265\310\217\326\261\223\214\312\032\037\333z#\"\264\363\364\272\025\035;\007\370\370\375\230s\212&2\223\3329t\350\307\276Gv\312\354pZCR\333\307\226~\314j\347\312\035\330z\331o`\272j\366W\374\020\266\346u\3016\325JLu\022S\215\244Tw}\020T\037\001\252\271L\265\021S]$\250&\002T{`\252;0\325C\202j!@u\020S\r\304To\005\325?\200j\037\246\272\207\251\346\021Ts"
+	.string	"T\3570\325\033\230j\035A\265\006@u\016S\235\201\251\306 \250\306\001Tk\231\352\033\246\332FP}\001P]\303T[`\252+\b\252)"
+	.string	"\252i\230\352\tL\365\fS-A\251\226\021TG"
+	.string	"T\3070\325\020\230j\030A\365\013\240\332\205\251~\300T\267\b\252\035"
+	.string	"\252Y\230\352,S\335@P\315"
+	.string	"P\275\200\002\t\250 "
+	.ascii	"+\005\nR}5\342:\320\335UTSRQP\245\372iT;\225jaP\335\004T3\231"
+	.ascii	"\352%S\255d\006Q\213B\304\026\355\361\\<cG\305\306F\205\243\016"
+	.ascii	"\366\034\262\035$\032\"dM\220\025\262f\b\276 \3735F\204(\262"
+	.ascii	"F\n\025!\362\346\301\022y\003B\220\007\3737!\334\2142\330c\341"
+	.ascii	"\030l\006z\030\340X\024\367\343\264\026G\234\017~\264\366q\033"
+	.ascii	"\360\021oE\352\330\r"
+	.string	"\364\350\320`\365\314\37579V\2037\266\336i\036\236\346\330\277\351aw+\222\307\366\250\343\301\201\233\035\313\201\033[\355(\335\235\357\330\273\001B\307\212\334Z s\266~\264\361\261?\332\330\nG\345l\260\217}\033BW\202\253\026\247\302+X\013\336T@\201\034\215\245@\216\20664\366r7\326(\227\333\330\033o6.\200Sc/\200\343\326Vc\017\347\317\035(\300U3RZ\021\001\373-e\344\250\224\314P\031\273\",Bb\276P\231\254\2542e`\343\347\005\340y\201\231'^\265\004\214\202\352z\230@\206\031+\301N0f\306\n\267\240\311X\t\366b\211~{\3422\366H\2348a\207\300\"\330r\375\272\030\033A\235}DcX\213\261\257\203\332r\017H,\321\227\220P\213\265#\2410+U\373\333\343p\361L] \261D_\332\267&\346\366\252\024\255\332\2050\204\tS>\340%\351Vd\213}"
+	.ascii	"\206\026\016\354\211\373s,\326\2019[\325\364\205,\"\213\375\034"
+	.ascii	"\004-\224\267\"a,\004+\300x!\307\305\276\220c\353\024\255Be]"
+	.ascii	"\354\345\0042\355\324\375\262V\312\307\004\221\270\025\331\300"
+	.ascii	"f\355\305R\200\242Q\206e\206f\206h\206h\310\217\r\354\350\302"
+	.ascii	"!Ch%\224\201\275\272Og\250\206\005\211\022\326\313\013,\003\213"
+	.ascii	"\"l\357tl-\3233\027\245Y\013\362\343\002{:\027`\320!3s_\332G"
+	.ascii	"\256\232\013\322\266\216i\023\027B-\347y\256\260\222\351\t0\374"
+	.ascii	".\037\035C\206\f\362\343\370\0262\344!l\3750\022\303\264\217"
+	.ascii	"\024H\270@\350\332B\202\225DH\220!D\200`\031\031\302\243\b\226"
+	.ascii	"\217.$X)\246\314ud\253\013+\t\027W\027\026\360\355\3537\334}"
+	.ascii	"-\330\324\225>I\371`\237\3040}\202\020K\264\224\227\207\006)"
+	.ascii	"(\252\375\300\311o\347\351\224\003\232\273\250U\363\361.@\016"
+	.ascii	"O\n\254\231\306\035\261d~\232Z\213L\273Tl\037\241`\306\224\371"
+	.ascii	"/B5Q\231dnp\342\224\300Z\024R\355\324\222\215X\005\366x\027\371"
+	.ascii	"\370\004\322\247\022\332\264\302\265\251VH\265\t\254\b\210i\233"
+	.ascii	"\366\200\302\366\252,\025\246\005\356\201cf\316;<)\244\307i\325"
+	.ascii	"\374a\031ri"
+	.string	"W\006\245M\332\245\275\030\332JQ\332\303\365A\332\244\021{\342H\033\245\347\332e\rK\024\341\241\310\243\245\032\243f8e\243\f\253\2200\206\315J\333y2Qq\036\240\f\257\214|Ox\b\324v\236\347\212\217^\0246\205!\013\303\026\206j/\220\037\217\366y\307r\003g&\215\023Cs\232V\315\252t\365\343\27544\307n\351\352\343\222YT\222Z]R\261\273d>\3236\271\324\252X\034|\342\\\251\321\332C.C/L\326\313Rk\264\006\360\201\013\300I\026\037\226V\315\343\265\310\340*\037\233>L\224/8\346N\337\321\224D\244\250\325>h\322\004\305/!U\315\334\242\t\265'S\250\324/!\265\017\231/\244~\271\324\222\031\354\300\355a\245$>\214\201\264\207b\206d\364c\300\237p\247\357\216I\017OZ5\0370v\224b\277\305M\256\n\305E,\231!7\273#\024Uj\346Q?\021&\037"
+	.ascii	"nn@\204$bS\274X\263S\262&$Y$\253d\303\222t-\222\242=\361\256"
+	.ascii	"#k\256\237\207k\217\344\261\211,\330~q\355\363D\255\251_\036"
+	.ascii	"\201\265\250QL\004"
+	.string	"\23124\"\"\"I\222\2445\321\005\304 \245\230U=\021\2600\206\024c\304dFAAA\222\f\273\001\214\375IU*\004;Q\202\n\024DL\237\367no\320\234\213J\346\034&^\002z\306\315\212\377J\031W;t"
+	.string	"\261\227\262\016\373\365m\\\245\271\227\217G\364\344\263I\016\3031a*\233\355g\025\250\247mY\007VU\005\202\2076\217\311B0\036\354\303c\tD\002&\341\311\021V\342\007Y?\336\230\306\275K"
+	.ascii	"h\243<\004e/W\304\356\266\217\240\264\310k\005[\376\035\341j"
+	.ascii	"\267\r\332\367\360\207\375P\357\006XX\320\223\345\364\307Muu"
+	.ascii	"GY\325bM\246\006\306'\360(K\312b\203\023\275P\304Q\256\037\357"
+	.ascii	"\365\013\024'\215&\370*M\300\322\2048\223\252\035$\n-\035\306"
+	.ascii	"\313\314k\365I\310dU\252\032\021\320\033/\232\235\223\245\317"
+	.ascii	"\311\260\227j\341d\253\240>\357\030\234\214\177\247\343\371>"
+	.ascii	"\365\361\246\260\364\361y/]\340D\314\267\233\351\006\0235\020"
+	.ascii	"\326\323C\316\017\035h\267\257\227ne\216\347\367\231\371\022"
+	.ascii	"\331\275\017\203\362t\020\260\337Fm\025\345\213\233\234\007\365"
+	.ascii	"R/\235\300\260\335Fm)\352\232i\030\271\373\367\352\r\201\221"
+	.ascii	"&a\300\366f\321\234\273F\301"
+	.string	"\324\272o\261s\362\021rc\300tk\346\021<\\ \340\324z\013\214\361\337\2277\242\342\340\344\340D\377\234\032\211\036\031u\263N \270Mt\245su\356^\024E\320\274\001\367\252\017\373\271\003X\310\353\003\227\003T\307\020\303\257\203S-YU1\345\233M\370\266J\202\021\230[\311H\372xG\330\202\232\324\375\342f\275\337w\t^\210\313\257\213xf\357{\301\335]\004\255\357\243F\361:\377\353\024\254tB\b\224IL\373\rc\312\b\245\221\221BB\270\30317\324\342\n6\031\236t\367\033\330QF\343\034\001l\"<\036\317Jo\205\332\275U\022\035|\224\215FX\254\032\363\250Kms\321\f\002\200I\320\231U\267\322\373Z\360/\256\255\276p\235(x\036\023\250\003z\003\244\306\344w\262z\\@\227\231\002\f\277Sy|\r\211N\2044`E\200\272\036\226G\271C\3738\002\331\207b\377p\001_b\256"
+	.string	":dP\341$\020y-\246+R\321\256\226\272\210\037U\\X\252\310\240U\006\275\030E$\330\321\004\024[\241j5v\324\262\223Rv\335_>hIm\267\013\334+@"
+	.ascii	"\r8\305\330\001\235\344\026&\\\232\250\277\233\027\035\037E\037"
+	.ascii	"\035\272\214\0045\241[oDh\357\214\220f\201#&_Y\177Xp\203~\033"
+	.ascii	"~\250H\271\223+\"\215sCc\261\377\323\320\227\007\276\3300\315"
+	.ascii	"\031\003F\023%=\321h\272<\323\231\251\366\322\351\334\246\016"
+	.ascii	"\365\312\326\207\240:\323\274\271e\341\267\f\337.\003\227\235"
+	.ascii	"\231i\033\321g\337\271\252\231\03236\245*\324\324>\324\337>\277"
+	.ascii	"$\264\032c\231\242\006"
+	.text
+	.section	.gnu.lto_servoMixer.104.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`0\036\235\205"
+	.string	"\032\340\2640G\020X\354f8\223\3171.\022C\031g\235\003\322\264\311H\213\253\232\315\250\003\220\002'\320\210\264\340X\247z\350\357\035\266\034\327\2762M\361N\351\317\341\315+\016\343\235c80\261QrP5\264\367^\"B\233$)e\361\002\272\002\031\003\333\003\355\345\221\366\036\200\366\032\200\366\026\220\366\022\200\366\016\200\366B\245\275Oh\357\016\264WG\332\233\003\355\305\201\366\3368{\005"
+	.string	"\366\006\200\366\002\220\366\332@{k\240\2754\322\336\031g\257\214\263\327)\355mJ{c\234\2750\316^\246\264w)\355}\021\354u\021\354m\201\366\2628{W"
+	.string	"{\225\320\336\244\242^\244\264\367\b\3555B{\203io\021\332\233\242\275h\332{\242\275@\264WE\332\373C{}io\017\355\345\245\275&\332\273;{\177\3666\260\227\331M\214Dy`h[\327(u\211V<f\032\031\356\303|\207\331\214\371\214\031\215y\t\3468\314n\230\227\254\242Y\311\300]\006r\235}\271\355\227r\370p\237\345\266=Q\234g\3155;Q\313{\026\030\305OH\301i\373\301\003_\236\355\265\261\341AS\003\347\200\333\022V\333_YY\035\240Q\0167\301tv\201\253\204\325\266hM\311\022^\333SY[v\303svo`\265\355\265\315\371Z\327\365\210e$8\tV\202\323X\316\002\343P9U\005W\342\033\017]\353*&\244"
+	.string	"\036*/A\345[\273zfdz\230"
+	.ascii	"\255\tZ\024\270u\025S\340L\350d\025\\\257\242h\365\360\261\371"
+	.ascii	"\206\341\250l&\364\255J\370\240\220\301R\200\217\315`3\022\257"
+	.ascii	"\314\351*\270^\221\301\352\272a\027\310\346.\213-\217\261\341"
+	.ascii	"6*/W\315W\225\345+;\233\033\300\307\246\323\356\307a\013\344"
+	.ascii	"5\f\246\262\322\211oU\202\0021b\340\326u\315\301\346\342\360"
+	.ascii	"\261\311xX\211\307&\023#\361\330Tw\243`1\344\312ga\214dS\254"
+	.ascii	"\353\n\365!d\004\203K\353\343\235\030\357o\247\362\f\031NM1`"
+	.ascii	"0\321Xz\341\242\005\213\025JIHGF\301\242\024=\201*j\374|=\236"
+	.ascii	"\271{\253\313a<\003\321!,)U<\003\016\2365-\343\r;\035"
+	.string	"\265!\233\200e[\202\270L9\202c\204ye)\033\206\236\254\2606\260fz\3034v\275'Q\306\260\236,\263\235\0179\2704.\373\241\227\274L1\202_\270\350\001)c\237\241\267\035\004q\231\242\206[|1\0132t\276z\2051)\210\313\2241\254$f\316\230NB\n\303G;\034Y\352\370\300z\262\300\354\224\362p\001\342:a\332\210\210/\035,Bj\351\264\007\204\313\024\"\030\315\"g\253O=Y\311\235\023\220\365d\001Q\026D\253`+#\270\306\256\327CV\037\326\223\205\304\316\207\240\267\037x\214exei\365O\206\227)X\330\307cl\212\231\023\304e\n\026\356]a^\261\315T\212q\347\264\256+P\312\223\336\251\220r\205\277S\2122\006+\225r\265\303\001\267\204!\016\343\206\"\205\330\335\003\262\256\3536\226\224)\2746x\267\307vwkwi\031.\376\242\305]\334<+\016:z\213\203"
+	.string	"\350\315H\267K\263\203\306\373\221\305\223\336\177\226uV\234\005\234\322W\234\215tj\230\376A\025\343[\327\253\036\333Z\215E%SF5c\206\307\246\322\371\314\217\362\251\255\264\017]E=\243\246Q\223\315Xj\222\307f\322{|\341\337\021,\213I\204\207\364\251\031\355\264\262\n\306\333U\303\036h\306Bz\352\004\026<W\257\332\243\033\375\350\273@\301\033\275\307\306\303\242!\320;\004\201\202\022<\332gO\\\321\216\364E\337\315\241O\337\2333.\332\217\035]\fr"
+	.string	"\262\237\240/\362\262'\251<\201?\321\330\f\026$\360\254\353\356\326\325\212\206\212\003\337\013T\364\"F\320U\213\306"
+	.ascii	"r]\327\036\275\006\201r\243\343:\n,\020\"\204\307\246\212\027"
+	.ascii	"\025\357\304)\217\340\310\031\261\373\335\367\337w\2018\216\021"
+	.ascii	"\311\255\032\217M\337\321\242\235do\007\357\275\357\346v\260"
+	.ascii	"\241B\274\243^\330\342\322\314\207\t\213\220\2145hw\363\273B"
+	.ascii	"E;V]\247\203\007-\232o]W\037\313p,(\203e\"\330\334\r:\350\340"
+	.ascii	"\250\025\266d\232\r;\253\231\377\270d\3470\366\351Y\376\271j"
+	.ascii	"\271\355\225\003\340\361\231\354\333F-\"C\301\200\232,\023\261"
+	.ascii	"\037\204\320\214\025\002\217M~\317K\235\244\226U\327\355\212"
+	.ascii	"\021"
+	.string	"\373\307]\366\201\224\213b\337e\027\330\313dci//y\311\313m\330\r/\213\235\275\254\004Ss\366\362\027\233\361r\032>\343e4\214\306\313g\316^.\"\251\227\315\360\022\274\354\305qx\271\f\337\341\3451I\275\f\346\354e$R/\037\271\017/s\031\365\362\226\263\227\265\240\275\274\225\3662\025\276\303\313Ev\303\313Ox\311\313Wi/\023\203\275l\025\354\345\252`/\257g\257z\366\016\317^'g/\016i\357\rg\257\rH\275\302\263\267\006\243\336&i/\r\301^\252`/\223`\357\222\264w\352\354Ur\366\316p\366J!\365&9{\243\322^\031\316\336\030\316^\030\316^$i\357\221\263\367\205\263\327\205\263\327\310\331\333B\332[\344\354e\341\354%r\366\256p\366\252\220\366\246p\366\242\220\366\016I{O8{M0\352-!\330KB\260w\204\263W\204\2637\204\263\027\004\244\336\017\202\275\036"
+	.string	"{;\b\366rp\366np\366jp\366fp\366b\200\324+\004\330{A\332k\001\260\267\202\264\227\202\263w\202\242\336 G\275\022\234\275\021\234\275\020\030\365>\220\366\002A{\035@{\033H{\177\240\275\f\240\275\013\244\275\n\240\275\t\240\275>\322^\004\320\016E)|\310\331k,\005\024n\0062\322M\021\372\244\f\371o\b\264dZz\302\243\b\233\316\303{\030:\021\303\220\215M\rk\020\034\016\023\372N\370/\315\312\353&\234\275\342\332V\251\205\214\210\366\037.\341\314ex\347XT"
+	.ascii	"\350\240\022m\344P\302\177kg$\234\323\214p\022D\370\b\267\342"
+	.ascii	"\020.\002\b\317\340!\234\307\247\350\365\301A\310\363\342\223"
+	.ascii	"_}\020\247\364\340\214\346\035\250\203sp\017\316g\336\301\271"
+	.ascii	"H\267\3019\270\013\262=\032|\203\267P+\252\311\340\030\\\203"
+	.ascii	"s\321\213x\346\031\234\307\307H'\344\030<\361\252!\037(\267\257"
+	.ascii	"*\361\tY'\344\300CH$/8\363.T\354\262\340\027\264\365\334\020"
+	.ascii	"\212\203\271\223\b\221\005g\265/\024\274\202\263\237\216\033"
+	.ascii	"B!\265fM\2265lgw8\250\247\030\006\352\246-\211\226hk\f\365\241"
+	.ascii	"\341\333P\320P\212a!\036\233\024\034\001?\\\346\023\234\265\246"
+	.ascii	"\2503\322\035jBT\007H\241\022\237\006y\335\\+K*\207q\rG\305\003"
+	.ascii	"\371\246\022\241\334\242\3402g9lc\315M\234\262\023\205a\031\317"
+	.ascii	"\236\302A\336Q,\377@\320\022|w87\254k\306\nr\247\b.\301\315B"
+	.ascii	"F:\b\036\301\231\002=p\b\316Df\244c+d\fU\001R\361\036\370\324"
+	.ascii	"\322\317U\313U\265\037\252\032\204\332M%6\371\350\323m\352\023"
+	.ascii	"\243\252\203\016<6\0378\227\361\215+n\222\312\227\255=\221\242"
+	.ascii	"\342\307\345\032\357\262=:>n\363\377\351\345\200\262hJ\226;\224"
+	.ascii	"\245\303\357G\276:\267\271\roo\305,B\336\356:1\324O\b\213\220"
+	.ascii	"yZ\217\n\205\0075J\2241\266\341\245\356\213\220U\327\375m"
+	.string	"\222\250\002\204\017\310\035\240\003\007\322\300\0350k\266:\r\304\375\240\243\202\201\377X\340\f\270i&\326\026\370\317\313\\R\001\265_\002W\300\307\023`\323q\322|\304!\240\204\257\307\021\370\325x\274\307\315\263N\342\214\307\177^\022%\0170\353\031\360\003\376B\005\334\200\363\316\212]\3047G\024\360_\237Cq\004\270\341\rp\002\3763\250\017\320E\354\261%\324\177V\016%\237\330\230;\376\364\263\351\370\216\233laJ\035\377\2411\024\227\226c\315\016\307s\374jE;7\016\300q\234\005\370\215\233g\001\\"
+	.string	"5\311"
+	.string	"\336\303\217\322*\r\032"
+	.ascii	"\376\363b(\231f\3435n\303\b\261u]qE\3435\336#+vyuu\031U\n\025"
+	.ascii	"\265J\025\036\2334\016\234\023E2m\306\030T\306g\374\205\372\310"
+	.ascii	"\335\205\233\213\233\013;\311h\272\323wdW:\214\360\007\022"
+	.string	"\214\312\305\303\355K\323\213\274\004J*c\364\020\034&D\221'\257\032\326 \030\217\361\317\031\320'\204\303\016i\016J\246`\372\256\n\204\272\325\214\005\343\273U\353U\273t\246\357\316\214tV\252\226\026B\370\303M\335\322ZT\256\036lnou\026\3658\204\372\345\013\217\315\245\027\241\001\024\247\354\275P\n{\344i\311\021&D\242\240\222HEEI\025y\261G\242\244\246&ha\212H\223)\251\t\244@\220\301H\222$D\216\024Ibb\344\205)\"LxQRS.\354\2160i\001I\023\025\200I\220D\275\006\"QG\302L\250fH\202\304\334\"OK\244h\2302\262\004\212\311\221\027\220\310\340\002T\022$D\242\240\212L-\201zZZ\251\031\214LA1\221\222\232\202\002\212Y\361\273\314\341\261:q\235\354\326\225\213\003\254d\016c#\2706p3~\334\036\035'\036\363\377\241\221\203\271Xl2`P"
+	.string	"!\343\307m\"\n\365\320\304\313\337\227\024vb\214\035J\361<\3466 \"~\315\204EH8Vg\"WYe!\216\235\253\206\347u\267\006Q\233\221\316\211\315\217\030B!dK\b?en\226\377\231\221\223d\013\273\342\326\364\343\326\231\312\271hg\235\210}\354K\336\372O\313\207$\337\214t\313\247\207\271e\f\256\363\2267\335ry6T\276\207]lH6,\033\276\031\276\331r^\363\363\305\214\231\030\214\037\267\216\245x\314\365\026AH\261\374\303\3073\327\273\317\016\315\276f\210v\035\202p\373c\204\232>|<\267\361\256\f\225\263\244\223\017\337jE58\334\206;9\217\255\350u\303q\370\022\372\322\334\360\037_\322\204\267\341\035\350\354g\206hC\300"
+	.ascii	"\351\331u2\350E\230\031\276\t\317x8G\031[\\\030&8\032\357\262"
+	.ascii	"@0/X\354\377S#\007\224'"
+	.string	"\257\341\0214y\r\357z\031\252\341\022\3038qxl69\013?Z\273\245'g\261s\021S\2545\225\027?\356\3411B\030H1\\\306\255\004\373\312\262\206\320\232]A\204\345\202E\237\351\254\210\341\374E\303\303\b\225\220`\250N\003\223/9\325\271\230\205\250<\223\237\315H7\365%H\241\357CL]\351\353\214<+\r\311\265\025\275\210-`\270\2227\242\254+#\213\037\267\211\025%\035\314s\370\002#\031#Z\322\0233\362P\224\320\231\341J\324H=\3523\234I\255\350\225\344Rj?\016\371p\"d\027\225\310\206\334\316\225\344\234\350\213R\206G\335\005\331\026!d8\337\371\222f\205\3461\2449\f\246\234\\\233q\305\217WJ\3572\\\3431\230\263\260\374\303j\300\234\247f\324*\342l\006\311u0\027q\336\\1\021q\316\016\233\370\226\nV\301\326\027\023\017\342@\360\034Vs\236\3037\210kI%\222"
+	.ascii	"\332\346\020\333\312\350rH\372qG\350s\364\237\020kl\270\274\031"
+	.ascii	"\0319\203\035\312\356\021,Z\f\366#7\332\344,\333\312\220\336"
+	.ascii	"\344\265\2629\372q_\250\303\255U\005\020\322\211'\\x\013\177"
+	.ascii	"\241\313\205/\235\0319\267p\356\222C\203*\023\264\305(\0010\256"
+	.ascii	"\245\235\253\226\013\026\271\025\241\rd\025\365E\222\n\251p\026"
+	.ascii	"\256~\273H\210\310W8\0137\311\212YJ8\221/\235\r\371\n\347\024"
+	.ascii	"\256\302\271+\256n\357D\321\323&\202[\250\342\b!\017\2224d\210"
+	.ascii	"hD\222$\3110\007\342\n\020\210#\201\236\305\362\006\022\240\204"
+	.ascii	"1\210\223\312\241\032\211R(\f\007\257\205\340\034w\310~4\270"
+	.ascii	"\312\252\005\035p\333\f\255m\003\215\313\231\224Q\214\361d\003"
+	.ascii	"\210]KO\216\240\004\032K\306\275:=\364H\002D\231\224\237\nH\354"
+	.ascii	"\306\3208\025;t\346\220\r\307\275g!\307\2767\216\207\261\005"
+	.ascii	"!`\005x\030!\356\311YKy\310\352A\364\307\372\236^\013D\377\242"
+	.ascii	"\206\307&6\214\320\226\330.\345\233 \236d\344\320\231\036\025"
+	.ascii	"\203\241'V\250\321z'\276\337\277\304\360l-\314\321\005\207~\016"
+	.ascii	"<\035\005\232\347?\250\323u\253\204\025\256L\026\244\030OLbJ"
+	.ascii	"\372!5\363\334mSaV0Y\032\323\312\322\023`=Z\225F>i\304D\350\271"
+	.ascii	"\364\270C\t\3755D\237qx\245\n\004\0379=\201\353\002\232\333\222"
+	.ascii	"%1\314\274F\036\331\341\303\2579\361!s\217\027\016\217\022*0"
+	.ascii	">4\226\243\301\332\352X\017\247\334\275\310\267\206\037\001\n"
+	.ascii	"L\212\346\314\3158\236\007AS\024\245\205_GL\212\240p\370\231"
+	.ascii	"\210}~Z\027}N\017\037' \003\212\301|\261\0233\243\344\233\356"
+	.ascii	"?\340\331\024 \203\024\235\346V\342\375\327\231\035\222H\332"
+	.ascii	"-7\226\336\270\fu2\346*\216\337\334\235o\2321\204(\273\274\016"
+	.ascii	"V}\345"
+	.string	"\254o\341\363\254@'\343\263\001=\205~L\343\261+\3436\302\202dm%IX\301:~\322[\307\013\001\336.\222\266@\211~:\270\224\n\353\032A\243\245\206\334\260\025{\251\221Z\320\355Wq\237i\007\300C\nU\002\200K\r;\022\310\367\032a\213\314\031\037\307\003c\227\336;\342\304\322\311]\204*H'\005\216P\321\206\224\263\352\177n\204\340\374\347\264\211\fQ.\313'\320\216\205\213\017\330\245u}\204y\0350\241F]m\001\311\336$]d\305\234\245K\020\340\337\032\200#\363hd\307\257\343\006\236\206l)\347 >\210\020\252\217.)\223:\362\001\250'\261G-Q\312:\220\373\275g6\332\370_\201m\221\240eA\270\354\345\021\245\367\314\353\217\341m\347\316R\032\013\367\367\322\214\221\214R\267j\223\2013\335\350\366\302\344\276\031>\204\342\236\247\210\006\262\373Y\243\302\325\003\002\362\270\367C\341\215\272\356"
+	.string	"d\212K\006\206e\360T\314~\004\346\005C^\212k~u\355K\216\241\307{\345\022$\\\327\fx4\324\257\373\323\323B\376\215\335\316\272\341\203\300`\r\357\227\202S ~\271\223\370"
+	.string	" p\265E+/\206\333V\034\"L\\\357\333i\275(\0379\372\203\327\323\337w\031v\360V\221"
+	.string	"\3646\244\207\226\226\334H\304K<3\036c\2450Is\312lC\360Y5\271J^`\030y\240\352\004*\001p\002\200\360(( \301\026\023a\352\222\207N\374\"\3559\361?\334Z\374\023a!v\274\367x\212\265"
+	.string	"\304\027\375BTRQ\203\210gK\276\303@\013\n>\272%\306\017\244\217\223\320?\346\363"
+	.ascii	"\306\271GM\272\335S\245\006f-\322\033\350\022\027!\350\345b#"
+	.ascii	"\207\004$\243\233\036n\r~x\241\204DQ\341\325\025\243\236\203"
+	.ascii	"\036\204\227&y\361\n\205~\314P"
+	.ascii	"\257\365ku0F\372jn\t\b\244@\347\344\245\371\321p\263I\013\036"
+	.ascii	"<0\206\3501\205J\233Xw\235q:\201\242\223\005ZZ\n\212Xr8\035\007"
+	.ascii	"\372\030J@+\023 2\3453,\341\2240\233V\2167\361k\264\366w!\032"
+	.ascii	"\rZ\004o\340N\026\224\276A\330u\343\020K\223\271\332\247d\230"
+	.ascii	"Z\254\0172\327\363\346\025\274\301e\323\020bY9w\257aTl\345\254"
+	.ascii	"z\271\224/W8fqO5\217\314\365\333\301\357 :Q\330\\RHf\210\247"
+	.ascii	"hC\211m\207=\223G\223\333I$i\237\r\036nL\226#\353q\362M\256\210"
+	.ascii	"\020\007\322\261\346C\364\301\305\341\017U\234\217\013j_\212"
+	.ascii	"\013\360\200\232\366qdg\246p\327\371\203@\322\376\327\260\352"
+	.ascii	"\252L\331:\203\324y(\241\263\027\245)\332\2662\347\274y3yV\327"
+	.ascii	"+r\2269\233\362\2479\341J?b\260<\344\n/\245\344p\255xM\023\037"
+	.ascii	"P.\247\216\311C\303\231\270HV\230\020\205D\270\026\t\226MsZ\331"
+	.ascii	"\243\246pj\304\351\332"
+	.text
+	.section	.gnu.lto_servoTable.105.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\030\021mN"
+	.string	":\207|\035L0\312\333\031\003K\201\273\366\317\312\327.\344x\224\366 `\023\211\016\321\235\340E\037\031|\t\307;\2317\277\256\007\331\345^U\032\362\312\246\272\206\005\360\323\022\r\343<\257\203\240\235\370\264%\247\343\367\314<\203\210\224\"\267\310\235RJ\001\267\001\250\001\313\001\254\363\204\326y\251u\226\320:G`\235\225V\347$\326\031\251u.\266\316G\255\263\021\353\\\264:\023\255\316C\2533\221u\026Z\235\203T\347\341\352\334\256\316\354\352\274\262\316\352\352,\\\235S\325\031\025:\007S\347O\235\035u\356\036\375LS\2221\315<^\363\005\013\f\341\255C\345\230\335\354~v\303\36537\267\006-g\244\3210\222\331\223\031\032\356\277\344\034w\033w\\\233\3513n\303\361\\\023W\363\025\023:\221d^"
+	.ascii	"\324F\233\272\2306\032l\243\264\321\267'\367\2300b\320\332*q"
+	.ascii	"\rt\006\374N6j\334`\272\311\035\206G\230p\373\013\222\246\254"
+	.ascii	"\346\0136\300\232\232\266\017\216t\033\257\032\2101S\266\275"
+	.ascii	"\357{\244mt\204\211#\375\005\211\372\246\t\315\340=\331\363\276"
+	.ascii	"M\247F\371\203\332\250\260e\227y\257\233f\257\220Y\246\353\371"
+	.ascii	"\301\373\276\306\277\302j\007\233\315H\356v\022R\361\310\250"
+	.ascii	"\210h\210(\0244l\331U\025\246h\360\335\345\276\220l\223\325I"
+	.ascii	"A\341\222\260;m\027\306\fJ\365\361=\351\270,\216da\002&\024t"
+	.ascii	"QK\037\241\311iq\243\242\326\242\240\211\204)\25009\353!,fN\214"
+	.ascii	"\342BA\312\036\226\221y[6\246-p\t\203\342l\021\236\331*L\361"
+	.ascii	"V\326G\205\311\223V\271\204%]\030,\326\251\242\247\355\302\234"
+	.ascii	"\004?(\3454\3510\355_b]\236\006\233\354\302\316\202M\357\373"
+	.ascii	"\266bGG\223\254A\212\215u\260\331\032\203\004z\266\360\314\210"
+	.string	"\215\365sm\245E,sYX1%\357\302\024\357\373\262#\305\2304+5s\2731\263\021f\242\233vt\236\302_\0066\222t\352\225\310\372\250\370\251\3679]\200\335\344\251\346\243\342\275\310\362\270\242Z\f\363S\367\005\340LSBpzI\361\365\236\025\334h\215v\223\205\013\224\033F\332\250\212\3570\215\301\213,O\371\305M\313\003'\2509\223\351/\231H\352_\2003\017\227\377\261\2227\365\214\224Y\200\032\336H\377fk*\261\367\203=\\l\232Sdy\2404\324\306\0328\355t\272\324\005\215\2349\307\016o$\017\351D\251\3536\335\224\345\201\212@\320\n\373_2s\036\357\t\357\274\211p\207\367\204z\336(\3355\007G\305\272\256\363F\210\330Vi\034n:\336\023\352\251m\225\306\351\rZ\016\357\t\367\202(;\362\005\203\223\366Jq\303\375\206\367\204x\311n\253\264QU\306\033B^\233Z\3171\363\036"
+	.ascii	"z\224d\357\233\325JG\276\036\032\355\357\n^'\016\310Dg\366\361"
+	.ascii	"\303\033\331\277\200_\323o\317\326g17\267\374\227\314-\325wd"
+	.ascii	"\362[a^\235\255Vg\036\254\363\016\326Y\007\353\234c\350\214c"
+	.ascii	"u&@\350|\243\341\232m\250\3165\372\331\\\265:\323\030:\317`\235"
+	.ascii	"e\254\3161Xg\030\254\363\213\325\271\205\320\231\305\352\274"
+	.ascii	"bu\246R\235Ut\263y\252\341\232Q4\\\263\024\353|bu\216b\235M\254"
+	.ascii	"\316%Xg\022\253\363\b\326Y\004\353\034\242u6\266\316P\2553\b"
+	.ascii	"\326\371iuvZ\235?\260\316\036V\347\016\2523\007\326yC\353\254"
+	.ascii	"\241u\316\320:c`\235/\254\316\026V\347&\326\231iu\256\240:S\b"
+	.ascii	"]\200i\356Re\026}\322\231\034\321\267\037\343\231\364\216\312"
+	.ascii	"\030CO\364Rv\210\037\364C\017BO\350\211[\216\346.=\320,\213\353"
+	.ascii	"\345\200\362\260\b\275\007\236\271\r?\350\231\002\231\371\004"
+	.ascii	"~e8|\307;s\033\321<\227\262\337>\323\363\210\301\372\302g\177"
+	.ascii	"\302\363\310e\313\003Y\375\365[\211Wq\227\355'\217\335.\247\342"
+	.ascii	"z\265\236Y\243\354R|\212\373\005\201\013\006\2266\252~\373\301"
+	.ascii	"\343\226\276\360\321@G>\350\247\237>\305\\\251\242\314\215\200"
+	.ascii	"\205\013\364\323=\3117\277`\236><C\215$\r~Sq\342\341\362\277"
+	.ascii	"1"
+	.string	"\177\202DeO\272\023W\002'.\024(\337l\315\241O\214\232\362\213\020\331\0248b\020\214\3571\355\342\255\254+\315P\306\277\370\257\326\353\177,g\036\021\316\266\033%ev\247\270U\274\221\377\235g\007\245\216\353\263\370\305s\223\b\320&\311\247\023OH\213\213\221\ts\260'\214\240\031/\203\223\360q\b\374\201\031UO5\254z\026\357\200N:.\377s/p\244{\261\bz\351\203f\255\375%;\332\237%\253\216U\255\017\235\232\343w\374W\237\256\252\361UO\236\362\2562\314 \374\350J\2365\276\307\354xf~\362-wI4\363,\327r\257\234\271Y\262\244\2156[{\362\271ug\206\017\253\245\003]\246\2132)N\300@:~\355\302f\315\r\251\353\314\334\212\343s|\037\351\264<\220\223\3005\b\234F\212\333\257\377\334-]\\/^\322Fq\374*7\365\004\274\2165\276.\3004\r\220S\375%\337"
+	.string	"t\312\341\362?\367\202\006\344\256\251\357\373Fq\377i\017\\6v\277\270`\274\221.\230\264\321\033\337n\360\024\005\f\004\212\b\220\"=\204\030\207\\\t\021r\345C\002\003\t\322B\256\260\250\f\300\352a\004\353\212\352\252*\201\037C\206\364"
+	.string	"\342\343\210}@\021\271b"
+	.string	"\353\007\021c\021 \b\004I\340"
+	.ascii	"\343\220 =\204\030}`\0211B-\361\225\002?\260\214E\256\256\260"
+	.ascii	"\214mS\253\337\n[\267\003vp\352\264~\213\223~\311\035\327\034"
+	.ascii	"\342\024m<\007\211P\274\324\177I9\363\001,S\372\334uw\360}\337"
+	.ascii	"\027\351\227l\343\316\221\325*\305M\223\217iT\342y\374\227\324"
+	.ascii	"\333xb\025d\232\023_\307]\022\353x\374\211 \233\344\334\026\336"
+	.ascii	"\033`\361\227\037\365V\317~\364\263\345hiT\306\216~\311Q_\342"
+	.ascii	"[\256=9\246\007J\007wt&>\212\316]\252sL\274\006<r$\276D\222@"
+	.ascii	"\337\300e\006\325Q\023\007\016\211?q&\342G\274\333\311r7.\263"
+	.ascii	"\215\266<\315\3220\273K\274\315\334\n\026\361\035\327T\026$\347"
+	.ascii	"\326\334\376m\211\237\032\243\020k\344\214\037\002\352A\274\261"
+	.ascii	"\305C==\b5i\236\234\276\305W\230\373\360\035\336\351\227\346"
+	.ascii	"x\370\017q\356\262\367\340\\\257\276s\306\303\367\036\207\357"
+	.ascii	"\360\250^\0312\034>}\223\214\363s\3330\346\251\3417dx\f\257a"
+	.ascii	"\305g\270\360\030\234\031\\\260\360+\276\202^\323Wx\013\277\244"
+	.ascii	"\307\364MMw\331|`\\\257\306sc\372\346;s\243\360\025\036\375\323"
+	.ascii	"\306FAN2n\335\302\274+*rjG\235\332\207\234\272\343\272\301\216"
+	.ascii	"cJ!\247F\361_\334D\023~Mm\351'H\370\b\277\364}T\322x\t\217\316"
+	.ascii	")}\004\013\274(%}\3734\236\311\316Q\351Vz\350\223\276\355\356"
+	.ascii	"\274\336\216\030 }\027w\231\304\005\311\247\370HGo\364\305\357"
+	.ascii	"c\332\037=:\247\350\215\276\003\201D\250q,$\221b\250fDD\222$"
+	.ascii	"\311\260\006\241\005\304\030\346 4\017\022`\2045\0133\350\030"
+	.ascii	"\211\002\261[\330;\377\213\343\255R\305\247\377s\224\374\301"
+	.ascii	"\304\005\365F_,\306\267\352\206\3214j\177!\217AU>\223\277}`\216"
+	.ascii	"\302\334i\223M'\201D\311\356\301\003[\222m\345#\r\271\312@\223"
+	.ascii	"\034\236"
+	.string	"+a\225\216\3235>\f\273F\211Pn\2768\322\333E\251\3227\177#@\020\355\017\231\305\334D\377`A\200B\222c^\257v\021a9x\273\244\260\203\241o\204R4\343\302:\f\373\203\271D\177\210:{\230\037\226j\205\352\0073\352\214\331<\f\262l\311\036\306\017\341\376\027\002o\353Q\307\274\327\313\246\320\244\337\247\020g\327\221]\222:\n\"\335p\035\335\262oY\275\241:'S\261\216]\251\351\324\365\372\021\213\022\002\366\372\304\331\027\351\212D\232\245s\350]\206e\200\261\031I\223\254\303\360\241\372\201 \372\365\244\032\fa"
+	.string	"d~PG\261\223\365\376\346\336(27\331-\037\211{\001\177(qf\211\301\231h\350\346\261\330\251'O\204 \372F\261\241\376\321\031x\233\260,\365\240M\256E\342\365\225\004\331\346\334k)\3401\256\030\364\241p6\365\225(\026\005\216\214\327\376\361\006~\261\"?\332\341h\350=\3316\\\322R\264S\305;\004\021\020K\321\354\267Y\353H\216\273\316\205\353\313\235h4\021\025\323\375\026\306\\\373\365\362Lp\264\017\337Mu\030\200A\021\337|$7\206\224b\231\220\022\203\354\270\313\304\244\330\277\322"
+	.ascii	"\231\342;9\211M\234PM\344\237\035\305\303\306N\334\347\353\233"
+	.ascii	"}6\264\"\261\376W\335L\362.y~T\273\261B.\245]\337\261\251n\r"
+	.ascii	"\007\006 \341Q \246\212\013\361\371\211'\223\253\341\022\264"
+	.ascii	"\257[\032\227b\031E\340\272\336\220|\3510\231\377z5\025\364\245"
+	.ascii	",\375\304\264P-\330\275\254\222\2364\26711\013\251h\321^\217"
+	.ascii	"\230+\026D\343\340sZ(h\002\"\260\277\353l\210\002\2773\201\344"
+	.ascii	"^\204o\314\020\006vx>\005\021U\301\215\244\255o)\313\210&\361"
+	.ascii	"t\3009\022`\031\271\0355\330\227\255\260\025\277P\357\340\025"
+	.ascii	"\331ng\236\343u\201\034\200\177T\253v)\241\314\037\232\347\222"
+	.ascii	"l\326\025\222?"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.106.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 \374\345\006"
+	.string	"\"\r05Pm\222\016$\243\252\214\032\205\344\341\002"
+	.string	"\331\257E\200O\253\321n\305\347\266\265\235\021;\273\342\006\3620;nf\221  \372\222\005!\026\n\216>lk\233\310\024c.\026UQe,\270\201x\320D8\300\tM\203\004\304T\026\274\020LQd*\270\241\250\nZ\266\330\fe\026x\022\033\241\315\314~8\254!\025\331\344\212\266\230{\315:\335\271J\247f@\206\347u\277u^n|\245\230\241\377\235\357]I`$\322\232u1\202\272\224x2\225x\374\234\267\234\240\300\371\352\326\001\032\370\030}FPb\334`r\364\352\273nA\312\200]\220dZ\247\017`!\306\370\3134\214\236\375\r\376\203_#\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.108.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"m\013"
+	.string	"\326\225PA Q\224\016L\036`u\002\364\004\205\002\230\261SbAY\rX\260\342\034\030\r\0170R=\363\253\366\033S\315\275m\300 \224\277\215FC"
+	.string	"\034\222\240\241\313\236mP\324tP\326\362\244\221M\244L);"
+	.string	"<"
+	.string	"?"
+	.string	"\236=\343\341j\005|\204hXacw5%\341\245\367K\323\363'\031\312\007\206~e\037\256\341\363\004\222.\313\356\036\344i\002G\231\223\314\356:?\020u\307\333V`\333\200\375\002\001-k\312>\353\326\247s\322q\302\003\274\251\306\256\207\222\034\333\212-J\234u\373(\374\360!\027\361\316\262\213/j\317a\365\301\202\306\356^\036M {\264<"
+	.string	"\366x\035"
+	.string	"\366\370\212\003io\026\362\237UCG@R2\241\252\262\007Km0\"\203\2248lwW\341\311vI\007\374\024\037\271\340{<:\003(\377=\372 \3541uA\210\0277DDYb\207\243T\025\t\214\016\001\030\034$\330>\334\246\313\254\301t\333\207\333tZ'\002\004\216\204\007\032\005\016\203\t\232\206\3534\314"
+	.string	"o\0256\234\326\3316N\253\204\242k\n\344\337\020cDK\244\243KU~\370\203(\2118\345\345\252&\233\022\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.109.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`\345\003\235\033"
+	.string	"6\363\262I\240\230Q:\220\350\\\253\317\2301\341\304\213\351\3143\316z\362\341\236(X\022\026\361\313w\201i\"\335\357\266h\375WXkN\371s\201>\301\307\365\340\025\336\370\307p>\244*OA\354\240\020\270a[m4B\310\336R&\031\231"
+	.string	"\221"
+	.string	"\246"
+	.string	"\260\335C\355\205\013;}\324\245r\237Z%\257-\352S09]u\251\265\0328\335\002\345i\316m\306\323\371\331x\332\260\315\355r\t@Tu\b\234\212\364\206aj\255\264\256\261\345\247\360;r\356\344Hg\227\234\333\223\013^\276\237\356\344$\221XT\221\375zsg\213\030\343\302!\036\235\222Ng~/>g\001\245+\027\262\037o\332H\241\241\345\303\263\321\217\210\273Lz)<#\375z3\247\326\372\247\023\310\301\002\310L.\250\265.\373~-\276\257\357n\215\335\005\332m!\001\335\301\375w\266\212p\224\275\264>\343\273\003\025\026\036w\355n\317\205\370\224\265\362\022\354\253\036\004h\337t\272 l|\337\351\3366\236\2765"
+	.string	"\267pI\355\270\270+\034\342\016nM9\302\332^\332\275)ykJ\336\331\247\276\262\311KS\362\306J^\330\344\235)y_\223\267\234\274$\311;R^:\362N\312\333\223\227\233\367"
+	.string	"bOM\277\037\025k]Q\034S\261\250\325\215O\375\273\337\377\370\320\304{\354"
+	.string	"+\265\3265\261\n\230N\274\307\216W@bZ`\210\311\212\302\343\256%;\326\357\225\231i\030\217G\311E}\266E\005\345j\246o\344J\331\257n2Ow\222\213:\216\023\2201JP\367\321$7E\273VP\311\002\265\344L\0304p\300\367A\030O\313&u"
+	.ascii	"\211\\Rc\223\335[zep\230\366\256\204\t\343}c\347\360Z\267\001"
+	.ascii	"\270{\366.\205\n|\037\355\034\242\326\355>\t\356>+\013\007\302"
+	.ascii	"t\344H.`\310\220\241\357K\342\356n2E]v\\\354\360\"\033\312Z\353"
+	.ascii	"\316~\310\211p\340\251\325\306S\356\013\377 \f\220\013\227\325"
+	.string	"\216\213\335UH\\H\002\373\243\203\373\021\342\261\321D\334l\266[M\300\376\224\360\020\241\334\232\016\356F\"\250\007G\023\372\361\001\n\361\201&\002\210\307F\253\005\341h:8{\033\321\023D\023\272\335\202h0\341\356\275\364\364\243\310z\202\265\353!\262\203K\203\205\3364\265Q\032\270\254\215V\311(\353&G;t_\262>k\255u\354\340^\2502g\375\341_2\226\b\265\210\r\353\2326\332=pY\3374\016\225\n\255\"%\232^)\033l\230\260\356\363R\3234\263\013H\244\322\252\242\257\216\365\254\227\213\300\fqq\271\t\307\214\244\331\301\2155\254?<\003_\004G\250Q\034&\2312\004)\"\024\210\310\214\226\354`\002)S\270\036\021\320\255E\264I\261\264go\277Hm\032\\\234\200\262\315\021\342\024\025\254\345U\221'\374X\265G\314)\321\307\332\323V\032\346\261*e,\324Em\005\260\265X\303\244Z"
+	.ascii	"\371\304\002\207V\t\325\253\262\034\301\222\241\217\317\374\226"
+	.ascii	"\231\265\2518\344M\231\347\261\240\006\364\177\305\224s\260\307"
+	.ascii	"\025\036r\310\237\r;\351Y\254\315\243\346C\262\201\2058\b]\362"
+	.ascii	"j\301G\213\343.\314\036\243\351\231\027`\001\230\265\001\236"
+	.ascii	"\234\366\037\306\223\211>\026<:\276\036\376"
+	.text
+	.section	.gnu.lto__reset_template_81.1.112.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.193.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`=\002\315\022"
+	.string	"\026${G\320\362&\035P\203\376\211\341C\307\256m\345\334@\204_sD\032\b\035\024aOi\352;\020\341b\034),3^c#\240&\345N\212\203B\352$\372\222G\240\037\256l<\3578\214\335j8\210\337\251f\311\336R\246\024c"
+	.string	"i"
+	.string	"h"
+	.string	"\217%\027\320=\302\213t\217\256y\220\r\330l\254\322\307\275\354\325\352\361*l\277h\206\331:\376\335v\344\007\207a\bjw\275G%a\325\341wk\302\0165#\314?\356"
+	.string	"f5\233C\230\322\241-\205\324b\020\345i\007\210\017=sj7\251 ?\035\236\"\217\251\004\273k\225\207\273\273m\026\333\013\354\204\005\251t\204]Zc:a\372 i;"
+	.string	"\264\313!\352\307\216\210G'.\364\244\275x\231\006\256\355\273\355<\227\303\004\004\265\261\317\304EwQc\232\221\357\266\223\252q3J\202\332\375\274G\177*\265\357\232\267\360y\330\224|\241\007\371C\271\227Kb\337\326h\307\371\271\357+`ga\244\357\316^\303\355\247\310iwM\036M@\0253\227\310\324\306>\r\013!L3\3333Orp\302\264\273(3\216\364"
+	.ascii	"BJJ\367\030\365\263\017\251\252\317!s\262\312\217VT\2731\004"
+	.ascii	"\276\214\033\265\370>\217va\261\272\307\324\023\225\b\362a<\206"
+	.ascii	"\004\337\3070\255\374\354\321ou\217\327\017\035\246\260)\365"
+	.ascii	"\260\335d\224\365J\244\323\303(\265\307\032Q\236d(\254<v\027"
+	.ascii	"~\271\300\242@\345\225\223\230\326\214\253%\306\223yqaM\210\340"
+	.ascii	"Q`\251\300x+\256\030\357\204\304\255\n-.O\246\325ry+\333y\345"
+	.ascii	"\261\375g\300\021\342\306\215\342X\241\3668\232\210&\017\320"
+	.ascii	"\224\235B\315\261m\325\215\324A\315\245\\S,}X\017wwU{l\0278\324"
+	.ascii	"NIr\033\210d\"p2\312\003\362\252\312\240A>. P\002aL-6h;\332I"
+	.ascii	"i;\270.6\017\210\355\270j\357\202\"\253L\213\300\230\233\247"
+	.ascii	"g\234X\033\004\357\222\260\300\302\332In\357\001+\253't\0340"
+	.ascii	"\"$.\3371\020\332\240\t\267\345\3138\266\261`\263\323,\271\313"
+	.ascii	"\272\301Z\372 !\234\037\f\262S\330#]e\364[\257\020\210\206\343"
+	.ascii	"\306\273>l\256\211~\327\034\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`/\006\205\032"
+	.string	"\326\347\223I\200XN:\373\206\236\262\3573]F\f\220\3134\240\307\020\361\274\274\313i\306\214)\367\031\214\315]\264F[Hd0\364\240_L\203w\263\301\363<\317\363\364\333\233*I\251\336E\016\262_\036\355Q\274\343\207k\220\304H\"S}"
+	.string	"\204"
+	.string	"~"
+	.string	"\025\356\323(\\\211\266z\363\262\t'\013;\256I\270G;#\334O\201\3608T\315\352f\263\331|p/\345\374a\034\250\272\256,\226\203\313[\247\317\277\320\006w{\334RG\032\203\373,g\317\267\024 2\024\0171\210\035\334\316\275\332\360L\364P:\037C\377\363\324uU\261"
+	.ascii	"\250\252\252\346\334\257\235\3753\253\332\034\016\305\271?r\256"
+	.ascii	"ZY\377\375\303\220\214\023w\274Zp\317u\376\217I\020\367ZXU\325"
+	.ascii	"\237\300\321\375\033\277\350q\361\255\026o\215\356Ut#,\016\206"
+	.ascii	"\026\237\004\375\233\214KJEE\"#P1I\301\231\215Zq1\242\237\r\335"
+	.ascii	"\211\320\237\004"
+	.string	"}\211\2123Iq(@7CQ\274\311\211{,&\356\257\224\270\035\211{\266\363P#\216\304J\304}\333\031\202o\200\340\343\207\207\361\300l\007\266\201r\340\365m\303\275\225\232\035\\H\r\367\313\f\357\202\341\236\312\205G\261p%,\307&F\025\312`\367\226?`\367\332-`\367X.\240o\211\326\305I%\260o\256\005l\232\225\211Stg\276_\313\260\274$\267C\374\261\254\255\266k\375\372\247\307\327\234$\31643wz\315-O\257yL\356/\263\250\036C^\307\f\273Y\207\233\307r\177I\325\221\345\274k\334\3279\335\177\241q9\252\351\036\314\214\3739\031\367^\230\356\351b\334sY\272\227S\272\234\303x\337\204qYM\272\277C\n\347\225q\342\216W3\007\232\207\254\274\264YH\222\253Z\276\032\217\271*\303\264\237\226l@\252\312\255\323~rj\323fJ\376\030\246md\217Z\243\242PPM;"
+	.string	"A\031\034\3250\355"
+	.ascii	"I\031fo\230\306H!\327\376\225\366P\332>\275\264m\204i\373X\016"
+	.ascii	"\022Q\002y+l\236R\330\314\025\024\372\356V\344\275\204}s-a#\265"
+	.ascii	"\314>\254\346\246\336\006\373\307\024\320\276+\3304I\366\201"
+	.ascii	"\331\025y\200\203\250\201\020\204=4\"\243\240 I:\300\002))2\035"
+	.ascii	"\021\260$I\241\032\031\311\310HA\007Z#\363\323\322,1\b\177\305"
+	.ascii	"*\326\347b\016\302P\373i\263zXs=WP\3116\017\267\266\337\372Y"
+	.ascii	"\r\313\337\315\265\354\267\223\310\227\323\224Z\r\262`\244\200"
+	.ascii	"N`\360\232\205+\210\013+\025\020B~\001H\342Y\205\263\220B(dG"
+	.ascii	"\320S\272\032\2744\306\200_{W}\245\256\256S\325W\352\202\376"
+	.ascii	"\241\253U>\277\356\214^\322\b.\346YRUB5\026]q$#\211\211R\306"
+	.ascii	"&\r\372X\221\006\351\035q4\240{RW]\233Q\202\302\341GX+\005\233"
+	.ascii	"\340\276\\\\^\303A\225\020\351\f\365C\205'6\201\313A\361\327"
+	.ascii	"\253MU\n\350\205\037\336\021\202\310\360\2706\020\006q\352\245"
+	.ascii	"\262\216\0343\206\323\214\260z\013\227\334\262\343\307e\260\365"
+	.ascii	"\261\224e\227\310\223D\367\304\027\277_\\\001V\001"
+	.text
+	.section	.gnu.lto_.refs.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`N\002]\021"
+	.string	"f&nC\360\262$\351\300\223\262\261\344\364\313\263\220\246;\263\300\275\351\337\214\275\033\320\330\320H\324s\340\031x\006\236\201g\204\347\024\030\313\373{\377\337\273\375Zom\351\357>kn\332\326\332D[b\233%\273m\231\002P"
+	.string	"\\"
+	.string	"]"
+	.string	"\337\256\236\331\267d"
+	.string	"\326\240\253\177\256o\330\267R\257\260\307\022\336\253$\326}\223z\350=\310}\033=\276G\362\f\301\321\372\212,\252&\311\036\362\336\275o!x\225\241\317\226\373\n\364\265\376T\217\264.j\037\312\267Zo\3551\257>'b\373\025\2049,P\340\270_\204\373\033\367\f\334\317\200^\306=\214\200gA\275\n\352Q@\177\342\036;=\351\364\242\323\207Lo\231>M\337\224Qb\036e/\302\272\313zb\275\302:b=\261~\331]I\317\222\216&\007\310\030D\2000\370\202.\330\202\007\220\0053\320\244\353EJ=\224\275\225\005&\362'\201z\377 {\203\374\232\3542\371/\250oy\277\362>\245\362\247\354)/\033=\366\276\224\235\344\375\310\275h\364\200\323\305\t\001\302}?\214\276\036:p\330p}5d\310^\f\027J_\013\251o\205\367\245\220\352\235"
+	.string	"$\365\377H\365}\364\320\201\243\347\3757l\320(\3752\262\037\2176haM\265"
+	.ascii	"1\244\301\242\002|8S\311\240\n&@\003]\351\225\020\241\375Ax\354"
+	.ascii	"\310\321s\243\006\317\216\316\214\0309/Z\250Hq\242\225h\375\021"
+	.ascii	"\355oZw\320\336\246u\232vK\353,\355U\362Q\255\233\332\237\344"
+	.ascii	"\233\264\236\265\307\362\257\326I\355E\362E\331C\005&\340\362"
+	.ascii	"=<;O\007\206\013\324\2129 \360\242\251\321m\374R`L\031\372MQ"
+	.ascii	"eq\202\r\021G\260!\343\004\033\"\216`C\306\t6\204q\245\002\021"
+	.ascii	"\217@\230J\341\033\217\302\t\0076v\260\3363c\354&\016\206v,\260"
+	.ascii	"\261{\306\f\361\230\323\306\376\345\230\366\266\241\220\301\004"
+	.ascii	"b6!\354q\rG\t\023\245\231\004k\341\2025\204\307\0355\256p\202"
+	.ascii	"EH\005\021\006\365)\020\305\345\367"
+	.text
+	.section	.gnu.lto_.decls.b24b816d59b45958,"e",@progbits
+	.string	"(\265/\375`cZ\255w\001:q\342\207U \fQ*\351<\364\374\207\363\b\310\334\242a\377q\350\270\230\361\035\317\013zN\241c\004i8e?\b\030\030\327\350\351R\226\264\302\212,\225\205\003Z\355\370\231\035\233l\236;\244\243\303\347g67\330\263O\213\241\270x\313\207i\200\350\210\310\304\335\b\331[\356\024O\007j\b\237\bQ\352\232\332Py_\371\273J[\371[sm"
+	.string	""
+	.ascii	"\017'\261\276WY\201\316\257\325\237\263\247\b\275w\252\214\244"
+	.ascii	"5\351\353\323r9?\344\314\244\372\276\243\376\032\270bM\262\326"
+	.ascii	"iiI\006\272(S\353\262\300H\261P3\325\302\257\251M2\260*/\031"
+	.ascii	"\230\003\315jd\251uXa\2229+\275\336\364`\264\214J\207\345\200"
+	.ascii	"\"b\332\351\211M\rT\361G\243\272\355\2309smI\306\331\230\323"
+	.ascii	"k\247_(\254I\262\2114\222nk\267f\322CZ\255\2454\\\2775\224\006"
+	.ascii	"\322Oz\254\327\272I\307u\220N\353(\355\244\311z\331e}\326J\232"
+	.ascii	"\255\217\264\221.\322\312^\322f-\244\223\324e\243\265\217\367"
+	.ascii	"\217N\376\326\335\250jV\232\351\027\002\253V\234\324\272\256"
+	.ascii	"*\311Fk\036\335\243\322a\231P\246$\001\215V\327\3246\366\214"
+	.ascii	"\n3Y\022\225b\007\233\022\034U\315\255\262q]\371\372\205r<a\242"
+	.ascii	"\243Zik\251-,5M\365\253j;L=\331\311nE2\005\024`5\373\205\304"
+	.ascii	"\034P\266\306\344\257u\215\3263\252[\245\003\223\200\331\227"
+	.ascii	"~AU\325vl\316[d\2229+\017\302_\003\177\021 4Z[U\265J\207\225"
+	.ascii	"m\2362PJ\221\234\225\036\202<\354\344\205\341;c\302\265\312\n"
+	.ascii	"t\216\250?\347\203x\270{\250\005\203\004\272\340\353\373 \027"
+	.ascii	"\374\340\033~\020\t~\020\b~\260\n\377\364\303?\275\340\177\251"
+	.ascii	"@\347\317&\370'\022\374\023\b\376\231\003\377\344\302?e\340\237"
+	.ascii	".\360\315?|\263\016\337\234\202o6\3017\313\360M\034\270c\364"
+	.ascii	"\013u\031\324WuN.\264\372\336\254\201W\220k\320\371\300\032t"
+	.ascii	"\336\254\302\277\201\370\267\016\377\242\341\240\nt\376~\341"
+	.ascii	"\337"
+	.string	"\026\270\203\036\366\300\r\217\020\202os\340\257]\341\303U\240\363V\005~\225\nt\276\323\340\r\352\317Y\377*`]v\250l^\325\324\270\337<)\3632g%\317\215\02735\326\372\276\311\340\327\016'O````\355p\276\243\340[\177\316w\031\366\240\242\371\202g\\\375-\351\353\240\243\306\213S\2213f*\227@+'m\346\225\257r\345\334\226s\336\300\323\307\264\346\245o-S\365\352\222C\335\313<\225\017\314\251\252\357\033\bVA\316\225\303Y\003\003+\207\363\257d8\004\311\342l\344\310\323\200Gy\325\002G\337\277\216\021s\202\236\262I\33708Lg_U\372\276q\340W%\312\252f\225\311 \023\2576\177\275\253`*^\365R\227\365K\345\362ZW\355\230|\251M\330$\340\027z\375R\341*\235U\302Y`\t\240^\022\021 \324/\265KU\333aR\346\027A\257@\253d\220\007\017\036v\302"
+	.string	"\305\2460\334\3270\270\346\nt\366`\301[\202j\237\330X\233\276\257N\360\023\020\005\253X\262B/g\345k\334/\204\245\312\325+V\231\274Q\341\305B/\347\374\277f\251sUK]V,U\312\353[e\362V\346\374\224s~e\373\205^\261T(\325\315*\341\362\223\023\227\001\240\345I\261\361\313Y\351\301C\220\007\223\252\306\235\026|\377J\345\365J\265\302B\336\200\261\236\246\256\372V\271WY\276|\364}\275\302u\212\320+\225\237\223\nK\231\327r\316<"
+	.string	"x\"\027\3277X\177\316\327\027\370*\300G\302g\001oP\201\316\207"
+	.string	"\347\324\237\263:\251mu\331A}\362\272V\331n6)\2632g%O\213\261a[\322\367%\360k\007\247\r\f\254\035\234\227"
+	.ascii	"\356\251@g\327\237\363t\025\350\254g\025\255.5\250i\027\001\302"
+	.ascii	"-\023Z6\313Y\311\243\323\306H\233\277\276\037\201_\227|C]\006"
+	.ascii	"\341\032\360\253\006g\r\254\032\234o|\275\nt\336\257\002\235"
+	.ascii	"\177E\362\327#\325\254\003\0335\305\225\327rV\372\340\247(N\314"
+	.ascii	"\372^Y\201N\\\177\316\337\036y\211"
+	.string	"\352\f\030\300\336\375\326.\205\251S\215\352\211\237\377%j\311\362\333\023X\376\306\300\337(\370;\005\277\235\003\301\337\0310\3009\370\357\336\337(\254Yw\340\0068\206\337\304\371[k\311\375M\025\2353\004\200\277C\200\243W\370\036\n\263c\340A\337p\021~S\251n\325\241\337\002\031\273\240\0229\361W\364\267B,\213+\177%\333\360\367\220\234\337\302\260\3627\317\337\032\376\336\371[\004\266\312_\027\360w\007*\233\277\357\337\346\337@\302T1\365\370\277\203.A\345\257\031\003\006\230\262R\322\366\252\336Y\370M\017\374ml#\353\326\004\370\303\262)@a\315:h\001\324l\307\322\376\301o\246\340?\033\373\244\203\2406\342\215\362\333\r0I\341o\016X\265\377]JP\263\025K;\320\177\267T#I\013\236v\206\366\fl\332\216\025\376\246a\231\032MI\223\300\252\370\233D\222J\207\343\357/\213\244\346\377*\244="
+	.ascii	"\277I\201\277QX\263\252\224\263bm\303\036\371\255\n\312\336A"
+	.ascii	"-\263'\370\257\302\001\360\233\n\260@:\313\242\370\353YE3\362"
+	.ascii	"?\355\317\026y\206\337\374P\213\376&\321\301Ux\316ov\360W\243"
+	.ascii	"\337\nQ\252[\037\260A\376j\342\267@\376\356\340o&\255c`\203\035"
+	.ascii	"\373\255XO]\360\233\034\376\266aw\3300+\026\314\352\2609\354"
+	.ascii	"\327_\337\376\352\366\367\326\177~S\204\277\343\276\376\346\222"
+	.ascii	"\3667^\334\337ql\177;\311\372\233IU\220\277\253\374\225\354\257"
+	.ascii	"B\376:\344\257D\376:\366\327\344_\203\374\325\210If\206#\001"
+	.ascii	"\277\365\252$\250\361\377\003\277\371/\332\244eiT \253\242\355"
+	.ascii	"|\347?A\360\277\312\177,\377\255\374\366\001\177\033`\306\377"
+	.ascii	".\377\275\374\377\362+\377\263\334\375\337\362\016\376gp1\267"
+	.ascii	"\340\277N~\233\341\267\026\374\026\350\267?\277\345\371\255\317"
+	.ascii	"o5\3746\310.\240\001\177\233\363[\235\277\321\337f\375\357\371"
+	.ascii	"O\343o\261~{\365\333\030\277\235\372m\324o\235~\313\364\333\025"
+	.ascii	"\374v\351\267H\277-\372\255\360\267\034\370-\211\337B\340\267"
+	.ascii	"\013\370\255\002~\033\342\267\b\370m\001~K\200\337b\360[\016"
+	.ascii	"\177\177\371\273\313\337u\177\317\375m\345o(\177\267\375\275"
+	.ascii	"\366w\212\277\227\374\255\374;\311\337f\177\227\375]\344\357"
+	.ascii	"!\177\013\371\033\310\337\311\277}\374\315\343\357\035\177\347"
+	.ascii	"\370\273\353o\256\277\265\376\246\361w\326\3372\376~\341o\030"
+	.ascii	"\177\273\370{\352\357\250\277\241\376n\372;\005\177/\375\255"
+	.ascii	"\3647\362\357\022\374m\374\033\351o\022\374M\374[\304\337\350"
+	.ascii	"\337\"\370;\004\177_\360W\345_\215\374\375\201\277\216\340\357"
+	.ascii	"\016\374\307\300_=\3607\007\376\263\371\277\367\237\357\377\223"
+	.ascii	"\377a\376^\341o\022\177k\340\357\f\374\375\301\337\035\3766\300"
+	.ascii	"\177\025\376&\300\377\264\2777\370\033\203\2779\374\035\3647"
+	.ascii	"\320\337\347_\367\376*\346\257x\177\365\362W\271\277J\371k\224"
+	.ascii	"\377%\376\212\366\327#\177-\373\353\216\277\222\340\257\037\370"
+	.ascii	"\217\302_U\370\337\367\377\314\1773\377\363\376\217\371/\346"
+	.ascii	"\277\331\377\024\374\237\373\277A```\340\257\343\200\177\207"
+	.ascii	"\313\037\201\020\002G\240(e\364\330\321\321\335\273\236\3544"
+	.ascii	"\206\215\036\017\326]X\226.\277"
+	.ascii	"w7wkJ$v\377on\232\314`\325\260\273u5d0\261\205\311,\302\306\256"
+	.ascii	"\\.\225\313\217\030?\336\372\276\347\t\276Z8`xs\202U\325\367"
+	.ascii	"=d\030\313R\314\215,}\337\003\206\357\225\027Z\222Z}\337#\003"
+	.ascii	"+q\340\266\330b\364\275Tx\246\314\350\353\322\367=SX\312\225"
+	.ascii	"\273\341\232\261\244\251\357{\236\244(5`\221\271\210\253\313"
+	.ascii	"\033g\321n\242r\266\372\300HU\232-\277LE\365\341<|\370\277p\367"
+	.ascii	"\315\355\314\224\262\276n;J\252-h\372\236\307\316,O\257\316\b"
+	.ascii	"\231&\227\311M\273l\267\355.\357\332}r\227\\\265\272\274N\256"
+	.ascii	"\222_\345=C+cV$\t\031\241#y\311@\"Z\310\350%!\222\247GV\223S"
+	.ascii	"\310\350\225\375m\347&\347*G\340\234\\$\177\333yRf\036\301\274"
+	.ascii	"\2706[~<O\310t<Yp\317\243\304\255\254@g\207\372s\236g\f\237\307"
+	.ascii	"\007>\217\030>\017\030>\317\027>O\027>\217\r|\036-|\236,|\236"
+	.ascii	"+\374j\244\336\035\277A\256\220\026S3\024\025\t\2730\275L\025"
+	.ascii	"\343\303y\234\360\257\330\345\361\333\343=.\020\234sfR\346\027"
+	.ascii	"AA\270\244\331\362\313XX\035\202RI\262j\334\261_ d\352\262^X"
+	.ascii	"\271\311\035\253\255\026z7y\177\220\221kJ\023\006\257`\263Q\325"
+	.ascii	"\367\372h.;e?~\244\350\373\2358\374\277\276\37737Q\345\234\255"
+	.ascii	"Le\246r\3129\377\372j\326\332\341\327\251\266\016\340\377\265"
+	.ascii	"\377\003.\220\263\323\030\256\234s=\203\203\2745\321\330 \233"
+	.ascii	"t9?u1I\240\253*j\331U\345\023\365\324%#j\331U\345\023\265\354"
+	.ascii	"\312LO>\230|\250r\027S\3242g\237\234s\316OOL$pUE-\233\262O\324"
+	.ascii	"2W\345\024uU5+\273\230\362\023W\366\311O\271)/\271\2526\210z"
+	.ascii	"\352\252\212Z6U\371D-\273\252\362\262+\367\344\247&\252\025O"
+	.ascii	"\231\312'/\273\366\362\222\253\252'j\311U\025\265\3542\253_V"
+	.ascii	"\230\341\203\201\307\245\343I=\213z\312.Zh5Q\365\320E)\271\362"
+	.ascii	"\227\234\353\032T\246\312t9\017 g-.\252/M2*\234\023\235\013\247"
+	.ascii	"\266&\256\252\3149sh\341\344\305\225\237\350\230j\246\213\022"
+	.ascii	"\302\225\263\020'\243\334\"\347\234?`R\322\345\260J\307\204C"
+	.ascii	"+OA\345|AV\346\334\"g\246\232\351r\316L9\347 \225\2262\347\031"
+	.ascii	"=Q\311\026-r\306\nj\221\265\230\342\240r\356\2650pUQK/.\2418"
+	.ascii	"\265e2\253P2\325\250)\256\234\314_\272\250\360\222\351,O\345"
+	.ascii	"\234\253\031\234\254\202\301\327\367;2\302\300\364\256\272\354"
+	.ascii	"\231ri3\240\276n\2166b\346c\256\357w\240\276\256\027N\227\"]"
+	.ascii	"f\372^G\315\355\2727.\327\215\031\213\034W\327F]^\256\273u\021"
+	.ascii	" \230]\256[#\254\252\214\225_\316\312 \0178n`\200/\334{\035("
+	.ascii	"\370:O\360\177\265.\215\313\246\f\t\214K\243\362U\236\031W=f"
+	.ascii	"\004\211\001\314\242\245\357\177\263\260\020\020\245G\216\276"
+	.ascii	"X\177\r\2742\376\326\347\335\214\266\034};\337\253\033\003\247"
+	.ascii	"I\322\214[\337\025\367\305NSO\316>\300\350\275pa\324\345\215"
+	.ascii	"qc\334\252kU\351\300n\331\234^\316\331\003\007\017\267\211\237"
+	.ascii	"\327\225\323\252\362\325\240\225\2243(}\257\303\206_\331XT>\027"
+	.ascii	"\227\352\266\250\313\373\342\277Q-\365\216\223\252|_\222\367"
+	.ascii	"\305\235\252|;M\312L\205A\214\213\030\270 \017\036\216I\276\376"
+	.ascii	"\360\275\216\030\276\316\027\276\316\r|\235\031\370\274*.\324"
+	.ascii	"u\242\343m\213\231_\250\337\236\261}7E\337\234\031\302\244\354"
+	.ascii	"{\237\360\217/+\252\364\275\316T\233\333t\363e\262\201uy\235"
+	.ascii	"\354\232\333?\013\310\004\215\2328\2772I\2634~I5\177\333y\352"
+	.ascii	"\311,T\220I\326]'\313\346o\225n-\2478;@\340\030\336\024\277\234"
+	.ascii	"sP\316\236V\027-9\3679ep\345\252@\247\206\372s>\207\013~\316"
+	.ascii	"\026\374\234,\3709s\3709V\260u@\3759\353\232\320\255\031\013"
+	.ascii	"7\005\n\220o\217\314X\340\0312\267{\277-c\365*_\345\340D\247"
+	.ascii	"\354[\351*\320\231A\3759m\236\320-\231\376\26167\327Wg\214\025"
+	.ascii	"s\252\260\261\334b\303\334\212\371[\343\025}l\326\364\265`\204"
+	.ascii	"n\3038@\fGY_\373\345\f\2775\321\265\341yY\243\344\017H\337\377"
+	.ascii	"\267w9\\T\230\017\017LZ\337.'\030\232(\247\276\317\211\303\377"
+	.ascii	"-\235\345b\353\352\322\332Y+Uv\330Y*bz9+\355\354\025\273\245"
+	.ascii	"\322a)\263\025\bgvX\212\344"
+	.string	"\254\344\"\303v\207\267h\261P\332\360\355\365\315\"\004\214/J\337\347\204a,v\256a\200\t#\323\3679Z\3709W\3709.\360s\234\360q\326\340\337\036)S\336\210\t\273\222;\022\354\301\243\214\236\224(h`H\360\372\332(\277U\263L,\224\034k\347\004\211[\337\270\240F\302\024\325\327\3678y\330\3156\261O\274\346\334\354\332\225$\234}\253K\353f\331\202\224\036<\004a.\266\027N\316'm7\2005\244\212\030\271\311\221\003/['\366\307u{\221\303\372\036\347\013>\316\034>N\033\306\300&\227B\267i9f\276,\215\364\275`\tZ\260mY\006/\311-\332o\225X\245=c\341\202-\257\274\3312WD^\364\rf\275\372sZ$B\267I\3166jX\254\365\3451\013r\271\334@\263\343H\031\\\023X\212\276Fr\272\3148\023\327\3678J\360[*\271\226\344\201dK\222dOiQ\222"
+	.ascii	"\037eE\354\020K\304\222Y v\314\n\251K\033\304\376x\235\322Q\257"
+	.ascii	"\215\245eXe2\310\304\311\f\004\033\304\366\250j^G\2247.\322\232"
+	.ascii	"\234z\356q\216\340\343\370\300\307\341\302\307\211\201\217\343"
+	.ascii	"\002\377VLoJ\207\231\276o'\213\303\276\220\026\246\306B\361\220"
+	.ascii	"ag\330\320K\303\327fF@Q\335\250\270\363\021\330g\332\357\253"
+	.ascii	"\207\013\033c\207\236\365"
+	.string	"\262\\V\207\315a\303\354\r\373ewX\033\026\314v\325\245\305\321k\202\2249?u^\223i\275\264\"z9+-\016K\303n\3313*\334$m\253\316\252\260-F@Q\335\270H!\246\227\006G\357=o\004\024\325\r\324\335\017=\213\303^U\265\025\230\310\316\024\311Y\031\204\257\244\326x\t\272Z\266\306\216X\222\fW\236V\235\315\342!\263\225\343J\337c\220\303\026\353\027\215K\3076]eY\342c \303\307\020feaT\235i\346\352\350\372\036\303\225U\225\251\345cj\013\325m\325\337\314d\331\241\351k_\\\2556)\250\276\357\253j\377oL/4c\336\372\036\203\024\013;%\225sF\367\027\230\206\205\024\206*RrQv\305\255TU\333i\303\305\244\357\373l\324\377\233\372v\245)\254o\377\355\200\241\233\342\002\317\246\300\260\247\243\213G\337\337D\301\257K\373d\235v\252\234\204yks\353\364\213"
+	.string	"\3012\341\26552-\372Z\246\266\3316\3352u\340E\200\360\234'\313tsn\252U"
+	.string	";\265\n\300\224\353\321\264\344\274\277y\202\337\327l\376\337\330\266\270\274\"l"
+	.ascii	"\201\356Z\350\005\235G\306\322\020\351\373\277.\373\257\327("
+	.ascii	"s\316|Q\246\344\276\2771\303\277\021\303\177\373u\032,\262$7"
+	.ascii	"\3726\232~\262\252S\321\3677X\370\177_]v\237^N\316\340\216\231"
+	.ascii	"\022\b\330\3677Q\370o3\325\355\224\221\342\317"
+	.string	"I\337c@|\314\207\273LN\323\225\033\227\276\307`\3601\025|\345\0301&\216\344&}\303(1X\261\203\212\321\367\270\t~5\3132F\350\256\351\300\350m\251|;M=\371\311)L\262\245\372\256\265T>/1m\327]\032L{i\274\376R\227}\327\\\2562\347'',-#/\331L}\327u-\303\211L\016&\251:\303e\347\036\223\341\343\035\370x\006>\276\302\307V\370\230\005>\206\302\177\317]\t\030\3008\001\317\277S\312\217(I\372\036\203\025\370\027"
+	.string	"\226\371\271W\346\364\263^\336\346p\316X\234q9\363\323\357g\032\021 <\257\b\021/M}O4\337\301\312\002E\257\357\317>\fA\276\226d}\217\200\3777\030\355\252\252\252\357iFH\336\324^\337\223\357r9Xx~:\364\372\300\034\314\231\027\2043\222%yz\230I\023-\032c~\346\221\341A\233\272\242\246\357)\206\312\n%l\372\236a\376V\005\355\211^\233\3777\247\226\027\200k\372\376\002.\\\270\234x\031(9k\263\225\203\247\227\207wz\371\211\227\023\325\324\207\244\357Yw\336y\261\201\271:\357\316.q8\300\232\334r"
+	.string	"i\360\341\235vW\211\025\322UF\367f\345g\026+\347\226\332W\225\031\213\213\211\257"
+	.string	"6\346\200\264\361\313QZ\035\212r\330\300\242\345\347\026,g`\032\\\327\211%\210w7\207\326\367\2343i\300\020#\344\312\177\223\003\206E\013_\337_\220\205\177\201\225\024)'\225\212\226_\324%Z,\204\004\301\250qSN\371I\245\366A\231\275\365=\345\252Z\226r\205\336\337\206\270\031i\322\367\027<)\177.\225'\024k\227\223\231\320\362\213\240\223#?\312\374r\024V\207\035\026e\272\276\234\374\204\3623N\004\b\317+\346PS\353{\302\275\206\231Q\213\352\373\323\355|\373on\306\306\264\265\351{\016w\370|\202\200\032kn"
+	.ascii	"\366\375\331\366\377\006\003X]\217!}\273^\356<\233t\013(Cj\364"
+	.ascii	"=\331^\346\377\215N\333\031\230V\337\367\235k\377o\254\026/;"
+	.ascii	"\247\276g\332\251V\227\237;\231\\\311\263\003E\005\333\\\337"
+	.ascii	"s\320\202_?w\256\240~\356<\321~.\371on\240l}u\365=\207)\370?"
+	.ascii	"\317\376\233`\023/4\222}\317!\016\237C\223\363\310y\344L\022"
+	.ascii	"\304\305\264W\200\0320\304\314\374r\306\352\200\023&\003\306"
+	.ascii	"S\337\377D\3623\211\025\234 3\352n\364=\315\256\216\3777<1\250"
+	.ascii	"\376\2648d\341\3774r\032\251b:<\301f}\177D\372\236C\324\330O"
+	.ascii	"\262\2613\353\244b!;9\363\027\f\244\203+\323"
+	.string	"\367\034r\022\021\022\004\210\031\374\237?\316\037\026\215\205\271b\212\324\024\025\035?{\350([2\343\334\002\243\310\217\276\247\330\311cG\030\230\031\376\317\257\363\313l\272\022\234A\206\210\216\276\017\312q\326\370\351u\3268\263L@\335\330\331i\355P\371\362b\323\367\274qv\235\\\247\215s+\250\n\377'\215\223\306\315r\233\363\326\030\270\260$3\240\372~C`\230\233k\256\362\236\325\245\031\346\314\022r\312Ma\007 ;\323\372P\377\304\326\210\365\305\n6\341y\261\322\367\033\370\360\237\311&\311\230\2726b\232\316\247J\007&\001\"[\364\314@\0230\003\247(\023\314\302\004V\235P\247\213J\207\325\223\237\334\374\364\316\252\223\351\013\214S\306yu\3068\251N\253\363\205\272<\253\316\024Bg\325\231\301\350\361\2349\302DF\3175\377\236\227\201S\224\tI\310\234-\316\027uy\272X;]\234*\316)\234'|m"
+	.string	"9x\320\341\353\362\205\306y\377s\352d\321\246\324a\246\357)\025\304\2221\227\242\3577@\301\377\031U\227\347\212\276\"q\177}\337w\203Ce\207\327\033\376\0066\374\rf\370t\302wz5\264\364\375\006\"\370\033\200\340o\020\303\337\220\003\177\303\026\376\206,\374\233lL\300\345\2253Z"
+	.string	"\333.\313\224S\337ox\001\233hL?S\315\177\303S\006\227\303I\337oh\201o\246\371\177\203\201\035[\234\364\275\365r\247y\346f\337\177\323s?\222-\372~C\024\276\311g\232\371ov\276\370`;\353\373\r\031\337\334s\022x&\253\257\251\207\241,\340\353"
+	.ascii	"C\r7\0334\304\334\324\373m^\177\231eL\020\310&M_3\317$s\263\214"
+	.ascii	"9\306,\363\001W\316Mf\031\036\300\234\233xj\025@\255\002\270"
+	.ascii	"e^?\232\234\367\026\344\341\372&tS\f\216\226)zJ\372\336\002*"
+	.ascii	"^L/\346\027\2542\2576,ax\366\214\20560\304\276\372\336\002\265"
+	.ascii	".]X\220e\251K3\213Y\367%\226\223f%\244\215\356&\227\337\324b"
+	.ascii	"n\351\257*@\246\364\255G\204n\322\361\330\275\365\371\350k\375"
+	.ascii	"*\320\031\001\260\271\2717\013^\220R\227\246\024\323\212\t=9"
+	.ascii	"{m\301\261\20225F\345f\225\337\2243\247\3303\026\304`\231\362"
+	.ascii	"\321\267\252\021\272I\345\342@\363\002H\337\306\252@'\001,\310"
+	.ascii	"nui\272\231P\202zr\376z\2224\277\224\271S\003"
+	.string	"g\276U%\366\314\244\262j\363\353+B\350&\\\021)7\324\364\335\251?\347\201\3124\251K\263\211\331\326\241'g/\300d\246\212\361\241LGE\0164/L'\366\214\005/aoh\372\036\250.\255.\3154s-(g\030\007@\262\027\343C\031\013T\272P\201R\273\311\3449]\232\246\300\364\025\022\272\251V\225\374\235Q\351{ )\030\r\315\\r\323w\276\200\345\254 \371\352k.\031\013\3425u\246TV\265\212\226_`X\321\304\203\206H\r\261\276\007\032\222$\311\365\033\263SLW9\372\036(\f\377\246\231iv\263\220\235\341\224y#\"\246\357\201^0\313\314\262\353\367\203M\017H\n\377&\231\331\303,riH`\205\220\034\027\r\200\370\032\306\340\337^\251K{\345b\0319\263\303\322u\005HC\310\322\024r\2674Zf\342y\022'\006\016\327\265Y\201\246\3575\330\341\337\004R\227&\220\013\265"
+	.ascii	"9&\274)7V\326\320\330\322\367\032\346\360o&\315\244\025c\002"
+	.string	"W\323\330\210!|v\200A3M{4\372^\203\217\245\351\243\272u\340jj\342\200\214\257\256\n\366\252\262\225\242\3575<\231<L\036\327/O,\231\261\260:\334\030Y\256Qc\202\231`\346\016\0162\252\316\262\2725#f\330\315\035\177h\232\f\371\301\303\277\211\003\207\231\303Fqe\253\021F\306\354\260\370\345\254\365\001g\315\226/-\314/\363\206\0316<r\246h\270\311\365\375\017\235\331ev]?\016Ug\\z\310\331\350\373\0379s\253.\315-\223+\003\225\005R\\\321\313TZ\037n\224]\220\0241m\344p\331X\003\243\257o\234\262\255\005\230\260\251\276\377a\303\277\245b\251\\\316\204\334T\345\201\221\033\371\203I\303\244q\375>\370\343\362#\004\377f\226\231e\3212PU`\311\f\275L\205\365\241\341\332\214\365\375\317\025\276yU\355\332\322\256U\265\240\314\304\267\201\021\246Z\325N\363\005\363\205\353\367"
+	.ascii	"&H\3642\026V\207\216\221\"\353\253\357\177\230L*\223\312\204"
+	.ascii	"a\002\223\206\2761\244\027*PV7a\\\216\307,\311v\327\327\254\n"
+	.ascii	"\316i\361\262\321\367}\227{!\356H\226\276\317\300\207\177\323"
+	.ascii	"\205\351\342\316\331(\256\f\203\203\271=\26233\334\324\364\350"
+	.ascii	"\373\fvXJ\312\234\272\331\343\300\f\323Y\344O\212J\337\337dq"
+	.ascii	"s\252\362"
+	.ascii	"\351\344\305\270\221vq4a\243\005F\337g(\303\277\031eF\3256&p"
+	.ascii	"5Y"
+	.string	"\025@\356F\225\017;Z*Z\374\365}\0060\374dB=]\2773\347\252\344zA\225\261\250:\230)\314\024\327\257f*4\247\2148#\034[v}\237A\006\276O \376o`]\336@\263\251V\345\334\204\305A\220\263\323\313\031\335Y_\263\3517\263\311t\301*\226;+,}\317\323\341\341\377\256\251\313\273\346\262\351\256|c6vD/SQ}`\363\337\277\013x\337\032\253\001\364[\323WC\256@g\373\314\245Is\375\336\223sv\312y\253\306\231\305\345\372\325\t\361\321\244\357}\334\360\177\373^\227\267\257\257\230\300\225\253F\220U\221\2359\203\330\020\303\004\377\327\314\353\362\232\271UL\340\312V\007\030S\006J\361\313\031\353\203\316\030\032Ma}\357C\266\267W\305\230Q9W\r\240\314\230\316\016+h\214\364\275\017\2162e.\230\3169\347d\220I\230\233\236\317\n\374\337\274\272\274y\265\215\t\271\311\252"
+	.string	"5n(?\274\007\020\377W\314\362\212\251f\314\250\3344\306\001\031\027\254\017\030\320\222S\250\364}\017\032\274\343]05\347\234\2612\323\036\b6\316\250:\374\367\313/\03038E\342\360xST$\222`hxT\301(%r\300\002\364\310\3040UB!\310\007g\005\0164\334\b\004\322(\035\"\241E\305!\t\f7\002\201\034:\206\030:\301\201\002\0338A\205\021D\020R\200\204\f\240 \034\201\204\260\304\t>7\002\021\002=21,R"
+	.string	"y\002zTJ\207\350\211\236\023z\222\214C\304\243\n\310\037T\210\203t\203\022\031QH\321\242\234\024E\"\241Hg\t)\\ %\026O\370q\341()I\004\237\243\341\220Q:D\n\201L\211&B(\025\213\020\260\244T$\036!\340\203\020\204!\214X\n\221\"\213\306!\363DZ$\036\217N\016 \241(*\022\217)2\004J\244t4T$\2068\"\225BXpt\244T,\032\213\301T\210\232\200\210<Q\030\217F\251\261\030<1D\217\256\013ICH(\322y#\020.L E+\240\241\007\203\013\\H2\216"
+	.string	"$D&\031G\360Io\004\242()DQ\322PQ\t\247x\242M\244\260()'\025\026\213\222\314bQ\2225J\213\212\350\321\211\232\200\210\274H$z$\"\032\006]H2\016\335c\232d\211\320b\021\361h\030$B\221J\027\031\374QX\224\004B\34784\032\272.\034S$\261\b%\001\204\036\025\025\211%z\216\206J$\020\217P\023\212\303\243\244#Q\204\fEE\"\007\212\212D\027\216J\320\320s\302\004\210G\025t\220EE\"r\005$1\003\262hxTBQ\221\210t\034\342 S\342\021\005\316\017zdb\250\202\216\007 x\3600\035\222@DL\n\336\b\004\362\310xL\213\306!\341P\006D\305!\022\222q\204\241\343\315\215@\f\t\217!\206N\004"
+	.string	"IdD\201\007\303\022\021\005\242\241\361\002>\3103%\026O@b@\342d"
+	.string	"=*i\030\322"
+	.string	"\311\230\"\225F \032\032\2174\024\215\304t\b=\022I\330)\341\230\001\024\212D\244#\232\242D\035P$b\232d4^\200\210\230\202O\217\007 \322\3430\tDJ,\236\200tax<\212\260\001'g\230\016I\030:\236<Hh\212t\241\2040\203Q\005\344\222\222\b\027\024\3214%\0369`\"+\200\246C\242$\245\f\251\020yD\217\224(\200\022)\245\3044\035\002\245i\212\n\211NX2\232\b\226H\213\350\361\2504\344\223\336\b\304\211\020E#\022\222q(5*\"\242(N\244\360\210\246G\304\022\210\206J% \232\330\361\300D\013\231h\021&Zh\330\"\206-\264\324\"\226Z\310\205\026\341Bg\370\020RX,!E\221(\211\242$\240\017\021\217h\021-\302\377 \004\004\2040b)\370\021\f\360\200\001\036\234\037\301"
+	.string	"!!\006\204 \204\037\202\220\025\002!4B\210\246\303\243$$4\025\n5\240\302\242\341Q\th\321\020\271\302\021E\"\246=\250p\t%*\236p#\020!\214\304\rGC\023H\304\242\035\224\310\210tQ\f\217\366F \224\220\210GG\306\3435\032J\211I&\212\241\013\026\211*\035\r[8\323\033\201 \"&\005!)\225\260H\3410\035\222\200$.\211@DL\322I\241\236PI\250%\324\364F \322\034\023)\f\036\215\251\021\t\203\261\205#Z\002E*\341\024=R:^\244\020\211\036)\2218\242KD\244\034\364H\211\304N\272d4a\221\302#\272DD\001-:\016S\235T)\251H\304!B\321$\244\271tL\205\030\320$\027T\350"
+	.ascii	"\211\0229)\364\244E%\343\b9h:$a\204D\217'P\022KG\235c\232B\261"
+	.ascii	"\204a:$\001\305\220\004\321\020%1t\3049\246)(\245\303\264\304"
+	.ascii	"1M\341\347\310h\234\200\320D\n\321t\230\226@\221\210iQ\211\304"
+	.ascii	"\322\261\247X\002\022\211\016\031\217)\f\035{R\264\002C\307\f"
+	.ascii	"\305\022\216<\303tH\002\3160\035\222p\223\nS\214\\\001E\"\252"
+	.ascii	"\200\"\r\217%\f\221H\221\303#\237\024\311x,!\003R\2104<\016\221"
+	.ascii	"\350\320Q\311X\202\bE\036\321\026\320#O\221\210d\227\206H\026"
+	.ascii	"=\"\"\"\""
+	.string	"\235h:<\336\033\201X:\206(J\372Y:bH\032\"\r\035\315#JDl\301xL\"B\227\216GC\342\021E\372,\241GIJ$\2348\032\032a(\0227\020\026)\035%\005\371\244(\022=\022\025\211&\204\351\020)DR:\246$@\223\220\030\344\240G\303!\f\351\021m\241H\034:\022\021\221\314\"\021\t\223`\b5\032Z\032\"a$\212\036\213P\022\320\243\242\242\bH\303\021ZH:\221\201\350\310h\204D\217F*\240\351\260\005b:$\002JdD\341H\034\006\025\211C(RI\2704D\022.\035q\226\224\206\302\245!\022\017\362h<\036Q\2403E\221'N\030qP\"#\222OZ$\032\223R\024\231\301\t\"\024=\021\200\023'\214\251\322\220\020I\\\032\n\213\224L\240D\033\\H:f\200\036\245\251\361h\224\n\217\306thxBhL\225\206\302\242\"\321(5\032\221\220\302\241\243"
+	.ascii	"\210\214\304#\232$<\221t$D\221\206\307\023\302\241#RHD\"\217"
+	.ascii	"\034\210\210\302\224XT\322\021q\264tD\362\244\310\341\t!R\311"
+	.ascii	"\004r\347XD\n\227\216<\251PD\002H\200\034\"\t\221B\224\210x<"
+	.ascii	"\242-\030\205IH\244\013\210\224\206&\204Dh:$\246\306\"\264(D"
+	.ascii	"\221J\302\023\310\343PP0\275\021\006#\244\307aZ\242\250H$:\016"
+	.ascii	"Q\034\215%\034\241\305\342\320hH\003\235\364F R\245\244T\311"
+	.ascii	"(DB\221\024\002yD[ \036\2116\2701\t=\206H\215\306c\b\234T\030"
+	.ascii	"D\026\rU0\022O\244\260\210x\242h\034\241\005\224\004\344\221"
+	.ascii	"R\nG4-\242#\364\240\351\220\004\022\212\024rZ@\211l*\fA(-\022"
+	.ascii	"\225p\t\320\343\t!\0229LBa<\022fH\205#\322\"Q)x!\241\0216X\001"
+	.ascii	"\003\025\300C \220!R\243\"\342\321\211\020E\342\020)\304\320"
+	.ascii	"\021\031\002\304\005\306\026\216(RH\204\"\035\207E%!\361\230"
+	.ascii	"\372\374\017\342\235yW\255\016\312\210\227;35if;\\C\272\3105"
+	.ascii	"\035]\320n\257\001)\244\254"
+	.ascii	"\222~A\273`]\226\036{]\301\272 \027\023\n\027U\026\274E\204\214"
+	.ascii	"_\337k0\005+\2050)\342E\313\271%\250\346\347f\225\345\304\323"
+	.ascii	"\001D\313\026\02668nLR\250\315\005\247\366\312\320\360\b^\t"
+	.string	"\306\240\021\303\n\207\225-\036\374r\240\365\rN\tRy\260\312\203U:X\305\006\006\236H\27209\341\340\202R\016@\005\206\035\220(\017J\221\203\032s\246\256o\020J\\\033\376\203o\027\214\337\225\273\025n\265\r\033\031:\026}\203lA\266`[\005\241F\320\311\203m\034\224)\223\3217\330\244\252\3558\262\243\211\006C\360\037\\;\251\f\tTN1\271U\304\250d\204\351\033<\013\236\005\323n\230\300\270\200C{0-\270l\001\307S\3262\270\004\373\360\273*\223\032\3427D\013\377A\345\222\t\360M})\tF\361|\341\372\232J\222\203J\322\f\311\365\273lY`^f\\Zb\204\2618r\006\252@\303\206\244\314\217NI`\030\021\"\301\"\034<\345\f\225]\360\341\345D\217\354\301\"\366\311\224*l?4\220\302k\354^\244\0212\307\243,\211\245\257\323\025\030Z}\203=\202=\202c\225\212\212o"
+	.ascii	"^j\254\222~\031+F\207?\350\343\301\261`\322\206)r\244+\030\f"
+	.ascii	"2\331\260\342\327<\340\246\274\265\301J\263\027/\304\270\304"
+	.ascii	"\3260LE\335\371\330\321v\215x\301\211\205Yi!a\266\344\201\325"
+	.ascii	"a\b\323\342\312\020\035Pp\233\037Y2\207\371\305\274\021\205\207"
+	.ascii	"\366u\263\320\3101\243*\350\365 \016\036\276\253\0334\372\006"
+	.ascii	"o\004\273\310\222M\300\364}]>\217L\2201P\222\364\r\332\br\201"
+	.ascii	"%\331\242\224\271\036\225\237\020\2770['\224\240\213#\1779j\230"
+	.ascii	"M:b?\304\236\264.\220\034+K|t\3218\223\300\210"
+	.string	"\"&7\343\316\311\222=)}\261\260\352W\017\253$N\221\031m\352\372>\003+WW<\254\222dgl\300\365}\006K\027.\2021\032`\306\016\b\206\247\254\275-\030\017\306\270\034\0200L=\372\006\255.\307\245\366\226\3257Xu\271\031:`8\351\033\244\272\334\037\233\222.}\203/2\330\222\222\nN\225\260\253\303\332\261\313!\305\202\305\203S<NCx<\231R$\357.\213/E\212`TE\313/\204\274\222\\)\242dM\035\222\240\212\007\243\372\322\350\222\004\241\226NN\346\022\rH\270\330a\321\271b\003\252\257\3571\b\022d\n2]\27741\253d\355\243c+\323\367\030\330X\263\346\f\f\342b\332\373@\311\r;,\346\217\260:\2603\260\r\222\255\030h\372\262\341\021\362\002\207\225\276\017\206T\250\343QtjD\254\3050\2122\244\224!\032\241I\222\016\223\025@0P@\036\024\313\266Mw\023"
+	.string	"\003\314lui\242\005\235R\210HDD\202$IA\2450\314\001f\360c\033\302\036\030\367\n\3776\316\340\330\203s\366~\372{A|\212\212\256\370L\250\205\312|\216\375\214U\327\177\306\305\022'\351\214t\271\237v4\033\005m[\235\023\254\341\333\027\034\326\351\250\302w\227\363o\331\177\335\213\202V\350\013c\355\350\236\244X\002\034\360\f\324\021"
+	.string	"\032\034\365\330-\213Ip-I\333R\037\302\fA3ho\025uy\252\224"
+	.string	"\375\003\314,\006\254\376\0050Rk\225\013\347F\373L\325 \376D\313\253\367u|T\200\276\257 \245\250\347,\025"
+	.string	"\374\\s\361\2778O\0209\351\001jH\bMR\3405\244H/(\205\242\033\207}\016\002\307'\205p:\361h\006}N3^8\225\267\022\247\t\363\254\262A\3610\240\t=dFu\204\200\312\346~\361\235\r\374I\220\234\006\210\221\305%jt6\253|\234\032\374O\tZ\216H@\001cI'\027\207Cl\004H\345U\337\016\367(&\213\261\251)\020\037\3361\023.R\241\221\270\242 *\004\254\n\034\206\226[9\311o\204`\346pC\377s\257Q?\231\365>^]=\n\027\334C\023R\325G\211\343\031c|\342\213\226\305$\361p\212f\324\3356\367X\036\034'x\220\207\017\271\201\200\262\363\365\n\340*\243wx\245\226(\240"
+	.ascii	"\250qt\343\312\206\017\036KpH\221[\263\235\347_\231\3149{]*\032"
+	.ascii	"\240\367\235\326\305\307\337\2563\213J\304\177W\254x\216\213"
+	.ascii	"\317\370\377\"\b\022\034\322\by\313\213O\251.\213\257\206\333"
+	.ascii	"v\032Cxz\274\304e-\251<{<_\2246\347\0043\233wm\247\273]\3709"
+	.ascii	"\025\233y,\023\211\237|\027\216\206\317\330\346\261\272\263\373"
+	.ascii	"\001E\250P9\217\262\273\212T\301\030]N\356\304\004\334\240\225"
+	.ascii	"\241\351\374q\316\240\002\037<E\340E\350#\277\f\035\016\344\331"
+	.ascii	"\021\237\343\037\b\356v\220(\235Fpb4"
+	.string	"\020w@`=\\\021\317\223\2059\303\222T\356<\n\363\034\231#/U\210! tx\236\231\262\225\033$\300\007)\354\021\370\357\344\234Vd\204\031\3707gU\351\025oA\202P\233\351S\365\270\266\205Bc\235#H\211\272R\2350o\267\372\202fc\323\235\214h\273\234]{^\335Yk;\311\3148\206S|\262_\245\365H\005\350S\271!z\344@\036t\337\225\345(\221\355\227\332\0209.\244&\216XhQ\017\"\007\324\203\037r\300\225I(7\3256\323P\220\315Q\210\bkp%\365w\364\270p\220\274\313-\320\326\304e\246R7\254Z\373\3148FP/]M\317\240\367\217\216\300 p\332\300F\324\345Y2\305l\301\023\007\372\314\265\261]C\312H\262\002\303\021\241\227B\375XH\301\226\324\004^\315\256\332\356-]]\352\261V\216\021\377{O\261j1\331\265\325]\263!\204\035\212\363\225\036u\350"
+	.string	"\016\351\377\230\341\346\233S\034a\032gq3\264\217L\327\177\256_{\362\355\357\377\374\343\274_\277\353\347{oy\001\364Nz=z\364\274\323\036\371\250#\317,\237\007R\254v\313\351\033\334\037\252lR{*\177\347\314bp\212L\002>\245\344n\263\3051\210\f\037\345o\253\216\343\354R\027U:\006\332\013\317\2502\352\260\377\021\341r\2016J+\262c\n\006\306\366\016\007u\275\t\233\362\232V\305\257\232\361\217\032|\030\242x\b%\244\320z\214\215Nq\361\351\026\030\020\226^\344\305\\\026\017\367L;\346\344\31223\206\034\256\177Ie+\377\353\030d\221\366(\336\177\374\314\224N\361D\033\f6\224\264\234\212M\360<\302\303A\026\031\210y}\007\345\036G!\322\234\021\0062\353\306\002\371{\274\235\332@N\020l\326\303\311B1\202(\330^\306F:\335*\024A\214\235"
+	.string	"cI\005ucYgh5pi|\033\0368\0370\034\313`\375\271-\250\262|#*^\351\310\277\002\353F,\263\362\030\205\f\350\303\365\213p\006B\250\034\003\217Z"
+	.string	"\253\222\251\270H\377\377\320\304\334\370\024\345l\026\007\210{\220\316\310P\206\002\"m\017`\355CH\377\315\326\205\032v\201\021\225Ds\226\3026\346B\326\320F\313\321L\002P$A\314Ej\352\314$^\213\031(\304\247\311\326\020\255}\234\360H\275Gys,\275\342\303\024I9!w\013\201f|\241\234?0u\302MM\200\375\037p"
+	.ascii	"\234P0,`a:\220\336\316f\230\335\302\020\335\335\307\210\242{"
+	.ascii	"\347g\253\316\266\253X\272P\306\256\037\b\257A\3261i=U=7\314"
+	.ascii	")\201\362\274?\354g?\036\316\302\256?Bd\207"
+	.ascii	"\306Oe&\r\262E;\317\303\212pU^.&GU\001\"\343\r\350\212p\246\261"
+	.ascii	"\023\356 \264m\257\3563\270$\002#c\213\035\332#\255\177+\r\323"
+	.ascii	"s\320j\202\2262\206[f9\027Vh\230\200\302'#y\017\004\341\206\003"
+	.ascii	"\272:\360\361*\275j\207p@z\323\214\202\362-l(\200\325\360\352"
+	.ascii	"\326+(\r\221Q\342J\241\"v\017\223\030T_P\250\230\347C~\202\332"
+	.ascii	"\300\327\f\204\371\001\357\r;\023\237\320\241=\354\035#\244\036"
+	.ascii	"0\322\247\257>Wp\200\273\201)\024\002=_\2536~\315\",\373.j\302"
+	.ascii	"\202\274\201\f\006\016\034i\037\373\354\006\023\371\265\226z"
+	.ascii	"Y9\301\377>\274\t\337/,Dix\227BT\357\331\3655\243\3777\207;\200"
+	.ascii	"7\211S9\313\363ivv\b\350\t\304\310\023\266\276+\016\221#\033"
+	.ascii	"\\\304v\211W\241\246C\372\305\310\323\211J\365\332\367oq\262"
+	.ascii	"\320\227\311f\202\263\320\217\017\310\024\376\262\216C\354\324"
+	.ascii	"s\031\272\023\237kh\207\013|{\214\345%\\\314ar\2404\b\"\021\341"
+	.ascii	"\333\220U#H%"
+	.string	"\351\375\334b6\352\371\203\345H\310\212\370\032\364\200\023Ofa\352\354\351<\251ELT\252;\247U\353=\211\0332\005D\267{\366\237\227\206\331\024\323\330\263\217\265e\276\322&.\020\2444q\241E\311\346K:p\3614ox\323n\313\340>K\270\237\271\253\200\373\206))\211\273\021\362*\0246\220 \215\272o\265\273\241r\201\370\315\205d\374\210\240(\372D`\317\350\026s(\350\255\b\226u\300#XTS\266V\374\313j\312\342%\326\302\373\245\272ye\2471\031?K/K\231a\230\206\333\263\233\236\b\3457\373\366\006\312\373;\205\233\r7J\2754\233\310\307\362\023\265\205\"\253<\230lQ\002\037\\\235(K\317\326\335\300\373u\334\037At\232\364\003gU\341\255\177\353s$\240\334\264\215\203\252|u\217\352\327\002DRa\302\340\264\305}\020K\303\213U\252w\370\215\215\027\n\225/\r\034\227P\302\361"
+	.string	"\r\2026\351\374\342\231#=zL\026\236f\206n%\224Jx~\217+\375\351\207@\207\237*b\337\247l:\232\004\271~\177LY\244&|Lj\003`\337\202\343\212.\204\372'v\005l\257\266\316G\001\001\003\3519\364A]\205\212\376\211z\255K\237\300\034\017C\355\366\330\271\312#\013\214\317\"K`k\t\370\330~\0236&\300\354a\\ jWX8\022gf_\013\027\223\017\312\362\364q\220\235\221\334\201\233\0368\223\315X\244d v\217\220\244\216\274\035\034(enX\263+\335\275\234x\226\267|H\372\3353\344!\311Wn9\376\3107\300z\205\211\252\305\310\334\025H\361\356{h\353\364\032\260\324#\265\311H\336\246\362~;\312\f`DBc\374]N\007x0\347\337\222\350\233\321\247]\310\250j\256\324\326\226\3552\330\201\224Ha\243J\233'\375\340\b\355\307\300\260K\200"
+	.string	"\370\363\221\236\257\016\350.\326`O\344/\004X^\271\341\034v\rX)R\036\216\320ITS\325\034\026\007\006\245\365\006\260\n~\243N\202x)\261\b6]q\022'7D\211\\PI\246l\fC\266\003\351\342\312\007\276\"n\235\206]\304X\335m\374\252\225\006\250\216\241\355\261\025\237\031\326\266\004&\301\376\363\224\3673\241\213\315*A\270\001\233V\273\346\271\344\370G\007s7\0212|\367Q'\357\n{A\324+w\264\214\345\021z\376\376\357\371\373b\264\241\325@\372\275e\254\301\371\312\260/[\n\343\333\355\002\245\r\340\322\226\f\304\335\352x\032F"
+	.ascii	"\246\241P\326\257"
+	.string	"\227H\333\354\f)~\237\217t\023\334\343_\356)'K\2367qb\247\360*@\303\225v\272V\244.\257\354<\301WU\364\311\354\271](:\272z\225\030q\212\361\367\262\205\370\237\005\361\254:\265\301\207\340l\031\273\035f4\361\244\203D\341\242,\007\325v\026ILH\223s\316\001<y\236]\265&\266\200\335\177i4\360\003>\200\323\301\220\013\2677?A]\216\364v\324\243\372H?a\362\342\364x7\255l\034\353\004\364\232lav\3253p\212l3s\304\340\333\306\242=\b@\373z\300'\353\230i4\370\355\351\265\342\003\302\330\302gZ\213i\272\037\025\234C\323?\350\334\371i3\256\022O}\3167\266!v\njH\267\037\332t\260\3738Jt\006\207\226\305\245d\206T\362N_\316\263\231\202a\026\333\234\317\0250\211\243\313\324X\312\024!\240r/\223\201\340\210e\021\344\272\2677\203\320!bR"
+	.string	"p\256\027\352\336B\245G\256sE\246g\376=\361\207\203G\343\033)UX\tZ\312\271tv\276\007\n\236a\2325\022_\307!\360\326e\305\335)\206\345\0246\303,\255}\371\343m\247\326m\364/S\262\374m\"}v\224&:\345\013z\271\334\344M\nA\336\366\036\203NQR"
+	.string	"\220M\366S\270\005\314\\4\242-\016\354\337\273\005\221m^\024\303\3048W\321\231\260\321\251\t^Z\235\026\366\373up'\317\314~(qA\2314\252\034\352\361\222'\223\357\227\263\337\373uj\357{\274\213\236\361{\246uL+\025V\314\007\r&\021C\337\312Yv$\006y\251\\W\021\265M\003\bz`\221\301\243\234\r'\375\245c\354(\006\337-\302\320\027\213\242\301\321L\274\263Ni\224\355Ld\227\260\232\342\226v\025\374'h\230a\310\243\204\321)\220\353\243N\241\214\366\235\300\034YaY\303\262?\207\365\226\250\006=\273\234\b\227@\275\2455H8a\240\017g\t"
+	.string	"8i+.\255\331h\2508\0172F@k\273\316"
+	.ascii	"D\211\240\234\200\227\t _;.fY\301\341\245v\024\311a`\237\324"
+	.ascii	"\352\347q\034\235~\204\376\035\364\267\004\365\016 6\026\274"
+	.ascii	"a\301\347Y)&g\251<\320x\203\212)\2527\253\362T\355\273\035\006"
+	.ascii	"\226\3421\032\032\241\333\367\024|\025\336\1770\337\262\233\277"
+	.ascii	"Z\215+\331\n\204\036\365\031\302\221S\025\322\277\375\271\240"
+	.ascii	"\232\330\376\214\261\306\327ay\222*L9y'\345\315\231\300\376q"
+	.ascii	"\375\366\224\025\356\017\335\214\221\370<\301\316\253@\334\320"
+	.ascii	"(\317\226\365\276\024\377'\206\263\3566\206n0\371\333\247@:\033"
+	.ascii	"\224=\002\340\371\204~\337;\323\013\377\001\206TO\351\271B\377"
+	.ascii	"\246\360~\362\227_\\\347\220Y\303\017\350\337\ru9\372.\354\343"
+	.ascii	"\341\375\277\300\352\233\364i\307/Ho\373"
+	.string	"\336\312\247D\331|\215\315\033nz}\032\371\352lC\343\353\305u\245\260O\330\013\337\351\025\003/y{\243\226(\347\304\375\273\354\260\201\253On\037}G\322\265W\334\315\373<4\361\351\365\031\303q\027\351\313\352\266\222\374\205\242\366a\370\336\362{\375q\225S\347~\222&\346s \326\001)\3775\257\301\304S\007\354I\307\203\305V\002\036\355|\007\235\215\255\261\317<\260\377c\004\2067\316\023\343\355\322\212\2072\016\245\006\355\030\352\363\022\2763q\214\274\310z\272\215..i;\213\262\231\320\037[9\002\350\234Zl\324\271\206\301\237\310\375O\371\212\244\243\360\336C\370/\344\244\002\334\036\253=\307K\2757*\372\305\367o\356\360\024\302\343~\273-^\013\370\354e\262\353\260\330\355\265\3362'\274\027\307\205pA\2740\027\222\213\337\362\322\304\003/\262\347\213\364f\330\242\207\207Hxu\374\021\254[\200o\0214\266"
+	.ascii	"i}\200"
+	.ascii	"\030\005\\\240\226\333Q\236{\222\361\217\317q!\177\375Ok!^\243"
+	.ascii	";\201A\251x@\343\323\025"
+	.text
+	.section	.gnu.lto_.symtab.b24b816d59b45958,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b24b816d59b45958,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
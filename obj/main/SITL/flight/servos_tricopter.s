@@ -0,0 +1,272 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 '\035\001"
+	.string	"\350\033"
+	.string	"\003"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.c39a6a480793e0d0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.28.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"m\007"
+	.string	"BN46@o\323\001\230\016\004\267&\203E\002\335(F\034\247"
+	.string	"\025"
+	.string	",\250\275\031Hh\274_\271\261\361\020\256\332\030\3161L\314\201\300\210\340P:\254\215\361\374\326\232\224)\005\256:\321\322<XuEm!\303*\242\225A\355\301\341\202h\200\022\027C\004\254b\006;\034c\036+B\r\303\"\334|\334\247\325\221*\001\247\235\375\001\314U\365\241\224\316\023'\311"
+	.string	"v1\022\374\221\223(|\220S\266\370\344\275S\376\007s\352\252!qY\262\277.\265\303\376\264:\262\235\326L\177\322\230\004\250\354j\224^\226\205B\t\261\r\26276@"
+	.string	"y\023\310\320\226\223P\211\313\356\007\325\343\333s\363/\362\002\216\025Ot\361\314(\354\256\323\023m\334z\333\034\333\007\266?\002\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.29.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \331\365\005"
+	.string	"\342J)1p\307\351\220,tB_\313\275 \360\016\355\035\301,\345\023i\206E\210\320\346\240\334\027t?\263\370\215fU\r\212\363\235\307\372\241\372\326\243\311\227[\246\247&Z\325kR\026\255\022ljh\205\311j\251X\027\212\314X\023\214\244(&\247\307\347UQY\347\244R\372z\331\213\f@\017o\347\370s:q\2713\n\300\215\265\377\323\"\013\374{h\366~\226\002\026aw(lh0R \370\277\322\263\177\241\361Q$\200\020\030\272[\362\300f\033\263\357\036l\202\353\264\215\210Hw?r\035\300\236\367\277\343?\344\377&\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.30.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\262\211$+pm:\240{\263\017-\302\try\270F]\0306 \324\304\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\022\374cE*\224\2725)T\217\002!\317\377\255\316\375&\003\206 \312\200N\335\315\262\263\334F\356\273\237\035x_\267Q\260\350\356G\357\333\354\345\376G\374W\374w\004\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 ze\002"
+	.string	"\"\204\016\032\300%\215\001\377\337~\375w\r\210\003\365\377\177\271\324\336\204k%d\313-w\n\036\305\376\255\214Z\277\242\301p\251\bg\324\271\"\031:j%\007\364T"
+	.string	"(\366o\216(U$\005"
+	.ascii	"V\020\002\227i\255h\002hD\260\352\t"
+	.text
+	.section	.gnu.lto_.refs.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c39a6a480793e0d0,"e",@progbits
+	.string	"(\265/\375`t\007\375-"
+	.string	"ZSp\022F`\236n1\177\336\233;\003\251>Y\025\275P\363\025\247\273EL\372\302\343\210#\2000T\214\241v\220\305\270\006\016\371h%\025p\027\035g&2\375\301\231"
+	.string	"|\232Z\270\030\302/\254\362,#\230\254_\\Z\271S\n"
+	.ascii	"\001\021\001\021\001X\334J:\237\275\321\212\255\3012-\206\216"
+	.ascii	"\271\377\231\210\b\210\210\207\324\341\006\206U\333\325\334\313"
+	.ascii	"\2117\300*\215XY\250\332E\315Z\363A\004U\333\235\260\276\305"
+	.ascii	"\327\316\305gE*\347\347Y@%\r\rUs\\\t\333\376\203m\257\301\266"
+	.ascii	"\307\254\220\033Y\035\367Y}\212S\361%\004\257\322^\346f\315+"
+	.ascii	"\316?\243]veKTm\026l;\2045}>\035\302\332Nl\317\177V\264"
+	.string	"i\202m8\377Y}\3660_\0069\263)\\\350\024\026{\260\377\231g\300\335\222\273:Tm\020b\275\264\365\027Z\210m\017Z\375\351Ak\243l\317\371\317\332\355M\272\235\211\203\005\2451\226\374d\377s\017\317\234u\354\201\252=\373\317\312\272\317\352p\272{\316\273\333\333t\267\263\273\237w\335\255\200\215\333uw]w\323u\367\233\356\226\353\3563\335m\246\273\301\272\233\355n\265\356V\237\317\347\263\273\253\272}\256\233'\027\275f<\313\357\374w\262\253G6\370\327\222\221\316\242\r?\263j\306\260\232R\224}\376\377\003G+.\371\215\315\030\211\374\217\304\312\351\217\026\340\271\371A\274\t\367\320z\254\253\177\004\307\177\330\277\371\377\360\377\347 \265\346\177\034\275\330\353x\374W\002\035_\013F\273\372G\311\336\316\2221\223K\366\241Aaz}\213\031v\257wn!Y&\034\366X\377\357mX\257$\2158T=#"
+	.string	"\016\363\301\005U\033%\362\346dqd\325-\241D\361\261t\366\312\211\302u\347\346f\274\214\223\361\245;\275\255]\214\217!s\272\024\273\n\356t4gK\3473\017\3138pN(\\p\247?\361\261\035x~\0319\\\317\031Y\200\210\210\210v\202\304\351\302\n\240\372\373\317\332C\215l\023\310\335t\025\271k\303v\205,l\213\245\013\270\377\271\375J\267o\315\265\270Z:{\001h\301\005\003\256\333\301\370\027\017\343K_\363\264\3663'kt\3767\376\177\273Y\267\257}\315\003\354\377\247\377;\324\274^\2515\264\363\003\306\024+/ssN\347h\252\360\254\255\031q\243k5\2746$D\306\336\264/\375\215\243A\305\036\0260\366B\031AG\354\215\316\fU;5\302\266\247q5\355k\226\276\306\345"
+	.string	"(?}+\303\3615\367J\345\020:\346\213-\316M\273\\\234\316?\330\377+"
+	.string	"P\344\b\027\026\252z\034\352l\274M{\234\303\351\030=N\375/\2723\330qg\300K\033R\\\256j\247Wl\243ll\243\335\353\027\221\377?\2037?\322Jgu\236\373P\367"
+	.ascii	"O\275\301\247-\241\371?D\226c\217X)\346@\325\356\026\372\376"
+	.ascii	"\372\207{~~d\314\334\202\343\261\266d\317\374<\f<\263\307\307"
+	.ascii	"\363VR\225\037\375\371\375\215[I\025\361,#\343Y\206{o\224\341"
+	.ascii	"\3779\331\213\311\212\260\307\314\255d\314\224\223=o|\370\231"
+	.ascii	"E\036\254QN\306_\344d/f\026\223\261q+\331#D\356\272\361\242\255"
+	.ascii	"h\305\303b\343\3078j\025\221\001n[\025\374\020\340\r\n;\370\270"
+	.ascii	"mU\360C\001\250\366%\256\030A\240\037<\r\207\030~\274\022#\230"
+	.ascii	"\332'\024@\241\006b\007\022D\007\275\024t[a\333\304\266\205#"
+	.ascii	"\tGHU9\215\2244!i\302\332HI>_\322\221\217\355#_\372\266SQ\202"
+	.ascii	"\001o;\025\275RQ\257\324\360\007E\025eDt\333\251\240\313$\324"
+	.ascii	"\303\250\3265z\207C\327H\300\373\313!6\001I\f\203+\361\327\024"
+	.ascii	"L!\034*M\265\031\210OR!\334\366\025\266J\275\366\005\212\200"
+	.ascii	"\242\n\2413\3252\245\357\357\310\307\252h\335\024?\"\021\030"
+	.ascii	"E5|\372\021\3701\265P.P(\365\013\272o\317\373Cz\205A\251\234"
+	.ascii	"\366\371\224\204J\200\340\300.\025\271\355\0335\\\n\272\357\217"
+	.ascii	"8\234r[\242\321\353\324\024|Ja$\f\002\241\214\226\\\242Q\221"
+	.ascii	"\003\245\327\005\276#\232\204A&\027H\345\0167<\265B!\320i)\250"
+	.ascii	"\273Q\230N"
+	.string	"-\273\001\204\2139\353\310\220\321%\243O4\035\340f3T\265\263s: 9u\0132#\313\327\277r(MB\227\006KM]\235\323\005\200\200\250a(f\024R\206\020$\230\031\241\231\021\027\033`\002\221)\264u\021PE\202*\250m\322\236\001\027Gb\277:\377;(\202\267\243\266\227\332\211\213\343(1\317\034\024\240M\317uy\006\333\275Ox\275CPQ\r\365J\315P\304@\264\207\007hLd;\314\237UF\377[g$\313x3\022%\021R\"\220mE\020\330\t\371\353\204\300\311\277\023\236]\377 \207\262\315\254?\032n\222T\027\337\216Z\376\224^E@\022c\035\024\344*\005\307+\005\211\232-DL\2415t\230a-}\202\372Aj\235\340O\362)\200\037\270D\300k\t|\243x>Z\322P\377\315\266]\317l\200\034\013\335\366\020\357\243\207\034\025Pmb\215`\216\355\370roL4\3527$"
+	.ascii	"\317W\310A\2637\302\t\017\214\242rh\361\360?\315\313\253\216"
+	.ascii	"\001Kr\351$\344\314\300\017\301d\357\\\332\353K\220\020X\f}d"
+	.ascii	"\247\360\355\033\2166\371\006\317\351,\253S\036\202)\203?v\353"
+	.ascii	"\275\f[t\006\337E\272|\002\377\001"
+	.text
+	.section	.gnu.lto_.symtab.c39a6a480793e0d0,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c39a6a480793e0d0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
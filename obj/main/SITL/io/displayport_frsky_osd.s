@@ -0,0 +1,1886 @@
+	.file	"displayport_frsky_osd.c"
+	.section	.gnu.lto_.profile.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\265\t"
+	.string	"\004\017\240\001"
+	.string	"9"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\003\004\200\314\324\344\b"
+	.string	"\005\234\315\322\307\005\006\002"
+	.string	"\002\001\002\002\006\203\214\247\213\n\007\312\336\235\231\b"
+	.string	"\b\t\335\231\366\261\006"
+	.string	"\n\324\206\222\355\017"
+	.string	"\013\f\330\267\334\237\t"
+	.string	"\r\016\227\232\363\377\r"
+	.string	"\017\020\021\022\023\024\025\026\027\030\031\313\211\332\263\016"
+	.string	"\032\244\210\203\377\t"
+	.string	"\033\212\355\300\270\007"
+	.string	"\034\307\373\372\231\016"
+	.string	"\035\036\037 !\"#$%\307\356\346\263\017"
+	.string	"&\374\363\3124"
+	.string	"'\365\315\257\266\017"
+	.string	"()*+\337\353\247\276\n"
+	.string	",\310\225\313\200\002"
+	.string	"-\334\317\222\204\002"
+	.string	".\341\345\355$"
+	.string	"/\354\310\222\225\003"
+	.string	"0\242\363\323\343\n"
+	.string	"12\221\253\237\330\013"
+	.string	"3\264\233\356\375\t\004\002\003\0024\217\215\236\360\001"
+	.string	"5\307\374\223\201\016"
+	.string	"6\240\342\234\212\n7\273\266\332\202\0018\367\202\306\263\007"
+	.string	""
+	.string	"\037"
+	.string	"wbi\352(]\030\002\306\2552\030\306]a00D5\216d\006\003C`\334\3460\034\306ya00De\334V\203\201!`\034\030\f\f\2412\270Q\203\003\243V\031\312n0\030\007\006S\031\262"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.ipa_sra.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`_\004e\n"
+	.string	"\242\013$&\020\317$\035O"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"P\371`?\360`?p\024'I\222$\211iPHl\244\221F\310\3362\005\377\267x\266\242\367|B\032\177]\264\211\022G\364,\304C\035\334\277\214\206L\206\351\037\306\002\216\247BO\350-\302\001\032\\@\220}\r\bd"
+	.string	"@\250\217\240\217\247\303\331\270Wi\334\252X\2172\230\274XZ\245Q&\222\b\005Ye\017G?\352\263\376\352g\324\366\032}\304\346\324\357\217N\352m\310Vb\263M\335)f\026\001a\250a\3059\264\225\255\003\360\002\231\251m\033\022\340s,\006u\034\222D!G$\020\211*\242\274\236\003\322\220\021Q$>\251\272\201\025K\214\341|pP\002\023\025Q8\204\250c\244\350\354^\357L\321\264\035\347z\326S\343n$\032\036F\377\262\270\021\347pp<s\252\255t"
+	.ascii	"\004\335}PI\007\016\223D\327\323)T\377\237\364\3058\344\025J"
+	.ascii	"&\021~7\\A\240\301\277\343yv.h\fL\020\026\r\237\357V\356\223"
+	.ascii	"\235&\005\0049_\253\362&\312&\254\017\314\242GX\263\210\261@"
+	.ascii	"\267\203\355\370\354xr!\335\035G\203km\"pU\314\207\362\321\""
+	.ascii	"\270kyr?z\371"
+	.text
+	.section	.gnu.lto_.inline.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\310\n\325\022"
+	.string	"6\224D9@\345&\035\303\030W\201\346\327=\347\243\333:&,\201\341\343\361\\SZQ\263P{\3240\306\325\235?\013.\220@\202h\320A\002\t$\220\2225#F\354&\233l)S\n0"
+	.string	"7"
+	.string	"4"
+	.string	"\334\245'\313\032w\r\351hw)o\242\365\220>W\251\247\335\335\330 \025\251\314\356Z\246\236\346\355\204v\313\356\272\330i\177\313\335]\265M\3141\005\272\321\240\244\362U\236\372t]\327=\203\206\211r\3473H\345\312S"
+	.string	"\273\333\261B\002\302\201A\001\301\200"
+	.string	"\366y\266=\224(\243=\035h\033\253D9\2728\3268k\001\311r%\355\356\345\r\215\214\354O\214M\376\277P\333\235go\nU5-*(&$\" \036\0344\033b^O\363\227\376\030\236\276s\013\3268\312\366\007\332[\346d\r)\300\214\345\223\022o\231~\031"
+	.ascii	"\023c\231D\343hD$\004\344\231\037\317?\365\310(`w+w(\307\021"
+	.ascii	"1\307\224LcV\321\313*\375\246\177\273\375\fZ\001\200\223\250"
+	.ascii	"\361p\307Dk\310\260g\220\002\021!\242\252\007\022 \3634\001H"
+	.ascii	"q\004\030\001QD@\004JH\220\2008\203\204+\301\234\251\333\001"
+	.ascii	"\262\302$kX\001\361)\253\273~!\360\324\252\nBg%\376\222sB\226"
+	.ascii	"S4\373\026\361+\246q\213\376tyi\325$\352%\302\212\007i\301\254"
+	.ascii	"\031K\370O\242\270\256\245\322\321K\245\020p\316\211}\323\255"
+	.ascii	"?#y\027d\344\241\220\030080\341D\222\212\230T\360ER\030\237L"
+	.ascii	"\227\033\241\304\325,y\221U\255F\321MJ{%\026\367D\023\363\224"
+	.ascii	"?\307\252n\263\275T\022F\fX\\\242\343gm\232\353\n\013\244\004"
+	.ascii	"zM\314\332 \333\036\367\202\367\264\t\342\312,\267\364\320\277"
+	.ascii	"\013\207\246Y\367,<\230\\\360\352\300\265c\351\3720\273O\324"
+	.ascii	"\r\342\301\016.\365<@ZE^\020\260\365\347U\030\340F\363\273\252"
+	.ascii	"P\210\201\346\275\266 a6N\301\023\3517\230\216?E\202\240\326"
+	.ascii	"\263\330\342!\212 *\223\363\321\024KD #V\n\256e\324P\354;\223"
+	.ascii	"\214\263\013\220\323QE\017\274i\253\301i\004\215\036\236]\356"
+	.ascii	"h\037\345v_\202\340\201\022\345*\355P\231)\233\023V(@\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\021\t\265\021"
+	.string	"\306\224A5p\305I\007\374\307\376\377_\250\240i\006\342\376\377_\317\375\007\367\362\377\253\203\326\252\300?\242\377\221\215\007\376a\017\374\003\277\261\273[S\353\335\244\021\262\267\334)\245-"
+	.string	"5"
+	.string	"7"
+	.ascii	"\0363I\2441L\\\211\216\343q\344 O\304\310]\331^\223\023\037\271"
+	.ascii	"\375J\366\037R\035\265\356\365s\331g\016q\271\033\337\332\035"
+	.ascii	"\320\211\005/\264P\277\003\266\001\257'=C\n\365s\364\244\242"
+	.ascii	"\204\372\271ju\325\356\225\367\024=\331\223\312x\032\302\201"
+	.ascii	"\001\246\240\271\350b\251P&\024\2564\202j\004Y\222\260\232Vk"
+	.ascii	"\332\307~\205<!\rA\006V\355=\312-m0Z\267\231\236xQ"
+	.string	"\264\250`\025\323\324\177<\375:\373\024\2159\344\t\211\210\0061y(\365\036s\31040\324\001-\365\336{.\346\004\332\265\314iw\002\033\344\313W\272\323\354N\273[\300\362\325Z\001\370\307\213w\200\026\001\264\362wp\02470\321\037\352F\r?\007\200\211\250pT\315H\222\2445\240\002\231\241\242q\003\022\3401q\024\3029\034S\212\004#\001\305H(\022\210H \211\222\302\r\340\201!\320\3743\241\367\256\t\343\275\b\351\"\375\2603\366\265+)\321\324\347\366\016\261\\\323\354a\345\240\354- \323\235\215\267rn\326\003b`O\230|\246\035/5\256qVk\006\221\246\355\334\027~\266X&{\016\240J\365\242h\241\024 G+\220\322t\232\251\265\235a\"\247\t\374\200\2430\326\305<L\375\027/\311%n\224@^\361\n\314\221B(\362\r\251\361\3248\fF8\244\222\032\255zd\241\321\212^W`t"
+	.string	"\374\210p\316'x1\221\0321c6V\005\226\205\265\371F\3237\302e\272\030\224S\301c\306\374\334\026\355p\215p\350\021v\f\221"
+	.ascii	"\214\270\322\276>ZOm\264\350\330\371$`eP\362\001V\250\020k\002"
+	.ascii	"2FB/B\0046\232\203\277B)\2431\347P\217\240\030N,J\336K\261\345"
+	.ascii	"\326u\037t\376>'X\222\245U\033\240X\351\343\030\264U\346\232"
+	.ascii	"\214I\bf\276'\331_\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375 \246\255\003"
+	.string	"bJ\034\0370\205\265\006\200\366\300\302"
+	.string	"\r\f\f\f\f\f\f\244\305\b\245\224RJ\322RJ)\005\344h2\032\200\313<\346\006\363\227\273\274\345,_\271\312S\216\362\223\233\274\344$\037\271\310C\016\362\217{\274\343\034\337\270\3063\216\361\213[\\\363\212S|\342\022\2178\304\037\356\360\2063|\341\nO8\302\017n\360\202\033\301\247o\340\023\370\002>7s\316\005\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\b\002\235\007"
+	.string	"\362H\"/pU\222\016\300\376\377\377\303\240\323\377\377\177\367\377\377\377\037\352\240\265\326Zk\351\377\377\377\377?\217\347\333\326&\266u\035\333\3266\322Z#r\247\237\360\3015\370\313\312Mk\302.\013J\220\003\002\001\005(\221\256\024\332Q\212B\240~<O\035\316o\243i&R\230KZ*W\224\311_i\331\303$\221\207\220\207\243q1\250\205\002&\020\177\337\341\032,x\214\215WnV\347\346>\317\263v\254Y\330\225\232^3G\270\013\001@\250ah\265\254i\317"
+	.string	"\003!\333\346\020 #\0201g\223cP\b\332\322\217*J\2168/\224\002\254Z\306\345\312\367\321\211\033\266`\213dW\307\356B\r\363\351\225\371\024g8j\342&l\365^\2211"
+	.ascii	"\032\221\214\246\036\245`#\345\023\021d/z\016@$'\035\326\264"
+	.ascii	"\310\260\300M\323W\265A\341xV0z7\003"
+	.text
+	.section	.gnu.lto_.lto.346a08eda05aec2a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_grab.4.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"M\007"
+	.string	"\342\31526Pm\222\016$\243\252\214*\271J\2705%\247,\316\250\2116\216U\230\231\335\250vl\022\006b\274\031\366\3174\262`m*\001\325\003)\2720N\323\342\267\337\210L\001#\370\030\256?\033\020\366:\244\007\f:tF\360\211H\036\b\021\026\002\271\027r\022!O\204\373@\314m\016~\242\006\350F\357Aw\305\354#TCQU|,\265J\343{\311\n\365\355\332\030h\311\274haI\025\013\305\343\317\376\372\333\276!\025\311\032'\032\220\211\"9\311\214\t+dj\0353\377\375(H\366)\227\330qZ(\261H\255d\246\323\224"
+	.string	"S\353R\001L\255\212\243Y[v;\322\202\224\211\351Tj\003\340d\346\315t\302\350U\177\203\237\363g\004\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_release.5.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\342\21525@\215\222\016<\314\315\n\002\356\177\207n\241j9\225\241\272#\230\200\0265\242\2255\376Y\f\025,V\370\232\215q\203h\236S.\233\300\t~\006l\003\3557\"S$\370\0262\2038!\354yJ\016\030l\360\220\340\033\225>\017#L\024rO\344\"D\037\b\007\202\230\343\030\374F\f\320\221\336\203.\023\263\177\320\315\204E\361\321\324,\215\257%\255\324\267\200\nMJ\346\305j%Q\256\222\216?\373\314\337\366\005iH\326(Q\201\314\324\bIfD8\001\323\353\210\371\257G?\2627\261D\016\224\302\211\205J%3\335\246\232K/K\007.\275\254\215fm\331\255H\tT\253\023\312\324\006\320\311\314\333\t\205\321\255\376\005\177\347\317\b\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_clearScreen.6.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\335\b"
+	.string	"V\220=:@\345&\035\340\245\013\301\365\305\n\016\375\023jY\217\356O\210\003\377L7\251\033#\220\221\315!\354H\213\332U\324\332pg\341d\n\361\r\300b\262\277\007 j\263\226\220\275S\n,"
+	.string	","
+	.string	"-"
+	.string	"3\036-"
+	.string	"vW\032\274\243\371e\235@\363+\222\334;\364\374\263\374\300eU2}\207\033\207\3355,\231@\356x\333\b\266!l\243\0026f\033\302\257dX\002\313!\022\362ph?\345*\336\253\306\007vO\250\227\335\272`\006\316/W\216m\377\344(\236\035c\325\022SCX\335\333\n\277H\2516\"\311\027\2641:\370\222;2*R\374\354\372\3018b\337\332x\262c@GAj\367c\025`U\027\214\211m/\333hf\23467\034\235\021\230C\036\3216?\035\305F'>\034\235Z\007\252\320\266L$g&G\031\310B\206\350&=\t\236\232\004\225\334\234T\006\r"
+	.ascii	"\3043\241L\213`\330X\205\354\232\310e!>\026d\022\262\004#\004"
+	.ascii	"*\034\3345R\255t\204I\006"
+	.text
+	.section	.gnu.lto_drawScreen.7.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\215\007"
+	.string	"\342\31656Pm\323\001\220\210\230\201\235\272\210\244\372@"
+	.string	"M\342\347\231\352\037ZE\323\215\240\353\330\272\243\233\247af\377L#\013\326\016g\300\270s\252\334\020\257<7\261{\247\024\030\235\013\224;\030\31757\231\303E\0336\030\235V\306y\260\256\312#g%#*\016\204\354\320Kb\f<-\006*\2619\251\244\352~\233$>\257\"~,A{\"\203\357|A\361>\221\263+\007\343\310~ew\327QdG\004\213\201\222]\320\227\262\236D\262a[\263)\333\020\332\347x\207v\017\212\007\354\212DFv\353\2013\226K\256\277L\227,\027\230.\331vBF\363\366\252\001R8\271"
+	.string	"1\331\2552f|;\334\374\177\234 \344\353B\334!\200fw\r\273\020\306\035o\273\300\266\306\366(\b"
+	.ascii	"\3043\241L\213`Xk\330\222\020\234\\\363\317\034\302t\256I\006"
+	.text
+	.section	.gnu.lto_screenSize.8.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"5\t"
+	.string	"\366Q@9@\305(\035\365\245\273%\341\241v\266\013~\005\005\255\245\372\353\304\200\200\251\274\321\322Z"
+	.string	"{G\013\265\007\216\031k\272;'\313B\001|\013\262\037\346%\270\313'\204\020)S\n/"
+	.string	"0"
+	.string	","
+	.string	"\237\007*\353\274\223I\200\335\205\231\023`\277\254\017`\277\264\343\334\223\363_\362\353\002\003\200\207*=3\316\356:=\224\305\255\267\255\261\315\261\335\022\376\005\323`)P\331\255X\t\330\225\013\345\3036gcl?\355\217\234\204\3737q\201\335T\312\311\356g\340\203\313/\177\027\333~\310E8[e\005\372\323"
+	.string	"S\256\234zU\265T\024 ]\256 R\237\201\245\035!\221\367\256\b\033\235\226\354\257\224\312a\337ZM\331\232\3162\255\231\316\314#-&`\374\331\200\266\330!1l\332Bg\244E\021\311\323 \332B \030C\360!\344q\200\037m\203\033\215\243HA\203\243\0305\210\371\366v\246\031\223vV\315\002\r"
+	.ascii	"\3043\241L\2130,a\b\002N\3244\202fc.\344'\231\275\022\214=h\367"
+	.ascii	"II1]\223\f"
+	.text
+	.section	.gnu.lto_writeString.9.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"m\013"
+	.string	"\206\225NB \213*\035\247H \0309R(\324C\243\325\273\025\217+"
+	.string	"\003\036FQt1\232|y\271\277\341\207\233P\204< \357\270\tw+dH3\233\240\001\340\336)>a\354\336j\370\016\243H#d\313\235R:"
+	.string	"?"
+	.string	"5"
+	.string	"\234m_\302'\210v\2079:HMH\nL\027D\354ng\271\305vm\276b\273\246\r.^\212\3763|FP\2058\245D\227\023\216\335\265<\245\022\334z\333\027\333!\366G\0023\331\3064\016\020l\2136\305\366|\025\270\250,\002\013\032@0<\370p\205^Y\322\007\224\207J{##\276\025\262\356.\220u\\\332g\275\202\370\361\300)vW\260\r\273\243\2063\3345\217\001W\2516\001P\376dKIE\236*\365\252W\t\025\b\323\210\221\234\331\243H*\003\373sw\327\272\262\377\372\267\267\376y\327\257\232\264\324\244\317m,\017\030\260]T\340\2770\334L\320\r<\374<\021\2129\230\016\350i@"
+	.string	"\300\257D\023~\336\007\264\t\360\001=\235\316\363t\003<\033\001\035\347\003;\314\305\336\207\344\353B\317\373:\312\270\2673>Q\242\020\033)\311\234\3344\024"
+	.string	"\3043\241L\2130\314U\b\004\314\001\3245[n!\306\241D0\b\340\007\006\003\203"
+	.string	"\234\3010>\003"
+	.ascii	"#\004*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeChar.10.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"m\013"
+	.string	"6\025MB \251*\035/\3071\004\266\322\315q\301\263\264\005\277\017\006\230\002\t\270^c\001\253 \273\226\025Z\303\013/\300\b\006\2203\334\r\214\001\262L\364\335\002"
+	.string	"z\247}\3028\202\031'}\252}B\266\334)\0058"
+	.string	">"
+	.string	"4"
+	.string	"\266}\002/ \332\r\346\330RYL\001P\007(\354.\227\271\304vm>b\273\246"
+	.string	".^\212\376\023|\016X\315R*\322\245\345bw-S\252\224[o[c\233\303~\027\020&\034\354\242\314,\254Lc \300\266hc\354\230k\003AK\0036\372\303\232\"\234d\250\264-8\342_#\353\256J\005\214K\373\256\033\020?\232\034b\227\245`\301\356Xa\316\345\232\307KW\251\2526H\"\237r\346\244$o\252\232J\375\324k\303j\002\352BI\316\354\221$u\305\376\\e\331\177\375\333a\277\366\330?\247\264Ni\251\322g\330$\004\335\2770\364L\321K\036~^\007\306\335\346\003z\035\021\b\370}t\302\317\013\211<!!\020\364\341<\0207\002\362\210p\335\007r\033\215\275\220\307\307\205\236\367q\230qoS\334\341\364@VR\223-2\027"
+	.ascii	"\3043\241L\2130\214`\b\304\205<0\007pM\224\215\215\r7\001\202"
+	.ascii	"\"`\034\030\030\340\002\306\201\201\001\036\301\b>\303\202\271"
+	.ascii	"\002\025\016\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_isTransferInProgress.11.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\007"
+	.string	"\002\21635Po\322\030 [\211H\311{\211\227\263\005\0018\273\220\324H\364w\317F\rA\324\007\2623\013\232y\324{W#6\033\336\213#\013\254\\\234\373\262YH$[\246\233\214\f\327\037\rH\213\235\320\203&\035:\233\214Y\310\003\221i\030\bF\fJ`\236\b\370\221\032\324\034\034\263\006\t\267\030%\274\346jg\025PP\243\237\242Ge\274\002\354\356N\231\376-\234ZX\bPvI/.{\252L8~\356\257\377\275\327\017\005\3414dB\003vM+%\2733\341MF\253\247\016XZeT\300\322\352_a\303\335\351\334 aF\036\025#-\273\023R\032\332\351\353V\025Q\203\216\223\024\025\222\222H\037\206\263\273?\213\322\205N\351\217\360s~\214\b"
+	.ascii	"\3043\241L\213`\370\250\260X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_redraw.13.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"u\007"
+	.string	"\202\21645PO\323\001 [nU\300\261J\256^X\030\213vxMQ\215\322L\026\0331\273\267\315\355\320t0\266\265Y\022\366V\343\302\250B\226DVT\330f\273\355\235R\027\235\n\223;\031\21757X\203E\0316\027\235\025\306q\250,\312#'%!(\316\203\354PKf\f<\253\005*\2579\251\234\352>Z\3109\341\243\233\200\037G\317\306\"\3367\277\222\216\356\0035\273j\017b\330\217vw\r9\033J\036*\004\241\335\212P\313v1\205c\262\375g\037\344!\331E$\036\260\313\231\240\354\326\003#`\036]?py\304\\\340\362\350\314^y\335X\351\342\204\202\204ew%\324x\366\227\371\0379\300\006\322\376$\315\356\372m \213\033\336v\201m\215\355\214\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_heartbeat.14.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"]\007"
+	.string	"\022N35`m\322\001@\203"
+	.string	"3R\033\353^\356\233v2\330Kn\360\311\t5\fY\273\206\223\354\313\236\b\017\324\272.\013d\335Nm6\215\311\036"
+	.string	"\334m\322\366\336;\245\330\224\006\224?\033\320%;\241\204k\"t\260)\255\220G\301\272*P\224Ud\250<\013\3613\257\270\321XZ\0073bR\316H\325\275=\360\214\203\033\331U\324\034\205\375\267\256d\267\211\004E\340c\027bEeO\240\310\205mjS\266\337\354o\234\203\2766\034\263[\002\t\331\255\004.\270\034\272^l\373\031\327\240\366\310\253\026\33142y\360H\331\335\230y\200\345\360\035\300r\350*N\337\250\377\216?\f\211\022R&z\2338\273\353F\312\"nw\333\032\333\034\333\023\001\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\246X\210\022L\020p\342I\265b\022&"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_txBytesFree.15.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\235\007"
+	.string	"\202N56Po\322\001 v\273\032 b\342\206\223e\002\3112\303\374\323:>@\030\033\202\250\017dg\0264\363\250\367\256Fl9\210\213\225C\225fA\001c\032\"\204\354\235R\332\224\r\226=\232O&9 \210l>p\264)1P'\002\313\256O\224W\234\270:\022\3213\263\250A\260\304\034f\324\244\234\321\242{[\240\326Z\317U\231\nha\323\320\203\034\366\247\205#\3731h\224Z\f\\v3\352\313\246P(\036\2667\333\262\375\236}\221\217l\247\024\037\330\035\255\234\354R\005/`N\231bl\373 \017\331\314M\264\243\013\020\261\\\224\224vi\314\274\240:5\235\240:\005I\347\3768\377$?\370x\021\251\230t\241?\200\315\356\372at\0337\274\355\004\333\033\333\244\n"
+	.ascii	"\3043\241L\213`\230\245\202uM\244b\201K0A\300\t#\325\312K\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_writeFontCharacter.16.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"-\n"
+	.string	"\266SH> \247j:\007\213"
+	.string	"d\003\340\t \236"
+	.string	"\373\270iX\0019\210\002\357\020\200`\033\316\033[\263M\031\214\344\200\331\201\2460!\n0\020\264\275\024:@\253\242\251\0013\225\371\234\236\032\3312\2454"
+	.string	"9"
+	.string	"2"
+	.string	"\332\263\355\b\3323\333n\320\220\016\275\fAMH\tL.\004\273%7A\036\272\206\374\273\216\215x\274N)\321u\362\260\273\326S\252\343\236\267\215\261\035a\237\022/\005[ \033 b\233\264+\266\263\026\206\202eK\001V\020Xy"
+	.string	"\344Y \265l\211\264\341\260=\263\250\252}\222\257\310\227d\374`WE@\300n\311`\315\366\314\345\023\002$S\024\233\237vx\241?i\363\2421E\326\371y\323\202\221\276\354R\244\363\303>\266\273\353\251\262\255\326\336\372\261\263~\325\324\237\030p\030X8\260\213\n\342\2047\305\357\3530\216\327\351>c\007\334\354e\2761\334\200(FQb\363\021C\017\250\253\360\214\340\307\205 \327\001;\013\316\023G.\203q\350\341\210\334'\fE\256R\356\255\315\313h\006\r"
+	.ascii	"2\003\3020\021\341\352r\315\336\231\020A\2110\222\204\270@\370"
+	.ascii	"L\215\202\313\222\246&\232\256\371\004"
+	.text
+	.section	.gnu.lto_checkReady.17.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"\305\013"
+	.string	"\246\326RA \217\232\016\220\277%\007\300\231\232)\325K\305\027$\354Y\tZ\200\013L\200hGYJ\364\243\377\265>1`\243\225\225]\f\263tF@"
+	.string	"4\320\007"
+	.string	"z\350N\022\200\034\360\304\260z\255\033\2212\245@"
+	.string	"@"
+	.string	"="
+	.string	"\266\235\300\243c\356\021D\n\306\304;!\021\332\215\224~8\367H\223\3633\337\310#\250\341\032)0\tq\020\360\225D\001^N\\\016z\242|]&\346cw\235\336\227\341\226n\233\201\355\006\3669\002\377\364\370K\351g\036\210\b\305@\260b7\245\006\215m\221R\204\260\335\2617lk>r\006.\303\205\212\212\005\231\366U>\242\363\017\206\017\330\365\230`\331\215\034\366\200\227\034_`\272\004O`\272\024\251(\352\017\022\355\""
+	.string	"9\251\235U\310{P#\267`\371tPs\323\025\302\312\213\222|\361\224\266\205\013y\357z\320\241\013\212\226\0310:\035\261c\227\352\301~\264\273k\365\330N\303\177\002Xem\032m\322XX\305\331\260\013\332\352\b\3312\020\021\t\233\026\001\204\243e\033\221j\302f\273B\250\354\242\260\253\242@Y\332Fu\034p\266\321h\024'\3134j#\222\\=>\350\016Xl(q\"\277r+\324\020"
+	.ascii	"]\b\270\323i{\204\312\302^C5\005\274\262\356\265\032\326\323"
+	.ascii	"\005\335\274\233\312\3261\202\034\270[\200\262\323T{40\265\007"
+	.text
+	.section	.gnu.lto_beginTransaction.18.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\204\001\325\016"
+	.string	"6\334bC\020q\224\016\030\034,C\021\250[:\274\216\337\233UL\223"
+	.string	"\340\301\377o\223\2171\200l\374\037\226\325\372\277\217\257\027\345\034\323\027\324/"
+	.string	"T!\300\243\n\025p`\214\344 \322\306\351\200\237\220\275\267\224)\005L"
+	.string	"O"
+	.string	"N"
+	.string	"\235\002/\310\016\335\275@<\314N \036:d\277\274KY,\005\242\304\272\261\273\232\216x\350\021>\315\220\217\211`L'\321\243\207C\r\031\362\241\\\003\234H\317cw\317z\236\234F\231\230\310\356:M\247\0167v\333&\266\037\330g\tv|\313\017\337W\267\276t\276\3641"
+	.string	"h\2748`cw\303+\307\272\240K\211\257~\373g\271\303\366\n\224\2118d.,\0222v\273\004\207n`gw\226\320[,<\001K\022\241b\220\035z\274\247}\023?\021\372\312\205\017\330E\271`\261\033\316\0253\\$\025EM\251\270jT\0043J(\243|AM\371*\255\025\375A1SZ!\322\007E\325\223\024\317L\rQ\305x\232\312\335\025\351?\3425\002\n\030\244\304\341\377#B\275\206\250Z\224>\214\362ew\242\324\224\375\267\273kE\005\334\247\003\001\303}:\333+\321p2\037\216\263\311\254\001!\341\266\021\220\t\347\2210\362\361l\035PfB\207\333\220h\333F\343l2\0244\215\207\323@\fx\353\224x\264\317\266y\264\216n\377VQ>\353\030\225\326\013\214\352\367T\237\203\032.\f:2\226Om\256B\336\024\037"
+	.string	"\202O\211E\205\336@BP\214\201\311X\227\016\373\233\302\016\320\034x\002\b\372\253\036Ruu]\200<\254\307\005W\213\225\242\354\021L3\212~X\302\272`}\246PAci\n\265p\215"
+	.ascii	"\fAq \013`FQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_commitTransaction.19.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"u\007"
+	.string	"\302N55`M\323\001@\203\007\322\032\322\260\305\373\021\321\305\243P\r\005a\310]\373\215\217a\332\r=\022{\265i\004$+\301\3461\234\b\206\332\024,\215f\326\332\336)\005\031\312\2322\314\252\"S\026\fF/Z\003V\031.Y\245\22769\\X\205\231\264\232V5=L\252b\323R`ze\352\314(\255S\002\367\317\312\317\013\025\241\204\324\370\211\266\006\021\3379zx\241Fr6\310E\311\261\377\354\356Z~\266\2246\"\006$\273\024'&\033B \031\222\355G\373\235kl\337\210x\300\356\027\362\261\013\036\030!:d\360\003\224C\321\005(\207\274\331#\0071\266\302\351Lt\224\354\356\224\027\337\0367\377\034\007\350<\356\261\242\260\273\216\235\267\271\345m\023\330N\260m\021\b"
+	.string	"2\241U/p\270\340"
+	.ascii	"\346]\002hVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_setStrokeColor.21.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`E\001\205\f"
+	.string	"\326\326Q@ q\232\016\034\201\305g\214\261\351\202a!\031\344gI\230\211c\305\032\3004aWd7dZ\327\334 \204\331\376\217\330u\333h\200D\021<\003\001\024\372\312(\025h>Kd\265-\331[\312\224\002="
+	.string	"@"
+	.string	"<"
+	.string	"\320at\003\320\241/{\345\\\210\265\230\304\310\220\202\306\356N\n\342\327\237\346\345\037\345"
+	.string	"\264\315\363w\331:\\\245\r{\230\335\025\260e\231\026\006\273\353\3246\0167\274\355\006\266\035\330'\021%\366KCM\353O\376\204$\031/40v7t6\366\003[\214\260}\311vrGq\375\304\302#\260\331\007\021\034\321!\346=\355\227\270\211\353'.\274\300n\211\n\213]N\201\027D\207\346~ P\355\tV^\363Q~Iq\361\311\324\223\262\342\251\260)\330+\251m\202\303\347\215\334]\217>\003\251\252J\2265<\240\353\272\356\031(U\325\211\301\003\226\235\315a\251&\366\337\356\2565U\374\210\033hQ\025B(\216"
+	.string	"\336h<\254\3301\"\301\252\"t\210T\2613B}t,\216\307\0249S\b\207\002\2316\2255i\0208v T\223H\214\325$q$\327T\277\364A \250\032\036\314\370\220(\346(\003\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setFillColor.22.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`E\001u\f"
+	.string	"\326VQ? \217\232\016\343\017\220\t\300\365\005\200\004\3622\241{"
+	.string	"-\300)c\324\tGx\245Z\362M\375*\375k\336\026\324q\033M\027\bR\301\220\252\302\301lD\230D\266\365Y\214\330\226\354-eJ\001="
+	.string	"@"
+	.string	"<"
+	.string	"\317\037\364\002\317\237+\273\345Z\210\305\244\270`@\021cw\241\202xu\247Y\371_\271\006\226q\35662\016\327(\263\034\307\356\006\310\256L\314\202\335ub\331\206\373\3356\003\333\r\354\217\b(\266K?M\353U\376|\242\0310\340\213]\r\233\214\355<\026\"l?\262\235\332OTW\251\340\006\354\365\301\303\007\364\307\341\236\366I\274Du\023\026N`\027\245\305\212]-\201\025@\177\326n Om\tT\036\363W\276\301\362\322\271\224\303\242\302\245\260'\330-\211-\202\277\347K\356.G\337\361\250\252\213+],`\333\266\355\035O\252\252\363B\007+7[\263RS\354\273\335]kS\024\211\231GI\024H\244\017"
+	.string	"\316x\204P\021\304$\0025A"
+	.string	")\231\342\306D\022\331P\232\020\0305\220D#\215\300\314DA\217\003\216\233\007\023,\211q\202\221vrM\265K\177\344y\232\301\301\3269Q\313P\006\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setStrokeAndFillColor.23.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`E\001\225\f"
+	.string	"\326VR@\020q\233\016<\002H\b\200\227D\3328\266S\0203\020\244\201W\322\340\004\326d\200|A\204L\353\277V\324\3256\252\333\232\266A\004\024 \200\016t\022d\316\027\240\312\177\274\336\377iK\366\2262\245="
+	.string	"A"
+	.string	"="
+	.string	"\321\241\364\002\321\241/{\345\\\211\265\240h\310\320\002\307\356N\212\362\353O\363\362\257r"
+	.string	"\332\006\372\273l\036\256\230\r{\232\335\315lY\246\205\301\356:\265\255\303\ro\273\201m\007\366O\004'\366KCM\353S\376\2142 l,\240\261\313\241\323\261!8\303\204\355cl'w\026\327S,\274\001\233\215@\341!\035j\336\323~\212\253\270\276\342\302\t\354\236\334\220\261\313%\260\002\351\320\334\r\004P\355\tV^\363U~\211\361!\224)\b\306\213\347\302\246`\257\244\266\b\016\237;rwA\372M\244\2525\262\314a\001]\327u\337D\251\252N\f\"\260\354l\016K%a\377\355\356Z\003U\f\211\035hQ\025F(\217"
+	.string	"\356p@\254\370Q\"\301\252\"|\220T\361SB\205|,\017\310\024=\323\210\207\022\231:\2255q\0168~ T\023I\214\325\204\341L\256\251~\351\213DP7<\b\0212Q\314R\006\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setColorInversion.24.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"5\t"
+	.string	"\346\321A90\257\322\001'\0362fIl\032\354\210\352\244\203\2771\304v$C\030\025e\232\305\036\320\331G"
+	.string	"\252\3210\266\254p W\212z\354l\264\241e\022\007[sE%m\313\224\002."
+	.string	"2"
+	.string	"/"
+	.string	"\232o\234\027h\2769\264]>=v\023{\261L^vW\306\330\303k\350\277\344"
+	.string	"-\227\352\272q\330]k\313\305q\307\333N\260\375`[%!+\r'\273\0335\230\245m)\037\266\337\261\035\325f\370\204\237\027\237\007\257\231l\006\272\332\227}$<\t\306\tva-(\273s\301\037\3167\317\033\004\231\2150C\210\320V1\303\032}\264+,\364-#hD\2255>\006\200\260\260bVZ\263\247Jc\207\375\314\356\256#\314\376\3745\252\277\r\004#\322\351#\241J\035\007\344P%\016$`\221g\004z\241\224\004\370E\204N\237gJq\023&\260\033I\257\223\245\216\243\220\242\017\224\036\005{&\322'O\236\367\311\316\334\007\n"
+	.string	"\3043\241\214i\3553\034\234-u\r\235\ns\301\211"
+	.ascii	"e\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_setPixel.25.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\223\001\365\r"
+	.string	"\266\331ZB \217\223\016\344\020x\201\264\201\312U\215\373p\177\360a}\200F\004}\031\001\214#\354\221O3dqP\357E\250v\177Q\343\354UB`\241\323\r\205\306\3059\0370\301\025\237\337\255m#do)S\nE"
+	.string	"J"
+	.string	"C"
+	.string	"\234\207\017d\016\315\235@u\230\371\200\352\320\232\035s\016\304Z*\035,\234\210\261\273\227\252\\\373\323\324\374\237\256)m\242\277\315\266\341\312\331F\217cw76R\246\225`w\235\245M\303\ro[\201\355\006\366S\001\207_\371\337K\353[\376\314l\264\200\201\340\264\233\241\223\261(\270\"\204\355slkKH\004\003\026\303\274"
+	.string	"K\372paAr7\241}\3050\326\354zH\275\354\256\207A2\207\034\357i\177\304Ih/Q\341\002vM./\273\001\216\022\362%\377\364\215\n\026(\024\025\271\244x(\354\314\216\311\322\0328|\316\310\335\025\251\2468\337Q\251\352\013R\246\f\240\353\272\356\035U\252\252\023\205\303(;\233\033\245\246\330\177\273\273V\223\r\323\326Y\036X$\211\036\030:\205g\235\t%\035\020\r{>D\262\030\022\032\3110\b!&X\004\205:$\240\354#r\305\317U\362\351D\270<Xv}\024p\004=\300.\223\030\261\213\303\235\374\255\232\324/\375\221\312R\f\016\\\240NtdMZ\n\365\251\003! p\202\031\322\252\003\304&\f\3024\200d\270H\346\263\260=\353\272|\024\334\275p\335\353\260"
+	.ascii	"\331\356c6\224\206\213\302\020D\241s\234\204}\353\017\350ih\177"
+	.ascii	"a\320e(\203X^ \236\022ca\330&\322\016\213\244\345 \221o\367\276"
+	.ascii	"\366\221\001"
+	.text
+	.section	.gnu.lto_setPixelToStrokeColor.26.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"\326\221A;0\345(\035\340A\033h\032\265\2178\266\340\315v2\217\316\323\272\266\006j\351\245\241\376\270\002\252j\bl\241\336\212\r\255\241Q\t\303\240)\332\373\320X\240\245xB\377\337d\357\224\002."
+	.string	"1"
+	.string	"0"
+	.string	"\231\313\315\r2\227\376\354\227\327\221\325\260H<^\001vwF\326\277\303\317\377\353\001(\325\351P\323\260\273\206(\325\307\035o;\301\366\203mYr\245\304\3669\266\013\304\001\326\247|o\231E#X\216\220\024lw;\376l.\021\264C\373&?\371\216\222\361\202\335\225\013l\267v\274\260\271t\375A\206"
+	.string	"\020\323\210\033\2260F\030\355\013\017\036e\250\002\023\353\210'\273\236`\024\261\257\355\356:\256\354\273\376\370\326\017\345@L\013\303l75\223m,\3361\336m\026\244\355#\340\220G\324Q\2207\321q\022 \023GK\336FQ\352F\242IG\2234\332*f\210\353\246G\301\264\024\301M\023\245\334\344\324\275\266q\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_setPixelToFillColor.27.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\205\t"
+	.string	"\326\321A;0\345(\035\340\301U\216A\031M<C}\333\211\373`\260\013;1e\355BY\301\370\270\002\252j\bl\241\336\212\r\255!\013\300\374\262)\332\373\320X\240\035:\250\265\266\311\336)\005."
+	.string	"1"
+	.string	"1"
+	.string	"\232K\316\r4\227\376l\231W\224\335\260Z\0360"
+	.string	"\273;#\353\337\341\347\037\366\200\224\nu\270i\330]\303\224*\344\216\267\235`\373\301\366,\322%\305\366;\366\253\304\001\326\263|w\371E#X\016\223\217\330\356z\f\342\\\"h\207\366U\336\372\276\222\361\202\335ULl\267z\274\300\271t\375A\206 \221i\304\rK\030#\214\366\205\007\2372l\021\221uD\224]Q0\236\330\327vw\035W\366_\177\274\353\207r`\004\206af\027$\300le\001\3361\336m\026\245\r$`\321g\324\321\2207\321q\022\241\023GM\336Fa\352H\243II\263D\332*\246\210\353\346G\301\324\024\301\315\023\245\334\354\324\275\266q\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_setStrokeWidth.28.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\345\b"
+	.string	"\266P>:@\345&\035\340a\237\335\377:0T\227\323\f`\236\023_\365\260\323\366\016\260\342\337\340I\377bI\247E\355*j\310pk\362\326\236\300\260\214\364\027\360#8\365d\333&{\247\024+"
+	.string	"-"
+	.string	"."
+	.string	"\006\233K\177\366\314k\310rV,\033+5\273;\343\352\337\341\347_\345\001\250\224\351\220\363\260\273\206\250\224\307\035o;\3016\204m\230/\"\266\337\261\r\353S\276\263\026.\202=}p|\260K\204\353\320\276\311O\276\243`\274`W\025\343\262[\031\334\200]\272\376`s\211=*G\224\2642\242\206%\204\321.y\360(\303\226\221\326)\232\354j\202\021\304\376\265\273\353\250\262\317\372\3415@\"\343@\263\333\021"
+	.string	"\300\266d\245w\331\305(\373\b8\344\021u\024\344Qt\334\004\210\304\321\315\313*\266N\023M\252\315\221\226Y\314\020\327M\217\202\351&\301M\022\245\334\354\324\375\2651\f"
+	.ascii	"\3043\241\214i\3553<\316\272\270F\021\303\274 |\246F\301eij4"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_setLineOutlineType.29.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"%\t"
+	.string	"6Q@9@\217\322\001\230N\374\262\001.E\262\306\262\320Ll\234b\205\235\356n\373\225n\220\221\243\243\221\316\031\253\033\3751\025`09\335gb\200\354\022(Qk0Z\273\311\336)\005-"
+	.string	"/"
+	.string	"/"
+	.string	"\331\0136\237\006m\231\207 \313a\271l\244\314\354.\225\254\203\217\240\177\224\003\244T\247GN\303\356:\246T\035\267\274m\004\333\016\266[\0024\373\232,!\266\337\261\035\303\237\200o]`\003\213\362\020\371d\237\007\330\243\375\221\223\200/\3018\301\356*\306\265\033*x!\373tx\203\315g\264\023\356\345\312\017+\257\f\251\341\031\243\264-\276\370\224\243\212\311\013%Ovx\212\362\303>\266\273k\271\262\337\372#&\340za\200\331\345\250\t#\356\203\030\2256\222\211\242v<\255\242\244}\002\034\362\210\274\n\372$\274.\002d\352*\367i$\316\333D\264n\264\264i\0234\324y\324\223\340\312\215:j\252\265\013\f"
+	.ascii	"\3043\241L\213\237\2321.\270\270F\021\303\274 |\246F\301eij4"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_setLineOutlineColor.30.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"-\t"
+	.string	"\006\021@:0\345(\035\2003\226\256\246\234\265\031\224\245[\223Yt\236\326u)\034\243\276\256\3210g\f\366-\350\236\225@\333\262\227\022\003\252C[`\021\304\006\234\b\226\254\326\332&{\247\024,"
+	.string	"/"
+	.string	"."
+	.string	"?\310<\272\263a^AV\323\212m\240\304\354\256\204\255w\177\235\377\223\007\250V\250?\315\303\356\372\251V\0357\274m\005\333\020\266Y\002\260\270\"b\373\034\333\257\336\244\273\353\"+\330\224G\210g\363\230\220\375\331\0379I\367\022\214\033\354\262b*\273\225\301\r\233G\327#d\0367\001Tr\352\376\005\313\200\032\216\357A\333\342\364\256\362Ki\201\245 \312\256\250\007?\354g\273\273\206,\373\256\377e\004./\016\257]\216"
+	.string	""
+	.string	"6t\216\246GD\332F&\212)\300i\025$\3153`P'\304\315\317I\202\243\021\037\023\235\245\2236*q[H\316M\2226mB\202(';\013\236%\021\225\2469\003\r"
+	.ascii	"\3043\241L\213`Xk\330\340&\270\270F\021\303\274 |\246F\301ei"
+	.ascii	"j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_clipToRect.31.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"\306\323G<\020\005+\035\200l\240\002\340'\243\216\3367\346\332\304\021\240\344hw\240\b\277RIX\033\272\246\314 \024 \026~\3661F\200\342C\363\006T\300,\265\235"
+	.string	"\203\370\200}\373\233\354\235R3"
+	.string	"8"
+	.string	"3"
+	.string	"\236W\2277\340\274z^\300y5i\323\2744\331N\314\246\325R\263\273\036\215\235\374$\375\273\374\343z\261>;\f\273\353\351z\205\334\364\266\021lG\330w\b\270\n\203b\373 \273v\002A\023y\230\371\326\r\254\007\311G\303,\317B^\346\233?\273#9\333\356\206<\362\274\036t\237\366S\256B~e\343\004\2730\031\333n\031\262B\035\256\263\322\216R:\251\275\032\347]\236/7\270\026e\331%k\322\022\373\335\356\256)\314~\355\257\247\375\335g?\275\354\237\035\201\334\314B\314.H\200\334\006\025_}\274\306\305/\003\365\215\002\\\022\231D\2204Z\210!\005I\025\202\251\361\273H\211'\223\007\236<\324\351\303\360J\241\350\211\022\f\246&BO\005\202\241\007*\367\335R\230%"
+	.string	"\3408h\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_clearRect.32.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\235\n"
+	.string	"\306SH> \345*\035"
+	.string	",\004X\002\216l\330z\316-]\033R\001@T\335P1\r(\304\371p\305\217CY+\b\003\250\026\344\266\211\006d\332\374p\257\310\"\033\006\002"
+	.string	"0X\216\373\333M\366N)3"
+	.string	"8"
+	.string	"3"
+	.string	"\234W\227G\320\274r~\240y\365h\007x\371\332\215J\310\nF\300\356v4\345\343\347\350?\346\035\222\245\372\3344\354\256'\311\032\271\351m+\330\236\260\377\020\267Z[\261}\217={I\310Z\0201\3338\202\0059!\035f\371\227\3610\333\334\3315\031@\333\335\217C\234\327\004\356\323>\313[\306\273t\274`\3275C\333-?f\b\037\256\263R\216R:\251\235\022\347I\317Z\353\266\242*\273TM\212b\237\333\3355u\331\237\375\365\262\237{\354\247\207\375sc@\002 BfW\244"
+	.string	"\201\r\027O]<\307Co\303\344\205\006<\002\221\302O$b\204\240\205\b\005~'\321\3138\205%R\367\225:S\311\323\350F`\330\201\026\374\235*\300\016\365}`\347)\367\334R\227)Jn\0364\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_resetDrawingState.33.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656Po\322\001 [\036-\0026\307a\272\003\363\034\356a'\206\033\226\206\331H\020\343\303\331\373\321\242~\002\265\264\033\233\036\212\266\337jJ\247\n{\216\351\326\b\331;\245\264\242"
+	.string	"U\f\001\366p>Tv\260\b:!:\241)/\254\222\270\250\365\211\322\212 \253\232\210\236I#\347\300\362z\2301$\345\214\233\272\237\026rv\020\351.\240\310\323\263\261\212\367\315\257\004\322\211\240fW\355A\r\373\323\356\256!g\303\201\020\225\006\224\335\321\213\313vT\351cc\373\317\376\310I\262\227X\\`\227[I\331\255\bN\320\234r}\001\346\224\346\004\230S\316l\226\327\216\315x\2140NZv7B\216g\177\231\177\223\003l$\355/\243\260\273~\033)\343\206\267m`{\301\366F\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_drawCharacter.34.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\003\001\235\f"
+	.string	"f\030VA\020q\233\016+\004\302\"\2742\210\2546\234\031:\b\265\006@\351\247\222U(yq\301]\305\307\327\351\2261\243\231"
+	.string	"\365\352\3236\210(\nb\003L\240\204\251\276OR\345Y\267\2076MD\310\2262\245B"
+	.string	"H"
+	.string	";"
+	.ascii	"O\341]E\206\013\330\025\305@\331\0055FP]2"
+	.string	"x\002\323\245\352\230\351\222=\233\306A\022K\225\370\360\261\250\261\273\227\216\270\367\364\374\237\334\n\215|\236T\202\335u\206F:\334z\333\005l;\260\257!\231>\200\0010d0\bw9\2046vEzq\302\366-\266\343\bdF\203\026w\341\335\244\313\313\212\200L,\250.]\362\230\251\304)\361\262\"!6(H\360+\274\2238\305\326.\210\020ew5\346\250.e\342\323>\212\266\005.\037r\346\323\217\243\246\336\322\353O~`\244\362\335\b\311\320\017\0172\251Z\352\374<\2002\264\301O\252\b\373qw\327*\262\245\264\365\222\237:\311?\335\344\217\037\375\232\351\f\234G\313\342&\201\243\3351\234\303.|`\034\001\314\331xpYG7\201\333\"tx\266L\3530\n\032\327\361\270\262\316\365\321\301*\\\234\215\2736\006\234i\020\266\313\223e\333e\001\367qU\344\007*+!\nr\225\327TJ'\r\026"
+	.ascii	"\3043\241\214\351Dj\2308\3738s<\341\032\346h\343\235QM\tW\200"
+	.ascii	"\316)\341\002\260\237\216\321u\270\b8\027tN\t\301\002\201\301"
+	.ascii	"\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_drawCharacterMask.35.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`&\002\275\020"
+	.string	"6\037lE"
+	.string	"\261&\035D\274\322u\337\357\344:El\177\376\205\021\362"
+	.string	"\327\2216\3230\016&F\017[\205f\253AG\367\032\241R\006\242\306\237q\353\275\344;_2\202B\230(h\n\370\375"
+	.string	"e~T\2334\262\211\224)\005U"
+	.string	"["
+	.string	"T"
+	.ascii	"\327\323\376\211\243\370\236\002\303\007\354\312\364\350\354"
+	.ascii	"\202#N\220=\032|\001\3541;\b\366\350\317\3669\030bA\"H\254V\340"
+	.ascii	"\330\335MA\374\373\245\371\371\317y\210\325z\371\005\240\305"
+	.ascii	"\341\252\265RW\310\356\006h\2512A\nv\327\311jm\270\343m/\260"
+	.ascii	"-\301NU\326^\363\207N\363g\267\371AX\032\373\315\037\217\363"
+	.ascii	"k\2463\323\367 P\203\206\203\033\273\032B\035\313\023wL\330\276"
+	.ascii	"f;\342\270\314\214\200p\335X\350y\300\342-\276\333\234\362cU"
+	.ascii	"\251\022\r\262\307\217<\bV\323\201A\202W\361\235\3061\256\217"
+	.ascii	"U}\200\321\331\335\021\227d\217!\001/\006i\352\352\007\225\241"
+	.ascii	"\f\030\327\216\275b\373$k\017<>w\344\356\276\250\3168/\202a\252"
+	.ascii	"3T\231\303\002\3020\f/\202E\305\324\231\301\203\246\327\347\034"
+	.ascii	"\201\213\027\253\037T\206~x\027LUS\347*&\225\241\r\246Rg\354"
+	.ascii	"_\273\273V\031;K\213@\031^\213\211\273:N\205#\305\216\002IO\277"
+	.ascii	"poT\201eT\342a\022\311\211\307\231\234R\274n\202IK\307\231N#"
+	.ascii	"\025\223W:\331\270\322\306R\032\255l\244\316\333H\f\2303\241"
+	.ascii	"t[\013\307u\233\006\242\256Q}\245\217\202\211\024&\202\r\036"
+	.ascii	"\224\246,\312\253HSC\232\251]J\311\263|m\214\006, \220\202\231"
+	.ascii	"\271\253\003\304'\fY\274\303\372(~16\336\223B\013\270\353\355"
+	.ascii	"\200\373\331\243\345n\263\353\214\255km\321p1LI\224\352\217\007"
+	.ascii	"\314\221\234\375\310\036\206\314xU#4\300\210\341\236/D\271\f"
+	.ascii	"dD\341\200\354\2473\272\376\"\316\221Y\300\210r\334\210\301\025"
+	.ascii	"i0E\360rP\223O\362\276\253\223\001"
+	.text
+	.section	.gnu.lto_drawString.36.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\375\013"
+	.string	"\366VRA \217\223\016K\204\345\211\360\244\224>A\006?\360\217\205\004dD\313%\221\244\3134\252\347\003Y\034\312\036\327F\016I\037U\025\312\t\b\326`w\326\024\300d\202`t\360\366\306i\321\244\221\275\245L)="
+	.string	"E"
+	.string	"8"
+	.string	"\017\260;j\301\262\313y|`:4w\001\322\341t\216th\315\206q.\304bD\230l)d\354.\245 \256=5\377+\317\210HBO\f\202\335u\212HJn\275m\002\266\033\330\217\020\231~\206S\342\202A\214]\r\335\313\272@\026$l_c\373\251\200\274X\240)\331\200\315\216\240\030\241"
+	.string	"\305-o\263#\0362$H\356'\264\237\270\305\231\335\016/,\273\353\361\306t\330yO\373&/\241\335\004\206\372\324\256\020\363\"w6\ry\322\353Wn`\205\212mFHv~w\020)uR\347\306A$;\233\013\245~\260\377vw\255#\033\246\247\247\374\322Q~\370\223\377]\345\317\021tY/>\373\205\307\312\302G\265\001\300\035\032\036\321\342\310$D\f\002\007\b\263\256\254\232p\305\217\007e}\250\217OE\201\352\300\"\245Q\300\326\365"
+	.string	"\243@\226\205Q\032n\377VGv\260\301%DE<\345UR\030\024"
+	.string	"\3043\241\214i7j8\340\354\001\\#\356l\350-\024zu\031P#^\205\013\205\32100 eP\024%\330\r\330"
+	.ascii	"M\244),\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_drawStringMask.37.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\t\002\345\017"
+	.string	"\246\035gD"
+	.string	"\261&\035\037\n"
+	.string	"\364:y\362<\374\310\373\357\376\221\005\030\027\376\035\2121\230X:\306v\260\266-\037\334\367\033*e \002\376\214[?\265\243\375\240\021\024BDA\267\201\257\307Q6\220\306\244\221\275\245L)R"
+	.string	"V"
+	.string	"O"
+	.string	"%n\302\364\023\027N`\367%\347f\327\003\361\002\354\321\336\013\\\217\330;\256G\233\354\235{ \326\023\323bQ\021cw5\375p\323\241\246\311\177\353"
+	.ascii	"V\254\323\341\207\305\341\232\261R\320cw\005\260T\231\036\006"
+	.ascii	"\273\353\\\2616\334\361\266\033\330\036\261S\024\316<\351\317"
+	.ascii	"i~\3543\277\3472\377u\245\343k~x\233?3\375\215\216\021/\"\300"
+	.ascii	"\330m\371f\254N\304\021a\373\231\355h\263\002\023#\001\326Tp"
+	.ascii	"\001AiJ\0068V\225\"\304\203\231\026\007\351\035\205\3512n\001"
+	.ascii	"9V\345!\303\315\356\202X\004{\364\200O\373\001~\353\007\326E"
+	.ascii	"O,p\340\215\235b\357\344j\023<>i\344\356\236Ta\234\377\270\242"
+	.ascii	"j\216*ex\300\367}\337?.\250Q\235\030:|\364\372\326\025\254\370"
+	.ascii	"Xj\240\362\363\277\257\\\251\037u\262\270\244\362\263\275T*\214"
+	.ascii	"}\270\273k}\261\261\f\035i\264AnC\331B\261{\351\026\336\201("
+	.ascii	"\250\200D\0028\024R\322m$\245\223\216\233@B\342\266Q\t\2042\352"
+	.ascii	"D%\332&\322TD\240\024-\304uZ\b\002o#\023N#m\033\247e\036\352"
+	.ascii	"\n\3250}\223+S\r#$tP\232\362F^3\305\324\243\227\332\242\223\374"
+	.ascii	"** \220\202\231I\363\304'\f[\f\303\316$\376\032\305\033\\\367"
+	.ascii	"G\301\305\213\007{}\026S\332I\311\206\332p9L\371(\225\035\017"
+	.ascii	"\314\221\244\375\306\035\006\373xW;4\300\210\303\335P\310q\031"
+	.ascii	"x\304\037.\205Q\007\266\224\335\005 S2\2216l\"\355\260\310\267"
+	.ascii	"\034+\362\367\336\327\0322"
+	.text
+	.section	.gnu.lto_moveToPoint.38.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"F\022B90\257\322\001P9`\260\002\217\276\351A\337\316\300\217x\0249<\023\3364\331&k\270\203\234C\b\260\340\277\027e\205g\231\206n\305\013\263\3344T\017.\333\265m\223\275S\n/"
+	.string	"1"
+	.string	"0"
+	.string	"\003\230O\315;\230O\2036\313C\221\315\214\3144`-\273Ke\310\301G\320?\354\233\224\n\365\230A\330]\307\224\252\343\226\267]`[\301v->\307~Y\266\005,\306\307FB\f\177\002\336e\2317\273\036.\261\335\365\030\244\371$\330\036\355\227\234\005\276Uq\201\335\325,\266\033z|\240\371t\370\026\362\3023J\031\245=\361\305\247\034SX\264\f\211\262CT\224 \366\267\335]\313\225\375\327/\357\372\343\354\264V\026Tv9^jK\233($v\337)\356q\022%\016\004`\321g\344\325\320\367\340u\016\241SWM\037\007a\362H#ZI\264D\342\"\250\250\363\350\307\300\325\324\320\321S\255\035\345\204\373m\345\312\f&\264\016"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F\006\035QB\334@\fpE\232\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_strokeLineToPoint.39.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"\326\221A;0\345(\035\340\341\005\025I55\005\3263\327\1772\2176b\301\017`]\255Y\002\372\270\002\252j\bl\241\336\212\r\255A\345\002V\007S\334I`H\342A:\241\377o\262wJ\001."
+	.string	"1"
+	.string	"0"
+	.string	"\233\313\316?\233K\177v\315+\311rJh8`"
+	.string	"vw\306\221\177\207\237\177\330\003V,\325!Gaw\rW\254\217;\336\366\201m\006\333\263r\305\304\366=\366\013d\001\326\253|w\271E\033X\215\220\216\330\356\202,\352\\\032h\207\366O\216\362=\345\342\004\273\255\231\330n\0059\241s\351\372\202v\210\221a\304\fK\030#\214v\205\007\2772dy\221mD\225]U0\212\330\327vw\035[\366_\177\274\353\207\362\003#\323\340\262\353\021`\266\262\336-\336m\024\247M$`R\250\324\321\221\027\321q\020\243\024GQ\336&\201\352L\245IM\363d\332&&\211\353f\b\301\024\365\300\315\024\245\334\364\324\275\266\261\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_strokeTriangle.40.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\023\001\315\013"
+	.string	"6\225NA O\225\016"
+	.string	"+\210\220\032\333\207\344\245\252Vm\342\016\002@\326\203\033o\304\236\005\343\254\r\207\206\202\037\003\250\026[\3314\221\036P\250\261\001\034\233-)\273\261\313\004\017\213w\322\266\210\220M\266L)7"
+	.string	"C"
+	.string	"6"
+	.string	"\273c\305!\221O\217\347\320>#\247h\237\026\355\026\037Q\273u\210I(\021\333]Nr\270x\025\375\233\270\244d\"]7"
+	.string	"\273k-\231,\334\362\266=l\033\260_!*\241\270`\2619\261K!\006\214\205M\024\036l\177b\273T\020h\2616\254\017\003V(\001\252\013\001t<\t\361)\247\31046\202\206\t\257\335\255X\023\371\354\310\256\366A<\204x\021\016\276\261{Z\361\n\005^\300\036H\b\236\272IMN\231I)U\332\rB}\311 #2,\006I\262G\222\312\r\366\263\335]\313\223}\327\277\275\365kg\375\363\253?\273\352\227O\375\001\231P3#\305\204\212\031\351%\324\313H\301\216\001\250\323d\270c\361\200\036'L"
+	.string	"~\b8\242\317\013\205\235\202\020\370\361p\336\207\003}\272\005\\\347\0039\313\207\275\320\201\217\023y\336\307M\306}\266\362\344\033"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\310\003\216"
+	.ascii	"\005EQ\202\335\200\r\320D\232\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_fillTriangle.41.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\023\001\345\013"
+	.string	"\246\225O@\020Q\225\016\203\bD\200\264\375j~\027k\257\336p\022"
+	.string	"\215\354\362\245\324\373\305\204\237?\020\272\206\274>\n\020\013\333\177\202\364!\222s\20538\240\231\310i'\2003\362\337\260m#d\223-S\n:"
+	.string	"C"
+	.string	"6"
+	.string	"2Z\273\343\304\006 \237\036\017@\373\204\374C\373\264h\327\370hb\267\023\261\r-l\354.'K\\\274\212\376_<\"\032\205\256\333\201\335\265\212F\037ny\333\003l7\260\357! f<p\261\333!\006\333\327\214\221\302\366%6\013\006\203\225i\201\n\205\202T\210\004(\273\262\216\3250\202\003\002\035\317B\374\311.GvE\334h\355\356\304\030\310\247\200\354j_\305W\2107]\270\307n)\244\027\006\231\301S7\251\311)3)\245J\333B\250\027\271"
+	.string	"\r\330\222d\310\036C*I\330\317vw-K\366Y\377\366\325\257]\365\317\247\376\354\250_\376\364k$@\227P/ \265\204j\001i%\324\nH\301\256B\247\303pXC\331\200^&\224"
+	.string	"~\0212\237\317\363\204\335\004\017\310\331p\036\207\353p:\n\234\346\0039\n\001{\036\b\037\367\361\274\217\223\214\373le\311\016\002\032"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\220\027\024"
+	.ascii	"O\t\306\002\206A\023i\n\013\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_fillStrokeTriangle.42.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\023\001\325\013"
+	.string	"6\325NB O\225\016 \352\221F\211a\256\342\232M\267\026\226w\201J,m\272\002\273:\205R\216\206CC\301\217\001T\213\255l\032\017V\210\232\232\220\031\233-)\273\261\313D\360Q\\;i[D\310&[\246\0248"
+	.string	"C"
+	.string	"5"
+	.string	"\273c\305#\222O\217\357\320>%\347\320>-\332/>~\330\r\204\005\n(`\354.'=\\\274\212\376S|B*\215\256\033\200\335\265\222J\031ny\333 \266\r\330\307\020:\361\030\301\002Al\367B,\306\302\246\n\021\266O\261[\257\002\254\026\201\325i\200*\204\200\324\206"
+	.string	":\376\204x\224Wd\032;\201C\005\327\356V\254\221|~dW\373\247\227\020o\002\3027vM.\\\001\007H\300\"H\t\236\272IMN\231I)U\332\017B=\311\"-^\253A\216\354q\244\262\203\375lw\327\322d\277\365og\375\332W\377\274\352\317\236\372\345Q\177\231P3\"\305\204\212\021\351%\324\213H\301\316\301\247\323d\230c\351\200\336&\\"
+	.string	"~\n6\241\317\003\205\035\003\020\350\351p\236\207\373x\272\006\034\347\0039K\210=P\202\217\013y\336\307Q\306}\266\322\344\033"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\310\003\216"
+	.ascii	"\005EQ\202\335\200\r\320D\232\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_strokeRect.43.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\225\n"
+	.string	"\306\023H=\020\005+\035\200\301Q\001\200m_\363\207*\250\266%\216"
+	.string	"\005\342\376W6!;\221\306\365\243k\312\fB\001b\341g\037c\260\b\\\262t\002%\314R\333\t\340p\332q\374\266\311\336)\0053"
+	.string	"8"
+	.string	"3"
+	.string	"\237W\227/\350\274~N\320y5i\343\274DY\217\312\210\013\006\300\356z\364\344\344'\351?\346\240\027\254\365\351Y\330]\317\027,\344\246\267\215`\033\302~C\270*\263b\373!\273\226\362@\023q\230\371\326\t\254G\311\007\303,\377B^\346\233A\273$9\333\356\212L\372\274\036t\237\366Y\336B\336e\343\003\2731\033\333n)\262B\035\256\263\322\216R:\251\315\032\347_\236538\027m\331ekR\023\373\335\356\256i\314~\355\257\247\375\335g?\275\354\237\036\003\232\033\211\234]\220"
+	.string	"\271\r\025g}\274\306\305/#\365\221\002l\032\235D\2604Z\210!Ei\025\202\252\361\273P\211\250\223\007\242\274\024\352\303\360L\241\350\215\022\f\252&Bo\005\202\241\027*\367\335\322\230#n8\016\032\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_fillRect.44.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\245\n"
+	.string	"\306\223H>\020\005+\035"
+	.string	"\004\021\017\t"
+	.string	"\035\220\367\324(\252\3362\003"
+	.string	"\324\366\300$\n\350K>:OC\327\224\031\204\002\304\302\317>F+\001\362Y\350j\304\311\2226\233\340q\332s\374\266\311\336)\0053"
+	.string	"9"
+	.string	"3"
+	.string	"\240W\2277\360\274\202^\340y5i\337\274L\331\217\312\312+\006\300\356z\024\345\344'\351_\346!X\314\365\371a\330]OXL\344\246\267\235`;\302\276C\271J\303b\373\"\333F\002Q\033y\240\031\327\r\354\207\tH\303,\017C~f\234C\273%\001n\273;r\t\364\212\320}\332o\271\013\371\027\216\023\354\312fn\273\345\310\013\001\036\256\263\322\216R:\251\335\032\347a\23659\271\027u\331\245k\322\023\373\335\356\256\251\314\276\355\257\257\375\335i?\375\354\237\237\003\035\233\t\234\335\220\001\0026\026o}\374\306\305OC\365\225\004|\"\241D\3204^\210a\205\211\025\202\253\361\303X\211)\224\007\246<U\352\313\360N\241\350\221\024\f\256(B\217\005\202\241'*\367\335R\231%vr\0354\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_fillStrokeRect.45.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"VSG> \005)\035 !\210\205\013\300"
+	.string	"\244<\200\346\227\217`\030\"\230\363T"
+	.string	"\367[(\362\212\032\252$j6\fF,\312\205\226\035\023pc]\205@\034w\020\252\205\rWi\365\255m\262wJ\0013"
+	.string	"9"
+	.string	"2"
+	.string	"\247\036\177\3009\365\334\200sj\321\016\360\021e;),\254\030\001\273[\347\311\305K\321\277\314\005Z\257\325e\247aw-[\257\221{\336\266\202m\t\373\017\001\353\272\rX\033\235Y\261\375\217MS\211\230\221@\310\\\016r<\214\370\230i8\202\005)\t\251\355.\310\"\317i\002wi\277\345.\342_:^\260\013\263\251\355\216 3x\002/\233\307\3740\225trsN9mU(\337\262\254\271\331Xse\217+9M\354s\273\273\2360\373\264\237~\366s\227\375\363\261_v\020Dn("
+	.string	"l\027W=<\307\301n\343\324\211\006L\n\225@o\024b\200\237\305(\365y\250\260\313@\201\246R\365L\365d\3524*\351\003kh\301\036\252\342\253)\317\373\352g\334s;a\236\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_strokeEllipseInRect.46.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"VSG> \005)\035 !\210%\002\210\007DX\232\322^\375\221a@\nSgS\022Uvyt\214\206*\211\232\r\203\021\213r\241e\337#@\207\221\002P\356\265\026\336\300\003[\302j\373\233\354\235R2"
+	.string	"9"
+	.string	"3"
+	.string	"\247\036\217\3209\375\374\240sj\321\026\360\221e=\261\232\326\314\200\335\255s\345\342\245\350\237\346\003\256\027\353\322\343\260\273\226\256\027\311=o{\301\366\204}\210;R\200\300\336\250M\213\355\203\354\232\213\004-\0261+y\220\343e\304\313|\303\025lH\212\210mwC\036}N\025\270K\373/\207\021\037\343q\203]X"
+	.string	"\333\356\030r\303'(\267\217\tb*\351\344\346\234r\332\253P\336e\211crkM\226=\262\344T\261\317\355\356z\302\354\327~z\332\317}\366\317\313~\351I8\001P\221\263\001\030_=|\307\301\216\003\325\215\b\\\022\231@\217\024f\200\337\005I\365y\251\260\323H\201'S\365N\025u\3526j\351\003\253\210\301^\312\342\253*\317\373*h\334s;a\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_fillEllipseInRect.47.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"VSG> \345*\035 !\210\005\b\310ET.\372\364]Z\334\330`\334\307\217K\341F\377\201\265\303\342P\326\n\302"
+	.string	"\252\005\271m\002O"
+	.string	"\330\320\236\272\342\270\007\212\001\013L\225\203o\177\223\275S\n3"
+	.string	"9"
+	.string	"2"
+	.string	"\247\036\217\2609\355\374`sj\321\026\3601e9+5\253\230\001\273['\312\305K\321\277\314\007X-\325%\307aw-Y-\222{\336\366\202\355\t\373\020\001;R\200\300\336\350\f\213\355{lZ\213\304L%BV\362 \307\303\210\217\231\206+\330\020\023\221\332\356~\034\352\234*p\227\366_\207\211\177\361\270\301\256+@mw\374\270\241\023\260\333\307\0041\225trsN9\355T(\317\262\264\271\334VSe\217*9O\354s\273\273\236.\373\264\237~\366s\227\375\363\261_r\022^"
+	.string	"*l\033\030O=|\307\301\216\303\324\205\b<\002\221@O\024f\200\337\205\b\365y\247\260\3238\201%R\365J\325T\3526\352\350\003+\210\301\336\311\342\253(\317\373\252g\334s;]\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_fillStrokeEllipseInRect.48.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\205\n"
+	.string	"V\023G> \345*\035 !\b\245\002r\001\337\005\236\246\240k\303\200\032\030`\205\006&\240mp\tG\303\241\254\025\204\001T\013r\333\244\025 \"\032\247"
+	.string	"\240\361\\\021\007'\230H.\242\265M\366N)2"
+	.string	"8"
+	.string	"3"
+	.string	"\247\036\217\2409\345\374@sj\321\276}t\355\006E\200\212e\300\356\326yr\361R\364\337\362\201\025+u\271q\330]\313\025k\344\236\267\275`{\302>D+R\200\300\332\350\313\313\366;6\r&1{E\310\\\017r\374\212\370\230a\270\202\r)!\251\355\256\307 \316\251\002wi?\345*\342a\0367\330m\335j\273\243\307\r\234"
+	.string	"l\037\023\304T\322\311\3159\345\264Q\241\374\3122F\306\246\232){L\311ib\237\333\335\365l\331\247\375\364\263\237\273\354\237\217\375r\2230\023\240\302e\003\030G=|\307\301\216\243\324\201\b,\372\214@/\024f\200\337E\350\364y\246\260\3230\201\244Q\365H\265D\3526\252\350\003\353\207\301\236\311\342\253'\317\373jg\334s;[\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_ctmReset.49.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656PO\323\001\240\363c\255\212\340L\004{\013\004\316\225h\246j\214\322L\026\0331\037\235\275\257\315\250\372\031\333\323f\206\002\270^G\025\252\307\003k8\254Yk{\247\024\264\232"
+	.string	"U\f\001\366t>TR\030\004\235\017Th\312\013\253\".j}\242\264\"\310\252$\242g\322\3309\260\274\034f\fI9#\247\356\245\205\234\033^:\013(\262\364l\214\342}\363Ki\351DP\263\253\366\240\206}iw\327\220\263a\201\213\nU\262\213\021\003\263\335\204\362\301\261\375g\037\344!\331E*.\260\313\231\234\354V\004'l>\271\236 \363i\363\201\314'g\366\312k\307j<X.H\\v7B\216g\177\231\377\221\003l#\355O\243\260\273~\333(\343\206\267m`{\301\366F\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_ctmSet.50.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\031\001\355\013"
+	.string	"\246UO?"
+	.string	"Q5\035;_r\t4\354'\177\002f\214[\223\245\374\273E\311L\367\344i\216K\227c\362I\007\210\005\212$?^\177.&\370\033e\325`\246K\360\\\330.\303.\375?Zo\"wJ\001:"
+	.string	"D"
+	.string	"6"
+	.string	"*\326\356(q\202\307\247\307\017\300>\037\027\200}Z\264g|\034mV\342F\006\0264vWS\022\027/E\377\252C@!\317e\246`w-A!\017\267\336\266\001\333\020\354w\b\037bX:v9t\330\330\326ta\302\366#vJ\306\003T\013\007\247\023\rL#\006%\257."
+	.string	"\253\341\263a\201\034\277B<\311+Cv_\324`\355\256\304\225\307g\201\353\322>\212\247\020\257\342\302\003\354\212\002 Z\030\364\343)3\305t\352\245\252Rm\013\035y\220\021\210\200\261!\324c\217\036\251#\354_\273\273V\221\375\324\237\035\365c?\375\363\246\377z\351\327\223~\t!\020\034\305\323\215\342)\307y\272q\236r\233\247\333\346i\330U\320t\025\016_&\230\360\263t&\204\240\004\013\007\3746\235\216\302&\314`\264/\243i2\235\247]\300P\233\034\360\267\211"
+	.string	"j\234\357\003\265\310\270\017\033"
+	.string	"\3043\241L\2130LD\330\253\256\360\202k\230\274\031\016\030\001\371\300\300\200\024\340\016`\fH\001\356"
+	.ascii	"\306\200\024\340\016`\fH\031\024E\tv\0036@\023i\n\013\270\226"
+	.ascii	"\027\302$\003"
+	.text
+	.section	.gnu.lto_ctmTranslate.51.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\235\t"
+	.string	"\366\221B<0\345(\035\340A\376`\035\203\275\350 -\347\376\323\b\235\316\240\205\013!T\360K\340\243\206+\240V\004\201Ql\236\272e\227R\200\3017\312\203\265\005\205\022\026\r7\376\267M\266L)."
+	.string	"2"
+	.string	"0"
+	.string	"\232K\316\0174\227\006m\001\017Ov\203\022\342\341\"\260\2733\232\034\274\202\376]\037H\251N\327\215\303\356ZS\252\221;\336\366\202m\b\333\261R&\305\366;v\213\344A\303\303\200g9&+X\020\324\307kw=\006q.\025\262\253\375\226\273\200\177\331\270\301\356\n\300k7\364\270\201s\351\360\b\001\216`\201qD\224\245\306\250\321\316\370\364)\353\214\n\254#\236\354\360\244\261\304~\266\273\353\270\262\337\372\343Y\277\312\204\225"
+	.string	"\024\003vE\n\304\026\026\237\247\032\236v\032FI\003\021X\364\031u[\350\253\350\270\211\220\307m\246O\2630u\244\321\334H\263D\322.\246\210\353\346\207\301\233I\202\233\336\266q\263\023\356\263\215\253\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_ctmScale.52.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\235\t"
+	.string	"f\022C:0\345(\035\340\341\021H\025\037F\351\372\231\353\217i\3462^\3722\200d\326\254\312>\256\200\252ZN\243\030M\361G\343p\250\021/\235\243\275\017\215\226\024\nO\313o7\331;\2450"
+	.string	"2"
+	.string	"2"
+	.string	"/\300|j'\300|\032\264]\036\212lf\344C\203\005`w\251\f9\370\b\372g]sB\225\0363\013\273\353xBy\334\362\266\021l7\330\216\005\266\277\261Wne\002\273a\342`\210\341Q\300\253\334\262fw%\346\332]\216=\332\347A\366h\277\344&\340O.>\260\233j\271vC\216\025\264O\207\001\016*0\fi\362\214RFiW|\361'G\226\024X\206,\331a)J\020\373\331\356\256e\312\376\352\227W\375q\032\274Z\270\227\335\216"
+	.string	"\261\205\315\027I_\215\0265\326\215B\264y\002\f\352\204j\367\371\"\252\007\361!y\335\350\333$F\225\013\321\216\243\"n\233\240 \257\322N\202\273\321\203GI]\347\321M\270\317V\246\034\016"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F\006\035QB\334@\fpE\232\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_ctmRotate.53.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\335\b"
+	.string	"&\321>8@\345\2501\264\367/\355\224\263\347\0208\231f"
+	.string	"\333N\342\244|\200Bm\035\214\034\231\203\222\013\271\270\252\004k}\326\321\313\351gA\226dX\tY2\260\315\312-eJ\001,"
+	.string	","
+	.string	"/"
+	.string	"\034\017h,\353\265/\376<\276\001\371\3108\221\371?c\207=C\257\266\211;+\226\312p\243\360\277p\305\332p\243\333\036\264]h\253\022\255=m\341\347\022\317\256\242\264\363\303"
+	.string	"\274\376\177\032\342X\032d\206\255E<\342\231\244\302\002\177\013\366\372\277O\0238\226\375L\240\261\fe\210\211Y\304\213J\bcK\221\202^\025\256\260\3040\242\252\375T0r\264\316\376\277\261\325\332e\303\254"
+	.string	"\246\345\301\345\327\b0\363\230L\ti\234;m\302\244\205\002:\002\221\272M\224\202\3508\007\021\212\333N)-\342\324\225Hs+MSI\223\230#\256\233 \204n\247\006n\242\266\215\233\236\357\316\036[\001\013"
+	.ascii	"\3043\241\214\351\3553<\316\272\270F\031\303\274@`pE\232\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_contextPush.54.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656Po\322\001#Zn\025\366\274\210&pC\246E\371\314\312\320\2648P\213\0041>\234\275\037-\334\236@-m\307LJ%\027\030U(\222\300\3370\326,!{\247\024\264\222"
+	.string	"U\f\001\356l<Tr\260\017\235\017\234\320\224\027VA\\\324\362DiE\220UE\304\316\244qs`y9\314\030\222rFM\335O\01397\224\272\n(\362\364ll\342}\363#\261t\"\250\331U{0\303\376\264\273k\310\331\260\240\005\345s\262{QZ\331\2162\361\320\330\376\263\017\362\220\354\"\024\027\330\345H%\273\025\301\t\231S\256'\270\234\312|\340r\312\231\235\362\312\261\230\216\017\013\022\225\335\215p\343\331_\346\177\344"
+	.string	"\333H\373\303(\354\256\3376\302\270\341m\033\330^\260\255\021\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_contextPop.55.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\235\007"
+	.string	"\242\31656Po\322\001 [n\225:h\240@\377\206\323\242dm\247\302\330\241\003\265H\020\343\303\331\373\321\232\372\031\334\350\352\252\032\212\266\337jJ[9f\331\267m\204\354\235R\264\222\020U\f\001\376t@Tz0\b:\037<\243)/\254\n]\324\002EiE\221UE\304\317\244\261s`y9\3148\222rFN\335O\01397lt\025\220\344\351\331\330\304\373\346\307\222\321\221\240fW\355A\016\373\323\356\256!g\303\002\215\226\220\312\356E\f\314vTJ\b\307\366\237}\221\217d'\241\270\300.\267\202\262[\021\234\2609\345z\202\314\251\315\0072\247\234\331.\257\037\253\0019\2610y\331\335\b=\236\375e\376K\016\260\225\264?\215\302\356\372m%\214\033\336\266\201\355\005\333\035\001\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdCanvasVTable.56.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\326\001u\017"
+	.string	"\364\032\226\002"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\303\317\267\005\177}\270\317\307\005\177{\316\247\005yw\370\315\227\005us\270\315\327\005uq\370\314\367\003om\270\314\227\005\177k\307\207\tig\370\306\247\007ie\270\306\307\007ic\370\305\367\005ia\270\305\227\005i_\370\304\267\005i]\270\304\267\007[Y\370\377\326\005[W\270\377\366\005[U\370\376\246\007SQ\270\376\306\005SO\370\375\366\005MK\270\375\266\005IG\370\374\246\007EC\270\374\346\005A\277\177\370\367\246\007\177\275\270\367\246\005i\273\370\366\266\005i\271\365\306\007\267\177\265\365\266\007\263\177\261\370\364\366\005\257\177\255\270\364\306\007S\253\357\346\007S\251\270\357\226\005\247\177\245\370\356\246\007\243\177\241\270\356\346\007\267\177\237\370\355\326\005\267\177\235\270\355\366\005\267\177\233\177"
+	.string	"?\202\210\200\330\004\231\177\227\177\335\001\225\177\334\001\223\177\333\001\221\177\332\001\217\177\331\001\215\177\330\001\213\177\327\001\211\177\326\001\207\177\325\001\205\177\324\001\203\177\323\001\201\177\322\001\377~\321\001\375~\320\001\373~\317\001\371~\316\001\367~\315\001\365~\314\001\363~\313\001\361~\312\001\357~\311\001\355~\310\001\353~\307\001\351~\306\001\347~\305\001\345~\304\001\343~\303\001\341~\302\001\337~\301\001\335~\300\001\333~\277\001\331~\276\001\327~\275\001\325~\274\001\323~\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.ascii	"# \220\243\255\006\305\024\223b\246\305\b\025-\354R1c\245\304"
+	.ascii	"\273\354\262R\004\225\302ALRH!\005)\244 \205\224\244\220BJRH"
+	.ascii	"I\n\321\245$\205\224\244@t\270\024C\352P\341"
+	.text
+	.section	.gnu.lto_getCanvas.57.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\023\001\325\f"
+	.string	"\346\330YC\360\2226\035\322\304T\253\257\002\\\320\347\030\3213\001\270\335u\006\210u\316C\306\203\031\376%\035f\361=\017b\023F\217\3214\026\317v\312\215\305aQd\347\324\322\222\261\224,\036{\373\264#D\366\2262\245F"
+	.string	"E"
+	.string	"G"
+	.string	"'\260k\2221c\367c`\222\352\321\337\rP\217\325\013P\217\266\335\200$d\321\277\225\022H\251DJ\213\323\356g)\211\213\236\"\377+\236"
+	.string	"\205\215\0342/*\243'\b\204\335uz*\035n\275\355\005\266#\330\007\021.5H2/\036P\262\306\376F\251#\354\303\335]\253\311>\313O\3054\204i\215\351\204\351\0038\215\210\323L\006\230\335R\215\217\215\2114N\330\016\331!\266\365\003!\030\260\032Z8<\310\264\237\342*Bg9\t\252PS\307\004U\221\0203\251\366\3460\256{=\256\251y#\345\207\200\2649\025\362\336\365"
+	.string	"\016\230\030\222\216\354\277\320DVv7\334\363]\334%\203&\032uO\333\316\342B\265\273\016\374\026\256\013\260\303\304\243\177B=\306\034\254s}\272NVu\027\206\316\205Q\306FJ\272m\0032\3518\n\233\017\267y@\227\005O\227\225X[fu\262K\2630\256\263F\024x\363p8\353\263m\234\025b\333\337\036\256\232|\021u\232\017'\036(J2T[\302c\004\023"
+	.string	"R\213qd\005\001\004\b@"
+	.ascii	"\323D\b\334\f9^\301K\206xJ\235\n5&h\rF\315\022\352\302=16\202"
+	.ascii	"\022\301H\002T\230\3275\311"
+	.text
+	.section	.gnu.lto_frskyOsdVTable.58.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\b"
+	.string	"\204\016&\001"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\203\356\247\005\177}\370\355\247\007{y\270\355\227\007wu\370\354\267\005sq\270\354\267\007om\370\347\307\005ki\270\347\367\003{g\370\346\247\005ec\270\346\327\007a_\370\345\247\005][\270\345\307\005YW\370\344\267\005US\230\344\007QO\370\337\307\005MK\270\337\207\005eI\370\336\327\003eG"
+	.string	"?\202\210\200\300\002EC\312\001A\311\001\277\177\310\001\275\177\307\001\273\177\306\001\271\177\305\001\267\177\304\001\265\177\303\001\263\177\302\001\261\177\301\001\257\177\300\001\255\177\277\001\253\177\276\001\251\177\275\001\247\177\274\001\245\177\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.string	"\020"
+	.string	"\200\024 \205c\210\006\244"
+	.string	"R"
+	.string	")\200\024@\n \005\220\002H\001\244"
+	.ascii	"Rb\222b&\251\003\200\003"
+	.text
+	.section	.gnu.lto_frskyOsdDisplayPortInit.59.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"]\013"
+	.string	"\206UO@ Q\224\016"
+	.string	"Ed\037i4\027\t\330!\017\b-'9(\030m\275"
+	.string	"\224A\311\241\325\266om\254\007X\265\220\271n\305\314\254\037\210\002hZ\001\207\003\352b\321\b\tQ\265'c\223-eJ\001;"
+	.string	">"
+	.string	":"
+	.string	"\037s~\230\277\017\210\267\256\013\210\267\366\303\273\303\325\316\227x\240\303K\303\027\036H\301`\021\300\033A\312jC\210\253\256%O\244\n\3002\347\264\222\274\323m\335\266\002\333\026\373\004\002V\353\252\037y\210\307\007\215\013\035s\232n\200L\027\326\n\021\266?\366\304\266\252\375\0227\361\371g\301\2219;\200\250\230\223\003\201\023\\\267\n@\333>\211\247>\356(\037\210\223\304\324\002\303\211\272\245\265%\264\"\030Q[J\320\223\342\35698\214@\261\346\342\267\301*\306Hm8*\\{B\005=\351{\325\257\027!\031jx\214\026d\177\"]\017\366\341\\\224\343\277\037\006\234\215g\343\030\310\215&\2430q\246\242\331\344\205{\260i\016.\036Mv8\f\204\316\226i0\231a\0212\f\007\313h\033V1`\331\331h\230GJ\r\233|\241/\312W}\301\f\031\035)\324\357\2427n\020"
+	.ascii	"\\\b\230\2473\366\b0\013+\202j\txm\335\0134\254\342\302\0302"
+	.ascii	"\3268\325\b=\306\bh\"\222\022\330\324\3254\006\005\005"
+	.text
+	.section	.gnu.lto_checkReady.part.0.114.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`\201\001]\017"
+	.string	"\266]gE\360\260(\035\3520\2475\311\234\341G\230\272\263\031\256\b\0039\345\205}\202#\210\r\323\375/\235\375\327\320@L[f4T\306~\314\337\257\005<\003\317#*\036g1\210\271\343H\367c\235\206\252Z#{K\231RQ"
+	.string	"S"
+	.string	"R"
+	.string	"\353\302\302\305\356\347\340\321\241\317\243\277\037\310\036?/\220=\3327a\220\220J\305\266AB+{\377`Z\036\f\254\024X\215\335O{\324\020\367\256\t=?Y+&\327\303\256 \307\006D\214\232\225\r\317\216CO\310\356\372\303r\307\333\206`[\202}\235\333\332\271\261-\361\305\210\317\374\366}\232\307l\220K\256\302\bX^\256\327\356\202J\356\247P\3710\203l\177\3462\036\334\016\247\201\363\272\331\375\032<\032\346e<\217\353\310x\335D\370\254l\2205\377\251\036\223\362\370V\203\2125\355\2378\212\325cR'\260\001\232\200\206\003N\352c&\335\206\202\001\230\335}\340\257\270P\362E<\372\251\354\361\254\234kj\342H\311q\222;\016\220~\214d\313\263\256\217\035"
+	.string	"\214\022-6f\240\250I\352\213\025\036\256\272\330Ng\236t\314\322\360\337\257\236tf\351\013X\340a\200k\003&\321\250#q\031id\022\241:S\351\343\321\307H\267\211\244*t\334\004\021\024\267\235R\"\013\247\2564\242m%\315T\022\221h#\256\323>\030x;\2218\r\265m\234\226\207\253.\035\371{Y\246\031lg\352\220\023E\261\252\276\300\376V\r\211\226+\266\372\301Q\364\026P\343\b\006\036"
+	.string	"I+\210\002\021\370\321\300~6\203\306\n\005\301\f\241\003P\f\310M\202\213\234\260\217/\353\201\247"
+	.ascii	"\231\313\\\002\262,\300\330%\272*\330\272~\b9\204l+\313H0\235"
+	.ascii	"\263\017\355\\P\023\031uZ\222\324\3005\357\277\266\214\001"
+	.text
+	.section	.gnu.lto_frskyOsdDisplayPortInit.part.0.116.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`8\001\355\r"
+	.string	"\306\031\\D"
+	.string	"\2216\035\260\211\304\266\274\322bp%1\341X~Q\306=\204\237l\016$\266\030J\201\021\223\260\321\353\327\354+5c\354\260\315!\353\336{\360w\"@\255\"\255/\373\254\310\367\256P\034\307A\2256\221;\245G"
+	.string	"F"
+	.string	"H"
+	.string	"\330%\tQ\006\333>\313G\214\374!"
+	.ascii	"W4\b8\305\220\240dv\301yi\360\007\254\313\353\006\254K\375\360"
+	.ascii	"\357\032\253\317\217\246\022\322\365\341\023\220\324(\305x)\331"
+	.ascii	"\360\250y\005`\263\273\276Lny\333\016lo\354\213\b\227S\006\201"
+	.ascii	"\223\335\323\215\231\365 [\204\270\313o\337?\361\224\2159\344"
+	.ascii	"(+\007\0322\273\213\205"
+	.string	"\334/!\362Cc.\242\267x\034+\013.\255\321>x\023\243\267x\016\260\2132\003\263\0332\270t\203\353\222\243\262Gv\234NL\035\002\013hcFII\036\020\365\022\254\243\016\243]\273#+\316\"\253>4K\263.\217\272\212\357\332\025yy\212\315\007qi\220/\336t\351\177]\205x\223\037\376\030b\\\300\030QRT\025k\365j5\305vt\332'\324y\017\266\217'\263\200\271\323\341\3516\017\357\243\343\"x\204\270\r\344q&\200\272\3143\267lR\3108\332\354p\335\354P\340\r\364\341fh\333\270\211\275ZM\321D\203\\/\2507\"Z\262\252\252\330&\035^\234NP\254\242\270@\364S\001  \260\2421\272\016a\212Q\234\300\247\002\301?\307\201,oy4\377\013\026\030no\232{\216\337\250\261B\333\362) \263\315\r\232m\230\330h\224\\W\321\202\255\t\342\tE\215\025a]\271\314\035\206"
+	.ascii	"\323ST\336\177m\037\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`V\f\305\026"
+	.string	"\026e\210G\220\324Nc"
+	.string	""
+	.string	"\b\030\035\246\366\246\274)o\312\233\332{\\<\t\001"
+	.string	""
+	.string	"\310\214\244\230\221u#R\020\222mg\b`\336\031\"\370\225\002"
+	.string	"v\206"
+	.string	"\210\367\213qN\351\025\375U\036_\177\301[R\247Gm\237$2\005q"
+	.string	"q"
+	.string	"o"
+	.string	"\257\241\272\315\324o\244\216\023\365\034\250\353<}\307\351D\345\213M\347azO\362>\310\247\307\377,\035H\351AI\027B\372\320\321\211\214^d\274\261\350FD?\032:\222\320\223\202\256\004\004\372\322\317\217\351\221>O\366\234\211\347M@k\327\346-*Q\342\235v\336\242s\226\234\257\340\034\r^&3+\210}\333\254G5\271\367\336\233\233"
+	.ascii	"m\013\253\002\367\031\210\333\354\303]\346\341&\353p\217q\270"
+	.ascii	"\3056\334a\032n\260\f\367\027\206\333\353\302\335e\341vV\270"
+	.ascii	"\271(\334[\023n-\twV\325\247\356\2756qI\204SU\333@\346\035\002"
+	.ascii	"\341P\300\230'th\321\346\203[\211\203\277\024/\223y\2054\270"
+	.ascii	"\2230xp\301\205\n~\222\340)\b\256r\340.\006\216R\3400\313\017"
+	.ascii	"\t\\f\300g\004\234&@,ZBg\001\240Z\231R\221J\211B\261\351\211"
+	.ascii	"\255X\250]\242\226\307\243\352\275\324o\276\0357\022\035\367"
+	.ascii	"\221\034\267\021\034w\221\033\367\237\215\273\257\306\355G\343"
+	.ascii	"~\316\270\367d\334z1\356<\0307\336\213\373\316\305m\327\342\256"
+	.ascii	"cq\323\255\270\347T\334r)\3568\0247\334\211\373\315\304\355V"
+	.ascii	"\342n#q\263\215\270\327D\334jWwZ\210\033\315*\266\252\325\351"
+	.ascii	"\003\bXRi\323\"\312\277\244]&\255U\265\037\032\221\037G\244M"
+	.string	"\375\220G[\233x\307\276%%\233\362%=\221lm\356\035\331\245\236\221]\342\031\363\2146xWdS;\242\272![\237tBsA\226\003\262\365\031\367\003\227\276\371\270\365\264\361\260\025\327\210j;6M\323\261\265\211\226c\203\3163\034{evc\203Xe6d5c4b3a2`1_C/\230\256\027\247\013W\313V\200\244\250!\b\215\225\247N{\006\200\203$I:\021 \bBB\324\b\t\021\022a\204\374eQ,(\037\240\030[Q7\374\333w3_\020o\261\031\362F\226P?Zm\303[%v\311\300\202\2073\351(\032%<\0269\273$k%{\245f\215\016\223\277#G*\372\277'F?\321\3043\257\230\213\331\332\330\332\330\330\330\334\314\334\314\314\314lmlml\034\314\374\307\022D-H{\344\177M=K[\211\354\317\316\021Y\250q\234\2071\1774\005\200\267\260\200\001\020\001\001 "
+	.string	"\" @\004@"
+	.string	"\b\210"
+	.ascii	"\030@\361\001K\035\3112P\265\2213\254\206i\340W\001"
+	.text
+	.section	.gnu.lto_.refs.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375 \203e\003"
+	.string	"2\b\032\"\020K\2475"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\374\376\377\377\377\377o@\377\207\222\036!\344g\202\232\220\264eG5x\360a\302iC\351\n\027\"d\350\260\275\231u\023\366Z\366\032\026BJT\\dlt|\204\214\264JNRVZ^bfjnrvz~\202\206\212\216^\001\006\0248\220`\301\352\272V\245\332\335E\004"
+	.text
+	.section	.gnu.lto_.decls.346a08eda05aec2a,"e",@progbits
+	.string	"(\265/\375`EU\3357\001\232\370\371mS\0208%\251\244\003\341\243c!\320\235\210\215b\316\304L\016g\022A\213#\2023\333\231\025TEQ\024EU\005UTkcX\330)\321\212%\260\244\007\244wP\262l\363\264\357W\213r\241`X\037\363\224\246\275\t\r\373`T1\233[\272\222F\210\334r\247\316\005\266\006"
+	.string	"\007\\\203q\224\005Zq\363\025C\355"
+	.ascii	"\273r{\323\003RM\021\335\254\230\\\334<\205\342 \002\002\310"
+	.ascii	"\315R.sK\234vps\224\305\222c\310\b7\317H\303\243\261\304\315"
+	.ascii	"L\f\365\206u'\007\305OhK6\272\224i\367\336\031\227!\205dL\334"
+	.ascii	"\334\304Ng\031\034\303&{\260\f\024\246\356\355a\0313\206\367"
+	.ascii	"\366\314\324\nB\255 \364\231\025\030\034\332\347\302\224\223"
+	.ascii	"x\311MH\306\023%\206\201\372\230z\023\203\242\364A\227\006\320"
+	.ascii	"\200\262\305\315G\304\"A\312%\367\031.e\027\374\242\256\021q"
+	.ascii	"\321\273\307\324e\273W\031c{b,\231\343\376\240~@;\004:sxxxXC"
+	.ascii	"\240g\264\364\f\226\326\313@\334\"f\316\351\310\017nn\341\266"
+	.ascii	"CM\b7\373\324\266\252W\306\304\n7\367pTz6J+\022'\267\030\312"
+	.ascii	",\315r\030\025\276\032\306h\201\222\246\344\256Zj\333\013\026"
+	.ascii	"[Q\223\273f\211\211\372q\345\203\273\022\336\316N\265\315\311"
+	.ascii	"\340\256X\256\f\376\245uj/}M\222\326\260\270\364UGZ\2255\372"
+	.ascii	"\246\240j}=d|\257Sd\212|A!\343\256Rlh\3712\344\256Qn\007\363"
+	.ascii	"\204\005#\216\273B\271]\341\033\017'\334\365\311\355\210xL\254"
+	.ascii	"h\3301\rA[\302\375Z\224V\272Z\203\276\376\344-;\374\345iY5y]"
+	.ascii	"\272\024\006naqW&\265m\006\314\357\356\214\273.A\215\340\276"
+	.ascii	"\264pW%\237K\243\270=5\271+^Z\306W\265\205\273&\371\334\271V"
+	.ascii	"c\210\036w\275\313!\255\313Z\203^\205]\221\031-;r4q\327\"/>\004"
+	.ascii	"\233$\271+\021\242\252AA\356:\344s3B\326\244p\235H+`\255A\377"
+	.ascii	"*$\310KW\332\231\221\334k\020\024j\013\313!w\215\353 \274\274"
+	.ascii	"=\356\017~\356\277K%\023b\006\307}\024\244\177}s\353:?:- \257"
+	.ascii	"n\277\t)\374\257\303\275i\367\336\001\234[\250\202l\341\376`"
+	.ascii	"m\373\357\262B\325\227\034\367_\333\376\212V\323\352\017+D4u"
+	.ascii	"\335\356U\322\270\354\350Q\304\306\315V\343\244\314\240\270/"
+	.ascii	"C\372\277\256U\037\265\307\0051#dd\360\207\373\024H_\225\027"
+	.ascii	"@\317M\3412\3519\345[kPF\2525\350\225"
+	.string	"\365\003\232\326\032\324\002\261\260`\177]\332\240\337~\345\360v\232\377l\372+\223Z\267\034\200\365\312Sz\370\317\240\237\341,\327o]lq\0165\017\306\317(~^\3613\013~\346\371\031\207\237U\374\254\363\263\361\347\342\3179?\327\360s\013~\276\371\031\371\363\211\237S\374\314\202\223\"\240\241\003\032`\001\205\b\374\254V\202\325\322 &\265Y\377G\370{\360\257b5\354\257&0\035\277\260X\177\365\272\002\204j\376\223\346\2571\376\232\303_\221\376\352\202\277*\375\025\306_\357_q\370\353\320_[\374\325\351\257/\376\372\363\327\344_\203\376\312\342\2573\370\253\317_a\360\327\246\277\312\340\2577\374\365\005\1775\372k\321_\201\376z\364\327\236\277&\375\225\350\257.\376\032\203\2772\375u\305_\205~~QS\324\233J\202J\242n\240b\240\252P\027P?\250\347\r?\345\313\027y\220\273\375\027\301\177\006\240\256H"
+	.string	"vF\036\374\214\304\3328*"
+	.string	"\023$\020~^bk$\035\340g)\366\352\177\007\224\022\300}0B\020\\Z"
+	.ascii	"\223\211\001Wb8\200\260\211\204\237\003\255\224\223\210\237\003"
+	.ascii	"\255\224\214\023\316\247\024~\333VP\020\370m[\315\210\200L\324"
+	.ascii	"\n\277\215\201\222\242@\007U\035\320\260\300oA\240\352`\n\003"
+	.ascii	"\013\230\25213&\\\346?G\374\266\004\032\177\215\251&Te\340\004"
+	.ascii	"\253\027R\270\212\341\347@\251\377%jl`\205ZcC\206\337b \352\257"
+	.ascii	"3`\315\360\333\f\314\370\037B\326\007`\320\"\361\333\030\250"
+	.ascii	"-\020\314\360\204\3430\377)\202\337\222\220\201\342\304\377$"
+	.ascii	"A\b\274L0\202/\024\374\366\303o%\340\364\333\246\337\3260\230"
+	.ascii	"\211\023\204\331\374v\0050\254\n\376\352D\354\346\347\036V\351"
+	.ascii	"\2672H\372_B\231\374\255\rH\201\325\004\263\227\377<\216\340"
+	.ascii	"\342C\374\371\2370\350\271\375\317\363\267-8\372\037\302\331"
+	.ascii	"\212\337\342`\364?\204\274\273\374'\016\034\244\350\177\t(O\377"
+	.ascii	"\263\370\202\274\212\202\305\317D\210\376\312<\372\2379$\355"
+	.ascii	"_\363\316\377Y\177\373\342\267A\277\235\301oc\360\333\027\374"
+	.ascii	"\326\005\2775\376V\347\267'~[\374\355\315oO\360\333\022\374v"
+	.ascii	"\004\277\r\301oK\374\326\003\277\325\300oa\370\255\013\277e\341"
+	.ascii	"\267+\374\026\002\277M\341\267'\374V\304oE\370\255\001~+\200"
+	.ascii	"\337z\370\255\314o]~K\374\355\371\263\341\317Z~&\374\371\312"
+	.ascii	"\317\314\237\005\177\356\373\231\357\347\345\317L~\276\373\331"
+	.ascii	"\356\347\272\237\351~\026\362\363\333\317q?+\177\366\361\363"
+	.ascii	"\216\237\325~N\373\031\355\347\263\237\315~\276\361\263\330\317"
+	.ascii	"a?\203\375\374\365\263\327\317]?s\375\274\365\263\326\317Y?c"
+	.ascii	"\375l\343\347\032?_\375l\365s\325\317T?O\375L\343g\251\237\243"
+	.ascii	"~\236\3613\324\317O?\313\370\331\351\347\246\237c\374\314\364"
+	.ascii	"\363\322\3170~V\3729\351g\244\237\217~6\372\271\350g\242\237"
+	.ascii	"\205~\376\371\331\347\347\236\237\223?\337\277.\377\372\364\327"
+	.ascii	"\261\237s\370\353\220\237_\360\327+\177e\3765\360\2573\374\265"
+	.ascii	"\203\377%\376w\340\257P\376J\365W'\177E\361W\023\376:\363?\204"
+	.ascii	"\277\326\3745\357\2579\376J\366W\034\177\205\372\337\363\037"
+	.ascii	"\357\177\004\016\017\017\017\377\016\033\37409\177\005\312\002"
+	.ascii	"N\366z\262X\275\257\230E\376\240pwUj\243\307\222?\356\246\352"
+	.ascii	"\251\030$}]-\246\236\\\231\301q7\215\300'(C\270\377\242\324R"
+	.ascii	"/B3\240\\\276\332\340\254<\275\241f\230\342\222O\270[F\003\325"
+	.ascii	")N\232\304\270\333\211\307\356\242\002\267\232\232\200\265\301"
+	.ascii	"5u\f\273\"?\004\207\020\301\341h&\313\2076\265\305\001\r\302"
+	.ascii	"P\322qv\247\226\364V\202\221c\026\t\342n\244\006r\t\334"
+	.string	"\272Sw\231\222\376m\324E3O\354\266\2205\321\273\310p\256\207\213\273_4\320\021\217@.\373\344\bZ\r<\356\273\334\245\177\017\265\320\313\326`\326\226\016z\0131\221=\265\264\006\2522\332hd5P\267\230\261\201\245\327T\007\305\305\022\367]\200\244\177\373t\317\013^\0172\303N\276{\230\217\230\304\206\236\022\267=\354\373\337%\007.\273\236\276\325\307\217>5;\356\017\332f\036\321\r\250\246\335\222w\346U\270$\222iIa1\264A\210AK~c\334wQK_\224\365\003Z\263j\rz\227\257\364\267W^\327\354\025\233\007\203\362&a\336\326\266\244\b/\022\022\003\236ZI\255X\346\f\363\207`\025\023+\202\201\034\365\023\305\304\rx\306\350cs\302\375t.\375o\377\352\232\255b\371^ET\261S\254_]:]\022\304\254\222\224\335{A\210@4;[\032u\377\226\312\255\337\317@\254\024[\245\002"
+	.ascii	"\270\004\"\321\211q\333>\021\267TjP$'\345u\003\262\344\224\307"
+	.ascii	"m\201Z\203>\r"
+	.string	"K\237R\245}\243@\231!\222\001#\t\203\247\005\325\344\266N\026\260\203\215\211\373)\220\335\323\263y{\201XI\270\227i\226\024\321\033\367\211\204\351S"
+	.string	"b\253\2542\214\b\304\212\013\260\306\375T"
+	.string	"Br\001\332\323b\373a\253\274\302\332\224M&a\331\317O\254\235\235\263D\352\322\355\366\300@\301\f\251\311$\214\352\301|V\031Fl\2632\003\264\3125\313C&\351\341\372\354\235\205\335{o\317\320,\217\022t\2045\231\204v\326\206\225\033\200\217\320\355\271\232"
+	.string	"\331m2\t}\334&\023\317\326Y$\366\316&\261F\354\022\253\3046\261E,\023{\244\256Y;\033\344\254\304\n\371\tn\266\n\005\262\251&\223\320\316\2321_]:\335d \002t,\233L\302{\2250N]nY\035\264\035r\n^\311)\341>\261\207\245#\352H\371\326\017\350\211Z\351o\345l\034\320UU\217\314\234\321\217\0268\373\026\323\304\2417\203\373D\246\364D\244\364\304\027\351\211@\351\211\311\024\204\225\364h_z4/-\241~@m\232U\253k \354\216\231\252\347c4\203\373h\222t\006\267\202@\177XA\240G\351R\025\352\007\364\350Z\372\245\016\017f\2241\212\256r\204\360S\027\227F\206\243N\261\301\341\340f\273ivyP\334\257i5\3567"
+	.string	"\037!\030rd\001\274a\305c2\347\275S\205a\326\313^\361X]f] M\013\240\215\352\262U2\366^\251-\\dB\n\326\313J\331\252\272t\232\300\231!\240\227\265a\2658"
+	.string	"\273\177J\b\303,\230\275a\305\354\230\375\252k\326\253\366\270\335\262\\\"\210\340\002\203G\031\024\231>\n\226Ve\375\200\202\260ZYtm]0\224D \035hI\026\213\005e\262h\335Xr\037\315J\217R\245G\241\322\243K\251\245a\247\352\232\007\226J9\023\3234k\026r\037%J_=@\353a\365"
+	.ascii	"\375Y\230\206\250\037\320\337\316\200\252\021\322\306g\255\222"
+	.ascii	"_\214\033\334\312\237{/\210\030\240\"Ky\334~\265J\355;\343*\266"
+	.ascii	"\342--5\036\\\376)){R\205\345D\204\375\266"
+	.string	"\211\2336\211\263X\030v\311&\231\320\272\260@V\206%\262-l\217\025b-\366\332\0376\264N|\310X\270\320\036Y#\033d\221\254\217U\262E\366\005o\2611\370\212\035\252k\226\211\005\317V\230y\020\312{\177\356\275G*\222\232\3476g\244\332\275\331\3411\320\321\216\nW\205\304\001\341 \\D\006\263\361\217\2500f\343\266\3327C\311\022\0062\002\f\254}f\254\204\t;)\n\333\253Tj\037\004\224\"\002Y\016\351OI\231\225\332\254[\276\200\270\261\334\223\337_\355C\003\024\254}e\034\304B\f\304eg\204\2238Ya\326-`G\252^}\343Q\017\223\f\324\025V\305\305fYauG\345Q\337\"@\367\247\244\354\t\024\376\023\241\374SR\026\304CL\265\025v\257\362'\374|\346\243\276I\035\362\255[\274\346\350\252\035\\\335\253Nj_]:y\270?>\324\302\370\f\215{\324\245\223\362*\235"
+	.ascii	"\370\247\244\354^\345k\332/\30221 \313\251 \232\272CA>.\354\031"
+	.ascii	"\340\037\031\341\275J\021D\020A\004\020\"\020\235\354p\342\202"
+	.ascii	"\241\177\362Hi\224\365\003\312N\265\006\375\251\225\376|J\177"
+	.ascii	"\026\245o,\351\317\177~i\024#F\370\250\234\375P@\252#%7\367!"
+	.ascii	"\311\360\031\342s\241T'\305\315|\314Rx\312\231\217\243\334\204"
+	.ascii	"\024\336\341\347\246\335\253d\276\276\267\247V\020dj\005\341"
+	.ascii	"\264\363\352\361\201\366;0}7I=8\341=\342\220\031u2X\357\274W"
+	.ascii	"\375\216\fvqs^\367\030\312@\343\346\345\355n\b\361\323\342\346"
+	.ascii	"&\267\213I\"\0322k#\351[\231~Pk\320wW\372s\022\276\233QU\366"
+	.ascii	"\202\233\357\200`$Q\341\346#\265-yt\245\213\373\203!f\\\264]"
+	.ascii	"\361\341~G\245%\024\251kjBG\310\315u.T\\\202j\334<\244\303\327"
+	.ascii	"\r%,t0J\206[\374\204\360\334\024\221\333\024\367\273GH\025\271"
+	.ascii	"\270+t5\370\2709\316^\271\242\007\306\315o\265Mok+\220\373\203"
+	.ascii	"\035\226\232A\210p\337\342\245W\322\245\267m\351\351p\364X\263"
+	.ascii	"_yRjp\363\332\026\037\023\0307\363pq\021\024\227\307\315;\322"
+	.ascii	"%*X-\270Y\255:\001K\336\340\3464\036{\261Q\210\025g#\375\322"
+	.string	"\214\313`\246\236\004\"\261\216sYk\261!\244\306\3159\202\214,\323\270\231\254\305\213$\026n\306q\273\224)\256\311\024n\366\342\261$\036\332\rn\376b\260\272\026\002\207\235\305\370\306\317\036\345U\336\253\234a\256-o>\270=\324\017(\327\032\3646*}\r\001\265\207\2075\004\224\273^\244?o\261\226\335X\333\025n\326\202\201\254n\213\233\261j\233\214_\262\347\212\233mT*]R~\334\001\034\2001\347\303\21561\324\f\327\035\320\0267\n\003\215\341\302L*\216\033eZ\362:\374\301}\032%t\311C!\212\204\"\241F/\332\312\331\021\030\334\367\020\005}\201\276@\215\210\232\317'\310\030Zt\324\bN\353\256\220\033%\n\202\016\241Ch\213\242\003l1\022\343\276\207\034h\020\032\204\2660\212),\202k\302}\017T\315&\332\342\350\005J\nK\033\372s\264\205\030\022(%n\324\007\355A\223\350=\364"
+	.ascii	"dh\350$\203tV\225\264\242E\213\f\264\216(\211\234\036!\341S\207"
+	.ascii	"\270+N\320\342\256\\\201\"\312A9j\002c2g\300<\255\221\005r\177"
+	.ascii	"\206\311\317\357\024\214\252\177YD\205g\340O\301B\",\032\334"
+	.ascii	"'\340Y\345\374\033\354\353;\353h\240g7\n\r\235\350\351\235|Y"
+	.ascii	"a\255\326\027\205wJ\371\311\027E\245\013\210\373\214rB9\237\234"
+	.ascii	"N\316=\273\345R\213x\264D\246C\211\207w2\331\n\023\362\302\310"
+	.ascii	"\215s\311O&\207?\340\270\270O%`G\216\234w\\\347T\332\024)'\222"
+	.ascii	"\237wilN\212d\242\354\354\316\272\352A\351\263\347\205\022\261"
+	.ascii	"\242\306\344\276\314\020\021\"g\035\b\262\274\260\030\177Yu\177"
+	.ascii	"z8\276\340\256\320\321\235Bn\177\256\324]\330\275N!\\\242\276"
+	.ascii	"r\364q?f\231\006\tr\n\251=\356\021\032G\365\367Dx\257S\210\027"
+	.ascii	"\247#YZ\334!\324pX\371\343~\314\327\217\023\356\307\031\367\301"
+	.ascii	"\237q0T\242r\374\340>\333\316\266\363M\020\204\302@\247\020)"
+	.ascii	"(\233\002t\272\375|k\240(\302\271\241\023\b\026\034L\362\347"
+	.ascii	"O\220\37311\322w\300\222\236\312s\355T\236>\320{\253r\352\b\251"
+	.ascii	"\307O\037GG\255\224&?@\265%U\326\341IZ\244H\037)\352\034\235"
+	.ascii	"\243\205\352EB\301,\217\216\256\2114[\2635\334\236SXZZ\367H!"
+	.ascii	"iK\252\254\227z\3514\263\200\330\226TY\331O\263\016nVDtp\237"
+	.ascii	":\032\310\n\207\024\367\231C\346\352\350L\313I\006\203\245\f"
+	.ascii	"\b\307Iv\342\200\211\302\234\373\001\030\303\204\246\025\203"
+	.ascii	"\273\345Z\256\205\224 F\265%E\330.\332E\027=\211\352\237\376"
+	.ascii	"i\241'i\201\201\034\367\244\017\020\360\211\226*U8n(\354:!1\024"
+	.ascii	"\206\302~\307\344\226T\031\023&\274Gc\311\222/<<n\241f\304\b"
+	.ascii	"\337\311\005\t\302uxnn\0347\245\255-J\226\037?\352\024!\037>"
+	.ascii	"\252\333\021\032\032\257Iqqq\231\227\225\025k\245\r\r\361T\234"
+	.ascii	"\220P\222d\222[\360\361\345K\330l\362\035"
+	.ascii	"2\231\325\320HP0*0\260\253J\025\264\277?8*T\356\2348\251S\244"
+	.ascii	"\350\351U\267*H\220\324e_\323\210\221\":\272Zd\006\034\\\r\302"
+	.ascii	"\025v\235\220*\217\312\243\272y\270>~ga\327\t)\004\017\362`u"
+	.ascii	"\003\342\365\006X\315\352\351\342u\355tq\022\211\300K:_\240\177"
+	.ascii	"\\Ba\334\3570\227\276\303Yj\013_x\n\325{\357u\272\311@\021\203"
+	.ascii	"TH!N!:\275 A\270O\240\332\006\304t\215\272\272:\214\357\2757"
+	.ascii	"\214\bg\345\007\250CG\233\255\020"
+	.string	"\270%U\206\206\3268 @\265%Uvwg\357\225R\022\326\207\347}'y\2226K\357\275I\345=\"\016\345mI\021^\247\245\020\177=\377\350\355A\272\367*\235\312\213\344\323\001\375\353\353Yk\210?\246\332j\200\377}\257\nH\345\365isr\357\255\314tl\256\007\212\373\377\007\367\\\336\373S\225\274@U\322OU\223\020[U\022\215\020[\325M\376|%i\220nUR\210\355^\232\237\237d\013SIBl=\227F\210\355&\335\026zI\365*\253\222\367g\352\322\334\237\333s\331\246\222>\020\372\251J\022b\353I\242\021b\253J\272lU\327\303\375\351A\032\372\271H4\227\255*\360\262M%y\020b\233J\022b\253*\253fC{K0~8\301rQ\207\b\375\\\243\242\031=H\036\226B\312\251+\345\336\352\006t\221\356\362^\003\334;c\nIJOS\245\363Y\032\371\310\365LU\345\2757"
+	.string	"E>VS\367g\231\254w)\204c\352^\034>(n\321\275\367\242\220T.\257V]&\257f\\\"\240{;\270\312{\213\356M\326\273\274\367&\357\275D\244\031\312{\237<\b\205\025\025\335\353\004\242\350\316H\016\001\272\227\335\246\320%\t\261YM\211\030\322\306\026v\203\224\311*D4u\303\256\224*\244\224-\271v\211\356\275\325J\032\226\004C\320\260\267(e\226}NO\334\357\020dX\315\252%|]\263\204\255\305E\350\336\245\005`Yb@g!\256Y\201\312\343>\214\225t\251g(\233L\302\306k=\244&\263\354\247\207"
+	.string	"\233L\302\"\215\004\260\311,\253\212\352\032aMf\231\216\025\350\232\3142\271\236CCb\353j\261\252\017\324n\223Ix\3240\350\232\3142\033\275E\201\251&\263,I\237\231\321\001\311\321Ch\313&\223\360\214\253\267\324\220\232LB\027mT\202\332\262\311$Lk\037aMf\331\241-l\037\013\334&\363\256\317\224\260u\334T\223Yv\257\322\016\255\311VP6\231\215\245\371\372J\3675`\0236\263\2534\225\016\354\275\366k+\r\245\247t\224\026l'=\330R\372\257\256\365\023\373v\233\305j\241\353\272\025n\223Y\326O\372F\223Q5"
+	.ascii	"\rp\306\212\215 \206\r\320\313+\301\223#1\226\357<4I\r\266(\356"
+	.ascii	"n\322@KnCL\272\312\222(IJz\t\003\231R$\013\367a\360\224\300\274"
+	.ascii	"\245\207aK\017\223\226\376\215\244\217\240QY\330\250\264\221"
+	.ascii	"\367\021\273!3*#\334m\327@\350\035b\3666\210\307\207\204\305"
+	.ascii	"}\230\260:\"\035\220\334!\365\ry\023\341j\273r\003\246\347ZH"
+	.ascii	"\343\021\252a\351 o!vEfI"
+	.string	"\206\236\342\340,\020#Xn\274\275\341\306\254\264Aq\267[\003Y`\013\r\nw\003\331\300]_\013\356n\263U@\222\224Qq\367\017[\005\203\266\364\246\003JG\341\013(\334\2071J\377\366\321=^\300\206\336\214z\355\335\303\356\224\342Z\"q\267\262\201\370\213\311\024\023w\363\260U.G@R\230p\367\016[ET\022{z\342n5[\325W\005\217\210\255:\255\256P\231\343>\314O\372\227*gf\250\033\334\230a\331\333\354v\026\230Z\222{\222\376\205\t\031\216\364J\026\345\340\330\033G\236\226\037@\334v\351\337b\035\206\032Q\241\"\325^\357\260\006\033\242\004\213(D\177\271\374(g\\\240X\211r\343\376\213\\\372\242L\377\"\266\245\205\322\030\324#\312zki\031!Rr7V\003\315(\251\031\371Q\243\306\325\031\305\027\344\220\300\3111\276\260B\346\205\234\235\016\310\234\235\030`\2161\214@\332\340\250"
+	.string	"\201\fN\216\361\205\235\030D\320\301\021\007\036\032\216:<#pr\214/ \213/\034\007\300\002\210\021$Hx@B"
+	.string	"$\212*X\224\030A\203\rG\033\031Z\230\261\341h#C\0132\220p\241\003\027n\2124\b "
+	.string	".\024`\204\007\032\024\307\025#4\370p\024\035\274\300\001"
+	.string	"\2209;1\020\240\204\021\220F\033\025#\320 7\370M\216\261\270S<\221\036\205\0078\340\001*\270\200x\025$P\202\004J@\257\202\004D\210\220\300\003D\244\177\200\b[4\221\242\210<\262 \301S\304\311\271!\006Y4\201\263\263\202\307x\302\206\033\033\026\220\305#\315\nl\214'\272x\264)\352\024\215D\230\342\013rH\274\300\030mP\214p9\036\213\306\023<F\017\354\304`,\326p\314\331"
+	.string	"iS\\\001\322hSD\341\202\203\215\021\247hDq\2127;,H\034sR\244\t\023N(\026\215.\034\213H\026,\270"
+	.string	"\t\203SD\032yT\250X!\203\274)\352\024I\300\024M\030\213,l8\240\001\013\025<#\214E\0266:.\310\035\036\027\212\310\034#\016\032\260\300\261)\322`\303M\021\305\315\313N\316\211\342\n< sR\244\340\271\241A\026O\270\310\\\001-\340\034g\2501\332\024u\216b\004\234#O"
+	.string	"l\22068}4\201s\344\221)\356\360\344 ol\220G1\202\007E\023-"
+	.ascii	"\240\250\202E\211\227\243\211\030\244\221\307\0035G\034x\214"
+	.ascii	"}\324\341\271\351\021\034yT4\t\216<*z\247X4\336\034utV\270P<"
+	.ascii	"\256\210\301)\022q\340\241\301\310s4\256\270qA\221;+xF\254\300"
+	.ascii	"\306x\302\305\206\235\034\035\026Z(\036W\310\300@s\003Z\274\311"
+	.ascii	"\271\241\210\203\242@\342\344\340p\"Q\234\310)\242@\221&T@\356"
+	.ascii	"\344\254 \"w\212)\212:\031\300\3111\236\360p\024#\334\2308\032"
+	.ascii	"\2137\344\030q\020p\036\025E#\tH\036\036#\t0*x^\216&\212:+\260"
+	.ascii	")\021\202\017\310\342\261\003\316\016\006>\350\360\360\260`\342"
+	.string	"\334\341\3119\032\2137\354\304\200,\036i\322\017::9.\360\224\320)\272 \307\003\310\342\261\006\005\022'G\004\310\342Q\246h\242\250\202E\211\016\212*X\224\320\240\270\223\243\203\\1Cq'\207\003\310\342\261\006yS\244\201\247\204\212\034\235\233\027\344M\221\006\243MQ\347\306\245\210\264A\2228\261\223\203\203\215\261\005d\361X4\322\304 M<@\004r'gEj\303\321F\006c\021ycc\264A1\002\007\033#\016\315\213\321\006\305M\027M\030ytxFl\2004\261\303\223\203T1\203\n\233\024\310\034\026\004`\303\321F\206\023;9F$\t\034l\214827\360\244\200A\356\344\360x\200\247Dq'\207\0034G\031\035\235\234\032:\024uN\354\330\344\030Khp|\321\321\311\251!E\336\024i\2209\326\350\350\344\324@\203\274)\322\260\023C\361\250\"GG'\003E\033x\214H\022::95"
+	.string	""
+	.ascii	"Y<\026iH\201\274I\221E\022)\2207h\021i\243s\334\2611\226H\201"
+	.ascii	"\274\351P\324\261\271!\221\002y\223\026\2216H\036\032R o\\\220"
+	.ascii	"G\023G\233\033vlF\314\\\204\210\021\037"
+	.string	"\200\240\003/\2447#\340\034yL\260\260\341h\254\301\004\322\310\243\202\205\215\216\212c\016\016\t<9$\354\344\330\244 \341\306x$a\204\004\2408\256\360"
+	.ascii	"\322\005E\344\016\317\r\314\177bXk\031\3132F\003\214\030TDL\316"
+	.ascii	"\211\233\350E\364Jr\200\227\376\304\2563.&L\te\217\213\370\342"
+	.ascii	"%\210\017\316k\313\254CY\224_\217\226\020\3210H\020)\213\210"
+	.ascii	"\357\232\334\271\300\272\233\271r*|\263\301\244\r\263\bM\325"
+	.ascii	"8\371\210Mh\274}]\265\230\371Z\322\020\264B\241\300\206\214\031"
+	.ascii	"VUmI\225\345Qm\311\330\200\352a\233\022s)\312\nJ\242q\nr\r\032"
+	.ascii	"\036\221\352\321\241I\265\006\024\325\366b\304\351On\206\221"
+	.ascii	"1\353\b\r(:n{b.=\025\341\256&?\0322P\264,NU\266\020\231\210L"
+	.ascii	"\304&+\037\334\211\021c\234\330\204\306\210b\226\205\215\003"
+	.ascii	"\270\364'.\355\021\273\222\205\2000N\037J\350!\013\202D5\222"
+	.ascii	"\250\364\331\f'qH\202/5\232FiG(a=k\036\335\031\235B\324n\204"
+	.ascii	"\005\026\235uo2\262\254\270\211C\304"
+	.string	"!\342\213!.|H?\244\210.N|\021C'\343\017\3079P#&\211Ib\220\335m2\t\265\226\\\205\021\201N\f:i\254Iyq\023[4\020\325 \331\024nb\017\361\007\006Y\025\342\017\321G&\211\227TSgI\337\370\366\242\210\374wY@\025\035=\270\317\201\030\332D\233\350a\305\262={DW\334\350\241\330\230\025\021\225\241a\037\t[~\236\270\317A\221\026-Q\002\377\236\312\254V\024_\223\373\037\232L&J\250\004\006\256\360\007\033\226\243\204?U\354\266p\243WB4\345\260Z\342F\007C\264\240\2226\252\017O\320?\364\017\245\262\004\260N\3413<\f<*H\274cRC\214\033\005\f\241\305o\t\0267Z%DO\034\023\030c\315c\314\311\006\367?\b\341\343C\251T\017J\237)r\200i\337\214\247\243\276\243T\2160\213\270\321)!f\346\274\372\276>\214\241Q\320(B^\016\301"
+	.string	"\325\270\377\201\006\372\004}\362\026\370\367D\250V\244H\031\367?\274`\302\004\335ss!:\362\341\247wt/\345\321w\201\362fr\034u\361h\202.\255\222\200G\334\337\340\257\311\006vJ\224\234u \246,_\322\337S\031!\031\334\031\3677@K\222\004E\343s!rE\350\305\375\r\256\220 A\321\246\334Q\351C\343\376\006GF\214\240h})\033\033\036\026\356\327\004\022!\202\026\0011e\375\326\376\236\312\032\220N\257F\335\321\"ZT\230\372\216\310\311\241t~h\226\273D\202\316\035\245\363\021#K\216\033\025r\273\230'#i;\270\321 \267\363j\203\002\325\006\007\367'c\304d6%\313\315\r5\252\242#\020\250\214\3735Dllh\033!g\031RD\003\375q\264-I\017\237\223A55\264G\026\230\333$k\n\272v\264G\220%fJTi#OI\0207\312\343\246g\207Yi\334\327"
+	.string	"\017\335\241\201\322\314\fE\323\322\00558\210\236\035E\373\213\301\262t\003\213\373\203h\214\253\346\025\223+\035:\fa\222}\177>\334\327 \211\214\354\024\334B,Kf\r\036\216\215\235uM\233\266\264\344\307}\232'h\027\332\205\212\035\312\360a\t\322\025vT\354"
+	.string	"H\226z\334(Xz\263\240\232p\243_\267\203\231\213\221\265\205\033\365\3421\231\250\2672\246\271\253+tK\350%\313`\017,\255\243[M|\210|p\243YrUN\232p\243XY\206m}\334\250\r\036k\277=-Q\334h\r24\n\215B\253\206\324\312\260\320\241TG\253\376\226z\272\352\270\321\251\333\245sLMV\334(\215\333\351"
+	.string	"\253b\306\215J\235\351aI\321T\241J\250\022\n\345B\350\313\213\n}:\n\225\352\305\030B\310\215\312\270]L\032\263\006\016n\324)\206\246\250\243a\005\222T\034\"\005\241#\"\"\"I\222\244\003s\030 \b\bG\003E\220|{\023\200E\312\t6\261\"\347\030sFFD\202(HA\nJ\n\225\345\330\313.\006k\003\342\343D\224\350\307X$\275\204\026\326\013\013\033\361\315\030\331\036&"
+	.string	"\t\bk\253\tM\216\006\255\351\013\262\241|5\214\371f\261c\324\036\206J\237\375_\367\352\264\306\232\331\276\022\275\361\013\343\t\237\302\201R\03023\361\006\027\372\277\350^)\347h\231{\331\257\223\215s\304"
+	.string	"\257\256M\230\351\261\271h\366g\2635\260\334n\317\253\205\017\242\2474\243\t\0034\220\361Z1\2158\362\375DwU\271\246\362\\\310Y\360i\205\310\373Oc\305\257\tGy\";Y\345\225U\355\006\353\024\311z\350\303\205\321\343\235\201\335\005\356\247_\212\333xe\276#?\306bv\373\225\f-/\243\036\240\330\304\242\026\340\321\354u\220\340\254\224MB\261\227>$N\270\302%\215\234P\276.\312\343G\343\372\246j\203\267\255\250\204y\246}HQ\362\262\213?%`\210\317d\226\020\340\323\201\3559>\265\310\\\335K\020d\016_\214!\261\306\203Q\242\371\016\250\246\300x\375*\202RWPIr!\235t=RI\302\220\343M\357\2149`\261\257\204d\032\031\221GA2\0022W\304\t\255"
+	.string	"I\200s\261x\026\311\316\312\377U\001T \035\310D\273\237~\322=\r7\377\007\342\214\n\372\327<>\234P\365\260\301\354\304\234W2\334G\f\036k\250\361f\nS\235|\221\246\363P\007\242\230$\375u@Ez/&S\346\017\247\375\355\325C\337\332\202\272L\004j\246\021\247\337\277~\214u\035}L1\254\232\b\215\374\317e\243\026X\270\252\376\022`\003\200\347\260\007Ho\203\356\231\325\021Hj\336\"t\276\020T\367\217\311\026n\302g\337\334\031\215\345]D\343z\350\bXC?i\026"
+	.ascii	"P\230\373\332\204\244~\245\256\200\004\3433\376\201cvP)fI4n\247"
+	.ascii	"\216\236\036\0321 G\002\370\241=\203~&\340\355\236\327\2100\336"
+	.ascii	"\t\205\255\026.7q\355&C;I=d\004\002\005\026%\004\331>[V\r\336"
+	.ascii	"\273\370\246\227\270\005\220[9\201\305z\f\277'\272\231\276'C"
+	.ascii	"\262\231\314&$W\260\220W{\255\203\177V\001\361h[y\361\343\225"
+	.ascii	"\251\022\324}\230\364v5G\0278/\2679\377>\347\333Yp\210\301\244"
+	.ascii	"\202\361\rt\213Zf\272\305e\2003\347q;\300yw]"
+	.string	"\265?\246\026Z3\245\342\\\276\211\300$j\341F\221\276fy1\237\206\244\177\365\237b\266\031l\r\366^\236nVc\263I\035d\370/1\275\340t(UF\302\013[zt@\001\213\233\250\241\270Fr9\203\t\031\031\206_WH\036\356r\330\314\f\347\225\237\356\231R\200\223mad5\177\004x\335\307\215\247\363\202\2101\27562\352fL`\270\213\366'\304\247Y\305\004\005Qm\262F\336\313sH5\360/\235\305\246\n\224\357X\274N\322\301\255\034(\256\352]\334N\360H\317>\302|\372mj\023\240I^\005R\200\260H\361+t\231\354\231\332\021+\016\275\230\212\026R\035\332\325\267!\233\027\274\366\262\220\001l\242\227\216\354\221E\235#!jn\250X\314\257+\007\205{\307zj\215\312\272\034\2409Ks\001\246\222D8l\332f\203\0021\264\203'\te\037\300\254\r)\243N\310\255b\332\337 s"
+	.ascii	"\337*\344\365\037\371\r\r\270?pLH"
+	.string	"<&\344\221G\n\202\005.G\034\334\206\200!V\n\243)\204\356\353_\3651\366g~:\214\202%\rz\254\247\007J\035\200`\203U:\243\271k\030\200\236\357\335\242\020F'\226['\241\235"
+	.string	"Q}0\346\030/\230!$\314\034\001z\003W\215.\233/\332\222\346\236\232e\301\017\200C| \320\332\232\332\021\375w\t+\034\001\337\232\022)\013\316\r]d\3258B}\203u\265\206\222\021q\373\0255\036\254`\361\206jP\374\034V\243T\323\315@\246\312\204h?\252i7\367\271\322\266\223\213\034i\207\311w\243\214\341\230\235\215\tr\327\222\251\253\376Y\004c\265UT\350\261\217\2178\350 .\f\234\300\225\030/\0223\343\216\225\206;\243\256C\230l`\253\374\233\240y\2411\302o\267YGi\r\324Q1\234p\324\256\005\261^\251\250j\347\372q\020\3210F\"\340\3064\313L=Z0\341\250%\345+\332\254\255\276d\266\375\227\321\326\322(\311\220\325B\205\312M\003_\320"
+	.string	"K`\301^\346\210\tXsMUZ\211\346\210=\002\036\377\315\256\031@\340\322\203\"\374\222\226}\271\252\301&\213\300\223\274\177\003\206}\327"
+	.string	"\246\006\252\311\245\231t\254\253\315g\363\363\374_\360\261\361a\360\241O\033o\331y3\372\320\206\355\201\315\203\237\267\314-\037\204\275el\376\356\357\3230i\320/t\206\335\027lsN\312sY\374\376:\225T!\257TL\362\375\321\007`\305k\252H\020:\324J\210\306\255\311\255"
+	.string	"\253F\fp\033x\262\242\261\363\236\272V\301\314\342I\273r\230H7\254Vc\364|\241\023\202\027\302\363{\013bn\0027\3129\321\207(\342\252\2355\252\353\324\031\201P\227\243\232\235\0251\266B\3743i\320r\027k\327\001\340\013\275\240C\242\254.\202H\222i\201\264\352X\200\001<\213a;*\266\311\322\363K\035Fm\023D\342\342f\213\205\332D\004\202ufb\221\"\314\275lRs\237\344[A\003 \206\234T\f\374j-\fy\332\030\300\323\350BT\013\255\245!\337s\023\001gd\236V\225\205\333\322\343+\335q\256Zt\274\306*\252\334\322h\372\031\215l\236\"\237\270X%d\251\315\201 \317\261a\337G\252\341B\366\254`'r\200'|\230\312\251\226r\321\300*\036\224\227\210\371\363Q\333w\267u9"
+	.string	"\370t\256\0044\311\037O\346\3126z\312(JP\030t\004(t\300\002wfH\210}\020\314\004w\025B\313D\311J\311;\265\372<\360\301A\354\027\345\0279V\r\207\312g\0328~\276\317\317\206\230\320\n\220\220\330}(\271l\207\002\373\334$\265\362FB\003\351\034\004\026_\377'\374\204\255x\\t$\226|\030\304\252\016\267d\253\2219\233\321\363'7\024\202\234\222)\033\256\"\212U\013\205\352o\204`\377\004n\203\263\021\034\334u\001"
+	.ascii	"\207\006f\016\244-!2\256W\231\266<Da\033-Q\373\361\257-\352\327"
+	.ascii	"\247\246\342\221u\202\376\211\372\360\251[\344\337q\215\306\004"
+	.ascii	"a\305<\233W\333T\3606\032x\275\256\301\324^\242\343\017H\351"
+	.ascii	"\372\305\3133Y\267C\002\316\023\212P\222\307\277G\266Q\022\227"
+	.ascii	"\211C\324\204n\272#\2613ZZ\314\364\277\177\031^$\3059\241|9\340"
+	.ascii	"\372\017\031\321\301O\r\3115\261: \360\006ylA\033A\240\363\266"
+	.ascii	"J\202h6\350\333\372Q=\223\246El\031\316&}\020\203\021\343hU."
+	.ascii	"[\254f\270\343\347\3313k\376\350n\237\031\"\341\007^\246;\024"
+	.ascii	"\345dC0JJN\375\377)\201\340>\317\366\346%\324\031\244QG\266p"
+	.ascii	"\251\222\320@\330\36728s\352\005(\002i\212\313+]\224\347\342"
+	.ascii	"\277\334|\211\203\003\253e\240\030\243\314\023T\007\320\261\276"
+	.ascii	"\232vY\227M\334E\f\213\335\300B\300\205 ?\"\\\005\205\237\253"
+	.ascii	"\261S\212\036\226>F\331Tj\n\302\234\021v\003'\020\350\215\224"
+	.ascii	"D)\315\362\005\222[\214\364wQm\276t\237\001\247\221b\334l\214"
+	.ascii	"8#\302\364\215\316\013\344\365\351\376\b\026\343I\206\253<\307"
+	.ascii	"0\332\024yPk\341"
+	.string	"\206\222St\261UO\320\013\222k\366\036b\302I\350\270\374\b\201Rv\204\260<\203E\031\313_\305s\325&\354\243p\236\250\362\262\361\316Md\323\374\317\327ZAa\314\313\341\336$\034\177?v\2606\371\003\344\313=U\017\353\251\256\002\034\346Z\227v\310nfd\312\031A\343\365H\332Z(U\372\023\230\363\"\304\rP\354\356~\025\351j\024\353\356\013a\335\034\333\244\337\307@m\247\243\315\343\023\213\303\006\270\217\035\022Z\342\t\216ld2$[$\366zV\202\242\252\367g\020\335I\361\350\265C\033\203H\006\261\365>j\242\264\203f\350\302\\\231\316\371\276K\307\232\321\262=\263E\205\227\020\177(O\250\247/\265j\026\264F\207\030\336\214\030\333\320\374\314\363\024WO\b\266\205\314@$\004\344$C}Cd\210s\310\005yj\246CZ\026W\021\264t\264\260\255\005F\224\327\024\002\252\027\353Z9\264BJ"
+	.string	"=\020\001B\177\267\377J\335 K\343\006.-s\367N\020\260F\212\3752\210\311\343\347\004(;\213\244\214.\024G6\022g_\264V\303\316\276\240L\257n\226\n\007\323\321\204\220(\240\322\257c\353\247\177\312\263\037\2649\034\002Xaf\022#\276\r\267\025]F\0344E\f\210>\325\311\017\252\261\313\r\372V\021\037\311\277K\2011\201\262\0375g\243V\023F\251\rNI\036g\331\255\313\373\333\251\200\322<H,\356\202#`wB\2264\275?6\371+\346mSJ\246\005\027e\n\222Z\035L\242\341y\337O\003\250\352\r\240\244\324#\035\331/\352R\244\350\017$\307\370\343\300\2428\035\026#\020\030\252\0330\256"
+	.ascii	"\320\022m\341o\343\340 c)\033N\263F\276\336C1\272|\3749\357y"
+	.ascii	"9\313\252\bL\252\r\222\225\304~\310I>B\254\274k\310\224\314s"
+	.ascii	"$\0313\"\370\312To\300mB>I\261s!/%\312\216\323\373\234\355\335"
+	.ascii	"\250\335&\343\227\274\236\222aq\222\336\246<\027\222\307L,\006"
+	.ascii	"M\275\220\317\334\211\275\367\372F<\036\003\337\207\266\246\027"
+	.ascii	"\271C:\255\354+\351Ob\322<\021s\021\030\036\001\345\007\331\341"
+	.ascii	"\0372n%\341\035,\234\003\025\3370.\327\200,<\203\027\216\301"
+	.ascii	"\210_\240r\013c\344\n\324\364\342\177I\256\217\312\235\207\212"
+	.ascii	"\311\0309\202\237W\322\313x\375g\325\323\247\256K]i\261\f\035"
+	.ascii	"\205\250\272\335\244\327\243\304~\023~\f\255_\247\366)\261\366"
+	.ascii	"\260?\326\304\375\320\266\026v\217\255M\206c\244\201\347\005"
+	.ascii	"\363\333n\0378Ww\275\025\273L\233\355/\373\232\303!\232\037q"
+	.ascii	"\272U{>\b}5\367H\270\035!\317o\001\377|g\322h\317x\346\234\217"
+	.ascii	"w0\260\235>\267\r\034\362\327\02418\264\270\217\037D9+;\322\336"
+	.ascii	"2\320\177\334\351\255\374\301\265\243\337\253V\355\304\217\372"
+	.ascii	"\371\2149\354\340L=k\356j|\022a\023Yb\n\300\213\232\336N\304"
+	.ascii	"\371\221\033o\342^\232\276K\223#\277\026\362\313\261\3055q3l"
+	.ascii	"\217r,\262\215S\007\023\027e\326\256\315AW\376-]/b\276.\f\006"
+	.ascii	"\3002R\347\300\372\246]i\034q\374f\320\235\370\271\203\376\352"
+	.ascii	"x\2643\306j\266\364\371\260\351E\377Q\357\322\217f\003\326C\023"
+	.ascii	"r\252X\r.\354\n"
+	.text
+	.section	.gnu.lto_.symtab.346a08eda05aec2a,"e",@progbits
+	.string	"frskyOsdDisplayPortInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"frskyOsdGetPixelHeight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"frskyOsdGetPixelWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"frskyOsdContextPop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"frskyOsdContextPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"frskyOsdCtmRotate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"frskyOsdCtmScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"frskyOsdCtmTranslate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"frskyOsdCtmSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"frskyOsdCtmReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"frskyOsdFillStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"frskyOsdFillEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"frskyOsdStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"frskyOsdFillStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"frskyOsdFillRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"frskyOsdStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"frskyOsdFillStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"frskyOsdFillTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"frskyOsdStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"frskyOsdStrokeLineToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"frskyOsdMoveToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"frskyOsdDrawStringMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"frskyOsdDrawString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"frskyOsdDrawCharacterMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"frskyOsdDrawCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"frskyOsdResetDrawingState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"frskyOsdClearRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"frskyOsdClipToRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"frskyOsdSetLineOutlineColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"frskyOsdSetLineOutlineType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"frskyOsdSetStrokeWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"frskyOsdSetPixelToFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"frskyOsdSetPixelToStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"frskyOsdSetPixel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"frskyOsdSetColorInversion"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"frskyOsdSetStrokeAndFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"frskyOsdSetFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"frskyOsdSetStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"frskyOsdCommitTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"frskyOsdBeginTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"frskyOsdGetGridCols"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"frskyOsdGetGridRows"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"frskyOsdWriteFontCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"frskyOsdDrawCharInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"frskyOsdDrawStringInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"frskyOsdUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"frskyOsdClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"frskyOsdIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"frskyOsdInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.346a08eda05aec2a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,609 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\315\005"
+	.string	"\364\b\013\001"
+	.string	"\020"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\215\377\300\244\017"
+	.string	"\004\334\305\271\347\016\002\002\002\002\003\006\300\371\254\336\b\006\002\004\002\004\002\005\002\005\b\t\200\251\364\305\007\n\217\201\261\224\013\020\002"
+	.string	"\002\006\002"
+	.string	"\002\007\f\256\217\352]\r\262\201\245\301\003\016\224\243\302\255\016\b\b\002\b\017\232\207\305\212\002\006\002\t\002\n\n\002\n\020\247\322\364\317\016\003\002\005\002\013\021\240\342\234\212\n\022\375\250\211\317\f"
+	.string	"\021"
+	.string	"q\023\307\356\024X\2309"
+	.ascii	"\002\354v\237\020\0248\212\030G\241`\302\252\310\022\002\017"
+	.ascii	"\216\262\351\367+Vv\226\026\300\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"m\004"
+	.string	"BF\021\031\300%\303\001\377\377\377\377\232\305\377\377\377\306\264\335\b\261\244\221F\366\2262\245\356\316#\375\302f\017\n=\222_K\3624\203H w\215@\261#\f\325Z\f\233\251+r\032\300\343\217\320y\302\037uH\213x\b\037"
+	.string	"_\205\210l\256\307\004\005\rp1\344zE\036f\f\020\bB\300\244\343\031\261\013"
+	.string	"\001\340"
+	.ascii	"\260ci\236$\022\324\301(*{\2000\026\312E\035\221i\345\262\233"
+	.ascii	"\004\303\025\013>\233\001|\201\251*an\240\r"
+	.text
+	.section	.gnu.lto_.inline.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`H\002\335\t"
+	.string	"\202N./`K\223\016P\020\325\246\230q\331\003\024 (\265\276\013Wn\204\002\232`\312j\355\333\0078UT"
+	.string	"p\216\003:^\315\354\030\351\233%{\357\024\337\224W\225\032m\241%\023\262C\306\276\352A\201<\311\222,6\233$\305\007\306\305nOI!G[\002\226\0212P\032\b\025\022\277\204t\250\210"
+	.string	"18\210\240\210\221\b\331\260<\367d{*\013\360\313\245\303c\340\002"
+	.string	"\332\037\373+\r\302\302\222\341\\s/Y\314/\211\374\020\336\367Ux\321\326\2319H\345D[\346\034\377\246\374\236)xk#\233\215\023l[\234\260\013m\033>\362=|\315\037\274\361\253\340\325\266\371\350D\b6 \200\002\241)#\017\360$%J\002\020\215\021\207^\032\300\202\b\362\300 Kp\234{\016\247\217\216%77\003BbdX\220e\004\306\200,!\204\245\023\337h\262\037\t\002\363(\334\360\267M\227YO\260C\252\325@t\231\006U\315"
+	.ascii	"F\213\034x'\275\214\255C\232\202\254\301\327\002\262\310cE\005"
+	.ascii	"\230\341\235t\330\006\267#\325h2\350c\324\035I{\324\004\377:"
+	.ascii	"\013$\301\360\350h\205\032\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`c\002\235\b"
+	.string	"\302\214%)\200)I\007\030\003+N\250\272\030\205\240\tj\254\313\315\005jcH\210&\206T`\030\342\021\266\326\3204d\333\266\233\310$\003$\257\246}\301j\320c\r\005=%!\021\273A\320\347\325\202z+\027\217:\244\224\322\301\254\260SW\206\360\3000\f\304@\213zJ\311\260\230\341@\002e\003\356\374\002\360\304K\034qC\341\336\022{\211u^9\231\230b\344\fV\336\354\025y\375+\236\230\216\231\024\326\357jx5\223\013\244?:\352%\374\247xz\311\377\362<\035<\2214 \200\002\241\252*\017+A\303'\243\252ka\255\262-\020\301\022\216\201>\314Zp\247"
+	.string	"\336\3000\300\303\334L\313\303\205\211\005\216:\0170\214\002\020\310\031\265\016\230v\301\n\367+\250\276H(\252"
+	.string	"\020\366\r3\307\234"
+	.ascii	"\255\223\241\226\343dbM<\237q\212~\271\374\007\024\366\370\034"
+	.ascii	"\255U[mp8c\035(\2506|'\006\267\001\341#bX\213\231\355\317\270"
+	.ascii	"\344X\205\032\002"
+	.text
+	.section	.gnu.lto_.pureconst.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\001\200\004\002\200\004\003\230\004\004\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\232\004\f\230\004\r\230\004\016"
+	.ascii	"\230\004\017\230\004\020\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\235\004"
+	.string	"\362\305\024 \260'\303\001\f\303\212R\301"
+	.string	"-.\316Iz\300=\3151\333\032\261\267-\013\333\366\336\233l)S'\030\212\342\374\334[(.\261C@\216\306\362M\221\357Y\203V\200(g\253\371\321\203\001\200:\224\210\206r\323\222Lq\231\363y\241\374\023\b_\257g\013\032"
+	.string	"BK\260\243\301\322\300\303y\354\026\374\254L\341\261\302\007\253\207\307\202\230\335\305\244\027\241\026\nV\002\357\200g\233cw1G\335\375\331\272\325\n"
+	.ascii	"\317\005\030\307Ve\307\237\253a\240\b"
+	.text
+	.section	.gnu.lto_.lto.f9c062ccbb072830,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_heartbeat.23.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\034\001\355\r"
+	.string	"F\332^E"
+	.string	"\2216\035\023Ac\260hn#\220\2713\247no\330\234\352\177\305`\237)N\027\202\307\251\364\251\024\315\"p\363 \230\325e\333\0024a\340.9A4\253wff^\233M\221\201\327w\246\247\267%{\357\235RJ"
+	.string	"G"
+	.string	"K"
+	.ascii	"\177\321\331-\023D\3611\230AA\301\354n\335\\\200u:\037\300:\225"
+	.ascii	"'\336}\312\330\371\017?W\224\\"
+	.string	"\274\317\344\023\304\345,`\032\021\343\361\221\346\346\206\n\345\251\307\016\337I\214\032\b\273\353\350}\037nz\333\023lK\260O\n.\273\036V3\253\2426T\374\364\333\367QO\331\230Cgq\005,dc\357\374\320\230\025,\350~\022\315-9h\261\343e7\005\344\324\r\256\323h\037\306W\272\203\033\376\261k\242Qc\027D\340z\235\032\274l\373.\002n\261\374\224\246!\336\263%M.Cb\025C\272\304\242r$\324q\022e\354\313\370\214\022?\2059P\274w\352\203\254S*C\250\304\224D1\202\201\237N`\205E\312(\256l\220\024\245\t\373s\245\311\236\321\364\340/\257\0049\006\004>I\306\031\001q\326g\323(`\346\204x\270\314\302g\323<!\021\f\036\256CR\265N\315\320\021\311*g\343j\310\306\232\347\302V?\232\266U\f\034}\2564\201\334\203\203\b\325H\222,\232\273%\036\204\377x9M"
+	.string	"\361\300\317\3620\323\340@\301xWy\030"
+	.string	"\266\231E\306^\201\326\214h\300\370\326K\030\026\256\366\177\264V"
+	.ascii	"\201U\204\240\320\342\201\254 d\206\340\232\030\177\213\215\207"
+	.ascii	"\023QM\027\215\225p6\202\3122h\002\220\022h\325MS\n\005\005"
+	.text
+	.section	.gnu.lto_grab.24.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`b\001\005\017"
+	.string	"\326\233cE"
+	.string	"\221(\035{\242<\bWq\201\370;x\247\376\361\037\361\201\341\301\323\223\302\177[V\341{R\336\205\322o\bX\225G\263\220I\333\245*JV\325\023D\263z\023b:@\326`\247u\275]a\233%do\231RN"
+	.string	"O"
+	.string	"N"
+	.ascii	"\266}\025_\001\3320s$!nN\250\023\326\314\356r\235\013\320\236"
+	.ascii	"\315\007\320\236\311\021\007?\245\202\376W\237*)3B\261\344\263"
+	.ascii	"\303\345$\220\372@\003@<\315\016\r\330\311_\327\f\242\211\352"
+	.ascii	"f\301\356ZC"
+	.string	"\221\303\235\335\266\003\333\r\354\273\0021\033\013\313d\230\270\313o\337o\371\213\344.C\270\213\273\370-\177\200\200\244\263X\256^Tv\227\344\263\374\001Bz\213\322\\T\202\0247dvQ:\236\031\001\207\304\336\016\332\233\332g\361\025\360\343\205s\354\246Z1v\307\003\3468\317<r\002\232\377\002u\372\320\232,y\r\210XKz\244I)\322R\303Dk\354\277\374\305\310/a\013\237>\374\264gR\376uMQ\321\240J\312\240@\353\352a\005\005\212Ic\366xR)\302\376\334\335\265L\331\231Z~\374\225\243\251b\006\300\330\335\020\376\b\310#2\3724\221\327=\330\354\361\b}\240\b\"\257\013\225B(\204\276\317\b\327}\270\n\237\020\020\347\361>\316\243\343.$\301\343D]\347q\333h\372\\\231\352\370W\277\006\f'`&yri\356\206P\300!\303275\360\273\336\232\260\211a\315\204W\3350\001\037"
+	.string	"\266\231E\306^\202\326\234h\257\342\007\3270,\\\355?q\255"
+	.ascii	"\002\263\ba\311b\314C(\233 \b\034T\271\006\356\021Z\263\013A"
+	.ascii	"0^\252\003S\353\240j\372\026!\244\002\304E\363\032\372d\202\004"
+	.ascii	"U8\270\033I5h\225HS\n\005\005"
+	.text
+	.section	.gnu.lto_release.25.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`9\001u\016"
+	.string	"\206\234dF\020\221\223\0168D\222\204("
+	.string	"\247\202\357=%w^\364X\b\321A\364\314\ts\007\315`:\262\0346\037\265\037y\357\317\260\020\213JevX\022"
+	.string	"*(:X+\270\n\321U\020\357\313\352n9\261\221\275\367\336)\005O"
+	.string	"O"
+	.string	"O"
+	.ascii	" \307\266\317\342-:{f\202'\276\353\024\"\005\306fw3\317\007\324"
+	.ascii	"\323y\001\365T\232x\367)c\347?\374\\\001\"\306\373N>;\\\316\002"
+	.ascii	"(\026V\200\3574=8hR\256zT\371Pb\274\034\354\256\243\367q"
+	.string	"\270\351m\213\330\206`\277%3\232\036\374%\200\272\312A\200\307\356\206V\217\245\2417R<\365\333\367a\256\2621\223\376b\tc\205\221l\354\235\037\032s\002\005\335S%\316\252\270b\220`\251\331]\00195\003\316i\264\357\342/\272\203\031\336\331E\325\260\261\013\"p\3069u\0372+\033\357.\367L\365U!-\336\253\262\312\223\337\210h\311\2206\251T\222\204:P\342\215\375\031\247a\342\243\360\005.\336;\365\271zJ\345\007\027\226\207R|`\340\251K\231\030\326\212)\266l\360\024e\t\373sw\327\022e\323\350\213F\327\177I\350C\202\201\253\243M\213\200\371\023\"\342B\022F\233&\"\215T\020q\240\222L\003e\026@#\241\354\263qY\210\307\232h\302\226\2154m\3130\333\006M\237\262\312\253.\242aG\004\371%Ul_rA\213I\236\\\232\273#\032\204\357\324\244&\026\017\374/\017)\004\026"
+	.ascii	"d3\003\030\026\b\022\265\340-\f\013X\373\253Z\213\201\224\025"
+	.ascii	"q\351\264x-+\310\231! \256\t=\004\223\032\357h\002\212\013\034"
+	.ascii	"T\221\301\211H\252A\253D\232R(("
+	.text
+	.section	.gnu.lto_clearScreen.26.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`^\001M\017"
+	.string	"\246\235iG\360\262&\035P\261\260\302G&=\363\247/\337\330\017\235\216N\266|:\025M\265\006\2254K)\t\t\357\266\b&+\336\232\211&QVy\352\265\026'Z\315t\336\300*\206\325\204\240XL\027\024\310\250\221\275\367\336)\005S"
+	.string	"V"
+	.string	"T"
+	.string	"\233\347\324\241\307\266\257\342+@\333f\206&V\031\nf\345\345cw\267\317\013\324\323y\002\365T\2268\370)#\350\377\365\331\372`C\265R\371\354p9\017\260@\350\bX\241\346\347\006\316\312a\217,\253T\214\031\204\335uT\2558\334\364\266A\266%\330g\021\341/\001\324\0369\f\360\330\335\020\373\2618\264\306\211\273~\373>\315a\266\346\224\317X\276\270i\355\256\226bk\007\375\2275/`"
+	.string	"\336e\362,\212\214\346\245\225\263\333\"r\352\b\236\030/\203a\016\330\324\213\213\203G\373-\356\002|\230\341!\273\254\0314vC\005\016\237\371\213\003\251\271i\251\036s\333T\037fA\024\257\252\262J\225\357\210\210\301d\251RY\002CG*\356\330\217q\031%\037\306\035J\274\352\324G\251\247T\272\304\350x0E\020\202\273.kp\244h9\305\230\035\242\242$a\177\256d\3315:\253\321\225F\323\007\361&\242PIiTG'\035G\362\272\214\364u\0234\207F\274\221\210\002\351\353<\023\311\005o\304\231l\035\267\235p$\242-\364\215\266\221\217;\257\302\267\221\272\356\3334\333\016O\237\262\312\303\016\322\260#\212<\223,\2663\331 \304I\242l\232\273#\036\274\036\222#3\003\304\004\017\031"
+	.ascii	"d3\003\030\026\b\022\265\340-\f\013X\373\223[\213\201\224\025"
+	.ascii	"\001\210\261\367\224\226\2213mpM\fP6\342\036\241\311&\nx\f&n"
+	.ascii	"KB\226`\204@\205\203\273\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_drawScreen.27.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\024\001\335\r"
+	.string	"\326\032aF"
+	.string	"\221(\035xj \237\266\363\220\356\363h\260 x\264\357\200\006\234\255\024\255\377\227\371\317U\2413U\2146\215,<\300\267\220I\213R\025%\253\352\t\242Y\276\220iL\314\354t\311\304\017\017\241B\b\331{\357\224\002L"
+	.string	"J"
+	.string	"K"
+	.string	"\017\200\235j\007\200\235\3326\202\004$\203\257&R2\223\352\324\202\307n\345d\211\203\2372\202\376W\237-\037j\204\250\223\317\r\227s@\n\004\315\006e\232 6\\\247\267\0361\240Pb\314\032\354\256c\210\322p\323\333\206`\373\201}\223\277\324\262\0168\004\354\330My\365X\027\235\201\342\365\267\357\303\274eo.9\313\022r\264\354\356Vbo'\371+o~\035i\233\"\213!\301bfW\245\300\251\025h1\332w\271\212\364\027\223svS0b\354\326\003\346\264S\3277\r\314ou\027\342Cc\362\3445\"^2R\262\370 F\345\b\214\016\224Xc?\3462\240\177\302\237(><\365E\330)\225o\235\363B\305\212\312\303(: \360z)\343\006\215J)\276\354j\212\222\305\376\334\335\265L\231\376%\363$\237\316\210\350\303B^\027as'\004\364}&\204\274\0164\022\251"
+	.string	"\372<$\\\347\341,xD>\\\307\373\270\020\020w \n\036\027\352:\217\333j\351se\312\3057'\016\256\2224y4wG0X\2353\303\232\037\321\300\317\372\352\263 C\210\025\227\360+\002\023"
+	.ascii	"\266\311R\243\275\003\2559\261\201\362\327\3070,`m\265gW\270"
+	.ascii	"\202\304\343N\237im\327(Q#\240\027\241q\026\f&$/O5c\225\240S"
+	.ascii	"\n\265\007"
+	.text
+	.section	.gnu.lto_screenSize.28.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\325\t"
+	.string	"F\323C:0\345(\035\236\201|\277\020bQH\002RC\210\254\270\2704\230\037\030p\255\377c\377\307.@m\220\b\343\273c\353\"H\030P\212\005k\223\336\350\036\264\301%\204\020\"eJ\0013"
+	.string	"0"
+	.string	"1"
+	.string	"\237\275b\201\033\250\254\204b2\021\260\2731s\002\354\227\365\001\354\227j\374{~\376Gn\2550\302\023j\364\314\022v\327yB]\334z\333\032\333\b\3665\001\231VMg\246\257e\036.\006\001v-\302\325\266\\*\035\266?\033c\373i_u\221\357\240\350\002\273)\226\224]p\343\250\3752\250\331\366A\036\022jA\374DusM\275i\200\275\227Dh\273\024\007>I'\241q\374\362E\330\257k\301\213\212\224\241\r\216R3\354[\253)[\323\331\301\037\323\264\025\241nS\300\330\303\341<\320B\250\333\270\211\216\003\347}\030\342\366\211\017\237\016(z:/r2\336\270\206.\206\266\255\213\030pog\232!i\311\226\246f\252"
+	.string	"*>J\031Z\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.29.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\356\003]\034"
+	.string	"\226u\272I\240\326Q:\002\213n\201~\354\325\247\343B\223d\201`\303\307#\257"
+	.string	"\265\013'gi\361\326m\027\355\002\364\377m5\036\373\217\352\363|\3152V\304\377\361\326|#M\005\317\201\274\033y\024\031N\215\032\\\203|B\210\334)\005\244"
+	.string	"\227"
+	.string	"\255"
+	.string	"`\265\326\003/Mt\222X'x"
+	.string	"T&\253&\025\256rL(\262;\200\372\243\022ch\251\275\240\001\357U;o\255\303\260\b\247\366\207\234\b\357D\025\237\325*U\334\252\225\230\300\264\363\245\211\247m\037\310\203\360l.\2228%\214\375\236"
+	.ascii	"\215\214\251\265\322\202\036\300|I^\307|\2717\316\273Y\222Ky"
+	.ascii	"\376\213"
+	.string	"'}@\035\203\302\336\315\027/\311\001RPdp\204+\310 (^\300\033\233(\371\364%\013|Em\301\0212\221=\303\256\247\027OY\b\177\224\306$\324ZM\203B\027w\354\266\223ls\260I\240G\177o\366J\200g|\364\350\033j\263v\t\033}\360\233s\204\210\027\323\366l\342\217\256\r\373d])\373,u\317\211?\317\257\376\235\032j\235W\375\263\027\371s\236u\337\034\353\267Yj\232\030\365yR\307\226\332\244\241.Oj\362\244\336\245\2461\352\003\3258}\375L\251\265\3051\254z\225F\035\317\372\265\374%7\3322\347\276\345\245:\312r\266\354\345m\236\217\344E\313\234\344Jx\327Z:\353\016\nQQ\300ju\322p\276\244N\004\236e\256\263\347t^EM\t\347\332\354\267~E\003\316T\320\312\213\273\235\222\334\320\201>\350\240\246\355\331\334sk\240\272\2201\234\240\027\037\361?&\271\261\315"
+	.string	"\305\004\370\364\243\307/\001\3635c\215d\226kd\325\305D\313xg\313]"
+	.string	"U\004\236!\205^%\350e\350;s\227\\\0360@\030?zLq)\036\030<\260?<\n\b\003Xjer"
+	.ascii	"\345]!|\034/]T\243\017\276\364k\313 \213qg\351\2322\206G\340"
+	.ascii	"\231\331:\2417\027\225\230\0379k;\001\031\031\373\235i\033\301"
+	.ascii	"\213;\233\251Z\353\203\245\n\343\343\013\320\315e\336\254\271"
+	.ascii	"\n\206G\232\276\374h$\226\2146i\304\321\226H\262\341t9\023\247"
+	.ascii	"\323\025\221'n\270=\272\325V\207\273e\220\271&\244\224C\n\241"
+	.ascii	"\303\335\224P\024\035)\345l\"h7\033-\311V\204D\253\341r4\241"
+	.ascii	" \337\224F\340h\272\333\rG\223\021}'\353J\331d\331Cnq\001\026"
+	.ascii	"\311\003\367Y\026\266}\026\302\f\337\376\274D\326Zc\350Z\177"
+	.ascii	"\3613\260*\363\207\322\024)`h\0216\f\362\0367\227\351\033-\\"
+	.ascii	"\240\017\366\254\271\27524\216X\245\tSg\215\254\264\370Y\256"
+	.ascii	"\305\204\217\303\030\210\350\203D\346K\235\275\3613$<\206B`\370"
+	.ascii	"\252\334\\\232\035`\246i(\200\006I\250A4\244\220B\b\t&\220\t"
+	.ascii	"\246\212\024$y\220\"\231:\353\020xW\022\215\0016\345\341&4\226"
+	.ascii	"n`'z\236\375\by\273\004\245\005\r\342\340\245\321D\177,kCO\223"
+	.ascii	"\340Eh\313A\3572\031\256m\335)/\026\232S\236.\331gR:+Wl\354\320"
+	.ascii	"\323\037a\036\r\366\022\227\f\027C\232!#\027\222\"\215kj\330"
+	.ascii	"\264A\026\004\310\370\034H\f\342\370\002Gd\204\tn\247SG\350\236"
+	.ascii	">l\355\235\0359\213!\216\305Q\370\310\301pwj\002?d\223\004\205"
+	.ascii	"!d\326\304)dQ\001"
+	.text
+	.section	.gnu.lto_writeChar.30.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`~\001\305\016"
+	.string	"\306\033bE\020\221\223\016\200BX1\025\307\021\340\340\022\276a\017\265\300\221h\017\032i\266\225J\334\030Ll\025cC\376\331\263IT\333\302l c\002@9G\264^\366\336\240,2\310\n\300\316\2559\243\rBmo\271S\nK"
+	.string	"Q"
+	.string	"J"
+	.ascii	"+\316\242\373\207\341 \273+\327\213\335o\304\032v\351\017\263"
+	.ascii	"\355\247\270\212\316\216\021\277\026\225G\006/\005c\263\273"
+	.string	"Z\310\003p.\343\001p.u\304\273\303\316\277\353\021\205K\313S\241\016=\024\354\256\241\247\352p\353m\013\260\355\300\376+R\241\243B\253BC\t}P\347\004\r\021\031\273,\257\035;C\302(q\232\337\356|\2273\317\274Ew\232\023\266&0\r0\033jv9\f\270t\003\354\022\004ef\030\304\220X\360\222r\320\256\324`1Qh\0270\320\235\225b\335\375\240#\301\241\375\026J\360\336G\343zP\2243\215\035U}\352\346C\241\226\270\264n\342\330\036QV\313&\307\3256\201\273L\236\226\335-\271wC\352U\004G\352F\005\276\354\017\005U\204\375\270\272\362\347\337\3579\353\317\376\362w\036\363\177\\\346\017\024L\021T\364\215\343B\36147=\231\"\345\266\371 \263\210\204TB\201\300m\223t!tB*\215$hs\244U\030\205P4\321V\322HB<I\0236\215\233s\323\262o\037WW\037E"
+	.ascii	"BEW|\212\273!LjX\360.\356\232\007lxPU\243z\324\016\" \260\"\262"
+	.ascii	"\013=6\263\b\354\265Y\213@Sf\f{\031?{\355\260\264U\203\371g\263"
+	.ascii	"(-\037\341)T{\242\027\303\001PD\364H\230\215\335H\223\r\016\350"
+	.ascii	"{\260\203\300\317\301\016b\316\r\343\005\340\b\201\341\337}r"
+	.ascii	"+&a\221\001"
+	.text
+	.section	.gnu.lto_isTransferInProgress.31.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 \356\024\300f,b/\346\033\016E\022\240\252\265\326\352\025\350\260\b\222wdg6\026\tw\233\217\210%)\245\266\310\253*\307\272\225\326B\342\3362\005\231\214\f\325\036\316\205}\0342\031\257\211N\304\205Y\0170ZP\302\352|\240Gb\220\2639^\020\022f1JX\315\325\215\332T<\213\237 \367<^\001vw\177\243w\r.\245\027\003\322n(\006fY\246\225\220_\373\352w\356uDI4-\241\320\200\335Q\213\312\356<\030jtz\352"
+	.string	"\245\223F\005(\235\376\021\022\2647\235 \241\314\005\007\306Iiw\302\367\241\233\272mU\023%\020I\351 \241\210@\3522\013\273\273\313\020i\350O\377\202_\341\337\b\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.32.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\002\01635Po\322\030 \333 \nw"
+	.string	"}\nw\207@1\306\200#\007h\365\ntX\004\311;\2623\033\213\204\273\315\002\220\206\321v[b\024\271\005\253%\266\021i{\313\024\230\214\013\234A\036\353\n5`2Z\022\037\b\353\252\034`\254`D\365\tA\220\274\240\247s\264\036$\304b\224\360\271\232\331\267\255\032\325\241x\025?E\356q\274fvw\177\333;\206\322\213K\201\312\356(\006fY&\024\220?{\316\357\334\253\210\216dJ2\241"
+	.string	"\273\333Jiw\032\f7:=U\200\322i\243\001\224N\377\007\b\331\232N\217\221\306\342\343\302\344ew\302\327\241\232:m\325\022\035\bI\331h9!\211\324i\024vw\207A\312\320\237\376\004\177\302\257\021\007"
+	.ascii	"\265\311B\241\301\3143\227\225\235t\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_redraw.33.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\356\002\305\026"
+	.string	"\206k\227E\260ZM:x\335~\033w;\235r\243\005Z6\224\351\206z\034\264\247\007\252\231\232\305\301\364\241T$\374\320\241\351Lk\241\225\371\372N\345\221s\031\303/\377<\206\3433\236o\347\0272m\264\263\023\2627\3312\245}"
+	.string	"z"
+	.string	"\213"
+	.string	"\322\025\f\303f]\236e\373j\177\351L\2667\305x\316n\222\324\324\356\316\201]\341\245w70/\303\023\230\227\266\331i\276+\262\240\356\b\022\224\325\356\272\"\221\333>\345\027\325\346\203;\273{\247\003\270\341\206>w\\~\t\222~\\\341\340d|:\\\276 \235w\244_\216\307oA\256K\016\034\\\321g"
+	.ascii	"\314\2203w\272\316\300\031\251\202;\273k\275\341p\334\340m\263"
+	.ascii	"\260\235\301\216\021\002W\2724\213\230\376\026\233\227\217\254"
+	.ascii	"0]\256\232\210\264g\357\2124\352\354\177\273\273\216Iv\250n\275"
+	.ascii	"\351g\201\352P\252A\251\236S-\245\372\223\3528\325*\325\037\240"
+	.ascii	"^\264\350\224D2\273\265\321k\263_$\225#\207\372\355\373L\316"
+	.ascii	"\203\361'\346\021\243dw\357\344P~\224!H\260\005}g\251\243*\267"
+	.ascii	"\264\273A\376\223!H\bz\023!\235\241\335\332\240\320\303j\311"
+	.ascii	"j\367\006\203\007\037xx\346e+\236\367\034)$9&\036B\212AA\324"
+	.ascii	"\325\007\21569\246\033`\264C|\013\202\223\2303\2021\216\221q"
+	.ascii	"\212x\026,2\266\250P]5}\321\036q+$\302\335\235\340WYQ\242@\021"
+	.ascii	"\245\030nnj\210\264\3470\306\370\305\017\315Q\256H{\326\030\343"
+	.ascii	"\221\336\330\304\247\234\220\362\251\236\227\217\317\274\324"
+	.ascii	"\030 \f\325\222\357\213:\325)k\300\004\211\377\231\2177\362T"
+	.ascii	"\306H\331\330V\361("
+	.string	"?\341\256\321\004\037\312\245`\016\337S\304^(^\324&\020M\006\202\345\327\203Y-v\002\210&\233\t\365\264\230\325`)\\2\230\313\005\254'\346z\321j\256\007:\226\315|h. \231\214\346b\355\210\376\255\3235d\231\272\252\"\212E\026\372v\205\\\310\251j\242=\317\250\263}@\033\374O\036\265\301B\r \271\245\333\223\334W\246\317\353\340A\177\363y\3379\212C>\233 =\236\214:kl9\235\303\230%HRT\300\177f\030g\310f+\242x2s\252{\221\371J\0163 \200\002\021\271\253\003\266\227E\266Ol\355\337\220e\312(\006)F\202b\\\021t\226B\005b\266\220\256\367D\326M\313\233\330\3212\265\036\300o\324\030\356q\237\353\n\311\237\3014\206\327\356\306@f\271A{\272<\306'\322^\357\"\021\242\270\005\b\020Q\024b\260\2271Q\360@\305\301\217\027\240\326\300\213\246Bh\231"
+	.ascii	"Q\214x\304\346|\332\324\264\324j\335\224\"\357\001"
+	.text
+	.section	.gnu.lto_txBytesFree.34.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\215\007"
+	.string	"\222\01644`m\322\001@\003\007\234\200\271P\271\237\250\247\242.\326?\020=g\230\246\t\302o\330\t\271\354U>\354\025\260\200+\310s\236w\214.s\375\r\331\275\345N)W%\025\"k0\224\265Y\270*Iq2\016\22451D9\305\207)\263\211\232\312\212\030\311\222j\250\342%e\025\243\271\267\252$\241\035CgCp\3347U\251\243\232=5\247 \373o\365c}\221\305\211\201\310.\305\212\312\232@\022\r\333\230\035\331v\316\376\307C\330g\304\005v?(#\273\363\300\361r\350y\261\355w\334\003s\366&\206'"
+	.string	"\024\232\bI\331\235Q:\201\345\360}\300r\250\027\317\3562\377 \177\034\031%\233G\273\003H\330]\273\315Sq\353m\027\330F\260\275\021\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.35.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"-\007"
+	.string	"D\f\360"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}\212\001\202\200\200\374\342\303\364\302\005{y\270\364\222\005wu\370\357\362\003sq\270\357\242\005om\370\356\322\007wk\270\356\242\005ig\370\355\302\005ec\270\355\262\005a_\330\354\002][\270\354\302\005YW\370\347\202\005oU\270\347\322\003oS"
+	.string	"?\202\210\200\370\001QO\310\001M\307\001K\306\001I\305\001G\304\001E\303\001C\302\001A\301\001\277\177\300\001\275\177\277\001\273\177\276\001\271\177\275\001\267\177\274\001\265\177\274\001\263\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\016"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243\351A\260\224\360\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_displayPortMspInit.36.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`6\001=\r"
+	.string	"f\327VC q\223\016\0378\301\232\026\0014P\3330\236\305\241\212\316\003-xV70<\216\240.#\364f\304\330\323\r4vC,\366\210\273\326[\177\003\200jS\2508\350\017@\312z1\270\327F\354\336d\313\224\002A"
+	.string	"A"
+	.string	"D"
+	.string	"\335\006\025"
+	.ascii	"\023hP`y\331\355\244\273\023\210\207\327\005"
+	.string	"\304\303\247\341\243[OG>F\304:\235Z6\216t\013\303\337\007g\262@v\367!\256\025\270\222*Fdw\255\033\247r\303\333F`[c\337C~w\021$>\207C\207D\372\355\320\027\305C[\202\211~\363\200\030)\252\024\312#\331]I\337\212}k_\006[\325\307\220\244\274\324\220-\273\027V9\326\005\262\350`\373\304\366\360?\034\304\211G\007\002;N74]\351\356\222\2367\361\257\001\211\031&\305a\233\301Sl\256]S\210\177\342(8\356x\324\3632\232\016\025J\323\225\003\250\036\213G\335\304\274vQJ\234\345\201\365\231q\306\303\243>Bt\355j\337\002\356h\262\320gS\002\232\231\t\007B\026\302\034\310\211\311\b\030\347#;\240\220\324\200xf\036\220,\231\023$=:\3550^|X\340\\\264Wr\001=\352.Z$P\220R\245L\326[\371H\264\027|\305\210\001\031\273\033\242\"c#\037"
+	.ascii	"2\003\302\360\326\206\235!0`\bK\245\222\215\003\254g\004\016"
+	.ascii	"\300b\030\210\332x\b\202U\260D\310H\016R/\213\233\323\204\003"
+	.ascii	"w\300\334\260\212\001\342\201\353\370\250\261]\023\231Xd?D\006"
+	.ascii	"\334\205H\215ST\215\355*e"
+	.text
+	.section	.gnu.lto_output.part.0.46.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\033\002\345\021"
+	.string	"\246asF"
+	.string	"\317&\035\303\273\257\363~4\373\r\330\210\342\322\032^\\H\325\037\231\033G&\275q<\250\375E\2174\322\003\3635\344\303\337\261\213\350\353\"\351u\227\326\306`7\337\200\206O\241\266\316@M\020\370d\333\336r\247\024["
+	.string	"c"
+	.string	"^"
+	.string	"-\017Wf\306\032\355\017\020\360;-\326]\233\030C\273\341\201Oo\331\247}\023\254\031\333~\211\353\200v\221\fsh\030\270\210y\305vw\373<}"
+	.string	"\351S^"
+	.string	"\351SE\034\274F\t\372\321E\343r=\354\005z\204\\4\034\036M\227\245\220\335u\326\341\236\267\335\300\366\312\216\024\002\333\n;l\177V\341\bsj"
+	.ascii	"\310\020\302`\023\333\r\267\317\007\335\337U\330\201Nlw\265\373"
+	.ascii	"?,\037f-\b\210\345\344\362\241\343\323\023\210\345\001vo~\036"
+	.ascii	"d\240\255\371\274g\337\343\"\271\261\255\0206C\273\273@\306\277"
+	.ascii	"X\341\326\310h\037\305y\300\247\250\300\261\261-\236\r\b\302"
+	.ascii	"\314\032\037\372\003\204\365\235r=\250\213U\245\376E\214\221"
+	.ascii	"\215:\213T\266\333R\340\023}\205\211?\342\323\252\223x\327\247"
+	.ascii	"\177\242\t`\234\270F=\354\0321F/\361(*\216U^\256\3368\323\350"
+	.ascii	"\322}~\322_\377\324\210\226Y\264jt|\370_;\201\026\2732G3\026"
+	.ascii	"\304$\"1d\225\020\230\f\027$\317+\246\023\013\236\340\361\245"
+	.ascii	"V\252\022\316\353L:\003+\036\007AKI\255\264\204E\202\222\240"
+	.ascii	"\240\324(\217\356C\021Y\361\270\316\302\310\252\373T$\033\247"
+	.ascii	"\332RT#(\033\312\3736\217\223\271.\345m+\034\347m\232\355x\275"
+	.ascii	"\361a7\305\222f\252\301v\246\016yQ\030U\034\333\246\350G \221"
+	.ascii	"tjT\251\266\310H\274\253\244\001/ `\242a\314z\034\314i\264\213"
+	.ascii	"e\310p\214\321%\035\270A\336\023Y\024\376\211\3260k\270\345\302"
+	.ascii	"\271\334\320\326A\2342A\357\204\331\232`\320\n\200\223Z\273T"
+	.ascii	"X\275_\270\216\b\317 Y\003\374\303}1H\260\353g;6h%5\2739F\356"
+	.ascii	"\233\255\201(\016\221\b\216\363\261\362\r\222X\304B\260\274\302"
+	.ascii	"\260\360`\312\330\371\327\2521"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\265\001\025\b"
+	.ascii	"b\013+0`K\324\001\220a\212C\334W\"\030'B\220JX\376\366\342 \b"
+	.ascii	"\202 \b&\f\355\357K+\255\264\322J/\213\261\355\022M*j\272\333"
+	.ascii	"\312-e\272\025L\0035\274\022i\300\003\222\031G>\262\200w\022"
+	.ascii	"0\200\204\021\b\340\235\273\035\024\223\re\341\215 (\214\035"
+	.ascii	"0K<\213x\007q\357\341\334v\267\3524\201\\\333\347\212\254\272"
+	.ascii	"\221v\2348;\303\341\030|\\\202\337#\357\n\335\027\270G\334^A"
+	.ascii	"\355\f0{\002\266\305\353\020\264\276\250\252T\317\331\030\325"
+	.ascii	"!\324\255\351\224\364i\35195.T\257\3121\261Jww\364\006\250\252"
+	.ascii	"\320\"' \360\002!*n\030\330\215\350q\020d,cm\202o2\223|\337\254"
+	.ascii	"s\327\336\3103\303P\217\340 p8\201@\\\212\231\004C\371\021\206"
+	.ascii	"\nJ\340\232G\226WHe\254\207\352\300^\030M\205x\n\261\016\202"
+	.ascii	"\327`P\211\004\3511\252\307z\264\006\315V'"
+	.text
+	.section	.gnu.lto_.refs.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375 y\225\002"
+	.string	"\322\305\017\024\260\245\205\003\f\3030\254J\210\265\336\304v\023\021!-\311\024\n?qy\007.\366at\372\274\220E-Q;\324|\355\324\202\342*Nh&\243\207\350 :\200\304\030\316\334X\346\3041u\020\006"
+	.ascii	"O\005\224s\020\004\023\324]`B\332\022\006"
+	.text
+	.section	.gnu.lto_.decls.f9c062ccbb072830,"e",@progbits
+	.string	"(\265/\375`\r*\305\264"
+	.string	"j\031}>T \016\241\235\016\346M\n\356$2"
+	.ascii	"\334\001\347\203gA\013N\277\3622\rw\320a\212\016H\343W\\\362"
+	.ascii	"\356\344i\bZ)\240\\\2060\026)h\265\325q\036\200\222jT\342\354"
+	.ascii	"\3061_\332Ww\334Y{3}D\241\t\2651\320\303\242\326Q\277\333L\312"
+	.ascii	"\224Rk\003\336\003\330\003\204\037\236\205\373\b\341\245\244"
+	.ascii	"D\363@~\370\314\227\2333\024\217,\217\322M\363@N6\200\252\222"
+	.ascii	"R\364\203^\350\211\376\371C_\364\316\177\341\325\007\372\237"
+	.string	"\376\026\357\242\275%.G\330\337\005\270\345<\303\332\362\307\366\353\261\375A\330~8\266\237\312\366o\261\375Ql?\323\347J\220s\006.}o\322\032\217?\323\364/1\254\317$iFk\200\225\324\216\307\367\223\330f\363\f\253\214\213\022(vB\036\033\002\301x\261|\\(m\266\324U-Ey\334\337\202\355\017A|\356,\312\352OH/\t\321\363\\\351\311\253z\203\363\271\032YtuWa\356\347G\234\357\245)\315C0Qimn*fQ]\177kl\356\343ey!\363\344\355\310\36234\367\241\302\343\225i\374|\210\347\371]\2224\023a\310\243\032\373\341\3245*\352K<\320\231\270\240\377\271\023o\342O\274\317\t\035\320\253\356\347E\332\215\270^\313Hsn\346\234[\004;\237{YJ\263S%\212\2063\332\376\325\355b\335\036>\270\237\2239\365J\2632O\336P\207\262>\347\020a\316R\004\310 "
+	.ascii	"\001-IWhT\002\300\256$%P\252\032\004\215u$\236\304\253\276\347"
+	.ascii	"c\215\311\240y\232\263\324\3452\217\354\326fV\030\237Y\333\301"
+	.ascii	"\330\317\236a\325\3406\330n\317s\274\225\036)(\246\364eM\250"
+	.ascii	"Y\370\270\235H\226q\211\222\003\317\227\330\366\"\266=\210m\367"
+	.ascii	"a\333y\330f\001{!\316\201xu\003\227\223\302\270D\351\212b\370"
+	.ascii	"\270Q\260\355\033\254~\350\033\254\215\002V\246\3106\t\330\031"
+	.ascii	"\016\260!\244\271\232We\274\307]\222e\030\307\343\021bz\334\027"
+	.ascii	"`U\200\312\037z\003\333\202|"
+	.string	"\3502kg\300\206\360\f\253S\337\247n\326N\365\262\366\360\241-4\363W\316R\247\342\234\231\356\033^\3347\244\300\325`\226\255\270c\330~V\203gX\261cX/\334y\206\265\333\301\272\335\313\2776\270>@\320\214\226\2634\006Fz\024$\365\270\245\236ae\035\303\332\3750(t{L\313o\240\373O\360k\f\335\027\004\315\327\335\026@<\005L\300\336\355m\335^\355\366\264n\367\321\355\322nW\353v\266n/\353\366\263n_\353v\267n\247v;\217n\007\262\225u\005=\n\301\023\250\333\233\335\316\202\356\356\240\373\336\350\376\237@\213\356^\273/5\003\277\340\245\373Kp\002\374\210\fz\203\356\353G\244\254o\367\035\353\366\031T4\315\322}\r=x\021\rp\351~\006<\t\335\317a\001#\230\031@\367}\322\335\204\335\275\2445h\266\373\212-\331{\200K\367\0354t\022\330\026\272o\337\207\330\353v"
+	.ascii	"tK\3675\322\375\n\350\376\016\335o\200\356\277\320\375\267\373"
+	.ascii	"\273\333W\350v(\335n\330\355\205\335\376\244\333\235t{\223n\037"
+	.ascii	"\354v\301n\017\354v\300n\367\353v\274n'\322\355w\335>\244\333"
+	.ascii	"9\350\366 \335=\355v\272\356.\354n%\335.\242\333A\350\366\bt"
+	.ascii	"\373\003\272\235\001\335\235B\267\207\350v\020\335-\327\355#"
+	.ascii	"t\273\b\335\356\241\3339t\273\007\335^\200n\337\320\3552\335"
+	.ascii	"\236A\267c\320\335P\272\333\260\273\277\272[\204\356\256\353"
+	.ascii	"\356\013\207\207\207\207\335\270Hw\n\261[C4oO\274\356\216*\266"
+	.ascii	"U\244\330Va\322\261\2656=\231\362\345\350\273u\177\272\236\342"
+	.ascii	"\036_\255\217\313m]ibk]\222\347\214'\233eAn\356\251\304F\337"
+	.ascii	",+\263&8TV\324\270\302u\204`N\254\372^\275\004u\321\375<.\254"
+	.ascii	"\242\272gqNp\314\350K\245\305\304l\351\361\235\3728\b\320\360"
+	.ascii	"\322{|e\370\034\006\346\224\254x|\245^\316\350\242O\217oT\213"
+	.ascii	"WQ\032\327\217\301p\031\272\320\353{\202\262\330\370I\023\212"
+	.ascii	"\321\027\232\342du\367||\235>\356\261\204@\215\036\337&\237s"
+	.ascii	"\366 \021\362\3702\371\234\n\321\r%\245\307w\311\347X\224\370"
+	.ascii	"\325\271\371\\JT\023\276\265\"l\257kl\bHG+\232\232\026\024\243"
+	.ascii	"\276G\r\007\001hQ\225\312\366\032\306\266\3241\f=\331&O\244\203"
+	.ascii	"\316\276O\"\205\324\236\307"
+	.string	"[A@B||N?}\201\256\213\265-\310\f\240\3073\267\305JS\232\247+zL\232\320\256\240l\263\255C+ns\2151\210\007ty\3726\275*\016H\372\3702?\016\206\b,\216\332\353\n\266\357\016\243\244\024\311c>Y\241?\212\340[\237\336\343\207\302N\221\331\365=~\303/t\221Sr\265\242\320\210T\227\032\341?\001T\322k\013$D\322dp\005\313L\215\211`\377 \214\021\217\245\221\307\317\304\367\212 \335x\374}\037\270\3165\001\322x\374~\377\347\325\016\036\260S\230\322,}\253\025\322\312\206\260\355\035\254\367\360\320;X{\360\227\254\f\261a\246\266\204\317\002\334\0335\260\rH-\207\222\337[\221\314x\364\260\261\235\002\306\366\337\021=\256\035s`F\372\365Z\252\202o,\036\177\221\025@\032\031\352T\013-\210~8\341\300#\002c\004n\205\255\273~\".P\326\230V\217\177\310\3079\305"
+	.string	"\255\204"
+	.ascii	"\361\222Q\367\370\355<\b\233\032!}\220\224\036\326\363\234\034"
+	.ascii	"\215A\252\025\200\364\313u\337\273\345\201}=\356\301\217s\030"
+	.ascii	"f1\250\342\340`\246f\340!\275\374\320kQ$\370\303\215\245\216"
+	.ascii	"l\013J[\277\033\325B\326@\205n\n\217\350\361\367x\266\025X\301"
+	.ascii	"1\331\326\250J\300\340\326\336\007\214O\334`\263\b\333\203_\355"
+	.string	"\356\225\027\"@8\226\252\317\203\310\216\032\206\205*[UNN^\315\213\250\260(Z\242E\307\372\3231\254\016u\f+\213\224\nS\311\332\253O\366Q\025\220\346e\013\017\266\274$\302\374|~\320\330hL\352U4u\265\322f\270e\004\366a0\202\324@\250\307\2153\330{\255z\317\303\236\307}\001\177G\227\317}\236\035\020\317\343\347\322\361\321~\256\226r\301@y\255\352\213(+\226Zp:\255\2409X\236KT\026Z8\326\263\037eY\217\373qt\377\r\247{\254\022\344,]\237\306j\300=~\307\260z\240\351\317Z\243oOO\252o\003k\002:\226\224<\376\253\257\321\217\365V\2175\0024g\346c\301@\311\231\t\343\276\301}\003\336\021eCm\305}\371h|\225X\025\226\221\307\375U\335?\343\251\232,GIL\336\036\377\3233\254\0348\206\365e\320\364O\245\354\3551\311{\274A\352\243X\362"
+	.ascii	"g\320=.\224a\251\234\200\322\240\234\\\217\207\234S)\354\217"
+	.ascii	"\311\347v|\3759\375\022\230\223\220\247\217\361P\257\276\323"
+	.ascii	"7\365g\177c\221\004\325\t\262\270\257\032\333\027\214\355\233"
+	.ascii	"\203\355k\005\303\251*^qQhIHX\350\207\330\217\307\375H_0p9\260"
+	.ascii	"\3561\rM\377\221\213\031\216\001y\243\007r\362\0211\242\353q"
+	.ascii	"\252\207/%%B\021\336\307}\354PR\212\266\361\270\017\277Kj@T\354"
+	.ascii	"\357m\205\3179\201e5}\216\2040%\245LXIHT\036\317c\214\204\223"
+	.ascii	"\274\332u\030F\277\270\261H\253\023b\273\005\336u+.j"
+	.ascii	"l\344\346$\003\252\207\355\306/\324\364\226X\226l\257\024\256"
+	.ascii	"X\201\2372l\006\213:\374c\231\202\246\035ag\343\247_a\f\035\217"
+	.ascii	"\361\017\026z\362\361D\362\030\007\371\364\254\3120\217\305-"
+	.ascii	"\260\013\257b\240\316.-2\330\320\230\217S\240\322p+\366\361\271"
+	.ascii	"\260\026\\n\2171\213\357\272_Lha\217qO\303\221\365\240\013{\226"
+	.ascii	" \034S0\340\330"
+	.string	"fb&\346\221\201.\001g\332\226V\1773\253\231\337\216\031<w\217\353\316F\024{x\210s\240\006\273\277\244\231\177\333Q\250\325\203\215\363\307\3615\351\240>\356\225'\253\244t\241FZdAA]*\006@\237\\\\\367\250)+'=q\340\270[\276%\315K\"\364\352}r\355F\220\346$\004\333\360qd\031\345\305\213\227\003\034\001\016\013\353f\261K\005\260=\243\321{$B\316K\212\nV\257\240Se\240\367\310\320\214\254h\316r\037\274\230\251\225\275\270c\213\212\356\221S\n\330^\275\200\267\316\311\362R\005kI\037\250l-\335p\226\261E\256\222\"\327o\315\331\245P\347\263\257\257\037\234\020\274\036\277\307w\t\237\021#w\217]\346\354\342\357&\351\273\367m:\364\300\036_$@\226Jg\217\357\021\237\273YD\366\252\036_\275\357\n\272\301<k8\2436/\273\307\315~\261\315b\261>>\027\310\003\r"
+	.string	"\344OH\310\003O\0300\356\223\3159\223\310\312K\212\346\244\242\231\276B\356\220\2764\372\322\270W+Iy\t\030BW\322sf\315\314g\316\231(E\232\237<\026\332S\334\305\257s\320\3358\347\231\022\322\314\244\n\n\262Zk\314%\r\271S\356rnB-#"
+	.string	"5\324\204B\362\231B\345e\023k\031\363\314PK\237i\3161\271\331\\\226"
+	.string	"\3151>\323<\224W\340\ry\226B-s\023\232cr335\3704\241\206|\246\314\241\030\237)\324P\236B\345\013\271\311|\3764\3633&O\241"
+	.ascii	"\363\024:t\301g\n\035\362\231BQy\323\017T\020\242\251\240\214"
+	.ascii	"\037\037\362if\241 &\346\363\302\235\217\024\232\221\344\354"
+	.ascii	"h=\371\311A\316L\320'\022&\222\263\361\334\t\361T\231P\017@\020"
+	.ascii	"O\02447\357|r@s\316\301s\223\203FXJ\357r\225\337-\245\2302PO"
+	.ascii	"\316\002\b\312y\351\371.\347\274\3149\253<\231\2449+]\360\311"
+	.ascii	"\n\n\3129I&(3-\333zr~\264=\266!\237i\024\224\246\315l\232\225"
+	.ascii	"YH\227\236\225\221@=\331\351r,\003\345\234\235\t\2335\364\"\360"
+	.ascii	"\361\r\002\023u!\204\005\205\275t/\024\245\t\321\021\266\275"
+	.ascii	"\313\177\332^\375\351\225[\361\311\271hf\256\350\203\013d\214"
+	.ascii	"\311\022\221\037l"
+	.string	"\373\327'\371&|\177\326u\245O\320\376\315\317\031%\024\2738\256\216\265G\362N\376P\2113\032%*\262sF\2434n\2159\026>7\210\205\007\2113J\370y\177d\2113\032\315\313\273b\217&z\221z\\\242\373\342\347\2048\243\204\271\347\256H\342\214\022\322\325=\236\nO\2373J\230t\225\356S\335\243}\332\377 \244\341\272H>\234\321\250\021\250[Ew\223`\334\241 p\367\354\276\335\264\353\343\306]\267\333\343\252\335\265;vy\334\266;\275h\227z\331.\331\375q\315n\325\253\267\314\357\372\251o\346_X\367\206\006<>\031\227\3119\243\321\234\245\227\305-\273Bwh\315\033\002\303d\252\007\224\004H\305F`\004\310\321\r\353+\266\322\311\2306=\276`\037W\204\366s\277\260\237\335\221\241\307\327\353\317\366\002:\311\0232\264\264\310\035\034\2442\271\366\r\207d\207\326f\007\247\230c\354\200L\356t"
+	.string	""
+	.string	"\016\316NN\3161GEY\323\252\300\230\\S\034\2217\312c\216J\tb\213\203U\350\024O\264'Vc\t\2432\247\265\261"
+	.string	""
+	.string	"n\222;($kt\222'4HAi\314\261\200N\362\204\230\276\341`\304)fhm\216'\030q\212*$jt\222'h\260\206\300A\211$\352pP\356\350(w\216.]4\"\333\234\326\004\333#\200"
+	.string	"\001D\210\024\250t\b\022B !\204\265C\220@CC\002\b\032\266A\320\\\245RYc\223\263sD\2328A\221(B\331&cp\233$\2668-R\245\205\004K\253\002#\t\026\0239F\244\222D\313J2\331\"M\034\221(\344X"
+	.ascii	"\331\226H\0321P\022[\025\224Hb{\263\222\202\210\264i\221\253"
+	.ascii	"M[\314QA\"id\2255\036Dh[\244\t\311V\251BD\n\224-6\255\316\316"
+	.ascii	"\213\262\330\342\264$Z\332\232\f\\\240B\3478\002\331\252 \342"
+	.ascii	"\254(k@\320\260\311\032\233\344\361\005\331*\213D$\361f\2042"
+	.ascii	"\347hB\2534\"S\\\240\302\206\330v\340\004\305\366\246\310\"\200"
+	.ascii	"\034\243\211V\205\013\304d\016\021\231\202\322x\342\304\261\030"
+	.ascii	"\223\254\201I\022Q\344\020G([\023+\030\264\006\235\r\214hkr\216"
+	.ascii	"Fe\261E\032K\320I\236xA\022o\212\270o8\330\024Q``SDa\341D\253"
+	.ascii	"L\252H\326\034[\033#\n\0137\254\262M\226(q\254A\301\366\r\207"
+	.ascii	"\244\216\t\235\003$kZ\034c\211#\022\005\fp\216\305\025er\307"
+	.ascii	"\0046\022HqD\256(\221-\212\034\343z\202\"\021G\005\230d\262\315"
+	.ascii	"Q\336\2300\"E\264J\343M\n\030\034\242\021\331\222\210I\266;8"
+	.ascii	"\304\017 \225J\"\213\262o8$\221-\n#\322f\203>\352\264\310\016"
+	.ascii	"\312\343\021\331\241\245\255)!\203VGE\n,\311\032\227d\315\007"
+	.ascii	"\224\310#\n\030Z\034\025\210)\240Xm\326d\212#\022'q\216E\034"
+	.ascii	"\202\035\025\021$\217:8\247m\221\305$\016\316\216\tmr\307\305"
+	.ascii	"\246E\022[\234\242J\212c\007\220\307$r\247\270\242\254\t\241"
+	.ascii	"\3141\256MC3B\203\0074@\001\266\310A'y\242F\211<\352\250 \342"
+	.ascii	"\350$\2156\035\216\306\0169F\342\211\016Ed\262\003\007\002(s"
+	.ascii	"v\216#T \"M\254\340\034\217"
+	.string	"\"jRN\220c\304\021\321\026\215(\332\022\332\344\316Kw\343\266\347\222\036 \035\333\032\332ZS\360\361\255k\376\271=\306i8\r\367XY\262\024\366\300U\023\344\035\271\252\362pR;bt\351X\262!TkX\355\177\252\374\016\177\252hrZO\264b\234a\256\267\033\325$3\314\363\343\324g\370\030\363\320\275`\232^\273\257C\322\267\202\254q\031L\340\321\323\322c,\305c\\YjI\036/\351\323\342s\013\303bTYi?\374\372\357I\230\203p\017\fK\ty\031N=\376-\242\277*6\257[\247\342\202g\316i\007\266\301\346\0243\353\272~e@3\264\036\337\270\201\271\234,;\235J\345\214V\331Iea\035\215\271\372b\2149\325x\214\267>\356ipk\3571\306\201s\274\330\362\223\312\201\265^\350j8!] lZ\222\274&\347\363\300\217\213L:\325\230\006\236\3026n \233\004]\002:"
+	.ascii	"\356\211K\017\245.\250Uc\033\215\261<|\300JBpPM\036\343\032/"
+	.ascii	"Ivn\177W\370IK\306\024\004\226\354hh\bW56\n\203\353\311{\214"
+	.ascii	"\251\032\277\230\022\272\303\233\001xuD\303\213m\226\034D\215"
+	.ascii	"\217\210\260\324\315\263\220\227d\331\251\302\243\013G!a\366"
+	.ascii	"I\232yq\341\007%\243\251\261T\343(\017\037zI\316\224\231\331"
+	.ascii	"c\f\325\370\251\212\211\231\017\024?\335\340\253F1bq\f\020\232"
+	.ascii	"\n\237\2408Q\341\325\330z\374L\275"
+	.string	"\344\203\334\266\232\036\343\245\366\253\216Q\005\203\220\250B\0015J\343J\031!\222\021I\222$\035\302\n\020\204\"y\234\330\354\016\022\2004AO:\b\311\314H\nR\220R\245=\003h)~\034+\274"
+	.string	"\215\256\231\261\020]\250\341c\370\243\261}X\037\316k"
+	.string	"-\351\217z\232\377\370\321^\030a\3526T\2459\311\005\313=\302|D\366L\265\354cmT d\215\353Q\244m\250\027\341N\206\322*Q\330\323\034\310?\373\344q\022%`\210\246'\262A)2\247\251\252\347\304\246hP\241\240\230\356\304\002\026\360\270,\274\317\006#\240\340A\320\300\254\247}\304\351\230/\006\037\365\342\374\005K\232f\215l`(\321h+4\247\306\260\367\332\2418\251\226sY\035)$\335\307\342\314:\027\024\211S*\325\254\267D\321L\020\0267/\360\247\261eg)'<d\300g\272>h\024\226\276\002\276H\004\024\246\035\322z\005\004\033\216\341\277/b2\244\200r\247z\312\332\310L\304\255VG\231\314\314\032\321\357B\022\221\212\271\274\203\003"
+	.string	"\205\333\263\236\002\032"
+	.string	"q\350"
+	.string	"\227F\225\372\336D\023q\353C\327\264~\356yL\200X\256R~\203S\362\353\363\364&l\334\267\224\367CY"
+	.string	"<\374\275\255\220D}\375;\3637W\261\320\212\340\305a\260\272\324$\267}\0228\006\375M\027\212\313\345\321&\0043\005\315\352\341\344\254\271\271bw\275\224<\364\271\365\367\230\2721=\361\025\2415\252\3307bwQ\214\364z\022\256\254\270\256\357]Prsp\035\bUw6d\250.*\351"
+	.string	"\367w\330\330#8^;\363\336J\b\316%T \004_,\307\200\360?\351\266\265\226|\344\320\377\032\305*\001\354\004\204\r*U\242l\314\211S\277f\342\242\r\270J\220\316\216\016[p\316Q\304\222'\204\2112?t$\207\262r\002\"/\355\036\354\360#S\016M\233~\376\205\356?#\211j\3146KZ \034\366\2459\177\005a\204\233\034\027\225\223\362\211>\364_bu\357ghK\372\3554\223\264\215\336\363\206\340\300\243\024\304\375\235\247\364&\220\327\302Z\2141\274\006q\315\312\271q\b\242\020"
+	.string	"\361+\233\350\331\033tKP8ZK\226\245\345c&xFl|\017\317\232\230\353\334LU+\n\r\264!_\207VK\372\251\234\340C:\237\320\r\265\363\237+\345\t\177\215\"\337y\301\203\315\343\330d\001\0345w\036\261\034b\037\372\272:\213\013d\373\236y\227\205\304\241&[U\003\t\334\255\316\211\250O\303\024\2766\303\355\214bS[\b\331W"
+	.string	"J\247S\262\326\315^K\373H\022$1\304B\032\330\361\034\332*\355\252m\242\253\275\261\354A\ns,\225vb\005\3170\260C\303\304\262\236;\265\201\334lc\355A)#\336{\210\222\026\363\243\202\020\222\275\372\2534\030&ha\364\351\252W\203B\t\221T\006\373\201\353\007 \203H\220\302`\013\315\264a\226\366\2026\236k\232\223@\307\030b\312\315\265A\200C!\334\223C\315\013\303\336E\244\021\tO\016E,i@L\230%d\022\370\005\224\3368\242$,\366\341<)\216\244Ps!\3660\351\360\216\216\314\002(\216\356\265"
+	.string	"4}\334-\231\220r\367'l>aw\307\254\330\024\375\327|\267UB\235\237\252l\215u\200:'\345w\243>\237\371\030\031MN*\207L6S\350\255~r\366\345\367LA\254l\340\243mB\202\025\024\b\232\002\345\024\326\326j\216\334\325\237\214\242\b-\023\304\025\331\346\031\2741\270\361I\200x\327\213\363\212\336Y\324W\333.\326-\031&\265\202JO\257dA{\322\217\324\322})\343kZ\272"
+	.string	"\277\016\206\302@\305@H#h.r\034\007Y\213\211Z/\345u\247u"
+	.string	"&o\232\212\350l\262\002\247\343\231\227\016=\357\2604\350\243\245\b\225)O\367\303\254\224\254\270\032\200\025\031\n*)\207\271t\002\037\244\035\267\236\340]\253d\366\373\263C\347}\025\275\232\220e`-8\355N\311\371\201\351\377\2149@,\323\266\350\247q\317y\200\347\267\206\245\241\226'O\342\215\337\035\372\370\n\353\340\374\262\241D,I`\334b=&k\210f\301\\\006\022"
+	.ascii	"\263C\003\350\331\271\210PJ,\314\264\361\230\255J\004\204\220"
+	.ascii	")\230\251\304\224,'\334\004\332\333C\330[\002r\364\266Tk\377"
+	.ascii	"\205\021\326`=\022\340\214\341\341\236\036\\z\2633\f\274\204"
+	.ascii	"di\370N\f\332o\330\217\377\310\024\267\363<[k\237y>\217\031\347"
+	.ascii	">\";r\311\216\360\031\371<*\322~\317A\003l>\377\306%\007\277"
+	.ascii	"\016\2453\002ve\006\367:\200k\\ \2740\216#\226H\335l\016\031"
+	.ascii	"4\226T\230\277\307\226\026\026N\030\030\013?\3539\005\237\r\273"
+	.ascii	"\034\327\3522\267\316\336<\240\305E\362H\274\243k\234\234\237"
+	.ascii	"F]\366\216+\370\023g\332\003x\275\245\b\323\214`\343GmX\371\211"
+	.ascii	"J\200\235\240\327\263q \375\355\336FR\305M\312\336\025t'\270"
+	.ascii	"\247\212p\310\317wW\221\245;'\013'l]2sg\255\230\212\245\333~"
+	.ascii	"\3411Kr\361\237\310j\364\020\377\314\021\030\317\366\363\036"
+	.ascii	"\205\351\212\260\323D\320w\364'\367~\217\354\177\207t{\253f_"
+	.ascii	"\227E\204\305\2114\203\316\bP\375\242\0338\264\b-\006t\320,\327"
+	.ascii	"\3042x\214\305/\025\344\322\342\004\236\373\355\247\264\314i"
+	.ascii	"qP\373\302\034|\231\346\003\336\306\270\032\022JF.\n\r\275\016"
+	.ascii	"R#\006^Se8\200\306\232<\037\016\361\223!(N\211\353\263\005\203"
+	.ascii	"2\210\360;\271\315\362\2279\365\330\345\303KO\354\254\031P\220"
+	.ascii	"G\003\fl\336\303\305C\344\267\007\027\021\373\\yJ.&\2311\272"
+	.ascii	"\275\370\346\361e\370\210\373+@\265\332\254\037\341\355\t\274"
+	.ascii	"\315\221\335\226\261X;-\336\020\370\377\363\0232\334\317\027"
+	.ascii	"\260O\3164\310\005\345\376\2723\365\373\230\327{\276\027O\235"
+	.ascii	"\237k\272!\333\273\373\037\373\344\244\376\"_w\304\\\2239\363"
+	.ascii	"\340f\303\251rN<?\350\273\256\3741\354 \363\2172\317\225\363"
+	.ascii	"\013\366\004\307\\\247~G\327\276~\262;\301\037=\206\021\336+"
+	.ascii	"m\225\203\346\214,\201\027\260g\334P\273\0357\375'\022B\257\345"
+	.ascii	"\013\373D\"\0278\213\266\006 ^\351\353\240q\253\231q\r\026\262"
+	.ascii	":\306\237\276y\001\363\336\227c\303\277\373C\366\177\365\320"
+	.ascii	"\265\244\277^\262\372\316+l\374h\201\310\363\367&\272[\370uH"
+	.ascii	"\335A\223\031a\316\327#\003O\243\306M\332OH\357\223\033\003<"
+	.ascii	"\257](\263o\235\002\247jO\230\f\267\264\233\352\324Z\013;7\371"
+	.ascii	"\310\327\335\376\333\357n\315\227\241\025\037L\242\025"
+	.text
+	.section	.gnu.lto_.symtab.f9c062ccbb072830,"e",@progbits
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f9c062ccbb072830,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
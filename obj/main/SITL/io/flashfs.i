@@ -0,0 +1,2710 @@
+# 0 "./src/main/io/flashfs.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/io/flashfs.c"
+# 35 "./src/main/io/flashfs.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 36 "./src/main/io/flashfs.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 37 "./src/main/io/flashfs.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 38 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 149 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 150 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 162 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_InitTypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 239 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+# 151 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 152 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 33 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 381 "./src/main/target/common_post.h"
+extern uint8_t eepromData[32768];
+# 153 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 154 "./src/main/platform.h" 2
+# 40 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/common/crc.h" 1
+# 21 "./src/main/common/crc.h"
+       
+
+struct sbuf_s;
+
+uint16_t crc16_ccitt(uint16_t crc, unsigned char a);
+uint16_t crc16_ccitt_update(uint16_t crc, const void *data, uint32_t length);
+struct sbuf_s;
+void crc16_ccitt_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+
+uint8_t crc8_calc(uint8_t crc, unsigned char a, uint8_t poly);
+uint8_t crc8_update(uint8_t crc, const void *data, uint32_t length, uint8_t poly);
+void crc8_sbuf_append(struct sbuf_s *dst, uint8_t *start, uint8_t poly);
+
+
+
+
+
+
+uint8_t crc8_xor_update(uint8_t crc, const void *data, uint32_t length);
+void crc8_xor_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+# 42 "./src/main/io/flashfs.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 64 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct fp_rotationMatrix_s {
+    float m[3][3];
+} fp_rotationMatrix_t;
+
+int gcd(int num, int denom);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void buildRotationMatrix(fp_angles_t *delta, fp_rotationMatrix_t *rotation);
+void applyMatrixRotation(float *v, fp_rotationMatrix_t *rotationMatrix);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 147 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 43 "./src/main/io/flashfs.c" 2
+# 1 "./src/main/common/printf.h" 1
+# 105 "./src/main/common/printf.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 108 "./src/main/common/printf.h" 2
+
+
+# 109 "./src/main/common/printf.h"
+typedef void (*putcf) (void *, char);
+extern putcf stdout_putf;
+extern void *stdout_putp;
+
+void init_printf(void *putp, void (*putf) (void *, char));
+
+int tfp_sprintf(char *s, const char *fmt, ...);
+int tfp_format(void *putp, void (*putf) (void *, char), const char *fmt, va_list va);
+# 44 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/drivers/flash.h" 1
+# 21 "./src/main/drivers/flash.h"
+       
+
+
+
+# 1 "./src/main/pg/flash.h" 1
+# 21 "./src/main/pg/flash.h"
+       
+
+
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 26 "./src/main/pg/flash.h" 2
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 44 "./src/main/build/build_config.h"
+typedef enum {
+    MCU_TYPE_SIMULATOR = 0,
+    MCU_TYPE_F103,
+    MCU_TYPE_F303,
+    MCU_TYPE_F40X,
+    MCU_TYPE_F411,
+    MCU_TYPE_F446,
+    MCU_TYPE_F722,
+    MCU_TYPE_F745,
+    MCU_TYPE_F746,
+    MCU_TYPE_F765,
+    MCU_TYPE_H750,
+    MCU_TYPE_H743_REV_UNKNOWN,
+    MCU_TYPE_H743_REV_Y,
+    MCU_TYPE_H743_REV_X,
+    MCU_TYPE_H743_REV_V,
+    MCU_TYPE_H7A3,
+    MCU_TYPE_H723_725,
+    MCU_TYPE_G474,
+    MCU_TYPE_H730,
+    MCU_TYPE_UNKNOWN = 255,
+} mcuTypeId_e;
+
+mcuTypeId_e getMcuTypeId(void);
+# 27 "./src/main/pg/pg.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint8_t length;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgElementSize(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_MASK) / reg->length;}
+# 75 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 194 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 200 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 200 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 28 "./src/main/pg/flash.h" 2
+
+typedef struct flashConfig_s {
+    ioTag_t csTag;
+    uint8_t spiDevice;
+    uint8_t quadSpiDevice;
+} flashConfig_t;
+
+extern flashConfig_t flashConfig_System; extern flashConfig_t flashConfig_Copy; static inline const flashConfig_t* flashConfig(void) { return &flashConfig_System; } static inline flashConfig_t* flashConfigMutable(void) { return &flashConfig_System; } struct _dummy;
+# 26 "./src/main/drivers/flash.h" 2
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDIO_CK,
+    OWNER_SDIO_CMD,
+    OWNER_SDIO_D0,
+    OWNER_SDIO_D1,
+    OWNER_SDIO_D2,
+    OWNER_SDIO_D3,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EOC,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX_POWER,
+    OWNER_VTX_CS,
+    OWNER_VTX_DATA,
+    OWNER_VTX_CLK,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_BARO_XCLR,
+    OWNER_PULLUP,
+    OWNER_PULLDOWN,
+    OWNER_DSHOT_BITBANG,
+    OWNER_SWD,
+    OWNER_RX_SPI_EXPRESSLRS_RESET,
+    OWNER_RX_SPI_EXPRESSLRS_BUSY,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+typedef struct resourceOwner_s {
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+} resourceOwner_t;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+# 110 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 111 "./src/main/drivers/io.h" 2
+
+
+# 112 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 112 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 113 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 113 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 121 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 121 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+
+typedef void (*IOTraverseFuncPtr_t)(IO_t io);
+
+void IOTraversePins(IOTraverseFuncPtr_t func);
+
+GPIO_TypeDef* IO_GPIO(IO_t io);
+uint16_t IO_Pin(IO_t io);
+# 27 "./src/main/drivers/flash.h" 2
+
+
+
+
+
+
+
+typedef enum {
+    FLASH_TYPE_NOR = 0,
+    FLASH_TYPE_NAND
+} flashType_e;
+
+typedef uint16_t flashSector_t;
+
+typedef struct flashGeometry_s {
+    flashSector_t sectors;
+    uint16_t pageSize;
+    uint32_t sectorSize;
+    uint32_t totalSize;
+    uint16_t pagesPerSector;
+    flashType_e flashType;
+} flashGeometry_t;
+
+void flashPreInit(const flashConfig_t *flashConfig);
+
+# 51 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 51 "./src/main/drivers/flash.h"
+    flashInit(const flashConfig_t *flashConfig);
+
+
+# 53 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 53 "./src/main/drivers/flash.h"
+    flashIsReady(void);
+
+# 54 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 54 "./src/main/drivers/flash.h"
+    flashWaitForReady(void);
+void flashEraseSector(uint32_t address);
+void flashEraseCompletely(void);
+void flashPageProgramBegin(uint32_t address, void (*callback)(uint32_t arg));
+uint32_t flashPageProgramContinue(const uint8_t **buffers, uint32_t *bufferSizes, uint32_t bufferCount);
+void flashPageProgramFinish(void);
+void flashPageProgram(uint32_t address, const uint8_t *data, uint32_t length, void (*callback)(uint32_t length));
+int flashReadBytes(uint32_t address, uint8_t *buffer, uint32_t length);
+void flashFlush(void);
+const flashGeometry_t *flashGetGeometry(void);
+
+
+
+
+
+typedef struct flashPartition_s {
+    uint8_t type;
+    flashSector_t startSector;
+    flashSector_t endSector;
+} flashPartition_t;
+
+
+
+
+
+typedef enum {
+    FLASH_PARTITION_TYPE_UNKNOWN = 0,
+    FLASH_PARTITION_TYPE_PARTITION_TABLE,
+    FLASH_PARTITION_TYPE_FLASHFS,
+    FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT,
+    FLASH_PARTITION_TYPE_FIRMWARE,
+    FLASH_PARTITION_TYPE_CONFIG,
+    FLASH_MAX_PARTITIONS
+} flashPartitionType_e;
+
+typedef struct flashPartitionTable_s {
+    flashPartition_t partitions[FLASH_MAX_PARTITIONS];
+} flashPartitionTable_t;
+
+void flashPartitionSet(uint8_t index, uint32_t startSector, uint32_t endSector);
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type);
+const flashPartition_t *flashPartitionFindByIndex(uint8_t index);
+const char *flashPartitionGetTypeName(flashPartitionType_e type);
+int flashPartitionCount(void);
+# 46 "./src/main/io/flashfs.c" 2
+# 1 "./src/main/drivers/time.h" 1
+# 21 "./src/main/drivers/time.h"
+       
+
+
+
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+# 31 "./src/main/common/time.h"
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+static inline int32_t cmpTimeCycles(uint32_t a, uint32_t b) { return (int32_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 86 "./src/main/common/time.h" 3 4
+_Bool 
+# 86 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 92 "./src/main/common/time.h" 3 4
+_Bool 
+# 92 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 94 "./src/main/common/time.h" 3 4
+_Bool 
+# 94 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 97 "./src/main/common/time.h" 3 4
+_Bool 
+# 97 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 100 "./src/main/common/time.h" 3 4
+_Bool 
+# 100 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 103 "./src/main/common/time.h" 3 4
+_Bool 
+# 103 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 26 "./src/main/drivers/time.h" 2
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 47 "./src/main/io/flashfs.c" 2
+
+# 1 "./src/main/io/flashfs.h" 1
+# 21 "./src/main/io/flashfs.h"
+       
+# 31 "./src/main/io/flashfs.h"
+void flashfsEraseCompletely(void);
+void flashfsEraseRange(uint32_t start, uint32_t end);
+
+uint32_t flashfsGetSize(void);
+uint32_t flashfsGetOffset(void);
+uint32_t flashfsGetWriteBufferFreeSpace(void);
+uint32_t flashfsGetWriteBufferSize(void);
+int flashfsIdentifyStartOfFreeSpace(void);
+int flashfsGetLogCount(void);
+
+# 40 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 40 "./src/main/io/flashfs.h"
+    flashfsGetLog(int index, uint32_t *start, uint32_t *end);
+struct flashGeometry_s;
+const struct flashGeometry_s* flashfsGetGeometry(void);
+
+void flashfsSeekAbs(uint32_t offset);
+
+void flashfsWriteByte(uint8_t byte);
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 47 "./src/main/io/flashfs.h" 3 4
+                                                        _Bool 
+# 47 "./src/main/io/flashfs.h"
+                                                             sync);
+
+int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
+
+
+# 51 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 51 "./src/main/io/flashfs.h"
+    flashfsFlushAsync(
+# 51 "./src/main/io/flashfs.h" 3 4
+                      _Bool 
+# 51 "./src/main/io/flashfs.h"
+                           force);
+void flashfsFlushSync(void);
+
+void flashfsClose(void);
+void flashfsInit(void);
+
+# 56 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 56 "./src/main/io/flashfs.h"
+    flashfsIsSupported(void);
+
+
+# 58 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 58 "./src/main/io/flashfs.h"
+    flashfsIsReady(void);
+
+# 59 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 59 "./src/main/io/flashfs.h"
+    flashfsIsEOF(void);
+
+
+# 61 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 61 "./src/main/io/flashfs.h"
+    flashfsVerifyEntireFlash(void);
+# 49 "./src/main/io/flashfs.c" 2
+
+enum {
+
+
+
+    FREE_BLOCK_SIZE = 2048,
+
+
+    FREE_BLOCK_TEST_SIZE_INTS = 4,
+    FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
+};
+# 77 "./src/main/io/flashfs.c"
+typedef struct flashfsIndexRecord_s {
+    uint16_t magic;
+    uint16_t crc;
+    uint32_t start;
+    uint32_t end;
+} flashfsIndexRecord_t;
+
+typedef enum {
+    FLASHFS_INDEX_IDLE,
+    FLASHFS_INDEX_DRAIN,
+    FLASHFS_INDEX_ERASE,
+    FLASHFS_INDEX_PROGRAM,
+    FLASHFS_INDEX_FLUSH,
+} flashfsIndexState_e;
+
+static const flashPartition_t *flashPartition = 
+# 92 "./src/main/io/flashfs.c" 3 4
+                                               ((void *)0)
+# 92 "./src/main/io/flashfs.c"
+                                                   ;
+static const flashGeometry_t *flashGeometry = 
+# 93 "./src/main/io/flashfs.c" 3 4
+                                             ((void *)0)
+# 93 "./src/main/io/flashfs.c"
+                                                 ;
+static uint32_t flashfsSize = 0;
+
+
+static uint16_t indexSlotCount = 0;
+
+static 
+# 99 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 99 "./src/main/io/flashfs.c"
+           indexDisabled = 
+# 99 "./src/main/io/flashfs.c" 3 4
+                           0
+# 99 "./src/main/io/flashfs.c"
+                                ;
+
+static uint16_t indexNextSlot = 0;
+
+static flashfsIndexState_e indexState = FLASHFS_INDEX_IDLE;
+
+static __attribute__ ((section(".dmaram_bss"), aligned(32))) flashfsIndexRecord_t indexWriteBuffer;
+
+static uint32_t logStartAddress = 0;
+
+static __attribute__ ((section(".dmaram_bss"), aligned(32))) uint8_t flashWriteBuffer[(256 * 2)];
+
+
+static uint16_t pageBufferSize = 256;
+static uint16_t writeBufferSize = (256 * 2);
+# 125 "./src/main/io/flashfs.c"
+static uint16_t bufferHead = 0;
+static volatile uint16_t bufferTail = 0;
+# 135 "./src/main/io/flashfs.c"
+static volatile 
+# 135 "./src/main/io/flashfs.c" 3 4
+               _Bool 
+# 135 "./src/main/io/flashfs.c"
+                    dataWritten = 
+# 135 "./src/main/io/flashfs.c" 3 4
+                                  1
+# 135 "./src/main/io/flashfs.c"
+                                      ;
+# 153 "./src/main/io/flashfs.c"
+static uint32_t tailAddress = 0;
+
+static 
+# 155 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 155 "./src/main/io/flashfs.c"
+           flashfsUpdateIndex(void);
+static void flashfsFinishLog(void);
+
+static void flashfsClearBuffer(void)
+{
+    bufferTail = bufferHead = 0;
+}
+
+static 
+# 163 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 163 "./src/main/io/flashfs.c"
+           flashfsBufferIsEmpty(void)
+{
+    return bufferTail == bufferHead;
+}
+
+static void flashfsSetTailAddress(uint32_t address)
+{
+    tailAddress = address;
+}
+
+void flashfsEraseCompletely(void)
+{
+    if (flashGeometry->sectors > 0 && flashPartitionCount() > 0) {
+
+        const 
+# 177 "./src/main/io/flashfs.c" 3 4
+             _Bool 
+# 177 "./src/main/io/flashfs.c"
+                  doFullErase = (flashPartitionCount() == 1) && ((flashPartition->endSector + 1 - flashPartition->startSector) == flashGeometry->sectors);
+        if (doFullErase) {
+            flashEraseCompletely();
+        } else {
+
+
+
+
+
+
+
+            for (flashSector_t sectorIndex = flashPartition->startSector; sectorIndex <= flashPartition->endSector; sectorIndex++) {
+                uint32_t sectorAddress = sectorIndex * flashGeometry->sectorSize;
+                flashEraseSector(sectorAddress);
+            }
+        }
+    }
+
+    flashfsClearBuffer();
+
+    flashfsSetTailAddress(0);
+
+    indexDisabled = 
+# 199 "./src/main/io/flashfs.c" 3 4
+                   0
+# 199 "./src/main/io/flashfs.c"
+                        ;
+    indexNextSlot = 0;
+    indexState = FLASHFS_INDEX_IDLE;
+    logStartAddress = 0;
+}
+
+
+
+
+
+void flashfsEraseRange(uint32_t start, uint32_t end)
+{
+    if (flashGeometry->sectorSize <= 0)
+        return;
+
+
+    int startSector = start / flashGeometry->sectorSize;
+
+
+    int endSector = end / flashGeometry->sectorSize;
+    int endRemainder = end % flashGeometry->sectorSize;
+
+    if (endRemainder > 0) {
+        endSector++;
+    }
+
+    for (int sectorIndex = startSector; sectorIndex < endSector; sectorIndex++) {
+        uint32_t sectorAddress = sectorIndex * flashGeometry->sectorSize;
+        flashEraseSector(sectorAddress);
+    }
+}
+
+
+
+
+
+static 
+# 235 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 235 "./src/main/io/flashfs.c"
+           flashfsIndexAllowsData(void)
+{
+    return indexState == FLASHFS_INDEX_DRAIN || flashfsUpdateIndex();
+}
+
+
+
+
+
+# 243 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 243 "./src/main/io/flashfs.c"
+    flashfsIsReady(void)
+{
+
+
+    return (flashfsIsSupported() && flashfsUpdateIndex() && flashIsReady());
+}
+
+
+# 250 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 250 "./src/main/io/flashfs.c"
+    flashfsIsSupported(void)
+{
+    return flashfsSize > 0;
+}
+
+uint32_t flashfsGetSize(void)
+{
+    return flashfsSize;
+}
+
+static uint32_t flashfsTransmitBufferUsed(void)
+{
+    if (bufferHead >= bufferTail)
+        return bufferHead - bufferTail;
+
+    return writeBufferSize - bufferTail + bufferHead;
+}
+
+
+
+
+uint32_t flashfsGetWriteBufferSize(void)
+{
+
+    return writeBufferSize - 1;
+}
+
+
+
+
+uint32_t flashfsGetWriteBufferFreeSpace(void)
+{
+    return flashfsGetWriteBufferSize() - flashfsTransmitBufferUsed();
+}
+
+
+
+
+static uint32_t flashfsTailBytesToPageBoundary(void)
+{
+    return pageBufferSize - tailAddress % pageBufferSize;
+}
+# 300 "./src/main/io/flashfs.c"
+static 
+# 300 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 300 "./src/main/io/flashfs.c"
+           flashfsPageBufferIsFull(void)
+{
+    return flashfsTransmitBufferUsed() >= flashfsTailBytesToPageBoundary();
+}
+
+
+
+
+static void flashfsAdvanceTailInBuffer(uint32_t delta)
+{
+    bufferTail += delta;
+
+
+    if (bufferTail >= writeBufferSize) {
+        bufferTail -= writeBufferSize;
+    }
+}
+# 337 "./src/main/io/flashfs.c"
+void flashfsWriteCallback(uint32_t arg)
+{
+
+    flashfsSetTailAddress(tailAddress + arg);
+
+
+    flashfsAdvanceTailInBuffer(arg);
+
+
+    dataWritten = 
+# 346 "./src/main/io/flashfs.c" 3 4
+                 1
+# 346 "./src/main/io/flashfs.c"
+                     ;
+}
+
+static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSizes, int bufferCount, 
+# 349 "./src/main/io/flashfs.c" 3 4
+                                                                                                    _Bool 
+# 349 "./src/main/io/flashfs.c"
+                                                                                                         sync)
+{
+    uint32_t bytesWritten;
+
+
+
+
+
+    if (sync) {
+        while (!flashfsIndexAllowsData() || !flashIsReady());
+    } else {
+        if (!flashfsIndexAllowsData() || !flashIsReady()) {
+            return 0;
+        }
+    }
+
+
+    if (flashfsIsEOF()) {
+        return 0;
+    }
+
+
+
+
+
+    flashPageProgramBegin(tailAddress, flashfsWriteCallback);
+
+
+
+
+    dataWritten = 
+# 379 "./src/main/io/flashfs.c" 3 4
+                 0
+# 379 "./src/main/io/flashfs.c"
+                      ;
+
+    bytesWritten = flashPageProgramContinue(buffers, bufferSizes, bufferCount);
+
+
+
+
+
+    flashPageProgramFinish();
+
+    return bytesWritten;
+}
+
+
+
+
+
+
+
+static int flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t bufferSizes[])
+{
+    buffers[0] = flashWriteBuffer + bufferTail;
+    buffers[1] = flashWriteBuffer + 0;
+
+    if (bufferHead > bufferTail) {
+        bufferSizes[0] = bufferHead - bufferTail;
+        bufferSizes[1] = 0;
+        return 1;
+    } else if (bufferHead < bufferTail) {
+        bufferSizes[0] = writeBufferSize - bufferTail;
+        bufferSizes[1] = bufferHead;
+        if (bufferSizes[1] == 0) {
+            return 1;
+        } else {
+            return 2;
+        }
+    }
+
+    bufferSizes[0] = 0;
+    bufferSizes[1] = 0;
+
+    return 0;
+}
+
+
+
+
+
+static int flashfsGetDirtyPageBuffers(uint8_t const *buffers[], uint32_t bufferSizes[])
+{
+    const int bufCount = flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+    const uint32_t pageRemaining = flashfsTailBytesToPageBoundary();
+
+    if (bufferSizes[0] >= pageRemaining) {
+        bufferSizes[0] = pageRemaining;
+        bufferSizes[1] = 0;
+        return 1;
+    }
+
+    bufferSizes[1] = __extension__ ({ __typeof__ (bufferSizes[1]) _a = (bufferSizes[1]); __typeof__ (pageRemaining - bufferSizes[0]) _b = (pageRemaining - bufferSizes[0]); _a < _b ? _a : _b; });
+
+    return bufCount;
+}
+
+
+static 
+# 444 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 444 "./src/main/io/flashfs.c"
+           flashfsNewData()
+{
+    return dataWritten;
+}
+
+
+
+
+
+uint32_t flashfsGetOffset(void)
+{
+    uint8_t const * buffers[2];
+    uint32_t bufferSizes[2];
+
+
+
+    flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+
+    return tailAddress + bufferSizes[0] + bufferSizes[1];
+}
+# 474 "./src/main/io/flashfs.c"
+
+# 474 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 474 "./src/main/io/flashfs.c"
+    flashfsFlushAsync(
+# 474 "./src/main/io/flashfs.c" 3 4
+                      _Bool 
+# 474 "./src/main/io/flashfs.c"
+                           force)
+{
+    uint8_t const * buffers[2];
+    uint32_t bufferSizes[2];
+    int bufCount;
+
+    if (flashfsBufferIsEmpty()) {
+        return 
+# 481 "./src/main/io/flashfs.c" 3 4
+              1
+# 481 "./src/main/io/flashfs.c"
+                  ;
+    }
+
+    if (!force && !flashfsPageBufferIsFull()) {
+        return 
+# 485 "./src/main/io/flashfs.c" 3 4
+              0
+# 485 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    if (!flashfsNewData()) {
+
+        return 
+# 490 "./src/main/io/flashfs.c" 3 4
+              0
+# 490 "./src/main/io/flashfs.c"
+                   ;
+    }
+# 507 "./src/main/io/flashfs.c"
+    bufCount = flashfsGetDirtyPageBuffers(buffers, bufferSizes);
+    if (bufCount) {
+        flashfsWriteBuffers(buffers, bufferSizes, bufCount, 
+# 509 "./src/main/io/flashfs.c" 3 4
+                                                           0
+# 509 "./src/main/io/flashfs.c"
+                                                                );
+    }
+
+    return flashfsBufferIsEmpty();
+}
+
+
+
+
+
+
+
+void flashfsFlushSync(void)
+{
+    uint8_t const * buffers[2];
+    uint32_t bufferSizes[2];
+    int bufCount;
+
+
+    while (!flashfsBufferIsEmpty()) {
+
+
+        const timeMs_t startMs = millis();
+        while (!flashfsNewData()) {
+            if (cmp32(millis(), startMs) >= 100) {
+                return;
+            }
+        }
+
+        bufCount = flashfsGetDirtyPageBuffers(buffers, bufferSizes);
+        if (bufCount == 0 || flashfsWriteBuffers(buffers, bufferSizes, bufCount, 
+# 539 "./src/main/io/flashfs.c" 3 4
+                                                                                1
+# 539 "./src/main/io/flashfs.c"
+                                                                                    ) == 0) {
+            break;
+        }
+    }
+
+
+    if (flashfsBufferIsEmpty() || flashfsIsEOF()) {
+        while (!flashfsUpdateIndex());
+    }
+
+    while (!flashIsReady());
+}
+
+void flashfsSeekAbs(uint32_t offset)
+{
+    flashfsFlushSync();
+
+    flashfsSetTailAddress(offset);
+}
+
+
+
+
+void flashfsWriteByte(uint8_t byte)
+{
+
+
+
+
+    flashWriteBuffer[bufferHead++] = byte;
+
+    if (bufferHead >= writeBufferSize) {
+        bufferHead = 0;
+    }
+
+    if (flashfsPageBufferIsFull()) {
+        flashfsFlushAsync(
+# 575 "./src/main/io/flashfs.c" 3 4
+                         0
+# 575 "./src/main/io/flashfs.c"
+                              );
+    }
+}
+
+
+
+
+
+
+
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 585 "./src/main/io/flashfs.c" 3 4
+                                                        _Bool 
+# 585 "./src/main/io/flashfs.c"
+                                                             sync)
+{
+    uint8_t const * buffers[2];
+    uint32_t bufferSizes[2];
+    int bufCount;
+
+
+
+
+
+
+
+    while (len > 0) {
+
+
+
+
+        const uint32_t used = flashfsTransmitBufferUsed();
+        const uint32_t pageRemaining = flashfsTailBytesToPageBoundary();
+        uint32_t runLength = __extension__ ({ __typeof__ (len) _a = (len); __typeof__ ((uint32_t)(writeBufferSize - bufferHead)) _b = ((uint32_t)(writeBufferSize - bufferHead)); _a < _b ? _a : _b; });
+        if (used < pageRemaining) {
+            runLength = __extension__ ({ __typeof__ (runLength) _a = (runLength); __typeof__ (pageRemaining - used) _b = (pageRemaining - used); _a < _b ? _a : _b; });
+        }
+
+        memcpy(&flashWriteBuffer[bufferHead], data, runLength);
+
+        bufferHead += runLength;
+        if (bufferHead >= writeBufferSize) {
+            bufferHead = 0;
+        }
+        data += runLength;
+        len -= runLength;
+
+        if (flashfsPageBufferIsFull()) {
+            flashfsFlushAsync(
+# 619 "./src/main/io/flashfs.c" 3 4
+                             0
+# 619 "./src/main/io/flashfs.c"
+                                  );
+        }
+    }
+
+
+
+
+
+
+    if (flashfsPageBufferIsFull()) {
+        bufCount = flashfsGetDirtyPageBuffers(buffers, bufferSizes);
+        if (bufCount) {
+            flashfsWriteBuffers(buffers, bufferSizes, bufCount, sync);
+        }
+    }
+}
+
+
+
+
+
+
+int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
+{
+    int bytesRead;
+
+
+    if (address + len > flashfsSize) {
+
+        len = flashfsSize - address;
+    }
+
+
+    flashfsFlushSync();
+
+    bytesRead = flashReadBytes(address, buffer, len);
+
+    return bytesRead;
+}
+
+
+
+
+
+static uint32_t flashfsFindStartOfFreeSpace(uint32_t start)
+{
+# 673 "./src/main/io/flashfs.c"
+    _Static_assert((FREE_BLOCK_SIZE >= 2048), "FREE_BLOCK_SIZE_too_small");
+
+    static __attribute__ ((section(".dmaram_data"), aligned(32))) union {
+        uint8_t bytes[FREE_BLOCK_TEST_SIZE_BYTES];
+        uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
+    } testBuffer;
+
+    int left = (start + FREE_BLOCK_SIZE - 1) / FREE_BLOCK_SIZE;
+    int right = flashfsSize / FREE_BLOCK_SIZE;
+    int mid;
+    int result = right;
+    int i;
+    
+# 685 "./src/main/io/flashfs.c" 3 4
+   _Bool 
+# 685 "./src/main/io/flashfs.c"
+        blockErased;
+
+    while (left < right) {
+        mid = (left + right) / 2;
+
+        if (flashReadBytes(mid * FREE_BLOCK_SIZE, testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+
+            break;
+        }
+
+
+        blockErased = 
+# 696 "./src/main/io/flashfs.c" 3 4
+                     1
+# 696 "./src/main/io/flashfs.c"
+                         ;
+        for (i = 0; i < FREE_BLOCK_TEST_SIZE_INTS; i++) {
+            if (testBuffer.ints[i] != 0xFFFFFFFF) {
+                blockErased = 
+# 699 "./src/main/io/flashfs.c" 3 4
+                             0
+# 699 "./src/main/io/flashfs.c"
+                                  ;
+                break;
+            }
+        }
+
+        if (blockErased) {
+
+
+
+            result = mid;
+
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+
+    return result * FREE_BLOCK_SIZE;
+}
+
+
+
+
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+    return flashfsFindStartOfFreeSpace(0);
+}
+
+
+
+
+static 
+# 730 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 730 "./src/main/io/flashfs.c"
+           flashfsIsErasedAt(uint32_t address)
+{
+    static __attribute__ ((section(".dmaram_data"), aligned(32))) uint8_t testBuffer[FREE_BLOCK_TEST_SIZE_BYTES];
+
+    if (flashReadBytes(address, testBuffer, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+        return 
+# 735 "./src/main/io/flashfs.c" 3 4
+              0
+# 735 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    for (int i = 0; i < FREE_BLOCK_TEST_SIZE_BYTES; i++) {
+        if (testBuffer[i] != 0xFF) {
+            return 
+# 740 "./src/main/io/flashfs.c" 3 4
+                  0
+# 740 "./src/main/io/flashfs.c"
+                       ;
+        }
+    }
+
+    return 
+# 744 "./src/main/io/flashfs.c" 3 4
+          1
+# 744 "./src/main/io/flashfs.c"
+              ;
+}
+
+static uint32_t flashfsIndexSlotAddress(uint16_t slot)
+{
+
+    return flashfsSize + slot * flashGeometry->pageSize;
+}
+
+static 
+# 753 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 753 "./src/main/io/flashfs.c"
+           flashfsReadIndexRecord(uint16_t slot, flashfsIndexRecord_t *record)
+{
+    static __attribute__ ((section(".dmaram_data"), aligned(32))) flashfsIndexRecord_t readBuffer;
+
+    if (flashReadBytes(flashfsIndexSlotAddress(slot), (uint8_t *)&readBuffer, sizeof(readBuffer)) < (int)sizeof(readBuffer)) {
+        return 
+# 758 "./src/main/io/flashfs.c" 3 4
+              0
+# 758 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    *record = readBuffer;
+
+    return 
+# 763 "./src/main/io/flashfs.c" 3 4
+          1
+# 763 "./src/main/io/flashfs.c"
+              ;
+}
+
+static uint16_t flashfsIndexRecordCrc(const flashfsIndexRecord_t *record)
+{
+    return crc16_ccitt_update(0, &record->start, sizeof(record->start) + sizeof(record->end));
+}
+
+static 
+# 771 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 771 "./src/main/io/flashfs.c"
+           flashfsIndexRecordIsValid(const flashfsIndexRecord_t *record)
+{
+    return record->magic == 0x1D5F && record->crc == flashfsIndexRecordCrc(record)
+        && record->start <= record->end && record->end <= flashfsSize;
+}
+
+static 
+# 777 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 777 "./src/main/io/flashfs.c"
+           flashfsIndexIsUsable(void)
+{
+    return indexSlotCount > 0 && !indexDisabled;
+}
+
+
+
+
+
+
+static 
+# 787 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 787 "./src/main/io/flashfs.c"
+           flashfsLoadIndex(flashfsIndexRecord_t *lastRecord)
+{
+    flashfsIndexRecord_t record;
+    int left = 0;
+    int right = indexSlotCount;
+    int lastRecordSlot = -1;
+
+    indexNextSlot = 0;
+
+    if (!flashfsIndexIsUsable()) {
+        return 
+# 797 "./src/main/io/flashfs.c" 3 4
+              0
+# 797 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    while (left < right) {
+        const int mid = (left + right) / 2;
+
+        if (!flashfsReadIndexRecord(mid, &record)) {
+            indexDisabled = 
+# 804 "./src/main/io/flashfs.c" 3 4
+                           1
+# 804 "./src/main/io/flashfs.c"
+                               ;
+            return 
+# 805 "./src/main/io/flashfs.c" 3 4
+                  0
+# 805 "./src/main/io/flashfs.c"
+                       ;
+        }
+
+        if (record.magic == 0xFFFF) {
+            right = mid;
+        } else {
+
+            lastRecordSlot = mid;
+            *lastRecord = record;
+
+            left = mid + 1;
+        }
+    }
+
+    indexNextSlot = left;
+
+    if (indexNextSlot == 0) {
+        return 
+# 822 "./src/main/io/flashfs.c" 3 4
+              0
+# 822 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    if (lastRecordSlot != indexNextSlot - 1 && !flashfsReadIndexRecord(indexNextSlot - 1, lastRecord)) {
+        indexDisabled = 
+# 826 "./src/main/io/flashfs.c" 3 4
+                       1
+# 826 "./src/main/io/flashfs.c"
+                           ;
+        return 
+# 827 "./src/main/io/flashfs.c" 3 4
+              0
+# 827 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    if (lastRecord->magic != 0x1D5F) {
+
+        indexDisabled = 
+# 832 "./src/main/io/flashfs.c" 3 4
+                       1
+# 832 "./src/main/io/flashfs.c"
+                           ;
+        indexNextSlot = 0;
+        return 
+# 834 "./src/main/io/flashfs.c" 3 4
+              0
+# 834 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+
+    return flashfsIndexRecordIsValid(lastRecord);
+}
+
+
+
+
+
+
+static 
+# 846 "./src/main/io/flashfs.c" 3 4
+      _Bool 
+# 846 "./src/main/io/flashfs.c"
+           flashfsUpdateIndex(void)
+{
+    if (indexState == FLASHFS_INDEX_IDLE) {
+        return 
+# 849 "./src/main/io/flashfs.c" 3 4
+              1
+# 849 "./src/main/io/flashfs.c"
+                  ;
+    }
+
+    if (indexState == FLASHFS_INDEX_DRAIN) {
+
+        if (!flashfsFlushAsync(
+# 854 "./src/main/io/flashfs.c" 3 4
+                              1
+# 854 "./src/main/io/flashfs.c"
+                                  ) && !flashfsIsEOF()) {
+            return 
+# 855 "./src/main/io/flashfs.c" 3 4
+                  0
+# 855 "./src/main/io/flashfs.c"
+                       ;
+        }
+        if (!flashIsReady()) {
+            return 
+# 858 "./src/main/io/flashfs.c" 3 4
+                  0
+# 858 "./src/main/io/flashfs.c"
+                       ;
+        }
+        flashfsFinishLog();
+    }
+
+    if (!flashIsReady()) {
+        return 
+# 864 "./src/main/io/flashfs.c" 3 4
+              0
+# 864 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    switch (indexState) {
+    case FLASHFS_INDEX_ERASE:
+        flashEraseSector(flashfsIndexSlotAddress(0));
+        indexNextSlot = 0;
+        indexState = FLASHFS_INDEX_PROGRAM;
+        break;
+
+    case FLASHFS_INDEX_PROGRAM:
+        flashPageProgram(flashfsIndexSlotAddress(indexNextSlot), (const uint8_t *)&indexWriteBuffer, sizeof(indexWriteBuffer), 
+# 875 "./src/main/io/flashfs.c" 3 4
+                                                                                                                              ((void *)0)
+# 875 "./src/main/io/flashfs.c"
+                                                                                                                                  );
+        indexState = FLASHFS_INDEX_FLUSH;
+        break;
+
+    case FLASHFS_INDEX_FLUSH:
+        flashFlush();
+        indexNextSlot++;
+        indexState = FLASHFS_INDEX_IDLE;
+        break;
+
+    default:
+        break;
+    }
+
+    return indexState == FLASHFS_INDEX_IDLE;
+}
+
+
+
+
+
+static void flashfsAppendIndexRecord(uint32_t start, uint32_t end)
+{
+    if (!flashfsIndexIsUsable()) {
+        return;
+    }
+
+    indexWriteBuffer.magic = 0x1D5F;
+    indexWriteBuffer.start = start;
+    indexWriteBuffer.end = end;
+    indexWriteBuffer.crc = flashfsIndexRecordCrc(&indexWriteBuffer);
+
+    indexState = indexNextSlot >= indexSlotCount ? FLASHFS_INDEX_ERASE : FLASHFS_INDEX_PROGRAM;
+}
+
+
+
+
+
+int flashfsGetLogCount(void)
+{
+    return flashfsIndexIsUsable() ? indexNextSlot : 0;
+}
+
+
+
+
+
+
+
+# 924 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 924 "./src/main/io/flashfs.c"
+    flashfsGetLog(int index, uint32_t *start, uint32_t *end)
+{
+    flashfsIndexRecord_t record;
+
+    if (index < 0 || index >= flashfsGetLogCount()) {
+        return 
+# 929 "./src/main/io/flashfs.c" 3 4
+              0
+# 929 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+
+    flashfsFlushSync();
+
+    if (!flashfsReadIndexRecord(index, &record) || !flashfsIndexRecordIsValid(&record)) {
+        return 
+# 936 "./src/main/io/flashfs.c" 3 4
+              0
+# 936 "./src/main/io/flashfs.c"
+                   ;
+    }
+
+    *start = record.start;
+    *end = record.end;
+
+    return 
+# 942 "./src/main/io/flashfs.c" 3 4
+          1
+# 942 "./src/main/io/flashfs.c"
+              ;
+}
+
+
+
+
+
+static uint32_t flashfsNextWritableAddress(uint32_t address)
+{
+    switch(flashGeometry->flashType) {
+    case FLASH_TYPE_NOR:
+        break;
+
+    case FLASH_TYPE_NAND:
+        {
+            const uint32_t pageSize = flashGeometry->pageSize;
+            address = (address + pageSize - 1) & ~(pageSize - 1);
+        }
+        break;
+    }
+
+    return address;
+}
+
+
+
+
+static uint32_t flashfsFindTail(void)
+{
+    flashfsIndexRecord_t lastRecord;
+    uint32_t tail = 0;
+
+    if (flashfsLoadIndex(&lastRecord)) {
+        tail = flashfsNextWritableAddress(lastRecord.end);
+    } else if (!flashfsIndexIsUsable() || indexNextSlot > 0) {
+
+        return flashfsFindStartOfFreeSpace(0);
+    }
+
+    if (tail >= flashfsSize || flashfsIsErasedAt(tail)) {
+        return tail;
+    }
+
+
+
+
+
+    const uint32_t freeSpace = flashfsFindStartOfFreeSpace(tail);
+
+    if (indexNextSlot > 0) {
+        flashfsAppendIndexRecord(tail, freeSpace);
+
+
+        while (!flashfsUpdateIndex());
+    }
+
+    return freeSpace;
+}
+
+
+
+
+
+# 1004 "./src/main/io/flashfs.c" 3 4
+_Bool 
+# 1004 "./src/main/io/flashfs.c"
+    flashfsIsEOF(void)
+{
+    return tailAddress >= flashfsSize;
+}
+
+
+
+
+
+static void flashfsFinishLog(void)
+{
+    switch(flashGeometry->flashType) {
+    case FLASH_TYPE_NOR:
+        break;
+
+    case FLASH_TYPE_NAND:
+        flashFlush();
+        break;
+    }
+
+    indexState = FLASHFS_INDEX_IDLE;
+    if (tailAddress > logStartAddress) {
+        flashfsAppendIndexRecord(logStartAddress, tailAddress);
+    }
+
+    flashfsSetTailAddress(flashfsNextWritableAddress(tailAddress));
+
+    logStartAddress = tailAddress;
+}
+
+
+
+
+
+void flashfsClose(void)
+{
+    if (indexState != FLASHFS_INDEX_DRAIN) {
+
+
+        while (!flashfsUpdateIndex());
+
+        flashfsFlushAsync(
+# 1045 "./src/main/io/flashfs.c" 3 4
+                         1
+# 1045 "./src/main/io/flashfs.c"
+                             );
+        indexState = FLASHFS_INDEX_DRAIN;
+    }
+}
+
+
+
+
+void flashfsInit(void)
+{
+    flashfsSize = 0;
+
+    flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS);
+    flashGeometry = flashGetGeometry();
+
+    if (flashGeometry->pageSize > 0) {
+
+        pageBufferSize = __extension__ ({ __typeof__ (flashGeometry->pageSize) _a = (flashGeometry->pageSize); __typeof__ (256) _b = (256); _a < _b ? _a : _b; });
+        writeBufferSize = pageBufferSize * 2;
+        flashfsClearBuffer();
+    }
+
+    if (!flashPartition) {
+        return;
+    }
+
+    flashfsSize = (flashPartition->endSector + 1 - flashPartition->startSector) * flashGeometry->sectorSize;
+
+    indexSlotCount = 0;
+    indexDisabled = 
+# 1074 "./src/main/io/flashfs.c" 3 4
+                   0
+# 1074 "./src/main/io/flashfs.c"
+                        ;
+    indexState = FLASHFS_INDEX_IDLE;
+    if ((flashPartition->endSector + 1 - flashPartition->startSector) >= 8 && flashGeometry->pageSize > 0) {
+        flashfsSize -= flashGeometry->sectorSize;
+        indexSlotCount = flashGeometry->sectorSize / flashGeometry->pageSize;
+    }
+
+
+    flashfsSeekAbs(flashfsFindTail());
+
+    logStartAddress = tailAddress;
+}
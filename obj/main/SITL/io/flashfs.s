@@ -0,0 +1,1892 @@
+	.file	"flashfs.c"
+	.section	.gnu.lto_.profile.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`D\004\r\025"
+	.string	"$\0328\005"
+	.string	"9"
+	.string	"\301\310\336\203\007\022\002"
+	.string	"\001\002\002\002\001\352\263\360\321\b\003\250\371\243\366\016\005\247\233\236\341\016\036\003\004\001\004\006\240\342\234\212\n\007\b\253\365\353\267\001\016\t\264\237\217\317\016\n\310\322\325\364\016\n\002\001\002\005"
+	.string	""
+	.string	"\013\f\344\375\304\211\005\004\006\002\006\r\016\325\357\364\363\b\n\002\007\002\007\002\001\002\b\t\002\t\002\n\002\n\017\020\021\253\216\253:\032\001\002\n\001\002\t\002\n\002\n\022\023\024\025\301\364\313\325\n\002\002\013\002\f\026\027\315\236\237\324\003\n\002"
+	.string	"\001\001\r\002\r\030\031\032\370\212\210\340\002\004\033\307\346\200\306\t\026\016\002\b"
+	.string	"\002"
+	.string	"\034\035\203\237\360'\004\036\300\227\252\227\004\032\r\002\r\r\002\r\037\263\337\275\376\006(\017\002\017\002\001\002\020"
+	.string	""
+	.string	"\002"
+	.string	" !\263\347\330\206\n\b\"\342\201\222\246\004\002#\354\206\342\366\006$\351\254\272\306%\212\214\312\302\003&\244\330\341\305\f\021\022\002\022\002\021\002\021'\270\217\332\340\r\022\002\002\002(\207\221\364\216\006\006"
+	.string	"\002"
+	.string	")\271\276\221h*\321\364\355\362\013\n+\341\246\251\224\006\b,\365\370\202\323\006\024\001\n\002\n-\345\317\201\363\f\f.\354\263\203\222\001"
+	.string	"/\256\212\317\272\004\0020\206\372\271\311\002\n1\263\240\307\317\0132\343\336\262$\026\013\002\023"
+	.string	"\002"
+	.string	"3\323\320\256\246\n.4\336\331\342\370\n5\211\271\337\250\002"
+	.string	"6\322\371\324\257\003\0027\314\376\236\250\005\n\002\n8\372\365\325\307"
+	.string	"\002"
+	.string	"9\326\340\251\310\r:\241\372\346\252\n(\020"
+	.string	"\002"
+	.string	""
+	.ascii	"}\250\221%A\210\030\0341(LkP\0022cV\335\022\200s*\030\b\022\221"
+	.ascii	"\024\226\264\262\377\031\240\fo\202iY\313\367\322\301j\026\232"
+	.ascii	"VR\255\r\362M\212&\211_\3640/H\002\252\341\ff`4G\350Pd+/\324"
+	.ascii	"\333j&\0072,\345\275GVg\027\026H\372\235\211R\f\253\250Qo]\302"
+	.ascii	"lb\231\3232\325\366\007\200\235=\032\211\330\026\223,\300\220"
+	.ascii	"\221\037\0323\235H\032\271\033\326\001\317\233\215\365\005\206"
+	.ascii	"D\350L\247:s\305\023h\371\232\024D\2770j\345\034r\224\215E\236"
+	.ascii	"\361\005\034\031\035?\205\203@~\303\341Q\013\304\276 YN\341\261"
+	.ascii	"\265\321\020l\031c\261\242r\032$\241\312\244\340`\177\2309\220"
+	.ascii	" qi\232&U8a3\374\2760\3522\267\026\240f\315\342A\376(`\302\242"
+	.ascii	"\346\005|\037l\334\214\251\215\261\314\305\360\277\321tiwSq\217"
+	.ascii	"d\257V\215D\261\273\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\031\001e\007"
+	.ascii	"2\211\032\0350U\322\001\221\202\202\202\202\202\002\2653\253"
+	.ascii	"\252bE$\253LeZ\273%\020\211\3342\005\277\251\324I\317\273#QH"
+	.ascii	"\360]A$\373x8;\034n4\031\f/\355\357\357\304g\027\313\313,_\261"
+	.ascii	"(\223.\351\221\016\351\017:n\360\316\350\013\256\340\037\231"
+	.ascii	"x\036\202\207\273\206\366\b\337\212-)\352\253\213\327\300\205"
+	.ascii	"\257\025@n}\203D\250\220V\321$\323\032P\202\201\252\352\006\020"
+	.ascii	"\2006\342d\030\003K\021\2215\334\177\027\205\242\205Q\355\343"
+	.ascii	"\b\227\265o\251\034\215\026\034]\274(\037\303P+\332T\017\363"
+	.ascii	"h\254`\001\232\336lf\027j'U\004\312\203\343\315Q\274\205+[\306"
+	.ascii	"Em\323\233}\340#\320\006\366`U\206\fV\241u\003i\246 a\376\372"
+	.ascii	"\372*?\210\260B\316,\241\035\312+\312\263B\3707v\213\354.\335"
+	.ascii	"q4\240\003"
+	.text
+	.section	.gnu.lto_.inline.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\214\bu#"
+	.string	"\246\356\250I\200\332Q:[;\375\225\363D\226\200~\372{\320\214\310\224a\r\255'\211\331 }zu\227q\332+\204K\245\332\343\304tW\373\317\310-\345\262y\224lCBQWII\337@\352\2234\n\327V\023a\267I\220F\266\334)\205"
+	.string	"\223"
+	.string	"\235"
+	.ascii	"|\363\346\007\036\343\245\013\013w\323w6}g\323\303\265q\265\246"
+	.ascii	"\355q\017\262Uw\323\316\270\363\007{\342G\377\323p\027\300\326"
+	.ascii	"\036\261;.\361\377^\300b;\234;F:\355v\310QR]\310\354^;p=p\315"
+	.ascii	"1\203\327\252\273h\373\211\\\303\210t\332\031\361\013&\312\024"
+	.ascii	";G\205\305\224\t\215\226\034?\376-\221\225\314\226R~N\343s\220"
+	.ascii	"\273\273\317\177x\327\356\346\361\377\035\266\267\267\303\233"
+	.ascii	"\354\356\334\377;\200\016ev\200\311P\265\344k\005\321\007\330"
+	.ascii	"\2336\206\340\325\335A\3575*\344,\335\215s\240\232\225\202\332"
+	.ascii	"\362\"\024U\026\246\212\367\037\341=v\027q\374'U\252\224\351"
+	.ascii	"}\354\217\335\255\343\257<I\347o\304\272\313\025\326\303L\356"
+	.ascii	";{\3161\377\333e!F\245\304\371C\\\243\024\025Z\033D\\\252\037"
+	.ascii	"b\262\212n\271!7\331\260\362\244\343!\336%#\262)\367\364\277"
+	.ascii	"\277M\315\007\315#\236\272*\322\370\335\243;5\343\250\324\373"
+	.ascii	"\355?p\265\2777\377\324d\2501\"\311-\212nD&\216\234:\3046\266"
+	.ascii	"\350\021\267\023\225\245\356\350\321\340U\262\276\351\322\035"
+	.ascii	"wv6\005V\353a\313H\367\232\267#8\306\030\021\260\005\027\n\336"
+	.ascii	"%\220%\212\364\313I\226Rz\005\277\275B\222\034\305zD>\273\341"
+	.ascii	"\025\203\367\337\220[<\201\221\354\035w\020\367\251\313ii\026"
+	.ascii	"\333\224q\255\251\312\026\211U\271\004\207Se\244_\345\0332\035"
+	.ascii	"@O \344\232\220\356\266\251\b\212\030\221M*\037\215\021\331\244"
+	.ascii	"\363\003A 8x\rt\001\243\373ev\203\215/\304\275b\244\230\334\235"
+	.ascii	"\200\265\361\224\017\"Cy\324\300O[].\030\374\302O\006\265\265"
+	.ascii	"\005\347\026\356Y\001E\317\250\207\013\026\005\306\222\205\234"
+	.ascii	"\265D\r\016\225\304\377!\333\303#~\315\260\230\256x7\n\235\374"
+	.ascii	"\004\253\242\233\017[\376\322\335\351%X\373\262\2603T&\330&5"
+	.ascii	"!Ks.5\302\rc\242\\r \245\\Zy\207\360\300\336\346\230\267:'\323"
+	.ascii	"Y%f\f\311;b\257+Sn|\252\203!g\220Z'\257@"
+	.string	"b\211\325\336\300\336\036\0310\217$+^*\215V\023\025@]`o\017\\O(/\264|``.Y\264\002\200\316\250Q1C\204\304\204\244 \005I\n\035P\242!Cf\346\001\022`DY\b:E\024\032\"!-HRi7\251\360I\021\311\376;\370|\313\231\272F\243\355\305\037\257\356\254\242\255\"w\3439\367N\020\367\343\2240\267\367\0042z\037\204&k\035\214Jx\373}\273c\202\315}}Z;\370\343\262TG{\214\2141E\262N\034SYq\3208\337d\023\350MPdv\332\351\004!R\251\300[\214\202QP\2651\2513\226h\253\t\337\360\312\\p\212]H/\344\013G\230\244\366\034\334\341\t!Bd3\364\2044\f.I7\355\367L\221\314\313N\340q~X\255-\"n\330\n\373\253\f\fU\016\360\276\f\312&H\253\034y-\004\210\254\256\201)\205\2647\342\340\023@\245\303\247\t*"
+	.ascii	"\364\236\276\325\265\264\250\226X0\242\217b\256\213/H\242mn\265"
+	.ascii	"m\t\333\t\267\232\353\217\244\217OP +4\302\260\017'\345\371\""
+	.ascii	"\224\211g\356\f/\t\004\227\261\216\n\320p\320n.\305\307x\321"
+	.ascii	"\305\020\"\215\030\030\326Mb\334(3\b\242\251\035Cm\225\202\305"
+	.ascii	"m\250\320\2378\026\351\257\177\204\253\216R!\376\345\205O3I\231"
+	.ascii	"\261et=\266\330\261\330K\251\r\250;\315e&\3642\335\f?\225\325"
+	.ascii	"\r+X\310\021\033\025N\374?K\021\342\350&\337\215\002\303&\b$"
+	.ascii	"\356\326Y\312\b\343\300\020v\334<\200;1\301a\362\223\366\327"
+	.ascii	"\325\303\254y\303\271\b\257\244\215\304\327_c\336\200\310EC\006"
+	.ascii	"\213g\034\004\250\262\327.e\200\023t\204OZ\210\317T\211\242\317"
+	.ascii	"[A\"\033\232\226)j\tB\003\"dpqb\0373VTp\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\363\005\275\022"
+	.string	"\326\030K; \217\222t\001@\200A.\200"
+	.string	"\021\335\234G0a"
+	.string	"0"
+	.string	"0"
+	.string	"\364=\005\001\be$L` Jj\036\330O\375a\366F\030\270\036q\227\332\340\022\022\003\332\377-\t\332D\312\0249"
+	.string	"@"
+	.string	":"
+	.string	",\327\320+X\2700'm\211\242\025\037\270Z\320\317\303\f\252G\024E\242\250\022\344yjXu\221\301\263\277ZgZ\207\3633\243\006\331\307z\251g!{\261z\211\274d\245\"\031d1\024A\343\025d\365\353\253&(\210A\221).e\372S\271\021\267b\234\264z\353B\202\037j\225%\001tHQ\013f\324\314\2502E\021\317\212\301\001A\036\215\"\214\336Ecc\203*d\210\232\004\b\376\315G\ry)\036D\002\364\254L%Y\220\244\0350\360\033\266_rG\206CI~\344E\276\300\023\b\371?\376\rMQ\205VB\232\236\276\307\017X"
+	.ascii	"\317l\225\253\f?\255\323\362@\250v\223\177\302K\370\022d\207"
+	.ascii	"e\262\236\235D\3709O\023\020\306\3642G\341\201e~B\225W\262\243"
+	.ascii	"\207\351\221\364NH&\007\2174x1\340\346_\240\340\200\201\2501"
+	.ascii	"E\306\224\210L\220$i\032\003P\002!\244\312\314\003\022\340\262"
+	.ascii	"1\206\303AT1\243\324\020IAY1\324\031\003\314F-X\223\340\335Z"
+	.ascii	"\354\004IL\356\341\034\233\344-\364`\240[\264\215u7\325M\303"
+	.ascii	"Z\377@:\346\230A$,\254\223\216\306mjy(=\bd\2167\321dn\345P\020"
+	.ascii	"\026mi\202\032\221\204t\217p\004\302p5\0073\346 \3345\313\344"
+	.ascii	"]\306\302\343oF\247\202\004\211\207\253}\324\237\027\004\236"
+	.ascii	"\306\365\034~hO\2358r\200Ua\372\252\220\021\025-\225\311\270"
+	.ascii	"$\301i_\034\331\n#\201?\274\223\226\027r&Hu\311p\231#\227\215"
+	.ascii	"\227{\036'<\336E\250x\363\210\004\303\253 \227Iv\252\331\n\202"
+	.ascii	"\264\350\202p\n\301.\255\344\007\270\372\265\306[\314\236D\375"
+	.ascii	"\003\362J\253\303\031?I\302\241\224]\355l\233\271\372O\215i\357"
+	.ascii	"\204K}!\200v$\3007\337\351\025b\037\204^!liV\027E\214W\356\352"
+	.ascii	":C\220T:\361\2550\207onT?w\2034\021\b)F\251\346UM\\\023"
+	.text
+	.section	.gnu.lto_.pureconst.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375 }E\003"
+	.string	"\322\007\031!PU\322\001ufV%%fn\250\253\252\252\252\252\r%=\224\364\240\324\007\t0\200\214\231\203\263\003\2674I\337\350\212\276\320\004\315\317\365\334\316\344\334\315\225ff.\346\323\345ZneR&u'Sr#\037\344{|\216W\3432^\213O\361JL\304<L\303-\\\302\325\340%\270\201\013\270F\231\231)"
+	.text
+	.section	.gnu.lto_.ipa_modref.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\256\004-\020"
+	.string	"\246T:0pk2\034\020\354\177\354\377\207t\365?:\375a\377\237&\030CE\204\347\372\326\3106uw\033\261\312_\373s0\243\211I\b\035\bYb\267\224)*"
+	.string	"-"
+	.string	","
+	.string	"cH\241N\216\030\261\354=\311\211\235=\347\225\266\277\004\222@\215\334\363R~aU^uZ\312-\235\221\362H\333\017O\037q\004\377\004\265(\352jR>i\033\370?\177\254r\253\224\224k:\247\362\251\220+\300Ly\246\r\370\263\367^\037%i\307\264"
+	.ascii	"\224\217\f\3538CBt\250\270\277\201\201\362\\\240\363\270\n.\232"
+	.ascii	"w:\251r\252\363u^mB\204\360U\017\276ON\333\f.\330\224o:\255v"
+	.ascii	"V\007{.\317\205\306%\355$M\233\305_A\361}\275M\374\022G<D\006"
+	.ascii	"\266q\363\270g\347j\234\3167V\3234\312\270\037\343(\205~\310"
+	.ascii	"\305\362\356\200\206\250\221\271\202J\206\n\352\2441P\0021\206"
+	.ascii	"\356\352\001\021 \2412\030\025\211H\\Hc\243DJ%\326\242\376\255"
+	.ascii	"\017\367\224\0358\022\034I\036\002\004}\tp\220\311\344\316i\244"
+	.ascii	"\320P`-\241c\215\267\266\371rB\2210\366S\213\241\2443\207\327"
+	.ascii	"|\245{\356\260<\360\b\214\311 \244\314@\251\314\227\020\312\335"
+	.ascii	"|h0|\223D\026\001=u\\\257\001l\210C\246\343\256[)19OW\275\305"
+	.ascii	"\207\367\254Vr\035\225\267\2008\3614\362\300\204!\2248\243\355"
+	.ascii	"\016\340\211U.\216\212I\230\3300\007'/\230\f\322Y\037\242~f="
+	.ascii	"8\357\027\3010d\363\325\321\327\340\306luF\001^m\300\257\004"
+	.ascii	"\327C\327Y+7\261\2704\323\004\237\263P\201\332\375\037\251@\243"
+	.ascii	"\223F\350I4j\013\230\rJ\027\\F6\332\027\344\265\366\223\\k<\002"
+	.ascii	"\250\033\b\265D8\311+\223\303/\024\260s \314\032[\3413\333\352"
+	.ascii	"}\r\337\365\004\037`\351\002\375\361\340\317\201\237-\375\351"
+	.ascii	"\\p\341\2013"
+	.text
+	.section	.gnu.lto_.lto.a75fb20cab7f10d5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashfsEraseCompletely.34.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\356\0055$"
+	.string	"j@4\016E\200j\321p\t\361\232t\rPG\333\322\375\307\226\342z}\2055\2061d\f\340\377\202b\366\004\365A\026\331\245KF3\264\2767\222\374\331\316\366\265\307\030'^B3D\026\022\263\304\372\361F\310\336{o)\223\f\320"
+	.string	"\276"
+	.string	"\326"
+	.string	"Y6\322\365K\032\364\215\201\255kU\203\233\273 \2759\364\332y\223?\340\274\261\352Wn\334\270\235u\346\306\356\217\247\312q\343\232\302%C\343\272\256\264\233\2739vi7\233\266\352n\235WA\255\307Z\323\204\265g]\327[#Y\031\253\237\311R\3644\313fu\317\203\313U\327\026p\367Y\211\372v4\271\204$X\030(NO,Cp$\b\344\251\326\313*QH\243\030\221 \220\243'\022\f\362\263\204\340\333#\004J6\301\241\001\231\330,\031\f\325\364\020\0026\22557E\276n\345\343\262T \225,c \313\227\244\307]2"
+	.ascii	"\003\223\347ZG\360\306)HY\333\321\344\367\251\263\016 \217\031"
+	.ascii	"\255\260\256\353\362\017\030\374\322\276\273gv\267\302\256\271"
+	.ascii	"\025\0272\204\327\273\037\330\245f\254\233\270\270\223\033\305"
+	.ascii	"\325\234\036'w\027\351ap\351\272\366\"\354\301\340X\221.\241"
+	.ascii	"\3212\252w\271\027\032\373%\333\302\005\377\347\342\274\371~"
+	.ascii	"\340clx|Z\342?\273U<n\342\356[\352\253\315\326\266\221]\243s"
+	.ascii	"}mE\317\372\326N^\242\224w\200\214W\200\311\033@\306;\224\362"
+	.ascii	"\002@y\205N\336 \223\027\b\345\245\241\274\263\223W\206\362\246"
+	.ascii	"(/z\362\236)\257\211\362\226(o\237\274l\362~\201\355k($\262\351"
+	.ascii	"\256\252u\307\237\261\025i\206\211:\327\237u\336\375\356\263"
+	.ascii	"\354\267,M\313\267\324s)\245;\247\264\013V\037\b\351\315\003"
+	.ascii	"\345\325^\353X\216\245>\277\215\263\326F\031\234\242\272\214"
+	.ascii	"\330\326\273\026.\020q\365A\366z\267\002z\250m\335d\230\240\360"
+	.ascii	"0|\216\006\022\002\344\004\350gy=\325z\250\277\345\246\232(;"
+	.ascii	"\335Zf|\3014\216\t\020\024\240\212:A\021\016\200\276\326oV~\244"
+	.ascii	"$@%\301\320\002\274\313\241\003\377\267B\\f\220e\017$\325)\324"
+	.ascii	"\264\240\026r\003F\305\212\2406@\315c\212O\263N\233\3266.LNd"
+	.ascii	"=\363\3605\262~\230\027\225\203\243\235v\021\035\246!\217\377"
+	.ascii	"\354\331h\277\311\317~x\03243@\344\316\233\247\231\237\311\211"
+	.ascii	"\030\301\377\2158o\232\3751^'\312\362\343\211\351\340ew\362\312"
+	.ascii	"\253\354[}\006\265\306I\f\214\327\273\235pL\323\244lb\203w3\224"
+	.ascii	"+6\001x\267\304\t\376\257;:\035.)E\212\243\240\032\270\02410"
+	.ascii	"$\345f \341t\264Ez\240S\301Bw\342\205\212[\256\305-F\213\023"
+	.ascii	"0nHI\272\333\003\002\233\223\201K\272\315\310\345\222n\264\252"
+	.ascii	"\245\267\221\3350\005\271\324\274=\237\357\305\270I\251\210*"
+	.ascii	"\305\024\303\205\n\361\\\346qO%\"Q\213E\336\226=awx\247\036W"
+	.ascii	"\311\221\r9\024\206-19\367}\356Ge\022\245>y2uV\"4*\235{\261'"
+	.ascii	"\2256\212*E\312y\363W\316E\037r\206G\341\303\276\317s=\352\224"
+	.ascii	"\003R\352\224:\205\365\273c\245\036\317\375\235\343Q\217\252"
+	.ascii	"\225\243\243\363\346\251\316G\037C\206\306\260Y\023\267\303/"
+	.ascii	"5j\331\017-\352Z\353\2505Q\007Q]\265\351q\022\fM\b\020D-\253"
+	.ascii	"3\240\377U,\327u]e\001{\250a$#\241bfH&\020\322\246 \031\016\260"
+	.ascii	"\002\021\251*\017\020h7S\223\016\362\236\032\306]\032\265\303"
+	.ascii	"\312\\ .\346\\\316cv\016\031\377\264\377\362`y\361\341:\003\213"
+	.ascii	"U\237\260\227\315\216ua\270\202\212_\316,69rM\262\030f\312-\016"
+	.ascii	"\373\305\243g\242\260\022VI\200\270\206\312B\341\205\030\227"
+	.ascii	"\333\2649\217o\331-\363\264\253Q\315\342t(\215\204|eW\310w;\017"
+	.ascii	"$\323\357:\250\020h\r\003\264\321(\300\316rTz\241\325\326\327"
+	.ascii	"\332R\245\221\360\230\025t&\013\365\004X\233$l\345\330\325\220"
+	.ascii	"y\034\226\206s\367\304\217a\230\202\324\373\341\346\022\331("
+	.ascii	"\260\\J\2315\205\b\"\356v;\221GS\233\277{5\220\335[\365\353\013"
+	.ascii	"\374\r\203\214!\222%\004\001\315\243\354c>\246\227c)\346\211"
+	.ascii	"\231\376X\211\341\242\321[\255K\212\223\030\300\371\272R5"
+	.text
+	.section	.gnu.lto_flashfsEraseRange.35.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\274\003m\031"
+	.string	"6\356\242I\260\230M:p[\336\006\362\026\"n(\037\313Mg\2523\336C\352\265\210\230\343@\311\357\3163\370"
+	.string	"\240\321B'aLVWu\b\027\272(\3749\335\277\214\007\326\211\353!C\372\303e=c\260\365\266[#\204l\"wJ\001\217"
+	.string	"\202"
+	.string	"\223"
+	.string	"'r\363#\026V\325jC\207\244V\\\003'\020O\r\\"
+	.string	"x\372\375\005\236\372\306\276r\334P}.\207\213\"Yj\255\343\n\271\325\353\365z\377pw8o.\206 \375v\336\3708\027\277P\347E\217G\351\371\371$l\221z\372\356\223\347f\233!\020\237\203\337]\201\221\323\316\315\347T\306\277\257\200\316\207 \352\206\025\326\2556\367S"
+	.string	"\324$\306\313-\347\023\020u\303\312s?\020\244\347g\316\260B\255\325s\347\006\343V\335\266\016\3336\366\316\b\257#\3351\256\343~\230/\335\255\037\375/\327\335\253+\335\252\235\026w:\234\323\340N\323\235\376vzwz\316\351\017h\321\210\232"
+	.ascii	"U\353\213\036\227\n\205>\3718\323\257\373\221~\245\177\311\376"
+	.ascii	"\021\277\311,&\026\273\334N\252V\\\207\033\361wf\351r9\035\007"
+	.ascii	"\361\364Oz\221\347\314Z\362\201A\311<\0035\230Z\023\"\372A\001"
+	.ascii	"\311<\021\247G\\\022*\222\252\265.8\365\003\343\2504\020O\375"
+	.ascii	"i\337(:7p\203\374\241\251+\337"
+	.string	"kaS=\326\265\252\3451ep\327\276\226C\321\224\r\350@\r\034\274o\301c\226@\215\251$'tc\350\242(zb{\372\326\005\263\337\226EP\273\255}\223\213.s_v7\005Q\317F\224#ah\213\324\276\0048\327C\022\225\332\334b[\366$%\304Zk\021\374\247\0253\221\207\n\360t\256\352\350NG\242\302\347a\023'\346wN\200\247\337\347\216@\nO\313O\213\331\263q8s\203x:x;\2748\354\2313\3352\001\263\031Y\302`\026f\001P\220\260X\006V)\243\325\220\033`1RU\2220R\003,F\002\200\305\310\245\2254\264\031u\215\203\331\007\0203\232\021\037FY\2101\026\202\306f\254)g\243\003\002\226\221 \313\221&\223\225#\013W_\241\305\346\210\033d\bL\300\231\335*\264\265\253\345Y\255jW\310\277Zk\rW;\263\337\375\002\221\221\223\r\2105e\326\026a3\277c"
+	.string	"N>Pj\213cq\303\225\331\311\263\005Y\255\270\024\313\2222T\002\356\233>&\2312d7\007\025J\250a4\243\214R\n\251\200D&\020\231\300\2056\220\002\031\2622\017\020XFC\324tpF\304\377\201\210\251\222~\031\227\207\327`\216\221\3162\322\325k"
+	.string	"\t\256\206A\350\237\263\240;\303s8\001<\344\036\344U\240\330:`\306\221I\036\2251J\324*\t\255\223Fo\325\332\206-m\220D\230\344\021&P\266'\322\317\026\202\233\013V\177\215q\253\207\036\236Z\323\364\263\001Q\236g\341\276\342\022I\372\225SJr\340 (\210$\202\267\300i\320\202\336\3401\n\374\376\275\017\221^"
+	.ascii	"\335\022\353\017"
+	.text
+	.section	.gnu.lto_flashfsIsReady.37.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\013\001\355\f"
+	.string	"\326XXB"
+	.string	"\2614\035\343`\362\202\222\227\\\023\377>\242\275\210'\022f&\214\330G\203\330\022CK\002>\244\240\2335\225\004\300C\321\334\n\205\005\357\322\377\377I\327\241/\204xU\177\225\341\006XH\310\336R\246\024G"
+	.string	"?"
+	.string	"K"
+	.string	"\235\013\350-.RL\324\354v\226\266<\273\004\237f\346O\0371Dq\343<\227:v\227B\302\r\013\177\0257!\365\025\030\305\310\340\340P^"
+	.string	"\220\207\355/O\025N\313\234>v\327\271q\025\356\351\266/\333\004\354;\b\027>\031\355NK\r\331\327\030c\264\262\330NS/=iZ\323\257"
+	.string	"\214f\026\264\330\005E\032+\003S|\260}\037\346\"\223\213\260\252\230Q\263\273\325\241mbW\207\267O\354\312\b\022\2348{7+\232zT\201\314\013\020PCW\026\240\023\033^&]\223\003\t*\355\221K\217aES\317\357b3B\241&\221&\375\313\005\304\334\314\300XA\203\2226\366\273\217 \361;\030+\311o\207~\211t8\351E\317\020\032F\031`\002\016\361\300D\032` \017D\254\213cA\340\200\214X!\035\314\362\030\340+\002\203\216%\341\272:V\325}\256,\316g\340\t\017\\U\3056\245\035\037\325\254J\351Sj|2n\274\335]IC%\236\2524\234+\277\245>\027"
+	.ascii	"@\b\230P\315\233*p\030\005\020\253\030\306\314Lk\250*\243\365"
+	.ascii	"\n\020\214\203\325\023v\271\017\026\3422\216\334\271\20227\\"
+	.ascii	"\277\234\213W$\200@\300\030U\r\244\352\230P"
+	.text
+	.section	.gnu.lto_flashfsIsSupported.38.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\222L.3Pm\323\001\204\263E\301\202*Dh\330\204\025(h\033\345\362\312\252\276\251\267\257\331F\023\2235\022p8\t\231\031\313ju9q\214\272\n\264\276\033\2212\245\266(\355R\320\252\205\353A\3545`\025\303\2632\355Q\002\206\016\t\331{\2000{S\334+Gu\340\242\030\373\233tU}\306\003\363\214kl\276\205!(\371\356\221O\221\036]\001$.\371\261\243%\225\302>\264\312\261\235\326L\037\n\360\204\034|\354j>%\013\022u\\\330\276\355\212=\271\300\240b\356\261B\363\216'\303A\262\033\237v\316=9\377\030\207F6D\272\215\3459A\330]g\267\211\270\365\004\266'\002\t"
+	.ascii	"2\001#8c\216#D\250@\\\023?\206 \341.K\263\341]\367\006"
+	.text
+	.section	.gnu.lto_flashfsGetSize.39.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375 \361\225\006"
+	.string	"B\214-2`m\322\001@\203"
+	.string	"'t\206\331\351Sk\360\256*\002\316E\272X!\232\265\326\303!\356\227\325\021e \311\212C\024\331\276\224S\306\356Y\357\275\245L)\316\\$\215\202\204Y\320\270\267q\r\033\f\203\313D\222\273\024\3709$D\356\341\275\310U\342^A\251\226\217F\330\017y\204\376\206!8\371\351\314\347\264\263\324"
+	.string	"\213OVv\364\244b\330_\253 \333\351T\201\212\023\204\320\356D\225\262&\254\204\303v\307\256\370\036\377\350\030\256\250A\265P%!\202\262\033\235\345\004\355l}\240\235i\306\341\023\372\007\371\352\030!\231(\317\023\340`w\235\023Eq\353\rl_\004\t"
+	.ascii	"2\003\316:#f\b\3055\2216\004\216\031{\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_flashfsGetWriteBufferSize.41.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"m\007"
+	.string	"\202\01633`m\322\001\303m\021\304\250\237\313\232\300\020\203\354\207\322T\220\203'\235v\333\206>\006B\334\223\337\021e \t\203C\024Q\321(\247\214\335\263\336{K\231R\316H\225F\241\302,h\340\264\201\r\033\f\003\314P\025\224\n<9$P\360a\232(h\211\373\266*rz\371(\310\252Nz\252\352#*@\231\371\232\372\320\312?\036+_\303\020\234\374u\347s\336\3355\200\342\223\231\035=\251\027\366\333\252\310v\332iZ5\235\231\376\0230IA\b\331\225\310T\026\305\225l\330\356\330\026\237\343\035\035[-f`o\304\"\0042\332\215\360r\202w\327>\360\356\024\343\326\323\362\357\3616\"9\2710\317\023\340`w\235\0276q\353\rl\213\004\013"
+	.ascii	"2\241\231\037\270b\002\262\223X\204\272\3175\234y\210\0273\314"
+	.ascii	"pW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_flashfsGetWriteBufferFreeSpace.42.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\022\002}\021"
+	.string	"\226`qF\360\220*\035;\26457m[e\275\222\037\215\250\377\003\255\264#\354\322\004vy\252{\340z\206\030d\253\325\357f\303\323T\304g\027\202#n*\233\320M\202'2\210\036\360\277\220\265\266m\333V\026\255m\271\245\224)^"
+	.string	"T"
+	.string	"a"
+	.ascii	"#\277\247"
+	.string	"\275?\311\357];\250\007\222\277b\230\002J\230\225\231\213\2149\303/\245(\251\035\325$\2659\203\276\264#\357\353\372A\373\026\203\202\006F\320V\016031\344eG\003-(G\002\266\024\025B`ID\321`p\2419]\0230\266\27310\347\374\322\300\tz\251\377\021\374\027\360\257,\347\223_\356O\2757\365\276\024\367$\271\037\311\275\250\367\241\336\203z\377\351\275\027\367\036\271\357\364\236\323\373M\334\313\336w\334\307\3579\356\027U\212As`fN\t\273\032\223E\233\330p\305iND[^ E\344W\020\032\216h\313Y\247be\316\351i\377\001\22272r\2719\344e7\253Q\r4\033\013f\224\310\313\tr+J\226\306\257#4\246#\245*W\260Z\311N\r\367\302`Ys\032@'\202\245f\342\223JKlb\225\331b\273;\211K\254\263\032u\321\020\037W\225\263@Vi R\233\304\032\352"
+	.string	"\335\t\226\032lw\177\030[F\3715\3169g\347P\271<\026\2706\032x|\254\325\347`\265\361\361q\264\\\237\n\300Y\017:Z\037\004\026\253\365y!L\343\344\223o\013\n\266(\352\274"
+	.ascii	"k\270\303#6\371\317\234\202q\354#>1\263\354\026\353\020\213@"
+	.ascii	"\374\341\020\210[\306\343\022\177<\354\315xx\243#1\243\206\333"
+	.ascii	"\0220h.D\016w6\334\314a\225\335\002+ p\002\231\252c\007\020\024"
+	.ascii	"\272Q\342\250\323a\224I\346\310b\241\272\215>m\240\004G.ah\211"
+	.ascii	"!w\2439_\226\3556\374\303kL8\270p\305\234-\314\262t\212\253v"
+	.ascii	"\005\371l[X\267\024\332-\030\221c\20751H\247\266\3022k\214i\036"
+	.ascii	"\017(@!r\352\310\005\021\316\350\026\372\314\370%\334\030\232"
+	.ascii	"v\355\001"
+	.text
+	.section	.gnu.lto_flashfsWriteCallback.46.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\364\001\265\020"
+	.string	"V\337lF\360\260(\035\262\377\346\032\235(\246\207g\307\372A\230\242eM\315x#\326\366h\227\272\215'\034r\377\261klc\"\323(\363\321\273f\204}\274\006\235\201\345\003\331\344\244\213\356/\233)\205\353I\371-\331D\312\224\002V"
+	.string	"Q"
+	.string	"_"
+	.string	"O\373/\207I=\346\304\334\256\207\232\025\273!\002\033"
+	.ascii	"=\216>`{\324.`{t\312\256\361\020\304\036\005\354\302Lgw=\375"
+	.ascii	"\360\3245\315\224\377\001\2219\307j\241\\\333p\005\320Zi\243"
+	.ascii	"\335\375\354\211\241\005f~@v\327\311ji\270\343m'\260}\300N\013"
+	.ascii	"\001\331c\207`\352\212}mw\327\252b\307\264(\246\273\230\016\305"
+	.ascii	"4\027\323\240\230\376\304\364\366\230_\323\322\251\245\037\340"
+	.ascii	".1\235\033\013nv3\364\360\354\214\330\"\204?\363Y\311C\307\033"
+	.ascii	"\234"
+	.string	"\022\373$.3yh\0056\"v\267{\264M\354\3561;\333\001\352\240\204\214U\356\260\357\342/BFL\276i{\f)\347b\301i\234\341\331q\201T\305Y8>\272)\250\346) \214\316b\222\357\333\036?\312\271d\233~\366\002+\035 \r\232\036\251'.{\3028\344\274`:hzM}\312\013<\315M\234\370,\246\200\312\263P\333\3435\266\304^0.U#'\222\272\364\201\022y\200\"E\020\361>\223'\301D\"\361J'\224\367A\300\337\204\220\223W\341\373N^\027\252\256\255\2528\272\304vl\250\024\364\317`\363a<F\203\321YL*\225\266\307\313<a-9\257\227\0342M\204\023\322NE\372\224\030h\323i\234\3411\302%\313\335EQ]qH\271) p\202\231Q\325\rcB\177J\214.\r\243\245\263Z%\226*\355 \260\016\251\2271-x\034\330\214\220Yb\326\304\272o6^o"
+	.string	"6]\303,\206\260{\266\257\273\213\363X;\221.Z\331\213\373\304\020\003S\027f\303bLT\024\272`\202\320H\203"
+	.ascii	"\242\021\373\025`\223W,\240nk\261\036"
+	.text
+	.section	.gnu.lto_flashfsWriteBuffers.47.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\342\005\365#"
+	.string	"v>\337I\200\030R:\243(\n\202\317\242\344i\232\236\0346\312\311&\343R\315\257\023\r\340\020V\201dx\277\210G\333/*p\224J\3128\211\267\037\237\346\t\237':r,\334\261\314t\204\333\271l\340\323x\027\372\277\344\023B\344N2\315"
+	.string	"\300"
+	.string	"\312"
+	.string	"b\226\334\313L\300\006\326\247\314\\\357\343_M<D\231\\J\334\215\037G\"i\3672\201\277\373\324\247\350{\352\323\246\301(w\017\237\303\333\341\334\330\350r\270\233\316\352\263\251)\332=;\344\023\237#\344\305\213\215\363jh\331\235\215\343d\2602\366\225F\206\n\255\337\240\007\262\252P\371\262\314\bs\033\257\344\213,\253{\021\3539\254\343n\226l\321tao:\\]v\245\272\017\265=M\345\270W\362\n\025R;+3K\342\2606\253\2537\312cN\teS\024hK+\315\215\362\t\375Qq\036Ov\033\245\204\262(NI\365^W\274g\226d\201\376\356\2757r\002^\311\033\326\332\034\334{\331\"\225*\316"
+	.ascii	"\316\374\024\314\234\201\031-\023h1\320\264\200q\262j\314L\243"
+	.ascii	"\355%\363u;\324pqo1\257\226\177\253e \324\362Oj\331\347f\271"
+	.ascii	"\007\265, \265\314\363\261\363\316\301~\337\231\277\316\207\374"
+	.ascii	"\275\233\345\335\213\374:\266l[-\253\251\345N-\277\300\311\234"
+	.ascii	"id6\240\271w\352\251\346:\3232\035\037;YZ\325\205\307\275W\311"
+	.ascii	"\233&\266\2041\301G\362$\3149\026\376\bw\325\030\036B\346\334"
+	.ascii	"\323fn\342\033\341\0343\217\rWbr\025C\022\344\354^f\320S\246"
+	.ascii	"\260.`\320\364\"Kg\016x\261\344+J\004\324~\b;Aw\327iF\217%\367"
+	.ascii	"\336\004\334\240\301\230\002\354\256S\330\025\320Z\346\003y\220"
+	.ascii	"\2463Q\234w\357V\304\265\264\365\252"
+	.string	"\313\330\256\227_wpI\341\364\222\231\005\225\363\246\227\335\026H\343\304\370\270in\323K\2669\004\177\023\027\364\237\037\236\331\031\242\016\205b\345\224\363i\372\264Q\t\f\334\223\367L\351\3517o\013\246\324T\321\351\255\267\005\303\035\202i\017g\332\231\261\211v\355\245\030\224\247\244\257\267\330\252\b~\262\017\211Y96\323\250\240\013\360\225\241\tA\357\275\327\326\313.\216\271Xj\331yp,\237\214(h\217\344\3513\201al\342\325b<\305\322^\376 \324][\265\260/or' \370]l$\302\036)B}\272k\035Yf\262~\\\025\355\263\377~>\237O\264\205\270\324\316\272\227\374\253WkT\275%U\3277r\036XGA%%\243\244!aP\211\351\203\216\350\210I\210*\035-!A\b\2360\272\220\023&\005\213\212\226>\330\230H\201\260(\204\320\303\210\" \222\021\360\310\310\003\t Q\222\020\250 "
+	.string	"#\225\b&\001\225\220\220\222\2009f\361\275\3056)\251c\223\2673!J\312\261\211\303\037\2526[\263\203b\033szi\231\037@\230b\34546\221\177\254\332\276\326i\346\b\022\354\221;\375\203j\"\367Z\355\224\310ZX\027\261\265\227\235\277\345\\&\374\336\305\025,XP\237\246Uk\322\314\200\331'\357\330\037\271\200a\275\267x$P3\017i\260G\262\205b\305\371\324\304\333\304\005\257\227\374k 4B\320\264`q\262jY6\374\372\366+\3072\344\300\304\244>\005\352'\271\201~\250q0D\031332\022\210\314LA\322b\220\002\0211\273\016\020H\251\206&i\f\177P\336\250\3435$\207p#\324\222k\222\371\205\266H\201?\312p\361\346\377\001\335\237O0\016\b\3339\311\253l\004\b\333"
+	.ascii	"c\020\021=\366\361\370%\370\371\235\224\231\224ut\235>w\217\301"
+	.ascii	"~&\332\030R\361Y3E\276\224\177\033\b\n~67(\214Hc\214\240\317"
+	.ascii	"\003\353/\376\024\034\213\323|\227\322@\302|\003J\206\r\332\244"
+	.ascii	"\322\340\362\210\220\363\307\365\362\233\201\026\263\231\372"
+	.ascii	"\rCb\262\236$Nm\337\346\212\025\0205\307\254x\260\024\2110\350"
+	.ascii	"\205nz`\272`\013\\\227\350\023\361\311\027\206f\r\202\016!\""
+	.ascii	"\326\336\227J\213\001;O\330\b\315\355\203\362\364G\021\227j "
+	.ascii	"\334\003\352]\315\201wk8\266\343\030\216\232\342\2667\256\350"
+	.ascii	"h \323(DJY\300\002\377\372]z`\335UB\350\327x\236\032"
+	.text
+	.section	.gnu.lto_flashfsGetDirtyDataBuffers.48.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\002\004-\032"
+	.string	"\246o\246H\260\226Q:4\":\234@\3204i\342\025\343"
+	.string	"D\251\213Jk-\024\007\267\216\340\355\266\366&\327cL\016\253\345z\253\354\036\354%\372!N\341\017\366\207m\316?\324g\302\361\216\360\f\006\374h7n\374\204\354\275\245\224)\222"
+	.string	"\200"
+	.string	"\226"
+	.string	"Cp\2534boj5\332\242\244\326\036\203;\350\205\013\243\033\344g\355\374\201p\347\377\357\217\005\202\373\235d\017i\007\246(\322\371\256j\255\261\235\325\241;\345\302\350\316\246\261\270\rA:e3\356[bC0\005S\227\030,x\013J"
+	.string	"9\\ Y*+x\022\001\023U\216\326.\210\251k\247\223;\265V!\236\233\343\255\344\251\n#\356\206\266e\202\"\250!\327\316\204\324\231\222\241e\177\313'v@\314 \204Z\353Y\334\261\330\263\366?\212\377\021~y \275\2722\271-\262F4\354l\3229\324x\305\032\335\271\275\277E\300\303\211\017\236\022\217\177\257\004\367\321\277=\216\343\3706\372\327\267;`\225v\003P~\016\310\207\201|\034\312\277\241\374W\363m(\337\325\374\232\346\323\200\374\031\312gQ~\330|\220\362i\363g\363\345\344\267\344s\363\327"
+	.string	"\001\242)\332X\253\212\221L\225\232Ll\374\307\375\255\377\314_\">\021\002^5h\211\350A\270\374\025\262\275\r \217'1\274\004\314\024\214\331G\313/\274D\031\222}\364\n\364\033%A\241'W_f\372+EB\005"
+	.string	"\"|\242\025\253g\302\246\315\352\025\272\001v\030\005\224M{\211\252\256\350\312\344\266\206X$\325}\364\331\262/,M\t\3421Pf\263xJO\366\311\3027\351=2\031\335){\376\234\304\360\2344Y\022\362T5\211-\272\277M< \\HI\337\021t'\373D\253\034\217\347\376\"\241\351 \325\232[\361{d\231f\337\244\235\307@\243\365\n\351"
+	.ascii	"\342\361\333\034\267Y\b\332\204\326\3156\363\361\001q\001\224"
+	.ascii	"\315~n;\030l=\341e\rn>\031n=\033|b5Z\254\003\255\207CLf\273\305"
+	.ascii	"\032\bx\355gf\213}\250\325l\261V\257\256\254m\364\305\3614\205"
+	.ascii	"\362\336\211z\200\222\004T\260\373\333\351D%\027lN\237\370\237"
+	.ascii	"\323\207\220k Yk\255a\224\225\0369\363W\345\352\013(\265\260"
+	.ascii	".\260#\313\022\026X\177\243V\264\312\301\372'K\223\256\f\316"
+	.ascii	"M\343\274\332\32576\375\242\262\251iW\025\n\262\232n\315\200"
+	.ascii	"\362\301C\032\303E\t\245i\331$\226\240\250\320tO\250q@\343\214"
+	.ascii	"4C4\243\240\240\240 \2059\240\"\231\033\273\001\020XG\264\005"
+	.ascii	"\325\032\267\177an\022=i(\364\334\217\325#Y3\371Hs\326\327\213"
+	.ascii	"Q\307\230O'\345\242\310\2472\345\374.F\267\232Z\214\262\2366"
+	.ascii	"\212\210\327\242\312\315\006\304\265\225s\247~\025Ht\243\320"
+	.ascii	"\334\003f\343\363\321'\304\372\240(\207w  =r\030f8\224n\337="
+	.ascii	"\325\204UHF:J\002\225\254\225\313@\266_\213\232K.\270\234\332"
+	.ascii	"\243,U\262\242\334\243\202\334sx\312\037\336m7|a\025DCig\246"
+	.ascii	"\360\361\333\017\034q\210\206\212?"
+	.text
+	.section	.gnu.lto_flashfsGetDirtyPageBuffers.49.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\313\002\305\026"
+	.string	"\246\252\225J\260\022R:r\301j\225\343\332[\2501:\216A\372af77\364\216\2768`q/\222f\036\275\231N\006U\353\274\260\332\270.\213\275m\357\3777\266\r\177g\224\326\035\365/\212QO\230\236\240\331k}Fm\244\021B\344N)~"
+	.string	"y"
+	.string	"\177"
+	.string	"\224\3720\222lNb\025\210\344\263b\236\372.N\374\013\337\2170\\VkP\026T\255\304\004V@4?+\337\302\206\235t\001\363\244m\337\350+|\266\324H\034\032\2766L\345$\375\250\265\322PnR\236\034?+On\211\373N\216K}\376\315\311\025\255\342\330\222U%\034\202\370\216\007~p|"
+	.ascii	"0\004\216&W@:\276t\2523\374Q\372b\251\265\232\n\207;wy\333\021"
+	.ascii	"l?\260W@\3241\222z\344N\367\371\247[\304\244\206\275x\233O\372"
+	.ascii	"\313\037\375\344\213\232\226\324/\031\320\343*\006\253\326\016"
+	.ascii	"]B\252\025\031\205\342N\377\323_\374\332\267\317\344\3138\224"
+	.ascii	"\317\247\036\n0V\201@:P-\346I\247\336\353N\275\006 \247,\036"
+	.ascii	"\265\022\035\2301\336d\237\2569\223aJZE\265\326\263\306>OR\333"
+	.ascii	"\347/\371\364\213\026\314\033\017fq\007\025\217Z+\202\223f`:"
+	.ascii	"?!\374\261\332\025\362l\2776\244* \r\262\353\231\265\326\023"
+	.ascii	"\235\200\322\326\017\253\311\207dc;\333\245\n\246\370\321.\307"
+	.ascii	"V\266$\373`\324\317\306o\364j6"
+	.string	"6\345I\331\246\344\350\201ml\2373\304\247\361\0327\237\310\270\027z\341Ky\022\266o:5\"1\364\303\242\007\207v\371\244\345\222kO\210\241\027\232\373\245_D\b#\253\f{c\023\177t\205\354\217u\203\354\222zVR\223\224\324\26225\027js\24142=\335\202\\\317f\362p\027` \234\274\035.\227\353\331^7\334\f\017\345eW3}S\341\345$\360j\024r4\035\fM\006\246\026C\273\355x4\225\023\353fp;\032\215N\267\243\235D\234\217u\203\\\241\212\303h\222T*6\345tu\326,8\373#G\266dh\351\3471\261\";\2624\251\340\326w\266\347\032\340\022\331C\275\001O\226\017\035\037:\203\353j\304\270B\357\225\376\324\370\nr\025m\3156\300\320+\270\005$5 0B\202\264\342\r7\007^\f\375\r>Fq\342d(1\367\216l\330*p\253\207\376\2209Q`\322\211\226"
+	.string	"2\006\217\214x2\024\270.#Nk\303t\303\263B'\002\b\333\235\r\re\35446\203?\033\320\331\302N\371\2615T\267\n\234\254m\307X\"k\343hPQ&\032Z]\030--,\232"
+	.string	"\020X\367\232"
+	.ascii	"\215\250\f\315\213\214\275\211\373&\036,\370O\007z\340u\321\b"
+	.ascii	"\001\n"
+	.text
+	.section	.gnu.lto_flashfsGetOffset.51.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\n\001%\r"
+	.string	"\026YZC \217\223\016\240\267\257@\210Hm\023\330\215\3673G\346\220\205:'Q~EXnZ\377\201\310Q\377\206\366\227ecP\313\005\255U\363Y\200 \b\f \3055_\023\220\220\004F\020wlD\332\336R\246\024F"
+	.string	"D"
+	.string	"G"
+	.ascii	"#\315H\252\004fw\224\340\321\b\256G\177\227?\342$>\356\340wB"
+	.ascii	"\312\2448\214\240Z\354~X"
+	.string	"\306\005d\036\341\003d\036\025\304\273g\347\037\365(\302E\214G\002=-\b\273\353\364H\035n\275\355\003\266\035\330/\005\037(\365\203}\270jb;m\3014\204i\205\351\204\351c\024XY\221!f\227d\365b_\242*\345\337\177z\332\037\337t\2247>\313M|~\002\371\212F\032\227\024\222\005\327\343\027\300W^\342\363/\344\002\005!\005P\031\240\250R\257\252\027\225Bw\371\211\316\017\341\316G\336{\364?2\217\251\004PJlk\334\324]\273\333\340\252I\221RQ\211\344\312\232|\313M\232\006\213\267\034u\301\300\211gs\236\274\347T\241\362\262AAv\334\306\3112O\207\305q4t\"l\234,\363tl\354\261\301e\0228\216\t\031\246u\260\n\035\016\n\230\307\306a\033\003\254Y\340l\030\006M\333\260\315\267\207\253&\226f\210h\310!\037\b\334\365\360\340\247\037\206%W\206\252jiD!*\005\027"
+	.ascii	"2\241]\037x\017\201\301`\312\314\030\206(\002i\250\002=T\f\350"
+	.ascii	"\f\362\272\355n,s\r\017\261\005\304\2318@X\200\n\334\033T\353"
+	.ascii	"\240\235R\022\206\273bj'\031"
+	.text
+	.section	.gnu.lto_flashfsFlushAsync.52.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`U\004\265\035"
+	.string	"\026\266\277J\240\326Q:\304\333h#\236g\374,\210r\362H\204b\224f[\034\204\310\340fx\002\211\033\232n\213\244u{[\006W\234X\335\251P\2402\266D\277\300[\200\313\361c\\\005\370\024\371\310+T.\223\261oI,!D\356\224\002\254"
+	.string	"\235"
+	.string	"\262"
+	.string	" \354\331K\322\026a\317l\327\372 \256v\243W\260H\232\016\tX\300\371\322\266\r\034\020a\334\2073\234.\205\203iGX\232\016o+\343\270\317d\350\0313Kr+\316\227\365r\237\311H"
+	.string	"P.\264\234\212\267\202\3649\342\305\324\204\347\253\350u,~\276\tO\205\257\306b@Y\\M\275\0247cUE\"\024\255^\212\227\344\200\037\222'Zo\211\274a\002c\312\261^I\364FT\362T<\025\244O\232\246\264\236R]\322\200V\357\007\255\267#ajP\241\372\325\003P\361X\324\032\003J\323\324\265\251g\342~\271\355\036\266\177l2(\327z\225BQ\365\273\362\351\250G{\270\253\013\264\277\307\343\361\350\205r\017Z\315\203V\357\240\3256\264Z\007\255\256\235\3259h5N\255\276\251\3256\265\272\246V\323\234\3253\265Z\346\254\216A\253i\265\032\246V\277\234\325\263Z-;\253\321\263\372<\253c\017\376\246\253IW/"
+	.ascii	"\263\307\013\273\022bI\232:\035\271\244^e\020)\333\367\263\256"
+	.ascii	"\265\341B\353\b_\374\202\033x\274\230t\242\tDI\322q\254\017'"
+	.ascii	"\232'FX\207\013\375#\234\372\340\347\370\020\304\205\266\t\275"
+	.ascii	"~\3014Mg\001:\373\003\346\313\331\332\221\b9\373\342\005T=\271"
+	.ascii	"\341\323\331\210\335,\216\315\326\354\315~\351\267\263\331r\213"
+	.ascii	"fe\266ffi\214\314\304\254\f\021\tD1\033\303\362\241\305\247\033"
+	.ascii	"ADR4a\226\366\262\262\205\331/M\355\352\321\263}\331\017\231"
+	.ascii	"-z\256l=\36482u\321\325\243\261\234\200])\027ht\317\235@\\\242"
+	.ascii	"T\267\bA7\n\312\306\265f\360\260\"q\246\271k\314]\371\222\242"
+	.ascii	"T\267<u\225\250\262\013\364\271\261\375\325g\210Xr\306/0\245"
+	.ascii	"\272\305>\327\201\b\371Q\036\"\"2_\236\213\372t\367\361-\n>\217"
+	.ascii	"\262\221\205\372&\013\346\313\330\006DCHGE\245\207\n$\025UH\022"
+	.ascii	"\272Pt;2\272e0\022\302p\033"
+	.string	"BJ\272\025\250\371H\003\021\322\215\303\321\021\322m6\324\235\224\221\033\263U,\236\357\372\257\216\240JV\221\253\3768sw\r\244\333\035\231\332\252\235`A}\023\271\2739\250\247!9d\013\364\273\336\223%g\374\222\342u&\f|\036\345\006AA\346\313\236\375\360\265\205UX\345\232\002#E\027\370[\tZ\3218\027\350\372\344\304\317\304\331c]\001\230\023\023WI[\236%\301\263;4Dc\316\370\245\304\266\265\335\331M\2624U[\235\265\355\227\202\354\222\\\211\203\007\020 \230/\003T\250a\034\005\2213\f\031\032\231QX\220\246X\f\240\002\221\261\252\016\020H\253h\222\003\345 \206/\001\312\230\304\262>\243\353\n\265p\f\332\262a\212#\376\024A\246\331\267\241=>\230k8k\037\230@\033\372Hl\361A\275\016\265\b\206\216\364\373\321\001_\326*S+\362I\353\020\352\336x\320\210\306.\f\302\261\\\322"
+	.ascii	"\367bm\315@8\300\274v\347\200\221P\352F\227(\242\255\004e\354"
+	.ascii	"\200\315\225\204\016\205\371\036v\310\216\027`p\035\2717\b\016"
+	.ascii	"\024`:\236Wlha\032\346\0056\334\335\227\371\243v\245\314!\t\340"
+	.ascii	"_\b\357\317\214\235\020\021\213:\241Q\003"
+	.text
+	.section	.gnu.lto_flashfsFlushSync.53.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`l\004\265\036"
+	.string	"\266\267\307L\220\326U:"
+	.string	"p&w\246\003\372A&\177\274\244\202\025\027h\374\340<\321\b<\373\247\257\361\225\212\016\004|\362\242\266\271_\300q\364\261\026/FW4\b<q\205\3579\002\t"
+	.string	"`\372\267In4Z\240\350\fl \215\020\262w\222\001\256"
+	.string	"\247"
+	.string	"\266"
+	.string	"\355\241\372\311\263Q\376\213*H\245\257\234s\202\247\215`}j\3407\352S\3645\352\323n\273\273\\\351\224s\220HDRa9g\033\316\321\266\255\366,m\317\322f\265U\246\312\244(\276m\237F\004\236M:\3159\254\301\374\205A\f\336\331\207\220^3\256\350\203%)4\336\374\216sXDO\005\007\2273\277\023dX\343\312\210\232\2772\210-\256\212s\231\035&\243\244\247hO\362I\307\235C%\024/\231[,\321\305E\233\267\360\024b\021\022\217\216\317|\205\247Py$\f\223\021\322\257,B\316\271\257\220h\364\006\360\356\253\335\235\353\306_\002\307ne\360\276"
+	.string	"\224\374\242qS7\355\366\r\355\266\315\354v\215\3546\315z{\346P\357\332\255\3364\331\355+\273}\034\234q\206\f\342\213\266r\2361&&w\245Y?n\365C\375\313\177\352h\367\373Yo\322\373U\347hA\35119V\212_5\207\242\326\251\372\315f\255~E]H\036_9+'\254)\272_\365%\335l\2538U;(:y\3129\263O\273Ut\263O\361\221<\352\314f\225\\\252\375\024\213"
+	.ascii	"\331\231\2174\004\231\324\263>}\016\240|\222\366K\241a\030\322"
+	.ascii	"\370\225\363p\301\372\264\225k\377\310\223\001\277z\224\207\036"
+	.ascii	"\247_\235\371\301\346%\354\006\021\342^X\303\267\313\t\246\313"
+	.ascii	"\005\006\022\240\221|\222\341c\037H\255\001\202=\265\364\243"
+	.ascii	"\234K\204\201\367\350\021\267{\341M}Z\203\217\365k$\022\266\224"
+	.ascii	",.\357\030\232s\316*>\366\217\253\224\232\264dZh\371\031\013"
+	.ascii	"4g&\b\237\372\231G\263\212[E\276\226wL"
+	.string	"\247\251\004\226\342c?\217Sg\260S\f\0367\300\236SZ\\\261\246\3013X\006\206h\314\320\035k\032>\246\301o\362\nA\214^B\230S@\202w\354\370R9\271\360s\313\262\nm\231\333]Bw/\244\3417o\203\345\334\352\nb \003'\327\016\214\003m\202\247wB\347\373\331\202v@@;\234N/\203\217w\363\365d=Y\357g\205\256\003\357'\227\373\221`}A\277\235O\356Gbm\034O/g\242w;\221\263\355t\266 \335\r\310\206\343\365l<9\275C\361\303\263\371v;\236\215U\016=\302\020\016\276\210=p\273[#m\362^\330\270\310yD\303\307\033l\203\2151vx=K\213\244\337\243%\370\370\250Oo\360\254\330\267\362+\024,\\\270\240>\265\301_\362\373\343h\310R\262\330\300I\314\313L\007K\fK\r7aP/~\027\001W\301kx]5l\270\027^,d\203\b\003?"
+	.ascii	"\351\343\311\212\217\235\3405\214\223Hy\211\312\202s\003R\250"
+	.ascii	"1\034\206\031\005\231#2\301\00423\233b\016\200\002\031\262\353"
+	.ascii	"\006\020X\251h\2321\301(\337?\215\226\351\263\025\032\003\t#"
+	.ascii	"\310\025\036\347]\004\177\321\3150^l#\344\b1v\243\255\320n\203"
+	.ascii	"f\tb\214\020\366\211\311\024\322\306\033\006r\312\365q\353\264"
+	.ascii	"`\207\006\245C\343\201\302\257\020\213\r{J\367\246\234WPoQ\343"
+	.ascii	"%\245\2318\245\037m\350K#\300\212\253\305\345\032\030\213\n\352"
+	.ascii	"Q\213\333#\n\002P\350w\345\0249\206e\236\272d,\350$\335+\007"
+	.ascii	"&\323\"N\"\bB\200q\321]\322\267\227\301\352Y\332\333\314F\\&"
+	.ascii	"\267\205\031aO\226\300:\375\003"
+	.text
+	.section	.gnu.lto_flashfsSeekAbs.54.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"U\t"
+	.string	"\266RC;0\305*\035"
+	.string	">\277\246\213K\b+\354\340\337\222Em\251\004]\251\253#{\303\311E\f\330\206\261\013\3479\222\235\215k\305PP@HA\354\377\325\306\312Sa\026vp\243\275S\n0"
+	.string	"2"
+	.string	"1"
+	.string	"\006/\330>/'\330>\375\331\263\207\037\253\021Q\231x\321v\227J\217\177\217\237\377\3263 \252\364\030\240\260\273\216 \312\342\226\267}`{c\233\026*\324)Pv+j\001V6SB\374\223\273F\017-\2001+\331]\356\323\036\331\334\3479\333\217\366M\276\372\316\"9\263\313\301\212\355\206\033#`>\003W\031\242\306\203\237~\335>\357z\004\271`\331Xi\230b\3153\332\021\022\361\240\023VFd'Y\262\303S\224\035\366/\273\273\226)\373\254_\316\001\222\242O\355:o\263\207S\273\205\332a\350\250\007\242\016\240N\003\365\204*\345h\354=|BT\344y!\312\205\246_V\246\374\3261\260\214\030\200\026\223<YJ\377u\030\311\001\t"
+	.ascii	"2\241\371/P\301\205s\227!M\305\033T\bbu\032\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_flashfsWriteByte.55.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\347\003\315\032"
+	.string	"\266\360\252H\260\326M:4\256x\275\301s&S\236\347R\212\347\304\016\357\342%\030\027\267\314\354\003$\321\266\333A\224Y\374\350?\301/\271"
+	.string	"\307C\232s\276\347\376\340\377\331i\001a\275q\351\314\3617\036\035|x\263\rB\b\2212\245\226"
+	.string	"\205"
+	.string	"\231"
+	.string	"\243\255d\313>\252\314\266\252\255`\301\322\251Jx\347\004Zq\315)D`\0022\037\275dg\271\220\306\254MY\341\375\b\233s\342v\306\227\036\223)\311Q\\]\362K!\001PYL\217\275\t\3522b\001\260#^\016\345\tJ\2449\331\350\275\352\001r<\375\264,\205r\b\331\352\371Z\234,uhaM\031\342k\361Q,"
+	.ascii	"d\302b\346\333\211\264\257\030X~uBE\026\337\231\317\204x\233"
+	.ascii	"s\276\352\212\302\247S-\205\346\234\326\236O\305\r\340\266\203"
+	.ascii	"\266\r\330\242,\037\2771&-/`\325\257I\207\266P\247\033\264/\316"
+	.ascii	"\215\262K\365\255T\007\225j\240R\375S\252m\244\332\247T\367\250"
+	.ascii	"\232G\3255U\357\250Z\207T\323T\235S\252qT}\243j\033R]\243\352"
+	.ascii	"\031\251\246!\3253\247\372c\244zT\365\222j%\325\017\300\223\205"
+	.ascii	"\025%k\352\312N\021N\247a\230\3515v\335\260}\037\353Y!.4\002"
+	.ascii	"*!\354[\375J\351B\333d\204\001\251F\274\207\025\374\206;\346"
+	.ascii	"\234\262\007z\244\313\027\f\362fqlv\2667\373\035\016\235\016"
+	.ascii	"]\2636Kjfv\266\"\202\fycn\243\007\364\032iv&\311\225X\270]\312"
+	.ascii	"\027\206\206\310\2174\033\373\371\320\241\221\314\354\257\376"
+	.ascii	"\250\035\300\027\342\006}DvM\370\211\t\343\242sN\246\335\240"
+	.ascii	"\307\325\305\200\365\304\204\202\341\"\312\215;\341'\206\307"
+	.ascii	"/\266\266I\334H\t\035*sN\006>\221\027)\362\245>Z\203\221\021"
+	.ascii	"\371q@\r\027\273{\336\030\335!\357i\371\217\310\257\356w@\335"
+	.ascii	"\201\\\353\310\227r\207\234\276\227#\003E \2240\210&J"
+	.string	"\220\224aC\322\020\207\f\270\234\021\316\203\321P\007\034\021R\022.A\315\271\017EH8\020\271\034\022N&l\27287\312\r\246\236\276\2005\255.VS\373\001\004}\317\257\272\220n\231h\200\001\343\222\331\240U\312\n \331\343\240\212\023ok\304\331\333\242\270m\320\376RX]m\211\322\004hm\033\264\333d\207\303\266?\013\264\337u\351\274\376\025A\002\005\n\344\307\237=P\345\347\2636'\025r>\373\254\023\320!\205G\311\263=\265\335Y\236\332\216Et6gwh\253\303\2046n\316\222\020\262\305\033\023M\250A(%\025B\b)\232\t&L\220D\255\001\240\002\021\2612\307\020Xh\212R8\006\323\311\202|\023\213\204w\317\230\244Z\215\244\fT{\326\220C5?0\350\334\355%C\262\325\301@\036U*B\370\204\0020z\036y,\246t\235\0216\343l\315\035lg\267c\310H\254\204\342\234\345\271"
+	.ascii	"\265\027\251\306\301\n\263\224\377FH\007\030\027\021U\030\023"
+	.ascii	"\\\373\004\247 \n\365\231*b\221`;9\254&\264\336\207\360\222\310"
+	.ascii	"\273\335\030hF\001\274r\035\333'\302\344\245#\025\224*\337\373"
+	.ascii	",\201\034\325\221\372\2352C\255P\271\255\0335"
+	.text
+	.section	.gnu.lto_flashfsWrite.56.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\354\fMA"
+	.string	"Jt4\03170\350\312pt{\357K\025\263D\363\317\001\275#4\301t8\233\340\321\224g\313h{\275;\221E\304\205\003\252\256\353\343~\360\352]\221;\2420\232\035\204\020\262\245L2\213\001W\001\216\001\\P"
+	.string	"\327\347\224 \227\303?\305u\005\214\241\ftAG\356g\307\022\217\354\252\205\377\263\253n\222\373\331\002b\024\325N\270\375,\354\313\373[\327UM\262\253\376\230<\236\3539t\325=\347\303|\2375\253\025q\375\035\033?.)\224?~\265\372\0252\017\033\235\242\037^t]\351:\354\016\356\240\257u\353\2438\362\353\022]\327U\354\307\255\260\233\362\256\204\n\314\333i\262\365O\321\277B\020\030\360u\230\017\004[\251u\375b\311\201\362G\256\364\274\373\277\313a~\316\223\007X\3270{\374\254+\340\330~)\177\\\300g!\177T\376\n\371\3432w/\035po\335\362\273\203\273\243\270\256+Y\217\331-f^k@\026\326\225\200"
+	.string	"[V\313**uJJ\231D\036\323f\346^\301\335\250f\244=\317\266k\245\371\2005th8+\r\364\fc]\361]\200\231?e8@\232|\233CsD:2i\331b\024\320\241M\336B\326\275\271\325\336\227iX\364\217\247#\322\355\245Ysh\342\362\270j"
+	.ascii	"\231;\252\245\244\271L_\352\272\\=\"\035\336!.<\265\345R[\022"
+	.ascii	"\254\241\273ce\202/uvO\"\322\331\245\\\206p\214\\\243\2470\356"
+	.ascii	"\231\345\307$\033<\202\221\366<\263<M\303\362\020]Y>\337\322"
+	.ascii	",F`*\035\321Y\356\t\205\373\320\227h\264%\361\017\324\227\272"
+	.ascii	"7\347\344\207u]\227\343\236u_\002\337}\233\335\345\261\253B\003"
+	.ascii	"\220z\354\371\326\307\031?\356\f\371\243X\037\321\231/\314\233"
+	.ascii	"<9vn\334\330x\f\337\236\335z\273\200M~\331\336bt;\314.\363\356"
+	.ascii	"`^\035\314\233\203y"
+	.string	"q0\357\r\225\327\006\363\326Hyi\244\2743R^\031)\257\231\312\033#\345\205\241\362\276`^\027)o\213\224\227\205\312\273\"\345U\241\362\246PyQ0\357\t\3465\221\362\226HyI\244\274#R^\021*o\b\346\005\221\362~Hy=\250\274\035R^\016*\357\006\225W\003\363f`^\f)oY\312{!\345\265\220\362VPy)\244\274\023T^\t\314\033!\345\205\220\362\222\251\274\017R\3361\225\327\201\312+\306\274a\314\333\200y\301\230\367\313\253k\212\227\353\210_\004\314{\340\207_\003*o\201\333\371\267>\370\325z\340\217\3659\377\325\t}\001,\253R^*\225WUy\247\252x\245>\347\253|\3407I\305\213Ly\217)o\232\362\262\312{\036B8\315Uy\376\316p]\347\032E\255\207G@i\216\370\037\376\204\376\301?\317\337\347\310\3357*2\307\306oN\224\321\252\207`Vn^\326"
+	.ascii	"W\366\374\376\242:\024\025\332\367\335%BTh\223\231\240\211\207"
+	.ascii	"\f\025\332\fw\226\336\234po\270*\241\"\001T\037\032\204\207\346"
+	.ascii	"\320\037:\264\007\206\353\240\2419\250\033Z\003\277mhj\350\037"
+	.ascii	"Z\266W'\301t\301\343\354\353\352\244 ^\243\223Msj\337\003\271"
+	.ascii	"\177\304+\222;H\212\234\334\244Zo\265\006\335\\Jru\226\323\r"
+	.ascii	"!\362@\003P\373\335u\b\375\004\023\251\315\3708MnS\2556\361\026"
+	.ascii	"\3011\036`dW\265T\357\2220\301\217\333\t^\234\335\266\373PhX"
+	.ascii	"{q\273\313\344\213(\272\022\327u-S<(\025{\276\037\227\205\013"
+	.ascii	"\027\310\037\245\232\357\304e\001\320\310\022`\360\n\341\030"
+	.ascii	"\225\b\372@s\265\330(\004\375F7q\350nQ3\322`_\263\021\245\300"
+	.ascii	"<\311\326[~d%\357\210\241\205\2449\270\3024Bgh\271\f\035\326"
+	.ascii	"7\374\202:\320O\202\212\f\364\262\017t\331\035'\247c\033h\260"
+	.ascii	"Ais\037\373\316\276\364\315\236\336g\364\324\220\032h4ON\203"
+	.ascii	"\376\352\260\356D\316\276\257\006\353\006}'\240\346\246s*\002"
+	.ascii	"\303\314\f\371#X;\220dW\240\2772\315(\320W\364/6\217\340 \313"
+	.ascii	"\032\303\205\266\320e}g^\363B\037\241\025zB[\240\320\0250Q\220"
+	.ascii	"\320\023,\3258\223\320I;}@\3311\337\242Jd\216\020:\002Y\2175"
+	.ascii	"\204\276\263\257\311\215\373\240\311\372p\214n\334H\351\201X"
+	.ascii	"\2175\223<\215p\214\337\362\311.1m=\007-\326?\004\027A\341\305"
+	.ascii	"\335'^\322\r\256\363m\216\035;\220?:h)\273@n\334\375\243\007"
+	.ascii	"?z\360\220%B\322\320V\244\261)\221ZK\256\2419!b\246\004-H\020"
+	.ascii	"\266\037\352\222465\021A\330~(\317\322\232\254\245ihF\332\307"
+	.ascii	"\022\037@\322={\260\026d\310\232\017#A\310\324\210\220\245\021"
+	.ascii	"\361q\204\354L\311\032\331\203\255UC\202\246\204l\211\232\232"
+	.ascii	"\0222\025\320\355\035F\031\251\323\241[7\227-\317\037]K\327\365"
+	.ascii	"\213\207\367\371\243\201Z\r\230\252\265z\254+\rS\r\027\\\267"
+	.ascii	"\355VSu\022L^#\034#\362\t\367\034\320z+v\255\356:\205q\004'1"
+	.ascii	"\340\023^\017\263\315\206\275\023\036\312tC\226\310\204\303\214"
+	.ascii	"\303\217\323z\026\247\034?\240\242o\335"
+	.string	"&`\317\342_\326U\215\376\037\001.zG\313\355h\035l7%T[\216\276\321:n4\216\316\301w8l\364\r\326b\243/\b\213F\327\230\3212\232\306\f\263\206\3212b\264\031c\211\361\242a\260\225\027^X8)^\265h\027,ZE\267X\321,\370\271\002E\253\270\262\362\246( E\243\230KA\005E\377O\200\326\333e\254^\253d/[n\371\2527\265RvU\313-\030r\331\207\336\253\r\352Fp\322\237\256\353\272n-\275z9\030\247J\225W'[\216\227]\r\300\t\207\261\252\253\225\267J\300b\337e\322\001q\303\277\312`\234>PQ(\335\226%\215\247+K*\023\375C*\210>\321r':\214\361\246x\252\263\251Q\"(\274XU\242M\364\341\030I\364\210.A\242\217P\021\315=\"D\213`)!\002\003\200\372\250a,%\021S\204\206DDD\222$I\007\300\002\221\241*n\021"
+	.string	"9\350\240\021:i\016\311I\225\275\034:\341Gd\221\324\2207\034\227NMb\263Z\021\317Z\363;\342\353.\360\360AtT\222\\\247E\00265.\373\313\230P7\200\213x\267\271\340\251\r\274\235]\277\252t\344\210\272O\031c\314\001!x\332\275\343\301\t\255\n\240\221\272x\030n\324uM\\\365A-_\224g\346\271\t\007\210+\363\311\275i\250N\354\326\036\243\326&O\206\020\226\346\265L\372eM\206\261\030\\LA\365\312V\351\314a\310\016?\226\007\034\373\300\206\234<\332\376:\320\244k\023\205_\3775\310\034{\231\024\3525\210\026kv\322z\271\366t(\220|JOQ\354W\211"
+	.string	"\321\202\004"
+	.string	"\313\211\251\320b\260\220l\026\331\035\254\212\017k\022\231\2601\212\277\002\262\025"
+	.string	"C\336nu\307\260>\035\205\323Q\b\001b\246\306\270{\026\366\361\230\363em\265yt\373\374\201-\"y\261\302\304x\224\367\270\216`!\222g\177\016\\d1\311Z\022\326j~\236;YdD\271;\267!r\205\317\013N,<R\262\316\222Btq\230\236\022$\310\370\231\271\320\""
+	.string	"\007.\216\fC\320\364q%\\/i\206\017\366q \334`\254I &\373,\317\201\303S\264\36275\305\030\324\033\322p"
+	.string	"\237o"
+	.ascii	"\017\364$z\\\021iQ:\332.#\334\311/nPJ\314\215_\001Si\030\205"
+	.ascii	"\251\367\246g\202\032b\214\317\3344H\rF/m\377\306\374\203\336"
+	.ascii	"q\344\025\234;\274\300\237\t\257o\355\261\304\005\354\203J\357"
+	.ascii	"\263\372o\b\203\237\244_\342\357s@&\232d\260^B\372\230\031\321"
+	.ascii	"\236\016\020\230\302\222E\005"
+	.text
+	.section	.gnu.lto_flashfsReadAbs.57.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`r\0015\017"
+	.string	"v\236iE\360\222(\035\260\352\303\330\261\300\241\226\013\346\230\327\027\311\024\352J\036\032\\\t\017:k<\027_\253\345/zEM\270V\032Mq\363>\033?\f\003\237czW\005\303q\3525K\313Z\255C\312\032idK\231RU"
+	.string	"S"
+	.string	"U"
+	.string	"\366\354\212\240\201\261\0336\360\202\3165\333>\212\247(\3314b\350\002\017\314p\320\300\242\307\356v G\300\271\026o\200sMG\274\364\250Y\362\267\221\b\247\230\230\n4=~\270\016"
+	.ascii	"Q\021dw\037{\256\300S\3466\262\273N\025\370rk\267-\3016\004\373"
+	.ascii	"6\002>\354\346n\363{"
+	.string	"\266\277~\3555\177\374\353VM\247\246\037@@\214\fxW\215]\0177?V\246\311(q\330o\227\374\2309\3330\323\370\276\3547\344\230Y\355\330]\006\327\374@_!\221\300\242X\035\034dx\025\245\333dx\201\335\026\216.\354\370\371\032\226\232-f4\262\224\232\334I\373\302\227W9dvBvRS\214\232\272\351\306\"\021K\231\310\3355\251\3028\365\nZq\003\225>\354\273\370\013\026_\306*+y\3255\177\205s-5\201\016\020-ycM\243^\001\260\\<R!Nyc\207\246T\030\373q\265\345\241\2177\341\363R0\200<(\236\211\222<\221H\005\304\371>\217\024\n}6\223\210|\"\n\337\307D\324\215J:\224\222\317IGB\372:\021\005\036Y\360H]\312hD\352\270p\257-?\366\273\300f\270\350\246\216\251\251\352\3126\247\227\315b\310Z\364d.U=\032\325\256p\222Wq\001\030"
+	.ascii	"\013\013\bu1\216\033V\bm\351\t\317\037\267\240\0139\241e\nd\f"
+	.ascii	"\036P{\"%\234\306\270J(\f\206\001\025\002\b\017\2065\025\002"
+	.ascii	"w\215\320\306\370\351\fRX\026Un\273\212\036"
+	.text
+	.section	.gnu.lto_flashfsFindStartOfFreeSpace.59.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`6\005-\""
+	.string	"\306}\331K\220\026R:\301\367\214\037\303ceb\2344@\271\364\b\037\356\007\013\253\017\336\377<\200\361\026\013r[\036[\357\373\1776 +\263~dC\017&]\002@$\030\343Z\214\013w\025"
+	.string	"\242\202\037\nK\343\327\276\375o\215\220-w\222\001\311"
+	.string	"\270"
+	.string	"\304"
+	.ascii	"7\353\332&\247%TR\367^\007\t\026\004\275\t\204cl^\026i\223\323"
+	.ascii	"\031U\201\243|\240\276\252\310\267{\231\242\b\271\267y\200\t"
+	.ascii	"\330\216~\352TA\\\274\220B\350h@\324S\322\007\332\275\315\037"
+	.ascii	"\316a\322\243\366/\351\321\206ao\233\347\224q]|\016w\263\325"
+	.ascii	"R\324\352\272\026\371\033\226\272\216fZF\306\347\306\212\226"
+	.ascii	"\216\025\227\036-\177\023\300t\244t\333XQ\222\305\201*R\2525"
+	.ascii	"\253+\273\261\344\031%\255\002%\256\262\241\232\332@:\3123J\261"
+	.ascii	"\365\2524JVkC\272\316B\340!%\343cE-l[\375\b;T\321R\355o\335\002"
+	.ascii	"\231\023\032\025\026\246\243\345kM\302\275\227+\221\321\321y"
+	.ascii	"wfFc\346\f\314v,\310\264{]H\221?\203K\f\353\211\216\362\207\215"
+	.ascii	"b\371\004KR\355\227~\220d\232P}r\356\f\226\276k\243V\220i\275"
+	.ascii	"\347\213\251K\277\017\265|r4s\2728\326's\323X\233"
+	.string	"\311|\236\226+'\367\213\033\233\032\232\031\231\230;\317>\230\227W\375.o\236{\267:\363\216\225u\326]\353\234C+\343l\345\033Z\331f+\327\320\312)Z\031\265\225\255\255\334\266r\265\225\037\200\246\353\212\f+J\252\315\232\227\305s\313]\202~=\275\371[\375X\277\363\317\372\265\336\265\306\034\304\357\361\253\373\370\217\003\371\026\347\264\3040d\025\261\34042\001\213B\324\221\032\017\254\030\314\006i\257kV\214\031\251\220\325\232\311;#\350L\243D\272\002\347\265\322\362\372U\267\367\336\233\0328\257g\232\246\351\311\013Y\217*\226\206\240\315|>\237\317\027\323[\237\351\312\311P\315\362\341J\212\003b\334{\0330wx\022\0176Hn}3\206\235\271\340\361%\324J\\e6l3\371\347-W\232\324\320\365\013\356\331Zx\225d\250f\341^\005\360bz\256\213\351\360\316\356\025:\021\363\316\303BD8\273\3672"
+	.string	";\021 \177\306Q>\321\323\223\036\2555\363O\260\236\310\3268\3106r\332\265>\024"
+	.string	"\327\327i\273\034i\204!\241\216h\373\372P\220;t\235k\2649,\253|Hi\252\252\233\3310\017\362n\333\017D\236\035\037K\024\021\002(DA"
+	.ascii	"\177\232\350cb\270#L\201\007\2613\314\021V\350\321\t\372|\310"
+	.ascii	"\021\2059\304!\312:\b\206<\"\2069><\277 \3607\002\230\363\363"
+	.ascii	"\323\021\016\177\bb8HbG\370#\006\203\302_"
+	.string	"\256y\217\3335\333\336\265\314M\343\b\365\221q}\323\377\327e\032\327N\250\\39GM\357Zy\004\251\302\330\264\316\326$J,\351U_\232\355-\246sU\306\n\035L\250\220!\371\257\234\002\343\n\316\332v\375\255\037\t)\245\253\346\353\232V\262\265\351\032\306)%J\315\3276\255\374\326]l4\315\266\226\353\230V\362\315\3274\255a\211+\302\024T\222\rG\024Z\322+\375\201\322W\211\322\222\364\262g\362^+\031(g\250aD\203\020B\b\021\022\221@\212\024\030\322\001p\002\0212+z\020hW4Ic\207Y\250\203y1\262\277\316%g\345d]\263\311*\351\255cE\036\332m\030\222\001\362k\ti\314\020\343\2702\302\306\211@w\263*g\220F\257!\301\337m\304\261\263Uj\301\344\3315\365\344\255\020\t,\335\327\206\355\3302\016\034D\315r?!enmeL\252\216G8\f\306\033\036`"
+	.ascii	"\302\006\005p\277\221\027$\025H\333s\300W\2779@3\001\030\",k"
+	.ascii	"Q\220yB/qu\250`\220\222]\204\226\302\024>\006*}\026\216\211\343"
+	.ascii	"\3158$\033i\017\260`\013\255bA\037\3161::s@8!B\222\310n\213\216"
+	.ascii	"b\303\307\301\373\234i\031E\226\247\314\321\372>\372I\270\206"
+	.ascii	"\356\024\266\360\037"
+	.text
+	.section	.gnu.lto_flashfsIdentifyStartOfFreeSpace.60.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\262\314.3`m\322\001C\003\246\344 G\354\342\203\273K\205i% e\005%\235\326\210V\001B\334/\253#\312@\222\020.X\262}!\0045\004J\333\336[\312\224\002\316\\&M\302\204Q\320<\270y\f\033\314\302\313H\323\273\020\0306 H\317\001B\351Y\256\275~\230F\034\355\370\312\364\236\024N\206\354\322\177p6DD\276\272F\022J\331\027\225ja\237\255~\354L\263\247\337"
+	.string	"L4\254\203Fv'B(K\322B6lG\333\342w\334#\332\"\354\302\260\00482< '\273\373\242\017\2707\366"
+	.string	"\367\246\027\217\317\350\377\343\007\035PIeQ\317\212\301\356:+\213\342\326\027\330\256\b\t"
+	.ascii	"2\003\316:#l\b\3055Q:D\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_flashfsIsErasedAt.62.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\333\001\315\021"
+	.string	"\306\"zG\360,'\035\240(\232\321L\266;\\\375Z\027\272\332b\2115\303\330\355\326\360p}l\004\237l\371-\355\246&\255\266\274)T\326b\354\310}\240[\034\026\207\271\"\243\244\f\354\344\274\251\302\t\310\317\211\204\354\275\345N)i"
+	.string	"`"
+	.string	"f"
+	.ascii	"\027@?\021$`\261jc\302\352\b$\266\341e'\251\326\360\333\033g"
+	.ascii	"\\\206\367\214\252\323)\267\213*\177u*\227(\250\006\303\325\222"
+	.ascii	"\"\257\033\241\333\\\342\314\241\271\224\"3\r\0300\\,\2716\034"
+	.ascii	"\320m\353\321\274\223\005^!f0\\/R\203\350\202\321i\2171\256V"
+	.ascii	"\214\335H\255\325\021\306%s{\267-c\033\304\216\027\001\016Wq"
+	.ascii	"a?#N\314xm\354\327t~\352h\371\332\2753:\312\350Wp\030\335Ht\210"
+	.ascii	"qX\023a\255\320\304T\207\246O\206\327\276\366C\337V\363O\007"
+	.ascii	"+\254\256\356&\353\221%\325Z=>\375y\237\267Yl\013\3331\332\227"
+	.ascii	"}\306r\235\025W\324Z\223\353\2515<`\002\336g\3075\350\247\f\026"
+	.ascii	"\344\302\374\246\237h\\\324\255\210\025\227 \374\303\311\253"
+	.ascii	"\265\206x\210{\333\007\034\t\341\274f>-\261i\211\220fH\2730\377"
+	.ascii	"! Z%\272\265q\200\373\207~\025\334D\260\342\222\001\304\214\257"
+	.ascii	"\320\207\307\201^\255-\207\361w\316\243\342\343|:\0028}\220~"
+	.ascii	"\322\265\035\244\342a\276\247\375\024xR\f)\241h\355\312\001\247"
+	.ascii	"\247R'(\023\023\222\316%\037)\224\005)\222\024\224\017<}\fN$"
+	.ascii	"*_\t*\365}l\030lp\202\372\036\200 \352\263\b\353\327\306\022"
+	.ascii	"\342sO\211\005\341r\363W\321\323\3561\305h\270\334\372**\345"
+	.ascii	"z\244e]h\350\302|Q$\275\335\242\316\343\2731\031\273\327\271"
+	.ascii	"\254\265\326i\340\273\336r\334d@\255\227Kl\212\270\034\245  "
+	.ascii	"`\2021\205\354\233\005\3745:5\034\332k$\244\002\b\2419(\310\335"
+	.ascii	"\254\020\267\025Q82~r\334\301\005&\253\027\305\032\205\036} "
+	.ascii	">\256\320\230\3751\364\317\255\263\305\002\377f\333\272\250\023"
+	.ascii	"Q\004\247\312\032\334\002\3042\004\215\341@\001"
+	.text
+	.section	.gnu.lto_flashfsReadIndexRecord.65.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\373\001\325\022"
+	.string	"&%\202I\320\360(\035\3164\250C\003E\354\004%\343DH\347c\237\274\324\253\323]J\367Vr6}\205\225\007\205\200\276\246\367\313>\354\302\307\260\024\362\206o\323\205\227\030\200\037X\377\233\016\260\031L\"\311X^Gm2\b!R\246\024p"
+	.string	"c"
+	.string	"o"
+	.string	"!d\017\212\221\254\246\255\22730>4o\\\265\017\342@\262\357*8\234SC\222\321\234\274\003\0360>\\}D|\250\017 >t\002\231g$\026hp \370\241a3\364\233\223Wn\207\317\016\256\316|\232\203':N1\226H\340r\276 \001]R\216\nW\003G\2248\324x\357z\203\263\251~\240\3149\2557\\\206;\274m\005\266Ml\235\t?\035P.\334\357{\007}t\230zKD=h\372d\363j\272<\366\3019\347\364\356\330(\365\n\245\026A\251U\253\016YujT\223\037j\220\007\375\343w\177h\365\256ZW}"
+	.ascii	"\256\037\016\006\334w+\346\304yj\2320B\244\017\242\336\276?t"
+	.ascii	"\337\314\205l\242\303\364\233s\22236y\231M\332\006y\017\343\234"
+	.ascii	"\264\337|\244\243H\201\305b\342\303\325\332\013\030\350o\372"
+	.ascii	"\013>'#\0357j\226\306\"\253\332\325\276FW;\361\"\225\006,\375"
+	.ascii	"\215%>\024Y\001\036r!\253J\3557d\327\251\306\247\246O&7\265\267"
+	.ascii	"\351q\237[7\2612\316i;\361KH\200\340\367\304\210\017\311E\355"
+	.ascii	".\342#b\374\036\267\270\350o\017}\027\361!\310\336\367\002J."
+	.ascii	"\002\017^\256\326\312K\224q\275\300@\267J`,\021`\254\027\226"
+	.ascii	"\322\325R\302\264\260&\224\255\027\254,!\261\213\302\312\253"
+	.ascii	"\224q\271^%\311\243\035\234\273\343\227\037\036DE\373\317\304"
+	.ascii	"\367>6\375\330 *R\177&\356\336\330\3365\nmk \013$\230\024\235"
+	.ascii	"1\347|\317\036\275\220\241\003\312\351Q\016\245\r\273<&o\025"
+	.ascii	"\242\256\203^\013\233\356\360\210\246\256\"^\350)b\001  P\002"
+	.ascii	"1&m\007\305\320\2704\224%W4\032\334\333\256\260{\270(\344s\303"
+	.ascii	"\353E`\f\360Tc4\246\311\352j\206\367X\327\310\237q\\&X\\\235"
+	.ascii	"\3441\f\r\3721\201\240'\342\375\026\361\3417Nyo\330S:\017\231"
+	.ascii	"ZN\321e\366"
+	.text
+	.section	.gnu.lto_flashfsIndexRecordIsValid.67.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`9\002\025\023"
+	.string	"\006e\201H\300\322Q:\242(A\230\210b\204\251\311B\025\221\007\013\364)\357E?\361\035\2502\"T\006|4\024D\216\325\377I \231\2370gX\351\203\310\0046\271\256\2420\212\303x\017V&\260\311[^p\326\371\264F\366\2262\245p"
+	.string	"`"
+	.string	"q"
+	.string	"\267\2469{+6\300\272t\357%\340%\353\003\300K\333N\260"
+	.string	"\3079&;:=\020\020\365\330\222\250\346\354\271\226\304s\276\002e\\\315\361\t\350\226\246n8\235\257B\234M\301\2239'\217JV\210\307x@\204\223OI\016\235T\210\333\321\215\nv\250r#\270ZlU\331\236nt\355\301\321TW\020\346\234\326\033\356\303\315\272\355\231\355\025[9\004\227\376\rx\371m\311)\001\341\315\364g\367h\272;\373q\3169\275BvT\213\254\324-\253\303\363~"
+	.string	"\240\032\224j)\325Q\2527\2525\252\037`D'\205\373\022\324\234\036~B&\0169\343\204\355\373,\356\263y\317w\312)Q\331\330\341\345m\034;\264\255j_\305W\340\234wc\"`\326\216\002D["
+	.ascii	"\350G\221\334\335w\352\307\207\"\356\316\"\253{\243\353\213\016"
+	.ascii	"\272\021>t\220(\353/`kS\356\373`^\372\233\3106\b\342Y\035\337"
+	.ascii	"w\027\032PJ\314Y\373\355>\303\316$\243\302\343\322\255\275\357"
+	.ascii	"\322'\207D\203b\002\341\231/\351\276\310PM\274\240\335\235\035"
+	.ascii	"\3348\r\370\rqO)\216\242jZe\333\302\223hXs\326\030\370H\025b"
+	.ascii	"\254\241\023d\261\027L\006\372\305R\023C\241\006\346B\214+6\343"
+	.ascii	"\3020\003C\343z\311j\\,&\216e\200\311\\\033b1\231+\354\315\276"
+	.ascii	"B\326\230r\005U\016n\217\355pOfK3\270\341\3366d\246\277\325j"
+	.ascii	"w\226\033Ww\234\306k\274\370C\216\340\242\277\271\200\227r\037"
+	.ascii	"\230\370\231\351OI`\004\001\002\343\356\306\034\331\220p\031"
+	.ascii	"qQ\242x\260\307\220\331m\311\265\b$ `\002\2311\264\003\337\200"
+	.ascii	"\t9\236c\212\020\n\317T\236\262/b\365\233l\032:\fb\322\037\210"
+	.ascii	")^\331=\335\314N\r\321\300\3243t\211Y\355\215\b\306\227\273H"
+	.ascii	"\342\2048\203\371\230\275\025i\233rc\004C\002\211\345y#\256|"
+	.ascii	"\235\372\323u\341\2264F\3559Y\001\206\002"
+	.text
+	.section	.gnu.lto_flashfsLoadIndex.69.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\362\007\3150"
+	.ascii	"zT\354\022G`ZV\007{AS\366#\003\204\276\202\372&jm\356\177\006"
+	.ascii	"\227\232-I\352\204\350}\230\036_\321I{;\377\020i\217\262\354"
+	.ascii	"\035\b\212\245\265\361\005W\270Q.\003\244\252K\031\201\375A\331"
+	.ascii	"V\312\266\255\355\275w\222)\005\036\001\f\001\034\001\036[\305"
+	.ascii	"\016C\316\372e\027\307\361\220\273\335\240\347\256O\233s\267"
+	.ascii	"\203y\030\224\213\275pb\034S\303\254\305\361\030Q\003\365\334"
+	.ascii	"\3551?\276\356\366\334\370\272\333\340\001TG\001\240\2222sd\325"
+	.ascii	"j2a\023\307cF\017\244\203\r\374(\3271\026\211\303\034!N\020\370"
+	.ascii	"\333\361\365\340\367\350\266\237\243\332\245\\\007^^\261\003"
+	.ascii	"\303\353a\265\345F\002L|\304\025\333\243\f.\247\303A\265Z!;6"
+	.ascii	"5\356\005\025\222\211\024\244o\206Yp\320 9\247\365isk:\0344\253"
+	.ascii	"5@\325\201\347^P\035Y\b\007\235\002\243\314\214\223#\255\231"
+	.ascii	"\203=\254\244\016\204-\374\260\302\362\037\323J\352;pP\034\\"
+	.ascii	"\331\347A:\027G\207\026\255\341\275v\302\224\0322\334\013z\243"
+	.ascii	"\315Z_\3148\233\037\200\203^e8o\371\353J,?\266BS-3\334\013:\244"
+	.ascii	"=\276\371\020\343i\236\253\242\314\354\322\360\026\030\235\242"
+	.ascii	"\312/\214N\265>q\034;\024\317\317\3502g\330B\034\307\235\235"
+	.ascii	"Q+o\036\357v\254\356\366\320\375\246\t&L\274\356\022\375O\226"
+	.ascii	"\2002of\377U+\356\257\244\352\307\033\23280S\271M\2673\275U\226"
+	.ascii	"<H\267|\335\371\007xo\346\271\024\237\302\324\276\325(\220\331"
+	.ascii	"\235\310\327]\177O\363\004Q/`\323\260+e\316v\217-\363W\273=B"
+	.ascii	"\227k\214~j\367\021\234\273\250s\023\t\005\001\371\232\367O\347"
+	.ascii	"F\340b\356\005\006\364\004\200s\363tnc\221\350f\336\3037wN\347"
+	.ascii	"\026\302\271q\336\334A8\367\017\316\355s2\357\236\227y\303o\356"
+	.ascii	"\367\315\355v\356\026\316\375p\356\374\346v\006\004\316\256q"
+	.ascii	"e\326\255\247\033\213ed\335\304nn\224._s's/s7sGSkgk\340\332\n"
+	.ascii	"\237\251\2618\372\213Sk\002\306\246\203?q(\335\300n\341j\355"
+	.ascii	"@\312\345\253E7\320\335\334\r\325~u&~\346i\rl\342N\240\034\315"
+	.ascii	"\205\257\316:\304.\216\241\033\334\202n|\315\2704\2245\2256n"
+	.ascii	"\222\301\332E\344\202\217\371\022('k*\001\337-p\300\017\177\242"
+	.ascii	"s>\256Z\334\3338\216\343\340\357H\203\r\346\261\310{?\241\256"
+	.ascii	"&\366\030\340\341\177\006\261vib\177A=9+W\023{\034\362\001\377"
+	.ascii	"l\b6\260\b\001\262\271o\313\352\244\211\365\375\374\321?\273"
+	.ascii	"\365\021_h\201\037}\320\377\256O\262\314\351\022\315\333\347"
+	.ascii	"0\270\020\326m\265\277x\335MJ\311\340]\021\275v\354\370\275\223"
+	.ascii	"\272\037Vv\236\312\364\272\237\274~\351\020\236\306\324\213\343"
+	.ascii	"\030\202\373n\2219\267i\230\230\262\r\207\331\032\337W=\352}"
+	.ascii	"c!\235\373\272+2\301({m\336~\362:\314\036\305\323^\364\234<\337"
+	.ascii	"\215\224\224\335\331\022\355\320\330p\243z\251\376l\326W\274"
+	.ascii	"?\317\363\235\233W\331\233\312\233\377\347\363\026&\022\342\017"
+	.ascii	"?\277\263y\226\312]\343\314\246\313\234\3751<\210\340\301_u\007"
+	.ascii	"Zj\252\274_mw\005^\254\316\343S;\267C\356P\334\347\306\212\325"
+	.ascii	"\304\376\002/\372\347\220\027\375UU\227\224\373\325 \272(Y\355"
+	.ascii	"S;\352%z\317\273b\361,QJ\001$\226P|\362}*\241\324\324>\2350\261"
+	.ascii	"\224t\237\220M\035\204$\222\310$%\016ONHM\277N*r*q\302\t\251"
+	.ascii	"\251\204\021r\311(\305\022\022\n\243\244\244\223Q\021\200F\252"
+	.ascii	"PJ\032=!\221I#`+\375\251\255\"IU\023kD\340\306\032v\206}\275"
+	.ascii	"\315\215\306o\013\312_\266\2136\216{Tp4w;\262\234\325\321\311"
+	.ascii	"\005\276\373\003\210\354N\004/l\026q\303\263\233z)#jG\214_E#"
+	.ascii	"\206:\225\336)s\326L\216\262\257\273;/kQ"
+	.string	"B\027gzs\310\364\334\315y\267\b\035\233i\230\330\017H^\031\342W\341\\\214\b\351\233\334\2141d(\374\254\246\300\343\b\337'\3708\377>i\346)\345\374\375\340\367\244\361\227\252.F\316W\273\347\177?\342\n\246\310}\377{gN\227\357s\275\244n\256thg\2249\013\364\377\360\3252\330\365\224\n\203\305\357\t\016\037\350\237\357\277\024\335\221\353\227\367\353\334y\006\350_i\232k\334Y\036\027,\f\234\235b\357\213N\343\354\306t\347\347\033\b?\361\237\2753\f\200\244\250a \344\230BL\031\031\031\021\321&I\007`\002\2211\253\362\020hGCI:\211\021\274X\345\252t\201\326\335\020D\b\n\330\307Nl!p+\215\035\315=.\262P\307\026x\301^\3541\350\350\340\027\206,\002\343$\360\n\202\002\024\251\346\275hn\205}\025\376\274P,\303\223\021\341rA\002\235\362-Jb\211\354\346\0178\177"
+	.ascii	"\230\323\301\304\265\265\227l\375\342'\261\r\272\237\261!\236"
+	.ascii	"\330\021\331\2358\317p\267Z\351jX\343\301yP\0233\260\347k\373"
+	.ascii	"\300\023G\263\273J\332\265\224J\302\375)6\270\345\252b\025\347"
+	.ascii	"\355\003a\345\322-=S\237*\342.\302,`\023\310\b\034V\354\310!"
+	.ascii	"\353\330 \n\373\013\307\345h\017\223\234w\256$\226wpC\020!\200"
+	.ascii	"\212c\221\2450\206\3347:\302\254\276\004qH4^\345\242\332l\370"
+	.ascii	"C\253\342\307\212v(\314:\204Pr\205\377\022\325V\242@\033\r\020"
+	.ascii	"M\373\202Oq\032e#j\211oe/\004/\320\363\371e\351\210\206\361\244"
+	.ascii	"qG\026\334\241\351n^\373\303A\007\215\210\265L1\227\201\347\350"
+	.ascii	"l\216\306\255\271v\f\025\353^\254s\3468\237\3601\207U\224\030"
+	.ascii	"O;?\252h`$\235$\252\203,5\357s\247dU\307\333R\177"
+	.text
+	.section	.gnu.lto_flashfsUpdateIndex.70.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`s\002=\024"
+	.string	"v\244\204I\300.)\035\372\271\037"
+	.string	"B\305z\357\230'h\302\026^^6\001g\230\035\243!\256\2526L\033p\312]\305\225\265\275\006F\331\347m\202\306\356\317F.A\020\004A\203\320\200\263\201\n\270TA\200\253[\256\254\375F\310\3362\245q"
+	.string	"f"
+	.string	"v"
+	.string	"T\246\031\214\321\r\267\275|\271Z,r\254tm\376\353\274\275|\375z4.\017\234\230\231\267*\001\035\233\252\377z2\265"
+	.string	"\n\342\356\300\357\313\331\262\254\343jN\356Zv\254\0340=\274\362\334\325\217'\243)\215\223e\353U\364f\312S\267\264~\370\2204h\234\271\312\221\224\323\342\300{\374z5\273\254\020\3234\275\2743\346\316\270m\241\355\003\366b\b)\344\307\323\003o`\310\351\306\027$\203\333\242\035\314-\335\261O\213\305b\321T\307\256kX]ox\335\362\232\3455\351u\365z\351\372\001\006\300\310)\205"
+	.string	"\332\320\245\240\tS\2742\211\343\221\217\355\373A\027R9\220\313\323\351\203\017\3104\315\362\243\255b\227\037o\257\330\245\0314X\261\255\203\345\006\265"
+	.ascii	"\350\333\t\003\225\002\330\375\364\252\236r'\220d\\Xt\3478\031"
+	.ascii	"\230\212H\030\335\330\022/MCRJH\272\265\032QB\"\203Q\327\207"
+	.ascii	"\027Q\"A&#?n\320\013\035\301-\006\225I\300\240\0011\332\310\245"
+	.ascii	"4\"\026\257Up\373d\266\347-\375\323T\n\242\216\336\034\025\225"
+	.ascii	"sT\257\321t\203RZ#\027I7\324(\344\351\b\021\223n\255\354\007"
+	.ascii	"?\204\342\363\270\226\262\347}\364\003&\001\251\231L\250\211"
+	.ascii	"P0\211\315d\261\n2\221\223\030\t\255\026\003\351\360\314B\t-"
+	.ascii	"va6\243\305\312 \356\257\026=\017\320gXD^\370\003\337\272\002"
+	.ascii	"r\030\026\355o#Y\324\3056\213:\004Gs\3254M\263t\320\242\364>"
+	.ascii	"+^\034\275H:B\322\233\230*\022\227\367\353\340\301%`\355\007"
+	.ascii	"\020\366<g\f\177\202\tz\244\226ZtG\370\n[;\202\310\236\0272 "
+	.ascii	"\240\002\221\271\273\001<\002n8\f\364\235\016\rl\255\225\210"
+	.ascii	"w\030W\271\270\r\313nF\305\365U\364m\032\303I$\240\240\255\362"
+	.ascii	"-\3479\274b\236k\374\205m\210At\264\001+\177\307\t\336\202\251"
+	.ascii	"L}0\267\220\227\334\032XA)\244q\313@\0024v\316\003F6\037Q\275"
+	.ascii	"=\004(\330\342\034\033\360\335\314\330m\031\252\315,\332\274"
+	.ascii	"F-W\t\035\n"
+	.text
+	.section	.gnu.lto_flashfsAppendIndexRecord.71.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\210\001\365\016"
+	.string	"\326\333bE"
+	.string	"\221(\035\023\221\022\376\374\215\033\203\266\365\243\267\020~\"\301A\243+\360\206\205\305=B\362\241\353\177\355[\335\306$e\304\212\310/\013\320Y\372\377\377\251\364\374\227$(\032v:\206\317\207\031\266\221\275\267\334)\005Q"
+	.string	"K"
+	.string	"N"
+	.ascii	"3:R[\022qMP\305\324\330\335M]Nz6eTH\3629\274\322"
+	.string	"\263\r\206\317X\200\245\301\206\346I\210\035\0263\252\277\016+x*(/<j\036*\0055\200\207\212\235\335=\3540\305;A\230yv\327p\345Y\2707\267\r\3016\002\373+\002\277\374\313\037\025Z9\002\\(x\207!\263\253\022\253\331\031\251\302\203\355\3730\207\241|\204EXb@\\\332(\266vy\315\376b \233K\037\332\027q\027\351/\021\314\331mi\221b\367\003\261\307\346\262s\002\3632~\300\2744\311\016*-/\032.\244\2664*\353d\316\023Gq\302 \024\232\227S\rp\200\273[RsS\3657`b\240 \215}\022/\301\371\035\374\240\203_u\363R\365\260{|x!\203\305\265b\2021\373;Am\331\217\273\273V\226-\241\263\b=\377\005\tLHt$\372\214:\351\221\220\256dA\367iP\262q\240\315\004\364\tm#\242n\013\3510\347\200D\264\2158N\264i\237\351\036\223\2362"
+	.string	"PjT[\001\b~\345\277\356Ii\3514\033b&\246\266\f\343\307\017;\247&D\006\225\214\036x\246)\037\317t%\" \220\002))\274\001\262\002\352\203\rF\362{\331\225\332\205I\311UD\366,\312M"
+	.ascii	"\025v\352\313\032\270A\020\030\026p<\255\004\273\357\265qD+\002"
+	.ascii	"{b0\270\317\360\225w6\267\301\n\340\350\200#\341\355y\001\343"
+	.ascii	"\373r\363uu\272\2555z"
+	.text
+	.section	.gnu.lto_flashfsGetLogCount.72.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\265\n"
+	.string	"\026\224H@0\251(\035t$~\271G\342m\376$\367\251\243\372#+j\233\f\336\020\210\216\277\244\360.\031{\371-\366\0311\330\001B\353lm1\006\206\360u-zp\3434B\267\254\230\344t4\262\245L)4"
+	.string	"9"
+	.string	"4"
+	.string	"\247\300\374\212\227\300\374R\226s\217\232\234\177\360\034\016X\020\274o\364\330\220r}\370J1\263\273\017\237\246\257\313d\330\354\256\323\373P\356\353\2667l[\330\317\004Q\323\232\351_\020/\251\357,\006\273'-\013\333\340R"
+	.string	"\3007\360P\364\002\3268-\020\260\273\330/[dc\347l\314\037p\002\234\275\212a\3137\001\272\230 \230\260\273Y&#y/\352\301o:\035\245~\303\250\376\202\212U\312\n\366\017\\\265\371)\227\204\362\336/?\244\017\177\021\340A\204\023\250B\312\226\035v\251+\366\343*\312\316t\356h6\217\307\306\371\360d\332'\013\371p@\262\016h\3134\025\326D:@\031\211\246\2012,$=\256\242|\360\021\211qG\215z5iF\202UHA\002I\273\030\243C\332Z\024"
+	.string	"`\204f\262\021\206\020\023\204\200\270\212\272"
+	.ascii	"Z`/\t\033\002\373p\314\n.\214\312\030#P\331\033\324\356\036,"
+	.ascii	"\033\327\nU\202\0165y\273J\031"
+	.text
+	.section	.gnu.lto_flashfsGetLog.73.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\264\003\035\033"
+	.string	"\346\262\262I\240\230Q:\n\324\371\205\320a@\350\365Jp\355\351V\n\374\334~\244\013\270\363*\271O*q\375p\322\226\001\372\373\347\265\270\263\225\204\264Xv\340\t1\032\257\243j\236\305\250\337\310+A\253\200J7 \326~#\204\310\235R\243"
+	.string	"\220"
+	.string	"\240"
+	.string	"^bY\255IMW\265\326\034'\210\275\2749\315|I~\200\371\322\266\0318\330\231w\342\216\242\032a\220\210H\230Z\211\265\325q\336\317\231,\0063Kr)\317\357\3754\267\262x\t\036\223\216j|6\001\330\205\303J\325O\306e\244\002\240\023\030w2\242A\322\244\340\350z\354NFH\b\246\030\315\240\260\007\325\270I\036P\262q\234\371\021\2217YZDe\214\2233\277\026\344M\255\365\306!\272d\315\310H\323\314O\210\024\260\005H\222\027O_\374\\P\n\323\251\265\232\372~G7\200\333\266\262-\301^`u\225lC\251i\224\272\346R?\315\241\376"
+	.ascii	"1\352\363\303_fj\023F]\302\250IS\257\251)\001\003[\242\266\244"
+	.ascii	"\204\302\265B\254Ee\276\252V\251\244\351T\277}\337\310\215\366"
+	.ascii	"i\024G\342}\372\342\003\030\254\265\376\310\255t\2572\013 \225"
+	.ascii	" \265V\235}\242\260\317\227\267w~\321\247_\344S\273S\245x=\252"
+	.ascii	"\262+\302\241W\255F8/\rA\013\200\324\261\301\022\377\264;\324"
+	.ascii	"\212\323\324\252\204uU+1\3079\261\227&\306(\265\037\274p\367"
+	.ascii	"atCDq\321\350"
+	.string	"\253^\334\020\253\265\336g\2636\207\016\364>Js5\306\206V\213\355Y\2666k\352\343BC\355\017;\364>\277\370\331\024\223\253\243W\220%\256.\260]\372J\021y\022e\222\344\311$d\"2.\316i\373\202\266<\242\fQ1\345\f\365\255l#\350}5{\253\353\bm\357A\250\036Ar\227\374\233y\356\311Dq=\311\225\334|&\227\360\241\367\371\230/\317\275\361\t~P\351\002\n\221\202h\031z\034jr\334]2\316e\213T\344\324\353\262\345d\210\212\261\211Bt\227\354\223\001=9\034\217-g\366\374\330\026(\267\003\244+U\330z~n\245y\026\350D\220\320\355\230\020Q\303\335j?\267\035\237\032ONW[P\300\270\023\266\\\r\b\207\313\325\316\240\223u\225lB\be\3128\373y\346\213\217}\t\213SF\363X7\315\265N\320\n9\005Yk\022\205S\375^P\264\314Yz\370\222\n\345j"
+	.ascii	"j\0212$\327\177\002\342\002\275\302\344\2570_\276\212m\341\305"
+	.ascii	"\013\017\310-\237\300t\001\205\303\bC\222\206\263/,T@d\307\372"
+	.ascii	"\356\346(`c\310@\357\333}\326\215\241\355\335M|Y.b<3E\25014\204"
+	.ascii	"\230A\21403\022\214L\2055\035\200\002\2311\264\r\020`\251\304"
+	.ascii	"\351A\334\202\177B[\b\371m|\246\366\362\201\253\264\276\260S"
+	.ascii	"\n\031&\204\355\276\244\277\023\260\373\361\025\3637\306@\311"
+	.ascii	"~\\\217\356F\n\274\032\270\277\336i\004\376{\034\002\3041[\222"
+	.ascii	"X\"\213\235\325\275\313\007\205\211@4R\245\237`,LH\261V\021G"
+	.ascii	"{\032 \302\030$<,\241\260\217$m\235\300V#6\251YJ\277\314\b\325"
+	.ascii	"\223hS\301\233l\302U<\322^\366\2763y\315\037"
+	.text
+	.section	.gnu.lto_flashfsFindTail.75.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\037\007e,"
+	.string	"\372P\304\021E`\336Q:\367Z\346!e\366:0\352\247\266\351\f\317\356\206\324\214\303\372\354\230&:\253f\025\233\313\320C\264\231/\256\204+\230\027v\260X\362a@\022\343\324\202\023D\213\275\003D\335\017\364\250\021B\b\331;\311\r\001\363"
+	.string	"\f\001t\312#\022\330\2477\353\361\214\314\0072EY&\227\363\222\351i/`\237\366\265|\313T\267\034\260\252\220\t\224E\210ht9/\203\300#\251O\321\037\251O1\2236\272\355\177\276#\243^\021\321\020Oh\307\256j\212\342\333\366\205\216T\377]'\367e!\233\374\b]\261\266\306Nf\024C+"
+	.string	"\222k{\323\370\344\032\371P\212\231\373B6y\017u \307\346\347M\243\030\212\2645V<\231\321\353\026]\030\243B\3245\204*\201y9\3374\036A\201n\230\304\223\031\221\\\336\332\224D\351d\356\013\351\344Bo\032\271Nf4rw\350\004,\272#'3\026A\207"
+	.ascii	"\021\347\034\355KM\243\221\313.}!\223_yG\""
+	.string	"\nl\032\223W%\246e\335tmb;;G\371c\356\013\311u\024E\212\243\004\216w\274B\035t\275\021\322KM#\327\305EG,\024\230s>\332\257\326\321\352\336\265)\347\334\267xD\276\001\274\3731\272{D\267\232\"kN\263\252\373<\356\241z\354\342\354\355\352\002\352\336\375\227\243=\261\305na\214\373\342\361\321\356K\253+c^a\252\356\245\325\305a\335\307\317\347\363\331\030\254\233w{I\275\rdo+}\355\235\264\336>\260\3366\260\336.\360\2667\001\366\366\200\233\275\221\204n\377\372\266ow\273\327\267w_\276Y\365\366\312\336V\325\333\351z\033eo\343\365\366Uo\037A\217\017\334\361N59o=\005ef\332&\345m\377\332o\366/\177/\3751o\353\233i\236\332\303\234\255;\307\277\364\313\210\360Z\243[#\323\202)\213\\2\355/_\313JY\036\bO\333\303\303\364\325\232\227\343bz"
+	.string	"\221+\033\204\201\315\321}0O\353\346\265\216\177i\022^g\260<\355\326\321\315{z\273\247\372\312s9Z\363\272\374l\352^v\354\356(\271\344r6R`\016\375H]\266?\002\375V\355\306\220\341\276\350\303wY\207\306\331UE\211\020\016\263s\214o\023\356\203\206\0208x\034\224\344jD\230zv8\254\357\312\364\247}'(\013\027qM}\360%\254\305\364%\354\265\365F\305G\016\213\303\2269\347\025\203\2459\020\317\337\206\033:tP\237\002\261\002\261d\3169\2538\254?\250J\370ugo}:\257\363\001D\210\373b\b\365\251\022~\332\027P\231\003\327U\226L\017`\0038\t\337<\304\344\001\254\242\311\332\323{\253\026\300\006p\352F"
+	.string	"_\\"
+	.string	"\377\254\364\374\311\352\262\272\317\036\200\t`L\207XWu\237#\336,1"
+	.ascii	"\337\314\3235]uNfwO\305\261M\2621'\311\r\236\366\360\303\244"
+	.ascii	"\272\203Z\r\326\326\024\364\237\241\376p\2003<gk\023w;\301\346"
+	.ascii	"|E\241\377\246\005\212>\224\032\352\323\037\336\231\235\315\333"
+	.ascii	"\324\350C\351\024*\356\213*\324\247=|\266\243{\272\3768\223\315"
+	.ascii	"\342h-\233s\246p\261\b\257\303\241P\352\305\013\247U\310\003"
+	.ascii	"\252\2040\206\323\r\366\205T\324\223\220\004\216\241\023\r!\032"
+	.ascii	"PN8P\341\223\323\215\022B\241\024\214]?E\030\302\2201t\242\001"
+	.ascii	"#\030\005\025\264\001\345T#\370$5\fF\020\320Q7\204RA\034QQRA"
+	.ascii	"\336\262\352h\306`]Dt\306\371\220\360\332\247\016\021\273\241"
+	.ascii	"\317\022!\037\336\355p7Ua\253\336\201\346\374u\341^~\271.\350"
+	.ascii	"\017\207\371pX\377w*i\002:\302`+\376\027\323\355n\237\264Q\356"
+	.ascii	"\213+\276iO\"L+L\365\233\324\272\242e\304\340\"a*m\225\373b?"
+	.ascii	"\355ydba\252N\262s\346\330S\261\213>"
+	.string	"*^\341\005\307\231\004^\026#atY\027\250\333m\254\354\252\350\212U\331jC\204\303R|?g\n.\213\273\333+m\226\373b\n`Y\347\346\312<&\310\020\212\357\267\210|\310\354\036\367\233\371\207\200\201\023\207&a\026k\261\030\305.\316\334\344>\327\266Z\332\262\266\f[\360J\343\304Yq\324\336\360\2007\200\211\250a,\244$chfB\221\221Fi\r\240\002\021\2512;\020X\250f\2324\006|\204RB6'\344\230zuK\025m\274Zq\360\002\305\213V\311\341W\301\221\0314\344v\255\211\264\215A\036)\177\204\\\204\335\322\250\200\033d\301T\004\024]b3%\321*\374y)\247{\270\265\344\324\3571\333\321\321\303\266N\325E\335\t\003\0027T/\361|\340PJ\350\312\301M\005E\265@\316\214\362\"\024\326z\356\347\233t\034\030\\\362\316L\321\322\300\230\314\375\220H\364\323\235w\272\301\\"
+	.string	"\352\254\352\214\007\020\204\206\306\372\bd)(\231\310\016\3232ekt\r`\030\321<\221\223\231\030\366zp\f\351,a\033.\022\324V\203\273\200\225"
+	.ascii	"\2168\334\023Ng\026\266<\321\346a\254\020\016\355\361\253E\356"
+	.ascii	"\3420#U\335\215d\221(\211\304d\312\331_\236SSQ\311J~Z\2114\346"
+	.ascii	"\353\241\001\357k(r\352-\035\353\021\355\341\214\021\n\306\367"
+	.ascii	"'\013\"\375\337\250Q\003"
+	.text
+	.section	.gnu.lto_flashfsIsEOF.76.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\355\006"
+	.string	"\362\f/3`m\322\001\304\0210\02436\330\324\225"
+	.string	"\"tO\313\241\244V["
+	.string	"j\r\035;4\n\373\262:\242\f$3p\030?\265}a+\\\360\212mo)S\n\266P\340\205\001V\032.\356a\334\003\246\342\340,\023t\024\002?\210\205\311E\27479)\356\315\264\200\243\225S\257L\337\001U\021\3469\016\222\3605<\221\311[o~f\362v\r\250\340\344\310\216\233\324\013\373l\325\302v\232e:3\375&\020\022\271.\032\331\365\214J6\244}l\330\276m\215-\371"
+	.string	"Ac\3521\3033\320\001\322\361 \331\215N1N=)\377\237+T\242\220um\236"
+	.string	"\t\273\353\264.\212[o`\373\023\f"
+	.ascii	"2\003\3020j\270\026\244\200v<1\213P\204\270&6\r\241\303]\226"
+	.ascii	"f\303\273\356\r"
+	.text
+	.section	.gnu.lto_flashfsFinishLog.77.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`q\004-\035"
+	.string	"\226\263\267I\240XU:\226\222^\237&x`4\261\200V\242\224\345wWG\3652(Y\001\375A[\327\357\301\021\244O\365\355\377=\206vO \251\217\336<\223\207\236\024s|x\364\217\234!E|\275~\200%i\201\032\"d\023\271\223\f\245"
+	.string	"\226"
+	.string	"\250"
+	.ascii	"|$'z\221\355C\027\005v\303\213\326\350\230\300\004\235\356\035"
+	.ascii	".\270e\004\251\333\002\177\231\267"
+	.string	"\345q\314[f\033\363\352\266\256\370\306<f\200\317\305A(Z\342)q\272\367\302\372\307oO\235\246-\273\336\370\006\200MtJH(\356)\343\0178\r\203F\202h\370~\226\257-BbV(\257T\360\303\002t.3|\325\274q[*@F1\303B\177\312\227\f!\275\025\352S\313\0379\005\241\224\251\207\002\275K\032(\236\227\025\252+\037\3708\345`\241\273Z\317\t\367^\256=\224\306Yuf\256\301\314\022\230K\034\001\265UDw\362'+\370A\330\304N}o\307\274}\323t4=\371r5e\036\352j\367`~y\233\007\363\353\305\263\353\254\214sVn\235\225ont\266IU\2561+\263le\232\263\262=+\227g\3456+W[\371\002\\>b\240O6\335+#=s\217V\312\220\033\375\305W\346\363\221\316\204\305\203\254\2418\364\013\262`^%\271\021\377\210WH.\274\221\331\366 _\t"
+	.string	"\240qu[\274\235\330s\n%\273\022{Z\3670\206\204K\310{\207\fn\331A\352\302Bz\277\343)\345\254\033Y\366/:3fu\241\351\033\217"
+	.string	"m\n\376\204[l\003"
+	.string	"\032M\002\265\273l\346\013\031\226\004\3318\3724\356@(d\222\355\036\\v\267\b\242\226]\205\322\262\241l\325\225c\351\341\320\241\203y\333\375\001X|\362y0\371T^\305\003\210\020\365\275\020\346-\006`\261H\231\\M\253\353\002\0251!\357\360&x\215*m*s,\247\276\307?J\237\216\272\306\245\200w\306\335q\023\334\314\034q5\212\225\222\210v\364kf\355"
+	.string	"\3040\273\n\305\314\262G!\221\272w\027\201\237\364b\226\n\262\302\274\r\265\232\2146bD\354\224\265\230m\220\221\210\245HqN\203\232N\211Z\354\204\016\214g\006C1\213\355\300rh5X\203\001\314\223BF\203\251\340\341\241\301V\303\334\313\333<\370GW\r\t\223<(\247\253\2714m\277\032\206*\210\3101\327:~5\362G^Z\001\032\021\225\220^=\346L^\201\334"
+	.ascii	"\363\023\346\020c\023\336\370\t\270\032\225\302\351V\273\272"
+	.ascii	".\361|8mN\371!\223K\3234}\217y\323\255\266Yl\332\366M\267tLM"
+	.ascii	"??]M\271\246m\272\277\360\222\271\232Vx\030\0135\375\243\333"
+	.ascii	"*\277\344\223\222\355\326\305\003Y\250\2210\243\224A\006\231"
+	.ascii	"3\"\223F\322\024\033p\002\2211\263\033\020XG3\032W\003GP\236"
+	.ascii	"\313h\336\241s3\367\033\343qy7CE\032\t8\302K\354\334\001\214"
+	.ascii	"\311\317\023<F\261\317\326|fX<7\211\243\200\277a\263\250\013"
+	.ascii	"=\345\"$\002\\\323q\037\005W\232{\255u\236%\304\323\263{\325"
+	.ascii	"\354\r$\346\3450\340\f\214\342\214\313\305\207+\226\254<I\370"
+	.ascii	"\305\273\303\037\347l\317&\t`\336\224\340\"\240id\275\304\301"
+	.ascii	"\037\305\272E8R\324qr\274<\301\320z\316\364\003\223\251\026\002"
+	.ascii	"0\204\240\033\200\016O\257'Y\314\311a\200\274\263\354]z\206\t"
+	.ascii	"N\364`\205\020\023{y\303\320O4\035\2150\177"
+	.text
+	.section	.gnu.lto_flashfsClose.78.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\345\b"
+	.string	"6\220=9@\217\322\001\360'\177\226\321v\316\306\267\203\201\273yB`\250\t\346\264\307\231\036\361\254\377\223z:\265\326\005\177e\255\267*\236@8\274\267~\rp<\3616,!D\312\224\002,"
+	.string	"."
+	.string	","
+	.string	"\372\371g= \024\301k"
+	.string	"\250\2576\220\302\261\" \226\264\202\324\t\352\254\253\205HR\305\034\3149\255\241x\272\267\333F\260M`\373\025\260\017\030\210We_}\356\0331\323\305\351\025\2639M\263\227\211\262\275Dl?\343\317f\371\270\232\032\223\024\205\253e\316)\327\343\323\357\332\006\340=\2027X\311b\373\020\367U(Q)\251\314~\353#!?\304\023\"}\370\315\027q\337\276\033\211K#\325\312\030\351\314\036A\335\216\356l<\017\203\307i\360\310\356#\037>\034\007\331\001yr\243q\007\261"
+	.string	"\222\021]\007\222\231q~UN\300\230.\261\321\2224\214\332\236\204>\364n\r"
+	.ascii	"3\003\3569\004k\3400,\373\323R\340\332A\361\202.8\232\224\375"
+	.ascii	"\227q\307\245\213\252\035\032\230\202\002"
+	.text
+	.section	.gnu.lto_flashfsInit.79.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`z\005\355!"
+	.string	"\226\373\317F\200^Q:\207\264\036\213\213\212\0072\214\374\331\251\332?\354\225\222\250\265\344\215\315P+\216$\277\202Q\0346T\034!8\005\320\t\243\300H}\260\3150\255RH\334f\320|\221\030\262,\213#-H#\233\020)\223\f\270"
+	.string	"\257"
+	.string	"\276"
+	.string	"$/\217\274_\272O\017\215\031\274\307\b\253\225\306\030\237\332E~Y\262\273\337\275\360Y\327Zq\3416/K\327\212\335\341\257\2708\326>\313\234\336\217Z\353\255~\265\333\342\302\245\260\365\325\023\326Z[\354\272\330\235\235\354\331\236\273q\216\005\254"
+	.ascii	"\274\fsD<\265\326Z\033\371ySVRrl>\367?;\251\233%\023\021\036"
+	.ascii	"\217\313\004\020\341\355x\231c:*\245\251\261c\266\30319&\220"
+	.ascii	"\002\203\213\266{1\316\266\204=y\360\002\234\324\340\301c\311"
+	.ascii	"\244\365\2425Yj\270\354n\274i;\252Q\251\326\372\3409\306\356"
+	.ascii	"\306\\2"
+	.string	"\325Z\227u;\336\367\347\273+dw\013\354\222\300\r\225\365\206\212\365\354.\204\207\211 \253\225j\301\036\f\013\t\262*\025\364d\367\006 \233*V\334{/\377\242bB\205\nf\220x\367B\006\276\216\233\335\370pt\335Zj\337{\256w\261i\340\300\201\236d/]q\210\371Ot7\252C3\035\237\215.\252\226\332\375\007\272\337\272\226\017\373\252\r!\202\257\023AO>x\002<\"\237\236\020l\212\307v\261n\334\277\335\217\265\213\354\226\274I&/\022\345=2y\215L\336\"\223\227\310\344\0352y\205L^Z\311\033T\362\002Q\336Y\311\373S\362\232\224W&\343-)/\245\274d\311;R\336\016`\035\207\271tE\241\246\365P\007\340\3029\271-9\234\263\211P\177MP\323\200\372\247\203\232\206\3011\2315\320\223\277\231\365\211G\254\016\334\354\237&\355\340z\2626\373Q\376uNic\342\254\"\353\337"
+	.string	"\312\311c\325>&ZnH\033-\033*\313\215W\331\017~"
+	.ascii	"/\013\234\336p\307\330\277\256\357\323\\\315\031Tz\325\236\303"
+	.ascii	"\363\352\274\"\352\212X\336D\3210\270\326y\230CHO\bF\315"
+	.string	"4\3407Q\262i\323~2\306pN\310\336\223y\231\246\007N|\235\023=y]1\251\311~\360F\304\234X\375\206\241c'\365q`7\036\333\356\261O\274\251\204(#,'\306\265V\251\336\b\264\003\033\265\204\302\003\b\024O#<\324l!j%B<\221\250E\235@Q[\002\2606\023\035N\324R\330l'j3\254\2513M\365\315\274\355\3062@\261[\033.E$\226\372`\343\312\371H\216\257\336\360\207\002\336_\235:N\036|\335\376\352\016|\b\3013\007\001\357\236@\316 |\035R\033\360\331\221\035u\037\243>\352&\346\304\212Z\250\215\232z\341\254\0245\224\327\214\260\234\030\321\236\0175Q\317~3\344\340\230\334\366\013\316\256Gy1\357\006*\376^\306\020\201B\373W\006uOm=\311:C\305z\206\320\375\235\207\235C|\347\357GO\222S[U?\215\320}\361uN#{\344D\202\204\236\264"
+	.string	"\264CeN\323&q\302"
+	.ascii	"\004\303\023{\250q4\344\220B\306\031\242\t\n\nJ\324\030\200\002"
+	.ascii	"\231\251\"\363\021\3401c\246i\226\315\"T\304\223d\026\214\\\310"
+	.ascii	"\206\3047\206Q\033/\221|%a\242\227\220\366s\273\023t\304,\204"
+	.ascii	"\003\034;\230\201\005=.\020gz\030#df}\225\036\370\210n\265\203"
+	.ascii	"\332\004\213\347\366\344\t\214\253\003nB&\356qg\363\t\214\242"
+	.ascii	"r.H#\254\275u\221<\366JqV\275%8 \034\004\313\031\314\202\n\356"
+	.ascii	"\365;\270\226\035\360\3348\340:\016\273\225\275V\226\227\330"
+	.ascii	"\023\2140\202\361J\351\026\313\271\022\242\255\005\345\005\273"
+	.ascii	"\341\221P\357\211\221\320?\001@U=\314\031N\341.x\027\266\016"
+	.ascii	"\017\204i\271B\213Cqh\204\315\206\250\021X\251f\257\2038(\210"
+	.ascii	"\037\311<\037\216\267\240\332\021\031w\337\275v\022\347\364\263"
+	.ascii	"\0215m\277\376\244\030\341\037\350\265\241\312\200\263\225X\340"
+	.ascii	"\321\354\271\2136\021\253\001"
+	.text
+	.section	.gnu.lto_flashfsAppendIndexRecord.part.0.101.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\r\003\225\025"
+	.string	"6'\211J\300\322Q:P\251.?0\021`\212\307\365\021\346\302ue=J?\303(\304"
+	.string	"5\022y\335\t\305v[M\340\207\314\366Z\302o\005\3709\200\243\007\221\332`\340\262M)\033\215\207\360\321I\364'42daJ[#\233\354\235Rk"
+	.string	"x"
+	.string	"t"
+	.ascii	"\266\261\334\036\317s\332G\272\t\334\223l\006\331\0051\\\261"
+	.ascii	"[\242\274\332\204\365\332:\001\362u<\t\371j\277\204\355\233\035"
+	.ascii	"\365\362\267<\343\354\250\222\f\233[A\322\320\023,\356\256\353"
+	.ascii	"\225\2068\356u\244\223\304\371\271\327\220^\207\217s\327\343"
+	.ascii	"p:\322\333\031[\273\373\340\247OO7\247\200\223+\227\3355\313"
+	.ascii	"\303\275\272\355\030\333\bl\212!\323u5=\256\246\351\201\377|"
+	.ascii	"\371\177d\372L\202v\177\252~\354\207\332b\004\013\253\260\334"
+	.ascii	"<k\345\312\337\217\n\313\215g/\177?\253\235\023B\0257\327Z:\345"
+	.ascii	"\217\267\022\""
+	.string	"\226G\305\325\225'\177z\212\034\327f\371\343\205\b%I\035\025wK\327k\200\3517\035\305\315\227\274\342\013\032\335\370L\027\346|\3118>\247\234\351\007o\266\210\bPI\251\n\205\365\3529_\336\236\024PM=H&\3536\362\302\333x`\340\267\313\363\335\205\206\275\006\204\003\304]]\313\353\360\344\2760\302k~G\351\205\377\206\236\336RI\361\320\234'\265eNc\006\315\347D\342\324\206]\206-\006\216\217\211*H\301\3605\322\236p\030\265\002\304\335m\361]\374\005\215_\364\352\n5\363\273\032\362\365\301\217E\037\223\321\224\316\254\232\224\310\224\374\270t\310fM\223\253\022l`\224&{\321f\3252)\263\031\n\263\227\205\031W\214\306eC\363\252q\311\310f\256\224\022\307.\300d.Z,&s\211\330\236\247Cv\321\241;\225\022yR\372\0272\301n\316\277\220$\365\261I\352\3578\217\227\00500\344\353"
+	.string	"\021@\343\334\335\034\245C\256t\244"
+	.string	"n"
+	.string	"\207\272\351C\007\203JA|\250\023k~\221\033\304\304\220\347\371\236\250\200(\265\035<\007\216)\237\0230A\250\201H\203\f3\nQ #i\224\246:\220\002\031\272\252\007\021pMc\0264\005\267\0038\325\307(\0020u\b\362\322\345\266\312^\246E\207\2317\022\263 \233\331z3\211\330c\033\206\034\274\247\263\233\347\005-!\036\325\326\307{\241\2574Rz\3436|\265\321=V\312\n;\006E["
+	.ascii	"\036zH\026\306\343\323\236I{b\253\025\271\303g\247\234j\347\265"
+	.ascii	"\367\261\237\254t\346D\347?[]\272\td\352\347Yl\233;\344\2571"
+	.ascii	"}"
+	.text
+	.section	.gnu.lto_flashfsGetLogCount.part.0.111.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\016\001\345\f"
+	.string	"\006XUB q\223\016D%a\221\255i\200|m\250\375\320\212\005\211d\213ch\335e\0214Kq\243\302\242\037Y\2647\320\217Xd\006/&\232\020\016"
+	.string	"g\232stf\366r\241Ft\025\267\201\032\331[\312\224\002@"
+	.string	"E"
+	.string	"@"
+	.string	"&'Zv7\036Z\037@\035\276\007\240\016\265\303\265?M\250\371\004XN3D\033\350\017\343Qz\212\266\013\327j\013=kwozV\330J2\001\034b<v\327\034\030n\352\266\023\330.`\237B&\314\351\3708\263@\235\312\3119\234\\p-\033\3524\234\016\217\263\214\004eY\241\202[\331\355\242\357\223\270\311\363\316\bF1Vv\327s\277\364\261+[\263\253C\322\307\202m\177\3049\315\206\361:\225M"
+	.string	"\311CvF]\357R\342\024J\033\366Q<E\346\1770\004,/:\3641\352\360z\323\rl\220AcD\312@\222/\251)V\370\267\212b\303\364\203i}\351\324\364\251\034i\270\335\223\227\033\253\001\276"
+	.string	"\021\006\331`!\013\260\217\006!\361\022\211\016D>F\"H\007\213\233\214\257\007\n:1\302uub\365\267\212\222\251\371\323\t\266\237Z$Z\362RUo\342\342\263x\013\006#\327E\035\246\276\364\003\"j\204\310\335\005\251\2468\034"
+	.ascii	"Pc\214\256\300\212\3365\030]!\316\270\301\n\260\030\344\177D"
+	.ascii	"y\331C\200\200(\030\346\n7\213\r\002\215\020\313\020\300\250"
+	.ascii	"\330B\205\357<ff\003;E\300=\234\311\250\247\355\252z\346\\1\020"
+	.ascii	"\360\256\202\007"
+	.text
+	.section	.gnu.lto_flashfsUpdateIndex.part.0.114.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\265\005\315 "
+	.string	"\366\370\303I\240VN:&\016\201\320\345\332\363\262P\030\3358\201eXe\376\354\306\271\320\030T\241n\311\370\335\256\354`\375\373V\026\356j=*\356\303\3467\341\270p=\275M\216\013\216~V\363\024\247\300\013\347@kF,\331D\356\224\002\253"
+	.string	"\250"
+	.string	"\257"
+	.ascii	"\327\361\251\237G\371=\026X\254\"\204:\225\002:\217\035.\210"
+	.ascii	"X\217h\276\253\257\231S\323i\237\370\035?\347\261\233\304zD@"
+	.ascii	"jh\005\305\340\324\t\312S\231\013 O\347\003\220?\353\017\201"
+	.ascii	"\354\233\235\302\276\235\376\3114\017\200\314;q\311\350\310\266"
+	.ascii	"i\036\2440o\300P\357\212\203'a\321\324X\255\304\334\351\3168"
+	.ascii	"\3574\222\216;K\236?\177\300\336i7.'D~\300\027'7\253\311\017"
+	.ascii	"\350\342\364@Q\212k\374\360\243\215`\025_\027\020\240\213\357"
+	.ascii	"\220\220\217\224\251\265\332\200D\343\004\360\222VSk\365\203"
+	.ascii	"\220\356\332m\267\260=cS\260v\361Vn\ba\324\332\273\320\276\022"
+	.ascii	"\333@\305\371\253\013pCs\213\375#G\222\34339\304\210\371\337"
+	.ascii	"\b\362\364\373\341gU\221I8D\n\232gs\225\274\345\307\2722lO\313"
+	.ascii	"x:\246\234\206\261M\277\330\246]j\323\267\332\264\2556]\243\323"
+	.ascii	"%\235\246\331\246\311\3334\245\323\243mzk\323\263\234~\201\361"
+	.ascii	")K\214\260V\243\263\262\232D\215\324\250\302\365\210KF\272\307"
+	.ascii	"0\323\362\321\245>\004\310<8!\342"
+	.string	"\022P\2108\343 \027\362c\236\221\270\004\264\305\030ZA\341\306\321\276\377\343@t\217\362\r\350\345\244\263\251\016D\261\n;n\271kFd\3037\317L.\355S\256p,\026\312Z\205 \370a>\027|&\035\362\224\334Z\324\225\203\351`\310\220\201<\245\373\251\317le\215\355\270/\332be\227&\350E\206u\005b8\264\306U\362\2756\004\273\306\374\035\351O9\225\235\206\233\033\362\364C\260\313),\300\234ks\3600\377\363\207\177\013\252\034E\310\276\204\266g\037\312\243\360\200\300\301\331S=A/k\354WwMo\232y\377]%\373\211\3175n\r-\326\030\224S\226\357\304\305r\261\312\245zT\223\376\244\372\304\244\251&\325\005L\374&.\276\3304\237C^}\211\003>;%t\243s\032\350D\220\320\341\224\020\221\333\321\311\235\320\3011\221\313\351\321\345\032\f\360\016\212\020=9\237\235\235\236\334\355+\003"
+	.ascii	"\031\2632\313\302\266\314\272&h}^\332*\2558\314\306\354\213\214"
+	.ascii	"\260\200\331\254`\031\031\222\222\273f$W\3119\244\n,Na/K\364"
+	.ascii	"\037\330w\244\313\276L\337N\303\215\313v\b\206\221!!\2306\357"
+	.ascii	"\2117\234>\304\252\264|\333\363\267\256@L\007}2+\335Q\374\022"
+	.ascii	"B\205\341\246\357\201t9\017\371\250\227\331<\211\224Z\203\262"
+	.ascii	"\\K\004\t6\363?\033\362\364\266\366\004\nOMd_E\333\263mk{\333"
+	.ascii	"\023\t}\363L\314\266\006h \225[\243\005\177\250a0\306\034R\206"
+	.ascii	"HDF\244-H\032\003p\002\221*+;\021\220\261sLF\225\275\346P\340"
+	.ascii	"\254\311\202\204\006\365~\321\236H\377\236[\366\242E\337\241"
+	.ascii	"\347\024S\242W\316^\020\246Zj\017H\303=\240\306\250\374\020\032"
+	.ascii	"~\366l\006\346\357\303\373g\2642\254\252\247\n\274\bP\212\031"
+	.ascii	"\364\352L\232\346\274\313\232\224\371\244\264i\020\3058\325\016"
+	.ascii	"(\241\030\r1`t\302\310&\345M\221\362\034\274\023\325mW\035D="
+	.ascii	"\241\321V\354\311\243Q\337IX<\366\201@\350*\020\023\363\021\360"
+	.ascii	"\314\305\201\016\\+\001\311\350\251\247\n\305V\030{\344-\354"
+	.ascii	"\336[@\2430\374+\330g\003\352\034\224\371*>\250\207M8*\225\304"
+	.ascii	"A\274r\204\027t\225H\201\240\272\230\216H~\344\370l\204\246\255"
+	.ascii	"\265\210\271\232\263\371\022?e\376\315\035\323\"\002\021\005"
+	.ascii	"8\321\250{\\\346%~\004=h\375D\230\017~\302gF\303\002\365\244"
+	.ascii	"\267\b1:P\001"
+	.text
+	.section	.gnu.lto_flashfsFlushAsync.part.0.122.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\363\003u\031"
+	.string	"F-\237G\300XQc\200E\264\267L\221\220fG\232\310\326I\374\375\230\352,\351>\300\002\360\204%\230\350yX]\320M\256\352`a~{T\336\265\211\021"
+	.string	"H\002`p}E>7\030<\031%S\235\340\305b.\"rK\231R\206"
+	.string	"\213"
+	.string	"\215"
+	.string	"\3676\263t\342\224\356\275*\3606u\003\246\333\357\005L\267C\317\315R4\326\345\371\221\271u\245\317\315PO\342\341\220\356\325\251n\275"
+	.string	"\224\331\341\355\177x\346A\254\264\355\231\0072\317\256\373\341y\220\217\232\020\245{u\253\333\232\343\263\333\257R\323\314\247\335\336|\005\235\025Dl\267\030\377\250\355\006\343\365cp.\341\002\340\266\363\031\340\321a\273y\332\342\246C)\201\233`X\367^\2032n\230\333\376`\333\202\375\261\002\240}\336\201\234\224O\021q(Va\271\367\212p\362(\343\2418\001\016\245#\375\311\315wn\220\333qc\217L\336\004\347;#\310\361p\354/\371\221\035\232\374\316\025H\321\f\037\334\2757$\255/\024\363u\027\362#7\035*\211\335\bFQ\272\373\242<\222'\221\335\b\366\253\242<!\t\302M"
+	.string	"o\177\005\030\211\275H\216\213\362\336r\310\211\310^$\007\244\225\247\232)t\336[B"
+	.string	"o\255\003\213b.\201\234H\366 n\222\332\321\005>B=D\264\347\372\025\240\013\024t\360@os\f\225%^\255\322\\\377\037/\347\256\326\033\226\371+j()H\226\035\352\305\002\350w?B\003\341\347\273\233-\025\026\233\355\002Ao{\275\371\023\215\336\216.g\212J\243\365\206\253\351\337\275\367\272\332\260MmM\375\205\3245\244\246\217\371x\260\b\340s/O\357\313\235a\217\202\256\3447\362\027\335)\332\225\033#+8ZxU\276\333\223\242fY\332\341\224\356\216N\206\214"
+	.ascii	"\204\204\373\320\003\344\313%\212\260\032\030\322u\302F\303\313"
+	.ascii	"%\212\260\232\320\004\t\330HA\204\325\200\256\326k\024\255[\016"
+	.ascii	"H1\004I3B\\\2156+\022647\253\326\213\\9@y,\341z\255L\214\343"
+	.ascii	"k\025\376\273\325\206o\036<y\254\250\231\337Wmma\333V\263PT\035"
+	.ascii	"\347\234D\264g\330wo\r\t\346\007\234\266VZ\277\372\332\221\316"
+	.ascii	"\226']\360\201\214!C\006\323m\255\247\036\024\264g_\313O\r\251"
+	.ascii	"\003y\003\007z\033\007\323-\255?:\r\222\321#W\250qD\303\220Q"
+	.ascii	"J0#\022H03\353\006\260\2421\253m\021`\305sU[\330\357S\004\031"
+	.ascii	"\201*\031\360\264t\317\266\343C<\362\244_Ls;QP\232\256O<\201"
+	.ascii	"\272\004MJ\210\276\301\220\306\3352tw\322ahW0I\356\353\006\266"
+	.ascii	"s~P\354/\235\203\266\203\030\f2f@\372\031\314\"\255\351t\323"
+	.ascii	"\034\t\264\262h\n\020n\245\313\333U\260\277\034\303\222J\361"
+	.ascii	"\005E,\3743d\004\235\006|\273\253\027\325\032UiaP\304\365\326"
+	.ascii	"q\f\3564\217p\330\027\034\356?\024T*\276\366\341\311a|\301\327"
+	.ascii	"\272)\260\bq\205v\377\373\214\037"
+	.text
+	.section	.gnu.lto_flashfsWriteByte.part.0.124.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"-\f"
+	.string	"&\026PA\020O5\035"
+	.string	"&\013\200Y\021 PE\0308\023Z\360\206z\027\034\005\300\366\216\204\351\305_\013=S\te\266g\256\343\322\373\027\315\252\252\252\235\337\235\020\205\371\177]a\232\345\006\t\244o\267\275S\n9"
+	.string	"<"
+	.string	"A"
+	.string	"\324\007\036\247\331\351=\330\376J\006\355\025\027U\033Y\251\b\271^\273[O\247\206\203\237\022\003\375\213\00702\205\237\020\023\205\313\001\307.\022\354\256\037\025nz\333\234m\315\376\027\016q\r;\263\347.\027\310\360:\261v\367\031\027\3219\bo\026::\354n\307\316<\322\377\360\371\242\263\2267\356;\306GF6d\241\235zJ{\343\300c|<wO\255\215]Q\362r\246<\261c;Q\366\3048\210\004\234vI\035-\026\003=\261\301\2045\006BQEz\306\204\r\326kA\242f\333\033\327\261\006\001\201\320\b\021\212qW\254\247o]\332\367I\274\204w\227%)<\007\026\016\204\005\230+\023\357\302\300\2434\270\324\016S\035`(\231Z\331xu\022q\367\300\262\251\234\256\333\324\314\266<\266\023e\005\253\022\307\030aJ\2303e\033\"\265\333\231N~\344"
+	.string	"\032\027F\216\0214\303\033"
+	.string	"\205\033\343\017\201o\024\031\200<0\302\025\003\325\n\206\270#2\001\201\n\205+\032w^h\261Yg\274\206\217\300\256\022\215\004a?v\256W\224\f\235\241l\346\355\264"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_flashfsFlushSync.part.0.128.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`6\005\205\036"
+	.string	"V\264\271H\240\330Qc\220\235\205\333\371\026\266Y\310\203\";39\331\274\254\001\204v\347\2345\376\216\342\022C'M\f\361\245\005]\215\273-V`\020\312t=fz\2077\240\317q1@h\307\200\302{hh\303F\356\266\367\2262\245\241"
+	.string	"\241"
+	.string	"\245"
+	.string	"=x\367a%\277F\367)\246"
+	.string	"e\b\357\2755\037\255\240\3748{\001\362\243x\002\344\307\363\260\275\363\231gky\352ti\200HCT\303{/\355\243\265\341\321\245\345\335\224\211\2250r\024m\225\361|\"\324\347\346\222Q\322e\252\220\321\357\261\353\360\301@ \305\207T\313\372;l\006xtR\204\005\025\3410\321!\361\346K\230\325\002\025\252cyt1"
+	.string	":$\316\356\275&\332\253V\\\240\344\304E"
+	.ascii	"\024H,\020\245\006\226\027y]\201\366j\035p\031,\302\275\327\377"
+	.ascii	"\211q\003\270\355-\3336[\314\022\267\227\3264p\320\343"
+	.string	"\333S\247\242\327\b\323\0255\2747\245}\214\331\367\237\034\n\356ML\243\305\205\263\265\356\344|\023c\370i\355Xr,\237\211M\256\255\022\236\365\322\213\372n\345s\331\334*\241\242\013xCxo:\241<\355$\026\t\325\f$\317\322\035\3132/\235o\344Gl\323=\307r\f(\204I)\252\3076?\216\276\325\316\277:\221\027\261Y\265\013\262KwO\037\344U6\251.\204\367!&f\256\224{$(`\322\203\362\343\357\314\217\003\341}\n\205o\b\214!\274\327\307\240\374\350\264\224zG\256\300G\314PI\312>\301\221\227\241\265M\256\366\366\307B\007\215.\301*\275\372e?\313\265t\360\237\354\341\303\007\362c\265\261\337O\035c\337\312\257\340\314\376\344\234Z=Q\215\374x\373\254\327\034/\240\224\244~@\352\230j\233le\277q\372\022\3322\331\261j2V=\312\252EY\2655\253\253Y}\001\"\320\210"
+	.ascii	"\245{\213\306\200\2713\306\254\034'\362_\375V\377\222{Y\304\254"
+	.ascii	"\227:\241\267\006g\021b\352\204\232A,\241\035\303\217T\316-]"
+	.ascii	"A\373\202\272\233'\256(n\340`\347\333\314gJEU\3240\016as\216"
+	.ascii	"\320\341\321\321vp\267\033.\347\300Y\201'\207\303s\302N\330Y"
+	.ascii	";\241\223!W\263\331t L\236\035\035N\202M\007\242t\216\315i\013"
+	.ascii	"q\342\214\260\321p:\264\035\035\234\033-'w\322lh\214#Q\313\321"
+	.ascii	"xp\270\034\315\264]\037\341\307\002\231(\256L\210\367.A\020\312"
+	.ascii	"\330![Ah\3142}9is\024H{\257`\222x\357\275%\3146\001m\264\bC\372"
+	.ascii	"F\216\366KSV\fT\333\302\205z\242\321\326\252\340Q"
+	.string	"\027\220\365\261}\335\n*\002\216\266\351\311\205\022-\223hm\025\224^\375\352\222A\024\236\213\206\r\0348\220\037\255}v\250\201@\245\024b\246F\"\t\242I\232\016\220\002\221Ac\035\021\200\301s\246I\352\264\035\301p\363\377vfJ\344\233\361\254yV\354\323\266\256\026(\200\264\262\203\307o\251\263\2017b\237\n!*\374W;T\232\350\275\244\377\316\342\216\245\226\332\310\262\370\241\230\037\t\306!\231\026\300O\244{\003\034\336O-w\020q\031\004\271\331\003\227%\261\325\364\312\227\246Bz~\206\250\326\321v^\230\005\265A\001\211\206\365\345%\251\264\371\270\037\357v\017\375a\311\302c\236\025(?v\250\365\\\215U\371%\0036z$[\353k\271&\234\331_K\tz\"\3473!.\357\215\227q\254\324]J\307\345\366|>\372\344\t\022\227\246M\263\271~M\r\230=8\351\312\250\300\274xG\034\200\026\312\027"
+	.ascii	"\222{5\334WY\350\263\360\245\001"
+	.text
+	.section	.gnu.lto_flashfsClose.part.0.130.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\375\n"
+	.string	"FSH?0\305*\035\300\370\363v\316\366v%\214S\002$\032\362F\350\372\322\320\250`O\260(\304`H\366\375\335\375\202\t\326\3448l\240N\017\003\003$z\034\020IXp1'I\324\b\331D\356\224\0025"
+	.string	"6"
+	.string	"8"
+	.string	"\247\335N/\344\037\366\313\251\024\235\022\224\251w\006$\034\337\3563\241B\300\262\324ip\267\332a\237\032%i\316\203{\037C\255\325\226\216\373\273\355\006\333\n\366\023\002s[^\357\032\027\356\346e\371_G{\025\250jE\345\016T\017Z\023\261\017\003\331 x\372\022\333\240\r\207l\001?qU\fM\2251+Pk\rO\367\303s\206\00246{\251L\b\214f\316\226\271p\233\202\234?\371)+"
+	.string	"\266R\267(+\246r\215\341}\277\222\005(M\234\351\264-.\346O_\004\225\324\210\201\033iE\336w\265\326\032\346d\310\316\003\271\211\350\204\243\030J\210\033O\310\371\220a\006\343q\302\341\023V\214\343'\004m\317/\313\227\325"
+	.string	"\333hIt[\027=?v\231\350\203\030\302C}\217w\032\030"
+	.ascii	"9BT\fF\301\0340\264\312\r\033}5\243\2421 \b\374\032\242\\\210"
+	.ascii	"\002N\264\214C\203\005\234\026\213j\227sA\233.;\027\bD\203\333"
+	.ascii	"\037\263\035\247\204\236\251\031\357*x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\220\b%#"
+	.string	"\2266\314EPdR\007"
+	.string	"\243\365\211yA\224\224L\305\217C\036\266\315f\344\247a\334B\315m\035\007\002\206\375\032no0\335nA\230\237\204\003\003O\r\374\272\274\030g2\372CZ\345\370\224\307S=\256\226\263\306\310H[\246\274"
+	.string	"\267"
+	.string	"\267"
+	.ascii	"\"\3662\304vAl\245\017\373\350a/`\245X\247t\330\tX\016\302\227"
+	.ascii	"\313\026:l\300l\330H\257\206\355yl\234a;\036\006\"\337\205\355"
+	.ascii	"cX\013\333\327*\f! p\200\302\3667\306*\267\316x\323\t\373\311"
+	.ascii	"Z\t\371\336%\f\360\275G\bb\262I\353\202\260\375K\321\317|\017"
+	.ascii	"\0048\330\216\306\276Cy@\257\214\232\301=ij\317MU5tnOc\337\251"
+	.ascii	"\f47\003v\212\350{\327\322\212\266\300\202\356\200b]5I\025h_"
+	.ascii	"\030~\267\374\336\336\336\036s+\3318\352\350\205*\212\237\214"
+	.ascii	"|\357\256\343wY\364\271;\013\237qq\337\356nH\264\317\373\276"
+	.ascii	"o\322nb\335\035@W\237\344\034z\"Y\377\230\230,\277\341\013\315"
+	.ascii	"\272\335\202\323\025\034\376\017\254\277\016\024+z\202\303o\251"
+	.ascii	"\301o\355\264\216\231t1s\002_S\265\337\275\231=\241\372=\222"
+	.ascii	"\017\350\177lW\343c\373\232\036\333\351xlO\243\265]n\307\366"
+	.ascii	"9\035\333\321\344\330n\006\307\366\267\254\355e\260\266\307\335"
+	.ascii	"\330\016gc\273\265\306\366:\375\276\257\273\221\306\3663z\306"
+	.string	"v22\266\273\305\330.\006\306\366\266\253\355l/\2663\272\247\240[\312\305f\266\330QGs\357\020\026\033j\305\326\260\212\355zR`W;)\266~[\024\333\303\234\330~\005\212\351\201\231\330N%\266\002\226\304v\265\021\373)\332\3658\031\373\002&\037i\230\004Zr\227>HMs?\030W]\2377\256\211\177q\377\027\273\354\002q{\202t\277\215]v_\303kH\227\331\006o\314e\245\217\"\225\376G\326\272\n\234<pE\344\377\304\232-rE\fK;\353\245\260;wD\244\317\325-\341r\031\371\032\326\236\227\367\005wD\276\320Kk\352\324\352e\351\270\340\177T\351\023\301\007\253\372\327\344\266\222<\215\377\263\323>\3236f~f|]\325\3162\2720G3j\351]\235\236\243\031\365\263\370\277\252\326\305\017@\325\272\252\370\355\2545\330\325\316[\021\261\212\370z\326\372\ne\217\215\250\350uLE\024N"
+	.string	"V6_h\326\377e\245\032'\331t\266\346[\2655\235\246<M\021\272 ?\346\267^A\246\226(r\356(\231d2\025\262#\346G5{\024\005\204zm\367\364Z~\372\254Y\267R!Rw\371Y\260\016\002s%\003Z~q\326ZI\025<\323\343\362\203\354|m\371\302\271\251\201\222\301\377\274\364\023\231\2250)\211bT\254\256\362[Y\033M\313\264"
+	.ascii	")\337"
+	.string	"J\277\2339r[\222\216\232\351\244\270\232\022\351\364\321\243\323\261\211\225\333:\"\206dr\231\351\203`\315.\341\312\302\205L\276p\326\305\2738iQ\362\205\260v5ae10\371AYk/\357\030#C\311\017 \007\200\222\250\221\020\005135#III\222\016\240\002\231!+n\021\240\230d\022\231@J\302\0211\355\266BN\022N`\363\005bf\303\335\315[\326I:\342\265\2319\005g^o ~\243\035\244\372\002\234\236\002Bj\223F:N\221\344c\321D\337_\222v\237\265\313\203\374\002\262-\"\215\272\355\022\245\271c\313\363+N\347\215\320\236>)oW\f\356\363\246\373\037\361\373\221\2468\374@\f\262\206\032\313\257c\233q\245\376\035\030\305W8\221X\016\355\216m\207v\307\266C;\316\247\305o\022Aa=~\3409\330y\253\025\215\n\021\345\005\305A\216\245\213\307\260n\357\300\316X\034`\241"
+	.string	"\301vO\205\210)"
+	.string	"\263\315\0034\007\247\366\340p\247*w\241\332\324\233\374\2156\310p\016Y%A\3410\341\211\227\253u\237\300d"
+	.string	"TXl\210\232>\177\250\321\367\3267\343\340I\351\314\316\276\254\335\361\234(O\256\302l(B\357{p! \2062{\262i2\302Rw\017\332!\252'\001\027"
+	.ascii	"}<\035v\005\35246\r\032:\266\004<\371\215\377\225\210\250\031"
+	.ascii	"5"
+	.text
+	.section	.gnu.lto_.refs.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`@\002\235\017"
+	.string	"V*f3`i\222t\242Y\337\031\206a\030\206a\030\206a\230\006nq\215\330\304BD\004R\373\377\366\355\177k\366\223f\366\023\266\330\232\265O\032i\2445B\266L\001T"
+	.string	"Y"
+	.string	"X"
+	.string	"\275S\037\315\312\361u\344B\216\361\372\005\354\024\260;\274\336\200}\201\257^\2574\200f\027}\213r\346>\241\033\353\347y\367\344\313\255\240v\334N_\375l0_R\037\345;\317\260_\230\\1y\363\245\335X\375\311\356\362\233\372&\237e_\362U{\373\355\025\203\224\207\274\022\351\022\261G\274\016\001;\245\375!\373\204u\311\344\037\320\303\311C\3207\223\035\236!\361c\354\323\353\216\367/vi\312#\367\016\372\366\230\327\033oxV\357\013\227\344\f\221\036\333\037\350\025\"\337\364Y\354\205\2064+8C\356\304\316\244g\336/S_S\256\246\236SK\271\303\276a\235Q]\261^6\001w\266\003:\304\232\265"
+	.ascii	"\365\212\315\350\213\373U\214\265\344\375\344\036\276\217\340"
+	.ascii	"7\244_\320\027\314\312-r\307\352\013\347\317\275\324w\342g\274"
+	.ascii	"\202\241\350\314=\323\t5d\375\243\277\320\276\221';@[\365J\177"
+	.ascii	"\362\027\266\304r\325\021\020\275\356_\021\351\024\355\025\251"
+	.ascii	"S\\o\210]\002{D\352\020\327\243\311C\331\033\254?\252\273\326"
+	.ascii	"\027\250\253I\257\353\202H\301\355\t\362\224F\320\003=\335\006"
+	.ascii	"\372\023\372Kh\177\004\b\352\177\340 \377\006\354\013\344g\344"
+	.ascii	"_\344[\260\237`\275\302:\205\311\037\352a_j\347\005\034C\372"
+	.ascii	"\261\035!  BD\030\313;,$D\362\245\026b\254g\005P\013q\314\241"
+	.ascii	"\332\304\242\246O\372.a\217\022-f@\034\330\255\374\314\313\237"
+	.ascii	"&5o\363\312\256\032\313\236FF \201\203\t\020F\242 L<[\300\200"
+	.ascii	"d5l\351zw\034\2562\347\034\343>\232\231<\373\335\332\t\005"
+	.text
+	.section	.gnu.lto_.decls.a75fb20cab7f10d5,"e",@progbits
+	.string	"(\265/\375`\003A-\002\001\212\243\321YW \fI:\351s\235UeTH@\222\021yw\227;:\213"
+	.ascii	"\001\377TW\021\355\315\315\335\374\363\377v\027\245\304\221\347"
+	.ascii	"\025\355_\230Zx\242C)~\352w\301;|d\374\354\n\220\204\215Z\t\336"
+	.ascii	"b\205\2064[\226E\203\007\355\234\252A\025\025 \212\260\265\275"
+	.ascii	"\245L\001\250\004~\005\263\005]\030\217\343:yo\223{\257\005A"
+	.ascii	"$R\214x\265\345/@\347<\237 \024Uz\331\356\275<\016\330\352\241"
+	.ascii	"\244me\237\340\331\207\311\2277\004{\330'\370\363\035\227\032"
+	.ascii	"\251\237\214\266[R\245{/\007\035'!\311!m\317Q\346y,"
+	.string	"\213\226\222\353\030\n\307\355(\365\\%, \034e\n\313\355 \365\\\245\244\035]\367\246W\300\017t\256\3439\226\253\251\362*%i\351p\246f)\t\337\275\351\177~\201\355\330\005\326\302k\\\307W\316t\214\3456\275W\351\336\353\301\203\007\017\034p\374\304\302\264pc\257\302|\035o\b\346\260O\360%\314S\300d*\\\205\327:\260\225\263\024\216r Rz\323{S\236\336Z\323\266\244\355M0\317\035\202\365\357\217;\004\037\001\263\331'\330\303\033\202\037\301\374\371I\\[\230\272\030m\271\t;\341\265\037n\341\f\307\312\013\225\322\233vo\312#\344BF\007[[\rxC\320\262O\360@\346\371'\310\363\367\367\367\307?\301\237\337\334\202~UgK\332\376\354\326Va\220\225\201k\313i\254\306k\001`\266\207\020\361\212DK\307\356Myr\236\236\266\222m\357\201yf\362\fHW\304M\363\034\200 \377q"
+	.ascii	"\202?/\341"
+	.string	"3\033\261)Xlm\371\2549e\264\363\031\233=\204\210\347(\335\261{S>\263\367\"1o\260\303\274\001P\312\020\244%A\3736\177.\353`*Ay\033k+\306c?\225\251)y\331\356M1\350\240\341\222\024\326\366)o\b\232\354\023L\253\360\357\006<\355\f\370\310<\365\263\314d0\370\353]\203`\306G:\300 \003+qO\261\376[\271\211\264\t\316_\253\276\332\250\013\300\347\206\n\336A{)\313R\360\363\225.{\372\365\303K\215\202\254W\374\314b\354\277\262\305\376.j\343E\370\355\003~NC\273\332\254\245\241|\262Z\215\241\354\360\224\001e+t\222=>\202\363\363\t\270H\207\331\374\354\323H\330\f\002\376\372\345\277\335\225\025\360\233\211\247V\304\317n}l\257\337\374\325\306\317d\r\346Uv\202\237\033\355\006\360\026c\300\312\312\343g \375\245\2016r\344\277\2256j\257\2377x\235\267\373\273"
+	.string	"\377\225]\377]\270\226\377u[Lp\261\326\206\277\226\330\240\354\3719\204\016\362s\005\033\250\340o\"\355\001_\360\f\204\202z\355\377\336\177e\373\320`=\370\217\346\177\036_\3601}L\342L\206\366 \313\2503X\003p\351\036\177c\351\370\277\354@\333=\374\366\202\237\377:\007\326\222U\007\313_\360\3275i\350\315\337\352\374\234\326(\213i\034\315d\343\357\t\334H\273\352\357\031\ru\016\376:\346g\275\216\272r\251\003\224\214n\272;"
+	.ascii	"\376\nG\003\304\207\237\021p\345\332\317H,\032\315\364\277\203"
+	.ascii	"\016\275\3647\013\357\371\353\210+A\020\321\366\016\356\363W"
+	.ascii	"\017\036\320$ \033\205\213\304 \005\177g`\202\227\033\374UK\213"
+	.ascii	">\301;h\023\\\371\f\177\343\261U\207n\241e\347\257K\376[i\243"
+	.ascii	",6\1775c\272\333\277\212\261\\\360\257`\f\327,\376+\037\307r"
+	.ascii	"O\241<\347\257EL\320%\370\371\b\2071\222\217\232\004\377\255"
+	.ascii	"\264\321\317#\370\373\003\347\244\241?s\360\263\001\246\270\035"
+	.ascii	"\177\326\371\031\005\314\325\341&\330\247\3776"
+	.string	"\376]\3643\224\377 \376\372\343\357\342\337)\376\036\376M\201\277S\370\273\204\277\037\360w\003\376f\300\337\013\370[\304\337\037\376F\300\337\036\376\346\340o\001\374]\377\316\340o\f~~\373[\303\337\031\376\316\371\331\357\357\340\317|\177\333\277\3773\232\237\315\374L\346\347\345\317x?+\177\276\373\331\356g-?g\371\231\356g\271\237\253\374<\345g(?\307\375\334\344\347\265\237\325~.\373\031\355g\263\237\203~\016\373\371\310\317_?{\375\314\365\363\006\376\237\371y\353g\255\237\261~N\376l\3653\216\237\245~\206\361\363\322\317J?#\177\376\371\031\005?\237\340g\023\374\274\341\347\f\377\371\376o\371\271\305\317G?\263\370\331\350\177\333\377\345\317\350\317\306\377.\374L\364\363\371\263\320\317\034\370\237\346g\022\377\307\374\357\360\337\304\377\364\277\225\237C\370\337\301\177\345\317\"~\006\361s\002~\366\340g\017?g\3603"
+	.ascii	"~\276\340g\016?[\360s\005?\373\374\254\341\177\337\177.\377\343"
+	.ascii	"\376\273\375G\373O\366\177\354?\213\377s\377=\370\373\373\373"
+	.ascii	"\373y\312"
+	.string	"\374\302\020\377\217\223H\\\225\326\252R\247\351\364B\355,\361\323r\200\003\301\314s\247\t\276\377\270\"\327*\222\343lz\243n\262\222\244\0078P\313<s\\\320\3360\323\332\321\251\023\031c\226p\264\032\023\r\f\264\030m\017\254a\326\355\340,\301a\275\265\255\343\021n}A\306\365\231\346\353*\\rR\332\036x\3153{<\246\355\350\232\222\332\226)\323z\346\275\027\231\336'~\323\242\372\271YnA\303\325\366\366\213\3717\031=\233\226\207f\315\230\267\336\303X;3.]\356\336b\230\216\261\360Z\337\365\224\220\211\351Fy\260\263\322`:\f\thH\235\311\023\272\320\353\322\322\366\375\345\277\220'N\315\031\276\266\355\305ta\261t\330qQ\003I\333\366r\235\034^=\262\332v\027\2407\036\260j\216\307V[\034\366\t\336:1S\rTHd\314\275\353\270\013\343\365\013\335\306z>MyH\306\226\027\n\352"
+	.ascii	"Z\264\264\235\222v\341mw\246cF\255\256L\314l,\235\205\356\212"
+	.ascii	"\3452\377~{+\231\216\261t\225\266\322S}{$\223\354T\207\344\313"
+	.ascii	"\322b\231\035\327qMe\314\007H\360z\312\233\312\231M\037\024\261"
+	.ascii	"\262\266-\205\345\376\013\255W\027\022\232\2667\323Q\302\244"
+	.ascii	"\252\264\020\005\n]\2303z[\314\036Wg\236\332\366\023\276\222"
+	.ascii	"^\016\354\204\215\314\214\266\267Mf\267\320po'\335\244\376\231"
+	.ascii	"\315\306\327m\214\306^\2664\245\221\001X\013KK\276\013\005u\200"
+	.ascii	"\3272f\2475\223^\373\205\275#m\t\245\355k\236\371V\373/\254P"
+	.ascii	"d\242Xi\253\001_J\360\215\326K~a\020\255\352\013\013m__0\337"
+	.ascii	"g\377\2057ep\374`\322\266S\323E\235\322\201\347\311\030\273\271"
+	.ascii	"\266\235\376\255\244\305\332\254\305\337\2323m\233\254\313\336"
+	.ascii	"f=v\333\f\204\344\275Hm\306\243\346^$\036\346\r\2307\260J\260"
+	.ascii	"\210\270\005\355k\234\371.\274!\250\303>A\246\003z'\3012ei\326"
+	.ascii	"\3665-\305QZ\265I\035\001\303\221w\347\325F\372\213\307\204\300"
+	.ascii	"\002\340X\2223*m5\270\274!h/\373\004\273\b\320\333\013\007\306"
+	.ascii	"\025\"ym\353_w\021\321\271\263kB\205\210[\216\016\215!do\\Cr"
+	.ascii	"\310\030\361z\022\362\036bA;\371\270cj\033\002\350-$,\n\0174"
+	.ascii	"[A8\210Z\"\203h\t\233\210\031\351j\013\244\231HI\346h\373j\304"
+	.ascii	"\374\337>:\253{\360Z\377\350\344\233G_\275Y\211\325IT\375\243"
+	.ascii	"\255:\251\246J\023\206\335\3232\204\210\376\321;x\314\0162\275"
+	.ascii	"O6X28x\360\340\341\206\217\n\225\030\323\276"
+	.string	"j\231\037\360\206`\220}\202\257T\346+\r\363u\311\374[\007S\216\306\001\\\"\247\004\251-\216\033z;^\222T\251\n"
+	.ascii	"O:\345\324\203\212\353x\253K\2273\033S<"
+	.string	"b5n\\\265\335\302\301\242M\201c\253!\245\0018\2770\251\246a\026\306\005Z\333\0317Ej\374\230j\373>c\236\243\\\226\333\001\336\233\234\303\302kX\216\353\200D`\f\313\262\233\032\252c\264SG\265\f^\353\247Vz\263\320.\372\251\221\235\304u@\"0EN\371\307q\\\307f\302\330\225%w\351\245\206\301ul&<\311\262\034\353'\366\343\270\035\245\364F9\200nj\217\357\336\324\203\007\016\036<x\360\300x)\336\214\035\333/\202:\230\272\270h\373\2063\233\351\026-\251S\221\246\350\340\332\276\325LN\362\206\240\006\366\t\276\301\032\211\307\t\2160Hm\337?\314\367\016\363=e\276c\230o\244y\3263\177V\203&\f\353\211\340\342rU\017\260&\313{/\032\366\302`\270\216\355\"y\375\2009YZ\362]N\303}\314\307h\232\\P\201g2\\\346lf\215\315\360\031\276\367^\252\213\324\343"
+	.ascii	"\214\310\322\222\357RA\375\374\274w>\363\207\020\301q9\367\216"
+	.ascii	"\335{3\350\266\252=\251\2667\303q\377\205A,Oj\322\264=O1\377"
+	.ascii	"\363\373\017^$\250{\357\f`z\241\222r\202?\237\201\314?\277\016"
+	.ascii	"W&\300\177{\357\377\372gP\346\336\034_\367^.c\032\201C\302\321"
+	.ascii	"\366\277\0067\354^$\206\233^(\246\264+$\223\232\013Q\030\322"
+	.ascii	"\313\303\202\233\326\3432\245WQ6y\357\275\310\276\351\345\253"
+	.ascii	"t\025u\225\222\310\0210\245I(\2464\211\354\271JI\344\275iT\017"
+	.ascii	"\023\033\022\222)\355*\212\231\322\256\242\230\322\222Q\030\256"
+	.ascii	"\322E\3364$\036\246R2\212\351J2\252\207)\r)\212I\351*\n\203\215"
+	.ascii	"\257,\277\027bW\\\034\305\244te8\345@\202\352\251cJ\223\267\313"
+	.ascii	"\275\314\346\342B\335\272{\tpo\216$T\027$\033\254L\252\223\221"
+	.ascii	"\324\004)\311\351\275\367\002\247$\254\344U\252C\362\255c\372"
+	.ascii	"J\336\373\225\244\342:\335{/\b\310\264\356jq\035\262G\216\333"
+	.ascii	"\344\342^\fnz\257\323\275H\276u\367^\344\275\327\006*Gz\357\215"
+	.ascii	"\036\246.'\247{\25188\335\034\3108\027\3676\233\027e\024S\032"
+	.ascii	"V\022(\216IZ\327]J\221\314\324\224\274]\267\313\025\224\231\206"
+	.ascii	"<\273M\367^&cvE\321\320k\313zcBPg4Y\002vu\374\222\370\365\265"
+	.ascii	"e1@\347e\320\017M\f\266\266<[\346\317yg0?\007u!D\034L\321\007"
+	.ascii	"\023&mm\226\263\026\031&Lmo\351,\226_(,\222\327\304\257\355y"
+	.ascii	"\236L{%\001:\322\360P\323\366v\016\210\013C\300\3326_J\320Z9"
+	.ascii	"\230vz\002\246\243\255\255r1M\316\200\344h{3\226\n\026,\273\244"
+	.ascii	"\2666\212\225\302k\237\263S\236\362\354<Yj\233k{\036&\363\374"
+	.ascii	"\271`\n\370sA\033w\373\344\027\n\237Xe]\265=\3175\177\253\374"
+	.ascii	"\2056n\\pt\265\375N\237\371\2352nn\326I\033rO\317\376HC\346\245"
+	.ascii	"\255\023\333\004MUr\215}\023\312Z\213\322\366;J\363;mjj\226\r"
+	.ascii	"\215\t\252\244Pk\267lN{7\306"
+	.string	"\332Z&;F\314\314\354\022\016\346\035\373Js\003\343G\230<\213v\273D\312k\f][{\306o>x\324\370\321\326\246\374\304\207\220+\250\235\033ddU\215C\262\346\365M\355\361\241\321\035!k\373\235$1\261\252d4\001\200\231\332\013\0236\271\243\362\262\227$I}\343`^2\2546\223\213\333\005s\001\t\222\252\306\307c\236\346\306\234tuY05]<\\h\234\306\276n\301\302\2440\225\245\256\2555\302qwytJ\332Z/v[SR\303\322\326\026\3418\341\214\213\205\205\214Y\r1\3121.\256\326{U\272Vb\272\356\245\372\321\261\262\345\013kK\210\220\252\306=iR\236\337\362^\252\237\016\252\346\250\222>|\330 \034\222\325\313\232\251=\2338\270(U\264n\203\214a\273:\332Z \034\247\363\227\306\r\251\255\375\321{e\260\326\\\235(\233L\332\036\214v\237\202k<\356\226|\367R\375"
+	.ascii	"\371\376\354|`\335\366\220\353\323\361\242\255\275b\271\264\035"
+	.ascii	"ri\332Z\036\027\363_\210*\205%\311\331b\255\254UU\343\020G\266"
+	.ascii	"\364c\206\232\225\0349\2522\005$\004\256xe\311\353k25eo<`li\031"
+	.ascii	"\026T\013\023\253b\253no\004\321\336\262\344hk\251.\245\301r"
+	.ascii	"p\371\265\2656\370I\316\022\2362M\231\224T}[@\2205\0344\350\332"
+	.ascii	">\307\312\312\2602\354\f\r`/\226\226|8I\234\374x\212\272\235"
+	.ascii	"!\205\323\027g1\332Z(\216\223K\263c\256\255}\352\275k\243\017"
+	.ascii	"G\333\233\371\201\301d/\251\355s\236L\313d\231l\223y\025PU\373"
+	.ascii	"\322\256\214\330\030\267M;f\3124um-\fv\373/l\037C| ik_\374X-"
+	.ascii	"\030WL9H\246\013\027\255\007T\305JQ\"k\322\3668d,\222U\262H6"
+	.ascii	"\311&U5\fX\025\200+iI\333\343p1\217\363\304\354\253\177}\366"
+	.ascii	"\332\253FM\365\003\362\3220r\324\325h[\375\200bOR\033c\376\013"
+	.ascii	"\201X{ypm\217sf\036G\353LEs\246\252\361\361U5\223C\221\252 R"
+	.ascii	"\255\354\255\355q\250\314\343\\\263V3\225\316\254\352f\251W\273"
+	.ascii	"\350U29\311'&\242\204\314\r\225/_\352\362f\213\254\212y]\306"
+	.ascii	"Q11\023\322\266\206\301)\022\004\311L\333\n\206\237 \223\244"
+	.ascii	"imk\336\245\374\0272X\\\220\274%xxUy\367ei\0316\005\013\316\253"
+	.ascii	"\355o\276\314-[\352\235\211$\242di\311\307@\270\320@\253\\^\357"
+	.ascii	"\316\272\t\224\035Hr`\314\200b\325\3667W\325\256\332U\272*\306"
+	.ascii	"ii\031f\223U\367T\327\3667QZ\264T:\363\206Q\231y\301E/K\226J"
+	.ascii	"\227\002\362^d\317M\302\333\321e^\261\342\024\245\312\225+\225"
+	.ascii	".\303\275\367v\3310Y\373[^*\252\037!\334\326\020\273\266tq\325"
+	.ascii	"\013\222:\"mrrU\231\002\362G\232\252%\006\025\227\266\027\036"
+	.ascii	"1k\225Z\245\226\255\345\234\375uai{a\017\3635\n\327)S:\b\207"
+	.ascii	"\364\316\310\2204&\254a\236;H\020\n\224\252f^V\243Kc\3622\325"
+	.ascii	"\366\246_\0135\256\205\252\f\302\301U%_\250\017\304\254\224E"
+	.ascii	"\214`5\265\275\371\305\274\031g\266\325&m\365\255\203\352V\335"
+	.ascii	"\352[\nH\rdA\326\350\276\224\332\276I\001\363BV\244\355\3152"
+	.ascii	"\363f\017smm\316\2242\323\322\252\032\337k\006\346f^\325\200"
+	.ascii	".|q\271\265\275\231d\276\246\\\321\320z\215Mo\024O\022\034\237"
+	.ascii	"y\3565A%\325LI-\013\336\313i\362\t\352RA\375\210\211\3252\276"
+	.ascii	"P \2201\221\275\226\345pI\021\221\322\266\216\t\355nx\271\263"
+	.ascii	"\311b\336\306\314<\237q\r\013\3433N\357\223M\322\333\322\222"
+	.ascii	"\257\310\221#,\367sm\222\223\245e\030\326\327W\233\215TWW\365"
+	.ascii	"\332\252^\302(D\242\360l\222\314W!\\\271\326*WKqH\357\f\036;"
+	.ascii	"23R[[Xexf\315\252YU+I\214\n\344U\213g\271D\267\327\366f\352\217"
+	.ascii	"\377B\r\304\300\306\352\217\352\343\205#k\310lI/\025,;\322\266"
+	.ascii	"\017\302"
+	.ascii	"\231\257<\270bau\t\246f'\223s\301,\3635\007W+\2535\301\033\346"
+	.ascii	"_\247^q\254\325\251\006+\300\022\272ZUoT\252j#\370\302\254M\265"
+	.ascii	"\251J\3318YU\031\257R\2574B\210\270\0243LY\031\034m_\243\352"
+	.ascii	"\214_h:\311\332\362\322\366A$\263>U\250).*\340\231\016:j\370"
+	.ascii	"\224[m\377\256>!\\m\253\223\320\004\342\305\251\306\223\377B"
+	.ascii	"\r\274\260\225\246\355\201W\314W&\2560\326*\214\356\343\364>"
+	.ascii	"\341d=)M\346\356\013\276\262\300ui\211\345:\275P7Xx\251i/\263"
+	.ascii	"\\\3605\307\343i\024\022\032q\016\2550dqV \003G\022\306\0226"
+	.ascii	"\220\270\212\017\307!\"jd\023B\001E+\202\200G"
+	.string	"h\321\n\t\034I\f\r\031\235p$a\301\020\035\232P\202\263\002G\306\241P\321\210\210\310\304\020qh\002-\022\353\020\035\232p,\001\321\320\320\210\n\212$\206\210C\023gPqH\002\241\021\3471\003\304\025\307\342\320h\302\004\272\3018<\207J(:2qD\202P\221x\002z\242p\025\037R\024\211F\364\b\342\0242\032\n*\022A\030\217F *\030\0322*\026\211\2126\350\211\263\005\361\030,\001\221Q\005JT\264A1<\207\354QQ\320\212sE\360*>\234+\210(\006\350\211#\005\316\025D\324<\022\207\206\210+\202Eb\212\223\204\r\247Q\221\210\026\211J\340pD\302G\303\212\2411\005\221\361\002g\212\233\343\211\036\221 4<U\330\271\212\017A\306 \020E\242\025+\210\202\214N\240(1(\350D\b@A\306\240\f(\261H\002\347\004\013H\340H\"\005\321\004t\216P\020\321\342)Db"
+	.string	"\307\025F\b\rO\025r\216+\214\020\301y\226\3109\022\r\225p\242G=%,\030\"\016M\b\025\211'\360\034\217\204\206\247\n;A\305\243\343\b\025G\243\241\023\320\363\210\002\205\005\320\023\005\001\234-\210%\320\023\005\364DaG\350D\215DEEF%\216$\316\024\305\241\n;GC'z\016\025\255 *\341D\207BE\031\310\220\202h\002\350\211B\n\242!\236\024D\023Pq$\026\211'\020o8|\360\0015\016\213>\024\317\242\242\021\003\020:\207V\030\036\211&\020\r\225@Y\234\025\320A\213FD%\240DC%v\210&pD\241s\266 \2268\242\020\"\016\r5p$q\301\331\202X\342L1\274\200\320\360L\341x<\203\202\206\301\017h\340\001 \020|@\003\017|"
+	.ascii	"\202\233\343\020\035\232p\204\032\211&"
+	.string	"\240'\n\030\024O\024%\03270D\207B8g\013b\211\022\360\f\021\207&V\2709\036O\243\220\320\210!\342\020\3059O\234\350\020-\301\342\024*\372\234'\316\242#\023\032D\0204\\ahhX\302\361\270B\316\211\022\215\033`q\n\025\211=\350\b\241\36384J\340\210\001\350Fhx\252pDQ\301\007B\303\323\230s#t\026S\020\207\2066E\"\342\207\350P\350\304\212\241q\270B\350\203\216q\250\"\310\206\370`<Q\2400\"\001=\236h\016*T<\205\307\023E\"\"JD\215\303\013\364\234EG\250\305A\257\342\303\321x\222\200h\024\002\300y\002\347,:2!<\23682\242\347\n\242\023\005\036\364\204\316\321\346lA,q\246\030\026\231g\013b\211\343\315\331\202Xbh\210\022\241B#\021\032t\2260\236\0278\236)\206E;g\320\260\250\304y\032O@a\001\3248DK\b\025\211'"
+	.string	"\340AD\343Y<S\230\007!\204\004\204 \002\013\233\2130\302\007#|\020\274\b#"
+	.string	"\001\215\020\002\220\371\020\200\352\361D\217V"
+	.string	"\036\321\"\321\242\347p\242\242\323\b\002%\"2\202\300\021*\236\365xB\310H\024t\252\300\342\024*\222\320\020DL1\\\001DO\204"
+	.string	"\024d\f\252\250q\210\036\201\350\211\020\n@\213D#\023=!\002Z$\032\331\034\b\250\004\r2P\001\024\314\240\017G\024*\216\303!\024 \210\210 \212\304\341\n\020A\306#\210\017\026\f\021\021\221p\002\370\037\230Z0\263\t\213\0051f\225\216\347\205U\230\276\262;\013c\271\344\204,\314X\217\033\\\3001\240\230\371\246D\355V\260\252\2616%v<]\222YM\300$\325kH\222&\030m\221 \3413d`\250\314\037x\244\314f\355k\f\nX\325\352\263\313\213\002\374j*da\252\260\320\026\350\005\364\252J\341\205\252\312\220T\304\366\350(ip)\027/,oO\332\n\021\002\344Z\200\337\3222\f8\344@.9\034\257\034`q\030\300"
+	.string	"\201"
+	.string	"\201"
+	.string	"\203\b/\024\2229\240\326\201A8\356f\313\013lnrfF\250|\264=\006)\346\017\374\301gpn\220\255\211\001\372\260Av\210T\271p\003\230U\357n\223\016% \326\201=\364\246x\340h\013\344\001\274B\322\345\206\327\366\274v0a\214\344=)k\013\334\001L\002\351j\203r1_B\361}\361y\001ZY-62\304\372|"
+	.string	"u\330\013\314Q\2275\224\224\221\001q8\231\203\003C\322\026(\005\224\002V1\024\224\003\222<\331*\303w\251\244~~\340\324\201U@*\2456\252\266\2666.kQAj\265=\006/\023X\003\203\020\323t\363J\273\232A\006\nj\313\033\006\033&P\006PFU\342]\351\371\003\302"
+	.string	"\302"
+	.ascii	"6\231H57|Qud\2001\316\366\246X\251i\373\236\245\371\003_T)\021"
+	.ascii	"d\365\230k\013\\\002.U\272\024\330\342L`\022P\211\327.\005\310"
+	.ascii	"\302\345\331\301r\307\245K\333\36781Y\334{/_J\320\346\357\357"
+	.ascii	"\357\357@\244%2\300\314M\001\221\226m\351\205\324\223\277\277"
+	.ascii	"\252\\\232;b\376\326\257\357\305\225"
+	.string	"\277\266j\324\264\236V\336\322\222\257\007G\2324\225\356F\253\251\007i\376\026\215\222\004\275\246,\2765A2I^\0209\323ix\260\300m\311\332c\271\240\r\026\372\336\314T\265\266* Xe\352\033\026\027\031\\[\253g\365Z\217/\324\226*K\313\260/\246]\332eU\263\311*\343\251\202w<\033\346\003\276KnveK5\260):/\267a,\030:\264\373\305\202\261yD\216\234a\003ry\310\332\274\266|\351\244\315\016\250\026\\\240Yk\223\2722\263\273\235\275c\264\373T\3647\265\267\303\307%Yvg\271\200Q\376}\341b\267P\251\273ff\350\201\275\260\262/\264\222\0205<\272\266\347\341\202\273\205\002g\265T\273\234\213D\273O6oI\322`\341\273LT?;1\304\\e\311\335j\271\r\204\347\250\223\002\324r \213)\304 3C2#2\232$\035S\025@ 88*\225\315\367\341\033\023"
+	.ascii	"\303I\214,\324@\315\032\305HH\222$)\264\033*,\002\320\322\225"
+	.ascii	"\364\316b8+-\005fB\227\202\2773=E\376&\033\036\203`(/\360\342"
+	.ascii	"\300\253*\254\377\310\200\226\211\320b\246\022[/\276>\363\316"
+	.ascii	"\354\346\303hK\022\236\215\352)\230\366\223\216\262\324\226\214"
+	.ascii	"V\221\"\252\255?;\344\300\240`\200*5\220\233\312qQ\254\021\f"
+	.ascii	"\023\245\360\020\tS\307j)\013[.\005(\002\266\374\005C\321\021"
+	.ascii	"8,@O`\342\310h<\0370\272\343\200\246x\323=\214;\362\247\226\375"
+	.ascii	"\341#\216_\204\332\337n\t\324\215\204\024v-\310\022\246\216\262"
+	.ascii	"\324o\256\214\205\241\262h\030\241\226\270k\3570\221\243\261"
+	.ascii	"X\027\305\002L#\026.\2024;\232\243\327v"
+	.ascii	"}Y\031sG\340\356u\032d#\374\203\001\211\bf\035\360\331\n^\316"
+	.ascii	"\224w\210\235\236\334\213\023v9\211\235\224\233\3539{\033\254"
+	.ascii	"\376\232B\177\2503\256]\314\233B\270C\221\240TPoU\037 \030\340"
+	.ascii	"\201;\\\374s\247\336\030\266&\212G\246\306\b\242\213\374\341"
+	.ascii	"\214Y\300|\023V*\261\216I\265\340\327\277\203\270\20160`\321"
+	.ascii	"=q!\360\271\210i-\275\245\3649<`\361\357l\276\2153G\270 U\t\036"
+	.ascii	"c\034\217"
+	.string	"b&G\217P\007Ja\264\255S\326|\251\356/7\345\022q\324\027\324\214r\316\241'\301E\f*U\020\321k\347]\001\370X\016\213\374\031\3707\370\220\202f@\212\334\"s\003\347\026\013%\037m\310\202^\320\272+r>.\201\237sk\323\215\215\033\\N\254\002\245\326\027\3215\024\273\304\362mk]G\231\276U\032\2357*\246\256b\231\006\353lFX<\373?A\361\322_\225l<\313\226\255\343<\316\316M=\255\214\223_\357\225\336\373\b\242\r\001lxs\030B\026\0375\360\231!\231\217\241u\023GEy+\331_#z@5\270\303\303\272\301\334e(\321\316S\360]\332 ML\202\377\2526\264\257\230b\306\244s~1Auj5\027\\\263p\3049\212\261/r\2028\320\250P\341\222\300\242>\245\231\232\240\f\311\275X(_\005\326\344\326Uh\216#\357\017,\314\016$\372\033\355\256\\^\013\302"
+	.string	"\327.2\360\033\277\231\002\213\227\177\304\237\216\331^\2075p\3372Op5\204\253\317\372/\202\320&\233c\370\277\026\233\317\274\013H\207S\276\211+\001\374k\356\302\334\211\356\265\330\227\224.a&A\233\270\177)\371Y\371\214e\t\373C\376\205\261\213\214`\254Z\257\335\202@\337\201\327Hm)\337\27786\220\312\366\360^\346\323\2515G\325\206eD\354\"\206\357\276\033|\315y\216\005\304D\210\034^\260\312,\202\377\347`\262\360.\224\224\213\302X\321\271\244\2702V\006\344\335\203\364\365\017\307\224\267\252\204\206\177\311\r^\235%\230\275\030\247Kl\277\242\257\001\304\"P\2265\255\333T\241\020\261\364\022\332OX\331/\003\272\210\222\t\ny\252\2120\317\311\370\331\346s\227\245\273o\322*\271<\216Xv\336\224U\022\354\003"
+	.string	"n\016\317s&6 @?`\260o\257\360\034\210p\263\007\247{\003\326C(1\307\347\377j\310\373\355\263\230{8\221\324\304\251\312\221\306l\205\255c\006?nZ\001il{\200\316\020?\204\271AM\357a\335\223\fc\230\330<\033\303\3772XL\024Z\216df\207\n\363\367\330\0237MWz\217#\306\220\316B\2246w&\260nXB\201\305\232r\336\247\220\3152\246\240$K:\202,\331\220\275\221\240\202\027$Y\327\355\277\206|G\270_=%\323\3428\347Z\306\342\354i\320)\227A\364\204r\324\031>\367)\032\352)\236\367\370\362\350y\036\034\317\303|\301\224\t5\314\256\343"
+	.string	"ei\036\260\231G\b\244\036\213>L-Y\315'+\002\020\350\003\006\320b\205\211\267\344\251\254Y\354\370\353\200\345?*\024\314\373u\031L%\374\013\020K\327\200\323B\276\343\016\27569\335\036B\3550\342>_3U\032\017<t\273\314j\250 D\305\224y\037\376Y\256\245\023\223\365\262\343\305\016x\305\036\035\372\204\r:\240\022/\271\210D\337`\302\307(\022\315\220\005\320U\354t\350\347\201\0202&\177\215Z\021\2714\273\006\311\0019\022|\b\332\276R\301\245\f\224\312\321\347\271y\032[\216\272\247\222\035C^8\346S?G\377x\034\212_|\t\025"
+	.ascii	"\235\215\324jLt \304C\201\361\037~7\261\236C\373Fn\0061I\221"
+	.ascii	"\235lG\331,\036`|\252\033\370\025Ui\005o\261E\253\251\330:\322"
+	.ascii	"O\241\221\340-"
+	.string	"\303\270f5\214[\227\312\241\207,1R6\313Y\020\323k\3261\025\232\001**w\306W3.\t/y&o\177\330\3349\232\301\343,_~\233\247,d(\2735.#B';\361\320T\022\216,-\311\311O\321JV`\263\344\261\030\2412\261\3737\205\255\324\241d\322\321\240\2415\024\261F\371\232g\337\t\212|\250[\016\375\260\250\265S\350\343C\036q\0225\345\\gz\271'\223\312\322\261nh=_b$\262\231\341\315?!\263\n\344\360\234T\203\020\"5d\b2\035\235\337\274\032\300\273\274|A\025\036\273\230\365r!\362\336\253\263$D:\tF3~\215bB\303\323\202\244q\035\342\352p\206\262\236j\326j\356\362|\2618\301AC\300\t|\313\233\250\322k\320]\243\"\314\336j\2048\00686!\202\322f\365P\235\211\223~\017\332\236\260\027\034b\247\263\353\332Je\277\f\324\274\204\335Mn"
+	.string	"F\312\245[\257x \201\2373_T\336[\273{\327o\234\037;I\241\227!\243\032\202\270e\333\254+\221\253\325\326\233\360Q\001\244Ov\361\037p[\304\366A\350\316\357\360:\354\177Z\201\r\277m\016\030\003\210\253\366\316\212E\005\036i\357\367\215\206\315VRj\236\324\213\030\242\323o\263\004\002j\276\237n\346\303<\310E\001\2617Z\020\321\355E{\220\260\020\301\031\0205\316\272^\fe\312E\2517\004~\343a\030e\300\257\275&\006\206\313B\215_\023\323%\260\226\005\201\ftr\201\350\365m\256\366B\212\277\347\244\316e\240\240:gqRX\351e\373\274\202\323\033\262\361\177\270\320~\305\365\251\n\217\320\214\311G\007\344\230\276t\352\300\240z\037\344FH\333\316\341\006\200\361\341\315\301"
+	.string	"\230\335\263+&*\360\252J\313lv\001\257\217\232%\216\240\2474\030\225>L|W\241\f\300\357\003p\234\016s-\364\264\240\363\013\234[I:\227\030\215\244\232\001\315\357\266\316\351\373U\312}\017\254OK\376\311\340\357\335\237\276\346\277\002\376\343"
+	.string	"\372\274\234iD\341\345\365\264\223\b\374\023\322}\3741\t\370\311@\343~\321N}|\030;8\272\177\315\371\336\374\263\206\255A\365\002\022\007\265\317\213\3670\316\301\207;\305\276a\345\"\004\223p\255\261i\025\350\376\267\203v\275\344\267\321\2613\\\236\270\357\376\356^0\336C\376\037\025:\201\357\315\221\237\344nZ\320GDL\256\022\373y\267>\252\364:g^%|\224w\327\002\333\204%'\005\255\327\323>\310\352\266\334\357\005/\257"
+	.ascii	"\376]\301w\264\216\304/\271\347}qkZ(\375*\277'\036\276\005\364"
+	.ascii	"I{\265k\032U\347\007\375\307\335\235\325\331\373\340\225\261"
+	.ascii	"\223ww\374^\371~f\347\267i\035\272\326\231\260\366\343~\215\356"
+	.ascii	"V\316\251\231\026Q\365&x\273\262Uo\237\311\245\356\220\323\317"
+	.ascii	"l\363\334\374\b\220~\333\2673\305\245\355\357\321e\001nK\241"
+	.ascii	"\326\246\267\325\351\036#\370Kto7\264[\302\211e3\221\327]\237"
+	.ascii	"\342\375\253\370\ro\322\273\231\231\341\203)\245\334\234\351"
+	.ascii	"\375\354\3226\200\235\342\3674\367\2729\230p\007w\327\243e\017"
+	.ascii	"\236\237\324\371\221b3\342\345a\377\326r\031!\007m\017\273\315"
+	.ascii	"\243\202\243\372\370\366\232\322\313\224iA\343\277\366\365\007"
+	.ascii	"\2269wJw\252\372\177\243\017t\1779\007\205\254@\356\301\b>\n"
+	.ascii	"\236\250\366\035\306\205uv\263\267G\275\177\006].\270O\372\256"
+	.ascii	"\377[\035\355\330^S\335G\361^\363\207\274\2247\f?\304\267\032"
+	.ascii	"\261Q\3679\353\356\301\032\337\003\243\212\030\027\376"
+	.string	"\277\376\317\366[sm\211\036\246]l\330z_\233nJ\320\002:\302J\022\315\034G\307\373H\371\233\350CK\376*<\337\347\364vY_\242]\252\237\361\371\270\326PS\231\335\374"
+	.string	"6\233\317\355\265\357I\253K:\303d\215\351\276\242\276i\035&\364;\0076\2227`\350\"\353\036n\020\341\366ot\017\221l\337\177\360;\357\304\223\246\357\251\356\307\337\342>\274\360\212f"
+	.ascii	"\241;\343\327<\235?\347[\327%h\346\320\026Y\331]U\177\004\315"
+	.ascii	"\202Q\273\272\351\307G\277\257?\272\263\366'\032G\303\300\201"
+	.ascii	"\007\220=\001\233\373\375\361\347\264//\364\253\231c\333\323"
+	.ascii	"\340\\\211\3777\204?k\177\342;\242\373\371_\352\377\013q\327"
+	.ascii	"\001\257\356w\3021\373\356\277\262L\3657;[\320\337\243\342\217"
+	.ascii	"\357\033\226\331I\324\327\265\335Ns\343=\230\371\343\276\370"
+	.ascii	"\372\307\375\246\266S@8\344y\336\230\206\320$:\007\367\236c/"
+	.ascii	"\211\263\306\373\3552\034\257\234$\302\252\332`W"
+	.text
+	.section	.gnu.lto_.symtab.a75fb20cab7f10d5,"e",@progbits
+	.string	"flashfsWriteCallback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"flashfsEraseCompletely"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"flashfsEraseRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"flashfsGetWriteBufferSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"flashfsGetWriteBufferFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"flashfsFlushAsync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"flashfsFlushSync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"flashfsSeekAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"flashfsWriteByte"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"flashfsWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"flashfsIdentifyStartOfFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"flashfsGetLogCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"flashfsGetLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"flashfsIsEOF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"flashfsClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"flashfsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"flashReadBytes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"flashFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"flashEraseSector"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"flashPageProgram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"flashEraseCompletely"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"flashPartitionCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"flashIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"flashPageProgramFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"flashPageProgramContinue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"flashPageProgramBegin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"flashGetGeometry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a75fb20cab7f10d5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2455 @@
+	.file	"frsky_osd.c"
+	.section	.gnu.lto_.profile.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\027\005\005\030"
+	.string	"\364\"\013\006"
+	.string	"@"
+	.string	"\330\333\216\224\fJ\002"
+	.string	"\002\001\002\002\003\003"
+	.string	"\002\001\001\240\342\234\212\n\002\357\355\233\375\001\b\004\003\245\203\376\302\017\022\002\002\005\005\004\265\323\366\226\003\020\006\002\006\005\222\274\200\203\f\002\002\007\002\007\006\205\230\234\341\t\n\002\b\007\303\242\237\321\b"
+	.string	"\b\237\263\321\376\017*\002\002\002\t\001\003\002\t\n\013\002\013\002\f\r\t\342\254\223\235\t\016\n\246\214\362\003\016\003\002\002\001\013\330\262\206\224\004\004\f\373\207\245L\b\002\001\r\336\357\337\307\002\006\002\016\016\323\354\317\243\007\032\002\017\002\003\n\002\001\017\273\362\264\244\f\002\020\306\234\214\254\007\002\021\230\357\275\333\004"
+	.string	"\022\332\220\373\226\005\b\002\023\226\304\334\215\013\001\024\212\341\274\267\017\f\002\003\001\003\025\303\337\344\366\r\b\002\021\003\002\022\026\251\236\360\230\003\027\236\316\215\321\002\001\030\254\341\220\343\n\002\031\356\355\304\344\006\032\365\247\303\255\r\023\023\002\023\033\235\331\203\342\004\f\002\002\002\024\024\002\024\034\221\340\210\037\035\365\216\305\212\f\036\216\333\376-\037\204\242\213\245\003\004\002 \225\344\334\313\t\004\002!\251\240\264\362\t\b\002\016\002\025\002\002\025\"\342\305\201\360\005#\357\373\376\224\r$\361\335\271\311\013%\323\253\250\222\001&\205\201\330\356\016'\245\360\234\\\n\002\016\002\026\027\026\002\026(\223\312\344\345\b)\247\302\251\352\002"
+	.string	"*\230\254\336\331\f\030\003\002\030\002\002\002\030+\230\367\275\344\013\f\002\016\002\031\003\002\031\002\002\031\002\031,\237\352\337\244\007\032\002\002\032-\222\374\252\256\002\033\002\033\002\033.\237\240\365\325\b/\274\346\314N0\304\305\314\373\001\034\034\002\0341\367\310\362\232\n2\234\220\234\363\0073\360\257\277\260\0044\214\237\323\365\0065\276\212\273\364\b6\226\314\345\255\0037\355\264\317\242\0028\206\243\210\376\n9\232\352\222\345\002"
+	.string	":\202\261\365\221\005\016\002\035\002\036\036\002\036;\237\353\353\307\001\006\002\035\002\037\037\002\037<\302\216\275\330\007=\337\332\355\325\004"
+	.string	">\300\262\265\244\t"
+	.string	"?\366\311\255\311\005"
+	.string	""
+	.ascii	"j\250\361\254@\t\2246S%i\241\003\240\202#6\234\007\0210\261q"
+	.ascii	"\206\031\221\tf\024/\354\254\0016\220\241<\265\201\273\027\345"
+	.ascii	"\357?\244\244\352\232\025\357h\021\345\220\326b\226wR\210X/\330"
+	.ascii	"8@\370>\252\340\326Q\206{8\347\213\177\026Z\317\363\006[\204"
+	.ascii	"\274=\3440\217\342Q\034r\230\332@VO+\271\263\350\340\314\027"
+	.ascii	"\204\362?\001\031\246\351d\253\240F(\235\372\230`)^/5L \202:"
+	.ascii	"\242\377u-\236\351\027\310\331y\374_\332\374\033\345\263L5Y\t"
+	.ascii	"\235\314S\354[\223\313\002\201\215<\254\263p,\351!x\305g\355"
+	.ascii	"\202\220\265<\253 N[\222u\323A\377\222=i\277\001\255\177\336"
+	.ascii	"]\267\247W\352\267\337\271\236\032=#\207'\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`)\0035\n"
+	.string	"\262\f$\"\360\330\2461\260\310&\262\211l\"\233\310V\254\022EQ\024E\021\323PDj\377\377\337\215\354-wJ\001\356R-\373,\373ZQ\331\237\024\224\023\223\022\222\221\235\211\204\200\354\317\307\362\330WG\343\200\2246v\215\f\214\213\235YTP\354OH\354\021\373A<84L\f\273pu\033RR8\023N\204\363\3404\270\200``\005\336"
+	.string	"\351\004P\357,g\2632\315f0\021\364\270|+{Y\327\267F\325\255\255\355\307\366=}}\357Z\256\224l\nd\250!Q\312\256\2625\006\220\002*#\363\022\200\305\024\006g\214(\026\225D\333\343vP\020\200\231\203\264@?q\205\261\264\035\026\346\376p\264\201\235{\b\341\2208<\202\331P\025WOD,\316\350S\227R\260\371\360l\254\020z#\342 \320\202)\244\034\205\252o(R\nS\362A'dpF\233\2335\217\306\0218\236\200\002\t"
+	.string	"\r\202?\001\230y\325;\"\034\235\240\r\2060S\224\231\233g#x\006*\b.\312S\037yHh\335\211#\322tM\313\032\3136\254\317\r\fq\bgm\237\237\256d\257\306&\370\357\375\320%\236\366Z\250\250@\300"
+	.ascii	"\207\002"
+	.text
+	.section	.gnu.lto_.inline.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\317\022\355*"
+	.string	"\326\262\255H\240\232M:\245-}\231\302\306h\274\270\276g/\217\f D\360\311*\342\260\310\022\270\255\340.\fF\2730\036\240\222z\036N\002\025\306\013\230\034/\226(\002\200Q\303\342\372hR\266\355\305\266\247\b3k\304\022\262\267\224)\216"
+	.string	"\227"
+	.string	"\235"
+	.ascii	"\377<\235\337\022\223\252\273w\266\303\330\376tO?\304g\252\222"
+	.ascii	"\354\b\322\361\362~M\314\030\277'*\334\351\311r\367&\370HS\017"
+	.ascii	"4\005nT%i\372\t'\377\237M\372\337\204?\3233%\3016\302\320\320"
+	.ascii	"\302\257\247>\356\356\026\177\243)E\b\220\314Hys\274\373\177"
+	.ascii	"W\210\224U|~Op\224,\035Jl\347\237,O\226\363\337\233\360d\271"
+	.ascii	"\377\316&\237\207fWW\027\222\370\237\340\244\251\253\250]\342"
+	.ascii	"\177Q\360\226\325\222\230w\3719\274\026% \306m\241\244\220\216"
+	.ascii	"\333!\230\354\307^\177\024\232NA,(\364\265v\b\376v\237km\020"
+	.ascii	"\234F*G\215}\355\365\253\020\377\254\230\254\320\327W\022l\304"
+	.ascii	")hF|\256O\244\243D\340\035\346}z\363>\025\032\344n\265\247\207"
+	.ascii	"\367\207\327\207wyx\237\324y*\343\374\324\374\223m\021%\036\340"
+	.ascii	"\243\375\353\022Q\307)\370\237\274-\224\210<|\364\235o\021\377"
+	.ascii	"X\002\3764|\\\026\177\321\274\352\356\327_2\376\211\230\211\025"
+	.ascii	"\223\024\315\210\265\276\354\340R[\361dy\262\264\241\017\033"
+	.ascii	"B\005\261\240j\317\341\253IS\006\313\353\365?Qx\234\177\367\257"
+	.ascii	"\3774X\027\021\027dx\370[Y\270J\335o\350x\337\024\201"
+	.string	"x\317\273\023\277c\337N\004b\025\347\257\321\204Q\245\005\246N\233&Bf\374h%8ikL\225\234\317\310\362\261\225\261LI\f\022 \016\033\177Q\314,.\255(\001\227\375=\271\\i\311a\333R\005\b\230\372\330\222\345_\304A~VL7\256\031\277.:\207}{}:R\336\356}\004;\005\261\232\340\236\353\036\333\203\b\033a\245\375\341\312~\304\330\315\035\347\260\033\256a\3140G\f\363v\301B\005\n\023$D\240\020\0368h\016\251\bk\300`A8C\005\2247g\257\004\034\204`7\351\220\356\226\211@A?\n|v=\007|\224\307\203M\036\337\024y\274'\252K\2203P\340AK@\n\212\207\227\327\007T'\335\035C\300;\251\272\333&\024p\262\fy\344\255\023\027\340\2663\304\354\233\266\247\262\273s\016\005\300\217#^\355dt7\215uZ)\210U\344\365\3326\275\200\362\201s\261f\315\021"
+	.ascii	"\247\321\232\353}\3641\222\217,\240\370\036\022\2352ewj\217\276"
+	.ascii	"\013\f\201D\250\341X\247FdD$H\222$\031\016\021\005\0041\350\034"
+	.ascii	"\274\033\022 \3040\311\301\240AF)C(\020\231@B\t"
+	.string	"d\342hA\2226\300\301\247v>\334\216I\271C\246u2a\335\371o\222Ua\347\244\2023v\300\216\021G\334x\2048\2347n\007\233\306\252\323\330\332:h\347\311f\246~\315\305H\024bM\203S\337&\351}\005\243-iHUeC@[f\255\324\342\205:\312\222\331r\306\273\327\215\025\2073\023\361c\216\337\364\230\264$\350\361\370\374_\036\251\\\235\361\261\263\314]f\304\016\241+\334\024\360\\\210\364@\243\007T\032\364*0\352\312\233\037\304@\252\343(\314\332\347\320O\033\353\334\203\265\002\347S#\350\031\302\232V\370\026\2104\327v\370\206aU\031fz0\215\302\201\201\t\237\304\225\264Tq\020\343\266 \022U\"c\360\355\033\326#\334ib`\033/\367\223_\203W\374\002o\307\367\035\024\220\350'\322\250?\352\331%\311\336\257\273\bi+\327T4\224B\n\302R62\326\301B/\230\244\263\227\231"
+	.string	"NG\r\2449Z\212h=\001\256\241:)Q\314Dgz\243\344\344\344\236\246\367 \343H\250$\221\274\373\360\223\013\253\b\376H\ba7d\324\021H\217B\370\300\3105\355\214\002?\275\231\252\272)\221\255=\032\337\355\3424\363\216\t\340i\314\262e\2478\307\233\022!\364z\244\2370\302*\3164F\035\374\376~\310\2720\345\034\375\363\260\332\031\344\270Z\021]!il\227g\354\333!\346\376\367\374\221\342U\200\344\360\303\312\221\316K\326\224K\022\301\320\301\353\030\346\fe\313\001\f\033\256\300`;\340\342 1\004^\220O\003\205~\314\215\205\235\235\by\276n\2749\214\"\201\207K\020/\177*\263\013\373\253\351\256\263\272\211S\371\025\257\202\207H-\217\272\370\0304e\257\311o\376t\033\025\307\003\034\350"
+	.string	"\232b\231\310\307\316\270\310x\357]\260\201\013QG@D@\237\256\344\334\205\2156\217\177\2000\356\276\032\021\233\003\335Cy\340\321L f!\360{\2552\264N\316)\277|\211\273\230\270g)>\257[\331\351rP\252\303\377@\354\341\316\352\0165\201\264 \037C\360C\\\222*r\205\3331t\317\234;q\357\261\0041~\334Y+\230\203\267\356+\237.\207\214RX^\370\267c\235\343\343\267\226\264\261\363\025BaW\036T\234\226"
+	.ascii	"?\216\025-\031oF\237\343Q\260 \004j.\327\225\200\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\006\021\275$"
+	.string	"\266h\204D"
+	.string	"\317\2501\321!\340v\013\373\006\360-E\343\337\027\264\223\377T\365K\320:\327\324_\300>BL\250\257\374\277\326\377\377\377\202f\277\244?\n\354\344A\333\035"
+	.string	"ck\f\354jb\250\007y\266\266\345\226;\245\024`"
+	.string	"o"
+	.string	"z"
+	.ascii	"G\241\272\332\366\274\221\256w\273M\361e\357\0313\3020\234q\233"
+	.ascii	"\321\336ggc\216\353\310\347\311\247\3679c{\303\261e\2161\272"
+	.ascii	"$\344\247=3\310\273\363\223\365'\357\342\340\330\306\21751i\002"
+	.ascii	"/\220\217\355\026\275\317\370\231a\377\337`\037\373\270>\362"
+	.ascii	"uh\331\316GY\035en\337v\246\244\026\001\337\330\030\215HmGm\206"
+	.ascii	"y|\b\3623"
+	.string	"\202|\273\232XW\023\363\224 W\023\344c\261X\314\223\202|\303\031\3634F[om\fU\210m\323\320@\371\334l\001\r\320X\326\347\310m\024\021@\333\212\374\2424\2172\220\b\217\230\026j\r\235\030\024\334\017\314\031\204\233B\232\333|cw\360\355\320\241\017\366`\225J&\033\201H@\255'\207\326d\377|\tu\177e\305\373D\245P^\341T\352\223\362\373\034\242\234N\251\023\021\021\225\002&\323g\022\022R\262\321@@H\342\354\343#e\304\303C\345\225J\247\216\016\221\034sp\244LmC8\316$\355\225\250P\201\372@\356\234\317h\232;j\255&\202\375\337\352\243\365hKmG\313\321\235\350N\314f*>\350\365\022`\301\302\263\202\374\337\340\007\271>\277\001m7H\244j\314\030\375\371\2311a\342@O\017h\240\365\035\230\207G\006\004\372\316\016X*1\340\346}\001|\234w\f\3746O\003\""
+	.string	"\357y\017|\347\013\336\262:: \214F{\311\310\270@0\006\006\203y\275^\\.\227\230\230\330\002\003\323\n\271\360\313\213d\205B..\247\320\226,--\253Vk\205\373\211,\226\250\246\342\022\216\263\022\013\213\310\373\204\375\265\224\256\213\253U\352\023\325\205*\271b\233\377\274\201m\250\021u63\222\024\024\262l\006\301\005\204\030\005\035\232\007\022\200!\232\f\3430\245\224!\212\210\214\210\0043\"\022\024\024$\2271@\2719\203\240\316\344ab\214\340qvd\245\320>\376<\224W\023\007\353\272\001\361s\230\324\033eu\367\211\033\rt\232\221\r\223i(\261RT)\205\350\245\371\2054\023\020?}\224\252\253C\271\375\311j\240\2453\243x\207\224\346"
+	.string	"\265\035\250t\017\030Q\031\016\344\204\207\003\246\331\245\212T\2438e\364\317\203Er"
+	.string	"\022\275IX\307\013\312\0322\340\217\217\t\177MghdW\032\317\360\365:\013\245\277L\205\"8"
+	.string	"\366\277v1J\n\re\362\006\213\311\026\177y\221\207D\236@\304\250\251N`|\206\033;\246\253\017\020I\r\263\f'\306\004/\307\265\332\3579c\224\216\f\342\341\207\263"
+	.string	"\241+5\362\273\370@\201\326g|\"\266a\276[\bG\001\320\356u\305\272\001\017\277\330\t\r\300A\\\326\340\0212\\\235;\272\317i4$\363\356c\270*\240\336\323\007\0162\242\343\311\274\224-\333\232-&\203\372\ne\264\324\033\273(\356\336{\276\353M5\273\246\366\304\352\254X~d\303D\245\022\333\227\017.#6\031\342\303\247\205x\373\021\342\325r\306\357\266\222\177\274\222\347\002\245Kw\211\001)\b\230`\371\376 w\2721\240\322\230N\032\254}\311\233\243\312\b\006?\232S\263b\204K\273\031'\345\310\270\177\203\003#{\266B\225\372D\3413\260\222\323\277\375T\210\264\"\335\267\003G\217\255vB\251\263|\340\211\232v\007\205\265\344\357\031\344`7,\357mgH\001;\226\005m\320\rN\f\256fU\254y\370\311\277\310\266\272\213,\202^\320\206+j\2400zA\226\324\207\316\235"
+	.string	"(O\206#\236\313\345\374\367\270\rZ\212\311\231\333\210\372f=\325n\230pB\020qp\270\004px\315\240j\313*`\270`g\322L@g\177\355\025\313^.\325V\221.'@\013\244jM\336w\310\210P\004G\024\2202\350\024\332\347$\326\305\032`\243\306\336\330\244\027\032`\337\365\b\207\340\326Z\262\376\227\262\326d\202\340\262\271\004\242\345\300\"(\350\335\366\353\201\354\224\263\261\035\273b\212\376W\273\207\305\352xkq"
+	.ascii	"\273S'\217\316\205:\231:\022<.\225\213\325\231\270(\002\025\374"
+	.ascii	"\020\025\351\332\003"
+	.text
+	.section	.gnu.lto_.pureconst.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\"\314#*@\315\264\006\257,\212\342\325r\206"
+	.string	"\036\3030\f\3030\fk\310o\311o\311o\311o\t\370[\370[\370[\370[\370[C\272\f\216\271\206g8\206_\270\205W8\205O\270\204G8\204?\270\20378\203/\270\202'8\202\037\270\201\0278\201\017\270\200\0078\200\277\334\345-g\371\312U\236\362\241\374\344&]IG\322\215t\"_\310A\376q\217w\234\343\306\306\247\361\214\017cvq\213\257\342\243\370\304%\036\361\351\0209\036f\rk\255u\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`W\002\345\t"
+	.string	"rM-2`O\322\0300\f\303\024'B\301AQ\204\332\217\203A\240J\301"
+	.ascii	"\335o\314\350\362\001\321k\244#\232\342\002\t\254\211&\nl@\016"
+	.ascii	"V\223M\310\336R\246_)\237M4\0061\224\017|\237d\307M.\231\344"
+	.ascii	"\316#\213\0342\310\330\037\3039{\274\351H\320r\274\261\306\232"
+	.ascii	"3\316\214\361\305\026WL\361\304\327\022G\f\361\260C\202\266\341"
+	.ascii	"g\310\027\024\376\004\267n?SeE\350\250\256\261\016\342\006\027"
+	.ascii	"|\356Q\315*\007\2462/-1\273\313\362\013\255\354\004\002\036\200"
+	.ascii	"\363B\337\246\037\324\\\242\326e\243%\030\353\346n:M\371\231"
+	.ascii	"i\036U\tT5\243\346\236\253oYX\250`\212\033%\215\001\340\202!"
+	.ascii	"\252.\006\020@C\3224\205\306p\021\340+s\251L\204\205\026\202"
+	.ascii	"\023J\254\376o\264\264\250<\244P\234 \2201k\227\377c$U\244\246"
+	.ascii	"\330\232\374G\023\\ouZd\311J\007\324\314\252\233\276*\357\216"
+	.ascii	"\024\026 \242\247h\320\0258\355\263\214 \327\305\351\313\221"
+	.ascii	"\320\005\\\310\307d\350\2660\211\302V\320\354\":+\302Y\2351<"
+	.ascii	"\355\0350\035\305\271\002\030E,\310\221~\3153$"
+	.text
+	.section	.gnu.lto_.lto.4b534b857a8b7c18,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frskyOsdProcessCommandU8.21.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\317\001\335\020"
+	.string	"\206`rG\360\322$\035R.\343.\253\230\002R\234R\316`\013\027\220/\327\223\333\267\003\374\200\344\013$-#\240\206\300P\273\020O\343\263\340M \024g%\317\344Fb\373\374\277a\201{RZ\333U\324L\017jd\357-eJ\001`"
+	.string	"W"
+	.string	"["
+	.string	"\321*\373\307\277\235\231\2510\321\002\0322\347\3246\205WU\227\021f\253*\377\004\026\353\274\325\245\210G\250\200G\021\f\224w\003OH\240\260q\237+\216\307R8\240\205\3163\230\261rV\240<\033\250\242\2244t\362Z\272\3679\214\001\303\321y:\327,\302\234\323\332y!n\323m\337\330N\261U@\373\262\277\225\252\354(%y]\366{~\324\277\237D\252\263UK\251\216P\rW\275Q\255P\375\022\002E;$\004\315\231\023[\232Gq\210\205\355\237\354\006\016T\377f\274s\226XB\271\332\227\361\031\252\367\320\274dN\227\221\320\234\037\212\031\230\036\375\375\200|4\275\200|%\272\013\327^a\321w6a\301j\300\0351\311\356\002\200\031\265\212\324h\f\356\313\377\006\351`y\331\272\374M\352*\322\217\017\033Ur"
+	.ascii	"\375\332\032Z\364\235.\204\0236\273\262\355r\240\016\2469\347"
+	.ascii	"\003\377\3474^|\236Gs0\372\016F>~G^\344 \322S\243\261\3039\347"
+	.ascii	"\334\333\267\324\266\336R.\304p+\036\\bR\0314\256E\333\320\302"
+	.ascii	"\362\242m\251\030-%\2019\016\030R\232\f\307\245\264\3237\277"
+	.ascii	"\256\tFG5\373AfK\322\343B\272 \006\364D7\221\334\225kS\250\240"
+	.ascii	"\357\2625\271\331\225\343\312U\240V\221\337\2600c\342\211+\003"
+	.ascii	"\003\2023b\001\b\241\243\270/\237F\242\026\301\313\305\017R\""
+	.ascii	" \200\202\221\262\365\342\300\352\r}\255\220\352\035\333pW0\317"
+	.ascii	"\021}\330K\332z\270\345\r\033\246[\034A\nk>7&#\356\354\333[U"
+	.ascii	"\223\206,\332\n,\312E\206~\r\305\b,W77\340(\365\336\334J\222"
+	.ascii	"\360\246\2261~\204\3512d"
+	.text
+	.section	.gnu.lto_frskyOsdSendCommand.22.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`'\005- "
+	.string	"\006;\316H\220\230Nc\202\327\026\3277\227Oi\310\036\214#^7]\032\273\002}M\244\027\001\211x"
+	.string	"tR\023\021\n[\024\302>B\265!iB4\001bF #\021\020[\252\0170\203\3348\364\\\303\364A(\222\275\367\336R\246\024\267"
+	.string	"\247"
+	.string	"\276"
+	.ascii	"\227\310tS*\261\205v/\262\301MK\260\313\034F7\001\356\020\013"
+	.ascii	"\212\307V\373W\307\021<\322R.s\257\324\332\016\362\002\316\233"
+	.ascii	"\351i\316\233\256\325\206\300\023\374\r\240\355\275\306!_\367"
+	.ascii	"\"w\274 \275\351\240\035\345\310\251\213R\325H\322q\345\336\233"
+	.ascii	"\263-\202\265D\336i\r\376\226\242gik\320G}\020pY)6\035\375V\242"
+	.ascii	"$\226\252\216\204\351\251\354YC\363q\260\244\232\036`\341\224"
+	.ascii	"\342(\352\003v\223*9e\205S\212\237(^\226\f\320\300\252\bX\252"
+	.ascii	"*\336kXmL\023\261\324\271\367>\371\252\324$\254\025\365\271\367"
+	.ascii	"\272\026\233\234n\227\333~a\373\202m\036\bH\265\315F\n\253=\332"
+	.ascii	"\357\231ZC\263\225\262\237u\347\340\034\371\337\374\306os\255"
+	.ascii	"\273\346[\367\314s\3742\377\272c\236u\303\244\325/\265\032\227"
+	.ascii	"V\273\244\325\267Z\235\246\325hZ}\242\325&Z]\246\325\026\255"
+	.ascii	"\256h\365\013\320D"
+	.string	"\035\261 v\357R\233\226k\304\364\001\343_\177\326\257\365o\275\264o\237\313\0073\356\313\250H\225\264\360\256{\3318\377\316\345\262L\310\275\027\367\263q7\353u\274\307\223\306m9Lg\030\340\016\251l\304\250\220\3568\217\340\265\034\226\0361\245;\250\254\320\356\275\023\322\233:\345i\316\254\242\007WH\265\315Z\036b$\232P\033k\033\304\315\200\004z\354\fg\242\301\306l\311\016F\tO\223\250\323\246\326dK\332\202\332$H\216\274\230\006<O\213Z\223\215h\024\222\001w\306v\t\212\234\226\b\013)\243\325\325)S}\257\r?\365E[{t;Z\031K{\364\201\247\265\367\372M09\232\222\344lX\327rNX\321\260\366Xcg\354\3151\013\026\331\260\256\331\2645\245=\362D\247iM(\304\030\326\226\366\006\272\030\220\202\231\255{\220]\204\251{o\004 \017\343\371.n\332\203P}Q\350\274i-"
+	.string	"52,W\325\316\330w\375D\347m\265'\032\205\265\3152\366\326\227,K\332\022<^\r\322\371xED:_*\244\363Y_\210!\253\033\301\373\225A?\275\017\"~\206\320 ! k \007A\277\336\006\021\036~>\016\271\036/\007\202\367#\224\003\362\375r\016\006\2707\244\363\345B\364z\276\034\016\211t+\225|\372C\205\021$+\274\331\243og(\2165\241N+\035\354.T\236\256\320\034\373\344o2\236\252\316\033\013c\225dl\214}\032V\221a]{y\357\275\351\203\303\330\234\031B\2433\306\342\330Gq\225\021\215/\035n\005h\240\212\206\034*;"
+	.string	"jl\305\264\247\005aH]\370E\347\315\027\213v)A\335,\316\236c.h\300\234\224\235\202(e\277Y\027{\216=\001\346\234\354\024\234\335\354\301\336@mI\215_\250A(\244\021\244\f#B3\"\"I\322\030\260\002\031\261\"7\021p\265CdbRm\007\261\300\267\\\0379Gd6qT\3221\345\352\207\245`6\215I\301\211%\2160\377"
+	.ascii	"\333H\027\222v\202L\337\210\025\237B\354F}\374\225\310\2508\264"
+	.ascii	"3\236y%\006\bP\240r3[\327B8>\025LNF\016\326K\210\377\030\027"
+	.ascii	"$\253\346m\321\030\203\252]\030o|\021T\034m&G.4\324j\235\264"
+	.ascii	"\357\263\246\322\202\275\203lq\375\373\367-\377\236R\232\372"
+	.ascii	"p\213\1774\270\235\224f\3053\300\360'\2716\035j\305\275$\251"
+	.ascii	"\326`\305\r`\341\330\200u\302W\376y\016FV\241}\342\214d\214]"
+	.ascii	"\257\276\023\035\347\346\330\024\252\006"
+	.text
+	.section	.gnu.lto_frskyOsdUpdateReceiveBuffer.24.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\035\017\335;"
+	.ascii	"\312\\\304\024G`\232R\007\177-\216*)\363 t\2633\366\013\265R"
+	.ascii	"Y\"+:n\021\2312\341\240~\314\361Y\301XO\276F\261\367\005\210"
+	.ascii	"N\237qQ\021\212\345\371\025n\fXk\310\365\205\215\375\256V\020"
+	.ascii	"fd\233\335{o"
+	.string	")S\n8\001#\001=\001\260v\367\325\256]\355_!I\226\205\003\337<Wm\377\346\272\367-\354\253\217\265\261\326\346v\205\223B6\317s\332\253\265x\253\013\327\346\372Z\370'y4\027o\365\227\313\325<\317\304\247\372\237)`\340\364U98\213\305\330\256\276\354<[\023\374\353@\301\177\335]\270\023\377}\211\356\344.\346\255\3239\356\n\323\\\353\233\347y\271\271<\251\235^'\211\304\271\261\251\2419\032\213\304\2410\030\303\257\273\265\223\277\276r\347\204>\275\216\033OU\201\275\335\023\314}\340\227}{\263\3271\240Q:Ie\025\366\310\271,U\213\203\366\017\275\021\022D\333\324\270\b\246\232&\246pTjYE\337\310#\252\213W\242\335s\207;`\354\251C\017\335\036\273\347\227[`\354\231C\013\317\336EB%K\325\006\261O`\211\225\252\215\337\356yE\20465\034wm\307hY}\375\353\"\263\374"
+	.ascii	"s\204N\271\b\242s5\376\354\225c\317/\355v\365x\255'\026\325\020"
+	.ascii	"*\005\017\341\202\300\271R\353\371"
+	.string	"\005\3577{\fyzc\264\254\302^\307\024\346yv\355\204Z\275\357\274\3737qw\004\356\307\236\257\251[^Q\252\202\252?+\361\226:\232\027\227\334\027\343\240\360\226\276\f\347\311\002\360\360\230\310\351\235PmK\266\307\223\207e\366\376\274\f+\367\001.\2754/R\332\317?\356q\366\352\2364\2403\321\336\270\341n\351k\361\337\342V\353\374\263\354\260+\376XtU\025\177+\037\343\205\330\2345\305\237\212\213\t\316\363\323G\375\003\300\377\272v\3160\374\304\340\374\243\3329\003-\310j\352@wO\372(\262\203\251+\375\033S\b\357_(z\033\267\374ik\364ow\020K\372\235\312=@j?\271\273\210w\302\"8\317s\003\177\267oB\302\337\353_/aB\277\323\004\374\357\357?\373\002R\376\312\252Pz\273\331\246LA\367\226\272[\243\364?\230\372\005\372\336r\177\265/c\355C\257v\241\257\276+\265v"
+	.ascii	"B\355>\256\366\236W;O\254}'\326\236|\265\353\300\332\221\257"
+	.ascii	"\366\034X;\016\254\375\346\325n\363j\257y\265\323\004\265\037"
+	.ascii	"_\355\306X{\021\326N\204\265\017_\355BX{0\326\036\303\332\341"
+	.ascii	"W\373\033\307-\325D,\275:\343\336**\371\362TFK\221H\223\035\321"
+	.ascii	"F\2124\021y\210\036\323\032i\261\2430\r\206\244\275\204\350 "
+	.ascii	"WO\322\323\253+i.\r\344\2523\204\316J\234\377\b.\356 /\2764,"
+	.ascii	"R\332/\350\356\354i\310\004\037\367k\245\321)\367qw\220\243k"
+	.ascii	"\006\032\267\226\354#+~\031\026n\343~2\271)T\321\342\346q\264"
+	.ascii	"C\207\223\314\320\216w1"
+	.string	"\007\260Y\203\270\207\266\353\341\016n\342\206\303P\375\t\367p\177\221\306\222\337mz\305\234\200\247q\354w\353\332Ad\230m\315v\335\274\2122\3225\216h0\221\332j\277nrU\241\375\254\232\001$u\213\272\303\222\361\321\017\367\016\007\273\033\336\376m\0326\350w\n\355o\373`v[\247\315R\355'\1777\274].\315@G\322N\371\2570\230\022^\274\373\257yU\345v\367_\311\2615\003\347\276\030\327C\250\365\224\226b\"u\324\331k7/\"Qj\220H?\311z\336n\261\025=\340\037\323x\206\355\310\350\373\216\370\314\354]\373>\373\217u\244\337+C&\336\272\222\355\371\313\360c=\351\365d\035\254+\275\030\2461\314c\003K\357KC!T0}haBE\323\210%S\211%\212\022 N,\227\232T,\207z\234)\205\210\246\345\n&\246\246%\321\n\365euP;*\253\343\224\004\366\331\332\314"
+	.string	"\335\263\335+X\320\357\364\331\020\262\366\314\"\270\355\331o\366@[\370\264U(\275\365\1777\271\245R\336)|\023\371\376\235\361\003#\022\245\342\020\351>>3EzO.C\306Hg\217\364\304 i0_\274\240y\222\306Cs%}\247\273\240\335(7\217\227-\262\201\251\026f"
+	.ascii	"<;\236-\344B\247\255\332}1\016\320\246\372u\362\017\0353\211"
+	.ascii	"\2058u\245\257fK}g'\363\346\216\"Xa.\253\354\354\byU\235\235"
+	.ascii	"\244\"\377La&\343t\266\320\306\225\262\245\224(osiZ\306\343l"
+	.ascii	"\344\366W[\356W\313\331\310'N\232\344\340\354\277\262\362\244"
+	.ascii	"\031\350\356\0364\023\271\300\003\367\013\032\233A\300\022&\262"
+	.ascii	"MB\336\025\315\276\3310`3\320f_e\006k\314 \265\367\3624\333f"
+	.ascii	"\303\200T\321(\"\255Df\200\306\f\262\322lc\221\271\262*\335\027"
+	.ascii	"\343\350h\266\324\265\321}\031&:\213\373e\030\300\216\341\016"
+	.ascii	"`S\345\037<3fr\212\344\nJo\335\2015\250q8\350\234#4\"\242 I\n"
+	.ascii	"\222\326\241\005\304\030\351\224Y\007\021\300$\245\030R\fUM\222"
+	.ascii	"4\007\361\261>\306)\341\325\023\270\310\242\347in\251\037\257"
+	.ascii	"5X\020\322f\331~\3020r\325\030\223\214O\352g\240^:\232\262\335"
+	.ascii	"WP\202|_\340\250\217\314\224L\267\317\007U\246\333\347\203*M"
+	.ascii	"\247\217&\263\204P\362t\303\325?\004\352,|=cW\375\300\217\303"
+	.ascii	"z\0301Q\315\211\300I\214;@\341w\257:f\247~\373\377y\207\304\266"
+	.ascii	"\"\241\340\035\204(\355\255?\322\367\304(\317\002\036\272\373"
+	.ascii	"$\340\317\003\031\t\261&\347[7\200\326\212\\\262\241\201\313"
+	.ascii	"\024\030\006\032\310\276\205\003\361\252OW\222\275\341\334\352"
+	.ascii	"\3430it\002m\333?\356\354\177\001\322\021\340\322\354\277W{\366"
+	.ascii	"\237\206\2254\200\361;\343\032\375\f\235)\223c="
+	.string	"\272\306Gzd\037\324\345\366|I\302\272|\366\335\207\347\201<\235>2>\270\216\351%\017W\377\020\352\330q\032;\214\\\344\203\204\360\003\250\205\340\\KM\277h\323XPR\334\026_\306n\352o\001\302y\233\227\376B\362\217\231\210\375\232kjv\211: \021\311\220\027\237\334\024#\352Z\246\242)\3443\013\005\202\001\224\326y\353PE\313\345\324Z\231`\007\337]\023#U\254\341\270 6\353\200;\247L\376,n\326\314\237\204=4\274\320B\320\345o\213\n\347\227\247f\335\242?\024\340\371kEw\277(\2568;\372yv\306g\230\233\367\351\001\2733\3650w\317OE\034\272\215\324u:\264@\212\214\25604\335\337n\037\276\273}\370v\367A\224{\352)\213\212%\330\f(\034\362\300\224`\035\330.\214U \026\030\336B\372\260\352\031\016\024\310$\260\246\241\241z\234\016&\261\276\225\201Xd\240(\t"
+	.ascii	"!,\211\337Ie\266\235\346Kq\355\237D\254\375X\250\217)\357\254"
+	.ascii	"\361\330P#\302\374\212+)U7\0353.1q\033\367\2746\256\253\307\030"
+	.ascii	"`#\310a$\214\375d\206\023C\371DK\b\370e\237\271\274\331\203\205"
+	.ascii	"\321A\013 Q`,\315\336Df\3726\375\241\261\371\364\246\354\373"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_frskyOsdHandleCommand.26.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`%\n\0252"
+	.string	"\272S\200\022CPdR\007'\254\301\257^\035\255^v\302G\032\216\306{\341\313fP\312\342\235 \001\020\315\n1\255y\207\026\357i\274\237wDi\210\n\b\001C\001\306\336"
+	.string	"\334\217\350b\277\332Zkw\223\275\267L)\005\023\001\f\001\032\001su\276\346lRn\246\221\272dY\226\345\234=M\252;\330\243;\350+\356\236\352\016v\267Z\306G3\003\206\372\230)'\323z\006\212\262\361LHR\353kC\333\377n/s\263)\177\006i7\347\2579p9C\223\032\251\365u\201\033\261\276\252.\200\365\265\273\373B\206\251~\035\332\334\372i\341e\241\r\312\031J\304R\374\365\"\242\241\2410\bt\333\037\273\252\370\337v`\222\312\213\274\252\351D-\370\224)\223~q1}H5\332\302r\\\252\022\366\322\004\032\252\024\3248\003;d\023U\200\262-*\374-\301y\0033ke\316/.\246\007\031|qu9P=\002cJ\335\016\311D]"
+	.ascii	"\247.\313\331\272\336e*\277\265C."
+	.string	"\371e\261CI\254u\315\337H\362J]\220s\366-\310\346\253\252\203:9\245\333!\233j\002&\025<\216\346\f\266 \231\217\231^F`\322\212\025F\307\230\370\027\262\271\376o)\347\334\177Lry\003\360n\177\321\335\034\272\335\254\007\332\242c\354\030gb\035\373\327\231\036\343\363Qp<L\n\2329\0337t\303\360h\2146g\243\322\235\025M\004\356\2548\261\276:\376\245\2459\343\252~\212A\331\026]\213\232\\\240\234\321\271\361'1uR\325}\260\003p\004\261:gr\214\317\327\316\306\335\254n\320\036\325\367utL\351\206\353\332\351t\236\322\335\322\013\323\265\313y\274\2657\355p|\216\223\271\3666\235\327z\020\326\327\026E\226\263W\366E\256\273\363\016\220\021\242\362e\336\0373\222\257\001\260\2439\01338\351\036\326\027\352\206Z=\016\353v<\235N\365\032\203u\003\277\217\234\214\273\221\227q\037\340O\367"
+	.ascii	"\375M4\374\036\022~\017\201\337\302\340w\260\277\201\300o\027"
+	.ascii	"\370\335\272\337?\367\233u\277W\367[u\277\261\373\375\356\267"
+	.string	"7\320`e\351Ue\017\306\003\315[SB\271n\215\023\353nw4\036\267\303\323t\n;o\016W\344R\354\336\321\255\346m=\374L\343'\001\257\224\367ccL\345k]J \004\366\b;\233\377\222\"O*?u\362\264ax\260\227\002\241\3159k\350\017\373()\332\333~\315\233\017\353k\321\021\3666GJ\242\225-\315\340\334_\366\311[\240\351\304%\223\033\364\247\352\247\215\225mQ\327_\026\210\375\235\362M\336\326\013\210\327@oR\267\3123Q.Q\262\242]y$\257\323\305\301\350[+\366G^-\016\336\261\347z\273$\221}^\336\310\353lq\220\r\032\351/\314\023\321:\016\341\363\232}\326\017\007\311\3208Y\334\375\212\371+\023\n\232\037\336\b\342\304[}\225*\027\3423\213\203XnR\021^\250\217\320\b\347[\261\233\346\346|V\375\264U\334M\302\007\231(p\327}\302\005\2450j\346\234\225"
+	.string	"y \025\335,\\\274\037]"
+	.ascii	":\366\351\027\356\207\251Uq\t.v\226fOvL\351\326\2569\023\213"
+	.ascii	"\2610\317\367\230\374M\317\325\356\274\345X_1\366\267)\377Ss"
+	.ascii	"&\366\361?\223\034\217I\351N\017\261\371X)\217\007O@\240\244"
+	.ascii	"T\031M\305\033?\232t\374d\340p\302\355TA\206T1\306\017\033RQ"
+	.ascii	"3\210E(b\016\250&\034D\247()b\005\004]\324\361\024E\344Q,F\021"
+	.ascii	"\203\320*W3\006\353\377\255\370\207\302_\372\263k\236\264\245"
+	.ascii	"\246\246\376\222\004\036\237\332\033\321\1779\021\326\352n\""
+	.ascii	"\374\330\252}\215\373\367\2519\347\\\204\303\346x/\271{\226\253"
+	.ascii	">}DK\337Po8\354\020\017\341\356\227\352\265\352\340\344\241O"
+	.ascii	"W/\346\315j\307j\274C"
+	.string	"\206\360\n\350\230\344\315hh\360c\367\253\365eo\021\017C\354q\366L\217I\252~\332B\334\375n=\230W\313\203;\347\333\365\305-\371d\257\363\273\254x\217\264/\022\326W!\016F\243\316g\0015t\332\f\341\260\036\223\241\357\214\316\370|\2556w\205\034B\261\301<J^\013\024\005\345gy\273\304\202\330\325\370\004,:\3513\216;\232\267w\346\220R\241\205o\367\301\266\267\036;\241=\356e\276O<\316Y\bBJ\367\2600U\260\302\267\263\275a\001\200\326\250q8\004\225sfDd$I\222e\f\240\002\231!*n\003\021P5SN\215\266\311p{\260\016\233[4\031\355\350\276\017\213\277\304S\365\b\340S,!\002\337\370\177\022d\373\177\0258a\207$\262\302P\232}0\262\035sl\213yV\320\223\376MA\224\b\352\031TsA\230\254\264\340*\235F\230\322\324\242\345O\351U/\203GK1"
+	.string	"\245\360/&s\220\371H \026|9\325\025\254YT\003\301omS\242\3509\266\357\324>\n\377^v3\224K\t5\031\022\335\023\301\266\222-\336\317\246X\317d\324\025\201\357H\344\214\335o\305\262%\244\026l=h\221\344^\006\205\354\312s\024\242\266\247\235\230\313\221\254'\212\202\347\024G\005i\3758y\344\254_\004/=\016RW\267{\357\350\245w6\232Q\310\360"
+	.string	"\bq\224\370W\256f\211E\030\300\376B\336\2458\t\207@\262\266d\253L\205\325\270BG\200L\203<\375\300\267\332-\276\210H\221+c\375/\305T\360\216\22202\023_\357\013\201\204{\370\332v\276\306\236\007\b\361\322\352M\374\343P\357S\207\026M<\365\022\254`B\023\030d"
+	.string	">\306'm\020t~\251m\327\277\354\032(\266\352\002\317\227\361\342Ae*\235\363\3525\300\013\247\375\315*\013\243\001\020\345P"
+	.ascii	"\206\023w\003\365\231\305\362\"\271\215\237!\321\321\327\036"
+	.ascii	"\235\223C#\233]\212\025\336s\361/:el\233:\026\231\300\265Q\""
+	.ascii	"UJ\201\341=\261I\306\363\f\3543j"
+	.text
+	.section	.gnu.lto_frskyOsdDispatchResponse.27.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`P\003\305\026"
+	.string	"V*\224I\300\324Qch\306\224\200\247D:\212\377j\371\004f\210\335z\243\215\234\017];\366\021\023#@\256\253\346\345\361\231}\031'\261\0174\243v\311\214/\216\243\371p\024\202)mS\342\335\177\320\001Lh\017m\203\244m\271\245L)\177"
+	.string	"q"
+	.string	"\204"
+	.string	"'\372\n\235\233Vr\361\230\b\204f\351\273\367.`\335\272~2\336\2127\031o_\326\\;\346\315\251\b\217J\224['`\335Z\245\201\216k7{\271\325\007(\037\026T\367\232\257j\342\265[\261\322\232\277b\371]\364Q\rq\272\235\333"
+	.string	"\272\233\350\272\367\376\354@E\226\210WQA\024\r#?OA\350n\342I\016\005\356\277\323\037\035\017\245+\226{\257)N\027\342\036o\033f\333\201]{\001w\245\305]\324\370A\267\226\335\320\343n\306\333W\f*\230vCD6:\264\315\033\255@\366\305[y6\371\340]r\363n\275\274\255\251\305\221\272Zj*R_"
+	.ascii	"\004\246\035\t!\"\265\311\274\271!\222\313d\223R<\370\227\277"
+	.ascii	"\371j\337~\221\177\232\f\322(\b\235Vnt\240M:\347E\266\245oW\336"
+	.ascii	"{\311[;\307&o\251\255\343\017\375g\322\001\274\240]"
+	.string	"9ek\243X\r\224%\214L(\255?\272\r\027\3333\364\335k;\316Oz\215\f.G7\324x[\253\375\002C\217\023\253\253\247\356\270\244\326z\262\322\372\200\352Ly\253\222\265\202p\330\263\273]\306\221`\004\234\202~^f\274-\251?/&\t\205?#\336;\0225C\254@\257'\212\316\245Z\201\214\362V\275\021\321\257\310\217'\036z\304\257\255\372\030>I<s\0304\006=;\366\0274\007\234\356\r15\260:c\023\223\231\265hd\324\260\224\030\034\331\013\215\006g\246\341%\213\275lb05/\330\f\347\225R\300\262\r2\263\027\007\231l\366\"M\333+\317?\037!\347\301\007I\374k\343(T\345\203T\257t[\177l\333\372\337YRRQUQ\266z\233\371\020\332\223\020\336)\341MA\200\264\200g\313\204\373h\351\3014\025\244z\216\037h\013\347\261C\307\212\027\364M\331h\343\201\276\360%\332"
+	.string	"\240c\307A\003\240w\243\006xZ\006; \260\002\231!\253\003m\243\340)4\247e\350Z9\033\214C\330\341\334\314\335\203!\235_\350\027\035\237\007C;O+s\202\307\375\227\005\t\201f\030\334d\213V[PY;\225\356p\341\005\343\374\322\306\324Np1v\3400\266&\235\r\033N\270\376I\330EQ\244\321K\020M\3603oKlVo\302Zw\242OG&%\034\253\271n%\266\023E\342z\020"
+	.ascii	"9\321\001#\n;\302bst\327\032x\260\f\005"
+	.text
+	.section	.gnu.lto_frskyOsdClearReceiveBuffer.28.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\204\002\255\021"
+	.string	"\346]nH\360\316\2521@\230\333B'\202\263o\"\t~\021~\324\330 \031F\236~N6\331\244\276\360\340\023\227\373*\206\312-UK\206\027\350\316\375\177\376\247\201\323.\262\025\312I\307\274e\246<Y\224xI`Cfo\271\245L)X"
+	.string	"S"
+	.string	"\\"
+	.ascii	"\226\206\254\262]\234\006\273a\254C\313\246w\357\025\353\207"
+	.ascii	"\253\016\332\257R\225/;\201\235\223\2037\317qc\355B\224*\267"
+	.ascii	"\033e\206\317\300\2757T\246\320\017@\251\362\372%H\351y\330("
+	.ascii	"Q>QPk\305e\247\032J\026\245\341\202{\257\251\253\344p\207\267"
+	.ascii	"}\262\215\300\246\273\364\256\021\360\326\326\237\247\263\230"
+	.ascii	"K\313\214\271\242"
+	.string	"3\fR\333\302\005z\227)N&\307\252'6\215E\353\213\375\357\326\227]\251m\245\276\310\203GG\322s\357\206\0312n\316\342\304l\337\247\375,\371\314a\t\226\022\37337M>s]\321\211\271\265M\354\320\003\346\351\354\005\3232\343\375\266\222\003\262#\370\212\201\246\205\035\362\021\343\001\230]\372\315\324!\342U\243\225#SYb\247\356\023@m\221\221\b\007\302>7\246K\255/\366#h\353e\037@\343s\276\330\261@\241A\376i\322m\243\007\354t\3515\023\307\317\275WA\315mN>\314\255\311\221\036}DH\221\020HL)\224\004\221,\211\023J\"'q\204J\211\037\005LR \241\304\n$\211\022C\264\325\353Kv\0060h1\200V\225\005\206|7\252\320\275l\r\336\203K\241Qc\363A\300\233vp\024 'xx\265\336\203\357\350\344\204\257Z\f\357$~\323\244\343\214\035?\246K7a\n"
+	.string	"\273\t7 \320\002\231\251\262\003\002\003~\222\306\350r \330\223\021\033\34025\256\203\351\332\234\303\211\343B\016]\354\r\366\020\365\301\230\271\303\301\374\3622g\224\253\210\331\004\267\037Se\350"
+	.string	"\206\314\004j\374\301\332\215;@\3121\003\226B^\231\035\177\212\307\356s"
+	.ascii	"\235X\266\306\327\245=\214E\323H\270\335\342h(\202\204\006_#"
+	.ascii	"\374\3532@&1\231\020\303\324%[\3735\004\006\005"
+	.text
+	.section	.gnu.lto_frskyOsdSendSyncCommand.30.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\254\003\345\032"
+	.string	"v\362\260F\220^Qc\f\002N\270"
+	.string	"\2357\377\352nJ/\343\022]\376\360\227BY\310XF\377c\006\303\332\253@\242jZ\223\273=\327\301\276\277\033\020\t\020\\ \006\b`=3\023PhL\212\357p\334\315\335\366\336R\246\024\237"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\346\272\200{\177t \240\237\221\037\313\367\220\037m\353\245"
+	.ascii	"p\266\367:eQ\271\027\205\340\006\345G\t\023\214\234;\032\225"
+	.ascii	"\004K\222\262\001\345\315\275(\315\nqi\230\315=V\302L\362\034"
+	.ascii	"E[s\276\3561-\245\246`\215Z\376X\312q\230\f\t\323M\035\017^A"
+	.ascii	"\022\245\246J\"-\345\370)Z\230b2\344ZJ;D[e\205u\372\220\352\370"
+	.ascii	"\340\027,\031\003,#\3641]\304q+:\350\252\342&\200\217'\316\222"
+	.ascii	"\214\364\236\276\336\360\355j\205a\270\367\272\366|K\367\316"
+	.ascii	"mo\261\255\301\2665\002\026\312\376\201\364L\224\355\3176\253"
+	.ascii	"gfu\317\257n\331\243\374<\257\372w\216\376\347\245~"
+	.string	"\323\325c\254Zt\265\215UW[\375\002\227\203\276Y\203\343\2727\351k\316\0053Z9\362\253\337\276?\345\251\355B\227\020c\363\245|h\237\206q\241-\026\2317\367\336\023\206}~\254\266\221\037\364i\373\352V\352\224J\253T\330u/\372\340\243/\220O\016\305\350Qn\242\354\362\2004\251P~L \216U1\b\310.\017\250C\202X\355S\335\211\321\321Co\270\027\034\202\250\2419\274K\207\001f\262f\366\303W\251#ONST\036v\2764\331\2554U\302\221\307V+\263o\203\344\264\253_\366\2516\210\020\365\275j\037|\f\t\234'8]\342S\0215\033\333\n2\264\307\221=V\005\020\r\257\306\361S\217\270\026\234\0013\251I<K\t\236\250{/\205+\307b\302/\362\321'P\324\367P\220\037{\354\3233\360\r\273\234\246\250du\307\236\366\326\376\001J\200du6\355-\r\240\215:G\365\313"
+	.ascii	"\252\315\242V\337\363\2037\275|\201\331Y\235\215\356jA.\204l"
+	.ascii	"Q\f\233\320P\255\b&4\243v\023\177\212~\202\304\240! k\240\bA"
+	.ascii	"7[\n\031-nD+h\266\032\315E\355g\210\006Dt\243E\360\261\355\205"
+	.ascii	"\020\021\255\310f#\242\235\350\321\355\317$\027\027\253\264|"
+	.ascii	"\230?\370\017\\\251UJ\3769r\2647\2541\034\331\335\220\230\205"
+	.ascii	"\262\314\212\366J\200Y\274\032G\264\001z0\375\342\275\367\226"
+	.ascii	"\024\264\270\020\201\025Xbsd\332\237\237#\255\255j\024T;\347"
+	.ascii	"$C}\317\332O=\355\254\356>Sxx\221\026\312\277\r\362\370a\235"
+	.ascii	"\366\347\3618r&`\313\313\207\327\326\231B\250A0\242\210D\206"
+	.ascii	"\221@h\202\021d\220\244\003p\002\221I\325\003\020X\311\264-\214"
+	.ascii	"\001\302hM\245\016\235^\032\201\177\367\bj\3636\003\270o\266"
+	.ascii	"Z\013\n\007\351d\272\302\003P8\233\206\347\324G2\257\332\367"
+	.ascii	"\351\266\300\355\003\005*'\271\035\3536\330\346$\035>g\373\220"
+	.ascii	"\266\020\330\211\343~\261\251 S\251\030\240++\202\b\272\204\217"
+	.ascii	"\f\343X\234\004\355\345\3409wA\337\220!\327\227\025\334#\344"
+	.ascii	"\315\243\ns\220\373)\217w\206\314xD\250\371+\344S\254P\003"
+	.text
+	.section	.gnu.lto_frskyOsdRequestInfo.32.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`U\002\325\023"
+	.string	"\266\244\202I\300\224Q:\350\230N\247\002\211T\354i\246\243\321H\225\256\037\331>\273\006[ue\025\033IT\276\366\215\205\272\361-\017k\317\313\243\207Z/M\230o\334\262(\212\005@U\246\274q\263\207\331\210\267\347\367G#{\223\275S\nj"
+	.string	"f"
+	.string	"q"
+	.ascii	"\3627\257|\241\017\311n\253I\315tRF9\212\364vq\nN\255\222:5\360"
+	.ascii	"\224z\372\035\245\236Zf\0339"
+	.string	"\356g\301 \"%tO\273\313\232,.{\245\337\2242\377\267\233\210\265\331\253\252\226\342\024\305?\022\273\0339\277\004=\035INj8_JN\013\361\267K\0235\232\224\340\204\335\265\024k'n\360\266]\266\035\330\022(v\bB^\2543\200\212$\036m\316l\034MN\037\373s\034\307\321\263\307\256\322\252\333\356J\245%\225\376I\201'!#\226vs\306\250\345\321\035A'\372m\227\366}\243\357f^d0\352\307\214?\343:{e\232\027y\356D\305\330\335\325q~\256\301\003\331\211b\251u\001\326\bj\352\355\"1H\235\3324\366\3524L;\263\274\307\005\036\252\371\335\021\324\216z<C6\024\371;\251\276\3509\f\035n<\036!q\301}]\206\026y\321\327\235\305I\007\252\2073g\376c5\367\003;NOHl\344\370\037%=\2449}\\\347\347KN\351F*\261\355r\0345)L6\314o\264"
+	.string	"\374\354.\004\033?\342\340\003\235\332\025#/\306\324\323O\n\303I\206\315F\2166\221\0012\241\013\366j\211"
+	.string	"gB\231i\230\025\r\260\260%\026\003{m`\205.\226\214\313\305\003\013\346\005c\255\fp\370\241\365b\205\b\303\027k\205\263\371\267\263\347\366T\020(\236\315\244}\273\2735\366\355\256\220\320#\222\243\345\004\242\324J\372t\342\021\220\3515\265N9\237\273\312\322\022\332\022\r\036\032\025 \375\035\205\ns\316\"\360\232^|\217U\325|\311\r\371\316\026\356#F . p\002\221A\304\007\362\320\020\007\234\312\034\\y\253KAk\267nI1\3161F\222Q`\271\007_p\033\002k|\212\202\036\241\340\236qR\277*\356r&\351P\2748m]\216\013\301U8T\260G$v\324&P \200\233\030\fFLX\341\030\213i\322Bi/\364\375\035K"
+	.ascii	"V\001\352H\\d\341\373\266\305\231\205\347N\006\030\n"
+	.text
+	.section	.gnu.lto_frskyOsdInit.33.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`W\005\325\035"
+	.string	"&\266\276H\220\332Qc\213\242\025n\205F\301a/@y\314>@r\302\022Y\3203\nL\020\232c#>{\230\026\320\034\315I$\377\3231\230\032%\201@ \006"
+	.string	"\020\327e\022\031\326[\365\026\320\353\344\236\320f\331q\357-eJ\001\242"
+	.string	"\241"
+	.string	"\261"
+	.ascii	"\266\265\260m7\253\375\343W\331\346\017\317\344\347T>\002n\327"
+	.ascii	"\375\317LX$v\357\020\302M\333\2407=Dk\265/u%?_\342\302\264{{"
+	.ascii	"\024\241\334;\214\340\007\350\315\005'p\336,?\340\274i\333\023"
+	.ascii	"l~\234~\330t\364\247"
+	.string	"3\241+\262{\2077\313\364\364\247Y\332\232\372\274\237/\276\254\202t\364\372\312\372\331\270\211\332xY:H*\242\005\340\347+\rpq\002e\373\275\250\266T\340\265\005\365\342\253\321\317W2P\342\241\365\252W\242_\257V\232\233{\257\353\320o\306Ms\333;\266/\330fRg\036q*$\320{}\024\374);9\250\323\315\333\027on!\031\221,\001\252\311\372\353*\262bm\320>'j-\317\352H\225\027_5\343\232Z\336\373\023\247\215CQ?\204\332W\375D\202~\30321\237\345\331\303^\265A\3736\231L&m\201\366\211w\355T7\352jK\253\256h\365\017\374\312iI\351)i\277\206\367(iv\271L)O'\376T\367\237\374\250\342Z.\303XQa_\335h\333\334\342Z6\177\200\035\353Y^\361&\266Q\254\220KR\367^\333\255\374\"q'%D\272AW88\005\232\204\274,\035\022"
+	.string	"\314\351\323\311Ra\231\2547"
+	.string	"\212\2112\362\261\243S\250#\323#d~|\003\340\223($\037\203#\026\006$\246I\036\006\314\027\232\0251\235J\225\034,\235\372\342\202\304\"C\236\3537\272\302\265xu\321"
+	.string	"\261\242\220\3079o\264\205g\301)"
+	.ascii	"f4\206oe\250i\272\367R\270r,\032\354\r\034\352\2078\2347o|\225"
+	.ascii	"\002:-I!\275\005\254F\220i\203\2678n|)+m\320\337\2355\233\240"
+	.ascii	"\210\211G\306\313@\365;\234\366\036N\032\337\375\207\363v\037"
+	.ascii	"\304\371(\257\326\016!\242~\250f\313\213\303\362|[\255\035\023"
+	.ascii	"\n=\272\034Oy\002gb'g\241G\227\343\251\245\320\351\331\371t\310"
+	.ascii	"\351\224\300\261\2609GB\211]n\204\017\212\235\316\304-\207\273"
+	.ascii	"\355\340H\244\270\345\350v7\t\b\234\343\321\321\335zr9\335\315"
+	.ascii	"6\004zy-\320\257:\nF\030\204x,\253\214\277x\232\223p\007\361"
+	.ascii	"h\376\351i-\221mk}\003d{\345\275\367\2366\325No\244I\365C~\361"
+	.ascii	"7\302\242\301U&\326\263\2743G=J\215L\344X\315\352\250E\273\032"
+	.ascii	"\"\323\207,S\332Qc\300H\203U\250\006\321|a]\316\243\372\322\251"
+	.ascii	"\004>j/\rV\240\312C\206E1=yv&\025\232Q\021C\006\344f\002\\\250"
+	.ascii	"Q4H\025S$\"\"\201\302\242\024r\300\")3n\020@f\204D\204\270\r"
+	.ascii	"\224\023\314\316\217p\307\202\246}\345\205\373\243\022Z)\276"
+	.ascii	"h\3768\324M\030c\232`\003!r\221\205AI.\021^\267\266\355\245\361"
+	.ascii	"\365MZ\257p\304t\231@{\031j;\260\230\"T|\317\t\021mc\3220A\374"
+	.ascii	"O<\363\315\212\357,\030\021\325\237\345\273K\375\347?P\035&2"
+	.ascii	"\342?\314\253\345a\263m\341\330\304iYzph\310|\221\004\214O\361"
+	.ascii	"h\262\206\016h;h\310\375\200{\215b\007O=\356eo\247\305s\201\234"
+	.ascii	"\333\213\371V\336\307V\0267Ms\024d0\016\260\030\234\314\177\224"
+	.ascii	"\274\252\032"
+	.text
+	.section	.gnu.lto_frskyOsdIsReady.34.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"m\007"
+	.string	"\202N45@s\322\001\230\266\317y.4\351\274\211`\214\241GI\257\027\365\220\350\320\255!k\3633:{\234fe\256\204K\201\024\220\243\300I\314\001\254H\177\262\211\224)\005\376x&.\030\021\262\270\254\212\007A\017\003$q\361>\326\365<\007\206\031\024\326\323\200\320z\034mO\255\202\250\"\220\264d\277S]Uo\222)1|\345Z'`w\035|\226\267l\370$w\346\b\345\343]\276\3344\325\035\301\r\252\273\253"
+	.string	"\f)7[\033\245\206\330\247VAl\2475\323\247\006L:\262\307\232\335\323v\2633.\346\304\266\310\346x\241Ad\354\332\310\251"
+	.string	"\245\304\344b\263\253=\0259\366\304\374\253\034\342#n1\033=\001\036v\327\0313\217[o;\301\266\202\355\224\t"
+	.ascii	"2\241u\037x\304D8\254\302vML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_frskyOsdUpdate.35.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\025\t"
+	.string	"\266\320>: \005)\035\340\030 \b\026X\253\002y\222XL\247y!\rxLX1E\tgB\355\327\357\227\360\b\030D\271\205\032\001\003"
+	.string	"o\203\201\356O\023 -\264\207_7\262\245L)-"
+	.string	"-"
+	.string	"/"
+	.string	"\"7\035j\232|\001\357t\330\361\270\302\204\226\213\214\300K\301\202\231\353\343\257'\313Se\006\200v\327\271\362:n\355\266\027l#\330\226\005v,\225\032b_\277\357\373\254 \366\323\327\006\\\033\336Y2\273\034_\200\235\321`Jl\337c\223m\363\330\310\032\230\240h\264\334\354n\3244,/3u\211suX\251Q%"
+	.string	"\333\030W)uvW\301O9,\303'\271\346\021)\277\272\346\2238\327\256\177\035\302Z1'0T~\001\016}\036\272\215a$\321q\021q\023E\nQ\303D\fq]\374\034x\253\200\340\342\305\266q\321\023C\035\204\322\024\334\335\205\235\264-\272\374\312\252\247\f\016"
+	.ascii	"2\003\352\fO^\330\252\202\200+\200j\037\244\250\210\013\350\020"
+	.ascii	"\216\\\206~\031B\\\272\246\232\246\201)("
+	.text
+	.section	.gnu.lto_frskyOsdBeginTransaction.36.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`}\0015\017"
+	.string	"\326\333dF\360\320&\035P=\325\326\033%\006\307b\233\326\033\333\361\266\335Nfl\323\366\330\323\235\206\rA\272\0137!N\272\255\"r\231Z\347[\360\331\272\370X\034\226\236<\243\344\347\237\260\341\005\207\277\375m\333&[\312\224\002Q"
+	.string	"R"
+	.string	"M"
+	.ascii	"9vw\323\017G=\0245\250\211\362[>0\236\034/\365\320\353#\225\307"
+	.ascii	"z\f\225\304\036 F\307\223\343\261\256yx.0dw[\022\212XWX`\306"
+	.ascii	"\002\207\207\307\002AV\"T\277yZ\360\272\314P\311\356:U^\206["
+	.ascii	"t\333)\333#\366a\001\243\222\214\025\214\367\0133vW_\320\322"
+	.ascii	"\320Z\214\210]\026\"F\303Q\374\245r\227\325\223\231\210\251\331"
+	.ascii	"]\3225[\305&]K\222\355\247\375\232\237@\335\206\202G\273\035"
+	.ascii	"\202tv]#& \272\026r\220x\r\376#^3\312\356\271\213f\005\224\200"
+	.ascii	"\361\222\"3\027\020/\331\013Mgp\236Z!SI\036`v^r\247eE\002\306"
+	.ascii	"T\265#H\310\253\f5u\032\240\231\216Z$^\025\300l\260$\220\177"
+	.ascii	"\221\250z5\320\352\351j\310Z]~\266\253K\235\261\257\337\367}"
+	.ascii	"V\031\3736\277j:5\375\247\024\024\016\272D\262\340\304!\230\340"
+	.ascii	"\340dj\260q&\333\003\223\004'[\311t\332H\006\230Ca`\332R8\316"
+	.ascii	"\264\221\\+\207\25327\027\341l\230\375\314V\264\203\273\273\241"
+	.ascii	"\257\370U\034\300\353\365\344\020;\322?\211\276o\304\217\333"
+	.ascii	"E\364c\034\204\307~\300\007\303O# \220\002\031\303v\"B3\247\200"
+	.ascii	"\245\216\367\226X\266\307\245\312\350~\267\311\261,{\242\211"
+	.ascii	"y\350\303\244\335NX\250\025b\251\035\244\233\210\327\366\201"
+	.ascii	"\0358\212P\270+\321\234$\215m\020\237\246\003\204\212\263\334"
+	.ascii	"\355\t\016\342\r?/o\f\032\303\201\002"
+	.text
+	.section	.gnu.lto_frskyOsdCommitTransaction.37.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`P\002\r\023"
+	.string	"6ayI\320\362&\035R\t\220rv!b\250N\250`]\213\221\266\f\354\342\253%\326_\243\215,\260\331\325\201\2422\315(\364\251\264W\322\032\305$\320\301w\321\212f\220k\2616s\357\rF?\320\032\300\325:\372\021\215\220-eJ\001g"
+	.string	"\\"
+	.string	"h"
+	.string	"\2722\215}\343\266\241iB\304\213\345z\3149Y+t\232\253\300O\256\322\370!c\315U<\007%\212T\323\016\2211&KvH\310~\313\321\017\202O\016\007\2654\362\\J\224\237\247Y\211\f\0216V\343\215\256D\020\004\304\023\031qd\002\247\030\261\037]uF\230\252Je\316i\225\215\036n"
+	.ascii	"\267=c\233\201\255@\001J\031\374\021\377\374\212\321\313b\300"
+	.ascii	"\177\337\037]\346\350\351\031\325l\264g\333`\2724\373"
+	.string	"rn\220\275j\220U\253\244ZJ\365J\265\256\372\001\n\350`3\224\210\246\026\3126wz>f\214oW\302\366}\333o2G\362uH? d\354'\2756s$\207\370\234(\232s\256\376\255\376\0059[\263B5CP\337\322B0E\270k\372\314'W\244\303-~\260\370 \227\346\r\240\\\027\256\306\256\256\334\307f\003v/\340!\250Z]\223\027\261\035L{\r\256\013\025<\260_\316d\341@\324\222X\202B\265\237\365\364x;\305\2011\215\366!\370m\301\321\270\321)\333\255\233\bO\242l\230\347\304\221\2419\247\003\334\003vI\241\360\022W8\204/W\005\226\330b]h\261\300\260\\\\/V\212\001\213\030^\\,\r\242\350b\255l6\337 \253\330,LE@\375\233\204\t{\035\246\251\020\340\322T\034d[~s\353O\341I\324\3150w\022G\\\200\354o_0\352\244~\222H\324_\001}\343"
+	.ascii	"I\356\025\240_cq\321\313\374\332#\360\350\300\223\n4 `\002\231"
+	.ascii	"\252\343\003\342\200\325C\256.y\273W\2446\376u\tu\034\254\237"
+	.ascii	"\230\303\266k\032\027w\351I\226\274\246\307\237\033\253Y\030"
+	.ascii	"\tF\326\361`\023$\254\367$E\334\225\333\331\256\274\r3V\314\366"
+	.ascii	"\350\255\240\230Up4\204\266\344\374\032_@\323\313\236M\314\255"
+	.ascii	"\002\275\204\2031\035d{\320JAr\212\310BB\261\350\350\241\335"
+	.ascii	"0\367\036\205\306]\341\341j^\315\262\360\036"
+	.text
+	.section	.gnu.lto_frskyOsdFlushSendBuffer.38.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\245\t"
+	.string	"\206\221B< \005)\035\340\334&\016\340\320\033$X,i@\244\277S\350\370O\016\344\361\006c\305:\333\377\231&\341\021\261\260\251\313\267|"
+	.string	"\003b\024p\344\255C\235\b\f\035\324\2535B\344N)/"
+	.string	"1"
+	.string	"1"
+	.string	"\032~\323\031\372\207]@\034Q\337\002<\256\233B\331r30\256\266\002V\211x\330\347\306\250\232\263\323\260\273\236\342\330qs\267\375`;\301vM&QSE\354\377\365\362\202\261\266\354O\237\013\315X\034\343?bvY\265"
+	.string	"+\303\271\230\330\276\307\241ms\322\265\006' \032+\263\335\355t$\f\003\245\272\304\271J\250\320\254&\315\266w\262\2040c\203O\301 p\355\356B\354\262\f\237\344\234M\247y\361\234\177\342\234\273vF\2262$&K\315\232\003\006}&@\017\3024\002\277P\347\211\272\nQ\004\251\003}`\3679\260gA\361u\027\236\367u\036r\257-;\240\220"
+	.string	"\312\224\2526\317\264G\244y\321\252(\006\027-\017"
+	.ascii	"3\003\3569\004k\340>,\373\323>\210\242!\006+xa_\202\336f s\031"
+	.ascii	"\372e\b\340\362\305l\207\006\246\240"
+	.text
+	.section	.gnu.lto_frskyOsdReadFontCharacter.39.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\221\002\315\024"
+	.string	"\006\347\212J\260\022R:\342\261\320\026\030\273\316\241\222A"
+	.string	"\322\322\253g3bF\005p \334\321\251\374\245\242c\332\236e\t\364\327\037\321v\240\220\031\363QX\357\007\365\007\375\007-qN\2229\327\016a\347j\33025E\177\023D\b\331;\245s"
+	.string	"o"
+	.string	"y"
+	.ascii	"Kct\243R~\364YRj\337\367!\333\177\t\034\262\273\323\202i\367"
+	.ascii	"d`\005\345\307\326\013\220\037\305\017 ?\3326J\212\315\267\237"
+	.ascii	">;\002@\277\032$\036\273\247\253\206\370\355\243X\351\315\307"
+	.ascii	"}\204\320\273\021%\225\304\353pQDI\342)\211\220\3001\202\305"
+	.ascii	"\243\241u\204\247Al\355\356\205\2476\274\031JAVv\327T\307\313"
+	.ascii	"\271\311\333\236`[\202M\251\0029\304\372z\341E_o\306\214\024"
+	.ascii	"\360G\216\016\355\023Gk\217}qw\327\225\307\376\321\315z\321_"
+	.ascii	"\376\367\213\246\256#5"
+	.string	"\035\251?\342\342\333\335\360\356a\270\273\033^-\324\330$\342G\177\360\324\266\371H\027\232\345\2278\320\366 \255\225;\027\007\304H\347dzP~$\241?\272\265p\347\356H\020:U\276\005\037\335\240\254\347\211l/\252\225\220\004\270Z{|#Y\265\204\303\016\"\035Q5h\250\017\3735\362\205\223\213\343\364l\004Y\t\240\325\352,$\275\235\310']\370r0\245\243\367\n\322\206\265\320\353X5\300\006!\250\036U5\025\347\262\332.WQkJ\021\202S\372\3710\244S\207\303\323H\033\346J4\004Sv\314Q\310\210\370\354\256\212\211\237\220\371?\037\215aF\257\373\350\317\310\217\317\351\321\b\262z}\360\327\005f,\366\022cd\324|\201\325\331\254\305\214\305^,\346\353\005\006\300\260\223\330L\306R\213\231\231\024\\2\030\227\005\230\227\214\013f\316\\'\007,\273\320b\2722\310d\246\213u\356\305\255<O\257"
+	.string	"\004\003\270D\377\364\013_^\0019\001\227\304\377F\326jS\275\222\2533\246\211\273;\021\036\374\253\212\306\332\343\024\026BA\261\362\320\372j\032Q\311\240\231\304\2201"
+	.ascii	"E\253\t\325/G\207\247\273\033. \220\002\241\241\r\036\345BG\b"
+	.ascii	"L\346\303\205\222 (\306\231j\246\272m\353\002\003\327P\217\306"
+	.ascii	"\375&\207\205\354\334\003CV0\316\301X\005n\031\333\\h\221`y\334"
+	.ascii	"@1\f\262zo\312h\335m9\333\352\303Es\262-\002\263g\002j\2521$"
+	.ascii	"\266p\362\333\255\260\373\342\365\233Xh\2670\3601P\256\316\253"
+	.ascii	"E&\267\326\350\001"
+	.text
+	.section	.gnu.lto_frskyOsdWriteFontCharacter.40.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\004\001\255\r"
+	.string	"v\032`F\340\2228\035R\266\305\263:\3620\023p\350\264\252\240\350N\322"
+	.string	"\351\241\356X\212iu\246P\341UP\f\247M\247U\327\242\203\342\301\002\274\376,\2061\306\030{\375LR\353\264\006\347`\326A\242\022#D\233\354\235RJ"
+	.string	"K"
+	.string	"K"
+	.string	"G\001\336\245\343\315\256\312\214\030\273\243\307\013\264W\005\347d\257\330\rd\257\266\335\340\001\350\360#K\352@K\013\005\323cw\334\350\210\207\237\241\377\362\230\t\224\231\032\254\030\325\351S3aw=EU\207\233\336v\307v\004\373\036\002w\371\353\311\237\326\351oJ:R\034TO\201\261\233z\315\254L\225Q\342\253\337\006\375\322\001\374\025\207\001\277\032\371n\330\215\215\226\033\256\335\023\006\257\206\240\275b'\347\220t\274\n\360$\t\202\002\253\341%\004H{\365\250\315i\377D$\007-\321s\273d\232\027\335a\341\220A\321\223O\355\220\227\"\224ewA\027sTz\2521I\341\201\372\361\027\031\276\267xL\347\223\360\313\013\276\370:\377e\257"
+	.string	"Pv\274\260\\\200(\231/{<M*\302>\266\273k\272b\007\334=\020\216~\037\311\033\215D!O\004\302\t0\367\031}]\210$\344\363(l\235i\253`\022\211l\234\367m\237\004\356,\220\274\rC\327y\333\270\307\226\256<\314\006\254R|\360\341*\241&\036\301vU$\270\310\3712\201\251i\235\313L\3364\262\263x\031\023"
+	.ascii	"|#\332k\340n\273P\321\f\323k\215\b\301:Umd\360\026\363\354;\327"
+	.ascii	"\300\250\211\022\\\274*\034\026\210\005\34175\005\356!L\315\201"
+	.ascii	"]S\017"
+	.text
+	.section	.gnu.lto_frskyOsdGetGridRows.41.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\2336`@@\026\234\262\377G\3054\240\025b!\332BA\373:\210\3117\237\243\262\3336\315x\251zvk\222FE#\274\225\263X\325\207A\233\310\235R\366t \260\351\220}\260KBNKNX\017 \351\2710\3319\360\244\210\270\244\305\234\227\334x{%\251r6\315\360U\365\242\032[W\371 \224l\320S\246\301\207+\216\202\021\224vW\341\344\336\205\017\362h\214\f\236{\3643\352\361\032`\262\301\317\366BP;\354O\253$\033B\353\241?\t|0\335G1\273\033\037\315\272D\226\020\333\232\275\361GN\242\271b\320\330\272J\204F\2642\263\353I\316\013\250\307\351\003\324\243z\\;\324\374\227\274\341e$\303u\241C\200\205\3355\344:\216[o;\301ve\273%\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetGridCols.42.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\033\214\035"
+	.string	"\301%\257\354\377Qq\033\f\353\202\252!\034>t\032\315\344\233\317Q\331m\233f\274T=\2735I\243\242\021\336\312Y\234\366\177\320&r\247\024\376x \260\351\220\201\260KBNKNX\017!\371\2710\3519\360\244\210\270\244\305\234\227\344|{%\251v6\315\360U\365#\033[g\001!\224\354\320W\246\201\347\212\253`\004\245\335UH\371w\341\213<\032#\203\347\036\375\214z\274\006\240l\360\306\376DPA\354O\253$\033B\353\241?\t|pt\367`v;njV&\272\214\330\326l\216_r\023\315\025\203\306\326U$\033\243\026\232\335Ov^@=N\037\240\0365\344\332\241\346\377\344\r3^\f\327\211\016\001\026v\327\220\353<n\275\355\004\333\225\355\227\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetPixelWidth.43.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\033\214U\204\031\223\300T\035\025\267\001v\362\017*\206 Iu\032\315\344\233\317Q\331m\233f\274T\r\320w\273\313\321\b\017\344|N\373?h\023\271S\n\366t \260\351\220}\260KBNKNX\017 \351\2710\3319\360\244\210\270\244\305\234\227\334x{\035\251r6\315\360U\365\242\032[_\371 \310\330\240\253L\003\222+\236\202\021\310\354\256\002\312\275\013\277\364h\214\f\236{\3643\352\361\032p\262\301\317\366BP=\354O\253#\033B\353\241?\t|\224\272\223\276]\216\217fa\242\213\210m\315\336\370$/\321\\1hl]5\262!b\231\331\365$\347\005\324\343\364\001\352QA\256\035j\376M\336\020\023\322\302u\241C\200\205\3355\344\272\216[o;\301ve\373%\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetPixelHeight.44.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\317660q\323\001#\002K\357\323p\264\305`B\234\034\324kn\326a@\241\203\316if\003PZ\265\365\377\205\313\207\003'\300\025a\372\037\b\355@\321\302\037\2106\221;\245\366t \262\351\240}2LB\316KN\\\017 \351\3012\3319\360\244\210\300\244\305\234\230\334|{\035\251r8\315\360U\365\242\032_W\371 \230l\320S\246\301\207+\216\222\021\230vW\341\344\337\205\017\362h\f\r\276{\364\265\352\361\032`\302\301\223\375\205\240z\330\247VG6\204\326C\237\022 \261x/\305\354n\234h\366%\266\204\330\336\354\215?r\222\315\026\203\006\347Y\"\035\242\225\231\335Or^P=R\037\250\036\225\364\355p\363_\362\006\230\222L\347\205\016\001\026v\327\260\3638n\275\355\004\333\226m\227\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdSendAsyncBlobCommand.46.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\205\002\245\024"
+	.string	"\266\247\210I\300\322Q:\342\250\245\231\366\004\365\230\\w\037k\305\355'\027F\t\346\"\t\177\211\223\304 \261\362F\240\341\003>\001\325\321\027hn\315no\001\022\200"
+	.string	"\001HP\200\217!3\2226\235\f\224i\323\323GZ$\261\204\310\235Rs"
+	.string	"k"
+	.string	"q"
+	.string	"\337\200#\310(jw\017<\264\203\361!\nh\203E6P\r\224\310PK,\340\220M\211\025\235\366\205\276\302v\237\241NZ\233\201\005\207\024\337MT\017\307\227\250\036zN\033A\002\333{8\326\335\335\016\244]_\212\r\214\017m\263y\234h\330\234\225\240\336N\013\251\335u)\211\333>m\376\177\017\311\351r>E\006\273\353\231\323\365\334z\333\004lS\260\247\217\177\353F\367\310\213~\326\207~\362\276\1775\247GqZ\034\247U\342t(N\203!\323:NOq\372&\254\024<\335M@\355v\230\002\262La\322\211\033\375G\237\366\375\031O\262I\327\216\344\325\007\035*v\227\254\331\344\303\037\306\177&c\\\206\355G5_\334\216=\202\204\242vy \214\017\307\375\332w\361\027\266\033\231\306\267g\003_*E~h\376\303\t\360\243\322\347"
+	.string	"5\324\343v#\n*\311\215w\2435\257SU\355\027l>7\242(,U\375N\020_\251\024\340d\227\377p\0248\355\356\202\207S\237\363\2403\247L\352\367\266\241\272\222M<%\034\320mN\2315I]\351\221\376\263 \362\223\263g/\3639\027x\3221\3414\307\366\335\246\216\260\017\356\356Z}\354\367~\222\023\005\261W\ts\363\232\021idf\264\327\205\032rl)aZ@\031\206\331\203\025M\026{\311\\T\261\030\230\032\246\022\253\225\023n^j\264\n\256r\346\222\231\275b\\0Z\315\2452\300\345\214\214\346\242)K\232\213\364\351\034\\\365\361\370\004\202IGo\256\001wE\260\374\350\377\035@\324\320\234r\311\024CP\324"
+	.string	"\332\365F\365\223\"Hx\322\303\037<RQ$:\2624TQ\225\327\204\333\261\264\245*%C81 \220\002\231A\363\267\340\240\b\370\200F6P(\364\211\f,\b\356\356)\265\316\344\214\317\016D\211\2071\212\356\2041B\021)\343\203\210!\223\0228\202\t'\261\rB\271"
+	.ascii	"\023\262N\313\277\035Sh\354\007C)3\201\032\020\267\333\"%\302"
+	.ascii	"\025\210\215\001,\3442F\b7\\\323=\206\021\004\270\260\313\030"
+	.ascii	"1\034B#\276N<\300s\213\266?\001"
+	.text
+	.section	.gnu.lto_frskyOsdDrawStringInGrid.47.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`P\001=\016"
+	.string	"V\234bD"
+	.string	"\261&\035\360\363\037\206\201U\316\363\017\266\216`\345\335\227\200\346A\0072\226\260\367\365/;\b\032\236\326\re\254u\346#+\n\364s1\377\377\377\327\006\313>\322U\003\005\027\210\304\311\021j\220H\366\2262\245L"
+	.string	"N"
+	.string	"O"
+	.string	"\331?\260\317\025\222=\372i\177\304c\272\313\0340\307.\013\213\233\335\357c\004\331c\201\023\300\036\341?\260Gwv\316?\227\365\300\240H\225\240\261\273\233zx\367\354\374\263\316\341\251N\317\215\006\273\353\364T\031n\275m\003\266\025\330w\005\273\326\026\3735\277\366\357\317.\363\307\230\2061\2550\2350\375"
+	.string	""
+	.string	"B\270T\177\261\331\275\360\252\261\255\230\342\303W\277\375\263\254\371&n\323}e\372\256l\007\b\230\026:\273\030B\036\235 {\364h\316\234\246{M\005\217\200U\241\261\360\371\002\240\274g\270\032\364\344\377\004S\205\372Y\341\200\312\227=RS[\204\222\367TAnpbZ*z\262_\302\354\321\310\206\034\0213Rm.\323|\221\332\271\332\021\316*y\270\354\356\202{2\242^7P/+R;)\371\262\277Sj\007\373p7&#\220\206B\023\034@\323)\334 \021\223\022GbB)\221B\033'\332\036\210JF\033\210T\332D@\314A8!m\0228\216\264i\337\036\256\2668\303!\321JQ\224Mp\227\205\301W\277\316L\276< \241j\252\267\013\354'\316\"\031\201\3419\306\255\002\263K\002\030"
+	.ascii	"2C_\025Xx\224\200w\205\330Ui\020h\200\303\250\030q\306\0323,"
+	.ascii	"\342\032\3432\227\305\231C\273:<\013\326\003dMM$\241%p\016\f"
+	.ascii	"V\240F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharInGrid.48.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\352\001}\020"
+	.string	"v\036jG"
+	.string	"\261&\035\331\013\022\030\364\360\256\253\271\303\275!\245\342Y\270%\360\351\372>\335\376@4\312\236\006\262\203h\253QFG}\260@0h|\264\276\344\252Z\277s(\211L\320&N\223\033\352ct\373d\023\262\311\336)\005R"
+	.string	"U"
+	.string	"Q"
+	.string	"\273\001VRO\003\310\207h\"\r\222z\352K\373\252\223\b_3bnWft\355\212%>PO\013\\\200v\232=D;uh\363\\\004\261\003hf\234X9v\267\233\037\036^\206\376Y\347P\251\227\313M\301\356Z\242R\031\356y\333\006l\243\330\262\024\317^\363\317\333\374\007\371\030q!\365\020:\273\030b;v\207\266\020\361\326o\337?q\227\313q\354\021\023\343+\336\362\307\233\020\274\t{\304\334"
+	.string	"\375\033\037\305S\200W\321\3625m\355\241\231y\355\302\220\234\372\244\236\216P\027\373s\372\217\355\271z\211\3606\025L7\246\371b_DS\325\036\316\305\254\223\253w\216\366Y\347M\260\222\214y\373\352s\323\020dS\233?\301\350|\313>\371(b\224\243l\314I\347\307/\3400\243s\202\221d\314\026Krz\260\237\355\356zv\2607i\256J\327Mz\333\244\265M\232^|) /\302\b\304\262}\020Bst\nw\310$\005\364\032\214T\300\357A\347\211:\t\"\320J\027\372\300\316\204\200=\026\007_7\301\363\276\356#\222\316\372-\324x\261C\232%\267d\2732\t\306\203\274V2f"
+	.ascii	"\222\3360\264\343|\024}\260\310\221\241A\2052\217\357RY\221G"
+	.ascii	"\371\2563\300\001\243\343\025, \240\202\031\272\232\007\" \017"
+	.ascii	"k0\354<\211\245\016\211\301$\341\272\n\254\023\226F\364b\030"
+	.ascii	"(\264\266\013G\004\344\021\002-\240\013\313'\035.\026\316\233"
+	.ascii	"\315*J{#\367D\210\203\331\223e\002\266q\277\030\236\\jG(\217"
+	.ascii	"\360\030\020\315\241\335A\235\361\023\315\3603:\341\242\3470"
+	.ascii	"X\301\215\006_^\264\213\f"
+	.text
+	.section	.gnu.lto_frskyOsdClearScreen.49.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"u\n"
+	.string	"\226\223IB \251*\035"
+	.string	"w 0s p\rP\203\342\323O\002\232~L^\212\037t=y\201\303\004\022\350\bm\325K\021l\220c<\b\211\232\025"
+	.string	"\030H\2571A\231\215\016`\033e\370rX0\332&r\247\0248"
+	.string	"3"
+	.string	"9"
+	.string	"+\261"
+	.string	"Vj\305v\227S\003\007]S\t\362\033\300\320\265\013\200\253F\201\"p\301\001\034i\025\022^\245\253.Q@\222\224\f\232\335\2654\201+\367\274\355\r\333\026\366!\002\026GRS\366\265U\224-\245uvb'\025\360\t\306\335\3238\333\327\214\240\300\366}\326\303\317W\316\0200c\260\273\333\247\375\261\267\317o\006\331\260\213\007\002z\325e\200\2240da\002\005\222\224\371!\306\305?\300\\vW\303op\007&>\202\317\207'\036y\323\247t\335\025,\237\017\217\260|\252>\374\005\330Z\r`A\020\311\321\001\336d<\276\216\303\323\371<\020\256\343p\"\234\216\020n\343}\\f\302\335\310\207\307\225t\235\307m\242\350\212\262F\244#\355\"m\222O\336d\325\320e\005F\227j\312\307X4\016"
+	.ascii	"2\003\3269\304\352\245\202\331\013h\373h\020\276p\367\270&\262"
+	.ascii	"\017A\006\025\342\345\nq\351\232j\232\006\246\240"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeColor.50.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\013"
+	.string	"v\326PC\020o\234\016\b\251pP"
+	.string	"\035\376&\244\252t\200c\352Su\001\365n\340\312-\214;+\316\031\366\325c\267c"
+	.string	"\264=\337I("
+	.string	"\001"
+	.string	"\240U\376\003b)\315\b,\027\024i\205\t\254~#\332d\357\224\002;"
+	.string	":"
+	.string	"@"
+	.string	"\224\335\220\212\323.Hb\021\354\024\344\034\327\251\365\215\353\324\236\235:\330a=<\254>#^\354n\235\034\356]z\376\303S>\320\346rr\331]\313\017d\341\236\267\035b\273\304\376%\024\306\030\213\242&F\007\177\373\276\210\213v\346\314M\316\300 f\031;;\275\355\371\2413\003\b\340\035\324|=\033\241\305\207\t\252\335\323\310\251+vj\373\322>\351!\274\227$8\257lR\2102\220\276\216\373\304\345\213\035\004\371\317\027?\300E\005\030*\317\334\370\363c!\347\347D\003\b\022\237\025G\2166\330\221s\203}kw\327Sd\277\364KK\372\023\215\025%@\037\215\273\001\332\271M\301\246Qk\026\003\335F \223\240\343\020\324\rS\031`\n,\250\032\327U\313\207\267\006\007\270\372`\333\270\232\201\234[;E\306R\027P\234\331\261\306\332\r\t\b_Q\231\344hL\376Fq\335\364\320A\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetFillColor.51.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"U\013"
+	.string	"f\026QC"
+	.string	"oj:\333\221\312\201\363\002S\006,\250t\007x\254\021d|\352\346aAq\017\037\366\337o\266&~\f\301\313\035\2266\\T\200\nP\325\224\364\001\360\245\264\205W\210\221c\2141F8\240H\233\354\235R;"
+	.string	";"
+	.string	"A"
+	.string	"\224\335\220*\265+\226xD;\ryGv\212\235#;5h\263.v\330\217\321\307#\202\305\356\326\311\341\340%\350\177<%\004i.'\003v\3272\004]\270\347m\213\330\006`\337\022\025^.vEIx\270\370\333\367C\034eo\306\374d\f\f#6\214\275\235\336\006\375\321\233\003\b"
+	.string	"/f\276\235\225\260bD\241\265\233\"9u\325Nm_\332/\035\004x\323\004\007\0174N\230(e(\205\036w\211\314G}\021\344C\037u\002.\013-Z\235\251\361g\250B\316\317\211\006\222\313\363b#_\266\310\221s\203}lw\327Sd\337\364KL\372\223\f\024\037\320I)v\003\334\275nA\307Qs\225\003_W"
+	.string	"\243\340\363\022\324\356R\033\\\f0\250\234\367\325\n\210;\007\b\274\n\241\353\274\272\211\233c;E\326X\037V\233\311q\006\333\rY\306o\264N\362eM\376Ve?}\f\r"
+	.string	"2Ck\025\030\036U!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeAndFillColor.52.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"5\013"
+	.string	"v\026PA\020O5\035\303\3046\020\245\002jLl7B\037\260]\372\364\377\235\304\370\334\f\325\264`u\007\231\372w;\006@\333\323\302Z\021\b"
+	.string	""
+	.string	"%R\002\274\207\002\2360\251\312G\246\274\232\266\264\311\336)\005;"
+	.string	":"
+	.string	"?"
+	.string	"\221]O\213\323\2568\300\001\262\323\217w`\247\327%\330\251?[uQ\304N@\033:%`\354n\235!\376]~\376\307G\3000s\t\251\354\256%\030j\270\347m\003\260M\300~%\030Z2\026EQ\214\270\370\333\367I\334dk\276\274d\r\016'\264\213\255\235\336\376\374\321\232\013\030\370.b\276\234\265\300\002uX\355\236\004\234\272f\247\266/\355\213>\372N\272\340\227\204+X\036D\340\344N\201\371&\257\202<\350\233\216\340E\206\030+\316\314\370\023t!\347'\344C(\325\231\241\221-[\334\310\t\302\376\265\273\353\371\261O\372\345%}\310F\312D\370\020\213\335\333;\356\001\267Qo\224\005\036\227\340\342\300\353\032T\316R#X\024@\250[\347U\212\2079\t\f\272J\201\343\272\252\211\232_;?\316T#\224fn\214\271v=\007\306s\254J\262\345L\376V\201\275\364qB\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetColorInversion.53.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\035\013"
+	.string	"F\225ND\020\251j:\007\007\373=\020\026\261\bn\360\330\313\300\334O\300\230\310\271\213\340\001\007\006\007D\332a(n#\323n\251\236\265L\336a\023\263\002("
+	.string	""
+	.string	"\246\001\252\2467\023\t\301\242#Q\345217\273wJ\0018"
+	.string	"9"
+	.string	"<"
+	.string	"\366X\210'G8\267\315H\006\273&\205%2\347,\332\264\233\256\345\274\\\253\003\024v\327\253"
+	.string	".\236\212\376\313kF\326\351\024\203\261\273\246#\353\344\256\267\035a\273\302\276'\324\3074@ a\035\206`\267\344fag\234\202\001\217\375\366\375\002?\355\316\245\233f@\221u%\273;w[\364Kw\266c\246\257jEl\257"
+	.string	"\265\335\004\023\347\354\241\324\001\016.7_~\337\020x  \205\034\037n\331\305?AB\372\321?\2371\301\244BMUO~\2150J\240\365\325\301"
+	.string	"l\301\352\002\212\336l3E\353\212}\313\356\256k\313>\371S.\237\203B$0\0242\022e\374\351\200\302O\303\324\021\202\034\336'\362F\242\r\017\357\003\206^\007\302\337G\b\364H\337\007z\235\211\272ek\313\031Z\203\031\252\246l\262\354\252\\\224\337\324Nz\263\206\376\016\016"
+	.string	"2Co\025\030\036\365!\002\347\267\310P\b7f"
+	.ascii	"\202k\"\r\301L\025l\242\206\355\347`p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixel.54.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`D\001\245\r"
+	.string	"\206\233^D \217\223\016\340\337<\215\001P\325\026OS\201\\\364\314&\342\224\027`\200\365\321Jj\254)\020\307\255\241\255Z\240\303\034\331\341\3315\032\250N\013H\216\214\207\022\255\017P b\305\363\007\202\324\032\331D\312\224\002H"
+	.string	"J"
+	.string	"G"
+	.ascii	"/\034\233C?\355\257\274\204\350,\226q\266{\242\022\263\273\034"
+	.ascii	"'\330\034\036x\001\354\360:\001\354\320\"{u\017\304\032H\tQ\372"
+	.ascii	"^\354\356\246\037."
+	.string	"z\212\374\177\317:\023\311S\323`w\235\235i\303\255\267\215\300\366\002\373\252\336\2579\313\177ai\205\351\204\351kh\254`L'\321\332\325\320\212\261*hB\304Q\277}\337\345)[\363\310[\234\301\001\2056bk\207\377g\3156*\364-\331L\2252\202\265k\302qh\005v\2362\254\210\331\3658\346x\001~\312\363\221\357\374\324\035\2700\201\301*Q\022\253\332\022\376}\334\311TSm\220\303h4\365\245\231\253\035\362\227\013\356\330\361_\005w\016\337\261\270\364\n\200\244\342R\232\031e\313\366H\251\036\354_\273\273V\024\373\247?{\"\240\344\342\204\350\201\241c\270=\035\020@\361A\b\004\304E\330\342g\243\360\361\b\331<\034h\353\330p\024\371\3406\0131r\233\346\215~\255\242x\263j\241\032)\311\241k\367\204\301Q\377\367\001\254S\266, \257\373\004\366\226\177\036\001L)TtX\3516n\031,\026"
+	.ascii	"2Ck\025\270x\224\266\256@@v\200\330I\221\351\223\333\230k)\027"
+	.ascii	"\032\2331Q\325\314\305X\323(\005 \004\347U5pE \005\270\353\240"
+	.ascii	"\260\200ky!L2"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixelToStrokeColor.55.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"]\f"
+	.string	"\206\230UB\020o\234\016\001\341\027\341\034"
+	.string	"r9X7\b\026=R\272\374\3237\251X\310x-\017\304\352\203\205\317\020Rmu\307\020\334\1778\343#P"
+	.string	""
+	.string	"\310'\020\020[\004\345\"\356\202h\230h\032\264\211\334)\005@"
+	.string	"B"
+	.string	"?"
+	.string	"/\361\035e\016KvI*P\354\356\305\b\260O\003\037p}Z\247\\\237\376\354\026\027El\305t\022\215.vW\323\020\377.?\377\343%`\350\271\004\260`w-\301p\303\255\267}\3006\306>\207\237\004"
+	.string	"\311\020\036\343cW\303Jd=f\212\021\327\370\355\373'\236\2623{\337\360\244CG\346\331\331\347?:\3633n\342\273F\347\033Z\t\t\023J\265;\262|\372\202}VT\354\260`\237\276\264\177\n\034\227\237\332(\310\203~\352\fBF/T!\365X\252\335]*\365\242\221\253m\341\343\005'8\b\242z\315>`\204\210F>re\213 \251 \354[\273\273\326\222}\361\277\216\372\325\222\226\226t\234{\307pg0\017\272\255\201'\241\343\"h\233F\233\240q\260\3212\\\247a\bx\343@\340\264\n\333\306i\231\370\271\265Z2\366\021z|\024\344\216\265KR0^\200*C\256<\221z\257\270\276\361qsJ\310B\304\303\t,p\007\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixelToFillColor.56.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"m\f"
+	.string	"\206\030VB\020Q\234\016A\356p\331\300\007j\f*nLTT\26184\302\271Z\005\322\331\252\316\250\341Z@\334\001\275\367O\361\211e\375\340{\302"
+	.string	"\n"
+	.string	""
+	.string	"\317(\020\262t\037\265C_\357W<\r\332D\356\224\002A"
+	.string	"B"
+	.string	"@"
+	.ascii	"'\361\335\303#\236\354\232P\244\330]\214\021`\237"
+	.string	"\006>\340\372\264.\340\372\364g\307\270(b-\035'F\343\215\335\3254\304\277\313\317\377\370\tX\372\\\002X\260\273\226`I\303\255\267}\300v\306\376\206\247\004\250!Rz\350b7\303*\307\222L\025#\016\362\333\367M<eg\366\036b\n\207\027\231gg\237\377\350\314\377x\211\357 \236\257h'\250\016\021\325.\351\362i\f\366iQ\221\305\005\373\364\245\3750#\227\237\332(\310\203~\352\fl\220p\250D\372\261T\273\273T\352G%W\333\302\307\013Np\220\206\3525\373\020\302\030\225\200\344\312\026CRA\330\267vw\255'\373\342\177\335\343WKZZ\322\001\235{\307pk2\017\272\255\201'\241\343\"h\333F\233\260q\300\3214\\\247e\bx\353@\340\264\n\333\306i\231\b\272\265z2&\243\003\tHC\366X\273&\005\343+\252\017\2712E\352\275\342z\310G\316+3Z\240<\204`\201;\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeWidth.57.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"]\013"
+	.string	"vVQC\020o\225\016\303\234G\253\037\001\b\275\356b\007Q\214\206\202\006\352\212\204vo\t\210\350\003U}\364\251X\027\217"
+	.string	"\2028\240\321G\240"
+	.string	""
+	.string	"\220\017\200WXZ\217\021\f\303\nVR\323H\r\322\310&{\247\024<"
+	.string	":"
+	.string	"@"
+	.string	"\224\335\322\207\326\256X\342\221\355\024\344\034\332i\366\r\355\324\240\255\342\242\206\3558\221\030yp\261\273uf8x\t\372\037O\tI\237\313\311ew-C\022\205{\336v\210m"
+	.string	"\366/\001\022b0\326ECl\270\370\333\367;\234es\356|\345\214\n)\270\216\315\235\336\006\375\321\234\003\b"
+	.string	"/z\276\242\205\320\342T\342\265\333\"9u\335Nm_\332G=\005^%\342\257|N\240\260\200\n?n\021\232\317\372\036\310\207>\353\004`\023^\274D\363\343\317\220\205\234\237\223\013\251\021\243\030 \031\263\305\220\234\030\354g\273\273\236&\373\252_f\322\237h\300\"\220\236\002\261\033\234'\330d4\034j\214%\363u\005:\n>\017A\3554\225\201\306\300\202\212\361\276j\361p\327\340\200W7]\347UN\004=\333i\362\266\202\203\0134C\366d\273\245\001\343+\257\225\214y\223\277Mh_}t\020\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetLineOutlineType.58.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\205\013"
+	.string	"\006\227RA\020O5\035\003\366\215f\007Bf.\200\364(\363\303\357\322\376\332\235\017\360!\201:\356@\330@\241\376{\t\214\216\342\017\203X\005\320\021"
+	.string	"P\322\001j\304\221\312#\323\320\232\324)\256\246\215\032\331;\245>"
+	.string	";"
+	.string	"A"
+	.ascii	"\023\034\331"
+	.string	"\035\275X\355\226\004,`{\006\340\034\3323\354\033\3323\2176\212\227\034\266\243T\"\364\201\305\356vu\303\307\323\321\277\371\b)\352\234B*\273kJ\212,\334\365\266\003\3306`\277\022\247s\227\302\tc[\331\210\016/\177\373\276\207\253l\316\342S\316\270\360\342D\233{v{\364Ms.@\031_r\276\240\225\360*\235p\355\256\006<3e{f\373\324\276\351\247\361\250\332S7#\\\"\302\004\t\203\211\374\270Y\232\257\n7\364\244\257z\202\025\025Z\270@\265\343WR\005\255\257\220\f(\020\241\030\036z\332\345\207V\r\366\261\335]W\222}\324O1\352C4\\\204\020=^F\324`^FD\340a.\0174\233\217\263e\302 \374\024\210\016B\260A\367]:\314e\001\204\316\002\206\335\304\303_\306\003;\315\367\201\035Wz\216m%yK\301jy\352\307\034lwt\300\274\304\225\242\2477\372\233D\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetLineOutlineColor.59.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\205\013"
+	.string	"&\227R?"
+	.string	"Q5\0352\237\2700\231T\032~<"
+	.string	"\320\f\016\035\341\337\333\347\341B\n\250\301\345-v\373\322\206\320cT.;\324)\013P"
+	.string	"\200X\335\31652j;\303\374\230\321\035*:\322&{\247\024?"
+	.string	"<"
+	.string	"A"
+	.ascii	"!\007CvG"
+	.string	"0R\273\342\002'\320N\017|@v\212]@v\352\317^]4\261\004J1B*j\354.7K\374\273\374\374\217\207\200\242\316\345c\262\273\226\240\b\304=o\033\201\355\007\366'\001\242\207\254]\017\257\033\253\242+N\\\374\355\373)\216\2627o~2G\b\327\266\261\267\323\333\237?z3\203\006\337E\316\027\264\033h\224V\255\335\224\202S;\320Nm_\3327\035\305\367w\213\354\247\217\032\036y\341\302$\302\004\032\270Yd>\312\323\310\203>\352\022\\\037l\264@\263\343Op\206\234\237\217\021\241+\324\341\221/[\374\310I\302>\266\273\353I\262\037\376\022\223\376#@G\207]\275T\n\355\352\245F\250`,\227\214\246\0020ER\301\253\0236\027\274\316\002W-\034\306B\001\003G\351<NR\3005C\245\3432\265v\334&z\216\355$Yc\311Py\346\307\034lw\004a|\244u\222/k\362\001\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdClipToRect.60.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"v\\bE\360\2606\035\226Aau\n\246\345\376Jew\263\326\335\311\336!\006\212D\336Duf\327\332{\235}\377*\023\235\226$\216\356$N}\305B7\221\315;{J\356\n\304\005~a\217b\027\243wG\262\267\334)\005M"
+	.string	"M"
+	.string	"K"
+	.string	"(\234\217/\364\270>\375h\337\345/\335a|c\317\356\312K\315\356~X\301\365y\340\004\254O\371\001\326\247;\373\305\277\021[\240\305\206\351\004\215\335\315T\304\273\307\316?x\217wBy\344x\260\273\216\336\311\303\255\267\215\300v\003;B\b\237\177\377u\230\177\312h)\243UFG\031\375\016"
+	.string	"\253\360\364\230\234\335\016\253\235\325\2316$>\363\333\367U<\2641\217N\343\317\007\0256\262\261\317\0374\346\243x\212\3563'\337\224\365\224h\331I\355\252x|\232\301\365\271\300\222q\221\005\341#\314P\251\221JQ\024K\265+\234\005H\245\252-\272\r\311\301\222\217jT[{\315\245QoR]\355\f_a\342\020\233;\270\301!\237\367bL\275b\245\230\026&\025)\256\354\257\0245\204}\271\273ke\261/\363\203\216\372\003\333-\334\344\243s\270C \0238M\302\210\204\333(d\232(\273 \022)\311B\033\227\201\030\260\206ad\3134h\332\226a\037\351r\225\305\027\214\033:$-\371D\356\2568"
+	.string	"/ \205\212+wD\353\306\261NsP$\200\211\034\031 \\\274\004\367\215\345\207\241\221x\317\017\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdClearRect.61.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\245\001\225\016"
+	.string	"f\334aE\020\221\223\016\300'A\211\b\032,\272"
+	.string	"\272Y\377#\0365$\350\272\263\253\227\b#\025\300S\fD\257\315\"jl\b\f\361p@r\215\373\016P\004@\341(\225\3177\376B2-G\212v#\033\251do\271S\nM"
+	.string	"L"
+	.string	"K"
+	.string	"\251\032!\336\f\bv\351C\373\250\267\340\016c\033wv[P4\273\033b\005\330%\202\027\270.\343\t\\\227\346\354\034\367R\254\201\027\017&\027;vw*\212s\207\234\377\357\235\356\244r\b"
+	.string	"\302\356\032v\247\020\267\336v\002\333\016l\030!\367\334\373\261\303\3742B\307\b\255\021\032F\350\177\0040\361\341t\225\214]\020\255\036{#kV\\\365\333\367g\276\2623\217.c\317\210ldg\227\377\347\314\177q\030\334U)\337\225\355\260x\351X\273, \227n\200]2\270bp\314_]\202\016\026\036\254\025UqT\333\302g|4\252\332\241\327\230\374;\361\250B\265\265\323`\n\365\246\234\253\255\3411P<b\213\376q\360\310\345;\034\251\327\254\244\242a\312!\301\226\355\225\240\236\260\037ww\255.\366c\376\317S\017\333/\034\345\243w\270A\"\024D\332\204\221\211h\2530\265\320\304\020\"9\231\240M4E\016X\313P\262\315\r\232\266\315\314#=\256\272\030\303\021qC\322\222S\342n\313\203\357\003X)\330\362\007\274n\033\327e\376\221\b(qC\005\tT\267\340\266\271\374\025\250\004\276s\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.ascii	"\302$E\246Onc\256\345\\h\302\326\"\2105B\263D\334r\020\22709"
+	.ascii	"\2009\220\031\030\004\310\003\216\001L\200<\340\230\203B\r\256"
+	.ascii	"\345\2050\311"
+	.text
+	.section	.gnu.lto_frskyOsdResetDrawingState.62.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"e\007"
+	.string	"2\016470\217\222\016D\341\233\233IHfO\251n\201>\314\2177\276\336\214\022_\365\371\036\241\375|0l\3061\316\031\377\006\022\006\271\b.\274\261I0\250\252\007k\373\204\310\024o4\r\234\266\320\201\340\266\207\250q\242\004\207!\"n6.j\n\326&\034\266H\241i[\314T\240f\022\236.\252\001'\032%\326\n\004C_\357V`w\027\f\241\257`7\325\261x\025\335T\025^J\254\325\005\374\274*\364 \3077\223\360\364p\003!\215LEie\222Z1\311r\251|\374\275%MyJ\362\300F\212Hff\275\336\363Y\257fw\337R\225G\022\214\2140L`23\302\216v}\335-\252\002\"\323\247\017 !3\177\"SF\207\375\r\376\203?$\t"
+	.ascii	"2\241w/\260\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharacter.63.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\177\001U\017"
+	.string	"\206\236iG\360\3166\035\323\013\214[\343\223\036%l\235\032w\366R\374`\177\236h\302U\314\017\265\353\252\006\332\233\236\177\006\231\034\034\206R?\276_\255s\322qX\234\212\347o\001\2449\226&\272\304\"\2479os\023\273\333\336)\005Q"
+	.string	"X"
+	.string	"P"
+	.string	"#\217\262S\221\274F\025q8\262S_\332\207\271\b\3601\3261h\227\245\306\265\273##\310N\r\234@=\305\256QO\r\332-.~\330\215\227\r\252\022=\273\273M\227\203\227\240\377\361\240pur\t\340\301\356Z\206+\r\367\274\355\003\266\033\330r#U\372\031\031.,Vg\251\330\315\360\023cwh\016\210\333\374\366}\023o\331\232I~\343\220\nN\210\335\325Hl\355\364\037\255\3715g\201\267)\371\242lh\345\205\303k7\205\343\324\245\3544A]\300"
+	.string	"<\315\351\242M\241\300\240@\346$\300\317\230\230\356\256\254p\355\212\001/R`\274P\346\211C\323\236\360\361\224M\333\364\321\304%\220\212\2346\310s\352\224\363*\237O;\344\256\317%\273\373h\301\245\323\207<s~\016H\261\\\250|P\362\307\026Srz\260\217\355\356z\266\330\247\371C\237\371\263\213\177}\314?\253\264\f\234\207\374FD:\314\243\300\315\323/\334\034\311\343\353\"\234@>O\302\326\231\266\n\246\216\220\215\363\276\215T\300\235\310\207\267\215t\235\267i\"\352\330\316\026g<#vP3\345\022l\227\305\301x\001/\031\371c\221\254\367\211\372\233\217\035\001V)z:\300\204\244[\247\372-\356C>\364[\207\020\032"
+	.ascii	"2Ck\025\030\036U\273\005^\371\n\232\031\326\251H 0I\221\351\223"
+	.ascii	"\333\230k5\027\232 l+\215\021q\346\320.b.\224A$\320qQ\242\306"
+	.ascii	"\022\256\004\207\201,\034\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharacterMask.64.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\357\001\035\021"
+	.string	"V\341sI\340\3206\035\352\007\226\024\f\274+\3650\026\342\003\017\340\023\001mW\200N\211\241\370\331\022\303\264,\"W\351\217\344\243u8\350\316\312h\313A\021\256\207\030f\250\037L6\364w\003\320"
+	.string	"h$8`\305H\255\233\355\266wJ\001["
+	.string	"a"
+	.string	"Z"
+	.ascii	":.\256\273 p\314vI\224Q\334\253i\376D\"\207F\270W\177\332\277"
+	.ascii	"\271\212\3618\016riW\306g\266\273(\033\340^\t\\\204\364\252\375"
+	.ascii	"Dz\365h\3378Ib\005\330\224x\261\320\261\273\036\035\361\361s"
+	.ascii	"\364_\276\004\213\275|n\017v\327\023\026\363p\323\333.`\273\201"
+	.ascii	"=[\001\333q~\215\233\246\333\364\334\246\037\002\200\306D\354"
+	.ascii	"=0v;\034\361X\242\nt\342>\277}\337\305gvg\361?\376\220\t\241"
+	.ascii	"\330\335N\264\273\327\277t\347\367\274\305x\237\226/\314~\324"
+	.ascii	"\330\320\024\355\306\214\274\232\001\367\272`C\220`<\317"
+	.string	"\352\246u\325H\241\200\356\2604\323r\b!;\220\363\025\343\003E0\364\305\224\332\024^\256\234\002\241\264\243v\311e\254J\3246y\f\027\247J\262I\355\357BA\033\235\364\257\036\2476\312_hp\312\266p \225S)/U\234z=\314H\243\247'W\317\214W\217\326<\262I\327\244\"\354k\273\273\2463\366w~\220\363\374\335u\376\322\311?\337\311\024YV@-\0041\200_\r/|\224\365\r\367Gr\"\202%\254\0241\254\340\201*/\203\312D\305\373B\321#\031`p\005%\364X@0\364:\262um\351\2149\243!\242\026u\271E\333\225qP>\244(g\036Ydn\367\020\351?/#\004\240a\243\346\303\r\314\273\203H\376L\302\204y\230?;\204\0341;\002\" \200\002\022\272\253\003rh\235\201\021\242:$\003\367I\201\230~\336,,\336\364\350zq\326\314\356\214\032\350\021 \2149h"
+	.ascii	"\243\235\030$\314\331\202H\341\275\347b\006\001-Ax\264\354\244"
+	.ascii	"D\220!P\250\261\350J\016+\013\207\232\002\271\274h)\031"
+	.text
+	.section	.gnu.lto_frskyOsdDrawString.65.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\201\001\035\017"
+	.string	"\006^gE"
+	.string	"\257(\035\025\210\024\242\016Zgv\277y\2179YH\215\331\002 "
+	.string	"\021\332\237\320\256\251\307\340\032\320\330\320B\341D\367\"\213m\253\006L\375\377\377\235\331\246\326w\266\b5Iq.6\007C\003Ad\023)S\nP"
+	.string	"Q"
+	.string	"T"
+	.ascii	"a\310\241\220;h\013K|p\217~\332\217\271\314\367\031\347Xc\367"
+	.ascii	"E\006gwC>\300=\026\270\200\355Q;h{\364g\273x\b\263\003Z\254\224"
+	.ascii	"\210\027\273\333)\210\177\317\317\277\353\032\240\n\365\314x"
+	.ascii	"\260\273NP\305\341\326\3336`\273\201\235\004\002\366k"
+	.string	"\376\317m~\317\303\237\373\314\037\267\264\266\2455\2463\246\017\240\203\325B\365\327\210]\r3\030\013\213'X\277\371\355\337\345\r\3337)_\226\365\304\264Z;\273\033>\036\255\300\t\026|\2679Yw]d]\322<\304\367\032\f\017\260\273b\201\263\033\037\331T5\r\261\270\254\344\314\035\371Q\273dB\036T\365\320\211\305\200eP\224=j\217\356:}\034\264\250h\265\244\332&7\301i\256H\311\2566\351/\013\034\266wW\205\017\314\3562x<\030\213z\315\360\360B\221\222\251\344\314\016Q\251\037\354k\273\273\326U$$\221\232PN<\315\364\323/\334\"\020\022\223'r21\225$t\336\250\2430\032!u\242\222\251\003\361\260wRR\352P<\257\324m\204{mue.6\203\251\350\212S\264\335\227\220\035\232\234\031\224\232~T\273Sl'q\027\204\020\035\020\301\235\263\331\021D\362\240\265\355\240(?\033"
+	.ascii	"3C_\215\241hC\035\331ha}\303,\341\036\2606\340AU\f\243\342|\271"
+	.ascii	"5\246\335\3065\346gwO\030\n]C\230\341&Ps\020\314\022\342:\r\261"
+	.ascii	"\204\213\3009\220\231\203\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_frskyOsdDrawStringMask.66.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\335\001\325\020"
+	.string	"6\241rG\360\320&\035zfi\325?\271f\316w-\021e::Pp\314\227\262q.\277{\202.\256%\312\256\216\r\004\0316\220\262\351\232\241\242uqP7\221\215-\357*f\243\365}\343\255\006\025c\333n\321\210%\233\310\235R["
+	.string	"^"
+	.string	"_"
+	.string	"\340w:<d\367\246\bhWL9%r\027\331D\032#\334\247/\355\253\370\n\3609\016ri\267\306\007hwSV\300}\036\270\200\355S\273\310\366i\320\276q\021g\t\304|dZ\344\330\335NK\034\274\004\375\313^\ng^\227$\t\273k\031\316\200\270\365\266\021\330\206`\313\r\001\376\316\217:\317\177z\317o\272\370\227\236\363o\234\364\344\2445\222\264n\322r\223~"
+	.string	""
+	.ascii	")\306\231\2173v=\314t\254\320\224a\342\343o\3772\233|\027\377"
+	.ascii	"\001?\266|c\326\303F\354\307h\367\303\310\247\035p\237\t&\203"
+	.ascii	"\022\360=.\007Y\330P\254Dy\\\032\310\302\330\210\350\244\316"
+	.ascii	"Y\004\0266M\247\246bF\300\344\314!\022\245\266\311\211|\250\251"
+	.ascii	"\001\240\243\023B0\372\262\252\255:\251\252\307\32083\251\235"
+	.ascii	"r\231\313\307\003\032\242\030\215T\033\303c\224T\026\311\354"
+	.ascii	"\270\332\253\303\370N\266\312e\254\017\234\335m\360\371\020\307"
+	.ascii	"\246W\222\315H$\263\343E\316l\361%\225\204}mw\327z\343(,\225"
+	.ascii	"~,+\236\326\3622x\252\371\335u\016\267\212\004\345\363L\\*_\353"
+	.ascii	"B\347\255:\r\253\023V\247j}\035I\001{+)\255\216\305\363Z\235"
+	.ascii	"I\334k\2537\346\216P\b\275(\314-\332nM\204\217\277\221\216\234"
+	.ascii	"y\200\234\212\322y\327\330\376\342\262\t\347\301\t\027\334A\233"
+	.ascii	"M\241\202|hmC\350\313\177! \240\202\231\311\252\003ch<bHNFq "
+	.ascii	"\2055\224U\216\030\271p\257\265\341A\215a4\316\367\255\261v-"
+	.ascii	"\323\0304]\026\315\321\356U\027\006\213\004\316-0\324\022A#\213"
+	.ascii	"k1\330%\356\362E\23733\007\030\r\177y\321\n2"
+	.text
+	.section	.gnu.lto_frskyOsdMoveToPoint.67.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"]\f"
+	.string	"v\230UA\020Q\234\016Q>\233Ni(\250\310C\345\335W\374\023\t\230\032\356\n\025p\203\325JE\244\036\254\372\200\336\373\247\370\304\262~\360=a"
+	.string	"\005"
+	.string	"\200g\0240\266 \245\302\241\377\331&J\2366\221;\245A"
+	.string	"B"
+	.string	"?"
+	.ascii	"G\001\036e\017KvI\250\025\273kq\202\354"
+	.string	"\363\300\013`\237\327\t`\237\006\355\030\027I,\305\344\"4\322\330\335MG\034\274\004\375\217\227\204\243\316%\200\006\273k\031\216:\334z\333\bl_\354{\b\237\0048\261a\364\025\310.\207\226\310~L\026%\276\361\333\367U\\ek\376\316\341\311\007\020\355\263\265\317\177\264\346\247\236\002\374\006\347\013Z\211\t\323\013\326\256\250\362iK\366IQqU\311>}i\377\024\036\230\257\342,\310\207\276\352\016BD5X \355X\252\355a*\365\241\221\253\215\341c\006/x(C\365\252\205X\205\204F<\262e\213\037\251\"\354_\273\273\326\222}\361\307\216\372\365\222\226\227t\233\177\327pc.\021<\356\301G\301\353&l\\f\253\220\201\240\3310\235\267]\f\230\333H\350\266\013\034\327m\232\350\371\265Zr6\243\343\303\243\037s\256]\022\203\361\003X)\331\362D\352\335\002;\307G\215\200\016\030\" N\241\202;\024"
+	.string	"2Ck\025\030\036U\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeLineToPoint.68.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"m\f"
+	.string	"\206\030VB\020Q\234\016A\336\303\267q\213r\275r:^\324\375\025\213\205\326\330Y}7\335\303\265\312\370\367\023\363\032\350\275\177\212O,\353\007\337\023\006P"
+	.string	""
+	.string	"xFV!K\367\021\r\372\272\353\342i\320&r\247\024A"
+	.string	"B"
+	.string	"@"
+	.string	"'\001~\303!\236\354\232>P\354.\306\007\262\317\002\037\200}^\027\200}\032\264]\\\f\261\226\024\213\3218cw7\005q\360\022\364?~\022\226>\227"
+	.string	"\026\354\256eX\322p\353m\033\260\235\261\277!\247\004\030\361Q:\310\212\335\f\255\032;2S\210x\307o\337?\361\225\255\371\273\207)\034bh\237\255}\376\2435\237\343&\300wx\276\242\235\240R-X\273\244\313\2471\331\247EE\221K\366\351K\373\252!\230\277\342(\310\207\376\352\fd\220h\260D\372\261T\333\303T\352G%W\333\302\307\013N\360\360\205\352U\363"
+	.string	"B2*\001\311\226-\206\244~\260\177\355\356ZO\366\305\037\373\306\257\227\264\274\244\003\235\177\307pk2\017<\256\301'\301\353\"l\334f\233\260q\300\3314\235\267e\b\230\353@\350\266\n\034\327m\232\b\372\265zr\006C\305\bHC\366\\\273&\005\343+,\016\3312E\352-\202\335\343#\347\225\022$\250\016\252\020\301\035\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeTriangle.69.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`J\002\215\020"
+	.string	"\266\336kG\340\262(\035SbP\025xp\350\037\021\273\303}\004\363\225\252_}\216\345HktH\016\022-\322\303!\333\260\217\346\373i\215\315x\211\006\214h\2141\3066>\320\366(o\t\235\203\325\032\377\036\377\331,\331{\313\224\002W"
+	.string	"S"
+	.string	"V"
+	.ascii	"\245\375p\002\204\203\233\036\223\214\307\027\263\261 \364\351"
+	.ascii	"\253\375\232\263X\335\3067{\2732/l\273\313\300\tB\237\007>\240"
+	.ascii	"\373\224\027\320}ze\373xL\305\026\240\341q\271\340\331\335/\246"
+	.ascii	"\370\352\272\362O\273\367\202\275\\A\023v\327\372\202\215\270"
+	.ascii	"\343m#\260\035\301V\035\001#\217\375\242\333\374 \251\356\244"
+	.ascii	"zJ\265\224\352(\325*\325'@j\021\002\366ZmW\304\017\221\305\315"
+	.ascii	"\235\025\317\371\355\373\265\333\354\221\303\353XT\242\310(\264"
+	.ascii	"G\237?\315#\037\306c\254\236\343\362\205Y\017G3$\267\033\243"
+	.ascii	"\340\323\020f\336\214\304\003\034\337d\267\235\202\220\230\236"
+	.ascii	"\034L|q\227\203$v\363\306J)NY\203\024e\234\3012\022\243F\033"
+	.ascii	"\274\fQ\324x\227\317\243\315\341;\036\214b\247N\353`\224\317"
+	.ascii	"\277\200\200\342#\251U\243\341\362a\351\217\035kiDa_\356\356"
+	.ascii	":\316\330\237\375$\307\371K\277\371I\227\375\001-?\t\365D\245"
+	.ascii	"\246PM*5\t\325D\245N)\271\220\002+\204+)\024\206\017<}\032N\026"
+	.ascii	"X\276\024T\352+1`p\203\n\352k\001A\3247\212\261.7\3168\024\244"
+	.ascii	"\007\307\212-\273\310]\031\t\264\007\310\311\324\273qt\3279M"
+	.ascii	"\005\300\217\035=L\324\354\356_\r\356[\347\3332\234\364/\007"
+	.ascii	"0 0\003\221\031;3\241u\304\220,\241\020%tl\030\360\270|\260\345"
+	.ascii	"\274+\314%\310\351\273\207\340\203-'\357\036\302^\242\034\361"
+	.ascii	"\232\024d:s\033c\355\353B\343!&\004\230\371o#\3426PL\320\256"
+	.ascii	"\330\205x\216\305\004y\260+\231\023\330\221\214\223\330I\206"
+	.ascii	"N8h,\340-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillTriangle.70.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`J\002u\020"
+	.string	"\266\036kF\340\222*\035\243\177hJ\300\220<\3663\341\025\226g\336\201\322\264\t\030\232\3071\227"
+	.string	"\204\262\225|\37524\232\303\374>Xs0\270\365E\b7\3140G\027\210\216\361(m\016*B\263qv\373\212\266F\366\3362\245W"
+	.string	"R"
+	.string	"U"
+	.ascii	"#^\032\320\354Jd9H1\234\017f[\340\371\364\325\276\314U\244>c"
+	.ascii	"\234?\2731+n\273\313\300\t<\237\007>\300\373\224\027\340}:e\343"
+	.ascii	"8\314\304\026@\221\303b\321cw\277X\342\251k\312\177\355\237\226"
+	.ascii	"\253\345\332\211\260\273\326\226"
+	.string	"\353\303\035o\033\201\355\007\266\342\004 \207\375\240\317\374\035\251\366\244zJ\265\224\352(\325*\325' \262As\335\266\333}\331\375\330\334\2649q\332o\337\267\375f\207\034\276\306\240\020\262Ph\207>\377\232C\276\213\277H\235\306\362u\331O.\205\007\335.\214\202O;\230}f\306\311\321v\b\277]\002\017\030\037:\227\330b\257FH\364\346\214\224Q\234\362F\024e\224\241\002\022\243F\033|\fP\324xV\316\243\255\3416\034lb\237^\333`\223\317\267tt\342\243hu\323\202\225\243\322\235\r[i$a_\356\356:\276\354\317\376\220\323\374\243\313~\321c\177+'\t\225\004\245\244PI(\035\tu\004\245>\021\251p\002'\204)'\223\205\017,}\030J\024T\276\023\323\351\0231`0\003\212\351[\001A\323\027\202\251.7\276\354\331\001\"\247\212+\263\310\335\030\b\265\007\320\305\364s\323\360^\363\032\n"
+	.ascii	"\0307^\"dv\367\255\222\033\347\371\267\013%}\313\0010 0\003\221"
+	.ascii	"\031;3\241u\304\220,\241\020%tl\030\360\270|\260\345\274+\314"
+	.ascii	"%\310\351\273\207\340\203-'\357\036\302^\242\034\361\232\024"
+	.ascii	"d:s\033c\355\353B\343!&\004\230\371o#\3426PL\320\256\330\005"
+	.ascii	"\361\260+\031'\260+\231\023\330\221\214\223\330I\206N8h,\340"
+	.ascii	"-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeTriangle.71.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`K\002}\020"
+	.string	"\306^kG\340\262(\035\243\333\324\232B\033\331\246D\344\340B8/\200\277\002=\240\236\261^`\n\003E\236\032\r\207l\303>\232\357\24756\343%\0320\2421\306\030\333\370X\235\003\274%t\016V\353\370J\350\177kd\357-S\nV"
+	.string	"T"
+	.string	"U"
+	.ascii	"\245\345 \242\303\202\232\037&\332\roF#\001\350\323W\373\262"
+	.ascii	"\243`\235\3067\207vcB\333\356*\360\001\320g\201\007\350>\345"
+	.ascii	"\001t\237f\3318>+\261\003f\\^*x\354\256\027I\234ue\371\017\037"
+	.ascii	"\202\305X\256\037\b\273k\205\305@\334\361\266\r\330v`k. \237"
+	.ascii	"\375\242\323\374\037\251\356\244zJ\265\224\352(\325*\325\027"
+	.ascii	"@\252\341\022;.\307\356\207\036\037\233\2339&~\363\333\367]\334"
+	.ascii	"f\217\f\036\307\"\230\025#\320\036}\376\241G>\213\267`\375f\345"
+	.ascii	"\333\262\241\334\214\007\235\335\027\004\237nP\013\325`\030\330"
+	.ascii	"\370&\003\267=\302\316K\017\235\226\310\342n\206H\354f\f\224"
+	.ascii	"R\234\022G\2122\302H\001\211Q\243\375\375\205(j\374\213\347\321"
+	.ascii	"\316\360\234\r>\331\252\207\032|\372<L\307'>\222\\\270\235\027"
+	.ascii	"OK{\354\231K\343\b\373rw\327Q\306~\355\027\271\315_z\315O:\355"
+	.ascii	"\017*/\001\265d\245&PM+%\001\225d\2456\031\241\240\372$\200("
+	.ascii	"\252T\005\357Cy\027P\023R<\223\224\312\033!\340\017\303I\312"
+	.ascii	"S\371\276\2247\232\265.7\312\030\264\343D\256\025]^\221\2731"
+	.ascii	"\017\302\207\350\3204t\313\350\216\363\360\344!)l\310B\310v\367"
+	.ascii	"\260\323}\353|\233\005\224\036\3460 0\003\221\031;3\241w\304"
+	.ascii	"\240,\241\022%\264p\030\360\270|\260\345\274+\314%\310\351\273"
+	.ascii	"\207\340\203-'\357\036\302^\242\034\361\232\024d:s\033c\355\353"
+	.ascii	"B\343!&\004\230\371o#\3426PL\320\256\330\205x\216\305\004y\260"
+	.ascii	"+\231\023\330\221\214\223\330I\206N8h,\340-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeRect.72.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"v\\bE\360\2606\035\3330\370\312\225M*\037\237\256T+\003\300\340\267`\025\027\206\224\005Z\034\274\326\336\353\354\373W\231\350\264$qt'q\352+\026\272\211l\336Y\247HL\347\275D\307\340j\300|\277\355\311\336r\247\024M"
+	.string	"M"
+	.string	"K"
+	.string	")\234\217/\364\270>\375h\337\345\250\356/\266\261gw\005E\263\273\037Vp}\"x\001\353S\236\200\365\351\316\226\361\317\304\032h\001aRqcw3-\361\356\261\363\017\336\343\235P\036\001@\330]G\357\364\341\326\333N`\273\201\035#\004\237\177\377\365\227\177\312h)\243UFG\031\375\216"
+	.string	":\341\3517/v=\254rl\316\2549\361\230\337\276\337\342\241\215yt\031\177D\314`#\033\373\374Ac\376\212\263\350\036s\362MY\017\212\226\020\252]\025\217O3\270>\027X00\262\341%\330P\301\241JQ\024K\265-\334\005H\245\252-z\r\311\301\222\217jT[;\315\245Qo\332\271\332\032>c\342\020\233;\310\301!\237\367fL\275b\245\033\035\323\016)\256\354\257\024\225\204}\271\273ke\261\017\363\203\236\372\003\333/\334\344\243w\270C \0248m\302\210\204\333*d\232(\303 \022)\311B\033\227\201\034\260\226ad\3136h\332\226a\037\351r\225\305W\rT\016IK>\221\273+\017\300\017P\245\342\312\035\321\272q\254\313\034\024\021\220\"\006\215\021.\236\203\333\306\362\303\320H\274\347\007\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillRect.73.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"\266\334bE"
+	.string	"\261&\035\320\226|{\205U\325\236"
+	.string	";\177\354S\"\277Eb\316\345{\344W\206\241\372\354g\270\240\272i4\2423\037`0\006\334?\323U\257\252\326\212\373:5\034:9!4\242\177DS\213T\262\267\334)\005M"
+	.string	"N"
+	.string	"K"
+	.string	"\032\252\006\004L}`\237~\264\377\362\024\336a\274rg\227\3454\263\273 V\200}\"x\201\353S\236\300\365i\317\266q\320e\r\234\\J*pvWS\022\367\036=\377\341;\237)\345\021"
+	.string	"\204\335u\374L n\275\355\004\266\033\3301B\340\217\035\346\2372Z\312h\225\321QF\337#"
+	.string	"\r\017\246\333\274\330\375\320\332\2617\223\346\304e~\373~\213\253\354\314\242\247\354\t\261\302\331\335Ldg\237\177\350\314_q\026\336eP\276*\333Aq*\301\332]\371\3704\003\354s\301\0253#\227\220cE\007KES,\325\266p\030\037\225\252v\3504%\017M<\252Q\355\3553\230F})\347jk\270\213\023\213\330\335C\016\026\371\374wc\3525#\331\304(\345\214b\313\006IQG\330\227\273\273\326\026\3731\377\347\250\337\363\334/\374\344\242w\270A!\024\272m\202\250\244\343*h[H\303\020\0321\321@\\\247\205\034\360\226\201\204\3236l\033\247e\340\350r\265\305\030\216\232\233\221\222\214\"wY\036\204\037\300B\305\226=\342u\313\270\236z8\"\300T\303\204\210\227\317\301\275\272|\025\210$\376\363U\001\036"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\025]h\202\260-4F\304\231C\273\204q\001\342\001\307"
+	.ascii	"&@\036p\f`\002\344\001\307\034\024jp-/\204I\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeRect.74.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\261&\035\320\207}\232S\353Zo\346\226\037t\204bp\303\341oZ\207\315\353\340"
+	.string	"\n{\n\027Tk\026\215\350\314#\036\306\200\373g\272\352U\325\372\007\002\312\311\276_O\b\215\322\033\320\324\"\225\354-wJ\001M"
+	.string	"M"
+	.string	"K"
+	.string	")\030 ^\213\017\354\322\207\366]~\202\373\213m\334\331]\371hv\027\304\b\260K\003\037p]\306\013\270.\315\331\253{\"\226@\313\210\023\212\033\273;5\304\271C\316\377\367N\207\"\035\002p\260\273\206\035\252\303\255\267}\300\366\002\033>\b\236{?\366\227_F\350\030\2415B\303\b\375\216"
+	.string	"+\025\352.Z\273\034Z9\026G\326\220\270\314o\337Wq\225\235y\364\031{<\274\310Fvv\371\177\316\374\024\217\341.\203\362M\331N\211\026\023\254]\225\217K+\300.\023\\0\253\031\252C\260\241\202\203\225\242$G\265)\234\305G\243\252\035zM\311?\023\217*T[;\r\246P\177\312\271\332\030\276\342\304\"\266\350\237\006\213\\\276\233!\365\232\231nbN9%\330\262=\023T\020\366\343\356\256\225\305>\314\377y\352\017\333+\374\344\243o\270A!\022DZ\204Q\211h\2330\265\320\264\020\0321\231\240M4C\nX\273@\262\315\f\232\266\315\314+=\256\262\030\253A\003\247\244&\243\304\335\225\006\337=X)\330r\007\274\356\233\3533\377F\356A\222\021\343\203K\307\340\266\271|\025\210\004\276\363\003\037"
+	.string	"2Co\025\030\036\365\225\025X\021D@"
+	.string	"u\340m \b0\003\020&)2}r\033sm\347B\0236\023A\230\021\032#\342\314\241]\302\270"
+	.string	"\361\200c"
+	.ascii	"\023 \0178\0060\001\362\200c\016\n5\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeEllipseInRect.75.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\246\001\225\016"
+	.string	"\206\334aE"
+	.string	"\261&\035\340\363@\274R\3762T\345\203\376\347#\316\342\206\330\213\377\033\336\n\355\240\262\247!\\P\3354\032\321\231\0170\030\003\356\237\351\252WU\353\037\"\032'\034:9!4Jo@S\213T\262\267\334)\005M"
+	.string	"M"
+	.string	"J"
+	.string	"\250\027\036 \213\016\354\323\217\366M7\341\375\344\031svU`bv\327\303\b\260O\003\037p}\312\013\270>\355\3311\016\216X\002,&\322\211\031\273\253\251\210{\217\236\377\360\234\257t\362\b\300\301\356:~%\017\267\336\366\001\333\013\354\370 \235\203?\366\323?e\264\224\321*\243\243\214\376F\200\032\016\245\253d\354vh\331,\315\224!q\227\337\276\257\342);s\350/\356|h\221\205\354\354\363\017\235\371(\236\302\273\213\311\027e9%XN\253\335\224\216O+\300>\023\\-5\264\251C`\245\320X\241\350\211\245\332\024\276\302\243R\325\006]f\344!IG5\252\275=\006\323\250'\335\\m\f\207)1\210\335=\324`\220\317\1775S\257\331H\305\"\335\210b\313\006GQC\330\227\273\273\326\025\373-\277\347\250?\334+\274\344\241o\270?\037\022\272-Bh\244\343&h\033H\263"
+	.string	"\n!\321>\\\247}\024\360vA\204\3232l\033\247e\240\350ru\305\030\253D#\322\221M\344\256J\203\360\034+Tly#^\267\352\372\313\303\220s\270\200a\003\302\3641\270g.?\365\021\211\377\374\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillEllipseInRect.76.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\2576\035\223m\252\236\205\222\271\302\220!\342$p\361\215f\001\264G\302\257a\366\344riY\254\242\334\252\034a\361\234\312\005\270}F\313U\277\364\353h\035P"
+	.string	"\027\302\2442M\302YX\214\336\035\311\336r\247\024M"
+	.string	"M"
+	.string	"K"
+	.string	"\250\027\036_M\307\365\351G\373.'\321\375\3054\366\354\256\2042\273\353\341\003\327g\201\013\260>\345\003X\237\356l\234\177 v@K\312dB\306\356f\372\341\335c\347\037\274\307;\235<j4\330]G\357\304\341\326\3336`[\201\035\035\004\237\177\377\365\227\177\312h)\243UFG\031\375\r"
+	.string	"1\302\323mX\354nX\315\330\2339\023\3421\277}?\305C\033\363\350)\177TZ`#\033\373\374Ac\376\211\243\350\036c\362EY\217\210\226P\265\233\322\361\351\004\327'\002\013F'\013\341\037\344\244\350\250P\364\304R\355\t_\001R\251j\213>3r\220\344\243\032\325\326.si\324\233v\256\366\205\253(1\210\315\035\314`\220\317{0\246^\261\222\215\013\323\016)\256\354\257\024\325\203}\271\273ke\261\017\363\203\216\372\003\333)\274\344\243k\270C\037\0218\r\302h\204\333$d\232(\253 \n!\311B\033\227}\020\260fAd\3130h\332\226a\037\351r\225\305W\216\312\rIK6\221\273+\f\300s\250Pq\345\215h\3355\326S\007C\316Q\002gD\007\027o\301Mc\371aH$\336\363\003\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeEllipseInRect.77.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\261&\035\320\316\360\366\036\371\024L\017\037\324\324L\234\305\r\211%3=\350\r\376I*\236\206pAu\323hDg\036\3610\006\334?\323U\257\252\326\177!4N\366\375zBh\212\317"
+	.string	"R+\211do\271S\nM"
+	.string	"M"
+	.string	"K"
+	.string	")\236\020O\006\bv\351C\3730?\301=\3067\376\354\266\340\324\354n\210\017`\227\005.\340\272\214\377\270.\315\331;\367D\354\200\027\030'\024<\273;5\304\271C\316\377\367O\207R9\344h\260\273\206\035\252\303\255\267m\300\266\002\033:\b\240{?\366\230_F\350\030\2415B\303\b}\017"
+	.string	"\254\r\250\347\264\330\345\320\272\261:\322f\304g~\373\376\212\253\354\314\244\323\030\344\201FF\262\263\313\377s\346\247\270\n\3563)\337\225\375\220x\301Y\355\262\200\\:\001v\211\340\222i\315\252?`\261\330X\255\250\212\243\332\023\356\242C\243\252-\272\215\311\277\023\220*T[{\r\246P\177\352\271\332\027\316\002\305#\366\350_\006\217\\\276\253!\365\232\231r^\234zJ\260e{&\250 \354\307\335]\253\213}\231\277\343\251?\333)\034\345\244k\270C\"\021F\032\004\222\311h\22305\321\254 \"9\231\241m4E\bX\263P\262M\f\232\266\315\314+=\256\272\030c\231\320)\251\311)q\267\205\301\367"
+	.string	"\253\024l\331\003^w\214\3534\377H\376Qbg\306\007\230n\301}s\371\252P\t|\347\007\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdCtmReset.78.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"]\007"
+	.string	"B\31636@\215\222\016\274\201\276L<\202\311j\201\365\236\200L\237\255\271\262\243\325\200yy\370\177}`\323\261\345~I)X\377\214#\272\354\274#\373\355\352\322\316j\333'D\246c.\f\234\246\260y\3406\207\250ebDf\001\"b6.^\n\326$\032\2668\241i[\314R\236Z\022\222\256\251\001 '\021k\345\201\237\257w5\330\375\004;\244\213`\027\265\241x\005]T\023RD\254U\005\354|\352\363\240\306\327\222\220\364P\243\n]\214:\322\312\f\265V\262\344Ru\374\275\247\2428\365x \003\245\224\231Y\257\347|\326\253\331\335\2334\305\221\004&\022\213\017\225\314\214p\243]_wk\252"
+	.string	"h\324\351\003@\310\314\037h\204\321a\177\203\377\340/\005\t"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdCtmSet.79.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\334\001u\017"
+	.string	"&\034eG\340\2626\035R\342\206\260\367\263\007\252\243\27791{\312B\324SP\024\b\"\210\214A<\200?l\332\353\177\333\260\017\3434w4\370\241\001 \210s\030C8\035\264\367\210L7\201\202P\367F\025j\277\365\247M\366N)L"
+	.string	"R"
+	.string	"P"
+	.string	"6:R5\242\275\372\323>\352'\306\317x\345\317.\214\023kwGl@{%p\001\331+\366"
+	.ascii	"\331\253G;\307\311\021\033:\335\340\200\242\307\356rT\304\307"
+	.ascii	"\317\321\177\371O\311\324\362\351q\260\273\236%\023\314Mo\273"
+	.ascii	"\200m\b\366L\t\307>\363O\221\220"
+	.string	"\0379\246\317\240\261\353\362\332Y\234\312\242\304o~\373\376\352,{\263\350*\203b|\230\330\335Mdo\257\177\351\315Oq\025\343oX\2760\253\345\234p\264v_\016\274\372\201\366z2dC\202A\215W\230\310v \271,\240\331A\220\n\342\266CG\215\017\250\222W\334.2\237\265\242a\276\344\263\036\301\365\242\323\332@[\f\022\243\202P\332\013\232\321\026\023\363>\223\332\356^ze\005\tbx\350x\030\315\227M\222&\ra\037\333\3355\225\261o\363\203\274\346\007\235\346\327\236\372\263\223\017\"\312J\005\223\f\231W\362\321\256\344\243\236\367\321\316\373\250\327}\264\353>\352\023\222\t\"(ADA\fS8P\205\263\240b\362q'\241\310\221\f0x\001%\3440\200`\310m\344\350\330R\031k.\027\316\210\222\314\202\355\202hP\036@+5_\366\314\320-#\273\352e+ \020\203\221\232\270\0013\2415\306"
+	.ascii	"%\241|\3301\2321\262+\3071\026W\236\001\346^\246!x\206\273\006"
+	.ascii	"\266\034\261\272p\356\201UG\200\365\016\316~\242\360a\376\024"
+	.ascii	"d\206\367^q\216\346df\020\344\301\216d\234\300\216d\234\300\216"
+	.ascii	"d\352\204\003b\201\267\274\020\006\031"
+	.text
+	.section	.gnu.lto_frskyOsdCtmTranslate.80.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"%\f"
+	.string	"VWS>"
+	.string	"3\324t\\c\247"
+	.string	"v\331\251\034\t 7\356\314\226\304\320w\322kb\333\001\004Z\275l\266&h$d?\207~\240\323\024(\001"
+	.string	"\320A\273\036\032\311\362\ba\373?q@A\215\354\235R@"
+	.string	">"
+	.string	"B"
+	.string	"$\247\034\331\2751\203\306\3566\260\202\355\031\202\027\320\236a'\240=sh\353\370\330b\r\210~\214 y\354n\245,\036~\206\376\311GD\217\346\023Baw=E\317\347\246\267\235\3006\004\373!\002\236\343p\355\226(},+S\275\270\351\267\357\3138\312\346\f\376d"
+	.string	" \016\264\271g?i\316.=FxS\346\373\331wr\210\312\326ng\3013\327q\033W\f\266g\376\264?:\214\360\001'\277"
+	.string	"5v\270"
+	.string	"\215D\253n\033\232\217\302|\230\027}\324+\270:\257\226\b\2521\366 2\251m\007'\235\262\204\b(\312\327\211\315,\355\2213\351\n\373\330\356\256i\310\376\370c'\375s\023\240\202D_\005\243a\342A\003/\023\304e\232\"\271\360u\026\300\f\237\207\241v\226\312\3012\331P)\336W%\007\334u\250x\365\322u^\345\306\315\261\245!o=L\2606\224\343\f\266\233b\002\371\001\255\322,\r\231\333\275\322~\n\025"
+	.ascii	"2Ck\025\030\036\325\216\005NiE\006Aj\316\005\347\035\202k\342"
+	.ascii	"d\307\206\260\2150V\0026\2402\201vMp\001\342\001\307\034\024"
+	.ascii	"jp-/\204I\006"
+	.text
+	.section	.gnu.lto_frskyOsdCtmScale.81.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\035\f"
+	.string	"\346WT>\0203p:\230\277\005\254\024A~\314\222N\243>\370\365\307>#\013ME\300H\364\301E}\336\"\276]\020\206\004\372\363\300\017\002\021"
+	.string	"@\031a\217\375e\002\022\204\222\244\324\277\221\b\331;\245@"
+	.string	"?"
+	.string	"D"
+	.string	"\336GFY\262\233#\254\261\273\r\254"
+	.string	"\273\205\340\005\256[\325\t\\\267\354\331=.\256X\003a\t\022#\220\335\2554t\357\323\363?^\362\201\232\317\b\205\335\365\374@\317Mo;\201m\b\366E\004\337Q\356\232(\207l\312\262\321\342\245\337\276/\343';sw\223\001|h\270\330\335\254\263\263[\377\350\314&=\206\367R\346\353\331wx\204'\310\335\316\202[\256\"&\242\030`\267\374i_\3640\246\217\\"
+	.string	"\320\007\371\021}\276q\343\270\374\023\006\304\374\347\237^\341G'\b9\202j\\=\220Lj\333\301G\243,!\302g\306\013\024\233Y\332\"gR\025\366\253\335]S\220}\361\257>\372'& \304\002\f\234\005\243\201\362\341\352\270\031\202\233\256L.p\232\205.\003\267a\250\332\245r\270P6\324\312\306\325\311\001k\035,[\365\240i[\315\304\315\253\245 cB`\2446\224\343L\265\233b\302K\377\370\001$i\226\216L\354\326q=\023"
+	.ascii	"2Ck\025\270x\224\224Vd\020\244\346\\p\336\201\270&\016\021\006"
+	.ascii	"a\242\004b@\025\002\367\232\220\003\230\003\2319\250\321\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_frskyOsdCtmRotate.82.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\365\b"
+	.string	"\226\321?90q\323\001\200\306\0252\232\247[c?\224C\037\233\314_\245\020\317\320_`\262K(n\366m\355h\235\005\326\217\277\013NF\004\203\001\356u\252y\210:F\030\2767\331;\245-"
+	.string	"/"
+	.string	"0"
+	.string	"\247\330\013\262S{\366\314G\222=P\201p\240\334\354n\235#\367.=\377\342=\037H\272\004p\330]\313\017\374\270\347m+\330f\260-\023\273\036;:\373\242.&\376\311Y\243\217\026@\265\264S{dk\247\327l_\332O]\345}e\026{v_V-\273\247\006/\004\234&\334 \013\037/ze \244&D\245v\367\237[\267+\363Y\032\"\371\317g\375\301\346\204C\2631I\366h\222S\304>\266\273\353\031\332\223\240D\005|LJ\334\r\372Ht\033\204\250\242\343(\352\026\252\027\241\b\213\n\342\272\372A\360\2061\301\325\214m\343\2526\226\216\355\f}\361\357\310q\275J\323d*\261\033&\013\n"
+	.ascii	"2C7\0258\340\302\221\313\220\246\342\005\215\215\205H\315\352"
+	.ascii	"\n\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_frskyOsdContextPush.83.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"B\016470\217\222\016D\341[\333L\026X\221:a\231y\006\330mr\"\r+\203\203n\341\377\375\351m\364\214c\2343\376\r$\fr\021\\Z\332,\030T\325\203\265}Bd\nk2\f\234\246\300y\3406\207\250mb\304f\001\"j6.f\n\326$\032\2668\241i[\314R\237b\022\222\256\251\001$*V\213\365\201\240\257w)\260\373\n;\245\253\260\213\342X\274\206.\252\t,\032-\326\005\364|\n\364`\307\027\223\220\364\260\342D\2241\252\312*S\364\342\222(WI\310\337{*\252S\221\0078LJ\231\231\365\372\316g\275\232\335\375JS\037Ip\002\301\030i\311\314\b=\332\365u\267\246\n\204F\236>"
+	.string	"\204\314\374\205F\033\035\3667\370\017\376R\t"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdContextPop.84.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\002\21637@o\222\016x\r\200&\301\231\256\3516\351\364\333NX\367\006\331\237\020;\225R`\377o~:\234\255(BV\352\270\207E\201p\215\251\216\b\2449\213\006\352f\t\221)o4\f[\246\320y\3304\207\230qb\004g\001\"n\264-j\n\316$\032\2648\221eZ\304:P3\tK\327\324\200\222T\367\242\002\301\320\326\273\024\327\275\345Z\245\237\\\027\325\261x\025]T\023\\4^T\027\360\363]\350\301\216o&a\351a\305j\224A\352J*s\024\003\223)\226\t\310\337{*\312\323\221\0078P\260Z\357y\254V\261\271gi\367\221\004'\021\f\222UfF\350Q\256\217\2735U@D\372\364\001 d\346OD\332\350\260\277\301\177\360\207\004\n"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\005\025\306\251\310\227{\301"
+	.ascii	"\245[\264\363\t"
+	.text
+	.section	.gnu.lto_frskyOsdFlushSendBuffer.part.0.102.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`^\005e "
+	.string	"\006\272\310J\240\024R:\024\027l\323\005S\232\f\372+Ql\0162|\372\f\235uj\214h\227\332C\321|cU\351(\264\330s\252)\201\2748)g\2037\364~\214\2273E8\001\367\013Dc*\300w\002\306\221x\265\377\033!D\356\224\002\263"
+	.string	"\255"
+	.string	"\257"
+	.ascii	"\025\030\241v\223\n\310@\"/\022\364)#gZ\030k\220\3264\354\202"
+	.ascii	"\252\271\351\006\265\2333\037p\336,\037\340\034\362(\352G\001"
+	.ascii	"\3318\334M!\266\201\200A\366\225\033\211"
+	.string	"\265@qxd\244K\255Uwsm\270,K\337\370\322x\3236\350\266\032\3554\313\245\267 ?\352\013\204aDc\307\240\320m\nj(\t_+iEI;>\005\270T\342\230%\275\376eDi7\0373~\326f\334,a\304\212C\231`Q\tA\230%v\256S\030A\"ZR$\0372\276\347z\371C\210\234\032;\006e\234\002\370\215f\241\326\352\017\ro\334mg\331\276`\233\030\002v\017\005=\222\217\365\307\250*v\225%\213V\210\356\223\367v\034\242Y\322\353d\237\324\271\222Z\306\244\216)\251ap'\365\255\244\266\335\353\256\321N\352\263\2446\277u\227\247\272\327\244\246%\365\021\224E\250\034S\255Ig^*\r\323\213\307\217\277\325O\365o\375^>\222//\032#\rTqG\262Vc\315\215\317\362\271\214\333\322\252ZF\276*\325\277 \026s$k\2559\037r)\337\310\257\216e\334\321\017$"
+	.ascii	"\375\310/\tXk\327\003\tA?\362+\353\022\205\"\261G\255]\023\254"
+	.ascii	"\252~<#\004\254\372y5\252\177\341T\274\221\254\001k\265\244("
+	.ascii	"x\232\353d\\\223\245\255\211\203\326\274\\\030\273\373-Sa-\250"
+	.ascii	"\231\367T\230%F,\035\274\\\332\022h\032B1b\":\367]\307\342\251"
+	.ascii	"\315\230{\356\255\254\370\325\257Vk\3051\367\\7\223\b\225\004"
+	.ascii	"\361\032\242g\336_JS\025 \273O\266\005\320\362vr>\353W\034r\210"
+	.ascii	"Ht\355\016\036\350\221vg\214V\310_\272\213<\372\342\017\017\373"
+	.ascii	"Q \332 \376dgCVk\275qr0\035_\307M\217\340\321#\361\316\233\337"
+	.ascii	"'\205\310 R\376\357\374\361fP\213\006"
+	.string	"\023T\226!z\346\0335\221#\177\026\243t\271Q\0067\362\364y\316<\036\335\371v\353\323\331\331Q\021\342\324a\301\323@\"\305\210\036\035\0237\357lD\370\364>\374J\370\370vt=\236\256\207\007\202G\267\363\371\350l\f\270wB\307\247K\321\353\371t\364\353d\373w!V\026eh\211l?V\277\262\326\0329\311\"L\276\345w\200L\313.G\314B\223\242E\226\333#/\263\271\375\321\227\037/\263\307\002+[\032\242g\265}r\356x\342\32643\035\263\265\2458\246\300`6f\237\374\335\020k\2557Xv\016\256\300\354\315\r\251\262\326Zi\373d\373\2479k\213\333\004DC.\267}\022\333\336zN\345w*2[\303\3116T \216\355\"\210\331\366_\317\240$\\R\026n\250Q@\243\024S\246D\202\031\221Y\3404\006\200\002\031#\253:\021P\275\204j$\251\266\003\234\205\264\311\274\023\223\tA"
+	.string	"T]\0046\250\304\216c\241#\330\001\364)A\021\351#b\253n3\025\261\205\005\264\004\357\004b\245Y\271\346\321C\314m1\220\373\240\222F,\304"
+	.ascii	"n`\2053\322\032\306\257<a\275\310\347^\255\217|\2471/\356\317"
+	.ascii	"\324Sc\032\327\231\326NJ*\260\355_\232\2162U\224\215\323\360"
+	.ascii	"m\002\302\350\316\024\213\024\233\td\245\001\237\rgN'\217EP\331"
+	.ascii	"\016\t#\360^\214^`\007\231\231\341[\273\314\275|\271\031Q\035"
+	.ascii	"p\006\027\201\022\344\r\354\317\275\356\244\230\200r\222YK\344"
+	.ascii	"\362\340QS@7\024M\265\fx\017IhNz\211\273y\247\273\026\020N;\220"
+	.ascii	"\341\325q\246B\266\031&\003\337\037"
+	.text
+	.section	.gnu.lto_frskyOsdClearScreen.part.0.112.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\n"
+	.string	"\266QB<\020\005+\035\240\301\345$\244\016Gb\203\002z^\327\035!\234\024\345!\212\274\360B\363\352\253\273e\216\032\030Da\373\257\b"
+	.string	""
+	.string	""
+	.string	"\204P\304^~\223\n\343\332\212\325v\b!{\247\0240"
+	.string	"/"
+	.string	"4"
+	.string	"\365\265\005\260Z\007\315\266\273\364\335,\371\351Sr'_\252X\250\317\327\023\300\244fZX\037\227\003\347\002B\273k\016\310\335\335v\203m\004\373\013\001\240\321\244\327\327\352#*\232\230m\267\322\337g\371l\274\314\f\255\033\312\350\257\274\226.s\247\005\240$}\025\223\375}\357\236b\333\344\341\223]{~\0253\344U~}'\346F\206c\242\344tyr\347v\222\330\223\203\335\004BvW\001n+\322\271\234\320\374\001\231L:@\315Llb\266\335\250\n\266\375\t\026y D\320a\234\020C\t\n\216h\305\350\201\202\212B\221z\f\fZD\204\024\003\004C\372\331\226\017i\314\324\234.\333\034\351_x\276k\274\204\373\305\013\032"
+	.ascii	"0BE\200\204\t$T\221\002\310\003#\\1t-X\302\304\211N<\340\213"
+	.ascii	"\002\002\003b\340\236P\333%X\354lw\246\360\242n\350\264e3o\247"
+	.ascii	"\005\340\332C\n\013\315\226\236P\306"
+	.text
+	.section	.gnu.lto_frskyOsdUpdate.part.0.130.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\225\002\205\024"
+	.string	"\346#\201I\260\324Q:X\264\265l:\203\337\343\211sx\021\006\360mZ\365k\370\357[\236\034H\376\234\325,\250\253eee\273,\323\237\271;X\317\002\375|\350_\331\333\323-\375\rK)D\265b\212\203\314\361\314\225\266\021B\266L)j"
+	.string	"j"
+	.string	"k"
+	.string	"v\253u\361.l\373\200\360\217m\344\273\333\"X\321\202\350)\270\273\344\305i\342?_\215b8\225\365\343\007(c_\215\370xR\022\205)\273\333*\207T\fQh*f'\245P\350"
+	.string	"H\003\311yC\032\352\254\024\361\031\266\b\005\221N\312\240P"
+	.ascii	"\025\021\220\347\256E%\220j\201\263V0\273\353\313j7\200\333\226"
+	.ascii	"\331n`\253\217:\227<Y\017w*"
+	.string	"\331,u\310R\317\225ZG\365\007h\355\005i\227V\265dmb\r&\030<<\240\314\342\342\343\235\224\330\356F{\257\350\207\013n\320\356\201m\263\270\300\274\363\335\215\026\201\t\020\027\334\335\221\276\377t\037\317u\236\245O)\t\307c7\275\327s'/h\262%\341v\367\273\363`\327\231\245\026\004\326\243~\316'Pw\221\361\"\201\243\214\027u\276w1D-*\311o>\334\335\rQ\324\306\220\001j\352\310B~:\333\234K\026\0373~\326\214X\22482E$H\251|\2375\374\027\303\340\346\263\314g\314\034\030\262\273/1.\203\306Oq\32156\372\231\315x\361\363\276+\216\311\226\224\323\311\264\312-\265qr\3643?\367\337~TI\001\315X\246Y\331\240\343\222\201\341\350\2748\220\256\033\262\303\315L\016I\363\322!W\024\330\345\241\346E~p\271^d\313\266~*\031F6\201V\022\214|$\244\222"
+	.string	"'\n\247\0279\306\271\344p\316\371&\275\036<O\370\016\n/:\302\351rB\227@}^\005\013\372\331\234?\262\375F\005\374\211*\243\316\363n@\tU\254\327r\033\217Ra\355.\004\377\306q\\xO\003; P\002A\352\3166\350\020\216K_\350\020#\374\336-\225\222=\007K\360\360+1v\266\330\034y\357\262J"
+	.ascii	"\201\324^i[S\241\317R\020\255\311\0233\2628\322\340O\341\004"
+	.ascii	"\224\222@\032\344!v\341M\333\267&\317\245\361\036PXmlP\366\266"
+	.ascii	"\256\201\341\244N\001YXIk\233h\021\037\215\375\006\341\226\232"
+	.ascii	"%\362\261I\003\226{\353dc\213\005\342\024\001ZS\266\033 loD\350"
+	.ascii	"\2335X\347\312v\320h\034\273\202\023"
+	.text
+	.section	.gnu.lto_frskyOsdBeginTransaction.part.0.137.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`J\002\305\022"
+	.string	"\366awH\360\356&\035@\207\246\233\347\236\033o\275\233\017\213\007\005\034{;.P?:=\213\037\375\370/\002\214)\362F\0052\206\035\037?\377\221G\306\211_\344\036\214\3055\324\223|n\003\361\227v\351\r\3427oh\223\275wJ\001`"
+	.string	"c"
+	.string	"a"
+	.string	"\234\013\234\316\205\374\243\236\243\027P\317\331\027a\233\005s\313~\361PgAxP\314\370,\355nwnvx\353\034\235\262\266|\020%\3279\331\345\353\313pz\242K\233\240Y\013\240\017\303'50\022\301"
+	.ascii	"\360\305\320\017\032\017\257\213\227\026>\030)=^3\026\354\256"
+	.ascii	"O\032\356\214\333N\331\356l\271\0231\023'2\313kNP\223\024\002"
+	.ascii	"H\034b]h\305!\256p]0\377\304\203Z\027Z\371\312\254\306\021\217"
+	.ascii	"\212q\0276r\316$\247s Sf\263\330?\377\331\001m^\342>-\237y~?"
+	.ascii	" \300\330\356\266P_\306\262Q(K\371\220\365\036\027\032\356\007"
+	.ascii	"\263\224\366G\234D\353=.\326\330\275\211Q\333\r\017<r\336)\352"
+	.ascii	"k\027)\274\203\005m\t\214\275<"
+	.string	"n[\365m%&\362/\337v\007J0\246Qf\272\274qr\362S\252\355]L1\202\213'\360\321\222\300X\322\213\274\311\231\343YOww=q\354*-\037\376\337\240<H\001\300]\232[\214\345\300\025}\370\320o\337V\363\374hKFEnp\264\002\f(_\251\240x\324)\222\b+\357A\213\311J5\241\363J\272\n%\020N\272\224j\325\221\f\260\207\"A\325\251x\236\252C\235\356\304\221\375D\33302\215/\023\206[\241\2737\n\304w\2142\312!\375T\365\215TG\214\214\346\257\3234\326\346\314\261-R\345T\315\\\304\310&\313\213\324O9/\236\301\354\302m\246\006F\336\314\0216 p\002\221UU\007<\022\003\326\200\343\f\00711\016.\310>\242W\324\266\004\2373k\306\375\323!\rr!\363\333\325\302j/\226<>b.\212ApJ\271\013\3157c\030\216\210\3772\240\304\336\204P\n"
+	.ascii	"\306m\256\377\231 \206\377\336\220i\360\336\221\357B4/\t\202"
+	.ascii	"\375jl*\361\374\211c\323I\237\331\013,\347\205\313\n\345\275"
+	.ascii	"\016\217v\004\206o\372{\257\rc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`Q\n\035\036"
+	.string	"\246\357\250;`ne8\361~\260\337FX\242{\303`\313MM\213\bW3\2713\361\327kz\313|\271\325\037\272\325E\222T\266$I\230\212p\200.\020\302\330\204\316@\335%\215l\262\323\2262\236"
+	.string	"\221"
+	.string	"\225"
+	.string	"\017a\344 \212\374C\357\036\210\334k\310\273\204\274C\220s"
+	.string	"\362\r?\256\301\3073\3648\006\036\277\260\343\\:\276\225\343\024p|\302\215K\260\361\b5\016a\363(\312\263\210\306\037\314\270\003\031\327\212\361\0060\316\023O\323\317\360\305\031\270\370\236i\361=\025\024\3124\306\342X+\236@\305\2576\245\270\025\212+'\017\207\303!\330\263\304\3214M\363\304-\210&n \313<\317\260\022\327K\"'\022/ Zu\303L\256\252\234\252\222\346y\232}T\257\272\266f\275\306\342>}\035\201\250\252%\214\013TA\242\301\200\242\213\274\355h\006R_\211\225a\253i\236\334\270Q25\330:\310h\f\033\375\251\315\\'\225\271*\"s]4\346\312(\354\372H\314\025\322y\215\264a\256\222\326\274\266\375\352hM\323T]"
+	.ascii	"\346\332h\277\\\023y\271\"\352r=\304\345jh\313\225M\313\265P"
+	.ascii	"\226\353\032\226+\241+W5+\327\264*W4*\327AS\256gR\256\301(W3"
+	.ascii	"(\327\262'W\240\223\253\240&\327\037\223+\331\222k %\377J\362"
+	.ascii	"\021H.\342H\277`#R\312:`\260\264Z\213\323iW\272\222\246\037\232"
+	.ascii	"\226\3367\r\226\336\337\356*\335Qs\351\336X\232\027Uz\317U86"
+	.ascii	"@svQ\032e\362\204\332y\300\333\036@\344\326\246fP\006\360[\277"
+	.ascii	"Q\2734B\031\200o\367\f\316\033\035\224y:\223\347vQ\332\264\307"
+	.ascii	"\244\327\267;\026\307\211"
+	.string	"m$\255\265\326 i\3359\346L\212\255XY\316Zf9\223\277\335\331\371#\307\243y&\312l\322\267\353VG\023\037\321\326\tE\273\024\2126\t\\,5l\224\224Lt\312\3732o\204y\"B\270\007\342\203y\036\274\272:p\330`RC\006\f\326]\340\362Z0\371\253`2\254\302\326\226I\n\336\t\346I0\031\301\244\017\302\003\007Z^\337\330`\344y\205\f\262\026`)po7\216\316\360L\227\300\244p\2742y\346\254\274hV\336\263\200\327W\022p\317\003\026MZ\334\034\013\300\023f\fn\024\340\025\352\371\005\333\306*\367\246\252\334[\321\rH\bN*\200\243\204\253\2260\265!CR\211l\204i\332\364\214j\020\225{S\336\337\224\224\224\367M\203R\326\023\200\244\250Q(#r'2R\222\244\222\341\360\002\231!\252\016\021`\024\005\231c\204\210\004\"\022\210\226\034Z\253l\307\006>%\f0\f"
+	.ascii	"\020\f\2004\204\f\235\006\236\330K\343\263g\226]\022?\323o\200"
+	.ascii	"\236&U\360\313\024\256\3479\320S\220\253\243\353Q\331\032\245"
+	.ascii	"f\370a\330\331Bw\232\354\020\305^\342\354\340\340\316\244&\035"
+	.ascii	"\331^\177\262\274Z\375+\370\264\205}\313\217\366\247W\360\213"
+	.ascii	"\352\232\363\216\376NL(M\340\021\336\352g\001\250\352\352\177"
+	.ascii	"l\255\363\251O\247\354\025\277[\0307\0012)9\365\007zL\242\363"
+	.ascii	"\357pOj\361|5~+(+P\241\214\212\300v\340\347\007\203\351\317\237"
+	.ascii	"\231d\355(\335!\220@\256H\034\033T\366@\310\343\301\202c\203"
+	.ascii	"\312\376\340C\024H\316\004\342\030\2408&\020\314\t\3041@Q\263"
+	.ascii	"\237\211\344\203\027\334\375L&\336#U&\325\035\200C\020\225\261"
+	.ascii	"\233O\205\005Ne\032~\346\256\t3a\325D<M\335w$9F0D\342\322\r\250"
+	.ascii	"/>,9\253\002"
+	.text
+	.section	.gnu.lto_.refs.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\375\007"
+	.string	"&\220))\200K\263\00630\027\214\r0\00330\00330\307\230\247\2206)P(D\216\331n\377\357\357\245MBVvo)eJ\001\032"
+	.string	"\035"
+	.string	" "
+	.string	"\t/\302K\260N\353\300+\255\321\013\275\317\353\274\357m\336\345e\353kD\377\bb\274\027\253\305[\261R\254\023\257\304\032\361B\274\017\253\303\333\3602\274\013o\344Ux\003+\365\001/\300\033\271\247\254k\025\266\2205zm\261z\326\266\254\231\254\245\036\253\035\034\033\032\031\037\372\036,5\255\274m\201\246:\251\2514\344\350\326a6o1I\263\270\227\215qj\260\026\274U$ `\"\221B\356\264\006\3048\250\335\234\206W\212\376}\244\254\201\354X}\217\366"
+	.ascii	"\232\303T\026\311\333k\023\022\342iY\036\351\004\343O\212\223"
+	.ascii	"\301n6\263pC\213\340\1779\243\235\232\340&\237\260U\331$\267"
+	.ascii	"+\344X\301\271a\366\037\007\037W\202a\210\302 \370R"
+	.text
+	.section	.gnu.lto_.decls.4b534b857a8b7c18,"e",@progbits
+	.string	"(\265/\375` c\245w\001\332]\326\203V LQ*\351\277^\202*\256\260B\367[\210)\252\320*j\001\257/\0014s\f\025\241\306\021\273\316\374\376\267\036\335\005\376\177\203i\255\304*\313>\022\271\031\374\314@\320\344\357\354\372\245\256\312\3613u\027\343\365\342\340v\273\252\007o\270R\024\350XB\b\331[\356\024!\007\013\b\210\bA\034\362PQ\335\362G\373\260kwmK\221\216\320\315\320@\354\332?\336k\316e9\347\020!p\316),$I'>\246J\217i\244\307/\322\267\331\233\3638)\355\365\315\243w\330\265\267~\213\327TJz\253\255Z\013+\257\267Z\207]\243\tZ3\223\206#Y\244\340"
+	.ascii	"s^qB\204H\300\021\214\251\023\377\352\245\177ke\231\315`\224"
+	.ascii	"\327\030\253K\213\220\275\306\277ui\347\350+\031gI\210\032\377"
+	.ascii	"\262\245\277I\322_!\251\315\366\346\354\266)\251\333D\t\312\216"
+	.ascii	"^\312QI\340\234\364\r\013f\346\306U\324\225\306\277@\322\266"
+	.ascii	"\2636gGu\317h\032\357\250\206:\b\">3\324Q8\347 k9\240\261\226"
+	.ascii	"\0033"
+	.string	"n+\310\310\211\177\273\322\337\252v\352\271:\002\327\3707*\375m\2216\237\2659\377~\321D\263\205,O\331\370\357\2467S\020\035Xr\215{\t\307\374Z\232=5~\017\246fG\354\333\bDL1KFv\360\311\325I-\343\350\262\2266\256\211\326\225\032|D\212\330\262\021\210\230b\224\356\270\370r^s\264\330\275;\306\224\246\335)\361\345A\361\345t\261\200#\0201\305\300\020B2;\273\336\bDL1Dw<\302\260\3309\232!\016y\250\212\3062\347\365!\3746.\312\r\273B+\305Z\031\201\210)\006\351\316\006_\316\253%\362\203 \302\026ZA;x\327%z\244\352\313\312\375\026/\213\235\273cL\351\021#Q|9\257\377[\331G\315\242\225\032\251]tR\013uP\267\350\241\316]\324F\226\260\211\354j\013-\230\33306\3608k\316C9\347\333\260?\307\026Z>\313\345\2161\345\241+\345"
+	.ascii	"\256\250<9\001\314y\r\201\023\202\206\214G\322*\200\265f\003"
+	.ascii	"!\030a`\3437\222\364\314\366\346\274\235\2659\337a\351o\001\277"
+	.ascii	"\240\215i\311\262\342\036W\330\272\032[/\366o\3158g\221\273\254"
+	.ascii	"'\215\337;\322\267U\237\365\253\371\222\324\305\312\214\276\030"
+	.ascii	"v\313\314\217\027K\\\215\337DV\357\230lj\303\rz\242ck|K\230\336"
+	.ascii	"\376\245\267x\351-\224\224\203[\372[+U\314e\027\231^c;\305\336"
+	.ascii	"\331U\003K\345 \210\370U\222\345\260\234\355jf\b\207\334\341"
+	.ascii	"h|\233\226\336jp\332B\253\301y;\226n\360#\275\305Jo\243R\353"
+	.ascii	"\304>\261+\b\013\345\226\211\225{\314\320\232\313r^kb\254p\261"
+	.ascii	"\201\326\370\266)\275\005q\326\024\026\026\026"
+	.string	"Z\020\347\355P\272\201\2759\261\2659\025`m\316\333\331\233%\326\255\r\263x{\313j\374\024K\336vN!\222\317\032\377\226\355\266\255fkM\212Uc\213f\327\n\327\346\342\032[$6\315\256\035\330$\267J\254\332\315\2405\2579\2575\275c\020\211\221\306\034\354\315\331\326\346|\211\364\266\203\363\026\026\332\016\316\377]\357\177\214\214\234\216\252\272\306w!=\n\351Wks\336\256\226\314\032Ie\\\005\3515>\b\351\355:\304\206\331\261k\344b*\243\345\274v\3200\310U\007\330\370\007A\304\267\314\344\034\226s\376\260a\312\013,\271\361\255\330-\240\312\"^\223\276\323\267Y\233\363\253\2759Sks\276\203\333\255\303t\301\022\177{cGt`=\b^i\360\233\027\360Z\n\200]a{^\270a`\220\001\177q\241\253\205\035Dt\2604 \225\001\025T\240q\201\266\300\377\f<\375\317&\t\234 \002%x"
+	.ascii	"\f\r@2\300(\"E\b'rx>\330\001c\302\337%\214\370\273/\340k\376"
+	.ascii	"\363\003\004H\341\n\340\244\200\027\007\374=\002\003\37668I\340"
+	.ascii	"\322 \344\334\003~?8g\016\337\001\032\001\037\366:\234\003\320"
+	.ascii	"\023\300\337\033p\360wwp\265\030\033\022}\232\367\247\325B\363"
+	.ascii	"w\207\277q\376\266\301\340\357\316#\034\374\262\327\177y}wzP"
+	.ascii	"Z\004VIw\347\311],\347\222\337\276\375m\376\335V\311\305c\341"
+	.ascii	"\035~S\355\032~sl\016\354\t\220\344\007\301n\342\265\324J\032"
+	.ascii	"XB+\277\035<\013\337\360\233Z\177\033\375\227\312\275\273XS~"
+	.ascii	"\353\345\267_~\013\370_\360J\371\373g\315\306\337\371\"\243\330"
+	.ascii	"\022\334\003+\274\202\337\264\371\255\b\264\246\263\244\337>"
+	.ascii	"\240\354\350\202d&\213:\262K\367\337\271\337\356](\177\247\020"
+	.ascii	"\343\360\233'\370{\352>\271NB\224\330\372\242\3407IP\3423?\376"
+	.ascii	"\273\240\007\031|\234h\022Z\267\311\377\016\272\003\227\371\315"
+	.ascii	"\026\256\212\034\036\363\233)\374vD{\235\277\311\203T\024\341"
+	.ascii	"\001v\003Nr\277\245\362_&\267\306\337\304\270\3776\375\277\340"
+	.ascii	"\277pn6Kw-\3407wl\322N\340\202\366\346\030\374\346\005Dk\177"
+	.ascii	"\227\340.[\006{s\026\254\007sD\313\270j\027$\301]*\371o\217["
+	.ascii	"\360\233\":\206-\301M\373m\f\033h\235\377\036\370\377\001\312"
+	.ascii	"\303o\346\374\027\211\221\337\352\370\255\326oy\374v\354\277"
+	.ascii	"E~\033\342\267d\2775;\300o\177~\213\200\277\363%[2\376V\304o"
+	.ascii	"e\374V\004k\302oC\370\255\323\003~\373\364\333\006\374\266\204"
+	.ascii	"\337:\340\2673~K\302o\241~+\001\240\337\216\2606\244\376;\366"
+	.ascii	"\333\252\273\376W\354\267[\037\210x9\235\204\337<@\b<`7\360["
+	.ascii	"\027~\333\202\355\300o9\360\333\024\277\375\300\177M\f\271`\377"
+	.ascii	"\r\360\0177\310\355q\001\374\270\212U\177[\342o\022\334\345o"
+	.ascii	"{~\353\363[\236\273ee(\266\322\274\377-\301\343\277)v\\\020\350"
+	.ascii	"\370m\361\357\022W\353\035\234\005\233\374\315\217\367\376\233"
+	.ascii	"\365_\033\377}\372o\321\177\207\376\233\374o\361\277>\377=\361"
+	.ascii	"_\236\377\206\340\277.\374\267\205\377\352\374W\003\377U\341"
+	.ascii	"\277(\374W\002\377\215\300\177\037\360\337\006\374\227\001\377"
+	.ascii	"\025\361\337\020\376\233\363\337\017\376\233\200\377\022\340"
+	.ascii	"\277\002\370\357\006\377\305\371o\207\377\306\374\267\377\373"
+	.ascii	"\277\t\377\376\362\367\337\337}\177\353\375\235\367\267\225\277"
+	.ascii	"\355\376\236\373\373\311\337M\376V\372\033\356\357\265\277\321"
+	.ascii	"\376>\373\273\354o\262\277\305\376\376\372[\206\277}\374\255"
+	.ascii	"\343o\253"
+	.string	"\277\275\376\356\372{\307\337W\177\343\370;\352o\250\277\235\376^\372\033\351\357\243\277\225\177\227\340o\030\376>\376\026\313o9\374]\342\177\006\376\376\371;\305o\267\376o\371\357\347\3667\361o\023\277\275\371\355\n\177\363\374-\202\277w\376\263\360[\017\177\203\340\277\332\377\016\376\356\300\377\342\337\033\370m\f\377?\374\335\302\337$\376\013\376\235\201\277/\360_\205\277O\370\373\001\177\213\360\267\007\177\017\340\357\017\177g\360w\372[\302\337\206\371-\337o\367~\233\345\267q\277\205\373\355\331o\271\376\373\374\366\352\267V\2775\301oK\360[\031~\273\342\267\311\337\"\177{\374-\t~\333\341\377\321\177(\377'PXXX\370W\360\341\247\211\373I\b@\271&fI \020'-8\317\306\220\r',\363)\257\214\n\036\306B\343\005\351O\256\r\257\n\266\242\034\332\342GV%\356v\3558|\207\302\232\2254Ea\244\340"
+	.ascii	"3\023\323\001\360\224\031?/4\374\032\177\246"
+	.ascii	"\207\024\241\030\177Mwu8J*\2440+\f\252\016\n\236\223\211\261"
+	.ascii	"Uh\326\3703FP\232`'i\225\222o)\257\311*\323v\003I\214\3068\016"
+	.ascii	"\017\001\276\0215\276L\035\206\303mx\211]\017\005\273}\255\241"
+	.ascii	"q+B\002\245\361e\344\322\333C9O`\017\345\3741\033^\203\333{B"
+	.ascii	"\250v\274\206f\026&\256Fc\020r\216\325\316/8\034`\260\022\234"
+	.ascii	"dK9\264\005\3558\311\217\221\340\264\263\365\224\371\206g\024"
+	.ascii	"\325\330\256\366\346\304\2616\347\035\3149F\303kZ\342t\004\237"
+	.ascii	"i\341R\327\302\f\033\301ev\305gx\305cw\006LVDd\313R\f\013iY\236"
+	.ascii	"\341\"z|9g\033vK\271\024\037\315\336\2342e\351e\306\322\313\024"
+	.ascii	"I/3$\375q\030\026\262\365C\312^\343[9!:\226C0\030\376\262+\026"
+	.ascii	"\202g\300A\356`\247\t\321\022\222E\263\3245\265\224\3128\001"
+	.ascii	"\371Q\003\326e\324\304\007\356aW\374\003/\261\327\217\353\207"
+	.ascii	"E\343\007V\324\371e\226\227tb.]\\,()\261\360\300[v\305\\X\013"
+	.ascii	"\353\300;.\013\fu\2130\027\316\201\263\356\272$Q\224\304\207"
+	.ascii	"\271\360\225\3222\025|\261\343\311\211Qks\302\245X\032\360\222"
+	.ascii	"\206\326\032_\003Xz\r3\244\327\300#\375\261\025\236j\241\243"
+	.ascii	"\310]\343w\332\324\365\303:\232*\344\303Smu\304\bWa\034\230\312"
+	.ascii	"\256x\n\337\300R\030\352\026\205\300\261PebW)nJ\177l\0037\311"
+	.ascii	"`\263\302\321\370\3075p\224\233Y\022\226\306\017\301)\n_\316"
+	.ascii	"y\006\246aW\034\205\237\260\f\fu\213\242p\013\034\343\256\313"
+	.ascii	"\013\260\300\213ajc\262;\361imN\rA\351c\002S\0308\211\206\n\231"
+	.ascii	"\034\227\306\217\321\222>\004\244'|x\t\277\260+n\302.pR{\271"
+	.ascii	"H\270i\216\0173\341&\254\004\305\304\322%L\214\024?&K\n%}\214"
+	.ascii	"\223\3641p\351\217\217\260\321\214\336:C\t\027a\"\273b#<\204"
+	.ascii	"YX&V\016\t\033\341\034\310\227\363\212\215\260\022\013\335uy"
+	.ascii	"\201\2530v\306\027;\261s,\305A\267\r\307\205\275\"\246\306\217"
+	.ascii	"\361J\037\323\225>F\253\2200\313\325\032\213\306\227\360\277"
+	.ascii	"\203\235f\007\355\0139\252\256\306\246\2659-\223\234_Al\345e"
+	.ascii	"\251G`\230)-\031]\375\345\002^0v\275a\356\337\365\322^.R\227"
+	.ascii	"*EDp\021[\206\271~\267\n\232\024\334\327\214\034\227\026/bZ\244"
+	.ascii	"\217)J\0373\224>-L\377\333W\026\303C\353\251\213\357\356\031"
+	.ascii	"\255\035\354P\227\022\262\306W\357n\371\335\273Z\356\236\b{5"
+	.ascii	"XHUW\332\211\237\206\311\313\342\204\327E\2441\226\225\003\037"
+	.ascii	"Nl4~z\305\312\235r\257\334\273[\345R\261\353\305\273Q~\355,\334"
+	.ascii	"P\223\301\245\224B><+x\351\204\002\371.\336\255\013\303\347\344"
+	.ascii	"N\220\005\336\225\263\203\326\016*+\373D\020\223\222\243\b\240"
+	.ascii	"\333\214\275:\032\3744H:cm\316\247V\351S\031\351}r\241\330\025"
+	.ascii	"\347\316M\021R\252\321\370)Sz\202lq\316\027Z\234\363(azTKz4."
+	.ascii	"\375/\023\234<A\272\272\306\377\215{\023\244\033Bj\374\020\326"
+	.ascii	"\256\032M\211u\210\205\3322\347\354v\341\354z\337.\333mk/\027"
+	.ascii	"\351\242\335%\217\273h\367\355\246]\265\017Sl6\"\272Z\343\313"
+	.ascii	"9\277\375\"\241\361\302Wl|9\347\0208!B\244\203,f\234\245\330"
+	.ascii	",=j$\275I\256\222_5Siw\325p\331T\316AW\355\026\n\346\034Tc-\007"
+	.ascii	"\326rpN\2011\306u\342\243cH4\370@\037\324\f\215g\216\234-\373"
+	.ascii	"\204\210\032\233\321d\027WP\215\217n\245\377/\3315b\327[v\227"
+	.ascii	"\327\353\366\270>\312Z\207TY\257\3351k\007eV\331\301\327MDy:"
+	.ascii	"N\261\273\332\365\216\375\216\335!\267\210\3262\347l\343\356"
+	.ascii	"\330\005r\277h\224kVj\270\322!\005\007\030B\006\t\026\037\332"
+	.ascii	"\211\377K\344\267\310\177\301\256\220;e\004H\245\361\r\313\371"
+	.ascii	"%\242A\210\\\037ac\0219\322\273\2647\347\002\254\315y\277\376"
+	.ascii	"\373\243\2275Z\256\322\2424\2763\344\374\006\031\212\221\306"
+	.ascii	"\3258\306\332\234Gm\244\032\254\315\211\231\354\315y2\224E\372"
+	.ascii	"\337\256\313\325\1777\370\256p\335-\247\300(rX5\\y,\300\356\016"
+	.ascii	"\273^\036}uy\364\332\325a\355\240\362\007\313/3|\345\234qB\240"
+	.ascii	"`B\354\2240\376\257\226\331\305\212\351cj\363j|\263r~\265\354"
+	.ascii	"\221\030PR\032K\300\332\2348\337\034QC\230T\2415\376\357\325"
+	.ascii	"\265\222A\033|\352\322\270\n\255F0\210\223R\343\237p\351;\355"
+	.ascii	"\bi\031\004\265\314y\2755n\322]\2722\272Y9\343\"\2718\"\354\302"
+	.ascii	"K\343\332\270R\027\307\205\272OW\306\215\272Tw\306\275q\247\354"
+	.ascii	"zk\\\246\373\342\302\2701n\327l4\224sv\242\261,2\252\342\242"
+	.ascii	"E\213^\n-]\026\177\316\255q\211\216\\%\205\335\032w\310\256\335"
+	.ascii	"\262eZd\246\304\267\241IaT\020\f\360O#\2515\2627g\007ks\306h"
+	.ascii	"\240\3732c\331\370gX\372\363*\375\257\322\357\322\337^.\322\261"
+	.ascii	"k\306Yc\253$\347W\351\2661!\022l\374S*\375\371\"\305\2617\347"
+	.ascii	"O\026\351M\300\364\346^\252\200\273t\204&\351M%\351\315\261\364"
+	.ascii	"fWz<\252\364|\366\346\374{\020\304\0060V\204\276\004\227\240"
+	.ascii	"f5\250\326\3000-\210ta\353ufii\307\024\030@k\367%\265l\334\200"
+	.ascii	"e[\340\326\255\306\355%\347\375\005\002;\254\2044\276\177\203"
+	.ascii	"}G\347B\250K\007\351\320[\2220.\032\324\254OIV~yN\234\230\210"
+	.ascii	"\032suu\031\315\320\232a\330+xRp\2000\362ZFG\321(\327\274tbm"
+	.ascii	"\221\202\003\254\221\3276zj\004\"\246\230\026W\364\370\032G\347"
+	.ascii	"uUoY;(\016y\350\212\226e\316\271\363:JS\031\262T\373\373\254"
+	.ascii	"\363\032I\317\321\004\255Yi\257$\221\202\003\314\322|\275\327"
+	.ascii	"[\272\257\265\264\236];\257\257\274\361\032K\303\310\353\030"
+	.ascii	"\375D3\264\346&\364\310\036^S[:\342\200/X\355\315\331\200\326"
+	.ascii	"\346\274\371\"m*\275\326w`\313>\243\322J\204Ti+vm*\177\323u\335"
+	.ascii	"\220\206\272;\036aN\374\367\224\367\335\337gm\267A\357\355\007"
+	.ascii	"a\343\226\222\363\236\242\201\205\021\0354\032[1ks\316\230E\351"
+	.ascii	"\214\221\2759\355\230\\C\351&\315\244\237\264\023\273\036i\264"
+	.ascii	"\367\232\323s\275\326Kh\224\034r\306B\262\204+\262\214#\262t"
+	.ascii	"C\353\264\277\223\314\265\2224\265\271~kqD\214/\347\025\247f"
+	.ascii	"\212\312\221<\032|S\231\036\017\246\307]\322c+\351\337m\357%"
+	.ascii	"\177'i5;(\202\013f\232\250\300)5n\266\234w\233\315\311\004\265"
+	.ascii	"f\264\234s\215\f\216\255%\267\306/\2646\347\261\2244\315t\251"
+	.ascii	"\315\326\346\004\341\226\246K{sZ\"ks\332u\351\325?\260\242,s"
+	.ascii	"\316\377\333\254\215\364X\223\365j\327.\303k\316J\312:H\017\271"
+	.ascii	"\3532%\272\002\205/\347|\021E\326\344\272\254\211\364\323\021"
+	.ascii	"6\276\234\327\262\026K\303R\013\021\"D\nf\310\023\262\031|\254"
+	.ascii	"$=>K\217\205\244\027\361e\007i\224\034\262\320\225'\313\260\026"
+	.ascii	"b\327\036r\273\346\036\322`I\260\234\360\345\274\206\300\t\261"
+	.ascii	"!\210\222\301)'>\006\222\036o\245\307Y\351\255Z\017\273F\023"
+	.ascii	"\215\357a-\375\317/\177\f"
+	.ascii	"\232f\205\306\262\361= I\357\201\214\217\357\354b\265\204vD\325"
+	.ascii	"\334\231\221yq\371\331\345q-\220\270\306\032\237~v\356\217\306"
+	.ascii	"W\343\263\257\377L\300%#\0342\266l9\351\024`s\321\231\231\322"
+	.ascii	"IWu\224\244\361=\260\300\202\345\324\202\223f\"f.\370r\206\002"
+	.ascii	"\201\277H\361j\313\373\251\245\n\240\340Q\3433KO\365\0168\031"
+	.ascii	">\300T\251r^\301\231\272U\240d0}]/K?dX\371y%\206\023\262\034"
+	.ascii	"=\025c\347\305\013\332\226(Q\316;\254\273\034OL\252\253\242%"
+	.ascii	"S~\336\331\301=\247#e\343SJ\f\233\222\"\266\306\247\235\006v"
+	.ascii	"sL8IN'\247\223\223\316\222\345\245\323,I\006\023`\316P b\222"
+	.ascii	"p\214E\235s?\351\354\334\314\325\035\217\252\023\312\252\314"
+	.ascii	"[\240\234Ob\374\264\344\r\321\b\321Xb5>\316\frr\330/\002`Rp_"
+	.ascii	"5\204Av^\215\217S\025\027\207\375\210\3600\303\372\006m4>\316"
+	.ascii	"\322\271\344\\r\276\021\221:\200RZ>\335~\276\205\225QI\032dc"
+	.ascii	";\325\210(u __\225\306\277@KZ\332\2516\270D\231Hq\222O%?\325"
+	.ascii	"\n\315\322v4>\223\310\235c\347\330\211\366\200\274\r3\226\366"
+	.ascii	"|\234G~\242\2316\264\360 j|\236\235M)\215+L\343\323\354lW\320"
+	.ascii	"\242\b\033\237eg\373\302B5\330\3704r\266\261\253%S\032"
+	.string	"\237dg\253Y\033\303\333\301\366?\306\002Y\003KC\023\023\303~u& \226(RA\210\020i\322NId\024i\374\013d\f\031\222\246A\353\215\311\216A0\260\260\230\254,a\316\244\004\t\302U#\367\245\366\227\006\004H\326\322K\222\0329\032\337\0020\037>LB\233\363\220\250\231?<>\301\306\267 \207\227\327\2715\304Ez\226\251\302\032\337\002\244\263\353\354:\267\300\byTaa\243\361o\274\2349\316\034\347\026\030\2409\224\204\252\307\311\343\347V\023\032/\032\237;\036\267\301\206\231\225\221\306\247\216\307M\235\261\315h|j\235Y'\326M\224\323\352\2642\363\300\262\264\200\301c\260\361o\314N\252\223\312\314\263`so8\356\\xEE\235SH\300\200,\341h|NMyZ\002\330\370\274\021\326\345\352G\343\323\006\006`\260\t5>k\340-5;\234\020\351h|\322\210\202\001\343\204\352J\373\242\330"
+	.string	"#\343'\024M\214 \036o\215\317\247\224\315IFU\343\323\351qf\220\256=\260\306g\f\274\245F\310\024\254\0337E'\322\211t6\201iY=!?\245\223\351gS\024!\027F\032\237K\217\243\242\022\245\361\251\264!K\360,\257\361\231d\327\260\336]\030\033\215O\027\230\356\266"
+	.ascii	"\273\221D\357\034:\207\316\243\006\320\220\202\3732\347\250\030"
+	.ascii	"\321q\032\375<\032@\023\273)\215\317\242\234E#J\343\223\210\355"
+	.ascii	")k\260\361\311\302\256\321\330@\362\345T\201\334\031t\006a?\233"
+	.ascii	"\231\300\224h\324\300\332\2224~\005D\316|f\223\020\314H.L\nj"
+	.ascii	"\007\0300&a\030T\t\2247\266\306&a\240\013,\251\306\246\340\343"
+	.ascii	"d\242\260`$il\006>.\020\211\030\225\306f\230\n\240\276|1\233"
+	.ascii	"\004\321b\201dy\"k|\033A.\\\314\277\272\032\253\271*T]n\376\265"
+	.ascii	"\032\035\330\212\355rH\231+\222\262\267g\3665Y\322\204\251r\361"
+	.ascii	"\202\357f\337\223 ,T\032\377\017D\2133/B\215o\223\246\247g\346"
+	.ascii	"\245\255\2036\\xxf^\330r\306N\260\n)\313\315<\riZN\002\033\233"
+	.ascii	"X\036\207B\251\253\222z\234\323\222!t\215o\3034e\212i\205\001"
+	.ascii	"\\Rp_1Q\254\\@\251r\323\212\214\221\247,%\215M*\217\213b\022"
+	.ascii	"V\244\261y\367\270\2553+4\n\353\352L\273\254\345\314\334\222"
+	.ascii	"\027lQn\332iiq\212\231i\361\342\355F\343SPen\316lb\203D\361\260"
+	.ascii	"b[\322\370\024\034y\362\304lb\203\270X\342\220\313\343\321\370"
+	.ascii	"\024\364`\302\304lB(\005\367\365$\216iml6\371\226/1z`\321Y\021"
+	.ascii	"Z\3255>\0054\322\2666\023\316\346\f\004\213\t\034|oo7\341P'u"
+	.ascii	"W^\215M\267\016\243G\207\325\330\\r\203\222\324\301\260kX\314"
+	.ascii	"\007T\216\306\247`(-\315\\\353\234s^\242M\200\260\361\205}qC"
+	.ascii	"\322\330\\\033\332\213\033ll*\001!c\206\252\030\215\315$ \376"
+	.ascii	"\307`\277\2713\034[\202\004\"Y\311CC\243!\323\303\310\034\334"
+	.ascii	"\331\231R\203I\253\273+RV\006\001 GK\265,\201^\215\337A\307\330"
+	.ascii	"\230I\026\243\354\003\341C\260E\034\217\273\306d?\b\"@\020\371"
+	.ascii	"\301e"
+	.string	"K\343wx\022\"\304\024\013\001O\n\356KI8\205T\344\246\030\366\222\353\222\324\330$\002\202m+\217\253\361\377\314\260/_D?\302\314!2W\272\260\231mp\032\242\365\024\b\004\210\371U\201\217\"\351WZ\013\247 7\277\216\250\224\346\032\2333\200\330\220\005\006V\326R:2D\245\3619HI}\370\300~i\006#\005\007xv\2551\261r\304\313\313\204BA\231\263%\005\367\225\241\240@`+D\364\352\032\237C\220\255-\263\313v\021J\301\001\306\320!\325\235q\335\354\332\3206c\313\217+\377c\020\200\225\346\327\370\034t`\231;\260L\035Y\3172u\330\314\2243\024\004\274\236,3\024\024\210\232>${?\032\233:\304\3622\321\223\031\226x\2105>\207\246\3645}f\225yeV\231V\246\225\227\220\0062\265%\325\3705S\322\327(\251Q\303\304\261\0246u\023G\220\236\232UcS\312\016j"
+	.string	"\013\324Z\322\330\274\361\27555!J\032\2336\360[\227\375\r\331k\374\277~z2\326D\345GT\024\366\353\212\252\231a\3120e\230PzzRp_&T\214\227\217*\027\215_\223\315&\263\311tB\312\223\202\0034c\334t\352\250\24361\037\215M\030\230\311\206\243@.[\215\315\0274Y\314$s\311L2\225L% [4$qK\233k|\032&\351i\206\230H&\022\366\333\313\243\3012\205L!\363HD\230\024\334\227\321\315\243\024\210\337\r\032\215\315\242\032\24280\\\032\233D4TKl,\033\233,\360[\nE\tv\324\330\034\242i18h*\301\244\340"
+	.ascii	"\315|S\031B\024\273\033\215q\341\351\244\212\257\2601&\374\336"
+	.ascii	"\006%cY5\360\333\255\253\272\023\362\002\006\007\202\301~g\316"
+	.ascii	"v\235Zb\312PL \302\204\301~\251\022\307G\024\024\b\231%\253)"
+	.ascii	"\312\306\337P\227~\203X\227.\370\213\3159g\250|\261HI\301}a/"
+	.ascii	"\307_\254X \230\264\306\370\257\377\234\340\212\362\032\377\317"
+	.ascii	"\016\376\2171\253\274hak\374\r9\322\343=\314w\334w\334\207\375"
+	.ascii	"\322\234\263r\315K\250\226\236\024\034`\206b\002\361\377\357"
+	.ascii	"\330\317\234\362\203+\255\3617\264H\377\333\367\177\346 \246"
+	.ascii	"\234\363\013s\315LB3\347ooMkA\374\033\354\265\002\370\217s\276"
+	.ascii	"\003LX\263\020\033\225\234\263\355\222\372`\013\242\261A6\355"
+	.ascii	"r\036\242RN\200\252i\210J\206Q\031US\007\2432\252\254\034\342"
+	.ascii	"Rv`\312TJ\243\262\234;\f\r)M\230j2*\013\312\035\214\312rSf1\245"
+	.ascii	"\311\346\225J\231\207\246r\207<\224\203r\331T\323\006FCTMFeA"
+	.ascii	"M\035\214\312\250\232r\031U\346\220\207\202\230\216\2062S\207"
+	.ascii	"\\F\325\227\313\246\2328\030\225M5"
+	.ascii	"\031\225Q\201Y'GW\340`\254Q\301\252a\227\030\re\245\244\032A"
+	.ascii	"L\034\354\214\326\251\214\227\263E#\312L\331.g\001\344\\c\212"
+	.ascii	"\t/H\206m\023\262S\022R\0224\345!I\250j*\017\331)m\2663\3721"
+	.ascii	"\225\363\017!\0249)\347\234EP\256vY\313\332)\255jd\027D9"
+	.string	"c\220\327\234\223rV\332l\227sV\346\234Q\246\032k\316Q\034\214\226II9C\341$\345\032\312%D97Z\226\266&\243\262\252\251\234%ge\313\\\264*\255\221\213\251\274\314xTLi\231r,\273\3109[.\351\262\t\206\337\026\275!1r\360\b>*\214(t\222\311\035\n\222*\262\304\320\2078|\201\004d\n\031\374\250@\246\340QQ\214\340pT\001\204\213\252\3171\211<{\212D\023\025\250;) -\320)\252@F\232\243\360@\375!&\221D\037\037\"\362\003\265G\205\017O\221\370\301\021\251\342\003\013||T\024\213\306\"\n\203\361\210\"i,\242&\206\252\017\216\001\210\347G\3759\217\302\203\017j\217\221\247H\201d\221x\034\276\240b\203\252\036O`\241\203L\317P\303Qx\300s\344\371\240h\374\3711\362\340\360\370\fyvF\3409\362\304\234(\022\223\304\241\013H5\031C\t+H"
+	.string	"\031Q U\2540BM\016\223F\022\035T\237!\217\216\232\034\372\374$GT\220Tu~\222#~\222#8\004\300\307\207xB1\005\025\tD\364\361\241@\222G%\301\243\222\360\361!\236\220\344QIP\200\201\217\017\361\004\013\212D\f\030YP_0\252\220\0029T\341D\221\b\303\360hBRE\252$\222<*\211\016I\036\225\204\221\005 \242\317\b\n\222\252\216\005\031\030Y\340PL\301CO\221\004\r||\210'$U\235\n\324\024\306cR'\251\352X\320C<V\240\230\302\211\"\361\230\324\201ax4\241\002+\334 }\214#*\220T+`\243&\211G\027\206*\211$\361\347\3078\"\206\236\241J\002\231B\222XLa\006\247H<\241\226\020"
+	.string	"\232\033\236b\f:=EU\347\002\024<\311!\020\222h\002\216\352\323S\034\242pcST\325#\217\316q\250\372\2140\232(\246P\302\350S\002O1\006$\t=EU\247\250\352(\300\203\344q\b\344\201\016\n\244\n\237\023"
+	.string	"0B\013H\244\312c<\256\200\243&\207=@-dp\036\342Q-\252'\322\213\260\200\004,`\204\025\350Gp\200\002\034\240\200\363#8 '\307\001\013\310I\277\200\234\253\356\234P\201\272\363\243&\2211\350\030\325\036\342\013\033\222*P\f,\250E\242OR\205\006\324\"\021\003\036\324\235!\2628\374\240\356\364 \2153\311\235\023\271\243\372\234(\016\211G\026r\200\032\004\240\016\001\250\013\320S\034\376\374\030G\034\223:\034\244@\016UH\362\364\364\321\350c\034\221\0029\374\211\201ax4\001\003\344N\222G%Q$\236 \036\215g\022\205E\356\2502\020i`\260\252\fD$F\356\370\250+\210+$U\035\n\222@\366h\3641\362\230\310\235\236\237\021G5\251\323C<V"
+	.string	"\206\341\321\004"
+	.ascii	"\2548\3211\234hd\022\310\210\217C\024<8I\201\221xA\f\307\244"
+	.ascii	"\372\243\372\250\311\013\220;'\210&\212\306\021\024\244@\016"
+	.ascii	"U(\032\211I\236\242\n\0233'\020\362\007\tt\242\303\n\265\247"
+	.ascii	"\230\202\232\034\036{T\fK\354\2540\226H\3013\364)a\001r'Y$\032"
+	.ascii	"WXac\260I\033\240\341O\222X\342\034&\207=\303\244\372\223&\213"
+	.ascii	"\306\023.8\n\017z\220\306\244*\003Q'\005\3170\251\223\\\241&"
+	.ascii	"\213F\036\016=j\n\236!\320\211\334Q\221E#\020\322\002\036\342"
+	.ascii	"\211\021\f\217\306\"Q\005\024<\311\341\nE#\021"
+	.string	"yT_\230A\302`$\321C<\236HG\364\020\217'dP${\210.h@\301G]A\004\222\3519\016{\212\303\244\316\013I\r\303\243\3723\034\221TM@\016QtPe \352\250?\303\343\t+\206?3\310\03559L\352\364 5P\323ST\221\032\324\3440\2114y\216<7M\232 \242\320\351Q\223<*\320\nu\30309\354\301H#\320}\201G=j8\032G0\3741\217\306\"\361\307L\256P\2132H\030\214G\214,\376\250\3601\362\240=\304\343\t\214\"\331C\204\301L\2428ATQ\234\311\243\021\b\006\225\370Bj4Q$\342cp\354\351\031\342$r\307HsD\301s\217j\222gx\034\242\030\321\203\324\300\013<\352\221C\362h\004\302>Fc\t;f\217*\003\321gHL\022\213D\231\344\016R\005\365\207\230L\223HU\005\tT\022F\023\305\024\222+\324bM\362(<\370"
+	.ascii	"yT_ \036{>\334\b\244\036?H\032\215\307\017d\216*\321\0041YT{"
+	.ascii	"\210\032\220;3\033H\036\215+pP}J\fYx\341Tw\324\036\243\n\311"
+	.ascii	"\243\021H\203\332c\374\301\352\216\006\222G#\320\006d\321HL\002"
+	.ascii	"\031Q59$\321\243bX\"Ue \352\2502\020u\322\344\316\b\311\"Q\005"
+	.ascii	"\232L{\206*\n\307\231\236\241\212Br\007\204\020|\210C\026\216"
+	.ascii	"\252\t\023*JX\221\234y\201\250\362\250$p\222;\013\310I\026\211"
+	.ascii	"*R\r\303\344\320\204\025G\232cr\205\024|\206\304\243\212\274"
+	.ascii	"yN\316\210\rZ\310@\005R\036\017z\220\306\235\030R \217&>0\022"
+	.ascii	"?(\022\207?\037\360\034\221\037x\340!\005\317\260\204\217\317"
+	.ascii	"p\204\352\323C\234\271\240\240\t\265T\247AX\372\243\201\370\213"
+	.ascii	"\325{\0226\026\006\314\221\217\313\212\002\366\223\013\255\036"
+	.ascii	"Z_\274taZ\2654F\377R!N^\2724\276\006B\351\217vA\271\310D\211"
+	.ascii	"\222f\204\372a/\313\304\312e\235\301q5\376\007)\351\217\366\241"
+	.ascii	"|\370\314\t\027t\357N\305\240\023l\374\017d\351\217n\301YJ<\334"
+	.ascii	"\250\350\241Z\322"
+	.string	"?!S\2764F\363\242\314@\206\327\370\037|\244?\232\005\305\3229\200\200\241C\361\300L91\322\370\037\246\254X1\341Dd}8\252\202NA\001\307\332\023*\346\221Y\241[\023z\207f\235mKbg\250\024To\b\030\246\306\317 K\372\243vg\027\022\354\226\264DA\347\002\325|\0205Zw\r\260\240X_\035\335Xk\305hr\"S\003pH\033\024\273v\312`\021\230\344\t\216-X3(91u\360P\006\3625y\032\213A\027\324\030\013=\201Q\203\211\r\277\031B\2324\206\203\343\220\205\260D-\335\3206\264\ruK\225ZM\320%G\335r\320P\206e \306\206\026](l@\202\254A\225\340\347\342J\211\022\023\n\005\244\272\252\364G\223\230NgA\204M(\222\243i~O8h4F\217\240hA\226iX\032\337\256\327\333\342C\213[\221\306\250\031z\226\265D\362\366\275\3631\001\376"
+	.string	"\314R6\2444$0\007j\304T\256\265hQ\327\270\303$\031\362\303E\217]\035W5\210\250\254\250\330\025&0\226\364\f\335\226\240\\c\"DLe\027W\006-\302\316+ XY&5F\205\2100\225s\020\n\206\0169*\344+*\244F\260\306Z\016\332\207\022\030\204'\376\361\003\r\322y*\347%\232V$\310\207\316p4\b*e\206\227\324\030\005b\0075\344\355Aq\303"
+	.ascii	"\f\332\003\355\201\375R\245\326\021\006u\351\217za?$3\262\252"
+	.ascii	"\032\243\\\367\004\205\205\205("
+	.string	"W\243K\264\353(\327kP\274/\243\240s\353\016\327\340\361\302\212\307\251\205\346\357F\220\034\350\216\223\016j\220\213N\307]\026\214%ec\251\243URh\326\365K\263r\315PS\312\276\b\304\005nP\213\002\233\262:\232u\024\013\004\021\370M)\216\312Kc4\307i\240\350\334\370\032\037\275\322\340\343\252,H\343' %{jjB\251d\212\304\021\3355Fq\330\034JvS\246\376\230\231>\036O:\032\037\003'\3511pC\241P(\324\006\316\224\222\013\002\342\372r\024\231\251\372c!\206\3168j\003\255!\350\226\217\2405P\032vO\236\250\260x@{\322\204F\335(\031\350\031\251\341,3jR\316\324\210\034\035\241O8S\312>\b8\361\312Q\004\260\210\227\267:\324\351\350SO\305\350"
+	.ascii	"s\001\2441\272\204\306\370b\025\305Gc\024\206-;\242\025\330\370"
+	.ascii	"\030\344HQ&\264\311\256\350\213\347\r2WmhA\215W\344\234\363\343"
+	.ascii	"NT\tg\2211\263Z\363\321\030M\262o5ZY\204\0305F]\\\017\017YyA"
+	.ascii	"i\214\"\331\271\260\033nN\032\243-,\027\033\330f\345h\357\236"
+	.ascii	"iU)\322\370\030\310@\211P\"\264\b\211P\027  V\030\"Y\032\243"
+	.ascii	"EO`fL\r6\276\207?/?\303xA\207\356\335LV\222\345%4\311\020.A\300"
+	.ascii	"l\004\005\202\006i\217\352j"
+	.string	"\360\350\320Q!\020D\\\257\230\343\354\2541\032t\253\305\345\314\250\361\321\214*\377\230\030/-J\b\033\337\003\223\364,L\200\21508\b\263\246l\001i\334\366q\347)x\275Nr\003b\243\361\031x\002\376\004\363\307\304\270\335\270\242\n\207-\2503B\244bH\325R\310IG\024\032\"\021\322$\035\203\026@ @8&\023k\303\334\035\023\200\004\ni\345y\"\310\224c\310\214\210\210H \"\"\222\202$)t\236o \b\006\3508\316\365\374\311\305F\321\342a7M\006\271\251\272\016\331\221\b\221\265\030ba\344\007c)\331ehY\314\356\346\322\020\305\273y\002\314\t\nD\007\002\355\0367\350\330!\n3\b\221\013vj\240\254|\325\215\254q\332J}Di\343;g\357O\231\222\250a\273\255\027\306\367#\031\261(\235tJ#v\364\377\207\353\306\360\006\324\307\225\200[\351\351\367\374\005\300\3425fi\230"
+	.string	"H\n.;d\020\212N\277\262\200\234\321\244\367Cp\265\177\362\220;#\237@C]p\226\\\354\355\365\202\006\374\341\033\033.1\030\245=^\205\244w3\326=\355\245\276\205Zo/+\200G\026\277S$>-\343\366e\346\354\313(\234hK\221u\253jp\376\027\r\244\346v\023\033\345\221K,\326\234\366G\207\361\271\316\323\246\013\230f\333\230$\n}8G\366\037"
+	.string	"\3358\263\216\313"
+	.string	"\324\036\315\364R\212\366\b\340\2367\251\302\260\025\226}\274|\324\212}\207=\250{\200\205 -Xp0$\350\223od\236c\265\365\314vw\216\362\f\214S\242Z\371\265&\222\214X \250\306\247@#\331-9\323A\206\215\r\271\006\367h/*\277\366\223\325\301\b\345\013oT1N\023s+\344\027z\207\321\373a\027"
+	.string	"A\017`\322\355\264M$\302G\022\354\231\"\233pw\270fy$\034\362\357\032\337rAx\253\270\276\241\366g$\352\303\236\357h\364AC\242\351},5\255\237\357\371\202\270W\251\307r\256s\r\003)kZ\321\003\277\270\031o\221\211\261(\0065n\243\271\345\336*\324\240\2075\257[\016\330g3*m\030h\025L\334\351wA\310\237\004H\016\214\2220\355\026=+"
+	.string	"Q\272Y\025S\244\"]\350T\325\3066o9\017\336\305\323\302\374\207V\342"
+	.string	"\210_\013\356"
+	.string	"9\267\350l\026\372\2550\272|@\203\367\004\347\361Cr\256\310\247\017\236L\025\243\205\210N\261\360w>//\232o \225u@\0321 \264\352\blfQT\245\302\256\001\271\177\207S\025}T\313%d9\bH,\020;\006Ue\303&\027\222\037\222\270\263\311>\034\250\235\2311\034F\363\326\202\363>\025\210\255\001\222W\372\305\231|\b\301\023\264T\036\210\022\254\304J\021K\361\261\203N\013-\207\030\224\373\224Ce\333\313\245^:\214U"
+	.ascii	"\301J\237P\f\377\274\234\3465\002c\354\037WPP?,*\315(P\320\267"
+	.ascii	"\354\245e\377\320\n\311\r\250-I\270\245\006M\344\237\361\214"
+	.ascii	"\364\365\036:\220\257\0039\335\267\341\364\361\335.*\206\275"
+	.ascii	"J\203+N\275.G\204G\330KT\r\001\320\301,\n\266\345$o\214p (\031"
+	.ascii	"\376LQ\373\373\315\257\246=\035\246\361\265.\030\353VTA\023\207"
+	.ascii	"\006nb\320w ,&\304\354\311\317\222n\232\217\023H\227\177\002"
+	.ascii	"\215\313\3422g\353\346\234N\242X\310\357%\217z\276q\215a\373"
+	.ascii	"~\016W\305x\271:\200m\032\276\by\267\214\217\356=n\216\207\326"
+	.string	"b]\357\276U\201g%RPcV)*\311\366\005\353\345\371\355\2404\205\326\233\254\233\377\032f\355\225\346\371,\002\305\317j\037\235\203\342\354=\\n\342a\005\335[\263\327jJ\227;'\222-\240\016S-Ao\005N\001\b\225\276\206\364\242\016\334\033\226\316]2\272w\341\240.l\252m\210\233\320\272\267l\222\235L?\201Fs@\271\336\252\013'\320\370u\277\241xP\021\222\351\t\3016\3313\355\345\333\273N\236\344\260\237\247\242\3375\267\323\360\006-\207\004\357'Qe\256Y\325\023m\207q\315\234O\275\340\210\021\313W\030~s\364c\304\322\213\221X\262\343}\2345{\363\354>iRJ\360\324\\\2352\177\246\263\346R7'\016T\270TE\216\316\271\320I\360\006\317\276I\241Q\301sz\272(\222\305\257\314\372U\264\306\\ePB\013)n\232\034\3218\3360\276*<\341\205\306\205\214\005\304\216\274\006"
+	.string	"\331/\275\3336\371\357\027\232\016Yi\351f>\337\361\217\206\202\330\3742\361k\221\263-\377\304\225i\363\200\013P\0059~\024\265\030\fK:`d)0z\0351\222\033.k\035\343\320H|a\363\367;\341\304\245F\330\307\316\214\267\221\024\2620\377jyJZ3\025,+-=\\a\013\320\0207\021\371\311\016\317}H|\332w\002gb\363\355;W\t\031^\3732\251\307\300\346\266\273\250?\307&\376\257g\320M\320\204\231\333\352\257H\210\246\245\211\322\263\035\347\333Y\200\223\270v7\260P\241\357-\247\253\\\334\372-\310\024h\275\025\361\205e\273\202g]\340z1\364(\336ez0\361\025\302\276\372\306"
+	.ascii	"TnH\246\371ls0\300D \033\177Qi.\fa\354\020\\zn\241o\rg\323)\274"
+	.ascii	"\204\350\374\301slXO\301\302\366\241\256\341\323<\030G\372-\026"
+	.ascii	"\301\345\354\037\266\204\205\254J6\345|VC\254\241\347\331=\006"
+	.ascii	"\254\303\233`:c\032YA/\255r\0223\366[\035}1z\324\032g\2543\006"
+	.ascii	"\017\357Xy\32628\3178\215\333/j\214\214\214\262\350[;[\f\272"
+	.ascii	"\016s\3441\374\225fM\223\227\257\240\330\335\357\320\203\312"
+	.ascii	"K\035\004\206K\267\271\3547\032\21725\354\032\206\034\232$E\326"
+	.ascii	"\367\204\347\021\fK\305z\315\202D\250+\364\327\024\312I\363["
+	.ascii	"\243w\332\346b:\327T^\240s\355l\344.\302\326\263a&\266Te\331"
+	.ascii	"\360v2\302\230h\342:\r\236\264\313\374\250\222\223\234u\353+"
+	.ascii	"H\034iY\231\273\316\t"
+	.string	"\034\f\237*\351YCl\331\235\367\273;\2007\365lM\206\317\017\310\251\004q\337\r\2072\261b\234\267\220%\b\364w\212\210\357F\f?\r\342(r\312\312[\324\374\"\020\225z \215\347(4\300\341lU\216$\267@\234\230\220\302]\024\244\027#\334j\313\206\273\370\261\210\307\244\230W\361\001\325b\251e@ZG\002\025\330\351\030\224u\351\371\347\206\271\013\036I\342\304\310\004U\n5\327\020\251\354\200\303\275h\254"
+	.string	"\224\177q\370\326!\300\327\351\236\377\007\251\362h\210\001\213\203\024Ld\363\270\342\304\250_\217\301\273vd6D,\0013\204\221\267\227\227\314\203\022\273\230,\3638\211\344\203\n'\223;\360\2216\356\227j\f\350)\322\345\311u\310\254R|9|\223\034/\226\261?G\247\002.\211\265t\221\034\240[)\310\223\262\204\323\002\2279%N\221\"?\305\353\006\260\263\262\373"
+	.string	"\0015\277\037\235\366E\n\215\252\"#YC\300\037l\237o\230\236\373l\353XOp\355\261\316\033\365\311M\006\372\311\\\232M\331\314?\220\"\301\301"
+	.string	"\235;\256\350p.\366\344\304\341k1\220k\255\311\371)\226\210\344\241#\371\2533\240UJ\341\033+\225\023W\361W\325\001p\346\3734\220\317\371PF\372{\246u\f\207\324\313\r\222\300\026\371\350\306\226\336\350[bL9\271\301\247?fy\n(\357\300\307\002K\004r\227\222f\255x\350Kz\020-\303>\221W\304\250\315\367\277 a\261Y\300>\326=\226\0059\360F\310\264\352\231\211Q\331\206\275\215\304\310\274e\245\241\250\226\2333\243\2405\255'\235"
+	.ascii	"\202\332}ke\200\f\300\236k.\tb|\f\3511\245&\230t\003\017\210"
+	.ascii	"VL*\323\247\205Ea\323\374\002\267\020\r\302$L\333\032l7"
+	.string	"\350\016\"\203\235\314dj_e\220\200.eA\236V\f\304\366\2504\264\2478\377\022\213B\370\240\276!;1\342\004~8\367\030\253\341\303\te\214\234\302\250\331[3\277v\027\336\272cp\\\316\232W\223=\360\004\347EsO\005s\021\233\354\021\022\354\021\327 R\357W\205ZU-\342\200g}J\353\016`\337\036\217N\004\330\202\262\007\2579\313\243eW\245\326\320\256BX(\201`\3026?K>\237X\317\26578\267\026\207\233\267j#LI\203\230 E\0248\213$\3507\216_\260\027|/\234\023WdH\006\271\004\224\224\025Y\373\036\t\234\370\366\372\023\265gW\bipe\331\212#\352\f$\003\333#\363\266-\203\271\242\304\005#\311\356>\031\301\202x\263\021\373\034\325\221\025\024:\233a\211\026\375\033oaArN\317\245\351\243h\001\004g\351wE\366\214\300HW\250\351\250\016\331\030\256\245Dj"
+	.ascii	"\\|:=\037\216\311\300\320\b\257\317u\335\205\226OI\336-C$\264"
+	.ascii	"\255\t\tA\216\373\031\367\333\026\006\033\030\353\213I=ev\273"
+	.ascii	"\001#.\303\234\343\326t\371\301\275\b\315\276\364\205\206\252"
+	.ascii	"A\224\n'n\366M\013\325"
+	.string	"\3760\211\371X\304\234+bU\311\344\236\267#\200\352\273\346\243E\277\333\003UH`\3165\013n\032\322T\242\2015\241\013_uZ\033\032uB\343.>\226\267`\n\245\036\334\266kG\236\223\233\002?XELwO\213\001\257@nm[F\217\303\013\tDXi\rS\302OQ\270\374\327^g\317\224U\265\245\331\023\221H\311w8\323/Ck@\206\266\250e\r\325!$+6\201\035\376YW\205\260\261m\371\302\\\020\025>qM\326\317\004\322k\214\024 \244\016y\260\244\370Te\324\030\006\240\002\356>\002H\004\355\262P\242%\020B\341\001?vG\037\247N@\0014\037O>\202\003\337T\005\273\275\020\371\266\017U``%\317\317*\363<\326\365y\215'Q\273\274\221K\340UD\216\366\332R2l\261\036\221\005\300\305\232\332\354\211E\275W[v4\216\361\360\321\363\t\330\037\325\237|\335\374;\334\236"
+	.ascii	"\320\340UYm\n\374yn-\317\025\230\377\030\031k\017\340\016g\324"
+	.ascii	"\bn\261vO\272T\017C\255]n\326l\260tf\031B\315%M\341^E\016\f\271"
+	.ascii	"?\373\226R%\020\270\251$@Y\364\332\3668?j\024#\313\214\261w\r"
+	.ascii	"\362{g:\3537''XN\003<\201\327\006\271\001\265\006\307\347\215"
+	.ascii	",\027\027\027\204x\324\377b\240\271\004>#\331\205\024)W\351\017"
+	.ascii	"\321\344Kv\263\n\301nc\331\226\363\226\354v\207\252\035\357\327"
+	.ascii	"N$\333\253\312\266g\241U\335\231\333\211p<\233\372\016\t \303"
+	.ascii	"\005D0\200"
+	.string	"\347\211\337V\n\377\216\256tN\277[\2302/W\367\002\016\033\343\324m\363P\200e\031\227H\243@q^|v\036\034\236E\373k\227\326@e\032\277\023U1\356d.\366*V\261Rw\201\025ot\rC\034\252\365\207<\255\205\337L\347\357\030\255\315\030\337E\220*:\340ST\376\265:3\243\362\275\264\201\262W\001{\214E?qe\002\323\366\3366\377\355\304\311A\303\353\036\026w\3367\f|=\260\333\277\207`R\352vp8\211\376\2076\361H\240\366\021\253n\266\260\357\305\325\277P\327\371#\f\304\3632\330\345(\277\205\252\250\034\031\351\247\"G\216\367\240\265\346l\b\371\177\004\357\316\222\203-1=\001\"\024}\310\021\241R!X)\f\025\005`WaXyJAYH\025\177\"\001\220\241\306\312\001\234\307\364e\341\366\3038\254\216Q\354\006\204\267]\374Zh\235>\rs\216\203\373n\270#o\323`"
+	.string	"@+\237"
+	.string	"\210\313\004}e\244\315u\216\354ch\262\216\227\242O\341\270\307\321n\337\201\217\256\317\260T}\027\201a\"\257~?\n+}\367\fs$'\254#Vv\362\254\251\036j\271\346\016'g"
+	.string	"\335"
+	.ascii	"a;*\025\336\307\327\327\201\372\301>\242\371\032\235`~\007\363"
+	.ascii	",\250\362\203\005\367\305)\306\315}\020p\246\237\f\302p:\371"
+	.ascii	"\255R\031\320zd\301\376TJz\235=\004D\037^H\375x#\234\034\234"
+	.ascii	"\210\322\023I\243\376\\\237\251'y\204\235\313f\036\310\307\t"
+	.ascii	"g\374\243\334\305\314\260@\353\007`{\262\324\317\217L\217\273"
+	.ascii	"aq}x{\255\270\013:\025\313i\336\027=k\020\345+\026A\266\223\031"
+	.ascii	"\300\215%\261\215\r\272\242\244\350~d\242\035X\200\t\256\022"
+	.ascii	"Y\342\024\245\354rl\353&\244\252L7\374\276\275\262\353\013[W"
+	.ascii	"\200\244\221\267!\316o\323|\301\0256\205\311\206y\363\267\214"
+	.ascii	"\356\332\202\337\201\246P\313\007\037\372w\243\315\347\265\177"
+	.ascii	"\033\275\234\231NN\"\276\227\334\004\300\215\t\366\363u?\356"
+	.ascii	"fCs\231\334\265\027\256\366\250\337|\261\261\334\364\236\344"
+	.ascii	"<\225}%qp\240mh\235%\365K\347\247\221\377\001\262J\320\227\033"
+	.ascii	"\316\037\340y\214c\276\200\237\233\361\232\205\307\306=g\330"
+	.ascii	"]l:)0\277\335f\366\020\026v_\366G'\006\215W\256\370\031\3228"
+	.ascii	"Yt1\271\343\374\231h\236\023\374\273M\271\2320!q&\371wp\337\315"
+	.ascii	"\304^\340~\r\f\007t\364n\342\201\033S\320\370F\377\300\314)\370"
+	.ascii	"\236W\366F\377/\360\321\352\345\237@4hrl{\217\356\236\007g\222"
+	.ascii	"1\207{\001\335K\375\236\306V\262\361\274\245}\332Uv\315?\233"
+	.ascii	"|\361\261\017{?\326\t\215\336U\367\256\261\214\313q\240\310Q"
+	.ascii	"]\201\262K\202#\354{\334\323\032F\237\340e\355\312\260\036\005"
+	.ascii	"K\244p\234X\237\207~Y^\270c"
+	.ascii	"\313\233o\265\177\354J\371\346\354.9\223Av\333]\002q\313]\220"
+	.ascii	"zq\273\332_J\007\335"
+	.text
+	.section	.gnu.lto_.symtab.4b534b857a8b7c18,"e",@progbits
+	.string	"frskyOsdInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"frskyOsdIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"frskyOsdUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"frskyOsdBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"frskyOsdCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"frskyOsdFlushSendBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"frskyOsdReadFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"frskyOsdWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"frskyOsdGetGridRows"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"frskyOsdGetGridCols"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"frskyOsdGetPixelWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"frskyOsdGetPixelHeight"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"frskyOsdDrawStringInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"frskyOsdDrawCharInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"frskyOsdClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"frskyOsdSetStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"frskyOsdSetFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"frskyOsdSetStrokeAndFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"frskyOsdSetColorInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"frskyOsdSetPixel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"frskyOsdSetPixelToStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"frskyOsdSetPixelToFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"frskyOsdSetStrokeWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"frskyOsdSetLineOutlineType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"frskyOsdSetLineOutlineColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"frskyOsdClipToRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"frskyOsdClearRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"frskyOsdResetDrawingState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"frskyOsdDrawCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"frskyOsdDrawCharacterMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"frskyOsdDrawString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"frskyOsdDrawStringMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"frskyOsdMoveToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"frskyOsdStrokeLineToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"frskyOsdStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"frskyOsdFillTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"frskyOsdFillStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"frskyOsdStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"frskyOsdFillRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"frskyOsdFillStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"frskyOsdStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"frskyOsdFillEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"frskyOsdFillStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"frskyOsdCtmReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"frskyOsdCtmSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"frskyOsdCtmTranslate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"frskyOsdCtmScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"frskyOsdCtmRotate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"frskyOsdContextPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"frskyOsdContextPop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"crc8_calc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"uvarintEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4b534b857a8b7c18,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3248 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`G\r\r\""
+	.string	"t\037;\016"
+	.string	"Y"
+	.string	"\254\240\363\203\f\b\002"
+	.string	"\001\264\227\253\211\r\n\002\001\002\002\002\003\002\002\004\002\002\002\240\342\234\212\n\003\322\340\376\252\003\f\002\005\002\005\002\006\007\002\007\004\005\312\377\246\337\f \002\003\007\002\007\003\002\003\006\324\322\312\367\f>\002\b\002\t\003\n\002\t\007\203\252\302\277\013(\013\002\f\003\b\t\316\375\324\274\n\030\003\002\r\002\001\002\016\n\207\245\203\341\004\f\250\324\366\223\017\340\002\017\002\r\020\002\f\021\022\001\004\r\361\266\322\356\t\004\017\375\343\345\324\017\270\001"
+	.string	"\002\023\024\002\025\025\002\n\001\n\026\001\003"
+	.string	"\002\027\023\030\002\030\024\002\031\003\002\025\002\003\n\002\031\001\032\002\003\n\002\032\003\020\352\263\360\321\b\021\022\023\024\025\026\027\030\031\032\033\034\035\036\037\213\326\277\344\004 !\"\375\317\237\237\001\262\002\033\002\033\021\002\021\n\034\003\026\026\026\026#$%&'(\270\306\322\304\016t\n\002\n)*+,-./0\375\224\242\357\016\036\035\003\002\037\002\036\002\007\002\0071\345\325\262\334\007\0242\265\244\343\267\f3\307\333\345\224\0014\370\262\277\340\b5\204\303\374x6\262\273\233\244\013\n7\306\311\227\362\003\b \002!8\360\237\325\371\006"
+	.string	"9\322\277\262\337\n\002\002\"\002\":\315\343\301\244\013;\377\331\231\340\001\020\002#\"\002\"\002$\002$<\331\254\373\355\f8%\002%\f\024\002\024\024&\024=>@\331\351\335\210\001ABC\327\351\362\306\016\031&\003\002\003DE\354\263\203\222\001"
+	.string	"F\242\365\310\247\017\f\024\002\024GHI\243\334\230\230\002\006%\002%J\316\271\204\323\t\031\003\002\003KLM\217\325\217\341\n\f\003NO\252\255\303\332\r\240\002\002\002'(\002)\031\002\021PQRS\264\364\273\260\016TUVW\303\222\355\327\004X\376\253\235\261\tYZ[\240\342\234\212\n"
+	.string	"\201:\250\001:1\021!II2\255\001\341\004\f*(\331\261\003\022@\344\025\310c\306833\022\210H \223$\345$\005\2254\006\340\262\021w\330\334/\234.\205]k\361bg\004\0019/\364\246L\237W\321\031\310\262\023\007\f>\324\030U\273\312\304\363\230\260\350Qh\305Q\221\037\352\304U\r\030\034\346Ou\032q\327\253\366\337\260\343\321\233]\200~\246iH\312\023\3470\033\326<\"3\330\031\363\302A5\217\\\265\205\370;\245F?8\177?\331%D;\315\224\221\036\345\257\020\274\304q\304\322<\247\2111B\241+\354r\315U\020\346\020\337\353\021\215\217w\312=\331/\362@Bb\237\262|\001)\267m%#\347O\237Z\355R\3448\203\330\377I\365\375=\262\343a&\357\213\276\2347\213h&0\234P\241\312Z"
+	.string	"HP\037x\376\370]\\\302\222\270\253=b;1`K!\334\3337\202/:"
+	.string	"\200\2720\340\310@\246\3426\334\262\361JTF\234\352E\265Z\337\260\220\321\246\204I\257X\270\017\264\314\211C\250N^ei\210\357\224\b\220\205\033\274 A\326I\002\303\00722(\236>x\016%\342\210\231\007\375nx^\377P\213\242]\327\335\361\370"
+	.string	"\370\223\275\310h\006\300\264\013Z\304\021\r\t\257\324C\356\2732V!\227\222\247,\321\373\336\002{\017\016\340\341>\021\021\275Y\\\273\366\320)M\303\302,\267\025\260B\337\242\374N\t\"<K\304O%9\300\301\357\240\n\3377C\354X/9\303\037`\220\261\216\265\027\353\316W\360p\n\255Os\232\342\025\306W_\270\244\255y@\362\243\234\231\376\343\361y\275\247q\311Dg\023\370\333L\242\027\376\315\030\323\3019\337\b\217m\266\300\3520\210\350p\224\027\2435U\354\316\264\225|\323j\252\236*\370\352\035`2-\3206\256\210\354T\213\223l\315\340^\305\244\371\276\247\203\333\326\b5\324\024M.u\320\016\325,\317\375\0063a\303S+\332\276\212\3505\355/\340h\262["
+	.string	"H\005\323+\372\327\360Z\344cl\033B7t\303\341\017R\235\320~S\240[v\217\377\216="
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`y\001\r\007"
+	.ascii	"\"\210\027\034`W\032\003H_\t\005\301\207he~\211CM\373M-\027|"
+	.ascii	"I\304\366\330[\246\024\0359\033\325d0\227\265\350\025\225\020"
+	.ascii	"\002Mk\225}\356\256-\351\345\341\0227\243L$\221\357\256\251)"
+	.ascii	"y\004\242|\3349n\310p\261+T\211x\203\032\254\300\300Fm\237\355"
+	.ascii	"\356\003\366\245\364W\026<OA\250\241\265d\307\266\326p\2029V"
+	.ascii	"\245\003\022\340\2645c\212AMZj\377\255\035|fR\353\303.W\b\226"
+	.ascii	"\215v\370\341pe)\372\037~\312\210$`\216.F\367\262\245`K0s\300"
+	.ascii	"\242\263\240I*\337\"\242Y\234GD\250E\356}\325J\226\301\251\243"
+	.ascii	"\027\244L\2479\2103t\314\250\036j\261AHqI\3113H\251A\372\256"
+	.ascii	"\244\007\242\001)1\310\365\231\372a\001z\203x\027\024@)\001e"
+	.text
+	.section	.gnu.lto_.inline.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\017\f5*"
+	.string	"f\365\271I\220\232Q:\234"
+	.string	"h\242"
+	.string	"<\030\005\006\360\315\250\360\034a\271\312\222\235P\327'Cx\177Y`p\002\365\235\337\004"
+	.string	"\300\245J\214\325\217\337$\021\200\327\374\316y\005[\353\224\"\305\016\255\223\357\b\245-9k\244\344\357-e\n\225"
+	.string	"\250"
+	.string	"\254"
+	.string	"]\364\372u\357M\360\243i\223\035\255\351y^\337\336\276w\315\347\357\253\004\314\377\262\346\327?h~=\017\355\264\3549\342sD\264\376\274[\376\365\023\032\250\253\332?\324U\262\224\324\020\320\234\004eeF\347\225q\202\372\336{\315\277W\353\377\016\232\317g\2416\336{m\347\363\247\257\273\220\272\236\230O\337\253[\226T\262\330\367\273\327UjV\320\230\375D\025\212\23178$\330\377\270f\376Y\t\343\272\210\3773\212\036&\256\201\\\317DU\fk\252\311\201\377\366\234\032-\344\336[\340\350\321_'\307Z\030\261\221\247Ow\365\336~\003j-1\246\256\372\272\363\226\250caYl\314\353n\367\272\235\320^w]\257\036E\331B6\361\267\373^\2530\377\023\177\355\177O\263\261\t\325\024\023\356\351\242\006;9(r\230=\r<\2162\352\211\251\2235"
+	.ascii	"\377\203j\257\21595\346\212\003\f\211\252\246\331\252B\345\244"
+	.ascii	"\247\314\266\240A\363\367\365\221K\215*\236_\005\223BR\355\234"
+	.ascii	"\306\253\313\345\362L'\221\\\303\016}\032E0#\203\037g\366v\027"
+	.ascii	"\354\247\017\262\277\372#\373\317\323K\230\247\201/\232<\001"
+	.ascii	"\374^U*A\035\245B\365\210\307X\330\200[\210zBSDg\315\275C\333"
+	.ascii	"+\264\225\235\002\316W\235\356\035\246\237\260\302\346k1\037"
+	.ascii	"J!\350%\244`\203\345E\244\366\b\027.\325|"
+	.string	"\271\022\241g(\245\324(8\004\316\021g\377uhC*I20\020\365\322q)\366s\237\003Y\240N\372\021Dj\022\275Tu\345\325\277}gTc\001\344\353\006w\231G\3065\320K\321\221[2\301\244\323\333|\0013?G\374s\304\027\346\016\033)\274l\231\376\353P_\021\247\024\333\312\265\016\374\277N\307g\335\237c\217\3768\347\333\327\336\363\2467(\377\355_\343Uk\345\336 \355#\3165n\264\002U\244\244\226\261\207\252\0240R_\035\245\232h(;\232\304p\2276\n\241\243\f\023\020\235~\330XXV\200\203\270\033,X[\023\372g\334\004iB\360\017\255\354R\034\203jM%\341Q\273\007\264\237\236\035\370|9\\$\222k\350\363\253.\254\224\242n\337`\246\263\363\344Y_E\302$$\212\350\331\200U\250\203\f)\216\271\325\251\301\347\267[\232\366\372\374\371\336qm\272\241%\006\r\006\227P\311"
+	.string	"\312\265As\333W\241\272\204\344\022\"x\206Z\177\355\364\013\267m\030,\257\"\264\377<G\f\201#\250\241A\032\231\241\231\224\221Lk\341\004\204)\305\230\204|\022\240\0241\306\322\250R\212DfR\220Ja\277\346\251l\rvB\257\006\357r&\3503\267\016\251P\202+\250\211\226\263\261\333_m\303H\002\316\211\203\024\214\002\b\023\324\347\312\230V2tF\256\241\255;a`\342\303\247.\371+\027?\327\200\250\310\343\323*$\016e\343\326t\207p\334p\277\271p\304\305\301\264x\360\334\007\303\206"
+	.string	"\261\232#\302\200\2031!\f\331%\005\033\"\360\345\265\320\251\274%\275\236[\272(\200Z\311\nk\032\244\376\006\212\022\244\276\2516\365\027\241\260>\301`]MB\275\325\363(\317\240"
+	.string	"\215\275\240(KC-r1JH5p\364\374\252 9\024\2640\2736C\213\023\361p\312t\250KA\326"
+	.string	"\277-\240qpSL\205\321\256\272\263|\250\224\335\343x^>S\2427o\207\303N\305j\316\373\351D0\361\267\356 \n\304P\223\021#d4\316zT\361VK\363\321\177\f\243#t_\bt>\274\256\211\037m\b\270\026\007\263\020>\355\371\361\301\315r$5\220RQ\270!7X\210\030\fV\264\360\203\306\271BL\232\330-'\2234\243\017\333"
+	.string	"\n\024\354\321;\377\334\225\002\365\034\324\206"
+	.ascii	"\032\346Z&1L\214\334\257\317\276\r\227\206\213\fG\251\276\270"
+	.ascii	"\305\324n\273!Rw\274\230KJ\023\002\372\315\332N\025\315\021\200"
+	.ascii	"\254\366\032,&\301\3519- \314\224p\325\311\361@\217[\"<\215*"
+	.ascii	"\302hR\r\330\270X\217\354s\355\263u\257\301\314R\260\005\255"
+	.ascii	"el\265\245\302\303'\177\212\306\277z5\034b\241\320\372B\230\355"
+	.ascii	"\\\272\216\251\263\026\343\303ho\364\232\244o\033\237 \002\240"
+	.ascii	"\330\037\200\345{\317kX \334\244\321\\\253\022OpC\352\231\302"
+	.ascii	"\216\257\016\020\033E\206\030\3252\271\353S7\316/\347\261[\224"
+	.ascii	"\246doI\037=%\3230PR\331vV\310}\004\016{\364J=\2314\254\\\007"
+	.ascii	"\307N8\022\262\240\307\270\t\231o\330\237\377\264\260\227\313"
+	.ascii	"\256\276\347\204f<\253\315\223\375^\363n\310<\b\226=\357\223"
+	.ascii	"\240\371j\024\324\364\263y\376\004\214Zl\n\231Q/\023\017\271"
+	.ascii	"i\335?\342\370\252\f\310"
+	.text
+	.section	.gnu.lto_.jmpfuncs.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`]\023]%"
+	.string	"F+\214D\340\026\2511\324(\260&\"\f&\021\207\235\f\026I\372r@\021<T\301[\244\264\212\220\203jA\0302\314#\206\341\030\331\310\250\373\227j\032Qln\350\354\314\362\203\016I\216"
+	.string	"\f\370y\221\273\322\312\235R\nj"
+	.string	"w"
+	.string	"x"
+	.string	"\335\212\024\335\215\303\363\204\364\201@\020\217A\351\356%\335QNI\237\300\243`\272\313\226\3565\302u\367\213\226\306\032i\231M\303\236\341\273\363\236,\244\333\335\356\264g\fy\337.\362A\344Bu\3508\353|\234\265Q~\312\317\3563\364\351\320\266\343\326\326qvr\234\271'O\024\362\257\367\271\331\356>\373i\262\337S+\264.O\002\002R[|\355\331\373\355\325\235\217\001\347[\204\335\306\324\226\342\016K)\345\t\005$\322\020\273\007\274w\300\373\206\375\201\227\\\355\253\261h4"
+	.string	">~\320D\264x\331\250\2077\036v\220i\036\215v\272\207\\\335\275\344\353\276\231k\254\235\303\177\214\333\326\226\324P\310S\205\374\247\t\356\307\251\315\024\206aG,,\\"
+	.ascii	"\333\260g"
+	.string	"\256\341Pc+\252J\345\002\221\3071\203\341\"\td>Q\2372/\201\320\2269*\004\256\323\310[\203\374\364\344\300A\352|\233\221\213\371o\037\220\255\226\325\211s\323N\2603\263\231\331\007\356G'\265m:\374U_^.<\347\233l\177'\261C\310\213\2206~{\301s\204\374$!\337p\306\246Y\354\257\035M\313\303\2616v\210\3056\310<\336D%\272C\344m\242b\013\255o\262\226b\"\216\005Z641%\270\237])\261>\325\347\255<\227\367} k\265\362V\3367`\301\353\025\201\007\302\204\b/Y\n>\257\236\227\354J\351\006T}-\357\373\274\233o\325`\202O\017\n\246\255\361\251\350\210\350\310C\3701\b(\b\b\246D>\032\211t\021\3772Y-\b\255&\2046}\222Q*\031\306D\376\237\004\313\360!\264\017\332:h\322\344\303=4h\307\200'C4\340\301\234\314\026u\305'\327"
+	.string	"\213\342p\266h\253\205M\201U\201\205m9\264\221j\002\2015\250AM\207\210f\nRP)\264\0311\005\3040\347\0303\363\022`\322Y\fC)\207\020\"\304\020B\f\231@d\002\221HD\002\021M\222c\277\204.\244\240h \372\377\340\231\006\276'\330\203=\307\304\006\036>J\266\001\300\346!\331\030rl\017\272\342o\236\274\250\317n\223N\rZ\026\251R\261\262-3\374\316\242\342;\377\021Uuw1|\361\325\372\177\024\376\233\024\002\316\341\322A\020\031'\213\2526?^\311\201}\027*\250\360\223\247%\243CA\r=e\357\376R\224\256"
+	.string	"\205*i\327Z\310\236\225\273\3014t\310\0357\237P\300]\035\333\361\374\200\2349m\323z\305\355t\264\272\346\216\306l\022\217EP.\360\325\225\307\207f\022k\024\230i\340&\2559\241\261\335MW%\342\246*\024\347\2236JAh\332\313\315\024\226\201\346\\@Of\367G\027ni\310y\332O\325\331\"K\220*\270\307\377\231\230\217E\310\342g\222\200\365\240\225\017\2645%\027\242\336q\367\022\322w\266\360m\037\257\355\241\2420!\026\\\300\334L0w\301\236q\372\243\220t<\312\222\251\334\244\022\243q.!\215\342\376\t\356\220@\t\211\036\340\315\320X\304\341\002\0326\030\r>'\022\371]aE\260n\311\335\231\347\227\343\f\321\353B`\0307\031\025\350\216\361BTS\331W\242\361\026X\314\236\313)J\316\341,\324a\311\313\204\365\357\263\207"
+	.string	"\316\323\n+\344\255\363"
+	.string	"\355m\243X\240+xrT_\022w \024PR\277M\346x\222&KGi\206\346\347\234\242\323\247\035|:\206\262\267$%+\323q%.\254\200?\273R\334_6a\335X\215\237\023\007\003o \354\217\267c!r\256x\313\303+|x\240\205\233\005\213\331\200\254\331L\200\204\215s\035\215\324\352F\355\206h24\260Gx\334>\317\336\375`[\314\025\315LW\354\341\320\314U\013}\305sV\214IP2\030/"
+	.string	"3"
+	.ascii	"LAJ=\244i\265@\323\221\360\272)\207\250F\233\305\004\306\002"
+	.ascii	"\273:\002C>\223\207\315\013C\221H\231\361\325\237s\023\331\f"
+	.ascii	"A\020\217\332~\211\027|\030\342\304Xh\260\013\302\261\017U\264"
+	.ascii	"\314\233\200P\302\374\0302\b\371:\023&\336\351\205($\321\243"
+	.ascii	"\0171\211\337\327\302\316H\301\236x\357\322\252\0328\003"
+	.text
+	.section	.gnu.lto_.pureconst.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375 e\275\002"
+	.string	"R\306\024\037\200M\032\003&q\231|\300\f\231\303s\346\2279\245\036A\001\226\201\211\215\315D\020BH&2~Qc\361\212S|\342\022\2178\304\037\236\303\033\316p-<\205\231\204#\374\340\006/\270!x\003O\340\001\274r\312'\227<rA\336\343\216g\0013\303\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\312\001\205\t"
+	.string	"\202\214%)\220)\031\0160\377\377c\r\373\377\177\240\376\243\032\253\237\265\217"
+	.string	"\356FU\374#\324\330\207)\272Z\023\262b\377M\366\2262\0057\234\211\207,\241\032\346\227\362\245\275a\206\031\321\351\224;U\317\205\213P\361\327\3229\347\234S3\312\031\205\026\324ZkK\341Q\376p\234\340(\207h\021\016\2361(`\343\347\362X\361<\017\005\037\246CyC\360I\340\2257\340\233\362#.\245\\)c'\236\2606jE>1\326g\222\254\250\251\304\224\263\374\001.\224E\037x}\241H\250pP\025I\222\264\006@\002\202P\262:\021\200)5\211\244E-\355\261\006\367"
+	.ascii	"\0278\217i\263H\352'l\373?\003\253^\253\316\2548\3422`9\376\372"
+	.ascii	"\334\t$4\007`\301\314\302\275y\221I1{d\270);w\314\216K{k\022"
+	.ascii	"\006\034\362A\306\363\341\321\224\330\232&w\305E\270^\244\341"
+	.ascii	"yC,C\004m`\245z\252a\302<&\232=\266\272&l\217\311\327&K\214\332"
+	.ascii	"\\\200\370\020\375\340\344\253\254\215h\347|\344e\016\341\254"
+	.ascii	";\004\264Uuv\322v?"
+	.text
+	.section	.gnu.lto_.lto.744964afaf894f24,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.39.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\317\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.57.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\377Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\376\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\376\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\375\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\375\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.63.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\204\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001'\001\036?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.65.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375 S]\002"
+	.string	"\364\003F"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177}{\001\001\005\001\006y\001\005\005\001\006w\001"
+	.string	"?\202\210\200\310\001us\300\001q\277\001o\276\001m\275\001k\273\001i\274\001g\273\001e\273\001c\273\001"
+	.string	"\004"
+	.string	"@\004\334M\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_gpsSetState.68.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\034\001\345\013"
+	.string	"V\226O> O\225\016\031\210\215'B\240\"\006`\250\253\027\376}H`5\005\345k\030\004\036\230\366\325\033\"82\016\264EXU]\361\312\254\030"
+	.string	"\030( 8\332\340\"\020f\314\361\266\306\215\244L);"
+	.string	";"
+	.string	"@"
+	.string	"\222\335\013/\330.h\300\226\310c\345\001\264\307\3075\264Gw\266\213\203\253\205hx\201rq\354\356\246\031\336=;\377\037.\371R\336\023\202`w\235_\252\302\255\267m\261]\300\276+3ki?\200\220\377\256\004b0\302\223z6\350\245b\260\377\330\335\265\252\354\263\376H\246U\323\231\351S\004PX\221@\304\356\204\231\214\rc\n\016\023\333O\373\035\356\241;+\202\003% \255\016\216\030\251v\203\223\320\214\370'\213h*\346D\013T\007%+\377h6\247\223\377\234\261\215P\202z\276\332\236\267>\224\325\356\036\360A<\004\310\337\360hN\024}\221\366\250&>\231)\003\234\222\246D\212\336\\H\241\316\306y6\007\036\rh\333\214H\333\005\200\271\020g\264\2258n\264M\300\375cUeL*4\351\311~F\263\025\\E&\026Y\314T\355\005G\001\313\r\325\001\026f0\370\353\023\030"
+	.string	"2\241\223i`\270\020\300&@\2165`\003\343\006A\306\320\225g\023\314p\tl\267)\321K1\006\2309A\034\fKA\360\356\362\\$"
+	.ascii	"\256\213]\304j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_gpsInit.69.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\241\005m\""
+	.string	"\226\376\331H\220\232Q:\004\013"
+	.string	"H*#\315\271z\202\033\007\245\265\327~\023\355\022\272\001z\362Et\300\303\221\266\254\336\030\355\337\002 \301\017\213/9\t\324$\275u\364\n\316\374\213\212F9K\214\t\266G\306\267\377I\333\204\310\235d\310"
+	.string	"\275"
+	.string	"\312"
+	.string	"]\356eJ\306\271G\263\212\217\017\177\346\237\3105\376\221\013\355\207.~\227~3&2Xi\356-6\270\311\n\316\233\\<\201z\363\274\200z\223-\363\231\027\253\356\241\370zJ\304\356\275\270\246b\031\265\247\315NY\255\332\314\262\251\345\323\200\273\323\022\314J\007ON\266\034\371\253Q\n\b#d\307y\344\357I\211\312N\247\327N\274\206+\241\032\035MO\257"
+	.ascii	"~8\335VV\020\022\261:\362w\243l#\023\257\032p\211\232\245\004"
+	.ascii	"!/\242\034\371\263Q\326\234\274\tr ?(ZF\310\322\344\310\230\216"
+	.ascii	"&\250w\031\341\t\220K\007\310+oZg\200\234x\032\003\230D\251\314"
+	.ascii	"\302\275\227\251\017\330t\276\235\231\27103\004f\263\027J\244"
+	.ascii	"\214\r\337\314\030\356\325\325Q|a\b(\263\206\r\215\240\313\310"
+	.ascii	"1\251w\314C\371\034*s\207\017C\216\274\336q\001J\340\374U\033"
+	.ascii	"\374\305O\371A\272\217\317u) B\374\374\214 A\357c\332\365\343"
+	.ascii	"\270\324;~\2233\2278\224'`\230\020\001\252\314&\316\004h\211"
+	.ascii	"\251d\211\330s\2259\350[9"
+	.string	"\235\252{\257\017\037\311\215B|\254\233\254b\210\336w\223?To\236x\006ZK\210\260A\242I\346b\022\355\240\025.\246\"\367\024\363\207\347\236\223\362\216\214\262N\245|\243\224m&\345ZI\231fR\236\225\224\317\222\262\254\244\\M\312fI\271,)wS\246\224\362\025\\x\305\324\210\b;\316{\257\254\317\0056D\242\311\340\325X*\\\025\363\321\323X+\003b\356\345M8s4\366\252\314\262>*\337\372\2507k\343\254\206e\233\375\336\2342\271\223L\331\2626Z\306\206\345\275\367\312|\220_<j=\225\344`\271\002bfZ\\x\270\242\326\324\016\362\337N\242\246\256\330z\252|\256v\367d\241\331\342\322\315\034t0\271\001_\356\013{\256\226\335\335\342\313kI*\211&\333\013\031c\023\263\203|\027\265\247\017d\ra@\351m\220\312l\265\354\020z_O\343\272\260\260\021\215\222\226\222\207R[\027\225"
+	.ascii	"]`|\351\0162\2755Ri\237\330\002\343Q8E\376e\215\234\367\362|"
+	.ascii	"\370X"
+	.string	"\236\305\n-\361\302\205z\223\266\0319!\024,t\030\216\212t\036\214\210r7\006z`D\224\303\351\204p,\204L\f\341\200\212\214p\017\006\260\216(\250\bw\244\323\025\341jE\244\367\024[@\352$#\355^\304#\257w\013\304\204\261\231]Ww\372F7H\326x\001\333i\246K\264\247\343c\261U\262=\332\2537o\306\027F\201\362m\214\332\2672\252\255q\347[\246\372\343u\232\331\002\355\fz\337N\227\027\252w|k\235\276\034\032\364Z\247[\3232RY)>\307\3268\371q.\307\332\210\2628p\324\233\266\376\026\260*\264\256\301\261TO\256\370\230\265z\0301Z?y\366\314M\233\263\273K\217/R\302\253\263\203,\353\332\355fkL\216\257\261T\310\f6g\250a$#\035R\f\221\310\210H\233R\033\200\002\021\251\302n\021P\261d\210\210\024j\030\003\362 \375\324\327\247Ur\225Q\306\343="
+	.ascii	"\224\0262u\017\306\210D\344\320\315\273\275\321\226\236LP#j@"
+	.ascii	"\270\nl(\260\212\023:\320\265?\347'\347p\250\326\033\375 \237"
+	.ascii	"ix\233#\252I\272\250\304|\\\373'\211{\222\221786\304\027f\350"
+	.ascii	"\340'gC\251\023\245>\364\f\305#\276\201U/H\220\214\325c\340<"
+	.ascii	"\265fc\230X\236\316O\217`\202\243\342\323\031\f\0230\270\026"
+	.ascii	"C\344\013\320\364a\035\016\017\254Dn\024j{\300\254\332\005\311"
+	.ascii	"S\306+4\241\227\244d\226\362/G\020\376Lt\330@\206\360x\206\376"
+	.ascii	":\213\321\005\317$\344h\322:(\210\237\037\211L\327w-v?\335\270"
+	.ascii	"Lj2U\244\0305"
+	.text
+	.section	.gnu.lto_gpsInitNmea.70.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`,\004\035\033"
+	.string	"&\361\254F\240\\M:\004\013\330\177\306%\250\031\004\335\236\274H\326\326\252\336\354\374y\273N\266\332)Y\001\272t\323\272\307`|\274S\306\323\301\351\035\341\237'\022b\\l\257[4\253\240l\267[\372\375\326,!d\023\271S\n\230"
+	.string	"\212"
+	.string	"\233"
+	.ascii	"^\230\274\367\333?\224a\276\224O9z\257$o;\222\252\n+\253V\037"
+	.ascii	"\205S; O\031<&\236\206\037 \236\372\310\306\272\017I}\225\033"
+	.ascii	"\034Stj\255\263=\362\243\277\\\344(\322p\347\221\377\342\335"
+	.ascii	"\376\232Jw5 \307\247\331\001\201\361pL\361Dv(\235\206@Y]\264"
+	.ascii	"\004\360raL\307\022\035\214wc\206!\320\022\031\036\002xIa\fM"
+	.ascii	"\2217\207z\003';\245\271A^<\234\030k\3729\235\310Ni\347\250\241"
+	.ascii	"\326\352\251\343\355\270a\267\235\3046\007;\264\020M\277\246"
+	.ascii	"\337.S\026\277j=u5\207\220&u\b\225\177\305Xd\255\267/\375\n\304"
+	.ascii	"\323\351SsNu\262j\265?\345/\221H\352\256\372\352\004\330\220"
+	.ascii	"\244\231\307\366\213G\331\310Z+\006\237\312\253\310\360\225\234"
+	.ascii	"\332\210\306\274\356\324\247!\236~\017\365\237\251;O=\244\031"
+	.ascii	"\264}\267\271L\3667\030\fny\215\330\357\335=;\r\333\351W8\355"
+	.ascii	"\332ir\247\307pZ\334i\272\323\341N\357\234>\001\004>\320\250"
+	.ascii	"\260\252UG\360N\005\322\005\256\322\\\027\347/\305q\311\r\347"
+	.ascii	"\344\226p3x\246$\315,\325\232z\352\r\230?\276\227\242\2706\212"
+	.ascii	"\024\363:3\270\2617\373b>\246\206\257\304+\204\204\304SqiN\352"
+	.ascii	"\247\207\234-\272L.E\2726\242\332\330C\017S\222?\272TK\352\251"
+	.ascii	"\327\263_\312\330\225\227\361\027\254\003\004i\006\235\325e\016"
+	.ascii	"0\\&\217V/\305pmD\225I\232v\274\333\263"
+	.string	"\341\3165\271&\270\031\264\315\342\\\312-\273\343/\017\200i\023\271\230\327\365l\354\307\026\020\2677\337\312\013\304\001\336&\236\007~\005\270@\003\242\311j\262\f2\032\255\302\205ZMV\223\321h5\017$J\210x\240\240\206\r\306z(\310(F\213\231\215h\006\203H\350\305l\250\310h\026\344c[\f\026E\263\0316[\321\f\346\253\017\253\006\244\305\371R\377\304s\373n\017\353\202io\350\260X\016`L\024W\202\271\377 \332 B\370(=\001&\355\255f\245\305\211\204\301\301\002\376\265\2607%\351\346\265T\213\352\251g`\336\3676# \\\325\232\273\256\004\231\213\020\3016q\202\215ki\316\312\0010Oz\343%\210t\203\2400\251\222R\257Dr\325\224\001L\250Q4\204\2344\212\221\304H\240(\326\001p\002\031A\244u\021 E\206 !\321l\355\362(\037i\210,\202\f\322\205\020v!/S \371"
+	.ascii	"$B]\267,Z\214\303\355x\276QU*]K\330\0211s4\004R\"\321\216t\230"
+	.ascii	"\271\206\"\355\267\301T\005\316L\374a=\370F \021\034i!kC\242"
+	.ascii	"Q\002s\t\223f\204\265\217\250\336t\003\206\215\315y\335\264k"
+	.ascii	"d\310>\360\372\241\001\177\017\001\352\330\221\313\325\366\322"
+	.ascii	"RtB\254\234rY\363}\215*e\334.\022.\210\250n\232u\307\327\031"
+	.ascii	"\341\240\233^\271\200%_\350k\330\027\250"
+	.text
+	.section	.gnu.lto_ubloxSendDataUpdateChecksum.72.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`O\002=\023"
+	.string	"\306\343|G\340\360&\035\332H! \275lJ*j\034]\365Uh~\220\2110/i\365t\304\225\203Bn\305\377\334\340\307>\277\201\237\274\211\007\032\353\226\322 \303\f\350\007b\241\237\227\305R,\225\314r\037\277\261[\333dK\231Re"
+	.string	"b"
+	.string	"k"
+	.string	"@0w\315\271\343\224b\3160\201\013\244\3569<\210\274\227:"
+	.ascii	"y\3173[\367\260g\242:\260\250\3119\3159\277\345\340\357\036\303"
+	.ascii	";\352\354^\\\235\371\252{Q\273\305\334\213(\332\315\017\353F"
+	.ascii	"\213\"OMG\317]m7P\343\007\234\357s\217!tD\265\033\316\025\005"
+	.ascii	"a"
+	.string	"\316i\255\3354\334\362\266Sl?\2605'(\265K\252[R\375!\325,\251\366\350\370\320\277z\320\317\361\360V=\374Q\007\372\345\017t\357\252U\252\0172 \251\005l7\347\315\256\306\\\362\216<\370D/jy\to\216\214\325=\273\305^\335\373\312\036Jj\020\203\\\004\264\346\214\220\017\202U{\001\203\331\303\227\267&\350\302\306\300\325\376\210\223\230=\353\027\225\234\350k&@\333\030\373*~\204\301\3671\nL_\203\311{\256\235\300DcC\313\344cY\3332\371X\016&$\033\216\265\257\305\360\330/k5G\243\003\236\260\360b\027y\317c_\364\003LF6\334W\367(jn\334D\206X\312\307\207\221\367\276\307\351\214l8\031\335-\021\022\355\266\313c\207\240^\244\347\251\311\273c\007\022\"\300ZVP^$&/U\n\311\205\035a\031\251\020\375\nYQ)\371b'_\312\311\b\354{\311V\276\220"
+	.string	"\216\251\220\310>\226XL\366\255B\231\357\216)\254X\222Y\320[\036\333P\262Y\025j\343\332\236{j\206\322\317v\254\243\312\335\265Y&\004cF\237\374\335_d\\\325:\320\021\321\350\200q\3169\243\025|\267cE\350\220h@\200\252\353\n3 \200\002\231Sq\003\324\013J\003\253G\374\330\002e\221\207^\"\232\342\212os\026\2705\303&Y\321\376\366Dg\210]\226i\274:\013\244\031b1\220F+\374\342\b\307\246\276q\200\255\241j\005Ph\235\260\233\333\300F{\263\334\304^\230\355V-9lC<\020f\034\021\356Va\206\361\003pD"
+	.ascii	"Q\272{\211,\344\tJn\006S6]\364\t"
+	.text
+	.section	.gnu.lto_ubloxSendMessage.73.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\024\003\365\024"
+	.string	"f\246\204H\3200'\035\301x\374\313\275"
+	.string	"\314D\351S\274\027\365\317\3206\376t\345\323\005\373\001\002{\226W|\220\374r\355\253H\036\362\307\3361`\364n\2079_p\005}\003h\241\212\020\037\274\312B\2342U\331O\b!\233H\231Rm"
+	.string	"g"
+	.string	"p"
+	.string	"J\317Ye\033'3\321\240S\271\311\304\031\"d\252\260\223\232S7\340\322\004\304U\273\200\201\331m2\357\234D:\004\\\355\2178\211\331\223t\016`\316\"\030\2729m(>\021/m{"
+	.ascii	"\360R\274\bx\351\231\ru\233\321\f?@\371\344vs\316\326z\370\354"
+	.ascii	":\363\237\373X\003\242]\303\003sNk\r\350\302\275\267}b{\305\336"
+	.ascii	"\016\001><\023\013b\342\221\257\003^~s\242\230~\206\276\364\337"
+	.ascii	"^bt\031x\334w\305\016\244\251\035\355\3316\232.\007\373\337\334"
+	.ascii	"\"\373\266\237\344I\377\310\247\016\221j\326\252W\237\032D\252"
+	.ascii	"?V\255\372\324\036W\217\253\026?u(\325\340\252\345\247\376\244"
+	.ascii	"zW\255\237\372&%AN3\2759-\364v\314&\251\002\304o?\356\001,\220"
+	.ascii	"]\335\016\262 \317\205\320\216j?Z|\354\350\261\252=\356\036\013"
+	.ascii	"\3622\b\261\364KW\372\322s\256\232\270\343\332\257\027\237\245"
+	.ascii	"Y/\002\216\354\270\357\021\301\243=\207+\236w\031H\262\341>)"
+	.ascii	"JF\017\021\217\\P\007~"
+	.string	"+S\374\333\234(\026?C*\325\335\265cd\3645\233PX\232\375\023G\201\343\037\031V\243\257\325\200\227\273\243\320\352\242\004\b\022\310\340\304b\\/\t\256q\3465a]n\\\"|v\245\304h^Z0\230\326\f\214\213L\313e\023k\245\214\030F\363\262i\335\300`6-\225m\376\233[d\b\030\232v\226\347&\373\346\334\260r\334/u;\013h+\270\r\226'\371\224C\232\262\031\274\006\2150\007n7\025\262v\203\317\220\255\214\346\234*~\323\235\034\370G\227~\320\322r\243\206#\306\206\354\203v%~\206V\313z\021> \240\002\021\2622\017T\027\024\206\376\265\300\034\254\344\n3\275\355\261]\227\245&\220\323\"\267\250\005\2465\277\226\327\357\240k\304\027b5\336\350\340z\002\277\313\343\250\216\327\344\335\316\363\3305=\3219\013\255b\235\036\\\016Knc\212V\327\300;+gd\367\026\323\345xF"
+	.ascii	"\355\325\314\270B+\354H\214\311\024\270\345\206\216`O\034[\024"
+	.ascii	"\301\366\302\244v\212\003h\221\231\003\206=>\201\362\002\216"
+	.ascii	"\b\200Q\340\227\027m'\003"
+	.text
+	.section	.gnu.lto_ubloxSendNAV5Message.76.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`s\007M\034"
+	.string	"\366+\243H\200\234Q:\275\203\376\333\3105\300\336\352\016\nt>\231\036\356B\232]\177H\354\030\325\034\030@\213\020\332\376\260(5\251\366\206\240\365\023\036#\020\224\361\335\210\306w&yV\177\235\025>\221cL\325Q\256\277\021B\210L2\202"
+	.string	"\213"
+	.string	"\230"
+	.ascii	"[\314)\227\270\026+\335I\1772\227`N\177\376EN\377\344Y\353\211"
+	.ascii	"'h\367\210\005\241\223\261{\201C?\231\210\366\323\004\376G\353"
+	.ascii	"\003\320n\346\006G\353\207)\200~\034\033\202\271\227X\304\th"
+	.ascii	"?yevs\242\220;\0236\361Ei\357\275\265\322\352\353O\263\354\225"
+	.ascii	"?K\342\371\005w?\247n\002\bN\275\364\t\2520\021\334{_|\273\b"
+	.ascii	"\366\272gI\367^\356_P\306\031=3o`\346#\346\231W6\224\371\303"
+	.ascii	"\305\330\302p\205\261Cgf\272\321\351KZ\343\253\275\2263\337\336"
+	.ascii	"E\345\222\372\276\3162\013\2265\254I\273\2122C\275\212\252\200"
+	.ascii	"\212\210\003?\2511M\333\367\336]Y\002\341\024\250Y\002a!\241"
+	.ascii	"\264Q\321t\270L&\217C\231A\234\013\027\004\306\234\273\024\021"
+	.ascii	"\006\244^$\021@\310\275\327\301O\036c\027{\344u\222\231\330\353"
+	.ascii	"\022\b\363\315[V1\177\370\233Bir\f\030\n\343\2751\222e\327\353"
+	.ascii	"\334\"<\361g>\037\312\003U?|\230g/hk\324<\250v\330a\333F\347"
+	.ascii	"\300q\243\317^P\032S+\326\2142\031\253\223\016\256X@\344\232"
+	.ascii	"\3250\324~\201d\247D\350_\213\036+9mQ\373X\254\220\3032Q\367"
+	.ascii	"T\242\007\314\022\2327!\b,\327;#YK\341\311;Vd\025^\246\326\351"
+	.ascii	"\361\035!\\x\253\"\217,\2323c8\231z\354\251\361\246\355\"\031"
+	.ascii	"\016g\354\r\233F\303\305\302\332\2573sx\0336nX:\035\276F\215"
+	.ascii	"\230\322\317\250f|b\347\227Pf\017\357Z\"\023\326^\001>\272\333"
+	.ascii	"\323\023\211&\233\211\021<\267(]\256I\2472\321\330\311H*\004"
+	.ascii	"T-\247\326\242T&\\\315I'U3\"\300\271\0207]mD.\247\253\245D\336"
+	.ascii	"\315[V\331\354x\361\312\036\2370\357\365\201T\274\2001\255Nr"
+	.ascii	"Q3\320zq\265B:R\351\370\361\267\326!+\221\376\217\273\353\312"
+	.ascii	"kE\271c\241/0\322Ip&\346\224\371\305\021\022\266p\306e\345J\007"
+	.ascii	"\212\244\213\264|FI\017\231!\253,\271\212.\351 j\201-^\231\274"
+	.ascii	"\270^\371|\353\2355\034R\r{t\200\206\250QPH\035\022\021\222\244"
+	.ascii	"\234$\035\020\003\021\231\342\034\021\200$\307\bb\016\t\211H"
+	.ascii	"(\241V\007\3438\256\351\224M\233d\316t%\262\250\367\343\306K"
+	.ascii	"=\366\035\31310\2500\275|%b\016\205\r\202M\357\361p\224T7\034"
+	.ascii	"\034+G}V=X\376\b~\210G\023I\034\310\245\217E\224\254=\361\177"
+	.ascii	"\020\343>\212\372\265O6\351w\347\352\347\357A\311\371\327\274"
+	.ascii	"\273\240\fPqmF\205'F@X\371\231\357\214nA\234\0306i\327\335\""
+	.ascii	"d\252%lt\222$[_\030\030Q\346\215\232C\305\034\036\205\357N\301"
+	.ascii	"\\~C{c\254>\257V\013\257yu,y\201\t\013\265'\200\234\312@h\265"
+	.ascii	"\367*l\001\243GR\f\307\377H\377o\034\251\277\320\214Y\303\243"
+	.ascii	"U?\322\037lx+\246N\352\317\004\274_\3351bq#\023A\235\343\275"
+	.ascii	"G\032\344\377\210\307\331\301Xn\303Q\003"
+	.text
+	.section	.gnu.lto_ubloxSetSbas.79.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\004\007m\036"
+	.string	"\266\361\265H\200\332Q:?\373\246)\353\323\236\321\270\016d6\320\2300\035\n\340\233\326q\024\256?\355T\262\025\200\305\325\220\3718\307F\231\252n8\207X\0161-;e\344Q<Gg\bj\305\340P\210\211\037\354\333>!\204\354\224\002\236"
+	.string	"\230"
+	.string	"\244"
+	.string	"G\377\242s\247z\225\357V4\2765\366F\204h\204lw)\302Q\367\330\216\236K\3371~@z\324>{\314"
+	.string	"\322\376*\020\243\222\244(wwg\026\271\357:99\334\315VK\321\323\254>\277\007\007\0320\370\273N\232\234\260\034\027\356\313\215\302\025\242\255\346cK\022\253\224A\351\b\362\032\220\037>\204\270`R\212;\0369\036j\251)My\034\325\005k\234\nv\027\251\236L7\317\2351C\304t\301\243\023\202S\030\246\027_\225\202F\265\326|v\327\025\030\324q\353n\333\215m\tv\272\025Y\266\232\204\\\247i\245\307@K\b\301\016\317\020 \032\320\254n\235\215\021b\232C\364\274\364\246\n(h\216j\033\333)N\205g\333=\262\340g}\312\217\217\344\250Y"
+	.string	"\325\003\217\372@\351\321\233$\204\\\322\254\352{\251\335\342Rz\t\302\354\240G\021*@\364b\f"
+	.string	"Q\273k\341\350\177\b\271L%\213\352\322\2762\252\346\320\376\271&\021\373\254\256f\365\017\004\300r\202\365\344@\254\335\034\3137\213D\263$\271\325o\337\177r\243\235\363\214_\031'd\223;j\317\260s\001cSj\230\340\004`Y8o\304\224h\210\267s\263\322\224`S`\177\226\027\020\2339\f\221\332 ~\026\242AR(A\201-\3022\312\344\327yL\310_\205\343\343\221cT\315\034\226\371f\247\2301\177\215\t&\215/V\273\204\371g\256%\265Oe|3\027\221\036\375\237\226HEjw\037\334\313\366\230m\367w\247\005>\373E<C\266O\373\300\201\327\016dR\215c\2178\262K\211\360k*Y\342\\a\244\204]\312\264\366^\352\245\013\024%\260\335\375\241\346\320'\322j\342\307\023[\252IB\310\365+\267Q<C?+V\304P\201B\006\214\233y\023\210^\260\330\005\001\355\\"
+	.string	"\245\350\355xCD\273\t\004\034\364\342gh\007#(hh\227\273*\272\027\027\262\31042\215s\027\352B\361\001\310\214u\351\236\252\273\217\351\257^\36499\226\022\247&\240o\364U\371\212\365@W1M\220H\346\317\2667\300P{d\220\221\326\0054\343\321P\231\260\264\2324\245\033jPi2\034*\216\032Z\225%\357\2457\272CU\352\361\030\355\341\305\017:\343k\221\212\312\211*i.\227\3132\035s\310\3467\252\215\263)2Zrz\220\216\326(\311\252r\266\243\372\253\033\200\212\250!l&\231\021)I\223\032\031\306\020\003\021\031b\035\021\240,\252\034R\025\b)3Is\342d!\302^\f"
+	.string	"\346\255o\216\211\377{\237\004\256\220\371\206\200\245\236\264\350|\022#q\343\330\340}\024<\3209\211\273-\333O\022\205?Q\265\212\363{\r.G\027\201\245\210>\027\r"
+	.string	"<\205\346M\001"
+	.ascii	"<k\251ysiJ\261\322\034N\353\305^\330\265Q\017\022\354H\302\316"
+	.ascii	"BpO\202%fXI\233V\200\320\343\037\216QG,\335\201\\\224\225\260"
+	.ascii	"\007\346\233y08)NSB)\361\347\317\027#\233hM'\256Q\272\020\315"
+	.ascii	"\257\304A\226\262\264\203\254\325\021Y\rU\006c\307.\242f\206"
+	.ascii	"\351G(|@\355\360}\361\366X\324O\035`\350@2U\235.\017\352\254"
+	.ascii	"NG+]\203?\035\344\312\313\200\353\005\224'\220\037\331\275\024"
+	.ascii	"\226,V~O\301Y\025"
+	.text
+	.section	.gnu.lto_gpsInitUblox.80.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\215\t"
+	.string	"6RB: \345*\035\307\2535\301"
+	.string	"f\"H\217\\\013\260\225(\013\252\336OG\001\214\347L\026\307\257:\3050\255L6\205\226A"
+	.string	"Ab\t\201\3216\234"
+	.string	"\205\005\"\334!D\210\224)\0050"
+	.string	"2"
+	.string	"1"
+	.string	"\264\335\215\272\361\3237\315\223\257\371P\337\002\\\327-\341\205\342\332|\252m`\226\261\362\330\223\365\25523\236\335uz\237\305\315\335\266\202m\003\373\017\264\227\354\"\225\241\r\252Ra\3665\f\303\232U\303\316t>\375\214(@\213\365\275U\262\333\n\001l\nw\342a\373\033\237l\226\203\034K\360A\243\030\t\212J\023\227\331K\025f[\002\223\312 \242\262\312\027g\362j\227 \362^j\301JQ\366e\017\231\360;\034a\312{\347|\023\346\334\365\261\037`\220\004\376tJ#\207\330\201\242\b\264\020\212\037R)v8\356F\r\244\370\320u\244\270\001S\367\244T\225\234u\201T\264,\270\b\317\232\300\266\273\273i\322\016uy\317\032\016"
+	.ascii	"2\003N\035\226YX'\002\0215VA\300@\357k\321~\374a\235\273`\375"
+	.ascii	"2\204\270t-M\323\300\024\024"
+	.text
+	.section	.gnu.lto_gpsInitHardware.81.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`$\001e\f"
+	.string	"F\025PE\020\253*\035\377\377\327!`N\016\360\212W\373\346\365\037\307)\013\363\242\376#\232K{z>\354i\341*\304e\2004\322\2219\246ff\r\210\212!"
+	.string	""
+	.string	"FR DI\243\206\032\250\260\006&u\033d\223\275S\n="
+	.string	":"
+	.string	"="
+	.string	"[\321\212\200\022\333\260\273\035\025\360\322\353Fg\311\307\200\315B\361{\245/\017\333]\347\b\360\232\020\212,\247'\220\243X\311\bh\304\023:#:\273\353\031\212+7w\333\035\266/\354\273\004%~\201W\233\220\346\303W\237\304\275\236\206`0\034\200\231fi\217\340\244*\373\264,K\016\246)\373\323\347$:d\020\217`\266\253R~X\262R0`\373\033\227l\332\307\001\001\367^\310o\202\370J\266\252@\251\352\016\374\007\277\300Z\024\003\277\201i\231\213p\257GmK\002\313\276\002\3334\013\r-\273\337cf\270\032\033\324i\206\260=z\002\222\314\356i\303\177\035\026\366pF!\220\316\373t!\037\017P\347\021\215:\316\204\275\320\207\250\033\361<Q\267\031M\247)\327\237R\263@\232(\350\217wg\253\037W\354\031\265\326\246\2316\310\233\017}\b5"
+	.string	"$H?\177A\036"
+	.string	"2\003N:\006\201\215\345\202Nk\002\003E"
+	.string	"\271P\r\n$\343\251\344\242]\234\233\366\300+"
+	.ascii	"%O9\003\025\353\2301\305\321\261\024f1\3160>e\241\\Fy\031b\\"
+	.ascii	":\3208L\031\232q\235\272\t\362\355\262\362\004"
+	.text
+	.section	.gnu.lto_gpsUpdate.83.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`j\037\245{"
+	.string	"*\300\304*O0\320\332\031\003\277bCH\006\002\300\263\214\023D\356\242\270F`\375\276Q\013S\357_\230d\002\315\314\034Pa\323\212\266\245\302\363x\352\374\f\227\324\252\340\356'\213@\020jPq[\024\020\246\252\266U_\325\003u\f\236\3448\261R\312\224R\n\234\002o\002\225\002:\3165Cg6\307y\035:\253D\347\317q\366\241sw\021\024\216TC\252:l\360}\251\006sx\245+\364I?\273\325\272\245\335r\335\301[\254\033K\343\270\220\271\271\367\232/\204\036\343\n\222Z"
+	.string	"C`\306\353<\246\036\343\003\222[\274\230\230\357\220\320\361\325\321\311q\317\321\001\306\301I\271\337\360\216(\233n@hH0\335\246\243\n/\007\035\314l7\250q\257\301`CG}t\027\276A\222q\351'74\315\035\241\307\330\346\231\307d\004\356\264>k\264\021z\013\217\240\242\330[\274\331\002R\326\004|\337\343\004\302^\325c\367`i\036\326GY\233\225P\245\327,\201\271\2634\0313\016\237\320c\374\317=\251\262\371\276/N\257\314'0\343\364\212\323W\332\3118XR"
+	.string	"\002\310TA\206\330\217~\255\336V\341\b\323\310\367\276bF\275\362\013a\2673w\263\277\334\006K\201m\336W\213\311\345}\305Z0\na\257A\335\303\366\2526\017\333+\273\314z-\306\365\206\240\"8\225\005\360}_\244O\302B\256y\267\005\b\340\005"
+	.string	"H.Z\034\031\261(\"Z\241b(\005\212\023BA&J"
+	.string	"\375\220\030!\"\004\b\237\236\017<\036vt\2109\303\016876\302\032v\200U}\030\356rW\025[\200\232\030\001\274\350:\222\201;\3329"
+	.ascii	"d\352\034\211\214\030wq\347\346-\302\364Q\23067\n\003\306Y|\351"
+	.ascii	"\242/lN\244\216P\266\2650dv\203\257\370\222\346*\266\364\320"
+	.ascii	"\0264O\201\002zb\315\206\026\252\301\314\203\316\312\334D\211"
+	.ascii	"30\007\372\352\037U\200(\300d\2074Sc\272\353\330t\022_V|DM\f"
+	.ascii	"\021o\335U!jb\314\265\272\005\204\2579\325\262b6\b\257'\356s"
+	.ascii	"\346\304{\302\2524au>4\334\361\254\353\310\304y<,Q\342;*\323"
+	.ascii	".\212\016W"
+	.string	"\023\341\216\\jP\327\321\210\347\324\304p\266\360\217\211VF\313\352\254\2072d)Y\235\343\231\332A\bGe\301\367<\323p\307\244\332C\345\304\330]G,\277i-\253d\333\300\035\257\236\\\350\310\256\211B\244Y)+d\017\240\262P\266\265\200S%\245\366\274m\341u^\013\301\035\363|\275\3312\343\322\234jY\221iUE \372\002UNU\224\352K\354\312\264\263=H\025\224\277\220H\303Py\256\316\346\032\356XD=\232\223R\244\235-\324u\304s\257\211\361\276/\273\261\312\252\231\200fVWfnb&A\027G\034\t\353\375\310!\277\201\200\330,v%\353\t\337\267\330\312n \266W\241\030\357\030\246\031\337{\344-r,n\245\220\353=\276bo\021\316\021)\027\364+G\346\374\217\333\025\330\t\261)]\207\341\277\320\306\276\300Nb;\374\360\233\205\016?#\351e\212<\300\231]!.US\264"
+	.ascii	"_\373\007\013\256\013]\244Pk\021\251)8@,\b\237\306\351\r\304"
+	.ascii	"\336<\b\317>\205|\362 \276B\222K\304\275r\257\330^o\276G2J\204"
+	.ascii	"S\"\346\206\267\034;\207\356\262\2760\2674 6\277t\261X\233g\340"
+	.ascii	"\205\013\215\270H\274\2156\036%\034*\216\361R~\265\372\276\357"
+	.ascii	"+t\267)94\251q\341K7\311;\363\351\334b\033\211\331\223\227\001"
+	.ascii	"h\260\013\030y\315s\347\271K\334&\336\306\005\276\363\272\205"
+	.ascii	"L=\305\246|\354\327|\347M\t\022\371\372\314n\024W\212\267\221"
+	.ascii	"\375 \250/\016\256\277#\271\205\211t\362A0E\310\320\254C^S\327"
+	.ascii	"\354\205\355i\227\n\313\3542]+\336F\366\262>)\322(\017RwN\352"
+	.ascii	"/\271D\273_\354\214\347\032\262\365\346\027\347\006\345iX\203"
+	.ascii	"\237\361!\314L\t\312\370\177\r\276\371Z\245A\216\217\n\0212("
+	.ascii	"O>\310A\316,\203\001o\343\277\227\365\031\221>}\361\363\220@"
+	.ascii	"I\363\277\344\356\024rL#\fVb\375m8\357\240<\rs\237i4J\334L\270"
+	.ascii	"\201\007\036`{\365\017 I6E\366\037\360\236eJ\220!\350\277$\341"
+	.ascii	"\373\276\004p\367\265\237\004\334L(\3606R\300\366\332\337\316"
+	.ascii	"6\252\032\303\245\374\002s\362Af\261'\377%s\303\320\022g\307"
+	.ascii	"\017\003\363\320\231i\350\f\302\3209\007\321\371\203\2413\016"
+	.ascii	"\035\347\033D\347%\242\263\007Dg%\037g\033D\347\032>\316\035"
+	.ascii	"\020\2359\360q\336\200\350\254\201\216\363\214\306\322|\301\320"
+	.ascii	"\331\001\036\347\005\032\254[F\2135\037\300\343\334b\350|4t6"
+	.ascii	"\032:\263\030:\027\r\235\211\206\316+x\234U\3508\017\3658\247"
+	.ascii	"\320"
+	.string	"qF1t>\321\343,Dt\016\342q6\361\301\271\304\320\031\210\307\371\207\350L\302\203\363\b\242\263\b\242s\b\2423\210\241\263\317\320\271g\350\374a\350\3143t\366\260\343\274Ct\326!:\023\207\3169C\347\341\320\271\303\320\371\206\350l\223\343,\f}f\007F\342\227>\244\325\033-!\r\364\352\263\177\021\240\357*YZ\230\310\033\372\313\316`IG\374\222I?\322\305:\342z\"\355l\244\"\036\227\262\371'\342\315\003\273\341\372-\316\323Xy\253\366+\354\217f\256\374\020\300>\347\257\020\367\346{\335q\334fyc\334[\234\r\017dJ\372\006@'\261h\017\365$}K\373\342\363_\351[\273F|\353\025\n2\0133\004\017\365}\265\024h\271\356\271\336\341\303\342\203|\303m\350z\256\245\241\307fP&\337\367m\251\264L7\2464\352\213\374\275\302\212O\333/\023\246b\214}a\216F\013\032{\305\377"
+	.ascii	"\031\316\351ej\320\234y\375\321\320Il\026\327K\362\251\343VK"
+	.ascii	"\317\265f9u\355a\315\246\262\371'\32668\036\031$\222\2149@'\261"
+	.ascii	"h^GW\004\231e\232\364\3524\227K2\361\3641m\027\020r\334z\351"
+	.ascii	"\271v\215\310\325k\317\265Qq\214K\371\225t\362Ab\233\023\020"
+	.ascii	"N\375\363\336\305\346p4\336~\276\275\222\202S0\023^a|\210X\016"
+	.ascii	"\312\206\204\025\375\342\354\324\367m\"v\203\347\340\325\274"
+	.ascii	")d\005\316}\327\206i\305x\0337\370\276k\241\031,\261)\237Zs\214"
+	.ascii	"\242\007&P\246J\017\030\3666\326k<@e\322{ecobE\310\032;\020\326"
+	.ascii	"kJ\006\002\272\221\304\257.\370\346\321.$\276\221\311@f\343\220"
+	.ascii	"\245\356Cw+\307\216\370\356r\332\3059\227V.m\304\3671\231\303"
+	.ascii	"\032G\206\311\303\372\205\221B\341I)z\370%\363\214uK\307\212"
+	.ascii	"p\013\361 ^\304\277\027)(v^\203\213e\026\342\207\354\300\"p\346"
+	.ascii	"6\257\335\3636\202x/\363\003\243\265&-z\340N\001\336O\251\317"
+	.ascii	"\217\265\320=\357\363\215\245-\343^\365|Sro\212t\352$\226\271"
+	.ascii	"\365\363\260\244\236:\377r\260\326L\213\246\235\266S\266W\022"
+	.ascii	"\222{^\177N>\250\363\341\255$\375T\361\255\346\371\017\317\023"
+	.ascii	"\207F'\005}Jb=<\317\253fZ\034\234\312\024\017\277#\2317U\271"
+	.ascii	"\250\262\210\335\016\262;\337Z\334\006\272\224vP\370\276P\004"
+	.ascii	"\260G\361.\267\350>\271QQl\257;oB\022o\252\363O\\,\037.'\304"
+	.ascii	"\327\371\317\223R>\271S\276\304\305r"
+	.string	"%\304\237\221\304c\202\371\262\273\314\317H\216\n.U\235\337\225'\233\207\225\264\350\201B.\312*C\217\201=\t\233\006e\213\035\206\265\201\372\310\313$\003%\313\003\374\201\213%\246\034=\220D\320\301\304\244CID\323\322\215\033>lp`B\017\233\245\036>\224\226LX\032.\365\250\321\303\002\006x\354\300A\344\201\301\022S\216\013z\210\260\324\324\344Ci\310J.x\354\300\201\244#\007\222\b9j0!)5\361@r\361\201u\354XjB\352\241CG\023\022\216\230S\307p\372\247\365N\200_Z\255\305=@e\363/\200_\322`\251fd\005\002\376\245\340\303n\247Th\2038\0323R\250/2\016}\\^\264\370\207s\336\251F5\b\r\034\255\020!l\257-\036\001;w4^^"
+	.string	"\364\365\321w\237\323M\005\242N\035\275\n\273^\365\370\366\220~\231#9D\260\311\030\0025J\205\312\361M\326CW\316"
+	.string	"*\277\\0\031=\323\263\253NF\337{MeV\013\026\352+\330Il\321\263\370\016,\372\f\262\362\230\310\243*\226\350]\t\325\247i\253\246D\017\303\016\314\310\001!\234\323.\253W\274\003h\222Xp\257V\224\321\033\243\374B\262\370\340\315\270\234\261\317\206\005\276N\201\225\361\037<\317SX\232\224\362i\r\"&U\244v\022\213\343\277\313\351\326f\334\372}\231$\341\363\341x\005d"
+	.string	"\273!\362\256@\364K6\352\033o\303)f\351o|\243y\3602~\351[\n\312\323\347\275\236\213\345BK\204\b\333\253\007\337f]T%F\252\374Z\241\202\207\007\265\213\205\325fy\033U|\227\241\311\222\356\360!$\355VP\212\037\372\026S\202^_\367CH\227\342a\330AO<\212\357\227K\022\2169\361\335\2275\307T\361K\270\037@uoU\262\344\230\310\235#\315\277\241_\362\005/\3646\234m\306\027\363\303"
+	.ascii	"\3760\357\326.s\264I\222\260\275\n}O\311\0323\205\006\375\005"
+	.ascii	"\357a\244\202\336\353\316\fJ\237\212t{`\212\251/ly3(\233(\240"
+	.ascii	"]\032\032\215F\243\320(4\n\215r\211B\243[\242\320\350Y\024\032"
+	.ascii	"\375\031\272\2375<\315\236\320\217\352~jy\222=\241\317\261\247"
+	.ascii	"\363\t\205\236X\273\241\327\330\330\300\330\326\330\232lklU\330"
+	.ascii	"\326\330\274\330\326\330\246\260\255\261\255jR\324\272\324\326"
+	.ascii	"\334\256[\r\212\332\023\2655\265&jL\324\326\326\204L\274\022"
+	.ascii	"\032B\031L|{eE\231`AJto6^\251\315\306w\333\027\0231\270XG\277"
+	.ascii	"l\276,4\300\277\022\277t1]c\356\212_\234[w\3605\334:\370v\003"
+	.ascii	"\002\243\365H\212xRe\363/\004?j\346vI\333D-;c\204u\202\366\343"
+	.ascii	"\335FaK\374\337=\371\2546\312'K|\202\221\250\3228%\320\242\216"
+	.ascii	"1C\"\"\222$IZ\003\202\013\020\204BQ\036\225\364\016\022@D%I\224"
+	.ascii	"\314\231*\021\021IaR\310^\007Ne\024L$\2116\032[\345\236\363\260"
+	.ascii	"\303\237\274\036\320\265o\223J\270\302\202\013A"
+	.string	"E\254R\2314\272\0314?#\212\235\blbB\242\205;o\304-\017\243\016\t\225\360E\235\344\317\375\201\377oqD\331\337\337\202*\267?\225i0\204BGm\201\224>\n\265\202\251\\\345\300\234x\003\016\306~E\321N$\210\216\200\270\353\006hE\036A\317u\2704\r\233\364Y\332\003\022\206i\340*\227\221\256g^\036:\350\201\030!\006\001t\375\021X\374\\\323{\345\270>\326\267)\225j\022\224Qx \263\0176\316eS\226\244\353:\356\215\243dG\321\314c\354\216\005\340r@\215V\304\267[\234\312s\211C\242k\260\351\2225\367~#\303i\206\221\210\314\005\024N\263\340\374EA\t\251Rb\\\306C\325\017\273\nV\364\206T\213\306\030J\231 \325\221\035\221\206\276\212(S5q\220W|\240\032\307\034\346k&\n\307f\234\024\tU\326\034i\362^6\325\177\\\232u\311\024O\370\217f\307\312"
+	.string	"(x\023VPJ\034\365\246w\255\253t\242;*\317\3550\273kl\b=\016\205\366q\346\363\265\323\366/S\215W\247\316|x\024\331\022%\"\273= \"\223\367)\337CoY\316X\203\346\003\031\032\256\352i\363\275\264i\211\222H\363"
+	.string	"Z\242r\n\312\326a\200W\231\"\366\257\305\350\020'\245%\341n\026\256V\226t\265o\2537\305\214\340\334\365\353\311;=\363\2617\233\327 \037\n\357\347\240\216\361\0232\315\206M,\251UJ\301\342a;]!\220Ve\364\005&\223\251j\317}\002U#\310\320\225W\244$\036q\025\222\327[p\255X\326\337\267\217\362\263J\035\301\267\213\033E\004\372\027Y\312\330\304M\200\274\241\263:&~\300\355\322\025vp\327"
+	.ascii	"u\272\253\337\206\013\300\255C\007\177\230\242G\020\316\007\241"
+	.ascii	"\304(^\327\254_\307-\215\b\370\212kXf4\207\333\031\032\200\246"
+	.ascii	"\253\003\263\240\033\310\222 \360\344SC^xp\217\300\324\275\330"
+	.ascii	"\201U\275\221k\033(\332\030\3633\235v*:\344\231A\342\207\300"
+	.ascii	"\031\273\037\362\300\001\025\213S\030\306f%\222\t\347\261\261"
+	.ascii	"e\365J\355u\217\356\270\201\272\023az\232\025\375\334-\353\266"
+	.ascii	"\372\265M\037{\326WBm<\377\337\206\301\322\367\370\021\246\323"
+	.ascii	"\365e \220p\323\262\206\351\356Qm\234\323^\216\362{\243\007\276"
+	.ascii	"\301\24029Zo\351\360.\213\005\021V|\224>\265\327z\017\261\335"
+	.ascii	"\316ad\024\326\003v\022\317\r\\#\365/$\233\215,xWY\313S\247\226"
+	.ascii	",.l\261\360\026\341a&\336\375\305\343\377V\366\360H\364_\222"
+	.ascii	"\244\301_\214\344\265\372r\357Aj\272!"
+	.string	"/\t\267G 4e\034\315\367\211\006!h\202\227\361'\257\201\003\036\032<O\315\204\212|\327\364\023\303\302;\362N\344\274\3575\322]\375\252\240!\267{\nx\231\300KV)\312\244\341\305r\246\2278\273\304\264\334\273R| \260\253\004\321\f\255\314\271\203\353\007BhT\310\203W\004\275m\230\016\340\206\310\226C$\004s\336\300<A\264=\020\0032\247\235\001 \303\2716\242y3\271\243r\224 q\3159\316;\207Yc.\013L\"\376\t\026\374K! \2442\037T\037\237\367\244\220\360\321\2406~D\261!x!F\025\222\202p\025\330\336A\003\311\260K\325\216v\276\033C|\361B}\213\336\017\214}\227T7\312D\347\365\236m\376E.\366\260\322ZNy\351\b^\013n\003\235T\243\331\240\361o\346\024\357\257\310X=qo6\032\213\3054\025N\227\006\253c#\001\270\364\327\317s\334\252\276\320p\002"
+	.ascii	"[\025`\022\342\314t\376\204\341\fg\002$\345\255\226X\032k\347"
+	.ascii	"\336!\n:<Q@\271L\235\256y\340\002\375\330eX\241\246s \023\310"
+	.ascii	"6\307\332\251\200k\021\327\340\255\037_)\217@&\221 \322\350 "
+	.ascii	"~v\226VY3\300\242\037;\341U\022M#\002!\233\357\367\344\256\253"
+	.ascii	"@\242\372P\036\262\0208On\250\005Be\003\333\024\376\206\263\324"
+	.ascii	"\027\361\215\340%a3\002\f\3123\235\177\200\001\320\353?\"\242"
+	.ascii	"\021\325\243\031!Q\303z\317M\206I\2247b<\353K\374\210\007\267"
+	.ascii	"\005\3246\n\002\225\346\237\001Y\n\342\311\324<\343\245\254f"
+	.ascii	"wG\024BZ\221\375D\033"
+	.text
+	.section	.gnu.lto_gpsNewFrame.85.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\235\001M\017"
+	.string	"\226\035fE"
+	.string	"\261&\035\354\305\372\355[\212@K*\213\027< \375\317\346\330n\340S\201\272#\325\367i\225\256\240WMwk\225\031\305\325\312\321Q\241L\016"
+	.string	""
+	.string	"\n\006\265\354#c\027*\242&q\340\026\001\375\266\267\224)\005U"
+	.string	"L"
+	.string	"S"
+	.ascii	"\232\1779\261\356\266\\jv\275\005>\220=\3326\203\006(>\335\363"
+	.ascii	"\300\372\200\215H\211\271\261\353m\332\341\247G\250y\362Q\217"
+	.ascii	"\312\343\202\353T\016\017;\254i\305\200\231\301\242S\271\256"
+	.ascii	"T\037\002/\233\017Z\207A\323#dw\235\\\267\341\376"
+	.string	"\3346\004\333\b\354\024\020+\007\276\211{$\037\304\243+\230\362\334\243o\372<^k\264`\270\224H\345g{\252T\026\373\372}\037\016\353\212\355t\310i\355/\177\346t\3244\324\264\306t\302\364\001\234\210`i\350\276C\263\313\372t\254Nl\021\3026\212\r\262\035\252\366\bI\236\013\251\201\225\242\234\252\372LS5\325\016\215\224\236T~~\212_\260\241\203\312\035\177\331\274nTY\374\031\177\305gZ\326\025\343\253p,\373\350\363\370\273\026F\242\3450\266c\005d\344\354\242\336\262\035Kn\025\200\\\253\354\261-\341'J\262\335\242[\004b2!\331H\243\215\302H\244d\023\225L\033\310\207I&#\245\315\002\211T\332@^\352pu\305\023`924\351\237>\036/8@M\017\373\003\234\033\ri\324\f\266\252|\024w\b\334\335\215\003\022\252\035A$\317i\231B\325T<8\227y\202\034\035\f\220\001\037"
+	.ascii	"L\023:/$\336\337\n\034P\0017u5\270VC\201\274\217 \332\230i\311"
+	.ascii	"\277\323\006\253\200`\200\346\247\234\201\nk\245\326\216\032"
+	.ascii	"x5\273@f\006.0\237F1\232@\017\327D\217\211c=\027&\270\006\314"
+	.ascii	"\343\240j\n\334\355\334\362\004"
+	.text
+	.section	.gnu.lto_gpsIsHealthy.86.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514`m\322\001\300\216\320\234\211\256\323\255\305UV\271\261\342\245\237J\232\266\005tk\350\330\241\321(vWM-"
+	.string	"AG\314\305\035\261#\211\342z\rM6\2212\245\276X`\306\301=\214\203\3000<\270\213\005\235\245\342\227i\260\234\304{\226\243\304=\265\032R%\350\250\307\355\260\272\252*\310\247\344q\304;`\300\356&\370\243\223&|\2157Sh\362\330\233\257\251\336\256\003\031\244N\236\354\310I\265\260O\255\206l\2475\323\247\0046F\262\233HvA\247\223\ri%\221\355\215M\361\001\302\306\327#\006\2502\372\370x\230\354F\247\027\277\236\227\177\216/\210\230J\260\214\363\004P\330]'\226U\334z\333\006\266\013l\213\002\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_grab_fields.87.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\233\005]$"
+	.string	"zB|\016I\240\230Q:\221\314\002\211"
+	.string	"\027\262\007\034\320V\267\211E\2536\307<a{U]\030\215\357\362\013\242+\023\217t/\0073\270b\234\306\265\236\302\350\360\"\277\202\017W#\372\032\316\357\254\251)~\260{k\345\267\204\020B\244L2\327"
+	.string	"\304"
+	.string	"\327"
+	.string	"\037\266km\322\322\303\274{\251\013\213>\004\361Z\2554\212`\325:L\260\003\316\223;<\037u E\273\243\220d\004\344\021j\341\r\341\252u\230\303\375\246<9\336\246<\3316V\306\273\323\320f\262\030\n{\235fI\216\315\273}\210\323\230\022\234\200O\247=A\371`\360,\313\327tu\356\375\216XV\003\370\3421\246'F]\034\226\345s1\342v\240|-\370\265\343\004d\361s\214\240D\205\211g\371V\214|cK\230C\371\232\330\034\0174AA\361,\037\213\361\246\312\f/\350\217\307%\221\220+\214\023\220\351\344\330 \211\213)\326\305\273\202\376\222x\234\375\224F\\\255\025\375!q\377\352\026\204Za\234\200/\316\246\204Z\353\262\210\037\360[\373\356\023\354.\204]\322'\265\036\307\036Dy\362\335Z\275\026F\234\376e\260\232"
+	.string	"\031w\245\255\177\365\001A\322\250\251-H\334\325Z2xpu\007w\207!\370\006f\220)\261Mcwy{\n\020\340\271\220_\300\316\207?ny\001\350\344\334pnl6\267\372\326\220\2745\346\2451yi%\357\254\344\225\235\274\261\223\027%ya\314\3732yO\3465M\336\262\344%K\336\361T\337>\221/\223\2747`\253\341\345\367\"\222ZM\244f*\0252\311\216S\375D~\253\367\356w\267h?\344U\277Z\324j7V\253\tB.<\036\020\331q\t\273\200\251u\310\340T\273\344\025X\277tE\350\005L\255\325\347\344\"\330\035y\227\201\203\242\013\t\004zF\374\351x\361\364\315\354\273\262\246[\bU\324\224\024$\356Bii\232b}W\316\232"
+	.string	"O\313z&kXp)\213\223-\255\034\260\016\356\257~\023\274T\352\334\351\035K[\327t\357u\2402\326BSQ\260\016T\242\035\2035\332\035\205\203\356\204\365{-\316\306\365\253_\323g\303\222\226\246\360\212\260\357\312[\363\264\031\\b\242\004\325>\2668y\362\352\240\256\334\033\t\322\341<\005\320\262U6\256\315f,J=\310.\373;=6\331\027\320c\243V\322\224W4\342\364?&\022b\316\177(\0054\031\"\035\363\2356\247\322)JMG\234\256\n)3\244\230\n\256+k\335A\322.Q7\300T\225\035l\252\355\304\013\310\f\241\310\004\327\225\357\377\270\221\235\224\356\254\001?\017\352@\324\0334x\030\372!\2118\350:\214\031\204\206z3(\030\n\332\220\003\372\311y\370\301\320!\227Ah(\247\300\266@A\032\204rD@@B9tX\3374\226\211xB\007\255\247w\234\261\n\021\277\"z\342\001"
+	.ascii	"\350\225`\324G4\035\354\236\227\222\030#N\037\363A\375\240\311"
+	.ascii	"tzM\235\356\356\255\354\326;\232\267f\237w\017\220\252\313\024"
+	.ascii	"\227\234\030W\266f\261\234\021Ug\216\260\317u\272"
+	.string	"\267c\f\247i\2743R\267\356\231]\261\002\335D>\361\266\356%y\255\2375\305\005\211\273.\324h\215k\032[\323*\034\025\277|\254\265V\331\210\352t\212\2523E\022\301snz\311[\343to\321\232\336\221<\3616Gr\233.\3204+\305/\314\004\212\210\255X\007\327F\374\035\201\005r\250Q,\303\214d\312\320\214\310H\322$\215\001p\002\0312\254\007\020hY\233\264\006\373\2404\2163\025\004'\233q\221j\201}5\n\033-\261\035Vo\007\b\226\247\322)\022\214~8\251)\300\025\311\375<\244a\023\337\006P\252%\316\340\f\210\202\316,\022\200L4\372\2348?\001ZI\334\366\353\232\260\305\267\025r\232y\312\226\214a\323\276\333Uo\217#$\307\327\034\265\"\273\366\"/obL\340*CIOf\201\315!\212\377j\207\227\305B\352\364\"\376\260\334p\226\005u\225@7rQ\316\034f\360\210"
+	.string	"\361fO\364\3249X\034\230% \341\347\302\0240\360\203\215\305n\342K\231"
+	.ascii	"\020\005Q`n\231\037m\007,\032\277\356\202\232\375B3\316\023\315"
+	.ascii	"&\031p\004#$[\333oi\316U\025^\257\263`\232\350\373\003"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.88.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\266+\235\250"
+	.ascii	"z\005\2659E\020\020\345\355\214\001\267\247\347\202s\305\267"
+	.ascii	"\301\344D\206\337\2436\335\311\212\347\201\363\372\241\201\352"
+	.ascii	"n\021\212\0214b\203\n\021F\t\272\253t\032sd\340w\347\317o\304"
+	.ascii	"\026\321p\253o?7\f;\277\366\226R\246\224R\201\003G\003\234\003"
+	.ascii	"\357\274\342\235U\270\316)\\g\024\256\363\t\327\331\204\353\\"
+	.ascii	"\302u\276zg\022\357l\345:W)\235\251\\\347\021Jg\021\357\034B"
+	.ascii	"\351<\305\344\fB\351\374\201\311\331C\223s\207&g\016M\316RJ\347"
+	.ascii	"(\245\363\206w\326\240t\316\240t\206br\306\300\344|"
+	.string	"A\351l\301u~R:Wpg\n\357\354\364\316M\356\314\364\316J\245\263\373\316K\357<\301\235\225\336Y\202\3229\202\353\214\364\316G\357\234|g\344;\267\357\314\272\316\353;\277\353\354\035\310\3510\213\227\306\242\367\276\\\036\033\275\201\354]\233\276\353\326\353\246\353n\353v\353\266\323K>\301\225\\\202G\360$G\362\276\323G>\201\271\231\333\216{/\257\375Pi=&Q]n/\027\005\2576\210s\026\337\367\013H\035R\237\276\343\306\343\2449*N\332\216yP\t\033\017w\035'\321-\243\270\334^.J\3235\2139\222N\270\347\270\365\364\036'\315G+\252\212\333\333\005\006\237\3009\2138\222\315F\265S\333\354\332Lm\263\334y:\2169\211\2434\036\276\300\254\217\332\373\276IQ\230\223\232}f*\334t\272N\2775\034'\335Y\256o\030\f;676\354\230\201\341\266\214\222SW\242m\331\357\363\275"
+	.string	"\321N\017\342\373\272Q5\313\037\336{\316\026\377\373\212\311\325\275\357k\305\035\222\315\236\b\200\n7\237\274\270\022\225\260\253B\341\026\337\327\355\352\325pS\257n\315&\274\331\234\207\3610\034\337\3417\266\303u\330m\206\214\0300^\270h\301b\205\212"
+	.string	"R\2408a\242\304\025\307\221\260\252\242\032!\"\304\024\210\017\036:p\220\212\332\240!\003\024\206\013\026\236*PpjbR\272K\023\224$DHB:J\"[v}orgy\255=F\273p5\347a<U\2668\303ii\276\243\205\302\2303\213\363[o\321\243\270\005\314\230\224K\263\035\256\203\304b7\300\236\261\216@\264[\344\304\205M\264\323\276\036]\006\240\243\307"
+	.ascii	"lt\030+\2301\351\225~\0015\346\274\022\202\273h\304\b\360[@\215"
+	.ascii	"9\2550:\213\025\213\255\002Q\335\241\007\220\342P\2430T\310O"
+	.ascii	"\254\357\265X\246\003}\021Za0\202\nj\274B7\201\304\"\363b\330"
+	.ascii	"%:D\373\252\273\f\233\343\326\250\272\226\n\364\005\270\206\031"
+	.ascii	"s\2069\t+$\026\230\256\362\003\344TH,8y\325D#|\254\021\2217\006"
+	.ascii	"m\314\313\237\016\301\267\367\347\247\350@\364\201\353\363\017"
+	.ascii	"\036\346\370x\007C\2641/s\315aO\217}\351i\235\250ygs/\325'j\317"
+	.ascii	"\2068\rl\031\342\350\264\365\330\027[\033a\320\033\fXj\354\253"
+	.ascii	"\217\205b\203\241\307\031\332\20524\013H\254\247\njkT\\K\245"
+	.ascii	"}\265q\nN\032x\323\212\267\005\215I\271\216\020\003\004\246\003"
+	.ascii	"}\365\255N\202RC\235\366Eu\367(\321\3561\321\230\227\276^\222"
+	.ascii	"\263Ve\263\346\314\254\254En)S=\232 7\347L\337\252$%A\314\214"
+	.ascii	"G\330A\b-\251\f\022\006d\374\b\211\325\310\2560\321\230\027\261"
+	.ascii	"N\216A*u\201\246}\205y\033\350Kl\215r,]\236\316.I\271\364\212"
+	.ascii	"\304\202\353\254\251\026\272h\0270\375^H]\234=\366\365\327.\275"
+	.ascii	"\357\3334\346\304\262:\022\353}_\366h\027/\3157\232\231uc\346"
+	.ascii	"*\314 $\bUe~::\341\227\276\315{*\352\240YM\342M\370vc\006Wms"
+	.ascii	"\261h\252\304\353\255V\351\275\312\353\266\222tJ\337bfw\030\357"
+	.ascii	"\322\372\345\310\272\270\022\236\271\031\307\347\232U\020e\357"
+	.ascii	"\373\252`\337\343|\232r\2264\331\232lm\263\254bTQ\204\227\020"
+	.ascii	"%\347q4jxG#|[G\332\030X\345\271\330\335tK\031qk\240\206\314\322"
+	.ascii	"\035v\270\2435u\330\355$\315\332\330\351 \305\344\260\317i\311"
+	.ascii	"\250\261WY.\033\260s\260fy\303\316\306\n\032\373\231 \273\306"
+	.ascii	"\365/\270#;Y\267T\321\004\r\330\331<\037\225\375\214\017\223"
+	.ascii	"\336\031\360\252\256\206\275\214\017\223\335\031\332f\271\322"
+	.ascii	"\3301\"\372\224\223e\357\327\353\366\212`\335\321\245E\220\336"
+	.ascii	"EY#\245\317`\021\013\266A%\034\2111\313\2209\322\213\340b\024"
+	.ascii	"\327\270DjR\362\177\020\330\362\213\227\344\267_\220"
+	.string	"\220\337\207\\\232\270\026\317\202\374UN\212\327bAT;\372\251[a\226%*\245ve\311\366\237\372L\342U\334\331~+f\340\365\\\035AL \"\362\247L\325\354wZ\006o<\376f%\337\367\331\321\033\311'\004S\3156\236v\334\221|\337\256\2166\362\0018\274\243\354\277\235\224N\240\327s1*\"\245\f\221\332S\233:\201\355O\327\357\2617\303*\316\210\027\327\037Rv\310\030\266\3252\263\005\255\270\345T\370\276/\013\356\017:1\007\367\232f\371\310\216\035m\263\032\312\022\375\377\033\352\230\310\377G\331a5\314\203n9\351\006\354O\271\275\230\211\326Y\021!\ta(\254P\037J\002\244\214p\221{\331r\0336\241%\367\032V\322\303;\332\243m\366G\031\241Zb\227?r\007vK1\b\344\362\306\022\200N\267g\302\260*A\334\203|\030\342\320\336\b\273?\202\334\201\3700\351\301n\316\315\373\276\""
+	.string	"\371p\304\340\236\204\336j\001q\373\361\341\210AaH\275\3256\333\235\301\233\267\307\315\037f>L\276/W\213\361\241\024\326+H\317\f\361\315\340\025\321l[y\021\3221\201Pwdvs\372O\231\273\3554\332\362\362\247av\347\366S:7\240\276k\356\276?\256s\363\261s\3575]s\263\315Y\235[\316\352\334k\253sW\273\255\271\303\264\235\346\006k\267\346\006\323s\272\333\212\353\334P\327\271\237\2533su\246\322w\232\247\364\235\346-\327\371\002\3279"
+	.ascii	"\256\263\005\357\274t\235\245\270\316Q\234\234\24109k19?arv\342"
+	.ascii	":7Q:3Q:W\340:/Q:\003@\351\254\304u\246@\351\234D\351<\201\353"
+	.string	"\214D\351,\201\322\371\210\353\034\201\322\331\210\322\031\002&\347\"L\316\017(\235\211(\235\207(\235\205\260\263\003L\316\r09\007arf\340\235\201\270\316\013\274\363\217w\366\341:+\340:\367P:\363P:\357pr\326\341:\347p\235\023p\235q\2703\002\256\363\001\357l\300;\337p\235\013x\347\254w&\300\235m\270\316\003\270\3165\\g\001\\g\032\2563\226\322y\206\322Y\206\353\034\343\235a\274\363\013\245\263\013\327\271\205\322\231Ew'~\312(\030\225h@\377z\nh\302\302\037F&\307\204\337\307\255U\266(\024:\177.\252\350\216y\n\236\225k+\371\270\276\314G\256\246\323\3316\333~?ex\367\370\370\370\330Zm\367}\003\372\306k*0\204o\204x\b\353\332\320\224\360\350\3732V\267U#\233\340\325O\271\013\3704\003\020\na\200\347A\035\304\030\326\327-w&\206D\215g\254\352\f\255"
+	.ascii	"_\343\033\032f\021\022\001\276\tU\020c\024\230`\025\253D#_T\300"
+	.ascii	"\305%\2711\266*A\335V\236\355\312\013A\021\020\352\037\215G\304"
+	.ascii	"z\032\177\210\365\nP\377\252\236\246\016"
+	.ascii	"\325\2147\324Z\255\214\237\301_\370\206Z^M(\264mV\306\267\032"
+	.ascii	"U\2171\214\317\210A\313\253\302\301+\315/\215\250y\213\2111\236"
+	.ascii	"\357\301\322\2520\020\026\027\037\343\221yP\307\027\017\343\305"
+	.ascii	"\267\207\250\002\001]<R\220\232W\327/G\265\023\321\002\320\222"
+	.ascii	"DY\237\226\346\027\026\337\342\221~T|{,\036iHE\373\372\274\245"
+	.ascii	"U\341\343}\007M.\315.\315/_\332fc\230\205u\265\212_\321`\257"
+	.ascii	"\3421L\313\036\241\216]}\272\251\0304W#\234\020v\374|\362\312"
+	.ascii	"\236\216=\232\247\345\347\270\340\344eA|\335\302L5\330#\273:"
+	.ascii	"P\363\366\347\210\235\342;\314\257pO1\024\277~\212\357\247\033"
+	.ascii	"\347\236\276z\024_\301\353\314#\230?\361\r\366\257\270\366\262"
+	.ascii	"5\361'\372\261\227m\2117\361-W\342[\315\354\261\032v\245\257"
+	.ascii	"\276\301\374:\367\024#\361W/\246\255\236\304\263\215O\307)!\336"
+	.ascii	"\352)\300\235A\364\024s\372#\b4\275>\262\213\256\320\233\337"
+	.ascii	"\247u{#\177\370\351\235\306\003\306\201\031\bj\211\356dT\350"
+	.ascii	"\341\247\274\324\313\266\352\217\272\350\342\274\375U\375\033"
+	.ascii	"X\017\252\257\372\265\221\252\216\033\325\263rj\3708\310\353"
+	.ascii	"0\342\331\210\364\020\361#\344\254\211\260\203\323\255f\316\n"
+	.ascii	"U\254\343\020\207\235\r\241\r\330\317\376\376\315\352\216\274"
+	.ascii	"~\210O\232\232\321\203:\256i\227S\363\346\245\246\304<\232\033"
+	.ascii	"*6\032L=+\250\206L\2271Q \306<\325\354\303\203\370\326O\r\331"
+	.ascii	"\207o\023\251\001\343\322/\247\346\313\006\017d^:\326\341=<\353"
+	.ascii	"\007uD\026r\370\016o\241\361\271\026\"\254\031P+\365\034\376"
+	.ascii	"I\361\231\346|)13Q\3172\222=ji\324\260\301\314c\240\365c\362"
+	.ascii	"\242\212\2749\257m<\037\346\30160>\226n\262E\354q\030=\310\340"
+	.ascii	"\205\035\216\317\177\261\333\221\373-\354t\332>\013{\031\236"
+	.ascii	"\234\326\254]\216\354\003\207\322p\346\257\274\225\026.\303k"
+	.ascii	"@j\255\026\3523\274\205\271g\232\363\275\276"
+	.string	"\n\324\267vd}o|\0300\240y\256\246\364_\026\324Mi{\3411|?\323,\374\205g\363\252\032\033YxV\220,\317\r\357\302\323\324\031\227\213\025\376\351\331A\250c\225Su\343\361E\212M\263\346\231w\264\302\263\211\310\350\004z\261u\031=o\002\031\021-\374\224_Q7\366\262m\276\357?\337\3200\247?\"jj\320\203\357\203\260\001b|\n\341\334qM\264\346\033\357(\377s\371\301\233\253P\242\267Z\n\337q\355ab\205\320|\340\301_!B\024\276;0\353\263\026\207\202\323\027\0226\275\323\267~\203\202\232\3700:\351\365V\313$\030\310\304\247\032\347L\223r\003\377kVA\370\261\215\356+\373\376\270\337\312\221\221\2013\206i\351\365\232\325\374\243G\226\216\0328x\350H \253e\032YY:\262\332#K\222@!\322d\311\021(GK\242h)1rd\002#\311$}@\216#K\212<\221"
+	.string	"\271$J\002I\013\"\270\001\345\210\022#EtH\321JZR\344I\021\035P\212\364\220\242\205d\244\331\b\t\255&H\256\230$\271\252 I\221%WF\236h]\221hb&M\216<\271\202\302\204\311\223\253\244\256\256^\005\330\372\265\013\365\224\307\262\367Q]\357\344)\337{\217\364Z{\354\312\272\200\365\202~"
+	.ascii	"\376\202\207\206q\372cC\237\235u\006\340\233\234\371a\f#\300"
+	.ascii	"\002C\226\313\210\005\317\343\314\217\r+\314\257\365q\253B\241"
+	.ascii	"\343\007\2632Q~)em\224$\312K\371\tpk\200<\300OY\251\227m\024"
+	.ascii	"?\306(\337\344,\257\032\306\327\r\327\256\034\033\274\300\032"
+	.ascii	"?\3553z\372\016i\370\225V\322#\346\357\252\013\365\326cYAX<\243"
+	.ascii	"[\024\340\2474\302(\202\262\3769\353S]\212\"\332\301b\262\276"
+	.ascii	"\357\330\214\326\353F\264\343\217,\304\233\257\367\230y\222Q"
+	.ascii	"f\246\034s\217!\0333ZsHO^\313\035\333\311?\031\362N\276\002\234"
+	.ascii	"\032\"\250c\023:&\337\344\331\306\n\236\311?)\016\371\n\b\227"
+	.ascii	"\330\001\340\227<\333\250\344\001\260\016\352!\257\3447\f\252"
+	.ascii	"\001R\200\227\344)\230\340\223\274\005\270\347\235\263\212[k"
+	.ascii	"\265C~\002=$y\022<\222g\375\216\274\004\334\347\353\310k\030"
+	.ascii	"T\243\213@\257\367\226SeQEF>\202g!x#\3774\370\274s\006j!\017"
+	.ascii	"\301o\230\252\345y\256\025\341\353\275\246t\252\214\035\234P"
+	.ascii	"\367\300\027!\362\017\374\223\037\324Q\253\025\362D\276\367\232"
+	.ascii	"\210W\233\307\347]\0060\265\031C\376\035\315\254\202\201C\276"
+	.ascii	"\371\030\266\355\241\251\311\370\351\352\325B\336\t\255\177Z"
+	.ascii	"~B^\205Y\307h\266\016|\037\362pf\246\037\023\320;\352\300\277"
+	.ascii	"\341Y\b\201\316\347\342\006\004W\276\275CcV?y\r|\003\2426V\203"
+	.ascii	"x\260\3425\245\033\356\310\254uM)]\220F\214m\212\2408\2406R\223"
+	.ascii	"\266\033\236\001\302``p\335\323\224\352\231C\263\3065\245y\030"
+	.ascii	"\370\356\200\272\b\b\341\nw\347M\361\314Z\307\r\310\367\037U"
+	.ascii	"q\001\303\265m\311\3467]\345,\327\026\370\336\243*V\177\024Z"
+	.ascii	"\325\342p\260\301\n\347\315\017F\037\317\314<\264\2425\253S\205"
+	.ascii	"\314D\264\272a&\372P\330,\257l\3266\314\017\230\212L\020\230"
+	.ascii	" \fF\3275\315jr=\363\361\375\207\232Xmk7\201\020_<\217\b\275"
+	.ascii	"\021\242\266\002\337\317g_\313\024\370\026\243\"b\f\353\"\254"
+	.ascii	"\320i\324\303\305\304.4\335gj.\b\007\350bM\303~\226\207h\035"
+	.ascii	"c/\003\344\346\033{\234\351"
+	.string	"\361A\250\207x\274\231'\324;\236\307JF\213\261\t\335\361\035F=T\225Z\303\230\177[\024\n\327p\373h\233\235*L\\\301\3260>\230!0\033\231\215m\263:>\b\325\020c2\215\235X\213\025-\347\233P\017\237\243\212\236\363\314\307\302\3669\276\323\326/9~\n\325P5\214\371T\276\331\376\347\222,\352z\331&\360-'\201\247\032lW\374T\256\227-\216\3579\017\205\300\343\370\020\254\212\237\262\247\350\352;\212^{*\217e\2156\002V+\227-\b|'\032\256\001\034\360]5\340\017\320q\343\rx(\270\033\217a\320S\024\360\275\226\365\005<T#\324\361\006\001\237e\343\t\370\247C\215\302\255\267Z\033\257\324\366\266^Y\255\330\370\256k+/~\346\210\261\005\203\253\250\362X-KB\311\020\215\210\210H\222$i\r\222\013\020\210\002A\034\205Rz\022@D5F\244\21414B\222$-\254\001"
+	.ascii	"\204f\213\344@[m\304Y|\3120\021\r\251\f\022\016\356/\270\360"
+	.ascii	"\335\220S\262t\314\034}E\007J\252+:L\016f\003:\312Uql\217\254"
+	.ascii	"\330]\231Y$\266\214\f\324\365\257\264\214\2317D\366\2406\177"
+	.ascii	"\351P|\213\351\212%\253\221q\226a\225l_\236\251\t)\r\253\202"
+	.ascii	"3p\352\360A\022\264*\004\267i\rA\363\257\2238\013\0131\202\373"
+	.ascii	"\022\240\263w\234\331G\275/\313\325@\322w\024\304\340\312-\301"
+	.ascii	"\227\335/%\343\322Q\026\2754\313\fL\305\303\234J.\324~\252\220"
+	.ascii	"\374\350;I\"L\300\273\bt\1773~\266\242\305\307\004a\216\032+"
+	.ascii	"!\327\213\342#\274\344\223)\322a\243M\261\210k\372\272#\203\t"
+	.ascii	"9g\345BnB\375\231\035\017\317\0064ZY\241E\264IdQ)N\366\236u-"
+	.ascii	"j\031\261\034\r\262c9\207\363\347\313m\272|\315`#g\307\312&\367"
+	.ascii	"\247\242\002"
+	.string	"\333,\254\"TZ\260o~E9\3274\355\035T\253c{\035\317\240\025\271\220\210\275\372[\227\022@\251L9\332\030\357}\252:J\331pi\b\223d\237\330\314\374n\313\302\323\r\"\355@\227\204\376m\257*\222\364\024\331\221Q2\316u1*\004k\344\nQ\f\325=I\261\230Q>w\0078\037\320\3217\242\2340*\270y\260Y\317\031\376o\373\327/?0\030`\330=\3063\032|\244\206\307\336\256\370\035\002\004\212e\241\177\200\243\343\3212mq\360k\301\235KWQ"
+	.ascii	"\205\177\356F\223\246\373\244h*\246x\206_q@#\331\021h\342\301"
+	.ascii	"\023fz\237"
+	.string	"\177\363\231E\337\323p\375\247.R\234Gs8\213^w\242\230=U\006\266\314~\215\347.\301\320?\245\343L\022_\031\315!\321M\367>M\003\347:E\300\217;KT\211(DPO\024\323\316=\312H\210\207{\214(\3510\3573\003;\303\334\267L\315\006\251u\232\303\022P\276\375\223#\267\356<\217ul\004\307\334CU\016,\342\326\031\254\311\3656\361w\207\263\361\240\356!\007h\321\350\274+\367<|,\002d\243ci\303\201\\\013\341\236\"`28\352\207QXE\346\016Z\\\320kMw\314\305}\013u\230f\371\302>\265\0343\234\314w\311\004\255\034\032B\231\r\262\305\370\267\334\245K\t\365\243\244\375=\244\214\241\030\277\240\020\037\206\003\327Z\\\250\f\263N1f\3549\003\227\306q\0223Z\334:\317\217e\240\364\266\bBM\206\3139b\344Ov\214\301\335\321\271\020_\002\365O\237\267&\300t"
+	.string	"\226\374|\252\301E4ty\"\206U\250j\373\224j\351^]-\035q\234\\\3519L]\303U\nP\333\201\262\363\343\313\244\211\216\253\253Diyi"
+	.string	"v\372/\2026=\006F\345\205j\273\002\222\335\b\023\264t\25041fu{?,\301\025E\303\230)`\354\360\334/\250x\353\372\206vu\241tl\033\314Ip\274\362\252vb:\266H\236\003\3309!\273h\271\b\013(R\205u\305I\224>\265\\\204\366E\334'\304\220q0\370a.\006\377Zp5\326\017\342<dr\177"
+	.string	"P+\271\251\271\214\314\271\374W\032\004a\333\327|\311\177y\216\241\306b{\311\305\263\373,\276\375\322\355\324\254_\324$\214.A\027\rgh\245\241\264\335\037\223\334\r\263\354\013\346\331\003S@\255\314\2353N"
+	.string	"\312\310\002T\356\f\302\236\200]\356\026\331\330\326\021vJ\n3`R\333\2603O\231\306\343\205\323\207V{0kB\216\225\254{\315\360\026d\211\306]0\374\337\244&s`\311\t\334\370\226\021.\220\322D\024\321\205R\232lSs\366\356\003\200\301$\340)S\200\027\252\0206\360KZ\302\335C\253]n\342g\r\374\270B\363\217$VP\362\226Ly&f\317\327(\274t\376g6\300\314\263\331\003T\217\374\3541\262\324r9'Q8i5\nl\366\r5\037\212\214.\221\016\030\252\325H\016v\365%\220\351\222\035\264,\210/x\022\335z\n\244E\346\247/J\207\r\3100\f\206z\215\001\264?t\251\"F\b6:\233\033V\342\005(hXh.\254\267p0H+\311W\023\362K"
+	.string	"(r\340\236\304f\220\025\264\355\001\253usJp\305\035\340\325{"
+	.string	"\236\373 \260[m\032}\233\250W#\273\252\020\2036G\017\255m\255\336\203\325wq\317\027:a "
+	.string	"\030\363uD3\224Q\016\206~I\217C\022)\242\022A\215'2!FD\337\321l\303XK^\276\311\315"
+	.ascii	"\342\317\320\004o\004\032\254\314\307\002\017)\350\be\316\231"
+	.ascii	"\312\215\246NRM\t\214\021\337V\276\001\213\201\310\332\205\r"
+	.ascii	"\315{`\017-[\316\266 :\234\004`\271\375\016\234LY\217\361a}\240"
+	.ascii	"\244u\257\253;b\\ \363(\317\313\366,\267\363s\226Bq\370\377\035"
+	.ascii	"\367\262\302\006\357\030\346\323\2735\217\006\263|\245\022\221"
+	.ascii	"\202h\340\303\237I\030=\216\356\"|(\246\335\261\374_\n\r\275"
+	.ascii	"8\326DB.@u$\n\317\001\312\006\031\335\202.\006\230\274\331?\034"
+	.ascii	"\360.\034\201\367\030\271\332\337\342\355\005\023\227\330\341"
+	.ascii	"q@\313\251\226\3652\317\277?!\t\353\303\373\306\206\240\310\207"
+	.ascii	"\001\027v\346\302!\256\376\001\354\037\252\240\360\307\240\341"
+	.ascii	"(!\207I@\002\376C\273!\314\364\006\035p\207m\255\253\352\343"
+	.ascii	"\311}iC\243\024{\003\324x\256\257\370\025_g'\341\223;\034\365"
+	.ascii	")\205\037E\246\275\354\347\363\277\372K\215km\002\245ZL\321\223"
+	.ascii	"pe-\204\005\220\354\356xV\221\342\035\311\261\377\362\217\025"
+	.ascii	"\370!\004\377\251\235x\337\035\263LI\330\226\273\210g\310\334"
+	.ascii	"\256\270\"\202\"0\251\3723m\362/\203\214\261\026\032\270\020"
+	.ascii	"\001\325\247\204\326_\032\327\261M|\210C\032\273\357\327?\253"
+	.ascii	"\256O\226\307\254hgB\261' \357JSD\2778\013\203\207|f\300\303"
+	.ascii	"\032SbF6\r\026\\Dj%f\264\372\225\222P\346w\201\013n\232\330j"
+	.ascii	"G\273\022KG\356\026\322\353\224O\020\322\027\027\376\022CU$\317"
+	.ascii	"-b\365m\352\335\343l\330U\324+\t\331Q\\`xo\301\020\344\343\030"
+	.ascii	"\256e\202\370\366\234\372CO\210\026"
+	.text
+	.section	.gnu.lto__update_checksum.104.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\344\001\235\020"
+	.string	"\246\336lF\360\316(\035"
+	.string	"\226h\300X#\235\013e_'\232;\243\211p\007k>m\315\222Y\245.\276\224\215\326\252\335\270M\357\024\336\364\235\f\311\247F\303\342p\327\340*\327H(\325\246\215\264\265v\025\f\374O\310\336R\246\024V"
+	.string	"W"
+	.string	"X"
+	.string	"?\260]~^`\273\364\312f\361/fn\230"
+	.string	"Q\201\366b\316\331\355\005?|\374\356\250\253\313\270\272\362\025\200-^\036\312e\344Z1\f\001\274V\364\350\341\3019\355\n\363X\0325\264|O;\204\035\260\366\362Z\256\334\2039\247\365\345\261\334\333m\233l\217l\035\005\007\020\372\367g|\366\203\376\335\334g\367\026\3252\252cToTkT\237"
+	.ascii	"\002\0162,_\021\316\031\013aL\035\211\223A\303\266Qm\f\230*5"
+	.ascii	"\026:h`0X\265\035\214V\377R\3369_N,"
+	.string	"\270\332\357p\017\253\317T\027\315\t\363A\304\234_\003'\370\\\372\013/\2548\347\234qe\266;\276\255h9\031\210\302\265\201\245\241%H\334]\t\222\372\304\225\340\b\230\313n(\305_.t\277\273\217\341za\241t\225\304k!\251\217\214\257\332.\277\233\f\f\001sI\321pk%Z\336\256\314\376P\324#\246\207\307\013c\213n\363\0138\315\003\021>HJ\221\364AR\212&\221\tK:!\205D\2278LJ$t\247\221\3164B\242\320\225P&\035\207\001\237JDP\335\311\351\204\3524\276\371\2051hfF'eYre\216\335\344\254l(c\271\205\235\366\257\334\344\314V\264\216\n\332maF\325\250P\321\036?|j\3436\264\334\016Xs\005* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.105.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`C6-\310"
+	.string	"\2521\205DO\020\030hi\215\001\240e\222l\267\301=\364Q\361H*U_\206a\017Z\352\234\347~\260\177@\247\b\271\312j[\253\322V6\232\234~\035\256\203\020yL\034\327\"\363\27145\363\364\340\025\343)\367P\277^/\205\367Q\033\200\230\2242\245\224\002\004\004\004\004H\004B\347\017\204\316\036\b\235;"
+	.string	":\033"
+	.string	"\350\\"
+	.string	"\2413\001\200\316\034"
+	.string	"\235\007"
+	.string	"t\336"
+	.string	"\350\254\201\3209\003\241\363\020\2413\006@g!@g\001"
+	.string	"\235/"
+	.string	":\007"
+	.string	"\350l\001\320\271\202\240s\220\2403\005@\347\t\200\316\022"
+	.string	"\235\207@\347\b\200\316\020\3748?"
+	.string	"tv\200\235\201\37487\020tf \350\374\343\307\331\307\217s\217 g\036A\316;\202\234\027\brV \350\254#\350\234#\310\031G\220\363\215\240\263\215\240s\215\037g\032@\347\031A\347\004\202\3162\202\316KAg%vN\002:#\301"
+	.string	":\037\3758\277\b:\273\b:\267\370q6\022:\027\3758\263\020:#"
+	.string	"\302y\005\2203\021\220\363P\320YE\3209\005\2203\n \347\003\204\316'\200\234\r"
+	.string	"r6\361\301\271\004\320\231\004;\217\370q\026\001t\026\002:\207"
+	.string	":\007\2613\b\240\263\020\350\f\004t\376"
+	.ascii	"t\376a\347 \320\031\bt\366a\347\236\2403O\320\271\r:\263A\347"
+	.ascii	"\265\237\315\017tv\037\347\356\252\2169cr"
+	.string	"d\240\321\237\013{\253\252\177o\034\273f\331k\335m\335m\272\335\272\321\272\315t?\233\207\271\271\323\264\033%\r\345_;\343c\353\034Z\207~\343\240[q}\263\336\237\243\312\341\213\351AO\263\335\246X\005\364\242\212\373\362\213\240\247Y6\215\203\333mH\372\225z\333\230\267\027\265\243\247Y\020\256\246\327\270\275\226\002\221\321++\315\214\236fW\253\036!\246\2049\230f\326gn\243\251@\324\024\366\032\201\236\246\321\2454\300\026j;\214\373L\231.s\333\314\n\353\233\025\366>\t\312\261\023\366\345\367\276VF=\315rXO\013\265d\274//)\245oh1\346 \267\320a\374O\250\312\344\327\373\276\301f\231[`\0166\3132\273\334`\034\344\376j\247\333O\246~\237\274\035\345\007\245\313{\337\260\030\3152\213\236f\211zD\333\354\332Bm\2633l\270\\4\361d\324\223\001\205C\222\371\275o\330\322{\201"
+	.string	"\341\302h\211\211z\rkNb\213\315g\330\f\227q\031&c2<\306b|\003\207\371\350\301c\307\002\n\350\310\201\343\206\215\0324f$ cI\211\315\222\220b\3008z\341\242\005\2431*b\201\300\n\242!\025)P\034p\302"
+	.ascii	"\023%H\214\020!\024\"\b\204\020\350\303"
+	.string	"O\020\350\323\303\323\262\353{\221\333\330|\206\347\307\216=4eZ\315f\200\256\216Y\316e\307*\3472dT\316d\242p\035\2338\217\261\230\224\363\r$\270\216L\234\303\366\250\370\250v\217*\325yT\247\276\343\257\027\370\273\343\n\374\331q\035wR\317q\347\3478\244}\343\016\317m\324\331y\215\025\306\210\035\234\206]\317\250{\243\343\t\360\374\330\202\222\021u\343Kp\255\004\327l\266\365\346I\320F\202v\f\267\206\341\246\203\037\2450\005Y\366\242\341X\345\220\346.\324\272E7\2515\243Yy\236\252\270\240\340:\312\260\346\260\223\267\246\301\316\334\210\206'h]\344h\315\302\254\0210C\343+\210\314\364\320z\302\314j\224\006\346*Pp\035\235<=\205\323Q\034\360\325'\306\210\211q\003\232m\202\331\364\022\314\245\223X\341\306 \313F\210Xi<\371IA\361c\007\031\247\277Xiq\241,\036B\001\035\244"
+	.ascii	",\016B\331B*J\007\242\362\305*\351\037\326\037\022\\G'+\321\n"
+	.ascii	"8VR<\270\202\353\311V\003W\030\311\267\030F\274\261\262C\177"
+	.ascii	"\261\332r\0378V2\254D_\254\264\274\207\347\007X\007\025A\251"
+	.ascii	"H\265\030\270\2548i\036\340\025V\267X\315\002]A\255D\357\373"
+	.ascii	"6\231\366\251\253'_Yh\365\323\2659\263\205\313\224\346\262\312"
+	.ascii	"r\212\022\301u\234j\331(\264\t\360\352\030t\236\037\357\373\262"
+	.ascii	"K]=i\246\240\231[\226\231M`\226Q&=R\314D<\242^\323=\327\342\234"
+	.ascii	"\336\310+\276\315\264O\245\352\370h!\341\350ti\237\226\350W<"
+	.ascii	"\322\320\243x\242O\241\342\207x8\205\245x\025\177$\207\270\347"
+	.ascii	"{E\247\223)\353\024\253\372/\252\227\342\235\f\313\363\2007\340"
+	.ascii	"Q\374\211)T\362\304\037\360\315\203\3431\365\016w\305\252\216"
+	.ascii	"cw\342{\007\272g\225/Qo\363[k\342\r\370\023dP_J\274\211_\355"
+	.ascii	"\220Tb\237\327\021\245>\242t\305*\034\312h\211\3573\315R\227"
+	.ascii	"lM^u\350\323\022\341s\272\371\250\352\306\350~:EK\342\233O\316"
+	.ascii	"pI\031\247X\325\"*G\342\227\260\b){\304\237\320\2003\023\247"
+	.ascii	"\304\252\267\324\210o\272\2473\356\370F\026a\364\270!pvG\207"
+	.ascii	"\016q\361V\254\032R\272\211\370N.\321\244BO\336f(\214\346\340"
+	.ascii	"S\244\3430DbS\254*b\023\372\376\262Dk\206\b\261&\350C\244\t\372"
+	.ascii	"$\313\263 a\214\35633=*\020R7\024\224\034\2104\250\007\001B\370"
+	.ascii	"W\276Z\370?s\230\370\331\260\335\230\025\253\032\0074\302o7@"
+	.ascii	"\2355\007\350;k\312\315\f[PyY\261\252\f\320\267\f\3132\2652&"
+	.ascii	"_\017}\364\334\212\373\360A\314"
+	.string	"\265\364\317\177\b\373\371$K2i\326\317w\261\003ct\227\231\351%}\220\246bt?\375\213\375e\031\253\013\376\323\331H\325y\372\3407\222\332\344\3256\370]k\2134T4\340_\341\357a\013\374\237\347\030\235\223\333\271\3621\303~\023S\304j6M\340\367\033]\373\320\351\023\276\301\272\233<\307\372\256}\376\204gGf\035a\3600C#(nC\021K\205\262\006\237\357(K2kK2L\276\275v3\270<iO\027\333.E\255b\027X\033\325\351\343K~\361|\227\335s\221\2523\355a\333[\337v\337\310\254\243W=\313p+Ho=\007\3167i\233\200s\223)R)\316\340-\305\377\306\022\\|\\\330b\333\363YI:3\354\311\3259\271\035f\247\301\275\212E+\305\256\256\237\301\205\332\314\342\361\362+V\270\330H\325\0016\263i\333\347y\0364(1G,N\245\350LJ2`4\245\375^"
+	.ascii	"\227\251\224\315\342[2hmq\254(P\330i\363\271>sq\3510\024\235"
+	.ascii	"#\242^\374I\021\214\320\312\257\2125\024\303\024\233\305f\333"
+	.ascii	"\354\223I\325\341\342\030wRt\")\231\213`N\305@\321\215f\331\247"
+	.ascii	"\274\t\020n-\315\262\003\020@\360\335\205\313\237\364\231\346"
+	.ascii	"'\001\\\372\374\370:\257\033\254'\200\306\371\345\031}\252D\026"
+	.ascii	"\205\256\337\025m\376a\364)w\177\027<\035\342\376\273\330\241"
+	.ascii	"\330\221=\332t\361#\273\223\r\275\244\277\354F\031U3Snj\b;\321"
+	.ascii	"/\246\035\356;<w\342\372\270\375Z8\252.|\334<<\236\337\027\363"
+	.ascii	"\255\242\307]\307\237\330\273\274/\346\373\336q\343\265\222\016"
+	.ascii	"\367\016|\327\323)\332f\273\253\274{[\272\274U\336#:f\276{\264"
+	.ascii	"hR\312\373\032;\311w.\365\036\255\257\024\2472\367\234\236\033"
+	.ascii	"N\020$\310+\365\320fE[\320r\313\275`\201G\265p\037i\233-\021"
+	.ascii	"\345\353\270~s\204[\013_ \304[JH\333l\177\203\265\257\351\323"
+	.ascii	"\222tf5y\2259"
+	.string	"\354\350\337\305\334_\255V\341\370\2570\363\351\345\341\335\331\261\215\261a\213r\253\333\232[+\013\013\350\334Q~\234\033\n;7\223\021\316\035\205\204\n:\367S\267in\247vk\356c\223\261\237\315\375\366\263\271\310\316Dvv\201\316/"
+	.string	"\235\231D8\273"
+	.string	"tn\001\350\314\202\b\347\025\200\316*\b\235\227\b\235\225"
+	.string	"\235\223\b\235S\020:\243 \344\214\004\350|B\b\347#?\316&\3748#@\350|"
+	.string	"\241\263\021\241s\tBg\022\204\316#\b\235\213\b\235E\020:\207"
+	.string	"t\006\001\350L$}\004\307y\224\301\273\r\371\f\276\241\222\3075\207\265\r\223K\347\322\241\3236;\344\333\212\231\326\314z\361]\354\302\311\325]\213\266\341K\244]9\221"
+	.string	"\203\357\367\247\204\315\324R\307\240Nn\307E\231\356\367\333\206\027*\213\352\203J\036\331\260\345@\313Z3\034\212\252\321\213\302<\363[\317Z-\255\255\230g\314aK]\315\320\020\231e~|-\276\213[\202\277\302\r\326G:\024\365\230\347\225\305\177\361\247\3701x B\036\0033B\276\004]w\277\327\325\224\007#\246\266\370=\346\205\274\242\312\004@6LA\306\016o\025\273!\f\354)\2002\315\013\276\206C\3211z\320\275\2659\354\301$\032y\204!>\331\260\201H\225T\303\005\337v\230d\322"
+	.ascii	"\200\031\252P~\341\301\235\256d}k\227!\217\350\222h\334\241\344"
+	.ascii	"B|\252\241\334B\244B\212j\t\300w\017L\262\346\323\202W\3000\005"
+	.ascii	"\257\312\025\213+u\357\270Sw:u\253+\rC\036\312w\355\"\032q\344"
+	.ascii	"8\256W\210OKV\210TH\312\225\313\202o>&\031\351\273\337\031\224"
+	.ascii	"\254\242\025k\225\026\341\344\312\t\002\334L\355\377\0247\213"
+	.ascii	"uJS\351`Y\365\343C\340\273\206m\005\377b\325;\025\254R\206\310"
+	.ascii	" P&\253\fS\253\026\221J\205r\315\252`zfZ\005\333\2133\372t\205"
+	.ascii	"\n\356!m\t\263i\332P\263}G\375\024\263\nh,x\253u\032\361\n\006"
+	.ascii	"\"\0240\267\270\216\302\362Y\211\202|\263\275O\221\324(\005\037"
+	.ascii	"\344M@{ec\306n\310\331R\360\375\034s\343\344v\264V\252\242\263"
+	.ascii	"\311\024\005=4'\330\232\262F!\241&\220\200\312\223\315\260\036"
+	.ascii	"\207k\323j\224\200\207\241\225\256\247N\377\206|\322\b\274\344"
+	.ascii	"`y\351\260\310\217\330\246\242/\202\357'K\276&\004Y:m\310\303"
+	.ascii	"\226\347\033\032E\367\210mC\321\257\003\001\236\364\371\300\262"
+	.ascii	"\323\334\313\343\r1\272#\266\r\275\335\003\337i\315\306\260\304"
+	.ascii	"\343\341\253\263R\361]\215\365M\270\214\321\361\265\003\337X"
+	.ascii	"`\236\3160\251\216\330\346B\371t\016|R\n \237\004\310\013\247"
+	.ascii	"\356\204I\363\216o\234\263\203_\003q\344\030\370\006\236\252"
+	.ascii	"\177<\003\317S\303\277):q(\343\210mp?\276\337\226;4}@\337l\274"
+	.ascii	"\217\027>\375U\221\324\036:\fi\303\343{\374\263\201r#\202\357"
+	.ascii	"h\022\307\264-\305\343\211\026x\034\277\343W;\250\344Q\201\005"
+	.ascii	"t\274\002\177\002-\307\353x\024S\347\263\025\235\035'\272Flk"
+	.ascii	"7\32159\276\343\320=?pVk^\235\336\267\211\305\215\033\210cmK"
+	.ascii	"\341x\242\2477\262\215\277\361,\024*\257\306\333x\023P\262O+"
+	.ascii	":yD\321\210m8\242g5\276{X\3165i\030\037\315\2203ve_6\304HY\206"
+	.ascii	"\330\366d4\276cX\316\231\361c/v\346\303\206-\300\210mE\317\031"
+	.ascii	"\357#F\355\222t~Q\265$\277P|\027\336\213\351\273o\274g\336=\273"
+	.ascii	"f\027'\351<@\254\305\372\307\361\215'L\304\350?\270'R\255\004"
+	.ascii	"R7\022\371-\226\300\327\360\013x0-\343\023x\326\016J\314\321"
+	.ascii	"\354\275\024\235.\272\020\333\214\242\277\224\021G\272\224\345"
+	.ascii	"\267h\311\202\366X\224^Kq\232O\245\345w"
+	.string	"\375\225\267\242\3663\024\235-\242U\210mE\321\247\242\004'}&\375\024\344'\031`\002\351\237JT\363[\303V\223\201\330\326h\257\205\364\255\206\245D\224 \365\350;\312\332c\r\213\330|\024b\233\n%\224\243o\253%\\\223L\273\361\223\266\233\365\205I\363H|\227\227f\247\341\237\020\333\024\2736XB\231|/\334\336\252\312N\252\216\213\177\361?\3454\253\026\357\342M\330A\277I\321\271#:E\244\263\241\224j\361]g\371&5\202\373(d\321\033\375\313y\363OLJ\357D\244k\361\307\242o\346\362\255\371d\361\314D\2717\376\213\300\263\370'CR\233\210r\234\312\204\244$\316\371\224HW\024\375C\340\273\313\262\r\207\266\277\306\362t\033\261\302\372\276\\>\332Lw\236\230WY\002o4}\206h\027\"\0241\001\004\"'\024\021\302@\003B\224\030\371@\202\221\021N@\002d\211\t*\020\031\241\b"
+	.string	"JXbd\205\nr\004Qb\204D\021\027\214\b)B\002\021%J\212\034\t&)2\302\b*\200\340\001\013K|\226\210\340E\216\030Y\342\001\nG\212,\3611\322\034\202\222\022\024HXBbd\351\004#D\216,\205\220D\311\222\222\bF\202B\221$KK\220 I\262\024\fk\352\365\375+\254\004MYY\004\356\245\347ooL\231\3323\371)&\357\177d\376\261\016\253\310If5\343\370\361\261\232UW\225\b\210\017D\n\261\243\320)5\020\270\017\302X+\203\373\017CZ\0255b\260\254<\360XQ\332\374\034x\341\231b\200\341\205+\253*&"
+	.ascii	"T\333\205\226\312\235\352i\342\302s\320lk>\233\352\372h\216\033"
+	.ascii	"\220\357j\231\270S$\224Q/4\3310\371\032h\341Y\370\267\301\330"
+	.ascii	"B\r\333\247\026\276q\240{6\035\333\343\260\313<\265M.\262\311"
+	.ascii	"\264F\026\276\313`a\240\335\251v\205O\302\204\245\272S=\354\037"
+	.ascii	";u\251\252\334\253\253\266\331\025\236\203&\233\364i7G\315\217"
+	.ascii	"\267\016\312\023\263\301[\357\033\332l.\0247.\226\253\245\367"
+	.ascii	"IH*\253\327*|\347}\347I\241\374\026\3337d\365\223\302I\325A\322"
+	.ascii	"\266\3267\224)\354^\031ZSJK\205"
+	.string	"\315\363c83\260v<}g\314\032z\330Za\353\206$\334\260\333\325l\256\027P\273i\007\373\372J~\251\360<^Zx>\226|tn\216\034%\277$\0069&\036p\336\304)A\013\252\021\203\325\303\315\322&y\2073V\207\205\205\272Y\336\222<\016,<\276\213\235\346v\244\360:\264\311\241\255Jm\246\026\205O\341M\260ac\342\021]s\317\354P\256q\321\222\242[X5\356\232\221\022\205\262\005\332\365\322\"\371\246.\3314\327K\317\373:\335`\366\214Es\301\324\340\206\t\3236\213\344\203rg\013H:\237\n\304\351M\221j9\336\220j7\234~\212=\236\205\031\253k+~\344\033\312\242\201\240\251\245\316@\3312w\f\t\245\353l6\027lHy\203;F\004\245\365G\236\307+\013\016Im$\255\t\337Z\377r\240\222=\215\244E\300\233\360\006\310\201\372B\344\021\360\335C\223\314q\256\214\252\343"
+	.ascii	"t\306\350\214\374\001\276\345A\214i)\352dop\317()\303\\\264\241"
+	.ascii	"(\230\273\226\342\351\315\032\371~2\247\322'\333\345m-GTS\277"
+	.ascii	"hKx <\325j\265_\264$|\tl\230v\262MfW!\341\205req\222\3164B:\266"
+	.ascii	"*8b\330\211Y\300\215?\275:\244Z\r\367\322}E\317\r\2516\303\225"
+	.ascii	"\335\307\237\322\361\206\215\360\354\261,\314\030\235\260Z\245"
+	.ascii	"\276\375\242-"
+	.string	"\362#\320h'\013\346E\317\373\2768\276\024\371\017V\312\230Ig\232&\257\332\250\322\"\274p\254L5\204\027\341[;2\266\013\323\222\313\026-!\360\371d\271r\253\361]\314^i\020\376\303Z\231;e\254\002\206KI,\026\367L\222\031\253t\321\206\224^\356\032\n\032@\370\376b\342I\017\030\343$\f\215\243<*y3\206-\221o\25615\326\312pH\r\313\345\256\241`g \362\375\326.\344\312\370%\235\317\247>\222\003\223\300\007,\025\017\376\003v\212\007sRv+\003\346\034\223O\006V\232R+\277D\032\224\273\t:\370n\"j\252[j\372V\276P\331\324\034T\362\230\305b\305\311\202\302\306"
+	.string	"\367\204\275\202\263\303:a\251\334(M\200\324[\236\327\0300\276\215?e\374\016\f\360\035\260S\006H2~oy!/\251\276\002<\0236\212"
+	.string	"_\200_\241H*\033\026\212\t\007\373\344Bm\260N\356\233%\366\350\316%\261M\004\370~cB9`\337\252]\333:\375\273cG\312\301\233t"
+	.string	"}=\264Y\371\2067\224{.\264F\264\216\373F)\252\347\316!E\363\006\360\235\003\363\255\371\334\340\357\354\334V:C\033Q\367o\255s\2415\224.\334J\347\276QRF\335\271\271\r\276q`\266!\035A\271\203\261Vi\0301\344\3440q\200A\324\303V\203\377120\032\300q\345\3268W\316\n\347\316\251P\272\321\200\255\371\214\322L5?>o\n\204W\250\223AU\351L\327\303R\241\"\021\031i*\205\016\243\027@@(0*Q%Y\356\016\023\300\017\210\342\340`\036&A\322\b\321L\222\244\003\\"
+	.string	"\224W\304,\2452\0067\256A\360\275\245\233\272t\371?\211\026\307\022>\2774\373b\226\257\306\003\234\256pc2Vsh*dg6\366|\240\346\374\262\354?x\2522j\312 \026\232o:V\035\243[/\262\306ZI\216\277\247\242\243;\330\311\034bP\034Vc\300\023x\370=\006h2\252\324\024\322\344\2546\"\302I\233\245\3771\255\230\032!\272\035\210\210\f\023{Qx\3677\024\340f\330\275\232\021F\360L\200\327{=>S\210P\357HX,T\301\367z\267:C8H\222\345\004\006U{L\035\305\004\270\364?\241D\307\245K\261h.\201\363\361\266B\025P\020$\334/\244\314\t\3520\3611(\220\b\260F\260^e\210b"
+	.string	"\007\003\267\"A \242\260\006\325T\007\360\322 |\034\300\237\200 \203\350\233\250\221\347\255\377,@`D\335\311(\tS\002enQ\256\236\320-m\260\037\223\316"
+	.string	"%\375\035\373\201\250\237\032(\201D1\247,\036\312\3006\355\306@4DY'|+\315'\023\007\252&\262w\266\315X\034\017\215\227m&\342c7+\254Y\366&\226\214}\022\n\032\031\212\025S\235\022\241w\264lP\016\212(3`\n\036\272v"
+	.string	"\301\363\377\250Z\201\\w\271\360\202[:\347\255\bN\005\226\355\350yWI\343\276\026\331V\312\261\317\266,G6\240\025\271\267\226\363Dh\036\223\227f7\335\273\277\204C\267\017\367\2158\300\234\203\315\373\021dr\376&\332\310\257s\235\031\256\234\312\302\017\360\2666D\225\326(e\314\024\206\226\024\264\272\364\374\336\020\221\341\336\031\"_\3031\3704c\002\261\371s\277\331 \360i'\321\255?\026\353\331qm\211\251\340]\322\203\275\262\204\272\021\026\225\024q\221C+0:\003GD\225\376\027\b,\006\226&\243\022+(\r\300\177\251\340\255\223\023\261\374\231(\253e\302\214h\242\235\351\310YD\355\331\033\023b\242\355DC\304\244H8\022\247\244DR\327m\034\320z\363\004\240J\037\nD\320\216\367\322\"@\235]\305~(\204\354-\301\234\201\320\340\003\233\205"
+	.string	"!2\257>c\222\353\020M\237\202z\267\207?3\016\202V\360Fi\223\306\203\327\307\305\\H\007\206\3155\314\306\357\253\312\212\255\031\242\352U\216\341\2503\273\360kh\256\242c|\357\366\366*\002\036\240$\361\220\354\330\373Dq\207\375H\373\234\257\324\330\tT\361E&\366\346\315z\336\242\273q\323\321'\033"
+	.string	"\301"
+	.string	"w\213\344\007\3019\326V`\034e\034 \215z\202\311\033\272\250\032\344u\373\002v\262\272\n\224\355\256'r}\221\"\253\230\343X\355\326\203\217\350\346Y\372v\352\242>6u~V\251\242\213z{\245\213\302z^"
+	.string	"!\211Q\270:t\t/\316\032"
+	.ascii	"\257\035\343\313\252\365\310qv\264\223\363\240\270\3249-\302"
+	.ascii	"T\032\207\231\f\240@\370]\267l\262\020\212\016\226H \336\323"
+	.ascii	"\332\321\026\240\332\323\021\177L[\324:\246\036\006y\227BYo\003"
+	.ascii	"T\005\030\330\363\354\362\017\317\025\327\264\201\361\364\021"
+	.ascii	"h\352d\351\346\344\0046zPh\260\250\220\251\350\231\255\025\276"
+	.ascii	"!\363S\346\t\342\375\016\"\030\251\001\220\2470\202?P\213\267"
+	.ascii	"\266\246~\262\200\273bB\2621\215HDj\252R\337&x\2503\\\210\035"
+	.ascii	"\242X\252<.\005\034I\340\024\217,\324v\270\tW\216\034"
+	.string	"\203\244D?\325\300&\320\013\373\004\024`\262 _\341R\335A\f\252\255\374n\304~\364\361\244]yl\"*,\260T[F\245\366\232t\224\257\215\300\276\343\310#m\322\247\341\013g\006\032\220\226\336:\023\306\3162\364\005%T4\235\327\220t\270\2649\265\351\272\217\353Y\020\322W\336{)!G\016}\304\246q\342\370\007\035\034\300r\035#!S\214\3036\003\226\314\021)\320\343mC9\226,\bZ\247\033\025$\340\004?{\024h\277,\nnv\264M3\270\003\177\363\022\260\006f\006\241X\244\246\270!\226>\2005/$Y)\360\261i\317k\264\\\330\004ct\2438\317\255\304\300\351\023\026/L\313\346\206\203\tU>\353\2303J\225R\333\177y~\354\0023\3638\220\200\345:`\021\262o\330\331\235\026\033\223\342\355\347\206\262/Q\blc\235\002\334\257\207Kg\357\301\346\262\337\337`~\227\235\271\024\031"
+	.string	".\330\2450\001p\326\302I\206\245f\326\260\234\032\";S\227\225X*]aL\336\277\214\271"
+	.string	"\354\02572\236\366;_\255\333\305\232{\364\211J1\341 \356\2002\342ZA\277I\3555\177j\230\340\301\024\234\254\270\261\241\3057k2@\2726\007\301\022,\352G\262\270\352(\212\022\312\001+\226,\231z&\265D\245\227\324\377\3300\227\346\020~$"
+	.ascii	"\255\240v\235\263OG\026:\373\232Q\273C\265Q\264\325\200\375\214"
+	.ascii	"\326\204\026\232&uP\263\372*\bL\354\215\373\037Z#\246\216K\364"
+	.ascii	"\226\200\236\205\237\035g\341\242\203\355$\372\304\022\343\245"
+	.ascii	"\200\310\001\241B\231\222\357\312\226K\256\223Uv\r\n\335\315"
+	.ascii	"\323\364fu\\\300\331\251>T\205a\250_\301/\334\035\340@m/rzG\267"
+	.ascii	"/\231\007\21305\201\213^\324\217\227M\205\277q\347n\005\\a\200"
+	.ascii	"\265\260Z\3500\301dtG@\226(\206>\2359\017\356\327\367\002JN|"
+	.ascii	"\313E\366R\306\345\234\\{\274`Q\350\204\205/)\235\220\021zM\215"
+	.ascii	"(\031\253\333\225\240\333UX\351\273\r\314U@xVJ!3 Y\322W\303L"
+	.ascii	"rOd\177U\250C\315\t9>\tj\345\267\270\240\260\204<'1\026\001\363"
+	.ascii	"c\320\363O'\304\263\375\022@A\231\301\203\350/\233n\230\343\373"
+	.ascii	"V\366|\233\227_\311m\245b\355\3735/@@\250\244\340\221\244\306"
+	.ascii	"6\310(\220\224"
+	.ascii	"PH\004\342)\020\037\364\314\265\344Y\020\0372)\035q\027V\344"
+	.ascii	"\361\036\222,G\021\372 \320g\222\350\356\251\344\307\3652\275"
+	.ascii	"\302f\253o\314\232\220#\267\337\244\216v\331\341\203\341\265"
+	.ascii	"-$\227\313i\t \020|OPn\235\314F\304Fh\2612\025)\253.:\341\004"
+	.ascii	"\335\277\026\265\343\rI\026\267\245hn\020\237Yp\324\007x:\363"
+	.ascii	"\024\324%\235\240\362\277\023?\251K\364\016/<\363\240\206\177"
+	.ascii	"\207\n\335\225\005\261\256\016\254\213\325\267\255\306\374\220"
+	.ascii	"\257\276Y\201\362\332\022\036\002\362\001[\367\230.8jQ\356\377"
+	.ascii	"\\G\342\304\231\266\304\203\007\325^\207\233\003\262\253\323"
+	.ascii	"G\234\2334\274\327\266\211\357t\201#\323} \251\223\352\277\007"
+	.ascii	"\370\263\344q\204\363\200\031#:\215I\334[,E\377\221I\200\207"
+	.ascii	"\025pL\321u\377\214\345.\212!\017\211]\273\341X\350\0063W\356"
+	.ascii	"\346\275t\206\203\003\352\211\306\345\254\355\325p\346\bO\241"
+	.ascii	"\262\rN\341\330\370\016\262\263\324\330\305\320\rw\021z\327\257"
+	.ascii	"C\224\326{(\2768\363zt\362\314\327\363\177\272\030g?\200UO1\025"
+	.ascii	"\243\216\350\177\342\316\310W_\232zGe\374\n/\230\217r\221\r\026"
+	.ascii	"\",_t*\315\235\244Y\326\202\270\200X\331\370.\225\334\353\035"
+	.ascii	"\256\254\365\311\031`\004\220+JCtV(\255D\201\277\236\203\212"
+	.ascii	"\313\r\303\273\246\365\304\023i\304\317\265Ha\343m\212\273\310"
+	.ascii	"\030\245M\211\253\t\371\230\020y\274>\277\274\ru9w7\371\024\222"
+	.ascii	"FE\372\004~D\321\005"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.106.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`F\020=D"
+	.string	"\272l@\030B@\236R\007\307\273~\344`B\316\223\003\346\271\344-\001_\307\261\366\212b\315[\326\033SM\025\261U\210.\020\370a\363\n&B\030\364\003\020\210"
+	.string	"`\366`\360\310\273FG\371V\300\216\275\345\336R\246\024s\001O\001\200\001\331>\361\237;\206\355\351\376\343>\273\277\277\227\247\363\257s\343\\\017\034OuM\246\257\3609\215\343\030\207\377\234\033\337\365\347\362]p|U\013\312\213\032\207E\b\363W\005\277\013\365\311\375n\373F\373\335w\357\341/\347Fw\217[BqQ\343\"\373\214\311\227\351\201w}J\347\237n\271\216\343'\336^\034S\021x"
+	.ascii	"\370]\005\rz\370R\371\203+O\002B\275//\207qL\255\322g\216\374"
+	.ascii	"\226\372\256\314\313wjbZRJR\"\035%\221FEDCB\307  c\361\007~\267"
+	.ascii	"\333\352\274\364\177\3606\307\264\336\205q\275S\\nb\003\303\324"
+	.ascii	"&\213Pi> \030\\k`P\214\341\267\201M\363\222T\017S\351M\232\223"
+	.ascii	"Z\375\343\220\354\001\301\242m\004>_p\276\216-+\243\210\271="
+	.ascii	"\322K\241\356\r\204\031\234b\315\304\334\376(y\fcN\311H#\265"
+	.ascii	"\\$\345\211\244\244\345!\241c\030S\356\243\332\300\312\3621\312"
+	.ascii	"L\354\371A\200`\317\026*\216\343o\003c\222\201\322\310\030\321"
+	.ascii	"\212eu~\336\263\262:\030D\324\260j\275\0133\362/ \230\363+o#"
+	.ascii	"\357\266\006\236k\216\034\303\230m\322\315\023\301\227\373,$"
+	.ascii	"\354Gns\334k*khdcK\336\fL\t\020\257\275\257(\301+\206"
+	.string	"1\213\371\245\020\307\261\347f\230\330\373\323\273\347,wO\340~\034\013\327_n\177:_g\331\342\305\213\375.\217(\036\267\302\256\234\205\241\210y\272Y~kSi\227\231\267\247\032\350\225\371\370\343\375\313}\2077\352\341 WFT\262q\371k5\024\314;\005\256\214\350\377\177]\003#\324r\374\255\360\224\275\251\333\033\1778\257\0360\177\376n\266\332\336\324\315\317\237\215;\226\306_M\253\207\210\031\3773:\261\214?_\376&1!\266\212\030\3771\377?\336\347\336\324-n\222\347\257\347w\3408\346\372\247\177\323~7\212B\f\207p\315\340\207q\367;\377O\277\223\233q\2016\036\313\211\356o\367w[\376k\016\003+\177\363]\177,\035\"O\360\t\347\354\312Yw*3k\250\373?\241\232\260\250k(\356\305\354Vpv\021O\367\036\342\247\377T\037\367>\345\331\t\374d\037\340\331\245\340\354\002\340\354\001\340\354"
+	.ascii	"\340\354Q?\331\241v\366'8\273\023\234\275iggz\263/\275\331\225"
+	.ascii	"t\366\2447\273rgG\332\331\217v\366\344\316\216|\263\033\275\331"
+	.ascii	"\213\336\354Do\366"
+	.string	"\241\235]hg?\356\354A;;\320\233\335\270\263\027w\366\237\235\035\336\331\337\235}\357\354\356\316\336\356\354zg\377\022\020\346\252o\346\b\317h+5.\022u\315\253\221\206\372\222VjS]\322\003\322\234J\232K\366\322\274*\351\342\231Z\266\310}C\216\333zBs\317\220\34140\241\305q\354\340]\317oy\312\301\177\355]\367\360\341\303~\227A \231R'i\241:5<_\211D:\373V[\251\337\254\352\347\246\324\177D\312&\352D\322r\244\223\032\t\313QR\267!u\262\nR\357\220\372a\235m\364\374qe\304\241\367\267\366\224\025R3B\032\352Y\355\337\252\201\376V[\212U\b\023|X\236dG\r\315g<\244|\207@I\376\006\203\332\370\255\266\221v\231|jU6F\032J\221&\322FfE\332\351\247\366\220&\322\017\244\017sH\027}\245\355\021*;\352 -\304\344\0304\006\244\203\224"
+	.ascii	"\351\035\322<\354_\2224\353\232-@F\355\371HFbE\302\204\211m\324"
+	.ascii	"Bgiz_\211E\261\037\r\353\"\330\017L\344\325\360\220W\357\220"
+	.ascii	"\206\361\313M44\377v"
+	.string	"t\230\030\203\2408!\235\303\222m *\\\335\352\355\345\352d\240\263\325]\337\274j\335\352\007\362d\346l\216\265\336!\235\213:\323$f\373\020\213}Td\277\346\225\017\213\034\321\304(\031\225>\274*\021E\304\222\2311,3\323\274>\031\302\037\r-\363\205\305\272g\266y\2055\324\267v\236\025Q\303\241\346`\227\327\001\365\330\252t\366\376\355\254|\177[C\375\357\244\210\342\251Z\357\002X\357\342\205\215\032W4\366\325\215+\027\255\267\240\262A\003FU\026V\325\f\254+\031U-j\330\250\242Bz\026\215\0275\252nde\325\2502R\273^C\361\377\323\203\370\245\327\224\321\336\005!\232/=\375\202?5\245\217D\362\304\330\301.\315\364\214Hu\"P \273/\331\226V\3627\t\350\257s\370\307\324\\\231\r\327X\223\2046\303\001\032\204\264O\324\351\322\355y1i\250\277\340K\025Ji\020\322=X\247"
+	.string	"}\r\240\005\340\311\203ZW\226Y\262\354w\003h\035RC\254s\t\200\035\301\274\367Q\032"
+	.ascii	"\035-80J\323\220\026b\343&|\214\355Y\3162.\006rN\034\307\277"
+	.ascii	"\346/c\277+5\247\260+\277\311pd,\267,\243\321\375.\224\006!-"
+	.ascii	"\214:\225\236\364\233\271y\322/\367R\204}}\236pI\032\352\013"
+	.ascii	"\370 \211\320\372\356\b)D;\243\274\265J+}&\373\3058\232\263F"
+	.ascii	"\343\321\271\373\350\313ib\300\371LF\263|[\302-\345\226r\373"
+	.ascii	"]+M pL6\233\315\276\326\016\241E\350\257\373\003G\254U+\335\223"
+	.ascii	"\251\255{qN\220\256|#\244v\016\013\343d9r\322d\264\230\320\306"
+	.ascii	"\274\326n\322NZ#z\205\254\247\005{\306\313y\026.`\300\260\337"
+	.ascii	"m\322/\263o\372\204\213\313h\017\306\232d\322of\307\244WH\345"
+	.ascii	"`\345\344\2725k\363\n\370oW'\tRC={1\326\255\005\201b\250qH\307"
+	.ascii	"\034\242\021\021\021)H\222\2445\361\005\204\030\306\334\325\003"
+	.ascii	"\021\3408\306\034\2329M\n\351\320\003a\311S\030~\314t\254~:\331"
+	.ascii	"\211\217\311\313\0349\332\371\027_h\004Xca\371\347:\177\n4\333"
+	.ascii	"\351\256\213\272\370\315\003.\340\003\260e\244\261\303\222\337"
+	.ascii	"\247\t>\332\336\224\361\f\343\240F\336\325\313uo\016\226\327"
+	.ascii	"\037\200\344\311g\n\bq\254\204\350\261%&K\305\277*\0031e\265"
+	.ascii	"?\354\232\364$'T\336\t?tMR\221Qm\b\372\37630\035\377\265;\244"
+	.ascii	"\\E\272\230\374M\024\250\365\313\323v\212\264\005\337/\007\347"
+	.ascii	"\251\272\374\346\234\204X\220\003\n\302\017t\006\233\373=1\376"
+	.ascii	"\260\376\371+4\r\224\356\262\0011\na(Q\304\227\313\312\323\270"
+	.ascii	")~k*\021\023\270~\354-oU}\022\346B\330E\241\251w6\200\251x \321"
+	.ascii	"\342\257\004Pq\306\325\323 &TG\235\341\245\243\275\232\313^_"
+	.ascii	"l\377\322)\344O\321^\355\272\013\304\217S\fK\340GL\321vSX\030"
+	.ascii	"\264\346\337\215;>\364V\r\215\332.l\f\250\027\353\241}\243y\350"
+	.ascii	"\376A\354<\"\025\210;f\232\370t\217\342\233B\370\206\226\021"
+	.ascii	"~&\36070\270\244\301}1\177\352\313\310}\271Y\3327\017\267E\024"
+	.ascii	"k\033\306\261\2075!\032\334B\374\325}r\262_,\374[n\336\254\265"
+	.ascii	"=\024\305\223\217\032\256!PO\003\347\256\037\"3e\003Zl4\242\255"
+	.ascii	"K\273\223lsP\251+\026c\370\377-\314\277\2607\035\220@4\fn\264"
+	.ascii	"y\224\303\256C,\024o\240\031\265D\230\213\333"
+	.string	"\250>\fM\004H\224p\203\016\274BIVF\3316'*\022>C\034\023G\373\017\245\0056z\020eV\213\331\320\3154\374Kg\343_\304\251&\352\265M~\252m\250T\333\344\224\335\221\b\337=\t\250\204T\204\001\333\327\307\222?\320\210\342N\315\244Ig\327y\364\013a3:\273\335PO\026\242L\310}\230A\310\333`4\203;\212*\204Z5\206V\020\004\n\027\204\204H\177\306:\362X\223k\300\270|Y\242E\035\340!\275l0?h?\314#8V\244"
+	.ascii	"z\351\356(\r\016\002Qr&u\034\221\013\020^\217\235z\020\313\300"
+	.ascii	"\\\340\032|%^\351\360d\331!\240c6\f\254\200\360\336\334\316\256"
+	.ascii	"\377"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.107.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\315\n"
+	.string	"\246TK@ O\225\016C\377\235\370+\0024$\340%\001\3229nKR\300\033:\222\300YTj|\177\364\t\0166\210U\221\005yc"
+	.string	"\b\021\220"
+	.string	"\256\\Xtv\n\223\311\335\314\210H\022k#\331R\246\0249"
+	.string	"9"
+	.string	"6"
+	.string	"\333\th="
+	.string	"yP\261\273\232^8w\250\311\371\327p\f\357\353\016EW\0302\n!\312>\017\344XY(\361\370\f}\237\314\b\201\335uz\237\204\033\273\355\002\266A\354{\004\023n:\261\033\341\305bE`\0370\330\276\317\341\221\363\r\326\310\2002\355nv\314\346\330\331\261g\2663\355"
+	.string	"\003\270\237\032XwG R\273\021\200?$\307\314\331&:\034\004j\240\003\211O\256p$\257~\324,\310{P\037\177\b Ut\261>\3329\365z\224\251\005j\321\311\227\035=\251%\373p\225d\3034\374\351\317L_\222\024F\234\002\224\r\345"
+	.string	"te\242\301$\3206\213\246\300B\271h\225\214F\233lx\303 \310h\233m\313hY\354\\I\016\241H\271X\035\365\300\214\364\343e\313{V\355R\225bUA\265d\233\301\005\f\017"
+	.string	"3\003\016j\310k"
+	.ascii	"\217\r\234\206e\2036\265\204x\254C\200\256\341=\232(\203\n\241"
+	.ascii	"R\227\305\265<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.108.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`i\001\r\017"
+	.string	"6]gF\360\260(\035x\337\031\353\214\216\373t/\247\337\343\210\316H\b#\347\340\002\274\367\241V\013\350[h~\275\265z2\352\372);\3553\005\340{\f\246\277L\036L\3728\034\\Z\232F\221N\363\002\013\201d\023)S\nR"
+	.string	"K"
+	.string	"W"
+	.string	"\273\257\0326\273a\002\037\340\036\035^d{\344>`{\364\311\236=\204m\001\034\020,\025<v\267S\021?]\323<\371\247\371\007\350B]k\271j\bnb\354\370\270V\232Hk\004x\232\347\006\227*\023"
+	.string	"\203\335u\202\256\016w\274\355\006\266\027\330\307\021(L>\214WX\362\340\243\317\262=^\037\330x}\230qI\345\216\035\242R_\354k\273\273\326\227\375\330\357yz\323t\324\264\226i}:\237\376\347\263\036-\016\036\036S\263\333\332\351\261\262(\203\004\210\355\247}\023\2379=fz\200!4(\312wq\325\250\004jbt\260ZT\207\351\334\330\250\276\330\036\3314\255\220\"\307*u\234\037\331T5\325\027,\027\225Eoa\201\333\335\022\237E\006\025\016\306\264=\252~\304R\271\263\"\025\202\f\215\022\\z>\233!\343\362jc\370\362\240\r\254\024e\377\304\003%\222g\222\022Z\361H)\245\357\003\231|\243\220"
+	.string	"\237\220|\243P\347\211\272\013\"\220JwB\372:\222\020{#\024RW\362<R\007\022\356\265\325\227\035\340\310rnR\252rH\372\021\266\207\022&\224\300vS\007=\272\251M\001\304R\024\214M=27r\264OFM\265QB\n\002\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.110.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\335\n"
+	.string	"\246\326M=0M\225\0160p\356~k\253\346\016)\224;\307s<\306\020\343\002Fm\236j\277P\200\325\315\242't\213"
+	.string	"\314;\033\334a\220\241\262\026%\332\307\204w\341\306)\003*Al\233H\231R<"
+	.string	":"
+	.string	"="
+	.string	"\306v/\204\370\260\273\004\fq<\nxF\343\361\372E\343\321\235]\342_\206\005\300\362\020\201\324\332\335LA\357\236\235\377\3211\257\203yV\030\330]\247\327\361\334z\333\020\333\021\373\007\002\037\373\337\035/\372\257Lk\2463\323\307\002\2340MxH\304\256\2040\305\202\021\304\206\177\277\375\217\374\260\375\031\365\365l\202$X\246\325\356F\036=\300\361\264\037z\207\356\"\b\001&bF\265\035<\310{\252:RU"
+	.string	"7\212\261QW\255(\354\272@\030\2266\273\031Hj\324\2478\0344\031\372\232\232)N\353\322\253\005(4\202\263\312dh\177\230T\f\366\257\335]k\034\202\311v]&\013\324\024\tgQ\220i\225\254Ae\302 \243l\\&\301\260fI\260e\027M\333\262\307\267\277V?\306T\026\300\214j\254\352\223^2\312\327`\316\247\274\367\350\373\324xL\024^\f"
+	.ascii	"3\241\237(\006\256/\212\020Y$\\\036\323\202w\315\356\302\335"
+	.ascii	"\220\242\006\247\256\200ky!L2"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceFlownVerticalSpeed.111.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\261\t\2751"
+	.string	"zW\320\022D`\236N\0077\270\354\261M2fa\203\340\006Fe\347@Rf\374\227\375\303\351\272I\235A\brr\254\260\347\307\364&xe\203\017uJ\216\360$&<\256\t"
+	.ascii	"\025\320]\376\377e\230\b\331\335\366\336)\245\024\016\001\007"
+	.ascii	"\001\037\001\316Bw\016\2723\320\235Y\326ye\235\177\254\263\352"
+	.ascii	"\316)\353\214\272\363\263\316\276:w\004%\"qp\264\0247\367\336"
+	.ascii	"x\352\271ui\227\263~\353\216\353n\353\237\253\236\272\312\334"
+	.ascii	"\314]\205\033\256\3458\030\227\345\334\313\203w\357\226\250\265"
+	.ascii	"\323\267\343\f6{z\360\356\365\222\320n\314"
+	.string	"\301N\273\251p\260\331zJ\333mL\327\027\354\266\f6{vx\367^\005\235\362\323\332\351\260\211\324N\321\026R\335\231\031<h\273\t\343\250\367\346\232b\356msb\246\265Sn\231\347\034q]-\007{d\272\340\356\334{\213_\244\333\376\361\021\006\201\354\372SS\364\275\345\376E\261\313/\255\376\361\021k\241\217\016\372@\207r=\034\2106\341q\321k\242\033J\226h^<\234]Zw\364O\215WX\227\253JO\321\241[/\251\361\022\013~q9\372\213\022\0026\326\377\363\265\205\016\357\275M\245\235\306W\322\375\027u\357e_~\2015\00353\343a\346\013\314,U\367nAq\217i2\032\270\221t\312\0338pP;\375}\273u\212\266\246G\215\215\333\356\275\3523\301\264\n\234C\327\350\253b>t\b\221\242?\301.\f\351\317\356\364\231\334Ij\361\233J\257y\235\244\372\027\237\275+,\351\245\277|"
+	.string	"\021\"\204\332\251\277\325\332\036_\030\372L\021*\267\226\336\"b\004\t\022j\247\355\265\246w\247\263T\356+\215%\213\033\t\2270\221r\233P;\215\261\246\007\245\016\322\237~\357\325\372g2\fU\301\177\022\315Y\2257[\216\207\373\233\276\263t\365!\375\311@\316,5\345\275\354\177+w^\352\222\257\305\334\226\364g27z\237\214\231u.\n\235\235\204\316\304nv+\350\266\346&\241\363\001wfrg\003\356\274\024t\036\272s\201\240\263\222;'\2713\222;\023p\347\001\356,\300\235\217\334\331hu.Z\235\211V\347\241\325Y\b\350\034\004t\016"
+	.string	"t\006"
+	.ascii	"t\006Z\235\177\200\316>\300\r<@\217VL\355e\320\017\267^\213\001"
+	.ascii	"\274\317\007\370o\243\034K\002\001\370y\240o%^\307\365\317w\026"
+	.ascii	"\273\260\005\316Z\232\321\255{\221L\302gn\203\264C\324^\372\374"
+	.ascii	"\220\353\2658\370\302G\351\224x\300g?\370\255\\\342[\316u\274"
+	.ascii	"j\317\316\324N\201/\301\214\351\310\243\003\247k\265iO~\331\357"
+	.ascii	".kO>\240\\\030\256\3403\315\364\372\215\326\267g\375\366Z{\252"
+	.ascii	"\261\021\275\347\032\256=\2233\261.{\256\371\234\372\316\261"
+	.ascii	"\357\366\3540\261\353\034!\3445\235\326\314E{\244=\242\342%\351"
+	.ascii	"\273c\3079\347\264i\375\346\224\323s\r\247=\033r\336\213\354"
+	.ascii	"%s\313\244\337\034\241\232\264]\233\346\240S'\267OZ5\357%\267"
+	.ascii	"\\\273\231\330\263yw\274\026\003\237\311\276\022\337\310\306"
+	.ascii	"\323\306\317\351\017<\r\240\246R\017|\232D\003\247\312\231-\307"
+	.ascii	"\203\262k\315\206\252\3018\327\020\337\310\314\327gJ\3514T\035"
+	.ascii	"Wv\357\205\342F\323u\355\224\n\026,\250\235:=\333\277\f\352\357"
+	.ascii	";\n\206.\223a\rXWF\024\250\225\021\305_\031S\2440r\300Z1ee\345"
+	.ascii	"B\312g\352\2051\305\t#\226q\205\021\310ROW,\250\212U\306\342"
+	.ascii	"\n\343\t\025E)\253\253\342\323\020W\261\230\262*bUUY\025\203"
+	.ascii	"m\310F\357\2231\233\367\244\016\371In\372&\036\232Y\324\302\230"
+	.ascii	"\236I\313Y\346\235\035\221\234J\332\264\"g\022\246\267jb\341"
+	.ascii	"3@\364#F\3440\361\262#\321Y\244MC\340$b\340\033\255\211Em\351"
+	.ascii	"\231\331\311\311\216@e\334y>\344\355,\363\222x\220\243S\031\220"
+	.ascii	"6-A\331\217\245o'M9\276\237\341skq1\021#H\244?\034\202\353\352"
+	.ascii	"\303\"\373O_\325\013\226)\360\377\354\312:J_\340\203\344\346"
+	.ascii	"\356\222^\351Q\270\256>\244\037\360I\177dG\031\205\3007=\322"
+	.ascii	"\216\026\004\276\303\330\205\375\234\315t\252\200\037\360\277"
+	.ascii	"=J\264\2437z\001:\216\036*\307\361\tG\233F\0043J\2434\343\324"
+	.ascii	"\330|\216oY\350\275B(\340\271\371\223\213\336F/\363\210~\350"
+	.ascii	"\213\276\225cI\242g\303\220W\274\306\320\367X\363\215O(\364\313"
+	.ascii	"\274\240\027\372\247S\236\t\200\276\250Q$\007\225c\252FD\202"
+	.ascii	"$I\ni\f\240\002\221)#n\021P\251S\250\212h\232\366\fB\024\210"
+	.ascii	"|c\351\372\265QD4M\352\r\263\363\224\t\322I5\2749o\n\325$\222"
+	.ascii	"\352A\034\226\313t\032j4O.H\315\236\222\3622x\031\b\312~nF\265"
+	.ascii	"\335\362\006\373D1\331\233\243\377\366h\033\246;\213\374\026"
+	.ascii	"\211\312\301&\352\231Q\027\235\273vu0N\265\021\034\031\004J\026"
+	.ascii	"?\300\200Ry\205\3136\305c\tf\302k:%\346\221\335\255\205Gk\225"
+	.ascii	" \025\230\f\256\212\271A\316\226\212\024\017\005C\337\233\275"
+	.ascii	"<\200\354\220T^D\325\216c\024\366\227[\320\260\210V5\327Q\007"
+	.ascii	"\213\243\311\275p\203\243\235\235\035\254\225nkm#\237\342\312"
+	.ascii	"\301w\315\236<\207\264\240k$\310\260\206\235\217\373\024w\023"
+	.ascii	"\306_\332\303e\206\315\201\b\215L+\220\305\236BW;\004\212l\313"
+	.ascii	"\224\370\r\r\347\267\254A\215\354\351\302\0015k\fU`\370\232>"
+	.ascii	"(M\237\325\0029\277\204 y\313\tQ\235\331\237\032R(n\224p\346"
+	.ascii	"\245MW\302\331\020\246\300\262l\035w#8A\022\350HRzI\274P\360"
+	.ascii	"YS\333R\373\200Wy\204%H7\326<\306\007\334kv\002\207\373\3674"
+	.ascii	"\251\370\337\251\237\026J\250u\273^\244\227\002\254\005\016\352"
+	.ascii	"\352\330\257\327\016#\217\300\250g\362u\017t\366\3310\366\266"
+	.ascii	"~pC\314\037"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.112.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\245\003]\030"
+	.string	"V,\231G\300XM:\3401\3278\234(\345\305\".\326\027B\345\025L\225gM\367\201\203\315\355mw\2239\277T\25466\367/\260\332\312\3751\253\242)\232\n\301\260\356\203\035\252\200\333\231V\300\302\252\343p\225\020\262\211\224)\005\202"
+	.string	"x"
+	.string	"\217"
+	.string	"\317Y\304\301z~\363.a\022\262\335\346\234=>\316\342\345\211^\324\363\037F\262\231\341\246\320\327t[\2721\270\364Mxi\363\001\337\245\367\324wy\3210\333\313qA\263@\024\r\232\2201s\316\325\3428\354\340'\275U\230\017V"
+	.ascii	"0\326|\016\312\370\347-\200R\"f@\213\034\243X\373Q\271B=\232"
+	.ascii	"X\233\351\006\250\311<\2339\347\207\256,j3U\260\302\234\323:"
+	.ascii	"\326^\334\341mO\333\t\354\325\005&Z\255\357r7\302S\221\3169}"
+	.ascii	"\326\007\276\324~\350\341\225\334\323L\311\370?\360}Sk\245\001"
+	.ascii	"\311.\344G<\276\220_*\364\343\245\257b%\226,elD@1\335\3318\231"
+	.ascii	"\356\r\373\336\\\033\266\252S\236\272\346F7\215\247\236\361"
+	.string	"\324\242\252CU\203\253\376V-U\355\251zU\255\252>\201\tSrX\202D\331\266\t7[\354\312\314%\231\244\343F\277}\037\310\215\034\271{\272!-\262\246#\250\317\301\257X\361\272lx\025\234\007NTB\250\234\224\276}\322\255I\217\"\271\266\033\\\n\016\001\2479\247\004\037\312\243p\350\340\301\003\323\250\213\371\303\237\340<\b2\210;\t\241\n\272l\"\367InL\242(\344\030m\237w\236\317[\365\221\243\"\342I<\341\234\023\202\237\344Jrtvvv\365T\024\323\335\217\233s\312\275A\344z\223c\252\221\333\242\272\036\353\333U\233\304\217\260\3029g\020\374\"7R\302\027\272t\257\0219.\317:\252\027\n\022\253\026ku\202\225cb\245\343z\255T\002\334B\261\343Z\245h\265\\+\021\027\273\f\027QP\261\225\031\2016\270m\341\202~\264\002\035\0300\\.\037u\037rp\303=-\306\023\230"
+	.ascii	"\006\023\017\033\021P\315\372Z\336d$\fFb$\337\245\206\031u\006"
+	.ascii	"\224f}\243\f\032\364c\315.\220/3\226f\353c#\375\013T\2149Ma\267"
+	.ascii	";\232\315\031\273\231Y\232\275\322\317\016\231\356,\356\314\252"
+	.ascii	"\322\317\030q\037L\250AD\245\fB\210\241\211&\2300\223\2501\260"
+	.ascii	"\002\031!+\036\021\260)\204\210\246\305l\0072F\351'\255!\004"
+	.ascii	"Y\020 \266\b7\035O\022\210\244\352\214i\342\355\332{\344\213"
+	.ascii	"\310q\016\344\304E\346\b|\376\377\0362h\026\027\243\361X\356"
+	.ascii	"\350c\353\221Q\233j\315\020)\016\345\314\243\341\nm)qS\376\272"
+	.ascii	"\214\355\022\250\316%c)\2029\300\360\022\001\243\031\311\323"
+	.ascii	"\177I\347Tz\276\263=\364 =\311\335oss\2743\nP_\213\236\205\266"
+	.ascii	"Z\255\347\205\367.x\300\247\330\006\234\373)j5%~\033\330\325"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.113.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\345\003\365\031"
+	.string	"v\360\247J\300VQ:t\250/\234>\370\313\227\322\\\306Y\363\356\3428\202\252\237#\366\235\250&\336ZL\241\r\322\255\r\237\363\346f\354\364\377\312\n\016@\223@\"\013\021\006\242\330\251@3\220\303:\022\256\n\212\002\377m\237\220-wJ\001\226"
+	.string	"\200"
+	.string	"\223"
+	.ascii	"BM8\204r\214\343G\267\373\\\276\216\250S)I\323\321\222Z\353\201"
+	.ascii	"\203\316\200:8Co\244\343\342\302\274\321\241\310\204\005\033"
+	.ascii	"I\023h\350\304\264T]\215\026\fxR\304O\3731.\343v\"\235\273\324"
+	.ascii	"\nT\352\250\225\207\3004\250\203\346\035@x\020\365Vx\3207[\311"
+	.ascii	"y,jL\223\321\207\242'\265VqW\374v\272\363\346\277|j\327\263s"
+	.ascii	"Z\342K\r\fI\221\204\325\243\2432?@J\274\374"
+	.string	"\344\351\311\315yrPk\365\334\365\214\270\301\333\206`{\203M\013\004A\276Nx\360\253\352\371|\360\370\340\346\024\233\2673W\205}Zk\255^ \373F\377\314o\374\003\356\273_\347\375\002n\343\227\371\357v\235\350\2179\215?\300N\303\354t\213N\277\320i\027:\335B\247Y\300i\026\235^\241\323*tzE\247Ut:E\247Qt\372\264\323\341N\203;Mwzwz\356\364i\b\300\b\"q_Y\253\210)Q\252\022\270\303\305}\377\3579^z\365sI\253\321\003\363\265,k\307p\346w-;\343aw\354Z\226e\365|NH\326\372?\036\310\346\221\016;&+\313\nR>\004\321Q\255\236\272Zq4*\273\262!\0239\244\232\253\265s\306\360;\225\235\321\355\216U\233\332\325~\211\374y\355kU\013\022q\255kSFP{\332\327P\217\373p\351\007y\203\177\363;\377\266\001\022\023\341\236v\362"
+	.ascii	"\227n\270`\004p\301%\036\037\234\004\272\254\236O\b\217\317\256"
+	.ascii	"k\237D.\231\373\335\245I\244P\216\302\\\272t\244\n5T6X\315\r"
+	.ascii	"\235\21557\024g&\243\301b\030N\266\232\354"
+	.string	"\206.\230\215\013l\260\232\331(\263\301f2[-v\303\242`6*\260\301jl\263\030\215\306\301fe\233\0045\r8\342(\023g2X\216hC\253\211\t`<j\210\321D\3338\322\304\025\257\236\326\005J5y\241\204\333\034\205Q\231'P\334<\302\326\302\254\252\227\243G\376\344\216\3044\004\305\256\n\327\302\326n\256\310\214\032@t\023\212[\353#\335\210j\363\310\313\266\366Ld\020\034\b\035\365\345\262/\273E\344O\356\005\311B\246e]6$B\016\345\002M\250AX\206\f2\210,\2308AAb\314\030\260\002\021\262\032\017\020H\007K\223\341G\210\354[\032m&\244[\321Q\021\352\211\221\363\250\004\236=\360\222\240)\032\030\240A\273\017\2060\034Y\375\224*\035]\261B:\031\3662<0b\026\344\foB\344\331t\366\202\303\323\003b\006\222|\227Y\"r'\363\036\350\177\242p\362\342\006\351G\344"
+	.ascii	"\200\031\004\022\375\307}\335\237\313\003s\211\247)\027\177\013"
+	.ascii	"\233j\004\362\342\367D\327P\206\f`\2361\274\240\343\001\347$"
+	.ascii	"\352\323TN\261U\r"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.114.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"e\013"
+	.string	"6\024LB0k\225\016\030\260\373\fM\2048\375-\244\3139K\317\351\340\240\204\352\264[\036\225\f\253\243\207\377\311\377\031kU\245\257\021\266\214j\031\242H\rjYP\001\021C\212\254Cg\205>\337\222\275\311\226)\0057"
+	.string	"8"
+	.string	":"
+	.string	"\265v\262\300?\237\233\334\217\377\361\222P\004}>\210\245o\221\322\345f\361\232\020\203\020E\233\004\351@\370\361+@\f\355r\030\265Vo(\016\270\351mg\330\256\260\177\021\237\276\207~^j\250\\3\023\2705{\005Z\211\262\277Uy\262\277\346\276~\204b\334@\340\0212\324J\252u\250\255I\001\201\355O\374\261]_\245\352\304\314\302\310\201\254\006\337G?AT1\0050pk[!"
+	.string	")\301\306\255\335\361\330\207\226\022\364\024\355%A\232B9\371\361\021\f,\r\242\245\371\247\320KNzG\246\320\027\234\301\207o\300!\236}\030\266T:\033L\367y\035\207\267\241\351,\234NW\211\360\267\271p\272\216\357\343t\223U\375V\345\311\022\016\027Z\240\fM\211\272P\377\301!\\0\236G?\001\250b2\030\230\241>\353\r2\232\027"
+	.string	"3\241\211(\306\343\203Y\332\216<4\007\013\037u\310\016\302!`9d\002\255"
+	.ascii	"J>\\]a\227=\230cQ\366\271\206\013\016\341_\306\035\227.f;-B\323"
+	.ascii	"\030\024\024"
+	.text
+	.section	.gnu.lto_onGpsNewData.115.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\316\003\305\031"
+	.string	"\306.\242H\300\030Q:@\021\255\243 \221\017\321\311se\021\002\322\\\304\377#h\203\223\310)\337\303R\260\016 \225u+\321cnI\235HfB\331\030\004\3132\005\321}\024L\343\024\021$xf\241_3\343\324>i{o)\223\f\215"
+	.string	"\200"
+	.string	"\223"
+	.ascii	"\237k \374$p\026\375\224_\321\317=\357\275\022\337m\212\247D"
+	.ascii	"\365\271[bW\365\311\252\205\355*}\bG\025\320\324\024DdL\255\325"
+	.ascii	"\3257\016;*<\321)\233a{\240\243>\342\036\376\312\n\334\215O)"
+	.ascii	"\033\214S\030\237\022\301\322\021\220\3066\223\254\332\016\332"
+	.ascii	"{g\0246\023,eN"
+	.string	"\216F\023\215M&\tL\371\005\275%\202\031T\\\320\330b\222e\305\206\227\013\275\200\217\0258\346\023\203Z\3532\315\306\342\233\372\356\312\330\335\003\273r\003I2&\263\374\026}\333\364r\320-v\"/\"\356u,\210\027\237\366\242\237\357\013\375@\030-^f\360n#\007w\207b\334\272\335\313\332\271\335\346\305i\336\233\346eM\336U\363\332\234\350[\323\274*\311\233\232\274\250\311\033J\336\223\344\245\222w6\257l\336\0178\020\251\246\242\305\215\240\324Z\013\232\251\277\211\304\343Dg\346\335\357~\267/\372\320\207\300N\264F\257,*c\311\225\251-\325Z\023\004Rj\372E\237H<#M\267TGa\037\rL*\006\252\367N\376d\215.,\223e\342\243\201\031\215\036;\021\343WwA0\250$\253u4\0206\252\347\231\231\217\030\007\367\324a\377\313l\211\366\354S\177\326\243\311\2170\220\330\331\241\237\264sr"
+	.string	"\340]\036\r|\332lN\002\342~\261\006\332\353^"
+	.string	"\031\245\274Heo(\362\311\230\314\356r\270\0221\254\265*\330#y\222\236\275\216\317\355\340\343\323:I\275\221\203\347#1Vjt\353\266Em\302+E\001\031vxyt^\0378\270\304\036\227\207\236\f>.\236\237\227K'\300\212\0374\374\270B\210\342\217K54\276s\313`\354\030j\033\204\254\276\320\357\252fu\021\035\274T\222\noI\220S\353\036\320\275\226oy"
+	.ascii	"!B\004\3729b\007\034\3034J\240{,\317\"a\002\205=\005\372)b\007"
+	.ascii	"\004\3024rp\225\236\374\020BY\274\357U\260\300\247m7\320*\030"
+	.ascii	"R\217\314\326\0359N\277\307\345o\321\233\306\251r\323\357]J\331"
+	.ascii	")\255\332w\241?E\322\215kz\325-\337\214)O\250a,\250\0342\212"
+	.ascii	"\221\210\204Q\232\202\246\003\220\002\021\251\273\016\020`G%"
+	.ascii	"-\2445bP\265\316\233\264\237\032\214#\222\243\375\030\315\024"
+	.ascii	"y\255vi\\\362\"e\270}-:4\037>\313\336\250\305\021V\b\357\241"
+	.ascii	"e\223\341-.'g\332\027\257\370Z.R\030 q\005d\030\276\360\306\234"
+	.ascii	"\273\254u\301\230\003dR\006\316%\024x\345\253}\340\376\205\350"
+	.ascii	"G\361\360\240\210\346V|b'}\tv^\252z\n\354\\Q\313%_\355\312\371"
+	.ascii	"\304\230\3619e\376\255\216\361\207\215\273E\376 \006B\257\321"
+	.ascii	":78\352-\256\022\253Xw\316T\2442j"
+	.text
+	.section	.gnu.lto_gpsSetFixState.116.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\265\n"
+	.string	"\206SG>0k\225\016\330\266\255\345o5\026\277+/<\236\256\034<i\261\267mWJ\303X\035\207w\362\t\226\f\373\376f\024\323\314\321\032\242\240\004zX\304\204\370 j\262)\245Mm#{K\231R2"
+	.string	"6"
+	.string	"5"
+	.string	"*\017\273\213)\202k\217PS\363\037\226H\347m\217\022^\351\020R\272Nx#h\261\273O=\007x\\\346\303\262\273\316\316+p_\267\275a\033\303>%>\352\207\232VM'\244\202\205\301\300)X\330%\320\022\261\253(\201\201\355Klg\332\031\032\332Q\241\3117D@M\330\375(\276\200<Z\263Y\377\022\354$\204\002Rw\360\007\033\177\201\263N\276{\364;\327c*G\252\302\007\223([\033\274\322\016  \337YuKu\350\202\252\\\206\006\020.\214\022\204\375m\251\007\354\303\325\223\003\031\320\005\364\211\306T>\234\016,\323`"
+	.string	"4\227\r\206\361|\260\n\2053N\306\203\201\262\314\203I\276=\\=9\302\241\303J\244\\TU\275\323\360\021\337\\\251\252'\231\270l\331\001\026"
+	.ascii	"3\241\275(\306\344\203ql\257\027\032\301\312\226b\027U\331\r"
+	.ascii	"\252\005\352\0364\003+D\367n\302Z.\344\177\030\373Jj\\p\367\201"
+	.ascii	")M]=\324\220\355*e"
+	.text
+	.section	.gnu.lto_lastCoord.3.163.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_gpsInitNmea.part.0.176.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\222\004\035\035"
+	.string	"\366s\266G\220\234M:\004\314@\344\345\004\240v\330D`{\034s-\257\2673\261\233\217\300\250\312X\207\243\253fq\264\361\223\210\273\351 \001H\004\021du\331\263\274E\306pv\262\205\242P?\271\3101b\267&m\357-e\222\001\236"
+	.string	"\223"
+	.string	"\250"
+	.string	"\337\275\326\322~km\301\245g\351\026\210\027\254\277\247\007\327\366\271K\2165>K'\356\236D'Q\302\304j\r:\370\\\004\342'\320\177\350\247|"
+	.ascii	"\372\371\253\335]z\332q7\354\301\037\365Q\32485!\253\265\342"
+	.ascii	">\333\307\307\323\304\031\235\262\2716\356\177\273\323\016\210"
+	.ascii	"\263\217y\202\262\375\234\230~\312 1+c\267_O\376\324\260\362"
+	.ascii	"\331~1X\326hT\265\331a#\307[\006I}\335\270\375x\362G\f\2175\337"
+	.ascii	":\313\37051\003xmF\241\326\272g\212\372\332\276\2739vw\302\256"
+	.ascii	"\264\n>)\260n\252\235\241\271\216v\303\340\372\302c9\313\375"
+	.ascii	"\356f3=\"M<\334]\024\207\242\023k\255E{'\177\222b/\344s\217T"
+	.ascii	"\314\275\n\372\311=\353\312\002\304b\342\341\322x7\327\202\357"
+	.ascii	"{\377De\2015\365\216\2118U\033|~\353\237\321\345\nl\307t\270"
+	.ascii	"\251\266k\357\341p8\334\356\261\333\274=\315{\243\274<\315\273"
+	.ascii	"\323\2746\312[k^\332\344\025%\357l\362R\311;\233W6o7/_\353\373"
+	.ascii	"\002\002\"\314\251\265\306pN\235\232W\206\\+=\251&\036\226\321"
+	.ascii	"\221\261\365\034\3632\300\264\256\365n\005\013|\337\002\305\350"
+	.ascii	"\335\356\303\034Li/d1d\340\f\364\263\326>UP\213\364/\032\304"
+	.ascii	"\275\227\177m\220\034<\320\373<\320OZ\027U]\231\265\b\342\\B"
+	.ascii	"\334KX+\257hw\223\276E\304\231\374\250\225'\241\353^#$\211\022"
+	.ascii	"\264\004\375\234\365\275\322`\315\246}\247:L&\236\345\004\226"
+	.ascii	"\331D\275\2562\254e\243\005\346\314\324Q\3310\270\322\354\032"
+	.ascii	"\275\212N\244\"{\216u\001\261\336St?B)\263.-eP}\266\022G\314"
+	.ascii	"\224d. J\236\324\336\261\375[\005[\343!\212\0204T\364`h\350\001"
+	.ascii	"\321\020\204\013\037@tH@\340E\016\251\327HH\211E\n\\\356\b\207"
+	.ascii	"ttb\005\316("
+	.string	"I\t'\344\2639\026(\222p.r\271$\234\355\262R`\352&\262\340?\265\013B&V\203\265\301\347\231\316\366e\255\265\322\030\360\374X\204\356\216FF$>:~`\274\336\341H\"\254b\017\2347f~\353\2366b\267\236c_e\t\370\\\017\033\201\n\204\265\366\356\033\257\304\336\202\005\273\343\2221K\rO\317\336\027\020J\n\235(\340\254\251\316\200\312\026B\2225\346\b\023\220\356\264P7@\210\346>7\327Q[\357\264\214\023]\250\201D\203\224C\316\210H\020\005IAj8\220\002\221\271\";\021\260A4\244Ir\317\203G\025\224\"M\242\334:6\242Fe\"2+Ox`+~\205\303\0044\322\252\365\330\257oN\023\025\257\340\355kq\2327\340\340\016\332\214\255\273\215BgpYq>\207\271\203\022\223Nc\351B\330JE\275\371va\364\305\213\346\366Ir\330LlI*v\306\247\270.\374"
+	.string	"I?I\356\315l'\\<\370L\267i\026[\246\225\336\231)\245\320\332y\212\0370\016\314x\025\211`a\354\224\262!8\363S\t\252\347\016\036\244\2366\333\355\24460\023k\006\003$\345\3046\330z \326\003N"
+	.string	""
+	.ascii	"\244q|\377\203\373,|~"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.194.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\235:M\235"
+	.string	"\232\337,2R@\020\312\352\373\344|x(\335\305\215[\027\335\177\363?w\273\260\005?\026\346\020\305\\y"
+	.ascii	"\032\355\266\255\036\b\360\216\316\325\333\025\333\204\355\004"
+	.ascii	"C\372 6\367\314\025;ra\217A?\303:\351#\245\377\007R-f9s\214\355"
+	.ascii	"\"\302\231\317\366\3362\245\024\n\003\334\002\r\0031\31286\332"
+	.ascii	"\313\213\233\\2 ~\304\037\207\177\r\177#\377\243?\321?v\307s"
+	.ascii	"\267s\247s\227s\177s\217\272?\335\323\334\307\374C4\243\216\220"
+	.ascii	";f4\nm\234\324\214:\362-\243&\363.\026j\362t\323\353x\241Q\310"
+	.ascii	"Fb\220\216\027[_\305\032wq\334\354q\267\233>\367r\233n\357_\362"
+	.ascii	"\255~\345\343x\246\024\236)\005\032\254UJ\005\370\034\313M2\231"
+	.ascii	"*\231?(bS6n\250\321\217\304<J\032\365#\247E4\216\375DbW\343\020"
+	.ascii	"\261\277\330\364\303\017\372\270_\350C\357\n^{^\322y\225\275"
+	.ascii	"\263k\307N\257T\350\332\353\306\234\326*U\256"
+	.string	"}\356\210\231\2178\270\267\366\251\331\324-J\264]\372\004m{\266\263])\231kN\332%\211\013\315\323\332\325\316\2141\316\2401\332\317b8\227\f\036\027\343\226\247 4X\231\270\263\373\327-xY\273$1\361&>\326N&6c\205\344\231u\205v\261\025\\\234h\350\026:'\352\005\337j\237\201\202\026\325\336\345^\355K\224\314\200\301\267\232e\f\315\207\222\031\3071\f\355J\372\207\304\223\300\340\\2\350\b\233\261P\003+]\314\2738F\256\360\271\333\"\335F\253\246\035kF\273V\377\216\314\360&P\353\b5\343$2\313\215\004\275\t\344\361Q\354\306\273 V\254q\334\344q\267O\370\334\325q\233\327\335\326=\274\356\376\334\365\"\335=\003\331\301n\2527\243\342\020A\356\206\222\334\305q\334\343n\346\341A\177\201\200\213\003\f(\200\200\236\001\004\b\200\247\305\016\213\025*R\2408a\242\204N\016\211\021\""
+	.string	"\300\271\t\001\342\203M\215\007\232\031\231\030\230\027\340\317\245\305\307\362\272m\376\004\202\355,>B\177\201\200\2136\347)G\326\243\310\271Vg\r:\344TH\271?\300"
+	.string	"\217\"\247\304}\001\004\260\370\364L\333~"
+	.string	"\001\250\317\017\200\355\t\034O\213%n\002\257\311\314\3568a\321\036@\274c\362(2\255\005Z\031\212\342TH\265_\361\243\311\314\252 \3636\2102H\n5\024,>l\356\311\023`_oBZB\307\253\353s\246$Fda\275\2109"
+	.string	"p\242\310\";\374M]\b\026\037\254{\022\304U\253C\205\004\362\037<\317FXS\364@D\203tO\316<\222\267NF\253\314\005N\3125\217\021c\022\266\304\bs\371C\007\037R9\364\210z\333\034o\213\\\223\201Yku\250\220\312\177y\252z\002l[X\307\354<\212\304\321\332\030\3758:\025\222\351\177\276k\025\023:\227\026-/\341c\361\021R%E\307\222\364\312\241\177[\235(R\251\325\211\343\370\227,\276\313\342\343\2244efw\034Q\275m[(\237\324\200I\022[\033(Nr\256\345O\224\024\372\274t\303%9|e\3428\366\035Hj\3734\236"
+	.ascii	"\213O\034\307\355AUo\005\274\273]\241\2739\350~\261$hPa\036\352"
+	.ascii	"\235\327\313D\240,\004@v\244\322\325:f\007\203}q\252d!\214\315"
+	.ascii	"1N\226\241T5\203\342$\367\342~\327\233\0250C\265\303x\357\r\034"
+	.ascii	"\234}<\030\357E\177\366\255\300W\032\336\013\n\205\257\2737\355"
+	.ascii	"\235\322\334\222\210\267\317\257-\341\206\213\007\221C\\Cd\030"
+	.ascii	"\r\276\216\016Dv\001Gf\223?d\257\006\255\374\214\203\247\006"
+	.ascii	"\227\r\314\331d?\363\220k\246\374\370\342<\344\367\206R\224l"
+	.ascii	"\026\225{\327[\322\245\201\317\036$\276\335\301\241 \r\256\345"
+	.ascii	"4]R\262P\241,l\241\311R\334\216u\356@\357L\246\311\355\225\242"
+	.ascii	"r\370{Q (3Y\206\322\223\354\002\037\223e\212\202Fl2\271\006."
+	.ascii	")\371O\20268X\b\277\026\\\272\230:\211\311\016\326#\353%\303"
+	.ascii	"dG\372\264\037\037\332\013Z6\313\007\214\223s\361\277\fT\n.\275"
+	.ascii	"\037[\207\350\004\346\017pIA\277'\343\311\2028|\375M~,\230CG"
+	.ascii	"\320\311\351u\367\227\275NI,K\306\342\222Y\262Sm\305\t\360-<"
+	.ascii	"\202=\336\217.-\336\227\273\203:\004\201\274\037[\262\216P\026"
+	.ascii	"v\377\327\203\301h\367\321\301 \301\252\257\312\036(1\371\354"
+	.ascii	"\005$\"\252\313k(\205e\223\336\314\222\263\333\220^\320\357\r"
+	.ascii	"y\256\240\225\233\275\350n\027>Ip\311@T\034\013)\340n\377\326"
+	.ascii	"#\t\026i\203XA#o\320\310\353\356\233_\351\0228\225\300\336\f"
+	.ascii	"\325\255\003\275n"
+	.string	"\367\003\3374\342f\031JJ\262\331\333\211u\025\345\356\320\2202\273\342\274\243\263\363h)Ik\035\350m\263\357\330z\n\275\225\316\371s\233\177\25685\374\275\356\216\340\231@Er\236A\211k9\342\273'\240\340\375\370\371\323\244\330\200\016\263\260\377\207\223P\003*\374+\235\335s\206\352\266\352\277j\352\215\\RK\344\217U\375B2Uw\317h\362\246\270\252k*n\212w\200\364O5\325\027\307BW\272\217x\177\304%|\342(UGk\034\307;\357\243]\331\375R\276f\274\363k\"\276^wW\360=~|q\034\277\350\347\361Q\030\264\373p\2673\330\340\375\270Av-Oq\004\354I\211\225\025\364{\237\241:'\340yooo\257\363S7\360\233\007\370\335\002\370\275\363\373f\361\373^A\363\255\342\367\235\302\346\033E\315\367\211\232o\0235\337%j\276uj\276sb\276I\324|\217\360\360-\002\370\r"
+	.ascii	"\3157\316\314\367\315\313w\b\3407\210\230\357\017\277o\233\230"
+	.ascii	"\357\232\337\267\007\3407\r\360{\346\345[F\346;&\346\033\346"
+	.ascii	"\367\375\362\362\r\004~\377`\276]\200\337-/\337\276\307\341\315"
+	.ascii	"\362\373~\201\337.\360\273\005~g?\342\375\277o\367\266\326\312"
+	.ascii	"H\316\342\355~\300E\002R\021\345\326\220\346 v\254s\233R\003"
+	.ascii	"N\206j\243\256\343\036\271I\035\3472\312zSG\305\353\256^.\r\370"
+	.ascii	"+\314=\212\271\3061\267x\255+s\205\256u~\225\242\346\006\271"
+	.ascii	"B\272=:=\272:\272<:<\272:\257\013\201\275sl6k\227\305f\257Yl"
+	.ascii	"\266.\213\315Z\263\330,5\213\315\312\331M\261\303\262\330M\355"
+	.ascii	"\336\354\260vnvQ\354\260\216u)\255.\020\035\2749\331\353\266"
+	.ascii	"\342Z(\035\370ZhN\366\244\033O\356Z\3567p\225\305Y\353\207<\277"
+	.ascii	"\342y\256\347zk\360\227\353\251\271\036\232\353\231\271^\231"
+	.ascii	"\3535l\346y\256\347xcMZ\377y\035/\f\314\361\2268\236\227\343"
+	.ascii	"5,\365<\317k\262\211\375\205A/\034\016\221\f\205C\255\241p\330"
+	.ascii	"\034\n\207YC\341\2209\024\016\343\035\342e,\374\230H<$\026\306"
+	.ascii	"U1U,\0242\325\024\207\276h4\352`,\032\245\214Ec\017c\321\310"
+	.ascii	"\303X4B\031\213F\242\023q\007\261Hl\"\346 \026\2118\210L\304"
+	.ascii	"bQ\311\003\021\215'**\262\001\177\205\265Hb\255\rcm\262\210\250"
+	.ascii	"\250\341\262\326\250\210\250\310\211Z[DC\312Z{\244\341H\364l"
+	.ascii	"\207\216\r\267\265\305#\021\021\022\r2\313\371'\037y\004\347"
+	.ascii	"\325\n\217\220Y\212\377\321\336\0212K\375\217\256\334A\375\217"
+	.ascii	"\360\216\220\371\351\177\224=B\0369\3617\302\032\331\031"
+	.string	"!\263\021\025\243:#d&\3637\262\032U\215\220\260[\f\322\335\251\244$\313\344\214\fm\034\357p"
+	.ascii	"\311g\254Z\277\327\037|\213\267\331\3737<\022\274\345H\204(\231"
+	.ascii	"\3428\266\001'\201\225\260-\241\304,\354\354+\274\362\024\376"
+	.ascii	"\212!\333v\254\013\313nJ\302\226Lb9z\327\321\261\334\306\202"
+	.ascii	"\005\273\272\016\361\237\267,?\371\371`\243a\263G\202\321`l\370"
+	.ascii	"\033a2\225\314k\253e\265\264\244$\256%\223\273\226\315\234~#"
+	.ascii	")I\226\311\352?\3573\217\375\344\264\345&0\024\0205"
+	.string	"\032\226>\022\354\026\023\345\356#9\217\020I\224\022\213\251\006o\037\031\013\236D\356\206\341\340)#2\211\354\325WD\036\221s\330\020\331\360\367\3462\030\\\315_\"rLRl\212\313\273a\272\354\325\365\033\023\363\241d^;x\273a*9I\007(2\222\035\224\252\\]\217\376b!\357\254\217F4\212\311P\235\217t\326j*\316\025\246\211\3259\353\205\3116\0257-;\357\320T\2349\340\325\220\316D~B\300\202t\246r\231\302\322\241\363\217\026\037?zt\316\301\027\225c*n\302\201\305\201\362\323\220\244\251\270IG\347\035M\305\341J{\233ptV6\025'\211\313t\243_\253\2517{iJ7t\266\321\324\033\275\244\214t\324\331\206\246\336\344\245\275\003\345\244Q\177\224\246\272\330\225\222\251\206L\324\231F;P>\306\304\254\354b^ecwS\335\261mB\f0FP\201\002\030.\200\240\301\b/\200"
+	.string	"\001\f0T\220a\001\006\t$\274\020\302\0071\270\320\002C\f\025r\2130@\0132J\350\211qB\217\n'\200\220B\217\b,\264\3203@M\307\220\001\203\205\036\027b\304`\241\347\347m\234\237\332'(\017\373\245\334\377J\214\365)\265\355\255\"\305D`\017\306\252\320\203\362\024B\367\346u\240\002\217l\351\f\3075\315\305\020\347\311,G\236@\266\340\034\306\206\246\032\007da\354{\247\343\371\244d\276vo\225%\347\3255\210\005\312\370f"
+	.string	"\224\363P\251\343\021\313\256a\025\220\203\334\nc\253B\226\302\356\256-\3369 \024\257\234\324wr\213\fB\272D+*\20734\252Q\004\004\351\361\235\354\321\007^8\240\351Nv\344\222\222%\232\177\027ui\200\227\212\004\025j\245\226e\002d\250\276\361\237\227E\366(\213,\375I1}\243IVd\0269\233\301=^\350O\333\212\3547,!\311f\225\271\n\310\253(\274"
+	.ascii	"\336'\375>\363\2322\255_\265\246\372`\354\213fU\364:\3735\203"
+	.ascii	"\261oY\223\360\311\312h\215\233Td\367\365\336&0\326\367\212\251"
+	.ascii	"\270\241\227\035\232\343y=w%\327\263I\326*\224\205N\240\224-"
+	.ascii	"\274\334\337/_\002o\005\020\345^mP\242\227\022\370\013\355\352"
+	.ascii	"\332\200\027\022\264\263\254\227\326\331\225W\263e\310\354\316"
+	.ascii	"+\353\347\303\324k\t\214\266\304\277\013+J\311\274\346\265\325"
+	.ascii	"\355\004\255\336\024\031\230\303V\234\324[$h\265C\212\354N\270"
+	.ascii	"dX\025\026\031\252]\207\201\274(\340\204\336\212\016\257\025"
+	.ascii	"\f\344%\202\302\245\272Qe\231\325\364\366YQ\302w\303U\360\220"
+	.ascii	"\334"
+	.string	"5\305\bt\310\\\203f\255*|\314\235\f\350eNvu\276\276\342u\347\017\370\313\347\224r\2229{8\311\234<\234dN('\031\214\006\343tg2\225L\327&\267z\235v0Y.\337\034\312\251\244\260,\374\365\026y\227\340\257\234\351X\303X\357\r\330\310\030\031\231\273TIW\336>)\324\234\270\332\232\327\213\004\177\205\2756\210\275\311\261\327hMm\255\341\262\267hMmM\355%:\246\251\021\340?\357\332;TLS{\276Bi\r\267\275\303455\024lm\316\006\205\352A\331\240yP6\250\025(\033\364\016\312\006\265\203\262A\317\334\237\327'\225'\033\002O\353\263\372d{\316=\345\236l\316v\342\004\235\033\007wB\212\020\265\246\211\250\2734\212K\335\334\242\270I\335\242nR7\250\233\324\215\315M\352\366\304M\352\026u\242\026\225\322D\317\242fQi\264,J\026\225JK\374\304\230\354\351\230"
+	.ascii	"\3732\321\266\234Bk\2223\205\363i\\\034W\3344\016I\3344N+n\032"
+	.ascii	"\327\214\233\306e\305M\343\336\230oE\336\246\371\352\376\266"
+	.ascii	"|\273z\233\276\021y\033\3626\235\222p\241\n\"\245dD\t ?J\240"
+	.ascii	"e}\230AE\314Q}\256Z\355Q\235\253\362\250\316U\241\252sU\247\352"
+	.ascii	"\\UGu\256*\227C\331Z\255\271LKOWI.Inn\216\356\206\020\200\226"
+	.ascii	"\204\332\250\243\361\t]\217C\205hD$)(H2\034\263\032 \f\307\302"
+	.ascii	"$\216Jx\007\023\300R\006\302\020%\212t(\313\020\"D\031I\221\244"
+	.ascii	" I\251\003\300\215\350c\323\303,\364\025W\341\351\214\325\247"
+	.ascii	"%`G\3272\237\b*\033u\253\257\321\254F\2646\341\250f\031\323\n"
+	.ascii	"x\317SZ\031\213\373\234\367\264%\033\314\253O\307\342\036?^\035"
+	.ascii	"I\336tg\266\216\355\b\204\274\331\211\017'4g\375\004\360\177"
+	.ascii	"D:|}\244\363\177\314\270\210\370A\352\027\244\365pv\267\017\272"
+	.ascii	"\340\274\326T\316t\017\201\365P\377\333\372G\275\013\247\264"
+	.ascii	"\177j\273\216\177\241\030U\247j\370\315\300\363\f\244\r\216\311"
+	.ascii	"\341F\215\322\224\356gQO\250\006\245\006g<\013c\257\352\250\351"
+	.ascii	"\023\016\374.g\312\2310Vmm\315\324\345\315\"\n\255\255\362\331"
+	.ascii	"$M(\331\304O\231\230\210\216\016^\2725\210\227\313\344\272\307"
+	.ascii	"\312\227\334e~\257/\234\234\213\343vn\270v\331\177\007\372\331"
+	.ascii	"\345o\267\036lH\374{\375\370B'\334\254O\f\271!\034\214p\365\377"
+	.ascii	"\013R\253\210\215G\006Whr\003H\032+s\034\2542\230\301\210\256"
+	.ascii	"5a\377&rA\007Lh\027\336(\032\353i#dB\027+]\272\251B\035\241\277"
+	.ascii	"\216\256\3530\371\312\217\214\317M/\356B\327\031\374v\242\365"
+	.ascii	",\307\016|\004xp\332S\333&B\270\030S\024\363\331q;\224\210-\024"
+	.ascii	"\304\340\307\013[\267+ \260\321\335\317\220\367&\333\223\235"
+	.ascii	"\326F\017\035\036\026\242\330xZ\301=\031\334MN\2762\002\216\333"
+	.ascii	"8\333\366[\023\217\030\316{\023\370w\334\330\335v\013\3407\031"
+	.ascii	"\345\001\221\031F\246\260\r\023\307\257\"\\\022\205\323\263A"
+	.ascii	"R\301\242\377\355H\234\031x\355\204|\030\264"
+	.string	"\234\0036'\300`T\374\251/\2376\230\f_i\311\255!\230B\226\311\247\367\372\317\250 \202\351\355(\251`\301\373f\244\316\f>k\025\034\237\006\217\316^b\243\023d\005\351\351\226\271\231\236\267e\006\257\202\224\350\321\\\323\315\213\200\256O\310\224\024\376\331\226\352\334\304O\204\241D\205C\030g\\\021\200\361u\206\271\221\216\267\235\036\340\226\322`\017\352N\3323u\212\236\220\320Y\360\277\031\315\271\203\037Q\203R*\316fo>l\016)\352\234z\016x\003\"`w\247\203\314\367\375\3307<\261\023\262\025\272 \024\023\036\327\310\224C\274\005\342\035\341az\2602\254\3265|v\301\233uAM+\\%\337K\313\t6\306\341\264Sw\333n<\216\301x\001g\230*\203q\201\003\317|9\352\247\272\324\311\031\371\354m\341\030\213Z\331\261\211\277\257\256R\214\315\027pC\202=\241%\002\200\t\256\321\221\351\370Q\273"
+	.ascii	"1m\016\200\212\345\300\307?Z\0077\b\037\217\376\230n\330\340"
+	.ascii	"\020)\304\035E\305|\202\021N\n9T\252\214\177\003\333\037\246"
+	.ascii	"\026\030"
+	.string	"~\3330y\n\275m\230\212\315\3346\254\n\251\334V\301]\225\210\240\331\n\017\3456\264J\017\006\350\325\027m\303\0236\240\331\035TD\004_.\311\326\354\241\236\rR)\227\274\335\206\344\330\360\267H\314\253\305\201\256\303\271\276\370\n\200\243[\346\034\253\327\217\2505nZ;\244R\226p\263\r\315\261\345o\231\230W\234\340\261^\271L"
+	.string	"<\366\303\234Ci\235\227\330\204\237\266\247\333\366pW\253I\356\006\301\305fg\332\256\351BA\351\331\027\327\272\006jGB\263\007b\347\356\036.\236<\315\250@\254\016\276E\324G \260\223\201\366J*\340vh\321\251\273\023\337\007\220J\007S\236\216x\254\276H\314\347\021\200\007\246g\223K\374**\375\354\353\312\366n\322M\205G\360}\214\245E+\212\rZ\225\354m\266A7\034\242)\212\213\253o\204\322\302\275z\321\347 \\\214\030y\r\245\270\025\261'-\275g\004\0227\322\363\226\350\302\250D\356\257\202\217#\304!A\3079\3021\370\026\356][\017\354\202\f~\207\363\023\201"
+	.ascii	"x\325\377\242\b\271\252\346s\2019e44-\335WXE{\331\005Z\0273R"
+	.ascii	"g\023L\343\254\276v\267&\002z\203\234\241\217F8r\247bAi\030\312"
+	.ascii	"\020\351}\301\242\235\027<\332\363(\370\210\230\227=\330p\013"
+	.ascii	"B\360\337\205nz\317\301\322\0318\022\356\315\3754\340O\366pT"
+	.ascii	"\226\277wig\303\240\356e7\200\216z\253'\312\250\216\254\200\326"
+	.ascii	"\342{X\003\320\212\312U\276w5zf\300\266\235OD\215\231/%\323|"
+	.ascii	"\217\034\216\331'\344\026"
+	.string	"\300I\270>\262i9q\026\232\007\254\226\001Av\277VK\267=\0232.\214:\310\242 \211\b\215\205I\334\371x\337\355\321K\300\246\355\355W\333\321\2373\346\033\202i\310\006d\303\304Ej\343&\276c\357\337(\262z\024j\361\235!/\210\235N\346\013%\245\223\330D\241r6gv\240\336\334\215\013\262\322\221\353\363\353\330\243LC\002E\363\313o\232+\357f\to\321\313\251\247\364\236D\232=C}9\323\202\210\244V\033\302\366\351\206X\325\177\327\274\300)2\004p\347\247\004\220\242  \034z(w\222\025\267\260\361\b#\306=\230\b2\212\245,\303\275O_9\331\320\312\236C\013m\035^\362\013d\230\250\232\002\rX\236b,3\312=S\320\315\317\332QA\212\347\336\031\004B\322C\301VE\260\013H-\340\301\323\235\321\252\321\331\205\001\312\300\t\021\246\350)\344\020\254\216A\333\251'b\367\025{\245"
+	.string	"f\030@m\027f\251\210z^\005\006\326\241\320<\016/\306\327\344x\354a\236\250\300\030\313z\375\0351\250\262\321\013h\237\351g7\312\217\026\316\031;f\243\270\350\361\255\305U\235\204\2673\2649\024\017\027}\266\2118\320MXt\306\316o6N\3522\214\234\235^\306\311Y\327e\370\235\263c7^q\302\222\321\344#{\002\3374\337\023\177>\330\023\200\372\200<\214\316\004q28\241c\n\302\374\212\347c\036xn\017\344\225\363@(I\231\210\315"
+	.string	"\264za\373E\240\267i\3777 \226:\335bSu"
+	.string	"\2325"
+	.string	"8\0374\214\004+\002\300E^>\256\2155\005\330\023\tTxR\b\b\240\241e\n.\213\340\243\250o\350\264\206\301\304l\265\350\3640_\003\344\360\221\317\2775V\272\fc\325\367\274\365y=\024'\r"
+	.ascii	"\301\3647\363\n.\177\036\026\310\233(\344\236X\330\323X\252u"
+	.ascii	"mv\371\332\34435\024\231\"\215\341\005\371G\234\266\354\3001"
+	.ascii	"V\314\244\035\027\257G.\250-\205\3746}\214\344\330\344SH\324"
+	.ascii	" \r\326,!\300\310\2112\242D(\031h\0226\255W\304\222\300\b\322"
+	.ascii	"&\"\363\">\345n\340\320\260:\245?!\340&6LA\317\023L\257\363-"
+	.ascii	"\017\212\260\227\302\220HN<\021e \341\321\001"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.200.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\211\002m\022"
+	.string	"\206 rG\320\362&\035\242\006T1\250\302\334Z]\335$\035\202~\360\201\314\250\026\017!ro\211l\352V\017\3738\037l>b\3663\234\303\362\341<\274\022m\241O\260%G\005z\203\037\302\001`\337n\017\321k\214\354-eJ\001X"
+	.string	"["
+	.string	"e"
+	.ascii	"g1\373\221\367\365\260\327\371\261IU\355\356\224<:\301\352\221"
+	.ascii	"\344\005\270G\370\001\334\213\356\027\325\330,\326\343S\330\256"
+	.ascii	"\331\361\314\366q\243\240=`\213\312I\032\262\273\335\243\232"
+	.ascii	"\370\354\232p\346\177<6\327\027=?\236\017O\001\207#\021v\327"
+	.ascii	"+\020w\274\355\023\333%\266\"\b\377\036}\030.\006\226\377\374"
+	.ascii	"\245\247\317\210!\021\353\2436\251@Vx\270\372c\217\2449.\035"
+	.ascii	"\2714\214i\205\351\204\351\007H\242\006Dv;\334\210,\211\370t"
+	.ascii	"\342J?\355i\337_q\025>\322\227\314RJ\2229%\311\202l8\252v\235"
+	.ascii	"\024\254\036i5?\362L\262\301hyv\214\002\252:\225S\304<.\343\256"
+	.ascii	"\251\3470\204\2237\353C\020\005\261\365\334\344\315\006\362L"
+	.ascii	"GZY\262\260:\323o,x\224"
+	.string	"w\252\232\215\03269\r\357M\f\240>\343\002\006\225\374\247\302\311\310\360'\357A-\206\213\203\232\323\231\336\264\002\240\266{\363\317f9\f\257e\327_\270\230\004\355\356I\213\273x\361\205\036\375\202\31143\257\026\030{\265\250]\255\031\231\227\016\366\3524\274Xb:Wl\246k\0210L\306%\326\321\300`\261\216e;\357_\007\210T\216\033\305\261\252\002\331\366h2\270[\002B\325Q\336\314\251?u*\t\023PP\242r\252=\f\305A\215\264C!(zT}\035\337A\301\027r\205\224\024\356\361\337\217\324= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316A\270\203\203\2121\315i\234([\320\326\006\257r8\272\231\261\355\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.202.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"M\013"
+	.string	"\206SG> \345*\035"
+	.string	"!\006~\241\001D(.S\250\377s\243\325\021\006W\374\023I\005\304'l\217s\365\r\311\241\246\205\n\203-\233\373\001\200\001$\244:\203\2738\004\020!T\304\365\260\233\354\235R2"
+	.string	"6"
+	.string	"7"
+	.string	"\236\367z\025\333\"\313\243-\340\261\222]\300\3414d\003v\027|\245$\037Og7\372\250S\216\007\310\347\301\273\201\317\356z\023r\327\333~\260\355`\037#.?\225\301r\244^\266\206\315I_\306\362\226\361..\277\037;\001\264r\253\333\356v^\315\260y\375\256\240y\355\216\240y\365W\036;\035f\016\031s\232>)\332\0017\025EM\3522\355\336-m\331\264\313\275\nDvW\005\b\354H\2259y\355\247}\332\367_\016\363k\207\261'\023?\202\335\231"
+	.string	"6\232\370\231K\177\252\330\232\260f\001\020\240\031\002M\213<&\222\004\030\216@\212Qh\002\024\225L\240'\301!)\242\004V\204a\t\364l\317\323\226?\0314E\251\313v\235\235\333\026\027\363\033>\371w\224)(\270\037"
+	.string	"8g\340\256^)\342"
+	.ascii	"Q0\314\025NL+\364\317\020\270k\206\2654\006\232\020\327\347\262"
+	.ascii	"\301\026x\352\370\250\022\273L\303h\301`\220\"4v\t\021;\357\316"
+	.ascii	"l\274(\031:C\331\314\333i\001\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_gpsSetFixState.part.0.203.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\r\n"
+	.string	"&RB;0\305*\035"
+	.string	"\\\341\371\2415\200\025\322$\203J\233@[\352<\265tk\303\242\377\264#\3006\214\t\220\2616\230Su\020\206\202\020p5?\364\314q\267\026\340\300\214\354\336r\247\024."
+	.string	"2"
+	.string	"1"
+	.string	"\376\354\224\207\030\253\261e\260B\004\354.\367\251\027\377\256Q~>\350J]\037>\202\256\211G\202\313\213gw\215y\335\363\266\031l'\330\337\004k1I6^\273\375\031\312\017\235\251\231\323A\235v:Hy\266\305\241\360i\2156\247\363\235v\322|e\304\303d7\\\3704\002\3463\363y\231m\224D'6\326k\025o\366?\016\022\341k\3303\305\203\237\276\311\362ym\230\225tP\250\342-j\314*/Wa\266\214\2162\372S\332d\003\025\273\255\333\200\241\322\247\344M\2036\336\310\201\353D\034\204\350\363\300\201H\036\267)p7\n\221\270R\327\221\270\314\025f\001"
+	.string	"\001PT\272R\215\331\216*rP\305r\003\3135\352%\026"
+	.ascii	"G\005\240s\006\036x\027\210A\300\230b'V\331\r\310\003#\\1\206"
+	.ascii	"\232pz B\b\265\316sE\365\320\271\312\246\337\316\025\200\023"
+	.ascii	"\317et\314;\257-c"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.211.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\337\001\325\017"
+	.string	"&\035eE\360\260(\035xvJ\233;8\223\034\343\364\212\273\240\375\375\377gk\020\267a\247\366\232\240\254\2564\277\276\372\257\227\221\277\002\262\217w\332\347\364\335$\032V\266a\302\f\004\212\215\221\031\376\333\377\314\037[n)S\nR"
+	.string	"N"
+	.string	"Q"
+	.ascii	"\360\013\372\236\204\355\222\275\363\227L\314`\223\275#\362\022"
+	.ascii	"O\nj:\325\rO\214Q\373*\210\233\276O\023\232\374\323\027\300j"
+	.ascii	"\303_v+\r\327\227\340\205\247\203\307*\365\002\314T3\016{^X\241"
+	.ascii	"2\005\034v\230\304\030\375\201\271;n\373\304\266\001;\037\004"
+	.ascii	"9"
+	.string	"4.\227\354I\215\261\302\277\250\037\354\227\336\227~\233\326M\347K\337#Y$2b\304\320\223#\266\266E\210\333\334~M\311\207\031dS\372\253e\304\003\311\327\232\366]/a\372\253\305\033c\013G\026\343\013\301\327\005>\337\217\017\200\337<H2\265\361\221vJ(\337\251*\317l\204\016JON\265U\036\333Bdr^\254\273a\257\\\305\206\223z\021\254\230i\310\\-\325\030\357E\360*\301D\215T\316lO8\n\321'\306\270\300?\361\033\316\237\371\272\002)\337}}\022\374^\017\373\223\261\002\241;TBbY\321\270M\243\260\245\210\264\320\210\244\225\204\230cQ\031i\0268n\244\201l\347M\\\024\265\"i7pp`\026c\025\306\177\002\360\351\352U0\250\273\370\013\221?\343\023\024\024\310\200\265\002\007\207\007\222#\337\240\r!B\276\363S\314htRz\262*\213+ \220\202\2311\353\001\030\201d"
+	.string	"\032\002E\267\355\225\2306^5jeJ\\\0040\351\325\340\005\222x=V\rb\254[\017\237[\301\270H,\020\366\0217-\244\311\212\332M\"\213\304\317"
+	.ascii	"\257\343{\205\302\266!0Z\361\326\322\306\350\007+\334[\245(."
+	.ascii	"\204\356\006\020\177_\315\361\3344\r\320\275\266\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\357\016\r7"
+	.string	"\n\\\f\024;0\350I:\005\320l\302/\b\r\332\330\372\250\031\364k\256\006C\353S\233(\302\300q\020I$\304\202u]\307\001"
+	.string	""
+	.string	""
+	.string	",\315\226C\360\020\275\211i\013\1774j\332\"_\222$\003;\001*\001/\001j.V\366,\347V\"\273MOsY\316D\303\341\301\231{93\031\310.\247\314\345Pd.\367\215\261 \246\302\031\346^\2219v\377\266\202\302)vy\317\004s8\377\362\243\212\237\235\367r.]0\234\\.\234[.\353\231Z.\363\231\317\302\237\316\260\313\240\016\251\221\270\334i\275\354\351X.\347]\275,\t\354r\244\300\247\227\037\225\272\227\343"
+	.ascii	"\277.\273\231j\032\210!9\032;t\345r\233i\205\333*\234\211\nc"
+	.ascii	"\232\302J)\274\214\302sP\230.\324%1kO.s2\235\360]\023\326\344"
+	.ascii	"\305v\037\030\217\t\327\321-\271\274\311<\261AI\326\331i\222"
+	.ascii	"\t\\\022\220\034\315\021-#\037\212\200 \342a\310\326)\244C\220"
+	.ascii	"\237\001r3?Nf\353c|\\L\217\2079y|\354<;(\226\356\270LI\307\303"
+	.ascii	"r\33432q\334\263\346\r\036u\332\020\361 U\325\265O\235:u\252"
+	.ascii	"\306}\036\032]\347\214\313I\031\227\033\2311./2;\205\021\"\304"
+	.ascii	"\034\301\275\027\227\025}\005s\301uR\245i\232\266\270\214\024"
+	.ascii	"\246\252\232\2561_fGaN\341\354O\214\305\345I&3\243\235\002Q\324"
+	.ascii	"*\355\231*\207\305\243\376a\013\251g\27620;#^\373\243\261\212"
+	.ascii	"@\261z\306\233\223\302\306\206\352?H\327w\022\373\242\330\263"
+	.ascii	"%8f\202'\325\236\nmM\356\3046\215\355\205\177h\203N\354\024o"
+	.ascii	"VV\265\325z\326c\233\273c\272\252\276B\236\033\225*[\343\272"
+	.ascii	"\252\306b\177\262?y\351\253\0325\362\235\303\036\240\236\302"
+	.ascii	"\276\262\032\262}\266\360\310\271\263\205\310w\242Iabx\256\373"
+	.ascii	"\313\037\230\336\020N\225*\337n\367X\332\356W\344\275\212\350"
+	.ascii	"\036\f{\017\306v\257\345\320\375\026C\367^\n\335\177!t\037g\320"
+	.ascii	"\275Q\320}\233@\367n\326\356\337\250].\005\350\362\337\237\313"
+	.ascii	"\200~.\007\366\271W\303\347~\315\236{6z\356\315\362\334\227\301"
+	.ascii	"sO\226v\237\346\316}\231\235\313\247\320.\233\252sy\220\316e"
+	.ascii	"Rs\356S9\227\005\237\246)\263\203\307\271,\352p"
+	.string	"4\034G\234\2218\231\247x9iBD\210\321\304\311\314\303\t\217\037N\2004\001\342\245C\310\022\r\3745\354o\230\315\rWj\303\226\314\370\022\233\313~\346\232w\tj\225V_\261\327\302\203C\273V\002H|\nq\235V\017\327G \363\003d:\255:\221\352Db\245V\204\274>\277g5z\374\207\366\022\032w\312j\341\362\314\352\205)\331SV\013\331\013\240\343\262D*\263\372\306g\365W\376\224\325^\355\315905E\nm\306Q\317b_\020\257\330O[~\350\307)\f\333\025\373g\353\0272\257\330_U\326M\305\206\242\372X\236\312\022`\032\346T\354\005\310kh\313\303\304\313b[\031\177\300\350\227\026\240\330\007D\236\001\231\032\333\241}\274\365f\2466:^\242}\277\330\037\254T\037F\333K\t{*-\177q\214v\022#\252\020c\020\366&\240@;F\273G\353\240\001\213\366\002\343Y\222\034\\"
+	.string	"\264\r\034\321\345\177G\216\032\326\204\366\325\362g\007\305\370\016\355\260Qk\254\220\027z\331S\343;\224x\246nox<\002<lu|\207\366\327\237\330\303e&b[\255\334\022\373j\305B\276\300XZ\027\256#6\312\022@\376t\304&\320\376\3046\320\336\202\231\262\314\211\275\200\025\022\273\207\032\2445\302z\031\003\214\342f\232\246i"
+	.string	"\226\353\3579\236I\365\305\361\037R\024'\373gG@N\366]_<\024\210\367\245Fa\275\216J\326$\354\205ipBNv\021\243\217\366\2502\355\344d7@\276\004_ \016\344d/Poz\342\003\246`e%'\373"
+	.ascii	"\213\266\007\020g"
+	.string	"\026\250\003'\033K\3457N\366U\373\263,\313\237sr\300\\r\013\013r\262\255\216L\252\275\271\366\b\321\031\303q\262\207\306\255\345\373R\231\033 \017r\262\205\307\017\310\302Ie\301\376\364&\217 \217\342d\377\250d8\306\213+\344\206\375\030\256\205\355\033\3035\026\333\306o}\245\376\003[\252\210\335\370\255\207\353\341\230QSY\311o}\325\215\027q\261[\027\333\372\212\355bDmu\274\211\264.f\334\307\210\032E\346u5\272b\035o\225hR\030o\352j+\226\253\253!t\265\3252\024W\017\363\270\372k\237\2107\f\027\242Ql\205h\341R\017D\013\217\377\034\301\2758\336\003\321?R\234\212\017D\013\215\024\320\255>\313A\222V\207\276z\363\321_&3\"\207N\301\24084V\201\004\250a\f\212bhFDd$I\n\222\016\241\005D2\307\214\334\021\240\030t\224\021\021\031\tDDd\244\007\230"
+	.string	"\3739\331r\033=j\371\273\230\231\021Q\221z$\347n2[|\347\365\276\004i\232\004\003B\036\205\345\333\204P\330\321\213\377\334\334\237\033\340\201Ftt\322\275t\235V\314\225E'\237,]6\206\231\315\203\332J\201\347\303\352V6\303?\304#\007\343'\2103 \340\201\206"
+	.ascii	"Ug\207\345\311N\317\336\316\323\226\372\367\327\210\374\365\336"
+	.ascii	"\242\032\021\035\307\325G8X\304\006\300\210CTk\212&x\261\330"
+	.ascii	"X@W\264R\353\216\206\317\345\212\371Y\337h\354\006\036\005\226"
+	.ascii	"n+?\311Rw\363\237\355\244Z\201"
+	.string	"\217]I\223n\177/f5\337\013\026p;\364\260\366\232_.4\276r\232\006\310\241\324}\3078\376\227\243^[\235k{yh\354\241\374\\\323\357Z\353\310\3676\346\263\211}mb\237\255\330g\023\367\331\304\2766\261\317V\354\263\211\373l\210\001\371J\322\336d\3041\013\246\371\264\320\2440\3663U\216BS\260\265X\"i\334\007\r\373z}\222\200\251\366v}\024\020r0\032\360,`H\374~\255,R$\202'\246\260\025y\022\256:#huxp\337Y\373\204\205\207\325\310\272\352\260\201\341\204\331\324\021\021&\366\n1&\321\022-&\311\322\207\303\347{\"\213N\006\"5Oj\211\022!\233B\245\t\354\320>2\026 \3120\202reF*0\302\241.\003\301\310\203/\203L\350\230\240\236\2766\204\366M\200(\353\ne\020b\231\002T\036\233\323S\016hD\360\274\262l\t{\370*\350\220\262\036\003Q"
+	.string	"\372Y\212\263_\345\247\026lf\345t\315\375"
+	.ascii	"\321\201H\005"
+	.text
+	.section	.gnu.lto_.refs.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\024\b\245)"
+	.string	"\212]0\020F\220\234M\206\003\263\335\020\022\n\251\230Y\004(\r\362\177\346rd\252\204\334\302\254\210\023)\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300D\223\344f\274\315:&\374:\336F\345H\342y\235#\2436\303n\003~\3332\277I\3332\005\340"
+	.string	"\377"
+	.string	"\372"
+	.ascii	"\274\2565\316\263\304^@|\253\361\251x}\212\367\277\361\243x\275"
+	.ascii	"7\316\237x\275\211\367L\343\223\274\2564\316\215v_\264\353C\343"
+	.ascii	"\\h\327w\343\\7\316\203v\035h\234\377\214s\237]\277\345\3366"
+	.ascii	"\366\236\240\257\351:\030\324i\271\002-f\232\330+\3763\237\024"
+	.ascii	"&\33493\253CG\316\2336j\302|\t\277Ev\344p\301b\304\354\r1\377"
+	.ascii	":\363\255\302\257\232\235jv\251\371\276\371\275\360\233\300/"
+	.ascii	"q\037\340\366K\363\001\314~4\277\b|\242\333\013\315\037\301\327"
+	.ascii	"\341^\004\377gv\334\355m\363"
+	.string	"k\363;\367\361\r\315\307\331\203\346\003\201/\342\336\347\366\267\371\341\374\236\331is\233\317<\341\317\360\236\271\321\354E\263\023\315\316\003?\b\374\032x\255g\0338\255\333f\017g\347\231\2756\373\234m\355m\271-\206J\214\b\361\241\303\006\r\027\312\247;gfr\336\270i\303f\215\032\247~\032\261\177F$3FL\0300_\232\372\\\262Xy\"\033\023\223B\366\303\312\337\253|\256\362\017\224\237U\376\025\331\t\224oE\366\252\362\251\304>%\376\257\251\367\312w*\237I\354\244\370JM\375\250|\242\362yN}'v\235\370@M/\222\335\247|\034\331o\345\333\310\036\226Oc\372*\035\340\263\244\251\324\347\004\235\231\235qN\3207\216\2331\26100(O\230,Q\362\345\325\225\004\311\021\262\327\b\357;D\374\006\331}\201,\365\372X\372\362P\372\352\230\221b\374\236H\3525\221\004\340\033B\327\373A\367\365"
+	.ascii	"\240\227CP\357\206\\\257\206\334\027\003R\257\005\244o\205\243"
+	.ascii	"^\nF\3753\263\242~\035:D\3755B\177\0312C}1`\204\372^\264d\271"
+	.ascii	"R\245LJ\030X\023^_\3118\337\213\327\271\3069\2027\334\252\027"
+	.ascii	"\274\252\363f\037'\320\3548\220\352v\022\330\215p\267s\263\213"
+	.ascii	"\263\207!\2304\247\315\016\020?\214\022\324\357e\251\337e\351"
+	.ascii	"\347\242\005\213\322\357/KJ\372\247\364&\030T\377\211\357w\322"
+	.ascii	"\3533\351I\375_S\375\256\262oM=\202_\327\372\275\001_\307\362"
+	.ascii	"\375U\257[M\365*\250>@\252KI}\324\257\367~/\300\327\235|\337"
+	.ascii	"\324\353LR\235\374u\245\337'\371:\222\357\217z\275\210\251\023"
+	.ascii	"\375\272\320\357y\276>\372^\327\353\271_\007\362u1\252\377\364"
+	.ascii	":\256\327o\275\336\323\353<P\275\275\005d=W<\365\251\302\251"
+	.ascii	"O\024O?O8\3754Q\202\204\b\020\263O\017\363\347\334\020\302)\347"
+	.ascii	"Ec\206\f\030/]\266dA\372b\241RF6&\005\354\310I\223\262\250$\352"
+	.ascii	"\032:BD\b\322\017\037=t\f}q\030\365\336\260Q\203FQ\357\f\031"
+	.ascii	"D\2751^\f\365\006\217e\256e\2063\002\355\232\330i\342\020\346"
+	.ascii	"\205\361\342\262\313\276+\310\023\342\327D\t\021D\202\311\310"
+	.ascii	"o\206\311\036\373N\220\360\330cs\316P\374\251\314\2765\037k\376"
+	.ascii	"U\370T\363\177b\217\022\037\212\354\275\331\235\346\227\3413"
+	.ascii	"\315N\316G\232\177T\264\313\201\323\300\007\276o\213\365p\261"
+	.ascii	"\347q\300\363P\202\027\342\005\211\237\023\217\362?\207u\334"
+	.ascii	"Qz\317a\017\2227\300\315\303\200\266\355'\275\266\223\276\344"
+	.ascii	"\222"
+	.string	"s\001\317<\261\217\342\353\264\372\217\017\371\270\227\364\033\371!\371`\270\202\333Z\177u\003{\365,\362\261\356\352\005\310\277\272\253\023 \337\212\253G\375\365\002\236\310/\267:\271\365B{=\217\3741\374.\0359\007\"\337'|[\202\347\021\277\306\325\301\255\"8\332\246\365\201^\323\252\201\216\313\232\337\300\007\301\261\300+\002\r\200\305\250\201hgDLDD$H\n\222\202\244\003\300\002\241\241\321v\020\330\223\326\261\331D\352f\026\373\225'\260M\230!\204mN\355\331^G\245\263\031\344q/s4#\3226:\032N*\344~\220\016E\207\237\377\f^\363\311\266\200?zca\212\210\003@C\317\240\313\270\241(\332 \205\2022:\304\346\255\337\374s\263\377q\314\032\372\024\021\330X5v\243\202\331\030'\367\277&\323\"\315\254q\007\223\025\250\f\211R\333\264\252\223\214\0239L\036\234*}\215\bg<\310*v"
+	.ascii	"~\001!\020\037\f\301\017D\267\26289\271\004\324\31590U\351fC"
+	.ascii	"\004\354\222\346\340\301\b:\321\374\233\3608\205cJ^\037j\221"
+	.ascii	"\r\342\247\336\312\3656B\301\210\023|r\234>F\t\217\241ss\"Zu"
+	.ascii	"Z\301\232\341\r'\201\314\350\226\034yh?\322\221G\265\364<\212"
+	.ascii	"\345D\r\203d\030\204\230]\306\021\020\376\024=&\035\006pn\203"
+	.ascii	"d\320:\3355\310\343\002\b\346\226\2032\305\320\264J\306\252\342"
+	.ascii	"\nZ\034\206\251.^i"
+	.text
+	.section	.gnu.lto_.decls.744964afaf894f24,"e",@progbits
+	.string	"(\265/\375`\344\234}\204\002^\034\004F\016S\0200e\3514\006z\271\326 :|\335S\272t|\222\355!\355Fmd?j\334\370\210\316\376x\001;\305T[E\252\345\243\207#"
+	.string	"\nQ\253o83\361\315\307y\n\f\362^{\221\026?\313\351\361&,\203 \b\272\337y\030\2727\331r\357-\267\224)0\fJ\016\306\016O\323\350\247c\364S:m\3260m\334\344\263\2307\272\334\220\272p~\372\246Y\354\275\367}\0264}\026\364)\233~j\246M\031f\324Mv0\245v\356\027%\031X8?u\242O\260o\007\364}\267\003\3724\211~JD\337\356\372\240O\201\350\247\\\372i\016\375\324J?u\322 \354\351\022w\372(\2356\367/\334\007v\005\032\270H\351\3009\204\237\343>\024\f\313\01678\037u\323G\317\364\3210\375\345\365AC\\\037\364\274=\350\365\256\017z\024\2511\233U\331\005n\006\316G\271\364\261\2142]f~"
+	.string	"A\203\361\242\bY\246\301K\274\006\253\301gn\022\243\271\013\202D\203{\374\320\261\\\303%\314\0250\037\265\322Gi\350\2431\364Q$\375SOc;5\fiO\n\316?\357\364\f\270\r\323\231dR\022\370\321dI\245\n\023$\233\030/18\f\256\303_0\230\233\3043\3748\nF[R\013C\316\200\327\304\200!1\036\216-v\300\374\343+\307t?\226\202\247\3409\254UA\016\036\0205ip\306^:`\032l\246\2268\377\204\323'A\313\231\0378\274\345\354\215\033\036R\016\277a.\270\013\216\273I\f\367\254\334\3072\262\\8\035$\236\255\004F\017S\371\177\3400\226\013w\347\2526\022\232\021\274H\341a\351\330\3301\306"
+	.ascii	"\363O\245\376\031\246\177\"\365\317\037\372g\226\306V~\216\257"
+	.ascii	"\364\240RU\312\215\266\367\336\301N|8\005\301\031\275=\350O)"
+	.ascii	"\375\363\205~\216\243\237\323\350\347/\272\303\365AM\345\365"
+	.ascii	"AK\274is\356\372\240\n\300P\316t\360\312\356\220p6[\022\344\207"
+	.ascii	"\033\316O:\234`\310\263\0338?S\321MN\270F\211&)5\352\211\220"
+	.ascii	"\345Z\225\016$\266A\005\004\211m\334\350\312\302Zn$\314T\242"
+	.ascii	"IJ"
+	.string	"\225QWd\271\003\3630\311\244\264\224:\031ZU]\230H\211&)\225\206R\f\334\344\342fJ4I\251MuC\252\344\270Bb\033V9\356\331\027\306\201\261J4I\2511\352\262\360\306_\330\b\027\330R\007\016\234\004;\301a\270\f\217a%&\303K\260\022,\206\3010\022\334\004'\361\021\314\344&\361\027.r\354\205\221\357\200\277p\017\f\344\316\241\355\244\031\032\030a\253\023\323\333[\251S6\004J\311A~\346\241\321}}\320\317\335\036\364\231J\377\230\310\0204\2622d\224\371\210\2305\257\233\304Bp\020\345\356\200\212\325\001\341\202\363s\223\276\331\347\003\377\330i\003\265&\f\3167\327`\037g0\027\020\311\214\250\"8\337\244\303[\346\233\276\311\246o>\3217\225\350\233D\364\217\261\360\025\322\253\314\f\316s;\3008M\352v\340|\223\207\276I\245o\302\320\307p\364\361R\2030\003\323\230\312LW\256"
+	.ascii	"q\233\361)\364\213\223\r\005\347\037K\035O\355\020Q\243\343\201"
+	.ascii	"3~\201\243\372\324\342\262\340\214a\340\0307\t\002?\035Ca\031"
+	.ascii	"?\223\224[\271\267r\007\013\201\223\366\004g\236\353\203\342"
+	.ascii	"\333\203\036\253\351_\020\250\331\327wA\240g\243\256nA\270\272"
+	.ascii	"\340|\374D\037#\321W\336\036\024/i\252\036Ifp>\316\241\177\223"
+	.ascii	"X\t'\375\340\024\351\242\207\363\377\343\244\343\001\367\207"
+	.ascii	"\234/3\306l\234\217\247\364\331\372\340p\235\334\223R\0348&\f"
+	.ascii	"'k\326pV\002\243\242\204h\361]9\237pa\222\264w\301\216\362\006"
+	.ascii	"\024\017\234\377\373&\357r\211\363\203\r\347_*\377\255\302v\263"
+	.ascii	"L\351\021\325\305K\214\245\335\336\177\313\\5\327\315\305\273"
+	.ascii	"l\256\336Es\323\3345\367\3145s\227\267\315M\336\274;\346\227"
+	.ascii	"\314\275{V\356\275\264\367\376\215\223\203ZV\231\341\314I\204"
+	.ascii	")7M\007I\271\243\320\036UQzz\267\n\335\331\013\2619\030\3135"
+	.ascii	"1\267Ng\211g/q\361!\251\200\271u&\231\224\216\362$\216\226\377"
+	.ascii	"Vq\273p\246\022\231F\351!c\271\267\362W\354\377\371\315\273a"
+	.ascii	"n\235\316\222rO\245O\340D\351\351\355\255<\t\377=\373C \341\346"
+	.ascii	"](7\315T\"\267R\335\f\001p\305\211j\323\333[)B\204\210\016\""
+	.ascii	"vd\244Yb\365!c\255\353\203zp{\320\3370\372\327\213\376\325\242"
+	.ascii	"\177\245\350_&\372WH\210\373E]R\356\250a\324d\241m\351_+\375"
+	.ascii	"KC\3772\351\243]\037\364G\372l\327\007\275[\356\333M^p\271(w"
+	.ascii	"r\342\204\305\331\303\371E\372\367\002\364\366\335\013\320o@"
+	.ascii	"\177\313\365A/\026\fg\306W\036\316\227\200\276m\327\312M\336"
+	.ascii	"+\377U\273k\317eZ\333loe\216\231tCn\r\347\337\020\350N___\337"
+	.ascii	"\r\201\376\004\255\301\365A\363\355Ayn\017\372\271\353\203\276"
+	.ascii	"\004}\323\360E\273R~\323n\224\207@\302\201K;\271\267\362\246"
+	.ascii	"\345\275\223\356\335@\347\336\r\316,D\222\236\240\371 \350{\240"
+	.ascii	"5\270=\350\177\315B\344\270\t"
+	.string	"\243\004\206\363o\322\311\025\273e\246\323\223\326F\333[\251\341\001J\256\356p\276\312K\366[v\307\036\002\t7\221\312vr\357}\313F\320\332;\351\226\355\360\355\235\264s\357\006\367n\220\231pyIA\3633\320W^\037T\337\036t-\333$\034\353\274G\207\367/(\254\356\341WE0\327\314\244\2560\314P\200\310/~\301\257\366\340\reP\f\3747\354\277`\377]\362_\265\3776y\032\364\002\377\333\234>\250\005\376S\007\205\001\315\n\266\340\334\360_\023'\007\024E\013?\252\302\177\346\235\350\327\027\205\300oZ\231X3\200?\035\363\373\247L\377\360\337\257\323\026\377\342t\f~U\205\372Q\0231\3144g\031'U\303\177z\340?u\374K\006\301A\344V\213\371\3151\024\203'\250{\003\013\241\310H\252\231\215&\224\371\002}\300\360|\271E\212q\240&`\\\235\026\314\262\033\037\341O\221\376\f\202\377\224"
+	.string	"Z\302\215\247\277^\373O\032_g\215\037E\341?\253\320\023\376\373\363_\0209\005j\302\r@\006\322Q2\225\371%\364\347\020\320\017L\030\317\033\376x\351\352\240\016\3703\t\331\004\020\037r\003D\374\372\004\330\3517\215?~\302\033\256\240\r\370\321\003\240%\376\313\201\377n\340\277\301\377\252\370\357\007\376\313\376f\f\377\035\372\261\217\037o\375X\307\217\271~\f\344\307C~\334\365c!\277I\374\261\021l\206\307\304\360\331\217\321~<\345\307iU~3\004?ncc\002M\215\206\317Lq\234\037\277\371\315\337\217\032"
+	.string	"-\341\307z?J\302\177\006\177t\204\337<\177\334\367\3436?\336\373\361\3627\363\217\323\374\246\372\233\305\337\334\371s\002L\017\346\207\037\017\177\363\202\3374\372M\017\376S\350?YT\204\337,\361\233\016\370\315\005\374\030\207\231"
+	.ascii	"\023\277i\200\337T\3417\213~3\002\277y\3427a\370M\242\337\314"
+	.ascii	"\300\237\017\200\013`\006M\341\217=`\2460\333\337\034\372M\020"
+	.ascii	"\034I \263r\r\374o\341 :\374\027\300\0074\2043\350\317\246\b"
+	.ascii	"\312_\013\375\377\2209p\035\366\237\027\374\350\317\177b\360"
+	.ascii	"\243 \374X\004?\226\341\307#"
+	.string	"\370q\t~\334\342\307$\3701\213?\207\200~\360c\020\374\230\375\261\212\037\007\177,\204\2010\n\023\006\236"
+	.string	"f\001\233\360c\025~\f\201\037\233\370\361\t?F\001;\3407\257\240$2Z\200\037?\340\307)\344\016?J\200\377\354"
+	.string	"\035\361\237\"\374\250\210s\204\037\035\300\217Cx\234\r\374\027\300\007\016\346\026\032\342GAd\023\205\251\345\201?5\341G=\370\277\341d&\026\365O\273`\320\277\026\322"
+	.ascii	"S\007\312\001>\217\246\177\374'\217\337\214\202n\360\343\002"
+	.ascii	"\234\357\307\t\004\325\340?\213\240\031\374&\2151\024\003\364"
+	.ascii	"\202\262\377\232\375\367\311\177\255\374\027\312\335\177.A?\374"
+	.ascii	"W\203\002\340\317yX\3507\231\240\026\374o\203z\310\025\310K\246"
+	.ascii	"[\276\372\037\347T\242\035\376\\\205V\360g\006\240\024\374\247"
+	.ascii	"\031\352\363\237\311\337\224\202r\370\317!\377i\004\3559\221"
+	.ascii	"\374f\024\032\210\034\004\335\360g\252\037\315\371Q\365?\363"
+	.ascii	"r\217?\303p\343&\370\325\006\374f\237\251\006\247\346Z\256\300"
+	.ascii	"\177\340\257\271\362\317'\324\274&\276\376i\237N\b\260\371\337"
+	.ascii	"\342\177\333\037\347\030Q|\211l\377=\272g\356\301\237\302\375"
+	.ascii	"\246\230\037\275\350\377[\367_\272\377\316\375\327\313\177\277"
+	.ascii	"\374\227\314\177\301\374\227\353\277W\377\355\361_\257\377\356"
+	.ascii	"\370\357\t\376\273\365_\037\377%\362_\035\377\025\362_\036\377"
+	.ascii	"\315\361\337!\377\355\372/\326\177\245\376\013\344j\335\037\377"
+	.ascii	"\315\nr\327\376k\344\277e\376\353\366\237}\377\231\207v\022\177"
+	.ascii	"\232\305\314\3775\346\334\3778\347\032\273\264\355?\177\252\271"
+	.ascii	"&\3164(\016\347:\177\372\3447\323\234e~\377y\367\233^d\376\363"
+	.ascii	"\034\203fy\020_\256\301\237\212\371\315\272\363h\367\233\373"
+	.ascii	"?\305\374\346\233\337\334;\303\374f\322o2\235\317ls\202\371\317"
+	.ascii	"\021\374f\327\f?\346\3602\246\333Y\367\237M?~\341\313\3773\377"
+	.ascii	"\363\336\346?\227\323\350\177\005\377Q\374\377p\020\231\002\377"
+	.ascii	"\031\360k\035\377\365\376c\371\217\346\277\232\377\313\274\367"
+	.ascii	"g\276\377\244\373_\206\3129\367\3476\247\227\377\037\376\203"
+	.ascii	"\370\315\031\367\371S#?\316\371\361\316\217{~\254\341\307\033"
+	.ascii	"~\314\363\343\365\307:?\346\360\347\262\037\237\377=\363\337"
+	.ascii	"8\377}\363_6\377w~\325\305\237\303\374\231\314\237\307\374Y\314"
+	.ascii	"\237\353\376\f\346\317v\177.\363\233g\316.\177n\373\363\227?"
+	.ascii	"\323\375\371\311\177\312\375\347\371U\270\337l\363\237q\377\t"
+	.ascii	"\367\302\177\272\375\247\226\377\264\362\237m?\366\340\307\032"
+	.ascii	"\374\270\203\037"
+	.string	"s\360\233y\377Y\345?\251\374'\332\177F\371\277\341O\321\374\246\220\343_w\340?\317\376\223\354?\235\374'\330\177\036\371O\257\377\354\372\317\036\377\271\343?u\374g\326\177^\375\247\325\177\326\370O\250\377t\361\237$\370\317\243\377\034\372\317\340\177N\340?M\374\347\b\377\351\301\177j\360\237\030\374'\005\377\271\363\237\353\177\242\377y\377\314\367g\275?\257\371s\232?\237\371\263\231??\371\363\327\237\221\177&\362g\363\317A\376\374\343\317[\177\326\361\347\253?[\375y\306\237\245\376\274\364g\247?C\3759\306\237_\374\231\351\317H\177>\301\237I\360\347\026\177\226\341\317G\277\251\374s\373g\020\374Y\350\317@\177\346\300\237a\370\363\211?W\3407\373~S\315\237)\360g\026\376,\201?\257\360\347\024\376\374\200?\243\360g\023\376\334\200?'\340\317\007\370\263\001\376L\302\237E\3703\b\177&\361g\002\374y"
+	.ascii	"\177\026\300\237=\3703\007\177\326\340\317\030\374\371\303\237"
+	.ascii	"=\374\231\303\2375\374Y\347\317\353oj\3759\375\363\371\347\377"
+	.ascii	"&\337o\352\375\346\232\337<\363\233f~\223\314o\332\375f\335o"
+	.ascii	"\322\375&\227\337\334\362\233X~\363\351\3078\376\267\360_\024"
+	.ascii	"~\223\3517\327~S\3557\251\374\246\224\337\214\362\233f\277Y\366"
+	.ascii	"c\017\374\370\003?\216\3417\233\374\030\3507\227\374&\222\337"
+	.ascii	"\374\372M\257\337\024\362\337\016\376\013\342\277=\277\331\365"
+	.ascii	"\233>~\223\307on\375\246\325\177u\376\177\371\315\033\377\311"
+	.ascii	"\376\243\375\347\373\315\031\377\271\374\367\306o\326\370M\251"
+	.ascii	"\337\224\361\233P\277\031\3437a\374\346\213\377,\374\327\304"
+	.ascii	"o:\375\246\213\337l\372\315\025\277y\364\233\307\037\233\340"
+	.ascii	"\307D?F\361\343\023?f\341\307+\374?\361c\021~L\342\307\005\370"
+	.ascii	"1\001~<\342\307\"~\034\342\307>\377]\376\027\357\277f\376\213"
+	.ascii	"\345\277\017\370\037\347?\234\377{\377\337\374w\363\377\311\377"
+	.ascii	"\262\377Q\376\303\375\027@___\337_\201\003~\n\206\277\321\210"
+	.ascii	"`^\340l\304H\372\225\245\203Fy\344&\323\257\263\211\025%\025"
+	.ascii	"\334\177\365\344\312+\263\206\363)\bB\344)\362O\213\244^?\034"
+	.ascii	"v2v\340|\355\256\017z\301\355A3\214\237\247DN%7\254\210\bI\246"
+	.ascii	"B\362\225\020\312\215\324\341\213\r\017KoKU\215\220\300S\233"
+	.ascii	"7\234OA\226\006\222v\351\344\305`\343\206\363)p\322@|$S\037\350"
+	.ascii	"\235\352\2647\215\365M\211\207\245G\301\326\177\312\343i\217"
+	.ascii	"\243NK[Hp\306n~\236\3620\355\246\332l\\\245;\322\255\374\305"
+	.ascii	"\263\277l\225G\333\330rKI\215\270\217\033\375\024+\315z\232\343"
+	.ascii	"i\216T\353<{o\245\275s`\375\250\244\360\260\364v\225T\210?\325"
+	.ascii	"\361T\353\246\341\2712p\272\340|6\267\354\277\212\361\342\264"
+	.ascii	"p\341|\2371\372\277\307?\272\223\244\366\3363N\345\226R\002\242"
+	.ascii	"\377\375=\357\r\361\347\\\363r\360?\233\377\006\202\366f\222"
+	.ascii	"\233\333{\3375\372k-\351J\203}\316\355\275\264\205\344\200\255"
+	.ascii	"\251\245-*'\263\255)\rNf[\033i\251\b\222\006\251\275\205\344"
+	.ascii	"d\266\267\206\245%$\023ZSNfI[\203\223\331\236\332L_\246\356V"
+	.ascii	"n!\355%\255\255a/\355\244m\2465\245\201\323\322\326\224\223Y"
+	.ascii	"\322\224\006'\263\255\251m\266\265y\366R\222\324\213\245-\245"
+	.ascii	"a\233m\241\331fZS<NfZSNf[p\267\n\006\236\025\033qsB\300.\231"
+	.ascii	"\323\322\226\001\205\225$\3053\347\244\324\332v{_\264\246-\265"
+	.ascii	"\347\366\346`o,-)\273$\252\313\2464'C\211J\222\326U\356\275="
+	.ascii	"@)qi\355\2459\244\273\347\234\220h\355\215DihC\355\275\367\b"
+	.ascii	"H\312\271\335u\347\220x`\355\247\246\275-\330\312\275\241\366"
+	.ascii	"F\272{n\357\215\264\367N\245\260\224{\343\340qBBA\355]\325\001"
+	.ascii	"jc!\2655\355\215\321\310\260M9\231qi\375\264A1Cn\027J\244\353"
+	.ascii	"\364\244\265\221\333nKJ\233!\221\355\247\275\367U\243\221S4\322"
+	.ascii	"\340|\237&\372O\255\236\342\370-K\251\314\235\231\3029\255\372"
+	.ascii	"yj\245\245d\t\027\316\025\334\0364\275\001L\272\241Fw\304F\215"
+	.ascii	"\033fl\220\341\264FJ#')\273\356\322\031{f2^\340|\237\037\372"
+	.ascii	"O\247R\251T*\215\332\223\001\325\002\f\030x}O\241\260\326\336"
+	.ascii	"h^7\262\340=yh\323\341#\306\255\323ixs1`\230T\330K\206\027\233"
+	.ascii	"\027\330G\352\324!\347\216O\256K\352\"m\262a\347\345\004\347"
+	.ascii	"\224\351\371\355RQn\360\365\226\205\363}j\350\377i\022\032'U"
+	.ascii	"B\373R\244t\337d\272\204\362\271\201\203\204\203\215\230SJ{\351"
+	.ascii	"\022\272\367\346\r\037R)]B\365\306\276\210\351`\305\352L\027"
+	.ascii	"\235|\0163\350sh\323\347`\246\317\341\210>\007-}\016/\364\217"
+	.ascii	"\266\311Mh\336\343\334\222\220!\341\374\243"
+	.ascii	"l\320\27350\222\254\340\214\336\241p\350\030&\350\335\331tB\311"
+	.ascii	"IA\357\316$\247\2251\364\016\235B{ \345\234\240wg\026T\352\316"
+	.ascii	"\241e91d\324y\244\304\214\255\362\220CC\357P \350\224\0223\266"
+	.ascii	"\n&\227\\\242wh\025\224K\211\031\373Z!\345\232,\321\273S\006"
+	.ascii	"\036Sb\306V\201\310\245\221A\325\240e\3203h\032t\211\242A\361"
+	.ascii	"P3\350\232\233D\357\320\2733\351d\372\240\264wR\326\372\206\304"
+	.ascii	"\303\322\333{{\020\261f\231\341 CAF\355\246\334x1\205\363{\336"
+	.ascii	"h/T\272\244-\321\270[7\005I'\226\034Cf'hH1(\030t\016\r\203~A"
+	.ascii	"\353\320\031n\022\245;\035*w\347\266<\331\343\311\357\261\323"
+	.ascii	"\357\311\242\337\023E\277\347K\277g\210F\337:\244^fn\354\341"
+	.ascii	"\374\236,}\223i\r\016U\223\373\342\262l\313J\266\264\275!\333"
+	.ascii	"\320 qm([\027+\250\033z\005\335\202jA\261\240Yn\022m\373o\025"
+	.ascii	"\224\n\225\237\232\244\2305\236\374\236\033\372=I\372\033\226"
+	.ascii	"\372\033\306\350\273\257\017\212J!\203\326\246\013\347o\330\242"
+	.ascii	"\177\265|\271\341\241^o\226\250\031z\206>A\223\350\030\332\004"
+	.ascii	"e\202\226\241h(\024\324\t\252D\323P0T\f\rC\311n\022\215\362\243"
+	.ascii	">\320\037U\220n\220z]/l,\201\261\274gA\234\212\354-\263\0222"
+	.ascii	"G\316,\317f\270\305I\342V\246\212\0217\275\345\336;\n*\304\255"
+	.ascii	"o\b\034$\021\276\237(\250\022\267;\344\336;\n\212\304\315\314"
+	.ascii	"\345\222\201%\314\203\374\rW\3647\244\351o0\323\337\320D\177"
+	.ascii	"\003R\177C\227\376\206-\375\rW\372\033\232\3645\344\351k\b\243"
+	.ascii	"\257A\213\276\2064}\rg\372\032\230\350k0\242M\255\353\203\216"
+	.ascii	"p{P\224\007N\223\007\206\004\347k\330\322\277Tn\310\241W\250"
+	.ascii	"\016\024\007\232\205\346@\271P,T\013\335q\223\350\326\263\022"
+	.ascii	".\313*\270\031c\220{+\253\330\270u]\2205\274,\251\342\226Vd\266"
+	.ascii	"P\032vX\352\251\f\026\016\371\032\246\3645\270\320\347\211\243"
+	.ascii	"\317\303F\237\247\214>O\235>\317\026}\2364}\2362\215F\r5\305"
+	.ascii	"\321\300\371<J\364\331\\\3302n\fV\034t\351\\s\2629\361\320}\276"
+	.ascii	"A]\2401\320\246\323\r\252t.Q\031\247\231\223\357<s\242A\231N"
+	.ascii	"\275\263\r\n\343Ts\346\241I\347\036\n\205\2768\323\234pP\247"
+	.ascii	"\263\017E\272I\364\351?\257\234X\236\225{/5\235b\310.\344\017"
+	.ascii	"\231\253\254\246j\215\313\330\362\214s\202\334{g8\223j\b\022"
+	.ascii	"\357S\313yU\305F\227\267&\246\213\034\3107\031M&\2144d^\203\243"
+	.ascii	"\242\220x\243Og\23175\245\377'\247\261B\236}\361B\356\275\177"
+	.ascii	"\354\262\336\336\320\226rI\344\foB\300\004A\212\321\201\233\320"
+	.ascii	"'\034\307\304\272sU\371m\n\336nT\220{\3570@\220w9\216\b\266\341"
+	.ascii	"\205I\235IU\004\271\367nB\237\316-R\320\247\223\356\326\201u"
+	.ascii	"P\211\304\t\223a\"\237\307K\237'\210>\217\017}\236-}\036,}\036"
+	.ascii	"*}\236(}\036'}\236$\375\235=\375\235<\375\0354\372;e\364w\304"
+	.ascii	"\350\357|\321\337\221\323\337\321\242\277\243\246\277\223\246"
+	.ascii	"\277C\246\277\303D\177\347\210\376\216\020\375\235\037\372\214"
+	.ascii	"\273=\350\331V\004Lo\n\347\357T\351\237s\312\t\006\227c\031\226"
+	.ascii	"\205\234r2\301:\247d%pWS\316&\247\224\0223\266\272\204\323A\345"
+	.ascii	"d;\327N"
+	.string	"\265\263\312M\236S\376\363\353D\362\234d\244-\txJ\371O%\347\2223M\335\221w\307\004\347\023\3557&\346\314\n\347\357 \351\3437Y{H1<d\216\2677d\347\2233\312yv*\317\262s\354\204r\223\247\031\223\331\033\237\f\274E\017\271\267\322\354\2442\251\356\034\232\21178\310\344\233\033\244\331\351\344\355\314E\232\302\226\264!_\007\216\276\216\236\276\316R_\307N_\347\213\276\216\026}\035*\272\303\276>\250\271\317t\007\247\333\203\236Fh\354\365\020\202\363u\302\364E(\222\225\320\030\262$r\n9\207\234^'\362&\317\"E\316\032g\220\0223\266\212\204\363zS\344\234A\004y\026\301q\314]\242i\337\275\006\256\310r\357\235\335l\341\002\007\230\377\363\306\317 \377)uN\235]X\353lJ\311\022\234O \3003)X|\340|\235 \372\334\201\267\300EQ\311@\236;N\254\363\352\316\001q"
+	.string	"\034\024R\004\354\366\002)#\307\205+\321\264Y\254\201\213\221eN\225h\332,\226pO\347\217\323\307\331\343\334:\271N\255\223\307M\236;H\330q\352\200\201\334[\251B\301rF\rO\276N\017}\235\035\372:X\372:T\372\254:\255n\322\303\211#\r\020\245)\234\257\023\245M\260\367\365\200\336\276\276\353\001\275\316\013}\332\370\371y\343\204\241\225\026\005\347\001\334\036\364:L\3729p\364s\362t\006\312\353\203\232zi\364s\314\350\363i\225\352\323Z\342\374\0340\372\"\270P"
+	.ascii	"\\\023\344\371\342\214q\223'\214\237\204\377\347\204q:]\270u"
+	.ascii	"\211\022\017\013LUr\005\215\007\232\237\343E?\347M?'\213\376"
+	.ascii	"\317\245\237L\377\271O\244\013w&\303\310\334p>\225~~.\2550\342"
+	.ascii	"\274\312\340l\366\255i\r\366\365A\363\356k\203~A\211\243B\203"
+	.ascii	"\003)C\215\f\344\233%\026\036\220e\232\2526y\315\323\322d\312"
+	.ascii	"m\362\231/\272;.{Y/\363\3458\371M\206\223\335\334dn\223\331<"
+	.ascii	"\347\33583o\314\312\222'\377n\017\372\234.\375\034\036\37299"
+	.ascii	"\364sp\350\347\324\320\317y\322\317Y\322\007\302\321\1776\223"
+	.ascii	"\307\274\001\353\342\205s\036\223\271\344\031L2\251\b\324\221"
+	.ascii	"Yj1\203\334rg\227\305\344\273\034&\223\311en2\217\311`\362\332"
+	.ascii	"\230\334\344\314\022L\t\017\231\307d\267'eD\344p\301\231\023"
+	.ascii	"\323\311\007\336\325\335\256)R\262\340|\240\234\376\237\347\262"
+	.ascii	"\227Lw\223\371K\226{~\273T\236E\210\213\023\353bRuA\256\345/"
+	.ascii	"\031\316\244\342\222\333\035D\210\020\001\274\222L\223\245\363"
+	.ascii	"\201n\372\3004}\340\231>\220L\037\350D\003o\017z`\022}`\227>"
+	.ascii	"\020K\3779\313}\222s\005e\253\f\226+:`TY\320\330\236\257\374"
+	.ascii	"\271-[\271eP\316\222f\300\371\002\271>\250\317\332\3173[\034"
+	.ascii	"-2\272p\346\240VE\225K\262\341Qy\256\362\013\367\001*A\304x\340"
+	.ascii	"\234\247\374<S\311\331\362c\211s\006R\224f\310\200\325\341\374"
+	.ascii	"\273\266d\310\322I\016\021\302\202\254%u\210)\271uw\016\315D"
+	.ascii	"\033\221\254\314`8\252\004\214}\267^\233\020&&\325\232\266\256"
+	.ascii	"%\025eNr\353J\314\330\327I\257\255\21027\271p\037\224\366\316"
+	.ascii	"\221\365\263\261\361\260\364\312\362YN\313f9J~\222\3112\224\214"
+	.ascii	"v\223Y\231\305~\317\362\330\363\211\244Z\302\206C\306\373\372"
+	.ascii	"\240\007\312\320\0072\351\257{\372\353\032\375u\214\376Z\247"
+	.ascii	"\277v\321_\331\364\327)\372+\024\375g$\371\013\310%5\246\207"
+	.ascii	"\221\347\257?\037\301z\267\f\b\367V\267\207\363\316\355A3\362"
+	.ascii	"\347\331\210\356\353\273\322\205\263\216W^\221\233\2266\321\302"
+	.ascii	"\205F\244/\017\311Wv\310\2548!9\bV\013\003k\222\353\260\226\024"
+	.ascii	"\n\206mI\016\347?w\001I\227\324\220b\2073\220?S\345\252\374\003"
+	.ascii	"\270n:3*\234}\264Y\353\302\207\363W0\255\225\257J4I\2510\270"
+	.ascii	"\314"
+	.ascii	",\177\266\256\227\273\237\255\214E\246G\336\221yd\256\233\314"
+	.ascii	"[9\3539G\326\361\016y+[\345\253\017JN;i\313\003'J<,=\234\245"
+	.ascii	"\n\234,\277\374\025\211\276\312\353\203v\360\241\277j\351?_\341"
+	.ascii	"hR\303\307\020\245\332\266\227\304\006\316_\261t\252\274>\350"
+	.ascii	"\365\362\215\f\225\346\226\364\202\363E\310L\331\tlM\235\030"
+	.ascii	"\322M\322dc\352q9\241b\2761\341\3245\351\242fl\231\223\362\222"
+	.ascii	"R\3302C\231i\270\320\262\214,\225k\344\031\231F\236\312O9*\333"
+	.ascii	"\270\311\f\225_<\303\31012\224\031'#\255\\Lp\236\221*;8\344;"
+	.ascii	"w}\320\017\267\007\375*\225]p!\321\312\302\371kRnr\243\263\222"
+	.ascii	"&r\026\007\005O\377\007\246/o!$ieY\372\244\354\231|\347\foQ\262"
+	.ascii	"$\367\276\364\177Yf\033\267 h\250p\376oJ\347\375\222\364U2\372"
+	.ascii	"\352\233\276*E\377&\032si.\317\200\320KW\246$q\376M<\263\214"
+	.ascii	"\r\250&L8\337d*cj1\267\230f\310\b\374\3503c\336\335\244Y\346"
+	.ascii	"\246\2359\306$\363\253\334NKe\31473\214i\206\214\200\2138\253"
+	.ascii	"\233\230\036\026\232\263\324\365A_v{P\365'\327\306\n\211\363"
+	.ascii	"\325'\332\004\003FI\362\r\316W\301\264\027\263\313\031\231\245"
+	.ascii	"\\\027*\\\300\214\201\263C\356\2554\275\230q3\230_L:s\316\254"
+	.ascii	"\273I\323K\2073/J\0234`\276jD_\375\241\257f\351\2534\364\325"
+	.ascii	"'}\225I\233n\036\322\275\266<7\372\032\215\376\315,m<\356\232"
+	.ascii	"\340l\252\3414<\306$\223\212@\2247KS\315\0243\243\230Jd\004~"
+	.ascii	"\340-\325L4\263\212\031S\r\223\301yKQ\334\230j\270\215yDg\211"
+	.ascii	"g\357\037z\310\275\267\251f~\231IS\311\026\201(g\226{\357\377"
+	.ascii	"&\026\263\315d3\327\314+\246\225\2334\325<\250UAn\b\321\311&"
+	.ascii	"\025>,cKp\276\236A\237\204\261\276)f\332M\232R~\225\246\024S"
+	.ascii	"\031\007\271\267RD\007\021;U=\204\270@\3635\2346\241\344PA\323"
+	.ascii	"\202\204\363\365\232>\tcO\312\030e&\031\324\362\211yf\232\335"
+	.ascii	"\244Y\366\233N0\225_#nr\370\320\371Z\212\276&\323\327M\364\365"
+	.ascii	"\2276o\017j6\331\241C\306]\341|\355C\377\256)\271B\"\301\261"
+	.ascii	"\304Lb\205db\206\231`7i.\371\261\025\223\351X\204\b\021\0352"
+	.ascii	"\220/LKt\276\316\241\257m\350k(}\275\244M#\346\224!TLp~\332F"
+	.ascii	"c8^L\036\246\017\023in\231\\\346\017\263\210\251e\0161{\230:"
+	.ascii	"L\"f\0203\313\3542w\230@\314\034\246\220\2334\275n*-\301-\177"
+	.ascii	"`\250!]\340(\235$\236\275\344\342\r\307\330ro\345\217\371Te9"
+	.ascii	"c\312\262*\r\231\024\207\334\303|vN[\226{+o\025\323\013c1\261"
+	.ascii	"t\220x\366\3761\346vA\222C\306\3418\346\326A\342\331K.\272 \367"
+	.ascii	"\336\246\227I\303\244\372!\005\271\367\276\311\364\337*M\\L/"
+	.ascii	"\363\005\2162\225l\332E\2245,\303\nmiz\231P\346\224\013*\313"
+	.ascii	"\275\267\210\016:\360\244\226!\362o^\335\304\372\261\033\374"
+	.ascii	"\346\302}\340\316p\333\362\302\371\252\375\334\274\312<\362\242"
+	.ascii	"\216\340\034d\204\024\021\263c\207\312w\3130\250\363Bn\311\203"
+	.ascii	"\241\306"
+	.string	"\t\347\017 n\325\261\352\370y\201\201\324\361\332!#\315ZV\326\217J\007-\2446\277\031PB\266\350!\221\325@\202\363\007\320\265^\255W\272n\003_\304\350i\034g^\240\340\374\001(\2557\326\033\253\325\t\255\263KJ\330Z\365\325*#1\311\301\301y\245\332\271\203BZa \351\f7\266)\234\037\202\315\032\265F\2555\344\276\210\321\323\313\251\361\244\b\220\225\306\327\032L>\2249p^gh:\354\005dm\211\363:\245\351\316\"rgt\340\274J\245`\350R\335\331[\n\246sEn+\254n}\261\276X\241\256\260\325\211\255vjg@\326\247\257P9l7\202\250\2551\200J\244\215\267\306Xa\250i\312\334-\351(]!\177\340\374\020Q\342|\335qV\027f\230\275\225,\006\031\035\316\377\252\364\325\305\327\246\020H\270\0310%a\222p^\231\256S%ge\211\363\327\245\337W\017\263%8\277"
+	.string	"\272\354\306\324\024\316k\022\0223Ohp^\221\236\005X%F\357G\237\262M\233\037_\007-$5\004\310\222F\214\036\220\213\r\323\230\336\177|\277=>+;\312\336\357\315\034\227\033[)\223\0074.SnP>"
+	.string	"\230q\252\202\363\331"
+	.ascii	"\253\320A\251\202\363C\b!\363\223\371\261\351\240\205\204F\001"
+	.ascii	"oG\304\350\351\231byW\272\254\371\217\215\246S\203\204=%\301"
+	.ascii	"\371\267\374\251i\303\303\313\027\316\2774\327,J\327\036\316"
+	.ascii	"\017Q\343\207\346;g\355\301\206\226\204\363\357L\032d=\343\241"
+	.ascii	"\366\205\363\017\017\327\350\"\303\304\t\347\237\231\233\311"
+	.ascii	"K<\214\300\341\374+s\353v\2229\254\274\341\374\273\303@\356\036"
+	.ascii	"[\230\027\230\007\224.0b8?\004\023\035\335\317n\ne\252\303\252"
+	.ascii	"\"\346?;7\246\037S\302\374WO\272\262#q\2770?0y^Q\372p\376}\371"
+	.ascii	"\325\335\344\343~3<\207\201\301\205\205\363A\354\351\023\354"
+	.ascii	"8\364 \326\250\375\027\367S\373y\311Z\366n\272e;Jj;a\205\320"
+	.ascii	"i\363\226w\343\327\345?/k;\354\254~\340\374\223\373\232\032\231"
+	.ascii	"\235\020\270\034\035H_Kp\376a\371\275\375\270\374*\312\365&\t"
+	.ascii	"\n\347\2038\243\377\333rf\254\210\035\316?7\335\004\342\013\210"
+	.ascii	"\034C\212\236\231\226\377\334\216u\204G\017\234\177Y~\376\323"
+	.ascii	"b\005\267C\b\316\353\355A\177l?+\277+\277j\352\300\232\001\005"
+	.ascii	"\347\203h\323\377\265\205)A\2623C\rl\357=\302\275\202&!\255\321"
+	.ascii	"\201\363oM\235\341\302\213\r\347\233Q\\Ll8\037\004\025(\377I"
+	.ascii	"\201\362\243\202\227\300\215T\266\243~cOo\364\300\266\023V\210"
+	.ascii	"S\b\0271\033\277)\377QY"
+	.string	"\273Q\310\320]\301\371l\276\226D-L\n\316\277\264T\f\030\2702\234\177h\347\025\215;$Q~\025\b$\256K\032\234\017\342\206>\b)%\377\201)\371\231\231uW\271\253\264\220\320\034`\211N\2143[=\306\3763\373\357I\b$\334\f\321\007\024(8\377\312\310~J\261\233\301PV\222d\341\374s\3623T\310\200`%\273p\325)\341\374\013\3731\271\311\303\375\232\\\271\243c\305E\032\034\316\007\361B\377\036\016=\301=\034\372[\242Z\311\321c\013\347\247R\302\\!q>\210$\037\377\r\361\361C\262\203\344\356]\265\225\226v\016\254\237\233\2476J\364\266SU\210\264\213Z\016\260\"\377!\371\357+\004\022\236%m\f\21428\377\216\374v\251\201\342\204\363\177\310\237\221_U\215\224\241\022\007\347\013\240N\377\274\n\220\365f\007\037\316?\"\371\252\353\354J\325/\310\177B~u\025\313\322T\207\363\005"
+	.string	"\247\177@\376\353\372\325\353C\306\334\027\234/"
+	.string	"-\372\377\375\370U \232!7\202\340|\001\264\351\013@\312\326\326\217G\007-$4!\272<\251\301J\351\350\300\340p\375\307\243\316"
+	.string	"7\334\322Lii\351\257[\266\243\f@w\307\005l\357\252\020\246\\\233 `p\276"
+	.ascii	"\232~U\277\252_\016\016adw\\pU\2244\"Y\377\345\030\301d\306\017"
+	.ascii	"\353\277\nC\222-V\260~Wtl"
+	.string	"\332j\340\374\303\261b\301\261\031\301\371\001\330\323?\253\314FG\026\325\2262\277\251\337\324\357F\007-$4 \310%\211\321C\253\254\371B\376f\374w\343g\003H\305\007\037\016\234\1775V3B\332z\340\374"
+	.string	"\320\375hT\201\202\372E\201p\267\013(g:\226\300\0352\264\204\221\361_\224\372#\f\324S\223\237\323\317\351\027\343\304\034:FI\007\214\377b\350H\335PJ\301\371\367B\323M\211\322\367%_\355,\331\213\021\306\353\247\364S\3725]\036\245\022\030+$pK\233\262\n\323\177M\351\362JZ\022\347\337R\272\326\205K\231\2548q~H\267lGU@Y'\006\326\206\316\b\333o\377\207\244\301\350\361\275\300Y\355\323tB\260P}M\251o\3247*\337-\333Q\035\332\276\274\2209i_KS{W\371\352\306\302\330\325\375W\321.Q|op~"
+	.ascii	"\2264^\306S\365:h!\241\031\200\324\223\230#z{W\205\310?\3368"
+	.ascii	"!\203\263\252\247\266qc\245\005\007g5"
+	.string	"/\250G\024,8\337\203\2715k\316\253\020;\t\311\203%\033\017KOjG\f7\234\357\001\0254h\3244Y\271\247\200nlxXz:p\242\322\330\244\361 L\377\252z&]\013\301\2637\327\030\333\226\252\032\261\262\271e\221\341|\017\202\234]US\327T\266\233T\317T3?J;\251\310\0066\224YZvs8\227Q\246Ib\302\274\341|\017\262\332T+e\226W\356\264\250[\356\034\020\007(\361\202\345\366}PrR!If\251\202Q\271\250_\356\\\025\317^R\323[\252`\314.L\354\304\250w*\031\325N\235A\r\243\216\271I\025\214\372vuMe[R\301\250Y\222c\226{+w\3264\211B\305\223\333n\346\203\222\223\nbx*\235Zw\223\352\227\016\312\275\321\324/*\234:w\200.O_\216x\020\221\223f\006\273+4\377\352\234\352\205\212\362\207\032\234\325.i\025\025\034\023\316\357"
+	.string	"\216\376\325\270\233T\345\330\200\265\355\341\334\301\033\375\016\326\350w F\253n\032\3142\213N\277\0039\375\016\266\350w\300\246\337\301\024\375\253Vn\237\031\2275]p~\007Q4V^\0374\304\355A\325)j\225\035&l>\246\340|\225\312\177\265\205 ^\246\340\234\245`8/$\024\316W\323t\354\212\244\221\341|\025mJ\337\032+\234\325(\272\251\2030\020\277,5\035WP\256F\371U%f\f\021\364\301i\203s~\373\271\n\245\213\226\345\030\316\357\300\207\232\344j\231\232D}\242B\325\236Q"
+	.ascii	"\033sX#\314=$}l+\232\220\264(8\253b\252R%\373U\365\312S\035\026"
+	.ascii	"\316\357 \207\276:\366_\375\001\371B$\t\316\370>\013\252&\257"
+	.ascii	":\371\3254)\265\224\206\363;\260\322W\231\250M\342\256\274\300"
+	.ascii	"\371\035L\351\253a\377\325\023\334\355\b\303Y\005\323M\035$\201"
+	.ascii	"P\311\224\231\021\262\344*\330\237\221x\017?]U\235\301YU\362"
+	.ascii	"su\t\366B\203\203\3039\347\366\240\347\300\356\310\021\365K\005"
+	.ascii	"\023pjdm1\344\276\334\274\274T\244\n&\340\342\220[j\313\2104"
+	.ascii	"\353\210\027\344\223!CT\"*\354$\032\253\223\214$\244H\027\234"
+	.ascii	"U\"\034\030\321\277iW\355R\265\324 7\rH\352d\216\203 \372\034"
+	.ascii	"h\361\360\241\376\270uw\317\330\367\005\222%g\226\034\330\350"
+	.ascii	"\321C\325\241\301\322\336M\233\305\232%f\226\034$\351o\260F\377"
+	.ascii	"\352\016UK\335Jk\360 mm5\031\346\264\334\200N\177\203)j\226\232"
+	.ascii	"\245\352@\373\346\360\260\364L\027x\273N\315qU\207N2\313\322"
+	.ascii	"M\032\314\022D\017\347o@\246^\251WK\226f\342,\225\301\371\033"
+	.ascii	"(Qk\250Uj\r\325J\265Rm\2506T\252\363$\245mZ\352\215\253T\246"
+	.ascii	"\\\220/3\234\317\006G\215}U\371\300\371\033\b\321\337\300J\377"
+	.ascii	"\352\fu\306\327\262r\017\371\220d\211\207\245W\265TU\005\347"
+	.ascii	"o@C\377j\224\312\244J\335:\";F6`\322\327\200\215\376U(\025jH"
+	.ascii	"\220\030n\330p\276\006t\372Wc\2501pT\210\235\204\024\"\t\322"
+	.ascii	"\264\021\026\243\016\347k\240\246\272P_\250.T'\325I\001n\340"
+	.ascii	"\220\273\252*\204f\262VE\013\347k\340C?\2036\252\222\312\244"
+	.ascii	"*\245j\324%u)U\243C\n\017\013,N\314\314\013\316\317\200\214~"
+	.ascii	"\006ZT$\025)U\203\367\336\033\231nq\223\265\334UU!r\310\266\314"
+	.ascii	"\361\300\371\031\210\305\3513\251\362F3\321\306\013\362K?\003"
+	.ascii	"\037\372\327{d\232\317\244r\300\213\275\267\206\350\354\315\341"
+	.ascii	"a\351e\220C?\0037n.\334-\333Q\277\027J;yJ\262\204\340\374\f\234"
+	.ascii	"\332\2649\257\\\320M\\E~A\302\260\220\341|\f\320\350_\263as\353"
+	.ascii	"T\330IS!\222\260\255|\\\340\372\340\312\224\321jv\2546\036\226"
+	.ascii	"\036>\313b3\225\346Z\215\316XVZ\031\316\032M\n\303\310\023\332"
+	.ascii	"\035\316z\231\302\310A\262'\206\013\316\372L\n#\367aaI\301Y\343"
+	.ascii	"\2450t\302\342\276\364\341\254\315\2441\340\360eI\302\370\257"
+	.ascii	"\346\210!\305h\301\371\030<\321\327vW\223!\363\265+E\001V\033"
+	.ascii	"\264\345\226\252\032\221\226"
+	.string	"\021[\022\202\36318\242\277v\361\322\336I\035\354\364pbg\003g0`\264\030\215\344FK\347,\r\b]\230k1W\312\256\032\202\363\331\230T\377Ut\f\222\035.p>\006T]\272\350:\0355K\"O>\242\276\\\327\375|\\!%q>\033M7\227\227\207\246\351\364\334\026\031pB\236l\034S\260\274i/\270\b0G\017\034bp>\006I\332M\273\351\270\274\365m\016\017K\357\214+\t\024\316\277\206\273\216\323u<\2244\341\254\271\334>\235//D\242p\326oz\013\232,Y\364\227\nH)\234R\007M\206\03308\377\202\031\264\276\242\257\350\261\2737\233\324m\345BZS\303\371\027l\321mm\251\032\275Q7Z\350\f\2663Yp\376\005hZ\257\351\265T\215\336F\264\324\260\340\266\340\374\013\224U\252\340\250\020\016\200\343\363\322\277\236\222\324Sp\324\271\267V\327:\206\324\221\226v\341:("
+	.string	"\316\f\322*J\224\013\347D\211\207\005v\001\215\263\263%\036\226\336\005OO\236\3344t\263X\302\351-\373\310\310\244\334h'\332\211\036\323\t[\342a\201i\261\353\261\234,VJ\256>\3305i\302&\027\026v\323\256rG\255mZxX`kK\226\3344sl\016J\222$\027\316\334;\007\220uLKL\037\321G\364\327\n\267\304\303\322\3732\362\305\365\204\363?\024A\"\235,\305\276\300x\203\363?\344\320Et\221\373\244\304\327\334\007\250!V\033"
+	.string	"q\364\001`F_\377\270\272+\251\273n\335\225\322P\236\210-\267\324\226\021\330\352\nI\n\316\007@\026\375{\353\320_\373\360A\305\234\001\212T\2152\036<\252"
+	.string	"\207\350\241\275}mmM\271U\346\256\362p>"
+	.string	"\270\364\257\265\222Z+WQ\201go.)\310-U5B\335\303\262E\206\363\001PC\377:G\216\013\327a#\241\361 l\313\210\323\006\025%M8\037"
+	.string	"0\256\260Z \333\322\226p\364-\300\323\277\276\361t\207\246\322V<I[[\265kk\262\334R{\204\256\232\212[\223\206\363-\230\323\267`\213\276\005j4j\\\270\273\233\266\b\220mhK3}\013\300\244\246\340\214\350["
+	.ascii	"\004J\306\205\323"
+	.string	"\300\334;\307\030\333\016}\013\250\364\265\323\3250v\350\030\027\316\001J{\347\030\362\243\232\263`J\337\002'\375{\341\320_\273Hj\027\027\256\203\026R\032\r\306\236x!\365\366\3362\342\\{Be\004\347{\220\323IzI'i&\315\244\225\264R\252\324H;I\220U!v\354\236\320"
+	.string	"\203\363=\250\351{"
+	.string	"\213\243w\234\276\276T\315\335Ry\250\216\375\303\243\341\225\205\363=\b\321\367@\245\377\364\315\337\244|*h\355\031\n\370\302\032\241}0\215q\222\356](\312'XpV\232\355\255\334\341P\265D\006\316\367"
+	.string	"\225w\223i^\252\007\302\230T\215\021i\233_\332WrM\3238\002\305\204\363= \241I\327\240I\325\240{_\245V\224\324\256\222\n\221&M\252F#yp\202\254\n\201w4\231!\261y\252\346\013\222\"Rp~\0076\372\035\276\350?=\363\233L\317\244k\025\330;\251*"
+	.ascii	"6*\300\"V\327V\246LjF\357\275ml<,\260]%\025B\253m\211\363;\230"
+	.ascii	"\221!\223*\365\336\033\211g+\235a\202\354\340\005\006Lj'7\227"
+	.ascii	"\332=\233]ab\205s\032\346\306Q\261\202\244\201\323!\207\376\323"
+	.ascii	"\272:|f:\355\244\255\022M\226\312\021\357p#..\245\203\233\233"
+	.ascii	"{J\247J\371xS\3039\365r\343\250Yc\303\003\347\264\313]k\342f"
+	.ascii	"\007\316\251\334\355\243AC\313\353\366\225%\331\214\341\374\n"
+	.ascii	"\336\350?\345\362\233L\271\244UT\247\275\247\n`\003\005\342v"
+	.ascii	"\344\r\316\257 \215\026-\351\226\273\367\336U\033\t\r\tYK\267"
+	.ascii	"\247[\260\\ \233p>\233\224\306\177\325\314J\222\226\204\363+"
+	.ascii	"\b\323\326\226b\351J\341\354+O\261\324\241b\\b~\340\234Z\271"
+	.ascii	"O\376\253\331\r\325\324\232\n\270(\231\240I\202s\252fj\201\343"
+	.ascii	"\203\006\316\257@M\247Tdt\251\021\007\347W`\246\323R)\006\330"
+	.ascii	"u\310&iP\322(T1\216\314\300\371\025\024\321)\024\263dj\226B\231"
+	.ascii	"N;i\207\007I\264\364\323\231(P8\277\202\036\3727\354\246N\310"
+	.ascii	"\322\262\024Jo#{\363\030\242\263\307V"
+	.string	"\301\225\026\023K\225{\310\261\247\312\334U\306\306]\332\177\025\bc\306\225\0348\237\0025\372\024\210\321\177\032\226L\303\322&\247\323\3363\b\260D\231\003\243M\223\033\234S&b5\232\304p>\005Y\364)P\323\177\n\226.y[\312@\203s\252$\2471\251\215\351?M\222~\351q\t\354Q\370\302\na\013;*\021Q\321\205\243\212\341P\253\323\302P\004\244\006\261G \226H,\242`,\036\205\306\243a\005\354Q\370B\017\005E\354\261\305\tA\302_\313\036[\234\300\342\205\030Z!\n\326\250\303\006\205\034\210R\b\333\241\t\023\216\254\220O[4\002\r78\006\205G\"\326\004[4<\256l\321\020\005\013\266\205#{\302\310\022\035\005\261C@\255\207\364C$\320#{\342\027\002Qx\024\002?D\242\035:\n\213X\024\215FF\302`[\004\372\t\021\207\307\241vH\034B\240\210\302X\204\300q(\224!"
+	.string	"lP\221\205\234\026G\243\242\007\234p\034\026\265D\241\021E;\004\300\221m\213\330\"4\2108T\301\201\r\256@\301\t\"kT\3249\006\201\216F\025\r*\032\266\371C@D\2411\005qx,\022\201AE\303V\003\326($\002b\20340**\362\250\220\241h\224?D\242%\"\022\002\r\035\205E\037\264\307a\212\017\216\210B\005`qD\034\022\025`\204\022\202%\224`\361\301\261%\026\201N\025Gc\b\332\363\030dE0l\321\026F@El\021\372!\022\037\260AGD@\304\341\007\306\366\350\003\n\210\210\216\210\304\"1\225\241h\034:\026\211\251\n!K\224Y\343\221Q6*\0022\036[\364C$\210E\240`k$\324A\313\262F!6(X<\006\203\214\305\"\007\241\n@G\343\357\3703qdO"
+	.ascii	"\035\215:l\360gt\024C\261H\324\223\302\22184\272p\302\221=\241"
+	.ascii	"\201=\016"
+	.string	"\215\027X\215B\226\b\205\326Xl\211l\013\264\340\030lYP\241\242\310\306 <\006W\b\211=A\242\"P\361X4\032\005Y\2448\332\320\302\250\210\202\316\361C$\204\214>\0202\002\"\036A`%\252\300g\033\0242\002\036\203D!\243\223(dd\262\"\030\266\271mYcP\2200maT\004\312\306\243\221\371\234\026\306c;\024b_\bn\bb\211BC\"a\032\304\266G\271M/<\n\203\204\214H\350\034\205DFE,\212#\333\262/\b\031yhS\034\361\264\307a\212`O\360\270B\003*\302\017\t\026C\b\264\302!\365g,\036\205@\303 \342\n\255Q\n\033B\370!\301\026\rQ\230x\300\004N\270\220B\316\206\021~H\2640\030\217L\370\264FB\352\t\027R\370\375\2044\254\020\022Q\004\2359 \2200\262EC\024F\305\"Qp\205\220\270\323\263\241\250\250B\021\005k\034\232\b\"\232"
+	.ascii	"<\nM\244@,\366\260\306\337\017\t`\032\002\211#\221\tB\304a\221"
+	.ascii	"Q\270\236(B\201\270B\360\204\013)PP\204\002q\005\037!\342\320"
+	.ascii	"(dS\004\213\200\202AD\031\212&\210\305\t\260DB \036!\342\220"
+	.ascii	"H\b\324\006\203\026\244\020\022\037\320\032\tq\b\036\005"
+	.string	"yZ\f\035\211\204\254\n\255Q(C\220Q\250\302\016\020Op'\2050\030\003P\360D\215\2061\264A\240\021{l\203'\317/(\003K\f\346\260`\211:\230\266FBA\2665\n\215\202\030\240\300\004N\200a\307(\034B\201Gg\004\022A \236\240\242\n\342\n\025l(\022\203\206+\332\035\342\t\027R\320\t\236p!\005\025H\002\211\242\243\026V\264:\307\264\004\022B-\013\252\001H\260EB\243\212`k$\264\242\007 \321\34284\n\2154\n\302\017\211#\333\252PQT\317\237\037\022EB\243\320H\177\210\004\361\310\370\001\220\212\f~:,\206\020\360\001\262(\022\245\200\241\247U\205G\241\211\025\004\022G\243\320\210\204\220-jaC\021{l[\234\340i\205)N\034\201$X\300\204\0268\360\034\215E\027Z#\241\264\350\250\215\001\210\035B\201=\n\203\214`\020\036\205&\202\210\354\t\026E\242\024G"
+	.string	"H\217\354\211\326Hhm\203\210\330\241\212`\n\241Qh=\036\331`\320\n1\264\302\2436\262F,\233\002x\302\205\024\264j\001\242\fE\"\b\260@D\341\261\035\232`\217B\242# \"!P\360\204\013)\200\020\201D\220\261XD\341\210\032\331\242\243\226XDAgH\350\250h\034:\266\255\320\005\226(\210(T\2415\022\342 T\234\300\221\215\001H\350Bk$\004d\203\020\340\220\"\230\242&<\200\205\026\330\"\241\021\0022\260-\264FB;\007\032\032Y\"+\244?B\t\005(\241\004\213\364%\020"
+	.ascii	"\002\002@@_\002\001??\b(\341G\277\204\037\263\004\t!\342\320"
+	.ascii	"xl\3651\330\302\320\032\t\375\216\033\212\303\nZ\030\217l\021"
+	.ascii	"K\304\036+\330\020C+d\201X\034\036\201\210G*\200FmQk$\244!\310"
+	.ascii	"\242\230\"\006 !Q\n\n\200\206G#\273BC\320\260\330\032\r\211\210"
+	.ascii	"\330\340\206\"\026\210Z\026r\210\204GbQ\004Ccq\250g\210\210\250"
+	.ascii	"-\032\241l\321\360ht\204\022\t\207G\"kdU\250\030\006\365\260"
+	.ascii	"\030\252\b\036[\343PE\260x\324\200\362\204\320\262\306\f\304"
+	.ascii	"\266"
+	.string	"\304 [4<\2521\260\254\f\2315jq\f\262\030\252\320\355\321Qxl\203,\206*~,Z\240A\"\0049\260h\321\3428\004*\022\261+\202\"\b\252`\201\330\035\027(`\"\blY\243\331\262\307!\021\021{\024\266\277V\363\f\035\215E\242zl\205,Q\206bP0\210%\352 \021tP\bA!\3420H\310\016\375Z"
+	.string	"\t\215G@@\302\240N\020K$bW\240\307\025F@@&\b\t\213P\343Qq(\023\207E&\020\333\232AC\"\341\212\263H\024\0223k\324\002\005\213\241\2124\004\013\234(:\"\236\307!\241!;\204N\340\004\013C\031\b\310\204\025\271\005\"vE~"
+	.string	"\021\273\"\233 bWd!\364Xd\001\310\2046\003\001\231 \002:\304Z H\310\016\245@\254\t!a\021z\\ad\006) \016\001\231A\303\025mnq\034\022\t\217B\220\022\261D\242p\b(\035B\241\350\210x\266BB\"\b\020\tS\024\211\204\326\020\212*\210\303\025-\272\256h\203Ga\033\\!$\006Y\2448\322\tZaE\233\213D s\005K\304\346\242\241\b\2049m\331\027\214Fg\273\2425\211\305akdW\244\355\212\243\2605\333\226(\224c"
+	.string	"\022\006Y\2448J\203\202Vh\211\200\316\030\200\204f\313\036[\2448?D\202-\032\036? \026\213\212\212@\036\332 [4D\301\036\205A\301\325(d[\344\241#\261Xt\266\020\006\231\255\361\2508t\266\354\361\2108,J\333 b\021\210m\323vHD4,B\211\305\341\361\210\250x\2425\022\322p,B\341H$<\333 \2618<\n\201\212\023h\215\204r\216B\"\223X$2\207\210\210\314 \021\322 \2265:\261\242"
+	.ascii	"l\203B\266\250\205\034!\221\026\"\026\211\324\243\360D\321\021"
+	.ascii	"\021-B\201\r::\016\217D\302\337iT\f\032\312lk<*\002\005\203\210"
+	.ascii	"GE\243P\016[4<f\366(\f\312\307\030\216E\346qH\\\2415\022\312"
+	.ascii	"a\301\006\021\207'\213\024Gf\333\032\t\255l\320\205\326H(\307"
+	.ascii	"\310\006\rW\024\215F\232\r\376\330\240\"\013\2550E\253\331\340"
+	.ascii	"N\361x$\374\261A\023Z#\241\234\240#\341\t\305\343\221P\027Y\242"
+	.ascii	"!\221P(\310\266G>lP\261(\310\242H\224B\207\005\"\026\203G\342"
+	.ascii	"\260h\024"
+	.string	"d\213\212C\301#\333\006[#\241\n\202X\326\250\r\006\211\020d\333\243`k$\304\323\34284\n\261G\3420\330\nS\264:Al\f@B\243 \213\024G\277\241\243\020\221%B\177B`\211R\024\tY\243\221\332\266B\"\240\240P[\244\006\r\203Bm\021jd\203\204\354\020\032$,\022\265\020\032\245DDE#-\324\026\255\354Qh\314m+$BA\250-\322&V\020j\213N\241\266H\005\373\002[4<\266B\266H\263G\341\013+\204\304\224=\n\215$\254\020\022ch\205E\231\210\r*\262@l\021\244\331\240\"\013,\206*\322T\033\205\0268\022\231\020\304\262\030\252X\321\025,\321\003\210\303\242\3648,\032N\300\030\224\272@\001\023F\331\005\n\2308f  \023\2142\020\220\t\307\314\323\266D\241 `k\201\023EG-\354\f\265\254q\bE\221\b\244\202pl\207&X\bY\b\"*\252"
+	.string	"4<\n\217\255\206 \2430\210(<\236"
+	.string	":\036\255$\254\020\022\205)\332\037VH\330\036\235'L8\341\004\013aQ\032\002\033T,\"\n\201Z\265\025\246h\201A\026)\216v\016\324\n\t\211T\234A+\264-Q\bmY\243f!,\322?A\354\n#\333\262F5\005\020\320\310Z@\250-BeP\341\307\2660\f\241\020\203\021E\321\021qmc"
+	.ascii	"*\022\235 4TA,\242PtD\334i[\242PPH\005\220>~\210\304\007\255"
+	.ascii	"\221]14\006}0\262C\025\303#\221\r\032\376\332 \320\002Gc\321"
+	.ascii	"\005\036\226(\205\020\305\n\224\r\262AE\026\216\306\242\321\217"
+	.ascii	"\r*\026e6H\201\243\261h\224\323\022\213\303\243Q1e\217\302\027"
+	.ascii	"\202\216\204)4"
+	.string	"+\202\341\tV\004\303\023\372\250\215\300 !\253\002\321P\210\302\310\252Pqt\002\213#p\305\220\005b_\350p\f\226\360\363\023\036\205&X\030u\214G\027V \022\016\215l\353\023\003\2200\005\021\221\020\005\226(h\b\374\020\207\027\215X\343\007\307b\321\370\301\332\006\205G\241\211\326HHm\215E\243\221E\333\243&ZY!a\333\262,\034[\341\004\216\255\220h\207X\034\036\207m\321H\347\030\fA\204#qx\244\333cP\263G\341\261=Y\260A\304\025\330\243\320\030t$L\221\023\264\202P\313\202\020qx\034\n/\020\003\220p\347\030,q$\016\217R#{$\036\025Q8\036\025\331\242!\212\030\200\204\032\330\240\t;\354Qx<\021\003\220P\243\260\200\013D\305\342\t\301\023\205\t'\330\026\006\026E\242\024G\253Q8\004\224\377\363\203\202\0060\264\220\202\006\"\321\032\t}P\034~@\034\n\213>"
+	.string	"2\266\037\220\350\371\017|K\315"
+	.string	"Y\222\207\263r\255r\252\"\346\366\273\261\027\306\244O\313/*iJ\314\007\220\r\310\006\304\202\322\330xXzW\016\304\202\276\321\303\303\2023\320\n\216\332\241$\314\027\234\201m\037\330R\267E"
+	.ascii	".Z\212\024\240\332\225*\341\311\224(=\240\032\260\212\221\033"
+	.ascii	"3\274\001V\001R\351s\321dI\252\206\213"
+	.string	"\220\321r\0068%\277Po,\t#\205\r\r-\375\272j\226\004h\242\177`\024\034\030\217\313\n\037\020\212V\023\206E\347\005xv^\3650\242\326\004h\266\3268\303\342z\262Z\345\250\3458\362\243L\327\375z\340\305!\311p\024\025\323\336\024\340\330\201\31247v\\\341\ft\002\024[\202\2242\346f\360\276\312X\021\303\031\330\004\230\004\202L\273\3623_J\351!\321#\303\304\334\222\306\206\313\21703\031M\366|\3405c\274\272\226\374\250\244\365\241)\243\324\342b\206\253$?/\351W\022X\037\022\273'\312\034j\312\225-GZ\215#\300.|\244\b\222+#\277\0349\311\27001\344\327\ti\236zx\245Xr\244\324h\201\025\321LD\264U\220\260/ax\310\217\007\320m\013\233\024!i\016\0332\\.\202\374\220\230\025\351\262\302\371\207\003\354,\314\022\370\003\370#Uc\245E\200!\032\330\003\003y"
+	.ascii	"}\034\330\343J`\217\f\370v\356\335`\007\307\224-GP\256TK\305"
+	.ascii	"#\223t\263\325\343\007e\311\035\332\216\256\035;\255\036O@\255"
+	.ascii	"\325K\247\254/\210\036PG\252\034BeF\007\316:LU\304\020\311Z\301"
+	.ascii	"\342l(\217\340|\345I\026\034\360*m\222\345D%\004\347Si\311g\003"
+	.ascii	"h\265\222U\301)\"W\245ZQ\351\261U.\314R\312\215\263\020\302 "
+	.ascii	"\241\2006V';7\302\0309\003\254\261\036\341\021\026\003g`\024"
+	.ascii	"0\n8CE\272\243\273\343\242\267\253j\204\370\201S\007\316X\211"
+	.ascii	"\354\220\371\221\205\013\316@\251\224\352K\034\"m\b\260\245\201"
+	.ascii	"1\2001\200P?W\3104\275\25195\300\247<-9\370p>\001`h \023\220"
+	.ascii	"\t\370\002\235\332xX`@\247\003_\260\261\201\207\2073\320\305"
+	.ascii	"\2053\202\003\007\316\300\246<\375\003\227V(7Yj\270\301\371J"
+	.ascii	"ia=%\255m\300X\035\001\"\331-\367\362\226p^\365V\275\265O#A!"
+	.ascii	"\343|\355\263\022c\256\r\347\365"
+	.ascii	"\315\nG\214\316L\0238+_[\034\324\232g\246!\203\245\013\316{{"
+	.ascii	"\n\212\021-8\257n.\334\357\356\f\234\225\021^\364\232\227d\215"
+	.ascii	"\231\027\234?\342\212\376W6t;n9|\230Y\363Cb\223c\211\017\234"
+	.ascii	"W\274\025oMs\267\324\333rE\3635\r\323\327\2259\234\327\345zf"
+	.ascii	"\304\022\375\257fR5V@\270\312 \265\217:\035aw1T\2611Nj\220\371"
+	.ascii	"5\035Y\252bZ\307\260!\253!\227\204sV\342B\003K\f\0370G\027S\230"
+	.ascii	"0\251\336/9E#\017\314\217/\215\025\223-3\244[\314 qB\360\352"
+	.ascii	"V\027:sc}]_T\276lV\306\r\034\272\264\n\320\351\314\331\2149U"
+	.ascii	"\317\204[K\262\304K\272\266\222\221JS\245\213\372\204\214\306"
+	.ascii	"\0337\271\270*\245\233\"o_\343\376\225\313\n\227\221\214\270"
+	.ascii	"%q\306U\327\007\355 \313\317\327\267\364\f\215\334\336\342\226"
+	.ascii	"\265\270\271*\303\362\325\355_\263\254Z\320\265&I\0328c\251\353"
+	.ascii	"\203rp{\320u\312\317W,d\310\250\251\273bE\307\016\007\2225l_"
+	.ascii	"\255\374ymm\323\341\322\303M\006\316W\353\372\240\353\332\317"
+	.ascii	"W\266)pp\274p\356\271=\350\277\252\255U\236\312Pa\222\362\265"
+	.ascii	"\312\277"
+	.string	"NY\2510\351-\373p\306N\327\007\335\340\366\240\367\354\347\253\024\262\270+Ki+\332\214)d\212D\371\212V\366\201\nX,)\365\341\374\363\3635\312{\356\330\036\231\033\316\353\223\365\311z\326\243\312\314\213BB\265\232}=\203\373\325x+\3631b\310\330\330J\326\246B\355 \303\241\374JV\007\354Q7\204k\004\025\023&\253\023\266\2357xI\030\311\257Np\030\275\036{8\257M\322)VI]H\037\341\204\004\311\n\326A\013)M\211\257:/\244\371d\003\013\022\260u\t^\027/\\p^\225\324\271\351\001\207\363E\250\321k\022\021r\253\221\325\310z$\004\237\246\372\n{\261\036I\251\312h\351\343\303\371\"\264\b\021\262zu\320B\312\333Y\003\365\265\005\243\275\bR\243\310W/\024qOID\376\253\277$<\204 \301y\035\262\343\306F\004\020}\0212~\374X\273\332hx!M&/\302\350"
+	.string	"\362\265\213\315\331\234\230\210\225k\345Z{\244RP^I0\034j\272\004Yy|\355\021\247\t\315\024\264\377*\b\001\213S\250\004\005\317\226\205D\262$F\"1\207r\3101\244T\3256"
+	.string	"S\025"
+	.string	"@H< \221\n\246e\216\017\024"
+	.string	"\016W\302\230vX#\313A\220*\246\310\214\300\f\020\200"
+	.string	"\004\004 \b\247`\n\350w\267\177\030\027\305\314\021\253\341&^\2553\325\212>\311\341\257lC\313\032Fe\203v\263\177\002\316V,\232\354/\005\026I\tN\304\201\314\001G\034e;\324\353\257\263\337\246x\303\004\035\325\304\365ZJ\210\246u\002\310\023\326[\030\366\252)\262D\355$\267\204\2304o\300\355\f\204\025Dr\204gey\364!\330\320\220\344\333\037\004\037b\322\021$\337\213yY \270'\365V\"\210\316]\304|:\376\032\001\273ul\236\307\373\242\"\355\226\030x\345\036\243\204\b\303\352\317\261\260\301\331\320\266\316$U\323\203\273\321{ >\243_\261K\017\204\324\212\336\2469\f\237\346o\244 1\301\274\272\306\235@\3762p\222\356\231\"\223\017\216\376\330\020\\<\025T\264\023\314"
+	.ascii	"FvSGQ\335\"\311O:G\017e\324\t\233<\341\330"
+	.string	"V~U\324\243\023\223\001\306\325e2\327uF\304\035\210\316\025\310\340\022<*\366gg)e\254`K\305n\305l@~~H\343q\307\346\264\207\267\245<U*\0130[i\370V\003P\302\204\374\333q~\305\363?\323W\351\326\3370\310\372\305\033\307\336;\345S\020G\001`fQ\002\356\364\327\370\366\311\376\313\344\316\215\007\367\362=\277\024\204\3375\026\373V\246\356\340\364\203\271\211\370k~\362#I\3157\310\303\004\277\n\210}8#*\352\240\301m\266In\334\361b\t\315\177\326y\257:\302\216f\033\207W\330\301\205LR\007\004\363\250\243/$\222\204\242\204\351/zS\be7e\265\352\322\271-\217\300\205M~\252\362q)AD\334a,\3177\246\304\032\251!\315J\244&\226X\355\325\035\256\251\232\234_\342\017,\204\373\337\240\341\322\257\210\310\0204\026\"\236`\321\006\332\365\360p\236\356Q\024|\220"
+	.string	"<\\\371\ru\371\272\306\270=\006\377\263C\205\003\325jk\307=\346h\312\253\201\242\352\353f)\031\230m\b|\375N\001Z\2123.fX\202<\225\377\340\232M\313\200\024\004\f\n\257qyt\220\271\220\025\006r\346\265i \320\303\217\022\3101\3746\242\037Z\344\231S\204q\212d\2143\345h\244\352\003D\210<7"
+	.string	"\250|\017n\372\265\r\2242bv=\254\201\210&\341\271\306g\0337\377\344\033\251\027\346w"
+	.string	"`\305DP\024\220\371\252:\370\222\245\231\351\2079U<\236\310\202?\322\266\272"
+	.string	"1\376\260\013\223\b\372\341\242ZA\371\366\324\200\314\224\017\320\314\301\316t\227UA\001ON\314>\027+1\303\353\261\233zX`Y_\r\373\030V\251\023"
+	.string	"\316\023D!\2417\326\rv\025\027]|\256,d\243{S\217<\223\275\032|\273\312\203\213\237ZB"
+	.string	"Up\250\340\b\214\032\023\251\005H\346\022\311\246\273\345j6\347\257\366L\253R?\215Q\033\221(\231,\251\177\017\365\206vn\231I6JQy\246~\023\221!\211\303j\206\311\371\t0c/]R\343\317\006aV\361\367F6'\246'\034]\031\223\362\223\272 \307{\336|II\265\262\247'P\236\237 \236\325\213\301\013\316\223`\222v\306\303\375\315;d"
+	.string	"/VJ\273\220 \177\003\355\253"
+	.ascii	"pYe\365\253\337\274\2604^\225\037^\031\222\b\274O\327\373\352"
+	.ascii	"\200\246\266\016\276!\222k\334\332&\343\230k\017\205\224*\323"
+	.ascii	" \037N>`\320qi\263\333\236\304^i\341z\317\227\316d\240\263}\016"
+	.ascii	"H\257\215\303\300\256m\211\221Y\201\276\307\230M\351N\270|\016"
+	.ascii	"2\264X\360\034\226Y\343\005\207OpC\353\310*)\260\266\346$O<\327"
+	.ascii	"{\264\326\004\354\025 z\200\032\370\332\355\323;[bX\210\200\276"
+	.ascii	"w\301\33246\362\303\340\304\353\344\022\013Q_X\350\"\237\216"
+	.ascii	"\370\204\\e\302C\037\317\226!\220\371\242\362P\363\272<\236\234"
+	.ascii	"\316\310\274ak\027\213\227\277>\031,\016L\235O\267\237X\234\n"
+	.ascii	"s\017\272\363\r\230\213I\325\344\317\261\2766@JW\321L;m\214\352"
+	.ascii	"|\346\344\374N\024\312A\307\221IX\251\236]f\242\212\026`\324"
+	.ascii	"\355\001\376%\031\326\002\207\222\323\005\033@\233\007!h0`s\372"
+	.ascii	"?\017\3602L\356E`\346,\201\352f\235\243l\377'\377d\355p\364\325"
+	.ascii	"\214`<\365)\323M&\024XrwT\375JSvt\250\272O\316q_+\002\251\250"
+	.ascii	"(-\3265\304\342\231\\\3444\b\037\246\232\241!\\:\023\212\200"
+	.ascii	"\232?1\206\222ID\227\325pU\030\244\307s\362zT\3279\252\036\313"
+	.ascii	"l\265\363\220-^/\346\252\273T\256\270i\307\013\301\226\205\312"
+	.ascii	"\004@\335\352\356R\373:\021~q\212\261,\220\263\3418\217\221\216"
+	.ascii	"\346\030]\367+\221\3725\376\211\005iU\214\\\267;\261\313\251"
+	.ascii	"-\310\030\264\360\243\236>\247\227\362\260\311Q\270F\274\252"
+	.ascii	"#\033T.pH\217\361\223\0215P*\225\372\352\206@\313\330_"
+	.string	""
+	.string	"\346\315\356\206\001\201\013\017uW\367\305\315\231\231\f\213\316mj\366\316\024\030\241\223\202\035\1778\312j V=\037\216\312\374s\275S\352\177\003\201\bzD\201\260\325\224P\223-\020)v1=/\244\310\301\312\313q0x\321\356\243\233't\022<3\035O\214\215\356o\257\"\364\313\207\311w\005\270\366+\030BZ\260\263\343\312\241\204u\021\315\250\035\354\fE5\243\362\313\276\215\3301Q\373z\301;\243\355*\037\377W\301\023u\354\351\363\237\261\327_\346\324\032\303^\001\207q\276Sw@tN\207zQ]\271,U\222\"BW\314\n\013p\2129*6\375\2630\220\013\251\276\030\314\352?\324#\r\301n\002\260\223-\032rLb\024v"
+	.ascii	"\247j"
+	.string	"Z\214O\2563\227\233\356\332\304\273\352\302\203L\220\225Meb\025\263t^$\371\246\f)\251\226\2737SLQ\330\323\334\\\325\344U\342\355\354>NXh|\333Y\247\352\322i\r\371\311\004:\303\232\177.\212\353%\321\205\374\0017\314i\310I!n\304\315\205lR\354\361\203Y$\330\251\fk\305\351\213\024\352\235a\221UV\246\347hI\353\224\205M\365\364TWx\256\353\214\251}h\007(h\236\t\315Fg\273\243\361\2341\230\301F\023\252Z\212\222\367/Fx\307\3343\022o\233\1774\230{b\205`\303\3039\001\255\300#\247X=\371\367\245\314\361_|\373q\336\027\255\375\005\234jm\311\264T\252\031-\206\313\360iI\202\332\254\215{\\\232\263\237\313\3049a\201\006\023!p\353C\225)\203Nj\027y\365\275\234\242h<\001\235(b\311k\200\373\034\007\003\202\023\235R\240\025v\302\276\021\323\267\034"
+	.string	"\365\006\343\b\200\262?oM\226Z\204\256\t;\234\304\311?V%a\232\374J\024\336\270\270\366\340r\312\330{\350:\200I\203\262F\317\363\023iD\200\370\214sA\236\334K\351U\032\346\0178"
+	.string	"\003\314\265*Iz\320\201\264e\365Z\214O\260\332r\200\373\271u@\241\027n<\020\200>X\214]\224\370\020t\221]/\030} \250H"
+	.ascii	"\226\265R\356N$\304\233\246\001\314\321\250%\027}:\354\326q\232"
+	.ascii	"\033\274$\2743\214\245PA^+\363*\0273\200[%\302:\336\211\336\346"
+	.ascii	"|\024\365*OR\222g\236u\253\327\221\r\221=\351\210\3249\251\340"
+	.ascii	"\0362\362\350\0335\341z\2245\246?\210\277\210\227\224\361=<z"
+	.ascii	"$<\315\346\006\221\352Q$\364\260v\305\235\030I \"\225q\"..\242"
+	.ascii	"M_-,\253\362x.\246\326\357x\035\204\304\350\373\320\240\226\276"
+	.ascii	"\374\r\023\2550er[G\366z\215v\302\241\203\2336B\034\327\030\365"
+	.ascii	"A\340S\365X?\274\037o\004\207\005_\223y\nC#\354\007\202w\375"
+	.ascii	"\322\344\326w\275-\254\212t\301\tx\346\017\204Ij,Mi\241\262r"
+	.ascii	"\200\243\214\025\365\223\264\353\360\316\017\230\357a\200E\020"
+	.ascii	"A\205\311#\006\332e\343se\026\314Dr\037o\305\277\301\317\243"
+	.ascii	"\bi\250:\365\004\332zag\340\372\343\205y\200@\306Sec\230\245"
+	.ascii	"u\013\245\202\032bX\266@\237~\321%\nKdz\347H\342-\325db\373\314"
+	.ascii	"c\317\222R\253\210L\324E\246\034\035L11\036\026\314eY\264\304"
+	.ascii	"~\026\030\212\\-\304\343\245n\367\024\311!l\337\t5i\\\243xIV"
+	.ascii	"\373\002\340\322M\231]#\035m\325\231.\220\025\020\315\002\240"
+	.ascii	"\221>\255B\232\217\027\302\320\221\253\035\327c.\362w\216\001"
+	.ascii	"\r9\306\031\254\302\220\366\204\007\224\3744\347\204\036\336"
+	.ascii	"[\236\345\230\226\027C\271]9\364\264\335\333Z\234\311\201\027"
+	.ascii	"\333\241X\242\326\223;\265jH[\202\332\322\342\376\006\203\217"
+	.ascii	"\317\232@\350j\342\200b\350\273\312J\\r6<\340\217\033\363S6\227"
+	.ascii	"u\321Y\263\262sg-%6\223\364\203\210M\333\264L'\325\265\215\310"
+	.ascii	".\264\326\352Gy0{\327\333\275,\r\230w\232\277\031\206+-\345\351"
+	.ascii	"x\033\022H9\364\201R\266\251C|O\365i9`\243N\330\321\232K\300"
+	.ascii	"\013\246W\202\323\227,\002\020\n\362\0252\006.2\234\317\311\361"
+	.ascii	"S\233\314*7\001\225y\260\336\312=\332_\037t\207\245{kS\320\367"
+	.ascii	"w\027\327\206\226\321\256\2045\021\265\320k8\312\233#\220\305"
+	.ascii	"\316\024\204\255\013E\007\266DX\356\342j\223\277\321\274\332"
+	.ascii	"(\273\317l\270\263\355\205N\337\005\314\361\"\200w\205\210O@"
+	.ascii	"\177\263t\002\314p\342@\360\021\376\201\301\330\373\225\376\""
+	.ascii	"\201-\241\230\260\216\217\f\371\013j\343#\3766\221\300\363H?"
+	.ascii	"c\033X\257\207\234(\243\310\310\b\224\005\277Aw\n\313u7\275e"
+	.ascii	"\261\230\225V9Ei72\334\013\352RL\335\rw\221\251\307\264\035\373"
+	.ascii	"\002\374G\210\230\200\240\022p\002\013\301jj[>\244\256\032\260"
+	.ascii	"\246qx\251\247s\236\225\362\227H\005K\323\002Z\307\265\354\031"
+	.ascii	"\236\002\220\316\330_\303R=w\371\316D\211\251\261\013E\262z\241"
+	.ascii	"\233\242\235[f\326g>\304\355q\227\341\262`q\224K\265\207lgd\225"
+	.ascii	"\221u<\313\357\276E\363\177z\252^\nj\007\3403e?\034'J.P`\236"
+	.ascii	"\222;sm\345\342\345q"
+	.string	"\350|,;\317/S\206^o\002\276\303\332z~\222\223}\013\314$\344\3141\023\221\240$\241\2661\026ez8\305\263\334\336^\330a\272v<\231\0257@\232\016 \357\307\240\224i\313\257)*\365)\300\201{\025c\353\030\317\267\343\203u\231\251\266\345I\270}KF\321\206QG&#\320\311G,38 \241\233j\210U\251\210\2131\266\370\237\322En\313\250\325\377\326GE\316\244\331O\374 \022\344\321Z\201\332\332\017\211v\324\256p\221\003\242\027\315\020'\033OMx\327\222\013\232\235)\201\262\276\362\024\273\346\230k\234v\360\213L\"yl\023\225\251\213\336/\270\\Y\032L\326\374x\2229\327\3348\340Q\377\236\374\n\272!\216\302r\200\321\364\313\217R\017\320X\363\031\006]`f\374y\237\350h\017\240\006\214\3271~5\255@\234\213 \337\277e\304f\304\251\211^\300\004\026\251\1777\0022\274K\334"
+	.string	"\242\331\215{\372\323X\r\260@5\230\235kG\372\276\227\214\204#\r\372\252\002QEs\247\252\234\204w\350\017\213\026k\212\302Hh\320\207\217\370W\200\036U`\234\371\201\2514L\322&b\327\234N@\332\355>\330$Ya!\376\256\251{\\\240\004\212V\250\244\366\344<G\210\277X\021\027\317R\301A`-\177\270q"
+	.string	"\217u\330\244^\206\216\350\223\214\002\353&\217+D\263\355P"
+	.string	"\330\024\320\314U\003\225>\236\271\005\177\352d}\334\234\n\300M\37616n-\204\372\267\345\205\344/o\177\355{\337l\\ \203\352\370\234\030WE3\241\312\252\034|"
+	.ascii	"\353\271\031\t\021R\327\301\231I\017\343h\003|\006d\222\353\207"
+	.ascii	"\234av\244\203,!L\305\365<9\254\001\316\252\033\026-\212\365"
+	.ascii	"\367\250\017\336\360\263\256\356\342\373x\346\276\360]\330N\r"
+	.ascii	"(p\017*\255\233\033\351\354\270%S\224Bw\335\271\013\307#)\216"
+	.ascii	"3\202\036\340S\2712\254e\221D\360\204!(/PP\375\342\330A\212["
+	.ascii	")\316mhAZ\210\221\310\212\266$\363\021\271\351@\331\227\242R"
+	.ascii	"\321*C\374%N\026\330f\001?\021#n\030\237\303z:\005\244\231\005"
+	.ascii	"&\360*\304bp\302\207\340\320\375V\356\330\350Ib\013\327.\305"
+	.ascii	"\034\334\215\274\352"
+	.string	"=J\356\236\333\351\td\342K\032\347\360\370e \340\037\277\203\324\231\003\365\265\314\232\233\271\030\220\361E\310\322n8W\244h|\322\271\310\325JQeR*R!\273\311\344\030L\r\237'\264\013W\262\313\3763\177\016\214a\027\366gV\374\237\240\211\352\216\200jA\322\267'Phw\033\360`\037\342b\355\262v\027\354\224\370\021\003\311\360\t,0M\3359\3448"
+	.string	"\f\273:\313'\177\024\336\355\277\350\241,\304\377j_\200\233k\315o\311M\334a\275\250\244D\177\236\347\266 \241__"
+	.string	"\300\347"
+	.string	".\327&:\307\252\315\2664W\254\006|L\245\353PX\007lvt\311E^\245\367\034H\255\371\270-ez\202R-\310\256\025\230\325\276\f\224\211\344\233$\261V(eG\213\205cf\376q\207\302\035\260\214{\001\302\250\223\361\347X*\251\0358'\2366\343g}@z\033\312\334#\325\003E&r\216\032"
+	.string	"\373\013\3079\255\367\362\253\235\331\356:o\2723lf\007\0248\370\025|3\364\373\273\343\273\231\361\3559\240\265\240\345^V\354\2259Q\332.)\"\254\373\320Ai\227\335ee\025{'\3620\235cx\375<\246EUg\031A\2774\001\320l\331\334\213\247&\2267G\251\222\240\351d\225\233C\265\210\301\215/\f\224<\356\253\301\376\202\235\323v\034G\356\236\212\332\303v|\325Q\305\027!{\267i\306\203GrT\301\307t\207\177\266\256\344L\224\203\223\347\376\231b&\257"
+	.string	"R\020\024\317\327cV\227\027=%\307\324\357\241\200\236\347-\232\204/7\207&\257\272\360v\376\027\025'b\303\314)\025D\220Ls\276\247AG;:\347\312e2\254\271\253)\300Lv.;KU\321\016\tN&sO\303\220\017\366\374"
+	.ascii	"\363e~\002\335\306\001+\207Ae\376\004\206\235\312i\350\021\201"
+	.ascii	"\025\364\260\253\230\fFE\244"
+	.string	"\231\314o\020?\310.\351\266,\333\205\303\304\322\242\223\261\256\371\033\3203\214La\262\204\3306\337\021L\211\256\326\310\024T5#P\245\322 5\366\374L\002\207\r\325\302f?s\267\267\021\327\336\2651\r\2406p\352UG\313\276\261\314\317.(\217\316\f\313\3701\203[VY*<\007\232\302\001\203\021\235+\265q?\364\304\177?\247n\316\204{!\3202P\265d\007\247\037{\361U\330\371\240&\033MT\312\265\340\272+\033\224\004\215w\314\006\006\022\202\307QoES*\200D\233t\201@\271\203\240\tm\355\354s\rc\222T\033=\322\237W\310\250,\177a\367\f\314\213B\220\253`\016\325T\367\334\370\307\227\371?\333UT\005L\350\0076U\265\177D\235h\353\360\034\223\336\361\241\267L\362g^\242f8\312D\271F\326\3470\377Y\322\337\226\311\257\302H\216\221rs\304o\337O\264\002\314#11\243"
+	.ascii	"\2233\002\344\264\365\250DT\005\344w\022\311\363\226\266\203"
+	.ascii	"\031?\256\036:"
+	.string	"W\256\214\026\033^\370\3369\3448\222\355\b@\263{\350\372\327\036\267k\371kf\317\342h\356\022b\331\306#g\325\301\332\200-Z\201s9;\236Y`\313\271@\rj\302\"\030\210\213}#+\306\273\031M:\334\342\030j5V \267\223Tn\323g\206N\220\205\201\t\222\234e\332\277}\3408\025\216\231|\233\226\r\201\365\356\222\321\200c\206\033Nmg:\016u\036E\375@\264w\317\0038\217,9\212\035\020\211\273ey`\223\267\024\035\312\3240\177R\3527\320\203y\250\345\270~6\306\315R\016T\207\017K\330\333F/\256\242\372\265\337\006>\337\200~\036\236\274\220\034\356\3564a\243^\260\367\326\026w\216$L\335\034\332\334y\n\002B(\347<\030\357:\345\364\305\323\371\303N\320\214z\221\310\363\"\243\214\b\001\027\342\321\2600~\234\t\360,\346\235? \200\347\022b\354\374\363S\262\t\263nD\022"
+	.string	"\235:\021&"
+	.string	"\340\3614\024{w\373\007\036M\223t\215\256\220\203\327!xE\001\031\021\302\3031#"
+	.string	"\347u9\320\335X$\247.K\214\354\037\361\375\024\035\027\330\340xh\374Vv::\236\311?w\006\232uZ\024c{\241Np9\200\350g\031\311\r\f)P\315\340\013\275\006\270\313\026^a\210\275\036\344\306P\335\"\035@n\0200s\346^\026fo\203>\371\244y\036\255\n\221\332U\362\310\314\320%\026]\314N\370\341\326y\2600\2550\371O\363)\273Pi\0344M\024+\354\347\343\321\316#\215{e-\031P\206\341\211\212\bc;\202\237\002\013H\210ic#F\321\231\311\214\314\031!,\203"
+	.string	"\301\275\243\035E\2005\022\220W\326\315q\254\263\376LcS\366\316\324\3014\330(7xgj\326/\373\344\235=>\366\306E|f\320\311{\3442\007\253\367\001\201\355\346\212\322\201\311J\005\320\270\357y\325u\265\264e7\276\321\334\352\244\251=\224\323\262\217\242\263i\211\320p\257\354\301A\320w\336\025\277\300>`\3577\345\307\241\030n\360W,\f\266)"
+	.ascii	"\214\201@\325G\201?Av7>\362\0230\032~\304\001\231\024\037\265"
+	.ascii	"@\035\036@mjI\212\261}\332\360@r\233\343\3439r\340is*\320P\246"
+	.ascii	";\001\235\214zd\321D\377N\214\242\016}\330\321\030X\017\f \212"
+	.ascii	"\034\226\375r?\215\352>\371+\370\337%"
+	.string	"\324\200\237\360\317P\325\346`\213\260`\336\330\003\327\346)\343q\331`\361\220\030\376\017Ll\247\370A\2520\247P\370\366\234EO\030\220\016*\210]vn,D\241vx\006\327\025\270!\2558\231\316\021\245\312\253G\"4?,\363=\375\273\251%\350U\b\236\220,\355\314\302\022\300\275\205D\"\303\267\221&\366\306\025{\347P\021\317\235G\244<\023M\223Xg`\252\346\254\004\200*\b\3530{\257\r\334\0176\217\217\377\317\323\355c\366\326\252\350\231\236v\n\233\201!\242\002\260\375\373<GY\016\360\026{\223\233M\340t\246\261,\\\265P\217V9\t\300\224\225\317A\303\202\313\371\325\261\305\023+\205\241\351\230\300\3424\020z\313\373\2121\365\306j\002Qo\365\376\272\204X-k\001{\340\250\265\370\346^\257\336\247\270\270/0=\370\356O9'E\305\265\245\016\210\032\277\236\026\n{\260\027\205D \225\227U"
+	.string	"\334\261\221\027~o\202\375\276;B=s\027c?\004\266\365\243\212o\201<.\270S\316\277\233\220\035J\370\246\016\376o:C\270\035\210u\214\376\"\374\354y\245e\0255\371\224\f\037x\360Iw\233\264\356\3219fp\003\371\372\321\331\337A\376u\231\273t\232\031\337\373\341\233\251\361\3372\2277`<G\236g\347\251\336\364\334\275\337;/\3431Y\007\312d\001M\256\244\373\223\314\260\215\207\256\357\231#{\264\272\261\017\217~\270\337\226W\251\213\027\354\003\321\377\\\002\260;\305gl\336~\254o\036\366\257\270\274\355\3714\356\374\226>\366\307im1\030\027\231\232&*5d\236~\034\373z\201\273\212\361\211M\316\330|\037\346\237\004|\344}\242o\240\223\317\233\210?\211N"
+	.string	"y;\212Q\030\365'"
+	.ascii	"r\361\344\371\326\373!$zh\373\377xv\231z\310J\371\225\036+\210"
+	.ascii	"\205\314\343\201\344O\017M=\335W\353\027\230#q\317;P-\204\374"
+	.ascii	"\022z}s^\373\300\315\332\341\312\205\201\205;\232\346j\327\275"
+	.ascii	"\0160\007\264;\210<\207h\203\031\373\273\331V\030\265\205\363"
+	.ascii	"_\271"
+	.ascii	"h\b\245]\362\343\275/\017_\371O\r\237~\206\311\023\335c\336\271"
+	.ascii	"!\261\237SBX\367\317\201)o\237\242iOn?\311\327g\354u\363\367"
+	.ascii	"\376\177\267\264\2377\254\246\341\221\222{\374\n\256\035\370"
+	.ascii	"\206T^W?\003\355ij\203^-_p\254\243\261t\367\334\037\354\327\202"
+	.ascii	")\362\2003_~\3604\266;\364\357\261\362I\243\223\247-L\217\215"
+	.ascii	"\320_Y\256\207YiV\220R>l\337ruB\351.\260\3472\377\224+\256\275"
+	.ascii	"Fa\243\307\310g\237\277e\314|\227W\274\200\377\003\276\001\214"
+	.ascii	"\377\233\366\217\334g\240\371\362\353c\003\271:\326x\352\032"
+	.ascii	"\336\005\271_mg8x?\b\265\303\357\217\023\363Q\365\016\241S7\032"
+	.ascii	"u\211d\207\374_\344\377\273\337\274\346\n\323N\344\303\033\177"
+	.ascii	"\034.\b\317\213\036Q\341I\322\307K\365\231s\265\3117\302\024"
+	.ascii	"\304JA\367\230\240n\214\257\256\"7%\033\037\032\377H&7\244\335"
+	.ascii	"?J\nv4\336?\216\257 W4\376\211\022\376e(\303\230uSfOl\235\253"
+	.ascii	"\245|fW\303{\230\334\236\206i\223\311v\357\274\b\217M^\277`\327"
+	.ascii	"\366\372\263|K\377\031\035\251\003\fO\360\363>2\335\346\270\211"
+	.ascii	"\370\305\222\223ON\337&\371\032;\277t\\\271\243O\307\rid\001"
+	.ascii	"\013\237\t\350\344\241^\f\261\026\263\267\326\016\3546WL0\275"
+	.ascii	"!\234}i\202\253\271\346)\r\375?\3015\004\315\265\373'iF\271\207"
+	.ascii	"\356\021\374X\317\035\322\026\214\356\255^\006V\365\3612\336"
+	.ascii	"\316m\272xM\347\357Q\215\035\0017\216\3274\335\377\325?\311\202"
+	.ascii	"\214\030\330D\325\024\020\357\267\336}KoA\205\025\315f#_ft_\251"
+	.ascii	"\203s\351\320]\270/\343\267\321\377_\266\356vg\361\370k\332}"
+	.ascii	"J\371\256\300a\375Wfw\370i\277\\dND\272a\307\212M7LB\367\031"
+	.ascii	"\214\310\367\237r\371B\321<\327\364\306\034\356\322\031\032\374"
+	.ascii	"u\371p`\263\304\261\220\346\315\337C2k\346S\320\177lEdA\262\215"
+	.ascii	")&r\366`\231\342\340\035\232\340\274\343\326\376\357\346\f\225"
+	.ascii	"\2017\034\352;F\017'\331]\033\375i\"+\322\261\234\303)\n\334"
+	.ascii	"\351\252\337\322\313\233\277\235\202\361\246:c\332\002=\037\244"
+	.ascii	"\301\375&3\232\305]#\317q\244\307\"\340.K\3654!\307\006\023\363"
+	.ascii	"z}.\263\301\326?"
+	.text
+	.section	.gnu.lto_.symtab.744964afaf894f24,"e",@progbits
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\004"
+	.string	""
+	.string	"gpsIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\004"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\004"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\004"
+	.string	""
+	.string	"gpsSetFixState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"ubx_nav_pvt_valid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\004"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\004"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\004"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\005"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\005"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\005"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\005"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\005"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\005"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\005"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\005"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\005"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\005"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\005"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\005"
+	.string	""
+	.string	"schedulerSetNextStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\005"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\005"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\005"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\005"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\005"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.744964afaf894f24,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1443 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016"
+	.string	"\030"
+	.text
+	.section	.gnu.lto_.icf.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`{\002\375\r"
+	.string	"&\022D;0\3458k\300\345\335\300\003s\024H\3775\253\203\316\243v\260\033\224\207\367\261cS%\3523D\266\215\026BIA\211\201\201\001C\205\246\317\332w\223\214\226\254t\277\\\331[\246$\001/"
+	.string	"2"
+	.string	"6"
+	.string	",\332|\363\274{\256\231\333n\267\210\327\207\002\335\246\334\334\333\365mz\347\225%\n\245\255\321?\237<P\254\346<[\333\026J&$\031\231Q\203*\260\315\3708\356m\347\005\204\203D\307\355\211uU\226Z\032\3331\230ZN\265^E[\347\204\177\207W\360\217^\367\006v\005\030%l\334\367/\310\013G\"\255\237+\243TqB\273\375@\177\276\236\007\302\n\f\344\016E\316\334\027\f\301\305)\301\267\3412\"\362}]\3135!\343\201\003R\257\222[\257\242\347\332\021\240#V\231h\321\363Lt79y\270\245`V1\322n)\245\341\367\336\003M,\245D\n\201B\035\r\026\257O6\005\220L)\317\005\032\254\231\016"
+	.ascii	"\f\224\323\270\251P\305\204\004V\250\3019\251!)\205ie\330\rP"
+	.ascii	"\202SDc\036\022\3004B\234\206\210(1\254\326\277\003fj[\342Bt"
+	.ascii	"\326\003]\250Gq\267\r\007\331\nL\211\326\241\240\345\265Q\250"
+	.ascii	"\253\354+\232\333 Ajg\310\t\250|\322\260\211\345\3324\304\033"
+	.ascii	"\201*m\251\232\311b\224){\202\005\220\230\216k\303l\336'\374"
+	.ascii	"\257\215\037'P82\362OW\303\312U\213&\"G\272\302vZ \356\276:\210"
+	.ascii	"\377( \214\001\031z\233\027\342\324\205\naL\027\025\367\227\343"
+	.ascii	"\304a\340\271\177Fso\224\234!\226Z9Gr\0068\207\363\336\227\003"
+	.ascii	"\020\341\216\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\314\001\375\007"
+	.string	"\242\n\035 \200)I\00730\003\313\017\243\214\310F4!\321\300\337#\202=B\3777\242H\210mvo\231R\356\n\237@\"\230s`t\3240(\257\300\230\321q\220\013\302\314a\033\201:0)`Nry!\342\214\235\254-\001\223%\361{\001\\\nc5\332\274\325K\025F+\371\217B\256\210\263\206}\375P\210*q1\206\275\351\243 \027\335\302\336\373\nu\033n\"= p\002Bs\326\r\220aS\032\320(f\300\001A\004Pm\016\346D\324\305\313\241c&X@\027\215n\370c\005+.\004\f*\340\340oMz`)\274\213\024\263Er\233e3"
+	.string	"k\030\223\340\352"
+	.string	"\303(Zh\201\027 j\204\260x"
+	.ascii	"\232/\214&\f\340\004M\220\340\2369\006\244\034.\304\306L\002"
+	.ascii	"`\3110\020\021\300 \003\025\202:\022\tA7W\263=\214\355a\261l"
+	.ascii	"@n$\2049\r\254B\343\273\332\236\202\017\001"
+	.text
+	.section	.gnu.lto_.inline.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\020\007\325\034"
+	.string	"\206f\202I\300\322Q:\220\207\021U\262g\335\210O\204\250HF\324\006V\355%\n#w\252\361Ll!\362N\367\004\263z\202\337\216\352~fe\377a\376\233\242-`"
+	.string	"W\bMWQT\340\320ZS\005\370\243Y{\3356!dK)Se"
+	.string	"i"
+	.string	"t"
+	.string	"\362\223_\262z\275\262\254Rw\267\376\313v\374\371\257\344\347\215kf\236\200\020|<m}\335\r~\307\357\212\322\266\273;\374!t7\314\017\276V\377\263\246\320\327\346\376\006\341kq\347\353\215qf"
+	.ascii	"\271)\0015\265\227\355\364W\025\357\327\266/\234xC\363ga\035"
+	.ascii	"\036\213\246p\177}\341#'\036\221\352\037\371\224\001rs+\257."
+	.ascii	"\254c\n\222c`\f\251\215\237\261\330w\302\276\023\366\235*l\263"
+	.ascii	"\023\264\244\037G\324c|"
+	.string	"\271z\234\376(ls\007\231z\022x\270\216\272\212\317\347\335u\367\211\313\356\300\210\321\035\320\006\345\237\332)\t\210>\2762\ba\213\373^m\\!\304S\323\274\2244\226\337\346kM\274\374\214\371+m\343o[\234\356\016\tj\"}\254\272 4Y\334E\033C><\220\\\344\027y\202\317\n\033\324_\343\031\032\020?DZVwc\303\357\365\326e\2731&\374_8G\246\227!\345\266'r\370\340Hp\326\347\177\327\236\365\325\225\005\376rekhX\210\261\0371\350x2\342\337\262B\"~>\240HU\2414:\034zP\264S\227\355\364\252\227\355\244\302N\223>\376\367\327_\037\204\001\237\323'W\306Q\004\n\256p\300\262\300\325\257\255p\306\277\337\217D\370\337\330\250\206\310\304\216p\260G%\222\224\264H\005\374\027\342\371\361\314\332\326@\002B\022\037@U'\221\263U\020\236lN\027E\213\233\240\326G"
+	.ascii	"\314v_\324\335+u]\216\023&W\270G\203\213\035\340Wn\177e\312&"
+	.ascii	"]\350\005\351\265UvHGG\314\316\326\250\307R\007\371X\f\006U`"
+	.ascii	"\365\275\200\270\250\241\2719\"2\"\222\024$\205tP\0021f\006\315"
+	.ascii	"\003\022\340\204)F\022!\243\021\005I\222R\245\375\r\\hP\"D\001"
+	.ascii	"\332\341I\300B\017\325\315C[\225g]\221<anqj\242y\036$,:Gp\234"
+	.ascii	"\232\205\2008){\242\271D\250\336:\033\351\025\366\234\202\330"
+	.ascii	"\222\322\332Y\263\215c\372\350\247\350t\271\334\030\210f\020"
+	.ascii	"\266\270\254Tc;\032k\013$\313_\221)V@I=\361(\227w\230\316\206"
+	.ascii	"\377\276\215\302\316\036\342\356P6&\rr\357\231\313Sj=\317J\213"
+	.ascii	"F\240\017\022\2417\263\261\253\346.\022Q\0365d\270\244\001!\233"
+	.ascii	"\032E\211}N2\332\232\023I\350\235\301\202\232Z\177\222\224\022"
+	.ascii	"l\235\241\236\034\336\007Xm`U\036\013-xG\t\314\333\237\362\367"
+	.ascii	"\373\245\037\201\200\032x8\026\214:%\232\003\007\364\341\022"
+	.ascii	"g\254w\fC\367\006\351F\245\310\306\252wAq\256\3462\030%E9K\314"
+	.ascii	"5k'\215\024\273\365U\022\215\272\234h\240\201?!t\337\030 \365"
+	.ascii	"z\356|\026h\241\233\006e\200\320\330jn\251\204\305\2402\205k"
+	.ascii	"\307~=\031\271\301\205\353\217\214\202Vl\333\374\244\b\232_1"
+	.ascii	"\251Z\230\212\tE,U\030\317X\210\032U\301\355\341\3101\bt\316"
+	.ascii	"(QY\016e\34074\373\033\236Q\256%\"\205N\303lX\320W`\361(t\225"
+	.ascii	"jy\355\305\007j\307\244D\267[--\312/<9\226rJaG\305\005\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\274\t}\031"
+	.string	"\226]V< q\222t@\020\004\300-1\272\213\302\241~t\244Qn<}\210\330P[%\200\305t\217M\007\300&"
+	.string	"$`\272\220\034\203\032E\345y\237u\251]3P.\333\323\032\261\204\310$\003?"
+	.string	"E"
+	.string	"J"
+	.string	"\244$\315\023\266\340\236\342Q\210P\346\255>]\375z\324SRz%\2052;\254\367g\202\365C\\\242~\345\210:\024\225\2355lF}\221E\275K\313w\362\272&\276\246\311^\252g\007+#\002\267\351>\327\233\204\351\212\214]\037\351\243\377\212o\363v\013\302\364>z\231\236\207j\r\n\300\233\327\3510\002t\253[\2678\234L_\275[\305\377\252"
+	.string	" [[\0326+\021\225G\3426\275\302O\030\tUP\265\030\263SR\362\211`=FkaZ\371\022`p!\336V\007\270\270\034\224\372:<$\322C\"}\036XA\356\003\253\364\201`e;\351\336\350\226\313\221\"\205<z\3527\356\333lFZ\005r-O\350\024\030\307\0250\315\023\257j4$_\023c#41\201Np\271i|\344p T\261g\334\343|-|\242\201X\334\333\031\3063L]X\306a`\by\031N\303m`\310\024\365`\004\344\201[\334\300@w\360\253\216\030\017\343\256a\277\270"
+	.string	"y\177\253\r\200\324\250a\271chdF\222\024\n\035P\002!d\316\250\033\022"
+	.string	"\343 D\322,\247\030D\316\220\310\210\226$)\025Z\003`\016tsvJd\251\202\f!\272\273\t$\207\307\201\213:\200\b%;\340\317\016\241\352-\257n\313#\351\001\026\3034&\240\003=\2629\3405U=\241\322y\271\024\276\236^3\374\224\257\341\344U\217\354\313#\326M\201F\036\315\244\"\027b\234("
+	.ascii	"fIT\342qw\223d\220\013\024\205\275\240,\363m\2262\023\\\273\304"
+	.ascii	"Z\343\311\201\005\377\216\3610\201\327\366$\336R\020\022%e\r"
+	.ascii	",p\212\322\205\007\203\322\f\021q~$\220us\237t|?\331\331`\200"
+	.ascii	".\230\276]\347\0275*\016\323V\265\330\337\2734\200\036\360\350"
+	.ascii	"D\033\376\223uy0\243\023\b\3471\023p\303\341q7\2777p\016\373"
+	.ascii	"[\332w\273E\256\020\231\022\013\264\262q\030}\336\302\375\252"
+	.ascii	"\240\227\023r\244\211\2152\266\303\206\255\207[\344\367\2569"
+	.ascii	"\0069<\205S\372\342\233\216\357\320\277T\200l\210\343\007\237"
+	.ascii	"\201\350\364\320\343\030\036)d9 y\225\253H\030\321\221}E\271"
+	.ascii	"\325\221\036\260)\211\343qC\217\231\3441\261'fE\225\303\337Y"
+	.ascii	"\036\277\225\362\324n,\341\225\260\274\232DE@z7\343&\342\341"
+	.ascii	"\205\224Sx\221\220\300\303C\b\300\001\262Y19o\221<\034\244\361"
+	.ascii	">\201\242a\221\006v\327\\\223#O\034\235O\300\022f\247\325\313"
+	.ascii	"6\370\260\013\251T6\b\316\324\002\245\225\343`\244\353\243\235"
+	.ascii	"\350\304\345\345\023\337V\334%\"\303?\2561\023\223\311Q%\030"
+	.ascii	"\314\270\254\230f\275\344\023\261W\356>Q\230\315\246\374\370"
+	.ascii	"3'b\220x\333\201C9\213\342\224/D5)N"
+	.text
+	.section	.gnu.lto_.pureconst.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375 A\345\001"
+	.string	"\022\004\016\030\220E\351\377\307(affffnfR\3357\326\257~U\357\323\377w3\272\320{\236\363\322k\0363\227\253\334\344!\363\230\306-&1\277\303\025fp\240RU\001\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`f\0015\t"
+	.string	"\322\314&+pK\222\016\374\377\377\207\336N\377\177#~\001U\370\277A\027\333P\274\375\\\263\177I,\304\240\230*\327\377\377\377m-\261D\312\024;\215c\2714\221\035\313\245IW\312+\016CN\343\3562.\033\246E\311\260\300\254pB\021&\253\324cMj\226\216\322Y\361\006\245\244\363)\"\001\272\215;\212\"\201\003"
+	.string	"\006\356\247s\242()\025Y\020?)\235\022\235\223\242\336|p\020\375\201\331\232\367\247\334\316\356I.\251\231=\355\217\221:\332\313\256\327s\376P\036Q\376\fg.\370^\004< `\2021df\007\361\022t\365\364\316\030\261\346 \211\350\341\252\260V\304\t.B\024\002\330\200D~;C\260\262\206\210\0049.|X&\f\332\255\\0\311\016\217F\2207\b\rRf\357\005\231V\036 \003x\273\211V\221$\001\345\031a\003\024\210\017\206\333:1\314"
+	.string	"\360\022\217\265\220\347\021/L\345\310.\273\244\325`%\211-@:\3136\262\013\214%w\274\300<D}\250\025F"
+	.ascii	"\313 \373\300o\343\327\266\301\025\001"
+	.text
+	.section	.gnu.lto_.lto.f98963cb6ddfc448,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.21.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\004\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\002\273\001{\277\277\035\001\005"
+	.string	"\304\001{\303 y3\305\0014\302\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/\202@\335\250\356\200|7w"
+	.ascii	"\203@\271{fHi\020\003p"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.30.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"5\f"
+	.string	"\346VSB\020q\233\0168l<\320\225\223o\210\016\240\250\244jZ\350\032\\\247\013\270W\241\004\262\246\302 \036\003\275\216u\250\364M\304.\305\235\004"
+	.string	"\250\024\241\030L\234\351t\240#\265\341\312\206O\237\354-eJ\001?"
+	.string	">"
+	.string	"A"
+	.ascii	"'3v\267\322"
+	.string	"\016\206\271=B\315\315\317\222\022\327y\036\241\345#\362!@\367\201\032\322J\312GO\r\035H\302\020$\327\217\016MJZp\035\311\323\322`w\235\\7rO\267\275\261\235\261\377 \276\367O\232\326Lg\246\177\331\360X$X\261+R\252\261*1\005\004\306\366\323\376\210\223\330\356y\\\300.(F\212\335O\201\021P\217\376N`z\244>`z\364f\303\370'ZKhC\206z\221\201\"\002\356\356B\r\331\246\362jW\350\3449\037\bQ\217\355\0137\321\001\300\305\356.\360Kh\030\f\210<<\372\036\323\343UGPhx\037YR\024*>\235j\310\376<\251\021\221V\254 \007\227\205q\\\233\311V\346\2620\216kciU\206U\0230\b\234\312\322:U\246\2003\n\227VY\3102\255\302|{\005\331\301H\345CAb\204IUMN\274\bI\2221\231jK\340\3449U\006\034N:(*\003\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.32.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\354\007\2350"
+	.ascii	"\372U\034\023EP\\R:#\036\"$\204Y\242\225\205\253#!\263\3172{"
+	.ascii	"\030\230 =\341\036\263Q\r\275=\306\037O8\006T3\325;fcDJk\031"
+	.ascii	"\205\026I\246\237$K\356!\267\363\205\001\2200\365*\266O\b\331"
+	.ascii	";\311 \001\n\001#\001;\206g\207\357_!\230\033n\312\026\256\335"
+	.ascii	"la3#\2775\335Z\230\367}!4\013\226\313\335\334w\231Z\207^+i\022"
+	.ascii	"\023\303\263F\353\211\3326\301\246\225-G\334\205\214\273%Pp?"
+	.ascii	"e~\350m\246Yb<\356~\332\325\334\257\361(0\364ZQ\265\302\274\357"
+	.ascii	"\024B/\r\317\366\364\002\332\263\303\023\265g\333\355~\363\251"
+	.ascii	"\331+\224\372em\301\363\276\2571#\351\365\353\364\335b\367BA"
+	.ascii	"@D\237\241\260e\327\214\335\276p\003\356\202\243\366\275=\251"
+	.ascii	".4\366\240\365\201\020/x\337\333\"\262\022\365Y){\035\320\336"
+	.ascii	"\326\330jT\205b\342\332 z\027\344{[CV\001zemn7\206}\024\220q"
+	.ascii	"\205}\270\"Hs\246\312\367\266\302\326#\250\221/\257^\201\224"
+	.ascii	"-!X\270\002\361M\021+>\263\326\tap|Z\317&n\243|\235M\023\033"
+	.ascii	"\343|\202}]3\250\235%)>\257\326\314\3466\206\370\264\302\371"
+	.ascii	"z\307b\346\232"
+	.string	"}o\317\257c\341\206\367}\033;\237\\\357\241w\277\330\335X\335\302\021\001o\325\235}\277\377\205\35039\333\"H\340;I\264%^\315\021\300\354}\337\nK'w\234_Ux\260\t\340\277o3\255\203\177\356U\024E3g\267\212\025\3042yX\231\252\211\360O\356n\341\002\337\331\001\360\212\004\002Ze\252\356i\023gi\036;j\240t>\322=\204\233I\b\367R\021\267R\021w\022\203\"\356\005E\334HG\207\373\023\274\355/:\333\177\340`~\002\357\362\023\375\355\037\372\364/~\355\377y\336\273\315\270\331 \334+\020\356\f\204\033g\334\177P\244&\n\225\376\345\276\351\013d0\317\233\307\312=y\336/\327?\363\274\276^\023\361\\3G\323\310\317\265\b05\321\264\233\351\3435\021\371\273%#\253\351\373|!6M\303\363\276S\007WC$\231\333\325\370\\g.djt\023\351^\327M\354\344\347\332"
+	.ascii	"4-\232\366\276/1\331M<\233_mb?\314\305\270\227S\376\305\332B"
+	.ascii	"q\325\006\360}\267\034\234\355e\256\024\337\331FEy\315\257\036"
+	.ascii	"\251\253\255\331\347\266\247\331\370\310\334\f\263\264\217\346"
+	.ascii	"C\300*o\332>\263\275\336WP\225d\305\255\013rR\326\352\347h\017"
+	.ascii	"\344\002`\203\3245g\266\335.\222W\231>\\\203gt~\222\274\312C"
+	.ascii	"X\265'\020\272\344\325\033l{\320\240\271\311J\347\224C\224q\316"
+	.ascii	"\231u\263\204\273\335(\356\024|'\316IZw\362\232U^\235\322\203"
+	.ascii	"\006M\312\335\356\225\352\231\270\362P\373\336\344T\341Aa\226"
+	.ascii	"6\2062,\203\314\n\342\326\302d\3245VXp}\337\367m\377\245\366"
+	.ascii	"(3\310\327;\b"
+	.string	",bnX\321f\263\307\0201\354\232\217r\233\265\032\355u\230F\263\345\351\270j\020\374\346,\310D=:\264\001\324\267\2745K\033)\027\363\222\372g\205\005\373h\332\315\3628L%?\027\313\001]\265$\013o\016\307\325\302\241\251\251=\213\224\343|\034\211\252\255U\341\301\034\006\307\027%w1?\377\353I\\\326\236\241\334\355\341\325\246\223\223\007\255\230\273A\274\312\024r\335\t\204\366\327\220@\340\367\006\310\353\220j:FA)mD\035\227\304'\250\251\017\307(\345\f\250\020\313c\324\3240\352\230D\246\330\261\224:\236\320\341\224\f\222\232R&\217H)!\324q\004\220\223\224S\207\244\323\322\311\206O\207\0202\240\234\222I\345\223O\333O\021\216OH\034G\031OK\243\022i\204B:%\215O\313(c\004\003\255\264q\\\032\245\224\312\245\2218\255z>\322s\266\002\001\253r\263\225\353\373\222i\270\334_="
+	.string	"@6\241\r\230\315?\271_\347R\271Ma\246*\312r\346.\bF\313\224cP\377\352\332\275\302A`t\321p\263\316\243=\313\224_wl\346E%\252\266V\224\331,\341l0\213\t*x\007\224\245\355\324.\r\3670\340\317a \256\227\001(\225h\332\017;W\313\365\201\357\\\312\254\034Z\2353b\2266\256\272R>\026\273v\201`-\346\260q\017\354t\237n\227\353\205\357t\275\332\263J\371v\307Z|\264\211\252\255%"
+	.string	"{\265\335\224qA\203\372\024\205\275\312\034\340S\326\026(\001\257\371@\376\034\276r\211\f\335\261W]#\b\374\334\200\236\250Q0\245\0343L\315\210\210\004M\222f\f\200\002\021*2\333\021p\271UU\222\024\2461\312\002\265\b\275\350\305\204'%\341\251\036\013\361\363\"\234\251C\n\357o\226"
+	.string	"\002\333d\220\216\201&\241\203\272Zx\220 D\200\326\363:\016W\353\032\016\202\002]\316[0\322\027A\330E(\341\345\314i\332\002d\371"
+	.string	"\006t\274D(D\251\024\316\346\344\202\235\264=\276f\234\235\375\001q\361;\005\027\357\301X\033\266\255>(\177\253\251J\037\362{\366\271v7\273&\342\335\003r\200u+\274g:\3333\306\257H\r\034\263Ax\352^\361\327\017\211q\346\205it\360\201\236\032\344\254(\302p\331\277\023\025\225\301(\250\320\332m\341\336;\351,\352S?\370\310\fn\266\274To)\233A\032\343\032\201\007\3275\250\265\331\243CO\307\342u\277\3741q\024\0270\3517\03079\3208\250'\006Qp\365i<\211DtF"
+	.ascii	"\026\260\n\237\344<w\204uC\357\352I\220\007\304\264J\374N\200"
+	.ascii	">o\271\300:\005\367\310\b\274>\f\001R]\020\204\211\201\367\301"
+	.ascii	"\273\244\240F\n\022\263=V_\233)\213o\355\273\005\216\347H\374"
+	.ascii	"\3533\177"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.33.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\346\022F>0\305*\035\300\263\352r{}_\367i\322\321\036\022e#P\251P\013[\351\323\016\216\314J\0067\213\025\205gd\230\310:Z\300#\"\202&\264eS\226\005Q\336\225\326a\202\b![\246\0244"
+	.string	"5"
+	.string	"1"
+	.string	"*\r\024\332\356~\263\365\361\333\324\321' I\337\274\324\347\266\300ZI\025\220\246-3\373\bp\330u\203<\251^6\273kE\221\0357w\333\020\266\031\354{\001\352w \031m\300C\313.G\355\300\262p*$\030\333W\373%w\215\177\215\020\f\366\024S\311v\313\006+x\347\\>\323\235\363~\320\235\363h\013x)\262\227V\237\0221"
+	.string	"'5`\033\364\223\220\203o\"\312\360v\367#\347\374Qw\356\363\260\353jE\200\345z\225\264f\227$\235!\366\267\335]O\020\373\257\177j\242\0178\rj8`\007\2033\001\212_\330\371*:\021\024\037(z>M\202C\013\216\370}\302P\3740\345~S\232\246\315\3239\355\013\217\036\345m\2224\245\300\314c:\324\005\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\t\325*\b|\"\3049\304zKx\002"
+	.ascii	"S.\3016\253)\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_runcamSplitSendCommand.35.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`U\006}'"
+	.string	":Fp\017I\200\332Q:A\n\261\236\356`@-<\343P4)\341_\334/ h\324\274?]\330\334\311\312l(\254\2661]\272\352:>\005\bn[\344\034\3453\2164`\321j\366\016$O\r\276\3752PRE\026\021B\b!r'\031\337"
+	.string	"\332"
+	.string	"\351"
+	.ascii	"\310{\205\017~2\221\372s\350l\313\\\341B\357E\336\003\\\337\230"
+	.ascii	"\034\267[\346_\035J\357D\032\027p/\024\331\326\275\305\b<\244"
+	.ascii	"\376\344\342{\320\237\352w\320\237\314=f5/\032\271\251\224\026"
+	.ascii	"\360hv\357\275\265\224\252\2528l\336,\236k\335;\200\234\232\r"
+	.ascii	"gUS\3644\333\366\370J\007p|\216\231\332\330\221\344bB!&\021\032"
+	.ascii	"\222\353_6l\3557\fr\233\231\352\020\226\271\230\320\311$*[\323"
+	.ascii	"\364\260\237\305)2l\372\252>\r\201<5\033\210!Bv1\341\017\023"
+	.ascii	"\310\311K\217\032\023\320\242a\367 uU\3664l\372\371\257{\030"
+	.ascii	"{R\3664\frS\350i8\344mZpr\003\213\215\251\206Y\243\242\\\362"
+	.ascii	"\343m\220\311gm\312\341\336\313\026\007\323\360\254s\346'`f\022"
+	.ascii	"\314'X>\2623\342\222]2\027}\266\243\230\257V\351:\302\r\305\274"
+	.ascii	"@\350]\347 \005\007;'@p`\265l`\265\f\324\226\177\332r\201\325"
+	.ascii	"2\001\237\036\036\325\362\316\200o\235s^\374\327\023\377\363"
+	.ascii	"^g\233Z>\003\03531\032\262\356\335\261L\273aN.%\367\372\301\376"
+	.ascii	"\255\277\353\217\302\317r0~\030\327\260\364N\345^\374/\236\222"
+	.ascii	"U\265\273\024\276\226o\351%n\250\356\275\265..\236z\247\322\254"
+	.ascii	"\266\\\274\ti\027\240\b\365\347\226\026\322\357O\270\002\245"
+	.ascii	"\264\320\335\265\220P\341\312cL\t\362'\207PO\205\217\345Une\367"
+	.ascii	"+C\252\222P\2652v\205\004\241\376\f2w\374)\\\333=\213\027\244"
+	.ascii	"\024\340\372\306\252\246\356-vP\177\376G\256\035\353\306\336"
+	.ascii	"\243\304P\357\324\007\251/\001MVc?'\337\332Q\037B}\032Ag0\376"
+	.ascii	"\322|6\007V\023\244j\240\017\264M\003|c\204\002\265\201>\320"
+	.ascii	"\307O\003\265\351\005|\003\341\005\372\247\377K\363\331%\373"
+	.ascii	"t\201\226a\245\004\276Yzr\305(\226v\024\337\b%\320\1772z\361"
+	.ascii	"i\002\375\260\233\\Vk\200o\226:K\307\031\027\312\323;\335\323"
+	.ascii	"O\003\364\341\273\231\024<>\022>\022\372s\247\3551\330D\3419"
+	.ascii	"=\240\377u3\314\n\314\217\211\217\250\3547uv\324\021\tm\314\222"
+	.ascii	"k\223\261g/c\233*!\217`\226\364:\017ef\b?\362x\214\334{\211N"
+	.ascii	"c\222*\031\303\216p\320\245\346L\270\224\372\330\220\2311\314"
+	.ascii	"{\2376<\312\233G\232*$\326\245\200!\366_\240\357\023\30635,\032"
+	.ascii	"3\027\275\313\013\365\336\213\201\317%i\205\212\204\006\372\363"
+	.ascii	"\375\343\033\004\314\266E\216E\353\222\\t\321q:\\\353r)R\354"
+	.ascii	"N\224H\322\231\330\325\222Z\344\214v*t&T\224q\022r\270\"\030"
+	.ascii	"9\0248\335\355\250\350\326\242\310\204\321\r\247C\272I\370\341"
+	.ascii	"#\0279\335-"
+	.string	"\351\350Hw\253\025\227\336P\266}\007P\343i\333\301#\261\354\222u\354\t\301\310\233\031\227\263\307\301VK\031\346\327J\3742oc\246Q%m\033\225g?rL\233O')\235\314#\317\243\246)\223\330\204\314\340\277\276N)\211\266\001\315\246y)?\252Hy\270\241\302\221\243\373\362<4\250\205\210V`?\247\rI4!\265\216\342\333\032\212W.\253\202\365J\231\345T\203l\256\013\324\244\222x\366\264O\007A\facDS\303\242\231\367\336\213\323Q<\343\247\"\3503Q\252I\017\364\202\0162\353,\227\313\345\207\320\004\255\240\037\200\204\250Q8\205\020S\004\231\231\tdF\333\244\003p\002\231\271\332\r\020`H5I\007o\360b\304\363\373\366\3525=\021=\264\2231\217nF\363\233\321 w+\"\336\323\026k \001\233`\337\250\333+\255>\037\0315x\2445\213\342P(\b\223j\333\217\261\351\376\017"
+	.string	"5fe\361\027\205\246Ve%\232\247>\365a\240\267\3164\330\255\240gR\370\035\370\311\016\213\001\330!Gx\374\230\327\217\001\f\326:\276!)\334\373\331\314%`\215\373v\345.mx\f\377\225\006cP\231\003\304KS\255\2547\356E\013\243{\2017\036XP\244\001\250\034@\275\256\330wo\252\310\322\376\233\244^\260_^\264\004(sh\234\327\375K\0068\267'H&\322\367\332K\303}\331\306\005\0014!\250\230\275`\253k`\371\353\317@P\372\2016"
+	.ascii	"\n\256 \227\\3Q_D$A\321[\260\t\262\340\362\007:\317x5\3519s("
+	.ascii	"\b\300D\233\330J\267RW\025"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.36.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\331\002\315\025"
+	.string	"Vh\216J\240\024R:\243\360\213A#\034a\357Xpj\245I\243\033\205\fIa\030d\1770X1\247\270XT\355\221\327\352.\253\217\352G\037\030\277\334\200\367h4xM\n\347\203U\211\311!\316\332\034w\222\203\314\276f\244\221M\344N)w"
+	.string	"p"
+	.string	"\200"
+	.string	"0\212 \220\247^\320`\367RG\326\"W\223\020QU\255\345\201S# ?\355\033\375hw\244\033\001\262\232\263\304\302\251\3262\201\r\220\247.\2172\236\222\0070\236zg\017y\351\242\272\202\266|B\254Z\353l\203\276;\025w\356|\234SXp\347\"\271\363\025\031\224\300\3529\t\346\210%Y>\037\027~\002\203\2759]*\265V\317_\020\305=\3366\213\355\026{\025\004\277\031O\277\027~\366\374\370\2648B\342\315\241]\366\346\002\331\027k\255\325\373c\277\274eW\272cg\272M\216\364\227\300\246a\257\351\327k\232|M\273\310\351\221\234\246\256iq\234^:=\305\351\243\\\205\017\026\221\b\303ZM\f\265*\017\372D\364\362W\372\231\276\366\237\364\245\013Mb\233\251\346U\347\304\013(\364\242jEIG"
+	.ascii	"GV{A\002M\276-\034+\333\nG\200<R6:\177h\306\366\301\214\"@\036"
+	.ascii	"q\355\226Ca\b@\345\f\277\241\341\351e\203\tU\315x*F\375\254x"
+	.ascii	"s\350]q\357\333\272\223\215\3563\343\351\356(\004\362p\270\215"
+	.ascii	"\231\271\257+\251\030\356\360\0325\005\250L\226BE\031\331\025"
+	.ascii	"DI=D\331,Y\333\2056\377\263\2708\006\342\204\344\263\216\031"
+	.ascii	"\277\036\226\204\344\314,\333\265\313\210q\3407\301\330\310Z"
+	.ascii	"\353\207N\0355\232\215\246\3662\216\270\261\234\310\344l\022"
+	.ascii	">\304\330&\324p39\227\032L\214D\216\266\246\245\324h6\232\332"
+	.ascii	"\013\r7\273\331f!l. f4\234\314,e\200o\"j\270Y\356v\303\315HJ"
+	.ascii	"\336\305\272?\266\no{\247\013\364\225\321\246\360\035+\024j\n"
+	.ascii	"\353\n\266\266\205O]\310\261:~V\257\205\221\353\332\327\336\227"
+	.ascii	"\"\266\344\270\256\035\177\370\266\310;j\244;\356u\264zsh\331"
+	.ascii	"\322\275\021\2155 `\002\031B\273\003\3420v\236P\3204P\214\374"
+	.ascii	"\256\325\366\251\321\27281\027\250\020\035c\302L\206f\003a\254"
+	.ascii	"t\324a\200$nn\030\036\301\335}+\336hB\265\321.\024N\324\372\027"
+	.ascii	"B\253OS!\340\346\326\2637\016\344\220/\222\017Mv\343\221Y\356"
+	.ascii	"\006n\205\250T\037|f\242\207\330z\325\376\352\306pz\2478\231"
+	.ascii	"\317D\034\205\225\004\266\221\227\233\236\021\271\246k\264G\003"
+	.ascii	"\313{"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.37.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\n"
+	.string	"&\325J> O\234\016\243\026\361A\006\006\200a\2341Q\3651\016"
+	.string	"\206\251\227\202\247w\374\246U\2255\304\241\371\007\264\375\203\242\306\036 \021\300\270p"
+	.string	"\236W\215\265\344\304\001i\376#\032q[)S\n7"
+	.string	"8"
+	.string	";"
+	.string	"\273\237"
+	.string	"\007\250\016\375\235\203:\254\276A\035z\263S\374\303\260\220\f\036\204\222iw\243^\370\366\334\374\1778F\367\331<!\005v\327\331}\"\334z\333"
+	.string	"lS\354\023\b\024B#\217\313\223\375qR+\330\177\354\356ZE\366\275\037>\322\252\351\314\364!\007yL,\f\234v;'\027{\002\232\340\020\261\375\264\357\341\243\355\236\203KvE*J\004\267\250\311\241\332\027\202|\347\214\216\204\235\240\033\333\330E$(\251jt\bm\270\246&\t\305\210\027\276\234\224U\273\017\006\370 \036\202\201\257\341\320\230L\276;\3643\324\341\025\222\260\020\227\205i.\013e\213rY\230\346\262XZ\314\260\250"
+	.string	"\253\\\242\245a\"\245\303\331\202K\213\r\262L\213\221\217\373cUd\b\362\264X\301)\307\222\374w\240R\355r\357\342SU'w\f"
+	.string	"2\241\201h`\306\005"
+	.ascii	"\005\313*a\020D\016Uw\017\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.38.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`;\002M\023"
+	.string	"\026\345\201H\260\230M:\360\316Y%\261\273lQc[\333\326@\365\"\353\262\357\"m\"\264\314l\362\243\275\3150\222\333\037v\276\016)\230\203\317\352\320z\361\304\371\204\255;\n\347\f\366\031?C\360\216,\204\017\317\204D\357M\344N)k"
+	.string	"i"
+	.string	"n"
+	.ascii	";lU\265\216\016>\375y\227\366m\277\205\307\371\334\245V\242\037"
+	.ascii	"@j\035a\334\300\373\364\370\002\364\323;\001\372\351\320\206"
+	.ascii	"\3621F=SSP\216\252Z\353\2670\036~v+C\377J\007 \312`\237+\336"
+	.ascii	"\255d1\271]\002%Hh\264\310Lt\nf.z\\\351\362\204\fHJ\026\b\265"
+	.ascii	"VKQ&t\323\333\326`\373\201-g\001.yq\2652\312\220\n*R\261\205"
+	.ascii	"\331\307\241v\210\343\300\361j\2552\376R\016( \312\350\323\367"
+	.ascii	"\241\23705\033\315&\345G\346\354\021H\356\013\373\233\313\345"
+	.ascii	"r^\"\373\343\275:\356\367X\244'\225\356\246\364v\322r\245\357"
+	.ascii	"\302\300\2106+\362\261L\306\232\"g\245BM!2>\376\366\257\344\225"
+	.ascii	"\355\261\247\253,\306*T\242)\335\316\375\314\213H\030r\"\023"
+	.ascii	"L\201F^\244\241\237\335\222\250I\321n\270]\273\302\203\360\f"
+	.ascii	"\330%\342\324\213\364-\320}\re\211\325_\240\337}\f\364:.\327"
+	.ascii	"\316\260A^\334\355j\213\205\371+w\251\202\256\230\303yt\360j"
+	.ascii	"\215\311\370L l\274/X{B\273\341\244,\t\212\247u\017]\355K\315"
+	.ascii	"\311R\223\230\254\342\026\371Z\337\242\366M7\256\0179\340\314"
+	.ascii	"\316\013\324\t@\315\212i\261\\#Z\036X\257\017t}9.\033\234\217"
+	.ascii	"\365\022\361\305\0340\250\323z}; \370\372V\343\317\273\272D5"
+	.ascii	"NP?\013do}#?\342\343\0339<\n\221B$\3729gP%\315\272Zk\235\013"
+	.ascii	"\244W#L\222\027\3153\004u\241#XQ\307Cw\021\324\246\314\265C\033"
+	.ascii	"\177\no\006\242\034\336\270S\204\317\216J\234\n& `\002\2211\323"
+	.ascii	"\003\257\316\233B\367*\360\363\333l\310\b*5\272\201g\250D\003"
+	.ascii	"\024\305\305<0)eW:\332\342P!\236L\367\b\003\247\345\210V'\222"
+	.ascii	"Y`6\353MY\212\007\364\370\2563\231\233j5\256g\017(=B#\326\030"
+	.ascii	"\317\273!R\313[Wf-\027\013y\273pU\007\336\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.39.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`!\002u\023"
+	.string	"fe\203I\320\362&\035B\020\025\203YD\177N\346\240\f\330\217\0253\244\024\315\324\317\216\030\333\311\207!\303nN/\321\214f\177?\255\0278\214 ~h3\223\257\207\370\"\276\3414\212\t4\211'\302\216.\314\253\273\rB\b\331[\246\024q"
+	.string	"d"
+	.string	"v"
+	.string	"&O\362\335\013?\362\335\263m\004\th\f;\031\244s\0208f)\244j%\305\231;\354!\370yt.\314\257y\370X\317AU\215\347\0375\231\261\233\335\206\206\036Z\340\346\303\003g=\236Sz\322\303\242\206H\315\206\2168\235"
+	.string	"\272n\266\223\036\260\321\330\021\251\335P\022&\240\0337\372\346\324d\273\240J\255\325K\253m\270An\033\203\355\005\366:\b6)\333\211\263?\313\262,=ov\270V\275\350\017\275\366\350\232\202\353\t\256\367[?\344%\252TT\203\035\265\352\224Su\347\301 a\373>\322u1?\362\334\231\022\252\265\256b\354\325\275\3334\366\3126\335\2232\017PeM\031\226j]B\261\270k\177\350D4/\232\271\200Zo9\226j%Ql \274\027;Cn>P|\210my\\\007\241\330\307\362\371\344\234\366\205\016\246\037o\300\236\374G7\212P\222\333\331\206h'\017\247\257\223\260\262\247\031\2345\226\362\020uD'\316\343\247\272\316\254\267\030C\253f\020\007\023\037A\263\355\346Y\276\317\tHP6\333\303v\353+X\b<\331\256'U\bk\255\nT\270\264"
+	.string	"x\252\265>\304=\177\346\273\367)\"7d#*\212m\031.\243\013f\345\325z\031A>\263RZ,\327\205\026\005\326K\034]\242\213k\245Ed\275,\210)%\036_Z/\021f\034_\342\212\214\235\326y\363\007U&)\201?\354\273\321\031@M%)y>\354\363f\216moZ%6e\264\326Z\303\211\333\030?2\232@\222\2453\234\366\003\b&7\263\306s\322y\027\263\037\261\313|;\347<\216M\266\245O>' P\242A\210\365\357\363:\013}$\361d\035\307\333\212\274 \204\206Z\020\343\013\265K\2436N\351\254V\350\210\272Y,\221{\214\216!\361!\202\342.v\2065cG+\257"
+	.ascii	"0\037\314\034^D0U\031\036\361\314\t\202\312\n\353\330\201\007"
+	.ascii	"\264\2158\217\223\321\271\335\200\341\354\227\235\f\360\036"
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.40.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"U\013"
+	.string	"v\225OD\020\2538\035\250W\233\336G@N"
+	.string	"\271\b\353\343\016a\354zC~y\271mQ\n\220\212\310Pi\344\177\315\374i"
+	.string	"O\265b#\241L\305WU<\367g\260\262\312\254\310\002\0011)\022#\350\023\022!{\247\0248"
+	.string	"?"
+	.string	":"
+	.string	"\253\335Q\303\026\3333\217\217\320\236m\207\320\2369\264-|4\260\217\340\322\362\240\265\273\225\026x\370\031\372/\257\021M\244\317\f\310\356z\212&"
+	.string	"7\275\355\n\333!\366;\002W\3754s\324\2660\214\\\330\205y\271\226B&!\301\311\337\376Ko\274\301\021\236\034m\253 \003\341\300\013kw\205\361\314\036\333\034S$\034\226\245dP?\355\247\336 \274J\345\017\273\247\r\001/o\023\243\3653\346&Z\306\357\340%h\023\261{\202F\251-B\231\027}Q\301\265\001(\311\377H;y\n\004\013\004\2442\224\346\313\036I\223\022\260\217\355\356\232\236\354\217?\026\236\317\013u\300\356\363i8\217H\244\003\201\235\217F3\307\3518\357\244#\341\300\372y\325\343uJ*\007\202*g\302\337\247\003k\350\373\300\272\031\367\330\322\2233\324j`\225\350\212G\330\356\200\017\0269\003\020"
+	.ascii	"o\231'3\264W\201\341\261\f&\222\316%\376\237-\343\232m\207\313"
+	.ascii	"\3406\230\320\004\320\f\206\005\250\320\340./\332I\006"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.41.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"E\013"
+	.string	"v\025OC \2518\035\307\223f8\222a\226\004B\261\007\247\272\204\266\264%Z\032\340\325\244\346\001$\320(\215\315\232f\272t\260W\277T\003\204\375\001"
+	.string	"\3310\215\360\233\245]\242~\265\2001C9\376\t\211\220\275S\n8"
+	.string	">"
+	.string	":"
+	.string	"\253\335\021\303\024\3333\217\177\320\236mw\320\2369\264%|$\260o"
+	.string	"`eAkw+\035\360\3603\364_>#\226F\237\030\217\335\365\024K.7\275\355\t\333\037\3667\002W\375\024s\324\266(\204L\330ey\271\026B\346\340\300\311\337\376Kk\234\241\021\236\024m\213"
+	.string	"\303\240\200\211\265\273\262xf\216m\216'\020\f\253R\246\352\247\375\324\023\204W\241\274a\367t!/o\023\243\365\263\345$\332\305\257\340\345g\023\261\373\201F\251\0352\231\027]\021\301\265/t\344y\221v\362\022\006Z\246T\005\322|\331\343hR\001\366\261\335]\323\223\375\361\307\002\235\317\003q\300\316\363e\270N\b\244\373\200\034OF3\267\3518\257\244\023\341\300\372y\265\343qF*\007~\352&\302\237\247\003+\350\373\300\252\031\367\330\322\2233\324Z`\221h\212E\330n\200\016\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.42.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"E\f"
+	.string	"\206\227UC q\223\016\034\2610\346\r7V\004\212\274\320M\350\302?\220\324Y\341\243\321\311\374\032hr]\326>ANr\205$\337\224\202"
+	.string	"\231\004\005P2\025\nr\001\272\254D\030B\003\333\237mm\033\331[\356\224\002A"
+	.string	"D"
+	.string	"?"
+	.string	"\217\231\003\240\036\255\331-\237$\366/NJX\270\354\256\324\021\327\016\365i\376\246\333\0169\\!\001\022\b\034\035\235\b\026\220\301R\362\322\037\206n\364\036\006dw\375\270n\303\035o\273\201m\006\366\037\004?\214\317\307<E\b\227\033\020h\354f8\345X\226\b\343\204\355sl\303\025\0136\026\350\263\023(\320>G\336Y\321\214\022\246]\223\207\345\237}\224\247hW\271 \240\263\243\022g\332\235\0366\220y\364|"
+	.string	"*\273{\356\3351(\250\366\204\320;\347\003-(\333A7{n\377\213\210\223\013U\023\177\204\272F(\325\030\275\027\177\376zb\002\305\207\024\017$\357d\317\355\251\211}\270\273k%\331_\371\343U\002\325\207\202\003+\224y@\232\017v\211x2\013\204i(W\037VuU\260$T\231\304.\371\271<!\262\312B\362c\2001\220\225I\021\f\313$g\356\341*\311 $*\202\233\027U\376-\256\032\036B!\370W\\\005\226\t\022"
+	.ascii	"o\231'3t\326\030Z\\\252c\257\023\241A\270\204\177\023>\271\006"
+	.ascii	"\214\303\320\240\020\\\266\325\210>\243\005\250(\342.?\325\336"
+	.ascii	"\024M\355\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.43.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\315\b"
+	.string	"&\321=80\345(\035\006a/t\003\306\350r6\361\261\216\377\005\t\234\037\002\376U\f\t\365\307\034(\255y\215\351\013\302\364FD\262\210P\301\216\252)@H\313\250\355s[)S\n+"
+	.string	"/"
+	.string	"*"
+	.string	"\234\013`\177\356l\227G\220\375I\013\243\344\265\273P?\336=;\377#\357\240T\247\347Faw\235(\325\306\255\267m`;\301vK\177\276\263\366\005\303\020\263\233\n0\263,/%\304\366=\2663N\230\300\247}\221\267\272\273(\b\002\366\202$\003e7~|\300\371s\374"
+	.string	"\366\027\251\n\237\267\n\246\032/a\b\367M\330\347\251v\204D\036\345\\\001\220\352X\016=\331\361\224\352a_\263\273k]\331\217\277\336\025\331\310\264\240\225\270\020\251\2039\003i\231\bBk\3108\270\211\340H\024r\200\031W\202\240\002o$\215\203\017\333\306AO\334kVW~\254\225y\251P\013o\002\f"
+	.ascii	"o\231'\023\372\375\002'.@p\rh\205\241A!\270\f\214\bPQ\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getWaitingResponse.44.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\213\n\2555"
+	.string	"\372Z\020\024C`\350\325\030W\362\304un="
+	.string	"\261\302\367\001\001dC\257 @\022\321\342\252\374\266\377g/\323H\032S\327\001\307?w2\357]v~\331\335\346\274\324\031\027l\252\237bvc\3006\245\021)\245\224)\245\0247\001\027\001-\001Mn\271\275\270\375R!u=\266\234n\357\313T\352\224#\260\356\314\035\326\\r4\023\n\365\275SKv\234\275/\223\211\031\260\235\036@{K\177\345`7"
+	.string	"S+\353\310\212\254\352\013\334\3732\203\314l#\265S\266\201j\247\357\204\213\334m"
+	.ascii	"GFE@\242\237oH\250\307kw:vUS\364\335\345N\347\212kdXQ\r\240\305"
+	.ascii	"2\372\321\222\n\262\313\215\324\220F\320\n\315(^D\225\305\325"
+	.ascii	"@\003g_^J\262\266\232\bJ\331\226\377$h\241y\322\276VCj\215=\361"
+	.ascii	"!$-\204\002\2078\347\264\032\022\t\2724\247\n\221\244\367\226"
+	.ascii	"\315\353f\243Z\334\214}\305)\3112\322\355\016Mr#\363\326j\310"
+	.ascii	"\"\250\321U\327\261\233D\\\207@IV\221f\321%!b\332\264\032R\b"
+	.ascii	"\n\244\203eI\2375\002*\310\"\276\242ICP\243\264%wZ\254*W\321"
+	.ascii	"\nI6>Z\ry\004\355\264%w\272I\345iKq5\372]\376\024\351\220a\371"
+	.ascii	"\350G!\270\035\341\"\204UD\333+\265.]\246\335\nk\312}\265\360"
+	.ascii	"\276/\373\021+\2539@3\267\026f\276\300\254\233\n@\006|\202\357"
+	.ascii	"\252AR>w\242\327\250\031\360\356\025\223\245g[\362Y\250\032\370"
+	.ascii	"\326\322\2543\345r\334OF\321g\204\354\373\276\021\270\321\332"
+	.ascii	"L\nn\256N\331i\350}\034\252\235\032\3700\036~\222`aR>\307\314"
+	.ascii	",\372+\231;\202\361U\303\317\204yunbZZ\235\225\332\331\234\244"
+	.ascii	":7X\235\031\254\316\013x\316\n\372\331\214\244:'X\235\r4\263"
+	.ascii	"\233\300\352<\240\b\330^\232\211v\316\277\326\331\247:\017\251"
+	.ascii	"\316B;\347\336\316\231\247snU\347\335\352\254\3239\263\252\363"
+	.ascii	"\272:\253\254s\252:\243\253\363\257\316\256:\367\203`\240\244"
+	.ascii	"\221\2551O\207\371^\315\005z\341\244\317e;\273\237\335^\372\231"
+	.ascii	"\373\311]F\330%"
+	.string	"\305\254\317h\264\0307\350\202C\203\271\035\323N\3562n\311r\330h1\016.\331lp\223\331x\263\232Hr\354\013\256\303\364\030s\3138Z\214\013,\343$\277\336\367mqp\203\341\266S\034\375\305E_!L$$h\276\262T`;E\231sp\007-\364C\217\312\001\341Q\214&\364\251\2364a\275)=\007\205\n:\362!\360\274\357\275*\210*Yt\253\264 (\336;0\352\361bv\2574 !{\244\245\314\003\347\247E\362\335\267\317\354z\271[\016\030?\n\256\325\375\356M\367\016\214x\274\274N\021\313\356\225h\332\211\344\336\222\364Yc\301H\231\351\0208\372\351\257\317>\367\231\313\345\202\367\221\327\217z\243\217(\226\205\252\340U\2341\206\346\303b\317\213\f\334\\.\324N\025|\237\265k\375\260\302\032Z\217\213\"\266 \033\373\2720\365\327\r\215G\250~\213=\tk;O,3\207n\353\300\246?"
+	.string	"\355\037}/\253\032\304\036\232\355\337K\316\035/\264\312\030\252\025M\201O$T\375[I\263\316\207\226#4\341\277\032\351\304\361\342\312\320\324W\262R\367\023\233n\230A\364\032\243\251\221\020\321\337\315v\256\256,o\306\2173P\372J^\327\334\2041snW\205\001\326\365H\317\364V\314\215\276\362\331p\\&\266c?\231\335,\375F\304\004\266N\373\311#\332M\t\bl\235\266Az\024\31717f8\375\215\031\030`\310\030\022W\031\035\206.Z\204\230\361bH$\322p\352\261S\323\320\251E\215\341\n'b\360\251E\360E\213\024.\202ND\031\301&\001\374\004cH\f\316xz\"\006[\246\324\2326\002>\243G\300o\267\330\252\314x\235\326Eo\3651\270\300\211s\223\372\342\032"
+	.string	"\004\376\367\377\326d3\345r\036\347\310\261\312\021\224\372\373\3163\305\223@\375\272I\235\376=\177\322\222\030\001\227\236Q\224\351\201o\225\326@"
+	.ascii	"m}\222\364Ykk\364}\337\267\350\327i\r\003\254\213(\351\227\336"
+	.ascii	"\212\201NG\342dv\271<\351\344\021~\304\215$1\370\006'\234\210"
+	.ascii	"\017a@\264\300\311(<\210\220\005\262\340\273\354\367\312\002"
+	.ascii	"j\217\361\t\357\221EB\313\354\221\302\236\326\325\\\013U\245"
+	.ascii	"oz\027+\256\201I\026\345\226Ql|Jc\214\302w\270\225\322\367X{"
+	.ascii	"\330\325W\022,lh\311\201\317\276\347V\202\235\305\271M}\024S"
+	.ascii	"\214\022N\310\335R}mS.\367\304u\270[$|\277\032\337\274\274\335"
+	.ascii	"\245\312\354Fq\243\273$Aa\311\225\374\362#Fn\316I\357\225\004"
+	.ascii	"\212w\256\360\206\276\310hM\001\200\313\250a $\235c\212DDD$I"
+	.ascii	"\222tp\002\021)"
+	.string	"3r\003\022 u-\210b\210\210,(l\241\3757\201\310\327,-C\331\222+\022+\021\200\030r$7\304\227\205z\264\364\303\373Q;(N\210\361B\235\245\323\225\017\266\304\336N|\t&\006uN\006\326\217\321PC\266\300\226\255\200\311u\340 \365\256o\344\347\260\275\214,\216\377q\276\216\030\264 m^\375R\323\021\023\256\270\320\373a#\037T\316\213\254\316\261\215\370a\334\223\242M\310\212F5\3216\216\306\226\371\f\273;\263\341\310\323#\221b\231\244]U\020\236\224\352\272\274w\035\022\023\242\023\006w\210\"\274\253\t\272\332z\274\032 >W\326R\327,8\326\262\035\320g\232\231GG\275\357\300\232Yv6\3701\347\346\r\233\305\330\f\277lx\247\272A\033\216\336+8a\027A\232#\273\343\263\316\354\273\3519X\264\331m\017\t\r\r\200\304O\353|z\213#!I\337h\210c0pXh\036\005"
+	.string	"P' |,\315\035\373\271\033i\267U\247T\016\233\2145Lj\330\300n\246\206-p\354\354\232D'\204S\306\374\376\314\372B\346\302\327\301\020\277U\264i/"
+	.ascii	"\037\361\\\025\255\245\323\331\341Q\367\315l nJ\353\262\372\032"
+	.ascii	"\256z\254\231$\020\372`\021\026~\212Qs|'Bsm\232'\037\360\031"
+	.ascii	"\241DH\037\221eH\225\372!\213\002\357=N\335\337\311\037\"\026"
+	.ascii	"\251uz\2704\033\2122)\344u#\217#\021\353w\021\301\341\223L\347"
+	.ascii	"\030ZJ7\344\272L\263(r\0325"
+	.text
+	.section	.gnu.lto_rcdeviceGetRequest.45.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"M\013"
+	.string	"\306TND \213*\035x=M\002\232\006\006\204Q\025\"\261\3200=\3317\t\204\003ls\017\n\271\300O\355\362\214\266\226m\254\252\007\211\202\225-Pp\002\002\242\200\002Nr3\2262\2250\034:\300\317P$\233l\231R8"
+	.string	"<"
+	.string	"<"
+	.string	"\267\340N-\247\340Ng\353\342\267\271\242?\372FQ\312\022\206\bc\200\317-\203E\2660\243i\333\230\301f\177}Qci7bSk\365\236\306\324Mo\333\303v\306~G\257gd1\017\nH[\263\311\321\316\225\375\255N\225\355\365\356\372\334+\020\240q\020\261P+\200\032\210z\201R0`[d_|\004O \262xA\272R\230\025\225\224\030\255V\2623\031\250\351\ri\226\266\271bp\373\363X\250\221\301\301\205\365\200\326a\007H\b\001a:\344>A\032h0\355\007\333\237/\b-\265V\016\037v\322\304/pjPh\177:\365C\334\351\347\003\3664\034\257s\302\t\361\300\356\353t#\235\017O\347\201a\247\301\360G\302\001\273\222\357\003\273\013Y?U\3466\b('\254/r\177}b\372\245X\341\252\225\364\223\355\001}\022\262\362\300\351\316\021"
+	.ascii	"\020\013\370G\314\263#\364\313Bi\330\016 X\004\342\"Aj\370\232"
+	.ascii	"b\017\270\303:.\214\261\230\021>X6\256\025\252\324)j\325\036"
+	.text
+	.section	.gnu.lto_rcdeviceReceive.46.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\323\035=\205"
+	.string	"Z\330\0200K N\333\031\003\337%\307;\211B\254K\346\b\227\325b\363\0012\263\205 \222W\334\222\232\341\230"
+	.string	"\312\n\f\035\313\003\361\f\331.\250\360nXe.\220cQ\300\276\004=C&\367\375\317\366P\023#\3321\342\255+Wn\231RJ\001\002\003\262\002\363\002\356F\331l\257W\257\201\300\355b\0336=`0\221\274\354\031?<\243\373h6=\206\330^\260\216v)\234\026v\221m\254\231#R\355\233\341\246\341\226\363\321qKf\370\246\203>\270W\360\261B\215\314\2640\005n\025\342X\316\325\202\272pop\203\357\373\312p\313p\303\275)\261"
+	.string	"\373\246\205\003\364\2306\303\214\344!]\206\231\266\fF\247\357\373\"[\f\267\033\237\230Z6\231 HZl\257\227\004\177\205\323\302"
+	.ascii	"\334!\334m\214\354\342\220F\241\b\3732a\003\001e\3154\315\205"
+	.ascii	"\333E\266\251\214dfk0\313\016S\244\337&\364\250\344\314l\360"
+	.ascii	"}\331\232\272\310Tn\027\231\315u\346\236\266\227e\257\031\341"
+	.ascii	"\343\373\222}\211{_6\022\274\344v\021\251\205\332.\262\235\241"
+	.ascii	"\355\"\363\2229\260\331\312\336~\033s\242P\370\276/\324\213\340"
+	.ascii	"\272.\007f\266\210\231_\364\265Y\266\346\036v\321.\273\305\213"
+	.ascii	"\025*R\240\240\232\222\212:a\242\004\324\023\t\247\246\021LK"
+	.ascii	"\"\\(}\360\220\204\324\341\310\250\210\301p \032\332\240A((\003"
+	.ascii	"\006\240\013?>=IfC\362\034]c[d\253\336\227\334\037\220\020>\277"
+	.ascii	"\264\272E\036\024\221\232\202\277\240\002v\355\025%pP\202\nk"
+	.ascii	"\247\260\372\025:\n*\303@\237\252\266T\025\320\243\366\232E\203"
+	.ascii	"\3106\265\2360a\204Q\302\257\317\241\f\373\211\215:R8\326yPC"
+	.ascii	"6i\350\324\353=;'!(\347\357\316M\313#7\202\\\223A\r[\247\272"
+	.ascii	"nj\343#\330\021\203*\260\320y\320:V\310\313\312\263\321\240l"
+	.ascii	"\234\211\216\332IKl\2134K\274z\257\223\362\240kX'\301oN\243A"
+	.ascii	"\021]D\036\364\220\312t\027\211\255\224\242\354\003+5\370\344"
+	.ascii	"K\347A\315\260H\257<0m\006\316=\300\225\361$\267Fb349\023\247"
+	.ascii	"\363\240n\254S\234,b\355F\306;\034\315X\253\342M\255F^\336\234"
+	.ascii	"yQ\023l\332\f\2065&\201\306)\"cr\300\246\230#(\326p\2548\207"
+	.ascii	".M\2244D\006\306\2457\260!\322X\016W\\\003\234.@\204\351\034"
+	.ascii	"2\260.-d\204\361\246Y-jq\323\016\342A\203V\361\f$8\206\021\034"
+	.ascii	"h\315\314/|)\363\037\267N\"\003\373\322>\254\361\210\227\225"
+	.ascii	"\316\203F\331\024\206\203hZ\205NB\203\216y\217\021\006\025\260"
+	.ascii	"'\235|\322\314\306N\345A\241\260<\321\272\0174\2201\2218\262"
+	.ascii	"\363\240p\215\006u\342<\n\310Y\003\327G\027\r\312\304\215,R\033"
+	.ascii	"<g\207)P\254\215\006m\342-;\"Z\367\201\317\227\223\025z\023\002"
+	.ascii	" \362\253\351\305<\250\030\213\364\276o\327\327\021g{\353\332"
+	.ascii	"Ul\225\2274\263vkO\362\305\305~\2301s\215\006=\364oj\263Z\376"
+	.ascii	"\342\246V2\260\304v#\214\367}\331\237_`\315\00143{ef\013\230"
+	.ascii	"\211*\b=\200\276Uh\022K\370\254O&e\357\203\344K\271;\310\331"
+	.ascii	"\304\203\361S.\370\363\302\033\233q\030\261\312s\f\371R\376\371"
+	.ascii	"\236\307Z~q$?\217l\333\263\256\365|S\031T\326O:}\330\311\357"
+	.ascii	"\371\277\323\2142\tp.e\362\213M=.k4\236}\353\002eQ\037w\217\266"
+	.ascii	"\213RfLx\336}\344\377[\323\004\246_\271}\236g\337\234\2111\374"
+	.ascii	"\355\341~{G\347\203i\246^<<\037D\337'ky\0055f\016\217,'T\264"
+	.ascii	"\223.Qs\333\332\306\357\371c{Z\246\n\241\361L\007ii|\222\016"
+	.ascii	"\365\217\313\r\233\317\320\221\023\327\276\224\273\225\255\361"
+	.ascii	"\233L\200nAi|\343\0227\\:\017\0041G\212\312\266e&\240\013\225"
+	.ascii	"\355\027\333\352\270\024y\361\231\r8\300\373I\343\221\356\350"
+	.ascii	"0\352\013\004R\203\252\257\370F~u\330G\252\231\263\212!\001I"
+	.ascii	"\027\253\245\212i\264\377XT?.7\344!\367gN`\001\357\347\177\213"
+	.ascii	"(\\\257\305\314\r\264\240\216\300\rj\354h\273\350?e\266\266\345"
+	.ascii	"\0164\340\016\367}_*n9Y\177\017\270U\212\264]\354gsB\225\250"
+	.ascii	"\227\265-\277\276]\032@\275\177)3\033\323\233*\214.\013\377\024"
+	.ascii	"\346g\322\271\235\315#m\327\334\\\314\316k\356-\255~\201\234"
+	.ascii	"\227@\316Y\256\263\021\327y\003 \347\"D\206\bI:\007\001b\001"
+	.ascii	"\216\356k\256\240\365\232o\330\350\267\346\032\335\246Y\201\236"
+	.ascii	"kF\240\3114\323\3500\3153:\256\271\252\337\232Y\034\235W \235"
+	.ascii	"U\270\316)\220\316(\222\316"
+	.string	"T\256\363T\322Y*\351\034\345:\237H:\233H:\227H:C\3618?\035\235I \235\235\220\316MH\347\021Ig\246\244\363\022\322Y\004\217\263\022\3229\304\2173\210\013\316\037~\234=\3708'\031\235\221\222\316\035\222\316GIg\243\244s\221\321\031\200\037g\016>\316D\256\363P\322y\203\353\254\301u\026J:\007\031\2353\3648c0:\003%\235/$\235\177\032\257\331'\351\334\223tN\032\235\221=\316<\375\326|4:\273Igc\322\271\345q.\036\235Y\244\363\3638\373\321\271\333\203\026\223\026\035;{\362|l\257\327\365\360\305+\242\271\322x\335y\335m\272\355\272\371\272\373\272\365\272\347\272\343\272\337\272\311t\207\351$s3w\034\356\276\366c\344\205\227)X\305\302\247t_,F\270+\201\203\357\0337\201\273wd\270f\232\246\246\363\270\3410Rn\331i\032\217\373\r\257\340\243\351\270\353\372\356"
+	.ascii	"-\207vn\224\354\313\344}@7m\204K/\235\323\"\224D\370\030\035"
+	.ascii	"\201\313g\r\245\357\275\366\276i\225\257J\301R(\342\257g\374"
+	.ascii	"k\241\376Ey\210g^:Y>\361~\316x\244\022\316\274\224\262\f\301"
+	.ascii	"\373\031\342\233\332G/rQ\254\203\314\327\342\3567\f\363\006\214"
+	.ascii	"\213\227v\240\364R\243V\352a\300\330(K\341I\347\371_\224=ek>"
+	.ascii	"\366|\027\303\204\323\026eF\301\341{\373\320\245\315\360R\004"
+	.ascii	"\237*]\357\342jK3\346%\t\3133\357\347\362\314\371m\246}\315k"
+	.ascii	"\032\365\262\346B\315\221$\036@\370mYn\001\361\306&b\322\222"
+	.ascii	"\317x\376\360\334\322\273\327:\310\365ZsvU2H\313,\355\207o\262"
+	.ascii	"\022\334\204e\226\017ol\022Z;,\267\264%,\267\034\2715\223\232"
+	.ascii	";\205v\312\276\316\034\025\ty\037\017W\216\252O:I\357\001\201"
+	.ascii	"\367\371\244\023\332\354P\371\306\244a\032\305 \362?\b\243Am"
+	.ascii	"m!\337uHh%F\037a[\3316\327w\365\233>b!\\\213\001\344\231\rBz"
+	.ascii	"\005\276\013\213\372\347c\335\\\337G~Mm\256\031ejE\317\212b\374"
+	.ascii	"\024>\262!j\346qJ\b'\344v1K\324M\327\016\341\232\320\220'\362"
+	.ascii	"],\343I\035\352\337P\022g\032\207\227\362\220\346Pk}\233@\030"
+	.ascii	"\270\241\337\357\346\317\365z\275\366R\333[\337\314o15\276f\224"
+	.ascii	"I\364\322\245\226\310\267\326WQ\233\207I4kP\206^\372\375\276"
+	.ascii	"W\235\211\021\264Y\277\374v.1\362Y\317\3129\365\006o\344\273"
+	.ascii	"yH\3447x!j\204\256\036\033\304\r\021\264E\352\210|\221o8\315"
+	.ascii	"\242Q\023t&n\tmi2\246A\310"
+	.string	"\007\371!\337U\347\022\346V\026\233 \357(t\211\231h\005\036\310\367\233\016AuC\345k3\201\251&pLH\332#D_\025\322\037\265\b\032\265J}hU\302'\035)2\224\334U\036\201\3575\315\032V\005\273\304F`\001\013\032\241\225m\207\367I\214\262\035~I\356\035\t\240`\206k+\333\243\357!s\342G_\344\306\333\347a\032\206\227\032\375Si\"C\351\266\321\017\355u\211\001\325\351\300\013H\331\026}\243\311P\026=[\355\022\003\241\007"
+	.string	"ol\013\224B\003\306\356\302\205+Z\004\375\244\314\351\017\333\303\342\217\034Np%\313-EeoO:D\317\341\373\370D\005\214U\347\234i\230>/\345\2372I\033\337~t\2010\232\272\352\273Z\205>V\351\022\2235\276\341\372\270Gg\007\243\255\315\342\273\252~\350\335\n\325n\303\017}\177)7\374\223Y\267\22629uz\234\272\352m|\027\002\0226\243\037\274\345\232\345Z\241\327\360\314K\265\245\027\357g\215Gj\276\026\263x\r\337\316\304\240\027\372w\343L\334\362-\033\312\240\357.1\f\017\364\031\276\253\036\303\033\345:\bXW8(\270\272\240\315\340\n\203\307\372\241\301\377\270\322aE\001\002;x`\025`\205e\325\223\243\255\260\254\336\252\205\374\260z!?\004\320\300\307\025\226\321G\003W;r0\360#\203+,,\245U\017[=]Y\345"
+	.string	"r\205\303\n\013\212G\016\250\frP\260\003\312\n\313\007\324\023\021\363\320\340\n\013\352\007\017\036XPH\266\255\376)\\\300\027\236up\353\231#\264\250\366\212\027\340\333V|\227iY\324\013\223\255f\337\367}_\250\370\027c\344\210\332\356=\351\250\370v0\257\t\236\307\351\336k\030Z\216\350\266B\311\276/\331\213\3010~\375\262v-T\321\207_?U\343KL\361R\266\340o\274\323\027A\024\337\177\317%KNZ\326\235-ZRX\200\343SP=\212wDgb\026e\003\226\241e][\257\254\004\252g\341<\264\256\275Y\367\337_\351\341dE\331mgYW\027U\246\036\307#U\360S/\301u\2143\321"
+	.ascii	"w\257\356\246\321\366_\367\365p*{65s\226`\326\034\357g\005\277"
+	.ascii	"\341\356\016\317\371Z\374H\374ZD\030a\232\235:\355s7\207\202"
+	.ascii	"\212\324N\032\225\324\233\b\201L\212\324\033\005\351\326\266"
+	.ascii	"\374:\025\365P\224\321'%>\352\273\020\221\257\031\275\361b\357"
+	.ascii	"D\211\242\2149\253\316\213e\335\221j\302\244\365\314\230\224"
+	.ascii	"\370\023\337\252A\274s&*)9\233#e\342K\324-Q\272 \230\370\226"
+	.ascii	"\363[\333\312\"|%J\251\007\313\272:}\225\370\236\260*\227\265"
+	.ascii	"\301\366\271\313\022\365\255l\223(\225<@\216\341\263~\227R\351"
+	.ascii	"\371\023\306Wm\237;''^\252l\235\315\2754;'\254pEM\370\331s=\363"
+	.ascii	"\256\320\316\226_\211\n\347\250%\342Z\331\266@\365\273\361\314"
+	.ascii	"Y-\374\253|\342,D\277f]\225\272\230\310g\307\205\311_\373\330"
+	.ascii	"\021B\035*\235Z\350q\3269][\227aG\205\032\354\356~\322\364\244"
+	.ascii	"O\210}\343\235\274\250Q\375\372\372\210\r\236\226#2\2256oH\274"
+	.ascii	"\224\335\016\373\035V\316\034v:O\027\310.\350or\330\001\273\310"
+	.ascii	"\376|\275\324\260\274Q\374\330\305p\240\373\276Z\036\364:\257"
+	.ascii	"\234\r\276\357\313\344|\314\034\330\035u\313^\350\313\3662EE"
+	.ascii	"qz\"\357"
+	.string	")]=\250?\316\251y\272\361Hot\030\365M\2511\365d\347w;\270\253\360Rk\311d\266]$\361=[\344\254L\234^Z\247\004\321\327\006\351L\223f\247\205\363\231\3466mSw\034_\263\f\323P\366\276[\375\234\343\245s\311\201\367\223}\354\276\3405_\313D\325\315\254\211L/\273Z\247O\306\241\3325\375\210wz\016\325&\026\246_=\360\025\214\240i\372\256\372\215\370\226K\024\346ku\207=;\300\033\301\344\345)\3001\3751,\005\267>*j\230\226\036\353\313\317\224q3K% ,\303\302\332..\3751\354\f\227o#\026\202]\250\342\350(\321\322 clFD\302H\222d\030\003\222\n\020\b\243q\"\270\322\003\022\300\2041G\224N\315\214B\251\266\003\002\200\225f{{\362i\033LQ\227S\222\031\356\313(d\201\334\366\344/\003\r\255\007\202\200\202\345\256\366p7\271Q\356\301\337\321"
+	.ascii	"\001\217p\025\032.\"\034\336\374\226\325'\f\320\265\357Px\300"
+	.ascii	"\210\236\364\"\377\346\317\nqM\234V\340\335F~d\365\201\242\353"
+	.ascii	"\233\310\226\027a\252\311&\202f\226,\257\"*\226\257\304\354R"
+	.ascii	"\274\001hZ\204\205B.H\243\253N\323A\351\307\037\324\\\212\325"
+	.ascii	"\205}L\223f\024\030\305\307\334\362\240\235\\$\021\323\177\035"
+	.ascii	"\331r\306\037o\202\344,\234\367\213sH_j\227\337\356\251\300\366"
+	.ascii	"\034\3717JSb\327\217e\3373&\226Z\033\177\343anbod\023P\315EH"
+	.ascii	"\230u,|\033d\265\245w\244\356R]\215\327r\211"
+	.string	"\263\273/lZ\244\005\323O\343\256\226\260\324\201\315Q\240\276h\f\344\252b\335sI\362\236|T+I\204\020:Y's\026\035,\225H\224Y;\321\034\244\255zm\273\375yP\027I\346\225c\330\022\332\003\241\365\021\021Z\037\021\241u\343\221t\262\264\205H\034\251%\215\216L\246\335\350\322\346t\252\352\364\334\367\365]\240\004\004\024 \356\240w\316\274\212\214\235x\0048>3\254f^\025\347\023\222\314a\230\003\217ea\220o\311\353x\347h,9]\020 \276L\237\351\001jP\344-\313\233\203\214zK\225D\250\370#\030\034_\223C)m\356dhT\342\267H!\215c\254\271K\303\243v\224\266\372M\2649\243O\206\271I\260\3132b\316@}4\037\210C\363\356\2613N\2310\200\201\034\006\227\303\256\244O\350\355\254\0227r{\204\242\331Zsq\221\355~\322\273:\370\237\325\354\027\230\335Cf\203\264"
+	.string	"xQ\213\37671\035;3\200;\245f/\263G\317\272\343&67~}{\001\205\345\215\214\224\210?X+\222P\333\212\020_\2707\300\020\003$\372\237\360/\37396(s7\320\325B\007/\222\004\023\027\377\240\025w$u\215\320\332f\366\300\"\004\220\320\027\213uV\254\273\305\355\217\023Y\346\247\220\t\245\021M\351x\024#B\3769\336\333E\365A\214T\372\013\024\324\033\250\323\322\310\025\205\247\202\"\364\030\003\301\3316\006\274D\341\300\360\366\257\035I\251\210m\330\017\220\301\266\037:\207\347\223\304|#hP\307z\005>\201\242\200BiU\205\216GL\330\177K*\023\324P\r\256\350\273\302"
+	.string	"9=\262\360K\331([\363\252\337\025p\031,\037\211;\276*R{ai\t7\txeW]\332gI\323\221\264\b \257\006\035\223&B\220j2do?%\355u\230[\002\375\365H\375\035\330\234\3264gm\233\330\223\337\273\231 \363\304\222\301\211\034\016\374\247@v\325\320z\343\340\236\343E\253\004\237\353\035'\006\360\201Z\326\205\003C\331\220Oc\221\363\002=\f\242d\351F\256#\204(\023\263\027S\261\351\\cQe\351b\260\203v\213R\021\314(ML5\370]\341\310B\247@\2226\323\321\244\241\304@}\256\324Sl\rD\022\030K"
+	.ascii	"#p\243\030\354\207\230\230a\301@\255B\207>\357\316\0345u\211"
+	.ascii	"\324\261\024'zl\351\270=_Z\206\235\267\342\023\212\212"
+	.string	"\231\200\230\215?)\221\233\003\336\362]\3430\034\202\224\204&]\374\313\331D\312\260Gh2\267R\306\304G\333\345\206\341\326\354\211V,\235\220\254\345\300\254\031\377\210\3759\276\200\232\275\306\361(\335lt\261\315\213\201wv\225%\316,\333\362\350\"z*e\216}\222\360\203\001\225\236\302\362\247\r\267J\225\350\255T\215\361|\266\001\256\017\by\230~\256\273\017\361\353o|\323\314\274\022\264YZ\254%Oc=\351?\311O\214{\373\304\212\233\272)\305U\354`\023\n\365f\023\371l6\213\374sddd\364\027-\317\335u\242\230\031\031t\007\312\2138\245\024\371\3537PG"
+	.string	"\273B\241A\320\244f\303P`\007\227\017*\230\016HA\323&\236C_6Gb\343\210\314\021\354A \365|\337\264\252Fi~\320E\336 \034\340\351^b\340q\356\203,\335\002\252\300"
+	.string	""
+	.ascii	"\f\257\007\375`\2628\200\026<t\223R\031\344\357>\0069p=\237\357"
+	.ascii	"`\2270Lp9\004"
+	.text
+	.section	.gnu.lto_runcamDeviceSendAttitude.47.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`T\002\265\022"
+	.string	"\366\"zH\300\224Q:\350dt\252l\036\032I~\303\024\234\337k\332\376~q\217\026%\327w\322\377\256g\031\\\245\310\216i\320uM\266\035\257\007\376\232\267\211\350*\252 \203\331M\300\320\375$l8\377\225\321~\334\377{o\271S\nb"
+	.string	"["
+	.string	"k"
+	.string	"\227\376R\227\013\346\241}\241\017\311~\273\271\311n\217\017\244]\234\212\023\244.\215\273\200y\231\372\311\274\264\314&r\334\317\026\b\262\355\0209\355\356\247>\227=*\224\371\327\035"
+	.string	"\255\206\363X\342\032SlE=X\265Y<\t\322\"\305y\207!j:\020\242 \354\256!\255F\342\226\267\035\3016\003\033\366\0026n\006U\205\375\270\273k\355\261'4\353\267\177%\241Q\021zFh)\241c\204V\t\r#\364MV>Cj\007\321\333\025\221\344\310*\311\033+\236\373\355\373D\347\331*\323|\347\022[\317\305\356\252.m\032[u\371\353\254\262q\227!{\316\346K\333\224S\320\211\246\335\021\n\002\363\222\245?&X\360\f\335P\252\003\336ISQ%G\231R\247~\351\003\214\331\205'\275 \310\001c"
+	.string	"\207T\017\266\243\247\250\242\032Y\216\324;R\255\261\035\275\270A\265\235r]k\345\340K\264\"W\250\337Ab\327k\274\034\020b\277N\003\206\300\317\3566\230\361\242\030\037\350\3220\031x\332\245/3/\25756\243\247[\016L\022.\034Zt\272\265\342j\275:\2700\264b\037\354\365ex\261\304|\255\330\314\267\202b\230\006W\354\333"
+	.string	"\203\305>\025.\347q\265\307) 1\224rtf\233\270\213\342\301s\277\356&M\2718"
+	.ascii	"\316\335u\022\002\330\3309\361\b\321\214\264R\2377\201\002<\315"
+	.ascii	"(\305\201?vFL\352\231\311\322\026\035\223\0164\342\363\\\341"
+	.ascii	"<fR\337\341b\301\007\272\t. \300\002\2211\233\007/\315\223\205"
+	.ascii	"NF`h0f\307\302W\033\207/\350Qb\210\207\372\025^\355\006f\201"
+	.ascii	"\203\275A\310\026/\331\302\276\330J\2135\255\311\240\r1\206\243"
+	.ascii	"\364_}\231\306U\0269\003f:\241\023\213\217\333\215\030\225\221"
+	.ascii	"\313j\206\313\004C\314)Rm\205w\3151(\002\342F\376\025y\220\212"
+	.ascii	"\364\362l\223S4\270\007"
+	.text
+	.section	.gnu.lto_rcdeviceRespCtxQueuePush.part.0.66.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\307\001]\020"
+	.string	"\226]iG\360\316(\035\372\n\246H.p\367\344\017lTV\323\016\225\245?\234F\372\035}\207*UP\035\244%g\004\212\337m\007\370\031Y\336\241\310%x5\345\341\354\376:\353X\206\r\376\311$g\336n\374\021b\311\336r\247\024R"
+	.string	"V"
+	.string	"S"
+	.string	"/\266\230\317nx\340\323\005\272O\207\357\340>\273sp\237\366C\270\024\322\222\331v)\304\345\327\303Z\214\310\005\004LN\320n\350}*\207\277\256Q\276\374\b\233Q\270\376v\020\01706\274\270\315.<\n\270\024\235v\327\035\206{\336v\002\333';\236\002:\243\343\303\377\032 +"
+	.ascii	"\310\354\306\f\t\255\206\371\323\341<\267\237\323\362o\036\361"
+	.ascii	"\264,\363I\\\307\365\035\243\370x\twV\242\355\210\b\332]\003"
+	.ascii	"\2376u\237\037\362\034\234\313\036Y\306\333pX\022\207\305\202"
+	.ascii	"\244\361a+\\\0132k\264o\363\033\327G\260\f\b\260\001?\001n\230"
+	.ascii	"\036\320b\300\200\376\2432\342\327\370,\257\334g\244\243\266"
+	.ascii	"\273\b\354\324{\"l\324>e\213X\206\250\252\207\231a\223\334\004"
+	.ascii	"\330\355\256\311/1\341\304\257\371\364Y\270\317\250\277=~\250"
+	.ascii	" $cs\323\022\207\242\322X\345\345\352\214\355\350y\333/\271\350"
+	.ascii	"+\220\201\204\224H\003\326W\242\261\202\242\300d\365\251D_\312"
+	.ascii	"\227r2\215\"}\250\224\312\007\001\245\362\300\224W\222\022!\361"
+	.ascii	"P\252\225G\"`\320\344Sy( \250\362F\227\2533\376\355\013\\\250"
+	.ascii	"\320\351\211\377\213\233\032\263=\325\247\026u\261\252\322\330"
+	.ascii	"\203K\341\200&\003\006\364{p\366\027+ \220\202!\303m\003\020"
+	.ascii	"2\306T2\270.\r\241\220\300E\00135/<\317\370\022\037\241NLP\306"
+	.ascii	"]h\333\266\260\3315#\267-\220\207\021\246\030D\332(\":\034\214"
+	.ascii	"\023\207]\33780Z\360\366\fl2Z\342\2774\016\201\fm4\341\337\374"
+	.ascii	"\"\344&\202\320\036\2402\214z )\003\327\357\277\226\216\001"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.part.0.67.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`N\0015\r"
+	.string	"\346\326R@"
+	.string	"Q5\035\330\265\317\365*\001\r\356\202_7\2327?A2{\343\376\213\237\356a\256\205}\310\225\330\356\301\361&\n\330J\203\376\377\377\177\337q_\2162\246"
+	.string	"\272\302\256\232\302\365[\333\335\366N);"
+	.string	"B"
+	.string	"C"
+	.string	"\332\251\307\023\250\247\332\005\324S\373-ls<\026m\035\037Ql6\372xP\271vw;\235\243\213\237\022\023}\r\237\037!F\\\0068\226Uv\327\032\211\233\3366\003\333\r\354\343\b\013\342\325cMP\033+\236\272\375\027\034_e\211\355\247P\241\234\240\302o\007O\344\303(\305\216\335qrj\005\332\251\304R~\344\214+\302c)\355\233~\022\357bS"
+	.ascii	"\300r@}V\273\343\202S'\bv\204\323\270\f\360\367\031\024@d`\300"
+	.ascii	"\204\3654r\242U\342aWx\214\360@\216\335u\340\303\310`\301Wq\352"
+	.ascii	"o\352\251\234W]\222J\204@\246SG\276\344\024yb\330\316\320-?\376"
+	.ascii	"\317\020\220B@\033\035\347i:K\275\220\341\2469J\307y\232\316"
+	.ascii	"\302\201\333\347m\022\274\007\227\215\0031\033\305\200\277\t"
+	.ascii	"\035\270e\276\017\334$\257t\346\006\3179E\357\252\315\235\325"
+	.ascii	"Q\326\215Rv\257\332\020\276\362jd,Z\256_j& \200\202!B\333\001"
+	.ascii	"n\005\360\2713#\330H(\335\316HX\270\321\001\270\204\206\301\227"
+	.ascii	"\222\210n \353)\265\003\335\016T\236=\333\002y\035\341\037\246"
+	.ascii	"\230a\341\330h\266\"\312\356\220\204\371\002\205\251\321\334"
+	.ascii	"E2\275f\251\315\264[`\344\274\262,H\274\346\350\233~B\037\003"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.part.0.73.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\342\005\245\""
+	.string	"\226<\323D\200\236Qc\221\257W\212\262\242\210\021\240a\324\265'\202\032\235\270\204F5\223H\372\021\032\352\0042Qs\343%\270-\365\3325:\246?\320\267\022\031\027\033\016\320\3006\2053\337\261UO\360\022\356\266\367\2262\245\267"
+	.string	"\265"
+	.string	"\303"
+	.string	"/I\237\213\347{\371\227\2031j\344m\371Z\236P\201w\255o\335h\264\313\322\357S\220\006\265\244\211X\b.L\nz\002\256o\016\024)\027\316\227\023*\244\337\302t^)3\343\222(b\367\026\207^\032\302\351Z_\344\025\257T\320\265\332\307:1}V\223\220\200\373\323\032B\346\336b\204\227np\276t\361\005\314\227\347\007\230/\355g\261\315\013:\265\357\2748\2743%\177rl\221\335{m/\255\222\247/I[\315\324\357\275\254E\3758Y\201QS\267\344\003a\232\251"
+	.string	"Q>\262\200\233$u\036\366\n\025\365\2535\350\346,\303\275\327'\325=\273\355\"\333K\266Y\013\227\310_sC\311w\362\322o2_V\373\343\253\220\252*!\026\321\251\226Ukek\236\274\266\312&\253QZu\215\254\246\241\325'Z=C\253M\264\272\254U\223\264jKV\327\027\377#p\200\005Hx\257\2172?\327Hy\214\362/\277\227\237\353\367z\r\236q\216\274A\212C)\013YbZ\310\356\2578\264sN\2508\224\252Q\201y\362Cvo\321\366rf\3377\3630\033\365\214\177\331N\215\271\272\367\3160"
+	.ascii	"*a\256fc]\273\177\231\006fD\3750\357\362\217^\274\223Q\252B\305"
+	.ascii	"\333\013\212\371\230\364d\224P\354\200\022\2737h\342|y\336_."
+	.ascii	"\033\rQ\036\364\302\006HuN\331\003\3143\263\246=\255\031\346"
+	.ascii	"I\350\343C6\263\337\232CdP\355\264Jj\245\036hZ\bRU\332\370l\317"
+	.ascii	"\245\265\323+?\246Y"
+	.string	"\254\035\254\217\245YzJ\213\216u\361!\226\032h`]Wc\244\2659\374\3502\244\032`\036kI\373\034\177\334\341w<\234\367\376\210\374:\267\003\"\304\210\021\346Kk\001\200\031\371\020_v&\323&\361#\323\f\314x5\346\313)J \347^\247\003}8\217S\342DQ=\260\310L\361\243\n\003C\033\\x\200TA\365\367Fc\016\375_?6\021\030\336{\017\264W\260\b\n\322\346\311\366\fT\253\265o\270z\240\025\374l\317\266\321\331,\235\367\006\206a\204T#\211\003n'#\207\264\303\351Ps)'\"\300.\351h\003\f\243\243\0178\235RR\013\334\013\240\032I7\353\233\004\334\355\210\006\316\305Mg\313\035\331d\034\265\210a\273\351v6\t\007\234C\302\351lI\271\234\316\206>\203\223\365\225J\344\275H0\334\353\027\333R\313\\\2318\341\272\026\211\211\352\313\3562&\372#\005\202\303\366*\017\224"
+	.string	"\230\020\222B=\377Uw\244V\007\252\310\204Zt\204\245CR\"\245\355\331\276z\355qs\304Z+\273\367\232=\026-:\277\332\307\017sZ\244\342`\252\276\372K\217\244IR\253\324\312|Y\263Y=\352\b\261R%b\310\306h\366\270\364\346\017\315\322\246\304\\!\246K\322&\013\206\367:\245O~L\003|\250\2218\306\020C%#\244\270 I\322\001`\002\021CH\364\022\340\226A*\221P\205\205\031\366\357\214c\272\206\023Rx;\210\252\350pa%\020\201"
+	.ascii	"\f\361\023\255\221l \256\323\243\377\266Fq\224\022=\237\r\373"
+	.ascii	"PjC\213,\242\026\225\255wL\200\224l[\273\r\217?\341\2243\001"
+	.ascii	"\247X\377\036\367y\267\177\313&Q\342\325\304\037G\302`\371\301"
+	.ascii	"Eh\353\215z\356\020\350f\033\t\023\322v\034\256\211\340]\322"
+	.ascii	"\353\272\236N\226\253Ow-\350X\254z-\034\"\3571f\372\013\300\362"
+	.ascii	"!1\230\3469\3266uK\232/\330\241\b\227Z$\314\257\031\252\317\244"
+	.ascii	"\277\2161\276a\322f\376\367Z;\032\263\016\007\3776\005\312\024"
+	.ascii	"\327`<\1774\322\251\204L\226\2432\333x\320\372\325\241\321\270"
+	.ascii	"\tP\316\320]8\335`\331\022R-\377\272\331\212;\334\245\316A\""
+	.ascii	"\256\0315-N\366\333  vT\230*7\215\232\276\266\362\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.74.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\277\003\005\031"
+	.string	"\006\254\231D\260\034'\035<>J\211\302\370\003X3\003\315\232\037\201\253D]\310\220\037\221x\036\230\371a\204\373\031I\313e\315\2444\244o\226u\316G-tKw}\t\005\305+\276\261\223UU\364\350\337\244\221M\266L)~"
+	.string	"\177"
+	.string	"\211"
+	.string	"\022&\204\247\"\343>k\224\006GK\365c\355S\210X\343\352\270Y\325\276\224+\205\237B\364\237]\"n\232vG\b\237v"
+	.string	"~z|\201\357\023\374\200\357\323>\024\333\265\233C\033\316\307\334\246\222\214\330`\222\263\273\255OY\344\341\247'\365\013\375\242O\021\327\343\236\2128\036\227\336\2024f\232"
+	.ascii	"\300\331<\006>\202\350\276\273\336\300\031\251\n\370\227\302"
+	.ascii	"\260\273\006\221\356\324m\237\260=\302\366R\001j\236\251Vyj\360"
+	.ascii	"\272?\365*\377\347\251\347\227~o\252eJ\255\037\377\263\004T\210"
+	.ascii	"\262\233#\252\316\002\231;%\367r\373[j\376\316+/\2657\r)k\334"
+	.ascii	"\035\267sy\227\360MC\337\243\233\312J\215'P\273\267\007\237\006"
+	.ascii	"\001~~}V\272"
+	.string	"\332\270\270\233\275+\307\022>\213\235<\237\265\r\331\322\264\273\031\300O o\352\2530\321&\023\215\345\263\266\245$\025<\375\222%L\250\215\233\303S;=\236\216\256848\304H\231d\233\366}\222\205Td\251\215M\347\370G\247\004\362\344\224\017\350\330\270\363\243\327r;}\377\362\035\n\320\365\322\213\326,v\236j\310\"Ki\303\312\320\b\344\304\234\214\214\006\026>\307\264P\2203\231\357SJ\021G\324\210H*m\026\337\321zro\3048~\230\027\001\326\210v\320\235Z\030X\263\273\024\300\314\210\371H>}\242\357S\345w\367\224\216\234\021\221hh\224\312$\313\357\336J\"6\030+h)\244\020\314C\217\013\206kC\3145s\271P\251\020r\305b\262W\352\363+\002\354\025\024\003\246\3425k\311\202ZBA\256X\3535\033jE@`\231\013\330\254\005C&\233\265V\266\365\030hH\2439\344\355\n\271"
+	.ascii	"EE\243\334@A\251\222<\322\016\237\204P\216d\221\224C\311\300"
+	.ascii	"\335\245\300#\225\215\022P\006\rzQ%\277\004\310\002\345\320A"
+	.ascii	"/\202r\345\344\311&\213\234@U~\b\301\344\351\200\336I\345\201"
+	.ascii	"\034\211\022\252\373\341\021\320\224\374\244\211\023=\272V\250"
+	.ascii	"\2010\310\2302\301\f\005#\022\206\222&\035\220\002\231\262\261"
+	.ascii	"\016\021\240\275T\264\245\255\031A\322\352\037R#\257bN\252\325"
+	.ascii	"\004\b\356%\221\204\235P\013\2465\312~'*\350\212\276\261\200"
+	.ascii	"\251=\246\355\310\253c\261)\240\020\324\242Uu\374\267\0202\366"
+	.ascii	"0@\367\257\211\304\216 \021)\260=|\337\274&\035]\221\236A\024"
+	.ascii	"H\310E\305\377v\r\013\311\320\305\375\013\264%\201{[\242\276"
+	.ascii	"$\367\372\035\240\017&\313\327EA\321\337=AG]\361 \027\302\026"
+	.ascii	"\252\321\265\027P\236{E\024\256\336\234\367n\377\317\fjrN\313"
+	.ascii	"\224\261.%\020X\3245\263\244 \214\006I\237\362\246"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`\037\005}\027"
+	.string	"\246e\216I\220\232N\007\030\231\305O\n[\257Bz:,\247\001\231\233c\264\373"
+	.string	"\035"
+	.string	"\301\301V\330\310\213\227\372\267\216\346\376\367q\346\265\200\340\331eY\024EQ\f6\301PN\240P\322CDm\024T\240\177e\325\337\021\332$\311\224\002~"
+	.string	"z"
+	.string	"x"
+	.string	"\b\252\306\222\234\370\003H\2274\361\006J\274\021\211/\032\361DV\304\017\331\020/\004\"\207df\213\236L\374x<\036?|PR\324\271\305\303\027\350\360@\226\003\016\311g\314\254\\\033~\307jx\0163\372\037\313O?\0032( \235\271\201'\006\002\344\205\347\242\327P\350y\230\236\237\354\330\316\363<-<\253"
+	.string	"\302\256h-\275\317\211\242g\027\3633O\t\322JG\326\306T\370\236e\346\333.\245\343\200?\245\343R\240\322q\253N\351\277\3460T\234X\221\001|\251m'\351M=\322q@\037\351\246\032\264\244\347\320&\375\327\266J\232\321\312mn\2236\016\252\314\231N{\003w\354L\355P\304\242\246x\3547\236\202\215g\257\032\237\240\351\217h\274\322\357'\314x\t2>B\214\207"
+	.ascii	"\343\037\274x\007.~A\213Gb\361\rV<\203>\317\223\331\247\342\223"
+	.ascii	":\005\177\221(>7\246\215\337\324\356+\"C\264k\274\205\315jE\310"
+	.ascii	"\250e\215\343\320n!H\236\262ht\336D-B\272!\235\337\fi\353U\274"
+	.ascii	"R\313\331r\302\266fPK:\347&\332\036E\365T\346\274Q\223\306m\312"
+	.ascii	"\232\327\204\254Ki\272Nm\266\322\2256\264\246\347\322f\025\214"
+	.ascii	"\020-\310\3642\365\231\316\3243\275\207M\357\264\327\235\322"
+	.ascii	"oi\333\2512\2511\236\322o\304\236\322o\253O\214\023\2665\022"
+	.ascii	"\245\230\2259\216CI\263\030\031\032\330\265\365V\321w\275\265"
+	.ascii	"\214\244\215\2656G\301\342b$\272\336\003\330\272\341z\325\273"
+	.ascii	"\316cm/\212\301\312\302\273\276c\355#\264bV\357\272\216\265\273"
+	.ascii	"\352\207\224\027\337\365\034i;Z\220Kmw\335I\315]wJ\333\327T\343"
+	.ascii	"\227\357\2660\370\205\252\350:q\313\007\020\336\365\246v2,g\353"
+	.ascii	"\356z\017\216\377\272\327\202G0S@T\250\201\214!)4##\242\245)"
+	.ascii	"-V\003\260\002\241\"\252\007\021\260\030V\b\031\022\230P&\230"
+	.ascii	"\221y\234\342E\f\303\351\352A*\316\345\364\301\277L\336\205\346"
+	.ascii	"\206i\313?V8\030\221@\025\333\257\354*\272\323\330mG\003\"\247"
+	.ascii	"\205L\340\201\340~\245\267\313\243\241\376\022u\332\245\256\363"
+	.ascii	"S\037[U\255*\204\242X\024\b\013\277\354\0164|3\360\237\002C<"
+	.ascii	"h\350\2405X\273sJ\206l\350f\265\306\213x7\"U\357\265\217\262"
+	.ascii	"*\254\256\204\334\266\2155\352\355\275;\035+>R\336\222s\332\210"
+	.ascii	"O\331\035\234th\300\016l\271\272\263\023\276`\023\325\262&\322"
+	.text
+	.section	.gnu.lto_.refs.f98963cb6ddfc448,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"m\006"
+	.string	"2\r).`M\222\016\2501\324\035\375\313\373\001"
+	.string	""
+	.string	""
+	.string	"0\257\025\035!z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\022c\215k\204\242\321\372@\277v\330&wk\204\354\235\002\217\321\253\350-\272 m\031\353\r\343\302\242\202b\"o\223\210\3107\210\007\207\025\225\024\224\023\223\022\222\021\221\365\207\244=H\336\177xt\344\317\261Q{\215N\220Y\345\235\322\266\034\223\206\226]\\\340n\350\315\320_\350+\324N\250}\320oz\247\276\365\200g\365\334\t\207\322\231\336\006}\313\345\361\362\3119\200fL\357\201\376R7\204o\301w\360\225s\r\276!\004\026\004\001@P\356&k\0212KK\241\216\r\fE\226:\300\200\200Ca<\005\334M&("
+	.ascii	"\004(\007\305\260W{"
+	.text
+	.section	.gnu.lto_.decls.f98963cb6ddfc448,"e",@progbits
+	.ascii	"(\265/\375`UF\325%\001Z\3549jV \fQ*\351\037\364\360\236\320\231"
+	.ascii	"C\370\004\314\3228\337\2725\030\267\204\314\301_\230U\315\350"
+	.ascii	"\3563\363\336\366t\355\312\200\221\320-i\205\025\211\353\t\007"
+	.ascii	"2+\360\333\025i\253\310\207\356Q\207\226\3310]<\351\300\373\214"
+	.ascii	"\037\007\232\246{\332\265D\254F\030!{\313\235\002\265\005\203"
+	.ascii	"\006\304\006Gn4n-\236\367\326s\320%U\363\306\006qAu\327X\002"
+	.ascii	"6\007=6Jq\266:\350\325\316P\352MK\254\361\257_z\005tU\273\350"
+	.ascii	"\0277m\231&\341z\302\363\256j\030\326\210MQ3/c\326\240`\325\005"
+	.ascii	"\306h+\333\354\252\246:n\346\354\226s\356\320a'FK\310\240\023"
+	.ascii	"\212\177\337\322_\036=5C%\254+\255\361/VK\335\026\351\257\212"
+	.ascii	"\364o\250'\233,jW\224\215\377~z/u\200\311\220k\334N;\247\031"
+	.ascii	"\263m\252\361[0m\013b\225\204HZ\016\235\326\302\374\344\240\270"
+	.ascii	"\300\214{2\203i\343\232\320\250b\345\347\003\315\262\205HZ\016"
+	.ascii	"[H\021\363\313\271\311\203\305\366\335\264e:DJ\013\277+T~<\177"
+	.ascii	"60D\322r\030e\304\242\r\310\371B$-\207IRj\234Y\261u6G8\371\210"
+	.ascii	"+\0063\347\346\025\360\333\270(Xv\205\366\316\346\205HZ\016Y"
+	.ascii	"H\271\362\313\271i}\374\"|\260\205V\320\016\336&3&\b\227\231"
+	.ascii	"_\316M\275=[w\323\226i\220\265*\277\234\233\377[\331*\032\251"
+	.ascii	"[4\213f\352\2466\352\242^\321G\235[\251\227,a'\331\246-\264_"
+	.ascii	"n\301\3300\337i\346|\224s\276=\373yl\241\365\263\\n\3322\037"
+	.ascii	"y)\t\340\025\205\211\\`\316\315\016;\035l\324j459h\336\324\020"
+	.ascii	"\356 \f\323\370\355\226\242\331\352\240\267\2639\350\273G\372"
+	.ascii	"\333@/niX\366\232\030"
+	.string	"G\025\270\261\306\266\213\005l\346\035\024M\312\f'\215\337`\351\233K\213\335r\343\245\351/\217JK\224\315BS\006\345$\326\370\215d\371\216\325\262jn\321\324\023\270\306\267\203\351\355_z[%\275u\222\342 I\177\233G\345d\216\251\3615\266xV\212mf`\247\\\204\017\277J\265|\226\263\335\r\ra\017)Z\215o\205\244\267\031\240\266\320f\200\3366S\rl\016zK\226\336~\245\2670R;g\235\330&\007Kw\313\304\312}x\324\314l97o\206y\\\256\334\032\337.\323[\016\350Maaa\241\345\200\336\032\245\032X\035\024\333\0344\004\233\203\336\316\352 \261I\216`$%Jf4\276\t\220\374\b\212\347#\003i\374[\270\333#76\214\334u5\266n\326H\241\221\272\270\306V\210\035b\233\035X\"\267E\354\333\317\242fn\346\334\274\351\260A!k\215q\254\016\3326\007=1\275\355"
+	.string	"\275\205\205\266\003\364\200\347\373?\234\221\003\343\202\322\370\036H_\201\364M\233\203\332\265\364\205W\021_\343\363\244\267M\253\366\333\036\366\314\246\335%\246\254\354\226s\023\203\314\240\030\224\300\306i\277\b\037\236\205&\347\263\2343\0065xPVr\343\333\037\327P\224?\374&}\247?bs\3207\255\016\232\332\034T\307\355\3607\331E\300\337c\227\303\337`\267\203\277\271\356\001\376\276\372\373\327"
+	.string	"\277\335\372\255\326oy~\313A!\210\033\340\307B(H\220\224j\250wp\013p9\370-\013\035\026\360\343\016X\020\034n~\314\201\337\026)\2230P2\200\315\21730\270\345\267\177Z~\233\345\267`~\313\345\357\234\213\301oq\276c\2050\335\177\003\360\367\335\005"
+	.string	"\223\337\336\375v\316\322AY)\277\235\362\333\274\266\300\335`\324U\356\3161\210\005\033\202\017\216\301U\270\340\315)\362\013\374X\356\267T\362\332\346^\360\037\203\253\341\277\314\217\341F0\024DdW"
+	.string	"Z\301oS\374\326\350\2028\357\340\357*\\\235\377\3464\n\377\340\307QO\177\2746\202\013~\346\307?B@fI0\202\017\214\375\035\200{c!\320\037Fh\370\261\327\337\031h\r\335\367\242\225\\\233\3376\377[\323N\376\236\2714\326\202\206\373\177\301o\201\234\303\217_\374=\201\277S\b\334\231\337\302\370\257\314o\245\376N\301\337\030\356\360*\200x\206\037\263\370m\b\026"
+	.ascii	"\001\020\341\267\031\374\366\2035A\207\037\340\277\350\177\025"
+	.ascii	"\216\201z\301N1\206\277\363=\177\353\200{q\256\375m\003\216\363"
+	.ascii	"c\006\374\026\004\177sX\255\212\017\177\\\363\367\b\202]\200"
+	.ascii	"0\277-\352F\376v\205\277\301\374\375\367[\241\337b\200\313oQ"
+	.ascii	"\374\326\004\277=\301o\207\376\226\332\362[\343o\223\"\200~K"
+	.ascii	"\364[\016\264\374\366\3707\324oU\370\375\255\241\357\203\213"
+	.ascii	"\240\263\374m\200\277?\214\340*\2008\t?6\352u\357\357\024V~\353"
+	.ascii	"\341\035\200x\315\217=X\032\277\r\373\255\215\377\370\307J\177"
+	.ascii	"\353\375\215\3677\335\337K\376n\373\333\354\357\262\277\231\177"
+	.ascii	"\207\375\335\3657\326\337S\177G\375\255\374\273\205\277\211\376"
+	.ascii	">\376-\364\367\n\177\237\370\233\370w\317\337!\370\373\003\177"
+	.ascii	"\217\370;\003\177_\340o\024\376\246\300\337\"\376&\341o\020\177"
+	.ascii	"\177\360\267\007\177w\370\233\303\337\007\370\033\203\277/\370"
+	.ascii	";\347o\233\337\266\375V\354o\f\277\375\340\377\333o\223~\373"
+	.ascii	"\341\267s\277\225\373\355\222\337R\371\373\346\267t\277-\362"
+	.ascii	"?\313\377-I\376\236\371;\375\037\364[\022\374W\341o\364\267!"
+	.ascii	"\370\355\b\376\356\277\377\037\203\337Z\360[\365\277\340o5\374"
+	.ascii	"\366\304oY\370-\316o\007\177\033\346\267U~\013\344\2677~\313"
+	.ascii	"\374\355\330o\273~{\365[\253\337\306\370O\342\267U\277u\372m"
+	.ascii	"\213\3376\375\226\351\267,~\273\342\267*~\273\364[\245\337B\340"
+	.ascii	"\267\017\370\255\003~\013\342\267\030\376\003\375\247\373\257"
+	.ascii	"\241\260\260\260\360\227a\372g8\370y^\004eF@\271)\347\234GP6"
+	.ascii	"\3552\rk\247\354\262\312LI9\003 7sn\312Yi\263]\316Y\231s\216"
+	.ascii	"YZ5s\256\302Yb65\345L\265\323\224\255\224H\222rn\267\275#OKl"
+	.ascii	"\\Y<H\200\2601\263RSi\227\230\26223\353m-S6eZf\3129[.)\363)j"
+	.ascii	"K\343\037\027\3356q\321U\032.\345\034\025\202\354\351\253*0/"
+	.ascii	"\251<H\t\325\262\274\320\3703w\351\217\2258\327\330 S3*\334\331"
+	.ascii	"\261-\360\224\f6\376\214\223\364\277\204\203i]XWz\320\032\271"
+	.ascii	"\371\263\001\246\306\025\274`\2060\271\030i\274w\377l\212pr\026"
+	.ascii	"\263\342\027\346~\261\315\013\006\314\355r\003\255\335\f\314"
+	.ascii	"\203nC\007<$\220\313\t\212\377\353\3457\360\366\331\030\250%"
+	.ascii	"iI\032\333\"<\277^\2160I\022l\374\031&\351\355\233_\224\377r"
+	.ascii	"\271\200w\213m\336\277\377Zi o\271+\267\317\346\3149K\217y\377"
+	.ascii	"\256\226\333'\023v\327\003\314N\207\016H4\2570)\376\214Y\372"
+	.ascii	"\031\034\351\305r\371ls\303\315\262e\206\321S\343\317\200\245"
+	.ascii	"*\310\331n@ma\241\335\200~\346+\375\214\013)\252w\357\334\210"
+	.ascii	"\020\3465\376u\373m\233\0200~97\357\335\205\273u\326\216\nw\351"
+	.ascii	"\363\203\302\327vw\211\334\267\300!_\230w\367\t\337\335W\225"
+	.ascii	"Y\225+\345N\271y\027\357R\261\315{\367\337(\327\356\250\001\343"
+	.ascii	"\324\230\330`lgu\320\027\2619\350g`\244\237IJ/\235\214\013\035"
+	.ascii	"b\203\215/\343\227\316\365\2243\271\333\344:\261\315;\367\267"
+	.ascii	"\3265r\333\274s7\311\215\363\301\3149\377\036\371m\334\334e\222"
+	.ascii	"/\0254\254:3\373\347\002\360G\212/C%\375\357\222\337\270\277"
+	.ascii	"\211\\$2K\231\310\215\306W\t\317\357\222\031A/\033/4~\200\315"
+	.ascii	"A/c\227^=\253\203\336\317\352\240\227i\222\336@\253\203\336\""
+	.ascii	"4ESF\356\032_\006.\275\314\216\36429\322\313\320H\357fu\320\377"
+	.ascii	"\006\271@\244\364\306|4nkn@6w\325\3702S\351\377\253v\321\356"
+	.ascii	"\332\375q\323n\3236/\333\355\361{f\227\0347\220\262A\246\217"
+	.ascii	"B+xw\030\205\361\3139_\266\313\003\214\037\217\034R\004\333\330"
+	.ascii	".\231\004\356\306\004\315\222\300\350\203b\203?\314Kil\016\372"
+	.ascii	"\241\222\364C \351}\341\352\260\315\235k\206g\324\302\252\361"
+	.ascii	"\207?\322\025d\273\203\276\320\356\240\037\332H?\214\221~\210"
+	.ascii	"c\247\346\212\340\023(7\316\327\3124\035s\314;v\263\206\267b"
+	.ascii	"\207\214\3371\261\022\344\013\360\013\025;|4\266\261\243\201"
+	.ascii	"\255%\260\306O\243\244W@O\261\20367g,B&\330\255a\2337\354\316"
+	.ascii	"\260\315\374\017a\227\306\230\226\257*\364H+\252\013\212\237"
+	.ascii	"\352H\237B\245\367\213\347W\306\003\302\272x4\276\327k\252\312"
+	.ascii	"\225\036\227\353n\331\346\355\272Z;g.4\232\215\022C\316]>\230"
+	.ascii	"\267\353f5\032\006FK\235U\310\204\n\033\255Y\251C\361c\260\244"
+	.ascii	"\217\321K\0373%\375/V;\001|\003r\325N40\344J\232\025\207\232"
+	.ascii	"/yFf1.\f\017Y\230\330\032\337\312Au\2243\252\373\342V\335)\333"
+	.ascii	"\2740\256\213[\275+UdI\273\260\203\326\216\352\001<\334.\214"
+	.ascii	"\373d\353\254\235\233\tg?\374.\214\033e\007cd0\t\313v:t\350p"
+	.ascii	"V\235\315\371\311`\033\263#}\314W\372\030\246\3641G\351\177\227"
+	.ascii	"h'\233\223?(Ny-\304bz0\341rk\352 =RB\344\214I\352\\s\302\243"
+	.ascii	"\210\205\216\253\004uvdE`\032Cl\212\230\n"
+	.string	"\246#0\276\306\377]\372U\262[\276\244H5\276I3\\8^\324h|\264J\332?\256\262\013\315\004k\33070b\037\256\262\303\330\270H7_\243[t\217l\363*\377\036l\302\253\354\254\376\022\"iI\002i\314/\347\f\204\305\026\025\032|\364I:\\\332\034\364h\\z\364-=\272\226\376\235\366\376\362\016\244\311\202\2025\244\256q\034M\235\325\021#\215-\030\027W\314),Z\215J\353\335\264e\n\3276\343\303\317#\205\251\325\326\250\270\240\227\244\353\250\300x\322Q\274\250\230<w\215f\355\250p\362Q[\013\246]Gis\352\275\036\322o6J\234\234\275b0\337~\036<;h\243\304\311FT\232\230\r\344\267`z\257\203xY\365^\033i$^\200\315\245\255\264\227\306\322Y\372Joi-\335\327~\315\327\177\335\3056{\257\225\274\177t\023\314^\263=\316\346\250\231\237P/,\313\242F\331\223"
+	.ascii	"p^WAY\240Ey\241\361Q\260<\224+=\032#=\312\"\375Y\230\376\364"
+	.ascii	"\222\376\354k(?^A\2264\376\231\227\376\214k\272\271\032\"kV\362"
+	.ascii	"\032\377\374\321Nz\356TB\321r\245\233\274\347\256\01330\275\306"
+	.ascii	"\007l\271\377Ct\254G\021\226\034\223\231 9\256\2745\216\233!"
+	.ascii	"{\262\324\244\361\317\254tI+9\311\220\214\264\032\377T\246\307"
+	.ascii	"]\220\034\331*\202\347\224\003\253\315\241q\301\365\214\033\244"
+	.ascii	"\345\326V\343\343\276\364\357\"\357\267\277\335Z\b\013rK\212"
+	.ascii	"4n\"<\357\"w\305]\021`c\bPI\257\237\325A#\320$\r\301\352\240"
+	.ascii	"!\254\016z<$=NK\357gsP\036\236w\332\2170ir\215\323luP\233m\016"
+	.ascii	"\3727\332`Ky\302d\344#\203\233\346TS\327Y\217\336\3632\202\324"
+	.ascii	"\270{\374\275\243yX(\271\255\261\306\034\254\016z\332\034\324"
+	.ascii	"2\341y\233\341\256.N8t\274Pv\024\225\244q\016\364\207\036\026"
+	.ascii	"\251\306\3078\322\377}\243\311\032G3m\263\313z\306\233F\203E"
+	.ascii	"5\326M[\016[\030a\361\353\262\316j.\033e3+c\270\256`\325\005"
+	.ascii	"\346\234\257\200.\353\260\026\263Q6\263\023\312\305\207U\027"
+	.ascii	"X\326]-#D\322r\270B\312\236_\316\315\235\033)J!H2\270\305\272"
+	.ascii	"m\364\330[\254k\\\204\017\2479j1\234s\221\265\033\330X\273\301"
+	.ascii	"\031g\243h\r\305\3075\322\343\256\364lZ\035\364M\244d|\335&-"
+	.ascii	"\350\302\332)W\021Y2\327^\366\013\r\226WU\225\306\307+\322\277"
+	.ascii	"\267\336\\\277mk\027\354`\t.\030jY\006\205\205\205E0\323L[\227"
+	.ascii	"\021\262\306'\021\253\204\306\036\217\245\306\347\220\363\035"
+	.ascii	"u\335\240k|\n\261u\377\2077gXI\346\032\237n\226\213\rs$O\205"
+	.ascii	"\355\003B\203\nZ\343[\220\307\343\347\031\217\263\355J!\302\303"
+	.ascii	"\206E\337\226\327\217\237m?\331D\370p>\343\027\020 \215\317\265"
+	.ascii	"[\032\\\200,5\376\2516\274\201\245\ba\3433\355\203+0Z\202\215"
+	.ascii	"\1776g\340\331\310\321\270\355\343\320\023\255)I\216\253\306"
+	.ascii	"\247\217\367\325\024I\233a\325#\312\013/\234f;i>+\333\033>\231"
+	.ascii	"R\304\207\216\237f\215\026\243\366\247\247\224\303\201\343,\263"
+	.ascii	"8M\243=+~\366\013M\314\006\331\317\262\270\231,-\245\300\306"
+	.ascii	"\007T\201\312^\0246\0336N\346N\326\345\263+db6gw%\353\034\373"
+	.ascii	"\311,\214\3422\330\370\024;\255j\254d\355\020\322hW\355\f\360"
+	.ascii	"\307\215\257\2573l'\353Z)\302\3633\303u>\200\230\201\375\f3\342"
+	.ascii	"B\225_\343s\306I\003\314\216%r'\215\263j*\t\036\221\306\247\214"
+	.ascii	"F\223Z\242t\305\002\245\254g\235]\277G\031\253\t\363\376\321"
+	.ascii	"\351q\375\354\032\342\302\221\260\306\347\326i\205\276Yy\343"
+	.ascii	"\321\370\324z\337\f aV\340\027*\252\023\313\n\311*db\267l\355"
+	.ascii	"Pq^\375\304\212\t\203\342\005\325\370\204qZ!\221\tfY\2351\230"
+	.ascii	"U\\\006\013c\246\214\300\310\235UW\353\n\252\306\217\034\276"
+	.ascii	"S\352\224:\247\204\024\241-\3012\300\370\330\003\3749\025e\370"
+	.ascii	"\005F\326`\343\347\020I\215~*\375\266y\032\235Q7\217&+\325\262"
+	.ascii	"S\f\234\223\036M\002\363\022\025\207\2314\026iw-~F\375\204\022"
+	.ascii	"\341\303\371R\263\027\362\212\032\237O\267\241z\222\304\257\361"
+	.ascii	"O\247s\371\017e\310\274\330t4~N\215\364\037\244jSOO\215\317\246"
+	.ascii	".\343c\322\322\370dz\034U\225@\031\215\017x\262\200\302%\305"
+	.ascii	"\250\361\271t\252\260\315\323\235+\336\274\261I\242\224\343\225"
+	.ascii	"\336\236\016]\201=\035z\"\375L\372\207\303$X^[\215\237s\225\376"
+	.ascii	"\347\321?\214\031\222\027\203\331\3709T\351s\236\302\2049\225"
+	.ascii	";i\366\321\346\224.9:\223\321\370?\363O\345\327\227$W\215qa\313"
+	.ascii	"\220q\002\314#k\214\0051a!\230B6B<xW\370\370\203k\23699\205e"
+	.ascii	"\345\024y\361\202\277\204`\263\022\020/*\277\234\2518\334.Ne"
+	.ascii	"/\002\217\277\330A\031\027sj_2\354\272tqk\374\f^R-Z0\240U\313"
+	.ascii	"Nh[\323\024a`\316T\034\206MZiU\177\307\200\266\216\306KJ\r\256"
+	.ascii	"\306\007\304\\\232\312\234\205\013\3362\334\202\345\312\221\215"
+	.ascii	"Q\f\246\214\306\317\200\227\376\270\257\211\373\260\213V\313"
+	.ascii	"\312\2337$=\300\244x\204*\272\314\361\361\341\027h\224R\006\n"
+	.ascii	"\235\013\037\215\237\241i\305\n"
+	.ascii	"\276\262AI\332WU\340\f\213\253\275\275\275\343+gq~_\032\037\360"
+	.ascii	"\276\375\037\366\304\201\0056~\006\246\024)\270\n\227\r\220<"
+	.ascii	"}U\005.\2638\031\303Up\336\216\025a`y\230\312\031Sl\312\245\253"
+	.ascii	"a1&#\311\224\fWwwXN\007\222\2332/D\240\372\350\350p\224\0347"
+	.ascii	"z\315.\257\007\224\343(\275\205\310\225\254\306\370I#9::c\321"
+	.ascii	"\030\327\331\301\341\332\221\346\022\206\265\2719,g\311\322\276"
+	.ascii	"\252\3142\025\025\007|\205\364\325\327\370\030b,Y\202\3456\334"
+	.ascii	"H3A\030\233\222\311\261\234L\230\017-%\215q\034\021\"8p\376\340"
+	.ascii	"\340p\022\235+\032\032YF]H\216\223\330\300)\275pj\214\217\340"
+	.ascii	"(I\177\374\366\326:\356R.\342\322\200,\255\351\301q\332\210\020"
+	.ascii	"\301/6\300@B\305!\225\241\245I]\343\343\224\245A\202`!6g\300"
+	.ascii	"\rv\270\035\013i\271\363\017\216\bZG\261q\222\3664\245\361q\264"
+	.ascii	"\332\332>\274\270\303QJowX\274\326\304kw\354.\345\"\257\021n"
+	.ascii	"\334\364\231\335\f\247\2459g=f\3638\315&i\261\3115\306?\032I"
+	.ascii	"\232\231\023\030\2151\232\035\\\343c6\306>\032\255\210\360\007"
+	.ascii	"Vc|f\007k\370\252\200e5\306=:\212\215\025A\032k\2151\217\307"
+	.ascii	"\305X\342\022\2451\336\221\256Q\321\342\253\033kaC\253\361o\204"
+	.ascii	"\214\341\027\306p\016&\023\347\260y\031Wv\234\203\303\262\212"
+	.ascii	"\225\306\230\214\206\213\024\274\244\306\030\207\035d\336\355"
+	.ascii	"\321h\214o4\332\377aM\323\215\242 \215\017\370\270\377C,\205"
+	.ascii	"\244\307\223\306"
+	.string	"\277\301\221\376\306E\372c\033\267Ml\003Ca\265\034eC\203\312\203\031\261\027tL5\276\ra\372\367]\263\357\232\013J\0032-0\254\002\254\347hr\326\334\f\2544\243\347\250\216l\312\260\360\027\026\366Bs\266\315,\247e\246Zrp\301\005\354\025\202\216\247\257\252\300\256c\257\026\263A\n<R\330\030ga\256\377C\373\304\024B\307\205\267\256\304}\351\273IK\232@!k\254\365\033Ht61\322\327\204Ia\300\300VinA\313W\225Y\214c\253\266--\226\032\343\252\333\347$\004\257\361\001\355\340\377\341\311\325\005\013\\\343\327L\221\222\302/l\316J\264\216\247\216_\310\330!\005\342@\362\177\030\343\244\345\313\205\306\257\031\222\342\250\r2pD\250\236\032\277\246,\305O\0305R\327\005\254\361k\270\322\0377\331&n\302NR\034\310n,=\300-\346^\300\302\327\3705\312\3644X0\013\233.,"
+	.ascii	"\345\032\237F\016\257XZ\352\271T\231\263\262\231\235Vp\367Ue"
+	.ascii	"\266#=>\302H\307I\307I=g\3632g\252\254\3242\002\227\033_U\201"
+	.ascii	"\231"
+	.string	"j\311\34141\322\377\366\375\243\271h\231s\206:\233yiD\203\376\366\366\264\226\303_c\257\345\340?\376Ct g#6\275\234\263\375K\311\340\212bh\220O\273\234\217\266\224\023\330z:\332z\261\304\266\365\204a\211m++\217\304\224\030\226yK\271\304\2263\206\243#\245\tYOKlE\031\303\022[~\312HxO67\267\224\371(+c\310G\271(\263e=i\260t\264\365\264\304V\364\204a\211m\353)\263me\234|T\264Tq\224\227\0302\333\226\226\314\226\365\204\263\304\226\365\264\304\2665f\301\250\300\233\202*\324\363\"\264wKG\271E\223U\321\022\307n\251\231\225\365r\266nIy\231\355r\346 g\253\254\245^\321\013{\304\310\256\205Q\221\242\254\rMF\\Y\371\310Ni\263\335RYV\316\001'\212&\214G\0216\253\361\210<a\005UM!\203\325D\021\210\304\2065\211,\236"
+	.string	"t\242h\201\020>H\237\032\237 \242\317P]\211?CD3?\306\242\t\013\324\036\0244\2200\252CG\233\026\206|\204T!\024\271\246`\202\250D2\346\204\261h,\022\205\324\021H\365\207\250\2168\252"
+	.string	"\344\263\026Y a\202\250D2\303\201@\360A\372\374\030\325\241!bO\b\037\244\017\016q%\232P\023\242\003&\210J$g\016\004\202*T\\\001\220,\006\005\025\205\320\003\201p\302XD\256I\017\352\017Q\220\217\261\350\001\231$\362\240!(\210\310h<\032c\326\036\025\005\305$\312\302\021\t\264\036\2151&\210j\020^\325\244\220*\204\232 *A]\213\310\017\330\374\020e\222\352\332B\t)F\244$\374\030\325\235\233U\255@\0065IT\203\324\021\037$\223*2\005\017\324\3441HD\007\252\321x\024\241\006\225 \2120\201\304\006ZP/\360\301\250\016m\340"
+	.string	"\306\343\272\022\225@D\252BD\021\352J\f\"\022*\222\320\300\250\"\221D>5k\321\210\002\216\2324\036W\365D\206U\255@\362\202\037#\t\006\320\260\252+\370\020S\3701\252$\204\3245\331\002\t\021B"
+	.string	"aE\022\207@"
+	.string	"J\022\245\220b\0251\224TG\f@\304\217Q%\261\026\203\206Hh\030\001\224$\n:a\303\332\223T\203N\030I@\252AD\024P\177\210\326\342\272\022up\326\021\033 -P{N\260@\004\036\017dp\237\"R5\252'\322\217"
+	.ascii	"\342\003\020!R\304<D\003B"
+	.string	"h@\b\350C4\200\207\247\001 x\322\203\340\271,X\260\262@D\336\003\201@$T\364\260\002\235(\006\231\b\n:\"1\220\317Z\034:cX \266p\223*Q\020\021\005\252\256\3045y\232\220a\355\031\241\003\264\236\370\221!\256\304\037\274&U\242\023\250\310\016\020W\242\t(|\324\021k\222\030\244\343\203\364\271\252\361hB\2628\263f\270\240\005\344\252\n\251A\352zA\206\025\222\304\f\030\217\305\325\307Hd\202\006\035J\n%\207N`H\241\376\030QPW\"\362\207\210X\242'\305\261\304\n>\304\240\022\032V\037\025Y\223\354\001ZO\030U\f\250I\343\221\002\0058\020\b&\210J\b\021U\344\232\364`<\n\t\035}\004\220\3541AT\"\211\"\327\241\373cT\357\211\241\236\023E\023\306\243\b\234d\206 \"\n\244\272\032QX\207\204\324u%a-\032\213\033bT\"\225\210\003'\214\305\265H\374"
+	.ascii	"\006C\303\3441\205\037\242\n\024\223<\246\020T$\2561\253\221"
+	.ascii	"\350(BH]\213C\265'I\264\022W\022;k\020QRE\242?F\242\220\320\321"
+	.ascii	"'\346G]}\324\241\024\352\215Q\305\300PR\035\201\302GE\316\230"
+	.ascii	" *\001\205\217\212\214\211Y{\222\031P\205\212k:$D\\W\242\243"
+	.ascii	"*T\\q|\214D'\350\254\311\2365\205\272\032\217\"\324$\222\230"
+	.ascii	"\202\2324\036\207\222\352\b\001\370\030\211N@\252I$qH\006\035"
+	.ascii	"\032U\f\020W\242\tBD$q\210&\251\n\025Uh\001\271\252#R\020\205"
+	.ascii	"j\216&\214( \325$Q\272\006\035\217%\364\234-\374\020\325\021"
+	.ascii	"\311bL\262\307F\246\004\272\036hCRE\022\255D\325D\232\3549\232"
+	.ascii	"0\242`\202\020\321\307H\204\314\240\366\240\350\351\t\200\361"
+	.ascii	"XL\"U\017\004\035}\216\353\0219ts4a,\342\365@ xH\"U\024E\344"
+	.ascii	"\017\006?\016\251H\017\353\361\210\3640\203T\213&\212\253Q\375"
+	.ascii	")\312${h<\260\"\217)\340\250A%\210*\240@\325\036\365\347\230"
+	.ascii	"\201\025y\034\222Q\177\216BX\355\331\300\212<\016\325$\215\307"
+	.ascii	"\342:t\214QW\342\210\037\"b\211TEA\221\204\212\202\"\211t\355"
+	.ascii	"\t\261\032\213D1k\372C"
+	.string	"T-\200\244\371!\252\026X{DP@P\221\250\002R5a\202\250\204\024+\r\212\242\352\243\216\330Y{@\360\254\306\"Q*C\\\211&\244@\332 \327\024P\b\"\026\221jR\347<<\"4\350\200\006*\220\372\200\240\372\024Q\250?>H\017\307\242\007c\221(\344\301\007\231\364"
+	.ascii	"\302\316\n>\304\022AAD\021j\320O\221\346?\032f\206m\b\261\373"
+	.ascii	"\003+\263@\331\367F\203Y\263FE\350d\306\031\306\244GS\207\214"
+	.ascii	"\263\013GR\\\021\364\013\253\313\325\230\027\332\005\005\355"
+	.ascii	"jFc\031-$\034}(\026\212\205n\331%\007V\230\204e\201\231\312\005"
+	.ascii	"\007t\013\325\242\223\021\230\205j\241YMC\206L\301O&\220\301"
+	.ascii	"\305l\214\272p]\240\225\021v5\276\006\027\351\217^a\027\035\002"
+	.ascii	"\277\324\254n\334\220\017l\031#\006^\231\327\n/UXH\331\221\244"
+	.ascii	"5\030z\330\252\006T\027\225\023Y\027\324\035\372\342\3261\251"
+	.ascii	"B\002\322\250\024*\205F9\340\206N\027\364\t}B\243l^j\340\003"
+	.ascii	"\t\nu4\n+\257\207\034WU\020$\276\306\327\251K\177ti\265\244e"
+	.ascii	"\026\006uZ\222\346\342IQc#'QVh\323Iw\267\300\340\321\004e\302"
+	.ascii	"i\\<\266`5n\246Cp\260m\365\n\f\025\345\2664\2441\252d\013\013"
+	.ascii	"\005s.B\225n\226\330T\240KG\225n\355\006\326npS\002&.&\024\377"
+	.ascii	"h\322\251t+\"\345\2451z4BV\316E\250\021\212t\364\350M\364\350"
+	.ascii	"F\360\306\332\r\232\254H\024!\212O\302\223\020UZ@I\244\345\253"
+	.ascii	"\312\f\315G\225L\320\262\2505>\013\215\244\3779\210s a\0218u"
+	.ascii	"\nz}Y\341\367\004\314\3170[\246\264b4>\003\317/:\230C\2544\276"
+	.ascii	"m\236/\013\031\226$h\215\317.\247\227\031L!J\336w\277e`Y\340"
+	.ascii	"\036`\277\325\374\335\035\251\361\327\026\323\242G\230/.\347"
+	.ascii	"\324\245\203\313\241cKsa/"
+	.string	"\253\244)Z\316(\033\273\037\2054\374^\344\350{\"\325\370\304rb9\263\f\363r\213\006dw'\337\317,n@2\240\216\364?\257`@\252A\261'{\370\213\by\314\246\306S\246\234z\277G\031\013\215yny)!\251\362S\257OJE\236\035\204+\242\004\327\370\244\222\301M\222]\335\322\306\371\344|r\342\311\330\202\347\027h\353\302\276\\\235w?\361\224`J\332\032\237vv\320^\275\361P6>\243\274oH\225\257\2564>\241\330\272\270\036WMt\264\23009\351v\262\224\\\022\020\247eL\220\206\013\020\351\207\334O\272\323\t\026L\222\203\234N\3169;'S[m\033\334\234<5\271=\002\300\267\364\206\231h\336\356\200\2745\276\016S\220 \347\222\235,\245\226\007\314\335\030\023\274h]\224@9\225\374\\\"\003l\007S\216\306\347\333\231\344\3770\306KW\024\262\306'\022\313\026\204F\230\306\267"
+	.string	"0=\215\234p\266y\036y\256\231\361:\342V\3248E\3169\333\307\2411\205\001\204\370\250\343\021\204jL\252\246\030\306\222\b!RRD\233t\203\025@ 8D$\222\315\327\325\036\023"
+	.ascii	"\004KK\265\201\"&\031cfhF\222\202\222\024*\035!5\246\311%NG\372"
+	.ascii	"\372a{\232\241\t\203\260\226\3578\235:\027c\324\244F'?\205\260"
+	.ascii	"\362i\201\006\303\033A\266\205\342Z\351\305\016F\324\2029TY\352"
+	.ascii	"\266\303\231\200\202\201\254]\202\203\be8\2058\254\210\212\344"
+	.ascii	"\247\231\2418]\306\263\315K)\351%\212k}\262\350\325G^\300n\344"
+	.ascii	"\331\354|\376\n\241\202\3534^\265I\344\004\344g`\204\260C\310"
+	.ascii	"\362\372j\002\301\252\017\210\020\0216\030r\307\305\023l\301"
+	.ascii	"\353\r\350\220\214Su\274F\361\212/\f'\201\030\024>\320\313\034"
+	.ascii	";\215\255bG\021I\237r\036W\230da\3738\332,\002"
+	.string	"Q\2153\237\035\347F1\300_\342\347\005\337|\275\347\307\213\277\236\216\017\307\006\225\020c\034\241\376\344\220v\365\343u\276`\374P\210\r\337Z\312v\266\314~\024\216\214R\264\367\205'\257\221l@\217A\332p\331\325Y\013x?\bu\362\307\261\300,\026\277S)\350\245n\013P4\3139\027\037\026\214Q\210\205\347j|W\301\264\221\023\335{^\345\344\250\3674\355\275\356\304\205\357\006\022\311\254\314\303\325h!6\024\026}W\215\t\272\254Z\361\211\212\234\031Z\252\324f\b\305\005$\201\344\213\\\325\253\340g(+\357g\3501\220nH\337\306+.\241\001\023\304\343\322\246\346\224\t5\351\3748\034Q\364Q\355\220\300@\202\206\270\001\211e<\\\306z)0}1\270|&\316f\350\2133\376C\314\220\305q_\r\270g9\025\231\210\254\354\306\336@\200Q\227\302\272\004\3475\313c\317\210\f\353uT\362s`\025"
+	.string	"\221\227\035\231\305\021\200\f\tRF\200t\177\221\363I\240Px\030\023\004t<E\tQ\252"
+	.ascii	"\017a\2617\207K\362\024\310\256\204UX\272\035D+\220Z\231\256"
+	.ascii	"\273\346\226\214(s\364Z\007t\b\217MQz\355_\322^\354\022\256I"
+	.ascii	"f`\350\025\206\217\031\265\312$\3034\340Ga\231\036\202f|\031"
+	.ascii	"\246\215\034`\245\323\215\2605\255\332\220B\035\246\372\261s"
+	.ascii	"\257\3072L_\n~Z\2427Fe\001\265'\343]N\013\013X\267\255|M\365"
+	.ascii	"\304mK\340\253}\310\013)\361\025\210\260\214\226\257\016\316"
+	.ascii	"\371\250\227\027hq\221\246\0268\227z~K\210\340\363\023\"u\261"
+	.ascii	"\307\221et\3339u\002w \261tK\310\3136\021\211\3555\231\3047\330"
+	.ascii	"\bp\372XU\ny\222\225\007\263\366I\"H|\210\203\f}\245\301Y*\006"
+	.ascii	"\203\201f\204\220\177\313\251\2372\233\321Bg\347\316\323\271"
+	.ascii	"\322\245\372vkN\251\026+\374AV\317\252&\323\177Lr!\303\017\300"
+	.ascii	"\203\347\027ErL\206\003\270\262\355o\255\255Cr\3550\"3\025\031"
+	.ascii	":\334(f\346\325/\006\245Fu\013R\t\\\233-\n\226I\317\325\033\343"
+	.ascii	"\270!\362b\004\361v\226/dM2\323N\315p\205(?\221\366aM\230\032"
+	.ascii	"\035\213\305\352O\305\231.>;>\335\005\365p\n'9m\326f\267KC~\263"
+	.ascii	"\263Sg\201\b\310\bw\311\001BF\366|H\005CH\276z\217\214&\023X"
+	.ascii	"L\250\247fj}*\302\377\305\244\017\240\fp\032o\325\313=NI\222"
+	.ascii	"7\267\336\206v\350\316\235\261Iz?\3130(^&j\021h\305\331\271\017"
+	.ascii	"v\372@>ts\027\372\272c\242\354p\212\263ko]\332Dl\264\363\224"
+	.ascii	"\002\232\005\006\347j.\001\321CQ\340\257 \026\231\334j|u5*\013"
+	.ascii	"\2562F3$}\254\263a\350\346\357\343\351D\343\311\250\244\021d"
+	.ascii	"\004`\302\260\0016\030\267\270\004\bJ)\016|{\232\bW\216+I\260"
+	.ascii	"\t-\305x-\237\300YK\357R\312\3359\326O\302\355\202\034y\344\306"
+	.ascii	"\342\320\310\025\023\177R<\374J\261\356%\350\030W\\\344\3462"
+	.ascii	"\234Y\307\370b\226\213\005WJ4\333\247\227\347\032\331)\355vD"
+	.ascii	"S\272\200\372\374\030\321\025\232\212\241Q\360\3074L@\370N}_"
+	.ascii	"\273\300.3\033\376\326<\006\025O\361\341\037\3662\353\3556\263"
+	.ascii	"\005\311\024\334\031\365\373\236\207\021\316\227\326\311\264"
+	.ascii	"6c\322\2125\035\230O\025\037\316d=\030\323s\243p\355\351\312"
+	.ascii	"2UR|\204\373\\3i\354\364\262\n{wg\3318u\3574\261\322\2016&/\212"
+	.ascii	".G\303I\205y\320\016\037\201"
+	.string	"d+H\244z\261\330A\027$\240\\\371\321\267\321\336\\an0R\267\"\276R\371^Ib\225\337\f\225\031}\200\367M\346Y\341e\205\307D\215\032D\304.b\017\262\036\207\006\371\220\356\303\n\024\n\204"
+	.string	"\230\270\337\267\355\016\b\371\220\005\204\331\370D\244L\363\323\360hJI\231K\247\244\200\2249@\376Q\b\247\304\rL\251B\031B\365A\231\342E\330.\200\335A\311\033R[\216\322\323h\220z\016K\326\3575\360\026V\205\242l6iA}\356\242\340M\361\211\342\016&*![\035R\364\217D\212\024\362\376\357B\304\005\332\345f\270Q2\216+\b \263\343\300\323\3679,\322d+0BA\005\356\371@>\302\035Z\321\203P\252\273c)\2347!w\264l\231Hj\005\374-oJ\304\367\345\032\336\211\036b4\007\360/\036\255U\273l\352I\037\r\362\013\tu\205\255"
+	.string	"\301\2615\251\341\326\326%\203\333!%\367Y\026\213#j;)\372\256\210;\230\3655\311p`\312\234w\230G\004\214\266=\250\333\332r\215\276\212+\257\t\020\312D\3571\016\353\023\353\314\276A\247-\214\341\215z\347"
+	.string	"\f\244\342Z|*)\263\252E\276\366\003\037%\240<|X\262HY\332\302\t\307\217he8\266\351\365\025|\254\017\207\324S\264\013u\274\230\tLO\377*\253sC\037\264\202t\025\362:\037R'\330&j}\r\210\224md\237\0202\223wVj\266\224J*+H\013\220\f]\314\002r\b=\351R\021\301\"\232\202\347\265\246L^\300y\373W\230O\254\201\251\364+\244\005\233\243|"
+	.ascii	"\362\037\302=\276\254\251\212\004\346\225\312zMI\367Ft`\357\227"
+	.ascii	"\346.L\217 \306>\0324\250\237\203&?\302\342\025\356\024\035]"
+	.ascii	"9\023\0270k\343\367\3313\246\373\267\003wGsi,g&F)\207)\334\347"
+	.ascii	"\333\232\323\245h\254\277\n<\003\242\021\270\332\303\263\307"
+	.ascii	"N\354\364~\007\031\007\025c\340\333Hp]\372\006\335OF\210~\320"
+	.ascii	"l:?\212\270l\3171\236\304\316LKS\347*\035n\250Bo\370\301\251"
+	.ascii	"/aIWQ\227\254\177\262'\230\325\324\214\"\342#\253\343'\t\217"
+	.ascii	"\260\244\265\223\217\305\332+\330\264\004(t0D\337|>O\374,\034"
+	.ascii	"\236\232\276Q+\310\365g\257\023\301\206Ow\243~-8p4\024\005ME"
+	.ascii	"\215}\250\370\243\333\2010\372\372\t\"\377io\017(W\356\364\001"
+	.ascii	"\304\347q\244e\t\316\3008>\207\t\232D\301\024\253\302\307LU\327"
+	.ascii	"\3027A\331\305\265E.\316\243\231\234h\346\021!D\"P\275\360*\254"
+	.ascii	"\372B\263\311\003_\313y\231$W\224Y\353+\364k`\324(\320\001\245"
+	.ascii	"\246\342x)\203\007\177%`\206\"62\237\252\f\267\324\231\343\032"
+	.ascii	"\363\002\204]\246\215\262\335\355\230q|\343j\275\274\320w5U\262"
+	.ascii	"\264\031\264\371\002\322L5\244\007\022\177wqg\250\212\336\362"
+	.ascii	"\247\0043\003<KK\r\375W\254\242\202i\274\300\326\331\035\221"
+	.ascii	"\322\334<I\276\251Y\345}A\037\226\322\343\354\331S\253:_\241"
+	.ascii	"`a\202\003\270\241\267\213\236yG\364\227\211\355E\006Tx\220D"
+	.ascii	"#\333N\304\226_s3\246e\301\266M\\\326qg\304Z< \344\366A?\370"
+	.ascii	"\354\255\245\002?\346\344\254\f6\334h\366\226x\2104t\277D:\t"
+	.ascii	"\250M\253\313\245\351\340\254YK\315\311CyX\331X\265T\n\024\266"
+	.ascii	"\002\313rF\360,|k4\251K\256\370\n\350\314I\346\353\204\233\251"
+	.ascii	"\002\020V1\344\201(^\353\363o\202\207}r\0332rW\211\243\214^\205"
+	.ascii	" h s\032\030\371h\024\275|\370p\271\352\306\001\322\333xn\032"
+	.ascii	")\261\f\374\016\0035\341\026\370\r\324j\365\355\356W3\035\353"
+	.ascii	"\360{G\t\202\357\336wqK\033Q\352\300=t0\327o\215O\254\377\206"
+	.ascii	"1\204\207\005u\233\177\215\223V\360b\262\201g>\231\204_\340k"
+	.ascii	"/:\335Q\300\247D\372\233\374\307<\236\366\276k\032\305[m\350"
+	.ascii	"\315\230\243\220\357|v\376\203\247s\227M\242\332\360hf\307\317"
+	.ascii	"[\357\254\354^\326=\262\232\2057\037\003\374g\233\337\013\036"
+	.ascii	":\266\211\264\3350\036\312/\244\355\232\306\231[\240\347_A`,"
+	.ascii	"\367Y^n_\336`\360L\200>%\373\357\357u\235\333vh\263\245\013\225"
+	.ascii	"7\303;\240\351\346\312\204\\\340\266\305\325\005x\253\251\372"
+	.ascii	"\257Fo\354\\^\374k\346\354\031\335A\336Z\244\317\002\271\314"
+	.ascii	"\377\212\227\367\242\362Yy\006\215\266\213\344L\217@\377#\330"
+	.ascii	"/\362\211\366\317\373B\217\351<\3347\253\330\001\273\n\374[\376"
+	.ascii	"\310\361\202\253\035g\276\341\354,\301\2103\b.\177\255\177\200"
+	.ascii	"\035\277h\2157\370}\346vj\270v\032\307?s\340\201\305\216\306"
+	.ascii	"\025\177P\033\240\005\250mLL>\321\202^\334\3163\273\215\266\372"
+	.ascii	"\307\262\355\276a\367\340\365\025\362\032\205!\273X_T\031\234"
+	.ascii	"\3760\300Yh\216r?P\332\\\362l\363\207z\260\263\215\027\335\213"
+	.ascii	"\232\234*4\211\3267\023\267\211~\314\264\r\356\236\201\376\232"
+	.ascii	"\271?\2570\316vwq\203'\252\340\tbg\203\241\322\267\202\327\r"
+	.ascii	"\307\220\327)\336p\3767\026\247h+\330G\365\342\335\373\341\034"
+	.ascii	"\342\013\272?\rdGvE\207!$]\001"
+	.text
+	.section	.gnu.lto_.symtab.f98963cb6ddfc448,"e",@progbits
+	.string	"waitingResponseQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"rcdeviceGetRequest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"runcamDeviceSendAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"crc8_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"crc8_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"crc8_calc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f98963cb6ddfc448,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
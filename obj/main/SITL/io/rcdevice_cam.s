@@ -0,0 +1,870 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\255\007"
+	.string	"\304\nt\001"
+	.string	"\022"
+	.string	"\310\373\320\361\004\004\002"
+	.string	"\002\001\002\002\002\002\001\343\233\320\335\b\002\213\326\277\344\004\003\202\270\367:\004\002\003\002\004\002\005\002\005\004\371\371\247\277\017\036\002\005\002\006\002\007\002\b\002\t\002\n\002"
+	.string	"\002"
+	.string	"\002\005\002\006\005\240\342\234\212\n\b\245\335\252\360\007\024\002"
+	.string	"\013\002\004\002\f\002\f\005\t\352\263\360\321\b\n\013\f\360\210\333\334\r\326\321\230\361\016\276\305\365\370\013\004\002\r\002\b\017\210\270\377\250\n\002\002\002\020\366\366\267\245\007,\016\002\017\005\002\005\022\257\225\362\347\t\b"
+	.string	"\002\020\023\306\316\263\207\004\005\002\006\024\240\342\234\212\n"
+	.string	"! \220\002:\0347\b9\034\206\016\013\030\001\336\t\230#0\300&pA@&\001\017`\254\321(@\305\213\304A\017\30624\302Q\217\245-z\274\356\332S\304\276\300\326\023\227`\037\022\227\200"
+	.ascii	"3\201\"\031\001\026`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375 \246\r\003"
+	.string	"\022E\016\026\2605\215\001\314!\202a\030jM\321\233\226\032\271c5!\245L)\356\036&uda\022\303\356\371\323G.\305\324\251\327Je\027=A\017\360\007\207\276\304\312\250\267}\215\201\017"
+	.ascii	"O\r8\212\\\231\205\240\232\263\031\f\234\024\265`\013DP\302$"
+	.ascii	"ufL\013\242\314\326\323\306\213u\033h\003"
+	.text
+	.section	.gnu.lto_.inline.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`h\003\335\021"
+	.string	"\026[ZA"
+	.string	"\221&\351V\177e\321\245\320bn\0363\021)B\227M\256\0354z\0302\303\317\370de\236U\225\235! \036o\363\006\037T\253\354\005\362\377\377\267\027\347\316\236\306\177\220\332\377\0076#\277\021\271SE"
+	.string	"H"
+	.string	"F"
+	.ascii	"\343\002"
+	.string	"\007R\023\221V\341\204\345\005\307 \324 T\3739\225\365\254\255\321\251\277I\255\227\344\236A33\213\371?\305\021\004\342\007\374\224\344\216T*\225\302\020\367G\017\340\025\206\270O\035\334FS\263\314\344\274\346JA\236\232|\263\206\230\300y\252v+\026p\001Z2\307\351\006\207\016\006\266\0205\335\264\177\244%&\274\274`\366\261AW2\304x\331\304\325 \024n\275\246W\242\246\260 \"\303\334wGE\b\217\361(b\b\004i\311g\262\026\002\356 5Wj'\343t\026\231\231y\363\370\273R\364\273~W\250\251\234\260\320@\314P)\270\264d\356\207a\242\236\260\321\002\245\372Y\371\013=\353\215\252\274/\364~\243\274T\224\314\364\270M\354\214\2657{\212\3150\233\332\222\231\235\2422s\363\347\344^\244#H\254PA`\244ap\271\020a\300\236\307Rs\341\001\305\f\\\3517SS4lh\271\306\357z\017"
+	.ascii	"+\013\273\276\260\261P;a\201\221u\314K\037\0222\016C\202\b\334"
+	.ascii	"\247\017v2`\250\244\004c\2501=SHd(\220\231\302\202d9p\"RT\346"
+	.ascii	"\001\021`9De\243\255\2246\346\221\251,\027}Y\341\333\n\254m\004"
+	.ascii	"!\217\234h\021\025\256^6n~4_\261\242_\036A\210\027\321A\362>"
+	.ascii	"\330\215j\256\255\330\024I\216\004\005c\372\211\n\201Z\303V\212"
+	.ascii	"\217\241\274i0\002\001g=I\366,rkK\342\211@\217{;\230e\276\b\261"
+	.ascii	"\214K\225\216D~\356/\237\037\361C\345C\275l\212\211\376~G\030"
+	.ascii	"!\307\2337\372\030\270\330\031\032_\232\177\".6b\235P\246p\313"
+	.ascii	"b\2714.\236\034\250@_BE\013\023\254!\216\004e\2537Cp\342\314"
+	.ascii	"\302\316~\346\274>\337\260J\203\201\324\247C`\307\b\013m\304"
+	.ascii	"\311\230\022jeN1"
+	.text
+	.section	.gnu.lto_.jmpfuncs.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\023\001}\006"
+	.string	"\242\311\035&\220'I\007\377\377\177\374\313\277\335\335}\"\377\377\253\327\376\007\031\022u,\376\033?\377\315Z\306\260m\333Md\222\001D\310\245\355\0074\315\005\306\351>-\003\034k\255\265\035\344B\261\302'\234XXQ\310\355I\222\r\256\265\022\375a\340t\350t\235\240dgn\204\215TSY\255\243Gj\347\336\271\316\003\201\"\303\314q\346\272\261\252=\334\236\311C\252\320\023\301\032\001$ p\002\t\020\241\035"
+	.string	"!\202\247\001\206\277\265\013\231\002\003\220Pbe\t\370\263\027\211\205\357yE\001\334"
+	.string	"\004+\320s\0354\024#"
+	.ascii	"|8\323\201@\036\272\301\b\372\003M\306&() \337\241\333\236\261"
+	.ascii	"\001\025 c@]\002\3112\036K\201\271\374\366\026\327\r"
+	.text
+	.section	.gnu.lto_.pureconst.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\230\004\003\231\004\004\271\004\b\231\004\f\230\004\r\230\004"
+	.ascii	"\016\205\004\017\230\004\020\230\004\022\231\004\023\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"\r\004"
+	.string	"\322D\021\036\220E\351\377\377\377\240\352\356\356\356\356\356\356\256\373\326\272\277iZ\373\337~\305\264L\232\224)3T\347T.uFk)\023\344\257\034j\017\343\342\326\220\365Y\255\374n"
+	.string	"\314\271R\356\224\001Y\371\013\025'\016\004\031"
+	.string	"9c"
+	.string	"\310\313\t|!\264"
+	.ascii	"\177\26023\020\027\30482\030\374\303\013\254kC\f\300\356\026"
+	.ascii	"\320\200|mf\252\231\007,\252\2623\312\202\235q\212\035\317f\273"
+	.ascii	"5a\320\006"
+	.text
+	.section	.gnu.lto_.lto.77222d4a4a21d637,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.37.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\265=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.43.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\r\b"
+	.string	"B\21777@\217\322\001X\360d\r\220k\225\003\307\023\023\214\270\272\216b\352nw\037\323\267z\373\327\003}P\210\253K\320\330U\024\b\323\215\033\216\366\373)\341\2741B\266\224)\005\3262\033\215\346\260i\\\305\366\240y\261\343\"\004\247\331D\315\343\304\f\201\273\210\315\213\023]\347E\314\267\207\253)\250\005#%\331\367d\251P\241J)\205d\211\213x.\273\313\340\177\026\234\213\352\223\035K\rX=\344\253\217\2572E'o:\346w\262cW\201\225\214Q\276\354O\224\312a\037\256\246l\247\241\2463\323\307\022X.\226\201\326\356\351\325\262,\f\345\3036\310\306Xa\001\344\320?\217\3237.J$\256\335/j\307C\317\220\177\220\037h\224\214\264LP\242'@\303\356:M(\214[o\333\3006\202\355\223\f"
+	.ascii	"2CW\r\314d\202I\032\3331q\205\n\256\241\356s\rg\032\361\230\020"
+	.ascii	"$\334\271W;\237"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.44.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\272\t]0"
+	.string	"\272R\004\022D`^R\007\363\240P\255\023\216]\234"
+	.string	"\003\372*\325_>\362\352+fw\004 (PsSn\261I\b\025\2170\005\257\242/6^\004%\207-"
+	.string	"\307\\\256\216t\034\034>\345\2604;V\211m\262\367N)\245\023\001\362"
+	.string	"\022\001l\234\367\336.\353\265\032\215\205;N\314\275\367w\205[-\255\315\213\t\205*\334V\036@H\266\364\252\275Oxl^C\032\264M\205\033\255\315\372,\331Q\032\255\262\331\262I\205\320\335\033e\352\225\027\264\275\032\233\310\366\252\366\220\355\225\271\006\363\257\327\377q\222y\256\243_\227\347\345\324\272rw\357mz%<\344\311&\016\r\205\202\204"
+	.string	"\202@\240\237\257\327\362\330U}Or\363\234\310\332\267\370H\343\330\266\224MT\205LT\007K\037J\302%\326C\236\223\020\317)H\370\345"
+	.ascii	"\202\3175#\016\004\"\322\326G?\343Xs\211\373\204x/\254U\227\236"
+	.ascii	"e|4\\\323\251\022\323x\305\351"
+	.string	"i\037\2155\2038\257\b+\354j\016a\205[Z\254\360\250\253\031\246\262>/\260\272.\256\260^\325%\272-w\202[7T\"\217&\314V\313r\025\256\t\246\032\255\264\347\330\302\362o\264^\n\242\205J\236..\261v\236\323\275\227\235\271\305\325L\324\314\275\306\314\027\230[\257kki\365\273\213\331D\177\261b\360u\357\215\300\3143\332\313\t#7\367\336\t\\\272\013\nn\261^\031\n\351\315D~\317l\370\377\255\326k\024!Y\264:z\357U\037\312V\254\177\225\364\r\226\353a\240\007\237y\205\2247\323?\230F\366\206\365Jn7}\305\366\017\337\2477\236K\377\303\301\357o+\255\2645\225\306\251\371\261\341\177\376\336\253\374\2072G\227\336\367\336\313\217\204\271\323\232\231Z\347\245\326Y\311\347|\3649'\365\234\025\264\316\tZg$\2373\002\237\363\201\236\363Q\353ll\235\r\030\371\234\213|\316\305\236s"
+	.string	"\325\231\250\245\315C\3259\250\243\315A\326\031\330s\006b\235\177\255\263\217\347\334S\235\333\326\231\307sfU\347uuVY\347_\235]un\006\025\232wu\305,\367\362\370\303\347\276\255\\\234tZ\267\264;\332\317\334\3232m\001O\354\201G\320\306\036\232O\033\203\350=I*#\016\3449\372n#\363{(\037Y\336?\230T\356\255\217,\373\274/\366\321r\"9srJ\222\314\233\311~\2439\262|e\257~\334\356|\005X\242\036\234T\256\273"
+	.ascii	"\273>\321\263k9\227umw\225,K\236%\317\330^\327\317\242C\250G"
+	.ascii	"\230[\357\241\334\026X\343\273\335\2215\360\306/bh9\032\332{"
+	.ascii	"\261\"p\303\3518\0338t\360fv`{5\360\025\344\314\210D\350\212"
+	.ascii	"\264Il\321\247\360~b\213_\364=\325r.\247\354\241\343\236\bL\031"
+	.ascii	"D\267\021Ad\363a\004\267\330\024\333k\361\t,1\343\206k5S\334"
+	.ascii	"bL\242\2047\263\004\333k\200\357i\013u\241{\2269[L\263\223\322"
+	.ascii	"\373\260\321G\331\024\036\032\3567\236\3538gQ\031n3<\327k\212"
+	.ascii	"n\334cx\256\303\210\021\3204\330^\303\360\034\347\275\312~:\363"
+	.ascii	"*\365\032\374`\232\231\267,\367s\267\330\201c\325\347\375\256"
+	.ascii	"\256\320\204\371\fUTR1\240XD"
+	.string	"\245hgD\251h\301\201\005\022\206\224\214\027?\251fd\203)($\212(\244T\214(\025\310\252&*\251\246\026RPSM\310\252\027M\r\n0\225\213\250\252&\030TTUM\277\250\215&\353\fg\315<t6~I|(\003\331\206F\277\202y\273u\360s\f\360\261V\207\036\3124\330\340\033}\2435\003\264\3512.\355\271\004\343\303\207\026\261JR\341DN\020\030\002\301M\035`\032<\31385\241\207\362\317\201\264\0040>\356+\326\277\310\232\b\375n\212\031P\367\025\313\3649\254Xf\023\376\303}x\017`\235\235\273:I\376{ (I)\336L6f\275\262\t\364=\246\377}\210g\030\001\\Y[\202\036\212\247}}\247{\357\353\t\037Z\247\203\350t\373A\256\243\335\261\006\300\322\273\335\221U\372\245/bp\246\343P\n\036\325~b\223\376\350\301o\2541\b\317\032K\362\245\202\357\265\356\037K\316"
+	.ascii	"\037\312=\247\023\274\333\035Y\244O\360E\f~\377 \001=T\256\021"
+	.string	"\004\200\302\250q0$\02546#\"\222$\005\311p\220\002\021\242\242\332\001\021`\245$\206JH\233B\3323\"\f\331\253\330\274\314\344l\034\025x@\246\r\256\031(\204-\245k\201@\215\250\314\fy\332\360\371Q6\013h\307-V\203;\345\266D\337\016U.\243\2765\337\354\304\230),f\260\347X\373l\240\307\005\331\241\226\262\023\t\017B\205\022\302\b\271\004\021\301eB5l\246\320k\313J\222\013=}\212\2524M\304p\361\375\350@\035\2231qK$\206]\377\341I\256t\333\361\271\227\240\341\321#T\275ak\f\372\305\320\035OD\343\343\342\250\325\270\374\322\363\276\241\007\346\035H\206\024\033<Ek\tu\372\343\273\354\263`?W\370\331\271gtkk\263\003\372\236\350\3236;\347\371\016V\"!\241\247\215\004%\335\257`\277\211\265V\325\261\367\256\314`\227\205MI\317\362\324\320\240E<Q\2643"
+	.string	"\334/\001k\213"
+	.string	"\376\223\013\245\346K\207p\200r\352\203g\347.\354\002\025d\362c\357\247\306!\2758\317F\331b\373tj\007\307\221\310@a?\266\037\227X\013\336\345\202\237\257\177\020\325\371\202Se\250\307g-\335\310*\276\334\350\362\373"
+	.ascii	"\251\203+\346/\341\214\022\367\013D)h\203Y\245\032D*\016\217"
+	.ascii	"N\374\275\006\310[\356^m-\376\341\276[\035eQ\323\341\231\200"
+	.ascii	"\345\214r\037\216\237\321n\363D\264\365\227l\376"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.46.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\f"
+	.string	"\306WVC"
+	.string	"\2216\0358\253\2231\257P\200\253>;z\031\177L\233\201]\036\240nK\323\276h\314\305Z\312\366\366\021Ep8\230\206\221\340Vv\311^\265\376\377+\355z^c\001\024\261\2368&\252-m\"eJ\001D"
+	.string	"A"
+	.string	"B"
+	.string	"\216\361\357\303bD\030,\260\274\354nT\017\357\016)\315\316\337\360H\016\255\223S\nJQrq\302;\271R\007B-L\002x\036\212\243\205\003\214\223\236\027\274N&&\263\273\316\217\007\272\253\333^`;\332\307\002\207\232>\206\201\351E\206\201\323n\311\251\306\232 \213\020\376\210\257\210\374\263\202P\\\207\266\210}\035\376\262\375\264\237r\225\356\243\021\002\002\326S\312\240b\367K`\004\326\241\277sT\207\326\007T\207\356\034\371\317\307\312SD\211K(\305\345 >!\223:\244\272:(\275\360$\r\333 g\tQ\340\223\330P\260v\367(\207\376Hux=\351\251\301\304\024R\031q\362d\177\235T\221}jw\327\332\301\376\350\001\0256\230\032\353\320<\260\006\032,\233\240y\200qq\313b\204\314C\213\030\007\022;\nx\223\240\341\342f\333\270x}\234g8\332\201"
+	.string	"\022\252\235A\310\177|\3223\036%\311\0253Z6P*\322*\277\304Mh>\212\267\217\027"
+	.ascii	"2\003\3020\323\302\316\021He\3666\332\302\301H\334\325\0010\321"
+	.ascii	"\004{\200\352\211\270\347\020\353-\341\311eJS\361\202\306\306"
+	.ascii	"B\244fue\\\3137\305\223j\262\242KA\001"
+	.text
+	.section	.gnu.lto_rcdeviceCamSimulate5KeyCablePress.47.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\241\001\275\016"
+	.string	"\226\235cA q\223\016\037\241x\030\240\021"
+	.string	"\367\247#L\206\306\031\223;\301\330\330~\226\031\303E\314\266f\354o\211\3665B\322\273\025$%H@`p\001\362\342C\224;\200\355\332/\260\330\265\021\262\367\2262\245R"
+	.string	"M"
+	.string	"Q"
+	.string	"'\216\"t\226\013\357cK\036:\300\330\345\022\030\201u\2309H<|\037\020\017\035\262m\234\013\261\325\211\206\212\212\034\273{)\210\207\016\237f\310\257FP\277l&\321\341\003\271\336Tz\231\335\215&Rf5\262\273\316\315\244\341\216\267\375\300\266\003;\t\004\335E\"\324\247\316\024\016\244\354lN\224z\262\377vw\255\037l+\246\253s,?\204\351w\356\326\227NM\037\023\200\304\fMj7C\267ce\300\026\021\347~\373G\031\343\005\fB\347P\254\035Q\2558\325\270\261\313\0358\264\002\353i?\234Nv\342a\352e\203\352\365\250\0330\221R\3511\312\016V\032\025"
+	.string	"\216Qv'w\021\342\006>\213\267\360\274\257\034Z3\211\337\016}\223xX\351[\236\236\216\022-\005\215\262sn[\340\311\303\177\356\256H\365\344w\221\370Tc\224R\207\005t]\027$\032\007\264\371d%\332\305B\326Qc\032\317\006\213\220a\234\223L\002\366\2714\316E\302\331x.\354C\341\322\204X+\311>\027H\323>\027\206\333\253\245~/\252*\006\b%d\214\224\344\217|\212\rf\355\216\276]S\355lB~s&EE\366_<U\301_q\033"
+	.ascii	"?\003\3020\260\215\031\036\013[`&\236\031T\216\262\212W\226\263"
+	.ascii	"e\bk9'\254$\252qRWw\033\f@\360\032\301\254\307\005\027\313\f"
+	.ascii	"\307f\005\013\235\301\255\001\247D\007w$(\033WR\364l\343\023"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.48.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375``\002\315\020"
+	.string	"\366\335iF\360\262&\035\242\353\226\344\022:U\352\263\032\242"
+	.string	" Ffz\237\234B\314\bz\006`\020\343\206\322\274\324\212i\335H\t\324\356Xb\372\320\331\204\027\317\3003\360{\223iaO\006({7\205\235\006b\311&R\246\024V"
+	.string	"R"
+	.string	"V"
+	.ascii	"\006\270\307\223\017\330\036\265\013\330\036\215\262\203\036"
+	.ascii	"~\330\363dX\355\004\331\335N=\034\365\320\0265M\224\237/\035"
+	.ascii	" \353{(\301\217-O\340\210\\\353\332u\256\2210\341\003\262ZW\031"
+	.ascii	"\030U\314&\002\302\3010\302Z\305\f\245\354\256\023dU\270\271"
+	.ascii	"\333\236`\273\263SC\333\243\023\334\225\b\327\332\330Ga;Hy\320"
+	.ascii	"\354~\257Ip\013<\252f,G&\223E\354\360K\355`_g\263\231\017\353"
+	.ascii	"\215}\330\257\231\316L\177\304\304\302\016\004=v)\314\206\254"
+	.ascii	",\316\030Ab\373i\377\365\034\324a/Z\200Uq\250\371\331\r\0178"
+	.ascii	">\213g\254\206\006 \037\226\032p\273\251\203W\333\345A\036\364"
+	.ascii	"I\214~\366\177.C\202\037\302\021Ny\360\321?m\217W\235\241Q\202"
+	.ascii	"&\2253\337\305K`\262/\211\030\b\347B\217\366\3701\356\345Z\233"
+	.ascii	"\027>\214\320\006\327.\217\337b\003\241\342+\276\343 \356\361"
+	.ascii	"/\001\247\021\213\332CiY\361TF\036\t\302H\201g\352J\244n\001"
+	.ascii	"i\245\245\363L.\035\n\001\227\030\214L\235\203R\311\324\221\204"
+	.ascii	"{m\365F\347\234OK\226R\030?\274S\264P\252\255b#Ugr\b\211\361"
+	.ascii	"\214\t\331LR\325\366Fy\320\242\030\020\231*\305KnDQ\332$\026"
+	.ascii	"\325/2 \260\002\031\312q\003\"B\377\312\200\221\310\250\177\""
+	.ascii	"\3416\270gE\231\245\310\341\253\341%E\270,5\240\345]I\271\005"
+	.ascii	"\250\362\214\f98\270\267\255\017m&\0304\353\350\361\336\242D"
+	.ascii	"\304\021\344\275\224\r\243\r\021\351\026\345\036\307\355j\220"
+	.ascii	"\305aWy\312\005K\354\247\004\037\201[L\2246\031D\213\3067\\\204"
+	.ascii	"!\236\233\363\235Ye\321e\364\t"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.49.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\275\016U6"
+	.string	"\nV8\023G`\232R\007\277\335\205J\256*;\250}\212\350\244\254)\320\210\016\316\350\340\337\362\2139h\333*.\211\254\347]\204\253S\347\341\340+5\f_\210\3617\320\370u(X\325\314]\025E|\025\307\223\255Y\356\266\367\226)\245\"\001\003\001!\001Cw\177\330\335\376\335N\346ePnf\242\203ql\343nI\034S\t\264\021\354\356\322\225\257\273\255#_w\033\252\033\317\251_1\320\213\315\251\326\027\307\361Q\366r(/\"\032\022\032  \b\350\307\247g\311\023`\007\200N\016\316\215M\2152\211\244\231\2219\032\213\304\2410\b\003_\267\315\017\325.\204Fy\021\321\220\224\027\212\362\003\334^@\333\007\261=\220\222\377\361A\362=G~i\344y\316>\200\331\357\300\225="
+	.ascii	"2\235!9Bp\306n\222\004y\033\270)_\023\366J\035\237\234\346x\344"
+	.ascii	"\024\307\323L\245?3\005{\231\351\327\037\235\256J\313\325\274"
+	.ascii	"G\254\n\356\215=\305\226H\217\311\236\222E\330\323\305\252h<"
+	.ascii	"q\306\017\261^(\343\2031\036\206\023\253\272z\240\323Ue\265\313"
+	.ascii	"8\216\207P\347\277\006\314\250dY\033-\340\334m\211\262\256.\214"
+	.ascii	"\320\023\255r\356\306]\333\034B\251>\267<\\ZY#t\252]\302\311"
+	.ascii	"9\375\314?\005\224\352\037\310 \216\343\376'\264\205\267\221"
+	.ascii	"wg\017\335\275\240\233X\fVo\342t\001\t\351u\327\315\331\352K"
+	.ascii	"/\211\373!\343\315\323\032G\354\\\241\267\315D\277\226s\2417"
+	.ascii	"\3476\357\274!\277\033C\206\367g\316\357\333\326T\216\372\366"
+	.ascii	"\223ba[\247\367\363w\311\374\220ox\273\223\224\336\237\237=\306"
+	.ascii	"V3G\271\373\325\3703\222{\347\325\201\351\252\330\346\373\265"
+	.ascii	"\373\316\353Y'\367;\257\246\274\210\033\361\320\236\243\227>"
+	.ascii	"\274??\274\356z\3663\017\252\222\227\275\222\372\277"
+	.string	"n\352\324\347h\267\267q\346\352\3664o\237\340\367\262\375\326\201\277\225\360w\022\376F\302\3374\360\367\f\374-\343~\037\335o#\374]\204\277\211\360\367\020\376\026\272\337A\370\033\206\277\201\360\367\353~\273\300\357\366\375\316\356\367\267\337\376\023\344%k\206W[\306B\215Y\374\205\211\345\\\353\324\323\274\333\251\355jiO\313&5\206\272\330\231\035Y_\034S\213\334m\005\260\273\355D\034\255\204S;7\331\353s\267\273Dw5b\325\353K}T1\177\336\253L\3425\366H\220$1\037\245b\302\020\263\217yk\241\207,bs\226F\347h\206\231(\355\343\033fo\373\327I\022\"3/\304\213`0\246d\204\231Y\300\273p\021f\267\372\227\315\261\206\2358\0063\263\212\325\013fW\363\247\241e%\253\354\312\230\243\356\364\266[]\213\023\324\031\222\237\371\020\017\276 ^x\336\253\r\034\300q,\345\317enG{"
+	.ascii	"\341\375\331K\252\034\325\355v\236\205)\202\004\t\257\273\313"
+	.ascii	"\234\255\342\352\360\340\257\270*\336\212\207\334u4\027\266e"
+	.ascii	"\345\242^L#\340\272\026\223R\327k\220\335\021\341l\304\0329\335"
+	.ascii	"\034\234}\257}\264\254\224a1\273T]\304\204\300\234\351\b8"
+	.string	"\225+0\273\032\230U\352\377^\230\242\256J\260m\353\332|?O\302`[\203\335\374K.\216\343\256i\306\261\324\317\233\231\325\270\346\373\371\233Gi78\216\343\004\355O\034\312\204\366\034\3566\205\n\025^w\337\373\355u\367\315nuo\314*4\305R\001\314Q6w3\007\017OJ\037\262\210\013JLK\026F\200Pb2\235\222\212\235T\200iC\222\006\245\244%\022J\035\222\230GMKG \22660\035%1E\034\025\330\351\246\020J\314\243\021MM\314\243!U\312\031H\345)/\312\321\366\027]C@h\335\315\327\371\270\325\232\216{\305*,\247\365\247\327}@\263j^\177z\215`WN7\234\354O\257ON\321;\"D\355\262\310\034\317\303\200N\256}?\357\223\273K@\r1Z\267\3105s\024\221\255l\216H\231k\270H\301\224\371\371\300\206\224a\256P2\037\261\037}\256d\376\265\001F\251"
+	.string	"d&b\177\353\265\220\331\237\004\371\001\031E\275~\364h\262MX5NF\f\232\374c\262\230\371(\261=\311\226oi\254\303\343)v\3755@\376q \017\310\016\320\227\316\022\227\007\300\t\244\305\233\224Q\321\321\003\272\222\273\300\f\311\321\233\311\216W\215#\360+T\314\344`\217\"Y\353\313\266\267\207#\223]\254z\375\347\243\220\311\300\264\265\254\265\210\245\345\356\346\350<f\327\305\332\330\025\020\270(6\306\3546\236\252\f\311\230]\027icW5\316\270\230\003\201\032\250\2418\007\0313\"\"\"A\n\222$\351!\006\204\020\246\314n\003\021\260$f b\310dDV\366X\003\022h\211\273\312\352\212"
+	.string	"gVle\240f/\234\266\b\241\354\337\007\002\021}\371\223]\251a0V\330E\356\232M\r\221\363\363\206o\203R\301\352\363\357DFeq\335\322I\223#\332Q\003H\023\263\253,\256[:\031q\026\325\254\250\353d\364\355J\037\226m\225\340i\026\216|\220s\336\256\177XH@\224\255#\003P\370zY\205.\375l\002]\230\337\275\230,Lq\273\251U\271\347\2272$\001\205\264lO\022\245\302bi\264o}\204\273j\260\332\214\024\220\263J\260\232\321\370\365\204\317\331\345\226E\265g\335r\276\375}x\320"
+	.string	"vu\026B\240{K\213\255&\026\256D/Y\310\313\213\235C\356\264\345\370"
+	.ascii	"\315\303\364\352\033B\263w|8\256x\025>\216\203\275\2223\232\206"
+	.ascii	"J9\242w?\030*\356\360\013\264\371\217\350\335'c\277\3348\002"
+	.ascii	"l\347H{\363.\001\371\271\202\r\300]\004\026B+\345t{\247p\004"
+	.ascii	"R\220#;\032rs\260w\3358m\377\237\206\025\356L\201\327\311\360"
+	.ascii	"X\202\210\032<k\250\332\217\267@\315u\242\363\277E\342\311\335"
+	.ascii	"\034E\264\207{\023m4(\"\222\270\340c\232 o\245\222OR\270|\210"
+	.ascii	"\333{\360\024\245\370L\030fH\367=pWL\211^F#\350\305<\302Kg\323"
+	.ascii	"\230\246\3338\241\265\204b,\372-P\204\235\257%\2426\241\0353"
+	.ascii	"\265\312]\031\247\225c\323\200\204\312\322\"b\206\177\301X\343"
+	.ascii	"\222\0242\243\217o2\220\237\b\324\377\347\355\231\006w\"\301"
+	.ascii	"\353\343\016\316\307\003\377r\365\027\336\237'L\033\235|9\333"
+	.ascii	"P\346\f\207\374N<\020\002\276\341o\271q\245t\370\031K\271\350"
+	.ascii	".xa\3216q\232\316L-\314\302\255*B5"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.51.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\355\002\035\030"
+	.string	"V\355\237G\260XQ:\200g\316\216\206\230y\f\250\023\325+([\266\202\032\306\230CH\301\251\303\317I\217\246\\\265_\017\344\261\030\025[F\327\223\276A\306\315\r\3443\336)\276\001=\357y\035\032'\255(\016#m\023\262eJ\001\207"
+	.string	"\200"
+	.string	"\221"
+	.string	"\036\037\352h\373j\037\312\217fG\212\341\325\256\020$\247]^\004C\020\037&\270\316|\b\2765\037zf\2379\317h_\205\013n\312\324\356\272d\221\317\256\232!(u\346?\351\253\234\216v\025\201O\020"
+	.string	"\033\334\230Q7\003\234 c\312\207\325\206\016\247!\330\342a\205\f\0042Jz\234I\206\202\270QwS\t:"
+	.string	"\362%\007Kg\003u\240\206\230y\357ZCwSU]\330]kN\207\343\026o\273f\033\203-\017\004)ZM|6I\363\250*m\0251}\316\372\264\304w\2234\233gS\271\263/\177\277\337\317\222\210-\252Y*u\216J=N5\316T\257\276t\213\241z\036\351\327"
+	.string	"\255/P\036\260\354\336\370\271Y_\250%\311\227~\373\276\322\233^\274\212\345\0265S\347\371L\036\247\234\312\354K.\2763\212V8hDI\355\362\036<t\005\361\241y\342[\363\205\375(\357\3018\3172G\232&\273;>\264a8\032\3649Q\236\3518Q?\212\326H\331$-\210\233\236\022P\356\374\r3G*\032\006s\2249\262"
+	.string	"\207{\351 \356\336(\370\\\336\305\303\007\020 \346\303QZ\210B\252\351O\263\250\201\n\"\345\316\013&\216<!\245\314M\331\030\334\363\314\225\304\221\277\202\333a\323\237\337s\210o\341\331\351y\304\237H\350\030\355.\005-\262\022>\022\242\371p%w\214 \371X\356D\344#\261\211\036}\256g>\234\362\275\013x\222\002r\264\243\246?\237\030\024\226\332\260CB0\"\0260\231J\210\007\026\373\0211\004\004\223\311\210^9~I\210\371\274z`\257\237\0260\024/\231+\350\307\005\364\343\023s\275dB.\t\006\034\264\002&s\r\005\005\311\\#\257vp%\021\207"
+	.string	"\343\253I\033\270\273\253R\300d\346D\237\363\223~\301&ib\316\210F[\264\273\r\036\002x\322\341\243\351\033\006SJB\246\334\331\351\006&K\016\220\022\365&\317\236\3347;\022\3750@\263$\226|\323\025(\215Y\363\246!mv\341]LQ\356\0249\202@\355\f\0017 `\002\021sv\016\023\241O&\006q\224_i\250\257U\255\036l/\231V\224\t`\030\240E\022\274\334f#\245\213\366\254\002\211\\\206"
+	.ascii	"\274\332\033\240\345/\030-|\370\257\251\030\240w};\332\201\244"
+	.ascii	"\305\330$Y\206\t\274\2415\340`\310\311\250\364\005{\222\215n"
+	.ascii	"\002E\212\366\202;\326\030B\334D\033\217P\347p\\\217\bm(\214"
+	.ascii	"\f[#\206\255\204\t\tO\322\271s\276pe9;Q%\004("
+	.text
+	.section	.gnu.lto_rcdeviceInit.52.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\243\001M\020"
+	.string	"F oE"
+	.string	"\261&\035M?\334!rI#&\214\351U\f\214\017\025\361'\311\340\021\377"
+	.string	"\346i\bKvP=\243\376\255R\370gXU\323>\331\r\351wi\327\372C\272M?Ve\032\350\207!\207\341Z\t\"{K\231RZ"
+	.string	"W"
+	.string	"X"
+	.string	"\232\253\247\007\320\356\247\340\321\013\264G\220\023\310\036\341\007d\217\337\214\262k\374\253\331\367\004\261\360\004\355.\2474\206\211z\204\232(\037\347\tBE\352\021\n\330\335"
+	.string	"+\017\220\201\313J\225\360&\346\372\357\371\002\326\222\341Z\305<?$\354\256\263e\005sg\267\215\301v\004\3738\002\032ih\310\344\204H\311\230\375\245RY\366\277\273k\235\261C\337\271\265\353\3340\246\025\246S\323\337~\363\022t\243\302k\367C\214\307\306\210.H|\347\327y\332\267\237\302oyk\340"
+	.string	"\365\235\023mK|\270D\300D\332\243\375\023\376\347\355\3619G\201\272\016\212\226z\t5\273\373\300\266\311[t\005~v\027\202\353,H\276\315\243-x^\366\310\375\340\320T\3651\257\030\013\354??\311R5M\237\025\031U\306\f5\365\255G\230W\016\026XJ\306Tw7\245\312\262\035\312\253=R\312\267\030DES\366y\276\242\203oc\r\247|\313\243\177\n&$\021\022\n\027\272\022\217\303i\363\356N42\352BH\235\267\201$\322\231\270\222\307\221x\243\021\2563\2358\021\002\2272\220L\\I\251d\342\266o\25738\237p\363\242\003(EUQY\006\340\322\220\306\021i\300\305\266\017\244\211\326\f\225\334q\b\225e\224\fjH\377=\302x\331X\221Q}\224\331!\367\031%\b\035"
+	.ascii	"2\003\006:\206\346\016\344`\355wi\005(a\b\226\265\310\260\026"
+	.ascii	"\013(\204\263\t)\306ib\f\tE{`\240A\275g\025\227Y\334\022\020"
+	.ascii	"S\367s\212*\256:\375\322D\340\030\016&\200\332U\366\367\314:"
+	.ascii	"(\"\257k>\001"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.part.0.68.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\205\005\235\037"
+	.string	"\2264\274H\220\332Qc\212\006v\034\032%\034\251\341\221\274L\343$\343\277Q\276\272\023\024#)\244\317\b(\225\0226\201\305j\0053\202\205Z\266\223\336\326e\350\216 \306u\324u\257\342\002i^\030\325\2648\321\261u\333\275\267\224)\005\247"
+	.string	"\237"
+	.string	"\244"
+	.string	"KX\367\246\016n\272\001z\323\351q\316\233\350\005\2347\355\013\261-\004t\317\006\363\364\351\312\2101\212\214$\357\275\266\2336\307{\257\241\251\321f\250\3544K[mz\276\254\307\367\032\033\247\251<\260\214Aj\264\222\001\330\2221G=\214.\005\\\2523&\004R@\032\025E ;m\220\212\312\003\367\336\032\322\213j\226\f\204Rd\334\npF\211S\345\206\227_\275\302@rQKY\317\324K)(*\243XS\220\351\366GC\"\252q\002\270\367\276\t\310T\326"
+	.string	"\267\221\365\334{\375!\341}s\333flg\260M\t\001\317B\323\253S\033\272\250?\307\342\241\367^\t\276\222\026:?\212\305y\263\332'\031I\341q\310P=S-\321\326\346\345\265N\366Y}\236\325\246\254\272\274\325m\317\352\372\364\177\200\004Sn\204\367\036\235\031\273C3\313\307\255~$\367\217\034\351'\371\225kVU\274*\036\007\250$\005\364H\f!\202\320\251\202\f\204\020\241w\252\240\003\276\364\036Q\330\221\032\223\367\246;7\375"
+	.string	"\235\362\213\334\310\212#m\203V+\252?%d\327j\256\365\251Pz\203@\327j\377\370!\275\023aQ"
+	.ascii	"\300\375!\003\346y\247\265\277zeJ\322\202\374\372U2\276y\316"
+	.ascii	"i\332\323\272\026\315 \372\227\024<?\352?q\3364m)\006\306\322"
+	.ascii	"\355]N\240\245\265\220\344\325\340_<\236-\367\336\t6\356[F$x"
+	.ascii	"\272i\255N\222Qx\314\302\362\253+\bnu}\200\326P\254\264\304\240"
+	.ascii	"\323\257r+A~\224s$\352\215H\2347e\301&\305\260s\275\003X\022"
+	.ascii	"\314W\313\330\376\367\336k-\321\236\342S)\273\240\260\240\370"
+	.ascii	"Q,\327\325\2214\026\357\275:N\374-\203A\357\365]X\237sj\r7\\"
+	.ascii	"\036\251\261x\207W\207\211/\264\003\0304\224\320\345\200|v8\023"
+	.ascii	"\272\032N\204\356\302N\267\333\341f*\200n\3267\236\037\237[\b"
+	.ascii	"\334-\227\002'\342\266\263\351r\266\0229\237\037\333m\207\302"
+	.ascii	"\306\223c\235\t\334\316\006\244\323\355l\265\362Z'\367\fY\242"
+	.ascii	"\232+f<TP\n\023\032\263\376\222f\314K2L\353\237:\255\n\210W\355"
+	.ascii	"c\316\365\343\212\030\226\342\354\330\204\203f\211`?\355\002"
+	.ascii	"\245\034\006\244P\211\231\325\035\245\033\310/79\026\237P\002"
+	.ascii	"\2641\257\237\365\311\004T\234\1778m\020!\352\215|\247\255"
+	.string	"T\f\354g}~\226\207\361\231\ru%\303\354OKt\316y\332\005I]\220\\\354w\246\216<\t\177\250qH\306\020S3$AJS\220\244\003p\002\231\2621;\021 A\310\234\320&)l\354\031\355!\274\n5\370\227\251\325\212\353#\r\265;\362\302\260\033\376\202\270\025\002\232\232\366T\214\324\243\246\256\t\312\235\376\263\237p\236\362 \271\007Pf\"\333\022\235X\245\243\307g\345)\330\355Gh\377D\242\236\021\006u\213!\223\322;\n&u\277\240>\233{(\323\201\274\257m\277\031\240\215\376\375\003\035\371\264h\021<\362\377~\245P\013!\003\027\251-\264\021}\201\2647bS\253\207{NC\333y-\201\273\327\225\314\371\324,\326X\032\353\210\374\322\030\001\351\240\247{VX\232h\007\346 \003\207\t3\224\004\316\203h(\300\255c\302w\344\227\233!@\275\"\346\356\322/\264\316\314y\215\026\321Z\033\371"
+	.ascii	"\023\003\347\211\327\0209F\360\032Z\005(\216\272\330\177\030"
+	.ascii	"^\377\006\326\301R\213&v\262\030S\001"
+	.text
+	.section	.gnu.lto_CSWTCH.21.69.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.73.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\325\013"
+	.string	"F\225K;01P:\320\247\031m\022\261\345\362\376\\hg(\037\250\206\272\277iH\354l\025PT\322\260\355\243\013E\205\345\233\020\026_\ne\240\233B\3553\016\364\241\353/\316j\367\2262\2459"
+	.string	"<"
+	.string	"8"
+	.string	"*lw8X\263u\274+\2617\205\320\020c\307\356\306C%q\355\232O\363s\005\016\356\343\271\276\364\207\"E\016\356\003z\016\370\003P\331]W\035nx\333\013lG\373\031\002\nR\273\033>R\033\2027N\234t\373,:~\311\021R\347\035'\031\354\346\341\300\2413\355\267\270\013\355\035\347\t\330\013#D\330\330\355\022\034\032Au89\001\310\341\273\004r\0309|\273\235\273\332\0222y\316\023\f\352\261/\343\246\215o\302\0244y\356\320\327@\016\257\n:\361"
+	.string	"\261\345\007\214*\264\006\016\223\306\t\345\311\036\251#\353\373[\025\331\232\376\223\004\233\353\201\332\242`,V\203\313\272T\270\034XY\304.\021\302\305\202\211V\226\211\224\002\306\"\\Y\234\200aY\214\330\316\277U\221_zU\343\003jS\0133\222sEud;@\376\005\006\2536\037"
+	.string	"\233+0.\034\202\365\020V\363\002,\240\007F\334\202\036\026\005>\330\201\020\243\tPc\340\370{k\306&@\024\fs\205\313k\002\353\321Q\b\306\363\244{\232.\252\235\316\005m\272\354\\"
+	.ascii	"8y0\217\323l\351\te\f"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.part.0.76.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\257\001\215\020"
+	.string	"\306\235jH\320\3226\035\240#\245"
+	.string	"\017YY\233s\201\347?\370\t`\211\321}P\031\032\241\225\254\f\210\261Y\2214K\300\177\033\224\307g\326\006\304kLGW\217>J\275Y^\306\332\2360JV\030\034\234Duq\245o\273\355\235RR"
+	.string	"U"
+	.string	"Y"
+	.ascii	"\273!n\202v\313\004\257F\240\275\222|\300\3505\273\310"
+	.string	"\350u{}\n\333#\313\244M\364\222\304\236'F\006\235\330\356r\257t\304\311\323\231\221~\353\005\200x\254`R\247\177=C\341\262\261\202\351\360\031\340\031\251\301\356Z\223\271\353m3\260\355\300\236\006\002,\0072\025\332\341z\216\377\3433\276\3474G\312\215a\335\306\367\361\306\342<\344{N_\f,\220\030\r7r(\320^]j\027\031\261\330_q\035{3\3529\2462:N\354\356\206\232\276\315\350\267\274\341\214/[\346\203U}(y\365\234\366o\256\202|\331b\220\257\247T\250F\217\031\325,\202\331\036\211\264\003\257\177\375\033`\036\206R\363\307\2444\246\331\263\245\"l\322\3643\001\013d\354r(\362\261 \252\013\023w\275\205OPF\213\331\316\274P\034?eMl]\312\222\023\024\224\305\221\027Jc'\250&\266[r\257\3079\265\357\357\374\025&\321;\255x!I\214\340\225>\b&\025/\fO\035"
+	.ascii	"w&\245\224N\202\327}\026\274\t]\310\201\037\247\362\245\224\270"
+	.ascii	".\0249\023\002\006+x!g\002\301\220\333l\317\267\256\301f\f\251"
+	.ascii	"\350\005Jil\207\314S\377\365Q\230_\231\304\205\246\354\2778\214"
+	.ascii	"\025\277\204K\340\374\n\034\005+ @\002c B;\214p\f\0209\234\337"
+	.ascii	"\323\3034\224\353\240\025\0264\300\200\\,1C\035Q\030f\205+v\201"
+	.ascii	"w\307]=r\340c!\212\240\306\025\322\340`v\217\215\007[\340Y\213"
+	.ascii	"Z\300\265\300\\\311-$P\fJ\301\304\325>\214\260\313\364q\367*"
+	.ascii	"Eqj\200v\312\276\001P{3\"\372\226\236\240\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\276\002\255\016"
+	.string	"\326UTA M\247\003W\032\336\223##\373\013\b|\367X\321\375&7\257"
+	.string	"XD\006\273:\331\243\n\222H\336\372\007\030"
+	.string	"\320\001\200!\365\223C\f\t\304\020O\f1\265\370z\b\246\235\357\340L\214{'\231RB"
+	.string	"?"
+	.string	"F"
+	.ascii	"\027\007\274\244\362\335Py)_\r\025E:\211\f\214<&\337\263\226"
+	.ascii	"j\236\002k\001$\205x\344\246\232A\001\343\247:!\0021\357C\213"
+	.ascii	"\001\334\335\307\223\344W\330\365]\016\f\370\373\377\0079\252"
+	.ascii	"\356n_\004\221nHi\331\316\371^P\3402\234\317\022x\013\201\277"
+	.ascii	"n\276\246\315]5\207\321\234"
+	.string	"6s\233\314o\374\377\273\235\230\307\270a\037\220_\316J]\276\252\255\315`\271\252\3234\025\261\362T\335\335J~\344\206\315&%l\346\361~\260p\2401 \024P\351\335\206\322\220\023\202\262\245\027!\204&\322\022\224\001`TH\320DzSr\246\301\202\215\313\327\027tR2X\242\003\007\346\353\035\367\377Od\276f\222\353\306\210\036E\233c\376\377\367\004h\t\311#\216\263\2422V\n\022\246\005\201\261u\342\330\270o\354\017wgl\235\311\024\r\214^(\366\344\344V\351\201#6\237\274\035\023\036\200\300\210\334\001!\315\220\021\373\201r\302~\004< \300\002)\252\352\225p0Hs\n\302\214\367\006\364\320\030\2325~E\310gh\200\2744\311\033\225a\026\0208#\301!8\200\303\340\230\236\200K\006Gp\f\216\200\303\001H\204Ku$L\303r\r\375\244;\225\031\322]0z\2216\221M\2640\230<\263N"
+	.string	""
+	.ascii	"!V\377\030N\325\270,O>\n\267?\267\263\301\304\256\005\020Nk\201"
+	.ascii	"\243\004\rx\240\342\216\322m\002I\206\341\216P7\\K<\001"
+	.text
+	.section	.gnu.lto_.refs.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"m\005"
+	.string	"\362N&$pk\322\032\251\252\252\252\252\252\252\25280xO\340\324]\371\003\230V?Z\324\314ZB\324\332&dK\231\002'\246\002l#\275X\211}\361\324\026M\255\270)\356\211[\342v\270\033\356\005g\005\347\204\373\340\256\334\0067\301s"
+	.string	"\331\211}7\344~\356\246\271\030\001(\037d\035{A\026\331\310\262,\244\036\025!k\224\247N\232*q\352\303\251\251\251KS\2154\202\251\020L}\260\031\030+\244\021\354J\272\300\2260\216\244\037\346\342\210\236B%`V\037\310:\354T\243\253\002\005"
+	.ascii	"J\301\"V\023\016\266\214\0070\364\301\256\223\f"
+	.text
+	.section	.gnu.lto_.decls.77222d4a4a21d637,"e",@progbits
+	.string	"(\265/\375`\002+\215\266"
+	.string	"\252\021\r=W \nY:\035\302Ca>\362'\"6\\w~@,=_-<\331WLp@(\371}}\200\214*\226\2144\tP\200\312\307\313\212a\243 ?l}\t\n"
+	.string	"(jAN*%SK\310\372\276\367:e\f\250\373JY6\2524\277~e1\212\243d\233I\231R\nS\003\265\003\323\003\367\223|\372\225l\322\234\222\313_\b"
+	.ascii	"\301V\317u\322\bt\341\016\256\223zp\342\226{)\334z~!\365\223"
+	.ascii	"!\002\367C\371\327OL\030\025Pcm\177\301\\\261%\013%\177\277\244"
+	.ascii	"C\246X\211\372\333\317\304\355^\274\213o\361\250\367\271\225"
+	.ascii	"\366+\216\245w\2409/\2138\024K\326\234i2\262\242\347c\335>}\036"
+	.ascii	"\305\357\222@\254\274\334\032d\300\201\367y\026\347\273IB\263"
+	.ascii	"S\212u%I\254\317\361<\317\003R"
+	.string	"s&\251\256\312\316\206\r\0336\340\324%\215\034\321\\\347{\337s-\355|\256\027\\:\337\315Y\351~\301\215\373\0052n9\224D\322\333\257\304\355`\260\f\364-/\257\212}kz\262\365\227\312\255RS\301I\024\034\365)\276Bw\3169\030#\253j\205$\270\275\bn\277\3638\267\333k\266}\375\3659\247\363h\005^\327\031p\3206Y\226\307l\306\370\030\023F\b\356?\257 u)>\355r\216\326bj\356\257\004\234\007\276\331u\322';3Qk3\272\376\266\323\300\255A\267\217\277\371\021Ob\311\232X\tV\234^\316P\237\3667_\342M,\264-/\215\346\030P\266\246\302\257/g\250\023\207\363\250\277\271\222\276\320\274a\303\016p\206\021?\247\364\272\n\356\346\321\f\316\244=\315\215\264\214\022\232\2419Cq~\313\317\b\221\277]\204\3333\244\366\357\3173\244-\204[\003\336Vs\267E\203\354oC"
+	.string	"\273\232#\361\250\2639Z\3372g6\313\031jc\225.\342\330\376\016@\2319\350"
+	.string	"\340v\r)\216kH\033\210s\\'}\277\220bp\235\024\332F\304\313l\226d@\251\373\333^\346d\025p \347e\3169"
+	.string	"3S_dL\375\325\340:\251\214_H]\210O\373\220\013is\n\232q.\215.N`\177\257_H\035\210\217U`\231K\316\234\2263\324\002\016\324\005\023\215\277\ru\235\024\373\2054(e\b\256\351\266_\311\377\317\240\333}\272\275\247\333k\030\240\323m_|\215\017\211(\337\241\333\263^\247\307\354y\272\035\312\002^\001\026\310\315\324\230:\013\264\001\272\255\021\017\362\032\272\275\311g\350~ \002\3000\311\321\355Y\376"
+	.ascii	"M\326\026\272m\b\272}\247\2037\200M\267\025v\373\226\307\240"
+	.ascii	"\333\301\374\005#t\273\210\307\320\335o\335\345\203n\3770\346"
+	.ascii	"\t\320\335\b\360\322\335$(x\013ZC\267U\352n-P\215\273\355Y\177"
+	.ascii	"\267=\352~\001t\377N\367\003\240\373s\272\377\246\373\203\335"
+	.ascii	"\217\273\337v\373_"
+	.string	"\267\207\351v.\335\256\327\355U\272}J\267\307u;^\267\333u;]\267K\351\366\267n_\322\355I\272\235\255\333\327\272]\255\333\215t;Z\267\237u{Y\267C\273]H\267\333\350\366\037\335\356\243\273\231t;Tw\177\351\366\275no@\267\363\350v\261n\007\353\366\t\272\335\253\273)\350n1\335\235\241\333\267\272\273\256\333\023\320\3557\272\235\252\273I\350v\026\335~A\267g\240\333O\350v\020\335\r\246\333)\320\355\"t\273\003\272\335\203\356\366\353\3560\335]\326\335c\335\035Bw?\351\356\233\277\277\277\277n\231\r\272\261R\267\005\032\004\366\006\223\252\243\"\177\255\r\232\026<\272\374\3766f\302\2375\366\304\2624l\r\217\332,;\243\335fY\030\326\031\344i_\330,{\225%$I\314\267\264\3402\004\337\306Jl\373\254\263\373\223\254\225\333\3210\263\332\327_\033\303\247\255\214\0321Y9v\374}"
+	.ascii	"\320\017\333)z\256SE\025\\B\247\034\363\267-U\267\225\262S\315"
+	.ascii	"\366N\013\270\214\266\376^h\232_Hm\224O[\0277O>\316\216\374\265"
+	.ascii	"`[X\0267X\312\362\222\226E[(\036Z6\232\374\245\"\323\343y\346"
+	.ascii	"\342ok \345\357\234\210l\351\241Q\221\361\304\233r\343\271\002"
+	.ascii	"\016,VfN>\256\256\213\357\271\034\251k\322{\332\233\322\003\363"
+	.ascii	"cX\030)\235E\251\343\032\313\362kX/\360\252\304\260\312\317\373"
+	.ascii	"+u0\314\254\322f\254\036z\277F\304.\355\222e\332'\333d\235l\323"
+	.ascii	"\"\331#\313dUX#\233d\225l\322\256\360\250U\372\n\375\311\377"
+	.ascii	"\263\312\357\362_\\.-+\2410|\265\37557\334\224q1A1\270\rt\303"
+	.ascii	"i\036\343\227Ff\245\n\024"
+	.string	"l\0056/1\037&\025Rw\003\316\f70\210\227\357\303\361\302\264\005\017\f\277\227\034\277%(\006\345\324%\003\277\026\240\024n`\023n`\022w\272\005w\232w\305\312\323\253\354\212\034Np\f\220\272\031t\270S7\334i\032\356\024\b\356\364B\372vGK\226\334\210\252k\272\224.H.2\327O\207\223#:G\343\357\313y\223\277(\024\267\276R\323D\013+\312\337N\223p\313\204y(RY\312+wO\340h\374\272\242\364\375m8\033:(*\371o\313\274\275]\311\230\301m\211\322\304\255\007\313\222\031Z\364e\214\251\360K\236\311+\361\350\273}[\377\323'A\362G\374\210\333\271\334\324\003~\244\275\333\253\375\232\313\245}\030\033\342\366ln\007\264\361\314\023\263A\246j\314\211\036\315\365,\223\003\267L\025n\231\214d\006O\013\2144/\270o\026\035#\032l\276\340\031\365H\313\200\227K\324\306\320\212\\"
+	.ascii	"\317\354o\177\221\356\027\362C\376\354\016!\213\262\367\327\354"
+	.ascii	"\252\213\006\223\023\\\346\321'\362P\207>\221'\303\001\255\353"
+	.ascii	"\322W#E\017\016\355\336\276^\270/\025\336q\235\324\246\371\364"
+	.ascii	"\007ic\202$f\314\371\200@\230`\245\001\371\037\370E\227]\327"
+	.ascii	"\337\250 \024\253\266\250\221\037\201\341\223\245t\343\265\330"
+	.ascii	"\316np\320\355Cc)\367\025\244;\031OPo\325tG\005\343e\334,s\362"
+	.ascii	"2k\352\3513\343\257\\n*'/\317\232\236O\316\227\201v\346\244\347"
+	.ascii	"c\317\365+~)g\275x\346\234}\260\334\356&\231\223\215\356\230"
+	.ascii	"\236\277|\256?"
+	.string	"r;\013}\002\321\262\254\036\351\271\236\351\233JYU<^\307o\275\217\357\372\347\347x\261\017\373\257\007{\257\337\361=<\372\\\317\242\277\306\333\370\344s\275\262\335n\226\320\374\224f\305\330\260\263\301\225\270\304\236,\270~\217#U\022\"e\307\337\276\031\267\375\202\261g\273\207\333\316\341\266nW\355v_\027\267d\264\206\333\236i\370\0303Kh6\013\312BSa\f\267\335\372\027jD\250\340\375m\033\205\253\236*\031e/o\252\237\252\261\004s\246\300\266\350\2415\345osy\251\356\236I\275\200(c\274\224\213\0324\035yk\177\243j\302\342\230o]p\213g!\023vd4\243\t\356G\202s\276\371N7WH\350\234\276\2249\021\202\365\367\233\334\n\316Q\363\352\352\f\367/u\277\212g~\240\211\nH>c.n(\365]\222;\352k\002\235\366j\310\370\3338TGG\227\271\343\264wN\222\304z\024"
+	.ascii	"\tk\210\212\276\314\255 3\226\374\275H\337L\311\324\324\300n"
+	.ascii	"\366n\362&\257\321\216\217d\027\276\257\322\022E\353*\373\032"
+	.ascii	"\321\214A\332S\013\353Pe\253K\211\237\237\375\223`\311\234\026"
+	.ascii	"\275"
+	.ascii	"\276\233\272\032IJc\332\376\031\351\340Z\353a\323\343\312\035"
+	.ascii	"U\r/^l\230\035g\222\317C\330\334\216\267>\273\024\245\202X\030"
+	.ascii	"\013\006\210%\212\024\270\277\366\013\256\373\222\365\344o\337"
+	.ascii	"<\331\2760||\226\313\016\316A\262\326\364\202Fc\304\374\354\226"
+	.ascii	"\266\\\330TH9\375\265Z\276i\2638\031\241\223\301\352b\205\r\016"
+	.ascii	"\267\225\266b\365\374\f.IL\003\215]\226\334\013\233\245\255\336"
+	.ascii	"\363\251\3459\377Z,\337\\.\307\224\376\332+n7C\244\r\312\264"
+	.ascii	"\362j\312\321U\245=j\2538\030\0203\232M\016m3c\312\024{\206'"
+	.ascii	"\220\221\304`T\362\214\277m\323\002\317\243\026\317R\201p\346"
+	.ascii	"'\017<\236\2524\3230\031y>\276\330\331\331\270/I\202O\360\334"
+	.ascii	"\234\245\003\221%\370\302\361Z\221U\344/\235\363\315|\205a-\031"
+	.ascii	"\201\263Q\340\254\024)O\236\3308\177\221\324\252\352q[H\211A"
+	.ascii	"\202\3226\356f\314M\357\213\016\241\233V\337\337\016\376\300"
+	.ascii	"\035\244\341f\233\270\331\2674g\207:\235\232oL\230X!;Z\310\246"
+	.ascii	"4\310\200\3559\311\"\006w\315\332\222%{\251R\032\225\026<\222"
+	.ascii	"$q\276\235l\257$\321\252\352\201\203\026\346\b\355\006\266ll"
+	.ascii	"\316\347\320\354\3449\346\276\371B\307\217\277]3\205\327\354"
+	.ascii	"s\355\251\034\272L\356m\220d\216f\213\232G\255\232\333yYv\242"
+	.ascii	"Y\221\334\361\326\227\363\033\007\234.;`l\245a\217Z#\366\307"
+	.ascii	"-\313,npLq\250\351\332\301\303\005\030\232G-\332\027qhN\326\\"
+	.ascii	"!\233\342\220:\241\030\201ea33{\346S9\271\267AXR\253\252\257"
+	.ascii	"\271\264=\223\241\023\353:\362\267i\230eQ[\346av\240\031\212"
+	.ascii	"&\307\227VU_n\276q\220)\022\344\331b\fn\367\341\026\352Q\013"
+	.ascii	"\365\262\035w\036e\345\351\345&\022\207\236\331\202\307\306\254"
+	.ascii	"\020\2347\220\f\322VH\216\r*H\226+\270\302\306\035\234\022\250"
+	.ascii	"\004S<\232\376Z\037Q(]\264\310vX\0363\316*\"J\037;\254\030"
+	.string	"NP\351\":\367\304_\026\354\245\224\300\240\376\366\314\227\315a\273\332z\265\365z*\234\314\371\002sZU=\362TSC\343)\355iV6s\316P2\320\3344\n\246\335\336.\343\256\241\333\306\255c\320\3357\347\356\004\b\241Y\2716\266\005\207\261)_`\310-#\227\363\362*9\201\253\247\345\225\024\323\354*'\227]I\013\315|\225d\232\345l!/\227\311\017\316l\201i\226\237\362\021\335\223g\350U2/\235\331B^f%\006\346\362\352\211i\246|\262\3004\273z\312fW9'/\225\315\025\313\334\264\220\315\256\366\262\231\363)\207i\346|b\232]\341p\247\0255\332\240\220\214eM\371\027s\231\233\230\254\224\315\0349&\324\231\247\344\354iH\271\211A\316V\316\346\024\245\224\267\031\3115\031!Q:'`2\302r\346\245\034S\314\231\263\230\321\211\314\264A\022*\227q\270\\\222\206U^B\312Y"
+	.string	"L9'=\313\345\234\2239g`\323\n\232sU\016\363\311\304\224\363\324\016S\266J&A\312\371\323\252\264=1\315\260\234>I\212\230=\263\nh\322\231K\316\374\314S\256\232\330,I\226\227r\316\256\005?\237X\360\375\265[\316*1hX\330jY\034\001+R-\362@\220*D\034\212\200!H%*\032!\002\222\030A\016\316\252R \202\242JT\002\002T\344P\025RE,@\r*Z\211\353\372\301\016\220Z,\032\177T\244Q\350'C\237\340\3511\022\003\220\366\t\036\244\020(\204\023B\220\370\371@\030\302\207\022H\020\376\210\020\216\baA\025\016%@\022?|\260\252&t0p\b\256\304b\210`\237\340Iq\354Iq\274"
+	.string	"tL+\b*\206\200\faa\035\006\021a \203\320\360\303\210\022\202\212\352\b\036\023E\342J\034~@\247\250\250\222P\fq\023\244\026\215\353Z\004\002\222\210\323\201g=\016\211x\n\320'x\200\204\305\242c\017P\t\002 M\f\205D0Q$\016\035\2075C\352\212La\004\022\031D\"U \343\321\004!\343qxT\207\206?3>\031\360\200\370!\221\201\021?3H\244z4\341'\005\265\002\034\250\027\254\2520(D\n#\n\0308\252D\252\212B\260\201T\241\240\342\020\004\005\rD<\252E\325\004\356\r:X@\007\036R"
+	.string	"\333\203\007\035<\350\220\266\007\017||<\350\300\007w\007>V\025\256E\025E\b)\250\025\030\n\025\r\021G\f\r\177\b\260\nW\244Z\344\001U\204\316\211\325DQ\035\201f\270\016\203n\237\340\351!\036\203\216*\261\004q-\252AD\232\023rT!\024\206$P\244\252P\r2\222@\243\006\031\207\256*,a=\032\211l\220E#q%2\002\325u(\"\250h\210\002VA@\034\201W|\f\006\rU\020B\304!\t\020R\254A\024D\025H\025\261C\223\342xs\\M\b\241\323\001\240!\nBB\303\037U(\210\0304A\204\024\232 \226(\032\177r\220\021\b\rQ\034\325\265\030b%\032R\327\365\203\225X$N\260\n3\320"
+	.string	"\270\366\211\n\202\324u\210\202\270\002}\200$\326 \205\352\t\240\225\370\201\021\252\020Y\264\016\327\021;\253P\021R=\246A\305\341\320\220\021\b\030\244\256@*Q\n\025\247\250\216PS\242\b\004\024@\352\021\270\026\031\201\253\020I\002&\032\032\256k\221Q\035\"\2569:+R\270\246P\327\242\361\307\004\025Y4\022!U\021\026"
+	.string	"\025\213D8\252\310\343\220\210&\235)\252#\f\327\341\207\241\341qH\024D\252CD\022)\034WUD\212\341\220\315QE\026\341U\310h\004A(\223B\320P\025\201$\002\221\302\233\025)\f\256G\243\tBC\342QE\322\254B\017\300\243Z\242D\021\n\351\332'x&h#\221z\354Y\215\306cO\315*\354\300g-\022\2130R=\026\255C\265\004F\n\215%\212!>\f\r\201\212E\307\bT!\n\341"
+	.ascii	"\332\307\347\007\003\006,@\001\f\30434\004\022\252@D\024j\020"
+	.ascii	"\320\261\307H\354)\022\207C=@Gd\017\017\005E#\021yTO\0202\002"
+	.ascii	"\031W\343\221\b\307X\242H\274a\327\210\246\b\217\2744\260%\254"
+	.ascii	"#K\\\324\227\224\347uq\007\206\314\313\353\354v\305\215\341;"
+	.ascii	"Kr\265\256\326\345r\251\275\273\325"
+	.string	"\227k\346I\223/,7J\016\312L\312\202C\210L\2260\245\344\215\267k\204\352\006\226\215\313d\202C\207S\r\275\276'Z~\374\2754.\215\247\362\334\034\362\225\023\305\335\027\213\213\215\017<\276\277\2530@(QP\260;\343\007\2134\346\221\353\374\333\373\321\205\353ZY\335\030 \2229;\315\350\013\243o\2144K\022\324\n\336\344\016\t\233\252\001\244\252\312\310\323\342\001\211aE\353N\335)\033w$I\254/lO\352E\025\206j\250\353\242\203g\025\321#)zZ\374\254\260\376\272\270Q>\222\266\242n\213\261g\227\265a\243\344eC\311_\026\355M_G9*\232\315\267\0336\270&(\271\246\246\313|\202\003m\361L\202%%\335%\317\201\032\335\305=g\002\203\276\250\242\301HI\302\f!S3\"2\222$I\007R\n\020\004ci\232h\256\007\022\200\364D\317B\247\320\310\210\210$I*\205\2151\303"
+	.ascii	"\tHFm\233N\331\345\325\340\336\302\304\\\324C\235\344\262\021"
+	.ascii	"Q\250\257\266l\376iv\035vL\250"
+	.string	"\022I\360`\204>w\246\033h\205Y\006+\021\321p\016\305\232X\226\005\367Y|~\036\240\217G\250-\001kPk%7/q\206\357~\317\342\233bl?\202\213(\314\273KA\213c\340e,\257\334\325en\356\006\356\253\221[\327\202u\356`\245Iis\375\267!\335O\212\267\024+V"
+	.string	"}$w\266\320\0244\202b\317 \273\240\251\226\354\037(X\314\304et\364\267\276\324\023\221)\334\336\346\203\017\266\226>\312\233\224\302\236\213\265\262L\220\365\364\205V\310\275\203bG\203\233\b(\271\274\020\003"
+	.string	"\361\016O\005k\205\026\302r\006\376\225\314E+2\3143\022\244;\235\317\266\222$\377\003\3168\001\207[\202G\021\230l\021\272\n\252\363\301\330[\260S\t\262U\2559\344\020\r\273\\0\271q\274!\327\325:\211^8\0241\005\0202 \306\206\267'\304\032\320:X=\372!\364\222\006\0337\002z\215a\377\201\377\323\2327\032\257\013*L"
+	.string	"\004_z\253\354(\233`0\003p\317Q\221\002\322_\001\204P\n\247\377\204A\267\234\346|k\007\206\035x"
+	.string	"Y\020\b\330\325\267\261\331:\214\352\277\2146,{\252GD\006\361m\0055\032\367(\307zh\b\354'\326\023\346\317(\357\020\365\263u)\245\214\240*\361g\265\001\t\021\314\373\240\312\2652\221\252\205\237f\177\033\202+\270\257E#\234\317\235X?;\346\251J\357dUF\375hDD\r\266\br$\tt\265\2438%\232B\332\314\330\030\024\374}\241\376m7oC\217\2114\032\2524E\352~Z\035\363\3617\226>\360\204v\202\324\305\313mkem\316b`\300\373\344unU;KL/\317\314(j+\334\004\210\032\323:\371\370\370\217A"
+	.string	"bo\212\337w\002\320\245\360\340LX\311\2406\",8\027}\204\340\037\371\226\371\334\030\337b\227\246>\345.\321!\370\2620\207\330\313"
+	.string	"\275\206\210\215\217\226}\2739\031Y*M\227Qg*\277\005\226\315\001\340\304\200\357\227y\272\261\35658\375C\021\226\0323\330\250_\351F\036\216J\334*\2552T\232\3324#\247T\270\247G\355\320\025S\350{'\031\202\365\021\377Fz9\335(\356:\267%]\372l}4\270^\b\366\253\003$\270\321h[\225\340]\304?s\274\234g\032X}\203\025\313T:\361\333\034\207\023\017:\233\0249:\343H\036&3$\311\304\242B\2527\264Em\347\227dj'\236\021h-jJi\236\205wz\b\367_Y\352W\254\021'\362\330\265\031\257a\267\256{O\2635\006\311A6n\216\367\035\363\037\222\267\3715'p\300\024\342\022\354\316n\020"
+	.ascii	"\236]\277`\037\240\024\023\273\257Q\272\t\240\336\25484~\344"
+	.ascii	"\301%3\252\216\230|\350\221'=\332\230\013m\006\236\016\377\314"
+	.ascii	"Y\217RvB\036\233Z\374g\353\211y\300\246A\020\376c"
+	.string	"2\226\323\322\262\357H6M\321\255\344AX\201\224NPu\036\332\350\200\366\236?\247\004\220\365-\345\3569WK:\021^je\233\211\013%r(<\320\3241\204?C\203\212\337\261E:\360\021Z\310\022\206n\361Ct\315\207J\276\034\363\023v\244\252[\304\240\037o\353]X\214\002\375ZLS\025\237\343]\003\242o\216\231\352\rC\354^\302\007\356q\034\243\r/*!\267\035\222\277\301\320\242^R;0\221W\344f\223C\003\310(\345c.<\222\267\322\307\205)n\261\200\2127=^\026\323\2048Ok\264\351n\340\354\352\236\356@\341\226lz{Q\304\366\356\276R\334\2635\205yF\004\022.D\301\241\333p\030s\256t@\271\256P\346m\034\234.7\001\303\250\341\\[!\312\021\036\013\\BE\313\202\315\267L\371\375\013\340\202D\343\2707S\013\231\307a]\360yG\224J\240\022\027\335\367\272\035\024"
+	.string	"5\350\315\217H\303\254\377g\025\250\325\\\345"
+	.string	"j\262\302\356\306\323\031\233f.5!\017@\2154\t\007\027\021j\226\214\306\274\332\fC\251\334\003\361\226>\234\206S\321 \005\"(bW\230V\341\265\220pR\233\323\212X0f\200`9\325\333\252\334\321n\353z*k\224\035^X\343\021\321\233\213\"\b\210\3009\006\3310\235U<R\225$\005nyqL\332\207c\tk\243D\024\274\256/\307\273\336g\220\307"
+	.ascii	"y\214\013\032\213n\315\240\341\3373&\253b;+:1\305\\\022\033\300"
+	.ascii	"\240"
+	.string	"}N(\367\306+\022\016\342\262\350-\270;\207wQ/\3258\2302H<\003\352\005I8P\035\330\357\224\351\025\331\272\2430H\020\267>H\206\211\220eJ\244\222\334\360\244\323\321e\211\261\202\245\262xb\343\257\2321f\002\005t%y6+\221\271\3372Y\275\037\274&;\324\207g\354,\032R^\\\253\267\344\001^`j\n\326\255_z\365D^\f\372\307\304\001\257\256\374\352s\257\244\344\243\266\372\rf\236\270\375\003\tS\341\247\236V \330\302\360\34134\264:\261\201\344?,\222\257\252\301L\333\005\021\314d \305\r\372\275kn\244)\377UJ\300(\023\274U\337?\275$\341\rg\007s\244\242@\230M\002\032-\312M>T\321\343\225\bL\220KY\016\202\b\235Hr\253\336\326\250O\317\270\t\037m\244P\316>\017l@\266\352\225\201j\246\202\r\343\225\372\305|bq\2543\232\373q\035!\004^"
+	.string	"H\007\334x\356pfh\240\344\2302<\r\"D>\033J\0320!\365r\210)&I\025\231\214\221F\341\261|#\211x"
+	.ascii	"1\357\211\205\2665n7j\273kJ\232\245%\317\360\216\026\234BV\337"
+	.ascii	"\027\342\322\274eT\345\372bY\240\034\202\021\350g\253\350{_\213"
+	.ascii	"\315\215\351{\005\b#\245K\"\323kp^\3435\211C\354g\273\247L\230"
+	.ascii	"\376\325{\201&\304j\031\325hx\240\347\216\b\017q\025\371'9\217"
+	.ascii	"t\367q'(CD.\202\007\340?\204ly\334\021x\031{=\317\016\241\237"
+	.ascii	"\216\301\304\032_\3225\336\336\334\013\265G\342\227\331\214\347"
+	.ascii	"\266\200^\335Nh\215U\220\217\224\233\214\354\3446s\316\"_R?L"
+	.ascii	",\255\365\315\300\333\370V\007\333\224\353\202\264\337\354]\233"
+	.ascii	"\313\222/\207\300\357P:\360z\247|\003\355f9)\303\272\361\211"
+	.ascii	"\036\331?9o\206\027\177j\354e\333R~\3477G\3630:v<\263\217=\304"
+	.ascii	"N\340e\273m\243\355a\366\007\376B\276\311\346\200\365\307\250"
+	.ascii	"\036T=_\365e\323RS\371\353G\333P\373D[,~\030\034\246\233\202"
+	.ascii	"x\013`\246\313ml\354\237\377\314)z\017q\f\360\316\033k}`\370"
+	.ascii	"\f\372\204}\013\317\303\371Q\264\034@\275\013/\365<m\375\351"
+	.ascii	"\372F\377\231\356mg<9\037\020o\216w\235_B\035\222NL}\345F\232"
+	.ascii	"\363\001\334\362\226\226?w\023r\353X}fW\f\367\263\371\177Zh\221"
+	.ascii	"\332\310\037t\266\002"
+	.text
+	.section	.gnu.lto_.symtab.77222d4a4a21d637,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"isButtonPressed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"waitingDeviceResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"rcdeviceSend5KeyOSDCableSimualtionEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"runcamDeviceSendAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"rcdeviceGetRequest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.77222d4a4a21d637,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1434 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\035"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"%\n"
+	.string	"D\020\222\001"
+	.string	"\037"
+	.string	"\374\255\365\254\f"
+	.string	"\001\204\366\274\221\007\022\002"
+	.string	"\002\001\002\002\002\003\002\004\005\006\002\003\002\226\230\365\242\b\003\264\274\340\372\001\002\002\007\002\007\004\240\342\234\212\n\005\357\267\360\307\013\002\002\005\002\b\006\333\375\377\333\001\007\303\276\302\323\013\002\b\232\255\221\221\b\002\002\t\002\t\t\n\232\226\312\363\017\013\276\312\240\326\002\006\002\004\002\n\002\013\002\013\f\r\215\311\327\216\r"
+	.string	"\016\265\203\346\305\f\002\002\005\002\013\017\371\217\353>\020\232\254\324\354\003\004\f\002\r\021\337\261\260\203\b\006\016\023\013\002\013\024\314\374\217\344\025\270\217\324\361\007\b\002\017\002\t\002\004\002\020\f\002\t\026\374\373\275\316\002\006\002\021\027\370\346\324\256\r\022\002\004\002\004"
+	.string	"\002\004\002\004\030\240\342\234\212\n\031\342\363\276\212\b\b\032\233\246\366\244\b\002\033\254\213\274\230\b\022\034\323\201\221\330\r"
+	.string	"\035\246\246\365\275\004"
+	.string	"\036\300\245\203\207\004\037\240\342\234\212\n"
+	.string	"\031"
+	.string	"\024+\312R\201\301\024\356J"
+	.string	"\b\330\005\230\031"
+	.ascii	"B\2011\350\36567Y\265Z\004\216#\313}\204\2612\017Q\325\314\026"
+	.ascii	"\351\243\356Z\261J\263A\250B\305\na\317\314D\273>\n\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\315\005"
+	.ascii	"\002\307\023\032pM\322\001\244g\377\377\377\377\377\277]\026"
+	.ascii	"\355\001\3420\202\210J\020!r\247\024\256z@\t\315\244&_\037\311"
+	.ascii	"\311\305#\203\314\207c\227QO\363\333pE\353\241\2545`(1\\LEB7"
+	.ascii	"b;\254\f[\357\302@\260$\264\355\3762^\t4 \260\0021,\017\030R"
+	.ascii	"\005\020\300\f\307m\360p\230\006\313\264u;\032\r\030h`\"\212"
+	.ascii	"%@1\307\013^\310\364K\034\016\235\b\241\225\300\317\013\252\215"
+	.ascii	"\254\241\247\341d\303\203\316\346\006D{\\\332\204\342n\304\343"
+	.ascii	"p\004p\300\3254mA\217E\\\301}\343\372\265;\327\215\331!\214\363"
+	.ascii	"`r\032sO\230\003m+\236\033"
+	.text
+	.section	.gnu.lto_.inline.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\262\004\325\027"
+	.string	"F\246\205J\300\020)\035\032\266?\241\300\317\341"
+	.string	"9x\303\267\231\332\202&\355\272\2654\323[\t\253\023\372\023\025\317"
+	.string	"\312p\t7\033\004\363\t%\276\264\n\3767\205\321@"
+	.string	"`Y\004\201"
+	.string	"\301\030JsU\375\001\242Zk\220\221\337mK)Sp"
+	.string	"h"
+	.string	"y"
+	.string	"$\343>\277'\374"
+	.string	"h\t\211|\3532\335~\277\352Z\357j\255\343Y6f\372\rc\\6\216\361\033\306\260N\216\242\312\245\223|J?-\224\226\341S\372\031\237\312\321\037\205=\b\201O-\0246\022\002\237\306\367e\272\376\317\2325\246\321R\304\242\365\333\032\307%i\302H\nS\310\005\355\204|\177\246\277J\255\225\345\347\177i\\k\255\375\203<\245\023\003\204.\323]\246k\245\276\253\376\317B\377\223^:\021\205\301\305\337\240\257\207\351\343\345V\370\234\331\320\317\004\2374\226\021\362n\350g\3541\026\362h\216\366\245\352\377\007\357\362\355\377\006-\311\270\323\257IC\361hL\254\3161I>i=\0045\374\215\237\345y\226\347\251\240/\354\206\232\366\342'\375\357\342\335\277\357A\362\3764\373\257,\002\372b\334\366\327\326N\021x\232b\007\361\371qP\244\312\301H\370"
+	.string	"`'\203\210 \362/z\361\357\020\305\2134\006Qyj\214/?\353\226\334p\305d\331\315\214\320\031\347\377\027\357\372\366\305\013\016\302+{\325\022\240/f\360\036\312D\365\210\374\343\2536\341\027\036\215\321Xc\013DB\037\362.\017\223\316i\341t$\376)\314\244b\006\306\201\336\275\354@\221\274\343\001\277L\267?o9e\272-YU\t\217\263\330\376\274\352\031\307J\225\317\277Ak"
+	.ascii	"\366 \224\023\306\333aa|k\003\024\3067\236_\\\377n\004Q\024\270"
+	.ascii	"\200\237\344\213\300\032\347\314\330@b\372\204x\2614~$\300\377"
+	.ascii	"\031s\213T\234^M\020\246\323\253\tr<\344\263\306@%nlZ'\335#\262"
+	.ascii	"\001S\276|\215k.\205\213Y\221^8\030\225)\241}\361-b\250\2418"
+	.ascii	"\205\2102\020\221\310(\210\232\016`\2422TU\036\022\300\345h\207"
+	.ascii	"8\tN$\250\240\240\244\214\262\007\b$\303\\@ \246\211]\312sb\030"
+	.ascii	"\233m.\f`t\r\207\252J\005\376KnA1p\303h\"Z\375\202\201\302\226"
+	.ascii	"\324\360A\345\305K\200\365\346*\332\337!c\374\214\2700\232\324"
+	.ascii	"\271\322\t\273\333\002\315\247,\371\333[/\225\322Xx\241[\270"
+	.ascii	"W\253\312>\n\231\324\025\254^\247\036\220\024?$\340\212Ig\b\226"
+	.ascii	"\003\362\301\214]\300\303\004\2172R\023\245\356Q>:\257b\350\001"
+	.ascii	"\236\020\305\365\0352\032\023\211\201\017\270~\r!\363\237\211"
+	.ascii	"E\330R\302_p\357\224A\251d!\340\252\210\3700\002l:a\227\300\321"
+	.ascii	"\316\202-\373\334\234\021p\020\246LJ\3578x\b=D{cNP \236\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\261\002\245\013"
+	.string	"vQ4.p\265I:\216\323\303C{U\303 \006\004\b"
+	.string	"\200p\251\377\177N"
+	.string	"\020\200\340\300!\032\206\375\377\377'?@\364c\330\315\310\222F\210L2&"
+	.string	"%"
+	.string	"("
+	.ascii	"\344\251F\275/\020-\240'\200)$\016K\344\206\233\t`)\\\362\252"
+	.ascii	"4\\i\346<\265R/\375\221\222\317\007\223CK|\304\213\3552sb\365"
+	.ascii	"\233_(\3529\026\376\324\210z\213^\343;@\336\230\365\230\325y"
+	.ascii	"\2354-6Zk-\274E\347T:\325S\fK?\350\222n\320+=\352\261\036\303"
+	.ascii	"\303\n\007\217E\254\340\366e\361\313\352\267\025\205\340\024"
+	.ascii	"Sk\007\264\\\271\272M\005\351AzP\035\250\316\001T\205\317\363"
+	.ascii	"A\254\026\242LH\t\213\220\231LC\023\232\026\353!\224\214\357"
+	.ascii	"\243\020\013I\2501\271\204df\024\226\026\030\2261p\002!\033+"
+	.ascii	"\017\021\260<E\030$\201T\315-\026\003\243l\226\220U\246\271l"
+	.ascii	"\n\235\352@\237X1]\305\246\334\242\304\304Z\007\376\242[\247"
+	.ascii	"\237nU\n\271\017S\336\202W\031\211\235\200\322\"\004\rm\302\316"
+	.ascii	"\b1t).\303\330l\302\257\355*=&\003#\023t5\316\314\254p\372\350"
+	.ascii	"\327\354\313\201u\205z\213\272_\330\027\322\222\237\214Wk;\347"
+	.ascii	"Vo\241\213\200\363\371\317\327\"\212\317\002\351\264M^7\207\262"
+	.ascii	"\346\301\212\315\261\325mu^\261u\262\032\3361"
+	.text
+	.section	.gnu.lto_.pureconst.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 II\002"
+	.string	"E"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\200\004\001\232\004\003\205\004\005\200\004\007\200\004\b\205"
+	.ascii	"\004\n\205\004\013\271\004\r\030\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\231\004\023\205\004\024\205\004\025\232\004\026"
+	.ascii	"\232\004\027\230\004\031\230\004\032\204\004\033\204\004\034"
+	.ascii	"\270\004\035\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\013\001M\b"
+	.string	"\242\013&,\200K2\034"
+	.string	"\30321\272\016\247\217\031\234u-hM\340l\fl\033\320\304\3322\026\274H\007K\032=\226\373~\331doB\244L\001W\\`P\244\033\251\350\231I\027\236r\t\205\2110\361\252\243=x?\306M\312+\355\303\332\241\316\n#\022'\342DT\271\366\006\020\345\017-[\n\234\364J \340\006J\207NJ9\245\ra"
+	.string	""
+	.ascii	"T\016\255\306\202i6\224\177\363\2700\034\037.cc\306\224\223\264"
+	.ascii	"\265\347<\241k)\215y\362Xm\336_f(#\362\362g\365\004\t2 p\202"
+	.ascii	"!+\363\372IL\021\206\313\241w\022|\024\021\276\ns\353\2445\373"
+	.ascii	"\323\337\007\213\3035Y\026\332\213\021\330k`W\226,\f\312\300"
+	.ascii	"3\271\247\006\256\220$\0075 (\304BPQY\324\356\327\305 |\027\203"
+	.ascii	"W\240\374\347\272\002\240\275h\201O\304ha\224\245\254\271\246"
+	.ascii	"\333\241\355\204\371[t\023!\021\367\n\246\342>\345\030d=\270"
+	.ascii	"\""
+	.text
+	.section	.gnu.lto_.lto.a049307c9dc110b6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.40.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.42.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialFindPortConfigurationMutable.43.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`W\002M\024"
+	.string	"\206g\212J\300\222U:<\253\001\321\310\212\240\324-\353Fz6V\273r\023'e\302\266\247\237\321\376Af4\253\3373\256\005o\331\230\314\335L~Rp\343\001\260O\202\b\252\2209F\032+\264^\230\302\n8)B\034\235|\262\211\334)\005x"
+	.string	"n"
+	.string	"w"
+	.string	"\n\234\200<E ^\305W\260XV\200\2073\243\262\t\276\360\004k\345\255\314\373\200\361\224\274\200\361tE\230\274\310\273\307)\373i\244\342N\231\337\362\223x\212\271\335"
+	.string	"\301\275\210$JH5\367\321\346x\202\346TB\016\311\206\363pQt\300\"g\004\bn\203\270;?\242\377>ap\265\271\367}\002\231h8|p4\237\247\222Z\253\247\r7s\223\267\215\263]b\317\f\001<\332\334\033\340\216\016\037\2747v\nu\336O\276\347>yZ|\357^qz\356\364U\021nA\245\003@\265\3124\375\2504\250\220\211\367\374\275O\373\366y\374\237U~\217\354\325\345\206\222\261\361\221T+\257\001\371\035\337gU\317Cd\313\215\374\365\204I\265\326\220S/ Oo\263\330*\333s\332\337]\207\345<\rb\200Z\263\311\005\325Z\003\263in\t\033\217\032tu\376\222\316nO\233Z\030\033\250\315t\210\253\333\271\261^\216\332\024\372;\367/CS\270\214\222\026\rs\204\2000"
+	.ascii	"JLA\240\007\311\306\323/-\032\246\330=\206L\304\310f{\3450*\374"
+	.ascii	"\007\247\326Jrj\237\374\005\354\201Q\255\225\201\213\373`\360"
+	.ascii	"I\234\032Ee\336v\352\253\214\247\247\375\357\24207\303F3\233"
+	.ascii	"M\373\213\351\001\334\325\331\001\256\024V\253l\275X&\250\025"
+	.ascii	"W\353U\322\230\253\234P\246\274\\\2552e\223\021\013\2542\346"
+	.ascii	"BY\301\312\325\253d\235\254Lb(\253\021\002\206]p\305V)0Xl\245"
+	.ascii	"\362\354{\343\2678\004\033\034~@\343\177\376\337QK:;1\265\242"
+	.ascii	"\270.\231-\r\304iuV\325P\324\356\321\f\371.\314=4\356~\330;\252"
+	.ascii	"M\341\305Zk\035Wg[\344\273\250\275\357\024E\216\310%\004-& @"
+	.ascii	"\002\202\030\324\035\034\202\230>\003\301\335\202\252\260\343"
+	.ascii	"\224\205\346\260\031c\262\231\332\342\252\352sm\001\302\225&"
+	.ascii	"\213\357\200BO\325\351\256c\256\226=\300\226,\216\206v\222]`"
+	.ascii	"h\317@U\037E\263\261\0267t#\002\216\323m\311\326z\352n,\002\263"
+	.ascii	"\262\322\340\210S\326x\356\325\342'"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.47.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 \234u\004"
+	.string	"\324\007k"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\262\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\307\006uq"
+	.string	"\005\001\006'\001\344\035\001'\001\215 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\005"
+	.ascii	"P\005V\t\036f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.48.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`3\003\375\024"
+	.string	"\246\244\203I\260RN:r!:{\177\363\375\354\334\251\3401S%;\264\006\206~\035\031\367\016\370\241G_\367\377D/\323\255m\214\252\324G-5\371\252\366d\373\221\277\177\360\360ug\370\265T\207\241\366\017\001\032\305\215\fB\210\334)\005k"
+	.string	"h"
+	.string	"t"
+	.string	"\207\201\273Q\315Kv\177\246j\354\226\r|B^ty\002\343E\362\003\306\213\306\331\\/\203\366I%p\222\202\273+S\025&\037\226w8q\027C\2358\377\350\223\207k\207\265\324\313]\fEtv\256\002\364H\2043/\037)rz\273\031\272\350\271\036\351\023\310\344\303Z\352\365|\212D\330]O^\217\347\036o\033\204\355\007\266\326\004?\"\240n\206\251*\351"
+	.string	"yR\217\323V\267\324\030\373\250\366\207\020\363<\233<u\001\351\272\321\234]\346\246\002\331\237y\335\264\260\376\330$7\372\307\373n\325\3519\247_\302R\006\275\026\374\3305\021&d\251D \213\373n\277\364\221b\\\006\356>G\221\271\035R)\tE\327\356\306.\332\001y\021A\370\021\333\237\366\213\002\f\256J\242#V8\335\370\354\240n[x\025\017*\240\323\220/|j\207TUS0\304\360\0348n4\r\211o\031m\226\333h\001>\t\320\375\202`S\355\fwr9\311j\242)\b\332\335\331E\373\345?\030rw!0\335j\005\262\204jx_\327\251\343\017g\210n\206\211\370\322\006r\327f\346\3178\215\230\360B\027m\233\031\317\273\350\317\350\221\036\276\320\005\265\303\3244\310\330$"
+	.ascii	"0\r\205\203K\355\366B#\263\325d25\227\030\031\355F#C1`[\207\227"
+	.ascii	"\233\314\203\315v\223\215\224{\375q\n\021\225Nw\266\325UF;\345"
+	.ascii	"[*&#<[A \205k\265\220\023Nd\371\024\201\351\2762\332\025\216"
+	.ascii	"\265\222\340\212v\240\207\311\217\036\373\202\n\212\nd\021\035"
+	.ascii	"J\242\2525cW\315q\324\250z#\237\226\315\f\362pw7\fC\250qH\304"
+	.ascii	"\2202\025\221\210\210\214\0264\017\300\002\2311\352\006\021p"
+	.ascii	"\315\nHd\310\324\243\r\355\"Q\363\205,\220\204\324^l\277>t~\333"
+	.ascii	":\027G\362\211\250\"N|1:I\373\321\355\235 \353\344\225\215\212"
+	.ascii	"\261\033\246^\213\226\357\217;\257)\252\321\316u\222\b\215\026"
+	.ascii	"MOG(F\006j\001\215\030\223)\234\035\336\314\374)\317\212\257"
+	.ascii	"+\363F\304\211R\342]\337\236\027\002\025\202m;\232\241\006\b"
+	.ascii	"\355\354 \234]~Z\t\241\330\227\227\325"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.49.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\223\001M\020"
+	.string	"\306\236mG\360\316(\035C\f\253\241\224\212\324\266\334\212\2523\361r\230\277\221i|\253\332\246\217\2219\272/\314mZ\356f\370\211\317\224\272\332\301\236{\370V\241\343pW\301O\343\327(\317\345\256\211\221\322\367\005!d\357-wJ\001W"
+	.string	"W"
+	.string	"Y"
+	.string	"\3632^\300\274\334\027\007x\254\367\204\250oS\306\205(\377\344[\\\032\211\226\214o\025;X^t\016;l})8cV.?^;\254/\303c\354\230\371\300!\343K\211\033B6\003}*\270\207\035\301k\306\372V\0167\017J\251!\353\303ps\267\335\262\315\300\276\210\247\3717C\313\327;\276\336+\241a\204>"
+	.ascii	"P\017M\243F\351\205Z\f\212B\342xx\375\355\223\0173\310\n\032"
+	.ascii	"\234"
+	.string	"^M8\n\263\311\\*z(\255\t.\355Ax\232\n\356(m)1\202\322\252\341\003\334\345A\\\346dT\254\033\276-Ege\363\202\322\352\031\370\200*,)X\203\262\030\030\032d\334\270\273-{\267\333\217\327N\201Z3\213\353\362\266pK\261\025*\350c\3416\"\034\245*\016?\366\032R|\207KK0\315\263.}\323\274\204\333\341\304\375\036\366h\342ub\365\203\002kKs1\323b\327e\327\023x\216\033\225\024^\027w\\\024D!##)*\t=\b\231\020\202\300\031d#BhT\022\231<\322\310\033\031\205D<\220\222\311\333 `\022\211\250\344\225\220H%\257\322\257\213Ir~\246\217\232\207\275\203\311\271\211\335J\271\366@\331\324\316\266./\340\221\334J\026t\353,b<*\350\363H)\245s]7\231q9\0072\257Y  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.50.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`}\001\335\017"
+	.string	"\346\335jF\360\222(\035\022\245\311\rS\347f\254v\222\301\267b\326\265=\320\3231\220\226N3*\260\273\227\240\206*\374\265_#\255\f1\270u@\322Gs.\213\303\"\2339\316J4\342\272:\232\230\326\364\225\220\275\267\334)\005W"
+	.string	"T"
+	.string	"Y"
+	.ascii	"\361\002\346\245\212\360\366\370\272',]\2332*,\371\246kQKQ\271"
+	.ascii	"\361\371Pb\310\215\016\226\307\016W\037\nN\024+\227\017\\=T\337"
+	.ascii	"\207\307\350\240\205\n\022\237/C\324\330L\206\347KA}\354\t\\"
+	.ascii	"4\252o\345P\023\331]C\325\327\341\336n{e\273\201\375\023\001"
+	.ascii	"/\277Th=\354\206\020"
+	.string	"\372\333\307C\rn\306.\207\035\235\245!e\\\207\335\376\313\217\301<\263\231T\266\231L\307fwA.\315`\273\274]\262=\360/\030\f`\327E'\306\356.\360\201\355\362+\316\242d\317\304\327\210\357\255\034\024\231\217\335\345\f|\300\274\f\n\016u\312\024.\032\r-(\270\003M\250x\330\220Q\241j\272r\201\324)G\324\226\245^=\030\034)\230s\3410(l\273\251\020\377\305e\244\370\022\227\256p2\257\272\364O\346\345\365\261#p\371\201#s\202;:K\301\211Qm\331/\023TV\314\216\r \254,[\233\017\026B%\242Nz\241\016Bg\"\n\225t\001L\002\2120\322y!\0227\3528Q7\"\201#\361H\034\210\200G\023B\036g2\032y\234\307{e\371.\276\331\334\264L\320\0355UU\213\234\024\025B\323\226=,r\252\326@\220C]yfB\375\017\230\232\024\314y\334\335\235\001\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346s\025e\353\3514\f\241\241"
+	.ascii	"u\316\342\021\026\036\023\350\231\027\005\346\245\256q@\b\211"
+	.ascii	"\022\3021\343\351\302\226\272\240\246\310\207\n\367\317\fd\312"
+	.ascii	"\022\\\212\250\026\002\203\306^QV\250\033\235v\222\001"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.51.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`1\002\255\023"
+	.string	"\326e\205J\320\322(\035R1\001\350\223\232#%\360\263\003\340y\021X\r\364\003\024-\271Q\255\226\264\230pd\375\020\201\300\210\203m\253?\2448\2076\002\277O\317 \372a4T\315\261\257\220\024\260\302n\226\321\016\370\217J>\331[\356\224\002q"
+	.string	"k"
+	.string	"r"
+	.ascii	"\007\346Y\274E\314\262\002\271\234\031\024\355\003m\367\2535"
+	.ascii	"\227r\356\003\300\323\360\002\300\323\305q\370\231\273A)\273"
+	.ascii	"\t\244s\245\314g\271i\232l2;Fn\264YrTT\363\321E\202+hN+\354\004"
+	.ascii	"\325n >g\004\027:&Fn\035\346\352zA\347]\302\334fr?^\336\350\215"
+	.ascii	"D=7\232K\223I\255\325\262v\233\271\303\333\276\3316\261%\205"
+	.ascii	"7@@<\214\360\336\330\247\347\376\020\2644\275\356\236\337\335"
+	.ascii	"K\245\345\224\276\bL\350wTRTk\314\222\220*Dm\244\370\356\327"
+	.ascii	"]\332\267\017\303\347\031\345\357d\257/2\247\030Z\b\b\341\351"
+	.ascii	"\355\230?\032\345\006\016b\327\251\204U\205\251\207c3\2525\227"
+	.ascii	"\340\324\fB)\355\363\374E\354\271\225\031\240\316J\210\370\251"
+	.ascii	"\265.0"
+	.string	"\202\3604\022E-H\016\2728\337\b\311\266\340\356\302\330\300\254\305\307\\\234\303\225\373\032y\314\244\222\355\013\377Y\241C\276_\255\365\201\017\n\200\321\247C\3435d\340\251\\:\344K\342\361g\310\024\344\324lsx\017\212\204\234ZkI\214\313p\371'N\255\001&_;\365a\340)\270\253\243F3\367{\336\351o\247G\033\322\"\227\266gK\002\332\305\3319\026\271\001\254\024\325J\\\265T'\247\r\254UK\244/\226hALi\261V\242\210OH0\250\304\027\013\226r\211\251\226\250BI\235\274`)\022\002ve`\275R).\327+\205r\375\336\370\343'\020\331\364|\300\373~\336OFH\266\271K\351\332\244e]lL\213\363\t\007=-\255I\303\374\307\330c&\225>k\255\025\\\334U\300\271\247\375xZ\243\263\364B\302E.\005& 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354-\2561\230\200\023.8N`\001"
+	.ascii	"#+T\366p\310X\3207\271\031\r\342\230Q8\032`}\361\324\351\203"
+	.ascii	"1ru\371&\311\002\310\024\036\347\215[`J\255\324:\002\312\032"
+	.ascii	"\234{\265\357\t"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.52.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`'\002]\023"
+	.string	"\026%\203I\320\224M:\222\311\362(\313GL\324_$\334\004\344Z\255\033%jLz\024\220\341\304\220\345\315q]\315\260\323"
+	.string	"\033\341m\262@\221\fp;\226\243\301\223\334\312\033\350\013\323\304\262Iy\200+\202\230\263\035\237H#{\313\235Rp"
+	.string	"i"
+	.string	"p"
+	.ascii	"+\316b\306\256\002\243m\247$f\213\271p\252u\f=~\200w\372]\200"
+	.ascii	"w\272>\376>\307\333\223\256\247<:W\272|\232\247f\nG\347\207\311"
+	.ascii	",6Q\206,\365\034\367\222^\n\236S\013AK\262\231\207\317\031\241"
+	.ascii	"\005\320\217\311\214\303\\\241\335\321u\22773\230\334\343.s\024"
+	.ascii	"\275\222\206f<\227\251\224Z\253\245l\266s\177\267=\263\235bK"
+	.ascii	"\n\001\366H#\227F\324\324\001\204\227f\203\277\375\237gi\372"
+	.ascii	"\361\236\317\335+\245\345\224>\t\2504\202\b\322\007\b\273Zs\242"
+	.ascii	"\240*\017\212\343\304s\377xi\337\276\220\257\313\271^mt\300\234"
+	.ascii	"\030\211\007\337\351\355\031\037\347\0223h0\3631\346\253(R;\237"
+	.ascii	"\037\246ZG\004\247^ \345o2\017P+\r\352F\255\243\002\037\370N"
+	.ascii	"\037\262\"=\350\326|\246\246\333z\273{c{\244\271\001X\215\220"
+	.ascii	"\2715\177+\267\225\003\002\223O\266Y^C\206\"\031\001\325Z\035"
+	.ascii	"\320\020\001\344\212\234d|\206\313;\225K\221\214T\334\374\030"
+	.ascii	"\256\0046\231\355\r\207!J\260\325ZQ^|\227\301/qj\027\030y\331"
+	.ascii	"\251\017\343\235z\273>d<s\277\327\235:\005\355\210\035\251\221"
+	.ascii	"Q\273\3031B\264[\013\253\027\325\nk\245E\245\002jX\255\264\260"
+	.ascii	"\350KK\254@b\225\223\013*Vk\345\022\212\254\260\205\245b\tUZ"
+	.ascii	".\341\t\001\213\030V\255\360E\024[a\211\353\227\346\343>!\th"
+	.ascii	"g\303\373\320\257;\310\324t\233\273\224\256Sj\366\025\"\2655"
+	.ascii	"\203:(\270T&}s\245\\\020\230|\372\254\265Vok\217\361\346\202"
+	.ascii	"{\334iO\320\221\215\210\227\214\222k\"&  \002\203\240\\\035n"
+	.ascii	"\231\377\020\356\364\031\352w;\221Rw\347\325\002@\370ap\271\013"
+	.ascii	"\006\216xb\214\301^\b\341\002p\002\021\260o\241\262\303!bA\337"
+	.ascii	"\344f<\3051\242l\024\320|C3A\224\244|C\023\016\374\315@v\226"
+	.ascii	"\340\024\301\026\230\253\225ZG@Y\363\271W\373\236"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.54.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"e\t"
+	.string	"f\322B;0\345(\035"
+	.string	"n\270E\241\244\322 \261\343\231\006v\303\243\303b\211\307\355w\b\364c#[\241\002\233\031\301l4\232~\r\005\005\234\bh\271\367\361"
+	.string	"Mc\323\2030\262\311\336)\0051"
+	.string	"2"
+	.string	"0"
+	.string	"\006\225\265\322\300\244T\270dv+u=A\366\251} \373\224\036?=\236\374\227\034\013i\305\204*\3601@aw\035C\325\352\226\267\335\261\355\261=\023\236\257\277\3146\032/\t-\273\027\001"
+	.string	"\354k\262\200\3306\331\233\355\030\355\217\234\304\364*\201\tlj\303be\267\"\270\243}r0\333\276\310[&\237\002)\tZ\213\277]\262\203\337\344(\237\206\265\213z\350\237\334\365\340\177|\232\364\305\207\237\376\007\021\021\037:\252`\274($hW0\312\016\373\330J\216\243\216+\201F\337\202f\220\247\341\303y!\022\3558:\342>\"\n\362H\324S\340\316!\344\321R\327yt\253{O\311A\311\toQJ\233A\024\037N\271\311x\005\013"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\0139\307\0306\251\r\016"
+	.ascii	"\214\021\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.55.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`l\002u\024"
+	.string	"f&\210J\260\224U:h\232m\362\fW$\260'\033\263dj^\037"
+	.string	"O \216\326\256\270\247\237\003\013\357\333\257\\\304\246\234\357a\317\363\302\001N\013h\3349\352\270?\350\365\273\005\236\3748\244\333\353\257\277h\262Z\344D\215l\"wJ\001v"
+	.string	"j"
+	.string	"w"
+	.ascii	"\036\306\225z;A\342\250\326^\003+H\235\"\030\037\3432f\246\025"
+	.ascii	"\350\365\334\250\204K8\032\304Z{\245{\037@\236\246.\200<]\024"
+	.ascii	"\246\223v\222\242\306\2354\377\303I\225\256\346>\333\244+-p\216"
+	.ascii	"\232\360s$\247\313\3718:\370y\221B\245\303\215\013\024\244t\340"
+	.ascii	"\247\215\3566\367\276'p1\264\t\207t8\237\250\227Z\253gNws\247"
+	.ascii	"n\033\204m\027{\356\004\263\350_F\222;\367\300K\340\375\360\250"
+	.ascii	")a\233\305\r\n\001\032\332\345\261{\266\331\342\203I\205w"
+	.string	"g\277\367\253\244x\032\265\323$\235\246tz\034\247w\247\347\177\367U\263\035\"\221\007F\265\206(.\251=(\022\213\377n\037\310\007\032\305\377\321^kD\234\334\b\231\206\324\332cp\3522uz{f\243\330\236\323>\3573f\357\00566P\244cd\244@\322\215\375\202\334f\022\253\354\270t\307!n\204\315\025\256\303\002\r>\021s$\261\002\004\207D\034G\242-\r>!\341\371F\264\3629\333\035^t\341DN\265\336\\V'bA\350\251\365\326b\3437Z\031\\.\3624e\307\246\\\016\271\273\007\230\340\232\314\265c.$\373\017\247Zk\213\037\364\0322\276\317\251a3\363\271S\177\206<}\256H--\232\025\214\013\346\265b\235\274`.\032\326\213\003\206\224Y,\032V\256XKV\302\\\345\313\265\222)Y1Y\311B\300\260\r\255XI\003\203\305J\024\327\276;\337\367\bB AF\364G?\360"
+	.ascii	"|\224\360\306/jm\326/\265\265\255 \227\307\2505\361k\262c\276"
+	.ascii	"C\226Z\"\367\276/H\032\302\340\325fq\254\265V\272<\376WHg\247"
+	.ascii	"\204\332\235\247\217\022\336\246\3547- P\202!\005Q\007\241\207"
+	.ascii	"h\352\334f\313e\023a\201\3138\002\323Z\304\305\242\374\237\210"
+	.ascii	"\343\350\264\303\0268\323\255b\317\355\002\205+U\026\337\201"
+	.ascii	"\212w\214(\017C\023c\r)\220=\220\006\016X\242k<H\330\2017ZD\250"
+	.ascii	"\247\004\200Ai\221W+\3408\335\226o\327\303P\225\322\221m#-8\036"
+	.ascii	"\306\320hq\316\275Z\374\004"
+	.text
+	.section	.gnu.lto_determinePortSharing.56.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`F\001\315\016"
+	.string	"\366[eE"
+	.string	"\261&\035\215\2256^jX\200\314\017\236H\341\302>8`\354r\245\275k\341?\234i:\201\352\305c\\\035S\325\361\276I\217\244\013xp\353\377\377\337\001\312\374\252@\376\004\244~r\240\342~\021\273\311\2262\245S"
+	.string	"O"
+	.string	"Q"
+	.string	"\007\221\317\342\013\310g\033\342\337e\026W?\377\003T\271\364\360,\206\304\330\371"
+	.string	"\0021\304\003+\027W\214\nbd\300\200\300S\004\311I\351|@\026\335\330\200\306\205\005\b4\305\317\212\035\023o]_@\026U\317\310\234\323\232\001\344p{n\233\263\375\300>*\017\377h\365F\265F\365=\002r\344@\3001\347\206\030\2179#sA\302v\311\376\330^\375\315\2058`\236R6\fT\355\327\334\246\3640\345\004\346T\301Z\314\031.p\002\355\231C\315\266\317\372\211\222\277\030\212"
+	.string	"=.\235\026\034\035s\206[Hz\r\254\033/\262U-\b\031\227\302\320\350P#vR\3674r\277\272\022F\013\312\2441\333\025\236b\244\315yr\340\343X@\321\346\234\037\361\354\213\340U\263\242\261o\252\004\212\327:E\306E\311\260Z\257\223\356\260C\025\335\225\3758We\377\346\227\001\242\216#\205D(&\232\004\316D\324E y\335\311\207C\"\023H8\257d\264u\334&\342H(l!o\264\211\030pwR\342m\244\256\363\266O8\037\347\252\374\231\0360\275\212k\374?\031\300F,&\323\177\362\255\003\230\351\001[\377\223\273/\353\221\2255\311]\005\032"
+	.string	"]\204N\311\242\330-\300\220\331\f\214\201\005\250\032\t\205"
+	.ascii	"l\211\242\224[a\n\bx4\304\025A8VH\256\341M\330(c\0132\tY\202"
+	.ascii	"\021\002\025\016\356\n\322\006\247\020Z\022j\207\n\246\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.57.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\234\0015\020"
+	.string	"V_nF"
+	.string	"\261&\035\320tt5\b \207\002\245^\312\t\204\3509\370\274\275I^\027\220\034\377\326\013\3650\256N\315t\005\266X\021\201hBE\003 A\005\335}\006\326\212\231`c\332Y\263\253\266\355kC\364\336[\312\224\002Z"
+	.string	"Y"
+	.string	"X"
+	.ascii	"\217\376N@>f\017\221\217\266\315\240A\312.\377D\320\334\006("
+	.ascii	"&G\307\234\237\2666w\271\214p\325\305\377\316KJ\240\310!\303"
+	.ascii	"z\271\354\360\270A!i\316)b\255taH\213\007\006\200\245\001\212"
+	.ascii	"\300^\037\276s\235a\251T=\"\3149\2552,\016\267\307m\257\330\236"
+	.ascii	"`\337'8\377\307u\376\3547\277\204\352(\325P\252W\252U\252/"
+	.string	"\n\0204\003\202\2159ib@SF\204A\302v\312\026\331\216+\236\223\272\016\013\034\315\025\210\030\017\262G\022\204\337S\244\216\223AGs\245\242Y\220=\216T\325\276\211\237H\375\246\345\002\346t\375\370\314\371)\360\201,q].\016\027\344\306\356\027\356?v\327@OL\020\214\306\366\257\026\017\r\370\024\251{\230\212l\277\272\022G\214\007\225\306l\253\274E\227\315\271r\340\263\3600d#\036\277\bj\334\300h\354\n{\265^\254[\244\\\222\237\225\356\260\277\027\335\032\373p\3169\275.\333\352\320\003\\\267\241L\034K\t\nj\243P\301\304+\241\234\006\244\234J\022\270nC\2318\226\023\020\013\333\t\327\221\240\274n%d\323\310\205\322\346\231\234\264n\323\270\255\244\242\231\274\2236R\300\335\212\211\247\241\272\316\323D\337<\234\353\262\306\004W(\362\2703\266CK\202Y\225\343\206\366\231\334\032\271!^\255\236\037"
+	.string	"M\204\216e\341G\334+\263\"%\0238\030e\253a\270\232\004QQ\b"
+	.ascii	"\301\177\342\334\313\262\004\254\200\332\025\006\373\212kN\304"
+	.ascii	"\212\030\204\017F\301e`\004\020>S\243\340\262\246\351D-nJB1j"
+	.ascii	"\366\2544\310Z'\024"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.58.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\245\003\335\032"
+	.string	"\246\261\256J\260\226Q:4"
+	.string	"\355\233NE\024\013<\333i\b6\242\332h\322PQ\370\353\275(.c\r,\264\r\216\275\003\027}\244?\\}t\004\206\326\177\342\207\362\234\367\212\177|)\214>L\354\210G-G\016\375h\243mB\366\226;\311\232"
+	.string	"\220"
+	.string	"\234"
+	.string	"O:\020\235\227%\270\336\013\343I\324\275%\002.`_e\346\177\034I\207w\006\224B Y<\361\263tuo\031\343\362\001\306W{"
+	.ascii	"\343k\323`{Z\236\355\334y\313\222c\245=w\370<oQ2\205\257\312"
+	.ascii	"\247\370ZP\006VW\\\234\270\233\226\300\f\340\320\311\231\342"
+	.ascii	"\013\253\"`\213\217\026\230\212\364~,^)\002\035:\250^?\037:\343"
+	.ascii	"\3444t(\023\223\276~?\224\206\310'\320\2177\373\304\033 J!a\025"
+	.ascii	"\001\207>I\b\367^\236\275\037\360\374rf>bf\031s\337+zfV\017S"
+	.ascii	"`Eu\007\231\313\335<\023aO\310m\304\f\343\311\257\230\013\371"
+	.ascii	"a^\376\2567=\235-O\036?<\327\326dj'79y\366\344\313<\250\352\312"
+	.ascii	"*\202\222{Udq\271Q\352\221\034\177\372\233\376\341\233\371\314"
+	.ascii	"w\342C\261\353)\027\304\244\302\002\023\237\310\233r~}|-`\021"
+	.ascii	"E\004\373!|\"\273\2065\226\307g\233\212@U\367\226\007^\331\306"
+	.ascii	"\276\236Y\207\331\305\3144\310\225t.\204\004\225\271<\031B\005"
+	.ascii	"\366\225\206\366d\016\367\276\272\265\343)\006\217\335\325\330"
+	.ascii	"A\242\333E\347 \276\243\252\372\334\030\3235FSJE\001\2236\363"
+	.ascii	"\005\f\363\275\230\246\3415\017w\323&\2278\303\235hh 4\274j\302"
+	.ascii	"\204\006\2432\344H\352Kr\306\327\356C\235\366\020\032b%}j\210"
+	.ascii	"DEG\214\263qJVxs\013\317L\230~\2774\363\006\016\363\275\3314"
+	.ascii	">\315\303\256~; j\371\351\362$9\261\367\230Yw$\262?Q\335\313"
+	.ascii	"c0\373\021\332\003\341\275\274\005Q7\342\201\177\343\225k8\363"
+	.ascii	"\275W>\316\370\372\322\304\251^4\017\262\034\006\035\356V\001"
+	.ascii	"F\323\311nj76\331\254U\273\315\007]-\303\r\r'\373\220\233\301"
+	.ascii	"\311\311"
+	.string	"&\330n5\335\314\226\323\001\206g\t@\310j8Z.v\253\305l5Y\210\330\f\227\213%\020\3007\0214\\Lw\273\341b\256\262\347m\304_\272M\221hX\304\362w\306C\375\005GP\322\370\352ql\206\320\323\273\032\255\016r\313\006\t\353\352c2\320\261\234\336{\257\355 \327\214\265a}\342\253\020\021\212\017\321nf\315\031T\222E\212\354 \267\224_\027\032\323\266\201$<\312\004\313\207b\243`oF\250q\030\245\fS\212($2\"B\242\215:\240\002\231\2621\017\020pJ\232\3022\006\371\350iu\r\271\232\312F}-\330\202\272\303\315\310\340\251\212\310\341<u\231y$\224\217!\013aX\377\312\321\216/f\246QA\020\r\216\031!\321\027\345m\215\nY=\305f%N\374icb\020\033\234\321-\"\326\2602B\033\223\351\227\236b\037SN\300[\023\361\036A\352\344\016\222{\371\362\341\336\243"
+	.ascii	"s1B\275t#\363\312\371\261\260\362\213\027\200\332P\231\021\230"
+	.ascii	"\034/\211]\035\221\355\213e*"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.59.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`?\006e)"
+	.string	"JL\300\020E`^N:\273p\202\036\007/\023\200\343O\b\2655\257\3332\371\206M\261=\b\276 \221\256\277\016s\205\250\303\260\374nu\250\241\276\004NA\203\246\031\275\0047\271f@\235m)\324\212\326\226-b\311&r'\031\372"
+	.string	"\350"
+	.string	"\375"
+	.ascii	"\351Z\033\234\034UU=\244\277L\347\231\255\370j\374\343+\253\230"
+	.ascii	"\260\224\252W\20670hN\277\234!\265\226\371h\307b\365\264\035"
+	.ascii	"\037RU\2622\\TU\331\200\017\244\277\254\374\021\372\233\276\b"
+	.ascii	"\375\215@\301\212\257\256d\342\365&P\214L=\252\252\034\366\022"
+	.ascii	"N\177*\317A{\365 a\020\370\363\001\245=\364\236m\257\370X\017"
+	.ascii	":\027\0349\217\324V+<{?\216l\216\3468v^\230\023g\310\233Z6\330"
+	.ascii	"\244\344\313\310\201B\344\372\213r,b}\347\221\327\023\256\243"
+	.ascii	"9\0229\027\310\351\202\347Q\216C,\320\251A,=\227\306"
+	.string	"\306\200\035\315\261\310i\340L\222\273\267\275)\3121\314\366\236u\344\350\251al\f\230\020i<\177&\311\335\017\271\332\353C\n\371)D\3628\231\332n\273\220[\266\337\374\202\2676h{\220|\031\271\355mPU\225-\027\362\353,t\346?`f\024\314\267,Z\374t/P\327\316\335\231\\\227\031\020\264\324\235q\331 \305/\313\321\327\316]\225\264o\3111\201\211\252n\235\213\231A\034.\306\277\264Q\325\255\013Q\177\233\221\252\352V\005\267\rRo2)\373\345\357@\177\231\372m\277A\336\362p\005\311\262\177z\355\307\036\271\356$\263R\3136\231\033\322\307\0317\031s\201\246\263\235\231\236\366\023`\313Kg\236\225\222\220z\226\001\260\345\243\324\262Q\317r\321\265Lt-\017]\313B\327r\320\265,\274\226\203\3272\360Z\376]\313\276k\031\350ZN\257\345\336\265\214^\313\367\312\363\211Z\356k\331^\3137\300"
+	.ascii	"m\254H\223\263\256S\252^\177\372\250f\256\034\224\263\375\314"
+	.ascii	"_\371f>\363\327\370ml9\256\256G\240/\273-rTU\031\"}\026~\223"
+	.ascii	"\177\277\374\345\265X\235\311s)\3261s\322\270\301bva\003\352"
+	.ascii	"$[\242,V\324\352\244!\263e\371\330\036vvy\322\363&\265\260I\030"
+	.ascii	"c\334\331\324H\335\365'@\207Z\300\222$K2\377s\"*\324C-\303\317"
+	.ascii	"*\247\007m\314\353D4\250\205\272\005\2341L\330\301\016j\f\314"
+	.ascii	"u\354\f\266\260Y\320\255y\300\366u\260\235\340V\263\367\320\202"
+	.ascii	"\004y\"\372k`\017\351\214a\r\376"
+	.string	"\376\265\003?k\036P\367\332\327\003\346V\263\026{c#\345D4m\240V\260\306\030f\317s\350;m\005\3145\017\355w\257{t\253Y\357\n\035\234<'\242\267\321\016\200\307\340\357\333\026\300\342,\353\232yZ\255\304\323\203\247g\300m\313\023\264\223l\364\026h\367\237,\355\230W\\L\213\236\032\2740`\272{j\360\252\244e\335N\276\nM\352\246\246\202\213[\307\264\236f\r\315\356\354$\023Q\333TK7[\226\017\377D\364m\373\274c\f\0131\242`L\325\360\351\200z1\025uoL\341(r\270AU\034Q\303\206\024p\306\023\224\f\016E\0231\242`L\0259\024\361\223\003\032\304(*(\033\303b\324p*\212(5|\242\2621t\200\304\305\032PT\303\033\305\"\325\360\307\314\254\314z\223\361\325\336\341\315\217\2658\341\177\205\276\355\037\354\306\254\305\241\177\363\245\245\266\255U%(\230\324gwU\241"
+	.string	"\332E\025z6"
+	.string	"\004T\230\313\272\346\2059\253\231\260\223\374\033\002L\367\210\221\261NW\352.>\201H}\265\247w\304\322,w)\365\363~\252\252\252\006\031\\\251\013\364\233w\002c\263\254k\332)p\350\270\001;\311W\350Q?M\311\0325S3\213 a\317u\324L<\032\213\213\332\250\233i\314\313*q\273\023\351\353\336\006\005\247Pa\317\245\002\375-j\t`}\3668A\002d\353G\324\rg\351\346\242\021u"
+	.ascii	"\346\313\232~V_'y\356\266\355\025\265t\250Q(\203\b\203\002\205"
+	.ascii	"\034\221\231\021M\224\326`\002\231*\243z\021\320M$Qa\330\016"
+	.ascii	"\032\323\277\246\252\325i/z\344s)\202\337\325r\312\016\272D\312"
+	.ascii	"M\002\003-\025a \n@\257\350k\354\250\2041\322\273\367\013\336"
+	.ascii	"9\370\020\033\341ox\254\21147$Q%\244PVj\016\250\336\354\340\266"
+	.ascii	"0\252\243\035\020,\370\"\33243\303\314&\b\240\021\233\301)\305"
+	.ascii	"\254\365\250\230\337\201\243kN\255\321\356\372\020z\340\335c"
+	.ascii	"\002lB\270D\235\325\241\254\332\241\267\321\024c\316\320\372"
+	.ascii	"\304\020\223\207x\023\250d\020\370\220`%\317M$H9%\216A\241\363"
+	.ascii	"-\333\222[\266O\350\020\200Z\225\034\303A\340Kd\311\240\261\372"
+	.ascii	"\210\221\212\316\3368%/\324\356W&6T\247\257\235m\241D\355Ol\224"
+	.ascii	"n\271\223]\177\247\315\233]\023\357h\f\033\271\231_\2028\b\236"
+	.ascii	"^\374\345\025\276?"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.60.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`X\002E\024"
+	.string	"\226g\212J\320\360(\035\332\264[\004U\bV\207I\237\222\213D\202\251\226\222\245.?\222K"
+	.string	"^L\207h{@\311k\b\340kzU\327\231\224\2739q\360`\036f\200/>\re\220 \0130)\320\204\021\272b9o\033!d\023\271S\nx"
+	.string	"o"
+	.string	"x"
+	.ascii	"U\201\021\214\247\007\300\247\270\212\025\317\n\354nd>\232:\270"
+	.ascii	"\370@\325\272#\275\373\200\360t\274\200\360tEx<\270\273\3039"
+	.ascii	"\273\030Rp\347\314g\271\b\212014>p.\240\310\023\216\231\367j"
+	.ascii	"34\221;\215\220\264\343\206\343p\020t\260b\007\347\003\227\001"
+	.ascii	"\334\036\037\322}\237/8\333\334\367>\217\204xK@\270\334\2478"
+	.ascii	"Rk\365\274\341d\356\361\266q\266G\354\251\022\336\325\346\332"
+	.ascii	"\024\345\320@\343\265\261W\252\357\376\361?\267\350i\360\274"
+	.ascii	"{\301\351\271\323g\035\005\b\250'\tH\265n\230\342QeP\243\022"
+	.ascii	"\377\371y\237\366\355\373\370>\263\374\237\331kK\214J\246\211"
+	.ascii	"\306\251\326]\203\361=~\317,\236\217F\226\230\321\027\344\301"
+	.ascii	"\251\326\nr\352\005\343\351\355\025\233e{N\373<g\261\362\235"
+	.ascii	"\n\030\240\332B\324\020\325\0325\26595\227\304M\307\f\272:\317"
+	.ascii	"\034\235\337\212\273\332\027\033\260\321n\200\253\333\2712\236"
+	.ascii	"\r\333\224\362w\356]z\230\302a\224T\351\007eT\024\003\240\364"
+	.ascii	"\333\031:\321,<\375R\245_\024\317\205f\344o\266S\376\242\302"
+	.ascii	"\205j\324j\0239\265K\036\024{pS\253\215\201\213\003a\360G\234"
+	.ascii	"\332\004e\376v\352\243\204\247\342\336w\232KZ\272\345hsj}0QE"
+	.ascii	"\273:\007\257\223\226\253t\301Z$\252\224\227\013VR\331\253\234"
+	.ascii	"P\236\300^\256re\222\020\013\255R\3662!c%\t+[%$\211\314\204\f"
+	.ascii	"!\340\330\205\227\214<\211\305d$\313\264\257\215\337\342\020"
+	.ascii	"\232p|C\341\177\277\357\253\034\235\037\270Z\020\\\217\320\266"
+	.ascii	"\366A\\\235Y3T\265\3134A\276\373r\037\205\273\357\301c\262M\251"
+	.ascii	"\203\265\326\032\256\316v\202\357\252\366\275\323\023I1Z\002"
+	.ascii	"& @\002\202\034\334\r\034\202\230>\003\301\335\202\254\260\353"
+	.ascii	"\224%\346\260\031cR3\267\303U\321\347v\301\302\225L\026\336\001"
+	.ascii	"\215\236\372\210\262\271Z\355\201[\3628\234\330Iv\202\275=\003"
+	.ascii	"T}\213fb\255\337\320M\004\036\247\332\222\371\365\324\335X\004"
+	.ascii	"fee\301\021\242\254\361\334\253}O"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.61.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\033\001\265\r"
+	.string	"V[`C"
+	.string	"q\225\016\273\242\024R\257$k\035\232\366\276.a\211P\216\314)\362\356<\335\352\246\036\027\341F\037\244\231\331a\002\b5UM\345\004\373\tK\377\357Z{e@Xi\004\276\347\237\357lD\223\275\245L)M"
+	.string	"L"
+	.string	"M"
+	.string	"\332\243m\037@02\351\037\207\324;\224\214\224`\331\3758\335p\322#\324$\371\217\035\266\254\230\241T\245G\f\207\231\335\305\250(\244B\216\225\211,\200\352\00452W\206\307\236$*\221\314\215\005\273\353D\251.\334\332m7\260\255\300\276\204?\214\351\204\351o<\304\262\300`\360b75\243\261'Q\305\207\303~{\344\307\214\361\277\223\030\035\026\362\255`\341\222J\361\260\262\373u<\332\300\366\350o\313\264/\342#F\177M\360eW\203\n\212\335-`\002\333c\346\002\264Gx\216\254\017\355z\0311\333\373\211\217m\367\224\3007!\002\331J\036\257\032\027/S\316\2362\327*\205j\313!ZTEIa\021\243\005\312)[\274%T;B(\217\212\232* Nf\254\234\264d\177\245\324\226}\270\273keY;\354\216\177\005\235h\323\361:\236\r\347\002\352<\007\236\310\323u<"
+	.string	"\346x<\330x\240.\304}<\316\343m@8\016(\304y\f\360\007B\007\342D\237\017\210\303|{\270\312r\302\216\247j\236Jb[\323\214IE\234\252\351Gj\230r\246EmA\023\231k\0055\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.62.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\324\003\275\033"
+	.string	"6\362\266J\220\232Q:\032\202\240Sk\t\013|\311\306\031\374`\261\240Xh\253\t\214$\302r\212W\007\276~\251.T\255\216\376],\263\177\221\355\312\234\333\b\bi}\335@\317\275+\030\272\216\362\347:\230\372z\264a\277mB\b\331;\311\237"
+	.string	"\233"
+	.string	"\244"
+	.string	"\335_:\223\317\327\027\017\342\242\220\2221\347\f\241\027\340\227\t\310\356\356+}\350\323\273\003k\322\320\271e\304\247\204L\316k\255\327\0230_\342\0130_^\035\337\035\206O\263$\257\335\365y\207U"
+	.string	"s5\364:\032*:\276]]8\262\210\302\031?\217\025$\362Y\223|\320EXC&\f\"\005\310\370\242e&\364\331\362?E'I\t\306\033L3!\fR\006\304B\"\023\366\354%-Li\302\232\t\201\310\022\351\210\321\253n\205\204=k\317\0139\347\266?\341\320;\366\356>\352\356^\367=\n9\272\337\364\007\370\324\233v&?\200\023\177\232G\375\262?\375\261'\371a4\266\361\251\336\347\327\337l\333Wf\333\306l\277"
+	.string	"\0051F6z\020o\326\232\201\307\257|U:\t\362\251\237\352\266\333\247_|U\313\250r\362\320\216\225(C2<S;2\023\255\n\254\242\206Dr^\035\274l\025\0303Q\267\226\330\234D\026\017b\242PT\t3*\367 \206\222b\nQ>\265\0273\b\013\332Z\322@\332'ia\006a@\251#\026nS\317\203xJjh\314y\205\320\021\360\313\2666Yb\234;\223v\357d\344\n\027\026\255\001\026\300\245\271\262\033\273\260;\202\204\375\217v\021\324\370\002\032\345\242\313\353/8)\007s\316\rR\246\325\313\310\263f,0\314\217\"\346y\006&>\2172W\270\260X1/\276m}g~\354\261{@f\244\224\027\3516HJK\020\262\307\374=\027'.\335%\016\245gB\377\311\216\t\234s\276\217\227\2775;\226~\354\361P\236\320"
+	.ascii	"\336\034\363\274\007\200p9i\365l\231\246Y\363v\333R\373\337y"
+	.ascii	"_\365\230\226\222\020/c\357\362\272W\236\275H\335\277\307\343"
+	.ascii	"\361\3307i\n4'\202\246\303\251\035b\271\035"
+	.string	"\365Lo\324\0342\325\241\037nxP\033\214\352\320\f\263\0256\324\006\007\007\305\340\002\027\323Qo:\233\016\017\n\214Ko(n:\235\364\346\026k[\r\016z\303\245\271\232z\253\351\334\320\234\232\r\227\253\325\030hu'\305\325t\252\212\253\311\362\311|s\364\254\311\222\257\210i\033\266\254\240\212\344\247\374^\241\356\276\267/\374\\ 2\347\234a\264\333\315\341W;\030\r3E\210\002\\\253\002Ig\327\227\227\r{\273=\274\n\b*'D\320\266\374\302\230\327\336\363i\214S\026\324\275\206\024U\341\377\212\001G\250Q(H\fc\212\231\222\tEhQ;\240\002\021\271\263\003\021\200\271d\243r\3176\210\272\226\302\350\204MM\276{\314'e\315\322\002\017\333\363\017\001D\364?\222\302F>`\367\370\260U\377!\232P\240?\201\2445M\233\340\005\2146\246\007\202\232\027\256M\r\032\307\2641P\b\337_\031\302>"
+	.string	"-\357\371\324^\366\256J\rO!$\016\364\364]|\r\177\220\004\360\226\316\255\\\211$@\233:o\3125\3734"
+	.ascii	"\n\301\226.\225\370e\251\344bILe\004\312a\235\374\007"
+	.text
+	.section	.gnu.lto_closeSerialPort.63.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\025\001\355\f"
+	.string	"\366\327WD\020q\224\016\030^\017\221\264\227T\004\030\336\033\211\003\334{\244\306\205;\365\036\fQA\225\302\244Tt\007j\3306j\205F,\314\264d\352\025 R\001\024p\315\362"
+	.string	"\270\021"
+	.string	"\331?v\267\366I#{\357\235RC"
+	.string	"A"
+	.string	"E"
+	.string	"\003\260\323\354\002\260S\177\366\213W\222=\353u\301\304\265\273\232\f\361\357S\306\317\307\200\247\317\016\227s\301\t\f,"
+	.string	"`\307\314\240\3100\361\324\243\006\020\025\243\205\263\273\216\037 \207\233\336\266\003\333\034\373\036\001\"\366\353=_\362\313\3540\252k\245t\262\013\362\252\261.h\013\022\257\277\375\247\234\261]7\276\036!\227\r \031Tv+\202S+\310\036\355\207O\361\275\304\364"
+	.string	"\273\"+\026\2735\201\017d\247\256\017\243lw\031\370&%O\223\262\273\037q\352\233\260S\313\311\nE\f\216\370\222 J\250Z\322\033\330\224\006B\021*Z\250H\3034JiW\260\020\3771\345S\307\264VBf\250\240\344\311\256\247(G\354\317\335]\313\037P\307\203\240!u\334\003\214=\233\b\235\255\373x\032\267i\022\266\216H\363t\236\266)`n\302\247\323H\034\327i\231\2727\207\354\230rDu\033\364\225\351\342\201\345\na\366v\224\220\212\202\210"
+	.string	"I\2030\345C\370\021fs_\021\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.64.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\373\003\305\032"
+	.string	"\0061\255I\260\326M:\342Oh+L^p\232;\024^\230\300\211\312\222\036\031\bb\371_\370\362\317!\362X\300\250\n\260\236S\336\022$\263N\370\221\007iN\006\240|A\005\027\260B\300<`\3015\337*;Il\335\244\221M\344N)\233"
+	.string	"\207"
+	.string	"\233"
+	.string	"\0370\236zN{\002\205\335\231V\024x\227\026\223\223Z\2036n@\236zgcy0\251\036\352hh\210W\255\225\2667L^\f\336\262\271;\214\214\214\215T\334\271\363\203|\312\370\302\313*\362\3739\214\030s\341\303\372\225\317H\254qe1\342M\231\r\242\031'c\"\003)4\256\030p\372l\361\033\232\243\002$\242\242\323_\371\212f?\026S\024g\244\320\270\022\340'$B8\212\002c\366\013\232{\247C"
+	.string	"\363b\372B\"\232\361\031\273Pk\365\354\375\210\356\331mC\331\346`/T\363=\317!\225\225\320\376\230\374\316\350\023\371\323\216\257d\\\212\371\336\251\237b<\265iZ:b\332\0024K;\3703\027h\277\306%\264\344\255a\313<\370\307\\x\223t:F\247\307q\232\216\323\"\235^:=\305\351\317\274\fzq\351\312Z_\224a\325\212F\341\270\360\366\205\370NBK\221?>\362\t\n\207\226Zk\315\2515\220\247\237\331\336i\377\307\201\354\036\324YV+R\231\244\326j\343\032y\232\3403\343\251\030\013\\\253\367\272\312\357\214sw/t\304\233\245\253\346\312\206\206_E\237:\225\316\006\312M\203'"
+	.ascii	"\272\fyl1\226O\307\021\272_\232\246,\302*A\023l*-!\305\020\027"
+	.ascii	"x\335\030\263\007\232\254\b\267\202&\230\277\266\2077\3211\320"
+	.ascii	"\252\265V\220\272A\220Tk\255\2352\241^z]6\317\243>\220\265\006"
+	.ascii	"\325\374$W\002B\f!b\0241\236~\357t1GV\224\036Q\373\344\342K\311"
+	.ascii	":f\276\336Tc\315/\344Ht\002$\325\n\364\236o\344Gr|\245S\333t"
+	.ascii	"t|3\021*l$xn\264\347\206\001\327\301'\207\3330\200\204\355\304"
+	.ascii	"\b\034\236\f>%p=\002\234#\341\004\316-g\353\241\341n4\236\033"
+	.ascii	"\316\016-'\327C\223@\3008\024"
+	.string	"\266\034\315\007\207\313\321f\301\372\255\021\344\031\312\340\227\026\240\345\301,\3203#Rfwk\326\234\334\026\344-5\222\373/\027k\255U\026\341\344\312\354L\306\2240\213\310\\B\306\266\206\0377\2465n\354)\fK\347\200\312\315\202);\302,\360\030V\305\026\350\237f\244\373\340G\027aULY\226W\247\031\305\245_q7\213\013/\353\351\313\215\206S>\306H\2501,$\215RF\221)\211HDH\2326\320\002\221\251\262\r\021\020EJL\212J\263\031\210v&-E\362\017!\2765\370d3\257|\207\307;\370b\t\277\241\202\376\034\022Q\253\330\372\221iR\272\364U\246\217\2445Z\330\304#\325\213\376\315j\373j\321\270J\232\326\373\266\251\222ui\262\266\376\256\n=H\021d1[,m\334\217PY\262\203&eo\320z\203\335\343{\2172@\356Z\311\354\352\327\326$C\212*\030\241\2020\3672"
+	.string	"\261"
+	.ascii	"1@\260\346\274\226a\314\300\305\275k\177\311\302\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.65.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\016\002-\022"
+	.string	"\246\"zH\320\362&\035S$\272\253\\L\207'a-+\321\276\341\332\360K1\304J\236\236%\223\340<\006pW\333\276Ak!hW#\241~\002\235\343\361\205\017\220\253YA\237\252\0340]\336p\341<\254\035{\263\226\354-wJ\001f"
+	.string	"`"
+	.string	"g"
+	.string	"\323\240\315\3435\240\375\321\323\315M\310\356z\n\302\251\313\332\335E\360\250nJ\215\240Ot9\213\005\221\2052GIT\216\206\033$\341\215La\352\321s\333#NH\023;\021\241\235O\016\227\322\200\017\215\r$!\006Y\2624\333\261\nk\242\336\3669\213\341d\341\316#\252\301\356:\312B\235;u\333:\266Q\354\310 \256\311\304\024&\033\022\326\037{\344C\277\352E\367\234\321rF\253\214\216\032}"
+	.string	"\017:,\201\271\335\f\271!\2534\221F\274\350\366k\276\315++X"
+	.string	"\276\b\366\265Y\013@B1\037\273\265\003\237N\220\372\374\312\366\243\375\023G\001~(\306\252\335\017I/v\027\201\t\244>\005\274\244\373\224\017\320=1g\337\305\217`~\220#|\361\262\257\373T\205\341\2715\361\200\217\351Z\260X\361\030<\267\022@\336\223$\303\204T\232U\032\325e\224\243&:\331\226p\\L\001\034\273\213b\373\302U\264\f"
+	.string	"\332\335\224\024\277\265\374\240OWx\305\313>\375W\367\031U54\365z\333\035\330\210\035\335<\315\304\234\342r\232`\250\322\0340,\026\227o\272X\037\204\357\305\205\305\362\211x\345d\202\312\347b\275\274\326\347\271|*-\336\212\353\345\235\230\270E\201\345\362^Z-\227\267\252\355\365\307&\372c5<(\315(\rJi^\315\230#:CD\343\244\242\b#\0355\321\351\256\311\\\356\356vJ;\254\233:\242&\263\030.N\251H\227\375x\356\260NU\352m|h\002& p\002Bu\324\003\241\300\257\323KX\304+\365\3561\355M"
+	.string	"o\026\252\345|\202\r\250\204\306\207Xl\301\356j\313\207\333\274\3342\213\215\023\034\367\nYX\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270\022Z\231\030\321\371^2D|\207H\032"
+	.ascii	"\262\276\257D]\323E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.66.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\022\f-4Pm\222\016$\013\022\312\310\242\237u\001\200\fD\201\n\276\322\347\3268km\333\355\360\364\316\t/a\277\231\331\254\242\210\276\225\200>\001"
+	.string	"'\0076K\266L\001k0\016\231\211\332p\334\233\034\304\224yp\032\212\3430\004\277\210\r\345$\336\243\334%\313\216\315\340\323@\337\220\212T\267\343\211\016\366\252t;"
+	.string	"\225\260\t\210>8\372\314\302\246\361\265df\3362~\034\333\300\006\n\326\020I\346\305h%O\244\022\217\337\363\227\025\026<W\005\024V\312\301\207\250bD%3s\215\243U\261\272\005i\003(draV1\200!3\307\013\303\350\255\177\302\217\360[\004\007"
+	.ascii	"2\003\3020\021\341\352\270F/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.67.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\200\001%\020"
+	.string	"\006\340pF\360\320&\035\272c\335\307B\372y\331mKB\360\016dZ\371b\206\230_y/p\272\356\303\310_h\206\215\2072`e\205\242\350\t[[fm\022<\221u\361\256\270\0371.4\241^\275\323\366H\032\331[\312\224\002_"
+	.string	"U"
+	.string	"_"
+	.string	"\217\f\032\270X\365\217\347F@+g\206H\307\356\267i\bk\207\337\035S\365,BM\225\377\362\f\226l0\274"
+	.string	"\361V\220\304\006\215\r\177=k\274\230\214-\234C\350"
+	.string	"\210D\017\210'\003\365\005[a\362V\251\177\035\201\206\242!\030(<\234g\251dw\235,/\303]\272m\225\355\021\373B\001\366]A\177\3464\274\353\326\230N\230\276\006\341\350\306\306;M\216\335\233\030\217e\021U\214\270\353\366?\377e\223\357b\371\256\226\205\247\345\241\306\356\227\340\321\013\264\307\333.\266\311v\246\375\022\007ryP\213?v? \245\330]\0056\240=\022\370\200\354\021>@\026\361g\311TK\032\002\202&\266\352\020\223\261\374a\341p\001u\307\231\246vC2d2\311\266\204\303Z\016\304\330\335\021\333\027~\"\245"
+	.string	"\317\356\222\2308\021\312\367yt\205T\236\365\350\247\262\307\324\217 \325\353_\177\320\202\005\233\351\001\2231\205\331\3540R\335\261\277\227T\035\243\0334\034\254:\001\026N(*\\\354N\\\004nE\345\204\302\001\360\211\310\004\023\256;\2456\024\267\251p&)\333I\227\332DB\214\242p\352\266\025\024\252\333L\337^u|\241k3Z>\260\242\350\253\262\277\376\341\323\352\201\025\351\257\312 T\227\300hLN\246;6\035\301\222F\021\351\032\333\326\362g\bI&\223\016ww\003\030"
+	.ascii	"Y\b8Z\315Sz\r\244)\345r\005\250\346`\025D%\260\341vq\366\266"
+	.ascii	"i\003M\0030\033u\241\023\302\346H\226i\335v2\205<{\332\213K\001"
+	.ascii	"\325BU\320\330T$^\327$\003"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.68.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\215\n"
+	.string	"v\323G;0\257\322\001D\240:\301\336,\334\200\022Z\036\205\323X\007P\006\267K\b\300Y\021\003\337\314b\037#\326\214\362\266\301\2320\300 \016\233@2#(Yh!\003j\237\220\275wJ\0016"
+	.string	"5"
+	.string	"6"
+	.string	"\225\316\320?P\251\210\243\351\\\325\244V \2351U?\345\215v\331'\307x\232\025\306:\275\354\f)*\023qd}j\026v\327S\034;\356\356\266\035l+\330\247\0012[\343h\257\216\355O\373!\027\t\037\303\270\300n\253<\331%\023\214\2609g\362\004\335\271\315\007\272s\016\355\226\223\2565\200\2754H`v\327\243\037\2563<\027\247_\261\271\324\335\335\352nrN\321\331\025\026\363\242_b{\251\241\250\211\316PR#\245\0366i\232\037Wy3m\331\217\375uN_\023\360\332\030\257\232\355\256f\002%\360k\3408\344y"
+	.string	"\215@\021\311\373F^\304\b\004\341\205@\222\347)\360'!\002\275\322\367\201^\207\334\323\2267\266\230Z\006=q\027\335)8\302\202\232\245\001f\245\36671/\006\023"
+	.ascii	"m\231'3\360\316#:\326R\\w\365\002\rc\035\2502\251h0/A\273l\221"
+	.ascii	"w\t\240YM\t\356\305-U\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_nopConsumer.69.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 \336%\006"
+	.string	"\242K+3`M\222\016@\343I\231\312;\207\363,\0261\212\023\240\320\305\210\242\201P\303\203\307B\235|\013Z\326J\222\220\310\340\216Z\357\2213\240\213\332b\033!;\005\316\343\034\2427\232\007'AN\247=\251EH\016\242m`\247i\006~\022\034\330<\357\301\226\251\232,t\001\005\253\370jZl\3433j\333Y\350\227\300G\n\225\027%-F\013KQ.'\035\177f\376\265^\201!&\310\304\254\325 1i\253\204\017"
+	.string	"\362r|\025\202O\247\005\217\021\013\221\225\266\215qd\314\025\317\f\311"
+	.string	"\0205\345\3024\264}\201\250\214\234\345o\360#\374\237\007"
+	.ascii	"2\003\3169\003\027\216]\306S\251q\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_serialPassthrough.70.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\222\004\025\034"
+	.string	"\306r\263K\260VU:dC\364\n\224+cd\347\312\307\230\345\301\246\364\005\323\004D\302\2233\300Z`\333U<\243Y\246\301x\275k\243\007-\354\205\364\r\362=\341N\351Ot\357:\013\205\333\307o\336;\243\225\220\\Q#\204\220-w\222\001\243"
+	.string	"\227"
+	.string	"\233"
+	.string	"\263\307\244(\f\353e\325R\245N\263$m\327\031_U$\364\230\030O\255L\020\016\333\235n2\354\201#S\226\033\335~\025]zJ\007p\310\nQ.\306atg9\335j\300\250/C_\375\344xoY\323'\b\307\235n/l\004\250c\222\033\335lTU\361\251\033@ +D9\336S\366\001\316\310\321\235nC6E\245\250\370\341\005\030\335v\365<QNwS\205\023z\351\342\344\217O\265-\3366\201\021\310Cq5\353\332\0211~\370\n\204;Q\253I\341\336\313\325\206\313\235]g\276\r3O`ncW\372]O\372[\017\376\351\203\374\350\223\316&Y\271\264\225I[\331\222\225\333V\256\266\362\005T\025R\232\340\276\302\311\275AQ\\n\023\231$\307\207\374\304\245# \217/\204_\344\0257p0;q\304\357\317\035\261\003\230\342xo\020\301I\226p\236\254+f\245%\020j\022\211"
+	.string	"\351\255\tk0\bB!xe>\322\201\314\036\244\304Y\367\366\214 \2717\250\200\013\234'9x\231\362\344yWy\222g\314T\036\374\335"
+	.string	"ELP\f\265\334{_M\203OFY\305&\031\315\254\241v\215b\024\272\275\254\r6\365\266\231~\361\256\242\221E\204\037\3241\005+\3372\241\024\230\234X\275\355\375(O\242\376:\005\310O\3604\260\303\2623\333G\300Fr\007\235\013:,\326\3255\r\304%\331\275\001P\315\035t,\350\256\034\335k\3426\266\265\325f\003\025\271\253O\364\331\366\305\364\220\272{|\022e\253\233&$J\370T\253P|\326\024\366\343\254h3\207\340\251\267\361\207\377\357\211\217\246Z\323\230\203\264\332>\3467\330B\344\3561_\351\\\363!g\232\023\3173\001\260W\350\341\220\023\223\225\025\310\036\01691\031\331\203s\343\3012l\201\007\233\230\354\206\347\265\023{}\210\331\350\274`2\236\327\002"
+	.ascii	"\274\003\342F\366\352\331\331\221\275V&\277{esM3\016R\331(M\227"
+	.ascii	"m\nwUb\230\351\210\323/%\373=P\262\353\321\350\203\267<)\t\242"
+	.ascii	")M\177\351.$F\036M\265\246\301\324\341\f\334\217e[Dj\373\303"
+	.ascii	"\263\216\306\242\227\231\332\315f3\016O\246vc\310Po\343\032\237"
+	.ascii	"\246\361Lw\2333tPPt1Q\243V\355\343\277\211J|p\255\356\235\351"
+	.ascii	"\265o$|J\003[\250q0%\211R\n\221\210\210$I\r\351\320\002\021\271"
+	.ascii	"\262\003\0200\251\244\212\2269\340\205\3528@\355 RG\332\204a"
+	.ascii	"\274\311c\b\335E\223\205\"\217,\330\253\345}\013\345\222-\031"
+	.ascii	"\200\f\305i\217\222\242ipzM=\360\373:\321YP%\"\263\262\200^u"
+	.ascii	"\303\361\0071ns\233\371\351\017\217\202~ea.V9>\315\020\266'\330"
+	.ascii	"\276\346\032\340\2353\001\277B\250\311Q\232\254`s\206\254W\020"
+	.ascii	"\310A\326\221\310I\022\242\f\021B@\375[t\261-\334`\330\346\340"
+	.ascii	"zz\\8.\353V\024\\t\305O\203\356\217y\311+\"\301\310\217\3341"
+	.ascii	"\345g5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\200\003\005\021"
+	.string	"\344\030|\004"
+	.string	""
+	.string	""
+	.string	"\002\305"
+	.string	"\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\0060\177/\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005(0\301\204\001+\1771\234\211\365\321"
+	.string	"\220,21\1773\346\206\316\220*42\1775\0023\1776'\"\300\003\0024\1777\0027\1778\252\333\34265\033\300\003\0026\17798\177:9\177;:\177<\250\212\250\332\001;\177=\270\215\221\313"
+	.string	"\005\311"
+	.string	">`<\177?\002=\177@>\177A\377\377\377\377\003?\177B\300"
+	.string	"\177C\005)D\301"
+	.string	"\177E\002\302"
+	.string	"\177F\303"
+	.string	"\177G\304"
+	.string	"\177H\360\372\250\002\306"
+	.string	"\177I\307\3712\005/J\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005-K\001\307"
+	.string	"\177L\037"
+	.string	""
+	.string	"\200\220\200\001\310"
+	.string	"\177M\312"
+	.string	"\177N\314"
+	.string	"\177O\313"
+	.string	"\177P\320"
+	.string	"\177Q\317"
+	.string	"\177R\316"
+	.string	"\177S\315"
+	.string	"\177T\003\001 $\003\r $\003\r\013B\003\020\017\320\371\216\307\003\001b\003\020\b\350\274\307\343\001\001\342\001\003\021!\204\223\242\253\001\001\244\017\003\024\023\"\003\025\b\003\"\271\255\362\217\002\001\204\006\003\026\n\027D\003\034$\221\205\327\307\003\001$\003\034#D\003\035\034\"B\003\035(\300\206\275\355\002\001\344\001\003\035'\244\006\003\035&\304\006\003\035%\007\007\003\035'\231\365\231(\001\244\n\003\035&\300\327\351\371"
+	.string	"\001\304\n\003\035%\013\004\035\325\007\004\035\231\365\231(\001\325\013"
+	.string	"A\250Q CE%sQ\222\2329\240\002\231\252Z\007\021\320\220\246\0201$\230@*\022\302\240\007\366\224P\234\355"
+	.ascii	"\345\237\315\006\235(s\326\302\fy\272\023\304\0015\216sf\273"
+	.ascii	"T_!\371\224\274C\274O\343\227\271\350\351\215\241\251\257\036"
+	.ascii	"\337\330X\246I\376/\322\256\356\"x\023\267\206\025\317\b~\004"
+	.ascii	"V\356\330\266\230X\225\016\340\t\252a=<2\213\313\t_{\323\222"
+	.ascii	"\2427J\006\330\334>\200/\335\007\002.\025tL\356h\\&\013P\016"
+	.ascii	"\b5"
+	.text
+	.section	.gnu.lto_.refs.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375 \301\305\003"
+	.string	"\322\311\030\033\240'\351\377\377\377\377\377\377\037x_\332\332\367\326\372\355\177\373d7\322\310&R\246\263\214V\027\346\343^W\321\205\363Npt\374\334\265\021\265r|p/0\236\216#\367\310x\0317\235\307C2\364\245\260\302\017\2413i\200[\362\247\276\2527!\240R7\366\265\"\235\035\361\036\037\336zVMo'\377F\006"
+	.ascii	"v\306b\321{C\264R\305C\026\001\017\226(z"
+	.text
+	.section	.gnu.lto_.decls.a049307c9dc110b6,"e",@progbits
+	.string	"(\265/\375`\310<\365\372"
+	.string	"\352t\361RX0\f%\235\306\334\324L\323\273\2621\211\242(JcRU\025\265\t\213"
+	.string	"\"jN\3064fPD\267\257\nQ\020\315\020\276_\207\243\333.\202\315\303\241g\353\""
+	.ascii	"`h\311\270\213\354+\357*\356\n\236\237\206]A\035\267g\325\240"
+	.ascii	"\0036\"\236P\206U\325\222\326\266\224R\246x\004\035\005L\005"
+	.ascii	"W0\354z\243\356\213\203\020\202\0076x\252\252*G\316\307C\364"
+	.ascii	"\361\327\223\013\227*Yqk7;\275\214I1\232\241C\337:\261qV\314"
+	.ascii	"l\271\344\371\337\246\273t[\330\3652\335\025\277J\227\305m\326"
+	.ascii	"\275\311\262.\3235\272IX\353H\227\005\261c\272'nS\204\240\243"
+	.ascii	"\226\022rH<\260\361\300\203\231\240#^Qt\2664\030\252\251\002"
+	.ascii	"\257\025\265M\335\234\"+\215\0211\222B_\025.\212\257{o\030\246"
+	.ascii	"(\245\272\233\217I\350\337,\027If\212\t)E\226\334\243\2571\370"
+	.ascii	"'\205\233\031\234\276D(\336\t)s7\377\022\335!{\027\263&g\302"
+	.ascii	"\350\346\274m\206\232\337%\321\341\267\304/K\025\023`7\317\330"
+	.ascii	"\232\337\036\214\024\022\231\013\241\0164P\332X\326\315\032\252"
+	.ascii	"\320-\255Fd0\263\246 zq\363]&1\361\274n\276?1H\326\242\206\206"
+	.string	"\350,\266\357n\273^\245\265r{\305\362]\245-b\253`\255\243\f\2140q\225v\210U\303\353\231\026\352\032z\226]\245\305\242\204\310y\235\274P[\322\371w\325?\247\271{CW\261+\330\275\234Wb\307\327\315TlPfY\325\221\233\177\231\364\355\323J\261O,\024\253gW;\3056\271\305\263N\236\327\275\201\354\033\022,\316\254<\353\006\325\267\025g\351\360\352\004~-\257<\367\336W\300\337\301N\261u\366\016k\035\351\257 V\236pI\254\233\214\222f/\345\370\234{\257\267k\177\207\037\204\020\354\024k\304\272\341\325\271\227rC \300\365e$eo\357\325\306\203\031\264\025yo2\3716N\037\316f\370\301X3m\355\354\022\273j\260LZ\200\326\315\325B\007e\t\314K\337j\370\315h\370\335\366\320V\316\316\331\325\306*\261q\313\242\0267\337\342\320'\330}\326\346w\033C\337\252\2405\330\245N"
+	.string	"\233m\263k\006\366\310A\b\341X\271\265\263b\262\364\310b\002}\233\301\317\366\331\f~\037j\021@\240\177\026\315\246\331\265\003K\344\366\314\226\035\375Y\367\272\367:s\247\260\204\005\271\371\032\320\267\035\374p_\237\355\340\367\006\350\013gk~46\203\020\233\230;>\267\267\233\307Z|\354Hqv\263\375\262`V\354:\355\r\264\367\256@Fmn\353\310\206Y\256/\031Wn>\007\372n\233\341\247\201\255\371\331\256\016\267^5\277\243\346\272g\002 Dm\310\315@.\233e\203`\346\220\323\006\333{\265\220\325\220\360\236\334l}\330\037v\265A\354\326\363\226\323\346\332{\307\274D\235\201\375\334\254\201\315\360\313\266\346'\363\264w\b\277\332g\357\275\201\366j\277\2576\303O\333\032-\271\260\377\306\335\256$\027\356\277\021@\222u\340\037\363\370\257\325\333\177\263\334bp"
+	.string	"\352\371\317M\030\\`\305\361\024\374\231H\004\300#K\024.\016\f\354\f\023\013\267\340\317&\270\033\330\302rr\360\2772\214\374v\305\177\327\212\214\375\367\305\001\360g\024.\276+\\\265\377f@d+W\340\001\024\374o\371s\207\233f\t\200\201\f\206?g\360\337\0304;\3440\177\276 \007 \354/\177n\271\376\361\225{\346\362c\274\377Y\216\345\377\223\274\377P\376G\371\377\234\273f\377uQ\266\365\343\256\377\n\375\327\304\177K\374\227\371_\240\377\006\375\227\304\177\211\356\b\376\253\374\357\317\025\362\237\346G3\370\257\367_\311\373\376\357}\370_\301c~\274\007\345\267J\376\333\037\013\371/\331\177\305\376\353\365\337\255\377\372\370o\217\377V\375w\306\177\237\376{\364\337\242\377\206\340\277(\374\227\003\377\325\300\177/\360_\017\377-\341\277\022\370\357\003\376\253\200\377r\370\357\007\3775\300\177\007\360\337"
+	.string	"\374\327\346\2774\377\225\371\257\376/\226\337V\371\355\224\337\346\375\026\357\267t\277\215\373m\333o\201\374V\370\333\"\277U\373\355\360\267a\277\355\340\267\032\374\247\362\333\373[\264\337\232\375\266\204\337Z\340\377\316o\031\360[\262\337\212\375g\362\377\310o\275\376w\360?\354?\221\337Z\370\255\326o\327\337f\375\026\304o\261~{\365\333\364\2677\277\325\360\333\002\374v\203\337\306\374\026\370\333\337o\321\337\346\337\342\377d\377\307\376\007\371\337\201\377m\377/\350\353\353\353\373\2014~\227\256\377\203\n\004->"
+	.string	"VY\021\243\211\225\\\n\fM-\255@\255\2743\"7?\246\204\333\335p\234\336{\333.\242\246\006\254#\252\351Lr\034\207\247J\370\030\302p-,\216\356\346\340\220\354p=\327\356\217fFEi\336\214\337\254\225\230\024AW_P\364\261\021\314v\334\206\3330\227mn\345\223\005\334"
+	.ascii	"k\242\320p\230:\375\373\377\366NB\327}\264\204\371Y\324\306X"
+	.ascii	"l9h@p\357\245\020\253(\272\312\354\207\205\006[\303\336\312#"
+	.ascii	"&\327\223\322\002\223\353g3\273\340\220,0\327\355\242\202\315"
+	.ascii	"\365b3W'evR\336\275n\240'\244\r\344\244<2\327}\264W'%\315\006"
+	.ascii	"B\242a\256?J&\327\023\222er9!Y\330@[\271\201~\\h '$\346\021'"
+	.ascii	"$\032&\327\017\022\023\350\t\311\356\325i\333$i\353\2232hs\375"
+	.ascii	"\304\354\275\207V\247\022f\357\237\243\255\214\273D\373\351I"
+	.ascii	"\264\231\266\205\353\261\276\3306{o%\230\035\224S\313\272\334"
+	.ascii	"p\314\034N:A{\333m\242\005(\255Rh/\225v\357\240\365h\357\245"
+	.ascii	"\223\b\232NvN\350h\307l\240\237\241%\224\023L\320\322Ih\347p"
+	.ascii	"a\221\230\\PN\035\206xq9\367rUZ\346\220\323vn\273\247#\315\245"
+	.ascii	"\\7\030\224\030\256\251\346\320\315EfVP\22227\246\343V\034RR"
+	.ascii	"Xn\306D\206Q_D\266\320\354\212\321\360\352a\335J\231 %`lh|v\261"
+	.ascii	"\031\036r|\206\313`\200V|\226\367\376\261v\003\031k7@\325j\374"
+	.ascii	"\004\371\345\303HiLvE\267\305\244E)\217\t\013l\305`X\314\256"
+	.ascii	"\333\250F\b\310\321\321\0078\314F\006\353\t\r\230!\375\027\275"
+	.ascii	"//#\317\242'7\343\256\0346\242\254\210\\\020\273b.\024\013mU"
+	.ascii	"a\335P\250)M\314n^\27104y\024a-\274\302\274\3610\223\202\327"
+	.ascii	"\037\377\300@\256\013\230\231:\025aK7\353\275\261\017\035\270"
+	.ascii	"JW\213\252\254\243 lW?\030\213J-\253\304\332\023+N\360~\333\272"
+	.ascii	"Q\362\370\260,y\323\253b\341.\224\275\273,eT\360\226\364a\245"
+	.ascii	"\333\025&N+\177\007,dv\253X:\253\273\347mr\361\254\033\026\347"
+	.ascii	"}^\351\263j2\350\336NH\234[\313\266g\223\277\203\221X\013\f\205"
+	.ascii	"q\340\034\270\006f\201i\340+\274\003\353\300V\270\211\253\260"
+	.ascii	"\nl\003;1\017\274\002O\341\036\370\006^\3023\260\023\216\201"
+	.ascii	"\2430\025v\201\2330\023\206\201e\340'\254\204_\330\025Ka\024"
+	.ascii	"\307*\340\024\317!\214\260nF.\223\277C\021&\032s\342\2405'\226"
+	.ascii	"\302I\370\204\205kz\270\002\202\245\256\035\363y\024v\371\230"
+	.ascii	"\326\255\254\f\210\355\211I\374\035p\t!NL`\"\2627\374s\304\252"
+	.ascii	"\216\204\323I\036_"
+	.ascii	"\007\214d\335,\\\323\001W`O%,u\263X5\013'\025\201,\273\347\225"
+	.ascii	"2\305\272\311\340\275\231\2348C\300Rw\257\206\326\217\0372xL"
+	.ascii	"\364\242x\310X\204\027.|\302M\004{\203\001\253\372\212\364n\376"
+	.ascii	"\313\017\375\027\032\372/J\372/F\372.N4\036\312)\334\242l\334"
+	.ascii	"|\027:}\027!\372.X\372v.M\372.I\372.B\372-W\364[\244\350\267"
+	.ascii	"4\321o\221\323o9\323o\341\241\3372\245\337\322\244\337b\244\377"
+	.ascii	"\254\242\277\207\247\257\333\364\365\017}\315\244m\264R\037\270"
+	.ascii	"D\037H\246\017\234\241\017<\322\007\376\350\203\351\351\237\311"
+	.ascii	"\351\257\375\322\364\177V\372\277&:%3:F\300\370\261\222\351!"
+	.ascii	"\316\365\312\234\234\223\255;\345\315q<f\304(rs\n+gW\212\233"
+	.ascii	"\257\211\033\227\207Q\220\251\347\026V\223\323\352J\312\331C"
+	.ascii	"\306sm\361\2341u\251\212\344lp\335/1\271\242\247R\220&\331=;"
+	.ascii	"\2614a\302y\274 9\032JZ\366N\006\210f\003A\261p* \213\t\355\372"
+	.ascii	"\270@L\310-=/\232\215\263\272J[J\317{\344\256\335$\367\355\""
+	.ascii	"\271pw\205\253v\335n\221\233v\331n\333\035r\215\330\365\242]"
+	.ascii	"\024\267\311B\273`w\314\302\201\355\237$\rn\234\351\241\360\300"
+	.ascii	"\306\003\231-\032D+\007\331\fL\253\t\223\025G\235\031\325\315"
+	.ascii	"eW\310\357\207\234\024\333\023}\224I\330\025\233\241B\024\205"
+	.ascii	"\016I\030\333\365\202\311\221dd\203\254\013\345\322G\261\364"
+	.ascii	"Q\033\372\250\013}\264\t\344\207\223j\013\357f\270\031\230,X"
+	.ascii	"r"
+	.string	".n>j\244\217\376\350g)\372\331N?\267\351\004\330\232\237\216\273#G\036\221\226&\265\245\3439~q>\266\327\3157\307L\215\262$/n\2768\254Z_\331\021\265\233/\345x/Ef@\275\361\320\317R\327\206\212\250\037\274$]\203\006\026\033o{7\237\306\235\300`\020\023\227\264d\337\374<B\377\314\326\374\244\256\nvT>n\246\262\002mPed)F\224L\230\225\345\315Q\027\312\272\311(\327m\004\214\221\325\024M/\376\027\350\f\273\265\2150\360\320\003bEC\013\324\222V\032*\343\350\214<\327\005\344v3*\225\211\326\236`\244\305 \221\005K\320\315(\214\031'L0\330\236hT\215\232~\322\321\024h\022\372\204\351`\266rk\033\001\315\330\260\370\3666\263\251\341E\313\204V\222\273t\364\351\250\013\020B8\236\325\016\272\237\233Q\247\243MM7\264'\023\332\364\267\270TEq\361\330\241\217"
+	.ascii	"\275\225\002\t\351f\264\305\361n\016\274\241'7\243,\256\006\323"
+	.ascii	"\254\333\213\201*\275A\311-oFU\240M\273\276\r]q\0314\241\260"
+	.ascii	"6*\375\023\330\267\375P\024GU@c\212z\212qB\214\216\205\363I\277"
+	.ascii	"\206\205\376\321#\364\350.=\320\354\r\305v\226UX\213q\342\346"
+	.ascii	"\327\220\310G\236\361\354\232\217\240E\230\331\334'8\2102\321"
+	.ascii	"\266\302\f\272\233Q\"\340O\035\235\021>}\233\365\314zM\236P\356"
+	.ascii	"\250\344*;\220<\243\344'YL\320\240|\005]Z\270&\315\006*\333{"
+	.ascii	"\226\241Ay\212\035\023\035BM\240$\320\021\250\020Z\302\256hP"
+	.ascii	"\266\362\354$\347u@\203\262\224%3Q\260\276T\320\344\347\3610"
+	.ascii	"X2=\374p\202\376\240@vE\227\033l\231\371P\245\205k\256;\351E"
+	.ascii	"\210\036\017\247\005\036\304\350\315\331\261\370\345\037U\242"
+	.ascii	"\233l\215\001\345\346\334\327T\3216\342\b\026\273\346,R\254\206"
+	.ascii	"\\\271`D\377B\232\376\005/\235\367\264\222\347\322\333\252\177"
+	.ascii	"!K\377\202\016\375\013N\375\013R\372\027\240\364\236p\261Ey{"
+	.ascii	"\"\3476\264l\322W\203\255\371\345%\371.7\271:\2031\246B?3\311"
+	.ascii	"\300\f$c7g{\265_\256{\266k\243r\022%\351g%\231\316\316F\230\326"
+	.ascii	"\315\277PB?\317\215\365EYqs\226\323A\026\370:pY*k\312r\177~\303"
+	.ascii	"$r\234\bJ\320\207\205\312\315\031.'y\216\313Hv\216[\200\323\336"
+	.ascii	"?9n\206o\357\237\031k7\260v\203|\005E%\366\313\267@E\307\330"
+	.ascii	"\232\237\305\353\360\354\366\362\266\302\023H\0225\265\314\346"
+	.ascii	"\200\033l\316\335\264\322\240\225\346\366\360\214<\263\001G\300"
+	.ascii	"X\231n\316k\267I%e\366\2749\027\271M\033nyM7\347\025\360\027"
+	.ascii	"\220\\\227\221/\2314\267\247\036fiiYK\333\334\240\272\202\205"
+	.ascii	"\245D\306\220!\271\312\003\206\033K\034\350j\262p\242\254,\233"
+	.ascii	"]\247\275w\320\366\231\273\321|\376\306\262\256\240\\\312\263"
+	.ascii	"\231u{Y\202d\345\203\212\230X&3\313\022S\324\244\rn\354\231\f"
+	.ascii	"x\0055d\005\r]\006\263n.\313%\353\007\247Y!H\220\354e\363\230"
+	.ascii	"\232\256\254^\322r\254\321u={\231Y\375(rs\346\302gbdM\\c@\200"
+	.ascii	"d-!}2gL\270\245\365Y\313\005\006\013e\026\r\226\016\035\331\207"
+	.ascii	"\276"
+	.string	"\273j\272\332\373\365X\"!\224\365\354cF\217!\0357g,+\006\244\362\002\311\325Mz\351zQVus\356qy\314\310`r\305\2749[\035/\003\275\270\321vs\346a\357f\262\230\320v\3341{\345\214\216\304\375\302^2\224\374\240q\343F\256\3620E\343WcYv\204\343\271\252\205k\256\206\222\346D\215\032\231\312\303\335\212\246\253=\340\332\220\017\0336\236\251\210\362p\224i\315P\321\177\236\272]\363\024^\363\340\264\223\016p\243\371AL\023\026?2\352\242\242\262\f-\203\n\210c\254\206\234\324\263\2141#ie9\306\275\313S1\027\003\306\034\222\245\254U*\207\321\212\264\354\224\2352\324\327\022\022O\033O^pO\317P\267Id\211\026wsv\361CI)3y\2601\370v\272\272\262\362\3223\023>{s\273b\344\346\334\"\023\305p\325y\255\335\234YX\265\226\271\272,\251\251\244\244\334\364"
+	.string	"\254k\262\001\026W\312P<7U\350/\251\036u7\347\024\2779\031C\230,e\025\362\211LT\365\2142\233a\346\243|\224\213\352\302\234KI0\214\240\344\022\271D.\222\251[k\272\332;\201\362\210,\233x.\312D|h\373\353\346<\204\302\261\245x\262"
+	.string	"\214\r)\tFH\022/!l9(\007ef\013\256\223j\272\262j\231\221\303\n\021\241g\246\003r"
+	.ascii	"\355"
+	.string	"\270M\270)S\300\326\276\367e\240\013N\340\230\320\320\323\205\n\n\037\320\315\317@yi\365~XAr\227\371\207kE\2260\247\373\005\267bEV\336\025.deLWNW\256`,6\312\n\214\323\221#Q|\307X\256\026\223DI\022Sf\357\255x\017WqY\336e\036F\204J\340\255\226\037*`6\246<y\202\247h\340\210\267\026\032\260\263*\016M\357x\212\024\0302\030|J7\343(/xSC\242\3560\224\273\337\233\021\237\225\"y\267+\316\273\313\026\346\336H\003\3502\321\374\240%\251\310\007\224 vv\030\317\303\013\324^L\025 -\256%\307xM\234/\366\204p\023|w\204\314\204\022*QY\214\3441\261M.\300c\n\261b\026F(\251\234\364m\017\213\347V<\207\351f\202\f\035\0059E\242J\024~\340\004\fCazB\212,!\231\252\"F\360\371\220\252D\344\007^\256\263\001"
+	.string	"\"\204;\351\020\025\241\036y(p\301u6\034o\324\240\006\305\364\250\201\343\315\207\353l\330 =\212\370"
+	.string	"\202\023`\206\251\317\t$"
+	.ascii	"\340:\033\324$\207t"
+	.string	"\330\263sS$r@&{8P\260\263\323S,\032\213@5\370#\201\261\b\304\021\246;YM\223<)\317O\304\321HB\360:\033r\2167\305\236\227\"\316E\223A\0305X\3149\242\305\234#\326Qs\212\351\316/-\0011\231\223\311\0249\034\n\201\"\216\306\233\214T\217x\230\026s\210;B\3400M\366\3444\t<2\230s\334\020\223E \325$1'=!\230A'\247'\231\024\346\024\211\252J\344I\026\205\310\017:Ib\221X\202\361\003\322X\202J\024\222\200"
+	.string	"I\0232\354\020\205!$\240\246\025\ba\344\241Q\213=F\022fTb\321\2044i\334\271\231)\246G\243L\262\003\311\3248\264\271`fH\334\021z\240f\230&\211\027\322`N\221\210\024\352\240\220\026\211<\310TM\207\0300\250>i\006l,\0201\202"
+	.string	"\222-i\320e\204cO\nF\343N\rO\252&E\240P\243\366`@\210\354\331\300\260H,\201\203d\206\034\"N\260X\302\t9G\n\216\306\342\313o\210\310\264\230\346\350/\200\001\b`\200\b>@U\r&1\220\362\020U\255&\211\027\250\3311\032G\b\242\252\005\310\224\247'y\235\r>H\0169\307\232d\360(\344\271A\242\310tH\faD\036\207\251\017\322'\3359\366L"
+	.string	"gG\250\343R$j\240\006\2019\302\017Fb0\247g\347hcAM\223)rX$\202\b\252\302d\220\247\007\251\246\220\036\223\027\300\244;\302\033\027\025\231\206(\022o\220C\"\017Z$\362\350\024nR\235\033\037!\217N\246)2'\235@\272\223S\224"
+	.ascii	"\217\220\204\020G\234\013\303\035\243N2E\352|HUa\b\242z#\001"
+	.ascii	"$QhS$\336\244\311\236\240\017\362\305\247G\030\364\021\362\314"
+	.ascii	"$\221F$2\315\240\246I\034\034\343\213\005\265H4\036\3254\211"
+	.ascii	"\301\020)$\001\322\2103LS\034\001\340\340\030\325\236\233`\222"
+	.ascii	"\350#\f\346\364\200H\207\025\2108\"1HwT\325\210\324Q\203H\243"
+	.ascii	"z#\304\t\032\325\036a0\247H\324Q\215F\236d\360\006\271\301\320"
+	.ascii	"HD\246\307 \316q'\230\362\b\2218\301\033d2HL&\221\026\f\211A"
+	.ascii	"\225X\354\211\001a\307\007\231\234Q\223B\234`\017\210\244\f\262"
+	.ascii	"\230\f\372 gRH\ny\202\311\235\264XL\207D$2\ra\004\3000U\205D"
+	.ascii	"\325\230\223\026\203i\262'\210\223D\336\330\\'\211LC\020\221"
+	.ascii	"C\f<"
+	.string	"@\223\356\200\020~\b\361K\203\351\320\210\001\227th\344\311iP\0031\311\243\021\230\252\302\023tZ\002\"\nZ\325H\230\2410\365\260C\024~@\24688=#\370\2500!\210\351Mz\202\215\213P\025N\300\007)\203T7`B\n7B\020;;B\022\322\235!\021\3467I\025\005\024\206E\"\316\005jR\270\323\242&\203i\2160\331\001\013j2\b\343\222\006K\300\240Ud\252\336\b\221B\235\233\240j4\202H\22142\352u*\270\361\230\"9\250F#\222\303\213\b\244\232\362\244;\251ZA2xA\r\202\240\200\024\222B\f\024\215D\365\246\330\203\003\363#\272\034\223<\026\222\307\034\013jP\004\240O:,\2320\354\021\202\b\372\030A\244p#\334\001AA2\207\210S4\222\240\"\215\307\0275\310\200\016j\221\330\243K\240\203\f\246\252px\354\tfH\203\310\224\210CT\213\351\320\004\025i\334"
+	.string	"\005\357\320\201\004\r:\220\201\n\350\233\r;B\"2Mr0\0229\024\211B\036\0167\310$\207\r\024\314m\311Ha\342\001C\016\025\003\201\316I\024\207z\2714\261\330pK\202\271\366\330\224\220\200\323r\211rr\304\211\004\355\241\253\250\241\250\362\206\372\210Y\263\364\270s\313L\214%4%\313\221*7\0352~\3322\325\f\r\257\27206t\206\013\022\27480\030#\243)\2475\274\006\234:R\301\004-\222\201\362\274\312\256n^\263\362\222\355D\013\265\314\364b\305\224\273\233\257\024\360\315\t\237]Z.\302z+\256\326\320\304b\200\244pQ4\244\n~\273[\001\310\031\246\263T\222|\374\270fOp@\372d\224\341\270$|Rq7\223\221\021=\211\\h)\335"
+	.ascii	"\003C\305\242\232O<\305(\207\n4\354\250\030\n#[02\300\340\342"
+	.ascii	"B\275\022`\267\220WW\321\363\347\006Eb\254\353\250\227\275\203"
+	.ascii	"\211\222\243\001\225\001\005\020 \350\026\007V=\024V\231J\222"
+	.ascii	"\033gZG\267\224\354\361\221\270\031]os\212\210\212\252g`ba\241"
+	.ascii	">\354\327V\335\225\314\022'oJYG}0\031\021\006\206\325d\330\264"
+	.ascii	"\220\346\352t\350@{\244\235\351\241x\261+\353\222\262:\332\343"
+	.ascii	",\305\2142\036\253r;\341\201\356h\321kr\007$\263d\341\2141F\203"
+	.ascii	"\006Ze\267\266\344r\314\fM)\312\202\3428Z\3256\027\344\350f\364"
+	.ascii	"\306\325\262\025\262\254\247\233Q'J\205\332@k`\b\205_\250C\263"
+	.ascii	"\023rl\262t\3120fhf$M\222\016#\025@@PP(\233\313\273\234\017\023"
+	.ascii	"\200\323\307#\242\232G\021SHfD$IR\310\326n\240:\204\255\244\""
+	.ascii	"\262:\005.A\330\256\314\370\204xN\224\342y\017[\254\234[\201"
+	.ascii	"\030\327\262\205\232f\323=F*C\370\274\002\335\347\312\355\321"
+	.ascii	"7\342x\b\324\274\351C{\246\322g"
+	.string	"\3022\207\346,g\354\264\016\341i\007\254\313\032\363\2313\325\202\331\354Qx\246jgF\307:\256\026\347\373\027\320\352\365\031\336\373\350T\366?\020\216\023\233'\202\361\020\332Ey\340[\215\236\361\260\021v<CZ\021\217\260\302\317\377\316,\253\033~{3\357hJ\2609\306r\337\241\306_\277\363\316\333-\303%d\364\216\214+\001\374\323\310\373\303\341#\202Kf\034wo\317\336gp\242\2434VB/\203\242\244\352\300\322\177f\225\263\r\371k\346\356oz\035mC\337d\004E\241x\334\021\361\013\364m\361a\321\212\204\337\254\022\266\200v\240-6\003\031}\013\246I\030\350\0137\347\034\201\275\020\234k\3705\\\026\216\313\013\340\3645\037<\210\343]eE\030\251\004\331ksO\311\3550\324\243\212\205\306~\016\346\212\324\260\257\201\003\n\035&< bg\374\214\271\002\260g\007\242\234\377\267\351\312\344\216\331\375O"
+	.string	"\324T[\236\022\276 \334Y\214\226\351\343\371I\264F1\367\274\0032\003;\nE\220\002Z\256\257\344\244!\271\366\0365l\260\022\261F\274h&\265M\302\242\001\007n\n\252~)j\266zd\303\346d\375\341({?#|}s=|\354\005\345\304\257z\213{\330&\314\263\234N\222Y,\007\365+\254\271\001b\301.\035\035N~\244/\306\027\372s\213\3535*m\270Q\360\365\353Mn\n\346\251\320\367\211\013\330\334\033\201\257)d\335\0244 }\212\262\313.TN\024\257\325*t\277\337>@\036E\3555v\336\007=\264\246\215\341J"
+	.ascii	"'rPy\307\354\244\262x\333\364\323\0329\360]B\307\302#\200\310"
+	.ascii	"4\207#\356\344q1\203\350Kr\\\257<r\005\274\347\361cNV-\200\264"
+	.ascii	"\215\003\222D\315\303\232\205X\245~\266\212\\\2007\354\305<\b"
+	.ascii	"\034z\3603 3\t\305\016\275\325\r\274\003\323\\\330K\230YRNRL"
+	.ascii	"\030>5\256\254Cz\300\226\315\027\254\\\364\230e\337\306\246\347"
+	.ascii	"b9\353\260\303,\b\225\325\216\374\3615/Fu|?\205\326P'\020\257"
+	.ascii	"\225\210\013\026D\211r"
+	.string	"xa\341\232cy\207U\221H9\306\2223\220\221\302a\252\273\317\310\251\25668\235\327\330`\233\317^\351\236#S\233(\355\2710#SB?\260\312w\253H\217\272]\274\261\322\301\232\304Q \273~\033McH\f\371 \245N\231"
+	.string	"\236\031\262\313\210aE\312\375p\312\247\251\233\300\24421Cr\256\315\241P\204\261\263\255\276\271\325\020\022De\302}TZ\376\344\331\017\247u\237\333\332\351c|\220\301\230T]?\361\267\230xg\315\302\266Z\372\327N\271\026B\006\221\203{m\322s\352=\0044Q\033Tp\241L\245\346]!&\323<\222\314\r\323\262\225\251\360\230\rV\3151\025\271e\237j\354- \f\\`\336\221C\1775\263\344\244\235T}w\\\346\005-4\215\013WWVz\323W\275v\245\020Y\322@[\255.Py mS]\216n\003\240\233"
+	.string	"\3443\217\320\210\020\253\013\3567\235\233\266m\206\302\026\223!\277\361\206\025\031&\3310Ai\342Y0"
+	.ascii	"\374x\376\366\220Y%(pkQ\221<\237r{\037\003xx\321\3509\357mX-"
+	.ascii	"\227\347\022\273?S\277\375\215\356\306r~=\006\031~\317\230\314"
+	.ascii	" \371\225$\347\367\215&_]\265\002\241%|\317\331g\265\330\001"
+	.ascii	"\024\256\366\260\377\346y\354\206\312E6u\250\352N\tb\f\031\\"
+	.ascii	"\032\270\360O3\"\232o\017;M\251\200\327\223/\201`+\333\007\216"
+	.ascii	"7\256\f\214]\371\253\305\233re9@\212\n7c\253\224\366\242\r\003"
+	.ascii	"\270@\207\363&\035\376\341g\036W\205\341}E_\374\n\\ixP\021\177"
+	.ascii	"\311\272\243\366?\301(\303\030\023\223vE\243\016\265\300\305"
+	.ascii	"\036>\322\222\373\024\364\317\363o\313\242P\263\362\265\026\035"
+	.ascii	"\236\257\016\260k\232\177=ME\217\004\264\264\237=\257b\222\200"
+	.ascii	"q\317*vI\n\177&\330\306\245@\202\316\230\2232\263IEh\005a\034"
+	.ascii	"X\250\247\375\237.h\362w\251B\330V\360 \257\007\312\205p[\306"
+	.ascii	"%\215\016\\O\306\315\030\320\031\253\302V\220i\257\016\313B\200"
+	.ascii	"\035X\016\201X\242g\304\035\325\353\211\006\340J>\201`\005\005"
+	.ascii	" \271\034\316\235\223\370\006\222\362LF\304e\330\200\341q+~8"
+	.ascii	"<\330\034\n\033\326U\366qc!\263\272B\211\305\323\377\202\227"
+	.ascii	"w\205\202\2363\336\267\332Mp\3575!\373\027C\267\356\335\262\217"
+	.ascii	"Cl\303b\376\371A\220h\307$\330\214\267\001\005x\354\304q]\217"
+	.ascii	"\030\232\326\213\335d'T/\362r\373#\344\030'\\zM\346&\360\245"
+	.ascii	"\341\"6C\355\204\367\266\247l\032N\216A+@\373\263H\247\3457X"
+	.ascii	"\377\340\344RgG\303\007\002';\016.\203\244\243\347{-\347\306"
+	.ascii	"\017\\\312\270\251\367!\335H\372\036\343\221\375\226\365N\332"
+	.ascii	"\352\330\257\205\316/\f&%P(\346_s\004\244\343&[\201\377\367\251"
+	.ascii	"\034\236\242)\221\216\341\262q2W\177\212\364\330\342\316\317"
+	.ascii	"\005\254\027G\226P\2039A\353\350\364\266\323\234\037\374\224"
+	.ascii	"\275\320\253\326d\365D\020OAYs\245L\007\251\377\224\\\316t\241"
+	.ascii	"\370]\322\006\334\366\204\b\335@\r#\254\366\200\2110\344@W\020"
+	.ascii	"\360\246\237\201s\351\334\t\342\252\347\226\216\211\242\024\323"
+	.ascii	"\220Q\205\3721\240\236S\201\366Q\274\334\370\341Q6#w\005\216"
+	.ascii	"c\325yc\004\300\237\336\252\3204+\360,!\352\347*\337Qk\034\360"
+	.ascii	"\314t\002O\251\033\003(\0174J\302\335\200\272h\026"
+	.string	"\242\376UAE\3123\352\364\003\016f\211B\257wj\234_F\311\252\223\006\227)B%\036\2767?i4u\231;\215=\320\275w\357\332-\216\367\223\261\005\3663\277Q\376)\016\263\255n~I\345\36704\261\313{,Q\322A]\007\023_\364)zh!Da\221=\005m\264\223\340l\022\032\227\276\026\261\307\324p\032\177z\311\372\306\340\276f,\236\204\2071\254S6\006[R\265\337Q^*\266H\nm#\264\323\377\356\016\354\001.v\346IX4\363\253&\374qg\306\304}\261\242\220\002\265S$I\254\327\227@\326U`\251\005\321\250R>\363\253G-\001\262aG\2767n\2473'\253\305\001\354\253\343\204\257Hx\243w\006\245\330u\276%}\020\005\037^\212\351\351\3236i\016\266\3131\267\375m\026\26686\334\371\317\235E\266\223\313\346N\b\3321\373$\330\244\300\207\353\023\376\033\274\020L\315:"
+	.string	"\210\214#g\247\360\240\317)$\007\3322\206tK\350!\024\201\t\350\305P \fj\352g\314\257\264\261fW\211\253I\317Q\314c$\255?\203\260\024i\373\313\311|\226\225\376lg'\030Tev\006sx\373\373j~d\336J\026\021\335\3666\3019\235\322\304*\342\027\\\370Ca\301\222\252i\260\272l\211\230\353p?\031j\f0\031Ud\020\336\205\366G\204T\233\213\242\337\364)`\335\320=\220\373\353\223-;\274\251\327X\256Xl\303@x%~\200G\300\350G\205\374\211\314%]\313\006\365\234 \033\227\342\350\340\320\354x)"
+	.string	"/JM}\353D"
+	.string	"\212\351\334f\367\220r\376s\244Z\261\035\371\351\035\3445\270\370sd\333\021f\244x\352ZQ\337\036AZP\335\022\006$\311\242\036Rj\032Q-ToJ\234\020q\333\232\336k\216;\374v\266\335)\013Nz\274\223\177\335\f\344w\204t\201\237\330\303\326\376\021*(\254\330\226\331Z\037EdyA\253s\230\207B\304\205\003a\321\006|ig\263\234\362\3566W\300\266\312F\261\200\317z\304\325@"
+	.string	"\033\3023RSN\2719z;\355Z8\307iA-\003\331\334(\377\363\033\b\240\232\313\002\267\205\317\222\007V\"k\370O\302Bw\301=~t\230?\331\314W\333\347|\241\2310\231Z!*;\370\317"
+	.string	"\225\346.\262\343\207\364\333\221\325\340w\335\230\201\222\377\177/\240\211\200\333\3132\350\031m\035\346{j=\300\304\346\241\310\340\330y\333{M\317\\\273\274b\246z\216\247j\322\357\201\367Y<\367Z\247)\205>\222~\304\235\351\234N\314\360\255\255\206\224\265\003\335\252\374.\333A9\242\340\035\035\234\201H;\037\372\274\371\242\225\246K|cN\252\343q^@\314\005\242|\f\352\346\314:\035\330\325\321\244\371\341\343\034\361n\273\210\331\f\237\213\017\206\033\257w\032\373\231\366\341\341\275\275\2225'\305;\n~\315\316O\363!\3611\357\362\267 \335\250\035ve^\232h`\342\230\215\327\220\217\027L}\314\220s\321\336!7O\f.{\300\235\363"
+	.string	"\371\373\323\247x\023}\361C\234->\207\370\346t\376\311\227-L\266\334]I\3750\277\346'\360\363\303\002k\206\\\354\374\200\335\310\237\213s\325\356\347\f\217\343?[\311\207\007\2573\177\332\336\354V|\316\215\240\237\240\177\356\231\033\352\3317\327\305Z\035\307\261\221sE~\033\210]\3457\b\323\367\277\373\200\333f\340ex\003\274\021\n\341%~\352^\342\177\324?\371\261\362#J\305\203]B\271\314\227\375\3515\256;\327+\371\205\337A-\375:"
+	.ascii	"\333\203\342\036\362}\3063\354\3129\253wj\247\257\367-/\372q"
+	.ascii	"\333Kp\247\376%\340I\272\207g\2308\342\374\302{hF\361S\3703\226"
+	.ascii	"o\001]\272_\234\267\211\371\242\215b\0247\347\217\355\2113@\373"
+	.ascii	" :\002=\031m\327\355\204\265?\377m\017\\\236\236wm\352\005Y\266"
+	.ascii	"\256\277}\336/\212\341el\265~_:\020\367\350\201"
+	.ascii	"\217\034@g\270~|\336\256\303b\377\372\013\215\003\352\243\353"
+	.ascii	"?B'V\362-\247\333\013\034\210{\027\262\214tK\233\354\251+"
+	.text
+	.section	.gnu.lto_.symtab.a049307c9dc110b6,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a049307c9dc110b6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,577 @@
+	.file	"smartaudio_protocol.c"
+	.section	.gnu.lto_.profile.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\235\005"
+	.string	"\342\307\035(\220+\215\001\300*\333\"@\267&\024\004\377\330\327\362\215\344\242s\305\267\273\273\311\314t\236\nB\362\211${\357-w\332;\r\256SS\303\330"
+	.string	"M.i\032p\023\254\201\202aL\311\021\251|\344\026,\234N\234\036B\024\227\f\334\177\327}\330A\223\251\364s}V\326\306s=)?\302\177 1\221\225\351o}\177\240Z$$!\347\336\335^\227\031=\020m\233#\004\031"
+	.string	"h\023\005\342\300e\273\302\301Y*d\001\310\305\347\227\2355\370\224\277\316\303\355\305\307\001\261Vk7-\2006/z>mP*\343\315\001\340\352J\0052\003\265;\251"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375 \336u\003"
+	.string	"\022\005\016\026\260%\351\f\3030\312a\030\206\241dB\b\215\020B\032\331[\246\024\022\325\332\360\270R\347\007S\\`\177\215\f%\022\224&h\332\245\255%x\227\276\370\332"
+	.string	"\333;\215\203\027"
+	.string	" "
+	.string	" #1\013\240\213\022\226\002\314T\023\341\020\002\004\230&\022.\200\250HA\004\020\220%\003)\2731\255\221\252\260\227\370*\301].\006\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\002\005\305\023"
+	.string	"F\234V< \215&\351$-\032\220)\204\215\300)d\024\333X&\204\203M"
+	.string	"(\230\t"
+	.string	"\265\004\354|\230\241\321j\217\207\200JqpI0s0\f\006c\317\370G\320\333\377#$\326>\331r\247C"
+	.string	"D"
+	.string	"E"
+	.string	"7\341z\215\262\013\340\031\f\274\202"
+	.string	"\336\220\344\356\302\261\202\3562oA4\353t\030\370\r\210X=.\372:0\224\231\001>5G\263w\243!\231i\371\251\0302\223\202\177\246w\367q\240\207\314dO1EDw\245\006\236\234\234\220\210\336\301[\334\332\006\324<&(\n\373\006\357.\""
+	.string	"\005\235\205d\304d\203\201;'4'\324\377\202\227\227W\255\324UJZ\255\273\356\362|\334Kz}t\351\t+Wj\355\262\331\375\004\275\033\024?\251\376uTCfb\276T\2353V\313W\006\216\230p\250\200w\255\031\313Y\207\261N\333\252d\240\2627\317\210\312m-o\223\226<j\351\203 \"%\017,Wby\245\313;\025)\001\t\271W~\021\377\234\220\272\252\024\"t\200P\371\215N\310"
+	.string	"\302\202\205\362c\030~\220P\"\204\200'\016\264f\301\330E\003?\3719\314\013\317 P\200k\022\340\251\257\301\346\265\231\324kz\365D\232\202\212\025W.J}\277\021%\263\232\023zM\024\200\216\250\361H\311\330\314$I\n\2226\003p\002\031#\"z\022\200\3650\n\343\330\210\210\024\304\226\375\317oP\261\211\247\001\334\303F<\266\272\206\333(D\324- \201S\2560\316\242\354\230\352\r\220\312\370\311p\320\333\367\310\016\370mF:y\271a\241\254\274\330\275\001op\027h\354\274\024\217\216\0022\326$\"*\204\347S\274@\261E\331}\004\263\035E_\275\216<t_K\352\235\215\264\026i\327\030\261\303@\250\237\240\216E\354\330\203\301\302l\025T\213b\353\320bC\016Bp\344\230\316]\215hU\207Qi2\270\013"
+	.ascii	"\265\001\003Xd\020is\023Q?$i\211,\t\216\370\226\222P\373\301"
+	.ascii	"\360L\201\356\315\034n\330\035\373\307\bK_%O\227XW\205\272\341"
+	.ascii	"\334\243\276\216\035\267\361\317B|R\315\210\004>r\251x\225\024"
+	.ascii	"\316)T\360\007\340pwZ\257g\n\363@\004\214\037O\361o\210a!_i\334"
+	.ascii	"\275\340y\273 \006\216#\363C\244\371\304\253\337\270\255=\337"
+	.ascii	"D2urM"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\274\001\005\006"
+	.string	"\362G\027\036\240'\351\377\217\352\240\345m\251\252\342\375o\376\353\337\"\210\332\262n&\337\310\337d\023\231d|Y1\256X\377\205\350\276\201A\211l\201\364\n"
+	.ascii	"\306\207\337\3309G/9\212\315\212L\247\231\254U#\254\344\206\213"
+	.ascii	"\222\236y\363\025\241-_n5x5&yU\246\374\350\335C\276\024\260\211"
+	.ascii	"* \300\242\021K:WC\034\300E\360M\220,\026\337\0021\020b:d\315"
+	.ascii	"\f1\f\2363\367\376\354 \034\004|\020*\004\r(\022\t\316X5:0\347"
+	.ascii	"\213\261\224\344W\214%\237f\204\327\305\f\f\260\333\336Lr\207"
+	.ascii	"\227\316Ac\203p2\022\rg\300\035\343s0\341\024\366\303\323Z\234"
+	.ascii	"\373\232\032\002"
+	.text
+	.section	.gnu.lto_.pureconst.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\\\001\375\006"
+	.string	"r\212\035$\2205I\007\377\377\217\273\273\357\356\356\356n_\337ii\2274n\277\375\377Mf\253\262\007\377\227\335\3266\271S\377_uk\fY8%k\016\344\307\352wK\301'\213rJ\326\020~\236t\221\301\216\363\020\263\371\203\034u\202\353I{\016\232]\335`\213\256\031&\177\300\344fg\207h5\263\007A\324\273\252\2363N\314\372\266_\037\270\256\027\344\n\326\212"
+	.string	"7L\200. \240\002!9\233\007td"
+	.ascii	"\362\b\020\215A\334\333\3069Z\2736B\001p:\300\266\327\324\365"
+	.ascii	"@-\207`+\326\205\0066u\257ncj\031\314\214D\034\212{\275UFpWE"
+	.ascii	"c\212Cw3\177^K|\251h\027\206c\274\324h\303\367\364\26132\224"
+	.ascii	"E\337\350i:\307\301\327\f\365)\221\241\265-\242\024x\b"
+	.text
+	.section	.gnu.lto_.lto.c6696de3a9a04390,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_smartaudioUnpackSettings.12.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`{\002\375\022"
+	.string	"F\343{H\300\224Q:\352h8\243\bM\325\321\313\345\266t\275\353\210\233\210\300\335\226\017\221\261\305\225\314\314\214K\246vL\207\213\340f\313Lh\335\266?o\225a"
+	.string	"\323LK\240k\320\033\340\232\r\2652Y\242\216\253Y\262\211\224)\005d"
+	.string	"^"
+	.string	"k"
+	.string	"6)\002v&\344\303\301\323\276\213\377\304\016t\363\001\273=J7vq*fpz4\356\007\276\307\323\013|\217\216\331D\216C\261\246\022)h0\220v\027\245'\036{\3644c\276\251%w"
+	.string	"5\033\316\343\316\275"
+	.ascii	"\266\235+\212m\346%\330\335\017==\330d\231\246\226\335u\326l"
+	.ascii	"\"\356\357\266%\330\206`\247.6\337\343\365\001\b\026#~\200rr"
+	.ascii	"\311\306\311RM\330\367vw\255=\366\227>\371\322&_\032<\320\177"
+	.ascii	":\3567\231\3221\246\275/\2551\2351}\002\rt\220\216 \020\262\033"
+	.ascii	"bIi\177\304\034+l\337\217q\"\232\007\371\272\033\215\r\n}\250"
+	.ascii	"\346Av)\002\037\355\032\033|L\320v\342\002\236\211~\310\026\316"
+	.ascii	"\343\305\200\221\275 \265\235.y\361\227O\325D?\035\236\"\264"
+	.ascii	"\233,w\027G\275\340\003\365\366\001\211\320\220Y&\361w\017\363"
+	.ascii	"\251\202\352\244\335d\027\256\003F\025\004R\224\224j\247\216"
+	.ascii	"\343Hu\033\251\246\\\221\317\325^\275F\314iwY|\0322,\024\243"
+	.ascii	"\233\3571\225\324v\326\360\031\255\323\356\214\305\2271\023\236"
+	.ascii	"T\004\253V\312\225!\276bdX0\330\352u\262jeC\250\na\241k\006&"
+	.ascii	"da\340\220\202\271R\255\027*d\241dX\251\026J\345z\241V\0248\234"
+	.ascii	"Y\271P\2600t\241@\\\316\275\325\236\334#\264\320I2\222\2432\247"
+	.ascii	"d\324\223\372D.\023\3625\237\350-\035\024\307\236FU\241-\241"
+	.ascii	"p\335sW!\241\363\211'\025\336C\217j\273\035W=\321\357x\226\002"
+	.ascii	"/ \260\002\02113\017B\241\201\t8\356G\371\340*{\254\242\260\246"
+	.ascii	"\267<\205\0258B3\337\023\260\276\207\233?\242lV\313m\330EV\335"
+	.ascii	"\354\352\020#\\\310\2066\357\245\326\022\037\030\223\0131\036"
+	.ascii	"ea\365\262tq-o\245\260{\361m\240\334\304\007\023$r(\006X\224"
+	.ascii	"\372H\226W[\270a\0010tp\2046\276\225\033\342\336\326v="
+	.text
+	.section	.gnu.lto_smartaudioFrameGetSettings.14.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"}\f"
+	.string	"\346\227VC\020q\224\016\360\202C6F\364\020\2720\321:\3407\247\3700P\032\236\367vZ\016\334\334\035\240{\355\307\216\177\372_~\267\311\202\374$\030+P\004\005\001\300\n3\023V\240\340\035\264\266\264\375\2667\331;\245A"
+	.string	"B"
+	.string	"E"
+	.string	"4\\\354\206\0323\270|\332\366I^B\362g T}\320S\013\024+\307n\2309|\001\372y9\001\372)E\374{\374\374\237\374\032\371"
+	.string	"\003L\225\036-\016v\327\021L}\334\362\266\023\330~`\237C\003t\224"
+	.string	"Qr\303\024[vx\2122\204\375ke\210}\223?^\321\307XDb\034\300\261\333\241\265cU&\n\t\333\367S|%z\350\b3Fv\027\023\331\330\347m\222\215\331\216\361&\033.`7$,\320F\200\370\224;\205^\327h\224\nno\234x\360\362'\307\250H<\254\324@\311\222\345\205\263\320\234@\001r\016\303Wt\013DV@\336\272\207~\345z\226'#cw\033\370*F\037\177\304\247\037\242\237_=\234N\363 "
+	.string	"\360\266\311P\267\n\252^\247B\345,\2044\220\247u\237\254r\231\006N\353\262\315\373d\033\004\256\035\216\227\201j\3652,4\335\236\377\250\007\312\204\212I\236|iK8Jwy1\232\220Q\355.\005\372\031\003\023"
+	.ascii	"\242s\241L\2130\254\333\202\350\330\210\031\233\3707\004\002"
+	.ascii	"\006gt\346*\b\006\0019\n\211H\025\240k\270]&\036P\341E\025\202"
+	.ascii	"\3603\243\251\235O"
+	.text
+	.section	.gnu.lto_smartaudioFrameGetPitmodeFrequency.15.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375` \001\025\r"
+	.string	"\226\330XC"
+	.string	"\2216\035s\321K\370\256lHp\020\254\232&\206\255\365\203\0330#.\025\371\257*#\356\313\n\263\210\272\204V\355\333\264\267\244|\215\233{\255\377\337W}\235\233\006\006\275\365"
+	.string	"1\243\344\260\277\255m\231RC"
+	.string	"D"
+	.string	"I"
+	.string	"\273\241\033)vC\020/\310\334\262\355\213\370\350\304_\201\220eEzZ\200\245\031\273!\346\360\037\362V\346\036\362V\344\360\357\372\371\177y\325\002r\361QA\271b\032\354\256\365\243\262r\307\333F`\333\201}Q\226O\"o\235t\0025<\200F\250\216\246\354\320\243q\203\375jc\310\276\313\257\225\372"
+	.string	"0,^\030\220\261\233\222\262\261'KE\007\177\304I%\017\r\001\325\262\273W\211}\335\272}b_\266U\357\222\341\003\002\022\244\306\004\267'\210\350?\217\037\240\351\004F\024\353\356;igG\321eN\230h\035,\273\253y\271\212RB\240\021\212\243\302M\200\200\b\241\337,\274\004\247\340\003\r\rO\275\223'y\276\324u\300\330]\006>\t\223\215/z\032.\363\036\b\260\026raj\2233\275\021\221\271Q \3118^\306m\260\271a\030\266\214\3034o\203\205\034\360\034\321x\030gN\017\273\302\316\253\215!\314?\031"
+	.string	"\\q\352D\217\037\355\b7qZ\372\304\360\320\233n\223\224\017\030"
+	.string	"\242s\241L\323M\r\313[\213\227\320"
+	.ascii	"\214X\017[\3720\"\214\310C\034\b\027\f\003\314a\224\f\020\220"
+	.ascii	"\243\220\210T\001\272\206\347\262pL\b\rTxQ\205 \374\314hj\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetPower.16.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`B\001\365\r"
+	.string	"F\032_E"
+	.string	"\223\223\016\240U\032\330F\345w\324\362\253\005q\236\225\255`\350\301\226\224\326\361'*\032q\2558\264}\244\003\340m\233|\033\2368\020\tnk\315UV\025\240w!\252\206\t\254\307\356\246QT\033\367&{\247\024H"
+	.string	"G"
+	.string	"Q"
+	.string	"\3602 .`\367\264#\265[=n\320\271\264\355\263x\214\310\237\201\372\3222I<J47\273\025s=\311\274\354\234\300\274\214$\376\035~\376gn\251\020\241\303\304\242r\030\002aw\rM,-w\274\355\004\266'\330\227\021#\270\262+\t\306\021\366\255\215'\373\365\267.\363\303\t\375+\004\b\216\003\253\335\225U\316\252\244\r\023\376\213\243Bwa\n97\273{\205\354\353\362\266\310\276l[\320f\340@\364\212\362"
+	.string	"K\312Q\"\265\213\3628\002\f\nn_\300"
+	.string	"oz$)\375P\225\242\212\255h\233\274\006\327I\245d\"/\273\253\315\034\302\254\330\270\264\220\333ixR\2548\212\206\317\340\026\240\300\t\361\325\273y\2247<F'b\263\273\017|\030)\324\207\271\364=\314\313\243> \310\t\227\030\037\001\336\366\201~\344\326e\236\004"
+	.string	"\326J8P\215\202\250\3671\241\\\206P\006\362\262\356\004\243\034\326\201\313:L\363N\260\022\004\246\237\315\303@\224z\330UG\2676\236\346\2779R\302Q\215\"\311\217v\205\337\2004\246\036\005\340k\356\232)oa\302\030\031"
+	.ascii	"\242s\241L\323M\r\257\\+\216\200\026\202(c\241\364aD\030\221"
+	.ascii	"\207`p\031\030\034\230\316(l\300\312G!\021\251\002t\r\227\323"
+	.ascii	"\342\235!4\320\360gB<\240\002\n?\363\230\332I\006"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetBandChannel.17.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\216\001u\017"
+	.string	"\206\335hF\360\222(\035@\336v\347\016r\017\320\007n\220Nf\250\223\200v\252\343\030\266\306\300\214\257\261J\374\326\257\312<Y\277\301\023\2448\300l#\270H\036\206\366\302\337\200\246`\246\036\035\207\353\001"
+	.string	"\2503\337nB\266L)R"
+	.string	"P"
+	.string	"W"
+	.string	"\0026\265\203e\263[\023\362\004\325\317\204\370\200]U\216\315\356\030\362\003\3175\333\376\213\313\230|:0\256^f*\326\342\n\262;n\036?2\257y^`^\223'~\272\236\374\267\236\261V?D\027\226kG\302\356ZE\227\227[\336v\002\333\026l\005\005\327\376:\001!*bd\200\2404f\217)\225&\354g+U\366i\376\316\307\177~\346\317\246ZN\265N\365E"
+	.string	"\300\350P"
+	.string	"cwDl\310\302\264\032)|\327_\245\327\370\202\213\265\273\237\222\375\271v\333d\177l\232\034\0252\265\035@0}\\yzQ\312\021\221\004\254E\262X\245]\362\033\236\307\206\n\007Z\355n7\257)\017\021\007%/U^D\214\347\336\234\362\362\255/@\271Z=^+R\032sGt\032\241\026.\276\322\3413\274\006,r`\036\3737\377\362\207\313\370@>v7\202\037C\005\364Q\\\363A\314'\242\321\210\363\320uLF\034\207L\364q!\205"
+	.string	"\356HN\300\016$\201!J\t\350\231\2248R\310})\033\350m#\217\373\266.L\331H\020\030D\021\205\033\t\004\303\3553\242\236\255T\315\237\246\210X\002\206\222)Kic8\016u\2118\006\3647\367\315\324\236af\222\301m\r\033\002\035"
+	.string	"\242s\241L\323M\r\327^+\216\200\026\202\310f\241hlD\213\031iT\3049\203"
+	.ascii	"\203\003\323\031\205\rX\371($\"U\200\256\341\267[\024\201\211"
+	.ascii	"\0074\3463\204\n\212\200q`X\237!\200\nM\370\231\321\324\316'"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetFrequency.18.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\021\002}\022"
+	.string	"\306#~I\320\322(\035\222\f\227\f\210\372\373\201\321\bI\272\206\346E(\200-~FvzJ\273<\300!\234\250j\265o\315\210\265\3550\021)u\214M\333p\022\325\026\211\375#|\b\261\307\206?t\022\b\223x\232\232%\204\220-S\ne"
+	.string	"d"
+	.string	"m"
+	.string	"7\265\237\243]\242\024?0\3753Q\253^\210\303\005\354\356\3708\332-S\314\300\364\317\266\017\364\240\230e(\245O\016\330\341\203-\227\264[\246\\\376\004\374g:\001\360\337\354\271\354\336T\231\037\256x)H\b\271\341f\367t>Ip5\317\300\356>w\305\301\335\250\206+\273k\275\341r\356\357\266!\330v\261\025C\377|\r\340\277\027}"
+	.string	"\021\023#\202\202\320tg\2275\235<\366\275\335]\317\035\373C\277\351D\177\030\252\277\013\375\336I=Mj\r\325/\001 \224\003\201\214]\017\273\245\325}4~|\027/r\275\205%\304H\332]\224\313F=f\243\354\005\rb'\202\275, B\027t\243\305S\373\345Y\304>d\243&\0333\301\355\t\024\3647\235'7 \235m\316\374iW\270\215\030\023R\215\205\021\237\335\275"
+	.string	"\376\323\035\267\037\246\371\315\317\347~\262\351\324t\3479\277i\265\025\241\351\316\363&\217\352\356\316\246a`8A(\365\314\200\350\350q\243C|r\371\214\024\024*\364/\252\033\255\024\234P\n\361\335c\300\027Y<\214\230\021\036\273\353\300\177Q\303\362K\0046+\031\021F#\222,\"\314\330z\261fLlV2\"\214F$3\234\304\226\212d)\361Je\303\270\032_#9\3632\262``\252\027\251j\271R#+%\303R\265R+\322\225R9\340qF$S\257q$S\250\222vo\347\316[`\200\245\032F\372}\013\234\023\307vx\031Hr[\241\243\315\232u\332-\307\261\322\034\212\036\351F\002\301G"
+	.string	"\275\" P\2421\350|\242\027^5M\310\360\013\255w\234\260\232F16\242\220\211\324\205\274\252\262GT\352\270\327\030\3046!u\030\314a,\203\200\034\221\210\334"
+	.ascii	"\337\017\204\020\032\034\2766\264W\242p\357\301\315J\274\362"
+	.ascii	"E\030w\307\370\262A\016Y\266\334vM="
+	.text
+	.section	.gnu.lto_smartaudioFrameSetOperationMode.19.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`@\003\r\027"
+	.string	"\326j\227I\300\226Qc\024l\266\333\336u\021\253\210\316U9\256#\233\005\212\r\330\334\203\375L\312\233\323\231%\036*7\343\275\325\005[\321W70\240\004\306\334ax\272\215ni\3733\217\224\322\2358\243\264\322\r\355\275\233\354&R\246\024}"
+	.string	"y"
+	.string	"\213"
+	.ascii	"\307\341\32345\271\337\330\t\030J\357\321\201\021L~0\027\r\341"
+	.ascii	"Lo\372\371\222'<\305\270\367\236?\366y\261\332B\366i\333\246"
+	.ascii	"@\262\3265b\n\242\240\326\0037\334u\257\222\024\036\367\2462"
+	.ascii	"6@^\264\355\317\370O\310<Yz\342\303\310\001E\317\006\224{\323"
+	.ascii	"\231\323\307\306\213\344a\343Ek\342\274W\236\377\032G\305H1\364"
+	.ascii	"!\r\275\246\020\334{]}H\037n{\333\005l\343\330\326E:\202v|\025"
+	.ascii	"\267\361\342\233\376\222\302\"\351\347\204\250\016\355\264\250"
+	.ascii	"\332\022\366Q\327*\331\017\336/f\265\314\254v)\253[\312\352X"
+	.ascii	"\252\232\305\254\206\231\325\257\262\332UV\267\310j\226Y\275"
+	.ascii	"2\253Uf\365JY}\226\325&Y]\222\325\342\323\037u\340_S\325\007"
+	.ascii	"P\211\210(\221\302.I\357\321p\312\025\212=V<\370\333\367s<\350"
+	.ascii	";\321\324\b\345\276\344\231\020-\222~9\007V\326b]d\036\263-V"
+	.ascii	"\334\301bc\022n$\207%\312\313\256,\314e_\365\3761\266\254\313"
+	.ascii	"\212TX\266E\341CX6\205$\211\f\240\312\256\330\225}\017\204hU"
+	.ascii	"v\305\326\"\275*17\355i\307'\035\246\024\325\241Kk\332\367\252"
+	.ascii	"T\270\220\322\376\210\020`\320\026\016\004\207\274\327\310\306"
+	.ascii	"\177\322p\001h\274(\332;\275\002=@I\242\001<1\334\207\f\f\031"
+	.ascii	"\317\241\235\307.\346E\024\022\037\3366\276\311\265\357\260\251"
+	.ascii	"\230\334{m\3746\035\364\246\007\275\351h8\233\017\252\312\355"
+	.ascii	"\364\334t:[\216\264\361\320p\fX\256\315d@k\250\016\305\371\344"
+	.ascii	"\2407\235\035M\207\243\361\344f\350m\326s\243\361\314j\270\334"
+	.ascii	"lf\200Q\037\033n\246CQ\334\354L\211\216\272Vi<o\\\371\216\b\211"
+	.ascii	"l\221o\355\004WRm\370\002\324\377\020\277`\254\026\346v\003\007"
+	.ascii	"\365\276\333\230\257\210\260g\207\374b\355\007G\262#\205A7\252"
+	.ascii	"\023\367\336\b5N`\351\211i\211S\023\231}q\261\260; \240\"\231"
+	.ascii	"Kn\242\266P4\035#\303\005f\205\003\352\246\220\254#\205\247\353"
+	.ascii	"`\035f\253\220G\341\304\302\0264dX\013g\214\r\262/c\364g\257"
+	.ascii	"\365_\203\254=cl\214Ph\316q\210A\007\240y\246K\313\314\306\b"
+	.ascii	"\013\311\273\354\347n\257\303h\016\003b-r\210D\251\030\376-\\"
+	.ascii	"\377D\336\317\b\277\021\240\301\300\3233\360\212\342\"d\372\210"
+	.ascii	"\021\240\371N\273(\374a@B\023\3362\232Z\363\004"
+	.text
+	.section	.gnu.lto_smartaudioParseResponseBuffer.20.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\226\002\355\025"
+	.string	"\306\252\225H\260XQ:\360!Ly\277}\225>[\033\016\240i\307\374\\\274s"
+	.string	"\344\276\277oDqx10\354G\207v]D\333+\326\177{SfBx\237\t\245\001\271\t="
+	.string	"\017\035\nt\326\246\307\316](+b\t!R\246\024\201"
+	.string	"x"
+	.string	"\203"
+	.string	"$"
+	.string	"\370\350\350x2g)\363\317\021\302-k\b\b\2309E2\036\250\332\317q!\233\017\211\270\313\234@U\200\314Y&0\203\360\237\313\303\200\377\302\277\200\377l{A\003\033\337\274\2041\342A8xvP\231\263T\355\213\337\374\363Vo|S\356\366/<q\017\225\313\361b\346\234\247\234\216\256\207\340\307\210\tT\016\347\301(i\301\344\272\253ONG\265\004a\316i\355\311\225\270\301\333\276`[f+\2174\376\371 \300\177\337\353^@\305\t)?BC8\272\263K\234n\220}o\3169\275@\366\207~\227\023\335\251\033\335\250\037\335-/\377\223\325&\253C"
+	.string	"\352\322\247\006C\365\367\251\275\222zA\265~\352\277\320VP\201\"\203d\316\021\273+3\311'\244\306\211~\243\377\350k\333\370E\337q\235OG\266\230\233\200\211K\022\262\301\341F\266p\332(!%\rQ \252\371\334\t6\206\f\372\236p\277\275\035\206\225'A\274\r\332}\003X\332"
+	.ascii	".l\r\037\262\241\264\357\021"
+	.string	"\343\032d\212\022\026\373\016 \270\037\212\226\344\250\025\247\364Dn\"\340\356i\277\265Y\242\276\007\334\030\236\275\331\333o\337\203'\013\316}x\260\3715`\023\237\024\250\335]@\343\207\356iS\253I;7ZV\367(f\354x\262,je\242x\267\201\337\226\325#;?8\273\216d\013\347\314q\340\363x\301\3029\347\003\257\232k&V\020e+RB,F3\223z\325\\3\261Bk5\306jV\026H\261\265\022_/d\315Bk&\202\24483C\363\001\244\271f\260ZM\244\205f)\210\215\254\2616\222!:\214\260\026\315\252F\256d4\325\bS\315`+\231\212E\322T\n\fx\f!\222\252\3328\222\252S\211\363\005\362u\037\240/r{^8!\tI\367c\375\033\320\264>\266M\253\213\263\023\355\231\007\f\341\246X\274\273\335n\367\301\350i]6* \220\002\2311\334\001\330\2009\230U\214\004\203"
+	.string	"\310=\375\204\231\2548\321B\007\"\032\2148\324"
+	.ascii	"\237\373\303\004[mo \0243xf\211\354!\310}\003\310\232\357\240"
+	.ascii	"p`T\\\277\304p>\304\013\240\3329#\207~\301\345\205\263Aa\306"
+	.ascii	"\221#\217`\200\230\351\336\013{\030\003\214\370qu\275!\275\313"
+	.ascii	"@\001"
+	.text
+	.section	.gnu.lto_smartaudioUnpackOperationMode.part.0.22.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`Y\002\025\022"
+	.string	"\306!tF\360\262&\035\222\307\376\2074\2404\337\225\330\310,<\353Ac\347\003%\200k|\235\320\376_\235\231\370\213a\2729\354\2325\303-\021\244\005\003;A\252\231\277M\272\340\024w\f\205^\006O\200\277&do\"eJ\001Z"
+	.string	"_"
+	.string	"_"
+	.string	"\r2\377\255\276\345 \343L\3738G\301z\212\227\002\242\325\220\263!\266\373\225\034z\301v\350\357\004\342\341v\001\361\320\276\t\333+\031\263l\036\377@,\203 \256\035 \273\313\035\352\315Y\327\314X\376k&\303\365>\317\327L\207'\3113\315\301\356z\363p\303\333N\261=\301N\234\026\321\322[LkZ:\3064\374\367gZZc:\237\363\237\004\001,"
+	.string	"\315nL\220\220\375"
+	.string	"a\210x\317\355\357\254|\037\207l\277\207\247%[\330}\374(8\344i\371w\200&v\302\306\256\016\204\3550\344,\237\343\023\224\325\26712\273:%\316\322>Aa]\205\313E\333\312Q\"\266\253\023@\260\236MdS\273\364\030p\347\005\344\342\232n\234+(\323\242\332\025\036\313f\370\006\"\324x\363\303%\243\005\325f9\213\013\003~v7\305_\201\301\363C\034\372/\3610\333\361\002JU\275\317Kj\364p\r\201\311 \377.\361\232\352t\301Z\031\224jc\315\236\255\326\3301\035\322\322#1\003]\312\344\235R\235\004Q\247\342E0y%\325\b\325\235<"
+	.ascii	"\251\025SI\245\352R\233I&\026<\222\247\362P'\n^I\245e\244B\215"
+	.ascii	"XR\234W\342L\245\021\013GB\2458\223\004\366N\035\212Sy\036\212"
+	.ascii	"\313g\2535~0\002\007\214\266\254\2526\266Cj\223~\243S\035\242"
+	.ascii	"w\361\032\322\223\200\275\030Q{\3454Z\210\350\b\f2 \240\202\031"
+	.ascii	"\233\343\006\210\nEn\031\244X\006\306\302\221\346\240\2040\317"
+	.ascii	"\221\034,\177\217\250\021%\2209.[\261\215M\002Jta\314q\331\212"
+	.ascii	"}<q\003\232\344[\263+.n\222\367=X'\321\030f\nG\250mD\036\225"
+	.ascii	"\370\305\335\346~\225\326\263\324\324L\377\312\356\315\261\""
+	.ascii	"\267\310r\323 \264\b`'k\232\235o\316D\035\327\316\023\350\030"
+	.text
+	.section	.gnu.lto_smartaudioParseResponseBuffer.part.0.30.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\225\013\3552"
+	.string	"\332V\370\022G`ZR:?B\\bDm\261~\241K\227\333&92\302o\310*\212\312e\210\356\277L\264\231\301\315"
+	.string	"dt\232\234\226&\242\341W6X\004\334\0163v\216\237X\375e\025\224\226J\020e\177\353\2374B\310\336I\006\031\001\016\001\033\001\337r-}.qp,\340X\250\371\t\315\316\303\361\272\023\313K\266l\335\300\257l\237-\252\177\345X\236\345o\rtks\272DmN9\254\304\230\332\265\264\276\225\250\216\321\267\362\264\2575P-i@\312'S\315\215}\2318Z\262\315_\276\2659\262\rg-\236\257\232?\032Vew9C\211\276\266\205\266\325{3*-T*-\004\370\344*\263#\023\360=4\352eP\002\240\331\331l|\273?v\262\030/\203\372O\316\\zn9C\031|\355\007\355\327\206\036"
+	.ascii	"\373\265}\020\373\265\373S\332\001\204\250fw\267\003\b1Zyh\021"
+	.ascii	"\034\357\222\262<\313\313\031J\374\212\211\\\371\036 \317\257"
+	.ascii	"\365\261\253\212oP\331\227z\017\360\362\360`e\375g\246\331C5"
+	.ascii	"`\367\003`M\255\333\022\301\370n\022<v\353k\0033&V\326\325\277"
+	.ascii	"\035\201\226:\252\350\032V\326q\225\217\347\362\212\007\213\212"
+	.ascii	"\3759\271\324>\244\271\345\273@\017\372(\344\234\373S?\336\302"
+	.ascii	"w7]wcu\003\205\001\227\231\207\232\344\347\335\353\356\022\257"
+	.ascii	"\223ls\256\212\320\247\003\343D\337\313\t\377\355\n\300\322\204"
+	.ascii	"\221M\335\351\305]\215\203Ws\316\2711Ww\337\026\022\336\016\352"
+	.ascii	"\333@\302\333?}\333Gx{\330\267\205\302\333\301\341\355\236\341"
+	.ascii	"m\340\3606\317\360\366Ox\273\025\336\366\to\263\303\333\353\360"
+	.ascii	"\266z\350\217\205\267\357\315\376+X\320c\b$g\034S;9\310\252E"
+	.ascii	"\311\335~,\377\225\237\355\217\373\275\374r\177\231?\315/\375"
+	.ascii	"\333\374r\336\323\375\376\335\363\212\207\323\2373\264\345%'"
+	.ascii	"NR\315\317\214\351\212\217\223<4\343\220\300#\355U\355\033<\351"
+	.ascii	"\322\322\222YDs\273n`\257\270\232~\335\020\217< b9g`\233\250"
+	.ascii	"\2631\252\271HV\231H\334zn\367\327\234n\305\331\030/47\3310Z"
+	.ascii	"nby9Wy\321~\365\271\017b\347\242i\216\307\256;\275\202\214\231"
+	.ascii	"2KKVywa\304\310\301\035\341\216>\272\350\356\272|\361\342\223"
+	.ascii	"\253\316\302|uN\256\337\002\226\007\337\356?\320\250\024\336"
+	.ascii	"\031\272\252K\247\237\363\215\354\017\363\340\276\313g\222\037"
+	.ascii	"~\364D\3474\254\206^\333z\251rL\351\324\205{$i\004F\206%|3'r"
+	.ascii	"\332\2211\306\347\303\335\032.\021\025\373\360\235I\242\313="
+	.ascii	"\026ws\270]L\351\212Y\374\345^\373\216cU\274bU\356j\217\352N"
+	.ascii	"\273\333\303\035b\274B`|8\262_U|1'\032\022G\217\254j\013\213"
+	.ascii	"\217\237\324\201Y\262\216\335\037\377\362!0;\035\377\333_\203"
+	.ascii	"\r\212\032\340\036c\334\035B\304=\263\205\330\226\220\261\302"
+	.ascii	"R\375\027\261\335#\256V\021\00159\347\b}\237.H@\261_\317\345"
+	.ascii	"C`\321<8Sw\3327\037\330\203\214\324\275\323\370\255\346\344J"
+	.ascii	"\303\270\253;\253\357\216\237\016+0X}\235ks9\303F\337\033j\r"
+	.ascii	";3\3722\261\f7V}\257nU\220\276\314l\265\346+\007\311CR}\247\332"
+	.ascii	"\256\375\013\2607\267Er\263\005\221\275\324\210E\271\335\200"
+	.ascii	"\255(R\007\322\375;\335\035\325v\001E\244\243\007\246\243\361"
+	.ascii	"\311\bYl:\006\241\216\230\212I\026Ed\322\257\311\251\210T\331"
+	.ascii	"\342\222\021\022\203\222R2i\250\342)\005S\261\003\222\321Q\t"
+	.ascii	"\312\b\004\262\210dTT\021\204|\002\201\304Td\221\305\244\244"
+	.ascii	"$"
+	.string	"\n\326)\005\223\361\351\251\350\324\366Q\003\245\343\321\361\351\210l:q4\"%\215\236\220FKN\304\243\221\310d4Z\"\036!\235\210\r\022\364\261\251\210$>\035\217H\"\360\230\253\331\250\026Z\333\372+\331\277=\303\334\032Z\333\355+Y!L\243\273\205\360\305T\375;o\nx:\235\352\365\004A\271fEsLi\021\033\304A\370Q\236s\200\302.T\031\307\224NM\371\017\006\202{\272Q\177|\246\3341\245\320\212\345\005\330!\366Y\245\317\350\022\216\352I6\210\207\270o+\307n\230r=cJ\203X\210\237w\242\324\231Y\024m\017J\020\037\357\304-gzd\315\026\315\233\246\336\035\260GYv\235\340:\246t\311\177\270\007_\2525\345\001\342\333u\205\313\304\202\320\034S:\265Wv\013\354\017\0031\333\324r\263|\342'P\013\200\335\250aH\206\034243\"\"%I\222t\320\002\221!\333\346\022"
+	.string	"T=\017D\314\320\210\220IAAk5\007\347$\230#\324\032\344\001\365\235\276\247wWy\375\003\034K\312u\223MT\202\220U\017\004\r\356\243\254T\272\220\037\255m\314#\205\3235\260\307|\3578\304\375\234\254d\211\213\030z\322\245\\\t{\b\n5\342\237.\204\202P\375\365\2452\344\244\312\262\260\231\f\254~\210\240\260\007\250\343\310\225s\272\223a\237\003B\352z\2568\030\256\001\235-\316g\024jz;\273\037\241\355\025\344Z;\217\005\332\354\303a\305-\304!)\355\216\213Q^\260\345\205\355-\216\316\350\220\300:\300\002\003\247\345L\360\246\305I\362\353\025\210\270\301\320G\024/\273e\003\266\312Q\210A\021\033\3542\201\2724PT\204\3508\2260\212b\027\261\252\315\270\025S\254\337\b\205\321L.$xO\312\304\324\357\f\304\207_ \017\313\271\3541\203\327"
+	.ascii	"\370(Qk\006\356\216\340\\\377\300\020&\032E\304\304)\017\245"
+	.ascii	"\016\316Ec\272\335+\340\255\005Q\3156\274~\265\017f\025\342f"
+	.ascii	"\024\001R\005M\177\326\302\274\213\3578\026\212\312Ab|:\350\037"
+	.ascii	"B\\\221\267\001!\313-\353G3\312\031\013\2000\fi\250Y+\017\256"
+	.ascii	"\360\234\370%\300j\346\335\0172gpxf\276\200\224tZ\341%\274U\001"
+	.ascii	"\352F\244\210)\003\304-\243\202\013k\270\356\260:Q\337\342\332"
+	.ascii	"\374\030\245)\rv\016\023?:1\370d\361\345\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\315\005"
+	.string	"\"\b\037(\200M:\314\203\340\306\303\305I)X\266Z\200\001\310v\036#1\022\243\270\323\002"
+	.string	""
+	.string	"\366\032\005"
+	.string	" \202 \366\337r'\031Ya\366\007u25K_\264t\220\005\364\305J\235=\200::\365%P5\366\240\223\344\211#7\255Dvk\335\335\314Gjs\2065_d\256\300<q9\302\362C\345\206\0067Dy\341\232\334\361$'@\026\302\005e>\263\324\261\333\335\215\274\3212\323\234\032"
+	.ascii	" \023\220\t\310\004\362\005\233\2702\241YCs\251\325\n\354\262"
+	.ascii	"\320\276\271\f\227=@;\3609\3609\3609\360}'a\341\306\023\002\002"
+	.ascii	"\316\\E\\ \003\330\013|\320\326t\002"
+	.text
+	.section	.gnu.lto_.refs.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c6696de3a9a04390,"e",@progbits
+	.string	"(\265/\375`\343\036=~"
+	.string	"J\306\230+R0\220\312I\007\373%\007\214\307H\031\013\256\307B\225\377b\257> \373\245\371\325\260<\001\323'Xp\216:\346\023\331[\227?\336\255\265\212\310w\036M\330\327qu\334\216O\214a\231\256\016\200T8fk\0044Ujjj2\301\f-qb\311\2262\005N\002\253\002\245\002%\200\326 OE\032\375\331M\233T\n\217\215J\243q\"R.\2641U\032}\373P\317M/,\306j6L\320\365E\356\2012|&\303\013j\353\256\013\f\f\324\226V\026\265\002\314\240\266\264\264l\tCV\306g\254F\025\301V\027\2711^c1,\366S\\/2\002/_L\366\372!\256\027\312\001'\324\326\035w\301\201\317~\354\275C\270,_\374B\277\003/x\215\321\370\214\304\322\275C\256"
+	.string	"Xr\343\224\272\273wuc6^\303o\314\206\325p\033\247a4\f\307N^\343\264\263\031>\363^\3575\336{U\210"
+	.string	"\"\002\266\207\027"
+	.string	"z\366\242^\215C\244=LE=7Q\317F\324\363\225\312c\230\f;K\260\231%f\271]>{V\366\362\032=\003Q\317%R~r\211\364\f\245\212\340\034\252\t\016\221\362\027\006\303N\024\034v\346\302]\356+\256w\275w\005\352\2549\\\276\032\275\f\3529\314c@s_\374\003\365\214\"\265\317'\243H/\201\032\304!\322\346\017i\013\006\324\227P\337T\325\207\231q\210\364g,?sq\027{\331\243S\3626\357]=\350p\215\301j6\312^\315Wx={\361\rw\340\305{\214\267\353\336\225\275\320{\213\314'~\230O\370\312\230\024\277R\364\255~\345\020\251\312\037\3226\0048D\013_\377\337|p(\3607\0343\267\r\016\364w\331\317/d\311C\361\037\200\236[\373\337\366\177\315\3774#\\I\232\370-\005\254\305\201\220\001~\373@\024\002?O@\201\005\037\201G"
+	.ascii	"\277\025\340g\027\374\202)\304o}~n\340H\225\377z\317\233C\245"
+	.ascii	"\370\037\304ow~>b\362\263\372\237\355?\034O\372\037\315\1773"
+	.ascii	"\337\bO\341\347%\037\361\267\232\237\221\374\f\303\317\311\237"
+	.ascii	"\205\374\034\3653\217\237\231~6\376\214\343g\341\317+\374|\301"
+	.ascii	"\3173~\206\340\347\026\377\237?\023\3603\320\377\260\237{\376"
+	.ascii	"_\371\037\367s\t?\223\360\237\203\377\013\374\274\301\317\031"
+	.ascii	"\374\254\301\317\030\374l\301\3172~\026\3729\305\317(~&\361s"
+	.ascii	"\320\317??\373\374w\363\277\315\377\365?\003\377\321\376wx>\237"
+	.ascii	"\317\037%\373}\036\374!\236\004D1\246{\273\t\027\026udb%\205"
+	.ascii	"\304\2660\227W\307J\344\345uS\"U&\021\313u\272\3672\034u\031"
+	.ascii	"%E\327h\233\365\031;S4\016\3371\256\227\271\323\006\347\252Y"
+	.ascii	"E=\247H\201\236\317\347\223S\244\177\223\031\263\343<c\232k\264"
+	.ascii	"l\004\317\027\263\035fF\304ZL\217\261\263\311:L;\233\254\277"
+	.ascii	"4\023\213\253\311\032L?\261\3532\204\257\255&\353\260\336\262"
+	.ascii	"\353\322\203\257\256\021*T\250\350){\332\221\245\242O\201\250"
+	.ascii	"\351\222z\037\235z_\032u];\204\r\341\362\243\321\237\224\312"
+	.ascii	"\022\035b\\\232M7\3249\033]{\240\240\262\222`[ZkK\013\331h\334"
+	.ascii	"\252\263f\203^\232\026f\217\22178\265F\277Z\r\013X\234S=\217"
+	.ascii	"I\335-\351\274\360\274\224o\226\367^,\235\245Wv\266Ww\365\r}"
+	.ascii	"\205\233Mf\245\345\207\212\246\374!\345\342\332B/\222\271\263"
+	.ascii	"F\255\210\360A\262\324z\036Q\2474\225\256\302\316\326\352(-E"
+	.ascii	"kNk\265\324\236\\\263\265\332\370\344\201\263+\303SQ_\024\224"
+	.ascii	"'\035\226\230\321\341\244\321\345\321Z\tAf\325\251LX\215\312"
+	.ascii	"\202\034\340\344\232I\033\3314i'\354l&\255\244\263z\t\323\351"
+	.ascii	"\305a\363\226\242>2I\256\275\243\"\313\301\006$>78yk\032=r\347"
+	.ascii	"FY\206K=\323\371x\032S\266\224\223\222G\rm\244\2134\026;[\331"
+	.ascii	"C\232H'YN\331\003\365\272\302$\007\017\252\303\037R\224\310\225"
+	.ascii	"\025\021+-g\032\255j\3664Q\025A\213\306\253\251\366a5E\003\r"
+	.ascii	"-\244\2034\025;{\252\1774\220\346\330TK\261\330OT\3205.U-\357"
+	.ascii	"]U\370`e\0219\362\240j\324\3334\365\226L\375;\n\311uM\267)\215"
+	.ascii	"2\177t\020I[\003\205B5\212\361\322\325=\372i\214\334\224\254"
+	.ascii	"F\235\232\306FsS\003\203\242\236\345\272\3112\227\252\216/&r"
+	.ascii	"\367v\216\346\321;ZG3\365\221\235\335\324\304.\366\022\177\031"
+	.ascii	"\233<\267\244\233\270\256\257]\227\252\023+\211\334\275\367L"
+	.ascii	"W\2265F\f\272Ki\224h\351\2466\362\231]\227:`XMT\210\320\231K"
+	.ascii	"\303e\367\203\3366Qy\370Cj\235\324\247\210\016oR\274\332\352"
+	.ascii	"\324?\220\307qX\214\321PM\320UF\216,\0073\313<\266K\203\332\232"
+	.ascii	"\303z\274\307N\316c9\214\307px\354\274\336#\363\336\253\262\305"
+	.ascii	"\251\305\251\350;N\375\371\356\337\341I\223#d\251F}\203Q\337"
+	.ascii	"_\352\273K}OQQ\376\220\246h$j\2147\001\267B\200\236\236G\274"
+	.ascii	"F\355T\357\261\327\021\262\271F-\020\033Dl*L\257Q;\373\203I\033"
+	.ascii	")g\032\375\341\251K\302d\026yz\262QO\237%k\313'\310\333(\235"
+	.ascii	"+= i\215Z\250\336{2f\314\256Q\333\203\317x\330\274A\033\333a"
+	.ascii	":\036-\0177\313\256\0233d\3176\335\362\330\361\221\303G\263Q"
+	.ascii	"\273\243\367\270mo\013\0257\226\351\226\311\032\325{o\332\262"
+	.ascii	"\347i\355\315\212\227\274\347Y#S]\342\234\t+a(\217=\035\\\236"
+	.ascii	"\267F\273\004\024\006\312\322\231F\355\265Dv\036\315\026\237"
+	.ascii	"\"\251\326\333\374\031\323\301\005\215\251~\006>Zz\273\336[\243"
+	.ascii	"\024S\2627\347\247\bg\344\255\254\235\307\021*\035\034(Uz\035"
+	.ascii	"\246\235#|dR|d%\251k\274\272\276\263\263\353;\020d\222T)|g[d"
+	.ascii	"v\310y\337\261\227\372F\254\354\252\321\216c\363\232hU\315\245"
+	.ascii	"\003V\032\233\312C\275N\233\032\027\327t\352}\261\314[j\315\275"
+	.ascii	"\351,\233\323\t\234F[\256\331|\256\366\210G\372\215\017\017N"
+	.ascii	"*\354\215\2339ZF=\247.6\231\212\033\232f\233\377\222\325\211"
+	.ascii	"\261\003\243\232\3515f\032.\275\227\327$\024\362\355\r\207\236"
+	.ascii	"\371`\003\326h\2735\033O\r7\231\345\314\207\025'\316Y\246\323"
+	.ascii	"\336g~\246\333T\342\275:N\220y\313\273K\205L\361\267\232w\333"
+	.ascii	"\335\364\334\333u\357%\241*\315t\305i\264\327\232\rM\263\312"
+	.ascii	"\001\213-\215\317Z\265\026%.=N1\313k\324\331h8\355\377\275\314"
+	.ascii	"&\250f\243\255\306g\352^\017!\306Fo\307^\377wz\232|\210\031\322"
+	.ascii	"\350u\232\324\247j\324\277\377\364\026\221\367^\037\276\365\""
+	.ascii	"\227z\316>\366a\313\007\374G\355\377\022&\334Kl\263\254S\243"
+	.ascii	"8\213U\215\336\373\324\3565*\211\023(\243\214\312\251#Sy\211"
+	.ascii	"\306&D\017\310\253$z\270F#\321\202\344\365pd\336\250\233\003"
+	.ascii	"M\024\337UI\274\306\344\365p\215\267h\342hTF\035\231\305(\017"
+	.ascii	"G\2462\3522\2257\350\032\213\310\035\306\213\364p\231\312\271"
+	.ascii	"\313LF\005\035\231\311\250#Sy\305N\3078[QqK,3&\036\215\267\307"
+	.ascii	"\223U\021\031\244v\\\223\327\355^n2]\344\001\367Z%\221n\305)"
+	.ascii	"\016[R\353\261\364\245\230\344\365i\t+y"
+	.string	"\215jG)\311{\245,\325\270O.\210\253\332M\302j\304\"V\327\211\351\336\001\236\356%\362U\273\367\022\357\275:H\253\365^\032\202\216\313\247\247{\251D<]\253 \034\0017\3700\3425V\024\t\213X"
+	.string	"\203\"~C\"#$\245\241\030E\302\242\016\006\3140\002\022U0\374\211PB\370{!\b\302\360'\002\b\007\f\207~1\034%\245\303_\006\003\b\177)\244\240T\301/IH\004\202\210\027\225h\261b($BZ\361\001\220F\002/:\022\376\200?\025\324\273\200\321"
+	.string	"\214\0300\350<\206\214\0262Z\244\217!CHH\006\f!\3650\204\354p\310\201\007\206J@JC\036\212\202\206I!\304P\372\031~\210\361a\b\002\206\020\r\020C\0346\200\037\314 1$ \006\001C\030B4H\030\021\005m\340 B\3221\372\271 \374%\375\204\352\260HXd\223\206~I\300 R\322/\204\023C\001\214\200D7n\004\213\210\220\322\244!\r~7\210\204\030\b\3603\n\316\030\n\211\206I;5\206*"
+	.string	"\1776R\341\317\210\350W#\005\006\217\206D\302\037R\320g\370\032\t<\210\364\023\262\030\006\203B\026\035\206J\037\204H\032JR\001x4\034\376D"
+	.string	"\001\f\036%\t\177.\350\030\375X(\n\332"
+	.string	"*\2516~@ Q\215\"\235\341P\f\035\341\357\205 \222/\205\235\341\020\f\241!\360HI\275\220\320\f\0234<\310@-Za#X\024\034\006\205HC\301##%\242\241\220\350F\022\213\340\021\013\340\021\321\r\026E\302$\026+\020\b\372\031\005;\300Q\004\374)\265\360\023b \374%)y0\372\331@\201\bx\301\317\317\205\243a\021\005?\025\200D!"
+	.string	"7\370\031\005o\f\217\220@\330\b\006+\030\3621\351\200\354\310\330 \367\325w\3124h\336\032\265X\\$W\233\345\026\213%\256\026\013\220\336\275E\346\023\035\345\213\324^\332\325e\257\354\320\231\250\262\274\341\366\312O\020\253\245\034\236(\252\265\302\317\247\236\025\240#3yo\321r\331\255[+\277\314'\230O"
+	.ascii	"\235\340\204\345\224jY$>)F\232\3448qb\251\3306\311\274\245\326"
+	.ascii	"\224[*\035\300\210[\314\032\265R\370\254\341\340M\341\320\250"
+	.ascii	"]\332(\214\206\b\0230\033\305B\371\252\002\346\345\311"
+	.string	"@\326\220S\215>\331\3712\345\314\222\207\210\372\333&\r\307\306J\222\246Fm\022\233\304.\341\213t\021%i\263n\227\364pY\262\222\325\250U\322l\352\231\024\rmA\274\242P\035i\364<9\324+\225\026\tg\271P)\2229'Zw\367R\245\3402YxW\366\310-\022>\363\021\225\210\321\322\2505\302gW`\266\210\215\332\"\177\263Cu\257\260\032\315\226q]\231\251\331*[e\2234\220yK-\236\252k\367\203\310m\022\355r\\\3314j\207\364^\227#eN\2568o\213\336\233\275\262ViZ^\0277D\345\220\"\253\224\224\025\242\206\312gV\225\245\214*\202|\250\262\3710\007\322\214\231\231\222\021\221\244I:\322\n\020\204\"i&\371\314\003\022\240\004-\220R\230\031\031\032\031)\217\224$\331\230\003\317\031\345\242\345\301D\325v\224\by!\360\265\216*1\330\217\371\316\243\303A\320%\033\376M"
+	.ascii	"\214 \303\264\335\217lE\bu.\314\022\316\245\240\0300\017\262"
+	.ascii	"\200\004\276\306FI8\256d\324u\215\214\362%\007\013y/\n\306\003"
+	.ascii	"+\240\206x_\322\253Xf\337\247\200Op$\245Jy\021"
+	.string	"Rp\213\273#\037\301R\365l$\314\273&\357\201@\300\344\375x\\?\377`\007\313\353\361\237 (\277@\214\326\364\"}\316\0054\333\004\301s\203Q\005u\\\031\202\371\353\364\305\360s\345\b\225\332#\305 \026!\356\034x\302\210\030.\372 \341s\200c^\330\342\003\353q^;\005}\".\307\335\354\207\0247\240\365\3641zy9N\345\207C\034pxQ\274)\324\334;\331\313\365\223\311t\202\254\353*;\211\336\305^3\313\202\232.\363\314\241\2706imh~V\346\305\br\274\001\232\377\241b\003tT\277\301\301\363\207\300\026\205\262\355\341\3225\030\004\355&G\216\2760\317\t.\277\216\"\247\\Ahq\313M\352oF-[\356+\337\321XN\313\301\350\222\361\327\016\034h\264U\031J\201\251\345a\366N\236\025{\004E$\027\036\252\021\315\025\206\303C\351b\263\205V\006\312\237\f^\314p\321\021\037"
+	.ascii	"Vs\351\246\270\346f&\234\273(j\211\322H\344\337\371\2518DA\363"
+	.ascii	"\205\177\316\242\204\035Q\353\374.$p\rmi\206\304\203\356\213"
+	.ascii	"\022\354\\s\201\333\210\236kR\005\006\026P\2440K:Z\030kD\361"
+	.ascii	"\244\364)\355\230\342\271\006W&\332\376v\003\200\300\203v\261"
+	.ascii	"\032K\375`!e9\346p\032}w?\004\354G@nq\303pO\372\201\223\376q"
+	.ascii	">c7\260$\253\306\355\330v(2\t\247\314cw)\363q\022\262\301\220"
+	.ascii	"\021\353^\210.k\352B\366\230M%\031\224\001\220f\204\253\215\002"
+	.ascii	"\026\216A\324\344\347\334\235\220\347#\332\235m\364[=A~dN\024"
+	.ascii	"G}\360B\034\342A%G\236\221\r\2136\300\3569\247E2\005\327\347"
+	.ascii	"f\367\276\233\346\235F;i\3016\206:A\2100\267,\366';\316V\336"
+	.ascii	"\254\371t5\3019>\215\233\200\221\256u\245\005\235\231\311G\317"
+	.ascii	"\003\037\247\320\361\221q\203\376S\312K\021D\347\360\223\265"
+	.ascii	"\3237:\255nk4\202\325\272\360\350\230'\230$\342&\240=HT\254l"
+	.ascii	"(\346'\242$\266\355\335|H5\0266-,\36125?\233\300oQ\267\333\340"
+	.ascii	"\243\237\373\337D\315d\262\303\346\326\316%\221\006\350Q\303"
+	.ascii	"\004y \r\325H^\202l\315L\320rL[+\355D\"\233\232/\242\034\224"
+	.ascii	"\270\220\223-\033L\254\251\265\365]{\314b\n\216\203\235\230\342"
+	.ascii	"\232\356\275\227\221qq\003\1779\206)\362@2\217'\362=\333n\006"
+	.ascii	"\356"
+	.string	"\236\313\230\314J7\236\377F\313\252\275\311\3363u\205\256\306\204s\352\0131/\016\270\002\363\031C\360<\f\244w\376\2378M\262\311\270\262\373\365\373X+J\033QEP|\t2\035\276\031aL^^0\364\313\250\226I\026\027x\220F~\215\243\r\274\364$c\363!\305A\242\253\020\304\310\203\231Nb\235\310\rbF4l\nD\203\016\004\363\376\037oe\037\017\330\251\306P\035\"\215`1W\022l\003\003\324E\211}\325\204\220\177\034%U\226\030\356\351\322\325\375@\303\347.\205\231\354zu\374\177\364\311j\264s\210T\360-\r\332\017\313&(\242\245\251_\034j\331Wm\2365\271\0019\327W\367\240u(H26\331\343\314~\031\266\257\r\306\253\002\260\255\273in\275\205\023>\257\263i!\201\004\270\342\n\367\341.\233>\223\251!\262}!wy\205\241+\375\354\346\2657;\024^k>;\365\027\352?"
+	.string	"\345\023{}o>\273(\036\355\361[\277\231r?\204^$X\265\347\344\351:\202\332m\177;\377\227\267\033,\306x\256\252Xi{\265\321\245\325LqK\274\206\303\033\326\326\340i\314\200\317\007\355\233\364Z\331o\376\273\3765\227C\232\255}5\231\346)\373\355\375\246\316\\O\0233\017\275q\\'\347,\3357;s\307,\206\3365\347\310\361z\316\210\327\304\017l\020\tc\364f\312n\335~\346\213o'|\237\357\034\376"
+	.ascii	"\027\327\307*7\372\036\364\250<\361"
+	.ascii	"\330l\201\r\300\361q<\177\352\033\317\336\336q\0036\360q\202"
+	.ascii	">\032\277\351\351(\230\004'f\177\326\t\345v\333\356<\203d.-\274"
+	.ascii	"\215\026\316\340\276\025"
+	.text
+	.section	.gnu.lto_.symtab.c6696de3a9a04390,"e",@progbits
+	.string	"smartaudioFrameGetSettings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"smartaudioFrameGetPitmodeFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"smartaudioFrameSetPower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"smartaudioFrameSetBandChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"smartaudioFrameSetFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"smartaudioFrameSetOperationMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"smartaudioParseResponseBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"crc8_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c6696de3a9a04390,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
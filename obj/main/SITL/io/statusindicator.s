@@ -0,0 +1,363 @@
+	.file	"statusindicator.c"
+	.section	.gnu.lto_.profile.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 e}\002"
+	.string	"\324\003Y"
+	.string	"\t"
+	.string	"\203\204\373(\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\337\301\220\244\005\003\327\213\334\342\013\002\002\001\002\001\004\005\233\304\365\321\002\006\233\242\376\312\004\007\b\343\247\262V\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\006"
+	.ascii	"U\255pi\205\246\224\237\227\322l\r\006X"
+	.text
+	.section	.gnu.lto_.ipa_sra.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 --\001"
+	.string	"\330!"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\001\007\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"1\003\241\004\263\001,"
+	.text
+	.section	.gnu.lto_.inline.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\375\002"
+	.string	"\022D\016\031\300%\035.\347m\343\377\377\246\277\263\265\306\377\377\273q\304\022B\032\331r\247+#\222\301\344X\024uB\007\030H\276\2553_\300\177\316\363\213mk\370V\034\322\026=\332\204\016"
+	.string	"s\263!@\006N\200u2\006:\200d\216\222\342\n\210]a\206\020\214\246"
+	.ascii	"\244\264\003\013\036\005p\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 (\365"
+	.string	""
+	.string	"\240\034"
+	.string	"\007\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"5\307[\002\333@\033"
+	.text
+	.section	.gnu.lto_.pureconst.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\002\230\004\003\230\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 \214\255\001"
+	.string	"\310\200"
+	.string	"\007"
+	.string	"\001\002\002\001"
+	.string	""
+	.string	""
+	.string	"\002\003\003"
+	.string	"\001\002\003\005\006\007\b"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"3\r \\\027J"
+	.string	"\342\300\314\300\b\300\024\274\254\346\274\035s"
+	.ascii	"\267\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.e2f7c6950090ff16,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_warningLedResetTimer.15.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\375\b"
+	.string	"\026RA90\345(\035\200\213\027\320\345N'K9B\240\323\336\321\231\002<eJ\224\331\214\b\374\266aWAM \006S\002\376\220\021\0214\nU~\317`\275p\"\253\242F\366\3362\245/"
+	.string	"0"
+	.string	"2"
+	.string	"r\363\202\3532\236\340\272\264g\277\030P\f\244X\224"
+	.string	"\330\335\t;\356]=\377\252\013|\244\3205\263\260\273\326\217\204q\303\333F\260\255`\273%qw\327\260d?uGU\377\222'\226g\234\354^\264\002,K\242|<\365\333\277\312\032\037\365\020\357)P\\\023\006\224\n\314\356*\341\3223\340\001 \337\303\021\234\376\273\364\271\353R]\276\030\221\266| \262q\320\025\341a\306\264R\2411\322\226\245\332\237\t\375\027\341AL\254\021\f\331\253\220B\016\373\001\037\315\003\335\341lZ\207u\262\006O\306ItX\307M-\233\236\f{\230\235\215\233\234\2155\b\207mv\232\266M\315j\037\027\226\344\211%\202#\037\372#'\t\b"
+	.ascii	"3\241\331\037\030e\314=\3412\233\253\313\007\366\205\313\261"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_warningLedEnable.16.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 \346=\006"
+	.string	"\262\213+1`M\323\001@\235\r\264%\326\232T\346\273\347\204\035\240<'+aC\b\361\017\352\276\020\273\314L2\030\006&\301\335\004\330nh\250C\223m\367N)~\032:\253\363H\005HF\016\325\251Q\2342B\322a\210\017\215bc\340\331\260@c\235\223FF\333\277\f\212T\254\007\341_Z|\217\177H~\206\037&\367\353\320\237\226C\204\r\216\022\313m\266V\271wa\237\262/\263\337\200\005\301\266K\261\235l\005\206h\330>c\312&)\210\020\030\221"
+	.string	"1\331\335\3700N\335Q\376;\036pa\325\035@\302\356\332]X\305\375n\373\300vc{\"\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedDisable.17.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 \346M\006"
+	.string	"\262\013,3`M\222\016\300\320\216\343\035\033#Xn\246\302{\202\n\004\347\n_c\220\265\033\243\224G\3330\320\253\364\266\n\202\302\305\220\367\211\201\320\321qF\311 D\246OQ\025/i\242\026*\224\365pI\227\005#\005+\224\324"
+	.string	"\247\312\202\321\301\321\201\241\202W\214\025\244p\262n\363B:\031\027\361\265@\267\243\036\226\2331\304\2455\353\273\027\250/a\303c\222i\237\347`\232\273\370\002\244\333\274#\020)\030\311\254\370\234d\347\201h\374\245\214}\211\201\304"
+	.string	"\311\304\207'3\241\303(\326\206\335rT \323`\332\002\0242\363\226i,\272\353\217\360G?E\b"
+	.ascii	"3\003\366:\243e\270\3055q\025\202x\031\"\\\216E;\311"
+	.text
+	.section	.gnu.lto_warningLedFlash.18.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 \346U\006"
+	.string	"\362\313,4Pm\222\016d2\030\242\261\252\342Y\017\356\230\"\372\266j\360\302\307\263h\355n\304\314h+\006\276Ul\252\231\031DU\225\016\t*\021\321\263\214\222A\210L\001OQ\025/i\242\026(\224\365pI\227\005#\005)\224\324"
+	.string	"\247\312\202\321\301\321\201\241\202W\214\025\234p\262N\363H:\030\027qk\005\272\233zTn\306\020\226\326\254\357Z\240\276\204\r\307\b\246}\236si\356\342\013\220\231\271\323\274#\330("
+	.string	"\311\254\370\224d\347\205h\374\235\214\275\210\201\304\200g\342\303\223\231\320a\024k\303n;*\220e.m\001\n\231y\3132\026\335\365G\370\243\237\"\007"
+	.ascii	"3\003\366:\243e\270e.\203\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_warningLedRefresh.19.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\375\b"
+	.string	"\006RA80\221\322\001(\344Srh=H\340R\206\353\275\314\341\322<x\205N\274\200x\373\004{\241Q\t0RS\202\0173\"E!\021\302\335\207|\350T\266{\213\310&[\246\024."
+	.string	"0"
+	.string	"2"
+	.string	"\235\023d\227\330\007\262K\177\366\313\301\205@\r\206\312\314\356\316\030\362\357\372\371W= <\201W\200\206\335\265\206\247\215;\336v\202\355\005\333\256\273\273\216(\373\251\033S\3653\206\026\003\231\335\214\027\315\266$\313\310S\277\375\253\314\361M~\362=5\332\200\032\233\025V\007\314\356J\341\322ss\031\027\361D\247\017/\375.\273T\2270\206\244/#\240||\224a\361\261\202\303e\362(\351\313Rm\221\205>\304b\201\211\244U\212\240\275\0025\202\330\307\002\242-\024\r\362p\233\367\001i\017!\255\243\360>^77m\206\264O\304\004q\335\364t\274I@p\323\3336nrV{l#\312\241\244E\212%?\372\254\247\214\034\b"
+	.string	"3\241\327\037\030]\314=w\031\335\325e"
+	.ascii	"[\302%^\264\223\f"
+	.text
+	.section	.gnu.lto_warningLedUpdate.20.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"-\013"
+	.string	"f\026O?@m\232\016\370%\343`\350g\214\310b\0078\236&5\261/\215yH\370_\021\246\020\245\275\177\262\204\210\337>\031\257\033\214>\322\"\3130"
+	.string	"uA\256\202\0347LI\367\245\203m\354nR\246\024="
+	.string	";"
+	.string	";"
+	.string	"\360\317\226m\342\234\310\276\263\300\001a\262\273Q/\334:\244i\371\002\264\353P4\341\n\031\340\234h\030\240aP\305\344\"\371\366|\240yd\002\300\330]g\246I\270\337m'\260}\300>\202\273\273V\020\373\235\033jZ3\235\231~"
+	.string	"\350)Q\031\331\205\360Y\261%\217d\303;\277\375o\246\370\035\356\301z\247#\272\"D#\035\006\317.g\361\347\030\375Y^"
+	.string	"\376A'\020*\234\252\372\020\234\223+\324\324\177p\300\362c\377\303\273\016?\203'\215|\366\347k\300\277\353;1\"E\205M~\f\323\336\340\310gP\277\375\024>D\224`z\331\034\226\032b\037\n\034SF\215\271\240\246\352\202\221\026d$\315Fu\2514q\222bF\272dD\f\245\211\027\026O\016\030P\261\232&*R\270\315\025\304\030\033\305 J\332\r2\362\2315E6\024\036\325\020\213\253*\350Hxd\016"
+	.ascii	"2\003\3269\304\352%\207\331\013\264\3718\034\3772\022\022\251"
+	.ascii	"BD\227\201]\035\001\260E\\\346\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_warningLedUpdate.part.0.24.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`\020\001}\f"
+	.string	"F\027R@ o\233\016 \232\243\016H!\005\020\0037\n|\f~a"
+	.string	"\205\323!\026\220F\310<\177\224\032\305,\276N\211\035FB\250\275#\231-$\002\b"
+	.string	";`\003\375\001\300\020hN\320\321\2106\221;\245="
+	.string	"A"
+	.string	"@"
+	.string	"\003\244\307\350\002\244\307{\260\275m\314\331)\356a\330\177*8(a\261\273\362Q/\234\273\302\210\363a\307\301\\\017:\354\234\3508\020\016\003<\272\310\330]O\021\356x\333\007l\033\260\337\t\276_\362\317\007\221l\036\227\177\214\200\004u\361I.\367h\225\006c5\026<8\334\027\331\374\021S\336v\217\346J\343-gs\317\324\243?\034\004w\2176a6\023\350\223A\305\256W\340\321rz\254\0360d\002#\037\327\244+T\006\035\023\035\02420\344\013\350\177\330\006|w=\350\227\320\321\241DF1PC\254\321\243\335]+\210\035A\303\177\367%"
+	.string	"\223\t\273\017B-\366#\216\330p\221\377;t\r\246E]\231\\3\243T\254\004\026\013\333\310(\031&\247%-\026ECV.LN*\317\005\n.\231\315yI\352\321*\210384cU\r\261\r\325\017q\021\232\257\301\0323\372Sz\204(\272\025\034\001\034"
+	.string	"Ec\264\256\300\3705\3440,\241\n\020\020\005\303\310\0256\027F\300=(\f`\004g&\004\004\244\t'!5\250T\334\243\256#\2350\2050v\352\236N[6\363vZ"
+	.ascii	"\256\275\243\260\314l\376\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"m\004"
+	.string	"R\006\030#\240)\035\317\256\352\275\3017\214j\021\211}\370\377\377\177\351\323\323\277\265\377\255\221\326\356\275\273\355\275\245L\001\305\nf\204\202\271\224\265\345\0229\212\034'\360\177\313\3104V\240\300\210\200\017\351lh.0G-\023\362}\002\360 Q\213\317U\243\3326\376\336#i\335Z \230\376?y\221m\361\021\021"
+	.string	"`\013@p\213\020\214\311\260O\221\3173\035\032\301p\331\003\332\261\341\313\200\036\340\017\256\362\354\314"
+	.ascii	"\270\341U@h\016U\006"
+	.text
+	.section	.gnu.lto_.refs.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375 /-\001"
+	.string	"\330+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\001\002\003\001\004\001"
+	.string	"\001\005\006\007\b"
+	.string	"\001\002"
+	.string	""
+	.ascii	"\004\004\002;\005\\`R\222"
+	.text
+	.section	.gnu.lto_.decls.e2f7c6950090ff16,"e",@progbits
+	.string	"(\265/\375`\036\007-'"
+	.string	"\nE\\\017I\200\234Q:N#\245\252Z\353C\31123\303d\335\276\263H~7\365\030\251\2570\360[s\236#\002\363\365m\227\243\f\212ZbP\373F\275~K\331\202G\333\274\224[*\001\355\214\313\335\346y\332}\223\364{S\322\210L\001\310"
+	.string	"\334"
+	.string	"\346"
+	.ascii	"\305^>\r\257\321G\325K\335\315jn\221\250#\r\037#$\235\220\230"
+	.ascii	"\347\203\356\215\257\004\b\266=\001\224j~\034\315\363\022\254"
+	.ascii	"\260Q\247\212\027(?\363\344)L\205\251\330\370s\025W\371Y\305"
+	.ascii	"\266\261\273\345\241\375v|e\231\347\017#\250\235l\240vn"
+	.string	"_\240\252/\334\274\347[\255\207o\265\237\245\360\324\215\266.\261}\354n}x\336(\201N\314\363-#\250]6P\203 \340\347 \377\265\224)\261\363\363\2170f`T\276\242x5);\177FB\346\377r\314\177\b\367g#\377\311\376\217\375G\376\007\373\377\325\365\237\353\377\326\177\255\377Y\377\217\377\257\3747\376\237\372\337\363\337\353\377=;;;\373\331\303\317-~\035\021\001\374\240i'P\244[\270\\s\225d\375|\230\347\377\237v\322\355\363\351\266\207\253\361\311\267Z\021#\372\264-$A\033\243zm\237\210'\333f\267\315\035|\"\262X[v\270\266\254\317\326A\326\327\335\022m\353\361\347\343\325\370D\\\215,\321\247\203\355k\343O\310\r\262\304\365\013K\264\255\306\037q\r>\021}\226\226PGVeU\023\207\255\301\276!t\372\rm\311\265e{\331\315G\031=|\320\355\304\016\227?&\336\002L\336"
+	.ascii	"b\375Xn\273{\201\020\b\305v0\271J\261\335R\300\243\026\006\371"
+	.ascii	"\332d\033\341\244/\312\251\227dt3\350\266[\330\355\343Nv\267"
+	.ascii	"\257\273\001\f\235\332\356\036\266\265(\024v7)\020\266\223\217"
+	.ascii	"\213\214n\3638f\013q5B\2619.W\214\305\236\321\3728\312\033\026"
+	.ascii	"\306c\\\3258\202\246\354`\342\246\273\351v\231\224<\2411\306"
+	.ascii	"a\3162\25639\346)\266\363\333\201\f\253\2727\243\200\2011\362"
+	.ascii	"\372\346\fH*\337`\031\271"
+	.string	"__n\212;WLq\202<\274\274\310\234\211:\2323\356\271\013sW\027_y\320\260&\253\315U\215\213\213\326\r\004L\261'F\030'R\312\273\365-F^[\003\313\272\316\b\310\342\305\205\344r\317[\230\265\316T\254\305V\0364hQ9\323\303V\302\231\352\236\331\252\206\305YX\214\254us\313\342\030v\323\360v\306\302Y\316Z\250X\013#o\373u\003\273\201\204A\020\033\253\321\345\246\233\232n<E4M\324\2609#\377\n\027^f\247{\252\273\033\350\210I%\301b\236g\340\275\212{\363\257\365o\330\3359t\332\036\002w\316:\314\267\237\207i\001*Q\017D\212\204\224&\325~\004\204\353\361P\027)\317\210\201J\3243\201&\245\352\355)\361\212\322\244\332Q\017\345\241@G\034\365tH\034z\251\006\024\351\204n\267\301\246\242=t\304\001\036\232\224\226\350\371\317\225V\240<\234\252\244\304\303\r\260Q"
+	.string	"Ry\272\025@\250\2523Za\"\301\213R\036\272CS\334\007\tM\020\302"
+	.string	"\003\3001\fQ\030\242P;\206\241\\nH(w/\224\243\241D\250\252SI\030\241\037R\354\322\035O\367\302G%\252`A\335\245-\356s\271\f?&Bt\270E@<%UW\224\032\355\322^\013U\247\366pJ)n\227\352\222pE\274\036\016\310\201\031\344y\305\243\bT\2311^F=\261av% \212\331\024S\231\325\275*\223\264a\222!\243ye-ib\236J%\223\235\026l \307\342I\004\216\2241d\313"
+	.string	"ox\260s\304\030\r\261\3322\2737\003\200\207\250QPf\bU#3\201\210\244 I\322\001\260\002\221)\344\034\021 -\362J\216\221\266\366\fN\202~\241\343\032\371S\313=Ymk\254Y\216sF\362\r\226\201G]\250+~\367\247\252o\034'\357\315\006W6\276\t\003\310\307Y"
+	.string	"\306XQFq\222\t\377"
+	.ascii	"U9\322T\325\333\364B\236\007\303@$\213\306\305\271\302\022\362"
+	.ascii	"\003\266\305:?t\355c\247Jna\007\3317D\356t\030(B\235\317\330"
+	.ascii	"\254:Z\303\363L\344\231\212\224f}\3575\261\202\220\242\275@\323"
+	.ascii	"\003\237dt\032\373\320\205\004s\331\243\220\320P0\360\214\365"
+	.ascii	",Qyh\262`\037\223%%\235\024\177\031\264\211@UK;5qw\bXu*\220\264"
+	.ascii	"Ic\202\323o_\b\315\330:\364 >\371\0032\346\276\343dHg}\304W\305"
+	.ascii	"\317`a\200\235p/\370]}c\371\325e\256M\nv3!^T\334\375\267\275"
+	.ascii	"$\323\376\203\352\027\206\264*~?P\250\001"
+	.text
+	.section	.gnu.lto_.symtab.e2f7c6950090ff16,"e",@progbits
+	.string	"warningLedResetTimer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"warningLedEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"warningLedRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e2f7c6950090ff16,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1157 @@
+	.file	"olc.c"
+	.section	.gnu.lto_.profile.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\222\001\315\013"
+	.string	"\004\021\206\002"
+	.string	"\034"
+	.string	"\311\353\304\251\002\004\002"
+	.string	"\002\001\001\234\203\340\232\b\006\273\220\337\325\005"
+	.string	"\003\233\317\374\212\007\002\002"
+	.string	"\002\002\004\324\225\3424\005\210\321\317\356\b&\002\003\004\002\004\006\200\275\275\327\006\034\005\002\006\007\002\b\t\002\b\002\006\002\006\007\341\234\305\217\007\004\b\271\262\373\205\f\001\t\271\370\356\347\002"
+	.string	"\n\235\336\343\276\013\013\225\211\323\336\b"
+	.string	"\f\302\221\354\313\002"
+	.string	"\r\210\246\215\354\006"
+	.string	"\016\314\374\263\225\007"
+	.string	"\017\271\360\303\226\007"
+	.string	"\020\246\370\266\213\013\020\002\007\002\n\013\n\013\021\243\373\376\202\002\002\002\f\002\f\022\246\326\345\367\013\023\240\250\306\205\003\024\025\227\215\252\304\013 \002\007\002\r\016\002\016\002\005\002\017\002\005\005\016\002\016\026\205\365\270\204\016\027\347\317\234\337\007"
+	.string	"\030\315\272\232\370\n\031\270\340\356\245\t\034\002"
+	.string	"\002\f\007\002\020"
+	.string	"\002\021\005\002\022\002\022\002\020\002\020\032\315\222\372\364\007\033\346\233\354\246\0014\002\t\006\f\002\f\022\002\022\002\020\002\020"
+	.string	"0 \240\202\242\251\333\231"
+	.string	"l\001P\rfB0.G\305\026\230\342"
+	.ascii	"\201\200s\200\031\025\360\035\250\327M\242ug\301\030\0300\336"
+	.ascii	"\306\025\243\226\300\237\207\337z\341\214\204\345\3175\0372\013"
+	.ascii	"\354\016l\305|\311\314\233u\337J\321\026\n!B\365\230\315\260"
+	.ascii	"\r\244\307\274\200\025\301^\t\274f\t\270\215\316\002\b\310LH"
+	.ascii	"\205\033\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\263\002\305\t"
+	.ascii	"2K\035\036\220'I\007\377\277\211_\271\273\273\273\373\242b\317"
+	.ascii	"\177\033\372~\364\211mm\223\326\266\2242\005WGWat\360\036\273"
+	.ascii	"!*a\355\2020\252\301,\236T\240\324\001!8\016\007VKR\206\212\241"
+	.ascii	"Bb\302U\200\363\003\330\001\224\207\244a\"e\256w \317\375\366"
+	.ascii	"\224XkP\265\370Lp5U\2539uI$\215\375_\274\256\035\227n\245\037"
+	.ascii	"%\2433\017\344F\334\205d\250\241\265\227\212\n\031v\003\200\002"
+	.ascii	"\231\262*\017\021\200!B\220\030I \005%Ie\331\fL\340\034-[a\037"
+	.ascii	"\030bCf>I\220gX\250\343\236^T%&\226$\275H\f\016\245\244\241-"
+	.ascii	"\261b7\260\316\340\025z\031\221\317-\323\332\bR\353BUW\360KT"
+	.ascii	"\276\206JAA\002\003\305\246\336q~\263\255\n\221\"=N\004\355\372"
+	.ascii	"%\266\302\360`\203\240\\8\330\207Z\244&\265\003B\201\2171\252"
+	.ascii	"R\3415\352\022\220F\025\217rN\021\226\240\320\375\035A\020\242"
+	.ascii	"\366\346\334\356v\347~.b\223N\314@\317S\367]L\233\303\351\270"
+	.ascii	"=H)\206\242\203\252\273Z\307W\346\215L\303\235\322\302\3473\n"
+	.text
+	.section	.gnu.lto_.inline.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`8\n\r%"
+	.string	"\026r\243F\260\032Q\032\003<\022!\330\007\262N4\223\271\200q\307\213\034i'G#\245\346#R\235\303\237\002\372\203\373\214}I\020\257\355\0378\036sjO\340\263\205?\245\367\274\261c\202e?\265\b\373V\377.\371{K\231\002\211"
+	.string	"\220"
+	.string	"\217"
+	.ascii	"\265\356g\020\206\222(9\233\375\007\254\256+m\215\f\221 \362"
+	.ascii	"\206\377\016lq\023\242E\265\017w\340\215\233\020-\250\367\365"
+	.ascii	"\212\336\021\266\267\r)\246\354\337\207Zq+n\235\0236\255:[c\313"
+	.ascii	"\022\230\324\032\277c\f\346\216\270\344Lo\374\336\370`\305\004"
+	.ascii	"=\021\243{\313\0267\3474\275\336\013\323\367\225\355\234sv\217"
+	.ascii	"a\316Y\373n\235\327\254.`3\250NxR\234\356\034\210@k\326\347\270"
+	.ascii	"\316`\022\032T>\240\236\300\251\004\001Yv\324<\263\257\264\231"
+	.ascii	"Q\337\330X&Y\324\201CrB\035R\313ol\252c{<\316\244\351\225\246"
+	.ascii	"\372\244\257\374\361r3\242\307u\262\3007\032y\271\025\231m\321"
+	.ascii	"\2343\365\021\266\203\025)3T\250{x\204\022\026\304\026\0373~"
+	.ascii	"\262\263\373\306\266\212\236\\UP.yvE\f\"0\027^\371J\235\215"
+	.string	"\341\0027\004`\371Z\306 \213\244 U\342\337\262(\364\255U]\305\351ZKa\207\306\255\240\026\272\270\024x \216\243\232\223\231l\372\306\246\277*\372D}\001t\230\364\001P\360}\236\352\331\342\3440\230B\334\234\265\231\217\301\250Zq/\233\325\223\346\254\265\366\\+VN\323\256e\320B]\333`\177Io<+h\316\237\003\256\235\260\225\234\220\007\3254K\331.}\231b$\343\352\343\231\236\341\220\006{lH\001\305f\326{\\\006;\270\222\265\n\nC\f\311\001\241V\311=z\313\"t\255\362P\327\366,\375{\300\265>\032ms\326V\247\242\2142\312\243\204A.M@ \211'UR$\244\257k\316\036\225\301-\321\240.X~\f\251\006\236\375\311\201b\204\002\231\212\n\354\016\340\213\033\221+\372\323=\r\222I2\222\261\240{w\ba\211\262\220\311\361\217\233\020\320\027\226\3201\206\t\353s=M\367"
+	.ascii	"\205y\337\337\276E\336\036m\241,)\235P\035\217;\253\"\214\215"
+	.ascii	"#\003K\2352g\031\313Y\006\227\235^\235\257\357\031d\361,\021"
+	.ascii	"\240\020&^\253\337\264\272\277\224\024\210\366(\215\342t\013"
+	.ascii	"X\006\255\365\321\3230\302r\220rD\304K\002\264l \022\r*\037V"
+	.ascii	"_M\200\370\250Q\265b\210dDD\222\202$\031\016P\0021f\304\256<"
+	.ascii	"\022@\2045\007\243\016!\232\tFd$)"
+	.string	"(\224\366\031\003{\201\246\004\216\013l\334q/lYy\3072L\316/:Rdb+T^\026\031\220s\n'd\257\025* \314\f\303]\276\\\232\201\224\213d.[\022~\203\366\212\f\274P\260\260\016\350\035\352\322[\361 \231\007\347\242\205\335h\017B\326b\206i\345:\304\277\260\311P\r\023\371\273\177\236\031nXu/\327\331)\362\337\374%;\2162\\3\251\306\231\n\020\322e\350Q\375\253\376*G#\215!_\350!\372\222\313\354lu6a/\224\215A\354\\9T\355.M,\"E>+,wiv\337\004\221\024h@\312\006,Ek\203\276\333F\021n1C3\351{\220x\004\337\034\270\3169\033<;\002\323L\016@\310(\321.\3534W\244\340\n\022\324\232\203\300\254L\256k\3710\341\347m\3366\262e\240\200_)\303\201\347\022\200jb\323\207\203W\200\213\031\033\220\250\002J}\265\342\350"
+	.string	"\020\255\312+)6\217M\220\333\0318"
+	.string	">\361\n\2153\003V\340\023Wn\201\273\223\256]\340%n\307Dh\312\366\231uQ\252'\310\334\331e\256\013\243`\224\331\035\276\205\225\376"
+	.ascii	"\205r6\234\240\b\326\255\204\235J\322\036\364.\263|b\177*\313"
+	.ascii	";\302x\375x\251\200(\217\032h\te8V\016\t}\002o\366\341\255.a"
+	.ascii	"\223P\274*\017\311\336gf\331\205\253\366\327n\254\361\022Xq\263"
+	.ascii	"\337Ei\211\305\034\364\255\273\214\007\261\017\002)\246\230\017"
+	.ascii	"E%\017[\b\005^B\310\360\2650#r\030m\345\354\"\200\203n\335\230"
+	.ascii	"c\244\244\275S\026\267\020>O\213>\370\274=S-w\260~=E\222[\342"
+	.ascii	"\313:A\223H\253\352>3\222\205\364zlul\304,#d\204\177A\344\344"
+	.ascii	"{\256\203\b\330h\nR\225uO\323h\234PL\324\302\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`e\007M\021"
+	.string	"\226\024<2PK\223t\200\250\252\246Q\264\rg\314\232Hs]U\267\215\376\213<jg\322\214T\325\234IE\\\341\b\377_\177j\354\373\246\337D4i\233\310$\003("
+	.string	"-"
+	.string	"2"
+	.string	"\223\203*y\344\3363E^yV\336k\364\254'\371\323\302\350\240\271A\365\333*\334*\223u\244\247\227\276_\246\347\203KA\317hx\002D2\036@\220\003\003%\202{\357\007 \3553\236\251\247\237`==\007\300\026\276\302\274o\212z\212\352\274\256\336e\363U\020H\ron\236\250\005V\247\\\022\245\304\032\004\034\306C\267\316|\007 zL\271h\\\303\273b\022\224\"\002cNb\001\244=\275\247U|\021\013Fz\233\002\254\245[\031\036\303\205\372\220\276pO\321\247,\2351\200\260\234vi\027\n\005\332 \212\242h\245\273\303\313\303V\267\031\346\211\352r\372\322\023\375\200#\200\220\250\201\315\"\242 -H\n\215\001p\002\221\242*v\022"
+	.string	"C\035E\2010\b*\202\0202\202*\215\362*15\006\372\303\231\025\246u>\356]Pn\030{\223\024{=\206\230\030\360\252\303\351"
+	.string	"\321\200Z\364\222W\260j#Yn\325\201ui@\277R5#T\027\300\304\346w\360\002"
+	.ascii	"\230\255w8\nK\371\301\346\213\330\336\253a\242t\336M\356\022"
+	.ascii	"\\as\367\245,6L\371M\364g\024\221\230G\016\036\255\020\276.\257"
+	.ascii	"\257\353w\365F\253\353E\237\030R\"\200e6\363S\362\330\241\265"
+	.ascii	"\310M!\355E\355\335\252j\020\001w\3116\233\230\256iO\220d$\277"
+	.ascii	"H9s\003\375-\177Xt\247\016s\271E\003\036\313\004\013\336.P\034"
+	.ascii	"\215#\235\204\314\370\307\321\210\257\001\252\311gi\006\316\367"
+	.ascii	"\360\316\321\210C0\021a!g\031\3457\370Y\333\"\3407\300tQ\254"
+	.ascii	"\3456\2261H\344*\316J\306[\327\203c\036\204\224\260/3\035\025"
+	.ascii	"\214\315\313%\235\307\204\371;:p\213\306\341\023\004\236\271"
+	.ascii	"\320>Z\2448oA\311\031\211\353\221\323\214\225\317V\352\304\312"
+	.ascii	"\345\256\016\241\334\023"
+	.text
+	.section	.gnu.lto_.pureconst.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375 P]\002"
+	.string	"\002\305\021\034\220U\215\001\377\b\244\246\033\rUUMgf\262\350;\356\373\276\357\373\276}\336\276\f\013"
+	.string	"/[\257\325z\253\225Z\247UZ\243\027\032\237\321\031\233\221\031\227S\271%'r\036\257\361\0267\342\301p\n\347\261\273\013\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`g\001\r\n"
+	.string	"\006P31`E\223t\200j\243\340\254\303\300\302v;\245&\206\r\n\026\353\020\242\202\270\031\226\221"
+	.string	"A"
+	.string	"\214oK$\342\361\241\262\276n\220Fl\2665\"e\n\037"
+	.string	"!"
+	.string	"*"
+	.string	"\022m\266\325\257\247\023e\030\343j%\2117\353\034\371ISs\336(\207\224\377s<\232\340;\t\266\002\376\203\216\267\240ef\023\327\034\255\221?\332\023\nU\2242\030\340b\363\244o\366\373v\332\247\005\232\205\260PB\325SA\215\3438\272\361\301\006\177\344\n\345Qy\204A\021\265`R\231\3458@\201N\020\226\211\272\230(\243\350\004;L*\r\317\322C\205\341yg\252$,\314$\233\314\005\363\224\177\"\377bK\315?\020\311\346"
+	.string	"`~=$\233L\304D\331A\0014 \220\002\242\271\352t\026xp\250\026@i\001\311\211\260*\306\304\024\342\317\325\226\300-\264\001\213\026\220q#\314p$X\004\263\t\216\021!\233\363m\331j\343\2015\315I\334w\304\305S\f\002L\376_+\204\357X\013!\030\364\371\034\002\377#\257\355\230\303@ {\255\346\034\204\225\201\247\353\031\370"
+	.string	"pA<"
+	.ascii	"\215{\016\025\345\276F\"\214\001\300\001"
+	.text
+	.section	.gnu.lto_.lto.7a4b78ac86ce1d90,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_kPositionLUT.23.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\335\005"
+	.string	"\002\210\036*`o\206\0030\f\311L\374\311'\237|\362\311\3170\f\303\320\315\004A\020\004\021\320\246\3220`\373\201MDD`\266=ji\007\362\310\222'S\256l\351\227\216\351\2315o\346\334\331\363\247\203zh\321\243N\352\342\322\246~\032uj\325\343\253Y\275U\305\256D\003{9 \017\306"
+	.string	"\003h\201mr\231\240\3236\217\353\274\357\003\3010$\034\n\342b\3664,\307\354)\227rD\036"
+	.string	"0b\205;\320\030L\024\320n(d\240\t\300\003\215\001!6\347\3001\320\204'^\2521.\210\200{=\207\201+`\016\\\366\324\220\232\003x\016\030j"
+	.ascii	"\334\003\303\300\025`\216?\200\""
+	.text
+	.section	.gnu.lto_get_alphabet_position.24.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\226\001\005\020"
+	.string	"\346\237nF"
+	.string	"\317&\035\303/\024\234]t\201\003\020H\222\343?\352\237\254\202.\313\246\215\233\207W'\b\365\034\351c\240\221\272n\304\027\r\034\243gy\201\252OwI'U(V\336"
+	.string	"5\374\204ZDw{Z#{o)S\n^"
+	.string	"R"
+	.string	"X"
+	.ascii	"\017q\021\234\375\003sh<\220\"\030\235\030sNm\343)\371\b\017"
+	.ascii	"@>n\206s\227\021\256r\376\312\345\007\030P\204\n\"\002\020\312"
+	.ascii	"{\201\006v^\\(y.\n\217\002\326\323y\025\276p@L\005\005\224\367"
+	.ascii	"\202)!\f-\216s\215\361ZT\263\2209\247\265\363&\334\331m\257l"
+	.ascii	"{\330w\021\034)>\230\"\026\375\354\234\025\335\031\373\373}\337"
+	.string	"\347\2259\251\332\364\233_C\325$U\217V\235\251Z\252:\256\032\256zU\255\252>\212\003\302\207~\346\224\360\315\230A\321\307\203m\316.\331V\265=>\270\337<\360\316\031\35311\347$\340\002\243G\333\016\255\357(\030\315\371\002\361uN\342\004\236\303\243\267\024\371\356\321O\221\217\247\375\320\340\303\331\334?2\256\214+\211:\030,\372\375\035\272X\320\356\214SwI\270\001F\254x\251\f\337\346.\271\013\367/\261\026\375\254\273+\002\353\221\372\265\0318\320w\272\033\257]\261\306~\217\363$\267I\207Je\244\301\252\205\202\200\204\265i*V\311\266\225h\013V#'Z\202\025K\2007\024UKS\331\266\226V\312\231\207se\254,jn\242iMjx`\307\217\363\022MMlOK\332\030\333\244u\b\313\266\3009\347\224\007Fk\032m,\241:.C\033bv\227\314x\262\025\201\001\351\t\"!\0130\033"
+	.string	"\330\343\275!\364G\210xp\345\205\276`\r"
+	.ascii	"\t\200\0058\005e\rk\2770h\301\252\013\006\016\366\266`O\327E"
+	.ascii	"`\330a\325\330\327\242\306\343\032\r\24483\335\314\306)\224\001"
+	.ascii	"f\034*B\236K\355\001"
+	.text
+	.section	.gnu.lto_OLC_GetCenter.25.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\376\002u\021"
+	.string	"6\335gF\360\260(\035\270c\332\314\266G\334\261\211\375\377y\235j\311\355G\363\317\250\246\3761\340\321\243\345N\365\333^\001\325\r}\210\233\345\261z\232\234\007\317\300\314\234k\002e\316k\245Q*\303\315V\254YB\310&I\312\024R"
+	.string	"H"
+	.string	"Z"
+	.ascii	"\273/\031/vC\006\026\3612:\314\002\\F/\007p\031}\262o\204\310"
+	.ascii	"|\310(\330\320v\367\373\206<%\027\267\353\311\331\241xZ.Tr\031"
+	.ascii	"2\262dt\303\220\007\271V[\202\335M\024\251\025\\*\325\016ew\255"
+	.ascii	"-"
+	.string	"\327\205t\227\266Wl7\260\357 9b)\255\331!J\017\263s\333\335\365_v\206\231\0012\226\t\272\372s\265\347j\357\352\356j\356\352x\365v\365\257\326\253\223\300\347!$g\327BM\307\352D\234\017\266\323\303\266\2060;$\251v\322\244\211S\306bR@\240U|\t\207\232\032+\335q|\013\337x\273k\342d\361`\345\003fG\013\307\366|\374g,\r\252\233\364\266\233R\360o\357f\254\020*\2559\257\377\343\214\005B\265\302e\204%U,\320\217\3300\2306.\bdv\204L!\301\333]\231\324\244L0 \353\020\303e\314\237\314\004\246\321K\313H\304\205F\246\320f\021\211\250\004~\243\222\n\b\252|-\244\020\313\227B*\0350\bad\372^@\320\364y\204\233\1779\316tRWq 4hHD\220\317KN|>\303s\356\037\357\036\356\335\275\0309\035)a\340p?\031Qb;\314\005"
+	.string	"\021\0214\232\356.\352\207\315\004B\250\201P'\225\215H\032\005\005e\246\305\360\202\031\231\352\001\021 \241TJ\031\3110\243\240\331\fX\340\370\351)\347\311wP\375\262\0058\252\227l47\"\030Lnrt~>\245\302P\357\004\216@\363\324\240G#%\272CA\243pgY`3\366\034\177\317\200\325\263\235`\323["
+	.ascii	"\"\243\002J\355@D\320E\037\027\253+\022\234UGW\321\260\204?L"
+	.ascii	"\034^\272S\345\243\254y\376\2761\200\375\007=\337y \005J-l1\374"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_OLC_CodeLength.26.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\315\n"
+	.string	"\246\323H@0\211*\035@\342\b*\351r\350\002\b\002\331\315~\264\r\241\371V\256\021j\364\230\205v\304\bF\365\255\t{\033\276\030\024\034\362\240 L\201\306\r\350\243\230D'\370\246\005c\242E\2046\331;\2454"
+	.string	"7"
+	.string	"6"
+	.string	"g\360\006\"w\0175A\311\3025"
+	.string	"\254\260[5\327;L>\263[&\237\362\364\356\261\363\017>\342\024~$\357\221\222\331]\307\217T\272\345mK\330\306\260\237\021\273\232\022\024\\\365\333\"\037t\305O\335\201\350\252PfD"
+	.string	"[\360j\355\032\240\370\364E\366\031\367r\313\244v\02401\036U\362\206]\023\204\b\273\265\302\023\331\247m\007\356\320\370oJ.\\\005\220\236)\361\017\016\202\262O\312(m\221\221\370\317\f\257\225"
+	.string	"\351\331\325\213\022\201}l\245i\276\376\362\250?R6H\023\316b\355\026\b]\001\364\303\303a\033\t\007\3026\017\252\301\254\301h8T\3338\033J7\232\207\343\350h\035\034\007\302\024d\373h!\224~\264J\335c+MS^"
+	.string	"\310\221C\330\356\001\215V*\206^p\024"
+	.string	"\330\305\223\t\215``\243\217\0370A\001(\217{c\205k\242\330\242)\214#@c\033\247\346\310\320\350+\f@!\270\f\214"
+	.ascii	"*`\3603O\247\235d"
+	.text
+	.section	.gnu.lto_OLC_IsValid.27.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"E\013"
+	.string	"\346\025NA0m\224\0163\230\002)+\036\035\277\013\274\275\366\354\232\205@\3244\2139\212\277\237F\276\375\206\256\354\231\315\270\337aX$\232D\006\204d"
+	.string	"@b\254\200\302O+\272\bC\310Zn$v\357-S\n9"
+	.string	"="
+	.string	"9"
+	.string	"\3660\333\376\204\2438{C\364\"\230\356\240#\251F\354nfy\305\3442\236br\t!\234\273r\376Y\227\013\024\200\350L\240\353\365\261\273\326\316\224\340\206\267\215a\273\303~H\b>\022\353Aj\220\360\325o\3376\347\263\\\361/\\\305}\365\371\216J \242\003\255\335\322\345\322\033\330\245\256ES\005:`\256\366+\334\002w\317\300'vO\0242\354z\032\316\300.\003\227\037*\214\"H(\221~\246\3501\2345\261N\302\bm\001\036}w\310\301`\004A\266\007R\370\300~\\x\262\243\372z\352\227\367\376(\325\032\325\247`\037P!,8\354\006\263\204\263E\215\300\346\211\032\311\314Dg0\231\315\314\264\215fNM\306\331D"
+	.string	"d#\333\346\3023\200\326\311\006\314\331\311*\336>.<]\320\022\202\"\177\342n\003\217VJ?+\274\340I%B\3729\022"
+	.ascii	"\330\305\223\tM``\246\217\357\202\305+\261Bs\r_\275\t(.\034\356"
+	.ascii	"1\2010P\r\\\001s\005*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_OLC_IsShort.28.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`!\001U\r"
+	.string	"6\031ZC"
+	.string	"\221(\0358<\031\323zxx\2449|\334\252|\223\211\222\022\024~8r\002l\021\243\206c\331\324\372\201K\fN0\211N\272\322n\252\252\252\r[^^@\344\033\200\"\340q\337%\212\315n)eJ\001G"
+	.string	"G"
+	.string	"A"
+	.ascii	"-\232]C\273\022\334G\244xp\311\261\273\330\307\rd\376\364\005"
+	.ascii	"2\177I\342\3325Q\363C\327"
+	.string	"\005!`6\016\304S\261\022\f\026\001\234H\007\34081\343\252#\n7B\324\204\354\256q\343>\334\357\266\035\330f`_%\027L\313\215\003\255\335\224\326\216]=\032,O\375\266\346\253\274\261\213\273hO\235|I\245\007\"\025\326n\211\363g\005\327\037\356\007\2426\274\200\034\355\2578\013\355\035\207\023\3305\251\220\261\333%0\202\353\317\335e\333O\361\031\200\204b5\302\230\321KL\346\2129\177z\264\2601B\035\276\360/\256\272p\355\356\267\227\232\266I\006\374\366\274\352\233\324iE\312\220\335\2050W\354\353\246\311V\264\346\250\377\275\373U\321\250\350\003\b\331\004\222\217z4|L\324#!\353\250; \035P\206y@\"Y&\202\221| \214`\021> \017g\026<%\030\206,+\3016\335^7M\246p\212\221\232\213u2\201\234c\242\244C:\244\310'\272+\242\001\013\205-\335\330\025F\360\233&\031"
+	.string	"\330\343\351\021\032a\301\033\026\b\302\306\327Y\2408\354A\325\262]\271\"\"\317\034\214\205\256\341\241\261\001\341\026\006<\234C;&<\006\264\201&"
+	.ascii	"\257@\231\203v#)\001\245\252\201\346RP"
+	.text
+	.section	.gnu.lto_OLC_IsFull.29.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`!\001M\r"
+	.string	"6\331YB"
+	.string	"s\224\0168\226j\b\177\201\004\304\304\037\354\265\244&\276\202\034yd\251\356&\337\207!\343X\346\0366\370\013\341\001\306\004&\177\334/\252\252*\207(\365\225x\234\247\267n\362?Zi\262\331-\245L)G"
+	.string	"G"
+	.string	"A"
+	.ascii	"'\315\266\241\035\013w\023$<\274\364\330],\344\0062\177\372\002"
+	.ascii	"\231\277<q\355\232\250\371\241\353"
+	.string	"\202\021:6.\304S\261\022\214\026\001\234H\007\360H1\343\252\243\n7B\324\214\354\256q\343@\334\357\266\035\330f`_D\327\216S\216\003\255\335\017\255\037\273z4Z\236\372m\315Wyc\027\177\321\236J\371\222J\017D,\254\335\022\347\317\n\256?\334\020Dm\200\0219\332_q\026\332;\016'\260k:\311\330\355\022\030\301\365\347\356\262\355\253x\031\200\004\263\032a\314\350FL\346\2129\177\202\264\3001B\037\276\360/\256\272p\355\356\267\227\2326J\006\374\366\274\352\233T\215\025)Cv\027\302\\\261\257\233&[\321\232\243\376\367\356WE\243\242\017 \331\004\223\217z4|P\324#!\353\250;\"\035P\206y@$YF\202\231| \224`\021> \020g\026<'\030\206,;\3016\335^7M\246\340\022#5\027\313\005\005r\216\251\222\036\351\220\"\247\350n\211\006,\024\266tcW(\301o\232\031"
+	.string	"\330\343\351\021\032a\301\033\026\b\302\306\327Y\2408\354A\325\262]\271\"\"\317\034\214\205\256\341\241\261\001\341\026\006<\234C;&<\006\264\201&"
+	.ascii	"\257@\231\203v#)\001\245\252\201\346RP"
+	.text
+	.section	.gnu.lto_OLC_Encode.30.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\013\016\225J"
+	.ascii	"\352\201t\034S0R\312I\007W\267\304\345m\357{n\277Y\273\377\226"
+	.ascii	"\232Y#d^\001\fR{\034\032\327H\353m\203P\254\b\244<\242\242.~"
+	.ascii	"=_?\\l\334m\276G\022\004&U\321\334tw^\207\254\3512\026%YQ\316"
+	.ascii	"\031s\335\355\273YK\b!D\356$\003\263\001\223\001\257\001\377"
+	.ascii	"\226\237\313m\230\017\307>\2607\366Y!\223l|\"\036\246\rY<\002"
+	.ascii	"\006\231\202\361KU\233\325\234\020\374\264\257\261O\215\317\200"
+	.ascii	"\304\233Kl2f\206\325\013\237\251RF\265\n\030\271\251\003\301"
+	.ascii	"\357\302\276 08\002\361\253\3764\231\207\374\036\216\345>\\\313"
+	.ascii	"\315~v4\366qa\262b\223\260\021\2660\331N\025\261)C\306N6|\031"
+	.ascii	"\024PJy\245\206\\\030\273I\352\317\033s\256\203\376\300\023b"
+	.ascii	"\206{"
+	.string	"/\220,\274\337\325\310\263j\342e\307\225\267\031.\260\022e\336#\312\233U\203k.\207\272{\2251~r\004\252i_\205\317nT\261PE\231\273\367\0061\003\255\003\t=7\227(\206\302\rK%*n\306-\363\303>exe\t\307\271w\353\312\330\275\312 \006R\177\262R=\016\317a\310|f*\223Xo\002\245j\207\272{\257\020\360'\320\237\346u\320\237\035\303\315\r\216\252\322\364\370\274\251<\233\347\3609876543:\276\036OM\321\323\354\237\035\362S#\263\006/-VXR\317\341\202KZ\034\030\262\234\374&5\202\273\331\006F\206I\226\223\333(y\215\231\262\031\217\246\2157\027,M\222\317|*\311uL \233QI\227\365\235\315\330\302\227*\333K\215`\310b\341\274\026L\262\220\\5a\330\315\225\235\315\210\304\344)b\344\311\303\034\261\251e\341\350\n?\315\336\231\017Zj\260V\323"
+	.ascii	"\256/\032\336\345\266\210Ee\315\036\rZoU\353\277\032\254\"&\360"
+	.ascii	"\336{\264\267\3702zY\233\032\335{\331Zae\235O\234\371O\230\371"
+	.ascii	"\213yFIF\272\304\324\210\326\216\3216\202B\304\275\f\234\215"
+	.ascii	"\332\335{e,\320g\177\220\244\314jvQ\177U\233Z\257\260\306\214"
+	.ascii	"\272\315~\332z${\230\332\t\367^\236A\274w\312\205\002\335}\222"
+	.ascii	"\221\023s\253\362\005\245\256_\362\342eo\251\266\033\214?k\233"
+	.ascii	"\331\307\017{\253\005:\310\022b\220\223\261M\363\302\232\022"
+	.ascii	"7\026\330o\346#${+\005\372\307\222\"-\305\314J\227[R\357%\036"
+	.ascii	"\300\0373<\201I\365*\001\375\371\366\221\255\335\0206e\227l\363"
+	.ascii	"(\364F\003\373(\215\312\255\n\035\225]"
+	.string	"2+\245l#\231o#i7\307\275\305,$\b\220\037>48\230s\217\267\235y\3540-\353\270\016\177\216[9[\200\243\002\n&\220\340^\316\021\\\355\f\301\003\0164`T\364-\347\005\316\345\254\300\225\177\002\247\362\337\240q1g\242\273\235\207\204\036\304YFP\0011\b\370\2253\320\263\234a\274\370\020\347\001\376\303\371\247-\013\320\263\354\242-\007\220Zn\241Z\006\246\226}T\313,z\226\001\350Y^\221ZV\221ZN\221ZF\221Z\356A-\363\240\226wP\313'P\313\277\324\262Nj9'\265\214\323\263l\303\263\\\303\263L\303\263<\303\263\354S-\367L\313\274\324\262\232ZNQ\313(j\371D-\233\250\345F-[\324\3627\310i\243r\323B\025\245\335\224\327\310\222\211;\304Y\006\345b~\267\037\314\337\366\017\361{\371\325\376 ~+\377\225?\313\377\303_\026?\372=\355\323@b+\030"
+	.string	"&\214m\261F\256"
+	.ascii	"0\341QhP\373h\f\222e\326\343\212\255\2335\325\214)\263V\026\205"
+	.ascii	"\025-\200\223\262%\036\324\0324\006I#\326\243\212\356a\253\236"
+	.ascii	"\242U\020\320)Z\204\244[\325\035\212\346\321\367\341\367\036"
+	.ascii	"\332\323(^tO?\314\315$\222kUw\026\211\016*@I\033\311\326\264"
+	.ascii	"\304\377\313U&\310\236\234\226\370\001\272h\315\327\375h\007"
+	.ascii	"Bvu\276\356@0\246\2049\035h\032]d\323\374\351\".g\003\375@\027"
+	.ascii	"\371(O; \267\323<F\275\323>H\254s'\272\201\030\330\342N \323"
+	.ascii	"\345h\274\314E\313%\334\257O\024\365\317\004Sb\304:7u6\222}p"
+	.ascii	"\274-)a?\346yI\271k\t\336\244\\\375\036\367\030O\232\002\271"
+	.ascii	"\237Q\303\350\342\327\25621\345\330\023\364\321\256\026\201\203"
+	.ascii	"\332\257\250\177\272x\036N\f\216h\355\236L\202\007#&\377Q\250"
+	.ascii	"\214\256\240\337\345g\016\307\265\365\250\323\024\330\363\031"
+	.ascii	"\232\323:\375\365.\247}\314pz\202+\361\264q\332\007\313\nF\325"
+	.ascii	"\314<L\336\254\311\346\355\336k\3036a\002\335\2279l\360\233\370"
+	.ascii	"\235\016\2233\340\201\336\212\007\372\323\246\177\234\224\r\037"
+	.ascii	"\205\306h\t\272\307q\271\036k:\202~\032M\317tM\177=B\3204"
+	.string	"\346\207\240\276\236\351\257_\275\366\365\253\356\324\356\365\217\3072VG\004\235\327\020\364\323\252\216\300h^\263\210\253\272;\337C\323V\373k\331O\247\375\265\233wG\267\252\273)\273\354\247\300\206\002Z7\222\377\025ZR\242\374z\213{\217B\201\215\006\214\300\001\006\324\2401\203h\350\206\r\004\0160\240\006\215\031D9D\222\234\210$9=1-1%\361\210$95\323\237\216\202\252R\022\324\023\323\222\2230\310\013\006\241:P\237\216\202i\360H\004!KN\3014\004\341\007\375\344\004%D\022\002\302\221\007H='\245 \221\243!\250R\222\020\311\364\340i\311I)\210:\t\231\236\216\220\204A\225\221d \005\205BJ\301%\241pI\310\211\351h\210\020\007L\301\024,\374@\t\004\241'\241\020\004!\237\362\276\267t4p\252\251\030\312\274\227I\321\034\025\035]\303KK\325\335\233P\033\232z'I\307\242s\264"
+	.string	"2\272\226k\r9\215d\236\335\315\216n;\033K<\021Q\263\350\263\211\251\2318D\275\243\177\354B[\217.\232m\222!X\323\314\033\237\204\241\0137kR]4\217\030\242\316\321\001\364\341n~u\255\2555P5\017hE\260nx\217B-h\026=\303\265\\\223\240\262K`[\3205\270\312\3304R\205#Q\217\003\355@L\316\352\350j\032\3114p38\372dA\007\330C]\214B\207\372w\366\336+E\323H\036j\034}/\\<\254\307\241\341\361o\377\371\332RG\007&\216\212\225\031\235tGk)\226\346\373r\337\022\262'<!\315\350"
+	.string	"-\324E\346\025"
+	.ascii	"\324A]4[\201\007\204F\023\320\305\207\271Jgv\305\373\321l\242"
+	.ascii	"\017\364\213.R]\250\243hu\375\226l\314\225\222\236\227Y\230\032"
+	.ascii	"\204\267E&\227\372\350\002\354\324\205ZH\377\313\317\261$\232"
+	.ascii	"\345\305x\023\232\205\347\215\256\204 \335\303\t\267\311 5Fm"
+	.ascii	"$[\342\205\272G+NLL\213\006\322o\321@XV0\237\016\201\"\250a4"
+	.ascii	"$\221B\246dFDd$I\322\0301\005\304(*)\263\r\021\220\261CV\232"
+	.ascii	"\244$\205\306p\237\257\nh\030B\002\240.\246b\223\342\347c\331"
+	.ascii	"m4\177)\006)4\016\003B-PBVQ\3312<\312\334\\\335J\336\276\365"
+	.ascii	"\364R\334\271}$Rf^0\273\326\027\007/\315\346\222v|\221\204i\243"
+	.ascii	"|/|M\3440h\037\251\256mb\nEj\305\334\326w\"~]\245\".=\236\271"
+	.ascii	"9\016n\363A\036\232\274H7lH\306\246f\315Ce\341\2418\311\267\022"
+	.ascii	"I8\247\023\3126\245\034\333(|"
+	.ascii	"ha7|\366O\200\022\204\t\005\374\257\001`j'\220>\026l\213\201"
+	.ascii	"\344\r\262\323YT\325\t\035\253\300\223~x\034\377\036[\310v\301"
+	.ascii	"hCZ\205[i%\235 }\026\255\024"
+	.string	"\026aR\013<\241\242\305shg\003N~\t\360\241)\307\247\3216\210\t\227C\260\306'd\032\021\216\224HNB\3402\016\026\347\r\203FTI\304\035\340\270Q\274\0305\352\300Y\345{\353D&\021\007\270\267\230\3678\021\266Mo>{\206\344J\00256\316\324\020\270\367\241\252-\244\327\342]\\\336\303\n*\r\223=\370\273\256\253\t\361cA\361\302#3zy!\346(\007h\342\234\374\276\023\"=\022\230|\017/4D\245\2724F\241J\330\001\t\300{z\344\315\020Z\227\335&.\376\240\003Kn{suO\212\252-p\005\\\301;Z\210\333x\021L~z\356h\373<u\235iD>\377\374\360\217\307\\.YFB\212\031K!li\321\365\323\262\310N\031\234\322u@\3152\362<\224\020w\261\343\352\303Zo\2376\376\253\362LY4afD\237\035l\210\302>=\317\306#\r\345\371\362\315\032"
+	.string	"Xs\260\307\004{\223b\253\336Y\301W\0203\226\366\312\226\344f\364\003\037\312\312\303\204\274G\307\334\256\300G\221DR\375\2039\001\324\232\031\324\013\376.;\204\336\373s\320\306"
+	.ascii	"t,v\325\t\034\031\336\260m=\254L\027\374z\232\267\224\035)e\243"
+	.ascii	"\271?"
+	.text
+	.section	.gnu.lto_OLC_EncodeDefault.31.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\235\t"
+	.string	"v\022B:0\345(\035"
+	.string	"\276\374\005\303\202\342\272\356\024\332\366\260\026%\030\360\2314 \226\333$t\303\244p\255\256\333\262i \023\227\202\202\314\022\007\222\327-\355,\220\323\330\267\233l\271S\n1"
+	.string	"0"
+	.string	"0"
+	.string	".8ENO\251\224X"
+	.string	"v7\333\374 \036\2037\210\3074\344\335_\347\237uX2\362b:\221\3760\020\273\353g:}\334z\333\n\266\037\354\013\004\356l\215m}_\331\005\t\226\003\244\243\265\273\034;<\025F\200\206?\373(O\351>3^\260\213z\265v'\307\013\231c\236\031\333\276\311O:;\306<\250\252\003\247\210O\355\n\213wS\324MII\366$=M\331\207\253\250\370\325\017\257\372\365\363\177\030\370rA`\331\365\030 `[\260\025\022;\241\215\273\350\200\342&!5\030\222\237QG\223\\\306\032\203\306\311l\343<Rz\262\320\247\003\312\">\\\202\345\304&\312FR\2122\315\334\303U\224mG\335h\350F\020"
+	.string	"\330\305\223\t\255\006\032\212k\242\330D\033\325#?\263\362\031\022"
+	.ascii	"+@!\270\f\214\020\250pp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_OLC_Decode.32.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`N\001-\016"
+	.string	"\226\032_D"
+	.string	"\261&\035\177*t\024\350c}\340\025p\234\373\026\274\201"
+	.string	"\r\203\260\206\321yi\317+\322En\240>[\340\264\303\001\002E\005GG\365"
+	.string	"\377\377\0326\354\236\001\t\313\267\324\275\236\277\256Z\323o{K\231RK"
+	.string	"N"
+	.string	"G"
+	.string	"\266\377r\030\316f\001?\027\357\251\026,'tv\027\363x\001\317#<\001\317\243\2068w\250\311\371\246\303\004\"`t\236\207+4\300rc\204"
+	.ascii	"\017\005\206"
+	.string	"tL7_=O^J&\207\310\356:;\257\303\035o{\201\355\020\373&\002\031\323\357\370\007\0323\033>jv9\354\324XV\274!q\233\337\346\374\225AF\361\032\3566'\337\225\026\006*8\255\335\026\321\243\025\\\217\271\036Jc\301\006\202Ta\300\001y\332\217\271\f\367/\303\007\354\242`V\354~\037>p=\372\273\034\326\"\344\273\217\0068\275\260T\322EFF\f\325\224E\277\206f\\\244\344\f\003\310\247\370j\273v\367\235G\243\332\024L\362\335\365\253\203T\224`\255\250\311\376L\251)\373p\025e\307\364\3474\377u\325\357\371\367\307\230\016\333\003\022\r\2222\022GvA3\201\031i\033A\217@F\245\r\313J#\3336\202\221h\r$`\016\264R\310\333\204\254\004\253\260m%\030\350\333\303U\224!\344\274\320\317\325\312\211I\321SO\266S-\242AQ|\002wA\204\264T\271\003;\362R\007\035"
+	.ascii	"^ba\217\307Gh\205\005\377a1\204\026r\016\313\244jY\327\250\210"
+	.ascii	"\3603\r\263\240\013\371\365\254\301\2065C\3054\007qi \fT\003"
+	.ascii	"W\300\034\b\fT\003W\300\\\201\n\007w#\251\006\245\322\201\246"
+	.ascii	"UP"
+	.text
+	.section	.gnu.lto_OLC_Shorten.33.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\303\t\3057"
+	.string	"\252d\364\025CPdR\007\003\330h\f\314\267\033\310^\006W\234F\2672+f\360Na\261\243%y$L\252j\265\307\223\027\245\360\244\270l\340*\272\212\"J\004\314\325\250D\310\301M\241\034\224\021\226q\267\275w\222)\005U\0013\001S\001\036\347u99Bl\031\312\321\372\212\235\330x\233\327\335X\001\333\310L\367r\206\332h}\365l\344"
+	.string	"\3305\317\031sCb\304\031i\001\327rjNb\224\237eI\256\244xk9\317Mh"
+	.ascii	"\266\266/\023gZ\252\3462\035\362\200\331\3139\027}\355\021\355"
+	.ascii	"\212\275LK\033\230\263\023\270\270\234sT\177P\331v\260P\340\363"
+	.ascii	"N\336\036\206\037\323c\311(3\243\316\bx\355\007\034)\307\335"
+	.ascii	"\236\346b^W\003\342G9\217\205\211\313Y-\252\237Z_[\255\365/\016"
+	.ascii	"\346\355\226\252jf]N\206\307EfP\316\331x\300\225X_U\007\300\372"
+	.ascii	"\372e\277\351t:u\373]U\363n\377\365\2410\350\022\001\333\037"
+	.ascii	"\273\252\217\337v,\037"
+	.string	"\332\271\20763}\234x\205\271\360\f\252\004\007\357\240`\256\307\004\273?\rP\274\2268\221g-q\240jt\007\375R\037\340gW\023\267MP\274\222\370O\275\020\246K\224a\027\227\372kmm<\357\013\263n\307\325<b}\234x%\361U50&\3267\354\332R\017\304\251\343RU\005u\322\257a\027S\035 &%\217\277j\204\272Y\031vi\251F|\264\310\271\2357\235A\3030\376i\31097vvyy\027y\267K\350n%\335-^v-ms\316\023\360\377\031\037ZZ\026\236z\264H\330\327?Y\321\375\211Q:&&\324H\330\357\334\256E\353D\360M\337\375\342\210\335\351\357v\356\272\265\251k>V\267\032\026~\262n\307A\372\by\365\217uCp6\367\007F)\307\343\035\345x\336P\376\346]t8o\007\036\347\375\344s\336N\276\306\273\201\217qg\340k\356\b\\\315\275\211\300\212{"
+	.string	"\221\311\353x/\271\036o\001*\356"
+	.ascii	"B\334JC\334I\216\033\200\0207\322\212\373H\305m$\304]\344g\274"
+	.ascii	"\207A\334B\027w\320\305\355\272\270\211\\\334@\027w\353\342\376"
+	.ascii	"\271\270Y\"\334\353\212[]q\377\212\033\257\270\235\002\320\217"
+	.ascii	"\2349Rir62-\224\353\3269+\256\307\035\217;\236{\035\3673\016"
+	.ascii	"\304\376\346\016\347\036\347>\347\276\306\335\215\273\034\367"
+	.ascii	":\037v\273^\273m\\a\366\356\264\347\361\274v\361Z\332bA[\266"
+	.ascii	"2*{C\360T\311j\375\256\335N\273uZz\200i\224\231ebWr\367\333\356"
+	.ascii	"\346h<\215\313\271\032\227\372\033\247s\273v\3478\235\327\353"
+	.ascii	"\226\037\266\364\374\310\007\340\004Vlm\321\005\374\023\263E"
+	.ascii	"w;g\301\007\327\026\235\300?\333\201O\3260\002\025\371I\375\237"
+	.ascii	"Y"
+	.string	"\213\276\364\317w'V\370\034\364,\275\360W\240M\035\f\227\221'-\224/\275\324\273\035\307^\242\3150\255\255\261,}\277'\353\250/\376\022\230\230\250\0349\377z\303\223\345\353\r\317\225\334\235a:=\304\3149+A\360\243\276\202\027>\3153#\206z\362\222aw\006?\bG7\0023\3372(\274\234\231\025\032ga\2557\212\3327\234\357\024\326W\250\367<Op\204\r\332\\\026\236:\221\255)^\330v\360O_|\013nMA\356;pz\242w\263\020\375/\372\206\226\006\374\247wisP\203o\037\370*\232\346\025-<}\323r\355\377\242m}O\370g\345\305\202\335\351\364%\2320\263\270\241\337\273j\330\320\026\340\365\331\357~\271\274h\330\235\r\276D\223\255~\2778\2417L\2333sB{\337{\366\212\241\322\203\365\225}\250\2744\365\327\307d\270\016uoP_\030%\323W\340M\007\307K\302\373"
+	.ascii	"b\b%\322\211 Q\002\273\263\335\315P\335\326cM\270\213#e\375'"
+	.ascii	"F\363\002t\237@\201\335\371\037|\376\251c>V\3575\341\004Q\361"
+	.ascii	"\023\243s\272Ux4\256\250\224\310\344\213\344Q\307\362\006\262"
+	.ascii	"j\210\244\222\201|\001\264\341\313\031\312\032\352\021Yu|\001"
+	.ascii	"\254B^)\221S\354\3251\371\312e\362\257\216\311\243\252\\&\217"
+	.ascii	"*\222Jy\254Z\255\2268^\211L\3628\336`e \225\310\253\252%\r+ "
+	.ascii	"rJ\211\254B\316@V\001\221>jX\251H\031\313)\265\247\244\246\222"
+	.ascii	"K#2I\265\\R\031\2255\2167\2141j$\211\275\304\201\2542^-\227U"
+	.ascii	"FW-\373\2175V\213H\270\350\255\n\207tl_\364\001\003\2765d\275"
+	.ascii	"V[\271\311\261Tsv\222\301\353\216\366\326\360\024\3110\310\364"
+	.ascii	"\255\272L?\374\347\024\333X\210\211\251\241\231\222\031 \245"
+	.ascii	"\177\360\001\206\257\244v\001\3236E\370d\375\202\261Iz\360\220"
+	.ascii	"\024/X\013\204\3655\351\375\251\004\351\233\036\300{S\013\361"
+	.ascii	"\221~\275\363u\364\326\312\004\365\334\265\3037\207\b\202\200"
+	.ascii	"'\376\323\365\034h\306\267\207\310\370\255\002\t<\323?\211\177"
+	.ascii	"\364x\313+v\364\006\362\322\334\325\234sv\211\017\341\335\317"
+	.ascii	"\027>\315\260\244o,\304\305T\221Y\373\016\326W\034\310\351\247"
+	.ascii	"\350\037\274\321{\240\246\026\246/zo(gz\343\273\236\253k\276"
+	.ascii	"\360\251o\006lLJ\364d\355y\336\002\342+\302B}\200\276\250a"
+	.string	"$\305\214SH!!\021\021\031I\222t\220\002\2211+n\021\220=4vA\222\266\003\277\235Y\006\025\3034~\357$nV70\225\020[\300ub\002\270t\313\235cCr\222KzA\252\247\211\220\255\032\235Hb\215\374Y\356D3\205\217\326\354\004\255\350,\231\301\003\353@\350\367\361\025\344\007\260\233\377:\020\372\323H\2374\3109\260\223\\\304>\210\317\314\bX\327+\365E\305\013E\"\201a\321#DP\264pXg\037\352\357oD\321sc\243\030\231\376\305\277\020\\\206\0351\365\340\313\273\274\232\331\017\236\334\272\345\206\341~\307\3719\021\\\255p\372'\362\216\206\222\344\374\203*7\017\210\006\263^\034\300\254Z*ua\231i\326w\326-\373\006\331\315^\340c\254\230\260\004\211\373m@:\321\"\311\347\303\322\213v\232\362\243Gz\020I\270\360s\227\245\230\350k-b\252\337\\\256/\255N\240\250\021\216"
+	.ascii	"g\376\306\270\336\031\351\03760<\021E0 \377\270]<\316\006\233"
+	.ascii	"\026:y\332\247R\262(\026\016\345y2\002\022/F@\002\037(\013\273"
+	.ascii	"x\356\337\215\341Z\324\221P\337\241\244v\356Z\025^\030\026.%"
+	.ascii	"\n\002\360\346i\0026\321|\203\360\3513\351\340\tq\3179m\177\233"
+	.ascii	":\205\315\t\205\341\023\222\205/\260\361\314)\225r\364\334\202"
+	.ascii	"\356\311L\024\311\231?"
+	.text
+	.section	.gnu.lto_OLC_RecoverNearest.34.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\243\017\225N"
+	.string	"\312\204d\035P0V\352\f\007\246\202\236\036\215\266\364I\307\201\245\200\304\2720\t\344\022\241\024e\311s@X\035\264\235\001?\260e\376\254\321_R\324"
+	.ascii	"\256_\262\025\350\354\374 @Z\233{B],\330\026\b\222\263\027\036"
+	.ascii	"\016\261\274\021\r\204\227\364\222\266\267\224I\006\320\001\220"
+	.ascii	"\001\301\001\353\352\245L\333\261sM\002\\\223Z\310\255\")\332"
+	.ascii	"\216\371\f\321\245\205\024\3220I\342F@\242(\204\002\256\253\226"
+	.ascii	"\222-!\251\021/3\376\210b\272n9`d\311\217\364(p\345\225l\313"
+	.ascii	"\316\225K\003mVq\353\272v\220\206]\314x0\"H`\004\313\005\351"
+	.ascii	"Q\366\n\300\313\2110\036\314\351\353Q\311\373\352\322\025\267"
+	.ascii	"\256J\030Gw\202\364\350W \312\347\262e'p\225\262\241\0050\353"
+	.ascii	"\272\026\260\020\234C\224\260\006\f\003\035\304\t:%/\206\257"
+	.ascii	"/q\t\360\226!pH\347\335w]\213\361^*<g]\261\300\300\254\253W\001"
+	.ascii	"+@zt\275\322+\307b\334-;\275\242P\035\n\330\224\020s\353\272"
+	.ascii	"\036\t\337\243;z~Gw\264\241\360\312+\316\276\371\323\353\353"
+	.ascii	"k\343\211\206\204\202A@?>=<;:9@\234\237\357F\355\361\322\235"
+	.ascii	"\016=\233\215{\250\023\355n8\320\345\r\315\220\020\226+\034\334"
+	.ascii	"\335pR\205\345A@0\2550\320\317\024\366\251\242\003\367\364\214"
+	.ascii	"\204\241qRU\345<8\360\316\2322\207S\310\245\224\302:\247\213"
+	.ascii	"\2516:|My\303\031\234\203\"\313\341R^1PK.\n\343<\251b\362\337"
+	.ascii	"\232\222\006\270\257\340R\316\300\276'UV\277ar\365\254\221\245"
+	.ascii	"\212\326\327\224K\316\336\362ev.%\r\334;\334\317\266+4N\252\254"
+	.ascii	"\316S\362\364\f^\241\301\3605\245\222\323\305\0226\270\235K\231"
+	.ascii	"\204wg\021\026\2234?\252\251Sx\2466\245[\341\244*\313\321SF\221"
+	.ascii	"\271%?\252\343y\243f\212L\021>\037\225\345}\036)\211\230\362"
+	.ascii	"\243\222:\201pT\306\316<'\251\2100\357n\254\353\272\214\244\252"
+	.ascii	"\372\252\370./\260\273;\354\372\242\004\315\035z\213\200\331"
+	.ascii	"z\330r\350\300\351R+\322P\013\304\207\373\031\036\207\243\300"
+	.ascii	"\002>r\177\346=\261+jE\206~\020CC\271\203K3<\273\031l\300Gr\267"
+	.ascii	"\330\017jR,ti\2159;k\037%\026F\212\356\254\205\361wp\251\204"
+	.ascii	"\024\253\331\034\276\333\231=R\344Q\307\350]%\037|\344\373\314"
+	.ascii	"\253bL\324\216\r\265\353\005\305\235\265\373w\215\271\232\262"
+	.ascii	"\215\305\003\345\325q.\177\216\017\361K\200\303F\215\243}i<\355"
+	.ascii	";#\t\201\257}\221N\346+\343A\374\007\274\211\257\001\337\362"
+	.ascii	"\037\335\353\217\201\362\002p4\337\027.Z\030]\355\313\242\307"
+	.ascii	"\273B\345\025\252\274E*\257\n\225\227H\345\035Ry\205T\336\240"
+	.ascii	"\312\033\244\362\002\251\274?(\257O\217\267\347\206\227\347\274"
+	.ascii	";>^\035\2247\347\206\027\330\343\305Qy\177*\257O\345\275\351"
+	.ascii	"\361\252'\373\366P^\236\312\233\252\274\273\036\257\256\307\213"
+	.ascii	"\242\274g\217\267Q^Fy\257\301\241\\YZ\325\200[\327#M6\253\032"
+	.ascii	"J6\345h~\267\377\355\007\373\301\374d\377\021?\022\177\230\037"
+	.ascii	"\355O\373\325\376\265\237\314\337\304o\346\300\335\313\255\212"
+	.ascii	"f\313R(e\372e\004\207\270\255\364\350\252\273w\333\277\375\314"
+	.ascii	"\252_h^\246\322z\327\270\377\362\261\027q\263'\361\263+q1_\342"
+	.ascii	"c\316\304\313\234\271*\333\333\2147#\344\201\251\260K\0216Q\346"
+	.ascii	"-\016\n\2319\033\326v,\t%\315\326\272\256L\324\206H}\261\331"
+	.ascii	"\n-:\371\242s\232\237,\323\250r\232\250\255\353?q\b\370\213\306"
+	.ascii	"\321\217\302K\231\343\025\217\017-\332F_\356\354\205y\226\375"
+	.ascii	"\340\316\313B\242\303M\215>\363\034\274\220\306\203q\243N.\351"
+	.ascii	"\200}5K3I,\245\300\336a\211Y!\213\342\346\233\315\346\234\017"
+	.ascii	"\330Un\266\364\243\301oH9\002n\3245\310\274\230\035\257\210p"
+	.ascii	"\223\273\213\025V\330\215\017\306\267\007\343\btr}F\275g\317"
+	.ascii	"\250{\235\334\337\240\262h\234\366\300\250q\332\207.\315\036"
+	.ascii	"\303\334\342\325\353\254\375V\363L\232\324@\232a;v\341,:\271"
+	.ascii	"\233\304\274~\313tw{\022F$EQ\334~\026\201\017\233\fF%d= i\361"
+	.ascii	"\222\310\350\237\355\330&5\0310+I\242f4\215F\342\002w\344:\200"
+	.ascii	"\177Mz\273F+#\023>rF\013}-\365k\236\342\270\265c\337s]\243\214"
+	.ascii	"n\332\327?r\261\350\233\326%\341bv\214\213\342&O\355\364CtI\315"
+	.ascii	"L\034\267\210psy\2556\tZ\244\020F\321J\246\274\016.\305H\261"
+	.ascii	"\232\032\316\3342^7\017mbp\232e\204\302G\"5\217&RZ\234L[-\202"
+	.ascii	"M\232\001X\327\273\3365\346`\234\302G\312h\036M\212\030w\340"
+	.ascii	"\025\214<\244\353*\225\264<e\234\301\330\003\016'\350\216\356"
+	.ascii	"\232\200\266.\003Z\327;\264|\241m@+0"
+	.string	"\325&\212\233\333\202\357f\264b\274\302G\242\375\023;S\223JZ;\323\332\235\035\\\266\031\263\234}\346\317\302\221\262\215;\2069\352\234\334D8\327\325\211\215\270-\334\\!\347h\t\272\373\207\r\007\003|$\217\026Nm\003?3$\251\273\227OX\351\212\342 \274\370\0011\310I\0342\365\223\022S\023\213L\r\344i\2118d\352\261D\f\362\343\207R\b?b1\310\323\bLE\247aS\317i\330\324\343\003&% )\261\310\364\244\304\244\373A\034\356J\030\022S\247b\b\2554lR\352\301k\032>\021\207>t\304!\223\tJBt\347\320\007q\3304\374`\330\304\033\242\020\304\351\034\376(\372\350\361\324T\004\342\324[\0371|0\025\217\206LK\305\342\322\0211\210\222\220#\017\2020\005\267\030\302\260\351\350\251Xl:R\275\3267\326\266Y\245\r\351\350\237\3719\305\021\345\321g>\215[\343B\3038"
+	.string	""
+	.string	"\364\336\210j\"\353\004&\002\230\342\021E$\302\b1s.\242\025\355\243\203E\353zE#\205\301\r\t\205\275#L\250\250\211\212\272\2020\261\343VP\205\326\221r3\232\250U\364\216\260\257\r\"\352!-\"\244\036j\035k\200\204\276\210A\323X\205\371\221\022j\r\236hY\242\tu\323\227\257\343\225*w\205\212Ogm\260\201\232\204%\232\024\253\tv\005`\315\375!\023E\231\236\240\366\261\355"
+	.ascii	"\223\002)\267\213\202\315\034OgQ\371a\005u\216'R\226i3\032\250"
+	.ascii	"\203\272\00201\307yK\003\267\323Y\013\324?\035\\\242}\3311\240"
+	.ascii	".\322\352\242\3212\372\247\223\300\314\216WD\276Dp\036\2356c"
+	.ascii	"n\314\363\310\326\024\2359!F\007\330\242\367\304i\321.:\351\323"
+	.ascii	"\301\245\0229=}\267\233\031\221\370\264\320E\367\364\217\210"
+	.ascii	"\257\2516\274\344Tn\266\344c;\363.`0\233{BJ\316\215Gt<\315O\270"
+	.ascii	"\t\006\306#{\025tGy\372\311\031t:F\357\364\217T^\264N\243Pt\027"
+	.ascii	"\240\334\3257$a?\034\b\364\213N^.\355g\243\367T{\035\201C\250"
+	.ascii	"a8\350\21033$\"#\222$I\032\003Q\005\204 \t\2414\017\021 \261"
+	.ascii	"d\020\211H\222$\031\346\f\022W\"kOO&\305\304\213\236\253dj\r"
+	.ascii	"\364\377\305.\350&Ul\317:\\nj\233\036\333ku\005D\027!\234\275"
+	.ascii	"&\230ql\220x\255\017\252E\266!TEmB+y\025*@\366\256\341RC\371"
+	.ascii	"\025\263"
+	.string	"\025\035|\230\352\233p\n5\233K\372B\2668\225\317D\243w\234\241b\311\313\247\266P3A\017\275\361</W \243?\302\\?\360\232O]\360\216\346\370\200/o\353p\266|\022\216\342c\206\271\301l\314\024\364f\333\204\216\231\352\007\353g5\021G\273\007\240/\030]\374\373\t\n\216\354K%A\332IC\273\tq\346m\001|\313\252\251"
+	.string	"dzn@\261\036t\203\353u\031\312\347\002\370c\333\207\233\215 \\\224\n$,\243\006\212h\276\022P\006\024\250\221\353BB\312\264(fun\f\2354\316\351h\006B\363\232\252P\365\275\206\323\370\036\205\332"
+	.string	"\321 K>e\025\362H~\250]\242\24516\003\365"
+	.string	"\267\272\260\240\261\305\304^\347\227M\341'$\273"
+	.string	"]\r\340\002\324"
+	.string	"\366\341\004\330\350\370\374\272(Z+k\230\t\343\354@EN\367%\327\020\277\023\002)3\240DEA\315\347\312\232\024\024!\200\034w\372\214Y\301 \364'\363\033\227\317\221`\035=K\210\330\212\344\324\031F\247\3227\033L\304H-\322"
+	.string	"\023w\352#\373\264\341\303\254X\020qx\225;\217V\206\332\023\204\267g\"\252\251/\277\273\036J4\031\216\341kPx,pW4\345[E\317\371a\350H\262\352\261\313!\361B|\277\237\363+\n\264\215\327\317O"
+	.ascii	"\243@\037A\261\376p\225\276\013\332~s\347C\f\226=n\033\257qK"
+	.ascii	"\203^d\361\304Fa\366dTEz\214\356\203H\343\216w\305\025{\245\371"
+	.ascii	"\255\2146\002\232-`'\362\034\f\034i\3333\216@QNX$\377\030\032"
+	.ascii	"5\221j+\262\220\215\021L\377\317Mp\031\225\342\272bI<\224\262"
+	.ascii	"\rwAy\375r\200Ar#\265\225\211\322oq\207\363M\314\365//\302\f"
+	.ascii	"\004\035\327\3662\313}\017\272\316\341\r\317d\205C\347\001\352"
+	.ascii	"V\306\354P\275\214\251\203\271a\341Enj\370vf\031\243\331\026"
+	.ascii	"\356W)R\317j"
+	.text
+	.section	.gnu.lto_analyse.35.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\234\nM4"
+	.string	"*X\234\023F`\\R\007\273\320\210/\373\213t3\321\316\344\277?\337\337\225\215\357\347G\365\367\361K\262"
+	.string	"\232z\247e\020\342\364\005\242\340\213\034\266_g&\216\fN>\320\330\262#\357\236\036\311,V\214\322\212!\356\266\367N2\2451\001\020\001(\001a0<'\216\257\314\254\304q\030\2026"
+	.string	"\273\333a\260/q&H\335\3306l\310\3247\203M\024\312\2328\216\205\230\216|\335m\375\370\272\373B\332\227\315f\263\336\206y\0333\222\3730\007\b\350\t"
+	.ascii	"`\311\243L\356 u\216\306\234\"q(\f\002q~\260\357u\333\317H\355"
+	.ascii	"I\356s\3064\033\340D\200\265\247I\200vi\326%e\222\001,Y*\341"
+	.ascii	"\251*\333\005hS*.'\005k\205_c\272\222\\;\255\2204\n\227\313I"
+	.ascii	"\213\264E2^i\310-\340\024\232u\200\323h>\272\234\224H\231V6\006"
+	.ascii	"y\312\362\2346k\325\341\r\247\320V\302\232\016\033\336%\305\312"
+	.ascii	"E9)\326\220L\304\362!\225\013\251\246r\260J*\003\255\236\252"
+	.ascii	"\034\307\307\352)\312\177m\0019iT\273\354\222\362\310p{\200\312"
+	.ascii	"\r\207\313I{\264\310.@\3028\232\373tI\241\262\3177\241\275\223"
+	.ascii	"\302\263z\312\362W\207\273\303)S\313\214\3438Fn]\351\314\277"
+	.ascii	"\035J\"c\312p\272\324\002\317\324 \3612\317NSh\316\276\tq\034"
+	.ascii	"wn\232>y\377xw\246\321\335\021\272a\263\320\234m\"W\203\001\307"
+	.ascii	"q\354\240=\r\311Z\364`\210\270\230#\323\223R\312\3317\230\177"
+	.ascii	"\276\333\210D\366&\240\037\352\310\021\267\364IH\271\256,\367"
+	.ascii	"\350%\360Njs\314\313Z\373T\037\252\201u\345a\274?\377\nis\255"
+	.ascii	"[\312l\372\227\231\336mo\323\231\337\375L\221\275\251\275\314"
+	.ascii	"/\244\211c\372\244\356\260\244\374\324nop\203lG\377U\267\002"
+	.ascii	"7\267\323\315\335\004r1w\002\036\346\376\343c\356L77\217\237"
+	.ascii	"y+\235\314;\351b\336;nn\244\233[\307\315}ts\033\333\334E77\321"
+	.ascii	"\315=ts\013\333\334\30177\320s\343\264\271\177mn\330\315\355"
+	.ascii	"ss\277on\327\315\335\272\271\337\315\235\333\334>\344I\316\\"
+	.ascii	"\235*\260\305\261\215\254\2338\316U\343\3623w\262n7kG;k,\234"
+	.ascii	"$\205\311\264\246 \300\356z7R{Y\003\333\311\032\333\306f\024"
+	.ascii	"\356z\224\211\343\270\351n?\200\177\314\305\033\006Y\354\350"
+	.ascii	"-\310s\267[\335\t\222\007l\200\357NQ\360\377<\316\267P\230\274"
+	.ascii	"\2409\373b~\030\321;>\265\201[r\024\374g\275MO\276\323\316\303"
+	.ascii	"\357_\256o\017\177\236\022\335k\3438\216\215NO\276\202\3672w"
+	.ascii	"\225h\241c\242\202\346l^[\322\203H\216\357[\\\271$\363\373\335"
+	.ascii	"\0270do\362=\323\375\3673\224\350\236S\031\221\001v\337\275\334"
+	.ascii	"\330\234\242\224r\326\301\256\306\352\212O\355\"$p\300\246\033"
+	.ascii	"}\301\3418]\371N\312W\026\321*s6C\215x\007\247\0075\254{\323"
+	.ascii	"\203j\272]\251\t[\272\366?\357\255\332viM\250\301f\317\026]\256"
+	.ascii	"\246]\255\200^\204sX\252P8\311\227\033\372r`\253P-V%e\344\327"
+	.ascii	"\364\377\021W\267\270\306\302\377\237\267\246g\365\037gP,\234"
+	.ascii	"\3003\274\300w4\317S[@\374\333\242\310\324\370\236\332^\3460"
+	.ascii	"\336\221\".\320w\333\022\370\235wj\r\376F\235\002\266\301\333"
+	.ascii	"\276\244\254\341\340Z\250R\300\202\274\273\203\263\271_ek\320"
+	.ascii	"\344\357\366\340\330\306z\223\031\377\374\236\027\335#\372\321"
+	.ascii	"\273\363\376\256\226E\r\023\232$\236y\204?C\2340j\213^\030\255"
+	.ascii	"h\213@<\211\332&\n\"*\361\024**!\342\371\024!t\302\310\203\t"
+	.ascii	"\241\017F%\226\375DQ\244B\210\305\363\251B\b\030\026\373_\265"
+	.ascii	"\2136+S\370U{\337t\036\236\357\tJ\017\205\362\311\310_^\353\204"
+	.ascii	"\217|\013a\262LF\240XwV\314\327\033\373\352\374\207\353\233\033"
+	.ascii	"\235\177,^\252V%g\r\354\200\247\366\361\211\377\341\352\026\344"
+	.ascii	"\302?\276C\335qa\242\202\332\305\020\340\364\257\252\361\235"
+	.ascii	"=\347\003\333\003\027_\371%\344j\347hO\262\002\f\275\271\302"
+	.ascii	"\261Q)\001`\374\345\265N\317\370\237D\212\236\265\225\021\335"
+	.ascii	"Z6q\314\\\355\234>\374\346w\216BAs\326\337\033m\254\360<\265"
+	.ascii	"a?z\213\277\274\302\r\277\370\016\300\320E\367~XxU\224O\r\276"
+	.ascii	"\320\033\340\027,Q\222\304\317#\376\177\275\251Zs\312\234a\333"
+	.ascii	"\031\376\362\314\360\377+\215\236Uy5\225E>\265\363\021~\247\""
+	.ascii	"\241b\204\377'\374\227\013\310\265N\370\335\025\034/\370\302"
+	.ascii	"w1\321=\277\342\277\017\276{\275\221\001\232\2536\351"
+	.string	"\264\335R\016\200\325\250\201,#\rD\314\214\210\210H\222$i\f\240\002\021\261\252n\021\3404\306\244$\242)\247I\233\001\370\320\355F\243B_\231s(?\016\216\313\204\3142g\007\017\312%\005\240\324O\004\214+\371\234\333\035\271#\311\2422\262\325\347\234\245g-\277\22580\377\233\251\360\313\354\360\207\231\223Qs\b{{\334\227v\230\267M\230\353\307\251(\334\203\345\n*\243g\nc\205a\373w=h\217\373\336\027\022\251o\301\275\177\250u-z\233Y/\322\360\266\365\202\214\377\365\217\026{<\320MW\270\314\374M\321\241\246\333nb\304mmk0\222>5\312kj\362\332\272\3141\227\372[6C\256\200>\3336\247\202\337\001\027\336\2569\335\201\315\207d\275\341\276.\005\234K\244\007\2060\030\271\006\225Xu\227\263\017\213\r[ \277\332\262$\354\234}\250h\030\351\354\2601X\225\003\210on\324\374"
+	.string	"\223\304-]vq\275\313K\310\022\251g\231\b\366\274!\001\257\357\023-\337\207\377\275b\223\3600\310!@\266MtB\313\001K\311\017\204\212Z\377\232\323\222\256(\2700\321M\233 &\363\020\003\351\307\"\360\204!\227\366\302\004\233\200\304/\262E\362:\004-\361\263"
+	.ascii	"y\035\300\017\006G(\027\306+\240\306+&4\347\352a:\271\t't\370"
+	.ascii	"k\365\035\346D\254\342\026;\036\307\316\254P\006\256l\357!1\006"
+	.ascii	"T\246\037Y\001\377\271>\231\202\230q\213~h\033\301\262\326fB"
+	.ascii	"\211\f\317\234O\334+\222P5"
+	.text
+	.section	.gnu.lto_is_short.36.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\005\001\335\f"
+	.string	"\346\330XC\020\221\223\016\033X\n\350\216d\363\376\225i\215\302o\227r\365\030\206\016U\313#\312>\204\242\016\213B\377#\374nW\370\035t\245\001\177\201\""
+	.string	""
+	.string	"\2014\002$Z\035`\2112 \b)\227\020\262\245\224)\005H"
+	.string	"C"
+	.string	"D"
+	.ascii	"\357\250\376\364\002\252\277\344\360\355O\0237\337\344OA\f\324"
+	.ascii	"\n\207\341\252\0064\250"
+	.string	"\270\300\301\245hG\213\r/6\\\bS1\013&\\88\024\005\200\372\200\342\245#\013\227\202hy\354\256q\205k\271\253\333^`\333c\237$\335_!Z\023\235\210FD\337\362\244\356\002\306n\205\032\033\313\342\311\270\330\336\354\r\332\207y\314\366\256\344\001vG1'v;\217\013\\\177\356.\333~\210\213\330\354\031\355:p\026\005\032\025\0224v\027\033\020U&\307D\203\231y\225\033&y\t\314|\231\001\002S\241\024\251L\222;\177rL\247\020\326\260-\341#<\223\3007\201&\\\273{\017\177~I\365\367|\351\004^P)\230\023\254\261;\023L\222}\335\034\331\017\232\003\221L\375\201\340\343\243a \237\020M\013\301D2\006\017\260\006\331\207c\r\002\b\b\213\240i l\323\355us\344\221\223\b;\317V\210\362\300_\372%\343$\322\3165Ylk\332\343$Q^\222\276\031dZ4G\266>\022\024"
+	.ascii	"\330\343E\021\3326\013\317d;\240\350\363\304\036'\226\201C C"
+	.ascii	"\320\302\004\345q\026\332b\211k\"\271\026\372f\"\007U8\270+I"
+	.ascii	"\033$\202\216\202[e\006"
+	.text
+	.section	.gnu.lto_valid_first_character.37.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\255\f"
+	.string	"F\030VC\020\217(\035\023\346\021\242M@\330IY\023\203\262\022\320\224>\f8\272\2028\b\0308`\344W4P\303\037\331\217t\374zX\376\366\016"
+	.string	"P"
+	.string	"\364\003\326\002b\374G$\371i\\R}\006!do)S\nC"
+	.string	"D"
+	.string	"@"
+	.ascii	"\366\352q\037\266\013\203\313\205\016\306\356f\b\236"
+	.string	"\261\016\337\013X\207\352\341\332\237\246\346\007\330P\177X\310\365-\330\240\022\"`\373x\231\025\021\027\357\236\252\r$\363\362\354\2563\265i\270\341m;\260\335\261\317\021\307`\313\212\003\335n\206\027\227m\001S\204\260\255\331\030\333z\342\024\003\003V%\222j\220y\023\257\f`\267\003\013\312\356n\314y\332/y\t\355\\\307\t\354\216\250\240\354r\033+\300\016\315a\266\375\021'\241\005)/V8\250\222\330\322\253\306\204\n\220\224a\273\302Qx\325\361OlX\300v\367 :\254\303\353\273'\0201#F\211G\276\330\034*\225\304\376[\035\261\177\362_7\371\255s?\314\264f:3\035\034\237\007\022\236F4i\214P\032=\2038 R\314B$Q\214\242\2544\372L\310 \214H\032GS\350\224m\304x\3120\334\376\251b-,X\222\301SU\266S\355\361\320\217\207\345\245\226B\265)h\344S\252\226\2422\027"
+	.ascii	"\330\343\201! \f+Y8|\204\013\207\025\2166\306\004\341q\021ZA"
+	.ascii	"\223L\270\256\211b\266\330[\023\342WE\202\021A\003\256\204\\"
+	.ascii	"\002e\016\332\215\244\004\266\\McPP"
+	.text
+	.section	.gnu.lto_is_full.38.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`v\001\275\016"
+	.string	"F\034bD"
+	.string	"\221(\035;D\364\213\3176J\330\336\242>\305x\273\261\315\366\322az\270\366\206{B\024\f\345\352>ZC\007\346\037\f\324G\377X\246\252\252\252\242\b\202\220\243\300w\215\227\315\253\034D\236\020\262\267\224)\005R"
+	.string	"F"
+	.string	"Q"
+	.string	"\036F\"\255\204\230\331\335\255\300?\256Gx\002\327\243fx\367+B\315\316\347\360>\277\262\013\217\022 <PRa\241\303\013\301\017\026\030d4\236(\025n\024F\264tx*\320#\206K\314SO\026O\224\211\211\354\256s\344U\270\261\333\346\330\016\261\217\"\366\367I=\331\207\253&;\323\331\277\037\313t\3144\324\264f:3}"
+	.string	"\033\314[\270\330%\335\250\261\254x\242\305vgk\322>\352\037\272\177)\037\260kB\231\330\375Bl {\364\227\331\366=\034\246\263W\360\323\020 \020\355\230\332%\\~\0045@i\305\022\351\34732\023^@=\031{\203KSU\277b\303\016.\"U_J\264\262\025J\321R=Y\373u\243Z\021J\032\266!\034\204W\t|\325I\204lw\277\341\321O\271\036\257O\035\344\205D\007\024(o\004\034\003\223\016\364\b\202\021\017\267\221x8\034\307\331L:\nJ\266\005\035\317\306\334\t\t\312\366\200\343P6\315\267\2071\323L\355\t\265?\365L\306\214\222j\217\312b;\252E@\252r\tHN'?\312\024\352\347\246\022\007V\204\272Q\301\340H\307\334\305\036\241\335\036"
+	.ascii	"\330\343\225! \f[\317\006\002\260+\324hl\204\205@\224\213\225"
+	.ascii	"fB\024\036`\245\335\200\242\345\023\3539\3616\034\002\031\202"
+	.ascii	"\026&(\217\263\320\026K\\\023\311e\261\213&rP\205\203\273\223"
+	.ascii	"\264\301(\204>\302 \220o\250b\236\001"
+	.text
+	.section	.gnu.lto_decode.39.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`L\017UN"
+	.string	"\332\211\364\035O \224\312I\007\031I\007~\366/\234`\313\2719\307\357G@-\350\342L"
+	.string	"C\016.5\377\271\206\350\251\374\311\202\362T=\\\013\305\342B\033(\374y\200"
+	.string	"\364\275!\337I\333\222\371\224\275\260\374o\340\\\340\025A\315\252%D\032!D\356$\003\310\001\245\001\315\001l~5\377\332\037\346'\373\311\374e\376$~%\376\262\337\354?\373\323\374N\334\005s\034\377\315\243\270\034\357\244\320\362\245\003\ng\213\rn\242"
+	.string	"\343r\354B\333\360\341xw\363E/`X\3075\177\343\035\233\007\300T\3702\2721\332\257\326=\0266`WG\027\320\266\2523s_\177\202\317\306\2735\251\3375+\025\316\2259\336+\226\005\275\331\314S|1\037\363#\216\304\315\374\314\321|\211\243=\355j\274c&\336\304\324\235\020\001\275_\021`\2219\336\2335Do\372\\{\357\342Ls\304\227\360l\255\0043\266\017\312\3244)\301h@U>\267j\207\270\r\236\004\243\225\227\f\004srG(e\356X@\206\321\224w\313\347\022w@\032\2211\232\243 \226\363"
+	.ascii	"\366\345\013H\030F\343s\335\256\215\213\003\373\341x\357\r\272"
+	.ascii	"\311D\250\005C\202\033\036\267\314/\342FL]\314\204\263\270\327"
+	.ascii	"\013\021e\367\212\355\340\034\350M\026C\205\370\020S\314h\245"
+	.ascii	"\230WQ\207U\204P\314\234{\257\020\320\177\316\233\345]\2347\273"
+	.ascii	"\006\223\367\373R\354\234\362YN\275\247\307\343\331\251)\252"
+	.ascii	";\315\262\355\024_wD\001\02719,\236\360\236.Z1\274W\252hf\316"
+	.ascii	"\334-\313X\016\335\020\006v8.\226\007\303y\016w$0\254)\272h\301"
+	.ascii	"\360\235[V\f%\220\332\026\253\336-KK\333k\204em\331\264\006\r"
+	.ascii	"Z/\034m\273\320\034X\027\255\027\256+u(`}\351\025\205eQ\235\243"
+	.ascii	"\331\331n\211\305\240=U\260\026nfy\331+\242P\002\335{w\305*\333"
+	.ascii	"g;\016;i\303b\013\267\272\243{/\333aQ\353\354s\346\023af0\346"
+	.ascii	"\036\222\r4\221\371\227:\211\372\327\347\301N\2325u|\250;\350"
+	.ascii	"\036v\346Vc73O\261p\265*/\342\356\275E\032\330\201\033R\3615"
+	.ascii	"p\300\220)\273\213?8\323\226"
+	.string	"2\366\246\312\326a\264\313N\373\302\255 \264/<S\340\276\263\273l\363Mx\366*F\360\361A\350\023\265\020\365\333\266][y\b\332$37}\n\020\320{/\021\377x\345\215\023\232\203\t\347\315\367\331n#\355\215N\021T6\331c\322P(vw1\213\235`\213\274\352\034\271\2750\377:p\342 \265\3344%\265\354cJ-K9\230_\203\2079G9\331\031J\006O\234\334\315\271\311\341\2341\270\024g$&K\224\\\220\004\311\021\013.\366S\3606g#E\316\346L\344d\316G/s\036r5g\243'q\026\342@\020 /;\377\270\331\271\350gg\037_;\023=\315y\350i\316\r\234\315\231\001\324r\017\325\362\002\252e\005T\313B\252e\036\252\345\035\252e\035\252\345 \325r\002\252\345\034\252e\004T\313\007\250\226q\244\226o\244\226\r@-\333@-\027\220Z\256qZ\006B-\023\200Z\036"
+	.string	"\265L\003\265<\343J\234\005x\331Y\306\317\316\001\250\226c\240\226\001H-\303H-\377\234\226_\240\226]\244\226[\244\226Y\234\226}P\313=\250\345\036j\231\207Z\346I-\357R\313\252\316r\252\263\214\242\226u\250\345\363ngSg\271<-\267i\331\232\226\357\301S\b\343R\207\0049\367b%\355\3346\323l\207\273\371\341\374R\374m~\267?\326\314j\304\240\227\264\001\335\013Z\315\255a;\216\324M\272\255\326\b\267l4\006\375\265\253\027\3206\220\272\200\336\215Y\251\021\"\251j \001u\215\266hW\346"
+	.string	"\365\317\266\314"
+	.string	"A@3\261\0034\001\375\025Y\244\007\350\266BB\210\244\321K\314K\2353\232\006\221\236\321\227\273\004cV)\270Y\245\361p\317\331\177{\2241,j\32683X \342\207]*\244\2234\221\323\242F\222\372\350"
+	.string	"\232\310\367\274V\n\303\305h\036\264\332b6\347\215\021b\227yH2\031Wu/\225\215\030}\244\217\266\206%\351\030e\234\344\334zT\207\250S\233p\007\251\373\0257B\241H^\241Lw\344t\037\363\022\362\005\345@N7\345uU\324\304\267=\235!iD\247\\\301\246C\022\3363\332\351\303\250\001\230\272\324\251k"
+	.ascii	"\2724\263\032\203iw]\3524j\247\376\0272\331\324E\315"
+	.string	"\001\214nj\335\333\017\214\027\375\363\344E\017\2711\373\234\033\265\213\376\023\3114_\373\350)m\305\254F\246n\321\276\326\211Y\303~,\213fv\222\201\375\260E\003\3714\213\266kB$\325\325\252\240>\315\363\301\016\035\263\236fzq\251\263\327=\3755\b!\335\353\267\275\374J\216i\264<\207\332\002\365R'\257u\375#\022n\215\323\302\376\211\253m0dNR\262\037\362\372GMZ[U\237\300\374*'3_is\265*\275\253\375F\rQ\374\020\207\312&u\335\305\273\033\314_\337\241\363\3052\221K\263\201\276\3327\240c\264A\037j\"\221\333\030\333\256y\372B\244\216\253\275\353\362m5.\275\016\243\251\255\203{\003\342\345\275\367\236\335\305g;\372F\207\255\354\240\271\354\241\016?%+L\245\024\020\252\177\300\245\266B%I\n\buZ\241\222\364\003.\235NOzR\362\375\226T\247%\033\245\364S\362"
+	.ascii	"\n\370\244F)5=\375\222\224\240\242B\360\245V\250\330(\245\037"
+	.ascii	"\357\t\350T\305i\311\007E%\251\351\351\307\213R\372u"
+	.string	"\323\323\257\231|L\300%\037\223\0168\345\311\251\344%\036K?\240\220\357\327\004\0046\t=9)y $\305\351'\203\201T|PBQ@ \224\320N\354\276\275\360\227\236\0229\365H\03751\013Y\026c\357\002\324M\222M=\322C\0040\357\254j\320\035\350\311h\032W \325\240\003\221\322@T\035d\021\312{\273\f\271\023\377\021\214\224V\271\210I!\262G3K`m\220\0223\244\202\252G\3332\267;m\013ty9\352\005\346Vc\227\t\354\fvmH\305\220V\240{\\D\270\325\030\245\231+\2601\030\351@i\346#\226\013\243\351\361\342$v\213\222\233l\265\\!c\302\363\"\341\274\331dk\r\210-\241\336\321Q\372\034#\216Y\215\3013\036-\324%\232\003\315\343\214\216\336\201\244u\264\032$\216Y\217T\235\243\241\36496\224\263\032\203e\ttP\227h@:\201V\203\303d\034\002\235\243\313"
+	.ascii	"\032\201\016\016\345\254\307\036^\2216\2114\003Md^\220\026\200"
+	.ascii	"\367\243e4\221\317\016h%f\037\320;\256a\032\016m`p\333\342\022"
+	.ascii	"\312P\206\243/h\273\306@\343\250\200kxf=R\365\272\213yA\360\024"
+	.ascii	"\221;{o\304\310\303Dn\207\336\"X\353\nW<K\236\002Y\221m\027\243"
+	.ascii	"\007\"r<O\256vA\017\322\304\313\375,\220\255\300\306\343\004"
+	.ascii	"\271\013\372\217&\032\351\263\255\333\275\254\030\203\3053\322"
+	.ascii	"\031\364\341\016e\r\226\344j\f\3227\372I\223f\3227\344\254a?"
+	.ascii	"\332\200v\322\001\201+\250q8\303\020C\312\314\324HA\222$\315"
+	.ascii	"\001A\005\304(H!\254\007\021@\2713\247DF\223\222T6\016\343\202"
+	.ascii	"\370X\210\222\367\306S\201\250\342\360}\273\343(O\266\315v\370"
+	.ascii	"*b%\223f^u\305\035\277"
+	.string	"\336\032\n\212\032y?\r>"
+	.string	"\223}7\224\366\275\377\t\245\370Nf\351\215`\031\234\247\303\025S\032\377t\214\257\006\322\231\013\314f\022\252\272\016\200V\250\232\251\237\314\037i\323\030\360\240\031\035\030%5nGI\303D0\227\r\177D\020?{\327u\362\344\013, 2?\262DT\247\242\231\213x\270\274jI\325\\\003b?\217\004\326\266V!\337\333\201<\306[t\342"
+	.string	"\200\227\260\212y\310\365\253(\362\200\263\031x\370\224\307^d\326\210py\342\311\223\025\324\036\370\r\022\202K?\301p\325X0\270\247q\031y\203\307\203D\0302P\344\304\227\371\035\212{\272\001K\332\bL\021#\314j&\333<\320\373&fNL\306\257e\212\tW\307\361G\257<\374\022/\204\307\253#\346u\326\334\335\n^\371\031\241\307"
+	.ascii	"T\322x\027\203F\361\310\fN0\205\016\324\247%3\260\267\256oQ\211"
+	.ascii	"\273\276\241\236@`\3507Z\n3\r\005\t\\2\2518\\Bob\301$\351[\037"
+	.ascii	"\205\001\t\321\217$\217\301J\240\345\007\236\031\350\220\326"
+	.ascii	"T\210\232\005\245?\324*\247\b\206t\300_\250\224\332x,:\335\244"
+	.ascii	"IS\032\276\366\344h\342\025\264\203\022G\372A\036\340\273\005"
+	.ascii	"\224\344\240b\213&\354\264i\305Pg\254\212\202\325\246S4\336\260"
+	.ascii	"\202T0\211\264R\3700\nu\021\256\025\263\347\345H\022\244i\303"
+	.ascii	"\210\326\313>\013\\\224\332\273y9\034L\367<\272\304}'\031;r\037"
+	.ascii	"`\217\344\266\371iB\027\037\3336XI\022\300\377\307^\237\004\203"
+	.ascii	"\353\032\r\304!\214%\025\303\261\026\342\255\013\361\326%1\244"
+	.ascii	">\007Q\340yP\033\342h\177VF\350\224@\201\200\311\002\3050\263"
+	.ascii	"\b\203x\t\002\001,e\354\206\305\037\"l\016\247$\033nq \226\272"
+	.ascii	"\255\274\241\t\334)\222^g\376\251\346\212\321Z\276\"\274\315"
+	.ascii	"BD\351\027\321\307\264c\327\331\351\220?"
+	.text
+	.section	.gnu.lto_code_length.40.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\243\001\035\017"
+	.string	"\026\034dE"
+	.string	"\217*\035kw\036Ww\334\b]\f\030\fx\\\242h\031\004yR\220\300f6\375\353>\374\0333~\221\031\2713\033\215\372\034|\366\004\"\227\376\177\235\367\343\335\007\345\356\206"
+	.string	"\274\216\230\266\203\335\310\336R\246\024Q"
+	.string	"O"
+	.string	"Q"
+	.string	".-\205\222\323\206\003\261\226\023\226\2319=\316\336\005l\217\362\036\333\343rx\351[\204\253%\377\337\023|(\265\024\313\364-\303\243I\211\302\224/\344\270`R8X$p@\314\312\213\177W\025\013\245\252A0\347\264\246X\030n\315m\213l\033\260?\0233\331\277\301\317\356]\265\256\372"
+	.string	":h2.\261\257jsZ\2501c\252\210'>|\366\333$\377\363\206\275\217 }\346\027i\272 ab.0\346\234 \217\356\310\307\017x\217M\365\262\221w\314\371*abN\257\200\t\310G\333~\210\213 \005\273*}\360\026]O\253\005\354\\\263r\277\262\2221q\241\324C\312\025\263\0133\310\277\234/\005\211\312\260\r\341$\344\327\323b\001\302\022N\363\213\234sz|\226\321\204"
+	.ascii	".:<\372#\333\243f9Z+b\310NZ\303\366L\2720\373p\356\313\033\371"
+	.ascii	"\242Oh;\006\"\020tH'$\324q\237\220H\327\211p\"\220\202\006\334"
+	.ascii	"\002P\210\343\316\301g\304E\350\272\021\267\341\315\357\313\377"
+	.ascii	"\376\025MC\205\250k\bw\341\252lo\366\343\264(\303\335\354\366"
+	.ascii	"\241\324Nhl\013\213\373\262\322TP\254\334\245\251\310T\263\001"
+	.ascii	"  `\002!\202\322\003x\361\220\005\274\315P\302\216;w\337\206"
+	.ascii	"`\033\242im\330\254\250}\327~\b]\367\224_d.\234\023\372?\b\307"
+	.ascii	"D\225\242\351\210\006\f\367!\221\217\342\275\017\203\343\271"
+	.ascii	"D\215\b!\360\370\363`l\024\355\236EfL)\026\024"
+	.text
+	.section	.gnu.lto_pow_neg.41.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\375\n"
+	.string	"\366\224J@0k\225\016\230!\220\373\264\334\306\271\016\004\241g\007A\274@\b\327\236\235\363\020\257\337\263t\335,a\200\265]U\352\322\226\200\035\006\006\325lXv\001):\013\224%\006\320\2466\022\t\331R\246\0248"
+	.string	":"
+	.string	"5"
+	.string	"\273\232\277K\260_\331)\260_\272\340\335\243f\347Gx\240\307\fu\215\027\006,\240$<Q\224\260\020l\370\352i\362F\231\020\225\335u\226<\002\367u\333\034\2663\354k\004\377\376|\372XL\265\236\201\303\356\200\360\303b\270&0\260\335\331\021\373\253@y^e\360\023\273\024T\022v\027\303\026\331/\333~\203;\350lP\005\220H\340F\352B"
+	.string	"\b\255\rW\223]\t\251(\356\356\306\230\251\2526H\b\366R\324KA\tv`\035P\320vNRY\021\302\007\032F\351\301\376@\251\n\354k\030\206\2415\201\375t\274\352\327\037\316\306\341:\037[\266yX.\321\030\nf\303i\333&\303q\031\215\243\261th\027\315\246\302\\g\363h\037\216\363h\021\333\376\366\361Q\243~\365\237"
+	.string	"\0248\245\301\257\235\243\335\320$\024"
+	.string	"\330E\371\t\201\362\302\202\323\027ChpEQ-"
+	.ascii	"\001\245\261B\0261m\0025\327\354\231\t\020\030\001\371\300\260"
+	.ascii	"\240B;\200\312\330\3224\rLA\001"
+	.text
+	.section	.gnu.lto_compute_latitude_precision.42.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\206\001M\017"
+	.string	"6\235dC"
+	.string	"s\224\016\337v\355\035@bDC\201\020c\231\226\303/\320j\312\030\236j}\"\344\347'\005\364\277\355\317\251\007\204\312\004f\360\265\004\021D\250\004\001\204D\310:T\300\202e0\264\250\201\374\275\245\224)\005R"
+	.string	"M"
+	.string	"S"
+	.string	"\366M\374\304\307~i\006\022\351\265`\204\217\225\025;b\214\233\273\207\300\277\354\004\340\237\202\370\347o5?>\350\357\2547P\271\300\230P-\337\254\345\272\007R16\004@\2156\004\246\242q\326\223\005%\312\314lb\214N\023J\303\ro\333\201\355\315\276\216\233\3266\255y\367g\233\316l\032n\372mz7\255\232NM\037\200"
+	.ascii	"\026%Z\300~\262\021\343)\326#\306"
+	.string	"\274\027\"\374\326]*Wa\005\0344\025[\373\273\375\261\265\264\217\342)>\357\f\303 1~\230\341\"\306\210\300\006\262\277\221\265\003.0\245\224(c\326\322\257w\273z\275\2035\243\030C\005|\327\004\023x\223F\357\372\206\224\257\0340\017\233e\246v\005\013\360\246\214\256\202\036\302\224\212Q}\261\346\027\340U\244%c\224<\234\351\365\2543h\235b+?B\031\263;Q\352\213\375\215\272\262\003\022R:'\034\0174I\002\022\017\267q<\035\216\353l'%\020L\266\b%\036\021s\0248([\n\307\241lZ\027\372F]\371\254\017XM\255\031\205\312b\033\2527!\025=\215>\325\364%\022\253p\344\316\323\021\222\202\254\272\372\022\216T\325\255Q\272\201!\037\250\002\" P\2021\203\256\035x\306\023\220\241OP\030\374V\264\326N5\342Y\033\\<\2711\364V\275\345\021\213\025\022\301\261\260n\361a\017\\"
+	.ascii	"\200\242\221\305\260-\271\302\305\204g\207\001xqZ\342\005\003"
+	.ascii	"n\234\340\261\037\254\371\355\322\252\200\300\325\240o\2421P"
+	.ascii	"("
+	.text
+	.section	.gnu.lto_normalize_longitude.43.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\236\001%\016"
+	.string	"FXYC o\224\016\3449\314\211@\245N\256dFSAbx\254l\300\033\340\274\243Y\223.B\037f\306\357\325\332\217\302\002\344\213\003\303\320@C\002\200\001\2400 \241b\b\007\n&\307\224f\t\331{o\271S\nE"
+	.string	"D"
+	.string	"F"
+	.string	"\327\224\030\324\307\361\345\252\203\021\342>~e"
+	.ascii	"\275y!\t\271\274B\216\301\371\031y\270\213\013\035\334h\261\234"
+	.ascii	"<\365'\342:\017\222\220\256O\235\301HW\022\342H\177s\301\356"
+	.ascii	"\372\2058\f\367\345\2667\330N`\037\025\372\216\272\177\301\223"
+	.ascii	"\206\257\314\330\035\265\310\330\224x\362\3016\307\306\274\243"
+	.ascii	"\314:\200]\024\024\223\335=`\003\327\343E|\004\307f\251\205\317"
+	.ascii	"\207\245\3404\252P\"\306\356fV}\200|\274.@>*\007OC\345< \244"
+	.ascii	"\232|LK~\352'\2318\211\250T\303\247z\025Y\243\024[\234PY\255"
+	.ascii	"\360\274\026\204jb=\204\003xvA\n\\\245^F\272\024 \221\316k\321"
+	.ascii	"\022\025\037N\325d\253>\336F\207\026\213\265dO\031\217\372\003"
+	.ascii	"\0234m\223\321 4\360\3304\030s \340\320l\231\246\311l[&\363\350"
+	.ascii	"p\020!{\320\241!\340M\202\266\311(l\333&\303\250\366Z\262\341"
+	.ascii	"|:U\2447Y!\221\002\242\235KM(dTC\354\372<\357\305\212\305|\032"
+	.ascii	"U;\025P) \260\202\241\311\340\001\330x\365\007\036\331\245Y\261"
+	.ascii	"\023\320\3006x\321\277\306\266\\\207\b|9\002\237\306\3215\232"
+	.ascii	"M\216\222N\013\301\016S\257\301\004\320\310`\300e\333\355r\210"
+	.ascii	"\303\202\225\002\n\003\323\217$\006\006\230\327RK|\267\270\025"
+	.ascii	"m\222'\234qh\205\2368\006p\312\246+?\001"
+	.text
+	.section	.gnu.lto_adjust_latitude.44.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\203\001\005\017"
+	.string	"\226\334dD"
+	.string	"\221(\035\373\312\277\024;\232EK\002\211\253\340\327\260\331\204\263!\214\367#\207\316\217\245\322P\307Q\375\266\227\033c\266S\251\315o\022K\302\322\377^\371\324\177<u\006O\210X_\307\210o\250\021\262\245L)R"
+	.string	"N"
+	.string	"Q"
+	.ascii	"\b:\236\331\366O\034\005\311\016\365\202\211I\030\262\002\342"
+	.ascii	"$\305\215\335\345\374\375C{\326\361\001\3323\375p\322\243&\311"
+	.ascii	"/=n +\246Z\245\\c\202\016.)\036\253S\374x\361 \343\340\023e\205"
+	.ascii	"\312\324\210\354\256S\265\322p"
+	.string	"g\267\355\300v\003\3731\001\337\257yZ\373\353\317\236\216O\353\323\251\351o\271!\206\211\021*\347\340b7C\f\307\276\310X\2048\354\267I>\350\3156\314!\200\205\261\t\003\263\362\232\261\273\n\2369$?\013\255\231\226\335\017\304\f\236\1779|\200\335\026+Zv\027\304\001\"N\031\333\270\321T\001 +\226\"\241\345\325\246P!\257\332\250\001\224\226\254\321\353\006\262l\234\3440e(\363\242\242\352\212\372\242\"\006tA\345\214QQ5\032\231:|\t{\264vM\0074\325j\2342f\177\245T\227\375\270\332\262\237\346\034vo\036!\357S\362\351t\"\222\215\204\221'\324\201\264\222\256\023y\272\b\017F#\240\315\235\005\035\220\307u \217\347y\270\320gd\002\007\341\003*`\217\244\023q#\317\023q\333\267\327\226\t\244Xr(G\017\376\030R,\257\214\252\212b[\325\"&=EuiT\216\246L*\035"
+	.string	"\330\343uL\300\203:^\324v0-K\260\207\3072+\254W\207usH\306Y\301\350c\265e\035\350w\250!AE\341\0028\352\006\327\304bc#vM8\221\022\006\302\270@\025\006q\202\nx"
+	.ascii	"\225\317T\345\362\\j\017"
+	.text
+	.section	.gnu.lto_removal_lengths.0.50.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"d\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\004\005\001\006\025\001\002\006\b?\202\210\200\030\1773\276\0014\275\001\274\001\273\001"
+	.ascii	"\003\004\003*\002\314\017\212"
+	.text
+	.section	.gnu.lto_valid_first_character.part.0.51.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`)\002e\022"
+	.string	"fcwF\360\316(\035\343\03601\003\271\263\214\203\303\352Z\314\020\244\253TD\316\366\024\337\312\372\326\315\020\334\227\303\340\321\327\370\304\234h<\350\243|\205\347u\230\021\021\025\377\236ne\257\234@"
+	.string	"\344\344\336\226|\262\267\224)\005`"
+	.string	"c"
+	.string	"^"
+	.string	".\037\337b\2309\323\276\212\177\257\343\270\274c\227\346\305\317\356'\362\350\003\335\243\277\316>\n\327\314\266\177\3427/;\b~ h#\0132b\265\333\356\242\036A>\200{\204\017\300=\352\207\277\256\t_~\312h/\327\333\016]\334\204d\264\fO\217\303\021\311\356\272\323p\307\333^`\273\201\2353\001\036ui\216K\307Q\032\276\366+\227\316\347\374\357 `\340f\367B\221\214\355\020\201D\274\347\366Y\270|\233M\266\337\303\323\312\020\236\326\0276#\301|dC\273_\310\243\025t/\333d\230\337q}\033\002\256p\213\017"
+	.ascii	"+\343A\206@\363\265\353,mf\315\3538\310\244\335\231\030?\273"
+	.ascii	";\222\371\034\327q\002#\265MRyY\247 \025\364\305\234\2164\017"
+	.ascii	"\324\202\342\333\370,\356\221\323\313p\200\232\032\3650\0221"
+	.ascii	"YdU\250\334\214\030\221\255\372\017\253\333\335\004\276\017\205"
+	.ascii	"\024\337\346\321w\341\036So\273\310\206\232\211\0240Y\224Zc\205"
+	.ascii	"\207\2534>i\232\203\224\336\370\316\257\001\323\246\322{n\222"
+	.ascii	"\246;\315\251\326\252\344A\013\213EuR\232P\342 \005\262\274\025"
+	.ascii	"\365NTT\320&#&+\017\225Z\241x\036\nJEU\"\001\025A\265*`o%\305"
+	.ascii	"\202j\361<\026T^i|\333=\222CO*c\373\244&\201\321\030\253j\215"
+	.ascii	"\355\r\345\320\307\2104\324\244\033\372X\211\222\232\024\302"
+	.ascii	"M\b6$\340-\216\244%ep\203\001\033\321)I\037\024#:e/ `\002!'\315"
+	.ascii	"\003?\303\335\n\327\3011~7\277\215\023\216\003\034?:xlh\246)"
+	.ascii	"d\343\202\0354\311\363\b\343\030\256\211!\277\021\022!v\027*"
+	.ascii	"\322\354n\2230]\300\bbK\020\234B;\2467\267\201\205\334r\320\335"
+	.ascii	"\007\322{0_\fn\030\366\244f7o$\357\223\355z\313\rpD;\334\331"
+	.ascii	"4k\243 $7\372\004\205\007"
+	.text
+	.section	.gnu.lto_is_full.part.0.52.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"-\f"
+	.string	"f\227RA Q\224\016p\234&b\234\005\006\t\036\321\013HE\220\320\022\220\272R\277\203$zD$MF\2712\264\217m\n_\357T}\352\323#\200 \020\004\005\013\234\231Q\245\335\227\275\331%\362\311\336R\246\024@"
+	.string	">"
+	.string	"?"
+	.string	"7v\027{,\360\213\365\b/\300zT\017\327\0165\243\346\347\306\231\016\025\344H\261q!W\210\240{\021\002\200C\301K\214\0163\376=?8\217L\313#\205\263\273\2764\334\326m/\260\275\261\317 !l\337\376W\262+\266fW\234\371\222\322IH\004\274\315"
+	.string	"\342L\373&\356i'!=\300\256jd\305\256\267y\364\201\353\321\336e\277D\t\304\266?\342$4\333\005\364>p\224T\352\002\212[g\242\272r\346\251\230\023'\250\304a+\315\342\"lA\355\236\fh~\265)T\310o\251\377~\f\035\f\023\013jJ]Y\343\341\252\312\326\264j:_\362?\016\300DvS;t\354\206\330\"\331\003\021\b\272\223\240\023\3120O\350\223e\037L\004j"
+	.string	"\001s"
+	.string	"\na\234E\360\214\260\tY6\302*W\225%\324\3504\363\177\277Nl\214\244\346\252\037\266U\3159\251\207\365\020\352J\006\r\021\025\253\034\254?\210\027"
+	.ascii	"\330\343\277&\20025\317j\f\025\023\001\b\303c\035\204\233\001"
+	.ascii	"y`\204+F,- \022B\347\274\223\235\366\320n\020\204\300=\234\311"
+	.ascii	"\250\247\335Z\r\324\251\313\257-x"
+	.text
+	.section	.gnu.lto_pow_neg.part.0.53.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`J\001\205\r"
+	.string	"6\230WC"
+	.string	"\2216\035\360\211"
+	.string	"`-\322,\337\225+_\2736\305\bC\312\2050\234\223\034T\361\031C\327nPg\031\321#K\021\243\375\017\266\035fxUU\275\326\276^a@\032\006\032\r\252\006\206\324\310\336R\246\024D"
+	.string	"D"
+	.string	"@"
+	.string	"\327\243\273\023\240\036\255\017\240\036U\304\265G\250Ii~\222\270\222GE\331\001\253\021\212\f\211\313p\205\tN38"
+	.ascii	"\340L\340\001\017%d\356=O\270Q\246\200S\025gwmi\270\253\333\206"
+	.ascii	"`\233\201}\023\001\373!\312p\261\357\221\330\032[\2635%\030\030"
+	.ascii	"\033\233\314w\177\331\226\024g\376\305\337\003\354\326`\021c"
+	.ascii	"w\027<Z\201\365h\177\005\211\375\025\350F\264\244\330\366S\\"
+	.ascii	"\205f\177za\333\276\006'L\026<\035\273\0331\257\251\266\004\n"
+	.ascii	"\324I\252?\341\2109mZb\375cfh\240Pe\261?\333\211\340z\357y\303"
+	.ascii	"\205K\311d\2223\251,V\352pu\3051\3230\323\372\356\317\227\376"
+	.ascii	"W\271\301A\207]\f=x\004#\"L\224\201L\300,L\244\343\201\376l>"
+	.ascii	"\241\354\302B\240,\003]\242\217N\204\313\363\0212\340\f\004\013"
+	.ascii	"\271F\262,\344\322\\WL\251\344\200\360\201J\013U\215zb;\2529"
+	.ascii	"\025t\024+\021\250\037S\206\330H\300\200\360\305*\b\007# \200"
+	.ascii	"\002\031Kz\270\370\206\001\254\314\t\220\020lH\f\367N\306\262"
+	.ascii	"\231,r\356\342\357\272\277\307(\214m\024\304\206\036\330\003"
+	.ascii	"Z\323\032\003\355\235\261\2250\037\304\366!\353\007\347c0a\210"
+	.ascii	"\223\003\327\362\\k#A\b\266\213\226\370\270\270w\3411"
+	.text
+	.section	.gnu.lto_compute_latitude_precision.part.0.55.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`;\001\265\r"
+	.string	"F\332YB \217\223\016\230\b ]\201)\3032A\225\370\231\2706\210\002\261\b\352\007\357\f\023V\r5\221\333\236l\023\255\020\201\233\023\203P\253?\001\bQ<I\022"
+	.string	"\262&\026f\232\207tO\233\234\275\267\224)\005F"
+	.string	"I"
+	.string	"D"
+	.string	"\356\fl!D\220\330\366O\034Efw:\022\nu\016J\246\013+3v\267:\364v\002\361\220\372\200x\250 \236]\363e~\216H\237\353\271C\3208\264\214H\032\236\232?"
+	.string	"\233\3355\265\341\206\267\335\300ve\237%-6\332\310?\224(\231H\254\310&\300\354\216\343\363@FL\351\005\346\367Y\336\202}\305\fJ\260\373\234\307\316\330\231\235q\346U<o[\022\2113\355\253\370\226}\205]\034`\367\344\345\305\356*84\002\352P\343\331O\341q#\250\032!\375X\365\351c\210`@yr\246\252F\223\310\203\205\333%^S\317\275\200\013\221\t-O\251)\326\367\267\212b\277t|i\370\322/\323\232\351\274\312\177*K6:\354f8\305\254\t\2041\302\366\003\022B:\037\034+\272cA\207uU\034\253s]\235\352\303#\302\204\212\303\303:\340\213\002\007\244\n\271.\220*\363\267\212\342s\327$\324\250\030lG\365\006\244\232\365O5\305\366c\261z\342\230O\335\335\304\002DvA\0336V!\037\037"
+	.ascii	"\330\343\tm\214\265W\f;\343\360X:\303\021\232\026\337\264\026"
+	.ascii	"\220\007F\270b\204\313\006\bf\345\263\214\222bq\357&\212\320"
+	.ascii	"(\2129\330\331\256\031Q\t\016\005\307t\332\013O#\320\304\020"
+	.ascii	"\204\340\274S>-Dj\n\315K\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`W\004\345\023"
+	.string	"v\336rI\340\3566\035h\242\tq \201\202\347\353\234\201\004i0\254\360\006\203p:\265\251\332YW\300Q\"\207\3655E\fc\b3\212cX\3020\n\316\021?}\220\240}\220\240\332c\326\337+\255\021\333\360\371\370Z\355\337\276D\344\016c"
+	.string	"_"
+	.string	"b"
+	.ascii	"0\227Sm\351\220\245_+\355R\351\233\322\0026r\026\204\322\240"
+	.ascii	"=i\023\223&)\351\230\215\244GF\372E\244AB\332\005\244?b\037\335"
+	.ascii	"\342\321!/\021:H\350\350\216\355\224\262\214\203\310\252\257"
+	.ascii	"\325j5\216n\311\360,%\305\272\004\326\"v$\311\231\006J\233R\020"
+	.ascii	"3\0060\216\343\030\266\307F)\255\t\002\233\b\027'(\230Ng\332"
+	.ascii	"M_0\024\322\230sN\006D\267_\225\251\223\357\201\310\346\301\355"
+	.ascii	";\331\313\336#\231\201v\206R\274\236e\374\235\030z^\365\036a"
+	.ascii	"=\r\337\365#h\225\003\275b\240O\n4\n\217\263\221R\030\201Na\026"
+	.ascii	"B\322\2710\240E\031\226\272\341(-A\210i"
+	.string	"\016\230\216\275tI7E8\034x\261\202<\033X\254\260\255\326\307:\227\333\367\032\357\3436\352\206\222\254H\211\006\270XW\237a\215\252q.S\336\255,V\241K\275\206\371\247\201\316QF\352L\2422>3\241C\235\206\231\304\322\b X\267Y\2601?\304\272[\222yG\347\347\b\203\343\027*pP\234\270\213'\214\327pTA\371\335\207\247\352>\2441\314\250\205\t{\037\372\324\373\025\353\336#M\324=w\232\333=W\232\336\275\2514\371\336\2367\364\336\222\337=\323T\327\225!D\t{s\204L$\356^\254\367\335\311\354\300\306'(\005\336D\333\300\233<\360\226T\201\347\223aN\243\036\013\322V\250A\024\305t\320\tM\322\244Y\016\320\002!\"Z\007\021\360\2544\312H \023L \024\325nb`8\225\347g\331\363\232\311gTh*\360\373\3138\")\022\303\346\322N\016D\373\226\323I<]\346"
+	.ascii	"\201\326\0077P\225\026\361\2526i\270\367\030\026\017\201El\332"
+	.ascii	"JPQ\203\377\213\211G\200?1\231#C\316\372tH\n+\313\246\377*\250"
+	.ascii	"8\210\003\362\225H2(\260\311\3777\345z\277\017\0333\334\022\270"
+	.ascii	"\030\340~\346G\3077\027\013\211\306\206#\245\366\326\354\212"
+	.ascii	"^\255m&w\343\335\032JV\304\320\373\037D\321\273\005\330\006\035"
+	.ascii	"\234*"
+	.text
+	.section	.gnu.lto_.refs.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\004\b"
+	.string	"\003\025"
+	.string	"\026\031"
+	.string	""
+	.string	"\0267"
+	.string	""
+	.string	"\026:"
+	.string	"\001\031"
+	.string	"\032\026"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7a4b78ac86ce1d90,"e",@progbits
+	.string	"(\265/\375`\254#E\231"
+	.ascii	"J\356`4R0\022JJ\007\372\266\017\020\221\350\372\f\020\246\250"
+	.ascii	"\304\216\302u1^\336\177h!lu\177\356\270\271K/f\265R\353\255\276"
+	.ascii	"\265~0W\270\332\347\225\207L&_w\307\335U\305yU\305\2071\304\324"
+	.ascii	"\025\001\367)\220\333BV\326Q\213\b\245V\223-e\n\271\0027\003"
+	.ascii	"T\003\276\364\354T\317?\324\263\223z\336\2412\032\020N\332\264"
+	.ascii	"\334uzF\303q\f\255!\210\t7\227\244\323\020}\313\f\235\315\370"
+	.ascii	"\340\300\321\344\256S\336\3432\206\203~\360\344I\315\033\031"
+	.ascii	"\307=\241\302t\352\306%\007JH\247g\267\237\307p\333\243\355\034"
+	.ascii	" \345\242\362eI\247:k\032\217\360\261\230\2413\333\b\037\263"
+	.ascii	"\271\336\261 \250%\310f\247$x\204oM\235\262\244\252H\247%l\022"
+	.ascii	"\tZ\\\247g*]\262<\371\013\247q\224\275\260\017\214\306e\254\306"
+	.ascii	"fg.|\366\022\353\275I+X\327\320\225G\201\222B\334\244%J\350&"
+	.ascii	"\370\207\324X\214\311L(\227\"xe\321\335\273~\002+R\272\252<\n"
+	.ascii	"\304s\357\224\327\363\336{\246\362\017\361\312j\034\366(\267"
+	.ascii	"\215\335d\220\03677X\242\360\356\275\016\224p\240GkH\030\245"
+	.ascii	"\020\351iP\3732\t\337\211\026\324\377[>#y)\270\004\352\317d?"
+	.ascii	"sq\027k\261K\035\316;v\357*\"\210\313\207\221$k\020\317Y^\017"
+	.ascii	"?:\3451\316r\2062\226K@\301-\022\354v\335{\031\272\302yo\222"
+	.ascii	"\241Az\367&\203\230Q0\243H\247P1\201\372\322C\240>\205\372\005"
+	.ascii	"\324'\240\236\204z\037\365\255\236`\022\276\224G\370B\2641\t"
+	.ascii	"\337W&\341Sy\204o\006)?\273Q\362\"\252MK\t!\376\016b1\370\316"
+	.ascii	"\337V\336\177\2770C\013\r\305\205\353\374\235\325\300\213\037"
+	.ascii	"\360\367\322\013\022\016\364\367\bw(\220\320?:\004\025vj\367"
+	.ascii	"\341\321\377Z^u,\234\200\277u\300A\3673\013s\377\277\314\311"
+	.ascii	"\022\367\013~\273\301c\220#\362"
+	.string	"3\233.?\007\327x\001\340\177\003\227\340\267\023\374\334\201\232\377\374\366\246\271\372\333\001~\206\376\234\214\373\331\2013\377k0\303o<\354\363\366\002~kO\250Q\367\263\002d\330p\333A\374\215\346g\006\304\374\214A\2301\377\353\256\367\237N\316}\376\216\376\274b\355\347#`~N{\317\337D?S\360\246\3613\332\317\\~\376\372y\353g\254\237\243~\206\372Y\310\317N?\347\370\331\306\317\310\237k\374\214\303\317\307\237\211?\333\360\363\357g\031~\236\341\347\026~v\341\347\023~~\3613\t?\227\360s\213\2373\370\231\305\317B??\360s\003?/\360\263\357\177\233\237\373\377\336\1770\377Q\370\237\345\177\f\377\343\374l\300\177\026~&\340\347\022?\217\370\031\200\237\177~\336\371Y\347\347\364g\3733\377\374\377/\376\243\371\377\366_\313\1772\377\335V\370\277\301\377\265\377&\366\366\366\366\376\235\264\337:\371\t"
+	.ascii	" Vx\332\224\270\241\351\264\253\264\224\327\023\275uGMG\325\272"
+	.ascii	"~\365D-m\021\373b7:\353\223\232\0264Q\242t\227z#\016\327\273"
+	.ascii	"\313\256dO\242\235\366\024&S\347~\020\213\322iK\341<\020vi\340"
+	.ascii	"\324\265\233z\226\302\335\204\313\272I?\341Y\246_\360\350.\323"
+	.ascii	"\307\003\335\303\233\253\256\273N\333Ikq\331\243\275u\236\244"
+	.ascii	"u\rc;c&N\214Zc\207\037\365\275\271(Q\322L,\230\323c\312\2227"
+	.ascii	"\223\250N\230Y\034\022\206\266\\\0304\252 XX\235%\242\231\201"
+	.ascii	"V\323\3636} yg\375,\b\313\313\226\251\237\365@\321\261\266\245"
+	.ascii	"\323\267\322\312\252\257\332y\357U\2725\364\232@\351\214\274"
+	.ascii	"\2578\257\211\330y\r\201\243\276\241\272HTS\211\260\336\246\035"
+	.ascii	"&\266%4\274\333d\246\370{\352M\365\250\317\275&t\272\270\326"
+	.ascii	"\326tz7-\305\243eE\316\222\2243\310\351FeG\247o'\233\2557\310"
+	.ascii	"\n\036WRN\275\357^\036:\353e*}|\254\303\234\342\377a\373\324"
+	.ascii	"\"\260u/\324\335\235\252e\226|\372\211\233\342^$s\0316\205\024"
+	.ascii	"\261\fK\336\345\2256'\021\313\365J\rp\303\252\356ru\"S'\262\357"
+	.ascii	"z\223\246\234n\222\023y\264\\/\363\256Nd\210\233\344\024b\271"
+	.ascii	"&\221\313\260)'^\2069\235D\334\244\213\274"
+	.string	"II)5\311\351\264\f\343t\n\261\fK:-\223\246\234\370\256\316\313n^\326)\244\322\rK\376\334{u\254O\244\317\275I\346E\222i\246;E\307t\213\\n\223\262V\335{\357E\216\305Q9yV\345m[n9\215\224\356\215\273L+\220\214\\\357\275KW\211\344{\225V\346\275Jg\rM'\303-1\357\317MJ\352PR9}\224\224\316\245\273%\305N\3130*\347\320\231X\330\363*W$?o\334\024S\rC\256w\314\356',\253\251\243\354g\375Te\353\336\033\202\213\240\0059\2026$(\3549\305\210\220n\"\301rCJ\247\357&SQ\361\266\270\361\321\251\317\217\2417\020\313\005MI\257\323\366\361\203\005\214\225]\017\036Q\202D\307:}\363\370YL;\375\210]I\302u\312G\232\206\336Lu\016\332\016\254N\003\330\321LW\2564i\246\277s\264\016\240(0\260f\247\314d\022>"
+	.string	"x\204\257o\f\275q"
+	.ascii	"9I\271\002\355TD/{\351'\nX\017\270N\311x\364\366z\300)-a\343"
+	.ascii	"\346\206\r\266\263P9+\320$\245\252&\347\306eM\317X\211\rI~-u"
+	.ascii	"\022M\222jd_ (\317f\220N}M(9f\247\237@\217\3038oKm\350\216\355"
+	.ascii	"\214\230=Y\217\327\260\235\t\345\322EW\032\335\275w\217\345\360"
+	.ascii	"\034.c=vs~\303p\222\034(\241\2636$\207\0305e<\376\201\313\276"
+	.ascii	"\306q\276\006\001uY\312\262f\246\236\007\376\232\257S\200\251"
+	.ascii	"\347/\225\354GMT\352\256k\356g@H\021\367\202\201>\351\230\315"
+	.ascii	"\317\270\255\271\3060$G3\215\353\270\214\351X\356\354\305j\310"
+	.ascii	"\034(a\331\234\224f\001P\274\260No\241\f\255\201\210\223*\253"
+	.ascii	"N\355\330\320m\026\035!kRY\235\366\360\b\237\265b\257X\261(\""
+	.ascii	"<\304\336\250\267a>)O\266\236v\002\300\202\343\332\261\202\275"
+	.ascii	"\370\222\310\273\250N-\330m\025\217%&\\\214P\331\340\002\366"
+	.ascii	"\3446\312\023\373e\315\370\\$\330m\3321K\353\251\222\243\212"
+	.ascii	"\033\327\355\327\255\227\004\024\234\215\032\345\211\231d\247"
+	.ascii	"\226J\227\235r6[lt\324uj\245<\352\323<\203we\241\334\032\351"
+	.ascii	"R\304j\252\nj\346\351\311\225u\273$\313n\3316\310:\r\242xvM\274"
+	.ascii	"\237-C\2448\231\334n\335j\375\354\210N\275\351\324:9PSL\027\272"
+	.ascii	"\247m\362\363\200\320\262\n\203BD=\004`@\234\234\202\240\344"
+	.ascii	"\345Pb\223\370~\250\227\272\275\262R\026+\275R\233N\313\306\331"
+	.ascii	"\206G\224\273l\246\b\242\002\342\364\303\221[\254'+\247$kuk\304"
+	.ascii	"+\252\364\366\203j\251n\253\214\354h#s7U\227\004\b\2229\365:"
+	.ascii	"gl\224\215\262B\256\310\350|Mdm\346|\261Ov\210%b\241\370*1C\270"
+	.ascii	"*\322=\2643/\315\232\2200\365:Nz\364\260B\342\236>IM\306\310"
+	.ascii	"\232\267B\340\216\2641uj\2030\2312\215\227\231N-\020\316S\213"
+	.ascii	"\256}uj\177\3700\242Z&\313d\235\312\244=Ug\222:'\346\255\323"
+	.ascii	"[\027\257\275Nm\023\223"
+	.ascii	"u\355yi\323\251\335\301y<`7\224\353\223]\262K6\007[\221\355L"
+	.ascii	"9YbZ\034\2679\242sr\334\226tjo\364\036\237\255\035\201\353\324"
+	.ascii	".un\250\267J\2666\312\254\r\253L\261^\244\013JzL\301K\367T\253"
+	.ascii	"T\225R4\r\360\210a\345\351i\371A\313\022\365\246\3238q,\222\311"
+	.ascii	"\263\347M\r\226\036\366\336\"\367\222\304\210t\332rzOF\235St"
+	.ascii	"o\216O\023\037a\230L(A\273:m=\316\313\222\302\202\353\264\363"
+	.ascii	"\030\316\354\311S\016\033\036^\324\363)\365\264\346\345\315\233"
+	.ascii	"\276{kz\332.mX@\260\324\325\365\235\006T8t\300\324Q\211b\367"
+	.ascii	"\276\003\221\005\315\334\234N\273\r\227\272fM\317\361\275O=:"
+	.ascii	"\226\002g\314\025\271\367\\\020\030\250\246\261N\233\r\223\331"
+	.ascii	"\246\244\\]\222\267\267Ns\355\232\270f\212\240+\255\037V\235"
+	.ascii	"v\0329%+\0170\235\266\231\216k0\257\250^\334\231\224\214U\222"
+	.string	"\273\252m\342\244U)\2433\226'\304G\031\270\037<\350\304\300\261\\\317Y\217!b\212\250ll\355\306\367je\265\275\335|\314\246\2549;\3551?\363R%%H\236e\243zSv\372tGZ\207I\35355\265^\343\313l\"\347\t\346\275\266cfDGT4\375q\306%\306N\275=;k\264\263\216\372\272\274KGO$\261\321\335\246\217/\357\350\231\317\032\037\264\340t\332^~\0264\006F-+\213z;eK\233mi\252\262\262\246\232kzZ'\352-\325\225\326r\245\241\f\334\313\253\263\211)&\326P\021\220l\364\236\267\311\314\362\206F\221\200\221\261u\332c-\365\344\r\352\253\323\306\362\250\317\0200`]\226I}\323yy\265\0255\304U\316y=\301\336\001B\"\261\003\"\235\034\210GD\303\340Q\030D\202AD\364s4\016\211E:\351\215\212\206\277\"\214a\360H\034\372\304\240\0214\236"
+	.string	"\026\177\302\"`\214\023G4\210!n\244\302(\024\376\212\214\216?\032B\306c\020\206\020\322p\006\0045\220\206A!\004+X\020\261\260\240\206P\016\304#{\004\032i"
+	.string	"i\370n\244b\3060X<\032\205\2001\220\204E\303\240P\321\210$$\200P\2104\034\022\207;C\240\260x4\372\216t8\026\025\025\215B*F\344@,\032\035\211\303\035\031?\2400\005\026\221\216\322\"\360\350\b\211x\3349\032\201\305\037\360\204\"\020\007b\021P\005"
+	.string	"\202\"Pa\024\376p \322"
+	.string	"\026E\f\201\036\b\221~2\200\036\210\340\340\006\236\303\360\202\013*\244\200\202\t$\210\020\002\b-.\260\240\002\026\024\254\230@\002\022\303\017\204B$\020\214#\254\340\202q\204\036\027@E\340q\blq\004\206\360s4\"\331\020\343\027T\300\220\0304\006\213\200\305#\242\343OH\004<\"\035\321 \026\241\230\001\034\022\345@<\002\332\021\n\221d\020\031\203@$\"Pq,\376\216T\024\201\307\242\037QP\370\303\301\0040\206\017h\324A\370\033\376v\216\303\240e\241\005\027(\334\340s#\025\300\343\017\207`\361\210H\201!1x\f\032\211GDG \214\237\321\221\360Gt\004\316 \001\214\201t\f\316\030\022\205D\300\035\202\302\037\215\"q8\302\3508c\b\024\022\365\034\213D##\2211\250\276(X\004\016\2013\324\257`\001\001\013\013j\354"
+	.string	"\2050\220\2101|G\"\337\017X\344\300\207(\354\033\r\211B;$\2728\376\\\020\265p\361\002\304\361'\264A\243~\001'\036\001\213BG\"\261(\324\243\022e\fG"
+	.ascii	"\306 \266P?4\324\342D\013'\204\240\026\251(\022\022\205\200\302"
+	.ascii	"\031D\342\f\241a\360GC\bFPH@\361gT\224\002c\020\213R\340\016"
+	.ascii	"Ac:\004\n-\317\321\370\023\022\035\001\215\352\321X\f\312 \212"
+	.ascii	"\361;\342\371z\343\306\327\231u\003\225\313\332\272k&i\310\244"
+	.ascii	"\252\354\266|\\\232\276\304\332|\001\265}\355a\325\331\034\255"
+	.ascii	"&\310\236\024]4}s\005\305e\256\327\254V\334\334\223\234\205\n"
+	.ascii	"\222c\223\202c\223F\007\007\034;\246]\323V\316\254\264\226X5"
+	.ascii	"\026\31143V\325_\203x\226b\312#h\254\022\304\217\035\315\271"
+	.ascii	"\270,5=0\321\372\214\333\016\227\036\324\254S\013gy\320\2737"
+	.ascii	"i\341\332\232\261en\341~\303\356]\231Q\354\304EY&}oTrXH\224t"
+	.ascii	"j\335\332\266Y2\267nv\214O\222[\n\304\214B'\252$i\305\227~G\t"
+	.ascii	"\333\225\033\0279b\272\254\r!uxa\372I\357\315\255\301b\327,V"
+	.ascii	"\027\330\233\"\235Z\265\266i\026\314\255\332\327\325\252%\240"
+	.ascii	"\307(\202\206hIs\342\213\242u\264\257\356UF\260*\343|S\360\236"
+	.ascii	"\242D\251\366\313\230(=*\235Z/\267F\316\224Y\003\353\324v\271"
+	.ascii	"\255z\352\241f\313\354H\030\2666\235V\271\345R\245\243i\331\275"
+	.ascii	"J\fv\233\230wI$\005\207Yk\322\322\251-\2735\373y~\242\220ZP\204"
+	.ascii	"\250\026\213%\263[\250\342$\231:\375\216\017\365V\313\334\327"
+	.ascii	"\222\270N-TU\332Yj \315\021\203\036\250\322\311\224c\201\f!S"
+	.ascii	"$\"2\222$I\007\242\n\020\004\"q\036\tj\007\022@\0251S\032\306"
+	.ascii	"\314\310\210\210HAA\n\222:\215\001A\035\240\225\002G\206DMM\302"
+	.ascii	"!\037\305\346\340~\320\272\270\235\003\212\013j\335\227\b\r,"
+	.ascii	"?\027d\203\340\343W\340\337\005U~I\335Q\3166\376k\030\373[\277"
+	.ascii	"b\363\315$83\205e\215S.\035A\224\r\340R@\346\"\355\216\n\341"
+	.ascii	"\207v"
+	.string	"a\350\201R8/\016\032+\374.5=\032M\024W\332\367\013\255\374\245\261K\200\364fn<\220!'Y\364\263\214\244\2417\030\342i\331\227D\2052\325\324T#!y\326\204\275\357\351)\301\221`\212\177\002\201VjG#S3\307Fz\372\2068V\217\366Ja%\216\324\301\003\235\222&\201\312\244GO\336\371\204]2\371\324\007\373\336!T\375\275\251\031:\251\375\177)r\177\313\277\304\331L@\335\205\265\260\223\020\252X\334K\273\312\227\312)\030-\220\252\340Itb\362\230\362.{\2169\335\342J\332\f\251\005hxTRx\217\342/j4\005\232\001\b\017\252A\327D}0\225\350\n\255\231\203\264\247v\3311\374\201\rE\\\215\264g\f\004uE5=Fy\251\204\027\377\230\367\201H\363\304\022\b\016\024p\027sr\272k\345\n\273D\323\037:\301I[\202\264V\254\317\336\326\311\211\013\321:&D\320"
+	.string	"\202#\214D\327\330d\\\021\374\022\"P\237>\343]F\303\354\262\216t\021\226}\n0\226%;+\256e\265\303J&\" \006p\355E\372\0048\275\003o\242\266\206\006\247\036\273\263\330\253b\034\322\n\245\255\365+\206\224\225\372\253\036.\261y\214~\332\n\354\216\346\016\207\205\326\271\037\016\226w*\356\342\204$\365!j\314N\345\262\"\356p\301\325\227\335GN\314\231\316\244d\275\337\352\303/\277r\343\026d\304,0\270c\2670\336\311\033F9\355\244\n4K\254<\350\351\341\372\315P\354\246\231\r"
+	.string	"\\\373\345\250Z\0022\331\250?\327\227\267(j\034D!\341S\007\217\362\256u+\246E_\251z\004\n?\271\276n\237/\224\305H\266\261[gb\201\235C,\210\300qL\357\330\032SN\342\220\035\033\013\221\311\006@\034(\320\001"
+	.ascii	"\207\206\321\353\3702;\2567\217j-\330\222\264\333\324P"
+	.string	"[\350y5\315f\205D\356\"\367\225\t\254\241\252\305\233R\033\345\312\fZ\247q\225g\241\034%\271\202\035\223\f-\271\212\355X\013\301_\003\365EN\004\266\341'Hj\342\242\023\320\267D\227\020\346\322\255\221\225<\244h\344t\242\024\274\270P\246l[/a1\367Y\253]\342\300\323\330\002&\301oI\316\312\247\246<\251+\355C\2467\243\217j\356\373\253_\354\210\004\016`\231\0013\222\026ah\276lD!\002O6J\362H\345O-\201@d\031\306"
+	.string	"\0233\006X\336\327\017!\3308\210\243\"\020\b\251\"=\323\334\321\273\365\036\277;\003M\364\342\214\232D\252\344\262K?'z#\313\353\017\350 \270\fk\374\225\3713A\300;~\262\212D\270\211Ux\207+\033\355\267\214h\375\242+\255\022L+\205l\001\025\274+\342fv\344\331\313J\bAS\b\354p\343\312 \321\227\326Lh-\212\320G\354lA\341\344\254\031?U\206\3246\020\2228r\342\033d\246AK1\205|\326\003V\375\271&\033\235e\257\252ezH\246^A\244\375\357S\200\340\375\237L\017Z)\242\005\345Il\013|bK\242\366\226\215\303\2441\276\017V\325b\t\333\244\335\222B5\200\300q\331\035\244I/\3208/\264\361\303\2451\250h8\274)\200\006F\264\245\242"
+	.string	"\017\240\021\377-\2475\373{}\025\311\256G\241\217?\256f=\303>\214\3079\332\362\354\360\r\212\020<\325\324\374A\273\222h\252U2\252\245O|U]\240\370F\342\t]\257\3215a\3361E\363\032\302x]\236\246\nl\342\01624\034\216\261\225\304c\275%\220\322B\016\004wA\007\261R/\265\250\272\002*\b\024\237\033\330\364_\302\206\257h\317\360\204\272&\256\037\334\313G\271"
+	.ascii	"\254\r\352\3239mk/\302\211\311=\232\255\253\323\262N\255L\247"
+	.ascii	"\361\337\033\013}\271\314\255\243\013\342\270a\367\300\tegl3"
+	.ascii	"\260\217\367\347\323q\350\271\232;\264J\223\214\235l\275\204"
+	.ascii	"\303\241s\243;6\033p\375ri\273\301\274\317"
+	.string	"\316\270\301\206\262\261\360\224\337|\234\332\355\376\267G\006,~gh!A\023\352}\023^\234\t\310\272\345\234\266\333\351\341\232s\030\003\025\373\200y\217\336(\276\230\\\030v\322/\356\3751\013\026\023\221\035\316\327\373\211\306\002\330\026\214a\036\366\363%\250\233t\241\256o\271\354\214\221\356\"\342?\277\361_\230\036\214M\222\036\335\341\361B_\325\343\363I\277\262\360\221\340(\306-\366\227T\332\245\2355<\251\373!G\030\264\t\343\004\243\255ksk0\2613?\277\t\263\3301\237\302\004\227\375Ak\216\243n*\3723q\265l\313\347\311\277u\033\351\246g;\021\177G\341\035\313\313\201\2374\024+\350\2672\337B\367\355\362\324,rgn-)\215\231\007\246\326\201{\2065\205g\261-y\372\303/\006\377\206K\260\017\371\353C\347\237\357k\201\027\036L\310m\323\301U\013\210\276\341\331~\336I?9\260\335\345\303\345"
+	.ascii	"\267\335\034a\3170\235\224\365\341\332\006\263\026\340j\243\310"
+	.ascii	"\bg\034\026}\244\205\315a\262W\276\036=\375\217\337\237\374\336"
+	.ascii	"w\256\"\227\343sL\316\315]\237\244|\256\0374'\204;\263\243\274"
+	.ascii	"\302\340\355\351\177\322\204\352\314Z\223\3461\2168\361\2413"
+	.ascii	"\273\255\220~\332\323y\307?\017Ve\027\347\326\352J\217#"
+	.text
+	.section	.gnu.lto_.symtab.7a4b78ac86ce1d90,"e",@progbits
+	.string	"OLC_GetCenter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"OLC_CodeLength"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"OLC_IsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"OLC_IsShort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"OLC_IsFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"OLC_Encode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"OLC_EncodeDefault"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"OLC_Decode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"OLC_Shorten"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"OLC_RecoverNearest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"pow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7a4b78ac86ce1d90,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
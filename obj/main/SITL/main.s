@@ -0,0 +1,255 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\364\331\344\206\003"
+	.string	"\001\314\337\304\332\f"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271@6\200\005"
+	.text
+	.section	.gnu.lto_.inline.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 p\005\002"
+	.string	"\244\002d"
+	.string	"\002"
+	.string	""
+	.string	"\005\325\377\217\211\002n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\002\013\001"
+	.string	""
+	.string	"\n\001"
+	.string	"\004\200\200\200\300\002g\001\n"
+	.string	"\b"
+	.ascii	")\033\256*\f\313\016\335\232\315uY\220\303l\036\006X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\360\034"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\002\006\177\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.d1b39c1c70f21ea0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.17.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.18.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\225\006"
+	.string	"bL-4Pm\222\016$\023\n\255\322R\223D\016\0223\007\324L\035\362\216\36628L\333'\311Z\3274\327\212\337\314\314\264f\247\301\242Q\3041<\023m4\262\211L\001k.\234)\263y\234)\263y\232\252\363.\004S\013\n\325c\240\250\352Y\276\210]\207\330/\265\204v"
+	.string	"\276\301\301#\223\300kl\377"
+	.string	"\321\372\271\035\r0\341\310\"\360\352\037W]f&b\306m\210}#\n\024\220\021\373h\362\210\024\220dV\254\250d\026\215l\374\265l\375\211\301\304@\211'$%3\037j\214\315\252\303f]\204P\335EQ"
+	.string	"\024j\2230\231y\373\200,z\324\037\363\037\374\030\001\n"
+	.string	"6C\301\325\254\320\274\262\226F^\260"
+	.ascii	"r\300\355\264\3312p\343\n\305\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \256\375\002"
+	.string	"R\004\020\034\2405\351\017V5\024!%\001\214r\264\223\377\377`\375\357\030\242\231\361\272\204l\"S#3\321\222\355\260MuH%\320\255{#`-\370\253tw\207\032PY\315\367\237E\265"
+	.string	"\034V@\377L\013"
+	.string	"`\340\033Bj\314c\305\303"
+	.string	"\365"
+	.ascii	"0|\256\372)..\237\235\306\323`\216\001"
+	.text
+	.section	.gnu.lto_.refs.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d1b39c1c70f21ea0,"e",@progbits
+	.string	"(\265/\375`\231\003\245\032"
+	.string	"\2061\260J\260XQ:\262e\376\261S\302\235\303%\034U\232j~2\236I\370\013\017\027\013\260v\256\315'N\367\242D\006k\311:\013Ou\363c\354\247Q\200\3708\371\2409\340?M\372\203\026l\027\205-$\266\336c@r\262m\211L\001\215"
+	.string	"\221"
+	.string	"\240"
+	.ascii	"\3358\013\202\310\362\224\240]\327t\216\324\341\214,\r\020\316"
+	.ascii	"\0065R\021\233\345ids\236z\347Q\343n\345Rg\373\250\203\274\335"
+	.ascii	"x\326\333\276\356f.5\247\r\"]H\331\007+\361\217\026\0039_\016"
+	.ascii	"\362U\356\366\331}\003\254\252py\341\013)\016\337\210\224\007"
+	.ascii	"\210O0\236\227>Cv\204\207\343\271%\006\340V\021(\340\370\263"
+	.ascii	"PS\022\231\237U\374\177\372\017\374\357\364\377\367\277\367?"
+	.ascii	"\310\177\361?\223\377\252\251\251\251\251\377\262\377N~\225\205"
+	.ascii	".B\372\037\247[\335uW\236\274\312*O\262\313\246(\223U\336.*\320"
+	.ascii	"\247\214.\257\255\324\326\356\256a\337\316\361\314\316\331J\242"
+	.ascii	"\274\275\353k\253M\347L\233\362\222\265<y&\227\2475Y\235\353"
+	.ascii	"\3329\262h\314Y\263lbM\233\362$\3152\3073\371\332f(H.\257\002"
+	.ascii	"\365I\326t\267\356\036U\232nr\3275J(\324\274-B\r\2439\252\307"
+	.ascii	"\225\321\006\272\273\372\202Fvuq\035U\"Y\031Pw\260\205 T\256"
+	.ascii	"\267\273\203\032W\271\033"
+	.string	"\350\356\002'R$\251\262\304\b\336\b\351\231\305H\204\b;1S\017\361\217FP\0230\335D-\272\344H\215%\\\344\354\244E\n\220*\301\220\336\0133\375_\211O\206\306\210\t\351u|>\376\3314\356\212oK\002\251\025F~P\224\307\225\245\034!\375\207\361,\204\317s\323\017n\342\336x{\350\200\016\335\322\0270M\224\324\232\221\272A\205\311\313\271\367;\210p-4\335J\335\215@&\n\022\216!!\375\2041\374\305\356\0242\267w8\032\361\347\263\fs\353\257a\0253\370O\273\013\334&\223\272\214;\200d\227\271n3\332\354\005\013qs\233\321f\3642\327\002[\254\347\207'&\203\371\254.se\350\200\201\303\353\026\023a\333\271\341\364\354\304l:><\264\032,\346S\263\301f\032L\354\364\304x\b\320\013x\215D\314\366\272\325j\266\327\f\355\307\246:lf\213\321b\"\306C\220\320@\002\205\022"
+	.ascii	"n:\016\036\334h\263\237\36199\025p<l\2700\302\\\264\331\316\210"
+	.ascii	"\027\314\346\363r\261\2248\235X\302HA\375\214\204\223pOU\352"
+	.ascii	"\354e\321_\213\031F!\375\345\033q\344\001\342\323\023\367\230"
+	.ascii	"I\301\020\024G\024\207\027\237\222\220\021\b\344\236\001\253"
+	.ascii	"\262\"\025A\250\201<D\224B\"!&\030\221\240\002\332$\017p\202"
+	.ascii	"\241\262\343\006\020`(7i\335\352\222=\021\256\003w\375\037\214"
+	.ascii	"\334^%\234!K1:\257\230\201\3537$\022,\375oBL\252\322bt\261\315"
+	.ascii	">H\221\3605\243.v\2475\216\t\203\321\255?)\315\202\301L\317n"
+	.ascii	"\342\201\240\225\234dF\232\340\006\022\b\321B\351\b\3645\263"
+	.ascii	"\017\032Bv\005\355\275\304'\312\031\022\334\246Ny\352\234\362"
+	.ascii	"mzex<_\260C\324\374*\376\370>'8W\213?"
+	.text
+	.section	.gnu.lto_.symtab.d1b39c1c70f21ea0,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d1b39c1c70f21ea0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
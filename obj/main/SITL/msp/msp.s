@@ -0,0 +1,6811 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\270\r\275 "
+	.string	"\246\350\211G\220\226\3160\006\206\205\371K\233\220\350\211\264d\271\370\007~\205y\340Y\310H\276^}VU\360\023BF\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\3502"
+	.string	"\200\226\273fU\027\221\322\033\264D\254\260\216\236hG\344\274Fjd\267\233\210\020S\224\001r"
+	.string	"k"
+	.string	"}"
+	.string	"\303L\003\263\317\024\330H\340\001\253\314\307cT\300{\214\016\363\376\362y\200\215"
+	.ascii	"\336\213\353\304\211\027-wg\003FP\3709\034(\374\\\270\271\360"
+	.ascii	"\375\2068b\210\034\031\360\367/x\360\337\372\033\370\357\335"
+	.ascii	"\267o\032`\216\023cf\276\355e\241\225\035\351\355\260\347\202"
+	.ascii	"\016\305\215\375}\335\024\346\251IQsY\177\t\2060\013\363\341"
+	.ascii	"\242\247\221\262\264(\212\324\342Z\034^\243U\251\027}\026\255"
+	.ascii	"\334\260\032t\317\260N\2649\321:4\206U\310\270\361\335\343\027"
+	.ascii	"\364\344\026N^\341\344\024N>A\347\225\020a=\350\240\201\006\372"
+	.ascii	"Y\367\331gu{\326y\346\031\302\372\203\325\301\307\235\033\254"
+	.ascii	"3\030\271\340s\235u\005#\023 \370\3009\343 \277y\267\331\346"
+	.ascii	"\036\234\314\334\223*45\3575m4\330\262\314\030\bS\350\334tP-"
+	.ascii	"\227\233\347\256y\232/\327\227\357\313\317\227\037\327\336\222"
+	.ascii	"78\036Rj6\331\202\327\0265\365\324y6\307f\005\352\311I\352\250"
+	.ascii	"\241V\232A5\022%\2044\351\331\342\305\030\020\246}Z(dNv,\355"
+	.ascii	"p\030\327\003\207\230\322K\021M\304\235\226$\323\304\n*gH\352"
+	.ascii	"\263\253\261E\354Hwzo\272i\245u\246\365\241U\225\272\272\272"
+	.ascii	"[4\216\364\352\222R\322:\322z\264\006\252\276\264\260\274\030"
+	.ascii	"^\233vJ\210\224u\201\r\006\366\371\227\371\327_\n\342\023\351"
+	.ascii	"\007h\034\016\364z\352)\227\265\037\013<&n[\277\"\335X\212 Z"
+	.ascii	"]\033w\210qW~ \311\302:\336\363%\251[\233q\365\001\347TQ\344"
+	.ascii	"L\316*\370\206EF]\225\320Bs\315\365\326[s\235\363\3269Zz\326"
+	.ascii	"\347Y+\2614x<?u\214T\225\252\273\273\253WVU\253\252=\253\207"
+	.ascii	"\016J\365\366"
+	.string	"\334\316\201\016\250\221\311\240\204dDR\220$i\rQ\005\3269EC\273\001\022\240\023\021\315s\214cH1$2\022\221\004\221\222\244\234$\255\001r!\366x\\Bl\316O\003\0341q\360\"\\\244\361Zl\213\277\303~\026\374*\265\212\322\002\377\320\263\202\270\275\225\267\265\373\205\021w\362\242\317\322\037\022\377\370\217\334\315w\207\356>\207*(\201\007\035\3438\365\261\254\313\017\267\206\364\312]1\242e~\235\302\207Y~\215`K\325\2434\236\033\021k\324\201\236Z\264O\361=K\241\332\231UP+\r\264L\2472\tT\253B-*\"\020\220tA;\257\212\235\032\361\016^\236g\205\0045\350\016\nF\332\233Ag\006\304\307\225\033\263'\301\252\2009\300\314\037\254\013z\244\237Q\236\257\255\0053\005\365\201\265\347\\^\372\331\373\276\266Q\253.\033\361\242:P\263\362\361\363_+&(88\347P\260|/d\275"
+	.ascii	"\312\363\347R\243*SO5\277r\202\245.1\320\273\323\036/\333\037"
+	.ascii	" o\360\003M\344\217\215\356\324\351\312\360\263\310\3440\024"
+	.ascii	"\204\255\202\240\334\023TS\216\234\217\300\256\361\377\211x="
+	.ascii	"\315\352ru\252\n\206\314&\027\307\356[\211\331\253\206\3241\\"
+	.ascii	"\343\021\b<\334\325\370\007\234\322\367I\025\244\027\210\367"
+	.ascii	"\004yA\"{\370\372\205I\347\233F\037-O\325\365\353\353\260\247"
+	.ascii	"D\347Ow\217\330\"I\372K\214}vO\370\362u]\377\026\307\212<\241"
+	.ascii	"~\347\340 \242Y6n\262\230\253[\345\023\214\273\215p\311^\rZ\364"
+	.ascii	"\362\021#\320\350\263\271\3004\232\003Ah\007\367Sy\373y\215~"
+	.ascii	"m\237i\254z\271\002\307\220\327\233\257\271Y\353\245\256-+=\202"
+	.ascii	"\253E<\316\273\362L\215,\247\352\203\203\034\037\242\353\303"
+	.ascii	"X\240!\261\035\300\302[\312I\272%\277;\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`u#]\036"
+	.string	"\206\321'\037`M\222\016\344BmB0\336\377\253\353\272\363%V\020D9\235p\250\302 I\263\215\354\235R$"
+	.string	"\032"
+	.string	"\037"
+	.string	"+E\307Q\316_J\227\331\\\215$\300l\311\250%\3322$\321\037C\242\240\351-\032\213iE\207\373P\240\"\373\367\333{\033m\333^\375\243\367\336O"
+	.string	"\307\315\243v]\352u<\220\337{\277\277\373\356\356\273\373G\352b\320D\276\026t\205J\320\022\341\006\035\030\024\034]|\002\007\316t\035\356N\274Did)\211\320\344\213\315\020\365P:L\027\365\327\247j\330\177\367UU=\201\270\250\021bJ*\033c\201\005\0061\347X\021\347\022 \201H\206dQ\020c)\203\f!H!C\210@D$\230\021\221@Fh\2326u\321\004V>\2540:\374\205\253\016\307\332\377qsw\255\240\276\0231\304\310\236\342\271\303\206\222\272+\254\024\376s\325\260\224\235O\307\3539\302\t*\332\350\337\031n\274\361\377\243S\231\343\351S\372\007\212\203\340\227\317\334\016(TU\021W\243\2558\200\032\220d\306Nz\322\375"
+	.string	"\271hf\377=\214bzH_\321\332\331vk\370\r\307s\b\034\325\306\004U\341\177;\365\257\247\223\336\207\214\3302\340\351'n\215\331.#*fN0Us- \223/o\304\023\036\034\033\366#\241\301~X\334A\330hIEB\241\200\341\220\344\336-yp\3275)d\342\237\177}\333\316\266\333\326\265-\002\371\205]\375i\037\256\245\274s\337\355RE\n\244X\207\333\257\367\366|\361\321/\f\232<)\224B\002<\226\227%\220\337\002?)\357V\025\353F\033\214\256\003\376\016sA\303:\326\brHz\237f&\337\212\263S}LG\226\362\240"
+	.string	"H\242\030\021Q:\223\034\271h\371fz\005Y\006\354\252\341\376-X\301&\026\216\222\"\022afG\227"
+	.string	"\003`\375SmP\324$\320LQ\361'U\220\021FB\264\212\213\203\245\221?30\252\36744\203"
+	.ascii	"\276\214\032N<\250\354@@7\362\221\330\037\2649\241\231g\222s"
+	.ascii	"\007S\346{\262{t\332\304\243#4Rky{\252\\H\212\257\"\355\353\352"
+	.ascii	"\351\212\b\344\245_\034\002\361\266\037u\263\227\273\221\201"
+	.ascii	"\362\266\r*\214W\222\373\316\227:!\224)SF\353\034\266\221\275"
+	.ascii	"g\332\2201\304\255\323r?\027\023\265Eb;\373\034\370$?\203*\257"
+	.ascii	"\305\363!\217taT\305\312"
+	.string	"\001\317=\f\016\b5\r0\360\237\230\r>\231\320\3406\312\332C*\336\377\277u\227m\202\0172\207\023\352H\317\372\013#\232$>\246\353{\266$\035\241\006\0317]\003\031\300Q\377\242i\271\344y\252r\020K\f\310\035F\335\340\216\370\202:\267L\350\220\256Y{\212\312E\t1\006p\227\271\271\237\203ny\227\347\315\n\313\355\241\306\354\007T\220\005,\223\255\362\215\230\304\020C\327J\276-.:^\f\263\335\342\352\266I \300\020\242\230\341\271TJV\265t\214\n\231a\272\306t\007A-L\302\356\241\\\307q\332\322\252\256\272U\373<\022\b\240J,y\214\370\013\027\241\226\316\265\314\305\336\355\207\213\350da\222@\347;/\265P\231\237\\\304P\\2\203\354\360\267\006=0\007\022\002\277\261f-f\371x^\350\270\336\324?\214z\336\357\310\004\221\316#\324\023\272\342\226Y\2223W\250zF\2105{ "
+	.string	"\267\251%\276qD\004,E"
+	.ascii	"R\363\203\231T\324\023Z\0304\\\327\315G(\214\363\261\252i_\337"
+	.ascii	"\326\201\3134\200\350\242\007\322r@\007\275\274\020R\253\r5\343"
+	.ascii	"xf\273Lj\366\362\003"
+	.text
+	.section	.gnu.lto_.inline.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\034@}l"
+	.ascii	"\332th\027A`\246\316p-xD\316\026|\3348f\024\350\221\216\347\032"
+	.ascii	"J\3459ukL\3179sG\242\270tf\342\202\372&\251\t@'wSj\351_p+\023"
+	.ascii	"\t"
+	.string	"\227T}~\024\376\310\336\220\261\337\332\336R\246F\001b\001\202\001\333\375\355>2\023\310\222#K\347\356s\367\221\353\372|\261\303t\264\373h\367\324\311\004\262\244\325\253\335W\273\213\214\346\247\356H\321\327\356#I\024\317\276\276\2765\341\177\032\274\207\302\260\256\266\371\2709\033\016\017\026\254?\364d\035S\2004\030\307\223\276V|\265\003\214\355\264\242\224\356\201\377\003\244\377\371\202\\\331\032\360#O5yle\032\360\277U\254\305\306\214\303p\"\364\017\236\027\376\356\244l\240\206\237~\203\347w\357\244\334;)\317\177\205\277M\367\366\350\277H\300;)\203\354\323\247\307\023\312\2251|\200G\217N\361\317\276\361\334\376\221\245^D\261\200\177\025'\301\230]C\242\337\377*^t\377\317\340=\377[\361\362\277\\\266\212s\240\377W\007\031\260\212q\240D\337\031\f&\f\021\274\347-\375\030\345\260\3566\372\215\254\326\335?\364"
+	.string	"\264\252\316\260\356Fp\246,\376\027\311e\335WF?\025\377\350n\001\374\257\325\t\246\033\353\300\331I\211\036=\023\367|>\236\335\335\302\377\230\242O\333\316S\361~\277V\314\244\273)|\367wR\362\377\340\371\377|6rw7\360\327\321\335W?\377Ku\366\351\356\244\277\300G\250\001'\220"
+	.string	"p\222\356\226p\023\337/\221\233\313\346\030\3607\236-\203\3154\227o\204/\261\351\036\375\252Gh\257_#\376\021\272\213\242i\367~\337\273\273\333\337\365;\354EQtwwww\273U5\355u]\327u\355\341\356\366\242\3043\013\035\036;\212\370\314\017\236\261\245\253W\247\330\354+\r\233\201'>\236|\\\314:LF\376Zs\347\315\203\257\3755*X<\311\334\232\202\224\240\230\t\227\345\007\375:\305[L\344\3560}Hd&\\\326\336\360\273o|tC\226\307\271\033\352\314ck\323\003|\232\236R\314\222\310M\370\272V1K\363\222\364aw\027\031\313X\2247\341w\247Xig\346P\323\231\321\356\356(f\302e\375I\341"
+	.ascii	"\177*VR\327\244\313ok\351\377\036\275<=y\360\360\334\331\315"
+	.ascii	"\321\221\213\3635W\3634?CF-\304\007\017\0320X\230\020\241A\202"
+	.ascii	"\"\003?g\360\030\265<F\202l\232\232V8\327}E\341\005\026E\217"
+	.ascii	"\246\377\021\252\256\373\237G\350\272\376F\274\253\223\362\017"
+	.ascii	"\236\303\377\b\375p\330\377o\304\334\351>\355/\212\242G\321U"
+	.ascii	"\327^\277\022y\331\\\226\r\370\360C)n.\233\333E^\202\346G\355"
+	.ascii	"\301\271\317\r\305G\373hK\245O\373i\360\303\376\260\247\270\271"
+	.ascii	"lv\360\001\347\262\271\204\243t\365\252\221\305T\t+\242t\356"
+	.ascii	"\037\325+ \327\026'\227\006\347\330\277\003\004\004D\337*\006"
+	.ascii	"3b\250\356\202\016\343\273\177\321~YU\325u]\327u]\207\303\377"
+	.ascii	"\314|\336V\177#^\373/ZF\233\373\037~\227\215\230\031\375\026"
+	.ascii	"\n\243l\013>}*\305`Z\344\354=\210b\2626veEDv\242'h\316\213'\356"
+	.ascii	"\222\324\343 b}aKE.\023e\215\217\201(\356!\005\2152%\236`f\316"
+	.ascii	"\224)\nF\235o\314\262Vz\032\305ij^sIS\374\3066\246U\201\310f"
+	.ascii	"pi\226\304\223\312\234\0334+\345\273\314`\300\206h58\212\306"
+	.ascii	"\271\321\265\017\256\263\271TO\355\214\023\2513\2517\245\225"
+	.ascii	"\264l\251Q2\235\273\211\254\266\304\263d\373(\232\246]\222z\235"
+	.ascii	"\312\340\036I\274\265\023\257\351_\2674h\314\224i\343\262e\273"
+	.ascii	"\352\354\324\231#\347\315\rM\333\327D\200\330\220\341\002\005"
+	.ascii	"\t\016\030(\330\337h\r\374\264b\256\036sz\216\236\374\316E\021"
+	.ascii	",cU\326\213\317\270\320\035Y\255\263\370\367h\021x\376\257!\203"
+	.ascii	"\363\360\331\021C\372\n4\352\264\253\202'n\237\236\310q\334\310"
+	.ascii	"-Q$\363\2703\373\032\360\373\337\202\227\233\300\026\234\203"
+	.ascii	"\371K\305\205\006\355u1\270\212,\340\177<\241ta\251\255hM\250"
+	.ascii	"\360hz\n\225\310\310tgn\214\024\361\016Cw_\353\235P\004\177z"
+	.ascii	"u\367\201\007\377\377\242E\032Q\365\2546\372\363Y\002\300\033"
+	.ascii	"\214\343\347\027yz14\346%|1MSU\375\217\320\377\b=\2576\367\367"
+	.ascii	"j\357\325\341\220\231\367\233\246"
+	.string	"\377w\335S\370\343\223\317\350v?\235Z\360\320\230{T\212\323\320\250XA\317>[u\322\226\236>U\257Jq\227\244\236\030t\352\214s\243\273\013\026O01\201\322\222\216L\267F\314l\251\244\r\343l\002(\213\335>m\364\351l\002\310,\213\211\f\226\265\207E\300Y\355\263\332E\036\023\373\312\003p\265\2576\362\364\202Sf%\003\222\367\374\310C\007\303\361,\362\265\207\016\323\021\003\022\001\350\352\331\026s\3119\037w\273f\205\254r\203,\220\375!hO\f\322\327\352\004$\247P\362d\363k\251\037\372\037\241j\272\016\177\341\017=\022\360O\327}\332P\274\343\216y\265>]\267\237NCg\275\206>]\323~\272B\235W|s\326\320\247i?\205:\353\364\n9A\237\366\211\034\205/\231\344wN\033+\375\215g\037\262>X\302\224\3062\2209\256\2563\371\307\332\340\034\373\355s\371V\207\030\320\006\343X"
+	.string	"_\031\347\231.\246\334\231\217\372\261"
+	.string	"a\211K\177$?\351\373\"\024\203\377\027\231\277\310\223\354\n\233:\035\016\365\377\310j1\214x\270\215\032\271\017.K\331\364\364)1\203\301\250\302\033\317\220\221\232\021\021\221$I2\034r\n\020\222EQ\320A\n\261\007\022\200\360h\214gY\036S\310\020B\b!\"\"\"\"\"\"\"\"I\222\244\003\347@\213\235\3735\350\271\\\006vT39~\201\346\0036\3144\177V\216\336\254C~E>\0300W\325a\2025\027\310\027\204\366(\036\n\034\r*\215sL\254\240Y:\344\371<\315I\312\243X\347\034\227\270,\035K\367+#\007ywx_\013\2014\234g\303\310\240\021\215\222br\342\237\211C\245|T^U\355JF\007f\254c\255\245\020w\211^\305;x\251\375Q\256F8R\253\234\"^\205\203\233Kc\376$j\334\365\221$\230\032s\250\031\2538B\032\025\337\244. "
+	.string	"\377\323v\016\230\3275\233;\251\375c:\r\273\236\371\037*\031\035\002\2718\177P\321\b~r\023<\320\t\034\003\263\254\"\206\275\245\021\354e\033\303\312\320\210\326\202&\330f\3232\226\217X\252\215j\0019\367\253\211\260\2252\316\217<\024G6\t=\024\023\271\207>T\326\223$\001y\3205~\031\0234?\234\2525"
+	.ascii	"\212ygOp\267~\220\001\013[u\271\306\245\206^Zr\227\243\254\022"
+	.ascii	"\240\356\335\n\355\321\032\221%\336,\370\226\n\035Q\3017\027"
+	.ascii	"\207\025\225f\303\355\221\360\312\035\332(!0i\003U\340\023\003"
+	.ascii	"\274f\327\271/\362\022\215\250\226]\321\374\254z\207-\212Dh-"
+	.ascii	"\301\204\3773\344{\314\253\201-&\335\200\2079\276\233P\237\036"
+	.ascii	"\201qj\246.cq~\366\306\211\0050\230&n\001%[,\020*o\266\245\204"
+	.ascii	"<1\246e/\322}\240 (\240\013\357\276\003\230q}i\253\004\032\240"
+	.ascii	"\302\nz\221f\301\362\t:\207\f\356\004\302\033\351\346@j\224a"
+	.ascii	"\001\243T\301\0208\325"
+	.ascii	"\362BC \262iQ\263\t\035h\346\313w\365\313\n\267F2\376\323\244"
+	.ascii	"j\306\032[7\361\306\266@t\273\023\330\"\216b\343l)\331\013\357"
+	.ascii	"@\"\026\346U\237Q\217Y\026x\206\260}\030/\347\363b\255\252-6"
+	.ascii	"N\254\031s\301\\\217R\3434EP\006\242Z\202\342V\203\367#2\345"
+	.ascii	"\n\217\200[\237\243\005&\241=\267\b\274v\211eN~\311\251\017\n"
+	.ascii	"-$x\316\251E\314Jw%(%\235\370|<b\313?\324?\314p\037MzAR\351\265"
+	.ascii	"\245\267\016\356Gw\270\033*\335;\022"
+	.string	"\373\001\250\203\253\341\335?e\t\261\305l\334\3678\344\331\262\033\326^\310\005:\273O\274\343\255\266]\r\354M$\324\200\204\314\"g=r\257\217\215.P&\031\366\312\024D\327\033\200\303\301\027a\020\t\360*K\366e\257^z\001\305\346\270s\267:\001$Z\311P\243,w=\257\241\"\025r\227\274\327\2336\231\370\364\205\022\226\037\310\r\213f*\225z\255\240R`\214B\033\336>\243\341\360Ur\364\275Y;\034\021F\331\0028\257\"\2371\313\340\360\350\353\f\236\236\355\354V&\031b\206`~\027%[\336\225I\2769\032\342\003,>\030\347\371 \257\220\022o\005\242\330\321K\262\323\300\240a\256\260\277:\231u\342\306\217GfdH\232\351\274'\340\177\355\202\236\264I\331b\250M\310'|\026$\242\244\002g\004\302E\2135\302\020\"\235\342\np\001\331\b/\244\345\330\227\230\300D\005\357\013C\202u\300\353"
+	.string	"\236yd\271+\257\355\247?\304|\031U/x\350\320J.e\016_(\033\001\n\331\021O\230N~>\\N<g:\271GN$\262S\007l\370\320\002\030\276\251[p\337\374\235~6| F\261\204SV\3162\320\375Y\310"
+	.string	"v`\333\006\0036%\304\261QmfV\240\320\300vqc#\326:\346{\007\367\277\350x\t\200\177\217\341\370\332\252+N\322e\320\224\316mJ\305q4qp\335C\331"
+	.string	"\214\305F\204\212\036vB\272\377y\024\n_\033'\036\312\312&\210\224n\365v\017\315\305\261\0072\237&\342\367\211^9lED\336\3754u[\005f\026\237\344\n9\177^\332[\253\210\337\306|\017PU&\324\243\234\320\001Hb^t"
+	.string	"/\211P,\025J\017C\306\256UB\306\320f)>\365\267\203\335\300\026\003}q\353\207\207\262\220\274\020gM\212\027\335j,\310\231\0210\311MHx\230B\035\321\027\214\0352\3005\3733`\234\345\002\233\332\210R\2328\371\215\323\241D\330c\340\376\376\227);4o\021\311.\212\344\305\372\266fpR\241\320o\272\364w\212\245\007F\017\320\306\364,\205\204\374\223@\2522L\250\370\r\347\374\177\323D,,\320\006Jg\212~th"
+	.string	"{\0351\205\332UW2\267\305\306a\200\376\027\322\244T\327\f\303\307$\311\275\211\004\372\221)\026p\341oz\251\017wj\006\256\261\3434\235\241f\212\206Yw\230\3530\n\261\216\244\2226m\027tW0\372\344P\210{\034f\320\242\231\377\f\2428\344F\f\340\037\b\203\245/\026L\200|\013\005\036\220t(8\002bP\306\270\n\262\3660\222*\216a\220\240sY@P\013\321\371\002\245\346\304v\336K{\177\274\303\003\352`\333\304\033\3672\207\323\020\372\342\2612\227L\340\260\246\317\33421\2233L\321\226TZ\272\271\365j\034\266\327&\204'*\351P\033b\224\215\2011\003\247\224\350yg\n\013\345%\210\223gX\211\276$\030\3708\314S\370\b\013\203\215\322{\007 &\250\352c\367o5\321gtNk\200\303\003\370\270M\354\317\016w\002"
+	.ascii	"\\\001\247IH\b\rci>\022.QG\336\\\370>\344\241G\001D\264>!\353"
+	.ascii	"/LF\346\376\217`\215\3212\n\326gJ\235a\231\207\214qS\003\202"
+	.ascii	"\223\370\335N\246\324+8\0331\236\231K\241\254\256\210X\247\277"
+	.ascii	"\253W\236-r\236\f\n\201r\321\0264\\J\273\021\266\300\204t\335"
+	.ascii	"\201\241hxp\271\303-d\345z\354T\327\336-\375\f\0203Y\002\357"
+	.ascii	"\216\306\022\324\311?P\2605N\266w[?\216\336&\230\355\335A!\316"
+	.ascii	"\017\227\371\241z\206\0060\3116\231\3667\323\223\035\206\306"
+	.ascii	"m\200\205\256mivaZ\261\270\253\345?\255\001x\013\f\025\320(%"
+	.ascii	"\300ef\024\207fk\021\376g\323k\313k\303\327\337q\347\035N\035"
+	.ascii	"%\335\027a`mF\221)r\233s\236fBn\030S\b \265^1\027\3122A\302s"
+	.ascii	"\300\361\343\2665\343\032\230\367\276F\334\007\257\207\264F\353"
+	.ascii	"\025\347\377\031\001\335\263\024\341\311\214\361\305\362\031"
+	.ascii	"-\315\030/\316\2578i\265\031\271\270\244\bB\016\311x\225->\200"
+	.ascii	"\344\310 \250\031\353\b_\241\027M\327-\366\337,p\031Q\316\310"
+	.ascii	"b\261\020M\276\021\314\r\363\271)3K\374=\203\242\362\216\306"
+	.ascii	"\240\203=\310G\\\214\273\r^31`\334\013\357)aY\264ls\245\250\240"
+	.ascii	" \016\352\327\212\374Cg\370+\346\234\321\325\251C\367\341|~\032"
+	.ascii	"=u\201\007\254>\001\253\355\321\2339-\310F\354\371\314\244^\333"
+	.ascii	"3t\345\241\304\236W\002_n\250{\013\024ye\r\374p\322\bK8`k\271"
+	.ascii	"&\231~}\270\376\313y\024@\311\223\341\352!R\022wD\224\\\341\""
+	.ascii	"\205x\364\263\311\351\n\312\252\202\265\2220\362fv\024\345\253"
+	.ascii	"\371\241\3720\206k\344\367\350G\3453\032\320K\316O\370\035@\330"
+	.ascii	"+\246\003\362j\343?;"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\003eMQ"
+	.string	"&{\243>\340\332$\303\001\312P\263Q\031\271\223\347y)w\264\234a\313\302\214i\324\211\334j\030m-p\252\270$O\"\203v\245F\370\006\016[\371um\3364\327\031\"\nF\267\232\264M\310\226I\006\210"
+	.string	"\225"
+	.string	"\222"
+	.ascii	"M\346\251qr(G%\023\024u\242\237Y\323\2747\032\325\001\250\243"
+	.ascii	"\371\206J\366^s\332F\032\035K\003]r\n\250\246\232&\320J\265\246"
+	.ascii	"s\032\317i\235=\232\367\336kW{\312\350.\362D\356\024\341v?\355"
+	.ascii	"\335O\353TQ\213\354q\235\313\336\233\247V\272\263\367vm\211\272"
+	.ascii	"\022&\352N\324\215\032\340&\350VQ[3\366:\177/\272\024}\277\264"
+	.ascii	"\220\311\277~\264\222\256\024\020\247\200&\351(j\324\252\317"
+	.ascii	"\003l$\t0\001\016N\223Z\365eR\353;[K^\241\345\2121\343\2521\226"
+	.ascii	"\277\2623\271\3319G\202d\316\371\333\264\237\334g\257A\212\200"
+	.ascii	"\274\321Z\266M+\243yd(\023\213s\032\233\264\372\007^\207\247"
+	.ascii	"v\341\260^L\242\242\260\004\227%R\324i(W\016\035\327\216\320"
+	.ascii	"\364\322\256X\003\332\246q\233\326\t\344n|\034\034\366\234he"
+	.ascii	"0\223\213\007\007\302\253\307\345\243\313\270b\024c\"\321\226"
+	.ascii	"\025\n\315\023\347\365\243\335\222\275\013\311+(~U\265\177\344"
+	.ascii	"\316\314\314Skm\236Zo\022-\312\032\333QgF\255\376\251+\375l\003"
+	.ascii	"\311\236w\311\236\216i\244KQ\307^\303\353\320\215\312Fe\017~"
+	.ascii	"\226\341\337\205g5\3523_\013\030*lQ\270\243\212:\201$\367)\323"
+	.ascii	"\332\024%_\202\317k-\331k\222)\312\262ppjj\252\344vgR[\314}G"
+	.ascii	"\313\244F\276\371\336{dL&\0320\220`\007\346b\361s\271(\257\251"
+	.ascii	"\231\247\025%{!N\205\0324\310\222\205\"\177\316\267M\273\312"
+	.ascii	"\235\005\n<\345\316\277\312\037\2402\251\205\266\334\004\375"
+	.ascii	"\001\244\020a\003\204\212$Gl\225\207\2476n\215g4\267O\227\366"
+	.ascii	">]Z\347\025\243\354\2406k=\245qO\2553\306\250\017\275\367\030"
+	.ascii	"{.\2677\0027\2141\346Fu(\032\252D\3144\272Z\314Q\0269\224\342"
+	.ascii	"a\033\tA\213:Q\307\263\3633\020\344\207I\272f`\005\377\224\207"
+	.ascii	"\247\374\223j\300<\265R0\312H\327\276\270%\007\323j2\231L\373"
+	.ascii	"\204i-\177\r\272$@@[\370\210i\253\340r\323\345(\227\306\350P"
+	.ascii	"Nn\353\020\024u\377\324-\370Y\207\255X\231RZ\003\203l\250\262"
+	.ascii	"\354\212\315\210H\222$\031\326\302\t\020\204\343\201\034g)T\017"
+	.ascii	"\022@\2008\b\304r \007Q\fEQ\020C\214!\204\030b\224BF\221\221"
+	.ascii	"\221!\232V\007p\241\331\276\275\001m\210\224&\331\b\222\025F"
+	.ascii	"& q\331\320\304\362\031\336\254d\206\246\rMW\217ZU\220\271\""
+	.ascii	"\373\276\351\340\200\315\213r\240\204q\254\017)5\257\031_\271"
+	.ascii	"\357\203,U\276\330!\303\345\246\371\202\234\345Se \004`\345\r"
+	.string	"}\034~\b\306\346\007\240\321\351)\326\304\353\177\220eF\310S\217\210\211\276$.\035=\022c'\336~Q\310\367KD\225\242+\344\356c\220\312ycQ\322\316lW\213S\003\273N\371,\034\326\313Y\231\322\364\022\254B\373\373\b'\342\0070\230\266\277G\t\344\002\310\027\252ET\241w\334\244\031\035,4\004C\227\350\360\226]J\230M\371\324\330Wo\240\310\275\223\340dd\250\234\305e<\225\177\276(\376?Y\245\216\271K\374\276\270\201b(\0240\024\037\255\211\372|6\032vr\330\331\303m\230% V\3348\004\322\\u5s\006\020\177\374|\003\304>X\026\340\216\272`\007\200\244\032\0067b\003\343L\002\2772\034\332'+tH\377c\212i\370:d\t\315R\022\325\n\215&\025Dy\230\2254\270\264\271@eTbG\256\240D\345l\030\243\226\bT\034\337\013\222[\317\353\005\361O?\2750.\242"
+	.ascii	"\245f{\266\203\001\372>|\213\223\266\247\251\3203\344\257\311"
+	.ascii	"Qp\222\260\265i\310\n:Q\324-\005<\262-\2750F~\\["
+	.string	"\265\235\004.\334\017\340\223\244\201\264\0205\227\250\277>\025\034i\252:;\322ciE\223^q\204\022\325\334\270\376i\211B\372i\321\002\r\373\363\207J\215\303;\016B\272\250_\277K+\213\221g\214g\"\246\323 ZY\bSC\2434\260\202\030\201\350\225E\260\035\265\r\322_\367c\324\250\363\257\272\365\217Y\276\233\214\251\3256\376\252\312\242\253 \004z\277Y\350}\"\337\337\271yr\365\277d\002z\005\f\024~\317`P\006\251\204\n3\037s \224\303\241\245k\032\201\375\001-\n\004\371\363V\021\335\316\327J\031\366\253\243\262\227\007^\253\n\351wW\227>\0177\211\262:d\004>\374\3673\2061\232\370J\324d\255y\241U\341RGN\255h\321!M\275=J'n\345\034\3013d\300c$\256}\243A\027\021[\027\fO%\360\246Il\361a\202m*<\354\b\353\373T\036\244\016@\371II\025\326"
+	.ascii	"@\013][\313(\207\006b\323 \356$H\3219\273\346p\220H\255\342\304"
+	.ascii	"}\203m\002\334U8\013\003\017\004\271\346\351\213@\225j\033f\351"
+	.ascii	"\204\274L\241jn{\346\313XV\364\003\177I6T\240\261L)zd\r\320;"
+	.string	"iY}\021 YX\341\245\305Qr-\211\031\202#9\230\332K\316=\211\273\317\005\360\021Y\305\310\366i  \253,mc\004\224\355\313fh\243)\t\375\200\"\232\035\t\372e\367Z\311j~.P\241\316\372\347\213\263\265\fd\241\305\254\212\207\300\313\302aj\305\265\341I*Z>\026\346;A\371\r\250\222\247\273v\204\202g\337\256\232s+\364\356Yq;\366}^4,\004\020\263\274xRQn<\200\026\0265\223\216\350\323!\352))\344*\033\3758\355f-\007A\2049R@\214&\316\341\312\302\345\312\273Qj\273\027\013xr\344\220~\212o\262\006\237\224\315\300(\025/\2351\3055\3102\212m\215\267\210/D\333\200\026\006\b{U\271\237\032P@1!\342\314\274\237\035(\324\021O\365 o\365\311`~w\022\323/\344\024\005\205\236&3\215h\326\270!A\200\377p6\352\020&\364\373\355\231\023"
+	.string	"9:\221\272\032f\325\342\035\217\341,\261\023\330\244\361}\354 \004XAa\352\207\001\305\267\276\244\325\227u\223\304.-\342\307\201\335\343Z\031(\n\005T6\204\262\177\"9z\373T\030\215\254\343\265\317\212s\266'E\001\n\271u\322\331\307'\350\026\027dA\343o|E\370Y\002OsZ\350\371+\222\271\2354\265O\313\237\333a\020\326\214\333\2577\203\254"
+	.string	"\242A\352\320\247(\2245\356\214\341\262\360\303\237\0341\206\234\007~\236\3049\376}RT\214\337S\311\205\026`\203\033F\204\006*\216`+\211\177*6\215l\374Q\337\023\256\276%\241\277\032\263\037*\343'<9\226.\203\225G]\222"
+	.string	".\"\355\321\371\253xF\325\016b\376\016\0339w(s\351j\225\343\270d.5\231B\325\177\372\313\033g\340\306V\255u\3031\307\347,\233\204q\2750\037t\337\264\227k\373\263(\275\271A\360P\240\277\324\345\240~(b\223\024h\020\023\221\345V\013L\262Aa\327m|\200W\0225\251\001hP\214\377\017x\250\030\003\\\177\335p"
+	.ascii	"\271v\354\034\025\r\301\177\225>\357q\210#\004YH\376\224\255"
+	.ascii	"\241p\r\027"
+	.string	"\202\243\212\031c\004\t"
+	.string	"\023\256i\f\016\254\360\242/qUc\350b\205\b@\305\277\215N\374i\0201O\214<\332\332W\004>k\324\350Z\355\333\367v\354\320\224\023\177\035Q\337\277 \005\233\240b\314\324\016`\244/y!T{Lt\342\t7"
+	.string	"<\316\353\234\315\344\242$\265\245\347\207\017\006\234\360'GX)\260\245\237\324\337}\211\321%\332\003`,\022\374$\231\255G\267)\303J\311\305[\375J\221e\225\\T\250\211\205\362\027\346\362\n\300\021\005\221\352$r\r\310\261G\213\314\017H\021\315\344L1\256\326\304OcVx\200\375p\245\252l\356\237|:+e\016\0273\302C\254\250U^\177\377\005\273\365*\345B^\037\251[zh\bA(\037\377\267 \036\006\334\222\361\373t\234\021h\030\354\016\251\372\202\306O'+B\240\tX\211{\246\2244/.?Q\312\320\035\204\303L4I\020|\331"
+	.string	"\377\222\300\230u\260dL\0038 \221\201\020Y&\326\313\027\215Z\216D\231w\257\370\366\305\255c\327\206\370\353\300w\3248\210\354\205\202\276L\005\376\326\206\241\242\361#\325\251\0016\260\355l\020\035\324\245\004w_El\270\251(\226\206\271c*!\374GY\217\272\252\207\r\337\301\211t6\312mY\251hq\256w\333\230\365\350\t\304\200s\226X\346\207\210d\2513\036\345\236\270\307\312 \234\fW\013\251\245=\211\310\203%\025\271*\274%\350\333B+h\"\003\207\006+\201\245<\257\360[\263{\023\304$\317#\007\020\302\370\271B'\367\035\274\021\002\266\r\356\300\335Z\025\017\216\332E\341*/<;\332\277\341\307\362\200'\360\324\262\362{VO\304\230=F\"\324$\203\3112\0272\033\371\351jF\271c\221\335\322\245'\202\307\331"
+	.ascii	"\254\234<\263\243[\370\302n\262\200\306\242\321\241\013\027N"
+	.ascii	"\313\235\2120\360\363m\312WH\275\bO2o\033\341\372\350<$*\253"
+	.ascii	"y%b.\3179\246%\200\330\253\360\027\345N\214B\221\210~\370\245"
+	.ascii	"\006\2571XO\260\t'\004s\227\215\034hx\003\022}K\214\216\355\250"
+	.ascii	"\373Q\340\325@U\256\337H/\f\2445\364\201F\033G\016a\221\2663"
+	.ascii	"\323\312\344\341Z\364\306\310\276\345\203\312*[dS2"
+	.text
+	.section	.gnu.lto_.pureconst.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375 Ve\002"
+	.string	"b\005\022\034\2207\351\357\366(\255\252\252F-\214\272\272\242\0023c\340\377C\304IZN\331\255\355_b\"\356\341\032n\341#\334\301\025|\201\017p\327\214>\350>\327\271\315\n\346\3052\325Tn\222\232\346\023\231\3074>Sf\266\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`R\003\265\020"
+	.string	"\226\326I;0o\223\341\223!\222\022TY\200L\247"
+	.string	"B\315e\350\307\300}\202\023M|\213}\374\272\037A\224\233\371/q\344\257\366\263\302\201R\270\252\252\271\341\330\355\321\\~\255%{K\231\0024"
+	.string	"5"
+	.string	"B"
+	.string	"\020]s\345\260\\\203d\254\316\274\2656W_\332\230\006H\210\342\324\366LM9\030\245\323aO\235\033\312\230\206\310\374\211\261\222y\2373\244\004P\376\007\370E \"Btf@h>t\322C\331+\366\222\034%L\373\364\364$g\345\354\320\356\034%\367\204)c\233|\264\265=\334\250\271ik\205\026\r\323s\361\254|*\037J\257\"EF\222\272\026\2042\006\037\354\200B\362\312\343\216\006\035W\020\016\203\235[\324,`%\244\220TA\231\340\337\353"
+	.ascii	"\024'J\001ox\336\214\3678\007\336\343\314\213\211\316\013%FF"
+	.ascii	"H\210t^F\004\033\350\210\n@;\217\310\242\216,\250\035\206\310"
+	.ascii	"\002}\205\377\243i\002Q@p\222\201\003\306\211\347\305\346\275"
+	.ascii	"\327\\\033\237\360&y\246E'\206,:?\272\256|\224\204\311\025e\204"
+	.ascii	"\003|\250\021I\246\230\321\024\224\024\n\303\001p\002)bEv\021"
+	.ascii	"\320\2612H\2234\333\001Q\320KP\222Xy:o\354wd\302\330\221\203"
+	.ascii	"W'\0030\2578\n\300\227\375\3052\373\213\021\3260z\315|\340\335"
+	.ascii	"H\241\231\"\205\250\356\243\023Y4\030\n\027\366\251P;z\303\230"
+	.ascii	"\024j,\333D\336\016\001wY0\370=x~\031f\376#\2224\020\00421\001"
+	.ascii	"(M\237( \325\bL\260Z\351\255F\307w\363\301\2208\301\221~\363"
+	.ascii	"@\356\200\034\350\357q\356@)\024Hr _2\031\322K!\303\243\367\205"
+	.ascii	"\027_j\3635\223\225\013X@L\022\225\345\336\332\266\311\005w\232"
+	.ascii	"\317\345\362\367\nL\342\245\364\253\006\330%\"\3315\005\0367"
+	.ascii	"\003x\035\2421\353\004?\016;P4S\f1[\352\324\373\227G\266\317"
+	.ascii	"A\225\314\270\263+cV'\333\336\310\245"
+	.text
+	.section	.gnu.lto_.lto.aabe339913cf58ea,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspDescriptorAlloc.177.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"E\007"
+	.string	"\002N13`m\322\001@_\035t\201]\366\360\341\257*A\325\356?Z\273\234&\273\314ZtA@\344B\276\006\013"
+	.string	"@\b\244\331v\276\266\326\362\363\325\222\275\245L)\306\\\252k\202\3255A\206\205\204\tb\254\013^*\246*\005\0136P\224\005%m\357V;V\313F9N\365x\f\031\374\232\372\007\n\316;\256y\304\277\260\203A\371\370\347\033\024\375]\001&6\271\331\232&\265\302\276[\355\330\231\316L\377\t\204J\016\266\335\210\355dI\236H\206\355\214-\371\237od\2149\315\"\013\360`@|\230\354.\264\274\022\375\271\017D\177\3529\366\304\374s\334i|@b\246yR\020v\327\0313\211[o\273\3006\201\355\220\f"
+	.ascii	"%\013\335\264\030\t\023\f\002\246\2248\251\270\263\250\365\\"
+	.ascii	"\310\217\303\\\026\214\f\327\212I\230d"
+	.text
+	.section	.gnu.lto_mspFindPassthroughSerialPort.184.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\230\003\215\031"
+	.string	"\346/\245I\260\326M:\375i\"\001\225|\242\300\024@\no\300\0015L\337\021\372\020\036\360;S01Q\";\311\312\254m\237\347c\370a\311\220l^^\347\360\356\224l\326\356\254F\024\257\331\026~#\034P\2715\"\215l\"eJ\001\224"
+	.string	"\202"
+	.string	"\223"
+	.ascii	">\317\256\357>|\20601\222\270UI\315\331[p\351\026\361\322\267"
+	.ascii	"q\243\034\313\b\364Z\354\270\226\246nJSs\366`\356\375\025^\212"
+	.ascii	"\027\020^n\320e\037EV(\301U\231o\264\243\b.7\373\210\200\305"
+	.ascii	"\216\212\213\247\2518\013\034\223\232\226\274\330 Jq\336\021"
+	.ascii	"\020\231\350\321\220\347\022T12\365\003@\356\006\302V\334\206"
+	.ascii	"\216t\325\311\201P\360\274'8\221TK\302\224\343\371\332j\341K"
+	.ascii	"\350\311E+w[e\301\3149\255\270\334\316\335\272\355 \333\016\354"
+	.ascii	"\205\021\363v5d\177\311v\324\357\343(\305M\005\007l\352\263\237"
+	.ascii	"t%\032\377\2057\324\350q\227~Mx\371\215\340+\352\241\351\317"
+	.ascii	"\356\315tu\366\367\367\373E\361\002\331V\277XV~t\253X\235\362"
+	.ascii	"\335\355\222\352\226\250\036Yj1T\263Bu\b\252\245T\203\240zA\365"
+	.ascii	"\007\264H\371\254\b\242\332$\275Y\342g5\241\244\223\214\037\375"
+	.ascii	"\273\253}\373=\037\351\310\0038{zs\347<:\240\214\246\\\304\313"
+	.ascii	"\3339\001\333t\363Y\302\205L\020\347\264\275\370O\026(\210/."
+	.ascii	"\307m@c\251hG\323\237\257\240\354\204\344\352\354!T\331\002@"
+	.ascii	"5p0\261i\225WT\\\273\302\005=N\205\265\342\206J\34128k\037\302"
+	.ascii	"\252\246?\313\r\235\344\036\351\340\214'9\212x\\\235P\200\016"
+	.ascii	"\240\340\33212z\034\313\036\260\355\314\273\340\376\346\243\351"
+	.ascii	"\317\307\314\256\f\362\243\272\216\007\250\202\232\351\325\205"
+	.ascii	"\236\204\236vu=\374&\237\b\334\320\374\331\34139J\234sv\237_"
+	.ascii	"\335@xi\305\00534\0318\304\036\264df0\340H\350p\023\263\031\035"
+	.ascii	"\343b\203S\003\343@\203\241\006\026s\203\003sy9f#s\003\353\020"
+	.ascii	"\213\335\300\\\275yp.\220\225\345\313B\025_\233\262:\266S\344"
+	.ascii	"\215\037\332\326\f\202s\3169\256\316\020ND&\3169_\374!\032\""
+	.ascii	"\264(y\355y_p\244\211\352VD1F\210\253\313q\303\374Zk\002\342"
+	.ascii	"\204\265:\237\367\221\306\317\267,#\222\\\224\\Y\327\352|\b]"
+	.ascii	"k\001\250\211s~fAVR\2637\025\234w\030m\301\264d\206\255\225q"
+	.ascii	"[\033@\2501<\"@H)\205\020\tL\002\022\022%\035`\2021bx\036\021"
+	.ascii	"P5w\264\205\311t\r\345}& q\260<\314PR\022\021\314\034\335h\003"
+	.ascii	"\224\364\232A\016\005\226\2057<\3375\007)\3559U\351$O\210z\016"
+	.ascii	"y\313\320\355S\277U\204\252}\346h\262\305\364\242ea\271\271\332"
+	.ascii	"D\005\262({\\\361\336\277Y\263u\273\272'\312\205\324Q\204\"z"
+	.ascii	"\370\372\276\006\013'\330\237C\021\270\256\270PAY\215\372Y\f"
+	.ascii	"\375 *\022\212JS\376\026\210.\262\363&\002\254N\017T"
+	.text
+	.section	.gnu.lto_mspSerialPassthroughFn.185.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\215\f"
+	.string	"\346\230WB\020\2176\035 4#)M\315(\200|\324a\251\242\263\347"
+	.string	"\311%\214sT\302o\377TyQD\307t?=\327\020\270\223C\005\364\006\200\021\032\201\021 \336\200M\004"
+	.string	"\330\240w\340[7\332D\312\224\002E"
+	.string	"A"
+	.string	"C"
+	.ascii	"\231\351\260\372\200\351\320\233\r\3431\264T\b\017\335\211\225"
+	.ascii	"\335\265\024\304"
+	.string	"\267K\232\233\177\321/\236\247s\211\303U*\360\261\220\001\3003\"eHDx\027=3x\270LJ\301\356:=\317\206\033\336\366\002\333\t\3547\b\2177\225i\315tf\372\230\177\342J\f\006\243]\222\321\214M\201(#\036\177\373\027Y\303v\344|1h\270x/B\337n4ph\253z\332/q\023\333K8\027\260\013R9\331\215\007L\240:t|)\335C-\337\211\332\302\244\352\300De$[\234zU}\327\341&\2574UU\370\234\211\322+\202\024+\272\026\\\216\f\323\246P!\357Q\232$>\313\362q\332\261c'\365\203}iw\327\n\262_\362W\001\032vu\200<\230pa Z\226i6\0014\354\352\200\240\t\301>2\214=86\231\210\025!D#by`\231\305\221\361\265\371\300,\355\2720K#\356\245U\220\341'\262|\027\224\223.y\024\367\257\251RJm\tY\336\363\006\212\213\022"
+	.ascii	"\357b\314\3043\243p\b\206\370x+|\252\rp8\306\nF\263L\346:\241"
+	.ascii	"\211\313\273fs\341nF\021\313SW\304\265<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_mspFcSetPassthroughCommand.186.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`^\003\225\030"
+	.string	"&\353\235K\240\326Q:\226\321\331\003}\035\372\220\220\367&\017D7(\320\351\227>>\365\223(\317\261\037\367\217\002\220\240\366\177\1778\2745\356C\241<\037\\)\316\206F\022x\037\326\202U\007\017dX\346x*\243\375Po\355\377\204l\271\223\f\213"
+	.string	"|"
+	.string	"\211"
+	.ascii	"\265\362$\357\230\217\334\370t]$\246\206bd\335{o=\342\273\317"
+	.ascii	"d1\330\313U\222\266\353\216\017;\205\274\317d\261\037\037\323"
+	.ascii	"4\004qXL\323\220\370\227\255\021m\020\355\215\020*\245\243\b"
+	.ascii	"&U\227\225u8\"\344?\202J\326\200\021\241\322P--\314R\017#\231"
+	.ascii	"\220\203\235\261\na\344?\202\037*yt\033\023\036\275\255\255h"
+	.ascii	"\352L\021\376,\001,\034L~|%\022\372ju!\270\367r=\205\3033\200"
+	.ascii	"33\rf>\300\334\013\002]d\233\277_\212C\216D~\325\t\303j\254\231"
+	.ascii	"s\031\352\317w\225\362p\265\260~\315c6\362j\027\231oo;1\377\305"
+	.ascii	"\357r\027\177KY\231\245\254L\273\361\217\221\225I[\331\332\312"
+	.ascii	"m+\327\256|\230S\241YH\024\244\367\026\245P.J\346(\301\314\227"
+	.ascii	"1s}!\364\262r\177\307\0227\306-\232W\346\263x\213\335]l8\355"
+	.ascii	"^\247\253\252{\215\005X\346u\222\215\267\225'_\017E\326P\222"
+	.ascii	"\255;\026\251Uf\n\025\352O\262St\020Q_\363\370\365t\203\367\336"
+	.ascii	"\232\232\021\312\253[\307\261\304\212\251\274Y\262\364\217\267"
+	.ascii	"G\037*i\032\305w\263\2445K\227K\276\232\262mZs\035\212Re\033"
+	.ascii	"\002\020\255\244^M\311\276a\301\306\350\236\031n\325\256\321"
+	.ascii	"A\316$*8\235\372\263\266\200\341\023\364\327\274?9\301\252\262"
+	.ascii	"]L\277S\362e|\306\016?\212yz\352\317\236\362\244\013\206\217"
+	.ascii	",%\275\232V\036\300\242\023\035?\tLS\007\227"
+	.string	"\323\345\004\231\271\034 \323g\005\2473;\310\304\320\214\303\0012}n?<\027|n8\235y\303\261q\016HGw\013\312\345t7\231\361\336\336vb\t-\320^\373f\263\035+P \323\255\261Q\231\320\302\342\325\255\251s\311JfSK\201\002ejP\021\305\002\324\233\26743\203\006\365'\247\3508\201\002\233\007\353\342\203\b\003\256\356\355\375\344\363p0\241\345*\352H6\232\234H\275\232\262\026\324\n&\257\013\225.M#B\205\024\324\324\221\253\003C\250q8\203\214S\304\231\031\t&\310H\013\232\003\220\002\0212\354\006\021p\27562\245\205J\007\2176\206\366\350D\204\373ybPU\315\257\n\277u\b\233\233H\224\357\245\357\322\037&\314E\225\226\215\344I8h@d\212\205\374\310\n\031\r\035\003e\201\366k\036#\020\337\222-@\246Ke\322\311\353d\344\243(\030\203\325\317E\267\315O\262Y|r"
+	.ascii	"K\337\273\370g\347\004M}\222\006[\002`\224\201\235h\016\r\314"
+	.ascii	"\266\031w \222;\355Y\237\300\206\236\0355>\250\006"
+	.text
+	.section	.gnu.lto_mspRebootFn.188.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\254\0015\017"
+	.string	"\006\033bF"
+	.string	"\223\223\016\257\214\376=\3520y\202\323\254!u\002(x\202%z\360\037\376q\214p\001M\033\206\363\336\370\263\266O\342\"x\204'\252\2002~Mw\241]\232\357RG0o]\007\235\374\366\025+!\273\355\226)\005O"
+	.string	"L"
+	.string	"L"
+	.ascii	"\213\301\244\300P\363\332\335-\276\030S\321g\206IOT\221\257\355"
+	.ascii	"\214t\254\302\357\223\201\351\231\210\025\226c\231\351\322\201"
+	.ascii	"\r\030\226\3569\352\bJ;htVa\351\2214\232Z\t\0330!\341\205\250"
+	.ascii	"\330\310\356Z\301p\345\006p\333\033l\177\354\347\004\024*\350"
+	.ascii	"Ak2.\037\256Q\374\354\324\247\321\305>\026\343e\204\343\311V"
+	.ascii	"\365\347i\304\274z4\320\331\345\260\363cY\262\306\t\021\333W"
+	.ascii	"\3733W!\372\n\013\037\260{\232q\263\233Z\340\004\331\245S\327"
+	.ascii	"\346ev\002\363\322\"\273\365\024\211/\320\201\365)\020U\311\344"
+	.ascii	"\210+\337\346Vp5\310\210\331\020.\374\027ne70/3\222\305q3\203"
+	.ascii	"\302~\215\355\326\346j\361\260\373\275E\301Up\200\244A\354\263"
+	.ascii	"8\r\347\233\360\004O\017^\372\336\274|\22497XTt\307R\355)\035"
+	.ascii	"G\022\241\004\324\235x!6\371\240x\241M\002\250$\264\231t\336"
+	.ascii	"\366\321\314\241\234t[\n\307u\233Hj\037O>\352\022\305z\271T\342"
+	.ascii	"\310W\335#3\2728\363`\361\364_f\340\241\222\026\240\376\203i"
+	.ascii	"\203 \200`\221`\\q>xB\001pL\254\267\b) \200\202)\331y\037b\304"
+	.ascii	"\321\220\234CX\226\207\247\223\371-\312d=K\313\213\303m\351\343"
+	.ascii	"\2460\216I\335y\332:\023M6B\232@\022\327~\336lbC/\266\211\036"
+	.ascii	"\313\266\213\3010\007\030l\331o\026h\006\313i7\300\352y2\024"
+	.ascii	"\231\370\320\305\207\2743^\355\357X\347R2"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.189.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\r\b"
+	.string	"\362N55Po\322\001 \2263>sx\344\303\331m\242T\244d\035\024\267\252\307x\372\007I\214\305,\024\243\273\312\273WUUTXC\357Dn>\327pv#\204l\231R\"\215\341\365\343\ti\240\b\361\260"
+	.string	"\212\237L\213\236N\261PC\026E\030\226ENwW\177\245*\310\240,\336Ea\332\30410\353\210K\223xY\031P\251\362\300\371\332\t\212\364\250y:\2410\036\327v\\>\217\326\325\377\367\225Z\233\354\204f\351H\3018\314\374\03354GY)\"\234\266\316\326#&\331l\252p\300_jA\371;\204\026@[\355\334\271lA\013\\\266\272\265.\356@\276\t\321\3108I\375\217\357\303\233s\253]b\200\021\211sn\022\3767G$\016\367\271-A[\203\3260\021"
+	.ascii	"\357b\310\304c\240\321\342\302\353\234\200\273D\350\002\026\002"
+	.ascii	"\201\001Z\340L\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.190.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\220\0025\023"
+	.string	"\306\244}H\320\322(\035\013\343/\267\205\257\rC\020b\253R{CO\t\321X\020\006 \210-\036\002\005\232\310\201\376\2503 \317\333\354p%\204\313L\311EE\001\302n4\323\251Y\321\n\030\013ST,5\364\177#\204l\"eJ\001c"
+	.string	"a"
+	.string	"j"
+	.ascii	"\273\271\221G\027\b\037_\262\375\264\257\363\026\261\343B<\300"
+	.ascii	"\256\215\216\237\335\334\001\023\b\037\235{\310\367\030^\300"
+	.ascii	"\367\350\230\275\3439\024\013\256 \252\275\030\332\335\225\336"
+	.ascii	"<\366\350i\306|\320dd\273\311\036i\356\221n4\327\323\215\346"
+	.ascii	"\211\354\356w\2362\267Y&h\262\273N\333m\346\376n[\202\355\022"
+	.ascii	";\211\002.r\320\322\207Ii\257\264\362\266\253\311\306N7S\231"
+	.ascii	"\235\223\245\236\260\357\355\356Zm\354\363\334\251\343~\024\230"
+	.ascii	">\201i\0200m\212\351RL\223\276\364(\246\303\230\006\277\364\027"
+	.ascii	"\323\321K{^Z5\235\232\276\210*\bGKhW\304\216hu\021\b\347<\267"
+	.ascii	"\237\363{x\\\2761#F382<\002\006\016"
+	.string	"j\250_\217\230\232OA}\255\310\246p\031\025\302]Z\211\037\303\201\205P\305\243\357\362=~Z\272\201\301\002\207\312\250(\265/`\310\333,\002\2432{\032\025\301\220\020\200\314\247|\266\n\207\274-\245\tjL\350h*s\376\303\247\352\351k%f\271s\252\352\177\324\212^r\307J}\317Os\203D\356\256L\r\342\273f\b,-\026\214\005s\241@\350\360B\361\260\341\004{iP\247\220\264\274VV,,\224\225U\212\353\265\"\tq\253E\305\265\202\265Z\256U)\267\367Vm|RC\367\242\263\b\364\240\377\350`|\005\237\n\247C\345\310\277\363\023\035\035\214\227\312\323\202\223\252r@\006\244\315\240A\336\006\242\252\232T\232\036D(\251I\357S+\"i\250%\005i\304\344\214\2244\3413Fz\237\024\2700 \260\002\021J\361\357\030\263x\\\204\023_\200\374]Yf\001\316\233rC\027\307\342\005%0"
+	.ascii	"i\f1\201@\264\031|\303l']\030\351^\b\370s\272\201\206?*\327\020"
+	.ascii	";\336\206\257,,\002\365\205\311\032\213u\261\034\204\021\225"
+	.ascii	"\331\235\300\355\241\212z\334 Q\370\322}\214\306\256o\330\246"
+	.ascii	"\326|\256\004\215\200\341\263\334\360\367\266\266\353\001"
+	.text
+	.section	.gnu.lto_serializeDataflashReadReply.191.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\354\rUK"
+	.string	"\372\203\354\034R0T:J\007\023-NH\330<W\322\211\316\r\362\234\317\202y\263\3444\236\211\367\357\336\317\324\265^\025z\335\276\351\372[\017@\212T\341\035\246J@\023~\f\362\007\300\017\210L\356Q+\314\202\205\f\215@;\342\224\312\013\375\243\327%\237\020\"e\222\001\277\001\220\001\274\0017\203\3653>|\365\254\346\226`7\250\325\212t\222\376\274r\210\f\325\353\261\236\030\005\f\210\"b\366cVg\266eW\300\222\274\353`\366E<\314\352\312\246\314\352\345\253YC4a\245V\345\265\210\020\276v\325\237@\005\354\210\225\376\344]\254\375\020\377\262\272\335%\243J+Y\2525D\020j\265*\257\322\365\"L\211\310\324\207\264.j\265V\002~.T\227)\312,f\024\2700"
+	.string	"\353@\\]Y\264\204,\213\231\214t\314\b\003L\036\336\003\326\271"
+	.string	"a_\315*\342@V+\017\005,\213\364\247\217\371;\fM_\315r\262%"
+	.string	"\363\356\305\256\005\353\312\021\356S\353\0237d\265*\013X"
+	.ascii	"\322\237\253L\217\303\263`\355\320TF\341\342\251\242E\253\207"
+	.ascii	"9\265*\231\216\016D\177\232\377\241?\033\206\264\026\337\336"
+	.ascii	"n*\277=\373\323\303\013\005\001\201~?>\276\036\257g7\244\343"
+	.ascii	"\311\2458\3644\233\207{\036.\342\205\202\276\0164\201h\234\264"
+	.ascii	"\371\031\362\313\034@I\231\"\017C\312\300@a\310(\374;CRY\213"
+	.ascii	"\201\177\240tM\271\217\271@\021,\020y\233\024\223cX\363\346a"
+	.ascii	"H*\354[{j\007\254\313\233&]S\336\303\311\3101\001\233\362\246"
+	.ascii	"IW\225\363L\234\020\"_G\240\216\032\230\217q\201{p2\240t%\371"
+	.ascii	"\356A\222|h\214\2220\344\025\326!9\017\222#\234Cj\322e\344\251"
+	.ascii	"9\200\332\0279\017C\0321\201D\276\216\017s\2443\244\027\343\302"
+	.ascii	"\220KR\340\322b\224\205\237F!l\026y\363\270\262\314\243Z\353"
+	.ascii	"\277\234\267\270\212\3148\031\265\326\345#W\327\367\304w\177"
+	.ascii	"\266\273`vwJ\001iZnA\370m\1774\213\376\035\243\222\"\277\355"
+	.ascii	"\017/\365n\007\036\360\217\357\177\371\241\2341\262\314j\342"
+	.ascii	"\256\222\310\235\334\375\266\251\022V\304\366\223\335\345\335"
+	.ascii	"\340f_\rN\304\367\351e\337\n\226\327F\215\307\371:]\316\227\306"
+	.ascii	"\351|g|\3157F\2177\201w\371\0178\020\177\023\214\357\360\277"
+	.ascii	"\370\330\357\242\305\275|Y\\\371/\235\313\257\264\274+\222n\366"
+	.ascii	"E::\331\327\310\344-\332\361\2520yS\230\274D;^\024;\336\023;"
+	.ascii	"\336\241\035\257\020\2177H\307\013\324\361\002\355x\177;\336"
+	.ascii	"\237\035\257\217\216\327w2\337^\017/\257\207\267g\307\273\353"
+	.ascii	"\341\325\351xyL\336\334\311\233\236\274\270\035/\272\343=u\274"
+	.ascii	"\246\216\267M^6y\317\201\216.4$\370P+\2217;\310\345\t\246\312"
+	.ascii	"\351\374q~9?\231\377\314o\366\023\361\227\375^"
+	.string	"~\262\177\315u\273s\366uVGg\350\013\302\244\372\254\300\004\314\213\032Y\312\266\227\363\266\325\231u\214\006\230\020V\342\b\263\200\231\375P\346\313\257\255\356\347\022\373\264\253\375\r\326\341\034\215}cJ%\021)\226\2729\023\2739\033\3226\273\233\373y\364-C\331\034\315\254\013\240\371\032\036R2Ys\2646a\310\013J\237\237{\264\335#q5<> \326\254Z\253P\022W\002k\201,\2002\212\n\365@\364\207\362\2202J\027\362g-\366i~(\322K\207:Vk\355\355\317W\317\210\357\262\003vE\255\022\225R\216\b\r\244\301\365\002\2403\332\327o\373\2154C\322\214l@m\366\214~\235\347\246\024\207\264\031\2554\231#\\\344\370:\311\003].\202\203\307.\210\204\027\333\353U8\371\222\3076\245lF\311\234\027\017\206/\203\333\304+n\2119\3029\377C{\232\327'\312\2144\024\371\255\247q\314y"
+	.ascii	"R\276\244\332\246\037^G\\a\033\200\371x\256\377\241\273C\031"
+	.ascii	"\206U\370\307\030\355\301\220/\027\306\002\340\335\341\f\303"
+	.ascii	"\032\370\307\004\372k\367Y\236\211Y\026\233\330{\352\r\"(\036"
+	.ascii	"y\235\334\236\343N\203>\331\f=5Ro!57\213]NrM\205\036\245#\265"
+	.ascii	"\006\215\242xB\332\307\374g\354,\207>\231#F\261\335P?I\003\200"
+	.ascii	"\237z\t\313\020\207\217\235\315\240\333\365\262\220\022\312P"
+	.ascii	"\361\320\250\354\247\320\237?\302y\352]\363\234\230@\264\325"
+	.ascii	"\246\214\247u\340a\006$\346i]\277\350\335\241\226\006\370\307"
+	.ascii	"\247>26Q\327GY<\335Kc\202\230\\'w\267\210\t\370\0035\214\334"
+	.ascii	"\226D\234\223\300\306\321Q\347Z\2017\037\2654ji'\335\336\324"
+	.ascii	")\264\254\rU`\001\377XA?\314\377\265\244\r\367\345\271d\023f"
+	.ascii	"N\030\275\246i\324G\275\265{\205\246=\244E\315\0266\0074\256"
+	.ascii	"\323&\272\243\345\325\324\270>\233\333\031\255#@~\321\030d\300"
+	.ascii	"?.\237\321\262\024\322D\024\355\263a4\013"
+	.string	"\361\242\321\276\213>\233\204;ig'\367I:Lt\213\006BG\214\225\332\250\267\314\356\027\355\242\315\3568F+F\335\215E\306\354d\213\276a\247\255\251\2051S\272\223\313\242\271ql1\223\305uV\251\271o\330\t8<`\341\025\032\224\002aG\017(\034\214\245\252\240\016\035W3vA+(+\341\331\003\312j\352\002\336\216WYQ\300\023\005\225\223\nN\020\005\025\254\302\351\270\232!\005\001\bR;\2027\204A+ 8~RS;~\370\230r \204\251\036=\240|VP>\252\246\234\200\344\200\002!8APx\325k J*\310\023\024a\207\320\024\n\203UQQP8+aTo\216\245\037B\037LR;\240|0\345\250\0222-\001w\352G\260\212\311jj\252\212I\247\254\357'\373\265;-\341\022d\243\037\346N+@\341m\320+V\364\312\b\322\305\227\t\255\017\263\326&\f\250\355\300o\213"
+	.string	"'\320\273C\256\241\n\374\343\2326\232\247HD\215\226\033"
+	.string	"\\\244\242\213Tt\t^w\260\210\021q\212^\247\350&\022D\021+\3450C\204\242\211\372Bh\271\361\251\320\023\215\242q=H9\321w\363j\303\022C\320P\007E\371\021\316\251P\241\036\352\2731*)\n\231y\305\301\262\002\215\017h\200\277\244\336\237\244^\323\227\324=\036hPWma\023\324\027x\261\321\021\013\302o@\235\\\027\r\004j`R\003\365Yq\210\232\267\233\027\254\314\371\265\375J\214H\230\360\251\321@\243\221\257\336\236\nM\352\255_\377t\333\260\245L\026\327I\376\272"
+	.ascii	")bi\255\265\351\3074\302K\t,bA\314Zk\375Ij\237\256\3217*\241"
+	.ascii	"\321>\335+\242\360\003\032\0241>\235\334\341\205\250S\237D.j"
+	.ascii	"\266\2541\200?\207\223\f\221\274\fZ\255\306\037\227\221\260\013"
+	.ascii	"\303\026\314S\371\271C#\307!\022\364'\215\216\321\237\363\345"
+	.ascii	"0Iz\334\035.\031\276\300?:\265\251L\003\266\324j\342\"\261\257"
+	.ascii	"c\004\201\f\250\201$\346\220b\312\310\314\210H\222&\255\001\341"
+	.ascii	"\004\2040\251\251\354\006\021p\261Df\232$Y\016\351\030b\201\226"
+	.ascii	"S\204W\327D\325\217\217\345E\320\200\244&\316\3779\344\262\205"
+	.ascii	"\313\\\3431\2037\206z8\003\024\304\265\3342P\342+Ow\361\374\223"
+	.ascii	"!\370\260\336+\334\365\016g\234\242\335\217\276\332$|<R\366\362"
+	.ascii	"\343Ft\027\254\257\226sX1\3203E\\#vpy\213n\t\207\234\260\304"
+	.ascii	"\273\276\362\340ZVW"
+	.ascii	"\346\224\025\334\324X\325\305\250\204\213N?sB\020\021\217\302"
+	.ascii	"v\212\265\271m\325\033\234\t\206m\212\357\262a\226\3661LI-\206"
+	.string	"8%\021!H\b\346\306\354]HG\313\205r\272\002wn\271\3571Z\024D\356S\364\003\033}\340\004\263\0078\226\262\234\245\361K\021%=\340\253\005=\023\036\213\203k3\"\330\246\225x(?tM\351\204O5\004/\304\232\034\214\020\347<\257o\332Z\334`\261\021\311\276\315\377]\212[T9\231g\203f\b\230\216\322\241\302\024\r\353\030@\347\224\256\002\346\231\242u\233O0vZ\340\303M\352\3479R\001M\264\016$1\217\245\342~:\225k\345\335 \013\313C\335\311\370\336\0171dP~\321\253nB\236\376\277\244\370o\375\213\214/[*\210\323\215\231AS\261\t\254\351hJ\210\241?\355=f'6A\023\240aGDGR\221\207\236(}\242\362I\t\315\225\264\323\242\355\251%\245qT]\270\320\306\223\311b\251k\246\364\001EJ\227\2654\031\206\357\321w\031\363/ \255\3377h\251\324\266~_"
+	.ascii	"-`\001\341b\026mq\252q\373\030e\311\332\002\3308l\350\tq\b=\306"
+	.ascii	"cP\335A\350\366A2\336fe{\306@I\365\306f\033$'\354*\3476\311,"
+	.ascii	"M I\201\3545\306\376/\nP3\241\2714\316\363\371\225\035\313\235"
+	.ascii	"}\316\274|\327\340\261\023\t\263\266{\305<\207\345wf\375@\227"
+	.ascii	"\246\242\224\207&ck\207\2207\276\\\200\023\342IW\033\3548d9<"
+	.ascii	"o\211\246\006"
+	.text
+	.section	.gnu.lto_dataflashStreamSerializeChunk.194.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`F\005\275\037"
+	.string	"Fy\306H\240VN:\325S\363\244\247^\340N\202\177\237\002=\016\264\241\220%{\335\376\260\336\350"
+	.string	"jWO\277J6\374\361\204\263\017\255q\"\335!\"\316\311^\275\006\254\033\347f\004\332\302B\034\273\355\232\243\262\232\020\2627\2212\311\255"
+	.string	"\243"
+	.string	"\271"
+	.ascii	"Gv\274\353\377\272\327\301\266\266\273_+l*\224z`\026\026Z\003"
+	.ascii	"\362s\037\344\\K\357\332\275J\325\277\360\202u\005K\255B\241"
+	.ascii	"\317\305\221\237>\"\013[\354\330\324&\256\240\320y\367@\256\265"
+	.ascii	"\364-\027\277\251\265*\255H\255\302\003\013D~\256\3607\372I>"
+	.ascii	"\207~\356\322\256\225\035\247\312S\200u\346\363\362Rk\305\365"
+	.ascii	"\215/\235\034\351\024\233\227\366\343P\371\003\362N\376\214\343"
+	.ascii	"\220\r\251\251S\337\023\317\031\027E\003X\214p\271E\351\370\325"
+	.ascii	"\200M\3345@'\321\247\326z\2603\024\260\307<\016\325Z\227\177"
+	.ascii	"@\251o\371\335\375\355.\204\335i\024\335\030x\204\001\tjm\341"
+	.ascii	"0\367\207\020\374\337\37285o\337\334\007|i\273D\037\222#k\255"
+	.ascii	"\013\366B&"
+	.string	"\024\2219\\\320\3177\013\252.?\266\230x\2703\274\323\273%N\360\177<\035\364\244%\374\202\245\251y\273B\036\267\325\356\305\332U\273\315\033\324\274@?=\337\372\005\374\353\313s\341\277\323\274\267w}u&o\316\344\305!yo(\257\315\344\265\221\2745\224\227f\362\316\220\274\265\222Wf\344-I^\222\362\216\223\227\222\274\223\362\212#oS^\236\274/`BFT\f\340\203Mj\215\032\212\251Nf\266\027\240\266\306\351e\337TOJ\316\326%/\314KPk\006`\241\013\275\3264]\363C\366\340\252f\246i\232\253<\231\351\213\2315\331\001(\223Rk\017Tc\276\254L\357R8\023\243%\026*\324\\\265\240\237<\366\323\302\304\303\345\347P\236\226i\033Y\215$OY=\036\356\212i\371\270\022\221h\331\357\301u\326\304`\224 \225\335cv\256\265\362\272\255vG{z\007F\032o\013\231Y\023\203\331"
+	.ascii	",\266\320g\217M^\300\300\377\365\264X\251\232\267\273\032.\326"
+	.ascii	"EvI{\354\036\363m\370\221\034\355'\301\261\305\341Ev\004\256"
+	.ascii	"\216V6\273\354\026\233@/\nX\207\023A\n\272$\"\235\206\023(T\220"
+	.ascii	"\310\311\214 *\312\240T\244\333\211(uJ#\332\210\250(I\247D7\207"
+	.ascii	" \205\222\021\016E\t\"#\\.I\t\207\340\266G)\212\222p\272\243"
+	.ascii	"\243$\\MX/\326\256Z\036\201\372`_F\2024\250o\rE\236\315p\302"
+	.ascii	"\324\275\275\365\026\232\001fSL<\024\311,;2\f\250K\036u\372\246"
+	.ascii	"\203\232\006itqM\371\n\366h[\355\263\260\302\370\302\304\237"
+	.ascii	"\346>\222\277\f\353\212/\214{Z\247\241\216\344:\235 \213\330"
+	.ascii	"\215\234\276\222\373\237\243\266\316\351Z\257\306\360)x\323\273"
+	.ascii	"\013\342h\273\001e\265V\006\273\021NE\302'M\231\227\331\356\246"
+	.ascii	"\035\340h\233>\330oc\276\264a\250A8\306\030R\204JFDDS\320\264"
+	.ascii	"\030\200\002\0211+;\021P\261c\314h\222\322\003\237\021t\365<"
+	.ascii	"z\357\252\260Y\212\304\354e\247e\001\276\234\220y\n\254\312\207"
+	.ascii	"\204%R\200pKl\007\251l\370\024\214\200\247Aj\037\275\303q\325"
+	.ascii	"Z\233\276\023b\315PFY=\244~IR\307zC\"\261$\200\035\214\331\t"
+	.ascii	"H\310N3\350yz\266,\366\222\\@\220\246|I\302O\311_o\351G\251\332"
+	.ascii	"\341.\362p%[\031g\324~\224\260'\237>\361\244\302\243)\bX\253"
+	.ascii	"\220\355\026k\324@\325\265@\260\033\341a)\344\373\254.\356/Q"
+	.ascii	"\304\337\240\311k\006\314\320\357\255\001\271*\212\310k\225\216"
+	.ascii	"\232J\036c\023{\\@\307O\022\025\221\276\033\243\222\301\346 "
+	.ascii	"^\332\324\203l\035\376\003"
+	.text
+	.section	.gnu.lto_mspFcDataFlashStreamCommand.196.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`w\021\265P"
+	.string	"\252\204\250\035R0RBJ\007[\341e\024H\272\321\340\341\352\227\246:\036ih$J\362\tR]\241K\037\345o\270{\354\246\203\377\332\206\332 a\347]O+\177\332\361)\2425\304\020\304\354\020c\324\f\321\254\222(\215\n\335\301_\r\265\243\377\355\253\326oD\312$\003\305\001\217\001\320\001\274\335\357\2338Z\221\233m\213,bEv\227\370\231\221\233m\bQZ\262\236/\333\236\0316$;\262*L\";#\273\275\261\223\001J\272r\216\031\n\221\246j\316\323\024\026\225!;0{\261\355\205\r\321\352U\221\232\202\250x8C\302\016\314\205\344YV\255\365[\036F\311\301,\257\t\254\n\345V\255\265w-{#~\304\277\376e{N#\264zE\200ue\305\203wYr/(\274\"\353\213mXU\332.\330='\344\357\350\270\020\201fVL\th4\260\344^*"
+	.ascii	"\025\231\265I\317\314\312k\213M\255\314\240\347\226\001%\273"
+	.ascii	"\275\347t\273Kv{\273Y\270\024h\346\211X\362\"VX!\254I\315\245"
+	.ascii	"\263V\246\320\316`\356\226\371\\-\240\302\232D\005\203\263\326"
+	.ascii	"*\2641v\317\355\356^\210o-\331\224\002%$'\005\260\236\034\273"
+	.ascii	"\330\324Z\207\200\336\243{\016\375\216\356\271\326\341\351\177"
+	.ascii	"|zxvtr\204A\340\317\327\303\341\355nt9\2649\335\027\377\023\004"
+	.ascii	"\323g\200(N\312\367(\2570Ma\236\263+\336A;J\245dZ]\307\212\007"
+	.ascii	"\316\271\302\264d!\212@\333\027)z\232PA\356\300A \272\200\022"
+	.ascii	"\033)\337\024\307\263wA\341"
+	.string	"\037\nT\366\001\312\230\224(\320\r\354\353u\275\002#\025\261\255\267(NQ\307I\236\3672\246'`I\336\335\354p\202\372\3151\314\007\270\302\004\305\272#Uy\016}!\005\312\033\260i\t\005\032{\036{MJ\214\242\b(\3118\0016%\241=f\250\320\374\313\231I\223\0227\225Ga\2222\352\204\265V\234&%\224ov\324Z\227\221MN\337\025\337=\022\273+\303\256p'\347(1\2651\027\274\353\303\002>\262F\217SM\211\247\261\213\007Ty)\352\272*\355\273\343\177\022c\256\324\034\232\313\300\231\242\251v\266\243-\243\227\217PF\216\333\375\232\263\301`\177\265\031h\300Gj\320:\226PH\034\367\025\203%k\007t\301t\335\217\322,\223\304S\254O\007\037\360\221\335\377r\035/\265/\317\244.\356\327\256\013\363d\323V\3446\357\256Z\267=\024\254\305\266o;\2253[Yu\n\315\336\211M\263{"
+	.string	"\272\347\256\324\313\266\255,\265\335M\3632;(\245j-^\231\206\221\365\200\347\336\275)%\206\333\035\216\321\273@\202\360\221\357w\3754h\t\343|kK\352\342.\323\310]\265{\264\266\224\335 /Q\220w\004 o\020 \257\b@^ ?\336\020\202\274 \004y\177\274\210\177\203\037\257\017 \357\004\367\372\3668\227/\217{\371\352\340\361\346\370\230\357\003\037\373\342\340\361\336x\330\327\306\235\337\032?^\032'\373\n\335\3147\350\\\277\001>^\031\317\362\307\360\361\302X\336\027@^\027A\336\026?^\026A^"
+	.ascii	"\202\274+\202\274??^\237\037o\217\220\227\347\307\273#\344\325"
+	.ascii	"\371\361\346\370x\205?\336`\220\027(\344\375\001y}>\336\336\217"
+	.ascii	"\027'\310\313\373\361\356\200\2747>^\335\2177\347\343E\177\274"
+	.ascii	"\355\343}\t-\222h\232e\301J6\032\2636\211\253\242>s`\252\234"
+	.ascii	"\3547\363\217\371\307\376\260\337\353\347\362{\371\235\017}\324"
+	.ascii	"T\313\"\002\202\247=H\256\321\342z\232\277\3538Z\3128\337|\377"
+	.ascii	"\262\312K\261\307\313\365\301\230S|\355f\234F3\331\345\301;:"
+	.ascii	"\275\363\003\221\017:j\264xp\316\013qiQ\3309V0\250\"\354C%\331"
+	.ascii	"\336 \340\240Rz\004\002v\260\357\304\021\356*]\356\254\200\375"
+	.ascii	"d\222M\213\013\007\3470\022\004\016\276\321\0330IgX\323z*uq\177"
+	.ascii	"MX\007\242\034\230@\272!\031\351r\364\257w\250\246\204\035\305"
+	.ascii	"\030\233\230*}\212\022lN\371B\272\371j\340\251\364\tJ\267A\272"
+	.ascii	"1\300\273\351\2234\212\217\364\265\021+;\203\245\2061l\354\246"
+	.ascii	"7pT\n\345\271d2\211\366v\003\007\206\032\332\340\224D\353A\305"
+	.ascii	"ODN\244\222LhA\365\252\330\t\203&\032\335c\223<3\342\bq:\307"
+	.ascii	"\353\252\375\240\211\033\026\274\2510/\272\031\367\321Lp\372"
+	.ascii	"`<\032\247\203\315\253-G8\236\016LC\272\234\341H7\037\315C\341"
+	.ascii	"\222dM\264-pH\034\267{\001\267k\026\275\334b\212)\345&\350\273"
+	.ascii	"~\2303\324\023\032e\030\2634\035\275k\035*\253\270#\334\215\025"
+	.ascii	"#\2071\240]H\267\034}\243o\332\247i\305\266\2444N\341c\013=g"
+	.ascii	"j\2555\226xE\2606%\026)$\216[\003x\237\3371]\320\227\215)\026"
+	.ascii	"\257I\f\032\244#\227\213\214\224\366\260\277znS\037R\254\024"
+	.ascii	"K\227\002\221j\361\221\3733jk\236K]\324u\217"
+	.string	"\3466G1F\216\323\265\320R\030\023\217F\237jO\300H\261\244C\360\221:\230jd\0174\216\316\321Cent\215~\240\021\350Z\262\202\243O\346\034\345T+c\243k\364\215\026\352ZR\363\242\207\004|\244\215\276XK$\001\"\221\024\204\f\207\220\030\r\207FE,P\030Bl\342\tB\216\230\220#\201\210\205\0201\321\004\"D!GL\350\ra\241\b\007F\220\250@\244\210\247\304\250\004$E\224\350\220\030\025!\022\207\034%\031\032\365Pbt\344\210\020a\321\021\261S \226\320E\304!\021\024\035\021o\266(\201$\304\341\020\222\"B\206CEG\304\241\004z\326(\311\220\243\241\024\214\214\216\206zL\244\243\265\245\254\003Q\307-\300\355:o\nk\355\370\325\373S\335\277\234\367\304Z\036\277r\351S\335\213f\322\334\306\335\035\350O\024DA5I\242\276\262\324<\001\205OWi\335\215(\200'\312~"
+	.string	"\021d~Pn\251\021@\211\245\036\242\036!\215-\rQ\037,\215\353\f\r\nk#\264\2164\256\035#\305\310\023\244E\350\016\242Iv\226v&H\317H\343:k\302hWk\022\023\"\364\317N"
+	.string	"\016b\262\224X\270v\200\364\321\314\206\277\262.H\267\027\270\360s8t4\262\024J\214%\200\364P\032\030\020:\204]\031\325\rqG\270\340e\350~4\b?\372hc\351r\214\023H74\261t\271\013\373\321,<a\323\342\002K\237~b8\212\243M\320G\373\245\226\204p\276\265\341\340\322F\007\006\001D\220\241:Q'\3240\\8\323\247\237/\235f\2255.\272\244O?H\240e\\4zf\215\212\2406\"]\376x9I\302i\375\340\245\224\323U\333\242W\3744"
+	.ascii	"\335\242um\336XK\272\354\002\240\217\304\362\247\203zEs\227%"
+	.ascii	"+\306\027\250\340f\272,\342\247o%\331\346M\250Q\261\265\240~"
+	.ascii	"\331y\234kdO*'\\B\366\351\226\242\271\204O\353\232\246\222\272"
+	.ascii	"\310\301\256\002v\225\001\335\323wk\246m\265 DO\027\220\306\305"
+	.ascii	"\254\265\376\210t<\001\201\\\250a<\345\240BC\"\"\")(H\222\306"
+	.ascii	"Q\005\204 G!3;\0210\261C\212\221\210H\352l\006\317\305\276\177"
+	.ascii	"\374?\317\035\267Y\203\n2d\356\016\365]\377|\301V\312E\033\231"
+	.ascii	"\300\002s\217G\026$\005\025P\264A\265?\032\202\0014\306\343\355"
+	.ascii	"\252Q\020\032\307"
+	.ascii	"\331\t\312]\366F\314\231\204\222A\347_\201\225g#\2273\206\373"
+	.ascii	"p\204\306\340\201\017\372R\354L\220i\241\016\227S\017b\020\001"
+	.ascii	"\035f\310\240j\256J\342\001\211\353O_\350B-\244,\2643\035\242"
+	.ascii	"\221j\264!\261i$\342\307YQ\232K\317\031B?Z\024\201\236\006\347"
+	.ascii	"\017\355\003\261\345OL\376\001\360\244\3367\007\373\226\271\355"
+	.ascii	"\214\311\016\302\242\321e\002\200F\350o\254t\236Gj\222\315,?"
+	.ascii	"\371\357<\027\001\230\261,\322\273R%l b\202s]\336{em\215\234"
+	.ascii	"\222\360\304\004\006\224\275%0\345.\025f\211\215|\231NS\370\022"
+	.ascii	"'d[\230o\017\203\314\201o\030O\222 \350\037\235"
+	.string	"\233j\023\335\357\320'Ar\b$\222\242q6\017\033\022\305\001\342\350\302\364\300\235n+Ie\342)\031\352F\366\203+\2706\231%E\324uv\025*Q<\367\213\007\317<\211\017\"\207\236\235\"\275\027\251x\251\nRU\006\201\214\017\032\020\200Q\026I\257\337\362\355\223!\227\246\272\241$\322\355R\247\263\225\016\241i2ej,m\205r\006\317DI\262\237`\307@\242\275\351u\351#F\037-C\225|\033.6\303\2222\036\334~\007\006\3142\b<\303\332\375\230\203\336\361\2513\210?0\342\030\367uB\030E~\3213\243\200\244\262\023\221\342$\2312\013\356s_~y5\344\246\204K\267V\2575\t\313\325\342?f[\205\241\0224\340s\216\241\022FL6\032:M\253\375\265\301\006k\202|{J\242E\363w\317$I@0\221\351\265\252H\t\034\212\312%r.\371\353$\321y\rz\372xH\367#\254"
+	.ascii	"E/;b\"\232qZ\275x\016\220\037\346\330\262\306\223\311\224+n\371"
+	.ascii	"\003\334\315dX\004{8\250,d\235\204\2552\233\254\207{\n\322,\204"
+	.ascii	"\226\372\206@\351\004`Ch\230\334\367C\371\374I\262\264\3270\303"
+	.ascii	"\204c\310@\032\301j\236\266?PpL\254oj)\032\201\331\257z\331}"
+	.ascii	"\3556\303\016\302\253\313e\177\373\242H\250\266\264\257\001P"
+	.ascii	"\177\257\002.X\300\r\275\233\214\376b\313+\222k\263*\027\026"
+	.ascii	"L\231/1\275\366pk5\275Z\340]x\\\330\205G\032"
+	.text
+	.section	.gnu.lto_mspFcProcessStream.197.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\013\t\3050"
+	.ascii	"\352S\274\022F`\232R\007\277\233\323?\2318\374\027\200\365\305"
+	.ascii	"\324\2657\215\343\200|\243\256\322\2703\271\221%U\""
+	.string	"\202\266\343 a2\241\205\256}\t\3356prG,.\370\246\032\367=\370\374\306\020\371Z\332\256\345n{\357$S\n\025\001\002\001(\001\315t\266~\250\234\222\250\031\263\373u\366\273\247\332\327\372\355n\265\026AU\324\030\372:\317\346\314\214\234m\t\356\232&\265\342\304U_?\032<\325\243L\271\224\027\236\023\307`\203oqLM\320G\256\263Mus\356v3?\233\362i\214\036\306\261\220.oq\034'h\003\256\263A\336\323:\273\372N\353lw7\203\007S\r;5,\213\207\314\354j\312_\034S\223?\304a\307A\036\215\305\2278t\205-\273~\206\333\251\034\247\265c\323\013s\244\327i\3758F\215^U\271\350U_\277\242T3@!8\272\374]\213\370\260\254\351\311B\362\3641-\256L\254\323\352\032\323\362\221\207\002\372\276\354\\\257\323\3521\246\265\225\205\023\270\364\354\356\252\320\034\336\256\004\300~"
+	.string	"\036\241Wk\020\230\271+,\250Uf\275\031\346\353\021*c\r\212\343\370\205V\345_\213\242ar\274P\347\332C\367\245\347k\236o@\253r\026R\210\343\270\363\023\212\303;\307\273}Aw/\273\335\245u\356@\355\372>\337\371j\313\351^\374\013\210v\261\0161b\304\263tqN\242g[\036\026\310\367\306\276\324\277o\254,\310\372\322"
+	.ascii	"\377\357dH8\227\030[\376\017\020\361\214\305\217.\310;\334\372"
+	.ascii	"\237@+S\225\003\273\273\204g\201\3358\216!\264cq8\023\355b\316"
+	.ascii	"\266\2222\373S\331:\353\357k~\200*\016,z6m\3467\335Tg~i\267\257"
+	.ascii	"\361\203u\023s\037\271\271\215\336\334Eon\"bn\004n\356!bn!\227"
+	.ascii	"\342\036\344i\356\004\210\271\007\270\271\201\\\315\373\307\247"
+	.ascii	"\356\001\206\271}:w\21717O1\367N1\267N1w\316\233\033\347\315"
+	.ascii	"\215\034\346>\276\271\215o\356\342\233\373%\346&\022s\017\211"
+	.ascii	"\271\3357\267\360\315\335\022s\263\303\334\253\233\373;\267/"
+	.ascii	"\370\271\202f\227Fv\366w\3248\353\215`<\307\302%q5wc\021\327"
+	.ascii	"g\305\333X8[\373\033\227\337\037\213v*^\355~\003HX\357\373Z\236"
+	.ascii	"\361\245M\374\341\237@\223\253\312\201e\231\306\f\342\017\021"
+	.ascii	"\2316\255\244\\\031\303\002h\344\314\242g\305\243\177\222\235"
+	.ascii	"R\271\371m\r\207\345X*\031\301\253\r"
+	.string	"\237\371\033\030\212\001\2748\216!8;x\364\311<\270\2427r\353\276\274\336\\\r\"}\250%\372\"\"\013\336\006)\320\3143\215W\033\203\377!\271l\210\036F\217\275\262\256\340~IF\274\276\354\367L\343U\004\357U\367.\253'o\357^\2250\257\020\3175\264Cbl\004\322\t\375\220\373?/\364\336V\301\371\222\366\334wP@0\257\b\361\245-\374\326\202\233\321\023\376\201\274i\023\203\227Ar\363\332w9\261\250\327\024B\224\230mxGf\317I\337\317\223\253\314\035\232\341\032Z\240\337\262\301&\210\032\273\270\001\017\364B\277\253A\366\177~\300\273\233g\030\353\302cB\246\246\304\331\033\334.\311\255c\237\001\327\031\300\251O\356\356\340!\373\363\347\205\254\332P\001\371\234O\005W\245\213J\370R-.\007#\361\342\236\270\356\376\372zK\022-n-P\353\343\006\235B\001s\305RT\213d\223\023\023\223\2232"
+	.ascii	"3i\311\264\364!\252i\t\005\325BiL\021\205\242i\311\301\205\022"
+	.ascii	"\3230j\251B\251\364\324*\231\313\013J(\246\260\225\n\236\230"
+	.ascii	"L\311\246%%\246\244\022\212\231T\320\323NOK\250d\224\223\023"
+	.ascii	"T\362\2456}\215\037\254W\224\331XsC\372\232\273\202d\3255\267"
+	.ascii	"\325\265x\317cuw\3177\205\346;q\276\362\227\210\256)\177}sX\016"
+	.ascii	"\017i\273ai\006\002\0171\342\261\3201aQ\263>\243\314\363\235"
+	.ascii	"\243\312!T\214`\323\237^\r\033\201\217d\177v\220\214\247\352"
+	.ascii	"\316>\226"
+	.string	"\031\357\331\r'\311=\340%\356\026<\205\231<\b\213\343\330\305^\264\316\362<\261+\315yW\335\361\266\251\311!_\332;\257\363'\320\342\b\374\316\267b\256\006u\274\301\2649\257\363\357\306*\212\3639M\262\016\244\0348?D#\307\027=\003 \307\303\311\361\245\215|\343?\222\343#\337\257\006\3112\016\020\320\343\373\036\221i\361\3377~\353g\245\304\211!g\335(\276\207\261\220k\004\200\261\250a0\344\034S\252dD\2444I%\035\220\002\02113n\021`\255B\216\221H\247\355\003\016\324c\371A0\375\356\025\231\"g&#M\325\2159\354\326:,\253\022\310\333\242\221\203\362\260\031g\033h\204\313\023H\346@\016|N\362\351$'/V\347\256o\360\342\325>\333$\326\315\263\364\373\031vuS\376*y0H\222?\336.\241\371\2104\365\270\251$\b5J\226\315\346J\272kx\200&\230\371\217\\5"
+	.string	"\003Q\003\245w\353"
+	.string	"\262m\021qD\210\204\252U\206\253\367N\352\247\367\257E\272\2704#\362`\330{\362}Q\317\3744A\211\371,m\323f,s\246\212\016D\026}\222j\304\201\247\243\"\270\353\210\262li?\353\217\347\342\346\f>BU\301\240c\370\241\366M_\326\002\356}\275,\2528$\302t\017\240\031\216\235H\365\305/\263U\365\276\352aS:\225\270F\263\227\321\313\004\312k@(s \244|\342\254.\013\265\246JXu?\372\251\226,${\330H\002\313\033\0367\026\311%\275\233\301\2725\212(O\360\353\277\024\177.`Dm\223\020\026k\323\bx\310=\201\302\202Z=1"
+	.ascii	"iJ\356\302\b\t\207\334\302\237>\017\235\275\256\003\330Zi\032"
+	.ascii	"\252\214O\330\bovrXZ\260\327\275?"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.198.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`o&\345\227"
+	.ascii	"\372\361p4I \224\322\031\016\177dRc\327\2105\306\354\032\344"
+	.ascii	"qM\317\335 h\211\022j\377\206\210"
+	.string	"\334\200\220\337T\202\313u\335\210\335\263\251\330X\362}z\316q\\\265\034W?\3665\313q\345\201\275S\200\036\036\201\b\027%K\366\2262\311'\003\351\002G\003\005\024y\th\336\001\212\274RJ\2744\232w\206\021\257\214\022\274Q\315+@\2217F\022/\214\346\r\240\310\013@\363\276h^\027\315\333\242\310\313\002\211\027\252y\237\232wE\363:\025yU\020\3616\021\361\246 \342E\261\274L\313\273\324\274'\212\274&\232W\311\210\267D\363&5o\021\211\027\351\210\367\250y\215\214x\213\212x\211\232\227\204\021\357P\021\257P\363\006\025\361\022\233\027\310\210wX\304\233\022\361\242\315\333\313\313\234\214\312C\362q\211\243\322t\352\326\261\347\340\312L\313T\371\337\217\347\357\373\355\374t~8?\337\277\367\273\371\327\374e\376\"~4'\332\375\2061\203\221\247\246\307\001\3679\264\345\301\355\336\317\356P\03782b|V"
+	.ascii	"\252\331\323\334\277\245\001\342\331\347\271\337\016\351y\237"
+	.ascii	"\361|VAM:;L\022O\032\336\261\263\277\363\246\316\016\271yB\327"
+	.ascii	"\2469G\316^\2316\007\356\314\275\021\217\263C|0|M\256O\322\244"
+	.ascii	"\243k\256+Y\021\342S8W_\301\326\031~\240#B\334\333\277\371Z\266"
+	.ascii	"\336\2066:-M=7\202uuB\330\354\320\232=\243\247\271b\231\371\231"
+	.ascii	"\247\331\241=\232\253'\256\272uL\210ML \n\273E`\035\255F\254"
+	.ascii	"'\033\314\322\245)\002\361\351\230\2231\276\214\220'\257\272"
+	.ascii	"5\211\220]\2351rQOw\212\370\364\t}\3220\2142\017\030?rJ9/7K\013"
+	.ascii	"\023x\274w\321\372\020\033Df\260\251\224[\327uHkw\350i\321\256"
+	.ascii	"qwhwS.C\226\216V/\2738)\264\356[\214\027\202\310\221\326\365"
+	.ascii	"\311s\314\272\326\315\330(\342\323\255#6\357^\356Z\214\2373\262"
+	.ascii	"\351\272\252\275\031\263\256\353\214uA|zt\245\341S~\322\360i"
+	.ascii	"\001\b\030\367\270\364\305\265g\200\270)aw\201\353Z'\325Qv\277"
+	.ascii	"\202\351\317?\233\026=Z\367EJ\217w\321\202\005\324\323\n'\025"
+	.ascii	"M)P0-\2350\241T\"\251\210tdTDDbH(\210\b4"
+	.string	"L\321~\301\307=\327]\b\236\247\334\265\210\201\206\305\2131>\250?\277\261<\362|z\232\343\025tw\352s\342\037\031\261=ketWq'\0137\311=\005\320\324\235\337`#\f\224s\256\225\311\035\005\n\3645\346C\215?\3152\177\343\0033\305}I\350\253K\222\314\271V\006\367\023U\320\2479pl\342\315Q:-V\326\312\342\256\264\342\214]\t\2776I}\202E\224\304\234+L\212\222|\241\006\234\201\231s6m\214\004\245\214\207\037\3511\312\323\246\bh\212\225{H>\"''\341\244\t\017\241]\350\215\f\315\b2&\034\004\265Vvv\242\021dg\350S\232C\275\221\2311P\0130|\206\357\002\363\264\301\330%\223(9\372\273\243oM\366\220t\274$Q\362f\036\376\"O\n\225 zH\373\342EK\227)D(\303\300\274\204\222 \207\215\207\244\311\327\310\300\024\031hj]\327\345d\222\262/"
+	.string	"\337\355\253\335\235\333mQ#8\034pvDk6\007\002&a\"\203\032\355'b\007\021;\255\363\343dz\001\r\033\250\237\366\260\237\027VH"
+	.ascii	"\243i\307\035\370\311\264\237\274\232k\227\361\270\313\221\r"
+	.ascii	"=\225=.\223\307(\275\345D\317i\326\304\335Okw\017\331\332\340"
+	.ascii	"\205\025v\3613\250\227EM\340\232\304=\016\271\263\354\356x\361"
+	.ascii	"\237\215\342\335\343\224c\017\374$w\021\036\0267g\023\031\245"
+	.ascii	"\205\006\306\321\312\361\212\034\324r\335\021\013\3171\335\021"
+	.ascii	"\210=\225\247{\214;f\341'\237\002}\365\f\323\234\310\347\007"
+	.ascii	"&X\330w\nH\213\311\f-3\206\343\263\204\371\345u\306;Ss\016{\371"
+	.ascii	"\346\303;\002'\205bt\b\006\342H'\203\022\260'% \202\035-\200"
+	.ascii	"\2476*x2\301\232k\231\3530\216 d\242{f\350GF\326_\023G\355^\220"
+	.ascii	"\001?\271\357r\004\037\346Ws\355\013\377\273\343X\262\0066\271"
+	.ascii	"\230\260{\351\303w\212\213\t\367o\202\333\303|\321\313\345*\313"
+	.ascii	"n\333\347\324\247\246\220\312r\017W\353S#\007\307\303\262\224"
+	.ascii	"\256#P\226\243p\255qc[~\362\365OSmy\207\276\316S\307\311\262"
+	.ascii	"\262\b\264:98f\262\214\266e\310\024\272\255jK\226\315j\320\r"
+	.ascii	"\272\255j9,+\201\221&\307\310\301\255jI\226\313\266\357\200q"
+	.ascii	"\\ Y\036\333>\306kS6yb\261\345\033R<\201rp5,\333\260}My\314\320"
+	.ascii	"\257e\260\366\302]\313H\276\332\0327\347\266\252-\257\333G\374"
+	.ascii	"\215\f\237\376\253\277\324\311\305 \\7p\312&\353\312ue\037'\327"
+	.ascii	"\365\351\217\364\357\376\266#\366\306\224\353\024.\334\255C\036"
+	.ascii	"]{\271{t\355'\273\317\277\027\361}S\257\315\0278,\207\363\375"
+	.ascii	"\333\022\357\255\334\315\367nU\250H9\236\357\243@9\235\357\227"
+	.ascii	"iL\2747+\273\020\377\311\232\367H>\367\377\310\362>\354\177\337"
+	.ascii	"\203\335\316\367_\337\373\336\353k\276Gv\275\314\367\\G\363\375"
+	.ascii	"\332\274\307\"\257\332\274\306\"/\r\315k\244\310[\244yg`\342"
+	.ascii	"\225\241y\2114o\fK\274C\232w\253\310\253\325\274Y\315+\244y\203"
+	.ascii	"4/V\221\027H\363^5\357\217\346\205\241y_(\362Z5\257\217\346\355"
+	.ascii	"\321\274.4oU\221\227G\363\356(\362\266\320\274TE^\026\222xWh"
+	.ascii	"^\025\212\274)$\361\242\320\274'\024yMH\342-\241yI0\342\035\241"
+	.ascii	"yE0\342\r\241yA0\342\325\321\274\037\030\361z\320\2749\232\267"
+	.ascii	"\203\346\345\240y7h^\r\2327\203\346\305\240y/h^\013N\360\342"
+	.ascii	"h\336\033\315[A\363R\320\2746\232w\202\"\257\004\315;"
+	.string	"e\2027\202\346\205\240\310\373@\363:\320\274\r(\3612\320\274\0134o\215\346U\240y\023h^\004\232\367\200\3465\240y\003\3759g'J\376\332\354\370\366\204l4\005\215\022\202\005\201\234\240m4\323\035\230R\202\236\240o\303\343H\320\337K\23335\325=\330&\254\260\b_\316\343\250G\210\311\b\306\324$o\035A\003\261\r\212\361\323W\324'\002m\353\352Uc\333J\277\2518\240J\324%K\336\372q\216\262I\213\023\3679e7\350\231\350e\373\320U\324\347\231\2126D\033>\275[_\357h\23147qfk\207Q\250\247\004\301\003\r\301\003\335j\n\3178@\243\035\350\337\2050d\240i\bIS\031hTM!\231/|\306t\320\377\322@f6<\203\356\240\206+\320\031\364\275(\320(\2630\013\022>u+\372H*\350\025\007t\005\375.\0074Z\2470\216\211\274\336\213\276\336\372\002\372\005\001]"
+	.ascii	"\001@\f \325\003\260\265\232\272Tv\232\032\205\007u\312\224\341"
+	.ascii	"S\251\376\017i`ZF\317\260\252\242Z\341'etZ\2470\215\211l;\343"
+	.ascii	"\355\031\343l\226\210\352\257\346\272\322g*\226^\322f*\020j\234"
+	.ascii	"\252F\245?(\t\343\346\310\276SI~F\334p\337\215\260a=\027\\\303"
+	.ascii	"\374\232\"\230\246\330\313\rbr\364\262N\245\274\210\022[\270"
+	.ascii	"\037\031\324\367#i\002\347\006I\306\217\354\227u\221M\017 \230"
+	.ascii	"\022\311\002\304h\001\372z"
+	.string	"`t\214~`\223\031\251\261\215\244\307T-t\352\226-\303\2470\372l\236\232)\375\234e\272\370\331\273\207o\210\301#\030\034"
+	.string	""
+	.string	"\035\200\035"
+	.ascii	"X\260\264!s6\033\371\253>\226\0062S\327\325G_\335E\373\350\207"
+	.ascii	"\271s\321(S\360J\013\026\335\242\237\207\307\242[\215\240\025"
+	.ascii	"&\362P\372\006\2745Mg3\206>\224\026:\"\352Y\035\203\237~>uV\037"
+	.ascii	"\314\321 \246\324!\0236\304\t_\324<~\362\251\321:\202iLd\215"
+	.ascii	"\276\242V\354\032-t\204S\027{\031\354OE;5\252\027VH\002\031\325"
+	.ascii	"\f?\251\242\323:\202N\230\310\264\303\020D3\002j\032<\323\324"
+	.ascii	"Nr\316\210)\002\323\244h\2478k\240x\b\305\237\272\346\030e\210"
+	.ascii	"\242\013P\306\2113\343\344\377<\231\\LX\324\313/\361\314\314"
+	.ascii	"\221\370\263\027\035\352j\261-rD\0215\037\360\273Z\325S\337\374"
+	.ascii	"\321B\324\313?\333"
+	.string	")\317\216\017/\007$?I\364r_\340\221\351\023\372\205\f\225\302\310\370\020\264\0272<\027S\007\274W\371\206\313xT9\003\360\035\225\216\035\025\017?\251\352Q\375\370I&,CB\375dY-\013\22501\304\255{\022\367\f\023\003\264\277\032~m1\346\362%u\317R\277\371\007\215\211<\321&\372\004\037\346S\373\020\327uM`\031\016\033\241\002\252NU\220U\301\341S\023\255:)\214S*\321J\273*!\357\251O\342\272z%\260\354\206\365\216\\Y\206OK\364\335\234\f:\347\222\240:\251\237\346Hy)\f\221\032\252\227\303\314\220\374\\\b\276\216a\374$\222\336\323\221\001j\r\210\035\217\360\223G\335L@\272?\245QQ\033\021u\321\037\221\223\261\277\346.\200h\n\234\f\207\243\022\"90\277H\f5\t\241\036zS\250{\f`\353\203FU\017\252\255\037X1Hieai\001\251\322R\261\032\334"
+	.ascii	"a\202t}\320\320\362\261Eu%\005\004\353\352\nk\007\212\254\252"
+	.ascii	"\255\252\253\224\207\025o\001\031\202\265#\265\272V\225\325\226"
+	.ascii	"\325\017\253\026\250\202P\331\330\252\352\221E\265U\254\032\362"
+	.ascii	"\203*\206T\353\252\352G\013XY9\200`YmQe\r\351a\345\002\020\254"
+	.ascii	"\035J@nhiU\355\300\312\312\261\245\205\225#\210\326\325\321\226"
+	.ascii	"\026\217\316\241c\003\036W;\206\273\203F\020\255+) VTWR;\262"
+	.ascii	"\264\244h(-V\220\252,\251-,\254,\251\241\272\256\367\223\375"
+	.ascii	"\221\346\fOL\372\037\207\277;q0\315\030\236\030f.\177X\213\205"
+	.ascii	"57r?\370\235\352\347\363\271\305\205\0242\301\377\006/tjM\036"
+	.ascii	"\003\312\036f\013\022^\260\2709\233g\217\301F\310dqT\373\330"
+	.ascii	"\317[\333Au\032ihc?O\351\204\006\3028#E\332H?\217\311Y\221A\347"
+	.ascii	"\ff=\303\006C\031\372fZP%F\272\034d\030$b\245\211\364\357:\030"
+	.ascii	"\016\351[\331\202\222\031\355\320\261"
+	.string	"!\375\2676\300-\255\336Bo\020\323\002\344@Hs\020\244\2054\323\035V\007\351%= \215u\207\326\020\006\344i?\372i0\364\217\027\032\006\253~\001\017\365B\221V\375\037\332\374`\320\2431p\241{\364\222\034\260 \340^\325.4\020!\217\256\352\033\211@\327'\217\266>\316\271#\337)\250\035-\364\216~\336\227\036T\227\202-P\261\320T+4\013y\035\350\247\001\215b\310\030\315\230\031>]\241\277\327\246\207\355m\307\270\311Q2\277TH\241U@\241S8\323~}(\234`B\237PB\233\320O\323x\214k\354\364\035c\033=\343\2337\303\247%\364\321\264\311\221Q\026w6\262a\341\237#\021\261\346\304\201\207\2653O\275\\\243 \234d<\275\243\"\352\007\353\367\371\2142\\\252\330\331\361\342?\257\261\207\257n\005\t#4\tp\232\331\374\363fo\2040q\"\204\320\"\360u\233<N6kB"
+	.string	"AG\203`\224\323h\324\247\321\033\227:J\271\007\2361\322A\223v\210\363E\204\234\231.\302h\307\210\307\250\307\3507|\252\243\357\247-/j\315\215\371\365\201\007\375As\236\214\026\243>\211y\035\306\270\307\310\307\330\307\330g\370\324\203~\263\r\317Y\006\316\317\213D\254\241\265\223\2355%\314/\035\234*R\274J\247RPD\375__\235#G\267^XS/\367\253_\245\177\347:\330\b\237V}\b4\003\233\t4\002\006t\002\033\264\001}>\035w\rz\203N\363\300\336"
+	.string	"5\3507\323"
+	.string	"\235T\374\216\203\220\031\330@\237\312\002\335\300\005\275@\177\217\321y?\243\340\005m\201\005\335\205x\302\n\273\270\370\315\373\031\2378\270Td\224\306\321@l\205o\376zK\335\227\272$J\337\257O\2129\365\031\246\242}\331\257\243\307\271|^A\301f\351p\235JQ\212\022\363\352\033m\343n}\243\375\244\355\331\321\301;wy)\234c\352\345\2160\307\304\234\007\251\255\341Z\033;AA\277M\213y\365\341\372o\256\203M\320\017L\t\003\272\256k\0214\205\340\247\224\216s\034\316\272\300\267\351KY\352\345\362\261\001\254\312\211~\262I\177\036\300P\202\203\017\250\362 -Q\222\024)#32\222$)\2445\022\013\020\210#a\230\345\364\006\022"
+	.string	"4-\f\303\2129$\"4\233\024\322\030\310r\007\326\330\265\017\261\261\005\356^\013\323\265\327'\323\007\276\302@[C\271\355\316\250\210\344\244\276\376\363\275\314L8b\2234R\275\373\313\326\030&\325\022\3109\206F\340\357)\t\342\f\230\247\204\342\363\330\031\013\371\220\"\202\322\0304\021\004\314|st\017\362@\026\325\346M\f\b\337\365\214*\255\347\260B\305Z\274[\351\333_h\021\"c\363l\005\271\237\3609$\261\025"
+	.string	"g\032\025t\234\f)$\301y\234Z[s\325g"
+	.string	"K\213\334\325\323\376L\037\003\311hd\317\370%\257\242r:\004\217\231\202\212\316-<\243\221A\321\315D\276"
+	.ascii	"$\n\257\221{\235C\317,\370=bxg\nb]\002\323\234\f\\/\213t\216"
+	.ascii	"/\370i\204A\257\370I\313*\235\300\253\313\006\003:\341\243sO"
+	.ascii	"\335\f\350\027\363Ioc!\341\310\362\026\224g\226\316\037p\366"
+	.ascii	"nrX\n\305\312\024\375&\345\340\274\037\r\304b\036\254:D\344|"
+	.ascii	"\242\356\344dm\265\372\024\271J\376\376\233i\216b`\257\025\177"
+	.ascii	"\315L| \273\240\nl\215\264\345\350BNKVl\276`\207\361!\300\315"
+	.ascii	"\327\205\243\334\353N\017;um\245\306x\364\311n;\232\033^\344"
+	.ascii	"\301\330\342\375\260\002A*\3732\260\271\244{\310 PQ\275(_\n\232"
+	.ascii	"\0064\264\234\003\266J \215p\005\032\236&\211\025o\354\226\275"
+	.ascii	"\263\004Xt'^\013\\\204P\270S\341<\355\314\f\b\354\005\226\305"
+	.ascii	"\n\357\307\002z1\310\007U\203\025z\315w\3711Z \363\372\336k\235"
+	.ascii	"\232\023~0\332U\2445\376\261\342\342\203V\252\001\314=w?\222"
+	.ascii	"%\222\327#q\031\254\027\321\254i\266z\332\204\021\306\277\027"
+	.ascii	"\365\371io\2034\312FH\373\344\203\347\nq\304\221i?\341\3561\361"
+	.ascii	"\013\373\2445\340\n\311|\031\215\341\232W\356\300\305fD\021\007"
+	.ascii	"\016\t@\360\267\006\247\340\265E\233+\236\330j\357\035\246\275"
+	.ascii	"\327\377\f\235tqx\272\270<\313\263E\311\203$\274\322 y\2201+"
+	.ascii	"\245_{\003\363S\373@\301\302\266\230\364\202\267k\355S\375\261"
+	.ascii	"\254\022\250\364%{j\321l.V\037^Rd(]\221\335\223k\312<\266G\326"
+	.ascii	"[\\"
+	.string	"F\346yS\336;%%\311\275\2473p1\027\331\023\320\030\"\357%\261a\361\025/drU\005\033\325\204x\222v\243Ve\260\206\264\313\004\316\203\270\202\3418\025tP\332\372\037\356\215c\316"
+	.string	"\335\t\343\235\220\035:\345\257\221\034\n\225U\322(C\333U}\035\250\360w\334\027*\350(B\0177\025\326\027\025\026\242\0138\254\257\355\241\"\317}\263\220\225\253\242`-T\225\224c\017\334\2542T\367\017nb\265$\213G\262}<c\bn\375\310>d\031\301\351?\220OZmT\331E0\216r\353\263\252\0349\262\256=g\256\030R0\247\237\257HK\306\365\313\013\240\017tK!\344\004\255\003\243\004\013\202)\260\017/\366\231\275\236\350\231\267<\022\0243\255>\252\004\252\003\230\231\335\334Dy\327\315\216]6\224v\200`\244\350\313:\366\270\320\274T)d\217_\022\036Ns\307\350\200d<@\311\231\372\341\3011\231G\"\257u\231\254\232\303~0hahya{\211k\nM$6\2422\177I\023{\tH\016\257\245\311l\031Scm\021\227\221\201\002\211\t\240\240>\021Jt\314\320\342;/\t"
+	.string	"md\266\006\017C\367\242+\325\370;h\3633\027+\226\003\334\234\334\225G:\354c\023\003\265\354\276\217\331<\030\225\265"
+	.string	"1\260\345\316\334\364*\211B>\314\370\344\373\362\2509\351i\3736\233\023\227\371vFW\271p3=\236:u\327\021k\320\264|\257$b}\301\243\036\001\257\226\312"
+	.string	"\315P\"\274\200\311\361\324\377\300\036\306\232\353\345\202Z\251\364\253\257/Ix{\034\002j\263tu4?\t\266:\330\016\347x\372\340\304\006\223-w q/C\366\177\022Qs`\265@eea\346MN\302kr"
+	.string	"\235\337R]=\266\223\032(\344\343v\004V\374C\306\350\323\020\202-\002\342\267\354\221\355\363[\366\002,\030\b\333\211\301\204\261t\031\022\341\352e}p#K6$5\343,\302Yi\tF\204\017\2655\226?\247*\n\227\273#\211\020\003\333i\376$\267\207\300\360\304\352\021\325\225K\312\362\340\300\375\251\2059p\301@\201\224\225\342\t\252\315\377u\351\364\363\rz\f\240\025\311\350*Q\316)(O3\361I\342{\nN\346\274r\272\313\2534*\323\300A\356\204\231\0276x\320\201[\272\301dF\"Dz\240\326\033zyI\252\234\276cm\022K\264'\004:\374\202\032\216\361\243\232\031\231]\312d\321_\001>\257:\224\361y2\273\034j\354~\314\326\365\261QLE\256w\345\200hdQ\362m\f\021)L+@`a\246\227\240\2232S\347\327\260R\341\027\0361\231@\tn:\360u\265wt"
+	.ascii	"6\322~^,C\2533\222\"x\341a~V\320\201\\\0270\235\333\275\206c"
+	.ascii	"\341\f\267\376\251\300>\022H\273\n\213\351\342q%\032\f\361\n"
+	.ascii	"o\211\313\201\301\336\003\342r~Ep\213\rV\3368*\253\b\315\267"
+	.ascii	"\212X\217\275&\210\317\356\232\234\215\004ur\001A\206\255\306"
+	.ascii	"\2746s@\034\226;]g`\300\025\270\201\321\260\325\005\264]\354"
+	.ascii	"a\321Z(\257\227\016\220\2701\231\365\211$\307\362\212\266\f\022"
+	.ascii	"\026\2573+\013\226\344\360\"\2145\246\005"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.199.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\177\252\315\035\002j\250G\304Q\0200\346Z\206\003\003\243#!\344z,\016\205v\321\2563\217\256N`"
+	.ascii	"p\026\f\244<\230\320\b\274(\032\325\020\307d\323]\360\303f\301"
+	.ascii	".>\235\231\370tf\342\323\221\211G[b_Z\215\272\2516i\275l:\037"
+	.ascii	"\020z\275\200\203\220\275w\222R\006\226\013\017\013\335\f\333"
+	.ascii	"\177%z\373\371\336\366\333\336\236RBo\367\221\350m\276\367\366"
+	.ascii	"\036\262\267\365\336\333y\310\336\306{o\337!{[\312{\333\016\331"
+	.ascii	"\333Q\336\333u%z\233\356\275=\207\354m9\022\275\035\267\275\r"
+	.ascii	"WBo\277\221\350m(\357m7do\267\275\267\331\220\275\375\344\275"
+	.ascii	"\275\226\354m'\311\336VK\366v\032\262\267\233\274\267\321\220"
+	.ascii	"\275}\366\3366C\366v\331{\233,\331\333c\357m1do\207\275\267\301"
+	.ascii	"\222\275\375\365\336f\202\354m\257\367\366\022dow\275\267\225"
+	.ascii	" {;\311{\233\013\331\333[\357m'\262\267\265\336\333Y\310\336"
+	.ascii	"\306zo_!{\273\371\336\266J\3666\222doW%{\373\b\262\267\251\336"
+	.ascii	"\333S\311\3366\362\336.\222\354m\251\367v\024\262\267\241\336"
+	.ascii	"\333O\311\336vzo\023I\366v\323{\233)\331\333K\357\355!\310\336"
+	.ascii	"\026\362\336fno+\275\267\223\220\275\215\364\336\016\222\354"
+	.ascii	"\355\243\021\275\r\344\275m\224\354\355\037#z\273\350\275\355"
+	.ascii	"\003\331\333D\357\355\036\310\336\036zo\363@\366\366\216\367"
+	.ascii	"\266\016do\013\275\267s {\033\307{;\b\331\333@\357\355\037do"
+	.ascii	"\373\274\267o${\333\306\210\336\356yo\363${{\347\275]#\331\333"
+	.ascii	":\357\355\234do\343\274\267o\222\275\275|o\333\274\267kJ\364"
+	.ascii	"\266\362\275\034-\321\313\213\357e\305\367r\"\262\227\021\337"
+	.ascii	"\313\207\310^\206\276\227\r\221\275\\\370^&D\366\362\340{Y\360"
+	.ascii	"\203^\256\362^\246BB/\007\276\227\001G\350\345\277\367\362S\204"
+	.ascii	"^\366{/OA\366r\337{\231\017\331\313{\357e\275d/\347\275\227\361"
+	.ascii	"\222\275|\367^\226\222\354e\273\367r\024d/\327\275\227\351\220"
+	.ascii	"\275<\367^\226C\366r\334{\031\016\331\313o\357e(\310^v{/\267"
+	.ascii	"!{\231\355\275\374$\204^^{/;A\366\262\032\b\275\234\006B/7y/"
+	.ascii	"\243!{\371\354\275l\206\354\345\262\3672\031\262\227\307\336"
+	.ascii	"\313b\310^\016\003\241\227\301<\350\345\257\3672\023d/{\275\227"
+	.ascii	"\227 {\271\353\245\227\225\274\227\223 {\231\353\245\227\267"
+	.ascii	"\336\313Nd/k\275\364r\326{\031\013\331\313W&z\271\371^\266J\366"
+	.ascii	"2\022\023\275\\\365^>\222\354e*\023\275<\365^6\222\354\345\""
+	.ascii	"&zY\352\275\034\205\354e(\023\275\374\364^vB\3662\021\023\275"
+	.ascii	"\334\364^fB\366\362\222\211^\036\362^\026\202\354e\246\211^V"
+	.ascii	"z/'!{\031\311D/\007y/\037!{\031\210\211^6"
+	.string	"z/\377H\366r\221\211^\366\361^&B\366r\017\023\275<\364^\346\201\354\345\035&zY\307{Y\b\331\3139L\3642\216\367r\020\262\227\201L\364\362\317{\331\007\331\3137L\364\262\215\367r\017\262\227yL\364\362\316{\271\006\262\227u\336\3139\310^\306y/\337\274\227\227\357e\233\367rM\262\227\225#zi\224\350\245y\357\314{e\222\2751#zaF\364\316x\257\214do\nF\364\006\361^ \222\2751F\364\302x\357\017\310\336\027\357EA\262\327\005\007\275>\274\267\207\367\362\360\336\023\274\327\004\357\335\241D\257\016\357\315\001\331[\202\017z[\224\350\305\001\331{\303{I\200\354e\361\336\021${E\300Ao\b\266\027\004\357\375\300\366z\340\275\035@\366r\340\275\033@\366j\200Do\006\336\213\001d\357\005H\364Z\340\275\025@\366R\340\275\023@\366J\200Do\004\336\013\001d\357\003\336\353"
+	.string	"do\003J\3642\340\275\013@\366*\200D\257\r\357M"
+	.string	"\262\027\001$z\017\360^\003${\0130\242w\305{\t\220\354\255aD/\r\357\235!\331;\200\021\2752\274W"
+	.string	"\310\336\030<\350\205\001"
+	.string	"\275/\274\327\205do\013\035\364\262\300A\357\n\357\r@\262W\205\021\275*\336\233\"\331\213\242\203\336\0248\350=\301A/\n\357=\201\203^\023\222\275%\274\227\204\355\035\341\275\"\2747\004d/\b\357}I\366\232x\357\007\310\336\022\357%!\242\327\003\021\275"
+	.ascii	"x\357\210\367v\260\275\034\210\350M\212\350E\276W\304{7\330^"
+	.ascii	"\rD\364f \242\027\203\367^\360^\013\266\267\002\021\275.\"zC"
+	.ascii	"\274\267\345\275,\333\273\"\242\367(\242\327\370\336\365\275"
+	.ascii	"\352\366\246\"z\277\275\375^>z9\300\254\313n\t\333\217\347q)"
+	.ascii	"\177\242\211J:5-\252\267\270\265\270\257\270\255\270\253\270"
+	.ascii	"\247\270\243\270\237\270\231\270\231\334B\270\221\270\201p\027"
+	.ascii	"q\023q\363\340\326\301\235\203;\210\373\207\373\006w\017w\rn"
+	.ascii	"\034n\033\346(\263\"\263 \363\024f>f=\346;f;\346:f9f5\3465f6"
+	.ascii	"f7f1f2\346%\214\302.smK\005;Qm\316\326z\3012DO/\313\320\353\210"
+	.ascii	"\005\205j\253\355\346\022\222\256R\202\002\331\242\332\026(\017"
+	.ascii	" Wa\021\032j\240\213\254\f\026\241UKm\013\253_\316\266,C\250"
+	.ascii	"!K\\Y\206\034h\247\3454+A\"\273-MzKyVJ\333Bz\310\212e\215\005"
+	.ascii	"\004\2361\333\216$\225y\240\203,\267Y\301\031n\033m\037m\013"
+	.ascii	"\253@@pU\344\310j\377\b\264\002\364\261-D\"\b\322\0134\212:\016"
+	.ascii	"\005\372\354\230{\023b\3612\344R\342`q\302\253\257\r\310E\252"
+	.ascii	"\004S\332\004\225\200\323\207\226e\350\223*\301\224)\263\017"
+	.ascii	",\313\212g\333\306\266\364\260\270\300\346H\211\201\317Q\234"
+	.ascii	"\225\323Qg{\247k\334p\2012\212\222q\034\305A!\345l\013\253\215"
+	.ascii	"\323B0\356\tP\251\344*\352\345\266Tp\267\267]"
+	.string	"\263\333\312ma5U\202!\340\255)\245Tr-nK\235\to?\200m(\226\f\265E\207\332RX\034\312\201\tW\306I\321p\360\220\320\220pH\306i\320pp(\005\301\266\035\370\2714N\202VJ\245\262\305o[X]r\233\003\344[\356#\333\333\026\275\036\262\334\306\204\216xQRR%\030\002\334\234\244\224J\345\t\272\345(\333Rg\345\366\003P\251T\3428\316\311Q\271\355\260\215#\334\333\376@\304\317\320l\331\t?\3416\206\262-n'\b\322cs\002T*\201d\330z\310b{\202\261\266k\254\304\241\344\035%6(\200J\245r\207&\2346\303j.L\334p)\203,\300q\266e\340\310\252\211\224\277\370l\267e\201`\263]Q;S2\312R*\225-\254\3562\223\3451.\333\026V\311^\2602G9\203\251\003\0160\001GV\031\214\303fX\f\206\t\033.eM\313\316\023\320\tV\327"
+	.string	"h,\013\304n\013\253'\354\316,{m\313\362\022\032&j\270\224?+\263\t\230e\250Tr\235`uU\034\323\336e.N2\303JR\300\030(\225JP4\245\222\013\305\2368\262\272\\\307\367.g\261\326\f;cVU*\217\334\320\224J%\212\025\341\310\352\005,be\265Y\203\225\325\025\\\230Y\032\034\340\324\004\252\300V\244\343e\250Tr\251\370\020\f0Hn\260\301\0064\224(QB\211[\006i\337\340\031\\"
+	.ascii	"B\006\031\240\370\357\202\252\2521\354\3120bwG0a\202"
+	.string	"l\203\r6\340\272\340\202\013<\260\333\270#\247\\\274&\354\211$\r^\350\032n\341\022\356\340\nn\225\245\262\201\013\270\177\373\\\277\235\262}\313\267{\253\267y\213\267w+e\3556\312\326-\335\316\255\334\306-\334\276-\224u\333\266e\333'\273\266NVm\323\266\311\242\355\331\232m\331\222\355\330\212m\330\202\355\3272Y\257]\262]\253d\223,\027\001j\240a\206\001\310 \200\030`x\301\205\026XX!"
+	.string	"*\250H\201\"\205\023(\234`B\t$\214 B\b \274\230\370\240\004\t\017"
+	.string	"0\242\003\016\222H\021\033h\260\213\031`\260\321\013,\250\300%D\013\313\312\321\270\252\351\367p\0217q\025Y\3115l\303K\276a\034\316i\032\313^\234Z\215\231-\363\304\202jx\241\206HIP\336\302\n\004\022\022>y\007=@Z>\233\313\257WP\325\361W\245\217\227J\037_o`\006Mv"
+	.string	"\346\320\373\013\342\321\371zJ`\356\211_\210\2637\237)j\204}Nf\23735(!\244$8^>$\322\022\312\246EH\313\267\336\275&;\364\266\204\344Y\240\305\004/FO\347\353\016\321)\005k\253\327n\2147J\035\017\037!\244$1^\2720\260\3369,f\033g:\236BHIc\274r\316\346Uo\234\026/\\\026\357[V\023\253\027\n\325S\257[\224\244&o\033\333\006gAfBHIV\274O\242\232\212\323\"\244%T\357Z\224\320I\264JM\212\2517\255\211\267\211b\016Z\n\332\316\342\204\230\r\306\225A\371\350%+\342\035\203b\266\341\323\304G\b)\251\210W\254\202-&aU\236:g`&\334j\370\376\204\220\222\206x\277R\023?H&\036 -}\316\206z\275`@\321\371Z2\205\267]i\327(\253\241\241\320H\264\2338\335\201\264\334\351U\302\303\233$\211_\214"
+	.string	"E{\271R\241(I5\230"
+	.string	"I\034\201\036O\204\220\222jp\r\351q\f\213f8\324\221\322?\022\233\006E\236A\307\223\001\370\200\266\f\207,\200\224e\255\354\314\205&#Ez\350\257c0d\030\"\020T\365Bz\3013UaJ\273\340\307-\354\340t\356\255\b\022\016?f\001o\005hN"
+	.string	"\nUh\031\024\242\"\235\353\241\363\225B\b\256Q\304q\ni\b\274)\"\026z\220\341u\016\224>\361\306(\344\360QJ\334S \022\2167>\241\227gmB\033\227\320KV"
+	.ascii	"s\257-\013\212\204\243\215Ih%Y\217P\306\"(\371(\345\255\031\210"
+	.ascii	"\204\243\214CX\324j\020\304\370%\214M(\275\371\bD\302\021\306"
+	.ascii	"\037\200mu\211\024\005\300&\204l\004\310\231\212\370\201\342"
+	.ascii	"\341E~\211\002\264\325$\322\327\265!\315`4D\216\007\261\332\203"
+	.ascii	",\006@j\364\001\302\013\374#b\277f\217\270\342\016\330\306\230"
+	.ascii	"\0179\016R#\316\017T\f\207\200i\334\007\325\311(F\366q\352FV"
+	.ascii	"\004\tG\024\2130\304#\322\0338\261\006N\274\213\213\251\nR\230"
+	.ascii	":\003!8\232\030\003\266i\342\215\246\027(\225J\017\220\226\321"
+	.ascii	"T\205"
+	.string	"\027#@@\372\002!8\226\330\002\343\n>\n\272\375\bD\302\261\304\025\274 \3410b\227\037!\212\214\272\305\307\034\277\030\0012j\026.c\fD`;\3249\023BJ2\344\025\0340\237'P$\034=\370\030\005h(5\241T*\331\bP\2176\352\300\361\213\021\240\036\275\356`\225%h\007\247)\nFpB\025\004\341\244\"\352\222\2460\024\356\236\240\233~+\362\036\362\360\"6y\023Ch\342U\024cV\3061\327\0302\333\0342/\257\230o:\213\031'\004-\346\03473\237)87~,.\367\226Dc6z\334\332\316pl\340\364\360\364\315\311\365\270\201\263\203S\303\212\210%h\2517'\027Wf\246\270D\346\304\207\250\227\210H\004\210\321\336!#\001=\255\234\324\327\265\001\322\362o\2056\256P*\225\333<A8xY\207w]\024\260\313\032\330-Z\013G%G\336\221\345\345\030-\005\020\303\005"
+	.string	"\303c8\333H\245h\210\274\240\247T\336\304\260K\363\224F\321\034Q\241\247T\336<\245P4Q\315\225U\030\316}\254Bq\302\333\264)\203C\220/\374\310\365V\314\2417%B3\325\314\263*\244M4G\220\3204\227\006\213F\253\231\347\205\363\036o\0206\305\203\256\213w\205\2103w\005\212\006+\337U>\232\023\234\032\032n`\370\225\357\0320\305\242.\264p\027Xx\013+\260\340\2232\367l\004\275\255T\211f-\205\036R\232D\223\244\213\306\313keu\2053\036\253;\234\3404\240\301`\365\273\312G\343\004\247\205\205\031\024~\365\273\006L\261\274"
+	.string	"\250\360"
+	.ascii	"\250\270\n\037\350\264\360\2734a4c\315<*\316Rx\0037#\030\234"
+	.ascii	"\271L\343J\273\002\305\202\365\357*_\005'8%|\317\356.\nN\t\317"
+	.ascii	"\213]|7}\310&\034\002"
+	.string	"\246]\220\002\247\204_\377\256\0013\354\257\205N\201\342)R8\212w\031\007\372\304wi\316h\232\254\314\223\302M\334\274fQ\270\t?q\316\201\262\354\350\236p\024\3169\200\203?\341i\334\356\006\201#-\332\263\027b\330\245QK}\320\254\245\320#2\341\034\205\3256\2473h\232MG\277\\K.\001'\244e\301\231\333\222c\207\013\023\206\350'-)\277X[\202\252X\216\374bM\007\337\263\025\234\311I}].Wz\264\2454\373\213\r'\304Q\245\"eJ\375\201\342i9S\3114nk\tg\244\245aK\203h\334<\330\245yK\201h\342\220KJ\245\362\005V7\365I\177h\346h\352h\354\232yX]\246\261[Y-\341<\307)\240\223W\323i\323\321=\016s\031\263\210E\271\240\2005\255\310r\346r \347h\304\271\006\360\214\026\300\361\312\021[\022\276\277\365\004\033\201\336\263{\202T\251D\""
+	.ascii	"\2731\003*\351\350\256h\022F8\t\020\350]\232<\232\275f\236\021"
+	.ascii	"~hT`\003\332\310C\343G\363\267\027\345\246\200\336\245\251B3"
+	.ascii	"\330\314c\344"
+	.string	"\371\032\026\305F\267\034\301\273\266F\245\321\341\030\201\316o\351\r\215!\025\350\2456\351\362\004\313N\254.\n=VS^\277\225\325\250+\272\234\246\362\006 r\031\002\342\274f\331\b\364\246\262r\246\324\022\275\343\225\226\207H\350(\354\222\273\351C\343\231\f\307=\244c\312\325\233]\334M\037\356\221wm\025\341F\234wY\316\325\262\243\233\003\357\332\272\006^\204'q\264\330r\214\226\035]\317\334\215\"\242\303y\315Z\267\203\246\256\350\020@x\b\3572\232B\020\2366\211\342\201\202;,J\007\035\316k\256\225\266$\305b5\352\252\215\334\220\256\275\233>\334\026z\207\225\302\273\266\276|\207o\347\b.;\272&\376\362+\036\240wi\020i\024\233yL\\\r\213\nZ\321\037\324\320X\226\370\0074\364.\r\035\032;\315<%\376@\250(\335\3625+C\237\217E\270A\343'\221.\207\304M\340\274f=8\2113"
+	.ascii	"\236\274\007#\016\200\243\360R;\370\210\253P\344\340\0350\007"
+	.ascii	"o9\202|\006O\2128\362&\370\245\274k\353\006\027\361\024\3424"
+	.ascii	"\370\006\027hp\026 \030\334\345\031\\p\fNb\r\005[\360\013n\202"
+	.ascii	"W\005\267\300D\00576C\374x\227\226\207x\007\212\315\273\266\262"
+	.ascii	"\274\345\036\370\255\234\345\270\362U\315\370\377x\326\021Zv"
+	.ascii	"t\327\033\277\306\245\300\352\327w\260\226\223\270\354\350\246"
+	.ascii	"W\323\364"
+	.string	"\374vt\363\232\355\377\254\263h\323\321\205\241\233Y\254\2734r\320\320\321\314\323?\024\n\221\356\346\004C\021\322\341\274f[hc\335\325\"\337\245\321\203\206\217f\236e(\234b\035\341\274f\037\215\362\256\255|c\335\267u\206\226\035\335"
+	.ascii	"t\3124\200\254\2734\202\320Hj\346\341\037\n5\207\242\371\215"
+	.ascii	"\241\320\030\002\303\222R\251d\236]\032L4\2104\363\254\201g("
+	.ascii	"\274A\023\2507\272\233\327\354m\230\313\270\001\203@\206\200"
+	.ascii	"5\255\270\313\265<\023\230\265\2306\231\366\233\351Q\372\324"
+	.ascii	"\034\331$-\205\334\2041\343\234\271\273?\343]Q\323\212\313\314"
+	.ascii	"b\004'\3049g>\331\263\345\3045\251\355\235\320\325\350\241\355"
+	.ascii	"\233\354\363R\fM\354\224\355\315\nW\242\300\304\366c\373\354"
+	.ascii	"<)\201_{\260}\376\211\024\243\"^\262\367z\332@\313\262J\262W"
+	.ascii	"\302X+Oh\316\375\026+\001fYe\355\363\204\223\266\035"
+	.string	"\034\2636\367W\334\003\3050\313JyT\265G\262\317\233-\335L\355\251\366\371\257)FE\274\224\332\027\331g\rL\206\026\237\366P\373\244aqH\261iOd\237\377\263J\034\262_\332g\343\031\032\025\031*\355\231\373\214\301\254m0\310\036i\23710i\0034\332\003\371k\223R\036\371\330\027\371\315\371\220R\036}h\337c\212j\250w\035\373\035}@\216c\237\203\357\307\317\036h\237]\230\270gc\177c\237(\276\206\364v\366<ynoR\312\243\347\354u\360\330\022\245\276\334\337\354\363\304\332\335\025X\226\325\225\373\232}\246gJFEt\212\333\213r+5\332\016\267\021\367YC\024\256p\333\020\212\037\232\340\366 \032\034W\226\225\362(p\233\312\231\034Z\226\325s\373o\237\003\030\034*\353\333\236\262\317\313I\031\323\333\336\333\347\221\211\361\355n\033o\237\237\023\\\256(\333v\373Tq7D\303\3346\335"
+	.ascii	"\370H\031HD\nn;n\237G\031\030G=\244\313\262R\036\271mC\331\347"
+	.ascii	"\245(\275\360d\233m\237g\222hT\324\202\332\266\223}~N\312\nh"
+	.ascii	"\333M\366)\003a\ne\333f\373\374\223D\024\304\266\307\366\251"
+	.ascii	"Bn\210\204\257m\260}\336+\013\204%\333^\373l<%\243\"\245\262"
+	.ascii	"\206\215X8feugv\237\315\243T*\225\312\023X\335m%\273\373<*\225"
+	.ascii	"5l\264\273\273;\263\373d\234\225&X\226\225\362Hy\002\253j\324"
+	.ascii	"O\200B\3731RN\351\305]\256%?\032]<\3533w\371\321\350\342\331"
+	.ascii	"^i\227\371x\217JX\217\367\310\325E\274\307\255\006\302{\274j"
+	.ascii	"&\336\243\217\236\342=\nu\024\2571\372^\343\223\204^\343\335"
+	.ascii	"{\215v\3575\326\275\327\b\304j\274F\036^\3435\3420\033\357\032"
+	.ascii	"\310u\274\353\037\333\361\256~|\307\273\362\261\"\357\232\327"
+	.ascii	"9x\327\272\326\301\273\2265\017\336\025\253\211xW$<\205w=R\242"
+	.ascii	"w\025\362\336U\251\265x\327\037\255\305\273\026q\224w\275Q\242"
+	.ascii	"w\315\351'\336\325\246\221xUh3y\325\301\026\302\253VaA^\365\331"
+	.ascii	"V\274j\\W\361\252p}\305\253BA\366\252i\310^\025\315\204^\365"
+	.ascii	"\254mxU\263\021zU\262\306\341U\305J\364\252`\"\364\252_\035\304"
+	.ascii	"\2532)\321\253v\235\320\253*\351\037^5I\211^u+\204^\325\3317"
+	.ascii	"xU\255\022\275\352U\211^\265\331=\274\252U\327\340U\217\224\350"
+	.ascii	"U\247X\t\263Z\204\235\314jT\211^\025\212\311x\325\237\326\342"
+	.ascii	"U}\372\212W\275\321V\274\252\215\256\342U{\272\212W\345\351)"
+	.ascii	"^u\247\243x\325\032\375\304\253\3524\023\257\232\323H\274*N\027"
+	.ascii	"\361\2527M\304\253.\233\007\257j\323:x\325\232\316\301\253*\033"
+	.ascii	"\2077\215\266\ro\272\310Q\336T\221\025y\323D\026\344M\021y\n"
+	.ascii	"oz\310|\274)\224\357xSC\266\343M\013\271\2167%d9\336t\220\227"
+	.ascii	"\360\246\202\333\233VyoJ%\331\233\006\2767\005D\366\246\177\357"
+	.ascii	"M\237\310\336\324\357\275\351\024do\332\367\336\224\017\331\233"
+	.ascii	"\356\2757\325C\366\246y\357M\361\222\275\351\335\366\246R\336"
+	.ascii	"\233\332mo\032\345\275i\335\t\275)\335{\3239do*\367\3364\016"
+	.ascii	"\331\233\302\2757}C\366\246P\336\233\272!{\323\266\227\336\224"
+	.ascii	"\355\275\351\023do\272\366\322\233:yo\252\206\354M\323^z\323"
+	.ascii	"&\357M\321\220\275\351\331Koj\366\336\264\f\331\233\222\275\364"
+	.ascii	"\246c\357M\305\220\275i\330Ko\n\366\336\364\013\331\2332y\351"
+	.ascii	"M\275\336\233.A\366\246]$zS%/\275i\222\367\246\\\310\336t\353"
+	.ascii	"\2457u\2767\325B\366\246Y/\275)\326{\323+do\332|\351M\255\336"
+	.ascii	"\233\"A\366\246U/\275\351\221\367\246T\310\336t\352\24575\362"
+	.ascii	"\336\264\b\2627\225z\351M\243\336\233B!{\323\247\227\336\324"
+	.ascii	"\351\275)\021do\332\364\322\2332\2757]B\366\246C^zS!\357M\231"
+	.ascii	"\310\336T\351\2457Mzo\212\224\354M\203\274\364\246G\357M\201"
+	.ascii	"${S\243\227\336\364\307{\323\242do\352\343\2457%zo\332\003\331"
+	.ascii	"\233\016\275\364\246<\336\233\356@\366\246:^zS\241\367\2469\220"
+	.ascii	"\275)\216\227\3364\350\275)\020\2627\375y\351M}\336\233\336@"
+	.ascii	"\366\2466^z\323\236\367\246<\310\336t\347\2457\255\361\336T'"
+	.ascii	"\331\233\346\274\364\2468\357Mo\222\275\351\362\2457\265yoZ\203"
+	.ascii	"\354M\225/\275\217\276\367\213\311\336+\276\364>\361\275GL\366"
+	.ascii	"\376\360\245\367\320\367\336\020\331\373\302\227\336\023\276"
+	.ascii	"\367\203\310\336\013\276\364\276\312{O%\331\373\300\227\336\003"
+	.ascii	"\276\367\177\311\336?_z\357\367\336OI\366\276\357\275\347K\366"
+	.ascii	"~\357\275\327C\366>\357\245\367x\357\375]\262\367R^zo\367\336"
+	.ascii	"GA\366\276\356\275\247C\366~\356\275\227K\366>\356\275\207K\366"
+	.ascii	"\376\355\275\207\202\354\275\333{\337\206\354=\333K\357\237\274"
+	.ascii	"\367k\311\336;y\357\325\222\275O{\357\233${\217\366\322\373\263"
+	.ascii	"\367\336,\331\373\262\227\336\223\275\367c\311\336\213\275\367"
+	.ascii	"a\311\336\203\275\367_\311\3363y\351\275\327{\277$\331\373\256"
+	.ascii	"\227\336+y\357\223 {\317\225\354\375\326{\357D\366^\353\275\317"
+	.ascii	"B\366\036\353\275\277J\366\2769\242\367V\357=\222d\357\253\336"
+	.ascii	"\373#\310\336S\275\367S\310\336\033y\357\213 {/\365\336G!{\017"
+	.ascii	"\365\336?%{\357\364\336\023I\366\276\351\275gB\366~\351\275\037"
+	.ascii	"\202\354\275\220\367\236\211\354\275\322{\237\204\354=\322{\037"
+	.ascii	"\004\331\373\243\367\036\b\262\367F\357\375\017\023z_\364\336"
+	.ascii	"\373@\366\236\250\253x\337\343\275\037B\366\236\307{\277#\331"
+	.ascii	"{\035\357\275\020\262\3679\336{\034\310\336\007\275\367@\310"
+	.ascii	"\336\377\274\367>\311\336\337x\357m${\337\363\336\363${\277\363"
+	.ascii	"\336\327@\366^\347\275\317I\366\036\347\275\277A\366~\371\336"
+	.ascii	"\333 {_\363\336+\221\275\035}o/\"{[\361\275\235\210\354m\304"
+	.ascii	"\367\366!\262\267\241\357m\303\022\275]\370\336&|o\017\"{[\220"
+	.ascii	"DoWyoS\331\336\016,\241\267\001ItUW~F\375\343m\364\343\234\343"
+	.ascii	"\230E\323\203\313bt\034\261bx0\223\230\036\307\253\030\037-\034"
+	.ascii	"\255\216\315\230\037@b\202\004YY\355\242O=\321c\302\273\002\002"
+	.ascii	"gn\013\217\003V\233\253D\r8\301\252\316{\366\355\343\007h\242"
+	.ascii	"\267\217*\242\223`\032\262\351\350\003t\276\332\034\251\263\364"
+	.ascii	"\225c\264\3541\364\3561e"
+	.ascii	"$i\350\\u\305\244\311\203G\024\024s\307\331y\345\005\325!\364"
+	.ascii	"\326A\244iH\314\223\320\331\352\312\253\231f\3239\032\307;\307"
+	.ascii	"\371\016\3608\344\305\221y\024\022\303D$\346\351ie\265q\274\241"
+	.ascii	"X\255\272Z\002Ms@\320\203\220\242\200\276B3\252\305'\344)6\240"
+	.ascii	"\177\320\336?\314$\326\366\271\212v4zQ$\206\315\347L\324T\204"
+	.ascii	"\336\260\361\276\321=o\033DG\0371S1G\216\254\254v\317\005\240"
+	.ascii	"\330c\210g\347\315s\334q\344A\343\206$\246\331\\Y\355\235\257"
+	.ascii	"\320L\204\016\t\231m)\031\240\200\266\271\006\360l8\034\363Y"
+	.ascii	"\002N\260\361\371\236\255\241\363\256\201u\314\201C\2070\007"
+	.ascii	"\347\235\243u\374\361i\2343\216\346`\337\364\362}\263u\354\241"
+	.ascii	"q\343Y~%\307\331\222\221\226\321\316L\013\b\n\370\274\321n\001"
+	.ascii	"\n\370\211Fm8si\374\350\232\363\031\334M\037\356\005\271k\336"
+	.ascii	"6O\375r\256\226I\21681_3\034ob\306^8.\273\346L\245)\bme\364\255"
+	.ascii	"\354:*\243\213\3213QS\260\351\264\341E\305\363\242\227\0211\346"
+	.ascii	"\213\204\2300\343a\314\230\bzP\3053Q\363\017\232\210xN<\227\305"
+	.ascii	"\224\031\t\215\202\306\301\230\263&1jj+\253\214x\006j\376\035"
+	.ascii	"\246\235\017I\254\f\275\232f\3743\002\276Xv\332\230\265\0306"
+	.ascii	"\266\225U\206\236\213\232O\350P\020\237\220\327\244K\300\231"
+	.ascii	"\273\206\205gC7\343\224\276B\250\223p\360L\370f\324\233\211\346"
+	.ascii	"\rNi\n\2668\013\026`\345*o\021g\264\213\231\213R%\257I\305xw"
+	.ascii	"\2462\265r\340\215wuF\271\030\273\270@( \331\031\360\310\312"
+	.ascii	"\177W\311\356\214n1ym\374w&j\3425\237_\347\347\271\2141(C\262"
+	.ascii	"\262\337\325\257=\243\223\230>c\232Q-\306/\346/&0&pe\225\375"
+	.ascii	"\316e|\202"
+	.string	"\232\231\223\221\326\021\336\025\b8s\027\317\n\257\210\016\3475S\372\316S\252\030\313f\242d}g\243\246W\323i\303\267w\346;\227\361\336\337\004/\007\335\3625zyg\275A\343\027\223\274h\023\357\356\214Wh\354Rrw\226\262Z\204:\245\330\235\245\234\313b\240\306\255\030D\225\207\321i'e\265\330t\032\341]q\200\002\034}\\m\2129\301jN\211\234wSk-\301t\f\220\363\243\217w\023W\340\313\347+\307h\031\245\356\034E\321\330\314\262BR\007\245\233;\323\305D\215TVSF\346\316EV\205M\247\215\\\334Y.\n\212\352\311)\016\n\367v\20632\315DS\350\325\030\227d|\254\330}I\r\021\362v\276\262\"lBq;CY\032\223f\242+v_NO\273@P1\"\311\340<\031x\027Ff<2\006\221\321\331\221\351\271\341v.\262\032$\302\030\354\331\255\265\021)}T\n@"
+	.ascii	"\025z\265\251\206\023\254\342\030sX\3059?\273\370n\372p\005\316"
+	.ascii	"U\350;\211+\360e\343/\307h\331\306vn+\022b;\033Y\371=\271\363"
+	.ascii	"\374\344=\2041\2102\215\346\312kW\235?\306!\231\240\225\034L"
+	.ascii	"\364x\030w\254\3719Q;;1\346\2101$\023\344\250v\306a5\005\232"
+	.ascii	"6x\376\221\303\b$C"
+	.string	"\304\202%\023\272\037\237\2643\240\325\224f\023\265\212\261\207I\026\323.\020\202F\036\343N\223\367\220<(\001\2149v<\336e\247\203\256\246\025k\230\341\270u\265\t\346\004\2537\357\271y\377`6\240  \032n~\334z\377\340\n|\365|\345\030-\321\316\316h:\214K\243\215\241\261\306\250<;KY\3155\235feg3\036\253\342L4\205\245\225\351\261&\312\370X\311\341%h\224\205xXv\226\262\222\203:m\310\306\316d?\326\302\231\350J\016/@\302\301\2613\016+9\261\260\263\330\331\017\310Je\rt\301#\023\344\b\202\225U\016;\343\260\212\203:\237\315`\337\225a\312\fi\3469^\235\203\216nd\230\326\247\f\021\227$/\275F\332\005\202p\365\223yJE\004&\356\020\255}\353\024\231\250\"2SGVV\031\354}\304\252\023\253\270&Y U\342\f)Dq\223\213\3026\2003\267\005\212"
+	.string	"V$76\361re\220\3104?XR*s\230G]\276\207\206\310\312_?\300\212\007\204!\r\221\343\262\bVV\371\353\355\203Ex\365\020\311\020"
+	.ascii	"V\227_\221<9d\2470\207j\311\304\353\314\344\353\354\365\366\301"
+	.ascii	"\022\370\332\211\352,\n\340\314m\341\203a\305\2629\301\252\315"
+	.ascii	"\375X\265y\017\321P5\327\026\203\315W\254'\277j\024\346\030-"
+	.ascii	"\227t\235\227`\255tsr2\207"
+	.string	"]pJ\240I\270\316I\264V\26766\245\314\227\n=\256\265\255\263\323\212\254\351\324:;\317~2[k\332\013\030\364\026\210\303\265\211L\222\027\226V\246kE\223\361Z\317frd\276Thi\035\206=\347J\266\226\321\320\n\223\031\033[Y\345\254\367\020\253N\253/\350\020\013C\313.\030\316\334\305\272:c\225\255a6d\362\216W_q~5\317O\254\226@\255\220\234\255\226t\341@\222\244*\332<Bu>\342\324\032\242\302\232\202\032)r6\262Z\321\270\361\222\263\025\211L\023#\231\274\027\226\212\234\2270\245\035\221:\267E-FA\235\243\324V#JPRO\211ND\316Nk\353S\223L\336\221\310W\234D\232\022\233LKg\246\245!RK\247a\2179\204P\b\363,\004\305\212\024\244\212\tD\211\260\231\204tN*Z}d\311\344\271\240\207\364\032\230\322z\004\031<\002r>\302[w\254:\224"
+	.string	"Ys\030\235\237D\r6\207\370G\321\371\007\333\nD\343\006V\344\343\343\334\026%\b%\352q&r[{\314z\354\f\t6y\3548\363x[s\234\354Xot\234\237D\375A\207l\204r\234\205\316e2qk\315s\006\212L\3361\307W\234Q\034O\242\376\232C/\234\271+M-\254eW\233X8\301j\215Zs\246\342B\315\327\262g\340\2458\227c\264\f\002:\007\235\375t\026\023\325\304\027\004X\232S\021\351d\362`"
+	.ascii	":\001\230\240?\357\035\254\312E=[8s\327\347\306\331\207\360\005"
+	.ascii	"\rzu\352 \036\3378\r{Ul\234\237D\3715\207l:\332\303s\3569\247"
+	.ascii	"\240\002\276\250A\306N\375\223\271;>g\246\310\344\271\240Gck"
+	.ascii	"e\225y^\003S\232\332\247N\241\261\265\354\2642{2}}+\253\274s"
+	.ascii	"~\0225\005:\364\203O\330*\302\302\231\2735t\3165\374T=<5O\346"
+	.ascii	"/P\246J\225\225U\3269\023E\341m\rq\316q\3169\3472\235E\033\231"
+	.ascii	"A5\312L\224N\255\223)\224\201\312 \312 \342HE\335\325\361\256"
+	.ascii	"X\241\ro\336\206\212j\034\334\rtUZ~U\222\211\252nm\274<WE\315"
+	.ascii	"5\233\360e\234N\035\3011\333\274\tk\324\265\231\245\232\352d"
+	.ascii	"\006Ggfgge\225m\316e\254VE\311A\235a\274+\002\320\200V}8\314"
+	.ascii	"\331o|\202\323M\005\256a\345\271\206\306Y\311W\275;sc\346\247"
+	.ascii	"\231\207\306\357\346\324\242[\322\314\234\206\221\344\230\321"
+	.ascii	"\321\3143\363\2739\233D|\202\023\211\n\231\230\313\300<\206\205"
+	.ascii	";Xg\034\346\\\226s\265\344\241\212\305\244\b\233\001B\002\330"
+	.ascii	"\214\263U\024YSF\n.#\210\247\240\207\352\265\244+\b\250\323\006"
+	.ascii	"\210\030\007\342\\\006\3431|\250\\1(f~\250[3@FP\265T\347L\220"
+	.ascii	"\244\031&se\025\306\231"
+	.ascii	"*\352\213\207\323\007]\2123\327\202\253\024\326\272\253M\\s\202"
+	.ascii	"U\245\252\374\017\347\347\213\377p\036\242b\2758\252M\365j\206"
+	.ascii	"\211\310\314\323\323\312\352\213\267\020\363\323\236\323\246"
+	.ascii	"\243(T\345\327\272\227\2703\374\312A\201\213\243\300\207\273"
+	.ascii	"8\373\345\310\331t\024\210E\365\310\224J5\023Udfjje\325\207\267"
+	.ascii	"\020\237\220\226\250d\244\225\302\231\313B\023\n\252\330\215"
+	.ascii	"PN\330>\354\342c\241\007\331\335\211\026k\032\275*\366\316a\033"
+	.ascii	"\250\240\236\364\320|\017`W\233L\256\2021\033\311L\263\231Ge"
+	.ascii	"\362\306\301\030\310\365\260IA\001ox\230:\017]W\247\222\\\355"
+	.ascii	"\302R\211p\234\236\232\344\r\304\351\224\222A=#\255\023\250P"
+	.ascii	"?\201\272u\025\212\311\252\326\325\255\265\323z\3730\006y=l@"
+	.ascii	"P@\023|\315\271\t\336;\314>]w_\352\325\327\034\023V\325\352\352"
+	.ascii	"\325U,\357\230p\220^\341\310wg\266f\2224\363\250Vo\033\334E\201"
+	.ascii	"W\201:\314t\251A\\\034\225\312\233\027V=\002Bh\306\353\250T*"
+	.ascii	"oXY\325\341,\005\305\006u\026u\032\375\356L\330\314X3\217z\344"
+	.ascii	"\275\303\"\352\256\342\320P\340\343+7:\234\265\2535\272\023\316"
+	.ascii	"\334\226\246\022T\263\033\257HPy8]|\217\272\303\351"
+	.string	"\342\333\210\t\213W\315\216\364\332\233\313\241\004\317\341]f\243\372\230\211r\331\322L\231J4s\366\302\322\3164Q{\314\250\251<\324\241\2315\266\0317\267\225\325\022\274\227l\003\025\224Y3\315\246\243%\034q\357j\212.m\254\t \024\220\2043\327EL\204\365\306\325\303\020T\036N\025\337\243x\034\336H7\034\207\363\rg\035G\313\327\364\b\252\016\247\212_o\274\225\254\266=\301u\34511Zvt\007\035\316k\204\256p\320\341\234\340+ :\234\327 Y\244\303Yf\261v\r\263\317\330\026\035\024\020\3475\251\b$`q\022\234g\336X\374M\252\002\351\226VUs!\234\271+|/k\336\325CV./2\013\022\b\314&\254i\342\327\274k\340\325\026\355\243\227\026z\004\027\301G\300A\035\202\357\316\314\315\3245\363\210 G\275\331\263\243j\243.g\354f\356f\362f\362VVCp\232\247\263f\032"
+	.string	"\232?\210&L\330\201\227e\244<R\325\021:\234\327\250ZzJ\037\234\231.2\b\336\204\334\323\037\370\356L\337\214_3\017\bn\342\371\017\234\027\031Y\246\263\230\370~~\233\207\212MG\323\345Z\362\013T\200\024\2268si\254\0368#\315\374y\340\274\310\0314\251\232\242[\276\206\304!"
+	.string	"\324'\316\tN\021S$\234\"\236\007\031*\207\320\016\017\020\257>\257\301\335\031[\216\321\262\003\034x\007\316~\201\351\341L\324\005i\212\222\"\324\220\003\320\rh\340\033\310\3005p\256\222\016\322\004\271 M9J\024\254\222\201\263\223\247%\030\270\3001`\201_`0\005LD\374{Z \n\255"
+	.string	"\005^\201\302\264\317\360\220o\217\002g'N\321\246\323f\002\022\370\004\"p\t\234\241)\036M\220\013R\236 \364NJ\004\240\020x\300!\200\230\326\001\032\322\315=\340\354\304i\321\001\r\270\003\316~3\212)\334L\324\005)oJ\341n\0205\3227\232\232'\353\356\334R(4K\034\032\235\235\225\325\006\234\007Yu\342\244\bu\332tT\320\252\006"
+	.string	"g\356\nQ\007\353\221\253M|s\202\323\303\367 rzx\366\343\225\347\302\351pB5\342\360\353\221g\300,\2136\240\0310\200\245\351I\327\\\264\244\345Q\t:Qc\300\371\312\211\020\272"
+	.string	"\005|\0016\\\0017R4\251*gf6\234\255\234\b\233N\233\004 \340\t8\300\021\360\223\216\321\004\265(\311s\242\"\026v\200\263\225\323 \324"
+	.string	"\005\270\001V\274"
+	.string	"9R&K\201^KV\f6\tP\303\t@\303k\320\221&Q\002\344\332\242\341|\345$\bu\332\3140\200\317p\366\223\341\003\240\341\221f\321\364hI\313;2\312R*o^\340\277\335 xR,\032\037\375A\220\304/\271,\245R\031C3\275\242\371\001\204&H\322\312\252\fg?V\257\234\004\233\316&\204\206@:\220\241/0K\253h\230J,)\2256\314\263)Uz\204\2069\204\206\211)l\252\371\032\314e\314LSH\350jZ\221\2033\267\345\nyTr\225O\304\tN\241\357\341z\n=/v\301\335\364!\307\3654\301JB\037\253C\n\031?\250\220\361\203\006\253C\n\0301|h\321C\f\030@\230"
+	.string	"\007\026\037\254\016)`\264\300\301E\017\"\270\341\007\0257t\260:\244\200\341\"\210\037Z\300P\001\200\325!\005\f\035b\260\350A\205\017.z\350\301\305\r#b\370\320\242\007\037r\330\201\207\002\270\370aF\016.1|"
+	.string	"\302\305\r\252\f\027\006\300\241\305\t|\330\201\207\025\031.H\360\033\230\205\b\272\007\026?\344\340\"\006\214\035tXi\221\003\213\0300T\037Z<\240E\017,|0\356\300-x`q\003\f\025\007\027\020\210\241C\016;\360P\002\013`\304\330\301"
+	.string	"9\260\340\241\004\307\030>"
+	.string	"\341\342"
+	.string	"-b\314 \301\n\214\034X\360`C\013\036H\300\002\306\016\b\310\301\207\035z\370\201E\0061ZX"
+	.string	"\006\003Z\364\260\303\005Z\304`\201\200\033b\374pA\f\034\032\007\037X\364\320\203\213\003\340\320\"\306\017.P\200\002 `\370"
+	.string	"D\0061`\340\360\tX"
+	.string	"\0028\364p\303\2727\244@\001\214\036T\240"
+	.ascii	"F\017*|\330\201E\017*n\370\001\206\212\024\"\326\005\nZ\374\240"
+	.ascii	"\"\206\013\027?\250h\331\335\345\262\341+-{\361Q\n\233\221\316"
+	.ascii	"\231\214t\221\271\214W\002y\020\351\234\245\200\231\306\232\n"
+	.ascii	"\246U.\200#\233/7\025|Z\345\354\305(\214\231-\363\276\210lR\245"
+	.ascii	"R\251\234q\034szFZ\200J::X\2274E\006\213u\022\3462\346&\250)"
+	.ascii	"\272\232VL\001\214\336\n\342\314]*\201O\251\004i.\032\267\300"
+	.ascii	"3\321\230\027\024\360\357)`\322\237W\363\351\367\364\311\364"
+	.ascii	"\203N\351{:eH\337yhlI\223o\357)\037\323\036\324\251\227\367T"
+	.ascii	"\217Hs\275\310;\017\211E\233)^z\367\024\357-\343\251\271\322"
+	.ascii	"\2733\221\330\"\020gJ9#u\222\346\222\362\346\342\f\304\210@\351"
+	.ascii	"n^\263'c\024\210T\241\253i\305\030g\356\0078\342|~H\207x\203"
+	.ascii	"\2647\263\027+UX\375y\317\332\375<\265\373\312\004\365\007\343"
+	.ascii	"\314\037\256\224F\371\017]|z\315f<&\243\310Q\306\224\214#\315"
+	.ascii	"<i\2243\037\221-\272\233\264N\311\323\272s\031\257<\255)\335"
+	.ascii	"U%\353\022\305\305N\006\222e\247\225\321\224\201\205\265\262"
+	.ascii	"\232\322}\0051?\350\020\027w\332\333\021\024\360\305\\*\367t"
+	.ascii	"N\206\226\213\213\334\331H\330\"4\016\356i\334\226\313\233\213"
+	.ascii	"\233\013\024\0312\272d\310\360ZYM\341\316Ua\211\351[\n\345\351"
+	.ascii	"\233\214/\227'V.k)\024g\330`\224w\005\n\316\334uk{\352\026\346"
+	.ascii	"\222\026\004Z\033\032\333\363\311\332\323'c.eA<Y\033s\362\026"
+	.ascii	"*\263,#-\265\264\247je.`piL\232\3145\321\316\236\242\235\271"
+	.ascii	"tE9Kb\006-#{Z\326\304\305\251G\2265&\327\024\013{*\246\346\322"
+	.ascii	"|\206!\001\373b\362\364k\315\205*\bA&.F\274\316UaqB\340\350p"
+	.ascii	"^\263\244\353\351\222\263\222\247]g6\027(\031nA$*"
+	.ascii	"qJ\262\326\344\332z\312\365\346\302d\2635\304\351\004\252\225"
+	.ascii	"\365T+\316E\251F\026\022\226Y\363\252\371\364j\316\005\210O\363"
+	.ascii	"\207\325\271*\214\t\024I\325S$u.DBU_q\016\035y\013\025\231\224"
+	.ascii	"\221\026\325\324S*;\027\035DS_q\272\3440\242XD\352i\221;\027"
+	.ascii	"\240#\231\257\243\324W\234>Q\212P\351\323S(\227\036\036!O5\234"
+	.ascii	"\240D\232\236\022A\341\202\343r\343\324t\027\230\322\\lR\246"
+	.ascii	"s\025Xbs(]J\207<]\n\021}\341\302\322\312\310\013\261(sgD\346"
+	.ascii	"\013\205\336\220\273\300\224\226(\244\220\251\364\224\271\027"
+	.ascii	"\002\372\302J\346\353\250\364\225\302\244s\025\030!\024)\310"
+	.ascii	"S$A\0327\032\226\224J\345\013!\252Pq\0069\r\200GP FO\201\370"
+	.ascii	"\321\270\325\260\204\"\304\224\276%F\257\201i/\3751\330L\213"
+	.ascii	"|<-\352\013\201G\343FC\n!\356d\222\264\240\027BJ\n\304d\276R"
+	.ascii	",\371"
+	.string	"8\r{Q\210\316V`\202=\206\236\366\360\0131\2076\024\307\343\t\335\241\343\351\216\277\020P\236\350h\023\232\322\314\201\343i\216\300\020kp8\324\202\356\200~\236\002U\t\201\026\345\307\314G\356\206\215\2477\006C\214\275\320\263\021\326s\256\002\223\023\344\331y\312S\030\302\353\305s\247\253\306\271\n\f\016\220.\325Is\236\352@Cl\245@0\315\321Jq\330\322\233t\371\364F\006b\210\253\024\034\246K\253\324\206-\255y\252|Z\243\030\202\352\2052U\032\211\236\253\300\2364\027\025\377E\031\321\020Q9\212O\211\210?\374\021kB4\321\270\3318\\\202\236\255\300\326\322\320\262\f\013\177\303e\210 8\n\201\020\236\253\300\312\244\214\212\032I\f\251G\"\243\200\304\203\316Etq\360\202\377 N\210\035/\206\004C\bU9Wm%\266eE\257\242F\321\242\250\005P*\201?\025\235\020<4nF\201!j"
+	.ascii	"\236\255\266\330\232\177\317\377o'\004\216\3223\304\322\357l"
+	.ascii	"\265\365\004:4\245\357\237\322\023B\031\203\030\355;\033m=i\362"
+	.ascii	"\355\375|7Z\022c\020\021\367\316F[kP\275\274_\357\247\305\360"
+	.ascii	"\205\221<B\274s\325\226\223;)\377]PK\025+)\201vg\253\2553\350"
+	.ascii	"P\224\272?J\216\226\247_\335Y\223n\356\247\323\321\3027\023\335"
+	.ascii	"\233;\027m\231A\345\342~9\036-xwqg\243-\263\246\023\356\355\207"
+	.ascii	"\213\022\203X\367v6\332*\203.R\321\341\274\006\212\333\017\245"
+	.ascii	"GK\334L\024\316\355\\\264E\006u\266\261\375m>Z\334^\244\261\261"
+	.ascii	"=9Wm\221\2559\371\327~\2648Qs\362\245\226\366\253\001iA;K\373"
+	.ascii	"j\202\3667\t\322BF\207&v\306\304\254\3547Kj\371\302+\373J\213"
+	.ascii	"\027\331\331j\213IshL\354\037c\266(I\"\006u\206\201\375aCZ\234"
+	.ascii	"1\210Z`g\243-\257\246\363\213\311\377\305\324r%\310\304\312\013"
+	.ascii	":\364%]\377\222\031DZ\216\254g2\016e\276\336\365\225\226\251"
+	.ascii	"+9[m-y\222\237\353O\362\255\237\353\251E*\006\261%j\253\310\031"
+	.ascii	"\205:\241\274+|\330/\336\265\025\321\251\365;\243Z\232Z\226Z"
+	.ascii	"\230f\024\231\232q\344\310\312\352\265\316RN\305f\026\326\237"
+	.ascii	"\205\244\205\251\204u.r&6\257\336\374\257n\3657\317\315\226 "
+	.ascii	"4=\216\254\240H\252~$X-?b\020\213\252\316F\316\302\346\021\252"
+	.ascii	"\377\210VK\217!*\350\224\221\177j\253E\207\220\221s\221\223\260"
+	.ascii	"\210\324_\244%\250\005H\352\\\344\034\204FA\375QIZn\264\330h"
+	.ascii	"\351\201:[9\007O \246\321\341\274\346\311\351\177\232\321\325"
+	.ascii	"\242\223\343t\226r\n"
+	.string	"\022i\372\211x\265,c\020S\350\265\330\314\250\245\260\324R\323t\276r\376A\231\226~\246/\226E\305\304\245\277\346\020!\377\2200\026\350L4\005\213\341\214Z\t,\205\027r\266r>\231J?s\306\030\213 \025\226*3\312f\234\315h2\243\211\322\231\310\371l\"\"iB\304#t5\255\330\303\231k\201\032\336\t\326\037'q\246fd\202\265\350\252\317{6\t\351Oz\372!A\203\034\375A\370\366f\330\035\217\316WN)M F?\020\274;\243s\221s\356?\316\376\037o'cP\026\265\276\350\352\331w\364\356\214\265\031l\315</\372\233\034\"\322-_\343\203\350\367\341\3062\027\307\"7\343m\343f\314\315\255\254\236\350l\304\311v\be\310\347\037\372:\204/\217\00776\226\266\375\361 \234g'\230Q\307\262\246\306\342d\206]\013KJ\245r\306\335\214\274\nx\306\336\312\352Z\364 \234d&"
+	.ascii	"\302\347\361\357\335\364a\037K\2233\026\264\031~\1773\002\003"
+	.ascii	"y\274\235\234\036:\277\242v8sw\207\216\177\307\214*,dc:\316U"
+	.ascii	"\316%M\241\034\277\320 \013\330W\016(\216\240\037G!\313\222\256"
+	.ascii	"\007\235\255\264\242\007\372\371\201f@Y\270f\242N\226\255\031"
+	.ascii	"\2103\024gDgD\177\254\264\026\235xW\350p\346\256\317\215\337"
+	.ascii	"\247\206\005\353\352\006\324F\317oc\311\202\244\252\347\\\245"
+	.ascii	"\225\330\344\371\316\317\003\203\3032\025\203\310R\204\305\b"
+	.ascii	"\214\016\314\016L\017L\317\312\352w\264\n\241L\274+r\270Q\310"
+	.ascii	"\006\310}\246uT\202\032:\177\215\037\226'\247\353\234\251\264"
+	.ascii	"\362\236\203\363\347\234\313`\202\216\363\273\025\376\240[\336"
+	.ascii	"|\371\337\300\344\370\362oR\350\203n\231B\341m^\363\333\350`"
+	.ascii	"QbAbI\202\341\321\003\306\207\217\225\325\327\234\251\264\356"
+	.ascii	"R\b+\324AW\205O(\f\242k\021\3300@`\202\020\"\322\345\235!\301"
+	.ascii	"\201\004*\224\253M!8\301\352\215\0337\234\2717\256B)$\2012\372"
+	.ascii	"+\223X~\024\371 \212B\027\025\337\213L\026\036;t\b)\3165\023"
+	.ascii	"\021\337\211CX\202\200X~X|\020\345\016\017YzxXvXj@\317\206Yr"
+	.ascii	"\315B\026\034),7,K\026\233\302\270A\301\367`\225\267\3409J\023"
+	.ascii	"T\303\242bb\2258\026#\b\004\f\374{\003B\245\254\030\352\025\302"
+	.ascii	"4aX\"\374{c\261\rEYl\"8s7\005\201\332\363\367x\217\337{\274\375"
+	.ascii	"\336H\330\206!b\177!\370\200\032\367n2\353\370\321\341\3039'"
+	.ascii	"X\265\361\236M?\240\362\274\2210\013\235\345X\344\234\345\027"
+	.ascii	"\253\332c\343\335\344\022\246\356\222@p\346v\223\231\307\217"
+	.ascii	"\016(\017\250p\337\264\003j\317U\236\367\330\270\032\367\f\206"
+	.ascii	"\210}}`\210\325\236\253po\371\022c\363\300\224\276)|\357\276"
+	.ascii	"w\031 M\0203\321\303[\371\2039\302^KO\230\346\013z~|\357&\333"
+	.ascii	"@\224\345\244\003\0338\n]m\2229\301\352\216\272\363\246\342\300"
+	.ascii	"\316\217B\317`\b\030\333\006\316\334\335\323{\357%\255\354\351"
+	.ascii	"\345\341\351A\363\360\336y\314\025\273(utxe\315;)\357\273!+q"
+	.ascii	"poP\244\330Ey\333\235\375\230V\330f\2425,=\20192\203\336\032"
+	.ascii	"L3\305\222\223(g\303,\262f\235\220w\335\233\2121\360\323Yl\272"
+	.ascii	"\257B`\210\2544qQ\203\036\032\314\021\032\226\316`\232)\364\314"
+	.ascii	"\350\316\207Y_sr\357\271\216{\313\235\307h\202j\020\20392C\030"
+	.ascii	"L3\005X\334\3310\353\253\251\201\324Hy$6\0011\013(\003\rwF\352"
+	.ascii	"\342\333\353~\373.L\024L\221f\236\206\203\362~{\257M\255x\321"
+	.ascii	"\004\361\327\222Ry3ee\t\314\021\366\322S*o`\220\254t\3014"
+	.string	"aXR*o^H\262\242\004\006K\013fkke\265\241\274\251\330\206\242,/(\006\216\310\273\262\005\223d\3059s\266\362\227\330R.\340\326\366v\353Z\271j\266\ra)\246\361\256\260"
+	.ascii	"\005\214\321\253M3'X\255Q\343\315\326O\336l+HV\252\236\274\245"
+	.ascii	"*P\343\306\350K\3449\347\326\234\274\327\316~\352S\355\355\244"
+	.ascii	"\203\264\267Z\223w\332\323;\257\025\251\231(c`7G5\025\005\325"
+	.ascii	"M\276\026a\021B\033\255\317\336h0_+Df\242\026\344\230\2232\262"
+	.ascii	"\013\304s\245\t&,\025\021H8fcei\205\tf\254\f\346\254\311\312"
+	.ascii	"j\237\275\245X\245\202EH\2013w\315\312\336fj+L\245\262?2\262"
+	.ascii	"\265\225 1\210Gc\347*\254\277\246X\330[\214m\345\307L\264(\354"
+	.ascii	"L\205\365\204\202}\275\301\334Vz\304 \016}\235\253\260\236M&"
+	.ascii	"^o&o+:\204\274\316TX~\320%]\357%q+A+?+@0s0u0v0v]TX~M\276\t\234"
+	.ascii	"\271\253$\311[\311\335\212\215\236$xM\256\2557W\336J\215\025"
+	.ascii	"\235\255\271\n\n\217\f\001\235t8\257\311\242\303y\215\323\271"
+	.ascii	"\267R\263\242\324\312\302zg\365\035\025\023\261\314\252\350p"
+	.ascii	"^c\204"
+	.string	"\016\3475W\315\367\325\271\314\357XH\330<\017a\221=\237D\317!:\234\327X!y[\031\365\252\336H\3169,L\343\266\366\221w\3259\307\310\262\243\333T\357#\347\300\357\357\370\234\211\372QE\373\016\373\f\351p^3e\344=\025x\324\3133RD\352]\244\312QJ\f\242\235\324\231\350J\261\031\005\365\216\032<\322\315D\347\240\316CW\211\320'\247\367S\341\021\356\315)\261I\244\351M\004zlckbbB<:\211AT[:\023]\0256\207\by\017\201Q<\242\231\035\317`\24251\313\245\220\241+B\350\231\004\316\334e*\275\2318\307\261\030\035\261V:\033]\tB;)\351\\\026\263s\374:z\035\231\304\364\334\210\371\371YYm$\243+\301f\223E\340\314\335 G\357 @\336GAG%I\270\266\200|\r\213^\250D\343VJ\314\016tQISN!D5\243A\002\022\323\031"
+	.string	"\b\006\3424\217c\351\356\024\200\017MfH|bF\240\323\262$\213\3610\333`\006\004&\t\343\005\326\006\241y}"
+	.ascii	"\304Cr\240\037\020\344\225\376\n\303\345\237g\236\236\264ti{"
+	.ascii	"F\346\251\306\275W\366\321\277\347\022\004y\2041\373\b\025\276"
+	.ascii	"\254Mi\f\223\320\261\314g-\177\354G\t\317\350V_\277U\262\300"
+	.ascii	"?\004N\263\303\307\216\372\201\315\023T\177\033r1\037\021\216"
+	.ascii	"\275\311\232\351\004\335\2424\276\240q\002\336\304\324\314\331"
+	.ascii	"\275o\211\270\361\2155\216f]=\251\334\036\376A\247E\3248\337"
+	.ascii	"\314\331\030T=6&\006\016\253\263sM\235i\304\221\2241\224 G\023"
+	.ascii	",4\332+\341\f\366w2*n\373\236\320ia[>\212\276\r\353FH\325\305"
+	.ascii	"\243\0059\370R\204O\202p\0353H\036\326\211\201\023!\345]\274"
+	.ascii	"ov\036\354\n\231\350\t\013Q"
+	.string	"\344\263=\3301\202Q\032\\^\347\317$\303\335\250[*\005\314\233\307|5\240\004U\b\233)\276\270$,j\001\030a\376^\020\235\227\370\367:\261@\264c%\267\264\222\217\352K]\003\352\207_\265\252\314\342,w\3564\272\214\366|\316\031\344ZCF+\377\354\201\246\370\026\367;\277\320\305\204?\265\241*a\224J\322\310-\025\324y*\373\351\177\315\255\301\255K6ci\260\363+L\307Q\2561\266\002\031\\w\236E\t\316\003\001F!\255\031\210\351u\207\230|\026\251#\367He\377M\n\322\215\337W\035\322\217,G!R\202\230\307\320\356\3206\201\232\365\003G<I\201\230\232i\021\017}u\374\330\376\330)\0073p\353\021\244W\245\373\200\362\2653\331\230Y!\037\016\327By\022\316\254RL\366\203\357\300\241\304 ru\301h\344\326T\027\214\3208\013\211\345\377\203;\f,J%\273\211\312$*b\221"
+	.string	"s\250\346\217\321Z$F\224c;Y\256/8z\357k\261`\212\313t\265L%\232:\200\315\035A\243H<\334\217\346\020\235\f\021\263\226\275\226\212\305\024\025\265\367\331\323\223A6\276\324n\270\317\037\352\021Y8K\035\244\312J\006\266\367\006_\210\306\306K\307?=\255\\\200)2\271z\330u\372\202\306e"
+	.string	"\374\024\220\364\322\321\322\361\306Z\032lW%\0023\td8dVN\366\201q\243\304\027\231\032\3626\362\r\272\3306\306?`\030\242%\257\254\033z\f\222]\b\367.}\376$W\034\240`}[\207`\200pL\371\331d\373\315|\357\226\330\026\3467\257GiQ`V"
+	.string	"\345\244\204$\275\036\t\262\366`kT\203<{\337h\375\035m0\221\205\316,`AQ\224S\\\262\366"
+	.ascii	"y+^LxL\320\3362`\252\226\203\020/UmZ[[\375r\005\032F\243)tn\376"
+	.ascii	"XE\026\252\221\331f,\335\374\214\022H\305\bf\212 \237\006\357"
+	.ascii	"\037KB\027\031\266\246\3345\0070X\367\207\233\2553\034\215\320"
+	.ascii	"f\321)\275:\236_\002nE\032\234\335_\001\244\340\270(5N\305&\354"
+	.ascii	"$1\241\002aXM\255\304\213\305TJ\306\333\204U^\373\367\016\277"
+	.ascii	"k\315DC\346\327\333%\377\303g\370\336\0358\022\236\350\3015d"
+	.ascii	"\200/\355\204\231B\370\306\220\264L\"\006\217m\2059\365X\tL\327"
+	.ascii	"\036\312\007+`\315Q\033k\330\257\211\027\214\375\264\243vc\366"
+	.ascii	"\305\fD\351\350N\212\377\233\337\346\311E\0160\031\013\355\266"
+	.ascii	"\200\343\313\272\361\206,=;\364\371\003\224\331$\335\234\\\330"
+	.ascii	"\017\003\317\212\213\032\334C1/@\233\354\215\025\271{\346,\035"
+	.ascii	"] \335\351n^K4\b\306\377\245v\025M\325\032\257\206\315\341W\361"
+	.ascii	"\003\246\365\327\221\034\006\247*\264\030\341\275Q\264\321t["
+	.ascii	"\025s\030)F\312\346\204\230\034\3360\311#\252\303\224\033\361"
+	.ascii	"\247\026B\247\372\304\232\347\355\bUT\027l\312}dx\220\372\345"
+	.ascii	"\037b'<\367s\262\314\342|\360\303\371\267.\227\302Y\222\275\251"
+	.ascii	"\333c\024r\252\254\"\017\2213;xm\330\252Q\255\315a\267!\345Y"
+	.ascii	"\r\210%\330\227$\354\344\004\b\316\200\377;\230\020\266\217S"
+	.ascii	"\375H*\274\362i\256v\362\343\\\037\312\037b~\237\322\004`\323"
+	.ascii	"\021\322\255\223\247\342\306\225\200\230v\253g\006\334H\bk\252"
+	.ascii	"^Q\215\373{T5e\257L\263\242\344\260\337\022\262\037\317XF\002"
+	.ascii	"\365b\326iO\341)\006tr*A\341V\332\205_\364\bA\333.\317\323i\006"
+	.ascii	"\343\006\373\352[\357\247`\022$\372\006I\206\250f\333\342\220"
+	.ascii	"\214\034\3105\246\311|\032\250\310\241\267\236\217\322[\341\033"
+	.ascii	"\026\306\206\341\304+m\360\204_\246\270Y\262qSW\003w\221\214"
+	.ascii	"\275!\325.\253u>\005<L\255G\377\032\203\254\321\203\307\366_"
+	.ascii	"/#I&@\2477\316f\354\004\251Iz^\250\357\315UZ\232\315|\226,\326"
+	.ascii	"\212H2y\201fy\013\221!\236\350ld0\237\262\005\256\211\036\330"
+	.ascii	"2\257\247W\001\243\030\003Dr\203\207\002\263\357A\214\026\242"
+	.ascii	"~D\337-e\373\357\302\017\241\237d\250\260\253\206\")0\213\326"
+	.ascii	"\356&\265\226\304N\372\264m\340\366\274.\355\203\267a\332O\240"
+	.ascii	"M(\356\332S\021\273G\363\0020y\307\213\362\367\375\004\203\271"
+	.ascii	"{^-\2023$\003\333[\246q\232\242"
+	.ascii	"=\031\375f\335\004\246\025\241\2161\020"
+	.string	"\317F\252\330BdF\013z\242\203\222\2628\325\254\206\253\335Z:Pc\364Ut~\371\005J\261t\261\265\026\225\217\013T\333\214\032g\324i$'\315O\031\272\2168:|\034\350Ff:P\322\202\202\332\024(d\345X\343\016Ai)\320\3732:\276O\242\267}\322B'#\202\335\353\273\372N\257d\306P\025\241nI\211fng:*\323t\3509\323\305~\252\270K\347\276\270\203;\235\343\336=\023`\036\251mzk\243~\240\222Y5\210\343}\353\340F\272\225\3067n\037\257\252]\244\331{i5\271\006[\312CV\310\021T\307:\331\031\215\264\245\030\303\276eg\263i\264\240\212\322D\346i\006\fn\230\030t\257^6\362\245D`\344\363\017\235{`\016=\n\203\035i\355\211v\341\020\313\t\327\370\325\035\247\313\323\303z\230E\036\016\306\215,z\201\024/\320\242\235\260\363<$\r\254J\016&\323Q"
+	.string	"\242\334<1\035G\bB\366A\2434\226\310\276\036\261n\356\026\2111+\016\260\364\217j\357\232*\356\374cm\365\036\255i\231\362\347\035\321\227\361\214\217\362\333iP\177\271\322\271\251\253\263$\001r\216\341\314h\006"
+	.ascii	"\307\"\013\211\321\377\\b\313\316AO>\030Ox\370vT!R\341\234\030"
+	.ascii	"\336\221<\226O\304\270\271D\322\251\rQ4v\006\233w[\237\324\021"
+	.ascii	" \264\351\336\006;\225t\251\034\031\341\0055\f\205[|\007%5\277"
+	.ascii	"V\204\013\1777w\341s\301\367\354\251\343\351\264+\035n\312\372"
+	.ascii	"\203iO\251\222\236\302\n.^OI\340\314\255\320R\020\327\364\342"
+	.ascii	"\233\242\376\030\247n\222t\335$\307B\313\262Q\365x\306\177\r"
+	.ascii	"\367\322\2207\355luK\nj\2005`\271\216\332\216Z\013i\350rz\031"
+	.ascii	"\212o\245\350\214F\216:\233X\354\263\250\360\376\346\256\245"
+	.ascii	"\316\350\270S\306^\350\353\347\373t\210E$}6\273\301\360=\007"
+	.ascii	"\206\030\223$#<0`\246!\3056\227d\3130\376\332\347\024\347W\177"
+	.ascii	"'\354'\245\273\262&}yk\272\336\b\316\036\215),\232\214\001\032"
+	.ascii	"\340I\007\327\263\325\276T-\037d\200=\\\020\f-\372\265\302\201"
+	.ascii	"ag\303\037\307=`\355\2653\313\213\023#\250<\2719\023@\377\215"
+	.ascii	"\2528s\320\322=\235\250\344u\362\261$\303\323\334h\223\312\347"
+	.ascii	"u\357\324F:'\030\001\366\n\201\353\327\257\250\221]\303\376\004"
+	.ascii	"\3021\232\241m\237\"\262\324\250\n\032\344\021C\335\3365\201"
+	.ascii	"\356\323\203\021?\205\211\217\301\365\274\216\227\211\275\033"
+	.ascii	"\007\3725\314\244C?\314t\354Btk\331V2\274\341\376-\004\376\036"
+	.ascii	"\366\362N( /\344;\352\332Q\0274\257\275\004\347\317\211@m\021"
+	.ascii	"\374\273\016x\bOx\254\266\302\346!\017\305 \257I_&q\267\323\307"
+	.ascii	"V\312zT6t~(\004\007f\\0m\265Hx.y\013&\344M\335\016\350\2079\352"
+	.ascii	"s0\321;\2260\367\031y\3727:\003\207\030\263.\3332\004gY\356\f"
+	.ascii	"\317@\036\215\227\013\032\364\0357\254\275\332I\226\330e\004"
+	.ascii	"T\356Y\204\300=nKt+\302\025\320\b\325\237\n\032\251\364c\330"
+	.ascii	"B=\204H\360\313\003\330\023\r\250_\337!\001\245q\254\n\034b\025"
+	.ascii	"\321\374\220\245\225\305\274M6\031\323\3241jdE\365\351>#\271"
+	.ascii	"\031\236\232\031\256\024(yF\204\303\273\261*\333\366\357\233"
+	.ascii	"\223;\316(^a\245\344\027\247\343\264\241dw\246\327P\315\206a"
+	.ascii	"b\275>\023\222'p\331d{\355\267\nI\232\341Y\356_\356N\253I\233"
+	.ascii	"2o\270;\324;\241\372e\364\220@\261j5\365\021\246U\230\325\007"
+	.ascii	"\361\232\256\207\335`\334S.\244\271\364\262\001\220\004x\251"
+	.ascii	"5\017\314N\301&\226\2602\260U\301\227x\206\323v!\036\206\347"
+	.ascii	"\226\233\335U\376C\013\007.\036\274?\271fB+\240\311\231U\275"
+	.ascii	"\b\263\235\365\272\352\375\321^\241\371\370(\307\017\020lNgG"
+	.ascii	"\2708~\2177\350\343\003\307\257l\357o\315\322\336\217B0\201\321"
+	.ascii	"\275Z\342s\370\r\270\035\251\200Z\263u%\331\352\360\\\031\221"
+	.ascii	"\nA`h\210\034\277\320_=\t\247H\317\25687\362&\274ZK\027p\323"
+	.ascii	"\2279\201\370'}\277\016QkUh\373k\013C\3473\300\312\375\246\347"
+	.ascii	"\265P\020\025\036Y.\356\271\352\351\235\3739\214'\210\336\201"
+	.ascii	"\224\032\230\340\234\245&6\311\237,\244\265*\"\353r\335c\026"
+	.ascii	"\026\001\244\307\363nw\\\333Z\007z\212\337\303\274!Y\2378\250"
+	.ascii	"\334\\\341\207U\3163P:m<\033@\237\017\365_\026*B\345~\357\027"
+	.ascii	"2\240\215\237\217&Z`O\247Zd\210\337\0132\226\327\246*Z\255\024"
+	.ascii	"LQ\350^\245\202B\026\377NK\226\210t\204d&]cS\323R\327\314\213"
+	.ascii	"|\267\265\312m\225)z\322\017\002\003\321\326%\235\034\261\365"
+	.ascii	"\343\336"
+	.string	"c\315\263\337\206\266\312\325_\331C\201c\206P\260\201\336\025\307$`\255z\255c\177\216P\206\322`\311\256\3216X\273B\316b$\307\210\207t\255\004\360I\363\336\01787\235\301\371\350iS\372%\304\250]\334\263\2358\204\t\031}\273\262\265Pjo\303\362r\357\211\372\346 \230\324\035;/\337\272\242\313\257\001\334\235\325\212L\001\202\257\033\231\363\247\177|_\226E]!K7^\033\216\2118?\372\021#Y\002h\255\324\256\234g\306lV(\324\037uV\f\034\230\221m5\215\340\341\200\037\334Z\017>\317\346\177W\364\211\276\311 \013x\273\352\253\32744\004\023\206z\27312\246\243v\017\022xs-\027\257\315N8\226\372\255\354\022\310\275[8\371g\037\264\007\312\377\321\210#\300\300\247\206\224\024B\246~Z\2531\362\205\034\242)d\302\231s\204M\352d\216\035\035\272\364tUYU\b\363&\026\200\235"
+	.string	"\374gge\244\312d\324\355\t"
+	.string	"\263\030/y\222'\323Q_T|$pw\261\323\r\226\377\302L\036ZB}\237\2569\216\307d_\201$\225\344q`\206\370~\304Gi2\2063h\327\3043+\262A\005\342\271B\303\217\245r\004Z\02381\020\020p\tf\225>~\313\253\b\337-\021\326:\320f\237\340\315\347\313\335\024N\025\326E\ty9\013\243\262\240\335\036\235\027\f\3222\244\2709;\f\200p\241\341\252A\303S\315\350\306\254\373\253\311$\244G\213\202S\216Xw\260z\254\212\330\275<j8\267\363\353\035\0167\323@\222\204|y\253%\026\265&\360\253sYX?U\372\253\306\252\273\032\233\201=\246\217\214\367\314\205\343\232'\007\370\256\366q\274\344\0232be\264F\232\364\030*\225''\253I+d\230\035\265\"7\314\355\337p\210\350\306\001@b\303\t3\3041\225h\331]]&"
+	.ascii	"\256\275\007r\022y\022\356\310\357\363\276&\307\275uj\347\243"
+	.ascii	"D\310x\263\302:\233b\376\373\022\f\003\303S\204\245^\262\214"
+	.ascii	"\3648\312\210\331G\205\351\202[\226_\213\277\013.\271\313\317"
+	.ascii	".\027\f1\245\316\344^\276\326\271\225\206.nk\3129\016c$\375U"
+	.ascii	"\362\254\333r\330\r\221 \0338\f\264}\232[\020\357d\337\nL\223"
+	.ascii	"\006\217\"\345\364\325P.\023\f)\377\021\363Q\236\r\340\324R\331"
+	.ascii	"\356\304\266\226^\306j\275\353\006\002\261\004\224b\311;[\031"
+	.ascii	"4\246z\byS\3131\371\034b\224\333\025:]\034\274\026%\020\324\326"
+	.ascii	" \221\307\264\245\374\351G\\\356\251E\212#\300\221\276Fh\007"
+	.ascii	"\333Q"
+	.string	"Jv\307\362\307\033vJ9\246L\204\030\013\3059\252\270\324\230\251\2714\270\374GV\275\204\314\304\265\276\240\326D\007\233;\225\326\223\202S\"\215*1\210\344F\245#V\004\b\222\340\226<\340\037\241\332|\n\2336x\347\247"
+	.string	",\"\0319r\254<\304\022\370\3056\354\265\341\234\250g\300\237;S\022\276Rq\252Y\255\341\242\0219D\203\215\362.q7\356\017Q\261o\305\232\260\224G\325\254\037\300\204\341J\3254\243o\f\273:\261\262\250Q\216}\264\200?;\234\024\373\323\\\021\031\350\306\231t\314\246#*\223>\204\267H\327\273C\005\007\345Y\226\013fx\037\004pq\"\326q\023\333\021\t\275\036D\351\342Yh\256y\016\357W"
+	.ascii	"\327\030D0\266\274&\307\222\231\223\022\333\354\033\017\210\354"
+	.ascii	"\300\322V`p\323\3208\354\027\340\013\357\373f\274C\356"
+	.string	"+By\256\344Vb\350\335 D\202\276db/\236\266\264e(\240\261\306G!\354,\021\032u\t\303\327\226\366\006\016\230Ft\032\tz\035\367=\341f\326\"\320\373&;\220\360\276O\330\2127^\3123E! \037\3470\263w\310\313*\350kj\367&{E*j\276\216\020z\334p?\331\300\225~\205\353\0013\317f\220Y\321\264~\377T\257\330u\204(\254\337j\023'\214\034\306\364=\347q7\376\225\032\320\0228\">N\333\013B\262\013\031v\253\366v\2001x\206\317\262\273\345\274r\263[o\370\313\317\336\231\034g>]\343\266\311P\271h6\225A\301\246\227\307*\340J5n:iz\235\347\201\356Tn\312nV\361sJ\3634n\253>\355\363(\021K^|h\335\371\332\brAm\310\302\216\b\372\035\r\376\357\036\336V\201f\246\236q\270Z\3137\001Mu-\360\205\271\236\037+\003\023B\313"
+	.ascii	"!K\222\017l\314\230M9\2657X\232u\320/\266\345?\304\365\204&\206"
+	.ascii	"\206\236\321\025p\334\203\361\026\026z\213\271\226\345\342\235"
+	.ascii	"C+\343s\032\005\212\\\307\324<3\274+IHb\341\030\315\013WqO\233"
+	.ascii	"\206\345\330k\357\256\271@\252%O\273\f\322nU\372\367\300\017"
+	.ascii	"\260\272\351\244oc\307\032\307\362\257Rv\311\274y\3475S0\371"
+	.ascii	"\245\024Lu\362\3716H\254\347\344Vs\234\254\033\354*\226\2052"
+	.ascii	"\347\036"
+	.string	"\326-\234\303B\f^\030\217r\326k=\253\3703\223#\226\004\324\0026X\002\352\240\240\263P \367q\333\226(\364\315;\347\247\334%\266\210%\215\202Q\022\227)\227\367!{V8\224e\377\354\263\366\356q\351\206\020q\340\263l\bD\377\232\227$\004p\222\2732\214\340k\372_\226\033\320Vs\023\313w,\216\200\225e\001GDd\032\362\230\316j\035\241\2465u\025\312\222\020\321G(\305\235\342\"\203\246tw\375\036\370\r-c\345\007\241\022\2751 \025\374\235Z\001Z5\221\311\021\214m\344Ac6]\006\020\207\334\343\216\301\250\004,\017f\310\366H\373\034\347\344)\352\203'\036\240\274\031\\4\017Y\350\020\352\375{\316J5\211\267\220\231\272\277\356\267\267\231!\302\342\223\372\021\336\245\361\212*\364\202\345\316\340C`nq;\266\230\336N\031\030\357=\020\216\306\317\033\030\002m\225\322\344\202,9\2749\271"
+	.string	"#\261\027\032\307?\274\036\236c\272]\301 \220?\002"
+	.string	"\233\325\250\242C\017^\312\017\251\375\261$\234\270\231{[e5\232"
+	.ascii	"v\277\273\215\225\275\316\232\034\240b\343T\376\362\307\234w"
+	.ascii	"N?\221\347\342\031\333\367\254\2305XPt\344\353>@\374c\231<\204"
+	.ascii	"X\314a\225(\355Y\023\235\203S\177\321\247n\232^np\0340\022\366"
+	.ascii	"\252\231\273!\242\247\2023\037U\300\215\276\025,\311oE\351,\224"
+	.ascii	"\311\024'\217\367;\252\262 \217\270\3331\351n>\237\351\236\177"
+	.ascii	"\263\346\331W[\034\270\004\357k\\\234\324\334\325\331W\210*\200"
+	.ascii	"\241\235w1\346\302\207\035|\374\026\024\201\242\316\341\221\225"
+	.ascii	"\274<Q\025\257\271\212\221Xba\303N\377y\016\257a\035\022'\345"
+	.ascii	"o\f$h\364r\260\313\027\357D\022\034u\362V<a\262\366\345[\361"
+	.ascii	"\227\343\262\351\204\273.?\341L\241\224pxa\251a\206\226\251g"
+	.ascii	"\3448\306C\032\353$\300\255\241\333\213\357\325_\270\206\251"
+	.ascii	"\022\343\316{V;\006\330R^\203\341<\264t\n\227#\240n\272_@\254"
+	.ascii	"!\006)\3218k^\tg\202bT0\tu\270\347\331\204\321\234\311\312\240"
+	.ascii	"4\214\375\374w\3763\250\207\321\256\306\177\331\360&hvr\254w"
+	.ascii	"\264\275\023}\251L\245d\245?6\021)\250I\232\205\230\346\2117"
+	.ascii	"$\241oH\261| `'\360\"m\352\223\305\365\351\335\275\254\t!\273"
+	.ascii	"\024\335D\317|``\330np\026^\234\216\334aN \210\245%\364\341\223"
+	.ascii	"v\310r\365y\326\344N~e\322\022\305Wj\232\333(\2454\225\037\225"
+	.ascii	"!(\327d\\hDqo\345W\206\336\311I\307k\241Pv#\207\364\213\333\024"
+	.ascii	"\n)\366\276MR\203\202 \342\244\352\025"
+	.text
+	.section	.gnu.lto_readSimplifiedPids.200.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`r\002\235\016"
+	.string	"V\333^B"
+	.string	"u\223\016*\035%\247\360\f\214\036\202\006q\242\207~\232O"
+	.string	"D\354\b\371\377^n`:\0052j\215I\256Zh)J\204m\336\326\035\342\377\326\247\002\346\020\252\226 \344\311\2154j\322\310&I\246\024L"
+	.string	"C"
+	.string	"N"
+	.string	"\002\362\205\305\246\031[\247\260\n\223eZ|\222\231\332!#\263S\320\003\231_;\243`~\231\007`~5\265CR>\344\211A\214\t\0204H2S{\t\233\214\246\332+\314\331P'\343\306Af\0267\224\b\367nk\240\355\202\366'\001\034\320\233\377f8\034\254\227\237\332\356\204'\321\372\312\314\354S\255el"
+	.string	"\356\354\316\261\234c\263c7\307b\307\276c\257c\177,\036\353\002\bZA`\214\202Gf\210\032%\311z4Tm\335i\213]\207\224\357\005w\004{\353q\r\037\330\257\026W\344\275\375x\306#r\275\255\340\030\327\352\372\005\204\343\361\267 \303\020\362\277$\334\n\337Z\260\213\207\307f8\035~\0332\215(\313\314\006u\013\226\f\001~\234h\301\374.#[\313\005k\212a\347\355\206\036R\351\237\013 \n\"\322\003\026\320\310\244\036\225Q)\244a"
+	.string	"\255\2044\017\251\244\251\240T4\372\2204\r\"\021I\353t\351+\237\252\211*\206\345r\017\250\202!"
+	.ascii	"!\002zk\002\325\b\316[\t^=\033\234\277\036*T\366v\202sd5\233"
+	.ascii	"\267+\276\261d\363)  \203\221\331\266\001\1771d\342i\310h\\\020"
+	.ascii	"o\316}\323\t\004\333)\030\032\237\205`\250\016\344b\205\375\261"
+	.ascii	"\023\026\326\307L(,\305,A0hl\226\202\371\256Y@0\236\276\356\205"
+	.ascii	"\200\315\376\336[U[O\271\260\261\216\267D\032\021\240Q\300//"
+	.ascii	"ZF\006"
+	.text
+	.section	.gnu.lto_writeSimplifiedPids.201.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\356\002\345\017"
+	.string	"\306\234dD"
+	.string	"\221(\035\363\002G>\032K \006n<\031>\273\231\244%J\323\020\237\374\257+n\024\022\034J\327#\001\036\265\236\213\262X\037\230?V\340\377\277\244\305\230\226\347\033:5\202\267\377m\237\304H#dK\231RP"
+	.string	"E"
+	.string	"T"
+	.string	"\3160\203\307gMTB|O\373)/\241z\214\344\240]\327\313\312n\370\341\002\3345\207\027m\327\270\003\330\256Ye\303x\260v\205"
+	.string	"D\213\023\0246v\367\323\021W=U\376M\\\323BY=3\nv\327\331B\361p\353m\023\260}\300\326\r\001\273ku\331\017\177\321c\177\200\230\016i\032\024\323\037M{b\272\243iNLo4\355\305t\247iMLs\232\316\304\364\246i-\246\243\2465\246S\323\037`\340\206\313\207\247\304\354r\210\301\2612\315\305\313\366=;\272\t\371\013o\326i\264\033}E\003\003\3432\312\221\316\"3\3334\335(\\\205\366\002\213\252\261\364\024:\3532U\244\266\t\314\267,\200\245+_S?Nr\370\302O\244\270]\223\004\276J\003\f\034\t\222\355\332\365\035V\270\300b%\031c\207\253T\021\366\343\006#)\021%U(M"
+	.string	"Q\013DJ\247\316#\220S\312\364Y(\205\230\276\021*\365\201\210\f\236H\250o\004\004Q\237\027\356\343\252\313\335\253EV\242\032\334\221o9KG\372\f6\007\017\362%C\306\322\225\273\f\2014\004\341,\240\032\260\217G?\021\036\303C\243\303\321\216\204\303\340\314\330x\001: p\2034M\007\2571\344\307#\224\242E\240\312w\273\344\305)V\017\215m\344\0250c\220\333\334\224p\t\206\334\315\245\fG\260\310mn\312\275\031C\356\346R\f\230\261\310mn\312\275\031C\356\346R\f\230\261\310\305\346\212\024\272\353\322\332\320\254"
+	.ascii	"\b\031\"o\207\200;F\264\016]\330\r\013\260\241A//\332O\006"
+	.text
+	.section	.gnu.lto_readSimplifiedDtermFilters.202.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\273\001-\r"
+	.string	"f\030WA"
+	.string	"u\232\016\360Vr\250\037\031\bS\247t\302'\250\303\b\313-\364\034\030\354\200\234a\365\305D\2150hT+I\022\232a\3315J \006\375[\237\n\314!i\322\320\310\231`b\247\331\275\267\224)\005C"
+	.string	">"
+	.string	"G"
+	.ascii	"\237\201\375E\345\004vC1>v\273\005F \035\272\373I<\224^ \036"
+	.ascii	"\032\263c8#6k\240\"\t\t\230#\273;\351\213cO\314\177\215\003\320"
+	.ascii	"Z\262\247\346\301\356:\265\026\023\267\336\366\001\333\f\354"
+	.ascii	"\244\020\232\331]\226\332\302\376\333\335\265\206\354\277\374"
+	.ascii	"\233w\277\364\322\361\245\341K\277\227VM\247\246\317I\340\302"
+	.ascii	"\005\305i\f\331-1Z\262\"\bd\263}\023\333\331\205\340\fX\226\033"
+	.ascii	"+\246\247}\031\001Om\013\357\361F\252\366\205\357HyF\002x4\344"
+	.ascii	"5Uhc\233I\265\251\347\210DR\243\314\246\344js8\314G\332]\007"
+	.ascii	">\216\r\225\200\".*\361\020\362\320dVrdMJj_ \362\332\025\n\331"
+	.ascii	"\220\210X\002\035\353RO\007*CeA\300@\2016\356\240\200\256\317"
+	.ascii	"\344\201J\371L\035\353\232PN\\\201<\326\364\241\252\254\311\244"
+	.ascii	"\333\277\325\2207\\\f\321\212\212H\016\206\201\b\022\362\232"
+	.ascii	"\025p,\242\332\023\036$\246\200jW\370\217\031\250P\007w\"!  "
+	.ascii	"\203\021\332v\377\030\302xo\033\r\017\342\355\034\215\234\350"
+	.ascii	"\332N\301\324]\214\260>fB\302Z\314\022\004\236\32007\251\335"
+	.ascii	"<\215}\026\202\t\313;n=$<\342\032\306:\336\022iD@D\001\277\274"
+	.ascii	"h\007\031"
+	.text
+	.section	.gnu.lto_writeSimplifiedDtermFilters.203.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\020\002E\016"
+	.string	"\026\232\\C\020\221\223\016\237\342\200|\021\240@\374\375\334\363\303/\251.\205\220\2316\261\306\244\271;\202q\302\177\322\377\006\260\256Q\251\322g\031\262\330\006\026"
+	.string	"(\202\212\217\017\355!\024\204\200\215M#\204\020B\366\2262\245F"
+	.string	"B"
+	.string	"N"
+	.string	"\334\323\276\211\237\030\035e\362\315\256\211\007\314\356\027\342\002\327\243\277\203T\217\327\005T\217\036\33156\322z\b>\200HQ\241cw9\025\361\321s\344\037\305\261\222\212\367\264\024\354\256\263\244\262r\353m\023\260}\300N\226>\334\335\265\232\354\177\377\307Q?"
+	.ascii	"\230\326\304\264\006\323YLc0}\305\264\005\323ULG\230\206\232"
+	.ascii	"V\230NM\1773P\202\206\207\263\260\261\313af\307\246\"\f\026\333"
+	.ascii	"\327l\347\247a\013\260(.#\002\330\214\313\322+\302]X2\233\254"
+	.ascii	"$\214D\2558o\321\211\372\225\027\031'\250\n+|\205\312h\231\372"
+	.ascii	"\241\266\205O\276\344\001$\365|M\rI\351\341\356)2\\\273(\t|\227"
+	.ascii	"\t\242\213\204I\365x}\207\227\027'\324I\316\330\237\227\032\302"
+	.ascii	"\001%\"\022\355\\\360P\350B\013H<\240\314\034\021\220\350\303"
+	.ascii	"a\360\214|8NH\304\211\200\270\003uB\\I\327\2058\355\333\303U"
+	.ascii	"\223\263\226\034\251\023\335\340-\037s\034[\372\f\252\006\016"
+	.ascii	"\262\345F\212\244\2367\251\321T\363\3401\264\230S\206i\006\341"
+	.ascii	"0\001+ @\203\321\266\r\3171$\342\371J\264\ft\371\356.\267x\354"
+	.ascii	"\352\321\260\315\274\002f,r6'%\\\202A\316\346R\336\325\006\201"
+	.ascii	"\313\270\021\336d\027\215\333\246\220\347\307\\\272a\r\005\340"
+	.ascii	")D\022\t\001\364\214h\035\272\260\017\013\370\320P\227\027\255"
+	.ascii	"&\003"
+	.text
+	.section	.gnu.lto_readSimplifiedGyroFilters.204.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\273\001\035\r"
+	.string	"\246\030WB\020s\223\016\3302\013\312\033\220\0051$H\352 \246\303\237\006\352\301\345\301\006\020\202\343@\021VDP\322\207\021\t$\t-\373\215\023m\002"
+	.string	"\020\005p\322\340sp\300\005\212\361\1777$m\357-eJ\001C"
+	.string	">"
+	.string	"E"
+	.string	".\376\";\251\344\003vG-6v;\005>@\035\272\273&\036R'\020\017\235\331<6\037Vc\200B\002Q\372\261\273\225\252x\366\314\374\303x\310&\322\236\027\007\273\353\334D\"n\275m\003\266\027\3309!\246\023\325\354NKMa\377\355\356ZG\366I?\346\335O\275t|i\370\322\357\245U\323\251\351o\020\250\244\220\370\312i7\304)\310\232 \313\n\333\317\330\316\256\303F\300\236\310@\251\236\366\003jWx\215gB\325\266\360\225\316k\001 \362\311o\252\017\bW\"\325\006\235F\314\221\032wp#\256v\206\227B\324\3566\360g`\260\002\350H9\364K\342!,m=L\362\344KRjc\033\362\333\025\262p\242\236\013\323\017\350\302\210\365\300\2728|0\366pH\260P5\002\352\204*\317\205U\034\215-\022\221\253\322`YW\225\351\366oud\f\327\302d\242\036\222cQ"
+	.ascii	"B\204\374\346\004\234JT[\302qD\024Pm\n\277\341\003*\214\301\235"
+	.ascii	"x\001  0\203\021\332t_1d\361\336$\032\036\304\3339\0329\321\265"
+	.ascii	"\035\301\250\263\030a\177l\302\302R\314\022\005\236\32007\265"
+	.ascii	"\335\034\215e\026B\023&9\t\0051\217h\035Z\341\030\026\200\241"
+	.ascii	"\241./\332A\006"
+	.text
+	.section	.gnu.lto_writeSimplifiedGyroFilters.205.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\020\002%\016"
+	.string	"\366\231[C\020\221\223\016#\224\365`\214p\005\302+\200@\273Q\321]Jj`}8 \n\314\335\305\220\357\021\351\377G\260\326'\251h\177,XlC"
+	.string	""
+	.string	"\t\310\033\224\217\322*"
+	.string	"\204\200\215o#\204\020B\366\2262\245E"
+	.string	"A"
+	.string	"K"
+	.string	"O\373#N\"t\223\3117\273$\024\314\356\347\341\002\327\243\277wT\217\327\005T\217\016\33136\321z\b<\304HAqcw9\005\361\3203\344\337\304\261\221\212\367\264\024\354\256s\244\262r\353m\023\260}\300N\226pw\327J\262\377\375\232\233~"
+	.ascii	"0\235\211i\r\246\263\230\306`\372\212i\013\246\253\230\2160\r"
+	.ascii	"5\2550\235\232\376f\240\204\214\016g\321bwC\n\265\247\350\202"
+	.ascii	"\305\3665\333\371e\330\002,\212K\b.\226^\021\276\302\212\331"
+	.ascii	"d%\001$j\305\271\212\220\250_y\251Q\202\252\260\363\024\032\243"
+	.ascii	"e\252Fm\013\236\374\310\003D\352\371\232\352\221\222\303\335"
+	.ascii	"O\\\270vQ\022\370.\023@\227\b\223\352\361z\016/4J\246\223L\331"
+	.ascii	"\237\227\372\301~% \n\332\021\2510\322-\350>\030:\2319\037$ "
+	.ascii	"\0177\"\002\342\3418\037\020\367\321\341\216$\344\303\225t\335"
+	.ascii	"\207\323\276\275\222\234\265\244N'\252\301[\036\306Q[\372\f\252"
+	.ascii	"\006\016\262\005\307I\244\2367\231\3214\363\340/4T)\3034\203"
+	.ascii	"p\030\314\306\025+ @\203\321\266\r\3171$B\353\226q\031\350\362"
+	.ascii	"\335]n\361\330\325\243a\233y\005\314X\344lNJ\270\004\203\234"
+	.ascii	"\315\245\274\253\r\002\227q#\274\311.\032\267M!\317\217\271t"
+	.ascii	"\303\032\n\300S\210$\022\002\350\031\321:ta\037\026\360\241\241"
+	.ascii	"./ZM\006"
+	.text
+	.section	.gnu.lto_writePidfs.206.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\031\003\205\023"
+	.string	"\026$|E\340\322\030:\322\3568\220\276\023Y3W\312NJ0\343\026Z\035\013\006\210\362\234\006\244\r$\252;6~\375\324\016\b\032\334\304\217\177_'\232FE\220\241\032G\366\227\301o\243\f\242\027`\323\230\250\265{K\231Rf"
+	.string	"^"
+	.string	"l"
+	.ascii	"Wa\273\316\345\001vo\204\206vw-\033H=zw\326\3511u\001\247G\333"
+	.ascii	"\354\035\005b\366\246\300\006'\303\353\261\273/\035a=\334\335"
+	.ascii	"0m\217P\323\346\243N|\016u\214\216p\271\333#\004\260\273!\271"
+	.ascii	"\030x gr0\tM\324\\\017\364\250\343K\302\345j\236\250\223\335"
+	.ascii	"u\342r4\367\351\266[l'\260\025\026\336\335\362\25376\353\273"
+	.ascii	"_\344\272?\344\274{\005\323\252\230\006\201\351\224\246Q0}\322"
+	.ascii	"t\204i\250i\205\351\324\364\007\220\344\320Q"
+	.string	"s\337\321n\210&\037\213\024\211J\234w\373+| \257\374\237\263\260\235\347\242/\315\376\303\317\006\004\217\335-y4\202\324\343\b\374\312v\35680\275\236\366S\004\277\024JSF+-[\302}\023P\372\235^P\017\321)\352\211\302\213h\314\210?\250\nQ>$CH\365<\275\026=\272\220L\025Q\033v!\217\363H\214\336|M}O\346\307K6\331\216=\306\212+\3076\206\303\220\231(\355.\203G{\366\027\033R\273\273\300E\205\032I\016\t\227\323\343\225\247\007\364\323\275d\223\352\356\336Tq\034\261\267\324T\024\226!faFk\240\022cQ9\305\305R\223\2754\304Pd\257\024Z\355\345by\306\002\243\275Zf3\332k\265\333\177\365\306\347\307\355\234@zQ\230\2508F\325P\226\352R\226|\2453\255\257\364\272\237\245\016\311t\270\273\013m\362\225\262TD\307\227\344A\004L6\231@\252\034<"
+	.ascii	"Q\025\204\343\210\340R\272!k\345\330P\002\321\243\350\005\005"
+	.ascii	"= \360\202\221\232\211\007\257\030\362x'$\264`\031}\216\335e"
+	.ascii	"\251%[!`c\032\256\007S\026\262\035\222u\333eB\216\241l\337 \321"
+	.ascii	"\026\237\017\fr\030.'\217\243\354\025\331\005\215\306\344N\017"
+	.ascii	"F\242\306\213\005\261\0378\036\017\254\205\210\177\224C\306\201"
+	.ascii	"!\327\\\303\341&\0325rf\024\223\200\021k2\241\\\313\325\n]\306"
+	.ascii	"#\002\214\022\356E\f\021\330\220ko\327\200@\224M\227\177\002"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.207.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\3162\375\332"
+	.ascii	"ZZ1MM \206Y+\303\001\033\267\364\354\300\263G\3410@\024A2s\232"
+	.ascii	"\001\340(p\250\026\250\336\345\024\t\200\374\300\264;j\327\226"
+	.ascii	"\303\f\321\305\f\335\005{>\316\355\361\206P1\024)34\343Ra\013"
+	.ascii	"\351\002<Ef\243\301.\211\204l)\223\f\333\004E\004\334\004?P|"
+	.ascii	"\bUMY7l5\26212\030;Y\026\313Bc[\364Z\016\373b0)n\"\002\0068l"
+	.ascii	"l\370\2120\304\207\226L\226\273\366\207\271\024\331\326\274\220"
+	.ascii	"\265\274\265?\254\305J\244x\311\b>r\330\242\217t\230W\366\252"
+	.ascii	"\300\207\226\214\305I\220\024@]\311P\300\006\247%\016\363J\276"
+	.ascii	"rc\223{|\303\344\252e+~\376\360\222\262\215\251\2312\325\376"
+	.ascii	"\360\312\246\344\021\2209\231\304(\226h\206\371\302\376\340Q"
+	.ascii	"[B(\206)\271\227\356\317db\235\333y$\211\252\271\225*\250\314"
+	.ascii	"$\0318IH%\fh\223\202p\222o\314+\327#$sp_\346\270\360G\251\313"
+	.ascii	"\t\"\250E\005\346\225l\342C\313F\245\0249-\214\373\263O\274\242"
+	.ascii	"\324\027\207\250\353\331\252\342\316#\027\031\363J\237)\007\373"
+	.ascii	"\320\262\205\375\341\376\300iz\227\"\231[\023\303\375)\\@\022"
+	.ascii	"Vsk\327O\031\306\271\365k\315\276\315\t\367\307\315\222\272\212"
+	.ascii	"\255\255\250(\b\367E\t\223\315\022\t\252\271\225I\020\232\242"
+	.ascii	"\344\255\230W\376\314\001\217\346\203W\263?W\356\0022\244\236"
+	.ascii	"f\351\353\325j\244\013Y\326"
+	.string	"\343\272\316-\200)\270\200_\275\326'\201\222m=\256\353J$\220\b\t\252\r\353Z\345\306\267\256\\@\372\356'\365?\"Bk\341\212a\0052&\217\353\312\025\002\363\312\317\025}h\311\327\244\256bs\253\327O\031E2p\222\353:wt\345j\300\274r\237g\302\363\266\377\362L)\203[\327\365\007hWj\367gw\227f\236\352\2400@&\221\206r\314\353\244n\027U$\264Z\321\341\361\255\353\034\213\2051\307T\347\316\202\324\305\030a\241\325\352\251\206\304\274R\210\227\371q\nP\205V\253*Y|\353\272\262X\023\314+\337\016'\265S\026\034\251\362z\021\245\f\253Nr]W\027$\336ay\245\372\241\345\225\235\302\366\212OA,\221\252\252y\034\335\276\355\231N\247\323\253s\337\235cN}\375\266o\317,\337Fwo\3656o\361\326\314\226Y2\373\267wk\267u;f\351V\314\262\260s9\034\300\321"
+	.string	"\0037l\324\2401CF\f\030\013\274P\300E\013\026HG+T$\220\002\305\t\023\b\034P\202\304\b\003D\204"
+	.ascii	"a\364\241\210\310C\207\346\020\207\rB\032\202\2002\374`\360a"
+	.ascii	"\366,\225j\363\324\236\352\353\227d\to\337\0310>\265C\332\226"
+	.ascii	"\265\020f\3173u\005\240^\224\273\236\360F\233\205{fU\312\276"
+	.ascii	"zj\206C6(!\314\236d*\214'y\207,\026\2057\017\217\305\376\261"
+	.ascii	"\3000X\300\314\252\214}\315\2503\272\366\276\2040{\226\251>\216"
+	.ascii	"kd8\f\no\031\264/\031)\337?\025\204\233\335\024\017fO\025T\023"
+	.ascii	"vn\204\274uu\314\354)\306{\267v!\314\236Lxk\213\267\316\203["
+	.ascii	"\030\230Y\225\264\357\230\246Y\025%_\272\020fO%\234D\213W\314"
+	.ascii	"\223)/\013O\230\352j\230\3313\t\357\234\nVX\005\311s\004\005"
+	.ascii	"\262\305\201\231UAr\007&\217c\222\251\362p\003GL\036\341\334"
+	.ascii	"\030\300\363\033x\356\260\r<R\256!y\032\352\t\267;\201/\344\222"
+	.ascii	"T\215\354\216\244\375\005\027x\006\023\316\332\233\034\031\215"
+	.ascii	"\217\021\247\221a\304a\344\005\342,\362\2138\212\254@\"\273x"
+	.ascii	"U\342[\264q\303,\332\260a\2446\221k\370H\025R\243*`\206W\364"
+	.ascii	"<p\305+\315U\f>\201AN\021e\024{|B\217M\250+\312\326\200u\330"
+	.ascii	"\302\225\307\b\024r\t\252$\266p\341\361\001\322\353@\233LL\363"
+	.ascii	"\022lH\344\215\220\362\266f\200\317\035>87\021q\310\300IC\250"
+	.ascii	"=G\230`y!\027\234Z\343\316c\337\r\3010\210+^o72\274\0164\306"
+	.ascii	"\271\267\177\330\302\245\002\027\251-\346\016\315\013\271\334"
+	.ascii	"\324\006\302|A\273\232/L\264\364\312r\017X\336A5*[\003"
+	.string	"\366B.,\352\2117U\342\234p\005n\2529\006\212\212|Y>Dv\016\252\003\177-\274y!\227\232z\265(R\256&\2157\224\020R\207\236\344\035\276\220\353\211\212t\310\006\345\2145Hy\020\220\232\303\357\215\340\013\271\244\250Heg\031\324\034i\207\211/\344\032SAx\"\366-\\d\374S\206\367\022[\270\2420\006\241*j\367QF\t\263\3064\363\022{\317\013\271\304\366\260xy\274W\200\226F\022Nj\346\365\344J\f]M\256\252+\036\317\330\t\352:\242v`\202%\353zg\255.+\356\027\262\320\034\313\310\221\211\013s\205\241\353y3.(K\325\316\327`\323\354\251\006\304=\017\254\353\272\234\325\345\365\005\341\273=1v\377b\367h\2047\366\362\334\342Z<\250\177\327\254wU\366\344)XP\253}`\310P\334\271P6\364w\037\"\352\272\232\345x\340\213\354\331\271=\212\341\351\256\"\226\0248"
+	.ascii	"\365\315\350\024\201\372j\316\301\f\030'o_\001\246kCC\247\252"
+	.ascii	"LAM$.\257Y@\332T\nA\211*hPt\203\230\025\006\302\013\235\030\241"
+	.ascii	"?-\277\330!\256L\276\241c\270x\304\031\324\246V q\244\251\366"
+	.ascii	"\2473\364\261&\007\177z\001=G\251X\025O\235\034\251\322\320\320"
+	.ascii	"\245e`\021\275\306/u\252xj\264\026\275\023\364\247\235\"\020"
+	.ascii	"\020\230#\033\235\242\343\225i\006\245%\206VZ9\252\371\364\261"
+	.ascii	"\300\330\247\217\325\247~i\331\323\314\306\200\266\006\021\013"
+	.ascii	"\356\311\323\355\351\345(\363-\355U\330\251,M\374\254\246\272"
+	.ascii	"\2549=\335}m]?\313vZ\366\027\275L\247\344\301\320\3207\032\274"
+	.ascii	"(\177>\3136,=\274\325O\321\251\265\247H\246\262yK\331\243\252"
+	.ascii	"\375=\310+\227C\270l\350r\037\375y_]\366T\366j\247\326\332E\301"
+	.ascii	"\337\233\3522\325\306\342l]\253\236\345\324\007s\233z\343g\355"
+	.ascii	"\027\275\250!\274j*U\331\320f\257\376P\2075Y\305\323-1%\007\001"
+	.ascii	"?\253\373r\246X5\3253L\365\360\324\206\356\321\2713\024\322-"
+	.ascii	"Z\361\2355\200\257\244w)\320\301\317\342\276\336\207\346x\031"
+	.ascii	"$\264j\252\345*\037\3522E\362\221\212\363\244X#\253\353\206\212"
+	.ascii	"Y\246K\302\226D\313:Eny\216\020\353\007\212$\334r\230C\237\304"
+	.ascii	"9\267e0|G~\264\036\341\276xYn\353r\243e\235\302\266\314\205+"
+	.ascii	"\214\026-\313k\353\310\001\242\330\231\254\260\214\345[RT\320"
+	.ascii	"\262NI[V\273\022)!\334\227\024\226\317\"\277hY\247XY\206\326"
+	.ascii	"\371\024\252(iZ\326\225\312\262\331:2\307\334\310\362\312\037"
+	.ascii	"\361Q3eU!ew\035\225\321:ec\353J\3652G\316ZU\\\371\254>\336\237"
+	.ascii	"\346\245\217I\331Z\306\223\273sOn\350\356{:\235\372m[\331\345"
+	.ascii	"/\257\255K/y3\377\027\257x\303\303\371~\r\340\237\337\331<\356"
+	.ascii	"\177\364n\276\317;\337\367e~w1\237{\034\\\223\367o\f\345{0m^"
+	.ascii	"x\354\373.F\274\347\202\205\257\276O\023\342\375\025\020\274"
+	.ascii	"\267bv*\374\374~\354d\376\203}\362{/\225\367\\\037x\277u\273"
+	.ascii	"\377J.\346\177\226\020\257\021\225\027\005\225\027\001*\357\t"
+	.ascii	"*o\324\362"
+	.string	"B\251\274O*\257\023;\371\232\300\\\337\"M\274~\231\216\347K\344\222\337\022\226^\370=\300\005\277C\204\030\361\006QyIPy\225\214x\201\250\274I@\274\006Py\177"
+	.string	"\361\022\240\311;\202\312;"
+	.string	"\225W\004 \336\020\232\274>T^\001\250\274\001Py\001\320\344\005A\345\375\240\311\333\303\210\327\003#\336\016\214xy\250\274\034\\\360\273\301\007\336\035E\274\032\250\274\031\250\274\030"
+	.string	"\361^"
+	.string	"\304kA\223W\207\312[A\021/\005E\274\023\024\361JP\304\033A\021/\004\207\374>P\304\233\243\210\327\001\"^\034E\274\r\024\3612P\304{\243\210\327F\021o\215\"^\032E\2743\212xe\024\361\306Pya\024\361.P\304\373\242\311\253@\223\327E\223\267E\223\227E\223\027\251\311{\324\344]A\304\253\242\311\233"
+	.string	"\021o\n\"^\024D\274'\210xM\020\361\"\300\344=@\345-\321\344%\341\201w\004\223\327"
+	.string	"&\257\210\016\274!\232\274 \230\274FL\336\017*o\021#\371\022\251\274\036<\360v`\3626\231\274C\035x90y70y\205\230\274\032T\336 \225\027H\345\315\320\344\375\001\342\305"
+	.ascii	"\304\353\003\304\313l\362\366\250\274\313&\257R\345U\233\274"
+	.ascii	"\255\362\362\323|\317QB\030CgX\027EJ#\316\255L\246/\254\204\312"
+	.ascii	"\276,<v\206rvrnr\346:/9_\235\221\234\237\377\344y\375\361\374"
+	.ascii	"\222?\235\037\362\267\363\313\371\343\374\213?\234\277\360g\363"
+	.ascii	"\273\371\371\376\277?\360\027\374\323<\304\356\311\324\225\314"
+	.ascii	"Z\325\345B\255,\021N\362\311r\224\r?\233\300\257-\027H?\301\201"
+	.ascii	"n\240\203\314VP\263\234oV\316F\007\332GE\202Cl\205G6\320N\301"
+	.ascii	"?\267B\270\023\334\024h(\003}\243it\031c\230E\255R\251\030\310"
+	.ascii	"rC\265\353\232\2728\212F\307\267\026m\305F\327\350\036\3001r"
+	.ascii	"k=\231\307F\337\016m\255F;\005\363T\273B-\026\r]\032=\243i4\031"
+	.ascii	"\223\205\255\357Hi\260\315P'\005\355\016\264\245*\013\222\272"
+	.ascii	"b\251\037h-\031\035\243\201\016\333\332\216\263\013s]\255f@\006"
+	.ascii	"Y\031\375\272\266\327q\276\305h\247`\2354\316G\235\302/B\253"
+	.ascii	"G:\017\302Cr\247\005\345\210a<\3200t\240M\217\032\272>iT\\\332"
+	.ascii	"D_y\332\2248z\t\255u\351}\336Hq\304\212\252\270\244\017T\n#V"
+	.ascii	"\264\304\257\264\\j-\026/\241{\352L\333\350\026O6\306N\223\025"
+	.ascii	"\t\034\375{_S,)\220"
+	.string	"\036\325Z%\364\245=\2046\351\302UYT_\262\203\222LF\262\212\206\036RNZc\002me\201~\301\030\307\371\306\270\270\200[':\337\020_\344\351\205s\025M\241@\273@\204\263\364\274\263n\301)\247@?\017\255\257p\ti\327\031\346\221N9\027\375-\321<n}\214\006e\022E\213faH\350\246M\013\026z\215\032\026\322\345\342\027\327\t\244>j\030c\246r\203\202h\220\350\032\360\357\350\005\267\270\246\326\323\316DCwE'\320>`\323\267\276\245\347%\236q\336\375\356\254\371\234xL\025\234\215\037\263\242\237\247\030\267\247\242?FQ\314Y\327yK,\316\326y\245\361\234w)j\224y\244\023\357D\002}.\321H)\003I\342\234!\340\367\245\276\364\b\214\2450\311\002\035\303\305\265\363%\310w\200\344#\001\t\255\264\330\261K\321\217\254\323EN\216\260D\0209\026 \235\311y\361\301Q\347\031."
+	.string	"\240\3639N:\200N4la\346|\2032y\356\264\240d\371>@\342Q\fR\242\034\330\240\234\227\343\033\325\310umy\0346\024\375F7\322-qx\bG\fY\334\301\306\3118\207\007\277q\032>\356x\2343:\021\231NE'c\234\033\302\264).\316F\026\211\373\016\026\337\200ZP\252xzv\242\317x\245\227(\032\025\316~\220\006Xp\275\276\342\244\303C_{e\262\300\265\225\206\006\331u\312q\322q\322Y:!\235\221q|&\244SL4\007\321A\261\b\020\350]g\036\347t{\254\311:\240\232z\362\263\246\236\313+\021\350\033\321\250\233X\025\332\217w\f~t\346\244\217\"\376\003Z,\220!\303\232P\2308@\305\037\344\013ea\342B4t\177\300\030\335\260\225\213\037\216~\200\326:@\227h\t\332\360W\227\350\316\3636wc\bA \375"
+	.ascii	"}\303\276\341\225^\366\326<\021\355\312H,\300n\251C\326\234\021"
+	.ascii	"M\242\033\016\326\244\001-\242G\364\022\362\312\313\213\177M"
+	.ascii	"\033\320EzW\\\236<\375\212\032q\026\343LD\217\370B\303\207\210"
+	.ascii	"(\r\321\220Ys@t\b\020\255\212\001\023Ix\304G?bkE5S@\022\036i"
+	.ascii	"*\304F\022\205\342\214\306\331\327\364\017\337,\004C\247\333"
+	.ascii	"\246\200,\030\025\t\351U\211\2044\177\265\326n\f\376\320F\375"
+	.ascii	"5}$*\310D\223\256B2j\037)\2756\005\311\370\3207\366\320H\343"
+	.ascii	"\252\312\364d\023\263\251l\001\362KY\230\017C\372gL\035F\272"
+	.ascii	"6V|\347\177}\201uE\r]0\2773\216C\277\353U=l\320CZ\313\357\f\226"
+	.ascii	"!F\363U=\274\205\264VQ\363\034\272\305\242\207}\371M\3719\021"
+	.ascii	"n\213\224\250\303\377\332\304\027`Y\363\177\275Ak\235\360\034"
+	.ascii	":\034\260Wm\n\351\337CC\361\\H\037\2605$Yt\3630v\002\217t\370"
+	.ascii	"_+\307@\252\321\271\361\320C\372\177\375+-O\277\366\320\034\222"
+	.ascii	",F\261&\277\264|_\337\257\203\222,\336]\225u\350\367u\353aM6"
+	.ascii	"{\250;t\017\233+/O\236\336ib2\233\3751hq8\370oX2\352\304\f\254"
+	.ascii	"\251$\374\254\241>\341\347\367(}\274\301\254\346\177s\3007G3"
+	.ascii	"\265\204\371(\223\251.6\003&\f!VS-\207\257\2431\022\"k\316\363"
+	.ascii	"\232Ck(\243\350\002\326\244Po\350\277a9QM\300)*(\316\034[lh\237"
+	.string	"\270*\236\306ij&\006NQ\241!\324\036\354\355\271\305=\257O\370f\037\2306f\241\016]\232f\023Vlb\"%\276L\017`/O\032\2035\264\206\376\032F\214\312\332\235zr4STFLE\231\"\273j*)\334B\323\214eC\251\303)*2\316\242\226Wj\350+\244E\223\223\221 .\236\234\232\236\230\224\236\214~\024\200\211\374p\n\322\004\3654D\bP\022ST\005KIJB\222|\232H`bB-\201\\\260\364\364\343\003(\024\224\2300(QP\002\3024D\t\305\024\325$\001\024\223\322\tJ\030\222\242\236z\240J\210zRrZ\006\031B\002S\223\004MNFt(\2250\204\204&'\036@\206\360(BD\t*\310\t\212\207R\002\206<\365\f9\217\036;\020\240\304\264TJ\300\220\036E\236\210\364<\361\350\261\003\205\037Dz\2020\rQ\362\340I\t\312\210\001\202\230.`BEq"
+	.ascii	"\245\264\224\364\243\210\217\023\024\017\250\250\"L\027@)=)9"
+	.ascii	"\0011U\360\364\244\224\324\344\304\003\352\251\211G\221'\"BP"
+	.ascii	"O@:\311\351\251y\364\330\001\204H\3222\351Ii\202$\247\247\236"
+	.ascii	"MjQ\344\211\210\013\246!?\210\270Hrzr\321\242\3036\025Qrr\001"
+	.ascii	"\325\324\344\344\342g\256\352\352\332V\266\031&\347\310\316O"
+	.ascii	"-M\350\202\004+\352\363O-\217w\2377Q\242XQ\240\251O-\241\240"
+	.ascii	"\232\373\271\\\246\366h\350\272\bt+\353\340b\232(\254mo\002#"
+	.ascii	"\335"
+	.string	"\324ZC\216tl\330x\320\320-\300\262\251/&"
+	.ascii	"\214cQ\261\016x\353\033\336\360h\350\276H\333\340s\335\223\366"
+	.ascii	"\301\321\213p\221n,\235\202\026U\027"
+	.string	"\016\212\364\347\232\273^\001\330\240\243\bM~\336 \b]\220VF\277\224\221\305U\221\300\245I\370X[\237\213\212\346\357\322ok\034u\034\346\343u\2724\223]m\003\214r)\013\023\267\243\241\013\004%\203\307\265O\032\006G7\241\265T\023\232\035\351\026?\250F\345\202\006&\364\343\332H\255\f\315\225\222\227V\3522:8w\223p}/\275\234\300\362`\372p\235\343\t\307\256\316\223\247cj\240\017\326K\224\272\3430\2512\237\236\035Ls\224\353\3602\b)\355[\301\205(Z\0314t\027\b\036\2079\261\200\264\217:\203q\307\022v\f\210|\204G\216%\311J'M\261&\233\372Vz9k\316\321\333a\013\030\030\240_\370\204\331\t\207IE\177\364\031)?~\226\001\272H\377h\016\373\006jd\221Ys\240$\361\002\274\240\241\033\302`\243\333\243\230\262\265\315\376V8\326fAC\227P9\272\371\240\255\020"
+	.string	"\220\267\224\b\320\013\030\214#\215\003cf\302[R\203\314&5Rl\314 \256\205\351P)hj\242\021x\311}\034\016\216 \225\266\344!\221\250Gh\016jc\210X\223C]jg\025\244\030"
+	.string	"\233\0014o\235\303\"\242\0239\n\"\330\027`\371\274\300\266=\t~\245\2154\021\273\bq\244\265\232\346p*B\b-B\237\213w\245\336H\205\220g\002\037\375+\375A\317G\237\216\004\002X\024@s\222\017\3359\224\306\035\272\211\300\347\013\270\f@\363!X"
+	.string	"\372o\254\006\322\313\026\b"
+	.string	"\303\330\342r\234J7\003\327\366\034@\241\231Z\313\253\231\232\017\351\326<69\213>\320P\246>\025\346\"\336\023"
+	.string	"\200\320"
+	.ascii	"\200\243\276\201\360A\217\376\240Y\017Q\375\"\245\330\243_6\030"
+	.ascii	"\225z\300\250v\361 \352\026W\325A\217)G\232\252Q\335\"\345\202"
+	.ascii	"\272&e'%\207\371cye\007}-\203{\322\270\252+f\202\224\212\034"
+	.ascii	"k\266\272\2079\207ndZ\320\312\312\321@\340\332\036\216s5\n\255"
+	.ascii	"\265(\034r!|\362\315\244\360H\345\241:\206\303-\204=\235>iy\257"
+	.ascii	"\276\331W\346\341\244r>\245\370wb-w\235I\234Z\374,\036\315\207"
+	.ascii	"Z8\370Vs\260\241\021kr\372\035\313\035\375-#L\234;\272\347\034"
+	.string	"J\331\023x\327\331\304\351\304\253\325\302\303(\204\317\246R\035\320\240\317\325\037\364\236\370J\24285\300\361\f:\303a\006\315T\0372s\370\204\205\3005.\351c\0037\272\361o\\S\304\212\332\270b\037\272\266\006+Z\203\375N\344\2101 \322\030t\217\032\0237\f yH\034b\334\212\314\n\253Bs)\347\022\264#Yg)w\b\347\306\005\375-t\213\212mA_\320\307\022[l\013:\001\202v\236\210w\177E\370\350\273N*\316*\212\335i\f\375l\210X\376\315\307\354\027\261\324\321\177\353e,\261'GU(K\320&\035\335\003iW\247,L\r\3035!\265%\\4*hSA\377\205s0c\350\204\277\024\346!\244\342<3b\034\375p\302\232\264\201\201t\004\264\026\035;\b\240#\243\241\274sO\270\030m\205\202\236\240m@\353\332RP\277(\350\353\245\360\310\t\332)\210\306\r\206\004\035A\367"
+	.ascii	"\326\261\241\251\\\022\364\365\320\036\031A;\005\003\245\013"
+	.ascii	"4t!\350\034m\343H]\0255u\t\004qj9\244/Z\034\005\204\031\250\363"
+	.ascii	"aD\341X((Q\247\224\241\031\"i\222\264\006s\025@PHH2\034\016\253"
+	.ascii	"\352\003\023@\022L\003\331\252t\2141T$3M\306\fp\207\313L@\025"
+	.ascii	"\206P\343:8\212\216h\327\270o\210(B\272\027\021\3259\013Eo<u"
+	.ascii	"\277p\356\364?\370\350\203\252\277\035\300\233 \306F\244|\200"
+	.ascii	"\007\261=H\344\336\333\344\246\215^\354X/\004$\303k\0309\354"
+	.ascii	"\016\327\300t\032\023\377\\\0041\r3,[\321\351\266\242#7*?\216"
+	.ascii	"s\304\276\3542^@\t\204\313l\352\207\026\340\025\372\256\377."
+	.ascii	"\020\202@\355\313\032/\300h\251\334cc\253\006\252\366EDT\314"
+	.ascii	",\234<\207m\325Q\024?\027\255d\276\ba\214E\317\232B\r~\031X\320"
+	.ascii	"\266\216\221\024\006\252\252\202t\360\321\356\252\357\037\250"
+	.ascii	"\206Z\267d0N\007\214\034\230GyN<\373\251\305\236\2373,#g,]\026"
+	.ascii	"\273L\374z\2368\t'\265P\251\311\302\037R\274\267\272\247\351"
+	.ascii	"m\022[\204\227\221\nO\355<x\341\0034\334O?H\332q\t\260\200\213"
+	.ascii	"\303o~\3422\232'\207J\331\026\366\201\237B\0201\201\351^\372"
+	.ascii	"\f^L\277\365\227>7\242;\324\224\013+G\"\357o\360\221Ru.\030\347"
+	.ascii	"\230E\241B\347N\341;0\013=\373;\277\233\nV\304\035]\b\251\023"
+	.ascii	"{\247\273Mql\237b\323\232\300i\216\257g\027D#DI\332\377m\232"
+	.ascii	"'\302F\305\252\005\275\251\240\020\316\n\025\240\261Z\\e )8\302"
+	.ascii	"\276\260\222~\230\2368\030\031]\036\223\003\234Uf\202w\354\001"
+	.ascii	"\312\266P\350\334\373u\007\201\272\025\316-7m\303\211\3429$\262"
+	.ascii	"b\233G\006\034RX\323D\344\023\351*>]\005\333\024\033}C\367\350"
+	.ascii	"\242&=I\205\276\332n\2151M\206\367s\001\035X\250\204#\254\233"
+	.ascii	"\233`+\240\221\240\252\221\332\356b[\2679f\265o\b9\343l\006\277"
+	.ascii	"gB$xF\354\024\030\273F\263\2458\332\342\347\"Kh\310\036?J\026"
+	.ascii	"\2573B\223\025\333\300\263\232\036\335~9\204\235\271\324\250"
+	.ascii	"B\212\2714\004\360M\243\311(\243\347\364\263\2251\344<\013\213"
+	.ascii	"n\374\312\251OJHg\242\304\325\223\345.V\234JLlcT\rOR\201D\004"
+	.ascii	"L[I9\366E1\223p\243 \234\246?\345\037\036\362ro\017\007B\337"
+	.ascii	"\3675#7W\353\303\3440\372\024leZ\371\007+\325\373\254D\203Nv"
+	.ascii	"\267\026o\027p6vH\310w\216\302\245\244\265\346s\b\032C\243\310"
+	.ascii	"\331Okv\327\357\f\314\231B\006=\200\207\237\366\370\234\034\234"
+	.ascii	"\274\237\341\324\307\267_\205\350\007\330!\300\322R%t\320a\363"
+	.ascii	"\37051H\2402x\003N\253\275\233\324\263\305\332cY\324w\247\003"
+	.ascii	"1\211\354z\302\345\026\256$\236^\250\013\205\312\352|\277\226"
+	.ascii	"\234RL+\322:\200='"
+	.string	"\343op\361b\326\031\345@\317\240\276#~DS\225\350\336\224\022\200\352\2728vU\035u!\225N\003;/\030\250\220\272\236\244-\345\334>\304\006.\333\b\266\316\367\260\333\223\331z`|\321I\022\002w<\177\231\336*\rk\270B\243gM\254+\252\333\211ej\252\256\322zk\211\226\373\t_\n[\345h\307\017\222B|>\253O\225\026|Tpj\335E\241\203\325\211\377\033\177\322\005(\244\320\212\207\232\232~(\271\222\243\311I\261\355\3351\003\376\221\035\027\240\375\\\361\234\304\007\2331\330\213\232%\032\336&\3514\302~\206\315!-&c\241\257\362d\322\214\372l\220z{\336\023gx0\317\364\320\333\322\365o\243\232\006\354\020^\212\317:\251*\215\375V\236\340\234P\265h\364\310`\177\200\256'fO4nUQ{\255\251\261\267\037\017aG\2367w\221\363\376\346B\253\267#\027\250u\243\311v\n\256"
+	.string	"\033\036\214\322\330"
+	.ascii	"j\264_\250D\"\305\336\327\335\372zw\327x+\371"
+	.ascii	"5\220l<(\243\n\303vA\317\310R\23043~\001\234\001B\264\365\276"
+	.ascii	"\276\225\326\212z\211\204-$\373\031\376$\364\240\254?\b#Dc\330"
+	.ascii	"^@g\341A\232\340-\354c\251\317"
+	.string	"\223g\355\253\305B\251\227\202\t\242\312\203\262\303\351\313w\326S\306\242\341t;\241%\222\245^@s\265\366\361\326\257yE=E/\253g*Fp\370\245\031g\263\177\026\016\002\362\226\345\237q\306\177\213\222n\030\274@\251\353\227\301N\267\2014\321',\366O\024\327\205@\036h\374\366\224\312\314\340K\036K\265\035\311:\312\235\230p\266\271\346\365\f.\3554\332\021\224\027\305\271\315\364\025\223\312\370g\205\017\247\277\346Zl;\347\322\264\202\213\231I~\267\220\\Z\307\300\031[\330\276A\310\\8d\022$5a\207B\265P\235\214\226NR\211\355i\364\003\212\357E\246D\325L\322\224M\377\225\3708\234\254Pl\207{\"!q\200-`\030\341.\306\033\225\241\302\001\250}\277G\t\207\276~\f\b\321&\303y\255\002FWq\203\f\220p{Bx\333\232u\217\222\344\302\b\374\030\3039\201\17742\221\221\025\240"
+	.string	"\365&$\301\224\022\356=\234\255\331\314\026\274'\233\370\236\033\200m|\322T\260n\262\224\001\307\303g\267"
+	.string	"\tYW\3460\003\324gTB753P0;i\020\251\256\335\345\210"
+	.string	"i\302\337E\371ZnO\253#\236u\312\017\307g\377\215\226\035\324Q\220\230f\023\260\235M\363\024\241\372T\321\300\005\261n\031\253j\\S\334<\177\323/\276F-\303\006)/G\262\270\323\346\372\320\342{R\317\261,\b\321\266\360\217U\320p\223\363\377k\324\317+p\023\2277jS\355\035\020\314\363\031\273\230\234\256\347\245vd\337\021r\245\203"
+	.string	"4O\317\350\216u^\252\037*;\020\303\267\035"
+	.string	"\277\304\362\260A\352'\326s\240:Y!\241F\026\316\177n\003\362\300H\025\241\201h\242\300\250SF[\254b1\260\211\356z\375\266Z\343\346|\264\245\024\242\235\"\342H\013\237\tO\266\260`2O\306\276h\027\317~M:\320i\344\365o@\303\003M>p\007\220k\353*\374\3504\273\262\002\200\314/\241b\303\016\251\353\311a\274\020\367\016n\317\r\271n\257\256W\353\226\335\351L\322\021\243\220\275\336\255\234>FuE\376\005\213\002\007\023\277\345x\016\375\217,qV&M\345\030^\274~\341\323"
+	.string	"G\311\232\231\335\264f\256\211\312\371{\311\321\266\031q\264E\303Y\257\210z\312\327D\350Y\362n\301p\303\221_\262B4W\b\206\317:\264\n[\202\241l\3065\\\tu\222\213i~\016\372w\024\246\203\363\tq,-\332\034\023>\255\033\310*\251\025o\224\254\234a\003\212\362\335\257\342\232\261\035\275\223"
+	.string	""
+	.string	"\270P\357R\374\250"
+	.string	"\232bm\236\273\366{\032<5\205J\013\204m\327\271\321\022E>,(\356\017\200\320^v\247\252\305s\334\312\351\2614T\225\333\356\344\373\257?\fk\276\231\356T\201\340\337\315\377q]\351\211\376\315\337\362\372\b\367\211N\367\0303\247\\\t\254\311a\230\214\036T\220\301\224!\343\027\245{1\246G\356e\345\252\345\352\254\321\226xJi3\342c%\353b"
+	.string	"2 u\217\251\264E^!\033\006--@\3353\301\221;f.j\243\002\035\250\037\002\334\277\343\241\235i\351\374s\035\373\001\r\270\362t\021<Hy\322#wQ\004N\303\223\\\303\003\331\3478\332\3474L\337C\303\323Cn\f\026\236i\023te)\271\206\267\332zK#\231\314Q;\201\224\245\234\354\201\261\b\022\261\303"
+	.ascii	"y\323\\\246Y\260AX\2722\356\273{o\263\"\273\210c\366\034$!h\227"
+	.ascii	"v\036'\312\230e\236\225\f\fm\234\350\002"
+	.text
+	.section	.gnu.lto_mspFcDataFlashReadCommand.208.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`,\003}\030"
+	.string	"6\257\245I\260XQ:\360 \244\007\361\351Z\317.\3005w\\\2605\266d9\351+[7\340\245qf\352\276\350X\241\350O\035\023\243=2\245\234ql} \3776X^:~\336V\220\302\201\301jX\210\372\013\311~\311\337\204H\231d\220"
+	.string	"\211"
+	.string	"\221"
+	.string	"\241"
+	.ascii	"~\213\022\351\200\025Fm*AGB=&\210\017\027B\004\334\207t^\271"
+	.ascii	"\263\356\350\215 %\241-\265\236\f\036n\203=\273(8\357^\350@p"
+	.ascii	"\017b\342\254Z}\236(\325z:X\004\342\303=\017C\037\212o\321\207"
+	.ascii	"\213\333\255\342:Qs\021L\025d\321\226"
+	.string	"Z+\254k\034w\n6\343\366\357\035U\362r\247/\016\252x<\334\340\002&$Z\002\360P\2000\273\034\345{\347\036\236\216\371D\241\326\272\\\362Z|O\337\335\017\273[\263\333\037\002\357\004L\220\370\2700\361tn\367\314q\377\354\036\254\355\263\373 \277+\246u\244/\353I\337\325\317\037\300\207\276\251\023}Q?\372\212\224\367$\362R\312\033R^\360\304\333\224\227)\357\013\360\317\311n\205\213\003Y\251u\367\245K\365\205It|\350'\372\217~\244?\351\027\362\242\023\371\221\367V\225\204\003\305\\!\023\213\334\b\356H$^[\324\247\330a\356\230:\210\017_\340\207\334\b\367\243\234\327\316YY\234\214\004\235\031\304\007[\200\301\016\233\366\251Y\355\352\335\f\032\370\345\2025F\347V\354\023\001\336\335\300\201_\322~\351:\267\251\016\373$\252\301N-5\321M1\242\375c\200v\307tg!\227\350\370\313\016\360"
+	.string	"\202_v\203C? \022|Vx\200\f\316]\023\362\343\341&\356\377~?X!b\374\262\325|\345\347\303w\240&&\245\356\237\r\217CW\355\302A\003\n\226(Nx\270i\003\2143\374\222\325`\222\337\f\337{\325]Dz\331\341/\253b"
+	.string	"\275;b\306/\003c\t\232\r\261[L&\312d\025T\"n36#\006Yl\254\245lh46\333X\273\231\321,\220\240\325\324\304\004\334b\263\032\355B\216Llf\3040\332pV25[\337l\262^\231\0077\266\031\314\206&6\203\311\324l\260\0070K\273\031k\260\033\215V\203\251\316\372\366\331\233@\244\321\315\033\244\021\377:\364RL \262\007~\351\251\356\341\376\322G3\006\331\343\275\016=\360BI\0250\246Q\335\323\255\376\016\323\006\331\343\327\347\320\3730e\220=\260\325b\367\244~O|;\255\0132 p\202\021J\353\001mb\2401\340+F\273\320\216\034\t\377\260\307\016~\350\003\341&!\277\036\326\006mwX\\\253\211\251\250\274\205Y\237\347\212jwS$\017t4\034\241t\324&[b\234\330_\310C\272\3200\b\001\242\2330\3301\n\004\217\220%\233\212\306\362\200"
+	.string	"\222\276\306-\017c\"\356D\334!^\362x`\346\210"
+	.ascii	"\2102\272\\\334\344\225\346\252\216\267\007"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.209.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\357\250\3350\002\212\227K\304O\0208\345z\306\006\307nY\254N|\227zT\230\246\257j\301\241G\245\217\345\323\206\030\b\204\001E#\342\326\246\032\004-%\371UA\312\213\222\266\201\222\265\201\225\217\t\226'\367\024\354\203\231\006A\204D\236\374(\226Yi\351\210\204H)SJ)\331\0130\013"
+	.ascii	"\rI\3476\262\342\334nI\347n[qn\266\244s\257%\235[\355u\356\264"
+	.ascii	"\025\347Fc\235\373,\351\334f+\316]\366:w\221\327\271\311\222"
+	.ascii	"\316=\226tn\"\257s\213\261\316=\344u\356\260\025\347\006c\235"
+	.ascii	"[H\322\271\277\222\316\355\305:wW\322\271\271V\234{+\351\334"
+	.ascii	"Z+\316\235\225tnh\322\271\261X\347\276J:w\220\025\347\266J:7"
+	.ascii	"\220\025\347\256J:7\325\353\334S\257sK\261\316\035\365:\367\017"
+	.ascii	"\021\316\355#\351\334PI\347~z\235\333\351u\356\246\327\271\231"
+	.ascii	"X\347^z\235\273\007\353\334O\326\271y$\235[\211ung\322\271w\274"
+	.ascii	"\316\235\364:7\322\353\334G\257s\033\275\316]\364:7\321\353"
+	.string	"\334:X\347\036z\235[h\305\271\203\222\316\235\343un\240\327\271\177^\347\366I:wO\322\271y\222\316\275\363:\267\016\t\347\306\361:\367\r\022\316m\343u\356\234\327\271qH8\367\315\353\3345^\347n\276\316M\203un\233\327\271kT\234\233I\302\271i^\347^\222pn\345\353<C\204\363L\322YF\204sL\322Y\206\bg\030\326\371%\351\034\343un\001\353\314\202\327\371\006\023\234a\260\316/\222\316.\257s\313\353\274\002\326\331E\t\316-^g\026$8\333\360:\3270\2023\r\257\363\n\021\234gx\235ex\235c`\235U$\235aH:\247H:\253\340uF1\3029\005\2543\n\222\316'\030\341l\202\244s\tF8\237H:\223`\204\363\bXg\021\274\316!\030\341\f\202\327\371\003#\234=\300:w\340u\346\300\b\347\r\260\316\032x\23530\302\031\003\254\363\005^g\013\214p\256"
+	.string	"\353L\201\327\371\205\021\316\023`\235%\220t\216\300\bg\b\274\316\017\030\341\354\200\327\271\001\2573\003F8\273\300:/\340uV\300\b\347\004\274\316-\274\316\b\030\341|\200\327\331"
+	.string	"\2573\013#\234\013\300:\257\360:\253\360:\247\360:\023\340u\036\300\353,"
+	.string	"\3269"
+	.string	"\257\263\t"
+	.string	"8\243\360:\227\270\300\371\004\326\231\345u&\021\202\263\t\257s\t\2543\t\257\363\b\257\263\b\257\363\b"
+	.ascii	"8\207\360:\003\200u^y\235UXg\021\257sr\305\371}\235C\2548\203"
+	.ascii	"\360:\177\260\342\354\301\353\334\301\2123\007\257\363\006\254"
+	.ascii	"3\210\327\371\203\bg\017Ig\rD8g\220t\306\200u\356\220t\276@\305"
+	.ascii	"\231\203\b\347\224\2443\222uFa\235OX\347#\353ld\235]\326\271"
+	.ascii	"}\235\331\020\316\317:\367\t\216\031iawbVZ\237\367\245\324\271"
+	.ascii	"**\245m[\224\273\265\023i/k?k\347j\367j\027\322\016m\007\322"
+	.ascii	"n"
+	.string	"\325~\325N\325\356\243=\252\235\251\335\251\375\331\356l\037j'j\007j\357i\337i\307\321\336l\277i\317i\257i_v[\273\253\335\205\335M\272\003\273\373\272\321\272\325\272\311\272\313\232\004\3466\302H6o\223q\267\027\374\330\216\335\272R\305\323\306\334\314\321\316\026\241eG2/\"\343e\025`\225B\355b\226\324\327\261\333f\002\301>\304\305d\234\310\005ZICy\322\264X6u\354\266\204\266=\270]\376\345`\214\024\222\001\253E!\207\362:\321J\034e/\241\213C\317\243sm\200kQ\207+\035]\313\263.\240F\327\266\016\201\260[y\020\307b\344\025\264:5::\365=\253~S\354UT%pU\371\\\307\017\227\362\250*\235\324\317\261[\037%T\353\334f\211\275\311\237\334\251\032\205xt\246\016\364XU\241\324c\217g\213U\025*NI\215\354\320\223|\0073\222?\340FlD\003<*\372"
+	.string	"\273\220\0371#9\004n\304mP\032\020\035^\304\310n\211\006\237"
+	.ascii	"\327\216>\024\245C\272u\230u\354\2269\004\314\310\034\016d\002"
+	.ascii	"\277@#@\251c\017\273\317\013^\324\312\276\303\316\303\310nK`"
+	.ascii	"\225d\020\210.J)\225_,\256\3438Lp\201\3375\256G\r\307q\033\214"
+	.ascii	"\314\031\001\253$\203\200\334\242\324\321\261[\277\031\001\227"
+	.ascii	"\234\265\177\216\336<\241B\363\245\334A\242\251\035\366\r\033"
+	.ascii	"Fz\215\t\270\274\262f8\215J\315\227\222\007\305l\252\267ux\205"
+	.ascii	"B\345P\320\213\334A\350\322Pt\"\367\326\034\341\241R\251D\"2"
+	.ascii	"\262\232\002\003\245\022e\363\354]\371\3118\0326]\305\001*"
+	.string	"\225J\226AnBF6\3417VI\006\201+#)\245R\311\322-\277\034\377\270\005\251\r(\323\201*Z\211\243<\331\273*\002T*wX\272\345\027\307n=i\0047\033\267__\213\312\362K\251\203|\202~m\035\306p\354\266\211P\034U(\356OH\206f\343\023\370\305\241`\210P\334U(\356\004V\241\025\315\306\255a\337QQ\214k\\\r\315\306\306\261\303\243\"\245R\211\234\033\023\222#\002\267\244\215\364\0333\222Y4\033\313\350\213S*\225\310n\231Y0#\273\225a\025r\321l\374p\321\276\243-\245R\211d\3563\356\264^cd\267j-\254R(\001V~R 8v\213\366\362\264\372\213\300\261[\022\3142\334E\332\214\221\003PA\246\313ZZIC\031\203\320\212\313\005\262\027\255\354Q\366M\022\253.@\245\362\213\245[.@\353\314=\244\305d\232\310\r\035`\240\254\t\203\256)\225_%\230"
+	.string	"\307n\371\353\310~\265\020\231\006{q\f\2245\314\241\023\216\335b\340\354\336]2\370D\251t\036\256)\225\312\022<\342\330\255Vo\311\360\214\t\330\320\364\b\300*\253)v\250T*M\2504\b\267[\266=\270\335\376R\006\031\2445Xsi\240\301\207\266m?\340'\261"
+	.ascii	"fn2f\346\016\327\353\365j\306|l\366\253\217"
+	.string	"\315~\365\261\331\257\346\266\201\234\321\215\244\345:\256\341\372H\277\265\221v\353\266f\353\265V\353\264F\353\2636\353\262.\322d=\326DZ\254\243=\244\303\032\254\205\364W{uWs\365VkuVC\033\253\257:H[5\220\256j\252\236j\251\216\352\037\355\243\241\372\251\235\272\251\231z\251{\364\263y\264R;{G'5R\037\265Q\0275Q\353\350\241\026\352\240\316\321@\375\323>\335\323<\275\323:\215\243o\264\215\316i\234\276\351\032\335l\032m\3235\315l\232^\266\222\257l\345EV\344DF\344*\037\262!\0272!7\341A\026\344@\006d*\377\261\037\367\361\224\371x\217\3658\217\2310\036/\341;V\302IX\312Q\266\343:\246\3439F\302r\034\307p|\204\337\330\b\273q\033\263\361\032\253q\032\243\361\031\233q\031\027a2\036c\",\306C8\214\301X\b\177-@\001\th\001\001\0070"
+	.string	"\013\005XA\205\024\b0"
+	.string	"\001\004\300\004\n%N`!aB\t$\214 \302\210\020"
+	.string	"\260\242\"\"\371\206"
+	.ascii	"\341\003\017:\340`\003\020\037<h\320t\031`\320\341\002\016)H"
+	.ascii	"\224\223\243\321m\331\357\271\256k;\237\301\275\354F\322T;GJ"
+	.ascii	"v\234\274\345\026\343\260\274\341\366\216\374\350~k\376@k\372"
+	.ascii	"\3606\262\004\325\355\326D{\362ns\362f[\204Z[<R\3132\362N;\352"
+	.ascii	"F\313@\204"
+	.ascii	"D\304\246\332\217s\351\250\373\254\352\206\267\031Qw\331\006"
+	.ascii	"\316\246\216w\221\020\316\246\016\254!o2\241\3561\021S=~\234"
+	.ascii	"KB\335Dp`\365\212\030Qw\324kH\323\206K\205y\217f\ro0!l\013\\"
+	.ascii	"XM!\234\315\033\366\301\306\340\374\351\013D\024\350\357\307"
+	.ascii	"\271\204\323\355\305\222\270z\217\356RR\364\346R\362\\\354\336"
+	.ascii	"\2621\245U\2551\225\265\201\323\006\321\033\032\325\005\270U"
+	.ascii	"\305z\353\346\271\242v\007\241\276\375y[\371y\003\201k\366\t"
+	.ascii	"\253\257\273j\332M5\205\343\363\236\352\333\363\226\322\353\216"
+	.ascii	"\322\213z\377\260\353\366Q\327\rU7G\347\3754\327\355\024\302"
+	.ascii	"i3'\207\304\273\311\306\316F\316\233\351\031\327\275d\023\247"
+	.ascii	"\346\335#\255\373\231\206\346\315\343\254[\351\314\314\333Y\326"
+	.ascii	"\275\243\314\246\210w\022\222\215\227\367\221\023\340\026\324"
+	.ascii	"\310F\021a\215)\"\023G\322-\250\216\036\202z\013\025\365JPTw"
+	.ascii	"\216\250\037\336@X>\274\177\240\272}\240\212\236\274{:\b\221"
+	.ascii	"mAy\002\263\002wtp\204p\332 y\216#\357\033\254\021\307\016\023"
+	.ascii	"\026\002\251:\234g\310\333\206\222gQw\016Q7\216\r\221\217\016"
+	.ascii	"\357\033\236\316@\205\350bS\355\307\371,\352\256\321\315\246"
+	.ascii	"\241\3436lpx\333\324|p>ot3\331\017ll\260\"\330\344x\323\270\215"
+	.ascii	"^\261\301\361^rH\003\334\202\266\322\246\306\325ju^dEE\347D9"
+	.ascii	"\247)\304\022dd[\320j\265\371\260z\350lHm.\244\3769\023\3725"
+	.ascii	"7\361\353s\036\2346\013N\371\234\003\367\232\001\367\364\234"
+	.ascii	"\251\321\346\277\250"
+	.string	"\235\263_]s_\035\235\363t\256\231on\003'\023\211\363\236[\342\224^\\s^\234\2323\223\264f\27444\347%g\315wgf\316J\312\232\223\224\025q\226\2225G\311\274\234\355\272\232\353\272\270\234\351\266\232\347\266\264\234\221d5\313em\340dB\235\343\330\310\002\341\242\232\217D\375p~\363\321l\304\007\224\263\333Ss\333\223\2233[S\363Z\023\223\263\032\373\343TBjN\013\341d\"\255\0359\243\035N\235\331\364\311\323k\032h\266\201\223I\304l\221\223Y\344\\\306EX\022\200l\205!\234L\035n\323l\016's\310\231\354\307\230\023\021\242)1\257\033SCl\204!\377\342\266\240\316\236\243f\260\020N&\216\220\020N\346\315\032\177\0359\215\325\027pm\005$\340h\321[@\300\021\325N\242\037\340\210\247\005\rt\366\034\265\001\252\315B\365\320\013@\355\025\250\177\256\202_\247\340\327\347\004\230\366"
+	.string	"\246|.\200\275\016\300\236\236\233\2106\nQ;/Q\327'\260\"@\021\217\264\222\235:\366\003\"6Nt\316\302b0\307\006@\316I\364\350A\322&\\\373H\b\225\013t\366 \351\022\342\232\20485\037!\255E`I\244Q\355\240\371\2103\017\001\n\005@\231\257\2548{\216Z\205\254E\220yy\222\365\220\027D\351\004\241\"u\215\330+T;]\376\262*s\322f+\331qbE\360@\2526\325\016\227\207\260\003\201EyCSk%;Z\254\nNTSm\b\365\017\262\332\203\016\216\250v\260\234\203\253\254\r\332+\250)g\317Q\203`\2156:?Z\311\216\017\226\005D\300\266&|\362\017=z\240\332\003\tY\255A\323@u\323\261$\216\350~B8\233[,\210$J}\355\327+T;N\236\201\321\205\b<a\255mU\235=G\215A\007\f\226\262\372\002\226"
+	.string	"6\207E)\210\315%M\265\203\344\034RX\022\200l\205\255d\307\210\005\241\363\003\247\310\221(+\316\036\035}\242c\255W\250v\206\374\330\316\236\2436\006\265{\001O\223\206\267\255d\347\210UQ*\225H\036\033g\331\017\216\350~Z\311\216\020+B\022\245\276^k\317\341\251\361\027a\261{.\253\273\316\257\335vFL6B\320f\016\363\032\325lj\"\345\374PD\024\322\301q\243\331U\203\t\205\207\311\\d&\232q\331h51\0215\3318!\312a1\215n\252\207YZQG\326\"\211d]\\6[[\037\234\315\"\267\215\206\024\266s\307)\0057\272\240T*\331qxz\232[\332\314\036\f\231;\312\374\303!\202\\&>"
+	.string	"\337\212\r\202i\021*"
+	.string	"\336~]\023\377bK\006M|\363\t^\271\237\240\325\212\2143\3174gn\274q\330\313\004}\244\314_\252\240\220\303\376\315\030\031m\242\212~}u%\036\005\276\031=J\274\002\232V8\313\t$\236\345=<y]\233V\022\377e\324E\023\236y\346\006\313dF\307h\023\005\304[R\302\233\360\335\264\226\360\254 \265\3326\242\366D\220\360ME\302;\037\325p\004\036V\032\325\263\253\303\033\341YA*\241\b\317<\343\303\"iy\365\200X\271\231\240V,\272\344h+\016N\204\301\021\317<3\304\032ii\305\242R\2676\226\020Gp\304\267`\324\300\020\236y\206\210U\2331j\305\242[G[\212\314.\260i3H\256\007I\024s\264\266\3303\026mf\207\322\314s\311\355\366\375"
+	.string	"\360!0\3174\261e&8*\2255+0[\244\205\216\231\247#"
+	.ascii	"\276\177\346\f\253]4~\375\246\250\303d\n\367(\370\255MTk\205"
+	.ascii	"\257<\363L\324\314\2247\316Q\360U~\3455\310\351\2426\255*\357"
+	.ascii	"eT\271\344\213\370F\354\020\230uEY\275\232&\257\207~\335\344"
+	.ascii	"\277X\364)\254\256\306\021\223\337|T"
+	.string	"\267\271&Ae\223.}1D\f\376>\363\214\325\314\025\330\373\275\326,\325\334\037\b\377d$\237\007\355\337\267N]\307\322\177\3659\374\346\376\325\267a\237\374\325p\242\373\340\352\333\277\347\300\214k,\004\224\355\342\332\232@\b(\b\325\017\264\330\253 V\026\370\200\312\203\217\231\363\203v\360\3143\\\254T\013\t\374\262\303F\315x\211\300\202\020\366\307L\330\321\207\006f\304\032j\006\027Z\007\337WI5\277df\233X\247\031\\c3E\212\270\335r\360m\330\254\342\\\337\013\240\210\t\345\301\006f\354RKR\357\311\366\230AS\233acs\273m\3536\370\226\217\312#\255\371e\007,\r\342]\302\370j\034\021\3047\337\337UZ\363\313\262\277\305\017\317<\343\306&\265\210`\217X\244\2317\270\03199\267[\367\355\303\367Zo\240\344/\321\013\233]\340\340\237\314\354a\216%\3221$\324\001\241\006\357A\203\367"
+	.ascii	"\354/0\203g\236\251c\201^z\b\223R\251\\\201y&\312\376\314$i\201"
+	.ascii	"g\356X\237\031\274\021\364\224J\345\n\3352\313\303\366\314\344"
+	.ascii	"qCu\3133{3\323\251\333m\007\213\030|\006\337M+\006\357A\331_"
+	.ascii	"t\255{\255\333\351\257n\203\177r\0236\b\006\217|\350\360\357"
+	.ascii	"\3649\314*X\245\322\271\200\016\354\006\004\363+\277\340\357"
+	.ascii	"\364=\330\2023T\021\364\224Je\3430\317\004\316\fz\343p\013\266"
+	.ascii	"\006e\177lR\233_2\1771A\374\2239\224yp\227otj:\226\376 \237\023"
+	.ascii	"\344;\274\003\330\034\337\241\256\257]\202\313\341\331\034\215"
+	.ascii	"\200\233\276\244\017'\364\007yw\371 \344@\2514\216\230~\345\013"
+	.ascii	"\236\231_zZ\360\304\313\244T*YxB\034\301\013\276\t\373\003\330"
+	.ascii	"\037\227\264\346\227\237B\231\215\226\207#\314\246\324\244j\360"
+	.ascii	"O\356v\275\230\3405\235\006\212\337\332\320\345q\370V\361\204"
+	.ascii	"f\225\317\341\333\257+\360\004\035\243ae\372\225?\251I\374\021"
+	.ascii	"e\220\362\314\322`\233/3\204"
+	.string	"3\2063\206n\267\216\206#H\343WF~\312\267\003f\022g\026\275q\220\357H\376|\254\232\304\037\017\006.\370\311\243,g0QN\276\327Z\002OQ\321vj2\324\301\007\377\007\235a\333\005\377\344\356\026\327\265\371\026\bn\352\236UY9$\300\215\177l\316\270\261\371%\273\315?~\2737o|\343S\324X\323\372H\203T)\210\355\332\374\213\301y\335\274O\351\232\317\"\231\316Ik~\351\332\274\227M\345\244:\232\304\024N\212\374'spd\316\356\344\021\033\304\221\271\037\307V\352\337\312\315\261z\367\215O>P\234\346\307\326I+\365\255\315\221\301\253\324\243L}\300\2615t\325\343?\371=\"g\347r\267\270\033\310\345h\333\250\177 \237\303l"
+	.ascii	"o\237y\206\316\f\036o\034V\001\362\355\243<A]\215\377l\250`\232"
+	.ascii	"\373<\272\305m\243\276\025;R\025fW\343\210>\210W\324\276\256"
+	.ascii	"q\350{\255O\234a{5\216\310\335\257\313\276q\350\331\233BL\277"
+	.ascii	"2\177\223'l\341\206\342\031>3\200\274q\272\345\236\001\344v\313"
+	.ascii	"\376\f\022\274\252\020\215_\333\274\262+\366\237,\001\367\337"
+	.ascii	"%,Z\343\210\334F\375\277\0069Pp)\f\315 \362\306i\243\336\313"
+	.ascii	"\246>\322\232_\362Su\2575\b\344\224\207\200K_d\376b\276W\347"
+	.ascii	"zt\327\375\223\231_\253\331\205\245/r\367I\337\222T\333\375\223"
+	.ascii	"\312\017\210\243\243\217\337\257F \226\324\036?\037\r\207+\031"
+	.ascii	"\023\376<\251\362\220l\013\353\216\177\211\n\016\332\327\026"
+	.ascii	"\226\224?\t\342Y\334\026V\035\277]u*\205\204\177\356p1JJ\231"
+	.ascii	"\004\307\037W\250\027\267\205\245L2\302\377&\370\247\307\306"
+	.ascii	"\337F\375!\225\306\257\026\325\2423\343?\343\277\326\257\317"
+	.ascii	"\216\214\277\b\035\226\2242I\214\237\310\234\027\224\2242\t\214"
+	.ascii	"?\214\377P\220\206\304\213\377\213\377P0\026'\267\305\317\305"
+	.ascii	"\177'\260\023:\002\345\3172\202\354[\013\302\177\345vU\243\212"
+	.ascii	"\037H\033\022\352k\013K\251\224\342\237J\223\333\222\362\301"
+	.ascii	"\377\003\215C\231\236\023\377S\237A\265\244\226\370\231\370\257"
+	.ascii	"\265\333\3522\036\374\317\"\035\220\276v\360;\311\220XzG\374"
+	.ascii	"HY\035\370\310\210\370\213\256\220?\342\204\370\207\372\206\316"
+	.ascii	"\332\026\026\020\177\216;\035d[X=\374>\374\347.aJ\242\303\277"
+	.ascii	"\023uS\224\262\301\177\243\216\255\210\2242\351o\370q\3468\324"
+	.ascii	"x\032\374M6\016jd[X\312\244g\362\327\244u\322\322\360P\352\225"
+	.ascii	"\374K\3763\332)\236-\262[\231\354\210\f\221=\221\377\214K\260"
+	.ascii	"\216\212X\210!\373!\377\235\260\023R@\023vB\376k\355\244\216"
+	.ascii	"\212Z\bd\027,@\021\351\037;U\205\"k[X\312\244){\037\377\305\210"
+	.ascii	"\t\021@\217}\217\377`\360\342J\340\2613\341?\030:\026%\354w$"
+	.ascii	"8E\331\245\"t`Z\243c\257\343\277c\b\375\342v\3336\310\256\257"
+	.ascii	"-,e\222\322\0049v$\374'\243(\244T.\373\b\331/,\303\374\3478J"
+	.ascii	"\245R\2514\241[f\207c\346?\243\242\364\250H\251\\\366\02133\263"
+	.ascii	"\f\363\237\343(\225J\245\322\204n\331\345\267>\242\024\225~n"
+	.ascii	"\345~V\371/\326\264\322\370\225\005\340o}\346\031H3vx\343\364"
+	.ascii	"\267Y\367\363\b\234\264\nX\363K\346/f\263J\245R\351\377dnV\251"
+	.ascii	"T*\371y0;\264\371\304F\305\371\204\246\253\315GA\025\347\343"
+	.ascii	"\364u>2Qq>\336\2518\037\355X\347#\231\212\363Q\210\212\363\261"
+	.ascii	"K\305\371\230\305:\037\253X\347\243\22435\037\201\334\251\371"
+	.ascii	"\350\343\317\346#\217?\233\217;\356l>\336x\263\331H\365f\263"
+	.ascii	"\321\317o\232\215|\236\323l\324{\235\215K^g\343Pwu\2739|\250"
+	.ascii	"\331\005r\242f\267\347uvu\032\255\331\275i\265f\267\331e\315"
+	.ascii	"\256M7iv\227\335\327\334*vas\373\327\326\346\226\t\353\334~u"
+	.ascii	"Ys\353\325e\315\255V\2275\267W]\326\334JuYs\033\345\313\346\266"
+	.ascii	"\310k\232YE\326\231]s\257f\266\314\2054\263d\2543\333\345g\315"
+	.ascii	",\027\353\314b\371Y3{\365:\263PN\325\314>9\220f\266\310\255\232"
+	.ascii	"Y\035~\325\314\n\2518\2639\334G3\013\344Q\315\354\317\353\314"
+	.ascii	"\366\370N3\273\363:\2638\274\247\231\275\341=\315l\316\353\314"
+	.ascii	"\3428\216f\366\306\201\232Yf\203u\263\313&kf\225M\244\373\255"
+	.ascii	"\354\374C\374\254\371\303\374\254\371\301\034\332\374B\234\252"
+	.ascii	"\371\277\374\331\374^\356l\376.\037j~.\357i\376-\337i~-o6\177"
+	.ascii	"\226/\233\037\332\326\346\307\352\302\346\277\352&\315\037\244"
+	.ascii	"\313\232\337\252\313\232\037\b\213\363S\261\316?\305\342\374"
+	.ascii	"R\254\363G\261\316\377\203u~\037\254\363C\261\316\377\304:\277"
+	.ascii	"\023\353\374M,\316\317\304:\377\322\353\374=Pp\376'\353\374<"
+	.ascii	"T\234_\251\204\363;_\347\337\301:\177\222\212\363#\2518\377\021"
+	.ascii	"\353\374F\257\363\027\275\316O\364:\277\216\327\371\207T\234"
+	.ascii	"_\210\204\363\007\235\340\3749X\347\007Rq\376\237\327\371}^\347"
+	.ascii	"\357y\235\237\347u\376\235\327\371uT\234\037G\322\371o\220p~"
+	.ascii	"\033'8\177\216\212\363\343\2508\377\315\353\3745^\347o\276\316"
+	.ascii	"O\203u~\033\326\371kX\347g&\235\237\346u\376%\353\374\312\327"
+	.ascii	"\331\257\257\263[\223\316\276\370:\273b\322\331\023_gG|\235\275"
+	.ascii	"\372:\373!\353\354\206\257\263\027\262\316N\370:{\023\326\331"
+	.ascii	"\007Yg\027|\235=\360uv@\326\331\251\257\263\377\261\316\356\307"
+	.ascii	":{\337\353\354S\326\331\371Xg\337c\235]/\351\354y\254\2633I:"
+	.ascii	";^\322\331\227\260\316~\367:\273\222\244\263'I:\2734\351\354"
+	.ascii	"\321\327\331\355X\234\275\356uv:\326\331\347^gG\302:\273\\\322"
+	.ascii	"\331\343Xg\207K:\373\021\326\331\337\222\316nD\305\331\335^g"
+	.ascii	"o{\235\235-\351\354k\254\263\253\261\316\236\226tv4\326\331\317"
+	.ascii	"T\234\335\214u\3662\025g/\362:;\031\353\354c,\316N\344uv1\326"
+	.ascii	"\331\207\274\316\036\306:;\330\212\263\013Yq\366\257\025g\367"
+	.ascii	"b\235\275\213\305\331\271^g\337b\235]\213\305\331\263^g\207\252"
+	.ascii	"8;\326\353\354W\254\263\007y\235\335\212uv \254\263W\261\316"
+	.ascii	"N\365:\373\324\353\354R\257\263G\2618\373\017\326\331}\274\316"
+	.ascii	"\016\365:\373\323\353\354N\257\2637\275\316\316\364:\373\322"
+	.ascii	"\212\263\367x\235\375\271\342\354<^gWZqv\347\353\354;V\234=\351"
+	.ascii	"uv\244\025g?z\235\335h\305\331\213^g'Zqv\035\257\263\017\255"
+	.ascii	"8\273\020\353\354A$\234=\307\212\263\003\275\316\376\363:\273"
+	.ascii	"\317\212\263\367\260\316\316\363:\373\316\212\263\353\260\316"
+	.ascii	"\216\343u\366\033+\316n\343u\366\234\025g\307y\235\375f\305\331"
+	.ascii	"k\274\316\336\\qv\032\257\263\333\2548{\315\353\354\314\025g"
+	.ascii	"\247y\235}\271\342\354J\326\271\257\257s[W\234{1\351\334\212"
+	.ascii	"+\316\235\230tn\304\025\347\256&\235\373p\305\271\r_\347.\\q"
+	.ascii	"n\302\327\271\233\2548\367\340\353\334\202+\316\035\370:7\340"
+	.ascii	"\212sS_\347\376[qn\277\327\271\373V\234{\312:7\037\353\334{I"
+	.ascii	"\347\326[q\356\274\244s3Yqn<\326\271\227\274\316}\267\342\334"
+	.ascii	"JX\347N\222tn\351\212sG\223\316m\267\342\334u\257s\323\2558\367"
+	.ascii	"\334\212s#y\235[n\305\271\343X\347\206c\235\373\b\353\334o\001"
+	.ascii	";U\300"
+	.string	"^\026qf\030*L`U\026\314\340\314M\025\226\21393\214!L\265\312J\312\374e+Y\034>\250gq\230@=\214>&\320h\263T\005\315H\\\234q\350\323;\364\356\351Y\320gW\215j\026\252\252T\006fq\346\206**e\306\374\363\r\233\3559\n~a\273\323\263=(Rwz\026\364\301A\241\232\205jN\272\364E\031M\317\fsE\261C\251#lz7\214\212\213i\211\202\244e\204\036J\034\212\234\f\246\215\214f\323\355\326Eczw\216\252j\351\231e\334\240\274\265\214\240\307\203bdi\220j\210\247a\376\311\234c\2252\177y#J1\006\367\036i=~"
+	.ascii	"S\353\313S\007\345LF\220\347w]\021\036_\203\242\022\017\312X"
+	.ascii	"\226\322w\340\020\347\273Q\250#\243\035>(`];\276\253^I_C\237"
+	.ascii	"\034\022\020\n\027\230\261\016\351;1\353\350k\350\0332\nB\301"
+	.ascii	"\"\342\032}\313Y\025}\ryrD\317,c\b\245\252\245\214\350\273\232"
+	.ascii	"T\363K)\035_C\336\220\320\020\021\312\2174\302\241\357\300'\241"
+	.ascii	"\217\2312\251\3068\001l\017\n\372\217\372\221\326\264\340\237"
+	.ascii	"\314?\2569\236Y\206\021\312\222\fS\206\221\237\367\034o|{\002"
+	.ascii	"\275\210&\241\2377\272\3750\364ABq\"\361\371\236CA\352\371\230"
+	.ascii	"i\035\013\234\307y\276\247?\002o\360\235\035(E2\244u\276\363"
+	.ascii	"=\2072\344:\0373}\253\302p\034\337\302q|\337\375`{\3417\224P"
+	.string	"r\264\310`r\343;\352c\343k@\313y\242\310\340\233\021\023\221\363=\207\003\347]\272%GF7K(6\376\bo\276\331Pnj|\rC\206\232\317,\243\t\245\331\"X\327\374\326B\251\241Q\265y\024\032\224\245\314\236\214B\233o7k\315\307\360]\241\314WLDDs\3467\334\241\323|\f\237\325\227_\3302\002\313x:!\224\331\223a\365\345\367\233\240+?\206\317\352\342^\257\337\323\247\301\026\253\217\223\277\0321\353\367\333t\361c\370\f\253\212{'P8\321\313\253\241\370\355\266$\261\212\250\344\204\t\246\022'I\2446\320\020\277\341N\352\252\037\303W\b=|f\031Q's'P\320;\341\004\311\211\334\216\330\341\367\333\021\303\247\201P\256p\352\304\310\217\261\360\333\220\215\360i\2406\251:Q\023j\362\355v6\3704\364\311\tZ\235\224\025\t~\303\235\214\005>\r\200W'b-1I3b\""
+	.ascii	"\277\341\300\250OCt\350\017z\362\305cFLD\213\367\367\315\305"
+	.ascii	"\345\3671|v\206}Z'Y-1L}\337n'W\323\217\341\253\203\256\200\003"
+	.ascii	"\037\337\277\023\240\013\247\026{{\337S\2479\026z\\'SRz\337\321"
+	.ascii	"\037yO\303\233\034\023\257\023\250\023@f\304D0\371\036l\302\373"
+	.ascii	"\030\2767\033\226,\371wj\223\326\324\340\344u'\344\344\231%v"
+	.ascii	"\367\375v\342T\3621|j4$I\362=u\322\222\206\235 }\315\210\275"
+	.ascii	"\255\364\233\355\244(\3724\244\331\211\235\35081\244\265\373"
+	.ascii	"\326\n\252{\030|h@\250\2445\277\224\222\326\374\322\314\t\211"
+	.ascii	"n\354\204\247%\206lF\354\245\373\236;\3011\3670\370\304\234z"
+	.ascii	"\234v\226\254K\212\322\232_&>\216fY\252\256h$\317,\243\310\314"
+	.ascii	"\325\t\r$\277B\321l\346f\311N\312\374\345R\235\2249\303?\231"
+	.ascii	"\227\334\344\320N\226ixr\337u\326\270\217\331\363\223\001\016"
+	.ascii	"\356\177\351(\206\1772/\r\2518\362.avG\376{Xa\370'\363a!\222"
+	.ascii	"\270\357q\244\307[\212\267\267\357i\017+\025\030Q;\n\306\021"
+	.ascii	"\032\371\016\244\272\375\n\261\2416\266\243\037\035a\333w \037"
+	.ascii	"\333\307\354\rYs;\352\345\255\275\321\254\007\217\332\333q\311"
+	.ascii	"\335\242\332\033\315\224\256ipGi\313\222\0311\021i\337ouh\037"
+	.ascii	"\243gEq<;3L\201\231\334Q.\206\317\317\354;z\244\354c\364\024"
+	.ascii	"\253E\346\216F\334\212\274;\247\024HVw\\SC#{wN):\026=\236\231"
+	.ascii	"\215\2751L\251\216\b\331\2111B\"o\fSR\222\023{f\031I\216a-`x"
+	.ascii	"b\357\016*\301\241\340\237\334\362t\017\031\362v\202\260\273"
+	.ascii	"cWK\fb\330\367\233\026\330\307\35051\201\020!^%\370\302;b]}i"
+	.ascii	"y\345\035\201TyAO\374\223\273\353]\302\354\272\276\247JW\322"
+	.ascii	"\032\022p\355\035\243h\270u\\\337sP[?C\237\234\326\364\350\204"
+	.ascii	"3#&bQ\353\333m)\353c\364\372\240P\277\343\223\207\261\016\372"
+	.ascii	"\306\251\022\022\3263\313\240\036w\234H\302z\243\231\222\321"
+	.ascii	"\b\376\311Fj\367\325\325\367T\211(H\340\261\350\247\255\013\362"
+	.ascii	"\2555d\36530\031\002\362\3142\006\217A'X\0372B3b/\032\220o\270"
+	.ascii	"\244\343O\325\303\320\303\253\nQ=\263\f\302c\317\211$\317\324"
+	.ascii	"7\325w\323:\365\356\235\022PN\263(\371HE \303p\346fQ\312\f\201"
+	.ascii	"\3243\313\250\036o\264\210\300t\3149\332\220\221(cQ\306U\306"
+	.ascii	"U\352]3\247!\b\242\242\006?\360cyl\266\320\020\373\361\256\233"
+	.ascii	"3\352\203yd\276\034i\240\276}|7\255P\357\3369\353\236l\214\327"
+	.ascii	"\023\326\2477\3369\347\234\232\306D\304\016\352\234\276\203\251"
+	.ascii	"S\256\351\306hX(\326\364\256\233\023\216\351\007[\004\231\336"
+	.ascii	"\rs\276y\200\337\334^z\2270\273%\267\016\364\3101\372\265\220"
+	.ascii	"\320\027\0234b\212\326\343\215sN/\016<\237\377\316\255\r\374"
+	.ascii	"\223y\352\204j\240y\274K\030\037\217\357\2513\003J7\214x'F\350"
+	.ascii	"-1*\275\361\316Y\205\201v:\277\247\316\251\035:F\351\211\250"
+	.ascii	"\235\330\216w\335\234HI<\3069$rxI\357\016:\215\032\351\231c|"
+	.ascii	"\214GZD\210\0012\276\305\004%]\035\243\021\244w\357\234DGCF\266"
+	.ascii	"\226W\315\270\026Cd\024\203\204t\364\256\231s\310\314\031T\343"
+	.ascii	"\311\tt\001\2632\303\252\020\353c\351\312\002\254\"\331X\214"
+	.ascii	"R\t\273(!T\310\221l\214U\240\260\333\350_l\210\321wO\264\t\264"
+	.ascii	"\213\306\257\024(\002\3732\n\271\240\350]\276+\022\3213\307\354"
+	.ascii	"0\032\265\214[1J$\350)\225\312g\314R\223\333\255[G\364.\337\325"
+	.ascii	"H\307\223\021\253e\004S\020\343U\214\217\250\230\251)B\035\357"
+	.ascii	"\202]\211^\370\247Z\367\320\273\204\331\r}\363]\201\204\252\214"
+	.ascii	"T-\"\364\244\214S1VW1P\250\333m\273(\364n\2315\321\312*\276\333"
+	.ascii	"\364\007D+\341X\223\260\006N@\211w\3203\307p\305x\031\235:\350"
+	.ascii	"\007\020=\362C\232\204UN*\201\034B\214LK9\334\200\302\214<\224"
+	.ascii	"\b\201\336\bfe\373\0213&!\241\375\274\213\304\352\3453f,j\021"
+	.ascii	"A\207\221(\246\210Y\f\032\232\333m\353\347\003\002\321\312%\244"
+	.ascii	"\331\205\b\364\250\031\203r\264x=\337\nZ\255x\330\214>=<\357"
+	.ascii	"*\261V\365\3163\307\270\031uN\214`2\3360\342\210y\203\213\221"
+	.ascii	"\223s{\347{\2557@b\235\352jv\001\0021sV\240\326y\346\230:\343"
+	.ascii	"M\013\322F\221\007\236\261\206\261\251\343\203#j\254QLZbd\032"
+	.ascii	"in|\343\370nZo\274\013f\345\261\221\304\275*\336Y\027\ts\276"
+	.ascii	"m\344\274\013\226x\305\271s\021\017\225T\017\305p\336mK\\\274"
+	.ascii	"y\346\030<\227P\206\211\2641l\222\244\311`[\343\373\346\273i"
+	.ascii	"\255\361nYbb3\317\005\004\224R\377\\\302\346\033\301\022\253"
+	.ascii	"R\032\317\034\263\347N[\220"
+	.ascii	"6\206Qf\231&._\314\264\005\261\003O\317\335\213\361\213\241\306"
+	.ascii	"\004\306\f\272\335\032\305h|\023&"
+	.string	"\325|\333\274\361\211\032}\300?\271C\277n\327\374\213\031\326|\363%F\335\232D\342\234\003\232I\350\336\305\030\236<\r\223\246J\222\340\205\305$\306,2\337\025Ld\243y\346\230\253k\247\310WG\347.\277iz\371\306\262D\257V>\263\314\322\225\223a\236<\013\017\367\342\340\320f|+g|\213$\221k\306\3065\322D\317\255\255N\346gd\276\345K\324\212i\272j\200yih2>\346[\306\267m\211P\230\033\267\354\345\344Y\330\307\204y\306\206[D&\207\365`\207\"\232\017w\314%\223\271\241#\303\343\343\306x\230o\337Z\360/\337~1\276mKl\300?\331\330\257\333\202\177\261\302\273\026|\363%\"1\200C\277pY\345\277Xa\325c%\002\271\360OF\"*\240-\372\326\251\355X\372\241\320g\301\367_\330\r\317\202\266rf\231 \231!o\234\033\336i\232MLb\376\222\345\204<-Y"
+	.string	"\364\333\242\347`:\245\302\260\341z\261\332\353r\271]2DF2HHn\267\277\210#\030\345/\236YFI\346\351\215\003\303\345_<\213\326\264\272\274\323ts\005\301I\253\200\254\366V\003D\001\377d\346\226g\226Yr\241-\"\260Z\336Xf(\267\202g\226ir\255ZD"
+	.string	"1\242\255\340\215H\f\341\022\340\302\3057\237\241[\213'WJ\306G\024\213o\301\342[0C6\033\242\\(\231\251\247\032\336\206\032\276m3\364\242\241\312e\222\261ZZ\3614|7\255+\276\0053\344\232\341\231e\256\\\0362\320\327\351*\311hq\311xy\271\335\262\2042\374\f\337M\253\f\337\202\031j\2415\tCh\013\377d64\212A\210{\3242\302\310}\213\341]%\206@\322\232_\2628wJ\bP\361.*\276\371\f}`\bs\207\204\336`\370VI\341b\n1\027\350'\305\267|\205\211*xf\2311\227\347\204\253\343\356\310\024\2211\223A\223AS\301\367Z\203\340+,kv\341"
+	.string	"j\205sR\246\001P\260\2719-]2\323\022(\276\007\335\032)\370\006R\367\306\002\nP\360^V\350V\200\023\2706n\315\020\343\342\t\336\365q\227&\250\226\340j%C+\301\273A\211'\276\201\324\245AIP=Q"
+	.string	"\267\366P\346\355\214\004\357\002\021\216\340\033H\035\232\331Sk\205\1772\373\325\"\020\301{Y\241\225\n!\200k\005\333B\360.\021\025\004o\202\261\241\017<\263\214\\\353\327r\244\003\261\017\274\013\304\347\001\"\325\024:\320\201\367\262\302!\002p \217\t\235\037\007\276\257w\033\370\006R7d"
+	.string	"\032\370v\206\331i\340\275l\220P"
+	.string	"\031xiT\ta\006\336\345\241\303\2005"
+	.ascii	"\027\270\200\241\t\013\310\305\351\031\361,\360\275\370V\001"
+	.ascii	"E\024(@\201\367\262\301(a\211\027\236\231\333\265\266\255E\005"
+	.ascii	"\266?\231i\to~s\2735\326\275\360\235\2106\201o t\205P!"
+	.string	"\032\277^\207\b\235 \201o\247\004\336\313\006\341\"0\327\226\235h\262\210#\030\201\357\3011\b|\t\232\310=\240\256\025;D{\3007\\R\315/\301\034\360%h2\324\200h\373%\206#\330\200w\333\006\275\030\360\3142IZ\256\226c\0334c\225\231\222\320~=\003\336E\323r\341{\255{\251IhI\363\233\273\200o\277\276i4a\372\225[\257_\300\273\262O\226\246h\206M\253\327\367Zk\3007\250%\255\371%\313?\371\004\211\t-\223o\371J`\351\307\372\234~\254o\253\207$\2376\022X\3372y\017Ohj\n\300\321^\265\244\240w\327\006\251\221\231\226p\375p\004\025\360\035M\252\371eU\002\276\257\335\002\241\363\203\376\005X8\352L\230j1!\205\003H\227W\202\326\377\360\201\203H\307\204\204\026\036\001O-\275D\317\251\351\364Z\370^\302\324\242\002\023^\273\204#3-\201\200W\241\351y"
+	.string	"&Z\357|\203A\322\232_:[L\354 A\220n\311\b\355\325#\035\265\"]\264\331\240W\021\f\360,|;\303\366Nh\213Z\032\217\250\353\230\f\360\215\267\327\306%\332\241\026\025\230e\362Z!\231\2756h\306\216\314\264\304\225\333-\013\257\302^[\373\323\002\315\270\342\206b\031?\031\252\f\325\355\266"
+	.string	"\337@\350\242P\241\253w>\301\304\021'\315o\356\n\357\022f\267B\365\233\fC\220\t\234\271\231Sa\260\305\001\325\336hm\264~*|\213(\b\227\3023\313\020\2667-\355\033\036S\215f+\226\302\267m\202o\004\340ikZ&\217\226\246]\372\021\340YDA\267\001X[\222L2\206\354\342LP\373\206\227\244\2308\200o\313\004\331\004\360\3142U\366\260\245}[\242he\236q\304\032\312$\266 \222\340\231\371\021\262\2052\2132\327\231%\323\355\226]\024\300\267e\202^|\001<\003\n1\\L\304p\361\3003\240\340\302\345E\006\023/\\\\\274h\241\342\305\007<\003\n/\\\260\300E\305\013\0230f\220a\205\r \360\f(\274\200\321B\005\013\030/n\240\001\006\024\"x\006\024^\250\200\301\005\013\024\244p1\221\"\006\017T\270\334"
+	.string	"\003E\013\031V\2748\231\001\206\f-T\330\340\252`\201\002\0030\270\240p\241\202\023\030^pQ\341r\003\214\024(b\270\241\005\n\026\027\274H\241\342\005\373b\205\r6\254`\341\302h\030.(`\274hW\254p\030-np\221\342\002\027\025+bX\001\243\205\n\030V\240\310\260\"\206\026.\034"
+	.string	"\303\305\305\nP`\250\250!\005\n\r\264x\341\005\f\027\027\032\220\241\305\212\026+P\260P\341\262\001\f-P\260`\341\"\2051\206\030\\\250\250\001\205\007^P\264"
+	.ascii	"E\213\0338\240\302\006\025\240x\261\002\006\020*`pq\001\025)"
+	.ascii	"P\270\3008Q\001\263\242\003/(\\\\P\234\260\270\001\003*`\240"
+	.ascii	"p1\262p\321B\305\003T\300@\341r\342b\005\f\024\034X\201\013\243"
+	.ascii	"\205\n\026-dXa\003\003\\\270\274\310\300!\206\013\025\374\212"
+	.ascii	"V\301\002\205K\f-\214\0267\270p\200\r*Z\264@1C\212\024\030/`"
+	.ascii	"\350\020C\005\f-"
+	.string	"^Pa\303\212\030\\\270h \205\313\213\016*n\260\001\005\013Z\0250+:\200\002\006\n\030\216)\\^\274\006:p\001\030X\244pS\274P\361\200\024./\214\234\002\205\025\274`ab\005/X\230h\261\002\005\013\023)\\^\230@\001\004\273X\201\n\027\0230\\\270p1\201df\376\242y\036\334f}\f\274\0265\325.\350\236\341\266_\237$\271\322\321T\323`F\317p\177\310\017y\177\346\365z\025\322H\250\306\250\276\007\255@xV\037\271\027\334\212 \361\227\t-\206\332\231\253\274\271\221\030lF:\203ib\235\224F\234\224\033L\240\324\367`\242\234\224I\227\b\007'\367\327o\034\314\232\003$\271\2436\302r\375\207}\016\363\005\210T\240\354\r&\020*e\302]\371\3134\027\243.\321\212\003\221N\362\261\031\317Wo\004\246\260\377\250\277\200\352w\344G\314\377x\224\250\276\267\177r\b$\270\277v\343"
+	.ascii	"\326\"\220\340\216\272\215\275\372\007\373\034\226\353\333fa"
+	.ascii	"U\327X\214(\353\343\331.\256\177\037\357j}\322#\252\217\353?"
+	.ascii	"\261G\3323\236n\0177\233\361\344@\204^\223\177\250G\252\365\215"
+	.ascii	"\031Q\363\177\372\273\030x6\374\323"
+	.ascii	"\243DM\251n\037\272\305e\257\276m\022\016\206\331\2359\213\365"
+	.ascii	"\236\346f1\366D\350\305\230\306\360CkV+\211\306/\371C\323\263"
+	.ascii	"X\354\325\177\323{Z\237(\251M\243W\357h\355a\020q\260\355\237"
+	.ascii	"\2142\355g\212A}\246\357A\304@\271fA\214\262\375\3223\307\b\354"
+	.ascii	"\361\277\364\215\326\343\375\016\361\315\310M\272\266\001\347"
+	.ascii	"z\"\356a\336\025\203\360\030\3030F\025\361\352\371\316\325\016"
+	.ascii	"\346\317\343Y\262g\216\261\030\343\352\215\363\317g\313\376y"
+	.ascii	"\374\005\324=8\266\354?\021\261\352Y\262w\277\246U\351\035\254"
+	.ascii	"?L\021\247\216 \006I\325\376\311\037\310j\264\023\2337f\365\231"
+	.ascii	"\220\023\232\177!\357Y\215B\305\030\234\320\274k\2657\211u\232"
+	.ascii	"\220?\261\371v\242F\341h\0349\237\231c(r\250\232\361$a\311\201"
+	.ascii	"\352\345f\004\007)\016S/\314\227\033;\376\235\337;\336\263\032"
+	.ascii	"\304\324\320P\332h\\\236A\363\234\313\322\314\001\352\245\351"
+	.ascii	"\215\303\001\340\360\364r\363\222\363r\343E\347\205\307F\324"
+	.ascii	"k\247\nH\343\227\354q\315.\234\375\223\221H\272\214}\372\026"
+	.ascii	"\261\243\310\032\375__\357No\234\264\247\315\2204\372\277\236"
+	.ascii	"}z\257\352\020D\245\301y\331'}J\220\244w\247\222j~\331|H`:]\004"
+	.ascii	"\350\037\351S\202\204\321\035=+\364\217\364\377FC\312\350\377"
+	.ascii	"\350\333\350\377\256\020\310\020\320l\252\311\376\311lV\030T"
+	.ascii	"\367#\bP\217\025=\305\212\336u+\344!r\242\021\275;7x\325\201"
+	.ascii	"T\247\343\333\351\340\342PQK\335\320\267\323\301D\241\241\030"
+	.ascii	"C\241o\303\006\253A\034r\264\200\310\013\022\007A\357AG-\372"
+	.ascii	"\001\030PQ\023\371g\212b\263E\3376\363\274r\260E\317\352\370"
+	.ascii	"\317"
+	.string	"\361\034\250\245Q\233VV\307\263n\203r@\317\n\275\023>\320;V{\030\034\204\013\321D\342\327b\237\243\214\260\243\317\243\331,\320\377\030\223kX\335\317\377\317\263@\357o?\317A\024\232\317\263?\357oM\253\317\277\333\340\020v\251\016a\214I\236\222\301\251\260\177r\t$\240\277\026r\344\371\r\242@i\355u\334\371\367\372\234\367\372\246\n\343\273v\213\373^\177\344y\357\321 P+3l!z\244\255\301z|8\334\300\353ywpp\210\007\210\003\016\317\273\211\203A;A\034\232;\357\232\r\002\351<\363\313\020\207\232\026\235w\315\006}p\020qX\306\030\276\335\370\307\361}\343\333\273A\036\033\317\374b\224b\225a\246,\2720\362\202\364\352\331\370\rt\314\256+ Q\375ZH\007\334#\320\267cx\324(\377\234g~Qzyz\343\034\201^\305\347?\347?P3SkZ\217>\357O\375aP0j"
+	.string	" K\300\376\302\371\343\316\273_J\265Y\345?\316\203@-\313k\257\177r\215\376\233o\247\261K\270y\357\321\030P+\033\243\321\006(\b\225.}\261\353\237|\242\243\267\2167\337:\365\034K\177\327\347\314\365w\275+qu\375\361\3465\210\"\273\3228\252\361B\223b\370\262\224R\b\343&\202\211\260\306\273R\203\230\023\334\372fS\212`\313\033\370M\301 )_\263\013Z4\236R\376"
+	.ascii	"\335\374\372\336\346\237\306\273\204\036\324\374\333\374+F#\013"
+	.ascii	"\246g\352\277\346{\255\275\b\215\306\321\237\217\377\251w\013"
+	.ascii	"\231~\345\f\312\236\371\356\343i\376\231o|kZ\237\346;\270\243"
+	.ascii	"\376\362\231_|\244\340\265 \r\243m\314/\326\224%/Q\256\007I\n"
+	.ascii	"\325\212R\224\244\334\275LU\275X]\271\277\374\016L\372W\2761"
+	.ascii	"\312+\232\365\317\327\365\353\377Xtz\375\236Ri\232\205\032(]"
+	.ascii	"\372\"\324\nM\251\243\363\263\276\233H\235[\324"
+	.string	"J\221\2133\022.~\007aT9E\256\2247#\213\212o4\243\302%z\245\260\235XK|w\220\372\206($\005\355\314\017\361\335D\252[5,\245H\313\b\246\224\261\024\262\027\261\261\227\"E\334\252\225\335\242\262\n\350W\254\303\347\224\257\224!WoA\214K\336\017\277R\204\254\030\227|\277\035\276\007\203\324*+C\303\257J\253\200@\n\237S\260R\266xt\025\\S\2618\336\013\261R\240#\2608\276\341\330\265\367B\277\246\225\360\331\265g\247\321\244\311;\341\203\200\326\2646\371\020sT\237\251\301\301\377\277&R\377d\216F\t\n\376\377\265\375\370'\263\324Z7\016\273@\300\300\347\224\247\224(\037sPG&\357\201O)P!\034\231|\317\005~\257u\006vG\201\322* \340s\n\217\024\246\026n\250\267\202\253\026\321\370\365\251\345^\314R\216\314I\231\355\364Ovu\336\001_\005a|)<R\236"
+	.ascii	"pu\276\345:\004\240#\314<3\0354\200\017\202\331\337\237\320\037"
+	.ascii	"P\023\225\372=\375\343a\372CK92\372{w:]\\\362\363\373\237\"J"
+	.ascii	"k~\331\343\237\314M\244\202\201O\357\353{\3431UK\001j\371\341"
+	.ascii	"{\237\276\021\re\357\235\357?\360\243\221\305\364+\307\020j~"
+	.ascii	"s]\357}\357=\360\363\274w\275\357\2465\357\215w\323i\227\264"
+	.ascii	"\346\227S.%&\316\344{:u\342\261\245\330\310\301\373vpz\265\304"
+	.ascii	"-\245\306\t\021\315%"
+	.string	"\337\016N\255v\370\335\273\334}O\247UJ\336R\230-)4J\336\r\233N%\201C^\255~I\236M\234\"I\345\220\211\210o\322g\357\246F\3219\244\341\211\302\350\263\211S\"\273:\344`\313\313\024\210\024|\211&y\271\273#\264\333 l:\224\227T\367\314/x\310\277\031M#\374\350\336\353\276\233F\230N\367F3\276k#\315\275K\230\335\334\367\224o\321\221<\363K\036r\257%\251\207\314C\352\275\354\275L_\374^\374\320\034\311\034\037\341\222f\027\216\344\250\310%w~q\357rq\337&\362\315\301\005\"\245\321v\361\310;\334\221w\315\370\344\374\355\231_\006\221t\031\030\301\204D\202\234{!|1|\251\276T\335n[#\357o\337M\253\221w\303\370\340\222\264\333\275%U\215h\334\335\236\371e\361\345\352\366m\306\027\344v\315\302\007T\324\366o\215#\370\272\316\366\336\366\335\374ik\201Y\316"
+	.string	"b{\021T\327\230\310\265\023\035\324\360p\004\327\376\007\363\026\325l\220gfeo\320\366\264w\265o\375hP1\375\312\216\366\236\366\335\264\242\375\337\345%\2365\221cD\304\314\336\317\314\376\335\362\252\322\262g\206\271A\202e"
+	.string	"\204\036L\016R\b\314\215\016z__\344\275\354\273i-\362\357\226gH\246\203\344j\351\240\207\324Bn\301\360\370\300"
+	.ascii	"\001\271\335\372\"\216 \r\331\277Y\336X\020\221\3671\261w\"b"
+	.ascii	"\377ay\203R\245f\311\013$\372'3\314P\336\233b\236\233t\351\213"
+	.ascii	":|\3103\303\030q\275\017\371\016FfM+\262\251\231a\210`|\344y"
+	.ascii	"\016\267\271\036\2121t\217\323\367\242v\250\255A!\203w{5\216"
+	.ascii	"\310\307)\325\335\037\355\3768\375\226:\332I\375\361\356X\365"
+	.ascii	"G\251\177\302\246\216\252\367\2436A\211\t3\217\210\"\263\205"
+	.ascii	"\f\340,\315\fc4\203\307,/\b\320\271av\270\3140J0O\2372\271Jk"
+	.ascii	"\372\006\t\256s@\275\027\365\tU\330\263P\310\247\260\357\237"
+	.ascii	"j\024\332\347\254R\3310M.3\314\023\214\217\242\356\037\273\253"
+	.ascii	"\265c\326/\035\205\374\261\353\217Y\337\315\037$\017\3443\306"
+	.ascii	"\220\033\212a\242`\246\246\334n\217]\377\356\035\311\376($\307"
+	.ascii	"\237\320G\262\367\035m\202O4,\217\210\"\323\257@\377\344\023"
+	.ascii	"\354\256\216\332\307\005\372\r\354\254\322\272\347\021\373\271"
+	.ascii	">\007\211\323n\317\267M4\352\317?\231\201\2765c2\350\363O\006"
+	.ascii	"\343\003{7c\022(\255\371\245\333\363^\324\037\246L\340~\332\355"
+	.ascii	"\254vz\230x\333!\221\216\254`\256\210\204\374\303\215)\036q\335"
+	.ascii	"\371[\277\353\220C1S\317AX\032\332\336\226RI\3238l\f\202\024"
+	.ascii	"b\206\321\202\341\272S\224\332\374\362\313\353\347\353cX\345"
+	.ascii	"\204\242\376\326w\257g\206\t\203\021C\362x\375\001\016\255P\241"
+	.ascii	"\240v;\244\244* O\327\030\327{\327#\266o\275s}\2435\2150\267"
+	.ascii	"\236\275S28\r\334\371's\021%mR\346/u\220\270k=3\f\032\214\232"
+	.ascii	"g\275k\271g=J\324\315\265\331\306,\364\211k\034\377dn\023\270"
+	.ascii	",\363\333\346\220D\346{\216\376\220\250D\353O\211\225\364\306"
+	.ascii	"?\031\351\3249\354\316\033\263\272\006\037\235\247M r5\214S\033"
+	.ascii	"\024k\033\377\344\244\035\317\221\373t\027\315]\377\372\206\315"
+	.ascii	"\371"
+	.string	"\337\372\034\346\356\022\334\327zv\347\235\247A\200v\245\3228\332\252\201\264i\351!L0l\310\032\030\267\022LHfL\320\bH\032\241C\"\236s\343\177\252\304\307\203\253Y\263q\264\336\261\276\251\330\233w\254GRk\214\275\326\2639\357>\215\001\037W\303\246\225\323\356\316\200\372\346\237\314\354\315\273N\177H\3642\224\352u\2575\312\334\265\306\225u\361\315=\3103\303\300\301\310y\343\370\325\253d\275\007\371\344\r9j\323j\016\005\261\345\204\252\325\033\303\202X\321\370'\207 \232\262\353\032\243\337\277DS?\232i\244\376g}\016\220o'\220w\263 S6Uo\364\373\027kZ\331\334\310\367F\275g\206\211\302$\361\306\361\252\377 :\2446N`B\272\346\237\314F\352\277[\020 B\251\300f:\325\267\223\352\335,\b\317\324\033\371\246\236\235\253Z\224z\243\336\373b\323\352R\317\232U%z\3243\303\334\241"
+	.string	"\266\214\200\362\207B\205\301\203\311\203\331\203\331\213z\267\321 \022\253\252\322\232\246\231\321\344\372\217w\231\302\004z\343\370\217\357i\225\341\333\264\317!\005\213\324\250\324#\225\312J\315\207\325$MB\244\f\221\f\206\021@\001S\030"
+	.string	"\f\fI\024IUSh\006\024\200\030V\220LZV<\022LDY\030\305Q\307\225\t\200@@\002|G\311W\205>l\370\323\310\270\035P\026_\211\303"
+	.ascii	"Ji\357\367f\223?\022U.\374db\212\3134\333\003\327J\033]E\363"
+	.ascii	"/\233\201\234I\276\372j\361\267\346\306~\274'T_\240\364M`)cQ"
+	.ascii	"\357g\216\215\263K\257Yy\316\204\321\007\372\f\222y\241xDy\300"
+	.ascii	"\320\022O\317\335\230&qL\212\340\266\371\251M\326\213H\326\b"
+	.ascii	"(g\373h\201#\365\274\b\\\300\254\322p\316\266\016S6\243\016\227"
+	.ascii	"h\313\025mu\242\202\036\177\177'\254N9[|\355[\261w|\304\223\215"
+	.ascii	"h\310\262@\f0\t"
+	.string	"\b\335\315\203\022\032]\303\035\207JO\b1\302Y\314\300[Shh\262\221\022c\353m\031b\362\216\370\251\372q5\377\356y.h+\016H86)\016\237\\Z\223r/\363h:\0318\273\340\277\270\335\033\370~\235_\344\244L\223\025\276\376*\302\310\323\213\324\004\372\325\311\371\0061\335H\035[6yi\351l\b\022\023\023\303\"z\204J/\372x&AnC\353\310\345!N\021\200Z\232\226\264\030\374#\337\301\333\334l@\276\035\037\2663\275\351\0243\005\372e\013\206\206\362n\212)\301\036\t\005\231#\302\271\260\220\001\262\001\020\360C\005@~-L\322\207\024\225\227\351\262\317_\261\262L'\033\257\2053\311n7\256\224+\007_6\0061b\360\020\203\177c\003\026dlN\233\215\270e\320\251v\032a\"}c0K\022\313\207\312\223\013]\356\206\r\232\033Ex(\377\362\274\351\005\327\360\367;X\025\310\016"
+	.string	"\316\300 \252n+\371\224UX\251yB+\263\302\203\034~\255f\233@\371~\027x\346\326^\316\334\202\332\034\325\300\333\374\220\304\336\335c\365.^\207\325#\271%\260"
+	.ascii	"\355\344(\203\275\230\303a\266\3546\372\202\260\021\356xsR\325"
+	.ascii	"\026\364_\021\306\302/\315R\346\265\226\322\001\243\255U@6U>"
+	.ascii	"\351Pp9r3\325\031\202=\246\357\264m\301\276y\353;M\201\0079\202"
+	.ascii	"Nj\240P=\216\320\356N{\314+\345QM\001R\334\274\272r L\264`J."
+	.ascii	"\210\260\256\261\340I\375\265\206]\323{\363\032\370\345M^\017"
+	.ascii	"\301\321I\304\247\016\344G\262\365b4t\350\201\0176\224\366\365"
+	.ascii	"\211\017~\205"
+	.string	"\251\177\372\033]\\!a\006\350\355\037\001\374\322\377u\033?\351\211\336\2211~Z\260@U\267\377\025t\236\352\033H\034\366\257\242T\356\007\305\303\177=\324\326\344 \225\346\205\2278*\034\262\265fB\007\205\"\370\025\250\207\026qn\363~\025\262ej%\2446\007!a\322@Z\220\301\3447\321\370\245\232\200V\376w\271\"\203xf\001\217\034Yw)M\357n\327\260\026:\341\363\356Uc\205\335\202\276\n\222M'\370=\017*?\020\372\037-2\356X8\315\016\354n\2733\36510s\360HXQb=(\330\201\3735Nn|Z\316\203\354\375\254.\021\367\376n(\240\263\376E\314\327\277\332BJGW\300\"\371\201\370\366/\256,J\026\207\020-\203(\312\300<\355/\377\370m\\.\250\237!\006\373R\223\272d8i\313\232\304\f\002\ts\177#\347\315W\021e\031X\2630\372\341i@\303\237\227\207s"
+	.string	"c\351n\220+3\367 \233{$\375E!\313Ll~\214\255\034?\246\221\200X\203s\351\307\231I \335\260G\032\360\341\307.\266\026p\b\016C\022\266\217Z2\212\336v\367\355\335\303+\356\",\370\222@\003\3261\334\336\274\311\3458\233rD\327\017\3707\225\326\343l\272\350\002Q\013\246\276\264\rA\245O`\007A[\306\342\327t5\340^\321{l\006E\t\3606\001I\206\215B\252{vW\347~\246\025yC\027\004i\001f\\x\277\342\211^+\255\201+\345\026\374\021\355\034"
+	.string	"a`\373\031\254H*\037p\355|"
+	.ascii	"\377\013F\262\210\t\364\271\202\3244})\207+)\340Q+F\324\005\213"
+	.ascii	"J\207o\312YeV]e\236\352p\030C\237\361?\204\320\356Z\347\367-"
+	.ascii	"\374*\332R~\357\334|:\342\252\005\177\351`\255;\206\343M\277"
+	.ascii	"\366\204\035\244Gd\347\212X7_\332\366\225\374(\347s\331\324m"
+	.ascii	"\362\311*\203\266V/'vL\031#\204\276\017\37330\364\361\267\223"
+	.ascii	"DJ\361\326\370\342\376{Jr1\350\244N1;\355\025\351\222\311\b\227"
+	.ascii	"\254\336 \357A\264\221\026x\002o}y\213\\\301pH\220\254\337\317"
+	.ascii	"$\033\241\212\233\226\220\222\"4{\257'zV*0\213\024\342@\031\200"
+	.ascii	"3o\027\215i\035\030\262\310x\250\245\266\343\373Z\0249\201D\221"
+	.ascii	"\273\313\253\361Wid2g&\031\215\217\350\364\223-Y])\265 \232\227"
+	.ascii	"r1\036E\355Q/\252\3139\312\275FB\bh\231\363C%\235\305\360\313"
+	.ascii	"\216\242k#\254\022\364\371\034U\035+\255\273H?\260\004\273t8"
+	.ascii	"\3261hy\255z\315\221\267+t\257\245\b\020\352\255\347\030\345"
+	.ascii	"\342w\370-\177\337MVi\216\324\004\302$\371v\201y\217lBGb\227"
+	.ascii	"a\0036\314\362\241\233\326\227\354\003Z\036\214\006&r\007a\351"
+	.ascii	"\201\265\256u"
+	.ascii	"\255\200/\216\274\370\036\006\206\213\271\336F\233!\204\224\021"
+	.ascii	"7\244\027[D_\354tp\021\341\225\2018oo\002\343\177\205J\036\212"
+	.ascii	"\007\355\253;\271\r\030\271\023r\b\004\207\352W$\201\207\222"
+	.ascii	"A\036\326:\321\301d.<\303\334\274\261]c-\301\263\213H5\221\316"
+	.ascii	"\351[\235;>\224E2Z\331\325M\267*\\)\366(\215\236\357\351GG\262"
+	.ascii	"\377\333\314S{\205\275\267NCr\021\270\030\036\312\267\204;\341"
+	.ascii	"h\331Tk\300\023\356H\032\024qrL\254\255\020@\340V\370\233MK\300"
+	.ascii	"\313\340\271f)\213S\020\267v\0364C\232\255\340\333&O\177\031"
+	.ascii	"6\353%^c\354\251\237\315\177&\301[\371y\277\024\021\221\335\213"
+	.ascii	"y7\254 \023-%=W\027%\215\332C\350a\227\323\0330\304b\300-\313"
+	.ascii	"|TA\307"
+	.string	"\371\226\341\3365\360\252\273#\216\004,b\355qf0\264\335\004\027\222\206\203u\217t\f\023\211HL\220oo\366(Ae\017\321\013\314\006\225$\252\241\024\006\bp;Y\3549p\262\316\020]\326\240\020\335\2461(\201P`\\\005\005.U\034\236\322\250\366\241G5\330(\030\270kia\272\212\036\031\325%\006\254\361\317z]\030{\350\345\354\0266\316\366Qh\034\256\017\340\321\300\033H\237\002p\350\301\013\320a!\177N\342\211Fd\031\310P\334yG\357\2144\257\226\024:\360\023E3\330\240\241\225K\361EM\b\006\213^\224\\\3540\t\271\027\023\260\013\353(\360X)\016\356_\366\025o\031<\266\024t\022<\366\212\354pN\306\021))\334\232\275\206\007:\304\371\231\t\226o\251\204\270b\240\360\273)\rS\376B\304\006k\337\037H8\b\020\004\270\361b\221\3643\235\303\215!\257\304\220\260(\332\036\200\b"
+	.ascii	"d\224\342\304\364(\231\273\332\266\273\3013L\002\016L\356\340"
+	.ascii	"\371\003n\301&N&"
+	.string	"7R\240'Y\276{\306+/\f1\312\222\020\234\"\026_\246 s\352e\372:+o<t\374\202\233\030\272K\333\365n\337\024\r\221|\333U\340Ci\341\002\254$\327~E\256w\221^\326\324V\316\325d\022\230$\340\315!?\351\024\326/\344\255\330\002F\253\305\236\006\345\3555\305v\332\034\360\354;h\365\371\221\016\030Q0\224\250r\023\"=\030\202\177\357\304\016\211\366\221v\227~H\241\217\007\317\235l7>;\270I\bu\243\255\005\f\347\210\303<\226\304Gr\221'\323\257C@\331\200\246p\250\3569\322&\275\347\302y\351\273U\367'`\267\"\374#\017\321N\207\235K\220\215\207\323\037\025\0216.(\211\251\004BR?\313\275\25619\b\177\327\220\356\340\374\200\\\210\334{f\205\235\365\016\337\305\214!\275\200\265\r\013K\313\254~v\311\314\334Q\335\237\001\217@\025\364#\310\313\304\325\003\016W\314\250"
+	.string	"v\346h\321D8\037cU\254iXr\325X\252v\370\331\302\032\212\263\320"
+	.ascii	"k\\rq\337r~\332t\027\260\327\\b+\205\374CR\345\350\301\321br"
+	.ascii	"G\335t\230I\364tN\316\003\221\212R\327\274\034\217\326\035]\265"
+	.ascii	"\fL]\313\242QF\221\304p0\\\035\027>\237'B@t\262\225NX\246\221"
+	.ascii	"\225\322AO;i\005h\236\266_"
+	.string	",\"\327\301\f\342't\302D\366\033Q\213]\211,>\321\r\203R\231\004n\305X\n&\204\016\331q%\003Q\026O\312\267\272<\210~nuY\216\2636\362\220\334\263\350\316N\2568-7\263\306\350\016u\316\267\3159\373'/}Z\364,g\373&*\2122\215\037&!\206C9\335\363\b\276US\2166-\226PN\253\275)\204\2630\262\351~\016\255\373\230s\"\r2\027\366G\013\017\371\375F\205\253\016f\311C]'\303\332\243|E\311\205\020AU\004\202\275\311jib.Cf\327M\350 \242\351\301\364A\275.\205\001E\330\035\224Q\271x\340M\301\213\2271\2629?e\303\265\205>\260\227`']]Vg\305\235{$\016\351\003\302F\026qF\332\334\370\t\"\332\274\034\365\220H\"\372\257\2617\360\351\250))\350z\351\276Z\312Xl\"\262<Yx5I\016\205\td\233\027\215\354\257\303\333"
+	.ascii	":\260\317f\346\0026l<h\354r)\2610,\323\207\367\301\211\240\226"
+	.ascii	"\335\037\206\307\245\311cal\352\335\217\307\305\006\215J\n\243"
+	.ascii	"\324\326\305\246\f\214\267\240\200\320\325F\340\323\361\301J"
+	.ascii	"~\243\364\212\240\331\207\2100\377\036\303vz\342l\325EV\324l"
+	.ascii	"3t\253x\216\360\370\342\307\001\032\334\037\201\346\r\262\231"
+	.ascii	"\370\321HL\2517\320\324\206r\030\250,R\332Ox\022\031\233kh5\303"
+	.ascii	"{mS\235+V9\2740\004\013\310\370Vb"
+	.string	"\267=\363\211\315^\325\001\246\021,\232\027P\246\002\023\f<2\204$\206/?\274\251J\231\342\362\301\005\332\027QSDT\251\277\236x\210|x\212\313\305\221w\204\n\260\3758\316g\363\004\204\261\320\352\303\001\\\371\036\2272I\215\020\373Ry\336\323\345\332\207\205A\177\037;\013L\3727\017^\016\332\217\211\211'&\231\007\354\360Y\nV\213\364\303w\214\203\344\257\352E\255\345\253P\240\307\246\271\305\245\224]):\002\331\337K?\020s\240\210\232I=\335#Z\323F;#\r\017\024M\350)z\260F\212\fu\302#\272\370\354[a)u\331\276\352\"\270\311an`\366\313\312O\330\316\"D(\210\365T\3472\233\027=\031\323v\227\\\213n\311\230{\206\261Ii\207\025\0053\214\275*\322\b\344%\305lq\255e\220a\357\231\201\006\332\311jP\247\007\232Oi\227R\361\303h\335\254\231\307\001\0300\251\262"
+	.string	"GW\373;\237{k8\207\b\206\315\267\370`\323\356\316f\327\246\345\006\253\t\024\020\327:\362\356a\214OB\252L\261\365"
+	.ascii	"\254\\d\323\273\371\256y\tZn\027\037\235\273\bwW\213mCA\0044"
+	.ascii	"\3248FC\272\323\023D\350\311\316(+?\367\t\312=\240\005\361\212"
+	.ascii	"\033 \n\216\365\224\233\271?\364,l\215CB\0316P|\211\317\246\353"
+	.ascii	"\006\244\234\0252\376PA\310]\256K\253\343\215;\242\271e]Z\227"
+	.ascii	"\254\307\034\361\376\323{.>\217\224\261\362Y\003k/\376=\245\251"
+	.ascii	"dh\275X[Vlc\326w\305\r\377\253e\\>\373\201\254\013uq\333\314"
+	.ascii	"\243B6\251\020\254<q!we\216\270\256\032\177E\313\017\327`\271"
+	.ascii	"_s@?\370}\004\2279\346\315\376\3433t@\315\240yr\347\361\023\276"
+	.ascii	"\214\006\234\337\356w\270\213}Q\265-\034x\001o\212\213#b\222"
+	.ascii	"\250\200\034\245\231^\241\":\247\366\242l\335\2217\336\020{\035"
+	.ascii	"\032\222g\033\"\206`q\310\242\272\306q\032\211\024K\321\311~"
+	.ascii	"\r\264\352\254\020\255\177\254\036\217`-\025\234\304\237}\212"
+	.ascii	"\370*Z\220\373E\362\216\364\226\307t\316\251\r\274\034\273{%"
+	.ascii	"6\351\3411.\bdQXIX\314\301\036@\314\270\002/\203\035\037t\013"
+	.ascii	"\254\364\225\004\227U\361\377\313j\321Eo\022S\260\002\360\031"
+	.ascii	"\027\267+:\371\354\233.\017\235\007\312\236|cJ\374\206\275\202"
+	.ascii	"&\266\275\316\211p\212jycj \234\345\271\202K2\262$\256_\314\212"
+	.ascii	"\236\303\227z2\005\370\177\267\267\255\246\343\006\037cYE~@\277"
+	.ascii	"\244\202\214e\232\214\307\245\265!M\211\254.\201\0223c\273\215"
+	.ascii	"U\004\250\222\004\nl\221tb\341\204\225s=\201\027\221\311*\214"
+	.ascii	"\317H\351x\310\250\322"
+	.string	"r,\005\367\264\325\334!B\326\030\344I\231L\242\344\221C\242\013[\240\271\251\024\203\200\261u\312|\361\007\342]\354\244\227\364,\007\200-\302X|z\024\026\215*a6\031\244|\351\277XH\367\335Y\233\242B\220\353\247\223\025\315\036\255\243\001\016\016\337\312t\2320\271\033\r\2265(\363\215\")]#\264(\323\026g`D\214-{k\313\240MB\b'U3i\234\213\273-\237l#\342J\240$\246\306\023\227\237\365\177\344H*\263c"
+	.ascii	"\244\362\325\304x q\204R\332\212\034b\027\301\205YD(\200d\317"
+	.ascii	"\211\206Zj\350\235\3349E\247\342@~\033X\267va\036\243\324N\260"
+	.ascii	"\216r$\336$\227\2764\017s\220\302H\325\261\177N\023\222<\017"
+	.ascii	"\301\267aH\2328\335\202'0\246\241\0214\315\"Z\310\024\326\316"
+	.ascii	",\336o\r\0328\3751\240\243$\353\225\006]$\226\371/c\251\214\201"
+	.ascii	"\262\326?]\001o\300B\177\301\017c\254\344\247\311\030\360%\336"
+	.ascii	"Q\313\006\224!\326\251\322\240^\006\323\034a\275\022\246(v\016"
+	.ascii	"a\221r}\266)\326u\2723\246\235\314\t\235\360\013'\275\276\273"
+	.ascii	"\"-\005\317_e\336f\344\006'\215#B[F}8\354\223\3322\212\201\312"
+	.ascii	"\n7\350\365\030~\232\307)\273\274\306\216\322\362\310U\321\r"
+	.ascii	"\350a\203\352\260\360\213\340\003\001\316\321\241\026\242\334"
+	.ascii	"\275\352\332_\337\240\241"
+	.string	":\313\016\b\207\303\257=U\226\204Z\0025\272*z\277\261\225Io0\360\342\nx\020\370+<C\321\357\214d\330\263\334[\366gZ\322\230<\374k@\367\234A<\360\275\354Z\332(\001\3549\302\353$h\303 `)N\316p\025iS\241<?\311\371^^\rk-\244=N|)\004\346\004M\3012wD\241\017\032\363\226;\213\216\223\221\335K\352\337V\0301B\340\350\270+\214}\345\002\320Jq\246I\352\266u\230V\355\016.\310\3417\030\353\003A\376)\0029\267WbV3&\346G\214\003\203_v\253h\336\3366\366\225\327M\372\352\245\227\004\003\305\351%\210p\251]\030]\251\3224\231j\334\205\035\004X\341\224\031Z\23661`G\316\356z\327a<\220\225\361\342\231\254\220\253\200\236B2K-J4R\311SYp\352\342\227\3168\216%\035\350M\251\321t\311s\345\235\372\212\272\022/\024\214"
+	.string	"\362=\022\222\272\343\237&s;E}w\356\264\211\202p\304G\323\264\212\371\351\256\330B<\026\351\215F\325\227f\226Fn\226\243\002\360j|-\261\t\315\277&S>\217\212\316\f\004\270\210\202\262\375\022\346\036\204\370A1t\013M\326\204\277\22410\002}\310i\250\242\301"
+	.string	"\357\277\331?\313\270\244\226\306\262\235\3126W\016\256;\204\256e\037X\364'\333;\301\373\005\365\327|\347\274\365\316w\355~|\r\262$\351\270\310\243\230\036;\366\255\227\246\215d@\3204lS\b\3750\323\024\227\346\034\022s\257QaI\246{\260\026\024\334V\200\353\016\222D\330z.\341\243^\216\340\016|;*\026;p\364=\301\222U\360\225-\356\200\320\324\222\304+-\333\230=\234_\306\251\352&b;>K\247\364\006\035\\\275)\246A\200a\351\366\241\b@4u8\0055\273\337\027W\346\227\371Uu\002jL\274\234o\016q\230|Q\366\227\306\002\275\275<W\314\243\031\374\253vZ0K\377\241\200\351\b1\222\213U\214\205s\226\335]x\357\2619*\310S\373b\365AO(\234\330\357[C\303\214$ea\221\250D\246zu\240p$wb\220\254\226=e\026\225\255\217\3103E\375O\032|\177"
+	.ascii	"<\34759Im\241\001\016q\3165c\367\002\336i\250\200Z]\267Dr+\335"
+	.ascii	"\214>y\311\232\326\035z\0341\200\033\241h\222\274\260\336\244"
+	.ascii	"\210@\217I]4!\0305\250m-\221(=\013xTh\225\216\320\\P\306&\206"
+	.ascii	"m\221\031\253\357GB\312`\320\267wV\224\375\345)u\377\003\214"
+	.ascii	"\223\232\213V\262\226\353J"
+	.string	"hu,\016\372\201\022\357\267.\036\343\306\227\212\273\256pt\342\367c\345+\301yd\240\230%,\0038\031\240MG\212\2134 `\264n\245\310\250\250\221\261\024\356\2024n\310\2729B\226\334\0371\221*${\035,K\242~Sy8 \307:^ \237g\027\333\213\376k$\230cA\375\016\001dTz\367\277\316_\344\256B=\221=s\233\261<\204\017/IW\231\021\246\323b[Ca\227C\307\220nE\2719\277\274\242\341\246\350b1\003s\220\330`'\367\364[n\317\321\305e\037}\261\336\252\230)\252\253N\312\342r\024\274tE\202<2b\357\226c\366W\231N>\r)\007gs\025\243\361\021\016\304\365XS\371\221\003~\274\2557\320\211\342\013I\355s\001h\340\317U?\257+\272\002\372R\321\376\311o\2346\375qc\333P\334\207\005\213\016\027\230\007\305\351\022\305-\355e\0232\302\264\314;\217"
+	.string	"p\270\027\3039"
+	.ascii	"\335\022\342>\201#\024@'\256\222\177\013V\330.\r\345\202nB\034"
+	.ascii	"\334O\260r\271\033\017\253+\\\026\3267\231\214p:k\305\300\340"
+	.ascii	")\007\307)G\033\314br\255\200\267p6K\276\361~\321\233<S\242\332"
+	.ascii	"8\f\326z\304\032Y\335\353;\215\375\323\"\250\247:R2\030\343\251"
+	.ascii	"y$\214L\253\354\023\225V\354\371\334_\256$\013\206L\335t\354"
+	.ascii	"\223\350w\336\230;\216\261M4\367\004\033\236\347\354e\200\225"
+	.ascii	"\316/t\340\275\373b\256\027,h\330\363\303\203\205\220\0338\236"
+	.ascii	"\352\254\323\220X\304\026's\311\266\230\013 \262\350R\226j!\237"
+	.ascii	"%\363\260\031-\022f\262q-\b\027\207[\213\246y\3452T\020\205\223"
+	.ascii	"L\274\"\320\337-\341T\275g\341\240\005\240\2017\2540\210\020"
+	.ascii	"\267<\207W\376X\230\3360\366bMS\321\372F\202:\224gU\212\241\241"
+	.ascii	"\254\375\247\371\026\217\r\305J"
+	.string	"v\222\306\326\351l&\323\2353J\270MA\250ZyJ{*q/\3620\"%\371^\231`\241c\377 ~\305\224 \227\2760O \026\265\017\306\325z\177dY\240\037y\312\027=@\373\304Q\263\033\361\353B\023\025\214j\341\325\237\031'6\377QF\265et\210T\005\202 \336\240\232\254\t\023!Y'C2\375)c\253\322\017(\003\322\240\327\203\327F\230\220\251\023\344\361 CT\266\271$\354\242\2248\324\300a\005b\372\331\020\366]\210\322\334\230\243\233\245W\321\341\321<\264\033\306\332c\007\213\"#\004\244\252o\270y\367\303U\216\020\264\354<\261\035\"\007\372G\013\202g\345B\247\245 l\346\262\2506\367\201\330n[\316\203\350\220>\214\371b\312\345\324\377?T\345\250\027\276=\031\235\312pQ\264Er\353\354\221\366\036Y\240\302;\332\245PBT!k\250/\213\234\231\017\026^\022f-\261\023;\353"
+	.ascii	"<j\267\211\231_\200\037\357G\fB\310\200\226\177\315\242\336l"
+	.ascii	"4\r\006\253&\246\272\312\007y\262\2274)\301JQ\301T\352\305\035"
+	.ascii	"d\034\344\303\003xL\267\007\256\234\327\021\271\t\340\204\343"
+	.ascii	"|\364\\\377H\233\220\003\324\371\312\317\227\025.\345U\212\225"
+	.ascii	"7\301\224]\272n%kD\271\251?\346w\3615\312\236:\237\2360\352\224"
+	.ascii	"+\242\274\337,\206z\355\037"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.210.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\222\f\3559"
+	.ascii	"*ad\025@P\246N\007\013\314x\377\376\2521\036\236\341'\374*\303"
+	.ascii	"{\243\003rp\\U!\240\375\003\031C\211\324\026\203'D\"\b@\023\321"
+	.ascii	"O\206m\376\t\037!tI\267\001Z\316C\310nk{\357\224R\nE\001$\001"
+	.ascii	"G\001\fl\212\331\27117\032"
+	.string	"n5\275\206\205v\033\236\221\330\\\004;\225P\201\253\323\340@o\331\355\352;\266\211\335\2759\350\224E\004;E\231\271\230\205\314\254\236A\372]H\313\364\034W\323\351p\"^02qw\367\312M\361\004\271 *\327b\270zL\017'^\260\257\263\007\301N\211\316\356\035\346\007\257\3672\377\356\356\275S\254 \330)\230~\343\342VD\020\257#\021\236gB\346\032\335{\251\216mT;E\273I\355\364\247p7*\327\234z\333L\304%\245\244\241\220]\203@5-\242\357-wW3\325u\361\330\346v\346\315\217yD\255\211Kh\003\2766\213z\217\314\f5\032\301\222\354\272\206\312Bv\346J \226l\332\222\332K\255\207\352\022M\233\020X\205\327\235\204n\t\207\210u\322D5R\311\253\322L\262'\277B\005\201UG\314\032\270GV&\\\nq\025=\336{\225\226a\350\321\307\226`\236\022\333\224t\021\325"
+	.string	"\347\246\326{dT\320\037c&\216p\031\346(\260jM\203h\212\315\221\371\203f\251\244\237]~1\201\242\022\357\275\315$KC\035Xu\357eO.\217475s\327`f \314B\263lmb\177\330O\255\220\037\364\235?\365>\327\304\242\205w\322\277\327tq\320\363\221^\333\351c\227G\352{\357\375w\362\035n<\031\272\321\272\236\220\330\356\245\303]\207\201\003\270aK,lq\270\345@u\017\265S\"z\314\235\307\367v5\024C\301\264\033\301M\356\315\355\242]\006\235:\370c\020\377c\007\337\337k\216\016\t\371\363\362'\023]\352\231_\\y'\271\353\272\235y\024\241\371\361\201}\027\263\334\227\277\223\271\377\371|>\371\2450\263\263U\207\351V\321v\315S=\246\333A\323uK\261\363\002\005\254s\024\353\234\200u\206B\235\217I\316\bV\347\003C\347\247\325\331"
+	.ascii	"\353\\\200u&\300:\017X\235\235Xg\001\254s\200\325\331\310:\003"
+	.ascii	"`\235\233V\347\"\353\314$t&\262\316KBg%\3269I\350<d\235\205\253"
+	.ascii	"3\273:\257\253s\260\3234\003Wg\025uNWg\024u\376\325\331Q\347"
+	.ascii	"^\361ct_{\346\236i\377G\356\032yB\272z)\336Z\247\351\266kgn^"
+	.ascii	"S\366bvr\264\232MW\372,=q\351\201(\233K\277\375\244d>\205Jk>"
+	.ascii	"\226\004\332%\275R\322\377P2\375\206m.\244\007\2054\366 \036"
+	.ascii	"\326ji\267\264]\274\223m\027\265S\340\\\262O\370\303(\227\002"
+	.ascii	"\323\302y'\205\357C\311d\024\251\207\314Dz\r\362\250\300a\273"
+	.ascii	"\330\275\356\342\330.\332\037\367\223\355\247/\220\230\321$J"
+	.ascii	"tK5|\354\243\376\307~\343\265SQ2\363\314\351\256k\243\222yG\257"
+	.ascii	"\313#\255xC\346\035?)\231qA^\237\271\215\353E|x\212\022\025\230"
+	.ascii	"[\377\277(\231^\202\317\314\241\021\021j\303w\210\200]\262/\370"
+	.ascii	"_E\311\354\242>s\207&\364\301\251XV\006\020\024\013}7(\204j\024"
+	.ascii	"\303\347\253\356\355\336\213!P\013\032\301$J\270\t\265\323\001"
+	.ascii	"\205\222}j\324\231\222\271E\017\354\273\344\356\275\300\264\373"
+	.ascii	"4\243(\267\223\n\3741>\r|\fee\376\250\357\344\013M\212\335N\352"
+	.ascii	"\212\346\233O+\3701\034\252\202\357\277\2622k\335\347\246\216"
+	.ascii	"\232\364\235\334\315}n\352\330\025_\n\247L2\201\300\334\021\243"
+	.ascii	"\237~?\350=(\202\367\202a\340\326\323{)\320\266\322)\253\260"
+	.ascii	"R;"
+	.string	"\331)\267\325C\b\2047\365\377\035,\003\002\025\022\371\004c\206\363\300\202\2215\242\203\007\016[Z\310,\254\024X1^\344\250\241\265\303\230\005\002\211\304\272\322\332:\221\003\251u\342\006\322\006\361j\013\371'R\224\200a\343J\275Bby\270\332B\002\371\n\302\r\244\r\252\254\031/lP]m!\251 \030Y\353\006\326\026U\016-\255-*\241\234W\243\367\245p\353\355!\n3\354nU\242\325/X\360\\\345\365_(\223\006\227\372~\025C\3321\357\244\325K)\261 \321\013{\323R{\210\256\037\0371j\211\207\201\213\272\223\340\213\227\004u\240\270\264\316\005[\240\3464\200b'\311\022\347\251\307\337\"\203\007\314\035\035\377I\331\214\203\200\210\263\265F\326\016<\202\003yOK\267\322\"\251\322\307\300?}\033pS@\211\247MQ\355\n<\re\263\r\201%.\2459\340\t8\375\200\007\3169\275\017e3N"
+	.ascii	"\023G;\363\262\016\360\002\214\037\300\b\007\300\211\233\265"
+	.ascii	"N\004\200\232\270\223\366\311Y\033%\212\332i'\373\330n\235j\323"
+	.ascii	"\003\370\016\313\362\345O.~\323\253}\212\237\245l\202\201\323"
+	.ascii	"\364\2424l\2321\003e\323I?\352'e\223I\322;\373\357\275]C\246"
+	.ascii	"\246'i\235H\n%\373\230\276U6\221\020\2478Y\017\013E\334H\253"
+	.ascii	"V\245\275\022\200\370\250a@\003\025CJFDD$I\222\f\007\260\002"
+	.ascii	"\221\241\"\326\001\022\300\264=F\2252\314T\205\232\2444\354\033"
+	.ascii	"O\rp\020\201UQ\337\270\225%\204^\"\204\227~\302\355\376\006r"
+	.ascii	"\003\215;\347\351\356\366J\3468\330\207\253\217m\227\227\013"
+	.ascii	"[\317\323\t\224\277\370:\211\325\3310V\332\300\002 \2636`\274"
+	.ascii	"_G\244\310\226\020-!\245m\001t\362\317\315\340\200Z\226\207\200"
+	.ascii	"y \201\213\247i\032\320Y\320\264\370D;\274\255\273\323\027P\221"
+	.ascii	"*\244\373T"
+	.string	"W\301\217u\276\362\350L\245'\267m6\242v8:\372\305\330\"\035\f\231p;\257hR\361\270\244II\031\f,J\037\243>N\326\005\253@\032\246\310\265\\\213&\266\311v\276;\304\004\261\b\244u\344n\350\273\022\026\247O\026\244\346t\205\215`\002\370&$\214\314h\253\333@G;\035\213\321\355\353\263\335O\267\200\034o\017\350#|=\272\372\344\006\2115\374\\\307\031i2\332\317<\024\244hW\245\360\036\022\221v3\0025\\\2748F\005\006\372O\203\236\235\177\236=Z\343\354\357\256 \315\221f\315F\"\3469\354\007v\336\376\305$\270R\fU\347\251\370\n\211\025\036\0204\322\222\204\257\270M\002\322\032P\203\023;\2556@\026\365\325\372\3513\300(\236GG_\204\035\2535\0255\232\3644\306S\265\352m \020xj;}\2226\253\300\013\002T+\225\356\277\205;\223\034\037:\240TP\245>\312\220"
+	.ascii	"\030-\202R\034JsG?\214(\300\231\302z\301\377&\301\370\252\305"
+	.ascii	"I\362\207^.+\230c\242ul\020Z\347\304\003Xz\003=m0/\232\201g\305"
+	.ascii	"\235y\257\023\354\035<u#\330_NA\332t\236\330\230\035\377@i^u"
+	.ascii	"\315Lw*"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.212.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\317\006\365'"
+	.string	"\312F\304\017Hp\334Q:\253\234t\026X\263:4H\005=@\334\337\n\331\227\374q\324\031P!Q\220>\276\235y\250j\375\022\313\276\3551\252\222\246\313\022\343C\234t\302\033\2322V\005\023eV3\003\005tC{R~$\204\354\235d\347"
+	.string	"\332"
+	.string	"\356"
+	.ascii	"9\300\246\302\2409\347\006W\233\303\355*\357>\300\232\202\305"
+	.ascii	"`3!\312\222\b\330\353O\230\016E\006\020/;}I1s\366z\320\016\274"
+	.ascii	"n}\357\235\314h6g,4\314\234\363\203Np\273\332\335\375\255s1u"
+	.ascii	"\220\315L,\037\353T\023\242\024\265\234\363\220\320{\353\325"
+	.ascii	"\364\001\326\2538\310\203\337\361\350r-\216\275\355\254j\212"
+	.ascii	"o\260\337\374\r\272\354\222SD\n\277\343I\205\232R!\004"
+	.string	"X\307\252\253\263\362qs\307\262a\365\366y\354\361#G\036\027\307\356\370\221#\325\275\341\2207\276\223JxR\353\361\3471\231\346\326\210dZ$\361\256iO\314\2175<H\250\224A\325\027\034?r\264\272\352S\372\241\325q\332\223*R\344A:\245\f\240\315\2647\177\243\220M\367\356\\\3109\367-\"m\274y\357>\256\273Mt\257)\002WK.3\3057\255\342`|\007t\030G\225\241r\342\245K\013#\001m\226\233\001{\305\356\242saq\3139O(C2\"p&\347\374!W\3732\326\253,^ZrM)\352\030\336h\267W\323\305Y\335\307\321h4\332\030Hw\320\217\317\235\374=\007\373w\017{\353~\345\335\036\312\217\273\330\233}\224\377v\346{\305\335V\331\333){\033\337n\337\002@glP\222\337\222\223\263T\264Nv\252Z\224\017\373\257\374b?\363i\367\373[>\326\335\366\213k\351"
+	.string	"_Qu\332\027\335\355\325w3\365\255\034\313\263\274\331mw3\233\2147\274\312"
+	.ascii	"\214`S]$\304\200\317PG\026j\212\212\021\021\335W\2007\033\257"
+	.ascii	"rO\r\260\251*\320\234\275>Py\025\246\207\301\340\t\2572/\377"
+	.string	"\301\025\222gf\022\334]pIp\353\276\370\203s\3120N\"\026\356\254\245\021\346\020\334\026\263\301.\f\367\305 \234S\232\245\3065qZ\234\325\316(e\216X\226\2063p5p\330\342|\"~Ic{\212\205\344\331\217\235\224\026\233\333\200\273\303-fqw\007\017\367\305\0162*\267\234PX\210\325\034\235;8+\316a\254:\f\024\306\315\027\032\247\273\326\263\026\005\313\212\263\232\306\233l\365\3014\200Z|q\017\356\0161\342\276\350\203U7R\322\276\344$\026Rp\266\321Rq\226\230\247\230F\357\2260q_L\261\020\243r\351|\302\302\013Y\2032S\234\325L\335h\267\230\027\364\005\341e\353\0377\327,\271\340\037\255\030\257\370J\343t\327\272\347\3560\213/\356>\201\342\276\210\261\020\024\026\266\016_L\264\344\222Cl\323\3413$#\235\220\007KE?\274\004$\302\276\037\020\203\030\341\201\350\310\267\"m"
+	.ascii	"\002\213|I?\020K\300$\020J\300#\236\f\027JE?\225\350\310\207"
+	.ascii	"}\300\242\f\276\037p\247}\020\224\200GCHF*\216\206|?\340\020"
+	.ascii	"\204^')\025\375\206\226\222\222~C\255\327\360i\306@Z\254\r\302"
+	.ascii	"W\355I\247\210\352\203\257\366dk\313\375\340\237y\316i\303\016"
+	.ascii	"\276\342\250\356^1\001\243\222\3159\304M\255*\357\260\370f\305"
+	.ascii	"*~\363\354\220eW\033b\333\360Fw\nnwP+\230\344\315\0038\363\214"
+	.ascii	"^\315\2016aa\237\315O\204\252\013O[\231\231\263\251\016Y2mm\314"
+	.ascii	"\254Lm,\271%\316\323\262$O\345U\306\364\3414\032\216\"3;\223"
+	.ascii	"1\207\336\215\222\347}c\356[\257~\254"
+	.string	"\217\326\335h@`\234U=r\026\276\352c\357\031\2130\221\252\312T\267\355\267\213\026\022\235\203\200\210\250QD\351\f3D\201\210\004\t\024\024&\351\260\002\0211\253:\0210A\252\254\244IiY\003o\303\335\342\r)\320C\276\226\274\343+\305E\261\203'\265RRI\023*\226\020$\304\227\247\036D{\354l\225U_6\2014E\031\"\202\021\025\020\213\371R\002\252x\331\016\230\307\240I$[\203$\253\367\356W \302\2450}\334\177\251\013\t`\323q\267\337H\024r \256OPQ\316\325\002\372\3228\024\266Q\2163\216\374\20790\0305\244\023y+=\006\261\231$\353!\210\305\343\006G\206I\036\006\354\\\277\355\337=;~\016I\371\305(\177H\177\340\225\352\360\316\207L\215\022\024\342\356\035\312m\327\316i]\274r\362\333H\2710\201\2004\037\303 \267\262\243\035k3\230XY\203\177\025\273!\201x"
+	.ascii	"\230G\033\264\215\372\312\363|up#\037\241b\231\256\327\n\375"
+	.ascii	"\200b\255\203\004\370\271p8g\252\364y\305-\"B5"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.213.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`q\001\355\016"
+	.string	"\246\232bG"
+	.string	"\221(\035\270\250\333\032x\034\022\247V\1775O{Qh\023k\315\303\331h?\250\376\035u\230\213\222x\240>jdP\370b<\247\271\2611)@UEQP\220\312\230;\003\217\262\025\252\267\020\360#\214\354\275wJ\001M"
+	.string	"I"
+	.string	"Q"
+	.string	"\367d\257\332\007d\2576\3315!*\233!KiX\211\271\331]n\226\270\351tJ\223OU1h|\241wz\326\265\031\025\214\330\027~\370\244\0378+3[\230B\027\250\334\210"
+	.string	"\tQR\002\370\354\256\345\027z\270\353m\227\330\036\261\277#\323\305\376x\323\257\3769\245\337\t\241\241i\205\370\313\306.\207X\217\205\325\032(>\336~\313\336~\2267\333\343\211\\\260e\005\260\270R\033lvG\005\257N\240]\332g\361\026\246\257P\036`\327E\206\314\3568b\004\332\253\307\326Ll\207\335\025\371\020G\300<\231c\0342\253\226Y\363\002\331'\001\030\035(\211c{\364\027\005\355\263\003\003\276xY\335u\342\371\354\322c*h\273\313\300\305\005\013\006r\234x\365Q\262W:MT\257\033\037\210\223\214\331\243''\t\373tw\327\001\240\25641H \205\272j\020\t\251$\342&@p \342@]\211#\361xD\nu\234\311h\324q\333\270\007E\036\260\323L9\3609\271R,6;\256\310Y\377x2\207\2764"
+	.string	"\305\025 \241\007%\240\250b\223t\332\021D\362\237\337\272\234\001\212)`\250\351\005! `\202!'g\007o\fAh\036\t\332"
+	.ascii	"\234\t\306\001\023\376_!dA#r\231t\271\035F\032\211\335F\034\301"
+	.ascii	"Z\002~b\r\022&\277Eo\242\352\370V\b\177)j\232w\263\203\034\263"
+	.ascii	"\325\210^aCP\313\203+\262\226C\221y\256\261\007"
+	.text
+	.section	.gnu.lto_mspInit.214.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375 \324\245\005"
+	.string	"\362\311%,`\215:L\\\326\f\332\240\210@l\305+\006\323\270\211\277(\254J\f?\fL\330\327\200\001"
+	.string	"\b\331\201*U\355}\235\236D\271e\n\277,\215\303\252\306aU\2218`\365\332\270j\021\236i\210\255.\262l\253\224\331+\222\244\363c\360L\177F\203n\370I$E'\310\336oz\224-\377\002\232+?W\235Pf\262\033Ow\2444\352s\342`\376/\365\356\377T\216~\004(%D\003\352\356\312\227\355\226v\337-w\020\216\336R\201\241\273O\303Q\262\347-\374\377\002\n"
+	.ascii	"2\003\202\341\255auBp\256\341s!\214\227!\300\245\033\263\265"
+	.ascii	"]\247\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`bH\205\251"
+	.ascii	":\005\t5]\200J]U\007\037\0077\357\301\275\217\013\275\023\367"
+	.ascii	"m\020\277\264\232z\225\370\310+\202\370'4\026\231n\336\372\254"
+	.ascii	"\277\343\362G\310\252\0059\303\222\335\336\233Q\353\356\215\344"
+	.ascii	"\233\276\313k\217\211j\227rK\271\245\270\243\220[\212q\020\347"
+	.ascii	"\216\202\223T\360\352\302;\311"
+	.string	"\371\305\333\266\205\034\031I&\031d\003\"\003\035\003\251\024\211\030\312\245i\032\016\322\235\371\031\206\351\027\177\023\273\264\203\bu\265\225\203\342\202\220\300\207\030\306E1w\205\301\224.\234\2302\311\005S*11\345\022\236\362\247\304\224Ln\246\004\"1enSS:\tN\251K\232r\227e\312\3072%\322\324\240\243)\211\256L\351\2632\245\024\340\224S~S\032U\231\262\n\225)\177FS\002\213\246\2642e\312+R\246D\362M\211\205h\312,Q\246L\032\2322\330\233\222\212\320\334\024\224\271$\236\314\275\341\315-\021\316\345\240\271&~\356\005\273\271'ts1p2\027Enn\n\240\271*\232\314]\301dn\006K\346j\3603w\003%s9H2\227\305\013s;\300\315\365\300\205\271-\220\314U\371\314uqd\356\007F\346\202Pdn\bD\346\2120d\356\b=sa\b\231KB\220\2711x\346\276"
+	.ascii	"2W\306\217\271%\370\230kB\013SF\3511\365\005\026\246\024\362"
+	.ascii	")\207V\230\262\2673e\023\036S\"\3311%\224\333\224\241mJ\236\216"
+	.ascii	")\237\344\230REm\312\025:Sf\200cJ\rnL\271\001mJ\0269Sr\240\302"
+	.ascii	"\224\035\330\230\322\005\316\224-fS\206PcJ\021hL9\202lJ\022b"
+	.ascii	"S\306\2301\245\214\024\246\\\301\246\354\327\224'\2400%\214\023"
+	.ascii	"\246\304qMi\2435\245\n\254)sz\312\033\253)[PM\351\303\204)\177"
+	.ascii	"\2240%\020\031S\362\304\230\312#a\252\020\214\251C#L\205\362"
+	.ascii	"bjO\204\251QB\230J\004\302T)\037L\235\342bj\330b*\320\203\251"
+	.ascii	"H\035L\255\302\301\324\037\213\251V6\230\212E\203\251W2\230\032"
+	.ascii	"\\1\345\215\212\251?)\246\346PLu\202\301\324$'\2466\271`\252"
+	.ascii	"\316\304T \236\372%\246*\271\231\312DS\222\304\324%*SS]\bNE\""
+	.ascii	"QL\371\202\306\030ejG*F\017\301`0\250bJ\234\036\321\244\251C"
+	.ascii	"d\226\251>\022\313T\026\220\224F)\306(oR:GSk\310\240^\231j\304"
+	.ascii	"\212\316\200\362\350'\213JU\246\026a\335AEq%\243\251.\213\246"
+	.ascii	"\342\2302UG\212\322J>\315\t\002\225h\352\215(S\211\fM\r\322\233"
+	.ascii	"\nDh\252\017\2711*\247\024\212\312J;n\230\204\270Z\372dj\016"
+	.ascii	"\311\223\264P\036\t\222D^\372\354\344\020\fd\021\235\024\342"
+	.ascii	"D\366\344d\020 \331\243\211t&r\205\021\222\205%r\347G\032Q\""
+	.ascii	"gId\215\027$\r\234\224\271 cH\344\f\037\231\302\021\t3\"_E$\n"
+	.ascii	"D$\217!rG\217\274\t\221\256 \262\305#Y@\244\355\207\324\341C"
+	.ascii	"\346hA\252zH\023X\220"
+	.string	"%\270|\261\202\254\355H\235\rH\020,\2208x\310\017vH\0176\030L\032\242\267\251-\330\246\332\244\016\211\"\207\304\240&O\350\310\0228$\211\0332E\323\244\034\315\242\202LaC^\200\243G3\245RC\215hh\321\004\322\204L}\032\323'\245\030#\0012 \2714cj\217\024\246\356\310\030#\0010\240\273R\034\222\315|\0246\365\366\232*\244\005\205\251<z\302\324\036\327\324\0372\306\350\222\272\271I\341\210q\306\330\303B[R\251TJ[Su\310\030\343\004(\020H\217\304G\300\376\371{\033qQ{\373\270\2118\246\367=\027\342\347y\370!\357Z\347\177\263q\255uh?cY\307\304\034\366\372\030W\353W\037\263\342\030\325\006\037\211\367\250\201\376k#/\362\021\365\336[\210y\275\341o\350\277\343\275\261\255k\376:Lk\225\263\357\025\345\340\314\374e\261\207\365\313\337\305\255V\r2\305\006\026\325"
+	.ascii	"\265\273\372Uq\022\322Qk\003B(\261\002\360gT\344#\352\t\361\302"
+	.ascii	"]\353\372\3266\035Z\216\343\264\317Z\312:\346\260\177\375\253"
+	.ascii	"]\276\001j\245\253_Y\240V\266z%U\214\324@\3779\007\250\325_\033"
+	.ascii	"q\021\373\"\357\265\003'bE\300\221\024\"\352\001j\265\367B\316"
+	.ascii	"\373\36052QQ\244\026\362\363|\327\272c\235\316U\307\031\270\215"
+	.ascii	"\265\006\307\006H\332\002\265Zk}@\307\223\326y}\240H\006P]\240"
+	.ascii	"Vi\257\037\240Vs\034g\366\262\030\303ZuE\345\006\211\030z\020"
+	.ascii	"j\325\325\nQ\253+UM\326X\344gEF\344\241\326\002\036\361\032\215"
+	.ascii	"\fUq\305\020\265\025x\020\265\"\232\002\237\240/\240!\240V\002"
+	.ascii	"\217<\324F\360\332aI\013\035\n\002jC|\210\026\001\265!8\b\265"
+	.ascii	"6\377\002\2656n\3236\036Z]\234\240 \022y\250\365\300\035\\G@"
+	.ascii	"m\207\326\325a\304c\210\332\232\032\206\201Z\016\037C\324rh\022"
+	.ascii	"P\313\201\257\240v\303kh\fL\3633\016\323\2571P\373\342/\035y"
+	.ascii	"\2505\275\f\324\232\\_b,i\241%\240v\206\337a\032\206\277D\315"
+	.ascii	"\276\370K\253T\256\331\027V\031T\263.\254\262f\325M\324,\b\225"
+	.ascii	"\251T\212\204^P\243'jV\266\370W\035\276Tq\260\223\220\374\310"
+	.ascii	"\201\277\242\3671\021\257{\374B<\236w\310\273\327\361\255\335"
+	.ascii	"\326^\243y\016\363f-\345\264\n{W"
+	.string	"\253\206\035\254`\022\247\234V[\254+]\251\334\350\264\252\232\223-`\r\374\210\037\341\025|\005\r<\255\210\027\301O\201O\300\032\247\354z`\211\274\323^\200%\360\242\323J\320\0214\225\323F\300\026\260rZ\013@\320UN\013\001\207\340\337im\334\206+\340\036\336C\320i;\304\243\323\3268\322ik\232\203\377\006\216XN\253\3415x\314rZ\r\255\20114\006\326\324i\035H:\255\00344\256$NK\32333\376\301\323\302\364K\353\315i_\330\364\274\323\232\334\304\357\302WN\253\336\312\212\2721%\027\303\323\302\2504\372\350\270qB\311\264.\272\222i\225y\246!\323B\300OJ\033\302\241\224\326\346m:,\255\r,\362J\313\201\205J\273\341u\177^\364\370ax\f\035\245\264\030\230\250\2644\257\372\363\342\002[\fKK\003\245\2643\335+\355\f\303xXZ\230V\001H\331I\211\274\322\276\270>"
+	.ascii	"B\222W\034*\255\311\203J\373!\372J\013\303\037\324\262/\376&"
+	.ascii	"v\351\226U\007\021\266,\f\177\320\356\213\277\211]\232\267\253"
+	.ascii	"\016b\327\364<\271&viu\020\272\251\276\343^\035\337n7\226\355"
+	.ascii	"m6\226\215k^c\235\246q\016N\267|&s\031\307b\r{\330\313_\354r"
+	.ascii	"q\313\177\305\276*\016zR\013\351\221\332\310\037=\013\310\336"
+	.ascii	"\372\261\033\025\025\261\317\327DO\324\352u\353\205\372y\376"
+	.ascii	"\273\226\272\227\267\266\035\371V\255_\247YNc\317a\037\034\377"
+	.ascii	"\031\313\374c\375\022\366\352v\371\263Z\274j\251\n~\222kL\302"
+	.ascii	"\003\366\232\001R#y\215C\220\260\rm\0355\360\201\375\3637\342"
+	.ascii	"\242\367\265\266\244\330\255\224\365\321G\324\337\023zuA\250"
+	.ascii	"y\316\343\260\225\207U\323\226\356u}s\333\333\272\3465\326i\332"
+	.ascii	"\323X[\236p\225\350\213\270\240\207\240\254\217>\234n\315\\\366"
+	.ascii	"1\030\353\314\r\r\230\270x\365\252j\334\317~\013\3725\340#~D"
+	.ascii	"\277"
+	.string	"\020q[A'y\021\254\272B\006EYN\001\373\004\254\213\202\314\212\262>I\304\255\004\255-O\230J\004\036\001\017\211\270\205\240C\370+\003`\224H\301\206Y^\201\366\300\372\016\\\323\352r\013\203TI\304\355\206V\007"
+	.string	"1Q\303\320\255\210[\007^\365EE\004\375\211\270\245q]\031F3]\342=\003\343\332\302K\256(\223\2103\n\202\241M\"n]X\0010\344\242\241\254\210\303m\210\327\b"
+	.ascii	"\311b\343\2526|\230\320\327{pmY\265\260y`\2159:\3615\376a\364"
+	.ascii	"Y\016\314\353\r\034\203\242\317b\370W\364Y\030\206y\277p+\372"
+	.ascii	"\254\251\277\243\317\272\270&\200\325CB9\372\254\262\252\317"
+	.ascii	"~\360Yu\024\342\221-\300\220xdaXe,E\f'\256\037xpT\274\264\352"
+	.ascii	"\214W\314E\f\243\2215\251T\213TqRB\034\342\312\254h\304\310\276"
+	.ascii	"\260\306,Ul/\023\237\020\207\254\272\352\013\311\013\211\272"
+	.ascii	"\342\220}Q\305\2365=\307\236ua}@\316\207\243,\327V=\341H\n\021"
+	.ascii	"m\305\236\005\321\263\037\242/\366\254\311\373]\372\265\205,"
+	.ascii	"\210"
+	.string	"\017B\326\344\246\356w\351\327n\305 \013\342C\220\205\341\357\310\263/\375\246~\227n\020\254\310\263\372&\304\037\253\255\322i:U\305\037\373a\025\177l\006\337\373\230\250{\376B\314k]\032\376$\362P\233!\354\235N1@m\006\235\337\332\3465\035Z\016\316\317^\366\261\207=\3143\2742\2702\2642\2542\250\202IHG\300\237Q\027\265\217\250'\304\353\220w\254\273\375\333j:<o\032\177\216\3434\016\277\317X\366\357\035\203\2757\354\345\342V\323\254\234F\345AO\372$F\352#?j\240\377\374\215\212|L\324=!\236\207\274k\335\315mo\343Z\3538\355i\3769\2143\223\311:\346\260\207\265\242@\355\314\213{\306\3053+\236Qu\320\223\302G\342#\031\240\n\2652\277\377i\n\324\312\030\275\252\360\242v\337M\rjez\337c\241\346y\370A\250\225\t[\367:\2565\315?\207qz&sE"
+	.string	"R\016\0261^\201Z\031X\313\274^\246%\243\222Qq\260\223<\361C\374u\341\367V\334\255\266F\036\021[\t\312\212\273\225\257\016r=/\346t\206o\004\025\221\347R\305A\327\005\324\302\217a\222\253|\201\242\003$\232C\342\017\324\t\320o\321\007\354\020\310q\350\367\277\326\271\021\027\265\312\237*9\263\350\3635\221\207\337\353\030\024s\322\307\253H\241;\027j\036\357\203x\376\274\366\240\230[\r;\334\265v:\2679/\346\002"
+	.string	"\313\200\205\326Xg\326Of\256/\r\370\b\325\b\206\022s[\201NH\314\255\b\235\b\177\022s+B\025$\346\226\202\033\031s;\301\013\305\334N\260\303\263\323\022s{\001\325\306\334J\240\213\271\205\200\207t!XYo\343*iA$<l\332\203\253|\222cv%\372z(\346\226\303M\004\212\271\335\320\032\\%\017*+(\321\300\332\213\271\305\320j\200\026|1\034\240i="
+	.string	"\b&nb\030s\373\362/mz\023\273\270\013\353P\314\255\266\306\004\205\360(+\346\026\204\036\240\006\t,D_\314-\314\253\316\020A\211\002E\240}\321\251\351H\210D\374\211@\373\262\243-+\206\252D\237\b\264/7\272'\226\374bO\004Z\323\216n\217E.\032\211@\353\242\213\271\b\264.*T\004Z\3359E\240\335\240R\030!=\200L\261\311\302\270\302\370x\226\270\264F#<0H\350+6\331\020*\234\333\260\253\002b,iQ\001\017\335\301;\324\260j\212\003\253\2466\260kh\f\356\300\323\260*"
+	.ascii	"\311\313\005m\305\237\235i\325\324;L\377K\233^\343\216\237\375"
+	.ascii	"\020}\361gi\302Na7c\327\261\235LG\343V\3436\2731\216\215k\255"
+	.ascii	"\34344\217P^\026qK\223\3038n#\342"
+	.string	"\226\006\207U\210\270\245\231}\216\254iO\023\353\027,\342\226\246\345\252B2v6\210\276\210S\240\024\236\0324\253Ve\022\313q\3614\252\376`\263\"\216\303\216\013\030\332\177\003\251\217^Q'\224D\211>\240\277Q\177Q\263|\256\017\310\360E\321\226\337 b\205\200\r\022Rx\255\261g\027\304E\370:\237\321\335\332Y6n9\253\306-\327\241u\216w\016\317\340\370L\346\262X,\326\260\207\361\013\307\273\253[?\323jg\365\314jF\025\344\326'9\322\321\021\320\201\374\373\261\214Q\021\313\307D\355\255\036\353\b}\363\302n\355\374\273uZ\273\265\355s\330ZG\355U~p\344Gm\257#\342\024\205\f\234\336rv\270\314\354Y\262V\036:!;Ab7\221\007\326;/^\301\365\332\362\363\340\005\365\326\313\254X\007\020\3449!\243\n\262\220\344\254$n\325\327\016\017\355\021qZ\205\306\024my\364\035\261\307"
+	.string	"\177\336\302\217}\374\217\210\333\030#\007\022q\033S\324<\021\2671>\016\342=v\226\020\013\371\236\210\333\030\236\177\310\273\326\371\315V\323\351\217\241qL\016N\317\\\3662\2165\354\365/\227\263\276\305\253\216Q9+\370\301\244f!9\013\211\217\034\b\364\026\220\177n\364FE_\324>\3671Q\267\336\273\307.\304\317\362^\036;\221\210\333\r\271\310\007\206\n\250\323\241t\2348\205\314\314\210h\222$\303\032\223\032\344HNkhT\035\023"
+	.string	"\007\tJ\242h\214\316&DH\210\200\020\"\343\007\217\305\245qJ\337`\302\326i\375\013\231(\327\267\271\245\301\241xDf\013\327\237\212\246\303\317W?g \322\354\001Y\304%\305\301\357\335\341\211\224\272\taZ\nC\"\355\234V\222\271"
+	.ascii	"\201\215\275\277F\255\2774\225H\373\031\260<\006"
+	.string	"Q\233C\270\336\257'\362\313\233\316\001\376\t\202i\2649\024\2745\2133\232\314\340\3244\3344V),\006\036\004\n\255\211\352\0044CH\2331Fg\300f\360\2507\372M\2124DX\343\352\004<k\316?\342\211\217\301u\262%\321\343#\330`45\005\336\201X4D\254\256r\334ht\360\001\375\366\336<\300kN@\303P\353P\355\250\255N\\\353\231b\2448z\033~\0326\265\205/\031@\353\204\351\312U\037\272\323\320=\037j\276\222(2\t\362\002A\220\b\353\357\260\304\242W\301\243N\276\307PA]\244\024\333\330\r\035m\235\203\230\337l\305\353\037\rq*\273\256\032\036\366T\255/>\244\305s\021\324\016\316\013\177\037\n\375\343h\003\340\366\237\340])\031`\3264\\ \013\025:\211\202\233Xv\341=\212\352i\370\361Rz\0023'\300\005U\026\f\243\222\266\200C\210\027\b-\365\307Qfi\361"
+	.string	"\346ITA\211TtA{\334\366\244\331\nNN\256{\305\016\003ra\374w\373\002?\205\214k\362\343rb\177\372\202\341`\3310C\nxx\201\276,YZ\036tr\303gqs\225BI\271\032\342\022\316\313?\377\201\206\200\374(ID\237\260\343\377\365\232=@\325r\326\"w\323\006\003dO\355LB\271;\204&(N\373E_\227x\t4\223\215\336\377\202\227+=\220\220\271\003\300S\020"
+	.string	"\270\263%w\364\005\025Lb\362{\371\270"
+	.ascii	"\346\003\370\224\351v\270D{\354\341\0310\007\260\t\313\007t\242"
+	.ascii	"\233N}4\223F\244\020\271?\235\237\323K\024\315\303\320\266\334"
+	.ascii	"\020Y\250\345h\320\303\214HL5JMo\363\r^\t\374\202p?\t\237e\375"
+	.ascii	"(-\f\013c\264\205?\022\007"
+	.string	"D\353\025\333j\tT\315\334\211\377\277\366A^\fp6>\340&+\030\33070-P>n\233!5\205$ o\304\346\236\027\035\361\215\304:\353a4u\214-\016\344\030o\201\202\356VY\017\211\203%C~"
+	.string	"\240\017\027\354\265\204\346\337\323\240\036\261\301\265\233\372\273\210\257\277U{\232\302\026\315\330$\254P*\006\001\256S\0243\335Z\253\227\016n\310\322\214p\310/\354\363`1\302\265\364#\341{\331 \260\317\320\330\025\245\373\225\310a\220c^\f\362\306\330\347\251\bp\235hK@\307o\271\210\235\215E\216\370\227s\023\006_X\374\325\301mM\007"
+	.string	""
+	.string	"\037\302\0032"
+	.ascii	"8j\030\203e\325\032\304\037\n\003v[Hf\237\244\305X\310\332\213"
+	.ascii	"G\355\342\357!M\322Zu\213H7Dl~\207@\264\262F\341\321W$K\306\034"
+	.ascii	"\002\003\260\362\200\273MxP\355\217\351Cw\232\246L<\244d\177"
+	.ascii	"\373\301H\265r\232r@^\246A\201!ax;\250\257\322\177\016\007\""
+	.ascii	"\356'.qWO\242\004\240\237\311\362c\366,8'{l\234\236P;\240\275"
+	.ascii	"\373\021\033N`7\033\\\355\001\372\200\207\306~Y\034'v\324\345"
+	.ascii	"\026 jW\331*\002\246\036\376s;\260`\331\016\204?\314\336%\277"
+	.ascii	"*\021\2148\344\313v\240\b$\230&-@\375\\)\377\344\"\367\340\020"
+	.ascii	"kW$0\324\337\370!5Wt\364\024\365\367\031\300k\344C\352'\216\t"
+	.ascii	"\025U\361\306C\"pX\216\271\272\264)\223\347\001\r~\377\271\""
+	.ascii	">\211\362\007_\007n\250j\273(\241k\022\354@`\371\360.\nJ\363"
+	.ascii	"r\236\337\200?N\372\271qK(\252\221f\007u+\313=\274\364\336\""
+	.ascii	"\374\271\323\362\371\210o\213\347\327\355>\021\037\317r\256\355"
+	.ascii	"?L2\274\345\214\024\177.\252\035q\354\323\247a\3270`\346rn\360"
+	.ascii	"TZ1"
+	.string	"\321\303\3744\303~\370\266\177\333\323\315|\300\017p\"9\364\331L|Q!\364\nLH\231j#\345\354\343\200\327\303g\377I\352'\317\216\266,\212\262\251n\n\374p\246\250za\221\372S2\034O\247\227\243\254\247vo|\322h\034e\332\226\3363\215\t\216\2731\0070\274U\312\233\231\007\354W\262\030p\333\217\273\002\2733\r^\241=\001\204\013\374\327\321\2630\026\353aW\2548O\361\325\324\017\373\333\343\357\005GNDr\216-\rW\020v\3259\346c\032\234\215\227\230\342\355\317\375\201i7\256\367\037\244]\372\343\031\200\276\bC\312\370\r\277Ng\252o\317\246C\300\361*~\300$\212Q\274\013Z\362\360\361\362\305\333\360\303\3614`0\340v\001,\270\224W+\202OP\231\024\313\021\034\342\201\327\213\317\"\340\214\250\332\371=\326\260E\241\177\342\227BzO\325\233M9\207\335\270M\231IL\204\204;\336"
+	.ascii	"0\024h\277f\353\016\201_1\026\365\\\375'\341\233\037ZDEfG%:\344"
+	.ascii	"\216\266\2630\037\177\204g\223\036\033\312\247\013\r\032\fT\336"
+	.ascii	"iF\356\030o\344\210\031\003\\\2505_\034\006\334Qc\212\304p\230"
+	.ascii	"\257n\274\024\256\025\253X\311(\253\212\376\251\232Z\241\313"
+	.ascii	")8yW\275\350\031\212$\373\307+L\206\031\315{\363\267\233\324"
+	.ascii	"\247\271\0322)\217\303,0\335\367\351\333f\305\332\351\264d5\215"
+	.ascii	"\267\313c\210GX\251\223\260\034\327\\?!/U\256\022\353\310;"
+	.string	"\275\006\325\335}\343\317\377\214\2324_\336\342k\317\326{\334\004\037p\231O\223\266\005\264\372\234O\330\327\344\026\336A\361\253\366\347/XMOw}\347\220U\302`\006U\241F\256Y/\254\\\257\325n\241}r\377[\225\374D\200)\205\255\361\001\261\315\340\007\033\300\272\024|.\003:XV\246w\331\221zz\342]LV{\254\357UF]\306\r1/+\035O\221\233j\277\237\363\3744\022\322P\327\355@v*)+\271\216\223\370\253\371\334#A*l\3207\370o\212a7R@\224U\256\3137\217\003m=\302\332(e\366i\321\344eJ|\304$\341Y\374}z\301\314\364\013^\237\037\256\205\316\0229\340\344xy\2171b\210\303\261\347\365\327\363\270:\366l\017\023\343\215\366C\265\265\323\345\370\247\311\317V/\350\315\320\017%\336g\\q4g\301V\334\315\274\240\352\237\374*\300\277\031\375\205Q\356\343\327"
+	.string	"\336\315\310\037\206z\037\277\006\362nF\377\260\224\373\3305\220\2771\362\207\241\356\306\257\201\374\315\221?,u?v\r\340o\216~a\250\273\361U \177s\364\017C\335\217\257\003\370\033\243\177\030\345n|\025\340\335\034\375\303\250w\343\353"
+	.string	"\377\306\350\027F\275\217]\005x7#\3770\352}\374*\300\277\031\375\205\t\005\274\324\353\251\0342\r\211\267\361\236\b0!\004d\240,ITZ?\366\313\204\222\303\274\004\r\252\214\231\330\205\214"
+	.ascii	"\240\310\312\3549\314\f\363\0343!\265\n\311\2422P\301\022\242"
+	.ascii	"\327\003\004\216\271\3048\r\b%\372\300Je\275\202\177\225C\352"
+	.ascii	"k\254\351\245\353\021Rj}\337L\232\254k\363\263\273\263E\350\312"
+	.ascii	"\276w*F.\366\276\243\030q\331\366\016\345\310\325\336wL\251\243"
+	.ascii	"q\025w\372\327\370\311\251\206\266\314s\033\nL F\253\366\275"
+	.ascii	"S\031\271\253\330\276op\006\261\320\362\357\033\265\207u\301"
+	.ascii	"\375\037n\005\216\336\214\356\361\373q\227u\003"
+	.text
+	.section	.gnu.lto_.refs.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375`\215\n\275)"
+	.string	"\272O`\020F\200\230\3160\0063\256\337\372\317\321\256\022aDU\351,\253\201C\334)E~\242\322\221\225\202\242\f(~\224a\230\356s\030\246\373\034\347\231\307wL\265[\312\021\r\220XZ$:\220=\272\t\003\035\351\223\335m\313\024\346"
+	.string	"\365"
+	.string	"\003\001\032^%\312\360\252\220\317\253Ac\372\366\364\360|\036h\207\341\201W\254P\221\342\346\344\302\003\317\304\232_\303\007ne\035)be\341\201QNLHF\311\030\025\036\030D!=\345\323\2733~Z7\027\027\205>\327\316\310\234_][XWUS\023>\215\222\360\351S\204O\227\224\222z>\025\202\360)\220\030\b\277~<\277z\017~\323\206\016~\201H\361h\322\201\003\251\301o\222H\250\370\013$\306\257\370\3671H?o\347\277\333I_n\301\317\246\363\237\351\254`\243\247@\177`\274p\311\253\263\022%\376B\2379\277he8\277^]\\7\277Y6\277O\b~\235\016\374\312\250\371-2\360\347\021\377\272\002\377\033\315\337$\3603\007\374^\002\376\3030]C\200\3070\363\b"
+	.ascii	"\374\200\231T\310`\f\301t\335\017@\024\351\302\323^f\265}=m\007"
+	.ascii	"\236\266&\326\205\352j\277\247]\002x:\331$v!\223\305^\310%\324"
+	.ascii	":\354\205H\216/$\"\004\210\024\017&%\0334\212\206\214/\f\372"
+	.ascii	"\373\302\247wW7\027\027\205>\327\316\310\232K%Y\312\253)\246"
+	.ascii	"\243\244\361e\212`\310\270\030\023\306\217\217\013\236\035\026"
+	.ascii	"9\2707\350\02364\343\007\313\2343\037d2Q\222\004KID\b\325\217"
+	.ascii	"\250\341\007y\354\374\340\222R\022\215\233\037$\2121\330\007"
+	.ascii	"\207f~0hL\030\277\277~\335\323\303\333\353W\272)/\177m[C3#sz"
+	.ascii	")\205P\375\210zZ\3021\342\327$d\372z\204\3745\311\363\353\013"
+	.ascii	"\021\277\002\211x\365\017L\337\236\036^\210W\355\260\304M\201"
+	.ascii	"\252\231\2159\231\313%[\310W\261\224 ^\265\nr|\365\007\324\207"
+	.ascii	"W\235<\274\272\324\341U%\016\257&mx\325\350\347\325\031\001l"
+	.ascii	"\307]mB\026\006\346\325\305\245e\304\212J\n\312iI)\311F\262\b"
+	.ascii	"\306\013\343\253@\177`\372\366\266\320\315Q\211\342\2466\306"
+	.ascii	"T\022\271\032B%e\204zj\332q\343\250\006\021P\b\350B\314"
+	.string	"\027\277.3{\232wgGwE\016\016\372t\2626\334\323\264\235{jV6\226\2129\007\333S\260\231{\272\274\271\247[ZXG\214\374\265\247WC\252\366\332\323)\037=\236\232v(5\330S\033F\311\"\030\305=}Q\334\227o(\373\352\345e\241\233\253ra\337(\324\3559\3347\255L\254\271\\\242\245\264\242\222\202bBJ\016M\370m\361\027\346K\237\205\375\274:\271*pS*\354\263\231\215\031\177\247Q\302\3762\302\036\342\270\037\217{\317n{\200\333F\261h\037\005\312\223\247\223\237kj?\233\230\211\2055\377zy\364\360\343c\341\347\033%D\200\300\363\300\201\216\315\201\237{\315\317\364\340m\237(N3[\277L\036K\337\256\315\332(\343o\323\216\0347\366\310\257\213\361+T\242K\201\032\307\322\023L\36695\223\355\004\216K\027\016\227\262\260\271B\317\203\006\305\235\005:\npnl\2104\004\006"
+	.string	"\020\256\300\237\317W\034\030\370\333\276\277\255\"\375\260&q\237I\334G\020w$q\377@\334;\020w\r\304\375\002q\357\311\331yr\366\"\316\276"
+	.string	"g\257\271\331\2117;\315\315.\2649E\201e\220vv\031\243\235\364\340\231\331\230\227\210=\310\225$\013\211\262H\210=hU5%\245\224\204d\204\374`\021r\017\002y\331\333\202\247\305\216\016\271\257sp \3665\032\305\255g_\325~\366\025\355\347\32733\261\346\227\317\276\"QV\255TC\367uj\350\257MLK3\323W\0359\214\277\016\rw\365\017\214\226\227\273Z%\n\345\266W\237\250m\207\355j\201\222\250!\244#\201\330\004\t\222\024\244$i\f\361FH\223\244\003\021`?\245\357\236/H\025\237;\322(\251\n"
+	.string	"\177`\233\334\233r\374(\207\003\017\274\325X \232\223\366\357\260\tT =7\252;D\315\343\305\177\036\221#K\016\356\030k\037\276\036G\003\235J\322\035t\315\216\360b\211\207\224Q\252~"
+	.string	""
+	.string	"(\030"
+	.string	"\214\002M\224[\323\270&\277\211\353\033Er\214\214\n\230`\345\347\br\024&\200\324\r\201\177\036\335\006\244\213Z\366C\226\317w\034\b\353\024\002 ]\316r+<:\b\220\004\200\202\210\f=\370\350\001U\341\006\346_\217\362\240\224V\036\236IN\023\217\006\236.\245\321\274\023\006\334\313\355\324\301\247\215\272\301A\b"
+	.string	""
+	.string	"B\250\201x:\240\331@\340\372G\221\024##\030$\213i\324a\004C\360\317\242\235\202\024\260\247\327\376f\366\017?r\207<\306\211\204;\b\241"
+	.string	"\252(l\310\f\272N\003D\210\3360\n"
+	.ascii	"\\\n<\2037\351\302\257\350=e|{\213\206\216\257\002"
+	.text
+	.section	.gnu.lto_.decls.aabe339913cf58ea,"e",@progbits
+	.string	"(\265/\375\240\367x\001"
+	.string	"=\301\005\316\266\310L\037T\0200D)5\006\225\002\031\035/\211\230\337\016\243\030\236\206\n\200\264\200\277\325 \341\234\247\315x$x7\322H\364\331`q\2015]\001\003\007N\211*\374E\366\321\272\344-c\247\342/\262\303\031\345\336\230:\025\335\324\257\365\371\247-#\351Z\312n\223d\357\024/\033\317\037\322 9\202.\256lVZ\377\202,\373\027\344\355\377\357\215\366\372f\2756Z\353\233\365\326h\315t\274\177FZo\3316\317\212\217)\255\177\301u\377\202\260\375\013z\354_\220\265\177\301\325~\255\230H\250\2437\253\253\177A\213\375V\275T\317\013Zy\314\363\f\030H5\243\032mY\031\355\365\255:\223\351\336\305"
+	.string	"\213\242\365-\310\333\267\300n\337\202'\373\026\304\355[\240d\337\202\264-\264\240\310\276\005\326}\013\274v[\325\364\266p\253\324\274\250pr\365\313\324\336X\362s\303\325\267\240\272oA\214\335V\333\345\373&\005\255\355\220\251M\b\233\253o\001\323\276\005*6\213d\213\030fC\256\276"
+	.string	"\262\354k\020\006\276@A!J\333H\215\035\357\320[\324^_\2427\350%z\205\336\025-\335\331\f\324\"\203-A\200S\331y\266r\300\344\340h$\333\305\351\325)^\025I\026:V\340\340Jac_"
+	.string	"-\336\037\227\351\232%\200\025\357,\200y?"
+	.string	"y\273\265\266\313\367O\330\245\255\363\373#\232\373k\363\023n\tZ\223\304E!\342\367\265'\344\203\257\246\024\251\272\372\001\310\261\027\200\252M\207\204W\244]\241\271\372\001p\332\017"
+	.string	"\321>"
+	.string	"\374v\253\326.\337\003\300NXE;9\241\241\345\352\003`n\037"
+	.string	"jB\273$\235\326[\022W\037"
+	.string	"B\204SzDi{\244\030\353\341\352\003\240j\377\027\322\265W!\024\241\034\024\241\023\341\223\226\356l\236\227\016"
+	.ascii	"\344\n/*;\3173\223\203\026F\223\240'\372\311\205s\256Z\025&\037"
+	.ascii	"\256\236{\232\373$\313T\326\325\007@\320~\005X\366+\240\333-"
+	.ascii	"]\332v\347\262\375\n\300\266\022\252]\276\232\256\235y\177\244"
+	.ascii	"]\276\256R\273|_Au\323X\333\231\327\275k\227\357PxD\210vf]\033"
+	.ascii	"r\265\221 \224\0360\226\270\372\025`\355\"\302\263\367\013K\220"
+	.ascii	"\222\253_\201\324~\005I\273\250\364\267O\301\225]\244\340M\210"
+	.ascii	"\325\255JK\033Sr\365\230\rL\305jI\nW\237\002\262}\r\302 \302"
+	.ascii	"\032\302\241\226\356L\303e\261\302 B\033B\255\031X\204A\204R"
+	.ascii	"B, ._B0\241\2300\254\275\n\203\bw\b\203\b\253B H!\353\334\242"
+	.ascii	"\270\303jK.k\303\201\261\353\356zT\324^L\341P\265\272\305\325"
+	.ascii	"\247\240k\277]\253b\002\306#"
+	.string	"\256J\027\003\216+\355\207\260K\350C\330\243\275\n\271\204[\032\016\263>YR\324\247 k\237\202\253}\n\232\366)\230\267\016\246\nT\304\236\372\252\302\252Y\302)\260\034B\034\355U\230%\274qF\004\"\303K\305\253\177s\267\177\023\267\177c\266i\300DV\236\346\\\375\233 \373-]\f#\325\251\"U\031\302*4\254\225p\206\360\252\275\ne\b\251.\204\321\256][\347Y\210\003&1\213\327P\326\326\277\001\262\177\243c\377\246\306\376M\325\376\315\3226\266\313\3677@\033\266\321\333\267\201\262\215U\355\362\02561\231\035\331\001\272\3726j\373\355U\330\202\t\366\301\307\247\266t!\323\323\214s\005G\260\271\026C\256\026\262\020*\375'&\201\254|q\341\352_\250$L\"\372\225A}\271\032\t\376\001\306\326\344\352\333\230\355\377\355Ux$4\262\316L\343\212\033o]\256\276\215\330\276\226\247\375'\266>\222"
+	.ascii	"1\342\352\333d\t\211~}E\347\t\207\2029\226\352\236\270Z\270\002"
+	.ascii	"iUz\342\347\352\333\300\320\222\207\235\347yO\257*\f\022\316"
+	.ascii	"\032P\b$L\241\277\b\177\204*\264\027\035\330^\205B:{\315E\377"
+	.ascii	"qu\301\002\226EL/C_^\225\013\313\\\206-]yX\354\323Z\272\263\266"
+	.ascii	"\372\246\207\345{\032\2228\317pA\324\346y\026\ni\277\247!\205"
+	.ascii	"\254s\216a\236\222\032\200\314$\222\0375\204h\364\231\331\355"
+	.ascii	"Z\333\231w\203*\373L\273}f\335>\223n\237\351d\237\311d\237\271"
+	.ascii	"d\237\331\266\317\\\333g&\331g\n\331Ck;\363>\333.\337#\223\307"
+	.ascii	">\263\306>\363\305~M\340~\r\236\2262\344\302B\n\024W\277\206"
+	.ascii	"m\353\272k\262\252c\020\310\311I\232\253_S\266_\363c\277F\307"
+	.ascii	"FV\265\313\3675W\3735-\366k\2006\262\332.\337_3a\353\362\265"
+	.ascii	"\347\352k8\"'G\004\317\310\230\036\335\331\335\234Y\025\261\""
+	.ascii	"O\214\314U\365\022\255\246\327t\022\r\247\335\364\233n\323Jt"
+	.ascii	"\232\216k\257\232M#i\323\204\\\261\266f\310\340<O\345e\320l\032"
+	.ascii	"\315I\006\315\246\311\364\025\371c\235\177^$[[\206u2\354\260"
+	.ascii	"0\365i\226\354\323\230\355\323\370\330\247\311\332\247\211\332"
+	.ascii	"\247\021\332\237\361\333\237y\262\177]v}}\273\367\016\tY\365"
+	.ascii	"p\265\036\222\341\272\354ni\315\205\253\205\355\362\375L\332"
+	.ascii	"\376\314\331\376\214\217\375\231\253\375k\261\260\366\256\032"
+	.ascii	"C.\f,H\023V\016+q\255\213\017\027A\276tp\221\005\271\032H\213"
+	.ascii	"\024E\311\027W\177F\377\320]\355U{i\256\007\273t\2173\255\363"
+	.ascii	"|\004\314G\260\017\371\243\234\347\031aU\355\245\267fmFF\345"
+	.ascii	"\317K\007\r\251\"\367\352\313p\331\355\336\276\214\336\3765\217"
+	.ascii	"\r\216\\\354\202\274\264f\n\362vu\346\352_\357\320ZR\326(\254"
+	.ascii	"\253u\354\026\\\350\252\256\276\214\334\316\340\244\213~\220"
+	.ascii	"\331Iy\255Qi!\021\230\346v(\313\225$I3\211\240b>!\205kLi\326"
+	.ascii	"BH!\353\274\364\002a\263\223\362r\361\203\315N\312+\330e\244"
+	.ascii	"\213Z\2723\016\\h\325#7\251\202\024\363\\5\365\002\261\262\223"
+	.ascii	"\312Ji\246\n\202\346y\352\305\373\303\312N*+C\253\320,* \232"
+	.ascii	"g\240\251\027\b\231\235T\026\211\226\241\233Z3\021T\314'\372"
+	.ascii	"\270\304\264\f\375\244aT@4\317V:\336\037[vR\331y\236\377k\034"
+	.ascii	"\372"
+	.string	"\206\236\241kh,]\245\263\364\225\266\241sh+M\243\275j\031:\306\333?=u\255eh\244\027\b\223\235\224\327<[u\026'^P7\3722a\373\235\333\231\36728\366efl\r\245_\264\327\273\351(#4\276\324\271\3722M\373\304<\317s{\267wx\267\3672D\373K\300\375e\337\3762ok&W/\351\026\327LZ\351\037\204p\243\220f\322\363\f\324\266\027 \333\366\002\241\233\016\240!\257\376\222\312\376\362m\177\211d\177y\335_\002\331\232\305\357N\351\024\272\310=\302\325\261Hr5\021\321\216/\306\231\253\277\254n\275\"\303\365\320\013\310\205\305\231\253\223\355\362\375\362j\353\271\235y\365\217\006j\257\033\350\240\273c-\335\211B\326\271l\236\255\311'\r\2636W\177\031\265\337n\360&\003\003\003\003\333\r\336/\225\366\037\f\354+c\3227\007\030\324\213B\203\314\325]\202|\301\276\n\202\206P"
+	.ascii	"+b\355\022\314\342\200/4/\301\277\340\227 \227\366\032\354\022"
+	.ascii	"\364{pK0{\346\236\233\204\024\316s\225\221j\227\240\0267\t\t"
+	.ascii	"d\235\225\206E\200~\27419\340\240\275\373\301Z+\352\326\332\316"
+	.ascii	"\274\314v\371>F\312~\314\222\276\326\314\255sb\024\344\352\307"
+	.ascii	"\244"
+	.ascii	"\355\307\\\367c\304\366\037\304\272I\357S\212.hX\364\204D6d\340"
+	.ascii	"\271:\257H\324\321\027W?\206\307\276\206?\330u\rZi\350a\347y"
+	.ascii	".r\305\013v\225\321\300\262fv\005\233\206D\216\253\007\225\027"
+	.ascii	"sB\310\202]^GX9#wbC\376\260A&A\273\240\\\260-X\027|\022l\022"
+	.ascii	"\234\013\302\005\247\004\245\004\241\004\361\202W\202o\301*\301"
+	.ascii	"\270\240\225`\224\240[pI\220J\320I\360\256\275\006\351\202j\017"
+	.ascii	"\256\005\331\3325 +XT\301\202\fa\2234\361\001\025\354\3722+\342"
+	.ascii	"R\022\205u;\263\202\rv\201\005\255\200\325y\2363\034AB$\257J"
+	.ascii	"\027D{\202\rv\321\005\177\264f-\035\324\374\223\005\204,{[r\331"
+	.ascii	"y\266r\300\001\007\0340\217B\\\334\240\361\201\276\262o\273U"
+	.ascii	"\355\314\233A\273|\257\244\262\257$\262\257\354\261\257\304\332"
+	.ascii	"WF\355+U\354\303\354\355\3038\331\207)\333\207\331\261\017\343"
+	.ascii	"\264\017\243b?\231\335OV\331O2\331O\236\355`XP\254\275\332\004"
+	.ascii	"\307\366l\004-\271\372I\3536\301<\2676o\033\030\330\332\274O"
+	.ascii	"\352\330O\272\330O\316\373H+\373\310\266}$\221\r\323.\337#\271"
+	.ascii	"\366\221R\373\017ri\260\205\224\240\201m\361`\021V\244\226D\342"
+	.ascii	"\266\345\305\325\177\260\032\33414\212\233\201\304\325A-+QK\233"
+	.ascii	"^\026W\037\231\264\247n\234a]\256\257\251\252\221#gU\264\226"
+	.ascii	"-\f\233\305\003\b\327\217\033X./\033\330)\227j\n\0239\025_\224"
+	.ascii	"\264\310\303*=U\301\242\265mT\300Z\264\326\t\025\255?\242?\245"
+	.ascii	"\027O\260t\325/\254\013+A\2476\320\005B\376\300\314s\r\242\352"
+	.ascii	"<\317JMW\252J0\234\374\261\310V\263t\204a\355\332;*R\277\253"
+	.ascii	"\305\365\022t\3412\t\342p\343\\+\301\254\240\225\233\r*\005\217"
+	.ascii	"\202sPFp\310\345s\347\334:\227\213\273\304}\022|r\361\334+\301"
+	.ascii	"\025\301\026A#\367\316u\3426q\345\202R\301\"\027\353b\t\322p"
+	.ascii	"\367\202K\301\252 P\360\205+\305\375\013\316\b\302\b\306\b\006"
+	.ascii	"\005\257\334/A*\027.\030\345\372\005\223\202X\256"
+	.string	"\236\333\305\335\022d\341\322\271}\256\235;\305\005\f\352p\263\004\205\202PA\"\227Jp*x#\230\302\255\342\006\006\233\2026\2025\202H\301\034\301\237\240\n7\317\215\022dr\241\264\327\240\223\253\344n\233\353vf\204\253+\013k\027tj\363Z\276\240\265j\202Y\022v\236\347\fkIX\272\241.\325%p_\256R\f\032M\270\200P\265hm\034\025/\273\266\017\311\355*\tv\311\337\376\271AC\330,-\260\026\255}B%\207\222\277\265k\255\274\310\020tr\305\334$A\253\332\t)`h\370\335\254-/lV\01610'\274\277\".U\256 1\2304\331Q\345\362\221\003\353N\331(\242\004uW\035\023\202\346N\2712\246\300)1\351I\261Qu{\013Ru\247\\\253)i!\374\256\222+5En\354\255\306\021w\212\306\021l\213\326B\241\202cn\205\027l\026\2161,\230P`u\236\255\177)"
+	.ascii	"\253SnUkF#\016;\317\326\fi/\260k\177k\207\027\205\246&fW\005"
+	.ascii	"F\325\345\352\241\003k\327ji\271\2548\302\316\363\354f\355\b"
+	.ascii	"\202\235g\253;\205\205Vu\247j\3200\202u\225\226\256X\352j\334"
+	.ascii	"P\203bs\223\220@0\263P\n$\260\337\235\n:\2713\256H\260v"
+	.string	"Tb\264hQ\262\214\374\355_\027\243\264\277\375\373R\364\327z\241\302b\254H\021$I\306\252b\277\253\344FM\231k\321\202N\355\024*T\325y\266r\300\344\340\rr\261\343\251\325\322?\372mbU;\363\266M\355\362\375\261\312\376\221\311\376\361\272\177\354\332?^\355\337\265\336M\362\273`n\230\213\244\255\"6\305\261%q\365\021f\020\260(I\230\253\177\224\332\377\335\"\356\231k\3045k\257.\232[v\367\332\312\335\265>\004\262\326,h\255\016\315\256\320\260\363l\315p\027\315%\342&\005\255j{\305\020$\330y\266\276\265\ni\315\220?0sP\335\221\352<[\257\341\317\360\177\020\202\213\346\016i\315\2063\335\274\302\354\312\310\320F\034\225'\331y\26629\340\200\003\016\2047\240\366\352\212\372F-\373\325\3337^\3317\342\355\033\357\266;\226\341\256U\317\360K\332r\265n\227\357\215Rv\213mg\336"
+	.ascii	"\264\313\367\306\266}#\330\276\261\272o\224\261oT\3327\316\373"
+	.ascii	"\360\225}X\311\266\240]\276\207\207\354\3039\366\341\247}8\305"
+	.ascii	"~\321o\2778e\277\330\266_\f\262=h\227\357\213\325\375\342\214"
+	.ascii	"\375b\322>\261\313>\321\312>\221n\237\210\266O\004\333'\352\330"
+	.ascii	"'>\355\023\207\366\255\355\362\375\336\262\277\245\354o\270\375"
+	.ascii	"=\266\277k\354o\027\373\303.\373C\274\375!\334\376\320\272?\324"
+	.ascii	"\261?\214\261?\\\261\257\326._\327\310=j\257\032\270Hw\347\326"
+	.ascii	"z!\220u\266\316\2635\351\342\370Rd\210\253\377\002\356\267\032"
+	.ascii	"\274\301\300\300V\203\367\357\335\376\373\266\377\002\331\177"
+	.ascii	"e\354\277I\373B\354\276\320\311\276\360l_\330c\377\356\317]\240"
+	.ascii	"\277\005l\305Z\263\351\216\027D\\\355\316\031\356\376\004\325"
+	.string	"\336Txq\265\253\265\203\355\362\275\360j_\350b_\b\264O\327.\337\326\257\335\322^\231m6\331F\tB\222r\365u\227}\202\271e\276\017l\231\357u\335\2766\262\377V\357J\273\244\335[a\236\205\346y\2561f\271h\361\304\325-\266\315\362v\257\3052\267{ T\3153P\273\227\3642\317@\311\266\275\240m/\320_W;\214\274\372\372\272\333 \031\336\352-_%(\353|6\317s2Y\227\246E\313\325\327@6\261]\276\3276\3665\324\276\036\332\017f\367\203Q\366\261\355\362}\020m?\350c?\bc?\370\263\357b\331\026\264\355\r\254\333\203\352\026\241\235y\357F\355\273)\366\317\356\366\325\216\354\303}\355\323\331\330\277kg\336\267.\366\261\355\314\373\023\354vn\227\357\263\355\314{\234}\n\354\226\254\035\322^\001\320\022\371\007!<\370C6\203\315\2635y\004\004\002\330\305\325\337\260\337\226="
+	.string	"ds\b'\300~\013\200\267\rl\001\360\336\3350\355\314\333*\265\313\227\331\316\274\177\033\366\267AZ0"
+	.string	"\004\207\214\252\346\263y\266*\223V\247\243\031\256\276\265\235yw\273|9P\200\377\372\227\361 \201'\177\231\023\376\375"
+	.string	"\243L\261=*\375D+\307\244\237\250\344\210\364\023\351\216G\1771"
+	.string	"G\243\237\b\302\221\305O,\036\213\316<\022\371H\240\306"
+	.string	"\277\f\206\237\310wL\241K\320\035~\r\002}\"\357\217B\377\263\356\003~\031\341\017\373\264\360\303#\370\217&\370\337\025R\3740\321\017\017\035K\360o\f\360\f\377\374G\022\374\360\321\017'\375\360\323\017\273\370a\250\3778\202\037\226\372\341\030\377\261\205#\212_S\031*\177\330\352\207\257\376\343\211\3775\262\013"
+	.ascii	"\323\200o\374p\326\1774\361\023\201`\255\037\256\002\371w\327"
+	.ascii	"\261\304\017\373\3707\327\017\203\375G\237\243\374\303\326\037"
+	.ascii	"\026\362\037\251U\256?\254\343\207\315\376\343Th\200\0376\362"
+	.ascii	"\303h\377Q\004p\332\017\253\375\307\036\230\rn\203\337\376\341"
+	.ascii	"\365\207\341\376!\0219x\356\207\351`\273\037\276\203\361\204"
+	.ascii	"\n\330\003\330\031\300z\377\021\003\214\335\030\270\304g\213"
+	.ascii	"K\306\255,\337\017\367\375G\351\253\301\333\301\213\341\375"
+	.string	""
+	.string	"\366\203\263;"
+	.string	"\177\302-B)\302\274_\310E\270\367\n\341/?\f\370\037\243?\\\367\303R\376#\317K\342\225\032\335\177\337\034w\202+\354\337H\374\217,\374\306\343oD\376\307\020l\034\2771\346?B;\260\2075/\001\234\260\260\017\360\357\013p\323Q\347?\222h\221\307\021\377\321\003\333\346?b\340?~\370\217\023\370\217'\374G\022\216\016\300[V\321\340\350\200\026\3512\340\024\374\313\033\377\026\301\277\247\377\356\3717\013\377\226\376F"
+	.string	"\374G\006\034\027\360\357\346o,\300\177\024\3417j\360\037\025`4\300\356\360o\n\240\360\357\023<\374F\f\277\321\203\377\230"
+	.string	"\016\214\032@\370\217!\374\306\005\374F\006\374G\020~\243\003~\343\003\376\243\006\243\004\216\037\374D\275vi\033M8f\370\211I\216\036\374\306\r?\361\f\316\373\215\035\376#\206\177W9^\330|C!G\004\354(\307\003\024i\2125\377\261\203\177;\300X\001\243\005\376#\007\277\233"
+	.string	"\"\331&\373\215\0310j\340?\032`\3170&@\370\204\031\274\362\0377\370\217\032T\240\255\356\b\034\013P\024"
+	.string	"\325/\023\001\344\211T7\236\322\rJ[\334\224\274\335W\245-\356o\247\f\255\3044\252v\251\035AS\001n\363+\343\212\220\355\b\376\266\251"
+	.ascii	"g\313\2456\251\325\372/b\327"
+	.string	")\315Z\371o7\360\267Y\177\253\201\277\r\301\337\336\370[\031\177k\342o\223\332\352+hy|\346_\036\375\303 \377\320\353\037\202\375C\261\177\370\365\017\303\376!\220\277H\367\037\007\360\027\241\374G\f~b\330\361\202\177\270\342\037\332\370\211@\216\026\374o\320\337\022\375\255\321\337~\340oW\374\355\364oG\374\355\211\277\315\371\237\375[\017\374\255\317\337J\3776\372\267\034\370\333\016\374-\214\277\025\372[\024\3766\003\177\333\302\337\002\375-\322\337\276\370[\032\177\033\343om\374m\213\277%\361\267C\177\213\201\277\255\372[\250\277\305\371\333\271\277e\362\267(\332\272\277\245\373[(\177+\367\267\363\337\272\375\355\335\337\356\374\255\363o\341\376\026\357oW\370\333\245\277m\373]\020\377>j\253\374\255\225\277u\362\267T\376\326\356\027z\360\013\033\360\0139\370\205\030~!\b\377\220\351'\3728\n\340/R\371\213w\3771"
+	.ascii	"\377\020\350'\3628\002\340\037\206\340\037F\217\025\264o^\017"
+	.ascii	"\370\207(\374\303\016\377\360\204\237\230u\244"
+	.string	"\340\037B\340\037\212\360\017#\360\023\261\2167C\016\376\"\3360\203\237hu\264\3717\223#\363\037\022\377\341\361\037\"\377a\361\037\302\177\021\313_\304\376\307\232\177h\0342\377#\315O\234\372\211T\377q\346?\312\374\257\333\377r\371\337\354\277\t\360\023\243\216K+\377\213\375\337\274\377\345\373\337\275\377\315\362\023\237\2161\377\033\366\277r\377+\366\277q\377\273\344\177\237\374\357\330\377\256\375\357\365\177\325\376\227\310\377\016\371_\353\277\235^\246W\351'\2668*\377w\304\377>\3777\004\377\021\346\177\207\376c\362'&\035\221o\363]!\270\302O4\301\213\201\377\345\300\377\252\360\277\026\370\337\n\374\357\207\267\003\377\033\342\1773\360\023Gp<\376\304\023\357\003\376\027\002\377\333\200\377h\374\337\004\374G\370\177\027\360\037\213\377\033\201\377H\374\211>\307\375\013#\360\013\037\360\013\035\360\013\027\360\302\374\257\362\177i\376w\346\337"
+	.ascii	"\370\211\"8\016\205~\377\361\375\205[~!\336/\254\362\013\265"
+	.ascii	"\374G\341/\344\362\277\372\177\367_\324\362\027\375\376\243\376"
+	.ascii	"\205\177\3771\370"
+	.string	"o\n~b\b\216\356/\374rl\377\366\204\277\355\360\267&\374m\n\177\233\342o=\374\255\213\237\270\302\332/T\362\013\301~\341\222_x\344\027\272\375B$\277\220\311/d\373\205o\277\260\355\027\302\375m\373\013\345~\"\b~\374\304\016\034\377\013s\374\304\f\030\003\177!\215_8\343\027b\375F\300\237\030\302\370\345/f\215^\272\b\241~a\324/|\372\205S\277\360\305O\264\200\261\313/T\361\023)`\374\373\205\034\370\211(\300\355\017\273\277\221\313/\f\361\303\357\017\017\177c\366\027~\370\205*\374\360\361\207\221\277q\313/\354@\310\200\025{?\254\374\341\230\337\350\367\013\227?\321\004x\306\250\345\207\231\277\360\370\013\213\277\020\376\205\306_8\374\205\357/$^\360\0237\030\373\264\227_o\371uV\177\371\365\337\257\273\b\340'F\300\310\267\245\214{\277\333\200_\353\375\233\312\230E?\371\211\0160b\177x"
+	.string	"?\234\301o\304\362\033\365~\330\202\337\230\367\353%\277\353\344\327D4\223_\267\375D\021\214W\376\342\f#\017\274\201\321\312\017w"
+	.string	"#\3407\356\2001\024_\300\037\030\361\340\004\374\033\353\207\025\360\033\253\374\260\003~\343\335\017?\3407R\371\207:\376\242\224\327"
+	.string	"\377\213\200\377\275\371\205Q~!\366\027>y\t\360_\203g\371\317\201\016\374\257\300\377\002H\371\215u\277Q\3567\272\375/\321%\302\360oL\362\033\315~\243u\033\021\373\215B!\264\330?\206\205_w@;\377\215\344\327!~\215\201_\343\374z\351\327J\377f3\206\375\332\350\327,\266\232\021\354\327@\277N\361k!\242\001\214A\210\0050~\375\032\305\257O\024\247\277\021\310_\244\376F/-\375\213&\370\215?\214]?Q"
+	.string	"F\037?\021"
+	.string	"\177\361\204\277\270\342/\016\375\306\036\277\006\301>b\344\372\213K\177\221\3517n\375\032\004#\017b\315\257=`\361\027\233\376b\321_<\372\215\325\277\370c\334Q\224a\324*Z\375F\035:\203mf\314\361\273\0268\372\213YF\034\177Q\307_\324\372\215Y[\177\221\3537\336\370\213eF\033\177Q\310_$\373\2155~\342\321\210U\3447\362\030i\024_\374\033C1\3527\316\320\033~}\302_\214\376\305\026\376\242\020\263X\343o\3718`\274\372\215R\277\021\206\216b\024\272\b\330\352\217\251\371\367\003\376\355"
+	.string	"\2426F\375\233\001\021p1("
+	.string	"\007\301\0307\203s\240\002\343\213&\t\024a0\3742\027\270\002p3\370]\016~w\203\337\r\376p\216\261E\001\\\fZ\344\005?<\335U\230\372\033\231~\370\303\017_\3407.\3750\nF\245\023i\371\\\245\bc\322od!\033S\374F\241\033\274\377\034\376e\334\357\016\340w\213\277\033\302\366b4\301\357\026\340w5\370\335\016~\327"
+	.string	".\001\\\004hp\021\306\022\374.\361\302\003\360\307\300\177\221\001F\022\374\305\n\374[\3108\202\337\330\302_\264\300oD\361\267]\376\226\313\337z\371\333\354_\004\201\361\304_\034\361\027q~\243\211\277\030\201\277(\201\337X\342/\212\370\213*\374F\037\020\214\362_\324\200\221\372\235\226O\003\343\364o\261\030E\360\273Jy\177\371\002~e\227#\177\021\355/&\371\215\322\277\310\201\216\361\353\251b\333\277\233\214\321\031\1771\3567\362\374\327\340\177\001\214,\374\256\322e\300\005\360\3078\377\"\007\305\016~#\324e\300\211\277\362\307\017K\340\3377\214:?\274\241\214"
+	.ascii	"?\\\302o\314\361r\344\277L\361\0271\374E\017~#\tc\374o\0328\205"
+	.ascii	"\037\366\360\033\237E\022\1771\3477\342\374\306\025\376\241\227"
+	.ascii	"\213p\031\360\233\1779\344\207c\230\304ol\376\3047#\b\206^^\374"
+	.ascii	"\227f\377.\376;\371\017\215\277\361\003\377\220\354\207A\360"
+	.ascii	"\303\315\337\350\201\037\316\200\261\003'\362\023\343^\363\017"
+	.ascii	"\003\367\360\177\005\033f\350e\271"
+	.ascii	"\343/\016\377\213\370\213\302\337\275\371\257\177\031\3707r\340"
+	.ascii	"7j\3407Z\3407v\370\215'\374\306\r\277q\204\337\370\200\337\310"
+	.ascii	"\200\337\b\302o\364\3407\032\3407j\360\033\003\360\033e~c\314"
+	.ascii	"o\204\371\215\310\337H\374\215\301\037\006\374\341\277\037\316"
+	.ascii	"\376\260\337\017\367\3750\366\207\365~\030\357\207\357~\330\356"
+	.ascii	"\207\245\3740\335\017\317\375\260\334\0173\371a\270\037~\373"
+	.ascii	"\341\266\037f\373a\265\037F\373a\263\037\276\376\360\220\037"
+	.ascii	"\026\362\303`?\374\365\303]?\274\365\303\325\037\326\372\341"
+	.ascii	"\254\037\246\361\303W?\034\343\207\241~8\351\207\217~\230\305"
+	.ascii	"\017\023\375p\212\037\016\372\341\237\037\036\301\017\233\370"
+	.ascii	"a\237\037\246\376\260\316\017\223\370\341\346\017k\340\207/\360"
+	.ascii	"\303\036~\270\303\017\227\360\303\033~x\204\037~\300\017+\340"
+	.ascii	"\2075\3740\206\037F\300\017w\360\303\006\370\341\002\374p\006"
+	.ascii	"?l\301\0173\177\230\346\207c~\030\371\303\303\037v\377b\227\277"
+	.ascii	"\310\345/\372\375\305\275\277\210\375\213W\376\"\336_\274\373"
+	.ascii	"\213P\376b\334_\\\362\027\335\376b\222\277x\344/\026\371\213"
+	.ascii	"f\177\361\372\027\311\376\"\327_\324\372\2138\376\"\215\277h"
+	.ascii	"\365\027\243\376b\323_"
+	.string	"d\372\213I\177\361\350/\262\370\213C\177\021\350/\236\340/R\377b\316_\304\371\213\315\277\270\201\277\250\302_\264\300_\224\300_l\300_\f\341/z\360\027;\370\213\005\370\213\003\370\213\002\370\2135\177\021\346/\016\377\242\360/\272?\261\313O\314\376D\277\237\330\367\023\365~\342\225\237X\367\023\241\374\304&?1\356'.\371\211m?1\355'\236\375D\"?\261\354'\222\375D\261\237\370\365\023\273~\342\326O\324\372\2118~b\215\237x\365\023\251~\"\214\237\b\365\023\233~\242\322O4\372\211E?q\350'\252\370\211B?\021\350'\316?\321\004?\221\004?\361\304O,\361\023\247?\221\205\237\370\374\211+\374D\020\374D\017\374D\r\374D\021?\361\303OL\341'\242\360\023M\370\211\034~\242\004~\342\003~\342\002~b\b?\321\203\237x\341'\036\340'r\360\0235\370\211\031\374D\f~\242\005?\021"
+	.string	"?\221\202\237h\363\023k~\342\314O\\\376D\345OL\376D\344O\204\177\242\360\337_\376\335\367\357+\377\306\373w\335\277\233\374;\002\277\033\374/\342\327%\374\272\303\277=\370\207\326\177+\371\265\214\177\263\375[\355\327+\376\235\344\337H\376}\344\337F\376]\344\327\030\376m\366\357\243\337]\300\357\"\340o\363\376\026\371\267\325\277\325\372\367\365\337C\376M\366o\257\177w\375\233\353\327T\376]\375\335\233\177k\375\373\306\277\261\376}\365o\253\177W\375;\306\277\243\376\375\342\337O\377n\372\367\205\177/\375[\351\337H\377f\361\357\242\177\017\375;\305\177\346\277}\376\241\227\277\035\373]\342\277\345\337U\376\357\377M\3757\364\337\025\370\367\b\377\226\300\2773\374\033\303\277\021\360\357\r\376\255\301\277\013\360\357\f\376\215\301\277-\370w"
+	.ascii	"\376]\301\277o\376\315\374w\315\277a\376\341\227\1778\344\037"
+	.ascii	"\n\371\207c\377P\353\037\346\370\207-\376\341\320?\224\376\303"
+	.ascii	"\n\374C\017\377P\002\377"
+	.string	"\360\302?\274\371_\300\377\375\362\277}\377\013\345\177\235\376\227\350\177w\376w\205\377\365\300\377n\370_\022\376w\204\377\225\300\377R\360\2776\377K\374\205_~\327\001\277\360\311/\244\373\205N~\341\334/\364\372\205;~\241\215_H\365\013\231~a\007~!\006~\241\004~\241\314/\204\371\205\3775\226_G\3715\224\377\036~-\367\353\033\277\266\372\265\213_7\375\272\305\257\221~=\364\353\022\374\272\205\377!~-\202_\223\370\365\363\327!\374\332\203_#\340\327\007\370\335\r\374\356\003~\227\001\277\353\301\357b\370\335\013\177\313\367\267\200\177\373\345o\261\374\255\336\337n\375-\217\277\335\361\037\354o\213\3767\371_A```\340O\200\f\376\t\250xK|@e\256\376a\226`\224\270\200E\201su\022\023F\323\222\224\345\352\177\240\312~\273\206T\001\223\026\004\203\004c\004\303\242\275\302\034\301\254\2009J\006\302"
+	.ascii	"%\031r\007s\004\023\004\243\002\307P\314)\253-\251B\216H\337"
+	.ascii	"\3260Dm\231\331\215.\256\376\007\330`\206>\037a\032jg@\256\376"
+	.ascii	"\007\254\373\207Q\001\223\002\016\251\t\216.:\n\255-\316\325"
+	.ascii	"0B\311*S4\242\250\370\200\371A\372\261\320\262\304\325\377@\025"
+	.ascii	"\314\374\201\247\375'\001\277 \365\310\254\374|\271\227\037Y"
+	.ascii	"5\226\270\272\213W\365\352\344\352\177\240hO\241%\327DP\241D"
+	.ascii	"L\032\202\003K\327FUUb\243\312v#N\n{M\026\321r\222\244C\302\312"
+	.ascii	"Aa\245$\357DP\241Dl\021\304b"
+	.string	"\312H]\0160&\272\bF\325m\212+i%\371\226\204\213\221\264\202T\341\225l\022\205\315KjIfI\376%\267$\263I.I,I\275\244_\022\233\274\222\344K\366%\361\222{\3555i%Y\205\231\264r\364K\326\331x\243\236\250|e\347\331\212$\313qd\305@\337\003t\373O\336Q9\023r\005OoQI\333\341\352\244]r\212X\235\r&\256\276\007\322\366=p\266\241$\243$\267\034\365\331\205AI>1\366`J\322r\365=\260c\317y\240\306\276\007\246\366=\260\264\357\001\241\375\016t\331\177\022.\271\244\272\203,\317\325tI#`\220:\031\256~\007\366\366;0e\277\003p\373\035@\333\357\200XZR-\211N\241D\211\rW\277\0034\322\222D\t\233\211 y2IRG\022(3\\\235<\342&\005&\221ss\365\265<\357?\021^\222u5\347\352w j\277\003,\222gD\236h"
+	.string	"\345\271\372\034\320\262\337^\223fI\"\305/Zs\331$\021\275(LUfW\237\003weC\\\334\355\b\273\200+.F\222,)\004\306c\233\227\240\266\204\344Y\223^/\027\021\271'\256\250\252\325\307\334\226T\325\206X\017(l\322+\331e$\227\364J\362"
+	.ascii	"{\352J\202%\201$\303\222c\311 I\261\344W{Mz%\177\004\375\306"
+	.ascii	"\330\2600\372\034 \333\347@\330>\007~\354s\200k\237\003:\366"
+	.ascii	"9@c\237\0031\3669\340\264\377\344\216\244VR+\251#Ycg\361\"$\364"
+	.ascii	"T\005+&%G\007\303I\324\\\f!\336U\222F2G\322*\211\225\274\221"
+	.ascii	"\314J\342H\332H\312H\316h\257\311\032\311\252\027k"
+	.string	"NB<\rT.\204xV\2225\222P!\324HN\265f=\236v\310\t\253\270\226T0\3657 e\177\003K\3667`\266\277\201\257\375\rd\355o\340\305\376\006X\354k\200\313\276\006\360\36650\267\257\201\265}\r\f\331\177\262)\251\024T\365\325\305\325\327p\304\004\233TJ\262\220\303\032Qi\222LJ2%\227\222-\332kR)\211\224TJ\026\215`\r\317\311K\210\006cF*\352k\340\307\276\006h\354k\240h?\003U\3663p\335\177\222H\211\017\240)W?\004.V\350\374\364\304\266\344\315ii\315\260d5\374\341\005&g$`\362'\231\"\271\"\251\")\224\034J\006\265\327$\020\262\313\221^\220_\344\372\204x\331$\020r\3578\267t6P\360\373K\002!\263t\301\316\363\234\004B\362\t\361\366\220\242@y\t\203\300\256D\241\321m\265\235yi\332\345\373\f\370\330\317@\215\375\fD\355g"
+	.ascii	"i\037\003\201\373\030\300\262\217\001\272}"
+	.ascii	"\f\264\355c\300l\037\003c\373\030\300\201E"
+	.string	"b\021KQ\365s\265\236\025n\213\221\024\256>\006\240\366Cx\243\202\214C\326\265t6\364\\\032\226\211Z\022:%\255\031\232X\233\020\317\355\n\322\nR\n\322\016\211\207\254\202\274C\346!\247\264W$\025$\334\034[k\246a\311\030\026I\005\271&\304\213r\302\002\370\216U\201\232\223\321Ql\202aN\234\360p\365U\310\243C>i\257H(H&G:\311\322\303\"\241Ty\271\370\322\226^\375\326z\005)\207\234C6i\257H'yH'oNzS*\370\330W\201\306\276\nL\373*\030\355\253 \264/\342\313\276\b\277}\021X\366EH\331\027!\267/\202--H\207\266\006\204\211\253\177d\022$\022\370\032\004\307\024\344\021$\032\262\b\322\b\362\254\275\"\221 \315\310\344\222\250\364\310\016\311\273Z\251\226]A\"A\022iK\242\322#;4\322EE\206Q_\304\330\276\210\256}\0217\366E<\355\213"
+	.ascii	"\332\017\221\267\177\244\020\344W\236\225\237\037W_C\227\227"
+	.ascii	"*]\217 @9\256@\344\027\262Z\204u\343A\264\025\206\004C\006A\212"
+	.ascii	"!\307\220@\220\326\366\212\374B\3768\322\253Er\027\371\205\364"
+	.ascii	"\3617,\323c\261\006\243\221\355\362}\b\271\375\020H\366C\204"
+	.ascii	"\355\207\340\332\017A\265\037\242\305~\b\025\373 \374\366\217"
+	.ascii	"\334\201\314\332T\262G\262YH\031E\330%UFSH\325+$\026\262\006"
+	.ascii	"2\007\362\006R\007\322\006R\013I\003\211\243\275\"\263\2203\334"
+	.ascii	"\250\216\262\216~,\260\310,d\214$\254\024T5\004d\026\322\212"
+	.ascii	"\311\251\313\270\025C\316LF"
+	.string	"\037\304u\037\004\220}\020[\373 b\354\203P\332\007\001\264\177\001\275\375\013\314\355_\340\310\376\2210\220Q\303<\255\032K\310'$\024\362E{EF!\233\216t\201t\212B\002![\004\205(U \005\013\354<\317\310(\344\217\021\026\031\205\234\217\\\275\031n1\266~\253\332\231\367R\332\345\373\013\204![\034\311\344j,E]f\256^\032J\302%\347\352_ k\377G\"!\213\220IH\026\310#\244Q{E*!\207\204\276T\301\210\002\351Tt\301\"\225\220+\376\260s)\274T\221J\310 /NYm^l/\260\314!\365?\374\355\177\240\262\377\201\311\376\207\264\375\017a\373\037p\354\177h\332\3770\264o\201\275}\013@\tdZ\361\342d\316\325\377\021\360\370\305\213\016\210\317\325^\254\307\035\330$\033\256\276\005\314\216\177G.\355\365\330\345\270%{\354r\364cK\372jK\312\330\232\342\342\325\267"
+	.ascii	"\331\276\005l\354[\340J\013VI\221\212+\256\276\006<4\354\034"
+	.ascii	"\225$twH\254U\216`\261\034\363\216W\216zG\276\343\3361\313\261"
+	.ascii	"\257\275\036\261G+n\235\234\035\366(%\016{\234Ru\361\027\345"
+	.ascii	"5\317\326#\026\223\271-F\277\002}\373\025\210\262_\001\"\373"
+	.ascii	"\025\370\261_\201\031\373\025H\332\367\340e\337\203\224}\017"
+	.ascii	"h\373?F\331\341\006V\344\352\267L\250p\314\321a\261QE\256\212"
+	.ascii	"\313\234\214\254\022\030\200\325\031Q\201`9j\340\031\331J\303"
+	.ascii	"b\265\\Z:(\007xY\301rI}\251Nuq\313\322j\222\341\207\221\352q"
+	.ascii	"\310\321\3101\356\330\344\330v$;*9B9:9\312\035\237\034\307\216"
+	.ascii	"L\216bG\267\343\222\343\334\321zd;\322\035\341\216e\307\265\243"
+	.ascii	"\3311\311\361\310\361\355xv$r\274\036\221\034\325\216E\216B\216"
+	.ascii	"h\355\365\230v\f\362#\3301\354\272\032\247\244K\210\207\306\003"
+	.ascii	".\3031\355\3705vL;\276\030Z\342U\004\tWk\226\304\272\203\t6C"
+	.ascii	"\017$k>\204xG\344t\310a\263\240\226\304h\315\274T\201\234a\327"
+	.ascii	"\216i\307\033W\307\264#\215\026\316\205\2259\257y\266\"\363\360"
+	.ascii	"\366\372P\320Ak;\363\212\320.\337{\310\261\357\001k\337C\323"
+	.ascii	"\276\007\240\375\024\266\354\247\360\266\237B\330~\n8\366SH\332"
+	.ascii	"O\001h\237\002[\366)`e\237\002S\366) \267O\001%\373\024\260\356"
+	.ascii	"S\240\306>\005`\354S i\177\002\201\373\023\250\262?\001'\373"
+	.ascii	"\023@\333\237\200\326\376\004\220\366;d\331\357\020\267\337\001"
+	.ascii	"l\277C\324~\207y\037\205\275}\024\242\354\243\240d\037\205!\373"
+	.ascii	"(\330\330G!i\377\307\247\243S\013\245n\254\307\221\351\330tt"
+	.ascii	"qlq\\j\257G\247\243\322\365\220v\356\355\221Q\020,\022\020\026"
+	.ascii	"\331\246@8\257\243\3231\t\333\024\b\227\345@\250'\306$\210Q\377"
+	.ascii	"\004\273\375\023\344\366O8\333?\241\272\177\202\214\375\023\234"
+	.ascii	"\366\177,\342;\223\202\344\352\267k\307\025F=#6hU\333I\256\246"
+	.ascii	"\260\307\025\306,\307\271\202\024\363<#\310\373\205$\006\227"
+	.ascii	"=\022\035\207\216)\216BG\025\355\365\270\342\030t\344\270\342"
+	.ascii	"\b\324C\214\270\345\205$\006\227\315p\\q\374\351B\022\203\363"
+	.ascii	"\232g\253\2158$lF\375\023\346}\023\264\354\233p\027xfDE\325\027"
+	.ascii	"\233\027\343\227\366j\0044\356I\355jKg\003\205\257&\200p\223"
+	.ascii	"\261KKg\003\005@9\254\366\241eL\313\253\377\\cQ6\314\3257\301"
+	.ascii	"+k\3643n1ji\257F.F>9c_\232\025I5I\225\013T\323^\037\221\325T"
+	.ascii	"\226\242\276\t)\366K\250\262_\202\222\375\022\3206\026\033c\023"
+	.ascii	";#\263\253_\302\217\375\022fl\343\025\267/pl"
+	.string	"V\214x\355\325x\305X\245\311H%hU\333iWGW`)\343\335\225Q\265\270\227\025\365\352\227\240d\274\013Z\333\252\032\270\005]\225\027\256\266\253Q\345\203\312\325\347\220\335o\255NC\306)\306\272\366j\224b\214b\224\362\023\002 \222\030\\\220K\231\023\354\253\317A\312\376\215P\214tN\300\324\364\214On\244k\315\216G\262\304f\270\3328\227\341\306'G\270\032XW\013\300\350\304\030\367\3475\267\303\325\3068\243\021c[P\210\322\004\352\360\260fykE\254\300\031\227\030\233\030\337\214L\214r\355\325\030gt\323q\306+\026,\021\2758\343\331\025\354\361\352\013\235\030R\237\003\233\222\366\006\232\0217W\237C\331\376oT3\246\031\327\332\253\221\315\210\344\210\034X\222\271*\235\221\315\210\366\266p\2025*\001\333\213\261\3659\210\355s\250\356s\310\261\317\301\306>\207\031\373\034\244\3669(\355s\b\332\337"
+	.string	"\270\277a\313\376\215eXC\262\310\214ZF!F\257\"K\300\236\270\372\032x\030\271\352\274\300\250\304f\200a\253\214Wak4\2146\352\202,\231\032\303\3520V\203\200`\275\2141\316\260@\214A\214c\3060\243\230\021\314\370\303\370e\264\266W\243\227\261\307\215>\214]\327F/\343\rc\216\276\2461\327\217\007\022\0312\272\245kg\336\n\332\345\373\ro0\214[W=\252b\270\372\033\316\3667\214i\031wl\035W9\"=\264pd\031q\344\364(B\006#k\203\022\226\261\206PJ\234\231\233\253\277\001\b\213\313>\tuF\253%YY\236\\}\022\226l\031$\234\355\223P\335'\201j\237\004\245\375\033\245\2140\2140n\2142\276P\252\022\335p5\224\b\276(B\\\375\021"
+	.string	"\367C"
+	.ascii	"\202\205\261x)\271IgU\243\013c\013\343\222\221\311\370dtj\257"
+	.ascii	"\306&#\322\215I\255\233\234\261\311\310b\f+vdl2\032\3755iyqU"
+	.ascii	"l1*C\352\217\220d\027\333\345\373\021\300\366G\300\261?\202\213"
+	.ascii	"\375\021\204\366o"
+	.string	",2\022\225]\tb\346\352\241#\223/MP\256\276\004"
+	.string	"\267Q\310\250\242\275\032W\030\201\036\334\022\314\316\306\237\257\352<\227]\203q\2051\310\370\323\322A9\340\r\f;\317eo\301\214+\340@\035VA\320\320\fd\225\201_S\r\250#\335\213 0\266\276\004\340\366%\300\226\224\204\243\312\325\227\300\221}\t\224\355\037\006\204\277@g\360"
+	.string	"\342j/\326#W\342\276v\270\372\022\310\332\327\200\205\371\270\300X\360\262\360\026\330\017\376\203\273\264W\230\013\334\247\327\264\300|WyX.p\024x\312\325\025,\027\330\016\326\013Z\253\233E\220\025\354;\004F\035\022\243\276\004d\354K`E\026x\217X\0255\004(0Kv?\002wyNdY\234\\\375\b\304m+0^{\205\257\300w!T\251s\242\341\nLe\350\205\264%&\034\342\325\"\360\325\217\300\332~\004\310\366#\340\265\037\201\255]\007Kq\275<\241\302\303\325\217"
+	.string	"V]\004\244\366\017C\201\351\340\263\246@-\272\240\023\025*@&\370\t<\247\304\242\256\n<\007;\t\254\362\342s\265\\v\313Z\220\253\037\201\241}\rf\\\270\320\210U\344\017\314,\024\224T\346\002y\251\212\025U\227\220\001b\221\300k\260u\b\013\257\301C\\\240\226\016J\177}\301\316\363\274\006\203\301aA\253\332\tCX`\205\004^\273T\231\300G\3404X\rn\203\341`$\360\033\254\004^\002\273\301q0\033\234\004n\322^\3415\370\354p\021\330\310\335 FXxm\310\021\221\2771\242*\274\006\177I%mq\252\252a\226\303\002}\b\304m\267\332\316\274\005h\227\357!p\335\207@\330>\004z\354C\340\306>\004d\354C j\037\002M\373\020`\261\377"
+	.string	"/\373\017\270\333\177\300\032\034v7\251M\366\351\370\313\341\352?\200\310\376\003\304\366\037\240c\3770\020\370\307\220Y\213\205\253\341\0370\217.^p\027\354\243\275\302?\340\036[\360\017\230k/)H\366\203'7&[\377\0012\366\037\020\265\377\200\026\373\017XQ\335\201\226\026\006\245\003\326j\257\360\0168\207\025\007\024\274\003\316*n%Q\351\341e\f\022\346V\364\352;\240\311\276\003\256\373\016\340\332?|\003\266\021d!d.\203\261`\032p\215\366\n\333\200g\\\205\311\030\203m\300V xI\212\002\226\345`\003\351s\"d\3537\340\313~\003\262\3547@\312~\003\342\366\017W\301SF\252|I\\\335\004G!\201`\346Y\253\n\226\n\216\321^\341\251\303S\260\324\233\324\322\331\320_M\260\332H\366\212\311\253\337"
+	.string	"\267\375\326\352\024\264\302/`\0300T{\205\243\356\"h\275\253\302Q\360S\320\nD"
+	.string	"\260\244 Y\016\246b4\272l\375\006\374\330o"
+	.string	"\217\375\006\350\330o"
+	.string	"\326\376\341\026X\243\032|\256\316"
+	.string	"\033\025\277\334\230R\324\313\201-\006\302@T\330\254'A\254\b*\224\210+\246ha\351\212Rh\350\300\372\025\275d\301,\340!8\tF\202\227`\"\370\bf\202W\300JpQ{\205\215\212vE'\303\274\253\027l\004\007\301*\256SX,E-)p`\347\331\n\033\025\347\236'\202\n%\242\212);\260\260Q\021P-\351\253-;\317\326\355T\364g\307\324p\n$\216\252^\225\253\337\200\024\260\320\037\374\223\324\233\302b\342\3523 \017\236\031 \267\317\200\264}\006\b\371+v\341\362ni\022\205N\353\257\310EJ\313\350\211\253\213\\\220|/\352\374\\]\334\242\245\216\024\251p\365\265\264f\377\211\302+\277+i\256>\003\254\370\212}{F!t]\002]}\006$\361\025\367\212pEnC\305,/\356!\001\253\314\212\3304&@7\260\247\202\254B\367\206\024X\314\313R\303*\207\253\277"
+	.string	"+\373\355\265x\345E+Khxi\256.Z\331ggzG\256\276\226b\225\377\304\340\221\265<\257*w3S\216\260\3269\b\217-]E*E\273vO\311\333\354\352/\200\311\376\002\212\354\277(\345\305:\250\037b2\\]\214\342\n1EY\341\352/\240k\377\327\322^\213P\206y\372\312[\240\027W\177\001X\373\013\210\332_\200\322\276\b\200\373/\31251*\211\002\004\350\302\275\330\344/\306\025\231<-"
+	.ascii	"9\202p\270Z\237\265\313\227(%\303\213p\310% W#K\212o[D\344\276"
+	.ascii	"\\\355v\324\344\t\315\325\027ao\277\245#\362\351\242\"[\361H"
+	.ascii	"\021\b\256\250\244\250Vl+\256\265\327\"[\261\310\213F\212hE\266"
+	.ascii	"\342\231.BR-\262\r\333\212f2\0260\225\204\365\366\036"
+	.string	"\301\001&)\352b\332_$+\016\321En\325\233\333\r)W\027\221dx1\211\326\261D\245\213\253\217\005m\003@\204\261}\021\200\354bY\361\332^\337\244H\344U\202\262&\2133\230\264\361\271\372\"T\367\3337yO\320\276\311[\301\334\316\274AkQHq\214\t\0242<W\027\307\212N^\254E\261bX\361\253\bV\f\322^\213cE BOP\177nQYlq\354\215*z\265t6\264\034\026\354<\317\305\261\342\013.\330y\266r\300\034\326\375\375\370\201\324\027\301j\377\020\372\242\202\342\352\213\260\264\257aj\206\234\021\252\034E\255bW\261Gq\253\250\243\270\243\350\243\310\243X-\342h\257E\256\242\215\027a\024\245\252\2122\220\301y\236\361\204F\023+\026\223+'1\360\344\212\\E+\256\342\215bVK\007\205\302\227\025l\221\253Xc\013)\260O\033Qq\255`\352\254!W \322\236\253\257"
+	.string	")\373\nP\262\257"
+	.string	"\"\373\n\360\261\257\200\253}\0054\355+@\305~\002\372\266\f\274\025\346\371\fJ\310\310\311\325O@\336~\002\336\366\023@d?\001;v\253\326\316\2747\355\362}\002\240\366\023`\264\237\200y?\004-\373!\330\355\277\350\242\t\001Jt`1\271\\\305\026O\233\022u\004\313\325\356\334\316\274\305\024\031^d\n"
+	.ascii	"\022\2675W\377\305%%5 \033)\\\235d\224\022\325\267\346\352\207"
+	.ascii	"\020\267\337\312\2518\253\276=\302\372\304\252s|c\032\202\276"
+	.ascii	"\260E\244\"\213\242Q\361\2508T\\Q,j\257E\242\242\320\213)Z&o"
+	.ascii	"\255\304,A`\330\"Q\021\210\210t\005\n\202\321\017\301m\017"
+	.string	"\333\345\373\020\316\366C\370\332\017Ak\377\305\237\342<\"\310l\304\325\201\305\270:\025M\256~\b2\366[\260\275+X\342\037QK\025l\037^\225\370G\344\273\262\202\315\022\271\020\001\211]\210^\210_\332+\361\217\350\347\226\245\345\222\247\344\317\360G\334\322r\221\032\312!q0\024[\352\203\202\324\007ao\037\204)\373 \270\355\203\260\266\017\002\222}\020\210\354\203 \004\2537\304\005\213#\256\256B\274C\006\347\031\bI\225\230G\304\322^\211zD\274\023\255\020\257\274\rv\021\365\210v\304\273\"Q\266He9p\217\300\215=y\265\253\324\316\274\030\264\313\367 p\355\203\240\265\177\"\225\023\357~\242\024\342\024\272\256.;W\007\2732\234H\245\230\004\033$\311\325\007\301j\267C\355\314\253$\326\265{%t\301\260\022\005J\220\013\336\2140\272\366J\204B|\"\004\2058\347\205\024\005\352(\004\310\223\233\326\327"
+	.ascii	"\270\257a\313\376\211N\342\226\356\372\270\270\232\030\267W`"
+	.ascii	"!\306\275QD\267\245\005\310\021\343\2108\366\220\304\340\230"
+	.ascii	"\020\341\210r\304&\355\225\030G|\373\353\202\270\204\030G\314"
+	.ascii	"\201E\022"
+	.string	"\203\313\316\363||\202U\302\242\250\213\032\222\3546a\f\037s|\256\276\206\353~k%\242\021}\274@1\212bB,m\032\260\020\207\004\255<\212;\210\325\n\202\346\271*FQnJ\b\370\032\005\205(\021\221\2566\260eO\253\200h\236\341`\024\273\214\376\232\262JD.\341\021\033\3057\243\277\246,\021\215\330C\350\245\310F\274\022\325\210D\210F\210H\210l\304#\3044\242\022\242\031\361\214\270FLB,\322^\211h\304\037'\352 j\235\271U\2043\372k\312\022\321h\274\300\316\363\234ED{\253\020\305\2561\260SD4b\027\230\321_S\366\217\210F\344\321\356]u`\333\277\023\321\204M\204u@\212s\3631\033d\246\021"
+	.string	"}\r_[\b\221\314\272uL\221j\243!\204h=\233\357\210c'Z_\274\237\267?bX\020/Nk;\\}\rJ\373\355\225\bF\f\202\244\007\321\021W\023\203\030\377\344\346\232\\}-D \377\211H;\2614%@\210^\310\243(\263\025\321\213\370\203\350w\367%\210\253\257a\305\276\206y\377\003.\373\037`\367?\260\262\377\301\334\376\007k\325\267f+\3145J&JT\256\376\007F\366\266\2663o;\324.\337\1770d\377\203\033Y7\264\021%H\336l\264W\342\rb\r\342\r\342\f\"\026\334\333\207\264%\226Mby\252\321\244\365?"
+	.string	"\332?\221\306\211XEn\325<\237\271GXT\206\\\375A\206\023i\274^m2\270\270\372\031\276\354\237xE\264:\022\204\253\352j\031.\021\267*)W?\303\225\375\237HE\234\"\306h\257\304*\"\f)\342\013\250\252\225XE|\"\276\bZ\325vQ]\022\226XE\214B\322R+f\227@a\331\372\031\210\354g\360\261\237\241\272\211PI$0\364\200\\\375\fV\373\031\234\366Ot*s\261\317\2060\371\002r\365Oljq\314\3731\005\213\211\270\324^\211-\210J\304\242/l\213\027\nHu\030\270\225\242\356\325\367\200\313\376\211ID\244buN\243#\036\021\215\332+\021\211\310\242\214X\024\264\"\201`f\241\240\250*\021\351\205\nZ\267\216"
+	.ascii	"\263^\035hr\205\313\253\357\001\335\276\007q\373'\022\021\207"
+	.ascii	"R\200\355\335"
+	.string	"\271z\005\013\247._\\}\017\254\373!\354@\260\2715#\006\021U\020S\264W\242\020\361G\210(D\004\372;\372\003\363\332)\323\222\261\365=\300\261\357\001\323\276\007C\373\030\376\366\277\001\367\027$%cJ\274|\020Bk\266BM\322m\336k\342\352\f\031\276\275\264c]\204,\351\362\275\305J\247\224\344\352k\320\222\004\214\357ma\005W\335\262\373\336\026!L\035\001f\263\\vv\377\265\327\275e\373\351)\354\016\242\255\217\001\311>\206\262}\f>\3661\344\330\377\336\323\233\222\346\266\305\325o\351\252<\251Z\221\253Z\3656\336\327\321\037X\336\316\262\261ll{\335z\373\212k\235\347\263\fz\373\216\355\350\017\214\270\344\305\336UQ\377B\340\376\005,\373\027\244\354_\200\333\277`\266\377Me\333\255!Y\355}\333\231\255\240\264\211\270`\272\233\242\004\t\344\213H\027W\277\265&\301\253\036q\223Z:\033\022"
+	.string	"\273b\266\215\310\035\361me\303\212\260F\200L\035\361me\311\372\274Z\263\267z\304\267\345\225!\017;\317V%{\310&b\200\275%bCH\276\244\216\370\266\262rB4S\373w\304\267\345\305\304J"
+	.string	"/\032\322\330\216\370\266\262\301\256 Gk`/\324\021\337VV\311F\262\200\267#\276-\266=\267\3516\223\375\266\3356\224\335d\257m\270\035\267\237l\271\035e;\331u\273mK\331K\332\353V\262\325~\274\250*\331c!"
+	.string	"\036\361me\347\331j\204\361\265\204o\003\375\013/\366/\250\330G"
+	.string	"\337>\002\344\366\021@\266\217\200\036g\273\310\221\356\251\212\021W\037\001Tg\b0\332\327\366\250\217F\227\253\177\200-\273\354"
+	.string	"R\366\017\320\266\177"
+	.string	"\"\373\007\340\261\177\200\246\375\003\244\330\357 \313~\007M\366; \262\337\201\327~\0072\366; \332\347 \273\377\335\265{\314X\353\232s\3655\364\330[\013\310\036u\371m\037\355u\367\330\\e\307\253*\"#Z\237\003\264}\016\202\354\177\363\250\226\200\202\022\333\361]m\253\346\371\f\331\342\352\025\345\352\0260\303\367\016\007\340\230\361\245e\363c\215\n\313\325\377\326\341D\246\002\206\253_'\037{\363\213(9\354\246\3320v\325N\332F{j3m\247-\265\233v\214-c\263\330.\366\213\215c?m\253\215\264g\354\026{i\337\330J;jcm\250}\264s\354\032\333\306\276\3324\332\353\316\332C\337D\273h\030e(\345\007\033X\n\035\3305-\354\360.+(Di\002C\276\366\n\037[D\314\204G,"
+	.string	"B\266U\350\242%\021|\220\r)\023\n\t\nQ\252\300\025\034v\236gmE\353\t\211<\b\333\232\233\314\005b\305\344\214\260\372\311\316\322Q\364\024\020\306\254\360\362\260\372\311\335\003\366\266\344\274\346\331\332\304Ik\206\374\261\316I\027"
+	.string	"\332\222\363\032N\031R\371\261eu\202\332\333\222\333Y\303\354\016b\262\340\007\323\374\202,\310\326\226\\\226\n\320\226\\\326ig\t\237\204DA!J\024\b\272\303Z\253\350a\221\b\325\2000\315\331i\246\f\306\230\266\344\262\303(\337Y\303\272!\224\231i\203\037\303)C;\262-\271\254~\262\2634\235\233$\302X\024\341\220+\220\275-\271l\260kgm\241\003\374"
+	.string	"\332\222\313\352';KC\031c\333\222\323Vv\226\260H\350\302J\2040+\346\niz?\034\364\371\254\355\314\213\364j\227\3579\350\261\317A\215}\016\240\3669 \332\347`\336@\307'#|_\264"
+	.string	"\356y\0308\374\322^\367\317\320\313\207~\303-\327\\\344\252\177\272\250\tv\377\f\361\206ZZ\2723\335\346d\377\f\273\350\"&U\230K\330\023_Q\337"
+	.string	"x\373\006\230\262o"
+	.string	"\272}\003,\3317\300\221\rC\327\316\274\256Q\273|\207Z~!\334\260\312\260\317\265\233\251\244p5\337\360K\355\317\213\253o\2001\3540K{\035\356\r\365\366\206V\206y-\335\031\0070$\330\275!\026\341\034\002\244\216\262"
+	.string	"\263A%O\244\352^}\003\300\3307"
+	.ascii	"\322\036^1\0029%\201\342\352\033 \305\376\006\200\373\033\370"
+	.ascii	"m\230\271\235y]\274\375\r\346\266\336\200\310\376\006_[[\333"
+	.ascii	"\345K'\244\357Z\370 \342\352o\240cn\350\244\275\016\237\f\305"
+	.ascii	".L\"L;\023l\370d86\224\013\nQ\242@\035\025v\370D\3706\f\023A"
+	.ascii	"\205\322\tuSX\016\\\261\244:\035\257n\302\204\212Q\fW\177\003"
+	.ascii	"\030{\311\360\355mq\025U]2$\033*y\201\035.\031\266\t\347\220"
+	.ascii	"B\326\371G\003\320\226\234\327\220\3110n\b\327^\207K\206n\027"
+	.ascii	"\262\t\225`\240V\265n\375\rX\354k\300e_\003-{\250\344\037Z\207"
+	.ascii	"B\206lnU\2231(5W\257\025\275\004\361\361p\3655\310\333\327@\004"
+	.ascii	"\206\332\265\250\316\310\310\335\202B\2246\221\253#,XY\222!\332"
+	.ascii	"\020\3110m\250\326^\207G\206f\037\236\r\213\\\017\217\f\207\314"
+	.ascii	")\312\016\300c\b^T\226\203\341T\02485\243\276\006Uv[\325\316"
+	.ascii	"\2742P\3665`\262\257\201\222}\r\216\354kp\335\327@\310\016\322"
+	.ascii	"\2653\257\003\332\345{\r|\354k`c\033\301r\027c\206\253\231"
+	.string	"H\021R\3111\0044\372k\312\216=\t\347`\f\247\214\376\232\262F\362\272`\203H4\323\025\027\2540\216\b;\314!l\"\254\013\nQ\252"
+	.ascii	"\215!\354\025\241\336_u\236\255L\254\f\263`Y\204}O\260\303\034"
+	.ascii	"o\324\253\006tc\030e\364\327$\204\323x\305\246\261\027\352iA"
+	.ascii	"!J4*\352\222\b\277\fs\274GAk\227\321_\223\227p\211\026a\266n"
+	.ascii	"\016K\367\336\215\r\235\214\376\232\262C\252\341\216\341\326"
+	.ascii	"\320k\370c\b6\254\032\342\030\372\030~\r\273\206@\2065\206=\206"
+	.ascii	"ZC\032C\031\303\352\320jxc\2105\f2\3441\344\032^"
+	.string	"\ru\fm\f\263\2063\332\3530\207\360\354\3026\241\033\023\341\235\020o\370g\364\327\224\305\362\366\211\240B\211\210TW\344UZz\233\202B\224N\270\212\313\252\362\352\005\0316\031\3755e\205W\204X\204\330\254!\026\312\353b\230\343u\022\316\005\205(\231P\007'\274\222C\310E\350%(Di\243\0059\301\316\2635\307\253e\030C\004\025J\024\270\032\303N\275k\357\023\021T(\021Y\324\035\021~\031\346x\221\336\244\240U\355\204+&X\341\227\034B\300\327\250\002\242y\236\3615\3642\372k\312\n\231h*\200\302\265a\216\341Tk\026\243\be\364\327\224\235gk\373bH\2261\007\350\027\300o\017\245\230\311\0315\200\246\270\372\005\260\333~/\227\240\265jB\020\022\026j\bc\370\242\275\016\243>\214z\377\206H\"\250P\262@\320\021v\0305|\272\234\324Ke\304\367f\303\001\007\232\210\2158\252\255_"
+	.string	"\034\373\255\234\n\233\226\316\206\004\266\320\350X"
+	.string	"\301\016\221\336.\303\024\025\004\r\245"
+	.string	"wd\350nVgE_D\033\264tg\034\324\300\260\363l\035\"\r\215\356\206\024\202\231\205\264\274\260C\244\341\n\233\226\316\306\f\364C"
+	.string	"\027FX\260\331a\323\320i\2304l1\\\0322\r]\f\225\332\353\020ix\304\024\022\271f\273\304\350\023\300n\237"
+	.string	"O\366\t\260d\237"
+	.ascii	"i\373\004 \262O\200\261}\002\374\330'\200\216\241\220\373\203"
+	.ascii	"%J\222\253O\200\341\317\020\250\275\016\203\336/\032^/o`^u\030"
+	.ascii	"4\234\337\300\031\bpbD\245)\033Lb\245\357\372\352g\320d\377o"
+	.ascii	"  \f\030\026\003\020\360\375\202\024\333a4\303\325\317`\310~"
+	.ascii	"\006`\373\031\370\330\317@k\277\\.,B\324d\205\253\337-\031\376"
+	.ascii	"fS\3300br\265\006\355\362}\0065\3663\260z\371\246>\364d\270\372"
+	.ascii	"\031\030\355\275Y\262\260U\252\256~\263\374XA\243\222A\212+o"
+	.ascii	"\236\025\242\017\027E\256`\271b\205h\007\226\304\017\357\257"
+	.ascii	"\225\240\226),\035ucP.\322\356^*m\217.\003H\262\337^_\273w\212"
+	.ascii	"\020\027\2629)\177\2470\265A\364\352\266\270\372\215\362\326"
+	.ascii	"\375'\356j\322O\212\267"
+	.string	"NX\004\256\t`\024\024b\226)Ol@\tZi\360H\022\304\325\037\200u\273\005\315\204\200\270\332I{}\347^\266\271W\311+WA\320\320\fte\200(\243 Q\306\231\210\313\232\326\377+\3676AB\302\016\271\372eB\224kr\021\347\352\017`i\377/\\{}\343\3646\220\301\305\344\352ky\227\374'\2725\246`\371s\365\373\2464\233\275p\265\333Po)\n\231\253\217A\340n{\331\\\031@R\226\\}\f\274\354c\200\267\217\301\224\235\366V=\0051r\3651\210\3333\336+\241!I\252\\S\357\225\216\341\224\221\326[V\354\035\322f\344%\362\232\275E^$o\222\367\354=\322^_\264\267\354\256\322\373b\n\355\275\352\242\240\020\245m6\344\t6\353E{c\f\273\214\264\336\262h/\2157\254\202\240\241y~z\001g\251)\265)\264\027F\260Ok\370e\244\365\306\334\233\201\345\212\321\307"
+	.ascii	"\311>\006B\366Kf\002\226\030i\256\026R,r4&\304\325\307\300\307"
+	.ascii	"~\255\357\030^\321\254\347\352cpc\037\003\032_/\330\033\244\275"
+	.ascii	"\276a\307\361\352\b\362\206\275;^\257\226\016\nf\236\257\274"
+	.ascii	"\252\363<\207\275XoV\320Z\035\022\251\023\303\316\363l\303\001"
+	.ascii	"\007\034\004\233\276lp\331\332\353\255j\246\033\357\234\221\326"
+	.ascii	"\033\220\267\353\375\321^_\257\327\307\353\365\366`1D\007\326"
+	.ascii	"\353\345\361re\275rFZo\034\270R\244\256\\\331\372\030H\355c\340"
+	.ascii	"\264\337^\237\367n]O\343\220s\ns\3651X\332\307\240h\377\002\300"
+	.ascii	"\375\013\376\3665\274:\336\032_\325y\266j\265\327W\307\033\326"
+	.ascii	"3\205\270G\224P\375 \302\004c\2021\303\002"
+	.string	"\261H,Iyba>\360\302x\350\350\352b~1\253~\366\036\340\345\351\257-)\003F\025\213\371\305\004\362%\320\n\210\253\231^.\214%\034pO\314\037I3s\213\271\305\354\361J\315\020\353\261\177~\206\2000\271\316\354Q\344\205_\023\322\025&\016&\016fU\354Uz\372#\256\300\273*b\3468\263\312\334\241\206E\355\ns\007S+\tP\213+H|\364\030jb\352\200!\302E/\211\312\355\306\215\031\032QRY\200Y\277$|EH_\314*f\025\263\006\263\352\307/)&\225\005\230\365\353\333\263\202uf\r\244R\227,5W3iX\220\304\007\215\031B\266\037\252\243\031W\033\213\204O\206\f\246\325&\262\222Gc\207\f\244+\246\023\323\2119\025\343$\225\005\350f}X\3411c\2349\345\026\324\247\345j\246\224\262F\214&Dz\270\232\tC3\t\005\335\361`F\021\247@a\203cF1_"
+	.ascii	"z\351\001\303\325L\250\265\0367\312\\\375\026)i?\035\211G\212"
+	.ascii	"&G\177\314&fST\025H\2253%GU\230LL&e\016\rQ\266H\251\270\362\001"
+	.ascii	"\005\247\244\244\314\241\226\264\305i\247\221)Q;\032c2Y0\221"
+	.ascii	"h\374\350k\227\260\3549\035\235\211d\324\232\265fGUf\nf\n&\321"
+	.ascii	"\333\226\264\205\310\027T\344\2159t&\221\226\322\245(\315\325"
+	.ascii	"\314\025L\025V\2604ac\2528z\301\234\23133\310\217\006\036T\t"
+	.ascii	"\332\320\210\230@g\006\351\271zhT\200\270\232\371\023\304\276"
+	.ascii	"C__\210\030\355\325x\251\361R\003\330\344*\271A\311\250\371\362"
+	.ascii	"\032@\327\312^\230\026#'\177\1772X\305\271$*=\204F\206\350\240"
+	.ascii	"\030%\311fe\260\206pMZ^\250\304\270\022\303\210\313\317O\006"
+	.ascii	"\313F\212F\024\300,\021[\2255#\244\275\275\232>f\325\317\226"
+	.ascii	"\227\215\352\207_\026\206X\027 5|\257\351\203\343\342\322th\301"
+	.ascii	"be\260\276\220\360\242\274\372\224T\201\302\202\356\312\225\032"
+	.ascii	"=\267,xN^L}I\274\270\372\257\311{\215^\222Q\335\335\036\224)"
+	.ascii	"TX\250\341\341\311`e\210\262E\nFk\n\313\301\342\307\335\235\f"
+	.ascii	"\226\337\236[\027/\0365j\354j\354j\244x\341d\261\301\307\002"
+	.ascii	"*J\224\032)-\331\2344\245\361\243O_\277\300\001\325\275F\nQ\207"
+	.ascii	"\226l\026\224\271(\246\273\242+5t5tN\252I#QU\032Mj\346j\346d"
+	.ascii	"\260\206bM\201pocbEF\344\344d\260\346\220\304\340D\210]q\351"
+	.ascii	"b\302D\006\353\205B\212\002\205\304\3613c\247\340\340\222DZ\262"
+	.ascii	"9)\371&\225\005\330b\203pT\213~\336\336d\260\230{\016\033B\204"
+	.ascii	"5\266\ru\305 \322\322\3266C#\003\320\026\251 gAV\020\341\325"
+	.ascii	"\260\325\260\275{N]rU\350j`iC\202\244F\215\271\347\260+\034\330"
+	.ascii	"-\200JM"
+	.string	"j\322^\243\346\006V-2\305\3255I\3566l2wEE\004VS\244\246H\r\332+\347\324%\227=\022\335P\301Vc\3445hu\331\262\034DUffm\366\351\257m\317\205\341)!2\272^e\260\376\236\376\332\274\314\322\362\262\fq\0312\244F+\006J*\013\260\345Ad\305\320\234\230X\215\220)\032Ws^E%9$\257\032\353k\204h\275\305\271\272fLy\227CI\322\022\t\220\226\252=\0315`5`5]-Y"
+	.ascii	"b`a\202bZ\273\016%yy\325|\275]SV\336\332'F\250\240\200\274\346"
+	.ascii	"+\270\246T\305N\371\003fK\002\35314\324\243GM\227W\f,LE(\271"
+	.ascii	"$w>^\323\025\b\345*\327\203\313*\005\337\212\276\255-e\2167;"
+	.ascii	"e\345\315\253\253K\220\226\025n5\325\232\252\f\226\227\031]\332"
+	.ascii	"\274\002\271X}\310\310\221\243F\013\371\3264"
+	.string	"\326d\234\333!\304C\307k\264n\\qae\005SM\215\232\0325Yo\365\250\313\317\213+\fn\311\215\327d\351\2721\273\273\032\033*\276\324\320\250\241\301\374\241\225R`!Ra\245\206\252\206\252\346JG\221\211SV\333\016\202\003\nP\325k\256j\254\2523\262+\254d\310\035a1\305H\0030\016\213\212\263\232\250\232\250\232\030^\236\272\300\262F%[js\215\324kb\324\270(\272\020rc\316\32550\336\026F*(Y^*\300j\226j\226j\240\230U?Z\206LO]`\3317E\235\024\222\232\247\327@-IQ\003\315\325\327R\343\004\205lK\316\251\306\205\337\016\263@W\3270\325\264h\257\227\253i\272\266+\272\222\332\332'\230\345\336\267*p$%)s0\253~\374\220LI_m\331\366\206\024\227\254\252\243\243\031\032%^+[x5T\024\261`\321\002\361k\256\206\214/+V\324\020\221"
+	.ascii	"9\026\266\205\251f\3505D\303\260\033J\325\272\354\031\221#Vj"
+	.ascii	"R\324\2440\301\f\036LS\224\324\004\325\004\3154Q\215\275e\267"
+	.ascii	"\327\0163\2512\232/4_j~\366\250\374%\223<\031aQ3\277\346\347"
+	.ascii	"\375z\341\344\205\253i\002\225qT^\264\230\\M\003\370<\242\237"
+	.ascii	"\"\026?\270p\241\351\002E5\366\346\325N\021\312\242\364w\232"
+	.ascii	".a^~M\301>20-cY[\266\264QTco^L\334\226\340\245x\241E\313\034"
+	.ascii	"\025^W\326\310X\334\214\024Gx\247\271\202G\303\027\264k\2553"
+	.ascii	"T\325O\226\005t\241\262k\312\302BX\b\201B\203\3454|\247\331\373"
+	.ascii	" \204\347yu\331\001\271\232&\013\r\226F\357y=\362\214\262\270"
+	.ascii	"\232&\357nPT\2625f\204\004\347\256\352\202\\Mc\205\3106E\303"
+	.ascii	"\252M\241\"YMVi\356\224fP\351\3225\376\302\360\356\204\270\274"
+	.ascii	"\250\372\342j(Ph\354`9\247\254\266c\323\020-\033SNc7L\201e\235"
+	.ascii	"r5\215\024\030\025;l\244a]MS\007\243B\313\t\026*W\323DQ\356\020"
+	.ascii	"\252\273\306)w \2258\261\002\022\307\204\t\315\223 \3059\343"
+	.ascii	"\225\226\024cMN\363\204f\216m6\233\243qB\307\304\311j\311\346"
+	.ascii	"\214\311\222\034r\210\202\274!$0@F$P\210 \021*S\242\204\006."
+	.ascii	"G\321\213SV\033q\215L\005\226\246\3554p4K\366\304\376\236,\241"
+	.ascii	"y{\001X$\311\214\356\305\013\0327\230\025G\222L}\315HK\243Yc"
+	.ascii	"\356\031\254\207\023lR\256\306\016%\265\323\254\035\2533\242"
+	.ascii	"$\021\202BC\243A\302\3343\330\226\034\274\344\005\006\032\315"
+	.ascii	"\221\323 \021\266\250rT\343\310\314\214\246\bZ\024*\177\355\225"
+	.ascii	"\235\222\331\331i\212\034q\234e\327Z\241\237\353U\006k\310\204"
+	.ascii	"\002J\013\033\037"
+	.string	"\315\020\232!2XC\325 &^~P\031\033\243\021\302\254\372\361{\231f\210\365\310\352}\261\310Bc=\215\220\344\2215+\223\254\377\304\017`\371X\333\242\001B\003\204&,\252\251\006T\366x\303Z\026F\003v\2320)!Ht\320\004yQ\355\301\"\b\315\327\025\251\257\007\315\027\261\206\322X\333\327\024\215\017\032\0374?\222mRY\200\272H\025\334L\323u\232\0370K\224\320\256N\2245\334\332zX\tb\301\203\007\rW\221)\006\026\246\340\027\221\035\325\326i\270\264\\\351\304\202\202v\354\340b\263\362F\364\244\n\215\016\032\0351[RY\200I\251\243\025H\220\340\3001\303\304\254\372\311\222\201\017\246-R\331\2614\273*\0346l\320\334\370\013\026\003\013\223\221\213\266\03647\224=\364\346\2360qA\203E\203\365#\312\026\251\354\273U\203\007\020\020\215\025\215\025\315\f'c\031\234\227=\232\253\323\314\370"
+	.ascii	"\213\026.\266D\235"
+	.string	"f*\212\246j\330\306\274\261\3542Ck*;\017Im\220\203E%Gu\232\252\313\275\201W5+\232\030C*S\232\220\271\232FJ\b\243\205\225\0360~\242\321\206\334\334\236\220\375\366\347\213\006\212\006\312\013\325\017?\257)@\246f\0344M4M4N/ \325\017?a\323\334\013\0324.N\343\344\366\242\013\306\023\215\022\215\022\r\323\333F\365\303/\350E\204gE\263t\032&%tW\236\270\372g\246!\242!\242AbV\375\354eP\233Q\203i\030F&\304\350\3504H4\263\013\024t\205\207\221\325Y\026\226\253iX\024\315\230\266\344\261\321\024\201\321\b\321\b\321\254\310\253\"\355\236|\204\2518\315\n\300'r\\\256\246IA3\343\r\rq\331\370\362\205\006h.\t\353M\030\367d)\217\346\3474@\305\242\246\257/W_\013\315\f\017\021\342\241\203f\236\t\314B#\"\344v\204\002E\252\210\253g"
+	.ascii	"\213E\2220\271\210\232\3512\323e\206E\222&aU*\\\375v\016\312"
+	.ascii	"fg\270\020`\212*0\252h/\216K\320\312\025\266\205\210\253\177"
+	.ascii	"\002%}}3~\314\252\237,\013`j\252\001\2255\242e}\374\314h\371"
+	.ascii	"\214\2372\254H\227,\\\256\276\026\230\357?\361\350\2257\345\205"
+	.ascii	"\253\177\202\262\275\275\031\246jS \334\217\030op\256\376\t\272"
+	.ascii	"\364\364f\260\314\252\037-\3056\247\254\266\254\373\"\211\020"
+	.ascii	"\036\226\317`\211eRt\374(S\374\354p\365OPu\345J\016l\331\224"
+	.ascii	"\275-\256\376\tX\340\341\275L\234\272\344\262A\\\244\351p\365"
+	.ascii	"M\300\245\256n\346\216Y\365\263'\002 \225\337^\026\007\227_\365"
+	.ascii	"n\206\312\236\213#\033\256\266S\253Ziq\365MP63eFJ\031\221#?\256"
+	.ascii	"\276\tv\354\233\340\305L\223\231&3P\234\236\272\300\274R\334"
+	.ascii	"5A2C\367\031(\035|1\225\271\372Zf\236\374'\252\340\003\216m\346"
+	.ascii	"\311\314\034\024-kMr3N\244\232\250\361p\365M\200\264g\344\222"
+	.ascii	"?\250b<\301\271\372%\b\234\211\233\211\233\241\201}\257iL\216"
+	.ascii	"\256,Y2\323Ge%\266sTy\351\341\352\227\300\211\232\332\214\033"
+	.ascii	"\216\327\013\222\226\032\361\352\303\311\311\314\332g\334f\332"
+	.ascii	"\234\220\315Vf\332f\224\354\350\332r&#\031Vdk\312\f\033\021\006"
+	.ascii	"\225R\022\245\013\263\"MV\256~\t\312\222$\2319b\004\316\202\353"
+	.ascii	"\261\344\352\227\300\007\032\332\314\021f\325O\026\0038QY\211"
+	.ascii	"\301X\254\035~G\360~\320\355p\365K0\243H\021\031,\025^\0272\273"
+	.ascii	"E\265\346\352\223 kf6s}Ph\236\002\"fT4f\245\254l\346\332\222"
+	.ascii	"\315I\025\364\r\223`\341\212\256uMOsYW\237\004q>>\363\345"
+	.string	"c\206,y\326\3163\324\034$4OQ\335<\241\262k\312\316CP\033\034\221D\001\251\n\362\031\262\317\214}\020\302\214\020$7+?W\317X\221l+H\020d\317\210\035\t\345\204\r\353\352\317\200\315\204\375\304\"\027\215\262\037\256>\t\270\366\021\260\311\234\226\226f\274>\003\344'\302bn*\352\\}\022\340\3303?Z,$\272(]?\321\230%\207S\226\253O\002\254}\022PU\2533\\LT\376N\360\204\205uf\3533\\z+\264\210\246\270z\206\2072\016\215\257\316/\354G\027\026v\256>\t\222t\350\230\321bV\375dA"
+	.string	"\023\325\330[\266\215\321U\265\322*\226\221AQr\365G`W\243\306\f\216\030\257\023\225XT\220\211\222\2231\034Y\272\307\220\020#\03337\220T\324\362h\270\372#"
+	.string	"bc\0049ff\314\314\230\241!\207$\006\3475\204\343\252v\321\340\301ue\344\352\217\340I\352R3V\314\252\037-/\226\352\207\237\025\323\022\320\214\214\317X\021\365\324\252\260\\=\023c\246JK\210\222\354L\325\fU\033\233W\320\017d\214,\\c3SE\033\304\244*\214l\365?Q\250\303Z\344\347\352\267"
+	.ascii	"e\306i\306i&\n\r\210\312_\266\257\311\035\321\314\213\317D\351"
+	.ascii	"\031\241R\303\341\352\031(e\034\222"
+	.string	"*H\276\\=\363t,\260\026\300\252\254\222\246&\244S\322W[\013F\204\313\027\264\245\245\031&\017\332y\005\221\253'\330y\206\332 \b\344\344\313\r\246*K^a\256~\013?\222\222\276\212AgR\202P\035\035\315\260ha\254Auz\325\261*0,W\277\205\026EE3,^\f\341J\360\343\t\n\213\267E\n1\033@\\\375\026V\b\t\315\f]\311\335\261eTdhf\205\222.N\234\\=\243\002n\302\326#0;\223\002\305\335\314\317\314\317\fP\324\320\353\210o+\206\221\027k3@n\022\016!*d\270\372(\336\264\\\213L`\337\321\037\230\227\006R\222\"\003\3602\201\256\033\r\034-\\-\363'\363e\263519\351\"\343%\230\203\t\313\212k\027.\301\"\036k3\270d\217F\246\226\352\374d\266\350\036mVG\272\374\366\225\"|]\316\\}\0244\252T\221\341cV\375\370\025\325\216"
+	.ascii	"\263\311=\245&a{\227\341\323{\321\2626\234\270ZFO&\313\2142\275"
+	.ascii	"\025\256\226\301\n\361v\334\340r\365Q4\311`\311\273\262\006\321"
+	.ascii	"\311\344\311\\\331A%J\020<\031+\201Z\272\334\\}\024)\266\f\336"
+	.ascii	"\366\213\013\243\212\342\352\237\350\2332E\206J\013c\r\302\253"
+	.ascii	"\202\305\022\323\322aw\031*p\225\214\025Y(P.\023\005\212L\235"
+	.ascii	"\020m\236\367\327\222\225\271\272\246\"\\U\2164\271\214\\\023"
+	.ascii	"\231'B$3\320\220\313\326\213\035s\227y\362<\025-\354\326\\-\343"
+	.ascii	"\344M\326\324|\344h\362\212\235\345\230Q]\262D&\256%\233\223"
+	.ascii	"^$VT\376\262D'R\216\204\301]&.\330G\326w\367ccmM\306\215\215"
+	.ascii	"\312J\314k\236\2416\200\001\362\273\266]\306\315J$\204\205\253"
+	.ascii	"e\224\350\"&\177TM\\-\303\026\354\233\237\272\300p\365\265lP"
+	.ascii	"D\304/\310\325?1o\0312\0312\231\264\026\307\336\217\267\027F"
+	.ascii	"\231\334[\222\313\244\271\301D\216X\317\\-SD\006\311\260Mj\013"
+	.ascii	"\016\311\221\027\373\025\343\316\210\f\032\354\243nH\314\325"
+	.ascii	"7\221E\306H\320\257\372D\344\305\3252f2g\306\270 /\204\316\212"
+	.ascii	"\302\372\322\\-C\344n{b=\314\256<tL\271\272\312\224\371\330\353"
+	.ascii	"\243\242\374iR\225\341&3\004\306\013\321\f,W\\}\023K\302\302"
+	.ascii	"d\254W\204]][sc\227\261\272^\260\326&\256\226\021k\315\230t\\"
+	.ascii	"\271\233\213\265 N\320~\\\006\310\017\231 \302#\363\034\344\201"
+	.ascii	"5\350n\036\202\332\240\310\344G\306\331W{\225\t\242\305k\255"
+	.ascii	"\213\327O\034\032\261\203Qu\365M\020\3317\241\265\265%\343\003"
+	.ascii	"\r\236\201V\346\327\3432>\204Z\\\220\320\271Z\206K\031\327U\205"
+	.ascii	"\210\2334\306\005\205\345\352\233\220!\243CF\207L\325H\273g\005"
+	.ascii	"\204Hf\307e\252zC\034s4\230\\-\243\245\214K\301\345\245\312\204"
+	.ascii	"\013\031\0336dp0\253\202U\310\250\374y\3150\274\334e]\006\007"
+	.ascii	"\0210\033\345\317\32527\224q)\244\262\256\230\030\242AC\006\313"
+	.ascii	"\235\347y\256\016\211\274\bR\235\241\2406H\n\321}-"
+	.string	"q\265\fV\224\036ZF\\}\023\263\f\0312WP\006\260\304\224\0016/C\254.s\345\345O\n\220\253\257E\346\b\310\027**\364d^\310\274\220\241ZrE\231\272\fUp\006\224\2270W\313\304\270R%\243\211\253e\244\202V\"V--W\313\300\220\211Rc:\223\314S\353\301\034T\267\206\301\026\266\343\323\214,D\234.\363\364\006E\375xr\265\214\013\"\220'4,W\3134\311\034\025w\360@\202\344j\231\0262GD\265/sY%\300\210\210d\224\264\274[\310\214J\372j\334%]Fi\017\212\235\225\253e\220\026\200\205\216\312\3252E2GiFp\201\256\376e\216d\214\2004\351\223\032\013\301\225\025'\256f\001\363\343\377,e\036r\365\265\350\242\271$/\177\256~\211\033\373\035\2642+dV\334\255U\332f+r`g\245\271\203\227\200!#$#$\223b/\003-Q\2406\200{\350"
+	.ascii	"\302\342j\231\024\032F\026\246\024q\256~\211\241/_d\200\004\300"
+	.ascii	"\267'\363s\031\240\2471\353\236\253ef\rC\312\224\2444W/\003\227"
+	.ascii	"\200>z\373K.\355\262K\027]\204\302\f\304\224\301\226-\037\270"
+	.ascii	"\375V\027\275\3772\273\314F\031k\360\245-\271\372>E\374\374\202"
+	.ascii	"\326\r\252\200\200,\360\233\262\362\326\312\275UE\341\300b\227"
+	.ascii	"}4K\254\370\276\354\033\032yQ\307\345\352\345\236\206\201\245"
+	.ascii	"d\n\221\253\227Y|\236\364\364Z3f\325\317\336\005J1\2600%\375"
+	.ascii	"\272b\340p\365}XL\231\262\274\222\343U\302t\367\345\225\245\225"
+	.ascii	"\024Y\262\242\270z\211\207D\222\002\013\027W_\016\\VYR\3210\274"
+	.ascii	"\312\224\270p\365\322N\256\253\253[\222\265-\242\310G\2348YB"
+	.ascii	"q\021\205\356K(C\032OF\300\\\275|\242\214s\245\344\030\302\347"
+	.ascii	"\352\345\234\314\243I\223\326\254\205\231\203\250<\251F\305\305"
+	.ascii	"u\211\"\257X\276-\337\226KD\b\004\262\223\312^\313\227K`T\034"
+	.ascii	"YkL\271\372T\274\345\332rm\331F\263Ff'\345\265T\362e\233\366"
+	.ascii	"\342\342\207\022W/\331\336'\032\330$jK#K#\3134\261j\222/\323"
+	.ascii	"\242\\\317\332\\\275D[\"\221\361\"mv\365\277D\262<\002\344\265"
+	.ascii	"D\367\301\370\302\205\332\265<[\236=\375Ua,\211,\211(\361b\264"
+	.ascii	"XQ\207\312\312Z3\346\374\263gA\334\236\265\203O\277,\255K\353"
+	.ascii	"\222\354\307\326R\310\227d\327\303\202\361\003\246\302\317\357"
+	.ascii	"\314\325\237f\331\377\022l\t\266\024#\n\315V:\340\250\244\257"
+	.ascii	"6\343\213\037jx\313\260a\215+\223\325\325\237J\331\237\306yy"
+	.ascii	"-\2776\250\232[\030@\356i\207\\\026\253Z\205\315\325K \273HN"
+	.ascii	"G\nW\177j\266?\255\356\177\331c\331c\331\265A\325\314\344\301"
+	.ascii	"\227\037<\247\034O\252WW/}\2409\031\242\304\325\237\316\330\237"
+	.ascii	"\266\330\377\262\372\366\272\254.\2676\250\232[\\\340\005)\n"
+	.ascii	"\224XZ\\\026W/yH\351\302\304\325\237\006\355\213@"
+	.ascii	"o\377K\035K\035K-\227l\376i{8a\001\364b\002k+\243\361\245\026"
+	.ascii	"\314\214\266\352I\305T\022W_\004k7n,qx\320\316s\222:.X\254\222"
+	.ascii	"\257y\231\225\2251\325\346\352\213@l_\004X\373_\322x{]\322X\326"
+	.ascii	"p\311\346\237bT\022\225\036^\\VX\001q\365\022k\250\003\311\033"
+	.ascii	"\326\325\027\201\213\375\236@\0312\226WD\241\031\013\310\333"
+	.ascii	"\345\324%\227U\312z\375p\365\322J\312\t\024\024W\277Go\277\007"
+	.ascii	"n\377\313\030o\257\313\030K*\242\320\f\264\243Xu\312j[k\033\302"
+	.ascii	"b9\365\004\216\206\221\253\337Sd\277\307\307\376\227Q\313\250"
+	.ascii	"%\214 \223\241\220\254\324\320\022\006k\005,+\252v\256~\217\322"
+	.ascii	"\376\227NK\247%\324\006Us\013\002|\271\370\213\332\322\002\006"
+	.ascii	"\347\352\345\023\336\026-\263\253/\r\334\227V\331\377\222\351"
+	.ascii	"\272dZ6\005\205f \255\027P\030'\004\266e\331\342\356jW\346\352"
+	.ascii	"K\233\354K\317\366\277DZ\"-\225\204B3\226\330\313\0067\351R\244"
+	.ascii	"\211\253\227I\256\337\0261)W_\272\265/}222\322\265d\363\017\222"
+	.ascii	"\251i\254\311+\030D+\355\352\352K\207\212\212\3464\023\320\333"
+	.ascii	"\023"
+	.string	"-CCN\252\033\311\305L\303\325\217N\331\377R\305R\205\221.\256\352%\207\212\035oBBp\360V\227W\235\253\037=\262\377%\320\022\2505ka\254AS\220T\347\031\256\203\243\221&@\232\204\354\1779/\347\2405\305\r\354\374\302G\021W?\252\003\020\320M\372\320\316CE4l`\347\031\256\203\375\206\005\207\fW?\032\265\377\230\277\267\327\230\277\030/D\241\031\350\253\b\3304\326\224%\262\323\201\304\3251]\\\261&\025b\256~th?\372\223\315\266fA\241y\312\3060\033\003\013\2230m\310\023\017W\237\347m\3771}o\2571}1~\232l\376\321@\323X\023\334\326\325\017\317\3251Z\202o_\260Z\270\372<F\366y\200\354?&\257\275\306\344\305\354\t\205f\240\257\241S\223\226\2277\351\256\007\213,\217\331\373c\364b\260\300L\265A+tU5\\\035\203\315\360\230,@~bh\271\032"
+	.ascii	"\355\362\215\241kg^7G\273|\317c\327^c\354b\254\020\205f"
+	.string	" #C,\322\226\230W\0239,\336c\254\3741Tb\356`\244\236\250\350\210suL\225\f\217\301\203\321\232|\331\341\352e\273|ev\266\354?&J\224\030)\314\252\231\t\001J\240\3409e\347Y\252\003d\020\024\",\r\006\007a2\024\027S\327\356\321\331\341\340\241GG\007\323\005\207\252t\032\331\026)\257y\206\353 \230dH_\022W\177Gnn\016\236\313 4\317\b{\275\222\2668e\347\031\256\203\342\233\320\2146W\177\207\214\t\223\030\271\r\252f\246\f^\340\273 \035a\256\216i\342\204\007Y\026W\177\247k\177\207\306\376c\336\2561o1pA\241\271jG\321+\211J\217\354\330\331T`\314\022\263\034A\246\270\372;N\373;@ll1m(T\315-\b\320\224\024\005,(\216\314H\214\022\276!\264;W\237\205,\373,4\331\177L\222kL\222\030\265\r\252\346\026\013`\222\024$\273\243"
+	.string	"\022\371\271:&\315\246\230\206\006\265t\335g\001\314\210\221\230#\031\204f  \260X\322W[T\022.:\\\035\203\2264W\225r\365Y\300\261\317\202\324\376c\316\336^c\316\212M\366\222\276\332\274\270\250\254"
+	.string	"q\365Yp\261\377\030\"\327\030\"\305\246\251!TS \334\320\312\311\013\fW\237\205\244\375\307\220\265\327\030\262\2302\264\352\215$eK\206\036S\366\267v1C`\254V\260Q\306$\315\325\303\020d\331\177\314X\314X\214\225(4\003\351\030\356\t\241\334\322\352b\2540Un+7\205I\316\325\017A\334\376c\202\274\275\306\004\211\t\323d\363O+\206\024\005\312\253\306\033\327\223\030\260\244\266\030T\256~\b\224\354\207 m\3771?\336^c~\304"
+	.ascii	"Y@\026I\f.\013\025\007\024\345\352\030\257\277.\210K\334\256"
+	.ascii	"\330\035\256~\b\212\354\207\340\272\265\025\343\243\310G\326"
+	.ascii	"\3431>\362\334\342\306\\\035\303\025\264\006\275\350\353\nA5"
+	.ascii	"\246\032S}B\026\202%--\245\222\017\355<\244\344*\f[\254\n\345"
+	.ascii	"a]}(\226\0349\224k.\331\274\364~\035\001f\213C\256\254\212\\"
+	.ascii	"}\350\332\376cn\264\327\230\0331Y\036\264\363\314vu\206u\372"
+	.ascii	"1e\026\223u\030\036\305\262&\274(-,\254\230\032-\331\2344\224"
+	.ascii	"\223\352@\267h2\005\212\361g\270\302I\027\027\256>\364"
+	.string	"i\306\f\032TF\251*\037\320\025VV\306\237\226lN*\202\035\001f\275\346Y\256\203\367\307\356\257\207\253\257se\3771TT1U-\214u\276\342R\235g\251\016\210t,dH\031\177\230\314\256\310\271\372:1\25611\214?A\241yJk\210=\372\003\023\346!\325\025q\365u\204\354?\006F\f\f%\022M6\377\274^G|[^\363\f\325\201;\245\211\221<W_'\307\376c^\274\275\306\274P\032A\241\n\250\305\005\200G]~\310\275 K~\\}\235\247\247\247]\335\240\n\310\312\002\254T\340\037\217\257k\320\026\027.\216\024\361\220\340\230]\375\034\273\375\307\264h\021\203\324*\205\346\031L\252\363,\327\201q\313\274%\317\325\317\221\333\177\314\322\322\324\321H\221.c\256~\016\333\376\211\\o\257D.\345Yp\250j^r\200\022\246-\271d\035\225\324\221\230\243\366\032s\024\203\024\034\252\002\2722"
+	.ascii	"\223T\027\271\354<\313u@\214A#\b\312\n5\204D\fG\314\212\230\025"
+	.ascii	"1,\\l\025=\206\005\361\005\036\227$W\307\020\005\255sKCF\\\035"
+	.ascii	"3\244\214\303\006I\311\002\365\2378|\273\3626\304\325\317Q\n"
+	.ascii	"|`L\212\303\314\363\034fe'\225\215\021zL\n!2\310\306\\\0353\307"
+	.ascii	"\004\375'\232\360\023\327\025\023\024\003\0048\306\242N\007\262"
+	.ascii	"E\017\274&1?:F\373\345\005\306\326\236\237\237\362\313\036\001"
+	.ascii	"\266\354y\271\362K\221\224\031\332\227\253\225]\224qF\032_Z\254"
+	.ascii	"\256V\376\351\"\036yX\\\255\344\322\202\t\351\372q\2652\253\213"
+	.ascii	"\350\226\324\266\\\255\334\242\231\310\260EF\332X\304\244d\352"
+	.ascii	"MOO\331wW\345\273\262/J^\331\227\253\225X\224{\377\211\322\237"
+	.ascii	"\272:\345\2362\313<W\305,\017\312\311\337\0346\250\246\303Rd"
+	.ascii	")\005\271rEY\367B\252J\202j\312\024%\336\003`\024U\253\\\211"
+	.ascii	"\347\356e[X]\255\264S\336\355+\241k\222;*\305\026U\256n\302\033"
+	.ascii	"]Z\034irr'\312\272=\317\363\217uN\212\341\022\305N\312+\312\225"
+	.ascii	"u\303\0327h\374p\265rN\t%(t\243\013\022\024:\341\235\013$\255"
+	.ascii	"'A\255\016yaK\224O\\%Lt\300\361\221\230\367\225n\312\267+\227"
+	.ascii	"|\211\262I;\317\363\274\306f'\225\235\241\2246\370\225L\256l"
+	.ascii	"\222%2\307\026\367\237(b\n\336\22388\270\032\305\367\005\210"
+	.ascii	"S\320\337\022W?\226\262\377\267w\377w\006R\232\347\231Ih\235"
+	.ascii	"\225\202\214\357\337\276\025\266\355\006\377\261\r\266\030\374"
+	.ascii	"\327\301\237\032D\003\363\f\304I\216y\236\333\276\315\225\006"
+	.ascii	"\004\303\202\371\377_3\317\363\322\220\320\374\323\016\225Y-"
+	.ascii	"\r\225Y))\207\344\254\226f\241%/!\253\252vH\310JIIh\376Q\316"
+	.ascii	"eVJC\263\325\022\314\\6?"
+	.ascii	"\r\225\001\375\264CB\363\322<[\3150\363\020\320\322\\fUR\016"
+	.ascii	"\225Y)\r\225Y-)\207\312\200\226\206\346\252\031f\310:Ci\266Z"
+	.ascii	"\375(Y\224\001-\315eUK\312\271\314j\211\310.\013\217\005\310"
+	.ascii	"ak\300\270\226\361\355h\263\f\t\315HGR@J0tC\326\252\371n\236"
+	.ascii	"\3333\025\263\322L7\317\030\314\263T\225\322\035\320S\253\026"
+	.ascii	"D\207\024t\004\250\252\265\316\363ls\024tU5\013\321\375\2643"
+	.ascii	"\335P\217\252y\356\021\2443\037\315\363<\203\360c\245\233o\264"
+	.ascii	"t?3\244f#\025\363|3[\347\371h\236\177\332\231n\236\347\237y\236"
+	.ascii	"\207JR\326y\216\202\031\252\036\035\3153\024\363h\226\372YS1"
+	.ascii	"\317\356\031\236\332\322P\331UU\2065\"e\325y\205\365\247\035"
+	.ascii	"2\252\232\253\363\235\225\322.\373\0212\033\315\363\334\362\355"
+	.ascii	"\352R\213=W\353\250\261\033TJ\266`\025@!3W?\266\332J5\027\311"
+	.ascii	"\326\366$\213\253\037\023\355\037<jtq\265\325H\224\\\rW+\217"
+	.ascii	"\350&i2\322\\\375'\227m\225\201\372\201\344je\021\235\203+\210"
+	.ascii	"\227\253\377\254\262\225fC,\330\234\\\375g\224}\275*\311\036"
+	.ascii	"\024\232\247\322\252\363\f\265A\020KO*\206\253\377L\333\277\262"
+	.ascii	"LI6#o\213\362\353_J\262\226lN\262\2516\325\200\312\3163\324\006"
+	.ascii	"\033,L\213\211\220\366\252${1K\006\225\235\253\225bJ\353\306"
+	.ascii	"\002"
+	.string	"r\204\315\252\034sb\213\2026\246\271\332\030L9\306\\}-\312\260\032:\250\254P\206)\301\230\262,|\f\271*x$\325P\0061\002\001\311\350\202\347\352?}\354_\351\345\225\024\262A\325\314\004\002\037\333\226\\`R\222\031\256\376\363j\373Pv\265|s\220\221\253\377d\341C\311U\307\205F\023\277-e\365\355UY\325Z\355\322<\003}\275A\230\354\244\262\263\222R\007\307\261\333\277r\207R+\016\213\224\305\325J\035ER$Y\342\352\343,\331\277\022G{U\346\020\006a\263>)o\274{\363\223\224\253\2173\246\264\241\304R\300\\Wu\365q\272hh\260\025\250\264@]\261z{UZ)\253\320\214xH?\260\\}\234\253\375+e(\253\306V\034\361\341j%U\330\021\034\027\373WJI)c\b\205f,\033\305*\022^T\007\262AU\\\255\214\021\264\266I-?gv\256>N\3226\376\230"
+	.string	"\243\205\222\027o\257\312\027\312'\242\320\f\204\343\205rae\356x\005\306\210\300\375+\241\224O8\224\236\360\\\255tz\213\322\"\245O\331\344\302i1qs\365G<Q\266\320`+l\201\222\304\244\364\366\252TR\"\265d\363\017\214\205i\213\324+wE\364\345\352\217@\333\2772I\211$7\343\255\210\253\225GX\204\362l\270\372#\300\264\250\236\324\\\375+\213\336^\225E\312\241\r\252f\246\005"
+	.string	"\"\005\366e\347\031\252\003\242\225V\212$W\177\304\215\375+\211\224C\035\256\214Z\270Z\271B\350\230\205$\016\306\376a\266\264W\230-\312\024\033\354Y\350/\tv\236\245:p\271h\001\n\022r\363\340\224\bY\313dt\211\262\001\363we\320\017\223\205\341\242\004\202\305\210\266\262\270Z\371\363*\001\262\245\345\352\2170\332\377a\002a"
+	.ascii	"\333\253r\206\361\242\234a\276\200)g\230.5\266~\274e\357\210"
+	.ascii	"\370\354^\375\021+\366\235\331}'v\013\3412\034\346o\350e"
+	.string	"~\253r\365\255U\355\314\273\205\332\345{g\335_]\322\026W[a\265\251\"M}X\314\342\2728\271\372-X\236\216*\214^\016,0V`\256\324iU\261\024\317t\321\373\226\005\206\017f\017\006\333^a\260|\310\307\227\227U\324w\266\355;\223l\230+ynU\315\220\f\311\326\230\253\357\024\262\177\030\274d\223\227\270%8\230%7^/RY\200Y\271>\251,@(0S`\242\300\314\301H\201y\002S\005\306\016\206\016\246\016\346\256\275\302P\371\335,\030'!\304\205a\327\206yh\3256%\251,\300,\f\025\230&:\314O*\0130K\3076\3143\202\345R;\202\235\347\031\206\n\f\023\315\004\346\006\263d\fK\005F\3110\257\002\242y\266\232\0322Ie\001f\211\\\246L\251\301\324A\247\323\276\263h\3379\357\257\220e\177\005(\033\346-\271D\013\225\232\253\277\202\333\376\nC\366W\250\356\257"
+	.string	"c\177\205y\277Ye\277\251\266\177\2304\230$e<\264D\271\032\211\220h\357\212\016W\277\371\265\337\202\r1\002s\004\246\b\314Y{\205A\203!\262\004\006\r\306\fKY^\025\006\r\346\252\213\034\360\364\327\006\007\247\220\301\246W\324o\262\330\007\201\226}\020T\331\007\301\223}\020\310\355\037\206\f\006\210\260\t;?\021b\365\241\243\305\237\253\307|\260\201@m\277\265\366\200\001\002\343#h\265R\245\343\202\001\002\323\245\277*\b\032J\301\013\017\013\003\004\306K\356\211\257/\013\363\005\003\006#\006\023\006\023\244\275\302"
+	.string	"\201\371q\367\225Eg\324\007Au\037\0043\366AP\265\017\002\251}\020\270\330\007A\322\376a\266x\344\344x\262\305\350\025\366v\007S\205\331A\205\210\\\021W\377\256\3650;nL\342\344\212\245\005\243\003\351\365\344v\006\223u\030\035?\f\016\230\034\355\036\221+\220\024W\2676\332\231w\246]\276\303\263\f\207\311\332\200oH7n\\N/\361!\344\307\006\223\321\306\322\021\03105`\260\202>\220\366\360\340\0244\312\242\320\200\231\201\374\242\252J\2013\352\222\205\271\202\261\332i@tG\2608u%\301\310\200\251\302:I\311\"t\273F\251\240\232ja\bQ\222\302\325P\233);\243\305\220b\361\305n\210~\355\262^e0`\242\\,S"
+	.string	"Y\300D\335Mj\2318y\303{\241e\004Bq]A=aa\0259s5\214\023\322\027\025]\366\333+\214\213&\017Sj|-\016\323T%\005Q\013W_\013\f\323\177b\321\016\257\013\035\023\214P\212?&\0019P\022Q\351\006*"
+	.string	"*@A\002\0055\002\210a\212\240\002\0138\261\316\006\033\001\310Q\250\005\3178\232\003\245F}\214E&5\316\211:A0\225\260\f\225}0\340|\240\241\207\007G\370\214BM\304 f\250\035l\242P\347\224(G\241Aj\0345\001\211b\247'\006\001\215v \3413\202\272\251O\350\007\013.\200\231qS\004U:\305\201zX\312\361\t4'\310M\026\250N\271(%\021\355"
+	.string	"\313M)\211h\007y)%\021\355\220#\363\334\020Sa`\342\234\250S\007\207\211\242\007\211\242G\212Cs\235\023S\231\230\30795\241\207\352\341\304T)#C\243\035\220#\3047\327\271\2003\305\200\263\314\211BA\360H\247&07<\235\322\035\231\344\t'\240&<\243#\304\262\363\t\335q\226`R\221Oh\264\303\023\332s\244\312Q\250\264\347\031-\001\207Z\202\f\215Badh\264\003\f\016\216s\031\242&\346\201\212`\201\352\024\021O\245\321\234\016\025\300\036,"
+	.string	"\342C\t%<\235\361\264\b}\226\200\302\351\341CM,;w|pv\234\033(\220\247\316e\217T\016\021C\rqs\235\0132\206\002\344D\241Q\037\021(vzz\2343\312\367I\215\372,QL\235Si\017O,BD"
+	.ascii	"\256sA\nmb\260\2633BLuNK8\0015A\216C8wzb\020Te\2743\302)\373"
+	.ascii	"x\300 f\301\351\001"
+	.ascii	"\226\2331\017T\004\216<%\312q\b\034y\372\366P=P\213T\252\222"
+	.ascii	"g*%\021\355P#\307!\250\035\250H\247\354\344`\244\032\251P\352"
+	.ascii	"4\356\201\221c*O\314\363\312\240 \341\031\205\222\020@\0022\210"
+	.ascii	"P\374@\203\nOg\f\"jB\372\224}tB\300\327\271@\202TD\315S\352\301"
+	.ascii	"\004\026p\234=K\026\250N\021r\234\0233\264y:\245)\310q\016\005"
+	.ascii	"\033\3448\347\0029\316\231y\306S\250\217\bb\020r\234\243\244"
+	.ascii	"\366p\330q\342\350\310N\036\f25*\305\021\222\220\243\320\351"
+	.ascii	"\316\333\201\332ay\242\004\251\by\032\227\240\301\200\023\200"
+	.ascii	"\270\031\3478\345\020(p\242(\240\300\211\306\262sg\346\3032\352"
+	.ascii	"\214=\034y6\354\214@s\235\013Ti\217\024:ub\340\031\313N\036\250"
+	.ascii	"L-A\216s\224\317\016'\244$\240 \341\204\224\204g\024J\002)\307"
+	.ascii	"9\307xg\204s\007\352,1\202<\225~\240\362H\2431\207Xv\202\220"
+	.ascii	"\221Be'\210\017r|\0024\n\225\343\246\034\347\314\310E\016r|\002"
+	.ascii	"\216<E\306\240\350\020\367\240\020\201\202\204g\024j\0023n\001"
+	.ascii	"\032B\216O\220\343\023\250$B<\243P\022N\200\220\343\234\230\251"
+	.ascii	"SJB\207i<\365\221q\234$|\242N\017r\234\243\274\316\005*\215\334"
+	.ascii	"\214[\200R"
+	.string	"\337\235\035\237hT\032\035\232\220Nudit\030O}zt4\336\231\312\3247'\n\235\312!\222\327\271 %\021\2056qHDs\240!\3448\307\0307y\340g\207\270\007\205\b\037\034\017r\234c|\306\3218&\201\352D\001\007\307)3\225\312R\0176N\331\311\341\b\245RA\310q\316p\211\002\307\231\023\247 \30795\036\3448\007\036A\216s\340\270\211L\312q\2162n>;\310M\230\270\371\354 ?\2351\b\030\031\005\t$|FPc\342\022N\252\214\216\f5\321t\342Hwv\234\024L\345\017$|FP\207\327\271@%!\205RG\214\360t\306 \250$\220rN\024J\302\207\204\370)\305\211\226`3\002\tg\274\243\343\251T\246\306\323&\0138N\231\332\214B\345\035\250\317\210f\263&\001\031D\200?\320\240B,C\247\031 \3413\202j\224\241\321\016=T\236\2412g:\202\216\f\315"
+	.string	""
+	.ascii	"\2261G\034\351\316\316\b16"
+	.string	"#\364Pyf\2361\317\364:\027\342\251\024\007\003\016\211\347\216\024\205\034'\3170\332a\t\307\315\036\352\206\020\024DM\350\241\362\320\310q\210\0339\032\363\370\344LG\240\211\237R\0171!tr|\244S\035\231Ju~xF\241&\364Py*0\301\204\036*\217\215\315\315\323\031Oc\342\247\324C1j\002\210\036*\017\0347id\231\n\344\032\031fFn\346@I,3\220g\344\030y\346F\032E!Cw\234>\"\210yBKP\223Q\035\234\246\224D\024Z\202\332\f\361\341\004\244\316\006\036\237h3\304\207\023\210\305e\314#EA*\"\306\211:e*\364\331\f\361\341\204\030\371mN1\340\220(\3120\025d@\215y\234\025xB{\366\007\345\006\033\031F^\3123r\223:\215w|J\230\211\237>2T\226\235[FN_a\b\036\251L\245\326\3109N\236\240\214\203\343\f\366Pyd\002p\001"
+	.string	"P8\247\323\0210\350qz\340\320A*o\3400\002\r\365\331a\003\365\331!\211\201g,O\245==>\324\033\031\231\353\\\300\220\3433\"~\nA\310\320\023\344\251T\207\n\023\363@E\304\262\223\003\361:\0270<w\240>#b\036g\005\212\033d\037\013l\350\241\362\334\260\020\365\321\331\020\002"
+	.string	"(vzb\016\322)\212\023n\250<\323X\346@\001\225\304\023\372\241H}B?\204\210e\350\324\304\022\305NO\f\002\305\324\311\303\343\023\3429un\340\020\202\202\343@\247q4\316\331\007!\001\bH\200\b'\206\027\201\001\0360\300\203\367\"0 C\006\006$ \303~\0022\004eY\226+\020\0235\341\303\t)\tq\013P\033e\334\004\3013\225\246\0207\2519\316\035\023\342\235\021N*\224\203Lr\032\363\370P\343&5\366\021A\fb\032?\235\322\035Y*\035Q\0237\237\035bdaR\216e\2262O,SQ\204\210\237R\034Mm\246\020?\2458C#U:EqB,;w\220T\025N8y\204T\025\342\035\250\361:\027.\220w\314\343\254"
+	.string	"\013T\247\210\021>T*\224\210B\206N\245\320\351\007$U\205g<\205R\343gRn\362@e\230\252\302\216\362\204\223'\206\252\302\216S\226\31228\361\211\022n\250*\350\310\036d\210y\240\"\234\362N\314!\246\211G\310\211BKHy\230\362u.\3048\316\251\334\324 *\245:\343\351[\242\204\030\3079\0251\215w|\236\261\016\016uf\3033\032\023\237PW\276\316\314\024\372$R\233r\314\002\216\363C\017\225\007&\3413\"\370\344\301\tN_j\216s\207\204p*\177\210\312T\351\207\036*\317R\216\2334\324f\234\343\244\252\240,\306M\023d\266\3344\0321"
+	.ascii	"\023\357\214p\212(\361\312SiO1nZ@"
+	.string	"\236J{\216T\3510\226\235 \236>\316\021;n\001\032\"n\001\032b\313{j|:c\024v\240N\021\323\230\204\261\0044\306\211A0\213N\331\311\341\304\0249\225?t\210w\236P\343u.\304<PYv>\233\360\324\031\243\320:rT\312#D\341|\006\251S\037\251\216\220\032\313>Q(\317\220\372\214Jqb\352\220\n\335\331\201&\2230J*T\032E\356\304%\232$p\340\034\247\334\304\221\306\306\034\247\334\234\356\340\234hJ\247\316\021\307'\264\007\346\221F\343g\223J}B{\224Q)T\216\306%\342i\317\215\005\2623f\301)7Q8M8\243>\323\001$\2339N\236c\216\223\307\b#\2338\037@\2339N\236$2J\305iB{\340\034\247\b\271\307g:\215\345(\324(\235\306\034\310q\362\f\2339N\236\245|\235\013%\342gN\017S\366i*y\2442\325\007'\311A8\244\372\220"
+	.string	"\355\241\2769N\021Q*\316K\365!\001\347\003\350;\002\316\007\320b<$\342Lc\266\t'\n\2432\316\331\221\3524\345\035\247\214\t'\n\031\016\032`LHw\220:9P\235\344S\303\216s*\373\304Q\342S\3033\352\034\361t\306\317\245\t\351\016\374\324`|jx\306\311\353\\\200y\276\317xg\004\365\271\023CI\310P\215M\026p\244;#\216\324\251T\306\201>\343iO3.\001\225{\234O\347\222\312\223\344\351\231\306\315x\352#\3678q\232H\371:\0270H\2415r\r\265\371!\206\005\252\323C\324\207\204\021Z\354\241\362P{r\224\262szB:\202\005\034\347\316\b\032\352T\332\003\267\240\323\364i\316Lc\031\3079u\352\3404e\251tD<\205\221{b\231\252M81\265\211\237R\036}\235\013\030"
+	.string	""
+	.string	"\2434!\335\241"
+	.ascii	"I\202\204\224*\023O}\2361\216t\332\023S\303\002\016T\2466c\022"
+	.ascii	"N\352\016\324I\202\231\323\263<1-\3668yp\246\302g\254<\021\357"
+	.ascii	"\364\370p \261\343\324)F\241\0264s|vz\230\323g\024:\242);\251"
+	.ascii	"M\036\237\251\314B\334C\245\300\030\3578q\212\3624.\021\205\342"
+	.ascii	"L\237P\036a\024\312\263O8y6\217sC\211\036\02211\324\311\214B"
+	.ascii	"qb\252O\363\204\223\247"
+	.ascii	"yb\n\237\360q6O8y\222\324\0318~Jy\224\002\250A\3213\255\240\331"
+	.ascii	"\314\211Bq\246\027\3644y\234S\022M\234)\265\t\245R\2476OhS\206"
+	.ascii	"F}\216\037\354\234\230R\2232\325I\242I\365\031AEN\243\324\346"
+	.ascii	"\211i\222\005\252\223\247Im\306O\350\264\207\312s\363\364q\216"
+	.ascii	"h>c\331\t\225\2459q\224\004u\212\303\274\316\005\f\307\370)\365"
+	.ascii	"@lRM8Q\324\364@wH\360\024gZ\320i\222\350\331\221\345&\211\370"
+	.ascii	"is\235\013\317X\216wzx\244\033d\250\024\37049\314H\2471\007p"
+	.ascii	"p\234Cy\032\3131\2174\306\207D\374l\3125\324&\225\007:\025\241"
+	.ascii	"\203#C?<\243#\354\354H\247Kj\323);9\204\240\366\344(e\236\r\362"
+	.ascii	"\216SHm\342HS\240\366\344\034e\347N0*\335\t\352\354\354\004\237"
+	.ascii	"\032\206\3178\356\t\001\307\324\251\217t\3033\352#\235\346\030"
+	.ascii	"{\244O\035-;C\360\370D\337\353\\\240\366\344`\220B\251=9pL\355"
+	.ascii	"\3119\366\354\270Y\214\237R\017T\347\b\352\216\233I\251\354\343"
+	.ascii	",\306\315\021\250=9\307\247\217\223\004\251\354\343\334\322x"
+	.ascii	"\007\272\343\314i\306T\237\231\270\031?\245\036\340\023\322\235"
+	.ascii	"\021\310\030'*m6c\036\251NS\216\251MjONM\363\251\241\031S}\232"
+	.ascii	"\324\236\034\030\0242t\232Cu\216\240\"ej\274\343\304\t\221T\236"
+	.ascii	"\360q\316Lc9\032\313T\237\020<\2350\362u.\234\220\216h>;\310"
+	.ascii	"\3218\352\344\231\306=0\265yB:B(\214y\234\0258!\0351\224\245"
+	.ascii	"\"\2361\013Q\350\316~F\245\033J@e\234\021\342\247\224\307&n>"
+	.ascii	";\234\220\216\030>;\304O)\317\273\341\204\2173)?\243\361\220"
+	.ascii	"\332\214s\242N\020\310\236X&\3069Q\347T\0307a\034h\2164\205\370"
+	.ascii	")\345!\312\327\271\200\001\207\204\264\347D\t\304Xv\202X\212"
+	.ascii	"\360\204z\230\352\310C\021\244='J\230\352\310\233\2123\235\276"
+	.ascii	"\324XvN\205\316\036y\263\340\214\247#\232\316\036\031\031\367"
+	.ascii	"\240\220\227=4\305\370)\365\340\354\221\207\322\236\023%\340"
+	.ascii	"\200\240\306\262\023\004\0138P\037\021\300\370\360@\341\036("
+	.ascii	"\013M\036\234\347\273\263\343\344\241:\221<SgS\246N\241$\232"
+	.ascii	"Qis\307\2113\3033uR\241O\345u.83\2406\345h\314\003\263\263#\235"
+	.ascii	"\302Fj\034Osb\016&\234(\212&\234\323\340u.\370\360@wv\244S-4"
+	.ascii	"\341D\021\244\306>;\316\022\357u.\234\230b81]\312\315b\334\203"
+	.ascii	"B\204\006@\2040J\247\037NLw\234\320iL\2051\306\262\023\204\016"
+	.ascii	"5\236\222\210A\234\230\036\247\362\207\250\t'\210)<\225?\370"
+	.ascii	"\310N9\304T\376\260\2446c\036\250\034\365\001qb\n\0235\201J\215"
+	.ascii	"q\244\323\0178S\0309>\001g\032\0235a\232t\312N\0168\260Svr\210"
+	.ascii	"y\234S\022D\252\n<\316\251\t8 d\252sG)_\347\002U\216Y\300\361"
+	.ascii	"\0311\314\221\312T\250\016,\224\233 $\340(_\347\002\206\234\036"
+	.ascii	"\232\234(t\032?\247\322\030\204\005fJ\304\034b\331\t\302\b\023"
+	.ascii	"\225B\251\323\270D\264\003\217\211\017J\036\023\037\2361N\024"
+	.ascii	"\0055\252BL\365A\312\324\251\017\t1\325\347\210b*\307<\361N,"
+	.ascii	"BI}w\2448RY:\375 O\245=\324\250s*\202&9\215y\240\"\236qN\324"
+	.ascii	"9B\206\222 Ku\250\034b\252\017M\354\263\343\304\200\005\342\235"
+	.ascii	"g\207\035\247\f\315\201>i\242P\036\370\204\223\007~F\235<<R\234"
+	.ascii	"(\224\247(\375\200\224OHG\004\251\315i|\002\352\341(\373\364"
+	.ascii	"D\241\260|\235\013T\f;q4\352\324\331\300#\235\232\020Cm\3628"
+	.ascii	"\247\316\017\322\022\323\230j\244>c\3524.\021O\223Q("
+	.string	"O\360\204\223'\030\357<\237P\2367\226\235S-Kw\240=\307\230\307\031\205\257s\201Ju\366\360Hs\234<\302\r\034F\310q\362\274\327\271\020\225B\235\030P\23388N\241\214\023O\233E\034\234\021dpp\234\373\204\fM\034\034\347\373\342\3408\267\306\301q\032\343\247tC\211xj\234\306;;P\022\357\006\016#\340\3408\337\030'j\001\231\352\214S\220Gx\306\262\363\331\243\002\025j\2033\305\200C\202G\206\222pB:\302H\225\241#\264|\235\013\317hL\2446\345\251\363\003L\334\203B\326r\3638\225\3128q\by\352\224\251\360\216\323G\236B1P\001\363\225e6p\030\201\031\3578q\250\262sD\t\342\216\263D\t\350\223\032Oe\347\210\022\307\353\\@n\231\032\313\316\024\342\034'2j\3029\345\2403\002\317\276\316\005\3443\371\214\243>\305g\234\343\244\302\0330`B\272\003s\235\013"
+	.string	"\2406O8\243P\236\030\0234r\217,\215\312\316\021%lpJ\354\034\343fL\334\224\211q\246>\322\020\323X\216=\310\321x:\365\301\211A!Cq\234=\316\021I\331I\002\006b\252\317\221*O\343\235\0216\304T\037\2318\307\031\225B\345\036\036\037jT\212S\001\025J\215\247\261LE\241#;G\224@\3069NyGZbg'\306\331\331\361!!;G\224X\356\354\304\033PLcYv\222\020\343L\245$fP8wz\250P\031\3319\002z\314\211B\243Sg\006hv\2348P\031:\3350\225\232 ;G\224\250yJ\241\323\370\003\211\236\024r\234!d\347\210\0220\327\271P\001\211$56\341\231\244\276T#2\346\201\312=Ri\nH\022\0338\214\260\345\"\265\231\023\205\202x:c\035\275\003u\312\232\032\365\231N\343\022\322\235\023\205\202(\312\315\234(t\332\024"
+	.string	"\316\323\031\2446UP!\346\201\312/u(G}\244\033\340'\374,\201\0325!}\326d\310\211B\243P'O\f\202\032\357\340\240\300IR\233J\036\037jP\2166y\202\324f\211\370)S\207\036<\204x\356H\233<o\b\023q\264\311\363N\235%\202\004\310\341\220l\016\257sA\306\361\231\312\324\017\250\315\023\261\354\303\243d\001G\272\323l6\207\3238jB\332l\016\251\323\230\352\023m6\3673\ne\241\331|\251\315aT\n\245Bw\342f\223(7e*t\007\346:\027\250q\017\n\031\001\317x\352\324\241\""
+	.string	"\003U\206\216\300\340\023\315A\300\t\237(t\007\001 $\240\231"
+	.ascii	"\021N`\210\237>;8Q(\206)\325\007\303\002\344\023qt\307\031\235"
+	.ascii	">\235\361TG\356i6kJ\304\323\236f\363\225\251\320\235f\363u\312"
+	.ascii	"\316g\263\371\306-@\251\315\346\313\002\216tG\313\320h\007\031"
+	.ascii	"\032\205\316DMx:\343\351;\225?\340D}Lp\312N\016Og\fB:Eq\202M"
+	.ascii	"\324\204\343u.@\345\023\3614\336yF\235(@\345\023\361R\216\222"
+	.ascii	"p\251M\234\030\304\006\250|\"VB\345\023\261\226s\246#\260\200"
+	.ascii	"\343\034\261\263\343\304\201\251\362\211\030\226\2331\016\264"
+	.ascii	"D\314\201\3523\002\246\372\214\bR\233\320\236\020\362\211x?\343"
+	.ascii	"\270\207*\224\233\026\350\240\243\320\017Q*\316\033\347<K\310"
+	.ascii	"\211B\237\316x\007\206\366P\203\324\346\206\017:\310'\342\215"
+	.ascii	"\363\0014x\235\013T\237\0216\324\246\007\371D|t\016\343\022\316"
+	.ascii	"\235\020>=<\333\247\031\367\240\020A\365\031A<!\202D\314!\356"
+	.ascii	"A!B\206F;4G\360\300!y\235\013)\210\350\020\002\203\034\347"
+	.ascii	"L\235\262\00525\226\365\t\02024\n}G\360\300!\246\372\274$|H8"
+	.ascii	"!\013I\370\220pb*,\021?\203\361\216\023\207*\224Nc\016H\247("
+	.ascii	"r\366\006\016#\f\251>Rh\211x\372!\306\204\023\304\006\016\305"
+	.ascii	"x\352#;\247q\017O,\303\362u.\370\364\3604\245S\024988N\f\324"
+	.ascii	"i\\\002:}\032"
+	.string	" n\202\360 \004\017\022\340\323\303\263\214J\241\262\317\216\224\032O\213\324\246L\334\364\351\341\201_y\307\207\032\203\210J\241>=<1q3\232\003\335q6\221\321\034\350\316\b\315\026P\240@,;A\304\315c\207\017!\342\247\324\003\212\247\363I$\321\263c$\321\263\323lA\207\205\0174\304P{\244S\016\323\370\t-\001\345\340\323\303\223\224\2339N\021R\3500\307)\002*\237(A\216v\360\351\3419\306M$\n\362u.Pud'\017OKm\366\220X\236\200Ne\247\007\244t\212\"\007&'\006\341\224\235\034pp\234\305\341\007\260Lm\226\2109\224\2109\2040\341\234\032ev\2163\262\006\370\003\rr\017\322\247\231\202Lm\302\031\344\036\244Rf\241\2456aa\206Xv\312T\271\007\371\0012C\206\251\374\001F\2466w\324\004\024;==#,\345\353\\\220ur\240\261\211\227\332|:}D"
+	.string	"\035\201\364`\204\233a\204\373\301\b7\203\323\375\300\351f8\341~p\302\315\200\302\375"
+	.string	"\205\373\201\261\005\024vzx\234!pp\234\311\230\252\202T\204t\212\"\207\030?\245\036\242R\250\214\023\313\322\351\007\252\023\005\351\024E\216MN\024\232s\302\216\323\207CL\365\221\221\233'\342g\024\332\244\342@y\234Q\024\317f\r\025zb\204\034\237\0211\207\243\t\306(\364\204\323\003Q\332s\242\204\270\304\324g\003\211\236\024\242(\236I\026\250N\017T\350\211\021\2440\327\271\200!\007J\"J\001O,SQP\221'\342g\264C\022\2042~Jy\212T\034\250Le\201\352\224\223:82\324D\b\252\364C\002b\3319\235a\001G\272\2033\215KH\233>=8\307\230\007*\"\306qNO\210Z`\032\233\220\366\320Lc(\t\250\034\215\237\035\236S\247tD\262\005\035\0171U\347\305\211\311\211By\246#\260\200\003\225C\304;#\234\321X)_\347\002\t\237\021\324"
+	.ascii	"<\243q\220\332$\3413\202\372N\345\236\240\374\031\252\207g4\246"
+	.ascii	"\306\323Mm\3628\343\251\034B\207\352\334!\341\224\235Oe\\\002"
+	.ascii	"*\3438_\271\311\241\207\312\223\234J\345\036\350\024\207\032"
+	.ascii	"?\213\317h\\\214[\200\206 \232\220>\243P\023\357\216TJBS\030"
+	.ascii	"\225B\251\324x\332\303#\335`B\272\263\343\204\021A\034\342\031"
+	.ascii	"\263\200\343\334\"\210C\310'\342\350P>\021Ga\271\371\201\006"
+	.ascii	"*5\236>\237#\260\020\365\321\3011\312M\252\207\230\007*o\252"
+	.ascii	"\007\026pF\220\251\316\035\342u.`\210Jyx\2448\025P\233\261\354"
+	.ascii	"\224CD\235<$H\370\350 \243\261,C\247\031\240\3062\212\021\306"
+	.ascii	"XFA\202\354#\035F\343\024H\370\220 \373H\2112\224\004\331G\372"
+	.ascii	"\312\327\271 \235\242\310\301@\235J\251\321\230zs\001\265\231"
+	.ascii	"\003%\021\225\032\345h\314\023\227\220z\220NQ\344X@\242g\247"
+	.ascii	"\031O\235&\236S\247\216rJ%\321\324\311\201\3524c\252OS*\303\031"
+	.ascii	"\226\0312|\320lAG\346\203\246LBJe\306T\022$\244I\023\322\035"
+	.ascii	"\022\323\270\204\005X\300\211up\216\031\220\312a\024\332Cm\232"
+	.ascii	"p\242\210\361\341\020\035\001\335qn\220NQ\344\324\310\320<c\031"
+	.ascii	"'\226c\016T\351\024E\3161F:E\221C#\353\340\310Lj\363\303\023"
+	.ascii	"\332clA\247I\245:{LHw\232&\234(\220\031Z\320\321\301\221\245"
+	.ascii	"\321\030\371:\027\236\320\036\f\262N\016t\207\004\363\322\236"
+	.ascii	"x\212A\226J\247\030`\023Zj\223\304\023\332\363~h;\264\034\332"
+	.ascii	"'\264'\230A\216B\245\037z|\236Qh\006j`\023\316\r\370\204xB{\220"
+	.ascii	"Q\250\007y\204'\264\007F\306\211I\220\220\247q\317\211\270)\357"
+	.ascii	"@\345fT\332\002t*\325a\306O\251\007\0242\264\204sz\002T\216:"
+	.ascii	"\223\"h\242P\347\tS\251\354\234\3062 L8Q(wb\034\234\021b\331"
+	.ascii	"9E>s`\236;R\035j\f\225\366\3101\225\031\363@\345\"\n\347N\374"
+	.ascii	"\204e\226&\234(\232\311b\013:M\034\250\354\224\2512(\246q\t)"
+	.ascii	"N<m\352P\235S\034$rF\226\"\343\036\0242\f\024\316\211:\231T\350"
+	.ascii	"\tg3\307gD\374\254\211B\2359J*O\363\351\214u\234,H\245;\315i"
+	.ascii	"\034\205:\247rS:\305q\332D\241\316\034\030\345T:\235\3065$HH"
+	.ascii	"e\037\234&N\223:\302\031\023\367\240\220\233\037$[\320iF\241"
+	.ascii	"r3\001\031\344(\324g\267\240\323<\341\344\231\211\237R\017\321"
+	.ascii	"\030g\032\177\020Q\201\f\345\201\246\020\357\344DG\250\211B\235"
+	.ascii	"'(\345\230\032\203\230\30699\320\251\b\023\322\235\235\021v\244"
+	.ascii	"S9*\335\240\203\023\365q\356\004\240\031S}bN8w\342i\323\204\023"
+	.ascii	"E\363\031\313\316iN,G\2412-@\247\3168\nMA\246\372Lu\344\2450"
+	.ascii	"\nu\346\024c\234\250\263\304\323\371<\312>=\262\217\2649\225"
+	.ascii	"\312R\236\230W\216\372Hq\232;;1N\263)\225}\2345;\262,\235\352"
+	.ascii	"\310M9\0323\247N\035\034\035\3638+\020\357@IH\247=0O\017L\017"
+	.ascii	"4\031S\235\361\024'\n\215w\236\320f\024\305s&*\205\312Pj\324"
+	.ascii	"9\225ir\242\320\034\3474.\341\234\321\221\245R\036\352T*\343"
+	.ascii	"8I4\247\261,CC`#S\245\322\021J\031\312\003\335i\306\262s\332"
+	.ascii	"<\341\344\271\221\366\234\210\233Q\024\317f\006\022=;\313\030"
+	.ascii	"\3079m\356\304%\342\235dT\n"
+	.string	"\225\235\324h\334\303#\305i\3468\251M\3319\242\304L\374\224\3624\251O\252\223\247\002\035\034\031\332\323\334\331\221N)\200*\241=1R\250\354\2346\243P\236\347L\024\352\314i>\247N\023S)\211g\034\223\240\240Fn\212 G\241>\303g\310\260\301\002\025*p\302\306\271\320C\345\301\320C\345\301\020\205:y0\340L\251\030.\310Lc\350N\017T\336\361\341iNcy\007J\242\3113\215\345g\363\031CI@wzx\240T\f\376S\260$\003\004/\251\245qQ\240\264\274\362\366\244\211\202\244e\333\217u\013\322\022\212\nM|\004\035\311Pq\270\233\301\205\002\243\030\037z<\324d\260\210a\221\026\310\267b\005\005D\255\005uB0\340\333\262\223\032:\005Dl\331*rA+\262\332\227\343'o\377\024\250X\366\215i\301\205Q0S0S T\005\220\202\237S DA\220{\267d\305\022\005A\024"
+	.ascii	"%\247\260\306\360\204<\206\274y5\245\355\377&\220\246KP\t\023"
+	.ascii	"\026\"\2005DS\230\240\244\270\371R\363se\312\013/5P\311!\326"
+	.ascii	"\251$]b\270PR\202t\375\021\357\216Qf\260M\341r\225\244\032\273"
+	.ascii	"\201$\233\245\313\256p\371\262\245\346\313\005D\343\223\342\327"
+	.ascii	"\205DSa\244O\213.\332E\364\350X\364\tq\253\212\360%\341\323r"
+	.ascii	"s<\345Q\355\241\201M\221\321#K\215\332\215\024V\330>\275\026"
+	.ascii	"E\005\021\026\300v\311\330\013=\275\032)\356T\337_6/(\350\244"
+	.ascii	"\345-\357\n\221\025&\022\037\222X"
+	.ascii	"\023<e\216,\223)D\256\276\273\273\261\333?\363\034Vm\233\266"
+	.ascii	"\244H\271\261\003\201\313\224\337"
+	.string	"\330E\311\240\333\203Q\305\212S\223\323\315\334\315\334M\224*RO~\023\345\006\312\212\353\233\016(7t,\374\260Pp\030^\0202@8\270\033\271\270\337\310\3354\211q\375\302\322\344\206\311\230\326Z\023/\301:'6\316Z\314\335\260\335\260\335\274\355\r\341\202\235\241\232\224\374\346\355\306\r\007\026\226\027\267\2336=7\240-E\250\226Z\240\335\034\2719r\243V\005i\350\204\204\027u\203\3447j7i%f\b\275\270I\273I\262\265\262N_n\221\217\254\217\026[\273H\221\033#;\016`d\211\344\310S\017\277\252\233\262\233\262\033\263vV\362auC\3447f\037\353\302\305\210\253o\256\301>\027m+\254\264P\261o\304n\304n\310\254H\335\214\375\206\354F\bR\n\214%An\204\334X\333\244'iE\214-\230\340\2251\331\335\200\005A\363q\026\267\377\233 77t\013+[\372\276\246\206LVn\374"
+	.ascii	"\271\261\001\002!sy^5\332\254),Z~T\217HI+\256]\314\036pT\230"
+	.ascii	"\031\026\037\314\257\245\030Az0\303\222WZai\\L!\311\331(\206"
+	.ascii	"\320\026\323\254\314\210]\226GZ\030\223!Qn\2525zyO\322v\340\035"
+	.ascii	"m\310e\237\264\224}Kjw5t(\353\376\210\202nr\310<\025\245\252"
+	.ascii	"R\002op0\323\332\037U\275\277\233,&\334\213\2426%W3\241\254W"
+	.ascii	"E\240\270\232iu\f\"#\313\227\033\03274n\260\036\343\200\033,"
+	.ascii	"\345\036\234\330\026!I\366\1773\303flK\253\007\214\253\031(G"
+	.ascii	"09 bVb\310\033Q\226\004\312\370\302Q\326\366\245\252+\330\302"
+	.ascii	"\006\027\325\314]RE\f\245\255\251\255:'ou1\226Z"
+	.string	"[\250\206\214#RK\034Q\246\262\320\301\2501\264\002)\303\021\265\274z\311jxi\361B\331\304\250&\306W\0045\203]\253a\245\212\253\223C\346\364\274\334\3358-\251\230\206\362\210\334\270P\302(^\361\272\310\3354-a$\267\202\304\344nZ,\241`!jF\206\3340-\233\246\236XMA\346 3\223\341j\233 \334\022\035FIK\245\241\021 J\362\220\274\304\030z\302\341\352 \254\027\027\256\026*\031\022\243\211\253\225\252\244\214\\\355>}e\361qC\024\343\247\264\207\344fh/(.F\227\253[0)?\177\256\266\202\375di\335\244\230\361\223\323\002\245\206\253\221:\220n\304\270\t\212\261\022\210\243o\310\rP\214\024\031:~X\335\374\304\310ui=-\335\314p@\312\266\210\030\361\214<\321\002\030\323\366\356\bs\021\345\313\f\027X\217\351\216\210\227\0305\016\262Xd]b\216\344\370\252\312\375\321"
+	.string	"\035\341\244\310\255qY\301\226\266\344'\213$\354Z\3222d\013\r\223"
+	.string	"`p)\261\361\243q\202\235\330a\215\330h\211);R\206\205\212M_\f\216\0358\204\370\2241\002\231\320\366\224T7\270$Yb\302\202]F\302\366\26043\234\244\356\212\254=\314\274\354\364\252\210d\2230\345\305"
+	.ascii	"):\355\240\213\273rC\316\205u\313\n\r\327]\025\r#<\232\037\035"
+	.ascii	"\020\261a\244\212\020\2529\0271\356h\302\246Hm\311\271\332fJ"
+	.ascii	"k3%9TV5\317@6Tl\354n3\345\363\nFWF\257\236\233\263\251c\222\364"
+	.ascii	"\325\226}r\233\272(n\231\025Q\\\024(dF2\276n\310\361\241\321"
+	.ascii	"\035\267\030\267 \241\013\364\261\227,\261\221\003\203\273\215"
+	.ascii	"\234M\223\031wU@\232\3300y3\253\222\203J\003\252A\025gD\nf\333"
+	.ascii	"\246\340`\232\241\246f\343F\305h\210E\332\022[\273\215\233M\333"
+	.ascii	"\322\330^[\233\215\222(\263.#^Z\032KV0\261\301}\255\322\226\026"
+	.ascii	"S\230l\212\274\210M\222\f\204\346Y\305\214B\353\n\rk\3446I\220"
+	.ascii	"\274\301\025\331\201\304\346\210\227\030E^ID,,*3ZQH'I\232op\331"
+	.ascii	"dd6fD\303=$\274\250!\2671\263!\342\025\304\312\206\210\315\365"
+	.ascii	"\207*.\033\350\346P{K+#\372!\277v\354H\221\267m\254\\W\352\350"
+	.ascii	"\366\214\023\257\253\035VL\251$\371D\344\tH\230r\315+\211\231"
+	.ascii	"\020\260,\255wcIJ\220\230\032n\225(Y\025_61\212hK\254g@d\370"
+	.ascii	"v\223\024*u^6R[\311\214*\201?d\002\003w8\tb\323\025SEE\344\304"
+	.ascii	"\307P\361\253\n\253\310\246\207\022\t\222!:\230\270\230`-+[\212"
+	.ascii	"-#G\216\236x\314\260x\215\224\204\375\250\002\025`\205\221\332"
+	.ascii	"\016\243\242\237\2214!-\253w\353H\210O\207\362L\027\371\320\273"
+	.ascii	"\346\3001\304\306\f$\0343Z]\220\304\310\232\3412j\315]\235\334"
+	.ascii	"\230\271^\025\261\321ec\206\354UK\032#R#\006\311\016\353\005"
+	.ascii	"\t\226\222\351\t\331\227,4f\242\210[*\334\216LM\331\\\265\026"
+	.ascii	"T\315su\016\232\322e\250t\364Gu\233+\033+\253]\325\316\306\312"
+	.ascii	"FFW\224*\200+\206W zFl\252\210?\307%DmD\226\212l\031+\273\032"
+	.ascii	"\005E\345j\231-,p\311J\262\201\021\223\302l\255\007\237\253m"
+	.ascii	"\234l\234l^<\006h\3070\n\013\007\030\324m^\024\201*\342j\233"
+	.ascii	"']T\027\205G\305F\3206\262Ufe\323Ds\027l\222\346\343\207M\013"
+	.ascii	"\032>$\335X\340\r\033&\232\265\315D\253)\312f\211\246\210\035"
+	.ascii	"\266\n\207\253m\216l\216l\222\016\003\024d\313\006\3516I\372"
+	.ascii	"H\323\337\217\253\257%'\013\344\317\325o\227\230\366\212\025"
+	.ascii	"6,\336*\001I\275kd6E\267aq5E\304\207\rQ\337\233\024\033\"\233"
+	.ascii	"\241\244\222\300\2619/\\h \311n\344\333\225c\305\232\253mf\233"
+	.ascii	"\331F\250UR:\300\222\026xQ\331\031\252i\203\337&\3506B*\256\364"
+	.ascii	"Eq\265\r\320\335\272\024\031\223\342j\233\037%\275\3753\003\225"
+	.ascii	"_\356\242\370\222\\\375\007\373\254\357\\\226\234\223/A\242\314"
+	.ascii	"\3150czQ\246\020B\004\245\216\331\205\311g7\264\204\371'\223"
+	.ascii	"vEl\006\227'>\204\224\260\310\326\r\261Qqm\261\036w8\251\021"
+	.ascii	"\344\3476\304\313faq\265\370\b\"\375\300\262\242/NG\021\272>"
+	.ascii	"W\313\240m\371\331p53\313\034\025\273;\274\3753\2613G\222DSz"
+	.ascii	"]\260\314\270\271`"
+	.string	"3\242\264\364fh\220\260gD\303\325\314+ T\3153\020\323\n3\357\314+\2672\257$\275$\333\366\002\227\353H\013@<\031\034G%}sj\314*4B`\244-nK\314;\031\254\0276\256\250\310T\375b\354\260[\222\025i\350\311U\247 \211\353\302\367\343J\221\241\"\363\203\005\211\253\231P\202'\b\f\f\f\3642\317@L(.\263\216\031\345L(o\333\013\332\366\202\344\360\316k\b\350\325?\223\216\306n\350*u\305|\262\\\242W\243J\025W\353 &-\244\230Nh\236\354\275\370\202\223\243\201\303B$\311\227\253\2310\221\301zj\263\006*\305\255\2551\341\232j@e\341/:4\035\314%g\302\351\375]iq5\363Mi\205[p\351\001\346j\246\333\335\222f\\Tl\265m#Gu7\230mL%J\230DEa\262-A\022e\311\310~\253\344\305Dc\2421\323\336\033@H\026L1"
+	.ascii	"\231I\316LS\306\t],\221\361\345j&\022X\207U\352\213\253\231G"
+	.ascii	"\202}-ZT\355\330"
+	.string	"Q\244H\215^\\\325HGweM\311\005\363\312\2742\315\232T\341 ZbrD\3164\343k\373\362\223\324\307\034\302\034R\243\327\203\306\325\\\003\260\220\215\261\215\2151\2050-\370\331\333\"\005\205tA\224\244-\234\272\250T\305\317\325f\205\272$F\302 \306\024b\f\021\021M@"
+	.string	"\363\025"
+	.string	"0P<\034\216\347\231\256\213\365\024"
+	.string	"\020_\264~jN%N\264,\253\2241\006@\006"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\b\b"
+	.string	"\001\212/Z~\023\336\371\325\232\265D\365\001kK9\3077\364\004\260\300_\202\202n\327\232\241. crc%\242\2459\274\t\347j\336\376\357\026\005<\3222\030P\210~G\375\342a\224\"i4\227{\003\030%T\317\207\216\200K\211\336\213S\306\345\374\377\360\327@lP\310\032\022\241\372oJ\035\204\031YT\373]\276\002\364\022j\037\260#2agYA\344d\264[\207\006fe\357eL\203\364\017\222\301\373\305\377\202<\336\245\355\237\032o\276V\005\320\216%t\022\303\305\036\370%\006\224*qB\n\324R\307\361v\315\217\321\343\266\375\246 }\200\345>\250\230\250\245\305v\253\031\274\200\2017\247\320\266\004s\306"
+	.ascii	"\355\346zW #\314\330\003\332\254\250q"
+	.string	"{\024r\005N5L\026\371$\240\004\275]\365\2453\211\302C%un\323D\257\037\342\025\275\330\301\037etw}\002\272t~\310\277m\001\230PfVH%%\275\220\"B\304\230\345p\236\320\t\357\242\302\006\320\034\314(B\356\267\364\230\341(\344+\022O\223w\376\336\250\026\344\034/\364M@\376\245tav\256\0021\0043T\210?{\320\024\304\374f\326S\27283\306\332s\234:V=/m\2476 fd\272Pjr#r>\346$\020CL`1\220*\276Tv\237^\336$\244}\332\241\013\257\031\206\024W\206\256Xd\211j\261\361mV\033v\223Ak>E2m\264\353\225\350\214,\230\372\206\031\373?=\355\210\330>F\242\323\205@\203\302s2#B\n\343<\025\250\347\0034\300\360\334\f\374\311\360\217\334`s\375\332,\302\027\214\251,\326\\\345r\234}\033\246\203\375\330\343t\024l\376g"
+	.ascii	"x\223\365Rj\240\006\265f\202\310#\233)\310\211p3\037<1\031\001"
+	.ascii	"\022g\224j@\216\276\300\020+p\024\357\032\275\025\220\004\241"
+	.ascii	"\362R\320\306\2064'D\233\321\034\371\004D\243g`\241\362\240\237"
+	.ascii	"\351\212\016\3170\035&r\f\265\316U2\210\264\255\035\377\376\300"
+	.ascii	"\337\0304\025\031D\314\235\023\2039Y\035\244&\r\3453q\362\277"
+	.ascii	"\022\221\214\341\024h\343-V<\302En\307e\310\341\343\036\351y"
+	.ascii	"\225\300\256\231\370y\017\220\t\3044,e\340\252\334\344\214\331"
+	.ascii	"w(\2279\217s\024\322\342x\345\246\2210\027\027\222\254\214\003"
+	.ascii	"\264\226\301\205+\3071\025\273\305\232\205\177\346\007\215\374"
+	.ascii	"S\0210\264j\001 \"\302\223\264\266NI,\315\373\3472\376\033\260"
+	.ascii	"\273\377\353@\026\335\223H\307\345\f\262U\013Q_\315\2674e(1\\"
+	.ascii	"\033\361\257#G\013=\273>6T)<\334\\{\327]g\377\340MR\267\255d"
+	.ascii	"\321X\205|\200yF\235>o5m&\260~~s~F\230\246\024\252\301\021\250"
+	.ascii	"\3231\227\334%c\206\337\330\344B\247\207\b\366q\352\t\211\360"
+	.ascii	"\202\027=\2033\236\bW\244\002\206\361\365\243\253\003\324\312"
+	.ascii	"\336\013\336M\266X\2373\307\03150%\002\bs\341\201\337-\350@Y"
+	.ascii	"R\336P\037\343\361\357 \371Db\246|\017\r\007\321m\330o(\350h"
+	.ascii	"\356\032\2327\177\347F\276\201\362:S\313#\367\2421\322\226aY"
+	.ascii	"\021\374o\345\257\225\267(\377\221n\001)\273\363R\267\310\250"
+	.ascii	"\323\200\307\331\346:\335\262X\006Bb\346\231h\020Z\352\223\023"
+	.ascii	"\375\243\375<\200\026JWT\214\317\bP\313\250\314.g\266:\356\262"
+	.ascii	"YP3\332\360\330\303\023\337\347\201\247AI<4\230\274\216*g\315"
+	.ascii	"\313<\005\005\017-\363V\231\026\264a6\315\251\031r$\332\007:"
+	.ascii	"S\347\204)\234\236V'\327\335x\243_'\212qva~\355\337\026\341\032"
+	.ascii	"\360\006Gx\353\234\215\254\002:\361\347A\2667\345\263\007s k"
+	.ascii	"\3658\r\"\372\253\271z2K\224\301Ow\315s\325\t\240\236\334\202"
+	.ascii	"-\227\362di\251\202K\216\205\212\322=s\267\241S61\272\247R%\223"
+	.ascii	"\346$Z\300ahu\200\255\037\203x\270\031\312\366~\254\2634sO\213"
+	.ascii	"-\261\225\312\252\b\346]7\246><\t\363\275zQxT\357[\277?\025\325"
+	.ascii	"\031\n?A\017P.\224Z\0335\316Z\214\036O\235\2014\254i\370y\250"
+	.ascii	"\026\336H\332\2566\207\265b\370mM\242sxg\220t\276\250\212\202"
+	.ascii	"\346qj\004\002\215\024a\316\213\311H\354\250b/\216\363\232'\326"
+	.ascii	"^\206D\\\345\345s_\004\347\236\201\373a\235\231\305\230I[\216"
+	.ascii	"\364\367+Vc}\234\275\275\254\006\025T\373\277j\232\352\320\201"
+	.ascii	"\204G\2238\227\fbW,J\023\352\314ph:o\3431\356\216M\344\023\261"
+	.ascii	"\356_\257/"
+	.string	"\377\022xM;E(.[\025\205R\347\036#\216\256\277,\352=c\253\235\220v\023\323R\026\253\022\267\360\312\036rfe)`\220z\244\222\244\344l\225\236\307\324<\007\013\320x\310\355\3100\023'\3141\022YMGp\322\262\023\354[93\364\270\263eM=\fBj\207\202\215\267,\330\026\275dJDiT]\377\370\tS\344\031\2018ry2OB\340\275\2523\001\263\344\221T\200@\242\233\312\345\2057H~N.]\203\300\032\224[\231\210w\240\031\2713\346<\2450\240L\256\377V\034\034\327\254\227\335'\206#Y.r\371W\223K;\277\345\331\200\321\247\353fm\253\322Z\237ya\336\023)\216\004\321 \031\243\357\363\253\034C^\001\266\205\005\302\177Q \314=\031qL\031\222B\322@~\270\217\347,h\021\263\001\254\342\223|\211\232\372C'\266\343\255\243\b\034\233\216\267\232pNz>\315.\235"
+	.string	"\374h-e\254\303u\254\205\300\f\201\274\0016\f\267O\357\003E\340D\210B\337\017\206\272\310\374\2076Zwv\215&\325\346\372G)]\217M\326\f\204\020\362Rcc\001|A5\025\336\345\313P\242\276r\201\362\232\223Z\207\227X\235\376\317\347\335\004\340\277\"\337\fl\271\223\202"
+	.ascii	"\311\375\230\330\340\311\025%AJA4<\305\207\021\365B\203i.\016"
+	.ascii	"\327`\367\210p\367\202\204)\022\275\312\"G\365\316wSYQ\365lH"
+	.ascii	"\335&^?\017\016\313\301f\247\227\031\374\326?\233\300\330\221"
+	.ascii	"\256\352\221\275\270\372\311J\204\226\347\231\335x*\335\352\r"
+	.ascii	"\202\356\374\2705\351\022\027\307\027\3469\207\201q:s\315\336"
+	.ascii	"\r\230-\320\215\337\0318`c\203I1W\r\231\301\232\303=\371\331"
+	.ascii	"3(\016\022\262>\"\001\307\013H=&\201:\346\001az\221]\362(\330"
+	.ascii	"C\233\215\2264\374\017-\226&\276\370{\240<\355\371.\345\220d"
+	.ascii	"\013\236&\303\027\210\342w^\264TV\303,\360\016c\030\004\2566"
+	.ascii	"\024q\204\211\023\320&\242s\341\27141\227~=\"\214\266\204\273"
+	.ascii	"f\031\305-\360\256\033J\217\341\231\375t\3474\354\212\335\200"
+	.ascii	"]f*\305\346\331LD\020\222EG\241\304u(\345C\203J\305\362\251\f"
+	.ascii	"\201\237\320wq\361TvD\340D\325\236\262\350\272(\367\343G\311"
+	.ascii	"\200\362\344\217A\311#\241\031\013T8\324+S<@)%\301"
+	.string	"\211C\177\310K\266`.)[.\2252\376\210\037\203{\365\245W\375\037\316\206i\213\300F*\036\336Kf\017$\342G\231\233\007\233vrfP\030\370:|\225\343\327\240X\266\303\f\315\013\374\221\241Z\377\027W"
+	.string	"a\\\260\304\251\021g\200\347\226\257\350x|\314Tbo2\360\210-\3359\3470`X{g\016\345\213\t\024\037F\241\367A>\217\274\305\361\344\205\316\016`\273&1\242*<#\212R{\245\204v\210N\266+1#0\030R\340\033\007P{\006\205\245_\2020\224W\240B!3\242\334J/\277\376\373&\342\226\\\033\004\242Mp\376\215\231|\021z\333\240u\374\324\025\315\037j\226M\233\204\007N\270\215\300/V\241$\362"
+	.string	"\206 \361\345\225\311/\370\256\222\312\377>\234)fU\367\320\016\252'p\350\212Q\021\037\201)/ {\330O`\305IA\274\263\242w\024\035\327\356\\\r\206cYg\007\363\372\002\230\\v\323\202\026\205\333Y\210\223\200;\215,\304\375\024\177"
+	.string	"\373\020\0174\373\253\342a\323\333\210E\200\277\367\020\337\312\020[\241\2055N@\351\2652\326\364\272Y\312\252\370\244\364\255TA\247\240\334\261\023!%\323\236\256.Ic;F\337\273\306\214'|\260\b,\336\375\027\205\250\251t\233\207\322\241\304\364\020A\025\2138\213\217\262W\256\n\366,\277\270\177nY\337\022c\241\245v\310e\005\215\004\233U"
+	.string	"\257|\227\310.{\230\007\354\\\243H\306\030Y\312\364V\034\236\370\367"
+	.ascii	"\365T\350\222\234\304\314\023{=C\205d\327kxn\303\300f\237P\250"
+	.ascii	"\244\271\313\2708S<\372\363\235\333\227y\334[\257\001\327\367"
+	.ascii	" :\3528\024\303Rx\223#W\310Z\324}\362\207\202>\311\030\240r\340"
+	.ascii	"`\020\204f3\026\261\005*=\327\223\035\265\222{\365q\266\035\024"
+	.ascii	"i\036e\2704\200\205C\326\302\263\220e"
+	.string	"\372@T\246\216\004!R\032.\222V\200%(\251}\305\211B\206$\317\347\336S\322b\2651\254\342\273\351Y\326*h\2023\224c#\374\324Y\243\2604\226\232\321\003?\274b\006{\333\021n\327\032\320s\034|\214\250k\023\373\235\205-\3741t\205\217\023]\207S)\206\364\365\301x\207usT\303\364\215.%\035\302\327\266<\263L\360\320\272G\256\013\221\210\246zQr\232j\317\227\300\177\360\207\305W\306\255\323\305\303.\377\220\212\315Vd\227[j\313\236\362F\315\316\023\312E\223\214E#\270\350\276(X\211\307WZ>&M\250i\034\327o\347\240\251Zb\016Qz\262\264\203\362\242\356;\243\300M\240\3163f\307\207\206j\331\252N9L^\nz\013*\245u}\202F\036\262\253\031\222\366\340\220y\nJ\315gLp\245\035\016$\033.\245\001m\243d\251@\262\223\t[Vw,\020\360\232\001\253\373\333"
+	.string	"\227\265w\277E\214T\001\036\260\240\330\321\337\330\213\277\254Q\032\374\030\366Tu\24716\025\303\341\234\257\245\227\330\265'o\004\370\005\314\001\034\006o\263\310\331X>7\032\312\3178\005\030\204\032!\371O\320]\251\341[\217f_\033\333\350\362\232%\031"
+	.string	"\320\006MG|\342\313!F\305\276\237Q\245\3273\321IL\376A\374k\210w\366WO\233\210o;"
+	.ascii	"\234\354\f\374\222\202x@\340\346{\343U\342^\250\345\305V\337"
+	.ascii	"\200,s\250l\306\346\317\340\376YX\360>w\326A\240\273\b\226\366"
+	.ascii	"\366\244t\367\003\332\334'\034\"\312\233\333\313x5r#\323i\243"
+	.ascii	"\376\2268\316\021\335\334.\202e\025\315{\177\210Y\344\032n\\"
+	.ascii	"\022c\306\n\320\037\270n-\314\325\364\237\021\t\032Ar\367\n\236"
+	.ascii	"70\034\205\345\332\254(&MYLN\226\263~\306\"\007(\270\025\220"
+	.ascii	"\2270Q\022\362\332\240\362\0316\304\363\225\245\001\225\275\205"
+	.ascii	"\004\310\023\205P\001e\r\243\223\033\235e\001\275\221\213\207"
+	.ascii	"u\340\347!\275:\337v\"6\237?\212y`\253\355\341\307\222\236\302"
+	.ascii	"\r\301\217j\254\224\217\250\355\025h\326R\350\177f\030\226\273"
+	.ascii	"?/\rS\355\335\317/\366\036\t\376.P\2340\276\3320\306\374\212"
+	.ascii	"H\351\277\3451lW\317\201\023I\250<P\317\021\310q\256Tl\353\260"
+	.ascii	"q\331\305L\025\005\262\222\002\030\177\034\365\370\030\020\306"
+	.ascii	"\3037\363\342\n(Y\214\216e@%_(\271\243\334lQRsh\253\221\325\324"
+	.ascii	"\217\030\204\215$dk\002u\326\330\241{mo\212O\363\235]0Y7\361"
+	.ascii	"\301\261\362\376V+BF\f\303\346r7(\317\277\006\213\316:\314QH"
+	.ascii	"$\3326]+yWd\337G\220\r(\347\036\215\272\325\370\211\311\245\345"
+	.ascii	"\233\267\260\327\220\315A\017b\340Z9\004(_\225\374I\220.\361"
+	.ascii	"\\\354\314\030\346\247\320\373\214\324'A;}\306\3373\306F\365"
+	.ascii	"V\017f\217L\345g\036)\343\375\300\257\243T\242Qy\036\021B\256"
+	.ascii	"7\246h\255-\261\351\375D_\374.\34066\f^\222\271@\"\251\217\223"
+	.ascii	"\257;\216\237:%\245B\315HC_\236\310\026?\361\372\027\230\241"
+	.ascii	"\200\001\247m\205\025\027/\021\346\324X]\016, \313\004\276\023"
+	.ascii	"\303\212\324\224J\303\332\3147\r XB\310"
+	.string	"W\024\204\206\272\251I\"P\201\246{=\312`uH\235\216$lf(_\030h\255y\255\260Z\265\356\035\323\324\201\236\240\023b\2754V\373\215\267\241\204\030\032\223\340e\020\224\004\032I_\332/\032hVHW\177_WE\217\324\375\304_U_\f_\345\334p\217V\025U\374\326\255\334\350?\272\025\"_\255J\3669\t\316y\305\373\251\204\252?\213\\3kaCC\034\230.#b\233k\333\275I\340\222B]\nbT\307\233\245\254p\327Z\3542\245\322ta\366\236\354Q\274\230\314P\035\033\375,K\024\205B\203\202*I\304\307H\247{l\030\267H\2675\227?\306\251\371dU\357\331b\315\374as\242dy\372\346],/\364a\370F`\2265h\200V\"u\346U\006g\257\306\365\373\013\3035P#?\365\344\314w\332\tU\277\236\310\327v\313D\335\335\177\214\215\356\206=\270\211\201\\K\fI\317"
+	.string	"o-6{B<|\306b\002YO~>\004\206\013\\z\016}w\253wG\231>\200\324\356\373x\251c\225y\323W\205\273\345<?\312\254\266\"\223X@\007\261-B\325\202\244\267\001\017\352n<E\026\274\r\022\005.\r\241\342R\252\331\340^,_\374\250\377\034t\265-\003\330\336\205\r\315\362\225>x'\255|\020&\217|d\206\206D7VFb\271<\304#\235g~\372%z!\026\323\033\222\206\305Z\345v\366\220\223=M\246r\221\330\023\"\242\213\356it\247\234i\026\222\026\355\036\221\251o\334|\374I\235:\231\030\335d\262\2210*\273%\221U\341\2634^R^\213\371\017S\226m\216\350N \1779{\210\301\302\327\251\016\356Tt\3562\262\231.\251X6\263j.\336\264Wq\352|\2404\225"
+	.ascii	"\252p\300\203\244\2501\214\210\035\2268\234\003\003\232\0321"
+	.ascii	"\260\331/\364\345Q`\257\371GP\3741d\362\266\227o\377\277Hq\373"
+	.ascii	"\007\241\340\021'O>b\331O1x\342\262\027\026\2608/\354%K\267Z"
+	.ascii	"\213D\004n\032\307\233\335\274H\311y-@\242\272\234\213\024i\337"
+	.ascii	"[7\272\027\253KZ\254e\354\354fea\016\2143\031QAo?\312\277;\346"
+	.ascii	"y\371st\270\366c\002\026\202\"\365:\304I1\357\356\351"
+	.string	"\376\017"
+	.ascii	"@'\376h\2773\370%\314XDq\025Cv6F\363\377g\0265\236\"\241\027"
+	.ascii	"qC\266\244N\275\367t\215Q\362\257\030\332\003\031\021\376\265"
+	.ascii	"\032\377\022\007\242\353\271^\242\361\235\036z!\310%F\200\336"
+	.ascii	"\f\026\204\222\207\212S\032C\307\277\303Gi1\214\177PA\351\313"
+	.ascii	"\353]s\363D\337\336\275kl\206v]\277E\370\002\300m\215L{\326\350"
+	.ascii	"\2528\303\350\213\326#\350U6\345\253\222Jz=\367\245;\274\313"
+	.ascii	"a\240*\223\306\202\027\336\251\314\213^\317X\342\201K\333\225"
+	.ascii	"T\r\230\364\231-\253]"
+	.string	"\200{[\204\242o\306I\236d\253$\2452\330UvW\007\234\334\263OrY\237\027\005\303[\\\032\t\322Hm\250\"\344n\315y\202\262\312\305\2172oQ\334\217J\2370\021/@\357C\267\254\365\211\332\237\304(-\266\230\006=\317\352oX\333\201\214F\271\256V\225\324&\275Z\001Uh\265\357t\035\244\374\232\300\220\n\264\t\316\213.Kx\210\"\303`\261\032\333g-qB\f\330\275\200h\257\312)\274c@\300\342l\343g\266\273\0321\030\002\226\377\200\r,\371+\332\237\023\220\322\224P\345\313\254\330\223\347U:*\303%\213P@8\303\205\270\030\310\316\013\303\203(\254\274)\262\357\323\177\b}\375K\331P&\267#\005\001\250n\204l1}\251\316?N\325\363\2034%\347\022\030\214/\372\315\333\320\364\026\301\362\221\bzc\006\364\236\260\032\034\360\355\220\343\335?\226s0Kp\234\030<\030\272\223&\327"
+	.string	"\364\326\025\035X\031\207\210\302(\346\241'\274\246\377\322\217\247=\334\224\031:M\024\301\331\254\242\327\267@\260\310\2650+\271\266\357\211\360"
+	.ascii	"!o0a\360\207\004\001r\2703\036\312\264\242rh3\304\340\275\"\272"
+	.ascii	"8\372Km\236\346 eH\211\350T\306w\330\222.\327*}\031\013$\301"
+	.ascii	"\006Z\353\327J\027@\203@b\263\215\242\303\267\005\217&\322\223"
+	.ascii	"\315_\027\203\211|\340\275($Z\270\261d\3545\334\366^\215b\371"
+	.ascii	"eK,\214fs6\257,\210\241\366\231\023\235\341\013\307\327=\005"
+	.ascii	"\2161`(07\257\272&{}\327\021N\230S9\210\277\215Q\022\005"
+	.string	"\355x\243\211$Gy \253.QfB>\372n\352N\255\303\231w3\244Tw0\274\354\232\227H\217\226\023\021I\221@4\331\370\260L}\247g\033Z\320t\363\213\315\225Y\346RX\335\250\2154q\325\301#.B`\354S\320\375W\021\315\t\361\333\252]\004\304\320\252\026g5\324CI\272\274\362i\007\375p(\260\370V\376aa\264:\034\255\345\367\246B\355l\240M\r\020\016\253N\025\001N\"\033\252\376\232\022\357\344\022\247\240\001y\273N\315EK\034\021\177\374\230Y\301\255L\032\245\225\205XX\315\236\0018\266 8\312\231\343\236u\321\252\235\002\307\215*\275\200\036\313\037g]\325\263\343m\271\277\023\335\254\241\341\033[\2668\003\215\352\363vM\rc\314v\374\016~\0271d@\371\364\242\366\204$l@\206\321B\335\326u\2601P\324\362\022\276jq\200\360S\306\260\362\351Y<k\266\306\214\346\030\334"
+	.ascii	"\246\"8\217C\331M\350Tqcq)\021}\3306h\223\245\312\310wlD,\227"
+	.ascii	",\034\344jIr\021Y\032\330\311$M\306|J0\034\3155\376\210Y2E\226"
+	.ascii	"\2378\005W\330\222\371\204\0265\322\236\201\301N\2735\323^\315"
+	.ascii	"N\376\266h.o\243\353\fV\016n\340\r\023\rw\231\254\307x\251\304"
+	.ascii	"\347\272\366\343\3725\\\355s_\320@9\315\356\004d\006\263Kq\222"
+	.ascii	"\230\344\203\006\277u1z\221q\343\305Sy4\257\3607\206\255f\036"
+	.ascii	"|\331\331\377\276i\374\021\306K^\317\226P\361\362\360[\200o\301"
+	.ascii	"6\361\206\241\362d\306\321\353\b4\357t\263\234-\344\364yf\203"
+	.ascii	"\225\254\304#\2069?]<\237\034<\267x\264\2516|9\232O\b\313\230"
+	.ascii	"\362\317\360}\270\230c\352N\277\207\207]L\250]\300\017Z&\302"
+	.ascii	"\311\302Q\3412\246\346\005#Tg\226\307\002\257\263\232mU\3073"
+	.ascii	"\221rY\320\232_\243\343-VBPg\344DxX\252\301\235f%\263\251\335"
+	.ascii	"\336hm2\3042P\317J\262\302\276\344e\374\215\363h\001\367\240"
+	.ascii	"1\262\360F\b\037\312}6n\276\352K\376"
+	.string	"\t\204o\377\230\036\013\335\326~\375\334\3207d\t\333\224\r\277\205S)\364\026\212\212\315]\020\374\230\201%];\0206\016\245^o\001\313l\235\211\022p\234\032a\031\267\b\300\315b\r\2455\004'\367\001\223\n\311\343\272\275\325\303\323\305\227I\252\366x0I'H\330T&\217U\324D\303\361\221Z\366\222\211\235\271]\217\013\272\336\373\022\027\263C<\304\352\321b\267\0065\346\214\3751\326\006\f\022\301\306B\311\302\220\007\352_\340\216\317;X>3\r\021q4yO\333F\002\2548we[\031~\301\004.\372i\031\220\"\207\036$/\326\217\302\341\275\024\221H\223`\314\020+a\336\360\357\3674h8\266\307\007Z\233\307\343\316\247C\357\371\212\037\375m\034G4/\r\325\206\220R2\016\325\321\004\023\0228\372\226\307l\2268N\317\315\323\206\212\321[%Z3(\266\026V\227\330\2361\037\232\f\252>\256D"
+	.string	"\373\200\025\316-/\bn\206\220\331\340F\313\3745X\215\377\031R\320\374\n\246\3365=\261\024\361\253\332\006Lf\t\357\031\345\337\353\265E\300\355\273\321\016\002\n+\265\320\354\030\300\225P\266\274|7z\235\376\300\220\031Ft*\024\301/G}\320S\033#\262\322+M\370\247X\004\027H-\020\375a/W\371\242@\342O\256e#^DP]v\3260\315"
+	.string	"x\017\300\327\037.\210_M\213\336D\336\303`\357\307B\205\347y\344\\\315\210\265\276\311`\027\240\223\227\312\255\263\353\221\367\212\370\177\360\262\3647\223\214\216>\265>\267\036<\366\013\202\314\2223?6\033//J\250\332"
+	.string	"t\330\327\276G\346\307\253\357%\333\020\0238V\317\373\365tT\307\345|\315\253\326G\202!\020I\350\300U\200\300\376\325\335\344\004(U\255c \032\377N\245\360\261hi{\231\230\006SBz\321\035+\007\237\216\004\300_\314\237&\016\b5\271x\035\340\023\344T\022\3424\200\314\336R\373z\032\356\206\016\306\313\327\224\037\006\307\256\246Z\234\243\301\203^\223\004:\246\364\001\371"
+	.string	"g\2571\322\345\367%\374\303v\232^\374\207\032\375/x\032\036\264\312\020-\324\320M\f:\244,\003\346;\307\260-\235{T\345\204\247\f\241\007\354"
+	.string	")\377\032f\343!\372\213\004\305.\362\370\227\266g\177\347Z\"\027\020\365\250\277 ]\215\263'!\002[!\323\331\356\320%\360\243L\205\275\330N\202r\204W\316\360V\255%J<\323\301\361\306\312N}\370,\314\230RX\206*P\341\202.WiW\326\324\330\273bW#\020+\304g'\376V\373\223\363=+\213\352\263\226s\037\r\226v\365\036;s7PM]3\255\002\026M\0305\016\365\221>B\006 \266@\037\264\360\310\231BH\"\016\373Y8\231\027\377\364\305\351A\211-\241z\245\365\274T\336\324:\361\034T\217\215\234\352^M"
+	.ascii	"P\222\364\004\337Ne\231\225\213\353\007Z\324=\035\257@X\357\321"
+	.ascii	"r;\346\210>\350i\236`\266\315\372\253A\365F\035\027\245\300\367"
+	.ascii	"Qfn^\247-\254\341\240\032\201\344X\t\32576@\233\013"
+	.string	"yI\351,\327\006bV\303\022 \245\020f\002\260k\362\371\356%\372\274\243L\bK\332pg\031\300F\017*\210z\203\023\003\002\277\220\223\363\345I\212<\366|\222 \377\037"
+	.ascii	"\200(\260\220\205Z@pU\246*;$b\374\322\314\n\264\216_S0\227\026"
+	.ascii	"E \031G\320\213B\364|\221\205\322\221\356o\351\233r3\303E\344"
+	.ascii	"\233r\200}#\324\363p\365\"I\245\035\217<\344\236\3039\005)\022"
+	.ascii	"\004\036\345I#j(\226\314@/K\036(\324`\276\366\304\215\327\237"
+	.ascii	"\204\013Hda\300zf\340\316S0\323\355\\\017\2301\265b\257\222n"
+	.ascii	"v\325\006"
+	.string	"\371\213\324\350\024P}\247\212\277\274H\211_\266\234\3747aHE\207tSs\030dq\340\032\034*0\223\360tZFG\324\367\242\213\264_\033w\fV\006\340\353\255k\304+&\203\200\306>\270R\334\203$\371h\317eh\253\200\307\306\242\033fs\366?\323\220\254\330\212$\303m\362@\341\317\342\3024\215\024V\227\374u\352\003J\262\242T\325\031\221/\375\340\247\2557~<}D\211\227\2355\354\361k\214\300k\377|\215\036\202\314\300\302\007/\303\225yZ\234\036W\365t\t\310k\254\b\2125\231\021\376\300}E\335\337\376\355\005\321P\275\303\034;`\271\203\226\277@\222=q\230\231\036\224t\202$w\032\336\246\312v\013\237SvgHG!49\013\274.\377?\261^\327\236\327\031\"s\262\324\206,\006\031S\207\230\214\302+#\233\016\201\252a\272B\224\326\226\241\270Y\260\310\311\026\bJ\213\0323\033\347"
+	.ascii	"qs\327\220\024\235L+0\304\007\262AV\237\324x\257@\030\270t\026"
+	.ascii	"d\313\317\017\316\327q\356"
+	.string	"\005Lo;\034\224\f\314\261*\301\001&=\343f\253\306\260\017\324\305@\230\231V\302\232L\027\004\250\243h\324T\352jdO=\257E\231\250oT\273~:U\346\326\223\3730^\215n\2620\030\310\016\325\312\216\245\375\255\231\350M\305\271\203Or\337\342Br\245pc\362\355\307\237\271\270]\336\321+KTl(\270\353~l\370\361K\331\202\331\254M\207\362f\337\336\266d\316\363\255\225j\b\372U\221\"\242\241\033\270L\003B\336\nM\327k\213I.\252\311\366\235\202\3319\306\330u\002A\276\342x \314\241\016\273\276\221\210V\214\273\336{ \315\361\007\3731\005\207\365QE[\200\031\2171\213\n*\001\206SA\260\261c\201;\232\327Z0\267D\373i\327\222\360\027\246\326\302X\361\2708\305\307\3008\245\274\361Ih\003\211q@_\035\373\332s\364U\330\016Ai\205t\302\226ir\264[\374G\013\350\351\265"
+	.string	"\376\005\001\006\364\354P^9@M\"\264f\324\005\236/b\236\201tC\241\335"
+	.string	"\342\261D\231&\253 \3362\211\314\2673S\207T\301.\364\237c\345\272}\2151N\257\361\276\370i2O\303q\243U\354\026\036\216\346D:d9#\2648\037\323\322\017\362_q\351\204\224{\002V#\256\376\351#\304\275\356\251\310.p\262sH\212+\314\035\350\262\334`\310\206\314\271:\367\250\002;"
+	.ascii	"k\310\354\241\277\315c\320\021V@fX\204\251\322\210\315\311G\207"
+	.ascii	"\230\376\247\3010\346B\3652\215(\276@\307P\202\337M\340\337("
+	.ascii	"\032!e\355V'\223\276\367\304\300n\007\312\336\022\343\026o\177"
+	.ascii	"\370\215\033\206\304q0A>\310Z\360J)\236\252\351\201\022\365\""
+	.ascii	"s\307\017\256\251\256\265\256\342\301\022\023?\313\355\346\221"
+	.ascii	"\227+\220\265s\325H\340\3400\364\253\335\221\177h w\344\255\247"
+	.ascii	"\027\272\355\237\021\222\275\2000\263^Au\236\366\235\221\270"
+	.ascii	"\207\330\025'Ny\233\003\023tK\264\361R^\025\320\231? \017Z\217"
+	.ascii	"i\031L\0016?\361$\372o\327Z\260\023\220B\242\205j\273O\3573\004"
+	.ascii	"D\223\257h\213j\036\352\006D\002S\337!\215\313n\316B\202\323"
+	.ascii	"\026A\324\020\210&\364M\203\025BI4\242\342\357\235\303\"|7j\257"
+	.ascii	"\375QU\221\327\244\263\365Y7\252\001;ya\341n\313\3401@\212\326"
+	.ascii	";\027eP\363\301\357\302VZ\305\367\207!\224\251\006\240\370 m"
+	.ascii	"\310\253\217\373Q\020\260\210\354\3036Q\300PC\224PWCF\035\177"
+	.ascii	"\377\274f5\037,\200\255\354\025p\207\343\210\b\361\024\202\345"
+	.ascii	"\214!\344O2\375i\006\026\314m\017O,\331\335Q>Fh\017\016\005\037"
+	.ascii	"\337\016oU\341g\303\b\003\034\005^\307\317\325\311\366\360v\206"
+	.ascii	"u\207\031\275B\231\377\240$\302aQ\367\350\3063\327\020\230\200"
+	.ascii	"\354:\266`Q\\:\355\271(\276eXd|\333U\330\"\232\302\007\022\272"
+	.ascii	"\210J\343\"3\304\200o\245S\031TN\355\265\226R\277~\206\220o\b"
+	.ascii	"S\202\fA\234v\3645\360k\3205h\027\260b\257<\271\207\346\210U"
+	.ascii	"\270P\223\004v(C\373\276\335u:>\206\356\363\263\321\331\366\236"
+	.ascii	"\304\003l+\022:-\2678\246\316\326\223C\303\271\204\024!fUB\300"
+	.ascii	"O\206^\031\350\373\237]\031\242O\020\0317\3070EJ\321\212\240"
+	.ascii	"Z\251As\367\0165\021_\371\332f\303\251\247\026\271\002\356-\317"
+	.ascii	"s\366\332}\027\247\225\033\270g\254a\256\217=\301\276+\236 G"
+	.ascii	"\024kX\345\264G\206o\266\031'K\321>]N\370\357\342\276[\251\006"
+	.ascii	"\323\376\250\021\267\030\244\033\336\240\007\203\227\236z\316"
+	.ascii	"\367\025\206\206\264\334\315\314\205`\346G\334\220{d5\201\367"
+	.ascii	"\230.HS\224V7\350\312\221\371\232,\245j\316\022\374\353\237\222"
+	.ascii	"\256\224\232V\0162y\225&W\315\305\304>\320j\333bSH\341k\342T"
+	.ascii	"\355\030\243A\017\306\341k\212\212\266\361.\230\242^'"
+	.string	"\303\262v\343[\335\333C'\031\006\"\267H\342\255x\021\267c\335\302N\030\257\023\020\203\310\245YP\313*\323\3344=f\355\352\354\na\024\332\277#nyG\332j\342\301\325\212\352\313f\234\202\001\331\370l\321G\251\371\353:\275\237:\201\nX\324\240\003\377\241p\327\205\356\352\300\351\322\323k\3214jk\314\251\365\3309\303\347\341\360\263k\325\235\355\013Zf\277;`*\203\004\221g\bQ\205Ak\236w\020nerf-R\002b\033\241\216\214\205\235D\377\022\202\0352;X\247\032\n\352\373\211]\241m\357\255\241\321\307I \305\330\250Y\326Q\225\244\313\340Z\221\333\224\302A\\P\006=\353\363Qw\233\031Y\013\316\205\227\371\232[\273\025\334\246gO\373\330\367\207\315\240\364\031\345H\247\250\272r\t\264Y\fY\353\242x\267n\"\202\b\277\031\2601rH\303\272Z\004ivhO\273I\f\354,\346\220"
+	.string	"\001!.[\246\366\341-\002\277)\220e\024\210\242\004JF\"P\324\353\355\366\200\374\344\273i:3\264\306\370\357\321\326\030N;\347E\306E\226&-\030\261\320\355t\027\320)\031^g\374\302(}\202\225\036\272\256\354\023{\215\332\340Y\276n\247\346\363n\300B@X\316\250\212/\322\363^\346\265"
+	.ascii	"j\212<\306G\212'\361\251\210\325A\250\310\213:\272\005+\260\""
+	.ascii	"\356\301\\%a$FM\n1E\361~\023\356^\002\360\005\352\344\343\251"
+	.ascii	"\314\rYf\263J\234\241\375(0L\225x\253\346\336\"\037A\331\374"
+	.ascii	"o\353\345\b6\335|\027\004\b\206\306\265\366\347u\363\331\310"
+	.ascii	"\025\224P-\\p\225\362f\303\024\353o\266\221\211\031\\\240\246"
+	.ascii	"o\210\214\326\271\034\362\232\007\213\027\263\324\321J)\237\223"
+	.ascii	"\242(\221\370\251v@\214\203"
+	.string	"\342\276\327\034/\320h\"\225\205\221\025f\362\032(\210\273\337\270\237\204\b\270\007\375\026\377\220\345-y\252d^\361n\232Z\305\275\350"
+	.string	"\017h\374\316\212\33528\316}\355!\"\"X\302\230\347\352\246\351\255;\350\276\034\212Se\311\354U\356\207\347\235\210\226S\352\n\265FW\244` \00705o\276g\203\270\242@\364Q\304X\r\315+w\224c\333\254\207\307d\276\tYN\315\\\231\2154\262\352\301\234\202\337%\333\305\215\247\022$#\004\372\245\020\260D\344^\256\224Z\253y\336\270\375\347{\033L2Rsm\332\355\227'S\2512\204\335\246\346\262\245\n\\\216"
+	.string	"_U[\372\235\022\373\206l\"\005\262J>\252B\210N\306(\306#\357n\035\307\205\0226u\013sH\232\266"
+	.ascii	"\357\274\265'\032~\026\333\232\3676a\267w\013\"\r\336\375|\314"
+	.ascii	"\365\341B\026\247\373\251U\223Dr\021~\364X\373A\345M\026\271"
+	.ascii	"\271s>\267\006\004\204\374\347x<\206\253\332v\0340\021W\341\223"
+	.ascii	"A\231\357\224\312D4HWBZh]\261rFJ\263$\3465~/\360\312\303\250"
+	.ascii	"\tb\001\222\353\235?\320#_\006\350\230x\276}\353\234($?D.b\017"
+	.ascii	"\203FT\312~6\313\223\200n|}\265\370\364\030.A7N\243\207\274\342"
+	.ascii	"\367e\032\007\013]\2177=\034\273%\270\202\364AN\256\206\016$"
+	.ascii	"7"
+	.string	"\236C\323\023\307\320\027\237\222\200\021\360\225_\377\321\246jU\274_\257\3651]\354K\026\217\r\327\213\364a\025*\367M\377(\035;Y\260\nFu\250\303 \301\300\212\006\tvLjn\"\232O4SD\332\3037RK\036\275\223\003\212\357\355\336\246\013\252!@\331\217b\357\211\212\263\006\353\243\3250\342~u\256Y\246`\356\002;\3238\262\r>\255\300Kkg\363a?s\302\265+Wen\275 0\357\330\007\363I\374\215\320=\314\267\354Ej\242Z\020\003\235\277Z\2516+S\177C\206\233\342N\216\no\207\241]\357\273,\225\201\265\375\003'\"\236\210\035\360\346l\237\030\343X]\n\t\016\277\022\270M*\235\234\376\306\323B\276W}\255\373\362\246u\030N\225\202u\213{\257\200\305J\341\217\364j\367\300\311Ek@\257\006\216R\226H\021 \372z\237\344\324tn\267\252\003@\177\3467v\362\036\200\004"
+	.ascii	"[d\355\325\306\310\373X[\227\276\023\023\367li\006\246\033\300"
+	.ascii	"\031Yp\361\3470\364\222%\356\323@\215j\235\002\354\232\244\002"
+	.ascii	"\211=\222f\244\214\206B5G\332\321\00715\371\270\354\356\246\""
+	.ascii	"\212~\235\251\200\023$\326Kc\\\254\0360\372\3314@\217\356<\335"
+	.ascii	"+\237j):L\213\245n\246\272\033\265\275\246>.\357\022\220Z\376"
+	.ascii	"W\205B\237\267\320\016\352\021\017\333\204\266\036\215\214\277"
+	.ascii	"#Z\377\362\276h\22273\244\251\335\033F\354\205S\204\322g\374"
+	.ascii	"\033\201\355\364\251\036\r\260\372hON\222w\330s\202\214>\376"
+	.ascii	"x`\2560\032 i\007\375\020\244\231\324\315\340D\273\321.z\373"
+	.ascii	"ET\001\217\361#\260:\311><\023\315\261\233\305`\211\260>\257"
+	.ascii	"\373X\200Y\350\272\351\340-.C\023u\325?\367\310\251\254\365\t"
+	.ascii	"\217m\267\245s\300\353\327\341\tc\0271r\001\027\247\351\3536"
+	.ascii	":\336B\340\201{\275\3525\304v-\362\033g\222\004 \272\210K\352"
+	.ascii	"\r\356\374xX=`^\360\3143\221\264\210$\017\245\336\251\352c\224"
+	.ascii	"\005-\266\374\335\023\016\203\241\252\fv\263Um\344R\035i\245"
+	.ascii	"\321\333\226\373\357p*\266\254\2271\215\364\325\347q\352,\352"
+	.ascii	"N'\224\030c\305\"\313\273!c\312\330\344v\212\317\340\316\262"
+	.ascii	"\2226\206*\341\353\270\330\222\334\316\003d\306\001+\363\004"
+	.ascii	"u\302\362\345\264\237\276\331~X<\274\347\354\006]\021L\272\346"
+	.ascii	"%\330\271\335\311\0356\006\2653O\004\277\026\273&\357C\315\204"
+	.ascii	"|n\022\204\362W\203G\236\251\\\317\036\337\210\355\241(:?\255"
+	.ascii	"g:z\310\r{\316\212\275\215\217J\353Z\323@z\260\277\3604\031\253"
+	.ascii	"\345\017u7<H(\325B\207a\327\255?e~\311\324{\336Q\333\272\301"
+	.ascii	"\035?WQ\320\2445z\213\264`H\205\275\260!\241\244\036\246;\303"
+	.ascii	"#\314/\021\367\271U\350\ra\326S\177G\340\275Vy\032c\235!\036"
+	.ascii	"H*\274\326\213\177\263\352\246\thY\267{$\367\037|F\2333\300\271"
+	.ascii	"\335\237%\312*\035\203@\034\273\366`\323a\364E\022U\027\004\202"
+	.ascii	"\221dQ\231\251Hv\257wE\200\347\321\246\351`\265\377zk\\\224\255"
+	.ascii	"\267@\356\022(p\017q\360\314\0358N\006\200\267Y\362\321\027r"
+	.ascii	"\255\224\337\016\337w\371\274\025\200\323\327*Z\033\235\0079"
+	.ascii	"{7W\222+\257\312\256\206Nm<\224\251Bf\037\"-\023{rf?\256\r\006"
+	.ascii	"\036\375p\234)\350\301\313\266\323d\204\232\276\b3\246\337@\221"
+	.ascii	"\347+\006v\224\226\020\364\253\354\233}$\230\346\036\005\313"
+	.ascii	"\301b\212\177\214\274:\27564\306\375\343K\023:\307\020\341\240"
+	.ascii	"%\313\210\246a\f\354\237~$\377\326lx\037<\303\025}\210uy\226"
+	.ascii	"}\373\337S\362\340\352J\336\237\272\351\206R\n\\\345\205f\241"
+	.ascii	"\005\307\361\220d\362\007\231G\004\236\243#\302\017\002\342\232"
+	.ascii	"0"
+	.string	"\3643V^U\257\b\207\n\021\b\232s\310\247\001\235\264}\240\rA\263%\301s)\363?!\333\224\biH\031\241\026a4\352\302\252I\243d\025\260\361\207\313\3018E!\333\227\216\331u=<\322>\026\306\240\224Rxn\315\361\250\316#\317\340\377\304\264 r\203\006\215\337\177\325QQ&P?1\336\\y\022\270\034\306\367z\036c\375\202\217\b\f.\025\001|\002\316\336\352\354\210_\371\332\020\244b\366\222u%\331\200:\243J\335\313I\207{Kc\177\351\"o\373\276\030H\005\021{\222\346\253\035\033a\254\320S\316l\370\254\241UC\312\022h\273\036\212\033fE\333d:\323 \364\037D\274\252\277\033Kiq\342UQ?w\333Y+\367X\004|Q\001]8\007\200\035\332\326f\231J\200\004\326|\373J\204;\021\032\353\253z\366W\250\304\225\033D)8'\365*q\307\347\265Y\322\021\224a(\274\356H"
+	.string	"7\333\320\b\371\300A\334\356\260\364\031\340\255\211\353\260\222\376s\207p\033\217\255?\034s\353\371kD\005\344.\243|\200\207g.\317\201\027\034F\2240Y!\360\277et\b<\007\201tm\017\231\215\236+\221\325\206\344k\023\016[\214\020B\004D\214\343\210\037\341\013\331\210\325\230\324\333b\233\207\030a\302\342\230@\004\367\214\033P\025\031\037\357dt\003\345\206\220\"\372X\267td#H\021\030\234q\037\306\313\232\321Bz\312\374Z\006\002D\257\317\rq0_gu\235"
+	.string	"A\332\001\"VO\242\007\221v)\245\310\230Hh\036\324.$j\236\322\231\364\205>\220\301\034\2153Q\275\351\323\237T\236\250&{"
+	.ascii	"\201\f\220\002\024\350\222\363\341'\205\252\207\3442G2\264\217"
+	.ascii	"\004m\031\301\242X\262F\272\036_\311x\326K>g\226\346\256L\324"
+	.ascii	"\243\257C\223\366_\354q\343\304\304\004\027\320\255\233\321g"
+	.ascii	"\315\210\035(7\341\3269\250\265[\266P\326,Vx\262\231\331QD\246"
+	.ascii	"\244\311\312\niCMg8\320=\264\234\252\260\361C\364!\252\237B\177"
+	.ascii	"\035\201\002\246\271\353)\307\377\024\301C\332qt-l\260\242\342"
+	.ascii	"\343xO\260\337\3236\254\306PfW\342\2266\007b\342+\201"
+	.string	"\263\225\312\341F\373s9E\244a\315\f\337\"d\203\372\367\242\304\310X\236\365fOI\177:K\223\325`\243\025\273\254\220\r\303\330\377G\003\270\374\025|\255\221\3065\311\n\314a}!%\005\233\r\177\036\305|\252\376\\\"\316\345\352\326{`\273\231M\371\005\216v\035qp"
+	.ascii	"\f\036\266\263I\372\237q\207\177\226\027\2112y\213r\024\r\236"
+	.ascii	"\273\314\201\302\bo\237:A*\367%\206\331\230\243 \201\2655\\3"
+	.ascii	"AdP\2200\302\265c\332\262\372\"\200\027\260']\203\2334}8\312"
+	.ascii	"\017\341\220[\030\2543\300b~3M\323\037\277\274d7\002?\033\270"
+	.ascii	"\227s\352g$\211\301\366\374X\224\227\316\004\300\360\337\025"
+	.ascii	"\027@Z^\314\001M\214\366\252hW=\fx\2032\036i\225\324\216h\243"
+	.ascii	"\024"
+	.string	"A<\331!\325[\341\215\362\251\305\020\3739x\200\360\211lP\217l\251>\003>7\246\2744\301\205\016\"s\213\2726\211\216\353\bo\210\211{n)~\213\235if-\226\250\363\240\307\227\036{\202\363`<Q|\372\255\347\235\352X\025\331s\376\312'F\252\231\331Sg\372\r\332\205\034\004\\m\266\332\275\302\024\004\3504\262\022\307<\017\002\026\311W5x\\\305t\335\343\351\032R\316\001%\311\345\223\353\r}\253\252\240\367}\234\031\262u\241\266\257\026.\230\371\340\342.\355\271d\366~\2063pQ2Vl\335\254w\336\032{\016\023\210\016\376\356\226\f\256\b\352\363\001\311\337\3478\177\244\224q\302V\b\252\"\223\241\300W\350\255-4\323\366\377\004\3354=\267\027>\"\323\315\325\224D\277\346q\0378L\276\200\247\275\264\257\fb\322\364\017\221\335\223\001>\3516.\232\341(e\271\207\250;\336\246\360\337\270\245"
+	.string	"\352]K\3024p@\267r&"
+	.ascii	"\247OpA\365_|\340\332\024\341jtTj\232\225\302\tZfZ\032\302\242"
+	.ascii	"\264\224\365d\225O\2569\364\017\336A},\3463de1\225z\240\203&"
+	.ascii	"\252x\227\232\020]`\214\200\002jY\311\211m\335K\342\224\364\017"
+	.ascii	"\302mf\253Z0]\277\207\335\002jRae\356\257\220\230\007\364u@\271"
+	.ascii	"\275\251q\201\360\220\274\246V\037U=\305f\273\200\346a\334\t"
+	.ascii	"\231\225\215'\250{aA\350\0356G\310D>\245|\306\f\354\237\230\321"
+	.ascii	"<\230|`Q\241z[\246\017\344\324\216\354\005aS\327\344v\r\232<"
+	.ascii	"k~\264\225_\274\316\271\363o7\337H$\202\315k\360\340\252\b\005"
+	.ascii	"\302\2155Fe\021+\027\304L\001\020\264@\221l\213\340$\241e\023"
+	.ascii	"\303\376\255\345\037\006\232\244\b\020#\246\275\343\340\036\206"
+	.ascii	"0l\311\001\026D\332\f\340r\227\001^\004@\234\n\222\305\025\310"
+	.ascii	"\335E\363\020\255X\344k\224\027\203]\222\003\234\213\336e\264"
+	.ascii	"\201\215(x@\214+0\363&z@(`\233\211w\242@I\373\355\360\230\341"
+	.ascii	"\261\242\310~\367?2\333o\033\364y\241\313\306\bn,U|\177\366\311"
+	.ascii	"F\351\326G\t\222\247\323\r\300\0170\3242\024(\004\240\2235\254"
+	.ascii	"\031\340\r\202\366!\324\353Kb\027\006&6H\252\272h'\023\300\335"
+	.ascii	":\241.*"
+	.string	";\227\204\320`SP\215\261\311\004*\247\361p\304\266\206\351Y\275\003nGM\301\361\262\2022\3665\213\b(\350aw\372\335\245\322\354\245\367y\022\322TYzI\365\243\016\371\336\350l\326s\310\264%_\003n\226\201\r\\0\306\222\337\345\302\373\306\016\024\025\2620\222\037\002\267\343\025\321\375ZK\306\331,\016{\310\265\215\"\303@\r\b\322\255\277D\020\3502\332\376\376[\300\232$\332\005\347'Ds\351\030o].lmb\034\356 \2063\216\317\222\231x\316T\217\247\211r\336'\213<\307o\274\206\016\215-\224\363\257\204)\021\224\353\302)8\216\036\220\212C\362\327\210\312\302~\021\365L\033\207\236\337\035\3717T\345H\362\372@\2058\037\305\024\034\306\323\204\004\036p\350\240\204\224QO\302\361?\227:D>\2765<\007.\232H\265ZW\240y3M\366\372\003\202\024\201\375\334\341U1\215.\"x\371\304"
+	.string	"E\324\027\263\312L"
+	.string	"F\254&\005\363HK\017\330\274zk\314@1J\200\262\322\320\027\213\255\325\312\004\210(\023\341\342\215\251\236J\263\f\264\222,\300\n\221\177\177J\0333\225\005\374\366\256\212\225I\255\373\215\200\303\334\350\257\202\271\022_\265\256\035\234\322%`\266.\036\017\t\230\213\243\b\336\206\300\205Pm*\256\031\334@\013\031\254\0206\324i,\243\276#jh\314\204\211\220\033\024\244\017\262\013a"
+	.string	"\236\332\305\2618\226\364\325\332/F\370\254\216g\266\021\316\246c\303\200\211'Kj\025A\205\300@\376\217k#<$\356d\001\254+\\\231\020\314\315\177\222\372\030\252\234\206\200\305~\350\b,%\356;\304\004,\n\232\212\364\3342\034\357j[\365\332\332Wy\206\036+\230\344\345\215\337\260\366m\017\226\216\357\036\354\262\377EK\355]\217\353o\334JJ8\371\232\361l\031\237\337t\344\347i\205\307|\224s\371\261>\311\344P \367\301\300\263\226\234y!\261 \374\335\034,bq\266\320;\346>HIE\374\247=\023\321F\006\013<\310\332\350g5;\262\016\033\301{\031\177"
+	.ascii	"\344\331\230\263\3358\232\243\300x\333\261\f\334\217\301\237"
+	.ascii	"\002\256\337j\371\033I\036\225l`\233<\210\300\210\212\327,`\376"
+	.ascii	"\341\344d\376\032\365\266\306@p\341J\260\260\226iO\315[\244\036"
+	.ascii	"\314S\362 q2?\242uU8\244"
+	.string	"\336\317\277Sx\325\2558b\373\315\034\341\350\364\036\222\3039b_)\267\263\206\332\236\255\205\347\236+&\024\267!U#\365\333\rs\253\017\270<\201\261\210<\271\215\2378\352\372\263\332tj\311\260\344\201\341\245b\362!b\362\305ai\202\274\031\214(\247\004\227 \006\034\372|\037U\235,S3A\317iW\266}`\bU+\214\307\234\250\344\005\3200>\301/\032z\006\333\345hP\365\f\272pK\207\003]\r\373\255 Nb\237Tp$\024t\277d\027\rn\242\250\3737\272\234Bd\353QKN\351\353T\002i\023k\3157\244\276<\247\322P\222\003\277\315t\225\375ge\317\375\242g9\221h\304\252\356^[\354>\360\335X;\371\340\216\356\250\212[6\235\206\246Gj}\234\324\310n\003\207\336\025\017_\330f\304\225Hj\364H\226\t\276\277\177=\033\312\312\362\005k\f\027N\213L\034\356\301|\203\362\035"
+	.string	"x\260\261bJ\356SCZg\"*3t\222\2554\336\360\325\307\305/8\0373\373E"
+	.string	"\263D?Ue\204PL\240\206\331\320\320I-\202^S#\265J\027\271j\221\207F\260%N\203\b\366`\t.\204\230F\374\302\321\304\202\265nRn\317\007\t\3421!WZ\326r\232\243\363u\366\004\341,\334\343vw\201\b)\n\340\214\273h\261\226~~\344\321\004\0037\323\b\252G\331\213R$\022\034\"\231T\307\206\351FA\202\027\222\363\2442LD\022\217\351\273\017\221\347x\201"
+	.string	"Y\210,\327\256RI\"\241\367.\004\251\376\220\301\201\0354\t';\252\025\246nC\026\243\256G\001\211O\231\204\035Ym\250$\243\272c\373.\002G\031\334!\253\374\247\325\333\336\316\22261\272\216<\362\266\351\343\216\227\0218\317\017?\222\241@\242\215\205\260\013\253\3557g \315w\b\374R#a\035,\235"
+	.string	"\035P"
+	.ascii	"\366\314\270\370\322\b\224\246\021e\210"
+	.ascii	"P!\204\226J\362\376D\302=\276P\272\370\265\304\337\316vq\241"
+	.ascii	"\335Eg3\3201\"}\250\217\202\355-\036F\325p\254I\264|;N\f\022"
+	.ascii	"/\350\202\230\t:\330\222\266\201\304\006,\376Z\271"
+	.string	"\273I\222\344\311;\005\021\003\272\353\n\376\0253\302c@*.\340\240E~\327g\350K\271x\270\361\307f\203\261\244c\025\246\2232\007.Da\322&\251\211\375ovb\203;0\rTM)\356\265\363\320-gyk\234\206Bi\260O\263\313\232$\242[4ib`\032\251\314)`P\341\016+\342L\031\353L\210\362\335\277\r\370\026\321s\325u\007\341b\364j\226\324\351(\300b\326\344\314\355\372D\344\231\035\t\275h\360L\350[\245\225\206\315^u\304\360~\323\310\023\375~\236B\256uINf\340\232\343\n?k\343\370\326q\341\216\234G8ty\216(\275P\346\301[\344\022\017\343\273h\327\270u\302CyW\354\212\034Sd\234\305\032\270\021W\335\\\224\016\350w\245\327\300\006\245WTc2(U\241\225\020\001\377\307XG\004\333\313RJ7\233\025\013\270\326\220\315\371\302f\0178N\276\210E\247\263y"
+	.string	"(\274)\020\245\361\3218\261\005\376\007\200\242?\331\216Z\363\324/\035\235\267\365~<\3170\322s\364#\013\343{\251\203\345H\327\001\233\376\200\355X\275c\201\211\277\t\323\205Sy\320\033V7\001\316\322\020]\322\210\253$dy.\211[\275\271hX~;\244-\336\272I\220s\266\244_\033>\217xEA\206\361Di H]p\034\rCK_\026\021\354\327\030\212\315v\326m"
+	.ascii	"l\020\3453\371d\025#\215\324X\263]\336p\026B{$\016\205&Q\334"
+	.ascii	"T\240\272\332\311M\024DSr\f\234\005\262)\205;\233\237\256\312"
+	.ascii	"\233\341e\224J\266\261\200\027\317Hb\266\"\214\013\321I\352\363"
+	.ascii	"\224\350\362F\262y\3635\347\ro?\026\206\265\332\375\344\230\200"
+	.ascii	"wx\353\005\342\245"
+	.string	"g\276s\362@\032\017\020'\023\353>\220z\232\217\371.\030\332xXU\233\305\270)\335\364\352\225\264I,%\302\205\314&\002\002\310\340|N)\251\224\247\206J\365\246\240\016a\204\027\022.\307M\002\016O\346\355\3716\212\t\370~\025\002 \260\340\\\372\244\211'=k\300i\377v\024\355\277\375\021}e\227\365\035-\236\025\002E\0051\321k\270s\335y1,\256\n\243'-\223\341\0012\3136L!\247\325d\205f\f\202[\243\005\2657\250\016\357Fno\022\355\017\312u\315A\f\377\007\224\213\034\223\355\226+\354\276u\336\013w\207\260 \334%\330\377\270\304\251\304\231\004|\272Q\331\303H\337,\300\327\335y\363\024V\202VM\276\353\244\025\037\252\201\273b\224U\361\237\331\004\222\340\237e\030CT`\262\262\357\206\025\200_\314\301\360\271P\013\227\016\347\025\030\263_\261y\321\227q\332f\221-\232\246\331\341Z"
+	.string	"\353\370Lo\213X\f\241\313m\311\275\2646b\371\252\311\200F&\0372\340\233`\b\366,\224e`\242\240\023}\235Q\002P\316:K\270Q'"
+	.string	"Pr\220+5\255\003\362Q\305o:\271F-\310\0303h\334\353\030a5\260\007\035F\031B@\256MFx\001\327\021\235\002o\342\372\254\351\016`\301\b\222\273\370\343\262\031\277\nLWzW\330\255m\240\2750E6I\013\351\311\302(\250\300"
+	.string	"\213w\266dA\335\025\242}\023\346{"
+	.string	"\240\260\366(m\300=\024\242\032\334Y\034\017t\276\2054\016\2367\242\205\3620\242n\003 \304=|`\\\247|\262g\205\370\220\b\030:h\334\264\031\235\374"
+	.ascii	"\323\243\037\332]r\336\376\265R\335\304\264\023\023\302e]\367"
+	.ascii	"c|\363\2243\203L(\247\222\236\305\006S\rQ\377\240\036\213\204"
+	.ascii	"\334i\361\242Etd\303\272h\326\323\035\346\246)\326\271\031\211"
+	.ascii	"\221\225K\361\"#\\\r\026\306\275g$U\341\233\354\3740\307\002"
+	.ascii	"T\262d\336\277Q\353C\225\200\202\326\310\344\022\030T\373\317"
+	.ascii	"\247\252\013\270\375\206\b\264W\356\345\205\340\276\203k)\350"
+	.ascii	"\325\rv\030\307\220\303nS\"\355\244`\336\177\311\221G)\024\355"
+	.ascii	"QD\006\216\035\355\360\335\265\"\264\244FT\322\006\255:ue\016"
+	.ascii	"\321\243ZO\236\277\303\002\017\021\3522\025\037\326\032aH\207"
+	.ascii	"oE\242\245c3\322\225\277\317\024\362.\354\265Vw\275\244\303u"
+	.ascii	"\370jT\252\033\345\206Yc\357\314- WE\256\3548\232\354\275\202"
+	.ascii	"6\351\344\032\303\240cD\"\345t\306'D \324S\007|:\230J\004\b\033"
+	.ascii	"\202\340DD\201\335\fM\371\3041\270I\344\002Y\261,\363X\006\350"
+	.ascii	"\021S\n\251$$\2412`*\013WZ,\271\32206\324\345\334Pl\246;\270"
+	.ascii	"\274G\352\273\321y\336\237\373{\t\016\251\f\242w\322\023\214"
+	.ascii	"\366\315w\\\217|\330RF\234\016\n\221\3532>6\020\377\205\222\002"
+	.ascii	"\020N\333\236\213t\354\274EK\004\322\302-e\026\231\022@\344Z"
+	.ascii	"\205*/@A\\\337\277\244"
+	.string	"i\021n\303O-\233*\365\257\017\244\r\331\025\032\244b\353%y4\253\334Q\013pEj\310<\236\313\t^\230\fm\206\240\314e\260\350\356\t\375\273\371\005\335\362\260\036%\300\353(\3454\222[\223M\377]\221\354\300\002}U\bs\222,\004e-\006'\200\261cu\327\306\036;\275\344$@\0136P|\305W\007\037b\215\270v\371\251\0305\251K\005+\023S\227W\233\205ga`\347\204\220Huq\230e\027\211\247:\215\244\370\r\031=\357\265>e\343\212w\022\311g\013a\205\341\346\200\306H\367f\213\213\3151\306\f\273\030\032\243lxK\314\200\302\273\336_\265\222\301\351\331\024\026K\203F\204\266\334T\210\301O\213<B\206\037\003\262\266\371R\200?R9@\350\322\223\024\226\254\006)Kl\266\214\300&W\222\345t\254$\350\005\245J\207\324\316\356\002\211Q\317U\325\f\355\"u\312^u6a\304\304"
+	.ascii	"?S0 y\356\226P\021#\267v\221\213\036\b\274T\354Vj\321\007\352"
+	.ascii	"\r$d=\204qILd\013\215\356iqv\364\b-\336\213\3323\233\033\305"
+	.ascii	"2\177>\214mu*\001Sj\221\250\361\200\257\362\220\323v\210\240"
+	.ascii	"L\351 \240HI\205\231\312KK\250"
+	.string	"\331\274\037\215\245\267\333\203U\0272\213p@g{\322\374Vx\244\330\023\020\267\343\315J\377+{6\026C\343\005\3747\334X\221\327\253\265\356\r\221\242F\207\214\314\214b\026\202\332\332\032\317\256y\217\027\355\307\357\262\241s$\224D8\001\232\261\016\247HI\244\362\323\301\262\025\301?\356\234\237'\210\231U\225\331\203a\033F\303@\325\247\274\352\001x\214\255\216\001\224\256\321\350X\333\031\204WU\252y\270\345\314\337\200\326\372\261r?I\274\321\377\020\036\377\373\031\n\272\325\324\021\204\315\333o+\235\317]I\354R\3517k\217\260q\350*R\374\276#*\002\242\027\021\246g\254\250\261;;#|\345t\206\033d\301\177\264\006\205%\177\314?\340\030h\337&\340\006\356[\315x\213\253g\033D\2225y\365\303q\227\201\212s\344\325?tw]\2237\226LF\033u\313\013\365\311\nOc\250ol\316u|\200\270\276"
+	.ascii	"\\\013i\311\371\023\237a9\317}a\342|\255\272j\030\3353A\215W"
+	.ascii	"u\236W\350w0}\333\365\016\\\027\373}\020\326\351\022\020?\032"
+	.ascii	"\325\331\305\301/K\273\374\272SF\257\2673Zn\021"
+	.string	"\274vC\037\364\303\247\2470\025\307\022\262\034\027D\037\341\274X\365\220jy{\320\361\373\257\177\376Y\266\340|vC\237\002\215\315*\240\246\201gb=\370\360\030\340X\365\276\315~\254\037\353\345f3\377::lm\356\1779\bD\233\247I\360\316p\026\361\235\313\207\345\204v\260\346\357\277d\237\315\300\254\275\263\257\264w\3575\310\300\237\332\273\364\013\330\013\003\360/7w\255\325\f\245L\337\273"
+	.ascii	"?\263F\377\242\267&\rK\t\016r\352lZ\265\305\211\336\230\360\307"
+	.ascii	"\3116\274jbv\254\275\3367\335\243m\215~\220z\317\317Y\230\316"
+	.ascii	"\030\360\307\341\306\311\235\375\375\351\306\3477\370\352n\303"
+	.ascii	"\342\343Z\367\026\330\374y\355S\222\353>\224\237[\3007V\216w"
+	.ascii	"\207i\247\366\353\263\320\206\373\223\036\f=\027\35614<\267\037"
+	.ascii	"\036\253\355bMZ\202%O;\310\245<\337\213x\203\372\362!\220\337"
+	.ascii	"\367\344\376Z\354\035\246\275\317c\372\356\373\267r\0072\246"
+	.ascii	"\267@\342)x\364\247"
+	.string	"\315\317\335\236\226\376[$\355m\341\243\340J{\347\320]\224\345\327\203\211\321\257V\333k\233eA\230\336\323\264w\357\275\364\314\266-:\026\007\261\341\204\305\027%w\232A\207\320E\267T\337O\367zd'^\251p\237\316\021\"O\017\311\372E\263L\314\2552\202-\035\0029\376\365\360\371\033\332\204e\3237\305\212L\351\213\313\357`\304\304\241\357ML\374q\350\235(\345&\177\250}\235\345\260ng[\204\361O\256\235V?\320\035yR\263\233\377\376\261+eS\3012\324\202q!\373\202\347\265\261\2376\335A\020\332\243a\277\311F\366'\303\347V\3167\b\270|0J\233\256\372\305\342\331uh}\324\215CCT\330\024\332\327\021\216\341\316Fy\345\361\274\306\210cD\214K\001\317\263\216\200j\235\3625~\204\367!\2133\370\271\227\231Z\341e\034\233OC<\311\316?\342\037\023\365u\363 -p\315\225\200\375"
+	.string	"g\363j\003\264\035\341\275\005\301j\264\354\307\364\357\373T\323\353O<n\316\201N\317\360c\030\2307\006\313p\354\232\363R\251]B\224A\350\362\215}\275\272\232g\200R\373\203\231\2336:|"
+	.ascii	"A\244\316\244\376\240\343\357\350K\320Z\212\r\357\343#\336>\004"
+	.ascii	"\326\376}viw\354\215\320\244p&\373 \360\362^\252\306&n\373\266"
+	.ascii	"\354\235Sf\331\231*a$\260\377\347\b\254;\017c\347.Dz\020\252"
+	.ascii	"\364\340\016\313\200U[\257\341)^\211\211\001\234\354\266\322"
+	.ascii	"^mk\\\026\200\353\243\r\235:\210\362\366\244\327\347l\375\315"
+	.ascii	"L\223\021\r\024d\337>\357\257tl\002\330i~\373\271\252o\267\207"
+	.ascii	"\265"
+	.string	"\3602\333g\335\272\343\375Hm\274\254\354\025w\275\023\370\317\221\324\226b\374c\364#\003%\307\227\375o\321\202\024r{X\343\266\205}^\027\264'\030\277\257|\250\227D|r\366\257m~\036\357\236\353\262I\013\235\246\365\350\351\3242\257\326\037\324\264\337\262\264\263\324c\r?\352/\354J4\2161]\233j\344M\360\205\203\342\361\256\325\031Sq\307\212:\322\334\177\365\322^\206\256Ot\343B:tG\305&\227\255w\201X\302\270\265\215\266\263\325\272\340\342\017,\327\375\323\245\361U\037\006\013S\240\340\220\227\035\322*W\004\231j)\2067wO\352\177M\272\357\352\344(\200\263\266\276\005\374K\013\216\204\307)\335\020\334\237\377\306\177\237m;>l\236\336\273\255\200va\261\367?\214Y\300\\x\364*\036\260\370$\304\277!\247\262\353\025\330\314\324\346r\240t,d\247j\274a|Y\264\335w\035F}(\265\223"
+	.ascii	"y~\354\217\310\374#U\337\310\332C\37238\311\273ou\202F\017M\365"
+	.ascii	"y\242\246\246\263\226\256\221%\331\0029\376^\37222\251\313i\350"
+	.ascii	"\203\344\377?!{(\213\245\2475\267\207a\206[\201>\321\375\007"
+	.ascii	"\327\337T\377\260\374\"\221\317K\333\263=Q\214\263b\033\250\361"
+	.ascii	"\205\365\272\330\343\033\316\313\0164\247\363\333\220\324\261"
+	.ascii	"f\236#\3704\346:\006\326\200y\371\247\252\355\023\365\"\022="
+	.ascii	"\037\327\f0\246f3\276\200\363\353\342\254\266>|\002\334\270\\"
+	.ascii	"6q>bl\0315\334\203\027AX\265\316\325\335Nvm\365\311V^_\370P\343"
+	.ascii	"\227V\r^.\242\276\215\177"
+	.text
+	.section	.gnu.lto_.symtab.aabe339913cf58ea,"e",@progbits
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\n"
+	.string	""
+	.string	"mspFcProcessStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\n"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\n"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\n"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\n"
+	.string	""
+	.string	"huffmanTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\t"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\t"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\t"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\t"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\t"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\t"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\t"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \t"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\t"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\t"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\t"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\t"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\t"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\t"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\t"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\b"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\t"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\t"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\t"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\t"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\t"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\t"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\t"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\t"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\t"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\t"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\t"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\t"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\t"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\t"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\t"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\t"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\t"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\t"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\t"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\t"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\t"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\t"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\t"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\t"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\t"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\t"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\b"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\t"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\t"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\t"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\t"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\t"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\b"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\t"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\t"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\t"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\t"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\t"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\t"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\t"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\b"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\b"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\n"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\n"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\n"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\n"
+	.string	""
+	.string	"huffmanEncodeBufStreaming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"flashfsReadAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\n"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\n"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\n"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\n"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\n"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\n"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\n"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\n"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\n"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\n"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\n"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\n"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\n"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\n"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\n"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\n"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\n"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\n"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\n"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\n"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\n"
+	.string	""
+	.string	"flashfsGetOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\n"
+	.string	""
+	.string	"flashfsGetSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\n"
+	.string	""
+	.string	"flashPartitionFindByType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\n"
+	.string	""
+	.string	"flashfsIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\n"
+	.string	""
+	.string	"flashfsIsSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\n"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\n"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\n"
+	.string	""
+	.string	"blackboxGetPRatio"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\n"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\n"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\n"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\n"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\n"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\n"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\n"
+	.string	""
+	.string	"histogramMean"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	""
+	.string	"histogramPercentile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\013"
+	.string	""
+	.string	"latencyTraceHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\013"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\013"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\013"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\013"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \013"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\013"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\013"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\013"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\013"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\013"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\013"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\013"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\013"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\013"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\013"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\013"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\013"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\013"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\013"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\013"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\013"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\013"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\013"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\013"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\013"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\013"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\013"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\013"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\013"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\013"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\013"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\013"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\013"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\013"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\013"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\013"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\013"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\013"
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\013"
+	.string	""
+	.string	"gpsSetFixState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\013"
+	.string	""
+	.string	"blackboxEraseAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\013"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\013"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\013"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\013"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\013"
+	.string	""
+	.string	"applySimplifiedTuning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\013"
+	.string	""
+	.string	"schedulerSetTaskHistograms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\013"
+	.string	""
+	.string	"schedulerTraceStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\013"
+	.string	""
+	.string	"schedulerTraceStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\013"
+	.string	""
+	.string	"blackboxCalculateSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\013"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\013"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\013"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\013"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\013"
+	.string	""
+	.string	"schedulerIgnoreTaskStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\013"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\013"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\013"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\013"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\013"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\013"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\013"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\013"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\013"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\013"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\013"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\013"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\013"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\013"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\013"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\013"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\f"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\f"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\f"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\f"
+	.string	""
+	.string	"setConfigChanged"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\f"
+	.string	""
+	.string	"getTaskHistogramInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\f"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\f"
+	.string	""
+	.string	"schedulerGetTaskHistograms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\f"
+	.string	""
+	.string	"schedulerTraceGetEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\f"
+	.string	""
+	.string	"clockMicrosToCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\f"
+	.string	""
+	.string	"schedulerTraceGetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\f"
+	.string	""
+	.string	"schedulerTraceEventCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\f"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\f"
+	.string	""
+	.string	"applySimplifiedTuningDtermFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\f"
+	.string	""
+	.string	"applySimplifiedTuningGyroFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\f"
+	.string	""
+	.string	"applySimplifiedTuningPids"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\f"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\f"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\f"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aabe339913cf58ea,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1004 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.text
+	.section	.gnu.lto_.icf.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375 \301\265\004"
+	.string	"\204\007\265"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\215\373\361\257\013\002\002"
+	.string	"\002"
+	.string	"\003\376\271\205\265\006\004\216\314\365\214\005\342\351\332\356\006\f\002\001\002"
+	.string	"\002\002\002\003\004\002"
+	.string	"\007\356\225\345\247\002\002\b\322\217\321\373\007\t\222\270\367\271\007\026\002\005\002\005\002\001\002\006\007\002\b\002\t\n\016\214\227\337\207\007\n\002\013\002\013\002\001\002\001\002\f\002\f\002\001\013\021\275\353\367\242\b"
+	.string	""
+	.string	"\013"
+	.ascii	"c\n\316\355}ijj\301\347\272v\256b%P\250\240\333\235J\232\203"
+	.ascii	"l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"%\004"
+	.string	"\342\204\f\021\300%\035\377\233\376\177\347\210%\326\022\262\332\3362\245\026Rz\230\244\331U\211\004\343\363\347Q\364\253x\227NH\315\354}\3026<\016(z\033mq\"' \320\202)\232:\215"
+	.ascii	"\216\233\3016h\n\b`\367q\224\201\277\034N\330\222\301\372\236"
+	.ascii	"\033-,\327-\032\201\204\241\324\205\035\027\270\021\363\005\303"
+	.ascii	",\304\002p\241\2351-\304\022\217p\347\001\001d\250\225C\b\206"
+	.ascii	"\323\301\2131\001\020\003\n\270\bC"
+	.text
+	.section	.gnu.lto_.inline.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`*\004\025\021"
+	.string	"\306\230WC\020\257&\215\001\021HGa\254\317}l\020\341M\321\312\025H\034\206\017JiRB\273\235\303\354<\376\261G-"
+	.string	"\324\215\2176c\367#"
+	.string	"\n\004"
+	.string	"\020"
+	.string	"\240B`\377\231`\212\213\256\263q\223M\366\2262\005E"
+	.string	"D"
+	.string	"H"
+	.ascii	"\371b\300\245@\013\201\f\221\033*\222\3378\322\343mhHv\316\005"
+	.ascii	"\372\201B\005\022\b\256$\274\377\320\026728\237\017uq#\203\323"
+	.ascii	"Y\317J{\334\253Hww\337;\330\335\221\327O\005-\305\356Z\237q%"
+	.ascii	" .b\272Y);\321hq\217\273v(\007\233\224J\256\273nH-\234Pdxcc\240"
+	.ascii	"f\242I\201x\307#\250\321\324\214`y\273]H#\234x@y\303\335\243"
+	.ascii	"\2310\301\020\343Z\341\256\240\354\214\265?{4\031\223\227\202"
+	.ascii	"\374\326\b&/\025\311\004\357\322\220\253\t3(\022\200?y\313\314"
+	.ascii	"=n\324HXHR\231\002\2420\250\225\224\\\0013<(WuV\312OW\342}\203"
+	.ascii	"\346R\363\240\345@\033i\316)\207\305\200\241[wnZ\001\177~V\212"
+	.ascii	"\033:\274g\240%6\246\230\250\223VL4\004\370\202\034\357@z\272"
+	.ascii	"\360\"\302\r#6\214\035m\006Ez\241\3038\214\"5\215@(\351\f\261"
+	.ascii	"aHO\300P\241\342\306\026\271\220\356\356\252\365_\032V\250a\275"
+	.ascii	"3323\322\244v\345\220\"\"\262\232\007\022`\0245\203\342\240\023"
+	.ascii	"8\023^0\361\re\230k\fi\b\221^\243\021&\016\022a\250&yn\344\266"
+	.ascii	"\"\227\017'j\254V,\311\240u\250\366[oF\0342<FD w\335\fz[oM=v"
+	.ascii	"\235^\035\026\017g\002\\\213\r\031%\276\242\361\022\342\013\346"
+	.ascii	"\317\253\362\327\342\024P\r\356\277\036\220\037\035WS\275\377"
+	.ascii	"^\210\333\346\007\376\016\227\252H\024\036\304\230\200\030R\357"
+	.ascii	"X!t#\210j\375\252\333G<j\007E\027Gjh\226\233\361\2309\013\354"
+	.ascii	"\245\303N\272y\203\312L\002\250\261\221\321\201\221j\326`\207"
+	.ascii	"\315L\227\t\004\244\336\350\377\230c"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\345\007=\020"
+	.string	"\306\323@7PI\224t\220<F5z\026\272\244S\334\214\220\212uU\325\260\241\316X\314\314\362\243\206\313\311;\013t\006\373\361\365&\006\330#\364?j\373\320\267\215D\322H\223i\007-"
+	.string	"0"
+	.string	"7"
+	.string	"\034\316Y\3415S\253\313\346\325G}\245\206\263\252E\337Tl\333\266\235\2519m\317{\317\353\371\251\003\345\016t.\0329\253\367sJh!\005p\366\362\354u\001\215\364\252\332\325\003\374\021\314\267\277a\263\004\bG\250\034\374"
+	.string	"{\301+\270\317\340\006\004\362\004Y\300@G\260\26491\274\245\350\216\030\257\013\303\016\007\347\022\t\212\202\021\306;\257U(\252\312\262\026\013\b$\022\221H*\225\355\354\035\332n\037\360Z\213\345r\3112\f\346\t\037\372\200\313\234\260f~\002y\206_\031m\337\252E\345\205\327\354\313<\364d\322\030\343\235F#F\b\247p\373\255s\323\004a\024\035#\205\362\236$!\020\231\f\203\361xh4\216\200\231\250\361\2644\"#\005)(T\2061\360\"\021\"\2426\022@\001#\206b1\342\210\200\020#4\002# \b\t\363\324i\r\034\300\365(b\312{\343\"P\035*\261\007-\243\220\200\320\251\224\232\202\214\020T\372"
+	.string	"\271\204U\007\365lD\237D@`\206\236\313\310\177\213\3752\270\001\324 e\303\242\325G\f\323\252\350b\177\302\317\300\006\210\270\031#!\354,\307\307\310\215\037\307\376\312\315*3F1\373\341x\212\037\235\360'?\325\373^\320\206\260\216\276\223)\357o^\371M \024\321\226\351F\031\244\b\0363c$\2112\225G\3479\227Nd\217T"
+	.string	"rt\271\036e"
+	.string	"\001\372\246\025\271\t\264s\3366\214\241\004\206h\275\205\030\276t8-o\226=\335\277\372\314\371\300\373\311\357mu\312 ,5\251y\361\256uz\334\300"
+	.ascii	"%\203h\270+\001\177}K\201gL!pL\320K%\036U\356\352\004\230\001"
+	.text
+	.section	.gnu.lto_.pureconst.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\007\231\004\b\270"
+	.ascii	"\004\t\271\004\016\230\004\021\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375 \325\375\003"
+	.string	"\002\007\025\035\240)\303\001\240\344\377\377\376\375\330\301\203\202\032\342\265_\3623\036\231\346\266\273\255%\231\0022\034\220\305\361\261\"\003U\031\264t\235\342\3023\261S;\304\356\260k\236\315gY\202&\002RJ[S=\301\fS\230S\322m\272\352U\202\237\200\215\355\"R+\001\021"
+	.ascii	"!#\322\205@pc\366\300\007!\006\204f\007\202>C\006C\233\032\006"
+	.ascii	"\325\271\\\023[D\273\354\0132\001\005\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.e0cb6397f76f09bd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.50.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\357\n\3052"
+	.ascii	"\232\\l\02470n\245\003\254\230\313a\001\213\215\305x\212\253"
+	.ascii	"I\302\215\377=\305I\333@\200\340\301@\313!Bn\235\374\213\363"
+	.ascii	"\267\233\004w98{\007{\3047\037a\355K\""
+	.string	"S\222\0016\0011\001>\001\030\302&\375S\366S\001{)-|\222:\256\216\227\035\203\321\351w\262\377I\204o\322\346\227(e\307\021\032\351O\262_\t\271\016\275\216\370(;\226pH\177\221\375F&<\221\241\327\025\021e\307\344\234\366Y\333iQ\2205tL\304\271\354xB\037\355y\333_Up5tL.\306\325\343\262c\n\250\264\253\332\276\312B*5\267#\306\030W\227\223\035w\250 J;\251\355\245$\214Zs\273\242\214qu4\331\261\007\013\236\264\343m\377\304u7\303;\325\030W\207\313\216?\\\260\323\256i\373\246\013\231\332\274S\321\241d\307a\030(i\267\264\375\022\206J6\334\323\215q\025\222\035\203\310\220\264K\332N\227#\341pO9\306\025Gv\034\"\203\"\355\214\2667\312\260\250\315\357\2101\262c\021\032\bi7\264\375\220\206B:\374\256\3106\256\276\354Xl\303\037\355\201\266\317m"
+	.string	"\324\303\361\210?\306\265Dv<\302\301\266\022l9\366=\332\343\266\367\0212\204\301\233\222\"*\034sp>m^pyyhd\275\275\255\316\304\261\333\270~vL\302\301\266\034\333\367Y\333\005&\372Y\355o\205W\255\251 \266\312\216\273\360\364\237\332\217\n\200)TE\251\354\330\253N\277\250\375\243\002\204B}\256x\227\035\003xH\372\357\366\343}y\032\272\240\342\265\313\216\003\274!\375\232\366o\022\360\231z\370\240\342\375z9\375\227\366\327\rxKjN\350\022\312\216\005\300\321?i\177\221"
+	.string	"\035\352\211\212r\331\361\2005\372\037\355\207T\300\021\352\212\210w\262c\002oF\277\242\375\213\f$B]Q\361\276\311\216\013\204\321_h\277\241\003\204\326|\021\261Lvl"
+	.ascii	"N\177\240\375s[\200\326|Q\221Kv|\340\263\350\357\263_\016\301"
+	.ascii	"\307\2559#\342\235\222\035#x*\372\363\354\327\223\340\361\330"
+	.ascii	"pF\305\227\225\035'\370'\372\351\354\257\243`N\351\221|\343\372"
+	.ascii	"\244\262c\005\245\364\277\331\017g\201\233\323#\321e\307\013"
+	.ascii	"\224\350W\263\177\r\2034\246K\"2x#\372\313\3547\323\200\214\351"
+	.ascii	"\222\212\rh\351\007\263?\214\203/\246\323\225\215\353\203\311"
+	.ascii	"\216\035\274\322\317e?\334\203-\247\323\261\030\327_\222\035"
+	.ascii	"?X\245\037\313\376,\020\376\n\352\223\202\343\372D\262\0075>"
+	.ascii	"\004a\243!\203\307\017\035a;p\314\320\021V\303\307\217\260\017"
+	.ascii	"\r,\033\017\033>\302\200\260\261\371\b\003`\315t(D+}d0U+\373"
+	.ascii	"\262.\347~\\\220\017rD\236\310\035\371#\237\344E\257sL\316\311"
+	.ascii	";9(\017\345\246\374\224\263\362V\016\313cy\255\177\373#\217\344"
+	.ascii	"\227<\223\207\362Q\276\312[y\342k\371.\357\345\305\374\230?\363"
+	.ascii	"h\236\315\267\3718/\347\355\374\235\337\363|\336\317\377yA?\350"
+	.ascii	"\017="
+	.string	"\242g\364\215>\322KzJ_\3511\275\335s\372N\377\351A=\251/\365\251^\325\273\"\361\262~\326%r\213\334\365&\271M\256\223\033\345J\271V\356\225\253e\304\355\"\346v\007g\272[\364\205\333w\013\027\267<$\210\326\301\260\350K\334\027K\226!\211\036\236\354\330\177\212\276U\366\235B\305-\256\004\361\357E\242/\224\375yO\332L\020{a\262\343^+}\227\354\313\344^%nyL\024\367\214k\017.'\230\323\367\310\276Hz\327\310\332\211\036\225\354x\313?\351\257\265\357[\027-\267\270\023E\256\317\323\017k\177,\257\177\345\026\207\202(7\256\275\267\354xt\260Q\001\026M\313\236\335\262gA\030g\0324\033\255\232\360L+\3232\362\024\236\225_\266\254D{\3264S\262.\273\342W\376J\323l\264c\245PEK\337h\207\251\231PUS\223\313\272\b\002\177&\220\313\216\235\300\322\267e\325`"
+	.string	"\253\226\nM\324\004\232B/\033B\204X0-5U.\333eM\262R\005\236%YWz\226]\326\314'<]\250d\030\371\023C`_\234(i\002\313\316J2\r\215L\200\325\360\003\204X\212\f\244\251\226\251I\276\b\216\261\360\225\3001\0056\204\b\26125\321\322W\300\232\251e\352#SSHV\222'\220L\201E\323\322L\321\270\254\360l\030\364\221\246\360\004\002Ma\251\222\r\254\371\013\242\244\360D\373\262!D\210\215HMu\270e\203\347oX\222\277\023\315\313\2320\324\200eZ\242uYs\350S\315\224T\321\312"
+	.string	"\330\324<;\313TH\006S_\371B\230\206\300\002\203\251\360,\350#\315|g\303\0228\300\232\2773M\315\264 \211\246\242_\326\004\216\225\352\371#\325\337Y\211\242A\037\311\302w\n\325\005\326\024\016Q25\321Ls,\200\r\200\325\250A,B\020f\224\221HRP\220$I\007@\003\021M\323\034\020 $\331\234f3R\332\246\222y\212j\3676hH4Q8c\236K\030\1773:\327_IS5eZf\237\354\321\343>"
+	.ascii	"\0079\032-\304d$\246\337\306\006\034\030T\267\327+\031\376\""
+	.ascii	"u@\223&\200\261\020\270S\2254@\352\336\353\006\271\347\213\231"
+	.ascii	"E&O_\202t\253\021@L\272\325\023\327\371*-\316\356\244\333\261"
+	.ascii	" \362p\372\206\314\177\320r\004\2418\210t\313W#\001\340\001\016"
+	.ascii	"\356\206\0205\216\013\n\\o6\0350\337\302f@!E\351\231_\352\032"
+	.ascii	"\020dpa\2704\022\306\235\026\335\276!\203F\375j\320\r\004L\264"
+	.ascii	"\351\367~a9\267\260\031(\210\335\245\002\t\004\257\234\301\236"
+	.ascii	"\264u\003\336\265sd1(\315\352:@\322\347\016\006\216\034\324\214"
+	.ascii	"\361\321\231\315\001R\201\201\3314\320\332<\037\364\002\301*"
+	.ascii	"\342z\277\332X\030\357\301\0278r\240\373\177\337@\371\343\375"
+	.ascii	"?\007\260j\241x~\017\261\364P\217+\200\305}\034\001,\357\035"
+	.ascii	"\236Q\320\245\241*\334\226\313\352\374\326;\257\235\247\003Z"
+	.ascii	"\030\317c\007"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.52.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`0\002m\023"
+	.string	"\026e\202I\320\362&\035R\036\204\367f\235~\341\334\371\001}\200\335\342\317\037m:\n\322\241\222S\206\270\3229\303\316k\373H\375\373\336\262?\004\2677\004HNm<\300\356,\210\034\006\245%k2>\344\210\2402\232 \204\220\275\345N)n"
+	.string	"f"
+	.string	"p"
+	.string	"+\316\242\306\255\001\243\317\316g\273\2013\264\253uTy\274"
+	.string	"\357\024|"
+	.string	"\357tE\230\344s\274=\331\372\347\321\271\262\345\273\376\315\247\350\201BD\304\231\023r\242\321o/\351\235\3409\2550\303\021\023?|\316\b@\265\021\"\342\206\271B\270\031\307]\312D\230\334\337.uN\257\0349\221\347\3623\251\265Z\306\304\235\033\274m\3216\004[Z\b\016\301\217\377w\242\233Zz\336v\357\224\226+}"
+	.string	"\022\222vM\006\242j\365\020%\244&Q\031&N\364\333.\355\333\037\362qN\371D\255\327\033\235Pfcb"
+	.string	"^\310\2779e\033\001]:`nI\207\217ZG\005\247.\001Oo\327\330)\333R\332\017z\213\232\217\032\034\326\032\242\b\251\326q\201G\300\323\003\363\0014\277\0064[\272\341\312\\\340\366\023d.\315\337\312e\331\230`\022\312_\271\307\031b\f\327\271P\245\247Z\2550\007H\253\224\313ig\364\243\226w\372\245JO*\202\036\243\205\3401\3334\207\261\"\361\251\025\366\340\305s\031\346I\234:f\306{\354\324\237\361N\351\036\367icv\024\343\261\221Q\353\244\313i\332\245\331\243K&"
+	.string	"R\202\203\267\307\001,2(+-+/(*a\313W(\320\254R\250UJhV)\027`b\\T/-(.*\025V\214\252\204\200W0,,\225\314j\305R\245\\\277=\276\213\237,\361\300\035y/\372q\017k@\263\031\356\234k\023\233}u\370\226\346\0065(\270\364GZ\366\037\266\0350\t\365Yk\255\336\322>\342\355\202\373\333O@\314p7\263\227\214\222K#G\267\243\033( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\362\324J\216B\027\300\315\317.\267\254e8\026s\221\230\024\241\341\373\303\264\302;\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.53.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`%\002]\023"
+	.string	"\266\344\201I\320\322(\035\257!\322\"\322\037\220\223\223\263\231\247\351\343\311\317L\244\240c!L\177>+S-\025!\207\r\303\375Y\377\rPG\245\325\033\270\272\334\221/\342))\357\216"
+	.string	"\335C6_Q\366\220\030\026o\241\021B\310\226;\245m"
+	.string	"e"
+	.string	"p"
+	.string	",^\206\t(yn\304\234\217\006\310Wk\211r\371"
+	.string	"\341\301\361"
+	.ascii	"\302\203+\302%\247\345\035N\330\305\020\244;a~\354\"}\212\036"
+	.ascii	"(FH\032\032\201G\n]'\233\341\t\234\203\024t|\320H\020\247\024"
+	.ascii	"B\213\333\210\021\222\003\335\237]\321w\2375r6\367\272\317\236"
+	.ascii	"\222L\007\217\304\371\024Qj\255\2364\362\346\036o\233\264-\301"
+	.ascii	"\236*\001\017\037tSO\357s\367\244\3237M\250>\244\002C\265~\370"
+	.ascii	"\025\2519\300\031&\036\364\347>\355\333\007\362w>\371A\260\327"
+	.ascii	"\031\033S-G\344d|\351\353|:h\027\377y=G2\306lF\336Q\322\217Z"
+	.ascii	"\313\004\007\335`<h\200\336~\331'\333;m\006\016^\307m\360\326"
+	.ascii	"\232c\203\250\326R\201I\306\203_\3614jz>pm\376\315\007\267t\307"
+	.ascii	"\255\231\200\256g\b]\233\303\375\272r;f3\311\366\205\367V\240"
+	.ascii	"\321\322\255\326\331\tQ\353\024S\362\t}\b\266\240\321\222\n\334"
+	.ascii	"c\300\016\234f[\303a\264Jxj\235=xq\036\006z\022\007\375\022\023"
+	.ascii	"\236v\320\217\331\357No\350\340\240\341\310\314\337\n\351\325"
+	.ascii	" \355\332\35426\021\004)\321\301\273c\217\342q\017*\230\024K"
+	.ascii	"\013\013+\265bj9\213\n\fK\305J\255\\*\227\223WL2\264,TpyY\241"
+	.ascii	"X-\251\025j\305\365\2022\031\340\226\213\312\205\202i\265\\\250"
+	.ascii	"\223\353w\307\367y\312\321o7\024^\306\277\273\351\346\203\243"
+	.ascii	"\343\356\326\326(2+\363 \256\315\013j\200\342\202=\323\265\003"
+	.ascii	"\311\361\230\315\244\323Zk\r\177\222p\256\270\327=%\204N\321"
+	.ascii	"L\216l\376\346\006( 0\002\203\244\273m\\\341\035\3426\353\034"
+	.ascii	"\370\332BcI\255\356\006\324\002\210\360C\224\337c\270\215\215"
+	.ascii	"\272\215\264\306`\002\236p\301\240\210P\224\342#\"\253,\354n"
+	.ascii	"b\037\244%\344\366;\331n\333\026\372*\336\221\260\031h\to\320"
+	.ascii	"\004\233\310#\273\3604o\254\005\346j%\254#\246\254\341\334\253"
+	.ascii	"}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.55.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\220\004\365\030"
+	.string	"\006i\231K\240RR:\220=\343sDD9\337\366eg|\310\367\336t\235,z\f\214H\2726\307>\244]\372\371E\354\235\257{\251@\223~\365\364\334\006|Z\\-\016<\205^\366O\2227\266\300ez\272x9\356\336\332\377\t\331{'\031\206"
+	.string	"w"
+	.string	"\204"
+	.ascii	"\371wO\274\370\020\037H\217\267\323\345p\253\212\257-\366\017"
+	.ascii	"u\024\245\262c2\347!'\276\024 J\023\266\207K\232K\267\213"
+	.string	"!\225\330\304K\332s&d\t\313S\332\025\235\tIduEL\310!\233S\223V\340z\354z1$\t^\322\203UW\347r\307\321\317\362\030\247\350\240\301\303g\351\310K\032\355\305)\312\257 _\222\007\223\2041\325\016u\013\"\271c-\316A\316\271\3551\371\363\026y\367G\272\373\327\215\037\004\306\004\375\250\r\304\034\n\234\365\352\357\205\201\345\364\324\261\323n\350\216\275\316\356\337\351t:\355\333\354\376\363\337\035\372\353T\333+\266\255b\333\030\333\276\330\266\275\266?\262k\0133P\226\263\317\324G\226\252Y*\272\373\274\356\266P\234\264\003\267\335\177\272\213\342\237\035>\222s\263jF\316P\225.\220\273\332\320\223\254Ws\017\260^\355b7\333\241H\371SE=Sm9\007\275\266j\265\344\020?p\327)\343\367\332\347\026\360`H\027\256\025<\225Y\226\314\275\007K\"\212\n!\327\223\022\021\314\033\215\262\t\251"
+	.string	"l\037\013\003\313\257\202\273\333\355\362b\177\354\236\325\013)\317\315Y\340\224<\303\300\325^{\024\205f\264o\bn\005<\227Y\316YAw\314\253\202\227B\242z\f\231\326 \264?\n\327\253\366\236\353,\353KG\245\364^\247\311i\326_\230\2503\243}\353\356\341\245hr9\0077C\230kC\314p\033\270r3\204q\231!\n\177\034d^\204?`\r\361\267\"\240\207315?\233\341\260\346\307\203\352\034\347\333l\bnR\235\273\323\003,\2037\327\032A\202\265\352\201s\3169d\275-F=\3419(\254W\367\363\345\226\204\226f\344[K\273\032\213W\203\026\313\021 \252Y\205\227\221\251M@Af=\002,,\031\363\330\304\033\013\273\230I\227\nskl\207oX8\330\027\376@t\365\244CQ\002\212\342\030\312\331x\327k\004E\036f\250aX\304\bV\"A\224\024$I\n\035"
+	.string	"\003\221\241\242\003\0208\251f6\0059\007\237d\\\273\225\254)&\215\200\267U\320\005=Y\212\024X\021p\222\204\177(AE\007X\225@\312\016\237t\341\236\024\272\336\337\312)y2\370R\307{R\350\37261\276\342\323}\026\263\221\315\352\260`n\375]\2331\005=\362\273\002\277"
+	.string	"?,\375\300>\242\2069D5(\373)SbG\021\332$)^\321#\273\fu\025$,Q\303H\226\314\031L\220"
+	.ascii	"\326\037\322\377\335\213)Wg\315\203<\353#\356\274jt7S8v\317\277"
+	.ascii	"s\354\255],s\255\236<IX\375\250\001"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.56.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"5\t"
+	.string	"\326Q?80\345(\035\336\220\005!\316L0\321\200\357\266\254%\224\274\365\f\no\240\255@\373\030\203\0333\032O\306\234\372(\005\f6\005(\332bO9\022D\306\232\262\331M\244L),"
+	.string	"/"
+	.string	"0"
+	.string	"\230\277\354\003\230?sv\313\343\307\276\325\241Z.\273\013\325\343\334\223\363_\362\200\224\312\364\3140\354\2563\245Z\335z\333\007\266\241}M?\206\245S\323\317lV+\t\257\335\215\027\200u\275\224\020\333\337\330\316XzQx\332\0379\t\367\356\342\002\273,\025\224\335\3101B\366\347x\202)\033h\250\311\327T\016*\200)~\262e\273\031\013\276\211EE\006R\302\374]3+\026\221\356\224/;\232R;\354c\273\273V\226\375\356\177\217\001$\315\243\243\rB\375\351\2204\217Ch\003\301\t\211\007\020\374\2106\330)\260\026\212\020\301\221\246\211\340&\356\261U\226\0338\\'\305\260&S\237\332 -\037\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.57.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\353\005\025&"
+	.string	"zE(\017I\200\\U:\033k\317\202T\360\353`\232-\322]gi\326"
+	.string	"\016I7\354[\364\354\f.\004\356\340g\n\355\230\265\177"
+	.string	"}\013\323\367a\033\362\335\357&\b\027\221\"\312\254v\b\f\204\003&R\265\337\033\330\020!\204\220\275\223\f\333"
+	.string	"\321"
+	.string	"\342"
+	.string	"S\\|E\270\313G\371]J;\033\2263\322\223*\347\374\240\177\330\2474\364\267\373K\207\362;\023\214\357\344\234\364D\225\363\362A\327\330\247\275\374"
+	.string	"\365){\036\365\351\257\033\315\227C\362\233\244\204M^9g\033\026\362st\371^\273\305\277\313\332\030\214]\325t\206\342\373\353G}\201\021\253\241\221\350\262\036N\340m\203\034y<\266^@:\3568L\001\322Q\307Y\364L\320(\277U\314\201Z\2002Z\371\363\227h\224q\327$8\256\242\024\2404!\002\300h\204b)M\253g]\201\262\230\343\246,\216\317P\b[n@\371VQ\007\272\003\244\f\363\312\242\217\213\242\264\255\342\016\224\226sn\215\301\213\357|\232\304Z\203t\344\361\273^\3109\367\035\032\217o"
+	.string	"\357>\332\335\272\356\264E\007|b\267\r\300n\0278\326\233\300\257\336\003zx\316\364\357|\312/\200\275\035\340N\357\331\237\336\262K\371\333W\275W\365P\357\224\275\215\262\2671{\373\336\333G\320Vi\375\300\311\331\306\327\234\354%\305r\344W?\326_\365;\375O?\324\325\356\367\271\274Kw\333+\256\245\023\034\231A.\255\350n\263\034\253\237\325-\226\037\325\257\372\317O\375\244n\325-t-}\321\\U\351;\273\255\362}P\242Z\362\302Q\365\261t\333B\277\302\342\331\250\b#2\273\324\210\270T\177\252[\241[\251\321\202\313l\004\201\\.y\205\020\352n\237\3367O\345Q\335BMux\252\321\202\002r0y\205DC\267S\215%*\262\315\246\247\232\234\227\016\236\266\205n\034qT\234l\003x\305=fW\001l"
+	.string	"_X\247E\334\314\210T\353M\223\234\203\022\312\220h\211\334xu\235\314\255X\250O\013\340T\353\215\023\246\"\253s\261`\360\341\207\213!\3613$\347\340\0040\017S\002}\221\247}\303\251\037\342\324\247\004\360\263\316@\313\r\223\013\352\250\350~a7Wj\254Iq\262\377\006m\214\314\230\341\244\255\243\370H\030_\214b\364\2140\307\f\253\030\343\224\216\260\211\f\253\370b %.!\023\360~\2758\244\241Dyj"
+	.string	"|\347o\217\2434L2\301+\247gw\305\375.'v\367\303"
+	.string	"\370]~!\210\211\356\217\033\3070\270i\257\2512<\303\017\242\214\220\3072\3747\302:E\367\253io\247\332\342\343\030JM#%\360~u/\201\027'\273\25761\221j\234\324\235\336\016\271\335\325\005\335r\273\234\212\033\016\266\373Pn\303\020\317\204\032\324\273\005y\200\345TdX\207x\030t/v(n\273\236\316'\323\235\270\001\241A\276\034n\034\204!\236\211\022@\276\0246\025\273[\n\033\256\347\263A\360i\036\220\256g\013\342\361z\266vYt\234\324QN/E\0308%\303\311\236\221\211\365`#\267\211\215\306R\374\250\263^\317:\367i\256V8*\363 \317\247%-N\026\311\252\003\343\301\215b\025\247\230\350SW\334\203\277E\311\352r\305\316\\\305<\f\224i\230\\NH%0\234\324\360\345Lsj\375\230?\353\034\230]\302\251\224"
+	.string	">\200\211\335=\367"
+	.string	"\336\301-"
+	.string	"\367\235\207\r\311\242\212\243F\006&\242\301\342dG\300R}p\372d\326\304\263As\316y\305\311\327\324\001\330\007\377y\r;\220M#$\360Y\343Js\250q4\206\fR\314\004\025\310\214\b)L3\006`\002\221rfu\020P\310\206\222t\223\3042\244\337.\227\273\017S\335\354\200V\n\021\006\024\244CJ0gG$\250\320\001\220\267\226\202\213\365\236G\312#_\252\233\331\275\323\261R\023D\264l\245\320h\003\271\241\300f\337\270\354\343Z$\260\030\fB2\3120\253\017b(\017U\323\243\344%\030$\267\023Cw\007q\244\031 \031\nD\004\254Z\357\203g\210"
+	.string	"\013\376JB\306_\221%\345ejI9P+}I\3011\363\006\231,7\261\342N\0068o\"\250}5\205!\334h\200\346M\245\344\230\"}"
+	.string	"D\022\017=\270!L\323'saT\230\001"
+	.ascii	"\365U|&\307\n\216\204\"\3020\227\n\202Bs\364m\323dU\007\360\002"
+	.ascii	"\200z\"VT\236\217\201\2346\226!\376J\006L\236\337[\030o\260\230"
+	.ascii	"\036\376\003"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.58.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\276\026]]"
+	.string	"\252\225T!M0\016\323\031\016\202\276\203N@[\253\232i\255\237\225g\246h\247\236'1\f\355\223\343\257\360\3202O#?\213\261U \350`\264\317>\225\371:o\356/u\244\302\250\"\n\201\017m\343\350\177w\254\365\376\377\377]\323D\020\264\367\2262\311\022\002\317\001\007\002g\337\355p[\374\333\261\250_~\340$\266\\\317\"P\013L\262X\336(=*<Qz\364\352\204\3726\020\234\300\226k\331\325\032][\340\272.\247\216.\224\360\250\272+\347\313&\353\265\300!\323\022\270\256\253U3\271\242\242\372\260(\316\363\214\332\376\271\374\nS\365"
+	.string	"\2408a\242\304\025\211\021)\254\252DPMIEA\205"
+	.string	"\361\364\301C\007\025\034\2346hh\312\300\264\244\224\204tdTD\204aH(\b\350\307X$\016\205>)z6\253\373\021\332\204\365y1\003;"
+	.string	"-\334\3411\n9?\021\347&N\023p\314\204\024{\310i\363;8\\\342\215\236\033\276\372;\t?\2767<\342\357)\316*6>\334\256\227\214s\016%y\023w)\311@\266\272;Z\302\333\034$gr^uw\021wvL\305\346Sl\326\260\324i\324K\2529K\314\261\300Qi\016Ew\027N\364\314Ar\206\346!\244$\347\226A\234Dh`\332\234\252\315\024!\247\223\343\247\363T\344H\271^2\314I\200\0273\271\223\361\302\037\226\234\201\271\207s"
+	.string	"\2675'\327K~9;\013\22737\023\206;\034\007\230\2538\237H\350\202<\3359\350%\321\234KxU"
+	.string	"/%)\310\034|X\314]J\016M\233 \222\2634w\352\362\r]\260\260\206\2677\275\271q\206\2663\265]\341%+W\262\302\306IkGZ\213\302Gj7R+:\245\322\330\370\270^\022\312i\224\227\004\316\211\316\022c\201D\256\227,\3414\342!\3433\2011<\371\320\023',\324\344AM\2140P\332\177\322\212\260\221\003\2223\"/J\321K\016a\342\365\222D8HI\n\341\341)\244\227D;G\214\261\320\207\305\222\263 \367\001\362\024\310\214\354tZ\327\365[\316H\263\034\214r\220\237>\336\247TS\314\235\242\231\330iT\246v<\334\231\207Y\030\263\017\213u]\227\217fg\337"
+	.string	"\276{\362\330]\257]\f*\004\b\244g\323\3305\340\201\b\b@\344\204\264\266u\025C\361.\273\035\334\205\004xC\222\2768\265\266u]S"
+	.ascii	"\376\216\002{(G\327\005\003\374c\003\335\344\367\246\324\335"
+	.ascii	"\001\254\365\221\355\301\301\203C7I\024\320V.\363\377\376-_\240"
+	.ascii	"\017\371\367\264\221\314o>er$\233\3537\317\215\334\237D\\\324"
+	.ascii	"\024\204\034d\216\375\370CI/\b\351;+\356O\214\361,\0223\004\351"
+	.ascii	"\256\004\024\360\217\357\037\244\036\246X\206<D\274\207J\221"
+	.ascii	"*\260\340\007)\310\034k\260\025b\341wM:\365g9\034\026P\223\343"
+	.ascii	"\256\026\027\377\270Ex\253`3G\203\355.\303\270\225\273o$j\332"
+	.ascii	"l+\331Ey\277\274\212\2742\210\27414\370\3367\203.#/\f#\357\013"
+	.ascii	"\256\227\371n\021y\265n\367\315\372\230\357\003(/\213\347}W\334"
+	.ascii	"\356\313t\271\357\222R\022\322y\217\212\274F\347-\"\362\022\021"
+	.ascii	"y\207\210\274B\347\r:/\320y\177\316k,\022y\211\347\035\236Wx"
+	.ascii	"^\237k\371\246\347E\207\274\247\220\267\337\366\345\363~F\325"
+	.ascii	"\tiD\224q\272o\271\226\r\276\2602\321\272(\317\373\367\3761\177"
+	.ascii	"\231\337\356\227\373\265\374m\377\362\303\335\357\331|o\317\267"
+	.ascii	"\306O\315\363\366ziT4g\3268\336\242c|wv\033D\260\246\351\200"
+	.ascii	"P\315~M\r\277&\232}\232\032i\313\032\273E\271\227\331\233\331"
+	.ascii	"b\030\365\313\307\354\311xQ\317\302\353vo\\\314\016\305\356\024"
+	.ascii	"\351vn\313\f \207\246m\352\313>\314\215\203\341\340k\216\344"
+	.ascii	"\020\031\227\247\331Bx\026\366^n\030\241\333\033\353\301\271"
+	.ascii	"l\217\331\262\266\256kq\367Y\366[\266x4\356+\250\327\002e6\301"
+	.ascii	"\032\232\003\204G\235\002VT\374\357\\\215\204J\271\372t\342\376"
+	.ascii	"\226K\036A \037Z\211\347\\\375@\237\314[\b1r&GZX\226\245X\231"
+	.ascii	"\207V\256V\0175\215\327\255Z\204\001\325)h\336\2365;\252\221"
+	.ascii	"\"\230\236@:\\G=r\276\216\203\364\250V\243y{^\307M\016\236~\f"
+	.ascii	"!\005nA5B\025\207\345\250G\316$\2522U\246G\267\372f\376\224\247"
+	.ascii	"'\256\317\313\217\335\022e\r\256\303\321+\200d*Z\311~ph\027\340"
+	.ascii	"?u\212\210&\353*\226bWe\302~\252\023\rn\320\345>v\243\226`\202"
+	.ascii	"\032%"
+	.string	"Jzt\250?\367)%w\330\352p\360 \207\rnKE\224\206$\365p\30208\244G\350,\317\222\301\373\262\241\225\313G.D7'\324(\337\035\233\206 \274\246 aP\033\353\354\200\316\3160\3072\374\210a\002:\201\332X\207\205\271DdS\372\371i\256\036'\b6\305\222\214\316\220\214N\3066\316\r2\305\216\362L\325a\"\3311\2110\320\263\024lJU)Ra\216\035\241eF\330,\215\207Q\022\220\ngC\305G\021P\277q\230<C\210Z\271\302\253SRbg\305\371\2111\036\0248M\235\"\\&\302ET*j\025\225\215\177T\331\322\243\304\356>\2647\034<\270D\234\226\2411\30704\035*-3\033\032v\326\260\215r\200B/\254\t\022\n\205m\224K\0034\024sb\341C\245n\307s\036W~|:0_uKwU,\005\360\217>m\224cc\2125\330\032\205MA<\246\210"
+	.string	"\343Vl\345\242\315K\276\242\350\020\022\304\032\354\304S\230\324\305F6_\354\303}\b\256\rX\235\275a\324\023\037\rz\317\264\225\032\271>H\275\347\311\235\324\310\001\210D\371\377s|\363C\330\312\375\226\023S\230s\227\376 \244{\242I\215\324\310\335\037*Uj\r\372>\326\360r\244\205\361 \373\264\362\264\243#H\332J\002\213A\325V\327\f+\033\030\300\350\212\361\"iK\201\016\276\262P.\033X[][^XZ\303\256cyq\365\026W\214,,/\004jxua%@\343\313\006\026\r\256\030\\ZZXH\253U\325\301W\326\0053j\310\260\362\352\302\222a\245E\243\206U\225\322~\315\340\242ae\343\353\213\206Uq\211\343\255d)@c\342\350\260\375\340\\W$+\276\374\233Y\226\337>\322H>\330CYu\007\026c\245G\237\250AIs\013\202\203\007\373"
+	.string	"h\345\006\3419\221\325\350\223\252e\265\367\200\302\207\206\242\225\273A\312\324Y\035\004\210\027\326\267e\312\211\fn\220\277\273\020\220-)\330\034k\260t\257N\026\023\314\267\330\213\303e\356\212\357.\342\374\310\346Fd\320__C\177t\300\352\354\371\355(A\302\253Q+)\376\367\025w\276\342\\\327u\275Z\321^}\275\267\020\222\306\245\323\210 &\220\204\214f\212\3212\372d{V\035\322B"
+	.string	"\321\354t\020f\214F\363"
+	.ascii	"\231\375\203\271\253\256=B\373\310\240\317\367\247<;mG\214\b"
+	.ascii	"\315\021 \352\250\351H\321J\216T0S\037\357pXB\265L5\343\037\217"
+	.ascii	"\372w?\0173\311\343\016)VQ\200UP?\354D@\220\032u\226\332\243"
+	.ascii	"w@\320d\255C\035a\201\250h\214\226\0365j\224\212\031\301\020"
+	.ascii	"?\3060\307\250\236\016\225\376`\233*\n{\321E0SE\252\225\353\243"
+	.ascii	"\006\252\253"
+	.ascii	"\373\317i\352K\215\3342\351R\377M\310\004-/D\265r\251\273\372"
+	.ascii	"s?\361\310\001\201z\321\027s8\254\020M=\004\205M\326\344\272"
+	.ascii	"\256QDM&\030\3539rfG\210V.\214\024\306pI\234]\320\340\340 \363"
+	.ascii	"0\322\027\r\243\323\264\260~\321\313C8\220N\b{T#\302u]\211\370"
+	.ascii	"\n\223\2664\267\267\366\013\204\002\242\356-\366\006\271\314"
+	.ascii	"}\3409\277\231\273\210\313C6\327a\253Y4r\316Y\364\351"
+	.string	"\216!\313\025\270:{:\236Z\271$\324xx\240\321\201\276\250a@\006\221B4\"\"\"\222$I:\201\005\204\030\007\231\263z\021\300$\006!C$#\222\202$\311\001\266,\250\337\353b\261$\330\303\036\275\264\0062\024\032\273cj\245\220\300\213h\2078\001\364\272\245\375\322\236DS\232EX\253\345Q4j\305\210i\303\326\"@\027\354\370M\244\206\2708|\335\361\036,\377_pa\367V\216\234!\225\034\004h!^\271\337\233\201\204&r8\317<<\f\370-~o(\027\320\"\177F\341\b\020/\377\274\n\022\264\332o\312&\"\023\247\354/\232\322\216\034)\003D\364\260\357\2401\016\320\273rL\377U\r\361\2067^\206\370\320\017*\377\370V\263\320\2607\217BzN\317\316|\314J\313G\236\340\032\203\251\243A\271\321yD\006(\232\224\013\211\332\026\341\256\004\354\372p\200\246\013i\230G\005\310,\366\330"
+	.string	"\223\017\001&\"\245o\352\026/\005F\230\365\360R\350\306p\235y&o\363\007\316\030\2472\201V\006\313E\311\026\276\354\354\201\207 \241\245\202\332= \177\307[M\026\373\007\341!\202\003\002\3764\325\314\"\343\n\273\343\247\353\365\023o&!\036*N\2369\275\367\323\353/\357\267\336\377\217\017\001\364\016\177\251\276lo\362\375\255\321\353\033(\246\236;\271\030tS\241\2526\232\353s\313\274P\177#\036+\203\231xh&c\205X!h\346IX\350\254ao\377\361\377I\306B\220I\217\377R\341SD\265\207\232\324\316\245Z\210\363)_W\""
+	.string	"\347;\033\030q\262\277hE\351A_9\37294<\177\274-\212\023\225AG\305"
+	.string	"z\363\377\242\316=\340\221)\314^\225\300\214\251H\f\272bu`x\202\350\343\362\237\277\r\337dF\241\205\262\210\226@\"\022:\356\275 \303\031\207\303"
+	.ascii	"vS6\006\034\251\026l\366\004{\021\201\331\003d\315\245\206\321"
+	.ascii	"\362\226\216\034,0\016\036V\003;\353\273-\226\224ob\020\375\265"
+	.ascii	"\276\0371\262"
+	.string	"\272R\346l'nE /02\037@z\310a\252\253\311\315]>\346\005\322\314X\276<\367\335\274b\331@\235\016D\364\207\341\013]\320\017E)Jc\301\345m\314\263\bp\026\b\376\313T\215Q\262E\034x=\ffG\242\212v\fh|=\307\325/\366\210\031<\013B\030\344\032\tc\303\220E\243{O\264*\211qc\354\203\273\232\356\320\261\241\026\361D\370\226K\325\365\340\206\370\370\n\n\257\311\206a_bla\225r\001\265[\f\206\337\002\001\363\035\246\315\374\330\324\021\331\037\022\005#\031c\001\203\2729\001\373fb8\017\321\217}>z\"\326\201ggC\027\211\002x\331\356\200\351#UX\325\207\007\005VL\244\212\377b\f\254\200\345l\326\024\363\211r\352\225\245\330\nZ\023(\215\020U\352\240\363\315\310&\234\224\305S\033\240\2246\274h\217\251\271SR\310\326j.\323W\300I#\016-\357|]"
+	.ascii	"\205\260\2544\006\035\255\3402[\005\263\005\r\020\205*\200\346"
+	.ascii	"\374\222\312\307\264\001\032\264\006T\030s\003\250~\320\224\317"
+	.ascii	"bo\026\346u\311\215W3\303\222\205\230\016\264w\2508\240=eL\324"
+	.text
+	.section	.gnu.lto_getBoxIdState.59.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`;\002U\024"
+	.string	"\226'\214I\260RN:\243w\345\331\243X?H\344#\274\377\311\213\326U\300A\217r<(\026\327)\20755\252j\266k]\232\372\366\217\031|D\252\267\237=\250W\036\007\353\267&\237>.\367\345\300\216\177\356\252\0326B\366\336R\312\024z"
+	.string	"k"
+	.string	"{"
+	.string	"\313b\231l\333\264sX\255EK0j\355-x\202p\247\201-\241;\345\216\320\235\377\317\240\201\355<\333+\001\264&\242t-z\324\332\2435\211\345Y\220N\331\314\363\355Y\260B\325\r\272AUQS\226"
+	.string	"%\355d<\037i\262%\305#\306\363\300\262\003\325\270\343\tmK\023\"\033 d\274\234,\2712\312\332\337\362\017\017\307\f\246\324Z\317;^\320>\334\377\034\376S\370y&X9\366\272\016G@\260\276\335\337\036P\221\325\365\341\306\343\337\353\341F\372\267\307q\034\337G\277\344\213\234?;?\344|\3316\355\202\234\037R>H\371\224\362\247\344K\312\357\311g\311\337\221"
+	.string	"5\256.<\325\n4\376\250VsJi}\273\277\355\373{\354\333['\333\372t\302\212\002\266\323Ac\253\326z\262\363(\341\316\367B\346?\035\322\253\213A\273\033l\t\245\033\232\255`iK.\237\0378\036/{f\330\337KXk\316\201\354\007XS\334\335\253\373\272\275X(\230ZL\f\335\311\r\013\261\003G\212\333\212\t\026P2\372Q\345\330\213\245\270\256DH\221\236\365\376\026\246\373\332%@\267E\372\254\033\302\355\323\272\220\371\236\270X\303\273\333\371\255\241;\267A\031Z]C\233\264#\262\352F\372\016\005i\001I>~\0011"
+	.ascii	"!\345\375C\232\025\225\027\027Q\005G\003Lm\203\004\321\202\313"
+	.ascii	"\204\034\221\205\304\245\226#\262\314\267\240\344\210,\030hn"
+	.ascii	"dh3\265\025\031Z\213\315\r\re\300E\232\027\033\032\216(\332\320"
+	.ascii	"b\275\272\262\366\321w\004S\023\2255#1\021\315\020\256\245\257"
+	.ascii	"\236u\330?\377\303~\312\255q\327\221\265\026A\330\362\361(k\255"
+	.ascii	"\025\2341H\377+-\274;Y\223\b\315\260\312u\317\265\234\252r\320"
+	.ascii	"\223\005\003% \220\002\021\272\353\006\217\030\256\037\017\244"
+	.ascii	"\f\240\201\034F\332\362[q\024\206+(\372d\321\340\332\241\003"
+	.ascii	"\022\253Z\027_\310\001\233\217FK&\327\242\002%]\207b?\254\326"
+	.ascii	"Y\221\263\013\031\277\371c\346-\240\020\371W\032'1\037\313A\237"
+	.ascii	"\013M\f4)\\\001\215\260\366"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.60.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\251\002\215\025"
+	.string	"\346f\213J\300\020)\035\333cVc\344T\2226\3349\336/"
+	.string	"J\252e\004\244s0\203\321g\227\017\213\003TLI\253[)\226\246\375\275R\252\\\205\022\307\214m\212\302\262\201O\314\373\215U\375\240\020\224Y\267\330\022Df\244\021\262\345N)x"
+	.string	"o"
+	.string	"v"
+	.ascii	"&rv\213\372\353\320\373\007-\036\247\034\347"
+	.string	"y\316F.B~\254\007!?\356\221K\232\373\253t\221c]\232\363\203\257#d\bw\275\233\277\352C\320P:\f \f\025ATo\352\302S^OGK\243\240\241\273<zB'/|\334\321\241\265\016\300\032\342\200\365x\252\310O\322\316\354\345\320\275\360#RO\r\242\240\241S\327\311y\236\246\273^\320\355q\333F\266\027\330\024)\336\"[V\251?b\260\221\332\374\357\177\375\351\256{\340M+\365A\004(Y\251P\235\347Oq\307I\034Y\200\370\323\017\364\235\016e\233\2669\n\257\213&\363M\276\360\251&J\252G\201\215m~\274\235\363\2036} Iy\003T\nS\024\261\316\363W\362\321\007\312\217\324\376\2113\345\376\243p\331y\026\251Xq\236\277\002&)?\372W\276\304\003\273K\227WC\326\215\355\267\256\2044\313\365\223\220\273\260up\025cg\203\216\026\311\030\335my\241\3379\244J\210\250c"
+	.string	"(\202h\\\237\324\277'2\3147\244\312\002\361\276\fVTu\002\371\261\032\226\216\2023r\250\016\233\264\256\017\005\201F\277\373\330C\375$go\f+\330\330\365\225\367\013\262\344\257\265%\334\350w\246TZ\304\235\275\261\177:\272>\373fR\226O.)\270\032\313\210sI\301\325\022\330n\264\327\rfE\006\345\305\245\326\200\346\001L\214\f\212\355F\003\340\026\023\\\215E\305v\243\315\"\304\254\320f-3\267\231I"
+	.ascii	"\327l/33\232Zmff\376p\276Ev-we\346\216\340\254\316\2625\227g"
+	.ascii	"\013\207\026\201^\353sL\207+\266\036\206>\324<W\027\335\007_"
+	.ascii	"j1mQ\363\b0X\342\360z\236\347Y\256\317\027\376Eb8E\302\32658"
+	.ascii	" `\002\221Y\311\r\177\214\324h\362\353Rm~U:\215\345#CK\223\226"
+	.ascii	"\372\341$\243\335\2716Q\345\276\037\203\020=~\031-j\206\027p"
+	.ascii	"\205\266&\231\226\177s\346\216\013\327\360CI\325\373\300\312"
+	.ascii	"\032\001v\353\332'\007J6\247*5\212w!\030\216:\214\314\217\003"
+	.ascii	"'&\\\246\0136d\230a\244\213z\027\207jA\303\271Kt\340;\353a\270"
+	.ascii	"\264\306\017at\367j\202e \337\025\311Lmx\002"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.77.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\205\n"
+	.string	"&\325H>0\247*\035\220\313\302\300\300\240\260~{\267KL\275\270;\203\376\305\337\333K1\\\355\243r\310\336\377q\222\0361Jh\241\234\372\210\240\252\210\201s\023\302\271\026\272A\305\360\242\265\275\245L)8"
+	.string	"5"
+	.string	"5"
+	.string	"\232\rie\333\232M\311\246{0\025%\325\201\310\036\354z\332\243\006\270\351\232\320\344g\307:]\377\035\026\0200\353X\"O\205C\ngw]\031\271\343mO\330\306\330\327\002\004l\337\376G\262/v\311\276<\332\326\274Gzl\004\275e\255\254i\377\300\021\224\036\033\331\262\013\200A\203]\017\363h\211\312\343\303\031&\217\360\013\223G\373\006\034\213z\347\313\256`\363\007<z\203\313w\217>\327\341\221\357R\377=[)=\245\276\254\360pw\327\352\262\235V\247\363\336\377I\004IB\311\256*\002\204mE\007\001\027\024\242\255\023\355\311\210\266N\005\210\373h\032\031\026\037\315\023\342\264L\2037\020FH\343\330\266\220v9\\u\371\337!\026d\252j\210\232\203\322\017\253\352\313\266%\257O\360\031\347"
+	.string	"\333\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375`\225\003\255\021"
+	.string	"\246ZfG\360\262\250\003\344P\312\367\026\rL\374\232\037\375W\355\027\363\330s\367\226\\Q\312\251\326E\001\227\024P\332\\\020\337\223\241NI\317\3003\320\332\032\020K\377\363\312D\314\203\333p\033\343\366\367QM'+$\2256\311\224\002U"
+	.string	"S"
+	.string	"O"
+	.ascii	"\fc\301\267@\005\374\202\305.\022p\213\210\200Y\320\320\3709"
+	.ascii	"\360,0\204Sb\307\300\273`\201_\201\036\004\257\325j5\002\257"
+	.ascii	"\002K\036e\200\t\374&\212\022Z\315\205\325\237@gn:Q\255\310\314"
+	.ascii	"\001\346\367M\033"
+	.string	"\346g\216!\323\2409\347\024\360\274\003\231\031$\013\rG\350\3301\303E\337j\273\234\370\300\201\213.\252\315\n\301\343\303E\017\325n\315\330\017.z\327v\331\310rp\321W(\366\226g\035\226\347\033\327\363\212\225g\253\362<Ky\306Ay\007'\377\240\347\234\314$\255g\025M\252\241\305L\336\0056\340\034\006\0017US\324\263^\365\350\265\265\243 \267\241\314C\314\242\252\351\232\254\211\226\256\255%J\262\236tRm\226N\212N\372vE\244\267\355\216\331P;\351ME\244\277H\350\244\257F\244o3`#P\177\rg4d\300\301#\177\0219\211\202D\337n\334\266Sf&h\272\223\367\327-\242\303\215\236\322\311#\264\373\220\201\241\007\237|5rr\221m\346qS\343'Ur\013\266C>\264Y\210\364\327\355\226\211\201\221@I\177\275*\214\205\251\025.\205\333\r\242\007vm\235@\257%\251\315<6r"
+	.string	"\250\256\312\252hR\250a0\323Y\023h\312h\2551\320\002\251)\323\006\021\260$\243L\025J\030-((\350\f\233|wM\372\225\207Vb\327\025@\363S\262\334K\3355\327\023\326\311D\031\343\004\371\034\301\035V\322M\357\274\202\026}\207\365SC;Y\227\21208\353\233\301\372)\307\330\322fF&\336\031\007\240\321P\r\344hQ\224\362oNN\265C\320>\277\357\001\335\240f\2605\024\033\321\373\352\254\204\020\214\267\246E\033%4Tt2\2715\310\346\021E"
+	.ascii	"\307&\215\321\304X\030\245\036U"
+	.text
+	.section	.gnu.lto_.refs.e0cb6397f76f09bd,"e",@progbits
+	.string	"(\265/\375 \206\375\002"
+	.string	"b\207\024\035\260'\255\001\224#Pi\003\303\260@\222$\205$+\327\2324i{\023B$!R\356\024'\202\255\031\250\033\347\314X(\230'\354\b\253\017\200\013iB\032\241\013\232ld\245\324\301\325\346f\256\246{\271\232\334\310U\273\210r\324\262\217U\325s\352\271!\003"
+	.ascii	" \204\221\031\214\022E\f"
+	.text
+	.section	.gnu.lto_.decls.e0cb6397f76f09bd,"e",@progbits
+	.ascii	"(\265/\375`\303D\275\033\001J\344eiW LQ:\215\001t\032B\031\275"
+	.ascii	"\251\257\001"
+	.string	"c8\247>I\024N\223O\002\274%\221P\203\214\316)\211\334\306w\351\372\022`\354\227g\263\334M$\360\372Og\335\022 \030~_\237\257\036\310\373\373\364L\255\256\357o\324\323=~vb\210\270\024efVi\367\226R\312\024\267\005\250\006\275\006\371=\037:\307h\205L\353\302\006\231\357a\351\367\246\364}\330\350\373\214\321\367I\323\377\005\363K\367_\266\333v\223\326\270\367\223\013.V\250\334lf\b\277\211\242\022v\363}\320\364\377K\346\216\271e\256\234-\273s\027\3567\356\236\370\345\340\315\322a\344\021\007\212\226\331\215\372\211~\347\356\013\267\bF\236i\024M\246$\367F\336\232\tc\351\234\300H9\356\215\024\301\301\235\273b,\235m\273\332Lt\033\034\301q&\211A\311uU\007F'\337\307K\233A\364}\200\350\373\370\320\367\341\322\327\215\350\027L\316\221fJ\310\315\331\006\231\367\321\241m\322\n\231"
+	.ascii	"\260A\346}^\350\367\270\321\357\241\323\357q\323\357A\323\357"
+	.ascii	"a\242\337\003D\277\307\205~\317\223>O\031}\2364}\236'\372<F\364"
+	.ascii	"yv\350\363\274\320\337i\243\277C\247\277\363\246\277s\246\277"
+	.ascii	"\003\246\277\363C\177\007\207\376\316\n}\0357\372:s\372:i\372"
+	.ascii	":e\372:_\372::\364ud\350\353l\375\2348\375\034-\3729`\3729>\364"
+	.ascii	"sd\350\3470\351\3539}\275\246\257\311\364\317l\220y\205\334!"
+	.ascii	"\266\354\202K\344w\2075\363\262\t\271\221{#{\327\207\233\262"
+	.ascii	"&7_/\321\267\027\2308/\317^`^s\351\353\030\3728l\364q\334\364"
+	.ascii	"q\316\364qZ\320\307\301\322\307I\241o\332\351\377n\345\260e,"
+	.ascii	"\235\032D\306\223\233\357\016\242\337-|\246\345D\233\233\257"
+	.ascii	"\031\215m\220y3\214\276\251E\337l\242\337f\203\314[\343\332\260"
+	.ascii	"eC\027\253g\335\234\244j\334|\023L\263\260\355\220\371<;d\336"
+	.ascii	"\314\241o\252\320\377\275\372\225\361_\030\227\351\211\247\307"
+	.ascii	"\213\026l7\333$D\277W=0U\354\272n~\231\247s\346\364\3135\375"
+	.ascii	"\222\212~\251D\277\344\241\237\264A\346\313*\375\214\247\237"
+	.ascii	"]\320\317P\364s\021m\301\f\375!\237\320\032\244\321\035\264\351"
+	.ascii	"c3}\262.\3753+\3754\274\365\333\346\364\343\272\350'\235h\273"
+	.ascii	"m\220\371;+d\376r\351\337\252\335\363\346\310\033\274\233o\347"
+	.ascii	"\364\217\0252-\225\r2\207\254\220\371[2c6\356h\303\313\030\271"
+	.ascii	"\235\261\273\246\256\233\377\3338+\306\276`\341l\231\225\263"
+	.ascii	"`n\303\330\267[\344\336Oa.\274Aq\351\362\026ut\263k>L?\373\t"
+	.ascii	"L\336q\357\315&g\333\354\232\017\023r\2670\235\244\220J\273\333"
+	.ascii	"{\017a\200\001\006\030\360`E\221U\351\344\274\255\220yd\230\276"
+	.ascii	"\005\242om\350[\026\332\002\033d\376\366\313\355\332o\303\254"
+	.ascii	"\232\025\033\301\336R\366\336\033rn\270\240\341v\263\365Bt\373"
+	.ascii	"%\310\244\272Bn\262\275w\317|\263F\005\331\315=\033d\376\004"
+	.string	"\332n+dj`\203\314\3332\233&f\001/\032c\266T\200\204\301\"\307\315\277\325\222\305g\214L\022(7cA>\355\275\207z\324\334\270\270\272\371+\350\377\026\315\236Y+\266\314^\261Rn\247X*\037B\356\375\264\367\376\002~\"'\326\314\007\357\215\205\344\270\367\330\027\360\333\260_\004\007\366\212\255b\315l\333\225\007Z\300\222{\217\335\202\375DW\254\022;\206\221-\354\235\203\313\307\205\265'W\356\366F\016a\200\001\006=m2\222\320\320\371\026\320\026i\205\314!\033d~\002\332>\261PlY\0056\n\262\30735\345\303x\363\033\240o\311\276Alsp!}[\201i\363l\005\346{\372\267c\277Mb\301l\023\f\265\302\270\311\366F\002\365\222\270\330\361\003\t\266\367\356\345\240\341\025yq\263EZ&\267bv\311Epp\314$\266\301\366\336Vl\003\343\336MV\254\327f\357\246\236\265\002\260V"
+	.string	"\031\211V\220(f\276\216\376\325?6\310<\322\n\231\332\006\231\031\320@\t%t\376\254\346\307\205{\n%h\340?\1779\374/\t\234"
+	.string	"\273\001\016\341\177\022\205\003`\020~\034\350/?\360\337\023\222\340\017\376{\301\177\213\230\002g6\356\307\023\370o\t\260\004~\2736\304\021\370\357\331o\351\260\007\277E\376\030\002\377\315\372\257\026~\300\315\362\337 v\300\177\243\340\016\376\013\367_\r\340\006\374x\203\037\340\177\nx\001\377\315"
+	.string	"V\031\201\377\252\360\037\355\222\300\t\260\\\376[\342\277%\260\360\024.\364\227\r8K\341E\006\377E\342\f\376W\201\373\377\366?\356\277N~\214\001F\300\177\261\377bB\360&\377\231\374\367pA\360\016\177y\301\377\263\247\260\242\344\020\005\005\376\360\377\202\377\036.\013;\177\316\373/\212\037_\360\343\003\374\330"
+	.ascii	"?.\300\217\t\360\343\001\374\330\202\037\007\340\307\035~L\301"
+	.ascii	"\2175\374X\350\307A?\306\360c\237\037\367\374x\347\307:?\326"
+	.ascii	"\277\035\3721\316\217\315\037\343\037\337\377\272\371o\233\377"
+	.ascii	"\256\371\357\335\177\317\374\267\356\377\331\377*\377\321\314"
+	.ascii	"\374w\356\277\001\376\022\350\277r\377\215\373\257\226\377\242"
+	.ascii	"\375w\312\177\315\376\373\344\277L\376\013\366_#\377=\376\267"
+	.ascii	"\353\277?\376\333\343\277<\376\273\343\2779\376\213\365_\032"
+	.ascii	"\377}\361\337\026\377]\361_\250\377\262\360_\023\3747\003\377"
+	.ascii	"-\376\267\004\377\035\376\026\355\277!\370\217\345\277\301\337"
+	.ascii	"\322\375\027\370\337\363\277#\370\257\b\376\013\202\377\311\377"
+	.ascii	"j\340\277'\374\267\204\377)\374\367\360_\022\376G\371\357\005"
+	.ascii	"\376;\302\177E\370\357\004~;\346\267r\277\r\363[+\377\307\374"
+	.ascii	"\227\373\277\345\277\226\377Y\376{\360\277\313\377\235\274\274"
+	.ascii	"\274\274?#\177\237\027\277\b\021\004\373\270\343\262\250\364"
+	.ascii	"\030\023\223\275b\357m\317\350cU\213\272\233\317\364\264\314"
+	.ascii	"\260\013s\363\207~\350L\007G&&u\363\207h\350l\306\3069\0213v"
+	.ascii	"\363\207X 3\\\031\221\312e2\231+j3\334n\316c\354\226)nU7\177"
+	.ascii	"\303\033\375\347\027lY\226\373\034\317\366\240\323\003\307\r"
+	.ascii	"17g19N\3578\"\305J\034\034\f+nfp9\213\265a\365c\311\315\267\313"
+	.ascii	"o\377sv\266\200\300\241x\013cu\247\242\b\026\344=\321\302\324"
+	.ascii	"VY\006c\245 \367\020N\023\016<\271\233\233\364D\311{aG\333mY"
+	.ascii	"n\313kVl3\365\336X\\e`>\031U\030o\376\0067\375g\266\274\226\223"
+	.ascii	"\325\204\313.\177\3411\203f\202\352\346o0\323\177\366\322\005"
+	.ascii	"\310\0201\247\233\325\244\334\256\270\271\371\033\306\364\377"
+	.ascii	"\234\226\267\330\262\314%g\371\020\362\026LK\306\342\303\004"
+	.ascii	"\264w\216\260\343\336H.\371J\306b\333\256\220\333\n\007\212\030"
+	.ascii	"\336\214\354\324\344\005/f\376\006\034\372\033f\350?c\271`\276"
+	.ascii	"\254p\272\371\033`\350?[\311gk/lP)\313T\362\031\206\332MY\033"
+	.ascii	"$\021Ssw\267\251\2502\2502d\323\206\220\001s\3635\230\321\327"
+	.ascii	"\340\226\245\344\030g4i\272\371\032\324\262\331\263\230\261\007"
+	.ascii	"7\301\370R\345f\344\316\025\324\024%e\027\350\247+f`\231,_\201"
+	.ascii	"\031\331\031J\216re\212\226\354\304\226\345'y\354\031\371$3\311"
+	.ascii	"M|\236\220\333J\203\023\222\236\231\030[.r\276\206)\372\317b"
+	.ascii	"\317Mp\3355\356\r\227\305\0168\250\233E\020="
+	.string	"\213}a\301\261\346\346k \323\177F\362\004\311\002\026u\363\357\323\035\233\243\r\313OkQxf\3022\323\013'\326\254\271Pl\356\216l\030\315\233#vS\346L^X6\361\345\030\266\345\320\250\250\222\314\2737l\333\225\007_c\222{ol\347\346\210\325\340\3459\335\">\345\336F\266#\212.DVQ2\216\314#\033\311G\262\220l\314-\344%9IF\222\303\262\215\374\225k\344!\271H\006\313X\371\230\225d\257\234\225\203d\035\371G\356\221\211\344\0359G\326\312>rW\336\31272\227-\313@\262\214\347\031\231\306sX\nK\307\205\250*S\231\205\345\250\264c\006\222_\344+\333vu\001$K2\020<\207\3530\023*\r\245\tT\262E\231\232\025\226\216J\022J-I\224YL\301\223\312TR\222'\274p)\223\342\230\246\3151\273\360"
+	.string	"\tY2,\003\311M\267\210m\343A\001\260\270d\033K7g\3312\020\374\006\227\021;\223\366\2657\322\247\214\\\035\232\013d\214\264Bf\007\\\372\3171\236\257\310p\206\344I\325\335\234a\020=\307"
+	.ascii	"\300\224,h7\343\330 \363\032\264\3645T\351\013\345\351\013\241"
+	.ascii	"\321\027\272\222\2472\214/:\272n\276\220\231\276\220\020}!\243"
+	.ascii	"\276\320\223~\0065\372\031\310\350gh\323\317\240\246\237\001"
+	.ascii	"M?\003\231~\206\"\372\031j\350g\240\322\317\360\244\037\204F"
+	.ascii	"?hM?\310\212~\020R?HK?\310I\037"
+	.string	"\203\030}\fT\3641\264\240\217aJ\037\310N\037\bN\037h\213>\020\231>\320\227\306fp\322\226}\300t9O\310=\2667\262\227#\346\214\r\262\233\017\024D\337~0{yyyy\366\203y \027\372?x\372\307d>\364\254\021\343\3645F\316\274\261\265\344\311\013\266\f\313\341\2701,g\253`8\333v\265\363\226\330\226\325W\317\032\252\215\226\363\177\316\364\217\305\034\303\375\327\355FY\272\021\354=\266\367\336\3203\207\005\t\344\346\233\203\350X\214\007>r \301o8\214u\001\314\022\"\270\r\273a0\330\005\314f\313p\030\374\345x\355Bi\001\203$K\222\344\026\254\206\221G\234'ZG\222X,\235\017\023rO5@LK\355\013\207\301^\2144i\251\315)QK\302\223K\033d\376gK\377\307\206\306j\027s\301]\216\325p\332Epp\236\247\r\2667\022\253\345\275\233\254\025\200\217\265\002(\263"
+	.ascii	"ijb\346\377\304\320\377q\322\357\215\321\357y\321\357\241\351"
+	.ascii	"\037_\301VpVp\3111\345f\214\226c\207e\216\356\346\367\306t\030"
+	.ascii	"*dI\266/XG4i\310\216v\266\315V\030\227,G\222lj\\I\266.<\222a"
+	.ascii	"\306\324\216?\334\034\217\224I^\257\260\027\222\326\316\276\001"
+	.ascii	";^\024]\306 l\216K\330\260 I&\031\203\217\\\035\227\207\017\323"
+	.ascii	"\317\336[)\216{\357\353\205\204\314\321\213\311\227\244\261\205"
+	.ascii	"\273#\027\2640*+\270\032?\276\3027\360\327u\203\251\3346X\nO"
+	.ascii	"\301N0\r<\004\037\261\026\036\303>0\f\314\204O\340\032\227\r"
+	.ascii	"n\302H0\013<\205{`/\034\004\253\300\373\276\271yx\t\006\202["
+	.ascii	"`+L\206_`\"\270\t\326\201\3010\nl\003C\301J0\022\357\300O\260"
+	.ascii	"\021\213]<\034\206e`!\270\fWa,<\003wa'\034\003\247\300P\030\007"
+	.ascii	">\303.\360\026N\202\177\340(\314\004K\301<\360\n\234\205\215"
+	.ascii	"`3\034\005\267\200\253\340\034\230\013Sa\023\270\b~\262e\370"
+	.ascii	"\310M\363\253\346\336\325Ea\343\322#I\205\217\334\030W\006F\036"
+	.ascii	"E\2002\225\334{\023\241\231\272\306.\274c\023\222\243W\223.l"
+	.ascii	"^n$\355\234\340\276\250fH%\311\250$/\323\177\215\\PV\300\354"
+	.ascii	"R\300\375p\363_\252\0272\210\360\221\353\302\245\303\310\263"
+	.ascii	"\021L\320Hj\371\302;S\342\005&w\274\306\343\232#\333\232\r\023"
+	.ascii	"A\216li?\222a\246\224]/%q\3079\2334\013\363\344-\355z}\315I\361"
+	.ascii	"8\332\274\235\344h\303@y\253\302\301\177\275\304\336\274\314"
+	.ascii	"\255\331\222b\303D\221\222\264S\001\347\003\nH\233$\227*K\222"
+	.ascii	"=\362\216O\3775\372xs\264a\234X:\035\\\222{#\211\352d$\361\376"
+	.ascii	"Ku]\314\260v\226\215\022\252\0264\216\226m\013\220\344\245\242"
+	.ascii	"qo\240`\221\334{\377\236\370-\227+I\222{#m\0303\263\243\r#EG"
+	.ascii	"\224\244\227\021'fXlq\235\271\262\273E|\232~\366\223\t\251\343"
+	.ascii	"\336H\033\006\037\271eN\246$\251n\225\rk\267\242\007\232\377"
+	.ascii	"\032/\216\025k\376k\274ZQ\327\230\005\247b\356L\231\032{\267"
+	.ascii	"\344X\346\277^\310\2675k\207\217\334)\270\033\307\275\221\030"
+	.ascii	"\fa`:\275\b\022\303v\0056\214\350\246\r\035*\311$S5h\364\220"
+	.ascii	"\350\310\201B\306M\032\177ig\316\330a\302\326\346\310\315\366"
+	.ascii	"h\205L\363\212\350\246\214\236\215.\246\253\233\205b\300\260"
+	.ascii	"\013\363\245\305\213\2330\376\f\343>\275Q\251\343q\363\215#\272"
+	.ascii	"\371\342\206\355\200\352\341\302l\221\215\306\033p&\325\315\026"
+	.ascii	"\277YeZ\2715\365\350q\263%\263B&\007\033d\332)D7\251x\256X\211"
+	.ascii	"m\2312\245\354\344\264P\260\270)u\250\247,\"7\3435\242\233,\342"
+	.ascii	"\252\320^\2540U\354\230\240\362b\302\214\272\251\3427M\330<3"
+	.ascii	"/\b\232\0257_\030D7\243\236\\D\351Jqe\224L\240\322D\201B\301"
+	.ascii	"\303d\252\005\221\0237Q\374%\235u\363"
+	.string	"$b\005\327\326\315\246\t\242\233'\240\360\220\334\254c>\231N>q3\210\2401\367M\247\337d2\233|\324tl\221\272\331\032\255\220\231!\217\350\346\3361\353\342&\310\315Ao\334\360hQ\275\240\243\315K7\277\365b\321X\261\021t\341\002\006\357\346\022\217\350e\033\235\227w\205\353f\0376k\360\2141[\210\244y\271\346/\325\224we\017\027T\324\334l\277\254\220\271\301\006\231\245\035\321\3134=<~xU\271Y\003\2323\032\206\t&2\352^\236\371K2\026\317\212\215\240\206\220\034:n.\351\210^\326\2252\272\340\360q\363N\2314\263\303I\224\027e^\232\371\3139\273\306\212\225\310s\243\346\346\036\033d\226d\210^\226\331Y\323\222\\r3\217\r2\345\3442\033\253\003K*\315\007\314\216(\0257\337\303]\332K/ie\034\026\303\263\231\304\366\024N\225.pVw\033\352\352\303\016\023\025L\\"
+	.ascii	"\3632\356%\234\b\016^F\177y\211i\272\271\024s\237\253/V\2227"
+	.ascii	"\277\fS\276\3759:Ct\214\031\271\371\036\270\350+@\fF\225\333"
+	.ascii	"%Rf\005\335\315\245\013\317r\005w\267\325\266\246\005\306\351"
+	.ascii	"\346\362K\271f\313\336\245d;\262\347c\005EY\227\233\357\301\212"
+	.ascii	"\276}\027\223\005\373.f\251\366\262\313\237\223c\005KG\326\315"
+	.ascii	"\367\020E\377%\227?\007'\212\030\032\307\233\357\301\211\276"
+	.ascii	"\007%W\256\224Z\254\330\236\"\322\002c\365\305\263\204\215[X"
+	.ascii	"\226\227ZJ,\036\250\252T)\321\254\330\236\312\200\326\302H\215"
+	.ascii	";$)\304\3348{\211f\347\244M\311\315\267\303u\346\332T\03367\337"
+	.ascii	"\003\324\224)\245\331\327q\315S\326\2306dd\245\331\220\021\303"
+	.ascii	"\265H\342\345\013g\216\r\016\247(/\315p\242\302|T\335\\\226\275"
+	.ascii	"\214\351\202\021#@\222M\232\224O\216\2376\026\227\343\336W\037"
+	.ascii	"X`S\201t\362\362\211\017\212\256\024o7\227c<fg\300\244\031"
+	.ascii	"\353\031\301S!\246M\211\222\222\211\025\333S\266,\013o\306\335"
+	.ascii	"\336W\037l]\326\221\024%\362%\023\034\037k:\254n.\227\224U&\206"
+	.ascii	"\2641v\300\242\217\374H\t6d\304og\222x\371\332\373\352\003\336"
+	.ascii	"\002\346\302E\222\227`=G\320~D\271\271Dr3\377sr\032\256'\271"
+	.ascii	"\233o\367!\352I\032\247\233\337\241\207\020!\245\021\241%V;="
+	.ascii	"\262\264\250\363zi\344Yr~\264`\013+\213`\211\031\235\224EJ\""
+	.ascii	"X[\334~T1\361\266\256<\225C\362\030\017\325\022,Hn~\007\030\372"
+	.ascii	"/\217\266\254<\336\"\037\214MM\0050rFk\245a\231\270\371\035N"
+	.ascii	"\350\277\354*+\273,\235\025\333S:)\234\214\324\270\333;-\203"
+	.ascii	"^\032/\033>n>\005j?~d6BG\352\362\352\216x7\237\002)\372/{\334"
+	.ascii	"\226\225=2\232\013\030\267U\002Z\020;\223\326C\206F\023\230\376"
+	.ascii	"K\036e%\217\\g\305v\225\317V\335\226U^\323\205\306u\363)\330"
+	.ascii	"\241\377r\307mY\271#'\207\214\333\252\003#uZj%\227'057\237\202"
+	.ascii	"\026\372/\215\266\2544\2269>\030\267\325\006k\350\316${\324h"
+	.ascii	"D%o.s\374%\2162\253\324\2628Y;\272\354)Y\204\264\271\271C\233"
+	.ascii	"\02521\030\236\r\033%\026\231\262-jI\223\333\275\304r#\322\025"
+	.ascii	"E.F\214\222\306\224#\316\030\265\030o3^\322\300a\261F\315\276"
+	.ascii	"\271\224QVQ\271\221j\272\271\274\312\351AYsBH\231(,\300p\245"
+	.ascii	"\275x\241\344\270\257\256>\330\035wy^\224HI\225-\364\336\233"
+	.ascii	"\t\271\247\206\256\b\271\372P&\307\306\274\254^\266\260m\302"
+	.ascii	"|\220\335\\N"
+	.string	"\225UX\305\327\220\261\262\252\244\3329\3168\343F\r\007\206\023\233-\034|\224QeT\271bISo\310\031\f\271R\305\313\025wL]\230\335\315\267\263t\377sJ\2554d\252\334|\0160\364\355\021[2\225\225L%T\016TN{!\271\251\\d`\263\360\030\337D\231\371\270\371/M\274D\361\227M\245Sy\202\247gH\032\256:\334\002\r\025Dn.\237\210^\232\310`pj\316\334\234\201\r2/\266\255\220\251\2156\310<\007*\355\306M\316\353 \211[\215\017<Kv\023\037o\236\363\362[Y\206G7\204\003\223V\223\361\324d6\346\336\026i\234\242\312v9\315\363\335\3572\033\273\251\366\276\332Lt\032\240e\251\271\273\333WT\037\376\274\346\231\215Z\317\251\310\217)S\376\347\364|\225y\223q\363\207\352\364\207\274\350\377\366\3677w\023\325\336\333\252Dn*'\036\363\267\267\245\265\037\376\036\213\355"
+	.string	"\376\347\275\377\343?\345"
+	.string	"r\237\220Bf\357m\321\350!U\232hX\260\313\266\275\237\262\230(\220U\365\224\025\003j,\253\n\bj,k3=u1\001Q\355,&\250\261\275\201\236\236\230*`\254\202\032k\332@Pc\273j\233p\253\262\033\231\305\264\237\214\033h?\355\246=f\254\262"
+	.string	"\352)\253\nj\254\251\n\bj,\253j\217e\355\237\375\324D\225\342iS\001\355\261,\272=f\254\372\201\0323VA\215e\305Y<\025;\256`@!\003D\312\322A=m)\0265\232\250~\332\240\220\306\035\267\267%;\261\251v\333\336\003\330\273\206\221*\256)\206=sj\223r\222\322d\264\310\2757\007\026NZ\306\375\324\306dw\033\024\021\343\336D\234\2226\213\275\367\336\200\t\331\266\271l\033S\216\032{\305\211\275)\330\310\275Y\354\315dw\333\336\233i\357\215CU\003\271\367\214\037\250#\013\026{_\r\261\3305\230\320N\354}\311\344\316\252\240\306\264\214DhO\306\216\033\005\222\311B\2550\006;\026\350"
+	.string	"\t)\204\360\201\317\002\025\310\200\t\276\0206\340C\201\004\240'\201(\206@\177J@#a\032B-*\205\320"
+	.string	"\004*\t\205C!\316\352CK\244Es\205\241\232\264\016\2058G'\n\314+Z\f\242A\363I B \245GB\017?\024Xt\n-P$\001U\225\326\023=\372)\252\303\242\020-\342\254(\n*0\004$a\252\256(\364:\340"
+	.string	"\272\246\252\007\216\224\212\212;O\002A\342T\325sM\213*X\321\021\326\264hG\004\025\214Nb\020\372\033\232\320{\022\b#\037\032LW\241\222\032\302\350("
+	.string	"E\244\023(\002\2220\r\252\347\016\272\236+\n+\212\324\323\023\302@\342T\325\017\212\033\212\037\254\2510\375!\001$\242\033"
+	.string	"\022\212\300A(\002\032<1\200\341\204\fEtiXT\222"
+	.string	"ai\b\302O\230\036\371\370h"
+	.string	"bUO\"\210\025\035A\350F\251\212\nQ$\375\r\030\240"
+	.string	"\006t\260\204\363\016\036\240\301\00340\337\301\003\210\210\036\300"
+	.string	"\"}\006\020\341u]\205\",\rA@K\244>At-\222@\241\303\272>\t\304\221RQ\360D\325\265\030B8\f\006\207F"
+	.ascii	"\370\tQ\\\364\035)\025\025Mu%\342\257?\022\226\206 \240#\322"
+	.ascii	"\325\350\344A}8E\237\n\3053\270\246 ,\r\213x\212kZ\224\237\004"
+	.ascii	"bI\rRu\210g\320H-U\364\227\216\030\252\304\037\272\244\002\317"
+	.ascii	"TE\213@K(\220\250T\201#\340\231\244#L-X}8Hg\n\303\324\207\244"
+	.ascii	"\004$\016\251?aZ\344[\317\242/\250\244\256*\240\304b\007\036"
+	.ascii	"\024x\032\351\254*:B\230\032\251\2774X\n\323\240V\301\bM2Z:\203"
+	.ascii	"\272\210\242*\022Z\201\340\031\302\b\342\021\206\364\034\022"
+	.ascii	"\246FhQiI\335YR:}Kg\260W\024Z\321\342\321\321p\007\375\r\203"
+	.ascii	"@\001\330@\202\250z\360\371\220\204\251\221*\200\3370UQ\242\357"
+	.ascii	"\210\b\364\241\301S=\362\031\251E_Z,\252\034~\251oM\205J=\"\200"
+	.ascii	"Kj\261\267\026\317#_Q\251\250\350\243\n\213\276%\265\267\372"
+	.ascii	"D,@\205\342\031\364\025\201\250Px&\031\371\320_\252\252\350\210"
+	.ascii	"\241\217X\fR\360S:\213\322u\210\204\n}hQ\311wTT\215\206\236\004"
+	.ascii	"biX\024\002\211\310ai\b\3020\025\246\304\237'\201\240\240\007"
+	.ascii	"\375\rM\310\001\016\207 \370\312\037ZT\321\021\250\352+\256p"
+	.ascii	"\222\b\"n \246\300#\025]J\203:k\222\321:T\364\235\360K"
+	.string	"\211<%\222|\305\342I\\a\b\364\255p\222\360!*\221\224d\264\016\205\030\326'\201\370\245\304\020k\022R\n<\022\301\026}G\277\224h\236`I\260\025\260\277\224\210\211Va:<\201\250\364\023\246\036\330\260\263\302\371\001%\024~)\321G\230\232\260~\360K\211?\253\021zt\264\252(q\t\365\255\300t\365\t\207%Ru\2304\204\376\206&\220X\323\021\247:B\272\n\317^\n\032\204\3519\202:\\O\025\315\260\201\025N\022@@\324\310\350\003t=U\237\037\322\317\0178L*\242\351\220\270\242\305!4\230\256:$N \372\333\311\020\264\302I\302\327\323)\221\3443J\327s-f \241\242#\206F\250\352K*\236\252\221\217\217\320:\364A\211$\326\237t\007Ix\016\025\323\245\323\207\244T\204\3766\b\323\023\t\250\030\364\375N4\351Ta8\004\372TT\230\236\352\352\033\252F'\007az\"\375"
+	.ascii	"\251CUE7\034\035\rW%#\237\221\257Xtb@\211$V\237\210^\211$\237"
+	.ascii	"0]}\f Z\205\251\222.\221\344[:\203B\350oh\202\0205R\321\023R"
+	.ascii	"\360\260\246\301\264\004\024\210$\374`\203"
+	.string	"0=G"
+	.string	"Z\321\"\272\001\025EBJ\325\024V\030\002\201\037"
+	.string	"\207\352*\034\206\220d$T:\201"
+	.ascii	"\360\241E%\fK'\020U}+\234$|?t=U$t\025\246\031J\244\352\211\n"
+	.ascii	"\323\022\326\242\222\232\264\006\225\302\364D\322A\215\204\347"
+	.ascii	"\210\337\371\353Y\225\210\253\322\320\247\016\327a\020\203\271"
+	.ascii	"\n\225\206"
+	.string	"F> \0205\362\371\206\253\322\271\001\270\256C5i\365\255Bt\b\r\236\030@\201\351\321P%\356\004\211?\304\264\207\026OT5\022\246(\360\227\372\204$~B\302a\272\246E\341\251\256\032\220\204)\322\251\242#N\241\244u8\f\026\325\341jt\036\371Tt]S\022pX\213\303a\021\320\232\006S\240\017]O\325\267t\006)\030\022\227P\237\220\304\317GtD\004\006\241F\247\352\003\242#P`\257(D\211\301\241\221\017\351,\372\326\263h\204P\361\227\0223\024\317\240\207$\2435%\372\200\300\241\332!\005J\211\030\206\351z\252>a\032\374\t\t\323\023\311\367S\317\025\324\341\321\017E\217:lP\321\024HLW\240R\320\247\242+0=\362\005Ut\375\371~hz\224\002\211\301\2648\200'\201(\242\277a\320g\244\2060:*\372\220\322#\3410\004\3410]\317\021\351j\364\001\372\033\0065\020\211X"
+	.string	"\032<\205\276\r|*ZT\362-\r\213z\353\2238|HD\325\020\353p\250\206\330\371\221\260\nQ\341\031TQ\342N\321\2674,*W_\007\2530U\3029\021Q\b\026p"
+	.string	"\003#h#\020K\303\"\037\261\030\fA,\006C\b\3233\030\302H-\206"
+	.ascii	"1\364#a"
+	.string	"iXT\252g\222QF\203'\006\226\206E8\377\315\261[$\206\t<\263\233\315D\240\321\342\212X\t\226g\005j3\311h|P\305\220\273\331\314*\311uf.\251s\343\245\206\t%9i\261\330\262\336\302\320\220;gXe.\222\2249v\332\370\b;C\242\245\027g\324\261\342\210\331\233T\227\231\2572\256mI\036\327\315f\021\314B^^^^\233\275\233\314\"\3274bz\335,\362\036N\334\027T\223\231\315\256w\231C\216\241io\247\275\261x\024\340\312\305\207\337\frs\210)\344\305\2312-!f\013q/\244\2720\032\te\302\266\230\307\233\006\253\001I;s\363\355\236\345\005Z\222/7\277\202(\375\233@2\033:$i~\374(\231\244\261\021\304Gv\233\222f;\351Q>\351Zs\362\205\013\312n\312\313\023\036[3p\350\210\272\331\334\022\313\241\302\243Gr\207\016_U\013o7\233:\310\334"
+	.ascii	"Q\301\226C\213g\267\355p\313\272\251\365\227xV\315]A\343\312"
+	.ascii	"\314\315\345\034\321\315\254\033\204\254K\027\034\306\036\267"
+	.ascii	"\034"
+	.string	"V\336l\3344\376&\226y\243\315\313K\314\315\026\312\n\231@6\310\f\204\260\250\3031\245Z\236\t!d\240C\314 E$\263i:\363\025@@\220P,\220\206E\326\003\023\300\302\213J\345\221\246\007\241Bb#I\222Z\365j\r$\341\\!\332a&f\271\230\024\007\321\344Ho\016\222\202\243O\2134\252\340\335\227\223_Iq\002\225'\2058[\221'g\340\004\f\211f\0076W\020GB\377D\004t\262$\377F\324\260u\222k\3238\314\320.&\202h\325\022\240\370L\024\276o\336\200\2269\337\211M\177\002\201\304\236\356\"#\306\2507\261\222u\033\265\261\327cQ}\271\263pZ\236\020\204\265lJ\2613\2316\255B\021\324\022&B\332\265D+Z\274jZ\376\252\257\325;\3309\373i5\242q\214\250\205\327U\264s(K\366\001\f\020\360\240-\035\323\363*4V\266=v\260`\272\252\215\305^\241"
+	.string	"\n%\371\277\300\276\004\037oP\356\244j\034\33346)\240D\245\343\336\022`U\314~{\230\250>\304z\2322\340\013\360D=\307_\304\037?\213-\231\361^\r\330"
+	.string	"UM$[\323t.>\363\250\323\373&jq[X\247\356<\345\307\263\344\022)\356\262\334\257\247\\\356J\211\210\026\357&\2267"
+	.ascii	"\177\237!Q\f\364\233\254W\245\253(\002nMh\266|_4\001\252ri#\272"
+	.ascii	"3\326\234iu\252\342\030Z\345\206\372H\367\362\326-\206\362\273"
+	.ascii	"\316\"|\2429\301\273\232O`<\f=l\324P\265\374\223M\032<\026x!"
+	.ascii	"\250H\225Z\036\333\226\215\030>L\327s\224\221\326\214\214\221"
+	.ascii	"\256\227\31668t\203\330\303P\244\247F-\376%\302\212mM\202\334"
+	.ascii	"k\256&\024\343\336\200\215\256\026\354\025\370\0307!\037\013"
+	.ascii	"\3155\341\376\\Y\324\253N\367\331\026&\b\304\314\205<\370[\002"
+	.ascii	"\324\303|\360\221tM\302\006\035\214\264\321'\371E\304\350\246"
+	.ascii	"J\267\023F\230\200(:F\236\016\035*"
+	.string	"\333\254!\035D\352H}\351J>\035y\372\2008UI\013[\b\233O\350 z\367s\267\234#\r\254j\334l8\245\244\374s\3566?\304\300\212\256\177q\016y\222\316\223\315G\250pa\243^/\230jV!\237\304\021\336hk\371ht\374\370\017\256\214\205o\033\373m\213\256\230\276T\231\033\347|\0014\310\332v\3424\030W\364_;\276o\300\307\240\031DA\231\370?\033\024j\210\213HA]}\242W\377\312g\264.\302\264\277\255\317\370\026\315>\362\325D\352N\212\364\2211\314\267\371\237\243x\307\207\303\r=\357\025\222\225m\303\345\0043$\223?\303\025\3517\270\356-&5\265\320\030\233'|\210\363b\307\f\263\227\r\347\016_\245m\207S\215\277\025\312\204|V\206\204\317Ly?o\323\177cY\336\370\234\330,[ \270\021\002\265q{\347\201\363\006\305(Z\016\347}#\3204\352\006'\345\037\032\352"
+	.string	"`\222Rx\213w\0245\336\271\253\354\004\340\242\335\374\244'E\245G\035\245)\342k\0025,v\306\020\024T\255\367x\0311\007\342\344\267q\207{W\360S\032\345D=.v\201\002\003H\312\336F\244\221!\337K\363_\3112\275\242\340\226n\244\034\312\fo}\230YH\206#\301~\373\2232\t\265\343\203\350E\226\024\317\314\212!"
+	.string	"\257j`@\033'\035\236~`\367j_\343\343\361Wv7c\203 \\\365.\227\232\364:\223,\327\275O\314\301\224f\272\323(\243\035H\342\361\372E\215\022\267\350\342\211=M\023R##\254\205\257\231fj\214|i#\344\266\207D\221\324\025\350\330\033\263\310\366\021\243\036\314\315\315\273\030\005\013*\332\203\232OL=\210\205\277\300\204\346N\302:\3406W0(\202k\367if\305\270\022 \331)\216\230\364\2634r\272\300\b\316\242\022\255\260Y\214\"\322mp\314U-D\331\004\026\367\t\320\213\277\"\210\235\216D{z}5%\212\347Md{^\314\311\323\357\204?\034\334\226\373O\t\302\346&\227\300\032\350\364@Fg\325r$\2437 \330o02\306\366\211+\233.+{\225\243\342`i\b\025\355\016\234\24014 \351\305u\344\220C\007@`z\001<\225@\367!\332\345\362Z]\017\\"
+	.ascii	"uj\260&\220a\353\375\206~\367\036\210\035\017\311\264#la\024"
+	.ascii	":\r\243\023U\301h\307\252\364\032\311\200\362\314\262E\332\""
+	.ascii	"t l5&6\366W\262\262\345\222X\004\254-!]\021\254\004\032\351F"
+	.ascii	"\335\352\311\244\037rUL\333-Q\371\324\205_\210B\307k\220\005"
+	.ascii	"\234\0131\314\020\373\352?I\214W\013\001\246\366r\244\373qw\310"
+	.ascii	"\334\3718H,\200\034"
+	.ascii	"@\364\026'\376Y\24080\335\013\353E\260^\252\374a\227\342)\002"
+	.ascii	"\350\371\317<\357\230\353\235\214T\363\367\347A=w\2773KS\365"
+	.ascii	"\274\342\370 \226\342\235\230\r\317\271\330\201\021!F\023t\315"
+	.ascii	"\252/\202o\242\022)\316\302yh\232\371\275\325{\231\0052\245#"
+	.ascii	"o\207o\036\340\030\327F0G}F\243\032\336\205\366\2552\b\006\033"
+	.ascii	"\315\240G\317\276\363c\203 p13\001.\177\326H ,f>g\220\245 /\303"
+	.ascii	"\207\262\313g\333)pN)\005N\007d\fm?e\037\"!ku(\030<\325\034\302"
+	.ascii	"\345\337\326\215\276\022\b\315=_\033)\216\324\375\330\333zC^"
+	.ascii	"\037gy\277'\013Zt\314\037\253\205(K\013g\234\272\200\306\204"
+	.ascii	"\215\306}\222\326Og\200\226\247\271M\364x\336\207B\374\316;\033"
+	.ascii	"\300Xai\352t\340\303\177\360J\224\234\313(\177yJ\2452\245\262"
+	.ascii	" \250\3366\336$\026j\270.\302X=\3263\306i\343\245\301M-\214j"
+	.ascii	"c\210\201\266RO\003\024T\214\332\354\336\267O9\330\217\311\222"
+	.ascii	"\203\213\210\351s"
+	.string	"\332}X\025\232\351\367\250|\033\032K\033I\205v4\267\271r\023\2120\036\004]\3264/[w\256`\016\227\237\f\307.T,L1\210\037\230\337:j\034\350\363\315z\343\t\270]\001\035X!\322^\257\035\232\223\220\205\350:Ag\253\004\244@7\0201Az\013\b\n\3514\334\037?H\025:\377\333W\343\277\001\366%Y<\210\004\036\335\311\235\250!l\f\376\365\325g%\025\370\354KF\335\270\370f\367\214\030\246\212\324T\260Xh5\304j\303\037~T;\037B\344\246\0072Rk\227s\215D\240\372\005\332\007\2205w\2008C1\336\310\326}\r\374\344^\017\323s`\370\341\260\217\351\360\331\023\033\322\204u\306X=c\373pi^\252Y\306#g\277&\226\341(%\026TI\353]M\345\246N\025|\247\342\203\354j7\344\323\374hj\217S\262\322\036Z*\313\030\322\202\326\2240&2\2120/\331\346"
+	.ascii	"\347\202U\300\017\nY\204S\333\355\207u\330z\314h\362\026\250"
+	.ascii	",\222\253\231\254\203p\331b\020\275\3747\261\223\371\234\333"
+	.ascii	"\224F\334\372\346>\006\333\206\330\344\3231\317h\2213\336Hv\360"
+	.ascii	"\270\270\031\344\361\306CB\234\207=\2051\270\b\353\270\241\024"
+	.ascii	"\303\275N\031\257exW4X\nn\177;r\214\020\033;\364\346P\372\266"
+	.ascii	"\250H\"\253\005-\227k2\306\217\020\212\326\213\177\327\342e\365"
+	.ascii	"\254\264?\344\232\370\357\356U\f\230\333\261L\373f\225\276\215"
+	.ascii	"\025\210\220\276{\243\324'r\365\334\252*D\312\215\246\334i\031"
+	.ascii	"\373\021\374\231\260\336K\361<\002\317\362{b$Q@\360\203\375\336"
+	.ascii	"E*\213\352\365\013Ky\221\267q\316\3367\370\234\275\273{\017\330"
+	.ascii	"nR\256sU\036\251\340\353x.K=`G\363\023\001\013\031P>S{\215u+"
+	.ascii	"\244\203!\264\364\274\262\037\"\226F\317\375\320\351,\3379g\214"
+	.ascii	"n\261L\004\271\255\020\034\203\251Ikn,`'\227\317\213\360 \202"
+	.ascii	"\242\205D\021E\203\202\372;x\320\036\232\310\030@\364-\340b\313"
+	.ascii	";\350\300GA\006\247\020\274_\253\021\0219~F\003\003\266\315a"
+	.ascii	"\232\220\001\bO\222C\224L\334$\306b\035@\f\r\371\225\333?\"\324"
+	.ascii	"U\003\350\233\310c;ma\3439zf\206t\242~&x2\"\243NG\205K\214MY"
+	.ascii	"$]{v\241\037\222\016{\033?N\224\340\022\001\340g\374\030\210"
+	.ascii	"\016\201\0270\216\313Go\036\262I\322\225\377)\3521\321\377f."
+	.ascii	"-y?\264\307\026\266\202O/o\3509c\023n\276\023\235t1\340\306)"
+	.ascii	"&\352\266\204\363\f\317\016q\334\017\033\025\375\327\353?\rf"
+	.ascii	"\316\207y\223\315)\3374n\307 c\367D\016\21080\007\030h\274$l"
+	.ascii	"\254\324\337\302<I\003\267\001\301r\211\236\343\360.h\305\272"
+	.ascii	"I\252\361\303\016k\r\317\351/c\220\306\322\007\262\033S`\276"
+	.ascii	"W\2373\006?\274;;s7^7(\330\372F\032\227\204n\306\2045\266+"
+	.text
+	.section	.gnu.lto_.symtab.e0cb6397f76f09bd,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e0cb6397f76f09bd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1529 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	"\t"
+	.string	"\013"
+	.string	"\022"
+	.text
+	.section	.gnu.lto_.icf.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\020\003\345\r"
+	.string	"F\020>9P\215\322\030#[@\303\b\322\337\n/5\035\355[\001\237\316\321G\306{4\353$\206,@\004\"3333\210\252\242\2222d\ti\266\021\322\2545B\310&deK{\007("
+	.string	","
+	.string	"2"
+	.ascii	"\331\205\302\001\265;7}{\257\2736=\233N\367\006P%\023\227\375"
+	.ascii	"\362\317\263M\245A\0046\345\362k\202\204)%=r7o\23498xA\247`\021"
+	.ascii	"r\3224\223\243\004Je;\307i\337w\3254\255zOo\303m4s\2566-\030"
+	.ascii	"I\203\356\231w\314{w\177\352IGF(3^\027\201\301e\202\241\323\261"
+	.ascii	">\240\254F\035\267 zEp\342\242\2708\t:\020\304\301k\303\214\\"
+	.ascii	"-\244\032\036~\341\323s\365:\001r3\037\033\256PH\247\002O\260"
+	.ascii	"\033i\255Tx\244A\311\203\325\241'\026\223\2103\322\013U\210\005"
+	.ascii	"R\214\222*\345\333\367\027$F\022\3634\237\003\006x\ff\250q.\261"
+	.ascii	"$\245)\250f\r\200\002\0322\333\016\022\300U\035Mu\244,)\303 "
+	.ascii	"\331c3\356\316 \2155\376\370a\016<\245n\333\0162\006\302\324"
+	.ascii	"\277\2133\330kBf\354\006\225\"\024\231\201\215\204\027\306\323"
+	.ascii	"(X\007\331\356M\017\361\216FO%\235\234\002Rh7\200|d\031\234\344"
+	.ascii	"\236\341\227\341\252K\332\346<\331\254|fW6\253\353@WqF\212{\344"
+	.ascii	"Um\2709v9i\336yK\006\332\272\306\334\356\001\271\256zc&\252g"
+	.ascii	"\275j\357\334\252Whz9!\177\376\362}k\b\035\316\340@\374\3022"
+	.ascii	"\361=\\\034\253A\016`\251\217#\017\353F\203o\337\344[KQ\275\300"
+	.ascii	"7S\377W\204\031\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\276\001\275\006"
+	.string	"\342\207\024\031\220)\351\377\377\373h\364\377\377\377\177l4\376\243K\375\362_\362\311\226;\245\352D\2203\207\r\205]\226\360@\025\\\312HA\257\314M\342\265o\024@\336\365\266R->Sw\020_\211Q\215r\374\216\210FGL(A\037\200\371\351\365\3739\027\351\021N\250\201]gc\255g\320\202\241*z\021`\271!L\232\321\244\264\345M0Y<\365;_\r_\244\315t\225\020m\204\205\233|\232\224\340\306\027\206\260\267\351\311#rg\267\205\346\364;\370R\346\317\321Ib\007\274'\225\373r\035;\227\361\266$"
+	.ascii	"\242\247@\213\232\255\344\231\"Z\005Ed\022\254\216.\036f\204"
+	.ascii	"\260\335\213E\314\202\272\305G\232\f\334\347\332\177\316\351"
+	.ascii	"\031\002\235&\225md?\b\177J\025\005"
+	.text
+	.section	.gnu.lto_.inline.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\216\016\r5"
+	.string	"\312I\374\016E\220\236I:,E\257\336\303E88\315\024\270\037T\220n\307\013\302F9\001\332\343\247\306\372\361/"
+	.string	""
+	.string	"\240\367JtL\313\350G$\321n\222\004XR\326"
+	.string	"\020ZV>\254\036\032&m\250Eh7\322\366N2\005\320"
+	.string	"\327"
+	.string	"\334"
+	.ascii	"6\007\347~\271*-\352\252\356\205\264\002\033}\303\346\244\200"
+	.ascii	"F\336-Z0\\\370\332,\213\340Of\334\305\n\256l\321Qxm\321O\340"
+	.ascii	"n@?\324\006\326\246\274\267\312]\025^`\321\235L\344mz\232\027"
+	.string	"y\314\366\214k>\362I\333A\267\313\237\255$\245\3346\265\326\240\235a\350\343\254tSS\277\267\277Z\253\315f\372\217\315A?\351\004_;\367\223\026\277_Ko\223\314\252\265\352\204\344\364\247?\221\344\226/\031_kj\245\203\235\205\361\230WaZrl\366\222\274\n\323*\263\325l#\370\256m\264\031@\004w\332{\231$\223.\365\013\220\327V\362\\\337_z\255\265\202\366\b\251\203\313\212\031\356\266\211\276_\357\b\271\305e\305\354\307\336Y\267\"\224RJ)\245\224R\323Yk\245\273\273\037\244\217*\237\233u\2705\344\341\034:\344=J\234\261(\003a\2555\204\354!\004\355\307\315\242(\376\242/\372\"\2224\343E\314\215\2648\305\244\213yQ\301\370\361\305)\342FJ\345\370\373\243?\362\356\002\206\022\032\323\343\254<9U\026$L\315\037g\365n\335\335\335\332\223[2n\3200\362_\223\316\207\005Z\027"
+	.string	"\317\336\307x=\221\262K:\017*0\"\324s\316Ii\035GZ\355S\221\246U\"\335\2574\254\016k\357cQkr\024\360\303\232\3642K\252\034\311Y\354]\352\f\024W\216'}\200\331\352\002-\212\2428V\177\244r\217u\177\274\351\361c\rq\257\251\262)k&\231Uk\255\340\213\265V,\320NQk\205\n\336\246[\225a\021\001\262K\374\314\222\030U\022N|\016\237)h\024\204nkj\217\343\225\025\027\225\315n\372\n\2603\261\0047\353\262\244\031\004\201\251\351"
+	.ascii	";\013s`\341g\3160\fi8\255\003;\330\334\301\336\375\330\206\002"
+	.ascii	"\220\264>\ry"
+	.string	"Wc\003\312\357\246\241i\270t_\255RC\246\342\330;\326\330V\037 \237\212#\222\214\"\225\206\343\246\242\330\313\232\246\257\246J\237~\365\222\004e\233\233\355\005_\001\377\262\366z\331\005\177\272\212$\340\202;\335\346%!\245\240\2608\263\236\235\r'\217|\267\213\342\020\216\3516\310\272r\340l\246\213!\353\312\221\003m\351\241\257\3019\275$n\305\212\213\212\201\301\317\320\271\232\254u\326\n\302\311n\225\265\212\265\216\223RJ\303ZA\334sNSJi~U\227:gB\267\023,Fv\354L`\275<+\035\t\027,E^#\311\020\031S\342\031\243\343\233Q\327\032\343\345\n\221\204\357\214\360%\202\360\r\263\020R\254\n\" \204?\331\266\247\306\f4CB\003l\240z\373, *\n\312\2324\25148i:\007\b\347\2047A\3638\251\341\313G\276{2=\006YW\217ij\246\377\260\360\241q\026<\232"
+	.string	"\261\343\301\301\367\301\327E@\007\177\222\322kBN\325\020\353r\031\357\244U\231\0263v\367\325Y\230\326\316"
+	.ascii	"n\267Y\255P\271\021\337:\362\346F\350\320\366\346j\353)\320&"
+	.ascii	"!\253\212\270!+*!\235 \301Z!\301A^\037\371|[\372W\f4A\006$I2"
+	.ascii	"R\354\334\221\016\275\364\232\037B\201\007\276\013\266\r\376"
+	.ascii	"d\363\244W\003\330\340N\"$\032\2338>\204\214\363\221o\003\330"
+	.ascii	"\250\035\351\201~\250\021M\250FdD$)H\222\326\001\005\204I\346"
+	.ascii	"\030;\036\022\240\004E\312\302\326\334h\222\242J\215\255\315"
+	.ascii	"#\037\001O\377#\005=\215hf\224\2137i\227\242\b\020\362o\035>"
+	.ascii	"\f\275k:[:\345|9\220glG\220\377iv\004{\341\255%\266!Ax\224\315"
+	.ascii	"6\200J\263\320\346\003\017A5\376\037\206\034\356<Z\313\350L\266"
+	.ascii	"<\006\224f`&\220\022d(\321a\203\211\366$\236\342\273\251\\\""
+	.ascii	"\330Q}\032#Mu\031\301\034^\037\302Vh\204&M\327>.S\273'\304\241"
+	.ascii	"U\220\022\365\364\354\261\254J\214Ni\275\363\002\315\364\336"
+	.ascii	".\365\222\033\355\312\220\2104\227\024\203\315\364\260\256\207"
+	.ascii	"\032\236\311\r\373\n\343\306"
+	.string	">\355\362\r\257::\265\343\202:]W*\312)\350\346\t0\302W\024X\366\244\354\221E\210:\362\307\216\354\351\"r~\273/\013\027#\251\342AN\220\006@\021Jat\267\277e\202\032E\337\206\205\217\352\3252\034d\357W[\353\212\371\001\017\372\205k\025\n\342\002\022y\222m\242\032\375Z\311\2241\360E\270\200\021\215\230\202\272\345\340Bf}\247\320\270y{\330A\212\212\301\326\264uU\3479\201\026\223\030\225\344\344;\033\023\264A3\177\320n,d\362eB\266\276\313s\027\371\344\242Y'\004\027\227\325\331\267\326\360\362X\373\376\352 \037+3C(-\177\b\033\357\352\367\311%\030!\340\001\252\361\370\357\356\314\212\202,\004m\271\354y\334\231j\365\324\375\032\016\367C\0078\241w|\332\230\b\217X\341\307\020\211\201\267\362\255\007\237\271\001\376v\221 3\212\370}\211\321?\347\235\317v\223\365\357\225g\246"
+	.string	"9=\314\246%\357_\005\221\213\346\213k\332\242\376\250\265\326\330AF@E\332\222\305\037V\352#\354\022\216f\204qa>\264 V\201l\316\320\032\002\005\004\3072\367\325\0068\255\352\372\211\377\360\020\350+\340xknFH\302\362\2762\275\362"
+	.string	"\305\307\256\247\316\366\363\305 \263d\257P\334^\241\254\276\350`*\322\3103m\005BtA\003\374\273\373\013Su\342\f\322M\301\365Y\262\303\305&\3006\307\277\224\020\351\316z\\k\032\306\220\033\323\330\337\320"
+	.string	"\373\342\376C\325\034\334*`\361\205\254N0\234\"5\334\006cy\232R4\020?h\236\266i-\267\247j#==$\371x\262\315\0260\374\003"
+	.string	"#\275Y"
+	.ascii	"\257\213\226\265zD\034\340\275\324\037Z\2755\243\354\270(\264"
+	.ascii	"\247\262\245dO\315J\313\022\335\206WK\360\032\004\237\254\255"
+	.ascii	"\036\bk\253\353\270\352\331|\3267#d\373f\343\356W\272l{w\356"
+	.ascii	"\340\017\261\363O\221\336<\t'\002\367?\360W\204\273\002\356\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\356\tU\030"
+	.string	"\266\034V>\020\221\222t\205\"\202q\0361R\325\363\373)`\224\300\020\240\246 h\b\216\3353\230>\034\336\b"
+	.string	"*"
+	.string	""
+	.string	"\024\3411\341\343\031\254#\365\364v`\242\333\037\241\301\200\377P\264\273\021\"\223\f?"
+	.string	"D"
+	.string	"G"
+	.ascii	"gN,\022M\221\225O\233\304\230cf\f+\271\347\222\307\361\210UX"
+	.ascii	"\306\005=Po-\316\367'\302:C]/|\275L\326\244\257\236\307Wmz\253"
+	.ascii	"\247\371^\322co\323\223\360+\212\020\300\214\027\260_A\351\212"
+	.ascii	"<\013\r\252\250\t\331I\307k\024w;\305\355\310\330}\226\244\017"
+	.ascii	"\204\365\300\006\354G\f\372\324L\3234M\216\366sW\363CZs\313\233"
+	.ascii	"\270\337\nA\320#9B\246}\251\373\226t\353\210\241%\344u\260\256"
+	.ascii	"R\375\007\347\033w\254\306\035S\017\363-~a\355\354\301\371<\330"
+	.ascii	"t\320\207\231\253\370RP\312Y\034\211\256\262\342X(\360\301\022"
+	.ascii	"ge\351\t\236\362X\356CW\231\236n\f=b\323A\\l\312S\207\330\224"
+	.ascii	"\001$P\302B\275\322\363\351\225\364<\nz\231ii\300h\004\241\312"
+	.ascii	"H\222\214p\256\257\325\351\231\364\223\236\2407\215%B\236\214"
+	.ascii	"\005\324\206\rPO}\200\fV\245>\r\006\272\320\rV\030\227\323\245"
+	.ascii	"\334!\\.\313\345\343`-\t\302\200\303\250\201\275S3$IJRY\326p"
+	.ascii	"\002\221!\243\242\007\022 \303\034\204\301<\212)\347\230!\221"
+	.ascii	"\311HSF\255\f\007)\022\340\274g&\233\255\b\371\303y\274\374)"
+	.ascii	"s\035\236,o\2652Q&\262\200Q\277aaE\266\r\311\300V\020\212cM\025"
+	.ascii	"\373;\247\242\227S\337\317\315\004H>\300:"
+	.string	"\206.\331E\200C\256Z\361`\257\331\276\021qY\342\346%\025\277\033\300v\305\263A\355\211\370\200\326\327\234JnV\013r&\266w\316,\212&\346V:R\241w\201\375}\333\225\220\307\bn\n\200\227\032\030GN\3706\251\306L8\322+\256\236\357\353\345\236\004\351 \2120\200\204\246\340\243\375\377{\360\237\272\017d\345\253\032-\0240\224\356\361\320\243\bb\365#\016{%\001\t\rd\023\303Y\266\320\357E\2439\214A\023|\026Et4\227\235\252m\026\324\3715\323\211\323\267\363L\275B\276\027\300\004\310h_f\210\346=\352\361\345\376\212G\256\275\336\231x\017\331\024\230V\374\354\201\274\350\023\242\231\221DI\335!\344\321\332Q&v\303\226]\224{\261A\320G\225\363\245\275g\f\215\314%\24210\252\226$\213E\260O9E\310>J~\227O\025x\324#\004\273l\350\270x\200\246\006\370\371\233!!\366"
+	.ascii	"\224:\260IB\354.\323\366==\034\200id\021\226\240\373\360\340"
+	.ascii	"\005\320mV\203E\004g\205\026\016\002\036\314\361\205\314l\217"
+	.ascii	"\246$\035\355\3422L\021\336\301u{t\233\257\334\330\201\243^S"
+	.ascii	">3\365\272B0\202\345\251\030\035\262\220\242\251\220#\003"
+	.text
+	.section	.gnu.lto_.pureconst.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\205\004\001\232\004\003\232\004\004\232\004\005\232\004\006"
+	.ascii	"\231\004\007\231\004\t\231\004\013\271\004\f\231\004\r\271\004"
+	.ascii	"\020\231\004\021\231\004\022\232\004\023\231\004\024\230\004"
+	.ascii	"\025\231\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`=\002\275\f"
+	.string	"\246Q<8P\245&\351\314bK\327`U\345J\303\374\261\315\254\260\320\257\004W\334\322\361\004g>\"f\003)I\322\352b\353\232\341\357\211\251z\253^_\351[c\"\322\272Y\"w\n("
+	.string	"-"
+	.string	"+"
+	.string	"\222\337K\250q\256j\350\361H\211\257\335\372\\\366\357\035:\3173\315\255\234h\202\246O\363|*J\"\005\331\226\247g\017\001lj\255\275\220\3679\256azE]\033\223'E]\253\300sx\244@\r\343\250\224#\t`G\004\262\367*\327\246\255U"
+	.string	"pf(\373\260\033i\013\301-\270\004B\360\372[\313\353\347\022\236\231K\264_P\242?\030\225wP\323\357\345e\321\367\252\220C[\253\f\234O`\313Glx@HWa\r)a\002G\270\002D!\003\n\214:.B\317\350@"
+	.ascii	"\017\310\004\222X\0168\177\272f\364\264Z\275w\304h\346\222\223"
+	.ascii	"n.5\bO\250Q\275A\316Q\220\244\260\220\016\220\202\031*\253\007"
+	.ascii	"\0210Q\246jD$\005\311\326\001)@\211\003JA\376\204l\r&vM\211$"
+	.ascii	"5'\257e\2727-\310i\246\330\352\004\366.\330p\2422c\253X\242t"
+	.ascii	"\236\336\314~\t\307\024?\332(\256K\353G\213\rE\250\322\267\""
+	.ascii	"\251Lw\376u2S\\\325\006\313\003uu`\347\241G:k\317\225\"t\022"
+	.ascii	"\270\374\333\237\240\330J\017\034k\346\352gA\251\n\225\363\231"
+	.ascii	"@w\234~(\211X\200\235\013~\005\257 \317\355f@\250\007\272\001"
+	.ascii	"6\025\203!\236D\036\005"
+	.text
+	.section	.gnu.lto_.lto.a8406c871558a1e5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.20.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\027\001\035\r"
+	.string	"F\031[C\020s\223\016H?\266B\001r\353\232\205t_\214h\002\221\02727\026\017\201\320\241;\026,7j(\371\177\214 \021\001^\027\266\276)\220\355\""
+	.string	"\202\030\023s\342\205T\210\200\r\370\262\250\263f7\2212\245D"
+	.string	"F"
+	.string	"H"
+	.string	"\366]\356\242\373K\312\013\354\232dh\354~\n,\3029\364w\217\346\220\363\020\315\241;{\307\277\023\373\311\341!\346\307\356^j\342\335\263\363\177:"
+	.string	"\217\205\364\3348\330]\247\307\"\342\326\333N`\233\202\375\020\001+-\245L\331\037)\265\204\375jw\327j\262\237\266\016\363o\376\375\360/\277V\351\013\030"
+	.string	"\303\343c\027D*\310\242`\r\025\266o\331\256\322^\300\240;\314\350\037\202\0213.3\017\362\343`\200\300v8}\370<\003i\307\013y\357\232(l\240JJ\362F\355\320g\214*\254`\001\325\306p\031\030gw\033\37016d\036\035)R4\207\237\026 $T2\345M\236\307\215C#rK\355MC\336\363O\227\360\002\265\242$\277\305U-u\006#\215\213XD\211$'\\h\202\205\250\201N\266\220"
+	.string	"\\\334b\204\214\204\3232\b\242\r\353\330d\004\005\024\322\342V\"\332\260+C\b\204]&\332v\215\034p&\212\332\305e\231vY\337\276Z5\031\336@\251h\311W\273\3442\240*\306\353\321\t\025"
+	.string	"5\003\220\347\214w\201e\342\t^4\270"
+	.ascii	"\200\314g\025\f\243\322az\267bM\260\320X\250\256\001\307a\030"
+	.ascii	"\334\001\313@\211`D\200\2122\356\360\242\235d"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.21.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\343\004}\""
+	.string	"\032@\030\016I\200\030R:s\275\373\271\n\333\321\242\243\253\227&\220:j~t`q>\032\237\342\202V\335}HST\325O*\332\271<\313\001\307n\037"
+	.string	"i\274\260\355\323\021\332\344<\345\365u\347\007m\017iG\315\253\375\3376!r'\031\323"
+	.string	"\301"
+	.string	"\315"
+	.string	"Y\031\270\320\226O\r?\302Gr2\336\215EUISAL\352\353\225V\016+\rI\204\273\372\033y\030\357\0260 \2769\225\256\\\016\210<\205pW\371\313\203\021\317TAd\\1\241\r\352\\\327f\202\253\234"
+	.string	"w\225\233\017p\257\342\356\273W\231\310\274&\300\312f\3558\366\\\327\365\3277xg\211\327\355r\267\253\246m\211|"
+	.string	"N\214jJ\222\305\353\322\233U\026\217w\321\352J\207\330\234g\0173\332\335\335\212\361\334\355\305o\332\223\246%\b/yL\013\310\240\261d\227\274\262j\203(\231\032[0\236\246>\030L\276\360\222Vi\320\227\037]'\273\305JV\331~\330\201\206@YBkl\305\270\275\021\255\353\312\026\231\334:\333\234\231\2050\363\b\346\264H\317u]\205\244t0\002{\236=J\324\275j;\210\te\362\241D\371|!\2319\305\237t8"
+	.ascii	"f]\327\241&w\342\201\257\343*\203@\262G^\345#\335\253:m\275 "
+	.ascii	"]\364\372}\262#@\263\345\330Fe\243]F\305*\331\334\263\277\322"
+	.ascii	"e\006.\331#sZ'K\013\352\254\352\"s\263h\333\213\371C_lk\3346"
+	.ascii	"\230\177|z\236\344\314s\261\363\316\307\316:9>\234\336\233g\236"
+	.ascii	"j\371F\265l\243Z\336]\313\271\235e\234\316\362-g\371^\313*\316"
+	.ascii	"rz\346\271o\226\355\265|\002KE2]\306\264Zs\315\212\252Y\321\324"
+	.ascii	"\263\036O\362\213\375c?\363o2\277\214o\226\344\304O\261\271\006"
+	.ascii	"\bl\256wZ\247\007\321\207=\222\177x:\327\r\270"
+	.string	"\306\034\333\f\330ty\245\033t\234f&\006!\016\261G\362\364\315\256[\372hB\235W]d6c\241L\273Rw\247\217\326\205K\2314 \313'\026\271}\"\330\275\375;\237h\344~\311q\315\374\240\310\036\271\323\351\332\325E\2765\256S/\020\216&\341\326mF\271\203Ie\243\303k\2410\304\307\362,\025R\013F\327\350^\275\375\2650gi\253\375c\033c\370\025\r\270u\255\022\342[\t\301\001\247C\305\275\232v?Y|)\301\230_q\245\005\016\2257c\251\\\273\006\377S\267\327?\255\252\241\271R\032m\364\226\251\346L\230\264\275\330\304\265-\024\023Se\331\230\371\350SL\0041\003R\302!\260\tX\002\270\201\304\220\351H\004P\230D\002\312\367\004\325t\033\n\203\027t(\200\"\234(\344\226\230F8\005\213\206\302\340\223\216\225\024\224Hb\022\002\241\220\236\240\232~NLIM?%!\324O\301"
+	.string	"\016>\001\205\277a0(\374\355\232\353\333\006\247?\232P'U\033y\350\213\315\251\013\373Q\226\322\3464\247\271n\234\306z\330%\364ha\371S\227\323\234\257{'\356M\027\331\364\256o\332\2569rY\033\"U\216\323\273\226\001fT+\223\362\247\353\272\256;\262\003u\035\313n>\315)Nwcqz\343u\333\261,\375i\337s\355\3057{\352\343\314\355iN\325^\363\032k\311\231\2119\226\354\221>\021\200\240Uu\361\326^T\336\353\236\376\300\025\345W\2501$\203\220r\006)EFdFF\264-\006`\002\031:+n\020p8\232\244\220a\f\013$\240\307\312\371A\212I~"
+	.ascii	"\246)\0211\365\023m{\373\271\204\204\210\257\363xz\020\327:b"
+	.ascii	"&B\235b\344$\0362l*{4dO\206}\210\204\312:\034E\240X\247X\003"
+	.ascii	"!aD\241\3077\260\374P\201\336\236_\276V\204\276\375\344G;\244"
+	.ascii	"\316`{\221\301\254\201.\345\200\202!\001\353\210z\002\\\b\021"
+	.ascii	"\3712\2333J\025\"\315\t\332\370\035X`V\307\246\340\202\327\227"
+	.ascii	"\372w6#\301+V\362j\217\2211\257,$7'\240d\241\202OU\321&s\207"
+	.ascii	"T\262\366\326\345O\303\251B\253\217\0329_\347Q\001"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.22.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"6%\202I\320\322(\035R\320k\312\260\235@ \244\024\t\220\220\361\217\266I*\035}\216HT\210\333*\377\0355\251\240v\274\0010\002l\004\227;\205\367+\030\304_m\034\240\304\023\230m\001V\225SL?gt\035\203\020\262\211\334)\005j"
+	.string	"f"
+	.string	"q"
+	.string	"F\t?=\236\300\367\031~\300\367i\230}\3641g\237\273\241\321!\355\256IGX\357\215\367'a\007\277\351\251\204\371;?`\333\321j\261\203\336\311\356\232\324h\274\0052\371\221\244\260\371\fq\317S1\252\331Lj\033\274\322\207\243\036\327]\326\324fR\217{\002\333\017\255fs\t\262\354\256%\255\346\341\016o\033\204\355\026[F\b\273\033S\275\331cL~w\327\212c\227\256\363\207\357\271\301\363\334:\245\245'}"
+	.string	"\037\016\035\005v\273\034vD\266h\3168\361\236\237\307~\316\327\365\300|g:\214\324\310H\260\204\037}\234K\237f\320"
+	.string	"v\236\230pQ\200@\271\234 \273#\312\247W\302\317\227l_\332g\361\026\260\353h\270\200]\034#\241\335QA>\241>\033E3\032s\211\f\325\236\240\222\247\331\304\247F\321Lc\306\r\021\261\303\323\233C\225*\346~\314d\222m\n\017\272"
+	.string	"\016\021\251\330\335\025\031\253\222\030\r$\030\217\001\363}J\005\207\210V\350\370@0\b|\320lg\370\213\225J\316\356:\370\271\013\226o\342\323\026\\\362\264O\337\365}\202*y\320lT\257\327}\n\331\202h\212\310\310\235\006/\221\325\322rAH\275N.*\227\227\023\352\004C\312\345\345\301Kd\265F^\"\253\205\304\250\224\n'\225\230rIh\271V\246\027\325ieB\211.S\212\001\263Z)\321\364b\261DSi\334\177\025\307\336y\350\223\243HFe\240\336\034\3006K:KH\327\250<\312\001\231\311\244{\237\336\034\363\251\226\364\270O!\266\237\231\033\231\334\311y\"\217t\337\370P\016\252\003, 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.ascii	"\013\227\t\246\242\310=$\004\367K\b\276\245\241\r\330w\224\026"
+	.ascii	"\036X@\b\027\200\023H\300m\n\225=\0342\026\364\315\233\353\016"
+	.ascii	"U`\245\274-\205\bV\bb'l\305\031\306h\336\323\321.\306\"\336A"
+	.ascii	"\245\271\276[Os\037\355UW\334i;\031"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.23.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\\\002U\023"
+	.string	"\266\243}H\340\360&\035\333C\302\343f\210\310\223\346\332{\007\242\260X\344\270\304\300\017\241\366/d\177?E=\023\345\200i\343\2167\237\215*\273\23486g\203\031H\026f\\\306\214\003\366/\300\202\024"
+	.string	"\347r GB\310&r\247\024f"
+	.string	"c"
+	.string	"l"
+	.string	";\222|\232\344\373<h\230\235\3641go[\021\363\243cwO:\302zn\274;\t\273\327MN%\314\3379\002\020D\342,v\217\013\331]\220Y\f\247@&;"
+	.string	")l>k\316q#J\267\034 3\016\234\310\214\t\361\266K\231\331\213\324\327>rs$\316l.=\b\273k)\316<\334\337m\323\330\216`\313\225\237B75b\230\\d\223\356nL\225f\2171\371U\034\033\274O\317\315Mi\345\244\245J?\300\267Tt\303"
+	.string	"\321\356LS\217E\232C'\356\363\367\\\332\267\317\302\267\031\374\370\026\260\373\260|a:|\310\310xL\276O\217\027\351>\277\027\350>\355\363\3705\203\237\013L`\357i\371\026\205\027d\333Q\332H0\0323\210T\265S\025\344E?\020\361\2421\333\252\017e"
+	.ascii	"oG:7!U\360v\244\242f\246\"\032\036Ni^\351\244\2066\034/\222\207"
+	.ascii	"m\013\227\261\342\335\214\032\304X\t\210\031\351\004\035\006"
+	.ascii	"K\367)\325\273\031\355\250\371/X\022\330\020mo8\320\212A\316"
+	.ascii	"\356:\370\271\013\226_\342\323\030\\\362\342\247\357RIC\264\341"
+	.ascii	"\364z[\257\220E\241\345\232\220z\241RT)*(\224\020\r\251\024\025"
+	.ascii	"\t\257\220\325\3720J\311\005\224*L\271NZ\256\325IE\205Z\235P"
+	.ascii	"B\327\251\344\200Y\255Txz\261X\341\t\034\367\212\263\363\017"
+	.ascii	"\250\006\311Ee\236\322<\340\303\004u\222\220\226\221I\347vw;"
+	.ascii	"\245\271\245\343\024\324\327>\227n\216`B\310d\223\234\004\344"
+	.ascii	"u\3343:\222\177j\237\240:\246/ P\002A\216\025=\317\030rh\217"
+	.ascii	"\303\2551dE\356[5\036\022\261@\207\276h\006\302\312[,\2732\025"
+	.ascii	"x\365\232m}\265C\307\274\311-\313;\024\212<F\273\303Z\301;\202"
+	.ascii	"\241\007\216\002\312\241\230\203\255\022\032\031\013x\323s\275"
+	.ascii	"\303L5\322\331\240\242\032\304m\213\234\347L \343\271\"\310\f"
+	.ascii	"\217\033\331A\365\\\317\255\233{\267W\265\342N\273\310"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.24.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`7\036\325\\"
+	.ascii	"*\217\314\037Q@PJ\352l]\r(l\355\274\275\352'/\255\002\317\363"
+	.ascii	"\302\334$%[\272\267\252\256\202ve\346\366\250\207\357-rN\356"
+	.ascii	"\345\203\244n\207\244\371\f\355\362\330\270\220\316\330\270\220"
+	.ascii	"\356\027\225\225aCL\334\345\345\375\314\024\263\323\277\264F"
+	.ascii	"\244\334;\245\224\002\330\001\317\001\363\001\3279\304u\006q"
+	.ascii	"\235\211R\347\241\353\374!u\026\272\316A=\347\241u\006\3529\377"
+	.ascii	"Xg\237\353\334\223:{\270\316<\251\363\316u\026^g\035\353\334"
+	.ascii	"\301:\347\\g\034\353\314\341:o\270\3167\3269h\235\201=\347\237"
+	.ascii	"u\366]\347\336u\276\327\331^g\325:\247\326\371U\347n\034\335"
+	.ascii	"\243\004\347\fC\274u\325\021m\263\206Q\265,a\346n2f\3403\177"
+	.ascii	"\300\fd\346\324{\354\3308+2.\307\223;s\207\265\330\007\335\364"
+	.ascii	"\240s\326\265\213\316\205u\035c\342\245^\253<\326;\266\325^\353"
+	.ascii	"\330V\231\231\235\242>\340\251\036CA\307E\242%\2478\327u\214"
+	.ascii	"\370Ez\252\243\240\236\234J\220 61\215XRJB:\022aT\024\002\004"
+	.ascii	"\321\320\007\241\240!\320\217O\217\007\236\035\241N\207\034\034"
+	.ascii	"\016\033n\202\300\237\257"
+	.string	"w\255\232\276Oq\377\256\250:\n\352\211\356\214;\225\230s\022D0\335\364E\n\030gz\363\021KJ0x\361$$6?\022\221\326Fhi^\024\002\313\025\007Qv\346DCW\352C\025\026\\(\250\0051\037\002E\351\037(^\312(\356C\324\343\201\271\304y\340\224`J|\347J\tSH\207\274\224I\\'U\322r\303j\262&\202S\002Iw\304p\321\265\227\022\211wh\346D\301ar@\201\210\221\337@\344F\035\022\f\002\034\322[J\022\262\376g\024\202\257\253\352\272\367yL\356\225J\200\3539\203M\376\256l\330\235#kH\230hK\031\344U\024Y\316\260\347\326\016 \235\302)\353\322\241u]\273\205v\021\256h\370\233)\343\326\246f\245\031vD\253\267\224Bj\330t\r\217\266\337\025\362\306\257\324\272\256\354VW;\232M4s\232\303\314P\314?r\001=Zx\346$(\201e\216\300\203H"
+	.ascii	"\334\201\205\351;\372\247\005\364\301\376cE\r!\316\203\035KE"
+	.ascii	"\r\035~\265\314zA\007\317\205\243\202\326\301\263 a~\277d\243"
+	.ascii	"\305\021}\266\320,\317\367\313~\272\"L\210\364\374\0064K2\317"
+	.ascii	"\tm\241\231\232\373\313\026\226\231\002\247\321\002x\325\206"
+	.ascii	"\231\346UF!\237\030<g\r}\335\302\334(\233\220\331(\373\312\326"
+	.ascii	"G$\2336\334y\214\326G$\032\025\326\225\215\025\027T\006\026\237"
+	.ascii	":\224{M3\273h\347\032\346\3212\277h5G\037\225\032'w\3212\303"
+	.ascii	"h\273\"\317\315\242\206y\327g]\201\230\362\251\376\222[\206!"
+	.ascii	"\n>\023\352\234w:lip\351/\271\250\217\226\305#\215p\246l\216"
+	.ascii	"\206\263\341\256\322)V\247\fT\236\307<F\325GL\262\246<\035w]"
+	.ascii	"\360\006\2209n3\300\250\0347\231\237\2318\356\030|ma\270\305"
+	.ascii	"\364Xx\343\376r\263\274p\303`\2239\272p\263\251y/p\257\245gY"
+	.ascii	"\270\265<\2224n5g\267Zk\340P\341\n7\226n\243m\265\307\300\252"
+	.ascii	"U%\214\271\226\260&\265\025fF\323[W\252\326B\343\302\325\006"
+	.ascii	"\027\233\f\353\272&5Y\265\034\312\314\027\264\231\261\267\256"
+	.ascii	"\253\tn* 81\350%i\225\333\003\333j\177\222\021\302\264\304\232"
+	.ascii	"U\036e\036\243\352\217F\243k\376K\346\376h4\272\306\337\305\334"
+	.ascii	"c\335,\272\331]\200\317Y\312\347<\200\317y\005;\013p\235UX\347"
+	.ascii	"\024\326\031\205u\016\340:\237H\235\001\270\316&R\347\250\353"
+	.ascii	"\f\325s~\262\316N=\347\022\326\231\304u&\246\316M\327\231)u\036"
+	.ascii	"a\235\227\254\263\322uN\272\316H\327\371\310:\213\260\316F\326"
+	.ascii	"\271(\317L@\001\336V=?d\343\251\230\347=|\272\226\204V\271p\347"
+	.ascii	"\221\347\243\346\232;\337XP\314\222P\341\032\235\027\336\351"
+	.ascii	"\274Z\2466\201\333\315\320!M\316w\250\313y\337\227\032X\323\255"
+	.ascii	"\203iQ\210\316`\361\211\222\340c\350\246\215\266\214\331\007"
+	.ascii	"\026\217#w\304\371\2134k\353`\032\tB\277\364\3221\030\207\\R"
+	.ascii	"\234wA\277d\016\037\374\336*\233\203\343\360\300/)`\315\ran~"
+	.ascii	"\303\227\233W\311\242O\013\334\r\206`\233\253\320\300\017v)\276"
+	.ascii	"\317+\n\326\344\322\335B7\216+5\f\177\311\376\323^\372\211\215"
+	.ascii	"Ow\351\025/\002\363\212_3\036\031\001R\345\321\024\350\227\356"
+	.ascii	"B\312\334\370\371.\337?\221\037qefh\350-E-xN\003<\313\321\016"
+	.ascii	"\217y\367{\346\003\\\r\201:+\273\336\377\276\233(I\223\204\372"
+	.ascii	"\2369\001G+\n\245yVv\367}\337L%d\222\320*\217\246N\\\330\341"
+	.ascii	"s\305\270u\347\354\371%[1n\245q\336QiQ\244%\r\363\256\257\330"
+	.ascii	"\312<"
+	.string	"\374\222\325\023>\360\234\213I\r\236h\037m\357[\256lN\001'\353\375\325R\367l\356\214\3219\357l\033\325\017\341\321\336o\257\262/\314\013\270\230\207\201\340l\240\247\035\260\255\336o\262>\252\242\363\252Z\242\323E\233>\222\217'\366\301\216\352\333O\247$}\274\360'G\365U29\260&\213g\346\016\334\3111\250\314\272\256'\230\037\360&\020\264\312C\234\033\222\276W\321\250L[\331u\321\376\247\257\276\331\320Bz\224\231a\370\222\342\277\317k\314\263\271\245\203WztH\341\213s\253\205g\317\234\254F\362\306<\241\205g4\340\374RH\033\351\342\354\352\237\033\207\"\354?\300\226\354XJ\270\302\344L\340\302t\241\203g]6\3742\007\021\243\017N\215\251l\341Y\224\233\036\202\346\f/\232\003\0311\030\330`\206\361\362\213\246\f\\\\ \003\306\214\026\033\3140\0225\270\300\205\221\370B\306\fb\323\220cl"
+	.string	"C\006\221\203\0301d\020\201ck\247\353w\261\2353b\246\326\353\236\262qofj\317=e\005`\001\236\245\252\036\271\256\353\032E\246+\r\312\347\306t\241=\251\210S\361\227\006\226\347\231\016ja\342D'\246\213\n\263D\212G\001&\305\003\233Ly6q\374\233\033\n/\001<\n\266b"
+	.ascii	"\357k\"\345y\202K\324\003p\302\304\003\260\305D\3247V\2252j$"
+	.ascii	"\232\232\256\243\2160\365\\KIe\031\032\021\177\351MN\377G\210"
+	.ascii	"\244Q\033\362\310cB\241\r\337\256\220A=\220\253\315\363\311\312"
+	.ascii	"\020\315\214\354\351\201\3106`M\247\237R\034\276Y\331\225x\247"
+	.ascii	"\3572\262\236\022\337Rz\211\013\217\251hI\260@\342/r\315\223"
+	.ascii	"(6\342\233\210L\337\004\205i\3047V\223L\022z\344\231\377d\351"
+	.ascii	"\235(\375\322\177)\275\357K\315sL\007\325\326F<\2234\314\245"
+	.ascii	"_\202\206\251\224\224B\322_d\335\023\351\221\034=\322\0339z\265"
+	.ascii	"\254\016\256\203j_Iq_D\016I\304\033\375\262(\342\201_S+<\327"
+	.ascii	"o\031}\tEo\364Z\305\242\367}\215\001k\206\370! >\304\0139\202"
+	.ascii	"\370\217\241\215\350\2018\233\026\372!\242\017?\364=>\b}c\205"
+	.ascii	"\231%\241`\322\242GF\035\327Ql\212:L\0170\300\363\020\361I\306"
+	.ascii	"\260\030\001\375/\311:\363WE\241-n\316\273\240g6\340u\034\363"
+	.ascii	"\234|\216c\320\003\343\334\300\232\303\027\341\311\337\030>\260"
+	.ascii	"\254\313\263\t\364\311\237\007\372\016\203\202\227\204\026}\215"
+	.ascii	"8.\314\020\b\330\237)\260\257B\340\251"
+	.ascii	"@pNE\371\351)1\333\352\317wY\037q\255=\233 ~\311\267\213\326"
+	.ascii	"\007Z\364\371\213|\341\331\354\3716G\236)VvC"
+	.string	"\336k\315kv\347=\004\2023\250\222hA\020S\244JDD\222\202$Y\306\222\f\2101R:+\327\003\022`\002Y\f\351@\320AD\002\t\b\215\224\224\244Y\003\217\304J\206M\211l\365\r\341\315\366\263\232\232\322\231\bN\230\212\301%\3149'\204\272\256\333\261\2027\237\370\324+1=\003\215\036\310\221~u\247\252e61h\025v\212\232x\003\006n\3333\326\031\214\204\251\226M4G\362\246\265'\252}\320 \320\223j\260\200S\332P&[\347\310.\035C2\356\350T\320IU\251\206\324>\207\336&r\"@6\202a\"m\317\332>\214x\"k\371\330\002\331`\200:;^\023T\222\316\353\320\202G\225\026`\320\212/\321\354\267\326\n\347\376\201\211\250=\303e\030\013\270u\326i\335\265[\3328@r\314\255o\301b\217-\373xF\32316}O\b*Xx\017\316\203\334\356\240\235\227bL\360a"
+	.string	")\322]\277Ig\247\026<\\j\246i\2123\260KT,\224(\353n8I\3309\026a\\\223"
+	.string	"\0330\\\335\314\277\213\333\366m\202U\320O\3473\363[\224\344. \272\276\374\241\206\217n{pI\007\327k%\217b|\307\244eHX/x\205\331\300\013-6\340\241\214M\365\b"
+	.ascii	"\016\332\372R\364z\302ib\223N\272\003\034?1\2563\334D#\277I\351"
+	.ascii	"\024\200\353\203\242x\355\213\352c\237`G\302\251*\261\\&uOm\036"
+	.ascii	"A\267q\375\214D\360\341\337\344\237Nso\275\373\027\355\314`\024"
+	.ascii	"\022/\245\371\272\200\334g,\337e\312\005#\b5C\024\321\322\206"
+	.ascii	"^\253\335\335@\242\213\023\027$\023U\367\3114\243ovFs\234Po\177"
+	.ascii	"#f\317\313uD\215@\360\207\326}\221`\301Cy(\210\326\235\365\225"
+	.ascii	"ZVK\313q\225\262\006\243\t\345\247\3154 \312\2249\b\030V\321"
+	.ascii	"\037\272\320:-fCR}\253\220\364\361\240\001\001zr/\376\3201\003"
+	.ascii	"q\351\2054-\327\003\243\230\2305\0377\217\001 \254\374{\2024"
+	.ascii	"\310\013\214\332\367\324\034\221\255\352\234~\247\204g\347\177"
+	.ascii	"\273:k\273Nf\375\206\260T\353%\276\035\246\001Q,Pes\227\310\324"
+	.ascii	"\246\036\372\034\021\325\351\205}\203r}\303t\360"
+	.string	"\311P\277.\021<s*\210\214\004\007)\302\246v\347\235\200G\301\247E\245@`\275\366\271\310\233;v\002<s\207\372=\245\306q\331f].@\026t#\316\211\2601y\263\n\222p\367k\032\322CT\321(N\301\031'\320\251\0344\300R\254\255\236N p\216\242\332\256\354\320\345\210\022M\245~\240\240\251\\\3435\037\nY\234\201~\320],\244s\244\\\202S>o\002\031T\307\353X\372\376\3301\372\241}\207T\001\240\307\335kiPm8\366}\332\266\267\221&\034\363}X\0139\257\331\361|\354\352\246\312H\235\314\227\224A\1774\363\034V#\234h\232\004BJ\260\226?\323\b\243\017\267\267\346\301@\231H\017\327\270\301~\366\26793\226\201\3101\241_{\242w\233y\344\340\300\217\033\237e\220\b\031\023l\375\3064c\263\277\367F\313\244\335\244jf\366\222\232+\236\333\017\307\034\221\"\327\013\312\353"
+	.ascii	"\203$\350\200\333\t\264\326\316\235\322\177^\244\364N\355\321"
+	.ascii	"\262\216\226/\256ua \003\002\313(\234\325\2348\b\272\224I\n\333"
+	.ascii	"\337Jm#\364\030\366\316CD0\310\2333\024\202l\271\342Y{\201C<"
+	.ascii	"J%\230\272\323\3517\265S\373\017\001"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.25.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\203\001\255\017"
+	.string	"\006\036jF\360\256*\035\200L\030\366R\017\237\255\351\234\3766\242e\036\312\006\b\026\252w\362\026\370\352L\252\331\216v\234\351{\2341\250Y\306\023\304R7\221\215\301\223\001\335f\302\361F\343U\216`\241\225\377C\020\331[\312\224\002V"
+	.string	"T"
+	.string	"T"
+	.ascii	"\346\350.\023,HYu0\006\343Xp9\251\305\230\023\364\226\2037a\030"
+	.ascii	"\206\217\340\035Uu\031WU>\250\204\t\327Gr\0317-X\007\215\257"
+	.ascii	"\025A530\257]_\337J\343\207\224\357k\217!n4\256/\345\272y0\347"
+	.ascii	"\264\272>\224\233\273m\224\355\006\366m\001\277<\355\216\007"
+	.ascii	"\357\325\313\356\003\b\360B\005\204\026s\302B\031SF\302x\260"
+	.ascii	"\235\262;\266\225\304g\251\323\034\0237&KC\354e\316\331a\006"
+	.ascii	"\335\245\201\270j_\304G\244\016\216\020\330\230\254\331\005\005"
+	.ascii	"\340\007p\227\335\005p\227V\275L\345\235s\005\305\313\234`G\217"
+	.ascii	"\373\226Y\n\226\326\370\363\270\335:\270\321\230\254\3049\347"
+	.ascii	"\214\356\254\256g5\346\004\303m\025D:\027\177\204\273\354\254"
+	.ascii	"\256xe(\321\320\b\276\313Y\324-4\001\261\322pm'Z\337.\213\r\222"
+	.ascii	"((V3\343\335`{\242\272s\360\346t\247\375\233\203?wY \243\217"
+	.ascii	"\r\241B\022\"I\344DA4\232 \352,\372|\204<L\243S\204\220\023\311"
+	.ascii	"\003\361\b\221<\221\351\344}\n\270\02422y\250R\311\344u\300\371"
+	.ascii	"\030u\277\257\325@q!S\262+\271,~\355\335\f\025\026\333m6\036"
+	.ascii	"hY\016\267\273\257\327.U`\254g\035U\256\356\313\2669\002  \240"
+	.ascii	"\002\2413\356\377\030\346\321\356\004\270f>\326r\265\352\027"
+	.ascii	"cp$\210\205LEA\370\266\323\367\311\034h\311r\353\235'C\336m\004"
+	.ascii	"2\214\220\305\032F\023Z8h\2045j\236\335\307^\236Ev1\007\\\007"
+	.ascii	"&b\272\326\023"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.26.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\250\003\025\027"
+	.string	"\006\253\225G\260XQ:\360\305\370'r\334c\022\327\356\271\345\301\332\257\262\352K\313w\264\221\001\204\301\303lt/\332)+\262M\356\255Xr}\335>\030y<\031\371Z\234\272\254 q\247\366c\264\251h\237\377\353\222O6\2212\245\200"
+	.string	"x"
+	.string	"\201"
+	.string	"D@\325\314\275@a4\347\264q\001\325\301\341\327\272\332\357=\307\355\276\016_\315\371s\304hN\237\215k\304K\373D\333\276\215\337\270\331D@\237\214])\004\016\020<\256\3149[4\207\t/\301\277\204\227\033\343\267Kp\365\346\343.\021\004\371\351v'\016\202\003X\034\371"
+	.string	"\330\345@\030\244\027PN;\017\272\247]\016\244\231s\276\350:b\327\243ZZ0\347\264\352v&\356\360\266'\330\256`/R\366\301\271?\366\177\3743\357\361\313\\\307\037s\337\037\340D7\353C\377\352B\277\352;\376\324\252QR}\222j\027\2516I\265(\325\245U\207%\265\224j0T\257T\353\252/\340\305\b\311\201\2259I\374\262L%r\b\215\023\375\366\315/\362\3116\321\006\021WB\364\341\004\310\2249g\315\245\037\210C\274\025\016~\360\020\321@\350\210\202\036\034bT3\027$\224`\365;\034T\242"
+	.ascii	"\365XZZ\233\302\215^\347\223\221\322\226|\240$\365xV\006\226"
+	.ascii	")B\300\345\2616\334\205"
+	.string	"\021t$7\3340\n\210-)\005\327\206\305\364:\271\257R\344EN\256sN\334\326\302\335\nAOr\212\305(\325\265u.\350u\273\006Z\344\026g[\366!\032\3049\347\001_H\004\2328\243Cx\251{\362i\002\324\343\321\237W\373e\355\265\2506\265\337\027]\326\030J\362\201E\217\376l\037N\227\02796\013\263\230+&{\215\f0\274l4\233j\026s\301FX\b\033a;\213\271J/\333\013\007\234\305\\#NN8\342\344\354NM\266\206\021\300\360\322\031c\265\233\235\232\2545\323y\311Z\260\261\326\"0c\332Nll\331h\264\261\345\233\007\347\3768\203\212- \313\344\"\005\222\2559jE\330F\255\027\360l\217\\\236\236\326\206p\223crJZ\355\314\272,qYIE\n\220je\326\224\304\224\004\243\251\215Yqm\t\023>\034\211+\003C\250Ad\205\004\310\030$\221H \"m\2129"
+	.string	"\003\021\241Z\007\021`)\205\244D\022%\205\007\003J\236\362\300$\333\211\021\2034$@\326\224 \205n\324\266a\304tg*x^\0215\346&\024j5\342\336\265\241\034\2253y\243d\326"
+	.ascii	"B\222\016A\204\217\201\373o1\0047\223\330\331y\033t\344z\256"
+	.ascii	"\024{\203n\314\003\036\203\267\n%A\365\242\2655\335\267\312s"
+	.ascii	"D\324\033\305\002\316\036$9\025\241Xb\206\271\035\220\n"
+	.text
+	.section	.gnu.lto_mspSerialEncode.27.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\305\r\rB"
+	.string	"Zn(\030=@\350M\007\310#a\251mK1\2124K\3517\241\305\033\030\013\3636\017x\372\3707\t\222\260T"
+	.ascii	"\314\360;\275\007U\214*\031hR\204\316\341\220K\264FMDDh\223\275"
+	.ascii	"wJ)\005k\001U\001v\001A\347\266a\240\255\020\nB\3676\371\323"
+	.ascii	"t\365T?d\372\256\233Nw\235\356;\335{\272\375t\3275\353,s\343"
+	.ascii	"u\240\273;\215\336\274\330\2062\017\231\333\216y\330\3523\267"
+	.ascii	"\334sm\247\3614\237\376\323O\036\326\375\230\333{\224\203\355"
+	.ascii	"\323tm\373Q\356A\272\301\266\332\027\331yZO\333{\302\222K\344"
+	.ascii	"e&\211\324voY\f\266U\2443\005\254\266\357\210\261\267\r8\307"
+	.ascii	"v\211\357\336\270\024u\370\231d\"/\223\315\257m\004\035~\262"
+	.ascii	"\3132\226\016\033&\276{/U\253\334\201}\3579CR\344en9\253\340"
+	.ascii	"q\212\370]\26537\\\303i;\316H;\335\313\205O\237{\343$0\025\333"
+	.ascii	"*\307\261\314\314\335\246\335\264\314\3174n\315\f\230\204QS\356"
+	.ascii	"\322\275\367*\331Ok\253i\007X[}/\335\266\023\362h,\022\207\302"
+	.ascii	" \013\\\325\364\275\345^\266\023pI\023IZ\234\2605\362\230F\340"
+	.ascii	"\243\253\324\206\312\330\322\247&c\234m\246\f\315\215E\"\226"
+	.ascii	"\036^I\223\201z\312L\231\025\027\266\241\26233eU<\370\354)-N"
+	.ascii	"\326\232\235\002\0029hq2\245W\243Y\323\216\314UCeT\322\344\275"
+	.ascii	"\027\211\247O\372\323\bgyO\214fG\322\247B[\034\365\263]\211\031"
+	.ascii	"\323\035\310\341\336\313\3564s\322\f\240\231{\212\231\2130\027"
+	.ascii	"\245\002\352{\242f\224?4\245\364\333\256\037\310\315y\273\367"
+	.ascii	".\325Wc\177\r-\265\206a\201\344S-\2656x%\334C\326"
+	.string	"\tO\300\213\245\006\037\2342\346\177i\372j\316q\313v:J\205\322\376\271p\213X\377\203\310\331c:&f\006\321\220D\374k\330\203\363\357G\316\2761\377k\257t#\022\354\275\314,\356\275fT\"\375:\261\266\363\304W\355\371a\320R+3O\350?R\234\305NJ\341\033\270\0175\242\024\334a\270\377\254\340v\266\372\275\242\316\322\033\037\224\3673\273\200\341\355\264\372$\363\227\314\255\327\025\345d\226\321\204h\260\367\336\n\203\332\265\032X\213\302\024Y[\355\357g\247}{\"9\243\214\371\037s\334\322_\215\271\323\373\\\230\213\3164:\256[\306\213\026(N\224 \021\242\357\2323`\350;\315Y=\247{B\3275[u\234n\252\242\263\003\241s\203\246\323\314`\201\202\256\323<etN\026\235\023\030\235\021 \235\245\210\316QD\347\003Cg\003B\347\002Eg\002E\347\001Fg\250\242\363S\321Y\200\3219"
+	.string	"\321\031"
+	.string	"\321\331i\350\214\024:\037\205\316F\242s\361\350L<:\017\213\316B\243s\260\350\314\n\235\201D\347U\350\254\016\235\323\241\363\013\235=\025\274\237j\267PVv3[\334\346e\304X\225\322R\361v\206x()m\364\232\277d"
+	.ascii	"V\\L\2306\355\b\340g\b\2026\243NX\374K\353\306\326\246\035=\221"
+	.ascii	"\263\017\371N\337\356E\004\362\201r\216\374\340\306\374\217\217"
+	.ascii	"h\256&\266\305\271\264i\307\265-\224Z5O\023;>0\221\2437\270\242"
+	.ascii	"\021\355\314\230\366\345)jF\211\305+U\334\212\260\333\267\342"
+	.ascii	"\013\311\203\372\024\227\202\327\017\240 \2724\211*\316\034\240"
+	.ascii	"!\246\316\360Qb,"
+	.string	"9\024\177\"'h\315$\342gx\027\324\214\256\255\265\016\237\370Mvvd\370\035\250CD\301\343\323\2142\024I\2236\341\253q\243\211\361\022|5n\273\016\246\241E\201jC;X\246\314\240\025\370\242\252\371\210\035\027\335{\263\200juoS \270\325\007_\370/Z\274\260\312\233\255\005\343\355\f>\226\035\034=\b\316~C]\311\n\2505O\342N%[\255\335{\371\321\332*U3\267d\3322\336\316\026\237$\373%\033i~\256S\317~\214;KdgGX\340;\022g\002\323\276;h3\n|5f^\317\370X\353\346\327\227\255\032\250Ej\267oV\277\276\220\273\271f\264\377Zlen\333\364&M-\234\247\206\366\003(s\227&\365\372j\321\376\261Z}T\0302r\006\251\317\334\276i?1K}\251\205s\\\353\340\354K?\\Dv\260\300\241\365\325c\210\226\212\tA\212^\\&\264\200h\341"
+	.ascii	"\346\b\363\220#\314CW\230\222\307\026\227\216-\326\213\313\004"
+	.ascii	"\030\016\035\253\027\227\211-\260\255\325\353k\207\022\214\353"
+	.ascii	"\205\017e\227\020\b\027\217--\037\253\017e\327\363\226U\017\255"
+	.ascii	"\035`\\\312\033>\224]W^;\264\272\256\266\300\224W"
+	.string	"VQ\374\345\203\013\354\n\310\327\027\330\3250\356\366s\341\037tQ$\215`\032\035\234\221\252\035\260\203g\016c\177\204\303\224\351\275Z6<\333\211/\216\377\261S^\253td\307\252\356@\255\276\261+\372\233\033\023\266\252\031\274\222\316\353`\032\034&G\226\213\n\236Sv\352\027\274\022\346\013\316\340\333\256\355~\301\237\025\016\326d,i\233x;i<\360\311\255\362\313d\247\251\202\366L\022E\021!1t\231\363&\365\b>\001\206\254O\200\340\333-\213\325K\375\215L\315\250\237i\366\347\026\327e=\224\224MQt}\242~\006!E\007\366\264nz\f\374\001<\006\036(\267\251\200\2359\257\363rb\005\276\363\372A\242Mop\026\364\"\2359:\2316\275\206\211\257\2171P\007\323\334\242D!^\007\313\250\211\016\211\nPH\250\344W\325\215\327|Z3\254E\004\036\305\211'\3606\0165\243P?\340D\211\037"
+	.string	"\365XP\350\3237\236\267aS\302\311Z\301?}\214AP\022\221\374\246TpG\323\303\017\360\002\236\304'C\274\200"
+	.string	"/A\312\033=\346/9\201\027\250\2210\346\020C\246FDD\222$\3110\006Q\005\304 F!\342\r\021`\2454\310fD$)HR\032\016"
+	.string	"9\355T\237sS\304\037\016\315!o\260\tR7VZ5\357\207U{4j\227\227\3526\322JR\243\204|\274t^\210`\224:>\254\271dnZZg\301\351(AEy\272\230\324\016$\005#\030\343\260\316\306\022\177\246\347\350n[\225\374&\244cM\355\337\325.\027\313c\230nT\213\266\315Ve\303|\307\372\024[q6p8^*\361\032\277\273o\256\232\243\377\277\202\246\341\020"
+	.string	"\257\0356\343\350&\312\210\316\r\252[J\026\027\036\264k\304\354h\232\323\316\201\372\373\271\fg\260\255\312\256Y\302<\270\313\357\342\3747\301\322\036Qtl\250\\\227\tH\227\375\223\177\036C\007\261\352\036\300\230MT\3246\336,\321f2\n\032\273\312v\344\004\"\0340p\016"
+	.ascii	"\003\202`fQ\"1\306\214V\340\350LXK2\253\\\300\346G\311\223}\364"
+	.ascii	"\375\2615\321\367\210\334P\231\234\327f!\365\327\027\317\350"
+	.ascii	"\250m\256H\001\321\234\340\370\345P>V5q\227\321\320\376\204\302"
+	.ascii	"8\232\034\225\233\247\235I!\255C\364\2141\312\214BQ\024u\333"
+	.ascii	"f\002\345a\013F=\034\332\313_K;f{R\024\303\213d:\302\371\036"
+	.ascii	"Q\007\233\254\314\0223\244\2279\346H\234\027\335\031\263\311"
+	.ascii	"V\252\276\363\364\336\003C\341\322\326CT\016\205\2311\t\005\247"
+	.ascii	"N8\201X~\204\205\025\370\013\250\207\220\330m\353e\203\371\275"
+	.ascii	"\024\r\225,aG\216\277h\255\240\231!)\022\240\215\022\307S\321"
+	.ascii	"\250\214"
+	.string	"8~\367\220\r\237\304\314\362tk\3351x|f\275\232;\262\242\376 \026\303;\\)\371\254\316g\214\216\235\f\246KY\361\357\262!\3421z\265P\302\327\274\373\035\276\001\214+\tD\024\037\347$_\001&\235t\350\230\305\334u2U\232\340\263\300\236\016\365b\241"
+	.ascii	"\301\231\260\366\032?{\326u\022v\n\251\310\272\236Do\257[\245"
+	.ascii	"-\370&k\204\310\023m<\2258\332\220Ly\0245"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.29.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\343\004e\036"
+	.string	"6\264\272I\220\330Q:\304\24429C#\271\327&6\243\355\263\364\243#=\321~d\341#\257q\242\246\245\017|I\235\354\213\251\232J>\231\355\330\333\212`\215Pr2\300'c\006jG\252L\217\353\241\tr\210\025\204\210%\233\354\235d\240"
+	.string	"\232"
+	.string	"\254"
+	.string	"M\356$\351\\H\357\246`\220T\225Yw\020\205\371\373t\247\210\222\035\2256\224\257,\005\013Z\362\254\244k\271\2501\245-TQ\326\344\352\254\273\177~\031\310\374\255\221\327)m\372\302h\253\365X0vr\232)\353\t\254;}\300?\346/3\363\221\374*\211\321\235\224\bE`\206\r'&g\335\251\215\323\033(\177\315\353\224\277\366\307\321\223\266\242\374\037OV\211\331\002\n\177'i\334\222\r\314\236\230\031 d\"\r<\t\001\376\370*C\270T+\rCws\005\n\241\316\367\314\034\304\314,\230\357\202\374*\277\202\223P\354\n\277Vj\301s\230\211O!\001\246\r\360Q\204hC)U\335J\007\362\237\034\312\t~\020\241z\340/_\250\034\372\027\217o\314\271\037u|\373\275\303\257\254/\\C\245\332\2069\375U\353\203\371d\333\036\314\\\331\347Z\347\236\247?\317\261\376\002\002*\2338\225i7\225\313"
+	.ascii	"\225/\200\312\244Y\331\322*\327\262\362\023<,x6\246\350L\367"
+	.ascii	"S\0335-v\241L]\353/\376\\\177\327I\346$>\223o\335\370#\337t!"
+	.ascii	"\221\035\225\323-\205cHwP\027[(\221\343\275nD\215\2304\313<\266"
+	.ascii	"\307\326\234\354\357\310\317\240V\n\210\024\306h\266\003U\217"
+	.ascii	"\033I\260\320\362\305\323\206]\252\312\034Ai\304\225\326\210"
+	.ascii	"\343\033\222\217\301\225\366R\321\262\345\306k\215%\370F\332"
+	.ascii	"k\357\304F\tMr1\250\022\322^*-VX\326\222U{km\271\246\251\310"
+	.ascii	"\022g8\030 \263Z\002\305,h\260,\363\320\277\030\311\266\200d"
+	.ascii	"\274\234\007\306\272[\303\273p0\273\373\306%\205\007\037b\020"
+	.ascii	"\030\345\357\255\217\354\0138\274\330\231? (\231A\374\210\343"
+	.ascii	"\020&z\236\222y\304\217%\370v\207_ge\260\360&\0209/Z\364\210"
+	.ascii	"|WG3\332pt\362rN"
+	.string	"\244\243\334\321Y\032mXa\224\333\355x@\347I\244\343\371D\364\316\235N\357\334Y\326Ah\221+\362\021\235C\275sg3*\312\355l:\337i\203p\200y=\"\237\355\210\307\363\331n\322>\373\330\232\222]b\264\310\205Dv\357\270\360\256\337lI\361>\326\026\313\254\242\310\b\325\264\005,3\252\003\345Qk\362Q\227\320\0378c\016L\313CU\344\247r\375\tY0\222\343\306U\355{\235\r\n\004gl\001\021\225B\247\352\201\214\023VC,\206\375\235\230\306\f\314\262\213\262\307\356PMe\205a\252i\230A\275\327\003h\250Q8h\030BJ\221\320\004IR\220B\007\200\002\221\241\244\036\020P\247h\f\222\346eO\242A\344\257\377CDH\236\330s\034\224\f\3613D>UY\256`\322(\306\203\345fO\272M\035\333J\2149+\273\324ne\241\2535\324\320!\254DVBh\207t\244\265f\240\371"
+	.ascii	"\036\026C\235\272\002\031\212\240`\013\353\241\232\030\tV\306"
+	.ascii	"#U*\357wx\376\360\022\n\237\242\021U\007\326\222\360E,\0206C"
+	.ascii	"X'\201zE\265\257(\360\257A\257&\340%\354\206$F\301\306\235\314"
+	.ascii	"\232R[\266\020-Z[1\255\303\315\241\261jb\210\3475\244\177\316"
+	.ascii	"\220\016\326d0b\260\267~}8\311i5\023\235YM\017\245\302\254v\024"
+	.ascii	"\034\250\200\330\246\262\330_\320-\337\002\213\203xS-\3659\005"
+	.ascii	"-5"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.30.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`H\001U\016"
+	.string	"6\032`E\020s\223\016\230)\2131'n\035\245gP\341X<\302\205\254\353\300\341\315\351\366\245\340\224\212\242\326u\226\205(\326\025\310B'\002\3178\223\036F@\004\020gp\341\257\260O\013\300\201`\304\353\330\244\355\275\367N)K"
+	.string	"H"
+	.string	"L"
+	.string	"\247\366l\231\203+\273Qq#\304K\315\356^2\305\275W:e\364\374\267\234S\372<\274\232NAt\276\017q\002\370L\227S\201\n\016\023\002>\322\034\2119\371x\313\343\210o\024\343&\302\356:\226\276\022\367\346\2661\333\020\354\237\b\227a\030\206\226(\373\252\237\036\374\347\214\276u"
+	.string	"H\214\306c\227DXdW\024\206\205\355wl\313h7x\340\035D\371\200\035\351\020\341\340\321\376\213\303\360\256J9\201]T\216\032\273 \003/\260N\r~\244\236Z/P\003S\246\236U\373\302gd\326\356\232\3702B\031\f\254\260\244\324S\216\351\207\013\232\257(\251\254\244Ly\312K\022\227\036\244H\304\266\366\227\315\332%\231\370.\217\301\301g9uw\022_:\251\247\227\234\0352CT\242\030\332\340(\312\224\035\234\007\203\004\013X\207\f\373`\\\200\020\267M"
+	.string	"u\332\306\237\022\r\236\214\303\272\n\240N\2736d\036\355\372p\335U\202\300\033\b\343\256\320\266qW\007\024}\256DQ\b\262\022\311\321\334\335\255\221\006M\215gfN0T\246\234\340(uJ\222\026\247hCH\f\212\035"
+	.ascii	"\357b\314\304{|4(\034\004\r\002!\220\035\026<\200\305^\324\351"
+	.ascii	"\"N\013\007\2746O\263e\212\335\313\304:Nx\016|\2139,+.\274Qa"
+	.ascii	"\\0\"@E\001\356\310\323&\203\240\035H\361\263\351\032\202\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.31.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`y\002\205\023"
+	.string	"&#}G\320\224\321p\271I\232\201\207cb\235\t\211\034\326B\232\241DK\020q\242\220\004\265U _2\360\003\301b\330\247\025\332aT\253\205\314\210b\256\342\001\256\320c\244\216Y;=\344\004C\256\2208 \261\367\336[\312\224\002n"
+	.string	"_"
+	.string	"k"
+	.ascii	"\341A\303\354\247\353L\254\030\304\243\3158\262\273*-q\330G1"
+	.ascii	"\004?M\230\037\373\030\240G<\321U T\204\264\022[M\210rB\t\205"
+	.ascii	"\021\374\204\330Q0\f\212*\362s\263\363\357[\300\323\003\347\304"
+	.ascii	"\346\341Ci\"A$e\233\245~\007n=P'6\331\267\302cG;\321\363\203"
+	.ascii	"m\226)\266\354\256\263f\273\271\001\334v\216m\007v\342\002\257"
+	.ascii	"qw\037\37000p\030\201\016\3723\341\301\353\211\236 '\n*G\223"
+	.ascii	"=[\027K\305\331\327^\257\327\263\336\354\347\376\222/\035f\032"
+	.ascii	"\324\364\247i\325tf\372'*KM\255\037\2736=$\273\003w\244H\331"
+	.ascii	"~\332\177\361!\330s3\037\260{\033\222\264\253k`\006\343A\353"
+	.ascii	"\216\022\036\034O I\276\216\024!\264>9\374#?\215\007\235\265"
+	.ascii	"\265\251\t\331\277a\373IT\332\331\215\235'k\253 \3453\313\250"
+	.ascii	"\032/P\301\0252\240p9,h\300\\r2\212\372\200|\025~\252\271\"\037"
+	.ascii	"\263\344\351\247\006\202\324\b\311|\3414V\252?r*I\233\325\312"
+	.ascii	"\327Ro\304G\246\261\2377\242g\244~\205W\013EN\263\344\331\336"
+	.ascii	"\360\030\0012\256V\204\230\027K\364\013K\006\227\225\013\346"
+	.ascii	"U!\346\305RiX\271\260T/\256\227\212%\305\255\030\030\227J\246"
+	.ascii	"\325r\251R\272\375\267zK\225\3716\356\226oww,\220\241\332\022"
+	.ascii	"&\254\330\024\256\324\301DH\212\220PU\007\251\305\221\236L.D"
+	.ascii	"\001\351\273\204\366\013L\276f\023&\235\335Lc>\216\253\340\354"
+	.ascii	"b\231\004\002m\b(T\234\0374 `\002\2219y\007?1\006\343\271\027"
+	.ascii	"\315\343+\003\020\224\276Hm\342\272\345\244*8\316,\254j\253\273"
+	.ascii	"\307\237\2439\256Ky\331i~:\203\313\305\035\230rogc\351\355\305"
+	.ascii	"\314\360\320t\255\026\217x\211m Q\372\013\330\2424}\036\301\003"
+	.ascii	"\006\272\312\265O\035\\\330`\005\004\326\331\315\032]p\255]\315"
+	.ascii	"t\264\370\022\277\312\001^\0334\361\224j\017\007\222\235\255"
+	.ascii	".Y\240Q"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.32.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\313\001\215\020"
+	.string	"\006\337mG\340\322&\035J\033-\230\320X^2`*m\224.x\304\371x\330\364\225\277\f\244\276\263\230\216\376\364\030\034\216\320\025\210\323_GX\242\267\002!\020\203CA\365\217\330\016\313_DC\240NJ\f\235\213\244\221M\344N)T"
+	.string	"T"
+	.string	"]"
+	.string	"$\237V\260}~D\212,#\245\215\341\201q\227\366O\034\305\353:-\027\331\265\021r\261+\"0\311\366i\361\001\264\317\355"
+	.string	"\264O\277l\241\213\260\035\305b3\343\216\335\345\364\346\257\313\227\377\361 a\215\313\345(\301\356Z\2065\034n\275\355\003\266Ol)!*\037\307\037U\374\360\263t\226\3669?\320\3401\364\"\213l\321E\352\b\373\331\356\256\325\306\276\370\223\256\363o\233\364\034Ig\232\264Ni\231I\277d"
+	.ascii	"\204\r\026\237\335\rE=6h\302\210\275\347\267\377\321!\376\316"
+	.ascii	"y^\357q}eh\030\304r\206vi\002v\203\217\017l\312t\352g~\274@\270"
+	.ascii	"\214\b\231\316\022@\252\366\204\307\220zUU\0372$`\\\341/,lRA"
+	.ascii	"|j\344\350\\\355\013\377\001m\262O\037Q6}\246\020\375\2049\374"
+	.ascii	"\026\032\004\300B;u\026\335\266\273\246\025+\030\006\340\300"
+	.ascii	"i\321>\257\024\210\200B\017*i\342\373\\E\256\225\327}s\345\304"
+	.ascii	"\265\362\272\024\020\354R\255\317\201\007\262D<\220\245N\225"
+	.ascii	"\254P\252\257\003O\036\310\342VT(\026\227\372@\256\244\200[^"
+	.ascii	"\367q\031Z\255\217\013\021\367\331\252\215O!\202^\024\306\256"
+	.ascii	"lW\204\311\320\016\212f/\370\f\024\022l\336\3340\241\203\200"
+	.ascii	"|\212\217*\033I-\201:\004\305\250\213\247\006$ `\202!eh\007\257"
+	.ascii	"\030s<\251\302\325M\374\314\005v\367r\025\033\247\236\372\301"
+	.ascii	"\362F\006sR\274\213\320k\007\023\245~p\250\363\005t\273\021\335"
+	.ascii	"\004\334\241\271\220\2614z\337KVlY\377\223\327\027\016M\301:"
+	.ascii	"\307\226\207\217!a\224\370\021\001\033\005ty\321>2"
+	.text
+	.section	.gnu.lto_mspSerialProcessStream.33.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`*\006\345&"
+	.string	"zF\224\017E`\336Q:\277\337\203\354\341Lp\325\255?\372Z\354\320\261\314\266\312\006\353k\2568\351M\267K\314A\3771\260{\177\212>m\007\207O\272\213\026\2428\240\241\004\177k:`\347\211\2249V\301~\022K\b\331;\311\342"
+	.string	"\332"
+	.string	"\351"
+	.ascii	"$\326\247\377\262u}\256w\265\367j\262u\210\\\307d\335Y\3139\037"
+	.ascii	"=m\016\353\323\035z\225=\f\feb\327\024\357\267\373_\016\246\375"
+	.ascii	"\226\217\017\310\371\311\034\261\234\225\022\372h}\332\312\027"
+	.ascii	"\251O\327\023P\237v\333\255\347\312\253\214\313j\032\227m9g\036"
+	.ascii	"\216\322\272\333^H\227cW\234\232\242\370\266\375+E\326\225f&"
+	.ascii	"9\274\220\222\345\257\220$\324\325\031UE)y\016JT\222\263gH$m"
+	.ascii	"\204\0059uW\024\303\032#D\036v#,H)\364b\251\361\371\031r\352"
+	.ascii	"\342\216\\E\021P\301)\022 iD\033\320q\202G\227,\3364\227<r\024"
+	.ascii	"\215\2606\006H\227\374\201\026\021\251r|\330\357\220$\361\342"
+	.ascii	"/\217ny3\373\022\250**\311/NC\316\271\3571\031\365\006\360\356"
+	.ascii	"nv\267\260;\345\n\367\307\002\370Z\332`\374\261\363\330\330\002"
+	.ascii	"\275\n\r\353\t\305V\315\244^\f\354\272C\274\316\036\272\307\335"
+	.ascii	"=\245\373\343\305\030\230\020\361\260\273}_\223c\3159#\365\325"
+	.ascii	"\300\240\261R\361\241>=~\330\217\312\330\264\266\236\356\023"
+	.ascii	"\347ib\245\rc\253n\345\360\"\035q3\245\361\223n\243\177\275w"
+	.ascii	"W\376\t\212.\366.@\364\255\177\350h\336\271{\275Y\335\355u\275"
+	.ascii	"\215\313\335Vs\267S\3666\212\273\215\327\333\027w\373\f\276\244"
+	.ascii	"B\245$K\r\247)3\221\347\240l\226\246\311\272\330\377\365\237"
+	.ascii	"\371\321\374^\335g\366\307Z'\026\344\361\326fc\375\230>\231\203"
+	.ascii	"=\254uht\244xk*c\254O\313\334L\3733;\236\213\310\021Ynk9#Y\030"
+	.ascii	"\370r\332\021\2259\231C\013b\366\245-c\332Vl\325\272=N#S%\022"
+	.ascii	"\301\314cd\246\317?P?v\026\314s\bZ\204sX\b\233\343\032\334\034"
+	.ascii	">\363`-\227\365\250\342N\200"
+	.string	"qxW\304C\255\367i\275\b\270rp\225sV\361\005\251/\255\255\357yw\013F\201\332\335\2069\030\210\336\260\266?\240vw8\230\207FJ\313\336\332\376\250%U\270\262\363&\b\n\306l\341i\332\016\371~\023\342u\372g&pe\317.9?\375\3307;\235\021\335%L\334\037M\250(.'\251\221\272U\034lE#=m\361\334s4\342\304\245\230\b_7\343\033\213[\311\344M\246\246\370[\236eE+P\\oS_\352\321Y\214\025&\255K\016\361:\257\231\255\037l\251\200\347\363\251\347A\025\305E\370\272\025\251\210\036T\013`\024\337\371\374*\002\202\272\317&p1\356v\361\">\037\360C\320't\342\300C\250\343\321\373\261B\337\r\245^\223ZCHc\311G\302\367\353\001g\350\204K\276\244\240O\350$\203]\372\360\353\371\200\302\244`\320\247\304\004<\321\024\374\0215\005\177\270\225&\340\350\331"
+	.ascii	"\372\2021\232\202?\336\222\215\336\217\247\004\f\362&$h\246&"
+	.ascii	"\037\220'db\002\362t\371\370\311\227?\220\2632\263'\f%\204\255"
+	.ascii	"\372ag\251\\\221bd\262F\330\347V\345\nQ.y\223\251,\376\362D~"
+	.ascii	"\004\r\375\240\305!^'\232s\316\272\005Z\307\252\334\0164\347"
+	.ascii	"\252\f?\363\257q\335g\3570\213\215p\016\355\310,RA\3412M(mX'"
+	.ascii	"u\207\261\030/\266.\265\tw\035\302\335\255U\033\345\376\270\223"
+	.ascii	"\362A-\026\203\346\227+~\224T\030\204\333w\006:\363lm\226P\263"
+	.ascii	"A3\347\214\324^i\263\\2gZ\314~\340\341\233\251n\250Q$\245\fs"
+	.ascii	"\b!\231\221@f*hZ\fp\002\021\252\253\036\021PIg\352$M\245\003"
+	.ascii	"\002\231\325\313\210\354\336\355*\222\353\002\242%\257\003\206"
+	.ascii	"&\t\372CP\222L\331\364\246bN:\200\t\237\357\304\026+-\264\262"
+	.ascii	"p\334\256BMf\216\334\234\357:\205\225\377\224\355C\033f\002\315"
+	.ascii	"\332\313\033\013dNK\277\337\227\377gQ\333\262\bv\226\255\252"
+	.ascii	"\216\210\240\261\2001\037\256\377\017\236\233\f\020.A\340\372"
+	.ascii	"\f\277*].\375\177 !\277f\t\006\177n\361\224uw\225@\"C3\245s\321"
+	.ascii	"i\027\203\335\366##&\211\205\355\033\260\n\256\321\226\2223\221"
+	.ascii	"\232\025\255Q\236\007Z\236N:\353\245\016\266\t\313q\317\270\311"
+	.ascii	"\007Ki2\360\204\252\251.\034\n\207`d\240\f\321\217\200\321\227"
+	.ascii	"AQ|\003r\025\035\200\026\r\223=\235\036\335\355)\323?\232\t\223"
+	.ascii	"\215\032"
+	.text
+	.section	.gnu.lto_mspSerialProcess.34.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\274\n\3257"
+	.ascii	"\272^p\025DP\344U\007c|6el\334A\253\305M\223'JB\306\242\350\245"
+	.ascii	"\277l\342y\3457\222\003\346\f\331rH\034\344\027@\024\n\002\250"
+	.ascii	"\200$\244 5\327\241 >H\033\022\225!\302\373\376\256o\177\357"
+	.ascii	"\235dJ\001E\001/\001E\001\354t\207\034\033\037\246\207\030#-"
+	.ascii	"\262\324\315`\007\343\003i\030G\235u\001\301\363\266\245<\317"
+	.ascii	"\335\036u2\330\313\200t/\216\273\346\234\211c\351\204N\342y{"
+	.ascii	"\300\217\\oY7r\275m\270[\217K\301b\244\260.L1\3278\216\213\017"
+	.ascii	"\245\205\375\316J\275\003<\354\002\002\034\0010*\"\016\205HA"
+	.ascii	"\340\357\365\365x;\267e?\303\355\273\020h\316z]\2615\253\226"
+	.ascii	".\200\035V\235W\330\nP9\300\023++~\004\240\n\033\225lTDd\rX\337"
+	.ascii	"\264x\3259\205M\220\305E\306\305\234Q\362\260\352\004cf\241k"
+	.ascii	"\325\304\221\202S\034\310b\220\272fy\325\251\305\376\b1\341\\"
+	.ascii	"\314\271\225\177\257\027\025\230\277YbN&\331\307z \033\213\342"
+	.ascii	"U\347\030\373`\320\330`\345^#\350\262\272r\036\033\201O[ \257"
+	.ascii	":\257\330#*+Mws\004b\316g\336\371\254Sc\232\270\313R\210\203"
+	.ascii	"\204\314\253N),\321\013\317\331[%$\267Oa_\372tYUq\226\225`'\013"
+	.ascii	"V\260J\2125\272Z\263\343l\236\213TE\345w5o\275\212P\243\203\272"
+	.ascii	"\254\254x\336\205\210\343\270s\263\312\312{\200w\273[w\177u\367"
+	.ascii	"8\004\2543\271\371\223gw\2422\241\356~\341oL2\236s\306\3428\326"
+	.ascii	" '\206G\237oW8\036\007\206\353m~\031\3179\\\312\332\335\300h"
+	.ascii	" \327\354\356\037\336&F\021,\216c\016k\234\315\214v*\3366\215"
+	.ascii	"\032\331\2335\\o\007\374\313i*\031\276\277\263y\033}\276\235"
+	.ascii	"\305\241!\n\222\023e\256:q\260\374C\273\245\313\374_\324\265"
+	.ascii	"4.\375_\335\026|\352^Lr0\356\020<\214\273\003/sg\340m\336\013"
+	.ascii	"<\215w\0027\263\346M\3644\357\341\233[\370\346\016\376r\003\337"
+	.ascii	"\334?a\3567\230\333\007\314\335\003\346\346\001s\357|\271\335"
+	.ascii	"7w\373\313\315\376r\377\233;\373r;\206\001kg\3260a^>N\032S%2"
+	.ascii	"\024S[4W\274\315=\215\373\232\273\031\367\2643\355h\334\255\337"
+	.ascii	"4M\007\226\322\230Jh\235:\023\275z\361\332\220l\374\214\337:"
+	.ascii	"\325&:\206E\246\275\214\263\365k\006G\23602\253\3565\3450\256"
+	.ascii	"\306^U\027\246\346K\236\217iW\353\327\333\276\220\001\366\264"
+	.ascii	"\034\036\013\211{\200\205E\371\304\2614\311\333\336\301\363\326"
+	.ascii	"\337\356\016p\250R\277\3742uq\301\034\345D\2060\203Y\\u\200\276"
+	.ascii	"\353\203\226\2058\247d\355\367\320\fE\315A\3622\353ih\254\256"
+	.ascii	"B\206\300\005{eo&}K\265\262\241J\361\340\230P^\030\212\373\276"
+	.ascii	"W\241~\b\206\322[\242\201\031*\364\276;\237\200\b\230\321\372"
+	.ascii	"\343\003:<\305\365\275\213\301Q\374\nO\331\231\241}\t\n\344{"
+	.ascii	"\036\317\272A=\bW\340\260\354\315\316rV2\252T\0235Y\304x\017"
+	.ascii	"m7\272\275w1\336\357\276\367\177\210\371\204\002\3422x\336\273"
+	.ascii	"tL4P9Q/\370\335\277^S{\230X\r\262\373\003\264\300[\2627\027\374"
+	.ascii	"\001\251_v\202w\337\263\236t\nr\373\335\260\027\230,{3\301\373"
+	.ascii	"\022'Q\277\334\303\004l\233\312\351\241k\337\335\274}\363\244"
+	.ascii	"\343R\366V<`\306\354\036*\302\355\206\277\370\234\210\326l\032"
+	.ascii	"\275#\347X\317\270k\035\373\335#\334N\211\326l:\266\025\255\023"
+	.ascii	"\343\245#\246n+\n\307\3225\375\024\310\335'Pdo\262\317^\255Z"
+	.ascii	"T(\rU8R\334\024\356\177\362l\016)\347\357f\341\"{\363?8\275\222"
+	.ascii	"\016\342\023\365KW\243+\023m\037\272\025\177\227\367\232\353"
+	.ascii	"\221?\001Kn\303\330\224CyD.\361\236\222\273\243\211'%r\310\303"
+	.ascii	"h\343x\342)\211t\352\035M4)\031\223O.\212\216&z\334p2\266 \036"
+	.ascii	"M\3308*55!G(\225\306%dr\205\223\262\311H\351I\211\204\2232\305"
+	.ascii	"\021\251\302\370\244\224\343\206\222\016cQ/Q\270\241\304\224"
+	.ascii	"4*k8)\233\212G&\245\246\342RRY\244P\240\221N\306d\361\t\211L"
+	.ascii	"\026_i\354\377\205\346\274i\026\347 >A\036\252\213\200\207\266"
+	.ascii	"\020\353\310\302\267Rr\027\311z<\210\030t.\300Cs\270\303\267"
+	.ascii	"\360\256\346\255\237\347\033T\334t\013*'\312aG\037r\361\2310"
+	.ascii	"\021\255\316\343%.\r\300\016\267\370o\266\266\345\254\314\250"
+	.ascii	"C\236\202\251\\\316N\022j\024\222\246\037\253\242\rY\370M\374"
+	.ascii	">\240\305\324V\241\031\312b\"|\244Dn\3124\344`\022x\211\213'"
+	.ascii	"\323\022%\301\027\322A\273\032Q\251\240!\262y\257.L\215\311&"
+	.ascii	"\314H\334\335\334\255\b\321*{\223\236\370E\224.\361\037\030\371"
+	.ascii	"\302\365\307:\027\225\t-\270\206\2313\244\343\300\037\361\003"
+	.ascii	"~\214l\305\004\\N\341\252\234\277w6\237\260\234\302m"
+	.string	"\221\261q\034\307\302\207\266\373\247i}\271!\375\327\221)#\030\262\003&\260\326\217\261\006\200\311\250a(\006\tS\006\031\031\231\021\3214I\007\260\002\021\2412\316\001\021\3408\210\030#\nBR;\007\304\272R!\201h\247(4rT\352\215.4\005\025=\321I\273\322\271\323\016I\002\342d\227\314Y\260\307\266\205Q\275`\322\322(`Y\177\007\034\334\007\243]\370\0227\241\0075s\315\327n{\256n\214K3.-\230e\315H\030h\315\315@\211`\221\315\260*m\362c\027\373BrT\250\006\t\030\367\214\r\3637\370\211R\345\031|\337\253\035\376\330\3172\005\346i\211\352I\233!\237\375\237\247X$\331$\350:'\250R\316\030_!\274p\310\345\342T\025\013\252*N\274\332\205\"\363\231\331\303%7K\"\253Z9fN\0228D\235p\276\340\036=z?N8XM\034\271u\026\241\276{\312\375G\220"
+	.ascii	"\f\312t\271\n\321>?\270\2227-\202\225\373^\177\n\270\206\242"
+	.ascii	"\321\341\245\b\271\350\025\002\371f\3373\032\024)\261BA\001\253"
+	.ascii	"\021k\371\231\204\3123<\300\017\024k\331\236iD\324\320\316\031"
+	.ascii	"\375\004\nu='\322k\262`\344\364\364\315E\320A\352N\024QQ\267"
+	.ascii	"!\320\3446\013\257\0310\033\371\313LpwY\316m\376F\234\023\177"
+	.ascii	"\362'6vy\376 b\003Z\302\273\300\342Wv\2000O\030]\224(Pp\266\016"
+	.ascii	"g=\377\307\200\030\353\020\023\261\030\242\305\347\021\377[="
+	.ascii	"\320U\260p5\035\370\355\241\3478\023\022Wo=]\262sj\004O\363\320"
+	.ascii	"\317\"\205m\364\017"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.35.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\333\001\335\021"
+	.string	"6!wH\320\360(\035\332\251\372\270?\314Q2\030\030\351\215\001u4\262v\245X1$\274\374e\216C\020P\223\346\244\0234d\227\002\250\365Q\374?\362\n\"\200%\274\304"
+	.string	"z\362a\026[\001\232\301\024X\306\343\316\267F\366\2262\245c"
+	.string	"^"
+	.string	"b"
+	.string	"s\336V\353\343}\274\335'}\035u\362d\\}\371\260\243\242\200\02646\021\201\213\236J\324\334\213\016hB\"<\300X\\\242\334\321M\320\330\250<\355\334\344d \210\307x`7\273\361"
+	.string	"9\304\001a\321\356\266k\f\370\242\373\332\r\204,pJ+\300\232\353)d\316i\225\201\037\356\324m\373\330V`\337F\341\r\230\035-\332\264sN\330n\217}\203\351e\222H\304\274<\266\312jy\332\035\245z\243ZW}"
+	.ascii	"\024\226fd\300\207Js\3164\351\230H\322(\350\264\333\267}\310"
+	.ascii	"\257Yuy\332\312glj\370\231"
+	.string	"\345,\315y\373\270\364\007\352\3626\213\255r\202\005,~\375\3663C`\206\003\243\202)4p\214rx#\336\356\207\203\341\241\2726\253\202^\266{\027\273#\244\227\205Y=\354f92\352\314\rq\327\b\213\222\342U<\335\017\367\342Es\330.y\n\025\221P\3074\347d`{\303q\026>\024\352\204\346\234\rP\234\310\304\007\272t\013\203^v\351\273\274K]\221P\207\243\026\367{\333!\340\002\031X\023N\036\244|-\224\224I@.\214\224|,\227\004\024\227\311\352\244d\304dE\362\271V \005\334Ba}\253\224V\353[\251n\363\313\343\2378*\306,(\247;\371/\357\266\247\200f@9\235\374_\236\224\353\220\226u\351\200\332\036\007\270\361T+G\250cT\306\343\334\036\257xqU\373\332#\354\2043b:.\332\244\032' `\202Ae\311\003\257\030\035\207\026\375\020\345w\363H\251\361\3164-"
+	.string	"\005\013\034\033\233\265\367\230\373\266\331,dm\314\321\036\005y%+\233\006\244\267\025\215\226\021\r"
+	.ascii	"\033-\n\277\021\211[\334\312tqT&\307o\243\274\200\306\366Uw\230"
+	.ascii	"Ru0\264F\354\327>\021\367\272\372\023"
+	.text
+	.section	.gnu.lto_mspSerialInit.36.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"}\007"
+	.string	"B\01646Po\322\001\f\333\205\217n\005u\225\250\247p\220\267w\304E\224\2432\216c-A\214\304\003A\261=\233\350\23633\313d\307\336\334\264nLY\200\"\331d\313\224\002\336d\0304\035\213s-|.Ol\350h<qc]1S`\371\341X\361AJ+b\270\375\264O\024Pr\351@/\344Jm\351\300\322\205\236fJ\341\311]B%\374 \347\260\201\321.\350\323'=\004\302\3378t\004\246\237\207>F\035\332\022\023\372\351\203\322JG\3614\233\323\364e\330\237\366\211\354I ed;\206\311\256\305K\313v\220\204\303\3661\316l\224s\243%\350\360\250\020Q\331\335\3704\236]3\377\037\257\346\246]\001\024v\327:\267\213\373\335\266\201m\004\333\244\n"
+	.ascii	"\357b\314\304\023~\264\027\273\212\ba\030\327D\267\020\360\313"
+	.ascii	"\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_mspSerialPush.37.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375``\005\005$"
+	.string	"\032C\204\016G\200\234Q:\241\366\2170@Al\005\275\257\222\201vSZ\317\211\276\234zG\357\243\213P]\265R@\3660<+\037l\361\276q\311\243\tI\n\2061\304\b\234\206H[\255(\322\354l\201\r\230\344\223XB\210\334I\006\330"
+	.string	"\304"
+	.string	"\336"
+	.string	"\2144k\327W\325$\203i\231\177\345Y\275c\301!T\273\276\254 \026\212)\267e\246p\241\367\342\022\367\275SI/\367\026#\360\204\333c\361`\365^*0/\367\336\b<\224\376\374\224S\3511#\315b\223`\020q\313/K\362\336kc\360\002\350O\363\004\320\237\315\204\373f\361L\263\275\25745\235\241\247\331\266\307\237q\350r\020NI\274\200A\246\257fMl\310\021s\202\223\245-\211\222\272\212|\332\200*J\370\231\311\240L\330o\201\222${\320\213\r1\262\006\237\354iV\360\221\034\006\b\3720\177\370\374\330\254\301\2375M\013dA\251"
+	.ascii	"A\237\271\022\241\343\346\310[\250\340\317\366\215OA\344\262"
+	.ascii	"C\025%u;\343p\357e\013\fF\235\177\316\314k\230\031\307|\376\004"
+	.ascii	"\037S\304w\362\223q2\354\2012\320\237@}\344I\254\031\326\001"
+	.ascii	"\026i\262\313\276\3672u[1\027\231l+Y.\227Jn%\314\n\020|\313/"
+	.ascii	"\364\342o\340Z\177\320\261\374\003\216\365\327\016\346\f\364"
+	.ascii	"\256\363JSU\313\351jyfZFi\226\317\266l\252\226\373[g\233Z\376"
+	.ascii	"\202\037%W\360C\257{\205,\373\334\260\363\013\312\277~0\177\327"
+	.ascii	"\277u\223\371\314\367\342\037\217\004S\343A2bW\331\275E\030\351"
+	.ascii	"O\366\362/\275\177\355jW\354\252Q\210o\312\356\035\302\242(t"
+	.ascii	"\002\350\271\370F^\177v%\211\\%\322\237g\356\361\273\360\312"
+	.ascii	"\314[\214\374\215\272\377\301\206\270Uv\357\035\372\311\"\316"
+	.ascii	"-6\306th\255\315,\342s\326\252)-\300;g\017h\264\377\024\305\311"
+	.ascii	".9\250\317>\260f\312\353\247\034\320\314#.\007\007\0231\227\370"
+	.ascii	"\361\004\023\375T\207(\354\006\376\330\337\240\340;\341\037U"
+	.ascii	"p\355+\320\237-\204y\256\312\244"
+	.string	"\226T!\323\235y/\325\206\177]\203\220\316\236\262+v\311\t\200\350\031N\335\246jC\306\214\223Y\255\315\266n\272\315\236u\375\224Mvy.`H\037\332V\334\343<\320Z\337h'+\216\317\362y\237;R\260\234A_B\273o\260\270\330Rz5;\\\244\367\336n\035\3029WX\266\312\2171$f[q\016}\353\262\340\370,\037f~\3614\271\026B2)\367^\"4\267S\021\272I\232\371\231\030\350\317w\013!\331\025\326\301b8x\003d\346\031's\2635\271\367b\020\023<]\316\204\322\016i6cgC\311\314\2013J\n\241\362p\272N\312\035\361\212p\272##5\tGcv\343\335\214L#\244\242\346\351rJ&\027I\240q;\322\341v1\224vH\266\244\243\033\222\255H\267\263IH\3009%\234\316\306\313\345t\266\265x\377k\322hm\255\200\2601<aM\355\304\367\336\273\266\025\003"
+	.ascii	"S\025\\\310\323\225\321\016}m(6U\265\337\345\007\242u\365\304"
+	.ascii	"\016\235\326P\021\276>\260c$\232\367\336K3g\264\013\321\252\242"
+	.ascii	"L\021\264\332P\314\020\276\266\202\276\361.\252"
+	.string	"\206cOSNvi\233\3247\260\374\236\025\364a~T\221\0025s\007\017\366@\004\375\344X\232\260\247f\342\264\231?\374\270$\324i\377\247\23453\210\037C0\321\r\364\254\217\006e\250A,\244\220C\210(\001\215\210\b\211J5\006`\002\231:c\007\020X\251DI\2411\216\210\020\236\337}\314\254\221\302_\3521\241\233\031\007)\213~7\021\377\363\004#\345\267#\310\b\222\023A\267C\"\177\036\316\007\375\327\245j\330D2\300\277\322\355\251}>\030.\034g\030T\333\220\345'\203\324Sr\\(\270n)\025\210\202\034\034*\317{\002\270\263\"\304\263\377\0300\027\323+\024t\373\305{\213\360\"'\034\362\363\270\300\341X\003\250R\300K\375\252\234\237\361)k\n\237Dd\270\353-:\003\366\006\024\301)\302#\240\017\222\307\024\2316es\200\312iY\256\020B@\356\3735\270\216\3170\fj\242\337\344^"
+	.ascii	"{\257@\253\\]]\025w\016\263\021f\216\037\255V&\363\250"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.38.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`\b\003\005\030"
+	.string	"\206\353\234L\240\324U:\0049\315\276NL\250Mo%Z\263\024\257q\3377\276\304\252\235\363\237\377\207:u\247T\3500\311'\333\326\333y\214\326w\215o\262\353]\306O\223#.\360rd\215\267\216\243\247j=\330/\372\025m\215\020B\366\336I\006\211"
+	.string	"\177"
+	.string	"\212"
+	.ascii	"\305W\312Q\320\237\370\002\320\237\027\250\357q\361\275\262\266"
+	.ascii	"\263V*5EO|\255\255\237\266\030]B\256\005\017\236\357v\026>y\322"
+	.ascii	"1\201\027\344\354\312\300\212\037\360*\023\237\rNy\241\323c\325"
+	.ascii	"\313\342F\212\021\370\370\330\371\223\016\017Fq\nF\355,z\\\317"
+	.ascii	"\3174\030\004\305\363\2218\306\f\242|@\023\337\rf\215\220b^y"
+	.ascii	"\333\363\351\354\375\361\025\206r\212\374\374\200\267iK\316\271"
+	.ascii	"-\317\367{\267\336\335N\335\r\241\333\366\bD\234]o\316\371v\257"
+	.ascii	"\260\273x\263\317WE\267\353I\343"
+	.string	";EOl\373\236\370\266\327\366M\b0!\201$\207K.T1\213X\223\344\345\251C\350\311\337\370\023\177\273\337}d_\231\004\221\263\034:\361\340\305\376\261Y?\215\315\2043R\306\301 \244\242\0309\347\227\372\363\3355}\243f\235h{\376\345\343L\rW\"9\027W~\366\212\372\263/\343E5m\233`\203\363\251\f\225\354\224S9\007\277\020\fR\272\361\311\331\325\252\256\260[\027\275\327\270d\004\371\343\304\272\274\330\363Z\027/\233DK\335\275\365s\244H\002C\035\302l2\323\001\207A/\3548`\324'\205\210Qs\316\367\326\200IDv\006\016\024\n\364\n\333\226\020\2721\317\306>\371\376\274\217Fx\202\340+\244A\177gH!:\213\244\2737\334\006\215\005`n\320\335\262\327\220y\021P\351\340\350H\261\276\213\237\335\201f\317\373\331\367\200\376\374\275\362\270\t\250<\0220\330,\002\rV\243\311\240\372"
+	.ascii	"\3230C\2416\213\311T5\330\354\366\013\013\007\227\230\031\214"
+	.ascii	"\206AF\223y\315\304\270\310\274^f\264\027K\201\216\311`\263W"
+	.ascii	"-\026\233\275X\305|\274B\257\265\001\226M\246%\356\346XW\330"
+	.ascii	"\256&\225\013\017\345\354\216\354\312\323\333k\254:\357\215\256"
+	.ascii	"N\r\327\235\222\005\260\256\353z\025\024\275=\005O\017\024Y\002"
+	.ascii	"B6u\026\311q\3169\257\256\260\257\374wh\354\220R[\267\361\211"
+	.ascii	"\336\363\366\272\023<\275\256\373c< `\002!t\271\003\177\f\263"
+	.ascii	"\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026"
+	.ascii	"Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377"
+	.ascii	"*\013\323s\321\212\257\231\324\226wZ\206Ik\3176c5\033\2017\n"
+	.ascii	"\024V\343\250,)v4\357\022\262\327\250\025r\370\227\242\313q\217"
+	.ascii	"G[\234\341c\266\203\240\021\006\213\220\035i\373.M\007\356\320"
+	.ascii	"\032\006\260\214\326\241\227\226\3130\021\252t\270\341y\343]"
+	.ascii	"6\265\235\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`'\006U\031"
+	.string	"\026(\231I\200ZR\007y\262b\230\356\364.\314\363\353\263\272\017pM\344\273\331\257\264\234?\233\024\320\210\2100\024\347\333\004.<Ob\362\351hM\002\326\201\365\310h\260iM\376z\237\225\332\027#\006\361\325\230\226\330\"P6\331i'\031\210"
+	.string	"\204"
+	.string	"\206"
+	.string	"'\376\200\211/v{l1\036\226\370\243&\361A\370\371|\266\215x \021Ol\253\327H\216\020\377\203\321\250\220\205\201x\237\017\237\203\266\207\307\3510tc\352\3350\306\250\361\310\004\f\207\277A7\374\020M\362\221\245K\303\367 \355d\370 \352\030\267;\206A\351v\341\201\026\376\2072+\274\217\302\333\240i\333\266\355\204\347q\222\200t\363\347\363\371\214\360B\2655\032\217a\030?\306U\216\275\304\345d\203\360:(\3068\377\004?w\230=\347m\214\005\007\217/\236\354<%\317\035f_\2338\367d\317\275?\325s\3117'\201\252\253o;\227\223\315lG\365~\033m\333\366FP\365v\205\252\367\221-\033\356\324\333BH\262\236\350\334\274\2239\2517\371RW\231\235zZ\343\013\320\370\0013\336\200\214\0270\365B1\236\b\306\027\275x#\027O\240\305;`\361xL\352\021D}\322\212O"
+	.string	"\365KO\257@\305/H\361\f\234\236\t\3057\be~\274E5\276\272A;\317!\323\035&\253\002\222&\324:\264X\021\031\3329\221h\3479\371\243su\331JTN\274\210:\207\352vj=\243"
+	.string	"\351<G\306\271\246k3\257\276&\333\317\260\240\230\361Y\033\231V\304\030\\\275\251}M\353\313\214p\365U\t.\345!3\316\327\267\233\313\311f\305\007\347RH5\273\224\333n\305\245\355\035f\217zZ\016\263?\271\255\204\026\006\214'\273P)4\002\227@$\316\376[\006\270\337n3\2553K\2028\276\032\273\261\206\ba\346\033\177\260\263q\242\rZ\325\005,\253\330\363\036\223Mq\220\215\2774Q#[Y\3575\273\257v\210\351\241c\275\347v\017\315\353\212\021\3534o\221u\032c{\331\0305g\235gl"
+	.ascii	"/\325\026\216\365\\\263;\b\023,I\263\236\2257\326\263\333\236"
+	.ascii	"\346E)\345\210u\325\355\244\346Y\027\020\333S\326\312\304\212"
+	.ascii	"\254\367\353k\333r%V\024\300{\351\253\301\312b\250A\024\311\204"
+	.ascii	"\216\b\t\005)HAZ\f\320\002\251\"q\016\021\220\030\016!F$\220"
+	.ascii	"h(\022\021z\240\026\2238Z\265\223B\257\3100\252\316(\225\235"
+	.ascii	"]1\b\003\225\211~g\211\253A?\237\241'\303u\371M?N\240\266\266"
+	.ascii	"\020s\343\276\003;\003\326pN \235!\035;\311^\2368\311{\311\017"
+	.ascii	"\214\217\037\261\177\001cK\212\303p\361\002\f\265\233\027g\364"
+	.ascii	"\220L$\211a\227\364 4-\022_\257\370\223\n\304\274JG\376\314j"
+	.ascii	"K\n\233\007a\354\006\274{\340\001Q\006\333\372\330\302\261\324"
+	.ascii	"a\231\360\337\\ \177\216\b{P\374\332J\023\355e\327\314v\372\245"
+	.ascii	"7B\302\240\255\301rL\326l\337p\016\216\032"
+	.text
+	.section	.gnu.lto_.refs.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375 \245m\003"
+	.string	"\302H\027\035\200EI\00730\00330\0033\032\330\r^\241\326\376\003}!\250m?6\264\245L\001\277\3360|\345\262\331\023\033\240\377\350;\372\215nF\367\242\273\351/}\245_\335I\2078#\375@S\237\245\201W\341\003}*\017\315\024?\305\tE\205V\024g\361\025\023\032\031,\330\343\333\037\020\004"
+	.ascii	"3\005hJ\2001I\031%\212\031"
+	.text
+	.section	.gnu.lto_.decls.a8406c871558a1e5,"e",@progbits
+	.string	"(\265/\375`mD\365\035\001\252\337\205gV LI*\351._Z\n"
+	.string	"D\020E@\004QQ\001TT\rl0\241H\210"
+	.string	"\210\"\b\" ju@\200\250\250+\023"
+	.string	"I\257o-r\342\272\306\221\300Y\340\267\365\245\023\263\213F\320n\267x\201\365\205<Fa\277\273J\327[\223Sk\322\032a\204\310-w\nx\005b\006\210\0068r\216\224\031;\343\276%s\336j\311\342\033%\013\274\265**YON\032\214\3050\250X\241\226F\203\310\371\263\214\363\325\317/\030FeS\001\347\213\234X\032n\266\nq\226a\323\204\326c\006wE\022v\336\244\225\307\334\361q\336n\235wR{L\226\252,\270\324\306p\337\3028\271\205eqV'\225\307\274e:Y\005?\325\364Sx\305q\310"
+	.ascii	"\303\342>\2239_?\305<A\375\024\363\374\345\254wy\347Y\312\311"
+	.ascii	"H\346\313Jgd\035\374\007!\374\206\351\222\335\2332\262\357U\252"
+	.ascii	"u\203\234Z7(\347\274\224\320\314>\313\235g$g\345\253<\346_\321"
+	.ascii	"\234)\321\352\212(q\3273\357\263,\034\253\004\243\312\233\231"
+	.ascii	"\300\232/?tLq\377\257dj\231\nX\323\032X\307\274\372\325\277\300"
+	.ascii	"\352\244\212\261fI\r4\261\250\201uIu\263\251\223SE\022(\276{"
+	.ascii	"S\265\300\272\226%\352\213\301\340\230\303:\333\314\252=\346"
+	.ascii	"\261T\036\363\374uV1\177U\253o\265\217\2638t\030\030\204\254"
+	.ascii	"q\363\371\224OnaT\270\317X\347\377\372\245n\251`*\227\352\245"
+	.ascii	"v\251i\rS\263\274\352U-\357\364^\246{\357\353\034\024\301/\262"
+	.ascii	"\275\312\2665(\245\256\332\331\364\253fm\351\f\337\275\367\n"
+	.ascii	"\370C\274\206\251w\025\2135K\236khf\370\242\320U\266\034\344"
+	.ascii	"\316]\312C\363uo\372*\367A\b5L}R\331l\372u\227\362\340\"\220"
+	.ascii	"\246\3666\006\360\336\324\247\003\2358\031a\354r\372\025\357"
+	.ascii	"\374]\3551o\252\333Y\361\352\225\232z\250y\257V\252\224\013\231"
+	.ascii	"\322\233vo\252#\324\033\203\305\306\375\232\344|\365`\352\f\016"
+	.ascii	"\016\016V\017\346\353\330\331S*\225\232\372\324*W\247^YjA\203"
+	.ascii	"\373\025\354<\301\255>\346\007"
+	.string	"\253\217\371\232\343\324\240\352\364P{\314W\245\323\203\332c~\205S\204\332cV\270\020\257q<f\322*\275l\367^\035\001\264\315\301q\327T\036\363?\247yk\217Y\231\324&5\355P\333^\225\324$/\225\322\233\336\233\352p\227\240\0224\356\247p\276v0\355\340`\355`^\002'W\036\363\342\244!\222\346\f\367A\234\277\253<\346N\3551\377\232\206\201N\n#\n\007\367_\321\376j\244\222\3253\373\004\225u\331\356M5X\030\312\374\336\270kY=RS\f\252\331?\b\341\026y\226\222\335\233\352\334HIueq\277\303\371\212\344:g7\204\363\371\212\201Y\007+\006\346\323\332c\236\225\307\254/\\\\\360\274\262\254:\"\250(\324\027\177u\261!m\357\003\370{\360g\025l\001~\256\272\315\337aDlq\322\316\337]~\376\200\345\340\347\020X\002\374\325\211\227\004\330\001\374|\302n\300\006\260\032\374\334"
+	.string	"\233\301\317}V"
+	.string	"=l\025\021\200\277f\320\301b\360\327\2765\276\232\345\020\370;\213\225\022\317\343\301*\342 \376\016\362\327\007\324/)\240`/"
+	.string	"\252|\037:\004\177uR\341\230\311\31786"
+	.string	"\177\025\201\335,"
+	.ascii	":\210x\317\337e\177%\341\257\034\374q\260\026\374\277\3408\177"
+	.ascii	"o\340\347\013X\037N\362[k9\374u\360\257e\376\232D(\202\212bD"
+	.ascii	"\n?\237?\013Q\300\371\177\302\247\226\260\025\330\236\237\031"
+	.ascii	"\205\207\370\273\353g\023,\005L\366?\317\362\374UlHU\341\347"
+	.ascii	" v\303\317\002\260\032\376\312\266\344\257L|\f\377\212\342\257"
+	.ascii	"#8\003\277\335\371\255\016\247\266\346\257?\177\375\300_\323"
+	.ascii	"l\377\204\217\265?\223\250e\177m\323\021\361\021\376\216\241"
+	.ascii	"e\231\213{\330\372\363\017\373\023\352y\360\354\204f\361\337"
+	.ascii	"\354g\234\201\371w\004\376:\344\257B\376*\366W\"|%\370\327\006"
+	.ascii	"\374\265\204\005\374\325\307_\273\376\n\204\001\177\265\340\257"
+	.ascii	"\023\b\001\002\177u\300_#P\037P7\370\005_\033\341\006\370\233"
+	.ascii	"\005\020\352\277\341\357(<\204\346'\326\230(\027\302\231\237"
+	.ascii	"\247\230\3719K\340\377.?\003\376\f\364sP\231\377[\376\233\215"
+	.ascii	"@\001\223\371y\356\347\235\277\277\352\375\347\360\277\303\326"
+	.ascii	"\253_\235;\002\376F\373\253\004\230\311\357\257 \374u\204\277"
+	.ascii	"nU\215\371\177B\3045\374]\364\263\230\237\301\374\354\345g.?"
+	.ascii	"\357\375\254\3673\225\237\241\374\374\366s\223\237\331~V\373"
+	.ascii	"\331\354\347\262\237\205\374\f\344\347\256\237\271~\336\372\031"
+	.ascii	"\353\347\031?\277\370\271\351g\245\237O\3603\013?'\375\\\374"
+	.ascii	"y\205\237\211?\243?\017\177\026\301\317 \370\031\205\237I\374"
+	.ascii	"\214\201\237O\370y\204\237\027\360\363\207\237\017\360s\207\237"
+	.ascii	"3\370\253\213\277>\371k\207\277\246\375\025\203\277\022\371+"
+	.ascii	"\220\277\236\3603\207\237{\376\372\364W\250\277\262\360\363\316"
+	.ascii	"\3178\177%\363\263\315_G\374,\374\231\377\347\375\277\340\257"
+	.ascii	"\377\253\337_\373\376\312\367\327.\177-\361\327\275\277f\371"
+	.ascii	"\353\225\377f\376\252\200"
+	.string	"\277\352\374u\203\377 \370k\006\377\333\376*\374\277\366\377\304_9\370\353\326_\351\376\032\345\257s\177\225\373k\334_\335\376\312\344\257I\376z\366\327#\177-\362\327\257\277\352\370k\216\377&\376\312\365W\034\177\035\372k\212\277\n\375\025\375k\320_\201\376*\342\377\231\377\201\377\321\376\237\3757\376\237\362\237gppp\360\267\271\277p\305\037\342DsR\035%\346\306\240\301}\233\262\206\352\025b\230\230\244\270\377fJ\233\251W\b\237\356\245\332@\016,,\tx\223I\004\374\375\364^\361wS;\351\224!S%\310\335*B\274\237n\274\326\360\272\2705\220\252<&#o\35515HV\036\3636\311V\022\302Q\201z\022\330\310\27664\276\260\f\242y_;h.]\r\211!h\323\344\2645\205\t\374\"h\317\260\030\221\030Lrp[3\266\n\020\260\266\026\3346P\350D\320\256\007\340\177a\r\024/P\320"
+	.ascii	"_&\207\0226K\246\205\240S\024\356\013\245\234\277\375\273\365"
+	.ascii	"\033\322CG\024n;f\354+\t\f\356\013\233\244`\311,1\334\226\257"
+	.ascii	"&\007\017\036a\334\027\016\261a,\030\341\325\"\006h\277\334\202"
+	.ascii	"Ac\006\213\022\367\377*\021A-N\\l\027S/9\350\304}\341\016.v\257"
+	.ascii	"\246\255\3618\303}\341\324i\265\374\342d\340r\302\246\304m\263"
+	.ascii	"\020o\f\301\302\3753\020\213\275r\307$\206\311\034\367\317\274"
+	.ascii	"\3635\265xwN\310\376\310X\271\275c$\213\301\323\323\342\266v"
+	.ascii	",\366_\310\2000w6\270m\235\255\362\006E7X\205\n\221)~4l\332\b"
+	.ascii	"\266\272T\231\302SN*,\367\211\373\177\025\313\177\241i'\205\306"
+	.ascii	"\214\024\237.h\252\330\321\331(\354Fd\314\210\215\202\205\263"
+	.ascii	"\222f\026'LU\240\330\271\027{@\312\270\371\322\r\302\244`=\361"
+	.ascii	"\020\250\2674&\027'\226\264\212\342~Mm\034\334\210\032N\306X"
+	.ascii	"'\267p\275\245i\205\013\356\377\261\217\377B\033=.g\356\336\334"
+	.ascii	"J'3\254\036m\267nl*\\\016\032\352\2226\270?\bq\3336\366\344F"
+	.ascii	"`\023&B\244\260hp\333%vmo\307\025\030\356\237q\347\025\300fD"
+	.ascii	"IM-\333\355Z\007>5b\006\225dt\253\331$A"
+	.ascii	"\274\\\230\341\266iA\342\220\310q\377T;\177\213v\206C\366\006"
+	.ascii	"&Mo\317~kfc(\002\221\241\306m+\217Y\225\204\270M\255\023(Nh\220"
+	.ascii	"\034\311\341B\204\256\354\366H\023K\325\004-\b\267%\013q[f\246"
+	.ascii	"\td\301\306\255c\215\024y\312\022&\215\333\0221\"$H\026\367\317"
+	.ascii	"\261S\b+A\302o\325-gj\3472-\261}\005\261C\354XM\255\220\3330"
+	.ascii	"+V\2430\331\030\376\020V\210\345Q\335l\332\327\251\002M\t\237"
+	.ascii	"O\007B44?\250\263\313\312c\372X\260/%ltb\334\026\210\217\016"
+	.ascii	"\233WZ\r\356\237=\316\377\326\313\372\250\251\375q\333U\323\373"
+	.ascii	"\224\336{\037\002\277\001\261?,\217\312\006B\220;\2754\200&\326"
+	.ascii	"\036\225\034f\377\266\307/\264\251RF\306\027\367\317\255\363"
+	.ascii	"g\215\363\267;h\350h\221\203\2215F\240l\261q\341\310\360\"]\202"
+	.ascii	"\204qT\335h\345\2603\302\315'\206\001EpJ\n\245\320\272\370\244"
+	.ascii	"\240\261\361\025\310gv|\005\262\031\036V\211\006\037\227.\034"
+	.ascii	"&\357\207\223]\221\327\202\257\3126Y\331\026\226J\004\247\244"
+	.ascii	"\320\305\022\013\276\276\177\021\301))t\312\363A\266T\261\344"
+	.ascii	"0\355\\\246\255\031_\201,X#M\025\017Z\244\bNI!\213<,>.\266\252"
+	.ascii	"\326\2151U,W\026\206\255a\257\354\226\315\2627\254\226\265\262"
+	.ascii	"1\254\r+\303\276\2604,\226uag\324\324Vq\017&[ea\260Q\032\200"
+	.ascii	"\301iQ\345\234\371\210J\007\320\277\245\262Slf^\270\244\035\203"
+	.ascii	"\2267 6i\245\314#y;\352\270_\303w\276f\213\205\322)\023\345\247"
+	.ascii	"\307\375\032;\313B\212}\272\021\243\222\372\301\375\032&VE\r"
+	.ascii	"\332\371\232\"\347k\274\316\327d\235\257\211q\376\026io\371\005"
+	.ascii	"\344\354\313\235\316M\032#y7\270_\323\342\324\240\362\230\257"
+	.ascii	"A\2367\375\316\233Z\316\233u\247\007d\270\314_7\311\311\3550"
+	.ascii	"#\363?\363J\331U\343\346?\035/7<\034\334<\246\272\r\272Q\231"
+	.ascii	"\343\376\337\277\374\027f\210\322c\313\216\373\246\220\363\246"
+	.ascii	"\216\363i\3451\031L\f.\245/\3347\247\316\327\224\277x\261\021"
+	.ascii	"\374a\007\310\375\203\271\271\027\340\\\241\332r\271o2\235w\302"
+	.ascii	"[8k\317\202\232!p6rh\351p2\3111!\323\373\224\216a\216\351F\026"
+	.ascii	"\271\264:?;\356\237\261\260]\025\337\265\262\304\313\327\275"
+	.ascii	"\327\216\337\330-\247\2747\253\313\227\024%\225\255\336Y9\240"
+	.ascii	"\310\027\266c8\256\273`\351)\003c\\\370\356\275\\e\307l\225-"
+	.ascii	"\007\231^\251\032\257\2730d\200V\030\217\363\370\n\337\325\224"
+	.ascii	"\355x\312\231\nW\021\356\025\351qw\3235\255=\246O\3451_^\221"
+	.ascii	"\342S[\\\221\023\344~9\345\374\317Q\030JM\231\216\237\234\253"
+	.ascii	"\330\311}\322{\233\314\261\\\016R\303\2758\312\276\3508\216\345"
+	.ascii	".Xz\272\275\226v\001\034\353%\264-T\314~9v\276"
+	.string	"\004\223\253l\234W\005j\211\373\245\327\371\222\307Yo\3551_r\235\314\204\233\324\324\002\026\263ci\212\373%\326i\202{\253\005f\035\034\254\026\230/a\234/\223\347K\2475\265(rRq\334I\316\250'\257#\334o4'\024\217\261\0134\273\020[\314e\315\222\347[^\035\337\f\256\221\303\224\336\251\021R\2754cU\360\213\305@(\273\323K\003\310bK\bK^\270\312\006kY\263\344\271di\n3u\341\2737\345\301>DpJ\n[\240\321\361\361\324\317PLe\205\253x\214c\360\225M\277(\260U\205/D\016\336!\345g3\016\302H\270\214\207p\312B\330\b\247q\021>\343#\214\306D\230\254\246<\306^\347\037\f\344>d?7\215\261\023\303 \202SR\bC\036\027>-?C\361\030Gq\262\336\261]%*\017eW/\r\240\340\377A\b<V\3230\262\336Y]d\037\007eN\364\322"
+	.ascii	"\336\233v\340\323A\007\035\344T\255\305\210\322\240\031\214c"
+	.ascii	"\250\351\3478\354\352\330%\\\202y\334\357\267\263\205{\357\255"
+	.ascii	"\2373k>g\276\323N\235\264\366\230\025\260\362\230\357\"\347\317"
+	.ascii	">\270\253\311L]\0327wq\217\364\372\334\324\340\272\322\302\375"
+	.ascii	"\366:\337;XG\020\327\332\023\356\267\215\363\235<9;\351\222\027"
+	.ascii	"0|R\356\272d%y\2516\350b\214 w\231V\212m\311\"\242D\216\354\017"
+	.ascii	"I\034\022$\245Y\365Jv\001\314q\344\207W\231\2764\313\220uC\005"
+	.ascii	"\340\016\222\261\261\262\254\257R\351\n\304\"{Y\206\354!\227"
+	.ascii	"\204\2734R\331\260\332\212\024y\030\253\213\325\205\273$R\261"
+	.ascii	"\3309#Xt;a``\245\220\266\254.\200\302*X\232\224\005y)\204\345"
+	.ascii	"j\316\374\366\220'\262p\261\"V\206}]\215\021\224R\003c\311L\224"
+	.ascii	"2\006~R\261\250| \341\376N\227\227W\t\204\0029\270\f{nIv\224"
+	.ascii	"?^\002\301q\002\243\207\333\216\224\016\035e\227O\026\262\317"
+	.ascii	"\003\034^\225\255\025Lz\274\354\302\302\225\347c\213\307M\212"
+	.ascii	"\274`J\036\345\016\241\030/]\230r\226f|\351\020\344\342\352-"
+	.ascii	"(\200\345\370IU%\275\330\370m\224"
+	.string	"[\365\354Jq\240O\213j\354^+\017\347\023&2\035\245\326\313-\234\034\201qX\334\345\215\016\263\221\372\323\013\343.\263\252`a\365\026\23793-*\323\212\227\037:\270\257\343\026#F9\243\236])S\007\336\231\272R\213K\005\334\325\313\031\031\302\274X\201\344.eT\266\267&*\336\270K+\f\234\356\250$u\272T\274d\241\242|a\365n.\362\354J\325\274I1C\007x\237\254<d0ca\206\307\375\227\311\227/^V}\020\302\277\234cB\364\224\270K\027\317\261\252\022\307\307\375r\252\244\372\2056a\\iC\270\257\003u>\001g0\246\246\270K\251\177a\261/P}\334e\213\317\335Xi\001\324\301\375\2772\312n+o\211\273\204\312\211S\241d\n\367u\232\316r\305K\030~\2410\256\006\227\026\367s\004\317\277|\372\2055K\364f|q?\007\360|N_\311\304T6\371d!\305p"
+	.string	"\306\027\206\f\360^+\017=C)M\223&\026\323\351\243j\222bW\"Kd\251\244\301\275\327\351\266\260\027&\310w\255\254<d\220R\202FI\251T\261X.C\356\200p?GI``\017>\tc\343\353\025P1\250\322\274\007\347\302\230\261!\204\273\005\355\026\235\033n\311=\356FS\331\316#0\f\211\343\3563,GF\203\355\bw\233\371\234=k\253;\342%*\206\0342\214\224)\323xd\314!7\302\222\200)\332T\024\367s\274\374\374\372\257\376\231a`f\326\237\021\356\376\023\202\205mAq?\207\306\227/-\306\214q#,9\206s\327\005\360L\337[\f\030\216\373Z\222\306\335|V\317J\321\215\001\344\3560\275\264d&\307\203\273\301\330\276\222\315I\013\267\034\026g\227.\215\227W\344\353ZYy\020\002\352\ri\302}\034=-Zz\213"
+	.ascii	"\360\302\222tC\210\004R\331{o\3111\003I\326awd\310\260q\037G"
+	.ascii	"\355\374;/\257\263\344\325\240\201\2003G\323\226\262\256j)\332"
+	.ascii	"\023\356\224\002\253!-\310\356\356\032\257\r\317\312C\351'\245"
+	.ascii	"g\343\257\246\215wE\354\307\022\356\343pQ\241\322vVn\204%\307"
+	.ascii	"\252\274\355\340\240\254^pE9\2451\343>\016T\224(]'\210\224\362"
+	.ascii	"\256\253\271?\254\254p7]s\2352\246\2645\331<\341\027\330"
+	.ascii	"\023\264\277\270\270\236\343{\357\375\252y\213\302\342{\362\236"
+	.ascii	"\263ehpA\323\202\273\345\232+\t\231S\023\367\377z\351\2770'L"
+	.ascii	"\237\2123"
+	.string	"\334\277\231;\337m\265\337\272I;\351\266\363~i@\211\027\276\233\254B\300o\232\234\2771;\273\215o\312:\344\034\311bV\344L\310\304\210\030\024\367\332Z3\331\271K[\270|-y3\231\253zW\270\242p\267\022\r]\312\230q7\233\255\202t\263\342\301\311\323\317\005\325\031\367o\274\312^\326I\316{/2\275R5\006\\Xr,\355\235d.'\314\210\017$\334\215\326\\\214\004\023C\303\335g\025\255\356\250\003k\302\335f\237\023v=\341\253\343\356\264\242\315h\373\273\342n$\237;\005e\bI\303\335Gn\256\306\306\332H\355\363\200\b\\\221\267\021\033\030d\306\306\270\233\210\340\327W\013\261]\340\302\222c-\304&\215Om\006w\213\235t.\270\372\270\033\254\303n\033\0243a\035\203\245k1\245\313\216\351+&O\244 \377\013o`\240\222\253\301\327\325\325?\376\372\274\336?x*\307\027\036w\373\340"
+	.string	"\205\312\313\3669y\001\231\343~\206\270\363o\036\257i\363h\253>\273\310\fY\254\250\256"
+	.ascii	"\357\265B\200\r\334\0234\026Gn\334h\035\265/\204)`9\336:\016"
+	.ascii	"\246\034\342B\013\nwk5\327\177\241\b\240\276\3445W\343H\253\261"
+	.ascii	"\305E\022\341U\221+y\275\305^\266\252\016H\037\367\377\312-2"
+	.ascii	"^\336\270\237a\307\371\226\321W\357\031\357\031mCx\357\275V\027"
+	.ascii	")f\203\027faI\300k\225\364\360w\215\267\215\312v\223\003\206"
+	.ascii	"\334\021\356\306\252l\377\205V\317\007\034\032\356\246Q\321p"
+	.ascii	"\006\315\f\246\315\375\027\366\0138#U\270\237\301\305\371\277"
+	.ascii	"\236\177\363*%\357\275Tez\223K7\346__\313Z=\3748\325\326\001"
+	.ascii	"\374\357{\377\333\177\030q\257\222\337\216{o\365;\303\336\224"
+	.ascii	"fhp\377\337\303\275\310z\357M>\245i!5<\245)\335\247$wS\032\236"
+	.ascii	"\322\264\246\236\322{\203\303M\303q\237\322,dg!\357\275H\276"
+	.ascii	"\351e\322\232\272LYH\244\247\364&o\232\205\334\271LS;O\251\022"
+	.ascii	"\362"
+	.string	")Mk\252>\245eM=\245eMi\270L\027y\231\224n\234LYSOT\262\246v\236\322\224\246\236\230\264\246j\232u+\236\\\252\205t\272iJ8\367^\250\364\013ys\257R\362\"\257p\324\325\342\213\2725n\275#\222\342\270\367\"\331\366\266\262\204\351\322\275{\022\313\032r\272w\357F\201\200\254\310\364\336\253\342.!\353\275Ni\362\336\245,\025\254\356\2757\253bQ\221\2748\227I\tji+\353\306i)K\305\025\273Q\357\275w\352)m++\004\234Z\332\327]J\221\365\t*\353~\335=\255\344\231\206\254cp\322\272\254\240:\006\216\025:.(\356\333\2149\377\246\252iS\365\213\n\244\027i\303\244_\374\355\242\253X\355\006\002/\312\336\270?\244\265\307,\367\270\234R\235\314!\303\342/J\305\341\020P\037\215\2106hhS\"\205\021\3618d$\032\021E\034\235(\036\2118\022\207,\024"
+	.string	"5\036\021\001\351\004\031\021\205(0B\221\216r\216\305#\022\033L\034[@5\020dD\024\362\371\320\007\264\210x\004\200\221HDD,2?\364\201\204\243\023G\324h\344\360\241\017D\" \020D\"\240\"z4:\201H\004t\2268:1\004t$\262`\"\205\021\321\2108,BK\b%\2410n\310P<\222\020JBa\254q\341\210Tt\302\221Xd4\032\026O\030\211\001\320`DL\201\222 \224D\002z$\026;\020dt\302\207>"
+	.string	"\025\201|\200\210\206@?\""
+	.string	"\025\201\204\037\372\220\302\210X<\032A\240AID@FD\020Ec\022\210\n\210\210\222\214\214\216\214j\216?\350\013D\243\311\302Qq\350xdT#4D\211\372\210\032\213\320\"s\003\212\026E\030\321\243\013$\264p\202\202!c\022\211#\321\310\0028)\214\210G\342\260\003;&8\b\022\262\200q\210\022\241%\214B\343\261xD\002=\016\201\216\210\210&@\302\247\202\fN\017>"
+	.string	"\021S\fG \031\213l<0b\204E\203\216\200\214N@\213\206E\021AF\250\211\r\303\343\320\204\013F\034Q#Z\274\t\302\200\247G(\211\204\022(8\020\261\210\032\241)\316\203\260\200\004,@\204\026j\216\306\023\375\021A\001\372\203\"\271p\242\210\006\r\217\210\216GG(8\034H(\211\204c\322\006L \031\213t\202\214\206EEG%T\200\376\224@2\026e8\032y\216.\020!\241%(@\177L@2\026\345\240?\026\250"
+	.string	"\375\031\036\207& \031G\030\035i"
+	.string	"=\016\223\210\206%8\001\311X\304\241x$a$\302\204\321\210\002\035\025I \031\213z\216?\033 a\004\n\027\3309~p\374\t\221B\021\r\032\242\025@2\026\341\004\231\350\013Dc\2030\026\321\022\020\213A)\354\240D(\206'J`\242?h\320\321\210c\361\b\311\006\r:*j\364g\003\307\342\021\022\216\321\350\210xD:\252A\217\303\022AIC\024'\372\002\321\004\372\002\321\304y<\2137AC\264\002D\304\341\211\"*$\224DB\013\307\233\022\020Q \264\204\217\315\36084\241\205bN\361H\302\002+"
+	.string	"\rQ\020\021\rK@\211\202\2107\037\372\320c\374\311p\374\320\007\241$\024EC\264x4\2020:**:\002\022@\220\021j\215?BI(\214f\361\210d\205\222P\330\240\" [s$J2\242E\241\022-\022\203\204\307\017]p\3741\001\311X\244S<:\"\021\213@F4\310\306\370s,\036\221@2\026\t\215?7\307\342\021R\037\177\214#\320\"\342\3614\216p\341H,\001\361\b4\201\243qH\224\203\376\024\241G\243\013&H \031\213,8\032\321$\022\240%R\030\021\203\214P\244\034\364\007=\016\217&\220\214E6\350qx4\376"
+	.string	"\325\240?$\220\214E:(\222\013'\216\350\n@C$\033\241$\022\214\210%\t\023#\202\212\200Lc\212!\221\210\240\"\240\023\375\2711:\"\032\213h\nH\306\"\233#j\024\022:2\215C\241\237\243\0211\t\007}\201hbx\034\006\235!>(J2\256"
+	.ascii	"\204\016\001\t\211\216\216H\370)O\f\035\211\035\bB\213\303!#"
+	.ascii	"\217\361'\347\370\241\017 \216\210\034~\204\204\026A\034\217"
+	.ascii	"\216\212 2\270P<\242E(\021z\344`\374!\261\341\370\363\201\002"
+	.ascii	"V0\016G\030\035\021\217@FIB7f\021%\n\021\217Fh\020\321\006\311"
+	.ascii	"XdDJ\241\241\0054\310\310\002\350qX\fJ\032\242\370i\341\b\305"
+	.ascii	"\n@C\"\024\025\030S\020\205\214\216J8\026\217\2202\034\177\026"
+	.ascii	"\020\342hDL:_\030\372A\217\303\342\017z\034\006!%\375\364\024"
+	.ascii	"\321#\320\2608\034\002\3729\036\035\241@\213;\307\037\021\216"
+	.ascii	"F\304\244\232\207\bQ\202\006(h\200\002'\320\007\242!\261\210"
+	.ascii	"\032\177\220\214E \220\214E \214\210\303\"\020@E#\210\017\001"
+	.ascii	"\370o\346\300S\"c\307\026W]\316\230)*\254p\264\035\224\250\255"
+	.ascii	"\255\376\221\\;\223\2465w\302\024W\340\215\326\361\304\205\025"
+	.ascii	"^V\033\001\342v\245\315\206\230\017\364\276\242\270sL!>j\334"
+	.ascii	"M,SJ\205\313!G\320\213\205I\243I\2132sS3\336\354\224\267 C\256"
+	.ascii	"\332\212\352\351\213\232\214"
+	.ascii	"f\202\201\2558\266*\325\320\254\322\324\2311\370\312\314\312"
+	.ascii	"\231\037\351\031\307\305\026\367\242\223\350X!\317\276\270\252"
+	.ascii	",+\305\270`(\343B\210\227\222;?\252\266a\375\206\3201\231\352"
+	.ascii	"\266&R\232\220\346\212\233\311\337\204\301daJ\2750(X\206\333"
+	.ascii	"\2142[\334\2242\241L)\020\262\356U2\245t"
+	.string	"\320\334\253\244\323E\266\200,1\373<M\347\367j\217\211Sy\314\252\027\342\346\212\fvP\370\220<\231Q\200\f\323\306m6\331\023\f\016\016\016\242\271W\311lbS\205\351t\263\351\265nP\353\006:5{cOJ&\023\327\341x\205\235--m\2615yQ\306T*\273\254\004\177T\341\376M\344K \201sU\201\\\016\2469vZ\364\366\270\317\203<\3772M9\243i\370\240\302!\270\305\206\013\f\225/4-\344\306\314\355,\310\031*\025\207\f2]\314\350\231UUQ\342N{\251\316\005\215\022\260\263\324\340\321\244W\246\313\210\224\271Q\222)\241\210\221Q\204\356\257\251\303\216\035a\245_\371\342\016\311 \017n>\276R\214\007\365\252P\343\262\342\263d\244\304b\364\275\024S%\345,\307\0062`\300\300iQ\t\243n\230]\341y\361\322[\352N\272\224\305\356\353*\211\0255#\\\270\364\226$T\250\256"
+	.string	"\341z\f\232\341\376\206\256\275= TW\2007[\177MH\270\277\001\206\335\355J=\017\352U\261\226\205\211=BF\316\256\314\362R\257\303\204=\210@\005\341.\261\324\224\301a%\214\273\314\353\251$8\334\302\270\313+\f\310\203K\221'\356\022\357_\232\t\007\330\024\356\362\256b\321!\253\021'\205\273\264b\243\352\031'z+V\250\361\310r\204\373\033T\320\321\225T*\227\021\252+f\322\264\003l\312K*\326\256\312\031)\334e]9\207\223\246E\215\216\273\224R\335\260h!\333\341\007\007WB\311\3112Fu\245c\226\006mI\031\367\022J9\327h\342\356Z9W>\271\253\203\241\305g\001[\335\224\\\315\022\200/Om=\325\206\247\326\306}\rS\334\334\3127%J?\222:\314\224q)\337v\004\312\310\022$\262dI\331\244\236]\251\020T="
+	.ascii	"\301\024a\321W2y\331D\247\t\\Z\327\342\2770\0049\202\300q_\003"
+	.ascii	"\023\033\233\205\363\311\262Z\256\350 +\321\346\240^p\177'\013"
+	.ascii	"\332\321J\265\032\204\371\250\2631\204rT,\207\030H\241QhhfH\223"
+	.ascii	"\306\023\026@ HD \222\r\270\261\033\023\200\005\214+\205y$\307"
+	.ascii	"\030b\"#\"\222$\005\225Rk8\3221\001\300p\375@(\ttw_\022wJ\320"
+	.ascii	"sXd\001\305\332  \272\272\356\001\336\310o\325\316)\367#O0\343"
+	.ascii	"/\025\256J\r\207J\233\203\275\223\006\2772\331\004\f\351\317"
+	.ascii	"\275\013\206K$\357\200-I\213\n\341\343\265\374\337s\374\220W"
+	.ascii	"\206{!(?\302\227\002\323U%\224\001\2112)\002Q\300\377\227\336"
+	.ascii	"\347\326\217\004J\231\332\026L72\360X}\324q\250H\017xA\r\237"
+	.ascii	"\031\227%\231\245\214\r\242\340`\261\315v\r\344Y!I\361\314\017"
+	.ascii	"\0026\260\2648\365"
+	.string	"\340;\312\322\352\311\007\377\\\0026\347\314\344<K\310\230\363\220\222l\240\265\021\201\314lV\305i\302p\022Qz%\246\341\211\264\255\b}\003\203\005\304.|\223\307=\336\233D\311o)\253KjPx\300_\264$i^\024M\206^\364\2311\345\200\324&vL\334R\207)\332iL\245\350\337\365c\276\322<\222\336\313\336N\250DPE\331\353\005\370\020\031 \2634q\210Z\340$MY\025\n\241\2016\260\031\020@'\341m\307D:h\005\177\203\231\307\256*R\304}\201\211\215\270\325\224T%:D\345\322{:\217\002\301\263\316\317+iV\227\240Z!Q \302\256\r\350\363D\241\304\375\212\210X\331c1d%\250\336_\371\013\302\271\300\370\032R\320t5\323`\177\006v\2350K_\033\316\337p\253\007\237\223\275\017l\34663N\226\256\227\223u\027\013l\302\316~\345r:g\330}\304\363\241\205\b\227"
+	.string	"\007\030\334\361\b\236cM\306\326\004\361\207\264\210\310\253^\245\366\225\311\031\t\330%\027"
+	.ascii	"\246\221\301\314\327O\300\256\377\211|O\305\362\026\202\370\326"
+	.ascii	"ZB\036x\307\007[\021\343\246^\206\272L\242\242\210(>\270e\340"
+	.ascii	"i\0227_\214\264\360\354\272\301\256\006\3568\233\2604h\3763\013"
+	.ascii	"\323\204\002\335q\202\217\370\013\212\233K*\217]C\r\253\ti&y"
+	.ascii	"\274\330\242o\373\260\371\3478\t\300)\376\243|I\3453\030\276"
+	.ascii	"\t\016e\005P\303\333\252\226\275$`\327M\2756\262^F\300\203\246"
+	.ascii	"m?[)\245bD\367\340EyH\235\356\202\021\372\277\004\260\332\377"
+	.ascii	"\321\270\271\035\340\0378\240\316\370\316LgB7\t{\240"
+	.string	"x\344\027\225\375\210\275-\261;\254\261\013\204\2503\232\277\003Y\215\242\315!\275)\371\250\n\363(\235wi\371\346z\373>P\244\257PC}c\354\363e\377\004H\371\337Xw\351\334\236\300L;\333\222I\372\352j\216\303L\274\207\370j\220\205\033\344\"8}\242\353>\347\352\312\371K\223a\320\"'o\023\231\206e\222\261\260\360*\303(\215\\V\302\201\001\026\273#\321\203\203\367\242\217ay\005\300\300W\256#\227A\371\321\317\331\225/8H\320%^w\212\312e7\3034k].\310R\231\227\333\313z\330\362\376(\245*Er\263\202H\035F\201\017\233bC\363\220z\313X\210\336\307z\024\337\263\007\253\335\312\374\235K6\314\343g\264\r\337\271\020zr-\364\022\253\271\205\332\364g!p\265\321\250/\323\237\016\f\312\nc\001Z[\342S\244\360\277l\255M\302\234e6\302\253pK\361^v\277\336pP"
+	.string	"@Q\001\004;\367C\222\311\207u/H4%\313~ \315\254\366\016/w\250]\032W\246\275\214:~T\254\277\326\245\01674M\317l\265\321\020\261\260\237\007|\272]\201Vc\312A\235\232M\\_\233\016\322\375\261}p\317\342\232\371\253F\274\240O\212\312\235~i]wo\315B\2545\23624\365\304\341G\016\325\266qC\274\352\311Z\320\253\216\320\313\307\225\2131\311\003\241\200\353\366\333\370\311\213t\310\230\017)\334|P\027Z\302\263\276\320\317\370\202\326\207\364Q\353/W+\352Y\330l\247\362\f\201Z\344\016\312"
+	.ascii	"\033\240?\037\203\247`\016\311\277\267g\2723\204\b\251\243\330"
+	.ascii	"\030~Y\220)\350\352b\330\3515wL|\013\2341\020\216>\320}\002\253"
+	.ascii	"\250;\257\346[\016\272\212\003\b\"S\273\307S\251\203d\026\245"
+	.ascii	"y7;\221\305\325\216\256!W\026@D\226E\226!$l\274\301\222\207Q"
+	.ascii	"\247\006\343\275\227:\2011\226\251\030\037t5\026\342\313g\353"
+	.ascii	"v.\345\376\335\276\222\271O\362\235\016\257\324y\222\372]*\344"
+	.ascii	"9\337\231n\251\rt\251^OW\327\256\"\375Y&\3306%\022~\342Gz\365"
+	.ascii	"bJ\330V\025\243T+\237Z\225\f\024\235'?\035;\271\206e\213O\n\221"
+	.ascii	"Wp6%\357\246\231\267\312\2338\231Y\3123\262\351\016\254\371\236"
+	.ascii	"j\234\312\025\332\022\303\006\356(\035F\204\003\303\356(\302"
+	.ascii	"\222!\240\245&\204B\213\351)\246\352\375\336\022\211\332,\342"
+	.ascii	"!\201*%\275\025E\016.6\224$c\310\360\251\224\022;l\217\271\001"
+	.ascii	"\341V\375\026\371d\327'\246\225|\210\022N\034f\302\375\364Y\222"
+	.ascii	"\321\214\2616\205\003g"
+	.ascii	"\r\2474L0\035d\300O\214\224\001\355\004\205\232\304!\nMN]\263"
+	.ascii	"\320\272y\214\334\030no\303V|\004r\270\023\"\232\234\223\245"
+	.ascii	"\327\3300\254\b\332\032\320\234\be\332\240\201\335\331fZ\273"
+	.ascii	"Nk\001E'\343|\327\374\252\205.\253A0?\" BA=\263q\227\340 \311"
+	.ascii	"(YBz\353\315\367\032\367\302\321\344\306\213\023\273\207\354"
+	.ascii	"P*\337\242Xg/\277\270\236\275\"\353\253\200\240~\020.\270\257"
+	.ascii	">\013<\247\261\252~7\227\017R\316O\022<_\345\325\311L\f\026B"
+	.ascii	";\3037P\316\244\026\351\b\003\321}h\273\334A-\213\256\302AF\016"
+	.ascii	"\331\235\204\257n\241\264@\266+\265\365\275\202\033\267\034\270"
+	.ascii	"\312\002]\341\255\025\272*\245P^\245\272\212\r^\263`\262\355"
+	.ascii	"H\3438\314-\362`b\252o\302\361\365\335\357=\200N\2255\022\341"
+	.ascii	"t]\246\243\302\206{;\232\355\025\037AZ\366-\214\356J\300\265"
+	.ascii	"m\224\371\363]\334\361}G}\223\340l\235\343\251\371\3707\002B"
+	.ascii	"\214C\033rr{m\034_\216j\374\rw\0306\022\202\001\222r\267\311"
+	.ascii	"\325G\251\204\353~\313\265h\004w\273q\266\376g\3303\321\333w"
+	.ascii	"F\343\252\361\363}\261\352\360\364\316n\007h\302\322\020\215"
+	.ascii	"\263\223\033\360\273\320\200\300\024|\240\206OL\350\245\211("
+	.ascii	"]\347|g\002\372V\370\245\240#k\021E&\3515A\350\026B\321@\221"
+	.ascii	"d\032\215\024\345\313#\310\245\2665\236\344Y\362~\007\214\305"
+	.ascii	"\334\263\203\225\277\002\361\303;\021nt\034tv0\362\035\266\335"
+	.ascii	"\325#\372\032\274l]\231\335\200b\223\263\347\273\316)\323:\373"
+	.ascii	"\201\345\b\355-\3632}\326\216\335\352OVLE9\013A\377\345\216\237"
+	.ascii	"w\342\307^m\243\002"
+	.string	"6{\350\357\300\244\36026AZl\3175:\326\232\253\243\324=d\251\225\313\n\035\340\r\020\030\036\251\345\374;\2525-,n\3777v\007\236;G@\376A\br(\r\330\312\311\224\022\3043+\315X\247\004<\346\360\345\311m\025\220\321\336\375\2411]\217 .\204\347O\325\030\237\003\241\016\252]\375+\002ln\006\3472%\240\252B\373\320\016\372l@Cc\\J\021A\204\277\0224\243\360\016\367\233\346\020\005<+,\003aCP\025\363\003Y\262\324\277( LG\210K\350\334\035\316#\017\t!\026\016)\252\206o\321\"A\244\352\241~\225\312\213\001\332\003\202\312\353\347\320\206\251\224\341S\371\345\005\3720f\314\221\232\322Z\222\n\030\263\246\316U\363ov\337\2149v\221k\222\360\313\346\252n\017\371t\321\342\221\024\250\376\267\311\n\272\b\036\372\340\362\354I\n\271\2137\024A\006\260]\241\226\232\037\257\235"
+	.string	"\320{\214\0043\017\f\265S\211\007\361\177\211\261\214\261\257O\177\327\277]\301\307bg\020\177\311\235\032W\231\327\002\325\305\363A\340\303\007\214=\210\254\2475c\007%\347\376N\027\311\2549\203\007\234\202\267\230\373\027|\236Z\256a\315\223\270[>\376t\362\213\220~\340z\253s#9\371\017\305\035\354\227\022[\367\341\023\342#\343\017'\225\207\325\255\360\256\363\327\364\035\231\336\272\365Tb\227\312\247\223\263Y{V\037\273V\275\267\241\225\375\252?\030\236\243!\\\313\365'=\363\324n\267\1776\332\021\331\036\253rM\321\263;\336"
+	.ascii	"\340\t\034W*\366\264d_a\177\334^,\376I\3446\027;\251\3545\205"
+	.ascii	"\017\035\376j\333m\360\277F.%\371\342\351.\275K-\310\270\343"
+	.ascii	"\337\2244{\244\213\362k\022\311\017x\333/\346\356\320\370\242"
+	.ascii	"v\362\260=e;\340{\264\367\314\273\304\210\370 \311c\375\336P"
+	.ascii	"\257\214ZR\272\221\357\246\217\375\331Zc\366\342#\270\303\247"
+	.ascii	"\261j\351\302\257-\253\214p\352\005\013\202\021\222oN\372\361"
+	.ascii	"}\256\377'\367\204\230\276\336=,\r\204\275\2158?.t\332\303B\224"
+	.ascii	"\005\373_\356\374o\334\363\310\257\033o`\334\313\303\331bqG\233"
+	.ascii	"\266\246u1\356\254\303?\306\216<}\t\341\224\371\347{\341\362"
+	.ascii	"Q\374\263\220\322S\372T,\340\351\337K\241,7\354\204b)J\366\201"
+	.ascii	"\260G3M\271\017\341\003\335\217\340/\0379\240\356ntt\035\264"
+	.ascii	"\233Lc\233\340s\226\377\030\377\353\035&\031A\3715\021W\317{"
+	.ascii	"F\267\241\276\247\373\036n$\240\344\276\362\310\354\n"
+	.text
+	.section	.gnu.lto_.symtab.a8406c871558a1e5,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"crc8_calc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"crc8_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a8406c871558a1e5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
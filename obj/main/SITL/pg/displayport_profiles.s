@@ -0,0 +1,277 @@
+	.file	"displayport_profiles.c"
+	.section	.gnu.lto_.profile.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\204\351\343\253\004\002\002"
+	.string	"\002\001\001\253\263\200\222\t\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\004\200\200\200\200\003d\001"
+	.string	""
+	.string	"\002\001\002b"
+	.string	""
+	.string	"\007\200\200\200\300\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	"(\b\b\001"
+	.string	"\001"
+	.string	"(\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.18.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 \251\365\004"
+	.string	"\364\bj"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	"\005\001\212\001\202\200\200\374\342\303\244\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\377\007us\350\316\007uq"
+	.string	"\005\001\006'\001\013\005\001\006\035\001'\001\200\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/pg/displayport_profiles.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_displayPortProfileMsp.19.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\215\b"
+	.string	"F\320<8@\217\322\001\320b\3069\372\260\340\3522\0137r\262#\312\265\367)\247\250lCv\354\334\356\302\242\220\211\221)D}\016\020V\270\263p\231\016\024\274b%\242\311&{\247\024*"
+	.string	","
+	.string	"-"
+	.string	"'\300.\355\3310\b\032\001*\033)\253\335\2351\344\336\241\347\337\344\031\323\211t\b\340\260\273\206\246S\307\035o;\301\366\203\355/\216(\373\251\037^\231\226\002\227]\216\026kU\222eDc\373\320>\311K\274\247F\027\330E\261Vv\277\0053d\227\376n\200]f\001\327F\224\245\207\252\0243\354]\204\331\026G\021e\273\333\340\237\\`\034\274\210\\\372#\354\022\002d\025S\202-\373#\301\370a\377\332\335\r\032\267}h\345\204*\345\f\330\263\001i\334\366\241\265\213\bU\332\211:\\\007\332$\346D7+\266\016\305\364T\320\334(\230vZ\235!J\353\324|\373\n"
+	.ascii	"\2633\241L\323K\031\0267\207c,#\230w\t\240YM\twx\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\004\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\017\005\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\020\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"(\265/\375`\036\013\025?"
+	.string	"\312sD\031@@\246U\007a*\317\031\371\361\303\265\241)\271\341\005Xi\324\200e`\355\244\022\312\371Emvt\325\365b\306\324>\3108;!\030\316\276\f\270\227\362\361\r\325\032G\243\213'@v\217\275eJ\001_\001}\001\211\001E<\224\351\232B:\323\335\363\343h\\\r\212\375\377R#\373\377v\263\356^\267\206\016\356\307\255\236v\200\371\017\345\211\024\363\315\233#\220\376\337?\016\310\t\271 \037\344\205<\220\273y\325\3758\237\3666\357\323\376\3767\377\237\302T\223\235/fq\001\332\366.\271\361\370"
+	.string	"\267\311\237\344\366#\271]Hv6\354x<O;\233\337qj:[\373\277tg"
+	.ascii	"\345\316`\251\316\3302\215\333\2663s\373\310\274a\236\212\221"
+	.ascii	"\375\215\303\361\352\224\257\371\037f\227\027n\373E\376\361W"
+	.ascii	"\237r\273D\226\340j\335\376\372\231\247\311\370\247\376?\201"
+	.ascii	"'Dt\3361\334\272\032_\343U\004\216\326\032:4\253D\363e\377\357"
+	.ascii	"\356i\216\314\334$\3346\210\334\316\246\r\240\371\016\375\224"
+	.ascii	"\373\352\b\\O\323k\247J\271\317\350\373\273\020X\302\246\270"
+	.ascii	"eq^\340\003\334\326\245\334\fk>\300\355v3\335^\306\313\246X\347"
+	.ascii	"\226\364\253\377o\324\023\034%>m\270\355\327\007\270\331\245"
+	.ascii	"\334\356\036\324\335kK\335^\250\333)t;\206n\277\320\355\025\272"
+	.ascii	"=B\267O\350v\013\335\236\301w\335\356\240\333\037xUw\363\272"
+	.ascii	"\361\257\333;t\373\206n\357u\267\\w\277u7\\w\227u\267\256\273"
+	.ascii	"\365t7{\275^\257\335\275\325\215\257\272\231\022\004\377\007"
+	.ascii	"\240\264\266\246\207p\333\215|Qw39\240.N)\213\024e8=_ \2751}"
+	.ascii	"=\363\254\341\266\352q\316\247\273\377I,\321U\bn\033\217\345"
+	.ascii	"\306\335\356/\237\377od\351\375'\323\251}\311]B\367\223\263\336"
+	.ascii	"\240\273\333g\033\002\331\377\2248\271\354\005\316\322\tn\273"
+	.ascii	"{\301\367\230\177e\324\277\377tR\277\224N5\177\240Q\357K!\360"
+	.ascii	"\324\260w\276_\320V\372\370\337\367o~Aq8_\351\323\371J\225\274"
+	.ascii	"oJ\225\377/\224\347\254.\225\356\244~A\235T)4\352\233\257|\352"
+	.ascii	"RJnJ\241\316=R(\317I]B\235\315/hTX\234\330\330\220*K4W"
+	.string	":\233\337\305\345\265|\362\254\316W\372n\377^\325\372g\203\177/\351\323m\271\304\327\230\326.f\233\245\364\013p1\301\244\337\264:\277H\377\2770\261\236\213\203\362\265\276\230[\225a^\277\245\365o\340\337\177\256\177\245\277\365\377\225\377\257{z\275\377MxN2.\256\377\350\024\327{)\343h\375\343\352\333\032\324I\005\223\366\342\254\241\222}\220W\351d\357\366\365\314T\345\331o\375\2773\312d\320#\213p\333\355\206\034NG\204\311\006\005\267oS\270k\316\221\021\334\2663\312\355u\3548\233\206\262\r{\022L\273\246c\332\270\3618n\215\206\030s&n\016\035O\203b\206\314\317\344x\332\007\263\256i\007=\036\007J\371~Q\3367\337@\212\253\203\3050\023O\233\272a\301[\260\026\234\005[\301W\360\230W\261\030~\322x\b&\322<\303b\030\t\216\272\325\212\210\262B\024vre\330,\341\265]}\350"
+	.string	"\323\231\302\fQ\034\236\202\253x\025S\351\251\367\277\272\241\273G\005G\301an\215\276o\244\311M\334\2371\024\nPxZ\024\310\315\211\033\006\006\325\346\255\302\b\267\370K\027]\242\007\bn\273}\251W\261\224\334hL\234I}\250\351\316\025\260J\271\331G\271\3317'YP\334\223\266@\271Ykn\226-\343$X\211W#\340%\215\217x\235^Z\276\357\016c\251\204\226f-\267Gp\331\353\325#\270\315\252e\314\246\311\315\232\345n\374\304E\226\250y\344\332p\2214\f\210\317\026s\232y.\345.\220\340R.\006\202\203`g7\323n\272FE\255Kn\254\265\342J\0375\334\266\336u\\\314l\334\354f\302z\266\220q\215\345\306J\274\354f\202r\323\202v\206\333f\247\344\306\277\244v\225c\202[\277f-vI\004"
+	.string	"O\336D\361k\267GrI>'\343\277\331\343Z\351\021n\235\222Wj\237\363Is\034\244s;J\377\313\235;\003w\006\355\024lK\232\3336k$\267\233\017p\237\\\312\365G\275vHMmv\342\316\340\326\211Qn?\344\210\332\023u\"\227\363\350\263\206\324\224L!}4*\301\311\r\033\267\"\214\332\345\032\221\323\177\331\007<\214\305\022\006n"
+	.ascii	"\223H\036.|\007\222\215\205!h\224\372\021\263\232\2104\360q\t"
+	.ascii	"\351sJ\372\210A\343\0221hd\261\222A\"p\350&}U\275\f\354!D\266"
+	.ascii	"H$\360xue\245\343a,\376\332c\322\310^\001\211A\341\320Jw\005"
+	.ascii	"Df\265\304\2420\371\003\"u}\364\005\215\030\236\216VX\277\226"
+	.ascii	"\3071\211\024\006\201-|F\244\212\004\3753\"U\370\210'\222@$\260"
+	.ascii	"E\320\250\240\177\302#\220\b\f\346\346Pu\241\312\303\016]{\370"
+	.ascii	"\220\341C\006\267=|\350\365>T\365rW\365\330dc=\350\242\021x\244"
+	.ascii	"J\026\213G\252&\033D\341\220\004\360'\314\0014\001DfA!},\004"
+	.ascii	"\f\213?\246$2\253\306\325\b\035\305#\323\260X$\341[J\036\201"
+	.ascii	"9\210B\327\306\317j8c\207D\002\211I\254\240\360H\002\230\024"
+	.ascii	"b\351\330\271C+\341\021\350\"y,\262\210J\372<$\211\302,]\367"
+	.ascii	"z%\026\274X\201\"\3770 \201C!\215\342\321\350K\036\213F\036V"
+	.ascii	"C#RxE\0254R\021\205V7\250~G$\025\006\007H`\326\320\n\3061\231"
+	.ascii	"\264\002 \306\345X3+\211\256`0`\246@\321\311\251\265qK\363\322"
+	.ascii	"\355m\336\307\253\330\213\303M\361\376\301\312\254\3753Z\301"
+	.ascii	"\301,\352\2722\226\333\311\270;j,\304\253\356\bs\231:{\225\273"
+	.ascii	"6\264"
+	.string	"\247W\205\247\265Ifh\270%{\233\272%\241Al\322\334^\326\205\237f\206\270\240pM\260W\230>^\326\3353\202\213\224\275\341-1\f\005Sqk\200\264\250a0\247\2203\306\b\215\210\210L\330&\035\200\002\221)+\356\022`'-\213\234%\"\244 \005\311\260\237\001@\207\346GcVb\205\253i]_>d\246\005TR1\321\377\322\325r\314\001[s\034;4s\330h\250\016A\026\272j\371\242N\363#\331~\204%\271\271\317j84\377\237\302\354\226\354R\302\300\304\371\372\004\006\346\\\242;\227\201\200\275L\024^\b\303\223\326\242\006_\372\364\272`\350\307\375_M\024\374\033\270\202\025\177\365\ne\333\312q\213G\220\033+\2555\346\252u\006\024\023\032OHu#\f\2240Q,\261\360\243lr\177\366\024\213\203\245\320\334J\024\215`\232\201@\031\032x\363\376\215|\\KV\373\276}\364\307\374M"
+	.ascii	"#\216\312\234\333\006:\"K\273\234+\366\232\230\231\316s\204\026"
+	.ascii	"\200`\347%jn,\221\004\310_X\b\355%k\274L>\241^\271\230\020\275"
+	.ascii	"F\032\330\335y\373\203Pi \302H\364\265n\324\005\203\371\243\267"
+	.ascii	"t#t\020\342\222\335\351\264\026\342a\322&\031F\001`\274=\001"
+	.ascii	"\\I\345\314\306\321\3568\276\276\212t\204\250p\020\375K+*^\303"
+	.ascii	"\222\357\343\313\375\327\224v\264\334\311\205X\003\360\314\350"
+	.ascii	"\277\250}\013.\300\333i\003\330\177\005\bi\362\354O?\366\003"
+	.ascii	"dL\201\274%*\225\025\211\n\020\037jeX"
+	.string	"\024w \b@\031@+\203\013\365"
+	.ascii	"\200\276\355\240#\322#\034\376\272dGx\370\253\002"
+	.text
+	.section	.gnu.lto_.symtab.c2f2be6fa27ebbcf,"e",@progbits
+	.string	"pgResetFn_displayPortProfileMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c2f2be6fa27ebbcf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
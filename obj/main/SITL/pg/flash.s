@@ -0,0 +1,267 @@
+	.file	"flash.c"
+	.section	.gnu.lto_.profile.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\275\321\333\306\013\002\002"
+	.string	"\002\001\001\302\216\214\313\001\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\004\200\200\200\200\003d\001"
+	.string	""
+	.string	"\002\001\002b"
+	.string	""
+	.string	"\007\200\200\200\300\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.6bb761860fb7892b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashConfig_Registry.12.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\303\254\311\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\347\006us\350\377\005uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\372\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/flash.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_flashConfig.13.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\275\007"
+	.string	"\002O66P\217\032\003 \315\243\340 /\211\201`\254P\026NB8\214\235!\216~#\027\006\352\177\005\227X\347k\317\314\224\316p*\024\tQX9\310\354\261\365\226[\312\224\002\236O\007\264Ah\345h$D\233\211\316\364\204&\350\263\241\230\034N45\007\335B\021\334\254\3306nj\337}=z\225-+S\314h=\302Z\013\243\214\262\377\r\365\311\005\206\001H\210eM\302,\035DX0&\330j\277\022\214\036\255\257\377o\364Z\247lx\r\250d\\~\216V\314W\222eDkk\330\232\304%\235S$\023\374\236j\345\377\026\252\220Y\366s\006\263\314\\\200Y\266k_\0204\004T\033)\254\3773~\2703\354j\2338\340\204*\031\002<\374/<\241:\334\350\266\tm\031\332~\001\n"
+	.ascii	"d\221'3\364R\201\305\303\341\230\300\b\346]\002hVS\302\035^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\r\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f\004\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\005\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\n\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6bb761860fb7892b,"e",@progbits
+	.string	"(\265/\375`$\t\3455"
+	.string	"\232c\244\025E`\246Q:\023\270\204\023Xg$^\2137i\374\020\202\246\224\323l\322\217\035\267{\007v\016?ZE\347\341\230\346\005\232\251\237\265Yh\243\026\355\005\3234\347\222\2256\027\223\377\030\002y\005r\204#FJ\376\226))\001B\001J\001J\257\345\262\333\251\264l\255\243YU\367%\263S\326TF\273\236=\263-Q\257\256\321\036\331\253\325\270\230l\364\230\245\255\272\233\373\260^\315\035|\256\3723\031\036\263;+2vvU3\245k\303k\217\331U\317\315\236\303\276\260\030Y\205-L\026"
+	.ascii	"\327\035$\314\353\302\337\373)\\`0\214\205\305\022Pu\007\331"
+	.ascii	"2z\263\266\345\rPw[\306aX\fC\031\fs9wa/\347\266;\331\335LLLJ"
+	.ascii	"k\216;z\314\260\352I\260J\234\264\342:\214\251>\330\024ir\325"
+	.ascii	"g`_\201\345\226\2630t\211\243\247p\341\270\243\226\006\353n\215"
+	.ascii	"v\205\250\024z\273\352!\260g-\027\240\245/\274\210=/\255<\345"
+	.ascii	"\245\365\227\345q\322\372\363\225\237\2550\330\022Ni\365l\262"
+	.ascii	"\356\366\310\250\365\261$r\325\267\234\264\262\214\264\376\017"
+	.ascii	"\363\177,\367\263\224\237\005\374L\340\347\244\237\221~6\372"
+	.ascii	"\371\350\347\001?+\371\371\271\350\347\035+\370\317\373o\205"
+	.ascii	"\237\227~F\360\263\001\263\377c\376\203\375\327\375G\373\217"
+	.ascii	"\233N\247\323\377V?\177\375:3\001W\343\244u\307H+\267\351\235"
+	.ascii	"\335 \255Lg\333FDm\316\260a\271j\021K\331s\0316s>\3633\214\306"
+	.ascii	"\316\306\255\241]=\001\324N\347\203\034\031\034[\276\316\316"
+	.ascii	"h\317S\324\r\326\335\t\212\234X\361\271q\325\273\261\232\377"
+	.ascii	"C\271/G1F\324\244\t\260\024s\3034#\n\223\203d\355\252PF\303\\"
+	.ascii	"\376\367P +9\336\276\330\337\177m$\263\273u\344\332fR\025\235"
+	.ascii	"s\314\017\376\035\343\270\301\177\265\373\004\324\272} ic\277"
+	.ascii	"\304 \263\256\372\177A\177J\367\361\250\333f*\243\\G\245\030"
+	.ascii	"\234\346Q\333C\nt\224H+[\256\246\372\354\333ms'\271\232.\224"
+	.ascii	"\355\223\251l\237G^'\237\307\356\266\311S\222!\217\254\214r5"
+	.ascii	"\225\321g\363\250\223}\354(r\b\233|6\225k\236M\2362\212l*\223"
+	.ascii	"\\\315\243\036H\212X\261\241DK\022~\243L\366\325R\013\311\344"
+	.ascii	"I\225\355\263\325\272\231\254\252\231\r\272\265\236L5$\026\227"
+	.ascii	"QI\257\250\276 \237m`I\325\365\354\244T\t\345\331\r\205J\252"
+	.ascii	"\227\026\216\255\264\223\260\364HD\253\255\252\272\017t\333\275"
+	.ascii	"\354>rK\273\373\330\335:\246V\333\r\204\027"
+	.string	"R\347\206*j;.\326\365qy\\\346\325q{0\3646/\215\363\036\346\223dA\267\311\203n\263\024\t\007\260:lLLLFmV\306\260x*\273\035O\002*\245\210\260<lwys0\364^]\251\355W\370{W\267\306\265b\251\263m\035)\364`\2051\031`\332\361\221\243\226\265\252\377\265\2728\276\264G\372\\\365\336\3209\261\320h\304a\377\253d\350\265\301\272M1{;\021\032%]R\366\367\214\375\005s\251\3304\266\2556c\354/\224\375\005c\231\020\027b\250\003\236\236\3378\3549d\333\355]B\210\013\364\213=;Xq\323);X\177\233\2607i\3755\302\376\016a\177\376\343'\027=kk\343G\354\306acE\265\305\362\030i]\300H\353}\300H+\257q\036\326\363\017\031U)3\342\245\007{\3063B\211\033/WU\371fV\266s\276\363\017]4'^K&{V\343:\377P"
+	.string	"\265&\\\262\\\365W\311\236\351x\231\266\375\270*\317a\253X\220\003"
+	.string	"[a\204\360\234\237\245\374\206\323T\024\2301%\364\347\252\034\207\345\234\323\030N\232\205g7\222\323\214\006u#\215\230\03103P\253t9\351\262\252g762\206S\036x-~\306\242\f\023O\002\214\227\222"
+	.string	"\034\"\371\204/\210\204+.1W|*2>\t\201\303\234\0208\304I\031\201\302\037\213\325\370\344\324c\1773\202E\265X\374\021\243\242\240t2\206S>\225h\034\342\242~B`\220\005\224.\352W|\241\n\247\202F\337\257\250;\361\t8\224\260#BI\371T\031Dc1\b\374\225\030p\337\223\020\204\361W\374\225"
+	.ascii	"\016\223\356\013\022\177\302\037\220\275\005\247\bN\030b\350"
+	.ascii	"\216A\303\004\r\023\326c\320\320\353ip\352\261w\352\341\214\227"
+	.ascii	"\"\360\251\341\217\330d\234\232\"6\021\231\210\202z\341bW|\002"
+	.ascii	"\006W\b\247<\354\214O@\250\023SA\035\020\352D\321\2273>a0\n\203"
+	.ascii	"/t\357\365<,@1\"\004\353\223"
+	.string	" U\204b\261\242\t8l\022\006\241Z4\371\210\305&\tI?_\020\306\357CpX\034\022\202\306$\316\022&wk\013LQV\215F\353\312:Co\026\217a^w\027\216\262f:!\004@\322\2212\204\n3\2333\033C\231\315\375\241\224\245=\022\265\251ajA\330\321I2]rUg\233\324!\351\314Qs\325\343\250\3303\230\033\377\t[k\003t\347\"o2\212\033\006kr \366\003f\207\255O\363V\335+\226:y\235\f\003\210-\3546\357\221\3058\200\227\250q4f\020$\206\310\210\b\311L\230Isp\002\221\251\243\352\021\220\255r\210h\264\251\321\001\366.V\235\317\33575\3573\236(u\314wuHv!L\027\360X\217\261\352\n\300\363\002P\016\364\023\n?@\261\334\\\203\230\237y\377\204\324m\354\324\365\002\301\340\266\342\322\352H\356\t \317\207\241U.\037\017H\377\363rd\262Z"
+	.string	"\031_\177\341v\314\344\037\004W\246\031\305\245\021\316\335OX\270o\246\2253nnu\354\020\205"
+	.string	"\206d\246\2030A\021\023:@\311\204\210=7\350oYpP\246\307\2709\224(\326O\021\313\263X+\202Jl\301K;R@\321Y{\244\340\227\357h\2741\300\020\340\221\271\244\021\3558\"A\f\3700;\206\367\347\261\204\b\3004\007\036\203}.\340\244,y\005=\3043\022s\202R\331q\bR'1&\264={\314\217\0320cHQ\276\302\003\\\342\316k\322Z\274\224 \240x)Jn\233\234\025&"
+	.ascii	"$o\024X\rL\022H%\341\350\306[\343\3410Z\365\227\247q\314\374"
+	.ascii	"\306\006\374\326\303C\202\310\3641\342\205>\371\037\023\316\334"
+	.ascii	"\243\246\240\312A@\252o\016t\374\376,\307\266\256\261\231vR\317"
+	.ascii	"y~"
+	.text
+	.section	.gnu.lto_.symtab.6bb761860fb7892b,"e",@progbits
+	.string	"pgResetFn_flashConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"flashConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"flashConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"flashConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6bb761860fb7892b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
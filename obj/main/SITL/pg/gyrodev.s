@@ -0,0 +1,321 @@
+	.file	"gyrodev.c"
+	.section	.gnu.lto_.profile.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 ;]\001"
+	.string	"$\002/"
+	.string	"\004"
+	.string	"\355\371\207\343\017\n\002"
+	.string	"\002\001\002\001\217\261\245\234\017\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\240\377\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 <\265\001"
+	.string	"\324\0020"
+	.string	"\001"
+	.string	"\006\n\200\200\200\240\002g\001"
+	.string	""
+	.string	"\002\007\200\200\200\300\003d"
+	.string	""
+	.string	"\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"YD\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 S\365\001"
+	.string	"\022D\f\025\260%\351\207%\311\243\f\2440\024\301\340\024@\320\355\366\226)\005\352T\366\213\032y\324\217\332\002F\305\251<\314\016|0s\241v\366H\217\314\273D\003"
+	.ascii	"\366\214\241J\310\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	""
+	.string	"\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.8df436c59bf83d4b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroDeviceConfig_Registry.31.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\306\201\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\365\007us\250\305\007uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001\002\234\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/pg/gyrodev.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroDeviceConfig.32.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"u\f"
+	.string	"\006\230WD\020o\234\016\300z\264sR\321\335"
+	.string	"rbxc\022\023\241\016\231M \353\376\237(\204\320\250\f\034\260hz\f?\260GX\326\001\"\351\204\375\377\377_9_\005s\266\271\267\337q\177\300V\033\242?-i;\245@"
+	.string	"C"
+	.string	"E"
+	.string	"\341G6\036`7\365\302dwD`\003\331\251\307\017\300N\263\013\300N\035\3320>\202\354\313\016\013$)\273[-\017\017?C\377\345-\242\007\352\263\302`w=E\217\f\267u\333\005ls\354\207\001\033Bbp\314\225=\242\246\325\301\376\265\273k+e\177\344\237\226\005\037)(\231\022\273\035\253\031{BW\2008\371\333\177\351\213=~Dx\362\224\255\211\003\026\032T\273\030\016\234\272f\247\t\260O\373!\027\t\177\007;\211\227Z&\332\0337/z\226\210\234T\260P\237\253\370\211\333\020\216\"\313`vw\023\2377\266\204\227!oN)J\212\020/a\366\350%%"
+	.string	".vw\343\223L0i\200|8\3657\260S\315\205\026\001\nD\336\326y\334'B\203\356\023\205F\032\346\201\367i\244\315S\261\246!m\236\0174q\225\003U\357\323\351\252\006\206\252\206\200?\320\006V\321\367\201\3652\356\257\265R\276D|\310PqX\024|\272v9pN\376*r\256\214\231\001\021"
+	.ascii	"3CK\215A\201\215\207`\302\002\303\360\231\360\317\303\020*cQ"
+	.ascii	"G\230\232 \352\032m\206\2032e\0304\221\247^\001'yqM2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 k\005\003"
+	.string	"\364\004g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002 \177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\037\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\034\t\201\204\001\035\n\001!\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\244\001"
+	.string	"\005"
+	.ascii	"\\L\032\341^\\\326,\2031\004\n\n"
+	.text
+	.section	.gnu.lto_.refs.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8df436c59bf83d4b,"e",@progbits
+	.string	"(\265/\375`\271\016\225M"
+	.string	"\272\2118\036S@\022\346\244\003\371u\001\260$\255\337\263\030\341t\200\333\353\1774?\216\\\205\354\221\267\003\350\030\225i\371\225\314\236\243\356hS\277\371\302\261T\315h\240\357\372\252\272\243\275\2129\006fVg\325\374O\203\237\300\234\356N\n\315\263\377\2112\254[\242\304J\231\002\227\001\312\001\324\0017\307\234\356\253.M/\273\266X\266m\310\231\265\245\331\335=??\250\017`\312\222\350\371=\323\222\004\227Mb\267,s\341\316i\367\322\216!\261n72\335\3138\254\356>\003\177\320\027n\337\326M\005\216\356%\221\024niO?\204\351\356\037\236\237\237\341\226\0201\365\3742\353\227\253~\227\324/\221\372\305\362\357\326r\255\333.\273\227\272{"
+	.ascii	"\336\016\264&Q\370\334\266=b\231={\345\313\266g\2279\246\235"
+	.ascii	"~\031\242\224\344\363;Ua\350\256\253\333\036t\331\202\276F\240"
+	.ascii	"@\243\224i\177\355\314\2440\321\361\311\013\244~\235\352\233"
+	.ascii	"\273\203\336\274P\267\210\225\262L\236Mk\234\275\242\364$\305"
+	.ascii	"\347\2115\206\256[\036\364F\365\276z\024j\216\b\225\307\203\312"
+	.ascii	"bw\320_P}v\007\005;oX\023b\204\317CP\017\243n\327:Y\346\212\035"
+	.ascii	"\342/`|g\354j\255\356\024\307\346\t!\236\020\303\347\025\250"
+	.ascii	"_\257\24386\214\327\324\357\nt\353v\005z\2562v\007]`wP\224\311"
+	.ascii	"\277KV\213g\207lZ\366Ww\252c\003G\267\306\306\347\323\335A\353"
+	.ascii	"\242@\377\035\341\204\377[\376\303\375\177\213\373\317\345\377"
+	.ascii	"\227\377io\352\374\274\342_\032\377f\360/\006\377Z\360\357\004"
+	.ascii	"\377V\360\357\005\377n`\302\277\b\374\013\301\277\021l\t\377"
+	.ascii	"s~\266\341_\022\376\375\340_\017\376\345\340\337\233\377t\377"
+	.ascii	"\312\374\277\362\377\211\377c\376k\375\257\371_\345\377\256\256"
+	.ascii	"\256\256\356\277\331\317H\376\232\026\001iG)\325|ev}~\233\335"
+	.ascii	"m\001\377\317\356\273H\322]DN\256\372Pv\374\301\347\177\026}"
+	.ascii	"%\335F\235N;\n\351EeD2\257$u\322\236\032\240\275\20242\245J\236"
+	.ascii	"\313\346N{{\211*\311\0022]F!\323\2451\247\227\226\306\3564\231"
+	.ascii	"\203\374:\032\027\351E\225Dz-\223:\275\324\306\366:N\325\245"
+	.ascii	"e\022ie\231\314Az\035\223\310%\252\244\016\017r;\030\221A\013"
+	.ascii	"\025\225M\"\227\372\311I\352\030\225\323\206L\227\375\326\275"
+	.ascii	"_L\035U@\267\3242\352\355\310c\315\224\332\236\224\304\216\313"
+	.ascii	"M\235\224\252\226\275\324\206L\262\354N\242T\324N\r\030\323\266"
+	.ascii	"&\262m\306 R\335\304\324\235\242\323n\247n\343v[w\033\273\233"
+	.ascii	"\027%\225v\373\310Ab99u+y\234Z\312x\306\324\315_\\\314\222H\257"
+	.ascii	"\252e\320\331\020^X\235#"
+	.string	"5.V\277QEU/c\223n\352\356\005S\261\2224|\341\223q\254\333\022N\350\310\252l\344\3432y\351g\245\035\373\331\265l\257\356\324fw\274a\255\214\317\323\007\305Y\037\364\347V\002\005\213\203\032\253\363\262k\276mA\361\371\357\023;\346&+\007,,|\322\361\330Li\022\023\206\317\263U=\f\"\276\232Zske\225`+k\246M\310\306\310\366\t\2242\263\r\013\333\263(\373\344f\327\215\003\030Vw\352\3046\261_Vn\303,\023\273\304\212Y0\313\334\271\245\362U\333*P\304\366I\226X\263;=\003h;e\333\224\017(\341jr\275\200\261s\373\265a7\306\264\241f\214\355\320\n\323\235\376\240\\[\224l\002\234\315\236\035\223\265\265#t\265\313\306-s\275l\226/\\\034\266C*\233\006\007\252\234\242\244\022\340\235!9\342\203O\260t\211w\324\202\004\225\260\372\325\032\302W[IX\355"
+	.string	"\347\003\377"
+	.ascii	"\204\021<0\021-.\254C\027\007\301\\\333\246\314"
+	.string	"\351%\2620g\334\305H\336\274\370\213\2370\223\233\260\023\036b\231\334\305@\234\203\260\220\363p\027\027\341#\3336d\002\255-M\034\271%Ox\344\234C\036\247B\t\251\301V\227&oq\272L\346:O\332\375\305\305J\230\311\266)\323\336A3\326t\263\322\363c\363\005\313\333\017\224\211\226Xj\005\206O^\302S\362\250\202\343J\210erV\235Sr&\346q4iWUV\365\347T\375YC\222\232\245\t\344|\252?e\250?\225*\033\341\036\226\331\202\261x\2071`N\234\250\337\026\350\256\256n[\240\337\315\325\357\342\352wo\365\347+&\"\343\245&\307Fd\237\260\333Z\223\022\226\232\263(P\026>9\360\024S\37538Yf:@\261R\317\313\016\256\214\200\362\"P\006r\306\341\237\341*=`9\245\325\363\017\226\372gn\336\214\2005\341\363\273\262z\366!\003\245N\256\007\237\334\2432\355\232\264"
+	.string	""
+	.string	"\bY\016\334\343g\032\270\006V\246\360B\335\030&\370\344\033\230\307Y\3116\260\262\201e\367\221\2258t\335G\234]\002v\t8\263\252z\bC\317\357\264\352\337v\007\265Y\024('\203\316;h\330\2444\271\370\254\331Q\325s\016F\236u\\\007?\325\356^'P>\220\204i\245\322\007U:bY\304\351\374\364.5\255\342\346H\230\023\032\237\237\343\246\37737\266\320\222\334\3043\250\301\005\261\242#\002\f\252\212O&\313\260Tf~8Yb\255K=\377h\037\243\272{\207L\303!\242\340P\021\004#\341\020\003\"\033@$\025\fH:\022\322H\22144\034R`\344+\022\223@\020RQ|\221\213\337\021\212^\020\211&\270\002\017e\210B5E\241\340\357H&\370;\332\025\025\177A\237\r\264\372^"
+	.ascii	"\022\317!^\322\221\260w\016\213G;\"\037\217\310GD:\203B`\261"
+	.ascii	"\347#\362>\024\372\035\271\260\031\016\025\365\316\244a\221\b"
+	.ascii	"\374\371>\350yO(\210A\321G\364}\360;J\361\036p\350\013\372~\365"
+	.ascii	"\r\304P \206\214\033\274\313\230\261\300\214\005\320\313\230"
+	.ascii	"\021\0244#FP}\214\240\235O\350\246\370\"\236\342\213\\\b\001"
+	.ascii	"\005\205FF\302\336\001\027\036\371\206@E\241p\bDc\303\206px\026"
+	.ascii	"\365\212\300#\031\027\206\222vHBC!1\350#\352\024\205b\004\025"
+	.ascii	"\203@\236\013C\303\035\005F\302\"\021\251\207C\024\372\001W\b"
+	.ascii	"\ni\370z\300\026|\026\004\200\336\360\021\005\2012\276\243\244"
+	.ascii	"\032D$\025xD\244\n\200GD\3647T#H\354\241D\244\nz/\200(\221\350"
+	.ascii	"\033\022\021Q\320{\001\004\240(\364\033\252!\004\362~C5\200\305"
+	.ascii	"\033>^QHF1\bD\342=(\210\006\213\020:\310\240\366\\\264\340#\022"
+	.ascii	"\016\223~@\277#\240 p\310\b\2507$\002\271\030\240\030\364\031"
+	.ascii	"\005\177@\033C3lj4h[\272\220\255\231\325%\253)1\266\362\224\243"
+	.ascii	"\312I\023\237GCc\265\355\352\361\244\364\3415AQ\245Q9\253}\306"
+	.ascii	"J\251&\206O.\202\247\324\3740\226c\bOI;qd5ii\326\037Y<\220\220"
+	.ascii	"\262YzP0oE\2520\223\004TYt\360y\031\250(Q\204<\321 \3511\327"
+	.ascii	"rbL\026c3\237\234\356\252+\263\216R&P\323\344\205\212\317\363"
+	.ascii	"\030\223\355\230\223\007\023\016d|\276\b:\227\241J\320\246\232"
+	.ascii	"\330AU\234i\365+\304r\324\271j\231\034\025\200\375\250q,\247"
+	.ascii	"\220C\310\210\214\220\210&I\322\001p\002\221\251\252\321\003"
+	.ascii	"\021P!s\b\031\215&I\2515\370\377\350\261\340\220\02345\261\275"
+	.ascii	"s\371\303\334\351\317"
+	.string	"\223f\260\231\231\224\357.=\240\325\001U\004\301\375|\001\354\246\343K\r\204\222\327J\274aC+\310\346\315\310,$\340\265\023P\033\233\025\351#\367(\2761 \310H.\227\031h0\205o\300\344\005\240i\264j\002\274DE\026\025[;\321\353\363\272\007?]6p\335\312$ \007\212\016#>\"\240!\313\302\212\036k\251\335\320\305\036\036\272A\021\351\222|n\311X\314\1774*\0319\376\227\024:J\316\306\177rk\035H\226\251\357\021\327\035\305\302"
+	.string	"\336!\275\342/\230\366YJ\261\207\232\034\203\340\365\024\016\3578Q\303\005r\007]\211\243N\210\341\231M\260\214\r6\022\017I\343^\271n{a\313\3512\307S\333\3268X\b\247\bh\357\360y\233Y\200c\262K73'\035\235\246\203"
+	.string	"\306[\001z\177\\sN\006\324\3639m.\330\006.\303_\247b\274y\335\343\261\372\237\030xh\257\te"
+	.ascii	"\223g\274\001\376I\216\377m\254\216.\211\321x@p\323\335\020\273"
+	.ascii	"\t\342\266\356\240\033\013\021\030\256\341\361\335\236\272z^"
+	.ascii	"\375Up\245k\302\263\272\331\260\356\004\212\270\024\242`\210"
+	.ascii	"\205\031&Q\236\\\243\310\340xO\004\262\"it\312\232\306I\247\024"
+	.ascii	"\251\002\242\266\303\006\f_\344+\220Ph\201rpI\275\0030\200\341"
+	.ascii	"\334,\274\034\035\257Y\265\030@\312\331Z?\357\333\322R\212Q\311"
+	.ascii	"Y\032;\231W_\346\032\276_\356\320<\306CQ\025\361\207\323'\327"
+	.ascii	",D\203xD\201\2028\025\371\023Ut\221\234\036\311=\315\340\360"
+	.ascii	"\347\323\013\234C\342\2467\001,\352\362\233\371\350x\007K\360"
+	.ascii	"\245\352)\375f\036&\367\363\025\330\034t\241\220\361<\307\b\r"
+	.ascii	"G+\233\361\254f\375[F\344\276\321\222+\312Zppa\354}\037\354\255"
+	.ascii	"\236\312\351_\313AY\177\006F\377"
+	.text
+	.section	.gnu.lto_.symtab.8df436c59bf83d4b,"e",@progbits
+	.string	"pgResetFn_gyroDeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"gyroDeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"gyroDeviceConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8df436c59bf83d4b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,309 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 O\225\001"
+	.string	"4\002C"
+	.string	"\004"
+	.string	"\347\314\242\376\005\024\002"
+	.string	"\002\001\002\002\001\201\303\213\223\r\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"@\nx\260\342\356N\244\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\031\231\246\205\214\003j\001"
+	.string	""
+	.string	"\002\032\342\222\204\300\002i"
+	.string	""
+	.string	"\020\344\327\203\300\003f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\r\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 ;\255\001"
+	.string	"\304\002/"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001\004\002\006y\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004\001\007\001\002\006\035\001"
+	.string	"\006\035\001\007"
+	.string	"\002"
+	.ascii	"\276\210\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 j=\002"
+	.string	"2\204\f\025\300%\035\273a\377\246\377\027\377\240M\177?,A#\215H\231\002\337\232w)_\343\352\016O\005\363n\351M\236\350\367E+\336\234\220\003\334\001\261\367\020\007"
+	.ascii	"<\005_u%f\303?\0053\345\036\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.3b379ebf1f1dc056,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.16.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\346\006us\350\376\005uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\206 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/motor.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.17.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375`\366\003E\030"
+	.string	"\246\251\225L\260\022R:r\241zpI\232\016\273\235t\325\231'\342\263~]\355O\203S\370%K\001\003\311v\013\232\336\004\016\307\255\266\241\245\357eY\177\240\222\371\026\2653\224o\255\306\300y\0308\206\375\242\t\"\222\262Y\364J\b!D\356$\003~"
+	.string	"|"
+	.string	"\204"
+	.string	"/p\357\345\\\300\275HUQ\367\376\0300\002\364%\377>\300|\211>f\276\3041o\025\360\t"
+	.ascii	"\005\344d\274\367\252\255\342d\364\344\357L6\356\350i\226d[\034"
+	.ascii	"\337w\003G\\kN\347\350\255\206t\303\037{\026\335\034\336\032"
+	.ascii	"\361XsE/\311Sh\350\212$\347C\256tq\035=x\033\224\343\261d\013"
+	.ascii	"\242\367\203W\240\373ZsD\267'\204{/\33357\342,rf\3761s\013sk"
+	.ascii	"\005.<&\224\305o"
+	.string	"&\263\315e\334\320{\257\003~\f\032\2104i\305K~\216\371r\202\013\343\217\035{d\376\351\330\3361\177\245\353g\211\033\2119\215\265e\330{?z\341\231<\360\334\326\262\265\226O`v\242\313jFc\375\256\210\243\220K,\247\224.\374\201C!\354\366\240 \261\304\302\377\361\203M\207\201;\220\251Pz~7\307\242\363\301Ky\311\r\320\227(\244\035a\346[\346\363\036\344\275\367\222\013\336\235\366}\350\276~J\360\330#\277\231\031\347W\026\016$\335{W\230/\\\007\206\223b\216\264\324Z\275b\026\326\344_Lf\r\033\354\327\367\203\277\222\320\004\321\247u\270\033\326lW\257\035{\354\036\n\001\221\352\336\301\034\307,\275a\"\322\344\304D\246\210yU\006\237\361,\312\274\206I\213\217\251$j\346T7\223\007=\243\310g&\263\354S3\251\027\236\261\2114\207\272\235\024\271\366'\017/\003\262\343\310p\240I"
+	.ascii	"0#\353@\253E\030\341\030\025[\355\246F\243\316\324\2504\031\f"
+	.ascii	"\215\032c\263QUR\256\325\310\330\324\233Z\315\246\216\360}#\261"
+	.ascii	"\357\250\260\212\270\323<h\357\370\264a\306\272\263\312\224\223"
+	.ascii	"\035\204u\262\337;\311\216u\b#.\373\341[3\265H\341Z.=\322\325"
+	.ascii	"\253m\177\370\222\206\321\027\320\020\223\244\302w\314\356{\202"
+	.ascii	"\334S\331;.Y;\355\316\262)\357\016b*\263\333^\001\263zl\220\007"
+	.ascii	"X\250q<\345\234aDf\002\221@(L\211\033\300\002\0212b\035\021\300"
+	.ascii	"di\214&hSc8\247rI\007,!O\273`\352S\024\275\337L\261\252L\355"
+	.ascii	"LF\267\255\247J\017\225\033R\366\003\337\006\372\331\321\267"
+	.ascii	"4\376\023K\005\205\205\177aJp>\"\255\244\233M\030\376KkR&\220"
+	.ascii	"R\311\031\\\027cq\344\177\316\224(\244:\220\013\206\266C\354"
+	.ascii	"\325\024\245(An\t\313n\235$\271\344\003'G\002-\255\325\331\304"
+	.ascii	"\226V\2738\324(~\247\207\311\231\337{s/\312\266\220f\242\242"
+	.ascii	"qW\243\273\r\b\245\254\220LX\246\250\027\376\324\316\233\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 j\035\003"
+	.string	"D\005f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\006\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\r\b\201\204\001\016\t\001\022\177\n\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\321\371\216\307\003\001\244\006"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313\340\013\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3b379ebf1f1dc056,"e",@progbits
+	.string	"(\265/\375`\222\016\265N"
+	.ascii	"z\213l\036T@\2222J\007W\242}\313{\013\270a\2721\311\2424.p\032"
+	.ascii	"B\245]\002\b\274x\266\262\203q<\350\257#\350\224R\374\205\001"
+	.ascii	"\355V\202Y\370\311{\371G\275\337\031\273+k\242\324\202\234\321"
+	.ascii	"\\\344\216\347\372\025\215qVCct]z2"
+	.string	"\342\333\004\344K\231\002\232\001\316\001\326\001bW[\304\030\230\333\231/e\206\020\023\343\0074B<\020c\335,\231\r\353\241u\3130\346\252;\375f\375k\305\315\246Y5\2334\336\3002\202\254\273\017\301\177\373\272Y4[eES\367Q\006\0253|\205E\231u\247/^\274\bzQ:Q-\361\021T\252\t\253-9\373\321\206\313s\016\365,U\317.\324\357\022\365\233\246\006\211\251-\276\252P\017\325\201M\256\330\b-@5\n\235\240\270\034SB\211\231\001\t\227_&u\303\334\276bR\230Dc\332>\006`\341\242\205\313\332\"\2513\242\352\315\326G\335-\013\304n\261X.\177 \306i\300)\215\344Y\342\311\022r\270\274\n\365\313\302\334\263ea\336\250>W\027l\201L\0024\250\007\243\240>\031\243\332\310\026\310\334)Ke\267\\,\3277\335\254\353\004\323N\273S\037>\242\204\025*\\\236\201\372\325:"
+	.ascii	"d:\306y\352\327\205I;;[\027\346\271\362\2460[l\n"
+	.string	"\323\266@\346\277=\374\013e\221.hC\247cwu\247?U\270\305\013\311\345\323\0052\353\2460\377\257\371\237\346_\235\377c\376\227\375\027\373\367\003\021\376\037\361\357\376K\373\227\377\267\371\317\345\277\232\177\377?\316\377\263\357\370\277\202\200\237/\3707\203\1771\370\367\306\277\025\374k\301\2778\376\325`o\377R\360o\215\r\341\277\355\347\251\177A\370W\307\2779\376\335\340\337\240\377\\\377\326\376\365\371\327\304\277\365?\362?\230\377\264\263\263\263\263\377d?\355\377\016\220\264E\340\177\331}\t\346t#\221eu\311Wp\b\227\377[\364y\350\006\376t\332\304\241V\025p\270E\246\370\2236\021\001Z\253H\017\323\252byl\356\264\267\205U\305\022\206\351\2218L\217@[\013\217\300\356\264h\033v\005\201;\324\252*\016\265\216\305\237\0266\260\265\202D\252\360X\034\2069\026mC\255`q(\254*\3768A&\031\266"
+	.ascii	"\205\314\232U2\024\366\217'\251 \321\226\034\246\307\036\353"
+	.ascii	"\336\256\036MD\240[\352H\034\013F-\030S\362"
+	.string	"\007\323\225\340q\323\356\036\340\211\311\352\330\302\344p\207c\367\016LF\375\024\0010M\366\r\233\004\026\221j\247\036\335\004<u\003\267\223\335\r\354\356\032Q*\355\026b\033^==u\033\203\236Z\n\250\245G7w\241\001+\016\265\254\2167-\\ZW\355#\005\356U\217U\021\253\026PJ;u\367\"Q\257\212A\332p\311.\360\023$\0220U\225[`\247\335\342\037??-\021/\247\034[\253;\345\241\005\241\304|qY\n\231>+d\376\314\002\013\237\024\352\251\b\227?\257\300C\034VNA\270d\037<F\260x\241\275P\277Y\334\264g\033\266I\243\004Xs\310\270\007\013\231\211\233\203\f\334-n\3329_%v\211\215\"EN\227\017[\245G\247\373\030\007K\02632\b\270i\265\254\234M\332P\206aC\346\305M{e\253l\322\206\t\220p\310\272\323Z\2318N\234\364\224\2475U>.\220\231"
+	.ascii	"\277\251q\202N\b\261\250\2040S\017A\2273D\230\t\263A\3747/cl"
+	.ascii	"\366\210\205\263o6\211%\3336k\266e\213\304\256\331\255u\263F"
+	.ascii	"|\277\026\354\234v\013\277\37470\233,\0228\324\357\223e!\347"
+	.ascii	"\034v\213\205p\226 ))p\247\354\nQj\001\023D\314d5q\211%\025\326"
+	.ascii	"\202E\230\361\302\345u\250\352\027y\305:d\245Yb\204\023~\322"
+	.ascii	"Dl\221\377m\007V\202D\263Q\270\030\nS\331\244\321\326\302,f\\"
+	.ascii	"\334d\254\213\257\260\027[\341-\256\302>\354\026s1\326\031\t"
+	.ascii	"'y\020\02739C\346S\006\245J\224\255\274\272\232\025L\303\033"
+	.ascii	"Yk\246\260\326n1\225\007\245\335]T\030\311R6iL\033\310\016\026"
+	.ascii	"24M\314\006x\301\323f\210\261!\246\224\264\347JZ\003\022\\r\224"
+	.ascii	"\2321\nL\323Y\017\273\305Y5\t\036\264\310\271\232\235.F\254\346"
+	.ascii	"\324\227n\352\3133\225y\250D\220M\215)S_\212\325\227A\324\227"
+	.ascii	"[\352K\257\372\222\253\376\254\003+\321\321\372R6F\t\227\021"
+	.ascii	"\343\3044\245r\272@\246\320\r|\204q\370M\370`\201\321\340\205"
+	.ascii	"U\317F60\"\346u.&\327p\266\3417\301`\222\\=1\251\347\031\230"
+	.ascii	"\206\337D\317\030\022+R\270|YD\307\353\254,\006.\331\252\366"
+	.ascii	"(\251\\\234\230\312B\305V?O\261\f\\5B\2670\2053%\336p\311G&r"
+	.ascii	"\256b\252\346\252\b\216\335A\256\362\231\323\035\364\331=`\367"
+	.ascii	"\200\022\313*\211\017f\371RH\375\330\002\231<\233\302\344!\267"
+	.ascii	"\263\324\316"
+	.string	"\2300\262(\\\242(\233\352\271\310@\316A\036\204\215klZ\232,TH\2636\032\205t`\bNuE\235\215_\203\242\033\331\335+N\344P\305\205$\\>\t\206\372o\202\346cM\361\tC1\fo\220\260\201b\037>I\232\034\247\270\334\342\027v\016\024\223/3A\324\363ov\220\330\335@t\322&2\2410WgW\350\347\3317\202\341;\221v\350\320\316\227+`\251\006z^\020\300RR\317\206\r\351D\177K\035\020\001\200\336\b\206.)E\021Oi\207\307\203}:?\"\024(\021O\227\244\303\323%\321\214P\035\357<2\317\024v\277\362\367;}\271\034\256\266\224\324+*}h\022-w\362t\273#\\-w\376\224J^o\207\026\235\277\332}D\272$\030<>\234QQ\271\344C\177;\335\251#\200\027\021\361,@\317\337\251C\227\004\364\242\235\357\344\235\272\372\bd4 c\006\n\265\317\240\341"
+	.string	"\r\007\314\317\240q\273\321\220q\253\227q\243\235D:\334\221\005\247\016\367\363"
+	.string	"\265\241<\245\236\215\363\250\227\243\207\007\275\221\212\367\222N\337\020\332\353\371\206vt\274\235\357\314\371z\247\016T)\tU\342"
+	.ascii	"\350G\244\333\361\340\365l\230pVp\2428\035(l\274\336\356\347"
+	.ascii	";M\340\341@:!\307\017\322\t9rg\021o\351\307\363"
+	.string	"\340\374)\365\240?\237R\215\363\247\304\263\344CO\244\363\350\334\361\203\022\325~:\334\216\336\316<\352\025\365\320\236/\007\352\353%\375x8\337\016\025>(\321\214\232\357D\332\355\310\235:\036\216\004tW\003\355\031\375*8\177J*L8s\264S\351\b\367\001z\376x\360\340\340<\312\3418\302\241;\335.\247\202\267C\3329\217P\264\3473BQ\300!\355\240D2n(o\247T\177\273\331h\341\301\006\027\324\"\030\276\036\332C\032\322%\r\361v8\244\241\"\337o\b\006P\216\207CB\352\025\361vH'\276t)\203l9\302\205\275\030\315&T\254\300\341\222\2018\020\334%\350\b<B\201)\"\033!f\335F\241\235\033\242\202\b9\354\334Elg\211\0202D\270d.L\374\013D9R\033f\345&\315\027\330\017?`\3219\022\225\256\020\005\354\273\305`<\274a\353\266j\001\254\211\306\005z\314\206\300"
+	.string	"'\201\t\250\221$\247\2302\306\210\210\214\310\214\264I\033\361\004\304(h%3\037\0210\255\223jHd$)H\3323"
+	.ascii	"\002"
+	.string	"\240Shg\335\210K\304\024\267\214|\233\2128\213\007\020Z\252D\237\254\273h\2352P\213d\304\232\263D\374\331F\354YV\230\340\342\376\306\227\331\rM\273\"9\325\024\346Ey\222\340\240\350\203=\3435\346|\236\251\365/\356\305\250\261*\252\303\341\376\323\361"
+	.string	"H\316\205\361\207#\001\311\221\231\245GT~RAp\211\350b,7\001\226\332\f\321\253k\023\226\0341\244\033r\223\304\275<\001\351\223\313|E\356\335\226wU\213\374/xC\235\306\254R(\200!\220\325\344H\360NL\275{\211o\005\373\226\236\004\376\341Gka\242{c5u\253\036\233Iy\234/\037\001\362/\213\370=\204b^@\233\263\341[\313Ln\016g\372X\035+H\3113\366us$\327]\264e\301\257L\342\276\007\206!P\200\225h\326\003\300*6\242\212\016ku\025\274\031\375v\273\243\254\206\3356\243T\317\231\220\260\267 +'\004\001A\314\217T\221#\016?L\254\252\262a\356\326Xd\357\375O\022eG-\306\205\203\271\024\356\306<1o\025\251\277"
+	.string	".%H\217,\345A9\215@\025\227\3002n\2340\207IC\022H%X\006/\021\350\272TM\355\\~\270\311e\322\037\233'\235;`\200\255\214\221\261\273\324k\340\277u\201[z\213\236 2\351\260\371\264\0230u\314\004\034\350O-)u\223\262\356(>"
+	.string	"S\030\006\215<\r\217\275\323\202F\346\245\2175\317\337\001\013km\237\255\366\212\301^9\305\013\307!t\2224g\352\364\334\210Y\252\321\032\260\226n~\222\2120\354\f\021\206\031\016\254\024"
+	.ascii	"D\270\320\320p\001p0\354tm\2142\200\016\271\023\324\276\216\207"
+	.ascii	"\366\264&\332!\353\305\236\27340AA\306\352\205\270|\244\266l"
+	.ascii	"\324[>\020C,\372Q\317\031p\345\373*\277B\334\363\304\026~\310"
+	.ascii	"\356$!\233\t\372\023\356\224\323\374p\023i\025\340\260r6n\205"
+	.ascii	"\002F\037"
+	.text
+	.section	.gnu.lto_.symtab.3b379ebf1f1dc056,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3b379ebf1f1dc056,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
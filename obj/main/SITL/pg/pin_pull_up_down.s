@@ -0,0 +1,364 @@
+	.file	"pin_pull_up_down.c"
+	.section	.gnu.lto_.profile.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 H\305\001"
+	.string	"\244\002<"
+	.string	"\b"
+	.string	"\253\267\327\376\r\002\002"
+	.string	"\002\001\001\002\334\350\353\374\f\003\240\342\234\212\n\004\005\230\372\237\372\003\006\007\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"/b\244\334\317e\377\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\001\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 V\215\001"
+	.string	"T\002J"
+	.string	"\002"
+	.string	""
+	.string	"\b\364\377\377\377\002g\001"
+	.string	""
+	.string	"\002\n\364\377\377\337\002g"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\216\242\361P\313\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 8\365"
+	.string	""
+	.string	"\220,"
+	.string	"\002"
+	.string	"\001\270\006"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\004"
+	.ascii	"8i\350\270\200U`\200\005"
+	.text
+	.section	.gnu.lto_.lto.2442ba990b67793a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinPullupConfig_Registry.17.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \245\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\375\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\007us\314\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035'\001\247\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/pg/pin_pull_up_down.c"
+	.string	"\004"
+	.string	")\242\302,/E\0212"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_pgResetFn_pinPullupConfig.18.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375`d\001\345\016"
+	.string	"\346\233cF\020\221\223\016\033\"\b_?%\005\220\277h\n\353X^i\214\342\026}\344\no\177\367w\003\031\326\007\036\264\036GK\030C\233'\352.\377l\261\252\252\032Q\230L\211\f\300\b+\n\034\355\002\310\215\237\354-wJ\001O"
+	.string	"L"
+	.string	"N"
+	.string	"\023\344\002\260Ow6\016\201\225\220\030-\240\216\335\325T\204\345\345w\313\330}J\215\235\337z\364 \003\345e\370\224!/\026\f"
+	.ascii	"oE.H\325\274\\\274S\2242/\327\273\036i\204(\357\345\361\003\302"
+	.ascii	"\356"
+	.string	":\242<\0167v\333\"\333\016\354\227\b!\217\275\2313L\034\374\355\373-\016\372.g6IIW\372\347\031\203bw\277\302\2471II\351,R\344\202xP\243\225c\367C\360\351\006.\331\331\3473\333\217\366S\\E\367\031\225\007\330U\341\260\331\375\022X\001\310\247\277\213`\017\330A_8\214\221\310\210\335e\340\277@!\3711\237\276\n\366Y\300F\216\324\250S\317r\342\024C\253J\275\353\007r\\\264\3640\305PS5/\031\325\225\375\235\242\252^\254\224\215Ue\037\214\2362Z\036\274\3653\177\354d\037\006\204\273\033\002\240\233\200*\204\266\017\346\317H\b\3036\301\303\221<''$\316\023\002q\232\t\247\205@\022,h\037\321H\0331\340\215\243 \322P\266M\244e\237\351\255G`\335\230\3644u\345\016\214b:ID\273\034\207\346\206\206\270C\356\356J]=\005S\305\264\323!d\t\341\217\002\036"
+	.string	"2\003\302\260\317\302*\021\270\221\331w5\336[b\201\236A\243y\316l\"V\373"
+	.ascii	"j9\230\"\271\314\320\032~\216V@\246\202A\325D.\242HE\200\213"
+	.ascii	"\026U\360fu\005h\026\207E\224\275V5\255g\320?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_pinPulldownConfig_Registry.22.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \245\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\202\200\200\374\342\303\255\233\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\306\030us\325\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035'\001\250\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/pg/pin_pull_up_down.c"
+	.string	"\004"
+	.string	")\242\302,/E\0212"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_pgResetFn_pinPulldownConfig.23.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375`d\001\325\016"
+	.string	"\246\233bE"
+	.string	"\221(\035;\356h\250\231\367]K<\321m\001\212\345\223u \f\020\305\275"
+	.string	"ZI\214\215\200C#\322\252U\024K\f\026\265J\f\373\001F\331\377\377\377\023i\3350\236\300\313\337X#\237\177\2336M\366\226;\245N"
+	.string	"L"
+	.string	"M"
+	.string	"\234\017\310>\335\3316\004P>d\244\2007vW\323\020\226\227\337-c\367)5v\376\353\321\203\314\312\313\360)?b/,\001<\024\271\2005\023S\361RQ\272\254\\\017{\204\021\256\274\225G\017\b\273\353\270\3628\334\331m\223l;\260_\"\273!\324\2615\363E\313\301\337\276\277\342\240\017\263\307\016\021\351N\377<[\236\302\217q\210\310\351*L\344~x\020\343Uc\367C\360\351\006>\331\236\317{l?\332?q\024\335aN.`\267\205\203f\367K`\005\234O\177\377d\237\001\245\354\240/\274E\351#bw\031\370,JL>\211O\377$\373,0\343Fj\324\251W\231H\305\320\252R\017\373\201\033\231\224\035\250\030*k&\346\242\352\262\277T\324V\354\205Ecm\331\007\243\247\214\226\007o=\314\037;"
+	.string	"T\037\033\033\242\217\210*\214\266P\346\020\310\b\3036\001\304\231@$$&\0164\022q\332\b\247\215D\022,h!RI\0031\340\215\243@\322J\266\215\244y>\324_\217\340\242\006\245\251\251.wX4\3239\"Z\3456144\304\034rwW\252\353&\231j\246\235\016\241\n\204\037\037"
+	.string	"2\003\302\260\317\302*\021\270\221\331w5\336[b\201\236A\243y\316l\"V\373"
+	.ascii	"j9\230\"\271\314\320\032~\216V@\246\202Au\252\017\f\270\210\""
+	.ascii	"\025\001.ZT\301\233\325\025\240Y\034\026Q\366Z\325\264\236A\377"
+	.ascii	"$\322\271\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \204\335\002"
+	.string	"\264\004\200"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\003\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002\027\177\004\005\026\005\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\023\006\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\024\007\021\b\016\t\017\n\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	" \303J%\034\226\354\001\032.;\307"
+	.text
+	.section	.gnu.lto_.refs.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375 \025\251"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\003\002\002\003\002\004\002\001\003\005\002\006\002\007\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2442ba990b67793a,"e",@progbits
+	.string	"(\265/\375`\227\013\365<"
+	.string	"zm\310\027DP\344Q:C\273\226\3336\005-\307\201\016\314\013\364#|&\013\027\314\006\244\316\0013_\r\355\016\317\210\332\372\243\374i'\353U\001"
+	.ascii	"\030\340*\bz\200\200\304l\263\003\242/\312\024\254\021r\311\210"
+	.ascii	"\221\266e\n>\001e\001r\001Ih\033`b}A[9]^\201v_\301\202\321L\f"
+	.ascii	"\310v\332a<E*\341j\255\254\356\003\335v3\273\221\334\323\356"
+	.ascii	"Fv\267Q\223\253\3556\342[\2121\231\335\317&fs!\327\262\272\357"
+	.ascii	"\331\0365\347R\372\005\375\255\215"
+	.string	"\221\212u\216\026\311b\r\347\325d\245\310\262\326\352n\026\304\2129\201\004\272\352\317d\030\r\311\r\321\237\350U\317\232xIi\021\272\253\376\006;\206\243l\306-\267\335\277\360\377~\013\031\330\214\313XL\002\254\356#]=\244[\326\232\241\356\266\351\211uc\022\366CU\031\f\207\341\250\023Ko!\303wH0M\326\335\366\324!r\300\244\\\365%\330\263\323\312u\354\264\036\004{\t\354\371\313\007\320\351\f\277^~\356\302dN\273\245\026\264\317\272[\245^;\204\251\344\252o\231ieyim\013k\023\363_:\340\377\237\237'\374G;\330\317\002~\036\360\263\322\317\275\237\221~N\372\331\3673\201\b\377\001\375\314\376|\304O\377}\3775\3613\204\237\035\374\334\340g\247\237\021\374\314\364\277\355?\333\377\263\377h\377\311\376#\375\207\363\237WWWW\367s\323\177c\374G7iusE\256\312ol\326\245\342"
+	.string	"@\327\031$\374\366\263\033~\303n.\272\225\335]\300F\335\242BW\3458,\347\354\306p\3340@\273\223\354\326S\324\235\3541/`^\240\216}M!\263\252\277P\330\3031\323\232\304K+\263\371\235\333,\255\315g\333=$\2675r\321\253\006\270\316\2666fc\273{\327}D\216\030\322\231/\210\226\fb\317i\\\346l\346f\230\215\237\275\353s\246\307\032C\375|>P\tq\261#e\355\314v?\001\022\bP.qS\345\252\037\304j\377\217zZ\024\305\245\251\241\331\321iy\202\343\214\235\223\265\247\313U\243|\206\333\377\2154f$\315\333U\317\\\330\337\177\355d\263\273\177\360\332nb\005X\177>\363\230\037\374I\274c\006\377\325\336\275"
+	.ascii	"\264{\310t\216\265\202&\271u\325\377\n\372[\272\221J\335vs)\365"
+	.ascii	"B.\305\320q*\265\235\244@K\225\364\262\365r\252\320\276\3356"
+	.ascii	"\267\322\313)c\331B\233\313\026\212\364\265\022\212\354n\235"
+	.ascii	"\276\345Y\022\311K\251\227s)\205:\225Z\331\310\226&\223\260J"
+	.ascii	"\250s\031\007\352\364-\245I\347R\351\345T\0222\005C\323!%\351"
+	.ascii	"\204\313\226\312\356\301\344J6}\323e\013m\270n>\313\352&\203"
+	.ascii	"n.h\023.I\204\325\260\246=\260\312\004W\335\361\322\252\356\320"
+	.ascii	"\260g.\314k\316z8\312k\256\220\246\262\026\331\233\203\323\344"
+	.ascii	"\212\320\023\363Q\004\314U\203\264J\243d\036<n\300\260g2?\034"
+	.ascii	"\350K\2378A|\350ngyc2&\3171 \262=\334\207y\223w\007O\237\276"
+	.ascii	"V\2361$W\310B\206\313\344E,\307\323g\20718\037\027\310\375q\233"
+	.ascii	"W\353"
+	.string	"\366\270N\216^\346E\236\3670\037%\017\272L6\304\212x\332\304\003\231\236\247\246\247\336\\\0273\">\225\375<.\001\326\262\304\027?r\335W\307\345\301\321\273\343Mm\367\331\216\213u\227<}\266\375\243\305\237-\262'\003OI\201\354\300m\255\352\177\2277\207\2002-\023AW\275YFO\"ppx\261\377Ur\364\342`\007mYK\3648$6N\276\220\260\337\025a\277\323\252c\357\310u\271]\365\273,\366\273$\373\233\210\345C\214\210\243\0168\321\231\020\027:/\331v{\237,B\013\023\210=;Xwuu\354`\375\215c}\314\264^\246\365\367\016\373;\r\004\210'}3\347\006H\356\326\221\243\205u\377$\321q\241K\324\206\375mc}\274\264*\340\245\365>\270\303y\030\356?\352\215\251-I+\303\236\361\234p\362\226vU\225\257f\345:g;\377\321\2053E\214i\306\236\3470\235\377H"
+	.ascii	"\234\024\264\262\253\376F\331\363\224\027L\006\232j\024\253B"
+	.ascii	" \250\021e4~\210\021<Z\325P\341t<\f\n\302%)\342\025\022\361\305"
+	.ascii	"5\362\254\200\001\216@\242\260\310#\n\213;\030G!1H\265\036\201"
+	.ascii	"\032~l\320\306\320J\265\262\n\032\247\246\242\214j\024\253\244"
+	.ascii	"\324#p\303\2218\27422\036\213\273\251 Q8\244\2122\232\nZ]\251"
+	.ascii	"\304\252\341Q*het#PX\244\220d\214\202!\245\3260\036\255\206\302"
+	.ascii	"`\n\340\201)\004\227*^\001\211#\216A\253`\na\321\300\245\206"
+	.ascii	"\306 1(d\217A\303\004\r\033h\030}\003\207\n\034*\254\337\300"
+	.ascii	"\341\367\343\240\341\307^\303ow\204\261\340U\305\240\021\352"
+	.string	"XUe\204B:\002\215\204Q+\252\206<+\240p\370\202X\025\2028\243JD\221\005\025\325\025\n\342\260\310\364\337/\204\002\026'H\260R\024\2103\252\246\200\305+ \025\325U\021H\034\026\241\204E(\3420*\006\224\224\321\n\212\202\202\337(\277Q\230\215\273\331\375\3540\346E\256\237\315\007W\333@\271[, \263*}\2370\033G\331\336\320\204\205\201u\361\244f{\214|a\302\344k\312.\255lI\036\257\213\344\027\354\"\271B\326\246\213F\323VF\216\345\2435\305\315U\357\327Ur\275\222@U\035]]`a*\335\032\222CqD\242\227\310\335b_+\277\270\250u\363\031\341\b\313\023(\212\256\372\273\365\337'\017b4\027\335Rv\207s-\307Uo\221\337\257\221\016O\224\214\005\200\307\250\221,h\2203FddfD$-L\016\200\002\221\2612n\021P\245c\306Jd$I*\245\215\0031"
+	.string	"B\371$\267\377t\342\2502\363\237\260E>2\222BF\373\357h\320\327`|\313\213\336{\247\260\220a\344\034\262h\220\276Z\375\324T^\243eT=\344s\262\336\332\002\342\002\201\370\252\224\326UE$\350\312\232\324\333\245(\230\276\321\001\217\201)\257\334\001\243\351\361%i\3537l\022W1\020^{0a\353\025=p>\305\337\247\223\374\251\007\200\224L@K\315\346\361t\360ia\035\250\241A6\356e\313\372;\221\277\364D_>H\210I\334\321+\222a\376\373\023\306o\255\b\336\034t\026K\306\004\372_\207\231\300<\f\371\244\363\303\266\212"
+	.ascii	"ip\013\2145*\363^,L\277\211\006\362\016\347P\322-6\351\377\232"
+	.ascii	"Rv\311\221\246`WT\277U\022G\236\261<k\006\203\205b\204K\310\303"
+	.ascii	")w)Q\t\210$\271\016\022\273\207\203\245\363\021\374\2332\003"
+	.ascii	"$\020KT\246\b\031F\206U\266\2040\213\222\260\177\3557 (W\227"
+	.ascii	"\325t-O_Q1\301n\t:\027+\2222\003\223\304$\345;\207\300\351\220"
+	.ascii	"A\270\344\315\263?\230\222Ah\f\002\243\267\273_0<_\2140L\264"
+	.ascii	"%\303\020\266k\"wb\221\244I\001\227\361v\002X%\331\231e\243\311"
+	.ascii	"\354\240\270z\215\201x\311a\253\357EYd\206\370\363\372K\271_"
+	.ascii	"\232\304\253\315\n\206\234\035V\214\321\033M7__\267.d=\274ds"
+	.ascii	"h\353\220Ez\340R\003"
+	.text
+	.section	.gnu.lto_.symtab.2442ba990b67793a,"e",@progbits
+	.string	"pgResetFn_pinPullupConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"pgResetFn_pinPulldownConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"pinPulldownConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"pinPulldownConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"pinPulldownConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"pinPullupConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"pinPullupConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"pinPullupConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2442ba990b67793a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,283 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 7}\001"
+	.string	"d\002+"
+	.string	"\004"
+	.string	"\353\372\350\305\017\b\002"
+	.string	"\002\001\002\002"
+	.string	"\002\001\001\315\257\353\343\n\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\273\2546\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 2M\001"
+	.string	"\370&"
+	.string	"\001"
+	.string	""
+	.string	"\007\200\200\200\200\003e\001"
+	.string	""
+	.string	"\002\004\002d"
+	.string	""
+	.string	"\ne\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",\242\271\204\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 Q\005\002"
+	.string	"\004\003E"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\003"
+	.string	"\003"
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	"\001"
+	.string	"\340"
+	.string	"\b\b\002\004"
+	.string	"   \002\005\300"
+	.string	"   \310"
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"F-i\351\262\250m`\025\030`\001"
+	.text
+	.section	.gnu.lto_.lto.2a93ca3faa8e0029,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcdeviceConfig_Registry.16.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 \235\215\004"
+	.string	"$\bj"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\202\200\200\374\342\203\235\212\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\306\007us\335\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\233\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/rcdevice.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_rcdeviceConfig.17.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\225\t"
+	.string	"V\321@;0\305*\035\200\343\025o\344\007\250\224\030O\352\222\330H\234Y\007\0022\324\225\331\374\020\302h\260\021\243l`\2044\r4%\3144a\034w\270\211\303\004\245\335,\331Fv\373\357\235R-"
+	.string	"."
+	.string	"2"
+	.string	"\035\372\2319\207~\372\263Y\b2\002b\0323\333\356V\t\362\357\361\363OrM\313\265z\304,\354\256c\313\305q\313\3336\260\375\261\237\020\322\303\376ew\327\022\264/\373#F\363\301i\331\335\270\005X\332T\021\331\330~\264\037\373\310w\231\352\003\273\340J\312n\210\340\203\314\247\303\007\266\233\250\335\375\304\244"
+	.string	"\3020\265\243\250}\372\f\365\360\262\321\247\250]q\223Tfw?~\211\305E\247\026\362\351\253\350\247\303\013\006\200\025ov\270\212\001!\221\004\251c\0200\347\001q\"\nP\004\347\325P\251\222D\020\243\312y\247\352)pW\002yu\242\353\274\272\t\367\227\225\240g\007\215%1\354\321QR\r`\021"
+	.ascii	"\177\241'\023z\363\002\343q\346\270\210\023i\344a8 GR\227G*\007"
+	.ascii	"\247\327p\214e\004\363.\0014\253)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\r\b\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\016\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2a93ca3faa8e0029,"e",@progbits
+	.string	"(\265/\375`\007\n\3259"
+	.string	"\212j0\027DP\344U\007C\273\322\250NyJ\205^\265\245\261\334@M\257\336\2639\310~ f\313&\337h\342\270\205P\232\377\036Q\r\333AU\0010\026\330`\244\017"
+	.ascii	"P\035c2\216\006\220p.\022\036uos\023\231RB\001Z\001e\001\355"
+	.ascii	"j\256\206\375Q]\206\311l\332R;\266\206O\223\314\266\203\271\355"
+	.ascii	"q\325\303H\321\370\031O\343gNu4/k7\3632\315\306\377c\376\277"
+	.ascii	"=\314\214\223\271\365\251\001\254\352RGs.\016\306\255U\017\322"
+	.ascii	"-q\377qW\350\356uS\270\340h.\306\311\016$\377\211p\031\261\265"
+	.ascii	"\355H\363\363\037C-AAA\355\206H\323\342\210\330v\245\353\357"
+	.ascii	"J-\317\350\372\030'\343\324&\037k\n\027Zw\354\362\322\2429,s"
+	.ascii	"\2012\333/\334\366\246\326\257\336\324\366\n1*$`\3162\333&\334"
+	.ascii	"\276\340z\027\367\342\324'\377\322\276\305\343\036R\306?\375"
+	.ascii	"\217\217\206\334\364pU3\333\020\334\366i\013`\373\013M\344\266"
+	.ascii	"?\265G\376\324vv\235\\\251e\255\256\324v\273\226n\317\342\322"
+	.ascii	"&\335\362*\372\325\377\030\351(\316b\036\311l\307\256\324\272"
+	.ascii	"\236\324v\367\231\356>C3\323\335cm.\326\355\005\272\035A\267"
+	.ascii	"7u\273\201n'\320\355L\335~\240\333\235\346\272}@\267+y\203\356"
+	.ascii	"\346u\347\016\335\316\240\333\027t{\202\356n\353\356/\335-\326"
+	.ascii	"\335ij\272[\332\335D\335\255\326\335\272\353\365z\355\356'\335"
+	.ascii	"~\355vG\004k\355m\272\215\267\371\323\371`MI\363\317\347\223"
+	.ascii	"\321\232\223)^o\332\333\032.\300\277\364\377\017\020\255M\313"
+	.ascii	"\3162\333{\234\255\273\207Z-Z\266\232\260\271i\303\370\210%\323"
+	.ascii	"\334\25472df\251n\365\262]X\225\271#qn\347\356\366\221\315\377"
+	.ascii	"\307\332\305\337L\006h\337\271?u\027\271\316\025t7\373\337\b"
+	.ascii	"\244\377\\\202\344\\*d\310\255\314v\267\323\367\225\377#\322"
+	.ascii	"\307\337\\N\273\216K*\233\023)~#\004~z\344\227q\227\223\215~"
+	.ascii	"\376\370\375\225]N\031\3138\332\\\306\321#\357\225\321\343\177"
+	.ascii	"\354\344-\253\310\243/\247]\316\3454\352Dz\345\037\177\2124\342"
+	.ascii	"*\243\316\345\232\250\223\267\234\"\235Ke\227\023\t*H\311\025"
+	.ascii	"\035q"
+	.string	"\330\260\270\224\245\362{0\241\310&\317\272\214\243\377\366\357U\253o*\370\207F\233oH!^\226\264\366H\216AF=\376\177&f\322+\372J\353\262J\364\277J\262\352\231\026\216\261\365\231\270\365x\004\372WV\377\005>\376g\376\037\375\255\377\177\374\177\241&4\376\037\302[~1\231\377\317%\346C\217fV\377\271:\247\314\271\234zE{f_\246_\237#>\372\327\277u5\335\351\221\313_\375\277\353q\277\234?\362\254y*\372\343\226\274\222\331\016[\271H&\222\241\371\231\207d.\247f\255\314l\007\344\201\224q\326\312\312\274t\353\222\rR9PKPGrY\300\b\341\261>\250\355\034H.C\204\301\345 Y\210SsV/\305\237\225}d n}\306\217\305\342\316\226\032&\250\242<mo[-\333\235\201\344\037Fcb%z2\233\261\204\236B\324p0q\273s\323\251\331\351\356\271b\026\250\355"
+	.ascii	"@k\342\225\304m]\324m\335\017\036.\2348\256"
+	.string	"\265\314\266\216\351\266N\207\333:\244\233qd+\247:\3109:#s\262w\310\370\343\354d\220\230\227?n\273\203Vw\275\272\203\266\263\234\313s\2456\327q;\307q\273\375:\267\233\252\221[\233#\313o\330\\%\337\270N\236\324\346\247=\336\307\375t\017\035\201\225%\021\243\346\266\363)\321\244\215\230\314\262\336gZ\327\323.\327=\224\325\242|1\321\270\355x<O\367\220\321\033\0241.\231\355<\346\266\307\355\304\\\345\2642\353w\\\253\034; \342\032+\342w\272]\216\317q\270\026\377\312\377'p\343:\250Of\275\216\333i\207s:p\026\242\377H\207;\022\364\217<rO\340\236\200\005\363\212\022\246e;gq\373\315\225\332\"Oj=N\257\375-\251m>\343?\002\260\206&nKf\003d/\267\235\215\0076\210\303\016I1^\330h\003\205O\t\356*\t@b\322O8\003\200\320E.\356\214\276"
+	.string	"\260O\b$\356\204@\242\256\n\006\n_\030-\354\223\352\2757\202F\326h|\213TTSB6\210\303\037[\204\211:\252W\b\f\302\230\022\242z\2153X\3410\b\377^\243P\027}@\242\204\242\342T\325\217\265Q\204\215A\340{\202@\377|\302\017\360k|O"
+	.string	"\211K\375\013\026_\341\013t\333\202T\004)\f5\204\032C\206\t\031&\264\215!C\257\227A\252\347\266TO\007w\025S\017\211o1\n\036\016\213Q"
+	.string	"\204\303\240\261\370\252\2001\374\r\341a\221xd\364\001\203.\204\303\016<\330\207A\310("
+	.ascii	"\366\031I\2741\202\260\013c\212F\361\205\205\"`b\214\027\206"
+	.ascii	"9x\200\203\302 \023\354\243P\001\026\006g\270\335\353upJQ\002"
+	.ascii	"\204\373\223\360\376\2024"
+	.string	"^\252_1\nH\214\022\006\247bD\375\212\306(\tKoq\006<\365\272\020R\342m:\250Z\\5#ARg\007\246\313X\237:^\355\324\354\345j\236x\257|\003-\373\346\363A\021\240\257;v\260\270\273\265\377q\252\273e#K\\\342\243Q\030\030\326\024?\337\204>\310L\246\234\271e6\032/\t!\343\270\245\211\271\355R\037\344\327\260:fOgG\276\262\322\346\350s\3229.H+\367\310Yn}\362^9\346'.'\263V\326\361\026\200\244\250\221,g\2243F\204DDFd4M\007p\002\221)\253\352\021\240\255r\206*H\223\324\350y\217_\242\317\223\360\342|\036{\214kS-\246\245'\024\376_\347\234\376XT6\206'U\234\232f\244\310\203\026^\310\214\211\246p\271\201\270\220\033\370\375\201\274@\236\324\361\027\310\206`\263\234\264\214M<\021\001|\030\341\0221\343<\304\325[Y\357\f"
+	.string	"\255\275\327\f\246\372\033\212\001\0170)\357\206\272\374+"
+	.string	"\341\303\343\3222\256oL\217\230\016\260`Pm\241\241\317\36169R\034E\002\316 \323\253|\255\315\336UP\027c\356i!\275#\310z6\356\020\320\206\346\t}\335\313\235\311e\242\376\364\263C<\001\340g7\241-\333\344(\241,\214,\242\330mb0)\013\005_\013\b\022\336l\365\021\340\333\314\356\200\314J\327\303(\234\332\036\274\0243\230/\tL\326\3038_"
+	.string	"\255\r\331\377')"
+	.ascii	"\377\350.\301\316\023\215\271\211\236\240!\304\245\200\212\355"
+	.ascii	"\232\361&\271I\201\024\270\fLO\240\325R\370V\216\323\377j\356"
+	.ascii	"\253\232\377\267\201\3613s\035\323|$\250\004\335i\033\354,\017"
+	.ascii	"\320>\336\317\177\373\003\020+\252H,\307\233\016\r>\364\007\270"
+	.ascii	"\250\263\346'\332Z\003\026\277\370\016\330`\355\306Wu:`\200\031"
+	.ascii	"~\224\224ip\032"
+	.text
+	.section	.gnu.lto_.symtab.2a93ca3faa8e0029,"e",@progbits
+	.string	"pgResetFn_rcdeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"rcdeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"rcdeviceConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a93ca3faa8e0029,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
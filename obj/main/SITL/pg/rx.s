@@ -0,0 +1,368 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 g\325\001"
+	.string	"T\002["
+	.string	"\004"
+	.string	"\340\213\204\362\f \002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\353\347\271\226\t\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"\273\006`a(\002 \357\246\r`\256]V\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\031\200\200\200\210\002h\001"
+	.string	""
+	.string	"\002\027\200\200\200\360\002f"
+	.string	""
+	.string	"\025\200\200\200\260\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 o}\002"
+	.string	"\244\003c"
+	.string	"\001"
+	.string	"\001\002\005"
+	.string	"\003\002\005"
+	.string	"\001\300\003\300\003"
+	.string	""
+	.string	"\006"
+	.string	"\001"
+	.string	"\360"
+	.string	"\b\b"
+	.string	"\001"
+	.string	"\200\001\310\360\210\002\260\002\b(\002\006"
+	.string	"\002"
+	.string	"\001"
+	.string	"\220\001\0200"
+	.string	"\001"
+	.string	"\320\001\020 \b"
+	.ascii	"\226`\r\\\004\203\201\021U.\324\264\022\214\266\2016"
+	.text
+	.section	.gnu.lto_.lto.36c583bab337f2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.30.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 \227]\004"
+	.string	"\304\007j"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\377\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\307\006us\345\005uq"
+	.string	"\005\001\006'\0018\005\001\006\035\001'\001\230\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.31.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375`1\002u\r"
+	.string	"&\027WC\360T\225\016\030\370\275\003\027QL\356\2742\324Sjv\302\300#\262x\364\027\222\361\274\271\212r\007k\021hb\255g\006s@\255\316\221\026\360\023r\021\303\035\316\006\nZ]o^\360\314\206F\"\t\332;\245>"
+	.string	"B"
+	.string	"I"
+	.ascii	"\344e\251\017\330\205\331JvM\006N\360\275\263y\002\336\273\357"
+	.ascii	"\030\357\235I\233\210\206\005\340\346\232\245\354.X_\234<%\375"
+	.ascii	"\323\270\245|\251NI&\354\256i\371Zq\327\333V`\273c\323[>\361"
+	.ascii	"\033\243#\274\313\234EP\337J\202_\003\005\212\2361\374\224\367"
+	.ascii	"\216\326p-b(+\232\263M\025\255.\354Wvw]a\366e?\315T\030.Z&\267"
+	.ascii	"\253\"wdq\035\016\031\027\333\247\366g<\026\034:\320\227\206"
+	.ascii	"\260)(\254\252\362\360 \037~\2028\220\037\267C\374\004\201\347"
+	.ascii	">f\267?\3571z\240\233\214\002l\204\316\3033\"\372\016\223\201"
+	.ascii	"\021\3171\006\0202z\311\307\"\274\355b\362\215g\223x\315\344"
+	.ascii	"\023\023\247\375\007<\007\356<p\320 \303\006\013\024,!\221\b"
+	.ascii	"RX\341$~\376pN\"\030*\201$\221g\004~D\023\310\3018,\201D\260"
+	.ascii	"D\030\212\340\305\334W\266\302|A\007nUSXCi\275\371!\030\n\234"
+	.ascii	"\273\255\227\032\276\326\202\315;;\" \320\202\221\301\325\001"
+	.ascii	"\002C\337\310\300\346PF\006G\360v\303oG|Y\0220'\270\030\227\b"
+	.ascii	"U\240\004r\305\205!\200\025\005b\275\254\005\262\342\302\b`\302"
+	.ascii	"\030\364\305\212\023\006a01\254\207\314\363l\231\313\274\r\240"
+	.ascii	"\371\246\304\036^\264\220\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 k\005\003"
+	.string	"\364\004g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\037\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\036\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\033\t\201\204\001\034\n\001 \177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\244\n"
+	.string	"\005"
+	.ascii	"\\L\032\341^\\\326,\2031\004\n\n"
+	.text
+	.section	.gnu.lto_.refs.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.36c583bab337f2,"e",@progbits
+	.string	"(\265/\375`\314\022\r]"
+	.string	"\352\243\300#UP\2202J\007h\242\001G\002\207v\255\355\270\225\305\340\320\222\275L\354OD\206\270\366o\201\177\321\220\247\217cdy}\264\366\341\003>\215@\331\313\306\247\201[Z\b"
+	.string	"!R\275`!U\253\331"
+	.ascii	"%\213^\335\335\334PX[[=&\346\340}l\333\223&e\n\345\0017\0027"
+	.ascii	"\002\rXe]\371\271\315[\212\341\260\222\223+8p\365\245d\031\272"
+	.ascii	"xkHv\257\tq\252\356=^\305\317Y?\n\025-\305I\336ba\343\336++8"
+	.ascii	"2,2r\260\306\356=\2220\"1\024\006FG\f\206\371\231\030+c\241e"
+	.ascii	"\3377xk\203+@m\311R\007\2356;\204\333\333\306\317P\370\212\003"
+	.ascii	"\255\bu\274Y\005l\205\351\322fm\026\203\375l\211\375\f\005\373"
+	.ascii	"\331\017{\323\216\355c\376\350J\001I\2337\303\354M0\366&\025"
+	.ascii	"\373/\223\210\275"
+	.string	"Y\202\275\251\303\336\024\332\313\366\330\313\352\330\313\300\354ec\354eR\354eJ,\207q\034F\216`9\3477\354\365\231\360x\217\315\002\037,U\332\274\254\210=\217\240\311\226K\036A\273L\312\266\314\311^y\307\022\215\245a5\2144\3425\327\306i\232tD\265\371VZ\020\356\222\215h\3575\366\355\305\276_\260D\355\303\032\215\331s\322\036U\261'P\260,\370\206}\r\373,\236=\227\006\366d\262\260\026#A\260\226\243PqY\220\312\275\022\352\363\244\217\2366\037\303\236A\320x\311 h\207\300\206Hr\007\032Oa*\214<\342\030\316X\034\345?\303\343E\336{\264\375\260\251#\225\325\346\027\260\347*\037@xU\034\204=\037\321l|D{[\2239\320N0\007Z\b\356@\373\221;\320,s\240\375|\233~\026\361\263\355\347\020?\227\370\231\304\317@?#\360\263\320\317\006\374\234\300\317E?\027\360s"
+	.ascii	"\036~\356\360_\213\207\277q\374\334\3739\375\231\203\237}?\317"
+	.ascii	"\370y\351\347\337\317+g\360s\322\317<\026\376'\372\373\315\317"
+	.ascii	"\301\237k\374\334\301\317\300\237_\374\227\363\363\211\237\031"
+	.ascii	"\370\271\305\317)~F\361\363\355\177\320\3773\377e\313\345r\371"
+	.ascii	"_\371\233\023\374C\301/\214\267\210\210\274O7\2044O|\217S\301"
+	.ascii	";4\336\242;\274\302\020\304\341\324\023\021)|*\"\"\247\236.r"
+	.ascii	"\352\022\335\241\260\210cx\213E\02795\347\"\215ODD\244\361\211"
+	.ascii	"\210\234\212b-b\035'Ol\216Pi\361\034\342\360\352p\212\022\026"
+	.ascii	"\211\222\304\243\361~\335\313Y6n\361\200{\243\214\305/!\020\346"
+	.ascii	"jJ\352h\322\"4\362\361\336\353\301\251\211\312x\207I\"\023\343"
+	.ascii	"\275L\232\222\256\223\002\301c\362\026\341dpH\324\315a\343\336"
+	.ascii	"\001\234\356\r\362M\336{\203\367\336Z1\352xo\020\"b\225\223\323"
+	.ascii	"\275PFN7*\330\305\306\275\235\005\306\365DDR\031o]\254 \253\356"
+	.ascii	"\215c\220\253\356\327T\321\"\203Sn\216{/\327\261UO=\350\\5\224"
+	.ascii	"\331\024b\rY\332|C\371\273\t{i\253\r\356\035\006\031\361\321"
+	.ascii	"\003M\233\355\244\237\274\255\032\206\266R\300x\257\260\255l"
+	.ascii	"{\356\025\332\230E0\2130\255\250\\\310B3O\013b\177\230\003\215"
+	.ascii	"\241\334\336/\330\324p\261\203\204\311\b;\374\242u\265\004\204"
+	.ascii	"\355\370\303iH\233\177+I\"#\3460\036\213j,\024\201\200\265Ye"
+	.ascii	"d\023\023\304\316\2326O\333a\317a\304\344\361B\307\253*\353\214"
+	.ascii	"\0347`n\306\220\301S\306\314\330\026.}\274\320\204UeaY^\325\351"
+	.ascii	"\372\002c\303x\270(S\314\30048y\243d\256.|\030\214\036\2569\254"
+	.ascii	"\034\232\335kDS\025\305\316\031%s\375\267\016f\371\373\251\241"
+	.ascii	"Z\205.\322S]l\024\332\205f\241\215t\013\355\324+t\216\246\352"
+	.ascii	"\024\372H\353hc#i\"\315\243Oh\037\035\325AzH\377h\022\272G\013"
+	.ascii	"i\023\032H\357\350\022\030\331RM|\343h\021n\036\357\035\252\340"
+	.ascii	";\274U\206\267\374\267\276\274\324\032#S\225\342\277\265T\017"
+	.ascii	"\373\006'\241`Xa)\357\275O\321R|d+\262)E{\245\n\321K\013\261"
+	.ascii	"\270\311\303[[\274j0\243\347\277\355\331\272\302|x\251e\214\230"
+	.ascii	"\f\312(?K\031\201\267\206\202D\267I\r\216*/_\366\360\325\177"
+	.ascii	"\353&\336\342$T\027\352HH\314\223\033Id\367\262`\217\031\261"
+	.ascii	"\214\264\331|z\351t\302\021\036\275\354\003\205\004\"G\216\266"
+	.ascii	"\237.z^\360\261\347Mp\234`\350=\307\rM^y\242V\300\203\247\223"
+	.ascii	"\300 \272\227\n\211,L\217\256/A\356\234\221}\247\223\230E\367"
+	.ascii	"\n\363p\335\"\024\002\263\344\0221\3106oE\260\347'\334V\336`"
+	.ascii	"\030\331V\332\216\214\buy\244(\302U\214B`\266\204\311e\323\246"
+	.ascii	"\330qX\023\266aS\206\217=_\215\3512p\224f\336xu\262\t\032\345"
+	.ascii	"\231&s\005\246\314\n\3534\r\306I(\242;\3342\346\025\326]_r\272"
+	.ascii	"N\323ie\303\3518=\207\221\035\3263\274\303\264\230\033\035oa"
+	.ascii	"-\203\033\233\030\224+@\210\3141\017\373\320D\204!%\216\322M"
+	.ascii	"\277ad\203\335\350\b\326j\372\213\223P\307\313\003hK\271T\342"
+	.ascii	"\201\204\020\2355_Bh_m\206\264\034U\250\323f\263\251A\0019\023"
+	.ascii	"B\327\032F6\r\326\216\223.z\036\0064\306\b\225\031\373\032\030"
+	.ascii	"\373\332\225FciPJyM\261\257E\261\2575\261\257%\261\257\025\261"
+	.ascii	"\257\r)C\006iF\314\213L\253\351\312\321d\264}\304\325^\372\313"
+	.ascii	"\377c\263\342\"\242\005e\337]*0\202F\253M\223\037\206\326[\336"
+	.ascii	"\\\376\237>\343B\225S\017\373\326\322[\377\317\320\027\022,S"
+	.ascii	"\332|m\004\373\326\232i-\305Jh\263\263X\0334>#6Hm9AH\233\357"
+	.ascii	",\177ca=\036,\371\334iS\2109\320\372\312\355\235\005\344%F\211"
+	.ascii	"\325f\020\355\215}Gi)o"
+	.string	"\254c5\322\036\357\016\306\222\254\301k\354BA\035\331\036x\276\260Ty#\037'\350~\370i\362TEl\363v\232\312\377\237Z\224+VST\246\310\240\326p)\2512\253\302\300\320\325&\262\217M\f2~\211}!m\377\264+,\336{y\314\216\267\330\024t\2361\037\375B,\343\003\376\233\367\376\037>8\336`\233#bv\t\027\241\220\207\270\237%\357\035N\005\035\230z\032N\001!\"\247np\210$XT\274SA\"\362\336\242;\034\006\003O*\301\224\232`JU\027\271\030\250\232\342~\266\032?\237\013\241%tUkXp\332\326'\225\330\375r= P\017\251g\352\031\264\236\275\335o\326\333\375dI\353\256\207*\321P\017x\252\251\252h\252\323\341j5~\276\234\231\256?\231\016\355\355xJ\270\232\016U\201f\317\307[s\250Z{z\356~%\204j\244\253\312\333\2411\212\236;{\021\304\330\375"
+	.ascii	"x\216\227\242=tg\257\300\212\004V\260`\252\235E\213\023-N\320"
+	.ascii	"\316\242\305\355\326b\305\315~\305M\226\342\222r\346\372$\016"
+	.ascii	"\367\375\320\324\304\352\363\245&\200t\350\212\343\255\276\035"
+	.ascii	"\3323R\317\035\017\251\347s\301\224n\370\341\226r\351,Eu<\032"
+	.ascii	"\276\364\247C\231R%\034/E\325\"&T\351\007|\201\244\204K\332\320"
+	.ascii	"\343\205X\317\332\016w\201\217w\356\200J?\243\242\025U\321T\327"
+	.ascii	"\343\3118W\234z.\001\323u\006\372S\t\bB\225p\271\rk\212\322\350"
+	.ascii	"\361r\251\216\2674\353\361\226\354\214\034"
+	.string	"\232\224c\302-Y\025E\323\035\372\002U\332\365\036X\302\271\240\361C\002@\247\344KR\3214\351\002t\305\321\340\255\271\007P\235\217\202\224\2073\352\361\326s\305-\207\252\300\223)\005b\002\342N&\334\222MM}i\212v\240\255\250\212\204\344\003Bu\276\245\242\265\307\363\375VT\375\240Kq\035\244>$\035\212\"\031\200\204\344[\201\271S\3451\341\316\035P\006\252\023\240\306/\375\200*\255\253/MZ\317\324\267\346pH\247o\005\342\316]\217\227\264\372|K\352\231KE\350|\274\024\375\235H?\245\023]\302\245Hg.UO\236\252\246\036t\274s\345\365\200B(\224\230R\325\266\2528\244S\007\304\3118U\240\fuh=Y\324\322\236z2\245'\252\002O$5\315\331\326\023E\212\265\307\003\332\337n.B`P\201\0046W\202)5\261\373\231\350\361pK&r\251j\242\004"
+	.ascii	"3T\334\322\251*\241\275\036.)w\242:^\232\2424|\347O]\032`(\013"
+	.ascii	"\272\301Z\336iB\2320t\362\325\346\365\350\221\005\231\312\335"
+	.ascii	"a\204&\t\225r\354\006\201X\250q@\246\024#"
+	.string	"32\"\"2\222&\351Q\005\304(\310 \273\036\022\200DE\2259\306\246f\232\322\262\377\033\022!t\302\272\307\231?\352\235\251\347JQrn\335\334\007\323\227\033p\025\216v\231\177\244,\334\357\r\266\376\b\274\013\027\267\037\216\332K\002\274z\307\304\265\241\036BZ\204\374\350\374\3254S\230\r\017\033\215\033I\220[\237Ac\340\241\207&y\355#zt\016R\353\244$\"p>m \035\301`c\016\0302\306\020)`#\235\013\002\216x\260\244B\224\352\177f\334)\342\036_8\323\316\352Xl\360\244p\267\002\231\003\006\3423\334\027\031<5|,\354\367\340\274\3033\351\246&\213t\2035&I\207~C<\023$,\345\222\346\f\310\243K))\nl\264\342\223N\\R$\307\222\t\307w\203E'\377<\365\220e\254\265#}\301\200c\334\235\036\235\374\346M$\024E\265)FK;'\366j\236*\273\344"
+	.string	"`\0370\273o\347wbL:=1~i\267)\206\210:\252\005\377'\034\261\3248\227\254\021\363\237\262\200\331\345\231B\036\0204$\001\276v\305\221\204\024\214\363\334+q\315\221\215M\321\333\n\356eF\205\311\300\\pmB\024\214l\020l\330c\336\347\242\310\220\311fi\341\351\270\371\f\nP\214\305{Y\2024\343I0\273\223\367\362\023[\"Pb\017Y\020*o\231\356\272\306 E\230\355,\222\277\340\247;`\307\331N:\365\212\272\207\267I\214c%"
+	.string	"\373\317\211\325\322\225Z\326\307\037\371\274\225\252\353\247\244bF\022\3669w\030\207\371\311\253K\357\337)\243\304\331\2257\304\331\233"
+	.ascii	"AqD\303m2\260n\333)\213\n\240Q\036\226/y\311\tC2\236\300Wb\212"
+	.ascii	"\214C\337%\030\353=\027y\260\177\257\016\320Y\316\303aa\320\261"
+	.ascii	"q\356%\377~\003}~\214\004D\031\223\232\256\257\311\305\341?\005"
+	.ascii	"\346B\016\2668\372\344M\264R\002\361\212\3145\304\346\\\304\200"
+	.ascii	"\360b\265\335\366\234\204Gn\246\340N\025\341{\r\313\265)\237"
+	.ascii	"QU2\300C\335`z@\365\024\306\r\321\310d\2018nMar\245\247\257_"
+	.ascii	"\207\212\322\301\324\004\355\365\311]\373\370/G\007\237\201\266"
+	.ascii	"\030\"\2036 \326\303\360\330\203\027\275F\300~\230~\213\230\362"
+	.ascii	"\330\2340Y\356g\337 \034_\210\241w\005Wq\224v\240?s\267$\266"
+	.ascii	"\306\213\257\007\352\361SX\r\366Y\0023\237;P+L\035\024\272/\354"
+	.ascii	"\314\352ys\306\256\r<\327\307\032\355\244\n"
+	.text
+	.section	.gnu.lto_.symtab.36c583bab337f2,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.36c583bab337f2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
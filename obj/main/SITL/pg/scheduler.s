@@ -0,0 +1,222 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\313\377\204\214\t\001\220\236\375\227\005\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.5581fc643b02dadb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_schedulerConfig_Registry.12.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \236\255\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\235\233\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\325\007us\350\347\006uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\254$?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/pg/scheduler.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_schedulerConfig.14.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 (A\001"
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\031?\202\210\200\030\177}\274\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f\001gistry"
+	.string	""
+	.string	"\005\t\002\201\204\001\n\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5581fc643b02dadb,"e",@progbits
+	.string	"(\265/\375`\247\007-,"
+	.string	"zOp\021F`\\N:?\257;P6\237\337sl\311\313u\203\330GP\r\003%\355X\343\007*6\212'0I\020\344\256\256\244j\r\310\275E\2236\377\370\034\260\242l\340\324K'\2328L\220\2509^u\361D\242\304J\231\002\337"
+	.ascii	"\006\001\017\001i\363\333T\316r^\373{\202dYUj\235\376\302zNc"
+	.ascii	"\265\277\007\350\367\006\006F\247\247\260\236\261\374\357Ya\327"
+	.ascii	"#J\247|emqt\324\323\346\354N\254\323\363\225\237\237l\306h&\356"
+	.ascii	"\255\272\367\026\350\253.'^\247\\\205\255\234\321\370\354\020"
+	.ascii	"&\0348uv\311\356\275\214&\001\354^*F\013\352\273\227*\210y\001"
+	.ascii	"\363\202t,\354H\0265=\203\365y<\244\ny\2502\331\322\231\312\317"
+	.ascii	"S\270l\250f9\2377\355\336\033\324G\322\334\334:\375\223\207\324"
+	.ascii	"\225\207*\020\017\325\367\372\177\315\177\271\377s\377\351\030"
+	.ascii	"\314\317\002~&\360\363\320\317\303\237\203~\016\360\363\200\237"
+	.ascii	"\211\214\376\367\375,\374\031\210\025\374\027\372;\302\317\t"
+	.ascii	"~.\372\331\300\377\272\377\351\177\267\377\300h4\032\375\257"
+	.ascii	"\342\3470\277\252"
+	.string	"!\2352\336\332\242\227\034\001\330\301\205GW\247g\274\237\311\370M\212\250\037\235NO\307C*\273Y:\337\371\300\205\311\243\322\351\217\216\365\034\205Y\312\231\215\241,\205\353\332\3549\305$\243\361W\347fy9\0202\351\252\032\323)\335\223h\005c\213\023\344n=\267A\230\300s|\206\3458\316ia\254L^\0043\374&\344\271\027l\f\222{\237lX\r\257a(\3171\334\331\013\177y?\227\316s<\206\337\212\254\356\005\373\"\020\326\206\265\243\316\275O$$\"\244\0378O\204$YS\216c4\fE\300i\200\376\242\374\361\225\255g\004*G\031\201zF\262\236\277\326\263\214\225\311p\031\206\036\261\333Y\f\2079\017\325\363>\357}\006\265\230\237Z\225N\317T\353\371H\005F\243|\244>\2716\017U!\036R\215xHm\372\270\023\356a}\300C\252\252\205\271p\227\277\247\007\314\225\234W\247gZ\317["
+	.ascii	"\004IS\244I\007J:u\006\251\330\254!\323\351\201e|\354W\346\346"
+	.ascii	"\316\237"
+	.string	"\035UW99\303eZ\034\345>\2626lG\253[4\026\3079\205n\025\227:y\255\325St6z\253s\364\215\316\352\032\215\203\241\255\325Vg:\\\347Dm\255\325\227\3378.\b\006\262\272 =)X\266\204R\346\373]\021\213\027\035\312\336\344\365\214\246\301\320\306:\321\363\336\264\b\377\022V\273\350+\216s>o\215\022x:\230\030@\002\212\243\206\256KM\377\276j\031B-O r:\355\030A\347\226\233\325\337\372\367\013\2066\214\277\371\271E\353\036\024/|\235~\357w>b\206\204\361\255\357\275\365M\327,\326\271\274\035pi\3267\334\372\026\263\276\277\254\357,\353\033m\375\331\257\217\307J\031=\270>\226\003\276\270\002{\006h93W,:}\233\255B<T\215x\250v\0039\274\0274\306\366cM\017\304\2203k\235\246q\332\355\b\222\031p\204tF\324\314\362x\326\242z\\\001RK%\323"
+	.string	"(\266mJ\211 \320\336)\351\270\034\026\223Q\033Z\266\351\223<\321<\315\246\237\266)y\\\362$\217K\240S{L\262O*\233\002\331L\233M\226i4\022\203RKe1e\266K\340\201\244\230m\023ydC\020\275\330\336\351\300\225K\226\251\324*\225L%\237\266\251B\2205*?"
+	.string	"5\233\002\240`\nh\233(,\265Id\324\n\325D&\221PL\266e3\240 >\261!\214M\345\360KKLF$@pX\213IJ\307\245R\022I\204R*2\233JI\006\214l\362\210|\"\006\215l3*M*\221m\221m\006Ol\211Ff\323q\231$d\022\235\212\351\021y\"\251db\262OQF\326\251\330lb[\342\323\022\212\035\321\262M6\304q\251\240G{\311\351B\207F\203q]p\254\313GU\177}\371\375l\021\231\233:\353\372\273\253\275Z\350\33601\266\233\345t"
+	.string	"\234\362\301\025\275o}VZ\304\354\316s\030\312v\315Ed\366\234\022\352\215\375\240\341\342\n\200\202\250q,\250\2203fFFFD$-h:p\002\t\346P\355\001\021P%e\306FF\322\324(t\232\331\340sy\247up8C\331\024\302\212\233\264"
+	.string	"\001\263\036\364\263i\360*\244\2440\205\347o\272\225\3431\035\001-\366\3504\312\320\251O\330P\200GI\030\244\036 \314\b\362\177\240\323\326i\347q\236\320\327\032\275J\237\3433U|-\241T\356F\317\255\001\245R\277\365\217\203bb\326\364@\332n%\312v1\025 \372\030\302t\tz\264\241\030\346\020\202\347\274D\f\335s\223\360LT\023\200[h\t\r\243\307\306\033\355\3347\376d\251\030\207b\214\307jZ\314G\326NR6\023%e\366\222\373xg1\fk\265\261[\240!\362\310=\306\240\255\352 w\t\250\021\317\335y\004F\341\276`:\363\256k\335\217\006\317"
+	.ascii	"\223\027)\330I\324>\030\300\256\264\020OT\\\2523\336\020|C\203"
+	.ascii	"\334\341d\300\020\235\234'\244\bKe\332\243gt\350\034\bY\210\322"
+	.ascii	"\242[\225\002\276J#\362'\206\263\205\354\225\360\007"
+	.text
+	.section	.gnu.lto_.symtab.5581fc643b02dadb,"e",@progbits
+	.string	"pgResetTemplate_schedulerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"schedulerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"schedulerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"schedulerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5581fc643b02dadb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,254 @@
+	.file	"frsky_crc.c"
+	.section	.gnu.lto_.profile.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 ;U\001"
+	.string	"\360/"
+	.string	"\003"
+	.string	"\233\330\351\325\004\004\002"
+	.string	"\001\234\222\334\375\003\006\274\316\272\245\003\002\002\001\002\001"
+	.string	"\004"
+	.string	"@"
+	.string	"\231\304\344\006\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 +\315"
+	.string	""
+	.string	"h\037"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001\001\001\001\002\003"
+	.string	"\004"
+	.string	"5\013\263\204\0012\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 \270\345\003"
+	.string	"\342\206\026!\220)\351{PUo\025\034\361\245[\365\321\252\212\356\022\312\017\314\377\377\3770m\205\360\267\210l)S\177\352CL\013\031\270\367\024\243\205\n\363_\260r\211&\203w\312\021I,\004\376\234\3124(\221\346\3757#x:M&\004\177`\333\016\360\0277r\363)\bi\033\370\372\021\f"
+	.string	"^d\224#\263\212\215X\216\254<\202\221\234-\277\350\2719"
+	.ascii	"\004f\324\2055-\330@\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 +\035\001"
+	.string	"\330\037"
+	.string	"\003"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\003\001\001\001\003\177\002"
+	.string	"\002\001\177\002\003"
+	.string	"\002"
+	.ascii	"j\016\266\001,"
+	.text
+	.section	.gnu.lto_.pureconst.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 q\245\001"
+	.string	"$\002e"
+	.string	"\003"
+	.string	"\002\020\001\002\002"
+	.string	"\001"
+	.string	""
+	.string	"\020\020\001\020"
+	.string	"\002\002\002\300\005\300\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\006"
+	.ascii	"P9\324Y\204\231\250\354f\300\fd\003X"
+	.text
+	.section	.gnu.lto_.lto.9e136b749a9fa10,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frskyCheckSumStep.3.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\306\022C:0\345(\035\236w\323r,\240\221\022\2460\016\316\306$\300S\222\271`\034\364\321i\373\330\007\367\3338\326\247\305\312\030*\244P\026P\364\334{\fp\255\030\257 \237\220-eJ\0010"
+	.string	"1"
+	.string	"/"
+	.string	"\317\f\336@{\266}\243=\363g\267\034h\020\274T'"
+	.string	"v\227\323\220\177\317\317\177\311\005V\254\3233\343\260\273\316\025\313\343\326\333N\260\335`\177 \032\323\031\323\33720\033\227\335\2160\300\3062\225\021\333\327\330\326\264;\f\337\301\f\353n\213\245\363\264\377:\311w\230\351\005\273.\224\224]p\301\n[\251W\325o\264R\031Z\323\324\013P\r\270\311\210\264\211\370&\355\331\365!\206\343\003\225\241\r\236RA\354\307\335]\253\313>\370k\207\375YL\007\236QI\"\202H\242O\347\241\3506w\234\316\353 J\037\2217\301ax\234EE\004\210\353<\021\307Ap\350\302\343q\243P\310\3434\340>\256\272\034\303\030JSV\315\225\257^\002\016"
+	.ascii	"2\241\023\034\030\027\350\251\303N\365x\325b>\242!_`\351\032"
+	.ascii	"\020\025\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_frskyCheckSumFini.4.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375`\022\001%\r"
+	.string	"\226\030XB\020\221\223\016\177\233p \363p\210!\360+\\\341WL\245D1\306P\315F\255\212\343\036S\207\214 [\304\377\0358 \264G\375?0"
+	.string	""
+	.string	""
+	.string	"\210\260\002\317\340\254"
+	.string	"\206\006\271\220]#v\357-eJ\001F"
+	.string	"@"
+	.string	"F"
+	.string	"\230\375\202\200\306AA\242\022cw)\355\340\227\330\341\323\304\374\215\225\320&r\3702Z\t\b"
+	.string	"\233\366:J1,Gy\212\266,\337\211\311\365(70\302%\264\231<3\nv\327\031\3320\334\361\266\033\330N`\377\n\035\036J1\326\221}\322\257\311t\3144\314\364\313\264f:3}\316\0064\240e\267\244\233\261/\220%\304\306\366\323~\211\233\300N\ny\200\335Q\n\025\273\034\002\037\230\016\315}#\036N\027\020\017\035$RZ\214d\311\323S=\341\"\322\360y\273\273\317\252~J\004\017\007\346\203\037\022\017\223E\b\306';\247^U\017\3320\335+\342\323T\250\002\252\361\356\236\370\364\252\031qA\222!\313NWZ\264M\225\203\315\211d \025\256\217\312\343A5\271\342\250\254j\201\347\343\262\034P\026,J\002\004\006 Te]\024G\001w&xX\024\205N\307\2426\334^G\316\\ \275\247PE\360\344\345\243\231\243&\314i@=\367\250O\006HD\226\035\344\376\364\001\032"
+	.ascii	";\201!\370\276W;C4,\204\300\340\030\3521uW#PM\244Rw\227j\034"
+	.ascii	"\274x\261\b\225\265#\315\375k\256\005S\022\334\255\226\006\227"
+	.ascii	"\025\232\025\026\240Y\034\244E%\362O\312\235k>\001"
+	.text
+	.section	.gnu.lto_frskyCheckSumIsGood.6.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375`\327\003\355\032"
+	.string	"Fr\254I\240\330M:\020>\361%{\205!\217\027\360\324j\005\027\362\315P\201i\030_\024\233x\226\007(3\365\037I;\237\017\311\332\3662\023X\357\303X/MN1\241\223\026\354\311\002L{\336@u\220b\035\226\020B\b\331r\247\024\224"
+	.string	"\225"
+	.string	"\223"
+	.string	"\377\246]\263[\266\351|\331\343\255\325(\t\316\234\366g\234F\355L>\207\251\365hjG\255\345\001\337\210\377\\\236\006\374'^\006\374\227@A\315?"
+	.string	"\204vI\023\"\247*\265\226\257e\341\322\353\365z\247\345M\035\356\317\305\020\034\351\316\037\277\306\347\212%\333n\n\027\342bQnh\206d\f\024\007E\024\037i(D\342\305\213\224HA\027\360\262\252\256\373\274\341l\223\3068\361\275\3564/\232vS\270\023\237\241\203Z\253\347\b\234\211\233\274m%\333\r\354\275\n\323\3428\035\202\227\272?O\3233\375\373\362?\315\322\260\341dwe%\321\263R\211|UI\247\372\255~\251\257}\177\307\257b\377\341"
+	.string	"IV\317\341\353|\324\336\303\3065Ae\305\225x\224\357\203\307\253d\357aCk\024\004\335\220,\006\342\277\032\032\263\233\236\343y\016\177J\217:\225\217\303P5\331m\370S\003\226d\324Z[\377\244h-*\013\350dg\362Y\021\022\214\200d\311|(\377\306\235d\177\242\321\332\242R\033\022\"3\f\374\263\002\361\337\313\344\261[\001\271\351\323\300qo#oY\226d\2025}\273\356\024\230<YpM\347\356\267\267\226m\355\003!A\223\347o\313.\022\242+@\264\326Z\351\"\335\006l-\313^\367\233)P\306\025\227\334\017\031\205+\356\257N@\n\025\242+>\220\235\036\337\205\357\003\376\013\227N\271\251"
+	.string	"\232=#\370\267\340\006I\262\355\236\224l\263\267P?\204p\273Hvi\233\013Z\360\262\274G\366\3148-CN\307\220\3230\344\364\0139\355\342jM\267\260\334\352n\221\323\344\251\356\221\f\032\336\201\207\266\001\246\223\001&f\330\301\340A\207\003\230\263\223c\201\032\206\003\233\301*\364l\240\315.\274@\314^\0364\344tx\301f\264\027\216"
+	.string	"\307>\350\314^;\261\330\354\325*\201NC\327\316\354mk\200\326f\277\007\224Y\272\257\361/\331\214@U\305\254\f\201'\0353{\254\307\354w\2447\004\3036{b\356\023\224\344@\2305\035\307u\355\315Xw\355\214\222\324\204\0254y\341\313\272,\214x[\201\256}\331\317i\350\312{\247\201\256u\331\347~\023\264#*\002\027\311\037\367\310\277z\204\335\023\034\217@\025J\250A0\242\fC\304(ch\204\210DI\007`\002\2312;\017\021\2609cV4l\007\031 \026\314\222\377l\360a\200\205a\013\021+\345\326\217\245\021\345\\\316\021\002IR\021\330t\310\317k\216\020#\321\024\374\275\312!I@\373\221\343b\344,\003\270B\273\021fk\225\316\375\203\024F?\371\307P\nWAVdc\362\334\214\203>H\245\013i\360}g\024>\034\370-\334\302\351\370\360\263"
+	.ascii	"\371\222\0274\314\034\rl\001\021Sd\353\216.%\004\204\312\205"
+	.ascii	"|\363\242\352\202\021\214\027\344\375\235YM\035\223e\002:6\335"
+	.ascii	"\346\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 L\215\001"
+	.string	"T\002H"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\005\360\372\2508\006\177\006"
+	.string	"\003"
+	.ascii	" \031:\321\270\301\034\003"
+	.text
+	.section	.gnu.lto_.refs.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9e136b749a9fa10,"e",@progbits
+	.string	"(\265/\375`w\004U\036"
+	.string	"69\307H\240\332\315p\374\240\222\247\257\006\361}6\323\374\345E \023\2317\331\356\276\262aQ\300\337\325;\177\023\347\304#d\337\345H`\214\3732{\005\307\302\2315\215\231\361\314\021\"\031\024)\360\033\363\343G\333\316\267\033m\262e\n\244"
+	.string	"\254"
+	.string	"\262"
+	.ascii	"dS\352\202\213\210\204J\264\302\205\264\023\3075\262GV\305\331"
+	.ascii	"\240!\3608VJ\035\212\246\f\2202b\304\321;\244\027g\266\303\305"
+	.ascii	"\001.\324\256\261\023\311\367\340\257\326fI)\304$\021\307\215"
+	.ascii	"\332!\253\346l\021\257\324NYf\252W\177\265F\334A\206jJ\034m\266"
+	.ascii	"\300Ld@z\211\270\306<\217E\322\2333\213\r\207\2333\263\272\005"
+	.ascii	"f\344\022\230\331\316A\340\205E\245e{\306^!\243\275:\032\330"
+	.ascii	"\3260\263\327\206m.\333X\266\257l\007mO\331\246\262\275\332\246"
+	.ascii	"\331\336\262=\016\207\303\241m%\333U\366(\006\247\371\257\276"
+	.ascii	"\247\347\3724\300\372+\257\376JR}z\336M_\355\344\375\322s\375"
+	.ascii	"\245{\256G\3173\321\001\347}\351\327\337\226=\325\037z\256\276"
+	.ascii	"\264v\002\303R 0,\306v\235\274\257\350-\231\250\215\360T}\377"
+	.ascii	"\3727htt\301\277\344C\277\314\244\275\332\tW\354\224\230\276"
+	.ascii	"U\377\337\364vL\276\363\204\347\223\357\177\332\205x/B\251\n"
+	.ascii	"\257c\205\345\215\245#\031\375\007z\177\271\027\376/\377\323"
+	.ascii	"\320%\365\227as6\365z\277\222\201\336\227J&F\277\030\304r\225"
+	.ascii	"\236+\223\357\306\304\310\332\364#\265\334\246\177\375Pr-\213"
+	.ascii	"\034\351\377v\t\262'<\314\251\331\350\rB.\224E\"\203\201u\224"
+	.ascii	"\005G\223&\213E\226\177\354\257A\325$\372\210\362R\341\304\213"
+	.ascii	"\025\004{\002\354\n\363\364%\216\336\027\2447\311*\361V\251["
+	.ascii	"\265W{\364Wz\371\245\246\034sDH\230+)\351\320\234h\364\264\254"
+	.ascii	"\274W\3262\363C\375G\020\213\352\365\320\022\307]\262\300\331"
+	.ascii	"\0170NT\304\321^\026\200\214\351\013\230\2258\232\003)\332\263"
+	.ascii	"\233\350\377\0262\365\350n\306+\333\325\261i6\266\013~\3331\232"
+	.ascii	"\034?\322W\030\351de\316\020G\333\t.\023\236\\\315_\375\245\274"
+	.ascii	"_R\355\\/\236S\314\024\375\257\254\235\177J\0064#r9\t@2\017\271"
+	.ascii	"\\\005\"\013\004\204\206\204(\034p\256D\220\316V\224\313\351"
+	.ascii	"l\001J\004\025e a\"\203\b\\P\210\t5\343\204tACA HG\350q\320\343"
+	.ascii	"s\202f\237\237\007?\017f\366\371\271\335~zn\244{n\261\" \037"
+	.ascii	"Z\021P\317\255hH\310\004\351\333mB\202\r\027*\220\270\035\234"
+	.ascii	"\016\007\204B\004\221\356\203\355\204\3166$\324\201\204\r\247"
+	.ascii	"#\262\355\334\270J\225\365\332`\371\227\352Y`\320Bu\354\355\362"
+	.ascii	"zQ\t\310\032\242EJ\034W\250fe-\327\315\037\303\002v\304%\314"
+	.ascii	"\356\300^\270\210\342\345\332-\332\216\340\025)\342\270[\342"
+	.ascii	"j\355\024\357\326J1\004\036\317\360\324\335\032\177sW\201\200"
+	.ascii	"]\005\001L\250\201(C\214cD\200\214\tHdF\206\030\346\001\220\002"
+	.ascii	"\021*\254\007\021\360\255Y\025\244\2400\373\034m\337EoNz\351"
+	.ascii	"\022\2173zs,\265\374\232\311\3307\253\372h>0\274D\360\235LF\036"
+	.ascii	"\354r\322\364\315\214\341\004\315g6\304\b\205\363\276\345i\247"
+	.ascii	"T\362\253^\262y\332B\337q\211\313D\256\331\2650\3514I\201\340"
+	.ascii	"F\221\204\203&\274|5R\344\311\200\002>0V`\265T\275\201;\201t"
+	.ascii	"BA\305!\004@\371+\231\2640\274M)*\345\016\024<\200N\257\333M"
+	.ascii	"\240\276{\313}\013\375\330\316=c\260f\364\231]\r"
+	.text
+	.section	.gnu.lto_.symtab.9e136b749a9fa10,"e",@progbits
+	.string	"frskyCheckSumStep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.string	"frskyCheckSumFini"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"frskyCheckSumIsGood"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9e136b749a9fa10,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
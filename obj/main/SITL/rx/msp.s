@@ -0,0 +1,332 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\255\334\240\224\003\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\277\257\241\307\t\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"2\306\024\037\240'\351\317\371\244\300sc/\356Z|w\251x\006dUU5.\356\331\337\304\266\275\345N\001\377I`\350\343?\305\230gq\b\374\003\245X\363,\316\340\373m\241`\020\b\277\022\033\007\206\001\315/p\316\204M\330\266g?\302\252\332\022\233\266\200\277\023\001\016"
+	.ascii	" \004\356A\254B\fw]\254\256H\360\302\200A&\\\020\376\250\204"
+	.ascii	"\251b\367\246\340\370\034n\003X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 \274e\003"
+	.string	"\342\004\017\030\2405\351\017.\357\274\252:\352\377\377\377\337P\3646#t\315\332\266R\246\317\303SupH\277\217\307jv`\262\352\233\344\323\307\322\n\233\001\220\224\246Qv\232\362\242\374\211k\247\225\023"
+	.ascii	"H\t\300TN\213\035h\f\246D\227\223\255\262\377\312\202RV\251*"
+	.ascii	"\361\025\201T\001vs\201\272\252\205og\314f;`Y\030\264\001"
+	.text
+	.section	.gnu.lto_.lto.db8ce631a9a51d52,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.21.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\305\t"
+	.string	"FSD:@\305(\035\365aadK$5@h\n\215Pp\331\244\353V\335\034\354y\314\333\006\twa\004j#\333\325\324^\217\026F\037\304\236\002\2421\362\334\231k\214\032#\233\310\235R3"
+	.string	"3"
+	.string	"/"
+	.string	"!\027\021\355\327\003\306\226z\235Z-\273\313e\216\321>\263\037h\237\332q\361R\364_rM\013\005\245\"]\0068\354\256%J\265q\353mkl3\330\037\b\033\b\306\265\253\021\003\260*\023\366a[\2647\333*m\316\202xV\305\013\326\264\222\342\\\332\0379\211\370\361\342\006\273\253\224\223\335Q\301\t\227O\217\027\333~wu\227\335m\360[7\361|\217OO\200\362(P\373\224*"
+	.string	"S\275\376\024\240$c\366H\222\312a?[]\331Sz\236\365k&-U\372Z\241\216\204'\373\204\2350\342\323\201\302\020\005\304\350#\260g#\002;n\364q!P\247\343<\037\310m\020\354\211>\037\027z\336\307m\343>[]M\315\224\324d\251S\237\301b[\004\016"
+	.ascii	"2\241#h`8C\261\365\\\037\214\003V\271\206\237g\361rLh0W\240\302"
+	.ascii	"\301\335\036\325JG\230d"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.22.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.23.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\005\013"
+	.string	"F\325M? O\225\016\303\322@R\240&\003\340\207K\024\211,\304f\004"
+	.string	"'X\241\226\374\024\307\270\206\276\272YL\371^N2\370\242\234_ m\t\004\320*H\213\305\353"
+	.string	"\215T\n@\350\223M\244L)<"
+	.string	"8"
+	.string	";"
+	.string	"\366\016\302T\017b\240:\\\354\202\233r\270\367L\323\363I\317\032\260\302\324\267\272f\bZ'V\222\317\224M>6\254x\354i\341;eB*\273\353L}\027\356x\333\016l+\260\177 NM_S\026\312\243@\270\253\na,\212h\302\203\355\333\036\331\022\333\231\366C<ct\215\t\027\260\353RAb\027L`\003\221G\203\237h\217\221\017\320\036m{\001\203Q\231\2768\336\0217<@\260\310\022->4\250E\332U\002G\212S\276\260\277q\021\"\277\203?\240|\352\321\007i\217\327\307\236\030*\300Z\031\254R\2066HJ}\331\317vw\255\256\230\316\322E\300h2\335\346\003!\304\005\360\205\322\361h\266\020\267m2\026\315v\341<\033\205\2009\035\f\267u\034\016\267I\300\275\272\f1\251P#\364\367\264\307\016 \303\007\215\364=-\225\202\272RRS\016"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214\276I\005#U94\227\332\003"
+	.text
+	.section	.gnu.lto_rxMspInit.24.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\005\013"
+	.string	"\266\323JC\020\251j:\307u\304J \004\232\004\357\212\024{\301>\013.b\256\263\330\316;\f\301"
+	.string	"\026\304\201(4\227\226\317\272dP\0364\222\260"
+	.string	",\006\b\245$\fQ1\0073\020Q\2102.!\267\261\021\331)\0052"
+	.string	"6"
+	.string	"<"
+	.string	"\3357\247\327p\337\2727p\337l\332\020\236\252\354Y\350\b\002\331\356zZ\312\315W\323\277\201cN\224\351\365b\261\273\256'*uk\267\275\261]a\177#vj\252\032\212}\313\356\256\265\225\375\364\257\027\256\301\203\007\007\273$3\t\013\333\030"
+	.string	"\260\375\214\355\232\226&H\274\332\037p\002\346\013\204|aw\325Z\260\233Nx\023\n>(\372:U`\007Dl\367\364\323\016\337\022\237B]\247\352%&'9\333\343\tHL"
+	.string	"\227\214\341#\316\026\375\300\250\333]\n\237\005\362\241\211\255\224\270o\230\023\227\200\b\247:\013_\331)5\276\020,A\242\f\322\250\360\0019@\342\005i\354\354\341\204\310\320#\215\036\b\354\204\236g$=\216\203\305\3207z\245(\216^&\335[V[\031\343\005;i\"v\307\023\361=\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 y\315\002"
+	.string	"d\004u"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\025\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\023\023\200\204\001"
+	.string	""
+	.string	"\003\002\027\177\024\270\300\202\202\200\006\024\025\026\177\026\360\372\2508\200\002\030\177\027\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"]\035\301\275F(\006$6\312*\"\207*\003"
+	.text
+	.section	.gnu.lto_.refs.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.db8ce631a9a51d52,"e",@progbits
+	.string	"(\265/\375`\362\026\305h"
+	.ascii	"\372\254p&SPNJ\352\357\356r6kv\352w\356v\177\374\327?\371\212"
+	.ascii	"\251\362\252\313\200T\375\231Kt\030@\317\325\375\007dE\320\354"
+	.ascii	"\206\225\325\366\366\310\nK n\274\360#\b\321\222\357\350\227"
+	.ascii	"7\335b:\006,v\346\211\332A\271\013\303\204\243\275\373\312\337"
+	.ascii	"d\357\224R(\002L\002_\002\355g\332\353m\006\332\230W\335\214"
+	.ascii	"sQ\247\240(!\301\355r\214\001\343\005\206\3078\231\270\233+3"
+	.ascii	"\271\272%c\342l\306\224\302\226m\355qp8t\315'\257\272\233\213"
+	.ascii	"\361,\r\376\226\"\261\262\025\006:$trEp\273\206\325\353\\\303"
+	.ascii	"\332q\036\306\275\252$\253\302t\032N\0273\261&\036X\307yV\377"
+	.ascii	"b\343V\002\325\217'\354\245\013\216\023\227\027/\265\366.\335"
+	.ascii	"\205\243Q6\246W;\316\271twM\n\005l\355\b\227"
+	.string	"-=iLm\317U\211\0202E^\315\3624\327\322\235}\\\214\024\261\374j;\022w\361,\213K\031Y\202\343U7{\345\323Y\322\253\315\001\356\3568\317r,\335\"H\370\225\233\2343\250`\304\352\316\274\352dn\305\263~\274\254\235\005\017\353\032\3453Co\222Q]Y^m\026\270\375g\315\361\237\265Q`\016A\270?\340\020\316\263r\360\236U}\256\240!\347\031\305\244\003Lk\225q$\307\365\325E\243D,G\364U\357z\217\342^\355]\016\245E\220\350\033e\266\312\371\351]j\316I\367\003p\334\017\330\205\001I6Y\325\376\301\335\316\345[\037&\215N\204W\333\267\272\375\351W\256\345\315\234\2259g\001vU\312\304\274\274\352X\336\304\263:\270\223\366'\036\355]\362\231\2379?s\336\307\234V\223Wu\274g\375\r\270\035\332\027\2602\211~\334\336aM\353\352\274\303\372M\357Y\023p\236\325\227"
+	.ascii	"\2653\341Y\231R\317\234\203\343\204$k\353\325\035\025\272]\211"
+	.ascii	"[uH\227K\315\034\315\371\271\203\225R\270\254^\355\247\367\254"
+	.ascii	"\330y\326\034\335\236\343T\335\316\343\343\030Z\247;=\321kw\252"
+	.ascii	"@t\203\276\351NG,]\320\335\013l\260\351N{\272\035G\267\317\350"
+	.ascii	"\366\030\335\376\324\355K\335\256\324\335d\272\233\256\333\t"
+	.ascii	"\350\356(\335\035\355n\255nGv\373\206\356f\321\335o\335\256\241"
+	.ascii	"\3333t{\001\335\r\326\335_\335\355\325\335[\335m\325\335>\335"
+	.ascii	"M\326\335\273\272\272\272\272n\207\240[m\353\336)\022^\036\356"
+	.ascii	"\267\274\226G\373/\317\366\\\036\313w\361\254_\373\261~*_\245"
+	.ascii	"U\022O\034\216\312\363\350\006\372z/.gt\314\271\366,\374\024"
+	.ascii	"7\223R\221\204I\233\330\332\343\370\034M\226U+h-\331r\270.\217"
+	.ascii	":\251\302\325\r\004%\2123\312{A\t\002\265B\246\223\215\320^8"
+	.ascii	"\253z\234qJq87\223\202 I\364u\254\375\323\265\334\314\204\b\254"
+	.ascii	"\324\332~\b\021\207\303Is\266\301\346$\261\366E\034\016\007\371"
+	.ascii	"\3140h\200\\\361\220\362\361\200\263\346E\f\234\n\265\261\017"
+	.ascii	"\234\0065q\377\024\270\016r\216\322\f\251k\022\363\352\207\001"
+	.ascii	"\365\213\031\020%\f\354U\032L\0037^\342\246\031\203\233\346\013"
+	.ascii	"n\232-\374]jT\331\216 \2576\r\026n\232*\33442p\253\255r\270W"
+	.ascii	"6\334+\032\356u\n\356\025\f\367\032\305\2752\301\275\376\300"
+	.ascii	"\275B\341^\223p\357\344p\357\276\340n\333\205\341.s\344\221x"
+	.ascii	"\226\317'\3613\243\246\251W{\327\205C\310u\356\263\366\016\013"
+	.ascii	"\367\316\211{\007\205[}\303>b\270\325%\370G\305\201C\324\341"
+	.ascii	"\2404\334\351\024\334\321'\270\323#\270\307R\023p\233y\317\372"
+	.ascii	"T5[\336H\210\276\332\351\r\334\251\022w\177\363FN\\\r#\262\247"
+	.ascii	"r\247T\342\265e\303\307\264@\301\255\212\204\271\232!B\300\350"
+	.ascii	"~\252\277\306\205\037I\234V^}\0320\2568\247\336p\177~\250G\272"
+	.ascii	"V\372\374\302IYUh\016\346G\230\321#\335\020\033s\260\244\264"
+	.ascii	" T\252\370\331\016 -x]\217\356\177z\030\037\365#\274\3243?\306"
+	.ascii	"\317\370\246\227\361N\236\365P\256\245_\204_j\237\247Ka\362+"
+	.ascii	"O\262\216\214\350\006z\250Oz\245\364\212\211\267\262l\254\261"
+	.ascii	"y\231\246#\037.\326\017\345Sz-\b\211Y\203\224vB[\316\317v\253"
+	.ascii	"n\240\207\372\244\303\245Og6B[\301\303\021\026\261)er~z\360\361"
+	.ascii	"\200\243\224\314l\361Q\373\257\260\372\214:\317\272\374\0278"
+	.ascii	">\234lM\"\313\252?\312a\263\301\243\312\024~e\253XM\fi2\252\354"
+	.ascii	"E\300\355t\270\275\r\367\227\367\254sNwf%CvfV6wf7\025d\t\213"
+	.ascii	"\\\251\r#F\262\240\245\331\007k\210\215\224\204\037\273i\252"
+	.ascii	"\301\251q\211\212Jg\340(H\0333g5\222\244:\235\321l\317\306\305"
+	.ascii	"\005\311\253\251\f\007[\227I\346\234t\330\b`J\312\302p\032#+"
+	.ascii	"\215\341]\376\002\354\331@\3278ijJ\237\260\r\214,\314\237\356"
+	.ascii	"\324\251\323'84\032n5Rf\006%#\234a\302\300\311\202V\206\355\207"
+	.ascii	"<Y\221\221\002\356N\227\262\322%\337R\361\314H\233\252+&\263"
+	.ascii	"\201\256\371\201;5J\225\235\036uz\224*\251\3109{\027\267\036"
+	.ascii	"W\312d)\251\037\027_\242\270\244/:UJ\343\306\236,\275\232\"\245"
+	.ascii	"\313\233+%3d\3512MJ\201\307\230\363i\340h\241S\022\253Y\342\366"
+	.ascii	"\357^s\222\231s~\332=3\323\350\246}\347\376\323\215\301SG\240"
+	.ascii	"\273\325\234v7\003!<s\322\313\n\016\017\361J\326h\016\271\333"
+	.ascii	",g%\0252\002*'%\225\214%\224*#\225A\220;\314L\205\\Bs\336\311"
+	.ascii	"J%\022E3\357,\241\331)\037\2359y~R!\263\262\231w\2622'9,\225"
+	.ascii	"TNKh\322ig\t\245r\312P\252\254\223\225I\346\013ef\356d(\225["
+	.ascii	"\2066\235t\226\320\246\323\022JU\345^/J\370z\352\262\3321\345"
+	.ascii	"B\226\312\334\3044\225d\352\230-\237\315\254\226\263G\2212\023"
+	.ascii	"\201\234\247\232L\265\244\f\37722k2\202\222l\016\300d\224\243"
+	.ascii	"\231\225fK\"\315\234\211\030\021e\246\007\220O\263\\\345fH\035"
+	.ascii	"Sy\t)g\002\230rFz6\3139#s\3164\314\251g\3164t\226N&\246\234\245"
+	.ascii	"|\230\362\024\022\f)\347\217z\371rZBs4\201\300\234@\2359\351"
+	.ascii	"\211tgV\243bb(\362*/\345\234\375\r;\235\240\304\274\332\235&"
+	.ascii	"S$\331\tS\220\257\246\231&\354\210\b\231W\033\217\341\376\037"
+	.ascii	"@\314Ta]qRA!\314\022&]\202\234\320\202SH\231\022\350\234)\254"
+	.ascii	"9\251\354\250\363&e*x\321\362j3\362J\216|i\373l\302\234\323\207"
+	.ascii	"\\\276r-\234]\316M,\316\260,\262\266\f\346p[\316,\257\366d\276"
+	.ascii	"\205\027\363f\357\366u/\367f~\356\313\276\314[\371\267\217\373"
+	.ascii	"3\177\345\333\236\356\307\374\331\207\371\264\007\363\001opX"
+	.ascii	"A\r\353\"\310\372X\241\035vHD\201\243St\205\270\0038!Tt-8\266"
+	.ascii	"8\355\013\266\354\220\035\302\375@\t\007J\004\035i:\310D\b\023"
+	.ascii	"!\326\0162\001\004d\242\004\020\356\022@\351;T\374\261o/\370"
+	.ascii	"\022\207\330\241\217\313\033\n\002\207\304\023\307\326\246\330"
+	.ascii	"\023\372\332]\361\307\356\034\331\242\242\021\005\260\250Gd3"
+	.ascii	"\frxy4C=\026\304 o\310XT\364\331yY\227m\177\303`\013\336\333"
+	.ascii	"syBc\373z\300\026\335\002n\330\242\236\317\346mY"
+	.ascii	"\027\303\240\257\375\005\205\273aP\210=\360\261D\276cO\210]\226"
+	.ascii	"m\207X\024l\321\320P\002a\357\204\213\"\020\200_\021\221\210"
+	.ascii	"\005\373"
+	.string	"\366\\\004_\237\004\354\217hA\033\354\371\f\203>\3265\362\216\355\205\243\261\307;\366\2049nKl[\266g}Y\027\b$^`\177D\341\316;\f\022\213/\353f\370\265\275\017Z\"\360\307\262\300\r@ \3615\372xn\360\330\343\r\031[\260?\001@(\266\031\330\242\367%\266D/\257%\276\276\036\220G|\215=\336\3200H\364\022\211B\227\347k\017\370\021\203-[\344\001\213E< \317\327\272\274\240\353\266\003\374\202\274784b\020Qtl\335\234\327\355\001y?c\257\005\3175\266pq\332\241\313;\266<\3265\362\200n\353\313yy\"Fx\340\366\204<\227\307\376\202m\313\272 \362\212\256\220\200\267\211>\034[b\221mA\274Db\013\342\202\320\353\366\212v^\236\r[\004\201\205\006B\030\334\264\354/\350\202\330\2568\266E\275`\313\272:\357\320H<q\303\276=!\"\227m\201\254\320\261\305"
+	.ascii	"\3000\305\007=\241_\217\025\362\265\027\332wE\020\3150\205kl"
+	.ascii	"\337\025<.\217}{/\006C\243\320\261\325\031\246p]\326GlW\370Z"
+	.ascii	"\235\227\245\300\327\002\360\362^<L\341f\300\n\203,R\370\332"
+	.ascii	"\234\"v8\354\021\371.\364\336\036\nV\330k\2015ED\342\004\274"
+	.ascii	"\335\313+\001\364\016\203F\334@@'8dp\001\005\330\367\241\350"
+	.ascii	"\nA\034[\020\303`O\b\302\327\272 >\360\350xJ\313\302\220\t\311"
+	.ascii	"\241\324\002\027\324\355\325\0325R\034#p\364\270r\004\003"
+	.string	"\362\250I\253\331)\216\233+\024\276\fy5\235Jo\324\360\230#\343t\243\003\201\321\250\221,\250\02443\"\"\"\"I\222\244\003q\005\304(\310\2442\036\022 t5\2271\311\3044II\251\264\317f\225v\311\215\262\350\337'\224\220\337\2070!w\026\361\030\273\207\333\265\373\243\233\002u\304\226\f\t\n(\271ro\232\005\270[3\320\2752\\\b\210N\211\026\305\032\320~\332\210\220S9\227\334\263\310\316a\210\343\330\245d\260^\374\376\315\321Wf$s\352\320\260\033\f\262!\260\362\024c\006\202Ow\210\b\360_\201$A\227BQu\031\r\031'\035\364\243\205~\256\023z\001[4$\340}7\013\353q ;%7\212RU\216\325[\177\335+\274$\234F\227\321\275\022\003\276\210W\177\217\372+\357!\211\327&@?>\302\256/\001\001\310\225\327`\257\372\001\242\255{\024\215\340\034\013\307|S\251F\375"
+	.string	"\314\007=#\024'\013\246c\273!\365R\301c\356\235\225\213$\034\222\340\2028f\253\030\350\256\177\237LWc\\\343:\236`\316\261)E\223/\366\367\315\017\264v\036\347\236\250\325\367X\306\355]w\013\374p\265 m\2654\205qx\256\301\303\324$\241\027\035XSq\232lU\f\275sv\222k\023\003\375?g\315)\262\221\377\253\331\300%\344\254\331\264\3519\226J\022\311\336\265\247\001\313\244\253\317\354\350\377\337\251yP8\217\256S(S\216g\031\344\002\233M\346@\234\302\334\234\215u\212m\302z$VA}\240\2009"
+	.ascii	"("
+	.string	"\177\027\376\371\264Dv\236\033\371\216\256\272\350(\371\002B\317\360-q\300\365\301\027\347i\3063\266\232\250\217\315\311\227?\231Ac\366\270-\334U\025GUr\326\2468\235\364U\302z\211\340\242\221\233\310H\332\003\036\374$\001\336L0\352\217c\271^-J\311\030\237\227\016z@7\321\0327\305\304R\337b\334}\261\241\226\267\001!>]\366^\340\335\301\213\\U\306\025\227\212\310\330m\365\372=\016d\033\326\335\033\3554\252\334\213\0020_\312\372\302t\274\n\206\304{\250\225\3013>\330\232\033\340\251n$\360\317\277E\202\314\355\207\364\201\341\277\232%tb\217\204\016\344\366\232\321\357\307s\222\205\241|\002.\t\345|E\2742\211\237\215\354p\321I\216An<\027\324+v9\306\363i\202_\370\207uy\274@\n\200\356\036\b6s0\256\236\314\333\005\r\252\376^P\210\200J\372\337\362\324\220l\253Ppv"
+	.string	"_7\334\324\222\007\314r\321\207\264\341k\005\316\177E\3723LI\376\213\002}\270\312\350\030\305\343]B\355\326\212F\202c\323+3b\021!H\310\302\361N\256\2104\201YH"
+	.ascii	" \261\300\253$\335\222\303\001\002 $_\\\034\231\202\213\200U"
+	.ascii	"\364\006V1\356\3206\2742%]\352B\236\257\212hj\351\242i\272\034"
+	.ascii	"\352\315X\272\334;(\243r:rr#\260D\372\200\231w\371\2541\265Y"
+	.ascii	">.\360\177\217aL\200\210\243L\021s\377\201\341\275\216\274&A"
+	.ascii	"\3637\246\375H\007\b\274aZG_7\235\347gq#\323\037\267\305\207"
+	.ascii	"\332\260\215\342\272]\306P\nM\362\277.v}\230>u\275\235\307\303"
+	.ascii	"\241Q\260\f\300E\335\216\362\215:^\034.0\202=\264\277J7\002\246"
+	.ascii	"\315\315\037a\242\005\203\200m\265?^&\005\016\214B]\005"
+	.text
+	.section	.gnu.lto_.symtab.db8ce631a9a51d52,"e",@progbits
+	.string	"rxMspReadRawRC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.db8ce631a9a51d52,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
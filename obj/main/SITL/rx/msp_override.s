@@ -0,0 +1,309 @@
+	.file	"msp_override.c"
+	.section	.gnu.lto_.profile.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 \035\315"
+	.string	""
+	.string	"\230\021"
+	.string	"\001"
+	.string	"\275\227\370\261\n\004\002"
+	.string	"\002\001\002\002\002\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 @m\001"
+	.string	"\3604"
+	.string	"\001"
+	.string	"\003\001\002\004\002"
+	.string	"\020\b\001\020\b\006"
+	.string	""
+	.string	""
+	.string	"\004\003\001"
+	.string	"\002\001\200"
+	.string	""
+	.string	"\002"
+	.string	"\005"
+	.ascii	".6d\036I1\314\247\r\033h\003"
+	.text
+	.section	.gnu.lto_.inline.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 \202\375\002"
+	.string	"\"\205\022\036\220)\351\277\203\350\025\031\316\250J"
+	.string	"\256*\007\333\356\376\377_\373~\201\237\326\032\331[\356\024\007\222Q\032%\376\3151\266L\340\367\315\001\333\226\005>\332*o0\206\243\241"
+	.string	"\234\377\260x\325>\326\334\016\266\200D\022\202\257\021\001\007"
+	.ascii	"/[\301\340.\304\310y\311K\235\037\025\312\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 n=\002"
+	.string	"T\003b"
+	.string	"\001"
+	.string	"\003\001\001\001?\002\002\001"
+	.string	"\002\003\177\002\005\002\002\006s\001("
+	.string	"\001\300\004\001(\300\004\001"
+	.string	""
+	.string	"\004\004\177"
+	.string	""
+	.string	""
+	.string	"\300\004\002\001\377\001\001"
+	.string	":\200\001"
+	.string	"\006"
+	.string	"`EPw`\022x\t\342\231\367m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 <\275\001"
+	.string	"\344\0020"
+	.string	"\001"
+	.string	"\003"
+	.string	"\374\005\002\002\007"
+	.string	"\001\002\004"
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\300"
+	.string	"\300"
+	.string	"\002\b"
+	.string	"\001\002\t"
+	.string	"\001\001\001"
+	.string	"\200\003  "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"2C\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.b27a04e5b1c31852,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspOverrideReadRawRc.26.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375`^\002e\024"
+	.string	"Fg\213K\300\224Q:k\302\210\311\3403&\013\256\007\001\261+\373\305H"
+	.string	"d#\225G\217\307\033\273Q\0358\232\357\366G\177\375\222BC\264\366y\267f\273v\020\247E@\361P\367\032\0027\"\335\247\365\320Sj\375\214\033\2374\262\211\224I\006t"
+	.string	"o"
+	.string	"u"
+	.string	"=t3\200UyD?\f\230w\037t!\334O\234\267j\r\026Y\252\365lY\026\362tOrw\367?\007\302m\216O\237\021\t\204|FDj=K\326U\306S~\200\361\264a<w*6\347\366\272S\332S\372\001M\\\\\251\265\256\200=nQ\245\311E\220\023 O4\300\263\243\304\207g\035\340\2169\365Rk]\376\001I|\307\357.\314\356f\330e\025\001:\356\236\335\213\265\203\273\037\372\001\\\370m\035\351\213\362\242\337\344\347_\262\274$*^\025\311K\222\274)\222w\244\2744\305+\246x\233\362\362\310\373\224\030\337Q\312Q\255;QO\225\211\346\230q\341\217t\336\305\355\217>\334\025Rn\205\326\312bH\243\302\2059\261\372\274"
+	.ascii	"%\r\251\365<p\272\017H\312\273\b\024\340^\004\342\254\272\363"
+	.ascii	"\301\303A\256qw\002\005\376O\325\261\025L\274\326m\252\307&["
+	.ascii	"4\362\245\330\301|)F\311\302\205\233\3614\325-1\202h\217\334"
+	.ascii	",\247]\276\330\375\020>\3558j\305n\261\366\005\343\377\304\376"
+	.ascii	"\021\024L\335(}\247\020=L\230\273\244\367\335\275\322k\335\232"
+	.ascii	"4\367}P;\363\0332\262V\336\202}\222L\007\262\326z\031\247{\234"
+	.ascii	"\361\364\375\341U\206\202<6\202r8j\367\f1\032\333\354\345\242"
+	.ascii	"\261\315^\256\023\332\213\003L\234\221\311\320j\rlL2v{\335\\"
+	.ascii	"\261\231\354F\363 \301\306<Y\230Kl\203\3144c\037j\030l5\263\322"
+	.ascii	"\306,i\262\327\254\204\2315\245\013\201\255\331bfy\253\325\314"
+	.ascii	"ru\326wpW'D\224\376\360\020D@u\253IZgwIz_rzG\273gu\364vj\210"
+	.ascii	"\035\334G\030\311f!g\034NM-z6\252Z\003\021\020\036\033Y\001\\"
+	.ascii	"\340\001( \300\242\031\254y\340\240\b;\235\004\241=\265#\253"
+	.ascii	"\260Y\3208b\341\335\263\362[\003\214\260\025D\266<\036\275\307"
+	.ascii	"\264c'\t\026ax\322+\370\205h\207p\213{\242g\310\210/\006\336"
+	.ascii	"\234y\242lXp\005\247\027\0309\334\205\037&(\262'\340\260A\"\035"
+	.ascii	"8\033\257%d\005\013\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 s\205\002"
+	.string	"\264\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\032\177\n\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\001\034\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\033\177\f\003"
+	.string	"\002\244\001\003"
+	.string	"\001\344\006\004\200\004\001u"
+	.string	"\007"
+	.string	"]\205\341\032\032\n\303"
+	.ascii	"u\370\024\375y\2312@\006"
+	.text
+	.section	.gnu.lto_.refs.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b27a04e5b1c31852,"e",@progbits
+	.string	"(\265/\375`'\025\355b"
+	.ascii	"\312\244\254$R@\016;\352\301\013uv\315\253\241\357h\230\304\310"
+	.ascii	"\271hd\233C\351\374\001\317m\346\352\020\263z\241y\310\354\206"
+	.ascii	"E\006(Ck\333\273`\363\207\370m\261-+\330\334p\224E GS\217\007"
+	.ascii	"\330\2330\250\313\301\300\270\211\213\201\340\205\037\352\220"
+	.ascii	"\266\311\336)\245\024\002*\002G\002D\"0\216&9cDi\177\026N\227"
+	.ascii	"X>\244\276\360'\210R\r\322\205\317G"
+	.string	"\274\016\220\032*\037\\z`\247\323)\023\351\203\016qty\022p\377\f\334\036\0077\227sP\263\374M\025\025N\230\230s\f\267s\3616f=V\3169\317+\314\306,\003X\223\226bY\273\2313\323\220W\237\366\231\257\361-.\303\037kz\312O\031\247W\324\022\034\344C\252\237)\223\301l\205\244\020\036\330L\231\237\243\226\231-1\355e\232\f\306\302R\003\365\251\223y\037s\262v2>\246\207\350d\322\234\207\356\006\374\270\033P\3232d(EM\333O\300}\206Z\351J\303\344\tw\273\030\030\227ZR\225\302\247\356|\242\r\261\031\2376\b\270\273\317\274\312\277\270\227\024\215\327\223\316\247\036\3461xU\221wi\277\342Xz\207\270\314\315\236!\016,`>\355\037n/R\201\274H\355\0160\b\260/5\207\2149Z\237\372\013\236\305\253B8\f\355Z\334\253k\303e^~\220:U\244|\032\344\034\324\327"
+	.ascii	"\267\207P\321\347\323C\250=\001n\025\270\204\017\251 \234\203"
+	.ascii	"\232.\265\262v\220\030\351J\3734\253Jm\212\310\323\027\254\366"
+	.ascii	"*\275\325\223\263\207\2376:\302\274\371\324\245\370U:e\245\211"
+	.ascii	"\311\257\272\375\211Cq*h\361\t\231\261r^\nq\030\003U\266T\237"
+	.ascii	"\030\201\323\302\247U>\305\233\313L\344l\262x\345O\273\004\356"
+	.ascii	"3gv\367N\215\307\0334[\237z\024_z\325\007\267\352\004L4*df(9"
+	.ascii	"/\201|\322\232\244\315\371\264\213p\373\007\325\237\376Amw\241"
+	.ascii	"\201\304\262\211~\334K\347\240b\037R\273=\200nw\272\321\355\034"
+	.ascii	"\030mt7V\267\363\364Xw\207\350\356\n\272\273Jw\277h\257\356\356"
+	.ascii	"\320\215\nu\373\261\333\237\272\275\330\355\"t;\260\3335t{\b"
+	.ascii	"\335m\325\355\037t{\214n\337\320\355C\335\235\325\335>\335\035"
+	.ascii	"\326\335\377|>\237\335-\244\273\366\241;\250\202\216F\305\231"
+	.ascii	"YJ\257\357\362h^\315\223y-?\366n\276\354\327<\233\177\341\323"
+	.ascii	"|\327\223\275\2317\373,?\346\333\374\231\377z1\317\345\301\374"
+	.ascii	"\227/\363a\277\345\301\336\371a>\206\207\341\275x\325\213\375"
+	.ascii	"\225~,\277\325\251\t(\316\334\362;\272\215\246|SK\351\002\230"
+	.ascii	"R\354\253\274\025wJE\340$J\331\226\330\343x))E\252\253*H\242"
+	.ascii	"8\023\213{=\341\262\3546\262\272\242d~\323\n\217&1p\005\345\245"
+	.ascii	"04\224T(\320Qb"
+	.string	"9\323\235R\f8\301z\035b\257\304\277\334\311B\003P\310\312\236\205\037\316\374As\246R\2434!\366A\234\371#\\\346\032\266!V>\234\020\211\370Ic\206\215\233\b\322\306I0\212\342\007\356\267\302\354 \007`C\362\214b\363\351g\031\365k\r\251F\251e\306\"\340\212\226\256Om\230\007n|\304m{\342\266\271\301m\313\202_J\212\243K\017\"\237\266M\013\267\355\bn\033\0227\231\215\210[\205\203[E\203[u\342V\271\340V\273p\253X\270U%\270\325)\334\252\021\267J\304]s\203\273\254\346\0057\332\220'\342UD_$\003\271\330R\324\324\247]\373\302#\344\247\023\251]\323\302]k\202\2736\205;\245\203\211\276\340N\257p\021\020\\\"-b\024jp\243N\334X\\\270Q+\334`\250\021\334N\347\240~\216\235\2616'`}\332(\013\270Q(\334\375%\024\371\304\031[b\362$\364\337"
+	.ascii	":\333\261\024\366\351\333X\022k\304'[Ytp;\332;y\034\377B\227"
+	.ascii	"\\x\306\224\037a\034\215\020,s<\r\205\255.\007\2331\206\310\026"
+	.ascii	"..\326c\310\231\303\001\322\3643>\352\241\336\370\305\177\372"
+	.ascii	"\3433}\215\247\341U\357\344\315\376\245'6\3212gb\316\331\255"
+	.ascii	"\274\f\367r5\205\211\002\335F\357\344\317\037\242VF\2345\205"
+	.ascii	"*\215\032w\023%#\210o\365;9W\247A\301d\334a\032S\244,\347e;\224"
+	.ascii	"n\243wr9\316D\227\312\274\024\346\005\0212\320\340\210\203\226"
+	.ascii	"\363RD\255Kb\204\007\022\236\314\234\274\021r\343\030G\253i\366"
+	.ascii	"iT\024zt2\307#GT\2613M8\306F\217\275\205\236\201]=}\212\326@"
+	.ascii	"\231z\254\232\344\204\311\301\335\324M\350\2233s\215\rY\300\024"
+	.ascii	"1\242\345,U\364\023\306G\223\223S\243Od\200\226\224\b\271\362"
+	.ascii	"s|\230\244\031\243\003\013\356\257\363i\375\317\376'Z\3049g\365"
+	.ascii	"\312,\b\027Z\226\222*r9Q\210\230\2413\032-~\251O\300\320P\341"
+	.ascii	"S\224\2102\361$\021\223\202\027&T\206\022"
+	.string	"\037`\312\267\361#&\255\311\353S4\243K>7\222c]\320\245F\207K\226\200\tsF\304DB\205\n\377J\017\222\314\r\331\247\275\243\003w\177\267\232\207\306\234\263\215\3322\033\227z\332k\356E\335>\216\372\001\335\235f\264[\304\213\234\20708\335`$[\303\035\r\"w\315\23131)l y$&s\024\233\311,$\022\021\n\031sRXl\346,\224\211D!\013d\026*6\3631\313\020;z^&\205\231\210\314B\231\230\207 \212\304\344\261\330\034\036\205\212\315\34417\2239(\023\207F\032\304l\024\312\315\244Yn\"\217A\305&\362Xl&\1778\032\r 6ll9{P\271U\221\230\243\240\246\206\306 gq\211\314d9;\026S6\036\220\363\024\322H6\314\341\\K\316\250%+C\244w\200Z\342\201\314Dg1\t2\347$KI\031j\001\341\322\231\177\270S\250\302T~b\312Y"
+	.string	"\250\234\205\236\2359ga\316\331f\234Z\346lBPQ\t\005\225\263\024\021T\236\022v1\345\374Xf\270\216\305&\017\244Q\027\225\2462\317X\n\275\370\204\314\312L\2264\342\246\320*?\345\234\275\rV\036o\260\371t\331\334 \265$\352\323\227\263\2034A\312\020M\234\245JEK\2235p\336\204\025\371\022~zf\323\"#\t\234O\033\203\301\375)$\345P-\361\242\334\262\302\232$ex\250\020\347{\370@\3331\225\246\004\222\306\204\247\222I\227#f\214t\033Um\225\ty\245;\245\030`r\246\314\321N\250\243D\316i\301\277~j9#\277(\2618\t+\013\2354b\303\212\237N\032\341\342Z\0228]\207\0072\220\340\305\n\025\353\003,,\240`]q\264^ \201P\177\300\035Y\360s)\b\266"
+	.ascii	"4n\327\262=\026\t\367\002'\0208\201\"hk\024)J\244(\2416\212\024"
+	.ascii	"FF)N\030\341>a\204\262kN\202\240\017\206\355E\372\345\330\367"
+	.ascii	"\266{}Hl\217\310]\221v\272\236oE\260\315\360\273\361pm\355\227"
+	.ascii	"c\205\202\254\322\017\310B\247tK\312\320\333\201xW\033\322\355"
+	.ascii	"\205o\267\"\001\225~DB/\353\262m\256\267\203\261\2767w\345\001"
+	.ascii	"\333\327\003\366\347\016\320\303*\335p\031\336\226\215\321\333"
+	.ascii	"\341\332\334\216W\353\355x\330\003\034\233\204\013\336x\330e"
+	.ascii	"\331\026\211e\301*!\365T\360n+b\374t\032rJ\276\244\027\354{\213"
+	.ascii	"\261{q*\330\234\217\202vw#\352"
+	.string	"\355p\254\013\\\203-O\020x[\2037\036\220\333\372\332\226\345\240\276\254\253\323\371x\330\234\217'\364\366v\276\337\313\272\036r\355\355\203\326\247\313\261\254\256"
+	.string	"\235\316\367\002q\253\273\013\336V$ \f6\027"
+	.string	"\b\277\326\003\253\364\276\2766\351][\337\213\273\351V\337\013\274\255H\275]\322\353\363\361\334\025\327\032\220\363\355Z\366\267\352~J\253n\305\265\356\272s\335\266Cn\267\276\273\036\320'\001\245`\353\002\275\356M\267\346\2007\030\253\013\204\341\376\264=w\r\266+\353\002W\235\333\342\200\3365\001\005<po\274\325]\005x;iD\260\035j\337\217mI\274>_K\202\347\350uoJB\357\232\201\375\201\360b\203\243\013zZ6\267\213\341k]\004[\245\333\256e\335\240\267\007\364\255\350a\337\333Q\222\313\266:\366(\330\372|p;\312\335\330#\\\313\323\276.4\364Z\270\300\366u1\244\344\3639\260\326z-\\\227\305\371Z\027\2706\350e!\300\265\032\336\325\305"
+	.string	"\367Z\270\030\260\274\335\213\026\270\026\350]O\030a%\266\327\273%\341xn\357\215\005\313\273\265\272\035we\337\333{\001\313\333\275=\340Q\260\rzW\024oo\007\264\265\221\321\n\020\030T"
+	.string	"\001\306\215`s\273\266ec\370\326\237\313#\021lI\364v7\036\t\\\201\241\250\2210\311\22033\"\"\"\322$\205tq\005\304 \350\034;\036\022"
+	.ascii	"d5\3271\350\210\tIR(M\373g\330s!\220d\270\2001\246\215-\026\256"
+	.ascii	"\3143\203/\266xi\264i\353\f:\211\255\303\006\031\032\021\220"
+	.ascii	"[+\277\211\030p'\233A;u5L@I\2725\312Z\t*\357s\b!\224C\255q\026"
+	.ascii	"!'\030\3478\002J\006\0049\036_\363\005\226\001q\236\202cM\002"
+	.ascii	"Gp\034`\244bcy\203\217\034\334\266X\f\340}\333\205\376T\325v"
+	.ascii	"X&\374T\273Y^ \340\252\376T\3500-\234\030\317z\267\t;!\241,\375"
+	.ascii	"\361\213\342\2407\035\003\304\233\314x\304\021k\006\024A\251"
+	.ascii	">\241\237!/\013y\222\024,zM\244\201Rys\322\200\360\320-\342y"
+	.ascii	"\013\202\330\200z&\272\t\265\356WTHX\031\203\274\270\275.\341"
+	.ascii	"I\233\005d\2677}s\035\304\316\325\241-\035S-'\326W\321\356\\"
+	.ascii	"\2120\267\205_/\257\325\\\202\355\343\237e#,,\331\222\260\352"
+	.ascii	"I\205\253\201\367\177\315\\:\251Dc*\240\023\247e4\227\027\362"
+	.ascii	"\326A\342\216D\024\2137-}\216QK=\n\246\324\233\025:\314J\242"
+	.ascii	"\216\367a)%\240\205}\016j4\037\260a!M\306\026\253)\024\237L\266"
+	.ascii	"\222\3641L\022\206\235\201\2458\367y\n\367+\212\220\004\372N"
+	.ascii	"\346>(\006(\247\035\252f\351B}q\371=\301 \240`\fg\220<(\021\264"
+	.ascii	"\225\001\003\263b\0041\240h\022\t,\273\200\004ap\b''r\234\315"
+	.ascii	"\300\246\001u\226>\031\310\330D\222\023\250\305\244\016c\265"
+	.ascii	"P\356\357\215\262\227\217\244h\310\022<D\001\343\343\"\217>\213"
+	.ascii	"\300\333i\363\316I\345\036\323\220>BY?!\037c\271B\030\234\363"
+	.ascii	"w\t\263\221\205\247BYB\267\034\263_\360h\0069!\307x\354-K\304"
+	.ascii	"\336\274h)\307\255:n\035\003[\364\032\360\331R#\330'y\035\020"
+	.ascii	"\207\035\225\260\022\346ox\260g\256\300Hj\233z\343\324P\343\326"
+	.ascii	"P\007K~T\346\221\237\373\221\2454\1776L\201M\275:\326V:\317\230"
+	.ascii	"\3643\260y\202\002:\007\234\206Q\313h=;\353A\322U\002\017\335"
+	.ascii	"\371\037\373O\022\276\366\332oH\031\002\020\335g\0055\260\301"
+	.ascii	"?zr\013\251\361\245\256\202\332j\353\344\3477\343$\315K\205\230"
+	.ascii	"\347\301\254D\266\302\030=\240Na\357\352\206\260(\0245\337B\252"
+	.ascii	"0\276|\202\017;v\231\021\370\350s\347\200\n\020\223+\201|N\320"
+	.ascii	"\rcM\3746\344\260\210\201bT\246P\321k\024\3538\330\032\332\310"
+	.ascii	"1\r\204\2208\325\3200\225 KX\3213\302\213\003\331\374b;\013\216"
+	.ascii	"\224\326\310\005LE \317&\340fY\3158R\0377\361\207\\L\003z;\177"
+	.ascii	"\237\322\212\037\035,\206\374\360\212\246\032\305\\\324\203V"
+	.ascii	"\030(\367\b6\017K\277\026\206n\033\353\313$+\271\341\017\022"
+	.ascii	"\013XQA(\351\022\254\331\034\310\376{\237\362\031\211\273\b\335"
+	.ascii	"\210\327\"\261\353}\275Al\325\366\225T\001"
+	.text
+	.section	.gnu.lto_.symtab.b27a04e5b1c31852,"e",@progbits
+	.string	"rxMspOverrideReadRawRc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"rxMspReadRawRC"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b27a04e5b1c31852,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2347 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\006"
+	.string	"5"
+	.string	"A"
+	.string	"M"
+	.text
+	.section	.gnu.lto_.icf.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\246\003\215\026"
+	.string	"\244\036\232\004"
+	.string	"O"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\232\372\246\216\007"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\371\257\210\331\001\006\204\361\210\371\004\n\002\002\002\005\002\006\002\005\002\007\002\b\002\t\002\002\b\240\342\234\212\n\t\n\013\f\360\353\330\337\n\b\013\002\013\002"
+	.string	"\002"
+	.string	"\r\016\017\352\263\360\321\b\020\245\276\225\261\004\006\002\002\002\f\002"
+	.string	"\002\005\022\274\341\270\247\005\b\002\r\002\r\r\002\r\023\024\231\233\302\213\016\002\025\026\323\331\354\253\b"
+	.string	"\002\006\002\006\027\030\256\334\323\366\007\004\031\307\233\244\242\007\016\002\016\002\017\002\020\016\002\016\032\033\034\035\347\346\214\201\r\036\264\370\341\227\005\037\233\325\206\343\001>\002\021\002\b\022\002\b\023\002\b\002\024\002\b\002\006\002\006\002\025\026\013\002\013\002 !#\350\300\306\254\005\002\002\027\002\027$%&'\264\227\216\337\r"
+	.string	"(\262\374\202\245\005"
+	.string	")\354\301\314\336\005"
+	.string	"*\301\302\300\375\n\004+,-\201\336\325\251\r$"
+	.string	"\002\030\016\002\0312\357\307\354\213\016\016\006\002345\377\245\346\313\017\b\027\002\0276\365\273\261\345\005\032\002\033\002\0337\202\245\236\333\0068\274\201\267\213\007\004"
+	.string	"\002"
+	.string	"9\205\326\204\336\017\020"
+	.string	"\002\034"
+	.string	"\002"
+	.string	":;<=\267\205\240\220\r\026\020"
+	.string	"\020>?@A\275\375\210\345\001 \016\002\031\016\002\031BC\273\322\210zD\323\343\357\213\016\006E\312\267\354h\002F\256\372\301\335\003\b\035\002\005G\307\361\344\362\bH\347\273\234\355\f\016I\223\335\346zJ\016\002\016K\313\331\347\361\004\002\002"
+	.string	"\002\bL\342\201\222\246\004M\212\254\201\341\006\f\002\036\002\b\002\037\002\037\020\002\020NOP\233\322\312\256\t\002Q\260\233\213\233\tRS\321\265\255\355\007TU\240\342\234\212\n"
+	.ascii	"}\250A\275@!B72SR\220tP\202RTt\036\021pi3E)\025\2461\267\303"
+	.ascii	"IJ_\234\367\356\177\354\034v\370U\037\002\206%\366\006\347\254"
+	.ascii	"8G\305\263\"F\223\3356\343\0305G5\342\200\255\352t(f\371\346"
+	.ascii	"\031\331\207\236\022\203\264/\355.\217\305\205\277\rHT\212\301"
+	.ascii	"\217\233A*z\305]\033\223\220\"DbBHo\005Q\265\017M>\221\255\334"
+	.ascii	"lo\332\\\251\243\343\357J8\240\205G\344V\fP\013\255\"\f\004z"
+	.ascii	"g\005\340\215\b\201\366\356\231d\254\273\245\206\252\263\264"
+	.ascii	"G_\327\263G\322\001p\363\227!\267\370ga\373x\201\005a\242\003"
+	.ascii	"<\n\r\342o=9n\024\343\310k\024\3036\317$$\243\257\336G\240\r"
+	.ascii	"\377\037H\026B\277\270\317 \027b\215\237;\371\310\220m\323b\345"
+	.ascii	"}q\367\305\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\375\006"
+	.string	"\022\210\030\037pO\206\003\374\377\377\377\377\377\377\317_\177}\"?\243\n\270\276x\354HK\256m\177)e\nw\322\250\213z\b\364\351\236N\347l\266i\236\313\f\263/\263THy\336M\272\344\310w\332 \017Got\306[\221@\034fx+\360\022\372\032\034\340\246\252~\344\370\\\220T\200\256\025\274&\267\247W\n; `\202\201\224\334U\031\260\037\314\373d#\201\270\211pd\220\303"
+	.string	"\300\271n\230\266C\222:\216\235\311@\355\244\276"
+	.string	"\274A\207\350\022a\366A-\0134\313X~3tc\252\265/+\255\240\270l\220}"
+	.ascii	"\253M\274\035b\f\204\335\266Q_t\215\304\027\206\215\2030\307"
+	.ascii	"d\300\2421_t\345\202c8\334\320<\r\201gn$\216\036\274>`5\330\306"
+	.ascii	"\350\241\350\301\360\305\005\037\002"
+	.text
+	.section	.gnu.lto_.inline.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\n\b\215\036"
+	.string	"6\351\224K\220TR:\f\034\324{t\273%\331\374\256\341+\253\276\355\307\002\203DK~\227\206R\330\271:\332-\370\032\373\340\205\021\211X\004U\325\006\236L\""
+	.string	"\244\032q+\342^\326\327\033g\310\263qSv\337\276\360\223:\276m{K\231\002v"
+	.string	"|"
+	.string	"\205"
+	.ascii	"g\224Z\316\362\324\263+\025F^\377\325\247\243D\bI\366n\373\217"
+	.ascii	"X\273\375\321\233\215\211\261\350"
+	.string	"mN\037\211\221J\325\267E\337vCM\263\221\022\371\347\355\355G\353c\232\371\277L\353\350\3114\320\355k\260Z\225ia\241\257\331\032\342\336;\374\353\273\247\315\230\224\212\273\236n2)\025s\347~\353\364\275\367\332~a\035K\323&J\377,\254i\2326M\376\233\237K\002h\037\320\224\246DpZiJ\004\300a*\362\336\3732\223r\227~R\313\317c\341\371\225\347\3549t\375\337k>\277\n\333\351\336k\362\335O\372\274=5\324\244\321\222W\277\301u\274t#\254\316\200t\265\330\377\274\346,\346\365\207\037\017\034\204e\3435\210\327^\203\2554*\251\004\\\207\253\300\236\201LC\323\225H\242\204Hw\364\347`\177\335{W\204\225\353\336\253r\234\316\366\037\261>6\353k\246\301\276\006\342\277\306AG\233\257\177\330\246\200\272B\321\362\005:'\260oWP\217E'\261\333\317\323OGWQ,e\313\261\256"
+	.ascii	"O\360\247\324\376#\002+\331\275WW\fC\312\332\035\301Qh\207\030"
+	.ascii	"\314\n\262)\030\273\037\370\217\310?\343jQ\375Z\032\271\301I"
+	.ascii	"[>\220,\276|\001\342\275C\024\351\336a\3567\004L\2026?\007k\355"
+	.ascii	"5\276\332c>\351\037\321\247\212\361H\343b\250\016\335\034\352"
+	.ascii	"\261\364\317\200\332K1\253\224nG8\230G\226~\030\263\252I\345"
+	.ascii	"\030\376\337\013\026*\314|Q\230\300;-t\357u\271\204\n\323'z\004"
+	.ascii	"\241\"F%\025\356\020P:\330`MF&\3568?\242\255a\207\312\345\223"
+	.ascii	"\031\316\246\231\371\305\320\211)\364\017r\372G\022\214\310\n"
+	.ascii	"[F\022\214\004N\315N\267\210B\202f\340\016r:\f)\013iMl\345\030"
+	.ascii	"bC\323\\e\243\351\237\267\021\325X\321\313\031\374w\376\004v"
+	.ascii	"\020\027][/G\207\266\006\200\260\250\3618\307H\221\033ZP\222"
+	.ascii	"d9p\002\031!*\363\022@4m\343\2241\312\030\343\320\bE\245e\345"
+	.ascii	"\001v\271\017\23030\333\244\224\345\351\352`\210\030\201.2\367"
+	.ascii	"\347\200\217\2654'\030\026!\337\316*\023\302\263C\312\241\270"
+	.ascii	"y\254\234\217\237l\216\204I\264k@Gx\341T\22564\272\024\026\213"
+	.ascii	"\301\245\371\227H}\342\021\367\366W\362\306\300,X\377\321\f["
+	.ascii	"B\256=\2156\334\237;\347M\364 \276o\006\212&\300\312p\fF\006"
+	.ascii	"\024\371\321t\227\364Z\3559\312,\217O\256\233C\214\002L\312\211"
+	.ascii	"\374\250\b\252[\\V\317E\022\222\027\360s\245\302\240v\322\244"
+	.ascii	" \026#\332\034\347\3019l^\253\2531\0333\\\362\375\217\033^\321"
+	.ascii	"\220p\300\240\326\345\226\035\222%\250\230\016\334\362\211L^"
+	.ascii	"\240d\\\276dw\344\016i\221\2612;w\334\021\366\205\205=\034\356"
+	.ascii	"\3308\317\346\020\002\315\230;\221H\244\306\215Ey\364t<\2134"
+	.ascii	"\001\020G\265\033\035J\240\022\320\336\f\177\366\007Fm\207\345"
+	.ascii	"\357\303>\266\3734\215r\314\227\205d\177\002\025\032\264\337"
+	.ascii	"E\356\206\252\031\334T\241\221\\\374\034\n\323\332/\346QN\267"
+	.ascii	"s\254\b\t\260\203v\001\262,:x|\234\336\310\265\230h>Q\254\243"
+	.ascii	"\n*|\303*\315F\237\222AtR\211=\374\226\353\246<#\317\264`&\267"
+	.ascii	"a\025\016\311\207\371\2526\227"
+	.text
+	.section	.gnu.lto_.jmpfuncs.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`-\004\305\021"
+	.string	"\006\031P; Q\224\016\034I07\314V\001\262\032#\030\030\026P\3409j"
+	.string	"\001\307Dw%\001\002\bX'\3539|c\3501\367\214o\r\322~\022\243\356U\325\357\273{S\263\233\354\235R\n:"
+	.string	"D"
+	.string	"?"
+	.string	"\321\237\004ona\263\360]\021\236\267\227v\252xw?wY\3552\267\256}\226\032\356\200-\305\004\204%\254\247\213\2707\363\234\354K\034\327i\325\313yk\377\315~6\273\235J\231\020\032\206\177G#\307\n\024\023b\354p-\306\0074\004\332\016he\t\341H|\301\233\263(\255&\225\212\023\364~\nR\320\231\342\375\255$>\342\024z\341\3671\262\013\177\n=F\256\215wO\2216"
+	.string	"\225\256\016\256\300\323\300\003*\337)\306\030\177\335\267\035\264W\203\276\347\004y\206]\363\345Y\206\3576\361\345\325\227wc\024\024{\257\216\305i\213\365F\f\034\316\023W\273i\255f0\2036\004b(\201P\022mAP\331b>\264\036\332\016\0344\033Z\r\"\2213\267\030=1C\213\241\275.T\026z\335\002\354Wp\272\332\327\023\200}\n\225$c\357m1:\354\211@B3\302\346iAhL\230#\316\340-s\250\0015\351T\ri[\030\306P\002A\214\325\354\021\260@i\020C5\243IA5c\252\320~6G\346;\215Z\021\273F\375\327`"
+	.ascii	"\324vc\230w\025@\237&\001\336,y\213\031X\356\r\334\n\373\006"
+	.ascii	"\030\254\235\301e\252Q\215\260\375\327\013\013\325\247\356C\272"
+	.ascii	"\320\344~\017e\"\324f\216/\374\342\304&\365t\352&\225R\271\275"
+	.ascii	"8\t\330\226Y\273e\2421n_\330\362I\035<f\002\304\214\211\326*"
+	.ascii	"\213H\250#\341\207#Y\346\244\246zGT\231[>-\305\330K\nQ\n\245"
+	.ascii	"\204\255\201\2562/\365\223\3053uNm\311\210\333\266\322A+\353"
+	.ascii	"\305\217i\213Y\364j\355\274\257dgb\303Vx\254\236i\3230\274\016"
+	.ascii	"\302\314\265\260\034h\330\250\325a\222uC\331\031\207\256\037"
+	.ascii	"\231\200\271\004\276\223\364\310\032\300f\267V\334m\200\373\007"
+	.ascii	"\004\225\224\350\212\257q7\256\t"
+	.text
+	.section	.gnu.lto_.pureconst.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \203%\003"
+	.string	"2\b\030\034PW\032\003\203\252r,\314\314\314\230pw\227\004z\035%{H\251\244\2456\212\265\035\236\311V\362H\336\310E\036\362@\376\361<\336q\216o\\\343\031\307\370\305f\361\212S|\342\224L\342\021\207x\017\317a\325\2601|\341\nO8\302\352\340\006/8\301j S&\220\005l"
+	.string	"\333\242\326Z\247"
+	.text
+	.section	.gnu.lto_.ipa_modref.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\303\002\325\013"
+	.ascii	"\322\216,0pM2\034p\372\377\377's\271\372\377\377\377\353\214"
+	.ascii	"|Jv\222dB\3046\324 \177\265\353\227\351Fv#\001GQg\034\225i\215"
+	.ascii	"\020\262\245L\001K\036 \n\320\255\003bBB\216\177\343\251\221"
+	.ascii	"\361c\274\245\274\260\370W\361\024sBb\026qgU^\265\234\213\"\327"
+	.ascii	"r?B\231G\235M\0379\345\232f&%t\226\362"
+	.string	"\315B\371C\237O@\300\\5\352/\345\227ij:\257\362\313\300\025\220\240\225\267\366\007\026\260\312\255\262\200\177\235\016me\242\312\251\316W\006pP\236\241Ty\222K\345\r\345\377q\241\207\354o[\006>\225\273\262\3031G\317B\002c\250!U\346\2508i\337P\0021\016Y\335\021`\235#\222\231\005)\265\034\304\326U\001\232\305O\204\023\276\245a\261\fq\231\366s\005hkE\362\316\003A\026\320\233=\201-_-\200\265\317#\021\205\354udJ\217~\207#\243n\270\222\222\354\tQ\225R\246\207\344\007`\002i\341\363*\017H\275eE\370t\331\375E\3252[t0]m\325}B\215\215v\217N\334\225\252\212\211<\315L\211X\0013\374\327+h+n\341\342\027r\207\253T\346\n\262\\\321y\356r\202W\021n\323378\013\fv\344\320\007\304\005yJ\263Brs\257v\223\240N\243\nX\322"
+	.string	"\316r\344\221W\3319\nh\371\237"
+	.ascii	"t}"
+	.text
+	.section	.gnu.lto_.lto.329639e266db1229,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.82.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\244\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\377\241\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\344\030us\355\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001\004,?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"_\304\202Yt\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.83.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`}\001m\017"
+	.string	"\206\235hF"
+	.string	"\221(\035\240\267P\004\001\206\347\243\020\345\305\301d\241o\024\221\261\bjH\350-|\007\034a\013n\220\240\332^\271\276\2315\346\277\264\341\341\375\377\227>7\301\350\f\003\221\256\313A=\222\316\354WB\310\336r\247\024R"
+	.string	"P"
+	.string	"W"
+	.string	"\335?\266O\233l\034\017\301=\254\226\002\303cw=-ay\031\3362\232>\245F\223\377\362\020p\307\212u\372\224\001h.!\004\260:\310\006-\031\332c\217*\254T\224-+\327\307\256"
+	.string	"\244Y\261V\036\271\b\273\353\270b\201\270\267\333\376lC\260\037\023\235\277~\356\260[>Zct\214\321\367tD\330H \333\365P\303\331\232)\343\304a\267\037\372\261\026wa:\3143\335\351C'\203Y\345\330]\221O?\350>\r\310{l?\332_q\026\246\277PN`\327\2253\333\r\0318\244\373tx\220\3553 \215\212\304\200\031\3511"
+	.string	"\334\210Q\301\331\374d\2633\374\305\311\001\233\335u\340\313J\032\n\200&>}\224\355\023\001\250\003\025k\216\312\251\352U)n\032\3335\352U(R\261f\251\327\307.q\300\032)9\250XSm\311\320ZTY\354\360\024\325Esi\315\254.;\241\223LB\023D#\022\220\211\350#\241\002H$\372P )} .\031)}^\351\363D\241\217\005\257\344#y#\037\036]"
+	.string	"}\036\206\321\350\363<\341^]\376\313;\030#jP\232\232\312bn\206vTo\242\310\245\252\330\236\331\244\376\005\273\341\020{\\\356\356J/\270\324\216n\b\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.87.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\314\362\023\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\305\031us\350\314\030uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001\022+?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.88.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\366\001e\022"
+	.string	"&c}I\300\322Q:r\001\220+\257\200\364O\263\260\210\206CX\013\320b\250\316\356g\202\2128\026,\310VF\021\032XMO\373g(!\013\243'\226\241\340(\212\242\224k\353\315S"
+	.string	"a\3646\264\005[\220T\305V#{\023)S\ni"
+	.string	"b"
+	.string	"k"
+	.ascii	"'\221\217\236\331;\276\363\231\037\372p\033\222\232s\206K\302"
+	.ascii	"\002\376\355n\251\263\2032~\2533_\350'%\214p\271\232\203\337"
+	.ascii	"\236\360\201\303\312\335\276\225\0328?\336\273\336\344j*W*v\036"
+	.ascii	"=\374\373\030\030\211\020\302\312\331>V\n\245\232H.\203\356{"
+	.ascii	"W\360\243\204\313\355\\\301\007sN+.\327\341V\335v\216\355\025"
+	.ascii	"[M\002Z \212g\311\333c\217<\350_E5x\336-?u\274\372[\365\256Z"
+	.ascii	"U}\326\352(G\002\033sr\230\n2\227\342\021\212\363n\177\347\367"
+	.ascii	"`<\306\354<'\251jrTDC x\3149Q\036\355@\365h\340\273\210\355\253"
+	.ascii	"}\240\277\230=\210\246$\300\264\361ph\314\271K\361\211\352\321"
+	.ascii	"\273\017\220\217\252\030~\224lB\200k\303^\004\200\207\246S_\\"
+	.ascii	"\235Jmp\001\365m\017\004\235(\236\016\233\002q\\\273\302e\310"
+	.ascii	" \360\231s6\360\211.\310\0168\231x\364i\344cL\302\365\370\306"
+	.ascii	"%\300\264\273\332oo\303B\357\033Rw\3676+\344\352~3nCh:\345\224"
+	.ascii	"\313\375\276\367\226\026?M7\240\232N-\223\206\246\021\273:{W"
+	.ascii	"\013\256\313\"\270`^0\226\230\227\327\253%\201\345\005\246%\213"
+	.ascii	"q\265Zfb%vQ\231\211\2053\261\360\345jM\b]b\262P\205\3040\n/\261"
+	.ascii	"\320\002\f\026\013Ev\264o\217\320UEHK\264\255\201\2533\370\024"
+	.ascii	"Gv\237\024\345ro\234$\345\206:P\274'\233\002\321o\3169\345\352"
+	.ascii	"\254\237\311e\244:!\341\330x\031\t\356\215\275\340rG6\" @\002"
+	.ascii	"\204\030\026\017a`\357\035\232\033'\313\312\342\276Q\0205\312"
+	.ascii	"\244\301\206\360\013\350kLz\f-\370\252\235\265\335\377Va\343"
+	.ascii	"\231ZRh\016\250%\344Vw,l\320\315n\fPen;\233\260f?\035\3552XD"
+	.ascii	"v@\364\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.89.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`r\001]\017"
+	.string	"\306\034hG\360\260(\0358\331au\271A\323\036h\355\241\305\203\177\361$\366u\375\356\211\250n\365\345\265\346\307cg\036\213u\210\274\213\b\263\307\026<\372H\034L&I\362\244}\t\b/\342\306\301\326\217\346\033F\032\331[\356\224\002Q"
+	.string	"P"
+	.string	"U"
+	.ascii	"\334\247Q6\216\203'\3662\027\017\262\235\335\365\324\204\345"
+	.ascii	"%x\313\210\372\224\032Q\376\314E\\j\253V\352S\002\260\305\220"
+	.ascii	"\b\320\352 \031\270ll\217=\262Z\252(_X\256\217\035\204\"\307"
+	.ascii	"\252\305\362\350\201\260\273\216\253\226\210\233\273\355\317"
+	.ascii	"\366\003\3732\001\207\375"
+	.string	"\362\341\035\017\273\377\361\0219\241\013\220\215]\020\267\036{3g\254xx\373\240\037\203\361\030\250\207\246u\251\020\035\215L\205\216\335\r}\332A\367\211@\036\304\366\243}\231\277@\035\206b`\300\252\204\254\331.\270\300\"\335\247\301\027\340>\273\207\004\221\307\345\356\256\264\202G\375((g\245\304\301_;\r\205+,T\361f\001\263\f\257\371\300\324v\354\301\371\tgk8\315I\267\273\r|\031\0346\034\300I\361\351\243p\237\217=\001L\255\205NJ\274\251\272ll/\252-6\230\212\372\262\305\270f\326\227\375\351\002\244\233\220$\224L$#\223\222(\002\205Q\251$\232@r\372\b\270d\344\364y\247\317+\221D\025\274\222\357\2027\022b\223\205\321\347a0\231>\017\004\334\353k\346]\315\216\233\024UMm\261\207\206~\364D\253\021C\217\312z\354\037\235\332\007\355\3242J\275\262L\343\242\036\026\336P\t\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.90.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\r\b"
+	.string	"\202O88@o\323\001\230.\372\2226\002\203\236K\354\220\210\221#\r\202]\005KS\213\261o\230[\020\003l\364\365DU\r2W\237\356\310\213+\211\354\017\003\343\225\321\223\266wJ\001\021\332\266a\020\231\245uX\367\240}<\335F\341\340M"
+	.string	"g\035oJo\312\315\203}d6'dgcNB\233\262\343\270)\257\272\2476~>\331\206\005\234\213\030\262+\b\306\016\373\324\306\317\206\327\306\312\201\313nF\f\314\252T) \266\251}\331\216\320VX\2407\251x\300\206X8\022\016\355\217\234\204\276Z\\`\367kA\331\255\b&\320\274r\325\330\366E^\242\366\211\252\037$\313T\3020\275\354\256\344| \363\212\372&\363*z\234\036R\377'\247BH'\321\bth5\354\256\241h\244q\307\3336\260\315`\273$\013"
+	.ascii	"2\241\213/0\\\250\256\211_\026\342\307\004\001F\bT8\270\373\244"
+	.ascii	"Z1\t\223\f"
+	.text
+	.section	.gnu.lto_nullFrameStatus.91.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \366\335\006"
+	.string	"\222\31516@o\222\016\230.P\370/\004\310\"\0032\r\200|n\325?\037Z\224\310\354\346\300\334\r%:\236\333Ms\255Eg\320\362\210\267\210\363\215\313\304\311\306n\266\021\231\002\230\326\321\0360\320G\013I8\210\240\300\036\216\b>\021|\241O\007\364<0\342q6g\020\030|Z\226\301w\305\354f\025PP\025\037I\216\332\370f23\2474\336] ,\b.\231\246\030\230\\\251T>\376\376\243\277~\347\276\"\035\031\225d\242\003\231\032-)\2311a\003M\253c\t\254V\232n\254V\377\013\f\243\267\306\016S\200\005\312\205\311Kf|\024G\267\272\355\266\244\231\020\217\223\322\211T\007\320\220\231\273\322\t\243S\375\017~\205?#\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.92.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \370\355\006"
+	.string	"\362\215260\217\222\016$\235y\264\301\227\023<\361@nc\345Im-\244\303y=\021\321~\245\227F\027<\210\305g\214f&:\200C\220\226\3533\326\214\327\037\325<!2\005\037\254\2039|B L$\321@\202\002{8$\370H\360\211@\235\320\363\300\210\307\321<\202\370\300\207\215F\360\035\263.u\263\253\200\302U|45\267\361\005\310\314\334\245\276=\344\252e\243\312<\275\270d\212u\342\361\367/}\300\337\332\027\244!\245\212Lt 3\265b\222\0317\033dj\035Kp\325\312Ts\325\372WX(\2355v\2340\026(\027$\253\314\370\034G\263\266\354v\244\007\037,*\252\022\224\251\r\303\220\2317\fTFw\375\021\376\204_#\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.94.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\352\017\325I"
+	.string	"\272{P\033>0\344J\007\204\237e\303\262\241\315 &`\" \020"
+	.string	"\353\334d\204U\231\350`2\216\270\207\352\217S~\300\333:\206O\256>\357=\341\363\262RD\224\221X\203\344\036\335\221l\262\367\226)\245\246\001\204\001\252\001G2\3424>\213<\024\027\256m\342\374\317}\215;\237\273\031\367)\240\007\266\273\346\n\234`\034\307\007\332\004\013`\377\353\341\f\233\306g.\024;\205\321\3078\236f\265{\355}i\\\r\354|?\332X\260-\302\027\310\030\307S\001\255\257J\017\304\367\032\301\031>d\272\375L\267\253\327\256\257J\361\363\315\357K{\264=\257\335v\251\343\301>\355A\347s\032\247=\360\023\214j\371\332"
+	.ascii	"Z_\235\336d}U\235\211\365\265\205x\264\265\340\350\330\242q\034"
+	.ascii	"\273\253\013w\373\361\251\226\330\371\214\224\355=\306q\334\225"
+	.ascii	"\2630\231L\251^\272:\365N\312\260;\255\252\250\246\244\242\240"
+	.ascii	"\236\234\232\232L\246\345\222R\022\322\221\221[\244l\223\354"
+	.ascii	"\252\346\207\333\177\211\037=\304\276\2640w\252q+5x_\225\214"
+	.ascii	"\240\316\305y\214BZQ\223:\225j4\207v\247* {\214\322W\206h\322"
+	.ascii	"\237R3\331c\0247D\213\252\017\n\225\351q=\270\227rS\263\363\250"
+	.ascii	"2\016\365T\347Nd\372\342\276\251\214\227o\2269\323\345\231\311"
+	.ascii	"\bzn\300O\316\212\232\2353-\271\370\322\026\325i\367\366Jj\366"
+	.ascii	"\"\310\210\033\242iQ\037\2601\322\350y~5\207\306\366InjS\034"
+	.ascii	")\031!\317\263\374\004\243\220V\324\246\370\321\225\221k\210"
+	.ascii	"\026Eu\316\241\255}\221\022\312\034\332\223o\223n\210\346\244"
+	.ascii	"\354\331\025\352\246\221\275\352V\324\244xV\233g^\314\220\322"
+	.ascii	"\236j\026#\233An\347_$m\354?\031!\216\343~\26345\357+\357\376"
+	.ascii	"\024\335\255\242\033i@\024\0169Z\037\242\031\223d\356\256\340"
+	.ascii	"\205,4!\325E\263@lNf/K\324\030"
+	.string	"\234\220\2066\216\237\f\332\035}\020\207\016^^\254\257l>R2\b)\025\373\310\243\016\004\350\215\321\352g1p\211G\350\256Jq\034\257\231\251v' \322K\221\232\210\270\246\375\220\254)\3258V3S\255\256\031\217\250i\263a\036@?\0044\224\314m\316L\2650\357\206\216\036\373u\350\374\255ru\356\254\271\255\215\177~\3753SM\256\360\231\303Z22U\324\334\346\"\330n\020\016G\204Sb\034\307\f\332\337\370 \211v8_\333\004\212\265\035\005\353\253\222.\315c\243\330G*m!\202\227s[\357`=\267\320S|~\241^\372\236\306\276\202\355f\341\342\335\314\363WZ!$\3433\207uO\307>\267u\373S\\^ag,\335'F\204p>o\020\356\267\227\377y{\3605\336\035\224\337\030\224\337\027\224\337\\\316\347}\300\315xo\371\324[\213\375\316r\277\r\270\337\005\330o,\3457\001\345\367"
+	.string	"\345\267"
+	.string	"\367;"
+	.ascii	"\373\r\200\375\276:\372v*\277\255\334\357*\367\233\212\375\236"
+	.ascii	"j\277\245\332\357(\367\033\312\375~j\277\235\332\357&\367\273"
+	.ascii	"\351~3\331o&\366{i\364\275\344~+\265\337I\3567R\373}\264~\033"
+	.ascii	"\025}\273E\337E\312oe\373\335&\277\223\3547\273~\257\353\267"
+	.ascii	"\272~\347\365\373\327oG\301\325\310\026\345-\315\334\224\263"
+	.ascii	"cY\".g"
+	.string	"\346f\206B\264\314\314\314:\001\f,K\344\244\201]f\357\363\327\342v\b\331x\246\246)\2671\345e\316R\275:\317/$\350\307\210y!\327\2650tL\371\001\3738\376\\\277\204^\356\205\314\321\365K\3342\373\2357\027\2248%\255\231\333\372E\304.e0\275>\335\257\241\207{\021mp\243c\213:\232n\330\355\271\274\221\312\270\263\302\304\250\257\375o\277\005\016\033\203\311\312X_\227\262\237q\003g\370 \nJ\2550s[\377\362B^\025\2270d\256\\\244\233+w7\327g\351\300#7'b\037\2512)\345\013IY\211\310c\271\222\224\235p\211\2241\344w\2042\036e\244*T\216\262\357\365\221\0325)d\\2\312^\306\031\033e\267s\217\322&R)\267uR\021\351D\316\212GZ\256\225\213\364 \253\225]\352\201[\340\364\222\266\\+\237\310A\374\b\3355\270H\325\223\207\002\0379\203\323\322"
+	.string	"\037\316\341$lQv\363\272\007\3126\366\221\275\340\273\341&\360\223w\263\242<\240\rd\341X\016ke\326\362K:0\251A\177\222W\002\257\301R\340)SX_\335,P\233\225\371\355@\031\305>\262\312\247\301W\036\255\315\236\347X\215v \245YL!\305C\244\036l\277\221?\322\243\035\256\34168\013\234\245\216\023\207\271\260\335\360\333\023\201\2714\177\210\036\302\307\306.p\034V\242\334\223\301`\236P\372\b\205\201\307`\301u\037\006\333}\354\244\357\217\031\023\370\016\306\033\240%\216\305\334\254[\202#\n-\203\313\007XW\f\0342\270r|\275\270Qc\205\013\260.\0270\240X\254\370\026+\376k\007\r\026<\326\031\336.\270|\200u\371"
+	.string	"\353\2621\203E\215.\027`9\272\270\230\372\006\216/\260.\0357n\200u\271S1\317X\232\204]\241X\036\353\254\234\330\203\017\316\342\225\263\226{\312\022u\310\006\262Wvh\243\207l ;p\364{>=\376\320\036\017\371\371\364\221\212\341y\201\334!G\355\201\262a\345\002\200\177h\210\225=\320\325\272=?u\322\022O {\364\013\337\301\366\357<\236\227\315\353\346\035\034d\t_9\037\276\003\375\217\017\030*\020\"#\013u\277v^<\357f\004\262S@\356@\247\322\335>\343X,\300\200\354\3209\001\262\200|"
+	.ascii	"\312\b \007\310\236\347\343\020\002\310\b\332\026\353\234\357"
+	.ascii	"!\333\357\346\337\274\207\357\236\027\361Ed}]\367\020\3114Z\221"
+	.ascii	"\361\253\334\242\317\263\321\320\n^e-/tlw"
+	.string	"U\031\336\243\277\006\005\0048:6@\277{?/\267b\203f\fJ\264\257\337\305\367\317\273Y\177\311\tB2\222\345\260&$\367\207\352\213u\346&\020\217FD\273\347\304\242s\234\212\032\221\263\"\223\226o1\267\3248\216c\251\255<\"\273\236\253\207\376\360\374\225\250\334\326\276&\346\tD\366\27356\247\020\371\200\325\2047\323\201\315\274\003\331*?\rB\031U\252\\\225\223\213S\231\352\005\364R\r(\334\036\357\242S\331\245\373S\007U\306\2452\210\257\363\250,\005\225\243\266\374)Ce\250E\246\374\204\347)\371\364\037\254S\016\221\037\021\224\r\312\177\260M\331);t.\201>\250a@\304\024D3##\"I\n\2224\006\241\005\304\020'\231\231\007\021\020\245sP\031I\224\016_\210\177\001\375B\274KS5G\225\002\024.\t\206\273\224\220\220\254\036\277$\325v\331s4\266\366\306r\350\240\225Ax\241\354"
+	.string	"\233\344\246\320o\253@;CW\345\361\0068g\234:\263z\355H\342E\006+\327\340*&\351`\236\222\2453\005\370t@\307\215,%\330I\372V#\020Q\250\233}\020\350\321\326A\321\340L-\025\227a\327H` |\354|\017\315au8\272L\251,\331\001\277!\3423Y\205\3759-\355\314\276\301FC\f\304f`\370\3701\327Cl1P\262~\273Xa\027\342\307\301\206\326\034\004\3235\324\355\"kf\257)\002"
+	.ascii	"\r\377j4\303\031\002\rzL\345\017c\350\344\344\347ud4\3347r\241"
+	.ascii	"\331M\223Z"
+	.string	"\211\264\226\240\0032\325\f\227\351vH\036x#\273f\354E\036\352\252@\311bp\261\307!\325Zsy\325\247l\262X$P\032\261\202\227\236\253\225\347\373\350\006B\033\035\001\271Qn\020\232DWhD\221\240m?\367\341L"
+	.string	">)\026qL0\267(\376?\317\351\265\002yxh\313\223sGVs$\005\007\315\273\315\364\220\202Z\2626\331\202\332\321b \255\342\374\340|\365\007\275e\357>\366[\305bw\3076\262]q\250\305"
+	.string	"\034\004\307\006\3526\320\351Fp2\342dnh\352"
+	.string	"e\017l\350\265\303\241\037\217L\366V \316\034\354+\263\344\303\225C\207\344\036>j\234\255\246*\277;\307?\207\203\357\316\361\277I\301\b9T\300.I\265\226\022<\025\b\373\312\\\022\221,N<T\213"
+	.string	"\001#:\033\244\204G~\330\307\034nr\347]\031j\236QR\240\223\032\340\201i\314\337\354\206\216\n\f\217\240\212\032\035c\333\374A\350\020F\037B\326j\0036#>H.M%|\021\374PZgTtE\003/\n\020\306"
+	.string	"sK/&e\204\373W\037\340+d5i&\\\363\007\235Gk\234\030\224\t\021G\377\264u\236\256K)\256#\363\f<\243\024\"\030\206\271yC\227\n\225\326\207\2313P)\342\366\301\007\204^h6\222\230"
+	.string	"\027k\345\025\331\026\036"
+	.ascii	"}1b\200j"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.95.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \3365\006"
+	.string	"\202\013+3@o\222\016\230\016\303\377\300{\222\004\030`_\304\231+\247lm\336$\342o7{@h\204\004\"v\3352\f\b\037f(\270\321c\370\2661\333\332\3362\005k2\233\3066\215=4,80M\213`\031\201)\b\206\306$(\2521\314\225E\321!\301\007)\276!\025\251n\307\023\234\253\325\351r.\235\016\0030>7\372\313s\230\361\225\022E\377}8p\262\242@\222\t\032\265\244\312d\342\361w\036\363\001B\347\252\327\006\250\034)\025#,\231\027C\215V\275\352\026\244\322\007J\211\025\362\364"
+	.string	"\0222\363\263B\027\035\373\033\374\005\277E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.96.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016\244DX\250\364m\223f\026`"
+	.string	"\200X\306\233\253\354-\331U\373w;\273#"
+	.string	"\025j<\275\252\252\272\212\3033<\001q\360\324a[\333[\246g0\232\3064\215=4,8\260L\213`\030\201)\b\206\306$(\252\261\313\225\305\320!\201\007)\276!\025\251n\307\023\233\253\325\351n,\235\016\0030<7\372\253s\230\361\225\022C\377}8 2Q@\311\374\214V\262d\"\361\3709\177\371"
+	.string	"\201s\325k\343S\216\223\212\021\225\314\213\241F\253^u\013R\351C\224b\201:=\200\204\314\374,\320E\307\376\006\177\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxSignal.97.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \323\315\005"
+	.string	"\202\312'0`e\323\001"
+	.string	"\326a\201|\b9\3710\270\037\"\020\236\300\214h\205\211A\210\360\336G45\337\232\302@\006\001\225\200=\035D\226\n\341Q\223[\246\3272\216N\216\316\310\243\001\231\032\235\314\314\360M\342\240\223\262mtbc/\213\213O\305\360\367K~e\252[\031\374\226\213\\\360R\325\251\031\366\376\321\223\f\372\367j\026\177>xX\214T\367f@\240\253"
+	.string	"5\372\277\330\273\277\265\243\250\367\024\240)\001t\367\344\320v+\273\357\222\266"
+	.string	"\206\336J\202\242\273/\301\220\263\347\375\237\370\217\370\377\005\b"
+	.ascii	"3\003\246:c\\\270\3175\234,\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_resumeRxSignal.98.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \314\235\005"
+	.string	"\"\212&1`\211\323\030\250\0250\241Z`4\214\234\017'\204\247uF=\343X\030\024\t\035\264\023\262\nV\352\2766\003"
+	.string	"\001t`\317(\212\213\364\341\337\312-SK\021\025!\025\241\006S\311@)r`\364x\332X\"\354LS\204\020\267\251\332\224\255\013\320k}\357\001x\211\375\036\024\272K\255\347\254\247\006\237\213U\355\025\262"
+	.string	"q\221\330%\250\240\330\216\341\220\360't\365\021\311!l6\f\b0L\354.\324\203\254\362Ugn\351\3002+_c\262\273?,+\3105\177\311\037\371?\001\b"
+	.ascii	"2\003njF\270\340\\\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setLinkQuality.99.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\355\002\245\025"
+	.string	"V'\212I\300\322Q:\212\360\344\341:\002\004S\n\200#\224\r\365\354\231\n\374\n\223\203Yr024\302\362\323\214\270\240\326%S2U!\016\225J}\215d\201GQ(\016.\270\220\277\244\020\233\004\243\372\241\361\3146B\310&R\246\024v"
+	.string	"f"
+	.string	"x"
+	.ascii	")?\t/\301\233\204\227V\265\r\034\260\275\310\006\345?^\021\323"
+	.ascii	"\234\274\025\013\030/m\263\241\316\0231E\022/xVL\3159]\033\342"
+	.ascii	"\266\213\241\004Wm\376\217\276\302\345n.rx\b\252\360\220!\345"
+	.ascii	"#\204\273\251\334pp$\247\003\246\3149[\271\035]P\005\250I\303"
+	.ascii	"H\216\007<\271\361A\307\217\256=\271\034Uq\301\234\323\212\313"
+	.ascii	"e\270\307\333\276`[\201\275\003\002\226\271\350q\227\276Kx\371"
+	.ascii	"\225H\277\037?8Ze\363ntu\366\301\271A\366\213\376\222\363~\222"
+	.ascii	"\225ZD\325-U\263T\275\032\325\343\250\026Gu8\252\345\250\006"
+	.ascii	"U\275\252VQ}\224\333H\232\352\361\262cN\237*\252\351\223JC\241"
+	.ascii	"J\005u\355\267l\257\3327z\n\333y5\257\346\3640\2254\347\\\361"
+	.ascii	"\312x\031V\320\237\205\327\3250Z\261\352\263Pd{B\f\035^\013w"
+	.ascii	"\003\020\241\3509\351(\020\213\273\364\317\302pE%\232p%\b\251"
+	.ascii	"\335\217\334$\221\005W\302x\214\231\005\030lW\240\\\235\232\306"
+	.ascii	"\216O\t\3606a\311\026 \032\352\345\330uq\\\024\311\352\356\376"
+	.ascii	"\006\224s\026oQ\223\211\305\302K]\361\346cw!\034\220oWg\371\226"
+	.ascii	"\360+\241\367\244\243@\354\367\256\242\305\037\0212\017b3\231"
+	.ascii	"\203\327\314K\214\301\fL\214F\243\201\001\210\315^\264\006\023"
+	.ascii	"d/\257\n,\303Xjh\256\032\232\013F\366\232\271`4\031\027\213\211"
+	.ascii	"c(\304h\256\231\230\030\232\253\305\233\337 C\b\342\303\331\034"
+	.ascii	"\261\205\243\026\345\273\227B\326\266|\254\025\221\204\354~\234"
+	.ascii	"\244\024\325\324\217\351Mr\006\225\211_\211\312\023\bWkGx\351"
+	.ascii	"qN\331\331\033\217\273\332\363\f\021W\356\270\t\240\252n'\020"
+	.ascii	"\354rO\341\352\002= \240\002\021\251;\017\323\003\336\016i\267"
+	.ascii	"P8\262\207\177c#\004\224\f\240\215#\n\004\b\256\235\270\001\022"
+	.ascii	"\264\256\361\254;5\2662\266\3711h\031\334f\024[?1\274\247\331"
+	.ascii	"YQ\314\300\016\316\362\2411c\334\020\rm\031\235\331\270\266Y"
+	.ascii	"\222E\233%\343\302\032V\344\024a\035u+@\201T\002\025\030\235"
+	.ascii	"\026m\017y\213\212\325,|\207\206\241|x\026\332\303Z\216\3021"
+	.ascii	"\24411|\357t;%\345\267!<\356\252\321\273\f\024"
+	.text
+	.section	.gnu.lto_setLinkQualityDirect.100.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\342\f/3Po\322\001 [n%h\360\027>\221"
+	.string	"\270\342\246UO\341\0351\352v\240Hf?\204\264\214\322X\243\304L\271\305\374\252j>+o\271\017\306\216[\246\024\234O51Hx\250j\372@4t\250\n\323\215\346\202\357\202\257CM\016o\003#\236&S\353\201\003\237\307\262\340\273dw\023\325\200\242U\264\031(\333Fk\200\377o\023\265Y\220\241r\221\374\027\243\226\2478\024\217\266\276\264\315l\375a\220\350\220\211\272_\243\344\344\317\022z `\2071\201d\227\316Hv\215\355\212\263\216\333dd1\302\362\3775\016Gg\254-\342\201\020\006r\006,\374o\2060\f\267\271-B[\205\266X\007"
+	.ascii	"2\003\3169\003\027\016]\306#VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.101.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`C\001U\r"
+	.string	"\206YXA \217\223\016\323\005#v\220\303A\027y)|\210\205\002\bYwmE=\004x\377)^\315Z\202\2665U4\314\"\240:\323*0h\022\304\026\210\220\351D\016r6\2001\244XF\204\354\275\245L)E"
+	.string	"D"
+	.string	"B"
+	.string	"\207\266\235@\201\307\332\273\017&?\331@\242\362b\267\253\324\303\265G\37045?jhY!\342\266\307\021Ha\370\263p\341B\251\0028\320\313\354\356I<K\270P\346\304`w\235\"\356\302=\3356f\273\201\375\221\273k\035\331NO/\375\234\326\364\251\002(TP(\261kR\202\261)\340\211\023\333\036\373b[\273\t.Xvw\303\b\250Cg\332G\271\b\317GTp\306n\007\024\226\335n\303\006\250\303\314\t\304\303wL\f& \250~\345\035*\311\277v\273\333\323Q\312S\035\370*_\321|\020\2760\350c\3610U\203E\206O\2262wwSk\361\n DJ\213P\266xJ\233\023\222\027]\027p"
+	.string	"\351fw[*\311\376\333\034\017\353\332t|t\"X\017\006p<\254k\323\321\001\261\262,D\023\300\032\016\221\254\022\311*\220\315\307Ui2N\305\2011&\301\312\252\016\206e\325\245\333\277\325\221\023\036x>\215?-\261=i\346\243 ?\235\364$1>Y\242\242\2224\035"
+	.ascii	"\217\311\022x{\263^Kb\2468@\004\330\301eEL*\341\030\230\240\207"
+	.ascii	"U@\214\026\302%\\\331\002VS\355\"\f\366\3412N~Mk,\007\205\030"
+	.ascii	"\320;Yh\022\270\002\316\255jP\315\274-MoB)\003"
+	.text
+	.section	.gnu.lto_rxFrameCheck.102.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\315\001\005\021"
+	.string	"\306\037pF\340\322&\035*AMk1+\365\005\321\366\357\256\344\234\300\335\200i\235\255\323W*\201C!\334\313E\036\375\254\331z\035\360\276^\031\252^\206X1\306\201\016"
+	.string	"\345\230\\\037P\216\345\367\354\333\321\226\f\262\211\224)\005["
+	.string	"U"
+	.string	"_"
+	.string	"\017\302`\323.\bX\321.h\342\002\333c\311I\264\307\354#\332\243Y\366\215\203<{\034>8C:v\227\323\021g]\213\231&\313?\271h\256m\035\0363\334d\226s\315\016\274`\344\210\270l2\022\244\0206~\342\251\301\365e\202\244\354\256\263\345\342p\203\334vg\273\201\235\004\002\251;\3665\f\303\320*\302~\320\217\322\322\247\307n\323\301\177\213i\315\322\251\351\213|(\351\345\301\347Gg\200\273!\354\261G\361\205\317c\267\217\302\027\212\331\250\304\006\\\327I\211G\022\020\202G/\330\036\037b;\301\013:\212v\327\304\t\266G?\355\003\035\306\n-:\005<\273\213\342\023\235\305\004\277\347\321,--\332c\336F-\245\223\246\316\020\316\217"
+	.string	"E&=)\212\217\233\245O\306m\244mj\322\013=I\020\335\230\3702\374K\264^G\252;6p\225v\265\020\243a\223;\354\247\270\n\225\337\343\325K\276\365\242=^\177`K/\230NM\2066\370\005+\022R%\206B\307`"
+	.string	"\314\203N\305\342 \306\245\363<\231\024\312\251\223\031\217\233\3618\027\026\025\025\227\362`\270\223\021\257*t\036\027\263Zy\\\bX\363\224\032\375\262\335]m$7E\251\r!B\276\345\2504N\0279\220>D\031Mu%VC@\332*\251|K\025@\214\360\350S\232Lw\324\366W<' `\0022e\311\003\346\241\037\316\"\266M=\242\243"
+	.ascii	"\371 \274\202\240C\013(\313Bl2\206`\354\272\202f\263\177\306"
+	.ascii	"\033\326fsn\235a-\256\356\351\275\f\301\362\230u?n\201$\353\r"
+	.ascii	"#\036\263uiA\363\377\230u\252\b]a\002~\020D{]\350\242\203\312"
+	.ascii	"\227fL) \024"
+	.text
+	.section	.gnu.lto_getRxfailValue.103.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\235\003\035\030"
+	.string	"\246\253\227G\300\026U:\350\360\203\275\300\247\212\212\207\376"
+	.string	"\203sG/\250\024\266\2764\t\370\235e=\271"
+	.string	"\013\263\005\022~/\271\362\317e\214\260w\305\314\3540EW!w\233H\253\343_E:\232vH\244\343o\t\331\204\310\235R\177"
+	.string	"~"
+	.string	"\207"
+	.ascii	"#\020\207C\334\347\033\341\216z\324ZM\267wl\223\355\2356\202"
+	.ascii	"\004;\357\271\274\265\352\2420\251\325g\300\004\312\217\266\375"
+	.ascii	"\037\377\331\361\353\206D,V\300\247\210\006TT\253\0175\363\032"
+	.ascii	"\372q\236\206~\\\031\177\275$\351(\356"
+	.string	"|\371\260\227;x;\262\007\257\005}\f\367\361@N*\342\325\274\274@\201\273H\202gi2Z\263\033\252Q\272\315v\2229\265V\317\332\r\305M\272\355\234m\006\366\376\b\263Vk\365U\034S\017\317\024\332V\035hEr\021\324E\367S+\217\202\007\261G\234\b\006\022\016\333\216)?\265\326\005B>D\203o\343\2437t\230\257}\364Y\373\0248\241\217\236i\277\007\362\013ClPh\302\330\034\332>\331\334\030\366w8\034~\361\302\260=-\343\351\030O\237\336\373M\236.\321i\022\235.\307i\222\234\246tz\307\351\271\323\237\001\260\305\304\355\266_\255\266\241Q%\n\020\350G\272\025r?0\300\"\177\226\240\023,h\200iG\2200_\333\335\205\371N~!-+\210\306\t\227B\241\364\241<\212\205\013\251\371Z\212~\214\021\215r@\377\3359\260y\264\300K\026!\361\211?\264w\225`\362&\007:\210"
+	.string	"7,r\271\350G\235i\305)\364\205\256\nC\004\233G\337\r\355\236l\022_\311\344\321\310Q{\214\370G\034,?\200~\374{\252\317Q\216Z+\316\203l\007m\226\340j\205]\027\f\316\300a\245\243\223\312\240\"\255: \242\205\022\321B\351hHu@\251Z\037P\007h\314\362\260j\241@\260X-\224\311\027\273X\027\206\005\314xB*\243\242\b\217\033\344i-\216\373\0263\237\033b\314\226\266\204\355\322:'\2662\261\326Z\3131\370\027%\355i?\323\331\374E\313%\355g:dshr\313\235\\h\302\006\307\262:\335\224\314\270BD\356\201\271!\037=$\277\321\342\204\244+\263\237Y\261\025\377J\237\312\2538x"
+	.string	"!E\250Q0\302\030U\210&(\021\005\005\256d\f\200\002\021\"\263\033\0210=\204\212F\013,\035x=YC\243\007\235\266S\305\214p\001c)\322\032\223S\301'\031\201\331\356([*\234\t\266=\345;\336c\305\030j\260\177d3\246\t4m\277\030\347|\3008\201\346\204\003\343\311a\r:S\302\320A"
+	.string	"\267\376a\212)\024."
+	.ascii	"\316B\001\017\363\241W\227\273\2176(\353\352\313\215\375\321"
+	.ascii	"\226\034\036 \3403\233\250\206\221\341\234\214TS\033\025\b\373"
+	.ascii	"\311\250\355F\201#*/I\"\017\274\2753Q\350\032L\005"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.104.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`X\001\035\016"
+	.string	"\006\333^D\020\221\223\016;\364\302J\n\003\341`\207\334\224\177nc\022r\264 $\315\177\250\323D@\256\352\203}\262f\251g\351Lz\030\274\215zTUU\336@\241\020\316\364k\317\3074\331tp\347\304&mo)S\nL"
+	.string	"G"
+	.string	"L"
+	.ascii	"\266/\342#6{\325 %\005f\001\b\027\025\0225v7\003\371\200\315"
+	.ascii	"#\374\307\346Q;|;\324\334|\322\341e\322\320Bu,Wh \265\241\306"
+	.ascii	"\243"
+	.string	"3A\020\0273*W=W:.\363\022\331]'\252\263p\307\333f`\333c\237E1?\307\275\377z:>\r5\255O\247\246\337\3211\203B\367\f\255\335\n-\033;\023U|\260\275\331\230\355L\373\337a\266\307\240\024\b\260\234*\204\314\356\027\342\004\037\307\317{^\231c\267E\f\231\335\r\361\001\316\243\003p/(\311\252\020\302Q\250\"\240\361\256\251\247q\222\341\321MH\340\354r\n\374\022$\0238\273{\017(\233\307\353W`xQ\343\225\262u\026\207\326\t\325\026\257:\227^\365\016)\005\f\025\r\227,\373#\245\266\330\207\253)\373\336\215= \007%\037-\202HLB\237\321\306#\236\023-;\321\262\222\007\237P6\242\2152\317\207E& -\213 \022i\031\366\355\341j\312\036\247\227\033\212\235\345\364\342\222QWlG\265HIM\020@\022\360\352,\013\340vK\235T\250\227\332!Q\036\205i\033"
+	.string	"v\013}\2648l\013\205\326\362om\031\315\264\rHqS\b\017\260\317\\\007\214\001U\352\227\340\233\036\0234V\225j\021\227\026\016\301\272&2\336bch\2028\025\002w\217\320\246"
+	.ascii	"\312\231\251\324\345i\325\036"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.105.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\377\004\215 "
+	.string	"f\372\314J\240VN:\203XR@l\037\323\247\3741\324\021\365W\333\327\305\036>S_\230S.\275\244\205\210}\337\177\243\331\272\223R\354\212\005e\017]\201\254\300?<;N\f\217O\2055\256\b\203\251m\2358\230Z#\204\020\"e\222\001\267"
+	.string	"\256"
+	.string	"\277"
+	.string	"@\366V\257z\220\364\303\355zm\252W\261%\250uVkEpr\013\234'sNS\236\034?S\236\334M\261\213\236dt\323]3\233\243Z\304 \230\225T\334Rk\3155\216=\005|\034~_8=\314\013\212\273\235fI\216\315\351^\370\261\306\f\257\236\257\3500\243y\264\244\343cL1\306\035\2653\256[\361\370\345F\023\324Q\030\307\301\320\351\301\364\202o:\247\371\200F\323\357\346x\340,I\332\307\230\236F\232%\035\275$.\235N\342|N\037\001\370\216\306\234\253\263\222\317\210\373V\317\020\324\312B\243\t\352l>\250\265.\367|M_"
+	.ascii	"\337]\264\335\345\260;\336\bl;nc\262\201+t#C/\226\325j\264\263"
+	.ascii	"\353s\255\037\007Q\265\0325\310z\221\020\373\034'WD\020\277w"
+	.ascii	"r\037T\236\224\351\033\327\216\333\036\305\212\020\"c\003\315"
+	.ascii	"oWy\366\257n \313\021!\361\211\021\253\365\020\257#_7pw\310\343"
+	.ascii	"\235(\265\263m\033\273867\336\032\232\231\223W\346\344\2159y"
+	.ascii	"Q\334\211\337\333\207\337s\3445M\336r\344%K\336\221\344\355\221"
+	.ascii	"\227\233\367\004^\330\264|\207\n\253u\251m\255\212\221\\;N\374"
+	.ascii	"\207\347\335/\212\027\367\306\354iOu\254\024/\256\207_\032*d"
+	.ascii	"\177E\334-\026[\013~\0358\037P>6\201B\205\n\345\311\232>\326"
+	.ascii	"-\254\315\020\223\362\312r\3025p\007 Q\2618g\272\006Ix\304\244"
+	.ascii	"\351\233\202\237\335V[\301\333\r\223\375\342\303x\030\224\201"
+	.ascii	"\215=\3239Gd3Z\022\333\356\205;\301p\326Z\0334\031\373O?-SU,"
+	.ascii	"\205\203E\227\263\233\2469\374\314xdXg5\314}\"\377\n\352.+xP"
+	.ascii	"\001\302\244\370%<g\255\273\367\366J\336\245a\003\017\277\307"
+	.ascii	"Sv\370\300\357u\347 u\321\242\315\215\022c\220%\2619\355Hka6"
+	.ascii	"p\231\214\351\001XSf\243L\243\255\364\236\362\255#V1b\265\335"
+	.string	"\005q$=\347\326\373\006\313W\325\216\333\306\262\201\035\323\334%)\013\004\024\202\350g\004\021\211\236\022\345\210\037!\241\036 \037s}\026\234\320\345N\350rB\"zH\344|t%r\013fv\210\350G\227314\244\313\241\303\335\333\306^\370\253 C\023\3335\017\246\201\033 \013\305\351\256\302\b~\266\322\232\035\001\254l\263\177+\277\222J\355sl\032L}\370(O\226\244\323o\312\307Zk}i\340\202\341lz\307\333\255q\t~6N\337\352 xPdH2x\334\266\270^*\273\025`O\366\262\364G:\225\n\371\275TX\236$\372\255M=\241:\\\323\267\336M\203@\340\367l\356\002\211\n\t\227\263c]J\204\016\213\352\t=\212\204\361*\252\326\272\023c\250A(\305\224C\b\221!\021\021!Q\222\016`\002!dV\035\021\260\275CtI\322r\332\361\216\270\231\037\335\277\2611\321\246J\203\225"
+	.string	"\311\370\025Z\203\376\340,\227g\305\0021 \206\260\216Cy\027\036\311<\347\016\324\256\002\n\357)\231oQ\267\305\215\023i\256\320\337\037+M\225e\234\314W{\204\323l5\177\3640\341"
+	.ascii	"\026\273\214dO&]l\207\210,\201\035\022\303V#oR\315\337\221\330"
+	.ascii	"5\342\273\3239\371<h\3469\017\260\315m>/;\325\244yB\271\037l"
+	.ascii	"'\250X\266\201H\231\031H@}\271 \2127\023A\213\016\3333\2744\016"
+	.ascii	"\273\273\246\353\b_WcA\021F\021\232\377b\376M\366\f\031\b\333"
+	.ascii	"\023\023\270\344\fv \356I\013T\217\355!\032NcJ\036\025"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.106.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\324\r]I"
+	.string	"*{\230\033A0\240R\007\347\247\021\366\342&\255\337#\375y%\213-\313\315\243\352h\020\025=+\336\023\305\275\334xW\325?\304\002\016\243"
+	.string	"\200\bH\374\240\330\002\351\332V\372\277\270\"^\036\264F\366\336[\312\224\002\244\001\207\001\267\001\017\273\277\377\231\337\023{3\376\212T\273C1\367\247{=\367\244\333x3\376\356\371mQ\273\222\361/\363yx\256e\213\005\255\333y\306]\016\244\240\365\020\313\342\307\370\333\325y_\234\265\016\316'l\270'\377\325\037\367s\237\365\344c?\214\374bp<A\2613Z\362\311d\333\301\370\357\323/\341\177\335G\202\345r\304\202L\016\253\214\377z\203\007\362_w<\215a\3473x\315\212\275\036\31636\301\277>\300\370\257\313\356\205\217\265\316L7AQ\272\303y\236\247\266\024W\276\213}w\322\362\027 0@\300S"
+	.string	""
+	.string	"NML\316&sIi\231\204\244<2*\"\032\022J\"\217\306\030~\335\255e\377\330\312]\203\323#E\033\373\002yO \317]f\361\364"
+	.string	"\001\360\232\2272\377tGF\007\b\234\336e\3474"
+	.ascii	"7\346qv\345\003\247rnU\342\226\357\355\312\264Sl\025%-\356\233"
+	.ascii	"\230\300\274\023\314\027\335d\272P\201S8\327\3316\365\242\227"
+	.ascii	"\260h\245\345\265mjE']a\323H\312\300)\025}d\024[=I\273~\221+"
+	.ascii	"\245\346f\310\007N\255\3562\316\032\236o\2332\321DW5=4e\211\026"
+	.ascii	"\252\242D']\251\355\236\341\007N\253\270\313\263+\322\317K\242"
+	.ascii	"\221\002\236\244Q\377\3306E\242\215{/\240mzD\307\356S\340\224"
+	.ascii	"\232\027\325ple\367\357\232u\360\212\370$-\356_\"\357&\321\240"
+	.ascii	"<\364&B\203\272O\363<\177\366\265\031\332S\353\330j\236g\327"
+	.ascii	"R\264\264w\250w\327\\\334=\315=9\007\306]\365\252\375\356\315"
+	.ascii	"%\013\347\367<\303\317\331`\234g(\004\177\301\227\303\301\303"
+	.ascii	"\207\017\360\277U\373\367^k\215dQ\213\223\243\332\357\216\007"
+	.ascii	"\225\275!\323\213/xG\f\231xW\325\274\2737\2378\356>\306As\355"
+	.ascii	"\360p\\\013`p\236\347*\377\277\177\003\302\237\355_\017!B\004"
+	.ascii	"\374/\325\376\274w\345\250vp|\333.\r\0174xW]\273\t>I\270\025"
+	.ascii	"|\3236s\337\273\r\211\375'\345\323\264\367\376\250\"\231^\204"
+	.ascii	"\337]u\245\324\334\bq7\224\034p\324\306\360MC\342\272\354]\365"
+	.ascii	"\035\360o\235\230%\204\352D\367\367\3734;\374\331\334\004\n\375"
+	.ascii	"R\024\360\277\277\343=4V\265\270#dz\321\225\032~\025\260\373"
+	.ascii	"\n,\375\322\250\rU7\267E\334B\367\230\023iw-\030\372\245P\333"
+	.ascii	"@\331\034 \342\366\271\307\334\261O\275\253\356_eM,\364\r\305"
+	.ascii	"\375\357\336/ \265_\031\265[Y\2400AB\254\275*\002\204X\373\003"
+	.ascii	"\007TH\355\n\220\332\245\220\332\021\034\265\037x\271\367\250"
+	.ascii	"\027\363\016\205\324\336\364x\357L_\367\356l2\227\222\332\225"
+	.ascii	"`\355\313\243\366\244\327\216\204\324\256<j?\212\265\033\375"
+	.ascii	"\365\275\310\250\235(\326>\024k\027\212\265'c\355\310\327~<j"
+	.ascii	"7\032\265\307\260v8\326\376\276v\367\265oX\273~\355\217\201I"
+	.ascii	"/+8\306m\320\256\203\235\317\026\005\315\200/\037\226\277\373"
+	.ascii	"\307\373\257\373\277\376\313\375\213\t\237\367HAom\242Z\347\253"
+	.ascii	"yw\233\315\275\264\315\334\215\266\004\004F\317\244\254\r \342"
+	.ascii	"\026\001\323\2566E\363\364pn(~w\252\316\330\24055\324\265\006"
+	.ascii	"\254\372\t\"\211\210\t\373\006\265\016\034_\324\334C\013S^\002"
+	.ascii	"_m6 nN\372\b\272\261\332W;\376\023U$\332P\333j\277\336khS28\027"
+	.ascii	"\255\313\362\324\363\225q\221h\247\240\322A\344\203s\026(fi\217"
+	.ascii	"\237[\226PihS\330{\216\324\320\366\216\020\251\355\272\202\234"
+	.ascii	"1\262e\030\277\265\354\337\3131\241\203&-f\t\265\2409i\017$\241"
+	.ascii	"\355`o\272\262\255V\260\335e'\362\232~\251\020\322\031BD@\347"
+	.ascii	"V\260]K\371(\243\366\273\247\357\316QrC\250~\240\304\344~/\324"
+	.ascii	"4Bn\211>\214\220;\302v\351\312\266dzQ\312\037\032> yJ\025\331"
+	.ascii	"\212\025\370_\344~4T?D92\275\b\267A\331\024\305c}nY;P\235\250"
+	.ascii	"\234\243(H\264\253\376\206\351\303\222%\204\302\033D"
+	.string	"7\264\253\276\340\235\373\035\353\253\222\375s<#\201\314\204\216[\267e\t\017hwY\213\354\246_z\334\356!\341\034\340s\217\375\027\301bH$i\214\177\315\353\343\177\016xY\267\247\b\377\232\277\260\315\234\340\003\306\302,\341;\301\306}`\273\216\036y\276\236\337\312or\027\031\016\016\376\327\270\301\250Z\304#B\220\361\316sU\340\316\343\221\301\310q\362\234<\007\377\373\376I\371h\266\277\202\241v\374\032R\365\236u\352\324\236\307]\365\007\373\335]F\334\262\177\030~\260\316\203\235$3D\224\363=\177\342@\t\036\203A\030\327\026\r\261)\257\257\256\256\257,\247\026\227\214.\2540\330\305\026\027V\211\260\255\0304\214\262\342\260\017Z][#hxi\201\201\211e\r\305\310\242\261eC\304\r\261+\255\027Xa\\[X/\216\\|}m\320\002\273\n\343\322\362\362\302\212\201\341\206\330\025\027\027\326\322\263\030\334"
+	.string	"\233\272\0016\345\265\205\3255\225\005\0266\305"
+	.string	"\311\277dh\201M\321\370\372\002\233Jb\311~Cqc!\030@\262\375,\240\264\223\310Q\nV\215DSe\037f2\020 R>\313\255\264\231t\f\264\021\327\032\213,\367\347\331\341C\022\302\003\221\300\201\227\337\340\244]C\310\231\f\227\264e$\321\203\033\200\346\225%\201\236h\235"
+	.ascii	"\207@D6\242_\352O\2460\t\\\237*OEG\305\1773o\t\260\253\356\256"
+	.ascii	"Ss\027m3\244\335B\237!\021@s\223E-n\013`W\275\250L\223\361\360"
+	.ascii	"\rHT\373&x\3476s\267\211\271?\373F9o=\242\332\367\177\007\334"
+	.ascii	"twn\345\306\360\346h+\365\017$2\334Q\021j\035\342\273N\273\352"
+	.ascii	"IT\373\001\337\256Q\255\322\301\020\325\206\373\f\215 l\335\344"
+	.ascii	"\315JT[\024a?x\023\265c\222\240\027\3252'l\035oA\242Z%\252\375"
+	.ascii	"\333\267\273\250vI\341\254n\257\360\210j3m3OjnW6\267\0175\267"
+	.string	"\0335\267\0275\2673-mg6\267+5\267/\233\333\335\243\346f*x\347\266\260\017\251uYxK]\273\034\364\361y\037\265\227F\020\030l\222\336\360\206\r\237\332\377q\306\231\320y&#\300\264\365v]\346\347\251\027u\323\256z\201\"\250q0$\221cfDDDD\222$I\007!\005\004\031\b-,\017\021\2005c\216h\323\001\255\306~\275`\363\257\344h{?7\230\313\235\2268\250\201VMI]\213*\211\210%5\333=\r\212\322a\250l9 (('\307\037\r\312'\202\261\376\226\020\t3\301\276\006\334\214JpTv\245\221B\212\242\025ZN\253&\237\354\3443\217\2242\265\336:pA\317\036\3605=\037\262\020\232+\315H\203\343\334\345\212\372\374\360\305\256UO@\223\bB\241'tQ\032\210\317j\f\263\325\351%8\300x\212@\264Q\374\321\301K\210\207\363g\223\335\252*I\346\037\367"
+	.ascii	"\002\bwu\237\0304;6\275\314\374d\314\246;\312\357\360\224\003"
+	.ascii	"\232\206\027\\}\223\225\016\225\021\250r\004\346qj"
+	.string	"\312"
+	.ascii	"\233n\232\215\330L\363\334\031\265\376\037{3i\3160<8\322\236"
+	.ascii	"\210?\31417\240\221\244\231\252o1]\024MN\303\366\310\226\376"
+	.ascii	"\276\237\222\327\213\272\306tD\232\275\336\263\252=\f\253ld\227"
+	.ascii	"&\237+L\230\316\300\031\200\001b-t*0hw$\253\020$O5\215\226\204"
+	.ascii	"@\350\347\020\226\315 \023\322\024\274\336M8BL\224\004\020\352"
+	.ascii	"F,\221vY\375\005\t^\205\322\322\232\306$\307\247-6\212/*<HEY"
+	.ascii	"\335\264O\321\211R(1\201>\227\202\364E\364z2IO%\347\252;\301"
+	.ascii	"4\347\031\304\372\370E\255\375\341\0326E\233\362\005\002\272"
+	.ascii	"\231\225\234\210L\202\234\231J\335\326\021\n\036\306\206Ur \016"
+	.ascii	"1D\004\270H\220W\215W\3447\343#\327b+\324\232\272\213\367\"+"
+	.ascii	"D\334\210J\312\007\357\006\374\337\376[\226\321s\206\3649\311"
+	.ascii	"O\030\017\035\271J\372\253\374/\226%&\b\374`\372\312 \253\252"
+	.ascii	"\202}\t\252\277+G\210JI\275\013\333\236p\231\370\225\265\240"
+	.ascii	"\312\025$\356\342,\354\355PR\372\037:j\301\"\313\313\266\321"
+	.ascii	"\215\255\233\254\302\025\360m\017&\255e\2767\n\313\274\n\210"
+	.ascii	"c?\022\371\240z\202\260T\316\270jO\232\035\314h\360\254\230\265"
+	.ascii	"\352w\245\330 \307\370\366\273\b\326\302m\013G\005"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.107.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"v]fE"
+	.string	"\261&\035\200Q2t\026\0305yN\236s\337*\036\323;<9L\272'\2671?\376\004\264\334\r\2325\266\326\032_x$Nk\373\321l\001r"
+	.string	""
+	.string	"\006\265\214W\206\265\271\260\020\233\350\330\265$\356\275\245L)S"
+	.string	"M"
+	.string	"P"
+	.string	"\361\360=$\036\332v\311\001\224S\3578\270\004\340`p\331\321\261\333i\272\341\251G\3704S>"
+	.ascii	"N\365\230U8|\005fxbB\234\204'\322\243\301\006\f7!_\314U\304\261"
+	.ascii	"\336\310\356^\347\371\302\265d~\230\354\256\263\305Q\270?n\233"
+	.ascii	"d[\263\337#\234\214\232\231\034\013\253\374\261;U\252\215\375"
+	.ascii	"\267\273k\255\261\377\372EN\203\234\216NC\247\237\323\252\351"
+	.ascii	"\203\230@\270`\270\213\210\355\272~|v\006|\341\3016\312\016\331"
+	.ascii	"\316\264?\3429\250\277\"\030\264\233\241F\213\335\316\200\007"
+	.ascii	"d\207#\027\t8T\237^\205\313\205P\276;\212S\266\273z\353D\252"
+	.ascii	"\352?\320\260Te\333\301c\245lw\021\370;7a\362o\016\r\341t\212"
+	.ascii	"\207\251\347\221\201\021\342\225\273\253R\247\342\225\001\214"
+	.ascii	"\006+y\330'\361\022)\377\306*+\371\326\241\277\022\017\257\327"
+	.ascii	"9\201'\005\244\322I\202\024\024\322\266\251\214\002xD\302\262"
+	.ascii	"i,\233\206r\262\240\244\215\266\223F\022b\323\003\322\246\245"
+	.ascii	"\230L\233\026\352\366\017\302\314\007\247C\214\305;\354 }\261"
+	.ascii	"\rR\233\254\264%\202\244H\355\021)\337\202\372T\345\"G\017\r"
+	.ascii	"T\033\330\343\212\006QKdb\354xOS\274\033\255  \260\002\241\200"
+	.ascii	"\254\007\340\2007lM\302\0052\210V\340l\31396\217yF0\016/\203"
+	.ascii	"\016P\213\024\025\004\t\230\210\234\217q$\355m1\266tB\220i\004"
+	.ascii	"\221B\224A\003\224\327\2242\3604C\304\347\253\027\315R\320%k"
+	.ascii	"l\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.108.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\303\002\r\026"
+	.string	"\346(\220K\260\022R:\213F\256\243z\210\214=!\024S\f\226\231\242j\275\372\330\2249p\267\2662x=j1\241&\206\377\262eT\274\022\374\033\331W\326]zwp\360\356\230S\277d\033\305\r\263{\370z\350A\345H\2154\262\211\334I\006|"
+	.string	"t"
+	.string	"~"
+	.string	"\035l\260\t\312\327\r\276"
+	.string	"\371Z^\204|]\333n\324\203\2766\340\223d\003\364\243\273_LbY\324\366\222E\326\221\251m\377\363\221\007\334\261;i^\216\254\034N\2113q"
+	.string	"1\242TM\035}\210\243,"
+	.string	"'rN~x%\351n\363\314\321q\024\tA\324\344:ucI\023\n\235\023Oo\316\032\312\037\276\362~T\2733\347\224\025\241\273\227\356\316\016\337\326wW\304\356>\330\245:\002H\271\223\271\267\033\244\241(\276\252\250\345\235]\327\203\177\310\203\276\346\201\177\353\302/I\322\255\225\3568\322\345\221.e\272\027\020"
+	.string	"\310\206\363?\251n\234\242U/\325#\023\017\372\205\273\007\332\023\327\f\352\361QrP\276\305~\270\346\353\356\ng\0064S\377T\341\203c\252;\310\340uO\312\327\233\273K\2032P\013Nw\317\342?\333\2013'\320\2753d\324\001N<2\344\353w=(\217L\336\260\271\272}\206\254\224\301\314AZL2\345\0039\200E\272\0248Z\334\217"
+	.ascii	"\256\350\251\334\023z\fYI\321\215F\234\026\212|59\2030\251\206"
+	.ascii	"V\235\002\255|\360\030\271\267\237!M\346\037%\236\360\251\206"
+	.ascii	"Vm\b=_\350D2\005\276n\335w\373\241\273\210\215\347y]\0132\362"
+	.ascii	";\0319\273@\2773\231$\3074[\371|\342%\360~E\233\253\033-210\207"
+	.ascii	"\275B\254\305e\226R\243\2251\030^\\bua&5\332\253F{\271\304Vd"
+	.ascii	"/\030\r\346e\"\262\263\027\026\332+f6\243\275\314`\237w~~\rR"
+	.ascii	"6\226n\214\233*\271\267\255'\322\305\365\211\336\250\220\225"
+	.ascii	"S\3660h*e\345\361\305\215\316\215\026?vw\263NN\262\213?\374\004"
+	.ascii	"\341\217J\327\203\243E\352\201\034ywk\257A\001\201\257\273Qv"
+	.ascii	"W\216\004+\273\033\302\353\236F\013\313H6 p\002\231\"4\017\341"
+	.ascii	"\300\357;\332\006\202:ze\002\013w\236\312\016\232w\367*K\212"
+	.ascii	"\260\003\265I\377\221)1\321\205\231:\354\360X\252\270\3239h\263"
+	.ascii	"\3048\353 p\244CC\306v\241\301\013\026g\212\035\306\0035\234"
+	.ascii	"\330btY\016(\tw\233>\340\\\346p!3b\362\200B\330\205\3042\r\213"
+	.ascii	"\373X\255+37\300(\335\275q\327S\f&\\\360}\b\227/g/\2333\265\346"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.109.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\365\n"
+	.string	"&\025K>0\247*\0355\216\027T\346\211'\350\252\267\254o\233\306\r)\264\352\352\302\274\360AV;#\2645\254"
+	.string	"T\033$\032U\347{J\230\bB\224`\001\262Ks\f\324\275\263\025\177#{\357\235R8"
+	.string	":"
+	.string	"5"
+	.string	"\227\355\325\240M\273X\262\f'\264\rY\202\335\345&\311\301\323)A\377 $\235~|&\204&\212\331\335\307.9\302\223\224\024\315\356Z\242B\217\273\336\366\204m\b\373\022\001\322\247 \214\254\360\257q\267c\254\255\201Z\300\304\366-\266\247\370"
+	.string	"\340a\"\033\354\216 p\250\274b\250\224\366\001\334\005\3765r\335\025q\315v\305\0077T^\025\276\260\275\312\007K\232se:?-b\007NR\201}\331\005\210|\226?\220<\352\325\007m\257\237\217\235\316R\265\026HI\216\266H\222se\237\356\356z\252\354\277\376z\330Oi\234\215\007\352\276\255\363}\024\032\034\017\305\233L\310\343B\036\347\351T\\p\033\357\3432\027w\030\034\217\313\350:\217\263\210{\272SekJ\323D\353\364\007\234\300\250\373|\266\327\210\324\202V\210\334\r\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.111.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\361\002}\026"
+	.string	"6k\223H\320TQ:Y\007\024\006\212\253\252}S\241\204D\b\216dEdM\302(-3\277\255\375\357h\355\217\345\337vV\252\2722\205\377\2466\006\214\312*\022\032\002\257\350\353\255\f\273m\226\362\374j(\376\333\377\244\221M\244L)|"
+	.string	"r"
+	.string	"\200"
+	.string	"\251\313\247l\257\357-nw\261\343\323\234\037|\254\210\227*\240\252}\025_q;\013\233\345\234\036J\024\315\351#`\001\342e\353\260\360R\377\n/}\263\215\334'b\002H\261a\007c\311\2343\266!~{(\301\325\233\317\363\020\305\373\271\024\177\016\202-=Kz,^\017\250J\332\001I\361r\272,\336\b\252\3149\377\273Z\340\351TM.sN\253\017/\303m\272m\031\333\005\354U\020C;\376\bK\260\321\373\\\3726\341\345\367\277\203E=\033L\200p\272d\373F\335 \373\340\234szA\330&5LT\247\204\352\227\252]\252F\021\325-Q}\"\252Y\252^\251ZeR\247T\215\n\325'U\213g\361\313\273\370AU\253T?"
+	.ascii	"\213\004\021\357CJ\346\274\260\324d\"I\243\022\266\357\303x\214"
+	.ascii	"\234\2770\202\036\017\024s\316\324\245\235c\007C\200V\313R\255"
+	.ascii	"\356j\365Hgb\324%\247V\025\341F6q\316i\300/\372\215\006\376\210"
+	.ascii	"K;\210\211\t/S{2:-j\277S:\215\327\220\231\221\311\302\313\323"
+	.ascii	">\306\301$=!&@ruQ\343\f\241\023i@:\"W*"
+	.string	"\256\r\241F\357\343\377\356\222[\036\313\025\327\272S\302\351R\213\220\016\030\300\r\262\374N\b\356\203\234\370\r\311i\222\3169yv\203\f\356\367\301\217HN\223\354\313x42\032\316\254\026\322\340L\230aPS\253\321N\226\261\350\320b:\264\030\205\232\031\233\230\214V\213\261\274<\253@C\213\335\314f\264X\312\207\373\202\260\013n\307\020\266>\322\177\330\022\274\274\204\227\377\375\300o\206P\312\302\366`kS\0265\016\345\320)\275\266\207k_\2534vJ\367Q\210\262\256\005\213\354\200V\216Z\224u\215C6t\034\306\0356\226\b\0357=\242\024\275\326\346\270\017\222\223emk\257\3430\342\370\321\200\00500\341\345\311\252\0027 p\002\231QU\017b\001\253\207\224\313K1\2627t\315\273\360\027\347\367X\037\306\211\256\021\210\300\030\312\254\035\346jt2_\237\257\b\230\006\221\270\227\027\3353\2622\024;X\353"
+	.ascii	"k\342\301\205\255\361\343X#\373\226\353A>Wk8\247X\346h\321\b"
+	.ascii	"X\bY\001l\224/<\336\362\022\013\204*\342\361B-\324>gh\210P\367"
+	.ascii	"f\377F]\006\326G\003\275\244\323\375\332S\023\305\326b="
+	.text
+	.section	.gnu.lto_setRssiMsp.112.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\016\0015\f"
+	.string	"\366UP@0O\224\016G\320[z\306v\017\340b4\273Z\227X\212\227qW'\n\2473\234\241\231\243\005*\372\004\207\363\303\303j\314?\365t\340\203\303H\007\344\016\345'\026\245\345\026\330\267F6\331R\246\024<"
+	.string	"="
+	.string	"?"
+	.string	"\227v\370\366XA\315\315\2672\224\316\343\036'\027^A\004\034)\323\305\223"
+	.string	"5HJ*8\022Z\270^<\022\034\260\273\377xN\36062\255\314\356:;\257\302m\335v\307v\001\373\236p\265\303:\352\217\232NM\277r\t\201\302\373\211\027\273\024Jd\354H\225\002\204\355[lg\332\007\022lGE\260\356n8\205\354~\006L`\362\312\233\355\342\237\207\rpB\225J\244v7,BDp\250\324\203\304\323D\252\200\025\031 \274\026A4&\221T\214\334]N\255\305k\003\220\026\244$\261?\342\237\346\1770\204P\276{\345\207\342\253\253\306$r\3020\312\022\373\343R=\354\007\035M["
+	.string	"\322\024\2048\237\2127\030Qv\211\262\353\323a\340\2716\231va"
+	.string	"\030\003q\262\353\001\206e\227\345\333\303\325\216\t\f\r##\335\210\224\264\324\306\034\344;\377\343\031\222r\216j\251\2634\303\001\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.113.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\301\001\025\021"
+	.string	"\206buG\320\224M:i\223\203\212\007(\016\351\320\265\252\340@\344\325\f2\252\004\025h7\205\216\241D\f\006Ac\315\024\300\001kk\315\207\206\262\242f0U\006@\t=\354\250F\013\006.\341\035E\302R\032\215\220\275\211\224)\005^"
+	.string	"W"
+	.string	"e"
+	.ascii	"6\215\355\035\3764{>\212\247`}\266a[\022(\231\r\237\335E9\264"
+	.ascii	"\201\356\320\344\002\342a\376$\036\232e\367\030\300a[)\262\032"
+	.ascii	"7ACv\367\323\021g}\323d\371\034\212\366\022,\326\372\026\342"
+	.ascii	"Z\022{m\005v\367@O\017\261\232L\016\265\273NX\f\304\ro\273\201"
+	.ascii	"m\004v2\b\35794\214*\017;\364Uz\037\035$\"3W\326\354\237W*\217"
+	.ascii	"\375mw\327\272c\177v\233\270\264\247\351RLw\232\3464\035"
+	.string	"a\032jz\323\264n\351\324\364MJL\360\210]hh\367C\315\310\036\301\242\022\237\375\366}\025\007\262=\323\374\307$:>N\354\256w\030F\021\345\217\361\313\370\325\2260!\017\343\364\264\037X\034m\231\313Q\322k\f\002\200\3506\212QK\352\264\001b\322\250$8\204\204\334$A5\351\221ln\270\262\226\3410<\324\355\356\002\337\305_\264\244\\\\\342!T\002:\212NW\3354\036\261\021\361\312\232SU\177\223\344\no\361\322\355\326(\360Y<\310\202\003/22\020`4\304pN\235fV\337\314\352\273\360\322\002\363\245V2\337\351\304\252\030\227\325\207A\245Z}\336\217\353\333\352\316i\177\207\037\264#\227\276\266N}\0327r\360@E%\036\246\344$\311trw[\252<\316\257DO)\254\330Q\223E\354\023}\306\212\337\343\b,,\361\320\323\003}#\3121\"\303\341\264\323\004\001\222\253\335\001\035"
+	.ascii	"3C\267\221\300Q\\\337Z\313\250\352\b\253\005\341\244\312\276"
+	.ascii	"\214d\013\037\031\257\256\365\2742Hf\032\\cJ\303\206^\346\021"
+	.ascii	",\273`\340$\362d\2021L\355gg\226\332.h\270\262|`\037p\371\200"
+	.ascii	"\345E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_updateRSSI.115.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`M\001\245\r"
+	.string	"VXYD"
+	.string	"\261&\035\253x\306\037\253^\234\372\322\224\355\205;l\004\300\202\363\310\350\032\003h7\234;\006\237\341\034\304\022\320\3509C\342\264\266\203&\033\220\241j\005\243\252&\223'\330R_\22087\006\261d\357-S\nE"
+	.string	"E"
+	.string	"F"
+	.string	"\036\326\2453[uo\303\n8Y\240PCcw'\324\360\3542B\315\374\370\022\003\207\353\264\313K\345\3614G\360\002c\005\327\251\034n(\326\207\t\305\241\243\233"
+	.string	"\265#\262\273V\256\273p[\267\275\300\366\264\377!\362\260\203\305\006\304JI?\333\333\024f\260\017\277\357\253a\bc\177\346\227\252~'\300\214\230\356/pvS>\033\233\222-:xl_\355\213\370\210\3543\022\314\261\213!\004\213]\357\200\t\\\227 \377\260.\343\003\234\177\263\362\220\332\240\346\327\034BKJ\323\234\233P&\0270\205\257\"\262\310\254\013\n\337\306\252KO\272\313\236Rd\354\237\260\255\032\200Z\331\325\336\242\334\032"
+	.string	"A\321\033\366I\274\004\311\217q\204\023=w\351\237X\017#\005\240\320H\202\022\022\020\206\221>"
+	.string	"\374\t1\301\246\t6IF\030\204\346\007\033\315\020\017\213\034\200\260Y\"\022a\323\343\225\036\027\302\320\374\025V2R%\270\371&n\021Ms\242\364\250\335 \004o^`u\212\227\332\017F\372\037"
+	.string	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2\236\222\f\0077\263\32556\001\301"
+	.ascii	"\315O9\003U\030Q#\213\243x\251\314b\234a\005e\313\300\250KX\304"
+	.ascii	"j\364\270\233}\022\211\325d\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.116.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\366\001\355\020"
+	.string	"\266\340pE"
+	.string	"\317&\035k;p\214\311\210U\360\b\343\324\371@\022\264\266\004\334\255\205w\302\r\230e\005S\214\035\303~8\334\364\230k?\2649a\376\370.\353\377\205y\005\235c\001q\001*\200.Nwk\204\220\275\245L)Z"
+	.string	"U"
+	.string	"^"
+	.string	"\376\215G\177y\337\326~\203lj\200va \217\026\260=\3726\347\240b\357C\202j\345\303f\206%'h\027\306\231\336\221=\3469\262G\305p\357P\323\3635\221\004\237\317N\313\265rX\341\252\341ZA\217\335\375\315\263\305\365ej\"\273\353l\271(\334\361\266\017\330\006\261\023%\035\216\343\3712\206\220\312\267\036\375T\366X\322\002.>.,\2502f\303\276\324\030\373p\025\306vz\303T\372\353\316\200i\022L\217`Z\024\323!\230\336`Z\203\351L\323\021\246\241\2465\323\231\351\003\320`!\343z\317\316\356\204\030\214-\021G\314\374\365\333*\001\253]\325"
+	.string	"M\267L\241jz\326\206/c\216\232\35134\252B\215(X@\251\252g\211a\223\207"
+	.string	"\221\212\300\345D\315\013\226T\213\335\313L*2\321\263\202\245\341\313\335]Q\215\361O\331U\201\207\024\253|a{\301uN\333\356\212\200\377\3419\f|\231G\237\240P\331\343u\304\345\247\346\365&(\rHFN\251T\027rIHJ\307\245t\234\203\023\311\tW\322\245\270\020\016\243\036\230t\\\004\024\252\343F0\325\341*\214;vh~\324\244%\026\232\227,i\206\266\330\336P\017\225~&\351\206\236\3653\322MI\252\345\260^\276M\244\243\220\2124"
+	.ascii	"\t\026\020\311yJD\204\364:\031^<\277\240\002\007\2666\020\213"
+	.ascii	"\265\b# p\002\2411\343\rM2t\367\024/\225\300\255'\233p\331$n"
+	.ascii	"$\005;@\302od\013\221\373AI\250\341T\212\310bo|\211}l\025\034"
+	.ascii	"\277\214\302]%w\311\234\247\005j\017\347YH<7<O\360\005sP\304"
+	.ascii	"\020B\301\210\035GM#\261,Tn\273\202\036"
+	.text
+	.section	.gnu.lto_getRssiPercent.117.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\211\002\375\023"
+	.string	"\006\347\205H\340\320(\035\333\215\230s\221\333\235\240\017\250\306r\037\263\261\276|\003\221\221a\255\224\344K\035\227\344\n7Q~\217\313\335\200\036\274\023\243\017\3314\243\f$\211[\f \304>u5\214s`\350\266\024{\333\b\331\204H\231Rq"
+	.string	"f"
+	.string	"y"
+	.string	"\247\234\f\314{\f\341&\003i\316\t\343\347|:\370\021\367\2019\211\230\317\332\374D\302\361\034\315\231+9\350\001\342\301\324W\362\240^%/c\237l\340\200\214g\002h\200\331(\200SA\373A\2323\307Z\017\237\371\267:\343\207'\270\243\214<\243\232\r\366\217\303\027e\223}$s\316\357\2564\266Q5<\231sZk\266\r7x\333\nl\227\330+\006?\007\212\361uL\201E_;\350\263\310\203\337~\367\257\347\306\313a\023\323\236\235\033us\354\177sqlQ\275\222\352\021\251VI\265H\250\016\221\352\224T\203H5\352S\177xH\365\351S\233@uI\004\325\241\325\362\272\373\373\324\372\251\017"
+	.ascii	"uc\205\355\274\031s\326\364v\314\027\240\020\210\353~\373~\211"
+	.ascii	"\353\374\235\003\r\336\342\201P\310\036\350C\320;\324\320\345"
+	.ascii	"\246\023\364z8ds\306\b\200l\n\265\247\005\331\317D\214\332\363"
+	.ascii	"\307\242\366\036\373a\332\323\2021fG\2455\355iI1\355Ex\020\213"
+	.ascii	"\322:\270\025\361\370|\337\206\275\307HqM0\\\030\315B\214:\347"
+	.ascii	"\204\355\346\370-\031\256\204\035\r\231\352\360uVy\212\2268\247"
+	.ascii	"\f\201\177\342(V|\235\203\236\340r\311\203\341\246\334\210x|"
+	.ascii	"\036+\031*\250\244\270\\\\^%\267L^^\254\227\027\313\202K\205"
+	.ascii	"\205\325z\271\260LTn\271\260\362bahiy\261N\271\330\277\2718^"
+	.ascii	"\231\330!Zq\277\373kh;7\372\255\307\322\330\226K\022\333\321"
+	.ascii	"\272r\245.\n{\367\220,\371\327^\300@_\323\375\246\315\302\274"
+	.ascii	"\332\357qG\031yF\264\244\221]\355gD\252M\355\310\206?\263\233"
+	.ascii	"Q\024YU\310\212\254\200\241\331Q* `\202a\350\252\033\2232t\035"
+	.ascii	"&\274t\t\361\232\3670*\007~e\262\n\247M\342s\266`\b\312\227'"
+	.ascii	"\334N\244}\340\013\207\256\232=\214\373\206\260\363\355\266\221"
+	.ascii	"-\343\273\312\357\272'\371\261\275\022\347\221(\212c\"\204$t"
+	.ascii	"R\374\204\003x\202y\211l\352\273p`_q\325rX?\364\362\245:\266"
+	.ascii	"\326\224\001"
+	.text
+	.section	.gnu.lto_getRssiDbm.118.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \356\215\006"
+	.string	"\302\214.4`M\222\016\300I\035\034`\350\033\224\372i(\006{B\306p\326\225\211\214mmc=\225G\353\245\033{\bb\003*\205\202\004\235\001\201\300\0061J\006\3312\005k2\233\351m\246\027\361\320"
+	.string	"\3614\323\304\313`\226$\034\246G!I\323\273d\331\366\301f`5\317W\244\031u=\256\340`\257\272\313\211\352\260\thX\330\362Y\205\215\343\013\220\231y\373\3748\266\001\225\024\254!\222L\214\026\226Dq%\037\177\347/\027T\220\316\224\202\205U!\200N.FV2\363\021\264 \252\303b\242\272\326Q\252H\335\206\224\301\0232\271\260\252\030\260\220\231\343\205e\364\326?\341?\3707\002\007"
+	.ascii	"2\001\0238#(\016%\256\321Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_setRssiDbm.120.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"-\013"
+	.string	"&\026M=0O\224\016\240`]\256\034\311\222Zq\211\034(\021\243/\345H\367\221\251\315L{\337o\255\341Fw\342\241\226{_\361g\344\"R\307\202\b\2603\322\021R#m\336G<\331[\312\224\002:"
+	.string	">"
+	.string	"7"
+	.string	"0\037\231\016\255\331,\316q\330\003 `\2046Z\354n\324\r\327\37645?\300\326\371\243,\\\007l\237'\331\335w\317\t\033(\023@\265\273N\321V\341\206\267\255\300v\002\373U/}\212\300\250\304\366\023)v)t\304X\024\320\204\007\333\207\330V\356#\264kp\374\330\035\255(\355r\023G\352P\3622\355\207\270\b\355\031\022\fw3|(\355\356\304\b\250\303\00270=\223:C\034\251z\265t*@\371\302\376\306Ip\374\016\306\262\274\350\320\317\246\303\353\273\277\022\006\016\027\027<\331as\237T\r\366\337\356\256\225dgzz\306\377\256\361k\230\313\225Y\330\204\311\032T\030h,\0132\030v\t\360\205\262\271\342\346\212\0162\025M\274\\X\244Dl=\300\\1\202e]\021\302y\256$\273\362\350\347\275GNj[\020\362\"\277{\005\322\216\237\006\023"
+	.ascii	"2\001/~\364\021\202\300\0350\206T-\203\027\330+b\303\374aAta"
+	.ascii	"\030\206\321\200\030\340\n05E\334\345\246\332\033\n\363\326\226"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_setRssiDbmDirect.121.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"M\013"
+	.string	"\266\025NA0\211*\035(\224\021\2203\375h\304\366\276\027\325EN\"7\215zg\355o\254\266\207\323*\314\027o\037+\200\364#\211B*\005\312\017\265\240\340\330&\265\n\001>V\206\204\207\325\276\217\310\336{\247\0249"
+	.string	"="
+	.string	"7"
+	.string	"\362\027\356\325\241-\341\243\200\205\200yp\320l\273\333\315"
+	.string	"\017O\247\f\375\212x:\r\371d\020S\024\263\273\237]v\210*)'\233\335\265\\\211 w\275\355\n\333\022\366)\002\2374"
+	.string	"\210 \376\301\204\335\217[\205uP\033\020\260}\213\3559\376@xY\311\013\273%\266\332\356\230q\206\362\212\241R\332/pX\370\230\311u\227\304@mw3\216\240\274:\374\201{\r{\232\323e:?93\b*I\301>\355\bJ\376"
+	.string	"\203#\371\325\253?\342^??;\255\261\022\274DP\362f\217'9]\366\351\356\256g\313~\354\257\227\375\224J\007\236\3167\362@\016\304\261\370\200\340\305\206'TqGC\372:\322\327\205>\030\240\256\363\201\235\346b/\303\363u\032\236\367u\226qOw\266\354\rj\246h\235\276\202/0y\"\021\367:\301b\360\032\221\273\001\022"
+	.string	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341\026$\027\206a\030\r\210\001\256"
+	.ascii	"SS\304]~\252\275\242\324mm\321\003"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.122.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505@o\222\016\230\265\006Ji\364\223\275#\325\001!\233?`u\0203\006\242\250\265\315\036P\327*\nH\350\250j8<\r\001\250q\017k]\316?\2436\261\204\310\024w8\036*z\250\b\341\300\360\020;\224D\344h\236\"\032\25081MT\314h\331\027\372\031\\\357\342\247\350I\025\220\231\t\327\244Z\305\005)\334\342\343\212\025\336\217T\350\236@\311\345\266\327,\367:\276\230|\241\337\355\336\200\210F\326QK\346\306\366\222,p%\344\007}\346\216\224\004t\265\301\270\254\215H%#\305%S\213\004-\220\n]5R\341\363hUW\335\212\272\2002\332\260\314\252\003P\310\314\035\226q\364\327\037\341?\370?\002\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_isRssiConfigured.123.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\222\f.4Pm\222\016$\243nO\260\256\330E\3252H\004M\206\026\343\240._\317\276\375\273e\307\031\001\250P\343\331\2316m\f\025\260B\022Z\2249\252\265\3667\221)g0\233\3476\317=4,8\270\314\213p\030\201+\b\206\347$\252\352\271K\226\305\021\"\301\007A_M\245\210\330\020\b\250\245vh.\351\tN\353U\352r*\245\212"
+	.string	"\025\237v\372\314\323\360\342KI\034\375ml\355R\0026HXM\"\231\242\323I\216P\037\032\177\347/\037 t\266\232e\210\006J!!\017\223\314\314!F\2556\353\226\243\n$\246\222\013\363\264Y\0222\363va\024\035\373\033\374\005\277E\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_rxGetFrameDelta.124.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`~\002\225\024"
+	.string	"\366\245\206J\260\022R:\013\017O\341\243\017A\322k\326nZ\215\253\252\326[=\253\016`o\203\037:Z\325\021\361\316\\Z\253\263\315\210\340\336\376C\234\254\361\214s\310\203\026\257\304\333\007\034\270z{(\272q\350\226\353}-\277%D\312\224\002p"
+	.string	"e"
+	.string	"t"
+	.ascii	"3\027\312\\6g\317R\2139\205%.P\236\264\260\264\355\2378\212\031"
+	.ascii	"\357\034\330\360~\t\204\232n\212Ss\316\031\311\005\260N\216\037"
+	.ascii	"a\235\334\021\337\235\034Ww\376\207o\320\233:\362\375hN~\370"
+	.ascii	"\030\362\263\031I\346\234\257_\215\3568\262\223\364\364\342\325"
+	.ascii	"\303\317fD\360\004\304\363\341\265\303\257\247\332Z0\347\264"
+	.ascii	"\372~97\353\266i\266\037\330J\024=]\037\373\343\334\036\333\245"
+	.ascii	"\226\225j\021\253c\245\032v\341\017\342R\273N\274[\245zK\265"
+	.ascii	"\266\324\007\020\233\021\374\035\307\321\2348WU\323\211t\361"
+	.ascii	"s\342YJ\352\332G:\017\260\352E?\212\271\221S\200RO\341\027}\242"
+	.ascii	"\206\317\234y\016NB7\242\346\024\0368\351\2222\306~\235T{\306"
+	.ascii	"~\331V\265?t\242=tx\353+]\330\301\240\202\276L\361\343\022P\252"
+	.ascii	"\250\206\212\034\"+\333\001;n\254Z\253+\262?\272\001\022?8 \214"
+	.ascii	"J\364\364\3122\265'\320\364>]\235\242j\nQ\177[\373\342\003DQ"
+	.ascii	"19\365\226F\237\200v\224v}|\027\326\227B\221\215\032\365a\273"
+	.ascii	"v\026.\345\234S\201\277\342I+~\360\244m,z\037\013\353\3447\005"
+	.ascii	"\310#h\210\247W\2660\266`R\273\331^f-\270\333\r\247B@wR\273\331"
+	.ascii	" \274t'\265\025\006\265\033-W\001\304*&0\271\031Ln\326b\243\335"
+	.ascii	"f*9\335\314d\3048\f\265\334\354\005\207\313\315^B\336\307\271"
+	.ascii	"=\261%\341m\317L\261\375\360\243\t\021\304 \035\322\255\225\361"
+	.ascii	"\034\240U\220\3531v:\231\r\300\037\007\332I\202\032#\260\\\032"
+	.ascii	"\002gh\250\203\006l]\273\255\205\355\221\374\027\207!\301\017"
+	.ascii	":\003\n\312\0062 p\002!\242\343\003Nf\350_\221\332scm\220--\026"
+	.ascii	"\315\3159\261V\314\301\005\234\265f\210\326q\265qq\026gi\305"
+	.ascii	"\212\216Yf\234j#\215\247\360\334i\236x\214\305\314\234q\213\333"
+	.ascii	"Z\336\250\241g|\013\330cm\001:\022\203\2471\302Zg\342R\246\b"
+	.ascii	"\004\266D\262J\304!\314\240\001\234\323\266e\276*aoh\237\b\224"
+	.ascii	"\006\231\213\264W\023\354\302f"
+	.text
+	.section	.gnu.lto_rxFrameTimeUs.125.329639e266db1229,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505@o\222\016X\240!I\n\007\b\204"
+	.string	"f\ri\002\316\322\353 B%J\247\331\315\036P\327(\tD\354\214\343B01"
+	.string	"\332\265G\336*c\007V\233XBd\nw8\236\b=\021B80<\300N\224\200\034\315TDC\204\023\024\025a&\313:\321nc\271\213\237\242&U@f\"\334Q\263\212\013\322\267\305\247\365\352\273\237\251\2579\201\022\253\225>\0135\327\361\305\244\023\375\355\346\006XR\260\222Z27J/\271\362TB~\320g\256HG@W\n\030\026v0\322\310@!efpS\202\251\017S\315\324\347<Z\265U\267$]8!\271\\X\250\r !3o\027\306\321]\177\203\277\340\377\b\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.169.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\365\003\365\031"
+	.string	"&\256\244I\300VQ:\264\320BM4\221\242\250JeJ\326\372\247z\034*\277\211\345\347\250\020\303\343zW\rk\032\200G\303\247w7\224O\260\005\n\206~>\3116+\304\314\204\2404\301\325\006Y\016\340\335\276\024$\350\326\310&r\247\024\214"
+	.string	"\230"
+	.string	"\207"
+	.string	",\274\265\332xRRk\031\341\324\013X\247\266\217-\236\006\231\2316K\245\333\315\266\377\343@|Ls\020T\2535X\232\032j\232\252\265\034O\007\274\025\236\316\033\bO7\307i_\205\024\334\311\242\371\223\b\367\363\325\346\276\204L\271-D8\032\2473\265V\021\0274A\260%\005\t\213\210\023\002!\330\200\"C"
+	.string	"\3166\027\234y\0025$"
+	.string	"'\004*H\272\341\345\276O\0278\2409\013\234\265\262Pk\365k\271\033\300m\003\331\266\331;%\325\210:\365x\357MzH\367 1"
+	.string	"\3122\344\264\004E\n\2438ZP\005\206\320\323<P*\025\335\224x\007\254\271R\251("
+	.ascii	"R\214\022\310T\265\22542\357l\213\240\032\216\tH/\204n'\362\225"
+	.ascii	"}\037\311\223\330\242\311\377|0\2710<r\204\256\211\227\342?\207"
+	.ascii	"Bt=\036\202\336\223e\377\231G\347\233\242\376\220\231_\344>\213"
+	.ascii	"\275\331\233z\346\201\262\026\335\230n\304\347M=\003\352\224"
+	.ascii	"\372\"\336\022\025\027\b%\213\210%P\230\275d1\243\203\346\324"
+	.ascii	"\340\264%P\360y\031\254Zm\025\374(\207\372\340\35785\210\020"
+	.ascii	"\324\017\261\217\"%\2446\253v3x5pwO>wR\265f\353\"B\233D\211y"
+	.ascii	"\242\271gb\264?\025\216\252\337\356\316vN\370\375\021\323\025"
+	.ascii	"\333\2442\2019So\"\264]\257y\242\357\374E\351\240l\373\363d{"
+	.ascii	"\246\205\245To\325\250>8\275\357\004~Q4\240~f\230\271;/\353`"
+	.ascii	"\335$[f:\224\231\2462\323`\314\364\212\323S\234~\314\324\321"
+	.ascii	"\324\2505F\025\230\306"
+	.string	"\301\251\221\351\2201\0250\362e\342\025\033_7\t\214s\202\347D\316\r\214\304`s\343\222\351\344\2704\264tl`0\027\316k\345W\315\212\330\270\"6\302r\\;\343+&\033k\f\230\344\261\211\215*H26\212\266\3477\311\341R\227\220\356}\327\260\324\204\202\033\256\013\333\341\332Bm\201V\264!\227\262B\027\201\317\311\362\360A\245\206\340\257\356\221\355\013\217\302@\345U2l\340\300!<\005\3672t=/v:R\343\207\356\316\036\302\335\030-LRv\207K\361\020N\250\221,\303\020b\004!\221\031\td\202\246u\240\002\031;\323\006\021\240-\224F4M\215\232\365\016LP;\020;\243\036vgR\254bC[\234\377dN\362\344\3132\306_\357\033\020D\034\326#j\254\313\315\314\027\261\n.\226}\236Q\270\234\037\036S\301\302\023\240\"zZ\374\335\241\227$\t2\2775\336\003q\257t\202c5"
+	.ascii	"_>\214\b\216!2lD\211&\177Jh\236\317\006\305/\022\200\303\330"
+	.ascii	"\037\204y\262@\245\256\341\260\353\214\346\304\377L\bD\261\362"
+	.ascii	"J\353\31556\312z\2005a\336\342\352\020\307S1\245\243\001"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.182.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\225\002\215\024"
+	.string	"6\345\203I\300\020)\035\330?\373\327\210\034\211v\230-\221\233iBhV\316u\2136l\230\016/\202\220\240$8\221\021\230\207\315O\273\fy\021\031'D=^P\270\377\025EAp\275\0324?\301M`z\021'\250\354\023B\366\226;\245s"
+	.string	"b"
+	.string	"r"
+	.string	"&1\246}\367s3"
+	.ascii	"\210\247\246\250\252\326]\353t7\234\366\225\030\202t\256\364"
+	.ascii	"\240\3712_\211\300M\211\027\036\236\3679\204\213\202\222:1Z8"
+	.ascii	"(oc\316\351\307H3Gj\255\254q\202\234\223\200\017\217\3571pt\346"
+	.ascii	"\210\013\247\032\3268#w\036\310\275\250\3601\332\246\310\223"
+	.ascii	"\206\251\363.m\306\031)\005\334#<\251\265\372\265\235\233u\333"
+	.ascii	"?\266[\266\004\021:\257\307g]\037\333\322\342\224\016\24748\245"
+	.ascii	")\225\236\337\375K\245\345\224~\200\t\264\004\222\253\365\346"
+	.ascii	"\267\243b\240J\037l\337>\017\306f\33116\313+\277\2039\321\313"
+	.ascii	"\334\325\021\307+\355\013}(\346D/^\325\332CCE\255\273\004\247"
+	.ascii	". \236\216\\\004<\235\017\001O\355\007\271\304\004\006\307\266"
+	.ascii	"K\002t?zA9hr\266{\b\001\365\243\253\363\334]Y\257)i\256\004\\"
+	.ascii	"\223oI\206\321o\256nW\356\207z0P<\305\213\003\030\f<\225\213"
+	.ascii	"\200\203NM\376\274\227+p<e\330"
+	.string	"\325\331V\001\277\rz3f\244\016\373GGRY\211\305vG&\252\234\220\216O\003\375\022/\242\371\035\fa&\177;\365g\340\351y7\360\304\024\225#q\243&\177r\0033\005\257\025\030J\013\313K&\213\340\002`\027\211\213\254\345\"k\261\300\030\254\264\\\262Y\213$\304\261\007/Y\253%\026\223\265X\237u}|\336\305\035@HFI\341O\003\305\265\261-\256Ojk[\205-R\256\002\202\033\356Y\244\200\213\202\223\362-\210\3558\201H\333\365\222\277Y\232\360\355|T\266\225\321\345\214\250\211\341\352\252jP\270\311\035\325\355\001\351*\375f\343\277: \240\"\251\272s\3752\206\352\n~\230\356c6I\270\237$\217\306\330\316\306p#\340\261\225&\3102\236\021\304\306\003\r\366E4\222\204\233K\267s\250\345\335\322\"\3648|\341\nrh\217oY\204\365i=n\305\363\214\004\377\017!`\317\344(\303"
+	.ascii	"\333\220b\3058X\266L\236\032\341c\016\371\303\034\214\227;9;"
+	.ascii	"\273k#\244\207\002X\334\212\013\030\002\236\206.WI\247\030?\310"
+	.ascii	"\332\347\004"
+	.text
+	.section	.gnu.lto_setRssi.part.0.185.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\271\001\r\020"
+	.string	"&^gE"
+	.string	"\261&\035\330r\245\344\377\373\3401\357\320S'\255~\216\354\336r\023\347Y~"
+	.string	"3\207h\236Lj\2525\306\206\036M'N\033,y\233\356\357Z_\373$\001\263.\210\017q\360\353\307N\330H\344\223M\244L)P"
+	.string	"V"
+	.string	"S"
+	.ascii	"/q\023\246\313|\216\273.16\273\341\201G\027\320\036\001|@\366"
+	.ascii	"\230\017\311\036\355\223\260]J\331d\323x(b\t\254Z0\260p\354\356"
+	.ascii	"\366\250!n\272&f\362\023\\9]\337z\202+\034\236\001\216u\220\354"
+	.ascii	"\256\265\016w\274\355\004\266\025\330\271 \276\257\342,\354\216"
+	.ascii	"\275\323\370+\036\260\340\214\330\335\316c\215\353\323\326F\373"
+	.ascii	"\260jyyw}\037{\324k\245\341\205@\363\356\237(\371-wl\177\246"
+	.ascii	"t\326I6X\224\207\221Gc(\236\302t\326\211=vA\3140\240=\212`\035"
+	.ascii	"k>,]\346\313pS)k\332\0017w\021\301\207ytH\224\007\037}Qf2\312"
+	.ascii	"\203\252\"\027\364\344k\352[w\220\342\252\241\362BeN\352\213"
+	.ascii	"\025;\266\252\262;\322X\226\326,\235\017\377k\311\342\301\331"
+	.ascii	"\335\220\223c]\342M\314k\336\302\0022X\bGl\177\037'\006'\325"
+	.ascii	"\366\370\231\253\003 \257\344S!\202\270\316\033\2212\220W\362"
+	.ascii	"\201\020\"\221:\017s\036\224nC\3516\t\241\217\311\306u\244\315"
+	.ascii	"\023\342\321\004P\267Q\030\215\272-\217\255\252L\202\322\024"
+	.ascii	"\253\352\213mL}\030\217\361\3710\376p\\\366x\320\206*\246\277"
+	.ascii	"\241\"\003$SO\363\027\"m\027u\320\017) `\20216j\007\2012\210"
+	.ascii	"\224\f\214\256\221\241\301\274\244y\343Vd\017\235\255\213(\017"
+	.ascii	"3\016\367M\203X\f2g\3565\260\345\325Y\331Lc>b\270 2>\017\260"
+	.ascii	"YI\032'f\254v\253\214\310\024\361\026>I=~hv.\3548^\362\344\354"
+	.ascii	"\3546S\266\r\200i\257\004K|;O\bc"
+	.text
+	.section	.gnu.lto_rxFrameCheck.part.0.187.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`f\b\275."
+	.string	"\352P\250\021F`\336Q:k\317\215\030&\027+\202E\342\220\353\331\343\205\0038\266\272\213\233Zpuy~\254Zw\370\036V\326\214Z\0242\260L\232\210\272\262\001S\250+\364-\035\276[\\\211@iZV\215\315H#\204\354\235d\001\001\364"
+	.string	"\002\0017\323\352_\271\226\2575\253\226\2266@\356\212X\024`\226v\360@\353X\260\332+\347\246\203\007\304c\301b*6s\227\003961g\316M\022\353\321\316\206\315t<\0332\035\233Y\371AN\214\230\323\323\266\260>e\033\337\223Y\0316\2662t\262\345\234\033\254O\373\3367\265^\345\005\332\314J\257\276\267\373c\247B|\225\027\275\313\031\310\030[\316\315\005O\273\300\372\224\351F\352S\364E\352\323\356\207u\267\226W\023\273\347\274I$\237N\022\244\2313\347\354{\212\207\234x\226\267[uj\212\342\333#\366y\312\342Y\037\347\241\t|\240F=\356nE\227\230n9\016\347\305\003=\260v\002L\274\226WG"
+	.ascii	"\310\r\036W\277\026\343\2467\251\324q\024M\300t\313\021\244\344"
+	.ascii	"B\215\320\004\211\363\267_\032\312\343\305\254r\013e\3129\007"
+	.ascii	")\221\367\022\275\247\243\220s\356\033\177\274\201\336\335i\335"
+	.ascii	"}\244[\007\027M\352\361\305}c0\267\356\263\273M"
+	.string	"\\\315\2115\347\f\241\017\3674\277\376\221\247\035\325\336'[\365\351q\030\025%\3141*\306\373\274\030\254q\357h\306B\272\331\333K\350m%\336\355\244\3656R\357\366\321z\333h\275\035`\275]\364\346O\204\336\006\320\273=\324\273-\304\273\035\324\273\r\204\336\356\235\354g{\267yW{\357x\267W\366\266\216w[\345\335N\321\335m\274\336\276\272\333wB\227L\021b\346\334\365\364\223\277\322.I\256\366g\371\321~1\177\333_\346gz\210\346+\\(\222>N1g>f'\253\036\242\315\016@\336\222`\242<\325u\277O\346\255\3312nA\267\340\325\363\314\221k\263m\337\322\007\3631\315\212\321\n\323mL\307\241|\f\262\306v\374\242u\263\376\227f\275t\033/N\256\315\213g;\227n\266\255\276\2451\027\263/\246\230\025\356oR\211p\021F\332\232\201\026\203\371\234sV\261\324\235\201bY\030\331\033"
+	.string	"\270\357\347\346'\343\234>\204\001\340#\277\ba <\204S5d\216 ,\204\244\206\006\3650\020>r\356~\376\007\213X\245B\005\365i\017\237\311\262L\312r\300e1\017w_\300p\237l&.\\\354\035\346a\t\317'r\356\027\240\256x\207:\237{\220]\3305\325\341\356^\360=\031nF$\347\034\241\237\347z4l\340p\016\352S%\263d\234\212u\330\207\031r\356>\250\242X\305}\221K\374\016\303\325\245\004m\272\0075\305\177B\346\246_\347v<\364\2174\b((\365i\212w\3109>\313"
+	.ascii	"\367f>\247}\032\221\234\215O\312\301\030\305o\362u\304\305\356"
+	.ascii	"\036q8%\336`\374\267/\3303'\245Mwk\255_\031\301\323?\263\263"
+	.ascii	"N\361\376i\374\233s.b\fv\337\244^\374\265\213 +s\274}Z\350\371"
+	.ascii	"|\376y\315\202A;%%\364QUMMUE)\005\255\204?!\210v\352\007T\301"
+	.ascii	"\376N\\\024'n\212\366J\252\215j?\004\203VPI\005\203mT\025\260"
+	.ascii	"\003U{%\005|\372\t\177Om\320\n)\b5\374\265h\237\262~\033Z\374"
+	.ascii	"\250VH\201\310\372\220\242m\251\216~\302\026\355\023Q\020\252"
+	.ascii	"\235\222\n!\244j\201@\253(\240\216b\220\005\364e\001}TR\277)"
+	.ascii	"_\0240\350cP\324U.Z\240OXU\005\364\261h\306B\272)\030\361\026"
+	.ascii	"\273\244\340\366\3100\341\362P\302K;\224\360\313\212,\215H\222"
+	.ascii	"\3143<\f\026\367$|uu$a]\321L\rsl\271\303\361\037K0N$\254D\215"
+	.ascii	"'\302H\370l\313626g\314[|\027\214e[\024<F8\26402\326\241zt\177"
+	.ascii	"\3240R\274\223\346\315\b\037\341\244<\3109L\204\215\360\271\034"
+	.ascii	"u\262\246N\033\2243%5\002\340\261\245\021\3530\230\214'\241\354"
+	.ascii	"\320\224\305a\212\341\301R\221XR*\b\227iN<E\270\357\361r\275"
+	.ascii	"\b#\216\021\307\324\247x\215\215\257\200"
+	.string	"\260\250q4\350\f34$3\222\244 )t`\002\021\252:\326\001\021\200\265cU\232&[\007#\2064\230\243va\036\370\227Ab\254\220`\376\232i\251<\327\035\n\350z~\300\316\364\240(\360\306\304\237O\203B\016\247\251\353\354\367\241:Q\354l\314\260I\to\204\003v2?FB\243\227\276W\354#\352 G\004\361T\364B,\3508\"\213r\2067!\036>\"\353@n\350\311\240=T\213\307\334\341\252s\217@\310\316\364\304\340\372\373\n\334G\206\023\302dA\031\001\302\2476\036\265\257Zy\214\357\254*\005\211\030C\346\341\005KS\336\321\242\2125\b1OLR\312\204+QZ%\340\377#gf\350<\361\035\314\016\032V\344\365\021?\222*\315\006\267\021\253\240\021/\f\331\353\024P\305\365\3076y\244\270\270\263\246\277\322[}\326\215\002\305\215,\264\275\254C\261\003j_oZ\310A2\030\007 "
+	.string	"\255\363\003\257\034-&\276'[\215\013>\271A\273\177\304;\205\263"
+	.ascii	"?&\212V\002c\203\221\211\275w\243\366\347\225w\264f\353\3366"
+	.ascii	"\\\372i\200\033\222\007u[\013\360\331\3408\035\333>0\323\340"
+	.ascii	"\375\022\367m\246K\246g\366\226!\333\240\005\326\247\2668\263"
+	.ascii	">#5\205\037Y.\r\031\"\354~)=~A\271O\366)*"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.188.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\025\013"
+	.string	"\226UK=0M\225\016Ch\324\234f\374a$\335h\331%a\216\0210z\376\311Q\321\356\247\203\006\3330\206x5\364`\030Vup0w\r\036\030\230S\373\2251\026\225\231A\240\306\266\267\224)\0058"
+	.string	"8"
+	.string	":"
+	.string	"\306p<\332\307`\333Crg\233\370Wa/P\031D\034Z\273\233=*\205w\327\204\235\377\357\017\257\364\271BJ\r\236\026\207\025\003v\327\016\007w\274m\212m"
+	.string	"\366\r\004\216i\b\323\n\323y\325\377GB\020 bw\364r\355\204\030\342\202\355\333\377<6\206Y\363*O(\236\247:\377vD\262\246=\241tOu\254\273\022P v\277"
+	.string	"\217\0016\202L\336\203\252-\326\203UH?V\3655|\203\346[p\002.\357=\372\\\343\361(\274\023\371\214F\252\352\031\270B\371\36255B\342\303\bQ\nP\276ROVx\270jr\030\216+\260\341\b,\260h \256H8[\306\3312\r\346@&\253l\\&\211X\333X\266L\201\246m\031f;\017WMv\260\"\254@\032R=\331\206\352w\270\207\212\345ri<j\t,\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.190.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\353\001E\021"
+	.string	"\226\037oG\360\262&\035\222l@\ffe~V>\rE\300c\375Z{\026\271_\016x\221Ae\304lD4N\332\2641\362\336v<\177\004\206\016lf\221\252\030b&8\3603%LE\3349\006\003F\216Tm\221l\"eJ\001W"
+	.string	"Z"
+	.string	"]"
+	.string	"\037L\374\354\306\022<\272@\350q\364\001\333\243\366\220\355\221{\374\215m\227\fV\3316\036\253Y\221\233\n0<\263\335\355\036\225\346\252k\232Q\345\203\230D\256\327\352Z\272^\032\256\001^-m\264\273\327yRx\2612\005<\202\230v\327\241\r\367v\333\013l+\260\363\024\032\323\031\323\027%\214\204\263\213!\250\307\306D\0306+\2542j\305j^\337\221!\303\231mkI\266Y\254r\222\240\321\214\270\3613{|\316}\025\347\2619\263|\307#0\037\022\273\313\261\334?\341\342\353\230\263\375\034\227\307Z\362\264/\034H\217\316\264\217\342)T\217\265X\264\033W\3314\365p\241F\016\016\0323Z\311\303\252\232\212\350\200\371qMU=\317\r\204\260\261"
+	.string	"\323#\202\225A\346\322~\360\345]\251#\226\256\354\267\270\213\026\037\204\301\223\274\353\321?\331\036\257#0\237\022\035^2\210E(f\021<\036\330q#[\245\217\324\031k\274\266*coi-\246\003vPB}\251\224\316\004\374>\320#\200\302"
+	.ascii	"\365\245HRLPa\030\301\003`\257\264\022v+ag\222j\360u^\210\322"
+	.ascii	"\225B\fB@\205]\n\b\206\035g;\257\255\312X\347\237\260\003H\366"
+	.ascii	"\242\254\030\351\262I\323\031{\233\377\363\027\036\252\244d{"
+	.ascii	"$\201\371\314r\350swW\25236P\217,- p\202\031#+\017V\216\301("
+	.ascii	"\211\241|h;m,\312\206\255@k\214\310\2026\026sm\344N\301\tX\327"
+	.ascii	"<\366\226\3700>\275\026\212d\013\033\237\324Z\311\004\n\367Z"
+	.ascii	"`\323\210\3020?\334P\n\302 \240\035\346\360<&\2463\030\323.\255"
+	.ascii	"\255\262\"\335\035\272|Nk\241-e\305\300H{\005piO9\267^\213\307"
+	.text
+	.section	.gnu.lto_setRssiDbm.part.0.194.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\370\002\345\025"
+	.string	"&\251\212I\320\322(\035C\005\252x\006\200\316\005\316\020dG\266H\340\023\026U)\036\232l~\212\006\300#\313`:-\340\006_\r\251W\353\\\354\273\362\225\202sp\005I\227\203\\\217\324\300ep\352\001\213 \217\376/\371d\023\271S\no"
+	.string	"s"
+	.string	"t"
+	.string	"\233\353`\362\351\020\3479\270\353\264\030\265\373\241F\320n\2605~\016\bUV\371\340\35576\031\334^\317*\355\2378\n\334ol\236\27326A\273[\340\323%\343\247\310\003\210\237\362#\342\247}\240\355[\3178\373\306\203\"V"
+	.string	"\320\007O\207\307\356\266>5\304qW\031\342\374\227k*\303\206K"
+	.string	"\017O(\273\353\221\303=o\333\200\355\004\266n*\255R\351\224J\243TzT\351\223J\213'\351\251\322\241(\255*-\037\374O\"\177%2v14\375X\231)D\342>\0072\311\005\013kb\333\226zY\360\"\003<Z\372\374\316\325\276\277\342?\266\312\265\253\360Y(\370\345\250>}zl\343\006\215>\240\217\245\3355\371\254\275\307\226\332\347r"
+	.ascii	"\217\226\016\214\265\373)n>\217U\266\277s\273N\213l\020\036P"
+	.ascii	"\032\34308F=)J\277\373\351^\034\206\211^\036\362\220\3709*k\204"
+	.ascii	"OT\251'\2256v%t\262\311SE\226\273\260\215\273\213\300\037:\021"
+	.ascii	"\314\257\371t\204XL\374\234\212\022R\r\365<&\277\305\205$\370"
+	.ascii	"5^\221\311\303|\3722\361S\365?\237\032bt\364\360]\245\236\347"
+	.ascii	")HJ@<\246\234l\222Jc\r\037\256\316\330'i\226J\203\210\322\253"
+	.ascii	"\260\232\212\213e\302^\263\232\214&\302j*.\007+\020\030\304h"
+	.ascii	"\264\331\312\257\023\227Y\313e\326\232\020s\255\264^3Z\353d\304"
+	.ascii	"2\n\260Y\253\202L6k\311\353\214Qr\252\263>\334\335U\245\261\315"
+	.ascii	"R\237\306\223l\017\\.\361\363<O\001\241\004\004\242,\275\bJA"
+	.ascii	"4\205t\304\2633\261\322\031*]\251L\3421\205\334DbJU:\213x>\002"
+	.ascii	"\0175\245#8FM\273\237\316\310\026\242T\324\213\331a\023B\250"
+	.ascii	"q4\346\210\024\310L\211L \225\304X8p\002\031+\244\007\020xG5"
+	.ascii	"\313\030\303\002\241\241G\375\302]\021\335j\\\370][>'\026m\276"
+	.ascii	"\026\0013f\351\006\301\244\231\tH\272\021\327\227\272\250\264"
+	.ascii	"\247\022\307\270\0132\362\371.~\353\016\t5\210\033\205Rzt\224"
+	.ascii	"|\241\263{\276E\300\026v\265X\222e\243\307\020\203\300\"\222"
+	.ascii	"\200\376K\233\0164\337\3124\"\262\334\265\253\r\336\303<\273"
+	.ascii	"CT\371\316\254\223\365\366\335\002\305c\305\330w\360\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`>\t\255!"
+	.string	"V\266\300=P\246J:W\337\375\215Y\312}\250\276\223\331C\037\322\333\263qNi~\314\275U\303UOl\b\376\357\256\373\252\252\252J\020:\ta\365\277\001\020\270(\0058Q\366D\240F\332\336)\005\260"
+	.string	"\252"
+	.string	"\257"
+	.ascii	"\016\244Xk@\035\216\223c\375Gq\230\356\306:\220\215S)k\330\016"
+	.ascii	"\r\337)\315(5q\1773\326\200L\031\353=\032\303\n\306\323^<L\351"
+	.ascii	"\342`Z\354\345(\213=\234\025\027N\025\3737\0170\234)\366o\024"
+	.ascii	"\205\371\324d2\371\350\304\232\220\232\370\026\004%\366f(\t\013"
+	.ascii	"#\f'\302uB\254\031Q\020\226SV\363\203\351x0\236\237[\f|W\332"
+	.ascii	"F\320\340gIU\246pQ\2075!\363\355j=\210\303\332o\303\272\217h"
+	.ascii	"\036\217pnC\3234M\rk\276\003\221\316\3762\254\375\320#\\\033"
+	.ascii	"{\355;b\367`\033\032\036\206\365\036j\273\211B\037\333\227]\314"
+	.ascii	"qa\306\003\263\236\362_\316+m'ZI\220\374\310\342\241u#\313\210"
+	.ascii	"\003\377\344z\026\353\225X\326\226\350\225\257\225\367\272Zi"
+	.ascii	"e]\251kM\251\312\272\220k=\351\\K\242\262\206t\\?\372\326\332"
+	.ascii	"\321\244\233\353F\273^\224\234\262\036\244R\\\027e\357\206By"
+	.ascii	"\226\262\232O\216\245\254\246\223_i\262\026\244L\336e\311\321"
+	.ascii	"J%?+\223\254\025!Y#\242\020*h\255\017\321#kC\324\210\355\312"
+	.ascii	"\"\236Cd\317\206\016\271\227\220[\tr-%\220\203%\372\261.D\253"
+	.ascii	"\351\303sY\226+{\254\005\361X#\351\216\r\347\237b\315B\002*V"
+	.ascii	",\344\207\221\326(r\240b\205\242\023p\276\262),$\350\277be\022"
+	.ascii	"s\251d\032\"\335\275\350\313\356\310\323=}s\336+\002\340r[\223"
+	.ascii	"\362^\261\356\210\252?\375\n\364\021\250D\266S1\022\264{\202"
+	.ascii	"\252W\336{\252?\371\236*Q\314\207\246\037\247\312Tv\272\206\f"
+	.ascii	"\230%\342\260\351X\022+\361\374\315\324@\"\263\036\261\236\356"
+	.ascii	"/\\K\332\271OY\331\366fk\3730\265\275X\332~,\314\276\013\314"
+	.ascii	"\276\312\227=\227\227u\262\313\336D\333o\235\355\217\\\366^\314"
+	.ascii	"\366\\\312\366_d\353K[\366_\264\354\311n\232\246]\fVr7"
+	.string	"\374y:\330\206\226\307~\276\243\006<\2476!]W/\027u\374\317\344\235\351\343\3448\365\2017!\036\034\265\002\246\253i\216\363\\\265\240\347\352\363\0347d\n\264r\\mb{\325\333\030\241*\253z\266G\030\224&F\240\252^\275\326\351q\215\231pB}\331\267$\f\211l\247y\036\001\252MI\250\304@\342Te:\376c\314\334\216\306\251\212u\236\201\242.9F\032\253\016\344\235\336\032\241\261 c= w\2520\2761(c\035\020\370\013\310\255#\224\261B\311\335\251\255\320\013\312X\003 \313<h\254W|\306*\345?\243\340\202@\005U\n0A\005\022\200\235\250a\024$EF2R\224\244 i\r\240\002)*\3426\021\260\224\205\314\020\021\232@\002\thH:6\215\316v\033\3244\261\366\235t\221\3174\005on\273\215\335\251\312\253M\204I\253\242\271\313\nX\004\206m\363\203\245)\215\324\016Q"
+	.ascii	"\312\317`.G\261\245!\231\341_\275\207\\Lz\272\t\344N\204bDw\032"
+	.ascii	"\017\335*\227\272k\355Rw\255]\352\2565np\205\274\004<&\321\374"
+	.ascii	"\342\223+<\203\265\034:>H\371\023\321\353?a\020\322[\262W\302"
+	.ascii	"^Kv\037\327~\201!\020\314_\233\275N\016\fw\035l\234\333\205\033"
+	.ascii	"\004Fr\202Z}\251\004\371b\fX\257\\\265\326\203\367\254\233\311"
+	.ascii	"{\255\203\261\351q\005\201\335=\273\233\033\376)\020k\240\217"
+	.ascii	"\251\222\234~\320\254\340\277\201\302\303\230\277\305U\227\240"
+	.ascii	"\247A\3366\360\210\r\271\023.\177 \324\346ch\213aqf\b\t\034|"
+	.ascii	"Z\342\367\246\224}Q\312\333\021\247\\\r\315\230\233\035\205\337"
+	.ascii	"\204\306\024:!\346A\013\334\031.\005l1\270Y\030\354\210\350."
+	.ascii	"L\373A\f\365Y\211\237/H\005"
+	.text
+	.section	.gnu.lto_.refs.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\034\002]\020"
+	.string	"vks<"
+	.string	"\255(\351\360\222\332\025\220\2718\003\374\377\377\377\377\377\377\377\377\377\377\377M\237("
+	.string	""
+	.string	"\200`\222$H\200\004"
+	.string	"\344O\250\"\037\344\320"
+	.string	"H\376\003\377\b\265\222\337Z#l\266\221-S_"
+	.string	"b"
+	.string	"b"
+	.string	"g\336c`\337`\277\300~\301n\301\356`\001\\\234\231\350\232D\307@\375\n\365\027\372\n\364)q\304\373}\206\310-\237\356\266z\362j\353\331IN\256m>\213\377\336\347fM5\366\336\312\214q\307\255g\332W\361\373\276Tw\262\327`}\273\362\013\3141\370\360\345\020\346\226\367\371\266\256w\020\001!\215\347d\274\246\242o\357\343{\254\364\027\366\260\324\035\351\001\232-\247w\2461\362\226\276\350%m\321\377\220\365W:p\350\344o\320\240\3651\274\037\005\346\243\274\374\023\370_\210]d\364\032\243\317\030\375i\364\246\330\003\274'\275\247\250\350\240\330!D\375\003\273\247\312=\260w\\\336\201\235\2239\007\366\rl\361\222\236]\362\030I\207$o\031\351n\344\253-\222\375\331:\347\243c@\372\026\322c\310_ \377>>"
+	.string	"\257\266Gnu\344UG\236\035i\300\375Lo\235z\005s\007\277\247\013X\336D=\212\376\332\350\026\307W\034\237\033_S\t\274\317\220\352\243\304\377\004\365\227\224>${\217\3303\342cT<\305\373\237\257\344\225\026\\s\017\271\311\n\216B\327V\371xJ\277\254\322\341)O\260H\350\205G\350n\242\020\362A\357\304\016\332\240\262\336w\233A\265\240W\332;\255\n\334V\252\027u\202\\@\252\227HOB\275\205\251\217D\244\036\332\344A\246.A\352\021\233t\317\251cN\237\245\372C\275\005G\220\3313\3229#\277\321\220\364\026"
+	.ascii	"zF{\t<3RJ\340\251\002^\2038E\217\201\021\026c\254{x\346\236\323"
+	.ascii	"~\207\030@0\246\236\305`\3130\rp\231,e\f\030\004Z\026\"\031\354"
+	.ascii	"\364\246\351aZ*\n"
+	.text
+	.section	.gnu.lto_.decls.329639e266db1229,"e",@progbits
+	.string	"(\265/\375`\354eu\241\001\332\253\276\224R\0200%\3554\006SY\005\016\325\005"
+	.ascii	"\343\366&\317\212\340\337\372\300\237\270\275\301tw\361\3140"
+	.ascii	"\005\032\253\231\250\216\212\264\2721\004\366\372\004\362<\341"
+	.ascii	"\372\314\304\307\341\256\344\335k\026\372\213\264\205\224Rw\254"
+	.ascii	"\332\277\026\\p\200\315\257\005jr\357-\245\224)\323\007O\t\227"
+	.ascii	"\t7_\255\241\037h\347\376\017Q-2a\334\322B\340\230\361\262\024"
+	.ascii	"v\363\177\321\210\310\221\275\270Y\317\376\235\361\272K\327E"
+	.ascii	"\026/=+8\346.\335&=\300@3d\312\b\202\tC\350e\365\354 _\336^\341"
+	.ascii	"\013,\227i\357*E\271=\323\334$kW\265\20000O>1i\254\236\355\033"
+	.ascii	"\344s\262h9\350\336WZ\274\236<\325=-\337O\242j\355\372\270C\356"
+	.ascii	"\222[v\303n\217\233\344\236]\263\333\274N\256\326er\263\256\222"
+	.ascii	";v\233\334\255\213\344:/\331\375q\217\\\256[\344z]\261\333u\203"
+	.ascii	"\\ \367\353\032\271B.\217K\304:/\330\335\361{u\261\236\233{3"
+	.ascii	"\335%(;GG\242\306\245\301v\227\256\214*\027\354Z]\035\326\256"
+	.ascii	"\n\205X\331s\357\375\022\027\314\342\331/\330,J\2479qz\222\270"
+	.ascii	"6\236\\\026RQ\230\304\260r\247~\022\227\nJ^\f\227F\033 \214+"
+	.ascii	"O~{\267\305\205\327\230'\032\022\367\306\002\304\324\236{7\227"
+	.ascii	".\330ma\321\254\335\217\007\220\345=\367n\336\2329c\347r\360"
+	.ascii	"\336:\304\230\370\300\304\005\263h\354\234\265\253\332\230\257"
+	.ascii	"y\206F\330\336M\016|8\310\341\333\363\003D\221q\323\366\244\""
+	.ascii	"\b\352\253c\216\205]\201\nV\b\345w\363\305A\3427\007O\032U\325"
+	.ascii	"\334j{o\035\f\240\310\275\335\254Z\236\364\251\237~j\247\237"
+	.ascii	"F\321O\235\350\247YwF\246\201\205\307\220\233\237\336\320O\223"
+	.ascii	"\364\3211\372y\266'=\n\247\217\242\351\243c\372(\021}\024\210"
+	.ascii	">z\245\217\326\320G\231\3643\030\375\254E?\303\351g'\372O\333"
+	.ascii	"\223>\013\321;\226'\275\240\355I-\241-\264N\237\273\267\216\335"
+	.ascii	"\262\004\205\343\346\347\036\372\004\333\372\244/\264>\351\363"
+	.ascii	"\r\375\354\244\217\301\350c6\355c{\322\343!\372\230\206\016a"
+	.ascii	"F{@E\213\260D\377\022\321W\333\241/%J\277\212\355I\177\267\376"
+	.ascii	"`y"
+	.string	"\322\333\331\236\324r\261]\2543\204\3652djn\347\336M\235\241\227\277\034j7\337\226\321\267!R\235\302\302\302B\033\"\275\275\242o\235h\017,O\372[;-6N\310\224\341h\206\0202\204/\013\026|\004\312o\357\346+,x8\267\334|\013D\377\267V,\235u\332:K\3056\367n\356\275o\242\212\235\313I\332\331Kx{%>0a\353\354\024;\207\233^j\232\226\336s\357\246\017\007\034\350`\025\3512#\315\267[\372\366\205\266p6\316:=X\271\177`\3428\251\311&\333\273\251\203C\250\204p\360\346[%}\353!\265\205\326C\372\022\350\337\276y\320i\322\210\261u\363o\245X\267\033( V\306\334\034\305\307\206\311\016\275\246\233/\244_\242i\321r\224v6\323\222\240\327\336\315\377\226\315B\261N\333f\323n\325\354\223\337\346\336\316\275\367-\223\237\304m\233]\263h\270)e3-\3355"
+	.string	"K\256)\207\340\336M\016|8\270\241\261\246c0\315\207\200\376`{\322ly\322w\240\255\231mb\235\033\330\263\3332\313\344\250Rs7\367n\352\\\2564O\234\334\374\f\364\255\223\347dm\023O\365\355\006).,\264\033\244\277\372Z\236t\307\366\244\277]\362\3331K\266\001vz\272\332j{73h&86\262\233\337\264=\251\266<\251\345\372/\325\3450\b\027\312)\303\217f8\243\242\004\205HG:\177\006\363_3\254\376\271\347\002\346"
+	.string	"X\343U"
+	.string	"\301\377\r0\034\013\250"
+	.string	"\376\324\006\303\310\031\034\263\226\263\213\202\356r\030\204\016r\\\2775\201\343z\310 >\200\374\341\317\030\344\0166\013\b\304\237\313~\273\255\212\022\376LA\356\371m\006\362\206\337n\340\267K\226\003\231\347\317\032\260\005\357\371S\023\226\005\003\374\266\305\206\377g)\001\260\206T"
+	.string	"\377m\221qX\2406\371\346\307;)\210\001`\034\n\376\364\202\337\212\360g\233\337\216\370-\211\037\303\275\202\377\025\370Y\317\177M\220k\376\033\001|W\202\3777\177\036\374\177\206E\220\207\b\210\361\016\367\034\376\254\365\337e\326\277%|\315\237\365\236\177\026p\357\"\263\272A\3361\323\331\013XB<4\355\267}\377\345\254\007\334\344\277>9\315\350o\237\034\370\257\202\237\223\377\302\345\274\342:\t\372\255\n\313\002\n\204\310\027\n\330\314\177;\2201\227\377\256\345\373_\256\037\203\375\331\376\227\303 \330"
+	.ascii	"X4E\360\022f\372\363\357\323\341\003\300\205?\036\304\200\277"
+	.ascii	"e\341\f\370Q\030\377\3450\b)N\340\277\377n\0228\373m\n"
+	.string	"\254\364\373\255\001\254\210\037\367a8\213\237\017\361g\251\037\203 \314\332\263\\\313-!\303\370Ow?\200\301`\270\273\246\3756\013\357y\340\202?\217\375\030c.6\310u\273\034\006\341>\377;|\303\237\016q\027\336\177\025n\231\315\217\236\340\277\nW\f=\372o\013\377=\376x\313o/\360\333\301\237\305\370\257\240=cY\270\206\037\005\363\337\b\334\375\027I\321\217}\374\367bw\364G\215\377-\342E\264o\226\005T\003\226\004\277\035\341\307S\377\315\200\265d\371q\r,\277\r\341\267\204\370\312o\021\360c\035u\277m\373-\331o\307~\253\366c+\277\205\362c\272\377\372\370\357\017\\\305\304\177/X8\353\307ZT\256\n\313\301o\321`\020~\273\177\253\002\317\375\266\351\267+\226\373\255\t~{\304q\277U\372m\362\267,~{\364[\r~\fw\325\023\374\026\206\377^|\202\377\352)\277}\341\267M6\370"
+	.string	"~\273\374\337A\016\277\375x\355\035\370Q\005\374\327Z\026J\220"
+	.ascii	"\374\347\243\377*\\\373\374g\243\333\323\037=\300\177\272\377"
+	.ascii	"U\376_\351\360\177\003\307\362\341\2379 \224\206\321x\374_\373"
+	.ascii	"\337\366\377\354\033\370\357v\365\317)~<\201\037\243\360\343"
+	.ascii	"\n\374\230\002?F\361c\t\3748\305\217-\360\337\t\374\370\003?"
+	.ascii	">\373\261\211\037"
+	.string	"\227\360c\023\376;\200\037;\377\357\374\251\222\037;\3711\330\217\277~L\344\307B~\034\344\307?~\274\365\343\035?\256\3721\325\217\241~\374\364c\246\037\357\037\217\340\307\313\037\267\360\343\240\037\177\340\307\035\370\261\n?\376\371q\006?\376\360c\017?\266\340\307\024\374x\303\2175\374\227\305\217w~\214\363\343\232\377\226\340\277\314\037\347\037\253?F\377K\370\337\301\377\n\3767\360\277\317\377\362\375w\357\277\307\377\342\375\367\356\277q\377\245\373/\225\377\312\375\327\355\277P\376\313\366\337\264\377\236\375\327\311\177\315\376[\366_\261\377\"\371\257\221\377\026\371\257\327\177\207\374\267\353\277@\376\213\365\337\035\377\315\361_\253\377\332\370/\215\377R\3757\352\277N\377=\301\177\221\376{\364\337\344\177\205\376\353\201\377\022\377\013\364\337\f\374w\205\377\252\370\257\005\376\213\302\177S\374w\002\377E\361\337\022\376\333\200\377&\340\277 \374\327"
+	.ascii	"\377\035\300o9\360\333\365\267y\277\375\372\357\375\255\333o"
+	.ascii	"\261\376\353\341\267`~\013\343\177\226\377W\376G\371\357\005"
+	.ascii	"\377\275\374W\303o\235\377\325\377U\377\213\376\027\377\327\376"
+	.ascii	"\366\314oU\374\226\205\337\022\3766\310"
+	.ascii	"\377\263\377r\377+\360[4\277\035\374-\231\337\006\376\026\360"
+	.ascii	"\267~\277\r\363[\275\337v\371\355\333o\245\374\266\310o\275~"
+	.ascii	"K\344\267C~+\344\277\212\337v\375V\353\267Y\277\275\372-\324"
+	.ascii	"o\237\376\247\370\255\323oQ\370\255\t\277-\341\277\226\377X\376"
+	.ascii	"K\371\357\366\237\354"
+	.string	"\277\326\377\272\377\006(,,,\374u:\360k8\361\227\260\200\201\203c7_\003\032}\r|\372\317x\316\214\227\275X\251\275\225r|\200Kr\361\304T\226\275\374\231K\356b\261\3301-\274\274\334|\257lO\252\201\345I\257AM\377\371\356\326\231\357\262\216\020W\233J\203\2677\260)\250\231\026YJn\276\206\"Vr\026+YK\272\267m^\311\210\322R\303e\326\204us]]\306\242\223\322\035I\177~a\371\3123\026\213\246\276\330\322\254\241AK_C\f\375<gs\025\353\314U,Z\210\255\244\244\001\330\335\237\237\240\006'}k\321\322?\313Yg\226\303\205(\266\222\224\bJ\222\252t\200\265\242\200\311q\3633\244\201\203\303O(\232;\251\303X_M\217\255\033Jd\336\336\262Z\016\325*)C\236\376\263\2333\273\3319\017\324\265\245*\317\035\325\354\340\031\350\240@\301OC\247\275\245D\030\273\313"
+	.string	"\247\377\274\346\314k\231\315\002{\367\260Z@\331\035\216\235\226\276 \231\355\326\315^U\360"
+	.ascii	"\266-\"_iiY\355\303\336\273i#\001\202\255=\037\370\254&\006\335"
+	.ascii	"bd\310\332\315\317P\243\331\314g\337\331{/\355\255CGz\344.\312"
+	.ascii	"\371|f\023W\005I\335\315\331\31105\033+c\246\t\032$KJ\227&f6"
+	.ascii	"SKdvS\007O\214\036U\0312\262\314\304\356\275w\325N\352\363\240"
+	.ascii	"\356\353\317Op\3113\023\234\263 lKE\202\210\321\265\360\202\004"
+	.ascii	"I\026[c\321\246\344Y\f\357F\237U\330\377a\207\261\031h\302\222"
+	.ascii	"\344\334\341\t\212\271`SWj\314\021!\222\215\334\275\367\366R"
+	.ascii	"\323\316\310\236\273*\206\020\177\006{6\342\206\003\253\244="
+	.ascii	"\335\234\275r\221\377\303\033\263\027g\352\212\344\257#=\252"
+	.ascii	"x\345\235\303\205\360\305\334\315j?~d!;{\251\213\r\257aS\231"
+	.ascii	"\213\264\256g!BT\342\234\270\376\017=\300\326\242,s\345 2\264"
+	.ascii	"\270=\271Bee\317\t\304R\271)\003\305\256\360\346\357\360\320"
+	.ascii	"\317;\362\3253\326\261r\017\275\367Njn\031>e}\177~\202\273\252"
+	.ascii	"*\004\232\266\344\305\231y<\367\270\230)\177X\316\233\037\230"
+	.ascii	"\267\272H\315\005\331\322\212\342\242\304J\224\264\211\213U\316"
+	.ascii	"\262i5\177A\374b\270\371;,\364\177\373\373\247[)j\357=\2056w"
+	.ascii	"\324\322M\372\333[\324\332\020?\216\3056\203\377yo\007\230`\357"
+	.ascii	"\245B\257\275\267\005\324`nJV\0376j\2677SV\322\003\262\244\230"
+	.ascii	"\262j89\263\244289\263v\022\323\220\244\fQ;+\311\311\271w\006"
+	.ascii	"&\246\244\023WRNN\245\235\301\311\271\2456\213-Rv7\263\2226\323"
+	.ascii	"\325\316\260\231\266\322v^I}pb\312\222rr*IeprfImg\326\336\331"
+	.ascii	"LJQ.\230vT\206\355\314\352\333\316+\251\035'\347\225\224\223"
+	.ascii	"3\253\314\266\271(\024\243\"\364\362\201\306&91m\250\0308\224"
+	.ascii	"\242v\354\234\232W;oo\253\326\264\243\266\335\336\031\354\215"
+	.ascii	"\343**O\251\206\225\262d\007\265\324\246te\233{o\0161\226\264"
+	.ascii	"\2566\223]\222\335vNF\256\3666\262D\264c\354\2757\bIM\273\r\304"
+	.ascii	"\332%m\341\330OM{[\260\233{\307\330;\311n\273\275w\322\336[\215"
+	.ascii	"\302\321\334\373\306\216\223W\214\030{W\371\304\3308\222\336"
+	.ascii	"\232\366\276j{R\244\234\234ZW$\336\320\234^\273E3\311:=]m\257"
+	.ascii	"\235\227\025\245\235If\373i\357m\377\264\227\024\225\337\315"
+	.ascii	"9\207*\004\312\334\363\346\353\270\351g\0336[Yg\266\3126j\242"
+	.ascii	"\"\260\204\343\271\243ptPC#HR\232\233\257\303Dg\033\272I\347"
+	.ascii	"\307\006C\031d\\R~sOv\220\231\361\\\365g\032\271\006\356c\001"
+	.ascii	"\007\355L\211\313\315\366\207\355I{,O\232c \361<C\023\316A\001"
+	.ascii	"\271yC~\341\314/\362\024v\332JY\036\034\301\212\352@\312g\205"
+	.ascii	"/Lj\334|\035\034\372\366I\214\273\345\f\367\256\262\304+Ce\030"
+	.ascii	"w\313aj\356\256\364\213\331\231(\301\275\367\377\034\225eXg\206"
+	.ascii	"\312O\317\315\315\001\007>C%XaMi~\016\241~\216\237~N\030\375"
+	.ascii	"\034,\272\271\241*\tT\213[gn\201\303\240\270\332S\005\370j\236"
+	.ascii	"\241!\270wU\0078a\254r\240\350?\263pf\026yi\350\264\367T\210"
+	.ascii	"\262\257??\301\035U\325\301\215\330s\215\360\346\347\004\321"
+	.ascii	"\177fZ\262\351\022\363\272bed\361\312J9)\320j\251\356\346\274"
+	.ascii	"\233(\323\230\333\332\315\317\261\001\205\tU\037gS\315\233\237"
+	.ascii	"\363\324\264\221\242\343I\fh\360`\222\027'\327\315X\020\233\261"
+	.ascii	"\316\313\3413[G\207J\340\016)7?gk\244\275\367\266\227K\325\313"
+	.ascii	"\245?.sE\207\251E\224<2>8`\320`\311\022\b\330\006\307\327\005"
+	.ascii	"h\321\2545\003\342\344\373\363\033\213\241GWs\3706xd\306\315"
+	.ascii	"x\f~\036\367a1\270\017\204\253\275\225p\237\016\232\275\225t"
+	.ascii	"\254\005a-\210,\246Ed-\315\307\031\344\303a\270\242j\354\335"
+	.ascii	"\214\301\370\350\314\335\b\344r\363q\236\372\307{z.TU1\311;\326"
+	.ascii	"\343\262W9Tga7n\306_H\034\347-\200kK\354f\354\345\370\016\356"
+	.ascii	"ES\230\233_\302\n\033\225(O\252@aB\327f\207\263`,X\013\346\202"
+	.ascii	"\361\360\026\334\305:\361\035\256;\276b\363\370\340\254x\001"
+	.ascii	"\316\341;\034G\347w\207\345\300$\211"
+	.string	"\301\351ae\307i\3107\226'=\216\231>\016\021}\034*}\034&\375\233>\375\233+\3727O\364o\276\364o\252\364\217\247\334\251csZjoX\212q\353K\311\315n\315\266\275\267OM\030:1\"7\337\206P\277D\023|\226\303\264\263\231\264\364p\0336c\303k\370\t\206\202\243X'n\303h\277K8\255-O\r\237i\361=\333\260\021\234D+\314\223L\033\016\303M\334\364\3220\226R'VxPn\362m\002\265\335\266'\275M\235\023\354\034^\335p\242t\363m\340\234\330\264\351\333\220\225\335\320h\322G\343\346\333\b\301K0\231ub&Xl\f\213\027f\202\225$\365\2010f&6'\210:\t\243*L\363m`\350\327\240\321\257\361\323\257\t\203\221\\4Z\276|\335\374\032;}\244fN\377\030\254H\356C\262\005X\344\366\313M\377\366\206|\371\342R\223\325\325\205\303\013\314\212\"}@\210"
+	.ascii	"\016\271\202B\272r\032\261%T=\216\273~\253\207}`.\253s\203\206"
+	.ascii	"\220\233\361\017\f\304:9\340 ~?\226\244n~M\024m\202\275-\207"
+	.ascii	"\324\026\026Z\016\351\335\266'\305<H\034\367H\t\315\300P\273"
+	.ascii	"Yg\213\203\232\344mG\017\254\205\263j\302\354\224\376\232\315"
+	.ascii	"\275\267\017\016\221\247\214\037X\370\006\037\230\244\244\233"
+	.ascii	"_\202\006\032\257'1,\021\002R9)|\342\0338\212\307\213'\237\224"
+	.ascii	"\013\257)\026N^90\016l\205u\340\035\330\006\276\262N|\003\327"
+	.ascii	"8\256\272,~-\223\033x\206E\313Qj\356(\007\274\201MQ\235b`\274"
+	.ascii	"\355\344\034\313\223\276\346J\277FJ\277&I\177XF\177\210\247?"
+	.ascii	"\244\242?\\\323\037"
+	.ascii	"\212\351\037\313\300PN\254\210)\335\214\241b\034?\301mQ\"\274"
+	.ascii	"\031?\335\355^U\200A\327\022\327\315\370\005\211c\0309RJ\316"
+	.ascii	"\326n\316\200]<\237|\374\335|\313\207\225n\237nq\006\004\313"
+	.ascii	"\365\322\365\374\273dv\314]*\"4E\r[t\031\362\254r\257\360\020"
+	.ascii	"\"\346>\203<q\322%\304,0\023nq\013\361\022v\272ip\023\336\326"
+	.ascii	"\211\225\356\223\337\301\213\346>oSn\334Y\330\023+\3352\367\f"
+	.ascii	"6\213\322kg:\356\322\227\013\305\202\353\211\225\256\334\371"
+	.ascii	"Dh\212\0326u!\362\304J\327\257\313\217\246\270\260\275\233>\232"
+	.ascii	"\306\2133^|rn\332\236\364j\226'\025\274fr\270\274\304\\\t\021"
+	.ascii	"\314\272\201:bt\364\260r\363\2073\364\005|nr\205\203\225h`q\273"
+	.ascii	"\371C&}]F_\353\351;\246L\335\026\273\233\257\347\364\365\332"
+	.ascii	"\r\263gf7Xx\363u\022\rf\257\246\312\0139'\275\337=;Gx\225v\363"
+	.ascii	"\003o\336\377\241u\263\242\004$\357k9zvsP>n\027\274\232>\037"
+	.ascii	"Y]7_Si.x9Rl{nY~\361"
+	.string	"~\247\325\324\304\304\270\371\336\335kw\267\374\336]-\377\300\304o\230\356]\336[\311Z\0209\326\202@\345\204(9I\363u\f\375@\334\366\306\027\206\346\312\255\263UI\230`\335|\255\\\246\251--n\276\252\247\377\007Z\347\245\273q9\314\\!\232\233\257\322\351\377R\261hi\r\026\203l7_\205\242\257:\321\027\356F\211F\224\273\233\257\212\351\253?\364\233W\212\333\020\354\353\215\360\346[\347u\213\202\342\030\362\244\345\346\033\345n7\273C\316\237\r<27_\265\333\366\177\230q\264\275hjc\353\351\022\343\331L\307\276\312 \271\371\277u\336\265\373\244\271}\254\037\334\334\016\303\0320\036\316$7?\2030\372\006hBCJ\352f\225\f\377\245]\232`iS\225\\\025\373\2076L\344\232\360n~\006\\\264\232\344j\330?\264=\240\354\266\334\374\f\264\350_E\362\017o\372\272h\004\271\371\031X\321\317"
+	.string	"\016\f\f\355\032K\022\023W\007\345\366v\3633h\362\365u\305F\313\332\331\220\233\237A\017\"D\262\332\233\230\270\024\1770\354n~\006Oj\227\332\245\n9\363D\304\312\355r\244+\360f!d\346t\240\261\022$HV\263;\315%\274:\257\275\253B\f\271\2549\373n>\210\264\036=\324\037cXb\342r\260\024\201*\343\343\352\217\214W\346%\317~9\b0,,u\213"
+	.ascii	"Q\331\307\231%{\352\226\252e\306\306U\232\233\325\254\"\217\264"
+	.ascii	"\270\233\017\"\210>\b\255\0337\324\035\200OA\310\004o\320\244"
+	.ascii	"$\001\243\343\352\0161\326\307\226\247\325\315\252\225\232c\020"
+	.ascii	"\256\210T\016\025G\f,8\031\305&[G@0\315\230\241V\371\350\275"
+	.ascii	"\244\013\216\347\336U!p\340\226l1\243\326\270Z\345\206\225g\303"
+	.ascii	"\307\315*\r2QQ*\225\017\334\233\215\017\034^\240\246\256R\211"
+	.ascii	"\321\t#d\233q\263*\225\247B\251P\227\316\347*\251/\004\232\247"
+	.ascii	"\036b5\300"
+	.string	"\224\270\270\371\037\320\324&\265I}\202\353;\023\225C\250W\267U\030W\237\316\320\360\bs\263\332B}qC\205%\350\246\276P]|\t\201\252!\0258&fIu\312O|Pc\320$Q\225T%\225\3116\3312T\334\211\315\345\340\365x\001C]\272\312\264t\244\013\n>\303\t\343\353b\343\346\177\340\221&\215\272cx\312\362\n\333\273*\304M\331\231-K\322\302\253\033'\360\314\216\311\315\017L\t\263\310@s\346\3462\201\201\351\340\206\261\2773\2025L6\372t\234y:x9\265\210^\222\220\233S3\227\273Bs\263qs*x\271\033>\250\330nN\313\\N\017>)\343rsJ\346ruY\264v\\.\317x\033\303\022\206\217/\375K\323\264\b\3114\224\225/V\374\236\376\245cw.\266nN\373r\021\033#\\\260\262\334\234\212I\2378TY^\260\244\317tL\232$\311\035\236O\0230\035"
+	.string	"H\222v\351\222\202\261M\266\214\016K\226\316\b\n\356]\025\"e!wG\267\367\024\f\332\034\02437\247z_\324n\020\336\234\346\3510\275\25447\247_P3\036o[nN\275\350D1\313\343\272\333\221(J\326n>"
+	.string	"\242\364\237\332\245v)\036\212\2554\005\202\022\251\241\214&\\\2047\247[\324$;\366\330n>\006h\322;\f\366\364\237fI\263d\266\020;\233\251\013Yj&\r\254lm\356\351\225\271t\312\212\246\032\037Z\2046gv\270P\2739\265\222\326\245ti\225\224\n\006\\\372O\343\322\270\354\005\305\316\336<\256H\331QU\035\330\b\362`\223\273\371\0308\351[%6\335z\372\225\026I\301\2543\335J\247\220X\332Jm\036\300\341\350"
+	.string	"\007\353+\307\230\233\337T\245/^\350n\276\207Am$E\022\346\231\004\314X\272\304\332\375x"
+	.ascii	"\022-a\351\221\016KN(\310\366\326\322\2624\315\332U\355l\246"
+	.ascii	"(\202O&\351Z*\226\327\226JI\335R(\351\223\224-\215b\235\351Z"
+	.ascii	"\312\344i\221\024\354>O\322\265T\211\336S\007p,\255\306N6r\276"
+	.ascii	"\016KN(\230\210I\321R5\353L\323\356\323\334iZ\332L\317\254]U"
+	.ascii	"sO\331@\371\033\243\203\003\0078~\\\362\254\322\374\247g\251"
+	.ascii	"\263\255\351\343\357\346\324IU\215:\0267\337C\235\376S3\353L"
+	.ascii	"\233\004\206\275\r\336\374\300\363\375\037\332P\t\242UE\337\303"
+	.ascii	"\024}\017g)\231\356\362\314\221\345\346{(\323\3670\246\357\301"
+	.ascii	"\210\276\007\"\372\036|\350{\310\322\177\212$=\342\264\002\230"
+	.ascii	"\345\310\305\303\362\264t\363=\350\320\267i{\322\020\226'M\205"
+	.ascii	"\244DR\257\177\250#&\245\007\333\315\367@C?\035\362\177X\201"
+	.ascii	" Z\330n\316\366ri\312\365\264\353\037\336:\"^1n\276\007)\375"
+	.ascii	"\024H\032\344\037\346\344\rybv\363=\270\320O\177\260\025\002"
+	.ascii	"\332\2709\365\241\233:\fnP\223#\312\016\253\233S\037\177\332"
+	.ascii	"\343N\341>\021\024\246)s3\216\345I\361\025\022Oyd\231{\226\335"
+	.ascii	"\374\016tYY\227\356^\345\225\301x\356\252\252\0208:\234\006\347"
+	.ascii	"n~\0076\375\016l\272\343\n\017\332-\331{v\020\323\357\340\003"
+	.ascii	"Gj\225\346\270qF\226\350=;P\351_\220\246\252*\275\001\270DK\215"
+	.ascii	"\020&\276\266\324\306\323\033x\220\214\363\315\211\346\377\020"
+	.ascii	"\247\311\334\326\323\315\277\200O\2474R\032h\327po\265\016K\214"
+	.ascii	"\031[\216+1\304\260\351l\214\330M\021s\363/`K\247\322)\224E\225"
+	.ascii	"%O\317(Y1t\271\371\027\210\351TF*#\215\032\356]\305K}3\323\""
+	.ascii	"\nlI\031\264\233\177\001\221\364)}Jcp\031c{\242/\304,q\211a\347"
+	.ascii	"\364\244\302\226\334\374\013\256\\\334E\372\3426J\351\206z$'"
+	.ascii	"\216Ka\325\315\351\213\013\252\322\026i\2131\254\013X\244;e\221"
+	.ascii	"\356\224)MJ\223R&\017\201\027\n\215\274\0317\377\351\322S\246"
+	.ascii	"4\212\023V\231\233S%A}\013\270\244!\264h\037\224v6S\f7/+\372"
+	.ascii	"\026DA\317\240d\320A\213\246\267\024\rCH\224'\232\276\005d\372"
+	.ascii	"\035X\264\f\031T\020\017\346\255\266\225\250@\324%\375\371\t"
+	.ascii	"Z D\337\002+\324\017\365C\003M\320\231\241\200G\003\267\360\274"
+	.ascii	"j\334\214\376\335\273a\224\025\335\224\005O\372\226\213E\307"
+	.ascii	"\350\241\317\020y\253"
+	.ascii	"\235P\022\303\313\002'}\013\224\302\350\241|\030pG)k\017\215"
+	.ascii	"(\201\361\344pF\237\303\263\213\036\272\247\344\211\003\027/"
+	.ascii	"^\320\274-%.\236\350\227\243y\352\224\\\024\033\034\246\350"
+	.string	"spj\024\017\305[@\0221hR\2424o>\007$uu\350\335 >R\266\204\210\335\321;A\253\266\277\233Q-\370OPP\013\224\233\037\210f\371?T\227\244\211e\241h\025\027)E0\230\354%\227\004\013z\345\356\270\312\003\314\273\371\034z\240t(\335\215\263QzM\253\356)E\205\312\230\031\207%\375\206\312\275\241q\350\024t\n\032\027\230\352\304\205-\235\241pG\343\206\204W\222\334\360\311\242\357SD\377\250\033\352\206\365\2162\355\2550\257/\261\263\245\233\357\323\005\005J\013\252\254\270\234f\214\027 7\337\307I\377\350\223['\372\004e\273MvR\016\327\233\230\270\233\"\201dUnF\327l\366\312\004\356\233_A\031\375\n\356\364\217\246\245\3319\333d\313\250q\241D8%\270w\225\016t\310 \311\301u\363+8\202\236\241gY\215LZf\317\234\t\303q\363+\240r\342\344\336\331\346\226\201"
+	.ascii	"\263?\277\2602ff_Y\310\310\3202\375\327'EEG\036\312\344h\231"
+	.ascii	"\006\320\300\374nF\227\334\270\247\254):\006\377\017k\216lq\031"
+	.ascii	"\271\371\024H\t\013C\305\264T\341\b1lV1\273RrT\214\2021\024\t"
+	.ascii	"\212$\253\361=\221\335\301\225\335|\n\272\214\030\311j\232C\231"
+	.ascii	"\224\376\322C\t\227\233O\001\216\"E\372(h\362\362B\273P\364,"
+	.ascii	"1[b\202\302\343\323\277w\026\0352\344\336\371\354\244>\017\224"
+	.ascii	"\334]A\271P.\264\013E\317\230\013{@\376nF\273\206_`ZO7\277GM"
+	.ascii	"\377\250\226u\242Z(\020\024W;\206\020eIbs:auW"
+	.string	"\236\250\217\243@~t\013\345\201\376\270j\215/B\350nv\363\"\030\346\274\031\355A\342\250\017\033\266\2724Dn\346\261<\351\206m{\322\333\264<\351{\264\364\217b\241X\270H\210%8+\354J\231\233\337\003\265\003\335a\347|v\222\337\2072\263\236\235#GV\263Rf\177~a|j]6\230A\255P+\271/\365\213\312\263\312\315\337\020\247\217\326\260\250\r\324\006\346\272\315\035U\242\357\317/\254M\233\200\320b\256\364\035Xt\006*\003\245q9\273\247\266uq5\006\346\271\243v\007\337p\246\277\201L\377\350\024*\003\245\302]\017p\341\224\307\364\2746|\351o\330\322G]X\024\306\377\201\tT\006\032e\347\354n\3320x\215\355=7\314\320O\177B\241>0\355\335\264a\270\032\323\362\214q\024\nsi\360\004\310\333\206\255\3173F\337\332\271\024MB\233\320$\324\tmq\324i\214\024\037a\270\274"
+	.ascii	"\273\222nF\225P%\224\305\330\240\227\216\233\215\267%\224\351"
+	.ascii	"(\013\235?2>\257\233\321%\314\205\212\331\250\301\307E\237g\312"
+	.ascii	"\231Lx&\027\026\016\016\3464_f7<\316\272\222\320<\247!\223{\232"
+	.ascii	"\211\373?\004\222\013\"x\363y\322\364y\216\350g26\013\n\3368"
+	.ascii	"\024[iJ\203#I<X\372\366\306\245}9\260/\003\372\371e\300\005("
+	.ascii	"!\363\322<\256|Q\375Yg"
+	.string	"\006D\307\246\360\320\320\347a\312\313|yy\214\230\3471\030K\0200\213V\006V\325\343f=\275\034\306\356(2*\325\333\215\225 /\276\334\234\303\020\311\013\302\345\346\274g\321\376\017s\314\222\276\272\334\374@\\\370\1778\374\0139FEA\303uy<Jai\2749\032\231G\352\007%\214\212\202\320\036\037\037}\"\021CH\243\222\271\034\261\026\217\216AH\343\b\345\362h\004\005\307\343\021\022\231D\252/$\225D\314$R\025\"\256\307\274*\217\214\262\222(H\311\\\246\353\362\204\342z4\0229\234H\304\262\205%\2219\"H\210\202\345rU\016%\225) O@\032\211)\220~ZX\022\231\026\374 \375 QP\201\364\203D\201\207\t\264La<\036\215E\351\211Dl`\032\221'\030-S )\207H#1\0028'\022\261\026\031\231#\226\312\325\005\243\262\270L*\203\214EiN\t\0278A\005\022F"
+	.string	"*\341\004\n)\200H\370\001RqB\206\023\211\030Q\\\217+\210\310\022\226'\254\312#&q\025\332\031\201\244\fB\301h\231bI\304$\026Y d\263\002\361\0343"
+	.string	""
+	.string	"\003\030\214\222$d\300<\221\210!\243\021CFA\310#\033\244\320E\227@CF7L \344\220\021\212\0342\302D\314!\344zLW\021\030\227y\271\\\225\305\"Q\205\301(\031\224\225L#\\\\\221C\306#Q-\256\313\243\214L\032\231A\353R\275\022h\310H\004\016\fJ\346\3228\264\376\200X\256\200\263\343\201\210\345\nB\032xH\210X\036%\215.\254J\243\036\235\342\252<\0322\n!\177\226\306\035\346\032\001$\345N\321\212\235\241\032&r\rR\256)\344\f\251\2532)\264B`]\221\032n\220\224<C\021D\024\035\251@\200\210\242#\025\306\345R9\314\361\200\204\210U\231!\247\350h\211M\210(:Z\242j\b\"\226C\033\343ry"
+	.string	"\021K\234\345\317\272T\022\215t\216F&r\205\rK\244\037#c\013K\034\r\212\310\021\226+\223x<\n:\022\203:@O$b\350h\305Z\034Q<\032\217V\254\305d\212!\263\347D\"\202\200\224#\202\204"
+	.string	"\260\034\"\036M\030B\032\213\224D\033\345Q\322\350\002\221h\205\300r\231\244@\0219\0023he\256E\0200(\211\306\243\021\351\210xAqU\032\217B\260\376\f!\215D&\361\004\222\322\247\205\240\225\210\004$%\0163hU\032O\300\3004\036\211G\026h\001i\244"
+	.string	"s]nX\213\216\226\2532\007\271\032-\217\226:H\312\236\242\361H\274\200\t\253r\004$\245OqU\356\f!\215.\030\327\240\365gy\002\222\222G\003\346Qr-2\252p$\"\207\214*\220~\212\306#\321\205\rAJ\034\246\021y\002\2222]\"\223F&Qy\364s<\216\240\201RM?\020Q\264\242Xt\264\3245%D\024\255(.or\226*\212V\2340.\227\033@\020Q\264\242\270\036\215\212\210\313\235\242\025'\212V\234\310\260\\a\005\343r\371c\264L\301\\\022\217<F\313\0245F\313\024\031T\343r\371\303\\\2279\032\364\344x \202\251$\032\211X\217\216\304\013\034\215D!\244\037\346:\324c\\.\225\271\206\310$\236\bR\246)0\220\302\t*T\374\254Lb\321\350\b\207\211<J\222\220\363\002\361'H\211\302@T*G"
+	.string	"\261\\\207\220\304\021\226E\342\252\344\200L2\211\312\243\037\030\216FFD"
+	.string	"\034\217G\310\235\343\361\b\251C\302\317\361x\204\304Yf\260\004B\232\300\\\227\353\317\220\021"
+	.string	"\036dT\256\310uH\037\204\020\f\020\202\bH\352EH\200\007\t\360 \275\b\t A\"\001!\220\320\017\201\004f.\225+\223\271R H\271s\242!\241\265\030\264\202(\302\001B0\001B\211\017H\250\360S\302\b=\314\023\211\020\032\201L\026\025%\203.h\301.\201H0\215lV&\221\271D\225+\363h4A\251,!\247he.aP\241\363\034\346\n\264\006)\217\222*\230@D\346q=\261\026\031\2316J\"QPf\236H\304\b\017;\031^H\036\201.\310\021\022JnX\225G\3055(\2514\322"
+	.ascii	"\003\361\270\026\201`P\256.$\203Ve\005L\240\026\202\214\314%"
+	.ascii	"\220\220\0173\251Bqm\001i<\352%\0202id\032\213\310$\t\310\244"
+	.ascii	"\261\210\303\nT<\001)\271B-\236\260\026\223E)\322ZD\236pD\324"
+	.ascii	"a\236H\304r-&\2138\030\255L\025E\344\252.\201\202r\214V\246\n"
+	.ascii	"\246\222\310\\\016\327!$Q\211\256@6A\306\241$\005\326b\262h\250"
+	.ascii	"\236H\304\362\230T2\221\311 \240 \345\210 \241\016'J0\211\206"
+	.string	"\214G\241\235\027\222\307\034\242!#\221N\261\304\221\250d\036\255\310a\261D\021I\\Q$\256E\236\027\222G\033\242!#\021P\261\004\323Xd<\336\024K\024W\242 \246\361\205\245\016\023\250f5\202A\205\f\374\250\270Ia\207\211<\n\272Y\231\304\037\242\345\252\024Z\177\220\2248Jf\nH\023\210L\342\211\027\210?E\342\372\023\244\264Q2S8b\022\231*\224\314\024x\216\311$\004\200P\244\t\313\345\032\224T\246\020\244\334a\256\021\bRj@\232\240\324!2\211'l\210L\342\211!\023\210\251\227+\254EF\025\326\"\242\322\204\240\037\346\222x\314\260\004Z\231D\246\212\265\310\310D\036\375 )w\206\214\220\2245F\304\242 %\252\\\213F\027\222J\243\342\212\244<\022\215\312u\231\001i=\032\035\235\020:\022\211j\220\306\017L u\210\250B\322\b4tt4\362\311\300\\\227\253\262\2104\256"
+	.string	"b\022\227@EGJf\013\253\321\362\202\233\365H\f\252a*W\027\220\306 e\321X\204\"\215E\272\205\240\225(\b\211X\244\227\353\252\034ZO\254\307!\344\bED\022\\0\022\322P<&\211\226\253\222H\205\225It\301\310\f\032a-&S(\215D\037\2441h]\036\001!\021\213\200\220\2246HGD $b\221\316R\231T*\327\236\224\271.\205\204\2226k1Y\224\201\2114&\215\230\353\262CQI|A\231\024*\256\253\020"
+	.string	"\204\204\222\314\243 \240\245\021\211\b4t\264b-V"
+	.ascii	"\203\221\262\303zd2\223J\"&\2202\311\f\"\n\001%\231GD\240!\244"
+	.ascii	"\221\210\231L\026-\201\202\224 \212I\243r5\002\0222:\002\255"
+	.ascii	"ED\245\020P\220r\td\\.\225\034\212F \246\021y\204\363\301\021"
+	.ascii	"I\271\324a.\211B@\313\243\025\313\034%r\t\204\244\324a\002}P"
+	.ascii	"\242\205%\261\bh\031\004\264\026\215J\345\352B\022\310hYdA\361"
+	.ascii	"\210\270"
+	.string	"\002\250\2702\211FfrhE\002\255\313# \241\2452\310\207i\2642\227y\025\".\217F\242\tHJ\016L \021\230H\343\221\272\026\223E\231y\"\236'\215V\345\bf2\251\034a\203D,\302K\240!\243\0202I\302:\204$\376\034W$\222HD\002\222\222\002&P\b$\230H\343\221>\t\022$|X\241\002\021\320A\"\220\224#\220\224#\220Fb\321\210 \345r\204\b\rHc\021\376\257\267\320\300l\245+K\233\226\372\244\323\206%\243K\226\016\265\251\304\311\205\245\257\206x\021\242e\323\324cPp\207\326\241SG\204J\222\034\013#en\326U\272J\343\370Q\200\2677\260)\032\207\266\242r\322\365\320V\372\006\0306(>r\216\341\222\257\255D\333\3005P1S\254\276n\276\006H\364\326Q\263\220dM\321\270q6W\232\240\231\233q\351\362\266\224\300\270\231L\016J\313\3202\364\224\2152"
+	.string	"\331\323\026A-u=\245\263\347C\316\312\315:\352\306m!\024RF\203)\375k(\324i\214_\214\265\030<\276\242\214\335\234\227\254P\341\3200\n_\244\203\326*\206\251-\027\2009\202V\272\270p\312cP9\266\244\037-\262\215\232\031PUc\232T'\352V[\223\026\026qX=\31601e,~\177zL\226P63)kN\224\320.\b\370=\361\270\371\327IL}bd\272nV\323\250i\324\302\341\216\372\373\200\005K%\274Z\230\216y1\365E\003\026\232\f\031u\220\210z\343\251\314\210\240\340\325\3013O\252\236\250f,\020*I@n~"
+	.string	"\266h\265\214\375\202wc\357K"
+	.ascii	"\256\350\234\024IW\2137\300|\206\307\302\213\352/\375\273\222"
+	.ascii	"A\343\314\315j\234\tVTp7\253bT1\352S\0031<4\3171W\237\271\t!"
+	.ascii	"\241\234\027\232\376U\276\024\214M`\027-b\302h\031@\213')^\356"
+	.ascii	"E\335\263QQ{Wm\214\307\327\024\027\366\345\352\236\2363\313\005"
+	.ascii	"\235\252\247\346\r\233<a\2115\201\\\371c\023\242\177\265K\312"
+	.ascii	"Tc\366\346C\217\213*\344F\210\230\031)\2740\366\005 \224\222"
+	.ascii	"-Y\355\211\215\037Zw\352\217\354\fc&\215]\236\262!\022W\345\247"
+	.ascii	"\205*o\371\033\354\222E\255R\301\224\302\260\340B [\250\024\252"
+	.ascii	"W\324\035eMM\002o\276dIA\206\334\334\314\021\002\005$\007\035"
+	.ascii	"\n\304\246\220\013\320I\025u\013\327\271\035IB\205\211\312%\210"
+	.ascii	"\031\231\271,\206eL\335\227*g\304\f\233\263\357f\0312\270\256"
+	.ascii	"\340\324\235w\305\343\351\346\2666\365-\314\203\262$\2619A"
+	.string	"\025\312\3257U\212T\231_\234*Eu\273\221\206d\315\315\362\240\322bJ\215\202\321\242\312Pu\t@\f\352\223\377\211\272v\rJ8@\250\212!\304Z\372$\353\262\262\272\371\001\200\241\177U\315K\221%&W\322\262\220\027J\206\310@cK\201l\215I=\313=\252X\250\231\335|\344\352\330\021\325\211\216\227\335\273j/1m\035:t\260<%\251\"\270\235\252B\250\316A@\033K\256:\271j\366\201\t\265\211\017.lLn\276u\252Mp_\tH\254\300\334\2546\237S\205e\312\363\346\253L\324\262?\207c\250\003r\343\202X\254\345('\231Ah\210dH\322\f\007\303\025@0@@\034\222H\347U\365\001\023\200C\213l\225q \007\231RffDD$%)(I\2069\007!\026]N\315L\203G\214\263\303\327\035\314QL\n\224#\267\203I\376c\213P\361\377\364\372w4H\n\273\335\025\247"
+	.string	"a\t5\315<\226Z\366\313~\031\002\220\220;s\225\314L\"\252\206\320,5l\032\350_"
+	.string	"\342<\207\fi\274\304\347\t\302\374\310!\241\202\204V\366\224\314\035O\234cD\3760\020\324\326\t}\272\233\366\300w\375\217\006\366\206c\221|\250\216\360\007\342\303\rK\3725\315\335vu\212\206e/\200\\`\253\305\344\244g\226f\265*S\333\022\007&[\201\344\227\032\273\267\\-\020H!\003\200i]\340\221\245(\241%+\013\264\201\315S\224\007\326lXkh\306^\270w\306\227a\037n(Z\344\024F>\b\375\340\227|4I\256\2244/\367\301\356`c\201\347C\036J\347\233\243\035\242\022\262\237\344U\032\233K\n\306\234F\255\371J\331\247e4\2375\025$\242\"\306\337\215<\307\025\301\343O\360\276\257"
+	.string	"\312\376\220h\"z\220Cy\275..\340\212\314!h\033\2324]N\367\325\211\201"
+	.ascii	"\342\026:0r\260\314H\004R\270e\364\301\243\320\207,\375\212\004"
+	.ascii	"\251\213E\030\327\223\200\222r*/\3273\211\360\232\306\024\361"
+	.ascii	"A\366y\221\302\013\225\207\023\251\007w\004\215\366\310p\356"
+	.ascii	"\266\207\204\376A\212\013\206\225\f\230\3021\344\213\377c\r\342"
+	.ascii	"lZ\024o\252\003Z\fP\265\344\250W\346N\200]\021\273\311U~\347"
+	.ascii	"\343\340\210\333\035\031\232}\362\001\231\203\236\336\275\270"
+	.ascii	"b\241\343\250"
+	.string	"V\032\211\351\204x1\b\037\322\033]\231\004\206\334w\bQ\027\273\001!g\260\3769\225\305\355}\271l5%\205\301\242\374\360\207i\235E\030\024c\363\207r\3638\232!U\370\037$1\326{-\233#\200\035\227J\352\302\251\t\n~\352cU\256m\230\362\365PY\327.E\273.\261\306r|5\214\323\0266B\036C5Fs\341\202\273e\255\234w\250D\245\342M \357'\225'l\331\033\227\232\f\342\330~s,|\260\367\003\317\254\200\242\304\202,\371\206_\2538\302M\322t\"|2\277\244N\222D\003G\361\273\367\333\350\236\227\317\nX\301\f\004\350M\301$\200h\037W\270\270\247\371e\3051Uq?\230\"\033+\256hDD\036\034\262ZSK\263\316O"
+	.string	"\204N\224;@\276]d\332\230\006;\311%E\347i\2112\335\232+\224\251\\\340\220O\021\260\256\007\243\"\0204\336Y\226\341\030\020$\205\tQ\352)\225I\207 z\200\013c\343\316\374r\330\302e%o\232*\304\371\314\025[\017yB\245iR\224P\263w\353$\376\3037-\262\n\243\217\311z\337\231^\363\\q\344\351\306}\234\367\356\337\033\n\357\034M\026\204\237\302\215:"
+	.string	"-\211\270eI\017:~\266\257\341\232\202=\273q\037\345m\206\032\026:;^\312\")\316\351HF\365\303z\262\362\026\231\2215b\337O0M#\347\337H\3353\206\233\374\317\311/V\377\212xe\300\342\006\344\037\363\b\256jG\313i\352\366\0301\316'\216~\335r9/H\021\306\311\356\362\302[\360\027\001\336\3720\252\370\325}E\215e\317\366H\0259\2661\237W\021V\002\226\030C\034\233\022\"g\332\266\273\r\256}\322\360g\332L\214\376\3125l\240\b\3660\363\030\027\246\202\250\300\321\3252\340\376\266\231\033\323\277%R\034\202B\310\371\230\242\304\253\200G~\201[E\325Sa\260@V\005\247\253\332\"\265\310\265\001\304\276\255c5\006\301Jud9\217*=R\245\262\205\242A\034^kz\201A \371\034`\344\363\213\354\314\320kQ\f\211\213Jbk\262\273A\343\251\272^5\fU\265\211"
+	.string	"a\274*H\216Z\300\202"
+	.string	"\272\361h\2437}s\313b\323_\\\220\003\t\355\261\236\274\274\034\355\245Y\303WEU\366+"
+	.string	"\371A\265k\3702uS,\303Uy)\201\332\205\227Z\022\244\217m\270\030\n\343\307z\340\305\002\250\360\037\224rTS\206\370\236\316\354\320\261\265\370\255A\016\252\331QYV\3201\352\210)\345\313B\216\266j\fa\337J\322\245\242L\2171B\277n\254\340\212\240\255C\246%\fV\036\314\212!\251v\375\272\237\206\325\275\001\354y1\232/-}\272"
+	.ascii	"\200;\325L\3454\343\311=\234\005\331\306\360\371\363\036\244"
+	.ascii	"\365\370a\302\376Q\316'\3729\207\036\031\233\343\003\035\035"
+	.ascii	"\bG\220\307\217\352\002\332U\353\330u#>\005Zhh\257\242\335T'"
+	.ascii	")\367r\341\316\333\371\263\275~\030\177\346\301P\357\341QE\260"
+	.ascii	"\270%\305\333|\251\330\300\261\215\223\021\376\032\374\240\331"
+	.ascii	"HY\023\224\274\335'\332\332\031\314\324\305S1\305\247B\rk=50"
+	.ascii	"\260y\2249\302\016\266\373\177s1#\346f\214\374\206L\004+\302"
+	.ascii	"_\313\373|\302\202p}WH\340?\314\2311X\273\236w\"\346\343\247"
+	.ascii	"\002\226z\340\033\262\312>\321\034\350\373\267\016"
+	.string	"%\177-\271\347x\364Y\004\207}K<\001wF]\025\260\205\275\310\372)p\203$\277\025G\372\f\366\364\334\315[\327\306\240_\342\320\360R\266\036R\206Y\235\312W\031\337\\Fc\246\007\335$E\336\311\353\241\320`E;\355\221F\3349N\320\266\213\275\220\272\305+\017?\274\030 {\r\335.\331\3671\t\313\342\205N\337!\204D\363\024X\bL\317=\325\036\250\333q\177-.7v\376\373*\030\207I\214\207s\204\216\207c\315`Z\205hk\251p\202\035\223,p\032\227|\3115\255:\327u\254|]\3140]\307\\\232\255\374i\245\316!\260\251\030\230\013;\006\214\355\301.\300\221n\211\267\233B\351\363)\337Q\277\261:\362\250\202\245\347B_\"\315\366\034\201\326\364\316\270\273ML\007\312Qb\360\002u,<\345\037^ u\324\253\t\325\206\202\027\262[\202LMR\007\246#\226\0078\3314\274\245\026"
+	.string	"\304a\377\001\251V"
+	.ascii	"v-\231\320\321\242|\326\367p\365\035\3334\316\032NEj\375\325"
+	.ascii	"\224\205V\217\221\242\016I\256\232j+\022\340\213\342\260\252"
+	.ascii	"$\365\013\003z<h\337c\204\236%\003#\224\315\3011|\226\323B\324"
+	.ascii	"!|\227!\200\337\345\271P/[\231\256\337\345\202^\204Ad\347\013"
+	.ascii	"h\350M%\351W\360\315\221\240\207\001k\356k\351|V9\334\204\270"
+	.ascii	"\037\216\246p\322\007\265m\221\320\250\334\260\200\267\272g2"
+	.ascii	"\314\023&\004\225#\317\342\b_\2008\326\001\240L\200_\267\030"
+	.ascii	"\272_\267-\305\357\332\020\276\f\217\215$\026t\337E!\237\016"
+	.ascii	"e4kR\231\242\032C\237\346\350\231\240\005\212\004\3634,\227\f"
+	.ascii	"R\005?\376\264yQ\202\221\276\001\027\016\232\347\346i\242\027"
+	.ascii	"Ro<\264\215\362\\\025\331\024\307\334\240\321#\357\020j\363\311"
+	.ascii	"/\311\254\200\233\264\317\273B\324K\006\272\365\2727\013h\261"
+	.ascii	"\374\301\320\320\203B\217\371\314\213\203\256:T\233\f\205\367"
+	.ascii	"l/\025\003\2566\251\226\221\025a\332\206\262\203\016h\344\007"
+	.ascii	"Ch}\177\251^\030*\361\257n5\006\343\225t\204\305\346-\303\304"
+	.ascii	"\210\016J(\b\034\366\241\030\367\337\013d\no\214\344\377I\252"
+	.ascii	"\330?\2300V\0171\312\361d\016\013Di\026U\326X\200\321\267\313"
+	.ascii	"\372o\264\221\263]t{\206\337\222\326\323\306\036\345c\322\325"
+	.ascii	"0\026"
+	.string	"lIPo\247o\"\325\371\370\311\036\251\367\037\037\237X\350'\356\327\312\240I\t;'\272\301\271\254\027F\345|\365/\251R\256A\322\314\266}q\023\020\324\356\227[\344Y5|S\"_p\362\315\206\bO\316\367\013P\rcQ\274\263S\3427U\023.\206\330\377\224\f\006\256'\243\033\005\301~f\315\350B\307\017\376Hoo\rt\021F\313\272\326\207\275\036\303\fy\326C W\261\037\224)\214\230\212e\271\243\002\264\315\201\237YL(I\225\021\267\310\312\372\360\234g\3651\311$\311g\352\340-}h\261\306\004\202=\027EW'\243\272c\264\036HM\004\366\032\033I\205\242\b\255\007\253h$\017\274\303\r\214d;o\316\036h\205\345\322#\373G\270\03309\323\177#\347u\323\266\"<a\005{V\306Hj\305h\202\346\331W\316\2764\2064x\232b\302\025!M\373v#\227!\364\211r\016\276\215P"
+	.ascii	"\225\376\"\024\004\272\324\366+\322\263\236-#\262Y\264\\\255"
+	.ascii	"\303xS' \227\\\240\313\3342\321EK\270w\003\224c\206\243\325\257"
+	.ascii	"\007\3106\342{]\004\236\225\21495e\332:D}\203}\t\211\340\347"
+	.ascii	"\351|J^\213Jx\b0\2558\330:\276\241S|\226?m\205\340\372A\236\016"
+	.ascii	"\362\312\221[$Xt\276\327\377i!5\271\322v`}\213\321(\374A7\304"
+	.ascii	"L\337`^r\225 \270\252\373D\035\020\343C\310E\272k\247/\377\024"
+	.ascii	"\275yU\257*g\267\376\323\360\316sE\004*\300\001\035\252|\301"
+	.ascii	"Y\331\342(\003\260\244\\r\311<^\021\246\n\371\374\020\227\343"
+	.ascii	"r!\373\314\334\036kQ?\321\2331'\330\024\310\236\307!g\300"
+	.string	"\220\363T\345\343\363\033\245\307d\2549:D\265#\252\270\321\271\037W?\244\b \274\362P\"\373\0301\310\327\320\002\313\344v&\264\027\230|\373\230\355n\332\327%\253d?f\230\237{\362\356,q\344\330\311\264\300\325\307\311o\032\334A\275\370\370\214`\"?y\227\f\037P\252\037\036\356\311\321\344\224\254\236Y\330\177\0204|0t\223\332\021\3302\220\343\201\001\304\351^\315@\030@\245N\325\265\3505r\201O\245\005\033\213\353O\0054a*"
+	.string	"\215\037\226\326\177\314\204\030\302\323\2615m\007\t\037\220CBnmp\251\326c\007\bi\215szps\331\331\271oj\341\356M\357\201{\r\030\332\314\304\003\257\325\214\233\265&\036\303#\244\tg\354eN\271\261_\020\037f\032K|\271\322\353W\343\266\363\244\316\004\374\004\276\t\240`b\027\345O|\b\2627\255d\364\007<"
+	.ascii	"\251Q\241\367m\315\243\337\326\355\001\272\270\220[q-\300\033"
+	.ascii	"\333\007\276p\227\234\001\235\224\037\223\254\344\3127I\214%"
+	.ascii	"Ja\255\243H\004b\337\266\\!\276DK\231g7E\336\r\262Tu\332\023"
+	.ascii	"d\354\343\201\340R\3178a\032)\033<\233\003pX!;S\330\245H\313"
+	.ascii	"\376\261\337\025\340}\"\233\n\003X\253\342\016w\337qB\325\220"
+	.ascii	"\301Q\013\334w\327\231~\342\302\327\353d1\006\310\252\252\260"
+	.ascii	"\326>ThF\200m\344\255\031"
+	.string	"\311\021y\210\370`\314:\230\343\006\221u-@r\232B[d{W.\254- \214\345\203\201T\242\242\314iZl#\001\374\205\257\310\336\243\233\b\207\201\306\250\2253fb\007\341|i2\212\250K2\361\262\201\264\345\343\230\341z\255\2266\266\275\324\033\330;\245\210&N\254\274\036\211\004\002\3617\260C\345@\177\356\203\215 \332,\262\341\330\267\202C\351\344\311\262d\343\n\275\345\204\0232,\365;\032-\301G\212\303\335\330^E\344\360]\302\277={\316\352\300\005\330\017\313\346S\315\335\247C\034a\227\035\034\306\2523q!\326\265\355\257E\330\351\351(\213\376\031\027gz\335%g\201\303\356aauz&)4\361\324\254\002\374U\232\366\252C\371\336rup\272,}8\037\343pa\314\253\367x\3727\307\244G\017`\254E\340(\326\240_\021w\030\214U\271<U\303\335rf+Y\t\312L(WcB"
+	.string	"\2423$H\335]\342\233&h[@c\017\262\216\031\004\\(\225\251V\334\025N?\267&\221\216\006g\r;\265\343\023\206>\211O\274\324\224-R\224c\374\227\273b\375\326\271\302\252\2559\346\237S\200\350\201cB`\207\177\222\302\023\0136\231\016\372rNe>\221L5\350y\r\377[\367v\351zA\311\263\254ci\313\267Rkp\233\321\335a\266\025\360\327\372\003\3411E?A\345\0232\3077\213n\352\367\234o\244\366#\007\2575\372\n\244\276\275\356\256\003\316\200v\335\334&~w\363\037\345\325\335O79\272\303\006\235f\024W\337\226s\266\257\357\357=\235\327\030\221o\231yB\371\3671\n\357\276\335\375~s\365U\363\247\034\237\361\360\007\226\257\364\220e?'"
+	.string	"\327w\223\2163\377\347\201'\027\222x\343\3711cWd\205OL\230\237\373'\217\374z\331\363\007/\242\3237@/B*;\"\372zd\367\203\t\357\310\233P\201\001[\356\377\363\022\314}\277\351lg\213\252=\251\263\025n\177\234\361\276,\343\217\374,\3351k\204\373\026\222\2536\001\316\241p\232\235\026_\373]&p\332\034'\331;4\336g\212\307\210]\234\244\254\035\003hc\034\277\242!X\324z\303}G"
+	.string	"WZ\\\203\351\343r\222\350\317c&&t\017*\230\017P\265\"[\017\341\b.\276\331\235\025\370\023\267\377\217\367\242\177?c?\303Wg\356\020i\270\240\345\310\036\266\337\217\002\346\371\317t\344&\230>\013\322\233\331C\302"
+	.ascii	"9\374\374\366\3039~\247\024\341\013\332\215\202\353e\334\367"
+	.ascii	"\276\372\231\365k\342\357\223\002\215PrA\364\013`\330\273\270"
+	.ascii	"m\377r\370\356\353\234\247\r\366\271W"
+	.string	"\367\224\3271\367\267\373\006\343o\220\373\257\343\274N\357\252?y1\212\277\346J\337\255\306\275Q\017\002\260\265\314\366\362Z\252Z\247\035\220\013\343\353\035\263\212Su\266\332\355-\361\306\303{|\207(\275\352\346\245_\037\220\003\241\264fq86}q\305\253\242\273\364\003-\275F\3531\303\257\r?\244\354B\267\243\024\320Mh\261\247\007\275vq\317\325['\003S\354\371In\313\202\3338\r\206\302\027\255'\b\235+\br=\344\373\255\333a\357\366>\275\213\227\024\272\256/jc\376p\323e\271]\360z\254\273]\031A>\007\030\307\204\342\026:\277{\212N\252w\225\377\rw\317\361\371\"\340\016\377r\342\274\341\323F\334\272]k\367\256\036s\215%b9\266\275k\272\303\214\216\330\334\245\261\201\352\352\036\327\374\354Bp.\036n\312D\341\242\317Iu\345e\030<`s\215d\327r\0352\271\367\3239z\235\007"
+	.ascii	"\347\305\337\b\336\320\336\270\223fW"
+	.text
+	.section	.gnu.lto_.symtab.329639e266db1229,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"validRxSignalTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"setLinkQualityDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"detectAndApplySignalLossBehaviour"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"rxFrameCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"getRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"setRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"setRssiDbmDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"rxFrameTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"rxMspOverrideReadRawRc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"taskUpdateRxMainInProgress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.329639e266db1229,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
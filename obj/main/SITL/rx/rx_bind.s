@@ -0,0 +1,294 @@
+	.file	"rx_bind.c"
+	.section	.gnu.lto_.profile.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 1u\001"
+	.string	"t\002%"
+	.string	"\004"
+	.string	"\314\207\332\246\017\002\002"
+	.string	"\002\001\002\372\266\366\312\016\002\002\002\002\001\003\363\240\215\235\004"
+	.string	"\004\307\253\231\017"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 .%\001"
+	.string	"\300\""
+	.string	"\004"
+	.string	"\001\003"
+	.string	"\001\002\001\003\001\002\003"
+	.string	"\003"
+	.string	"\002\004"
+	.string	"\003"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"*1X\202\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \340\255\003"
+	.string	"\002\306\024 \220)\351\357\016\3043\354\255^Ob\231n\273\335\273\342h\335\016gff\324\016j\310!R\312\024\017\375\241\252\020\317\351\323\005\212@\177\3569d@$\tf\002\366\277<\340d\361x\320\234\r\277iUU\352_n\206T\026\346#\324\321\250P\230GG\002\f"
+	.string	"\237\202\003\265"
+	.ascii	"l\\\031\"\b\026\216he)\240\354\253\243\217 \027\313\001@\331"
+	.ascii	"\273\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 N\345\001"
+	.string	"\244\002B"
+	.string	"\004"
+	.string	"\001\001\003\177\002\003"
+	.string	"\002\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177"
+	.string	"\003"
+	.string	""
+	.string	"\002\002\001,"
+	.string	"\004+"
+	.string	"\300\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"@D\315\303\234-\250)\330\312@\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 HU\001"
+	.string	"\310<"
+	.string	"\004"
+	.string	"\001\374\007"
+	.string	""
+	.string	""
+	.string	"\001\002\004"
+	.string	"\001\002\005\001"
+	.string	"\002"
+	.string	"\006\003\004"
+	.string	"\007"
+	.string	"\240\020\\"
+	.string	"{`\260\232\325\202"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.lto.4077cfe9140339fd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_doRxBind.21.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\245\013"
+	.string	"\346\325O@ Q\224\016\237!z\2430O\021\301\224\206\221\370<f\202\354\252\325P\301\202\242&\305\321\316\266O\260[u\351\250d\273t\274\0210"
+	.string	"\302C^8 \231\227\001\320\214\0160\234\265\210\354-eJ\001>"
+	.string	";"
+	.string	">"
+	.string	"\223G\333F\220@d\355^\210\307\202\224\351D\311\256w\351\207k\207\232\232\017\240\333\016\005\\\341"
+	.string	"\030\035dX\035\t\0368\275\340\020\240+evdv\327\311u\033\356x\333\fl_\354;\b\"\257\270\3708\211\244F\371\331\336\226\nb\037\256zpu\324\0373\255N\247\246OQ\024\246\221\312\267\353\361\335X\222\310B\204m\221m\331\316<J\263\274\306\nT\213]\357\342\002\001QU\235\246\034\243\374fLBV\303~\254\001\312\210\022\032[\342x\b\356D\242\nb=\206\352J\300D\214R\332\260\215\275D\205\311\356*\360I\334\373\370 \036}\001\224\347\036}P\365x}\033\017\247\001\266\251\254\301l<\234\b\017B\331\025\312.\017\007B\347\322d\237\013c1FABvY\300\260\354\262\274=T\230J1\242\"}\255J\315\240\316\214\224\004\255T\265't\362\\\225)\351\346\023"
+	.ascii	"b\b\b\303\254&Z\255\367\201f\313c{\233\350\244\016\273\370\002"
+	.ascii	"\\\206\213\212\276\241e\226qa\374\030k\267j$\017&\207g\333-\362"
+	.ascii	"\336\327\324\003"
+	.text
+	.section	.gnu.lto_startRxBind.22.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \330\025\006"
+	.string	"\"K*2`M\323\030\300\020X\334\034\b:\260\226\371\0226\324A\007\264!"
+	.string	"\255\216\304\366\313C\306\301\377\301\360\021\004)[\355>\236j\370\312\224\007\f\"\267L\001K\321\003590X\317Y\317QSC\204\223\336\204\213\004\256$ \236\243\250\252\347\236\270\251\031U\350B\263\235v\220_a\321\322\242\na(\366\021k\312\361\351\254f\376\266:\n#\233\224\201\222\335\313\212\312\232"
+	.string	"\220|\374\327?#$\\\303\214\036\227\334\320d\210lv\243\323\216\204\331\340\231 I\020r\222\241h0X\266\200\205\335\275Y0\032\271\346o\360\027\3740\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_getRxBindSupported.23.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \330\025\006"
+	.string	"\"K*1PO\323\030 \330\fL!\034Ab\370\237\252h\031\270P\rKmqD\304\346\243dC\354Q2H\220\231!@\375\330\267Bg\023\302\244\177\223[\246K\321\003590X\317Y\317QSC\204\223\336\204\213\004\256$ \236\243\250\252\347\236\270\251\032U\350B1v\332A~\205E\313L\025\312P\354#\326\324\343\323Y\325\374mu\02486-\003&\273\230\027\227U\001H\t\371\257\177FH\270\206\031A0\331\201\242Q\262\331\215N?\022f\203g\212$\301\b\013\311\312I\006\313\026\260\260\273\267,\263\221k\376\006\177\301\017\003\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_doRxBind.part.0.26.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375`w\001\315\016"
+	.string	"\206[bE"
+	.string	"\261&\035\274D\001d>\321\212\030\202SO\316\377#\311\001\330\333\226Q8d}%\2473\232_\027\236vl\031\032U\3013\230\001\215\232\210\351\377\377\357\223\016\317S\020\231q@\201\330\311s\020\022\273\367\2262\245Q"
+	.string	"H"
+	.string	"P"
+	.string	"\377fT\t\274\f8:\346\374\260\307\375\360\3552\302\325\320\346\177t\247K\002\217\312u\033\016\341\310\317\213\034 \335\005\030\242\242\341\376]a\272\224.\f\221\321\301\206\250C\301\021V\f\r \035\006\325\001\017\205P\346\234\2768\334\327mG\260Mb\237'\336\320\341\\\031\333\352\275\367+T\377*\300B"
+	.string	"kNU\020\217\031\023a\214\260}\373\237\311\026\331.\266\310\253\367n\263\375\233\252\225Wo\263\211\034\207\213\023<s~$\2176p=\3327a\223\023\323\312\266MN\\\274\005\272zC#E\215\224\002\265\220!\346i8V\317n\313\001nA~\327'\245@\266U\276\"\273\346\234\b|\025\307\241\340\213x\364\n\213\236{\364Y\344\343w\201\207\032\357E\203nl\233n\\3s5c\346\201\307\177\217 H\354\3709i\017\335V\243\022\211A6\222N)\031\225H\017\032\264hX\213\206\225H\016T\260\024m\005+\021q6\001\202\206U\3102\r\023}e,g\240\310\331\211\377&\377\035z:9;z\235\357\302\254Q^\026\345\225\021\200\332$\tz\316o\225\350A\355\311{\0055\235\017\334d\037"
+	.ascii	"J+\200\244\216\253\332\300\016;\314G\2607\020+\350a\024\275\030"
+	.ascii	"f)\254\002\037d\374\361'\251XX\207\2455#p\006\244A4@\024\fs\205"
+	.ascii	"\223\235\211mU\274\251\"\342\fGT7\327\034\341\234x\t>\r\332\360"
+	.ascii	"WX^[\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \265\315\003"
+	.string	"\324\005\261"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\032\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\030\b`\025\177\t\006\026\177\n\272\220\202\002\027\177\013\001\031\177\f\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\003"
+	.string	"\005\351\221\2719\001\304\001\003\002"
+	.string	"\340\236\212\256\001\001\242\001\003\003\002\"\003\004"
+	.string	"\n"
+	.ascii	"-2\350\230\031V\205\211\313\036 \267\223\315\340\246gp\201\217"
+	.ascii	"\021K=\001"
+	.text
+	.section	.gnu.lto_.refs.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4077cfe9140339fd,"e",@progbits
+	.string	"(\265/\375`R\013%;"
+	.ascii	"\312eh\026CPdN:\203N\236\225}|\325AEoj\305E'|\252@!\306o\324"
+	.ascii	"g\231[\330\267\024\214\002\227[\211\205\352\031?u\003\200\240"
+	.ascii	"!\216\002\202\216.\200\240.\361&\201"
+	.string	"f{\207\210x\"a\322\266L\001,\001\\\001I\0017\n\336\221\341S\345\236?\277q\343D\307\314\257E\2618\0214\345\236\334\206\363\332~\342?f\322\364=\317\314\364\334\351\317k\324p\032\025-m\367\34447\231\203O\354\236\227\221\376\377\343\226\321\374\030\250\270N\330\035\327\335\t\316=i\002\017\335\363-R\006e\310\240=l\030\002sO\276\3430\334J`1g<\036\363\"d\333\355M\202\350\313\334=\227\330\t\275*\322\263\0044\030\030\310\022\320\233H\017\"\275\300M(\024{1J\266JB$\232\230\275{\236*\375\203\364m\363g,\034\307sAe\031\333u\335-S\321\\\336\025\344=9\013k\341\226\347~\346\302r?\345\330nv\267HA$\332\033\274{2`'\364\344&\364\274\345IrM\365\233\236\241P%\206B\337\262\023\232r\023\3723\204\t?']\356zxP\002\301\177E\374|"
+	.string	"\352\347T\302\317\377\257\342\302\377r\3709\302\317\017~n\3603\202\237\027\374\234\340\347\373?\321\317\003\376\353\375,\340g\246\377s\377\221\376\267\371_\024\030\030\030\370\177\317\177\r\374F\037\002`\270\214\030\035&f\316\360\232!K"
+	.string	"1!$\377\035\273b\027\3075\273\313\253\274e\227y\303\356\331\275\301\355%\343\274\337\344\265\361\247\266;\331\335L\307]\270\316\013]\225\f\227\354\366\005\013rY\246vtlv\356\360\037\0346\222\360\227_2\266;\237\016aK\2430:M\374\272\333s\334?u\311\370\020\367\005[\270\006\223S\206\202\r:i\342\f\352n)<QH\321\306\n\325y:\317\266\216\233\320\213LJ\002\327\307\332\245w\335\222r\"\245>6\"y\367\374}\222\376\266\245\277;\322\337\260\364c\330\t\025\304\203"
+	.string	"QAm\370\364"
+	.string	"\t\002,\372\301\244,\316\337\031\360x\200\324\344"
+	.ascii	"\336\223\003\361\233\363\307\335X\330=\377\307}Eo\200{\360\354"
+	.ascii	"\244~\354\247\217\220\213\236\241\3003~}\002\254\031C\243\314"
+	.ascii	"s\356\323\227\224\210\365rO\326\303{\270U\300|\202\253\\\307"
+	.ascii	"!%\262\222\310\320]zV\200r +@\377\307x\030/\017y\004\317\333"
+	.ascii	"$\341\321K\203#.]\342&\224\351\004\360S\304M\211\221t\216\234"
+	.ascii	"$&\230<xp\316r\276\227\326\325\365\231\335\223\367.\3531\337"
+	.ascii	"y\217\343\034\003\325\205\311\226\367\316n$s\203$\346\006Eh\226"
+	.ascii	" \347\320\363\354\226\376\217\337\374\001kh7\267\354\331\362"
+	.ascii	"\242\335\036\277jW\355\256\245k\367\332\366Y\007-kg\006u\332"
+	.ascii	"\022\352\277>~\327\276wg&\b\225=\341X\0163l\367|\360H\372\240"
+	.ascii	"Z\372\373\243\3359\212\332^\202\t\317E\214\304Av\360\377\354"
+	.ascii	"\376\037\244b\273\243\350\005J\241\340!\327\0304T\367\272T6\335"
+	.ascii	"V&e\023\331J:=&\223\262\355\266\002\335\024\322\312\226]Ov\275"
+	.ascii	"\335v\322\215\331Iv\355R\266\275\354\226]\227:\311\\R\266\310"
+	.ascii	"U\331tc\262\262\3112\231:\331k'\221mi\222e*\335\260\314%e\023"
+	.ascii	"\311T&\335\230\334-\333\274g\246u[\303\272\211D\352\356\262\026"
+	.ascii	"n\025v#\227\275\362]\263v\3633k\266f=+\255\220\356\356^\353\356"
+	.ascii	"\274\261F-"
+	.string	"X\353)\243\260Ya\335w\332L\303\312\253X\203\255\334\035\326.\273\301X\027i,\317\021[6R'\221e`o\2540\f\214\025\353(m\314T6\337\330)2]\232p\r\326\256\f\327w\334\226ism\233\001!5\223\244\225\335\363\356x\34238p?\004\245\377\325q\327\233C\311\257\254\b\240B\227\214\r1\231`;&\025\243;\302\206\353(\221cD\034\030\344K\317\212\302\260\365\245\032\t`\330\372R\215FX\304\243\312\325\325\345\225\202\030C\300Q\035\036\215GI\177J/D\035\325aW\210\257*.,\245_i\251\304\"1Fz\r\033,l\350\360\005\340\370\254\250\246su\021U\251#\027\227*ut\264\n@\354\252\241\202EU\n\241J\304\322\232\301\245\242\370R\267\206Z*\321\270t,zq\211\020\022\217\303\252,#Q\205A\254\372R\221h\f\253\260\206\304\252+\365H=\242\020p\264\352"
+	.ascii	"\240H\302\350\245\036Q4mqq\205\260*2Z\021\217\303c\212\242W\325"
+	.ascii	"\227\272T$a4\022\257\270T\024W\352\322\221X\342J\025P$\241*\035"
+	.ascii	"\2556L\035\213Z^\351\026\261X\034f]\035\r\217\303\0210\214\216"
+	.ascii	"V\307\324\270\202(CK\005Q\306P%qUu4\016\267\230>5%\202\301\212"
+	.ascii	"\023%\322\253(\254\242\326\013\253/U\352K\225*j\reH]\251F\251"
+	.ascii	"\250\002H\210\234_\324\214\274\035YS\3522 I#<\216\224\\\201s"
+	.ascii	"s\317\017\031r\211\260\\\2371\335\222\017\352\250\016P\n\221"
+	.ascii	"\367\025\361EabG\350\355o\267\215\323:(\007o\355L\025\244%^t"
+	.ascii	"\204\251\223\262\354mK\233\337\354\322\240\224\254\330\341\020"
+	.ascii	"\362\367\333f\344\004\312[Y\036\333\271\275l\227\307\223\\\257"
+	.ascii	"IC\342\364@\033\324\235V"
+	.string	"\001\311\207\030BK\300\244i\367G\332\r\200\344\250\201,\310\0244#\"\"\"#I\223t\240\002\221)\2639\021\200\255shJ\222$Y\366\f\324\016 <\352\242\253\270\253\026\263\305\221&\265\241\231\306\262\236\306\324\223\221\214\355\264KrP1\237f\004\030\026\351\033+\361\337n\255\235\306\006%\356\231\227\231dMj\203\272\025%s\256\274\001\244\370J*N\340\241;u\027\246xU\230\\\254;\r\220\212\344\025\270\372b)?QZr\235)*\341\205r\314yA\337g\211|%\364\210\322r`l\ta6&\262{4\313b\203\204]\314R\236\223I,\\4wEr\302\036\3119L6\031T\307'XP\261\313\341[\247\206N\207\304\345\366p*\377\021\242\235#\005+\237t\205\022\037\252r\376)\354\353&\316\021)\223\371\340\322s/\224+S\322\307;\216\260\030\254d\326\314\376\263\246\354\006D\003{\003"
+	.ascii	"\214\274\3707\300m\265h$R2\270\375\033=\374\3071\001\220\214"
+	.ascii	"\251\213\007r\320/\033\362`\263HO\271M8\3572@\230G\017\034\n"
+	.ascii	"\2017kP}\r\245\314+\001\262\316\217#\r\217\333\215<\177\362\320"
+	.ascii	"\355.;\332n\356\264\3478\003\311\177\250qC\020ti\345\230\001"
+	.ascii	"jc9\324\315z\002\312\207\262\364P\202(\333d\271\361P-e\026\023"
+	.ascii	"\231Rg\324E\321\252z6\211\307\372\277.\233_Z\350s\307\337h\330"
+	.ascii	"y\237\200u\257%&\342\306\t\227\324e\271\t\236m\003\274SDF\350"
+	.ascii	") \b\021\310\345\320\224\353\fb\251\267#W\367\007\276\302\266"
+	.ascii	"#@\177\327l\"\223Q\344\005s\337\b\003\2773Q\366\f\376\313\245"
+	.ascii	"\333p\034~0\223\177/X3\314U"
+	.text
+	.section	.gnu.lto_.symtab.4077cfe9140339fd,"e",@progbits
+	.string	"startRxBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4077cfe9140339fd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
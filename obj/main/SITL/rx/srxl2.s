@@ -0,0 +1,1487 @@
+	.file	"srxl2.c"
+	.section	.gnu.lto_.profile.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\223\002%\020"
+	.string	"V\026WG"
+	.string	"\2576\215\001\300\034\367n\311\375@k\354\344>dY\025\206\307P\320\325\327a\330\f\301\224\264\237y\275C\177U"
+	.string	""
+	.string	""
+	.string	"\200\nP\277\364\377\377\277\032\362\277\234\333f6o\377\377\355\367\377\377~7\021\021\332$In\022F"
+	.string	"E"
+	.string	"D"
+	.string	" Z6\027\300\355}\r\201\313\245\344\343\346\336\236\257\366\302\242\204\313\343`r2\270\350\3442[\333\267\036`\311\350\260y\nZ4$s;I\201\023C\233&fT\\\262l\271\\b\253\276\023\235\021\016\030\b\226%\b'S)\364\206^n\252P\311AA\002\r\372\363g\372<\334s8\bj2)\033v\304\321\\\261P\"\324\357\317{\367\302\225\214\005\007\242l'\246\346&\004\342\254\300x"
+	.string	"\342\246\316\t\021\221\017\365\204\335\035\267\001\3645M:dc\211\321\260b\374\360\240\337\237\201\f\206\001\313\253c\337\f\f_\255\017,\216\215}g'!\304\312\b\225\370\322\262\262\321H\325\372..^\037]\257%\217\304\b\206\024\224\\\212\236k2\363\202\020\330\370\270\373\370x\355\\\036fT  ij\026\224\204\f\330\367c\217\247\244@2\241\201"
+	.ascii	"l\3545\024\021--\002\\\340\205\311\r\b\200\356\256\203\343\r"
+	.ascii	"\325\340&\215\351\251\351\250\351\247\351\244\003Q\250\221%q"
+	.ascii	"\312\320\210\224\202\202\222\264\032P\202b\310j\036\022\240\324"
+	.ascii	"\n(\325&\270\245\255\326\377\f\243\n9s\232F\306-i2\272,\212\204"
+	.ascii	"*\230\30194\270\271\315\241\361\235\n\225b+W\313X\365\322Z\264"
+	.ascii	"\r\036\3547y\234\237\262\354\b-1}\345\227~\270\023\254Mv\234"
+	.ascii	"\343\020\327-A\034p\020\207V\230\022\311\024kH\\\233\367\335"
+	.ascii	"\301\177`\237$\242\337\365u\204\002~#\254\350T\352\221\314\215"
+	.ascii	"$\377\34636\r`\210\213^\201\350\202(\321\355\333\236\211{d\344"
+	.ascii	"\362\241\327\207\374\217\026nG\bw\355"
+	.text
+	.section	.gnu.lto_.ipa_sra.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\305\006"
+	.string	"2\210\030 \200\305\031\01630\003\254#\00330\203\353\302\210v\002k\b\2748\b\3641\201\374\266?\3312\245\356\n\020\232\350\031\260\241\344\223\004P\350g\203\374C9\246\274\30103~\223\013\323*\b\346\234$v\304a\riq\371\332m\326$z\257W\311\"{\205\244\250\265\032P\246\366\030}\340\026]\035/\b3 @\002\203\230;\017\355AR>\f\2150\310\006\007\207\263F(\002\361\207\234\251\007)j@\310u1\022\374V\020\034 \022`-"
+	.string	"#L\021\3003\2408\3400.\204%(\032\" k\263f\306\246\026\030\267\264\301\346\323\027\026\312e\\ \335\001j\307\205nB0\365\212\305"
+	.ascii	"{\3568X1\bp\242\224wM#O,E\255Q\230?),\214S\270!"
+	.text
+	.section	.gnu.lto_.inline.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`9\005\005\027"
+	.string	"\266\337nG\340.'\215\001Q\252\t\334\343>4b\216\327O\327\323\305\260\223\237\317\227\337\255\215I\207ft\020\261\374\357\233\240\201\260\210\233\177l\224\201\030\303!\306\260\260\034\321\374\342P\317\023\266\022\334t}\2315b\304\222-e\nP"
+	.string	"]"
+	.string	"c"
+	.ascii	"\rv\027\346Q\t\342\003\342\316\017\221\203\325,\ro\026\235\233"
+	.ascii	"[W2\266\352\376\002\232y\334\270\247\271\036e\352\263\273\254"
+	.ascii	"W:\273K\242?\001\315\363l\321\244\335\3658\305R]A\335\335\355"
+	.ascii	"^\24617&\241\024\375\224\351\f\031\t\035B\036\344N%\036\203|"
+	.ascii	"\242~W\352\013\3633\363\257\3018\272\321\230*1\325b\250\336%"
+	.ascii	">\205\25012Y\240-n#.\230\374\021=\024\267\031$\r\035\262\260"
+	.ascii	"\003\264\321\002\360\271\306.\334]\325/0v1\365\351X%L\314\271"
+	.ascii	"\301\341\201\311\242Qm\202\323k\327\177a\364t\035\215\277\360"
+	.ascii	"/\334\340@.2h>&\371\013i\031\212lV-Q\351\207H\246\365\b\347\271"
+	.ascii	"\0067VW\214\227)\366bI\212t)\312\340H\263\321\212:\026"
+	.string	"\tZ!\002\310k\252\340\2034\362\204\341\303\013X+\300_\030\377\026*\2770r?\212\236h\246\236.\252\023\362\027*P\033\315\346Ac<\333\021\316\022,\376\037\263\bBC\001\317t\246\335\345\360PI\355f\273\333\261\001\220s\211\033v\367u\n\213\202\021\005\365\311\347\251\377\245\362\366\326\225\214E\033\020\017Np\374\213.\221hJB\320\255Aj\"_b\017\004\026\024\016,\340\013s\266K\223\372\226\230\003\323\303\223%t\027\034fj;]\242\3426D\203\3515\032\002\200\201\250\321@\206\020B5D\222\222B\241\003`\242!Tg\036\022\300\2441\246IEF\210&\260\260\240\240\225\255\003\374H\362\\\226\225\251\264F&\325\\\354X\037p7\325+\241r\006\327Z\036;\346\341A\373\274%\210\350\275}2q\373\027\273?\325\321b\306l\231\250\273[\360~-\n\037\263Cc\020yZ\212\347\366\372\r\016"
+	.ascii	"\370\213VK\004p\377\237\335\221\223\037\3566\366\255\240\246"
+	.ascii	")I\312\212\236\216S\004\3626K\n\253N\263\2267bd\304Ee[\202cZ"
+	.ascii	"I\364\276pZ\3651\332\363hg\301'\242\224i`\306\375\027\275 \313"
+	.ascii	"D\326\340|\003\177\335b\025\312\023\374\354\341\217&\312\321"
+	.ascii	"\243\f\324\r\330\241\301\255\247\335\246\221\226\301\031#\307"
+	.ascii	"\250\221-\320vP#\343\304\267\370\361\355\342\205\262\0042\007"
+	.ascii	"-7\341\226\214\370JA\344\362)\031\271\243qEu0\037\206\031\343"
+	.ascii	"\273q\030\240\327+\263\265\206\247\273\002\310\277!\237\344\206"
+	.ascii	"\252\b2\222\257\312\207\262\343;=65\372>\352\013\303\024\325"
+	.ascii	"\331\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\024\005E\022"
+	.string	"F\031M9@m\222t\306\301\202\362tQ\333\377+O\361\020\222@\321/0\216\347\"h\016\243sa\035\003\347(\310J\036\267\370\373\212\315\277\f\266\250u\215\277\036\206\026\331&\210\020\231d6"
+	.string	"<"
+	.string	"?"
+	.string	"g(\365m`%/w\221\003H\001dS\3621x\337\037\007\3269\301\243\212\221"
+	.ascii	"x_\327\304\3274\347\255\265\363\275\200zM\351|'\274\224\013z"
+	.ascii	"\352\333h\220I\002\263\250\327Q\340[\177x\017\327\2123\230\204"
+	.ascii	"\265\350\364\247w\361\325hZ\323822E\330\246\b\273\3349\031\304"
+	.ascii	"\245jm\322i\255\265\353\224\001z\017-\031\311\222\221>\r\254"
+	.ascii	"\353)\325\001j\232\276\f\254\213\370\244\233B\247G\240T\300Z"
+	.ascii	"2!H\334\2004 N\202y\304\372\355\"`\377@\273A\241L\336`GP\177"
+	.ascii	"\365\006\232\2105\255\265\024GL\3550\n\255\265F\023\363\004S"
+	.ascii	"\001$_S\245\322S\017"
+	.string	"\240\336\001\205\005j\005\003*GH\240\216!\324Y\203\217F\250\252 I\322\005\216\252\276\007\006\263$=\017o\213\203\001\331AF\227\270\2658b\022\013\f\254\037up\357\013\t\261P\b\r}\250\001A\251\f\t\325\244\240P\030\306`\"!fd\036\022\340s9D\342\030R\006M^X-\355\377\006\251l\304L\r\245W\t:3H\"\203>\007\321+\335\2270Y[{I*\310\007\211%\204\252\331\002\n\310\0218\2000q\027i\036\2353\030:\350\345G{\016\022\311\260\362\320\n\311\003;\\\210\266\301\004\276\341P\271\224\202\037\001\311\330Q/\003|q\344[l\347\332\336j\222\n\337\300\205\375\223|\216\021\353\254Qi\364h\371\017*\217\0034\244\364\311\256\004p\016L\225e\307F\005\357mg\242\254\020\344\366\271$A\310\255\002t\271\224X\b\311+Z\220\310\313ZD\231\225\315 \016\323\241UV(r"
+	.string	"vh\355j\\\031:\324\027<&\252\253\226\005\356,\232j1\215\351\232w\207\2200\267om\355\271g\310\201\240\240k\034\354\023/v\225\205\337\253\325\002f,\271\245B\022h\325*b\332\022"
+	.ascii	"\b0\351\202Z\261\001\225'qc^\021\003"
+	.text
+	.section	.gnu.lto_.pureconst.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375 J\005\002"
+	.string	"\242\004\017\026\220Mc0\306<33S\314\355\027\\\260\200m\017\030\005\270K\006#5NW\232E3\350>\327\271\315\310\234\313\251\334\344\\\0279\217\321\030\213K\334\341&\334\202\013\334[wW\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\256\001\365\013"
+	.string	"&\223<9P\245(\303\001"
+	.string	"\327\231:\313\231\312\030\305\311\266\245\253\332\223\253\300\027\313\335\230\231D\364<1\232\246n\020(\376\367?T"
+	.string	"\360\265G\b\364\005\360g}\207\331\344\260[\312\024%"
+	.string	","
+	.string	"2"
+	.string	"\355\315\271+\327h\177\013\033\365\240z\266\277\327\252\006\225\203>\006\317V\336:=\345\236\316Ny\247m\205\335\227@\255\300\245\013\316a\032\033\357\306\205\226\352/)\325\274\312\257\316Py\250M\350)Cp\312\036\346\306\346?y\223W\004f\3123\035\033\013 \355\237\366r)\224\200\312"
+	.string	"!$L\331\201\222\373(\177\330!\343\336\340R\250\001\001\336sTn- \225\241\242r\021y\245\334\243\327\205\351\250ss4s6\034\222\222\2155\306\305\363\215Y\312G,\376\nRh\3125\235\"\245\270)\256\t\346\r\351dR'*4e\257\364\336{"
+	.ascii	"\236\n\030Q\005@\250!\2651\020\242\221\231\244Z\032\003@\002"
+	.ascii	"c\230+>\020x6S[\r~\210\021\201\220\207\037\2078\201\276\373\241"
+	.ascii	"\244\256\352\0240\225,\270=\325p{\325\212\025\314\322\356{\230"
+	.ascii	"^\356\275\322t!\216\254B\024\013\303\003\027L\373\340\265\226"
+	.ascii	" \213\3007\007\374\261\020\322\251xG)\310\004$NtR\256\247\217"
+	.ascii	"\272\375\0014L\317%\357GfP\3513\234\233\3304\2448Z\211\256\313"
+	.ascii	"\007\b\032\244\216) @\223\033+\314W\267\007"
+	.text
+	.section	.gnu.lto_.lto.856f49b1e47963f9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_readBufferPtr.34.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\303\346\241\013y\275\001,"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\350\037w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_processBufferPtr.35.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\203\347\321\013y\275\001-"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\250%w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.45.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\177\002\315\024"
+	.string	"\206'\213I\300\324QcTJ\362\303\220\031\242\034\020\241\236\315\342\035\312\330R\032\021\\\234k\340O\310\240\200S\353\274\022UK\333\016\320\235\0050"
+	.string	"\254\262\203E\201\311D :\001\2521z\006\313H.\221\234\024-\321\267\255\334R\312\224\002u"
+	.string	"p"
+	.string	"y"
+	.ascii	"s\332Oz\257v\037\316\007\334;$\225\343\336\222\201\021\210\017"
+	.string	"]\036\305>\024_\300>\264m\226\0075\333^\022\365\234wbg\311\352\336\322E]\334v\033V:m\376\355\226\"M\t\231b\322\005=\254(=GdK\247S\023PA-11\253\030tZY\230tN-]\256\n\220q\004\351\277O\036]\316\234,\227{\257'\251Kq\263n;\204m\007\366\214\n\264\303\217Hn^\331\236\335F\215xo\356\345/\311h\342\275\367F\017\351K\330\207\247/~b\354z>\334\f\332\345mR\236}\032\f\006\203\246C\366}\277X\247Yu\332\326\351Z\247i\235>\201\024\340\216\005\217\244S\345\355\t6\271\300P\007\214+\375\366m\327\374\237O\374\3624jW\2729p+\357m,\302\221du\257\217\202\207^@\325\n\217\202\371e_\370\017\203_\017\307\242'\262\n\267C\226!D\0022\343\336\213\263\341?\016~\235G\305\313l\361\235\376\364\362\037\214Y\217\261\017!"
+	.ascii	"\r\331\365\250\256\363\373q#\244<WZ$7\257\334\340*\226\322J\277"
+	.ascii	"\363\223s\2467\301|#\307d\346\311\207\276\214}H\251\006 \243"
+	.ascii	"]O\350\007\n\005\222\352\223)R[\304\314<\351Jo6r\224\304\207"
+	.ascii	"R^\3605\366\0011\232lFC\213\215\342\030\363\020\023\373`\r[a"
+	.ascii	"\031a3\322\\6\243K\006\"f\306\005\033i\256\225\024\317hb\243"
+	.ascii	"\213\304l6\272N\312\373z\351\320m\326.8\232\343\233zo\213\026"
+	.ascii	"*\245z\357\275Ve\266\356(\373\032\377\301\030 \"\355\b\022f\323"
+	.ascii	"\n\240\016\275\231E\355\t\007\236\254\302I\301(\310L\n@(\300"
+	.ascii	"U\254]\341>D%\226\332\263\367\340ai\030D\212\211\357\324\266"
+	.ascii	"\020+ `\002\221\300(\363c\204\036\f,\330^\225\021\333HX\305\255"
+	.ascii	"\234X-\215\265\346\236\214\240\304;\330\340\335\203\263\236\216"
+	.ascii	"\207\013lP\001!\270\027J#0\206\3555\201\261P\265\024\263\022"
+	.ascii	"z\363c\245\310?o\213\317\330\245\004\313Q\355\315\026\304\306"
+	.ascii	"\233\001\226-\304>c5g\026\270\020\336k\336\344P\227\213|\005"
+	.ascii	"\207\2431\274="
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.46.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\323\004]!"
+	.string	"V\375\330I\200\030R:\341\222\336r\001\032\237\310!`\265a\032W\372\334\357.\177?\315\034\330\246\371\035[\233\314\265\373\350fuHf\314T\033l\377\352\356\003\332\330\034\030\321\177\002q\237,\222\331\025TA\361\274V\373\t!\204\310\235d\303"
+	.string	"\272"
+	.string	"\306"
+	.string	"[o\362\216\231\271b\374&\233rLSm\034\376\344Y\306k!\255\307\246\265\271\345\266v/\263\301Q\026Z\217\002\235\226)C\007\300Ef-\211p\313|&ob<\326\214\007\270\267\007\234\224{\231\0178h=\312\314\347\244G\327\337\244G\331\310\254v&\325\375V\025\345V\333\275\267\327?x\265\306\347V5E\317\266F\376\361\271S]\2521\344Z\232p\234\024\336\326\304\224v5\340\343\t\352\352\233\307p\366&F\352\t\352\351\223p\034=\031\350\270b\203\347\224<s\262\360"
+	.ascii	"\263dO\033\3573H\311\033\031\317\ty\362p-\001y\363\226\311I\311"
+	.ascii	"ZU\350\336\313v\351\364t\326\235\231\253\230Y\310|\016\tYeH\373"
+	.ascii	"\306\314'N\206b\275\0279\201?6\302\267\006\231\321\350\02357"
+	.ascii	"\254\377\227\362\247\\\354\307\017\302\300\025\366\313\025\351"
+	.ascii	"\3217\037$\225\326F&\311\30613\217\266\247\306\200\214Uq\367"
+	.ascii	"`V-\377\370\234\371\023\350\371\327\231\347`\347\035\235w\235"
+	.ascii	"s\216\365\343\\\353ls\2563o\265\\\263\263L\223\263\274\323Y\326"
+	.ascii	"\351,\347r\226W\325\262\252ZNW\313\250j\271S\313\007zTU\226\225"
+	.ascii	"\007T\356\255\021\007w\315P1\253\177\375`\177\327\257\365sEy"
+	.ascii	"\030\230\002 $\200\213\2342C"
+	.string	"\344^f\321z\364\013i\013N\305\241\360\275x\327\365\302\353\f\313\332\275\267\304z\324>\301\365\336;\201\317\005\203Q\311*\243\007t\301\262\277Iy\335\323'c\025&y\2456\317N;\270\3320\254\270$\341\322\336i;\246<s\300\3324\263\261\211\321I\372e\332\017\373\243\230\330\314\220}\354&\225%'U\375M\212\323:]\302\252\231\274R\242@\365\266\226\376X\346\n\027\272\217\005\216U\226\240\032R\264\207\262\272d\270\231\206 *\336\360\262\016G\005\240\241\375\346\027H\225q\303:ul\377C\372\323\314!D\330/\331\310\216\245>r\307u\3774[%\224\222\215c\034\253\306\361\226\363X\332\3409\315L\302\204\375\262\333v!\201\273P}\344wN\337\353'\231\0206\345\031\004E\256$\351\236b\024\351{(G)\210\272\210\350\013\236E!\3607\004z \"\022\207;b\005`\3207TQSD\364u"
+	.string	"\026}\305\020\300 QQ\370\002\304\321\220\347+\372,\264"
+	.string	"\n\205>\026\277\035\377 Hhq4$\366\216\206=!\221/\330\373\r\211=\b\002\330\310\005p\330+\032\031\r{;\346\275PR+\345z\212\037\366\334U\231\232\352\263\266\225\351H\321\266i\246\207}\207V\206E\355\351_\225\321Hu\232\327LH\251MG\335\370\222\345\005i\337\316{\357]m\272\246}\332\246)\241x\272\246]X\261)i\232\237\306\302h$\001U0=\212\216-\307\374\313\220\361\b?Fz\224\246\3213\246\034\272^{\327O^)\261\2254\327\272~\262H\256\3173$G\013Y\250Q \246\224b\206\021\023\031\tj\nZ\350p\002\021*,n\020`\311\264i\f\344\321\335\257\nj9\353\004D\336\223\316\241\306-\301\220\262\"\311\273\0308\026/_\316\006\201<\217\372b~dd\t\242\024\353\364:\363\2630\215}\205\013\324"
+	.ascii	"\260\237\322\343\3202\362\tF$\214|\\\276\342cs\204\016\211\353"
+	.ascii	"\030\207'Sw\301\334\021\307\257\325?\345\264{\216\262\342\341"
+	.ascii	"?@\332\205\213\032z\222_I\024\264\321N\221\202\2736(X\017O+\002"
+	.ascii	"\341\224\031\0023\346IF\0223lo\233\237\334W\221\323\001\337\331"
+	.ascii	"\206\2673\313\r\244\203\371\331\226\257\200\376/p\340J\222\312"
+	.ascii	"\230\0274\345:\205qz\034O!T\r"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.47.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\221\002}\024"
+	.string	"\026(\213I\300\020)\035\372\217 \034`\357~\241l\341\240\344\240;^\b&\002(#X\251(\002\270\331\261\277\245\302$\375\035o_\031H\375-\316\030\347\322\310a\n\377\212\256\246S&\341\\\312\356\217\3028Cy\3566\221\277\273\355\235Rx"
+	.string	"o"
+	.string	"u"
+	.string	"7\252\375\247\341!\273>4\226v\307\0046 \236z\374H=\025/ROm\373\204A\315\266\217A9\007\342\240C\252\332\035_\023\350\266\263*]Mi\363MH\315\200\n\362ng\211;\257\007\276\300\207&\034T\220\267s\212sSG|\302\021-\236n\256t>W\007z0t\\\274\334jD\206\b\033\007^n\340\341\244d\245\354\256\345\216\347\341\026o;g;\305\226(\002\2635\257\323\301\035\351)^|!\313d\344w\247\276L=\375,\341)\352\031\201\260\221C{\274\311\371c\177\016\207C\034\236>\366\307\037\344Gw\353\277\237U\245)\225\236TZR\351\273j[u\003Ej7g\270c\237(S\211\037\375\366m\327|\240?\374#\032q\207XA\250\234\251\335\261\344\324\016\3049f\030"
+	.ascii	"`s\300\020\b\244\264_\024>':\177|\027\376\213\373\206\266\247"
+	.ascii	"\311\027:J\334\275\275gj\271[]ohwI\316d;\352\357\331v\224\030"
+	.ascii	"\264\035v\\\222\217\236\234\354a[\345K\023\205\207\252g\364["
+	.ascii	"\375\266\352'}\205-\306\302ROY\300\244*\252\223\330\365b\314"
+	.ascii	"\371\343\326\224\263\002\260FN\346\260\335\362 \215\270\233k"
+	.ascii	"\340\253\210\271 \n\235\316\317\324S9)0\211\350\247\340\004\352"
+	.ascii	"\003+\017`hd4F\203\321\"\304^Zh0\030 \324\314\\\263\330\n,f\241"
+	.ascii	"Z\305\344\304\245f6\363\252\231\275`Z`//\225\331\314\313D\200"
+	.ascii	"e1\261\331\213&\223\315^\037\343~\265\323G\351.:\252pL\331L\234"
+	.ascii	"\317\342_\355\356\262\002H[\302\2049o\276\323\245\222\260\206"
+	.ascii	"H\220I\247M\001&\277\363\202\236\233y3\275HeM:\353\217h\210s"
+	.ascii	"\002'\207~\213\273\212\236n\222\307}\302( p\002\031Q\271\003"
+	.ascii	"\235\206\316\314\300\034\335J\302U\303\307\265\221\354\002D\177"
+	.ascii	"u\022\215}\020BJ\274\363\037\267X9L\\2\252\203\364a\340m\244"
+	.ascii	"\255\325]\373\241-\276\225\217>\210\207\302\201*V5R\215\204\217"
+	.ascii	"\3340R\3622i\002\315\016s\300\t\361/gk\210\350\367+\263\315s"
+	.ascii	"J\321\367"
+	.text
+	.section	.gnu.lto_srxl2ProcessPacket.48.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\256\001\365\017"
+	.string	"\366]jE\360\262h8\320\243BOZGMsI\031\3445\323\373\b\2548\217l\251\031\246\252\326\254\330\216\236\\\037Y\263\020}\023\204\227\316\016\263\203N\250\346\201\247\343D\016\313\027\312\225\3032\302\216\210\355\033\356\275\245L)V"
+	.string	"Q"
+	.string	"X"
+	.string	"8f\354\216\016<\342\235\363x\221\356\234\367\003\3359\333.y\240r\370\221\204\3530;Xfxv\307Oa\036\236\3334C\177un\302L|\265|\273\314GX@X95\257\226k\213\325\211\304nJ\200^+\232"
+	.string	"Lv\327)\276D\334\335m[\260\035\301\316"
+	.ascii	"\001)\236\211s\276Jw\356\212\342G\n\231\207\254\331\343*\365"
+	.ascii	"\305\276\326j\265 V\230\3554\310i\357\343\337]v\347\226~(\364"
+	.ascii	"\301\263#\001g\327U\353Y\032G\343\204\355\333V\331!\333:vHP`"
+	.ascii	"[\263\020\r2\355\253\370\n\325e*7\260\013\013+5O\033\234\r\224"
+	.ascii	"\234\332%S^\004i\210+\007\255\245+\237\346\004n\320V\351\363"
+	.ascii	"\330M\254\206\352\213\017\303\217q\031=b\326\305\205\377\302"
+	.ascii	":\336\202+\350\3169\305e\341\021\363\026\266u\264\307\306\356"
+	.ascii	"\352#l\353\244\270\fB.\255\374\261\315\341,N\336n\013\202?C\005"
+	.ascii	"#\224\bUaT\"\241PR(\244\300\001\340\350\202h\224\241\363\tI\211"
+	.ascii	"\206\024x\372R\340\207B\022\225\276\023\360\364\221 \260i\303"
+	.ascii	"\b\374P&\023\370\205\306\375\266\ns\227\363Cc\223~\330\205\037"
+	.ascii	"6O/\363\315G\207\2024\025\204\246\262\374\231\333d\343\004d\247"
+	.ascii	"\030Hy\321\323\020\327\016-\" p\002\241`\325\r,\n\355N\206[J"
+	.ascii	"@\021\272\360\301(/\263$k)\311\214\225<\344I\267}0DK\363\313"
+	.ascii	"\031\210(\352\265\243\201\363\354\202\374\031\030x2\332\274\360"
+	.ascii	"\347\017\036\316<\033\207ga\2061\200!\036Q\343\317xm\017\307"
+	.ascii	":\367\221\001"
+	.text
+	.section	.gnu.lto_srxl2Process.49.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\302\002\005\026"
+	.string	"&\350\217I\260\226Nc4\353\264\216=\002\002\275\3550\220\242pu;\2229W\312Ep\323\002\236g\371\210\220c\021\271\215\326\366\210B\321\266\254ukI\234\203\257\352\265\277\227?I[\263'1<\301\3153\027\026\f\333{o)eJ\001{"
+	.string	"p"
+	.string	"\201"
+	.string	"\275\251\252{\203\017\274\240\274\350\340U\306\213\345\r\214\027\235\263\215<\370\273\227:wOK\356\275\263\232\364\334Kr\024m\2459\037"
+	.ascii	"O\367\362@H'Q~3F\233\240\267\202\211\214\267\263-@\266v1\036"
+	.ascii	"\021\025G%\243#.\216\220n\255\212Q\214S\306\033\262\016\302\254"
+	.ascii	"\222\304xB\264\312xA\266\345\336{\247\323\"\236\020\245\244\314"
+	.ascii	"\275\327\364\344\035\335(\267=d[\202"
+	.string	"M\303\002O\207\362\361\227l\323\241?/\372:\343\305\327;\235\201\t\250\032H@th\007u\264\372\354\327\341p8t\355\331\007\376)\027\336\261\221\272\024\251IK=\212\324\326R\323J}\001\005\226\f\241 \344^\243\241\223\273%^\311\270\360\267\177'\307\354\340o\344.\374)oUYTBE\330\275A\227\213\216P^\034@O\355\333xS\356@\022'po\317\3521U\326\021KJ\353<a\254&\246\237X\336\034}\254g\231\033h\350O\232\361\242\310\025\305\204\004\2060J\313V\237\311jk\2451V\262\256\024\331=\341\360+\363`]V5'\362\253:\327o\254\007\363r\207Sy(\357m\021S\332\372(/\240\220\016\377Z}/n\216\264~p\372\022\242Ml\323\256\303|\371\331\265\347\250Q\320e\233K\205(\357\27518F\340\260t-\371\324\027%\340\003\346m\002\210\032\216v\303c\336\320\314"
+	.ascii	"5\034\r7S\303\261\301\345\360d\350\271\311l\302@\270\351\271"
+	.ascii	"\355\314zn\263\034\033\032\316\314\274\355\314`\016\330&\242"
+	.ascii	"v\233\341l\266\333,\026\274\267\267\366,\003T\203\354\275\367"
+	.ascii	"\226,4\245\332\025,\320\237\266U\327\300G\245#\253\217\307\203"
+	.ascii	"\354pA\361\2254V\237\3773\306*\202\236\222\025J\326\262\272\334"
+	.ascii	"\276\200\201\376\214\325\247`ATu\366\177\354\234\366\314}h\b"
+	.ascii	"6 `\002\231A\325\003rh\rb\210\034\021l\005\223T\327\333Q\303"
+	.ascii	"-\243\262\226e\256\261\233\333\201\025:7\332\021\337\222\215"
+	.ascii	"\362b\017\332\225>Q\3502\205\203Q\361\007\241H6x\3610\205\211"
+	.ascii	"\2761B\307\225\362Cx\032\354ea\2633\266h]\355\317\275\206\b\237"
+	.ascii	"=\336\324.c\003\023\262\214\034Q\373\304Bs\322\360\306\205\023"
+	.ascii	"\"oQ\021s\004\321\336h|\302v\207\313\236W\360v\005="
+	.text
+	.section	.gnu.lto_srxl2DataReceive.50.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`r\002\245\023"
+	.string	"\006\243zG\300\224Q:h&\227\253Hc[\267f\245\266\310\316\005\347\257W+A\212\376U\257@\203\2720\027\276z\212\336\226\311\363\347\367l\201\365\326$\354\375\356$"
+	.string	"H\006\215\272+\362\360\017\324\364qQ%\346\223\266\367\226;\245d"
+	.string	"]"
+	.string	"j"
+	.string	"\020\332\347yO\354>$,w]\f\021\355\342\026X\305\273\fp\002\363\022\036e^:f/\035w\333\223\214\03277\232v\367\323\030\217}\312\2500\346\237Z\022\b\035\241\325d\237\362\202\020\020\255\266\342\261\204I\315\006*\200\332,\246\354\356\177\016O\324l <\265\354\256!\255\226\342>\335v\007\333\rl\030\024:\206\211\221~\314\274\324\"\232\221\034\334\031\005m\227\bx\332\365\200\n\026G3\225\3318\031\324\034\373qw\327j\263\357\363\237Dh/B\237&\364\214\3202B\307\b\255\022\032F\350\017@\341A\212"
+	.ascii	"\264\213b\247d\217$\217\031\266ob[q\267\021{\316J\027\260kk\372"
+	.ascii	"\274K\343\274\227\336S\323\367\361\037\251\n..\363R\352\212\320"
+	.ascii	"`\252Q0{H\246\244&&\215CW\315\250\020\306\217\321\211\276Ce\341"
+	.ascii	"\345e^Fu0\004'\007w\207\273+S\315\361US5\303\017\021\033\230"
+	.ascii	"\3046\206\013\251\274\335\027,\276\216\021+OgFQ>~\320s\314\370"
+	.ascii	":f\265Z*uI;85p\347\253\217\343@\033R\036+\330JC|\265`\254\325"
+	.ascii	"k\305\201\2052k\205\201\007\232\227\314G\363\372@\300\254>|\254"
+	.ascii	"\227\314\267R\300\256\020\255\327\007s\271^\237\tn\037Wm\251"
+	.ascii	"\236\243\032\235\305\251\272\334U\363\244\236\336D\213\031\322"
+	.ascii	"I\245nig\252m\330\205\244Tn\273\373\300\206p#\t\bn\236\360 \024"
+	.ascii	"\274\335e\2714p;\315\310\211N\235E7K\200(\312\246\204$< \220"
+	.ascii	"\002\231!\354\001Ch\315\007>\361\312>\027\363\205\242=\262\033"
+	.ascii	"\255\367et\271.\223a\025\232\200:\252G\264|\247\273\026\022\266"
+	.ascii	"\264\204\305)\345\210\273s\321\030\245\356E\026\016q\250\244"
+	.ascii	"\340\004\254\313\177\300,c\003&]\rl(P\353\005\013;\361\337\261"
+	.ascii	"\213\013\212\023\031g0\303\031\020\3501\005k\264Q&K\022?\342"
+	.ascii	"X\2439\005\325\236\352\275`k\212\300%\306#\210\313\005d\002K"
+	.ascii	"\343\"\307\372\362\266\313\350\001"
+	.text
+	.section	.gnu.lto_srxl2Idle.51.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\270\003\345\026"
+	.string	"V\245\212I\300\224\326\030t\236\213\3412\030\300\376\370X4 \241\341F\230\341\331\340$\0031\355\n\333\263"
+	.string	"D\301.\345m\370\2150\016p\232\n\t\277@\217\002@j\352S\024\202\rD\371\336\274\276\204\326?\254&\265 [J)SJ)u"
+	.string	"l"
+	.string	"x"
+	.string	"E%\037$\235P\354.\307vg\367\212\223\3267K\b{\226\272\376\377t#\336a\023\330\313,\311\321{g\331t\201\245*\216M`\006^Al\216+T*\204X*\304n\f\020\324D\025S{\272$G\024\237\023\351\211\352aDP\344\306\221\230\332\241G\323\205\304\217\020\373\211\252\033U\376\237[p\177Py\272M\227\377\337N\325\037\336\030\357.\321\356\316v\335*LPd\255l\307\371\r\177\034\243f\263\261)\231lo`tD\344\333\215\316{\3010L\342V\027\261\377\037\347\313\241d\257\360\263\322u\222]\366\261\213\033\025\356\255\206\234\346\224\311\345\234\222I\366\024\243\225\310\267S\352\342n\022\256\235\267\313\343\377\377z\321n\367\232\336[z/\331\275\243\367z\3676\3672\n\247\bve9"
+	.ascii	"\376\373\004:\020\346\216\333L\370\237\343twWX\007\255e\301\023"
+	.ascii	"\347x\260\020^\232\323\227\022\375\ru\235\304I\002\351\346\324"
+	.ascii	"\022$\273\\\027w\364e \333\230@\001\006&*5\002\240wcd\232\323"
+	.ascii	"\321e8\264\202<\216\333'\037\213\265t\336\201rw\206k\324^\377"
+	.ascii	"#\024,\323\320\241\rX\377\237{\267\222I\331Jd&\236q[\356-"
+	.string	"MMM\311\244;9\305\205\264\313\261\t\245+\323\222\300\202\016zs\352\240\347\005\232\230\332)\203\336\234-\002\326\206a\006=3\330l\350\031Kz\036\337\2136\302P0\347<\313M\314E\256\220\321E41}\013\245\021\020\376?k\231^`\230U\272)b\t\t\346<\254\233LxEd\b\024\323\3606[\205UB\212\f\324\243\241\227\363\202\334dR\264\225\025\310\017\034 V\n\224\213\272\315V\026\366Ac\021\366\340\261\001X\225\002\345\272\230\322\013S\250QH\246\030ch\002\221\211\232\244\220\016\240\002\031\241\253\016\020PgfD\332\314\001C\\\215D\207E\325\341\006iPm\275\260 \271kI\373\251\036\016e\320\257\374FH\272.\366\362=\223\346\343;\223K\370@\26147% \367\001\r\245\020O(\025\\\205\034F\037\364T@\256\255\250I\031|\322\231h.HS\343\305\"u|\2469j\367f"
+	.ascii	"\334H\351q!\3710\220\267{ O!=\323\177\034\276s\006\3631\265\303"
+	.ascii	"u\367\304\313\035\324\336\244&0\013\336K\025\334\320{\032f'\333"
+	.ascii	"S,\2622l\215\205\321\017\262c4f\023\375\017"
+	.text
+	.section	.gnu.lto_srxl2FrameStatus.52.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`|\017\335F"
+	.string	"\252u,\032DP\236N\007\367L\317u\256Y\317C\b\362\340\332\024\330\241Ur^\bL\255\217\214S\241\002\371\223}]x+|Z=\215"
+	.string	"\023\001\0011\262M\"\261\323\f\031!\200\335\016\223(\232\321R#{\357\235dJ\001\220\001p\001\230\001\2777\205\203\034\352\201\357\3262U\\\316}\315\235\315\277\333\273\335\255}\256]\271&\321\251E\214\003\0037\201X&/\036\3236\2070n\335\003\307\366%.\3667\367\322\3556\016wkv\315\031\030\206]\034\335\256\257mw\217\366.\336\326n;\333K\204\305\3327\260\260\277\007>u.=|M\207\322j\nGO\244\371K[\372\332\013\210\276*\325\234\273=\315\265\364p\265\035\036\004\303M\372\306\300\360\024A\017 \372\332SO\262\276\022}\210\365\265\273\333\211A\217~}\n%\2101+\306j#\204\341)\363\237\370\353LK"
+	.ascii	"\224\222\220\216\214\212\222DCBA@?H\237\243k,\022[vU?\277\355"
+	.ascii	"-\005\365l\316\035h\324\351Lj\276\244\246%\003Hs\245\264,9\t"
+	.ascii	"\t-\037\031!\243\317*\271\b"
+	.string	"\213'\325\001hx\350\334\215\026\0265\311\355J\312\224L$\340KH\230\017\205\201e\241 \240(V\264\240\344\037d\364\231$#\215\270\317Q5\200DM\036\311\256\317y\006\022}\272\025\255\256lT\223\274\326\020q7Z^\352\2006L\344\270\025-\256\\4F\2158\321\215\326\226\252\204a\330\333\\\200\025\2558\267\031\213\263T\244`\261\307/\2553\366\250G\306e\214>\327\265\210\253\252\201?2\203\311 T\240n\324*\277:\264\005\247\207\214^\251\007\364\310\270\274\315sV\264*\347\226\002\f\303\235\241Q!\336\001\274;;u\267\213n\2374\001\201\271\360\257\275N\323!\302\260\323\275\3347\260\276v\206\302YY\304`%p\223\323\351n:\356^M'C\341&\3453\033v{\237\313\331\300\241C\207'\261\006\355(w\203\020\221\035\272\374%#l\356\252\336\331|M\377sth\361\372\322\002l^\216\025"
+	.ascii	"\370\002\360\005\256\345C\274\377\266\210\\a\234\314\004\276"
+	.ascii	"\333\004\212\354\320>\322\221\271\263zg\367\340\027_\231\372"
+	.ascii	"\322v\025l\376\354\244S\270\235\n\"\f/i\320^\307c\0051\314\327"
+	.ascii	"\374/\3465Em-\037z\326#\333b\373\227\366\r\326\277E\2278V\031"
+	.ascii	"O\267\253\36157X<=\261\276\372\267R1\205\261\277l\273\031?\363"
+	.ascii	"\266\2075\324\213\354\320\027\254\257\006\302\376\274\322\002"
+	.ascii	"\251\362a\367\264*\277\264\333\377\360\360\320\257\277Iw17\t"
+	.ascii	"7\367\2106\267\b7w\21067\b7\367\2076\267\207\016\033\332\334"
+	.ascii	"\031\\\316\333B\233;\202\233\033\202\2036\367\002\005nn'\246"
+	.ascii	"\233\373\200\257y/\233\\\315\235\200\322\331\330\274\231\332"
+	.ascii	"\334Kmn\2456w\22217R\233\373\250\315md\314]\324\346N\266\271"
+	.ascii	"\211\214\271\207\332\334Bm\356\24067P\233\373\247\315\215,\346"
+	.ascii	"\366is\037\215\271]cn\2431w\261\230\233\330\346n\333\334l\233"
+	.ascii	"{%\346V\331\334\337\346\316ln/\321@\217\327\021\260\255B\277"
+	.ascii	"|\017\357pQ\230\b\375\323\261\021\251\276\3046\275\202?a\347"
+	.string	"\207E\244JBY\222\273!\bAn\f\271Dx\bA\277\374\b\357qN\202\376\347\366\240\305Tv<\233\001\024\002j\222\275|\371@{\203_\202A?J\230\b\036\271\246?\357gub\236^\310G\242\316A\355\374s\2147\331\345#\337\305\352\336\236^U\200\\\202~\204\201l,\327\005\344\003'~\245/|\276\275\362C;\216A1\373y\272\323`\033@<\273\005\357t\374\345/x\037\223\2154\237h8\016h\233SHd\250g\020\231\177\270;\304\375U\016\032\366\313\020\251\3172\037\225\031\301\336)\312\253 \306_\347\366\n\343\2618\201\307\227vk\005{\223\265\360K*Y\272\300)\220\213\337\375\216\275d\331\241\026^i\225\2419KF\227\275f\257\031\353k\361}\316\227Wzhq1\217\341\226\353h\234\370\376e&\373x\033\355\005\361[i^a\314\304%\346\317\370fa\017\274\267\271P\032;\\"
+	.ascii	"\361\3522\374\201?\022\3042d\277\375\f\357e\\"
+	.string	"-\313\373#3s\023\253\272z\265\264_\214\3272U\256z\267(=\254+\\\270\300\372\312\376\332\226\207\026\257\025_\352\355}\031^\313\336\020*\330\202\323#6\331\365\245\364\370\236&\006\r\032X_\327/\346\325\025\272\237{\233\227\030\274s\346=zd[a\332\227\316\361\246\340\314{\332=\207\221\3626\205}i\027\266\343Q\253\f\266\337\371\037]\200\355\001\r#\001\024\215\030S\314\032Q4hD=!\271h\262\2600U\003JJ\252\371\344N\315h\336\200\222bqD\325x\250)\026S\"\240h\304\230\252\321\f\221C\n\331O\t\234f\344\220\272\301\314!\305\254\021\203\005\r\346\223\324\rf\202\242\216\262\001%\305\234\212\212\222b\272S*W\341o\242|d\227\226;\252\257bZ\332\312f\336.\"\f\303\r:\323\275V^$F;\240v\250\344\226\336\2752\2470^[j\363\342\0224\206J\035\276\325\244"
+	.ascii	"\257\374\254\356%\226\304\307W\372\214\376\262\312'\361\235\261"
+	.ascii	"\342\252|\b\340\245O<\300w\370\017r\016\261\210\3000\354T\232"
+	.ascii	"{\0321W2nI\007\337*\021\323\373\230\231:\244\rl\323\007\370,"
+	.ascii	"=W\312b\362\230\002I\336%KX_\225\376\215\354\241\305T=\2248\301"
+	.string	"\316\376\340)\334\344y\217\232\004W\324{C\370\345\315\231\027;\302\r\177\242\317/\311-\351=\356\333C\352\202\364O\307\006M@\236\230\026\322K\373\237bF\340QY\002\210W'\342G\034\375\362E\274{\311\323\243\177\2725\205\204\236\323\330\035\251\315\245\315\235\005V\361\246g\376\2118oFX\214\336c8\207EfEF!\360\2368A|\210\344/\037\304\373\227\262\344?]\234\240\3474fE/5t\262\242\2237\302\300\265\277\261+og\201\376\262L\357\340O\360\355a\021!\242\362\202]\276|\242\367\230\317n\bl\310@\032\235\301\344K\333\307\266\324\r)\370fY\234P\3233}\326\007\274/\247\207\377\020\2019\250a4&\025C3#\"\"\332\024T\322\001\321\005\204\030\345\240\263\r\021\020\255c\312\241\231MA!m\006\n\300RQ\304\274\332I\020*\312z!q\305\3745J\"\361\313K\213\001F"
+	.ascii	"b \242}\244\360i\275*\t\230\365!\302w\336\263\2422\233Q\301\253"
+	.ascii	"\207\n\266\313\345\002<A\310\024\361+\365g\033\374\371\035.X"
+	.ascii	"\224\336\222]\205\306\305\021\260\213\020\bBC\270Y\017\016G\333"
+	.ascii	"\002\244sOM\244\377\216\255J\367o\374{o2\310\324\216\304uF\270"
+	.ascii	"N\0054\177L\237\347\215>\025\003\272\272\252\270S1\252G\303\217"
+	.ascii	"\024\306J4\230%f\207%i#\020\257\341EX\207EU\b\324\210\313t\231"
+	.ascii	"\f\337\346 \006\334\r\373!\020\253\374\335\371\243\221\001 \f"
+	.ascii	"\341\021\200\304y:\377\007\341\365^\017`V#(\221\354\336H\236"
+	.ascii	"\f\242\372\252\311;\373\330\212\343\267`\324?9\321\216\303H\333"
+	.ascii	"\347\266\355\321\314wV\004\210yU\020\216\311V\200\323f\013|@"
+	.ascii	"BB\371\307$\242\025\0241\355\276\330kz\220\241\021\0068\274\272"
+	.ascii	" \235\206F?G`\352\317c\264\n\007\""
+	.string	"\250\342\360\252f\213X2\247\036s>\032{`y4\301\242\321\305\3664\324\222\035\271\317yk\231\345n\345\036\225'\200"
+	.string	"\034s\025n\3154\3633\333^v\313O`\220l\257H\265"
+	.string	"\005\220\003\364\321\" \226\035\023+\315W\342M@\334\377\201\211\211\354\032\357\376\363\026\320\262\267R\325mD{\007\031\007\333d\013\353\315\002`\300\2410\020\354\270!\rz\311I\226\324\030f$&\334\341\313|\321\332\316\210\253W\230p\224\326\247HOoi\331\320F\211O\356\351/\360:\002\310\022\374\204\241"
+	.string	"\375"
+	.ascii	">tg\003\202\232eT.Y\004\0231\001*\033\200\230\235[\016\245\231"
+	.ascii	"\312D\207\223>[\t\013\261\225\233{F\262+\316\007U\214/J\230n"
+	.ascii	"0<.\207\016\24080\231'\302\033L\322\204E\203Hj\2262Gm\224\307"
+	.ascii	"\206\250\033\006\226\375\fv\203\274\265>\333\204s\252/\220\231"
+	.ascii	"\355\270\335\352#\240c\203N\022F\310\333-\226vH@\220\342\361"
+	.ascii	"E\274\313'\313U\376"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.53.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`G\002\315\023"
+	.string	"\266\345\206J\300\322Q:s\324\226\323\376\341E\370\007m\300\354\311\006p\023\307(\331\207\007\b\177AX\302H\231\201\251HjM\2577G\2666\260\002\215?\321\330\300 \007A\020"
+	.string	"\030\032\254\204\351$A\376\2617\320\026\215\3466\310&r\247\024t"
+	.string	"h"
+	.string	"s"
+	.ascii	"\325\367C\251\3262\201UV\247.\237\"\236\256\216\"\236\332v\013"
+	.ascii	"\003\233o/O\360F<@\351\216\244j-\3115\361\333E\032\356\274\371"
+	.ascii	"\255\336\315\305\225\316ix j\306\220\024^\320n\354q\230aH\200"
+	.ascii	"\347\206\b\223^N\250\342T\302\307\330\303\231\033\026\360\221"
+	.ascii	"\2302\351\345B\227\215&\335\201\237\035z9s\216\270\324Z=w=\020"
+	.ascii	"\367\310m\307\330v`\317\\\2668]B\247I\350\364(N\267\376\273Y"
+	.ascii	"7\372E:M\351\364\322\351I\247\017\240\301\016\236\021@=\226G"
+	.ascii	"YyA\"\265\211.\t\375\367\333O\322)\362\243#\331\243k\356\302"
+	.ascii	"\313T%Uk\035k\354\361t\3326\037\350\321/\337\302\366\237\006"
+	.ascii	"\027NY{\021\200$\021!8\365\202\325\251+\234\323>\321\213l7\332"
+	.ascii	"\360\223\032FNA\236r\214\333Z\001BtUsw\307}\322\r\004\t\361t"
+	.ascii	"H(rK0\273\254\235\337e\\\351\345\372\217a11\342\351\334\325)"
+	.ascii	"2\265\363\233A\217\323\266\020\233\337\261\366P:>LE\345\366\346"
+	.ascii	"T=\301\027\273>^\021\277\024\200P8\223\312>\214\307X\361\177"
+	.ascii	"<\233\231\337\315\210\247\337!\025)x\212vp3h\227\271\271>\366"
+	.ascii	"7\030\f\006\275\276\256\300\002\213\311\324H\331,\026\233\275"
+	.ascii	"\006\324\314d\013\253\301\324 \300b25Y\206\00764\023\277XZ.\330"
+	.ascii	"\320hH\033\032)\223\201\211\221/\032\r\311\022\3003\f0\032Y\233"
+	.ascii	"\315h\344X\342\276\276\337D\273\3406\027\326Z\253\2102m\t\023"
+	.ascii	"\346w\336\275Q\200\003\267\202\256\217\017\364\027\261\344\211"
+	.ascii	"E\017\311\226\320e-\311\036\251\006\335e\252\232\nAC7\024\276"
+	.ascii	"\210\255=\360'\300( \240\002\221\032\365\3270\2100\340\336\031"
+	.ascii	"\032\307\003m\305/\377q\254\334\206n\324LZ\342\354\366q\205X"
+	.ascii	"\320\3200+\025Q\360\254\302\226\207\306\030\276\177;\207\231"
+	.ascii	"\004i\223^\213\270A\f\206K\366);G\020(\230F\214\253\243\342\260"
+	.ascii	"\031!\343J\363 \023q\337\201\221K\005+\n"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.54.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\345\f"
+	.string	"\006\031ZC\360\2226\0352\323\305\235;x\215\267.K\276\350\214QZ\017\245\252O\020k\260S\036G\267\363\037\275\242*\030!\251i\272\016\2270O&8;\003\202f\261\272\016\3252\271\344(\310\332\253w#{K\231RG"
+	.string	"C"
+	.string	"F"
+	.string	"W\341\331&\370\235\210\251L Vhz\354\356e\340#\324#\374"
+	.ascii	"\352QM\334;\324\364\374\020"
+	.string	"R\350\320r\271B\005\"f\270\210\220Dp\344T\002\307K\317\026\322(\263\342\354\256\223\205\364\341\216\267\r\301\366\003\373&\001\177\374\367\303\230N\230\276U \306i\303\215]\0175@\266F\204\201\302\366m{\366\306\266\246]\322\300\373\f\207\007X\221\215\020\f\236\366e\276\302\373\227r\001\273/9\\\354~\013\214\300z\364g\331\366S\004,\025\247\203\206\034\225R\347J\220|\301\3434B\025\306Q\257\024J4F\371\303\266v\026\030\254\335\221\003\237F\003\310\332\335\307\244P\217\327\227\236@F\013\0372*Yc\177\241T\030\373p\365\305\216\351J\323\324g\002]\205\b(X\226uL<!\030\327\341&`\237\023.\313 \241\333D\354!)A\3516\320\325mWv\322\371\\\236\rt\221\020\260v\001\333.N\323\266k\363\355\241\002 \261CG\332t \265\305v\2529**\202\233\244\024\252m\341\223\017\023"
+	.ascii	"s\b\b\303n&\232W\267\255\254\366a\257\252\255L\261\376\022\236"
+	.ascii	"\013\337W`\026s!3Dc\017\030!P\341\340n$\325`\213\3204\006\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_srxl2RxWriteData.55.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\272\001}\020"
+	.string	"F nE"
+	.string	"\2614\035"
+	.string	"\020\326H<(\322\360xp\326\217\016\036\b\275!\2754\200\203d\320_\003\376\361\002\360\355\273\274\210q(\324\261(U\216\002\"\227\254Z\337g\347U\237\030\241\373U[\365Q\333\314\272\321&R\246\024V"
+	.string	"Q"
+	.string	"b"
+	.string	"'\276\3438\345\320\356\207\030;\273+\342\220\354\021\304z\332/q\023\337o\374\363"
+	.ascii	"\2735*vvC\021\033\310\036\035~\300\365\230}\273\036\375\3316"
+	.ascii	"\036\332\354Y\240N(t\354.\247!\376=?\3779\017\20131O\214\301"
+	.ascii	"\356:\301\031\016\267\336v\001\333"
+	.string	"\"v\232\004w\352\362\320\353\325\001(\207\211F&Wv\030\223\n\302\276\265\273k\255\331~\363\223\216\363{hz\224\2455,-\272\322\241\230\316\2604v\245\257\230\2161mYi\325tf\372\037\004\200f\\\370\331\335\260\332\261=\221G\204\355\333\327\261\265k\2663|!*\031\247\240\235M\257\363\006$T0L8D*\352\243@\244\327\212LI\032\3722\305\220c\242\301\324O\341\245|\324@\371.\327\343\301\033%\022\022\230\024/\300T}4x\210J\322Ko\032!\263]\226F\275\207Z\n\001h\245e*I\021\334\256\260\222\007UAL\032\343k\252\246NA\245\\9C,(*\332\275t\023,\237\214$P\201\361\\8\030\217c\241\320\255p'\236\0137\362\341\026\013(\036\367\322\322\342qZ\270\267Vkl\242\352)\251\214G\352\247\376\342\200\217\262\203\222\222MG\372@E\343\024$ 5%\271\350"
+	.ascii	"\330\354\226\016\372-\316\023\301G=ZB\227\007;\237\240\344Ao"
+	.ascii	"\252\351s\036# p\202\021\261\355\001\362\320\356\016\214\241"
+	.ascii	"\205\346\353t\017\216i\237\333\200\025\023\2521\223\255e~q\251"
+	.ascii	"\214/\230 \216\022$\231-\023kb\214\016\362\231\274\333\246\f"
+	.ascii	"\243\214\365\300f\212`\203\305\f\310\214^&gH\364\253\271\260"
+	.ascii	"\205\220\223)\020./\332G\006"
+	.text
+	.section	.gnu.lto_srxl2RxInit.56.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\306\007\235,"
+	.string	"\272Np\021Hp\032R:7\265Hx\027\274k`\017N\352\212\363\f\244\225!{p\001\006\363\263a\267I\001tqa\364\033\216\306JTs'&\017\b\306\tY\230bo\027e\340\210\206@@\217\211b}\265\376mO\032!d\357$\003"
+	.string	"\001\363"
+	.string	"\007\001\027\0133zn\202\332\035\225bp@\254O\337\235\324\337rf\367\272\233K\r4#\227Y\212\235+\303\360,\007K\272\026\033>L\313\034Ub\316\331\265\340iOX\237\372\240xy\343\031to\367\273~%\351^8\016 g$^\312r^2\350\003\353\323^^\200\372t}"
+	.ascii	"\365\251\003\bI\335~\271\344\307\225_\306-\316\234\227A\254\244"
+	.ascii	"}\216.\337\350m\017\374\361\370z\274\335\252SS\024\337\266\257"
+	.ascii	"t\240\256B\206\242\223\263\013\316\210T\326\177X\347\301z\002"
+	.ascii	"E\344\372P d\330\231\243A\rA\0034\245\034\351]\235weuw?F\244"
+	.ascii	"\252\276\242AU\241>\314\377<\201B^\335\227\262\256\242\017\244"
+	.ascii	"\354\030\373E\031\321^X\035(g6\335\024\275\363\252\355\027\245"
+	.ascii	"\003\245`\\\003\344)\252x\321\255 \307\027\373\035\243Vl\212"
+	.ascii	"E\005\371\325U\3109\367=FI\275{\336\375\005\335\035\242[G!h<"
+	.ascii	"t\020\300\346\206\224\034\331q\352\232\371`\342o!^\346b\235\261"
+	.ascii	"\t\347u\334\037s2B}\255&a\342\376hB\355(\247Q\334,\305\2323S"
+	.ascii	"\204\276\230\021*V-\034\370\314\037h"
+	.string	"6\251x-\335g\212\223\275;b \234Z\335~:\033\030\033\323\265s4\347\234Q\234\274\221\312\203\201\360\241\342\3064a\025\357\263o\316_\241v\267\213\203Y1`I\316YB\377\313\307X\364\265\2366\215\241\373\343\323\376\220\372\224\313K\013\253\313m\351>1\206\343U\244\n\343d\367R\351\002\261\240a\323\030I7P\337VP\340\\\336?_\376\004\356\365\013\350\333=\300ky\377\036\366\346\351\335\366\361\334\356\371n\363|\267w\275\333:\336muw;]o\243\353m\274\336\276\353\3553P\205dg\234\034\314\234\177<\343\362Y\032F\371\260_\313\317\345\272\213vw\351\267\351\032\205\255R[l\213\352\323\273\345(g\302\005b\374\326\250\352\230\362['5\370wi\237\332\036\353\351\\\305\335\355\2176\352\376\250\303h\266\302J\235b\025_3\343\334\322}\002\271\271\025\342l\273Z\252\024\367\246<{?\\"
+	.ascii	"\267i<\234\354'\237X\353\3566\324;\221\233\323\255\267\241\376"
+	.ascii	"\360\223\235\243U\217CqJ%\007\267\303I\325I\221$k"
+	.string	"\247P1n\001\306\326\335^\035\016\343\004_gXW\274|e\262x\321\341\344U4eU\324\032\352\017&\360\245\004[c\272v\272\301\355\345\333,\265\273-\322\036\271?\376\340\240,\2633&\254\324\335&[%@K\230|N\333d\310\034\323I\253\334:\234\026\3123J;\005AK\345m\255\025+\271:\355\225\366\253-\234\355\302\233\343\224\231\023\303\233+\246\2649\335|.\244vg\370\032\241\235\2226.\267\243\r\035`\223\363\322\217jZ\303\323pXs\316\021\372\001\302\307\020\302 \032^8\"\016\213xFDC\341Q\321P\367\342\210\305\221\320\213\031\302#\242\032\"\220\210\277\030B\030D\303\013H\304\265\207\202\034\310@\"\032\005\221\210A\"!\213\031\301!\242Q0h@\017\213^\020\203G\303!1\330[\346c$]\264\225e$\373)\300o\3340\311\324~\253\366\364\340\256\260\204\213\300\273\343>\254"
+	.ascii	"\337(\206\210\017K@\222\301!\1778iu\002\t\206\313\r\335bR\361"
+	.ascii	"\340d\237U\243\366p\013\260\265;u\251X5i\254\232\232\372\264"
+	.ascii	"\207O \307\340\220<\334\027\310\r\322:\261Mv\215]{\303Meg\333"
+	.ascii	"\250;\314\303\350\230\206\333\315\276i\225\367\307\035\306K4"
+	.ascii	"(gE\254\324?\033G\355\333\343\372`\343\260s\3307\366M}\032\001"
+	.ascii	"\371\205\313\215\255\303\302\031`\357\334#+w\235\212\330'0\007"
+	.ascii	"\222Yl\212M\255i>\224>\3467(\343\214d\274\002\270\321\335\017"
+	.ascii	"\003\361\223P\325a\002<\214`\231\223\266\246\303\035\200\220"
+	.ascii	"\250a4\343\024T\210\206"
+	.string	"FJ\223\202B:\220\002\221\251#z\021P9CRI\222\024\0243\006+`\310\345\240\235\016%\245\303?\2514\354\326d]\257\316&\fi!\315\310uu=\257q\213n\033B\222\252\260\363\320Z\021]%3\007_p4Ig\024\225\374\021\256\023T\374O\306\310\360\275\334P\343\242S\345\r\223\222\350V\250t\324\033\2004\275\205B\035\204C\025\251\314\223\251W\024\303F\3024\271\222\241R\215F\013\016\303%\302\316\004A|\227\317|\206\205v\261l\"\330+\341_)TJ\341\224&\340T\250P-\255\177\236\220<\3010\217\n\213\353\234i\246K\306\303\324\0220\321\256\334m\3344\2116\022\007\220y3\227\371\3008\301N\023\307=\2124t\274\026\021'\006\245\177\363\177\001\202x\367\351&SA\242\020\370\203D\257n\255\255\321\277\360ea\233\177A\221\230\316\371_\261\206\020\346\036\331\253\024\303c\263'\337"
+	.ascii	"\371\317\306\f^\212\361\013]\327\026\bnt\320,uV\241v\247#\"F"
+	.ascii	"\354\370J\031I:{\331w\327\032\222\344\365u*"
+	.text
+	.section	.gnu.lto_srxl2RxIsActive.57.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\302\314.4Pm\222\016$\243*J \351\312Z\022 \003\216\006\035\024\255\032\313zn[\273\333\363\233 ,\225\200\341\354\314\024\222\240\3239#\344J\024\034}X\373\233\310\024k0\031\007\316\3338\316s\020\r\013\017N\3636\016C0\025\301\360\234\004E=w\311\262HB,\b\241\365\365X\212\210\025\215X\375(\210\347\226\236\350\264^\235n\307\322\251\030P\021j)\237\201\032^|+\211\244\277\215\255\335\212\300F\t\353E\2229JA\311\222I\204\343\377\374\345\f\302\347\252Y\306h\240CC\024r\222\2319\304h\325V\335zT\301\272L.\f\324\006\220\220\231\267\013\243\350\330\377\3407\370-\002\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_srxl2TelemetryRequested.58.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\322K,3Pm\222\016$\243\252\214\252\216l]"
+	.string	" \027\243 \024\255F;.\027\367\355\337\355\354\016\355\274\001\024\317\315,\022\004\f]+@\256D\301\321c\232\335[\246g.\230\207M\245i\233\252E80@\264L\245i\227\202)\211\206\252MPT\325,Y\026G\207\006\037\004}A\032b]\216)8\327\253\323\345"
+	.string	"t:\024\300\370\\\3513\317a\306\267\2228\372\357\303\201\016\022\254\241\221LQ)%O&\023\322\337y\313\230\204\316V\263\r\021\201\007\251B\004%3k\250Q\253g\335~t\001\024*\2710O/@!3\277\013\273\350\330\037\341?\370-\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_srxl2InitializeFrame.59.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`*\001\215\f"
+	.string	"\246VQ?\020Q\225\016+\034\331\034`\256B6\307\007\271\003U\034O\030J#\267\225\317\357h\032\252\037G\bk\311L>A0\240\314\377\002"
+	.string	""
+	.string	""
+	.string	"\212\214\341\247\245\246\b+\365\327*\013\304\222M\266L)<"
+	.string	"="
+	.string	"C"
+	.string	"\001vQ\256\026\273\243\001[\266O\217\037\240}n\027\240}:\264i|Lm\005\304\212\324\272\261\273\234\364\360\360\032\372\037q"
+	.string	"\242It}(\330]\253h\262p\313\333.`\373b\377E$\"H\210\244T\237~H\373|\230(\331\020O#\215\331\243H%\007\373\331\356\256%\312>\353\317\244ZU}H$\204\312\364R\215\335\n1\034\013\233.>@l_\355\257.\"<+\364\031$J9\255\006\203D\337\341~i\231\2647\f\364\242/\035\027`\024\244\310>\013p2C\305Wp,\t>]\224;F\203\247\210\035\205g\222\332\035]\364O\274\325q\347\321\213\236\357%\300mw\021\370\001\237o\201\264\006s\300\001\310\3738\220\307=\340d:\234\306\3738\f\305\035\204\215\307}\272\316\343 \343>[\211\362\326\261\0016\222\023,Q\225\004.U\236\224\343u\030\034_\345\f\250\027A\355\363\262\"CC\036"
+	.ascii	"2\241]h`x\370\"\226\201a\267\243\231\017\201\346&\030\320\017"
+	.ascii	"\020\214\247l\350\021\332\360l\365\231\256\312\006\254\273\004"
+	.ascii	"I@\030%8@\273\241\340\226R\242B\203\331\330\001,c\305\301\250"
+	.ascii	"KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_srxl2FinalizeFrame.60.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"u\013"
+	.string	"v\326PB Q\224\016d\247dBX\261\242\234\346C\362\017\\\266!$\371\354\334\323\241{7\300\332\331>AYLm\300 \324\304G\266)k\b(\034\200: \f\"\262\240\213\026T\020T(k\355\347\266R\246\024<"
+	.string	";"
+	.string	">"
+	.string	"\273\247\027\252\335\020\200M,\217\016/\202=Z\036\202=\332\263Y\017A,\211\b\031\027X\340\330\335L?\334{z\376Q\374\002\222\276gE\300\356:A\322\206[o\273\304\366\211}\002\001\216 !\017\372-J\032\\\255\n\372\331\341\227\352\301>ew\327z\262\237\372\243\2465\323\231\351c\264\022\243\f\244cp\261;z\345\330U\234\021\002c\373i\337\304OxOM\370G\252\366\001\004\025\223\207\326\311\203\252\034S\3364\260kj\306B\007Q\276\334\221Qm\317\002\245\250j\214XQ\320\317\227|\370\025]\306\306n(\305Ul>\352\321\020\272<\370\350w\330cT\007\237N\201Z\323\004`"
+	.string	"\342\272\f\304e\016<\t\032d\032\327e\232\021o\017:\\\366\3316.\303\204{\312\352\311\003J*W+\244\"\373\033\314\207\361\030\033\037\345\002\034\016\366h\200\003\213\304\215P\276\f\222\251\001\017"
+	.ascii	"2\241\265h`\3610\002,\305\034\326\356`\302\250>$\265CS+\\\324"
+	.ascii	"\322\004p]\354jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2Bind.61.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`8\001\315\f"
+	.string	"V\327TD\360\222&\351\220\353I'Ty\355\330\276\376\035\013\325\241\2779\2718\024\364\212\017\\F\262\341\367<A\366SQ\005\205\255Z\234\357`vlY\362\f<\337\206#\3024p:\n\366\243\240h\334\377\337H#$\311>"
+	.string	"?"
+	.string	"C"
+	.string	"\034\322\323\305\334\2502A$8\326@\347\370\351\317u\374\034\340:\226\324\3468u\312\00117:\320\364\310L\f\236\230\364#\365\271=\233\251\364\343,\310\314\276\315\024\342\302\333\026h\213\240\275\0132\317\250t\024\235[\351\333\221s\206\353\230\362\302\303\207\312\345\255\332T\351\301\022\355Vff!L\373^\007\020\202\003\206i\017-2?\254~d\027kR\214\372\366\271\202\364\025\263 \215j9\003o=`#\242\333"
+	.string	"K\205\016\266\241\342\3015`\013\341\031o:\226qM\026\001\364:\350:\016=/\337\204\216a2G\341#\372Ee*\354b\023\023\270\332\223i\262\222\264\027\346F%9vv\250\274\222\036\023PD\022\254\206F\024X`\321F\030\213\206\241\210@'XH\033a#\"\315RL4\fC\226i\030H*\267\022\302\264c3\242s\201\032\332be\222(\031\365\252\231\267\252\310\373\\\032\327\251\271\025\001\247\255e\320\340\005\034"
+	.ascii	"2CO\025\330x<\264+\002\270\016T10\0063\327{\212\235\274Q\200"
+	.ascii	"\270\261\305i\214\331\310\030C\3000h\003\b\342j/h\007H\f\256"
+	.ascii	"\021P9~T u\031\375\325e\001[\300e^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.part.0.82.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\267\001\225\020"
+	.string	"\306\340oF\360\222(\035\370\352\303!cP\303g\377H\364\377D\370\341\223\260\337\347\032q\334\322\025&\301\345E\215M\f\356~\313\255\366\340\374\372\233\314p\322\230\241\370H\275`P\036h\330\327Lq\315\032\233%\204\354-eJ\001["
+	.string	"V"
+	.string	"Z"
+	.string	"\217\361\360{M\312\007\314\031\203Sc\316\320\301\245\031l\227\0167\373/V/\266\375\026w\361\331\260\030\252\230\321`%V\\?\346\234\335\245\202\033\310.\343\td\227\233\342\337W\343\347+\013\f\210\357_\257@\003\004\306\002#\342\032\362\250\225\3149\275\215\270\345mK\260=\301\326\007\001\006m\352\317\246\3466\265'\252;\232z\323\324\232Tg\231Zf\352x\327\277R\255\267\371\037"
+	.string	"A\203\034s\272\304\202L\024\322\306\n\333\267\377Z\331\234\375\331\234\243\336\345\020\311*\234.Q\355\020\311w\031\036.`\266v\230\200\240z\233\325kRD\302\031\342\305\252v\353\331\343\200=\266\355\354WrX72m\267\325p\300\234\326o<\r\376\214o\222]j\373\026\022ru\263=\310Bo\034Y\\\271\007iZ\032\363n\334\314\265\222c\227N\303d\233S%\202?\343\203\311\237\271\364S\262K\335\277~\031\0360X\032\323\225\361\306\307\2711\366\246\001\252\f\026NH\247\223h\303\310CJ\211R\030H\246R\352\324\341\202\312\003\340\321H\350D\345\241t*\257;\225D\246n\344\241t#\007\214\342@\362\272\024\n\345u\234m}\234\033\343\277\036\242\237\005m\213m\320\272\204\265-\357\343\256\214\355\243"
+	.ascii	"\267\237Mp\003\236\200\335\024b1 *s\262\026x\226[\021\035 M'"
+	.ascii	"\" `\002\031\244\246\003\037)F=\236 \303\275\246\215;H\220y\301"
+	.ascii	"q\035\2366ZV\304\304i\300,\333$\243\341\257-9y5\302!F+Q\030\235"
+	.ascii	"\220wp.\007@\"+Hz'\253=\333\r*\304=4\331\364v\243\007\322\036"
+	.ascii	"}m\300\003"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.part.0.85.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`>\002-\022"
+	.string	"\326\237qH\360\320&\035\023\r\211\377\307\202Z:\375\301\360\377+\001\001p\316\323+/\367\215\3371\325u+\3731\207\032`\255\331\3236\223I|\312\243=\341Rj\250\007>\r\2772\306\203\364:\253\344\341{=\247\037\222F6\331;\245V"
+	.string	"b"
+	.string	"]"
+	.string	"\325\n\272W\227\235\314\2471\351\325\227\371\214\354,8x'\345\256P\320\261##\264[\212\274:A\367\352\275"
+	.string	"\367\272\235"
+	.string	"\367j\322\006z\271;\002\221\003\005Ghw?\372r\362tn\244?;}\316'mE\304\347\200o\243\221\335u7\342\256\267}\262\375\300\236\265(\252O\212\036\233N\244[\366f6\235dn\275\204IQ\331-qn\225\027~y'%\314J\203\223\025\201\371\345\300\303\366\242\202\307\216\327\337\234\207D\217\357\334\205M2\354:\246?D$\230\247_\222>\316sL\242!o\310\333\224x3\001\273-'z\350\264\337\3425\262\333\224\030(7\304i"
+	.string	"1x\025,\314\323\354}\2403\3732>#\274\220Jq\257\224~\320I\217B\344\377<F\210_\263\n\004)\202\230!\226\231\022&\263\310\177\213\363}\016\003\203\367\232W$\3634\022\356\225'F\210E&\250f\026M\352b\272}\333\3355m\261?\246i7=G\323\357>\023\001XvS\212\2066\316P\002\303\225\353c\211a(\252\016\200\256\224+\002\030\256\\\254\027\204\330\b"
+	.ascii	"&\262\250U%\223\206\330\330\372b\343\307Z\245\302O5\266\276\022"
+	.ascii	"\210\305\r\340\370\271Dq\374H\266\347GLh\007SJ]\034\302\341\030"
+	.ascii	"\351\334\254\b\002\231\223^\3477P\013`vMN\363k\334\206\004\277"
+	.ascii	"\366\352\t(\224\0358 \200\002\221B\363\3334\3200\377\303\342"
+	.ascii	"(\024y\017q(\320\201\377\323Vim\311r\335\235\222\320\034\032"
+	.ascii	"E\336\261)\306!\311\253\332\334\372\215\224k\317D\3710\033A\212"
+	.ascii	"\016]d mJ\242\205\373c\372\023\337`\366\002:\\\307\035\331'\224"
+	.ascii	"\340\021\215\035\226\265\264*U\352CT\003\013\026\031\214\353"
+	.ascii	"\342Zi\032\203\371/\235\235-\177\332\3136\031u\255\226r\036O"
+	.ascii	"\027\246\311'`<"
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.part.0.86.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\266\002u\023"
+	.string	"6\341wI\340\322&\035\240\0214/H\017DK'\004'\201/%\210\276\020\267c\236\263z\376OA\320\251\2670\002\257\017e9\276s\315\302O\323w\277\223-\240\bd\232\342\270&\032\224\b\3371d\305C\177c\006\340\311\266M\366N)^"
+	.string	"e"
+	.string	"`"
+	.ascii	"!\036j?\026t\257.\273\027\207\021{\f\225n\205\326\331\330\200"
+	.ascii	"\034\355\226\t^M\322\275\236>\240\364\312}\244\364z\031\3330"
+	.ascii	"\232c\366\216\227(\366\266\"\027\333\217\335\375^\351\211\307"
+	.ascii	"N'\027\363\347\354"
+	.string	"e\345\364<\347X\250\3401{\001\361)\340\234\311dw\335\301\334\365\266\033\330\026m:\0036\244\223\373\234\206\377c\357\326C\372$+\367\205\266\273\267\3717{=d\216\216\033G\273k\241{\235\276\r\346\337\\\347;\347\261G\003+a98\256\212\343* \262\262\031\231[\204\356\325\006\366\232\224\023\355\260,&n\334\254I)\321BDl(R\360j\007\335\353\313\323\330{\365e|F\3543\032\276\034h\001I\366\215nC\345\247\360\2125?c\225^O\317s\222\034>Z\204`\231I\223\326L\271s\273\273\246%l\323\3644M\277\216\0340\332\375\220\204\264#\352\317\212\357\374:\277\317O\364\017\3756\177\316M\366\375!\242\027\t\301\202\200T\220bv\313\240\013\331\253\201\340$\023YY-H\214\252\003R\t\257\013)\252\"\301\025\327\022C\324\030NH\221\344\350\205-\260U!\\\245Z\242\213\302k\f"
+	.string	"\266@\b\344\203p\005\216'"
+	.string	"T$(\001%\024E\020\003\3123\252\204\001\312k$\277\327\370\211)p\365\241F\362+!`V\206p\374Z,\326\370\315\233\260\320\026SJk82.n\226\222\360\2448>\353\321\335@\351t\322\273\300\264\314@\250qP\210\bRfhd\342\202\202\264\030\220\002\2212\263\r\020H\306j\n\3224\006\355\210\"\2735c\376@\2045Q\367\013t\342"
+	.ascii	"\252\005\275>\315\347\335P\026\355W\024\020=\346\353Q\272\264"
+	.ascii	"_W\240\250Cff8\207\231\252\367\314hm\264a_\271\365\034\250\306"
+	.ascii	"\312\231\312@\202}\347\357y\243a\"z\032\263\025\354=\264DG\323"
+	.ascii	"\254p\222\263\327\325\037`Q54\360|\220\331\235W\037s\\3\006\360"
+	.ascii	"G\020\023\305\371\350\363\003"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.part.0.87.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\351\001\275\020"
+	.string	"V\235jH\360\220*\035\350\214\322_Y\366\302\260h\005\243\260\330\002\3238\347\364\374D7\356"
+	.string	"\317\033k\035` \217\004\324"
+	.string	"\265rw2\201,\002\373Q8\242^\214\344\033\337T\230\272\221\032\007\277\371\n\313\313\201\020\371\334h\357\224\002P"
+	.string	"Y"
+	.string	"W"
+	.string	"\335\253\367\002\335\253\275\362W\354yu(d\365\023\031\2745\321\271\331\304d\354\226\240W'\360^M\3327/w_3y\331j\354\356Gk'O'\207\364Y\247\277}\322p\341\262\271}8\371$pNGdw\355\241\334\365\266\033\330\216`O\n\001\237\317Vj\337\353g~\230\277\345\267\335>\n\322w9\314c~\263gF\0065?\345\202\220\311\240\276\034d\035'1\036\034x\241\020\322\366\222\342\274\244>\003V\203KJ.\344\275\205<K\311\007\355\260-Z\216N\373)^\256\316R\322\311:R^&\f^\r\362^]\336@\207\315\230G\320\235N\372\027\212\353\271\257\270\340\223p)\234\207\275\372a\367zZa\320\330\b\321\2329p\276\361TV\266\263]\360\372\333\001\340hjX\023\307\2444S\3169KG\330\235\351\331\231~\247 \206"
+	.string	"\021\273\261\0347vVY\224P\341\223?X\245JL\346S\242Q\364\200$\024GS8\362\200\243h\234"
+	.string	"\226H\243\t%A%z\210\340\210\b\264\320\215@0\245\302\352\021H\210D%\236>\225\370\231H\242\3227\022O\037\310\001\207\030@\361\033\303P\374\346EZ\324eJ)\315\266\307\244\007;\320\355\n\244y\230\003\340^\324l\240,O\332\". \220\002\221\261\341\003B\0059W4\302\243P\260c\276\340*\362\240\263\204\302\336nv\271i\243\214\001\030@^\241E4\f\363\303}{\340C(\210c0"
+	.ascii	"\r\3238c\253\321\273\327\225\324\261_\207I\202\214\022z\210\360"
+	.ascii	"\021\314\311\016\217{\206J&-\273d\243\256\26561I\247\035g\331"
+	.ascii	"k\261 \347\003\351Vo\377\to\f"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.part.0.88.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`;\002\035\023"
+	.string	"fc|H\340P%\035X6\263\203xA5Y\211\210\334\342\234\243.!\241\022\r\346(Y\327B\243H\321C\360\263\234\021\033\312\244\317!\242\222\372vf\026\323P\032\203\030\026C>Q\031-\b\232\304\325\313L\335\310\244\355M\366N)e"
+	.string	"g"
+	.string	"d"
+	.ascii	"O\272\022\3545\234\017\3305\2221\265;.8\365Hw\352\361\007\352"
+	.ascii	"i\367\002\365\324\242}\343\343\356i>=N\267\335\365\246\207\213"
+	.ascii	"\247\334\224U\364c\247\207z\002,\0254\254"
+	.string	"N\3144\234\223\262\231\320'\307\200\347\306\001d\266\303\005\310\352\251q\250K\f3\035)\t\274\266Pv\327\335\206\273u\333+\266\035\330R([D\251@\240\260\311\211h\232\243\037\33369\201\231&\344EJ4\237\253\335\321;\275\355w\372\264o\337I\364M\034\312\037\266\247\032I\362T\303\355\320\270A\037:\252\032O\272\323&\361L7\006\202\371M\3768\265I\274\004\354L7\"\261qc\341\007[\322m\027\210\344\324\n\256@.\277$\276\206\0232n\020\220/\355S\265\2429i\366c\352\234!\223\215\035\231e\233\345,&\235\0215\242&\247?\365\025\240\217\344\t/\362\262S\377\245\236\316\0302,\033\346R1\335\356N\003?\305\005\227\217t:_SO\345\224\022\022A\244T\313\221;\344\244y\326s\273\273\236FvK\232\253\322\263J\313/\375\367\030\251\022@\264\373\263CG \314\347\362j\221\371\\"
+	.ascii	"\200/\031\327\314\013\f\273\020l\371@\227j\226\022\023\n6\341"
+	.ascii	"\313\263\t=\231\227/\306c\t_^\t\002\273f\300\320\263\340r\205"
+	.ascii	"\336\207my\224\234\251C=\226~2\330vv0\367\224\352\2778\214\224"
+	.ascii	"\007**XR7\034\234\001\031\022b\017\241r\323\216\260\"/\263\b"
+	.ascii	"\317\214\331oq\027\025$|_\235TQ9\206\346m\0250 p\002\031Ih\007"
+	.ascii	"`dE\001,\005\202\356\336\013\331\266\024\247Z\212b\267\204s\264"
+	.ascii	"x\034\211\037d\372oi\360\326\"\236\022\221]N\2543\326:<uds\246"
+	.ascii	"\013\3306`\230\007]\202.q\251\033\013\357\030\212@\201\362\270"
+	.ascii	"\212A\252\270\247SS\263\312\265eQ0;Z\262\270\210&\222\357\016"
+	.ascii	"\367Y\0016\222\344\334\213\3704\030\367.<\006"
+	.text
+	.section	.gnu.lto_srxl2Process.part.0.89.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\353\001-\022"
+	.string	"\006\"xH\320\224M:\020\321\2037\270\007\024U\322\346\032\227 p},\0043\304\270v\025aR\314\361\225(\2212#\325X|\267\266\270\226\216"
+	.string	"\013\221\215\024\244\307\334GqF\235+"
+	.string	"a\016\304b\340<\266\345\301\304\222M\344N)`"
+	.string	"_"
+	.string	"c"
+	.string	"\273\267$\245\335\361\301\247\031x\237\036\217\322}z/\320}\332\257a{V3\315>\362\021h\257C,Q\024\265\273\337\247\3028\355\223S\331\321|\023\233\315\247\344R\220\246D[\212+\327\240'\b\212\023[\016\207\362\364\302\310\217.ul8R\022x\247Z\331]{<\267\352\2663\330\226`K\n\001\347vw\2557[%=?\376\\'\255SZr\322\007`\340c\261{bJj}&\323\214\033\335\276\321\314?\362\252hv\"\032/\270\031\267V{\221W\237>\216\017\321ND\343\255\222\247cb\005\222\335\321\301\247#x\237\002\244\245\3748\273PM\202qwj\226\322\276\215\337\240]\250\346\003\002K\214@r\252j\273\\\220\027\247B\360!\2416\366{\310("
+	.string	"\332\335\2136\2063iP\361\206/q`\021\331]\025\245\021\035\374 \231\352\020\221\307O:\017Y\013\004u\345\243\211\206\212\253\217\364\035.?\310 ^\323\177u\237\n%&\271\221S6\2216\fL^\274\376\350\277\355"
+	.string	"q\302Q\033\251?\326.`8\341\203+\326z\221\201/-0\200+\326\212\271\270`^\261\030\231\205\231\360\304 +\345e&\224\371f\302/\346\325\202\371\300P\346c\0350,\204+\374b0X\370\255\276r\2438\326\351\235\245\363\233\376\203\245B\213\274\330\322}\316\233\220(%z\271\004\365\324\202\323\037\244\030R9V]X\177\031b\217\223\352\217m\021\335T\017CErd* `\2021\b\331\001\325\t"
+	.ascii	"s6\211\320}(\026\231\253\340\320\263\246\001\265\263\310P&c\202"
+	.ascii	"\241\205\021\362\356\250\213\213\020\272 J\001\017\223\2353\230"
+	.ascii	"d\252\\\373L\024\206\205#\266F+\202\035\335A\233e\241\200\241"
+	.ascii	"\310\270\002)u\246\017\255\013L\347\335e\205\362\362\253\272"
+	.ascii	"a\320\020\2729\367\3320\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\325\005E\030"
+	.string	"\246\244\213F\200\234N\007yn\227\002G\267\374\374\232X\361\336W\354\241\215\3050:\t\331L\264c\2406R\251>\265a\023E#\"j\305\355z\n\n\212\254\314,oq\320!\316\222\210\375h\320c\025\272\325\363u\262\024I\246\024u"
+	.string	"x"
+	.string	"z"
+	.string	"\266D\001\013\207\304#U\363\206\361\361\353\250d\304\037U\021;\033\202\310\202x\376\362\341y\255\236\036\236\325\252\247i\232vx\246\nL`\375rXp7(\260\032\236\2175\3037\371\256i\336(\030\236\273T\036^"
+	.ascii	"Z\020Jza\255PZ\036R\030\262~N\360Y\036J8\020\341g\235\271\317"
+	.ascii	"\023\002\002{MS\f\214\371\231\317\266\032\300\275\367>x\245\312"
+	.ascii	"\314dZC\236\317\204<c\t\362\234\005\310\363\226\037\317d>\236"
+	.ascii	"\255\244=\276\001\217g\261\035\317c}S\035_\225\343\271\210\343"
+	.ascii	"\031\275\361\254\245\257\215g\263\256\361T\225\306O\325%\006"
+	.ascii	"v\306KU\031\037\025\343\241`p\231\275b\227Y(\353\331\330/\370"
+	.ascii	"\212\355\031\023\363\346\342\237\352m\301\273,\f\254Y\361K\025"
+	.ascii	"\353\223\256z\326\352\031LU\361\301\232B\227\242x\243\023\357"
+	.ascii	"TM\024\005dmF\335\316\255\232\323,a\263\005\264s\234[\223\316"
+	.ascii	"\261\234t\2163\177\202\372\353\370\245\226\013r\334\331n\\\323"
+	.ascii	"*\242\224s\262\330\274!\233\024\0029o\267\245\334\320\22360\246"
+	.ascii	"\2347\332|\006\255\n\227\020(\351\307q\304\016\2061\303v|\034"
+	.ascii	"\253;\016\222\324\030\364\361\356B\332\3616\273\246\271\031\303"
+	.ascii	"\2453\300\177G8'\317f/T\300\222\034\261\367\360\231K\337g\264"
+	.ascii	"\177N\013L\026uF\336D\035p\n\350\016\250\200\376\253\002:yv\365"
+	.ascii	")U\344?g\007(C\204I\360\347<n\275\303V4\203\372\271"
+	.string	"\316\031\365\363,\264K3M\266\204\245_\365\320.\232\242\346\215[\223eF\274\204\245\367t\265;A\323FX:\017\332\002\344\3149\362T:\211\006K~C|\203\342+\211\274\316\206=\237\223\250\223/\330\363&\362z\336\305 \236\367\216\34782\335Z\001n\250\201\020\223\350\022iIARn\260\002!\252\252\003\021\240\024\007\225\"\201\220\210LTa:\362t\\w\t\031\333=C\235Kcu\315~\372\272\337\237\227\250\354\002\201\213#\264\3156\352\352\317\365\036\b1\273}\230\002<\2113\273\272\020/\205&\230\212I\032@\261\203\200\276!y\251\273O\323\367:\324@\325\022<\371<\005\205zq\321\177\246<\327w\243l]q\344$\276\263\304\3728\222l\3006\376!\244;2&\312g\330\322Q\362\242\353+\321\035\256\215\214m\334\240B\\\277\374\305+\275\246\301>\362b<\203\210\234y\271+%\206\036M"
+	.string	""
+	.ascii	"^r\335\301\332\303\031\364\3534\035\325\034d\253\227(c\220RY"
+	.ascii	"\303\305\303'\220+N\\\261M\340\017\356\363\026\262\032"
+	.text
+	.section	.gnu.lto_.refs.856f49b1e47963f9,"e",@progbits
+	.string	"(\265/\375`\032\001\345\n"
+	.string	"f\036O3`I\223t"
+	.string	"k\361WX\377\212 \b\202 \b\202 \b\202\340\213j\217\210\303\320\240\331G\237 lCQ\355G\330f\377\177#\324\326\022\261\204\020\262e\n;"
+	.string	"@"
+	.string	"E"
+	.string	"\267m\326N\366\227\277\310w\256\267\354,}\266*\032\313U\226\251C\262;\362\033\353\035\226;\251C\226\303\325\037\313_\352\r\313\233\325\031,_\254w\252\263\364*?\265\267\377\370\\\b+\326\017\230\233\265C\272\271\236\326gTJ\372A\257$7\344\216\327\035'\001\344k\322+\231!\257\353BW<}E\nI+\327\323\375\310\223\353u\256\375R\257\332\367\335P\263\327\227\223+\370\371\016/!\002\204\007\016\242\277A\3533x\372\013b_\001\374\023\304G\320\372\201\247\033\210\275"
+	.string	"|\002\225\037\020\177\"\366\314\323%*=\"\366\313\323!$\357\020\237\002\037\202?\201\317"
+	.string	"=D\375\243\275\343\351N\364\214\347\317\"Ot6\251\200\234E>3y3)\221\356\344"
+	.string	"\275\360\210~\201o\301\364\n\346c\354\321\323)\347\020\354\r\212\334i\344\360\222\277\207\274a\344\316\2227\2503I\257\245\020\215\257\240~\n\357\237\0205\r\004\001p\314"
+	.ascii	"\f\b\270\231\347\254\236\033\332\206\310\214\005\276\002\274"
+	.ascii	"\2255\027\340U\341\f"
+	.text
+	.section	.gnu.lto_.decls.856f49b1e47963f9,"e",@progbits
+	.ascii	"(\265/\375`\212Uuc\001*N\272\177U \016\245\234t\272\273\256b"
+	.ascii	"&\246\246\357\356\347v6\325q\023\367\252\265]UoD\314\314fUuW"
+	.ascii	"\377W\367\365\377\323_\373xN\256\"Ca/$\274\033r\314\0352\326"
+	.ascii	"V\375(W\216k\226\001\027\350\245\305\032Sa\216m\262Gt\334}\335"
+	.ascii	"\226\220\275\345N\001\331\006\350\007(\bA\254Y\025f{\242\243"
+	.ascii	"\257:F\327\230Z\021\244\302AR\343\334L\b\026U9,\300\024Y\346"
+	.ascii	"\234\034B\322\\\325\315\207)\231\251\200]?vX\021\372\360\341"
+	.ascii	"\303\207\017\030K\252/\214\320\275\365\202o\262\006\235W\253"
+	.ascii	"@\347W\003\361\t\202\324\323\262\362\025\245}\374\350\351\360"
+	.ascii	"\301\245\357\255\030\356\256\3373\255\036\333\204\325E\331\367"
+	.ascii	"\366\013\337\342\300\267S\370Uj\220\216\336\221\343l\023WG\367"
+	.ascii	"FG\016\023\007\221\027^p\274s\\\351\243\246\206\035\233\276}"
+	.ascii	"\343\342\220\"\305\242\357\367\252\333\377\034\223\213M\031e"
+	.ascii	"\337\367\031L\243\263\260x\314\350\336\374\311\321\300\322\201"
+	.ascii	"\223z\213\232\361\306r\363\211\243\025E\306\377\234\252\344\322"
+	.ascii	"\364%Cj\f]\226\251\276o)\330B\005:\273J\007\215\327\226\220\276"
+	.ascii	"\3570\374\252l\252)\037\253\266<%\214\367T\031VS\323\203\321"
+	.ascii	"\367{9V\212\233\231\260\276\177\277p\021\004\006\3062y\216\201"
+	.ascii	"\265Q\322\367\177U\266T\267Hf\241\232\346J\226\334\367\355\205"
+	.ascii	"\337X\370o\250fQ\263\226\220\361\350\333+\372\351\252\016\252"
+	.ascii	"\357\333\t\377\337\253\312~\372?\b\241\235xrn\222s\356"
+	.string	"p\313d\371\363\353\333M\311\037\236&,*_\372\276\366\341\327<\234\301\034~\305\202=\250@\347\223\025\350M_\263\310\363\302\352ss\322X\361\246\255o\335\253l\252r\203\332\346\225\257b\271\331\224\314\311\234\223?\035\004\316\032Z\337n\303\257\033\234\366\357\257np\376uM\335W\221%K\372\376U\r\006?I,\030=\322\240\001j\211\021\222\004\215^\b\267)\274\276\257hz\025J\275\263I\244\005\234\212,\253^\rS\363\254Y\025n\263#\262\314\371\313\262\236\251\312\252W\311\274\226\251f~?|\020\352\2113b\267<\257\251U\203\316c\251@\347\353\023\\\305T\274\252\364P\307\274\202\251h\317yJ\346\264\234\351~\252VZ\023Y\337\3270\374\352\341\374\371\373\373\373\253\036\316W$\370V\240\263\332q0\317\2049\343\245\357\353\027\376_\277T\272\252\254u\257\311\234\237\242T\265ZW\257T/6\211\274"
+	.ascii	"\027\220e\316\371 \374Cuu\255Z\361"
+	.string	"aJf&\035\256/),|9g\016\037>T0\034y\307y\353\234\320\317\2258\260\251\276\257,\360A\310R\344\257\\j\\\355R\225U\356\025\256F\251j\257\311\034\365\224s~\bo\325\315\307\346\254#\f\231s\362\025\313?\364\177\020B\225\253[\252[\007\247\234u\344\360\341Q\006\312\033\276\234\223\037\204>|\350\274f\265\205\357=\200\377\252\345\317\321\351\322\246\006\262\3577\200\217\001|\t`\0135\350<\003p\265\362\327\264\372\244\272\231 \347\247\234\363\006SK\037\234X\337*\245N\251J\fj\225\177\020\302-\323\331OO\034&q\336\364\375\007X\303V\016\341@\370\025\203\263\376U\f\316\3126\364\332\006tVe%\263Z\316\371\247gH\223d\356{e\005:\377\203\205j\320i+\320y\214\315\\\203\316W\251@g\0065\350\374\353\231\207\0367a\234\302\372\216\325&\265\314F\275\320\312j9'/"
+	.string	"\307\262p\251\365\255e]\311j\362\265\254:\371\007!\234\347)7\3119Y\313n\316M\265j\340S\253\006\346\333\220&\264\363\276\361\2235\350\304\025\350LZ\032U\0036\355\316l\253\032x\225\332\342d\255\326f\322\030\300\253t\030\353\024\377\371M\250\377U^t\330\316o\242\340\267\027\240\375\204\355\321^\346\006\376\3639@\253\3477%\320 \370\333\003\177\217\340o*!\370\273\350\357\022pi\241=\373m\331\337Fd\277\3759\005\360\237\314\036\233\3746\205\261\337\252@\254-p\r\377\311\301\026\231\224\360\367\222\r\373\233\002\177m\362\023\026\270\205\377\f\262\366\376'\260\256\340d\247\375\373\310.\371[\257\266U\362W\245\277\222\360W\025\330\"\rT\023\222\374-\302oa"
+	.ascii	"\375\315\363\333\023\374]Db\217\3745\304_-\374\355WC\370\353"
+	.ascii	"i\215\374\325\203\277\n\375\275C\001\177\025\300_\027PE(\262"
+	.ascii	"\3014@\265\322\017\370\277\201%z\007\033\201J\202\277\"\233\217"
+	.ascii	"\304o\242\261`\377\335\372\004A:`\370o\200\023-\307\344o\035"
+	.ascii	"\026\310_A\374\235\342\032\370\337\241\216p\236\337\204\300\337"
+	.ascii	">\354\327\006\335\225\3417/\360\327\017\376\332\177-r\2637k\200"
+	.ascii	"\037\277=\341UY`\267\376\226\262>\376\256b\2730h;[\243\256\240"
+	.ascii	"\306X\332\036"
+	.string	"\277\255*\243\200\337\334\322/\244\364>\246W\2609\310.\364\337?\213\003\252S`o\374\325\332\370\021\337\001\360_1\177\333\331\032\277%\221\365\337\313\177\267-\377\365.G\36737s4\337`\211<\006\277\271\366w\322\322\370;\212\305\372\317\345\357\024\035\274\370\374f\331\337gv\306\337I\254\214\277\206\375\255\245*\371\253X\007\244Y\320o:\375\347\023\301\306\270\372{\211\265\372k\327o\253\376\n\304j\360\367\021\325o\0310\365W\257\337\302\370\253\020\0327\300\177\021|\203\r\277}Q\221\255\304D\372;\316J\375\365E\245\372k\213\277>\371\253YU\373?\367\333\026\277m\372+[\2775\233e\372\253\213\277S\324+\233[\355\001\370M+\016\377\227m\365\367\325oY\360\337\374\315\237\337\256\340\267K\277M\177\233\364\333\023~+\374m\007~\313\201\337^\340\267\r\370-\b\277\035\372\355\006\277\035\300o1\370-"
+	.string	"~{\341\267?\277\345\371\255\316o\355o\353\337q\376\366\373\273\357o\276\277\227\177\353\375]\346\357\273\277\361\376\006\363\267\227\277\273\374\255\366\267\334\337Z\376~\373\333\354o%\177_\371\233\312\337m\177\243\375\035\366w\327\337A\376\376\372\333\353\357\035\177k\375M\343o\031\177_\375\375\342o\251\277\241\376^\361w\323\337-\370{\304\337\r\370\333"
+	.string	"\377\355\376*\345?\331_\301\376Z\344o\025\374U\310_\255\376o\360\327\006\374\235\202\377f\376\217\371{\205\277U\370\253\t\376j\302\337\307\277\213\177\325\300\337G\177\237\340\357\341\377\243\377\035\376\023\377\237\370_\345?\337\337)\3766\372\333\002\177G\340o\b\374u\005\177;\340\357\021\376\346\340\357\017\177\037\340o\017\177o\360\327+\177\245\362\327)\177m\373+\333_\233\374u\354\277\233\277\032\371+\362\257D\376:\344\2573\376*\343\257W\177e\301_\035\360\327\021\376\367\375W\363?\315\377\345\1774\377\315\376'\3777\375\217\373\177\301\337\337\337\337\277\323\343\357A\341w\200\t\0029\333\260\020\205\204\001#\347,!\030\031\007\223\033\213\234[-\257\212UT\032\227\326\220\033\2244d\206J2\325\250\027Z\031\231\361\266\252p\032\223Y~\221s\256j0\322*F\232\276\367\f\033\027{Z\372\336\202\023\254w\313"
+	.string	"\275\236\\%\373\336\002\022\377\227L\265bF\306\f\336\030\345\035S\255\230\220\314L:N[\244\260\360\345\252*\016n\241\007N6\241\242\n\242%\246\216"
+	.ascii	"I\264(\351\373\252\226\364[\346\234\274\025\260\273u\326\354"
+	.ascii	"\316"
+	.ascii	"\331$2\207\212\323\233e\316\271\316\226\331\3350\367\356\202"
+	.ascii	"\251\312[\367\353\345\322\335/Z\312\304\306tn\375Q\203\316\240"
+	.ascii	"\nt\336.B;Yi\302\234\372\336\002\025~\b\327J\3362\313}k\245M"
+	.ascii	"C\342(NzW\306\250ei.P\354\312d\271Rn\025\233\206\314\201r2\263"
+	.ascii	"\314r\335N;2PF\370\342.\334\335r\265\\\271\313\245*o\226_,}u"
+	.ascii	"\323\244\344\2341\325\031\322\347\336\202\013\013N\370?}\370"
+	.ascii	"?h\360\235r\251T\345\343\256\362\311\037\235\036\\\260\250\351"
+	.ascii	"\373\037<\374\372\270\263\005\365q\347\177\354\360\177\333.\333"
+	.ascii	"\220#gN}\327\244L\325]\201#\027\345B\251\312\253v\321\336W7M"
+	.ascii	"\312\023\353\304\207\351B\316=\234\250\3353\353\244\322e%\363"
+	.ascii	"\0250\212\331\233>\276\353\2046F\356\274\377a\202k\3761\202\377"
+	.ascii	"C\004\377\327\314\211\231\306e\315M\336\262[v\311\332\f\230g"
+	.ascii	"f\206\312ur\233\314\300+\342\244\357\230\006G\266\344\350\373"
+	.ascii	"\237\033\370\377\r\273H.\223\233\344.\271J\252\362\212]\260_"
+	.ascii	"#-\345\327v!\002\347\310\337\262\363,\016\2477b\027\331\267\314"
+	.ascii	"E\374\206\304\356\020\b|\351\303\n\3139)\364c\245\306\2319\237"
+	.ascii	"{\0372\230\247\002\235\367\201\303\367i\303\367a\202\357\343"
+	.ascii	"\205\357S\205\377+\244\251\266\204\b\301\021\004\352\347\t\212"
+	.ascii	"\n\036\220\246\201\302\b\232\257\373\325:r\216\200\271\305\271"
+	.ascii	"?\256W\\\021-L}\257\017\340\333\n$m\372\336g\005\276\335\361"
+	.ascii	"w\226\353C\366U\336\034\335\231\276\0223\246\313"
+	.string	"\234\033\233\275\360\301\305A\326\231\311\362\207$\323\245\257\302\344Y0h\356\310\360\370;o\201\203\214{\303cLu\343c\346\254\345\005\211f&n\331<\370\252\033\033\362B\335\251\233\343\356\270Y\227\305\245q\273.\217\253u\271\256\323\325q\233n\215{\343n\335\247\213u{\\\0347\352\316\270.\356\325\255\2726\356\213+u[\\\253+\343\302\270+.UU\336\0306\316\355\337\315\277\311\234\373\352Lu\333b\265\374Cm,\2336\344\022\016\231s\362\306\260o,\234J\227e\202X\331\215a\337\242\226Cn\326\354\2234T\226z\\\226j\246 \327X6Rl\2272r\313\n\3472\265@\332(.~\310>\265e_\335\030\026\257\272\251t?\"\320\004\357\213^\347\033\303\332\r1;\343c&/\315\032\023\356{\340\260M\326\2403D\005:\3373\005\377\326\357\026\216\t\362\006\340\221\277\2514}\255\216\241[\277"
+	.string	"Lys\353\373\236(\370=I\360{\270\360{\262\360y\332`\273w\261\272t\021\351{\2363\370<Y\360y\322\360y~\340\363\334\300\347\251\302\347y\302\337\211\203\277\263\207\277S\006\177g\013\376N\022\177\007\t\376\316\017\374\235,\374\235&|\276\032t^\207\r\276\316\035\276N\024|\035/|\035)\374\2344\3709o\330\203\032t>\347\b~N\r\374\034\027\370\370\r>.\203\017W\203\316c9|l\206\177\213\305^a\202\253\302\346v{\345\257~\326JuS\265r\306\364)\253\364\275\271\006\235\266\312\320\255\033\234\327\262\257"
+	.string	"\254r\203\247+mM\250L!\003%\312\231^!7\027&E\256\307\312\213\016\2646\313\326afb\254\260Q\254\232\205b\327\252\322\262\335\242\3314\033e\331,\300\005\244\245$\253\233\017\223\205\354d'\304\222\375C\226\315\226\r\261P6\312\262Y3{f\223\310\rp\005Y\346\234{\334T-\361\322\271_\326\240\323\307GM\013!J\372\0363\301\307`\370\030\b>\236u\342f\327\345\205S\2231\254(j\226\364\265bI'g\236\370\372\036W\341\203\200\204\nr\211eR\2256\3546I\345\253X\222aV\211r\271s\367%\214\223\363\036Ga\234\361o\217X#9H\252)Y\222;Ut\254\311"
+	.ascii	"C\356\b\021C\312\365\035\253TsH\034ElW>g\360\220\362f\211\330"
+	.ascii	"!Y_\276\344\372Z!]\266\302\211\215\276\007\216\301\257j@\254"
+	.ascii	"\226\355\362\261"
+	.string	"\262\220\237\210\370\3756\210\375\262?\252\322\002\271\315au\330\035\026\210\245Q\335\324\272\254\b4\311[\002\261Y\026G\245\313\032!l\3142\347\374A\350\303\207\025p\230y\303w\313\366\250tY\"\254\364-\273,\217VV:5\021X\336\370\260^Ui\273\3228\374\224\371\222\235\316\373[\256\333\036n&\3109-\347\274\241G\017KrH\337\032e\350\226k\204 =\304\372\036\030\006\037X\207\017\314\202C\324\240\023hkX\033U)do\344\237Z\3474\205\243\357\201J\334\202\\\205\316\377U\241\363@6| \031\376-\226\020\031\277.s3\254\f4.bM}\255\214\333\030\366\252\314G\033\217\276\326J\355.HZ\231\276\007\372\300\257X\234\252[\245\313\032A\254\314NY\027\026\206\255\262/\254TUZ\252[\026\026\312F\331l\251l\213V\326\272,\021M\330\324\232\324Bx\"C2\255!-\225]\301"
+	.ascii	"'PF\204t\326\2648C\345s\017\314\201\257V\203\316\234\nt\002\247"
+	.ascii	"\360\317>\374\023\r\376i\207\177\316a\017\375\027G\357\214\f"
+	.ascii	"S_8K\200xi\351\353\227\303\220O\260\372\376t\303O\272-\004\213"
+	.ascii	"\252\034*\264 K4\267\035\310*?\220\025\316\224,8\226ie\2156e"
+	.ascii	"G\244\245\374C\\\272\213\335\324\262\257\266d\r\325u\230\020"
+	.ascii	",\252rb8\271\250~ivB\232hi\245\317\223\205\374\304u\003\231s"
+	.ascii	"\022\216\225\\\246\257\364\233\013\273\034ie:\257\272\331$\022"
+	.ascii	"\030\205+\f\256\225\326\254\nGA\263\241\327l:M\277i\276v\323"
+	.ascii	"}\275\3543\335\246\321\264\231^\323{M\246\325Te\227i1o\274\036"
+	.ascii	"S\233\224\351\271\376R\351\324r\323U\006`U\324\300\361\345\234"
+	.ascii	"\3649\023\002#9\200\373\363\013\237t\025\350\374\211\003\377"
+	.ascii	"\035\006\214\232Y\231\274kD\214\262\310]\333\235dv?\270\364\375"
+	.ascii	"\351\002\377|\362\322t?m`\254\t\343\306\313\032\034\327r<H\256"
+	.ascii	"\250\210\364\275\031&\316\234"
+	.string	"\3037\337\360M5|s\f\3374\202\377~\303\202,rf\206\356\207'\316\230\035\217\2767\277\360M\034\370&\025\276\331\204\251\344\204Q\223C\255\357\257\033\374[\006\237\256\006\2555\233\332]q\345\312\217\276\277W\326\256V\347$C\351\333j?C\250|\351\321\267\241T7\177T\344\336\372~/gG\013\020\256\271\276\277j\370\227\211Y\237%1\215\256&3}\177\271\314\222p\210\314\361\275\223\327\353\251\273\032\223\373\376b\341\244\315\002\302\204\205\223&{7\234\342\372\216%\315\2471%[\337\337\025\370\315\243\221\364Vuc\223U0\324\223\257\250\266\022\262D\353\321^;\376j_\b\026U9P`\210d\246\206\352\032\002\202\215\326\002\262\354#\215\354%\255\244\2314X'i\261.\322am\244*\033I\267x\013\351!\027J\346\374T\375\210\264\2235\253\302Q\236\204-sN6\222\376\321\001j\\\254\360.\030"
+	.string	"\314DM\271K\236)_\240L\351{\016jZ~-\347\235\220\026\023\232\021\266\200\365a\361Y26W\346\354~\336\2355\2000y\221\244\357\331\345\254k\323\303\313\221\276\347\227\232\026\345\353M\337s"
+	.ascii	"\303\347\334\351\245*O\272\347\236\235\256*jM}\227r\316\271\376"
+	.ascii	"\355\004\376\375\375\375\311\335\345\223\036T\216\364=\343\272"
+	.ascii	"\355\347+O,\252\357\311"
+	.ascii	"\345f\236z\200\305\365=\267\264\362\247\211\016+[\372\236p\375"
+	.ascii	"\245\276\251\022\246Ew\201\362\005\206\254\3579l]\271r\276-\325"
+	.ascii	"\300\205\361\360\230\312\022\006\313\317\267Vz\205\201\361\342"
+	.ascii	"\254\221C\307\206\215Z\337s\250\2322\345t\343\362\342\373\263"
+	.ascii	"\363qV\371\351\346\346M\216\026}Oeu\223\266\203K_\337\223J\372"
+	.ascii	"\024\306\344\316\311\3172'g\233\265\343\311Lg\231\n\3306\346"
+	.ascii	"C\214/Gey\360qqf\253+\355g\333O\266\017B\270\031\242\017(P\372"
+	.ascii	"\236k\257_j\240D\365\375\031\345T\373sr\300\312H\211\323\367"
+	.ascii	"BO\360\t%\0019\372x\370\365\375\371\344G\335\220$}\273\376\355"
+	.ascii	"<\321\032\206\225$9\372\236g?#\305\354\007\016\2639.;\247\276"
+	.ascii	"g\322\307\n\324Z\\\337\013\221\341\223,\307\212\216\256\255\276"
+	.ascii	"\007\262\205\271\201\354{\241%I\222\234c\031\306\324l\361\351"
+	.ascii	"<\325@\243C\354\347\030\320\310\030\246!}O&\177\323\202\242\254"
+	.ascii	"\321\367\f\373\233\r\257\030m}\317%\177{\263Vv\327\367T\3627"
+	.ascii	"`\334\034\327\016\253#\377\221sKH\313\212\211\332a%,\347,\017"
+	.ascii	"\005H\303\202\245\357\205Z|\375,\362u\202\335/9;y\220t\302\313"
+	.ascii	"Q8"
+	.string	"<\\&Z5j \177\202\275]i\245\345\276\337\363\360?\347G\n\n\033\247\276\347\220\237D\376\034\240\0300qg}/\304\204\317 ?\205\3749\346\215\030d\220\364\375\006?\374\237@\376\034\236\037rsi\372~\003\033\374\rx=z\234^\365,S\231\250R\003\027\306\003\347\226\234\342\343\247\027pye\255I\337\263\013\250\234\343RF9G\345\327\227e\307\216s\253>\371\333a\005\3106\003\316\214\223\307\317\255[\004\017\310]\337S\313\307\214\t\fL\337\357]3j\366\336\214\365\375\006\2653\307\231\243\256o\216\306\021&-\314b\3048o\b\271-\325\300a,OM\274l\374\274\341\303\215\225\034}O\254\263\206\016\325^\230#5\316,\270\251\270 ~\327F\033\226-'\215\026\243\243\313\206\230\276\247\214s\306\377\234\236\277\276\277\264\031\027\317J9Y\243\334`\344\264:\255\322\364\315\231}\\S\311\276\337"
+	.string	"cj\352\244\302^\244\260\204\3658\343\264\246\357I\265\301\351\305\213S\252\346\234s\326\b`Jd#\221yo\226+\276\342\224\352\234sF\002\341\300\232,\327\3541\241\321\342\247\024\037\2249+}\277wF\375\3179\001&\357\214:\241\2206\324\300Y\313@,\247>-'\213\213\226\343JHY\234\223\323P\2216\246\273\263\276\327\200v\3463\237L&d"
+	.ascii	"\003\202\237\274\274a\351{2\201\035\341z\321\367\032\216\340"
+	.ascii	"\337\214\023\347\232\271g\331j\247k\n\034\007<5\226T\311\353"
+	.ascii	"{\r?\260\337\375\372\251\236e\2523\212Z\226\207\263LIU]\337k"
+	.ascii	"\260\201\177\263\317tS\377\354\225\232\257\252.Pdm\251\341\005"
+	.ascii	"N\223\306\344\303\271H\331\217\034\233\025\035mn\362\331$jQ\252"
+	.ascii	"\372\232jL69>\340\264\261b\263w.Y\362\305\356\372\020:;\242\303"
+	.ascii	"\\c\343\360h\341\255\301\323\220\227\313V^\013\371\211\253\f"
+	.ascii	"IFO\217\214\013\316\3133\313\340\254\343\"\213\314\3152nv6\320"
+	.ascii	"\334X\3037\303T\023\017\257\225jAH\374\332\312\363\213\t\346"
+	.ascii	"\213yw\326\325\231w\230iM*\247.j\331\306\356\346\035\022\333"
+	.ascii	"\037X\020\027~\020\025\366\342\3054\363\312;\277X\005\021\353"
+	.ascii	"\373\f~\275\245\267\214m\331b\312\341\254\024\322\243\203\254"
+	.ascii	"m\317\214\273)w\207\270\245Y\351kr\371\231\2758Z|o3\334\306\272"
+	.ascii	"\364}\0062\370\265\254\232Z\264\324\262\232\314T@'/poo\325\315"
+	.ascii	"\003 \233\223X\0067|\323\255\232W\256\230nvN\332\360\253\351"
+	.ascii	"v\232U\254\354x\261\327\367\031\222\370\246\224jR\241\242\343"
+	.ascii	"4\227\201\b\256\177\265\272\235O\314\265'f\233\311v\263\355z"
+	.ascii	"?^\236\270\374A\201b\252\325\\\225sV\266`ZHa\t\323\021\333\243"
+	.ascii	"B\026\345\246\032\017T\021=\256\276\337\303B\270\374\252\372"
+	.ascii	">C\026>\320\0331\363L\314DC\033\0333\315\274^\3600yrd/y\323,"
+	.ascii	"\007\211ecF_\263\211Yv>\241Q%\254\214\314l*K\323\342\244\316"
+	.ascii	"U8`\325\331\023;'\257p@v\370@iC\314%C\314\2600\223\210I\304T"
+	.ascii	"\202\231\352\023.Y\036\200b\276\316\274\314$7\225tW\025\214\034"
+	.ascii	"}M0\023\211\030\037b{H\216|\r\331\202e\205\330\034j;\262S]_#"
+	.ascii	"\2679\376\250l\005\005,\013\362\177N\207\261\031~\310\">_\354"
+	.ascii	"\370\364\372\310\225\034\215\276\007\022\202\017\004\003\377"
+	.ascii	"f\220 \035\347\254\312q\201&\267\004j\302\257b\252\371\365\345"
+	.ascii	"\341&\263\225\016\027\227$\007\307\240f\313\364\261ez\235{7\275"
+	.ascii	"\352\220\020a\353\313\305eva\030cz\334\354\352y\002\244\315\251"
+	.ascii	"\357\367,\020\261-P}\217\341\013>\0065\\\303\324\252a\3560@\316"
+	.ascii	"5\251EU\225\263\252<\2306L\033\346\016\023\230\2247L\0357w(\355"
+	.ascii	"\036\\\224\027}\315\033f\216\3779<fR}qf\016\023G\022\037p\310"
+	.ascii	"1\237\2738RY00\301\307\300\205o\316\250&\r\032\325\255&3\325"
+	.ascii	"\311EF\n\013\037\033 ^\252\364=\006,\374Z\335N\0312\326\226\030"
+	.ascii	"\230\360oN)\315)\363\nCU\005\320\244,sU\026\007>>\346\224a\372"
+	.ascii	"\232W\277IeVU\275\366\021\3434\327\325\367\203\241\233Vg\030"
+	.ascii	"\026\036n\372\352$k\320Y\177\260\301/^P\001\026\231s\323\004"
+	.ascii	"\f\276\031UM)\251\353W\2530\0254\266\345\025\374z\375\316W&\325"
+	.ascii	"\204R\232P\025\315Y\225\003e7e\231\253\3408\300gQ\252\314\350"
+	.ascii	"\373\013O\360M\247j\256P\232+j\336Mf+\0374\345\022\374Z\363\316"
+	.ascii	"\233\271\232MJ\263\351\276\251\311L\265\303\005\367\205\203_"
+	.ascii	"\340\201_\357\2333N\234\373\207g\216i\271-\373\376\002\r\234"
+	.ascii	"L\3139s\370\211\213\023\026\325\367G\334\335\233\276t>;PJ\256"
+	.ascii	"\266=\345\335\273n<\214\371\345\373u\363_6\267\315\223]\363["
+	.ascii	"\323\352{\351\206~\371~r\020a\312\352[\2215\350\324P\201\316"
+	.ascii	"_\210\302\277hn\232_5\277jZ\r\347\234\277\312\244\260\360\345"
+	.ascii	"\254*\017\267\320\006\377\257\357\377\314MU9\347+3\231\253\234"
+	.ascii	"x\316\277\276\232\265z\370{\252\255\003\370\177\377\021\305\234"
+	.ascii	"\237\250\204\345\234\353\032|D\331t#\203l\322\345\374\264\305"
+	.ascii	"\024\201-\253\247-\032Qi[V\027\242\322\2662\323\023\021\246\013"
+	.ascii	"Uy\213)*-\347\013OOL\"\264\362\205\250\264l\225W\324Y\325\234"
+	.ascii	"\334b\312OZ\371B~\312M\031D=mYE\2455Y]\210J\333\262\312i[\331"
+	.ascii	"B~j\252j\361\224\253.\344\264-49M\313\312BT\232\226UT\332\326"
+	.ascii	"Z%\"\345#\216\214)a_6*\217\250\247<\005\003GS\225\005\272\250"
+	.ascii	"\244V\306\313\271\252\261\310U\231.\347\001\344\214C\253\n\257"
+	.ascii	"\211F\255\342D7\345$\245I\253&s\316\034`8qi\345':\246\232\351"
+	.ascii	"\242\220h\345\214\304IE\206\221s\316\n`J\322\345\257J\307\324"
+	.ascii	"\003G~\301\"\347\013r2g\03093\325L\227sf\3129\003\253p$\003("
+	.ascii	"R\320X\002\006\016)Q0=BE\240H\303t'\t\251('%\016\2551\250\242"
+	.ascii	"\350"
+	.ascii	"\002\225(\236PQ\224\016S0\221"
+	.string	"\2028$\016\203Hh\211#\232\252@\202\221\022\212#\006cJ\302H\t\305\021\030\242\003FJ(\216;B\342\320(\003J4B\203\t\"\232T\364\251\300U\200(2\026\t\241iP\230\244D\224\246\303\242\"\"\021\206\212\214E\030\256\002D\n\342\320\230\036;@\205JGE\304a\007\306\243R\007\032\216\216\224\210\304\"\021\230\022\241+\f\217\247\nIEH(\322y\025 \216*\322 \022\232\202\030,\241\003L\241hT\221\026\211@\243 zt\323#\261Xd\256\220\026\021\021\207\351\321P\t\005\021Q\017\t)j\"-B\215C\021\303\343\261D\212\036{N#%\022|\256\002\004\2124L/(ab\304\261h,\032\"\345\b\211C\022r\210\303\022\320\025\206G\301a:$\216\310\200\036\177t\226\214=\036\200\350I\207\304\021K%vN\034\035)\031eP*\242H\303\324\202px\024\364@z\f\036\t\361"
+	.string	"\221\300\220\016\215\037X*!DK`\020\216H\207D\245\023M\203\351\3214\242\3511\230\201\243\022\212\013A\0356\004@gI8\302\347\202\220\217\007 Rc0\t\304\004J\004\245GJG\264\304Q\020E\361(\005O\006\035cJ\"\311B\022R0=\036\tG\030S\022K\302\021\302 j\3549\221\2028L\323!\322\221\0304\246A\350\221pD\216O0\r\212\260\360\242\241\021%\242)\360\025 B\002D\b\261\004|\b\006x\300"
+	.ascii	"\017\316\207`\300\320\020\003D\030\302\027a\310\242D%d@\211L"
+	.ascii	"\f\217"
+	.string	"G#\232\016\215)\354\220(\032\021G\b\211C\0222\b\207J6=\242J(@\215@!F\223T8!$\016Q\340\224H\001\"\b\207J)nz\025 \214\224P \005Qcz\354\200XDB*\026\005@HD\355\221\310H\t\305\3614\246I6\305P\034nP\301\230\242H\350\021\232n\300p\3021\230\001bq\230\026\021\225\214x\222\216H\307\244\024\027\226P!q\004\232\006\215KE\024'\024\005\217PhHS$\t\32148L\213)P\242\320\221(\305\320\210X\234\300\222Q')\210Td4\223\204\350\205%\364(II\204\321QP\205\016q\230AJ\004L\021<Q\034\022\245P:J\022\272\220\242G\324($\016Q\020\245\301#\021\222\2221=\001M:\002\200\007=\n\026\351\244F\024\005\342\260\310(\034\"\231\304!\022>\241\bUQ\264\024D\302G\0245\246@E\240G)\210\022@\nN"
+	.string	"\205$#\f\302\243\242\212#jTq\002M\203(\f\323\"\t\240\302b\006\214\303\240\020qX\204\036\225\210\226\202HDK\306\235%\245 \321R\020\351\347h,\032\215hP\212\036\215\214\212;\250\260\210t!%\016\213I)z\354 4\006S0\026\215\204(j$"
+	.string	"#\243b\252TDt\034.\005\211R(\241@\205\033TH2v@\217\322\264hT\221\022\031\213iQ\320\210\250\230*\005\211R\020\207*\322b\021\351HTd\324@X\034\032\321$\"\243\244#\"\242\"\343\221hx<\0329\b\207D\351\220\250\324\363\223\036\203FDB\245 \n\242\243\022\212\243\217\221x$Z2\022\241G%\"\243\243\261\350\347\204c\020\211\350H\204\n\207F#\212B\221(\351\210t\2010X<R!\230\004T\221bhB\221\261\b\230B\021\003E\306\242\263hL\211E\016\302\021*\034%\241F\240\220\030DB*\026\001'\240!\204R\177"
+	.ascii	"\202\222=\341\030\314\3009<\036\215\367\210\036\217E\f\354\240"
+	.ascii	"P2\201\236\020Tq\024\022\203&l\020\216@\225P0$*a\264\310\250"
+	.ascii	"T<\372\bG\240EC\024P\021\304\3420\r\022\207\351\021\025\002"
+	.string	"\251\220\016\215\305\2411\t\013\321\324XLJR2!T\n\242\350)\032\021\2077\275\n\020\035\034\215(\nC\243\320\210\016\215\206)\021\025\016u\216D<\036H\215E\022\350\021\212\340\t\024N\224\b\025\0263\220\032\213I:\250\260\210tQ\242\r\244\306bR\317\221X\034\246IE \232\006K\b\225\202(0\272\302\320\004\272\302\320\004N\2610\210\232`\344\021\006Q\023R\242\017@8\032\006O\030Q##%\022\226R\036\024\206h\021ZBH'\230\006E,\031}\214)\211\021A'\024\005Q\034\035\005'\200\036\t\207<\351U\200X2\002\225H\217\301\243\013)\221\016\232\244\302\t\020\2240\301cD\205C\024\212F\022K\306\243\340\320\210\036-\244D\245\342\004x\3204XB\305\0215\032\241%\226\214=\306\224\004\261\204`\032\024\221B\260\2040\210\226(2\356\030S\022\030\210%\034\225\322`j\302\230\222"
+	.string	":\022\241i05\201\"\rS\242R\211%\243\005b\t\307#ZT4\222(2ZH\321\n\024\0311\244D)&\226p\354"
+	.ascii	"\2124<Qd\374\t\246A\021G(\221\030TQ\264\023L\203\"P\244\240\321"
+	.ascii	"('%\022a(%\016\225\260\221\022\tKF3%\0163\020\242\304\024\303"
+	.ascii	"#Q\211\207\210\036Y\024)h,A\347E "
+	.string	"4\230\360\301\321\222\321\304\316U\2008\242I*\244D\035^LB\215\035\244\305\242\261\203\035\025i\n\"zt\n\205\303F\223T8\241cD\205AT\305\231\022\205H\211C%\340\207\206&\220A\0074P\001\\\004\342\203\243%\343\261\203%c\007\304a\020\251\203\"\343\261\003\020A)\004\2156EO(\n&\235G\305\"\tD\346\177\340\223\352\345\256\257\313\232\264\363\306U\2232\243\315\331\201h\277M\263O\372\305\215\2543}\201fC\007\236\025Q\213\213\353\333\223\004\226i\031\"w\327\027Hv\341\214\354\251\357/\270\303?\320\311\271f\310\032\335\232&|\031\230\316L\031;\341\240e\305\341\"v.\331\344(\302\304\315\016\232\034n2\302\256\231\257:-\177\300%\367\357\307\0226J\356L3\031]\232\222\234dl\232\032bpH\272\200w@\314\330\0341\313t9\023\007\006\004;\320H\032,\0367\372\002\213"
+	.ascii	"\221K\220lc\372\276*oF\357H\031+d}\201C\200D~ \327\256\374\314"
+	.ascii	"\227U|H\370\362\204\234m\300\251\2617>\202\354\310q\323\226\206"
+	.ascii	"\006\210\327\327\351e\215<e\255\370\361\206\233\254\310|x\265"
+	.ascii	"rM\217\316\005\320\207[\327\025\225\037}\201;\200;\200=r\230"
+	.ascii	"|\310\330)A\302\227\263dx\370\201<\016\354\001\344\312\363z\343"
+	.ascii	"\262\225\177~\264\354\355\250\322\367\027\220a\240V;\331\272"
+	.ascii	"8C\3328\375\317!z\003\302\327\367\027 \301?P\307}\323B\356/G"
+	.ascii	"\315\313\271[\362W\207\343\372Y&xtJn\364S\305\353\301\304\205"
+	.ascii	"\r\363\356z\255\265a\3258\335\032K\2322\231e\232A\345.]@\032"
+	.ascii	"\246\332\337\237\f.,4\340\f%\\S\362\314\222RH8ib\234`\351^\230"
+	.ascii	")Wf\330]\253\361\203\253o2C\326\222\251\252s\253J\255\231bBu"
+	.ascii	"\216\335\220q\325#y\235\270\304\300\3617\340\213d\232\317\234"
+	.ascii	"\2300x}\177\001\022\377@\027\246\\\243Q\266\260\262\342@\251"
+	.ascii	"\337\352\260;\200-x\300PI\363\243/\020\n\030u`\013 \013`\013"
+	.ascii	"\005h\345\334\004l\361\343\227s\323O\255\032\324\252\301\025"
+	.ascii	"\343*\302v\336_\020\004\003\237\206\016\\\321N|D\001\351{\002"
+	.ascii	"\235\200L\030N\207\026\022`\223\331\366\203\346\202\211\0050"
+	.ascii	"\327\2675"
+	.string	"LB\372\376\002\032\370?\377\314+(;(T\372\366\365\235p\252\205\244S\031\275%\336BGF\313\357'\234\277\030j\340\364=\337\234Q=c\264\230\254Y'gM\366\312\372\376\202'6lN\276j!\351\2247f\351\203\214\310\2206?\371\336v\264x@\361\241I\223\346\\#\204s\023$y\313\234\263<\344t\271\223\342D\315\3175\326\t\360l\r\036\023\2071f\314\234\313\272\306\343M_M\263\305\244\305y\346\347R\017\030d\256\353\252\357\251wF\2558\342\247\325%\314\303\234d\204\264\230\324 \340\rM\037\026\037\327\336\21221?\311\234y~Vr\2243\357\034C\307\005kk\214C\206D\250\003\002\324jH\325B\f\243J1f\212F\323$\215\001\363\025@ H@\036\221\312&J=\023"
+	.ascii	"\004L\214U5\225cL13#\"I\nR(-\273\001X\351\325\2427Xo0\211\377"
+	.ascii	"\371r\"]\004\005\221\023*\231\205,\2454)2\022\032+S \223\313"
+	.ascii	"N\n\214\275'\351\253\304\203\027\0033 \340\377\001\205\"\372"
+	.ascii	"m\b\312\222D\256+9I\024\314\b\206\031\\\336\356\237\314\261!"
+	.ascii	"\357'\215\226\242"
+	.string	"\233\253\343I\225&\001/\260\354\253}!\325\311%'F\347\322,#&\322J\270\346\302F\030\037\333/\351\215\2349B\313\352\fJy\004|\205F\341}7\214E;\335\037#\375i\206\245\246n2\200.\033S\370e+h\216\213\201\250\247o\350Q\237P\330\020\271\263\246k*\200\004\037\351K)\251\310X6K\016[\200\225\2006&\016\327U\373\261/\r\250y\265\253\344\307NS%@/~\373\353\337\273\200\003\f\225}\013e\030\3216K\004\304\234\212\203,\376_\375\247-z0\2250\343\245;\363K \300c\341\361\007\271\256k\333\201\366\311\033\300\205\233\370\270\242\331h\216\261$<\005\350*\313A%\003\006k\323n\033\250Jn\322\232\376|!\312}\275o\322\234~\0227\307\035\241\270d\033p\032\264\037+\003\211o\001\372\nT\177\304\321\204[\"<3'3\003^\336A\253\214\302\261\027\201\361^\204"
+	.string	"\262\3500\022X\201L8\350{\354U\300\233\233\270\374\242\347XL'\255\335\305\276h\255\243\275\264\345\277\212[\004\236\330\317\2061\367\235\330gK;e{y\020@G~\024\273\t{\366{\336\335\231\221\001\350Q\255\314\341\342\257V\200yh\223\314!\301n\032\017\226\0266\266\026\266\3103\037\013\244\020\03408\331\207?\302\243(\366\262\223\337@\270/o\2155\310.\"\250\206\336 \305\347\303\030jy\353\214\322\224\225\221\317\263z\263i\366\300K\206`f<$ja\210\263\t\247\004\265\005\317\2514DA\033\356t\3424\277\344`\016?\377\276\312\253\002\"jow\330\273So\370t\333ku4\367mg\303\3032\362^c \376\377&\326"
+	.string	"y,\314\001\240\303\210\223\236;\032|;\210-\254\267X\363\215\034\315G\264jWg\232\035\021~&\345\276\025\373=\367@\253\001\362&\033\253\3270s\2745"
+	.string	".aW\376\247\r\032\332o\365FU\313q\3635\327oS\374\202\3110\214\031\360s\212?\223>h\215\335\323\325jk\311\304\333v*>n8oZ\276p\200A\216-\357]\256\355\f@\345pj\215\372\370\217\360@\005\373\026\210n\2400\236^\371y\344\215n\231\0017\212\243\n\216YN~R\265\353\031\016\300\373\375a\003\346\205\210Q\001"
+	.string	"L\263A+0R\260lW\265\274w.\305e2.^E \340E\031\007\350\3430t\244at\256\007\217\3129\322#\364\230\221\324\025J\003\321j\242r\202_+\353k\246I\023\223\333,\236\024W\220\377S\2506Y\256\201U\337\376\244@\021\247t\260\261rJ"
+	.string	"\271\241\247\357\t\213fZ"
+	.string	"\\7\202!*\241\373\261\242\212b\376\331\213g\224)\236#\333\033Z\373\312q[\356\260\314\304f\n6;O\371\341d\316\3140w"
+	.string	"}\276\253\230q\004\201\213\352\341\262!\206\231\021\350\345k%\350/\355Q\032\\\316\004(\200\350\207\205@)\363?\201\237\036x\326.>\006G\324qg\217\211LGV\354\244D^\331\202\022\013-\306\241/t\260E<z\316?\341\220\314Q\244\272jT\032\246x\354\342F\212\207\3344c\367\034\026\272\325\300\334(*\347\343(\232\244\333\266\225\231\236v\324'S\266\301\306RTK\371\300q{C\"\264\206\3423\344\336\031U\024\226\260_\025\202\363\371c\206G\241\t\240\214*\026=\343\304\374\207\003\306,<\243\005&\335[Qe\237g\310;\260$\013\350\247{~\t8\336{\222\364\023\033\216\344:t\324\027\370\353\300\027\247U\264\304\213+\t\254\365\360\"\3268\226\200\025z{g\272\352\262\347f\353n\317\221S\236\2724\320\205\036\374"
+	.ascii	"i\337\"\315\250\002:\247(J\211\0232L\002\236r\221\375\345T\033"
+	.ascii	"t\376\325\3546\363\177\262QS\003\331\373JW\201?~7\324B.?\032"
+	.ascii	"(\222\370\323uTk\017R\001\371+.3\3144KF\237pMi\200\237\023\201"
+	.ascii	"\244$9\022\026N\rp\337\230gc\024U\032\201a\347\362!\330\354\226"
+	.ascii	"m\237r9\323J\n\317\026Yh\376\315\311\357\024gc!\223BhY\356E\027"
+	.ascii	"\003+H\340\363\232@"
+	.string	"\020K\305\343'\\\340\246\344<4R\266\260H\362\022\241cMj\327J]\303\321)\363\355D\327\nbA\201\351\204\033V\271\240g7I\256\200\314\004\330\260>\323\034JbF\254\203\343m=}X\\\312\200\364\246\300\036;b\002\034\374h.\\eVd\231@O\312|\272\305\375z\355\"Q\206\002\255\243\002\365\256\276m\237\231\322\235\240\bK\337\356\351\024wd~\222Q\020\353\350\310\217\207\313\006\326\354\322\0045\310\214Leq\350Y[X\354U2\262\211\005\260YhmI\220\273>\0174Q\365\344[/\302i@\022J\2419\242\361\311\210\270`\203\340\221\210\227t\001@AP\327w W7\344\261\355\nnl\376\362\2759\363\377\257Fq\016?\367>\332\020\364?\nAK\016\340\216\246\206\312\022Q\335\261\224\214\360\255\210\303\213\3434\274\216\3430\r\005\003XgI\002\252\344\025\253M\370w)r?\265"
+	.ascii	"\256bgHh\214\025 q\230>\326\237\366{\034J\2258t\273e\354\321"
+	.ascii	"\232\223\023Qg\342\013\211(X\260.\324\255\n\350\264\311.\321"
+	.ascii	"\262\305\212(j\177t\316fK\345\237i\310\215W\363\366\372V\351"
+	.ascii	"\311\201\2473\023\364?\346r!\335\323\271\322o\t\375\206\035\223"
+	.ascii	"\242\253\327M\343$\320\036iWk\315\274|\264=\037L\223\271\326"
+	.ascii	"\375T\266\324\271`\206_\024#RF8\276\202\332\316q\366~\224\352"
+	.ascii	"\bS_\200\237L\315\272\261\020\017m\013d!A\204\007\2020*YT\254"
+	.ascii	"\036\347\034\376?\024\223\361=p\2109\037\241\357\003(\254\016"
+	.ascii	"Z\332=\245\020\231V'z\376\233E`\263p1\177\304\277|I\312)7\270"
+	.ascii	"\340\037h\013\323\363|\356Or\234\3657\3659&\232\026,l\326x\374"
+	.ascii	"j\270\335\330T\240\333\025nu\024\246*\226 \254\260\3749:\034"
+	.ascii	"\341\331\204 FWAA\360\254\247[&\265lH\331\0078\371\301\017E&"
+	.ascii	"\377\347\364\322\255\215?\023\027\ti\005\266\276\376JL\244[O"
+	.ascii	"\201*\261\013Q\262\267/\253\311\253\220\267\357\206u\214YJ\f"
+	.ascii	"\330"
+	.string	"\262\035=1\201\267\277>*\331\202H1aq\002\346\305\004\242\220Rj\025\357s@3\340\357\003\347\245\363\376\257M\262\332?\\\216\n\036\262\326\267\330W(\256nA\263\260+\212\247~\325\224\016\3152Iuqe\265\270\362n\315\006\311j\022aB\373\210p\223\264\326\025\002Q\330\340\tX\340.\204\022\215,\246jS\313\347\245e\022/Y,\231\234Hd\343NO"
+	.ascii	"d\341\r\206\2327\252B\0034\205\344\3376\247\203z>\344=g\231T"
+	.ascii	"\315\207\3551\212{\234\270\276\223\366R\321\246-\365\024FS\t"
+	.ascii	"\004\331\360i\003\353\212\030#1mG\264\310\222js@.\247\347\247"
+	.ascii	"\275\311\r\243\235,\337 \3173\354\201\265?\250w\002|:\3625>\371"
+	.ascii	"Q;]\001l\2113\305\305\355\020\240*e^}\357\242h\322\036\360\022"
+	.ascii	"\252\231\035(\354\344\240\254\031\312\342s#$$L\372\037\273z\b"
+	.ascii	"f_K\342\340L\254'\324Mo\310\263\326\006\020\332\230\20004\023"
+	.ascii	"'v\203\253\347n\276\356\177\022h\377\273m\316%\357F\361z\321"
+	.ascii	"\220\361\030\3031\305\316\241\344\336<P\235\272\324S\001\346"
+	.ascii	"\nz\3022\257~\b\204J\217\222=*0zt\260\377\334\311<\365"
+	.string	"\\L\205\024[f\244l\307&\274\2745\264\307\3326\302\016\021\245\002\343D\266\022\312\251V\372\337u\267~c\364a\2579\257\362\203\031\312\376\317\034\017EVUY\t\230\225\304\215\250\2063f\222\203\277\354a\223\337\270\376\244^N}\315\351\231\b/F&\246\324\322P\350\3105\362\251\231\352\356Z\231\003\353\024\255-\256wJ\020l\373\0261qnC\354\205G\002+\037\331_X*\2034\211Gn\264U,\005\n)\372G\204\246\235\366& \376\033\b+\200<i\227\225\211\367\333vn\312\017\347\271\251.\001\013\234\036\207\301:\370\230\303\225\310\024\230D\342p\237\300\335p\2635\341ec\227tc3\323\364\r\214\274f\374\352\3573_\345\205nQ\0178\033&x\\\224\264e\215\347@\323\207`\206\f\304\005q\262M8\013\277\037\2420Ir\3165\361\332\006\237\316\003\261\005G\023\342\253\323\362b\262\340\\\223"
+	.string	"cQl\271+!\366Xx\254\204\001KA\025\302\370L\377A\300)\240\003\356\223\003\317\371%\357\311dw\334J\226\265\"_\300\321\324ZY\232\275\335x\033Bt\200H\331n\342\356+\224 \355\036C\202\271I\342g\244\n\270\306\320\001)~#&/U\336gm\237X\360\037\017\200B\004Ds\353{\t\271\267:s\316"
+	.string	"N\251\345xG\2779\345\037 \207\255\304\314Zn\033\240\231\352}\b!8\211!\374\003nP\t\252\364\020\335\031\3272\230\313>\311\003JZj\013\270\030\274\214g\026\345\n\3332\243\0033l)\254\320\343\210jZ\207k\362\024\340\352w\026\022|A\324q?\026\"*AHN\"\207\267Pl=\274\232u\275\212\332#\316\245n\304\263S\237\177(\r\234\030\344\tE\203\3050\244,\025"
+	.ascii	"\027\225\026l\345[\263\226\247=]\365a9\221?\204\275\016n\213"
+	.ascii	"&\327\002\306\201g\341\326\007\034\346\026t\254\231\027qb\030"
+	.ascii	"\355\0163G@\013\243\320p\035\260\302g\347 \252m\236B\354]\367"
+	.ascii	"\273o>\364\330\223\316\354sk\026\233\254y\326\006\302\371\252"
+	.ascii	"c\257\274\266\032\"\253\356k\034\357B\370\017\362\3647\351\023"
+	.ascii	"t{k\343!\352nu\003\350\017\372{\b\361\234=\300\344\271\236\\"
+	.ascii	"\333\f=l\274\313eW}\263\273\201\327\344\356\203{\333\341\006"
+	.ascii	"|\246\2135TY\300\360B\255]\310\350/_\016\222^0\375\020\275+<"
+	.ascii	"F\361A\341\\\271j\327\032}\244\341\037\r*\346b\233\336\236T8"
+	.ascii	"\307J\261\355;\267\177\247\234j~\347\372\223\031\273\230\362"
+	.ascii	"\017\331}%\234\235\370e\310\337\215\337\036\370\344!\363?|~\371"
+	.ascii	"l\330\272P\336\023\255\267\345\3732\354\321!Q:k\361\240\320,"
+	.ascii	"\272\301\235:\374\324\342\305\365\322\202\213'q!t\234\333\177"
+	.ascii	"\357\236|\316z\2403W.\362|\367L\271\264\356\201\023\3753\267"
+	.ascii	"\355\220gg\376\2735\355\2205\266\237\215\177\330\321\262C\177"
+	.ascii	"\313\354pm\313\334G|\264{\021\324~\032\217\304m-WD\373\353$\177"
+	.ascii	"\031x\234\245\377l7\225\373OF\266Iq:YfK\035\013\271\005:\361"
+	.ascii	"\274\316\t\265\r\353\017\322=\030\336@6\001w\025\252\017\275"
+	.ascii	"\306/\207-\2619C4\260\b\271\332\2271o\334a\344\347z\207\323\265"
+	.ascii	"\225\237\276Q&_w\217\310\336\237\2632\235h\336z\342\305`\376"
+	.ascii	")\336\314\307\267\345\221\376,\301\177\263g\367\3777v\371\230"
+	.ascii	"\245\311\277\227\306\371\357\2405\335\264\372\357\341h~G\342"
+	.ascii	" 1\377\032\233+~\332\304*\206\225\207\377\334\337\n\231\353~"
+	.ascii	"\343k\217Y\026x\037e\330\326\203\325?\251c,\343\214\332geO\250"
+	.ascii	"\371\251o\303\305\245\023\2711a_n\276;\210wi\357\bs\204)7\020"
+	.ascii	"\003\007\025V]=\242s\343\006\320\246\205}\223\356\320\213/\002"
+	.ascii	"\234\313\315\363\342\027.q\321\276{tVr\277\260%,\177/\236\330"
+	.ascii	"\030\222\324\354\n"
+	.text
+	.section	.gnu.lto_.symtab.856f49b1e47963f9,"e",@progbits
+	.string	"readBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"processBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"readBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"globalResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"srxl2ProcessChannelData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"srxl2ProcessControlData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"srxl2RxWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"srxl2ProcessHandshake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"srxl2ProcessPacket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"srxl2Process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"srxl2RxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"srxl2RxIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"srxl2TelemetryRequested"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"srxl2InitializeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"srxl2FinalizeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"rxFrameTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"microsISR"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.856f49b1e47963f9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2576 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023"
+	.string	"!"
+	.text
+	.section	.gnu.lto_.icf.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\255\006\255\034"
+	.string	"4!\241\007"
+	.string	"]"
+	.string	"\305\266\241\240\004\020\002"
+	.string	"\002\001\002\002\003\004\002\005\001\240\342\234\212\n\002\317\246\240\363\f\032\006\002\006\003\352\263\360\321\b\004\275\373\325\374\016\016\002\002\002\005\002\007\002\005\002\006\002\b\006\002\006\005\370\263\356\273\004\030\006\256\256\367\345\002\024\t\002"
+	.string	"\002\t\n\002\b\t\007\b\t\345\247\331\301\001\b\002\013\002\013\f\002\b\n\013\322\252\362O\002\002\005\f\215\326\247\375\b\n\006\002\006\r\370\314\257\265\t\016\017\020\354\241\333\263\003\021\273\276\306\305\n\004\004\002\005\022\242\262\337\313\t\006\f\002\b\002\r\002\005\023\342\336\257\361\004\n\002\004\002\016\002\002\005\025\026\027\030\240\374\304\230\002\006\006\002\006\031\032\367\374\340\302\003\002\002\006\002\005\033\244\373\305\351\007\034\241\261\333\336\017\002\035\251\310\325\b\024\002\002\020\021\r\002\022\036\037 \350\230\217\377\004!\325\317\235\276\002J\002"
+	.string	"\002"
+	.string	"\r\023\006\002\006\002\024\"#$%&'\327\217\344\374\t\004()\352\270\372\363\016\004*\352\226\312\210\b\022+\342\215\312\307\t,\355\364\303'"
+	.string	"-\217\346\223\377\b\004.\201\273\366\332\b\006/\240\276\346\351\n\n\r\002\r012\246\214\356\233\n\020\002\002\02534567\342\367\231\365\r6\013\002\026\006\n\027\002\b\002\027\002\0268\325\217\210\322\001\b\004\002\0059\352\377\252\313\016"
+	.string	":\354\272\344\251\004"
+	.string	";\356\300\247\373\013\004<\236\376\250\313\b\002=>\350\300\306\254\005?\371\257\302\346\003"
+	.string	"\002\002\005@\304\257\212\202\003\004A\233\304\365\321\002B\327\343\226\340\r\020C\363\325\330\207\nDE\345\250\215\360\001"
+	.string	"F\234\267\357\361\t*\002\004\002\030\002\006\002\002\004\002\016HIJKLMNOPQRS\256\330\276\211\r\006T\241\250\304\347\005U\327\246\207\206\n"
+	.string	"V\377\240\374\266\002\252\001\006\006\004\002\004\031\002\032\r\006\002\r\002\030\002WZ[\\]^_\347\273\234\355\f\r`\226\333\275\332\003"
+	.string	"\200\311\250AQRf\306$I\ni\r`\202ADU\365\022\240\223:\220I\025\311h\nJ\nY\366\f\275\205x\343E\326\344\002\362\311<a\377\f\\\364\307\266\205>\207\274\324g\237\201\377\\\361\253\2439"
+	.ascii	"\247].1\004\222\376\260%fp7\347\232Y\030\245\307\212U\360\367"
+	.ascii	"\037`O\276$\367\021z\265\277q\327\0176\270\023\342\2442\354w"
+	.ascii	"\220\177Y2\335\364\037\362\350\304\244\220Z\027\027\305\2438"
+	.ascii	"\037`L\342\323<K56\254\241`\367\267n\251brp\271S\207\265\213"
+	.ascii	"T\205\330f;\260\347j4\"\f\374x\327\340 \335\265\206\235\370\340"
+	.ascii	"\275c*\313\\s\366\360.~\213p\b\351?\345\304\026q1\033\362\007"
+	.ascii	"\344_T\367>@\265\244)`X\246q'\264\323\3340\n\365js\343\212\b"
+	.ascii	"\350\216v\016\253!\215\251\255\036\240\262\377\346\301\201p\326"
+	.ascii	"\310}\241\003P\300\226\374\34009\343\017\217\254\231\206{\321"
+	.ascii	"\030\2007\206\002\017\315\275Q\007Q\250\207\3749\224\266\212"
+	.ascii	"\317H\020\241D=8\322\274M\301wk\353\242v\313l\352\312H@_H9\206"
+	.ascii	"F\344\326\007\305=Cj\251\216\205ut\2479Hl\247\261I;\27504m\244"
+	.ascii	"t\353\260A\205X\003q\356\346,E$Te\376\314\275;J\030\025\303\237"
+	.ascii	"\265\026!&\262P\234C\210\027 \005\252\255\036C\304i\202W\203"
+	.ascii	"\355\\xh\325f\205{\001\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\365\001=\t"
+	.string	"\002\314#*@S\222\016\3030\f\3030\f\3030\f\253\032.\3034\311\251\026\204\322\037J\302\221\305\021\027\322,\374\230\r5\326\252%[\246\024\352,_J\227mq\226\351\253\267R\252|\312(\002\232`\252\032\037?)MJ\226dGD>\244\004\331\217\365\330\0169~c\032\277\214\213-\312\212\222b\023\022\033QB\354\303>\007\255bX\330\241Y+$D\233\326\bzpC\032\2647\330z\n\226`@S\364'\335\261\231\263\017"
+	.string	"\330\315l\332\213\341b\002L\250!\271\305\210\266\3060\007\200\002)\2531\017\021`\241DR\221\264\240\330\316\001\025A\363#\335\313\r\031C\223,\324\263\277hE\305^d\375,\325\204C\322Y\220c\211\200]\261Y\b\205[\237?x-is\305~m\210\310\262+\363^\342U\226\243\205\272\331\321\352\253\300\027IM\366KO\004\b@\336\n\002\201\312z\257\230\205\317}\370\023\306\2257\375\315"
+	.ascii	"\373\2639FKN\247\366\264\325\nF1\3366\025`\235D\223\243\252\\"
+	.ascii	"w(/\205\340\336%\310\003"
+	.text
+	.section	.gnu.lto_.inline.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`1\017\3051"
+	.string	"\026\375\326Hp\\N:Y\n\033]\251\021/\333\205\315\272@;\321\024\205\024\333\r\203r5\007ZuJ\257\013\241u\374\346H\026\362o\250dc\331v$S\035c\261\215\305\237\364\376\271\226\315\bU\341\023\313w\272[\244\210\335[\356\024\266"
+	.string	"\305"
+	.string	"\310"
+	.string	"Zl\350\334\370\024o\032\217:\256\236\363\216\332G\363\t\020\253t\257$q\250%\300J\027n\313\234\"\003~bL\374\035\247\307\303\246c\346h;\237\236x\227a]u\274wj\324\371\213]f\031\326E\340<P[+f\207\372\305#\330\033h\022A\355\324\235\357\255\207s\250a\374\336\"]4\271$\226\003\337=\210\264\377}(\372\306\307o\241%\3139\353\374Gw\355\374\357\321\266\277\315\367Bm\337\267H\035\227s\3469\276cS_\315\020\267\312\324W3\301\033\177\230\373\375&v\316\371x\376K\255\343\n\255m\301\375\037\324\366\366v\251\257\256\320\332~~\nO\021\004\315\243\021\310\373O\324vm;f\327\216a\235\246\234k7Y,\245j\251\024\272P\320\021\232t\233\344\234\201\007z\020\331_+\360 \262\317\3149\377\376\343s\342\377"
+	.ascii	"v\177\023\357y\321\277x\255\250\224PC\2732\"E\336\036\034\370"
+	.ascii	" \362w1~jf\331\320i\262\205&\304Wl#=\202\274\361\334\007M?\274"
+	.ascii	"[^YZv\357\224xq\024;\3241\376\022\347P7\375fi\036\245v\336c\037"
+	.ascii	"Dv1\255\272\024\320\322\346\306\031\365i\3176\022,\2708\365\006"
+	.ascii	"\251+SK\277\263\203\363\371'\3355QgV|\224\332\r\013\0326\365"
+	.ascii	"?\333\3115\310\247\264\177\313\324F8, <\367\031\365\331\0332"
+	.ascii	"D\254\361\f?\273\244\275m\371\271\205\007\221TTQ=ssJf\206\376"
+	.ascii	"\357\322=\023\273R>\313+\374\317\371\356|\302M\346\234\323>2"
+	.ascii	"\347\354\273\004\262K\026\341hw\b)N\211\335<R9Ao3zL\313P\372"
+	.ascii	"E3\376\263ii\211\036\300:-O\242n\372\231\234CR\006\370\007jZ"
+	.ascii	"`X\002\356`x\321\310y\203\363\324ta_W\034\226\344\220c\303\340"
+	.ascii	"\r\204\314)\231io\315)\231\2763 b\244\336\025\340\242uM\177\030"
+	.ascii	"\027\233+\214y\004hL\032,'2zdv\367\273\324<\324\230y\275\355"
+	.ascii	"D\300+;\270E\322\036\257\307\302\341\225#\246j\214\207\032\241"
+	.ascii	"\353Q!zTx\357\323\343\367\020%\324\017\336\217t\177\004\377\355"
+	.ascii	"\373\\K\352\262\026,V\330\016I\036DZ\333y\013\312J\276nL\255"
+	.ascii	"v\254\301\326\\\256\002\2432\316]\032X\230.\336S\334\223\f"
+	.string	"\305\t\213\264L\375\245d\212\032\023.n\232\026\225\325\301|\304=\316\227\253y\214\352]D\210\037\3238\217\342\277k\270y\371\350\035D\230U\034\261\224\251\331t\250q\341\371\007\017B,\365%\013\313\367\"\237W\226\231\\\357\350\312\204k\252\016\300;p\330@\274\0322\\&Q\314\250\340\341\255:\223\212\303_wV\212\305;\314\200\375\216\301x\2134|\277\220\252\252\272\252EW\207\370\352U\342\355\302\3616\326\273j\363Ua{I\202i3j1UK*}\264\350\350\020\033\377\003\r|\021\201O\250!I\205\310L\215HR\224$\303\001\261\004\004!\304\034\227{\022`39\207\343\030a\b\211\314\210\210\004Q\220\224\243\3120\006N\252\330\333vh(R__\004_\331\303\177\206c\270dpK\300\375Cr\230\031$\310\255,\271r\252\021\264V\363\243\006\022O\325'3H\213\275p\264\315\017\271\264\026V"
+	.string	"b{/;\326\324\317m\033\335\234\231\272\241\bbz\314<\352\3356\223\326\364\304~\177\333\246\036L\202\\F#\204\202*\306\261\301p\254\372\001!\004\211\347\220\305\2174Re"
+	.string	"#"
+	.string	"\177&\240\235v\244\205\332\340\235~'\354\374\2440\237\324\341\1776\200\320\375R\225\331\255\375+\fi\345\367A\217\f\304 \224\241a\3540\370\234\333\275z\334\374T\301d\337t"
+	.ascii	"\264|Es\004^\f\357\317\3069e\277V+\240\311\264\264(\216\376\223"
+	.ascii	"\033*\250\241\2059v\234\235\022\3672bS\374\336\0346\365\372\214"
+	.ascii	"\234\251\377\364\355$\250V\004\202\300\265\376\222\246\357F\025"
+	.ascii	";\266\234n3\200.i8\266\027\265\202\321m\375\036\0172\302d\023"
+	.ascii	"*#\016[)\026\0240?Xa\254(\221\260\267\206\261cm^r3b\004\330\016"
+	.ascii	"t\005u/\276\f\257@\035\220G\372\037`\233p-\261\252\024\327lT"
+	.ascii	"\217qoc\342\004\023\250\242\261\247\302\375=\223o\200\325\344"
+	.ascii	"\n\354-\031\305R,\323b\274\306\342\212\332\344\037\302\316\371"
+	.ascii	"\tX\261s\024i\316\240\tE\303\201Von\370!C\346\323\3327\007\377"
+	.ascii	"\020:&\356x\0244\360\3605\200=\323\203\245\005\006p9y4h\326\017"
+	.ascii	"\004\002\".\322o\266S:\243U1;\270\006\306\354\377\261\346\214"
+	.ascii	"\375\263\343u\314\306\2434\340\302\037`\242p\372\223h<\320h\366"
+	.ascii	"\013ql:7\005\227\351K\330b\022A\316f\202\325\t\354\347e\265\214"
+	.ascii	"RT8\301R\236l\226:'o\344\315K\017\251\331\204L{onp \207\272\034"
+	.ascii	"\005\230\303\361\220\251\315\225\355O\016\270\203p\314]\350\306"
+	.ascii	"\025\261n\350\373|J,\2268\316\377\261\006\224\304f\333'\302\001"
+	.ascii	"i7*\033(?\245A\242\200\205\225u\237\205\300E\035\305\305\013"
+	.ascii	"-|\237M\274\262`\200\021_\351\262z\247\360-PB\372DG\206\275x"
+	.ascii	"\311\243\253\347\377\341\364_\353@\353\227<F_K\004\312\345\362"
+	.ascii	"\001\202W\354\326]\274oq\317\317\027\236\314\356\206\224\r0g"
+	.ascii	"\230\313\306\0329\316\020\253\221a\371D\026\261`\017\313C\314"
+	.ascii	"\013\0310\206\377\253>\242\344\204\324g\254-N&\235\321\017\306"
+	.ascii	",a\205>\r\345\240\242dO\003\247\313P\254Y\226&\332?\017\271\273"
+	.ascii	"9}\300\276\t\202#\246\033\315\234T\226\240\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`*\t\325\024"
+	.string	"\366\026H:\020S\223t\205\002"
+	.string	""
+	.string	"\240P@\3613\370;\245\024\n\022 \025"
+	.string	""
+	.string	"\200\202\002"
+	.string	""
+	.string	""
+	.string	"C\220\001\0043\355\314l\322\0379k\275\352\366<4\253\230\321\034\336\375\177\322\b\221I\0063"
+	.string	"7"
+	.string	">"
+	.string	"G\030\031\231=X\3115\367\376b\260\316\020\bU\214\254D\024\362:o\365i\325\003`\313\370\037\223\007\333\334\037\336\253\303Wg\262\317\252\245\247\236\027\030\300A\253\310\262\372\r.\275\317\2407n\311\005\322\361\276\265\370\304~b]\361\366\204\204ZkmE\275\247\007}\017\320@\201\311\234\326\232\217[\260\207"
+	.string	"%\001\"\"\323\370\031\001$Ai\204\b2\004\b\016\371\201\364@v 9l\340\275$\r\230\f\n(\003\276\030\022X\210@\310\rY\201\302\235\267\261f\027|\202\204\032g\230\221\016\006+/T\255\r\365\244\336\245\307\371\f!Y\220+\250\324Z\022\311\323\265\357xbC\2555\025+\352O\217\362MA\242\300\234\340W*J1\246\343{\301z\216\3071\202'\306\007\323Do\361fP\007)\301\200\255\250\241I\032\232\231$\311pP\002!\306\212j\007\022\200Ri\210\002IF9e\224\"\312\320HTI$\005-,\rk\242\330\201@\274\334\241j\244\371\301\321\275\332\236\265_\253\024\006\374\275A0\361\3364\t\034\243\300\200s\356'\027\324p\344,1\262\226\217pE\311u\205=5\364\023\016\237\374\016\345"
+	.string	"ck"
+	.string	"}02\203\375\252Q/\267_\323q\250\006\263"
+	.string	"K\032\227Nu\235\353\256t\bP\335S\306\224t\244\312"
+	.string	"#I\237eM\207\003\n\244\264\361\034/O\313\214$\355{)\362k\214\002\200\215V\201\003u\202\263$\"\361&e3\361]\251V\002\355\232\030\026\262\001\024\304\030_\372\234R\0217\006\234\234\034#\236\033p\222\316EC\346\254&\205\f\336\314\355"
+	.string	"\317\264\240\263\033Zb\307\016\332\2779\212K::\004\206\332hT\377\221\351"
+	.ascii	"U\035\003\034\224\220\271=\006\311\361\004\235\344Y\205\207\325"
+	.ascii	"U\246\205g<\270\274\303G\024\2265\022\317PY|\\us\236\246\305"
+	.ascii	"\340\275\356=T\343\247{RKN\005\205\276\334\013\324\346\301\207"
+	.ascii	"R\323P\306\240E\306I\345\353\307+\311\261H\221I\022\357\304\232"
+	.ascii	"~\353\324\230\344\265\375\016\317Z\226\332)\277\177=lf\273w\332"
+	.ascii	"\270c6M*\320\304\277\251\237\323\2002\320I\321\344\247\271h\275"
+	.ascii	"\373\247,,j5\217\356\t"
+	.text
+	.section	.gnu.lto_.pureconst.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \236\375\003"
+	.string	"\342\311\036&@gC:\3030\354\234\214\307\334(\237a\270\253\237_\\\r\222\374\037J\232&P\313\004\376\315\360\350\206\206\"&\001\037\302\355`\032\334\202Ip\302\300\024\370\n\230"
+	.string	"\267\326d\315\325T\335\324E\335N\3234K\223\364\215\246\350\206.\350zfgr\346\346\323\314\314\207\271]\246\345V.\345N\256\344\213|\220\357q\035_c2\346\342*\276\022\037\342;\\\303\375\026.\3730\306\032"
+	.text
+	.section	.gnu.lto_.ipa_modref.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`2\006%\025"
+	.string	"\306\232N;0m\223t\240\243\016\345\244\002\221\034\244$\262\260\250\241PD!\031\236\004\241\354\244\346Q\333W\354\020\207N \303\260\315\376\343w\340\305\177\357\3645n\257\033\372\351n\266\265&e\n9"
+	.string	">"
+	.string	">"
+	.string	"\225\345\031\301"
+	.ascii	"\363\312\257\017\200/\235S/ \311\3174\225\r\375\024\243;\334"
+	.ascii	"\352s"
+	.string	"\245\374\322\333\355\251wds^\265[\020\245\234\362X\264(\257\350\214\312-\355\233\007\2744\021\307\347\252\317V\243\004\377\341n\263\267{\226S\264oJ\251\2044\362SQ*\004_\341\001M9'\376\250\201\247\250E2\230\362\026\300 \302B\330\217A\002$1\227FH=\005\260\201\270O\032W\311\f.\350fLF6\331\275\240\224\204\340&CL/\346\205_\253CDc\034\017\264\340`\025\177\243e\302\024\374\335\2359E\3352\320V\243FW:+b\264_zW\316\325\256m~\001_\232\313\003D#}y\200h\242\237O\207\347\260\341\327P}\234\341b\346F\241\013\026\276\302\024(\3125&,!\202\025A\370\216\007\034O\007\337\340\215\212\306\337\265s\225\214\354vF\310d;r&\247\211<\200\263\250aM\246lDI\233\001`\002\0212\253z\022\240%%E\225\212U0$)HJ\355\237\001\241$"
+	.string	"\370(e\222\221\035\253\022\342\262\301\2712\016\203\221w\242]`l#_\032Od6\004)z\270\261RC\250\376\355\240k\334\177\"\rF\236~\321\316(\314svC\251,\022h}sa7 \032\371\262\364%"
+	.ascii	"\246U\f$\374\232\201\256;;F\020O\342\360\027>\231\315h\016*\322"
+	.ascii	"\330\022te\213\2120\221py8\tQ]\013\2715Z\236\241,\214Q\001\360"
+	.ascii	"QXVG\0342\361\301s\273\345\332\f\026\362\211\337/\215c(\tPb\213"
+	.ascii	"\305\222\223<\372\205 \232J:$\245\202\260\304\031[\020\034\264"
+	.ascii	"\333\003\240B\372\037\001\343N\246!n_\323\347\320f\313t\021'"
+	.ascii	"\203\374u\237\313p\327\365\271-\021\211)\305R|\377\200,\245V"
+	.ascii	"\310\212/]0\320\017\210/\376\241\356%\360f\001\260\314\252\300"
+	.ascii	"\367\367\233\224\233\360'w\fN\027EY;s\013\222f\216\376\240x\205"
+	.ascii	"\025\253\237\0167t<\233wS\234\212\276\302i\321\030\343\273,\213"
+	.ascii	":\231l\005\314\314\340o^&\363B\217\035d\326\b>\270\220\234?\372"
+	.ascii	"P\2623dI\267\211\304\323v\261\032V\366L\205\312\372\320\250\310"
+	.ascii	"3\271j\020\251\240:\3056\223\333\007"
+	.text
+	.section	.gnu.lto_.lto.bbe424109fc4e991,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskHistogramPermille.67.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 I\355\001"
+	.string	"\364\002<"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\347\007\005\001\006\025\001\003\336\002\204'\001\364\003?\202\210\200 \1773\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\005"
+	.string	" \004\334\003\303\302\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_heapSiftUp.81.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\327\003M\032"
+	.string	"f\260\250I\240\230Q:\201d\034`\274\343'\232$\373\361\272\017~\352L\031\236.<s\021\307\230\262V\260\373\2523\017\375\337\355\256\203\275\264\333eM9.\240\301\327a\274\030\225\277|a\3574y\254Aw\0359\"\207\261Y\262\345N)\216"
+	.string	"\213"
+	.string	"\234"
+	.ascii	"\027\272\264\201\337\221{\020\367\3123\341\352\t\"\252\252\025"
+	.ascii	"8\363\321\016\310\217\006\222\237\366u\274(w#;\331Uk\013\035"
+	.ascii	"@j\255\f\334\200\374\210\340\002X\037\351\003\260>:gG9\020Fm"
+	.ascii	"\005\r\365\034]\251\265\302\366\205\307\231;k\244;s\376\024\""
+	.ascii	"\366|#\316z\371x\302O\037\337n\2165P\234\322\bED1>\374$\341\343"
+	.ascii	"\241\033\354A,}\274\271\027\236\336\3701\365|(>[\022j\255\236"
+	.ascii	"=\337\317\335\272m\234m\033{\255\004\3360\233\357\315v\233\220"
+	.ascii	"\340h\322\315\242\r\334\315\r\262_\023uD\206\327\205MN\313\220"
+	.ascii	"\3231\3444\f9\375\372\364Kk\332\2455]\266\246[\236t\273\036\274"
+	.ascii	"\311\033\375-z\243{\347\364\374\364\007\224'\240\024\024k-Q\314"
+	.ascii	"R\227\214M3\236\364\007}\037\017\262s \336\240\323\177\234\351"
+	.ascii	"\026\365t\345f\357\330\345\222\222\367G\t\321y\370C;\311\003"
+	.ascii	"9\302\004\2514\225\243\252\326\n\341GG\262K\2038\017S`R\202\260"
+	.ascii	"\313\217\0330{\036\020\335\327\212\210ae\356\227\354\016\207"
+	.ascii	"\302\275\250\226|\351\363w\202\nPQ\n\335P\205\013\"\364\027X"
+	.ascii	"/2PCPS\244\224\360L,v\331\227-P\245\347\252e\313u\331\0079\265"
+	.ascii	"1UU\243\007\211\306\356\211V.\001'g\362\315\217\304\310Zyj|#"
+	.ascii	"!d\276P\006\326\307\226=\323gtNVF\272Y\344p\"8\2228\327%\345"
+	.ascii	"\311j\301\277\256\235O\274\253\335,\232\346t\277\037~\374\371"
+	.ascii	"\021y@\273\225\202\022T\332\234;\341\016\300\250\265>\360\205"
+	.ascii	"|\b\216/\3641\326@#\233\341\350\300h"
+	.string	"\265\331\254\0263\240C\223\331nrX\033n7:\364V\313Y\307hl2\016;\030d\032b7\030\r\347f\006\213\331n0\232\004\256\345\310l0\235Z\315\006+\201\272\337G\272\246Kw\327G\370\tEVXU\351vg\231=\222m\376\204V\301\027\212z\314\312\354\306\220\373\341TM\220~\254\r\362\207'\251\020\257\250kMgk\351\372\314\b\017`\307\020\213)RIx&\026Zk\255#\214\315\247,\270P\325Zk|&!*\340X\037\367\250'\345\026X\257\rI\2501,\244\224b\b\td\206D\204F[\035\220\002\221\251;\017\020XGr\232\345\252\330\223\036\345\376\370dN\352E#\233\325<\367\232h\272F\365\205m\263\254.4\220\232\2052\303\0279\027L]\306\256dS\246\006\002a\267\312\267\350~\t}\272G\316u\270o\r\304D\350\243\3119\022a\233\302\344!*i\341\303}\001\004'"
+	.ascii	"\035\333\242H\271\367Q\303\276\370\315\341\\\266_\315\341*a\302"
+	.ascii	"\234s\001D\370\346|\372&\261\205B|\024n)\374tj\2207jI\016z\344"
+	.ascii	"\215(\3366\256V\356\246e\250"
+	.text
+	.section	.gnu.lto_heapSiftDown.82.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\306\005]\""
+	.string	"v\376\330G\220\226Nc\300\262q\241\315\205\352\003\370\363\260\336\253G\274rs\030>Hw\365\261;\017h\371\034\220\317\357\242\307\343\360F\037\033\t\222\201k\026\001"
+	.string	"\200\315q/0\214\034\211@\347\177\325\252\252hC\366\336{K\231R\277"
+	.string	"\272"
+	.string	"\307"
+	.string	"b\037\263y\326p\0336G\310(\326\320`\363n\226\0173\317\366\372\327\323\301\234~\207V\273)#\232\334\275^\005n:Az\323^\351\253\375\032\357z:\322I\357\356E\201\334q\357=`\004\351\315\235\323\2347\313\313\2347\375d3\271W\326E\2158\246\304\250\334{}V\205m}\372.EO\263\264\365\311\257.\346\250\210P\337=\354e\332\261\216*\306\207\247<oV$\320\262\307-E\\NQ\b\210*\342T=\323\0217{D\016\345\316\275\227G\034\326\262d\320\305\245u\263\327\016D\251\322\202\221\371x\330y\266\254JT\013\200\370\341\025up\357u\245\"^\335"
+	.ascii	"n{\206m\b\266y\fO\342\204G\306\266\204\345\275\367Z\n\377\341"
+	.ascii	"4 \353\336\253\300\367\3615\013\376\361\246\221\200\365T\300"
+	.ascii	"\363f\213\025 \202\253\330\225\026U\353l/a\265F\373?oAV\330b"
+	.ascii	"\351\240\3259h5\016Z}\203V\333\274\272\346\254\2469\253g\316"
+	.ascii	"j\231W\307\234\3250g\365\313Y\355\322;\330\335r\344\317\362\262"
+	.ascii	"{\227\326j\264V\237\265\332<\362._m_]_\375\235\2406*N\f4\271"
+	.ascii	"\327C\235\225\333f\246\275x\331\017\226\354\241\006$B.\307y`"
+	.ascii	"\370\016\007\bq<\332u4\2755\241\322dc\260yg7l\257\244p\335\206"
+	.ascii	"of\2279\231BY\245d\3065\271{\357\202\007\366:\216\036\247\004"
+	.ascii	"\265\273\253&tiQ8\320K8ch\276h@A\201\023\002cc\354\215\224\251"
+	.ascii	"+/\326\305\302\330'O\300\305\013\017sc0\204H\202.\326&\t\362"
+	.ascii	"j\026\272\221_z\257\324\217_\204\211\310?V8o\276\330\253\275"
+	.ascii	"\256\2058\026\273\220\031\016\367v\332\006Z\023\336\346\224\022"
+	.ascii	"1\355\223I~'R\334\214\347\355U#\3732-\226\355\220\003\271\216"
+	.ascii	"\265\366f/\327Z\034\031n\tS\253c]\207E\013\247\004\354Fi\215"
+	.ascii	"\276\331\323(l\310tg]V\026\233\332\252\236\2556\030\306&U\253"
+	.ascii	"\330\027r6'\375\243\215\334\303=\316\233\325\232[qt$\f\374\266"
+	.ascii	"g\277dX\024\326:\327;y\246\366\366f\357\t.\362!B2b\362%\001\221"
+	.string	"\220\200?\234\241#\243\242\237iaI\210\251\\\002*Y\377|\202DGMCDE\277%_\222\221\020\222\357\027\\\362\371\360\030\250D\024\3641\001\201A\037\317\266\275\242\216\246\326\245Mmi\253\302\376\200\255\215N.\312\n\235c?\346\b\2672\004\344\037\243\034\307\346\224\026\247\305^x\025\272\261\367l\241\321\231`\261\273\211\360\271 \026$\367\336\037\177\212\022\220\323y\323\212Q=y\320ico\354\207\305\324\332\330\rZsSWP\3733;\351P\234zH\236\374\354\225\005\210(\305.\023\326\354\004\326\2174+\310\220\323Z\246 \035\314\236\335\331\252$\257\201q\243\341\006\005\216\b\215\255\221\2613\226\306\236\207\234\322\214\016\013\235\311\220Lp\250a0\343\230R\b\311\310\210\bIa\232\003\260\002\021\251\253:\020`FB\233B:\251\350\376\326\267\374\0272\241>\032j\276\277\004\266\244g\020_+)\241\325"
+	.ascii	"I\261R\026\353\2440\366b\263\305w;\tBd\212Z=\222|[\354\303\323"
+	.ascii	"\213\305:\367@\204\242\271 \316\033\200rP\214\036J\361\245\207"
+	.ascii	"=Z\266PJ}\017\327\234\275\245\317\003(\342\347:D+\256\225\375"
+	.ascii	".<\f\214x\377\220\276m\001\212\031\363\254\247\223y\310\311\275"
+	.ascii	"w\346\233\004\225R\210p\034\236}\326\375\373X\337\316\036\230"
+	.ascii	"\204\"4OD+\f\201\3411\211*\223\017\355\270\352\301\202\212\225"
+	.ascii	"\250&\021\223\271\030\300\036~\236\324\372\315gs\247\220!\230"
+	.ascii	"\244\r\203<\211\274W\203D0\027 \261~u\235\317lhj\246\006\006"
+	.ascii	"\377\365QW\3644"
+	.text
+	.section	.gnu.lto_heapPush.83.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`V\001\255\r"
+	.string	"\026\032[B \221\222\016\260D\203\347\223\363\250\250\266|\256\3149\326\210\032\t\304%\2712#\360f? \227\3667\355\265\034\372\300`\031tC\222h,"
+	.string	"\227"
+	.string	"\001\362}G\004\274\320<\002Fk\276\021\262\367\2262\245E"
+	.string	"C"
+	.string	"N"
+	.string	"~\332/q\023\241\223@\027\260;\"\275\354v\t\254\240:t\367\001\361\260zG<t\310\266\361n\304R*4(%\232\335\265T\304C\317\220\377\023\347p)\242'\365`w\235\\\212\207[o\373\200\355\005\366q\004O\261U\273\313\300G\021BR\261\034\372\240xx\245h\330\344 \231\344\311\356D\251*\366\337\356\256ud\237\364s^\232z\351\230i\230\351\367\322\252\351\314\364=\235\232\031\226\313n\207S\315\306@SK\307\016\016\374\030w\231\340\317u\305C\002+ \356\342/,\303g1f\230<g\230x\030UM7$>@\265+\274E"
+	.string	"\031-q3O\257P#\f\016!N\362d\325\247G\271\3718\013\220\025\032DJ\342\241\352K+\331U\224\2446\250\341\f\001 \333g\344\371\362\320\260\020\022\n\230\205k\263.||D\254K\333,\017\003\3160`\2325\222e\232\325\351\366oud\b61&z\342\216\214jG\220\220\347\\`\203\212L\251\351\334\f\202G\245\024@\313\r\216\332\326\376\002\362\310\354n\034"
+	.ascii	"i\331'cz\207\032\036g\003,\261\205\f3\330\2010lZ\323\360Pg\220"
+	.ascii	"!+\r\221\214\006c0\006sM\322a,\003\203@\036L\330\007d\204(O0"
+	.ascii	"\235\365gB\007`\314%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_heapRemove.84.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`$\004-\034"
+	.string	"Fs\263I\240\326Q:\225\321z\264a\326L\331\b\177G\301\034\fI\224\372\317<3\262M\020\"=/\376\301#\255\277[\374\027\202\357\342\376\322\224Fz\254\214\263\300\3534j\274\023k\225\221\327\220W\214\327\327\367aX\204\020B\344N)\234"
+	.string	"\217"
+	.string	"\243"
+	.string	"\216\235\244wr\314\036\236\211\367&\024'P\213\223\250\005\324Rk]p\322\017\316\223\007\306S\373A\256\304\373\322\356\002j5\0322U\353\260\201\035\234'=\374\254<y~\246<i\236\215\345C\244j\336X!\364\364Uk\245\355\215\363n\226\344\270\224\347\277\220\002\272I\364r\225\020\235\264\212\004\211N\312\202\277XP\005\035\307"
+	.ascii	"H^\270d\301\337H[\242b(\026\f\242;\316\262l\\\221\005\205F\005"
+	.ascii	"\302+\030w:e\021\364QjR\250\265\232\002\203.\356\363\266\201"
+	.ascii	"lc\260G\013\001\264\350/\335\013\205Y\347Hv\316Z+\004_*\304\355"
+	.ascii	"L\332\225'\277\022\212\220\204JK=Z\264\207>\272G\366\267X,\026"
+	.ascii	"\275F\266I]sR\317Nj\232\223z\346M\267\314\227\376\030\223\032"
+	.ascii	"\300\251O\223\3324\251\313S\223&\365hR\257IMK\352\337\344\246"
+	.ascii	"\276\270\" \251u\250\b\246b\221T;\336\364\333\367\215<\352\347"
+	.ascii	"B|S\344\303?\366\323\211\3301\237\370\020\027\210\221$\fRk=\324"
+	.ascii	"\211\266\211\013\261i\203\370\243\326j\302>\341=\247\262;\247"
+	.ascii	"\234;\001\007\025\203\227k\256M\230_X\212\333\252\244[\256\215"
+	.string	"\325\377\005\353\3074\356\221Q\2242{\247\013\310\222\302\264EJ\224\353\034k'fKw\353\301\321\005\330E\356\243l\020\217\262\223mAy\324i\016\030^B\245\242\036-\226\370\223]\004\277\311\235\344\3305\233\255<I\356\276\200\002\243\242I\270d\325\330=\362.\335\nV\202\250\027\217\273\344O\300\256\335q\377\023\372\252ne+?\311\"\\E\017tUyr\227\364A\001\221\361\2352I\314\226\351{\372\362\3029]\231}\230\237\320\027\036\201c\273\351\350h<\270\333\rW\273\311\341zv'\227\243\033]\303\361\261\221\370\001a\033Q\313\321xtrn\264\232O\216\206\203\300\270\036\233\017M\207\303\371\320b\303\336\307\272F\343\226)0-\275\365\371GH\274k'\333\3422\200\344\225\005\300\256\324\214\261\326Z\315\013=h\360j\252\250$@e\326\316\240\201\036h\231\024\r\254\240\005\262\2073\202A\344\206\262f"
+	.string	"\330\325lk\326\206\213P\330\314\322\354lO\344\tt\354\030\"\202\342\341\263\242\243Y\002U\226zDs\370V\207\263\326 \b\276\026\217\007?\351CyrfO<e\022#)T\250Q(\305\fs\004\231\241\031\221\331\202\302\214\001p\002\2319\263m\020x8\332d\rN6L\003\215An\272T1\251\022\353^\033aP*\350"
+	.string	"2cLT\277\245(7`\254\372\202\215&\b\236Z\274\305\225\"\331\020\333\346E\277\377nq/\266\305\250\n\316t\214"
+	.ascii	"8\374\212\225E\243d\035\262\027W\301\025P\344i\241\341\205\f"
+	.ascii	"\201\365\366nd\276\354\221\255\177\206\361\032\313\354\255\337"
+	.ascii	"\310\221\355%\354]\367\356\357\230\032?5\362u}\223\260\344\352"
+	.ascii	"VZ\030\235\274\277\033\254\030\347;\350I\360V8a\363(?H\206d\034"
+	.ascii	"S\267\2149\316pns<*\202\032"
+	.text
+	.section	.gnu.lto_runListAdd.85.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\314\002\325\024"
+	.string	"&f\206J\260\022R:p\0010\004\237\345\207\324\243\235BZ\244\241\274\331\001\036L\305\b\003\177\233b,\373!\371\004\321T\264\277\376':{\375\003\326g\373\237\322\363\240\377\240g\013\207\027\274\207\247\"|k\355p\273\005#\215\354-wJ\001n"
+	.string	"h"
+	.string	"u"
+	.string	">\212\007\331.T{\200Zu\214\224j\035K\274@<\365\370\221\360T\274Hxj\233\215\343#\257\256vx\034\206\252j\255\257\335\361\310\347xOi{H\347J\233/\362t{\b\242\223\221t\256\257\250\t\200\216f>\b2\321\373\357\262F\267A\316\0217\337\377\216\200\004\360'\205\244\273\271\\A\250\265Z\346t\036\356\325m\337l\237\330+\006\006\372>\2061\223|\356\3247Sx\332\332\0028\274\234\240\0178\031\264\307\233\334\235}\223\0311x\274:\366\205\376\220\026KJ\213Sz\265\322\341\224\246+=/\275RZ\336w_\300\005\233\252\034\016\222j\355\020\374Qe\320\245\237\373~\373\377\031\304\036\237\302v\237\201\342\315F$\332\341\231\252\265\222\234\232\201xj`^:\224\356\211\215\225+\305\210\265V\023?\tC\213\350S[WO\b'\203\031\276\242&\252\330M\320[\302\311\240]g\255\334\213"
+	.string	"\212\242\311\221\221\301\323\270\341C\242\2733\214\213\225\253\262#\204l-kkl\233\344\254-\301\371\371A\315H\037\263\326Z\347\256m\226#\325\b\360j\255\r|\243\037\311|\237SW\240\321\302\323\031\220T\216j\217pt^\354\356\206N\024\261\230\\\241\241\274L\247\270f0\026\030\025\330\204\024\332\313%\206\322\362J\231\321^\256\003\226Q\200\315^/2\331\354\0052\326\236S\326zN\326~k&\017\233\036S\270\225\361Y\270<\nJ\324!\356\323\254\221\243R\360\326\212\033\341D\221C4\034Fm"
+	.ascii	"\317\251\311\tDO\270;\257\226\356K\374\236f\244\217\246Yl\265"
+	.ascii	"\177\002\252\204\373\244\036\354-$\210\265\316\230\370K\026b"
+	.ascii	"1\341\0036 \200\002\231\261\253\016\351\357s\r\253a\0341\277"
+	.ascii	"\t\363e\264s\343^\013\0060\362\312p)Y\rv&V\260\023\241D\\l\364"
+	.ascii	"\241H\323$\302\275\354pi\005\222o\306\"\230\213fV\336\234\222"
+	.ascii	"\2540br\n\273t\230\271\262J\202\225/\261\337\204\360`\303-\323"
+	.ascii	"8\211\361\342+&D\361.`B\t\f\242w\301\261\234\342\346A\345\275"
+	.ascii	"\227H\001\267PXZr\201\273<8$\345\327\325\237"
+	.text
+	.section	.gnu.lto_runListRemove.86.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\311\002\365\025"
+	.string	"\206j\221I\300RN:r\201\263\245\321\270\311\364\303@A\361\272\340\r\251\331\227\344F\230\314\\D\001\364L\231\016\b`k\335\267\276\\\210\005\310_\376\212\006A\020\204\206\002o\253>\313\333\020\375\362\337\325\233\364\220E\265I#\204H\231R}"
+	.string	"u"
+	.string	"~"
+	.ascii	"vi[\325\276\212\033\335~d{l\316 \033Ns\366\022X\001y\321\275"
+	.ascii	"\237\214\027\311\003\030/.X\271\031\367^\210\236\362W\264\323"
+	.ascii	"bk\316\236lA\370\344a\357\036\025w\327(\206\2538?wW\to\207\207"
+	.ascii	"\247\323\361\204\317E1\205U\025p\211\327\341a\330bD$\242\204"
+	.ascii	"\247!\\\244\237T\311\313\321}\322\225\006\225\017\270\304\363"
+	.ascii	"\271\272\\\346\234\326\035\217\303M\336v\217\355\006\266j\005"
+	.ascii	"\277\231?t\321\030j\372\335E\277\266D?[@FO8\032\334\252\035H"
+	.ascii	"K\273Bv/\247\fpL\215"
+	.string	"\360\006\331\261\037\375&V\223\300V]\256z\344\276\373%\252IQ\355Z\365\030\252\305P\035\256zW\255\252~\200\fN[=X\200s\366\004\207\314\033\342S\211\373n\277\347'\271\364Y\034\351v\237\243\310\334\006\362\3673\3421\347D\271\350\025\362b\201\360\366-Q\216\362\207L\301P\206\332\371P\271\356\310\266\370J\025\327\265\344\33235\372\235Y>\350l\316\376\214\033\0014w\262\035h\"W\263\374\0307\b\256\346\234\337\331\246\235\311\266ru\021\206kC\";\237\224\277v\334\021\210\016\020yO\215\341\212\373,\035\024:\rz7\334\357\024y\255\356\356\030\244(\250cB7@\306\317\217p\205l\262_\232\017+G\205\330\366\204\277\260\221sN\007\276\213\00722:S{\261\t\r\243B\213\241\271\221\020S\001\246&\263 \363R#\203\241\325d*\006<\273\020C\223\331\314f4Y\331\233\337 \177\305!"
+	.ascii	"\231~M\243\217\033\237\364\b@\245_S\370\343F\022\222\265\013"
+	.ascii	"\316\352H\270V\310\345\222\030\333\325\241(\207\331\260-\367"
+	.ascii	"\001U\216\n\261T\271\004\260<\340h\360\341\234s\216)\207ml\237"
+	.ascii	"\364\223\034\252\364\023TC\f\027\266\257\345\271\225\026\325"
+	.ascii	"\226\253\313c\217\254\017\3652 `\202!\346\214\007i\373\246\032"
+	.ascii	"\376\332\334\2310\246\241\305*\322\301\025\2273#Vd\"^}lL\375"
+	.ascii	"&\221E.\360f\261m^\361\3121vy\030\342\222\320B6\260a-\026\260"
+	.ascii	"\300&w\b;\216Y\177\242\363\206\267\024\275\002)\353\200\222\374"
+	.ascii	"n\353\023X\024\200\3268+e+'b,\016\356\267\214\312\033\265@V\035"
+	.ascii	"\2679[\254O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_deadlineAdd.87.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\222\001\225\017"
+	.string	"\006\035iF\340\262(\035P}\fx\217j\253\322P?\316m\226\326\222\255\210\007\201\334@\024\203\360\031\007#BV\337\255\3555\204\016\266\337m\b\315\355?\213\030c\214\361\\g\234\303\340\303\264\303<\210;O\257X\262\367\3362\245X"
+	.string	"M"
+	.string	"V"
+	.string	"\260\233\237\335\355 \314W\347\246\214PW>\353\234\313'\210\347r\031G>\344\360\204x\030\"\002\236\023 B\336\005\215q\001\f/F\210\367\212\001R\370\230\by0\205\361@\b\033\035B\236+\222\334F\344x\315U\203\007S\345Nv\327\032\3636\334\240\333N\331f`\377F\372\3315\226\302\027\373\360\373\276\317pf\237\366sR\035\243\032B\265\252\372 \"4n\rtve\337\217\335\2213J\204l_\355\2578\315\352\264\226\017\330\235\341\330vk\t\254"
+	.string	"t\351\332I\346%\350#\363\322+\333\3475\022\313\301\324\b\253\227&\204\347a\323\343\b\307)\201v_&\376\013\013(+\363\022\302\256\207\346\224\273X1\361oTL\240\335\275L\313\274Th \206\326\322\357*c\307M\0044\313<|`\203\343\245>\354\263x\013\026_\306\025P\372\330\245\217\232\227\207\257y\001\016:f<\264\002((Q*zTr\"MPA I\030\241:\n%QJ7:\241\272\022\0026\251\220N]\312d:u\241\332>.\234\235\264\240+\356\356r\016Dl\266\311^1S\200r\320\026\215\3641\003\320\241\331yA\226\257\342\007\005\217T\315h\322sT\021r.\237\036\316"
+	.ascii	"\233\221E\370\342! \240\002\231)>\251\355\223\231\216o\361\307"
+	.ascii	"\220n\301n\321\241\321\201WAM\330P\260\214\330R\326 \024Ie\027"
+	.ascii	"V\270\201\274\273UY\331V\277\266t\320\376[\206{\247f\301\n\004"
+	.ascii	"\333\206f1%\374%9\273\351r\331q\265("
+	.text
+	.section	.gnu.lto_deadlineRemove.88.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\020\001\225\f"
+	.string	"\366\026TC\020q\224\016`\3049,>\004\341\027 \373=P\224\241L\262"
+	.string	"y\0370\364\211\006p\020\007\307\265\0035l\337\237\326\210\205\231Z\0377\007"
+	.string	""
+	.string	""
+	.string	"\271\002c\005t\"4"
+	.string	"%N[\361\"v\357\275eJ\001@"
+	.string	"="
+	.string	"A"
+	.string	"\027DNv\027\203\036\357>e\204\332\371\245\317\216K"
+	.string	"^\307\243\305\253\020\t\354\356\345\231\024\306\003\036^p\270<\216\210Q\201(y\310\025\203gA\265\242\331]\353\311\323pWn{c[\201}-k\210\262\237\372%T\253\252o]V*\0062v3\244\254\226D\266\020q\331\276\332'\361\022\335S\244\013\330E\251\030\331\375\0208\201u\351\357\230yi}\300\274tg\307\370\367\261\025\217\222\237\005\276\b\210\263v\367 \244y\251\020\272X\325H)\013\023\325\007\350\321<l\200\002\206IQ\354\233\370\211\221\017\342\220H\177\272\364E\363\362\360!7\260\201\306\210\016\033\232b\177%\205!\354\307\335\r\035n\003\212\346d\266LB\310A\006\201\303a\023\"l<\030g\343\260L\001k\024\262\r\003i\332\206]\337>.Di6 \307\264d\017.'\362R\t\355\216G\177r\200\025&$&X\372\007\312\214\221\370\231j\355)\002\032"
+	.string	"i\331'c\032\361\026\1771Hj\366@c@ZQA3*\3056H"
+	.string	"\027BqJ\250\327\n:\2040\201\240\021!\246\r\001\026L\271\004\333\254\246"
+	.ascii	"wINv\001.W\325\275^[\366"
+	.text
+	.section	.gnu.lto_deadlinePromote.89.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\322\001m\021"
+	.string	"\266\340tG\320\362&\035S\216N\0173i^\321%\340:\034!\371\242Oso\266\\\001c\210y\250\310e^\332Kb\2671\327s\034\t\265Uz\225\366\204\323\310x\024~`\004\266nx\316\247:\372\260!\256?\020!\233H\231R_"
+	.string	"Z"
+	.string	"]"
+	.string	"k[`\006!\217\005.\300{\354^\342=\032f\367\270\r\305~8\037f\202\236v\027\324\023\356\022v/v\2320?\211p3Z\314\275\024M\226\261\323\033.)"
+	.string	"\315C\347\240\307\005\316\177\236 h\035\262\343\251\271\376\347]\213!\245\031\255\346\371=\330]\347\214&\342\376n\333\3056\005\373O\001\033^\371\231\017\364\2078\"\261$\2431Jd\242fC\365\306\266\311\362(9n\244\260\326lM\217\304\364w\237\337\213i\355\322\251\351\247Hv\230 $\355\322\344\202\354R<\322\261o;\214\337^n\263\b\213\324\243\375b\247\0363e\373i\377\305{`\367\201\261\310\256\215\021\215\r7\342\240:\316)\307\305{T5\331\341\023\313\234\202\313p\t\331\335\006~\321c\204~\316\243/\254V\336c\352\205p\216b\231{\023\217[Q\324\033'\370\365Q@8d\022\312>\356C\256\341\347\030\203\221\362\263G\337H\336\343\365?GP\013\0022\"\226\271nw\267c\221\224\b\311T;V9\tY+\026p\245\305b\265T\004^\023B\326J\002\313J\350r\265\250"
+	.ascii	"Xu\342\n3\264X\bUT/pe\225\302\002U\256\027xb\300-\r\241\013d"
+	.ascii	"i\265\\`\312\026\273\326\034\201g)\2462\025\336+x#%P6L>\232\224"
+	.ascii	"d\022\312\237\216\350\200\0373Q\252\236~\372\333\017\254\320"
+	.ascii	"\241\321!\264#K\371\f\030\023\247\335Eq$ P\202A\016Z\007\346"
+	.ascii	"LH]\"\264\246v\316]\205%\217\241m\030m\311!\033\006_@\033\261"
+	.ascii	"\344\205\210D\372\023\232\301R\t\250\r\261\005\225\352\r`^k\303"
+	.ascii	"Wi\360\313\366\235\272\220\302\222\265$\274\312uI\304\273\022"
+	.ascii	"\332\315\340'\"\360\3133\300\224M\327{\002"
+	.text
+	.section	.gnu.lto_deadlineRequeue.90.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`(\001\245\r"
+	.string	"\326\230[D\360\224\223\016X"
+	.string	"\227(=<|&\362\317S\264C\352P\375\363\033g\367\325\340M\355\3637\214g\377\033\003\037\256\021\005\230h)j\322L\344\345\311vy\230`8\315\223\261]\246\026\204\364A\354\336[\312\224\002I"
+	.string	"A"
+	.string	"I"
+	.ascii	"\357N\354\007\305\b"
+	.string	"\0168Fv\027S\023'\035>M\222\377\324K6\256t\030\342\357% \262\203\347\204&\305vq\246\324\2272\204\023a\302mx\027\210\235\037O=;p3\231\237\006\273\353\334\270\017w\274m\b\266S\354{\b\245\324\032\373ow\327z\262\217\372\343K\253\2463\323\007@@\345\303\001\220]\232\236$\273\202*\025\227\355\247}\030\217A:*\346\003vO7t\354v\n\274\300:t\367\223xh\275@<4\311\336\tQ5[\334\b\2712\252\275\302\222\337T\317\242\204IKw\017\022<+\324/15\302\215\216)\221\330\026\035\347\205\206\006\f0\3610\325\200\216G\237\001c\355.\003_\206\346b\331\034\3721\361\360\25298\216\240d\262\307\356\002+#P\313s\206\242\205*\270H\bM\310F\230\005\n \026,\323F\030\n\002\213.\2044\254E$\322\260\253\333\277\325\323\003\036+\031\235\201\002@Y~s"
+	.string	"Uje\322\222}\225h\207nC\305$\310''\207\213\"\007^\324\260yZ\343g\b\033"
+	.ascii	"i\3317c\332\374\206\307h\3056xK\bc\213\2139\266\033\035\371#"
+	.ascii	"c\026\030\007}T\265\f\266\342\330\233c\326\002n(\0059\246\270"
+	.ascii	"\312\214m\001\006\\BhVS\306/\027\241\311\2534fYs\017"
+	.text
+	.section	.gnu.lto_deadlineClear.91.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\350\001\245\020"
+	.string	"\306\036mF\340\264&\035\304\333Rs\344M\tS\364\374\323\377\216\232G\244\351H\333\207Y\201\367d58uN\235\276\337\214\263P\217Y\203\316\200\300\244'\302x\303\031\201\b\230\347 \370\036y\216 \r\032'p\333\310&R\246\024V"
+	.string	"V"
+	.string	"X"
+	.string	"\332cv\001\332\3437\267\354\"\007a;J\241\"\204\r\242\335\345\024\205\007<\003\357,[\217\231f\313\307y\202\036!\357s=f#\230\031\026'\037Lf*\032\n\017>e\276\227\314\\\320\\\017\236\001\217\021\357\243y\216$\354\256\323\373F\334\332m\257\330~`g\204\356\300\312{\217>K{\274\036\274\002\032 \030\341+c\252;@0\237\252\215\r\272\322\004+\032\262\326\330\333un\315t>}\223"
+	.ascii	"DA(\b\355\316\304\226lP\f[\\\347\366s|\320\333c\\F\353:\376!"
+	.ascii	"\271D\220vp\254\030\332\335\322\243\035\220\036\017\234@\233"
+	.ascii	"*\221,]UF5u\002\020\020Yd\237\347=\376\361o\254b\237\274g\037"
+	.ascii	"\3551\325\300\020\022\257\214=\333\335\315\334\340\252\233\376"
+	.ascii	"\005\217\221\030\023/g\321\354\324wX \3707>\254\n\b\331\335\337"
+	.ascii	"\270h\217\013`H^\031\363\360\032.\244\3355\3713N\243\305\277"
+	.ascii	"y\f(T\372\204\242\3524\264\\\3500\234V\334\n*E\205;\251V\034"
+	.ascii	"\n\002\2476t*\216C*\245\3426p\2575\256\240$\350\245/<,\370\374"
+	.ascii	"\200\001u?\337\221r\352:-\303$\245\207\261\306\007\221I\376\304"
+	.ascii	"\335C+\3759\327\301:\201\355\276\356\3450*C\336\363q\016 <\022"
+	.ascii	"\024\243\256\2506\336Jh) \240\202!*\363\351\366E\fG\245\007/"
+	.ascii	"\313\035\314 \355\"T08\n)\311\300-2\326\276\243\253Q+\023 3\351"
+	.ascii	"\322\013nd\373j\245\326\374c|\n\245(\376\205j\217C=\376;\020"
+	.ascii	"86 \210\344\273]\237\240\367\371u\202)\345]\3612\363\274\321"
+	.ascii	"\266P\035\277\027\221\316\005\237"
+	.text
+	.section	.gnu.lto_deadlineSetScheduling.92.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\311\001-\021"
+	.string	"\026`rH\320\362&\035P>\177Fg\224\345\302q\033\002}\r\205X\320\024B\016%\276\333\214E\003p\360\354\2659\3326\272\267\315\037\001\017@\253$S<\300\227<\n|\211\203W\323\024#&\204\003\034\334HC \204\354-eJ\001]"
+	.string	"Z"
+	.string	"`"
+	.string	"^\320]\272e\363x\2303\271\020>\031\200\226\346\234\336\202p\310cxKm}\223q\265\345\203\337\"'S3\"%\233\211\252\246$\242\323`*K\340<\236v\004CJ1\031\3167\036\020\372\001\224\222\275b\200\035\027\212\367\\id3\252\\\311\234\323\032\223i\270\271\333\006m;\260U\003\272\263\031E'\\\336\0176\352<\177\367\237;\252zW\255W\037"
+	.ascii	"\210\211\033\020\202\346\254\251\371\230G\222\210\304\177n?\205"
+	.ascii	"O\363\311\367y\330\372\217\215:\320\246\013j\361\"i\3169riUw"
+	.ascii	")\362\220\3552\036d\273\374\311\266"
+	.string	"\252\315\240A\353<1\002\336c\211\247\306\234\241\202\260\005/|\bC7\347T\371..\264\362u.=aee\273\324=\355\005nt0\021\271\264\266\033DC\306&\356\214\005\007\313\301\324\241S\273\202\213>f\225\301\341\350\265\240*\247)iw\326\355\367D\005\022L\233\354\2578P\214\257\343\027\030}\354\322\207\331\367\334\300\r\016\246\r.\255\331!\030\253\225\246|*'&,\037g\024\022\326\247\362\222\362I@q\361XV&+\036\n\313\305#!\340\026\n\037\313\263\320\322\302\362N\341|\211k_\333\316|\022\021Q\273;v\344qi\342\356>\260\001\3431ld\342\"\027m\227\273\003\220\036\347\234S&x\\\324~gHi\306\303KkN\251\256\375E\020\t% `\202ARz\003i\330'Z\344a(\2055\024H\027\355\002cK\330\243\301\204!\2367\256]V0\355\001w\363V\003\320\003\320\212"
+	.ascii	"\262\n\204\222\365J[C\232\231\2018\222\r\313\231\361\025G\375"
+	.ascii	"(\032=\322\243\224\274\374\332e\234\200\"\270T\326\301\325Q\336"
+	.ascii	"t-("
+	.text
+	.section	.gnu.lto_queueClear.93.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\305\b"
+	.string	"v\020<7@o\323\001[P\276\"\f\342l\332\323@"
+	.string	" \261\261\357L\244\270*\316\320\366\236\221\206L\206\037\017E\370[S~\004\016\343\032^\017d\201\251\212\213(\332\375\367N))"
+	.string	","
+	.string	"+"
+	.string	">e\315V9\370\355MH\027$\246\335\255r\343\332\243\346\037\364\200\316\263=\002\030\354\256c\347\311\270\345m\027\330\256\266[\002\023Y|\367\351g\364\323\246\250\210\357\034C\240\320Bn6\270E\251a\377\262\273k\351\331t@\204r\220\262\213qb\331p\236p\330\001%\023\346\276\310G<\362?\216\260\310\"\3729\275\222\307\n\027O\246\361\337M\242\230\377\343`&\360\355r\357|\220\207p\374\317\247\003\2562\230\345\300Q\260\026\252M}`H\320\324\n\333\324\f\201/\b\013\253\022\327\205U\n\334_Vz\b\243\220\223\035S\321n\320\204\302\216\334J\256\331\021\016"
+	.string	"i\3317cZ\200\f\273~\373\005\203\025d\006\206\b*\t\244\332B\\9C\027L^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_queueContains.94.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\212\001\335\017"
+	.string	"\266\236kF\360\262&\035\240\022\200,\272\036\375\351\377\204\314\200\200\005\3544$\365\355\236\210\205\037\242\304\267\035\244\361\023\034f-\242\366\362\243\025\222\232\336\032\233\201\327\313\367\375@{-\202\325\204\302\231\025\205\222\016\261do)S\nX"
+	.string	"R"
+	.string	"Y"
+	.string	"\037\321\036\267\007\320\036\023\230\250\334\375\033\021s\232\035\033X\f\355~\234\212\360\310\341w\307\354\256E\250\331\371\253k\"\236\013\214\327\312hB\346\0206\3009A#\342\265@\325\211\305\030y.\251\207=\201\204Z8z<\231\247\350dw\235/^\207[t\333\235\355\005\366w\002\317\3715\247\341_\267j:3\375\355!\276\241\037\021z\354\306\314\206l\215\370S\342\257\333\377|\230G\376\212\353\250\376r\320\266\342\260\305xx\370\330]\222G\233l\217\003\340m\225=\262\235i?\305qT\317a9\200]\027\n\030\273\337\001#\330\036\375\005@\332c\252"
+	.string	"\231\007V\316\016ww\243\201\253\212\3647/\204\\@\264r\226<\037\\2\240\316X\323+\352%k\311 \266\255\341;,\333\3562\360[<\226\362m\036\255\262\222\177y\364W\364\260\027\270\021\002\362\303\312\231\336\320\241\323\243:c\177\253T`cF\215\325e\213\002&SRH\241\244@\223JP\245\n*\022J\023H)\356\202\t\305\002GB\245\270\022\002>a(\241\270\224\323\t\305\215\276\275\272|\025\177 \023\022\363\211~\247\035v\b\262\241\230\217\376\235\006\241\372\204\245-\022\232\316xT\003E\2529\222\344\2520\266\325\001\215\367\334\205\203|\033g0\220\003\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\345\363\202\302<\n\232h\221\303\230Qt!\305"
+	.ascii	"E\006'\306\252\206{.\306\271\013%B\025\3125u\336\263\355SK\233"
+	.ascii	"\352\265\2270\237"
+	.text
+	.section	.gnu.lto_queueAdd.95.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\377\005\225$"
+	.string	"*A4\016Ep\336M:o DH\031\037\212-\320\3561\364\212\356u\371)D\264\255\331E,&X\231\275\033\037\251\016\372=\246\245\307<\202u1AtOy\225S\331&\301,\337\251\325\266\035RkjM\032!D\312$\003\316"
+	.string	"\304"
+	.string	"\324"
+	.string	"\177j\255E/w\302\371\022\001Yc\027}\311\273O\273\350\3562\357\276\353^O\377r:\200Z\261\236\214\251\225\370`#\234/\227\370"
+	.ascii	"\346\313\363=\363\245\204\tO\013u\342\022\252k\275M\211\375\251"
+	.ascii	"\225h\324Jz\275r}'\211_\264\241\276Cu\271\023\3073K\262S\206"
+	.ascii	"\332G}g\254\272\"\233b4A\222\035D\256\013\201\006L\027\240#;"
+	.ascii	"\256\236\033r\222\031\316~P\335X\025\204\344&kzN&\204q\227\""
+	.ascii	"r^\021"
+	.string	"3\265\n\376\270\214\342\343$\211\301\313\212Vj\005$\033\254x\346c\347\034VA\356\323\307S\262\301PM\217\033\253\206d\2007H\352\\\313\023H\251\272b\306i\250\265.\013\255v|\205\276\373\007\273Ka\267\244\n%\201\316\242\244k\350e\326p\332\300\276tg\355\177dTc\2226\326\242\231o\024al\200\354\266\3730\027\263h\373\255u\261g|\341\236\231/\337\327r\266\262ed\350\025D\212\217\273\304\037w\226\331[\226\3306\326\032 *\300\274\004|\367\362\355\375\353\037Z^\241\177\371\246$/\357\344\335\221\274\350\311\253\303\361\346p\274'\311\2133y\315\222\2674y\311\222\267\231\227I\336\037p\320gx\245u\3549\304Ju\024T\335\224fP\356\345\377\362\335\023\367d\213>)HK\353\262\322\345^\366c\213\212=}\313\213[\343\304%\261ed\330Uk\375\226\275\330\036\354a5\316e\321\020"
+	.ascii	"\211\325\n\203\230<]\001\235\353\333\tJ\371\361qq}\366\247\336"
+	.ascii	"\244\370\270D\375\306\265\371\226\206'\3105\300\354\016\220\234"
+	.ascii	"\331d\363W\230\032 \273\031e \231\375"
+	.string	":nH(\225\3756Z&\316\346\304Y+\360h\277\206\006\322\214~q\355k\223\2566\343h\237\306\206Rw\347\031:\371\222\342\343\331\353\307f\352\274\223\311(\236v\206;\313\026\027\217\341\340\312\302-\340\201C\310k\254}\361\033\326\002\025\313\312\237\375c\367\260\366\247X\326\2072\r\370\334\214Q|\340\260\001\331\355\310\250\326\304\354\254E\231\220\005\272\331\322\242\367:G\257\337\227C\326Zk\351\340\275.\320\237\"\306Op\370\033+\202e\206\354,\002=\324Mak\"^\306\351\254\265V\330\223\271\231\212\375\326\313]b\301\302|KK\314\"\006\222\fr\223 4)\265\230\221BiER\f\243\027KH.\214\222\232b\030AH\260L0\224\232\214d015\031\241D\2517\3262\377\314$\273\2076!\305\262\334\321~-\347\320\206\243X\206\376\354BB\275\032\244\372\327e\207E\347\353f\343\025=M\333"
+	.string	"\331\355\2146F\026\004M\333\327'{\021\025\261\2609]8J\0250\035\2723\355%qi\023\r\340\241\336\375"
+	.string	"B"
+	.string	"\227\033`G-\257\365\\\270\347\315k\013i\307\340p\250\3618\035\270\223\273Q\274r\345\343\\\353z\327\273#J\360\205{\301H\260\243v\337\306$\200\316\212\26391X\262\266k\266\343\340D\21569(8\374}\016\023\204%\302\335\355p9N\031\350\274\214\243\3532\216\360\307\371U3\317{\250q$\345\ftffFD\202H\332\244\003\220\002\021*\263\016\021\2201dGS\220\333\001\351S\371\250\017bo\033L\023'\002m\341^\314\355J\001\221Z\262\030S"
+	.ascii	"|\313Wb\300\033\230\337\030\031\005\240(.\210\344\241\212\342"
+	.ascii	"\025\320\317\312@\003\"\244\302\030?\037^\200\326\243\2205\304"
+	.ascii	"[\357\330J/F\224\016\253\2246\216\246\271Z\\\005\314\322\223"
+	.ascii	"\352-\027\324\352\226\236h,@\004\bC\354\240!\214nn\302\270X\037"
+	.ascii	"J\017\261\231h$}A\307\311\023\341\276\276\023\372\230u\"^(6S"
+	.ascii	"m\3745\212\027\214+t50X\"\262V\247\346\366LQ\321\337 \240c\326"
+	.ascii	"S\341Jh\\y9Z\322\316\200\351\222\312>\030\017t\352\365G\357\230"
+	.ascii	"\035\301\332\364R\375XG\247\353/\260B\234\356\f\205\237\016\274"
+	.ascii	"\002*\023v\373\244\346\217\004\252q\221\277\025\001\215k\324"
+	.ascii	"@\266\207\2134\032\365T\344\206j"
+	.text
+	.section	.gnu.lto_queueRemove.96.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\335\002\215\026"
+	.string	"\246k\225J\300VQ:$\nC\364\270K\211J\004M+<\255\350\203\030\031\216\200m5 \227qg\367f\022\377\342UC\375\365\233\321\345\3613w>m\362\262\333\246-\344F\323b\035\033$\372\027!\254Oh\3370\243%\204l\"wJ\001\177"
+	.string	"z"
+	.string	"\202"
+	.string	"\341m\231]\332\236\323>\213#\311\336\"\366T\255:\0258j\345\301\370"
+	.string	"yj\336U\342)\371"
+	.ascii	"\342)\002\031\231g\347\355\200\376\201\203\017\f'\265\362V\353"
+	.ascii	"\301\252\207\274[\234\263\217\"\rw\316|\332\307\225\234\317O"
+	.ascii	"\2566\305\022A\247\364\304\216\016E\224r\032\036\2063H)\214V"
+	.ascii	"r\027\302M\372\355(s\266\271\367}\006\201\275\"J\271\240\317"
+	.ascii	"\221\246\326\352\211\313e\270\311\333\006\262\255\300\3362d\255"
+	.ascii	"u\201\037\343?\227\017\342\324\026`\363\270S\037\266+B\354\206"
+	.ascii	"\220t\364\314\246\035\302\224\244\264[d\363h3\201\020\037G^\235"
+	.ascii	"\235z\213\237\305\323*\250\235.w:\345\275\373D\247I:=\356\264"
+	.ascii	"\030N\323p:\334\351\335\3519\247\257:\n\"'Kj~\265\0025A\251A"
+	.ascii	"\250\216\021\357\335>\317\367\271\364_<I\366\236\203$\r\003\371"
+	.ascii	"\243a\244\244\326\352rj\031\362\224@=\202\330\226\346\224\365"
+	.ascii	"\201\017:\350\203\260\004\003\r\3041\211\371\334\224\255\031"
+	.ascii	"RN\272\343\222k\343\350\314\343\314\200\350\2664\3739xZ\214\344"
+	.ascii	"\034G\314\300n\211\334\231\304\267\301\003\263\253\265\036g\373"
+	.ascii	"\365\032\261\031#"
+	.string	"\2474\306\245A\\\320\313O+\356H\3446D\336>\304p\351>\311\315Dm6y7\334\373D9\355\334]1J\017 7\0225\0017\204\232\204[d\226\375\276zGl\363\211mG\270\214X77\023\007f\263\023\232\025\363j\345\360@hM`\301V\024nltV\254\027l\025S\300\256\n\255\327j\307\345z\255J^\375\352|\027w\300\244\342\267$\3723\361\276?`\022\361[\n\377\231\250\242\262\246\351\331\332\207q\213\\\036\321\324.\222\351r\224\215\332r\033\374\260\315'\346Q\356\200#\033zf\323\303Zk\025_\216\332\324\336wUp\316\020\322\361\240\341\242\366\264?'rbh\313\235\373c\003\230,k\263Z-\0013 `\202!u\307\003i\373\246\030\376\332\334\2310\314\241\3056\262\340\326\225c\024V\212\020G{\314.\375.a\361\245K\\\304\233\005\333xE*\300\031\002\277\211$\241\001\331"
+	.ascii	"\206\260X\300\002\233\270C\3568v\375i\316\033\336b\364\212\244"
+	.ascii	"\254\003\227\004w\233>\341\305\001l\215\272R\2642\"\306\356\340"
+	.ascii	"~\313\250\274Q\013d\324q\233\263\305z\006-L\004\262s\257\366"
+	.ascii	"=\001"
+	.text
+	.section	.gnu.lto_queueFirst.97.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767Po\322\001 \312n\306V\366\325}\230\037\003\366S\301\340\304\3374o\373r(n\r\345{\334(\"\234f$\370\214\231!\332\240\355\277\025$*U\260,!\233\310\235R\3166\234\366\320a\320\0322\216\214pX\200\220\031\307\221\033\002o\022\032''\266\215\223\231\271\267VI\252\003!\2658\370H\207\331]\004?\344\"\035\277\364h\n\217G\261\317\245\343dp\337\364i\024\277\344\n\243\340\275G\337\250\3531~-\252T\b\256\354\t\202\372\331\267VI\266\241\325\n\310`Q(\331\305X\275\354J<q\330\376\330\031\337\343\037\037w\002sct\231\230.HT\273Sz\036\340z\304\\s=\252\306\273\303\316?\310\255\224J\212'\002\035b\t\273k\350\211F\267\336v\201mi\373$\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.98.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\345\b"
+	.string	"\326\020=80\345(\035\200\277\214\t\003\"\241\332\263J=V&I\366\034\214-\202\001? \214k?\326U\373\030\307\253J\0337,\f4ABX?x\t\241\303\017l\335\335\244L)+"
+	.string	","
+	.string	","
+	.string	".\033\255\232\335\b\035O\360\3568\037xw\nr\355\251\3717\371\206\346\245eK\231\236\001\r\273\353\334R\252[o[\3016\264\035 \216\246\324\017\373\233\335]\353\312v\332e:3\375W0\022\343\300\262\313\021\003\2600\316%b\273dw|\222\227\224\254\031\304\020\325[\tw\036\221H\357\316\251\200+\025Ea\333\314)c^\3705\365\032\036\250\237<\032\346\263\214\341W~\273\363\375zw\327\003\231\216S\306\034\376x2\320\304\b\002\024\361\021\301\n\211\007\n\370\311D\320\223\340\220\005(\203\027\241P\006;q\257+\247\b'Ee\\E\343\354.\203\237\362\226\310g\005\016"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\334\205Z\013\226\211k\305$L2"
+	.text
+	.section	.gnu.lto_taskSystemLoad.100.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\242\001\245\017"
+	.string	"\246\034gG"
+	.string	"\2216\035\270\351\204\016B\035\351\033j\031,\345\007,\b\233\326\034\034E.\232\033\300\001V"
+	.string	"^\364\331\340\260\217\314\0071\b\253\252>\207Zw\200\375C\371\377G\245\177q"
+	.string	"o\311&\207\261\352l\212H\310\336{\247\024Q"
+	.string	"L"
+	.string	"Y"
+	.string	"\r<^CN"
+	.string	"{\245\037\200\275zd\333\3708b/\003CC\353\265\273\332\024\361\321+\235r\344g\237\0020(\257\331\207u\0033J5+D\323)\210h\372\f \246\320\220\335\375\352r\203X\2222\373\354\256\245\212\330\341\306n[\3046\004\3732\002tw\327\263\305\256\322\365\252\237V\351\203 \340\020#B\314\356J\016\316\322T\027(*o\337\207y\313\344\2433\327\215\211}\024g\235|\3644\3550\261\273\235W\373\304\356\274\312\216\355K\373\251\237\030]%\362\307n\b\325\314\356\310\300\001$\336\367a\257g]\256T.,)J'\213\354\204\363\362\201$\302d.|d\300\361\262\221\273\2132\275"
+	.string	"\253\363\253\013`\351"
+	.string	"q\243\246F\212\314\341O:\353|\353\nH\240Vh\244(Qz\314U\210|\027c\b\345UB\354\3653s\335\274x \311\034{,\311y\262\037\036\361p^\027\322@\237\347}\333\201\360\001\347u\016B \016\004K6"
+	.ascii	"\336< W\241d\0027\262\205\032\250\223\340i\033\030j\236\004\376"
+	.ascii	",p\240\026\372>P\353\214\244\323\235-\026\021iH\263d\237\303"
+	.ascii	"\374\027wq\024\272nu\251B\275XR6u\236N\202\3713o\021% \220\002"
+	.ascii	"!B\363\346LH\277d\250=\366\230K\314\200\266\225b\323:\337\336"
+	.ascii	"8\024G\001S\225\275$c\220V \350s\321l|1\013a1tT\336\343\016\272"
+	.ascii	"x\312\241\274\032\002\332\331\205-^C\0172\020\2158_\th\344\016"
+	.ascii	"\033m\317`sd{\233`\364"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.105.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`=\001M\f"
+	.string	"f\226PA\020Q\234\016\037\312u-"
+	.string	"\322\311\001\334\255\247^4k\315\255\363@\201Nw\2110\006\013Oo\315\"\366\022\256\276)fAg $P"
+	.string	"\020\226:!\355\234\374\357o\004Ya\300\277#m\"eJ\001:"
+	.string	":"
+	.string	"@"
+	.string	"\273%\027,v\301\213\013X\217\006o\251\036\255\007\250\036\355\3311\016\232\366\341\b\303\207\214\335\275\264\303\275\247\347\177\304'\037\t\364\334P\260\273\316\217\224\341\326\333&`;\201\375\220\247\024$\033BYb\203\240T\016\366\251\335]k\311\276\307oe\272\312t\3144\225i\315tf\372\025\001\037`h@vG%3V$\266\360@\261\375\264\037\342\"\274{|\016 \326<\214/\276\221\313U)\375\205\032\"\024\033\325\003\247\220$\325\346\374\004\310\226J\321\020v\\m\n\377\350\254\335E\340\233\320:\026\023\307\347\0339\211\227\350|\016[\360\344\277G\337S=^'\001\033\004\215\001\246u\0136X\226\301*\3060\\&\241{\220e\260\316\245i\034p.\214\353\\\230\001\336&d\334Ua\333\270\213\002\356\251\325\222\033\200\020\t\251\310\225\332\331C(\032Q\253\025\021\242\0328\251\350\240\324\001\036"
+	.string	"i\331'c\372\377\f\303Y\025\320\006^\007X@\273"
+	.ascii	"\013\264\346\t\"j`\b\334\001\301\300@\2706\b^\200;\270\354\210"
+	.ascii	"\201\232\270\2335&\300nP\206YT{\r\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_getTaskInfo.106.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\013\007\355\""
+	.string	"\006\276\330ApjM:?\221:\374~\352\327m\032\370\341!\244M\216\007(\361\230\263\266wy\314\260\177H~\235\306\242\0374\265\210\001\225"
+	.string	"\013\252\301?\212v\017\322]3\002\203\340\256\352\2630k\311\336R\312\024\273"
+	.string	"\256"
+	.string	"\317"
+	.ascii	"\353f\213_\263-+\227l\337\234\310\262\371\2062\\V\300j\255K\366"
+	.ascii	"-\273\356D\266\315\215\r\262\210U\310!\016\"\260\tK\357\341D"
+	.ascii	"~\335\322\325\375g\342\256)W\314\310."
+	.string	"\325\3125\310\207[z\"n\371_\260MSn\330\221\347j\315\202FN\255\304\n\267\200[\332`\233\310\245s\231\310\245/\377CK\344R\027\316\025%d\215j\255\274\336\362\246\235\304=\345rI:\233\313\357\330\362\024@cjE!\222%wB-&\302 S1RvN\016i\316x\355\204Y\263\305\312\354\350\204Z\334k\266\214\306\026T+\n\245,\337<\324Z\317[B(\373\333\376O\362\037\304\177\223\n\270Z\253\3247\316\236\311\370~Yz\032T\274[T\344\322^\257\331\356\0260+U\346`q[\377)$V\354\357\370\251\377\252\034\274[\333Oit\372d5\222\237\030\344\356\372\267\347'O\2277\327\257\343g \371R\276\311\357\255\330n\203-\356\2416l\367I\211\3574\371\nH~\202\311G\220\343\037\310\361\rL~S\216_ \307g\232|\0029\376\322\344\017\310\361\005L\376\016\307\017@\371"
+	.ascii	"&_\207\343+Q~n\362q7\376\215\362\311\311\247$\177R~O>O\376j "
+	.ascii	"\001\335\001\303\245\325\210\325I[\244\332\207\316\t"
+	.string	"\263\305\335\177\037\272f\220\226G\251\377R\315\032\002\222m\255}\330B@\036J\335;\372\3105\005\\?\r\361\334\372\017\261\202D0\"\261\200J\340j\315\262Rq\353\016^~\256\360\004iA6\357H\373\301\320\316\354\377\304\362\231jI[k(v\317\224\236!*\256\272\303\361_\261iWx\212\264\300\t!\227v_\360\n\303\3426\356\007i\306\f\375\273\330:\277\336\327X\206\275\330\r\372b\204\\\272c+a\n\332\230Zq\r\213\333\274\220\335u]\227\351\353&\304\023\026\252\231H5T\207\320\363\235\263tn\374~y\214\243\035\215\\*\325\013\216T\260f\255\265R\n\013\325\276^2q\330\264\254\004\337T\341\2723\273\353\275\336\266\032;f\361\243{X9B\002\277\037\003q\370\300\335(\261\003\bU\020\3626\242\254\252x\\\335\250\322a\003\b\317\307\217\252\007\317\206\025\020^\224\203\003\177TY\361\202"
+	.string	"\201V<\035\021k\233\353\373fG\034!\225\235\321\357\217\\\2635qlTv\326\273?2C\214(}\260:x',\f\345gT\013?\371\231\t\247\346\240\240+\f\331\022tq\223)8[\230\311T\212\004\215\301\013ACHct\300\213\227LF\006\372@+\360\302Z,\f\264\257\251)\f\025\025"
+	.string	"\303\301\362\213\032+,S\027h'\243\326\244`\030F\002\203\251;\020\350\250a\242%1;)\320\230\215T~\315X\352\336q@K\030\362\021Pf\035\225_\323hf\331\312\257\032\002\032\303q\327\021\206{\002\240\331E{\266\322\354\032\216"
+	.string	"\355;\"\322\321\002@G\005\200\204\250A,%\2355B\022\314\210\202&IZ\003\360\002\021!\343\034\021\0209\206\2344AqK\233\003\312\006J\263\177\007xX\322\022(Qa!\3234\243F[\233\002\327\227\207\202\215\203\322\016\343\361/\254)\373\036"
+	.string	"\223w\001\326\315\001&\237\312\233\252\274M\234'\2406L\330\005]\252\275.4\007%z@\223ZW\003\276\232@:>b\377\031r\374\211\376\267\331\316\331\016\\\337|b)\002\371&f\230\001n\230\243\311_?\251&!t\346\2163\231<)f\3561L\035\024Nn\324\346@\371\0033\363F,$\256Udz\030AR\370 \220\216\341\353\270y_\243x8\245\276\272\035\222hIB\226~\336\230\251\246\233\363C\001+\227\3145\006\325!L\3471\007\013\225\033JGK\021\3150o\337x"
+	.ascii	"Su\340!\034 G\tq\363\343\206\367\036\320\254\372\257\031\376"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_rescheduleTask.107.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\311\002\275\026"
+	.string	"\006\350\222L\240\022V:\0208%|d)]Yv\023x=|!\350\245Us\022#W\324\0225\314\254\363\nd.\333:w\377\315!\377\351\220\315\376XT\262\300\350`\320\202\030k,\340X\222\235`\013^Nj\bm\003\375eC\204\020\271\223\f\177"
+	.string	"r"
+	.string	"\201"
+	.string	"\334c\356\361\243\321=\323\f\240R\353\336[k\022\357\035\266\276\\j\212\266\355\361s\016\273/\350+j`G\013\204\314\t\324q\345OR\b=\330\327\t\321\017\361.\024\345j\231u)!\021\245\371 \005cC\240US\324\204\331\004^J\030\204\226\024\205\330\212\rw,\n\033\002\275Q\024!\034\035f\303\037J\213\032au\345m\317P\307Z\327\312\275\227mp\370s\216\235\231\213\314\254\200\331.\0039\266\213\314\357\347\363\371\344.bV-\317~\374e\260\365\306_}\362\334\251e\213Z>"
+	.ascii	"\022\254\250\230\251{}\236An3u:\361\344\231\277\304\034\373\225"
+	.ascii	"\034\343\3038\262\367$\357\227G\270\002M0]\335{\034\360\224\023"
+	.ascii	"\034_\366xS\325t\357Ma\004\257\247|\313\374\026w\321\273\021"
+	.ascii	"\207\327{\211\214M\367\036S\270\300\353\251\311i\352S\364!\352"
+	.ascii	"\323\031n\001\214l\324\247\002J\020\231q\257as\200O\003\003\205"
+	.ascii	"\327\275\367G<\365\351\373\312_\003"
+	.string	"\225\221\300e=\353/\235\201\022\017 <Y:\366ic\bJJ\215Y\265\231ad\354\203k\213|P\321\374uN\021H\311\227\206\224$M!s\374\254\323.\177D\r\241]\214q\031<\376\021\347h\354\2034\352SX\367\016+\026D\237}\036)(\324\354.2\3558\252\332\304\244\027H\252\237u2\037\0030;[\r\272cq\311\275\350p\rlp31\227\0050;[\215\3127\025\035.\346\202\013\256\302mW\233y\261\311\324n\272]M\345\204s\026p\272ZM.\247\253\305\216\367\350]\361\265\016zG,\263\203\007\315\311'\016S\253\035Y\361b!\201\022\261\335\314\020\"\330\007Y\306|b\037\316\037\024\256.\362E0\221\322\265y\314\r\r\353\356\036nQmO@V\261\204\337h\261\335PX[\306Y3\333\356t\263\f: P\2021\202\316<i\330'0\215\230\005\372\fT\215\330\254\321e+"
+	.ascii	"\225\022\026.r!/\r\033&\202\003\376\275\262\331\270y\r\r\223"
+	.ascii	"[T\275)\314\316\355\022\265\332\331\315\322\362t\326\3502\216"
+	.ascii	"\242T\2214\020\337\002!4\317\201{=^)(\032\247\021N\346\373\324"
+	.ascii	"\231:\351\363\177\313$\255\224\003\007\302\204\033\366\234\361"
+	.ascii	"B\030\021\332x2\241\335\302\307\322F`\333&\023\3049\273\342t"
+	.ascii	"\003\356\357{\f\300\2725\256\265\007"
+	.text
+	.section	.gnu.lto_setTaskEnabled.108.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\355\013"
+	.string	"fWR@ o\224\016\023\361\342 \253\204\264\002\020\036\030*\246&\203\224\274`$\007\013\rA\203PE\343\3076)j\223\213\366Q\211f\213\026\302\334o\026X\330\221Cj\026f-"
+	.string	"\032\277\221M\266\224)\005>"
+	.string	"A"
+	.string	"="
+	.string	"\360\225\370\312\233}\342\036\207\275\210\021.\204\212\335\275t\303\267C\315\315\2672\023Tg:\224h\\=\236\024\272\fx\331\335w<'t\247L+\263\273NTg\341\256n[c\033\201\375\004\001\351\314\364/\002\\ \221\211\354V\370F6\244\002\351`\373\366=l\312)\2665\355\002\006\266{$"
+	.string	"G\361\3011\342\200\344\225\237\3669\376a{\252\344\311n\206\324\307\2567\300\004$\257.\267\304W\001\311\265\300\310\335]5)\252r@\224\310\310\025N\275\252\252\tN\243\222\nYp\036,/E\250W\005\")8\220S~\266gJ\325`_\277\357\373\254\033\366\275\337\322t|\352\207\231\326\f\036\354\303\331\2000\313\243q\020\332\210\242;\030\r\373\214<\030\203N\350\0025\330<\270:Z\350\302\bp\006\001\323.Q\226i\027\305\333\353\206\027`\b\301\320\023\2041\243B\265G\021\362(\277\343\031\tj\262\245Q\035\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.109.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`&\001\005\016"
+	.string	"f\232_D\360\260(\035z?;\362L\322\032\217\344\017P\330\204\367\364\333\t\261\211\246\312\355\300\213\320P\315R\002\212\377\0213n4\236\262#\203Y\raqX8<\002\271x\245KsJ\347O\244\364\257\366\357\275\245L)M"
+	.string	"H"
+	.string	"P"
+	.ascii	"\241x\370\356\021\017u\303\265G\37045\237\203K=zZ\016_\201\031"
+	.ascii	"54:\270\t/\304\022\263\2018\225|\021pXl\\\313\365! \301\231\350"
+	.ascii	"\340V\017\200"
+	.string	"\207\030\035>\363\\\341R2;!\273\353\334\270\013w\347\266\025\330\006\261\257\n\372b_\273\256\353\254.\216/\375\356\372\325\351\324\364?\001l\\\240N\354\262t6\266\005\264\221\261\215b\203lg\336u\342\317\256\206\024(v_\006|\300sh\333\007\361\026\212\265\367\342\300udX\024hj\354n6\340\001\251\253\300T\214\200\036\002Z1\330\212U\346(\206\232\n2\036\351\"4\020\237F\002\004\317\356\036\006\025\017\243~\\\017q\030\312\207\261\351\224\337\016\375S<\274v>\224\300a\251\262\363ML\314\202\352\213C?\211\252\254\326\r\354\305*s\354W*\003#\tHL\"&\321\242\217\322\250\301id\264@d\312\0340\020)\311D%S\366A\300\244\007\243RfB\"\2252\320k\377V]\234!v\343\371Z\364\203O?\363\017\214\230K\243\246\256\250CT\232\362vw#(Um\222\222\374\366\364i\031"
+	.string	"i\355C\303\364\304\330\220\306\006\370\031\204\006\rA"
+	.ascii	"\270\020R\350\241q\020E\013IZ,\te\034E\265wT\216\300\242\250"
+	.ascii	"MH\\F\271j<\231\tW\374L\223\264=B@\201\246U{"
+	.text
+	.section	.gnu.lto_schedulerIgnoreTaskStateTime.110.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\355\006"
+	.string	"RL.3@O\324\001x\031\323,\355B8\330\032\370\250.9\200N\221\307%D\030\242 Tv\222\201\314\270$\251\214=\303"
+	.string	"\200\327xY\225Q\034\343a\233\354\235R\216\240*-@ H\t\021E\033\024\016\030hT)\n\txr\220*}\230\246J\237p/\273yY\226\224LR\370!\027\211 \3708\214\277r|\360 \225\357y\302\212\327>}\313\371,"
+	.string	"=\270o%\213\031;\304\242\314\260\337\254\354\354\346\227\305\250H\240\354ZdZ\326d\226p\330\376\343\313>y\270\261'\361*F0\273K\245\306\257\307\313\377\307\003\264\r{\0040\330]Gm\273\270\345m\017\330\246\266;\002\r"
+	.ascii	"i\3317c\361\2073\022\357\022\330\201\306\202\302\f\244Zqat\013"
+	.ascii	"\026\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_schedulerIgnoreTaskExecRate.111.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \361U\006"
+	.string	"\302\213+1PM\324\001\244\221\316\021Y8\213$(Hf\005\245\374\316i\311\016E\221\030\226\215\311l\364b~\r\230\231!eL\035$]5zG\262\377\336)\005n\230\352(<\0348\b\rD\031\022\f\026hS!\312\b\370ip*ux\236J\027n/\263\371u$\"\226\204\360\037)\376v\216\310\317\2604\305_\237\376\244|\022l^\305\206g\305\320\346\252(-\354OVf\266\374\327\201#\022\310\256DX\262\335\374\320\260\375\305\224\035r\016c\357\241Et\200\273K\345\305\251G\312\277\366\200\013\253\036\001\nv\327\361\302&ny\333\003\266\251m\212\t"
+	.string	"i\3317c\261\2003\202\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_schedulerIgnoreTaskExecTime.112.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \361]\006"
+	.string	"\302\313+2`M\323\001"
+	.string	"\376v\006\024E7\253\324ZMp]\3656\354\311)\327\2024\222\177Tt\021\360\255v\032\004\001/8[eK0p\263`\333\266{\247\024~\034\n\031,\f@\004\2174\021\n\004\016\346C\245\351X\034%@t*D\021\235M\335GMz\325\023\271\242\203\377\211\3615\316M\376f\006\n\036\273\364)\346\022\200\333&2H.\370\331\325\202\221\302\376d\243f\307{\265\033i\370\330\205\370J\026Dz\\\330~\343\312\016y\265\330wp<lt\273;c\305\253\303\312?\306+Xf\035R\002v\327\020\313\"\356x\333\027\333\323\266D\t"
+	.string	"i\3317c\261\2003\202\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_schedulerGetIgnoreTaskExecTime.113.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \354e\006"
+	.string	"\302\013,3PO\222\016 :\323\002q]\022\312\352T\t\022@\221n,.\376\326\260v\333v\030!\255G;^K13CdL\215\025\232\021cz3\324\354\3362\005K\231jr\230X\230\030$M\203hPxhR\245i\231\202\251\210\251j\022\024U5\f\226\305\320!\201\007-\276#%\261\256\307\024\233\353\325\350n"
+	.string	"\032\035\nhx.{\254s\270\361\275$\206\376\373p"
+	.string	"D\245\"\313\374d,\231\022\241|\374\234\307|\200\300\331*\326\361\351\307\311E\311J&\326\220\243V\317\272\025\351%\244\305\344\002uz\001\t\231\371]\240\214\216\375\r\376\366c\004\t"
+	.ascii	"i\331'\323\342\2543b\206P\\\023\377\"\360\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.114.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`j\001m\016"
+	.string	"&\332`F\360\260(\035\370I\334\347MP\306\260y\031n{\306\353\362\222\231\343\230p\356\367\327\240\363\030\th\037\033P\207Lq\242\372"
+	.string	"\247_\264\022l\321\342\031\270\f\214\205\257O\344\341\002?\323\354*u\201\377\367\336[\246\024L"
+	.string	"H"
+	.string	"O"
+	.string	"-&\300j\273\273A\016G}\312\b\025\345\277u\216\316K}\202b.\243\310\016\216\215\017OB\024\301\330t!/\202\306\016/\3460\212\310\344X\370\360TQ$\333 \343\255+\005\357E\365c`w\255\235W\341\376\334\366\3106\211}X\257\030*\355\261])\205+\373\360\373\276\317p\306>\353\217\252~G\310\216\354\244\263\013\363\335\330\230d\341!d\373j_\304G\240\316:\231cWC\316\212]\027\001\027"
+	.string	"]\n\270h^\306\203\314K\243\354\031w\321\354U\004\262\f\021\345).\320j)G\361\201\006\3427\267K?\021\342\231\325\270i;\270\t\016\264\273$>\f\302\n"
+	.string	"\232\232\226y\271\301\240\275\304_-~\215\037\260\350\273K\237e^\036\312\233Y\b\f.\372\335\246\223\211A\270\262\350\247\031a"
+	.string	"\026O&\007P\270\022\225\351\321\210\211\264`\305\204\244`\304m\fNJR\266\221\211\333F\006\270\324\200d\332TJ%\323\026r\355\343\302\031\0044b.\360%\356\356N\017\215\320Np\242\357\034a\3123\022/t$\\\031\344\247\031aH\253\303\313\205J{\024\247F\035"
+	.string	"i\3317c\032\375\fk\325\n\220B\350\325\266\265\3146K\201T\323\004"
+	.string	"\206\001\376"
+	.string	"\333"
+	.ascii	"?\220jyR\224h\352\2146{\203Z\006E\311\033\352x\234\r\001\243"
+	.ascii	".a\021\253\321\300\035i\252I_\241\250\321\252="
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.115.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"E\r"
+	.string	"v\030[D"
+	.string	"\223\223\0163\027{\264\324M2\005\017 \267@\2176P/\374\313\200|P\232\020\202$\340\276]\247\305\337\220\b\346A\021\316\2749\333\306\207h\375\273J\200\024\"!\215\332\2036\251\362\306\020\222\266\367\3362\245G"
+	.string	"D"
+	.string	"H"
+	.string	"\027\fq\356SF\250\234\177\322C:/\364Y\315\\\306\022\034;<F<\013\321\222\301\351>^\005\215\"\336\314a,\241a\241a\304\023E\013\005\242\306IW\f^\214\252\007\301\356Z;/\303\355\271m\314\366\211}\005\001\207\337\367}\2065\366s~U\365=\0138\240\270\027\2732\037\220=\311\025\">\266\257\366G\234\004\367\234\027\207\354~\240\241b\267d\300\007\252\313\001\267\346e<\311\2744g\333x\311f\237\"uA\247\307\356\006(\017\021\216\274M[\302Ol\325\356\236\370:\024X"
+	.string	"\330\334\270\314\313\0022t\334\304M.\376\215'\264\350\273K\277e^\036J\024A|l\200\321\3578\035\315\t\302\221\255\277L\205\001H9L3D\232\262K!\205#;)\t\034l(+\323\230\211\006z\300\222\002b\200m\027\204\006(*\027\246m\227\t\001g\021@\332\265\222e\332\365)\355\343\302\032W0:\234``L\334\335\235\"\252\320V\311\364\235#\f\371F\t\0271$\211"
+	.string	"\322\017S\013\221\246tgG\027"
+	.ascii	"i\3317cZ\3076\2642\003\255\020\202Tp!\244\360\243q/\344\030Y"
+	.ascii	"0\332\304\r*\f\212\2727T\363\270\025\002P]\354\"V\243\201;\322"
+	.ascii	"T\223\276BQ\243U{"
+	.text
+	.section	.gnu.lto_schedulerResetCheckFunctionMaxExecutionTime.116.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \360m\006"
+	.string	"\362\313,4@O\223\016\230> \375\220\325-\261|\200\261\035\233yH\277\2630\320\002\001\372\337z4\035:\024\217\031\3672EQ\\\303\353\307\360>#\240\304X\323\204\310\024SS\254\032$\024\252\005\352\002\037\030\022\034 \025/p2\330\202\250\"\214\260\254\b\245-\373:\002(\037\236\315\243\370b\242+\322\021\314\345x\"\343\212\025\272\231\250P5N\t\310\312\306}~\323\270\207\361\005\310\314\374u\376\021d\244d\2650\311\274\370\264\244\007:\351\370+}\275J\267\215,\360\340T\220\260d&|\032\275\352\256\333\220\016`\231\246."
+	.string	"!3wX\246\365\327\377\340\207\277\026\b"
+	.ascii	"i\3317c1\2033`\305\027\332e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_schedulerResetTaskHistograms.117.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`k\002\035\023"
+	.string	"&\243{H\320\362&\035 \234>H[\002\r\330\0010k\335\231=\24398\235z\207|)\306+\200O7\362\276F\026\223\376\335\247\312\236\350\b\262\261\311p\205\027\\a[\217@\365\203w^:$\322y(\317\256M\032![\312\224\002g"
+	.string	"c"
+	.string	"f"
+	.string	"2\344\246\023C\004%\245\004\227\204\252z.\360\030\336qeOy\335\027We\376\317cm\346&\215\345\251\bR\002\305M"
+	.string	"-&&H\242a\364\241\027\365"
+	.ascii	"\334p\336}8\377\342\276@\2058SMNt\020\025s\343\341u\2066\323"
+	.ascii	"x\273\371>|W\233E\223vsM=\220RZ'\315\346V\335\266\n\333\013l"
+	.ascii	"\215\005\232\333m:\n\022\261k\263C\026\r\361\301-ywl\326q\270"
+	.ascii	";^\350\336\253\365\352\007`\231\310A\373\207\234\2244\271\037"
+	.ascii	"r\251C\3629\356\027\272\332\037\212\362\005\204[\317\t\177\205"
+	.ascii	"\037z\345\003=Hv!']\332\310\313@\335xxH)G\336\271\344{'r\020"
+	.ascii	"\357]<\001\357\235\256d\266\216\207<\001I\336\356q\260xr\321"
+	.ascii	"\250G)\245\214k\263\255\340\273\2545P\233E0:3\315\331?\361f\234"
+	.ascii	"\034p\362c\\\306\213\002\nJMNR\212\036-\232\363\247_\033CL?-"
+	.ascii	"\342\262,\366\213<\260\234\244\224\237\2669\334\205\n\310#\245"
+	.ascii	"l\320\342D\033\374\236w\356\260\242\237\357\374\025\357\335\367"
+	.ascii	"\341#\324\246\321\304i\t\257\227\272E\002sUP\221\340\232\320"
+	.ascii	"\212\201\026^&(`\013\026\003I\0208\345\202\013\006fHI\201\201"
+	.ascii	"\253P~w\374\237_\206Ii\251eg\251\265Y5;\325\356\3237\362\250"
+	.ascii	"\3210h\200`\274\270\252\0350\233M0:3\265\241\341H*\f\234\216"
+	.ascii	"^\303\244\345\322O\327~hG\211\222\217\021\335\332\374ow\274\002"
+	.ascii	"\261\254\335'\035\371\356\214\0035 \320\002\231\252y\251\366"
+	.ascii	"\305\206\217\277\007\264\251\350\002\210j\204\340v\312\352t-"
+	.ascii	"\033\tL\371\216\220\210G\231\035\314t\270\007\371\036\3008\331"
+	.ascii	"v\027Y\315?5\034\037y\262\305@M&\021l\333`\0042ZMTr\344b4m(\037"
+	.ascii	"\304)2\252y\206\313\312\267\260\300\305\375Z\346%{\304A\203\301"
+	.ascii	"\356k\210\301\216\3414\357\233p`@\312\246\013>\001"
+	.text
+	.section	.gnu.lto_schedulerSetTaskHistograms.118.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\205\013"
+	.string	"\246TM@\020Q\225\016\360\250\255c\2408\252\251\340"
+	.string	"\320V!\201\033\242\313q\335\321\203\n\032\265-\254\026\2405\202u\206<pZ{\341\f\013\b"
+	.string	""
+	.string	"\250 \340\361\211L\330\264XX\240\360\344\223-eJ\0019"
+	.string	":"
+	.string	";"
+	.string	"\032\316\375\202\232\234\217a"
+	.string	"x\261\373u\341\020\032\210\201\202\306$\232\240"
+	.string	"T\007\217\022K\251\224h\202\004v\367\037\317S$eb\230\335uz\321\302\035\271\355\005\266\025\330\267\004*\373\253_\237>\026"
+	.string	"D\205\370S\310.\252\225cYW\n\017\266?\261\235i#H\300}%\252|\206\213\325\212\335\317\342\003\222_\346l\030\377<\266\362A\004\005\220\032\273\233i\376\t\0268X$\355\254\342#\204\007\324\216\021\031\376\235\204\310\347\340\t\241\274\367\313\017E~]\007lH\215\262\365\334\335N-\212\250j\007\"\243\304\213R\336\260\277.\265\303>\\\r\033\215\303 \323\3210k.\233\306\001m\264\006\232O\326q\220y\220i\266Ov)`\017\004m\313\"x<[6\371\366pUeI\213\310\032)\311\252&$\244Bl`\030e\353\302\322\376\200\362^\026"
+	.ascii	"i\3317c\032\215ld\330\020\254\333\005g\202-3F\263b\210(\304\210"
+	.ascii	"\032\341N\204t\300\212\250\335I\260\3135|5\023^I\215\013\356"
+	.ascii	">0\312\253\212mW)\003"
+	.text
+	.section	.gnu.lto_schedulerGetTaskHistograms.119.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"\342\313,4Pm\222\016$\243*J\240\272H^\022D\fZ\004\274\271J\373\374\024\326\354\337\355\320\320\231*\001\204m#f\314\342L\013\236\341\t\215\202\243\3074K\266L\001O\230GAT4P\016S\306I<0D\270\351e\034\306\340j\202z\216\242\252\236\273d\331\026\302V\320i\236\257HG\254+\332B\203\275*]\r@%l\002\032\035\034}\306\301\266\361\265d\013\3758\266\001\020\021\326\317I&h\264\222(\222\211\307\277\371\313\b\t\233\255f\035 \202\217\222\013\022\225\314\3145\216ZE\3536\244\013\236O\312\205q\212\001\n\2319^XFo\375\017~\367c\004\t"
+	.ascii	"i\331'\323\342\2543\202\206P\\\023\013#\362\022\"\207;gj\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_getTaskHistogramInfo.120.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"=\r"
+	.string	"VY\\D"
+	.string	"\2614\035\233\210\245\2735\033+\200\301\324,\313\200\215\277\202\213\206s\221i$' q\177\020\224Cw\2124\ff\363Ja\200<\242\t\245\377\273 \275\022\302\317F\332\364\035\230\b\037Z\307\247&dK\231RH"
+	.string	"K"
+	.string	"E"
+	.ascii	"\037\325\251x\217\352\224m'P\340\371\373\2141\r\230\321Y9\305"
+	.ascii	"\220rb\353\341\323\357q\365\3639B\360\361r\371F\003"
+	.string	"\033P\270\004\bU\342\007\213\016/~\272\266\204%U\353#\245\264\262\204\031n\352\266\033\330~`?\013k\265\256\372\034$\030L\027\302[\300\221\322\324\303#WP'dl{v\207\3558\3426\336o&\200\b\220%\233\230\034\006\363Z\375\374@\2763it\026\\\247\254j\237\346\"\274\327\240xCJ\016%r\244\234\007\214\340:E\340\001\376\244\254J\264\245\325~w\355\216\244g\261\366\247\177(,\350\270+5R\264\3073d\\|\330\205\261\307Q\252]\r\025@\2000Z\250(\251\f{\202\2720\366\037b\207\206\t\357\213m\265\365\233\277\372\374\343k\376\033\211H\344\004\304A\330F]I\b@&\"90\311\264P\2661\"b\322\201F\225\263\020N\213@\032\321BY\207\211J@'X\306uXH\001o\0224\016\033m\033\207uL\371}\361O\277xfR\220\300Q\377\253\274\326\352\266\330\326\r\024"
+	.ascii	"i\355\233\303\342)\314x\260\0270\327\005\323I5\307\327\270XK"
+	.ascii	"\003\027\032\252Y|\004S\320\247\324b \204\021\203\213p\007\001"
+	.ascii	"\325L\213x4\006\265\007"
+	.text
+	.section	.gnu.lto_schedulerCheckTask.121.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`m\005\215$"
+	.string	"\332D\370\016H\200\232U:;\f\35744\266c\307\221\026;\223\332V\177\311\335\323\006\215\253t'"
+	.string	"\2256kJ\033\262\243\r,\332R\321\347dR\270\226c\336\206\274\307\244\224PP0\376N\036\273\240Lq\361\261\242\255\244\021B\344N2\336"
+	.string	"\315"
+	.string	"\337"
+	.string	"\250eN\342[\371\225c\371\026\327\262\f\317\253u\317 Q\315*(\367\336!\255\243\337\246;\303\216\022\252\251\202\031#\267\264\274\310\2321\331\365\341YG\271\342\362B\311\320$\277\252\"\034e!\265\227\247\222\364*H'\200\273\024\304\206\005\365h\356\264\226\371U\267J\372U\215\007\270wJM\327\275K\t<A=\312\313\023H\217\252\037\220\036ef\246`!\211\327\037\246\242\033\f\312''+s\356]\356z\310\327\317TY\212\236mW\276LC\007c\217\260#\262\370\231\002 9\222W\177\006G\362[W\320\004G\224\225\361x\332TC:Y\224\206\324\361\363\204\320\354\"\207"
+	.ascii	"T\222c\r\271d\273\007\311t\346\356\275\337\272}B\032\255\225"
+	.ascii	"i\270\367\262=\"s\234ig\346\037\314\334\304\214f\b\277\343\204"
+	.ascii	"G\311\346\241\3611\"\324{/\006~\230\213!Q\302\204\211\364h\267"
+	.ascii	"\256\210\027\245s\231\364m\373Me\356\265B\275W\351G\276\227\177"
+	.ascii	"A\301?r\224S\254\260?\256H\217\n\350\367\275\222W\214a\314'F"
+	.ascii	"\233\207yi\264M\305\374\363\366\024\363\265\316\fl\226\027\330"
+	.ascii	",\347\236u\016\272Y6\360*?\320\231\347\237\266\\\340Y\316>\277"
+	.ascii	"\372\005\340,\343\332rO\217\345\333\315\262\315f\271v\263L\233"
+	.ascii	"Y\236\331,\2536\313\262\232\345\224f\031e\313\347\314r\253\226"
+	.ascii	"\255j\371\r\200\300`\241\311R\336\350\260\345\205\312c\347~\241"
+	.ascii	"^\224<\353g\376Z\177\226\237\314\357\222\221\334\002\345\\\337"
+	.ascii	"\302\\c\030\327\302\270.\\SRU0\230k\017M\353\333\2365-\311\305"
+	.ascii	"\030vE\326T6\355)\266\366c\267\375\261\343\230L\360\234\377Q"
+	.ascii	"\312\240\237\254\375\232\343\216\315GJ\255\035e\224\023\227\263"
+	.ascii	"@\367\364\323Q\032\244\366\0030\253\006\326@\0035\247\035\324"
+	.ascii	"\337\372}0\225K:M\246.r\256\r\364O\034'<\262\006\352\\\277\353"
+	.ascii	"\247\2234M)a\230K\214Q.\206\204@\354i\210\310\032\201\032)\007"
+	.ascii	"\373\245!\256VD\351\321\264%\024\271Z\247\034\r\321\005\376\231"
+	.ascii	"\023\033\324#5\322\243h\313\332hiJY]%\260\314\034:\330\037\177"
+	.ascii	"\372\234\003\346\344D\017Xf\017\037\354\217\005\032\235\003\306"
+	.ascii	"\344\313\330Ef/+(D\316a\352\323B\267\367\336b\177M\317n!XcK\266"
+	.ascii	"\016\363\311\274\314\312?\302 B\204h\031\023-URVQ\335>\035<\244"
+	.ascii	"\363\001\177\304\235Q\020\b\f\366\200\210\301\242\341I\324\363"
+	.ascii	"\r\t\371\200?\342l\350+\352!\t\021\205<\242\b_\217'$\002`\341"
+	.ascii	"+*\342\031\271\370\rgC\022>\340o\004\321\310'\024\306\350\335"
+	.ascii	"\210\206<\342\311=\235\320W\024\203\205o\2507\334\031\375x\300"
+	.ascii	"]O8\334\351\024p"
+	.string	"\360\205O\270#\006\203\302]m\251\364\363\366TP\377\013l\314\227R\033y\246\263\013\372F\265\016az\234\236\355Gfnq8k\221\nb\367^\fn\376f5\302+\222U\211\375qU\222\036\275\365\271\216;t\367i\033j&\351\205\025\306\224\352\351Z/\350o\251\265L\f\354\313\211\324iv\251M\3056\375y\251e*\331\240\366\274\024\327Ocg\320]\344\n\202\345\300\252\375\323\270\2465\363\252\\\235\330\0379\347\324E\236\005\\\250a,\202\030c\004)S\301\004#\222&I\007`\"\031\243\345\001\020hV$\316\001\201(DM\347\024'\302\213\314=C\353\377\211\204\347D\346#\305$\342\314\257\331\331f\353%\335\242\273\230a\210\223\343\332w\236VM\324!y\321g\261\306l\272\207\244\321O\332C\274J\221\304\375R\222{Q_\210\266\306q\"\030\265\327'0\221\"\036\2311@\r\304\210\022\\\315"
+	.string	"\222\005:\005a\027\021\254\241\020x\317Dz_]\332\232\274"
+	.ascii	"\355\007\370\264?\275FtOFB_\205)\r\3048o\315\301\215'\211\r@"
+	.ascii	"\212\346\364&\037I1\371gw\300\005\266\210\025W\226u;\203\324"
+	.ascii	"\264\346<\266\236\020$`x\372\215\275\023\231\352\367\nh68\251"
+	.text
+	.section	.gnu.lto_schedulerInit.122.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\367\007\365+"
+	.string	"\352L\214\020Ep\234J:U\003\326\300-\bh\230\235\355\t\2456fw\355\321\304\254\305\306\022\353I\204\250\253F2z`l.\264D`\373\216eq\213\035\315\324\004l\315\317\325K\246\374\266b\367\356\334(\033[\333dK\231d\356"
+	.string	"\335"
+	.string	"\004\001\274?\312[+oY\362R\312\333\315\313\314{\016=An\030/\026w\236]}|g]\251\005\355o\177\333\277\366\336=\034=\255\\H\323[\262G\356\335\332fp\235\245\241qs\236H\n\300\227|\266\r^\312\247\230_[.?\275\316\333(\223\326\306\315y\236\t^n\003\340\313\245\007\250/\351\205\352Ks\227\315\221EN\2434\264!\025\275\363<\237\232\310\320)\362\253\263\264\315\357\350"
+	.string	"\177\265\f\322fs\317vZV$\216h\244\361\235\036pZ\2543\304\353x S\020\257\260\377h\0011ej\220\306\300|\005\215C\256T\350x\305\356ct\204Q\005vi=\016\267\305\345\263\216\017\322\326\322\363\3611:\304\350\2048\3032w;\027\215B\246L\276\336w{Y66G4~\235\177\025\316\363\\&\032\275\276<\337]\273\335\305\260\373C\006\277\006\362\374\372j\357\265|\213\311\266?[\013PP\365e\257!\342\225]\t\360/Uw5p\340\023\313n=;9uGL{\267\203\007\"\336\037\250\273!D\360\211\264Q\350\325\t\361.\211\022(\340\324\t\233\306\002q\367\256\211)>q\227j4\215\345\356\376p\316\237\242\276\271\027\f\265\b\227\352VR"
+	.string	"\317\263\006\204}\225\307\255\330\237\275\\\026.\370\304\227{\027\365\345\373O\216`\366\326\262\270o\027)\3446\333\275\021Z[\335\266\220\335\r\031\242\376\366uj\372\332\227\351m\337%\346U\002\362&\375x\t\224\274\003*\257"
+	.string	"\312\213Ty\217*\257\021\345-\372\361\022\225\274\001*\357P\345\025\252\274"
+	.string	"(o\020\345\005\252\274?\224\327\247\362\366T^\236\312\033\254\274;\224W\207\362\002k\264\315>\243.\365\206Nz\033\233\333\032\023r\337F\340\245\3365w\230`|\342\336\355AV\222s\335I\2715 \275\002X(\305\303T\343\274\007\274k\212\231?\370D\001\335\310\244\032\022\237&\033\031\024\026\"\336Q#u\323\031\365Q/\025\265QS3\3039@.\307,\343\373`\232\305\250/\213\372a\316\254eq\037\221\307\211\001a\277\007\3024\002<\317\363gX\365%Q\277\213\2215\"\346"
+	.ascii	"m$\227l2\224\207\244\315\fu\275K2\021\302\223Jb\252\345\021\361"
+	.ascii	"\350\016\240\205\272\312\001\320\024\231$\013j\203\266&\250G"
+	.ascii	"\034\223ja@i\230\3744P\375\021\363I\232liPM\245\247}\372R\265"
+	.ascii	"\247[."
+	.string	"y\344!\323\204b!\342e\361\364O.\t\026\354}\230\327I91\325L5:\007\227\252;\035\354\237\231-(B\271\3574\275K\356\320\371\022\345D</:}u,\243\026\006\2343\247@\361\211\001'4\260\220a\342\252^\275\300\252\202\232z\201\025\305b\212J\305\224\317N1\260\242j\201u\202J\305\224\214\247\027+L\270x\232\262\222\361\304\200i\253`PY=]UUY=\005\221Yo!\013Dc\254\313j\241\251U\242HR\316N\233\355\317\021`\006\260*l9\202<\274S\027\227\002\231\372l\377\215*S\346\004\023\274\251\213\274u'\004b\262\220\321\241eS\037\356W\262\305\266\366\213\352\245\265\251\231\272\270\313Zw\352\f\235\364F\026\307e@\245\0063\271\n|=\252\225\242\272HH\026\346\305=8\255_\233\255\2027u+y\243c.H\250\210\325\252\232\324VC6V\361]0\315\222\332"
+	.ascii	"w\305\330\2132\215\020\350$\247\036\320\277K\346\325\355M\256"
+	.ascii	"\372\204\213&\227\322\335y\236\022\226\271\230h\026M\034fW\027"
+	.ascii	"\334\313%G>\2757e\233\355\203-d\177\216\364\206.\241\360\026"
+	.ascii	"\031\312\033\232\032\034\347\364<\3173\200\253\250a0&\031b\246"
+	.ascii	"DD&HR\220\2441\200\002\231\261\242n\020@\251hZ\220\264\006\351"
+	.ascii	"K\"\226)\310\234\030'\021\211e\n\0068q\274\241(m\312\264\355"
+	.ascii	"\004]A\315\202\223M\"\350a\352n\300{\034\232yZBF\205\237\222"
+	.ascii	"\227(\022\203\003\210\026\336\322\274\363\317\3050\370\260j\265"
+	.ascii	"!r\rb\241\376p~\367h\324\253Q\375\036\363B7/\214C`}+uC \321J"
+	.ascii	"\330G\020#\245\337\023.\001\260\367\324\343\253D\362\343\353"
+	.ascii	"\247%?\237:\364^\273F+\266+{.@jMn\363\374:\247\0353\307;\034"
+	.ascii	"%N\262\252-\317\247\b\337\350,}\347\032'M8Y\342\324\003\330\340"
+	.ascii	"h \202\232\001\347\241\203P\233\276p&\036\031\025\031=WSB,n}"
+	.ascii	"w\f!\303\316k\333yp\200\033 \354\275\353\201\317\013\263;N]\304"
+	.ascii	"\346\306Hlc6\334\007\334\267\307_\025\2700,\r2\340X<\226[\231"
+	.ascii	"\003\367m\177|\200\200<R\013h\214\347u\r\025\2206\300\262\212"
+	.ascii	"\233O\205\217d&jQ\003\370b\321\333\0048\3403\224L\033\343d\223"
+	.ascii	"\274D\300\326\232`\277\357\230k\0010:\350\350\302M\r\303<Z\376"
+	.ascii	"v\316\315\254\232\322\024^\202m1=C\005"
+	.text
+	.section	.gnu.lto_schedulerSetNextStateTime.124.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\365\007"
+	.string	"r\21788Po\322\001 [x%\266\222D\311\365\t\333\344\rL\366\2643SY\024\241\2605\324\332\341!'\220ZV`\243\254\224P\rA0\263\252\330{\211\357\366\354'\233\354\235R4\004b\240\333g[\330&\250\250\343\314S)\204\204\003}\310FS\004\372\204fVG\323S`-\202\326\271iZ\235\234o\037Q\326\270p\260N\261\3020\372'G)\371!\246 \301w\227>\t\273l\320P!\3318\301\226\375\231`\374\260\177\355\356:\242\354\257~xu<^\274\247bv1Z3\313\222,\"\034\333\207\366K\256\342\276*y\263\333\321\262\262\273\007F\320\\\022\\"
+	.string	"\273\274\036\200]\232\263a\376\245v`\344\302\"Efwg\0049w\310\3717\371\246\363L\207"
+	.string	"\n\273k\330y\031w\274m\003\333\t\266U\001\t"
+	.ascii	"i\331'cq\202g\030\027\312\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerGetNextStateTime.125.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\305\b"
+	.string	"\206\320;6@\217\322\001\t\214\037\273\204kX@\222\037\352\207\353u\222D\230\"\3421\345\266W\377\265\024\035\024\356\3766o8<V\007\356r1\316e\361\344\033\377\357M\244L)*"
+	.string	"+"
+	.string	"-"
+	.string	"\247\023\227\335\215\233\017\300\277\354\002\360OU\037=G\376G\276\340Z\251\240:\322\023\223\260\273NT\267q\353m\033\330\216\266[\002\036\366\263\325\224\355\364\323\264j:3}\030\240\312\350\276J\331\325\210\275\354\312C\371\260-\2625~\310ED\036)\\\224:\004\220\216\360\205\0013y\273\213\"\263\273\007\276\211\205'\303\n\301\277T"
+	.string	"\222\227\274\025\362Y\376\200\362\250?\037\004\377\256\004,\034\245\214\331-Rj\3268\\\007\342\323\320q\320<Q\342\201!\"j\234'r\n\274Mt\270X\261m\\\324\264\366\331j\352\351\246\244&\253>\375\t\206\271_0U5\016"
+	.ascii	"i\331'c:@\303no\212\026LIj\0133v\2052\256\241\332s!\317\036V"
+	.ascii	"\262`y\270VL\302$\003"
+	.text
+	.section	.gnu.lto_schedulerExecuteTask.126.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\b\001\205\r"
+	.string	"\206\031^D"
+	.string	"\223\223\016\270G\313\030\321+\003\3057\205\310\372\341/A<\345uXa{\027\362\252\244Z\035\255!\244G\271\262\004u\335\376\210\265\323\230\3669\337\367-\025"
+	.string	"\305\350\003\370\212\352R\227\271L\255\355-wJ\001K"
+	.string	"G"
+	.string	"H"
+	.string	"\034I\006R\267"
+	.ascii	"\025\242E\305c\327\273\016\234\200\3462^Ds\251%\316=*\344\374"
+	.ascii	"\253\036\241\244\3423u+\217\326\207k40c\003\025\322"
+	.string	"\261\304\004 D\300\270\352\320\245+A\270y\260\273\206\246\016\346\226\267Mb\233\202\375\t\001\335M|\273/\337\217\275!g\240x\352\267G\276\312 \266S\334\027f\277\201\007*f\265\353)\270\264\004\013^\2063\200\335\021\237\003\b\355\267\270\213\321=\225\017\330=\325\220\261\3531p\003\353\322\236e\333_q\026#\007Q]lG\r\321\240c\325cE\322R\334\335\215\022nT\252}\001\003\274\351*u\005v88\320P\025\215\324\002\035N\274\3301\223\203\005\372\260\275\022T\022\366\365\373\276\317z\262/\363o\356\3752>u\337\002\245x\361\020Z\311\374x8\240\220g\023a3\005\302\211\326\331D\264\222\371\361p6\320\3142\021&\340D\353pL\346\206M\224\251\00506\222M\024\221\311\254\200i\027\310\323\371\\X\246]#\b\034\2620\263k\013\205\262\013\304#=\256\236\256)\250\230\226\030\320\3474\001\025"
+	.ascii	"i\355\033\3034\3272\334Ms\240\025@\0028(j\213\3244\253\013\342"
+	.ascii	"Q\226\315\306\312G\311eb\210$\344\003s\005*\034\334\005\244\032"
+	.ascii	"\244J$\032\203\202\002"
+	.text
+	.section	.gnu.lto_scheduler.127.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`y/\275\316"
+	.ascii	"zDAGN\020\030Gm\215\001\032\006G\202\270\213\020\317}\221I<\244"
+	.ascii	"\251\351\246I\006\311\235\016\321Q\362D\037.\201!\255_\350\022"
+	.ascii	"e\033Q\344\212\250fr\177\342\270\006\300\306\322m\261\231\316"
+	.ascii	"\206\020\242\n\340\317\3554\334\330qC\371\366\254FdJ)\005Z\004"
+	.ascii	"\022\004}\004(\\\347\023-\327l\202\307\271\204\353L\302u.r\235"
+	.ascii	"\211\\\347\021\255\263\210\3269\004\217\363P\353\f\202\307Y\310"
+	.ascii	"\307\371C\3229\310u\006\352qV&\235=\270\316\035\\\347\037\327"
+	.ascii	"\331'\351\334\223tN\272\316\256\353\314\343:sH:oH:\357$\2355"
+	.ascii	"\270\316:Igd\3229'\351|L:\033]\3476\351\374\256\263\3638\267"
+	.ascii	"W9`\313\265\214\233\225(\017\310\366V-&\276{F.R\\\332\315\327"
+	.ascii	"\355\327\r\330\016m\247jo\266\277\335\205\335_\272\325\272\331"
+	.ascii	"\272\335\272\345\272\265to\351\256\353\276k\016\276\301;07\367"
+	.ascii	"\236K\331\257\304\252ofUd\3258\".p'\251\322\371\223=\n}\n\\\033"
+	.ascii	"2\210t!\376\344\026\243*\272\223J\032\326\247\274\t\365&-M\360"
+	.ascii	"}\337<\244\"{\224\277MI)%oO\325\013i[\202_\220YE>\"\241\306a"
+	.ascii	"\261\314q:\217\ng\366\276/\"\226w\360\n\251\0342\023r\033\362"
+	.ascii	"N!\322\215\246\220\267\275\222\tD3\243C\272!d\343\340\241\022"
+	.ascii	"*\032\013N\267\n\261l\304\266\262fj\314\270\352\320\204\341\366"
+	.ascii	"\260\304/\021\220;P\247\355\017\314\217\373\217J\3575\037w\037"
+	.ascii	"\357\220a\372\3500\274\023\365\267GE\363\301M\206w|\264\226\246"
+	.ascii	"k\02364"
+	.string	"\254\230\036\363\243\303\260\016.?\354\217\005t\236R\207\341\032\\d\314\232\0137\030\336\371\242\341+-\020\r\353\206Tb\336\221\241\2730\357\260\n\315\205u\242\332(\241\242\265\221Y\005\346\2356v\350\265n\353\267\316\322sM\327v\215\307;w@\206\210Y\271\"(\245\256\tm\tr\313S\373\312Q`%M,\013\251\245I\255\233H\270\216c\266\\\220\366\235\262\275W9_X\260h\330\025\330\220\375s\214\241\257\314vsj_\260\033V\344\304\336\227m\004d\033\223\336?G\266\247~\257\336\026\202\265\222E\360}\331r \333\330h\235\306l5(\242)\266W\232\363\205v\207\206@\033\371\005\262\215D\355\341\330\306\266\177\216md&3\233f\003{\207\254@y\276a\337\367u\361LX\006sxf\363\035\333q\035\323\361\026\236c-\234\205\3458\216\341\370\215\335\370\3121p\033\263A\360\200\r\007\032\250\301"
+	.string	"\215\005f(\220\200\214\0300^\270h\301b\005\002*R\034`"
+	.ascii	"\212\023&J\220(\"\032!\"\304\020\b\241\017A@J\017\035~|z\222"
+	.ascii	".\017\207\r;\032t\2209Gc\373\316\344\316\271\241\003\225F5\337"
+	.ascii	"\2015\333\ry5\361\252\316u%\250\315tk\315[\346\326\266\234\265"
+	.ascii	"\254)\275\232I\234\263\264BZ\355\t'\227\263\\\\W\2253\\W\363"
+	.ascii	"[\027\021g\267\"\312k+\024mO\270\340\034C{\304\353\013\332\334"
+	.ascii	"\326\252\200F\273E\342\325\034\342\314\326\301\353KHC\260\330"
+	.ascii	"\017,f\335F+D\025s\344\204\242; $\232\350\r\304\351\032q<\n\307"
+	.ascii	"\031\270j\032C^\315)\326\027@\354\031m\330\270\002\203k<\001"
+	.ascii	"5\206s.#M\307@\3230\372\254\266\274\btA\346\214\267\320s\026"
+	.ascii	"+\306\210q\004T\244\310#\263\n\343\007\214i\003\372\254\300\220"
+	.ascii	"Y\3319\212\366Gk\213\231\356\263\232\241]afJ\222>\254\363\023"
+	.ascii	"-\205\246M\264\036\370\276\324\370\324\226V\005U\314\221>\244"
+	.ascii	"\363\02297\3224\t-]\244e0\213\023%\277\250=\302\235kr.B\255%"
+	.ascii	"\302\223\363\020i=\204\326 \320\260\270\320\225\376p\326Ag}f"
+	.ascii	"\016tE\212+\275\256\242\264\007(\335\001\312\337\023\377\351"
+	.ascii	"\263\212\002\306\211\3734\351\2366D\031\275\262\356\263j\322"
+	.ascii	"\222\340Z2\327\201a\236\004k\267\225A\205\345\352>+\260v\003"
+	.ascii	"\234\247_\223YU\235\247\315\241\252\212\322}V\324\226\006\034"
+	.ascii	"A.\\\316!\347\006\fW]\275\301\273zg\2535l\221Y%q\23542+-G\026"
+	.ascii	"y]M;\347\351\307>\253i\203q\272\021\253[\036)UK\364\276\357\216"
+	.ascii	"t\312\277U!\210g\330`\272\250\317*\255\365P\025\005\332x\355"
+	.ascii	"Qi\323=\347\306\373\276\354P\351U\363\007\315|427\r\346\024/"
+	.ascii	"\002\306\343\235\024\225\236 \307\300\366)\221&mn\312\310\375"
+	.ascii	"\007\022\312\260\327\374\250$\177xf^\341jLio\t|\337\227\006;"
+	.ascii	"\232\2471\215p?i#3\261\230YY\307\240\377\360\037\024e\270O=3"
+	.ascii	"s\213\331\345\r\rz\032\021D\024\234\372(\356\354\373\024Pg\277"
+	.ascii	"\321\264\007D\351\025N\254y\006\324\343%\314\333\336!n\313\241"
+	.ascii	"\217|\237}\224chf\365\250\374\256r=S\346U\230\325%\314\257\257"
+	.ascii	"c\033\225\337V\\v\210<o\345(O#z\033\372O\372\255\344\243\r\246"
+	.ascii	"\233\032g\244nC\347=\267;\356\365}\004\352\330J|L\021\030\370"
+	.ascii	"\334\224\321\353fA\274\302=\016\177y\255\346[M^ \341\331\236"
+	.ascii	"_\025\321l\203\206\256>\353t\365]\372Q\326\320i\317\255\216\327"
+	.ascii	"Gy\307\303X\207\367\360\363>\337\341\333)&\305\372\323\363>\377"
+	.ascii	"s\315\022\247\241\3475\2741\312o\355*F\347\255\334\003"
+	.string	"\245\347\233\213+\356\f\231|'\r%t?\311\363\034\336\375vR\233aOL\230e<;\317\341}\256r_\236Y\251\3434{$\347\255\274\341w\036\306\022\277\257\253\230)\207\303$l\303\353X\235\354|#\341rC\354\343[y\205s\261\256\355\303G\341TT\353\352GG8\027\325\332f\373\020N\305(]\037\255\276\206/((\3141\r)\006\375\224\030\017\033\373\315\246\325\330\376\013\221\257\223\363\377\310?\256q\2225\033\352x\374\234\317\361\342\244\032\217\357\343\272F\306y\245\351\213\033\306\022\301\332\267\262y\343/]\365\376\215F\261-\303+ \034!\233\017*|f;\255\005\277\005\273-\263\"J\343\340\304\332\367o\265\177/Nj\323\027\371\277\375~f\253\256\004J\nsl\354\330\306\177\035v.\357zbNa\2261\313\276\257l\025\236\231pf\346\031\023K\332{`\233\264\275\"\367>\340\310\314\\\213"
+	.string	"\3137\230\376\331k\203eo*\250\f\366\356\331\350\330\177\200+\232)\207\303H\214\270\237\360\0048\274\2418\216m\354\177\251\236\032j\332T\312\027y\310\231sd\340\rm\263g\001w\250\004Q\260\371Q\314lM\177\353\\\024\021\213\377\005f\037\203\362\304I\023\2276{\030\030\023\030\254/|\271\327\022%Uj\027\327\226#q,o6\373\021\227z\221!\3766\273\220\244\263Oe\261\207\206n\232P\220\315\0325i\234\252\271\317"
+	.ascii	"\376\225\341k\300\346\326\0333C^\373\265_s\337\325\315u]s\313"
+	.ascii	"5_s\273\265\261%\235{M-\255\27747\226\263\276kn\263.ln/%\255"
+	.ascii	"\326\334Uj\2635w\027W\2735\367V\222\326\232f!i-\315\215\325["
+	.ascii	"\232\373\210\221+\037\347\226ZU\025!\362\301\271]\210B\207\004"
+	.ascii	"9\267\220 \347~\272\316\355T:7U\217sO\3658wS\351\334R@\316\035"
+	.ascii	"\245t\3567\351\314t\235\227\2563\224\353\254\200\244\363S\322"
+	.string	"\271\005\327\331\311uf\301u\016\222t^!\351\334\224tfJ:\003\001r^j\235UH:\247\320\343\254\004\344\234\004\344\374\243uF\301u\366\341:'"
+	.string	"\310\031\t\310\371\204\326\331\004\036g\004\3608\037\3618\367p\235\215x\234y$\235\r\340:\227\340\320f\022\\\347\002\270\316\004p\235\007\320:\217"
+	.string	"\344,\202\353,"
+	.string	"\3279"
+	.string	"\2563"
+	.string	"\\\347\020\\\347\035Ig\020\\g\035\256\363\007\016m\366\300u\356\300u\346@\351\274\201\322Y\003\245s\006Jg\f\224\3169\222\316\027$\235-p\235+P:\343P:S\320\301y\202\037g\t\\\347\b\\\347\033\2563\004\256\363\003\256\263\r\327\331\001\327\271\201\244s\r\327\231\001\327\231\206\353\274\200\353<\303uV\200\3079\001\245\263\f\245s\f\2453\f\245\363\013\245\263\213\244s\213\2443\013\327y\205\322\031\001\017\316*:8\247\370q>\200\307\331\200\244sG\314\262"
+	.string	"|\223Q\315\234\301\260\013\364r\221\023e(\345*\006"
+	.string	"\357GB\370\017\036"
+	.string	"o\374sRw\274\216\017\341\033\204\337\361R\240\2300\307@x(O&0u|\033R\311 N;\370\017>\007\013'NN\263\227#\007\337\301\013\255\t\373\260&\016\336\247\332\370\206\252wV\246z\347\326\342\255\\\277\201\3363\331\340\227\250cXh\360\326\f^\003\f>\307g\200\301\013\225A\263\370\314\262(\"V]\221\343s\242\n\261\344\370/'\344P\340\005\237\343\215^\236Y\013.x\020\277\304\002,\203\205T\276\336_\250\340\353\033q\361\253M-\350*\370\276B]"
+	.ascii	"\242\032\347q\355\251!\360\326\256\3036\242Q\273\230\275i\001"
+	.ascii	"\367~\251\300\361[\024<\216?\216qR\233O\301\367k-\341,\351&\370"
+	.ascii	"\206\373,\021$\370&\244\332\235\251=\226\023\032\265\016\373"
+	.ascii	"\346\372F\232\372\216Zw6D\352$\261\273\312\231\351\220\267A\347"
+	.ascii	"4\254r\342B\336\243\332\002.T:\304\b\236\210/\371\033\037A\024"
+	.ascii	"\312\215\027A\2475\205`\210\224\007\336\201\207\340\217"
+	.string	"\2126\276\201\177\340\205\n\035x\033\317&)\3132\007\276\017\303\2465\276\201\261\247Z\266\325\370N\244nATc\340\2334~\3063\3609c\026\240\361B\212N\261f\317\370\005\276\235\331\177?\252i\312\262\254\354\330\306\031\355\332\330\233=j\332\264\371^\201\367%\337Y\005\276\023\333\247`\340T\367\232JC\2677)\022\370\316\366\030\341l\231\300\267lp\272\366\250\336\320\336\262\016x\353'*B\t\261\035\343e\300\370\027\037\343\333I\226\342a\274P\231\3006\317\354\2134\207\343\204\024\021h,\204\022J9\035]\374\213\026\357\342\217^X\264\370\241B\347\2255?\\\266\261h\323\006\337\210Q\323\324\252\357JV|\363\275W\277\343\\\275\260iF\340\212?#\342\204\353b\300[\335L#\360\335\367\346n\234\020\370\026\250o\315\345\032M\203\"\204\243\212o\2628\027\fA\305\367\224\352\206\350O\310\250\t;\341o"
+	.string	"\333\224\230xk/\347\216)\262\370\232\345\034\362}\247f\260\253aFY\322\211plc\2127\021\246&e\347hD@.\2650\243\220\007|\037\366\t\2746\211\3244\265\217\373B%-\361V66!\342%\336\322K\013]\207f\203}\002M\021/eXz\311\211j\023(\325\320\0064\323,X\221{\332\025q;\035\035\206\217:\221\263\365\3323\256\310\331\332\304G\271I\354\360\346\013\263\234!\360\320\215\217\0268hEoe\003~\311\317h\214\001_\243\353\020\221\357{\260\177\344\016\277\320"
+	.ascii	"\203#H\324\t\260%\322\215\240>\212\357+W1'\036\305\037\327<\263"
+	.ascii	"\036\270\367\323\221y\311\267,\343\r=\261\366LSr\342-qN\304P"
+	.ascii	"\213\354\256\326J\226g\234s?\035\233\372Qn\207\032\311;\322\257"
+	.ascii	"\315\202\025\265\247\235g\225\320+QB\332\006\214\2326\365\256"
+	.ascii	"w*\365\275\353\273\313\230o<,\202!\336\332\3653\344\360\001\252"
+	.ascii	"\241\246\r\221\3700\355\032(\241\024\211o\261n\266\376\200L5"
+	.ascii	"8\263L\343rn\262\366\232 \336\nC\\V\221\017]\367\334*\221hX\003"
+	.ascii	"+B\266\304M\031\275\265\317)|f\211\276\350\273\355{LW@\306u&"
+	.ascii	"\013\020N,\2073/\333,\007\275\241EO\324t<\347\262t\263,\\\036"
+	.ascii	".\017\217m$z\035\\~\210\323\t\334\271\230\227q\226\212\336P."
+	.ascii	"\022G\365Q\354[\357\\#\276\345\336\267\276\363\272-\373\033d"
+	.ascii	"^.z]\023\317\f\3666\t\230Q\355\005\354}\337\021\317sF\255\310"
+	.ascii	"sD\364\274=\263\366\020\005\247\204\202\332\355\273\017h\206"
+	.ascii	"\031\272NL\363C\210\347\346s\013\n\361\335\327\206x#\033\341"
+	.ascii	"\340\336\324G\001\275\225Q\304a\351y\350\2717\021\207\025\305"
+	.ascii	"\007k\2509$\210(\250\354\3202|\377\375\370\265\373\256\365\276"
+	.ascii	"\357\276\347\222p-\340\n\b\347\001\304s\373\311\360\306\217\342"
+	.ascii	",5`\035\336\312l\r\342\373\257\310\037D?yb\335\265Q)U~z\274\b"
+	.ascii	"\022[\006\366\264Kr7\035[\357\243\236\325B\337^W\033O\346\020"
+	.ascii	"o\250\320\037\211\303bC\024\364\251\341-\367\215\345\271\001"
+	.ascii	"\231D\230U\336P/\362\001|B\013 ( 15\t\361\t-\216~ 1\271HR\372"
+	.ascii	"\361C\311\350C\217$\034=\216\230x\244\200\304\224\304\303\247"
+	.ascii	"\307\321\022R\223\nG:\224<Jp\247%\246$\035\245%'\023\220K<\230"
+	.ascii	"@\350\300\224t\264\264\324d\304!\210R\222\016\220\020\216~ \355"
+	.ascii	"HRBbj2:b\001\207\017 <\230~681!-)!-y`\204\364\203G\222\023\005"
+	.ascii	">\200\360\330\321\343\210\311\350\b\205#  \230"
+	.string	"\216LX\342\261\203\211\205\243\244$\220#\024\214\234&0!\t\351HG\nJJ\032\004\261Q\213\245#\024\232z\034\235`\004\304E\022\022\217\037.\214\226\200\270hQ\304J)\034-\271`RRZr\261\303&\325\377\002\353xM\331\223\372&\267\221\347\372\274\356\253o#m\222\243\253\337\001\266\345\314\003i\213\244\2352\2453\332\2546\346\214\201\022JY}K\253\254\246\337U\017\242\220H\0271\373&\322\321o\027>H1\n\225Z\265\253u\345\256\203hk\240\262\006}\332m\320n\236\333\021\323\217jh\350\257\320^A\005\301\334\0209\330\340\255C\336\252I\310\367\220o\247\236\024^\233\231\242\265\305\314\024\255\273\367\225*\321\317o!\355\374~~\316\233SP\312\027\303Z\"M\316o\241\252\210\330\346]Ui@\365-\365<\206M\365\"\350\236\331\251\217\206X\003%\354\251\262VH\363\373\315\031\276bI\311"
+	.ascii	"\n\361\330R\377\206P\207-\025\024b\333l\247\240\342@)B-zC\241"
+	.ascii	"\026\245\376\330\245\232x\246\326\316&z\030\234\351\216zwlqJ"
+	.ascii	"\033\325\276>\366\035\365\312\346b\\\177\324\005\276\034\330"
+	.ascii	"\356\367[\355\252\227uz\275j\250\245v\0013q\371L\250W\300/\277"
+	.ascii	"\235bp\242\240\236^\001\377\363\245\270\370\314\202\205e\261"
+	.ascii	"\340\255\374\364L\337l\260O\337f\3256g\355\235\f\322\n\336\320"
+	.ascii	"\351[`\341\203\274\323\277yj2\313Xx\235\246\017\362\312/E\300"
+	.ascii	"g\026\251xd\006\034+|\323w\037!\325\n\2573\025l\372\021k\302"
+	.ascii	"L{\340\204Y\241\340\255\314\364@\336\315<\033\250's\214\351\037"
+	.ascii	"\bs\362@\336\270\306\331:K`\370\232\300\311\033\333"
+	.ascii	"\262i$x+{\331\247aV\2070\277\250\325?\2637\0138<\022\301[\371"
+	.ascii	"\227\276\311\002\001\227\376Tx\235%\331\027\250i7Z\360\024\210"
+	.ascii	",\253\210\224>\205\244Wz/\375\343\223\372\370~\220A\341\233\260"
+	.ascii	"\332\005\002\037?"
+	.string	"\346\211E\240\230\247c\002\336\307\007\275=\3710O\310\377\362`\226R#K,\254c\033\023\360,\316p9\341\221\276\235b\272\310p\302\367\343\005\311B2\341[\260jw6mR\226\345\201\2672\002\276\373\354\214\264\020\360K\325:\304\351\261K\032#6\246\264C\361,Uf\240P\237\274\023\331\261\252\275\340\300\3217\031\335\321\t\274D5N<\3706|o\362^e\370\037\230\355\332k6\260\344>\326\265\254\006f\265\256H\345\325\230A\302\207x\016Ri4\341{\320\343\233\354\263\364\370\021\252o\210a\337Y\337n@\370\302~\341c\227\206\275_\365\r\245\226D9\006\214\276\t\215r\256]\2464\300\276\327\030\300\227\330\013\2745\r\t\275\346\273\314{\264I\370\302\332\271O0\261\031<\276\275\036\216\307\353\250\272\235\235y\003|\257q3@\212\266C,X\032&\357B\322\374\313\305),\341\373\314\373\232g\266"
+	.string	"%\374\021\033g\360\2334\001\276"
+	.string	"lO\\\004xw\032\236\211(r\267\247\200\214N\362>\346c\377m\207N\334\372j=\330m\036\365M\023P\013\341"
+	.string	"\336\255\337n\006\360=\330>\3308x\t\274\265\204\326s.\206#y&\321\200\337^[\317$\034\206o\256\217r\214\326znI\230\370N\362\321\021\376\037\013\324\225 Hn$\343\225\256\354\025p.Iw\373\276\357+\343\255\\%.\f\033\030\216\305\365\275\365Q\237\352f\362\f\223\2051\302sk\242\223|k\275u{\275#\3716l\244\231/2m\234T\232\276\350W1\316l8\326w\036\025\220K\233+!\214\267r\3736\2139\212\360\034\006\r\247\360WYZ\221\374T\276l\271d\371\265\264Z\217m\034\341Ex\237\246\2326\316*A\200o\244/\310\264"
+	.string	"^\006\236\241\224\353\231\234~:\006\340\005\360\375\2346\307\002\204\016\250\343QD\371T\246\250i\305\324\214\314h\222dX\003\223\024@`xX8\237\314\242\357\001\023"
+	.string	"R\214\023\351\246\205P\325\210\210$I\352Qh\f\rn\236@0S'c\201\347"
+	.string	"\262\231\220\202\001e\036\200\320~+(2]\372Q\024%\250\314QU\016\246\016M\037;\345\276\220\313r\342\027\031 H8P\020\231\375L\376\262'D\357\360M\324\331\311$\031D\031\256\310s\023\254\005\257\351"
+	.string	"\3168R\340M&Ud\004\260%\331\2237\352@\323\203\243\017lb\310\177\370\2431 N\273\023N\310\241\335\327\212\206L\016|"
+	.string	"\317ClX\302\177\242|S\231Yc\002\215\241\326\257\215Fe\0256\bF\330tNC\323X\301\323o\330\316\207v\002\037\265\331q_\021\330\203_@\366I\377B\365\216X\017\324\224\013\204k\332\005\277,\223'\024,\241)\234I\313\356~\233\001a\356\214/)\363\277\224\024Tp\320Z\021\327<\355w\362\353\264)N\017\243m\360\226\243\221-\306\007\314\024\260\307\376\026\250\026~\222J&n\220M\017\213\265T\246(\335\267\206bG"
+	.string	"\362\0163G0\203\227\r\365\232%#\0046\034\313H9\337\341\t\365\003w\256\210\302g\037\266\245\236%\006wB,\364\303\245*\211j=E\370\\\236\364P?C\b\210\215\236\236~\016\227\004\214\376tJ.\3365\253&\0256\326jA!\034<b\235\340@C\026\201_\037|\r\0266\b\367B-\254\336^\310\263\312\3229\223 .\331/W\005\314\016Z2\304\361\276\246R!3\262\\\036\232h\037\013\271\026\2422@A\215\326\\0!\205\367\376\013M'\306\033\245}\335r(\364\034M\260ht\271\247\353\246'}\226\315N\224d\300\217]\324\371h\342\"\222\205!)\3502s\364D\227\312\342\271\3232\350\313-\201\200U\257j\262GRo\032\362"
+	.string	"\331E&J\b\220RGla\001\346-"
+	.string	"\202\210\216M\227\035K\334\272\302B\271\334<\3214\220b\364_J\232#B)WQ{j\306\357;h\307\235\213\250O\017"
+	.string	"\332m\005\205[\262\377\361\264s\314\3170K\f^\226o[\002y\363\365\237\0205\254\373\004!\204\210\025\013W\217\023\004R\370\006\323Ec{\306\261\215\317B3\236_\206\323l\274\225\307\242\360\364\206\325k\002\020\311=\263\307iq\376>|.\260B\250\213<vw\024\374wtsE\365\221\323\306\033:\212\006(\306c\266`_\216K\310q\225%\332\263\366\321\025\210T\325!\237\376\331)\373\226*\332\0257\202*\003\017\204\334\373\003"
+	.string	"\374\270Q\301\353F\365\377q\213\343\313\231\206\032\tz\254\004h\272k>I\214\340EX\\0\3409"
+	.string	"\304\232n\207-\250\003\262{\336\020a\365\225\215v\222\267\321\320\333\202:\231\264:@\313<F\261\256\220\306\f\363\377\004\230\b\250\242D`\352\256f\026\334z\201\355\376)0B\235\002e\307#\030\t\277\322\324'\322\377\217\224+\302\213\021:P\341E2D`\030\302I\320wEo\331\340\235=\b\260!U\311\300w\335\f\370S\330$\312\370/\320\262,(\341\313\031\345\223\004\202\235\314\250\322ciu\377-\206\275\0252\343\013\030\236\200\356\266\003H\223\024\213\342\242\204e\216\202\374!\222\306\005\330\243+o8\033t\357\320"
+	.ascii	"9\270m\240\217\314\004/\350&\226\274Jge\356|\340\314\002\304"
+	.ascii	"\200#\320\316\206G\267\t\261pzu\340A)\213\324\360O\314`h\251"
+	.ascii	"\345<\031AJ[IN\252\373\325J\255\001i\210\312\022\300\350\225"
+	.ascii	"\025\252\315\367\035\030\323\374\242,\206\fI\031\312t{\304T$"
+	.ascii	"\310\3361\020\225%\335\021F\310Z%\273\326&eW$y_\304l3\240\326"
+	.ascii	".{\233RM\344\266^\335\200\r\262y\312%\374\200\205\223J\303[\347"
+	.ascii	"\333\350EOgj\246om\263h\217\252O\225\250\240P\r\b\237\202\022"
+	.ascii	"\035\327\317\304\266mr$\224\250}C\025:\013\367\212\200\331[\370"
+	.ascii	"1i\336\266'$\302d\365Eo\257\311\217\b\250\215\346I\303\2304\023"
+	.ascii	"\212\002\005n\246\306|F\343\2543\204\377gAn/\275\221O\314\345"
+	.ascii	"\037\322\245\231e\3676\n\306O\315\031\222\210;\333\342+\203\347"
+	.ascii	"\263-(q\016\207J1\205u\250\037\265\267\200T\203YTD\355F\006p"
+	.ascii	"%\254{\0075\002\356\264\357?\237\005Hp\2243\236\375\212\223\325"
+	.ascii	"\230\024Nq\216\262\033%\034g\264\337\275/\264-\341,\266\226\202"
+	.ascii	"\313\2169\276\341*\031\215\355\n\266\020\032\037b-\002\235\242"
+	.ascii	"\256N\021%\314\372F\370Vz\260\363\345q\311\251?\035\251[5>\342"
+	.ascii	"\331\331\333O\344\024\253\354\036\377\313\242\363U\352[\006-"
+	.ascii	"\241LdJo+\035V\215\373\004\017\253\330\036_\323\b\b\301f\021"
+	.ascii	"\361\354S\217%\365\002\213\004\277};\021<Z\347!T\224\327T\216"
+	.ascii	"\2235\247\033\271\036\026\030\336,=\227[a\2303\355=4\205)\220"
+	.ascii	"\225\333\327\254(0\215\036\234,\025\346\256\2405\205\217\310"
+	.ascii	"6\213\302p\205\273#\325.\224N#\206\004CdkT!\272C\263\353\303"
+	.ascii	"\216\255\336\365\200NRr7W*\260d8\001\265\204\235\033\031\363"
+	.ascii	"\005\2166\365\021\335\353\303k}\256x-\320)\017\210\347\324\335"
+	.ascii	"[\340\265"
+	.string	"\226g\342\325\361"
+	.string	"\332q\0019\367Px"
+	.string	"\035M\244\267k\224\274\254mU:d\343\2710gh`.rDl:B\207\n\227?\301\222\304\b\316\2731\246\276\257\027R\205\357\307\3572\20502G\334\216\260R\200Nq\365\021\343\020\226\006J\\\376m\247\333 \374a\265{\263\276\276\021q\004\266D\223\254\373\215k \263H\204;\342f\300\\d\017\301u\212\334\020\256\032\310c\217\326\317"
+	.string	"\231s\\\330;\347\027s\034`Wr\025\277Y\372\3105\213\307M\241\310\241\247Oe\034x5@yF\306\362(\r\331p\020\2663\375p\205\327\365j\006\235G\331\016\235\216\317W\362^\177\355\243\302\354\301S#\264\243%@\262'\343\323\020\222\005\253Y\266M\206\330\257Pn\331\025\302\244\241U\337\241m\260?\035\333\341\354\255O\006\f\355N\360\231\241\225\3366\206^\231\303z\346U\002\f\2622\t\355vR\023n,u\314421WQ\224be\321ab\215Z\315\365\006\t\244[\220\206\225\005\276KyRaz\272\002\252's\260\277nNTx\357\360\027C[\341vYV\017\033\202\340\234\353y\212$\323\247\234w\307}\213\301\020a\354\270\3071\235l\221\002\344Zy\352\307,\306\207\030\226\310"
+	.ascii	"Cn8\262\005S\22249\321iq\315R(\274:\265\374^\3504o\315$D \202"
+	.ascii	"^\240\273\260T\301\351\321\217\002>\250\335\243^\237\b@K\020"
+	.ascii	"\260\030g\004\340\323\336\257\240n\355S\025\r\370\236*#\376\""
+	.ascii	"\322I\311\200\033-\263K^\0164\227\n\212\267\0208f\333\277@AT"
+	.ascii	"\235\344\317z\032\303O\222\227\021\265?\267\004\274AonC\366x"
+	.ascii	"iR\302i_\225\364^>{<I\177\300\034\362\006\202\331\330\253\242"
+	.ascii	"]\232\367!)^\206O\037\376\236j\013^\035*FQ\230\347&\037\253\023"
+	.ascii	"\302\216\351\306\220\252%\002\022\235J\326\363M\3411\243-yqh"
+	.ascii	"\"\206\037/\034\273E+\252f\202A\255GU\210~\265\r\313\274\202"
+	.ascii	"\035\254c\377U\324!@\330\275\2153l\225\267!)\252E\315\201\034"
+	.ascii	"\333\322\240+\272\204^\277\303R\243\023\252,\274\215\n\375XI"
+	.ascii	"\247\342~\311)\214\301\307\366O\023j8w\004\343\246\264%\256Z"
+	.ascii	"{\022\263$\272\354\036\253\233}}\260\003\017\335"
+	.text
+	.section	.gnu.lto_schedulerEnableGyro.128.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \364}\006"
+	.string	"\362\313,2PM\324\001\244\034{K`\304\034-\332\355oi\347\267\250\201`s\373;\265TC\363\330\211=D\257\0013f \252\252\203\244\253\033\035\365\311\376{\247\024~\234\n)<\034@\b\217D\031\022\f\026\350S%\352\b8j\200*u\210\242J\033o/\271\202\212O\005\345\222\021\376'\306\007y\310\344w\030\202\212\307>}\212\371\234\233\b\210\321\201W\fm\317\212R\303\276e%g\313gt\031\305\366\t\223\335,\\\331o\226x\330~\343\312>\271\307\261\001$\027\022#)\273K\345\306\253\307\312\377\307\0010\315z\274\020\354\256#\246m\267\274\355\001\333\324\266E\t"
+	.ascii	"i\3317c\361\2003\344\305\027\272\206\323\205\340/\343\202K\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_getAverageSystemLoadPercent.129.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375 \374\275\006"
+	.string	"\002M/3`O\322\001\024\002\303\001\256[\016o>\2013S\264\r\241\354&\215\346'\304n{\374q\001\304b%\004\b\"\036Q\350\346\276r\200:a7\310nR\246\024\2362\216z\240`\240\032&M\213pX\200h\223\323\264\314\201+\t\312\265\211\252rM\212{\005\245\032\\ja\237\344\361\371\037\256\330\344\341\231\277\211\316R\0032\256\f\331\321J\335\260\177\331\335\265\202l\247S\t<V>\207&\273\030\241\226Ua( \2669\266\344\207\\\204\343\207\351\\\026\346\244\343\242\204e76\201\027Dg\371\201\350L9\376\236\317\377\310\025:0\005z\254'@\302\356:\241\347s\353m#\330n\2665\002\b"
+	.ascii	"i\331'c1\2013\202\342P\342\032\235\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_schedulerGetCycleTimeMultiplier.130.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"u\013"
+	.string	"fVOB \215(\035\007\004\026\321\024\252h\215\031\322rf\2547\244\326W=\006\207\300\240\177\200i\375m\313\375\343\205.5\212\207{\250$9JI\b\201P\261\024\334\t9=\245xp\245\341T\204\354\275\245L);"
+	.string	":"
+	.string	"?"
+	.string	"\266;\333\342Cx\204\316\326"
+	.string	"S\013P\030\033\032\224T#\346\234\031\346\027\362\021\276B>\256\202w\327\316\277\204c!V\336\347\231B\327\313c\316i\365L\247{o[\303vf\177\013\252\337\2206\312G\357}o\340\200\200\r\331\251\220n\002\373p.\002;\252/Q\215\255\372\212j\t\325\021\252\341\252W\325z\365',\034\f8\335\0231'\201\217\304\004\0219<\b\217\327\276\003\253@\\\271_\221Z\024\n\327\336hz/.f\027\256~(\225\330\256\022\261\260\302\001\311\307\335_``\223\274\002\b\233sr\370\024"
+	.string	"t0\324\243\037@>\352v\260&\210\3643\026\3262\334V\242\022\262\215h\237\314\204\263\351d\032\367\3112\031\366\234l\\\226\342\361p\231%5o_\026#\332\221\261\225{\331\223<\214\364\363\265\330\236\324:\206g\370\360Q\006\321\350\275G_#\003\022"
+	.ascii	"i\331'\323\"\f\253m\221q\302\345\227\305I\230\242\203\345`\020"
+	.ascii	"\220\307R{*\3555\236Y\305\205\261#f{\013\226\211k\345%L2"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.169.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`[\002=\022"
+	.string	"\346\240rG\320\224M:\311p\231q\323\303\256\001H\324\030\351_\005\r\017\2173HJ\024COe \357\243\t\3676#4\016\214\350\307b]\033f\332\326-)%\002\b\f\201Y\262\\\330\272v\017(\364\265R=\321d\023)S\nY"
+	.string	"a"
+	.string	"\\"
+	.string	"B\b\036\275\240{<m\017mz\264\214\357\270>\243\346\373Af\002{AS\332\r\017<:A\367\350\360\003\270\307\356\002\270\307\307\260\335\222\331e\013y\330bO\023\202\315\214\354\256\367\250,\356\272\346\346\362m\256'8#\236\001\276\225\250\354\256;\022w\274m\005\266#\330Y\024/\372\207\376\331\377\343\337\270\220Ot\243\242V\3158N/"
+	.ascii	"\373Ra\242\006a\210\006\372\364\n\027G\266\2734\360+b\017\242"
+	.ascii	"H\022\222\322\356\256\234\307\367yZ\276\215\003=\310\246\260"
+	.ascii	"\365\343\003\356\346\003\332d7E\220\332\3566\350\036g\255\367"
+	.ascii	"\320\344\312\336\224\250i\332\247\361\032\256\367\320\\\326\021"
+	.ascii	"\321\002\347\001\356\340\360\315p\217\252\377\001\304\276p\035"
+	.ascii	"3\335\3562\360stx\361u\036\375\032\3561\365G.vn2\211O2o\200\263"
+	.ascii	"aT\371\330\365AG\361"
+	.string	"91\304\307KmRs\254\333\267\325\0256\227\346J\322\261$\275qi\215\351\314\364M\004\034\034\355\206HrdQD#\030\007z\250\226\264\320\222\254\t.\252\227\325'\001\374bL.\017\270\f,\224\314\346T\312\352\3230\343\362aH\261\274\230\027\024\214\227Z\261\274\224\002Vm\370V\236\214J\265\362L\266\363*7\352\301\252\232c\233S\277\307\221(\370:\256\300\222\217\261$\305\210D\345T\221\300\226PrS\273\005\225\217E=\351\246q\006[J\0058 \240\002!*\263\003p8-\373=\007&\021\020\025Jk\323\305\2054\306\r\316P(\232k\032D\036\310\363\310\006\177jd\356\346\260Al3hM\031\331\265\270V\360\017|\354\030N\264\3462#\006XP}<\004\314\033l\230f\332\255\345S\310\032Ln\220\034\256*q\004Q\210\313\271\b\305\f\032\223j\262!\240B\030@\270\242\262\320\226\262\331"
+	.ascii	"\270\275\272Q\022\375.3\006"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.170.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\271\002\r\026"
+	.string	"\326\351\221I\320\224Qc\330F1\230\302\266.!+t\2052"
+	.string	"c\357B\205N\022\t\017\031\013#s\306\225\322\354\360O\315\200\006\247x\315@\013\315(\336\f\230\224Q\332\351\2038f\177\305@\"\t\016W\252\224m\233\335{K)eJ\001\201"
+	.string	"z"
+	.string	"x"
+	.ascii	"\266\036E\274\265\317\302\266m\347\233M\344e\211\373\032L~\200"
+	.ascii	"J\356\275\255[J\342\267\253\310Q\264\225\316\325\315?\360-J\222"
+	.ascii	"\344x:W\261\220c\022\007#GA\037>V\002@\202+Z@\030A\261x?S\254"
+	.ascii	")\272\024\271\377\330\r\325\004El \361\231v\346xB\257+\236\320"
+	.ascii	"i]\341!\3749\341\341\252\201\236\210%\217\372\004\342\361\314"
+	.ascii	"\031\340\2531\302\275\327\337!\272Y\267\335\263-\301\2362\002"
+	.ascii	"\377\211\200\003=\356\325\r\231\334\"{#\351P\277}\177\306e\370"
+	.ascii	"QfA\331\376T\233*\345\r\332\371N\247q\373S\355\327g\247\312\241"
+	.ascii	"\030\026\271\267Tpk\b%\t\274\017\264\331,\226\353|\223_`l\207"
+	.ascii	"\201\363\362\352\352\264_`n\207\201\243\362#R-v8 o=\347K\333"
+	.ascii	"_\344\324\362\362v\236\323\276\213\377n\177\221c\325\275G?\251"
+	.ascii	"{\313\005\267f@\336\256<E|\343\214\030L?\035=:\025\"\365\031"
+	.ascii	"\300\211J)5\342\243\t\235\324R \343\210\225\016h1\302R\337\245"
+	.ascii	"n\243\346#9\203\314|\356\326\227\021o)}`bhg\016M?{\202\227\251"
+	.ascii	"\256\346\251]\023\233\317M\372%E8\252c\372O\031\r\235(\3659\345"
+	.ascii	"9\342\351\243>\247\226\206MCpsjR\237\351\352\365\322\236=N\217"
+	.ascii	"\342\264h\247\355\233\376j\247\251\235\236/\03733\027\255\306"
+	.ascii	"\300h0\270l`c\314\204\231\231\213&\372\345\"\203\321\324b`\032"
+	.ascii	"^\263\226\215\214\253\246\365\222\315Z.,\216m\200\311Z\264XL"
+	.ascii	"\326b\331\236\257\227\366l\237\f\206\020\356P\036\025\205\002"
+	.ascii	"\036\2048\252\343D#\310\023\2112-\265+X\230\317\371$\330A\270"
+	.ascii	"\244D\2644R\237o\304\221^\311\276\360\0357:d.\037i&\336\216\024"
+	.ascii	"\201\220\237\375z\216\031y\357m\340\343\240\301|\244\232x+\322"
+	.ascii	"3 P\002!\312\256\016\350\334B-\331\343\227\215X\023\261\335\361"
+	.ascii	"+0\rm\225q<\017.j\217r\220\305v\016\262\360\335N:\022\277\355"
+	.ascii	"\236\271q\351\361&=gb\033L^\031\341\031\023\274\031\346\r\301"
+	.ascii	".~\037 \214\301!\244\367\"\020\233\\\304\320\002\236\265X\340"
+	.ascii	"\225\311\223\366\231\265\300r^\272\254A\336\363\372qX4\204\203"
+	.ascii	"S\315\326^\360\270\235\362\2007X;\363"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.part.0.171.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\315\n"
+	.string	"\026\225I?0\211*\035\204\007\003L4\324b\230\177\001G'\352tdu\342\233\255l\304+.8kB\037\243]\332\201\310\204\347&\335\375\317\210 \264\344\325\017b'\374\321LM\023\001E>\331[\312\224\0029"
+	.string	"8"
+	.string	"4"
+	.string	"\036\374\016\234$\254\002#0\n\273\273=F\334!{\204o\310\036\325\300\275kB\317O\323\211t\375\353\360B\205\t\246\323\200'\345P\202\331]k\004\356x\333\025\266/\366-\002\337\177\311\303Dk7@\314\302\242\"\004\226\375\227\310\236\330#{b\315\177w\205\340\267_\305\232w\205\314\260\233\212\340`\367\253<\232B{\264\257@$\300\266\237\340\255\221\003\266;g\340i\273{\361a \036\037\301\243\377\221=\252BHXP\312\230\265\274\332\035]\336\224\372"
+	.string	"%\242\244\324\225\025\036\356\356ZUvL\303\230V\230\316\007\233\213N\227\001e\326X8\216\206\307\206\203\241\351\266\215\214\214g\323p\335f\221\360\207\203\303m\240\317\207\333&\266\363pU\345\277NIU\250"
+	.string	"\324\230\222\206XUW\266a\203\325T\023"
+	.ascii	"hm\371\264\354\343X\336'\016\224\277\240\001Q0L\256\320\313\020"
+	.ascii	"j\253\240\261\232rU\320Y\225\0034\271\211WxZ\210\324\024\232"
+	.ascii	"\227^[\306"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.174.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`D\001\035\f"
+	.string	"6VN>\020Q\225\016(\f;A\020\244\334\020\247\021M\277\211\224"
+	.string	"j\316OJ\027\360\005\213\006\335>\306\251\375\2433`\320\26613\003"
+	.string	"P\001#\204\262"
+	.string	"\256:\253\212\271E\001[\213do)S\n9"
+	.string	"<"
+	.string	";"
+	.string	"\021~"
+	.ascii	"\366h\337\204m\020\311\235=\343\036j\317\302\305aecw\265G\035"
+	.ascii	"\361\356\232\260\363\257:dT\n]\001\224<<\005\034r0\330]?>\334"
+	.ascii	"\361\266'\266)\366Y\001i\325t\336\373\037\240\300\002\020\273"
+	.ascii	"\035:nl\210\330\242\204\355\333W\201\354H\304\231\367@O}\240"
+	.ascii	"\267%\2223\355\2378\212\356\251\217!\273\"`\264v\275\004\217"
+	.ascii	"V\360x<p\002\330\003_qA5\373^\370\033fo\236b3\200\332]\212\277"
+	.ascii	"\312@\301'\361\350c\300\036'2j\210\262\303X^m\217\205\374(5\373"
+	.ascii	"\\\2746h(\365d\205\207\253&[\323Q\323P\003\227\006\032N\245\203"
+	.ascii	"\331\"\3410\021<\027\f\004\013G\223\220\251l4\013\307\321$\b"
+	.ascii	"\274M\300pZg\3338-r\270j\262\003\032/\221j\260\252\236\354\007"
+	.ascii	"ou$Q\263/F\346\254\n\032\324\354s]\305mM  \340\202!\343t\351"
+	.ascii	"\367u\211\215\3524\214\354\t0tc\35630\346\013\035(\261\213Sc"
+	.ascii	"\202g9\263\354P\275\237\200\211\3660\237p\023\246\330g\2378j"
+	.ascii	":\3573\253\005V\347\345e\201\362B\357\364M?\001\216\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.175.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\n\001\245\f"
+	.string	"6\327RC\020o\225\016\200\025f\005\n\324\002h\260\345\375\035[\307n\002\3204K\273\365\032\321\007/\372\001\326\"9\254\361\021@ph\313\373WU\225\337W0\305\212C\242\213\365\030\bVd\202\223\032I$\233\354\235R<"
+	.string	"?"
+	.string	"?"
+	.ascii	"\377\310"
+	.string	"N\261{d\247\366A\330\006E\207\266\213\327\016\373\0232 \254b\354.w:9<\374\224X\350?u\212h\004\372\334\030U\270\3548\2461`w\255\221nz\333'\266\005\330\227\020 u)\210\376\352$\302\263<\337\007\"Et\032_\354V\222S\007\320N]\265\324\375\024ho\233\245|\005\217\372`uG\242\245\264\037\342\"\302\243>\246\354jh\201b\267\226\234\332D;\r\t\331\351I%\325\007\030!9:\223\237vg\201\274H\316\273~\013\030\306\227\203\t\222\323\344\211a;7\334\362\365\177&K#*v'\21436\003Mqz\353\267\357\253>\302wyk\201gyd\232\317\302\3010\0044\237\205\223\371R\3612\007:\230L\201\313\307!0`\331p\027\357\343*\"\356\022d<\216\323u\036\267\335\177\204\025\027^\241\331\300sN\223\273\314\336\334D\307\301bw\001\370%\030(\360=\234\372\236\035"
+	.string	"i\355{,\0130\227G\260\272\205\231\306$@1\341"
+	.ascii	"\362\300\b\327\341\232e\030PY\371i\202g\303\237\b\306\231C;0"
+	.ascii	"<6#\361\304\023\0076\235\263\317\354\\`\323y\347\262\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_getTaskHistogramInfo.part.0.176.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\252\005\245$"
+	.string	"zAX\016I\200\332Q:\265\036X\207\363?\270\032Q\261\3647\260\007\307q\203%\216\202\2465n\n\331\215\372\325\316B\262\321\007\231\237\243s!\2274\332\021\264j\306\330\246S\346\020\223\356,\2204U8\312\273\262\200\376Fb\311&{'\031\314"
+	.string	"\305"
+	.string	"\332"
+	.ascii	"7\222~\315\277\322\336HJ\340iV0)\023\316\343\276\366\353\323"
+	.ascii	"\307X\224k\006R\365\265\335\017\273\030\324\307X4\232s\326\222"
+	.ascii	"\262\234\327\006\307\355\340<\006\372\217y\\\036\200y\334\375"
+	.ascii	"\"\375 \302\023\325\203\bP\235~\335\372\005\030J\211qdM\316k"
+	.ascii	"\356\370\366\350\362\345\372Fm\372\033z\332L\\^\213K\373.~+q"
+	.ascii	"\220^W\327BuUB\260*\"\177|P\020\252\240E\203xTY\375\264\r\035"
+	.ascii	"\217w\374\260X\335fU\340\215\233\300\033\30774\032E\260dV\325"
+	.ascii	"\325\313R\001V\225\032:\300\027\345O\226\035`p@\237\275:@\030"
+	.ascii	"%P\316\371\306\333)\240\224\265>\307\331\206r\316\375(\034o\234"
+	.ascii	"w\267\261\273Et\343\025\001W2\217\357}0x\346\353\030e\327\372"
+	.ascii	"\276B\0243Q\356\025vwj\376\336x\033\2341$\213\031\2644\237ec"
+	.ascii	"\257\260/\356j\265\351\352\002\244\257Vw\333\366\3519m\363\224"
+	.ascii	"\266wP\333:w\362\3169"
+	.string	"m\343\234\266q\267\3236z>\311o{\361m\226\266qi\273\264\331\276_\177{\342\177\003\245\227\214\035\254\234\177kjY\007>v\275\370;y\277\311\231\364\217N\236\032\310\227\313\332\f\310\267f\240\215\370\303\002\266&\347\034\342T\362\276\222\247\276\261q\335\375\342\222\236]\322\343\311Z\362\201j\303)cr^\027\034w\207\023\252\033\327\330>\311\323\232\253\360\221#\201:\231\023\001\236\354#n\225YX\317\322\236\030\351\330\315\340$q\267\333\302\311\024\375\\3\265L_\270\030\fg\316>\t\3750'4\364\271z\3461\356\376*\350\346K\254\221^Ve6\364\202)\335\250e\242\354ZZ\221\227\177!\332\300\301^\345`\036\243\367i\202j\222G$\227\021\007\266\320\276\245\203\207\017\366\352\207{C\243\241F\265a^a\221\331\r\342X\212\006l\345\234%\364\257\250\b\321\347r2\217\217\025LC\344L\377L\204"
+	.ascii	"/jw7\275\312\b\006^\246\234\n\t#\235\316<6\257=Sm\b\275\274\370"
+	.ascii	"\0260\302\300\222\272\3455\251\202h\210]\310\336 \240\"L\342"
+	.ascii	"+\224\202\366\344\207\225$\337\254\276\017\240f\264R\356\314"
+	.ascii	"{y\304/>\313\246\305\243\354\316\2343\205\276\331\241\230\350"
+	.ascii	"s\035w\222\222\275z\334\001II\026e*\261D\224\302\210g\202\251"
+	.ascii	"\251\227\204\224\243[r\312\240\244\333!\351\320#\"\245\236Q\223"
+	.ascii	"\331:!\336\016\205\323\321\016I\327\313-%\031\245\310\351x\275"
+	.ascii	"\234PP3\251\330\361rMLL\274\234\375\325j\024\3035\262&\350\215"
+	.ascii	"?\325\206g"
+	.string	"dM\312?\271\217\317\355\241\250+u\273\302F\325\263\347\3364\333\202\347\334\25163s\356\221\304\264\3732\347\234Q\006\317\271=\327G\352\327\205\347\272I\303\016lu\352\343j\351\217clT\313$\260;\367\326\225\016\355U\236\013\364\342\272h\235\273s\361Y\214\243'S/\n}5_\223\n)\323!j\372e\036\353\334\037\257!\030|\223<^\253\"rx^a\2339\220\346y\177\220\344\020\303\346\275\335\251n\234\333\235\0269\2324,q\250a(\206\0343\310\020\215\210\bI\223\214\001P\002A\250\316\270\001\021\2409G\2445\322\276\001\013\317\037U\035\212\324\346\322}\212m\250\362\237\333#S\346j\t]E\220\025\341\352\247a\225\323\036\360\205)\253\335\031%,\2411t\027\370\201A\221^\317w%\350\013\252\020\276\337)\177\276\212\007\301}\230\303\030\330\347\3618C\320\265e\323#x\3605\\\314\256\376"
+	.ascii	"\034\372p*\213H\332\t\367\344h\341$\003\225U:'\0046\0030\024"
+	.ascii	"\350#\2042^\233\315Ah\347\311\247\276+\260\274\266\300\353\270"
+	.ascii	"o\227>9\3775\352P\326\"\266\363\347\006\373\324I\\\250\253K\t"
+	.ascii	"\367\215\326Hz \337\200@\323\327\006\204\013v\272w\246\017\262"
+	.ascii	"\033ly`\277n\037\326-,\265\371vd\345\371c\026\2432\324\007\035"
+	.ascii	"{p\033Q:Y\340$\230\260\316&?\031\270F^[S\314\263ZQ\001"
+	.text
+	.section	.gnu.lto_schedulerExecuteTask.part.0.179.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\274\rmF"
+	.ascii	"\232xp\032:0\246N\007\b8\272\232R\227\340\270\242x\227\3441\177"
+	.ascii	"\252\rpuxw\006,\213\347\325\210a\270!\340{\351\356\275\201n5"
+	.ascii	"\035\034\232\351\352\206-z(\224\254\373\357n)\245\024\231\001"
+	.ascii	"w\001\224\001_>8\315\310G\007\3551\350))\261m[\261V\235\230\233"
+	.ascii	"\033\220\240&\344#\241Aw\320\335zK\266oZ\b\351\2012\030\350\006"
+	.ascii	"\272I\267+-U\024Dy\233\272\t\036\346;-\310|d\037\035\310\r\030"
+	.ascii	"=L\304\323v\270\365t\237\006\374\013\002F\256m[?\354\347\204"
+	.ascii	"\232\362\354\020\333\266m$|\366\254\355Y3\266s>\344\255\271\333"
+	.ascii	"\301\266\352\227\207G\036\036\310\346\027D5\2112X:\314G\037\354"
+	.ascii	"\334t\202p\327\341\343\0349\227\267\336\206p\317\341\243\234"
+	.ascii	"\333-\223\266\213$\346\321!\266-\337W\253L\202m\325\273\257\341"
+	.ascii	"\\#_\013eo8\227\237\3326\3134\303{\273\t\322m\200X\361\265L\344"
+	.ascii	"\370\235\271\3314\337\220n\003\244\251\332v\213\240\236\266\345"
+	.ascii	"\003k\225\037\260\2552\037\313\334k\202\3605\362\321A\345\230"
+	.ascii	"\231;M\253\031\302W\004\234\033\324A\2364\256/\261m\371\304Z"
+	.ascii	"\335j\345\332\252\261\003\254\255\276\227\276\235\234BJE\035"
+	.ascii	"\241\236X\247U5\276S]\356:\035\242\211f\372\204\266u\222\256"
+	.ascii	"\247\2544\322\n\227!9\251KqE\031\261\f\311U1z\341\311Q\361#\324"
+	.ascii	"\224\250?\341\311U1n\031\222\223\342lgaR\245\235\214\312BZ\034"
+	.ascii	"\265!\2719c\003\351\240\2238_\241\264z\204:\215[m\333*\201\302"
+	.ascii	"\271\321\237P'\375"
+	.string	"\306\006\210{,!\241oF\345\0221\317\006l?\002m\272\003h*\247\rm\333r\273\3255\003h\346\356bf<\346\250@\001M\2372\373O\337q\213n \032S\232\342\216\020g\257a\321\210\276t\306:\375X\335\236\033\211\256t\331\365\261\006\377\354\375O\272U\206}\027\035\324\243b|\365{\223\023\321\377\337\370\306J\316\273&\227\350H\227m\333v\214\033Q\210\tn0@\326V\375[0\032\250\270\027\326\334\207\375(\355\004\n\024k\253Nc\376\320H\325,\352FK\025-\372\257\214\224\n\367r\345V\324\206\313\025-Z@\211\002\242\241\324\317\215\250\013\201p\203\341\0271\274\2371\326V\033\260\275\366\374\201\221\256\241\342\346S\177.\374T\306\366\2670\223%\235/$\235-$\235+$\235\307Xg\n\254\363\004\326YB\023j\216\200t\206\300:?`\235\305X\3470\326\031\f\351\354\200u\376\202rn"
+	.ascii	"\345\314\200u^\300:+`\235\023\260\316^P\316\bX\347.(\347\003"
+	.ascii	"\2543\027\353\274\205t6\300:\027`\235\t\260\316Z\254s\026\353"
+	.ascii	"\2145\345|\205t\266b\235\007\260\316UM\247Y\311:\013\200r\016"
+	.ascii	" \345\f \312\231*\3129\311:O\035\235\221O\316R\355\327\034\325"
+	.ascii	"|\232\217\2543\024\353\374\004\345\314>9;\261\316k\3775\253\254"
+	.ascii	"\263\261\373\272\237u\366v\323\335-\214g\346\246\244m\273d\252"
+	.ascii	"\251\275\242\362\261k:\335\177\335|\272\375\272\tu\017\266\241"
+	.ascii	"\264\2557>:\350z\250\356\255\r\f\0049\027\021\274\027\377\255"
+	.ascii	"\007\036\301g\3059\335e"
+	.string	"\273\036\353\221\224\275\003F\274K\232\226\241\312'z\370FQ\035I\\\177\340\255*\305-n\375?\327\267`\033\363\n\021\003\243\304\271k\336#\276\345\262[\257\270\347m\333\266\251\006\262\030x\262\250#\305\271\002\177\345V\031\022x\254/\360k\241S\252\365YO\340\261\376\234w`\215\365Zo`\223s\261\331wU~\326_\025:\361\232>M\342U.\326\273\210:\322\3333Zp\345_Ao\023\270oc\366h\031\322\360\311\3140\\\312}2\201\256m[\013\255\262G\361\271\033E\312\2352em\365\352\235\264\200\201\364\204\322M\207\tQ\317?\027\253W{\303\350\31511\267\"\177\262\254\322\302\352\311\242\211\364\346\006|\223\252W\376\200o\247T\316\241\367Z\271X\260\254\255V}\313E\013\365\346\216/\340\225\377\207\002\376\023\0335\t\363\251\217z\356\313e\r\360\314\327\313\255\363~\362V\334\2671\200\017@\365"
+	.ascii	"\276\361\304-\272\3615\017\256\311\247\372v\0166\375y\355\330"
+	.ascii	"\266u\353'{\0217r\277\360\rs\355\274\237\327\356\223\257\026"
+	.ascii	":\3154\247\036\207\234\002?>#\237%\\y\343K\306\341\314\024i\204"
+	.ascii	"@>\202:o\236\261R\357\"JHq\317\353\314\325\363~F\275*\310h\323"
+	.ascii	"\001g\276k.\033\357\347\361WDF\231\b\233\337\306\334\036Vf\016"
+	.ascii	"\275\350A\032\025\204\206\022\324kzJz\372\365\241\336x\350\224"
+	.ascii	"\006|#\214yf\306&\246\003\355\354\fmyU&\303g\310p\032hfj\314"
+	.ascii	"\035\353\232\212\0349\312<0\325\320j0;d\2551s,\201x`S+cC\301"
+	.ascii	"\\\226\251\261%u\240\231\261\361X2\177\200\300\261V\306\026`"
+	.ascii	"M\005\363\314,\005\233\016\246\232\032\217\245\024\216\265\262"
+	.ascii	"\0244\230lKf\016\346Z\024/\303\324\2309x\320`\336X\256\211\351"
+	.ascii	"0+;\023[\252\255\211\205q1\332\016\246\232\030\033\032\232\232"
+	.ascii	"\330\321\330\376\026\226\306\371#\235R>\331\037af\262\357:ME"
+	.ascii	"\370\310\n\241\3337\223\027\376\016\373Y\370\261\277\360k\237"
+	.ascii	"_\337ID\346J\313\032\246\323\304\267\266u\353\252\360\026\336"
+	.ascii	"\t\217\023o\354\325\257\360V\202\210L\235\016\373\215}\026\234"
+	.ascii	"?{\024^\316\255\232\360\312\247 m\363\276\313Nx\027S\340\350"
+	.ascii	"\355MI\3707\267\355\352\346\"\274\362%<\206?\247\245\246\267"
+	.ascii	"\271\016'\3027a\207\330\213.\"!\274\032\033\bO\026]\324\233\223"
+	.string	"z\260\346\026\230\232N\247\323\007\237u\310N\216Sz\005\250\347OT\337\025\354\325H\201i\216b\257w\013\030:\365)_\354m\274\021\003\311\251\251\371\345F\216 \324s\341\260W~gy3\310\3074\330\207\375\325&\347\342\231\313\202Y\322\343@\270%wO\016\276\305\3449x\026\321J-\346)%d\277\340\234\314\3252,|Jj\360_N\f\276\301\327h\212\ttjj\356\251T\b\213\323s\341\333i+\203C\267c\360D\242\224\024\347\326\3770\027/\372H\221\312\202\377r\265\024|\327/H\360^\257\340\265\272>\301\007\201\n\250a$\350\024S\206hDD$I\222\264\006\301\004\304 \n&\254\007\0210\271rLfF\244 \251t\034\212L\257\310\232\365<]\377\224\210',F\324?[\022]\f\216\021\362\300\351\0308\340\036Q\365\200u\314!9\372\034P\317\311\360}\f'\343\030\253\022\250 \335"
+	.ascii	"\202\347q\366n$\016\006)\017\303\223\246\007\314\031I\013]n\311"
+	.ascii	"\361\362\315&j\324\205\351\355:\306\371\266]\035\332BP\2013\016"
+	.ascii	"\227-\3205\003\334b\017E,\036\252\335&1\213\252\305\0249\020"
+	.ascii	"\306\007\336\205\337Q=\335\211]\366\252\017^H?\372\211\212\341"
+	.ascii	"\232\3726\227q\254m\tD*=\326\316\372\364\234\207YX\030\354\t"
+	.ascii	"\203\375\225\365^\251\203\320=\221\273@\242\374q0\263\016\272"
+	.ascii	"d\226\244\213^\224\343w\304\366nk\273/i\243B\023\360e\033\207"
+	.ascii	"e\001mq\\\034_\0331\232x\206\301-\321e\030v7\216\237\363\322"
+	.ascii	"\366\2338\236\236\226\355\356 A\274\376r\223 \242\200\r\034\364"
+	.ascii	"\223\262\350\340I\205\346\f~\213'\005~\211Z"
+	.string	"?B\346\266l\362\251&\362\205%Fx\342\017\232=\0345=I\025\305G0\232\024\2462\324\206\314\317\204\353\326[\0308\371|$J;\311\0206\2212\250@\t\321\276\354\234\333"
+	.string	"1\f\253\003\271\355\216\374\300\255!\317\223C\251\b\350M\342\250{p\364\333\261\324#7\310P\253\006\f6\341\207( @\243\024\257\315.\325\224\036\347\322\227x&\f\007M\0342\275t\n!\n\224\330=J\262g\0166\304\036E\020^4\002\017\241\026\366\276\352\366I_6\314Y@\2109h2\020\037\254#\246<\226\234"
+	.string	"\332K\324\217%t\306\372\245\340\277]\274\234;L\266!b\331\024\374\f\375\344\3566A&\244pV\206(\260Ll\3376y\345\256\302\274U\216\2620\313y\026=+\220\351K\363\212\361YK%\266\321s\230\264N\346\362\321x\b\215w\3000\317\n\003\323\362K\346S\3766\003\017\331/F<\3102"
+	.ascii	"i\375\224qD\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\245\r]/"
+	.string	"\212Jx\02090\350I:\225\210@A\023i&Y\004\211F\023\0277\253\0165\320\303\021\244?\302\"\210\021D\255"
+	.string	"<\264\347y>\036\207\277#\020\213\020\037\037\300J\216\364\027\021\3226\221)\364"
+	.string	"\366"
+	.string	"\376"
+	.ascii	"\017\325$\277\217I>\250%\371\237N%\347K\362\027\311\233\350\221"
+	.ascii	"\357\031\311\367TD\003J\244\317\320!\371\256\220|f\220\374N'"
+	.ascii	"\220\334w\314\362\363\"\255\232C\367#\237\323\351#\177S\217\r"
+	.ascii	"\347\252\312\361\310\327t\356\270\236\216\017\346\200\200\343"
+	.ascii	"\301\r\007\250\215\334~\316s\251\361D4n\207\3168\035\372\301"
+	.ascii	"\270W\217\214\334{b\344\216;a\344\326s\276\310\215\307E\231\272"
+	.ascii	"\256l\213\334vN\026\257CW<\211\252\270\242\004)\232\f\212\"?"
+	.ascii	"\325\211\374K&\362+\225\310_\236$8\240a_\204~\211\007h\035\221"
+	.ascii	"\237\211\fN\020PD>\2463D\276%\020\177\204~\310\247\264\340\215"
+	.ascii	"P\017wT\226?\t\027\026\026\026v\310\307;\207\252\252\252\034"
+	.ascii	"\362%m8#\r\371\221N\3747\2532\370\035\372?U\327U%\364\347\377"
+	.ascii	"QZ[`b\272\223!\037\322\371_\353-\357\224\205A\244D\254\240\361"
+	.ascii	"\"7m%\224\210\323c_i\206\2653\274\302\351\332-\207\352O3\275"
+	.ascii	"\302Dd\237j\231\224mN\024\023\217}Dnj\354Q\2342{\250\016\261"
+	.ascii	"\235\334jp\271\327\352\344FC'7\333\234\334mmn5rr\2479\346f\363"
+	.ascii	"\226\033L\234\334a\340\344\376\362&\267\0277\271\305\264\311"
+	.ascii	"]\206M\3561kr\233q\313\315\266\252\252?\0025\271\273t[\3565M"
+	.ascii	"n.l\271\325\023\315\347\326z\315\231vS;2\255\317\264\231"
+	.string	"N+\323\001e\204\226\212\255\311\344\027\366\230\374Uh\371\252ZL>\341\031\346\210\300d\370\202\301\213\20532\366B\227\n+\205\346\022\241\325\th\226\260\245\321P-\371\202-\027\250\252Q\226|TX\362O]\311\017\364\212\233\313\263\222o\252J~)*\371\244\246\344\217\222\222/*J>\340\t%\377\357I\276\237\223\034\377t$\356c\201#\302\351\332\377\233\333\364\022(;K\224I\321W\206s\f\303\223\223\326^/2l\265\016\311\376'x\206\017J\206\233\355\236\223f\320\372\227\fw\271]E.v\253\325\"bY\245I<`\177/`\021\335\202o\205v\177\307ZP\2405\202\304\306p\212\354\323n\321\336]\2031l\205\024\320\240\001\336Z\257\304\260\026\333\003\"\371\265\235)\206{\315\n\303`\235\3020\221\3158\304b\261\210m\323\210\265\222{F\254\345\0321\227k\304Xnc\267FM>\367d\240"
+	.string	"\006\013\322\266K\340\013\203\275^\270[>/\214\005\2508\334\322+b\255\226\350\356\0251V\322}\263\210S\266\217gh\020\334\335\"nf\033 d\227g\310\205{\355[z\023\270'"
+	.string	"\027nd"
+	.string	"\001\270\217\335p\202\200JT"
+	.string	"N\335\376z\344\206\324\231\001p#\033+\242t\226v\005"
+	.string	"\233e\001\300i\333n\177\336\363\360\331\207\355-79\345\335\301\266S<Pk\0075\212}\363\217\331Vr\353%.?fw\335\021\332\031\223\315\227\355\003e\224y\347\323K6\005\271}=8\312\344\371\334\356\nL\226\272{<\366\351\n\321\265\025\277\304S\220\315u'X\210\350Ba\233\001\035!\243\363}\211\231\270\315d_\033\352K\274\304\357K\214\204\355\373\022\037\371\373\022\023y\207"
+	.string	"\001D\366\331\326\007g\306\366\020-.\320_Q_b\004k\247\312\365\217\361K| \331Y|\b\341\b\270}\316\251a>\352\313\273pR\rj\233_z\351\241R\376\375\022\203\335\375\022\203\350S\2159\206\222\361\2230\202#\362u\370\213}\231e\257\303]m\363u\270\310\307\305n\265Z,\261u\261X7e\371\230b\311\277\307\260\327\341^\001\274\016\233\0318\035\356\025\371D\0208\r\322\021\321\370U\036z\013\200\365\250A(\351<4\201\220\024\244 I\245\003\240\0021\"\342t\021p\034J2\303\214\210\004\"\"R\224\016\255H\022\\\b\366DR\233iB\330\317\243|h&$\021\006\231CN8\354\024\340\274\0033\021\254A\030\345\005\267\320\302\0338\274\222\371\325\306\306l\233uM\201\355\203\351\362\033"
+	.ascii	"\205S\300@\237\220\354'\313z\315'[%\017B\n\377\374K\214\007&"
+	.ascii	"\355\225Mon\037\217\370\003\233\362N@\177\003\030l\356\3514\366"
+	.ascii	"j\304*%\303I(-{nr\230\001\2751R\262Q\032\313\367\003F\362\276"
+	.ascii	"W7\236\266<\264\215\217\375\006\345-\020^\024.uK\2624\032\273"
+	.ascii	"H\005\177\2037r\361=\212\207&En\304_\233\232p\200\325\026X\213"
+	.ascii	"\356\307\3670\034\303\211b\n\371\013O\205<\241\223\177_pn\323"
+	.ascii	"_\317\217\301\366\212:!>^\201\352\023(A]UYC[U\255D[S\255\242"
+	.ascii	"\\\223\026x]\013\202\34070\316h._\330\357\312\2704\250\352\376"
+	.ascii	"\001\024(\3066\024\031R\016\350\252\351\312\3239\252\013\001"
+	.ascii	"0\272\240GU\270\340G%\034\024\222{\324\263\002\246y]\314\273"
+	.ascii	"\243<\026\203|\363\217\016\213\\\0066\254\032\037\233\354\257"
+	.ascii	";\371'tv\001\352\222\253\342\251\243t\025\343\2763\240A\210\241"
+	.ascii	"\347i`\223\363\304\263\005\016\344\315j\353*\t\245Q\316\005@"
+	.ascii	"\304\020\367pmV\234\222i\300F\234N\267\312Ut\025\253\347\265"
+	.ascii	"c\332]n\334S\332\357ShT}\234\344\034\362\351\351Pqz\354c\f\235"
+	.ascii	"t\360C\250w\251!\027\234\306\355/\215\302 k\032U\312\f\\\250"
+	.ascii	"\230\353\264\027\375\320aj\344\262O\357\325"
+	.text
+	.section	.gnu.lto_.refs.bbe424109fc4e991,"e",@progbits
+	.string	"(\265/\375`\374\002\265\024"
+	.string	"\206\363\211@\360\226\323\032\224q\344M\323#\263I\355H(~$;\271\333\332\254-l\206\345\315\3430,\016\213#\223\223h\370\tk\355\016|\255\021\276#\350\211F\304\021P\243\332\320\036\234Mv\367&[\246\024o"
+	.string	"z"
+	.string	"x"
+	.string	"+\035\271<\263\324\363\235l\301\314T\023\330\003\251'\206\322\353\244\233\336\200PiY2%e\273ioM\026\314Q\247\030\247\241mR\310-\333\221\366\324\256\315~\001Db\353u\t\340\371\306\242m\227-I[\221\246O\3333E\242\324\245\335\216\326\354\032\313\334\256\325\336\3542t\331\362\022x\005\254"
+	.ascii	"\326m\305\256\227Yz\2677\264\276\206\364\232\022\217\345\204"
+	.ascii	"\025uJxj9\212\341\350u\243\333\030!d\006aE\255\305\036lhf\177"
+	.ascii	"\240\003\314\020\215\r.\037\247\323\314\340y\261\\\260\245NI"
+	.ascii	"\335n\334s\304=\005\230\006\272Uq\233\342\236'\356\271qzqzgM"
+	.ascii	"&\326\351\234\t\236W\267\217f\347\036\202KuZ\212\241\245\023"
+	.ascii	"d\264&FY.\317\027\224\256f\266eFQ\246gHf\257\326\276\230\235"
+	.ascii	"5\f\311\322\213n\001k\021\221(\005\217\354M\004\215(\215\214"
+	.ascii	">\024\346\245\305\037<Te\017Me*\025ID\237=\216p\207\263\024\261"
+	.ascii	"\313\034b%\234\326\301ik$\2624\252\205\221gW\016\331\003\nY\003"
+	.ascii	"\002\321\002\006\331\224@\326\344\217\025\240\217\355\354\261"
+	.ascii	"\234;J\222\307n\356\354\352\b\242\344(?,\206\332\207\322\303"
+	.ascii	"\265\332]^\207\313m\346\260a\rf\330[c\270\260\257\265\307l\341"
+	.ascii	"U\330\232\2514\261C\260D\317$\366\331\360g_\215G\343\315x1\336"
+	.ascii	"\013\201\364\271PG\037\013\323\363\255P\341\020})\036\212wB\036"
+	.ascii	"\375\212At+U\246\"\320.%\n\224'N\202Vz\023&,}\tJW\002\264\351"
+	.ascii	"E\354\321yv\364\331u\230\236\347\360G\307\241\020\375\206>\272"
+	.ascii	"\f\233\035\206\215\376\342fw\321\"g_\221\243\253\300\331Q\340"
+	.ascii	"\250A\334\323 \355\351\222MMb\217\372\243\217H\002- 0B\245$\334"
+	.ascii	"\001\300\024?\346\300\013\t\374@\340\n#\224\336\026\330\260\242"
+	.ascii	"L\247\364\225\311e,k\255`\357Z\246\345\302\2075=\241\325\237"
+	.ascii	"\026\025\246\301\230\3153(2x\232\220\263A\311\356\037\267\246"
+	.ascii	"\212F\345\303\002c\231\305\256i^\312\317\352\241]\374fI\207E"
+	.ascii	"\227K\035\312\322\f\341\r\325\340\201\247\267\013\332|m=JPc"
+	.text
+	.section	.gnu.lto_.decls.bbe424109fc4e991,"e",@progbits
+	.ascii	"(\265/\375`rW]Y\001\352&\312vR\0200\204\251\244\003\013\355!"
+	.ascii	"\331\036\264\332\003\320\326\374\2045;\325F\177\366!=8#\351\367"
+	.ascii	"3\271\212\313\\\254\035"
+	.string	">\307\362H\032\260\333\234\211\030R\370\027i\001&\361\3528\221q\203\316Z\314}\3553X(x\346\235SV\362\231\343\217DB\366\2262\005%\006Q\007\241\007\347=\370I\330a5\334\006\204)\343\257\206\235\221\273+mW\356H\204a\271zf<\257\200\225\335\335{\273|\2012\005\216\026)?w\361bvDZ\301\302d\3468\315\020T\321\225\242Rr\274\027\311w\254\307qx\017\313a:<\207\361p\036\353a<\336\343;\\\207\3718\311v~v\303o\216\204\274W\212\304\331\016\327q\232\212\344rR\255%A\376|%\313\267\3243\243\206);+w\367\336.pQ\272\2009\327\326\236\334\2250\301vX\013\277U\344\321g\rL\312\335\224\263,\307{\221W\260\360\332\220T\321\225\002c;\336\213\274\007?O9\333a6^\253g\306+\345EWB\r\230\254&z\367\"9@\342\300\0343\006\353\215"
+	.string	"\354{\357\264\327\310\214\302f\314\246V\331\340\272V\356Eb \262\273j\307\266\274\306\007\313\032\017\255\266o7'\333!/\022\343\020\223\021\327\366}\346|\273\235|\206\321pr\003\246;\227a3/\241\220\027y/\222\250\215\354aCk\373\266r\23670k_\037o`\276\237\234E|d6\027>2Y\f\217\341\344\3418\356\022\021\201\251\023\204K\3337\222\023\306\275\367\362\341L\237\303\231\357\253\363=u\236\353\234g\273\363<\346,b#\223\2670\027Nf\300n/a\342\265X\345\232\335\213$\022\342{\302\247\247\355\371\355<g`r\037g`\236\223\347\371\310y\336q\336\004\247\00762\377\201\363\0238\271\n\243q\362\003\253\235\2510\362?)\344M\273\027I\024\004\325C\313\231\266?q\236\323\016"
+	.ascii	"\250k\342\033\316\363\007\223\250\257\257\257\217?\230\357\323"
+	.ascii	"\003\037\231\226\215\314\021ld~\216\217\314#\371\310<\331\310"
+	.ascii	"\374\237wg\017\317\1778o\330\310\001N'\004^\217x\n\032T$)\300"
+	.ascii	"\001N\3746\305\317)\374L\201\277\371j\bZ\203\312\342g\025\320"
+	.ascii	"\237Q\370\231\005na\201\237Q\274\360\r\2264t\360[\021\377\357"
+	.ascii	"\004\375\374\226\203\217\305p\025]\376\r\001>@Q\217`o\360^\210"
+	.ascii	"<?\372k\235\237\217mV\3068\235\223\246\237y\374\355\201G5A\320"
+	.ascii	"\035T\251\"\332\330\035h`\263\3404\365\003\377\355<\317\177:"
+	.ascii	"?s\300H\230\250\250\357\324\240:T\177\036\370\033\254v\340\257"
+	.ascii	"\0318\320\327'\330\300\217\237\265\376\376\252\027h\340\277["
+	.ascii	"\315\300\337URP\365\204:\001\016\241b\340\277\n7\300;h`\256)"
+	.ascii	"\352\005\256Fw\274\214\277\204\300\337\033\324\n\374\374\253"
+	.ascii	"]\340\177\234\336\372\375%\003*\005:\2534\301\034\370"
+	.string	"t\017\336\253\023\340c=\341\357;?\243\250&\374\034WG\264\002\340j\t?\273\360W\022~^RG\370\231\003w\375\001\277\335\3637\232\212\342\347\257~SE\370\031\2119\220S%\360w]=\361\200\237\333\330\325\b\274\260A\007 \360\327\007\374W\343:\021\177m\373\373\250:\340\347\024\032\020\360\363\033\024\340\371\331\255\226\b\241c\344\375<\2476\340g\024\r\200\332\225\001?\177\375\215A\r\241K \247\237\334\004\035\350\267f]\200\234\307\371\257\346C\304\032\354F\2748s\373[2\0328\204\227\277\025\363\367+\b\357\353z\\\375\033EU@\217P\343g<\365\203\237\3218\004s\207\353\315\371y\005\377\363~N\301\177=?G\375\337\373\371\376\207\3633\n\376\313\371\031\352\377\035.\376\f\342\347\251\237\021\360\263\324\3171\250T\020&\257\232\370Y\3037\370\206\256\217\370m\227\237_\360\220\235X\370s\332\201\336"
+	.string	"\223\377t5\001?k\340\020\252\007m\201~\321(\330\037\024\360\371\355\325\t\346ow\224\t\303\032\354\n\372\3024\003\034\200\364\333\023\374\034\246\031p\376\266\004a\262<\350\267\302*U\004\022\267Z\2025\274\350\257H~f\353,\225\304U\274}\241\331\371O\307\201\006\022sg\357\343\265\r\256v\f\177\r\362s\\\035\361s\225*\342\035N\364W)U\252\210\2379\310\302\341\317\360\327\253\036SCp@\356B\177}\362s\007?\177P"
+	.string	"\203\360\r?\223\370\207\376\232\343g(?w\357\273\212\352\201\177\016\177\255\3613YE"
+	.ascii	"\233\205\370\037\267\347\377\234\377j*\276\001\032\225\031\224"
+	.ascii	"\247\377ww\3233}6\370k\007\177-@\365p\025\267\340\257#\370[\203"
+	.ascii	"\333\021\376\212\301_7\374\365\350\257F\177\035\372k\320_\177"
+	.ascii	"\376\352\363\327\372w\337\337z\177\323\371\373\356o8\177\253"
+	.ascii	"\371\233\356\357\270\277\265\374m\366\367\223\277\235\374=\366"
+	.ascii	"\267\330\337I\376.\362\367\327\337^\177\013\371;\310\337\037"
+	.ascii	"\376\336\372;\353\357\036\177\363\370[\307\337\306\277q\374m"
+	.ascii	"\343o\032\177W\375=\365\267\324\337P\177\337\277U\360\267\206"
+	.ascii	"\277Q\360w\214\277K\360\367\323\337@\177\373\374M\374\373\305"
+	.ascii	"\337N\1773\375\315\177\217\360\263\336\337\301\277\201\177\263"
+	.ascii	"\370\373\003\177w\340\357\r\374\275\302\337\026\370\033\205\277"
+	.ascii	")\360\367\t\177\223\3607\004\376v\300\337\f\370{\001\177+\340"
+	.ascii	"o\023\177\227\370{\304\337!\376\356\340\357\003\374-\200\277"
+	.ascii	"\001\360w\207\2777\374\035\364\367\371w\377\274\367s\236\237"
+	.ascii	"\361~~\363s\233\237\327\374\\\367\363\334\317e~\226\3739\314"
+	.ascii	"\317_~~\373y\313\317Y~n\373\231\355\347\265\237\223?\243\375"
+	.ascii	"l\3663\224\237\313~^\3623\006~\366\360\363\214\237\323\237\213"
+	.ascii	"\376\247\360\363\n?\037\377\323\375\314\341g\005\374<\342\177"
+	.ascii	"\337\317I~\376\375l\376\214\342g$?\033\3719\354\347\027~\036"
+	.ascii	"\302]?k\3709\310\377\016\377\325\376\253\370\357\366\363\326"
+	.ascii	"\317W?\367\370\271\306\3174~~\372\217\302\317.~\026\301\317K"
+	.ascii	"?g\340\347\024?C"
+	.string	"\340\347\006\374\314\200\237C\370y\001?\203\3603\211\237K\374O\361\363\177\006\372\371\347\347\363g\237\237\371\177\221\377q\377M\364\365\365\365\375F\036\370\207p\374\037\300\b{\274x\251_\250\034\341^\277X\"o\\p\323\366u\372\352\377/\210\206\216.@\332\376g\347\346V\337\330\0309\276\016'\353[\211f,\311\225\266\377\211\331\262\245\215&\254\214l\347_\263$k\226\276B\272E:\036\272\030\221 \376s\322\326V\321\364\334_\0216\266\273_\326\332ZEC\336\034O\227O\253,G2Y\321\354\252~RS\246T43\267\312+Z\325\253K[k\373:\365\354\377\257\373\300\354\2749C\006M\215\365e\341>\253%\210\216\272\266\225\312\251\347<\b\256f\234\254f\2073\341BY\215p\343rA\374\214\003\005J-;\357\275\305\242\033U\207\345x\2369_\307j\223W'\257Nj\031\337{/\326-\316I"
+	.ascii	"\034\226\361\303_\311^\313Z\217\235+M\332\276\316\341\376\377"
+	.ascii	"\254\013nQ\310\264\375\371\345\374\317\357\337\274P\306{\257"
+	.ascii	"\216\022y\215QA\346\317\347\222\371\303/\304\225\005\360\337"
+	.ascii	"\336\373\277\376\007H\001y\241\260\214\335{\231\316\311d\013"
+	.ascii	"\324\017\017\267\234\273W\252\253\030\201.+\251\256\253\252\264"
+	.ascii	".+\fUi]\267(\225\244\210\301x\273\212Ui\367b\220\222*\242\340"
+	.ascii	"\262\252J\203\272"
+	.ascii	"\030\252\322\256\325\225\201\306\212/\262\253x\245\270.\206+"
+	.ascii	"u\241n\032\227\225\207*\251.\253\2524(+\fUi]V7\255\353\026])"
+	.ascii	"(\343\f\251k\304p\323\272\346\3344.\253\242\2524.\253\252\264"
+	.ascii	"\2560\2063\303kO\307\332\330\027\016\266\252\222\2728nhA\031"
+	.ascii	"\213\346\252\220\\w\315\275le\352\032\357\334\275\002\270W\213"
+	.ascii	"\313\270\006\352\212\271D\315\341\210\302\002\305\305\310{/\207"
+	.ascii	"\033Q^\\Wj\256\310w\256j\214\353\336\261\250\245{\343\336{\023"
+	.ascii	"PD\316]\"<W\034\242umL\335{\301E\336{\343\336\"\337\271{o\361"
+	.ascii	"\336\353c\324B\336\233U"
+	.string	"Tu\274q\343^,\244\033W\253\3506uo[i\303\305\252*\315\213\213\204\233Z\332\361R!\213\\e\203\353\036\357\232.\343\231V<\2736\356\275\234w\036\255v\340\265]\"\267'\003K\333\237A\316zd\"`\212D\332\376\274B\006\3450\203\303\201\004I\227\231Pt\257\027\337\361\254*R\215\330\034{q`s\212\204q\262\2065\225\tE\367~\3318\2569\377\nV_(\305\330@bG\244$k\217q\b'\353\220.\373U\335\253\303\203\333\034\237\226\3365\032A\334\007J\355R\300\245;\266\275\217X\025r[\205K\250B\365 \263\245m\r\202\034*c\247fM\333\373 9\377\nd\213\004XXS\352V\325\032\332\221,\313j[}\324,Nr\250?\360\302\242\254\332\336\347\353T\301\275\314\301\344\276>\346`\376\025\213\203\017\231[\220\027\256*\217*\206\t\224%mI\360\2507\370\215\347\260\032"
+	.ascii	"e\314]\016N3T\336\313\025\346\330\243\356\250.p\262\362\250\306"
+	.ascii	"W\253\252\343m\246\362\25088\315\020\024\362\032}\332\214y\306"
+	.ascii	"\364\202\346\220\021\021;\355\b>2M62o\352\2357\353\316\233n\347"
+	.ascii	"M\264\363\2576\204\2549n\311\265\375k\215J\003\004ge\340\264"
+	.ascii	"\2553\204\242\b\231\263\247\355\315\262\323kJ\027\224z\253T-"
+	.ascii	"\366\236\032\325|\265\252\312\350\276\nU\2518Y\247~\236\322{"
+	.ascii	"&\276:OE\036}\326\242\244\334\335\361j\263\302kV\352\024Z\224"
+	.ascii	",9==\264+R\350\260\334\335{K\230\250S\255\247\257\206\212E7\212"
+	.ascii	"\316\354\330x\274\250\334\325)>\3435/\266,9\016\2208\370\341"
+	.ascii	"\251\253\003C\262\325Lr^F\023\205C\253\355M\255\363f\361|\331"
+	.ascii	"\346\374\333N\2351@\240\024\3336\035\244\222\316U\216\266/\303"
+	.ascii	"\234g38Zs:\257\345\364\035'\033\357\026y\226\202\327q\266\216"
+	.ascii	"V\262\360\370\214\327\274~d\311q`\222\371\272\243\366c_&\317"
+	.ascii	"\227I\336X\341\241)\353r\323\346\207Z\037\217nc\005\317\030\233"
+	.ascii	"-6k\324\362\360\234\264\265\263VuN\362\332\276\374q\236\221q"
+	.ascii	"\235\034\372\335\333e\346\230\246\3254\035'\273\256\345\336d"
+	.ascii	"\272\314m\327\265\231F3T\336\013\265\346X\327j\235\3449+\327"
+	.ascii	"\032\231\263\323+\273\027\311\001\022\007\034\370|\321B\206\346"
+	.ascii	"<\363F\363\267\230\036\303i\230\353^)\253u\204[\322\266\347H"
+	.ascii	"\274\317X$Vvz\332^\016\235s\b\311G&\2579s\336\2229\207\346\302"
+	.ascii	"\200\001\372\322F\307\006\230\277\341\372K'\273\306\251sF\327"
+	.ascii	"\266\344\342\245\313\0167w\350\264\3557\213\364b;\323\366\226"
+	.ascii	"\355<\233U\3415$G\264Nz\0359v\226fk,tI\216\367\336,\255\326I"
+	.ascii	"\0374#Yrz\275\245\335\232Kk\341dg\371{\255\255\334\"}\362\362"
+	.ascii	"\340\024\371\261\177\267\275\261\374\334\245\317x\255\271\356"
+	.ascii	"\305r\357\335\340S%\313\022*m\373\n\211w[\003\214\f\201\322\266"
+	.ascii	"\232\235<\307Gf\00762o\235t\332OM\336\226\225\266\267H\316[ "
+	.ascii	"\347-\326\311\027I\305G\214^\2249T\376\036\353)\374\026\002\366"
+	.ascii	"\022\342\244\256-s\361\221\371\267\224\rN\251"
+	.string	".mffYBz7\346\220Q\256|\242|\361\262\002\005I\310\315\036\2312O\312\200b\240\2724y\227\375\355\244\311\210\266\242\350\271\322\366\007\0316F\342\335\344\344\373\202\203H[\013\230,\261Szt\334\226\210\375\210\210\331\232\3435\035w7\005\325\366\177#i%]\244\215\364\221N\302\311>\376\355\325C\256\364\261o\260\334\220\024\362Z\375\200me\311\351\335{\357AW\013\351\020Uu\355\232\217,\271\262>\366W\023\3419\254[\355\200d\311\225\335+\365\243\205\360\034\026\362\352\370Y\313\312\222\323\323\321Y L\031\177Sv?\356\272\034\033G[\2010e\374QQi\335\335\213D\252_x\260y\033\262\375B\203q\022\251\303l\324\230\035Zmo\255\316\025\\F2\337\307H\346-\324\331H>2?\260\221\371\212G\bW\024\036/\034A\232\335{\211~nz\232\270\320\266\267\032\310;Hk\335\016\222"
+	.ascii	"\256{\241:\b\321\336\275PD\314\0320k`\241x)\271b\332W:\347\353"
+	.ascii	"\232\363\357,\037|\346\313\332T\333\366\321W\033Pc\202\327\266"
+	.ascii	"\257\272{4\326\373\252]x\t\023\017\222\352+{/\024\263\006C\314"
+	.ascii	"\032\224pH\240\320L\373\212\346\354\035C6\272\336\200\310\375"
+	.ascii	"\377\3754\031bd\254\355k\230\363o+\243\311\207\227t\313Q\302"
+	.ascii	"\304\343\004\335kv\357\3550d\006w\207\247\355\353\374X\300\025"
+	.ascii	"\321k\373\272\345|\245r\376m#\003\"d\217\033Cj\320\370\2113\245"
+	.ascii	".\013)u\357E:\373\356\270\331\232\361A\b\217\232\250\262**\323"
+	.ascii	"h\206O\256mS\375-\243\247\272\030\304\265!H*\016\017\260\266"
+	.ascii	"?\227\217L\346b#\263\243H\274\245\214L#\026\362Z\271\367\022"
+	.ascii	"\001\265\305\355Q\322\326\250\241\212f\266\\\371h\373w\261\257"
+	.ascii	"\315\243\343\205N[\356\263#V\265\244\355kYe\233z\244$\303\272"
+	.ascii	"3\266-\331t\222.\253\r\207b]]\251\306\\\243\003\323:\257\230"
+	.ascii	"<\231\321\266T\363\346K\337\236\0312'S\322q\225\233\203\267p"
+	.ascii	"\331\351\351\335\213\365\241i\360p\242\004\315K:\013\365\205"
+	.ascii	"e\252mY\246<\363\377\307?\304\372\276\234)\347\216XD\\\260#:"
+	.ascii	">q\323W\232i\2714\2712v\31129\366\362\264qy\371\306\245\214#"
+	.ascii	"2\336k\343V\251\013\304\314\361G\345\204F\031\270\227q/\3078"
+	.ascii	"\275\240\246\326\266\024s&\222\247V\365\023{\203\205\257m\t\006"
+	.ascii	"\001[y\204\354\265}\371%\f\r\222&m\233\017g\226^n"
+	.string	"\2745\331j[v\271\034!,gaZnh\347\224\227U\246\224Z\252\232\240[\254rs\370l\211\363*\323\273UX\037\200\316j\234\235a{\251\345e\226\022&\016\347,s\242\006\252m\211\345CXd\336\356\332\276\274R\266\375\277\037&_idm\2174\344<\002\252\364\260\262j[Z9\234186\346\264-\327\016\207e\247\007\326\366uJ\265\377\277Z\306\213.\252m\211V\246q\362qe\362H\242\2417*\266\270\266G\332:\317\2173W\300\2173K\344\313\263\377\367{\003\362\325\325\366H.\234\177I\345\377\371\\Q\363\343\330\366H\306\363H3\312(e\224\322L\316\r\311]-^4\032\245\331\267`\0311\262)++\237\234\2157\353\307\205\313\247\2457\344\303\312\215\362I\232\037#gSB\332~C\226\322I\351\344gG\030(':\332~\303\223\363\345\022.\307\306\370\r\351\026\361<<\341\332"
+	.ascii	"v\236\371\315<\212u\322^+(\310\312\216\033|\234\337"
+	.ascii	"0\343|"
+	.string	"i\204K$%W\231\244\223\021\230qo\027\022\263\316\335\236\363\032\344\234\347N\232/\303\270,R\244\f3\341B\351 @\224\271\270\363\\\206\231%\230\322\327\232\227\266\327\360v\376\345W\371U\267^J\335!e\307{\261@\b\211AIFa\361\362\3427\256rs\374P\351\310\363\242wo\030\020v\217\0345D\332^C\330\371\227BJ!d\032\264\202\004\251ou\270x\201\355\210\323\366\032thi\225[\315u\357\235\2720\364\232\370\020BbW\304I\333\255\27698\262\266?\322+\261J\2542\353\216\351\206\304\263\222\004N\333\277\364\3612K\205\234\r\2502=zt\322\"\257\325\002\356Q\026\036<\222\0349\321\241\003\311\321\226\321X\244\224\002c\265\243\355\217n\340\300Q\305l\036\0336\256D\031\271\263\243A\243\223a\307\266\252\252N\262\361\274\342\025\304\002$SSU\214\215\247\232\227\326\3355b\201\220"
+	.string	"\234\005XRRU\314\026])/ G\013\356\371\227P%\024\023.Fk\316\277\274\347dy+\223\256r\213Cm\\\362\214\351\335\213\005\202\203\260)i\322\366Fn\226\317\362\3257;f\223;>-=\"6\270\252\264\275\021\332\251G\217\335\373\335\353\203\213OKOLI\026.{?1&^6\302\360\340\251_\240"
+	.ascii	"ir\344\254\355\215\356\334\251o\r\020\0032\004\326\205\326\244"
+	.ascii	"\3553\334\325\251S\337\302\210a\335\331\272\265(_\332>C\032\036"
+	.ascii	"\236\3153\341\342\231;"
+	.string	"\301\261\013\220<;_\200\354\265}\206\257\273;\373\346,\3421\376\356\330\335)\323\366\031f\304\211c\337\3349\376H\225\311\263\244\3551\300q\343\306\2769/\327A\362i\225\321\325\020c\263o\320\350`s\333\036\003\027::\313&K\220;\240,\262*=kn\331\f\031\365\024\341\322\326\332y\320\322\344K\315\377_\371V\frCM\335]\226<!u\3069\303\r\234\257\2666M\332\23137\032\214o\256\307\013f\314\330(\347xpmi{\fRd\310\360\232-\272RHj\034\2571\f\210\037;b\216jm_\244\346\374m\\\034\257\261\361T\313B\343\356\032\303\2000y\\iM\265}\321\225\323z\261^\254\230\363\272\335\021\251\235\331\321e\303\334\212\251\303\245&\b\230\377\277\013\260\300\300\200\371B\264\344\254\210\017\270\246S\347l\211\231\203+zr\336ra\373\226\264o\234\346\303\205*v@v\303\200"
+	.ascii	"jrcH\234\266/\342J\263\305ja0\274v\026\215g\233\0216wE7l\026"
+	.ascii	"\233\245\215\016h3sw\261\260>\360\f\032p\350\264=\021\337\331"
+	.ascii	"\326f\331\316\353&\f\220\215/\\kmOD\307\212\025\313\326\367\336"
+	.ascii	"{\364Qk\243rw\303\316\316N[\313V\317\342\204\304\241\265=\021"
+	.ascii	"\2333\253vf\223U\252\330\244\031\344\371D\r\225\253\264\333\244"
+	.ascii	"\217\225=L\320\332Z\264SL\225\034?\210\306\234'J\243B\205\311"
+	.ascii	"\035\237V\331\333\\\0360mOT&EJ\225\343 s|Ze\027\013\353\3039"
+	.ascii	"&\306\243N\333\023)9\243D\251r&\034m!\207\254\256\304Di{\"!\366"
+	.ascii	"\211}B\306E\304\303\222Y\262\372\306\341\307q\256\310\330^\333"
+	.ascii	"\023\3158o\231\260m\322\204\327L\270P:\n\020\205\013\336y\346"
+	.ascii	"5\363\267K\354\022\226\373\335\333u\304t\343\032\232;\036\373"
+	.ascii	"\212\2217\207\007\\|ZeIl\022&\306#\347m\021\266G\216t\221\311"
+	.ascii	"\035\342:\317]4\207X\"Cl\230\375\262_6\354EP?\314.sD:\344f8\001"
+	.ascii	"\273\r\3435\"\034i\326\356\332\332\027\206j\234\027\222s\236"
+	.ascii	"\237\260\345JZ.\333U\253.T\227\007)G-\020'\3601'e\2050\232\032"
+	.ascii	"D\230\264E\002q\001\302\306\243\355\205\304\234\277\005\302I"
+	.ascii	"\013\244\301d0N\300\013\317\235\220\332\371[\037\234\264>\254"
+	.ascii	"\326\257\352\336\035\035H\231\343\323\322\263Z\277\315\262?|"
+	.ascii	"\320x)b\245mw]>2\t\300\305F\346\205\310,\016{eq\330\0366\207"
+	.ascii	"\315a{\3241\177\330&z\276\252\270p\333\203\341\242\350$iky\230"
+	.ascii	"[qjcm\355\216\276\222\212Z#fu\324\235y\013cuX+\276\275\261\037"
+	.ascii	"\375V\272\215\021I\263F\241\256\363BS4\254\r\032\266\206\255"
+	.ascii	"a\251\316\242\234<\307\213\205\365\301\347\213\214I\036\335\371"
+	.ascii	"\240'V\312VY)KeeX\031\226J\217\031\305\004\007\023;uK\3052h\310"
+	.ascii	"@\023\244u\036H\217\317B\361\331b_\237-\3625\346\335\243*!\305"
+	.ascii	"\266\277\275\267E\226+\215mI2^p^\306\334\264=P\335y\240\266\363"
+	.ascii	"\257{{U\314\204\013\245\303\003\331\035\020\031\235\212\207N"
+	.ascii	"\315c\336\313H\256\034\306\327<u\352T\275\263\310A\314\021\353"
+	.ascii	"\303\257\311\030\324\226;\257zj\364\276\364\264\255v\252\227"
+	.ascii	"\217\017(\"E\240\260\363@:\316\277\306\341d\215S\3612\030S"
+	.string	"\240\223sw\215F\020\025\357\257r\352]}A\210K\034\223\250\266%H\274\3161\313\274\b\301\3236\203\313Gf\345\302F\346\177\370\336\274\351\253\021>oQp\356~\332$k\233\246RR\271?n\347_\355\354\352\232Z\305u\255\032 v\261@\234]Ta\364\274\256\371\377\276A\\\306\037\334\034c\225\266\377iCs4\265\356E\367\336\250{\201$1\305\322\274\326\t]\345\310C\247m\245\373-\341\353r\347\247ln\256\242\261\371\361\023V\246LE\333\203\344\323\322\373\3611fL\225\303\003\341\3161\356U\256\341\362$\311\373\251\021&\f\3311_\nAd\n\246O%<x\321\224T\n\241Ca\013\250\004^4%\375R\324g)\035AB\250\202\270a\210\246LA\022\204\303\030Ca\222\210\244\026\216b(\001\321\025\202/\202\276\024\002\306P\004\214\241Q\023pH\002\214a\320\360\211)\b$\001\230\002Q"
+	.string	"\340K!D\244K-\202L\031\240)0M\201\246@\245\027+Z0\"\006\231\230\202M&\232\002+\260\341\bI\005\n.\222\204LIF_\n!\"\251\005\r>_\nA\3540D\211\276\024\002M\002\016S\026\033(\r\205I_\n\2016\005S\021\304!J\202\340PI8L\n6\231JJ'\214P\022\b\233\232\320&\237/\205h\341\024\034\246D\021\250\322\023S\222SP\304\220\370$B\003\023\323\223\223\223\320\311'e\201\232 H4K \034.\245B'\237\026\200(\223MQb\023\332d\016\321 \323\213`\312\364\204\002\332\024TQB"
+	.string	"N\244h\013\f\204\303\030%\f\215\210\351\213&4MO\300XA\t}\361\"\350\202\210aD\210\324\351I(\002\021\020\211\020BD\024\320\026\200D\246 \220\204\224\bd2JY\020Q(\277\024\242\305\023\013\250\222\b%\246\340\023\013\034P%!\n-\236X@\225~\302a\214\026@\277\022R4\305\020ez\342\200\266\030\002Uh@\"R\032\002\237Jx\261\002\203\022\bQd`\001\f\240S\020\205t\bLS\274\020\n+\260!\r:\235 TB\212\013\210N\302`\n\002m\n\252H\321\022"
+	.string	"\2006\005U\234 l\301\351\004 \0244 \256\310\200\270\002\203\024mQ\244\002R\211\020\031\224\200\302\n4\241)1F\n\030h\n\277\2248\f\222p\004\244\244t\342$:\005\201\251\223P\210(T!\350G\205\013\"0\325"
+	.ascii	"\003M\301\005\021\230b@\233\202*"
+	.string	"\320\024\270B\022\nc\004\021\320\241\320\251E\220\203\023:\034>%\001Y\200\001\312\304\024l\032\242*d\030\262@\330\202\323\t\030\b"
+	.string	"\205\003tH\n\246\304`\nLS\020\321\025\206\003\310@\\\341\202\bT\221\242-8\030\r\215\b\221\016\201/B\270 \002U\240\303#\242\321Q*dJ\241\201\350\202\bLK\027D\240\n\027I\350R\006\364\t}\032\001\321\220\020j\202`\n\241\024Mq4\004\242L\"\b\241\251\260I8T\201\250\205S0E\006%% \324\004\301\024DJJ'\206?(\t\204M\350\nK\304\247\0235A\220S\t\204(\202^\254H[\b\246x\001D\227~\236\024\034\242Nh\213\363\t\370"
+	.string	"\001\037\200"
+	.string	"\303\347 \2040\"\204\021\346A\b\201\004\211\020> q\376\003\0225\365\211\001\034\016O\240O\350\323\005P\026NB\"\020]\001M\002\016Uhx\001DM8\237\224\022\203\025pzZ\301\005\021\230\002\241,\224NH\235\202\325\347K-^\\@d\321\"\330\202\223P\004\f0\206\031\232\210A\247`\323\020MQ\0240\200L\350\nJD\241\021\252$DA\310\005\021\230\376(\241L,"
+	.string	"\235F \006\177L\030.\020\241\205$\f\031\210+\200\032\322/\205\020\341$lj\022&\001\200\230\242.\222\236X\360!\262H\223\200/\232\204\",e\200\001l\252)\013a\013N'4\001\207-\204)1h\202\013\"05\"\256@\231\202\251\023\2324D_\004\245NO\302\2442eQ\302\003\3410F\th\nd\032\"\256\200\001l*\315\024\230\022\207\320&`\nC\340R\222E\233\200)\270 \002U\260\360D\004b\022\n%\300\242LB\227\222~INO$\270 \002\323\223\270B\211(5\277\244\301\205/\320\241\210T(\034\212"
+	.ascii	"\"\256HO\020S`\232\"e\301\302\005\021\230\026\241\351\023\013"
+	.ascii	"\301a\232\002\1771\322\340P\030\034\252\220\024l\002:\305P\""
+	.ascii	"JY|@\"u\n>\235D"
+	.string	"%ap\210\252\200\2668\341\202\bL\207R\026hS0\005\"\256H\211h\n\254\200\013\"0=\"\256HO(\241L@\247\026\301\024)\021\310T\224\236PB\207A\"\212\"%\002\231\204\210+\322\023\250S\220I\t\210*\005\245,@H\235\202O>N\302`\032$\nUx\001D\227\202P\246\244\030\"\240-\200C\224\004'\224\320\024\370\"\230\024L\235\200\300\224\tE\201D\\\261\224\216 \321\364\224\242\205S\220\004\302\246\0160\200M\031R\026\351y\022$D\360\260\"\205\022\316\244\020C\224\351I\t]J\"\212p\n\002\233D$\r\211\"Bx \256@\233\202*\234\204\301\364)\t\2051\002\0230\025\246\026\3747\317\364\265\f\032Tk\346\272~7\306\370\340a\306\244\032\322\033S7\243L\255\233Rb\004C\306\244Q\343\2664!\223\013\253J\316\344)\232q\346\2163706m\317Is\214\335\223"
+	.ascii	"\236\215/1\346\017\333\343\b\330\2220\374FG\306FT[\023\316\374"
+	.ascii	"r\023\314M0m\202\251}}\246\2244k\246\355\322\305t[@\027\2730"
+	.ascii	"e\035\342h\321b\272\001\271\311\343r\323M\212\r\213\255\255\271"
+	.ascii	"\245\303\334\371\233Y\302\204\214,q\303\206\205\345\270\250&"
+	.ascii	"\315H['O\2668s5\256T\261V\202CI\035\266R/K\312\232\034+_\216"
+	.ascii	"\\\301\t\3226\207\021.\265\312\244\363\266\334\311\221\2443\311"
+	.ascii	"\210\325\351H\203c\235\244\345\230C\273#\232\001$\216\236*\245"
+	.ascii	"\232!Oj\230guM\026\0177\031m-\300\"\303\321\026iv/r\310tr\204"
+	.ascii	"\312m\212\355\241\303\r\221\242\224\2127\224\243\315\027%ff\324"
+	.ascii	"\231f\205\354I\024\253u\302\275Q\222\003\212\245j\032P\366\340"
+	.ascii	"xb\213 \324\302\256\224\331d\371\204K\023(\262"
+	.string	"<NJ:>c\214\024\3654Ic^\311\320\3236\306k@rU\366\2760\251o\226\315G\230\327\222R\313\320\034\225>\"br\235EEv4\217\025\355\b\025E\313T\022\207#\212\236\027\314$\265L\311Z\0203m\301\300\314#?<\020\340\214Fn\0369\232\343\225\243\255Y\244,\216\032,&\021!<`R\314L\"f\030\021\0220\253\250\326R'\312U\333w\2003\273\314.\363\353W\034rCGgG\357b\361\370\360\233Cn~\311\265\001\203\033\323\326\364\342\265\212\206\017I\0071s\313\3342\271\370\032\273\230AnrY@K\222\027\332\232@\016\027\246V\206\213\210\017\037\346\017$\256\342\034\002\210uIb6\302\370d\316\314\272\371\243\212E\261\272\222W\305\330\214\t\241\262\272\2722\301\204\212\223\262\362\013/\254\253\355;\024]p\301\356Y\320\004\215\212\023\236{\263\243L\333cP\306h4w|"
+	.ascii	"m\312\330o\017\032\266+\0357w\230Z\252\204\334ikZI\301\201\243"
+	.ascii	"\276q\0212\212\016\313\361^\254\017A^\310\254\310\264=\006@L"
+	.ascii	"\033\246\215\372\366\204\t\024\343\326\216\267\344\033s\2069"
+	.ascii	"\303\244\301\026\005\246e\301\362Hic\322(\303\360\370\340\332"
+	.ascii	"S'C\206I\305Un\016\022^E\344\312\356\305\372p\364\005\017\314"
+	.ascii	"\324M\252(o\310\253\267\322\313\316\233-Y\314\242Y4\243\270\b"
+	.ascii	"\031\365\006\317\235\t\027E\315\314\204\272\0315Cj\210\2223z"
+	.ascii	"\370\210\230i\373\013\310\362\344)\373\220\270\252\234\243\235"
+	.ascii	"^Y\233\021Bd\n\337\313>\"\031tpX\265-\365\224{~\356\310\304\230"
+	.ascii	"\331\263'\365\003\017\n\t\350N\311\232:i,\025&X/\264\375\005"
+	.ascii	"@\354\330)\365\350\316b\261\352Iy\347\245\036\233\017;<.\240"
+	.ascii	"\201\207W\322\001c\242\344\213\017\021\274\342Y\231\367\222\016"
+	.ascii	"\220\22768D\332\276\316\207\377?\"\032jv\242\334\310\221S\336"
+	.ascii	"!q\025\347|\020\313KbF\224u\244.\352\256\223\265\r\331\234\222"
+	.ascii	"\266\3470e\315\232\022\016\222\330\216\"r`yJ\336\336\274\204"
+	.ascii	"\363\313\241w$N\333\322\r\277U\261\2636fm\003\206\266\250s\002"
+	.ascii	"\264j@\226b\220\243\n\031\032\232\231I\222t\203\025@ @D\036\222"
+	.ascii	"\312\327e>\023\300\003\212\313\325\231\240\005\025cHFDD\212\222"
+	.ascii	"\244\220a\016<\t\"\334\244\"\267<B\235\324k\246\302{2C<\363\272"
+	.ascii	"l\035X\263\220[\247N\241^\t\264F/\f\241\357}\241h\344h\3008\217"
+	.ascii	"\362Bd\261\216\372\024\311\204T\031\004\350\333\"=q(a\213\336"
+	.ascii	"AY\217%\347\301\312L/\341\316b\224\373\343PE\025\234\212#\177"
+	.ascii	"\205L\367'\224J\265\203\337\"}\030\200\232 '!\001\347\325/\371"
+	.ascii	"\306@\266\321l\020B\350\232\347\324\263\371,\t\t\307\323\206"
+	.ascii	"\022f\367G!\223\242_8Ewm\215\241y\212Y\330AL\370\366hX\241|\231"
+	.ascii	"gS\322\211\027d\323X+G\221\323\002\330 \356\3369\231\225X\344"
+	.ascii	"p!\267\206\352\355\223\326\352\243\204\021\017u\2760\364\201"
+	.ascii	"\f\242z\274\360\033|8\344\036\302\355\265\344rz\3435n\025\207"
+	.ascii	"\276\317{\272\200\341\361\t\276\367\242QI\363\220\201\214\222"
+	.ascii	"O\211{\004\377o\343\354I5nP\020A\200\003\277[\271A-crk\263\004"
+	.ascii	"\"\246\003EQ\370\220\265K,-\360)a\334\347\277n\037P\013\020<"
+	.ascii	"\003\001e\345\343\207\025\344\207H\366:\n/\203l\016~\260\307"
+	.ascii	"h\234|k\254z\262\2278\353\023\355\224\250>\034o)i\332\tk\256"
+	.ascii	"\005K\305\335"
+	.ascii	"\021d\315\302z\210=\321\032\253u?\n\204\203o\0333\333\326\344"
+	.ascii	"\364\030\021\272\237^\031\226-2\245\332\320\357\236"
+	.string	"\360\001\033+\244I\250\001\025\230\232@\304\t\036\372\203\035:\3107\364(\232hj\200]!\24744\220\367#\315\235M\376\234\nd\235D\324D\"\024\"\310\310\027M8\260\276\021z\265t\003\362\177-\370\017\270\f\"b\276s\327\326_\224\326x\b\247_\023\343\361\241NN\304;\367w\324\001\005'h\305\210\215\252\304\260'\2634*\341\230c\272\300\fJ\357\022\364\305\213\267mOD\0011\260\b[/\215L%\307\032\002z\346\007\262\005\021\247\342\310\335\277\r\"\347\002{\\!A\003\275\006\240\375\007\250{\367\004\031\202\322\241\347\342\264\240\215\f\270\255\240Zt6\234l \347\024<Qs\327NCk\237\022\004\211\301\273\240\2421\232\003/d_\374\316\037\005t\245c\344+\320\367\006\035\270\377\203\343n^\360&3\003\225W\271\027n\272\242\b\025\224\336\212\232\336\265\221xK\362\007\254\356\034\033\017\t\025v"
+	.string	"._\313R\232V\327\370b\302\270\025\332\261BxR&\364\034#\262\020@\241\265\003\212wc\251\f\036,\2421JP;^\275,{k\034\352e\332J+\307"
+	.string	"\003\273\331[p\250y\331\204\255\203U\007\203\345q\273R\352U\3537$\335s\260\357\366\225\017E\036\370r\323\272^\345\324\271\035!\350\252\301\322\302j\350\177\261\2139\3043\324-\333R\2273\357\033\253M5\371=U\227\267\243)\245\216(\263\252\226?\245\330*\206\254\255\252\004\276\0240\235\273V\243\315\335I\325\312!\275\353\023p\312\035\200)\317\255\200\036\346\026w\371\243\253\263\030\214\351z\352\217\031$\270\364\245A\017i=\214a\r"
+	.string	"\205\216\244\270\342:P~\204i\220\326\371s\326S\025\271\021\325\235}\221:.\374\221\351\205z\200\317\273\327\005\034@k\335.\272\0324\307\263\312\027\310\213\247B\255\236\320\220~"
+	.string	"\033/[j \2550\261\337D\314\n\227x+\376jmA\017\262\027X\016Y\235uT\326\346\245\320\200\363\021\370\345\330\216\3366\370\207\362\326\370^\303\006aX\357\230J\242\334E\226\rB\0361i}\223\217\246D\345tu\232\322\245;;\347\324\346\340\007h\331\266J\023\335\233c4\302X\034\035\262\006\342qs\006\274c\017\220>>25f\256\250\374x\353f\2233\224\332a&\3267w\030 \r\006L\314\264N%\241;\235~r\362R \206~G\324\213a\376:@/\236\240(4w\342\347\006\237\276\315c\300\017ej-\352\333g\313\003?3\365dT\026\354\263\332\255,)\016\b\232\330\221\351\230\226\3463\021)\231\200\221\343C\330\243o\275\270O\353\252\177\265\200[\002{\2458dE6b\274\nT\0347\2410\206\335\377\t\034\216^_J%]x\263\221\2704\302\023!rf\257c:\205"
+	.string	"\332\274\343w\260\220\367\024\207\375\252\366G\233f\243\212l\b\267.W\373L\204\276g\321\370\2764LZ\226;\200\223\0328c\006\030J\027\204\026\320\232\006\303\362L\373S\224\231\321\302\005\373s\376\372(\202\327\221\367#\234\037\004\247\275\216\221S\b\262\002:,[q@\244D\247#\2708\201mX\212\254cc\310:0\034\254$\357\017\240\205\024+EpD\236\006\t\025r}\002b\256YwT\340K\003ZRCi:C"
+	.ascii	"s\025]Z \247\322\225\n\205%\035\352\037\023\352\206\355\232\034"
+	.ascii	"n\307\023\220\222B\233\t3\304\250\223\311X:\354\350\331|l\033"
+	.ascii	"\b\301\231\033\231\365/\344\227\212\211+|\316<]i\036~\200\320"
+	.ascii	"\233r\237\257\212\255b\247"
+	.string	"\020\r\302\207r\202\352K\230\273&5\246\232+\331\241\302\242_c\370\307b\326\227\002@\350\325:\304\372(\024`\332[\247{\007&.pj*>\305I\260\177\030tb\334M)\207.\\D\267U(}X\350><\260\006Fi\275n\331\274\004\204U\371<u\306\202\356\213\260$V\302\365\302\311\224,\347\022\266\\\037\022\312\024\333\241\n\267\234A<9\n\326\332\024\212\257\373\264\222\322\367b\322\330\254p\227\023\fW\224~%\1770\252\357\300\035\t\252_\334\372\343\254\313*L[\251?y=\210t\003\201F\251GM=@+\270\250\360^\024\212\213a$,\377\3357\301\210\306\323\244S/X\023\235\b\220\025\340D4bbl\306\230\032\360d\222U\351UY\204\275Bm\2661@G1\373\234\r\200p\263\013\204a\310\217a{\026\240i\266QtT\241\266\231V\320\3512\233\004k\310\320T.q\t\0066"
+	.string	"l\275\230NT\324)\241\345D\b"
+	.string	"\032\036\347\030#a7\331G\372u\374S+\342,6\372\246\375\364>x\371y\307\3465\005"
+	.ascii	"\036?\363D 9\276\314]h\317\365:\370\224\303\246A8uuyR\362\306"
+	.ascii	"'\005\303\220<hx\350\200aZ_\313I\343\202\230\336\240O\200\231"
+	.ascii	"40\037Me\006p\265\202\321\247\362\013(\t{\245\231\177\232\344"
+	.ascii	"6p\323\006Wt\246\177V\374\b\313\265r_\007*v\354\251#\220\255"
+	.ascii	"\326\3070\324\231\351e\334Ij\223H\022\361}U D\252\bKb\241\377"
+	.ascii	"\020\374\255z\215\340l\237\333\315;4\231\212\231\244TSxll\310"
+	.ascii	"\2424\215\350>?\231*\256)\005\303\373\257\331g>\235\355Y\021"
+	.ascii	"\215\027\343\227h\243q\3469^\024;<\0079\332\3246\377\347t\177"
+	.ascii	";\264\246\252g\212\355\225\f\354F\020Z\bn\"\253$\247\033D%\373"
+	.ascii	"o\332\036\301B\374\2151\236\342\022\207\215i\216\275\203\311"
+	.ascii	"\307Pt\340'd4\330\264@\362\311\033\272!$\242\250\204\210 \362"
+	.ascii	"\237\024_\377\354\302IZ\305\257\017\307\200\237b\344\f\323\230"
+	.ascii	"=\207\376\225\371F4a2#yq*j(\324\033j$\002\314j\031\004%X'\344"
+	.ascii	"\370f&\237\313\312\242\273r\023\310+\302g\375\b\230&4%0\221\036"
+	.ascii	"\2629\035\263E\2305\272\341|\251<\341jQ\025\210\323\335\rT\230"
+	.ascii	"\030\0277\026\004l\353\216\346\226Q\250g\341Y\242L\233\241\f"
+	.ascii	"\331\033\316\263\265_\246un\346\242\351\276\277\355\324SE\r@"
+	.ascii	"\017k\315\272\227Wt6\3007\275\343\020\210\231%\361\234\250\033"
+	.ascii	"\017\233\007v\212\212\261\351\\i\032\004\354\275p\023s\262\362"
+	.ascii	"\267\301\240s\350"
+	.string	"\266\345\023\310\034H\243G$\243mD$c\347z\305\361\246\021\021\321\325\363$l\211B\241\276<\2216\317sG\244\001\2265>\263\033\035|\274w\006R\260\020\0033\311\232\252I\341\013X\365\331I\237s\2152\267\235/\177\2779\250\342\2754\373\273\326+\374C\210\332\330\027\355}\031+\313\r\026\216;,\241\352\217&\215N\202\356[oT'\251`\320\374`i\236\360\313\256\246\364\347\250\031\277\343\2729\\\027\252\003\322\256\021edj\331\021\200z9\271\312W\013hWT\326T\354\241z0#\226(n\350w\200\037\353\ni.\340y\216\245]{\270A\265\030\220\311\341L\250PB\234\261Bd\277m\255\340\274\224\013xhi\371\204\357\257\345u\363>`\367\322\312\206\274\316\324\323W\266\354\377p\322\276\265\004]\006-\201\201\363\267\365\336\007%\334fr\0018\036>i\221XxD\300 J\310\331\306\0138"
+	.string	"\302\242\242\246\025\222\343\025\313\205Y\374\023JS\215"
+	.ascii	"\n\366\034\036Wdc"
+	.string	"\007\362\r\275\335L\224I0,E\177\222\352\301\363\036Ck\367%\223F\316\247\206liG\377\377E\370\277\226S\350"
+	.string	"\254\314^\371\256"
+	.ascii	"\006J\2563\330\214\364\t*\025\035>\2200\236\026\340\366eM\td"
+	.ascii	"2\253\025S\004\360\034b\016\363ti\2270\334~~\265\271{\255\"\333"
+	.ascii	"\277\307\030\265[\341\375\371\267@/P/\267\330\270Vo\256\027\216"
+	.ascii	"| \340\\\330?\246\260 \356\3535\016\323\001)H\tt\277?m\013\260"
+	.ascii	"\205\337&\031\013U@\266(\344\221$\037-\003\343n(%\321\377\031"
+	.ascii	"\024 M\243\377\204\376\017\020\305\231>.\264\204\363`o0\020\365"
+	.ascii	"\340\235\257\2044\263\202}\323\334\213\352\321\212\003\254j\227"
+	.ascii	",?\223\375\201P\366j\343\006\323\254\305g\0253>\033\277\037\035"
+	.ascii	"\336\215\277\032k\214\330|<\360~\313\237\003?\276&\376\366\210"
+	.ascii	"\026e\3022\374\345S&\016\005\340#\321<y\303\215x\335\277%\344"
+	.ascii	"*a\313=\356\372\356\224C\237\340\315O\314\035|0\336t\363\376"
+	.ascii	")\377\262\3457\371\256\202\347\237\355\262\263g\247\343\312c"
+	.ascii	"\331?_\263fP\345\237\b\363v_\327~\275\004\2716\357\362\312\262"
+	.ascii	"\027\207\376\276x\266\033\377\335>5\232\340\344\352\361\271\317"
+	.ascii	"\344b\320}\335\247\361\251B]i\326\353^\223\217\333\374\370\260"
+	.ascii	"G\255\353c\272\327\032\326\3574\373\275\362t\220\301Cs<\366J"
+	.ascii	"\371\246\200\367\244\357\"\341'\252\333q\351\237\341\336\023"
+	.ascii	"\377q\361_\033\007\t\344\177\321iE"
+	.string	"\202+\225\272\200\3028`m\227z\n\344o\264Cg\220\371\027\366\263F\210\013\344M\f\372\375x\353\003z\272\207\036p\305\337M~\203\245\325\017\273\367\271\365\201p\262\"\253I\332\355]\330/\026\317`\307Kv\033#qC \203\353\376\310\277w\343\257\252\017\306\r\024eg+\327\nA\237\306\341\177\021\375\315\243\2072\246\2443\275\302'Y\3328\270\200\032o9\355w\236q\003\371\023\213\344\336\024\374\212\233]\241\311\255:\235\b\266\211\321k\253\247\274\336\020>\031\3543\341m\033\325n\200?\236\302C\002\321o\350\354\243W\233\321\334\241/oAp.\263oia\327`\220\306\341F/\n\356b|\207\016\036x{\027\315\362\213\215&N\321\377\204\240\3437\354\350\224/Y/\346\376\344\353<\363N\226\177\306\376\303\001\370 \206S\001\364\026\030{\001\364F\354\307\340\030u\351\264\344\270#\271a\364\266\230M,"
+	.string	"\177d\325\243mo@\273\240{\203{\243\374\021\342O\030>\004\230\275\004\277\300\b<\374\247\235\203\211\0260\375CO\313\366\027\346\275$\276}\330\227o\377\377\272\332\312=\274o\207\317\n\352\335\217\355\325\207\354\350\310O\330\361\027\263\250\333\307\204E4\311\342\250\030\265"
+	.string	"\371\243;\017Q\366\036\336\355);\235\324\177\320\237C\034\336\3577\262O3\363o\347\242\211?\203\356\211\336\235\rM\033n\226\331\027\037\3423\345wO\026\326\324\316\207z\bg\352\250\311{\360T\\\0029\034\377\317\376\265\3572U\036\362\216\007R7\262}&\027n\317\266l\"\367\237@\031T\347\025\273\275k\367\372\264F\331O\361\345\263n\343+\210\275\021r\027\344C\2478}\316f\336Sj)\366\327\344\001['\252\314\024\345J\245\3432\236(\237CxO\177\371\202\237\017\231f<?\253\257_\037b\373\252\372\346\323F\323\203\337[;\277{\350M\361\221\340\023/\334\260\353\013\322\306|\277"
+	.ascii	"\356\205\306IH\337\177\377m~\267M\356x\233<\366\363\272a\317"
+	.ascii	"\325H\277\210\033=5\334\035\342^\3076\346_\361\\:\3752\334\030"
+	.ascii	"G{G\372\274\371\324+\352\033e\214}\225/\354\301\345\036(r\032"
+	.ascii	"\320\311\263\036{\2708j\372\244\332\267>\377\313\326\261\257"
+	.ascii	"{^j\373\013]\026L\333\020])\034\254\271\204i\334z\nr\236\301"
+	.ascii	"\237\0028\013\356\256\373~\017\232\256.\321\004~\344\""
+	.text
+	.section	.gnu.lto_.symtab.bbe424109fc4e991,"e",@progbits
+	.string	"taskHistogramPermille"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"checkFuncMaxExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"checkFuncTotalExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"checkFuncMovingSumExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"checkFuncMovingSumDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"schedulerIgnoreTaskStateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"schedulerIgnoreTaskExecRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"schedulerIgnoreTaskExecTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"schedulerGetIgnoreTaskExecTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"schedulerResetCheckFunctionMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"schedulerResetTaskHistograms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"schedulerSetTaskHistograms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"schedulerGetTaskHistograms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"getTaskHistogramInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"schedLoopStartCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"taskGuardCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"schedulerSetNextStateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"schedulerGetNextStateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"schedulerExecuteTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"schedulerGetCycleTimeMultiplier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"tasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"schedulerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"histogramCompactAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"schedulerTraceRecord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"clockMicrosToCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"histogramCompactPermille"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"histogramCompactReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"schedulerTraceLateCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"failsafeCheckDataFailurePeriod"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"rxFrameCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"clockCyclesTo10thMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bbe424109fc4e991,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1023 @@
+	.file	"scheduler_trace.c"
+	.section	.gnu.lto_.profile.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\025"
+	.string	""
+	.string	""
+	.string	"\026"
+	.text
+	.section	.gnu.lto_.icf.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\245\b"
+	.string	"\322\31404`oZ\003"
+	.string	"m\321:\213\242\207\361\023Z\363\214\305\346\352Q/\353\342\0244$\236)\b\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\203\3548\244\224\335\222H\271\245\334r')\003\355~\267[\213\272Mch\005\305Bs\277\333\355\365Z\267\316L\307<\267\324\225R\3600\320*\020\307\007D \232|\210\260"
+	.string	"\371\206\206:\234\n\200K;\024\236\016;\274 \361\\\025\2222\203\221\225i7HE\243\221\214\3762J/'\230)\227?\331\340\362\301dU]\275\214h\271X\342O\204\264p"
+	.string	"\3431\016\337\324\324\006n\204(\250\274\367{V\020\006\003grO\356iH\220P\342\361D\3002\t\267\273=\345\204\206C\251i\232\203\b$ p\202R\225;\244\340\326\\:\022i0Q\026\rt\261\220\216\200\367\365\026C\rX\246.\327]\0317S\253\003\271;\306\340\f\315`ZS\2269,\3119\320x'r"
+	.ascii	"+\300\205\300\032\300\234\272\2755\036&\316\220\363v\251\377"
+	.ascii	"b\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"%\004"
+	.string	"\362D\016\026\260'\215\001\f\203-I\022\314\314\254\335\204%{m\"\245\224)\005\364\025\246\t\003]\333\027\334n\201:\345Q\032\246\330B\212\232\303\366*\361H\204z\266K\272\345\tpC! p\2029i;\006\007\224\032\bD\206Lx\207h\"\027qxvb\201u.\r@\250\265!)\323\032\201\323\302.\344\210A\034\004gA\r\022\271\f\"\035\024\003N"
+	.ascii	"VA$\233ll\230D\r\324\026-\221\002\f\001"
+	.text
+	.section	.gnu.lto_.inline.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\255\003e\020"
+	.string	"\246\324H; \345*\035\307fl\300"
+	.string	"\2400~\026`\030\263\243\252\024\314\342s\024\324\264\373O\350A\351\001\310\b\261\377\307d\205P\004\225\200"
+	.string	"H"
+	.string	"p\224\022\336\367\227EeQ#dK)S8"
+	.string	"6"
+	.string	"7"
+	.ascii	"1/Qn\026`\236\316z\325w\377?\236\310\266\330\b\354C\255\312\214"
+	.ascii	"\266\002~\303\371\363\177\217\334\257\270\335\335\336\217Z\022"
+	.ascii	"\220\r\226\323\376\232\342\027\234\310\315\364\207.;\002;\273"
+	.ascii	"{so\371g\217|8\365g\316\312\237\301\356\341\344\016\263\326#"
+	.ascii	";,\321\335\252\313\037\202[0\031\271\203\b\256i\204\270\374\004"
+	.string	"$\365\277\202\235\036\224\031\331b\"\245U\322\252.\016\205\265\"\270he:\262\254\2735\007}D\0065\374\177\264z\004o\264\017\337\217\356\376\336\341\210r\334\336|\312\034\335\335=\023N\205\025\255\252^S\001\377\365\343\307\260\266\356\0360\005\204:V\250\323s\003_`\230\304H\016{k\301h\005\002\245\2238[ZX\nW\255\005\374\350\1778\023\270d\005\300\265*\357Om\305\313#\305\200\377\007m\250\341-C\"A\315\246\2246\003`\002\231)3;\022 fE\350$\231`DPIi\271\036k_\200\201\366/,\313\177\356\212\254\313\025@\224\327\352\320i\257\206\276Xg]\001Iv[\336\276\215C\264\330\240g\005\314d\323\033\006#2\335\222\206heIq\310U\246\264E\311\276\354\003\336\274\214\376E`\324\200\222\232P=9\334&\020n\251\017\001S\263T\025\017u\226\262\025\001jS2-\213\356"
+	.string	"\327d,\306\221\243\265, 5\366\315\327\007\304\305]\341\215DA\221;\026\270\347\215\316@\"^\230\023\0165]"
+	.ascii	"*ET\344\245\267\225\264\016o\230[\305k\"\322\fAQFQD\377\373d"
+	.ascii	"\0375\3404\350_\001\002\276pe4\264\333\361Jk\314\366\036gc\002"
+	.ascii	"\270\322\306\033\322\037\001g\n[\224\004\350\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\375\006E\027"
+	.string	"\006\337hC q\223\016\001\030"
+	.string	"t\362X\241\343lXC\211\b\344\024\f@\001]\255\317\323\021\021\200k\263\322\f\267-+\033E\350X\331s\214\270\344\210\373\034\202\261\t\305tG\343\250\211\242>cr\273w\333[\246\024P"
+	.string	"W"
+	.string	"N"
+	.string	"Ny\322\256[Rr+\256\035\374e/H\356\327\223=z\274\247\276\366=\261{g\237|+{w\357\034qO\343\237q\210\001\372-\370\032\244\353\272\356\365\237\370\177\342\336\037\026\246|\230\272m\r+\036\247\274(\262\331\232\351\2161\001\263\2603\031\002\250[G|\377\253\213\270\256Pj\266r\366\037\377\306\327\200\365\205\344\256\342zp_`H\316\304\365b\215!9z\275*Cr\n\256gWy\002\307\177\343\t6\222\210\020R\244\" X\337;\342}`\277\206\363\260\301\267\276\023\377\016\2125\260\317\036\261*\005*\254X\b\236\256x|#fm\"2]U\323\267\361\223\357\337=B\330Br_\201\362\375-\013Z\347D\237\023\367#7\371\006B\353\235C\\oBv_\205[\241\337\275\262\365\016j4\003l\020\373\303\016\331\372~\001\266\003\330"
+	.ascii	"lg|\222(\024*f\361P\220\200q\350\364"
+	.string	"\\\321\rD3\321\210MX\210\001\025\201\262\355\223\321\222\313\210\222D\232\345jd\302H44K%\332BI\333D\3216\023-A\247\013\311\004a\3024\r\01315l^\032\311\365\300\325\bD3\32263\272a\331in\031h\323\246\210m\216h\t\003\265L\017*\023:\033X:\\\001\200\231\250a\311C24I\222\202\324\350`\002\021SF\364\022\240\341A\b\006j\020!\244H$\020\231 M\nu\2069\345\313\273\340Q\220\252\346\375\\\254\356\226\273\001(@\227\027\247\260\201\353}\347\324\256\214\232i\346i6Y\334\255mp4\306\220(\020S\374P\024f\017\001\262D\342\031\212\f\317MZ\351S\304\244V\013m\300\2500\333MI\257\370&@\204\352\207\310\302\374)\272K\344\314Fv\003M\r\177\2515v0\315\235\"\341\240Ll\n\265\356'm\334\001\006H\330g\300\373\314g\326O\204{Sx"
+	.ascii	"\257\003P\225\375\334\370\217\017\322\373\310\304x\377\242\030"
+	.ascii	"\322\202\022\263mv \224\221s \237\006\351\006%\021\275\212\307"
+	.ascii	"J\273\3209cG\020\022\243\342W\235Q\227\343O4\365\327}C\2230@"
+	.ascii	"x\224?3t?-@\224Z7\262\207g\213\032{G\026\360\331h\232\210L\215"
+	.ascii	"\002\227q\225h?\214C\254\206p\003\036\202\001\250X\334t\006\216"
+	.ascii	"\211%\324\333\316r\211i\327\365~=\227\031\3456W\236\013'\216"
+	.ascii	"k\17791\252Q\335\252@\245\017\255\370\372\237\360\226\355M\314"
+	.ascii	"\256\352l/J\217G\001"
+	.text
+	.section	.gnu.lto_.pureconst.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\002\230\004\003\230\004\004\265\005\006\230\005\007"
+	.ascii	"\230\004\t\230\004\013\230\004\f\230\004\016\204\004\017\204"
+	.ascii	"\004\020\204\004\022\232\004\023\230\004\024\230\004\025\231"
+	.ascii	"\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"E\007"
+	.string	"\"\n\036&\220\265\031\016\177\374\356VPsww`\367U`\251\377\202\331\1777!\226\210\375\337k\375\366_\277\335\335\233H\231\002;\020\t\2640\201\253\311\312y\222?\332\243\222Q}\221i\332Q\336\350,\2243Z\212\212D\363Z\256Md\236\2077\374\330\204\204\347\300\225\273\366\005R\271\324~\326\250<\352|\n\327\204\312\241Vif\323\366\347S\376\360\225/\312\277\005,#fO\2001 `\002\231R\345\001\210a<\352c\304\355F\r\222pv\226\305\022\317.\245MMH`\231!\260\\\205\212P\211C\234"
+	.ascii	"t\273\001;\020,\\Qklwd\237\261\310\016#\302\271\335P\2524\216"
+	.ascii	"\313#TA\021\220@\343\001\354\021\004\016\301\332\305\324\006"
+	.ascii	"I\337\244uL\"\233\323\t\026\nY\004\020\220\332X\020dH\325\376"
+	.ascii	"\262c\270E"
+	.text
+	.section	.gnu.lto_.lto.28a120bc4390b5bc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_traceFileQueue.37.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\213\003u\027"
+	.string	"\366j\231K\240\326Q:\200\261\363\023\252\300\226\037c(p\205\214\245OZ<\f\206!96zt\351\201U4M\260\2517\326?v\001\304\2176l\365\r3\333\007\347\204\253\021\025H\301_\030\320\034\177\362M\2008*\240m\334\366\367&r'\031\206"
+	.string	"z"
+	.string	"\211"
+	.ascii	":\021\257\253]\013&\367\002\017\274\262\206\031Y\025b\254x@R"
+	.ascii	"\346\003\357B\350/N\222\345\022)\201\260y\275\306\334\305\276"
+	.ascii	"\222\007`\177@\0244\375T\020\367\275IW6\356\005\312p\315\353"
+	.ascii	"\225\231\031\001\215\020\347\016lBr\355\250\214d\030\357\005"
+	.ascii	"\312Z\305s'\233\346\370\272\223\r\225D\251h\325#\361&a\226Pl"
+	.ascii	"\251\364vdL\217\241\321\205\247G=\"J]6\367^\246\274\336\210s"
+	.ascii	"=3;`f\034\346\316\0217N\232\"\2576x\203N\277\030\365\206\037"
+	.ascii	"Z\307\314\034^\343,\320t\357\255\341_\235\006\017\337\351\225"
+	.ascii	"m>\364\274W\276\217}\205\265S\210(IT\277!zd\006\352h31\237\274"
+	.ascii	"\275\304\374\337\337\362\251\237\3451~\225\277\370S>\343\217"
+	.ascii	"=x\2061ek)WK\231\264\224\333R\246\226\362]\026<\031\233\fxr/"
+	.ascii	"\3221\312\035V\034,\036\374\231\205\370B\2161s\360\347\025F\212"
+	.ascii	"\024+\024\022)\226f\236p\"A\355+\032\207h\t\351&\305-\225f\246"
+	.ascii	"\360\341\331\276b\024\220\037>j\220\242TJ3[x\217\263}D#3\320"
+	.ascii	"\263.\324$\300p\036\031bA\210Q:\276\343\306\276\272t\304-\023"
+	.ascii	"0\307\237\026\326d\257\370\210\273bU\211\335\241\370\216\301"
+	.ascii	"n&\216u7\016\f\037D\024\n\307\334\237\226v"
+	.string	"\367\235\024%\301\372M\233:)z\332\321#\257Pz\316aou\034\264\227\246{\207\316c.\037\265Y\231C\226@fy+MW\255\247\204\335\312\035\232\007\0068s\206\273\305zl\267Yi\332\232\016e\332LI\233\231\270\033\263\334\371\251\2259\264\233\254Gg\306#\243\2317\331\214\001\266u(M\031\316f3e1\340}/\261\325\312\252\302\352?g/|\003-a\025\026\345\347\254\355#f\266\3156C\275#\005P\231\327\276\325\231\320\002,9\t(\201\020\201\236\307\261\024E\255\343\327\376\357\004VK3K\370\221\240\366!\211\n= \320\"\231\242\362\003\343\245\334\327^\213Q\341(`\262bU\313\207@A;7.\354\342G\342\026\273G.\356\301\352\004I\026\2518\007\243\023%)\262\342\034l:\341L\022\212\222\3109\273\312.\356\226WN\214\342\361d>,\334\363\260!6\0223]\261\006K\314\367"
+	.ascii	"\265A\206\333~s8\222k\034\024\006\351#\231\247\273\0301\216\201"
+	.ascii	"U\n\210o\2069\026\354\302P\314\031lF\370\006\256\326\205\364"
+	.ascii	"5\024]\007\n"
+	.text
+	.section	.gnu.lto_traceFileWrite.38.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"u\n"
+	.string	"\246\224I>0\3058\035\036\276\236\177\202\347\037H\213k\005\301|\007Q\323\201\320I\023\303\203\\9x\016\231\336\004\337`\224p\336\205\032\245+\200\001*otL\375\027i}%D\232#\021\332d\357\224\0025"
+	.string	"8"
+	.string	"6"
+	.string	"\245\306\234\355\325\345\017\262\327\355\006\331\253G;\300\313\217\3258XN,\002\273\313Q\217\217\237\243\377\222_HT\351Sk\330]O\022\245q\323\333V\260\355`?!?\206MO:}Mk\265 \f\330\315x\031XWM\t\261}\214\355Y\236d\374\312*\276\354n"
+	.string	"h\355\256\306\f\333k\006\373\264/\362\221\361\252\213\027\354\246VZ\273\001\363\2443'Z2F'\375\351\200\301\237Xl\273\313\361Y7\251\360A^=\"\315\223\244\354\365\024B@\001\225i\276\354\2624i\207}lw\3274e_\365\327\257\002\036QB\364\201\262N\354:\230\275\315\347u\241\030\021~ R\347\363x#N\364\351B\234\027\216\270\315\202A\212/\344D\020\f9L\271\307\226\246\374\200\3422Q\f\023\314\377\223UjO\204\002\016"
+	.ascii	"i\331'c\332\204\032\306\231O\247\215\2436^0\013\230\013\3571"
+	.ascii	"\314\013\004\006W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_traceFileThread.39.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`'\t=3"
+	.string	"\272W\264\023EP^R\007?\\p\007\254\036 V)\023\016\240\023\220'\322\330\316n!u\370\314\247\350\235\311\fi2\177mw\202\\;\353\202A"
+	.string	"\032\360B\f\342\024\032\177\321\003\t\257\r\034\003K\246\265v\357\275\267\224)\005%\001\030\001-\001\233\351\004~\261\341\371\360R\177,\357\346\3026\251w\312\371N\331\342\344q\260\362W\342g\273a\254\222n\255\032P\251\332\203g\035\303\373\254q\315\356\261\2730\377\232\277\371\342\336D\264t\331[\032\301\217\336g\177\312\253\305\356o\nH\243[.\033\336U\333\336\336R#\227\376\200\366\331\367\177\332g\265\021w_{\252\325j\365W\351{\217\3535\376b"
+	.string	"\237\036\"\200\2410\b|\335\226]u\216\375\235p}\321\307I\327\007X'X\355\211}\235\023\311:\354\273J\363g\316#\331gu\255\262\226|\2353\272^\350\313\233{7\253\334Sd\013\372D"
+	.string	"A\362P\270:\310\363bg@\326\222\346\2379\303rp\005BS\346\311\3279\237\253\220\330X\226\217{\005gN \031\250\340%\333z\276\273\352!Q\276\316\t\266n\3103&\356\343>ci]\345\366\311\234?\202Z\314v"
+	.ascii	"\022\272$\256\200\314)\246\331w\373\365\f\332E\215\217l\013\372"
+	.ascii	"k\327\353\240\026\327g\227\303\336\333sSk\353\375\347\335?\351"
+	.ascii	"\356X\334\335\273Bv\021\006!U\371\317\335O|\232\024\356\330\337"
+	.ascii	"\336\336UGh\352\220z\254\370\355Q\377L\224v\307\376\370\326\374"
+	.ascii	"\313\254\250\3408\236\f\213o\273\320\342\307 i\020c@\263t\315"
+	.ascii	"\257\240\352K\265C\375\372\343\036D\023\250\231+\260\034\271"
+	.ascii	"\252\337\302X9\331b\316\357t\355\277}\030\030Fw{S}\323\375\370"
+	.ascii	"`\2442<K\347Ip\376\346\217\016z\223C\265\322S\356>\343\347\244"
+	.ascii	"\206\242{\357#\377.\357\005\351o\366\254\323h\312\337|\326\277"
+	.ascii	"\251}\266\250\337\355\207\306\356\360\255Q\345\252\377_\210\366"
+	.ascii	"\335\255\272\314\335]:\365B4,=\255\313\37431\215\3135\021w\241"
+	.ascii	"\207{7\360l\357?\305a\233]\370f\017\276\331\201\337\366\376\266"
+	.ascii	"\331\3357;\373f_\337\354\332\315\236\333\354\277\200\200\331"
+	.ascii	"SlH\033m'\335Y\325<\233\312\3161\371-\377p\377l\377m\277\272"
+	.ascii	"\277\\\226\327\022\377\026\250u\203I7\327\177%\271S\333\333\333"
+	.ascii	"9\342}\366\267\317\377\264o\376qpQ\037A\355\326\321\251y\342"
+	.ascii	"\364\313\320\325?\315\\\"\336.k\305A2\025\3722\177\007\321\263"
+	.ascii	"\300\253\334\003\250\335-\271\264\003k\270\274\tu\231\337h]\375"
+	.ascii	"u\361X\306\272\241\241\313\315S-7\363\016$\034Yn\236jY\207\253"
+	.ascii	"\005\270y\006a&\203\242V\300+[\244\350I\310lYl\004\315\275\204"
+	.ascii	"\2619\022\254\363\254\3763\367\016\231*\371\346)V\273uZ\322\360"
+	.ascii	"\2368\205R\201\017\252"
+	.string	"\"\376\355\316/N\222\233<\315b%/\023I\344\0363\211\235\030\231\317\367}I\1773\217\321\342'\371\233\361\023\315\316\265\361\201Q\345\252\213&\355e\220\177\032\247\305Sb*q\225\374M'0\345\242V\351)<\270>W\227\265ZC\350\032\302\206W\225\373\\k\367\016\257\227\004\242\263\2665\347$\310?}9\037B\274L\230\350\331\237~\034\021\357\336\314o\216x\231&\210H\224\310\337\324z\350\252\372v\277\201\272\2277\225\375\336\307\0343\264V\227\265\361wS\215\356\335\371\263\371\277\007j\237\205\346\251I\331{\027\375\032\337{\352\237p^\023\033\t\234\232\224\035\036TrB.\3011\214LL\260\f\243\022^\"\225QFxii\204\360d\204\0322\316pB>=!\233\214OH#\006\017\022=\r\021\031\341\345\021V&\031\223K\243\022\314\204<\3120\272\370\340\241\003\n\025HA\036#J\273\0232\206"
+	.ascii	"\230I\t\271.\235`\0330\313\204<.W\245#\274\264\036\227G\245\325"
+	.ascii	"\223$\300IG\345\022\206\022f\202R\202\227\222\236\214\234\220"
+	.ascii	"\307&\243$\345\223\221\004\"O\326\200\225F\313dRi$t\375\035j"
+	.ascii	"\335\233lC\336\225\\u\016\331?\236j\237\313\313\3059\336\275"
+	.ascii	"\253\254\342+\342\324/C\225t\307\313\305X~\364\216i\335c\036"
+	.ascii	"/\027g\371\321\313}\321Y\231==\252\\\315S\204P\007\216^\200\265"
+	.ascii	"g\250_\215%\324\257F\340E\207\215\215\205\034\341"
+	.string	"_\375oy\f\006PT\210T\203\273\f\215\271b\257\341\264\016\225\231\305\244\3360\241~\341\225\346Ie-\317G\227y\216VYB\024\322\037\245\362\267\026\365Pc\375\350\241~(\277\356\275w\217.\023*\032\363\313a\347\366\374A\244\220\r\350\350\2178,\f\325\n@\360\313+\200\260\250\201$\305\230r\210fDD\244\260I\032\003\200\002\231)2v\021`\265S\214FZ5\007\342\275x\327\f\221*\241\250?=\017\363:\020\261]E\277\002\235\232\177CND\303n\210\204\226\361\330yI\337\253a\272\240-`V\206\005\265\2468V\337\242\311\360Q\212#\363\350\007v\222\273\301\326\2668F\334\312\206\312\220\246\035\021\206\f\271\007\004\203\034C\205K\2259f\024r\342\037^\236\343\216\037/\336,E=ln\346\325\021H4\256\030\nS\214\024;\215\n6nA\250\334|gJ\367,t\023\227\310\327\352\234\351"
+	.string	"\304\367\276L3\275\346\021\344\242\213\201\363\246+\246v [z\212;'d\002\233<\\$\255\331N\036U*\240\351\030\230\235#>\242xU\026\004v\233\004f\313g\254\356q1\265\025m\304[&\bN\262Z\345<\030\343\213\036(\263s\311\230E\004F\205\361\275yi\337L\245\306\241\003\341M"
+	.ascii	"I\023\373gR=\244\375.\346\335 \325\226\310x`\263~f3n~=\344\223"
+	.ascii	"\213=\274\267!U\215\276/\337\354\204f%\275-\030~\201\350\240"
+	.ascii	"0\214z#\210\222\003\373\213\222\227=\242\b\215\3604@(\030\275"
+	.ascii	"\210\324o\302\022\303=\222,\260%\361\220V\346Lc\271\341LV\327"
+	.ascii	"\3710\327?}\335_{\340I\342\311\340\tR\f\350\256\362\250"
+	.text
+	.section	.gnu.lto_traceFileOpen.40.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`4\002\275\022"
+	.string	"\266\241zI\320\360(\035Z\220\250q\346\013\340b\033\3535D\230\032U\304'=\314\020D\214M\263\327\343P\330\200Q\261oG\361|_\374\240Ry\211Q\022Dw\311\200\321J\267d\245$B8\003j\234c\204\321\220\215l#\204l\231Re"
+	.string	"["
+	.string	"l"
+	.string	"4KJ\nv\354\216h\342\261=\220\350\204\355\247\354b#\335'gO\273\241\031\240\245\335e\315\022w\371)\004\277\251.~\355\247\217[\356!\356\340$\302\361b#\350\226\373\367\211\304,\335\250n1_"
+	.string	"\246\031\243\324\rFg\352&\363\211\273\373\235\253\210\333\213\352\211dw\255\345\255\346F\3356\b\333-[1\004\007\342\240:\332\265\275\264ag\321a\225s\360\307+1}\251S\345\002Eof\326twk\323\264\360S\303\317\r\030e\372\n\032jwG|\236\367\310|\235\203fi\321\227\007\375\226\360\340\347w\256&p<\035O\217M\233l\237\232\316\235\375o'\216}\3657\325S\325z\365U\2556&\241\035\341E&\002b0\300\361\320\361\246P\256\247\024\316\335i!\fZ\201\027"
+	.string	"j\220R\350\270P\256\227\004\032\3209\023\234@\270\340\347}h\302\223t:\2732/+\240dFV\007m\013\027\364\245\305\267xP\b_\307'\255VxpN\0048#\035\217\215M\233D\216H\320|sg\220\353$\007(\353\347\271^\250\217\341y\001\376@q\215d\312L$\307\031\214l\021g\244k&\023c3\021eT\201\2716\210\255\022\007\r$P8Y\371\0252\276\\\344,\0039\252\260\240\214)/\031\313\003\314\265\302z\2212V\310\312\261\017#\311\232\305b$+\345\263\377v\342\230\3046_N\337\264KN\2036Ck\2249\016\250\214\277\307]\024\202\334~"
+	.string	"A_~S\225T\334l+ `\202A3\247\036i\354\023c\232Ul\354\264\321x\360\"-\270\215MIv?\303\271\033&\t\351\205\370+\265\237r\205\332\220\310F\350\206\326KD\352\320\257"
+	.ascii	"\\J\204;\363\234\325\265\367W\211\005\237\3434\251\201\005,\324"
+	.ascii	"\2565\254Z\001\370\"R\330\005\035\362\340`\313q\2100\3715r\244"
+	.ascii	"M\033\245\003M\315mB(\003"
+	.text
+	.section	.gnu.lto_traceFileClose.41.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"-\013"
+	.string	"V\224KA0M\225\016\b\357\265\r\337\265)\037\264qj\237\r)\277\3700m\365~\037\252\301\244\207\201\217_\275a\200-\315,\f\263R$2L\030X\220\034\302Y"
+	.string	"P*JB@\255\225\030\t!{\313\224\0027"
+	.string	"8"
+	.string	"8"
+	.string	"\023^\273\313\311\005\367|J\365\370\333dw\237:E(~>\017\\\316H\013\303\210\nQ4!\243\006\341SW\003bHu\233\354\2565\024Kwv\333\024\333\030\366)\001\034}\370\314\347h\317.#\b\036(P\255@\032\263\307\217\312\223\375\271\322d\253Z\257\376V!\275BH:\354\216b%\226C\226\301\201\355?\354\261A|D\355v\372P \307h*\037\2735h\027\267\001\\\364\241\347&\220\037\333\337Y\030\t*e\311\005\341(X\353\202tG\273\324`y\020)\314v\346\021:\023\273\233\341\253\276\332\370\f\236\231@\356$^g\0015\025\320\013\260\331\3608\272\f'\240\303r\341:0\303I,\374\r\360@N\363} \367\030\367s\245\311s\003\211D\013$CS\236\306[\350@P\0256\220\353%\342\241\247p\007\024"
+	.ascii	"i\3317c\272\211l\200\336\362\252\355P\230\341\211\261\004\304"
+	.ascii	"]B\3647\206=hW\t\262\200V\024v\235\016\026\272\206\307`\302\277"
+	.ascii	"\214K\\.S\n\265\007"
+	.text
+	.section	.gnu.lto_schedulerTraceStop.42.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\355\006"
+	.string	"\022M05@m\223\016<x\323\356P<\036\336\330Z\006\271/a\211d\247\376\317Q\200\2557\034\034G\324\270\305:\264\006v]X\\p\341\246x\212\362\371(wk\204\310\024S\226\212\272\\\031\204\253b\320$T\n\024&:,\\\032\"ua\242\205`\353\241\272b\306\262\256X\341\262Q\302\317\301E\247\301\316\323{\r\304\353\366\023\251\350:0\373n\246\013\322\220\315\3458\202\363\272U\272\234\251\222\244\205<N\264\027z.{0\343\033%\374|$`A\022M2'B)\331I#\035\177+c_Rn#\013J\221"
+	.string	"\241df\204\032\305\372\260\333\217\006l\236\254\017\300 3\177\233\207\242\303\376\003\177\301\217\021\t"
+	.ascii	"i\3317c\232\364\206@\036\332qa$\013\026\277\f\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_schedulerTraceStart.43.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\026\001\025\r"
+	.string	"6\230WC\020\221\232\016pVOSU h\215\250xE\273\316,2\276|\366\350\247+\342\301\330\206\277\350[3\255}\333\306:Vi\201\017j\265\"\200J+\034\264\240\251x\035\020*P\020\301Z\306\210\354\275eJ\001C"
+	.string	"@"
+	.string	"F"
+	.string	"/3@0v?\003N"
+	.ascii	"\340\322\233\355\362Oe\037\332\240aE"
+	.string	"\314\356R\220\304\267G\250\233\317\361\221\361>\236\307\017\207\035\237.\022\330\335\247\270\232|JT9>v\327\352}:\334\362\266\033\330v`?C\377\256* bD\200`8\035\331_\2470\305~\\\210b\037\364\313\250~\246c%\206\002\032\273\034F7V$_\234\260}\237\345\037\347+\216\020\232.m\216=]~\262\255j\037@\260\035\324\031\360-\004\224\b\301\351(F\230\242\272\273\036\350\216$a\347\304F\213\214\022\255\341\211\002D\362Cg\001\022\"\"\"]\2168\021e\324\377,\fz\317\352\302\203\250\203\036\373\232\344\253x\213\346\2330\266\321{\227\376F\272\fs\244\3420\230\231\346\30153\n\013H\254\f\013\340\312cV\232+\223p\315\221\315\204Y\241\302\250\013!\032\013Tua\224G\001[$\363\2422\313\272\250\351\343\036\027\242X\341\257I\020\346\305E\365\232th\002\201E\304\301\316\207\001\032"
+	.ascii	"i\331W\324\364\3215\026\004;\260\256\306\2709Y\021\215E\225,"
+	.ascii	"n\317D\362* \310\fd\004\266}\315\354\260\354\370\2572t\r\267"
+	.ascii	"\317\304\003\032\005\t\221J\352\034p\355\001\\\212\252\261]\245"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_schedulerTraceGetState.44.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\335\006"
+	.string	"\002\315/3`O\322\001\024\302\b\003\333\0038\364\341\300I{\272\236%\021,T0ZC\332\036\376v\001\304b%d\006"
+	.string	"\250J;\270S\200 \304\t\257A\366\2262\245\2460\025\225\201\033\005X9H,T\f\224\346A4d\036\036\0055\017c`+\242\202ocY\360Iq\257\240\324\351\243\024\366K\036/\337\303\023\234<v\347s\242\273\324"
+	.string	"\214O\206\354\350I\325\260\337VA\266\323\251\002),\b(\273\026\241\227]q'\037\266;\266\344\213|\244\343\253E\216Lj\351\2500q\331\215o:At\327>\020\335\351\306\257\347\345\237\344\r$D\005\313<O\200\204\335ub\331\305\255\267]`\373\300vF\t"
+	.ascii	"i\331'\323\342\2543b\206P\\\023o#p\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_schedulerTraceEventCount.45.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\306\221@:0\345(\035\236\313\363\t\004\031\fqa\301\302\232\346\027\323\302\213\312b\031\342I\373\251\377c\237A[.\315\334%\311V\n\n\262\304\204S\210n\n\003\217\216o\232\354-eJ\001."
+	.string	"1"
+	.string	"-"
+	.string	"\032\253\263:R%\001vW\333\234 {\204\327d\217\312\272\367\364\374\273\016\001\264LT+\323S`aw\235\252\225\305\255\267]`;\3016,w\306\201\027\026\205\330.EL\300\256\304\023\217\277n_\304\377\234\371\253\2041U`RR .\273\337\301\243\0210\217\267=;\343\267\036\342\331(\360\013\234,U\225\3232\001C}\344$%\237\303#R^\365\350\223\262\307\324\177\377\307\306\305)c\366gJ\315\260\017W1lM\303L\353_\001\037Oz\353p\333\247\023y:\356a\304\3005l!-\302\341\003\241m]H\353\030\030$\301u\232\b\004\352\264\314\267\267\241nN\212\262*\324\273\256QI\r\310}\f"
+	.ascii	"i\331'\323\"\f\223\206\270\261\n\345\243\302s\r\347\310\304\323"
+	.ascii	"\205\323R\353\210k\305$L2"
+	.text
+	.section	.gnu.lto_schedulerTraceGetEvent.46.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\013\0015\r"
+	.string	"\346\231ZB \217\223\016\340\017h\272\031>d\341\350J\024\350\226\rY\fB)n\227`d\200\346\024\214c\373\306:\007h\333\264\"rR/\264."
+	.string	"\f@\303\371+#\326(l$0\224T\375\033!do)S\nF"
+	.string	"D"
+	.string	"G"
+	.ascii	"-\306\354j\200abw\0218\301u"
+	.string	"\250\361l\373\250\243\210<\032\020MN\032\021(\246\225\027\273\021s\274\200\352\360z\200\352P9|\364\034\371W\371\363\200\352\270\021\322\323j\260\273Nn\344t\353m\027\260\355\300>\206\251\033\354\277\325\022c\036\377\353\251\333zi\370\322\357\245\365\245\363\245\237\241\021Q\261`\305\256\205.\306\246\200':<\365\333\"_\305\031\333\251\n\027I\344b1\245\260\330\215\007\016\315\340\312\264\237r\020\242G\007\325!F\357\302]xwO\365\024*l1\221X\252\372\364\227\252\376\204\352L/\232\256{I\2654]B2\224\262s\356=\3255\365!.J_y\b\217\177\342O(\317\035\372\241\352\360\252i\201\342\003\tHvv$\005\240O\306\351\320*\n\031\347\243\003\275\331\3106\034\033\350\301\226u\2048Y\204\315\007\373\350px`\233\355\203m\030\2606!\3330\220\246mX&\356\337j\tF5@\264d\277\004\004"
+	.string	"\347l\203N\242C\300dw\025\260|\204\004\377\344\320\036\232\026\026"
+	.ascii	"i\331'\323\264\216a\fjIL\2536\226\3228\273\247\354\303\264\246"
+	.ascii	"\350\240$\004\211f\f\026\025\210k\342\326\242\331\031\261M&\310"
+	.ascii	"E\221\365\251\313\240\211'%\305tM2"
+	.text
+	.section	.gnu.lto_schedulerTraceRecord.47.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\301\004\375\034"
+	.string	"\226u\272H\240\330M:\200\352\206\0354%\323\343\311\022\326\311/\224\034\353O\315\003\247\\\262\200|\f=\374UE\216\375\276\2144\231\312p\376L\223yRQ\217\261\270U\334\232\344\224!\250p\035Mc\232\262IG\354\326\b!R\246\024\246"
+	.string	"\226"
+	.string	"\253"
+	.ascii	"S=\253\366\255\316\343\367+$\327\346|Q|@;\271s\\yr<\200\362\244"
+	.ascii	"Um\005\013~\327\221\344\235S\212\b\2229\257\022\230\001\355\244"
+	.ascii	"\177\266\330\257\246\346\257\b\tf\211\231s\346v\306\177\257\321"
+	.ascii	"f%9\256\376\374\231\241\322k_\212:m\31419\341t\233\032\303\345"
+	.ascii	"7\236\240t\366)OQ\212b\030\324\222\305I\232a\323\2703\347\264"
+	.ascii	"\rO\3508\036\330\222\004\214m\3304\342\234j\bi\206L\272\343\001"
+	.ascii	")(+lC\340\210\363\"\202=\353\003n<E\251\316z\346\234V\341P\305"
+	.ascii	"=s\333/lo\260G\253\367\225\272\343\276I\n\370!'\342\323\355v"
+	.ascii	"\345I\335\033\"\230&\371\342\345b\035T~E`aa\3221\366\201<H\220"
+	.ascii	"O\303B$\364\302\223>\211\362\344\367Y/\200\365U\005\265\244E"
+	.ascii	"\373\n\250\033\303\376\026\213\305\242\027\206\375\253_\347:"
+	.ascii	"\376\234\377\370q\356\343\307\251\372\246\352\033Rm+\3256\245"
+	.ascii	"\272\246\246\236QuM\325\264\232zFS\227\245\232,\325\343L\275"
+	.ascii	"\245ZI\365wn\242xA\2202\247S\221\314\354\"\265l\330>\215\375"
+	.ascii	"\303\210\205\321\207o\274M&b\002T\357+q\026\267\264\255\255-"
+	.ascii	"a\202^8\263\343\204Z%\347lm\037,\263K\333g\035\200\225`\031\244"
+	.ascii	"Rgw\255\367X"
+	.string	"\217(_#Q9[\021XYL\341V\210h\247\362*\025.`\300\260$q\254\314\252\\;\303\275\222\226(F\325%Eg\313\345\260\343J\260L\316\332\032\316\225\264\30401P\236l\227\2602\234\2657\334\211o\211aTM\230\220T\302\252Z\340\326\356\360%\276%\2021\260}\364-\0176@0\2529\247\003\255+\371\340\3238i\020!~\312\2233 XY\213\"\271\263\260 \024P\213\036\367\310\205d\017\275\335\220\016\311\007\250hW\353\355\206tH>G\274\237\243\036M\221Q\357g\307+\201\204\324:\236\235\356\207w\024\202\267\0332\001\264\033\241\353\345\212\204~\210r:^/\307c\300F%v\274\334\221\221\021/Gs\265\364\205\341\236\245\005\216s\316Y#\240\366/\307o\207^\350]%\007\220\221\"\fmc\030\301o\353\303u\3330%\027\317o\366\346\345_\274\344\307\303[z\241\267\312\2237\333"
+	.ascii	"\313MFF\324\232\355\203J\033\027\333\222J\300\2246;\346\303M"
+	.ascii	"\211\025y\315\332\354\230\345\b\007\363i\251Y\222\350\245\312"
+	.ascii	"\252A\327\030\016\362_\237\331O\301\312\022Y\25018e\024t\206"
+	.ascii	"j\246\342\224\231\034\300\002\221\251\"\017\0208\247HJ\232\034"
+	.ascii	")\221\262_\025\361\276\323T \200\236\314n\201\021\303\231=+\305"
+	.ascii	"\232`!\001\334w\224\214\300\367\325\376/\373\324\205\204\305"
+	.ascii	"\025\334{G8\256C\020#^\b\310\263\320,\313q\302\013\231_\215-"
+	.ascii	"hf\350;H,\273|\366\322\260\202Xs>!\305`\300\353a\264%_oON\004"
+	.ascii	"\270\032\263-\336\3266pG\310\241i\231/\253\233\357!\264\177\266"
+	.ascii	"\201s\220\261\273\003\213\370\264I\252A\204+\034[\005\207;8\352"
+	.ascii	"i*OG#\t\270\376l9YJ\334\367&,\361Y\240j"
+	.text
+	.section	.gnu.lto_schedulerTraceLateCycle.48.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\355\f"
+	.string	"\026\031ZB \221\222\016\3631Y\264\b\303+\216\216J\333\241Ur!5B\337\024D\262\340\325\231\201\255\320>A\345\006lC \337P@\"'\313\201 \340\234\035\353\253\0238\272\327\304 nf\321\023\264\367\2262\245G"
+	.string	"E"
+	.string	"C"
+	.string	"-v;\004^0\035Z\263i\274#\261\257\271\001\245\270\261\273\224\216\270\366\247\251\371\037\375\203\013m\177\023\314\365\031\020\301\200\001\020ry!6!f|\364\334\020\372dz8\330]'\027\352p\303\333\206`;\202}\n\001\366e\376\370\356\206/\235\231>\210"
+	.string	"\0176\r^\354\276\224t,\t\2728\361\356\267\377\2219>\212\317h\357X\246\215\303\264\002\224\243\306nw\340\320\f\246C\221\207\304\303\367\0011\323N\240@\273\214\006\353\256\210E\366U\274\246\362K\3302\311s\207\276I<L\2054\245\033\020\234\204\nU\177\022\257v\312\225\347,\002\322\315Q\257 31@;Z\262d\217\264\263\225<\007\225\300\213\r\322G7\273\333RE\330\177\2531\001\231\205R\261<\310p\251|\224H8\311:\236\350j\304\252:\230\207\004\263PVJ,\013UF\251\\\350\244P\025\226Q#\005|a\2600\312s]\030\305\351\366o5\306\023>\220Z\364\363\002\244M\322\321\233\340D$}\025S+\320\310pI\034\001\023"
+	.ascii	"i\3317c\232\214\332\270j+c\366\002\355\332\302\272\340\305\307"
+	.ascii	"\002\225\315\026Njm\027\306\346\3144\026:\033\267\236@\311\020"
+	.ascii	"w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_schedulerTraceMarker.49.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"-\n"
+	.string	"\306\323H?0\247*\035\225\353NU\r\310\207.\260w\233Uo\373\274\217\034\254wJ\261F\244b\b\310\022\274w\334\236z\004\322LIF\r\035t\004\233\007l*\236\206-\023a)~;\371\204\354\275S\n3"
+	.string	"8"
+	.string	"3"
+	.string	"\236\273#\257\002\273\325\301\021\3333\2076\202W\223\275\353\0035@\301\356r\263\344\341e\350\277u\313\230\022/+\023\273k9\246T\367\274m\005\333\033\333\f\002R\372\225\203\224\003\233\330.Hl\301\3022\003'\257\277\375\267\214\361\003\\@\370Z\332\304\220\355\345!\222`\2676<\263\304\366,\363\004\355\031=\202&\245\375"
+	.string	"\021\236\325\021\223N\372\217\366i\177\034\362\2433\250):\233\237\027\027\001T\003\223\214Y\223\366\210$?\322\271\240B\201\235\246hWQN\022\373t\347\312>\353\317^o\032!\317\323\225(H\037\310\322\251"
+	.string	"=\r\220\363\331\334i\274\216\003\212.@\3173\352x\030]\210\003ep>\\\007\2068\r\203\277\r\017\344D\337\007r\230\272\247;W\266"
+	.string	""
+	.string	"3\315\223/\222\006\013"
+	.ascii	"i\3317c:\200l\006\307\263\306513\013\215\205\313\306\331\023"
+	.ascii	"\2506\300I^\\\223\f"
+	.text
+	.section	.gnu.lto_schedulerTraceWriteHeader.50.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\331\004\025!"
+	.string	"f}\324E\200^Q:S4\256\207\212\353\221\3219Mr\2708=3nY\205H\316\216e\214\261\300jh\035i\033\026\350\032\235Tnx &\3179(0\031"
+	.string	"\021\241\246\302\233Y\312\263\236\264\305\226\325\226|\262\211\224I\006\277"
+	.string	"\263"
+	.string	"\303"
+	.string	"[\037\356\320\356\230\2239_F\312\254V:`I\331\360E\003\3630\347\305\334 \323c\212X\255?0\230\247\257E\257\225\302\034\257T?f?,*b\265\n\035\234n\205\335\363\356\273<\353\274\226\216\017\250\325*\354\253V\241\322N0OW\370\243\362\324|\255<\335sW\317\205P\352\207X\277-@\265V\\?Y\002'\205\337\222\317\313JJ6\237\373\341\021\230y\003\f\366.#{\nP\222"
+	.ascii	"\301\037YA\320/\316\275xpye\310)-(\344$Y3bFN\200\340\024\371"
+	.ascii	"@\016\226#7\236\253\202>\356{\275\001W\03008\344,\303Pk]\006"
+	.ascii	"\006\201|\315\357n\220\335\235\261Kv\005E|\342\335\344\216\350"
+	.ascii	"\234\315\333H\355\247\234\356\2079%J\373\346!~\230S@\347\304"
+	.ascii	"o\3450\201\273L:>\220\250\217\212m\216T\335\333\025\366\270\257"
+	.ascii	"vo\253\362\345\270m\265\233D\343Ez\232\257\355Z\177\355\302/"
+	.ascii	"\021\215w\366\256\257\t\200WF\343-\207x)\215\227\234\361\266"
+	.ascii	"\311\3132\336\337jC\340\200XS\253\217\261A\365H\213U^\374\323"
+	.ascii	"\374]\277\360\027\363\227y\271\373\335\237\331\203\335\270Ci"
+	.ascii	"xUXZ+\376u4\347\213Qf\265bV\325\361\262d\236\026\361k\345\211"
+	.ascii	"{\257\035:\345\272\231\363]\f\314\336\017\223X'K\204yz#\377/"
+	.ascii	"\017\263\";x\214tBi#5\023\372\025j\3006*g\025>\220\366\003-\361"
+	.ascii	"u\357l\224\262\205\204\354\253\345\225\266\326`\307\307\202\226"
+	.ascii	"\354\335\215p\260\003K\341@>f\223\275\202k\354W\350\312\303x"
+	.ascii	"zl\234X,@q*Om] \313\3618M\330\337\301qj1k\255O\345i7\256\216"
+	.ascii	"\326\016\036\333\004l\366\356\311\345\314\342\003\271o\374\255"
+	.ascii	"\200\020:\372z\316\227\026\223\336\033\323\210j\275F~\216S\004"
+	.ascii	"\214\372$\361[\303"
+	.string	"\206\233\001\376?\224\273!F\360\201o#>G_\367\326\306\017^bi\317q\252{{\304\344\327X\236\3707'\f@\251\225\352@\024&\325\213\005\247D\275\233B\005\037\270\\|\023kb\211C\006\252s\312\2210w\272\246\234\316\203\316)G\203\326\364A\006/\007U\356t.\\D\265(]D\265\340\221P\274\246\326A\305\330I\321e\202\240c\312\355\240X\354t3\242\232t0\230x8\0321rN8\246\035\017\007a\301>\325\320\355pPOO;\334\220\260\276\255v\211\310qG\363\330\033Re\376\341\007\210\201\3411Y_\255\200(4\251\351\026\336*\366\272\372\023\206\311Zk-\373j\271\367\007\312\033?\313\"R\210D\352YW\355\376\fJ\263\223\372^\247}\270\302\250\224\360\340\261\215\"kmrA\f\214\254m}+[\326\357Z\245\203\235O\314Z}\024\312&\022\023'P\361\306\254\346`'\226"
+	.string	":\265\372"
+	.string	"\200\005g\022\002b\250\221$\206\034b\210\320H Ba\024\030\246\003`\002\2319\273m\020pJ\233\016R\017T\032Rn\273\321A\254\241]\351V!\207\017\350\371\265\303\212\372Q\340"
+	.ascii	"Z\330[\226\336\251\264\304\254H\024?(&wBA\245\007]wP\347\340"
+	.ascii	"\310D\260\005\347\265\221C\031\323\0328K\024i\331\377o\376\375"
+	.ascii	"b\342\r\205\331\266\324\256\221\b=\017\370@\255\374\352\023E"
+	.ascii	"P\264\257\005\326\002z\230\321\030\344\267>\375\230\301\263\241"
+	.ascii	"\301W4\344\034\205-\310^-R\377\241\310\276\356\371T28\313<]*"
+	.ascii	"\204\024\212I.\356\213Qx\263C\367\207/\204x\037\\b\230pc=\bC"
+	.ascii	"\364\320\\\232\310\177\3072\372\205\344Tm\036G\276\345cG\035"
+	.ascii	"\361\322"
+	.text
+	.section	.gnu.lto_schedulerTraceWriteEvent.51.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`i\002u\022"
+	.string	"\346!xF\360\360f8\332\230V\360\241\202\355\2409\006nY`|b\263\247\365\242K\332\214\244d\321\237\304\340\212\324\r\360\250\320\r\321\021\316\374\222Gn\200\357\035\346\201\362\346WQ\316\221\3500\315\200W\342\267\275\367\336R\246\024_"
+	.string	"^"
+	.string	"f"
+	.string	"+R\243\371\346\354\240t|f8\355\216\t\356\271A\230c\r\211\310\336"
+	.ascii	"\255P\360\264\317\342-b\247q\270\200\335\236\334mw,\361Ix\317"
+	.ascii	"\343G\276{\341S\337=\307\354\334\307\022\373\242\027:B:vW\245"
+	.ascii	"$\036{\306\374\333\216\232\361\310\236 \203\335u\316x@\334z\333"
+	.ascii	"\006l\243\330y#)p9*\263GY\352\b\373\335\356\256\265\307>\355"
+	.ascii	"\017\371\370\177\274v\243\302\364\007\246\2750\335\201i\375\322"
+	.ascii	"\371\245\237J\335lD\310\261\373\341\211\307\342\274\244\023\257"
+	.ascii	"\375C\277\321\325\376\201Nt\233A\\\274(v#X\270(\036\370\300\200"
+	.ascii	"p\373\b\272P\354C3D\036\226\234vw\034\204\367\036)\005pTf\325"
+	.ascii	"NKtz\330\023NCE\025\374\311\355H\n_J\005\203r*\006\344\025\245"
+	.ascii	"v\205\225\374\314 !pTf\233\345J\253p\367\346\304\227qA\fw\267"
+	.ascii	"F\301\240\246\0354\233|2\200\374\321\223X#L\277\035\t\346\233"
+	.ascii	"\260\261J\334\364\335\373\321m\254\003L?:\021M8\2631\300\344"
+	.ascii	"g(\035\211\021-\361\345\005\326\362\275\300Z\\\335\313\345\242"
+	.ascii	"\257\030q\203\350\211/Vk\306\363\312D\\\261\264^+-1\003\314E"
+	.ascii	"\264\260r\251bX,0\252U\313\2452A`\031\rbK\365\222\221i\251@\306"
+	.ascii	"}\267\332\223\202\204\263\321\016\236\031\202u\273\"\026\334"
+	.ascii	"\350w\252\345\223\t\344\307\255\364\005\bQ\247h8\222\374<\375"
+	.ascii	"$\274\206\212\247\340\017\016\222\354P\0020 \260\002\0212\225"
+	.ascii	"\007i\357\033M\007\3100\200\032\0033\262\024=\333\204\004^.\326"
+	.ascii	"\021\032\004\033\341\3653:\274c\251\323*\372\222\335%C\223\005"
+	.ascii	"\200ni\035q#\204\f\023\207\030\034\327Xa\213\344\276R\215X\246"
+	.ascii	"\334\307\\{\343w\236\210\343>\203y\0053;\023\261\252]\313\013"
+	.ascii	"\006\0373\213{\341\206\005\344\320\340\313\213v\221\001"
+	.text
+	.section	.gnu.lto_schedulerTraceRecord.part.0.72.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\341\001%\020"
+	.string	"\026\335gG\360\2606\035\260\335\365\304T\354\205\016\333yd\343\237f\366O\374\034\265Y\357\177\323er\365\305F\322\372\306\232\206~\007\254\0132\275\263z4\312\316\251\354&\350o\344\266wO\216\335\007w\301\263pRS\244M\366N)N"
+	.string	"\\"
+	.string	"P"
+	.string	"\325t\332\037 \344]LLw;\320\330\354\226\b^\235@{\335^_\302\366\2102i\317x\331\262\227\301BY\341\354.\367JC\234<\235\030\351\317\223J\351\364\256{V\252\030,\225\324\247\200c\034\237\335\265\266\341\256\267\275\300v\004{~\002\336j\306\267\302\331Q\256\006\024\315W\220o\205\337\f\250N\n\312\013\032\020\264W\227\332=\031kf\246\365@&\206TcHX\200\305"
+	.string	"\242\345\243\301\214W\225L\007k\342\200M\373'\216\202\274\252\304\235\335\017/\005\332+\201\017\310^\261{\262\327\027\177\200\214w1\231\035[\272q\340\001\017\311\374\026w\021\342\213\360\3107\177z\365\277\354\365\256\0270\275H\3240\315\327\244,\246\330\261\245+6\346a\220\263\233\362\312Y\017\365f\304k\376\227\037\346\227\371Y\367o\356\2627\223\234\205i\312\006\316\356n$\367M\214~\371\325S\\\305m\002\342\310\263\340\325\320\310\353\204\236Hw\241\201\b\202\304p\033}!\310\003\263\220h\272\363\360:\020(J"
+	.string	"=\021R\310\243\320\205\334H\004\032\341:0\344<\f\370\253\340\201\234\370} \267\331\236\307\226\256\370c\242'\224\262\330\0060}\327\004\321\374\311\263\225\202qBKv+ \260\002\031\033\353\006\203\361P\272\205J\314\211\333\362+\037\374\251\"3\231\203\365\214\2100\021&D\251C\317K\360\t\002(`d"
+	.string	"\n+\324,\272\032\305w\306\002\001\237\204\315\342\f\037\206%r\223\206p\004{\017#$ @`p|,\304+\276\241\263e\346-\264"
+	.ascii	"\254=T,t-=\201\216\001"
+	.text
+	.section	.gnu.lto_schedulerTraceLateCycle.part.0.73.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\r\f"
+	.string	"&\226O= /\324t"
+	.string	"\033\232 `\205P\246\022\032\277\367qu\024(\204.k\200\203\217/<\372G\224e\003\"\211 \365T\020\306*S\271\251%\004\232\037:A\003\002\227\020q!K\366\336;\2459"
+	.string	"@"
+	.string	"="
+	.string	"\330+\275"
+	.string	"\354\365$l\203!\207\366\213\213 \366\250\326\347\304\332]\355u~x\370)i\350\377t\007H\324\371\004 \332p\031\340\2641\331]g\034\356z\333\022\333\016\354c\002\276}\024\240?\376\344\207\b\232\034\221\200/qd\201\355\310XA\245\035\221\204/q\0264Z\240Z\n^=\311^/\372\361\352\0227\021\376\304\205\254\023\312R\237\0310v\305\004\257f\220\275\0328\201\251\253\360\252\263\312*\354\265\221ade0\037\365\024\031?\204\277\215<\350\325\337`\257u\034G\304\360\310\227\234$Oz\272\273\3539\262\351\200\003\256]\r/\327z\250,D|\374M\227\016\225\007\024>\212\006\3738\313\306i`\241\2738\274A\270\215\342i\"x\234eS\341$l\237v\231@\251\240m\336\247A\020\270\303p\236\246\351:O{\330\226\247;G\206\320\301\205gb\360\234\223\264\367\n\363\003\032"
+	.ascii	"hm\301[\326p+\347\030\2271A\223\n\016\251,sT&\200<0\342.Q~\206"
+	.ascii	"\300u\\L0\004S\210\340\265\351\306)\254m\247\344\351\fe3o\247"
+	.ascii	"\005\340\332\213)\247\345\364k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`q\004\035\023"
+	.string	"\006\335oJ\260\226Q:\324\335\264\250?\rY\230\323?\206\365\316y\327\205c]\320r\224\357\002]`\017\337\035\247&\021\275\316\316\316\006\376\\\340\377\nO\301\n]\023\362\023\350\023\230p\267\261z\360\350\341m'\335{Y&\020Bv\332R\006["
+	.string	"["
+	.string	"["
+	.string	"eY\316\232\301\004\327\347\323\013\246\204V\020\241\023\364\274|<\215`\216U\307N\037\320\201\311\351\365\201\363\372\3528\2227\275\274\2113z\265\214Kf\3633\342\214Pn.Z:f\323\005fM\033\230\337e\262\262`\337\356\202u\034\353m\267w\201"
+	.ascii	"1\255"
+	.string	"\265V\232\216\231\273\373\251\b\374\243\362\363\310L\324kB\332\371\220d\356\t\225<\326~\326\332\227(\272\347D/\316D\257\256D/\017\022\275\271\021\275;\021\275G!\232\007D\357|\350\033\017\235\323\241q8\264\316\206\256\321\320\262\f\r\201k\255\273.\030\232\206/\364L\013GN\311B?\230\025\332\001\205n\3602\017\200\272\317\fOs\001\257\"\031U\304\342\t\001\372\024\331\304\242G\321\255\350Q;VY\n\322c\205\376d\343\025\022\204\204\006\013}h\343\260\310m\205\036$\302\\K\302\353\211\364 \311\\cb\243\250\205~\3062\242\036S\213\036\034\342\377\250)-\331\237w<\303\024\003h\300O\013\033\276XQ\320\bH\256\3166\032l\025[\035\225\343\224$C\244\334D\244\341\216gR\215\243\240\027\361G\220v\b\301\210\347\035\333`\342\231\214\021O{\211\237\311\210\207\305\304\224\224\263\216\371\306\n\030J"
+	.ascii	"TO\221R\035\346R]\300\310,3Z8\tS?\r\361*\311\rY\332\324y\fO\250"
+	.ascii	"a\024G$k\302\202\202\202\324\254\214\001\340\002\2311n\016\021"
+	.ascii	"\200\034(\231\"\321\210\310D42\017wj\026\363\232D\250A\365\007"
+	.ascii	"-\2535A\204XaR\330!(\315\013\270\265(P\214\\\033\227(\002\330"
+	.ascii	"f\277\321\216\267+\005=uZ>\374\205\340:\371\016k\304\220\303"
+	.ascii	"\241\361\226\033S>\177O\tTGz\367b_\373\326\357{\300\302\365;"
+	.ascii	"\026\372Q\325P\373\355\025U\211\375\304R\301\246\302\037\234"
+	.ascii	"\030\374x\241\271\367\020\231\255\320g\022\245\021O\210+\214"
+	.ascii	"yU~r,\f\301=?\322\230^\r"
+	.text
+	.section	.gnu.lto_.refs.28a120bc4390b5bc,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"e\004"
+	.string	"B\214\031\017\200P\336bQ\356\003q!\023\370g\275I\006z\222\313\026\324\022\224\016\222\n\336e5\326\026k\323Z\264\366\020\025D\264\002\346\310I\300\242\264\006\3710\306\232\2720O\243\211=l\032\326\002a\022V\301\351\262*o\262\036\247\006a\267\236\355$\252;5\3074\233\310{\315j<6\325[\274\351E\257m\276\"\375\002\016"
+	.ascii	"\013&\370\250\2709C\247N\223\202\375\024\303-VR\306\025\004+"
+	.ascii	"\320v\023\036\271*\222\n\243\351:\237"
+	.text
+	.section	.gnu.lto_.decls.28a120bc4390b5bc,"e",@progbits
+	.ascii	"(\265/\375`\301B\r!\001:\357\205kX LA:\351_\217\220\232\3103"
+	.ascii	"\220\344\252\257?G\211gU\332Z)\275\3523y8&9E\365G\237ET\025\233"
+	.ascii	"\266\3632\213\020\212\234c\001Z\351h\354[P\340\036_W[\377]\245"
+	.ascii	"\251\377.r\260\312\3227E\321\006\323yty\312]\307z\032\215XB\366"
+	.ascii	"\226;\005\316\005\246\006\311\006\235\354\243\276\n\301\r\233"
+	.ascii	"\325\223\245\306\235\204\347\255\366\034\032\264\266=\256\306"
+	.ascii	"9GR\033\246\365\200Z(F\322\237@\322\237Z\351\317\250t\303\311"
+	.ascii	"\224\376,J5\b\223\036kIA`K\217\323\3223\301\322\333f\203]\235"
+	.ascii	"\340\003F\227\306\307\\\351\325\200x\245\310#M\252x\365\017\232"
+	.ascii	"0#\250\246\306\3074\322c\030\351\361\212\364n6\007=N\221\036"
+	.ascii	"'\323\256\343L\251\321\345\250\361\257^\372K\227\236\016K\332"
+	.ascii	"6\007\375]K7\320xc\375!D\364U\br\0054$\215\372\032w\215\266\361"
+	.ascii	"\276j\253\334W\"L\345\214\354+\034\275\234\2218\326n`\355\006"
+	.ascii	"8H\025\327\031\212\177\325R\036\2367\215\347\330\2602\315'FR"
+	.ascii	"\035\353\001\375{FO\331%;\240`5\376m\363s-\365\3775\027\330\214"
+	.ascii	"==\2115\376\375J\177{\2446\333\034\264]\364\013\333\274\224\206"
+	.ascii	"q4\r-H\262\361oV\232\202|)\350oU\372w\213~\302\021S%\013\263"
+	.ascii	"\237\232\005\026\272#I\215\177[\244\277K\251m\247n\272IJOp\335"
+	.ascii	"\324\313\233$QkN\032\377\346\364}\227\376\275$F\223\026\245%"
+	.ascii	"\251\361\033.\265Sl}\342f\211\t\263\266\306o&\351"
+	.string	";-\265]6\007}\033I\355\224\365\200\002\300\346\240\226\211T\373}9\251*+\ns\363\026C\013\257\361\337\231\257\246\213\231\324\224\306dG\266\234\364\360\360\254\236\355\263cl\031\233g\311\330=\333\264|\277\275\263b\256\303\344\263U\254\335M\222\231\213n\336\2442Y\231M\373\275q\201\375\226\t\237m\263j7E\314\314\204Vi\255I\261l7\311\r9Y\205\3255\345\312I\017\317\016\341\263a\326\210u\203bf'\364-\210\223\036\336\222\3372\341\263N,\333M\222\231\233~b8\234\364:h;&\027@:`\035$\323z@o\276\262rk\367[&\226\212\r\323S\025\330(\t\2027\327\270N\007\3079i\"\243\361[\231\336\202\275Y\270\233\233s\324\334o\277X0v\316z\261MKg\343n\273\330%\307\314\234\2239\347\333+!DX:+g\341\254\033\224\003\202|\241\313\231y\273\266\305\262\335"
+	.string	"s\246\362\322\2253\363!\374<\267t\226\213e\303\340D\316TQ\027\030aY\212\202\2273\263\003\235\016:\350\200\346h\306\222\271\031|{$\255\371\221\336f\245\2673R\213\305f\261\315\f\254\226\207\020\361[D\004\307\206\017\b_\231\306\267.\322\333\fP\333g3@o\237\322\227Y\017\250u\343\271\265\362\234\214c\323\374j\243kL\200>\233\203\336.S\235\234\255\007\364\026Ez\213\224\336\026\245\366\211\205b\233;6\312m\023\273v`\222\231\307rf\342"
+	.ascii	"\265\204\221Q\326\3704\244\267;(N___\237\335A/\202T\003\353\001"
+	.ascii	"\3056\007\2759\333\034\364n\326\003j\325\332&\261Jn\325,\222"
+	.ascii	"\207\020\361\232d\006\313\231i\325p\316Hk7\270\261v\203s\r\007"
+	.ascii	"R\f\305\367I\317\201\324\232\3313\333|\233E;"
+	.string	"\272\204b\342\300P\265\214\322\370+\244\267oCS`\337\206\376\204\364\346\245\021[\344TB\003\005\226\306c\277'L\031{\215/\201\364\277mZ1K$\353\340h\271\261y5\376\002\322[\346+ \222E\374\227\276\323\233\247\254\220\337~Y\260\235\253L1\225\313rfr\260!\243\305\310\253\361\231\326\003\232\332\034\364\357\024\032\005\340\217\225\354\033P\202\317\235\356^.g\264\307.V\271,\374\327\336\f\374\226j\311M1\3607\006\377\r\300\n\377\025\300\377(\027\370/\007\013\374W\203\377\252\360\367\006)\374\027\001\277\255R\201\017\3308\007\027\205\337R\371\257\t\377=\341\357\f\376\301\217\327N\363\343#\177\237p)\360\267\001H\370m\334\235\300\337bn\t}\200w\370\361\211\277\035p%p1y\366m\200'\261[l\221\215\323\362\003\374x\206\337\276{n\004\354\361\353/D9\372c\034.\034\377\330F\224\233"
+	.string	"\013\374\346\3072\376\376p!\360\267\001\356\003\376\3731\213\347=\311k~\034\374\237\367\267\007\327\001\377\3054\323\177\033\360[0\227\204\031\177\237\r\3432\340?\337\223|"
+	.string	"?\356\371\373\306\035q\027\360\333\023\244\340\267$h\342\035\341\277\"\376\356\320W\256\b\177\177\3757\204\277+\270!\376\016\241\207\227\347\202\320r\377\005q?\374\266\205\373A\003\177{<2\030\\\005<\312\203^\302\217i\376\016\363[\340\365\340\377\030;\3243\267\371\361\005\177\227\340v\360\177\356?\335\177/\377\345\364\376\207\351\344\177\023\360\237\314\335\371\217g\3458\370\373"
+	.ascii	"/\264\002.\370\261\007\376\313\301\1777\370\357\005\377\255\340"
+	.ascii	"\277\035\376\013\374o\377=\346o\273\277\275\374\375\3667\330"
+	.ascii	"\337Y\177S\375\275\374\373\350o\023\374]\374[\004\177\377\374"
+	.ascii	"m\302\337\r\370\333\347o\020\374\315\201\277]\370\273\205\277"
+	.ascii	"3\360\267\005\376N\341o\024\376\216\300\337\017\370;\204\277"
+	.ascii	"y\376\006\361\267\002\376>\300oY\374\266\306o\233\374m\200\337"
+	.ascii	"\032\177;\364\277\356\377\336\337\033\374\235\301o\201\177\317"
+	.ascii	"\374-\200\277+\370m\013\177w\370\333\346\2673\374\226\004\377"
+	.ascii	"\203\376F\377>\177\333\367\277\314\177\264\337\202\371O\346?"
+	.ascii	"\336o\345\376G\371\257\345\267q\377\223\374\177\341\267p\277"
+	.ascii	"\255\362[\266\337>\371\255\215\337:\371\355\332o\257\376\273"
+	.ascii	"\360[\344o\363o\327\337\036\177;\202\337\332\337\376\177\337"
+	.ascii	"\177\260\377\037\370\337\366\277C___\337\377\243\341\007\216"
+	.ascii	"\375!\210\002k\377\201\230\205\222\257)\215_#\225\376\330\004"
+	.ascii	">\272\273\3416\327\370\270\b#\217\215\216\215\360Q\232s.bf\246"
+	.ascii	"\237X\234\223\036^\206\352\332\371q\362\370\350^P3-\255\255\306"
+	.ascii	"\277\003\322<\271QE\245\361k\230\322\376\321\214\\\346\234\235"
+	.ascii	"Nf^\032\325\240\277\275=\255\335\371m\354\265\005\370\217\377"
+	.ascii	"\021\025\310\031\331\207\227s\266v\351\216$H\030\032\344\323"
+	.ascii	"-\347$U\221\004\250\232\222T-\224cTM\034\224cT\271(\271U\304"
+	.ascii	"a\231\251\212\224c9sH&\213L\230jR\216!3\007\345Xn\312GW\232l"
+	.ascii	"fR\025\345\344T\346\220\223\031\231\307\246\2324P&\251\232\224"
+	.ascii	"c\310&\016\3121\252\246<F\2257\344$ry\"\231\227\034\362\030\025"
+	.ascii	"\230<6\325\264A96\325\244\034\243\342\262TN\204Qq\342\303\263"
+	.ascii	"\332\2633\224\311\274\244\024\003\271\334\340\246dN\345-9\333"
+	.ascii	"2\244\274\314n9\027 \347\030S\313-\310\026V\315\310m\311(\r9"
+	.ascii	"e\2319g\013\224\214\252\246r\322\255\310f7%\217\251\234y\030"
+	.ascii	"\001e\245\234s\026\241\210\351\226\261\254[\021\215\0309\005"
+	.ascii	"R\316\002\310\314\234\225r.\262\331-\347\\\224s\376-c0s~\261"
+	.ascii	"A\331\245\244\2243\224\216R\216Q\244\004)\347.\213SkR\216UM\361"
+	.ascii	"(12\326\225M0\213\2542\305T\356\312[\250\226\351XQ3\247\3109"
+	.ascii	"\3330iW\223\212:\276eG\275\231\220\322\307W&\212\312\254\261"
+	.ascii	"\005?"
+	.string	";%\023\023\215\257\336\275\273x\326\r\nw\345\3352w\3176\257\336%s\365n\336\245\374\230\200|Q\261\240\003{\225\264\"\016\305\247\341JO3\225\376w\314/\336\177\303\\\273\233\255(\323\032_1<\277c\306\266\224@\032/\300\346\240\247q\221^\246\365\200\216\370\362[\367_\272\013f\311X\323D\343\366\262\036P\016\346x~\277\234C|\204\265h\214"
+	.ascii	"9\333\274r\226/\005f.\352\371r\322\303\313\313\245\007\247a\272"
+	.ascii	"q\230I\257\315F\343\317\340\245\\\266\300=\301u\371\272Z"
+	.string	"n\026\333\274p\027\213\225{E\310\205\273o\367\nY\323G\035\0366\022\343\"\005\305\237Y\222~\006I\372\337+\026\356mJ\n\243\306\2379K\377\353V%\204\"s\311)\277U\376K\345\372\260p8rVgU\032\317\330\034\364J\341\371\235\222\\q\266\325\030x\333\330N\244\246\214\033Q~\331,\\\brf\346\234+\340\300\266\224j\034\202\3477\312s\274\232\314 \003%\003\034\346\223\022\215'O[\272dHi\374_'ka\354\232\3305\276M~br(u4\376\214Xz\321\256\220\313\204\313\242\033\303qF\307\323\343*os\231\236\331\360\242\3139\223\355\b\322$\202\244\253\311r\200u\255e\245]\037?\356\327\rrCN\232\340\272In\221{\344\212\335%w\354\232]#\027\311-\273j\227\354*\271i\367\3542\261\315\213\366\367\220\333L^\264\013v\277.S-5A\266E\307\365$\267\271\f"
+	.string	"\022\\\031]\316\231L\307\027\031\017 th\267\313\302\331\020B\327\274q\244kl\353\242\260a\326\2253\263\211v\265.\212\333\\\246ddht93Q66(\271\002\340\317\364Hq\276\3140\270l\244\353\326H#[\021\343\016\271]\312q\324\326\3703Y\351g`\244\327\353\002\261M\016n\220\237Hff\346\314\304\351\254=3\261\306\237qJo9@o_\237\345"
+	.ascii	"\375\214Qz5\353\001=\320Kz\240\224\364@\264\364@!\351\201]\351"
+	.ascii	"\201U\351\201I\351S0\351S(\351\323\257\364\351U\372T\005\326"
+	.ascii	"\025F\302\263\273\262\001\304\212\"\303\255\361\255\321mtH\310"
+	.ascii	"\306O\221\351\377Kui\\\251;ug\334*\333\274V\377\205\272.\256"
+	.ascii	"\325M^\245u+\313H\247\003\204Q\353[\342\265\270O\313\276\245"
+	.ascii	"\327\330\265\272/n\324\321-\311\263\342>a`\244\314H\252\2350"
+	.ascii	"S}K<\246\253\002\t\016\006\331\265\272'\356\322\221\331\267\364"
+	.ascii	"\312\231\251s\235\254\340\262\344\006_\0307\206m\352\\\031\330"
+	.ascii	"\210ME\214\306\377EIS\220\255\016\372>\253\203\376w\2266\323"
+	.ascii	"z@wl\016\372_3\375"
+	.string	"\357\323e\361\265\242\206\026\023,\347\214\003TR\246\007\213\036*\234\254\025'dHM\277NV\315\003Fv\3245\276\313\233\024TK\242\224\377\2013=hd\361h\374_V\372\337\245\253\304WWDI\212_\245\317\325`p\003\266FG\246\361\357.\212\377\300\340\332\r\274\3067\251\006\371\204\304J\343\377\250\322\377\\\244\367\350\"\331\346\327\256\211'wRj\215\377SJiXC\177k\350\321\275\364\277F\027)\306\026\004\331\370\"\217\211L\331\\\344\323\224$\267\250\257\231(\371\b\322\370!\220\3512\030\030)S\360\272\342\273\3316\273\257\365\336d\275w\035f\316i\335\327b\032\217\306\n\212\030'\235\016\354\362\213\213((\266\250W\232\267\204\205B\331\370(Wz\364j\314k\204$\335\2655>\372\224\036]J\377\276\273\024\374\244G\263\310.\f:\226\343\356E\343:\346y\242N\016G]\203\2611*B\276"
+	.ascii	"C\327\302MoG\343\261\231\246+tN\032\247`j\247\021HK\340R\025"
+	.ascii	"\230\021\322\327\312\272\320\276\326\245k\007\324W\322\026W\347"
+	.ascii	"x{\021\202X\031\025+\272"
+	.string	"\305\333\027\335\230\0212[\235\245u|\315\272\225\235\360\346\342\357%=\327Q\332JS\351/\275\245\333zJ\257\265\224~\353\270\326\322r\355\326P\272K;\351+\315\244\2534\227\306\322p\375\244\2334[{\261\315\316b\211\274\323\372\310X\221<\272\326\352\033\235\245qpp\231ji\222\230\214!a\r\2464\201\342^\206\360\350\261\324$\242\227B\251\227\214\204\310\210\352\031\326\rjCN\212au\335\310\322\271\314\256\037\331[\024]\316Y\005T\307\030\201\264\004\232\250\002B\307s6gB\331Ibat<|4\220\021HK \n\261\024tex]93\203\bi\260\021HK R\325\t\272\234\2312\262tUc]f\327\317\210\221\024]\316\231\314\254\301n\2128\344L\343K\017\311\322\314\006\303\300H\231\202\216=\2726\312\322HZ\211u\203\312\271I\003 WsR\360r\316\035\350tpb\321\312c\342"
+	.string	"\374\267\332[\311\037q?\334\270\032\277\003\n\023\247\335\206\025:\331(\231\243\244\3206\027qA\360l\230,rUa~\332u\022\214\344\025&\215O0g\035\260\216\310\225\332\277\234\016\217\007^\\\343\223\256\223\276\250}%\033\237_:\311K\331V\214\263\253\212\025\2472\215\321~\306\241\235^\2542g\250\251\"0\fh\302\202\332\301S\260\3109\235r?\275\030\231\321\222\305\310\252\361\331\345\334:\253\302V\267e\345\203m\253\361\twrI\227\256\254Ti|n9\261\204\211\351\2615\326B#\206\206l\221\345\007\332\370"
+	.string	"\222\367\032\277Cr\310O+C\3167\t\200"
+	.ascii	"\013\247)E\025)\347\225\237ok\250\233^\236\r#4SJzT\032\237SN"
+	.ascii	"\267\0311\265\272\260\306'\225\263\312M\036\020\026cwQN)5XXG"
+	.ascii	"\372\032\237lg\333M\324\024\2163\271\265\023\212\217\236\026"
+	.ascii	"\261\306\247\223\363I7\231\350\020\343\246\344lR3&\f\214Y\343"
+	.ascii	"s\311\311\004\030\206\244\013\022\345\310\251\206\203\305\207"
+	.ascii	"\232\\\343\023\311\231d\006\005\215$@\224\230\235i\277(<\214"
+	.ascii	"\220\032\237g'\032\356\"uD\211V\344,\263{O\332\264\032\237FN"
+	.ascii	"2[\326e\302\254y\212\375\034\373\20187\224oS\215\317\301+\375"
+	.ascii	"\331<\211\374@t\n\226\243\334\370\034\270\3223\354d\332@\023"
+	.ascii	"\243\244\3619\330H\377\001\221\247\246\246)\0348N\260\253W\223"
+	.ascii	"\213~p\211\013r\003e\005RY\216\237`?\277\252\230B\364\032\237"
+	.ascii	"^g\220S+\206\336Q\343\023\310\0072\362f\3505\376\271\343\352"
+	.ascii	"\n\216\036\215\177\372"
+	.string	"8\177\374@\2332&$(\032\237\203\213\364\344q\366x\032\303\302\327\370\034\234\322S\307\271\003\231\002k\254q\333\257\241\\g\227\333\f\274\243\3064J\270\222ti\374sk\206\026\227S\343\231-/L\214i|\016I4N\343\314\262D2\223m\361\302\006\233W\316P;'\230\241d\273\3613\353\377q\031=Yi|\3328\261\376\003\177U5\220^\234X\347\325\f\033y0\322\2570Y|5\304$\307d\3258\255,`\321\245\307i\325z\347\231TZ\213.N?U8\235T:SE`@\bs\243\206\023\274\2600\253*Q?\251~\316\b!\342kOR[\315\306?\247p\250\220+\330\032\237R\037\\!\261\264\032\377\303\336U\232\212\306'\214SF\031:'4\034\036>pL\211\221FFF\253H\343\363\351|\261\027\346\004\226\032\262\2702Z\\\234PdR{a,@]h\315@r\266\270d,"
+	.ascii	"\226\025I\273\322\370d\201M\374\007V\240"
+	.ascii	"\305G\266\002\213\226\252\344r\207\334\222!\215\177\231\252\216"
+	.ascii	"\324\032\177\303Xj\342?\225\347\022\037e\250\035`\223\016N\207"
+	.ascii	"\322\317\345O\246\020\"\336F\0237D\213j\351\007\266\331\224;"
+	.ascii	"!\215\277\001,=S\374K]\026\026)\215O\024o\013S\245\211\262\361"
+	.ascii	"\231\36466\256,\275\306\277;O\374\007\372 \231X5\276m\336\313"
+	.ascii	"\347\242\024\031\365h\374\rY\3517\320\340\373\231\371\316#\224"
+	.ascii	"\013\216\214\"TT$\177\036\375!D\354\244`XS4\032\237E\247Q\363"
+	.ascii	"\361\321Pr\032\235\310\236\323;q\307<\2778I\301\321\267\"\375"
+	.ascii	"\177\f\346\370\016\f\326C\307\344l\004\002\323hKVB\355\334\324"
+	.ascii	"\301@+s\254\327K\311\033b\215\361"
+	.string	"\030\234\327\\\232]\311\303d.\017-wH\030o\352\202\231\250\026G\2504\376\006\246\024\213\331i\021vV\205\303\034\333\375@\340\222(+\252\306\337`\"\375q\335\017\374\235i\201\321\325\370\033\220\351q\300\310\311\341/G\2722\024\324\316\n)|4\347\216\277\334)Z'\230\215\261\027\034eg\367\226\004KQ\322\001V\245\361q\240l\331\202\343\270`u\315\350\275\201\035\341r\034Wc\327\267W\246\361\357p\324\177`j\003\212\222W\343\343\f\321\242\005\217\245\326l\211\306h+\216K\343\343`\245?\256\322\304U0\226\024\230-\347\244\347u\374v\214\345\307n\330\212\215\322\204T\325\030_\3419~{NRR\016\273\306\266/[\017\250\016\216\214\024\n\024<\245C\0222\260\346\213\243\202\304Q\216\247`)j_\324\344\260\024\334\206\004\251B\256N\247{\360P\256h\214\331l\034\2319&)\234\2655\354\004\370"
+	.string	"\033[t\031\nj'\004G[\274\234|\255G\234\220\034^\226,\301LR\3104pX\347\t6\243\252\306L0\215\275>* \215\177\343DM\315\262m\300\313MZ\232\226\206\221l\310FpJ]]\270H\265h\214\221`,9\026]\324\376\003k\222\234\230D5\376\215Wzv\206\271\212\350\335\260@\222\266\244\361o\254\312\312\2766b.{\360\233\247&.\322\304F\214\020!\202\307\310\310"
+	.string	"\2618\335\371\020;\036\373Z\302l\001W%F.I\343\333\360\245\267\251\222\3768\254\211\3030\r\314\314M&\370\302\364\3406M\322\036\030\254\007\026\202\346l\231SL\313c!>|\340\257\264\310\302\235A\355\324|\021\223j\013r\374u&<\255\271\306\030\310\315\321\214\003k\214\275n\227\363\007\024\335\2621\376a\023\226\336\246*\375\361\216&\336\321`\256r\n9c\304\232\213\270 x9C\361`&\212\013\025|\215o\203\224\346\310\201\271l\3169C\345\233\345\210\223\236W\r\336\326\026\346\262\352\342\244\207\367;\333\304\\\347\025\036[g\215_\303%\255Q\003k\031\tq\322\303\313:\326\272]^\216l5\3067l\217\024-\216\032c,\013g3\205\355D\212\306\370j\306\f\205\324\225\306\330\006\360\355E\034\\\343\337Y\266\377@\224\n\223^^\343\327\2601\001"
+	.string	"\365c\2511\022W5\214\246,(\215_3\226\376X\352\230\352\307Sx\006\222)Ej4\336\261\036\320\323\346\240\266\t\317\261\024\246!\206IG\024\226\261\206DJ\2621\216\001\334\252\202\244\324\3705[\351\217]\034\303\370\361\213\246\302VQqR\215\257\315A[\213\347\330\305Us\202\244\327\030C\375\370\t\267@\275\300\26115\266x\326\003J"
+	.ascii	"\233\203\342\025<\307,\366\322\352\220\215\007\200\227\307*~"
+	.ascii	"\334\204\235j\272\264\211\2155\276P\254\007\264\0016\007\305"
+	.ascii	"L"
+	.string	"<\307K \327\227-B\032\223`sP\245\022+u\3169w\375\310\252\246\320e\250\345\316\217S\330&V\232\263Y\221l;k\214O`\233\276\274\276\261\306?F\201\223\204\330%i\314\304\2245\025\353\220\250\302\017\021\211c*\\\205&\330\034\213/\034\213\306\236!\006b\350)\006\365\344\204\b\241f\035\001\303\017\021\211#\315\201>\034c8\nW\020=?\001\210\341(|aUK\374\016\364\241\004qh\\\217\001P\215DC\230\250\006\031\327#z\240\017B\352z\254\341\b\342hTe\030\032}00\252j\t\034!TH\025\n\022\325\241\342\rQ\035*\n\251B?\251:\214\241X\354\371\241!\252CE\237\037T\204\021~Du\250\370s\2120\002P%\016\203\210\303\"1\355)\006\005\tU\237\016R5h\3703$\264\376\324c1\250\347\007]\205B\306\342\017\372\263\022\207\306\241\237\337\201>\250B\303\025"
+	.string	"C\252\032t,\022\205D\340\201>T\240\256B\325\330\023\024DD$\026\211\277 q\270\006\r\211H\004\203\033\324uh\234\341\007\025!\350#,\006\341\370\f\2132\340\031\212F\240\265H\374\375\b\325 ,BP5\026\327c\260g(T\\\205\301\340\006\243\352#TS\260"
+	.string	"\003G\232\225HT\244\200\216\252V\300G\250\246\260\032\2059C\305\325\205\016%\210C\342P(\244n\240\202U\270\302"
+	.string	"f"
+	.string	""
+	.string	"\302\207\325(\034\372\340c,\366\250\033\270\340@\037\212C\237\365\350\301hT}\326#JT\207X\260Q\217\305 \n\020\251D\032P\203\352*\\] \242\240\256Cc\007n^\300y\317\320\250\022\325\022\351E\030\341\203\021F\320\360\373\b\022@ \001\004\364#H\340\341!a\004\236\364#\360\334\003}\bA,1\f\022\006\203\2775h\\W\341\215J\202\3411\030D\325\240!\n@5\270\201"
+	.string	"\034\350\303\017\021\t!\241j\\\217 \210E!\241b\317"
+	.string	"\216\301\037\"\022G\324\270\016]\037\242zW\364\b\303Z\302q\025\256."
+	.string	"\205\204\304\032|p\326\340\b<j\211\022b8\n\327\233#\f\353Q]\205+\304p\024\256\036\2160\254%\370\250ABb\211\241\013\353Q\030\264a-\301\204\365(\f\2629\302\260\226\240\022\207A>B\325\247fx,\2660$T\201j\324\022B\243*C\t>\352*\034\032\366\fW\242P\347\b\003\320\n\002\217\020\221\013%\210C\031\212B\030\320 \024\352\360\002\2618\\\211zT\032N\b\022\256\305\025"
+	.ascii	"kP]\211H\f\215\353*\f\306p\024\256\033\016\364a\003\264\206u"
+	.ascii	"h,\016\215-\364\fW\341z\274Q\205\204\031P\205\204\031\210\341"
+	.ascii	"(|\201\004\321\221\246G\005\352\001\256\301#\f=D\"\024b8\n\327"
+	.ascii	"t\r\n\327 \325\004Uh\270\322\034a\360)\016\215j\013>\252qxT}"
+	.ascii	"p\016\364\241\001=\352\320Q\025\032\256\351\032T\205\206k0\230"
+	.ascii	"\366\250\307\240\f+\272\006K\020\213A\307`P\220\260\347X\303"
+	.ascii	"1\030\344\320\243\036\211A\031\326\337\201>\254=D\306\365\b\342"
+	.ascii	"\250\016\325\260\2028\256C\022 \210\210%>\240\201\2108\f\372"
+	.ascii	"@\204\021\202#\214\240\001\204\352C\024\324C\034\2020\036\211"
+	.ascii	"@, \204\217z$\"\022\005S\324\270\016\251G!\211\033\343:d\263"
+	.ascii	"\016\2153\324\370\020\325\340\017\021\t\365($a\243\036\205$\202"
+	.ascii	"CD1\364\bI\004YP!\210\343CT\203\252\f\302c\220\005\025\2025G"
+	.ascii	"\243\032\203Q(\024L\211C!PO\020-\022\325\240\341O\360\027\342"
+	.ascii	"XB\030\364\023\374\255\301\237OP1HC\024\"\n*\366\004\215D=A\032"
+	.ascii	"5\210\204p\225!xc\024\002\365\340\037\"\022\253\261\bt\f\002"
+	.ascii	"\327 \013*\004gb\350)\006\005\3175(\302\b??\305`\020"
+	.ascii	"\270\252\307\237\237b\360\307\202\nA\232U\206\036\325\247\330"
+	.ascii	"\023LYP!h#\\\205>A\325g8Cpf=\016\203l~\210H\004\217\252QU\215"
+	.ascii	"?\301\2325\250\222`xDE\370\b\207\202AT\365)\n\005\317\367\254"
+	.ascii	"\007\342\340\305!\325\bb-\026\215 h\210\305\243P5\242\307\240"
+	.ascii	"\332#4\276\340a5\n\327#\315Q\r\352\251\201\002>D\025\270\006"
+	.ascii	"G\254\304!\321\317g\330*\221J4\202\323G\250\002\341\240\241p"
+	.ascii	"\305Du\250\210\327`\210\020V\342\220(=\256DU\206\023|\324\241"
+	.ascii	"\241\242\321\307&\250X\234@\360\364QW\243pu\301f\r\016\001}\204"
+	.ascii	"\252\021hEOXA\005\024\360\t+\250\200B\220\005\025\202\351yx("
+	.ascii	"\240\001\f\031\250@\332\363A\355\021\032\327\240Q\r\"\362Q\201"
+	.ascii	"z\216 \210C\241\020\210\036\343\021\304\007\004\250A\303\037"
+	.ascii	"\374\037U#\233\241\242\204\256(\t\022Uc\n3\202\344\304\217-\253"
+	.ascii	"\250\314\221\0266L\354\250\250\245\301x!\204\354\013\032\352"
+	.ascii	"$F\006\327\031\2462\"\305\314\f\235\241\003i-\255\f\265a\177"
+	.ascii	"t\315\345\341$\024\354\231\345@\215\240Elp\354 b\204.]a\2627"
+	.ascii	"fD\354\313\307\030\223\033\221s\f\316\211\250\2712M!L,\277\266"
+	.ascii	"\036\311\037a\\\330\314\305U\325\020\032d\266\314Y\021\202\265"
+	.ascii	"\316\254\030I1\300n\035\r\\R\026\245\257\345\214W\f\253'AN*\240"
+	.ascii	"\n-\263%@P\034\350\333V\r+\2573\253oL\325\260\362\343\013\272"
+	.ascii	"\005\254\017\207\017\254b\206\354iO\253\307\371V\023e\013\022"
+	.ascii	"\b\017\f\205_\244p\262\266\343\004\273\341\221V\306K\207\322"
+	.ascii	"L\227\023K\232\344\210k\302KSva\030\375\243I\003\t\345j%[^\360"
+	.ascii	"\260C\267N/5\214\2401\0333\323\300\206\244h\323:\355\200M\312"
+	.ascii	"~\350ea\275'A\340\214\320\033\226\315l\316\r\005\212u\036M\031"
+	.ascii	"\263Zj\\U\205\332\320I3\230\2162:\024N2\370\320\032Gm\240"
+	.string	"K\026OfX\241K\034\314\030{\215Q\032\367\nV\241b\212\353^\271D\300\356\302\300d\310@g\240\025]\273\266-SGg\3303)\265\254\306\250\024\272D\217p9\022\2441\032\365/w|Sx9[\250\013\324\005\n\343JZT\244\004\202\2768\n\303\314\205\230\025/V\254@[\374&sTZW\316P;i\206\241\267\005}:\332\202\017\357J^c\224\005\272\264G1n\310\345(\241(P\024\250\223\331\f\037uuT@N\240MG\235~YT\254\234\032\243)\320\345\321\016\275\251%\023M\327\2130{J\350\322\223Q\336\223\306\317AJ\225.\026\031NZa\035\362\320\344\223\350\tK$3\2416t\374x\372a\325\0255\217\216\236\370C\210@\225M\320\274`\241J\324\004\022\217\276#\267\tF\"\345\224\005E\272\333I2\"\306\250\215\314\317=2(\362\326\245\271\210\371\200\265<\037P6G^"
+	.ascii	"\231\342;\212<Z\024BD'-\255Q\211i\214\346\337@MYB\327\370g\337"
+	.ascii	"\314\016\253\261\037\215\237\376\003q~\224A\241\245\361\251G"
+	.ascii	"3d\r\351\255\361Y\306\326Xr\273\222\367\003k\300h=\335h\374\016"
+	.ascii	"a\351;x\211\021s\216\321\231*\002\263\223\243N\207\030\274\027"
+	.ascii	"ZY\214\3161\226-\204\253\250\243\301S\202L0KA\030\213*\244\214"
+	.ascii	"R$4\234t\023\026@@HD(\026\355\262\254\017\023\200\304\016\354"
+	.ascii	"\003QTS\316\261\021\022I9I\031\3112\006D &\372\316\212\271A\t"
+	.ascii	"6ypK\226g\245\326_\374\315\022\377\302`e\365\"\225-\017\"$-\205"
+	.ascii	"\016\313%kU9,\221\214&\231\325=%\321CA\026\215\034C\327\226\350"
+	.ascii	"\335_&!\036s\236\371k\233J\036fR\376\177\361\to\256\024B\023"
+	.ascii	"cT\244\3608\200\031\364\314\233%\013\375 \027,\025C \320\345"
+	.ascii	"X\306WE\323\245J\371\313\237\210\317\336\354[BDx\207o#\223\345"
+	.ascii	"c`R\032\301|\003\373H\006X\254\273\247\347\322+\217\006{\025"
+	.ascii	"\236\330\242\363\362\2336\207D\311G\224DI{K'@\254\242\245\023"
+	.ascii	"\326\022iBF\325\364\334\252\t\363\037}\337\261o\246\352oT#\220"
+	.ascii	"\035\247\370~zW\203\271]\226\203L\250S0a\025\213!\241\026\264"
+	.ascii	"\\\216\361\fh\265\202\337C\306\345J\272t\326\240\"m\360L\326"
+	.ascii	"8\201Z\302j\345\350\356VDa\006)2\343J\334\354f\033\335\002\002"
+	.ascii	"e\177\033\026\253L\261\2417\"\307Es\320\364\377Ghc\177\210\260"
+	.ascii	">\r\216.T\212\342\3005s]"
+	.string	"\350\241\354\240>\3541q\204\231\352\272\333\002\327\367\026\017\341\2028\214\b5\036\300\264\322\343\243\243\373\370t\303\213\340\r\353\320\035\273\221M\313\316,\2046\230FT\254\353\177\004C*Qjh$\310\311r)\260\007\331\037\b*\005!` \234W\335\271Lv\3527\317\355M\252\352\273zx\253\374\370\352o\252R\2553\303\367e\257&=\322\254\273t\363\300\227\204\266\022\211gT\337&\231\324\242\\\371\250\241\033-\263\250\244\234W\236\2646\177\200\207D\021\247\343\177\233\3319=\034F6\373\263\216\333\320\337\020\306QJH\027&\363\252\026\210U\tLLi\203\032\225\301\234\203\002\004\357\003E\353\013[\255\3159f\304\005\243\364\250]\225\352\002\b=\306R`!\251\275\265\373l\b\250z;\304j`\330\rkG.\373\t\213lP\272T\326\261Q\205\320\377\221=\322\233\316\311a\177MP!h\300#%:]"
+	.ascii	"9o\372\251\315\351\333\005\341\264(\236\240#\337y\350\345\222"
+	.ascii	"yHI\211\244\n>\324\367.\304q?P\314\215O\374\006E\257'\220\363"
+	.ascii	"6\237\260\331\274\033\226\t\236\221\253\323s\037Q=\371\246l\035"
+	.ascii	"<\263\247SIOrAC\232\240\001\247\304h-XRj9\3525\342>\341\372%"
+	.ascii	"?\237\261HX\317G\030"
+	.string	"PRq1\024\363\001\002\257\264cz\377\002\177\tE:+\245\273\305\256\030K\273FXs\306\354'\214p\341\021\263Y\221\364\n\004h\314\264G\270w>\233\355WH\fS\332Q\302\270\303k<\257\224\"\333\205\337&&\272G\002ED\234\206\276\034g\362\235\307\"\321+\f\2265\211\240\321m\375\206\036\251t0\027\205\231\200\2509\017\371\322\304\032n\030\322\216Z\261-\357\313\277\356\345\017,=u^\3002\370*\320\263\253\262\2023\311[\346\346\211\"\346\"(\217~\333)sk!3\204\017\017`\340\332PH\206|\001\212Z\f\032\006\366=\341b\007\rX\263\242k\211S\271\r\224\202\3317\020_\367G\220\260e\005\225\006\321\177\276\374\353U\361\212\316b\t\200\336\354\016\322\3406:7\023\201\235\313\241\266\031\230\222\375\342\302\024\255\261\211N\350-\214\304t\365::\267\276\0235l\233\t\362Q*(\024 "
+	.string	"\366T\330\b%\246c\307\233\005\302\213\302\242\237\201A\013\220{\326E\277\272\330"
+	.ascii	"hr_H_\356h\204\253\bv]w\250\214\003\243\272v\006Q\244\223\224"
+	.ascii	"\260\201\241h\365-\345\324\270\001\320pJ\025n\013[\352\027\362"
+	.ascii	"\250F\036\201mt\347\316W\305pV\315$\003\264\261t\327d\347n\335"
+	.ascii	"g0\373\023\312\210\025y\004\203w\f\033s(M0y\371\305\230E\034"
+	.ascii	"\024\231Y\353u\376\307&\303\230\241\257\263iEI\304\377<+\n\272"
+	.ascii	",H1\206HD\300\303\202\265\233&i"
+	.ascii	"a\314\370k\243{5?\351g\202\2600\341<q\252\326\364\244\361\300"
+	.ascii	"\220\034`~\304\001 \030\221 \001\r@\275\203\021\340\026\005\211"
+	.ascii	"`\351\304\302\233\254:{\007T\202c\231\373\230\216\210+\262\206"
+	.ascii	"\351\035\301\350\344\300\021\252\211/?\215K'\314\004\234\322"
+	.ascii	"t\234\340\261m2>\201U\216\275t:\273\345<l\206\001\002^\220\213"
+	.ascii	"\035\0260\302q\271p\260\016t\253\220\203\b\261C\235\230"
+	.string	"ks\275\270e\b\261\235\210\331Z\304\302\325Uk\314\013\217\306\016W\265\n\271\320\244\363G\245\026\317\232\272\233-\267e*rV\351s\025\360b\n\247\027\2561\273\021\353\276\n\362\260\rF\251<\271\344[,\311\304\005\261\362\267\300W\303btf\\u\345\017\3523,\345\240\3137\345\026]\030hQ\337QKN\031\017\365\362&\202>\320\200\200@f\344\300q\f\275\234\243\267\306\257\325\240\335\301\326u \212)\350\277\007\374\267I\372\"\022^\001m\002\b7\377\274}\204D]\311!k\223\360\301\277\235\263\206\271\223\317\264~\036y\356<f\232\3700\317\366\032Dt\237P3{\246\373\335\fC\277v\277GQ\200\301\214\240\302rFU*!\303'f\003\273>\006\255\240fML\255o\306\027\006\244\037s\233v\2642\332\307\247!\003\266\035\037\211\270\240\375\311X\200\n\2503\026\245J\326\227U\231i\215nd"
+	.ascii	"\224\002\370q\035\314\242\361\036f\246\037(.\256\204\227\267"
+	.ascii	"!\001N\211\342\200\271\213/[\335 \303F\026\303\245\254\220\352"
+	.ascii	"\330\276\272Y\376\013\316\342t\201\327\017xt\366\363Z\\\320\202"
+	.ascii	"{G\267Zd\366\013\036\270].\212\312\217y|\340\022\372:\361ji@"
+	.ascii	"\203\215\217\036\001\246"
+	.string	"[\344L\264\260q\212\344\204\270T\204|\261\324\305P\247\301\335\306\002\310\343\300\260\231\017'.\247\332\242\3026PP\245[\302\306\001\316\305%\003_\347\267w\233\236\023^u\003V\006\204tt\336\354\232S\030\371d\0165y\230Q\030\260o\004\254\302\375*\213V\2078\276\204\340t\3443b\264\221\001.\271\023\214\032\3005\314\336\207\0325SQ\231LxP\364\350\375\366\237\346\300\370Zed\032\243\303\006\002\313/\246\n_]\336}x%\027\356K\233\357\340\305\306\026\210\371\020\335\350\276\271\007ko\244\\\213\244\263\230=vl\246Y\311\n\241(\233sNna\375Ll\330/\330i,/\267\270\242\332$}\020\330\b\212\363\301\225{\211\bg!\313u\3537\252\241r\030\213!\001\210\\\0240S\326\247\005Y\252\024NC$\2021Fm\326\312E w\023\n`M\326G2\267\316\027}\241\207n\345i\366"
+	.string	"V\007\244\2142:my\313S\206\b\341\2165\300\377f\031\207\r\246\316#W\241\310\362Y\t \3343\272\f\305\376\001\261\237\272\305\322\351nr\301\327\361b\342rAj\243\375r\226!\305\344\007{\317\265md\252E\036?:~\013\356j4\305\304\310\205M'\013\002zAG\035\373\r\033\200\t\034\033(K\320\357\223\343Dv\022\316~\237\353DZ\261\231<\024\301\325\2778\226\321v\245\2044\225\224Z' \267\036\\Ve\361u\022\003\211\304I,rpI#`\027\276\244\305)+\220\310\016:\305aQ\311\bD\032E\020\215\345\371\315\271n\035\346\352\037\317#\026X9*\016\312\234\324\016\210'\343\3658X\\\304?\202\272\347\267\254\024\226D\256\265\027*lDku\275\257\306\216oz\372x"
+	.string	"\357C\031<\201\351\335\005\3709\222\322=\265= \255D\366=\035\177h\034S\254\277\026\266\"\250\201\020O\206\374\033\375\211\214E\371\177\317\263\027\277\3570\247\241\350\371(\236\364\355\tt\234\211\324j`N\333\213\2118\306>\250\237\303\340\307yh\303h{\205\346\021\373\311\242\347t\270\223(\271\331fx\022\305$\217Gl\274\212\024n\302\361\023\376\004\372%m64\030\202l\fpO\214c\223\303\036\177\\Oo\235\301g\301\205j\224\262\343\321!\374In\274\026\264\277o\263\006=\313\263\020X\327\277/>i7t\274m\373\253&ko\213\201L\220\336\031HM \334\260+6\3372'^\317#\177P\365\363"
+	.ascii	"d\037\213\276P\314km:\246\377M{SR\363\263\234\361\035I\327}{"
+	.ascii	"\204X\357!\270\224\370\224\256\006\212\034\247\317\240`=a\377"
+	.ascii	"\214\354\307\25767\260x\372\324\245\245\307\242\2437~\271\367"
+	.ascii	"?\232~6\334\336:B\334\331\326sy\361\307\f\345\207\353\255!\276"
+	.ascii	"\232\306\022V\274\b\373\250\234~\334\332\325f\364-lu\365\224"
+	.ascii	"\375\334\231\252\305\271+\337E!\361DJ\271+"
+	.text
+	.section	.gnu.lto_.symtab.28a120bc4390b5bc,"e",@progbits
+	.string	"schedulerTraceStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"schedulerTraceStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"schedulerTraceGetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"schedulerTraceEventCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"schedulerTraceGetEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"schedulerTraceRecord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"schedulerTraceLateCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"schedulerTraceMarker"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"schedulerTraceWriteHeader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"schedulerTraceWriteEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"clockMicrosToCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.28a120bc4390b5bc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
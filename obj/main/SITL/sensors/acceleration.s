@@ -0,0 +1,595 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.text
+	.section	.gnu.lto_.icf.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 \257\225\003"
+	.string	"$\005\243"
+	.string	"\005"
+	.string	"\336\224\277C2\002"
+	.string	"\002\001\002\003\002\001\002\003\002\004\005\002\001\002\006\002\007\b\002\001\002\t\n\002\n\013\002\007\005\001\001\240\342\234\212\n\005\303\241\367\352\001\002\002\005\002\005\006\217\201\246\310\n\002\002\f\002\001\007\351\266\234\357\017\n\005\002\013\002\007"
+	.string	"\r"
+	.ascii	" \210Ye\277\022\007\216\355Z\177\241v\247\0363Sw\026@3+b@H\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 r\035\002"
+	.string	"T\002f"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\002"
+	.string	"\001"
+	.string	""
+	.string	"\001\001\200\004\005\001\003\006\001\001\201"
+	.string	""
+	.string	"\007\001\001\200\004"
+	.string	""
+	.string	"\002"
+	.string	"\f"
+	.ascii	">g$\r\223\204\001U\005\006\001af\330l\220\262\n\300k\321\001"
+	.ascii	"\020\264\001,"
+	.text
+	.section	.gnu.lto_.inline.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 \372\305\004"
+	.string	"R\207\032&\200K\322\001\036:z\201\036\032A\211\033K4\031\034\232\216"
+	.string	"\253\377=0\206\233\240\035M_\243\341\345f\333\226$\005\337,Vq\002\221`\f\374\253nqQ:\205\003OP@?\335Y\030\216\2064D\361\3216\242\230i+\030\300\330\2007\353\243\273Y7\213\317\244\207sb\333B\177\270\b\347\252$\370\207\240\246\355\227\177\336\004\021"
+	.string	"+\023"
+	.string	".`\263\302Q\261\005\206\341\362\331\300Q\201\243\001\r\316p4\315\035E\234r\226\246\325\026\022\344\234%\247\302\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"u\004"
+	.string	"r\307\026\037\240'\351\377\377\017\332f"
+	.string	""
+	.string	"\242\250f\275\3336\377/@\024`bt\374\033k\t\221D&\031\333\352U\t(\324\271\312\204\023\270\3003!\326y\324\r\211,\267#\377x\307=\fAL\331\022\214b\312\350\324K\372%\3611\330F\260\005\323\230r\272b\233\335\346\255\t\311_\367 \023"
+	.string	"D\213&b\314\307\006\214&"
+	.string	"N\201\323g\027\022\344.J\301\025\257\n\026 \017fs\320\3603"
+	.ascii	"\003\253\002\371B\251\374x\016\017.+\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\005\232\004\006\230\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 \216\225\002"
+	.string	"2D\f\025\320\2455"
+	.string	""
+	.string	"\300R"
+	.string	"\300\342D\022B\344\260\"\367\336;\245\024U\236\323,i\260\225}\303l\244`Q\347\023\234\201\rp\232\363\370\312CID\b\f"
+	.ascii	";\005\\\335.\b\307P\242\331\274\255b\023\323\202\335\220\250"
+	.ascii	"B\361\346xK\270\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.c4990e65aa87e983,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_accUpdate.26.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375`%\001\255\r"
+	.string	"\266\331]D"
+	.string	"s\233\016\334\200\032@\212l\004h)[\307q\f\323\270m\220\223^&\302\"\224\364a\0076a\377_\330$\274\025@\267\222@-\211\364\"\n\252\321\227Zy\036\005\r\t\330f\336\272\3753\271m[\312\224\002J"
+	.string	"F"
+	.string	"L"
+	.string	"\017\256[\013.\242\271\025o@s\313\240\355#\301\211\200\230\223\213\314\356b\232\002\004\301\b>j\202~\200\324\350\361B\271\306\006)8P8\251R\024\331q\242\307W\317\020)S&"
+	.string	"\222\335u\242R#n\353\266)\330.\261\177\022\212\302\376YdH\200\260\252\330o\371\257\253~\215\351\324\3647\372\342\364\202 \307\256\210\031 \253\303\272\301\302\3669\2663<\013\370\026\017\017\331U\t\"\341\272\345\360z\332\207\361\025\360\252\017\336\354\232pac7t\340:\332\335Uw\320\244ZX\305\230\362\207;\371\030\257\201\241\243b\227t\024L\247\200\206\246B(a\322\221\355\35534\034\260A\177\351\006\360\330\335\b.\227\301\301_q\313\237(\217\022in]\277z\001\230\026)+*R\316\330a)\003\037h\363L2d\241\255\344\0027\341\363\351\274\220\257\202\006\332LB\234\346y\242\254\343l\204\353\266\220\307\323>Z\226y\260\317\353>N\3730n\363\200\260\314\373\260\021\006\3566h\036\026\352:\017\343\204\244\323IHZ:E\002y\251\355\311\362(\307\030"
+	.ascii	"2\003\303\241\327X\270j\t\317\024&\324\2550\257c!R\232\030 8"
+	.ascii	"`\b[\341z\271\304\306\252\305\263\342\\c\213a^\020~SS\340^05"
+	.ascii	"E\334\345\226\366h`j\017"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.27.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375`#\003\325\027"
+	.string	"F-\232F\240\032U:\304\037\216\025q"
+	.string	"j\307H\246\377\332\264^qQy\270\234\363\241l\370\346\222+\262\231\\q\341\367\236\205>\333\266\335\313\277y-\340ux\342\250\314\013\234\274\276\261\3167.\332\363R\304\222F\310\2262\245\206"
+	.string	"{"
+	.string	"\207"
+	.ascii	">\317{d\367\361\320Os\352\f\t\231st\340\b\342A\217G\205\007\305"
+	.ascii	"\013\b\017J\240 \363\354#o\305sxl\202\212\346\034U+\303{9\336"
+	.ascii	"r\266\263\217BP\256\2503?G\373\310\305\303\377\\A\026*Q\252\b"
+	.ascii	"\345\\\034\224\001\346\234\246\034\n\ta\316y\240k\212\234Me\214"
+	.ascii	"\215\233\257xsQ\022\3201\2711\345n\222\001\224\234+\3779\202"
+	.ascii	"\033,^\250\2162\3149\255\270\\\213\233t\3330lw\260wB\270\203"
+	.ascii	"~,<\370\375\317\225GE\221\256\307\247\246?{\244\351\356\354\037"
+	.ascii	"I\027\237-^\035\033u\237\377du\351Aw\314{7I\252EU\217@u\b\252"
+	.ascii	"A\251\226V\257T\353\252?\300\204E\207\223\323\263U\306\271\342"
+	.ascii	"\367e>\001\211\324x\320\337;\217\0035c\002\234\"\236\235\217"
+	.ascii	">\220K\276\216\357\220\275g\"\221\306B\024\352\371\300"
+	.string	"2\347L\035\364\006\361\340\001\251\266\314.\331Vu:\233O\001\221}\027\214\204XP\004@\226);E\342\372CD\330\267\200G\303\367\020\030\234\226\332\352\212J\302=\355h\177\303!\357%!\270\341\376v\303\246?\223\026\\\031d\023\346+\267@\223\033\226\232\376d>d\337\217\360\346\234\026l\327\203\204\300\300;\bD\367@\2279tH\351B\244\246\277\3359'mw\347\377s\316)\256N\352\337\017='5\352\305\366\314\205L$\3169+\370>\376\343\345\3238\350\0211}1\327\211\225l\201X\301Z&4\310\224\230)\301b\255\004\230\365\200\346\345\"\261\202\265dZ,\326J\025\203\275b4\255\230\212\306\265\232Q\261`1\325\203\004~\211h\301T$^/\230j\234\227\341r\210\022\244\207\017\374ga\311\245u\206\332\332F<\356\241\347\263\361i\3521&=\255\335\002\241\307\355\312\245\335\341\356\222\230\310"
+	.ascii	"\222\377\\\225\243\262\303\345\340\356\\\232\261\250\005g\210"
+	.ascii	"\251\2236\205\203\223Vc\364\254\324\250\227K\351\006'-j\217\003"
+	.ascii	"\247\307-= `\002\031\262\242\0366&\320W.\3020\025\205\373O\314"
+	.ascii	"t\210\362\255\260\234\371\255m\265K\254M\335\033\370\261\310"
+	.ascii	"\244\002\b\256\203\302\013qx\357\346\256\0246\003\332c\330\262"
+	.ascii	"]\254\372\364\036\203,\306\221\310.\003\343v(\032\003FG\\\315"
+	.ascii	"\272K\334%\334{\301{\230\337\361v\372^\255\333\272\n\330\245"
+	.ascii	"\376\316\354@f\0219\263\215=\214`\037X\030\250\261ZGltd\237\240"
+	.ascii	"\253\206\371-f\360\rm\306 ?9\266\330^\233\3204\006\001\005"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.38.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375`@\r\365<"
+	.ascii	"\232e8\026A@dR\007\377_7[\377_\350\362\246:)y\"\020\336\rR\352"
+	.ascii	"bZ\030d\265\030\321i\n\2163\267\021\273\203\376\216\b;D~\355"
+	.ascii	"p\327\223\307W\270>\203\360\001\304z\2625K\366\336[\246\224\002"
+	.ascii	"J\0019\001U\001}k\316\273\300\005Q`\316\371C\360K\267\213q\275"
+	.ascii	"nb\317\360\274fwDir\3119\023g\254\355_\302\332\243M\354n\017"
+	.ascii	"\023\346x5>C&\0132\345l\343;\007\363:^\215\026\346\254\204\316"
+	.ascii	"B\320Y\247\225\330\377\016\r\363.7\230\240\231M\255\377\273\275"
+	.ascii	"\316\355^\357r\303\22193Qd&g(\225\263\335 \350lC]\331:\033\364"
+	.ascii	"\244\326\331n\337\322\335a\335|\034\372\314j\375v\363a:+\002"
+	.ascii	"\246\341\025\3129/\235\305M\332ac_\241\336\311\365ue2\t\tydt"
+	.ascii	"4\026\211Ca\320m\331\025\277\322\333>\346\312'+\003'\237|c\223"
+	.ascii	"\363\244?70'E\t\233\234#\3059r\216Z\034\334\037=\335hU\020xf"
+	.ascii	"\220OQ{\256\312\036P\230\036=\362\307'\243k\245\204\255\351E"
+	.ascii	"\237\243f\304\243E\236\270\0361\340s\373\241k\365\3066\304\205"
+	.ascii	"C<\310\347Os\324\210\254NQ\177\232\242"
+	.string	"\326\366\356z\224s>\256\245\255\ft\254\225};\224\022\304\331g\256\001\361uU\320l\363\343\270v\266*\345,\321C\\3{\354R\377?8\314\265 \376H\256\344Z\345\234\333\311\240x/y\267C\273\033\253\273\330\024RT=XM\324<+.agh\312b'\306\303a\202\337q*\006\r\0336\264\3162\tb\376!\373\252\r\267\303\301\377\2509\347\b\335\035\274\316\007G\003\302\351`\371\236\263s0\366?<S'\213\376\341X\261\263W\027\321:\366\267;<f\177\250\333\3378\034\021\355rM\302\204\211\326Y\307.\365$:\201\315\2726\234s\036\303\330\331+\332\356\023\316fE\361\231s\206\320\256\306\327\240h\227s\266\263\264\336\231\316\266k\265\316z\324\223l\3524\271\004\"\373\352cgc%\317\230I\367\001\367[\312\375\216r\277\r\270\2377\024\361\373\211\370\355\344~7\271\337\005\332o\002\356\367"
+	.ascii	"\367[\200\373\035\240\375\006\340~3\271\337K\356\267R\373\255"
+	.ascii	"t\277\223\306\357\244\3427\222C\335\221\305\357#\342\267\321"
+	.ascii	"\360\3738\3746\026\335o\242\360{\350~\013}\352\035\f~\273\255"
+	.ascii	"\373\315\266\337k\373\215}\317\373\331o\267BV\265\311\271G5Q"
+	.ascii	"F\302N\347|\317}\352\356\347\036\306\327no\357\373\363\213\336"
+	.ascii	"\315\235\341\233\006\307\324\202zw9\002\311x^\273t/\254\235\314"
+	.ascii	"\240yM\255L\007\217\324\361\356\330\022\307\314\310W\264G8E\204"
+	.ascii	"\357~\327^\037\357\314#lD\243\213S\206\307\216\017\336\b{\336"
+	.ascii	"\017q\273\222j\023\362\2729\035\261\321\273\215I[\344Uo\321\032"
+	.ascii	"\361\021\367\247\265\225}\025M]\226\247\321\301{\336\377x\215"
+	.ascii	"\024\251\357\221\367\361&y\360|6\254\345\257\345}\217wI0g2g\362"
+	.ascii	"\270\212\242\356p\276M\336\231]\fs$\016\366\251/\3214E\354\024"
+	.ascii	"\372\353\2445\342\024wx\340>\307\353$\331 \036\007\3261\315("
+	.ascii	"5\026%bg\023\343\204E\314\306\005\247<\030\304\377\366\303 ."
+	.ascii	"b\257\322&%v\375YK\227\336\354*\371e\202\230\177\022\274\020"
+	.ascii	"\017q"
+	.string	"\367;\367Jyg\022\261\323\031\036\353\376\374\"\312\231\325\227\212\243y\276V|\321\213\305\243\212\206\330\231A\310\276\332\345\210Z\032\365<t\345n\250\206\204\330\371<\301\030\036\335T\330\320\234s\320\337-\255\213S\320\371\240wK0\220\013z\353\336.\025*\264\316\272\330\243\216\300\013\030:;\027;[\b\310\266\030\003\376\224?\326A\345\217}\320\035 \3665\347\234\333\005\376\270\305\302;p\320\232e_m\026\377i\251\222j\301\375\\\035\237\201\276b\026\343>\264@>\034\250\236{>\004`\\4\262V0\254\255\027\\!btm}}\311\3202\202\275\340\372\n\301B+\006\227\007\025]\025\\\270\360\372B\266VU\227\027W\214\254\257-\027[ZZYK\260//\260\256-\260e\027W\326\213\245\326\027\330\262\n\252\275`l}-cxy}-\211\356\331\212\f\227)\223\016`\f\2104\345PPI(|"
+	.string	"{\221!U\264\246\024N\363\347\027\205\r`)\354\272Ak\226\241i\251\223y\362]9\030\3524\n;\031\270\251\2267\323R\bb}^zU`\317"
+	.string	"\366?\247\362\322\206.\351\t\223\351>\002\317\037\263\300\235\360\023\246Bk\226\371y1\335\227\347\244eG\226f\235]\023\016\203\007\246"
+	.string	"\036\200\233\b\340\002_\274\020x.\337\305\256\356\275\373Zg\007\340\245\032\001X\013]\226"
+	.string	"\230\t\013"
+	.ascii	"\200\003\\\261\002\200\352\251L\221\302\204\227n\323%<\007\345"
+	.ascii	"\252\370O\224p\022/aG\213\242\304J\370\335\240\005:\021\003T"
+	.ascii	"\365\314\331LL\320\307\211\021B@\315\331\354\341F\210\031j\227"
+	.ascii	"\023C\324:\253\304UpS\275\356\005\337\244\245FT\275\266\360o"
+	.ascii	"WEg\022\273\236#\017\005j\326M\305\024\375\222\255W\222\204\211"
+	.ascii	"~\374\350\354\310\276\212$V\345Cb\347\027q$\n\277\372[\326v\277"
+	.ascii	"go\332;\023\t\267f\342\230\035I\b\201\002\250q4\005\221S\204"
+	.ascii	"f&\210$I\222\341A\005\304 e\245[\017\022\240T9\311RN!\307\204"
+	.ascii	"\244\304X\277\306S\020\320\372\351\214f*\302\367\024\t\377"
+	.string	"\214\023$P\221l&\377\207\002\037>\366\211\237\220\337L\033h\340\226>\004\200(\233\303\357\r\017\027t\271\3402\232\257\253\270\365\001\350)\343g\326G\373\250\314\334\216\362\217\354\306)\243j\361\022\311{\022\315\216\343\323\207f\"P\206\031f%r\361-1#JP\005^\"y\217\340\370\035\030c\342!\212B\356\263|\257g\236|\340S\203\261\345/\315\311\007\304Gs\364|\320\b\326\255 \205vc\266h\025\205\355\026W=\202Cf/\2217\331\223\220Bk\333\202\266L\341`\232HKy\206h@g6G\223\273G\223Z\254\234\022sX\264Z0/t\016\306\035n\b8\203\300\003 \237\265\275\325\001\263h\005\371):A\321z\300\b\377\005\265\205\035\206\315a\254\303\244\312\271\234\353\267BB\223~7Vk\367\225\336\240KY\311\244NJ\237\007\"$\026\304\241\250\374\220F\312\316/\216\313r\240\0059"
+	.string	"`~f\307\254\021\270\304\327\341r\253(\004\034\266\212\235\216\"\344\334=\273\034<\023&\277\f]dL\260\003,iO\302\363\006\326\037h\025A\323\241\211Z1\375\314\237\031\207\221t4\263\034!\243X"
+	.string	"\n\004x\277\005\254A\002\002a\034\335\f\312\024\321\245a\313\201\260\226\333jz\036\373;\275\"\373G\221:\r\334\022\340}\3778\352e\341$S21\254m\007?\262V\370\271\002\003IF\256\377\255\366\220\254+\345\245\361\323\t\007-Q?\004"
+	.string	"$\252\363\366B\035\302a\350\267;\304x\005\322\357`A\245m\023\005\215\202\254\314"
+	.ascii	"\f\312g\025\2324\003\026\302\211I\237\22484\\e\270!h\003\372"
+	.ascii	"\237\363%\212os\236?\236\005\314\331VVHN\322\364\231\314vP\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.39.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375`%\002\375\021"
+	.string	"\026#vE\360\320&\035:M\256\344\341\344\312\265p/%\314\034<\n\254\326\260T\326\326>\355|\205\311\326\242\365\263\"c\030EUT\327\320~[\363 Y\234x\365[\204\241#\272\244r\234\227\230\226\227e6\262\367\2262\245b"
+	.string	"d"
+	.string	"Z"
+	.string	"\242Cw7\020\017E\357\210\207\366M\230\244D\005#)Y\231\365\356\303\35337\025t\206v;\356P=X\377\272[\223u\3704#\313O\013\261\326\341f\202s\020\0334f\204vb\031\376\336\200\335\r\020s\275\005\273{\237'L\254%\025\200\b\f\317\216\307\315dw-\322po\267\315b\373\201\235\020\002\273\257\032\216\335"
+	.ascii	"[\2048\355\357y\332\367{|xx<\\\335G\314\320M\211\323\236\343"
+	.ascii	"\263\360h\246\262\207\253\333\030\f\307\237\371*\256\263\372"
+	.ascii	"\n\273\020\265`\242\235\034Z\215\335\r9\264\003\321\241\307K"
+	.ascii	"\037Ge\217\354\225=:\314w\252\003\335^\200Y\323\376\211\243X"
+	.ascii	"=\205\177N`\227\346'h\267\02394\203\372\267\273\253*\263\255"
+	.ascii	"\340\327\250\267\211\251\275\310\030\b\304\017Z1\220\017\302"
+	.ascii	"\367O<D\020cH\237B\375\213\315\273_\304T\325\277\214p\311\232"
+	.ascii	"\257\251\367y\202\326\f\027\241Y\216\226\254Y\257\273\333J\225"
+	.ascii	"Y\343\277Jc;\275EM\303w\377{i}\351|\317\375\021\b\f\0012\001"
+	.ascii	"\251\023\n\244g\212@B\231&4@aIa)\225H\035.\215\250\234NVH(\023"
+	.ascii	"\212\251T\"q)\324)\245bJq*'\244\024\256\204Jq#\037>I0\241\270"
+	.ascii	"\225\323\t\305\215\376U\232\002\317g\305mS\233\264\250\013T\231"
+	.ascii	"\377\327\214\304K\206\266\312\301\372?\225\031\326\304\220\217"
+	.ascii	"j2\352\025\306\266E~\315\01692\\y\303\001+ `\202Aw\266\r7\"P"
+	.ascii	"Ab$*\360i\230 \327\270\020!\247\250\272\216\355\030\215K\\\331"
+	.ascii	"\213\036\255\276\021\216\030\230\n>i\300\003k\020\336\027\262"
+	.ascii	"\347\351<F;\232%v\225\257 \251\020\200\001D\341\334\245\251\027"
+	.ascii	"\3575\311U\206.6@=\254\t\333-4\032\027\260C\342\211j\005\351"
+	.ascii	"\357\275\026\343\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"%\007"
+	.string	"\362\212*2`K\324\001\240\013\240\001\327\370\032\267\023uf\242\246\031\222U\202\261\271#\017\3030T\024E\241[\013\230\221\255\231Y2 \326\bK\376?!_n\231\002o\244\336\0139p\231l\003#Q\251\332\3146Su\243\273)_\347\323\255\303\303\253|\237N\017\242qQ\321|\237\317\371B\024"
+	.string	"_\250\013\370\nL\325$B\"\236/\003_\013lm\\iL)\360\224\300\222v\367\037\215d\034\251\027r \306\005Qv\006\207\310\304\303\305\004\321\342,V\b\324\301d\260L\007h`\371/\265\224\023\343\347\377\003B\265\273[b,\376W\213\027"
+	.string	"C;\206y\023\036\030\215s\265\t:|P\017"
+	.string	"\016"
+	.string	"\016"
+	.string	"\016"
+	.ascii	"\016\237@\254Z\372S0\\\376\235\331\2022U\003\251B\301\267R\002"
+	.ascii	"\002\253\034\236\331\203fUO"
+	.text
+	.section	.gnu.lto_.refs.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375 \213\305\002"
+	.string	"B\b\024\032pK\222\341\374\377\377\377\177\"QF\f\"Lx\250\b\033\022\3376\273\033\221)#\323\200\25117\027\263T\326\243\224\230F4\304\3740u\230\033*C/T\205N\250\b}0'\006\225\005MP\007\246DZ`\006\250G+\214N\227r5\371D\001"
+	.ascii	"u\346\240"
+	.text
+	.section	.gnu.lto_.decls.c4990e65aa87e983,"e",@progbits
+	.string	"(\265/\375`\350&}\255"
+	.ascii	"z\024]=Y0JAJ\035}\025\277:\254\262\013\037\t\347f\257ME\020\231"
+	.ascii	"\231\346\276T\353\262\222\324\327\355Z\026\221\313o\316\003\247"
+	.ascii	"aI\230:;\021]\363(\354\245\2631e\373\355v\373\276\007,\203}\036"
+	.ascii	"\303\203\271\337\376\360\036\272[\352a\363\255\340\314 \220\234"
+	.ascii	"Y\305\220\354!eJ)V\003\275\003\333\003Y\335o\365L\257\222\201"
+	.ascii	"\030$0\236\034\375}\033?\3757^h%1\375\365@\005\267\215\202\377"
+	.ascii	"\303\032\356\340:\351\324SI\341\035U\246\230\204MIQ1\313X\242"
+	.ascii	"\372\245\032.\325rl\253\003\3624H\270sR\333bb'\022~\211\017\030"
+	.ascii	"JF\350'\241[\004\006.V\2237\324\324\271E\031\341o\317}Sw\313"
+	.ascii	"\330X\tK[kz&\033\245)\231\371\367\231~I\206\016K\030!P\270-\023"
+	.ascii	"\016ac\340W\352~\243?\372$\35711\031C\341\357\303x\021\334\311"
+	.ascii	"\3631<N\253h\351o\333\"\374\201\234\235'\365\274<\347I\373\357"
+	.ascii	"p\b\317\220\246\256\223~r\347\246\211\352\b\322\025\334\026D"
+	.ascii	"\335\316\216)\361Y\326\0264\347?~\221;\037\351w}\233\271\275"
+	.ascii	"\255\373\347\221\036\346\263\035S\346dVSO\022o"
+	.string	"m-\232s\023\304\016\210\013gQ;\247\364z\336M\214\035G:\250\360\236\t\267\207\301`\274\356\231\312rt\001\243\005\267\247\240\223\272\234S\241\253\203a\206\275\213\307\271\323\275x[_\"\313L\226s\363\202E:AI\373\220\336\370\207\264]\f\337.\334\2025k\252!\375}\263+\370\220JA\007v\272\026\317\342\315\274\223~q)R\376m\267\302\355S\270\235>\003;\025g\241\275\212O\311^\345\202e\225\233\273\234\2217\356\022\270Kp\277\256\266\316\322\333.\002n\017\340n\177\342R2\220s3G\005e\325_ws(\356\344\340Q\354\221H\006\273\200\027\004\317\356o\033q;\207\324\363\234C*\342\247\375I\352\305\304\n\314\337\036\342_z\206\224\002\235\264\203\0060v\244%\216\346N\017\256\326n\346I:\006\331\314\315\234\2337\257#\f\222\"\177\373\207\207\310\214A\217\300\355\036R\233\227\347\036\322>"
+	.string	"\306\361\fH\2148Y\247\3752\347d\316Y\303K\351R#\372\327\315~\332\221\350\244\312\247f\276\261\3166\243\273\277?\001\256q\235\324\363\3233\244\215\261+}\314\301\\\314\"%-\263Y\316\315\234\236\220\266+\263\277.\366\036\346\315v1\037\322\"0\350\232d\006\313\271\351b7g\244\273\0046\356\022\304\260\355@\026Io?\356\246gH\261\353\2441\335V\312{\350\366\256\356\377\320\355_\314\033\003t\377L\001\272?\245\240\373\355\023\240\333\361\272\177\002\t\272\035\003\335-\327\355t\337\241\333\241\272\375\252\333\243\272\235\252\273\325\200\335^\323Q~"
+	.ascii	"\335\276\001\367\352\270\356\027@w\033`\247\2737t?\007*\035t"
+	.ascii	"\333#\335\276\3455t{\225\325G\320\335\027\350\233n\013\245\333"
+	.ascii	"\247|\206n\307\320\375\030\272\335\002K^'C\347t\333\261\356\207"
+	.ascii	"\240\373q\272\237\246\373{\335\177\273=\257\333\277t;\\\267?"
+	.ascii	"\273\235K\267g\351\366+\335^\245\333\251t\273\206\356f\353v\232"
+	.ascii	"n/v7\004\272;\254\333\227t\373Z\267\253u;\b\335N\201n\027v\273"
+	.ascii	"\332\355i\335\036\354v\264\356F\322\355g\335\016\326\335\023"
+	.ascii	"\350v!\335\036\244\333mt;V\267\033\273\373\203n_\273\235\250"
+	.ascii	"\333\207\272}\330\335\315\356\356\351\356'\335\035\223\227\227"
+	.ascii	"\227\327\375S\335\275/\335\034\034\020\270g\224p\267\275\341"
+	.ascii	"^b\212\250\360\205\2646\252\240\232\340\370ke\221V\252I\030\324"
+	.ascii	"Z}\335\347m(B\342 *f\365`\232\255\207\031\264\312.-\323^Y,[\303"
+	.ascii	"\235\326\312RY\253\217\372\231?\315\356\017$\320\377rf\255\354"
+	.ascii	"\224\243\320;\242\266\025\365qKxO\233\3332i\270e\212`+\325m\263"
+	.ascii	"=\332([\302\022\025)\177\241l\232J)t\177[\306\007\206\261\305"
+	.ascii	"\b\216\313\222`\231\254\322\216`i\330\031\266\311>Y\031v\311"
+	.ascii	"\235\326\311&\335*%.`/\302\340~\220\266pU\025E\201\203\306\370"
+	.ascii	"\261\005\232t\2566\270\243Nk\"\304i\235\254\b\235VBo\213Z\016"
+	.ascii	"\350\316\315\022 Y\311\bn\313,\341\226A\342\306y\270\361\035"
+	.ascii	"n\f\0067\246\303\215\275\340\306P\334x\013n\254\0057\276\202"
+	.ascii	"\033C\301\275f4\017O\006\205\2630-\177\303\3240\t\313aG\360\335"
+	.ascii	"\333\361\364\230\236)\034\375m\314\0037\256\302\215\213p\367"
+	.ascii	"\336p\367\242\320y\300\311\265$`sr,\236\236\302\376\366\313}"
+	.ascii	"\222/s6\263i*\363\212\372\373q?\375^\026\240\003\353\353\257"
+	.ascii	"\375.<= jU7\240\034n\232NJX\\\336\226\260\310\201\001{s%\216"
+	.ascii	"\202ML\316K.\\\377\346lo"
+	.string	"\345\330[\362\264\243#\362\346E\\\314\346\330\3143\322-\245\035]\013\257\345\341~\213;\377\355\257\364c\371,^\366o~\304\317l\222\315|L\271d;:\020R\240k1f\356L^\272N\332\275.\\%\206\252+\212\227\277\335+\001\267'q{\244W\312K\027\254]\201[>\324\327\270\372\260\226\304U\360'\362x\001\333\223\316\277\374\013;\246U\365\313N{1\226\20057\307\342[\230\035\330\270\352\246\242W\334\034\352sH\246\020l\312\266_\341S\370'\037\345\251<\224\177>\013\337\344\235\374\224\227\362*\270\363\335~\251}\315\231Xq1\177>\345c\027\n\330\232uSn\177\365KH\030)\037`\003\n\3723\334^\371O$\214\22422\312\250\240\026\270\275\fG\301\237Z\031y$\261\366\254\233\212b\360n\276\202W\261M\256\236\221\262\035\236\202\333\243=[\023\005l\320\272\251(\210\013Q!\331\206"
+	.ascii	".\223\035\367\361B\314G\034F\301\235\277\366i}\177\355\235\257"
+	.ascii	"\346O\263\234\227\022\020dI\027%\n\302\245\236\024I\271\267\211"
+	.ascii	";\361\263_j\220qfa\352b\303\235\216\341N{"
+	.string	"\340W\302s\203\225\205\254\362\267S&\306\372,\333\344\322\240H\006\324\354\223<\022w\376Y\377\374\331k}\030\t#e\004\212\224\240g\177\244\3356\024!e\244U\b\036Q.aQ\036\020 \256\021-'U\370v\314\025\334\177\364\203\307\237Z\f\350\221\244MH\020\350\207\275\216\357\332P\204\344A\023%P\257f\263\221\311\231i\306\005\366\365\005%\013\362\301\237f'\234`a\017\326l6I\234\2344\301\013\3728>\354\201\360\330 \233Y\231\342\320zk\022\3159\223\275\221\027\373\"?\366D\276\354\233\356\374\260\037\322;M\020;1F\312\242v\020\334\216a\342\216\221\302\035\323\204;&\006\356\030$\356k\207\373z\301}\263\370\330\371#\227)3\376\366m\202y|\017w\376\t\277\243\037\307\347\350\235f\316J,(\341\267l\21699cm\341\312\271\371s\302s\375\226?\237\232\231\t\202-X\246\334\355\200"
+	.ascii	"a\321\336\344\312\322\333\227\306\226\t4xC\250\360L\370\0356"
+	.ascii	"a[IXy\270m\024\267\355\202={\206\024G\013\356\017vM9D\350\033"
+	.ascii	"\003\356\032]\243{\204\241\313iGw\301T\005\031\241\347\372\036"
+	.ascii	"\311\3608\341*\211\355\036\357\361&\333&s\215%\\inG\246\334\242"
+	.ascii	"\276I?\241\005*.\177/\362\016\006\024\247K\211\271\242k!-\f\f"
+	.ascii	"\030\233\347H\306\342\342"
+	.string	"dn\300\355`\202\3276\217\246\313\213Z\363\257\r\323h5P\332\360j\334\365\242O\244~\334\331myzu1iK\233\313R\367i\227\354\353\354\312\337\266I\342\356\322]\354\227\rbc9\240\037j\256@\267\\\241k\373%\255\006\t97\344\257\215\263s7WH\2628\315Y95,-$T\315\235T\334\025\353\305&\371`~=\323\274\013-\310Y\334\233\345\362f\341Zh\301\302a"
+	.ascii	"2&\006\026\355\035\2050\231\263[\332\302]xS\302\261\325h<\332"
+	.ascii	"`\374h\202\373\002\220,Yl\333\016\221|\274Ar\243\303J\331vu\305"
+	.ascii	"i\257\274\\\307$3\226\027W\316O\b\270\300\343\253\254\350o_\240"
+	.ascii	"\252\342N[\305\2458\221<c\346hI\213S4\347&\b\270a\270X\301\001"
+	.ascii	"\006;\261+8\261T\322\234\275\271\234\241\314O\312\017\335vJ["
+	.ascii	"*7GtJ\264\024l\223\266*\264\n\366\211\2179\037qrQ\013Z\240\371"
+	.ascii	"\351\351\003MT\021\323\353\257}\366^\334\260\033\341\257\215"
+	.ascii	"b\231\340\037su\316\226qd\231\f\350_\353\346\301\021'^\220$\275"
+	.ascii	"M\251\373k\237X1\333\325\344f\304\005wM\024\334\375\335iF*s\316"
+	.ascii	"L1\315\254,\252i\217q\377\320}\301\255O\320\335\267\273\025P"
+	.ascii	"\201f.R\"'\207OHCJu\207\334\375\3149\311<2\200\271\224d\322@"
+	.ascii	"\"c\346c\322\204c\21623\217Hd9\347\344d\362xb\231s\220\310\362"
+	.ascii	"R~1e\311s\223y\314\311e\316\311\311\214\354\200\224d.!\221!\227"
+	.ascii	"r\220\310\230K\231\214\231qr\022\251\204\221\314\312\234L\306"
+	.ascii	"\354\222\311\226K8Hd\313%$2\246\227\207\201ae\252\351\210\\\326"
+	.ascii	"\f_BJf\031JSH%\316\023\251\271\314Xrv3\243\254\234 \347\251\245"
+	.ascii	"\022\013\222\206;\213\2362\212\224 \227\336T*\272Z\346\344\023"
+	.ascii	"\311\3072g\037EAY\351\202c\363\231q\370\363\2105\225\223\214"
+	.ascii	"r\006\200R\316G\317\317\234\3631\347\334SN5s\216\302A\342RR\312"
+	.ascii	"\371iG)O\035\325\214r~3-\316%$\262\253\345\217\232\0212\256|"
+	.ascii	"\324<:W\306\302Tb\262\343XN\362\202\271\226\232\342\376\262\305"
+	.ascii	"\230\335A\225p\265\226k\220Nh+D}\260j2\311f\223\f\303\023\020"
+	.ascii	"\031\177\273f\311\351aJPHJ\332\235V\211E\343 \306\222\030X4+"
+	.ascii	"\237\020\340\310\255:)\177\355\222\313V\006\335\302\202\233\206"
+	.ascii	"\205$gs,"
+	.string	" Q\341/\222'V\316\262\023\037\261F\334i\315\254\230\226-\263M'N\273R2\263Y6\354*\211k&.GTz\311.d-\273\252\3766\215W\216O\262A\342\344d\021R\021;\346NK\3046\311\210\334\031P;:\257\035\020\026\f\031\024hz\233\006\0137\215\322\206\221\3214=\263@\ry\247w\276M!\002&\204\304\215./\232f\270\310i\212\332\227\r\342I\222\224\r\t\3425\003\245\244\221\025\346\314h\371\365\267\313\376p\247\005\362vY/\367\365\304\002\261Z\326\207?\2658\300s\353\232\023\233K\357\t_#Bt\310\337\236\241\303<\354\226\345\262&\270\323\366\260%|3g\263?\332\221\226$\307\022.\034\237\204\326\303\352\370$\034c?\240Q\030\314\032]fn\317\024\301=\223\205{\206\211{f\n\367\314\023\356\231\245E\241 \221\002\277\bJ\f;0@\007\365\370\254\b\252\030\016\0017"
+	.string	"\251\302\024\277\241\003\212\035\250D\343\372SU\340"
+	.string	"\201%\204\210C*\210*\021\007\023\305\016\200\300\337\016\212\b:\250\007\210\370\033JA\301/X\001\f.\204DD%rxV\374\210*\213\022\303\241`\211U\335"
+	.string	"\b\374u\320\211\351\240\036\037 a\320\230\202G\005\032\372`\2051\205\n$#\023\242g%\376\210z\200\300\037N\003\203Du\250\256\300}\301\210\nF\220h\321k\022\031\204\310 D\332$2\370\371\311`\304\017\356\021?v]}E\020\360\352\023a\001p\005\002\177v]5\024%"
+	.string	"4,\241\263\372T\250@<\035\324\303\001H]1\024\003 \024\016\021o\020p\r\022\305\204\360sa\213\252Q\370c\221\206\360#\332\016\352\361y(\372T\241\340:4\242\310\320\001\016V\243\t\025D\036"
+	.string	"\201?\232\265\203zT\004@\r!-\372\200~F\016\004S\330\204H\361?)^D\212\377\371\275\210\337\377\264x\021-\376\307\305\213p\361Du\025\0065"
+	.string	"\002\1772\253\321W\004\006\205~C\027'\326\240\025A\241\212\fE\241 \221\0029&\002P\\\207\252\220J4\026\177\352\007B\243\220\021\b\374i(\261b\230\"(\374\001k:h\202b\314\332A=\005X\203\326\237\220\317pHHh\b\b"
+	.string	"!/\372|D*tZ\004\211\353\357\203u\210h\263\336\370z\035\324\263\002\215\304\265(\242\350k\241\256F\241\234\241q\b\350\363\365\210\3520\204!\237\257W$\252E\343\320\347\303@\303\340\006|\276\2648\f\022\025}\276\236P\365\371dV\037N\007\365\024U\"\027k\005@*\361\027T\254\300\247\270\006S\370\030\207+*ha\034\006\205\025\\0\3027\202D\013\037\025\310(\004\016\203>\304\242\321G\001k\013u(\374\r\211\352:\f\372\202V\"\237O\003\013\225H\344\363\245k1(\364\371R\237/U;\020,\372|\351\006\200C\302\013T\211\276\r~f:\030j\260\006\207\301\224\270J"
+	.string	"84j"
+	.string	"\004\226\3000\324"
+	.string	"\350\247\022\323\r~|\275\020~(L\234(\221\256\035\324c$\022\362\251,\202D\240\003\364\020\221J\364Y\207\206\210>4\252\017E\b\fB\2140\022\t\351\030\205CE\2258S\364aP}\0230\022\t\321\244\253\320XTQ"
+	.string	"\325U=a$\022\202@\365\375|6\303\025A!v\001\364SQ\374\326\037\220\314Z\364\261PO\310\f\021]\254\270\304\242\n_\320\212`\220\017\b\374\325\020\177A\300\253\002\r\231\030\016\005\213A\026*\261f\365\221\350\021U\2410\250\"e\241\002\331\3257\342g\035\006\215\270\177~Lt"
+	.string	"\001\002\033``\317p(\270\376\210\352\317\247H\034*\016\325\242\3170\370\023\362\001\022\213>=\022t\200\003u\375\241P\205DB\277b\215\211\023%\200\300_\252\002\207\021X\213?\325\203\265\004\220\272\376\200\210@\020\252@`\211b\220G84\324"
+	.ascii	"_L_-3\032+ktU\232M\233:*3\276d]\345\r\226\245\215\244\0337\206"
+	.ascii	"\215{\324\200\270$\033X7y\341\216I\235\334\325\263}\330\027X"
+	.ascii	"\223\231\347D\2249\230X\331/8\253G\224\032K\227\002%\251\350"
+	.ascii	"VE\241\311\265}\375\275P\027\352R\365t\360\020\003\213\336\251"
+	.ascii	"\276T\tH\322\222!\225\364\312b\222\272Qwl\f\fG\363\245\242\246"
+	.ascii	"\320V\300\335\367\t\256W\246%VE\243\rci\222\266t\262Tn\200\300"
+	.ascii	"\225\001!\341\255\b\361r\320\270#\2409m=\235\374eb\2721<\311"
+	.ascii	"q+\212\246-\t\217\354KI\351*yX\325\325E\305\352\246\f\2713\372"
+	.ascii	"*\347\312\236aWF\032e\306]\335_5\031+^\250\314\376\366M\322\205"
+	.ascii	"qa\334\030]\266\242\242n\024\203\022\250b\3514\007\022\2312\b"
+	.ascii	"\315\214\bI\222$\035B\n\020\004ci\236\351\251\035\022 $IM*\347"
+	.ascii	"\224\241\021\021\221$)H\215\016 \303L=\306'e;\024\037\177Dl\342"
+	.string	"7\035\230Jc\221\313\030\022\r\234t"
+	.ascii	"\245\273\r\317\260 \374\03303q\335~\026\303\304\302Q\305 .\201"
+	.ascii	"\330U\266/\365\342G\203\002\207\354\331\013\001&\033\202j\031"
+	.ascii	"U9']m~4\317\266\r\3366\370\3173\027l\002$q\"`\244\374\025\307"
+	.ascii	"\230\036\323/?\244\261\031P\312\315\214\360\321\214h\032\377"
+	.ascii	"x\332\030u][\350\345\220\300b&r*\344\306\225\250\037p\344Q\200"
+	.ascii	"w\305\tS\212\356\326\313^9T\021dW?\276\210/\223\022b\211\305"
+	.ascii	"*\345En\241,3!"
+	.string	"jI\240\350\231:\262\351 \006\257\307\350\366+@\262\2313\336\034}\273\016\027X\255qe\3245\304\204|p\023\037\340\317\344+7\247\336\020\236\250\be\365\255\324\261\035)\332\f&\227\327S?yG\251\347L7\314vN$\217\312\3668\243\221\260\256m\201?\0240\333\205H\336\212OHmKX\342\034!\007z*\302\r\302\232\227\325\026`\323~=\254\b\374Vt\240\304\021\326\247<\367\034\372\200TP\342\3356\366\226\245\307\021\223/^#\312\364V\265\001\226h#`\\\300\250iFt\353.@\275\2043\362\311\345\021\274XD#%8I\355J\370\207\033D\023;\333>X\3072S\231T\27478\247\250\266\271\223\001\002S0\264\177\026\342\373\320\226\"\247:\\\363\222}\263A\277\222R\206\001H\201\320:oC\226\341SK;b_\362-\337d\264DWu\307\223 r\324}\376A\374\223\217\033\203"
+	.string	"\271\300\323\350\307\373\377\"wr\021mO\300\263\237^@\343\"\210\271\025>)t\341\025.\226\r\324\371\262\344U\025 ro\3354\r\210C\241t\346E\357\345\244\037\346\306\2220\363\200\321S\340\020\273\305\301 W\230\227\261P\217\333\253dq\207D\351\205)\036\206\333Q\246\356%\336\026'=\034\241\272\024/^\343z\003\017.\361\273\333\264~\332N\332\307-ak7\232\006S\001\226.\224\265+\021\2441\234v\223\246\261\316\240\3457H\223R\300?\032\023\3665L\276\320\003\t'\002"
+	.string	"N\354\204\307\\\370\223\372\320\207\332\215k\2358>\243\324Ts:_"
+	.string	"'\222\300\027\004Z4~\022A\322\205\325(\342\3569UKZk\303\t\332\350\345\036\312Il\240\036\034\324$f\245}\365\262w\265B\036\002\026\re\271\306\2401\355\227L-E\214F\203\246b\200%\321!\260\206\2377\335\b\274!\246\363\202\235\364\240\3650\023zr\352\236\023\345]\203\274\203~a\236\2766I\034\266K'\2506\304M\2658\036\2230\036\274\322.\330\002\272I\321+\020\341\003\376\004\271\022\\<\230\271\320\020\230q\324\215\357\304\321e\254DA\341/\256\202\3749+\336\367\241&\257\225>u\323\205\261\244Gt@\200\316\330\250H\360U\013di:\n@-\301\247\271\n\205^U\234I\023w\275U\305\024{\002\305+h\310\016\270"
+	.ascii	"[2\366\203\221j\3638VKa|3\300;\234\204K\350m\233\360\272\023"
+	.ascii	"e\270\353\256\370\357,\216\005\231\351+\321\023\260\001\017\353"
+	.ascii	"\237R\243\230\346\222\363'\033,\0248>{\035a0L\264/\001\323\221"
+	.ascii	"1l\370\241\236\312\270\355\210\213R\304\224\245\177\nt\017X\321"
+	.ascii	"\300b\375\244t\007\330\226\201\216r\316\331\271/\305\303\271"
+	.ascii	"\334nY)\300\241\367\305\300F\020\316\216L\325y\321\374\177\357"
+	.ascii	"4\314\344\007S0\241\r \335\027&\250\375\177\246|\377\r8\241h"
+	.ascii	"\353\333\023v\310tC<\003\233\325{\334\345\360\272s\0032\220\221"
+	.ascii	"y\217\305\2415\222\331\257\340\227\3132\242\b.\300\250Cu\331"
+	.ascii	"\375<\344\374f\002_\003\275\276q\212\001\354\336G\031\364\027"
+	.ascii	"\221\242\241\016\244/\002\206\007\267w@\325\305M\303\216T\220"
+	.ascii	"\335\2324\001\343(U\td\240\036\001?3Q\314\262S\252\r^\330\263"
+	.ascii	"\001W\370J\233t\037Xa2\251\033'7\213\003y\230\325oh<\233:\241"
+	.ascii	"\314\033\226\253\201z\350\271\255\252\017He\340\224\300\361\362"
+	.ascii	"\244\250\271Pf\367\342`V2\030\266:d\237\270&\330\220\342\315"
+	.ascii	"\246\353\3625\325\005i&\240\n\344\fw\360\233\266\\G\261\227-"
+	.ascii	"\\\362z\262\205Xo\032\301\314\216\2256vP\355\371h\307i\225>\204"
+	.ascii	"\336\270\"7\n7\b\345\260@N]c\037\032\322\217{\311\246\023\245"
+	.ascii	"\223\327\0043\026q\350\036\253\331\351\277\"\276\203|r\334\304"
+	.ascii	"\305\020\355Y&\342\313\374\f_\226c\232\243\342\006 coh\037\344"
+	.ascii	"\321\020\335)\031\n\266\373\205\310\374\304\253\240\260U(\343"
+	.ascii	")\274\216\200H*>\352\257|\330\364X@a-l\035\356\177{\241Z\027"
+	.ascii	",\247\222\322\305\013#x\3718\217\361\307.@gl\032\t\315\220\272"
+	.ascii	"\226r\355\336\301\351Z\t\377\377 \340\237\307\275L\240\215Z\215"
+	.ascii	"\n\331\212\b\253%8\270\354\372W2[(\373\343D\234Z\212$\242\250"
+	.ascii	"\202\320\232\222\310i\324\317%\330L\2111#\030D(8\230=C\357A\213"
+	.ascii	"Cy\331O\005\374:Ni2L.\341\300a\023_u\202\203\177\212\231\007"
+	.ascii	";\207\207C4|\315\342\244J\231\242!\363\226\252\245vig\334\272"
+	.ascii	"\243$qRB\007\206\331B\020\\\313cf;`\365\226m\023\347\0245n\331"
+	.ascii	"\357\264:o*\371\271b\305\304\351\265 \223\216\237\215\327\214"
+	.ascii	"\223\326\351\254\r\006\306\341\320\325/\347\231\354\377\n{\346"
+	.ascii	"\026\322\333\365ny\244\367\334\334\316\032\371\261\237\361\353"
+	.ascii	"\363g~\373R\317\307\221\207\013\371\363\373\327\3658\360\027"
+	.ascii	"\344\276\253\034\254\006\026\363G\331+\331M\355j\345#x\036y\276"
+	.ascii	"q\375\033\345\215\r\344\035\0247Y\346?Ad\346\327\237\262\343"
+	.ascii	"\311'\371\206\031\371\016,\355b\267\022\026?\371\213\313\006"
+	.ascii	"\343\347\307W\370\"\261\322\007\305\353\265\221\025\201\264\002"
+	.text
+	.section	.gnu.lto_.symtab.c4990e65aa87e983,"e",@progbits
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"accelerationRuntime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"performAcclerationCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"performInflightAccelerationCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c4990e65aa87e983,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1286 @@
+	.file	"acceleration_init.c"
+	.section	.gnu.lto_.profile.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.text
+	.section	.gnu.lto_.icf.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`C\001\355\t"
+	.ascii	"\222M37@s\322\030\\\225\t*\376V&!"
+	.string	"\001\334/\272\260 \020<B\205\037h\355Ud!\214ax\334\256\212\242\353\272\n\f\035\237\251\273[#\3226\355F6!{'\271\003\220z\244\257T\220\241R,-\004r\356:\035$<\274\201\261\221\232\016O`\263 N\247O\264#\032\227\205P}\271\271\200\001\366]\241v\031$\017\037O\334\336\276\026\205\006}\240u\337(\245])\033/(\331T\245!\004\246\363yz\236Zvu\347\352y]^\307\306\236\323\347\234\r\242\205\f\003\212r\256w\371>\337/zQ\201\0012\255\253\217\0327]\225`\342\230\220\324#}\245(\217OM%'\021\313\270b\"B\261\360\035\016\2273\306f\346\003np\2044 \220\0029S{\327`\037\2203O\310\f\360\332\347^1\303\026l|8\265\340\373\300\205\355\025`\300\202\017\016\2360p\244\005!\033\314\004\246\027\230:Y\260\031\324\006\221\272\032\013\006\312\265\207\263"
+	.string	"\177a\266\260,\370\202\301\003\243\332&\002z\002\314\221\233\261]6\226\0318\230\367"
+	.ascii	"\263` w\323=|c\376\345\n4C2\212\342\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375 \212\205\002"
+	.string	"\002\204\013\022\2405\351\253\252\252\252nVzZZM\324\332\3362\245.Ty{ng\3738k\354\005I\254\241a\227\250\025 bq\301\026\271_# \r"
+	.ascii	"*\001\271\214\301Bd\346\031N\003\227\006[\311\265y=(b;\003U\231"
+	.ascii	"\366\022\334\006\332"
+	.text
+	.section	.gnu.lto_.inline.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\314\001E\n"
+	.string	"B\31745@o\323\030\366\320\304"
+	.string	"\305\204@\r2\367r\242\177-\3048\022\224Y\272d \205\252\2103D|E\224\001\3071<\346a"
+	.string	"?\005o\343\247FNF\376\226r\247\377W\007\tA\027D\310\314\311\252\352\214\307\323 K\"\217\017\250\021\201\302b=\247#\323\350\004=\352M\226\360\\9=y\240p\230\344\200O\245\001\244\372.-V L\n2#\205a\201`"
+	.string	"MR\233\216m\242j\336\245k\336c\361\337\202-\030\237\310@\247\022\023%\221gkNh\315[\363\364!\226\220#\273\333\311W.KvW`\314\331\005|x\351\231\fQ\337)G\207\251\302\243\220\033!\337\251\363%&\365[L\255\376\223\t\317-I\273\213\371\217j>\004\345\356\356\345\261\223\0245 \260\"\033\222\365\022\306BF\340"
+	.ascii	"w\200\n\016\036\004,\203\234\b\\\327b\0237\351\032\345 \027\310"
+	.ascii	"\027\023\002o\006\216\356\341\253\221\003&f\260-\f\013\255V\264"
+	.ascii	"\fa\277t\2757r\030\201\213\327\201\227\r\227\256\231q\210\201"
+	.ascii	"h\3305}n\241s\335n5\001M\207Q\300\262g\235\311}\306J\005\026"
+	.ascii	".\247\350^\241\016\330q\026\334\375\271U\265\347\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\245\006"
+	.string	"\"\214#(\220'I\007\377\277\337\025\200\b\250\275\375\305\374:;{\344\356\316o\277\243\202Ro\221\201*E\3306\316\352\357\266\211L2ly^1@\300e\371\026\254\025`\023dC2\214kd\004\273\"\213~)Y2#\254\344\006\027\302\350\261b\030\342&t\254\234k\235n\030oX?}\303Ov\270\207\003:Nq\021\300DJ)\375\303\376a\235\220\026*#\001\310k!\222W%/\324\013\315\236`mAO\321\233\257B\026\331\316\336y2\\!\033"
+	.ascii	"=\202-\006\273\360\335\253\034ikO\023>\301lQ\016\215\325\024"
+	.ascii	"='\031(\267\b\005A\277X\020\343\2042\236*\330\316Ro\026|\r\026"
+	.ascii	"\024\334\327\320\330)\b\226b\225&N\314lZE\310\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\232\004\001\232\004\002\204\004\004\232\004\005\270\004\007"
+	.ascii	"\230\004\n\231\004\r\230\004\016\204\004\017\232\004\021\232"
+	.ascii	"\004\031\230\004\032\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`U\001e\b"
+	.string	"\002\214!$pK3\034\344\252\252\252\370\323\377Uu\261>BE\213\245\377oS\177\205\350\2409g,f\270\203\215H\222)J\024\025\021E\205V\203\0350\032:\306\331xJ\314\250j\005NnzN[\244\210'\304\216\261\217\023\002\035hv\261\326\222~\330Ev\016\273\206\027#\307\360F\273\205\235\302\016\362\204\254\b8\037\273\204\347\263s<\243\223\200\025h"
+	.string	"\207\360\326q\034\005M\245\034om\351\234\317\373<\213\331\270\350\023\001: `\002!Uh\033k\004`\344\002S\2020\205\214B\3000\304]C\266<%*\0312\021\370\272\374\005\236\013\212\205\317\b<&(\034\005\204\016P\007"
+	.ascii	"\n \353\300\331,\333\330K\227\025\221\264\212K\rc\026\364y\204"
+	.ascii	"\233V\037\317\324\300p`K\240\200J\221\001o\217\245\232\341\266"
+	.ascii	"\033X\334\024|<\241\212\326\013\233\007\273\207~\033\033<\374"
+	.ascii	",iND:\0046\336\270\021\033\033\013\336\021\256\221\007P\004"
+	.text
+	.section	.gnu.lto_.lto.1ba92cc2977eeb6f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.38.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"u\t"
+	.string	"\206\321A< \3458\035 a_\306m\352\270"
+	.string	"\031H\3660\"} \0357\025{\215\035$ti\242\327\037\316xk\316e\271\025J\036"
+	.string	"L3\310\030Q\274\025\205!\f\t\027\301\212\215\255m\247\024-"
+	.string	"/"
+	.string	"2"
+	.string	"s\363\201\354\323\242=\3631\265g\2516T\\\273K1\221\213\227\242\177\223\013\230N\244Kmaw-M\247\216\033\273m\004\333\r\266k\002\017\330\3355\206\262\277\372\345\324<`\f"
+	.string	"\354r\274\002lk\272\220pl_\332/\271J\374j\364\316.J\246ewT\360g\363\351\361\004\331\003\343\376\243U\3024\374\224\333\024gY9H\275 \263\301\263*\374\261-\216r\341\317\tF\206\214\031\371\364G\331\247\006\362\342\242)\311\227=\222$\026b\007\240\250\253\017\022[\3309Dx\f\241\320W;\336<a\347u\020\336\327\205\240\312\205\270m\003Q\260~\240\307\201\324\353@\"\272U\220z\022\374Mp\225\206\337W)'\016"
+	.ascii	"2\003\302\360\300\302\202XAAv\235J\270U\023b\342\r\275p\013\206"
+	.ascii	"\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_accHasBeenCalibrated.40.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\025\b"
+	.string	"b\31777Pm\323\001$\243\320\322\340 \264E\274\246\300"
+	.string	" /o\310H\365\017\375\007K\006\261\r\237\006\255\3333\331\b&3c\006\006\037l|\001h\033\365\177}k_\356\224\002\2664\034\226a\013\331\304\270J\273\032.\313\252\344\246\315-\2736\231a\025GZ\332&5\005\236\016\227&\27195\231\t\275\253HU\300\323\317>\200\345\252\372\217\310g\354\037\f\b&\233\363p\032\214\374p\217m\300\264;\221\320q\022\204\237q\312\021\235x\360\224\337\261\234\272bH^<\331\341\027\365\302~eUd;Zc\364+\227\r\223"
+	.string	"\222]\320)eK\250\222\206m\217\235\361\301\306\343\356\341\bt\213\221\017\b\312n(\025\343\335c\347\237\343T\251\342\004\fI<^\024v\327\021\fQ\334z\333\004\2667\266C\002\f"
+	.ascii	"2\001\3138\343\350#0!\366K\3401\323\313\246}\256\341\217\021"
+	.ascii	"n\tA\302\2353\265\363\t"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.41.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\345\b"
+	.string	"f\320<:0\3456\035"
+	.string	"\003\336\177\030\350\0308\204\332\214\214\324\364~\215 \255l\251\3001]M\267A}\b\260!\306vXH\004\0318\0314\212\324p}+-\001\0230\342\377\376\266S\n*"
+	.string	"-"
+	.string	"+"
+	.string	"\363\225=\333\345\342\307\236\264ba\002`w)\345q\357\322\363\037\272"
+	.string	"\b\252\270\324$\354\256%\b\312\270\251\3336\260\215`{\f\"\027\243\206\310\364\311\223-~$\325a\037\263\024\207\215\321\250\264\024\224v1N\343\262\314\224\020\333\367G\017=\027y\301T}\332\036\273z\037\277\344\017\335p\224\322I\300\t2\017\3359\251\232\363\320\020'\341\314\371\364\305\217D\370 \237\226\230\220\007?\007N\221\371|x\031\2766]\246e\fZ\315:k\303\034\260\353\262(\267UN\3038\252eV\207^\033G7\007\256\017\330F\273Z7Z\211\337CW\030m\004x\371\250\017"
+	.ascii	"2\003\302\260\306\302R\231\300\200\034(\030U)\201\020\260qM\354"
+	.ascii	"\016\221\201\n\350T\320\227+\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.43.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\005\t"
+	.string	"\006\021@;@\3056\035"
+	.string	"T\257\303<]W^0\344\375\303\3501\030\263D\n\214e0\323\324\201\t\"\34630\245\224\002\027\242\304b8\374\300\212\034\f\321\211N\177!ze\017\332d\357\224\002,"
+	.string	"."
+	.string	"1"
+	.string	"/\260N\035\332*\037;\366#(\214\222\323\356\326\311\361\3602\364\037r\001\017\350\3422\300aw-=\240\214{\336v\202m\006\333(\001\353\031\262?\372%} \235X\020Vv?)\324\246\320\223\217\213\355K\373 \027\205\037qN\260\033\n@\332\035\027\254\271N=\376\300:\275\002\256LH"
+	.string	"L\342\354x\340\030\313\2468I\2055\247\006\245\226\315%6\370\"\026\033Y\362\3609\326\251\302\347\244!2\2112e\217\03597\354W\273\033Z\306a\340\307m\227\263\f\270q\033\004\327m \346i\021Z\226a\365\363\272\217\323\276\312m\230D\315\274\257f0\356&4\257\202]\347\325\313(\276\332\031\n\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.47.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375 \254\r\005"
+	.string	"$\tk"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001\212\001\202\200\200\374\342\303\307\202\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\366\007us\250\307\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"'./src/main/sensors/acceleration_init.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_accDetect.48.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\356\003u\034"
+	.string	"\3664\272I\220\232Q:"
+	.string	"\020\312\355\317I`p\261\004\013\304@p\210:+\255^\224p\332\036\f\bk\205\367\240\364E\200>?X\031\013X\354\237\267\337;\311\247\376\305\361J\006!_\333\354\242\344i$N\326m\326J\376\336[\356$\003\253"
+	.string	"\233"
+	.string	"\242"
+	.string	"|\247C\361y\224\026'poR\223\252{\203\0218g|\345\340\r\330\327\361\005\354\353\004\n>\374\363\340R\321\225x\fA\201\335\033\274\365\017\356\371\363\032m6\312l\245=\177\370\276\327r\270\260\234\302\220d\3448\215\342L\261\201\272\227\021\016z \t\320\223\0371\3121gM\003\353\t\314\260i\306\307#F6\246\214\266\260\324\272\227\321\rz\001\n\023 C\323\2165^\003"
+	.ascii	"]P\005\367\336\227\237D\300\027\223R\003ED~4\240\020uP\264BC"
+	.ascii	"\003\272\230M\003\316\370\224\351\334{y\376\2002\316\26633\025"
+	.ascii	"3\203`\356%\001u\344p\231\252\234\230\\\212\231\211\020\234\216"
+	.ascii	"t\334\353\373\02133q\376\356\255=\207f\272^\3146\374)\177y\f"
+	.ascii	"Y\305\260\242o\262\241\367\336\333\255\304\034\364\315\034/\256"
+	.ascii	" \334I\314\217\362\013\270\360\007`\343\311\262G\235\355\205"
+	.ascii	"\347\312\223)O\356\311/\360%F\300\3108(\357-\032[s\273\352U\221"
+	.ascii	"G\375\314\347C\275\344\0323G\365F\237\321x\005\nH\361\336\340"
+	.ascii	"\203W\356\360&\367\371\024&\236A\221\342\275\027\347\2257\214"
+	.ascii	"\257\301K\361\271\260\307\263{\221\276,\214\257\n\350\234\034"
+	.ascii	"\2554\024\343$u\033\251\245v$i\031\265`\bQ\363\366\362%\034\312"
+	.ascii	"\224 9\252\327\372\2774\035\321_\3356Q\326i\213\350\236M\233"
+	.ascii	"Z\031\2621\365\332\335v\314\020\326\337\263\266g\277<\335\262"
+	.ascii	"\225f\350*h\216\261m%*g\235\277\231\204\345V\375\217}\223Ob\204"
+	.ascii	"\246\030\333)\240\231U\260\230\377\275U4\335\260\242P\373\370"
+	.ascii	"\303\337h\365\370\222X\261\212\266\022\277\374,\214\222\030\343"
+	.ascii	"\247\316t\002\350\332D\314X\230\330`\315\315\253n\305\304\356"
+	.ascii	"\242\205f\273\302\304\004`"
+	.string	"\343{v\212_\205\211\343{\366\001\265\036\331\243#\253\216\347\003\317\203\216\304\261\030A\3424\344r\270\001+t#\232s\022zv;\273\020;\274]\017\216\324\231\320\345r\270\033\017\311\343\331\321\361\334vv\270\023\267\034\311s\223\320\200y(t\344\255\207\307#o\265\340}'\261\375rRR\321^>\303\327\220\222j\366\254\313d\315:@\035T\0130\347u\226\231\304n\376\3073\213\231\256\233'\260\314\034\341\\%\016,\335{+\360\267\276\345\004_\310+\363R\314\377R\330\327\227\3079\303%\b\314\260\f\320\034[P\305\207\025Mv\2553\265\266mMdk\004C\220<\205\021\232bL\263F\250a \242\024C\212\020EH\"9\222:cP\0021\n\322y\021\200QDC\224e\016\220\246\00271s\373\315\350nB\201M\244O_;\325V\244@wL\206\221w\301}?\2641\316\fB]\257I \321"
+	.string	"\317\375\226\0058b;\216U1\263\213\301\330\030\353X\026bR\355\312sG\256\271\2024\312\376\336\206\304\350xUEs\257?Z\220K\271P\tH\331\001|\177'=g!\216SE\004\375\377\n\354.gAM\266\033\262\264\251"
+	.ascii	"\266\200\243(\002\r\354/\233{\n\306\252\037\334\333\240{O4"
+	.text
+	.section	.gnu.lto_accInitFilters.49.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375` \003e\027"
+	.string	"\306k\226H\300VQ:$\013\354\227N\370\016\312\"\270\250|ov\024l\036>\021\023\bT\327\001\032\002\270/V\254m\261F\306\277\372\315\261\270\377\206\200Du\276\247!\231\177\033\006\n\231\330\2527e\347\241\306\177\032!d\023)S\n\202"
+	.string	"u"
+	.string	"\205"
+	.ascii	"V]\036\307s\340\256\344a\024:\032\201\0305A\315\351\263\271t"
+	.ascii	"k\274\2449\201\360\022\374\200\360\362*\343\354,\367\241\230"
+	.ascii	"o\302Q\304\324e\316\311\332\023\336\203\276[T\334G1\224\340*"
+	.ascii	"\316\027q\0224\341\261\343\t}\004\003@\370\351T\204\221\3640"
+	.ascii	"\202S\225\035/\351\362\367\032)G#T\274\017\n\002\340\205\370"
+	.ascii	"\312\360\210@\2329\347m\\\215xC\252\"\316\234\323\272\343!\335"
+	.ascii	"\251\333Na\273\202\2755\001_\235\361\273B\244_l\307\316\2436"
+	.ascii	"\3169[>\323wp\360Y\\ZF\323\357.}\332\252dL\361\222#\247Q\266"
+	.ascii	"oH\267g_\347\234B\336\022\366\314\225\356\225\250\216\021\325"
+	.ascii	"\251/\335c\250\026\245:T\265\004\325 \250\336U\253\252/\240\300"
+	.ascii	"\213(;\\\346\004\021\005fB\221D\\|\351W\272\332\267\257\303\377"
+	.ascii	"Y\265\344#>\232~@\3159)\214\227\366o\370\276\022\211\270\337"
+	.ascii	"\211\220\033\356\261\350\240\214\324\306\"r\377;H\243Ge7\004"
+	.ascii	"w\265\313\244s\262\353!\327\202\344\006Ds\346\024\200{\035\223"
+	.ascii	"!\215\262\356\256\334\242\203\372\352\336w\211\304\351IQ\030"
+	.ascii	"\271=\253\276\307UF\r\022\033\263\2515z\217\247\326@\213\025"
+	.ascii	"\251\2655\\H\r\001\n \017\262a\207\207'\274\\`eDN\243@\260\347"
+	.ascii	"?\\7\3624'Q\313\367\361\246\027\314\307'\274\214\331\324\347"
+	.ascii	"\234s\267\347Z\030\267X\007\027x\323\201\311b\031"
+	.string	"`?@2W\316\353\345Z\371u\023\024\233\305zf\264X\220\313\006\373\201\275^.\326\315F\273\315`7\326,\346\222\261^\266\033\353\206\201i@0\033+\210F\263\261T\276\334\267\204m|L\002\003Jn\207<n\317*\025\341\314J\025\322\346\343\032=\370\270j\342\240\350\340\343\316\354c8U\321\2218\240\253\rW\\\333\302\005\375\3164\272\025\262\277\344&\363\235\355\331\225`\230\3604\347\224\220\363$:\255\247\007> p\002\2419Z\017b\001\277\207\200\311E#Y\213P\242rxG\252\261\250L\320\356\344\023w\f\263\225F\013\333\331\306*\354D\037\231\0276\334\274\206\367\342 /hr\005;\204M\307\3351C\031`J6\356\263~\216.\024b\243\321\025\036\204\201\377\331\035QX\200\fx4\207yG.\247\337\247\254\"|\306Y\251\032\314\333\334bsF\305\335\351\243\211\3051\302\027p\267\225\301\231"
+	.ascii	"{\334\202!8\251\224\215\227\257\235r\236\036\320\364&\2042"
+	.text
+	.section	.gnu.lto_accInit.50.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\315\006\315%"
+	.string	"\352B\254\016C\200\236M:\327\264\304C>.\rB\237\\\034\235\274}\004\251\002R\025\022-f\265\223I\340U\333W2\257\030\227\262\353\331;Q\245Bl\333\255\020\303\236\212)Hn\261\242\237\355\207\331\bI#\322\266L)\311"
+	.string	"\313"
+	.string	"\346"
+	.string	"DD\353\262\\\343\3125Y\256\307r}\363z\342\326K\256\317\340j\210\203\374\260\230S\253V\233\241j6\246\371\372\227_\314\327\236\362\301\274\350\\\230\213M]\214\214\022\270\243$#DKQ~Lp\363\211\3672\365/3^\261v\020i\221\351\223V+\021\302G\203(?\232X\316\265\317\345`S\017\223\362Xk\022)gj%J0\206\362#\200\023 ?\356\007\220\037m\273\302\205)\323\023\273\264\016\305M\226\330\240Z\211I\323\311\351\311\3616\227\372\300\223\363\212\231:y\306\f\201|\314\r\257t\f\261\366\346\343\363\366`\013\216\017\243\241\325\215"
+	.ascii	"\035&|^\374\n\207U\2738\016\265Vop\310\343\306\3356\223\355\026"
+	.ascii	"6\031(\324\253\316\355\320\257\262\326:\205R\241V\346\316J\240"
+	.ascii	"\2659m\212\345t\250\331\234Y\026T3\325\3628tKY\253\025\006\377"
+	.ascii	"\315\341P0\332\245C\007\362\343\234\273\037\177\264\204\371m"
+	.ascii	"hx`\360(~\214\017g\023bM\331MLH\004i\355\021$\366\301\235\f\330"
+	.ascii	"t\371\264K<\r\224"
+	.string	"\221m\342h\224t]\265V\f\037\317lYP\215j\333L`m\025+f\201 `fU\023h\001\373$\367\033\022\302?\3662<\243\256Z\251\306\234\f\013?\312G\267\340\355\203\037}^\317\267\017\372\305\243\330B\\K\303\232@\233X\265\223\313\376\255\316&\366\303~\005H\006\274\016\360/7\200\213\271\217tk#\335z7\327\272\334:W\264.\362:\233Cjq(\351V\030\241J\225-.\177\026\r :J\306\311e\034\221\351\2751\003\301\231\r>\233E\277r\200\330p{\326{5\303BW\255XYkEo\324\331*\372e\nb\202\262\b\357\325E\312D\232\237\002&g\r\314\243)\244$\321t\001fO\206-\347\307\266\322\034\273\2566\245\003]l\246Zt\270\017\022\315\004\270Y\316\227e\261\365x!\352E\b7wW\304\264\204]\330\217}\020\r\262g\246C.\210\026\331p\026HI\303\031 "
+	.string	"G(\222u34\273\232@\037)\271\232\f?i\343\235\2665!T\333v\233\\\266\311\21147N\037>G3\"g\356\352\320\245\004\267\314\346\344:\365\"\307\351\002\214\036\253%\304\344z\362\374\214r\331\t}\362\204\3748\316\261\314\320m\032\230{'\213\r\312\357\004Q?_\323\357\305\022\023\217(\352\347k\372\275Xb\352\320\344\024\005%\243wDC\204/\212w\302\307\004\243\211\247\324\353\361\216\334\233\020\265\364[j\361sZ\212\342=\371\230|\275\036/\t\352\311\t\352\347\203J\372-\361\232\222zOPI\023\034\330\t\206\357))\312\311\351))G\244\372\255\316&&\321\212\024\311\306\237\222/>\004\232\260Hv[\340\003L\241\355"
+	.string	"\323\034\250f\025\371a\355\032\202j\254YQPh\227H\351\224\340)\263f\304h\3325\016-\022\223\355\326\036\021\013\252\355\246\311\356\265\252\225j\201\321<\226\233\252m\263n\356\346<\204\225\226\233\272\371,6\"R\021\206(5\020\222\2339\254\342\032\207\375\330\002\2419\n\354\217\365Q4\235Kb5\201\300\345A\253\206;\212&Y\034\262\365R\244M\257\002{\250a0\344\2243\206\251\021\nKS\220\f\007\240\002\021\251\242\362\021"
+	.ascii	"5\210\fc3S3\214\001q\b\212\223(O\317*\233>b[Jt\3537\222\036\207"
+	.ascii	"\b\227\3471\354\240\242\345\027\272\265\361b!Q:\331\036W\246"
+	.ascii	"\361\bM\353\222-^f{\274\274\340\240\365&\351\354P\022\001\300"
+	.ascii	"\203\331\034+R\223!\2533\003\276G\234s\367N:\357\2243`\342\311"
+	.ascii	"\233@\302\032\317\346\036\022}9\370\016\270\204\370Ak\202_1\210"
+	.ascii	"\347\r\032\007x\\@\206\215Di\01763\312\303\305\316\221:\247\207"
+	.ascii	"\226ry\202n \221\2673\022\253\315~\003\f\3559\266\243\321\"\001"
+	.ascii	"\206\351\242\037\323\004\357\374\034>\355\367\300\006\262\356"
+	.ascii	"\274W\024:\016\251\225'\246\306a\315Pf\260G\211H\0219\241iHS"
+	.ascii	"'\327\302\357\361JQA\031\312\037\203\3466S\210,\f\203\030\245"
+	.ascii	"0\216\366\002\004{\367b.`\3642nR:\243\202\353 \003Nq\204\032"
+	.text
+	.section	.gnu.lto_accStartCalibration.51.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\005\007"
+	.string	"\202\21514`m\322\001@\235M\201\021\024%lh\256\305\310\312\212m\303\362\216\271\340\233E}5Dd7\216\313\f!0\005"
+	.string	"\023s\31415\204D\265\372h\233\310\235R\2360W\254bB%\343%MJ\201\232&\tZSZ\025e\301*J\013p\232\026\304\020X2P\023^RNx\321\366\321\252\007A$\304Q\b\353\3043\025\273\341\037\031\201\317\356\032\370\035\367p\3603\376\374\240q\317\376|M\345\317R2\262q\302q\233\255m\234^\330\217V=\266\006\200H\342\266+\261\245l\350\2014l\377b\3146\271\366\331\207XD\200\240\354.T\214cw\230\177\216[\262\316\346\016\340`w\355\262\016\305\255\267=`\273\300vE\b"
+	.ascii	"3\241C\037\270\355p\241k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.52.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"}\007"
+	.string	"\302\31645`m\322\001@\003\260\350\274\021\224i1]\305\210k\213\026\b\336\223\355\260n\r\035;\324d\213q|y\221\004\013\202@\310*\250\235\247\220\336\212P\267M\344N)\256,\331\205]\nX\2742JZ\fVUQp\31281kB\354\242\032`%'\264\0308:X\022f1JX\331\366\323jH\225`\243\034\373\223rU}$\035\022\307\017\347\230\001\273\213\340o|\004\341_\3749\002\343\356\371\3631\224\277\353\200\310h\343J\366\246q:a\177Z\r\331vV\347\374I\300\003d!d\367S:\331\217G\302\260\235\261+>\270d\254}\253\370\\d\321\3510\331\335\240R\\\273\323\374k\374e\214\224x@\232;\200\204\335\265\363\200$n\275\355\002\333\027\333\242\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.55.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`\320\007\235*"
+	.string	"\332I<\020F`\336Q:\367q\273\207\234\363\270\016\347\245\371\240\017\210\3231\304\005\310|h\017'\360\333U\3505\r2\230\206\317\260\267\002\352\270\360\227\264C\026\376\025\370R\265\3541\321\244}\332\016\001Z\253\375F\b!d\313$\003\350"
+	.string	"\340"
+	.string	"\374"
+	.ascii	".^\306\367\f[\363K>\031\026\3631\354\311\030m\275\312Z\301\220"
+	.ascii	"\221ik\333\326\301Q\336\260\036=p\336(u\001\346c/\376\240y\321"
+	.ascii	"\345^b|\311i\240 1\230\277\345\\d|\311WK\216w\224Y\0063\357\350"
+	.ascii	"\311c\3467\363\263\\\013{\260\031/j[.8\263\266].1\323z\224\227"
+	.ascii	"?J\217\2567J\2172\313\234\347Ke{\2620X^\232m\333\376\256\022"
+	.ascii	"\276"
+	.string	"?\227\347\264\331\353V5E\317\333,?\354\t\232iG\344\325u\b\216\364\020\362\365\224P\243\271\3657YB\316^\034V\234\207\035A\224\254 \255\236Dm\333\n!\261\316\b\215\003Y\354t\347\245u\024\310\317S)\271\346\207\020\262\306y\344\006\t\033\017I\243\357\311\\\211\355\355\210\324z\253\027\332\266\345>\"{\234wg\346)\314\354\201Y\025\013j\"F\224(\221\036\275\327\300\222\263\337\276Mfl[\343\264\252\371\275I\364|\235\021{\256Qv\360\247q\032R\266m[\201\237v4&\206'N\244G\3213x\254\270\235\b&\315\306y\273\262\016L\223\356\026\025:buht\034\337\214Q\334\fpm\333\226\211\177\3662O\374&G\031*\252\177\214J\217&\335\233\235\301\037580b\317\335\266m\257\356\355b^\026\373o/\027s\257Y\251\301\301\376\004\275\346\244\223\235}\275\346\001\275f\244]\263"
+	.string	"^\363Q\2579"
+	.string	"\257\331Hm\006\2406\027\251\315D\273\346!\265YHm\016R\233{\273f\236\256y\2476\353\324\346UmVu\315\251\332\214\256\315\347\332|\327\346V\233\017!\351\207\033)\265\266\3451\007\250]C\317\236\234\354i\363\303\334,9\002\334\263\251\003\006\340\032]\002hE\027"
+	.string	"\321-j\033}\274\321G\211\340\206\256\261k\b\335\241\270\007]!\270\367n\320R\027\233\330\273CT"
+	.ascii	"}\235\361n\267s,t\227wS9\254@rS\200v7i\tX\326zu\327'\307x\245"
+	.ascii	"8vFK\325\273^U\256\351\264\276\251w\210\312\033\334\231\317\215"
+	.ascii	"\307\330\nL\225\356\303^$\206\305H\0378c\214\342n\300>J\367c"
+	.ascii	"\357\260)\314\244\026\365v\261\316\016\332\340^;\355\340\276"
+	.ascii	"\213c\351\276\373?bvht\334\317\266m\333\364\301}\267\301\375"
+	.ascii	"\026\333\2331Y|S\332\326D\201\231\341z4\254y\204\034~\312&S\351"
+	.ascii	"Q\013J7\356p\266\251;\351U\277\370\371\002+c\346V\300\344\262"
+	.ascii	"#&\035\020B\3129j\022\267f\023\275q\234\202\224p\216|\316\213"
+	.ascii	"\336\033\333\334\333\367L\026\335p\231\001\376\3605\020H\314"
+	.ascii	"\266m\231\332<\303 \214\247s8\025\024\222X\001e\025\f\241\202"
+	.ascii	"\n\203\224T\225\260\210\241 X\005\251\202@\252\252\240\325\223"
+	.ascii	"0J*\n\n\352\3517\024V\r\251\242\206?\252\340\323\324\017J8\374"
+	.ascii	"A`\300U-\242\204?\253\252*\341\217\267$\376rq\n k\304[\344\001"
+	.ascii	"W\t,\240Tr\347\346\016L\221\356\200{\3421&\213(\232\013\330H"
+	.ascii	"\220\256\212\325\005N\027\241\231Y#,\222\376\221\037\366U\216"
+	.ascii	"\332\032\\[\361^\361\337\224vu\221\246\tL%\235d\227,)\231e\322"
+	.ascii	"D8,\030\322[\254\023f\237\260^\375#\353\345\345\247\327\036:"
+	.ascii	"\315\326\272\224\026\022du#\372\322)\r\244\211\231\316\205\331"
+	.ascii	"*\375\203\375b\246\243\334>\330+,\026~\223\031\351\321sy_\321"
+	.ascii	"\001(\231\305M\300EvV*w\344st\005\334c\005\np\215"
+	.string	"\356\321%\200f\204\302j\351\035\300\263a2\033\326:0<\215\331\001\200\234\250a(\350\030S\214FF\222\024T\322\032\200\002\221\251:z\021P\2553\216\221L0\225i;c\324?\224\251\354\206\317F\335\262\016\343\221bk\257uq%\271\342'\241\260\"v\310\320\270@%8e\017G@\265\233\332~mz\205\002\365\241'-*R\001\f\273#\013\204#Vk\306\220\243\320\201B\365\t\315\232\212\332h\334\212!qF\250\363\005\217\377?\336\216\030\341\2361\242\035\204f2N\246m\034\002\255eS\"\2366\316s\374Su\250\277\266)c\232\235e\302\206\2507\374_N\242m\215\330\331V\267\215i\300\312$\350\033\030\2446+\354\232Y\221\210>Ee(\346\225\346\017Q_\343\r\310\304\362KV\234\330\247K\207\0079\341\tx\350\241>\207\025\030\374\223\223\301\260\221\036OH\233%\035\302\331\257)\235g\346"
+	.ascii	"\2128\374\257\205\374\361\362\215\222\361\261\311n\013g\2664"
+	.ascii	"\030`\242\275\210?X\323\007)\345\214\264t\323\t\341E\214\305"
+	.ascii	"\323u\273c\215\005\006P&\241\0237\250T\374~ HP\327GaF\f\223\232"
+	.ascii	"\241\232#\204\200\005\222\242\242\323\337g\005\227\002\216\242"
+	.ascii	"\264\343\231?"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.56.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`Y\rU="
+	.ascii	"\232c\354\025=@\346\316\030\372\343\227\355\353\364\271\030\""
+	.ascii	"\263Z\3532\313\363~$yR.\203~\272\265\022\340\257a\241\247'\333"
+	.ascii	"\320\317\355\335\257\350\243\007\360\013\375|\255\372\027\376"
+	.ascii	"\365\367\226RJ)SJ)>\001?\001R\001HE\347b\321\231HtnWg\266u^["
+	.ascii	"g\265uN[g\264u~\326\331W\347&\321\216\006\013\017\3650\364\276"
+	.ascii	"g\207\215\336=\251\036\\\267i\325SG\035enr\337\3315\033\267\333"
+	.ascii	"\360\236\024Y\363M[aXG\016B\247,\202\355T\nm&5M\253\361\321M"
+	.ascii	"^\023\325\361\301\334g\272\016H7\031\212N\231\224{\337\267\330"
+	.ascii	")3\020\346b\247_d\346v\346\226\3539\267\231A\236\226^24H8\357"
+	.ascii	"\333\224\300\031\330N\271\331Mj\247l3\251\235\262\313\\\250\233"
+	.ascii	"\312\267\363\216\230\251)|\337\267\352\335\370\033m6\263\356"
+	.ascii	"\266R\022R\221\330\262\253\232\032\321w\227{\375\320\"\323\204"
+	.ascii	"\264R\262\223\320\007\203q\024\365\037Z\022m:\353\202\214\342"
+	.ascii	"H\353\207*jP\2728UE\355I\023Q\013C\n\241\364\037\332\023\024"
+	.ascii	"\311\320\314\217\023o\321\245&(\205\273!\316\256\037\260\250"
+	.ascii	"\261\365\272\326\252\331]\231\247-\306\326\306?4(\250\324\373"
+	.ascii	"\276M\327S`\320\2448\252\244\037}\220\314\243D)\215\fm\342c\205"
+	.ascii	"P\323\265\033I\033s_?\274\357\313\216LSk^j\346\236bf\023\314"
+	.ascii	"H{\002\357\373\032\377\n?\315iA#\210\314\r\321\365\025%r&\272"
+	.ascii	"j\302c\247\t<\264\276\325\332\234%S}C\307\250\300BX\006\224-"
+	.ascii	"8\",\b*\b"
+	.string	"\242\007\035;M\006\346\020-\b+\220\013e\004\007e\020\265S\365\255\314\362\236\314\364\001\001\365_\373\351\343\315{j\247\351[\001\346-\321\337\343'\241\373\362\240o\005\210\367\324\373\277st\352:m\247\004\3578\341\215<\261\207$\024\363\303\bM\347\330v\312\367}70\247\350=\025s~du\232\300-_j\247\377m\367\246\307,Z\357\213}\3377\0037\234\216\323\202{K\247\354\342\305\013\265S\377\342\"\274%\223\371\206\234y\371o\343\n\255\245\366\307@\023\210\314\r\231\333M\277\321\342\336\302[\\\336\310N\271\271\324N\373;\310\021J\316\261\211\371!ss\314\277\355}_!\374W\230\257\232\331m\325m\232\031\264\316TI\316\013Vg\005I\316\t\210\316SDg\251\3269\212\350\214\200\350|\240u6\300:\027 :\023 :C!9?\255\316N\253\363\200\326\271\251u\026\320:3\265\316\001Zg"
+	.string	"\254\363\322\352ld\235\225\210\316IE\347V|\200O\001/wl\240\364\270\250\364\217/\217\275F\351e\260:\004:\031\001oe\007\270d2\375\0301\016\346\013\3233\300\303u\361-G\326\265\004x\013n\200\226z"
+	.ascii	"\376M\t#\013\203\262\317\261\034Yo\003\360\375\346M\317J\225"
+	.ascii	"\245o\315\376<\231\023\274\330n\233\312\354\272\271o\336H\336"
+	.ascii	"\361D{\016\222\275\020\356(Z"
+	.string	"\\8\033\314)I9\247\030\r\225\275\211;\241\341rq\341\340\334\374\n\235P\31636\304\326R\215\017\346L\214\337t\355\300\315o\311\326\355\267q1\313z\365i\026#\204f\360F\230\301;\226F\331oc\360W\337b\f\375\312\222c}T\223\0345\004\272Z\214,\f\036\224NG\3633\245o\315\372\236\314<fv\005G8\317)\320\210\033F\200\022\271\002\366\225)Lz\"n\234Q\351f\215$D\372\244\3572=\305'>Rrl\b\347Q\271_\234\314\rs \320\305|\314\035\343\222q\227K\265\323\342S\275\351\265O|\027,\033\364\327\215c\017\333\177\300<K\377\025B\203iGn\\\023\243n\344\3161\363p\351\274\221.\235\332\351\272\306W\306\331bv|D\324\306k\366\273\312\223\375\276k\007\200t\236\237~\033w\367\033a]=\266\3200\034]`+jp\351\350B!\303\353\352\306\215/0"
+	.ascii	"\3145AG\227W\227\226\327W\227\216-\260\0317fpqmU\205\201}\205"
+	.ascii	"y\315\b\253\362\352\332\302Q\305\005\026V5\241\001\177\345\230"
+	.ascii	"\001V\245\343\353\013\254\252\330\024\353\277\302Z~{\304~L\211"
+	.ascii	"\2033\273E\\#M\327\354\037Gp\236\203cG\025\211#:^\b<sB7M\002"
+	.ascii	"\273I\374P\326\002C>\350.Ys\2334Q\323\350\227C\200\205NA\335"
+	.ascii	"u|\345\202\204X\247\030\224\332u\f\302\003\0359C\327q\b\017\304"
+	.ascii	"b\356\272v3H\032%\345\234T\017\350\217\352\bI\270\340\251\276"
+	.ascii	"\315\036)\370\004\277\340\237\372\312\274\214\371\341\023\357"
+	.ascii	"\243\325xn\024\377s\245\264\033>\n\276\361\336\230S\237\340\237"
+	.ascii	"\372\244~\312O\217\324\033\335\234K\275\250\317\203\007\301G"
+	.ascii	"\301\351\003\217\300\216\033\307z\235\003ot3\3644@\347\210aO"
+	.ascii	"DV\025\2017\360\252#\263Gr\364\n<\2027f\005\250'\360k\24223c"
+	.ascii	"yn\034\213\007\365?\230\205\31197E\273B\205\3169se\224I\337\306"
+	.ascii	"\374\244\237>\306\035\025\027\356\351\177\255\320\022\311\351"
+	.ascii	"\331\034\036\266\226:\340\235\276]\315\200_\371\b=\331\272\330"
+	.ascii	"\364h\352\004\257\274y\3545\201tX\036\224\314\246\017\201\033"
+	.ascii	"\250q0\310\030cjF\024\244 )H\2411Q\005\304\030I\031\341\r\021"
+	.ascii	"\360\254S\216\241\032MR#m\006\203\340\205\260\300\313\225\274"
+	.ascii	"\203\027\355\2329l\031\315\201FA\206p\224\313\200\345\361\223"
+	.ascii	"|s\2528U\021\266-r?\273\223\270\300G\255/\257l\t\236 \325\256"
+	.ascii	"\247\002X(3\224\230\265l\321^\n}qe\236\035\367\002+\222\350\256"
+	.ascii	"\036k\266X\232:\221\262\340\245\023\037X\322\034\276D\200\035"
+	.ascii	"\230\331\006nJv=\331@o.\236d\237\205\023[\013V\211\232\nY\207"
+	.ascii	"e:\222t\221\2640\325\t\340A\321\277\266\367\315Q\031\020&.\r"
+	.ascii	"\346\246\273\336d^\214\330\345\004^+\300\234S\216\024nz\232\241"
+	.ascii	"\036\310H\271SOWM\327DJ\354\353`\367\356$\2055v\216z\2157\211"
+	.ascii	"\304\245Q\300\363B?\354F\271\217\002\212\362\243\215\274FZ\337"
+	.ascii	"\365\304\004H_\225\245\344\313ZX\205M\017Yf\032\206\306m<\036"
+	.ascii	"\3332\371\223\332\037\306dK\241\243\366\331\023\241H\362\021"
+	.ascii	"\247~)\026%\360H\265\305p\316\f\342\215\255\006\222\335+f\032"
+	.ascii	"9\232Sm\234\rd\323\302\235\275\263\003m3\002\253\352\372\302"
+	.ascii	"\020\333\274J\322\377\273\364\205N\007\221\275\035|\223\232P"
+	.ascii	"\333\243\363\227\275<\243\357\026^d\252\b \232ZS\250\0318K\240"
+	.ascii	"\215\0270\343WH\341\336\200\006\263\002]\003s-\213\266Q\232\234"
+	.ascii	"\023\364*\236\361\254U\031\266\304\350\2725\302]-\354\246\215"
+	.ascii	"G\351\235|a&\220\220t\331\270fngU\231\272\004\246>3\204\031\002"
+	.ascii	"\033G\0171\025\2175\315\327$\f\217(\025O~\"\357lS\\\242\311\205"
+	.ascii	"\t\030\361\311\310~6\312w\252\210\252K\261\303\377\272\027^_"
+	.ascii	"\360\001!\035V \026'\317\274N\207\354\020As6 \253\217\004U\210"
+	.ascii	"z\225\3279\324M\257\365D\037i\264\rS\270\353\370\370B\005!\244"
+	.ascii	"\315\374\277`xb\341E\272\320,QE\fC\352\354\351H\244U\001\232"
+	.ascii	"\336\261)\306\254\216\343\034\315b\236\320)d\242\006"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.57.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\245\b"
+	.string	"&\021>7@\217\322\001\340\006\237\261\206\036\307\226\3465\224A<}`\331\340\376\322\001\255YdU\\\355A\264\\\366\004\331\360]fDt"
+	.string	"0\200\241\357\024V\375\237\265M\366N),"
+	.string	"."
+	.string	"/"
+	.string	"\230\017\\\036\315\331+\357P\373\022\026\305\310jw%\3148\367\307\371\377x@\3114\372\003X\330]\277\222\311\342\206\267\215`\233\3016I\273\273\206'\373\251\377]\007\253\024\016e\267\242\305\262\252x\262\221\261\375g\277\343\036\334S\242\013\354\236TLv;\005o0\217\356Npy\f\013O\356\260T$8\341\007m\210\213\210\fP\273\273\361A\036\022\341k<Z\"\364^z\364C\227\307\fG\013\353\202\364Zv7z\020\303\376\025Ym\230\234\372\321(\247\300\230\006\244mZg\233\032\310C3\207\f\303<\262\322Y\267\254\312M\363|$F\253\324$x>dT\202\346\2442\323\355\257\t"
+	.ascii	"\205\223\241\214\351\3463\2748\013\013\346]\002hVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.58.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`)\002\275\017"
+	.string	"\206\\eD"
+	.string	"s\224\016[\225\346R\223\266\344\231\243\242\t\252\212*\262\254\316\330\257\203\372\021 R/\001\365\240\276\271&\013`\226@\2479\2133\313\226\t\310{\365\274@"
+	.string	"\001H_\251n\335\225\315\276\225|\262\211\224)\005M"
+	.string	"E"
+	.string	"Z"
+	.string	">\366%\256\210\340\330~\332'\361\022\246\263J\016\262\253\202\251\354\266\016\370\263=\272u\001\332\343\366"
+	.string	"\332\243M6\217\267V\373\030?LR`\273\313\351\207\233\236&\377&\256I\235Xxf\022\354\2563u\222\341\326\333&`\233\201\235!\002\241\217\362\350\n$\371\324\243O\242=^\017\343\340\032\301:e\314n\241R=\330\317vw\255*\373\254\037@\246;\232\346hz\223i\215\246\267Lg2\255i:j:\313\264j:3}\020\021\r9L\261]\f\2611+\026\034+\215>\006\004+\243[\367\031+2T2\352q\265\2604\205\361\302E\213\247zD\3252M\215\352a\271\320\001\2251\253f,\274\303\274V\2146\025\"#wy\241\224h\217\252\207\331qM\275\311\017Gx\212\207`eO\270k\364\361\367\024#\005^\273\3739q\024\001\240\222\250[\020\216<\320\201\204P\311k"
+	.ascii	"\201\244@$\372\300\001\016\205\224<\222\367\200\364y%\020\330"
+	.ascii	"\211\272P\b\304\205\340\027\222\272\220#y\240\021\027\002C.\304"
+	.ascii	"\200?\n\035\310\225\276\017\3448\255\323\263U\2257\035\033^N"
+	.ascii	"\212rGo\330h\251\301\321\316F7\345\250\307E\243\033\032\336\003"
+	.ascii	", \260\202\231\032\355\"\241\02730\206\247\004\326\220\217{0"
+	.ascii	"\2763\211\356\r.\310\337\204\220\304\356\365bZ\003\006\016\361"
+	.ascii	"y\260\016\241 E\212\361b\304\342q9X+q1\027\344\005G\374\031J"
+	.ascii	"\276\035V2J\305\270\206\342l\237\201\320\246\277L\350\275\315"
+	.ascii	"\372\352\320L\3266\373\024\350\345E\233\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.73.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.74.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`U\002\225\f"
+	.string	"\004\022Q\003"
+	.string	""
+	.string	""
+	.string	"\002+\1778\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\320\202\002&\1779\220(\177:\005,;\301\204\001)\177<0\177=\252\333\3426\220\005<>`1\177?\201\200\200\200\002\005> \005%@2\177A\005\305"
+	.string	"B\304"
+	.string	"C\0023\177D\2204\177E7\177F\001\306"
+	.string	"G\300\003\0028\177H\310"
+	.string	"I\005\311"
+	.string	"J\005\312"
+	.string	"K\313"
+	.string	"L\314"
+	.string	"M\315"
+	.string	"N\317"
+	.string	"O\0029\177P:\177Q\005/R\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005-S\001=\177T\377\037"
+	.string	""
+	.string	"\200\220\200\001;\177U?\177V\303"
+	.string	"\177W\302"
+	.string	"\177X\301"
+	.string	"\177Y\300"
+	.string	"\177Z\307"
+	.string	"\177[\316"
+	.string	"\177\\\003\005\036\320\360\372\250\001\001\244\001\003\005\035\321\241\314#\001\344\n\003\007\037\003\001\304\007\003\n#$\003\n\"D\003\n!\204\001\003\n \244\n\003\n\005\202\013\003\n\007\241\341\365\321\002\001\342\017\004\n\225\016\003\017$\310\217\364\031\001\204\026\003\021%\304\022\003\021$\250\270\275\324"
+	.string	"\001\344c"
+	.ascii	"5 \360\002\251\251u\020u?\252o<4\336Fn\016\222&c\240\025\f\352"
+	.ascii	"\f$A\242 \275\t\306\245\352\t\272\244\300\341\004\302\337\245"
+	.ascii	"lR0$?B\016\330\264[\375\0316\3666R1\234G\237I\233!\265\005\243"
+	.ascii	"\304\327\333\026\305K0\374\351p\265\0252\260\301\n\344\350\b"
+	.ascii	"\357C\270\0164\317\215\254\335\225f\372\203k\025tbWe\270,\033"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.refs.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\315\007"
+	.string	"\366\2258)`k\222\016PQ\024EQ\0243\004A\020de\220UuM\223*\030\337N\304\357o\tib\364\366\277\375\275\355\333\337D\246+"
+	.string	"+"
+	.string	"-"
+	.string	"\230V\330\037\317;\036\217\317;\330\033\367\r\366\303^L\0166$\323O~\223\375\356\213;\315\253\321\246\247\353\2752\322\275S\277\025\001\352#\365-\177\251W\271\003{\252\336\300g\250?U\211\272y\2447\013\351\030\354\027\354\026\374\b\323\025|\nV\362\244\031\246\327\375$\023\344g*}\200\3221\353-\331+\2553\374\325~\322\272d=\204\365\207\365\204\272\003\365\006\352\227\337\365$\363B\366\204\374\203\353\031\374K\237\004\322\245\200;r\035\357\235+"
+	.string	"\303\322\277\270\276\005>E\373\211\366\022\371\021\355!\242\376\020\275\303\352\r\353\031\330+\260G\200\336"
+	.string	"\372\002\350\006"
+	.ascii	"]\0338e-\3165\261\210\007\346\202S\214\224\267.\n"
+	.text
+	.section	.gnu.lto_.decls.1ba92cc2977eeb6f,"e",@progbits
+	.string	"(\265/\375`yV\355q\001Zi6\207U \fQ:\215\001\025\364"
+	.string	"\3037\364\214G;\016\030\300\377\203\376\234\027\236\345y7\325\376<\206\037\227\347m\314V\316t\313\302\267\025\303\326i\264\365\251"
+	.string	"?\273\002\316|9p&\221U:z\360\024_\232tt\263\361\263\021\317\2748\363\210<\224Dn)\245L\001i\007x\b\225\bR\331\207\017-6w_&\273\306\006\3326\026\360.Y6\225i\325\3304\007Z\206"
+	.string	":\241\234\375\255\311\200\257\203\350\353-}}\245\257k\350\353(}\275B?\330F?\310\327\004\262Kf\276\310\260\370\301/\372\277\305\263y\225i\315\3301@\313\275\243\330\331\273\235%\f{\367\300\363\0223c\313\330\273:\247\\n\252\fxvk\274\376\366^\002\205\bq\331\356\372\3162~\220\207\376\355\035\031\034\300&W\200d\354\230\2351\"Q=,~\260\205~\220I?\257\321\317}\372\267`\272\3309\373#\004gZ\0139\026\026[\272\240[0+\272\242\250,\316"
+	.ascii	"O?\333i\273\254?\031\304\026}A\365\311Y\254\034\026-\244.\007"
+	.ascii	"\025\264,X\350\320\266\335\225[,\317\313d\226\252\250)\263qp"
+	.ascii	"l\252\336\210X\374\034D\2772-\0258)GZD\231r\013\367\223\360\240"
+	.ascii	"\326\345l\0179j\264p\241a\361\375\354\333\377\233\2350cmpon;"
+	.ascii	"0\276\354,7\333vs\306\256\r\023\213\237\265\364s\016\275A\256"
+	.ascii	"\261\366\333"
+	.string	"\264\332V\327j\220\212J\331\024\213\237c\350\\}2\023\363\314\270bBY\3743\215>\007L\354\330-\223\322j\\D\232{/\377[3\013\2452\355\231%\303\313\275\321\316\354\322>\331qZ\356\251\025v\336\330\222\275\227!\200B\350\250\375\255\251\312\270\314:\341y!\204\005\020&e^\372'\016-f\233X\252\263\037\247\f\261\023J\037\373\351/\253O\266J*\335\0315-,>\016\243\355\021\213\2442m\222c'X\333l\357\245\316e\252\332\322f\361+\210\314\023\030\030\030XA\344\343-\372\030N\377\266\210\327E[\276AYL\344z9\202\303\212\305\307iL;\304\nYn\240\034f\246I\312\342c2}\034\246\357V}\262\355\262>n\177X\256m\177t\200\2657\223\375\301\303fo&\236Z1\250\025\003\034\246ED-\343c$\372\270\313n\275\336\205`s\300\220Ej\207\305\307<\264\305\252?y"
+	.ascii	"WZ/\353O\256P\325'\037K\351\337\342\270\315\361\333\033\265\311"
+	.ascii	"\333,\226\355\242\247\343\317\342\232\026t\213\343\272Uybc\361"
+	.ascii	"q\013\235S}r\335\325'\377\232\321U\312\326\240a\311l\261\255"
+	.ascii	"\230\272\245\361[*;\243\336\205`o\247\2757\207Je%\213\210\305"
+	.ascii	" \352O>\253O\256cA\267S\270\307\031\031_R\037x\226U0z\310x\312"
+	.ascii	"|h`b\304\260U1\234\350`0\005\375\300\244e\211\312@;\301\255\211"
+	.ascii	"Y\374\333\027..T\024\326F\333{\211!\250\006\006\207g\261m\001"
+	.ascii	"T\317\240\031\313a\361/\026\375\332\344\251\366Y\246\273t\323"
+	.ascii	"lZ:\232\366\251.\353\334\016\323rS\355\320]Y\035\371\263P\226"
+	.ascii	"\205u\262MvEe\332\247\252\367\272W\371\242\330\247Z\2466w\230"
+	.ascii	"\226[*\370\304\312\313\227Z\267\263\264\3342\262V\016\253#\177"
+	.ascii	"{/_\325Hx`\237\252\230zw\227^A\246\026\216\346\336\313\020!\200"
+	.ascii	"B\204\b\241\323\205E\312\224\034l\227\314\344\302\250m\213\177"
+	.ascii	"\317t`\005\254L\273+\032\266\332\346.\335t\233\026\214\246\335"
+	.ascii	"\265\254\236\321\212\362\272\260\367\303*c6@:\\XHvX\374+D\277"
+	.ascii	"\252\275\325\265\035\246\236\355\324\004\365\32755MeV5\365\317"
+	.ascii	"LM\235R\327v\230\226\027\004Z\035Y\262\367\016\001\024\342\246"
+	.ascii	"1\333\322\314\370\366\214\276\375\342\367z\346\257c\225\314l"
+	.ascii	"\357\315\001g\306\334\230\033\026\223\bz\365\313K\250\360Hc\361"
+	.ascii	"m\233\256\273\376\344\236\352\223o\301t\305\253y\225\231A5\263"
+	.ascii	"\344\261@\332\244=\261\370\326K\277f\220o``\315 \337n\351jW\307"
+	.ascii	"T\346\207J\346$<\370]r\302\243\003\b\006\270\306\342\333+\375"
+	.ascii	"\372!\327\300\372!\337J\351Zg+\230\032\346\265\256\322\235\204"
+	.ascii	"\007\317q\332b{/k\035\336\233\251V\fvj\305\340\214\023\302\364"
+	.ascii	"$\343[\027\372\265\215\006\252?\271K\207\034\265'\25401Z\352"
+	.ascii	"\226\312\254\\\252\224\262\032\245\316u\221\020&\327\344R\331"
+	.ascii	"\252\\\235\353\"\001PKs\357\335!D\b\214\304\217\314/\343,@9."
+	.ascii	"\376\232X\374*E\377\257Wj\225j\245\306Uf\305R\341n\227{\243\265"
+	.ascii	"QiS{\223R"
+	.string	"\311\334\352\332\316\2717\026\233\327\336\373\034\374A\257X\352\224\272\346a\305\336XW>Lf\326l\374\355\275\201B\204\b\021\202\247E\226\016\275\013\3705\206>R\377H\237H\237\2507\250?\371\037\320\027A\377\365\311k\224\272V\2616\207\235\031gK\254,\256f\365\2542;T\264\327\264\252\366\223i\271\227{o\236\272\327\3254eqO\375\311\266\372\344?@\277B9\005Y\333\203\357h\023\354];\344\032\030X;\344\352$\350\365\311_\231T1\237,\245\\n\264\2757\017\b@z\204Y|\253O\376\005}\253/\250?\031W\237\374\271\372\223\277\254?YW\237\374\277\315\375\376\337?\257\250\177>A\360\257\265\346|\347\317Z\177\215\273\030\330\261\344\267\177Y\254\013{g\006\013\230\002\334\001\177NBr+Y\376\232gh\371\277V\343\376\272\365W\n\254\230+\326.\205\270\377\302\375\367\255\346<\350\317*\274"
+	.ascii	"\007C\364\327\267\377f\236\377L\374\357O[\265\372\353\006\376"
+	.ascii	"zUg\374V\310\177\331\376\353\341J\371\253\375\257\215\377FY\373"
+	.ascii	"\253\362\267l\277\005T\373m\220\377\246\375\326\013\255V\375"
+	.ascii	"\365\376\227Yq\334+(\177\275\361\327\256\213u\366\337/\263\377"
+	.ascii	"\027\250\034\370m\336\177\017+\356\223\377)d \302\2371\360\337"
+	.ascii	"\250\262\277F\371k\225\277J\371\253\333o\331,\255\032\037\277"
+	.ascii	"\335\263|\227\354'\374O\341\177\001\376;v\n\376\034\302\177\227"
+	.ascii	"~\353A\223\377d\376\352\363_\013NT\024\356\007\236?7\340\277"
+	.ascii	"I\377U\372\257\212\377\246\370/\362\277\351\177W\370/\tLp\207"
+	.ascii	"\377=\376\027\351\212\375\357\371s\232\277\342\377f\352\205\237"
+	.ascii	"\177\3469\316\2375\370o\345\277Ln\330_\363o\323\\\037\240\377"
+	.ascii	"bx\316\237\005\360_\315\377\277\003\376g\223s\375\347\017\377"
+	.ascii	"\005\373/\222\377\032\371/\217\377\352\370\257\362\2770\376\353"
+	.ascii	"\364_\246\377\232\340\277%\370o\006\376\213\201\377V\340\277"
+	.ascii	"%\374w\204\377N\340\277\022\370/\004\376\013\302\177\031\360"
+	.ascii	"\337\017\376\353\301\1779\370o\320\177G\374W\203\377f\360_\001"
+	.ascii	"\374\027\203\377Z\360\337\017\377\335\360_\237\377b\370\357\316"
+	.ascii	"\177\203\177\245\300\377.\277\375o\353\377\013\374U\001\377\301"
+	.ascii	"\374u\204\337\256\370\253\007~\013\370[\257\337B\375\226\315"
+	.ascii	"o\325\374v\357\267i\376Z\377z\363\333\277\277N\375U\352\257]"
+	.ascii	"\277\365\373+\217\377f~\313\367[\017~\333\374-\336\177\265\337"
+	.ascii	"\226\371\355\335o\311\374\326\356\267c~+\346?\n\377M\370m\230"
+	.ascii	"\337\326\375\026\314o\213\374\326\305o[\374\226\305o\237\376"
+	.ascii	"j\345\257?\376\252\341\257<\177\335\371\253\316_s\376\212\363"
+	.ascii	"\327\013\377A\360_\356?\206\300\300\300\300?\317\375\030\272"
+	.ascii	"\376"
+	.ascii	"\007x\t{/3\331\030%\027\r\270\307m\262eK\021\213\357\323F\377"
+	.string	"?\263N\036\225yj\2359~\356\330a\352\331\373G^\363\324\252e8lL6\302\3276\225\361\253Z\031\257S\307\211u^U\346\271\303\t\317\353\334Q\247\\\020\3625\306\345/\004rlk\215\306\3679\323\367A\242w\252O\276O\226>k\234U\225\tt\332\370\322\024#\207\305\367\301\241O\260+P~`\005\312\367\251\241\357\003C\337\347I?C\240~\206?\375\fx\372\031\352\3643\310\351\017\352O\376\317\027\265\216I\025-4\027g\213\013e\334\374\232XL\266D;C{cqB\235\221\341B\007\310\342i\205\0313\216X\374\237O\347\n$TB\324,&\302c\306\356\252\207\305]\346.\035\231\336\227\333\237\255r\2629\364\306\334\255\271xy\265N+M\223\013\213\263\026\315.\270\357\272\270S\267L\352\002[PM2e\324x\355\275\354bGV&\326\274|]\232\270\317b\3412\017MP{S\r"
+	.string	"\354\355\313\355\357\312\375W\313\2267\036_n\177Ux\305\333n\231\324\206':\266\346M\323w\325\324\265\006\024\371r[r\263\024!\353\273h\350\2704\245\274a,Z \200\025\371r\023\203\321`5\347\306\201\247\023\266\303|\270\315\311\204\001\317%l\006\263\301g0\036\036\203\3770\031\254\207\363\316&\234\006\257\301w\330\0177\361\036.S\231\270\317\n9\006\203\353\272\334\272+\206\354\355\313\355o\213\025LG\227\326\334{y\331\3346\230\351\226I\215\240\205\245\271\367f\303\\\020"
+	.ascii	"\306\343\222\261_\327\314\036\b\262%/=\372p\223\315q\313\244"
+	.ascii	"D\240\273B\246\357\376\331%\267LJ\2575mi\342>-20\354\004\273"
+	.ascii	"}\360$u\363\202.\312M\203\373\356\032\273v\227n#hei\3364}6\314"
+	.ascii	"\242i\201`R\366\345\366w\273\364]0\200^\027\013\356\303a\352"
+	.ascii	"]\007o\365\306\023=2\020\3603\264i\f\313\372\223\255\262\372"
+	.ascii	"d\374\005\211$\217\007\230\227\271\373\2439\306\253\313\361\334"
+	.ascii	"\322\335\232\030-x\213\334\r\222\032ie\264\264\310\335\204\021"
+	.ascii	"c;\223\345X\356\372\351hA\210\305\367\253d\312\032m\026\343+"
+	.ascii	"\365\310\032>7\213\237\241\005\266\202\253\004\235\3228\341\202"
+	.ascii	"\343\216\253T&yth,\306p\230\212\366\222\261\264\202\312\220+"
+	.ascii	"r\200VSn\364\352\272tM\331*\302\306\304\342cX\243\241\\\246\023"
+	.ascii	"\230\305\3771[e\3426\374\004\210\003\334\206\315\260\224\235"
+	.ascii	"\264)D\244rv\2134oXJ\224\032#F\023\312b\274v\243\205F\r,\026"
+	.ascii	"\037C\024\375\343\264\312\304j x\030\241"
+	.string	"\262\370~\030\355\377\215\345\2523\243\306\342\037\243\0353\2456\363\206\305P\202yS_\234X|\fa\372\f?\261<\230\300LY|\fJ\3641l\351c\300\322\313\214e\203I\224\305\307@COa)\247'l^/\260T\007`{YV\177B\360W\026\023\254\004/\301ax\f\223a0\334\2442\261\0306r\013\004?a1|\004'\271eR\232\371\244K\023\213a\027L\276\262\254\376\3040\r\034\304\203\222\275,\253\277\026\030J\207\033\230\030f\201\241>`\242\263\327\243i$\003\006\201\221,yn\302\360]\241Y|\f/\364{\002\365{\370\364\217\277\216\213\210`\346\252\315b\257\013i0\310\312,~\217\030\215\211\340!8d\\\354<\213\337#\247\337c\305\007\006\202\177T&\016r+\234\203\211\027\016\202u`\256:\247\354\331[k\211\027\016\202k\340\033tc\315\020\227FXW\032\215\271\360\216Z7"
+	.ascii	"${YV]x\013\267P\231\230\013\3678\246\30230\027\326\252\315\273"
+	.ascii	"t\323/\236\b\t\302\\\030\013g\201@\362%\313\352/\204\005\223"
+	.ascii	"\243L\031\215\337\303\246\337s<\314\343y\030\210\226\252&\026"
+	.ascii	"\277\347\211~\217\230~\217\227~O\020\235\003W\325\273\235\245"
+	.ascii	"\236\335D\027\346\265\367\362\2522q\016\214\343\3268\233\222"
+	.ascii	"\205\361{\264\364{v\350\377XY\231\370\006\266q\022\036\210\341"
+	.ascii	"\033\270\252\336\355u\240dJ\226U\305\273C\242\003\343\363\240"
+	.ascii	"\321\3471\243\317\023F\237G\213\256\313\372\223\201\252O>O\234"
+	.ascii	"\3062\2240\252,->\317\231\3060p\324\361\020\340\267\264F\211"
+	.ascii	"cT&\206\201f\355\256\304\276`|\236\035\372<J}\236)}\236\027\372"
+	.ascii	"\307P\365\216nKT\223\305\347Y\241\317]\177\362w\002\365w\316"
+	.ascii	"\350\357\344a&\274\224\343\306\346\251\312\342\013x\003+\363"
+	.ascii	"qx\3378-\267\231\017+K>,\376N\030\255b\357\275\353\343r\360q"
+	.ascii	"\371;p\272z\241\351\357\210\351\272\254>\371;_~\367\314]\262"
+	.ascii	"a\371\322\303oG\251w\367p\264\352\322\274,\376\216\013=\035@"
+	.ascii	"=\267\203\303\242Mk\315\342\3534\365\355\350\364u\334tu\253>"
+	.ascii	"\371\177\365'_gy\303\340\252-[C,\276\316\022}\235\037\372:R\367"
+	.ascii	"\313\334\220*l\026_g\351z\311\351\323u\256\372\344\347\320\351"
+	.ascii	"\347\300i\333\254?\3719h\332J]\331q\343\212\017\213\203\250\\"
+	.ascii	"$\227\255\316\241\341+cM%\225K\344~yh\202\"\341\217\254\271\367"
+	.ascii	"\222\312\035\362\270:\207f\342\013m\312\205\273q\267\312\265"
+	.ascii	"r\337*\363R\271nT\256\020\233\243\316\241\341$i\315 j^{//\225"
+	.ascii	"\333\306|\243\223\372\333{\031\302\356M\001\316\355\340\347\270"
+	.ascii	"\320\307\001\324F\356\221+\345\006\231\242\353bq\224\235\245"
+	.ascii	"T\2273\026\037\307\214\016\022\303\003\313\363B\273g\367\311"
+	.ascii	"e^"
+	.string	"\265\353\344B\271k\267\354\232U\346M\273d[\226f\304\226\214\345\0051\301\263[\222p\311k\216%\301k*\251^U\362\302\336\266s\263\367\025&n7\3556y\333\216\323r\007\t\342\275\215U\001\342\221\242\204\313i\003>N\024}\234&\3728a\3728J\364q\216\350\343\024\321\307\031\242\217\003D\037\247K\037gK\037'K\037G\251\203\313\372\223\377w\277\212\334LQ\033#\323%\207\312\330\036\273^UJ\207 \325\234\025\026\026\037\347I\377\002\031\375\013S\364/\234\351\377\002\271\\Sv}i,Vr\331\253\332\3349\367\3062\343u\271,\326\315Z\002!\317\352\310_\325\345\2626H\244\261:\322u[\270?\256\217\312\274\\W\353\267\307\335\262\312\313e\255l\216\035\247\345^J\300\337\326\351\322\204{q\001_\330\365'W,2}y\234WH\270\360Y\374\013I4\330UZ5\273V\347\272\366\236\352"
+	.string	"N\357\313\355\017\210\375\342!\305\212\325\242\005\002\256\354\313\315\362\350a\267\352\234r3-u\020\347\005,\314\242\3352\251\233\030g][\270\274\255\316\241\355\025e\b\200+\362\345\366\007$\210-\222uA\\\221/\267? \277Jk\304.\251sh\233\211j\203\270\251/\267\277Ku\257\356\214k\343Z\335\035\367\306\315q\261.\215[\343\352\2708nUe^\245m\273\325aw\324/\265\256\316)\367\222\336"
+	.ascii	"\342\312\224\326\313m\361\301\223T\005\266n4\255\024\245e\263"
+	.ascii	"U>x\222\272\211qv\305\301o\301\256\322F\251\315:\327\265\231"
+	.ascii	"\226>\200\363\362\345\346\001\t\017\256\322\266`\177\334\245"
+	.ascii	"W\020\312\231\020\313Cy]\334\251\031\003\210\323\373r\373\013"
+	.ascii	"\241\363\307doU\200\245\216\254 ;b\361o\330\350\3777Fe^\031\367"
+	.ascii	"\205\323\225q\243.\214:\207\266\367\024\002\300x\020\241\252"
+	.ascii	"8\344"
+	.ascii	"\232\272`|a\3746\313j\331\034\366\306m\f\025\022\213\177\323"
+	.ascii	"E\377fM\377FL_\250\016<=\270\230\352,\376M\020\375\305\326\335"
+	.ascii	"\245\227\bM1\232N\227\305]Q\231\367\351\367\311\206\261j>x\222"
+	.ascii	"\302@\023\214"
+	.string	"\373t\233\256\305C\023\324f\342\261A\2214\\{\177{\357\020\035B\204\300P\272\260\354\320\370ZO\277\266\355u\250s]\021\370Z#C\003\326\264j\254\030\253\347\241\t\312\002W\242\324\275\276\307\355\334\354\235\205\346%v&\254\331\304\017D\235C3\341&\326\334{\251\306\376=n\307\251g;\rY\322\254{j,_\207]M<l\2213\0313\232,>\006]VVA\035@XK}A4\242~x\325\025+\300d\004u\004\257vZ\230r\266\344*G\013ZC\204d\321K\343dq\020\207%K\323\021\244OO\306e\004\225\325\311\226\301\001\323\030\227%:av.Z\330xP\251\266u\244\213\305\301\031\301\252\033\035KP\266\252j\240\021s\003\354\261\334nm\264H\005i\23492\237\235\0209\213\357\027\244\372\223\303\221$H\025\234\302\233[\202D\252J\233\337\030\251\373\002\233\205\251\211q{z\n\302"
+	.string	"j\3626VE3\325r\340\bF=\b\303IT\2264\026\007\241\202/\376\337\360XiA\326\346E\320\305[\217.\246(9lp\354\211\t\266\270dG\262\302\346,\016\262x\333\025'R\232bNN\026N\303\231\250\254)\347\033\2227!\026\377\202\246\340\016\356 Su\262e"
+	.ascii	"\275i\005V\375\355\255\004\201s\306\005\037Tp\351A&LG\026\306"
+	.ascii	".\311\377\233\314E\006\0335\026\337\202+\200\200\326\005\210"
+	.ascii	"\236\355Tw\345\266\245\224\007\260X\256\230\242X|\013\310\340"
+	.ascii	"\236\347l\027;W\231\031.\263\tj\332Lc \336r\034\200\007\210\222"
+	.ascii	"(!\026\257\t2\211\t\203\305\342[\360\245_\305\274\344/e2\335"
+	.ascii	"]\230lW\347\272\"\220\244\013\256\302P\036\232\240H\020#\323"
+	.ascii	"\334{\231\3732\231\254\307\366\327\314}\271\316\356LV\223\323"
+	.ascii	"d4\231/\373\345\277\312\314}yL\356\313`\" 6\246\271\367\222\247"
+	.ascii	"\217\t\323F\017\316^\216\347\241\t\212\204\261\274\334\314{\225"
+	.ascii	"\231\365\236\365\260Y6C\205#\205O\r\233\016!t\366\300\330\341"
+	.ascii	"\310\370\317f\236\363\242,\271\370,\316xA\245\r\271\025\026\337"
+	.ascii	"\002*\375\347\273\312\314e\264\337\222\2675\026\337\357x\377"
+	.ascii	"op\254\374\320\342b\361-\210\322\257 0\213\321u\315\2534\372"
+	.ascii	"\025\370\351W\220\247_\301\030\375\n\300\350?\177\301PfY\372"
+	.ascii	"\270X\374\n\346t\326\222\271\344.\377\rO\230[\013k\026\277\202"
+	.ascii	"+\372y\313\377\233\013\374\350\262f"
+	.string	"1\256\217\3139\313\263\334\177c\345\210x\301\260\370\025\300\351\347+\031\313\177\263c7$\255\314\342W\260\246\237\255\374\2779\327\002\373nX\234\253\350\247\n\232dp\341\212m\007\216L\345\271\312\237\343.\236\375\301B`\0334\026\353T\237lo\004=S\301\341R\245If\361+\300z{\3131zv\223\031@\257\255T\202\310\021\302\024b\304\342W\320$EJn\353\0208\003'\207\2213k2\333s\333\035\035\333\231\373\305Dk\313\214\274\2655# \220\001\202\266\226\226V\353\252\223-\003\005- \315%;V\0341c\361?l\351?3\231\231Y\353\200\260\226\3646\200{\242\353\300~HY\374\017PfL\362\231\214\030\037\236\364?0\225e&\331\211e\322\333MO\221\241l\356\351{\230\323\257`5\217e&\231\314\256\341\335\2657U\220\036\337>\300=L\321\367\340D\377Y\214\231\305j\023\004\026\023\323"
+	.string	"\340f"
+	.string	"i\376\355}\345"
+	.string	"\230\213\214\265+\213\357AH\330\303r\f\245\003\332\242\232\312\035dO,\276\207'\375g%9I^\202\231\352~\222\252"
+	.string	"\214(\315-%u\200{p\322\367\260\221 \3111t\007,Z;g\250\334\215\371b\304H\236\"\341'\316\210\225\343k\212\263\370\024\244\025)\222\253:\300\321](r\245\307\n\213O\001\022\375g\"\257\314L\344\f\004\201\265\251:\340\203\313\002\f\224\301\326\303\342S\240\245\377\354\2432\263\217,\304:\331K;wY_r\250\304\250\230Y\234\205\374\371G\006\222\203Tl\343I\007\233\305^:W\242\326\374Y\\\347\352O\366P}\362)x\332\332\312\\\372GS\221\231\372\312-<se3.\250\304X|\277\332\374\177\203\311\214([\260\370"
+	.string	""
+	.string	"\324\177\326\312Zg\233\033\250\275g\\\240\304\310\r\215@\346\0302<x\344\252\016J\340\2004\377\226j=\304,>"
+	.string	"\344\364\237w0\363\016K\243:\331K'\244\275\030\253V\366\212pYS*\363\225\206\343\303O~5\346r\216\347\2533\307\030$R,\31672\216\340\r?6%\031G\266\252v\3154]\227G\031\271:&\026\337\357\324\373\177s\373v@\261RV\243F\256\322@L\370.\016'E\246T\235_\216\fQ\263\370"
+	.string	"\340\322\177\236Q\231y\206u\221\201\275[\300\201\2007> \315\277-\245<\300\325\303\222\362\304\342\003 JJ*O\221\240\201\211V\345\212\361Veq\236*bD+\nM\213\0269\206^R"
+	.string	"\034\220\346\222\255T\2028\255\330L\341\203\361\034\203\207\305\031)\266\250\312t\026\243\031\365\302\002L,|v)\352\356\213\232\354\242\242\271Hfhy\262\370\035\346\364\363\316K\317Lg\312,\364\336{i\271e"
+	.string	"\221=\001\322\374\333J%\b\f.j\210\345\247g\026U>\374\362\212\37779h\344\256fX\234\235^()c\303\266\320\361\213\372\212\312MUO\347U\355\260\370\035\254\364_o\377\274\231\244\366\336T\347rK5\345\344\277\276\236\265\202\370u\352\255\001\370\217\367\026A\n\313\375D\005\314\336\273\366i#mL8.\330\377\017b\357\245\272\367\226\2022\313Z\302"
+	.ascii	"e\306\264\241\316\346\2460@\231eMA-7\017\016\333\254\307\206"
+	.ascii	"Zb-a\254\245\275\367\222\335\313\355\2245\265\235\260\226\220"
+	.ascii	"\240\226[j/\261\226z\266\323T\017\324\222i\t\312,k\252B\231a"
+	.ascii	"MA\231aMa\330N{i;1\361\320NXSPZ\260\246z\240\314\230\246\240"
+	.ascii	"\234\262\246\352\022kW/p\313\254\245\247m\306\244\263\367\216"
+	.ascii	"Zz-\345\354\315$\265\227\276X\030;\253\tc\353\330u\016l\331c"
+	.ascii	"\357\275\204f\247\205u\263l\332sPG\260\212\236\366\266\3330:"
+	.ascii	"X\252K\313\2757\213\335\264T\367~ZJ\355\335\204\025\002\345\336"
+	.ascii	"{cU0,\244\266\316vb\212j\322\302\312yj\302b\261\217\360\250{"
+	.ascii	"\357=\005e\246\205\025\364\006\305\314k7-\227*T\024\326\366\332"
+	.ascii	"vYR\332liY\371t\314\200(\243,\006\274\312\2572<\213\017\304F"
+	.ascii	"\237l\320\330\334\bb\361\201\302,q\334t\244\321\260x\251\233"
+	.ascii	"\252\276\274Y\214\346\374\2636^|QaA\343\367\312<\375N> '{\t\004"
+	.ascii	"6\312\003X%\026&+\213\017\024\247\377\263\357\344\253\"2\207"
+	.ascii	"\305\342s\017\307\2355\211\264\235\315\013\373E\230\231\305\007"
+	.ascii	"\n;\315\344\335,#\300\0376\360\266\216kseJ\231\333\265\253+\177"
+	.ascii	"w\035\202J\336v\264@\346\034S\327\326\316\232\214\251s\027nH"
+	.ascii	"\331\340\262\303L\366\314\005\223\r1Y\202D\250T\211\013c\223"
+	.ascii	"\234O\262\2041\325]Y{\003\313b\3619(\253k"
+	.string	"[ygd\232\313-3M\236\224i\236jYn^\235\026\273\345\210\230\033vF\2236^{/\307\326x\325=%0\240\3305\353\036\231\232\346\224\223\313I\345\214r\312\235VN\270\263\312\351vn9\265\234X\316/'\230\223\355\364r\276\235tg\226S\312\331vv9\343\316\271\312<\257\234kuo\t\213\027^L\240\232iur^H\224u/\214\351\242\271\305\b\227U\363\0043\273k\356\275\254{bu\r\320\313\037\204\266\265\245y\345\234\324\346\n\274\363\312\311\3542\346\257{W\316$\365n\004|Y\200K\366^\352\224\325\360\261E\002\037\210J\237\203\236>\207.\372\034\340\3649\220\351s"
+	.ascii	"\242\317\241J\177C\033\375\rv\372\033\332\3647\220\351o(\242"
+	.ascii	"\277!K\177\303\f\375\rK\372?y\372?U\364\177\312\364\335\352O"
+	.ascii	"\376O\020\375\237\032\372?,\3645\364\351k\330\242\257\201\211"
+	.ascii	"\376\317\257\237E\306Vx\235\261\330ky\005\215\332\n\213\257\241"
+	.ascii	"K\337\203\031hM\037'\216s\253\316ua.m\315\275\367\317(\030ld"
+	.ascii	"R\365n\315\313\324\025\243\346EU\357v\356\336:\322\316!\247\220"
+	.ascii	"\263\205\263\353\fr\0029\177\234DN\256\312<}\2347~Z]\271[;C\006"
+	.ascii	"\baQ\2324Ne"
+	.string	"\235S\202\260\204,\350\364q\306\270b\202>\246|\031\373\013i\022\211\032\021\225\214\206\306\242\bF\f$\213\004\020J\321\344\207\027\211\030q,r\310#\210\212CF\245\241bz\274\200\220\261D\212a\322\347E\"\210\214Ed\232\334`d\224d4\036\215\301T\210\262PL\346\025\216\310\242\364h\f\016\rQ#\234\242\311#\364(\247@M\274\310\004\244\b'\204\214\212I(.\020\341\004\013\244Ec\t>/\022\201\2520\034\nQ\002Ua8\244\363\"\021D\344\b\342\220\005)\212\302\005%\244c\b@\351\213D\020!\215 B\362!\032\223p\316\244\220\b)'\025\032\211\220N#\021\322-J\211\214\250QFY(&\261\022\322\221\210\221)\322\025B\203Bh2\t'\203G\n\211\220D\350(!\323d\221\b=1\3640L\215P\023%\224\214\220\220\206\036\320\244\206\243#\362\204\tL\340\230\242)\206(\004"
+	.string	"5\036M\020"
+	.string	"MQL\211%\214\307\020\210\304\022\036P\324\rD\240\270<A\"\216\212\310\024P#\"\343\020\203\016\t\021Bh\212aR\310\243\241\204\261\204\002\f+\007\"\206\227H,q\204<\016!Q\244\017\311\022\210\304!\220\361XL\221\303\024\005\"q\350\203Ai\210D\226\360\020\364I\016w\222B\250\020OJD\323\233\023D\342\260\303\021\232&\225P"
+	.string	"\200\020jDQ\t$\207$\020\211C\r'R4\211\"7\234(4\212\220\242I\364\004\021\322\207\023\213H\324\210\022\351w\220"
+	.ascii	"\r\022\360\201\212`\232\242BT\350h\002\022EBQ\0249D\342\360\246"
+	.ascii	"\032^$\342\210T\"J!\305\321\204\0130\240\311$\3411\305\tb\241"
+	.ascii	"HH,\246\3034)$1\204d\344\023\024DB\310B\221\006\022\302\241\241"
+	.ascii	"c\232D\024\026\021\323\243Q\230\016\035\223@+\f\225\204)\232"
+	.ascii	"\034\032:\362\250@D\213\210:A(\222R*$\261\243\204DS\034\211("
+	.ascii	"\022\203\220\321\261(\211\"\213R\341\nC\245\fI&\214\307\0208"
+	.ascii	"\260P$4\026Y(\022\252\030\036iH\026U\f\205DI(P\241\rBh\362\210"
+	.ascii	"\244\002\025\032\225\204\204ACHF\302\rH\264h\204TL\215\222\216"
+	.ascii	"\204B!\2648T4B:*&1H_$\"\005*tD*\021\215 B\002J_$\"5\242GIB\f"
+	.ascii	"%\216\216i2\211\310\223U\240B\306\342\031L&I\240\210\224\314"
+	.ascii	"D\303\024\214IbN&I\200H\242\230K\020I\024/\240\301\324\210\036"
+	.ascii	"\335\374\f\323\241\t\241!z\342\210T\032\241\203Q\004\235\027"
+	.ascii	"\211(\246*P$j$d\034\222"
+	.string	"PLU\240>\251q\310&\205D\364D\b\305T\005\212\241\230\252@qJ\202\003\"d\t\025\210C\024FFC\"N2U\201\342\244B\224XL\201\232H&\241\300I&\241\270Ia\021\t\205T\005\252\205P\024)y\246B\f\224\200\215\305\023\214IbF\211\204&@d,\n\rQ#\234\"R\362&\205!\220(!U\201j\"\211\342}\221\210d\022\212\016I\241\t\251\nT'\231D\221BB\303 \232bh\204B\022\322\221N\022\242HJ)$\223P\334\250Ha\b5\201\")\245\220\026\215%\bK\230`\202\347E\",\220B\t(\214HQ\"\3440\275 M\242)Vq\242\204\t&\320dR\036J\222\200\212\364\034J\222\200\n\344\211\032\r\211\311\363\210D;pD*\021\351`*$\301Aj,\006\223I\307b\n\024yB\206#R\211\350\002\212LJ\207H\024\351\bMqP!\013$T"
+	.string	"M\207'P\241N\t'\240\200\n\035M8\"\225\210p\216H%\"\235!$\243\234!$#!\013E*\220\340@\230!\211tD\232@\242B\305\024E\023IHG<\251\220h\230\302\261\030$\032\246PLUL 5\226\220\204t\244sD\236\260\302\321h\b\211\246\300@\262\003*\334!!\347\210T\"\352A\201H\034\362\020\231 \022\207\027^\224AR\210\036\025Sc\322\t\026HH\223B\030B\262"
+	.string	"\2218\304I_$b\210\202\264\210\250\210\256\220\223B\241a\322\b\212(v6@a\203PX\022(l\320\320\222\030\332 \025\226\204\n\033\244dI(Y$\232\032\025E \022\2077\030Rc\3221\004\n\222\251\021=B\221I\311!j\202\020\232\016\215\222\216\222\210\304!\207\022D\306\234\244\220H\034\236\351\213D\020 }\221\210dQ:<\032a<\036\035\035\211"
+	.ascii	"8\252I\241\020i\310GE\021\231\016MH\217\310\235\224G\030|\221"
+	.ascii	"\210\224\230\204L\223$\222B\025h\232t\204A\005\342\321H(\314"
+	.ascii	"\2511\351H\024\n\203H\324\270\302Q(\f&\221h2\311(\024j!cQ\005"
+	.ascii	"\2410'\215E\244\244P\0304B\205\302\233T\230&\213F=/\022\221D"
+	.ascii	"\221\224R\r\204P\344\260(\251\301\210dZD1\"\311H\244\201\212"
+	.ascii	"$c\321H\203\016\022 L\300\007*F\240BIFDcq\0042\2314b\001\251"
+	.ascii	"\n\324h44\"\321\324X\024\n\rQdQ\212$\024rH\201\"\221\204\302"
+	.ascii	"\234&\213FBa\036\246C!\2410\243,\024\223BaV\201x4\302D\024)\034"
+	.ascii	"!(-\032K0\212\220\026\215\305\214LO \032\223D\020\032\242'\210"
+	.ascii	"\304\022\032\210\304\2416\212 4D\221y\204 !\2218\314+\fO\204"
+	.ascii	"`\242DN_$\"\t\351HxD*\021\241)\212H!\003\240\302\023\033x\260"
+	.ascii	"A\002\222\220\216|\214\307b\232dtL\242\310\013I\241\006T\210"
+	.ascii	"B\022\322\021NN\215\222\222\350\t\343\261\230\022\321\0245\221"
+	.ascii	"\204t\224\001\025\032\211\212FC\341\216\221\250hT\202H\034j%"
+	.ascii	"\241!zb\230\016\205n\322\2440\005j\342\210T\"\2729\"\225\210"
+	.ascii	"0rXD\304\250\3201\004\343\261\230,\246@\2219H\324\310\2508\224"
+	.ascii	"S\240B\227\005\022\320tx\0025B:\032&sB0Q\202H\034f\224h\304@"
+	.ascii	"\232\034\242\026HK\b\241\351P\bI\003F(\221X\"Y\354\220\016\241"
+	.ascii	"B\302\224\303\213D\004 \231$,\"\246\305\023\204\214%\214\214"
+	.ascii	"\216H\237\fI!Qq\310x\f\001\211\246\350\321Q"
+	.string	"\263P$\034B2\022\022\211\303\013\251\360\203\324XL\n\242\310\341\nB\310\241\321\361(\001\341\211L\016\t\213\210\212EB\"q\230\223\016\241B\035^$\342\303\217H(rDz<\"G\340\b\241)j\204tt\f\001E\321hH\324\220\244\300\310\350\210\304E\304\264\210t\2560T\272I4\311h\230\"'\t\223GEd\nIb\361hhT2\221\026\021\025\215\206~Ra\002\202Rc1\370\240\240\020.\320\300\005F\320D\021i\321X\024\032\217\305t\210D\215P\"q8\"\211<&\215hr\204\2618<\032AD&G\210(\300\nC\344=\"\321\016\020\211\303\340\377\240\034\330\005(J\356\320\262\324\246\215\025k\326,\016Z\t^y\020\313\203Xl\020\313\r\f\314M\30003\016\306\005\343\362\024\tK\325\n\034\220\346\022\0014\301\301\345\251\233 +M[\202oo\271\252n\251\275\301\340\244@<"
+	.string	"d\372\017\272\345*\234v\243K+\007\013KX\210\260\345\253\333\314\003\253\223r\247\306\302\304\226Q\224/\242\374\255\235\201d\246\354)\213\22792d"
+	.string	"\301J\023\302\305#\212\305K\261\275\227;9I\020\026oL\035xI\263E\030\024\036y\013\310\323\322\231\221\2359\262@\037A\263\340\223(p2\256\330e\016__\034\025'0\240|y\002+;\333\330]i\303Z^)l}U\302\354R\203RI\214\340X\220\t\233\225I\323&\330$\263H\023x\265f\271\243\206N\006\032ku\224\224\315\240a\261\022%A\260\352d\313\bJE\031\321a\255\370\270\374X\362 \330\005\300'\275\2654\377o6 \003d\210\305\017"
+	.ascii	"\026\222\037I\256\002\302Z:\223\255\242\276\224\177L\304\300"
+	.string	"h\263\370\0304\265\036\344\322\n\032\271a\352r+\261\226\364\026\260&j\310\336\337\206R\202\300){Q\346e\310\203F\036\374\"\341\301\361\226$\t\303dq\260\310w\224[\2464-~\220H\320\353\277\271`d\313L\211\305\307\340M_\003'USS\026\007\205\034\357\b^\224\236\305\301 \217S\212\371\343\n\002\341\242E\327dq\260+\350\2432/\027\374\361%\317\316\024\026ir\026\037\0035\375z\271|\202z\271\034\334z\260\205\377\346f\212\216\255,\213\217\201\023\375\007{\3747A\26508\274,>\006M\3641H\202u\254 \017 \275\305\226\24051\026\247\205\327\250s\242\023z<\254\345 \214\304\230bH)\022\032N\213\0013\025@ XP\"\022\f\206U\357\001\023\200C\013\313\344\211\240g\035C22\"\"\222\244\250$\231\016\030\247\2265\223\212'\215\276\275\300\245\003\fM\216\007\214Bed"
+	.string	"\222\220\240\231$]Z\222\372\030\335\213p\236DSu\360;6r\213Z\331\277\372\371]>\257\322\201\025\227\243\017\245\241@Q\031i\266T\274\256d\353\266\026\217w8\021\02276\241M\204\323b\261\220.\360\276G^E\272\204\346\002`\032\250Y\333\260V#J\006\264\325\376\377\234["
+	.string	"\365\276a\316\364\251\260p\377\006\304\207\031\"'*"
+	.string	"_\336\270\0332\331\346\341yt\004\321\350\332Z\324R:\005N\360\247\334\202Cu\237\244R\372I\251\330\253\"D7\362\302\236\230\r\375\200\001\370 A(=\210\207B\t\205\b7Nc\026f3\255>\260Lxg\020\352ME\3536W\357\324\026>-_NOl\346m\026\275\0319\0230\301BUos\031\232-\n\322M\020\3064\2631\004\241G\006R'm\316\254\230>\027\361\375g0\246\rA"
+	.ascii	"\262(c\366I\336s%\234L\312\355\315\256\r/\314\252j\351\200\034"
+	.ascii	".\033\031$\365\01383\300-\236\267\363\nr\032\366\232\325\253"
+	.ascii	"\235D\265\333\210\375s\303\027\034\0209e\buxK\263\323\210\216"
+	.ascii	"4,\227\"\225\342= \234\264h\367!\304\017W\251x\271\027\266\326"
+	.ascii	"\241\347\3722\\\211\312\232X\312\213\037\256\273+\\\205\267_"
+	.ascii	"\001 e\304\314\r\343@cv\304\213^?2\336X\363\224\360\231\026\211"
+	.ascii	"\374\322=\212\200\310\341\223d\207t,-F\213\316';\273\017B.\033"
+	.ascii	"F\3309)\315y\177\b\364\324\370>\341\243\341\360\177\003\242+"
+	.ascii	"\310(K\tN\316\n\017\265\364\005I\034\334\376\260W\241U\207\f"
+	.ascii	"\255*o\032\234D\205\337 R\027i\306\205\207+\346\004\270\214="
+	.ascii	"\254\374\330M\221.\032X\350o\0209[\356A\247\016\263\002\310^"
+	.ascii	"\233h\242\372\201\346fe1\375\261\347<\001\274U\33692\027@\320"
+	.ascii	"\260\350g\222)\207\256@x\273\250\300\334\201a\201\372A\234\352"
+	.ascii	"B\363\365\362\220{\264b$B\272o\254\270m\022\364|H*\345\024=\275"
+	.ascii	"\207\326\326\364y\0049\221\n\272u\253\374Y\030om\375xO\035Y\310"
+	.ascii	"\021\316?\033\362\333)a\232c"
+	.string	"\021\fI\307\305\030/\026<\325\221\260\371^\260*\214d_\231y\373\345\306\276_i8\302o\210\337\244\262\346O\275rh\35388\226\313VH\345\227\017d?jdjv\351\306\325\215\201\256\344\fN7\310\356\274'\254\216w\363;UFK\372\353\326\027(\264\242lg\031[@\300\353\343\251\265\023\262-\021'\036=\201\316-\311nK\344Z+#\027i\005+\013\357\265\266\003\3606\217\022\001\241'\311\333\261\214\250\0206:\206Q\343_\366LOT\266#H\202N\324/\335\364o\335\0323\305\207e\317\006\275\362\341<L\006\032\367.\261\362_O\373\013\371\231J\346!G\202p\005\255\247\315\367\377\244\250\250M\205\333\260\013\315\317\252c\270\240\\}\273\020\200\214\246\271\327\346\271^\251Mm\361\245=1\313Y\276\354\001\351\264J#\r\030\253l\262+b*0c4W3\375\r\370[\\\275\323\254\326\220\216"
+	.string	"\f\3616^\246\351\242\"1\221\013?:)\264\311L\201S\0052 Fo\021\032F\272C\006\203e\311\024\270js|\330(+>\313\331\243k\016\004d\236lF\203\305\235&\024"
+	.string	"\356\357\275,\345\315\022lk\235e\321\211iK\177\252\032L\252\f\214!\006\225\333ih4\243\005n\300\\\r\b\353\327\345\235\222\256\344\226\027\272p\017+\002\314~\327|\016\374w0\300w\377\343\301\211\3518\302\240t\005\303\241Z\033Xz\232y\330\241v\361'\030\261H\205\030\220\253\216\276W\020\3350\223\270\305\272@\224\277d\313~\221/OX#\306\250\002\314\243\216\0072\312{\201\206[W\256c\312v\213\324\365,\245h!"
+	.string	"\203\271\300\b\331 [\214C\224\322N\264\227\312u\241\313\026\264\001\350\251\033k\022d)p?\226\332\b\364\225\025\221\327%u\032j\255\342\201\215\020\022.\177h@\200\362[\316\357xh\023\311\330\374$\005\025\224\3158\211\200*\304~)\004\371\230\034\306j\310\r\270R\234\213b\306\220\375\n\340\215PDQ\032\373[\237\252[(G@\301P\232\254P0[\264g\325\006\202\376\351"
+	.ascii	"\224\363{\002,\273V.x\2734\346TC/\312\303\224\025l\033o\027\302"
+	.ascii	"\t\312Sl\\\347\301(G\264\263\331\231\261\242\217F\342[q\022\r"
+	.ascii	"\267O\254&\344\031\027;\251\237\246\"\267\262I\240\217\321\300"
+	.ascii	"\0072C6zKi\025\032\225+\3316`+\346\312\204\3605\"\031\255\210"
+	.ascii	"\235\254\f\037d\201*\376\246\343\265/\245\265\212\323\017l?\017"
+	.ascii	"Hip\203\222"
+	.ascii	"\371\217\252\331:\231L\227\251\302\342ry\021V\272\242\207|\367"
+	.ascii	"\321\231\205=\252\336D\255\213\037d=\215\005aH\t\263\3215z\352"
+	.ascii	"\374\"\026\334\267I\201\242\206R-\242v.\001\027\024\022\330\246"
+	.ascii	"\212J\n/\364&\0279\232@\3705gV\030\256\031\035e\375\276q\234"
+	.ascii	"#2]\377\363\272+\301Mf\035o?\334\204\332\013\034\177\030\007"
+	.ascii	"\257\325\375\223z\206P\372\240\217\017@+\373\265\204W\346A\r"
+	.ascii	"\006\230U\345\355T\216\272\005WE\364w&b\357\373\373\313\375\201"
+	.ascii	"/\022)\273X\227\332\202\3365\243=)sz\034P\037\n\3123\347bcI\274"
+	.ascii	"e\227T\377\335\020,\225\363u\221d\2350*`\203,\331\260?`\347\202"
+	.ascii	"\253R-\r\2338\031\327\004\335^\351\025j\241\177\367@2\034t\343"
+	.ascii	"\273\267r\016\262\200\r7\267\025\221!\273\366\316\031|\222\313"
+	.ascii	"\262\222\264\201\205\003\374\227\2102\311\354\027\222$\253:\232"
+	.ascii	"\356\003\037k\343x]J\020\233 \256l\353\365\304_\252\232\314\307"
+	.ascii	"\211cU\006\353\306\3066\265\205\346\325\276}\013\352\355\332"
+	.ascii	"\246I\2521\334\251\357\271\021Z\005\236\335\201\241T>S\236oP"
+	.ascii	"\0160\227\002\213\246VC\311=\325\232h\002`f\301\334\335[v\217"
+	.ascii	"\371\002R\302\r\271S\214\307M\264\223\303\351S]\373E\354f>\020"
+	.ascii	"\235\356t\255\201\\d\300&p\241\331\202\336\207\001s\361GVe'\026"
+	.ascii	"\013\f\215\200\207a\177D.y\365NZ@%3|\316\232\245\375\202=\306"
+	.ascii	"\255 \256\326d\033\200w\206\fm\263\217d\320\016\346|\305\020"
+	.ascii	"\234\202q\272x\2615\331\354\257\241\346LS\354 \"\246\234\241"
+	.ascii	"\326!\325\006\0135\003h\277Pt66\251\030'}\366\204dP\205#\201"
+	.ascii	"\227\252\224\316?Cz\005\307|>|\002\215\232\362\243\352G\243~"
+	.ascii	"\302\0036\206S\303\333\003\302\260\324wh\233\241\262\2202\220"
+	.ascii	"L(b,\311\2468\245(U#O\272J\324\311\250\016\214&\345\340B\216"
+	.ascii	"b\237Nq\360\306\016c\317p\304\251\345\007\357\307\211L\036\n"
+	.ascii	"ebR+\210\226K\222\276{\376\300\341n\304wFt\302\206\234~\270\b"
+	.ascii	"5\334\316\224\212\221)\315r7\266\303\333\205x\336\240U\3620D"
+	.ascii	"\265\224x\301\026\\\022JD\016!/\301\364\266\336\352!\314\311"
+	.ascii	"\333\221\226'\323\003\263#\233\244\367\257A\270<\244\201\242"
+	.ascii	"\303"
+	.string	"~\343Z\205\232\360\315~\275\203\310A\326X\f\343\210\001\234\r\276RR8\233c\307G},g\354%\271)\364\300\210{8\246\224h\333NqxIp\216\304\244\340d\024\231\221\354\005\276I\212\267\031k\003eO\213]{\035\366\006h@P1_\007\365\022\217\276\321h]kT\025W!\013\335?\311\222\254\233F\360Y\3246H\242\220w\317R\350\240\327\320\312\032\356\005\030\244\001\023I\036\372\032\313\033#=(\241\304B\333~W1\214(kf\273V\236\321H\207\2240\177y\2157\202M\276\251\343i\250\246\217\216A;\t\317{P\210\320c\027#\3239\232\217\263\b\020\002\211\0047\f\346\231\027\220G\212\271\024\037\316\346\242\362U5\343w\210n\306Q\033\302\245\001\307\204U\177\264\327\341\314\376/,\362\024`Y\021y\035y@\315\350*\316!\206\350\326\247\b\355\305\265\333d@\024\221Z\311<k\331\267"
+	.ascii	"\373Y+XV\234h*T\236\274\233@\272\353\370\bf\307\312\017\0379"
+	.ascii	"`\360u\321\377\365)\034\354\022\312\322\315\3105O\371zhiD,\342"
+	.ascii	"q\207\247\346\323\343\233\3148\211]A}\215=\274^J2\216\362\270"
+	.ascii	"\375USmCU\303\366\376\340Q.\253e\337\270"
+	.string	"S\270\363R\306O\034_\\\255;\273\177\256\211\226bE\"5\033\030\352\315\374o\274]\203\r\206[\310\3368A\223\2334!.\f[,\035\006;nh\313\001\021x\225|\242\001\351E>4kj;\230[a\2270\263\307\337\226\366\306\355\271d\266\324\236\317\276(2\241\247\250\206\223\004\274\311\237r\346\025\340R\035\376%\021K\376\232\262\372\375\033_\233G\270>\177\031\203q\325\250\227[\201\231X\221t|iO\242\244\200z\2763\221@\351\216_\3645\237\326\265z\303\016Z\331\310\036e;\n\034\210\367\030V\226a\273t\2069\253\007\213A\275\214f\223@\211\355\313\264 Kr~\216\252\301\023\271?J~\177\267\b\256\t\026$\021\240\363R\177C\330 }M\214\362gNFQ\311-5\030\202\266B\305\t*\250u\241\331\001\274\b!\366N'\355\210:\nO\243\300\034\245]\233]\205Np\223\b\260\376"
+	.string	"\206\230\302\3700l\2163\253\202>*\330y\320N\313lxy0\224.&o\313\031\201\255Wu\253g\355\371\215\377\351$\275j\324;\253\377-\304\357O}\020Y\177\201\t\325#\307\t2'\241\217\036\235\200\201l\251\271\266O\204mt\246\267\264\240)\223\003Z-\216\005<\351tQK\377\324.\273h\300\002\355O!Af\036?\334\334\322\301\366\260`\265\303\352\316u\240\204?\323\364\315\300\031\332\007\b76\013\255\305\030\354\370\311\265\361\373L\207WU\335\306\320\330\b\212\307\205\207\0048\253\246f_`\354\374i\3773\217\205i\264\300\026\363}\204-\bJ5\342nD+F\032\375NJ&\342\026h\221v\260\036\031\324\330\322\260N\334PY\027Nu\341\377\344\3371Y"
+	.string	"\216\214u\322\360\307\241\361'\360\350\375q\026\210p\301\255;x\377\b\226\007{\033\333\350Ep[(\366\340\361\231@\212/\302\205\272l1Ji\312Q\310\240@\024V1\244Iy\267\237T=G\023{?\370\020\355Vg0B\206\244\317\3715\037\365\222\356x\026"
+	.string	"\035\272\337J3~\324`\240K\203]2\345-\227L\320\353@\216B\363\276*\250KLF\025\"\362\214\004\177\376L\221\022jP\007\207|\232\"8\200\303\311#sj\367\323\300\373\221(\254t=V\330O\365@I\370\367\306J\343\301h#\216\233~}\364\324\262+wr\337{\231\343\366\t$\222\377\234'\320\030'\306(t\237\006\206\035\2307\273\356\367\023\357\230\036n8\367R\267\207\337\253\332[\321\227kOx\271\310'}\206\260\324]\210\360\024|\026s\276\374\376\315\004>\022\372K\224+\300:\230\374\023D\004S\240\211\321\326\233`r\360\335\317\371\033 X\025}\375\302<\026^\265\367'\363\241oM\351\233\267w\360R\255\267_v\211CM\373\fc\322\307g2\354\332G\310\267P\335(\2730\352\r\3459\311\360\217\312\315\265\037\017\355!<\226\265\335\373}l`"
+	.ascii	"\337\255*\300\016d\t|\031\240\001\376\360\213\035\256\232\366"
+	.ascii	"\020\274a\364\002\255\322)\272\257\236\f\341\017\003\370\021"
+	.ascii	"\361\031L\355K\357\315\367\364\312wLO_\234\310b\366}\343\302"
+	.ascii	"\274\254x\213\253-7\035;]\001"
+	.text
+	.section	.gnu.lto_.symtab.1ba92cc2977eeb6f,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"accelerationRuntime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"performAcclerationCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"performInflightAccelerationCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"gyroActiveDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1ba92cc2977eeb6f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,969 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`0\001\365\t"
+	.string	"t\f$\002"
+	.string	"\037"
+	.string	"\245\357\300\317\017\026\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\352\317\216\355\004\020\002"
+	.string	"\002\006\003\002\007\006\007\b\t\n\274\205\242\255\006"
+	.string	"\013\267\335\335\337\n"
+	.string	"\f\200\333\377\224\002\r\016\342\315\302\207\007\017\215\251\367\230\f\020\350\300\306\254\005\002\021\263\267\346\305\017N\002\b\002\b\002"
+	.string	"\002"
+	.string	"\002\t\002\n\013\002\f\002\002\f\002\r\013\016\002\f\003\017\004\017\002\020\017\002\020\022\253\327\227\253\013\025\026\027\030\031\032\266\202\240\342\f\022\002\f\033\034\311\365\200\276\005\026\002\003\002\003\035\364\201\355\242\016\036\037\364\302\210\333\007 \240\342\234\212\n"
+	.string	"7 `\202\222\246\330\001\002\004\302\\\331\202N\202\001\305\200\334{\210u\351\304a\026\242\204\300F\200p\237\355\355\020\226\236d\327\256|\202O\001|\263\f\246\r\236\2055\301\213\001\037\tX\037\340"
+	.ascii	"\227\3712\263\315\004\256\257\371\0210\237$\374\324\273\215\277"
+	.ascii	"\004P\261\375W\350\255\320\344\"\216\353v\2610\276\023x\273E"
+	.ascii	"\214\001\347\035Q\265\302-\317\"T\b\347\224v\207"
+	.text
+	.section	.gnu.lto_.ipa_sra.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 \200\305\002"
+	.string	"t\003t"
+	.string	"\f"
+	.string	"\001\001\001\003"
+	.string	"\002\005\002"
+	.string	""
+	.string	""
+	.string	"\001\003\n"
+	.string	"\001\013\002"
+	.string	"\020"
+	.string	"\007\f"
+	.string	"\003\016"
+	.string	"\001\017"
+	.string	"\001\020"
+	.string	"\003\021"
+	.string	"\003"
+	.string	"\001"
+	.string	"\032"
+	.string	"\003"
+	.string	""
+	.string	"\034"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	"U\b\223R"
+	.ascii	"\356\201\314\273\261*1\b\025\377\346=8G\317\f\255r\370\305\216"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.inline.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`|\001]\b"
+	.string	"\022\f+2Pm\222\016\320*\260\245\262\006\227\213\264\227\007ypq"
+	.string	"\232\322"
+	.string	"\304\214\212,:\255\355\273\315\234Ff\364$-0"
+	.string	"\253\300\364Y\267\3276\2627I\001\347'\244\363p\360!\341\350 x\340\335\2430\243\345 \340g\002n\264\r\006\013\\\330\272A\356\355\036\376"
+	.string	"\354\277\262vo\375\021f\262\252*\023\312SI\021\241\201\261$\024\320\343\261\250X\235\333% \203\232d[\330\004-E\fm9\237Wv\257 ?\332b\206\226R\203mK\371\rz\224\200\234`(t\030\271\200h\257q\312\366\023\212\264\215\360\327&'\332Z^\032\027\002, \340\242\032\353\006\262\0014\013\321\370N,\200\262\261;\207\200'\021o\002O`\022\360\201\273\214M\024\216\206W4b\220\005@\335\005\n\216\2652\001\227\325\220\f\244\304s\2545,\017\231l\230\020^\343H\336\240q\b"
+	.ascii	"9\324+(\226\373x\207m\230|\235\327q\025\002\205Qp7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\f\001m\006"
+	.string	"\302\n$-\2009\031\016\230\325d\204\033\017\371P*\345#\003\361\351\211M\231N\341!\360!J\312\305\217\255\031[\335\355\233t\233\324\013B\366\2262\005OHP\"\bA\301\260`}\346\275\n\005\313J\300\264\365I\305zq\2262\204JY\373\202\0328\245\003\331\300\362\252"
+	.string	"|\bxz\201\001\202'6\254\355\216\336{\257}%\3227>z\306C\221\016\351\223}~\261\343t\255R\371\250{\3106\216\224CRN\371A\3335\333\305\035e\225\310:F\016\335\003\027"
+	.ascii	" C\243\226\371\f\030\217\207Y\301 \b\3405\240\007P\016Z\354\031"
+	.ascii	"2\2223\315R\345\316\024n\361\266j\324.\\\3033a\221\t\217\250"
+	.ascii	"\214\305BsB\352\025\025!\013\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\n\200\004\013\200\004\f\204"
+	.ascii	"\004\016\230\004\017\230\004\020\204\004\021\230\004\032\230"
+	.ascii	"\004\034\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\375\005"
+	.ascii	"\222\211\032!\240\265\225\003\377g\371\254\352\257\252\252\252"
+	.ascii	"\342<p\033Yo/\255V\3478Q\347\254m#K\222L\001\272@\241\263\331"
+	.ascii	"=I\002\361|\354\234\247\263cG=\251]\343\3118\321f\314\301\340"
+	.ascii	"\240W\370\227i\372\031!\b\234\250k\236\213\021\235\364\224v\321"
+	.ascii	"3z\255*/\013b\274\234\023\232Q\034pZ\212\316u\237\347 `.\016"
+	.ascii	" & p\002B\265\035\205@\320rH\021\201C\251nf\030J\t\002\345\200"
+	.ascii	"g%/\241N\267\021lkW\235h\230(\216\204(\241[\300\212\263\0341"
+	.ascii	"\210\033\377e\343:x\005\027|%\350x&(\016\254\357\300m)J\370\""
+	.ascii	"\226\036\324\270`\357iK\301\207"
+	.text
+	.section	.gnu.lto_.lto.af011b2140184192,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.25.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\276\234\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\316\007us\250\345\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\246 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.26.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\252\001\215\f"
+	.string	"VUQD\020O5\035`!\240;\001\320\314\017\356\340\362\246\3105\352\324\331\261/\2641\t\021\350\363\t\255#\304\254\326x\fG\345\342\361\272/\016\b\215\250J\033\200 Z\003\214\214\320\207_\323\230\216\347\377\355HvJ\001:"
+	.string	"="
+	.string	"A"
+	.string	"K\262 \261[\2068C9\347\362\227\356\034\345\035\3359\217v\013L\204\214\232\004\363\334]o\313\360\361t\364\357\341\225\222it:\t\260\273\246%S\205{\273m\020\333#6\005\020\376\007\007\017<P\032\316\371\242\356\234\201\t\344i\005\203Dkv9\242\033\006\373\222\335]o\244}\326O5\n\224\247\013\314k\227B-\306\316\270\022\033,\266O\355\257\336a<Kt\216\r\366\346(j\352ur~\202\366Run\342\205k\304m\005\217\321\\*{.BL\231\347\277\207\020\tX@\235V\223\024\f\016\342\202yJd\017uvx3T\211\231\252\313\305\316n\360\226H\331]\221\234N\202\317'`\303\233\fXA\325\363\201\032\004^\b~\341\247\206\336\247\243\361x\0330\3642\037\376\026T\320\003}\037\350Y\312\275d7\322\0038\314H\033\204\003_Q[0\331m\315U\324\024\254v\001\" "
+	.string	"\203\221\321m\205\252\">^iF\203\260\221\201D1\227\007\305\030/GGx\340\017t\033\362\261#3\177j7\021\b:/\027\347\"Kj\207\267\343\037\312\326\247'\001\347\032\020\333L\347}"
+	.ascii	"\315<%\340\360\242\365d"
+	.text
+	.section	.gnu.lto_baroPreInit.34.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 \304-\005"
+	.string	"\222\t#*\200k:\300T"
+	.string	"\017\360<N}Z\001\214\334\247\r\304?\2667kw~y\257u\357\f\300T@\256\025\303\f\273\343\243\275e\n\227 *+9M\032)\270\322Y)Y\231bD\023K\2642D\370lH\312\325\234\224#\327\013\265\202\003>~\356z\220\362/\240\241\366\2778\321\0346\335\221\217\2473\001\314\345\377\306[?g9Ko\267A\272Nw3\254\254\265\317\372\356\266\003,\273\366\t\022\335\375\207e\222=\334\377\206\377\210\377\213\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_baroDetect.35.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"%\b"
+	.string	"\302\01786Po\322\001 [b\024\242\022\020\016\326b\212^ql\037\273h\365>\032\037A\276\020v\031\267\373Z\354\t\006\324\020\266\"*\206\262\252\026oQ\354\211%\233\354\235R2{\230\016\222b\025\021\024k\330P\310\205\214;\027\225 \351\231\024\203\210\031\235\331Gf\361#\201yb\207f\361\342xNH\032As\322\250\251\031\337*\367Bv\r\271W\262O\355\356\372\221\354\237~w\323\177\352\035\373\342R\320\262+\212\201\331\025\250\022b[\2635\266_}\211\366\223\205\001v=X\022\254C\002\3129\373#'\321n\272\370f\227$\222\262[\r|Y\207\256\037\250\016\255\013T\207\266}\200\240y{\005\021\275\204\242a\362\262[\343\373\370v\267\371\001#\214\273\214\302\356\332m\2148\356w\333\034\333\f\266O\002\r"
+	.string	"+A\n3\212\314\320\300\210\321"
+	.ascii	"B\b\347\256)\027\0231\b\237\251QpY\322\324\304{\025'"
+	.text
+	.section	.gnu.lto_baroIsCalibrationComplete.36.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 \375\345\006"
+	.string	"r\21504`m\322\001@_\002Q\333\030\023\207\266\247E\243A\013\br\355l\013\350\326\320\261\003\315\036\213\205\324\205ET\026\031\346\247&\230;(\266>\232\020\"eJ\001\266P^\313\264\213{\225\005\006\237\203\230\006\031\206\241ra\226\007\031e\300\256\241=\226q\356\261I\334\353H\225\300\243\037\373\232\352\252z\020\351s\215oh|\013;l\362\327)\177S\235\272\006@x\262d\307N\252\204\375iw\327:\262\235\326L\177\022\300\bQ\370\330\r\225J\026\204\"]\330\346\330\023\037 pl=R\204^\341\001\342 \331\215L'n=-\377\031\237F:D.Q\347\t\220\260\273\316K\364p\353m\027\3306\260\035\021\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_baroStartCalibration.38.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"]\007"
+	.string	"R\316360\217\222\016\204\260\317\333\b\002O\320A3\327\236z\233\326\340X\016G;\330\013V\343\247B\201b\252\236\256\177\222\332\\\204\260(q/\225\204UQ.\206\366\t\221)o2\021\363`\234,j\026\240\0263\255\203i\260\303\240\341\300M\324`\206\340\254\001\213\320\223e\021^\333\250\227|\247\213j\200\b\211j\364H\367\243\037\314\335\332\361\271\027;\200\\K\265.\bS\253\251\032\234RX&Fn\365\033\311=\212\357%\337\351\337\300HI\002Jf\304\252%UV\b\306\337\313\321T\250\033+\250hd\346U\353C\177\325\352\265\350O\272YdAL <V2\023\276\212\212\352D\267\250\n\224L\017u"
+	.string	"\b\231\271+\231$\372\353_\360\037\374\031\001\t"
+	.string	"2\241q/\360\341\002t\r\357\016\341"
+	.ascii	"\025\375r/\270t\213v>\001"
+	.text
+	.section	.gnu.lto_baroSetGroundLevel.39.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\002\21625@\215\222\016\344I\362)\003q\023s\303\273_\353\341\327\021\310\033/\312\204\217?\326\307\262\373)Z\311\242|\035Vm(\r\340\200Q\203\345\244hg\375\206\b\221)c,\361\332\\\031,^\030`\026\261LseP\323p\311@L\314\240\245`\314\341\212p\203a\021Z\333\247\224|\243Kj@\b\312\364y\240\007\312\251\334\255\035\234\213\361C\3075\324\352v*\255Z\352\301\250\004E\361q\251\337@\356U|)\371F\377\bN#\n\"\231\022)\2234U \031\177/GK\236n\274pb\265z\317[\255j\255=I\267\213\354\007*\302\343\224\231\360YT\253\323nI\025\b\211 \352"
+	.string	"\0222s\027\022M\364\327\337\340G\3705\002\n"
+	.ascii	"2\241o/\260\341\002t\r\357\016\341\200\212\342T\344\313\275\340"
+	.ascii	"\322-\332\371\004"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.40.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`#\002\325\022"
+	.string	"f\343~H\320\362&\035P\002o\353\177\321\004.\035\001x\3340\002UJ1\202\310TO\307 \330b&\203\231=\370\241\031\277\2733\302\0171\310B\027\242\340\005\365pfrm|\213S\215c(O\004\207\223!Y\330\332F\366\226;\245j"
+	.string	"d"
+	.string	"l"
+	.string	"\265\202\350\261TkM\261\n\353\324\266\237\342E6\226\3151\210\326\342\301\260\303\"H\255\265+9\tw:?\200;]\021\227\235\243s\245\314\2779\307rCI\244u8\235'R4\200\270h:\223\244gH\274 \247\317w\236\324p\370\270h\263I\222#\204\217#]\362\320r\244\\\255\324Z-E\332\206{u\333\020l\263\330\322A\362\207N-\347I_\341&\377f\nf\222\027O}3q\247\337\250[Q\315\310\003\216\254\262\307\033\2716\373\263.\220\353G\177\213e\351\371\361^NZR\351\217\244\220\250\375\be\330\035c\355\251\032R\235h\215\021\037?\345J)\247m\343#Y\304\366\350\246\222\331Xi\bl@\025\241\234Z\201\374\221\314"
+	.string	"\002ATRKtm\376S\211\332\242\\D\250gGI\262v\227\307\0169\271-I<f\222\312Kr\227\003\323\356\214\325\223\022\212\326\332\266\360\030\262\002P\265\326\004\376\213\303\200\371\267SW\370>\3564v\233\252\031\375\314\265=\344\374\026w\021\322\310\310p\247+\"\031'\246>$\326\234vmN9k\t\334t$E\315$\225\017\374\313\3325\336Kl\201'!\006\366j0S\343\305F\036\304`^^\036\003\017\234\020\206\036\310B\343\305\004\330E\005\364f<\330\007\276Z\272\020\374\302\230\027v1\230\027\254s\001\303N\305\200\277\030\017\354f\276\017\354D\306\372\005\362\211L\314\326\036\351&\"u\355\234\353\025\234\315\341\002\310\253x\323g\002U+\316E&\303D\220\027]\373\017D\032\204H\315\366&% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.41.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\303\002u\025"
+	.string	"\206(\216H\320\026Q:\344h\301<\315\266\252O<\321J\221\023\214\251\316\231\210\025QA\030\033\027xju\333\241\375oF\234\253\226<\230\227\031$\346\231\231\220\270@}\025W0\3234\227\301\372\022u\224\t\277\260\237\220\275\267\3342\005v"
+	.string	"n"
+	.string	"{"
+	.string	"\257\021_\320O\r'\335-\263\364\t\344\330\232"
+	.string	"Zv\242\004\220\356\236\371\001\2716\327E\335&\232"
+	.string	"\351\036gn\372\226\376\377\332\330\033\036\356\232\243\212\332\350\307\305,\307P\367x\212\331"
+	.ascii	"u\351\334R]\312)\326\265t\262t}=\2329C\207\204V{-\325\3319\252"
+	.ascii	"\351,\263\324d3\246\273\367\2662D-&\245G\323\335\227\264\032"
+	.ascii	"\211}\335\377\016\376K\370y\006Unau\334|\335\262"
+	.string	"\002\337\034\033\224\341\313b\351S\241\\\332\322oX\227._h\021\245\007\207\r&w\377\030\223\354\363\357lF\361\277\254m_Z\333\256\313\216\273-\244\005\332\217<yQ\225\377<y\257\312\327*O\253\374\254\362\\\345%\225_\230\2651\016=\201\260\353\026\261\243\322B\024\367b\201vJ\226\374{\370\336\276\362\037\350\271/\273W\366\316\332\"\255\217He\021\016&w9\312\"%Kh\360L\376\237\263BZ0L\272\333\3007\310\342\036t\250\251\251Ki\216\006\305E\266\360\037a\202\\\332d\323\316\216\220\214_\224\3002\223\330\323Ir[\022\324\023\233\354\263\250\372\355\261>P6 X\227\322\030H\206\242\310\356~1\373\234Y2\205\233N&\247\374\273cy<\367eq\016\037\362!,`\005\317\262\344\235\0059`\005\025\002P\003N\n\305\200\225\003\252Z,\250n*\240\300\005\n8\200*\027\r(V\330"
+	.string	"\0247\254V\240\210C\272\215I\004Y`*\024Q\024N+1\\\251\300\325Iu\203J\235l\304\325\3114\340!\016(\236Xa(\236VF\330\316f\024_\3311\3231I\314\362c\233\375`\231\035q\210\377/\314\262#C\b\306\261\217X\347}h\"\205G\304%~\201\361\261\b\303\036i}F>)8\366\270\304R\007\242'&\0031 \200\242\221\273\363O'D\275i.\314^\353\212.\032\326\226\271\234Q||\342Ha}\303\027\026\t\261T\330%q\227\244Q\270\325\304\234e,\034\306\252\223Se\031\372\275\254[e\211\307 v"
+	.ascii	"X\034\234O\017\235\342\017\203;\233\222,{\315\310\334\006\035"
+	.ascii	"\344@\032q\266\006`\246\234\225\007\023\373\035\202UA\276b\374"
+	.ascii	"\331\310\016\371,7\350\336\326b="
+	.text
+	.section	.gnu.lto_isBaroReady.42.af011b2140184192,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016<\022\252\bA(\211iJ2"
+	.string	"@,\343\315U\366\226\354\252\375\273\035vm\204R\007\357\31513C\344t\221\312}\201\231:4\246Y\262e\ng.o\342L\032\3670\013\215z\216\332LT\3330`4-\363\250v\031\3305L\257q\234{\315re\331\b\031\001\210=|9\332Q]\214\035:X\253\322\355"
+	.string	"TB&0\001\302\224\277>\310(\276\225d\243\037Gf`\322\021\224\314P\312I\212H\037\031\277\347-#$x\256zY\204zQ\002\341A\222y5V\321\252X\335n\264\242\021\002b\211>\305"
+	.string	"\205\314\034-\221Dg\375\013\376\203?\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.43.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`{\021\275G"
+	.string	"\372q\274\031C@dR\007\223$\233)R\210\325\f\020\025\003J\005 \371k\310\203\324\201\364(@X\202l\322#\316\231\033\017\036\026\242\202;@\3351}&\375\022.\252\337\264\310\373\230E\250\310\326,\331{\357-eJ\001\204\001k\001\223\001\332a\240\366\367\247\335\365ioc\355\033\326\256_\355/\342\363\320\020\272;\2217\317_\331C\263\234\253\006\312[\377\275\374\257\275\253[\355\272\277\273\337\360\357\362_\236\315\201k6\334\312\354\260\363\340%K\271E4oQ\241Q(X\263bg4\006S\246\313n\236\255\004\336u\007Z\1775\313}\363\\VE3\317V\003~ ~\327\335\375\265\274\332\r\227[\353\024\354u\323{\262\021\232g+\225\362\215\357\273\355\033\275\357\356&/\177\024\324\223\2232\211lbZRJB::\032\213FE"
+	.string	"\210\210Ca\020\370\363\305\360\353\266[\313\376\316\217\372R\203r\373'\2671\332I\314+[\345U\356\371sQ1mr\t\031\366\247D\303\350$\024#w\310\3527U\267h&\265_R\323\242\225\262|\322\317E\263\244i\244#,\177\234\213Bi\225S\242h\332H-tW\244\316E\317\264Q\021"
+	.ascii	"'f\232\310\300U\nq(\034c{\247)\321#:\250\271<\320\351W\346\243"
+	.ascii	"\310\373Z\343\027\032\364\347\242D\332\001vi\006\375\224\350"
+	.ascii	"\020\035?\333W\240>\271+\363\301\345\341'S2#_\026\025{\177oN"
+	.ascii	"\336\236\357\373\363\"rW\346\203\314\273-\203&fA\206`9Z\330\r"
+	.ascii	"\034\037.\335\002\371\335\016\030\213\003d\b\266\325\032\351"
+	.ascii	"(\351\363l\257\273\300\264\264\206#\314\363\354\032\n\346\343"
+	.ascii	"=\300\273\353\036\356^\302\235\310\025u\255\037=\376{v\034\036"
+	.ascii	"\377<\372L\035\177;_\225\363\247\3636\336w]Cg/j\224\031\311,"
+	.ascii	"\340\345\270\273\237x\236\235?\346\356\356G\027\347\034\3241"
+	.ascii	"\273y\236\005(\237z/N\273A\230\301n/Y\304\230\275R\332]\256\""
+	.ascii	"_\321\017u\346\232(\326Nk;\375\001\233\0257n\325\273w\212/{\240"
+	.ascii	"\264\277\254\345\375\266o#o\t\322\3153\216\207\272\313\\\036"
+	.ascii	"NB\223O\370\267\345\221\2025\317\246\302\005\f\030\336\f\032"
+	.ascii	"\364C\367\016\302!\223\343\332\316vK\267\273\027x4\034\022L\347"
+	.ascii	"yf\340o\346\317t\360?{\327?\204\b\001\005\204`\353\375\342=\367"
+	.ascii	"p\350\354?\032tLno\251/\370\021\357\357\031_\364l\351B\356?\346"
+	.ascii	"\335F\2200a\342}\3677\234\243\r\373`>\214\r\3773\227qB?\364]"
+	.ascii	"\377\023\357\273\b6\032\225%c[\304p\350\254\273\325\371\355\274"
+	.ascii	"\245\356\337\316{\211"
+	.string	"\373{y\367\360\325\377\016\033*D\370\265w\004\256}\352\255\357RC\355\001\210\332\243|\332\241\210\332\237\210\332\235\210\332\225@\355I\240v$\254\275\t\326\3164\324\276\004kW\032jOz\265#\305\332\217\210\332\217D\355\306\241\366\342P\273\221P{Q\254\235(\250\235\030k\037\006\265\013\201\332\203?\355\300X\373/\250\335\027k\217\203\001\023\264\3216n\367\246\241\246\236~\350q+\271\364\030\355&7\263\262\323\371\276k\334p\336ZZQK\207\001\303V\334>&Y\254\230\321v\227\271\364\027\271\253\350\305*w\371\237\031mxP6M\314Au\313\216o\323Z\344\257X\247\351,r\227\354%\177\351\207\312_E\\`\372\212\374\303\312\262X\245h\273p{\330\252\361\032\250H4E\246\032\247R\226StQ\210\233h\177\b\242\321di\323\224\272<\232\236\0217\314$\017\313\347\203\3278\243\353[Q\037\263?"
+	.string	"\206M\230H\205{\030\246\225\3502\235D\270a!\177\350>x\325B\024\334\025\206h2=\246\217\004\267OH\235\036]\244\317\020\231\232\024[JM\303\200\333\033\024\321Ad)G \313\342\017\340v\341\372\244\335\371\340\225\214x\r\033\342\211\332\301\"\374\365\360ZNMy\370\366\357\210\206\352\035Z\207o\303B\346`\347>\bG/\270\245\377\205fk! Y\021\016\236\034R\035#g\277-u\3155\250\r\002&lb\276\177\363\361\3762*\375mZK\246\0265\216\345\024\235v\302;\336\035\224|V\2262\355-\217z\360\206\205\264\231\363A8\327\370\335\033\266\326k\362\206d\263\250BK$\366\335>!or\237\347ZaCH\320"
+	.string	"\375m\217'S\223\202\226R\201\334\355\r\220l\271\f\345\357d)G:\273e\221\356\217\273]86i\325\217{%59\247\326s\267\035t\326\340-\355\343\037L,\024X\035V\264\250\212\257>0\261d\250`\326`\na0\231-\256|W\037\230.Xx\300z\301\264\262\222\241B\350*\016X1\261\230.\252\254P\244\240\272\262\252\272z\301\274\242z\301\002\205\013*\025VWT\007\222^\005\203iE\205UUeE\005\264\316\277\227x\214<3PR\373\331\336\227d\r\232\253\355~jj{\004\034[+\233\315\006\212\312\240\003\344i\352Qnm\247G\355"
+	.string	"\333\300s\017\213\336\313\212\365\242\266O\215!\250-l\022\007\265\245\330,\344\224\220/\257\315\3239\262\244\314\323\226\272\207\375\264S|\211CD\017\312\212\265 \215\327\344C\243Y\327\254{\337}\332@0m\322\324t\330N\333\303\326q9\242h\351\254[\270k\006\322\017u\332G9o\344\264\266\323\251\211\027\224\263\346\343\204uA\242\334R\377+\023b\205\r\374S\344y\006\031a\303e\272\236g\2000\335g\275\277\345\r\r\336\260\245v\227oer+\367\377\221\315\222S?\313\246i]r\303y\330\244U\213$\221;\202\346#\233E\355Y\"\365 \267/\254\f\262\351\200\316\203\247i\303x\317\275\246<LL{N\333\251\243\337\337\336\245\315$\347\265\264d@\255\216\222\222\001-\207\203\003\035\227\264\225\366?\367\256I\033\202\231\030"
+	.string	"//i\322\223y\244\375V\364\033\244\355{\202\301\212!\271o\343\205\203\333\304\216\330\344\261aI\372QF\346x\344\336\314\323j\252\322,\217th\2166\034\266\206\255\036\267\231]\007\005\024\201f\250q0&\225C$\"\"\"\222$)\244\003\001\206\2040\346\314v\021\360\244S\2141\242))\f\233\001"
+	.string	":\360R\335\240\303[\207\020%V{ \\$\022\342Rk\024\032e\302\331D\364\230\023\266J6\006\306g\311\n2^\f"
+	.string	"N\301\204\334\256\305\236\227\334\b\261H|\371\370L\342H\326\0241\316C]5g\270\360z\203\017\342W\305#\373\020\030\340S\265\t\022\377N\235\300\231=\220\352Vw\331bq\3720o\271&\266\273\354`]z\263\327\310\230\205\020\322"
+	.string	"\344\274?M{u\310\271e\275\327JR+\n\200\320fjps\\\362\336\366\237\302l{\234\305\017y2=Y\320\017C=7"
+	.string	"\251\2423\356\362\264\315\310\335k/i\b~\340op\354\261_\244\216\210"
+	.ascii	"\024\301\224\322<\301\307(\272\032\241\\\036\336]'\331S\245\264"
+	.ascii	"\007\177*\037VL\317v\314\323\"\033Z\230\274\212q\013J\220\312"
+	.ascii	"\241\020F\"\235\226d&\313\223\205Q\036\213\306\353&\3519~\242"
+	.ascii	"\224\327E\234EX\034\264\276h\362F\216\377\345N\270\204'\213\275"
+	.ascii	"\206,\370\f\370\315\324\264=\365m\332\317g\204i\002\3651%C\222"
+	.ascii	"\204\217\022b\360PlQb\354\025\206\301\001\342\350"
+	.ascii	"\232\315\256K\275\313'@\307\205\006\355(\367i>\237\021&\223D"
+	.ascii	"\036S\210\234J\371QV\030\034!\367t~\216\360@tW\"\342*$1\330\262"
+	.ascii	"\304[\331\320c\216\327\222\361\250\277\322{\036\005C\021c,1/"
+	.ascii	"\273\022\023\303\203\003\270\004\035\006\005w\220lx\337\355\312"
+	.ascii	"\007 R6\004\235\323y\326\266\341\273\337\236\343'\203\227\272"
+	.ascii	"f\321\265T\365o\267\322\333n\245\267\335(=\273\\\240\210\210"
+	.ascii	"y\310\313\347A\211\265\231\233(\230\241bc\263\2618z\316\223\314"
+	.ascii	"1\346\231\002\266qp\203\301\342\376\244\346\210lI\313i\020\260"
+	.ascii	"\354\\<g\243\246*\227;\335\377[\031A\250\233\317\205D\302\316"
+	.ascii	"\371WR\021\250\025\236A\212\263a\233Z\316\352\207\005P\302Z0"
+	.ascii	"\271\215\017\022\216A\271\272\025\360\225\211\262\274[\030\340"
+	.ascii	"A\352\305\251\361\275c\025r\227\310pU0\246\f\274\t\320t\336)"
+	.ascii	"R\272\300\"\024`!\236\220\017V\230oYEj\256Y\343\225\253\311\001"
+	.ascii	"\265\311f\275 =\005M\353=\325\007-\027\264D\324o\250\355\226"
+	.ascii	"\240\300\214eg\354\223\350\320\335\224\346\376\003"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.45.af011b2140184192,"e",@progbits
+	.string	"(\265/\375``\004e\034"
+	.string	"\3464\265G\260\326M:f\317\204/`<\215\027\333\203\3638t\007\264\r\333\225\375\273#XN[8y\202\303\206v\233\023a\203)\344\340\344>6/x\177\3707`\371\333h-\356c\267\364a\341\024\026\\\261\036\322\366&R\246\024\232"
+	.string	"\221"
+	.string	"\246"
+	.string	"\240\372\003\206\222D\031\241eN\024ec\323+\"\241\372\357\267\357\373\370V\210gy\241\262\210\205\260\317\343Z6\315\"\236\345\b\346\353\306\234\223\366h\213\260i\217j\223\360\261L\373O\0272\245\b\201P\031\t\233s\032xtQ\370\350\347\270\016\022\326\201Y3\236$\025\221\246-\2619\247\255\366\036\371\b~G>\256\214\353\036\301U\235?["
+	.string	"\036\031\303\345\364\304\364\270\342\340\314\323\212\257\315S\017\254\3159\217u=\361\304S\235-\230sZ\235\236T\334\362\266+\330N`\203?\002\362Q\367Oh\374>\344D\216\220n7\371\370="
+	.ascii	"\365u\245sN\246]\251\rRh\217\365\234\036_`p\221r\245\247b\354"
+	.ascii	"\003y\220\r\376\2249t\320;u\220\217B\373\255\353U\2140\027;X"
+	.ascii	"\354\264\314\316\342\351J\331\007\347F\331RMduMF-\024\364\337"
+	.ascii	"\r$\325?R\355#\325\001Bu\317L\315#\325;R\255#\3259R\215#\325"
+	.ascii	"7Rm#\3255RM\023\252i2\352\031\251\226\t\325a\250\236\315\324"
+	.ascii	"R\252#\250\006A\365F\265\006sN\004~\223;a\340\340\301\003\371"
+	.ascii	"\030.M\006\330\325o\266@\033\264\367U\361\226\234\211\016B\204"
+	.ascii	"\b\362q\266\263/&,\344\002\255~5\215\331)\321\332\022&\310;\311"
+	.ascii	"CA\261\341\325k\212\252QD\264\263.\237\225\317\232\353sN\r\260"
+	.ascii	"\252\304W\005@\315u-\260\251\027c?\353kQ\250 \357\344\263\265"
+	.ascii	"\022\313ds]J\310nN+(+\363\352\315\271#\020\367g\257up\311\030"
+	.ascii	"\227\317\n\334\270J\346\013\333\375\202+\240\210\017\007O\313"
+	.ascii	"\254\273\373\2461\266\360#\027\3029{\b|#\347\302\340O=:\203\221"
+	.ascii	"Q \222\226\214\226<0\300\345\216\032\320\214T\224\273-\335\222"
+	.ascii	"p\271#\r6\245\034N\351\303M\311\366\201\303Q\222\r)\247d+\032"
+	.ascii	"2\016\304-g[\302\341r6Z\326\356\340\334\250\332\326v\313\363"
+	.ascii	"\227.\314R\333\330\324%\314/\0328\226+\261\212\026\261.\240{"
+	.ascii	"\266\212\316\306\n\225;m\341\331\236U/;<[\353-\223u\326fwv\267"
+	.ascii	"|.r\366fuV\210\f'g\207\310|U<\232\305\331\002E\202\366f\201\246"
+	.ascii	"\360L\264\360\002\253Y\033\232\225\331\232\275\317\212\2664+"
+	.ascii	"\273|a3K\323\345\270\227n\007\224\231}\022\032\277pev\311|a:"
+	.ascii	"\254w\351\302M\250! \005\021\202\b\"\232\030\n\242\205i\fp\002"
+	.ascii	"\031AD\267\001\021P\265c\220Hamm\006\362`3\371\030\025\201\317"
+	.ascii	"\237\333O:\250\333\022\226\f\324\272Q(\223mq\350\013\214\347"
+	.ascii	"\270@\027\001k\326X\2402\320\342RM\246\311\236?\334\221\215\356"
+	.ascii	"\317\004\302\273\241\202\275\317\325\213\2218\\OAO\027<'\226"
+	.ascii	"\002\321\264K\270:p\032b1\216\343\216\226\310\333\261u%\326\020"
+	.ascii	"\271\204M\373\325\2277\264\322I\037v?\023\247\035\242\360\304"
+	.ascii	"\370\270\032\217J\271>\033\013T\240\336\211vX\\c\n\3205\022\224"
+	.ascii	"w\035\022B/\001^I\200_\262!\352\266$\374\001"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.46.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\371\002u\025"
+	.string	"\326\246\206H\320\360(\035\243F\367\300\214\251XR\223\236T\310\031\363t\307\"\307t!\244\324\265w\2171\023\270\325\243\210d5\rP\260\352F\037\2116\003x5\211`\213\207\310E\314}\322`\027\352\b \253\035\252\355\377F6IR\246l"
+	.string	"h"
+	.string	"t"
+	.string	"_\247\276F}\035\202k\3715\270\353\357zw\255\002Vl\222(\314\230\023\303\370\233>Y\364AWmey\306\226\241A\034\246\366\230n<\2479\347\353\033tF%\370\235\261\352\217\252p9\032\2257\n\242N\346\234\253\334\215\0364\240sa\363\221\263\201"
+	.ascii	"\222r\230\364G\367B\256\266\213:\231szq\271\032u\250\266\025"
+	.ascii	"\330>`\037&\272\243\322,0X\250R\336\244\003\020\215\204\nAhq"
+	.ascii	"q\tY\"~7\366\372\377<QW\333\321\022\324F\241~\257\242OMG(\320"
+	.ascii	"\213u\307\261\230U\234JkL\250R\317R\372\365\340\320v\264\203"
+	.ascii	"j\373\235\255\340\274\216\3755I\270\036\t\327\"\273\016\331\265"
+	.ascii	"k\327 r\335\222\353\017\271\366\220\353\016\271f\355z\265kU;"
+	.ascii	"\336tB\224\264\036 \207\310\343q\367t\316\271\037\007y\"\210"
+	.ascii	"\221uO\205\226\2102\374:n3h\260\212\3638\201\n\247\261{\272K"
+	.ascii	"A\233\323&\343\350\263\315I+\300z\307U\344Y\235u\320H\244\241"
+	.ascii	"\372\352a\315x$\372\250\216BqM\251\253H\216z\352*\352~\324\317"
+	.ascii	"\273=\205\007Or\211$\372\310\207\327\333\223\035\350\211\007"
+	.ascii	"\2519m\b\254&\224\247\342f)\221\301d`/1\231\312\312k&\213\315"
+	.ascii	"``\263\027L\213\312\313\213E6{\225\fp,\002L\366\222\211\305d"
+	.ascii	"/V\020M\257\343T\214\033\037\3555\351:\214V\216\205!\\\023\355"
+	.ascii	"H\343\250(\241\310GZ\210\\\036\2157pV\205\215$\r\340w\212\022"
+	.ascii	"ZY\350\021J\202\224\224P\245Tzr\252\241\036p:\337\277\013\271"
+	.ascii	"\353+%\226l\213c\305\204\220\253\212\\G\r=\365\340\200\020-h"
+	.ascii	"\035\344\005-D\250q<\306\224\3000\307*\247H\031\016\200\002\021"
+	.ascii	"B\262\016\020p84)6c8~9P\001VX\212\231\232\206\243Y\340m\214\354"
+	.ascii	"\271a\313\247\264\220\206\276J\204\326\323u\224\217 \325\024"
+	.ascii	"\344\035Q\352\315.\373\374\337k<\320\026\335g\247\230a[\354\315"
+	.ascii	"^\224\305\200Q\371\330\\8\250&Q\271_\006(\246!\2342W\003\200"
+	.ascii	"\213\332\030\375U\243\237\243\327!\200k\306\235\301\004\303\005"
+	.ascii	"\257\254\017\233X\216\276\361q\275V;\2366\211\372\f\365kT\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\357\002]\016"
+	.string	"\204\024\353\003"
+	.string	""
+	.string	""
+	.string	"\002\032\177*\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002(\177+\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005;,\200\204\001"
+	.string	""
+	.string	"\003\005<-=\022\002)\177.\026/\201"
+	.string	"\00590!1\005:2\002\"\1773\272\200#\1774$\1775\005\0336&\1777'\1778*\1779\002+\177:\005/;0< "
+	.string	""
+	.string	""
+	.string	"\0051=\025\031\034\035\035\036 >\0057?\002-\177@\036A\002.\177B\037C\005\302"
+	.string	"D\005\031E\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\027F\001>\177G\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\0018\177H6\177I5\177J4\177K3\177L2\177M?\177N\300"
+	.string	"\177O\301"
+	.string	"\177P\003\001!\320\360\372\250\001\001\304\006\003\005\001\202\006\003\021'\304\001\003\021&\330\266\305=\001\204\006\003\021%\254\234\343\030\001\304\013\204\017\026\244\027\003\021\005\230\305\2462\001\242\033\003\021$\240\301\227\334\001\001\244g\003\021#\233\311\272\302\003\001\304g\003\021\"k\004\021\304\341\211\313"
+	.string	"\001\265\007\365\n\265\016\365\017\265\023\365\026\004\021\365\027\003\032)\201\001\244\006\003\032(\204\007\017\003\034\344\007"
+	.ascii	"> \340\002\251\231\342\006\340\347\261\215\rS\214\027%\375\222"
+	.ascii	"\004#\030\202CpE|-?rY\260\2024\303\320\314v\320\027\201f\304"
+	.ascii	"=\301.\001\016\340\b\016\300\021\034\006\016^\340\343\267`,?"
+	.ascii	"\"\036\370q\344\0300\371\211\006\374\305'\336\030\017,cg\374"
+	.ascii	"nb\275\035c\335\301\221&\350\341\033\377\203\232\r\246\263\276"
+	.ascii	"\240g8:\340 \207(\216q`I\336\016\336\006 \207l\340\2241\276\341"
+	.ascii	"\006~\f"
+	.text
+	.section	.gnu.lto_.refs.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"E\b"
+	.string	"\366\325;/@\2456\351\327\355\223\342Q\024EQ\024\005\214c\030\206ax\021$\254k:'\310\002p\374\373\303\376\315\376Z\243\307GCCkF\326\354\226)."
+	.string	","
+	.string	"2"
+	.string	"\320\325\321\372\276'\233+-\211\024\322[\375\350\223\250C\246\247\246wD?M\035\222\272\023\rI;\036\\r>\302\356\236\3768\275x\335\227\"\b\371\007\211\033\344\027\274N\220\370@\276@~\346uL\342[\276\366z%\361,?_\267\022\177\371\221|\310\353U\342\217\374\351\275K<\001"
+	.string	"\274\177\243\322\327\250\374\031\030\371_X\\\375\n\312O\\]\002\373\b\353!^\177x\335!\277!\353\f\331/dW\300>!\373\206\362\032\f\327P\360\217\031t\210q\326\266n\251zV=V\365\334\376\272\274\245u\352\322!\367\317\345"
+	.string	"\352L>&\373\226\375\271\227h\377\270w\262o\265e\372\b"
+	.string	"\222F\3533\021\310\f"
+	.ascii	"\002\256P\002\201\023M\261\007`\251'"
+	.text
+	.section	.gnu.lto_.decls.af011b2140184192,"e",@progbits
+	.string	"(\265/\375`S0\025\334"
+	.ascii	"\032\\mLW \fQH\351\246p\332\261\276\t\016?\016\216b\207{\007"
+	.ascii	"u\037_M\177\374\321\327tP\346\340\251?\034\376U\247\365\273F"
+	.ascii	"\337`/o\323\336ao@\r\365/p/\340\314CM\361C:\302#\025grmTH\303"
+	.ascii	"\334A\207\273=\333\3729K\311\217\330hm\357-S\b\004\273\004\352"
+	.ascii	"\004M\350\336\324;U\245\260\252\262\262\242^\245\256\246'g\r"
+	.ascii	"\032^d)\251\367pu\306\177\235\2356P=\336\314\220\321i\304\244"
+	.ascii	"\305\325\353\2542j\214w\024$Ri\n\376+\324\023\212\251)&\365\276"
+	.ascii	">9\3652g\260\237\030P\270j\324[\233\352\213vf\2500\334z(=9\301"
+	.ascii	"&\310\2713\360\272\256\2563\360j\213\242W\027\017\310\272JR\257"
+	.ascii	"\355\013\274\fG\260\344\330Q\257r\367\304K\022d\275\225\251\256"
+	.ascii	"hgU\376:Y6},2\352\354J\275o\"\036\020\021\357\257K5\371\2635"
+	.ascii	"\006H\226z_\223\177EV%\2356\245\214\243\336\236\245\263/\360"
+	.ascii	"j.z=\342\260#-\302"
+	.string	"\324\253A_\250Sk\233K&\343\320U(,\220R\365\272\351&=W\227\001\350\021\233c\212\252\267\343\372M;\277\245\345\336p\232\354:\311fv\266\017.G\037\365\336\232\004\247\310\351o\341\365\364\005^\203\025\275\333\\\3409M53\220\025#c\232\203{\313QBf\005Vo\277\325vk6\357\267n\353I\366\333\315\031\331m\301O\267\005\273-@\220Ox\367u\013g\200\223cT\272\352\232V\303\313rj\241\253\227m\b\2630\003\262T\357k\025~G\231r\346Y\326\305\214\214\313\231\226-`\244x\351\257/d\272L\267\320c\332L\237i4\235\246\327ZL\247\265\263\325\372\354\r\246\303\2746sN\346\234\337bX\3024i\366\027\032&\007f=\366cs\306\321\205\311\004\255\277\032m\352\001I\322tW\253\365\225\016k\264\036!t\255=sn\336\203\277\350\337\300\203V\353/=\246A)g\0347"
+	.string	"\340\204\002\343,.\347&\207!\016\273\245\326\023\323\320}\257\341?\033\003\357\247\311\360[\n~#\301\357\037\370M\205\207\272\005\336P\002L\224\305'\016\2228p\352\275\021\377\2075 \201\233JWig\006m\345\r\326R\276C6s\263f\321IyR\357+\200\337\031\360l]]g\300\273\004pPc\340U\261\306\300k\257v\322N\0024\224o\340\301\355\321I\356\312\271\tt\243\316X\bR\357\033\200\003\340${p \374&"
+	.string	"\257\353\232"
+	.string	"\274W|\264\265\306\300\373{\311\337J\272\213"
+	.string	"V\351b\231\301rn\n\0015\243\232\256\352}\2631\360p_\340U\244g\370-\\}QY\254\360W\345_Wt\2402!\340\267l\177\205@\256!\234\240\363\337\315j\202\332\342\357\246\277Q\024\377F\376\255\342o\021\374}\202\277\223\177\217\340o\245>\300\337%\370\033\203\277\217\r"
+	.ascii	"\022\374\035\202\004\177\305\300\212:\002\021\260\201\370\253"
+	.ascii	"\212V\341o\004\004\340\357\234\2413e.\360[*O:GMQU\310@\3031\374"
+	.ascii	"V\351\257\r@Qu\237\337\212\020\246I5~\367[%5\004\377\023\300"
+	.ascii	"\373\355\220-\367\267Y\277\275\361\177\314\377\264\377j\377\241"
+	.ascii	"\374G\373\177\346?\232\377d\376\257\375O\363_L\231\377Y.\364"
+	.ascii	"\333\016\177\375\360W\017\177]\300_\211\376\312\341\257\f\370"
+	.ascii	"kQ\005\300_1\370k\002\352\360\177\320\177\321\277\n\377\232\364"
+	.ascii	"W\016\374\025\205\277\226\360W\022\376*\342\257\"\3745\002\177"
+	.ascii	"\375\340\257\035\374u\203\277\376o\272\277\345\376\216\373\273"
+	.ascii	"\315\337o\177?\377N\363\367\231\277\313\374-\346\3570\177\237"
+	.ascii	"\375\375\345\357\262\277\267\374\035\3667\225\277\301\376\376"
+	.ascii	"\372\373\311\337^\177w\375\215\344\357\345\337F"
+	.string	"\376\236\372\033\353o!\177\003\375\035\364\267\375?\367\337\355?\211\377V\376\263\375\r\344\357\037\177/\375\035\202\277a\374\235\365\367\212\277\245\376\346\361\367\325\337&\376\266\372\273\352?\234\277i\374\035\343o\250\277\237\376v\372{\350o\241\277u\376\306\177\337\377q\376\323\375g\363\177\304\3775\377\325\374\357\372\237\201\377_\376\377\324\325\325\325\375;\024~|\346G\300No\247\365a\263Jh\346#\017\006\323i\252C\267yB\203Y/\326N\013\026N\033\365\036\263\300\307K\226\307\225\033\342\264$\016\333\035,X\245\316\234\031\035hW\325m\247\246l\371\303\206\325a\253\232\2563\223S\005Z\260xf'\247\016\317\021\203o\251\354\215[\034\2678\354\262-\030\222\343@\305\345)'\242\337\346\270]\366\034\220\222\247)o=\307;\263\245cE\275\317\331\201\377\346e\244S\316\031j\327\314NJ=\274\336u\023\375>m\373"
+	.string	"\271"
+	.ascii	"\036h\346#\334\026\033\254u\005i\343\033\362\217\226s\262\352"
+	.ascii	"\030B\325S\262JJ\351\254\312\307d\220\243\220S\256:*\2359\013"
+	.ascii	"\345d\362(b\231\205\224\316\374\224\227\306<unV\035sr\231\205"
+	.ascii	"r2#7(\223UOJ'\362IH\351\254z\312\316\252\034\224\223H\247\025"
+	.ascii	"\222\331I(;\253\332\262s\371\024\244t.\237\224\316*\034\335\244"
+	.ascii	"\224\353zb\263e\265\326O\312d~\321D\205t\nBS6\227y-\347\006c"
+	.ascii	"\312N\007\310\231j\351\264\206\224j1%\264\027JU\220\313n6)Y-"
+	.ascii	"s\022M\271\265\314yK\351Dn\352\340\330D\313>\032\355xE\225]0"
+	.ascii	"\345,\200\246\234\217\235\321r\316\307\234s\216\023U3\347\032"
+	.ascii	"AJfSS\316SCM\231\352\210\205)\347\n\206F\354I\351\264Z\026a\371"
+	.ascii	"r2\363\212\346\261\231y\255\312\t;\217^\331\305\033f>\305p[\303"
+	.ascii	"\277\255qK#F\225\033U\275\2674\354\024\320\232\037K6\325J\365"
+	.ascii	" \243\302\304\204\301vF\321m\324\332\023\226\031\365\356\372"
+	.ascii	"\202\f\"\2377f\224\270b\304\305\231\261Z\202\372\025\016\"pu"
+	.ascii	"\365\3116%\343\340\274\251\3276\325\034V\251AIy\231\274y\336"
+	.ascii	"\220cv\331\350\271\037\235\234\253\346\230\277}a]X\030\326\251"
+	.ascii	"\235\266\311\256p\313\302\266\250a\233*U\317\375$\233\371\t\004"
+	.ascii	"8P2zI\333\032\256\235\273\223\227\2742lW\\/]\2269\302\3609\250"
+	.ascii	"u5Gu\333\361\261|\233\"\033R\366\004\362e"
+	.string	"\371V\345\330\204y\326\272J\344\212\220ZW\265\372\215H\030\217\036u\307\031\263\302\261\271\316\331d\215S\351\354\222E\332\243ejg\255\2531^kT\034?\202\324\035e^\236U\b\263fua\362\360Q\2634()K 3[\326U\035u\007\024O\013\264\267\251\235)d\231\232\241[\337t\232\023\22460p\234\033\237(_j \333\274\272\351i\30347\245\336j\303\320\355@\262\361a\302T#c3'\344\205\020\270z\317[\302m\274\245\224\022\027o\3609\360\252\315\344\2230f\022%\265\331\001\0220\225\314\262\205\272V\317\3244uM}V4UM;+[M{\025R\267\212T\266Z\246\252Y/'\034\345I\230gf\253H\372\255\355\002%L\265\2558\266\352\254g\2156\325\314G\rG\272\270\352\221\237\243P\316W8\304rn\026a\253F\352\221\017\224\370\270]=\265( \252ft\314\274\335"
+	.ascii	"{\342\357\322\360wed^\307\220\260\346\306\225z\305\354Hij\342"
+	.ascii	"U\005\243\3250<hXd5M\374]\027\366R\315\352\227v\326\263"
+	.string	"O\251U\2240\353Y\r\253e\2156\025\224\263\025\027\363\254B\251Rl\223\231\363E\206\3113\347\234\201\003\007\016VF\222\036o\360\255W\312\252X\277]P\344\251\266\325\245\222U.\355\254eu\313\253\223\372\344C\034\324\262\252\245\303lS\f\267x\002\244\254b\251cUDE\320\324\266\2068p\250iT-\264\200\357wZ\370; g\253Y\256\346f\231E-\251\367\273\036\370;\035\370\273\0318h\367\204\253\374\034\203\262\022\231$V\332Y\253T*v\006\224,U\367~\247\304\337%1X;\253\224\032\245\233UJ\375\352\261F\233\312G\267\016\216\210\251m\rqh\2664Ep\230\341_-\370\227\n\376\365\302=t\223\340\332d\350g\252\211\254Y\357/\026>\007\177\321\222\332u6\rJ\312\214\324\261"
+	.ascii	"\270<\206H\\e\322\316\272\344\037jf\016Cu\355F\327\230{\177\223"
+	.ascii	"\370\226\016oh\203o\237G\336c\225\314\231\013%4\370\315\276\300"
+	.ascii	"\333Y3|;\206o\247\340[/|1\213\004\337\022\301G\233\252XRMd\311"
+	.ascii	"r\306\025\276\265\201oc\\\340U\026\254zZ(\347l\022_Y\325-8,\\"
+	.ascii	"U\257V\375V\337\330x\250\251t\270\363\033\254\223k\033~\025\203"
+	.ascii	"_\265\340v\352\0134\246\222\004brPA}\261\300\277axH\214l\331"
+	.ascii	"\310\241\300G\231\030@\272z\214\207<\262\311Q\357=\373\335\002"
+	.ascii	"\265B\210\030\027\030VKBK8\313oY\226\353\245\341\272\231\247"
+	.ascii	"\226G7\frx\331\341%.+\251\210\216v\3440\353\362\353\305\214W"
+	.ascii	"\007E\254\352J\027\tC2\245\336K\366\313\345\327\311Q+\363\305"
+	.ascii	"\211\025|\265\374n\261\021#\315\026\330\330\257\323\323\303\f"
+	.ascii	"\214\233\023\374 %S\246\\\261\n\270\360(\243\350 r\257\374\212"
+	.ascii	"\361\332v\250\031\251\367R\271a:R\236\324\224j\230\025 !A\220"
+	.ascii	",\333\316\325\202\214\331\255R\323\256j\320\231i8 M\026m\264"
+	.ascii	"\300\300\322\364S)+(\352\353\353:;\250\251\244\306\306\354\321"
+	.ascii	"\221L\323D\356\311\223\353\034\242\363\222c\263\001)\026\264"
+	.ascii	"\352u\372\214\201:\223\3014\233\327\213\027EL\234(,\245\205d"
+	.ascii	"\205\353e\247n\013dus]I\222\\&Cu:\344\330T\260\025\260d,\371"
+	.ascii	"er\022f.\220\267\253\310U\326\326U\002\304\005.\207X\275\007"
+	.ascii	"z\201\377\303\006\337\3105r\271\206\226\307\266\013\226`i\343"
+	.ascii	"\026\227\363\024\021/\315S\206\\=\362\3135W\201/ \307\257\255"
+	.ascii	"\273\325j\206\202r\266z#\266\363\204K\335\322\020\374F\322\027"
+	.ascii	"\371\033\243\235\027y\211X\345T\216\321\341\nU\007\336U\324\323"
+	.ascii	"M\275C\232\311\034\244\232\231.W\370\335\025u\245Z\270r\247\322"
+	.ascii	"<m\334\033F\302`\325\257z\244\013\315\305\2729.\217\260\270\242"
+	.ascii	"\213uk\364X\222\265\037\227y\205\\ \327\307\315\272A\332y\261"
+	.ascii	".\216_\031w\306\305\2724\200\330(\211\"\025t\243\316\306D\315"
+	.ascii	"\216\333\243\235\227\307\345q\227\227\005+mnb\0318\370\270\245"
+	.ascii	"\255\331\340\261p\257\2524y\274\325{\255r\246\244\276,%u\264"
+	.ascii	"\363Va8.,p\316\306\303\005\313\nL\275\3779\342\373\300\301\367"
+	.ascii	"Qs\251p\231\347\2155|\2374|\2373|\2372|\2371\374_\251#N/l\300"
+	.ascii	"\\\301\225\250/\360.\214\373t\241~\035\240$b;\250D\301\277N\027"
+	.ascii	"\300\nC\245\336{\233~_|\021\302lr\202\177[\\\027\277\316\317"
+	.ascii	"Z\020)^I\360/\013*ulh\324{W\300L>?2\330\271\021\226\343\256\360"
+	.ascii	"\337d3\271\312\017\210\240\216\316M\275\227\351\256\370U\336"
+	.ascii	"\245|\225\035,sF^%\320\\\316H\240n\013\272-\270I\254\204L\341"
+	.ascii	"\335\373\360\300>n\212~\225x\300\220=\233\324{\237\027upn\356"
+	.ascii	"\271\":49\374\2364|\013\247-\035\035\023\013.\352Z\223\223\243"
+	.ascii	"\313\351\322\002vU$\316\306mY\366T\301\301\3316m\030\274\271"
+	.ascii	"Z=\222O\332\360\226\230\364@R\357{\\\270\231\261o\226F\bK\036"
+	.ascii	"4y\362\304\341\363\214\301\267j\332>\355\263\252]\260\245\311"
+	.ascii	"\223\005\277\253\032\317i\331\352\323w\311|\305\305\314y\252"
+	.ascii	"\203\317\220$P\224\252\244I\323c\355$\303\330Y\361\244DK\\\316"
+	.ascii	"e\035.\335\0323>z\340[3m\327\314\3303\226\211\217N\370\n\020"
+	.ascii	"\345\223\247\n\237\247\006\256m\231<2dl\231\312\314\371\242B"
+	.ascii	"\367\274\313(7]i\267e\250p\001\3026\325\333\202\025\007\003\213"
+	.ascii	"\021c\313J\310\030\232\030\275Y9S\357y\224\302\2049\363\206I"
+	.ascii	"\"\213\221\374\304gg6\f\347\f7\232q\240\342xfZ\350\202\365\005"
+	.ascii	"\337vi\373\305i\277t\030QF\"/\030C\333\t\303\357\016\343q\341"
+	.ascii	"b\313J8\332X\306\201\342\312\201j\363\302E\231\316\020-+\027"
+	.ascii	"[bbvK\005]\232v\007\231\027\026\253\345v\313\317V\020,]\365Z"
+	.ascii	",vl\367\365\302\352\313\216\331,;X\252\024i\263+\312\244iR\366"
+	.ascii	"\330\241b\202d\215\017+Vl\330\020\027&\025\221\217\026\263\307"
+	.ascii	"\230\303\335\206\355\306l\005\231R\357wnL\261N,\225\232\fa\005"
+	.ascii	"e\316PEG\362\216\013|\2357`N\013\326oC\371\330\246\001\027\247"
+	.ascii	"8Pqk\2408\261"
+	.string	"_G\234t\314\360u\242\340v\332'\255\306*s~\312`\215\330\256\311\024\234#\223\t\023\353\205A\021\264\346\255WU\333\261\232\341\224\253\3276\251j\225\314\271\246\244\023\205\255\022\253\303v\365\333\206!\3158P\\\331\251\331\341:I|\374\264\\:,\222o\271\031,#\241,\030\222;\034s\301\307]C\254\021\334\3140\372\312s\212\b\217\201\311@c\213\334\032\251\307/G\320\354\226\017(-,m\335j\275\255A\223\331\200\304\004\2011\243^K\244\317|\352h\200\325\250\302VH\r\263\342\354\311\023\246\272A9\311B\017f\207\2566\332YBFBm\030{\306\201\212\273\365\021\251O\210db'$1\244\240\230\242#R\b\211\303\241\257\247\202p\270s\177\342\027\364\021K\004\201\2510\330c\224\004,n@\211>\244\037j\264a\230$\f2\241\202px\213)\260\304\007c\360\210\001)\214A \022\003:"
+	.string	"\321\003\361A\212\017\250\221\021\351\027\004~ \026\215\037>\250 $\236H\205\301\034\023>\024\351\246\305\240\360\2673\221\006\201D$\236\212\242q\204\242\261D\216\0064\365\245\360CSL"
+	.string	"\004E\037\t\224(\f\036\2310\200\237\360P\024\022\177\300$\336Ox\260 \355\371R$T\004\017\232\004$\221\246@/\220\242#\210(\222\321\b=\361+f8\221\372\222>\004\205II\302\237"
+	.string	"8"
+	.string	"\301\017h\f\001\005*\206\302\020\025\244\303\017G\303\013\277\240\221'h\242\022w\305^O\332\013\036\rw\301\243\241=\221\036\005Q$\036*\002`\361\252\030\n\177\227\230\016\255\021\032<\002\"\371r\214\320\242\361\376\320b\316\211\275\243\241\007\037\242\357\304\357\252 \246E\340\021\232\302\005\r<\030\241(|E\fH?\025!\222\210B\023Dt8"
+	.string	"\324\310\230\002S$\0210\\"
+	.string	"\341\241\250\001\243\b\fI\306\021@\273\237\360\360\301\b\th,\201\032\tO82\226@\215tv\r\360P\314AS\237\321P\003;#\024\201<H(\n\324\002FA\243\220H\201\024\0351b\204\243\340\257\007M\205!\202B`\352#\226"
+	.string	"\"\371B\024M\310\220\376\320\024\025\261\203\022Q\350\200\002\n<\250 \tM\213*F\364\220|\251\220\004J\314 \264\201\007\025F>4\205\244\013C\034xH\201\032\005MH\203(\221h\374\t\240\027$!E\213h\nG\303\fh\017M}\351\210\240\364\242\275\021"
+	.string	"\370/\350\003\032\241'\214\240\002i8\364\t\340? \021\r\242G\370\035\200`"
+	.string	"\210\017R\344\374\003\0204"
+	.string	"A\003\336?"
+	.string	"\241\250\b\004\020E\370 \212l\221\207\342\b\"\232\"\001I\030J{E\r\240I\300\024\027{\274\364'<( D\005h\352C2\376\220|?\235\364\210(\002\b~\276\022HH\276\037O1M\201\362\244=\021Ec\t\236\242\261\204-\366\200\303\021F(:,\356\322\036\006L\270A \n\301\342\217\207\036\031M\340(\b4\362\241H<\300a\321\026{!60!M\201\342\337\006@\373\023\036\212F\024\005\220h\224\241\330;!M\201\372\344\240(|H#\214\303$l\354\351\244 a\002\025\221\002\203&\364D8A\004\320Ox\260"
+	.string	"\t\023F|H\321#\242/\335\220\026\321\364\246H!\005\006\201<\021N\020\201\026\215\274tg\3028B\n\342\256g\204\006\201%\222\204?\237\324\210U\370\220P\243\336\320\210\3234\035b\300\207\350K\213xh\354\031\371Pb\0161E\341\0274\222\220\242\024\030\032{)z\304C\201\032\331\024I\004!\3217B\016J4\246>\":LBI\240D#\n\305\036\nT\204N\332\333\200\2034\b\314A\022\nG\350\355\322\2370\300\205C\224\370!\025\n\211\037x\210H\277\024\305\336\021\320DP\030B\b\035\252 Q4\226"
+	.string	"\n\026\177=\340\260\210\376\200(P#\240b\021%\032\031\371z\277\r\200A(\321\247\202\021\321w\302'\355}\220\223\006\215\302_\017E\032&\371\212B&\206H=\264\b\024\006\177\322\036\210\2424\b4b$\024E\317\304\257\307\223\366\216|$\204\300\234\027\025\205\330\240\201\013P"
+	.ascii	"\377<\020\321\024M\372P$\n\213A\264\370!\b\364%}\370\021\213"
+	.ascii	"\037<\024\340\310\227\366~B\264'$\372J\364\274\311#\206C\212"
+	.ascii	"\f3\273\025\205\313\f\013/_qaPM\262\025i6\224lZH\256\272zw\310"
+	.ascii	"\035r\307\324\331\311\001n\2362\210\376\335\322wL2\334,y\355"
+	.ascii	"\222O\253Zb\325\373+;\245#3\347\034\264\203a\306MY\032\276\020"
+	.ascii	"\026\374\357\216L~\234\324a\305\355\362\355\265+$-\352\254W"
+	.string	"E\323\"N3NU\303R\324\240\265\240\273\316\035\272 `\342\346lVm\222\232\"\003\316\025\243R\345EK\3162\263\244\344\234\3347\313\250\037<\210\324\233\245\331\005\003F\326\322\315\345J\243\233A\246\336\373v\337.\\g\2476\017l</\233_85\366\fK\313\031\326Dkj\007\227[\207\361\244\226\340P\251m\326\210\225\333\222\037\365\256Ys\3314`ik\343V\302\026\225: f\277h\314.\333%\313\231\311\351\307M\2276Q\267\205_\266_\321\261F\203G\2757\315\257<\314k-\353\314\357X\216\243\326\221z\357\230\253v\327\254\344\220M=\360\257\231\273\246I\220\265zo\031\314$d#\203\333bJ\234\263\336\3372>TD\256X\250\367\222)\372M\333\321\370\242#\253^\0360\027\355\006\204\032\250\343\202\363\201L\272%9\305\220A\206\212F\233\24413\024@PXL,\235\017I=\037\023"
+	.ascii	"\225"
+	.string	")\324\231\032\267\212fd$I\241F\233\001\262\022\345\373>-\210lZp\240\254\022\n\357f\204o\001\341&\224\234\340\317\013\262[{$K\332\013\252\\\361R[v\323\264Q\036@d\226\301~\016\265v\036\347` \023\232\261\025\223r\315\037[\236\013#b9\230\332\344U\r\320g\206\321\276\331\342\f\027BJ\267\"\351\330\005\255\001\237A[\214D\320W\016]JfE\026\247ZZ\002t-\221\306ca\317lcy\034\2106\2404{e`)j\032%\203\263\221\2259\252#E{\217Gx\262yo+\215P0\333\t\227O.\234\323\241\341\362Wp\354\311P\247\203\221\262R\224\252AP\323\242\340\314\374\201\021\251J\371DY\216Z}\375\372!\320\350\246m\256;\353\231\233\267\205\005\261\226\007j+o\377\024;\362\034~\320\205M\3130\324\336\210\251\304\374\203\242\220|`\254\356\031\006\036\257\267\265\256\262"
+	.string	"{;F\220F]MC\225e\017_\201\207\200q\311\331\275\374=\311\247c\013\303J\332-\036\200F2\212\211k\f)\310y\022\273\312\257\021=\341\364\216#\025\306cp\360\"g\304]5\027\311\257\254c~j\232\240\370\340?\262\347\253\323\231\213|\313\353\006\201\321\007\250m\315\303\022\236\r\242m\353\264(YvTt\255@T\244!\f\t\023\241Y\271E)\205\330SQ:\275\3037D\263\023\201J^;\263{\251\267S\034/p)\260\242\3007\215:\221Jwp\371\351\354\013\267o\320\024\310/6Z\020\353\016\247\270\350z`\356\337\b\221\333\260\f\275X\360\332\356\372\026Kp\332\273|S\037G\202\316q\210\025\177\333\356\307\273%5\213\252\356\247p\002\035\033:\351\372yt\204a\362\372\003\024\230\346\001y\0046\202Eo"
+	.string	""
+	.string	"\326\216\246\361\034H\272v^(\232qt\300\006S;\256\310qa\366\034>\376\212\306\2339^\2161\035BB\3333||\336\210\030\332\306y\240;G\373\3717\200\203\330+\265\362\035\221\346\353\370\330\001\300\316\3466=\252\334\026\246\317\253\3728\037\347 q\251L\213\243\326\255su\235\217\306\366\246\211\267\206k\361\271"
+	.string	"\232F\0328\226a\200\246\256gnd8\337I\025\001cL.6\r\2458\371r\305\2100L\330\316\364X\343\326\013\330\200|9\310\nAD\375\3649\205\037\\\210\320\366\350L\017\365\233~b\375\255'\343\351}H\265?@V2q\234\367\2059\334\240\n\001N\221\226>1bS\201\246e(0\370\227\001\200T\334\275a\303\317\364\nv\002\227\225\247\260\035\0043[x\357\237\217\225\247\033}\252\013m\315j\201Q\371"
+	.ascii	"\341&\004\244i{G\"\001\210\235\231\021\302\003*[\\\227\343\026"
+	.ascii	"\032\3474\344\2144\030q\265\024\021t:N\261\357"
+	.string	"2f?=N\263\3513G0\376H\372\323\256\344\375\207\305B\372\\%.\360\023\002jrS\206\013\235T\253\204Z3\200\343\365K\215=^\007\324\365_9\360(\020`\276C0\"\377Y&\242q\313Xoh.\\\314^_d\030\3312f\354\314M$\365+\203\247\234\r\207\303Ob|H\220wK\344\326\370\270l\2714\035\003\367-C\201\374T\224\302\311y;|\234)> \327\317\031\247\317=\004!j\317\2430\350\204\027\016\036?e8\277\220$\205`\301h\017\\\277\327\001\ne\255\364Y\373\025D\3024Q\306r\207\206[&\2536\2569\244\301\032\334\315\342X\227b\241\2441\342w%\r\367`\216\005!V\027\213\020\367\210\2302\360n\304\357M\023\r\356\302::\330\242sHF9#F\361\351\341\b\204\305\3329\304D\351x\340\031\333d\343\334\255A\324\305G\002^:\360\027?\372\034b1\266"
+	.ascii	"\365[\361\324ef\255\366\367\007\004\2350Da\273\"R\021\270Z\275"
+	.ascii	")O;\030\305%+B\232\210\275\367\272\211\203\347\334\223\002dE"
+	.string	"\340\326\223\004\252\224a\360\204\371\377"
+	.string	"\206\n\340c5\305W9\345\004\222i\331%\305\276\223#S\340\206p\350\364?Nmpq\030[\216R\363\032\037\360\033Vy\311\215\263!\372:G\266e\2070\360\377z\221\263\212\344!f`\033>FR[\367"
+	.string	"\354\214\002\023o\034\035;bo\240:B\327>\212\035\305\006\315e"
+	.string	"\322%8\315\350\240\246\354m\265\237\222=\271\025\334\215\336\272\352\227"
+	.string	"\274%\332\t\271\356\214\270C\016\204\026?\252L\327P\225\313\237\346\204\1773\312\216s\301\221z%C\254S\202\350\317\211u\244\347\223+\367\006\343,\032\212\211\356\376b9\003\256\027\261\230\361\260\366\202\373H\235\235\313\205[\352\033\343\244\227\370)%\201o\226\364@\325O\255\360N\231\r4\354\217\252\246Q\370\274\3029\304K\333\221\344\374\312,\235\033\200U\373\177\327v<\330\310ruOa\354\250FH\366\302\0047\254\324` h\257\212c\352XZd \340\032'\201\254-\343\346Q\352\315>-b\207(\203V\347gy\275L\347\314\b\311\346h\252\225\270R=\f\037\340\227;\b5(m\347>\227\300i\001\315J\310\034\354\377\206\260\020\305\f,S\346%"
+	.string	"b8]\200$\263b\3017)\357\225\023\031;v\236\020x%$\222]\274\356Ek^\\\244\031\2610n!\361\"\250h\265\210\253\027\366\346\243\216]{\236\361\200B\327\235\006\025\242*L\240\373\013\262T\013\201\373\377\366\2075\360r\365\023z\212\324\214\333\251{\005\263\306\026\256\201E\216Z\034\221\246N\262\367.\330\030\325\200|\354\300\035\215\"m\263\214zp-t\327>I\205UO@\307.\316\320Hn\202|=\202\324p<\330\350\"\fm\304\320@\025\t\271"
+	.string	"k\230\255B\222\034;Z\274\334\223\304x\f\\\t0W\326kg\261o]\201\037\364\243V.K\316\373\\\027'3\3170\232\002q\230e\235ZAv\334\330\033\024\322&\rn\002a\225\373\370\240c\242S\323\276\002\021i\372\331K\\\266!\007\225\245~:=-"
+	.string	"\327\254-q3p[p1\344\227DAxRO\263\013\331\214\030\342\"=J\336Y\210V\331Vx\313\334J\252\311\f}K\260\305\357\306gJ:`\220\r\360H\231\321\336$A3\303\303w\004 7\304O\331\235*`\236^UP\314\353\2577\271\376\3169=\355z"
+	.string	"(\304L\t\326a\264(\305/x\302\375\2062~\215\274\003\020\020\n\341\234\227\306\233"
+	.string	"G\307i\321\300,\230\246\033\304\233\350\031}\252*\243\270\357~\r\356\343\004d@\252p\373\216\312Yg&\235\033\250\264B\250\030\030\224\373\330\r\246P\322<*{D\231\265tA`\020vm\244\317+(\223N\305\033\313b\205<\351cA\t/\206\222\230\212m\337.\220\225,Q\216\320\226\033\307\354w\335\3375\254h\244\n\334bA\302\343\034\231\"\321O{\013\202\022\321\205E\342\210\351\277\032\242\030s\003\356|\370\311\f\324{\236\361\305b\202\272\037w\224\026\033M\324\236r_\007`\273\266\225\303s\375OL\273Q?\245\270\367\270\021\030\271.\336\003\315\227\267\347\2463I\177\257\276\332\037\302*\263\207\201S\365z\276\347c\322\344\225\371\333\007U\276o\313W\316\213\274<"
+	.ascii	"\006G\256\332p\177s\327\250\271\235\243\177U\337\230:\207\271"
+	.ascii	"\251\037\355\222\217\324ot.6\3770`\332\371Mt\267\3453x}Q\374"
+	.ascii	"2ee\341\035\036\221\373\347\272k\247\373\203\323~\341\316\002"
+	.ascii	"\337\026\034\3134\314X\236,\037\b^\302\303\023\361\325\344[]"
+	.ascii	"/\314\353\243\337\313\003\363\234 K\240\337J\356\t\327\\\365"
+	.ascii	"\316\325\356\332\355.\033*IL\200\344=Y\272\334\344\345\207w\303"
+	.ascii	"\202\265b\364\2113\366\005\265\003i\370\225}d\344\356\341H\354"
+	.ascii	"&\352k\3601\364\227t\233\255\252n\303\216\375\327\025"
+	.text
+	.section	.gnu.lto_.symtab.af011b2140184192,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"schedulerSetNextStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"schedulerIgnoreTaskExecRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"schedulerIgnoreTaskExecTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"schedulerIgnoreTaskStateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.af011b2140184192,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
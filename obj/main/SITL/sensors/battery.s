@@ -0,0 +1,1522 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`&\002\025\016"
+	.string	"d\022\032\003"
+	.string	"."
+	.string	"\254\372\361\363\002\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\241\352\323\246\005&\002\006\002\007\002\006\002\006\002\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\n\013\246\300\251\343\t\002\f\r\311\215\301\376\005\004\b\002\t\017\347\217\220\351\016\b\002\n\002\001\002"
+	.string	"\002"
+	.string	"\021\253\205\361\212\016B\001\007\002"
+	.string	""
+	.string	"\001\022\023\025\313\322\375\213\007"
+	.string	"\026\354\206\342\366\027\030\031\234\236\237\233\f\004\002\013\002\f\032\361\220\342\261\005\033\337\350\261\333\n\032"
+	.string	"\r\002\001\034\035\204\225\341\235\001\n\r\036\352\263\360\321\b\037\373\310\241\374\006\f\016\002\017 \336\253\202\201\b\016\002\003!\314\344\207\235\n\006\"\355\241\206\304\017\002#\250\267\374\351\002\002$\300\253\277\314\017\007%\205\246\225\244\001&\317\356\361\267\004'\350\300\306\254\005(\251\246\365\313\f\004)\234\345\317\377\005*\367\345\303\353\007+\207\312\266\244\016\002,\320\374\270\356\001-\325\241\220\227.\317\266\256\202\001/\355\220\274\212\0060\240\342\234\212\n"
+	.string	"T\250\241\2611\"\206\322\244\225\003\200\002SCc\007\021\200ECe\333\312fh\354\357L\251\373/\017\035'h?\003\265"
+	.ascii	"\321\335\351f3_\225C\002\202\016\307\022\360x=\r$d\222\216\003"
+	.ascii	"\300\032\3119v\214\002\035\242\005\247T;\373\211\203\230p\035"
+	.ascii	"e\251yo\022\215\224\354uP\227\256\252\020T\251nk{\033\315\305"
+	.ascii	"\306R/GZEyM\003[IX\270\217b\221\020\005\373j\206\221\243\216"
+	.ascii	"`NmS\326\374\260\371\226\023\026\235\276\245\304g\3355\244\321"
+	.ascii	"\323\261\n\363y'\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \314\275\003"
+	.string	"2\005\021\034\220G\303\001\377\377\377\377\377\377\377\231\377\377\377\377\377O\226\215P\032\240ZtMF\246\256b\023\213\330\303\032\266\260\204\035\254`\003\013\250&5\255\264m\313\350Yg\233evY%\0312\217i\350\332\204\\\004\025"
+	.string	"E\b\243\263`\346\335\235\246A\233\231\020p\001V\260\003\307\252\262\2222"
+	.ascii	"\240hQ\342jF\304\274\033\224\221\234)\260ae\360K\030\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\366\003\035\r"
+	.string	"b\317:: \223\322\001\204@I\003N\bf\315\205\271'\261\3002G\274_\210\211B(H\275\031\326\007\b9cS\t\002\302\005"
+	.string	"\223\013YW\325\255\353V\341\273L\324\263\332\210%[\356\024\266HU\240(\252\350\257!OHD@<8t\310j*"
+	.ascii	">\205\266\344\177\347\006\326\366\374\365\364\372+\311\246\323"
+	.ascii	"\231\277^\200\033\376u\301\f\366\364\212\334l{\240:{\271\260"
+	.ascii	"\244\326\246\256\035\177\306\030\225\025B\362?\312Eq^DD\223\023"
+	.ascii	"(\327\202p`\240\261\324\244\215\377\325\246.\360\212\004\267"
+	.ascii	"FG4\231#>0'\036\246\231 \200\332S4ArHxF\224\346#e\034y\340\333"
+	.ascii	"X\013\262\300\f9\373\243\036\025i\345\215\347\256[\231\214\r"
+	.ascii	"G\006\270(\265\225\020\fo\353\375\366\3779\273\265d\fV\252\326"
+	.ascii	"\236\255\235\305`e\311.y\333\tQ\250AY5\001\021\325\312\306f`"
+	.ascii	"\002\231\271\252z\022`sA\304p\214@\032#\240\b\t&\230\231\370"
+	.ascii	"\371\216\356v\363\343\237t\324\274\020\006\361c\202\332I\264"
+	.ascii	"XA\177\004\203Q1\211)\207\035\322L\230\016\276!\362M\026y\227"
+	.ascii	"\201X\205\242;\3224\302%\321o\177\344|\201|\203\020G\356\256"
+	.ascii	"\223\272A\374~\235\300lPB2$\366P\352r1\2017y\313\311\n\r\312"
+	.ascii	"\037\305\231-\316ye\3628\034[\007\034c\020\r\325\217\330V{\300"
+	.ascii	"z\026\267:\201C\261\360\t\035:\003\207\351.\263\206\231\371\343"
+	.ascii	"0uA\327R\247\214n\3133\024\236B\205ik\201?\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"e\006"
+	.string	"\"\313 )pK\222\306\374\377\277\252Aa"
+	.string	""
+	.string	""
+	.string	"8\301\372\377\242\325\252\252\270r\375\377\377\377\371\327\361\223\021jM0\r1\304n\231\002\307\370b\213+\246xb\211#\206\370a\2077|\362<\317\203\212\251\325\306\360\205\025\032\206YF\252f\233%\201\362\203\r.\230\340\201)\367\324\001\347\261u\354\235F*\324\254\222\266J\252\345(\344\024(He6\031`Y\206\234\310\220\263\221m\244\252%\021S\rd\213p\037\001\035"
+	.string	"\030\206\333\243\340\324\026G\314"
+	.string	""
+	.string	"\271l;\375\230\305\316X\007*{\301\2460\260\350\254Ak\005\254\301\3073\204\340="
+	.string	"!\003\270+\r\241)\265y\246\320\340\223\232SWx\232\202\306\200\020h\346"
+	.ascii	"F/\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 YM\002"
+	.string	"\222E\021\032\220\2730\006\177y\363\377\331\377O\r\327u]\327f\273\266\264\031Qj\275E\006\376p\2077\234\341\013Wx\302\021~p\203\027\034\301\r\234\300\003\016\340$\217\034\362\307\035#\215c\334\342\024\2278]MU\005\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\355\005"
+	.string	"\262G\026\036\260'\303\001\f\3030\f\3030\214\300\032\2425K\bQk\233H\333\373\0253\261\272\265$SB\036\212\347\343h\032\fu\241*\230G\235'r\032f\271f\307\274HQ\t%\372\n\211'\3429\202\016t\335z\256e\267<\025A@=\235awx\325.=\323\016\r0q\221/ \320\002\021\233\365\246\210"
+	.string	"\276\207\036\254#\335"
+	.string	"\036n\211\231\bD\022\374\007\361}\260\322:\241\3661\244\323\200\002\362\242\352(\221\223I\205\201"
+	.ascii	"\350\300\353\200\206\353\344\"\032\230)\306\036\230\360Y\030"
+	.ascii	"\242[1^\3063\254\025X0\336A\363\322L\027R\212\223o\3156_Q\307"
+	.ascii	"\301\212E\036Z\241\334"
+	.text
+	.section	.gnu.lto_.lto.2b94bcafa62a7f8c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.57.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \242\315\004"
+	.string	"\264\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\345\301\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\213\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.59.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \263M\004"
+	.string	"\224\006\246"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\002"
+	.string	"\n\036\005\001\006'\001\232\003\001\005\001\006\177\177'}{\344'\001\254\002\336\312\256\003?\202\210\200\330\002yw\312\001u\311\001s\310\001q\307\001o\306\001m\305\001k\304\001i\303\001g\302\001e\301\001c\275\001a\300\001_\277\001]\274\001[\276\001Y\275\001W\274\001U\274\001S\273\001"
+	.string	"\016"
+	.string	"`\b\230\013\216T\354\201dZ5\001r/\307\204j\217\247Dp\002\332M\021e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.60.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\226\002\035\024"
+	.string	"\306#\201H\240\330M:\302\267\217\230\031\275p\367\270U\207\f\037\322\332\212^\200\357BEv\207@XX\271\n\023\310\314\232z|\203\215\252\207\227Z>r<\270\347T\336\"\246g\351\035\220O/\004)\300\262:\3777b\311&{\247\024l"
+	.string	"d"
+	.string	"r"
+	.string	"5\340\253\201\313|\257\336\005|\257\256\331S\276S\332C\261\b\202\332\332\335\220\326x\3550\360\365U\217\316\232\217"
+	.ascii	"\207\026\251\263\035\366\233\321\301;\0212\272\323\017\354\020"
+	.ascii	"*\232\257\027\377\202V\314\312@\312\273\323=\0377\236\220:\242"
+	.ascii	"SO\006\213\206\224\027\035\316[pt5\024\243\313\315\371\222\260"
+	.ascii	"\273\236\244\316\305\355r\3330lC\260'\217\337\244\004\236\242"
+	.ascii	"\344f\026\333\"\376\364\003\356\346n\374 \0272\363\227^Mb\234"
+	.ascii	"'_\375\361{\2354\302Py\304\324t\233]\366\0167"
+	.string	"i\222}ow\327\024\311~\323\377\325\351\352M{t\232\316\351\031`C\271\225\245\200\312n\213.-[V\":^l\177\332\007r\246\332\233R\030\266;c\212jw\327\300\001{\203\304\243\237\262\361o>\347\243\324\304\213\334H\216\277d\f::\337+\245\257[\223\036E\265@\025\2253\354d\225\271\030K\003 \212I9\253\256`\311\360\006\314\357>\305\003\356\336N\372Q\227\342\320\201g\236\344\371<|vO\314\345H\251\202\332\f3\355\020>\363\244c\242\254J\034\265\031TZ\241\335\245\001a%\204\245\212mr=\007yT\322\243\b\343\216\354\307G\003\rH&\212%b0\216\331\234\020e4Z\317\207p\024g#\220l\f\201|z~\302\2308\20663\236\215\220\211!m6\023\303\227\335\355\336R$_\340*o\024\007K0\355\332\217\032\023\245\266\2034\311\267:\2453DZ\257Jm\327\374\252\346\344"
+	.ascii	"\312\356>\360\225|\311\004\n88\337\353k\bi\305\243\225>h\213"
+	.ascii	"+<\211\005p75 \200\002\031),\017cB\007K\214|(\367\006m>\327E"
+	.ascii	"FQ\"cJZ\330\004\257\007\211\346\330\300s\223K\326\314!\215\256"
+	.ascii	"\227\207\350W\214\255\305\263\211h\366\234d\376\321\261O\266"
+	.ascii	"G\203qw\327\340n\374\236J<7\024~^\020\355\037\001#\007,\314\002"
+	.ascii	"\033\242\356z\201\3266\300\365\355\"^\243G\227|\223(s\236\331"
+	.ascii	"\345r;\020\364h\346\253(\307q#y14\202\330\003"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.61.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`@\0015\r"
+	.string	"\326\327VC"
+	.string	"q\234\016/&\372\321\272\033\370w\344\235M\002\322\350/Y\021\227r\250\340\343\r\361\203\023\331CHW\304?\252\247\234\301\254\252\322\2156\034\355]%\200\240\252v\316\002\325\2105MD\036\210h\223-S\nD"
+	.string	"@"
+	.string	"E"
+	.string	"\237\317\034\262O\036zlEEBA\304\306\356j\262\303C\237\227\324\220\257 F>\320\373D"
+	.string	"\343\372\307\257\022\254\032\037\210\341rD\302\b\254L<"
+	.string	""
+	.string	"KR+\tv\327\372\201\027n\354\266\031\3306`\377C\022>\372\357\323\377`\237R>\344\272\201E\342\004b\022\351h\207#\225*\373r\034\307\024\313\224\255j\211e-f\034(\331\2550\336Xq\276\ba\373>\310C@7a\245a\332\335\354\323\006\331Y$\351\371*\236e\020=\305\361\225\311*\206$\361Y\250\365\333R\211\210E\211\370+|b\331\365~\372=\330\247\016\330\t\252\026\312\356^\236\302?Y<\326\302\206{\371\370\002\031\250\024\024\222\346\260\037\376\204\307g9\326`>\334\246\323\3114\320:n\3538\233N\3438\310<\3204\\\247a\nx\203\260\341\264\316\266qZ\026\212~\255LY\201\013Q$G>\212\377\332\335\235\225\021#\017\320\342pu\250\345\033fG\350\364\237\005\2644\210\001\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9\024\335\3511s1\263\215d6\026"
+	.ascii	"Rm\327\0055\240L\27441\3169\230\302_\016i\032s\252Q\340D\347"
+	.ascii	"\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.64.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`v\f%<"
+	.string	"\nc\310\025AP\244N\007\243xBX\263mH\323\307U#R\260D\214\310\225?Q\330\266G\2613\035-\2733=\0336chU! \210\200\020"
+	.string	"\024\023\020\227P0f}k\016\024\325\0214#{\313\275SJ)K\001,\001R\001\374\251\263\277s\1778\272\301\231\340\327\266E\242\202\3327*\232\266\016\323}\327]\246\237y\216;\217\213e\240\330\037a\354\030\273\263\301\266\255\243b\361\250\334q\213y6f\315\006\323a\270\355\270\370%\311\243\3478\353\f\2126\327u\334_\272K{\341\321O\326s\362\252k\305\3261\266\3019\251Vy\212m\325\251\223n\253i\037]\036\314M\327N\037=\307\017\322\3705[e\366\301\\lU-r\222YO\327Mi\333n\251\004\003m\333\226\352\245t\262\231\226\002"
+	.string	"PJB:2*B\036\215DCE!\"\273^5}Or\257W\006\350\362\226b?\232i).N\030\234\007h6\200\246\022[\233'\2619\2578R\234\025?J\223\342\322(\267\260*nt\244\244\333\2236\026\327Ek\215\\\233\342\307&ml\202\346DCi\324\340\231>\035'\354,M*\302\2664\363\342S\332\030\223\026b\222\327OnaK\234\270^\245\215\2355[\346\026F\346\253\234\322\257Z\024\373\362\324(\006$uj\333\266\361\274\374\323\004p\240\340\3518aTR&\264\275#-\327\016&\326\345\276^\265m\313\276\024\033k\026\320\314=\310\314\020\230\213\037\002\317=o\326\273\013^\3013\361\371r\353\362(;\370\005\277\352)\017\253>\352q\264E\225\207}\326\234\002U\245>\306\323\357D\373\365I\375\321-\n\307u"
+	.ascii	"\r\232I\253\336\301/)\211\242\350\275\024l\333zI\340n\323nV\260"
+	.ascii	"h\321\342\266\352\3401\2549\033\217]4\233,\266m[\t\334jz\r\f"
+	.ascii	"n+\2552\226\f\031\267\325\252o\274^0v\370\307\331g\370"
+	.string	"\300q\362\ru\375_<\371\274\034\020\037\243\321\350\240\206\272\375\376\375\205\326\325g\032\315\fn+L\303\206\367\322\306m\265\277(\307\016\216\214\313\243\314u]\376L\346N\333WcV\235=\254\316\035Vg\016\253\363\206\353\254\341:_\255\316\031:L3\206\325\371\302u\266\260:W\270\316V\2533\205\353\\u\235\035\260\316S\327Yju\216b\235\241V\347\005\253\263\202\324\031\301\352\374D\340:7\255\316L}\327\274\304:'\261\316H]\246\371\350:\033\251\316E\327\031y\235\217\327\331x\235\211\256\363\220\352\\\\\235\205Tg\242\352\314\256\316\353\352|\257\263z\235S\325\003o\364\346CH\b)\372\bo|p\310\345\226\244\034\230\343\017=\362/\037\027\017\242<~\325s\357\217\323\370\354^\016$+\t\227\224K\312\335V\177\320\222\220\350\207\336\370W\217\316\271R\370\017\242o0\201\316\342\017E\213\337r\315"
+	.ascii	"\312\036\034\031\221\223\013=\263\006\016\336Kv\362\372\037\214"
+	.ascii	"\340\205\320\304\t*\017\243\ru\217\036\201P\340\334\226\241g"
+	.ascii	"r\317\361!\"\3046\013\373\210\004\376\350\301\232\256\007b\332"
+	.ascii	"3\260\273\351\022\337\303\263+\311\240\036\210\277\026\252\201"
+	.ascii	"#c\373\364\222\360\350\331\357\021\267Fy"
+	.string	"X|&\362\255\214\214\320\253\261\353C\231\005z\366\255O\340\235\217\362p\252\357\257?\200\357\013M\375\233~\325\253\277\316\371\212\343\023]H\230~\347u\372\226\246\314\037'\361\237[\260\007A\204\020!\342\266\332\003\316oI\350\004\370V\306>\223I\334\177\255\247\035\346\021\215\207\304\235\377\365I\006\216N\007\226x\275%!\327\214\013X4\202\0075\344.x\200n+\022\2057\013\224\323\245P\016\337\322Sx\006s\276\240L\377\364K?\200\314\027\226\246g\372V\036\336\261\211\226\023\247\351]o\315\371\364-\246S:7?]t\354\272\312\360\376n\324+\370\030\001[5j`\301Pu\264p\206\321`\207\026V\216\034.^Pmiem\335\300\332\242\2721\303\205\r*\030Z[T\r\2328\013\007\226\026U\216\254,-\252b\035W\247\355\2531\211\2677\\\337\305\304\245\r\n\035\350\226,E#t\232o[\272"
+	.string	"\241\206a\235e-\004l\032\202\270\334\202\3166\207\215\241[q3\247\322r-e\344\017j\270\004`\252\333\331\354\237\337\241\022\230Tw8P\026\340\231{A"
+	.string	"\r\002x5\016_\341c<\373\336\364\206\347p\365\033\276\r\365\320\375\311\243\364L\326\360V\037\343\311w\302\247\270\024\rwi\002\025&]\275\225\237\223Q8S\355\352\333\331T^\214H\361\003\210\364\327\031\224\340\bb\370\f\027\276\302c\260\360\027Lx\232?\261`\365\025\302\260\013o\342hV\337v}\340\216\222&\032\235\323\243\344\t\2229\352\031\267\277\300Y\240w\276\225\345\031\035=\254\275\216\037'r\352\223\036,\311\204\342K\222\314\262g\037\224\377\032\304eNJ\361$ \006\324\361#\216$\271\226\254\222\274r\345\266JL\323\3274L\032k+z\346\324\267\0269?\3443\331\211\270\263\256\377\371a3B=\322\2031\362U\234\t\"\025\311\222\224K\217\317\204\372n\3433\331\350\215\357\200\317\276\242\201\r\250\2010E\021S\212F$IA\nY\016a\005\204 \350\2404\017\022"
+	.string	"EE\nT&\245\223\235\3757\203\240\330:B\224\254|\224\301\n%<\323\335]\n\004\256\332\254W\2656\311)r\220c55O\236\2642_ \003\307\310\200\254B\272&cF\025f\"\233\357\024\211I\375[\230F\241]s:\224\003J\236\352\b\325[\266i@\306\\\204\356\337\261\211J\b\315zx\225\b\362\004z\331q\245\367gJ`>\2242\036\315\260;\274\177q(e\212\307\031\323\223\222\200\204\221\0241\216\325\376`-\251\2218\340\246\345\272C\321T#\360\361\266\207c\245\006\311y\261\365\216\306!\256\246\236\352\214j\23625%\226bn\021\350\034\314K\311\023 C\027m\367r\007i\021\031\305\212nKA\371\234\206\205\351\3401\230X \37429\004\353\343\232\316\030\035"
+	.string	"\242ca\256\312\307\2759,\b\317\003\243\031\211C\004{\346\252\314\2237:/yl\300\362\220Z\3033|\203k\375\222\032N\001<\006\220Mp\215\230\251\220&\217/w7t\232\313\fEM\3261qR\373\301N\240l\373\247F\264\2573\006>N\"\265\026\2646>,3\n\362\316\320G\r +\377Pc\2701x\213\346\226\307\216q\002\030@\214|{\3355\242\013[\363\314\322\344d?E\016\025M|9\231\317\356>K\325\327\363\005$\300PN\004\221\t4\2259\364\263\366Jr\370\313\243\026\315{\313P\030\026]\375\r\365\322\317\234\005\201o\303\347\0025ca\034\313\253A7\003\213/w\277\242\273\2501\302P\362yc\341I\2357D\031\036\365\227\2270>\205\0040\336\r\217\307\341\205\305\307|\257'\315\031[\252Xg\370A\242X\320\241\274\230\260\255\271\302\335\352\276\334_\345Y"
+	.ascii	"r\230I\323\365V\034.\217\355\272\031K\266iF\310\353\345%\217"
+	.ascii	"5?\255\356\314$<\251\bQ\003"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.65.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\253\006e "
+	.string	"V\367\301J\260\324Q:ya\337o\243f\234\346\312\226\301\0354\0354?\225\330\360B\356\221\210\3548pKv\035\270\t\351\370h{\034\256\034Hm-MW\222|\241\233\361\344\324?vw\365\373V?\247c\321`\337\376\267}B6\221R\246\255"
+	.string	"\231"
+	.string	"\256"
+	.ascii	"%\237\233\277\004^\246\224\034\200RkP\227\226zE\2174\230\367"
+	.ascii	"_c#\2076\3076\205X\034\247R\311\033K\377\020\277l)\313\336\363"
+	.ascii	"g\255\021F=_ \001\342\301Uk\345\365\213\355Y[\2156\223\305`\257"
+	.ascii	"\323\244es\317\367\254\201\r\211\301\265\325\212EL\233\021\255"
+	.ascii	"\214h\005\307`\253$\224\202_e\001\255\"Vv\211\220\212\022\027"
+	.ascii	"4c\270L\253S\022\032\342\363\2541uF&\212K\227\b\025eD\021\\\326"
+	.ascii	"\210#\312\034\323r\t\342\0177\013\240\030Qh\336j\255k$T,\371"
+	.ascii	"\254\251\265\236\207D\023\373\333\376+\363\177\301o\036\bK\271"
+	.ascii	"O\251-,M>\334\365\355\2616\"WA\336\262\335H+\344;\204I\004\001"
+	.ascii	"\371\006\331,I\265\305\323\327\307\263^\273\301\\z\036V\240("
+	.ascii	"I\313\343\177V\237\210\272Qkp\213xX\t\344Dp\362_\035\273c\303"
+	.ascii	"W\306u|\274C\237\271t[\002\025,C>\334\365\033\205\334H\377\226"
+	.ascii	"\265\217~\312\337\235\374\031\312\327\235\374\034\345\343J~L"
+	.ascii	"\311\207\241\374\227\222\357r\362o'\337f\362k\224O\243\374Y\311"
+	.ascii	"\227\225\374\030\345\303N\376\353\344\237&\337\244|J\371e\311"
+	.ascii	"\357?v\026\205<a\315\244\304\032V\361\201\365.\252\352J\330A"
+	.ascii	"\263\221\276W0\027H\256-\232\353W\257R\223=\225y\366\253e\260"
+	.ascii	"F(\231}\366\002%\033l\225\203W\255?\006\276H6\311\003\b\021\""
+	.ascii	"\230K\315^\246\035@T\204Q\224\243I\327\271>\221@\311\262i\353"
+	.ascii	"z\215[\326 >\t\362\324#I\310]\007\300\377\004\n\274C\3329a\007"
+	.ascii	"\3775\262G*\200\260`\301\\Z6\225B.\335Xk-\033\351\335\334k\264"
+	.ascii	"\243\352\207\263\374;\265T\275\01366\346\322n^\214\241\377f\217"
+	.ascii	"\275W\255\325\300\227\310\026\301\371\312X\372\f99f\327@\003"
+	.ascii	"\344\220\303\343\201\267\343\323\321\361\365\002\274G\363\341"
+	.ascii	"\207\303\303s\203\201\007\374\371\200;8@\336N\316\215\016\257"
+	.ascii	"\367\003\362h\004\334\327\001\347\307\343\361\371~<\231\321g"
+	.ascii	"\313\355#\246}\035\251\256|Z\370u\332\327\2246\034"
+	.string	"\007q\275;\332H\236M\240\270\266j1\rc\245\005AL\026,0}NA-A\355\354X\244\275\\y\351\335\021\305\354i\353\310I\346\3221\253*\tl\\\232v\344\264D\245\304\305\224\230\020\255$.h\306\0206\323\267\265Z[\337Z\006Yk\233\202\315\302\252i\355zf\326\264\336\3656\321:'e\326T*\2714T\240(\311\211\227\254cQ\030\330\310\2368\211\365)\265%\200\215\250aT\005\r4C\"\005\005I\n\031\306\340\002\031\241\251:\021 %\204\314\234\224\330h\337\013\007%<.e\216\303\365s\002#:\316\005\351KS\377\005@!\253\321#\357m\310\3615\317\347\202\211\333\306(_\273}]\006F\f\336;\220O\016L\265\026\336I\007\345\020\031\211\034]\021\223cA( \t\030\342\031\003\353j.\260\336\005\363\362\262Py+\353w\226\033m@\264\251@T4\037q\240:\376>O\276"
+	.string	"\224\240\366P\217Y\277\315C|\373\210\345\013\217\232\331\306\314\365\276\003t0\013d'\253\035e|\243@C\237O>\024n\220q\336K\230\3516n>\r41\272\257\256\361\301\253,\224\340\005D\363:\231\360\322<\304X\356>\245\271_B/\0058|\023\200\350\205\2051\252e<-\262G\342#p\021@'\326%"
+	.ascii	"7.\362\212\027\fn\350\016~s\\\036\007l\f\361:\354\310j"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.66.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\366\003\335\031"
+	.string	"\206.\244H\300XM:p\341\212\315\322\241\024\037\b\233\310\004\2106R%\344\326V:^t\204k>\037\364\321Q\257\372\032\262\317aM\325\266B\210\266:,6\3066EA\220-\331\033A\3637\036\260[\3760\261\204\220\275\211\334)\005\213"
+	.string	"\202"
+	.string	"\227"
+	.string	"\316\261\303\317\207\266/\355\353\270\321\316\217t\f\326\nc\311H\2559\b~\360}\"\370\212~v\237\241\237\336\261\263<7\243zBC>J^j\255\254\225\361\235\253\300\317\243\263[\271\343{5\340\317m\304U\t@\257\006\006\n\026\377V\3308\241Bz>\222\246\370\fo\266"
+	.string	"7\022\262\353\032\340\236"
+	.ascii	"\005\270\331\272\025\224\030W\302[\217\\\250\023,:\004\265\326"
+	.ascii	"\357\270,q\253I\351\325\324Z-\177n(\356\360\266q\330\256`/TS"
+	.ascii	"\256\027\304\364E\205\254\265\216\330\035\035\345/\372\345\220"
+	.ascii	"\324\324#\301\330\356p\037\257\257\326\236\b~\217+}\360\207>"
+	.ascii	"\r\213\311\377|\3721\372\371\2250\026\341"
+	.string	"\214\216x\344\224\235\253\311\035\355wu\203lOzE\245g~\364\313\254t\270\322*O\032\364\244?O\332\363\244)\225\236S\272\233\322\333I\313\225\376\200\005E\270\026B4vJ\256\232\230\nS\237\346\221\032>\217#\345<g\006\243\024N\307\247\003\337q\001H5^l\2112\263\253\365\270\370\214\231+\2633{\244w7nR\226d\370 \252\311)C\321y\232;\201\234\276\334\333\321\310\273\025\235h_S\267\235\323\212#\272c\324m\250M\341Ml\230\204@MER2k[8\223\216\222\013c\024\316\250\305O\243Hh\007\250\034\001\243\236\024I9@\372\261d\236Fw%\230$+\030\276D\373j\255\021|\"/\222A\303\206\r\364s\367JB7\023\t\023D\335\216\3627T\256\230T\345@\036\344\306\037r\313\345\242\017\366@#\003\361\232\321X81\030,\326\" \263q\301^\025f8.Q\244\265"
+	.ascii	"\270E#Bt"
+	.string	"\315f7\034X21&\303q\311X8\257\033\030\253%\312X4\006\034\013\341\022Y\263XLd\2059\236wu\203(\270x\342\331\232\352V\252<\307\220\245\037-`\270Sl\024P\221\202\345G\013\217\223\2536\334\333p\340\252\2266\345\270@R\277\005\227\201\030[\216\325z\373m\001.6\033t\035u'\241\336\032\300b#\252-]/\214\220.>c\234\253\265~;\272\203\032\232\372\004\272\332K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.67.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\230\002-\022"
+	.string	"f\240sG\340\320(\035\332\007SQz#\313dy8\255y\367\234\210-4\037\320\335*\024\021\361>\241\"\327s\370\352\017\217\221\242VU\375\241~\302\374\200\300<S $\323\274\340\271]\030\356\312D#HXld\023B\244L)`"
+	.string	"Y"
+	.string	"]"
+	.string	"\007\276w/\371e\323\370\r\304F\032 \227\235\034\273\013\352\207\277\376A\372\242\327q\232/?\222\220f4\226\177\210\220\276\241\027\016\\\310\210\227\230\214\221\244\003\214\314\275"
+	.string	"4\227\022\355Bv-\311\311Rm\027\031z\221\341Bv\3677O\f\264Xf$\331]\347\214\006s\227n;\3076\003;[\002(V\337\256l\201\177{\016\005\277\346\235[*\371\331;_\305{w\215\262\"\0236X\036\331\267Xj\315>\267\273k\235\261\217sG.\315qi\325tf\372%\001/b4\350\331\315p\304c\205:\037\233\343\334\376\t\337\226@\301\3538+\337\212\210<4A5vo\006\3369&\336\273(\303\250\204\rOk>\213G%\340\001\207\016\021H\332\246S~\026\365\266\337F\003\t\241\230\262\330\267\335\355V<U"
+	.string	"\266\2578\317\212_\343\020\205\362\336\251\276\210(\006\226GyNk>\212\227\232=RW\201\262\223\372\024D\271\273,\2525\337\202w=\321\231!\313\035\266S\036(UJ\2252\245\204\017B\224\311\245\nO\254\320\301"
+	.ascii	"\237F*\260B\227\313t\002\266X\253\226*l\201\252\224)\005<\261"
+	.ascii	"Z\340H\001\257&\204,\320\265Z\261\300\322\rv\235\361\315\277"
+	.ascii	"\237 !\230\306>\f\304\335\210!\335\205\r\220\335\375\264\346"
+	.ascii	"\250\234>\204\016\f\b\377\211\340\303)\202\rF:l1_\342\371-\336"
+	.ascii	"S\"\301$7 \320\002\251!\363\263d\221\263\355o\262\237{\333\367"
+	.ascii	"n,\256p\344\346u\3672e\241-\334^\2755\3541\b\305\225/[\371V\215"
+	.ascii	"\270\360\255\273\360`\375\222/\372s\233U\244\313\200\354Y\246"
+	.ascii	"\322\356e#\233\371\250\332M,5\024=\036Q\203h\210P\262F\264\034"
+	.ascii	"\027M\030\334\013\256\f\347\254\300\004\267\340F{a(\204\336n"
+	.ascii	"4Z}\365h\327\341c\271\f"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.68.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\b\001\275\f"
+	.string	"\266\227UB\020Q\234\016\203\270\332x\037\003\310\013\200\340\210\257\275\210\240\277\025Y\200\330N\031\002\226\324\350\2235\r\366\265\222:\330\300dOJ3\031\231\2703"
+	.string	"\270\\\204c\2165\034\2358\272\002\260\357F\233\354\235R@"
+	.string	"A"
+	.string	"C"
+	.string	"\340;$x\262\273\001E\310\256H\300\003\260\323\313\001X\247\325-\326\251A\333\305E\017{\324\213\n 3v\267\316\016\007/A\377\036\237\204\244\320\345\205`w-CR\351\236\267-\300\366\001\373\032\002\034\366\224\306n\272\257\237n\353\035\177E\261\220\264H`b\367B\252dG\272\"\304M\377\311\276\350\227\370\307\ttI\205\030\300L\240oio\201\004U\002cW\304\234\272"
+	.string	"v\372\212\355K\373#N\"\024FF)\264k^\306\007\037\365\023 \037\204\033l\362\341\251\277Y\247\326\374\307\253H\r\021\031D2e\212\254\246\335\341F\306\t\017,\"\226\264?\020\344CK\0261\306\321\f\331bHN\016\366\253\335]\317\033\215\344h\244\307@\353l\013>\217\326u\237l\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\344\260\002\032\243h\216\214M\025\331=~\f\327\264&61 \001\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.69.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4pM\322\001\240\353\002\330\305G\302\360V\206\3149\344)\204\360\032B\327o\riI\217LN\331\245,\251\261\375\337\365%\224\r\036e\330\030\240\244\221M\366N)\266P\030i]W\265"
+	.string	"\247\214\363bMxa\250\032\240ENH\0258:X\022^1J8\325\275\363\330\037\230\264\2739\365=^\037|\214?c\260v\372\347c\321\237\301\306A\330U\323\\\205}h\235\307n\003\023&\n!\273\022\237\224-y#\031\2663\366\344o\234#\343\214\240^t"
+	.string	"N>\021 (\273\025\272^ \372\223\036\020\3759\213go\231\377\216C\032$\"\224\243y\253$\354\256\033\345tnw\333\007\266\021lS\004\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.70.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001\300\216\002r\212H7\374\231\226\375\023%\300\240\t\273n\205h\026\365\036N\262\033\350*\2417\245\303I`\216B\236\213U\013|\267do)S\n\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\257\341\r'\217\335\371\234\350.\025\200\342\223!;zR/\354\267U\220\355t*\201EI\202\311\256D(eI\234\310\206\355\216-\371\035\367\350\370j1#\013\200\210x\bA\331\215\317\362\201\350\256] \272S\214_\317\313\377\307\033\307\310\t\226y\236\025\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\2216\004\216\031{\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageState.71.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203"
+	.string	"3\017\356\340\362\251\205\200e\375\016\3430\237\266B4\213z\017'\331\rt\225\320\333\022D\0058E!\317\305\252\005\276[\262\267\224)\005\276T2p\262,\213\302\253 Ua\246\352a\026,\f\357\002\253W)0\3250\301gQ\024|R\334\353'\225\322Q\007\373\034\217\227\177\341\214&\217\335\371\232\350.\025`\242\223!;rR)\354\267\325\217\355t*\001h$\341c7\"T\262\"\316\003\303\366\306\226\374\214kl|\265h\221\005@x\036:Hv\343\243| \272k\027\210\356\264\342\327\363\362\277\361\006\002\t\3012\316s\202\260\273N,\223\270\365\266\rl\037\330\366\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getConsumptionState.72.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203"
+	.string	"\3471\001\031\372\324\032\274\253\n\202$\001?[!\232E\275\207\223\354\006\272J\350m\t\242\002\234\242\220\347b\325\002\357\221\354-eJ\001\276T2P\252*\313\302\243\340Da$\352a\030,\r\357\002\251W1\360\344 \301WM\023|Q\334\253'\225\322\321\007\373 \217\226\257\341\214&\177\335\371\032\350.5\200\242\223\231\0359\251\027\366\333\252\307v:\265\340S\242\220\355Jd'K\342>\033\2667v\344w\334cc\253\305\fL \302\002\"\304d7>\312\t\240\273\366\001\350N1n=-\377\037o\034#\"\027\306y\002$\354\256\363\302&n\275\355\003\333\b\266+\002\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.73.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\332\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.74.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"E\t"
+	.string	"\306\021A;0\345(\035\036\216\352\345\241f\321`\335\370\nm\303\247\301\305a\354(\017~\260F\274!lUU4!6\330\326\2406\013CA\204\020\320\357\256d\004\301\035"
+	.string	"\321\032\331d\357\224\002/"
+	.string	"/"
+	.string	"0"
+	.string	"\250L\312G\006\013\266[\251\353\007\264O\315\005\264O\331\361\3601\364\277z\026@%f:Y<f\032v\327\321tB\335\362\266\023l/\330~\t\266\243\245\214\216\031A\013\213\003\314\256F\f\300\256L\027\210_\362*:\211\0030^\260\335\335>m\221\275}\336\036\331\233/\362\221\221\303\202\352\021G\361dW}\272\003i \371\325\025\\^1\256\233\374\344\363U\236\b\305\233>\375\220\366\031\345\353\021X\255\220\rR\214\331\265\024%\207\375le*\356l(<\016\0049\017\364\363\272\357\303}\364\003\301\361\320\216\367\321\215\201;\t\316\243`\327yt\253\244g+SR\036\220d\311\266+\336\212\320\354^0\370\254\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.75.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\021\004\r\031"
+	.string	"\206(\225L\240\022V:\276HM\"q\326\1771\333\tA\034\f\004)y\256\023(\025<\333\334\374\341\221\307D\315\337\231\"\201\n7\373\347\n\267\234\265\371\023E\314\353\341\246\221\340W\350|-pX\326~i\032p\230\216\327\2024~\262\t!;\311{"
+	.string	"\200"
+	.string	"\200"
+	.string	"?\233\315&\263\317\236nk\333\336\366KN4.\257^\246r\336\320\344\312\306\024\212\250\273\017k\334\255\374\022P\276S\022\316p\231s\216\235?\307Wo\212\236\026\367\255\016\255\325\247\273:\203u\255\025\323\352\003\361\024\003"
+	.ascii	"\337\315\r\020\024\365\3039\321\003\217&M\021W\237\207\237\250"
+	.ascii	"\310\026\316\021\346\343\241\bn\2269#\276\236\265\252J\316\271"
+	.ascii	"\355\352\353\360~\275\273w\335m\240\033\215\020\305\220\033\345"
+	.ascii	"\321\261\037\234X\223ZA\221\274\313\355\206\360\032.$9r\316)"
+	.ascii	"}\032\207z\351\013=m\t00\310\035G3b\220\311\245\214\231\f-$*"
+	.ascii	"\031\343N3\031M\035V\315n\377\305a\314fh\264\373T5\252:\213\017"
+	.ascii	"q4\271\324\207j\331\257\335~\213\273\250U\270\335\356\323\024"
+	.ascii	"y<B\217\273\375\340\205\270\276P[\310\331\257O\373\271\373\264"
+	.ascii	"\300\020\227\216R\326\3166\273\227x\366\364\351\016C\230\250"
+	.ascii	"\030\002w\2238E\356\300\023\240\032.\355\232OZEg\273P\254b\204"
+	.ascii	"\210\365\002\312\0342O>\021!^\031u\266\253\253\236\204;\347/"
+	.ascii	"\334\237$LV=\273et*\274\342\225s/\245\177<\022#a \016\342\340"
+	.ascii	"}\372S\035f1\205\003lw\002\005%OF\336\251k\023{\245\343`y\345"
+	.ascii	"\274\373\332\237\272q\301\n\013\313}\332\315\240\201\375\332"
+	.ascii	"\226\0304\366N]\367[n\267\203\333h\t-\203\222\263\311llb&\304"
+	.ascii	"n\266\332\255Fv\213\325\314\304\320\304dl\267\030"
+	.string	"\212I\327(\310l1\233Z\315\026\203-\355~\366\034\370W\261\313\270;y\375\037G\325\021H@.R4\272$\212;_^@\316\203\242\202\244R\256~\227\025Q\224y\230\375\255V\276~\274s\237\266]s\006\rE\327\352n\345\371\341\3062g\335u`<=\033\244\304}`\023Y\366T\233\232\230\302\003=\360\217\307\257\360\317\t\374\373\341d\250q4\013\2252FAR\220\024%\035\240\002\021A\252\016\021 A'\031\225\024*\255\001R\030a\341x\271\242]\322\325\376\366\b\t}\321\3572\325\252\255Az\200@\202\022\372\312kQ\021\b\327\204\340\261\356:\r\265\237\022\260%\316jP7\003\024\177\212AE\276\340\004\016&C&R\250\016\003\272\327y\337H\354#\016T\004\367\201\267X2z\252\244 \001/r)\211\310\221\372m\214N\242\\\214\302\363D\251\221\273\303\202\r\235^\375\354h\320\343\264\265\263"
+	.ascii	"`\373\b.(\300\tD\356\341:\201\nLyX\233bh\211mA5\207\017s\020"
+	.ascii	"\217\230@'T\333P7\031\302\373C\317\026:\265|@~M-\257Fs\300*"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.76.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\302\005\005$"
+	.string	"\326\177\340B\200jQcSa\020\300\b\355{\201j\324\027\326\331\007\263\311d6\006B.\321\252\0055\\g \342&\316\2508\234\204&\340\307\250\274\314\312?a-V\370a&5u\rL\241\227\266\355\275\367\2262\245\311"
+	.string	"\302"
+	.string	"\325"
+	.ascii	"!\32008n@\342\205\262\361\325g\030\341\2455\240/}/\377\222\343"
+	.ascii	"D\313\226ti\271\367\322^\3329l\332\313J\263\375j\177x\254\364"
+	.ascii	"Y;,\273\267*\316\326\275\304\t\226\200\276\274}\200\371\222\374"
+	.ascii	"\221\371\322\251\375ub\223\3733d\202b\302\356\2758\313\344\351"
+	.ascii	"i3\031z\232%ik\352\377N\303!\2412\003\2645\274\222\371MD\216"
+	.ascii	"\336\252<\021\251'\t\001LM\241\337y\212\"\007\004\211\"\374\230"
+	.ascii	"`5\317\r]\016\002J\235@\345\253\236\214\364\230A\3610\003,\250"
+	.ascii	"z*B\222\025\272\214C\261*!FnI\013<\302\244lP@\2626\026\314\363"
+	.ascii	".\257>\240\234j=7\334{]\205PB\356\332ms\331\346\331e\214_\376"
+	.ascii	"\241\212T\237,A\255)N_s6&\230N\2340eK\272\256l\224\024/u\310"
+	.ascii	"\001\365\304o\261@\357m\272\320G\3634*\374'/\275\202\005\013"
+	.ascii	"\263\205\213z\241k\305!F\240\375\231\317V\026\225\265V\316\231"
+	.ascii	"\267/\300\370\001\3261\373en&\347?q\222\256^\2503_\336n\301\322"
+	.ascii	"d\n+\252\251\036m\242S\265V\366\355\361x<\332*\261\315\352\004"
+	.ascii	"\017s\023\270\326}tV\033\325\252\213\236\365\333j\325\263Z\265"
+	.ascii	"\314\254Fi\325\347\254\332\234U\227\262j\022\255\266gu5\253\257"
+	.ascii	"\340\204\236\302\002\321Hso\220\343\241k,\327Hy\230_\353e\265"
+	.ascii	"\366\355\023}1\037c\232\326\r\035_p\210\001NR(\365\302"
+	.string	"\322^(\026M\231\265\272\333 q\323\205*\231\244\255}\201\371\343\240\006xJ\305\264S+\351\225z!iM,*\240\375}\001\034+C\316\033\346\221-P\344\362\023\204\247\301U\312\245^xd?\346\227R|ct\252\363Z\221\215\321\374\343\307)\326\201\341\255\026Y\233C\007[\221\313\347\374Eb\030\330\257\"\362\036\037`ZJ<\317s=\376\3120hJ\312\336C\025\032};\325Ux\201\370\231r\251\270|:\277\007\363e\211\353e\034>x\321\367\376>\2056\271\025\304\214\303\260Ku\037\320\250x\324D\266A<N\b\364^ \006\377\315\341\210\030A\202\204\371\322\332S\313K,\313f\333D\301\222g\nK\312\310\026\331\223P0Q\2656kd\037\226\201\324\2431\303\307\204[\332))\355\222\f\364\230|9\337\t\237\256\007\003\006\t\035\r\237o\307\223\341\263\365R\350\224f\240\360-\351x<\246$"
+	.string	"NB\302\301\323\371|\271\027\270\036o\327[\322\365pK3rJ\270$^\017\207\204\300\273\032:\036\316\267\333\361p4b\323\311k\225T\353\344\337\2717\2207\021\"\033\035,#P\316\337\345\377A\347\3128\263V\256h\204\327\274\270\320\234\022>\263>\310|L\214\b\230\261B%`gVf\213\216\244H\352\205\276\005\355\317\t\254\314\310\353G`\2426\201u\rF\225\371\240\\\232D\207Z\nX\f\211E\235\226\200\265\\H\325\264vj\22521/<\355\315i>vm\001\300{\233\030\224\326\264\245\236\036U\234\352\321\021\002u\250q(\310\224bdFH&\210\244-\244\003`\002\0212\243\362\020p7\243I2\214\001\315\033?\344jp"
+	.ascii	"\226\302\271\314\b\323h\261:\t\306\376\346\214E@\262\\\020\355"
+	.ascii	"\343f\027\375\3103j2mw\021\357\271\007<`+\270\274D\227v\217\343"
+	.ascii	"\320\032\312R\027\020\357c\216\017%\230u\203\272\301`\275G]\375"
+	.ascii	"\b\335FBN\204\t\245\362B\233\212\335f\315\226\275\027\204\337"
+	.ascii	"s\3659_-4\275\300%+\352\275\251A\211y\301:\322a\024\026z\352"
+	.ascii	"w\214\214|.\270\362$\003ck\231\373\033\340$\216g\203h\244\034"
+	.ascii	"\212A\007v\341\320*/\002B\017CW\203Ic\336e\267A<\342\\\2034\263"
+	.ascii	"\315\305\024\02643y\213\225\366\242*\325v\2755\250g`\006C\211"
+	.ascii	";\3762B\302\021\266\234\251B\356{e\360\365\013\005\016\334e\332"
+	.ascii	";F\227+\221\016\002\222\351\250\337\212<U\003"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.77.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`q\004\305\035"
+	.string	"\206\370\301H\260TN:k!>\331\273b;\276\001G$%/\225K\352\360+\2561\206\303\317W~\214a\251\002\254|w?h\363\233N\336m\213\327\013x\263\333\331\353\202Z\377\330\326\254B\213\343-\0165j\352\027\261{\023\271S\n\251"
+	.string	"\234"
+	.string	"\264"
+	.ascii	"MD\230\325\212bmK-\233D\250\316\365c]\332\377\262\215\261\270"
+	.ascii	"\216{\3317\2178\017\273\254 \273\272\226\337\345\333\267\276"
+	.ascii	"\203\351\\Kb\035\"J\205Q5\020?g\216C?\345m\350\247=\302\276}"
+	.ascii	"J\233\311\317\362\355XMb\255\262}Q\3218\253u\313\300\247\017"
+	.ascii	"\210\237N\240\200\311M\337\202\201\202R\311\210\362\272R\353"
+	.ascii	"Vn\247\336t:\303\225M\276\315Ax\265"
+	.string	"\345K*H\342T\305\347KP\305C\\\260\304-\b%\267\353\362Dp\f\001\324Z\237ui\"\370$\245\315A\255\325R*\230\342\266\335\366\007\333Gv\030\f`\027\302\363g|\272\003\022\022\375\034\332w]\300\224\030\026-Yk%\261\373\302M\364\313\241K\n\224\314b\377\307\2014\3713\354\241'/\325\243\237_\333\224\030\016\026Nr\315\336z\222\373\302~X\327\205]Dt\256{\210J\013\035\353\016\242\322@\242\364\217(\355C\245{\2504\017\225\336\241\322:T:\307&\215#J\337\210\3226\242t\r\225\246\241\3223TZ\206J\343l\3221\2424\214M\372F\245_\246\264\313\224\026\251\264mJ\323)=\247tH\245wJ\313P\372\001\204R\004\337\231\025\032\213Y\334>J-\302\307v\"\223\230\275Y\f\255\333\302\354\234\022\245&\341K\226\222\\\t\205\n\026,\320\317\333\"\270A\206Ck\356l\321"
+	.ascii	"\264\261'\263/5\003\327\331\235\265\034\255\330\311}\204\276"
+	.ascii	"\254\316\376\353a\016\031Pl\230\365\240\342\262/\033\202\215"
+	.ascii	"d\342\322u\331\217Kl+\356\3073\333\376\034\211R\013\273\017\343"
+	.ascii	"\240ju*\232K\327\347\311h\025\256\334\271\037\253\236\344\232"
+	.ascii	"w\303\335\031\033\317|\341F0\210\265\326\005>\221\027\311\240"
+	.ascii	"a\303\006\372\271{#Q\264\206V\356\257\264\210\215g\017\277D\207"
+	.ascii	"\366'\313\314\272\207\355\024@\251\025j\201\037>2R:\002\352z"
+	.ascii	"\271$_\257\347\333\365,\001\221v:\020\272\0072\274\016:`\022"
+	.ascii	"o\367\343M\240\361\316h\351\307\003\002u\034rJ?\237R\022O)\227"
+	.ascii	"\204\244\353\345v?\245\234\021\220} x\277\034\320\347\373\345"
+	.ascii	"n[N\017\277.|\264\036\223\310%\r\255FX\264!\252\220\311\007y"
+	.ascii	"\320\232\260\035\264\317\372O\264\b\2269\355SHe\226\210Lhe\220"
+	.ascii	"\034h\205\366^?\013\264!\230\317\336\354\317\026H\033s\364\254"
+	.ascii	"\017\317\316l\3172\2502Z\3416gy6\2276V\341l\016\2047)\303Y9%"
+	.ascii	"\206\226\023\001j\2637[\300k\264\252Y\230\265\331\236'c\025\315"
+	.ascii	"\326\314,ni\366\243UQ\250A #\221AJ)g\"\231\321\264\260\325\200"
+	.ascii	"\002\031#+\017\020XfE\311p\303cE*3\366\213\312s\226\322\306}"
+	.ascii	"\2363G\205\332X#b\001\270*,\254\343m\306\3741h\204\"\222/\032"
+	.ascii	"#\205x\351u>\027\361\356\377/r\f\r\235\362\017\300\271\305\331"
+	.ascii	"<~,D8<I!\233_\nsX\027\rP\233\r\317\212\320N\260\t\245\223\236"
+	.ascii	"\0348\250Lz\ti\201\315\032\264\025\345LF\003\006\242\331\322"
+	.ascii	"\223t\360\214\302\357z\200\320\211\257\373\324\206\2620\332\325"
+	.ascii	"\203z\256;\376H\tx4Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.78.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"-\t"
+	.string	"&\321?80\257\322\001\204m\005\026\301\203w\200m_\310\366`\313\366d\033\211\005\n\353Ia\316\017m\377\324#\250\305\366\206\371\322P\200\306 \305\317\351\304\2103A\313\326\310\3362\245."
+	.string	"."
+	.string	"2"
+	.string	"j\3623\235\335\275\353\0320<]V<J\203\231I\213@\230\222\003+\r\360\256\353D\370\251f:\273k\005C\212{\273\355\004\333\007\266Q\002Z\263a\237\306\013\373r#\313\276\372[\001\207J\204lwU{\331\330v\262a\373\033\233l\226\303Z{\222\021\225\210\313\356\316\210q\323e\f\001)\026\261/\236\336\242\315J\242%0\217\237\220\225\224\322l{\007y"
+	.string	"\330M!\370\037\177A\370\031\337L*\351\301o~\t\363\3551\243\222y\274P\001\006qH]h4\362|\246\327q\236(\344M\321\202\207a\202:or\b\3145\204\2729\342\270nn`\250\313\215,+t\304P\361\223\032\2659\007=\350\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.79.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\"\31624Pm\323\001$!G\272$H\214\004\273\216\001\004O\017O1Y;\364\037,\031$w\217mc\206\217:{ff\254`x\255W\020\220f\242\211\2376\221;\245\306X.IY\326%!NY\315\f5cF\341\262\0201rFK\305\025\003%\243UU2N\235\366h\265\243*\240\351f\177JWU\t\244\361\330\334\360\215\t\260\033q\340k\374\343\340[\034\372\341z\347\016\375K:\274VF>\332\013\331\335\366t\302~\264\332\261\375\254\357\371Q@F\b&\262\273\t\231,\b\354\360\330\306\354\311\005\006\230\263w\025\233{>4\240\222\335.*\305\263\277\314?\306!\307\t\t\307\201\370\243 \354\256\037\307\221\270\365\266\007l\023\330\276\b\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.80.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"%\007"
+	.string	"\362\21525@o\222\016\233>V\037R]\332\304\034I\330\272\341\317\300\352\260\361\333T\377\257\331{Lm+Z\220\357M^\206\341Q\341\322R2\300 \t\232\031k\255\021\"So2\035\314\3224MC\314\260+\343XY\3448h\036\342\006\313b\306\340\013\302\302\242v]X\304t\331)\341h\210\020\202\024\177DI\266\200\314\\\270#\355$nG\251;\236W\256\324\365@\001\221\320+}\007z0\343;ef\016G\377\373\301\203\023\225\tR\246E\311%S(\023\217\377\363\230\373Q\220\317\333\3538.*\322JEIKf\027\007ZP\225z%\250J\301\215n}\333mH'\226\027\024N\004\352\003`\310\314\037'\302\350\260\177\302\257\360k\004\b"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002\272k^\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.81.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\305\b"
+	.string	"6Q=70\345(\035\215\337\232\334@\247\203o\003\005P\3468hZ\266\361A<\207\276\317Z\023\235\352\332B\f\346\016\2659\f\f\234$ =\203\f\322\206\343\347F\333\233H\231R,"
+	.string	","
+	.string	","
+	.string	"\320d\245T\362\262\313\305\201\027\300\277<\001\374\323\215o\317\315\277\310_j\325\231N\241'\246aw\235\246\023\306\255\267\255`{\3016K\\(U\303\276\265\212\262\235\206\232\2664\255\232\316L\037\203\320\222R\341\262k\321\001X\224w\342a\033dg|\220\207\200\274%\307q\021\357V\301T\325\247\"e\214\262\3635\365\245\225%N\262\005\354.\203?rN\363;\376<\361\311\233\376\374\017\374\273\032\250\244D\331\331\001\346h(\262\313\343\3318D-\303\264\316\245\305\316\303\006\"r2-j\016\214E\\Y\364`X\0263\334\336ZEAM\020\351\310\226B\001UK_"
+	.string	"\322G\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.82.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514Po\322\001\260\234Ec\247\226\322\242a\007\006G\200\225WS\372\343P\334\2325\326{F\226\221\275\241v\246\252\252\030\253\375\317=\321P5| \262\211\224)\005\326`8\217\272\256L\203\263^em(\313m\0342\017N\363,\2071p\005A=wU\325s\227\270\227VEV\004\220N\330\216\370\b\f\330\335\005_\344Q\302\347x3\247\223\307\336\374\216\n\204\2002\263\343'\025\303\276\264*\262\235N=\030\245\300\223\335\212\254eQ\232I\207m\217}\361=\376\3411\314\270a1\225\214(HXv\243\033x\301\364\226'\230\336T\343\360\t\375\203\\Z\311T\260\320\347\t\300\260\273N,tq\353m'\330V\260\235\021\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.83.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3`k\222\016\320\212\242CZ\204J\3562\002\265\234\352\n>\350\316\033`0\3737\373g\3216`)\254aZA\322\b\"\201]\030\324J\371u\332-\222-S[(\030J\262\254\n\303\253\250\251\272H\325\2734T\034\236\205\252\036\205\340\351A\242\2365M\324\233hY\007BW\300q\235\257F7\256\2131&\203\305\032\335\214\244\021:\201\t\016n\257m\320U|\001\322\201~\034\335"
+	.string	"\205GVOG\346g\033\311\220\b$\364k~2B\202\346\253\332\305G\022\332 8D2\265\347,z\025\257\333\214.t<\037X\266)\006(d\346\210e\022\335\3657\370\017\376\210\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.84.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"u\013"
+	.string	"\346\326N=0O\224\016\bpu\300\325D\242\003h\272\244?\003\250\0364\005~$\025\230\013\325\315\361\t!\3309h\215\330b\273\374\327=)\220\254\r\002\246\030.\360\033\223\320\303~\304\356\275\245L)?"
+	.string	";"
+	.string	"="
+	.string	"\0316\001q\0014z\261\313M\005~ \036\346\r\304C\365\360\353O\363\362#h!\027\242\r\373\013\260i\270\022\330>O\262\273'\361\314\330\264LH\203\335u\212\266\f7\274m\007\266\027\330\177\020\357\304\303\253\002\216\rYv6\207\245n\330\177\253\032\266\323\222\323\361\245\341K\277\227VMg\246\017@@\207\025\333C-v1t16\005D\361\301\266\307\216\370\">\302\343kR!\331\371\372\024\302\002\364\221\252z\320\2071\037]\322\3562\360=~B\202\337q\350\fE)\205\243D\226\335sw1\325\r\333\233x\035\300\301C\305'a\3307qn\343w\330\352\344E\207\016\266P(T\027\016\247\002a\262*\312\322\\\254I\203\251d&KeM\224\004\246&\\\252\211CQ\325\024\341\366oU\303\231\376\025S%\215\232a;\252$S\355=\250\222\"\030=U\205z\013!\264\022"
+	.ascii	"\"\013\255\334\206\341\262\022o\270%\3170\035\303\360\342\035"
+	.ascii	"\002\246\360\275q!\314_\017\266\270&\226\311b\343!rqWb69\224"
+	.ascii	"\274\355*z"
+	.text
+	.section	.gnu.lto_getBatterySagCellVoltage.85.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"}\013"
+	.string	"\346\026O=0O\224\016\bx\352\221CJ\215]\0211%\375\031@\277(:"
+	.string	"[U1g\024\377\230%\204`\347\2405b\213m>f\375\205\001\032\273\230\020\360\271\300\327\331\364`\217\021\273\367\2262\245?"
+	.string	";"
+	.string	"="
+	.string	"\031F\331\220!\344\261b\227\233\006\274@<\314\023\210\207\272\361\353O\363\362\037h\027(D\033\366\027`\273p\025\260\201\336dw\377\341\211\261i\231\220\005\273\353\024m\026nx\333\fl'\260\337 \367\304\303+\002\016\fYv6\207\245j\330\177\253\031\266\323\222\323\361\245\341K\277\227VMg\246\017@\2621\332~Qb\267B\327bM@\022\032l\177\354\210\337\341\036>\276(\023\002\331\371\372\0242\"\364\221\252\372\320\2073\367\270\244\335U\340w\\\004\004\177th\rEi\205\003D\226\335sw1U\r\333\234x\225\250\350H\001J\026\366C\234\343\370#[\236\274\350\320\001\276T$T\230N\307\342`\262*\312\332`\254i\223\261h\246KeM\225\003\246\"`\252\251CQ\325\024\341\366o5\303\231\376\025S%\215\212a;\352$S\355=\250\222\0328\361T\025\352)p\320\002\022"
+	.ascii	"\"\013\255\334\206\341\262\022o\270%\3170\035\303\360\342\035"
+	.ascii	"\002\246\360\275q!\314_\017\266\270&\226\311b\343!rqWb69\224"
+	.ascii	"\274\355*z"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.86.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"M\007"
+	.string	"\202\31635Pm\323\001$\243\264h\212j\225]\267\2600\323`a)&K\206\353F\333\006\261\221\263\2661\303G\235=\210\231)\322\370Z\257 FK\024H~jD\356\224\002\276T\260X]\227e\001\312hIL%!\206\301\322"
+	.string	"/Q\302\n\305\226C\025\341eY\021R\235\366h\225\243:\240\351f_NW\325\t\244\371\330\374p\016\t\260;\201\340o\374\003\341c\\r\004\366>/\371\330t\351J\021\371h/dw\333\323\n\373\321\356\256\225c\373Y\337\363\243\200\213\021\356\263cw\023*\331\020\311\303c;cS68\3108{\327\331\bdt4 \222\335\016\252\305\263\277\314\277\306\025\266\t29\211\277I\302\356\372M\216\342\326\333&\260]`\333\023\b"
+	.ascii	"2\241g\037\230\302\004;T\241\3245z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_getAmperage.87.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\002N24`m\322\001\300\016\340l\310\223\351\002_3\350\342\323=#\227S\206\001M\032\352\275CMv\003]%\364.\241\340$\205e\356U\271V\354\262\326do)S\n\306X4q\262\254K\003\254\"Ue\246\nf\034.\017\020\023+h)0\0051EhQT\204\224m\357V?\326\n\246\036\333\021\377\270\002v7\301\367\370&\341c\374Y\263\311g\177\376F\372K\025\350\300rdo\235\324\013\373n\365c;\235\352D\241\223\210\354V\214Nv\344\205\204lsl\212\257\361\r\216\257\205\tL3\020eP\200\230\354.\254\234@\372s\037\220\376\024\364\353y\371\3478\203'+\311\264\316\023@aw\235\231fq\353m\037\330F\260\r\n\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.88.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001$\243\252\022\261\270\362\272\031_D\354\005\026\331\206zu\217}\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\013*Xo\"eJ\001\316\\6\261\3020\214\003\274\242ui\252\013j\0360\0200\023/x1\260\025QE\210YV\204T\267\227VCV\213\246\037\333\022'\311\002vW\301\037y7\341s\374y\303\311o\177>g\372K\025\020\321rdw\236\324\f\373\322j\310v:u@d\301\035t\262{1Z\331\224g\"\262\335\261)\377\343 \035g\f\024\032w\320\341QQ\242\262\273\320\362\202\351O:\301\364\247\032\317\236\231\377\2207|@(\033\347y\002,\354\256s\3430n\275m\004\333\t\2667\002\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.89.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"-\007"
+	.string	"\022\31625`m\322\001@\203\300!e\200.\320\3254\372jf\375T\262\327\r\003\2324\324{\207\232\354\006\272J\350]B\301I\n\313\334\253r\255`\267\371\215l\"eJ\001\326`8\221\272\256L\003\264bem(\013n\0342\017P\023-\210)p\005AExUU\204\026n/\255\206\254\227LA\266#>\202\001\354n\202/rN\302\027\375\231\323\311k\177~g\372K\r\030e\331\331\334'5\303\276\264\032\262\235N\025\360\020m\257\350v/\272\224=y&\034\266=\266\305\3778\210\307\330\302D\266\031t\214(HPv\027^N0\375I\037\230\376T\343\330\023\363\037r\006\220E\211\266}\236\025\205\335uj\033\306\255\267}`\033\301\366F\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.127.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`@\001\325\r"
+	.string	"6\331ZD"
+	.string	"\223\223\016\333\tDD\202\232\002D\266\314\206*2\262\310\024\332I<\277,4\367n\217\030\263\266\316\342`"
+	.string	"\030!\361h`\203\022h\370\323\001\376\252\357\213\352f\303\023IE\265kC\024\2334\262\211\334)\005B"
+	.string	"I"
+	.string	"J"
+	.string	"\321\t\256\307\003'`=V\037`=b\217Wa\373\353`\221\255\343\263\264?mX9\245vW>\252\211\213\256\260\022\371\2079\207\304r\341\n\302\362\341P\300\253M\311\356\372\002q\307\333&\261\035\301~)\031*TifEj1\314\020\237\376\"d\224\002\263\344aC#\002\007\217\324\356\224\217\236\327_\356\320]XeP)v\027\273\317\342\363a\214\275|\237)\260\301\216B\204<\032B\373\246\267\020}\246\230\263[\002ecw\212<&&\326\343&\206\264\343\n\365+?l\317gP\270vw\201\037\3432>\376\211Go'\360\244G\377D\025\214n\3640\215`\rT\027k\365j\265\305\266\240a\204~D`\n0b\227C\r\315\222\2102(`|F)Q\321\020\236\320A\320>\236\007\036H\3438\013\031"
+	.string	"g#!N\363\274\216\004\331q[\007\322:\t\362t>2\343:9b\300[\005\215\223\336\266q\022{\265\332b\007>fF\252bUu\261\r\325\266\310ktHr\354.\003?\34642-\037"
+	.string	"\370\024C\2431`W`<\234!f\f0\232V\031]lG\252=\205\261\007\020\005\303\\\341nY\201\177\206\300s\001\004\033\206&\314 \243\326\350(\304\345y\307=\255\024\325N\347\2026]v."
+	.ascii	"\234\274\230wZ\232~B\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`\032\006\205\025"
+	.string	"v!}H\240VN:\300W\374:\033k\030\262q\334c\352\024\356\250\245\004U\336\003\230\2259\005|\003k\361n\332\350]N#\216\327\302\365\320E\027\306\030c\274\363\020\251?t\251\317\272\016o\205\214\202\203'[U\325\2324\271w\ng"
+	.string	"h"
+	.string	"i"
+	.ascii	"F\214n\"E\367\020Jt\013\241\275;\310\220\251\b\341\204A@@\267"
+	.ascii	"\325\217\245P_\365\301\273\021\365\361\224\232\352\363\221\273"
+	.ascii	";H\267\366\3606\030\f\202\341\371\021\335\321\321\311\311\341"
+	.ascii	"\301\261\330\315N\270U\306\007\301}E\017\364\204[\r\374L\262"
+	.ascii	"E\201\240\320v\255\372|\265\207}[+\306\244\325Z+\201\033\213"
+	.ascii	"\332\266\315\004^f\255\325\246\341p\217\315\rB\241\315\"jJJ\005"
+	.ascii	"\224\206^h3M19M=I=E-A\255\330\361$]d(\n1\334O.\334_"
+	.string	"\026n'\025n/\nw\327\204\273\211\204\233I\204{\t\204\233\353\301\275\345\340VB\033\334Z\fn ]pg)\335I\024\370J0\301\215\204\016\330%\335G(\222\213\204Gw\224\353\213\230\r^n\347\357'\227\343\005U\030Pn'p\222sVuUy\371\340v\346'\003\234\356\022\273\241eG[\\9o\250\300d\354h{\253\221\323V\264Mq\233=\335X\234\356,(n-M\367\026\246\233\313\211\273\313\322}f\342\256R\342.I\334VF\334d\"\356\262\020w\030\210\033\312\207;\212\207\033\254\303\035n\232\023G\230\263-\234\3156Y\267J5\272\265\241\351v\216\321\324l\356W\032\215\033\003<\032\027\367C\032\367V&\215\272/\0353l5\256\rx5\256\215\304\032M\006\343\214\207\263\306u\252\321\0337\346'$.\256\034\022\367V\366\304\275\221\323e[@h\020\211k#\213\304\255\225<q\005"
+	.string	"\347\315\354\307\216\240"
+	.string	"k\303\002\220\333Y\316e\250A\b\307\321\332$IAA*\215\001\360\002!\242m\016\021\220\220\350\b!\"\"\241\004\244\202\036@a\201\226hs\001]Q\204Q\372YV\205n \377\241\030\364\f\275\337pG\246\364\360IG$\245\322\243_l\026\326\373\266\017k\271OB\320\013\207\220\245\222\205\"K%\013E\226\352\257\3424)\221F\211@\3544\251\327\223\230\312A\374\177\356\273\334\177u\253\276T"
+	.ascii	"\315\356xL\002\026r\307\016f\200\224P4;\230\327\026\222\365\341"
+	.ascii	"\214\254\346\322|\366\031bc\344\035\024\213h`\214\025\273(Jm"
+	.ascii	"\\`\343z\036\020\212\364\310\212>\300&\202x=\277\306L\230B\256"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.refs.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`Z\001\245\013"
+	.string	"\206\035K0P\213\222\306\333\006\035DUUUUUUUUMf\274\303\"7\375P\340\037x\"\366\037\2017\215\332\030\331l\243\265\222O\b\331d\223-S\n8"
+	.string	"="
+	.string	"<"
+	.string	"\267\026\217V,\245`[\271\225p4\342\326a\2350\225\032mK%l#\267\f+c\272\030]\226~.M\212\332\211ZH\351\243\324Q\333\250ej\227Ru\372\372\3509\b\253@m\202f\0210\333\261r<[`\335p6c\275hZ\221t\242m\303Ji\033`\225\242m\267\220\245l]K*B\220}\2266"
+	.string	"\224\255s\255\2130*\310\276|\234C\032l1\002F\321>V\206u>\352f\031f\327\263\213\263\352\366\332\016\375\020\361\034\024p\036\3310\345\311\256\356B\263Z`\326\n\317J\301Y'\264UB\264F\270\025\302\352\203\265\301R\006K\027\250r\334\201\373:\224\201'74\3168\325\022\343.,*\bP<`\031\264+\322\345\254(\037\321B\321:\321\2566\301$K\231I\325J0BL\347\303tR$\205\246\263\211\330%B\325t\336\204p\224\3266]\033"
+	.ascii	" $\025`l\005\251\352\342\026*\251\3003\004\003'\251v\216KX\312"
+	.ascii	"\265\236\032.\032\203\036[\324\324\232\217\304\326^xI\203AmC"
+	.ascii	"\201\330ZRc\321\363\326\204fP0\207E\366(qa\242\356>PQ"
+	.text
+	.section	.gnu.lto_.decls.2b94bcafa62a7f8c,"e",@progbits
+	.string	"(\265/\375`#=\r\370"
+	.string	"jp\205QV LA:\351\362]\317\336;\216\270\332\217\253\376\372\022\3273\326\n\270\275#\251v<\312]\245Q\244\341\327R\271\256\267\236gp5vr\"}c:\342\243\3023\033\2150\004\002\330N \204\223L3\020\020e\366\252\032\017\257//\345 \262\021k\204\032\331D\356\024;\004\020\005O\005N70'\f\t\023A81w.G\315\031k\317\351\003\346\316\335;\036\016\020\353\022\365\351r\371\276\270A\271s\351\323m}\001\215\021ES{\302\022x\005\b8\306$\247x\315+@0\237\350=\273wM\023H\274Do\340\315r\271\344$=3TKF\312\024\246&k3\256"
+	.string	"\001\255\\\001\200\231+@\260*t\327\216\2033\035\364m\271\002\004t\362\304\211\255\355\231\237h\266\232|~\003o\230;\227\263|f\246\t.W\200dZ\251_\264\362\232\271e\232\251\227\027\360\016v\356\245Fj\030\235\3241\256`\313\270g.\364\006^\277\337\277;\346\370\231sR\316\371\036\374w\214\354\236\345(w2\022\236\2243\347g\332\317\201\0077\360R\271g \220r\316aU\201\2263Wo\2009?3\360\220A\0067TH\346\304\210\300\215u7\b/H\357\326\247O\326\247H\326\247[\353S\030\353[\320\313\375\202s\207cK\223,^\240\334\275\353\324\347\302\221\306\357\261\365j\271z\027z\363.\336\361\022\254l\226\363\023']\336x\241M\204P\347\212\020\276}\254\270\251V\013\332i%a\327\267\356\336\375\332\335\027n\222\256\035\316yyo"
+	.string	"r\356\r\200\032\007d\t\025\342\367\213\3657\314\n\302\215[\177\231\254O\273\033\2047\312\215\273P\f\256\334\357\333\205\273\272|\346g\3730\243\006m\374\253d\375\305@\230\016\016^\f\204\277=\326\235\273A\330n\227\306\372;\022\254\3273Z\037\315\300\272\003x7\b\177b\275\317[v\241!\256\3319\360\340\251rI\026\313\371\251\203s&\354\214`\343'`\375]\362\t\226\331\203\363\254\277!\204w\360\206\020\276W\013.\217\222\377&\271b!R\246&\254\234\226\363\023\203\316\363\206\023W\343?\357\006\341zy\204\275#\305"
+	.string	"\347\302\177S\270I\200\315\352\256\341\370/\001\324h\\\264\233?}:\223\001}Q\206D&\374\323\022\\\261\365O]\204%#\320Y\377-r\n\376T\350\004UOI\375mB\363o\0258\376\316\300\215\037\033\033\370oBc\340\357\032/\361\247\031\370^\227\370o\n48\274\203?\325\321Q\037D\340\277;\376\206\372\233\371\267\323\337M\177\303\370[\351\357\244\277\225\177\347\3776\177Z\201,\024W\r\260:\376\323\005\364\b\376\253\177\352\301\007\332\353:\177Z\304$\322!"
+	.string	"q\016\177\372\001\016)\324}\nn\036\027\335\242[\370{\313\177;lhd\203\240\r`\024\325E\307{\201Q\n\0304\321\337\037x\317\237\206\370\273C\261\207\376{\363_\253\327\374\351\213\026\2121\200\233\361\375\r"
+	.string	"\026\177\017\240\331$\320\177\327{\370_\200\377 ~\301\237\342\374\007\374/\376\257\360\177\231\377\202\377\245\371\357\375?\346\377\231\377\203\377U\377\333\377]\377\233\376w\370?\360\2775\377\315\374\367\312\377.\377\365\336\341O\321\376\026\376]\363\367\360o\232\277\323\277\325\277\327\277o\242\177\367\337\267\211\377w~L\301\337+\374\315\201\2775\360w\n\177S\340o\022\376\016\341\357\005\374\235\200\277\021\360\267\007\177\217\370\373"
+	.ascii	"\177g\360w\001\376\276\340\357\n\376\366\360\267\206"
+	.string	"\277u\376\306\373/\334\177\335\376\313\366\337\265\377\252\375\027\355\277g\377\205\376\267\354\277d\377\025\373o\330\177\277\376\353\365\337\"\377u\376\367\307\177\273\376\313\343\277\\\377\315\372\357\325\177\255\376;\365\337\032\377\215\372/\363\2773\376\333\364\337\245\377\306\370/\323\177\221\376\253\374o\t\376;\202\377\212\340\277.\376\313\302\177\333\377\202\340\277F\377=\376\327\370\337\020\376\233\302\177Y\374\227\375o\320\1777\370\357\210\377\002\375\227\373o\005\376\327\375w\305\177W\370\257\007\376\313\201\377j\340\277\030\370\257\005\376\213\302\177M\370/\206\377N\340\277\212\3772\340\277&\376\213\200\377\222\370o\317\1771\370o\001\376K\301\177'\370\357\207\377\346\374\027\347\2776\377\305\376\013\375\257\362\337\202\301\301\301\301\277\246\305o\023\365\213\030\006;n\370\202\334\331=\233LO\306\244\266\266R\256\f9\243\255\001\271\341j\202\242\344\372J\343\232\330"
+	.string	"\033\377\006)++\207\360\310_\034\030\337\325Uj\225\"\347\314E\312\231.\231\"\345\303\256\252*\265\312\220\261rv\3224\221\321\0245b\006\006\212U[\321\201\"\370\302\215\266\364Fz#\235\022\263\301U\264J\004\246\263\262\022\3268\235J\245>\200m\311\251T\332\264\241\001\003\t\331\225\247\016\332\335\230\251\3068\332\306\r\230\271\253\027Ij\324\270g\036\260\322-J$\177`:\177G\254|4\276\315ST\324=#A\323\004\311)z\206\2312k\274\2543ft\337\232\301`\341\344\250K\222\232k\202\246M\367\354iR\316\021\346\314Y\212\006\330\f_\226\036Ob\2441ZH/\311Q5/\224E\344"
+	.string	"snj\2003\004\311\031\022\020\245\364\205R\312$\314\371>\261\236\230)\323\322RwY\2259{xk\212\0302\201\021\251i\256\037\226I\221\212D\207|\2512UN\311C\271\301\301'23f\356\\\357\344$\244\031\316\036\202\202\314!\023\240_\223i,8\247\345eT\t\301\273\276\365k\335\037\264\377\356\234\210\274\\^PdL\214\230\356+!\350\274\337\273O\275b$H\023.+\253\306\0232\2073\360\246\242\357(\264\243m%E^F\231\360\312O\r\276\342\370\362\013\355/mw\241r^J\225\bs65\310\221\221&\266.\327\267^oy\357\375\275\327]n3+\301x`\343\331d\212\370\233\313\273\313\277\334d\0209bqQ2\215\357\327Q\377\207?q]\200`\326\277\177a^2s\316Q\35233\221n\256z\257\210\037\347\246W"
+	.string	"9\375_\2011g\345\031\254\276\265H\333\222\252q\376\357rN\322R:@\013*I\013\007\223\231VV&\005Qb`f-%\223Y\316\030rR\222R\004\254\214\201\311,Ce\245+P7?\265\2249\t+c\310Iyi\001S\222\026\024\223\331\022\n\003\223\231\026T6\323\312;9i\311\204\221\224\231\030\262\231\026\230l\206\005\265\303d\206\005\305d\246uuy0\235\t\003e\006k\213\314-cJ\3123\234\252\226\314\235;\246'V\326\313\371\246-e\246"
+	.ascii	"r\256\302b\352-q\\7\244\273\031HN\226X\367\231s\376\340\204\264"
+	.ascii	"\205\225\223\356\230\214`\345l\004i(;\225P>\357r\217{\247\344"
+	.ascii	"\252\312MK9O\340\224\263\362\346\273\234\2632\347L\303\254z\346"
+	.ascii	"<\265\303\344tr\312\271\351\301)W)\337\226r\356\264=7(&\263-"
+	.ascii	",\2377&f\316\374\342\251\274\316\254\247\305\\\315\224e\271I"
+	.ascii	"\314\352\204\242\021\246\3613Gx\344\307\213\267\306\353\327\220"
+	.ascii	"\035\202\215\237M\246\350v4\246\033f\021c\225v\005\327\f\351"
+	.ascii	"\3222\013s\352;\233*pF\006\273\326\256K\253\264e\265M\321=54"
+	.ascii	"\277f4>\r\024\225_hS\3518\017;9oU9i\222\346Z\n\337\223(G\300"
+	.ascii	"\314"
+	.string	"\311\305\325\254\315=\323\032G\361\260:\247\232WW\334.\264\335\032.e\312K-\023E\334\376\232\200\231\311\324\340\315\303\007\310t=y\255\027\362h\266\306!\203HT\343\013\251\326'N\322\206\317;\346S\343wp\306&F\326\320\234a\316ZR\234\235\326f\r\245\351\021\345\013\004\31497i\265^\273\320Nk&o\264\313\206sD\205\300X\361\215\372e\275\232\267^\225[\373\331e\027\372\270^\322cN\331\203mmA\3638\341\325\263\261-J\304\2268\257\374h\374\026\373\033I'\351\257\033\254\234\223\324>\030N\200\215[\304\345\021\336<\237w\030\346\372{\"\002\326_W\317iE\367u$I\r\035?\236b\3037A/\033\215\273H\033y{5\221\334^%\260r^\266\227N\231\234\227:\367\006\340\336"
+	.ascii	"`$[B\232\b\361\325\347\220\353\305)\204\205fs\254\361[H\007\271"
+	.ascii	"X\271C\016\2153\260\251\306\355\243\177\\\350\207\006r\303\360"
+	.ascii	"@\202j|\025l%A\316\367\203\360\016\016\336\017\302\356\341\363"
+	.ascii	"\356\342\0212\233O\035\023>\270\2204N/\017\217\177\370z\273\322"
+	.ascii	"\261\243\267\362\332\342\306\340\345\260sb\3219\341z\253\257"
+	.ascii	"h\326\334\264ZGs\265\013\027\332[\235\325V\266\332\352\332\t"
+	.ascii	"\2010\367\372\206sRa\266j\360U"
+	.string	"\031\353\261\340z\034]\217\261\254\307P\2520X\223\240\254\2115\026\201C&\013\022X\343\226\272Q\262\343\213\353\335\354\033\215\343B[\252m\244]\274\226jfG\245e\314\025\r\332\243\203\032\327.}:i\230l]\371\264T\323\340\341!\203\f2\020v\235q\t\256\370\370\271\036\203\255\307@D4\3240\351\231\315n\2267\330\2544>\346Z\217\247\236\256\035M\022\271\255\264\031\355\244B\251 Y6\356[\332\312\372\304lK\f\275\224I\013\276\272\321B&\260,K\303\255P\270\266\f\346a\256\034\033N\250v`\351>\254&\305c\013\343\265\335\023(\220\250+)^\032\230\246\264\327\270\256\016\337\005:\323\"c\332\344\354\216\357n\223\334\374\301\341\005\035\035\366\"s\362\005\002\352\330=\305h\212\221\223\303T<`)\303\210\210\213\372B7\224\253k\352A\005O\241r:I\322\030K\271\031\324\202Gv\206\3476"
+	.string	"y{\303Q4\f\321\332s#\013\274\242\004C9\216\342wv7\206\341\352\236\312\004\016\262\261\3416\020dQZ\2327OLz\330\265\2655}0\241\230\03571\303N\256\337}\346&\2262\f\001\256\250\340\335"
+	.ascii	"\314LU\"\204t\\\321\255\035;\241\023\016\236\271i\265y\261\205"
+	.ascii	"5i\214\323\216\325\264\344UYB\265b&\307hT4\270\030\271q\366\017"
+	.ascii	"ox\320\325\205i|\r\314\365\032`(Q\202\227\334\361\005\202Qq\242"
+	.ascii	"\261\245\354x\311gL\311\313\215\361\263\241+\334\336W\220\306"
+	.ascii	"\230\f\017\241\343\373\322\030\217]\273\325\214\006\0203\350"
+	.ascii	"\377\241p\213\221\254\027_\222$\301^\r\210\362\005\342\350x\242"
+	.ascii	"eN.,\254-\345\222\362\204\312\330\327\327\002\230{}`k4k\271\352"
+	.ascii	"r:\261\027\037\332\240\362\206\221c\257\316\273\313\363\303E"
+	.ascii	"\266\236Hw\270\b&\"D\313\225$Q\206\203~G\342\2064\223)J\256\256"
+	.ascii	"4\203\004!\343\304\3431\306\324\370<I?~t_\003\334\370\002\301"
+	.ascii	"\272(\311\230t\341\301\003wu\020\346\210[\2325W\025\243\307q"
+	.ascii	"\227\232\004\356\211\343\236m\375ui#\242CG\367Qq\n\307vD\235"
+	.ascii	"TY\317\302\\w\347\211\204W\305\231zI\275\360b\353\230k\355\302"
+	.ascii	"\273\342Bc\254\325S\256\0242\036N2\274\230\232\302W\tp\333\353"
+	.ascii	"\003\263\361!\003)\307\361\025N\023/G\374\260\325c\fy\343\262"
+	.ascii	"\252j\222\003\n\357-c#Q\264\234`\252\316\022\252\211\021L\363"
+	.ascii	"\273q\0037=\204-\203\004\366\224\230\272.\214\343\270Ysf\t\314"
+	.ascii	"Z\267\221\330\363\021Dn=\024\206\3025\356\222\374$T[\372\370"
+	.ascii	"\023\201w\004*\331\30350\r2RXfpT\220\013hQ\210\254\307\340c\375"
+	.ascii	"\361\023~j\273\024\\\334h\244\274\320\375h\346=\375\222\207\235"
+	.ascii	"|\220\3622\214D\230\023\007\220\213W\2641n\242Yj\3112\245\361"
+	.ascii	"1\310X\177\305\370R0]\302p\211\376\245\200G\354\242b\322\250"
+	.ascii	"\330^T)\r\304\313{\327\334\311Il\200Q8\254\224\372\351\275\300"
+	.ascii	"2p\f\314\204\223\360\022\206q\241X)%s\017X)\355\333\242\323\227"
+	.ascii	"\004\r\307\016\346\273\027\020HL)\306\276(1\322\205\342\345="
+	.ascii	"\370\340e*\210\363\275k>s\224\315\2230;\352>d\200\023\006\213"
+	.ascii	"\036\225\020\247\203N\236;\3044N\317\3204qTQ\342R\346BS3\253"
+	.ascii	"\037\330\233\340\275\330\314um\351\255\337\271\262~'nM\307\254"
+	.ascii	"yQ\253\272\266\365;k\353w\314\326\357\220\255\337\371Z\277C\004"
+	.ascii	"L\0325\243\322W\027\275g\215\367B\023R\2205\345\222z\321A\342"
+	.ascii	"\246c\255\213\t]vk\215\361^W\021\342t\332\222\243\027D\255\254"
+	.ascii	"\361S=um\260O\252q\252e]\332\301\302\240\306\212\355\212\252"
+	.ascii	"\361S-\177\032w\235\204`\320\314\230\306\215\346\3634\213M\235"
+	.ascii	"\\\224\fF\224\247W\322()^\212f\2162\021f"
+	.string	"3\005$\312R\343\247\207\246\363\013\323\3228\255K\357R+\377p\b\245\t\257\252\361w\224\353S\273\032\036W\200x5\356\224\356\351\013\377\220F\214\231\244Vf}J%\255\362\017S3tP`\364\255O\247\224\200KVX\343T\312\272\244\223\207\301po\211\227T\312\237\316\335&\355\265B7Q5\371\032\347\\\036a\032\347\363T\256\205\244U\251\322\030G\007\r\016n\314\231\302\350\002\305J\0227\267\224-\314\331#J\223/=\236<I\331\260\f\001\022U\237_U\320\330\032*T\032\343\021f\265\266\226\212\371\tm\344\277&\3400\354\213\006R\343\3530\251\251\245dC\023C\246\2740AB\302\207\206\226\2225V\316y)\267\320\033\322\024\035\206)2\206\f\356\354,-\"d0\272\312\341\310K2\006\205\006\n\215LI\311\241\243\254,%\343\363\222\227\247w\327\37093\306\306R\262\f93i\323\213j"
+	.string	"&&\216l\256\306G\331RV\2315I\222T,\305\006\301\326!\007uC\314n8\244\310V\223\2255,\254\373\3108\377\232`5aY5\002\237\244_\351\027\003\324\370\242*\304\006\361\032\037'\314\313\313\003*\034*\"D\322\"C\002\370\r\177P}\345\"\367\314f\013\024\230\2221\353S 7\025\222\002I\235\215eU2\3275 m\321\233,\353o\240\254\277\215E\370\343Gw\271S\362_\023\314\317\t\252-\254\253\253\373\030\260\206$\252\243\\Z\2725\376\r\220\3657\354\246:.4\325\221\362\310\300\234\200\f\037\321\314\254\322\240\007gTq\246\0018\307\"\0219,\266G=\307\"\"\242\" \016:0\"\002RY\343\nb\253B\247%\206\260\303\241\b\331\002\261?\355N\362\250\303\207F< \031\001\026y\324\022Y\026=\355\220P\321\310\2025\266m\021r(\205\226\205"
+	.string	"\222mQ$\332\371\320\210\244\321H\004\032j\211D=\311\266\270\242\347\350(\264A\213\243c\321\270A\211\017~>"
+	.ascii	"\241E\017\033td\004:\026{\220\311\243\236\236\026\212\220Cm\321"
+	.ascii	"\221\206\005\2215\342Ve\321\036\213H\243p\002\bt\300\200B\204"
+	.ascii	"\023<F\342"
+	.string	"Q\213,\252"
+	.ascii	"\324\241\207\002\242\"\344\b\254\261\310\242\b"
+	.string	"yBP\361\004\240\020CI\026\311\202C\020\221E\001\205\b'x0|hDOQ\261\203\360C#z\222H\226\205\"2h\202\366'YB\262h4\026\211\204.\214\212Pdh\215z\204\214x\200\216G#\264l\322\346\310\242\325\344\317M\373s\0242R\217BF\351P+td\215B6\004\305$N&YdP\020\221\306\205Q\021\020F\266F\351q\\ \333dQ\210E\341'\210=\n\025\215D\232 6y\204\201\330$\315\211-1\250\375\0212\032\221\363cD\304\246\320\262I\026\005!\243\020%`hY!\233\023\311\242\006!\242\n\026N\200\340\351\340\002\210(\304v\300\020\304\"\217\222\305\t\222DH\242\361D2D\221H\304\242`<\0022\022\201\006\260CbD\020\013Td\001\311\252h\223\304\f(\332\3421\0026I\036\241c\021\331\252\330\020B\313\n\351\220\320\262B<\037\032\001\364s<B\366"
+	.string	"\261\250 )D4\216 t,\022!\2116;;,\320\t\033z\202\214\305\243\025\037\204\216V\260A*\211\021-\222h4\202\202\233\020\216<p\260\200\307gD\262\004V\350H\034j\223D\343\206\024\025\250\360\201H\205\006\024*\220\300\266\304 #\013\354\034\250\210d\217\254\320\372\022\037l\360\001\b-h\016\202\002H(\200\204\360 (\300\307G\001\037\370\254\377\300'm\177Zb\253\"\247\275a\177P\210pBE\373\366\206\375a\203\212J@\262F,\273\342\346C#r\3266\311\266D\022X!\"\2225\"\"\346\264?\034tpl\201\210\024a\350\004\321\212$\016\001a\232\017\215H\376\344\004\351\2608\036\325\004\031\213#\b\021\2236;\311\037\026,\212\332#\024*\264Pd\314\020\304\032W\020\217,\215QM\373\223\264"
+	.string	"KTlW\226\250\230B\213$\266\311\341\207B\274\310\210E\366\264EE\310\036\233\344\217P\221\305\261\250\005\361X$\312\320B{d\223,\322\250-:~"
+	.string	"b\301\210\303\376d`\1774\260@\310\243\"\025H\266eKh\217,\022y\004\224\301E[\004\"\032\021Q\350\264\304\020T`\223G8\306\242\242\020~\324d\213d\215'P\260\311#\rG\026\b\311\236`Dt\224<\026\001\201H\026\223,\222m\223.\206r\332\237\017|VV\210\330\032\213X0\032Y \243\361\210\005O{<*Ba4\262(B`\201\220E,6\270 \032\215\222E\r-qE\021G\350X<\"\211\027\340`$\002\025\333\"\022\005\262h\204cQ\261%\"\217D\350\320\376\200\320\036\213G4\367\361Aa\201\005L\200\300\n4\302\005\222m[\342\212\236$\262(yd\223=\307\"\221\250\007\b\231\354\031\001\"\250\250\210dO`aD\202\020QEK\\\301\302\316\267\266\324\035`\032"
+	.string	"\255\272\002Tw\250:nr\306J\224P\245\016\325\005-1R\\\272\356\251Sf\211Y\236\312u\375\356\0246\267\263\306\357\240\264\252V\252\225\232u\200\271\2501FT\254\253Yq\352R\227\276+\215\325\253\307\t\252\221ai\254\346x\034M\225\272\255\253\307a\033oI^\270[\177\265\n/\231z\033\243\3664\202\006\226e\312\t\r\023@\266(U\n\267\341\214\2455\351\324&\216\242\243\207\345B\223\212\203J\346\033\213\272q7f\016n\251\361\315^\023;?\265\206W\252t\362TE\245\221\362\260i\002\243\273S\243T\250\2572.\265\207\312\304.\344\330\273j\354\341n\020\3367\237\253O\251\233\334R\231\031N?PC\362\032_u\362Z\301\f\020\031v\215U\031>W\233"
+	.ascii	"\360$\356\2551M\f\025F\031\323\237\n\343W\231\256\224.\0334\354"
+	.ascii	"\032\017/\217\360&\361\271\372B\007\257\315/\210\272\244*\335"
+	.ascii	"P*S\225\216SE\204\313\205\306*\222\317\325$U\252J\226\217\306"
+	.ascii	"6\352RU\332haB\247\246*\177<\250\346\366Z\201\355\2053\035\215"
+	.ascii	"E\334\rB\365\370\214\031\252\2623w\3174\0346,eM\312t\021\236"
+	.ascii	"\ts\366&\230\026\261\t\362\204S\n\254\221Vi\363\372\"\203E\355"
+	.ascii	"\313\235\214\306}}x\314e\2061\021\006\3677\005\230\2335D\374"
+	.ascii	"\370\357xL\222ZS\2551\306\233\332\323\322X\310\3044\236\316\f"
+	.ascii	".\031>\302\3349"
+	.string	"!\016%\30150]\200T\362`4~z\362\201\325\370\371\264q\313\241V\2431\366\202\275\244b)\224\035x\3765\301\204`.\230K*6\314L\022vL\0169\366p\263\206\311\027\227\264\205r\250\223S\344i\242\r\035B\016\315\214\220&I\322\030#\025@ `P$\035\315\313\232\017\023@\323\347#\252\030\205%alFD\222\024\244Tg\030\003\360\362<\007\222\202\210N\235\005,\236 O\n\212\242\237\331\354\235\030.\003R\0378\354En\235\221cN\223O\210\234\334\333\226\313~p\274\224\315\341\202y\031RD@\321\352\024R\277\0131\261q\017\353\2543\205D\313\t\255\270\225\276%j\325\325\332\224\347>\023;\315Q&\242\262\273\033\256ZN\365\222r%\332z\255\357kk\"\001R\210\231\302\022\256\314\013\3512\365\303\335O<cI\3267\365\224\354\327\001\246E\312l\022\226\346t\323r\262o\027e"
+	.string	"\370\036\326A&\022\001\234I\037W7bMu\305\343\351\241v\270\203\215:9\353\203\237\253\360\t\310dn\250)\036\022\265\267\310\232\f+\330\315I\253wE\304\244W\242\261z\256!\027\236\256\265\245\013\260\332\355\277\306\027\032\032\233\305gS\f\362\3750\005\222n\214l.GJ\245\256w~a\250\033\235\262\246\323"
+	.string	"\314S\254X\343\301\260\312s\3032\204\226\036\272a\210\375"
+	.string	"]\334\303\322*\034\273\314\3411\004\314\233\217\337b\271\223uc:\226\201\2562\273\t\253\353\363\2440\322Hq\350\333\304)\r\375\311\177\326FT\2065\003O\332\362\217\264\016;\301e\337#\376\f\373\247\376\326\272\030y\273-\247SI\b\005\211\325\026%\270\"\222\2218\205g\320\2124\330\276\202\025\205\t\312\331I\243lk\356\031\312\250\244-\245!\313\272\357\275\357\343\354\2654\262 t\215\026\302-\356T4\351t\177-I/HRyA\232)g\267\272\311\027%\001\372\257\224\201e\210\037\024\353=F\376\237\317\326"
+	.string	"\325\313\325^Pd\365\274\354\231\321\330\021E:j|\266\036c%+\364\271\311\330\244EF;G\303A\031\347\026^B\n\326\004C\304o<NLG{0\262\373\n`\231\017\300\3570p\007}j\031\201\333\221e\277\033\027\321\006E\201P\n\313\\\327\347ff\344\357\323\276\274dBf\001Bk\310k\300\337\b\247\244X\264\004d\207\310\207cb\255C`\254o{\256\n\316:\372\265$\023j\3203\221\327\251\210\025\343\350n\220\351\223\006\270\240"
+	.ascii	"(*\327\032\267\266H5\204\027\372u\002\033<\204\016\377\221\264"
+	.ascii	"\322\366!\316UT\001{\207\330\334\200\375\340\344\365\216\006"
+	.ascii	"\252*\3601\037\256\204p\374\356\201\306\335|\236M\253'=$)=\256"
+	.ascii	"\310\201\354E\231G7 EoxX\273\232/\360\222\025\030\265\3218\341"
+	.ascii	"\202\276\354\337\025\033sD\275{\031\334\374\257qV\305%w\360\373"
+	.ascii	"a\255CZ\"\025\343\214A\r\016\360`\241E\362\004\242\177\313\332"
+	.ascii	"\346\305\320\344\031&\256\226\017\212\363\360\230G<\025o\361"
+	.ascii	"\004\346Y"
+	.string	"\256\247\215\277$\372\333\271.\211\326\216\206\220C\257\241\333\345%\036\027e\3468\316\314N\032\033\321\177\265\216y\302B\233\354\220\203\366\032\326\373\3011\027\351\221\003\335\205\253i\360\2059\016\020\367RA\271t\352\326BL\252\352\t7\316?1\034\340\210\3631D\252x\255 \373\360hO\234\210\351\375=\330\025J\276\3071r\243\2053y\352\226}\f\234\330\007\361\347\353\340\003\304\017\3568\337U\024x$\200\272\215\3475I\376\311\353j\215'\037\224/{t\035\270T\\Uma\274\315j\241X\313\035K`\021\253\204\350\243N{\320\375\366\235\325\277\223\335\370\252\002\222&2mT\013\371\001\025\034\221\341+\212\347fh\373<\254\034\266\336T\212\273\302\276k;\343\321\225\324"
+	.string	"2\230Bj\005\037.\306\206LmK\207"
+	.string	"\027\222\306__\366\207#(^"
+	.ascii	"\0312\325\322\372\235\024\001\267\025\201\334\211\207w\t\301"
+	.ascii	"b8\352\006\033\021\244c\211\206o\007a1\264d\030^\0012sq\353\206"
+	.ascii	"\370[kI,q\016\3106\367\b\375\2125P5\374\273\211k\005\367\313"
+	.ascii	"\035cY\363:7\376\325y\345\235\t\216D\230\317\331\025\306po\377"
+	.ascii	"\323m\360\035Y\353\223o\350\371\245H\013\200(1\353\272\210v\006"
+	.ascii	"\376\3715\\\247\251Ar+\357R\347\236&-\270\274Q\221\264p\025\264"
+	.ascii	"\261\363F\1770\267E\255+\021d~\364sMu\001\202\035\004\005g~\203"
+	.ascii	"\235\227\003\363\031t\225o\355\367\312ET\trQo\242pZ\315\255\272"
+	.ascii	"P\312\330\273\361\350B\353\305\225\021\235|\251\326\250\242R"
+	.ascii	"Z\335\34229G\2210(\242L\301\2301\341\016\362\315\3162\023\371"
+	.ascii	"\3615A\004\233\335-\356\232<\327\260\222\336\376o\322\233\315"
+	.ascii	"3x\371\374\035\344Yc\201\334\354\324w\205p\021\311\2428\317\276"
+	.ascii	"\003Z (\027#\223\003\237\300\034,\037\315+\206\247\272d\225\376"
+	.ascii	"^4X\203\277#\314\272\034\320\252X\241h7\236"
+	.string	"\314L\021Hm\306\370\b\334\377y\267l\254\026[Eez;\002\006V\372\371tf\336$\231ti|O\321\355v\360\320\264\tR\031_#Pn\f\277!\223\363\f1\251\342\324i\007!\347\321\017?\036\327\236a\226\036\356rz?\026\314\267\266\016\f\206_\b\234\305\231P\256<J\327=\004\210\342\226\r\245^\363\2178\366\346\316\337\334\200L\031\245f\032\2143\213\276\377`a\310\001V\347\242\3619\323\272\335v[\343\204\332\372\365\177\357V6\023\316\306\317Gy\316j0\222\233%C\312w\215\372-O&\262)\305\005\262\225'If\251O\243\330\317\005\007>\264\361\323\021\232\331\177Q\314\rZf\255\240\217%\364\211*\005:\226=G\3119\200Y:\004'\324\2004h\013\217L\005\356h\320\227\270\206\215)\302\032\337;H\361)Q\365`\003\005\2362e\233\214\342cRa \206tp\375IK6\222\313"
+	.string	"?\003\255,u\240e&\223\266\357_<\205l\211\b\302\202P\021\226\263\373\346\344\302#\004F4,=\023\362]\032jE\252U\"\201w]\226\247\242\372\0165\007\035\300\205\005\033\373\202\004;\211v.r\246"
+	.ascii	"\fl\335\225\005\f\273\257\2317@C\213\031\017\006\227\032\306"
+	.ascii	"\301y\232\3508l\246}\3326\216\376P.\024\362 \214k{I\365Q\021"
+	.ascii	"\242\371/\205z~[\026\313eE\2102\250\177\021\341t\320\355\320"
+	.ascii	"Y\016\321}O\313$Yd\r-\273\370\234^w\311v\r\022YC\213\024\251"
+	.ascii	"sy\257\340\230j\320\217e\r\264H\017\347\301H\2753\324\270\357"
+	.ascii	"u\317\266S\n\236\013\200@({Z \314X\016&H9\312\023\324\327D+\260"
+	.ascii	"cx1\270\266\025\251\316]\365\222\214\247\326\\\013q*W\026e\036"
+	.ascii	"\n\243\302\270\n5p'\030\265\3253\337\325z\016\312&\007\236{{"
+	.ascii	"\016:!)1\350\f\024\346\251\327E\255\031}>:l\220K\336\251\020"
+	.ascii	"\033\336A\331OL7\027\322\240"
+	.string	"2\210\241%\332.\331\365\203\354\017)\031]\374\262B\355\315\016\312;\005L\226\206\236%b\016]\374\270\025\344\327\001\2209\3730^\256\\Pz\207\t\353\323\271\034?\216\230\0364H\023-\3262\364\367J?\246\310\264\360_/cc7\177\330R\177\365\031s\030\303\263\351<\211J\227_\261\005u5\224\223\216\035P\247\232:\374L\313\016<\215\300S\003\371\001\301\370}&\233\201\336HnlE)\214\340\336\365O\371\001\337\360\237\257\034\177\301B\200\250\215\177\005\204\347\033t\266G\216~\264\255== Q,W\331\201\224wy\377\tP\260C\200\204d\204\006\335\316\300\342d\346\274U\026\211\341\277!\364=\304\326P\003l\277\301\307\247\bfG\2323\007\211\331A\351\253\224\202\356\003\201n\306z\371\333*T\0309\363\244pY\226,\241\317.\374k^\0026\324P\373p\335\216\322k\177C\226\001\006\256\017P"
+	.ascii	"\2225uG9yoF_Ftyz-\312\315b\261\310Z\310\341\250\202\325s R*\270"
+	.ascii	"N\353\257\f\372\247\376\375\n\213r]=\310\230\3063;l*"
+	.string	"\234`+\272\240\212\3664D\300\324\270\227\315F\273I>\364\021\260&\230\027\t\013n\331\034\341\216\354\016\211\350\375\350\370\302n\"6\222\320\326\332\357\013\264\210z\035\177\025\255\336;\236\367\022{\265o\316M\235\r\361\333\365\237\222n\340\217\034\333?\314\2107\353\317\240N\310\333\200\207\025\256n\274\307\346\243\361\337\352%[\2511\344\016:\f\341\370\357RT\f\310\377%j;\34272\325Q\323\3552\254c\327\226\327\303\273\233\374\357?\270\013\300\225\223S\2403\314r5\344]\366\036]y\231\330i\354\362\251\r\326\203\217Gqj\257;\211v\f,c2^\t\307\273k\r\t\371\214\333\253\001\373\341\350\203 \003N\337\007\325\305'f\005\217\246\225\267\226\363\241\303\020_\270\267\361\376\373$U#\026\374J\236&\304\376\214\301e\370s\230wN\344\245l\233\242\317\305=\301\215\305\377\026+.\naC\005\366`\017"
+	.ascii	"\363k\301\375c\271L|\313\202\207\275\260-x\216ug\206\217?\267"
+	.ascii	"\206\274J{\005\265\376\241\241\276\326\023\234\332f\022\324'"
+	.ascii	"\373oT3q\211\353C\2755h\273\205\317)'c=\217\372\203-\217\253"
+	.ascii	"|\234\204\366F\351\3218\234}\313|bS\316\340a\322%\322\016\302"
+	.ascii	"\322\\}0\377\253<\264\230\037L\030\200\317\0371\3564\2116m\365"
+	.ascii	"\f4\277\357w\320w{o9\034\230\001~?9`r\246\341Z\343\317uQ\367"
+	.ascii	"q\345\207\242q\305\007\356\302\266\351\203/\226\243\357\027\333"
+	.ascii	"\003\275O\002\215\007\306!\273\335\366\002\377\337ch\313\247"
+	.ascii	"\rw\217\272\226\346\307\343\361k\260\023\235\316?\036\343\307"
+	.ascii	"\226\0339^\270\374p\263H\335\373]\305w\336\302M\236\031\307W"
+	.ascii	"@j\232\365\023\362\323zFwn7\371\307\363=n\372\324e\376'\361\224"
+	.ascii	"Kw\225\217\244\037S\316\362>\361c\307P/\024W\222\027B\274\322"
+	.ascii	"4\212\314\223\201\237[\231\232\317\3301e\375\220\311\fw\301\211"
+	.ascii	"\021\254\373\337\205\350\205\3653\247\263vA\241t\370\027\031"
+	.ascii	"$\326\365\341ge\342\374\265+1hwr\272aCa=]\001"
+	.text
+	.section	.gnu.lto_.symtab.2b94bcafa62a7f8c,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2b94bcafa62a7f8c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,471 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 \310\035\003"
+	.string	"\224\004\274"
+	.string	"\t"
+	.string	"\207\235\361\201\006"
+	.string	"\001\240\342\234\212\n\002\214\230\327\245\016\026\002"
+	.string	"\002\001\003\002\003\002\002\002\002\003\242\302\263\302\013\004\240\306\347\273\002\003\005\273\337\224\231\013(\002\004\003\002\003\006\216\305\332\310\005\007\b\240\342\234\212\n"
+	.string	"\n"
+	.string	"*# \314\241\027s)x"
+	.ascii	"\013;\027\200%\260@;=6\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 o\205\002"
+	.string	"$\003c"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	"\t\002\001\003\002\005\002"
+	.string	""
+	.string	"\004\001\004\b\004\001"
+	.string	"\001"
+	.string	"\004\002\001\001\f"
+	.string	""
+	.string	"\001\201\f"
+	.string	""
+	.string	"\t\001"
+	.string	"\001"
+	.string	"\f"
+	.ascii	"\370\200 \342\210\020\240\253\303\235\205\254\f\343z\324\\\003"
+	.ascii	"\360\252\230\007\332\207\001\026"
+	.text
+	.section	.gnu.lto_.inline.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`\031\002u\013"
+	.string	"\306R6,p\247I:n\275\200\200\200F\207\300\321r\342\020\013\276,\006^\033~C?~\370\367\302Uq\362\323\361"
+	.string	"\232\375OZk\233\310\235\002,"
+	.string	"("
+	.string	"-"
+	.string	"\317Zh\377<kE\206\300\030\006\330\0040\f\243\r'"
+	.string	"\351@K"
+	.string	"!\241\220\360O\244g\203\035\320\026\362|[H\225\266\314\337\311 \237Bb\3664\n#q\243l\024\007\013\264\220\303\3470\224\2638\005VZ\3102\357:\017\242\315\336\3402\331\311`\333\332\341\253\356H\353\353\227\336\241\016\376\206f\212\252a\226KO\213\230\206\221\031N\017*0\020\231$\274\254\220<\202\215\304\267\007\023D&\013\020\001\337\365\276\233\267RS]W\316t\234\235\365\202n\256\271\256\257\347\007z\3463\315\272\025JeoA.\022\013\245&F\250\221DF!\252\221\224$\305\214\001`\0021g\233\007\021@-bJ^#\323\032\337B\345R\255\262R\200\244 u\200\202\371\312G#"
+	.string	"F\325W\302\241:\343\257\345\205\032\022\373\204\254x"
+	.string	"\330\335\266\232\314h\235\277\r\350\226\252\261\306\023\330\n\272\267\032\315\264\342\331\260kVE\2436\031z\214\244\323?\365\346\332\227\334\341\375\267\257\331o\206\214}\007!\340p/\b\244\356:gx\371"
+	.ascii	"\r\260\223\373\371\t\217\245d\221X\022T\f\013\313\337\324\003"
+	.ascii	"\300"
+	.text
+	.section	.gnu.lto_.jmpfuncs.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"E\003"
+	.string	"\022\206\020\031\260%\351\f\303\002 x\030V\251u\200\034\206a\200\203,\266\244I\222\222\f\032\340\331#\320\t\235iv\261\373B\237\3065h\301\025As\021}4\212\032e5\bL\244y\207\334\241\324l\333U\323!\r"
+	.string	"\031S"
+	.string	"\020\220D\224\243\220\r@\f\003\226\322*L\353\234\322\222s"
+	.ascii	"W!4\250\302\220Y\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\231\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 |5\002"
+	.string	"\264\002p"
+	.string	"\004"
+	.string	"\002\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340\f"
+	.string	"\001\002\f\001"
+	.string	""
+	.string	"\005\002\002\b"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"<\273\020U\300\252\004;\3235\355\3144"
+	.string	"**i\006\006\n\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.16b6c9114edbcbda,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.16.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 \230}\004"
+	.string	"\024\bZ"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\256\230\ryw\250\337\005yu"
+	.string	"\005\001\006'\001\f\005\001\006\035\001\001\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.string	"@\b\341\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_initBoardAlignment.18.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`\224\003\275\026"
+	.string	"\226k\222E\300\332(\035P\004\212\340R\273u\360\"\266^M\003\377\372{\021\021@\202\364\375&l\301\276p\201\377\365is\353c\264I=\375\326\372\031\b\301h.\302\033\272N\312:\342U\301UdhCA\032\331D\312\224\002z"
+	.string	"w"
+	.string	"\202"
+	.string	"\321>a\217\036\177\235G6\356Bb\317\245\360\226\310&\220\001\245Gh\027\206\202GO"
+	.string	"\"=\355\367\034H\3547\025\007\260\313\023\304d\027\267\300\r\300G\343.\340{\004\037\340{t\314\336B@\207\244e\347GhwO\212\343\261\213\276\350i\306|\331E\"\033\335?\031\217:\351\215l9\251%\333\n\357\300\356~\367ta\243e\212lv\327Y\263\305\270\301\333Fa;\203\255\267\016?\223\222\262\350\202r\022\214\2773\316\213\204\340n\216\003\237H\b\023\376\216G_\305\367h\322\357\036 J\r\032@n\263\034\262q\264\324\033\366\275U\036;\246kb\232&\246M\277\375\245/=\212\351\031/-\023\323\340\227\026\305\364\347\245cL{_Zc:\275\364\013h\213\235!\003\256\354\276\030\n\263@\321\t\217\347~\373\376\317w\366\310'\356\343\037\351A\243\347\001\372y\032\325\223\262\343\021\207\002\356\256\247Z\273}\271\251\332\035\376\304K\f\344\260=\\\367A"
+	.string	"\226\335u\360\350\375\324\272"
+	.string	"\310T\033\004*_S=\220\2432_S\2773\306\244W\0137\332\225!c\236\372\374&w\222\362wX\265\312\327V\337\343\203\036!/\212\333\225})\274]\033\021\236\373\f\037?\270\344\214\333\335X\243\244,\254+\251\321O\321qOo\0309\215\246\225\021GB\243\020\202rwe\032/\025\211UKB+d\301P\260\320U\222Pr\212\001\254\245\302i\255X$P\"\\\2500\304\351\345\n_-\325\353\324b\241pN)\327\353\304"
+	.ascii	"\201\303\022*\327\t\026\206\256\323\b7\273\267\312c\233\231\322"
+	.ascii	".\342\222\313!\033\310\373\334\312\r\270;{\315\247\362*\024*"
+	.ascii	"\334\334|\217\367\271\356B\315\306\240!_s\356l@:*\363H\355\r"
+	.ascii	"\007R13#\031\235\001UF\275$\254K\001UY\004\371!R\233\303\243"
+	.ascii	"$\371D1? \300\002\231\031c\007@BJ\016\212\246=\265\361B\232\202"
+	.ascii	"\222\306\270\265\216\253h\2645K\tZ\213Q\r\221\311=\306\244$\206"
+	.ascii	"Y\\f=\217\371\004x\320\"\306\356 Xf$\213a\320\205\367\215\020"
+	.ascii	"x\340\016F\367\300\013\345l\fAQN\346k\337\f\337\271b\004\"u1"
+	.ascii	"E\301\035\320\205\013\242\374\252fqu\200\002\364\206W\264\306"
+	.ascii	"9>fZ@\006>$\356\315;T\244o\356\324K*\332yEB1\240\033%\247\267"
+	.ascii	"k\225\001"
+	.text
+	.section	.gnu.lto_alignSensorViaMatrix.20.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\325\013"
+	.string	"f\026Q@ Q\233\016\037\b\315\310@[\025\360\tqKg\024(9Q\232 \\Y\b\024K\340\255\355\314\376\333\341\255G\204\345\345\006X\310\354@(2x\030\024K\210\"\fP\360o"
+	.string	""
+	.string	"U\262\367\226)\005?"
+	.string	"<"
+	.string	"="
+	.string	"\234=\343\237\307>F\307\006\220\032\273KA\020\347\036\241r\376?\036\240\3636\217\222\207\303x`\304\005\215\311\363\304\t\207\210\356\037W\016^G\025"
+	.string	"\203\335\265v^\207[\336v\003\333\017\354+\b\360c\377\373\345A\177\204\352K\021\bF\201\026\273\034%66$_\214\260\375\311\266~\031n,\270\3327\361\023\334A\016\271\200\335\017\013\221\335\017\201\023H\227\376>\211.\245\017\210.\035\372\316\361\036$#\"\320\232\350\260\222B\206GI\354\2538\210\306\017\341\231\321w\231\350\362\020z!%:8Z\342H%\214\320\266pA\337YW\220\bi\200\033\373\353(\374`?\356\356:\030\256l\253 `\363\332\252mF \260i\326%\332B\3310\013\203I\270(T\227\254\232\025J\313\246\206Y\032\205]\025\206\262d\032E1\340Y\301\312\250m\316\214\232>\316\343\302\217\035\240\bq`'N:\001\023\024"
+	.ascii	"'\324\300\231\320;4F\326Px\330+\264q\025\226\001\257,\366\032"
+	.ascii	"\260\035X\230\245\305\205\367\025\306\003\252\032\270\002\346"
+	.ascii	"*\250(\342.\307l\222\006\246\366"
+	.text
+	.section	.gnu.lto_alignSensorViaRotation.21.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`\006\007e "
+	.string	"f9\306I\240VN:\"\326\007\233\036\214\261\257\027\331\270\217\261:\2263\033t\224\036\t\211\361\003}n\001\231 M\251\261}7tks{\210g\372j\340j1^N\r,x#F\035\372\311U\230\243\237|\354nM\332&d\313\224\002\264"
+	.string	"\242"
+	.string	"\265"
+	.ascii	"C\003\202K3\256\324Z\033\2344\205\362\244\201q\256\rAB\357\304"
+	.ascii	"\022\236\265\"Q\231\360\265\277\343<z\217\262\326eje\312\342"
+	.ascii	"\252\225\350\300\021\312\223&\336\206\236,OCO\272g\213\235\350"
+	.ascii	"T/\025\343\004U\227Zkn\302x\357\270\233\255V\322(9\316\355\371"
+	.ascii	"\353\224%H\344;.\353\343\222\n,JE\303\337F\006W\200l\371\215"
+	.ascii	"\241\341h\263\202F\360L\206\\\254\215DQ\373R\212\321\246\320"
+	.ascii	"/(rnA\215\264\233\253_X\302\302\242Td\364\331Bx\002hB\310F\024"
+	.ascii	"D\313Z\353\225\206\214\312\245\335\324Z\275A\242\242;\346\266"
+	.ascii	"\273\330\276`\323"
+	.string	"\035\001e\315$P\205+\203\267\374\247\221fb0\212r\255\f\336* \345\311\267\026=931\030\201\2450\372\355\231M\f\332\331d\177\254\223\311>\361\267\371\324]\363\252\233\346V\367\314\243~\031\332:\206\256qt}\243k\033]\327\350\272\244k\032]S\272&\351z\244\353I\327K\327O`\033.!\340U\353\2123\263\032Fv\325\370\324_\365[}\332\367}<\313\276\031\304\261<\213\252p\324Zo'm\020\366\355\344O\365\342\257|\263\222a\241*\204\001!\0015E\320\223\215\n\345{\\\252\367\251\020\245/I[@2'\337\"XI\243M\035\322\030pK\016\241\2262\341\222oq\b\215N\277\253f\322\251C*\222\344\324\035qQ\362-\352\2403Vr\b\307q\352\216\266\220|\213P\344\234S7\034\003\356\364\265v\352\206Q\200dE\276E\026\343l\232>\327\376\b\316\314O\335\260\b$\243\231"
+	.string	"H\"\2602\341o\317\374!\247fa\276\005c\342l\222\342O)\315\236\370PhcL\374&\224\n\230\037F&\371\362\223\214E\214\370G\246\017\"\276\227\305\312}\tz\322\033\254AQ6\352\213\272\340Bl\213\375KX\253\357H\033\254\013N\332L\005U\314j\213\rc\277+\">\342$\356\263\343\001\302\001\332\361J\240\037\235\r\243s\036"
+	.string	"\371\350\364\370\354\360t\300\331\300\303\331i\310\375\360v?>:?9\037\036\234\236\\\016\357'\367"
+	.string	"\201w\036tx9\240\335\216\227\273\021\177\037\353d\272z\211u\024\366\233A\270"
+	.string	"\373\037\373\333)k\375=\350\255\353\313\361\237NZgg\207\236\224\231~\026\017\207}\320\317\272\255\312E\230\211\351\273\223\227+\\\267\0174fj\220\242\"\264^\354\177\271\331\007\377\311=\273}pGO\306\314_\375@\021U\2310\310}\343[06\034n\352\222\316n\267\251K\342\002$\263\331\246.i,\312\267XV\253\325\246.\311\253,\247.\200\205\250aX\244\02444\"J\nR\320\2445"
+	.ascii	"\003\221\231\3326\021\3004\351\0341\231@I\n\316\001r\350\221"
+	.ascii	"roE\325\220\034\3679\340\013=\252 \257M*^.q$\330H\206l\255\221"
+	.ascii	"\260\265\b\261\235\337\005\356\354O\272G,g!\005\ri}#\236N\216"
+	.ascii	"\370e(\326#\315u\346\013\003\301\203\270\341\227\355j\307{g\002"
+	.ascii	"\276G?J\320\215\365\"\272\\\003y\270\236E\260\221\355\r6A\233"
+	.ascii	"\216\303\200p\217-\f\230d\n!\323r\267\300W\205\006t\357\220\356"
+	.ascii	"\035\322\275C\272wH\367\016A\367x\r\231I\305\237\037\304\202"
+	.ascii	"M>\355\264\276+\3472\017\033a\301@T\t\247\341\246c\313R\217_"
+	.ascii	"Z\331\201\204\370`%\334@\024,\220RS`\253&\363\r\307\276\215\224"
+	.ascii	"\020[\234.b\rW\002AS^\371\350|\302\241\335`\022\300.\266A5"
+	.text
+	.section	.gnu.lto_alignSensorViaMatrix.part.0.26.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`\030\001\305\f"
+	.string	"\366\227S?\020Q\234\016\203\237\024\006\220o"
+	.string	"\305\323\231\356<\001\027A"
+	.string	"$E\013\316\314T\240\300\202\352\302\177}_\317i`\274`\301\342\355\001@\325\021\350\244\260\221\332O\025H\303\305\344\265\361w\333;\245?"
+	.string	"B"
+	.string	"?"
+	.string	"\224\372"
+	.string	"\310\251\375\023\266/\033\177\266\214\207$\3661:\033D\032\273k\235N\320\277O9}\276x\031\242\006\310\301|~\274\354\314"
+	.string	"9\037.\005|\342x\260\273\246@\334\364\266\035\330\206`_\023\225-'yr:*\313}\025\027_te\373#\221w`r\330\fH\301\251\247\310\263\321\200:\255,\345\303\213\201p=l,\245}\024O\361=\344\216Gv=\245\027\273\341\202S3\240N\035\276"
+	.string	"\344\001w\341Q\273\231\322[T\277\304\251/x\362\340\251\357AN?\375\221\303 \017\372\343\003\220Dxh\230\0309?\236\323\264\323c?\374?E\022|\354v\270\361\261#(\f\023\037\375\366\375\025\037\355\031\262\255\273\"h5\353\256\256J \320q\030e\362D\322iXE\243\220U\270(\333U'X\334V9\r\343,-\273*\326d\343,\t\002W\013\330fu\265nV\365i\247\307\026O\221B\036\231\251\231\363c\033\200<\213\035"
+	.string	"'t \304\306\330\334 ?\013'\023h\321\250P"
+	.ascii	"y`\204\353\260u\326\n\323\230\200]O\264z\204\307/\326#\2026h"
+	.ascii	"\242\210Gj\310UB(8\246\323^\361\264\333f\312N\003\300\265\007"
+	.ascii	"\020\315l\376\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\325\005"
+	.string	"\022\311\",pU\323\001\216{\375\376u\377\376V\307\002 \350\355\334\215sG\374\254\002U\305\372s?.\200\321M\002\205\214\r7\201\355&\267L\001\307:\b\256J\325\013@\207\363\347\331\330Eo\243%\232\201NW\323\315\305\267\n\350\2331\206q\246\335\375#\002.6\2505\301s\005\t\376\223M\022yh\216\255\241A\026\327I\251(\002_\217bk\020\237\354\314\304\325\333_gC\002\370?\321RN\314\317\377\246\242Ow\267\304\207\367_\031\001\022"
+	.string	".\343gU\b\030\032\024\354*Ib\206\001\352\341\003\304\307\245\242'\030.?\326d\242\020\f\256\276\f\350"
+	.ascii	"\216\211Z\t\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003\002"
+	.string	"\002\005"
+	.string	"\003)"
+	.string	"\002\001+"
+	.string	"\002\006\002\007\002\b"
+	.text
+	.section	.gnu.lto_.decls.16b6c9114edbcbda,"e",@progbits
+	.string	"(\265/\375`a\023}_"
+	.ascii	"Z\244\250#R@\220J\032\016\350\024\233=,\206b\017Cbk~w\036\f\021"
+	.ascii	"k,\b$\00464E3\341\363\"h\344\360\345\212h&\320\034R*&\032!I\373"
+	.ascii	"\207x\007\350\007\245\250\213;\330\215\260\271\200<"
+	.string	"~\366\337\034\333\253\317\210\035R\336\373\355vm\"e\n\335\001#\002/\002;\311\276\352^w\r\355F\356\216\350\331\035\201\203\005\007d3E\277l\300x\361!s\243\203\025FyX\263\235\326\262\003\265\254\270\365\262g\373l*,\265\375\262\315\365\362\020j\0244O\314\024\375>/\306\314\0018\315\214\017:F\027\215\350\233\366\223.\243\326\356\332\215\2251\265a\224wN\355\322<+sI\216m\352!\270RuU\326k\033KN\262\262\254\225\213\365$\327>\222\2525\271q\265e\265,\227mn\226\305\"$$\024\264ue\334\256T\364\373\245~W\365\013E\375.Q\277H\324\177\311\376\205\262W;\266S61\273\253{\005\221\266Aq:2*\266&w\244\270\271\t\303\350WJ\245\262`[e\233\033\266S\276]\353ut\355NB\300\205u\365\265Rzr\272\247\242Xu\3677\353'\372\206m\224\225b"
+	.ascii	"\215\356))\037\25563\234\320uw\220\220\220\220\352D\356LKE\357"
+	.ascii	"S\377\\\240t'\004\365\027\250\273\256\3266\217e\235_\254\315"
+	.ascii	"zNrmgw\373,\221,G\"\214^\002\365\273u\002\276tGp\0375Fw7o\217"
+	.ascii	"%=\253\"\026(E\327\005J\325\375I?\374\354\363\302\277-\274\367"
+	.ascii	"\263\211\177\3235\356\256\370\235\237s\376E\341\377\334\022Y"
+	.ascii	"\370\257\345\177\226\377[\376\177\331\244!\330\377\257\377TV"
+	.ascii	"\370\357\nG\340\347\003\376\355\340_\026\377\202\360\257\007"
+	.ascii	"\377j\360/\007\377~\360o\b*\374;\364o\006\377b\360\277\347g\252"
+	.ascii	"\177\201\377\372\376=\341_\023\376%\341_\021\376\005\372\027"
+	.ascii	"\375\267\367o\317\277\274\377b\376\213\375\357\341?\335\177\026"
+	.ascii	"\377\337\376\223\360\277\355?\b\377\331\376\253\375\037\373\337"
+	.ascii	"\342\177\320\377.\377\323\272\272\272\272\177\315\376]\b\277"
+	.ascii	"\017\003\0019\310\270\211mP\201j\202Dl\345\311\002\3032\205k"
+	.ascii	"\354\224\235\fH\264\354p\245\272\341\030\334\360\214\264{W&\216"
+	.ascii	"eG-K\374\314t\236\261i\3120/5\2072\032L\330l\233\357\233\277"
+	.ascii	"\341\244z\354>\256\215c\325\242\242\242J\360<\271\301M/\235\223"
+	.ascii	"\207\333\351\276\352n\003t\226\240![\031e\344\303v\316\312\336"
+	.ascii	"\370`\364i\370\370?\207G\327\205\007\023>r\253o\317&K\346r\312"
+	.ascii	"\304\322\2641\332\334\272=\203:\237|\2551\372\235\020\365;\033"
+	.ascii	"\352\371O\033\271\354n(\234\265\227K;\351\277_\234\335\022?\317"
+	.ascii	"\3566\201\377h\357\376\243\030\322]\305&\247&\021C\362`\021\375"
+	.ascii	"&\335G\020\275\366R\351\234:*\245|y\002\2616\220\001\332iC+\327"
+	.ascii	"\251'\224\331\334ko'\247\236XP\256\314\245re\036{\235d\036\273"
+	.ascii	"\327\247\236\262\013y\\\245s\352I\351d>\201\350d\037\333\211"
+	.ascii	"\004\242&\231OJ3\346SO\351D>)\223SO \220\260\031q\253\241f\313"
+	.ascii	"l\275(\223}\303\251\007r\331{*Wf\263uo\027S/\023\350\356\301"
+	.ascii	"\\\262!w\354\330\322\363\306\022\025$s\327\356\016\341\264D\305"
+	.ascii	"\354\344S\251\204\331\255d)\251\235P\034\327g\023\331\347\321"
+	.ascii	"\206\036\335\304\324M@\257\335N\335\307\355gw\037\273\233\267"
+	.ascii	"\354\261v\327\320SZ99uG\0059u\217#\031S7w\215\031{R:\251\230"
+	.ascii	"Dd\\N\253\236\261\036\327\252\331\246\226\252\363\250\325MhT"
+	.ascii	"\253'\031\316\254\241\343\254'Wk\231\346\226Y\272\r\326>\306"
+	.ascii	"\330\242\003\212\256\227K\023sA\253$\206(JpP\323ls\325\354\031"
+	.ascii	"5\213f\345vZ\313\f\324\276\342\226G\227\2454T\356\337\2705\263"
+	.ascii	"\317\234\2616\250%F\324\363\016\225\231\013\224.\3004\324u[2"
+	.ascii	"\333<`\337v\307-\037\2367N\336\260a\364|T_\267\007\244\253sg"
+	.ascii	"\314WZ\032F\377m[\343A)\243\352bt\327x\305,\333wm\303\374\201"
+	.ascii	"\b\036Z8\271[nQ%|\332j\240\315q)+[\203\343\205\345\006\030.+"
+	.ascii	"M\266\302W\026D7\262\310X/\243L\354\302\034i2\306\007\215\022"
+	.ascii	"\214\315J\375:Y\336q&\262M\336\301dAZ\353\361\003\027\263\036"
+	.ascii	"&xhTjP\030\035\343!\327\304l\241R\277WH\330*\213\f\0169\270="
+	.string	"\341+&i:p\325\325\030>\342\305Y\314\265\317\250^'\303\350\3428\311O\304^\354d\341\366\031%\301\02360\026\3430\246\302]\374\305U\266\311^\214u.\302F\222\354\305J\270\311>\207Lp\325\026'$$\344#\007e\312\216\036\212\344o\006,)7\310\202\213\353^\377\263\024\236\262M\346z\320\332\335\305\305Q\330\271\317\250\265\241t\252\304\215\311\242\353^\205B\b\361\234\001\303\306#u6{\250\254B\3200\312[\274\250\035]bXZ\267\311Zj\232&dl\336t\262\024\241\302i\365\350\032\365\350\033\0245L\234\024\332\232zTM=j\246\362\022f\262M\022\274\303\027\215\223\034\007\271\366\312F\334x5\255\250_\022\351\256\256nI\244G\303\324\336\002\245G\271\324\243Z\352\317V\\\205\343\344\"\207\306UpjgMKXjo\177R\021\353\002\245%\366'\345 ,\204\207\3749>O\306n"
+	.ascii	"[\242\236"
+	.string	"o`Q$\r\214Q\224\251\3166\3749\334\245\312\312\311J=\003\341\251?\247\207\r\211\227\026\243G\207\250g&X\235\034\r\214\362\017\225\t\255\201\304\007\251\260\037\374\343g\032\270\006\366\201\302\013un\346\030\345\036,u\366\301<\232}\240`v#\331\207O\233n\244\317\356\210\335\021\350\023\252\252\257\024=\232C=\333\002\245<\373\223n\027\3219J\007\255,.\212\033\225\241\030\212s\250\335$\242\266]\231\201c\206s\216MBF\252\f\243,\303\303\332\3208\033[8\034*5d\304\304\250\3370\313\313\377\201\b\266\311\313]\333\265q\250\320\262\232\370NLe\032\247\30176\252wd\334v\260\246\234\320\340t\276\341\243c-\307\022n\032r\fGD\237\260\202\017F\237P\311\005N\213\"0\250\030\364\001\217|#\bI8\352\031u\216\224\2000R\370\221\2414\034\372~d\f\205\026\374\274\370\031\2132Z"
+	.string	"\031\237t\002i8\2044\3741\n\302\310\300\370+\352\004]\260\361W\374\021q\212EH\303\035cQ\020i\210\023D\032\356\222\214H\301\237Rj,JA\244\376^"
+	.string	"\026\321b\361G<:\362\361d\f\205F(\3218\334\035\375xG\277\"\f\324\350W\344\235X\2044<\301C\364%\031\2412\210\306\"\020\3517\302"
+	.ascii	"GD\337Q\320g,\nP\201\021\030\004\002\020\200\003'\214D\337\360"
+	.ascii	"\204\017hB\213\002n\004$\376\202?$\365(R4\220BE\f\336U\254p`"
+	.ascii	"\205\003\351U\254 \"Z\221\202H}\n\242\335\215\214/\266X\024\003"
+	.ascii	"H4\372@ \026\r]\374\004\205@\243\317(\034\201\307X\244\302\030"
+	.ascii	"\004\302\340)\t\205\025\024\341\270\340#\356\\\374\216\212x\236"
+	.ascii	"t\242\230d\364\275\030\n\n_\274\020\032\021\340\202O\306\256"
+	.ascii	"h\350\"\007\305)\376\224\220\202\276\324\370\244\005.\034\376"
+	.ascii	"\210CF\241\2208\244\343\202O\306\207b"
+	.string	"\021\005=%%!Q\307X\364"
+	.ascii	"\004\306 \220w\"\"\013D\224\300B\003\325\350\2041\370{\021D\002"
+	.ascii	"*\371\216\210>a\nCE\242\260\030\374\025\207\202@\337\213!#bq"
+	.ascii	"\350\204\002\305\337\217\210\364\273 \311\310\b\034\356\234\351"
+	.ascii	"\230\216\327\360\250l\350\200\242\353\341\274&\345R/\306j\320"
+	.ascii	"-\246\226Uw\367v\306\310U\351Z\323\314\360\321a\006\306\212\\"
+	.ascii	"r\267\226E\256\240!\243\023\346-\n\307\031/<<t\2405\315p\233"
+	.ascii	"\024-pt\374\306o\\f\0034\035Ptp\3472\273\2663W\243\351G*D\345"
+	.ascii	"\263\344\032\016-7\276R\205\225\343\013\243jj\334\026\2446\226"
+	.ascii	"\332Y\034N\034\0202A\330\316mb\233\343M\212i\355VrG\216\2142"
+	.ascii	"\030\016\263\315\020,\346\314\220\245\247\037*\f\335\033\"\335"
+	.ascii	"\272\272\r\221>\275\301\345\\\330\313\366\326%\2651Vh\233\\\031"
+	.ascii	",~\236\275\240Oo\33001\312]8\rm\332\222\342\201\323\320~\350"
+	.ascii	"\234\302\314\370\254\207G\220 5\030}\212T\315\036\202G\214\031"
+	.ascii	")n8p\352\265\004\201r\250\241(\207\024DfDFDD\222$I\0071\005\204"
+	.ascii	"(\007-\244\036\022\300\025=\017\"\207hj$I\241\376t\024\220\327"
+	.ascii	"l\247j\354$\b\346D\257\260\2479\b\367\\-x\245\273@R\231:\373"
+	.ascii	"\216\315\257\311'$\352\346Y\276c\346T\325j$\211\034\205e\325"
+	.ascii	"\322\330\205\364w\005N.\375\373&\321\027\317\310z\212\274\325"
+	.ascii	"\2003\b\210\331Z\"\017\353O\315\274\271(\006\343\031\317\360"
+	.ascii	"\250\337\315\226\334C\252t"
+	.string	",\337|+\370\030\274\b\301\364\255\371\254E\221\261<3\350@q\244\363\\1\367\270\"\200\246}\026\026\270\217z\247.\033\223\272t\226\205c\"\224\365\372zFGS4\354\006.m+\257\2631\267\357U\234\235\0309\021\236\205\346;\032p\227u\200\366\204\034\235+\316\356\025:\271\275o\315\331\337N=\236n\030\250\376\375M\016\220\020\220\f 'k\256f\312\232\007~\004\310\337\306\324\210\320M\362t\332&F\242\031\311\003Y\345\267{\020\331\244,\367@z\327\245\242m\326G\223O\371\006n\226\0235s\205.\007\347\272\222N\3722\331^\022d\236\262\0063\365\241\321\210\301\334\213\206\345\217{\215\336\344\273\352\271\241h\311\203*D\252\336q\361\2155\330O\333\306x;+3\222.\022<6'\fL\375k,\374\317\236i\261\274\013R\205\212u\362F\201Z\334K\035t&\2672\234o\035u\021\335\005\233L"
+	.string	"\003\261\372p\351\223\023Bp0\002\345\273R\214\234\250M\214\230\316\3751B\013\332\240~\274\3620\221{_@g\254\256\310\242\207\\y\225(,\006?E\204\027\250\244sY\304\375:\262\224\231\301\2571\227\"\256h\224ev\230x\260 \230'*|\227"
+	.string	"\r\2075U\017\243\203\214\035e\220\361z\312j\314\264X\007\307\216\332\n\242\236t\307/\324\207\225\263\r\020\334\200\227x\005\004\374\375_\325z\212ir\357\323\342%s(\226\b)\337\315`\223\b'\363\244\350e\034\242\004\242\272\244\374\366u\007\013B1\354E"
+	.string	"]\364\340;\216\003\2547\237J\020\220n\245\343t\257\202;:\236a\330\204\331\f\321\006\350E'Xq\267\352\273\255 \254\302\020\237\027&\222@\366)\253\2077\336\325~\221\035'\225\372\335W\351\260\363A\334"
+	.ascii	"\334>d\234>\301|\252=;m,\257\013^\311%0\n\361\373\355\274\032"
+	.ascii	"\252\3334\021\003\244\373[W\324\353\032.\271 \277\271\263i\b"
+	.ascii	"\013\331\375\360Q(\007\3726\177\366!\206\202\307\230B\022v\206"
+	.ascii	"\303>t3\314\3146\353\276:L<\354\316\f\232\037\f\003%N\272\377"
+	.ascii	"\267\247\307\361>\323\360\004\356\221\025\365\343\372\267\347"
+	.ascii	"zu\225\216\364\217:X/s}\326$wvo/\371\240\230\035#]x\262\337\306"
+	.ascii	"FqD?\215\361\023\2558\313s\231\231^\221\305\373\252"
+	.text
+	.section	.gnu.lto_.symtab.16b6c9114edbcbda,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"applyMatrixRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.16b6c9114edbcbda,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,754 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\020"
+	.text
+	.section	.gnu.lto_.icf.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\265\005"
+	.string	"4\b!\001"
+	.string	"\023"
+	.string	"\343\205\215\331\017\020\002"
+	.string	"\002\001\001\236\230\322\355\n.\002\002\002\003\002\004\002\005\002\006\002\007\002"
+	.string	"\002"
+	.string	"\b\002\b\t\002\t\n\240\342\234\212\n\003\004\005\352\263\360\321\b\006\007\b\t\n\274\205\242\255\006"
+	.string	"\013\267\335\335\337\n"
+	.string	"\f\222\252\354\340\007"
+	.string	"\r\240\224\254\300\003\006\004\002\005\016\337\270\353\276\f\n\017\366\344\227\262\016\002\020\270\374\371\360\004\002\002\013\002\007\021\377\343\236\316\006\022\240\342\234\212\n"
+	.string	"\025"
+	.string	">\201q\034\341z\002\344\030\207\211)\257y\007\032{\021Q\363\f\264\233\222:B\200\232\004;\003\310\365\375\331\016"
+	.ascii	"`E\306\227\253\355X*\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 S%\002"
+	.string	"\004\003G"
+	.string	"\t"
+	.string	"\001\001"
+	.string	"\001\001\003"
+	.string	"\001\n"
+	.string	"\001\013\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\020"
+	.string	"\007\003\f"
+	.string	"\003\r"
+	.string	"\003\016\017"
+	.string	"\003\020\001\003\001\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"*1\230\n\322\251h\227\270,G^\354\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\215\006"
+	.string	"\262\211!+p'J\007n2\324\212\345\3108\335\216D@(+n(a!\362*\337B\346\377\356\377\377\017\363\334\n\373\366\177\344G\215\354\235\002C\t\242C @\341@\311\307)\023\b\020\006\024'$\344\031~\376\227\234\262\240\355brW[h\347%\364\034\326V\314\r\2634\332V\350V\024<\262\236qR&O%@\266i\370\310wTb\331\246m\200\037Y\356o\220<\237s\376e\333\0362q\034\031\271\320\366y\304x\005\036"
+	.ascii	"9K\303\266\001b{\201b\353@\326\025\300W\035m\210\002\212\313"
+	.ascii	"\035\030\313\230V\002\334G\203\363\006DW\260\227\t$@\212\243"
+	.ascii	"\344\025\002jQ\22795\216f\360Zd\006\216[\265M\267~\252\325,\353"
+	.ascii	"\371\\K\003C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"e\005"
+	.string	"\342\310\034$\220+\303\001\377\277\272\003\f\315\314\214E\373\034\006}\273\345\202\306\244\347\177\225\307\266\261\211i\330\332go)S7\334f\321uh\246\204\264*\"\223\344\243\367\336\243c\205\312\222\206\217\376\302COHt\004;x\301\363\321RV1&\023ei\321CvX\256\251\\0K\213Al\215\177Z\237\016\326\221j$\325\312]Y5YE\016\240\261n\221\007\346#\026"
+	.ascii	"\240\210\2342\250\267\301\314\302P\005L\265 \2009\027r\220a\371"
+	.ascii	"\002\333Q0;N(V+fA\321|\362:\320\230\300\307@\0234\305\271\223"
+	.ascii	"Z\316\340\0130\004"
+	.text
+	.section	.gnu.lto_.pureconst.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\001\232\004\n\200\004\013\200\004\f\200\004\r\204\004"
+	.ascii	"\016\232\004\017\204\004\020\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \303\255\003"
+	.string	"\222\305\022\037\240E\303\001`UU\177\016\016\207\377=\353\273\356U\314un]\343ld\325qK\333\244L\001G\322\004\021?\345\216\362\311\027a\273\355\361\263\225\267NW\356:\233r\246\302l@\016"
+	.string	"\001UY\277\3373\370|)\003\234]\374W\020"
+	.ascii	"`\350\2321\023.\240\350\230%\020\330\212\270\232\3028fO=KY\""
+	.ascii	"8\177\200Zj\0051\212\345/\203\f\240\b"
+	.text
+	.section	.gnu.lto_.lto.135c4a10cf0b26eb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.48.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \242\275\004"
+	.string	"\204\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\307\341\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\006us\250\324\006uq"
+	.string	"\005\001\006'\001\026\005\001\006\035\001'\001\250\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.49.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`\203\001\375\f"
+	.string	"\366\326TE"
+	.string	"oj:p\356\013\3360Q\302\336\324\326\266\027\364\375N`\253\004\007\013p\200\030\375\215\353\260\377\263\204\030P<\247\225j\030\263\2256-\375\005s\004\372\216\025\"\234\201\bA#A\243($3T6\264wJ\001<"
+	.string	"@"
+	.string	"D"
+	.string	"\347\330E\265(\261k\216X\204r\316\3461\3359\312;\272s\036\355\332\315\324\376u\222"
+	.string	";w\327\253\033>\236\216\376?\274R\232\310\323\f\001\273kZ\232,\334\365\266Al\003\260\351G\224\335%\361]\r\034`R\034\316\371\244\356\234\201\t3\f,[\211\336l\223\244U\203\375\311\356\256+\312~\353\257\224\372\227"
+	.string	"{\302\360P\261[\341\026ce\234\211\016\026\333\247\366Y\3670\276E\n\252\332\352{\314E;;'\241\242\255^\267=\037Q!g\247\355\237\213\030a\nP\220i\320\356f\321\205\374\325\006\201\364\245-\031\"T\322~\210\007\033\245\255\3400\361\\\346\265\344\344\242\274\360Qg38\210Q\236O\202\0208\340\342O#\212\034\021\b\374<1\004\305PG\364B\037\016\310\373B\321\323d\f\212:\241\267"
+	.ascii	"\004C\317b\356'[Q&\020\223\225*\004?\305\355\003_\2611\2758m"
+	.ascii	"\233\316Fp\024\033\262vr~\"  \320\202\2219\333\263d\021\260\247"
+	.ascii	"#\326B\026\350-\315.b\034\035\340\301\037\267\361\217\266\341"
+	.ascii	"\037\250\203II\315\030\rI\305\305\333e\372\206:\234#\020\323"
+	.ascii	"<\254\261\325\267\303\021\346$4\275)\033l3O\201\275\274h!\031"
+	.text
+	.section	.gnu.lto_compassPreInit.52.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \302%\005"
+	.string	"\202\311\"*\200k:\300\2064^\251\324\303\023\r\352\200\221\275Z"
+	.string	"\374\337^\366\357\351m]Dk\2060\025\370V\317 LH\243\270wJ\001\246\244Z'\314\232\224\254t\326\253\252\362RL\226\244h\225\322\300\023\253\250\\\314Ie\344\355c\347\002#6lO\2031b\037\260\261\263!\364i\b\235\335\307\307\263\231"
+	.string	"\206b\373\2213\233so\262\267l\034\227owe\224<;\314\374W.\3308\355\020B\354\256\341\306A\356x\333\006\333\007\333\211\b"
+	.ascii	"2\003\3169\003\027\216k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_compassDetect.53.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\215\007"
+	.string	"\242N56Po\322\001 n%\210\"\317FZ\3004\2403\304;\330\216\304\314k\020QC\220\013g\323k\233\351\003\233\020T\235A"
+	.string	"\f\235eBg4\326\271\267\214v\333;\245 L^\230\204g\242\n\240\220\021\317V\207\322\352sM+\322lRL\322\210y\252+Z\031\215\235\002\317\217\314\"h\316,r\352~\243\f.\036\206]C\356u\330\327\354\356\372\221lw\016\323)\006\"eW4#\263&\270\022b\373\2665\233c\373\325\212\227\005\347\354\223\274\244\275\304\342\002\273\244\222\312nUp\302\346\320\365\004\324\341\346\003\324\241m34h\336^?D\007a\31189\355\326\370<\276\335m\376M~0\002\323\342\2022\n\335\001<\354\256\235\306h\343~\267\215`\333\301\266H\n"
+	.ascii	"2\003\202\341\243\302f\025P\270\f\b\n\301e`$\001*\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_compassInit.54.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \301]\005"
+	.string	"rI$.pU\323\001"
+	.string	"\355\365\352\242|\352\337\302e8FVo\240\240\232\211\220\335=tUoE\243\324\337\376}\3355\263\370\365Q\264a\343\3362\005\247\2449'\314\212\024O\031\347UM\276\034\223\305\224\234,\035\036\261J2$F\311Q\225,%<\250\375U{\020\363\257\240\341\345\177\333\251t\001\rP\3676 \320\241\301\207\363?\373\243+\026\331\351V\315\266\033\200\211\247\353\256\f3K\367\321\257\201\213\354+0\272\373\217\302Y\366p\377#\376'\376?\002\t"
+	.ascii	"2\003\202a\243\302b\025\216kxV\304 B\344p\347n[\234"
+	.text
+	.section	.gnu.lto_compassIsHealthy.55.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`e\001\215\f"
+	.string	"\366\226P? o\224\016\303\002F\307\026\t\346b\316\244> ,\222\331:\202\350\0315!H\214P\242\306(\332';f\006#\2551\023L\025\030"
+	.string	"\t@].N\373\247\306O\230 \346T\207\354\275\245L)?"
+	.string	";"
+	.string	"A"
+	.string	"\327:6naBF\b\213]-j\205\213\016\237\323\024\371\024\346\255\020\241\242\224a\207\022\376 \244\223d\030\251\001\262\007\216\262\273\317\360\324\310H\231\024fw\235\245,\302M\335\266\307v\305\276G\376\205?;"
+	.ascii	"\345K\177>\b\376]'(FFy\2625,\225\303\276[5\331NCM\273Lk\2463"
+	.ascii	"\323\247\006h \261\300\304\356\306\311\305\216x#\030l\207l\211"
+	.ascii	"\017 \bY\024OM\372\016\007\341\355\"\037>\007\361p\207\200\177"
+	.ascii	"\252\027\321\273\324\244`\340!\336\"\310\307\362\221\032\237"
+	.ascii	"\273\213\351V\340\252%>R`d\013\3135o\223\023\273\253\300\256"
+	.ascii	"\316\341#\240cw\023l\270\307\025\326\\\256+\343\341T\232xY\325"
+	.ascii	"\325\331\\\261\303 \303\211\032\353\212\027\002\256<\033+6\250"
+	.ascii	"*+J\264\275[59_\345\351,w\252a\033*e\244$;\205\372\214\027\243"
+	.ascii	"<\001\200\312\001U\333\305\002! \320\002\031\n\356\006\013\031"
+	.ascii	"z\306\031\336\313\"\007\034\307\204\361\b\274\244\006+\353\336"
+	.ascii	"\314\225\336\353-I]*\243q\273\344\224k\324\250\001v\334\263\201"
+	.ascii	".\030m\006\341\371\341\313-J\005E\036\274\217y\234\244b\240\033"
+	.ascii	"\005\247\267k\225\001"
+	.text
+	.section	.gnu.lto_compassStartCalibration.56.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`\001\002U\021"
+	.string	"\026`pG\340\262(\035\220\305d\202\3408\332\250|\340\311\017\202\t\2412\032\013f\220\223\277\006\243\370\230,0\351\331\376\327M\210L~\210\332\272\323\257\217%\021j\214\261\031\202\2218\344%l\344\251\213e\r\376\232h\262\267\334)\005X"
+	.string	"X"
+	.string	"a"
+	.ascii	"\2376\341>\017\274\300\366)?`\373|\310+\033\307C\331\036G\266"
+	.ascii	"\301\246\307\356v*\302z\031\3362\256>\245\306\225\017\2222s\004"
+	.ascii	"4f\340\213\365)\005\354n\310K\203D\2110/W\224$`\327\207O\300"
+	.ascii	"\343\003\276`"
+	.string	"\217 )\273\353\b\276<\334\333m\253l\243\330Q%\352\327<E\312\227\261\3472}\027\032\030\324\2125o\321\256p!\036\274\206|\240\365\270\224e\207\256\2501\373\337\335\265\306\330\242\323\334R\2435F\307G?\200H\220\215\b\263]\016\265\037\3333sF\234\346\366M\370\241C?q\024\253\323\230\306\261:p7829v\267$\243\221\030%\0030\236c\262\n\312`PTUI{\2511\363\254\2239\370\213\007$?-\356\002\202%\254\304\203+\333g\324\320\215\235\0229\255X\263?\332l[8\213\221\310\317\3562\260I_Q\342vw\201\212\337\230\b\310v\3672\237\236p\342\216\332>\037\236\304F\247\307\216V\254\251\356.K5\026\337\t\003I\272t\362}\244\226\224W\352>\225\367\261\230\276\216\345DJu%\325\327\235\214\330k1\251:\n\236\247\352Ba\353_\215\361g\316\351\350\350i\251kj\314"
+	.ascii	"\200T\244\n\024K.\025F\301\245\236G\rP\206\350\343rwW\232\\\252"
+	.ascii	"H\017\202\307\347%\204k\306\216\216\251\001\3520\236\232\252"
+	.ascii	"\214, p\202\251\252\353#\241\227\022\203A@3\265\213fK`\005K\355"
+	.ascii	"\017\031b\321?x\203\013\276\004x\260\357pT\306\362\322\035\256"
+	.ascii	"\261\210\261\035\026\003\266\016\265g\200a!z\t\356M\3024g\006"
+	.ascii	"\334\333\032\331x\341\375\314%i\274\034\003W\321\366\224\235"
+	.ascii	"`\264r\b\2612\223q\303\033\254\354m\r\370\242\334\271\304\023"
+	.text
+	.section	.gnu.lto_compassIsCalibrationComplete.57.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"\022\r/3pk\322\001\020.B\200\335\002\372\313\360qO\206\303v@\177\353\204Pm\033\032:f\321U\266x\266t\257\252\023\200\236\313\242\201\021\001\201#!D\312\224\002\266*\b!\024\211\263\032|\016N\"\260M\026 \222f=\330\252\001;J\3445\006\347^\243\342^=\252\004\031\325\330\257LW\325o2\315/\216Q\361+\334`\311c\227|\313t\351\032\360\220\311\220\0351\251\021\366\243U\217\355\264f\372\221"
+	.string	"\210C\241c\227\023\002\355\206\224Y\330\276\330\224\017\020.\276\036'8\247\370l2>vcS\211_\317\313\377\347Q\246\341\201u0O\200\204\335ub\035\207[o\273\300\266\201m\210\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_compassUpdate.58.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`\372\001M\022"
+	.string	"\366\342{H\320\224M:DQ\253\236u\205\324\025\267 0\231\337\025\353\362n\3125I4\f\336\207\256\312\001rm.5[\274\267ZV,@\263eom7<V \305 \026\276A\210z\205\340\254\243\245f+\302\3076\262\267\224)\005h"
+	.string	"b"
+	.string	"i"
+	.string	"\nV\227\266\375\241\023\325x\026\303 \260\313\221\204\203\224\2333l\255\\\245\273\214'\320]\356\213\331l\026g\357d\\\235\371"
+	.string	"@\233w+\235\313\tMJn\240\316cL\300\323\224\002\005\274\211*DZ$a\2016\335\310\340&\267\303\002k1E\n\247\310\215\2569\240MU\3452\347\264\336\300\023\267\352\266_\266#\330\372\022_\031\021\362\211\202\272Y\033;\254\351\002\331\377\022\024@\\x\177\354\027\375,\253U\307\335\235T\313UoT\353\252?\240\001\024\317\016\f\245=\022N\023SM\246\223d\242q\334\355\207\376\021\316?Vl\341\004!\b\t\211rsN\226K?X]\336\256\261Ql\253\276h\204O\346d\241\2644g\270\300\0017\247\004Q\341Ts<\216\357\352\f\025}x\0370L\357\201!\003\214\376\006\323]>\374\222\267\342\241\273\373\036\037k\370\216\r+\035\272\312\204GF\021M\247\216\313\365\220X\021\335\227C\r$6\225\262"
+	.string	"\365]\335\303'\275R\236\346\244\375fw\370\r\330\201\2409\247\003\244\333\360\340\307\270t\314\223\276\327}\370\364\267\357\215\002\037,DL\374.\274b0\01342/\231\f\204+\200]-\337\0273\023\363\\\255O\346}2\257\257%\003\213\211\265\\\262\257\325\202\300\336\314K\326\242\361<Y\013%\244}\177\354(\345\311\n\241!Q\365\364Y\247\262j\355B\333ZP\267@\376\321WQC%\226\345\335\346\330\006\224\265\366\213\004\375Mn\\\2339\347\224\005\324\246PA\037# `\002\221b\266\007\215\003\206\031>\266\360\210\201\263J\3455\332\256\267\"\345"
+	.ascii	"{\231\215\346aN\bi=Z\203\300\375\003Z7q\233\f\272\272\027\270"
+	.ascii	"\336\017\322'\n;B\nv\305`T`/oXAXMtam\027\360\211<\362Is\265'"
+	.ascii	"\024S\301\355:\003"
+	.text
+	.section	.gnu.lto_compassUpdate.part.0.71.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`\026\re:"
+	.string	"\232_\364\024BP\346Q\007\253P&\f\225y\325\356\361\244g\350\367\177\245\004\364?\256R8P\354bHA\001\030\b\374H\202\n"
+	.ascii	"\246@\242\211\210\350i\333D\304\277\247\366@\350\306\006\037"
+	.ascii	"\244a$m\357\275w\222)\005:\001&\001B\001\236\346\215F\027\303"
+	.ascii	"\306\264\277u\357"
+	.string	"L\303\271^K7\372&g.\347\234A\206\273\265Q\232s\356\251\355ch\264G\273W\206\206\267qa\"43\227lN\306\206\267q\251\331\f\232\2313\360\270\255Q\371\332\023\240\256\013Y\033\335=_\261C=L\227\n\315e\313~\354a\272z\227\363\0223kr\206.\360\265\025\270\276v\373\027\032K\367\342k6\372U\241\3172\366\315M\254MQ\316\320\243\257E\037\262\276\252.d}\375\263\037\366\273\n\365NR_ob\032.\t\225\222\202\300\037\222\257\307\333\271-\273\252\217\211o\273\2277=q\246(pP\360\320\tS\315\227\340\234\203\032\031\241%L5\027Jq%5\330\300\bNj/8a\242y\360\351\300'\033$\370\327t\244&\233#\330\207\346\275\264*\313\"\230\367\204\b\336E-a\016qw\317r\210Z\214zT\225\245\031n\361X\231\020g\313\204\370\252&h\332\371\361+S\252C=L"
+	.ascii	"y\364\006V\325`\316\371W\026\2466\3109{\032\307de_\370yT|8\026"
+	.ascii	":\261\275\220sn\377\332\342\355\344\335n\247\273Wt\367\316\004"
+	.ascii	"\376d\013\334\337\021\261\311\205aF\375\256\346\234\363\277\263"
+	.ascii	"\273\025\270\277\372n\344NT\331\004\373<\255f(\355\022\036W\365"
+	.ascii	"{\346\234!\334q<&P\244H\301\372\352c\205\360\377?\234r\356\013"
+	.ascii	"Okx\035+7\347,\241}\216\323\271j\207\342kcea\037\313b}\305\357"
+	.ascii	"i\034\001\034\240Em\276\360\264\337?\347\354\205\337\331Ot\317"
+	.ascii	"\337\244\333\207;\001\202\026\367\001\036n#\017\267\001\036\356"
+	.ascii	"\251\026\267\024\017w\201\0267\201\250b\213{\200\213[@\213;@"
+	.ascii	"\213\033\312\305\375\324\342\006\340\342v\3625\336D\037\356&"
+	.ascii	"\207\2723\371p\017]\334K.na\213[\311\305\235\344\342\016\272"
+	.ascii	"\270\201-\356\237\213\033\311\305\355sq\367Z\334<\027\367\256"
+	.ascii	"\207\333\345\341nw\270\331\035\356Uuq\177\213\033;\032o\267\260"
+	.ascii	"\300\b\260\231s\217\251\243\234dm#\305\313\270\243q_\343\376"
+	.ascii	"\306\343t\362\311|`\007\272\246(\207A\251dt\222\b}2\177p\352"
+	.ascii	"\224\315v7po\212a\301\034\246F6E\r\2335oo\215\346\034\215\273"
+	.ascii	"u\305o\362;SN\275\213mz$\333\235\3413}\323\317\210S\243\234\002"
+	.ascii	"\306\353b\2078\tV\322\345|\317\316X_\207\377~\034\355\226\276"
+	.ascii	"y\304\210\360\223~I\351\205D\206\230)a\0378\b\220\037\330\033"
+	.ascii	"\216\3655\351WDs\202_\266\354\001|\244\017\376\036\270C\007&"
+	.ascii	"\373-\3009p\210!\375\212hH\033\337\343\0338\f\203\365~\367\276"
+	.ascii	"w\345\024\336\367\036?R\316a/+\343\363E\303\371M\223\252\363"
+	.ascii	"\351\253\366JIb\037\343b}\345\275\021\315Q\243\252\337\223\321"
+	.ascii	"\356W,t\r\3159\273\357l\177\251\260\356\253`\223sD\236\350\245"
+	.ascii	"\322\016\245_+/\026\354c/\226\177 t\\\314Z)\334\276\273\371!"
+	.ascii	"CUS\205^.\257\227\342\215\367j\366[|\307\220X\335\027\236\266"
+	.ascii	"O]\213]\237\375\306bf`\375\346\313\226'\033\205\335\315\005\275"
+	.ascii	"a|R\f\036H\303\003@\356\346r\033\334\234\277|\354O\225\224T\332"
+	.ascii	"\034:`\037k_\034.yn\274W\277S\215\211\312Y\337\331;\377\300\256"
+	.ascii	"\257\202\355O\267\007\357\363\001B\373\036\347\023B\304\210\021"
+	.ascii	"\254\257\353{\324\013\320\005Z\004\306U"
+	.string	"9\"\225\357\344\260\372\001\335\"\351b\306\225\272\205\314:\301\342J\253M\226\310\322rA\"\306\213,$R\006\026Rc1H&\257`hma\035\223\310\255\344\213\254\344\361\205\213+\255#\0262yd\020\240\267`d!\2171\266\266\220\307\236{\376&.!7`\224\330\035I\374e\023<Yw'\370\276\360\365`M\016p\367{\344E\342Qw\036t\220\344\001{/\246%\004\277\312\t\251<*j\030\365\b\336\327\244q\312\346\201/c%@\332\366\246A=1\031\343\037x\325\217X\035\323\r\274\361\237\374(\273L}\2017\360\3046eS\352\247\306X9\0341o\232\277\201J\275\303AkC\340\013\274\277k\030\214\025\205/o\032\2045\002\357p~\fRf\351\235K\274\213G}\312I\333\226CB\245wvO.X\374U\256G\345D\342\343,I\357$~1N\331\004\013\016\330\242%\213\222\001S\240"
+	.string	"<\001^\300\025+U\224p\005x\240s\372\203\372)VF\251\2247mJ\032\305\351\241\336\327\342\006)\361 \275\263\237\336\351\275\n\233\035"
+	.string	"\377\364*\235r\016\212U\205\2647-\302\023\243\341'L\270\032\300W"
+	.string	"\201\317Z\315"
+	.string	"'UPN\247w6n\244\253\343\322yr\316\276\201\r\250q<\006\025CB#\"A\222$Icq\005\304 F\245\253\007\022\300D9\207\242\3169U\232\222\0246\366\f\005\227\335<\3753\326\007\230\033\340#|\342\345\024\207\363\"%\243\315\317\233\226`\\\3161\0053\373dC|\036\344i3&\257\304N\r'SI\220\245;4\330\r\344\357\007f\032\255\020_\224\003\225/\317M\264\002y\353\031\301\201]c\022\004\254\262R\213\235\\I\201\023h\301\017Mu|.\241\331n<\"\300\tD\201\320|()O,\217\263\247\217\270\276\352\375VXm\006}\030\300'\354A\307N\273@\223j}\025\233\342\204\341\r\337\231\260b\207\256T37+E\225\f\203\204\244Z\312\244.j\236"
+	.string	"\027\351\026k Y\bQr"
+	.ascii	"\316Y\223'\034\252\320J\007&\352\374gL\236\033\273P\214\226\035"
+	.ascii	"\361\323b\344\2134[\005T\322a0{\302\327r\034\351\2553\263eGy"
+	.ascii	"r6BK\310\360\2378-\244\r:T%\214\"\017?\332\221\373\225;\330!"
+	.ascii	"\274\016~y^\372\304Q\001\356Pi;\034|\241*\274We^\343Ql\344\300"
+	.ascii	"pI\366\027\216_\315/k\257O~\316\236\330U.\024\336\330\027\321"
+	.ascii	"\231\336\315\312\222\027\273+\207\251\206`\027\355\253\304E\301"
+	.ascii	";\367\003\204-\346\235\214\302\026\030\221\255&\217F\226\230"
+	.ascii	"\251\324\210\213\214\247\341\351\211HJ_{I\275\n,\001v:W%\216"
+	.ascii	"t8\261\257\216PMk\212\255\230\n\0329\247Y6\001\344\017\360x\300"
+	.ascii	"\270\214\304\023S\256\360r\226\236\322\027)\376\253\272\376\371"
+	.ascii	"\214\375-\350\300\303\353\302\025\232\376/\303\200[\247\343\252"
+	.ascii	"n \311\346\256pN<\255r?/\207\327;\310(\210\316/\351\006\026\276"
+	.ascii	"f\b\2354\023nka/PT\221\212\374B\370\227\200Y\023+\205\203\253"
+	.ascii	"\005vU\327:BI\310L\243`\002\\l\376\032\307\271\202\226\251,B"
+	.ascii	"\303\252\b\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`d\001e\t"
+	.string	"\202N780\221\322\001\200\22500\f\0134\352\353o\371\322\210\301!\205\211&M\032\017\244\212\326\310\323\241\240\220\350\305\302\332\377Z\261\031\353=\006\026\022\224\037Q\200\364m\023IR\n\276\311\357\2529\031\331\264\r\370-\377r'l\331q\266\354~\204\200\334\240\334{\301f\n\236"
+	.string	"\341\035\343\262\242b\360\354\204\347v\367\340\271A\340L\351E\f\245\030\261\223Z\230\324\257\222\332ER\267\276\273v'6\322\212C|\321\016Y\201|t\2508V\031*\217\317\017E\276Q<M\211L\212H)\264\220N\334S\t\220F|4\345Q\324>\350)s"
+	.ascii	"5|bn\347\211f1\210b\356\202i\300\213f\t\204b\332\017\227S\212"
+	.ascii	"\266\271\005\301\220\345\nj\030\330j\261\325\206!\271\266\273"
+	.ascii	"\313))\263\235i\004%  \003\231\322v\002\307\264\002YIS\306\020"
+	.ascii	"\036\334a\274\036\217\200g$C`F\202d y\006\315\344R$)\030\227"
+	.ascii	"\037d\003\356b\024\202\201W0|c\337X\177t\270>Ib<I\323L\263\003"
+	.ascii	"\222`\333\240\313\t\322^q\f"
+	.text
+	.section	.gnu.lto_.refs.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375 \263\335\003"
+	.string	"\362\212\034 \200EI\00730\00330\003s\247\"8\030:\212\214\261q\370G\250\355=&\204\354\266\345\226)_\206\272*t\253\332\254\256=\255\030\233\347\205\237\304\017q;^\207\204\344\244\337>\273\322\t\216\017\244\027@\037p8@\342\221\364\020\304\037\350\035\375\306yFys\277\350+\312\023\367\210\376\241\234\271_\372J\362\203\326\311\352\324\372\330\267\2345\233\277 \001"
+	.ascii	"\204\b\246\024"
+	.text
+	.section	.gnu.lto_.decls.135c4a10cf0b26eb,"e",@progbits
+	.string	"(\265/\375`j1\245\335"
+	.ascii	"\032\\)MW \nQJ\0354T\f\326\322\314\220\223t\2044\314\267J\030"
+	.ascii	"\005{\251\230\241`\0010XK{y\205=\025Di\255{\201\022\373\331\215"
+	.ascii	"\231\300\302p\263\245y\236\347\221\020\203\260\203\210stp@)\324"
+	.ascii	"i\344\306\331\315=\\\202\224\220d{\037\364\033OI\356&e\222)L"
+	.ascii	"\004\301\004\317\004\311-;\264fN\336c!\265\364\031\372Z\237\345"
+	.ascii	"\317\275\267Zdd\344\005\210\366\237\r\355\317_S\377v\364\201"
+	.ascii	"\334\270</E\237\375\247\244\375\247D!\347\nYaD\310T\363\270\320"
+	.ascii	"\357\3619z\274\216\337\021T>7R\001M\271(Zw\006\033\321\224\234"
+	.ascii	"w\270\277\215\277\361M1Q+KC\230h\317F\264g\247\376\346\265\240"
+	.ascii	"^pq\324\353\314T\332\263\f}\245\027\207\306\324/,\312V\362\363"
+	.ascii	"\317\370\250\013\375\251\033\365\f\326\334b{?kp\262\251-\355"
+	.ascii	"s\276:\252\315\325\221\361P\270\313\025\033\027\372P\357\224"
+	.ascii	"\037\352c|\323\225"
+	.string	"B3\226\224i\315\027\021\247&9{f\372\246g\362\264\377)Z\2462\222v\351\265\240\322\\\034u\357(\365d\3573\006`\226\022\0328>'\305\265\255\305}\376\0279\277&)\360E\001\243\275\003-X\242uvvY\352\254\\\311\3424\233\322mpw\351\202x\357\251+\316\275\237\312_\361D\317\342\215\376\350]|\321#\375\362B\277\305\305\363\273\345ry\316\335*W\372\264\200\255\275\351\336O\277]\337\342~\335\267</\327\253\305\315\373\244\033\337\024\316C\007\337\342\306\335*A\344s'\201\320e*\314\336\336\317\r\033~D]tp\027\362#q\221\2666\2533\335w\303\\\350\357\333\305\357\227`\362fo\036v\277/\330\335\273R\035y\313\212z\205\227\246\244\346/t\316\2757\337\005s\275\\\350\375\242\374R\367%\230|n\346\b,3\2466\344l\330p\364\272\301\247\263\343\030\332\310}*\367\336\024"
+	.ascii	"\227\324\276\226|\276e;~\365pt\215\305\227\317\216\221\372:\257"
+	.string	"\005\365\302k\321\376q\332\177M\373\227i\177.\235\323\003KM\030\"a\370\252\264?\223\326\371\245\276)\\*\027Z\301\225s\017\0358F\202\355\256\275\2376\271\251\355\306\217\317\376[\373\255@\275}\267\002\325/\236\376\340ZP\245\030h\312X4\267\332\332\256\333\205\336)\027\r\354\236m\261M\247\334\264+\345Ju\214\020F\312t\357\215a\303\206<\204\213\021.jf\2431\332+\362\331o\230\206r\235\334'w\355Bo\224\253\346\377\334\033\372l\222f\266\344\354F\225\334$\301\337\336M4\347\336{\307o\224\313\344&\311\260b\357\246\024NR\256\foo\357\235\263a\303\206\r6ETSZd\262_\245v\037\355D\355\033\320~\001\255\341ZP}\204\366\005h\277g7\311mn\n\2020\216h\311\370|\217\\$\027\212\341\222\371-\273f\376K>\367\363\336\351 R\372|s-\250\317\201v\3671\277"
+	.string	"\267;\360\240\026\301\336}}\027\203z\303v\374\212\341\250\314\247\347\266Y@\017\033[\237\261\214\366\327\032\\\013\252zq\324\233[\344vU\200\227G\315\r\335\373Y\301\346\331\204d\343\263?\257\005U_\034\325\37514\237\351\376#\240\341\376 p\377))\367+u\277\035n\005Q\033\270\347\030\367\207r\377\026O\356w\211\273\353\305\375\213w\312k\272L\336\351\356\031\334\263\005\325=g\300\314\335\333\334=I\f\367W29\006\236\343\236+\3600\334\275D\214{&\361\356Y\002W\002\356\236\335s\b\277\356\271\003\367\373\3567\306\375\316\270_\031\367\253\335/\215\373\037\227\334/v\277\327\375\002\335]\311q\334\263\005\334_\003\356\237\001\367\277\200\373\233\340\376\025p\177\f\270?\007\036\204\373\217p\177\022\317t\367\033\367l\304\375\223\334\177\351\376+\334?\351\376\333\375C\340\376\254\373\017\335_\350\3762\356\217"
+	.string	"\367\317\300\375\r\340\376\030\270\377\005\356\017"
+	.ascii	"\367\247\300\375-\270?\216\373\337\270\177\320\375g\334\377\347"
+	.ascii	"~\233\270\337<w\227\272;\t\356\367\316\375\006\335\357\027\367"
+	.ascii	"\353\305\375\312\271_.\367\333\305\375\356\271_*\356W\317\375"
+	.ascii	"\036\300\375R\340~\361\334\257\005\367\233\305\375\326\271_:"
+	.ascii	"\367\213\305\375^q\277V\334\357\234\373\025\200\373\305\340\356"
+	.ascii	"\"\334o\005\367{\343~m\334\275\313\335\023\340\356l\356>\323"
+	.ascii	"\327\327\327\347\216\265\334\265\223{\001f\002M@/$\250e\235\332"
+	.ascii	"\245\262\302\243\t\335\224oz\241\214\303\242S\323E\216H\353\212"
+	.ascii	"\3377(\246S\216\267\002\367\205\347V\366\371\255^\b~\221,sb8"
+	.ascii	"\234\204\2732\020-\363\022\262\3513a\270\307\361>\356\222L1\334"
+	.ascii	"\327@\233\356$\301k[\214\024\301f\031\210\226#\270A\251`)\226"
+	.ascii	"\303ox\016W\301q8\005<\345B1\034Ns\334\206\335\2520\334\377x"
+	.ascii	"\347\023\263&\334S\335*[g;p\330\t\226\222\307\336\256\274\264"
+	.ascii	"\2020\371\206L\220\203w\356\342\250Q0\033\024\231 `\304p\310"
+	.ascii	"\210\002Ef\311\334]\225'\216\241`\347\224\250\036\215\233\323"
+	.ascii	"E\f\334$\270\343\307\223\032\237]fk5\314d\246\211\216/\246%\216"
+	.ascii	"\231|\264\246\t\2075\366\031\243a%KH\244K%8\252\341\212\310\316"
+	.ascii	"p\024\247\231\265\355\351\351i\347\202\317b\264P\231\242\343"
+	.ascii	"\206\025\032\327\235\376\302cJ\"\237\311.\024\227a/\\\206\215"
+	.ascii	"`(\231\222\037n4\273\250\213\222\f\035\273/^L\227\2371\222\030"
+	.ascii	")L1\240\204\211](>\342v4\031tj\\q\301a\237\203J\026/8\3141\030"
+	.ascii	"s\217A}\376\002\332)\301\201Yi\374\304^_#\231\202\322\017\355"
+	.ascii	"1Q\332c\2344\346R\233N\\G.4\030nBs\206\025\301M\034\020\331 "
+	.ascii	"\353\205\340\037M,\034\004_\341!\230\b\336\302B\260\326\205\342"
+	.ascii	"\254_\033\222\205\201`+\374\305\324caS\246]Y\177\306\345\314"
+	.ascii	"z&\270\0072C\326Toi\257k\t+ME\2630\023+qE\365\226rj\356lL\257"
+	.ascii	"$\310:\330\031\243|n\261\0309<)\350g\217Ij\327y?\260\017\021"
+	.ascii	"\262H\245!\221!\031\371\302(\340}\305h\333}\326\201y\340\035"
+	.ascii	"\027\212{\270\024<\305\345\304=^\016\343\330UZ=^\rG\341\247\023"
+	.ascii	"\210$\316k\212\231\266tt\321\3317\3008.\0302\325\313\201m\340"
+	.ascii	"\033\027\212q\340*\307N\370\t\343\300\317\250v\021\346c\272\203"
+	.ascii	"\00371\225\316\020\351\247\020EG\247\263\353:\355\027\352u\270"
+	.ascii	"\206\333\345\036R\232\212\314i\327oz*\210\274\331Dq[4.\024Oa"
+	.ascii	")\034\343\310\022\252'z\306\205\342(,\303=t\320\025\205\241."
+	.ascii	"\335\035\007Y\321[\207e\310T\231v\r\246o\316\305Q\337HN\360\t"
+	.ascii	"i\355\371\231\t\303\360\272\032\007\340\202\254\3021.\0243y\316"
+	.ascii	"\317Iu\301\345\354:J\273n\322\356X\351\322}\\\333\021\021S\273"
+	.ascii	">\322H3SV\256h|v\335u\366\321 a\246\230\005Vb\"l\204\227\270"
+	.ascii	"\b\267\300G8\211W\\(v\201\267\177\220\277\362\234\r\300\376\313"
+	.ascii	"E\330\3234\254\354\311\302\226\3160\261'K\252*\232\276\331'\271"
+	.ascii	"t@ S\354\002#?z\245O\033\251\345\202\253(v\361_\276O\tX\267\177"
+	.ascii	"\b\326s}\300\202\031\343D\0245\335\373\355\273\260\213/\362_"
+	.ascii	"\031\210\226;I\365"
+	.ascii	"\301\025Soi\017\273x&\317w\245O7[i\007f\272!\b\347F\305\351B"
+	.ascii	"v\340\026\355\300\271\017c3F\345\245\345\246\301\254i/\337\345"
+	.ascii	"\367.\364\371\222\360\275\332\263\005\221\025\366\266\361\305"
+	.ascii	"\311\367R\236J0fo\252.\316\275\367\363\275\334\347\301P\353\244"
+	.ascii	"zK{\033b\324\210t\224\351\354\267\353\363\336\312\327\315\234"
+	.ascii	"=\271\274\336o\271\320\317{<\277^\277\304s\236{'\371*y?\367Q"
+	.ascii	"\031\037\321\274\267\373\273\340Y\214U\22085\235\035xv\247\245"
+	.ascii	"\246(\355\252J\226\237\312\304x\222\252}e\001j\351\277\362X."
+	.ascii	"\024\203\247\373\036`\310\302\200h\277\030\250\270\257\357b\240"
+	.ascii	":p\207v\240\224\366(\020*\205\013}*\037'\366T\276\355\341\256"
+	.ascii	"\024\n\302mo\232\245\364\331X\313\331\201L\235\263\224cm\237"
+	.ascii	"\337\355\247\\\350\277\275t\327\324\330I5\021\362\331\201,t\n"
+	.ascii	"\2407Q]\355\323\256\362E\271\320g{(9\033\260}\223\177r\245O\317"
+	.ascii	"\275$\001\020\247\336R\316\006\033!uqOrv\225\311\023'2g5\366"
+	.ascii	"\266\223_\253\261!\003\214\334gW\307\264\253O\355j\226v\325\207"
+	.ascii	"\276;\372\237\366J\374\243\217F\243\374h\336;y\257\005\301{-"
+	.ascii	"\3705\361\221\fS\263\2539\264\253M\355*\223v\250\372\202\fJS"
+	.ascii	"w\304\214\361yLU\343c\201DO#\371#@,r7\372\244\332\177Q\264\006"
+	.ascii	"&\332\375\277\236\352\236\027\035\234\327\033\231\331\021\245"
+	.ascii	"/L{\371}a\265\202\255Kk\260EDZ\241\206\307\0214\267-\"\001q\031"
+	.ascii	"\017\313\321l$\330N\002\246A\361\322\264\267\227O:3_.\276\336"
+	.ascii	"\336\3163\236\347;\017\035x\235\026\226\\\362s\326\342y\372\324"
+	.ascii	"\266d\232%O\335cd\256n\210e\361iG\200\006kRR\372\234\353\274"
+	.ascii	"\256\356H\313\347L\347M\236\252\354\345\310X\260[U\034\321\347"
+	.ascii	"<\227\255\\\250\263\345+\036\\\322\202\214m\213\366\021\\gS3"
+	.ascii	"\025\317rK\246nP\321\245\340\036\003,\223\233\341\254\242=(}"
+	.ascii	"{\373$\235\233\275\253\246D\203pH xg\332/\221\233\201x\376\272"
+	.ascii	"\320\f$O\331!\332I\"\032\242"
+	.string	"2\300:\224o]\237\335\236\311*rP\236\332o\227X>\342E\227\221`\231\222e3\254)\030\n+u]\311N\362YVC\333\333\311N2\364\322\315A\311mYJ\216\222\327\362\223\314v\241\331IN\342\031,\207e'y\354\353\256TG\003\272\254Lm\266p\2159\335\344,\346u^vLr\223\013\315j\236\325\260\221\274d\346L\013\236\026\206\r5w)\314\315P\227d%I\2369\360>\347(\360\311\211mE\023\355Bs\232\346\242\245\204\317\353f\234\360\250\222\241=\210\224\3134\225\251T\260\205\366 \221\366\232/\332k\364\264\327\334\035\301JbQ\266\270\331\351\327\2718j.\222\215\344\247{\214\315V\024\207\231\234\366\354E\002\217)f\237s\346\362\334\305\006\304\211\364\246=\023\311[\3561\301\271\037d_P\264g\255\237Y\337\026\250\3179K\263\2501\303@F\n\215F\316r\317V9H\306\352"
+	.string	"\b\372\300\350}\316B\362\020\317X\371jg,\016\232{'3\226\315\227\275\2236\367Zp\257\005y\253\nH\231\232\275\006\211\366\271kA\255\2718\352\303\330\361\354\234q[\233\032\001\342\303\207\205\254\030\2544\273\250\317^\263\324\303{d\031\367\211\001f:\246A\256'\033\324\313\216\0359\307\bWVYN-\340\322\210I\212\025\0348r\216+\245\224\345\324\322PmWDrX]U\035\265EEe\033\032ia\006r\265\332[r\225g\033l]\216\264}\316\315Lu"
+	.ascii	"4\245\242L\225k\250F\240`E\311\213i\221\203\212)\323\360\200"
+	.ascii	"\0160D\231F\236\002\003\305\211\366@\334\375\312W^[\226\232\021"
+	.ascii	"\343J\352\245AAe\031E\224D\351\304\324X\302\332r.\236e\374\340"
+	.ascii	"\204\374({:9\335\267\234\233\255\f3r\322Xi\367\034\343Bs\214"
+	.ascii	"\373\2462c\222\302\212\2464T\332\263\322\3150.4\303\300\323\313"
+	.ascii	"\324eU\313\251\224\366\213\247L\277\320\314\374\244\t\354\235"
+	.ascii	"\204\272\300JK\226s\017\367\030\323\242Yj\317G7\277\270\320\374"
+	.ascii	"\342\322\345l\344\235\206\"V\317\f\234\346\322\251-\262\213\026"
+	.ascii	"\331H\335\373>\233I\314\375\304\324Y.\263\321\335\314\275\r@"
+	.ascii	"\004)S\344\312G\221\\\344\331\b[\005\315\234\370\250\233\n\233"
+	.ascii	"\360\330\273\323>\323\246\035\207\301}\236\267\357\274B\357\275"
+	.ascii	"s\256\224"
+	.string	"\236\236tt\216&\243#\245\347\0256e[\226\270e\242\027\302\303\213]&\312I I\240\312\177\361\224\204\b\354sF^<\032;\251\223\335\021\255\356$s\357\275\364{n&\021\215z\177\367\352\270\327\\|\007\340\316A\004{'\365\234[\364UZr\206\206\355?\351\336J*d\003\250\224\224TNK1\252\215T\376@V`n*\344Rl\357\n[\251D\202h\356\nK\261\255\264W\300)\335\375\244BnesW\330\312\235\324\260TR)-\305\222J\025\226bTJ[\214j\337le\222Y\244\334\314\n[\214J\313\026k*\335,\305\232JK1\252\0377I\021\327\326R\236\363\006\335E.\225\373\005RT\222y#]>\233{n\357\013e\261\231\003\330;\252\311\234K:\335(\221\364\005Q\222d\363>\221\210\252\232[)]\ni\356-\204\310g#q\200|J\367\216+E\332\210\332G,\366\006"
+	.string	"\322\336\310\273\245{o\344\336\033\310\214z\356-\343f\351DB\332\373)\007iG!\225\260\330\373\241W\242JK\261\252\346\216\022$b\316\335\342\211\274\316=G\305\324b\310\257}\204\247\235J0\356\276@\361\227\273\247\263\367\222\206\"5\230\031\370L\023_\024\310\265V\005\365\362\316`\322V\037\223.X\257fK\215\n\016.~\241\230\013\326\223\200)B\330\321\364\265\336\2500}\316\263\251\001v5\365\331g\220\264\317\260\320\342\027\212\265`\274\034+%Y\316\275\315|\312@G9\302\342\201\357\200IjR4\340\264\313\270\351,4\311&\264\267&v\001\353\217\211a;$B\005;\344"
+	.ascii	"v\310\204\005k;\034A\\S<\340\003\354\260\304z\f2\366\2048\256"
+	.ascii	"?C<\253\017\221"
+	.string	"\r\200\373p`\203\216\304\"\220\352>\034\210\001Pq\242\330\006\221\300c\faE1dqF\\\3409\016\203L\\0,R\200\304\004\306\342\261e;\254<C?Dc\261\303\221\035\352p\341\347g\310h\f2\002[\241zB\320\321\247\r2\002O\f\327\237\334\256,\320\n\244\252\020\n\372 A\353>\034z\204:\364\b\341\020\215C3\307\037+\244i\205\306\036\241\237\261G\b\373\264=\306\365G]APd\263\n\241 b>\266B\230g\005\362\254\354P&\256,\320\217\302\036!\0165\307\241\0171\2538\266l\261g\035q\201\315p\034\266$(P\341\323\376\f\327\021\330\02073-qmW\0205\353\261\204`\212\241\261(B\bh-\3613\374\320f\240\265eU\220\250\321\200C{\034\nqX\333!\217\220\t\023\b\215\"\264+\273\216\350\021\242\300\211\305\343j\\{\264s\340\001\002<\370 \005\320?"
+	.ascii	"A\003\0204P\375\003\020vv@\360`G\273\007;\370\204\341\210\230"
+	.ascii	"\026\305\n\302\211=C \334\nY\023V\240b\253\335'\037\333\022\210"
+	.ascii	"\306!\021"
+	.string	"x\206\353\210\236\241\210\tX!\212\025D\317\020H\363\f\327cv\037\016\307\365\207\3078\034\001\2475\236xVH\\G|\250PlS\254\271m\205\0366\3509\206\360\001\342\320\304\317\317\2208\323\n%\020\"\033\213%\030Y\242\332\246Xu\233b\255\001\272\017\207\b\224\bA\242C\273\366\034\207\255\206\226]\333\334\376N\f9 \305\361\207b\345\301\355\f;dbf\005\262\302\242\020\ta\210\022H\314\254D\343\260e\215E\255y\326U\210\375\255=<\017\3501\026y\206\353\317LQ\210\305\254\360\203\207\020\354\220\t\375\301C\210\030\225\350\241\210\207Lt`\217+\212\342\221\007\003+\024\301\016\231\250a\205 \332\024\353\314qm\331!\220\272\242\030\376\220\030\022\002\322C\302\230\237\240 \007\b\177!\210"
+	.string	"\261\262Cjk\034\n\3720\223\242D\313\n\217A\255P\361HdW\020?\253\3218\364\3710\004\342\271\220b\304\020\210\347\227\242\304\211\025D[4\206\020\206 \002\204M\212\021m\321XTY!;d\202\246g%q\034\"\312\260C&\360*\f\266>\355\020\b"
+	.string	"@\227\025\n\205N\340\244(\036\333\241\2106\350\030\354\031\226(\266)\036\320\032C\030\213C\b\260\277\017 B\350\031\002\251\255\373T\320\272\017\207  \240 \"\001\206\204\025B"
+	.string	"\nj\331!\"\016+\354)\2360\006}\260i\215+\220\261\247\3703\254Y\217\303\023x\216C\037\232UHE\tv\310D\220e\327#\017\317PH\364P\264i\205\037\264\306\342\020p%\026Q\254<A#K\024\026\205Xa\317\020h\246\025\366\fK\004\025\201=\303\022\255\320\320\361\270\266\306\"M{b\345\301\340>\034*\360 \241\365\330\241\r\n:v\230\341Y\333\365G\b(\350\2031\250\330\016\217&\212?C\342\004l"
+	.string	"~~\202\216\331\207\330\026\205~'\fU`v\035\372\031\242P\207\204,P\361X\202%\026\201\206F\025 Z\237\236\342\317\t\013\255\320\203\235\326X\004\372\316\316\007\r&\220"
+	.ascii	"\001M\344\300\262C!\240 b\007\366\030\304\032W\266\203\2618\004"
+	.ascii	"\352@<\262\0358d8ax\304A\307\025\003=C `\215,#\223A\351\250j"
+	.ascii	"\376v\315\0275/[h\274\217\367\332\352zN\361\2011y\250}\376\315"
+	.ascii	"\370\315\370E\305 \203ka\236\230t\2422\021\227\324]\364\263W"
+	.ascii	" \322\356?\031\331h\305\331\025\250\337R\006\314\017\267\275"
+	.ascii	"'\334\365\263{\322D\301\351\227\244\315\250\242\\5\341\351\214"
+	.ascii	"\024\260/k1~+\356\234\r\".\2300\306*+r\007#\343\005\245F\372"
+	.ascii	"v,%U\262\272\244\263\237R^a$\226\205\302g#\243_\322\004N\242"
+	.ascii	"zK3\313\261\032A~/\374\227\364QU\013\216*X\237\177.~HN\246T\205"
+	.ascii	"\350\207\364;\262\001\362\203H\023s=\265\\\304I\301|>\236Fy|"
+	.ascii	"-Z\374\2269`\300p\334U\300\351\306\325\347e\r\334\222\225]D\251"
+	.ascii	"\374\255P\307\340\252\230\366\264\323\025\221\242\337\n<\315"
+	.ascii	"tk}73~\311_2\313\330Q\322"
+	.string	"\027F+sUA\302\002\006\314o;V\356\2513'M\232\2241\270>\377\355{E'\225\345s\016\243\277\024\265E/]U\036]\232\032\027\347\222\371.\330N\272d_|^{{?\351\304\340\260\363\241\346\3053\237\317\f\301S\362\374\234\2738Z\333Z\230\251=\340\036\333\f\254=\275:\251\326\020\024\326\322\270X\311y\237#\213m\225U\371\35462\264\307y\256\022\204(\250\323b\003zP@L2\316)\244\210\206$i\2411\223\024@@H`2\233M\2079\037\023\300\224h\244\241\232g\221\242\031\021I\222$\035~b\036\020\217\265\246\334;\2401\343\344\216\234br\305\253tX&G\217?\327&\367;\210((\337\351X0l<W\005D\263o\313QW\271\004p\263\220\316\027\253\305\307?x\325ZiRMLK\035\025\254\023\225{\346*A\025\0224\\\001\372\200\327)\220m5\356`y\242\201"
+	.string	"D\366+\267\032\255p\310u\304\250T\207\211&H\271\350\261\226\336<\016\234H\254\354\233\352\2743\016Gf\304\327\245f\354\002Q\365\307\322X\352\347n\312\273\330V\373%a\333\004\022z&\307\276\372'\217(\205Lj<\250\325\376G\315\032\230b\377\216B\223\265\377(9\220\371%h\321w#Q]\371}\036\"\253\343\025\3733\351\267\2437\311\034\332\210\261b\200\266\324W\376\372)\036\031B\020\342B\331A\204\036\n[\360*c\020\320\305[\246\326\335\352\326?\270\202\222>\237\357\005\007\005\210m\237\3574F\333A\261\301\252\3211\313\305\202\307\254\356\204\301\r\326\2654\242\207\240P;\203,t#\347\316\033\3159\005F;\036\340\031:\222\035\3725\225\203\033+\263\"\234\322\367M\376\251\331\265v\323\022\211\213\217\225H\344\207\3004\372gU\t\234\327\351S\366\254+\210\216cL\257\267\245"
+	.string	"\204\221\217\205/QDs\343.tNr_W`\242\265t\023xpZW\020\035\307\230^\033\200\275\027\250\016C\354&P\305\307\f\260\373Y\254\004D\002'~4\022\340\252\321\034\337\357\243$R\f\311>\031\025\361\354w\243\2214\221&\007\376\251e\334;\tW\270C\024b>!\263\016\320\343\007,\017e\320e /\217aA\301\350Z\017\177\374Tj\316n4f>\275<T{`\005\270\na\252\304\266ph\237"
+	.ascii	"-'\243\333\005!\316\b\256Z\203+\001\247\340\233_\002\025\\\027"
+	.ascii	"kY\265N\324\301\274\fOXJF\234;\0022\322\227\357\322\2460\357"
+	.ascii	"\324\346mhP8\352\022 "
+	.string	"9\260\202g\017\026\244&\270\326f\350\272\025\334v\020z\272\304R\2242\274\330\332Hn\243\203C\316\234k\274\316\372\204\335\265V\203Ko\334\302\002\303uX\356C\263\025%\257\247T\271\351K\357\346\351K\314\0037>O)&\346\253\035\r^\017\253\355\262\206\277\311\023*\003\021\221\311\221\005-\302C\314w;\201P\306x6J\006\341\246I\245\371S\237\337r\206\365\310\262B\217\262\225\200\324@\272\200\242i\220\256\363\350\300\247\264\2201fc\222\266\207\260\242@R\344'+\340\240\330m\2122\313\202\246\314\331\027\257\005\2346\232\237S#\245\254\300\227\235V\324\337\256\257;\212\t\005`\261D\354\245`)\261\225\206rA,u\275\030\ri\004\237y\024\266\306/,\356AE\004Q\347\371zK\r;\356A\203\220}=\243E\250\207\246T\362d\313\b)\347\024]j\244.6\030dC\361N%\240\353(\217a"
+	.string	")\222q\031\271\325\211p1\201\t\267aY\333U\306\376R\350\245a\332D%#G\346\237p%L\347\230\367u\3236\002\206c\340\373\311\341,\363\312\005\224]?y-\362S$\356\335\024\254\362\223\244\034/\351\342\216\366i\343\314H\233\f\013\203\007"
+	.ascii	"\236\022\006\027f\247\264\251\254\315\302\334\373\272\264\251"
+	.ascii	"\323\322Z\257\245\025\264d)@)\320\306)\366\367\364\207\037\026"
+	.ascii	"R\006\366\222\025V\225a\213\317Y\272\244\260\030S\017-nc\221"
+	.ascii	"r\023\264\307E{H>0\327\317\241H&\225\254\035\232\370\240\234"
+	.ascii	"H\216o`\256\326\302\365\221\370\2402\224\027\363\007\002rd\211"
+	.ascii	"^\257\343\207\357t*\321\b\210iFi\365\037\375\372#L\004\013\177"
+	.ascii	".UR\032e\352M\nL\207\b*\255\370\336"
+	.string	"\3654\316\213\244p\250\211\221Dh\200\205\017\345g\022`Hj\320a\242\320\251\247amf\003\356\031\247\220\266\316\277\362\254#4\2623s\376\350m\370\216\f\271\372z\243\301^\260~T\355kP\025\371\023\313\323\325H9\231#\214\374{\217\341\322ZB\034\315Ie(\356*4\204JHl]\270\331\261\365\317\374\263\326\354\245R\020+\244\024\030\304\270;\037\336\354\220\363\023\342\363\322\352\313\032)\265s\337\201\301\244Dp8\215\224sH993"
+	.string	"b\256|d\006\337'j\013*\215\240\266/\025\350!4\226\232\227<h\362v\332YP\242Q@'\254\354\006j\232\256\363\204\0324db\007\305o\214,\\\334\005a-\344\212\0212\214\344\033vU\312\2075\024\371\021E\252\225\256\247\332\f,i\232P\207\006\321#\234\226\224HP@\001\254%\257\272K\324d^8^\036h\336#\276\241@\314\231\021\357:e-\310"
+	.string	"\203\033\334\267\204\264\r\231\356\263\356,"
+	.string	"j\233\313 \365\246\352\227Z\243g\343W=]\247.\346\2008\3605\260\r\006a3\016\305\343u\303}\250/U3\357!\200\301hC\030\252\017\320\346\313"
+	.ascii	"1\272\030\373\036\331B\n\210\373Ex|d\242\207\375\224\317\275"
+	.ascii	"\251\016\"\\\250\350\346\tk\303\217\314cHy\360a"
+	.string	"\032\241\317\026ff\265\023.*\340\230\205 \200N#NN\341\2427(l\356\312\353U2\312\017\217\251\326W\351'\264d\264\221\241H\022L\2644\375X\207\003\366\267\n\337: \035\370p-\001 W\322\177\024\340\221TB\227\331\377\007\242A\237\352\236\tB\203\201\302o\303\257\t\324\340\255\204\036\013\002\331+\376\001YBj\007L\341:\004\004\034\r%hTI\366\261\317$_\204\022\235 \226\271!\323\332\020+ \274\376\221@I\376\257&\361N\230\303\303\206\204\304H\3037\034g\030\271\226\321\0205\361\356A\250\200\357\247\225\353\241\315M\316O qG$\022\030\204\321\302\235\214\212\032x\255\340K\n\257llC\t\b\303\003\221uG\352\241\026#,lr\rq'k\301\250\232\232\330J\013\345\347Z\202\303\213\2352\207\245\021Nb]\027\025j\306+\21317\327\317E\251D\233\374\376jDS7\310)"
+	.string	"\364G\3406\032\257\375\177\"\372q\tU\247\006\357\307L\246\243\3700-\001$lGa/c\365`"
+	.string	"p\314\331\231;\225\326(\315\313\321\345B\033@\"s&5\013\005\004p*\217c\263\267\275\267b^e\317\271\200\372\307\223\360\361-\240\245\225\321f\020\234|\324\306_,\214/\206\033\004Q\2534\344A\332\027R\0248p\013\363[\f\004w\206\365\001&\375'd\037\261\201\307p\330\177\260\375\204:8\323\271\254\375\320\237ZB6\270s\222\t\310n\247\325B\253\315\354ea\355#O\262\370\254!\321\337Rk~\222\261\270*\310\2073\344\264SWU\360;\334_4"
+	.string	"\214_1\222D\224\005\244\365\303&\275\r{"
+	.string	"ew\322\tLZ*{\202\375\213Z\231\202\r1m\353dKCY\233`B\005\367\013\fN$\024\320bH\270\361,\013)`1j!\013\202\346\312\024\254.o\202\367{\204\f\304X\222\264\256\234\"\023PC\353oh=\205\352\033\301\340&E[\254l\244\372\274\363\355\333\274z6+\201\327\371\373\262\243\300\336n\263B\036\225\352\324\024\354,\272\317\322s\3529\021\206\206\356\3156#\306\262\374\261us2C:&f\272S\360D\320\213\374I\005\363\021\374g\222\353\200\372sz\341\371\222^Y\277d\332\220\235H8"
+	.ascii	"\324\265\3022\324\316\365\020\351\2535\316+\246(u\n\363\005\234"
+	.ascii	"!\347\376p9\242\270O\367\252\373]\327\334?\f\360 \230\233\324"
+	.ascii	"\333\370\274\362\242\353T\224\375\250=ZOh\373z\326\213\323\022"
+	.ascii	"\230\203?\261m\272\336Xn\\/{\233zc\206<v>\351'\314n\\\007\344"
+	.ascii	"\275k\2170a\276\306\347(\207~9\321\026M\202\027\271\331\316\346"
+	.ascii	"\344\305W\215\244w\345a\275{\f*\260\026ww\005"
+	.text
+	.section	.gnu.lto_.symtab.135c4a10cf0b26eb,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"schedulerIgnoreTaskExecRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.135c4a10cf0b26eb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,846 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\235\006"
+	.string	"d\tB\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\267\235\363\261\017\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\260\355\222\212\002\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\215\232\327\322\003\030\020\315\232\225\331\016\021\022\340\207\245\357\f\023\262\235\221\362\004\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 d\365\001"
+	.string	"\024\002X"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.ascii	"6\t\026j .\207\254\n\353\214\241\022cf`\232w\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`E\001\255\t"
+	.string	"B\01722`k\323\030\300\203\205\301\217\241a\b\b\213\017\016\002\037\r\035\251nV\247&\240\213\253u\223\300\224\001\257\002"
+	.ascii	"g\251\037\007\342\020m\374~k[J\231\002o]\360G}\304\235\216\222"
+	.ascii	"\013\r\031\007\305\222\243\343\001\202\340W}\276\212\222\030"
+	.ascii	"\233\b\215\376&\277+5>\235\t\367\304\362\022-2*p\312\355\007"
+	.ascii	"\300,\2322a\210!\263\361\221,\020\360\357v\031\265\253vW\272"
+	.ascii	"\251\344\354n\001\224\210\217\024(\345\206\225H\312\r\335Z1X"
+	.ascii	"R\330]\313s\216h\271\351`<\022M5\035\214\207\372a\351\240\037"
+	.ascii	"\217\277\276u\231\334\326eIs\327\242|EP\211\335\035X/\335\335"
+	.ascii	"\325\214\316\023\362\330#\0373\275\330\335\367\220\363 . `\002"
+	.ascii	"!D\326\016\013\032o[py\025\3720\032\020S\330\332\256\210\222"
+	.ascii	"a\215\357f\322-\333c_\304\352\355\300x\023r\236\360\2700\260"
+	.ascii	"\b \2464\211\300\267\375\310\345\313\025f\237\003\213#;\346:"
+	.ascii	"\025`\321\324\bNbD\007\267?[\327\020\220XV\240\033^\374\341\255"
+	.ascii	"`\277T\321\316\356N\333pj\230B\302hUsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\005\005"
+	.string	"R\210\033&\2205I\007\227/\216\330\263\217\325\027\375\252\177\265\037K\241\231\325\335\336\217-\365\002\333Z7{\370\237\250Md\222\001$\257\177\326\366\f=\345\253$\314\3521\275\243\177[k9\207\302\200Y\300e\006\250\222'\356\220\177\334\271X\232\024\300\016\201\b\364\220\212(\032h<\017\003Q\273\033\365\215\352tj\0207h&MF\246\266\227\236\004n\001\024"
+	.string	"\"F\326\025\006\323\235\202v@`\200\t\324)q\231\303L\313\031\016g\020J\r.\207|"
+	.ascii	"\027\361\031\005.\036%\030V\205\2542d\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\325\004"
+	.string	"\222\006\025\037\220+\303\001\377\277\242\372\377\217\375_\235\276\353\246qR\256\353\272v\376P\331\337\265\277eJ\001b2\232K@}\210\303\324d+\231G\346\220\315\307\320\223\036\001\006K\301\261ml\372@\306v\013\220\343\274\330H\227k\352\242\350\256\342\304V\355\315\022Lz%\036"
+	.string	" \013\311\030\254\241!\300\0216\001@\034\036&@\\\315\013\260\213E+b\366~\300\210\341\002 \\\024\024\236\020\024h\222D\303Zp\322\262e\265\004\n\253\200"
+	.string	">=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.71b3b78599d70d61,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.24.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.27.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.32.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\201\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\334\030us\347\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\200\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.34.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.38.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 \223U\004"
+	.string	"\304\007\\"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\241\033\007yw\250\366\006yu"
+	.string	"\005\001\006'\001\004\005\001\006\035\001\001\201\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"B\b\354\345\006\320$d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.42.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\235\013"
+	.string	"\026\226N>\020Q\225\016+8\264,\302\313\232\241f\354\340g!\230\001`\316\357\316\004\364\204B\t\267\223\333\320\200>0\222+\025A`\261[Q\004\262\b\342\220\234 \374D\005\317:\332\032\333&R\246\024;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364%\022\226\213\0024v1\2046\266\025Y l\177b\217\035\343\240i\257\3220R\325\330]L=\334\363\364\370\027\361\310G\372<9\024\354\256\363#e\270\365\266)\266+\366-\004w\213G\345?\035\354:L\273\336?\037\365\324\346\177x4\205.\377=\372\335\343\321\356T\310\177N\023\251\226H?6\bJ\355`\377Z-\331\232\216\232\2764\255\231\016\341\f\033\002&\377E%pA?V\365\352\033\f\t\355z\224K/b\001\312\320\251\252\006D2\256\251\037\335\260\263\2534\310n\b\201O\342%\"d4\232\307\343\365\300\213\025!P^\206\216$\200\316,\234\215\306q\235\f\353\270\255\333h\035\266\311`$`\031\327a\226\001\336&h\034\306\3316\016\233\200\336\257\325\322\002\025-OA\026\220Q\177z\212\013\344\304Q0hp\2718x\020 \275:\007\030#\300\004a\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.43.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.44.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`M\002\035\021"
+	.string	"\246\037nE\360\322$\0352\343\363\374\253]QC\330{g&\317U\306\035\207\237\351\360\317^\027\032\213\371\352\300m\374\264\250 \271\375\301\306c\201\311\202_iA\362\340)\214\223\307B{\034\023\252\334\305\354\201\305\266\367\2262\245Y"
+	.string	"S"
+	.string	"a"
+	.ascii	"2va&.\t94\354#\3610\344\006\342\241W\366\216\303z\3661\0277\261"
+	.ascii	"\036\273\233i\210\257\036\341\323\\\371'\224\335=\320\001t-\232"
+	.ascii	"G\235C\016\033\362\345\\_\202\035\242\034\001-\2337r\004B\351"
+	.ascii	"@\317\016\255\232\314\023\312\356:\273\026\316}\272m\027\333"
+	.ascii	"\n\354t\005!\273\273\300G\361\024\031|\237C\253d\362\335\241"
+	.ascii	"/\023\017\257\"8H\257\037V6\3310\232T\227\375\267\273k\345\261"
+	.ascii	"\377\363\007x\351\370\322P\323/\323\232\351\314\364\t\240J\034"
+	.ascii	"\2250\355zh\002\262F\220\306\b\224\355\247}\023?\261"
+	.string	"\372\317\314\013\354\362\f\005AX\331\364\213\350v\214T]Fp\225\370TC\220\016\233\374a\277\306m\250\370>\236\260\222\357V\342\341\323\023k\351\365A\325\246\360\031\025\036ck\220d\226\303H\231$\035\276P\035\200\243\364J\265\265\267\310%\013g\261\"\025E\002\311\307\325n\271\212\330\005\027\221\036\237\231x\250E\035\017\277<h\013\234\026\243\275@\247Nb`4\216\223Ie*nS\301h\252\f\246\205\345%Kq\252\354\204\304\033\006\215\313b\266\215\313P\260\375[\345\361\203\227\021KkbT\333'/\"\212P]\276\320\237\222\3500=\250\266\177\343C\020\034\364\354.\003\037\307sD\220\220\222\022\017\363\026\352x@=\020\273\t. \300\002\021\241\354\001\263\320\305\307\360\f\345^s\343c>ck\013 \330\245;\331x\256\026\224\301\253\202hQ\017,ir\245Xl\357 \241\035<\032\316zx\003\363\240"
+	.ascii	"\254T^\235\3411d1%D\330O\212\177\003|\253e\331&\214\002\351\332"
+	.ascii	"\202=E\f\311\335\035fMa5\213\321\246\253\025G\0262cJ\221\241"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.46.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\325\006"
+	.string	"r\r02`M\323\001\300.\205\203\254\373"
+	.string	"3\004\250\3114\340\341\n\004\347\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004K\262"
+	.string	"[\242\363\216\272{H\231R\216 \313$Ax\211^\005\251j\222\2527)$,\274\bV\017*0\305 \301g\241(\370\036m\257\032\204\222\r\243\020vr\340\376p*\277\3065\213 \333\305<\372\033\347\270\370\027wn\260\362\361\316\267\234;\333\341!\037\235\035 [\204b\266\206\245V\330\007X\325\330\372\220\204@&\273\023)(\2739\017\f\333\177|\331#\327\262\375FDbs\262\273O-~=/\377\031\027\210\031\354\031p\260\273\316\230\241\270\365\266\rlWlg\001\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.47.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\3662\262J\240\230Q:\301\352\365R`\342F\222'\001\206\257\200_\214=\204\025p\002z\367\035\316'C?@N\336\336\370_'LQ;Pf)\345\207\261\032-\360\r\270\366\205A\377\222f\274\220\f\305\245\021\367\352\231m\204\020\"wJ\001\227"
+	.string	"\216"
+	.string	"\243"
+	.string	"<<\256\024\364$\343$\271\\\264\203l\227\213\324\305F\272\2050u\027\003*G\207\320\201\005\\\\\221\260\324n\360"
+	.ascii	"w\240\020\354V\240r@\325\n\\\340\b\254\213>\265\237\343G\270"
+	.ascii	"\377nn\325\n\203\210\217Z\353\002+`]4\360\001\343\305\3602\343"
+	.ascii	"E\343\354)\007\372\352\203XJ\004\257\324Zc;\343\270\217b\270"
+	.ascii	"\024\347\223\023Z\274\336\320GW\217\305\305\025\017I0\355\350"
+	.ascii	"\276\364\316\320@\255\365\301S\023=\035\245\344\204Z\253)\257"
+	.ascii	"\227\342&o\273\307\266i\207\017\002b\270\205G\365\245+6\225\260"
+	.ascii	"\362\207;\365\260j\335A\360\233\336#\204O\343\242}Jz^9^\374:"
+	.ascii	"Pbu\343\227\243W6PG\267\310~XW\206mH\352\032\222\032FR\323\374"
+	.ascii	"\367\023X\352\031\222Z\346Kw\314\221~\001\327\361\303\034\370"
+	.ascii	"\007X\352\327\221n\327R\267\226\232\265\324\344R\217#\265\270"
+	.ascii	"\324"
+	.string	"\341R\357RS\221\3727//\222\304\242j=q\245\245J\211@j|\351\366\223|\246%?\261\206P\260x\314\340M\325Z\023\\tN\254$W\222\243\2433^\224\331+\235\036\251\360\021\035\375\242n,$\255\r\222T5n\221\317\364\326T\224U\230\340\016W\300\272\326\204\3152rCP\344<\252\231\245\313Z\361\310ID>!wfo\230\2348b\226\224r\032\211;.\271\205\303\241:\f\0217\302\216`\325/\027n\314^\312I\324\340~\032w\303\265\t\2368\\\353\332\335[\331\030r\032\351\350\225\270E\017W\206\220\303\354\213\026Yh\255uh/4\006XX\013+;\242\354(\026\323\265=<\310\255\300\223Z+\004\377\307\201\310f4\332\370\265\322\234\311,\2304\033\017O\206\027\240\322\304\251\225f\211a\347\207BPy\201&\3024\313\032\b\223f\207\346S\223\211&\005\232)\333\001\322`\332d\""
+	.ascii	"x\306\300\374\241\325j#f1[\255\264\375"
+	.string	"\320l\261\237\036\231OlV\263\305\030\334\270\004\242\325bfY\326b.\300\334\303\007_\201\212T\325Tnu\266\301y\224\333\313\007%G\307f7\370\242N$5\353\304N/_\023Z\205G\005[\231\255Y\261\351$\3229\375G\205I\252Z\302\325\225\322\256\326\334\001\232\205\355O\243\327\322l\315\3239E`[\373Z\362\310i\244S\262\206/qQ\250Q(E\225Q\b\ndF\202\314\322\302\214\001p\002\2212\253\016\020pFCI\306b[\326Z\211=M*\210\345M\260\202\307\020\206\021 q\371\263y\031Y\223\377\006uu\373P\267*>\250\277\035\351\254f\221(\270\3075\253\310\311I\255\032\205i\215\263\315\r\305\231\247\203\241\\\207\bT\003/cj2C\026\372\220G#\346LS\201Ax\304(I6\f\3706\002\220\205A\2246\245_x)\036\023q;:\314\215+@\224\362\222\345\332\001\312/"
+	.ascii	"\331\2248\305O\304V\256\342]\325+\264\251\n\201NP,\272cM\031"
+	.ascii	"'>\267\235\360\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.48.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024JA0\307(\035\220\313\313!\3373n\316\237\344\357\325^\374\354\352:\004\254\220\201r\306\215\251X\206B\204h\r{\036\342\177\320\312\206g\b*\002N\r\300h#z\207\201\004\311\005\360\345\223\310m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\226\320N=\376!;\325\356\220\235\032\264\035|L\355\001\234\220\260 \354n\235)\007/A\377/W\bO\245\313\004\214\335\265\fO&\367\274\355\b\333\024\366E\002+\321$c\366X\222\023\305\276fw\327\023e_\3745RZJ\351k\013+\f,\f\354\226\304\"\354\213\"P\331\330\276\264\337r\027\360\"\351\r\273(\005\007v\307\211\003<\025v*@N\006Wk%v<\200\306j\301\247\375\371\f\013\244\343\244T\244\354t&\b\037\370\3432\237\266\273\025>\314cD\276\352\324!#\371\360\324\037e\247\237\034W\201\036\027\342>\324['\004\342<O\264\325\317\353>\020\367U\220g\343S7\357\253\035\bw\036\234WC]\347\325\315\270\327\354D9\203\345e\232#\226\323\336\336\222\r\270\023\370.`\346x\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.49.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\252\003}\030"
+	.string	"\206j\230K\240\024R:\"\301\024\0326\260\277lrvi\313\352\212\315\217\317\236\264\337s\226M\245\224\306K\335H-]\350\347\377v{\212\351\335Q7t\377a\265<\032Z9\217\025\363\007\357"
+	.string	"\322\220'\341F\254B`\211\337\022\2627\331;\311~"
+	.string	"|"
+	.string	"\207"
+	.string	"\277]<_\273?\374Q\356\304\234\216\345\374C\345\224s1\245\033\234\277\t~\202\177\313\017\300\277\235\353\026\362b0\377X\305[\002\3139\247\266\305s?M|K[s}\343Oh\030\265l\370t~\236\351U\005\327\320\310\274\356w\314#Q/\312\217\317\357\345\263z~\307\235j\313\005\300\252\023\001|#\312\023, \257\033_K\370v\265\232\024r\316]{>\237w\354\335\375\353n\007\335\026*\300#\242\256&\357\242\007\274\262VH\366\034|\373$\031HE\264\272vj\222\356\342\256Z\241\356\333d2\231l\033\324}k\243fm\031\256\035\303\265O\\\333\274\265\357\223~{\342\177\002'B\202\021a\031\222\263\211dX\276\272P/\272\373\375\032?\332\\\251\025\204\001W\330t\243Kg\272\271R\033\020\306"
+	.string	"\016s\316\350o\367M7\372[\321\356\256\305#\345\236\204s\223\234\203\302\3223\031B_\353>.\260\264\264\340\337\372\226\302\277\357}][`\211\267$B\n%<%\312]\260\314\2060\276\307\255\\\372\302\306\360R\337{\301\2772k\352\202\030\375b0\257\312\360\0355\t\307\326p\035\033R\270~\251bV\200\217\227\321\031\363\251\032D\3469\242N\213\302\330BB\354\331\237j"
+	.string	"\202N\"h}!\016\376\265<z_?v\207\343\250\2359\347\007\375\033o\362\320\027\376\366\214\255\276g\303\277\246\355BQ\0247Z\rm\346r\250\325\236\251\324\320\320n7\020\263\024w\263\341hh\270\224\246&3\223\316n\270T\345@\333>\320ni\215\315vK\321\242\356e6~\205\b\211\004\251\263\2732\347\234O\230#\357\323T\321\354BL\")0#\f~\246\216\271\327\020O\02084\242\253\311[\355\216\232L\004\325\332\356\225\n\365\275.\255N\177}\001Ea+\324N\306\233"
+	.string	"\231Q\237\216`\261\270\250\312\271\266P\213{\206\254xK\256}\326\177X\230\020\3149N\250q$\344\020\203\346\220L\220\221\202\202$\035\200\002\221Ac\007\021P\271F3\263\205\225cb\302=?\266\2642l\353\343\274\207c\nr.\220\007\345\230\320V{l\204\365\004`\244_~\374\242\r\366\r\367R\274;\251\227B\276\221\226\337\"'\207\022q\321O\202h[E\233$-gJKf\211\307\232\327w\270\271\237&d\350\255\255\003\205\343\177\004\205U\364>\330C"
+	.ascii	"\313\t\213\254\342%5\224\212+\330M\215Q\205\031\217\201e\034"
+	.ascii	"\302]\224\036s\373\223\001\f\376\213 %\313k\001\375\311A\276"
+	.ascii	"\3518\271\352`\036&\211\247\006"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.60.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\360\001u\020"
+	.string	"F]gG"
+	.string	"\261&\035 \023\354\271\"\\\261f\353>\030\220\001\277\226c\224\336/\370P\310\375\310o?\375<f7\017[\221\276\206\206m\300\230\246&\233v\302\034\252j\373\250(Cq\304-\360\244X\326\005\204"
+	.string	"\251\265M\344N)O"
+	.string	"R"
+	.string	"Q"
+	.string	"\001vW\200lv\307\004\237F\240}z|H\350S;H\350\323\376\n\333\251\024\213\366\215\217-\373\031\235\017.\035\273\313}\352\211\213W\231\211\376\353!\257\016\327\307\016R\023c\203\006\204\210K\001\317D\017v\327\332\210{\336\266\003\333\013l\271!\341\213\307N\207\371"
+	.string	"k\245\262\273'\3733\247\2617\227\034f\002,\025+\026\273\273\225\250\337\"\345\277\274\331\276L\352.\023\031aU$D>\2551w!\336eb\217]\0239\n\264O\003\331f)?\246\016\203\0320n\210\024Ki\377\345-\3610\250\007,T\350SwNr<f\f\217\341i\273\313\300\2779N\006\237\365i\322'\177\362\205>\257\217]\372\250\364\254^Z*\031$\225\305\232=[]\261E\322\372\361\227\"\351k\"(\037\253]\224 \240-1oP\\\346\267\357\303\270Mx\2303\0349\001\027<\tv\246\2164=\0321\225:\020<\215\270\020\374\302R\027r%\217\204\304\215\300\220\033)\340OC\007r\246\357\003\271\355\257CH\361\263\343G\245\036\254\252,\266U\302y\244\017\205\357x\rb\256p\035\013\\\317g\r\325\017\234\032\227\026\311iLp\341\361\3503<"
+	.string	"-28t~1 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366F2\033dZz\302\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`\025\001}\b"
+	.string	"\244\013\021\002"
+	.string	""
+	.string	""
+	.string	"\002<\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005-\022\201\204\001\033\177\037\272\200\202*\177 \005)\020\0055!\034\016\200\003\002+\177\",\177#6$7%\002.\177&\002/\177'\005#(\0020\177)\0021\177*\377\377\377\377\003&+\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005$,\005\"-setdata"
+	.string	""
+	.string	"\005 .\035/\0360\0321\0312\0303\0014\1774\037"
+	.string	""
+	.string	"\200\200\200\0013\17752\1776\003\003\033$\003\003\032\304\001\003\003\031\344\001\003\013\033$\003\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"% \220\002\251:z\030\332\036\272\016\222\177\030\257\207C lY"
+	.ascii	"Z!\302 l\304@\034\330\214\2331\315\270\214\227%\344;\005\335"
+	.ascii	"c\204\321C\b\360\2178dJ\024\303\306\206&\351Dd\206\207\004\354"
+	.ascii	"7|]\033L\332\340\303\263f\200\033\236kx\243&\320O"
+	.text
+	.section	.gnu.lto_.refs.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314\342\314\021z\315\030k}\235\032\020\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.71b3b78599d70d61,"e",@progbits
+	.string	"(\265/\375`6(\235\260"
+	.ascii	"\352\026I=X0\nY9\351\245\007c\373X\246W\353\250\257\030\352\341"
+	.ascii	"\261YY-b\207\030^\217\n\213\3659W\034\260uzjh\273\036\250Rc%"
+	.ascii	"\353Jw\211?d,\212\325`X\327]l\264\200\266$\264\206\313\300\246"
+	.ascii	"\022\"M"
+	.string	"\211\2743\\e\273\r\302C\307rPd\202\366\2262\0051\003\316\003\341\003m\2744\336\232F.\356x\274\027\031\"\204\217\016&Z\326\200\260]\305\031L\002\350|\235\327\031r^\347\306y{w\336\266\235\267Z`t\214\237\345\224\031+Q`h\365\013~b\363cI\333\333\034g\023\273\005'\333\305m\224*\344O\035\336X#\003a\002\2010o_\234\257o\316W3'\006v\315s\370\356l\307r|\210lg\357\0352[\300c\266@'-k\2304\355\253\230\363u\354\364\240\"9_\257\316\207q\006\223\3270\033N~\3406g9\236\273\316\020y\221]dN\225\212\343<\1770\353\335\035\1770_[\234A\234\301\354\2624\347\273\313y\267+\347\345\224\234At\234\301|\3578\231\215\305p\262\003\217y\006\034\274\n\243\334\257{\221@?v^vq\332\276m\234\347\016&\337q\007\363M<=\234\301t"
+	.ascii	"B\336x\362\321v\315\202\230\026dX[/B\347V\016c\2176\3475\200"
+	.ascii	"2\366Ee\313\026?\331\302!`)<\236"
+	.string	"{\257\310\266\2720\027V\343$oa-!\204,\0179-\247\323\236\311\234g-\347\317i\265IF\025\362\002\217\026\"W\276|\2351\024\226R\301\212'\025\254,9>\343)<V\301\212<4\260\214da4N\362\031\223\235\313\330\214\030BH\307\310\031\030\226i\277\344\f\246\017\177\235X\204xNn\324\222m\317U\347\371I\225\223\3612\214\267\226\200\221\273\367^a+\234d1\016;7\341\257[\344\275a\367\336k\360\017\235\305\230\nK\341\340t\357\325\016\rQ\244\274X\243\273\367\206\020\n\321\303t\203ki\332'\235'\341|\003\316#\340d$\203q\362i\254<;\341'\347!\"\257\362\336\013\304C\264\b\207\264\375\320y\216\362\t\206\367r\360\2363\205{\357\335\341\247\231\357\323\003g0-c0\217\344\f\346\311\030L\016H\360\267\226\2377\320#\204\036\200\277\315~v\240\277j\270\030+\340h\274"
+	.string	"\247\002\374}\3015\374\025\210U\370\030\253*?_ \364\r\177\267\371y\304\317\"\346~\206\363\263\bM\200\036\300\317v-\200\237\303\264\005\177\007\375\\B{\350"
+	.string	"\224\360\237\303\205\376nsj"
+	.ascii	"\374\025\004?\223\375<\366\363\331\377\372\327 ?\037\177\376"
+	.ascii	"\372\271\311\317^?+\371\271\353g&??\351\016?_\375\314\365s\222"
+	.ascii	"\346\360?\350\257]\377\271\374\337\362\277K\203\371y\356\357"
+	.ascii	"\n\376\246\340o\r\177O\3607\206\277#\370\277\363\327\266\277"
+	.ascii	"/\374|\367s\335\317j~~\373y\314\317\313\237\277\374\254\3663"
+	.ascii	"\332\317`?C\371Y\305\3171~v\372\371\305\317\367g\025~\376\300"
+	.ascii	"\317\036\3709\205\237\323\237\201?\377~\346\300\377\021\376c"
+	.ascii	"\371Y\003?g\340g"
+	.string	"\f\374\334\301\317\007\370\271\204\237/\360\337\313\317$\374l\201\377\312\237)\360\263\004~\036\341\347\023\377\347\374\\\342\277\b?3\340g\004\374\354\301\317\030\374L\342g\020\377\277\374_\373\237\345?\212\377\007\370\257\366\237wwww\367\333\244\177\007\355\347P&G\346\346Z\315yQ\224\325}\035}\234\270l\204i\363V\243\303\306u\304J\216\023\016\256\323pp\353\276\216;G\214\310\211\021\367N\303\323t\206i3a\372\214y/#\253\240\212\327X\004\361\367\333\373L\267-\333\332\200\351\345\233\355l\355v\n\357\335\240\003i4\202\350a2\006\312\2332o\267\307\371\334\373u\357\345`\212\321\tYk\333dZ\212\365\241\214{\321\366m\272\355?O\017\026\222i\331\266\307h\225ak\342\205\347\256\315\222\264\266\311\026\303ZL.Nz\260\2759\177\2029\377\376\315;,\336{i\350 o\221\311\347\254\303?\\Y"
+	.string	"\377\355\275\006\260\300\275\303+tl\316$dC\035\036\256\316\362^\342\225\220\001WQ\304\253\251&\345\325\025\022\217\b/\024\357\225\260Iy\357\205K$\nOT\335\013M\312\033u[\260E\361E^\t/\261\352^\270\304;\364\320D\274\212jR\016\243.4)\257\242\256\362\352\006]\342\260\350D\274\305\013Wy5w\225UQAM\312\252\250&\345\225\020\266s\002\302\203\006\025\272\037Pl\325D\2743\236\250\206\305\240e\023\262\352\272\335\313a.nQ"
+	.ascii	"\367RU\025\335\206S\\\306\264\234\301teX\305\033\236\230\260"
+	.ascii	"\252.q\331\304Uu/\027\223\212\373\264\201\020\271\274Cx)\364"
+	.ascii	"Aue\270\270\227\202\247{\205|\227\367^\341\275w\247H\205\274"
+	.ascii	"7GP\323\326\323\323\275F\241\247K%4sqo\207\275\225E5)\261\252"
+	.ascii	"\206\314\246(\267\356\013\244\220\267\256\333U\361T\n\301\256"
+	.ascii	"\2145\347V\224\224\032^\235\030\2507m\221=e<\252\324P3cG\244"
+	.ascii	"\262\343\344R\325\310\254\316\247\223\223\255\245\315\314b\004"
+	.ascii	"~\234\221;\357V8"
+	.string	"Cc\203vN6Z\247\3514\335a\022\017hF\021\374FK\022\256m\226+?\313,q\303\265\363;agfa\334\274Qi\333e\r#\306\234&F\246${J\217\325\246;\274\302\240k\253\356\213\356\026\213\"(P\346\311T\333\357\f\253\234l\213\223-+M\345dF\3142\3107TWZ\214\223m\245\303\302x\274\254\216.\306\2347\267\2347\317\316\233\312d+u\336\264\206$I\222\2142f\221V\222\224\001C\376\300u\265\001i\013\245\237p\262\221\355\244\221\367*\347\2320A\366Ww\361\206A\227\310\344\265\025\"\304\316\335\n-\304\230\366\346\215\363f\361\274\351\304\344\303ID\023\373\362:\242`4>i\373>vq\225\006\236\224\224c\216\266\315\325J8\271\241\227\250\021\302\024\325\366\246\360T\341^\336`\362\335\035o0{\205\241w\022\ff\321\210\274a\t(\342\203I\333\332H6\354t\231\365"
+	.string	"\322[:\304#SW2:+\206\221\326\352#\234\354\254&rv\353\"W\314:k\007\353\tF\215\276\002\344r\235\226\257\316\333\371\367\220\236\342y1\231\022g\256\310nx:\367V\275m\315`7\274\024\302\200/4rCN-\003\3132\r\253a7\025Yv\276H\302\220+cFnHV\025w\244[\222\3416\rn\334\3618\324O\t`\002'\327S\315\324M<\"\362F\361\310\336\3205\275\235Y\306\035\351\372\266\220\355\312\342\216\307\2728l\307\023\"/\224\251\265\324 \252\030w\244C\003\367d\026'\234\333"
+	.ascii	"\tr\350=\325P\354\2067D\336\342\016\226\255\270#\335\3377\372"
+	.ascii	"\252}4\217\316\3218\372G\367h\033M\325;\032\253\253\032H[u\220"
+	.ascii	"6\266\220\326\301\311\236j\032o\251\256q\016\302p\033O\030t\231"
+	.ascii	"\304\340\330\272\027\311n\177\006\034\364\024\303\341A\332\326"
+	.ascii	"9'\373\030\230[\221\271\363l\316\246\326\t\241\225\275\241\002"
+	.ascii	"\321\023\204\212\314\f8\257u\007:\332\211\331h[\333T:\037)+:"
+	.ascii	"2\2727\025I\326\214),m\232\3041U7\035\326p3\322\310!c%c^V\304"
+	.ascii	"\240\371\321T5<Mv\313\232\234\231\032/K\346|\322\034Y\202A\366"
+	.ascii	"\030\233\260T"
+	.ascii	"\271\277\246\361\251\272\227\250\303\306\351\211.M\215kR\003"
+	.ascii	"\210\021\036\2638Jl\264e'C\257p\326\207\033\250\025\304\316W"
+	.ascii	"7\256o\311\372V\335\204\256}*\326}\035\3232Sk\232\234\325\255"
+	.ascii	"y\307\017=\344\226\224\312\246\302\234*H\332\276\226\3416\023"
+	.ascii	"\356E^\350R\354\3216\203\241W2\3461\213\025\0346\256c\352\230"
+	.ascii	"\312&t\205s\tHR\345E\004gA\221\272\333q6W6\023\371\345\003\005"
+	.ascii	"U\244j\271\374\021\366\023g\274B\332\236'\\[\253_\266\224Y\200"
+	.ascii	"\"\233\243\306;\313\002fNL\332\253ZZ\205r\202\013\013@\304`\221"
+	.ascii	"\2631\224\263\243m\345R\273\324-UK\r\301O2\371\212%Y\321@\030"
+	.ascii	"\2075<x\311\361\231\2649^\332\236!\225S\270\346\332\376\207\310"
+	.ascii	"YV\3118Y\315\352X\223\034\325\f\013\007\214\032t\030PC\003\307"
+	.ascii	"\264\377\211:\253\225z\205\007M\206\030*1\013B\330\262\224\264"
+	.ascii	"\355*;_Eb\225\260:\307\013\232\023\025\020\234\261\362j[\247"
+	.ascii	"\234.~\206\037x\336\242\300\025i\373:\345\257R\370\255e\3500"
+	.ascii	"\246i\313\203\032zU\266V\230\232\232\032\030X{\351\240K\304z"
+	.ascii	"R\026G\345b\252\311y\366\342\372\364\312\203\223\365\251B\031"
+	.ascii	"b\272C&\004hRF%\242\247\324\270F\332>A\022w\206e\310p9r\236\277"
+	.ascii	"\254*\026\032\037g\204T\"K\300\310\375\250W_or]\325H\345\342"
+	.ascii	"\2451\350\022\307\350\344jW\r\342\346U\235\324\257\312\244.\251"
+	.ascii	"\307\332\204\223\265\253\026y\355Q\253.T\273*\0203@l\232P\231"
+	.ascii	"\n\262V\207\343\300\324\344\200'qI\252\022NV\256\013U\256\232"
+	.ascii	"UW\340\245\021yi\364`\231ccC\267!\304\217\2321n:\314\025*\222"
+	.ascii	"+\310 k\332\326\255\035\343\224Z\213\031G8Y\265\3166G\2638\207"
+	.ascii	"\323B\004\313'\306y\237\026\347{\350\316:\344l\223\333\361E\315"
+	.ascii	"\371\236\270\363=e\316\367\260\235\357\351r\276'\r\253^)\273"
+	.ascii	"\260\371R\257\270\255\305\254\311`2;\033\004c0k\216JUw\374<@"
+	.ascii	"L\312\200\210U9_u\214@\004\214X[[\215\2578~\236V\323\332zR\236"
+	.ascii	"\2577\352\324\317\303s;R\005\354\353|\265\241#v\307\006G\333"
+	.ascii	"Z\343t\321s\344\203\205\035c=t\264}\255\361W(FS\245L\270\227"
+	.ascii	"\350\201\2739o\332\326\250J\343U\252\026o\225\332\240\352\336"
+	.ascii	"a\225\002\222s\357\020\210\331\002f\013,\023,-+\246}\317\220"
+	.ascii	"\363\2071\230\\6\364:\243\347K\b\344\240\264}O\213\032\243\306"
+	.ascii	"\020Zs\353\276\350\252\221"
+	.string	"\254\bw\376\325)Y\235\332\013\t'Yr\r\350\206\371\212#V\207uX_\234\267n\013\016\r*\260\352\342\365\005\317\f.m\267mm\301R\316\336\272\216\264\255D\266C\342%M\\\333\312\304v\247R*Kia\253\336z[\315ZY\335\027\335\311e\006\212\033\243\235]\037\257C\274>\216[?H\230Haj{\0134\344p\262\345p\033G\271P\026^Di\311\321\335\273E\204\235\223\206\314\220\270\263\256\256\323\264]\331\362\322\006\206\326\305\215\233\246\023J\373a#V9\323o\336tl\345\032\215\260i\206\313\352E\222\3159\331l\272\213\003\252\256\224\207$H\243\210nS\263\002\027h\332KQ\240i\317Hi\211\002\037\0220\r\222@\215\226\222\212|H$\200\301%\022\023$%-\371|?\337NJdv\340\007T\221\376|;)zh\222M\321\340\nt\205\351C\3525\340'\210\256\350\215\0204z"
+	.string	"\020\t\026\332\204\021\232\002\177JJKA\n*\350\020$z/\355\031\245h\220g\342D\211$\245\025h\t\005`\241\3643\021\200T\211\304\221\022\206\"\337R\b)\032\354\361\245\350T'Ht\244\344\223\022\371\216\224t|GJUEz\344C\223L\324\003HA\033\f\242@#\243\336\016\013\245_\221\005\246J\325\b\365\035!%\365v\214\320\340\222-B\203;\007\022\035)\215\370\001\366T\024Y\026\3004\210t\204N`"
+	.ascii	"\032,\320\271\212\021$\214\222\220\226N\330\200\032\375D8Z:\001"
+	.ascii	"5\3421q\242\004\006\025A\024\230\002\235\300\n\024\022\244H\276"
+	.ascii	"\007\2308Q\002C\212\006/`0\"\005\366\224F\030\365\320\thx\021"
+	.ascii	"\022\020\365\241G\3477\350\340\202\016<Ha\347\036|\200\301\007"
+	.ascii	"\030\230\367\340\203\241\241\017:\030:\337\301PMS\241T\202\364"
+	.ascii	"*F\244 \341\373\255X\361+\252\200\003\034$\032J\225z\202:@4M"
+	.ascii	"B\n!\355\201\200Td\324\373A\211\214\036\020\204\202\003\232\324"
+	.ascii	"+\n\352"
+	.string	"\244h0E\212\237i\342D\211\t\256bD\220\350\b)\205\357\227B\317\207\264\"\202\016\244>4\210\002\225\322\237oC\021\nI?(Q\004(\221\004h\021p\351\207\"\002\026)RQO\251w\002P\332\003\241\002hp\351'\351\367\003\201H'\230\002\321\244\022&\320\340\222\004>\264\b\210\222\240\264b)\350\373\025q\b\"\005Q \232\006Y\250\340\245D\035\f\235\350Q/M\372\241\220\224\204\026%%-\245\300\220\372\226~&\222\222P\023,\200h\232\366@@\213\200\277\024\031X\364\222\224\202H\022\244\275\023\220~\216|H>`\317\002\023$\365\212\220R$\240\t\340/\004\337\017)\355\001\227NhH\211<H}HK;F?$ JB\n%\b\034\365P\244\275\023P\bJ\203D\2744\210\246=\b\360\202DI\275\245\024\210T\001\n\322\253\350\360\237\022\n$\221\376~@\022=!\360\004\211J\210"
+	.string	"DST\204\nJ\2548\321\264\227\242\360u\240\007<\241\242\267\342'%\312@\203\324\207\264\363\241!\023\036(0B\003\316\242\021\251\017\005\002\227\212H\004\201\277\240\017\r\222\360!\365V\220(\002\006I\214\340\200\036\365\200\250\322\212\336\251uFx\005J\315\0029\020\233\305\267x\257\2315r\233%\302\016\0279\332Z!\266HW\013-c\021K\244\256\256E\021\313\317\r7\345\023;\204\303\232\260\216^mm\020(\244\0329\257\037=\326\243\225\305\250\306G\235e[\023\247\r\253\336\355$\031\036\357\256\2724\226d\026\r\253N\253wv;\244\252l\024o\t\345nH\217\36625e\312\313\362\250_x\3071*`vGE\343\322\364f\210\245\262:n\231)^\252X\035\277\305asT)\023\306\326\244"
+	.string	"i\013\2023\230:\306)\242($mmo\247\244L\230\223\025\003L[kc\350\366\006"
+	.ascii	"\260\244\231\265\335\2615\254T\016\253\0370\254\224\222gL\b\021"
+	.ascii	"\271\266\027\336\266\260B\033U\311\370\\a\224\013\265C\306%N"
+	.ascii	"\r\272\333d\004\321\003\026\003,\214\225q\033u[\314\200\203\303"
+	.ascii	"\035\227\220\031\266\265P\2673\214kgrOvF\222\037\312\256\034"
+	.ascii	"\347/\210r#*\252\255\215q\270s\301\311\230kka<\315X\206.\210"
+	.ascii	"u\372\027,1Lm\255\013\373\202\223W\263M\347\235\275\250\242&"
+	.ascii	"u\036\004|5\3232\335\022\317x\374\270\212q\376vh\205\214\216"
+	.ascii	"\255\266\007rq\236w'GN\275\023:\257\2236*\271\0374'lp\354^\357"
+	.ascii	"\310\254\225\033\216\203,\250\202\3218H\362\024C\206HfD4I\222"
+	.ascii	"\306\362\t\020\204ca\246\347)>\022\200\004A\3141\347\230\241"
+	.ascii	"\021\021\021\221\024$e\2452\214\001]S\340\364\363\034\201#\332"
+	.ascii	"\276E\206\210\026H^"
+	.ascii	"\374G\fI\270w\034\\\261m\270\340\355\024Iy\266Yuy@\216\211\307"
+	.ascii	"\366S\273X\225\031j\2119I\266\005*v\265\343\007lO\375\267\341"
+	.ascii	"B\226)"
+	.string	"\027{\371\346\207g\225\f9=n\316k\256c\257@\234e}\341k\277\306=l\223\237\026o\034g\020}\331\210\306\t\357\270\013t>\271\210\347\037\263\035}\354\332\364K\353-3\245\0332\3464$\246\257)\245OKY\034\r\276\336\215$\nu\246\252\372\316&R\331\330\373\026\216\210T\254\f0\037\352kXb\213M\265\t&l\277C\272\0030\024\343d\354\241\352\362\022M!\356\366\314j\325i]l\301\225\323\310u\260\271\tS\221\231P\023M\b\207F\023:\241\351\373i\207\361\0325`K\363Z2\305\201\032\30225\017\275\302\212\241`\273i\035F0\346\373%\263\350\007\b\341\3608]/\204O\242\225\r$-\325\216\225\371\343\t\307\321.\215M&\322F\237\277\235v\007\351\277\203~\201\211[\227\377H\030!\013\320\022\027\317`\272l\007\376S\265\203-\312\304\357\"\251\207\263^\245\233\312\342\346\230\f"
+	.ascii	"P\004\"QY\350\023\334W)\356\326\344\300\0302\032\313\333\262"
+	.ascii	"q\322q9\371\201]\374,HN\365=\002"
+	.string	"@+8\370\177+\266\214\346PI=\311\272\200\2039\224\231\341\210\257]/\334\275\025csC\366\357}\345\035\3052\003\002\230\354\275\321\250{\230\034\303\016%r\3050\226\364+\033\312^\030\335\331#(\373\347!#\201W\366z$\347E\020;OL\fA\242\206.\351*\216\020BDm=\212\b\032\rJgT\317\244\207\213\273\251lp\333\230\370[\002\204bZ\352\371\032\333\233P}P\303\230a\002R#\362\367\0309\240\343\251F\255k\353<D-\200<y\207\306sG\312\273I]\342D!\371\210GN\241\346\336\342\373\213\001\253\214\363|\023\236e\336tb\341\260Z\374\301l\315\257\312a\337O\201\200\226,o\335\377\252a\031b\037t\332[\001\345\320R~J\031\242\202\214\006s\270\331\331\375\b\364\300\342\024\321>\317\262\370\t \374\204\276';E\347\177\310(?\250\245\255\326fT\203p\001\343\237c"
+	.ascii	"\005\356\003X\004\022\330\206\214\307\212\f'G\032\301\367]S\025"
+	.ascii	"\337W\245r\3713!\2411p\351E\317\364d"
+	.string	"A~\246\272\244W\216\313\024O.\371nS\272\311\310\336\362\254\323\213\306\344\316\022\306\355\032q\032G/4\352\301\372\367\n\307{\036\257\237\222\316\311x\377cu\254\354\334E\221\260Q\303\245}\347.\027v-\263\321\247\276\005\225/\016wE_\242;2v\373\230\320\274\223\363b\221\340'\306\244\264TqF\021\361\251`\363\216\352c\260.j\311\241\025\206X!\251\026c5BQ\352* \016\376he\004\274%X\305\266\024d\342^\033\313\234\027\327\366\345|T\024\026!\234\225\362P\241P\320Q\230\006\030\037\375\313\266=\277re\005& !\215\023X\\\214`\n\221\031U\304\373\270}sD\264\276\341\\~\232\223\210n\310\236\020\303\344z\274M\n\020\301\231\024\001\312s\224\262\220\344\0014\317\321\321\017\321\204]\177\300\371\304\023\226a\223\340\300\223\200)6\270\202\017\370\245[\021kyJr*Q\333]\331"
+	.ascii	"\214\306{\330]\"\016\274:\237\017\225I\253l8\305z3\2030(#\371"
+	.ascii	"\353\026\"A\212\317-\330P&\320\343\001\376\375-PGfA5\231q\022"
+	.ascii	"j\357\273\361\314\375\375\303\231I\231\363iK\021-]\363\2321\233"
+	.ascii	"0{\f\272\372\207\r C@\350\0038\016J&\263&\242T\205\030v\357\364"
+	.ascii	"\333I\327\345T\003<\323\366\037\353b3\366\300\370\3046\300|\230"
+	.ascii	"H\033\266\016\252\364\316g\2005\247\327\352\221\n\206\357X\254"
+	.ascii	"\002\022O\226jD\273\347\024mix\365\307\334D\334\261\021Nb\002"
+	.ascii	"\035\351P\261a\006\203\205\243\370\357\370\256`}\200\035\370"
+	.ascii	"\206\001\206\215)\325\351\265\310\325\257\213]\250\313\312\212"
+	.ascii	"\264R\325\302\245\207\326\002\232#\244\3216>e\361b\364br\310"
+	.ascii	"\302eC=gK/\004L\357\022d\351\347\362\354=F>\363\244\302\252"
+	.string	"*\366\274\377y\367\345\031\200\314\026W\247\3035\331\013E\223-\300-7\004\220l\266(@\242\257LI\244@\230\301\363\f0\315)\352S\202u\303\256P\200\313\251\020|\263\310\bU\205\267z\227\336\212\3116\005\274A\201\f\357\033\354Q\256\323\026\214\277\\|\303\210f\324\312\332\203{m\366LJ\327/ F\036\346\353\323z1\003\232\002\271\205\267*\256\007\230#\343;\264\276\227Db*d\274Jn\356\312R\033\253U\214\202\212EP\020\331\203\216A\360\311\0257\246\250N\356\330\301K\340U\002\370\224O\345\232\206B\345D\350A\255\327\262\224x\277xE8\207\215\207\2126\344\260e\213v\324s7\213\263\b5\201\"\317\272\314\2052K\177G\255\033\347\253@K\2726\344\307\266sK\364\3013g\266\234?\001z{\323\375\334\336\226&\\\n@\210'\371\240\021\303\034B\336A\201{\373\220\0302\275@\346X"
+	.ascii	"+\017\314\231\223\3033\025\205R-\007\342*L\360\265\340\300\034"
+	.ascii	"o\310\342\331\025\230\216\347\335\261\025\374G\004\026oe|f\314"
+	.ascii	"\034\361\344?~Z\356\203\375D\353\177cC\361\305V\352\317\302\365"
+	.ascii	"\200]|DbD\366W\342\302\246m\345\260z\3249\361dp\306W_y9D\211"
+	.ascii	"\226\354\351\270\303\351\361iH\206D\366 \213T\267,\017\307\367"
+	.ascii	"g\261{\330)\266\303\246\305\017\035Gl\272[\334\262\004\231\004"
+	.ascii	"\267\f}\215\331\271\322\362\256\007{\027\016\206\273\346\205"
+	.ascii	"\013\367\023\236\352\257^A:\250\307/\331z\352]50\367\364\b\363"
+	.ascii	"f\361R\371\025\270\351\274D\371~n\221\302I\"\337\325+r|\267\270"
+	.ascii	"R\337#\366&\204\332s\373p\231\343\366Mg\3057\305\333=\314\303"
+	.ascii	"\344\\\226\036\302\247\236\\V\344-:\322\\\255\177+\232\316\323"
+	.ascii	"\357\b\370Me\210\205\315\\\357\247\262\016\0222\006\362\245j"
+	.ascii	"v1\271\006\352\225a8\331~\200\373\340\030\371/\246\322!\353A"
+	.ascii	"\363\240\247\036g\257n\005"
+	.text
+	.section	.gnu.lto_.symtab.71b3b78599d70d61,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.71b3b78599d70d61,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
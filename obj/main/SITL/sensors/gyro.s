@@ -0,0 +1,2223 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	" "
+	.string	"&"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\203\005\005\025"
+	.string	"\206X_H\320VM\032\003\320&\027I\003\240\227\016o\r\242\221\363\366A\031_\033\242\266\264\346\006\305b\261\022\317\210/o\232^8J=8\340\213\305(\365\021~\263X\211\321E\027-p\024\315\244\033Qw[\334D\222\275\311Nd\007B"
+	.string	"E"
+	.string	"R"
+	.string	"\317S\3060std\300j\275\326\267\353\335s\356\371\023x\0076\304\247[\216\356\353\315\242$:0s\223\025\004\r\221\032nn:\235o\227\250\013\240\030\216\246\275\214\361\265\343,\032rn\264bK\244\033\0020\025\240\367\243\270\277\301wg\254\350\200B\345[\005\234g\365B\342\264&|\270b_\275\246\246\207&;V\336\376,i\r\231J\337\353-\367{\377>\311\217\356\0357\275[ \t\341\310dH\365Z\"-\037-\003\007\366\245\363\037\241\311b\204\310a\340\022\"fz\024H\235\002\247\022\030\037x\f\270\220!\210\345#\340\021\024U\215\230"
+	.string	"\334\334)\354\234"
+	.string	"\211\262\003\200\232`f17\341\034d\204X+s\032\301\322\013\226\353'\265\275\2756Td\303\203B\275\033E\222\"1\345\325z\335T\240 [4\234\250\\\366\335N5{\302\244e\036\253y\261\304\356D\220J\310\204i\n\262z\375\220\020a\266\350\261q\004\202\034\021\321\270\214<p g\350\"_\212\330\350h\020.\017_y\253=3 \026\f\366\335F\317\340 \222-P\220"
+	.string	"A\200\226\250!2\031\221\251 IR\030\306p\202)\262\0327\022\300\264\025\307\204\2041\023\020)-2\217J\2265\3438t\2212\027\243\177\277\373\253\233\315m\314ZN*y*\b\276\237i\277\316\201\356|.]\266\203+\222\350\365\2001\354\231\004\277\225n\266\222,\261H\377\031\022ic\371N$y\034\005\336\2108q\250\273\247\205\225\270\347H\336\276\253\236R97Z^\213\0357A\260=#O`P}\313\324\316\274\344\377C\345\n\361\267p\027\372 \003\301 \325=\372\226f\324\346+\230F\305\251\202\226\n\2634\244\265q\274\243\203i\003X\32644\340\230\331\303\252\320|\303\373\357\024\373\333\314\203Nm\371\245A5+@\220\312\2266\342\343\241\001\360\366\255y\370\222\t\364\360"
+	.ascii	"`(\257\264\031\300\r\262\272j6\177\321\254\215\031\210\363\230"
+	.ascii	"\325\361^\255u\016\013\177\302^,\206qH\003\340\2369\256\351T"
+	.ascii	"\232\365\034>\",\021d\271\207\300]\037\374\332\370\236\266\204"
+	.ascii	"y\267\330K\306\035\202\333~\242^="
+	.text
+	.section	.gnu.lto_.ipa_sra.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"\235\005"
+	.string	"b\306\023\035pM\322\001\374\377\271\372\377\377\377/\311\316\030\313A\222$I\022\027\035\030\270F\344N)\256\372\305R\241\314\311\224\314\310B\366Qs|c\027\257\320\231XD9\017K\206w\245/L\302\034\350&\314\265\202:"
+	.ascii	"\210\366/\350\321i^\206g\002/ \260\202A\"zi\004\205\323\007\003"
+	.ascii	"1\350T\342\242F\253r\304saf\224>\210w\240\022\274\337[\252\t"
+	.ascii	"\240\204x\360\203\013\370KV_q\334\004\354\310\346\030\r\226\013"
+	.ascii	"\214!\305X\2059\003\n\002\020f\270\222\t\004\204\3311\331\n\033"
+	.ascii	"\272;Bc\207\267+7k3Si\r\241\r\206..\324\020"
+	.text
+	.section	.gnu.lto_.inline.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`X\b5 "
+	.string	"\026n\234K\260\022R:\231o#\274\222\327\260\246?X\3371\250H\343\357\216zAo\026\336G\256\373Cop\335\236\357j\277\240\205M\"V\370\321\177\037y\303\217\374\231s\315\354\354!\343\252\252x\225[\177\207[\351K\272\215\214\374-\345N\001\211"
+	.string	"\202"
+	.string	"\214"
+	.ascii	"\257\027\366\264\357vE\017\"F\265\307gC\320\311o\303.\202\270"
+	.ascii	"\216\340\224\377kK_\320\332\346\320\377\264BY[ \345\363\315f"
+	.ascii	"\t\021>}\307gT7\244?=\031g{\2045HP\026\030vHG\213.\352s\312V"
+	.ascii	"7\274nhR\336\254\225P\313\307\f\0163]\265\317\233\316\330\007"
+	.ascii	"\242S\326F\021\235\262V\016\343mww\371\324\335\n\366g\037\003"
+	.ascii	"\235\356\327\307H\335\215\373}\273\325\335+\373\323\032\036v"
+	.ascii	"\267\355wyL&k\226]\373\265\277\275\375\245H\332\264cb\276\021"
+	.ascii	"\276\333\347\236\243}i_\232\245\214\354\356\330\277cF\371_\362"
+	.ascii	"\026Y\221\217;\213\374\233\254\371\270s\310\277\305\256\370\270"
+	.ascii	"\245\377\331\374\333R\252Dm\013\374g\3151J\241\264m\316e\347"
+	.ascii	"\337\nM\004\221q\273\311\336\360\025U\211/\230\263dguVct\035"
+	.ascii	"9\311\354\210\024Q"
+	.string	"L\022N\032\311\222l\375V\013\353\241\003P\221__i\230\350(4\344\344\225\026;\0062T%\302<\355<6\002\224\303\306Kn)\f\232\333\234\3530\225\271\005\236\273\212N\034q\257=\030\3028e\244\342[dw\220v\226\252\241\273wT\232?\200\366\266W\270\376\027P\362\330\350\307QH\306\201gT\201h\232\341\237\236m\366\353H\244z\362*5\347^\245\234=.v\357\304\216\002\253\233\\JBa\376\275\375I\"\031\317\312\315wY\372[\036*\034X)?1\353\177\262i\366M\232\215*\202E\2647\373\274\205=\377\377\372\035\033\247\214V\262)\343\224\n\024_\217\311!\\7\f\336\350\3461\377\240\2672\234y\030\036\033X\356\001\270\203\006\f\376\363xA\261\2733\354\277\216D\250'I\212\t\350\353\353\327\374\326\002Hz\252\243T\022X\340w\350H\204:\217`\213\272\373e\257\325\335,?p\016"
+	.ascii	"\3731\324R\322\321\322\260\341\037\343\020\017\232|\316\311k"
+	.ascii	"Kj\002\377xmI\341~\373\254\322S\256\376q\020\331\375\250\267"
+	.ascii	"\364\216\354\266\377\001\200\270\250\021\265C\206\031*MR\222"
+	.ascii	",\007`\002\231\251\261\352\006\022`e)\006bG\212\210\214\224("
+	.ascii	"HARP\251L"
+	.string	"\233\001\267!\215\357\371w\217\324\036\275\262\307\246\260\030E\244\360\232\006\356q\037\027\266\230\024\032\320\234+\330\201\360>*\277l(\322l\227\340\3018=h\201\361\344u\315\t\325\372\225\271\006]\0248Ty\243@}\017\271[\002b[q>\364\033Yx`\235\232<\272\314\304\302\3115wy\313\315\242\241/\266z3\360c\375R\350\225'\343 \243\300\251p\271\021@o\212\340w\205\267\026\355\355=>}\312d\370F\201\313\323N\273\005\312\340\335^\362\260\367\026\221W\202\t\024V\375HHQ\331,\233`^l\340\210\371q\216\0058<\226\230\261\320\017&\253\356%'r\216\212D\375\236\213\325\220\"[\f\307\016\004%p\377\263\225\215\327\237\332\352}\252\242`\271\030\213\250\013u?\267\204\365&\250\207Z\244?\031d\2107\345zj\021\323\037\253\0052\272\351\037\277o\r\234\030\f;\370\201\026'\013_}'"
+	.ascii	"\352\261\201z\233$@\273\016\272LC\347e\366^\226\037\225=\363"
+	.ascii	"\214\307\322\375\351S\221\226\032.\b\234;\3318\007c\351\356\272"
+	.ascii	"\376\370\214\323\221\flo\204M\030\201\n\244\306\327\343\251\213"
+	.ascii	"\355\t\232\314\241\332\034z\355\177\2042\037D\t8\250\035Oi+\272"
+	.ascii	"9f{\342\\\262q\266\274\240\226\356<$?\350\020cD\207\025\265u"
+	.ascii	"v"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\037\005\375\r"
+	.string	"\226Q81`m\322\0010\f\3030\fR\245\006G.0\273\226I\022\226\312:\325h\r\303\320=\212)V\203xt\216>\006\032j\033D\177\333\256\214{\247\224\002'"
+	.string	")"
+	.string	","
+	.string	"\265s\004\377\3133zR\354\013\274\235\270\304&1&\323\034\2649x\267s\346j\346\334\2626"
+	.string	"@c?\227\335\205b%\306\266\354~\236\320\236\360\366zm*`RkY\030\026w\333\376d\225\372y\300\265v\342\032\213\b\"\350\231\222\344\024\301\277\001\315\363\311*9J\255C\035Y\245G\251uq\346\332GV\tRja\353\f\301_s\337Nh\213\200\271\264=\220\336e\033P\336{/\315<\227M1ML\233\214D\033\321B\264\017\016\313U`g\363\\\314\rf\f\020\344\314@\213FV\271Qji\376\333\230V\241y\240O\\\250\201I#D#M\222i\rP\002!\307l\365\022"
+	.ascii	"\362!\210()E$#\204 \201T$%\246P\365\243\003\020*^\243E&\255\361"
+	.ascii	"\300:\313\255\361\006\303\215\364S\230q\264\275\016_UO\373H\020"
+	.ascii	"\016\013Qw\246l\253E\234$\201L\260\022\326\225\234\313\314j8"
+	.ascii	"\245\272\303\272\310\213u\027\213\345\355\3725\215\211$\026\251"
+	.ascii	"\013\372\364,\215\"\215H\035 \n)\032\261K\261\227\212\f\340%"
+	.ascii	"\037\320\202bX)\276\373\025`\235mM\006\346\243\341\351\322K\324"
+	.ascii	" \243\243\017\267\300i\230G2P>-p\246\243\330\307(H\322kz\201"
+	.ascii	"\r\357\221\276\233ZB\330\025;\332\331\3029c\030\247\337k\031"
+	.ascii	"\t`\3404\251\276{}4\354q\230\f\343?\034pF7A\271\234\366S\316"
+	.ascii	"=\001"
+	.text
+	.section	.gnu.lto_.pureconst.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 _\255\002"
+	.string	"\362E\024\036p\211\322\001\374\353H\256\376\357\252\252\252D"
+	.string	"\nR\033\364\210o\377\333\377\301\216\001s\273\003\267q\031?\026\243bL\214\210\361p\r\267p\022\356\340\006n\200\361:\255Y5\243\356tJ\263\350\204\316\347:\2679\231\333r\225\233\\\344<\301\3359\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\312\002\375\f"
+	.string	"6\02151`U\223\341\024CG\3020e\333Z\302%\t\013d\035\206a\030\246\320\347e\267{9dw\375\361(-~bQH}^\253\034a\273\203\026m)S$"
+	.string	"$"
+	.string	"."
+	.string	"\215\035\363\326\b\232*\261\202\346\2141"
+	.string	"9\346\216=\017\370\253\346\346\233\3067\357\026]s\312#\017N\275"
+	.ascii	"\004\224G\265k\242\217;\371\251\374B\362\354\224\221y)\277\f"
+	.ascii	"\331\225;b\3121\235Ty\247}I*C\f\335\002D\250\b\204x0i\020\315"
+	.ascii	"\330\244\312\3400\224c\364\367[\240\205U\260\344i\334\304Bu\323"
+	.ascii	"\006\246\2565\004\224\366\316U\366\364\312E\252\312\005\223\342"
+	.ascii	"\237\370G\211L\304CL\017;\374z5\374\231\331\341\247\3743Y~\205"
+	.ascii	"\237\036Vl\224s:5\230P\t\362\002a\2501=\223\3124)H\246\315P\002"
+	.ascii	"AL\231y\022\2006-\304%e\245(\225\373g\031$h\206\320[a\247q\212"
+	.ascii	"|v\271\301p\337\353{\341\2172{\346\354\205\301\0263c\336\350"
+	.ascii	"s\266\301\212\t5\372D\020\301O\022\324\307;Y8@V\263\265\025\255"
+	.ascii	"n\022\347\301\340\035\330m@\337\365\305K^\373@a\267\323\251l"
+	.ascii	"n\220F@\205s\353\270\277\227Y\335b\"\342a\222J'gO\366,\002\275"
+	.ascii	"vpp\227\214\217\213\357*2\017\n\017\200\345\022\r:\233\224\013"
+	.ascii	"\254>g*k\t\315+\337a;F\031d!\031\026\001\006\233\027\216\200"
+	.ascii	"3oI\300\320w\233\005\304\\SS\025\001t\252S0\323\231\377\253\254"
+	.ascii	"\240\372\0011"
+	.text
+	.section	.gnu.lto_.lto.4be8279ffca50d5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.67.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 \237\235\004"
+	.string	"D\bk"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\303\347\321\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\335\006us\366\005uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\212\240\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.68.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`i\003\245\020"
+	.string	"\226\032eH\320\024q:\253p_\263\027"
+	.string	"1\n\253\004\307\035\025\213L\211m\252\346\tXh\022E,1K\344\341\260\222\236}Ai/J\222\361\260\r\372h`\006\370-\214\351!\253d\342j\204\253\261\367\026\270H\325\307&Y\262S\nH"
+	.string	"Q"
+	.string	"W"
+	.string	"\266_\355\273\356\"\365\232\227\007\330m\351\340\354\242\007l@t\316\350\007t\347D\027\320\235s\3126r\024\305>\306\017\021\260tw\301\355\304S\257)\377/>\202\221Q\275z\fv\327\025Ff\346\336n\273\200\355\004v\310\013\342k\250~Ns\370\214\321\212Y\212\340eg\223\207\225"
+	.ascii	"hf'\320\315\316\366\360\227)\332]\005>\214\017 P|R\234\363_\272"
+	.ascii	"s\341\b\032\3135[\325\232\215\252\352f\302~h\267\226\375\232"
+	.ascii	"\277\246\254\224He\004\226\354\306\324h\033\343rT|\001/b\362"
+	.ascii	"\3108QX+\037\022\276`AnW\270\017\013X\330\331\026.$\234\261\251"
+	.ascii	"\027\316SzH"
+	.string	"l0<VK3\034\310N\355\354q\233\345>\314\217&(%]g'\350,\235\307\202\030\",\227\351;<\031\3206;=\207\326r\034\332\233\270\374\206\231\343\3474n\007\246\223\006\224\330\340\304$\025q4M 9\212$\252D\202\250\023\213\013H\032IP%\305\342\206\322\bv\020\305\021\374\320}h\267\026\204\026\261\325\026\302\356qp&-$zX\256?\270\022\033'\027\341I\312\327\215\204\313\312ous\352\270=\341GR\034\267)\004@\2501 \214\244(\030\223\362M:\360\002\021\261\332\006\021`LL\210\200P<\245\345\001XF\r\254\326\312L\274\201^Qgz\324\261]\025\b*\351\022/\215\235\321\305\354\252V\r;\034\2360\343s\270\321pL\346}h\242D\231w\n\3051\034\327Q\017\365C\032\304\f\2117\236\360j\203\251\351LUUZ\232\315\005\232Z'\326$#\253;\3534a\215:"
+	.ascii	"\315\314\n\304\177!C5"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.69.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\375\b"
+	.string	"F\021?8@\217\322\001\2305\360\205\252\023X\270\324\242\b\374\201\233\331\332\033O#\345\336\332\257\327\007m\260]\303Rt\237\3441\216k%\b\274\002\235uW\206\320l\277%\233\354\235R."
+	.string	"/"
+	.string	"."
+	.string	"\266\023\026J6\275{\2652\262\215\325\t\314n'\241\307M\177&\377$\217)\037/,\327\351/\323\260\273~,\227\306\ro\373\300\266\202mY\217\033n\305\343\262\333\232\305\254J\214\205\330.\331\034\333\357\331\027\371H\351\034\211"
+	.string	"`U\260\f\224\335\016\301\036\315\243\273\013l\217\232\007l\217\016)\317\303F\035\026\273\336\244B\263\253b(\271\260\030x\201<\372\244\355\361\260\323\302\241\336\314\356N\017v\330\327vw\r9\254\235\373!|\016tVQ\310ac\320gR\f\bY\351\254\242P\225\242\210\007\t\t\242U~\n<'BTR\314I%\247\333[\203\006(\230\262?\332\0165\270\311V\261\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\324\263\214\313(\233\206"
+	.ascii	"Cu\bc\272&\031"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.70.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`1\002%\021"
+	.string	"\366\036lF\360\260(\035\352\0202\214\234\013o\255\330\225\225\353\347\020Bg\225\306<\351\264\251R!IY\231\236\241\344\204\265\375\205\360\204W-\377\3552}\304\235\364Lzy\361\341\230\024\016\206w\306\031+DY#{o)S\nX"
+	.string	"R"
+	.string	"\\"
+	.ascii	"(\037\3418\023\003f\316\311=\332(6\367\250v\212\315Y\301\202"
+	.ascii	"\024\227\376\275\254l:\035T4;s~\335rx\3512\302\325\222\357\301"
+	.ascii	"2]zX\036\023\270\200\2179\314y\335X\261X\276*))\340%\363\340"
+	.ascii	"\301B\255n\2379\247u\305j\335\333mC\260m\300V\f\001\272\303v"
+	.ascii	"\311Kx\2369g\210?s\022\023\374\017\217&\235\350W'\362\361\373"
+	.ascii	"\230\177\264d8`'\255\331\037J\327e\177k\265\032\016\257\006\333"
+	.ascii	"j\017ToP-\255\216V\257\325\272\352\003\340Z4\020\340\314\271"
+	.ascii	"R\3131g\304X\b\333\377\024\247\3452\207\005'\340\272@Rn\\\251"
+	.ascii	"\243\212\241>\213\274\005\350\243\306\347\320Y\210\006\274\314"
+	.ascii	"\231\nY\361\233\021\022X\363\b\362Q\356\277\253\315\205\035\027"
+	.ascii	"\231\323\334\037\223\352\370K\366\232\355\272|\033_\205i*\243"
+	.ascii	"Ek|\024\246)\214\234\277\200|\274\t\333\264m\315`\3464\335\205"
+	.ascii	"\246\253y\200\313\220\n\016\201x\243\n#\035i\344\221LD\244\316"
+	.ascii	"\204\004T\322\205F\244\016\204\200=\t\242QG\301\363F\035\367"
+	.ascii	"\235\016'\214\272\r6@\017\003\025\020\252\233\215\273k\301\366"
+	.ascii	"\256?\247EA\031@m\007\017\364+\375\240\326\344\247\210\353\212"
+	.ascii	"}[\017\314\"\307\2019\364\331\213\3136\021\333\036\366\273l\004"
+	.ascii	"1 \240\002\0312\353\006F24X\212P \301\333\0136\220;\257\031s"
+	.ascii	"\325\235t\253i\301Q\320\266\206\350\215!\211\335\2029\260\230"
+	.ascii	"\350\344o&a\021\324\324\314J8fJ\261P^<\322\222u\365\002\023K"
+	.ascii	"\367\005\310\276b\267\272-\246m\307\267\351\275\244\255\353\002"
+	.ascii	"\016\343,K\021\247\313\\8\346\302\333;\nM\340\220\373\220f\314"
+	.ascii	"\335(8\321\271\346\t"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.75.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`B\005\265\035"
+	.string	"\206\362\264J\260\324Q:x,`\315\0348\032\301\362\004i\232\206\024]|gp>\270\347\034q\333\276:P\006=L]\302\365\321n \374s`\374Y\217\246\344]I\362\311\032\371\3170l8\262\334\355\033\276\225\352\267\377m\237\220\330-S\n\234"
+	.string	"\221"
+	.string	"\245"
+	.string	"\316\020\302\356\261i/\227f{\327^\300\340\347J>"
+	.string	"\256\325\245d\244\326c\002\033\210\275\364\217\235\365#R}R\313\210dW\255uG_\374\3475\332L\026;\315\022F\367\307\237\r\201^#\236V%$\262\330\331\214,\327\242h\305c\257\022\252H~&I\230bO\243\233\264\210\253\311\352ih\364\022\266\340i\bu\033\016\301l5\262\222\216\024\2610\330\201\"\222\023:\252#\254'\t\211KoC!\330\200Z\353\227\276$\206\301\335\323A\255\325K4,\272m\267-e\373\201]\316\004_\024\311\213J\024\214\032y\374\024\302\237\336\303\307\217a\035\337\236\310g\276<-"
+	.ascii	"#E\320~}k\255@\324>&\245_z\016\231\203J\213I\024\241\365\262"
+	.ascii	"\217\301\245F\373\260J]\350\316u\314\271\2069\327/\273\316\355"
+	.ascii	"\332\305\\\343"
+	.string	"\312\365m\327\266s];\327\264s=\333\265l\3271s}\226k\363J?\375\372\002\004`\025\211\306-\324\352XM|e\251KJ!2l\337iG\262$\322\310\361\246\236\353\260\215\321UQ\251\326\372\343\221v\2103\005T\007C_h\f=\235\f\341\bF\270\222\t1\037\311\223P\350U\250`\276\204\241O\302`\312\321\027C\to\"\246\013\315Q3\311PRp\277\214\243.\364#\266\274\311\026>u!V\253P\003\277\310\215`\310\240aO\244\301|\211\243o\372\336@qU\\bZ XG\325D\360#\275\341Dh\bp\270T\315\020[\021\227\215-O\225\370\021UR\243a\3163o\264C\023\024\241\365\362\221\266y\020\236\f\022\3227\007\202\243\273\252\2656\370q\250\034?\306K\367<\300x\334\203\371\362F\225\214h\024\227\230\2026;\276\036\017\357\327\241\367\201\007!g\247\247\363{\300\003\374\365$"
+	.string	"{"
+	.string	"|\243\300\367\353\311\331\001\177>\340\016\016p\267\323\343\351\354n~\300\235\202"
+	.string	"\366\201\300\371\355x|\276\337\216v\f:\254R\027\266\203 \032\254Q\343}L\256#\037][\227Z\262\201D{\0024\263\321+42[58\255d\215\332htFk\021^\205\nMFgG\036\243\262\223\306\234l\341YSNz'Y\322\033.\205\206"
+	.string	"\207G\251\201\022\213\272\231\264\315\255\222\276\371\223&wr\3160\351\223\177\3012u\352h\025\215\fU\rn\311\221G DK\320\352\311JLk\250Q$\245\225S\204fd\244 I\222\306\240\002\031)\243n\021"
+	.string	"5i\234\262Y\250l\354gB\331\242\222Zv\034/\223<e\275Xb6\340\243R\325m\232\222,"
+	.string	"\244\211\240\003\263s|\245\254sX\215\256\240\n\311\244%\363\264(\250Q\254R\323\364V\f\264zC\230\373\201~%\360m=\035\317\221\n\275\221\364s\344\311\f\334\356yB\262,\333\312\026\250\366'\333\200M\330 S\345\020\276\360\202cz\300\314X\243\350\316\350\353\334\222Y\361@\270v\374p\265\213Y\223\364\201\023\"\245$\346KC*\353\210\214[j\375o\367\345\306\371\276\277\302\3122$\234Q\263\004_\350"
+	.ascii	"\0263eI\2142\377\371\0303J\021\314Z\004}\201\313N\242\324UWj"
+	.ascii	"\262\353F\321ML\364\214\2006\271\253\001"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.76.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\325\t"
+	.string	"FSB6@\217\322\001S\242OWkA\301\222\315\364S;XkO(\262\027\342\2276\332\366\t\342\2175\322\203\027k\225OQt&\021f\\$\237]\2355\331F6\2212\2452"
+	.string	"3"
+	.string	"0"
+	.string	"\230\256\316=Z\232\234\177\351\304\r\215\320\373\272G\214\304\255\314W\202H\325|%k\263\273\347x\236>R\346\245\263\273N\357\213\270\257\333>\260\035`\037\023W\315\305\304(C\033\354RU\366\255\325\224\355t\314\264\246\177iDL\fRvQ!\313\226\304\221\f\333\";c\202\002\221\271\203\026\250\257(L!*\273`QU\376\325\322\324\307\363\222\366\346\220\367RORA\322\356\271\273\235\252\3126w]\023\005\344\244\224+\366;\356\301\371\030~\b\345\275G?t=\006\366p2-\224\200mZ\266\201>\033\006R@X\300<\332\206q"
+	.string	"\2341|4\254!\3134,\003\3565\345\264\004\236:p\325\223\355\250\233\221\222\254\032\365\246\226Q\206W\022"
+	.string	"K\b\230P\307\353C\231\251\302"
+	.ascii	"c\240ZA\210\230gC\320\256\211n\b*?\0010\226\205k\017+|\252\032"
+	.ascii	"\262rGK\216\255-e"
+	.text
+	.section	.gnu.lto_performGyroCalibration.77.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\211\016\325H"
+	.string	"\n{\020\033;0\344\316\030\205n\332FNZZ bs%\002\337&\232AkgV2\204\321\206\330\367;8r_o\001\364\233\331\277\203\021.\241\004\222\353(\213)\236\"fi\311\026\271SJ)\245\001}\001\240\001\203\\=\207\331&\203\032\271\230\233t\346\360\204\303Dv\177\334r\004}@\205\361\275q]yp\362\032a(\337t\034 \r\207q\2449Z\313\003l+{\325Q\363b\006\302\334l\363\307/\330\247\315p\263\341N\323j\334^\303s\224_T\245\0325q\213\357\3732h\226[(\233\205B6S\353\327g\204\264\031\376&\213\232\3152\013an6\3136\235\031\302\004\267\371\212\364\363\235\0362\221\320\316\334y\255\347\366\236\221\206\276o\233\"\234\367\345k\300\n\224\3152_G\333f\225\315\3246\313.3\241\346{{\223npdh\032\337\367\265z7\376F\3625/\271\333"
+	.ascii	"\236\234\242MLK\320\247\2223\t\251\311\\*\223-\213|w\271\231"
+	.ascii	"g_\r\340i\256\235\346\344<JG\355\"\347M\206\324\271\2768gB>\271"
+	.ascii	" \035\274\357;\365\245$\226\0264\270\206n\351'\362\201\325\312"
+	.ascii	"c;\275\354\2316\035\365\315\225\222X\310@=>v\355L\202 \327\230"
+	.ascii	"\307\b\013\332Z#!!\374\235\001\266!\265\n2I\f!\272\036\244\342"
+	.ascii	"M\344\225\236\335\2267\243\246N\323Q\2478\323\220\312\206\204"
+	.ascii	"z\337\227\216*\305\227\007\260\240Ei%r\301Z\036'\321\302,\202"
+	.ascii	"\232\216\252\346I\344T\243\305\3006\244FA>\211\231\3115\317\310"
+	.ascii	"\274m9}\300\220\272\245\331\264'9\033s\366I#\221\021\304\032"
+	.ascii	"\2518\317\304\220H\215\310\3724\317\302\374\233M\263nq\206\260"
+	.ascii	"\240\301\265'\261\336\367e/;Ck\016\320\314\375\206\231e0'\251"
+	.ascii	"\bVfv\004\314\254\242\005\261\225\352\355}_\013\314\256\230\016"
+	.ascii	"\344\326I\275\271w\255\350\342\001r\367\\\275\247\3048#m\263"
+	.ascii	"MDu\032\033\371M\0369;\310\257\362\205?\360\315\246\241\205\201"
+	.ascii	"\372\020\035\002\n\363Fl\341/Tx\251\267\360I?cd\246n\231F\354"
+	.ascii	"\240|\337\227\002\267\237\376\363!\304\210\021m\263\025\276\321"
+	.ascii	"l\331\243z)\006\2446\317i\037<\325\267\204ctS\277r\204\177\360"
+	.ascii	"M\366(\016g\265\241\t>]x\202S\254\360.[\3216\033\341;N\373]Z"
+	.ascii	"b[Y\253\365\264P\276o\030\005nBw\317\005w\\\263\256\326/\332"
+	.ascii	"f\017|[\333\361\322\034\255\351\355\201\371\365\337\367\375\372"
+	.ascii	"\2572\363M\375\333\230\273\301\316\376\326\370\333J\274s\326"
+	.ascii	"\323\231\304\323y\304\323Y\304;\207xg\020P\347\017\357\354\341"
+	.ascii	"\351\334\341\351\214\365t\346\360\316\033\336Y\003\324\371j\311"
+	.ascii	"9\303;cx\347\013Og\013O\347\n\024\230\316\022\240\316\021\336"
+	.ascii	"\371A\363u;h\301\346\252"
+	.string	"w\246z:K\275\363\201\336\353\206\3525\315O\357\354\364\316\321\247s\223\2223\223\323y\211\351\fe:?\233\316JLg'\3239\211\351\214\304tn\2763\263\351\274LrV\"9'\227\316-\323\231e:#\233\316\317t\366\245s\243\370\253\0357.\217\310\367\232]\035\275|\330\300\271\026\354^\203\347\016\307\200\222h\247\003S\304\277C\035\336\003\326s\370\016n\031\257z\033\326\206\347p\330\032~\303\325k\300\303Y\216\305\257\\}\343i;R\030\223\276\332\203\254\345lR\307\2505\027\017m\221]\242\013spH_e\246\226^\333\fO\303o\220\245\217>Ez-0\310n\325\245\270n\321\304\f\337\203\355yP\374\354\217\255\371\315\1778\277<\314o~\217-:x\346'\375\264\024!(q\314\257r\221\326\301O\255\005\362S\f\363F\313e\225Cq\253\364\031\366'\236\346~\261;u\305\304Z\345/\037"
+	.ascii	"#\331\243+\257B\342&i\273L\371-\030+a\377\325\313\276:S\345W"
+	.ascii	"\271\251\213\264\311\357?\354T?+\302\035\307\356\022\327\314"
+	.ascii	"\273\3145k\233M\376\322\017\361N\r\314\257\003\036\303\b&\277"
+	.ascii	"\312\f\372\351\247\326\352\374*x\333\304}\342]V\365-\247\273"
+	.ascii	"j\366\204O\330\177\265_\355\026-\206CW\272\rk\271"
+	.string	"\022\f\337m\302\254\351\355Ip\344\267Q\334)b\216d\007\222\037q\347\252\022\235\314\005C\2258\346\342\025h\037\002\336\265,\215}\017\363\251[\027\345`\321\262C\310\367g\277\307\326\376\221\317\022\216-\372\353Vi@\266\276\272W\372L\342\243\253\267\377\006\334\022\350\210\255R\216n]T#\027/\352\277\364\333s\027\310~\225y\021[\251\022\263\264\"\267.\252\332\214\256\333S\322\224\320\256\221\201\3673\273\\\334.\336e\f\025\366_\314}h\207\263\314\220;7\301\302\227^t\301X\025\212\352\307\200\247\246,-A\266l\330\370\341\325z\345\0302\003iC\007\027\016\257\255.\034,xp\345\3701\243\213F\016\0353>\374\340\261\265c+\b\327\t(-&\327\250\342\352\"r\303\312\253\213\313\213\307\226\227\025\217\0343vX\325\350\362\262\252\022\300\\=\266\272\254~pquY5\371\300\372\333\030\013\354\247V"
+	.string	"8\275`\240\213\327\344\266\324\261\215\276\3237\030[\233j\271U\352h"
+	.string	"\320\305k\212~\362\360z\367\264\302\273\245{\n\245\207N+#S]\022:NSm\323\373#?\245\353u\317\265\247Z\246o\372"
+	.string	"\204dj'\234Y\212(\005\344]\306\364]\307\312\364\277\2425\332\245\357\362SD\343ijH\003I\007I\007\265\315.\375\013:b\244\346\321\226\032j\231\245\210\244\214HVC\001\022\231\255iZ\322%\276\373\032\332\347Xx\206\265\274\257\304\367\231f\372*/\025\241\024\376\025=I\203~\372V\324\310%\252~z\n,\0252\210\376HHL!\024\372v^\206\255\r\366\334\272\004z\256\033\201D\t\357|\350\267s\306\274L;K 3|\357\313\034\256\327Da\357\013\206\340\371\022~"
+	.string	"\341\030\235\322?\277e\224.r2RFwJ\037\241\t\343\335\336\363QQ\333\363\351\247\330\334\374"
+	.string	"9\337\307dq1n]T\030\327\rM\331\241\244Gz\347\367\330\235\254Oz1~\211\246\210i\026I|\326\210\027\361$\350\320}\031\021\342E\200\370\020\037\036\004\035\316\3629\271\017\337t\342\330\332\200\211\\\334\272v\003\267\001\tA\0256+kz\201\334\346\257\317\235\222\323\303\277I\035\013\270\271xJ=\330\f\002\037\003\201(\250q(\005\031cjFDD\222\024$\031\016A\005\304 F%;\017\021P\261C\220\215$Jc>\274\236\213\335\227^P\355\313\3743S\245\034\037\327\r\321r\322\376\001\263`\212E*\020\373\210\213\327\374\026\021\025#\313\031$\210\260\022\222K\371>\333\243\006\300-to"
+	.string	"I\2144Y\371\350>\344<\272\203!\213\300+mFpUX\372\006tV\326r\370\371\371uwA5F,\364\025`\236 \373\270t\323\005T\350\331D\274\242w\356~\266\261\364Km^\n\t\205\211r\337\222\260h-\355\004W .\202\243\264U\315\203\217w99\226)\371C\022\242~\322s\017\232\213W\217^\345U\033\2037\322\346\344!\b\b\207"
+	.ascii	"\303\301[\202\200\316\004\006\221\003\371^{\372\236'\246 \371"
+	.ascii	"kt\034\220N\372\367\226\222\361[C\316\013\021\211=\266J\371\034"
+	.ascii	"*\005\323 \203\f!X\252\334\243"
+	.string	"\225\372 \311\215\316\260\"\200\234@\005\277\3102\303q\026x\231Af\026\376\b~A\373\f\256\203\335\220\t\317n\204\274-\247\017"
+	.string	"\204|\2762\276\270\223\274\225\350?\220\372\346\334\347\032\227\013\271\323_~\026F\277nd|{\177\220\270 4"
+	.string	"\214oLs\356`_\334\\\331\351l)mY\236\007\353\016\336\202WS\004WVLR\233\313\251\373*\241_\333\222)\027\006\001\317\204b\257\034\225z\177Q\310\2238Uv\222\205}\367\341\221$a\024\202"
+	.ascii	"W\253\343M\323\260\300f~\320MQU\342\311\353\365\223d\035\233"
+	.ascii	"\331\024\214:\350\332P\f\232?\026n\f\367\024\212N11\263\211\023"
+	.ascii	"\215\2057\341\232y\030\356K\271\204#~\277\3077\376\177\220\212"
+	.ascii	"\314\234M\213\246r\336\273X\\\317\327|\034\360]0\314\364 \210"
+	.ascii	"\210>\224\302\340\006HR\210\370\325\245\006)\211V\365C\024N}"
+	.ascii	"LZ\366(\002\311\022V\031\020\007;\316,\224\032R\0230\004\314"
+	.ascii	"\237\360\021?\020\224J\177\365\243\342`\001\200R\346\t\236\004"
+	.ascii	"v\342\357-\260^!\202G\320\265\332A?\330W\366\206(\001q\020A\225"
+	.ascii	"R2\177\243w\276~\262\233T\t\"\374\325f\327f\312I\241\227\345"
+	.ascii	"{2!2\025"
+	.text
+	.section	.gnu.lto_handleOverflow.78.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`Q\003E\027"
+	.string	"6k\226H\260\032Q:\270\263\323\241\341\"\036\025vg@\037\313\202\006D\211N\225\267\233\316\337\2213F2P\362]\373\365!m\373\032\300\266:\022\213\236\037\246\207=}oP\217/\021\214\275\300\366Q\205iY\b,!do\271\223\f\177"
+	.string	"u"
+	.string	"\203"
+	.string	"[\226\370\\+jf4z\\\351n\006\257\013\341{\335\335\317\335\373\370O\353@&\266\324\035Ch\250\273t\260\013\276\327\003\247\351^\351\003t\257\333\332\255\362\262\247=\032>;B\222\272;\344\031o\375\363\272Jy\266\366\336MiFs\375\363n<\0041X\360\274\213\262\202G6\353\211IAZl2"
+	.string	"\332\016=\320\335\017\372DA\203\315\351\335t\367\316\031\215\305\267\364\335M\261\273\033v\031'SH\206\003\266\036^do_w?\330\0179\221\324\336\347u\307\020\363\263\327}\210\356\365\234\262\345^\374"
+	.string	"\275f\230\335\0226\331\266{\332\\\333\355\346\312\324\271\246\003\3751/\277`\235\373\321\271\036\235\333\321\271\225\316\245t.\323\271\223\316\375\314[t\022\026\tV\272U\204\361\322G\225\250\306\313\177\367{ \017\262\013\256\316\177,\343\220\222tv\301\327?h\301\335S\256\344X2\304\006\354L\336\304\304\336gO\242\330\275~\3148$.<[vw\365X\325\261\307\377\362$WR\204*\220\303}\213\272\327\216K5(<N+\253(W\376\027\007G\2627\005=C\250\002\271\033\345R\315\210\013\321\354n\027\263mAf\326"
+	.string	"\304Ilv\331\311\314/\222%\275\266\301\205\366f \327\335\021v9\374\b\252\246\347\325\310d\017g\304\203\350u;\225Xw\257\201X\367+\301\031\344\333\301FL\241X\241jL\245\306\323"
+	.string	"\221\225\203\303\022W\"\016\211\361\303\006R\0341\201feAL\241*\260T\"I\2128\231\366d3\222:\034\302\0259\256T\342*T\241rR\341\211\\\2056\004v\004!\222!k\034\311\020,_\347\032\205\033G/\206}1|\024A\306\216\027?.\270\354vyl\273\320\355\235\374\311\005\f\0312t\257\036\322\224\035Z:\226\r=\247\223\341\007}&\n\016\030Y\244\030\231X\206\005l\331\001\363q\f\233\370ANu\004= \220\002\031\"\254\007\204Y\260\244\330\263\320\266\343\362q\241\222\254x5~e\030\343\320\212\242\216\213\331\2462\213\265\321\302\231 \344\234\341,r\241\331)\2613\220<#\220\3420\340\223J\266\020$\244\355:\353Y\266\356h`\027\347\200\226\035\241\266[^\032\033\376\350.\246[\330s`\001k.q\3006Ne\r\225"
+	.ascii	"\355apAq<\013K\r\243=\030P \031\202K\316M(\305\372Ap\215\"8\006"
+	.ascii	"\331\340n\324\236\336.S\006"
+	.text
+	.section	.gnu.lto_checkForYawSpin.81.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\210\003-\031"
+	.string	"\346,\237J\240\230Q:\020\\\202V|\344\003%a\264\312\004I\346\362\370\372D\020C\313\261m\336\203\265[F\217r\237\375\217\016\230\325\375\277\245\016\334\016\270\215{\030O\341\345\360\"k\005\245\275\222K"
+	.string	"F\256\317\305\377F\b\331D\356\224\002\204"
+	.string	"\201"
+	.string	"\214"
+	.ascii	"\343\251\315\301^\235~e\373\323\276\320\207n\257a\343T\255*\200"
+	.ascii	" \325\312[`\004\343\351\313[\302S\360\002\302S\337\354(\347\365"
+	.ascii	"T\321gGN\357\251\326Jn\213\337\236\032\305\220\202;o\276J\327"
+	.ascii	"\341)1f4 \346\314\260D\021\316\244g\na\002|\251\265\256t\036"
+	.ascii	"&\030\372\034IQ!\302\304\027L\260\373\215h\351r`\213\222\025"
+	.ascii	"Pn\343\363\203\0167\247\030Sk\365\324\321\211\270U\267\275\263"
+	.ascii	"\355\262\327&\3571\343\377XCl^'\026\236~o\343"
+	.string	"\007\222\261;Q\342fF\331<\334\\\036\373`]\026v8\335\032\247Y\3434\2138\275\022\247U\357\335)qz\f\247\305\327\370)\235\236t\372\001\310\240\335\216\017\217m\302\253 \242\252\324%\232\364\342\275\337\276\177\343F\034\256\303\353\373\005\325Z\237\343=\277\210\350Fs\236]\200\232vB\265V\032\237\310+\323\034G\315K\216W\177d\2168\021Rp\352\006\001^mj/\020%\311M(\253v\265\377\201\363\364\236\375!?\342\243\002=\265V\007\357\271\302\215XhqRke@\344E\\\376\317\251_e\031\236\316\333\027\236\252V\354\021\241\221tt#\267r\265\336\034\0307\265\363\007\016\f\334\214\262\270\343\036\247\351I\027b\037\006+Y)<\025\327\212\013\031\357\201jB\242\023i\256\013\020\224\335\320\fBEI\npy|\034\bL$\321$\310\351@:\273\245\375L\370\275@\364$7\241\354\363\b\316"
+	.string	"S\306`6R6\213\305f/\227\322\346\222\261\225\265RF\006\333\360\200\306U\003\240\026\241\214\301 \330d%\2156\363b\371\0053\243\325` k\264YMV\326H\031\314\025#_\264\032\tC\300\263\r%\215\264\315f4r\305\273y\314\315\342Rt\231H\027N\273\241\235q\311\367{r\022wP\\B\330\332\027="
+	.ascii	"S\224\016S\226\260\266\265\003\250\344\\aY\272\254\275\321\301"
+	.ascii	"\031L\232b\344\024\301\300\375\216\304f\002\205y\035\n\341)\313"
+	.ascii	"\256\357G\303JCA=\341\362\004H\250\201<\244\220Q\n\211\310\210"
+	.ascii	"\004CA\223tP\0021\006\235u\021\340\26535\022W\346G\027%y\201"
+	.ascii	"]I\274\245]Cm\304\334i\021\2441\370trfD\254\303\260xA\303\005"
+	.ascii	"3\221\211\020\351\220\365V\360!`\362\245\244\230V2\320\"\273"
+	.ascii	"\342\226\300\b\025\310\\\217aF\370\n\335C\027j\235w\327\253~"
+	.ascii	"\\I}\317\0342\276\224f\223\300s\370\272\356>H\020y:Q\022\252"
+	.ascii	"\303\327\037w\200=\361\031mA\22522\313;7yb\363?\030\n\247\266"
+	.ascii	"\276\007\334;\263\325L\321X\242\254\315\204\332\314\303<5"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.82.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\033\002\025\023"
+	.string	"\226c\177G\300\224\316ph\234Rm\367{\350\300@\352\n.\" \3734@\245\216\306w3\226\001\003H!Q1Z+i\211BP\027L\270\326\207j\020\033\225\006\201@\334U\204\357,\304\230\252l\206_R\245\326\332\336[\312\224\002j"
+	.string	"b"
+	.string	"r"
+	.string	"\265\367\200\276\262\233tE\265\353c\340\005\257\213\366\235e\274\370z\200\361\242k\266\220\373x\353R\332\"\222\322\332\335\230\242x\355\243\030j\326|\333\307\023\335\321\305\327\321\303\220\245HE.E'\024\272\020\251B\002\323\341RC\227\335\225\021L\027\024\262`\231\310\372\3233\204n(\323%\263\273\316\234N\304\355\272m\033\333\r\354\004\n1.xd\002x\273\373\024\027}\240\361\342\365OO\247\245\254\235S\357\226A\333\027\224z\302\276\006\203\301\2405\311v\245Q\336\373M\\i\327\230\036\305\264\206\351\324\364S`\230v#\224\222\250\017\337\026\005\225\254\016\321\306\222\017\365\337\317}.\300\204\264k\332]\330E\373\307\206]<\314\366\323~\323\235\002\267\026a\315\210\242\177\372JT\t[\021\036?\376\263\205W\325$"
+	.string	"\376|\341T\030\006\360vq5x2\330f\274\210\242\377=g\030i]\306\355\233O\341\034\340\355\222\210\241\241\0024Y\021da\344\227UG\260\220\324\036FU\rQ@p\231\304"
+	.string	"2\325WU\030$\234\332\354\307\370\240"
+	.string	"\230\203\341 5\f\222;\262\316_\354 "
+	.string	"\332\033.\325\363\332\3353\031\315'\207\346\3048/\262\031\b\235\030m&\243\371\344\320b>;7=1\234\031-\366b\3002\0169\263X\007\231l\026\203\371n\017W\223,s\323\240\207\273\273cK\272\364\001\204|\316-Bj\363\250.\375\024\321\222\b\307!\341\345[\375\306\004\n3\371\334\314xqT\225!\253\255\336\315C\240r\364\020\t\244\211\332\025h\3629\207j\373\016\246) \220\002\2311\353\001\230E\021\212we\270\312\367n\020d\347\336\254 \024|\370\026\0320\217>P\022\266\321j\002\276T\nbq\240\347\2314\"\374A\311\232%:\3703\227\263:\267\213+\366\215vX\214G\320Q\001\346\214\315|\203\354\003\376\030g<\004\0027\237\323"
+	.ascii	"\033\351\235\373\212g\324\001F\001"
+	.text
+	.section	.gnu.lto_gyroUpdate.83.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`t\016\3751"
+	.string	"*R\320\021E`\232N:\177\236\022\017V\301vA\265\n|r\246E\267U\004s\026\270\035\275}\247/\264nu\032\337\220\366}!ZzMN\267\2302\207/2l\n\202\007=8\226\3206\230\r\270<Z[\263\204\354\235\244\f\360"
+	.ascii	"\001\001\025\001g${>\262g#{\026`\317E\366Ld\317\001\354y\310"
+	.ascii	"\236\205\3549\310\236\001\3303\220=\377\330\263\217=\367\330"
+	.ascii	"3\217=\357\330\263\321\236\213\366L\264\347\241=\013\3559\265"
+	.ascii	"g\324\236\255=W{~=7\204\243\3001#\246\334+c\220\316\275C\345"
+	.ascii	"\312\336\352\302\334R4^\332z\360z\255\331V\264\223\025,\331c"
+	.ascii	"r\35756\312\274\202\331\330\25052s\237\271\237t\232\262\241\260"
+	.ascii	"`\342\275dN\260\334\353\204\342\247a\243K=\2246j;(m\224\225\314"
+	.ascii	"m\332\331\274\255W\326B\212\234{\357\261\006ie\027\211Ca\212"
+	.ascii	"\332z%\267p\002\221\371\225\325E\242\231\027\216\017\231\314"
+	.ascii	"\274\302.L\273\2162\221\315\020kK\306K\314.\251\365_|m\275\266"
+	.ascii	"\340*~i\245?\367\336&\363\022\263\027N\270\367\362\231_3\232"
+	.ascii	"\215\315\314p\314\334\200\271'Duj\0204\036?%\340\335{\243\230"
+	.ascii	"3t\032)\007\032\032\r\362x&i\300\314\253\217_\035\240\334\362"
+	.ascii	"\203\354\274\367\332\346\220:\325Vk\2402eYq\312\250\331z \367"
+	.ascii	"\033O\365\030\016\006\360\336\230\252\357:\0205\357\335\252k"
+	.ascii	";\017 \354[\177H\033u\252\375\326\207\253!g,\355\347\355\354"
+	.ascii	"0 v\360\356]6\223\271\252\351\222Jx\215\202\341\020\"\336L\336"
+	.ascii	"\001\363w\267U\263\270\237m\304w\227u\301\256s\334]N\247\205"
+	.ascii	"{K\303\035\271<\260pg\3416\303{\263z\214;)m\224\317\2740\232"
+	.ascii	"\034\271\367>\365\025\356\261a\363z]\347}2\362\340z\035f\036"
+	.ascii	"\321VH\f\357\275\r\270\2534\234\0257\221F\371\004\326\233\211"
+	.ascii	"\2256\332\025\005\013\003\be\371Af\247\326+\020\346\266\267\376"
+	.ascii	"`F\317\017\320sTC\351f\200\236\241\320\263\223=7\3313\001{f\262"
+	.ascii	"\347%{V\262\347\001\366\234d\003m\367Dv\227+\311\216\213\003"
+	.ascii	"\252m\007\307\317n{\025\251\b\247\202\\\360\267\344\201O\371"
+	.ascii	"\251\n\300\366\226\356\275\304\007\017\213r\266\306\306S\227"
+	.ascii	"\302\306To\213\362\2406\3330\352l\255\215\247\276\326\306Tw^"
+	.ascii	"-\252v[\332\023'GM\230T\375l\t\032\227>\335\231\320'\211\031"
+	.ascii	"\222\236Z\254>eF\212 \217D>\244\247\372\370\345\241\361\\\310"
+	.ascii	"\233\017\262S\213\225\007\352@~\370 \353\261\003h\374\216\217"
+	.ascii	"]G\261\022\253\3619.\206\3549\034\017+\036\3546^\203\306g\020"
+	.ascii	"\253\217_\032\264\264\002!\323PIz\270\361\324\275\334\230\352"
+	.ascii	"2\016\3431\204G\240j\273\375\205\2053\357\202\016\207\\\237\356"
+	.ascii	"\006:\254]\347\372\226\260\326:\024\374\362Y\277\203u\232\271"
+	.ascii	"\244\215\n\001\323:'\020\020\255\265\246"
+	.string	"P\375\347\327\207<\362%\r\304A\253\217\237\035\232\234\255o\370\211t\241\335H\t\355\3511\341\324\372jk\221\230.3-\f\255\307\317\256\313C\366\034\233d[YSk\007X\034\222$Dl@Q\"yu\225\242\212\207\253\022X]\251\bq\304\272\262\302*\221\304:\226\020\001\202\304\261\352\n\353\230\300\210\255L$\257\216(\254\254\256\216F\347\262\355\255?\330\303\234\273e\325b\247s+\221\244\314\312$J%\177\005\336\316\372B\2116dJ9\300\253.\030\324v\326\026J'W\246\325.\245\032Q\345\242P\341to\356\272\342\272m\261\251.kV\275\004j\023SU\252\004\226\252Pe\252O}\202t\346\004\002.\r\250@U\251\026\351\375\371\365\361\305\031\220T\337\270\331C\252IGU@E2\252B\365\250>\365\345\261Y\243\006\317\250\250\002U\001\265H\017\315\317HE\270\031\344\202\227I\0368\231\242\252"
+	.string	"\214\217\350w\267{\035?\233\355\275\313\246"
+	.string	"\225\250&\210\3532\033\252"
+	.ascii	"j\200\212$\3305&T\203\352P}\352\243\343\347\363\232`\2207\363"
+	.ascii	"%\371\271\246\027\241\372<!s\374|\\\223\213\324\2454\267 [\260"
+	.ascii	"\251%\331{M\271\240\3728!r@\365\247\002\250EzX\370\031\201\016"
+	.ascii	"\250Q@\313\23042\"%%I\222\326q\006\"2VU\017\022@\363(\005R0\313"
+	.ascii	"Zn\244\244@\355\237\001\203SK\2275+8\323\204Wn\024x\272\333\220"
+	.ascii	"\"I\234O\311o-oba\313l\310\033\362\262\027kv\324F\273\204q\323"
+	.ascii	"\341:('\0314\272\r\354T\366\370\030\013DaY#T\370\277\3527W\342"
+	.ascii	"\264ep5\027\251\274\201A=c\372!L\025\206r\307&\327D4\0227\r\322"
+	.ascii	"\322\007\246)\026\242V\317T\356\003s\326\203\206\262\355\222"
+	.ascii	"\253\322\325\262a\026\272,\322\255\324\213a\305\260R\340\203"
+	.ascii	"\347NKz;8x\373\257\345\262s\263\233\n\236\004\303\351Z\206U\260"
+	.ascii	"\327f\351f'M\325\307k\347\037\347=\fR\r\361E\332\244\303'mw\b"
+	.ascii	"{\032\334\326\232(?\035\216\316\177\236\206'a\\Q\211\356\353"
+	.ascii	"4'\335\"\357\352\021\246\001(\244\003\204\305\265\301\026\361"
+	.ascii	"\235_\262\326\304S\016\316H\237~\235\253\340]\020uWm\251\342"
+	.ascii	"q_;z\032\275\360<~\347\334\016\037\222\025k+\373\240\f6/LKJ7"
+	.ascii	"\262\306\237AP,\244|\226NB\320Z\357\322\264\031L\320\326\305"
+	.ascii	"w\215#\017\303\210(\330X\036\324\n\022C[\223\264\032-2\0315L"
+	.ascii	";\366\255\305,\037\002\017\332\272vU\201\322G\252\033lQ\213\226"
+	.ascii	"\002\226\224\304\220\350P5\275\357)D\032u\n\252\234\r\032\352"
+	.ascii	"\n\201\313e\024\234-z\016hq\310\237\350\356\301t\345\231z\323"
+	.ascii	"o\2047\344\306\254\225\013\313m\357W\306\237\360\327B\\\210\342"
+	.ascii	"\304a\300'\036\245\032\376\267#\331\025b\030P\262\361\256D/\260"
+	.ascii	"\371\022\226\275\005\206\261\0325"
+	.text
+	.section	.gnu.lto_filterGyro.84.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\301\t\2750"
+	.string	"\312Sh\022CP^N:\201e\233R\2272\\\222\263+\323\335\373\220\243\335\026\013d\376U\316\341\341=\301l\363\332\202\342\207\335\356B"
+	.string	"\240\003\220\001\322\025\235\017\320\253\234&~\020\343\376?\326\226\241y#\333\b\221;\311\020\001\376"
+	.ascii	"\027\001\253W\331Z'\247#\252\267D\274W-\316\024;>\036\027\357"
+	.ascii	"\360\240\331"
+	.string	"\260\205_G\307\317\364\332}J\0303\026\326\307\361\347\270x\225\237\345Z\272.\307`\322kG\301\315)a\275\272\224\366\341\270x\267\277u\335\311\225^\273\324\212[\364\336\353t\225\025\254W\371\357E\302\253A\037\022^\355b\246\363\270\346mpEl\013\237{\357\262\227\b\221\310\325\310\3754\356\034\244v\375h\024B\006\025\201\210\353P\250&\225i\333.>\334\255\331\234/@<3\257\037S\344\221T\212\317\2105\246](\355\310\024\331L\245\276l\320\225\234\025yq\030A\355\214\310\201\324\316\206\234(DO\314\256\001\224\234\241}\230\016\301xD\371\232\262!)\203>\321\276\343\335\222\231\201Y!\020\025 W\215\236<\023\355\312&u\017P\245\214\211M\323\2455eD\322\245{o\321\314\206\355\317\335z\211\272\t\252\235\025\271\035F\270\367\262\0353;;\017\235\3717\230Y\004\363*&&\016\330\274\232Fm"
+	.ascii	"p\372\370\304\375\246\316\244}'E\260\273N\f\230\231\332l\311"
+	.ascii	"^\343\237A\263OT\331k|\031\302\356\253\2418\031\031c\272_w\013"
+	.ascii	"%J\033G\273\344\371K\233\215\253\204\266\265\344\002m\330>\314"
+	.ascii	"Lu0U\353\275w\001\337\313\277X\361\237\\\345\025X\366cW\371X"
+	.ascii	"\302\253\266?w%\0364\355\315\311\264\203W\223$N\\7\033s\234\227"
+	.ascii	"\355\265<2\301\037\334k\314\b\244\226PON\007\n41\235\313Y\300"
+	.ascii	"\367\316J\317;'\375\356\214tdTt\2713\321\320\362\220jY\271ZN"
+	.ascii	"\252\226\221\253\345\243j\331(\264,$\264\034d-\027Ow\006\022"
+	.ascii	"Z&Z\313k[\036\016-\013\205\226U\325r\232Z\356\266l\255\345'\350"
+	.ascii	"2buCi\356\3451\350\347\376\251}R\316\345\337\373\363\376\273"
+	.ascii	"\237\356\227\373\235\0372?\371]\270\310\205\237\253W\231\221"
+	.ascii	"\030\233\035\035\370\002\3557v\247\017?\243\004\271\230\370\b"
+	.ascii	"\265\337[[\037\323\016\332b\263\361\353\256a\016\035\242Ss*,"
+	.ascii	"\352\243\243\326\303\341y\270\210\240x\364\334\332\320\200\322"
+	.ascii	"\325\250\201D@q\256\305~\2231\0075P;\365\303\312\274\203\b\350"
+	.ascii	"\331\023\026e\332A\342\020\252\215{N\245\323\223\232\354z\357"
+	.ascii	"0\207o\370\244\274\234\033%u\321v\261\325=\261?kRC\3651,\215"
+	.ascii	"Q\023\373\251\333/,\355\353\016?\023\330\341\212\332\360(\t\250"
+	.ascii	":&\b4\351\020\033\216\225\266\276a\263\361qL\225jc\036\235\244"
+	.ascii	"\323\221\232\354x\367\340\344\217\272\314\020\307\231\344'3\333"
+	.ascii	"\001EM\206\324k\333(rh\206\275\366\305\3760\355`\234\2525p\330"
+	.ascii	"Op\236\336{\257\360\351H-\325G\260=ai_v\220\221\254\332\302\346"
+	.ascii	"\264\227]\003\tX{1\037\352\342t\3151\300\017\367\003\3617!\276"
+	.ascii	"\347F\330Hn\306\200\234\r?\001@\231G|\r\327\361@\357\275\013"
+	.ascii	"\270\303\325\220x\235\346\275\227A\211\377\005*&P\220\220\245"
+	.ascii	"E\243j\265:\025\214\253\251\030\352\226\325\214\2514\005\325"
+	.ascii	"U\013\254\251-\0262\262R\024\031E\324U\013,\253\023ZT/\256\254"
+	.ascii	"T\234\310\322\242Q\265\334\322\312\332bA\265\265da5\205\265D"
+	.ascii	"\241\265\265\214j\342\254\026TZ\313\027YYZ\313b\334}\257q\212"
+	.ascii	"\005\211`\224\331_\314\225\336\253\006\341\316\037\356\311"
+	.string	"\250\226c\26311P\350@w \322\351JJF\245>\320\347\273\0015tr\200t\005\032\215\237G\315.,6\b\227\021\310\203\035\177iohM=\324\254\354\002>\\<h\366\370\360g\327\233=\013\361\271\246\331P\017\301t\301Y\036;\224=\364z\2661u\262\031\331M9\310$\3301\034\311\tV\314\206!\005\235L\001}l66S\223\2606\262\034@3\330\257\n\347\203^\260L\f\020\240\326\353\330\303=\r\037\234\372c\354\241\027_\233\223i\00734A\005\364\273|\200\235\272\026B\366\032\023\003\213\b\272\003\255\323\211\232\f\352D}=\366\211\2246a\202\210\032A\023\331\354\tK\023\202\343\247Q3\200\306\250Q<\305\034S\246dD$I\n\222\341\320\002\221!\"z\021@)4\214\315\310\230\024\232\003#X\214\374hAH\270\312\362\325\214\237\260\301\\\f!s5kj\177]5,|\002\352\027"
+	.ascii	"\030\350\n.\t\301\r\320\313\301h\341a\364\321\004\346\177\330"
+	.ascii	"A\223\310.\225\017L\331\334\"\"\n\215\232\356\202\023{\256\211"
+	.ascii	"X\345\367\3164\003\264\260\212Z\373\020\274\fu\261\037\221\313"
+	.ascii	"B\031\362\016\037\320\r\026\242\305eq\300\244\306\310\224\327"
+	.ascii	"\031\263e\371\270\324\302\tO\302\346df\254\f\244\366~x\201%\202"
+	.ascii	"\244\\\254\006\311\2551\360\255\315\3418%\007\270\342\241%{\316"
+	.ascii	"T\270\2467\274LN\375\207w+\341\263\356OI\023\226\264\366+\372"
+	.ascii	"<\346\356\230w\2717\276\253\365\030\302\276\363\210\263\315\215"
+	.ascii	"\331\230\266P\210\3009'\347\237(\253\021\234\024\310\276\320"
+	.ascii	"i\213\003\376\240\234\023\007#;\022\366rm\233B\210\332\241\236"
+	.ascii	" W!\207\275=\257\002[}xI\303<_\317\214}\266\360|\f\301G\247\270"
+	.ascii	"\271\242-\331\017\215\372G\204\017\3402\bX\262,j4X+\377A\232"
+	.ascii	";rob\367\255\206\341\207\316\225\243\377\022\232/\233\220\255"
+	.ascii	"\230A\327\212\006\005\205X)f\t\f\007\004\002\3321\306$\3244\f"
+	.ascii	"\327\3424F\002\002\031k\016H\030\212\272\3366\243\224\322\304"
+	.ascii	"\026i\267\304\371\362\362\037"
+	.text
+	.section	.gnu.lto_filterGyroLpf1None.85.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\372\007\325*"
+	.string	"*JD\020E`\336Q:\363\303\271=\177\213\362\230\001\013\t\357\313\266\355\236[\344\001\233\347\224\273V\351%Z>Q\303e\202oL\031\216\335\227d(\301\224-m\006c\206\201z,\233\333\335Id\377\333\377\266g\263\204\310\235d\356"
+	.string	"\342"
+	.string	"\364"
+	.ascii	"e\324pX\037\306\037c\337U\376\226sa\272\030\223Io\331\006\257"
+	.ascii	"f\206\365\2521\355\203\261\357^\377bzs)\275e)\026/\350\275\267"
+	.ascii	"\350*KX\2572\333\003\350\256\376\036\244\273\312\304\034\367"
+	.ascii	"0\346\255\220E\252K\237{\357\261\233\350\206\3035\310\3754\354"
+	.ascii	"\374S\231.\f\002\207?_\217\267\356t*\261\230\266e\342\203\335"
+	.ascii	"Z\301=\3211\263j\2720\035&I!\250!\261\301\254\003\263>L\207\314"
+	.ascii	"\024\302\223\375\235\311\325\221\373v\030\264\256\214\274\247"
+	.ascii	"uU\344<\"hRvE\300\344\n\353\273t\007\025d\312\337T\025I)\370"
+	.string	"\201\206\271\331-\225\025\224\325\365\254\f\271*\340\304;a\275\370\304y\004W\252\234\33045\276\2512\222\032\357\275>\253\036\266?v+\006\3525\247uu\344v\207\341\336\313v\312\352\352\034t\346\373`f\023\314\273a\320bo\361u\350\272\257%\343ht\234\351\276\363V\312\224.\206\202\331\303\2266\027\317\320\331V\212\271\365\260~\230\031\351df\254\367\336\t|1\037\243\304\217r\225\2236\354\247\256\362m\350\256\332\376\330\213fmY_M'\033\275\233%oa\335\\\314aM\266\267\316\250\346\204po1\023\r%0\036\0202\360/\347\002O;;\027\357\345L\034\n\203\027;\003U\313?\325\262\317Z\356\235\354\314S-\257\326\362\256-\353t\226U\325r\232Z\356\266l\255\3453\3504R\316\2406\367\006\211\376\271lj\030*\377\362\247\375g\277\227\237\354\027\373\233\3371?\371`\330\367\205\237kS\225"
+	.ascii	")8@B\250\255MU\253S\354\007\024\315\310\273W\353\255J\031\337"
+	.ascii	"\214}^\364\260\371\320\205\357$\343gz\313^%\217J\363\366-\340"
+	.ascii	"#\027\005u\262Q\336\316\330\301\264f\261\350\305\246:\332C\300"
+	.ascii	"\251\355\016\024\377va\261{\266{\255\246I\005Z\213mlaT\033a\257"
+	.ascii	"}\240{-*\353\351\016?#@\227\214\332T\334\316\321\003f\034r\001"
+	.ascii	"\334\332u\260t\355\232\213\205S\352P\007\317\342\210E'6\325\315"
+	.ascii	".\002J 5A\207\267&\221\237\314l\207\202ME\354]\333)blt\275\353"
+	.ascii	"K\005r\262Q\267:\272vP\347\351\275\367\352\034\234\330C-\204"
+	.ascii	"\222\213\312z\262Q&`\323\036A\302~*A\033\241\272\211\371s\226"
+	.ascii	"BmS\314%.\347\304\235qR|\214\271\342pZDx\243\366\247\2068\331"
+	.ascii	"(\214\263\361S\210\331\305\333,\235\016\363\336;\201Y"
+	.string	"\234\315\321\345\264\335{)\274\370\032\362kmW\327\244\375Ee.\214\223\215v;\315@Y\251\315E\354-\376)0\375\00414l\310\220T\362\220\261\"\035\211#\351(\207\272D\332q\224\302@&\325P:Z\322\320\221\204\341\343\027FI5\224\220\\(\2217\222\220b\270H*y\3108.\225\311%\r\344\362H\003\351H\351\370B\271<\032\021q\262\006Ry\274\221L*\217\276\260\373\336\342T\213\2229\250S?\361Rz\257\326\2057\177\260\023\241\\\204\315\305<7\240\201n\267a\321\203\202\202Am\240\257\366\006n\310\304\350\220\025\350(?\0070=<\320R\020\220\005 lY_X(\210\332\n\364\301|\350\216\263\201\303\336b\236\233\217\250\333\315\026\035\330T\017\016\354\363\261Q\250\304)\363\0036Q\363\340\310Ee\375\300\370)\200\331kSx\346\370i\324gI\201\334\317\256}uY_s\361\235\367"
+	.ascii	"\027\307\023jNu\301\036\016{\017\210\353Y\002\320\226\007\315"
+	.ascii	"\253\013\253\227\256\302\346\231\220\322\\{\375\246b\3665\257"
+	.ascii	"\205:\200\245\250a<\304\024S\246fDD\322\024$\303\001\220\002"
+	.ascii	"\231\251*z\0210\255TL\315H%\205\346C\2347&\244\002\311\236\002"
+	.ascii	"g9yM\266\363\326x\356\013\025\242\207Cgj\263G\263\372%WC@\023"
+	.ascii	"\262\313\361\326\346k\\Fe\343\027\360\372n\0053\2765\024\017"
+	.ascii	"\355\025bF2\371\352\031+\343\245\t\206\354M(\f\2333jF[C\252\367"
+	.ascii	"\325\013\372\331m \302\260\204[\177\240Z\273>r\321\021\300\331"
+	.ascii	"\344kU\225\3405\271\272sf\273\371\037b\245\240g\327\2232\306"
+	.ascii	"\t\251\374\343L\261\027|\202\317\306m\2215\001\245\311\336.+"
+	.ascii	"}(\215\234\2707J\002P\004\033?$6a\303u\203J\374L_^,w\272\216"
+	.ascii	"\300\222Q\321\334\013u\351\215nV\241\031>h\006KX\270B\230\001"
+	.ascii	"\370\314V5G\325\363\204\201\301\244\213\033\271\025\340\340\321"
+	.ascii	"\321\3778\357\021#\333\201\355IN\373\223\005KzJpr\264\356\231"
+	.ascii	"\\1*\326\352\"9\370\227\342p\324\007\264\302o\222\2667\360\027"
+	.ascii	"\342\246\330\271*.p\003\024\007\214\311\322\264\001.\0023\276"
+	.ascii	"\"B\202`4/,\240\032\2335\312UJl\321\355\326\346_F\377\003"
+	.text
+	.section	.gnu.lto_filterGyroLpf1Pt1.86.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`k\b\215,"
+	.string	"\212L\334\020F`\034R:s\227\261,\305\236\345\013\252\353f\322\013\310'\262\221\004\325\n\266*FB\226U\026\303\215ea\252\277\2715\300\202\341\037\302\257\013\206\237\345\316l\226\212\264\372{\223\020,\364\277\326\267=\233%D\356$\003\366"
+	.string	"\351"
+	.string	"\372"
+	.ascii	"O5\206\246w\355P\300\224\271\260\376\214\237\306\302\253|+\277"
+	.ascii	"\"u4\376\222\3365\013ce\024\326\253\311\264o\306\302\217\235"
+	.ascii	"L\352eQ\351]K\247\214E\357\275HWy\301z\225\345\016\300wu\370"
+	.ascii	"\037\337U)\346\273\2379\357\003*WX\360\334{\225\032\211\317h"
+	.ascii	"\\\211\334O\317\316CU\352E\242\217q(\f\002\327\237O=\"\323\266"
+	.ascii	"R|\263\333-;\2527l[S/\246F\"i\002\270!\226\350u\037\257\033S"
+	.ascii	"\2433M@e\207?\302%\344\302\337\204/\256 \017~q\0019\360\207\333"
+	.ascii	"\225]\207\216pu\375\227\376\252x8\271\032- \251\203<Q.g\273\315"
+	.ascii	"\332\252\262\276`\024\037W\203~|\263\353H%\317\017I\321Jb\323"
+	.ascii	"4\251F+H\232\274\367\n\267p\330~\332m\227\350X\336\027\227\220"
+	.ascii	"\333\337\204{/[\254-\256\363\317\231\237\203\231\227\230\177"
+	.ascii	"S\001[j\207\035\033\214\177\007\316<Qd\203\361k\370\272\377\325"
+	.ascii	"\342cj"
+	.string	"\210\351\376\363\266\211\0231\216n\261#\227v\030\273\360\331^\242\321\341\260y\230\331\351_\\\254\367^\006\374.\367\002\305gr\225\2251\354\261\256\362c\370\256\332~\332\221ls^deM\273\3674F\352\316\272\303\230\317\246l\203\265e\345\365\340\006c>2*\"\"0\224\024\272\226\363\200\277\235\201\336\226\345\214<\032\213G;\023}\226}T\313C\325\262\320Z\016^\355\fT-\257\326\362\257-\373|\226U\325r\232Z\356\266l\255\345\033h2W\317\0374\367\362\330\323s\345T.O\256\345\177\373\333\376,\277\332\217\366\227\375\307\f\345oa\241\026\206\256SZAWkvt\200[\247\264\326'\232\216\250[\022x\357W\035\2245>\033\013\263\3249\263\001\013?\351jl\340R\223\2625\330\357,fa\003{\250oE\346-,\272\203g\025m\332=\340\217\250\211oeH\244\377t\326\335\336\301\016\356G"
+	.ascii	"\371\272\033\177:h;\330\352\333\225\336\372\323D]\264Bc\354\265"
+	.ascii	"\tt\307YyQ\311a\250\202hT\322\334\210\307aB\340\274k*\262[\033"
+	.ascii	"\316\024\261_\207q\021K5jb\333\335\021\351\310\316:\333=,\321"
+	.ascii	"S\2132\324\225\035\031\312\314\226\250\330Y\310\376\265u\202"
+	.ascii	"v\306\327\277\376\225^\323\356\321\301\361\365\0018O\357\275"
+	.ascii	"\327w\340\3106\352b\025\236\225\027\225\335c\0016\355\017 \354"
+	.ascii	"\261\212:Y\325S\314w\303\024\232\303b\016\3616\"\376dC\342iN"
+	.ascii	"\023_sB\201\032\265\217\345\243i\367R\\\216\241B\314(\216&\352"
+	.ascii	"o\234\367^\006\\\342g\230\336f\356\336\353@\305\343\232\0367"
+	.ascii	"w\325L\332dO\362\2704\355^\3673LU,*X\240\240\\\336h\261:\275"
+	.ascii	"i\306\023\023\r\225\351d\203)]\321\364\004\003\212\211\371\242"
+	.ascii	"\206r\205\220U$=\301\200rB\261l\222\361\344\304\002\205ry\243"
+	.ascii	"\205\022s\251d\276hb*\275pb\202RR\261d*%\031\261\022F\323RI\206"
+	.ascii	"R\271T\022\236\3357\030\247U\212\344E\233M\305Q\351\275_\022"
+	.ascii	"^\366\233\375\030\275R\3540\006\322\371$\273\351\214H\007\002"
+	.ascii	"\"\002u\262\017\367\2434jho\324\204\226\254\025C\00381\330\252"
+	.ascii	"(\342\234\305\001a\207\234\027YWs@\373\b\331)f\220\323^\021\021"
+	.ascii	"\234{$\032h\270\336\211\003\316=>=\342\007\336\222\321\334\200"
+	.ascii	"\376\226\023\311y\266\217\261\301\030H'<\352\246\263H'v\026\202"
+	.ascii	"\023\373w,\223'l\300\f\211}\324\3005xV^C3\206\0069;\016kN\036"
+	.ascii	"C\223\360D\025\300\033\332821+\3540\376\363\032\354\356\200C"
+	.ascii	"\315\251\257\330\307c\333\341\360:Q@st\334\306\304\272\202\001"
+	.ascii	"\200\257\250a<\304\024S\206fDF\322\024$\303\001\300\002\231!"
+	.ascii	"\"z\021P\251DL\315H%\205\346#\234\221\225\020Dz~3\001\240\221"
+	.ascii	"\373Z\243\255\342X\035\305C\250\216Z\2474\331t3\215\305\346\301"
+	.ascii	"q\006\310\330\021\321\317\\sLc\314\226+\235\265\to\374x\233\215"
+	.ascii	"7.\374r\270\2748\247\353X\377\220\206\"\251\275+fl\223\2574\343"
+	.ascii	"r*M\336xoB\241Z\316D3\226\032R{\277\275\300&;N\"&\223sk\212@"
+	.ascii	"k+S\206?\002\\+\"\255/\"h9\256\337~\026\004\372\207LS\024\261"
+	.ascii	"\353I\031s\220\253\324\024\250h\372\224\250j\226-\372\247\244"
+	.ascii	"|\3267\036q\007\006\255\343\321\266\302\005\220\001'\232\304"
+	.ascii	"X!\354\352c%r\356\277\2628\353\364\017\216\234\374\242\331<\212"
+	.ascii	"x:\376\251B\336L:\017\357\224\327\233h\r\314.\240d\032dL\325"
+	.ascii	"Y\220\202\354\274\2701\355\240\343GG\376\3619\01602\024X\223"
+	.ascii	"\3624,(\006\323\363\004wGW2\313\275\217\342\257\216\223\247\177"
+	.ascii	"\t\016\227}Zk\354\niE\243Y!\310\024\213\233j\201\301\200gn1\001"
+	.ascii	"\232\246\200_\336\216\237}a\006\214\323\013\237\250\3736\216"
+	.ascii	"R\225&[$\305\022\376E\347?"
+	.text
+	.section	.gnu.lto_filterGyroDebug.87.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\224\0215J"
+	.string	"\032y\304\032?@\336J:S\005Z\340\241\214<@\230y;\254w\253\003\024\363r\316\303\350\006+\032\234\301\374\300-6"
+	.ascii	"\311 \b\r\201\266\302\220ae.\3144b\360\027\374\005\347\324\331"
+	.ascii	"?\2555B\344N2\230\001}\001\240\001>*\007\265oX1R\016\346g\374"
+	.ascii	"\025\177\304\277\360'\374\251g2\237\371U~\030v\202\341js\215"
+	.ascii	"\256).N\017\017\215\3155\272\246!!\217\311\305\253\241\266\315"
+	.ascii	"\2633\345\220\237\310N\304>m:|\341\033\026rum\017?\305\314\032"
+	.ascii	"\f\315\017\362\275\260\363,\237\313\273DO\310e\326\366\320\002"
+	.ascii	" \225B\363\354\325\332\027d\347\001\037\030=Umm\017W,\200\223"
+	.ascii	"m\333v\235e\005\315\263\374\346L\313\263EWZ\236\2152\347\371"
+	.ascii	"\340\264u\360\027\367%P\333\266a\355\304\350\350\bz\305\375u"
+	.ascii	"\360\334\304F\217ueUE5%\025\005\365\344\224\325\304\264\244\224"
+	.ascii	"\204t\004}\032\025im9\211\206\232\314%\273\366\215\362\231\023"
+	.ascii	"\004\177\353\360\264\325I\254[;\026\342Z\240Q\312\275:\274\225"
+	.ascii	"\340\253\004\251\227*\360S\201\200W*p\313\215\372;\324\237\337"
+	.ascii	"}\372\013\243\345:\035>k=J\\\013\264m\333v\233\372\316\304\367"
+	.ascii	"%\276\275\253\304\027\345&\345\331A9\322\223\037M\027\361.\264"
+	.ascii	"\211]\222?W\346\233\217\276\303\241{\2626\0204)\346\211G\256"
+	.ascii	"\021sB\023;$/\272H\256u\266$\337Z4T\274N8tP\326\253\266m\215"
+	.ascii	"\\\"\254<\273\"\037\252BG\3446\017\207\256\bV\025\272\273\313"
+	.ascii	"\034\362e\334\\\035\334e\203|]\t\340\261\001\362\254{[\231\036"
+	.ascii	"\231\334q\326\271\335\276\227\3371\223\200\224yv}\277\314\tm"
+	.ascii	"\333\362\225\253\263;s\235\371\272af\021\314P\020"
+	.string	"\001\024\232w\232\035\301\t%\223)9\006\0012\362r|\226\315\354\2479q\205\252\356\205\f\313\313-\373\312\255\327\230\016Wo\250\341s\324^f*\207\355\033F\212Y.o\242\025\266\245\3758\366`z7\177\303A\354\303\275\334\207\345\331'F9>l\267\362\310\035\307.\007\262m\333\006\314 \316&\304\032\034#n\006r\357F_N\244\030&\36147\232m\333.\340\2379\032\023\374\275\263|\"E\212\345\331\333_|Be\273\225\347\305\305!p\326\226\362\322\311\226\3577!\214t\273\202\230?\346d\310\370{\254\242\354^\356,\277ly\366}/W\202\243\004/\360\216\355V\376\221\211\235\301n)\363\340\332m=\3059\312 \334z\314(J\220\030!\"\304\230\030\007\r\007s\306p\3063\203+\236\027\034\361\254 \001\202\003'<\033X/\027`^\016\273\227\301\326\313_\314\313^\367r\027{\231@\363\362"
+	.ascii	"\347e\001D\227\003\024]\006@t\231\253\350\362\026\321e\255\365"
+	.ascii	"r\026\3632\326\275|\305^\266j^\256Z/S1/O\335\313R\354\345\250"
+	.ascii	"\346e\250\345\345\247\345e'\366r\323\3622\023{y\351^Vr^NZ^F\""
+	.ascii	"\272|4t\031z/?\327\313F\314\313E\313\313\316\027\236\211\330"
+	.ascii	"\313C\315\313\315\3652\223yy\271\274\314\262\227\327\365r\367"
+	.ascii	"\345{/?E\253\2113Tr\323\266\001\202\\mjG9>x\\\005C\242\266u\344"
+	.ascii	"\251\035\003\375\222Z\3127<\007<y\216B4\257F\007:A\202.\302\325"
+	.ascii	"*\351%\242\266\004y\267\b\350w\207\264B\0214\221\b>*\264\251"
+	.ascii	"\327\236cvj\242\016\321\207S\263\266\023\327\037@p\223G\317\021"
+	.ascii	"\375d\244nu}A\317}\361\036\3604>El]\272#X\320M\317nj\2261\256"
+	.ascii	"\020tA\217h(\234\033\004\315\324\"\272\035\341\360\332\204p5"
+	.ascii	"A\02050\273\013$J\345\353G\364\n\327\324\216\251\277\370\033"
+	.ascii	"\211\305O\314\263\245\f\225+*\321O\305<Z]W\320sO\374\207(\205"
+	.ascii	"\212Hl\260C\325\342*3_\255\003=\247\240\227\372\366\021\266Q"
+	.ascii	"\352"
+	.string	"\245~\340\365A\326\354\241\324^\221k\333\266\255QK\025t\211\206\276\001\202\303k\273\225\354u\221:\251\371\250It\016%ow\207\331\013\247rs\321'w\214r\345\242|g\324\221\324Os\344\204\3348\256VArT\312\205S{\037H \367-J\345z\246Q+\327-z\345u\332\220\272*\232\345\256E\375n{\324O\374E\224\322mx\346\255\256\250\245Z\255\307\177\203\251\240\311\255\326\343\277XB\373y[N\350Es\020\264o\370\313\327\347G\345\3110~\3368[\312d\313g\243\021J\272]A\201\247$\013\364\354\001|~DF^\3773v9S?Em\324S~\234E|\270\372;{\324\376g\322\331\277s\243\336\260\004\031\202\320\177\315\226\262\201\036j\264f\017\365\305#x<\001,*X\240p\206v\243E\323\354e3\\\220\321`\323\314l\220\255+\312\\\304xA\226\006\243\306\331\n'\253"
+	.string	"s\021\343\205Y\n\2642\031.\314X\2448C\273\321\",\r\355,\rFYZ\030\f3\262\027a*\320\322\302\300"
+	.string	"\360Y\2142\2640\031ggha\316\301\366\255\307\353\026%\224\223l\335\306jk\333\346I8\365\027<\322d\027\254\226\362\220\244\325X\267dV\327\0310\270b\320c\375\306\017x,$\254S\210'\346\206\253N\323\037\267\215\332\323\221\031\346\216\337\235U\201^3\026\001RMX\027\350'\261\260^V\265\224\373dK\260~\0233`\375\240\207\026\274\300;\252/\260Kf\214W\177\211yMu\201\351\222\"0\240\t4R`\034\320\314G2\034Z@s\200\026S4\2030M\214>y5\310E\214\362\335\313\364P@3\313\f\271\205_\0024s\255\352\247\241\0014s5\007\302.D.\227A"
+	.string	"F.5\220\213\222\312\206\241\267\232\265ZC\223\330\322\342\001$\335\375\213\"y#d\222\353\027]\"A\313V3\031\345\204\260\335J&\027K\324\357\212V3\327\032\375\242\262\232\312\265r\253\334s\231%Vga\300\202\272\352\273zb\320VUm\265\027\245\252\231\217\213t"
+	.string	" 1\364\303\\k\217\241SV\353\361\220$\023\212n\311\333u\003=\367u\003\375?wO\212\0343M\006\032E\017\305\271LT_wz\235L5UO\371y\232j\246\025%n\275\266\324\322<\227\352\376\273zR}/\221JQP\035u\363(4\227@u\004*%\365\251\003\201o\250\201@$\225SB\"R\220$\205\3020\006\321\005\204\030\246\2343\017\021"
+	.ascii	"\241S\320\241\0311)d\030\003#\2405\337\002D\204\313\032KhPU\210"
+	.ascii	"\336\370\351\272I9G|9\302\237\302\305Ij:\275\242s(\305Iz\321"
+	.ascii	"T\345\342i\244\3600sFvig\220pb\335,\342q\345\260v\213\223\037"
+	.ascii	"s\233\236\006\202\202=\365m\303\355fHx7\304W\365\013\214eG\022"
+	.ascii	"\315\326\373\\j<|\225\350\257\227W\312[\2262\301\206t\202\354"
+	.ascii	"\231\213\301\304M~cZ\335\313G^KWP\337\245\017Ilv\326\f\205M\365"
+	.ascii	"\204\307\f\365S<^kU\247*l\307\360\212\300\271\220\005\266\364"
+	.ascii	"\033\b\237\301\215\023\227R3\306\245\321\306\220J\027\276\306"
+	.ascii	"\235\017\024)9\374 I\020.9v\255\335\274\333\243\017i\266@BW\343"
+	.ascii	"Y\334O=x\334=a\311\036\255\255\221\315US\375\031\210]\253\242"
+	.ascii	"}\211\330]\274\345\031\360GK\004v\246\365\tD\210\230"
+	.string	"~'a](\337<!\226\\UY\301ss+U\036\314\201\304\212\037\\\005&\326\3066\225\023\234x\005\231\224l:\302.\347d\335\276\321C\352E\373@\242\271-D\333D(Kz\320M\235l\213x\271\362\252\357\233\307\314\322\302i 6E\253yL\263i\020\026=\206c/\253\321z \207\232\372m9w\277\365H\204S|\273\213\b\2440\323\204\221~\021\025\273\362\2768rL\301\366w\371\026h\246\363\b}\f\212="
+	.string	"\037\354\212\346c\326\324\214\017\020\236(\330\321-\266_\314\312U4\301\266\361\37451\035A~\027|r{^\345h\237\033\241\311\257\310\324fyS\234\252\374\254\311a\323>*\3264\310\371\352poa\242`\336\024\201g7h\260\205\251\341\356\021,\232=\007*\324\224\277'\305\206a|\220R\t%ge\311rJ\253\220\304{\365%[ey\233\244QjG\355a\225\021\027;&v\264\t\354\"\314\233sg\217\370\374\006/f\037\317\352jy\374\227\201\361\325\037DKH\322h\353\006-\013\301_-QA\202Q\354s=H\374"
+	.ascii	"\316\316\236\217ec\247{\263\0336\236\333a\024 w\356\314\023\307"
+	.ascii	"d\361`jiDZ\214C`\203\376P\207Y\2223\314\226\363\235\233v\363"
+	.ascii	"2<rp\215\274\251*K~\2557\300 \311+B\006\b\362#\2032E\211\360"
+	.ascii	"(\361\264K_p\375\007"
+	.text
+	.section	.gnu.lto_gyroFilterFn.88.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 C\031\002"
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\304\230\036\004\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.text
+	.section	.gnu.lto_gyroInitFilterPipeline.89.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\325\003U\027"
+	.string	"\206\346\216K\240RR:\240\017\235\"\365\035u\200\033\354\325e)\3308?A\021\251=7\034\345(\214\337VO\311K\037\375\377\374\353\301\016\365\307\"\346\246\016\317JtV\306SpI\203x0\212i\003\372`A\306e\345\273o\204\020\"e\222\001{"
+	.string	"l"
+	.string	"{"
+	.string	"\270\333\210\255&\022B;\315\222l\266\331\237;\322\004\232\205\2467\307\231\334\016\024)\215\020\r\261\355\334\261P\032\032\253\235\353Gb\3517\202E\210\310\222\245\237\020\207\234\273\022AE\247q\375\204w\272\311\322/\310'M\304M\036.k\351\016YRk\275\245<L\326R\035n\022\345\310$tK{\310"
+	.ascii	"B\343\361Ng\2374\207\371\334\325Z\227\3214\350\013\340\273\307"
+	.ascii	"\355\256\201\335\016\n8G\337\235J\355 z\351\260\331\356\312\034"
+	.ascii	"\212G\253\265&\330\267\370S\206}\322\313\365\321\360\321\227"
+	.ascii	"{\032\363\345\373\300`\261\354\t\207\317v\243n\270\207\273'k"
+	.ascii	"\033\355\222\274"
+	.string	"\347y\315\346-\317K2o\237\227\317\373[\213\025\320O\372\016a\265\002\235\005\251ZeU\212\335}mmv\301\036uT\007(}\350yAVk\325\365\211\333<\346\313\032\321C\026\n\344Z\353\r\255\207\313e\356\314\271s\347n\233\002\361c\242\374l\237\025\263\354\026\342W\205S\255\314([APF\323\331\303\375\013\224\365(\232m\304\342\362\254#\262\031\214\350\365\362\030<\030d#@j\001;@(\312\327\230\335\026\210_0/\326LuG\b\032\233RP\",\222G\027\267\r,\346D\027\334\277\201t\241\361\250\242{\270\0278\\,X$\2535\353\222\302\353m\200\321\371z<\337\314\213O7\023\303\"\243s\351\371t)$\313\303\360\322\323i\340\361z\272ZT=Y\333\210\306u\245\205\32398\006[(\025\n\374S\216\020P\267\006:\316H\304h\374\030\351\241\215\243sK\n\310\027\207\361\270\302\346"
+	.string	"+\f\005\2360\t\215\265\005]f\337\214\350\365\340W<+\263O\274~\221\036n\356g\367\230\224\017\342\227\016\233\205\364\020\202\004\002\373\252\327\230\260OZ\n**\001U\2501H\344\250c4\243\240\345Qh\003\300\002\031!\273\r\020@\345\204\206\2226#\350\321\225\277\226\217O\204\327\336\243\275\366\205X\274\306\343"
+	.ascii	"\237\200 \250m\244\253\217\311\216F\2770\304\367\024\"8B\365"
+	.ascii	"\263 \026\207\267\305\223\345\200\rY\357\027\312\367N(PQ\275"
+	.ascii	"\277O\023(\021\266\212\233\315G\316\233+)\204\225\307q\236\334"
+	.ascii	"{\251$x8Z\b\222\356\250\346\304\3115\272Zn'\235\313\bQ\375\361"
+	.ascii	"\020\246\247=\033\2352\240\t\223y3\255V\253@\006\336~7\362\030"
+	.ascii	"\354\021\200\261y_N\276%e\005w.~\313\314*\"\324"
+	.text
+	.section	.gnu.lto_gyroFiltering.90.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\330!\205c"
+	.string	"\372\234T\"K N[\351w\022|z\373\0012\336<\n\0372dU33\231c6C\021qh~\003d\305-a\302\314\272 8\305\2012pu\0010\030\360O\236\206\235Y\0359\371\315n}"
+	.string	"!)\367\177\217"
+	.string	""
+	.ascii	"!\221\021\271\367\336)\245\024\376\001\332\0012\002\035T\347"
+	.ascii	"\250\323\031Ju\346Pt~\262\316N\326\271\311:oP\235\231\212\316"
+	.ascii	"K\326Y\311:'Yg$\325\371Hu6:\235\213Tg\242\242\363\220u\026\262"
+	.ascii	"\316\032\254s\220\352\fTt"
+	.string	"\376\261\316>\326\271\307:\027Ug\253:\253\247sz:\243\251\363\211:\377\351\354\357\334\215\374!\234\243\326\306;\367\016I\234\341\n\242c\344Z\257\231;\217{O\217\373\372\022\271\rdYeYx\357\275j\224I\330F\271Q\350,\034t\036w\255m\361i\224\231\003f\237F\335\207\231\333\231\033K\333\255}\327\001\027\357er\247\302\275yY\\e\033\205\352\243\264\321\263\213\322Fye&\354\274\345m\232\022\367c/\206{\257\326\273\361\367\231\327\354\345k\217\020\341\325\365\305\265\245\225\205ueUE\005b\352\203\007\251\016QP\034\236\234\23260-)%!\035\031\025\021\r\ti\b\002\372\361\351)Z5E\317\367\225[\005+\032\325\312z\004\235\026q\n\3159\267\366\342\270\227\n\366\204\210\234\356j39\375Eg\315\221\320\271\006{k\020\257\351Z*\030\023\"\201\235uZ\025\2121<\032\022\305\330Y"
+	.ascii	"\035\213\3121\360\317\257\002\323\270U\225\037\032\247:\323 "
+	.ascii	"\3160}*L\177\b\003\306=|i\251/^\274C\227\216\352\222\202C\361"
+	.ascii	"5\007><\177\272k\247;;o\302\322\033\260\3249\323\t\275t\002\235"
+	.ascii	"+]\351\244+r\216\024\245\217\242\304\271Q\221\037\tN\004\327"
+	.ascii	"Cpo.\264l\rK\021<(\331@\311%\376\343\327>~J\274\207\255\213l"
+	.ascii	"QT\216knU0\"\310V{\315\021\371\303S$\215\236V\311?#Aji\347\221"
+	.ascii	"\232&s|\370\t%\025br\f\241G\r-\025\212br\364;\177\315\321\357"
+	.ascii	"\204\272\3676^{\020\2653w\025\354\336\313nT#\322L\242\231\317"
+	.ascii	"g\346\023\314O \004t\335\302Z\327LB\365\233pp\214\231'vO\241"
+	.ascii	"\030C\364\225|\324ai\372mE\313`\307i9a\253\335\212\267\342\245"
+	.ascii	"\215\246\337G\344\033:\244`7\037\233$\202e\236\347|%\034\356"
+	.ascii	"\246\273\32152%Na\033n7\235F\312mS\303\275\206\t\355\275e\235"
+	.ascii	"\344v\352\266;\305\213\224{oU\007r'\355\362\036o\336\255\362"
+	.ascii	"j\363\341\210\314\234\242\001\303\376\320"
+	.string	"\247\201tCwg\346\211}\357\275\377Jf&K\317\317\241%\016\232\313\300\314*\032\r\231=s\276\td\233\303;'\347\177\206:\353\2766\263\202\033\n\263h\341ml\2216\372\337\203\374;D\3723\273h2a?\3151\306:\375\376n\347\007\242\231'r\222\013\365\213\264\363\232\031CF\207\231\201\242\t\246\363\332K\215\246\345\275fmd\266\321]nd-\357\275_|\235\002\016n(\215\262\230\016o\243\016\nvx\033\373?oM\240`\332\2271\347\235\265\337{\313\374\225\314\355\367\3362~'\314\255\327\334H\372\256\273\325R\347>\266^\263X\217s\216\036g\034\326y\002\353|\303:K`\235m\274s\004\326\271\206u\246a\235gXg\bRg\031\251\363\003\251s\214\323\031\206\352\374\242\350\354\200un\300:3`\235\303\254\363\002\326\331\205uV\300:\267P\235\023(:\263\260\316\bX\347\025\326\371"
+	.string	"\353l\200u.\300:\253\260\316\004\250\316)\212\316`\326y"
+	.ascii	"\353,\200uFa\235\003\260\316'\254\263\t\353\f\200\352\\\242\350"
+	.ascii	"L\302:\177Y\347\021\326Y\204\352\354Ut\356\262\316\\\326y\313"
+	.ascii	":k\251\316!\212\316Y\326\031\313:_Yg+\325\271\252\350Le\235A"
+	.ascii	"X\347)\353\374Au\366\240:K\251\316\001nn\250e\235s\302,k\235"
+	.ascii	"\267y\024\002xG|\033c\342\001\370\023\377\224\007\217\231^\246"
+	.ascii	"y\267\316\371\027\273\265\256\021\233XL\274\227\031<\201\231"
+	.ascii	"m\247\371t\253[\323i\376\225u\256\3354\177n\255\353\025\232o"
+	.ascii	"\005\200o;\203\037^\311H\035\226\266\340\241\304W\241B\342K|"
+	.ascii	"\221\030\361\"\376K.J\034\224\021poK\267'\"\244\344t\360z'M\272"
+	.ascii	"\336\213\253k\353\265\236\253M\204\344/\331z%lkJ\036\231D+\n"
+	.ascii	"\016\324+\377\210\221\254\017\201\225u\365V\217\245v\034\362"
+	.ascii	" \\e\375\007\037\344\215\017\344=\260\342\300\346\251\n\353\323"
+	.ascii	"\336\007\325W\201\240\232\372\017\017\342\315\276\214\356o\342"
+	.ascii	"T\236\031\360\310p\370\301\t\257\311\303\035C\030^\250\343B\241"
+	.ascii	"\207\ruLR\204t\344\304\031l\302\221Z\232S\352\360n\332\254Q#"
+	.ascii	"\030\310B\207$T\f\227*HQ\377\227\006\315\231\025\314\364E\035"
+	.ascii	"A\221\201\262s\370\246\251\330\364\031q\020\243\302\323spzj\372"
+	.ascii	"\r\357\004\346\213\227.M|\\\266\354\351m(J$b\312\202\302\322"
+	.ascii	"3)-%=\322+\335\331a\251K\242\2732g\305\004\244!<BG!\274\n\025"
+	.ascii	")rQ\342\034\312\221\206\242;AF\277t8\177\363\346\276\364\211"
+	.ascii	"+\335\211\022o\342L\214\200\212\274\255\210\220\315\334\017\321"
+	.ascii	"'\227\f=\221\320\220\206\017z!\2665d\022\rY~\304H\021\"jA>\257"
+	.ascii	"d\277\215\327\003\364CV\271\336\262t\020~\036\350\227\372~ r"
+	.ascii	"\271\3173\257\"\254#\244m\374y(\264/\343\236/\276\317/\321I\243"
+	.ascii	"r\346\211M<\b3\275\317\215\353\234\203q k]'\272\007=\357}owX"
+	.ascii	"\236\306\3146\\*\335\307\352\326\204\216\266\316\365\033?[\353"
+	.ascii	"\372\317\315\212\337\206o\305WrW\207\245u\326~\"bV\317\200G\206"
+	.ascii	"\303\030\254\372J\3569\235>*f\313\\\252\276\341*\327z\rC\333"
+	.ascii	"Y\337V\022\326\270\270\264Q\245<X]g\225k\302\346\275\267\004"
+	.ascii	"\363:\245]X\253\264\033\023\272p\235k@^\003d;4\300q\222\305\320"
+	.ascii	"Q\301\016\030\030X\240cl,\0031 \026\013\301cl\003\n\264\310\306"
+	.ascii	"x\220Y\240\203L\313\202\0358*\320\022\033#\323\n\301\304<.\320"
+	.ascii	"1\246\205\001\017\036cZ>yf\375\346\216\240\331\237\215\310\361"
+	.ascii	"qX\215\343s|\247%\317N\270\223\004\356\353a\207\313p\231\264"
+	.ascii	"Q\034\337xf\016\221\"^\311>p]\215\344Q\270\257\253\026\373 ,"
+	.ascii	"\366\376\244O\257W\212}#y$-l\\\322\222gKf65\335\210\316\330\002"
+	.ascii	"'x%3\247\226Nn<\004?\301\243\200i\3113f\363y\257\231\224\004"
+	.ascii	"\177\303\306\327x\t\276\323\250D\3606\276i/\255\320\314\023\357"
+	.ascii	"\234#\274\260m\021|\303y\273\243\3613\276\306/\201IK\236%\231"
+	.ascii	"\331\177=\016\317%\253[3\233g\b4\276\377\330\326\360\314\370"
+	.ascii	"\336{\353q\345L\302L{\0369\221\254n=\362\364H\3646\366HL\033"
+	.ascii	"\205\340{\257Q\344Z\037\335\177\327+\271\273\357;\221Q$\210\214"
+	.ascii	"_b\242\341*k\2767s\\\306\356\312r\353\201\343\331*\344\201o\274"
+	.ascii	"\036\372\322L.\321B\341\255\366\334Y\326\037+\020o#\377\220!"
+	.ascii	"#\210\366eY}<?8\205\220\005Y\205\bI\033\355\343w\226\3665\267"
+	.ascii	"\266\244\035\222\363\356\275X\257\364\353\030\357V\206\234"
+	.string	"F\262\023H\214\0171\330W\257\344^\213\2440V\2653m-b\357E\373\342\023\355\364\261\036I\262\256\255\245\215\302x\032k[\350\356X\350\366<V/N\263\263\314\201\177\321\200\003\f\274\213o \354\027x\006\020\363\314\200'\3540\206;\206v\026P\340[\274\213\027\352\270P\250"
+	.string	"!\2359r\342\264\250\272C\225\3007\341\260\370\004\020`\261\342\013x\004\016x\003~E\0336k\324\034\020\310\002\340_\032\003T<\001_"
+	.string	"\2323+\230QQ\206\314\0301*\020"
+	.string	"\342Kxa*\305\207Y\345z\357\301\200}\212_\332\033"
+	.string	"L\200?\361\003\374\022`\232\024\024\037\300\013\360%\366\2720\363\001\227)\254s\337\307\267\326=\227%\027\024\377\200o{\314t\304\245\336\032\202\204\250\302\320%NIfFFDD\222$\3110\0062\r\b!\314AGk\007\022`\362$D\302 \2101\025B&\251\326\r\002R)\303g\223\016\317\272Y\253HM\206U\214\221\r`\373$\2107p\240g\252\376\356\230/\207\352\373\265\365\323V;s9\376\206\303\3303\350\037NW%@\006\371\3065\\5"
+	.string	"\330\202\334\242\225\235Foa\330\345\305\373\200*\340WM\274\231\215|\272F\347IL(\351\035\363\322\343Te\254\215\227\243\311\303TPa\343\003}W.#\366iw&\355\306\304\274]o\316\325\227+\223d\254\211$X\223!\fR\232u\"\321\252~\227\336G\345\326O\251\212oN\343;\230\211\305\272b\367.\247n\270'\030Z\272\037r\363\362\332\365\375(\203Pzwg\245\022(\272\356\244\020\366\353\361\3530\026\317\360\272\254fk}up\336\353N\022\244)\2423\206\035:V\2769.\240d\352\023\270\370\253,n\302\027\362\244\031\3435\200s\323\334>\216\343|\302g\"\t\310\265\007\005\250\231\323>z\227\304\243\252\001\311z(\370tZ\r\370\311\216\230\300\237t\316[\254\023\372K"
+	.ascii	"=L\270\234J\356S\354\345\013\352K\027\332y\275\246\fNLl\375\331"
+	.ascii	"2\305'\035\360\202ej\265l}\364\316\016\207S\363\020\177\001\363"
+	.ascii	"\024\265\226\257\214\003e\362\032\217\316\350\003\306\323\367"
+	.ascii	"\024\023\333\224\325k\204\017\236E\212\235\333:vH\202\363#6\001"
+	.ascii	"\347\":Hd\315x\376\370=\366\354\261\261\367\304\231\260\2417"
+	.ascii	"\225\221\260@\321\243\234\203\343b\306\325\376\222+2u\335"
+	.string	"\303[\344\320\325\334\312\214E}\275\340\342w\316\362\240p\272p\226|\363~mR0\005\325\343O\352\020\274\355X\325\326\tbgRa\030\375\305\253\2671\362\277\003\236\020\325c\236\265\311~\272\210t\200\233\037X\257SpBH\371>)!\"-\222\034z{\227\271\220\273\371j4\034@*6\301\237\251*::l0\251\217\365\002f\262\200\2632\307 (\027\270+l8\345'\257-\307\314j\007.k\375\027q\023\236\022]\007%\360\242z,\377wK\332nr\277\270\247\365\310@\376r\017\363ua\205Ep\242\232\276\205\215V\335\215\325O\274\347\022\336\3435*\021\026\3050q\001\257\366[\372\003&\026\251\2551\rc\202\346\253\212\036\316\243T\031+^\340\376w\240\036 \\y\231\032\304Wd\n\312\203\245\311-\r\247\321U3\310\263\034\324d\036\255\263\306\253Z\242Sg]F\205\3225\361\030\264\264\213"
+	.string	"@\360\277,\241\300\345\377Bx$\013\277\342\330\374L%<l>iH\220\207\217\312\025\327\t\3021E\b(E4\317\316\320\331\250\354y\017\245U\207-\022\025\fn\312m\346\235\230cX\024\352\310\372hh\206\352\312u\215\257N\243i{\026N\032\213\272,m\276\352\322y\356\372\371\300\346B\270}\367\305\336\352\303_\033~\316\330\206 $\013\250(w\350\210{\344\246KE9\252\030>\204h\222S\001\035\027\032hN9\211\013\331\337\035C6@\261\034\306\214A\311\320=fT\253e0\215"
+	.ascii	"9\3610l\274W\220\235x\017W\002\026\036\f\230\372F&-\250H\034"
+	.ascii	"<\236\364\344d\030t:~\272M\231\035T\344\345\347\205\356 \004"
+	.ascii	"\352\1772\353\343\032lb3\374L\350\306/\034\224\227\230\t)2F\b"
+	.ascii	"-\230\"\013N\320\202\024\033#\204\026L\221\005'h\001\364\360"
+	.ascii	"\343\365\016\312W\314\024\031\031G\004\026\230QZh\276\211\350"
+	.ascii	"\026\f>\245w\001N\244( \300\300d\203\032jI\306\324^2\226\322"
+	.ascii	"\207"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.91.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\260\003e\032"
+	.string	"\206\262\253I\260XQ:r\206\251\033\233\203\360\205C\3517\022\007#\216Ne\303\202\236\264\317d"
+	.string	"\2165\250\036g\353~\274\351\225F35\351\207\330\270\236\220\343\361m\006\347\005\360w\b\310\207\005\224\225\324\265}\261\"D\b\331[\356\224\002\223"
+	.string	"\214"
+	.string	"\227"
+	.string	"\265\366fNma<M0\245\235c\243lKi_\350C9'r\322\007\324j#h\244\326\336\0037\030O\335;\201\360t|*<\2250!\307\263\367v,bxC\267\242+\265\366T\213\303\373\331\273\351lg\037\305\220\316\2253\377\005\247\363\361\264\237\213\277gx\002\303I\b\013\r\237\237\207S\200mF"
+	.string	"\356H\272\303\305\247H\003\374\344\221\213Rc\022\202s\361\r\200\273\315\004\265\326\377\270\354\301\325\244\024ij\255\226<8\237\333\345\266q\330\006a\357\214\362<\247\276\227\302\323\357\177\\\001\256\210\223\214\241\037\232|\262{:ru\366e\255U\307k\303\226\271\357\2169\321\237\2624\314\217n"
+	.ascii	"7\272Q\241\364\213\224v\021\245GQZ\f\245\303P\232R\351i\351\245"
+	.ascii	"\322rJ\337\200\001*\265'?\036\3212\365*\213'\247\352\204*\351"
+	.ascii	"\370\321o\364\373\276\366\221f=\252\263F\214#\241\240\"\037h"
+	.ascii	"\224\221\221\354xB\232j\255\035\306\367\374\237Q\247>\220\007"
+	.ascii	"\311\271O\305\253O\375\n'<\244\246\0162\330)\271\217\234\224"
+	.ascii	"\240+/\353'1\341\340\202\035\220\357$-<U\302\245\373\262d\334"
+	.ascii	"\324\272\354m=\346\315$\024w\334\243V\334Yt\333\022\263\341\312"
+	.ascii	"h\2615\321\344\023\211/9X\301W\372\221\020+\026+<\245{\3401\264"
+	.ascii	"\310E\301\242D\223O\273s\256\334\230\335\"\033\217\232|\362w"
+	.ascii	"\356\201&\267-n\335H\315Xk\245\340'=\350\362\201N]\342\365\n"
+	.ascii	"O\345\376w\fUrP\260\020\275\326Zwu3\377\212"
+	.string	"\360M\331\221Y\354\0179\021#\361\201\f\363R2W\212\325\224qh\275\\\033nlZ\257V\fG\266ji\030\321B\320\252Y\305Z(.\330\300\\7+\0238/\034\026k\2252\013\002,\246\242F%\213\301d6-\231\312\306\265z\251X1\231\n\302\001\303N\264b\252\033\030,\246B\365\352\247\270\243\023/\b\f\206\377,\204\201Y\323\320\2666\256\316G\272\313\216\247\344\026\2243\007\260=vJ\246\326\366\360A\236givV\347\342\352\232\374w\372\"\307\024d%\\\235Q9\246\314\322\034;s\324\366<8j\345\215O\352\340\250\225\331\002>\030Il2jA\005K\002D\25018\344\004N!cJd\202\031M\222\264\001\220\002\031\262b\007\020xW\222\244\320\030|\243\346j\252\247D<\3364\343+\023\r\232\341\236\240w\037\0051\204\225\262\205\343\b\213\341\324\210e\352\230\005\277O\316c/\377v"
+	.ascii	"\004\201\366%\250\310j\021g\001\323S\272V\025\177\027\375\221"
+	.ascii	"%+~\372\274\004\006>\212\302\023\316\203\310$\374E\215\376g\347"
+	.ascii	"\305\245\263\032\272C\355>{\210\320<@QvG\362\215\007\335\254"
+	.ascii	"\362ZA6\342\t\353\271()\263u/p^}+7h\250"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.92.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\245\f"
+	.string	"v\326SB"
+	.string	"Q5\035\360H\033\227\223a\212\202\274\355\263\256q<\243\343eS\344\302\375\217\274\240\342s\216O\032A\244\215\fL&r\300\006\252$x\325\372\377\335kg\244=\270(g\001\235\360i\245\2727\331;\245>"
+	.string	"@"
+	.string	"@"
+	.string	"\273\253\215\334\222\275\316W\262W:\342\3361:=\377\2503P\221l\214\302\357\030\210S\254\"\262\\\"a\bC\3402\2058\352\223C\b\232\363C\301\356z\216\302\017w\275\355\005\266\023\330\367\004kZr\245\323\317(<X\341I.v;\274zl\253\306 a\373cOl\317i\377t\024\237\223\031N\262\013\226/v=\\|"
+	.string	"\344\265\204,m\373&~\342c\317\200\b\374\n\230\312\r)r\004o1\246\256b\273\214\273\373Q\306\247\376\212\306\214\226\210~\323e\022aPw\331\351\003U\215\320\334a\233\302U\235"
+	.string	"\333s\324\005K\271\273\231\327S\013\342\215\022'p\276l\362\233T\204}lw\003\334\326u6\rB\254\301l\034\006\bZ\307m]g\323i\235\b\0168\232\206\3534L"
+	.string	"o\0236\234Va\3338mB\356\261\245\245J\t\200\024d\026\336\200\021\300X\251\006\021\207\016l2\237\372\n\t\224\222\363\225w\031c\032"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"w\031\265\322\030E\231@\222\032\001H\035\264\252\245)\232\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.93.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\007\b\025\""
+	.string	"\306\267\303I\240\326Uc'\217f\3169%3\320=9t8\211\253\242\344\343\211\202\016i\237p(\217\016\202\275\305a%\316PB8\341\241ra\371\220+\202G\301\225\030\035&\205y\203M|\316;\304X\311\025Z\216|\377\357-eJ\001\260"
+	.string	"\241"
+	.string	"\261"
+	.string	"\366\201<H\317\215=\01675*Za\335\373{\360\3234\350O\002\306\017\200\375\254V\227\201\375\264{\354\364\247\231\332\307\316r#\361\032(n\225h\332\272\367\336\354\214\373\334V\243\2453\031\032\203\235\246\255>\376\002\032R>\340\317m)n\324^\234\366b\351\242\246->k\361t\0058~\303*3u\370n\240\n\216\202D\217}\312\217\350X\242\302b\024\224\216R)vm9\n\026\375dq\323\224\021FU\331\200B\246\203\252\342\360\311\327\023@\022\325\n\207f\300 \030\200{\357\217~Ef\215Q\270\367\272\372\200\301;\346\366\003\330\216`\307v\004\30506\356\2754F\374\"\224x\177\327xiR#\241\352e\273\303\213x@\357\275\022|\251\023\321\371I?\r\202W\357\343\301~\336b\020v\365"
+	.ascii	"\002T\277lcP\265H\366\315{\357\265\215a\233\3251g\265\315\254"
+	.ascii	"\256\235\3254\263:="
+	.string	"\253gf\265\354\254F\315\352j\253\237\240&#\tx\030R\367\252\370\342\272T\347T\215+\177\250\177\351G\336\264\277\214\262q=)}!\261\251ar\313\367a\247\311\246\007\205^<\376\343\307\236\373\360\231\036\034\"S\177\311\347\306\336\357\320OCq\253\301O\327\032\317::w\246\231\375\261\346X=-KJ\316\340\n\b\223Y\377\312\261\340\374$g\260\261\201\375\264]\276\254\236y\357\321\204#\177\245\237A\241W\017,\246\372e+\270\031b\001\231\035!\324\372r\n\250wz\025\033\232\325\315\253pG\362%\361N\247\262\341\001\321'\301\250\365\225U\224P\t\331\0373\211\252\312aZ$\347\300P\313\341xE\242\202\361\223\306\271\224\034\004I\347\336\2443\300\352'j\237\274\251%\354\262\363(=(G\336\001~\344:ZT?\265\353\326\211\377\244\242X\3423\271\016\0236\256\021\022?\211\263\240\367\376\274\310G"
+	.ascii	"\373y\243\033;\035\217'W3s\016\004\335N\204\316\215\267\323\361"
+	.ascii	"xr\274\033\317\016\216\207[\316\216w\203p\300\272\017\271\335"
+	.ascii	"-\204N\267\273\245F\240\233\327\306@\257\212T@6\310\237\372M"
+	.ascii	"[\255DW\272L\227/+\306\326l\265\026\226CZAP\027\270X\340f\210"
+	.ascii	"\265\332\220\272b\351\233\032\034R\1774\032mi\234\232b\351\334"
+	.ascii	"\243h\366\313\232\212\242g\243\020\353\t(\345\357\364\nS\303"
+	.ascii	"\244\t\334\f1&\205\252CO\276\251BP5\3106\263="
+	.string	"\031\247\376<9w!6\373'\245w\376\325\363R69\203+\241,\345Z\032\"\277|\301\315\020S\024y/G\337\\\213\313,f\221\246|v4N\200\252\250\301D\304\23032#)()H!\035\360\002\221\031Z7\022 3A\t\004\271\232\200&(\260\3757X\362\003{0\222_X\033\336<T,\251#C=6\215\3751\030\034L\2614\033\\V}\201\277\253z\235\350y\275\240N:\371\215\261\301\235zr\373\003\354\351\353c0\226\340\f\217oX\350\243+\257%Z\036\037\264\207L\376>\3755FK\314\205^:\364x\232y\211\267\352\3351.\026\305bEu\257\361\303\365\364\315\214\3447\316*\021Y\275\022Q\255>g\274\246\320\327\212Z\025'\023\260\016Z\260\337\001\303\017>\265\260\371\2565\326\235\t:\026\237g\007.\346\270\366+\242)\250\206\262t6\"_\200\237\360M\b\322\021\332\364\224\006"
+	.ascii	"x\377;\350\354\353ieG\321\300A?\3136I\236{\326\223\3749(wv\377"
+	.ascii	"\037\3727\365L\212\310\367\2449\302\f\213>Oj$T\326\027.\271\324"
+	.ascii	"\264\353\233mFQ\034.eC\370\334\036\220>\316nM\353Q<\305\0020"
+	.ascii	"\013\36075\273\037:\201\302\027>6\336R_2\217\217+\033F\311\177"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.94.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001@\203\b\274\320\220\r\3773\273.\273,<FN\027\303\200F\210\265\026"
+	.string	"t,\246.\214\207 6\240R\b\330Kw\3441\342'\262\277\224)\005\266T\334\31384\370\034\304\\`\303<4@4\313\203\255r`\027qyM\302\271\327\244k\257\236T\004J9\366?~E?\303\031M\276:\3635\321Y\252\300\005\225!\373\232R1\354\003\254zl\247S\007>!\326A$\273\025\241\223\035a\"\032\2667\266\344s\274c\343H\231\240\246\204\215\016\005\210\311\3566\202\033Dg\371\202\350L?\217\317\350\337\343\f\034PIeM\317\200\205\335uV\226\305\255\267\255`\233b\273\023\b"
+	.ascii	"2\003\316:#h\b\3055\3217\004\216\031{\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.95.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016$\243\214J\240\352g]"
+	.string	"\206\003\310\2341\236S\272\361\024\326\354\337\355\325\243#\224~\361\317\316L1\020\211\342-<\f\243\330\241q\213d\313\024_,\356i\036\332\364\334\224\301L-\003\341\020\321.oj\026\203\235\004\346\265\t\347^\253\\Y\026Bv\340a\237\357GA\250\273\261f\203\255*\335M@%d\003\027\036L\371\253\203\f\343\013\220\2319\013\37582\002\r\023\253#\221LP\nJ\226H#\034?\347++,p\246z\211@\005\035\"\212\220\223\314\253\261\214RE\352\326\243\r\237\021Ieu\212\002\f\2319V\226Eg\375\021\376\204\277\"\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_gyroYawSpinDetected.96.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016$\243*J\240\272\262\226\004\236\247\3136>\317A\335x\nk\366\357\366\352\321\021J\277\370gg\246\030\210D\361\026\036\206Q\354\320\270E\262e\n[*\356e\036\332\364\334\204\271L\r\003\341\020\321,oj\025\203\235\304\345\265\t\347^\243\\Y\006Bv\320a\236\257G?\250+:\243\301V\225\256&\240\022\262\201\213\016\236\374\305A\206\361\005H\006\372qd\004#\221\325\220H\346\347\304$G\244\220\321\277y\312\n\013\233\251^\032\237\202\r\016\n\220\222\314\253\261\214RE\352\266\243\r\236\020Ieq\212\002\f\2319V\226Eg\375\021\376\204\277\"\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.97.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\245\t"
+	.string	"\026\023D;0\345(\035\200\223\241(\227\177\261\340\360\255J*\007\315\022\033\345`\306G\3428\365\334Y\253\277\004I#\210\301\364\360z5\024\312\210$\252\220\237\237\220\025\024\030n~%\233H\231R4"
+	.string	"1"
+	.string	"2"
+	.string	"%'\243<\031\252\224g\244E#F\333\r\273\202\037p\217y\003\356Q?\216z\242\374\247\374a\005\203i\271RO\001\207\335u\266\\\034\267\336\266\202\355\217}M\377\246\351\324\3649\002\021\001\256\303d\273\033\265\001+\023g!\266O\366\306v\246\375\223\243\234\036\372\305\003\273\035&.\273\373\361\202\346\261\263\331\366I\036\2668\213e\034"
+	.string	"\273\333`{\217M \200\354.\203\312W@\037\366\350\nS\276\365\350\233\270\307+'\300L\2255;L\245z\330\337vw\255/\307\207\001 \351\"\264Y\004\362>\f\210\016\374<\2604\002\273\022)\024\321\211>\260\003%\330\223\030}\035\205\347}\335&\334o\253\257\250\035\225\256\234\032\365\254\230k\352gX4\007\f"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\272\214\342\324x\035\230xp"
+	.ascii	"\327H\265b\022&\031"
+	.text
+	.section	.gnu.lto_dynThrottle.98.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\345\t"
+	.string	"\366\321@:@\305(\035\365\245\371\3315\3333\177\210\321rr\261'\232$Ekr\361z*$\237\331\377\271\032L\350J\2010S\223\256\242L\253\210"
+	.string	"\200\b\330\017\243\336\374\237\354-eJ\0010"
+	.string	"-"
+	.string	"/"
+	.string	"\235\307\307\001\312\313H\031\260\273\327\346\005\326#<\201\365\250\035\347\236\234\377\223?\240\200\250\220J\240'\306aw\235\244\322\306\255\267\235`\233\301>'\206O\353\323\371\3643\020\345r"
+	.string	"/\273\032\037\201]E\226\020\333\234\255\311\247\354y`\267\205dew\027\254\220y\264\355\227\334\204\263=\030\031 \325\336SUU#\021\357'\325i\265n\370\276\002\030\273!\204k\252\245\212\032\365\n\005\214FD\371\331\035(\225\303>\\5YO\375\361\031\036\212m\3032\211-\343\016\007\313.\".-\303\264\217G\273>\023\020\025W'\323.\216\2011\013Ovm\030\226]\232n\017WM\226nB*\352\240Z\212Q\205\032\025"
+	.ascii	"2\241e(\360\376\243\242\020n*\013p5\025\245\030a\024\027\"\250"
+	.ascii	"\274D\265B\225\030\\\3355\346X\256\341\"\023X[\257\340\301\222"
+	.ascii	"(\313\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.99.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"=\013"
+	.string	"v\326N= O\234\016\304y\242#\b\207\344\006\200\001\237\334\020\376"
+	.string	"\315[\210X94O\2421\020\376#? 8\202\252R\376\002?"
+	.string	"L!8*\221\213b\232B\006x\340\022\365\215h\223-S\n<"
+	.string	":"
+	.string	";"
+	.string	"\366w/\304\022\370\264\270\200\"\306\356Z\020\204\224RF\371\t\252\364\035\327\203\3532\237\252\016\207\336UC\307\231\"\273{\3215C\267Qu\\\273k\345:\016w\274m\006\266\021\330O\020sj\030v\354\207\376\250\352S\001J\236\356\"J\273\033\346\214%\305\025#\354{6\344\020\333W\373%\016\222\0179\205\037\273,@*v\367\200%\325c\344\003\250\307\351\002\250G\313\032\241m\301\364\234'\230\371\234s\003Z\243\016\035\214^pT\206m\n?\241U\273\253\3007\361Q\005\337\363h\013\030=\367\350c\250\307\303\005\036>\215\220F\247\355m\024~\260\017g\025\t\333\206e\020\266\312\224\t\226a\036XZ\206i\227\212f]\"4\260X\224L\263&\005\214M\250d\326\206a\231\005\3614\207\035\321\217\341#A\322\300\215\r\\\353\342\363\301Xo%\367~etc\332\335\235"
+	.string	"\004\020"
+	.ascii	"2\003\356:F\027\303\363\233\r\240\301BI\205\203P\230\350:X8\227"
+	.ascii	")5#6\253\323\3045\0020<jd\177(e"
+	.text
+	.section	.gnu.lto_initYawSpinRecovery.100.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`}\003%\032"
+	.string	"6\261\253J\240\230Q:\200\017\226\t\016\256\374>s\210\021'z\323\252\353I\355\275\264\205$\201\217\303\273\364\220\277Bo|\267\374/\004y\373_!\212\206\316\351\264\026x\370Y\n\263\243>s.\036\270\326\005\211Xa4k\215\020\"wJ\001\221"
+	.string	"\212"
+	.string	"\237"
+	.string	"&/\322\357\270\316\244#L\220\375\350&\254<\026pA5j=/\234\366%\3109\253m|A\004\314=\270h\t\252\213\266O\355\347^$\273\221}^\325\352\302HH\255\025\202\033\250.&8\201\361b\370\001\343E\313\354\247\2372j\001\334\214\332.\252\326\332\332\030\227]\f\227\312|\335\025\3648\351\232z6\234\213\274\323\035\033\213\207\337=\264\321\363\2435\365l,\2769\264\221"
+	.string	"\220/\210e;\2614\205\241\326j\272c[q\217\267m\332\216\261\027F>94\213\355\020\017\342R\325\232C\301\377q /_\350\242G\304\350wb\343\305o\312\366\033\272\025\031\315h\320>ita\330\337`0h\305\373c\267\234\232|\322\315\272\321\277:u\352\347\321-\236:\024\251\367\3244\244>\200\003N:'<p@\333tV\025\301+\025(\022\241\361\244\377\374\217\276\366\355#\371=\223I\366\005\230\371T\001)p\340\212\240j\255\031\276;\317&ms$\213C~Q\267\\\255\365<l\322\306\001\35339\360\306\0272\214i\352\276`\007S\356V\3043S\372)\226P\224\222Z\272\246:T"
+	.ascii	"\334\302M\355y\017\211\202\240\3348\202$\205\334\325\206\373"
+	.ascii	"\3355\274\320QE\347\326\203\265\344:\230\242C\205F\203\016o\337"
+	.ascii	"\270Z\326\276\367\027%=L\272&$\"\332\322\031<U\001\206\273-K"
+	.ascii	"\177\265,3\032|\022\020HvW\266\337\223\017\371w\177\231\002\025"
+	.ascii	"\005\205C\261\034\310\007dd}\276\021\252\003In\250\372\020\361"
+	.ascii	"\213\370I\365#"
+	.string	"8\261DQ\271!!f\372\271\265\250\025\3477\272S\033\220\001\226q\211\311\324\224\256\026\315\313\345z\301\224\035hL9\363\362\301\234\361P\322\230\344\207\231\227L\314\204\311\324\254\314\232r\003\211\222C\211\322\3052\214\313\013f\023\323\212\301^1\0323\326\242\001Q\272Z0\260X\313\305\200_\"LX\253\346\365\202\265\310s\366\260\356\217\205p>jJ\364K~\336W>G\316&\032!\335\013\341r\324\224\266e\307EQ\241W\343Q\377f\254\220\253\361\302?\371w_\341\300\r\325\224\366\277\031\305E\241\212r\0038[\232\307\365\233\334\211}\245\227\2744^4\321\343\224\203G\f> `\002\031:\243\033\2130G\255\232f\235\315\220cfQ\006N\255[nvNY5/\352\r]\230\202\276\231V\227\024\024oi\234\206\275\255F\261\332\326\"\204}\024\327\342.V\317\003\213\035\024W\032\262\300\302)H%\023"
+	.string	"\231@$\256\276\274\246\221\267CvRi\006$&\270\263p\022\377bfXO\366\264\3022\326\254\212`^\330"
+	.ascii	"\341\333>\356\352\202\261\323W\315\3707\343o\213\275\203\021"
+	.ascii	"$\351\223S\003\316\\W\036)\036\016\366\252\347\333e\341\t"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.134.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`]\005e\034"
+	.string	"\326\360\253F\240\234\315pL\3520\310U\243\243\313[\r\312a\223\254!\003\203\221W~\304\234^iB\250\210Az\333\030!\246\372R\304b!\363R\274\013\323\255\304\214\331\253\313o1\367r\234\350\362X\032\330\204\354\275\367\226R\246\217"
+	.string	"\221"
+	.string	"\245"
+	.string	"\252u\356\035\021\322\335HI\252u!\036U4\272\273\266\327\254\245\277V\373\256\236KjD)\300\331T0\276\373k\021\305bR#J\312\323m\005\306\244\373\004\322\360\013H\r\177\352\217\250!\251>\242\206\277\016\371\277\004\343L\277\030=\315\036w\250\211\332\"\353\356\233\206\234C\2314\004yE\246k\223\206\313\233\222\241 mJ\2062\310\240\n,\206m\n\n\374\t\273\021F\263t_L=\355\366\2508V\350\356\223=\375\250\377=\374\337\360\207>\002\252$j\270\254Y\n\006\331q]\371\234\266l\031\307YT\260\331\352\257\355}p\366=\263=Om\277C\333\353\314\3666r\237C\356q\310}m\334\323\310\375\214\334\223\344~\034\367\"\271\017\311=H\356y\334\257\236\252J"
+	.string	"\250\207NU\267TY\233\256\021\372~(\371\003\241\245\353\0204\235\246\324\003!\244\353\3644\245\210t`!\242I\316\002\354\031\247I5\341J\022\"d\ru6\370\237t\026\001N\223j\304\272\022\213B\326}\3364\274n)\022\2448>\323\"\321\3069-1\250]\363\277\203\232)J`\226)\001\374l<\333-Q\203\225\303d\306\210\301\341\032\347\204\001\363\005\207\3065\345\242?/]V\377%jHc\b\273\256\253\031k\311\022F\362\310\263+V\252\220\"\217@Je\212\b\242\237\224r\310\024\031\302\216K\215/d(\367R\340A\237\030\0310\277\312\237_\270\305+\0032s\b\344\311\311\275t\354\203\372\214tK\223R\301tL\207o\231Y"
+	.ascii	"\227\035\031\247-s\240^ \224K\302\037B\227\210 \372\215\320\256"
+	.ascii	"r\310\354\356!\256\026GW\036\032>/QD{\031\204\313%\221\270\351"
+	.ascii	"r8]\212#\335-\205\211\021(neNw\013\032p\234\212\243\334m\005"
+	.ascii	"\016\227\273\325\024l\266z\005'~:+\330\335\035\036\330\036\366"
+	.string	"\341\337\302\205u\332&\243\b\333\345\315\207E7\274\036\017\367\354\027\255\2507Z\246(D\033\363\3607j\306\32369\023f\003,\260:\274\303?\206\f\253\274S\250\341\202\233~mc\202dc4\264\246\f\332aq\214\327S\262\023\266_w+\357\327\240i8\350\327\017M\251]\246\016O\020K\303\353\261\252\017^\025\026\346e\250a4\345\240S\023\210\214\214\222\026&\351\200\002\031\"\254m\0210\265B\306\320TIT\310\306\030I\342\350\205a\276\247\210x\340Y*\232\326\204t0\322\377r\bL\036\021\377\037\306q\220\373\304\206v\313\367A\340\342<\241\223\022\207u4\201\275\213\366$\363\351{\315\227E\035/\3003\247\nr\253H=\221\223\366\337Qv\331\334\314?q\340\255Jc\004 \363-\272\b%\363\034\311\375\211\365\316\266\235}\021\346\203q\363T\007\366\323\030\344'Mr\204\270\367\304\322\361\223fb"
+	.ascii	"\241\036-\371\345\3555(+\246\225\364\227\037\227\214\317\340"
+	.ascii	"fU4\337\\\235\365\232No\274F\213+\357\355\333\207\362\n\240@"
+	.ascii	"w\b\013\263\323i]2jk\\E$\223X\256\314\257\325?\372\371\001"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.part.0.139.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`K\002M\020"
+	.string	"\326\034dD"
+	.string	"\221(\035_\036k\007\323\255m8p\364\241\n\037+\037V/\263\237d@\365\005\f\243\371\221h0\024\377\225\256\201s\200\221\"\370\255\351.\335U\353\377j\3468\242z\222"
+	.string	"\2523\240\021\216\204\354-eJ\001Q"
+	.string	"Q"
+	.string	"S"
+	.string	"\361!\334\021\021M\260\355\216\b\212G\377X,\332\f\027\025\022\261\335o{\324\r\037=\213PS\033\371yB\221\236i\236\005\251\0167N(\013\217\025\0165(\t\251"
+	.string	"P&\310\331\335\273\236+\250\224\314\3155\315\263\273\376\270p\177\3346g\273\200\235\254V\355pw\327\252\262\235\216NC\230V\230N\230\276\266\351\264vYfv,\206\030\363b\016\t\306!}\fR\034`-\020k\372@B\n\\b\264b~\t\231\021\371\242\345\025\200\265\273\027\361/t\030#\320"
+	.string	"#\266\273!\350\273D\266\306F\2615\017\332\207\324\177\372\334]\222\352\3126(\273\336\365l\311\361\222\001\207\214\032\246\324\341\277\374y\f\210"
+	.string	"\215\227K\256\302D"
+	.string	"k\327\224"
+	.string	"\305Sp\276\207G?\360\362\247G\b{\204\354\361\372\327\323\004\205X\312\005S\312\231\023\266E6\362\264\006\036\237<RW\001\036\t\341\272\320g\363:\316;!\361\266\023P\003\223m\244\363\266\220\001\346\034\220t\033\004\216\3536\315\341\252\312w}\023\241FG\265\247\244)\326\303LWN\b\362\324\003W]\261U\241^\245G)g\242BU\255x~\376\334\305\347\222\313\260x\2135 \240\002\021,\242\007r$\306\257\204'\214\264\303a\f\t\003\357\262\331\3410N\315\323\307C\211#\020m\360\347\303\034@\247Oq\237\226K+Gp\006r&\344\030\312D\335\260\332@3w\316\373\332\332\340u\241\212\237\364\203I:\357\370\260'\201\003\243\310\346fd\336\027CZ:\210p\370z\314\334"
+	.ascii	"_\260@qM\3734\f\2169N'\033\305\351\356\326k\315\030"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.146.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\236\002=\024"
+	.string	"\026\346\201H\340\320(\035\332F0$3\312\003\204\310\f|~Kh\337\210J\004\311VT\200`0\345\343C\301;\tJ\310\200\257\257\035\372\273jW\206f\246\007\207\002\314\030W8hQu\350\033l\304{\032\370\237\275\315\222\275\345N)m"
+	.string	"k"
+	.string	"e"
+	.string	"7\274\241\335p\344\323\rL\237\016o\340\3734\035\344\373\264\357\302%&\262Z\211\311\314\264\20781\005p:\035z\220vC\324\247\232\260^\206\267F\332\247\324\370\321\374\370\301\266\362Y:\311]\356\314\350\2601\332\331B\\\312\001\273\033\300\346\"\037\354\356{\21706\226\250"
+	.string	"R\200x\004\371W:\331]\233D\334\245\333V\261m\301\216;\001(\016\364\007\375DW\373>QoH\346\020\227pm\265\241\231\\\335J\033\032\335\013\026@\017\362\205|\332\311\256;\217?\303G\246\363w?.\302\301\355\216v\267\202)\347\373\3701\3363\273\f\r_\231\275\007\033\270\237\243\335P\344\323\020L\237!2\3729\231}\262g\366\3513>\224!\bW\246f\215\366u\2763;\f\013\375c7\326K\325\233m\007\277~z\200\207\206\367Rc\336\002\277(f\236\177\302\267\320\367\311\340\006\222J\235\372\227\025\362\246\361EU\375\213\212\226\230\344k\324\367>k39Z\214|z\260\304$\353uwW\242\336\254\337\277\273k\275\261\035]\3724z>\374\345\214\326\031\035Ot\377$q5\004\324\354\306$\361\330\021\263\027\260\325\206\224\204Q"
+	.string	"Y\253\t\261\026\310\002_)\260\024(\341\002\250"
+	.ascii	"DI\275@\225\b-\327*\226\302\220\302JQ\251R V\221\270^\034PP\260"
+	.ascii	"\227\013\326\002a\250\326*\305B\251^0\024I\002\2732\200/T\314"
+	.ascii	"\345z\241N\377\352\r\001\351\323\276RI}\302\242-So\271\177 \031"
+	.ascii	"\265\210\251\321\255\222\260\376Ro\2369\237\310O9\361\323+\314"
+	.ascii	"\310\257\261\004\017\016\227\270#8 \200\002\0313\255\003|*\250"
+	.ascii	"h1\330%\3609L\300k\\\320\360\240X\027\214\245A\242\"\020\326"
+	.ascii	"9\232\367\2703\027?[\355#\370Q/\215\275\023Dj\356\216\225\260"
+	.ascii	"\325\206\311\265F\301\335,b&v\005\343%\254\3374\f\270\354n9\373"
+	.ascii	"\264\b$\246\017\306\300\f<\341(`\006&\363\332\245!\2137\206w"
+	.ascii	"u\246\213\265P\034V\303\366\036\232\030\027\336A\361\304\271"
+	.ascii	"\005\351\337{\355\303\003"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.part.0.152.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\337\r\2659"
+	.string	"\352`\344\024>P\346\312p\203\252\277\0274\2512Myo\333\227\264C\333\016J\037\364)\322\314\314\306\344\203\226\314\213\306\032\021\002"
+	.string	""
+	.ascii	"\214\340s\237\236\362\222\241\274\367\376\217\031M>!\204\020"
+	.ascii	"\262\367\2262\311=\001\"\001@\001\215\256\370\375\355q\215\232"
+	.ascii	"\232\005\274\017.v\211:\214\331\025\3634:\216f\237\326f\210\313"
+	.ascii	"\272\256\307\243\3731\337\333\227y\337\036\317\3540\263~\201"
+	.ascii	"\214\354\352P \236\217\f\216\255\"#\203\343\253\220\225\355d"
+	.ascii	"\261\003D\270\256k\326\321u@\324\323\201\356\365v\354\036\217"
+	.ascii	"\313\374\274\035g\336:\227\266\314\273\007s<\365a\326o\213\353"
+	.ascii	"\372\006\214\232u]\027\034\335+\342\321\2527\245G\317/\245Gw"
+	.ascii	"\357eww\244\355\252\273\203\317\213[\241\354\344\230\215I\264"
+	.ascii	"\256\253\326\321\216\262\244\204\264\3753\357{\204\252gZR*%!"
+	.ascii	"%\217\220Gc\2218L\321\263\271I\335\0175\350\275\310T\013;S\035"
+	.ascii	"9^\232re\2348V\222\362\2446n\214d\005'd\311\223g\322\235\264"
+	.ascii	"\271\263\301\337"
+	.string	"\255\350\322\222\360\321\341\204(9R\311\217Kn\224\362\"O9q\215\255\rI\212\324S\327v'is\350\360\310\323\023\313m\016\221\244\232\331\331d\347\311\237%\243\314T+\362\323\250V\344}b\021\2569\224T#;\233\320\2520\337w>S\033cV\276i\250a]\327\275\030\225\257\323wofwC\354\"\365\002\273$J\360\231\304\2562\353\260E;5q?\202h[\350\203\327g7\240Y\341\356\211\363A\261\247\373h\372\340\275\271\223{U\370\314\n\037\267\210\260\257\373mw\267\322\267\327\236 \031/\332\335\024\317\263E\\\3275\302\376\316\361\250\330\317\035\335\025,\370L\026\351\321\367\373~\376\265\005R\204'\306M\356\267\355\246n6\233\202\266\241\354*H\362fa1\357U\202#^\004\207\363=\300\274\006\n y\t\034\360;\300\310kUu\344\025\3605_*\346\235By\003\234\357+\305\274QF^"
+	.ascii	"E^(\"\357\223\023\312\333\304\304\274K\314\253Ly\225\206\274"
+	.ascii	"I\314\213\304\274I\346=b^$\363\036\231\3278\344-\376\314\227"
+	.ascii	"\370\274\177\230\362\246C^4\345=\207\274\235\3622\312{\f\214"
+	.ascii	"\004\301\227uEk2Z\231\240\177V~\346\347\373\327\374\200?\234"
+	.ascii	"\237\316\003w\375\210aiLF\326\354\344\020\256dk\226\216]\277"
+	.ascii	"\2471\031Ib\347Gxt\270\373\375\234:t\320\336\304\201\263\205"
+	.ascii	"\311\246\r\340\271\226\351`\027\305~\333\257\2060n\264\375\325"
+	.ascii	"S\307\226\206\270\266\314\266\203R|k\347\021\"\313EvPJ\314\233"
+	.ascii	"\036\222\266\254\266\203Q\205k\214\366c\031\310\016F!z\263\256"
+	.ascii	"aw\373\247\322"
+	.string	"3f\256W\354c\357\266\313=\210y\353\325\003&K.\264\343\345VY\200\216B\304\206'\266D\022\210I\234\250\226j\006\004\240\243:\335\302b\352\035\207\001\350\023i;\244\bo\b\325\214\336T\275H\340\263\256\353\204}\243\027\252`\3240\0336\244G\371\013\310\034\364\324P=\004dVH\305N\275\353\001Dz\346SC\345\371\201\023H\326aU\230nr\322~\333\224\016\334\311\324SK:A\232\330N}\226\365\255\264\251\017\267\327\347\210\236hk?\267\"F\214H\2176u\216\266Cwk\350R\033\233\251\277<\244l\244^\352+\2652\251\225\372\206\n%\241\211\362\222\215\324C\300\243\036v\262\031\320\222\016\331\353w>\2722\306M9@\271\300u\335\f\315f!\331\272\212\02186\262S\300a\017\373\330Os\023{T\370\226tc\334\334b\033\273\001\227\204\201\006\213\235ri3t\207\307n\312\320\340N"
+	.ascii	"\314}v\332\303\016_1r\2608mpy}p\341\242\013\354F\013#X\207\224"
+	.ascii	"K\006\030X\227\027\f0\342\266`\320\345\245\343\205\326\227W\327"
+	.ascii	"\027\r\256/-\0321X\314\320j\341\365\245\305 j\273jpyi\201uuy"
+	.ascii	"i\035\177\256z\177\217A/\201b=\266\334\343\357\373\311\244T\320"
+	.ascii	"\250 1\353XX\375:{KX\255\240\271\201\257:\253wy4\325\260"
+	.string	"\274\026c\034F-\223c<0_\262\314\256\372u\260(\223\0224*X\314\372\201\003\3758wJ\007:A?\355qqS\201\r4\2023\025H\231\026.4\266S\325\3508K\035\035\202!\006\372q\256,3x$)Y\240QAc\326\007\f\350\267\261\2024\240\013\004\202\300V\355\324\004\216\250l\313\271\027Hx\212\252D\355\302rR\342\b\300\251w\3047\253~\233\346]\262\337\366(\210\254jT\360\230u\252>[p*\243\026~\322lh\364d9Rp\252\256\352\247=+|K\267\006<\325\002\232\250O\370\314\255Zf\022\203\351\314]\365\215\227\250Q.&\302r`7U\312\2058u\n+Q\2510\210;\232D@\237i$\001K\265\212E\255\3433\247\372\177W\226\361C(\260\254\303\352\330\320\354A\236\035\321\214\375\266\177\201\016\250qH\345\0243B#\"A\222$\311p\261\005\3040\005U\235\007\022"
+	.ascii	"6=F\0213h\220$\005%\251?i\fA\242jQ\222K\376&u\355e\222\320\320"
+	.ascii	"a\352fV\356\262i\244\3572\331\037\331\034\363\"\215\272\f&*>"
+	.ascii	"\340P&M\3265p\261xZl\206\005G\275\310\243.\007X8\377\266\220"
+	.ascii	"\302\202nb;vQ\352jR\230\201\025\227\323,\001\024\271L\262\215"
+	.ascii	"\244\221\212\365\263\363\350X\225\031\024X\332\210\251U\031\023"
+	.ascii	"{h0\361K\277}\200\013\370\265\243\252\331\257\016x\036\307\370"
+	.ascii	"\252\301\341\350/\302',t\037\r\332\343Y&\264\020\2441\377k\t"
+	.ascii	"\312\0259e\206\363\311\322\226GG\274e\373?\257\306\237;<\321"
+	.ascii	"\350\306\023\034r\330\265{\342\013\217vm\033W\f\363\032\261J"
+	.ascii	"x5\313\255\367]\342n\263W\246\267\322\271\201\003\222\3333;\373"
+	.ascii	"q\227P#\314\237\371A\314\221\343+\332\001\002O\017\005-\346="
+	.ascii	"K\217\324\237\364\2333\021\201)h\002\270\0275\220U\204VAa\020"
+	.ascii	"}\224Q\226pp\222\317\004\250\320\224\337\236\206\250s|RN\324"
+	.ascii	"6n\202K!\032\261]\324\320\007\345\260S\364\333H\235y^*\244\374"
+	.ascii	"N;I=g\215\273\350\310\"\212~\025\311c7%):5\375\275\b\261E\312"
+	.ascii	"\234\0303\251.\362\354\371\3203\2170uY\003\211Qo\262\270\225"
+	.ascii	"\016;a-\330-\023\264#g2L\223\310\253\270\252\006\207i\332\316"
+	.ascii	"\003dq\352\317\211\253V\273\224m_\202\034\335\017p $g@=^:c\031"
+	.ascii	"Q\002\030m\364\326\240\274\212\332>d\324R\245\t\304\251\360&"
+	.ascii	"\336\324\352\356\355\224(\352@\216\0264x\202\r\371u\322!\353"
+	.ascii	"O\366E\350\230\030v5\275\317\300Q\377\314\375p<\f\220\332\242"
+	.ascii	"\324\347\002S\344\025~?\216\272\f\347\305\220\262WB\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\375\007m\035"
+	.string	"Fo\255Bp*Q:\316\337Q$\037\221\201)<?lRe\302ae\030\343AS\264\317F8\377\252\251o$'\237\304\320\202\271,w"
+	.string	""
+	.string	""
+	.string	"\300\n\006\206\243 Mk\331\350\370\013-\345\273\317O#d\023\231\002\225"
+	.string	"\225"
+	.string	"\243"
+	.ascii	"'\215~#N\205\351\3174\243\317\210e\364\361\304\350\327\201\321"
+	.ascii	"'\276\350g}\271\350\273I\325\264\350\267Y\304\242y\013\257h\316"
+	.ascii	"\262\252h\256*o2\231L\246\350\323A\321<\345D\337X\232\350k\225"
+	.ascii	"%\236H\\\310*\2268]F\364\345\224\"\236H\027\342\207N\020\375"
+	.ascii	"\255R\210\346YU_\300\017};\036,t\240p\336\224C\205\r\375b\251"
+	.ascii	"!\302y\323'\t\274\376\036\354\316\377\260TU\3234N\3759\245*T"
+	.ascii	"\363\367?\347\n\233i\232\246M}\266\374\037\340+K\246\332w\304"
+	.ascii	"\277~\240\224\323>\262\373\224\242\364'A\351Kz\322\377r\322\217"
+	.ascii	"\324\244\017\211I\377\321\222\276\227\222\376\240$}AS}BH\372"
+	.ascii	"\205\216\364\rI\365\025\031\351w\025\351/\342\224H\037\021\017"
+	.ascii	"q:\377\023\362\341\3713\221Br\344\207\257\207T\016_\021\b\347"
+	.ascii	"\225*\310\331\234Q\375\026H\037\320\217\376\321G\237\313\327"
+	.ascii	"\377S\366\372~z\364\373\224<\232N\250>\037^\177O\271\243\257"
+	.ascii	"\247\324\221!\007\006\034\027\316\033\023\3162M\323\237\215~"
+	.ascii	"\236\262\306\357\004%\031.DAg\203\336)\2766\023v\344+\032\366"
+	.ascii	"A\316l\027\2462\037\313\250ij6\266\252\322\345\317\205\332\245"
+	.ascii	"\255\\\026\275\270\274`\250\025\27056G\340r\233#p{A\266\235\251"
+	.ascii	"\322\2120\273P,\013\220D\245\2250\273\274\226\0258\262\002g\302"
+	.ascii	"\354\322Z^\032nI\331\315\256\254\2450\273\262\225o\205\331\005"
+	.ascii	"\260\362\345\354\261\272cav}\300\336\025\2241f\322\21413\252"
+	.ascii	"\005\302\362p\301\330\3127*3\300]\354\302V>\221\250\345\270\213"
+	.ascii	"]\324\350e\0032"
+	.string	"s\2011$\\2a@\276o\266\250\260\004\3471'\223\311J(\204;\340J\006\200\275\370x\210\3102\016\314).\221d\270\024\033\230\261\343\001\006\227\257t&\2079\362\355\254A#\346\324]\016\243\362\001+VUXw\233m\322&Y\211\004\243X_\333[o-\202u@P\306r\254\253\370h\247\273\013\356Fw\231Z\026w\231X6\337\006wk_jj\f\213Uf\033\356\362\270Lp\2730,\3461\3061Z\006\022\260\030I]Y\031\320K\323\263C\257mmB\257\215uB/\202\340\023zo\254\020\275\270u\210\336\\\020\013\275\271\226\003\200\206\250Q\024\013\221m$H\n\n\222\2445\360\002!\032n\016\021\220\210\347\250\"\201\210D\"\301\224\364T\332\302B\204\255\374\b*\242(\023\n2BQ\271\005\273\204\233\317r\250\231\324\321pa\220\274\231@B\311\310\361\347\326\326\335\366\324x&\r\264\371\265"
+	.string	"J\027,jZ?U2\363\362\233\021\352\231\247/[\341\212\201U\177\264Z\001\177AE\262\016^\314\342\200\232,IdY\222%\211,KI\257\372\201)II\240\267\311\002\231\001h\246\353\257\372lK?~\232p\220\331\314"
+	.ascii	"\003N]\036c\231\231\260\013\030\023\364 \231\317J)\3226\342\206"
+	.ascii	" \246\200\020x\213\375\252\372f\376\272\023\345\222\210Jw#\024"
+	.ascii	"R\\\334G,\314\037\307\364\0234\346\270\345\356=9\346\202\266"
+	.ascii	"\246\255\326\006\234\225,\223\204\001;\365\n\342P\237Z\344\035"
+	.ascii	"\351`0`P\231\257\252\006"
+	.text
+	.section	.gnu.lto_.refs.4be8279ffca50d5,"e",@progbits
+	.string	"(\265/\375`\343\003\005\025"
+	.string	"\266jtB"
+	.string	"\261&\303\001spi\254.\374\335\362\341+\316<\310\200\377\377\377{\355`\207\217\033\274\364\377\377\377\377\377\377\327\007W\362\376\3073\341\243\374\315lj6\331\275?o\237\020\"m\3116\265EB\244L\001V"
+	.string	"`"
+	.string	"]"
+	.string	"\334%{\226\276J\177@\371\251_\352\213\332A\372\001\372"
+	.ascii	"\372\241~\307\313\372\237\307;\217\331\237\324(\345&\355\253"
+	.ascii	"\276\200v\222~\252\035\325\027\351\217\312\267\376\353wZ\016"
+	.ascii	"\017w\207q\216\303\037\306y\213\303y\315\201\335Y\234\273\370"
+	.ascii	"\263\336\323\347\364\255>;;\177\245\b\242\362\017\355;\255\354"
+	.ascii	"h\334\026\275; \3261\355.\355)\355(\355\245\376\370G\366\\\257"
+	.ascii	"\017\355\253\337\356\321=\332!v\236S}\324\017)\327\312}~f{\030"
+	.ascii	"\355\tho\322'\321\236\364\270(\273\332\240\317\337\224\177\242"
+	.ascii	"\204\315\343\213\310\376\032\0204\037<ph\177\246\377\206\307"
+	.ascii	"\025d/\3237\360\002|<\325?eoz|\334\243{\234{\034\224=fz\253\234"
+	.ascii	"\035\271\306S\023\017yz\310\304;\270\336a\342]\251s]\347L|#\365"
+	.ascii	"}\3723\361O\037+\225\324-\222H(A\273L\371\201~\201\376KyK\177"
+	.ascii	"\205\237\264\344U}T\037\341\203\264s\240\262\034\353H5\267C\370"
+	.ascii	"h\343\001\337\226je\261\346:|;\361K{\345Ra\n'g\224\023\316\325"
+	.ascii	"&\374\264\242\307\212\277\025K\260;\025\007\2418\007\365\226"
+	.ascii	"j\022\216\211A\305yA\365\264\220\342\254\200\342\2440AB\352\031"
+	.ascii	"\001\365\204\360\340\364tp=\0330\320\236\013n\330\250Ac\206\214"
+	.ascii	"\0300^\270h\301b\205\212\024(nL\330\220\030Q\023\202\246\303"
+	.ascii	"\0322\364\021<\306<\016\223\375\313cy/k\250ahe\234\031\221\t"
+	.ascii	"FF\232J\245\003\240\002\031!\252\362\021p\256\243\205i\377\317"
+	.ascii	"\240\341\230rW\364H\"Z\201#2S\244\200R\322_\bx\013\313\324\246"
+	.ascii	"\t\001\247\005LF\357\240[\002P\023\274\351a[\370\024,,\207\311"
+	.ascii	"-2\323\364\325\023]\225e\265\232\225\370\205\2534\342\233,p5"
+	.ascii	"M\262\274\222\366F\270\273\004Z\376{\330)\321\302\225\212\245"
+	.ascii	"OV\347{\371\346\2026aY\225\310\003a\237\307\2027\265V\342]Y\253"
+	.ascii	"\355\026^\307\231H0\353\234l\326\210U\261|\263\202Ct\365\242"
+	.ascii	"\235\214\330\257Z\236\231,\274\2518\266\2548\355\300\264\020"
+	.ascii	"$\366\221\260\215xK\"\fi\250\007{\241\302\347q2\006HR\0040\034"
+	.ascii	"\326\037"
+	.text
+	.section	.gnu.lto_.decls.4be8279ffca50d5,"e",@progbits
+	.ascii	"(\265/\375`\206r%\323\001z\362\222\245T JY:\215\001Z\332\n\""
+	.ascii	"\311)k\302\256G\330\345/\273-\223\275}\276S\n\237\322\334\256"
+	.ascii	"\251\027h\252b\332\372\377\367}m\363 DG\364\250\273l\333R\364"
+	.ascii	"\n\216\303y\214\030\034?\236wyvzreh\236\373\035\236\036\265\210"
+	.ascii	"\361\232\334{K)e\n\337\bj\n\237\n\033\2246\b\275z\026\bMq\215"
+	.ascii	"c\0328M\331&u\363\f,\006\n\220\270\233\177\341\206\306RX\006"
+	.ascii	"*\306\367Du\363/@\351\007\337\350\013Tw\372\3017}!X\005\357@"
+	.ascii	"tm\215\214\352\3469\035t\362\266\342b\334\374 \022}\341\3342"
+	.ascii	"\367\314\332\245e/M&\234\233w\325\020\341\273p\256\334%\343\364"
+	.ascii	"\367w\343\\9\027\320./\234\273w\341\\\276\333\354\201Rn\035\027"
+	.ascii	"\232h\3415\233\035D\354D\3213\263q!\277\021:\245\222\31177?\230"
+	.ascii	"\245o\265\324\201\031c~I\326\315ya\263\346\346\266\271~\267\317"
+	.ascii	"./\233\273\346V\355~ia\357\255CEY\027w!?\230C?XC_\003\352k=\235"
+	.ascii	"Fh\002yUz\314\325QI\232\271a\306\320\3343vy\315\\\275\264\240"
+	.ascii	"\224!aQh\276f\323\327e\372\272\211\036\2433\003M\017\272\233"
+	.ascii	"\257\271\364m\335\034\226d\030\265\244\335\255\313\302\024s\361"
+	.ascii	"\356\235]^\273K\367\013\306j\021!\024\\\023&\205D\347\353!\372"
+	.ascii	"\332J_\343\320\327R\372\351\237\336\261@\250\3356\b}zF\353\244"
+	.ascii	"]\364S5\275\243e\201\320\313\205\r\315F\23197?\r\323\267\313"
+	.ascii	"\333\306\246\363\325\327\307\266\366\313\366\233\350\340k;{\217"
+	.ascii	"\355\275=\360\214\321\351\220\272\371\252\335-\377\203>Nh\344"
+	.ascii	"Xm\321\022t\263\274\022\273\271\005\035\2601.;n~\332D\377\267"
+	.ascii	"\313\233\345bQn\241\035\031G\272D\271\371)\013\372m\276\366?"
+	.ascii	"h\277\266H\301r\363\323\034\372^$\367\354jq\300J\252\360\352"
+	.ascii	"n6\353QR\325\271\271\371\351\223\276\035\373\207\274\3240\325"
+	.ascii	"\222{\377-\273U\356\330U\336+w\312%\273\313+v\251\330\345\265"
+	.ascii	"r\243\374\202\335\260g\345\336P\226L\n\337X\223*{CO\324$\311"
+	.ascii	"\226\320\r}EQ\303d\3625k\227f\223]\234|\255'\270\267\227)l{\357"
+	.ascii	"k\345B\371Z\017\224r+I\325\260\275\311j\356\275E\210\020\362"
+	.ascii	"\321\002\326\005\265!\037\265\323Wi\203\320\020m\372\350\026"
+	.ascii	"}4\213>\232\246\217\232\351\243V\364Q2}tL\037\225\242\217F\321"
+	.ascii	"v\313\320\257\022 \224\352J\271\323\366\336>\230\255K\024\340"
+	.ascii	"\315G\217\350Ti\203\3207-\020\312\203\372\320Gq\350\243M\372"
+	.ascii	"g\236\276[\367\016\271\\\277[W\353&:\370\016\324\335\312{;Y\013"
+	.ascii	"\242\307Z\020'\334\022\247+h\376)F\377l\341b\245\1775\306\210"
+	.ascii	"\271\371'\024}\177\\ vy\203\374\367\312\326=[\321\332\313\275"
+	.ascii	"\225<\330\211G\230\265\233oC\240>\201\201\201\2016\004\372\223"
+	.ascii	"\005\235}\350\2378t\217\226\005B\177\306\320\317m\364\363\030"
+	.ascii	"\335\223\274T\035R\2606!,\340\240\300G\311\303\006\221\233\377"
+	.ascii	"{\343\332\3209\303eW\335|\247\204\360\325\223257?\307\351o\360"
+	.ascii	"[\2651v\256\310\036sL\357\f\263\n^\021>-e\3220\367\300$\207\322"
+	.ascii	"\314%-\2312\317G\030:9V\315.N\322\252\265`#\316\214\036so\245"
+	.ascii	"U\273\203\363\333\277\033\303\306\261}\327\311\316\261p\254\034"
+	.ascii	"\373\346B\335\247\273\357\214[\303\266\271R\266yi\334&\353g\335"
+	.ascii	"\334(\013xe\330\245\r\264|\267L\273\346W\2717\324\336\373V\313"
+	.ascii	"o\325\326d\324H\216"
+	.string	"u\221\352@\215=\353i\372\331Od\344\222{+\277\001\332\225U\203C\243Q\345\267dl\272~0\337\362\3200\343~\253\346\305\316\315I\356\275\207\320\3303\254L\246hE\3020\263\220\261n=N?\033*\206\232d\335?t\033h\317X7\254d\3232\314\352\230{+o\323~\253\366\233\350\300\006Z,\366,\335v[\006Z\027\016\214\303\016\257\255\271\267R\204\220\b\2362\253#EL\344\347\033\372j\331 \364\002\013\204>7\351c;}\274E\037+\3651\024}\254\245\217\247\364\357\033\375K\247\177\325\364oR\377j\351\337\034\372\367I\013\371\351\017w:\304\027\013\306.;X\271\355c\331\030y\252\272\371\026\214\026\301\336\266\003j\003\003m\007\364\026M\227\260A\350m\023}\373C\237\315\006\241\226\315\266\331e\006\226\313\355\026[\345\247\223r+\367V\372\334$r\324\256\334|[\245o3@q`\240\315"
+	.string	"=\b\364\265@\350\355l\020zU\237i\203\320W@\377X \364M\033\204\036\205\266e\326\212]R`\315n\242\203\343&+{lo\245\017\317\034)s\342\334\374\020\364\355\225Kp\267;x\007}K\001j\003-\005\350\257\376`\201\320\037\033\204\376\226\312o\247\330\261\f\260\324\224\326N\333[\211AC\271e\031\273\371J\033\204j\013\204\376\371\304\222\337\302\370\255\n (\371\355\n\277-\"\221\344\267 \310\030 \351\313 \216\3747\314\345\262\007#\377\265\373\357\232\233\246\353\317,\324\020\302"
+	.string	"/Qb\300\217\212\371\177\001\"\372\243p\002(\342\371Q\265?\007\025\371\363\017\221\377F\375v\310\177\327\273d\203\234\005\327o\245\344\255\254%\374\360\243d?V\300\363R\206\312@~\013\302I1[\3757\314\1773\017\306\377:?Z\207\227`\200\305\271\244+~\234\200\"\017\260 F\370q\026\036\222\377\364\004\316\272\334\335\035\362p\016\177\n\302\177K\374\227"
+	.string	"\377\035\001\b\376\273\301\320\217\235?\355\340\307Gy\307o\203\334\237_ \203\254\003\023\335\256\337\177\351\020\300A\316q\3632\324\230\213\367c\240\234\201\\E\365\237\205\005\341!\343\370o\225\247\370S\n~|\302\002\270\0018D\266\361_5\377\315.\034\354dU\340\235Z\r\377\357\237v\270|\277\245\340\312is3;\301\tB\367p\003\374h\215\n\240M\376K\207g\344\251\337~\340\267H5\376\237\360\t~\324\353\366\375\267\356\277l\376;\367\333\006\374\267\314oS\374\367\314\177\305\3746\002\277\025\301\177\001\177;\202\377\226\375\327L\357\267*\376\013\347\277h\376\233e\032\177\236aQ\360\020\344\001\370Q\031\177\036\341\307 \244\376\274\"\313\270oQ\377\035s\367\177\227~\033$\003O2?\235p\253|"
+	.string	"?*\347\307(\344\030\031\nk ?\275\270\036\374W\205\377\202`A\\\003\360\034\304\217R\021\001\204\023\262\323\b\036\364\243*\200\220C\220\367\177\351\232\031\214\340V9\320\217\246\360\343\275\037O\220a\374\330/\253\200\233?\256 \277\310K\277\205+!\257\031i\305\37480\037\377\234=p=\360\333\265\377\322\310Z\351\277C\376k\344\277[\377\355\372m\220$\026\3229\006x\r\006.\224\215\017\370s1#\375g\301s\025?\312\365\343\026\231\003\030\004\372G\377\376\373\207/"
+	.string	"\334\261<\026\356&\371o\215\253\344\277SX"
+	.string	"\023x\006\3771\370-\327\237\325?\023Y\020\257\340G\333\374\270E\346"
+	.ascii	"\346\271d.\310\302{ \322\360\243h\377=\262\344\307\027~\214\341"
+	.ascii	"\305\203?\252\346\177\363\267\371?\234\337\332\377r\376\377\375"
+	.ascii	"w\363[\374\333\013\372\277\337o\323\377o~\033\374\337\346\267"
+	.ascii	"\347o\377\333\373\277\357\177\340\3778\277E\017hy"
+	.ascii	"N\301\217\022\375\030\356\307_~\354\345\307]~\314\345\307o?\216"
+	.ascii	"\373\261\034\035.\373\361\332\217\331\362\006\376\377\374\251"
+	.ascii	"\224?k\340\317,\376L\302\237Q\3749\204?\037\340\317&\376\\\342"
+	.ascii	"\317\031\374\331\202?S\360\347\r\177\306\360\347\340\237\317"
+	.ascii	"?\377\307\177?n\363c\276\037\243\371\261\230\037\323\375x\356"
+	.ascii	"\307N~l\374\361\222\037\037\371q\221\037s\375x\310\217\263~\034"
+	.ascii	"\344\307?~L\3741\217\037\357\370q\216\037S\375\370\306\217\247"
+	.ascii	"~L\343\307N?\336?\026\301\217A\360\343\025~L\364\343\027?V\372"
+	.ascii	"q\007~\\\364\343\r\374X\370c\013\374\270\002?\236\300\217W\374"
+	.ascii	"X\002?.\341\307#\374\270\001?>\361c\021~\254\200\037'\340\307"
+	.ascii	"\b\3701\b?6\300\217;\370\361\320\217C\374\030\203\337\026\371"
+	.ascii	"m\223\037c\370-\334\217\323\037_\360\237\313ow\376\373\363\337"
+	.ascii	"7\377=\373\357\335\177\307\3747\371_9\277\r\362_3?\026\300\177"
+	.ascii	"\337~\f\342\307\025\374x\202\377V\371\317\342\277\033\374w\350"
+	.ascii	"\267 ~,\364_\020\376\237`\247\374V\312\177\263\037s\370\361\206"
+	.ascii	"\037\007\3758\303\217\177~\354\363\343\236\037\363\374x\347\307"
+	.ascii	":?\016\376X\377\030\3778\377\370\376\330\376_\361\343\3777\360"
+	.ascii	"\277s\376\233\360[\237\337\366\374\226\347\377\330\377\247\377"
+	.ascii	"r\377A\004\006\006\006\376>%~\r;\376\b<\t80\221\033\247\223\251"
+	.ascii	"(#\201\250\215\300,mR\300L\2415\236\354\230\"w\225P^,\334@\202"
+	.ascii	"\322\270A\256\200\021s\232!\365\342\352\252\312\315\250\224\325"
+	.ascii	"\332\034zt\230\205\375\270\031\215\032:*#\204$D\304n\306h\f\024"
+	.ascii	"J\005\035:\240@\2356\356W\216%X\2360VZ\305\206\017)\2476KC\007"
+	.ascii	"\224W\323V:\245\013W\032\272C\360\374\225y\n\273\371?\003O\036"
+	.ascii	"V\242\200\334\214\277|1\367\215\273^\346\230kN5'\233S\314Iw2"
+	.ascii	"\3171\247\336\271w\2269\371\316\2763\314\231w\2429\345\234fN"
+	.ascii	"\277\323\356ts\2229\361\3168\347\335\231\346l\236g\316\272s\316"
+	.ascii	"\371w\3029\333\234o\354\362\004<\301\374\224;\347\316''\0240"
+	.ascii	"\266\261\270%'\023\346\031\006\210\313\250\034pE\354\374\362"
+	.ascii	"\225\214\201\243p\215\017R\224x\315\346\351%WU}\360\245\304N"
+	.ascii	"\370\to\\Fu\002\227\027\346\336\333H\222\213V\202JrW\355\bd\212"
+	.ascii	"\3111\305\264:\001\257\217\233\305\001\231V\327\0255\327\252"
+	.ascii	"H\002\230x\315\260\275\225U:\354YO\223"
+	.string	"r\343\220\300\306k\206\235_'\030XR\371v\2730\361\232'\340\211\345\204\313\361\001\214j\337\270\246)\311:\"\373\276\235\200\027\356\242\3412\252\007<\3511\253\260\260\307\234\3028\244P\205\021BF\205\327l\236O~\002\236^\247\223\020`\347W\024%^\363Z\235\200\227\007\231\035v\302PR\230x\315\023\360\354\002\266\361\232\315ku\002\336\036lx\315\3465r\002\336\264\353FE\013\257)\304\201\265\275&\024\371}J\033\204\366\204Y \364BH\364\205\260\364\205n\350s\b\324\347\340\346\215\247\007\226>9h\330N.g\333\271f\227\247\333\271\345g\332\251\366\234e.\331B\256\222c\016\271\235b'\232\265K\313oaN\267SK\256\002\223\334[\251\363G\245G\337\205|\016v\372\034\344\3649t\321\347\240E\237\203\025\375cg\203\320;u\216\375D\373q\217S\312yv\313\354\274\0307\233\245blp"
+	.ascii	"o>\207/+\347\025\273<\227\247ryR9\311\254]\032\2121-\314\345"
+	.ascii	"Y\206\232\271\203\003\246\211\335\352\202"
+	.string	"\340\241\371\034\252\3649@\351\263\312\216\023\217-bn\376\2068\372\033\374\3649e\350\347\030:\347\257F\332\315>i\364\317\266A\350\265\323\337\360\246\363\2061\375\rI\235\225\026\bMf=\035_g7\177\003\227\376\17729\227\330\345\331\344\274ql\003\337\270\320\330\331\344\304q*\301eT\017\300\023\302<\233`\253\323\306\007QT#\340e1E\334*8\360\226\2409\t\230\274)\254\233\277\241J\237]'\013\270\013\327\217d\327\231\343\344\362\301<\273N\"\030\253\007J\271\2336\330x\315\260\023\311y\3444b\227g\327Y\344\270\n\347\260\200-\251\324\371\033\232\364\203\370\364\203\320\350\223\353?\251\316\252s\353j\311\221]\261\335<\344\002\340S\237\223\233\037\204\247\277\001\017 V4\360\246~\034\016\227Q\3513.\033\314\261\035g\326\t\344\304:\205\234Zvy\0069{\374\274:}<\237AN\035;\306\222"
+	.string	"N\312\300\304\232\"\322\254;/l;\371Au\332j\331 TC\234~\020\233~\220\232~\220\025\375\240)\372A`\032\333\331 4\004\013\204>(\211~P\226\236\341\303\247\207E\344f\037\\\230\205\034%\310\330\3441\233`\3440\026\233<f3M\tW\034\314\344\307I"
+	.ascii	"m\232\273\305\365\307"
+	.string	"\354q5\203\231\001\361\017\274\205\313\250N(\"\305L\202\227\300I\356\255\364\201\204\314\312\230\023\f\245.\003b\273\034\304\303\223\324\3369.\220\302\005\367\270]\326\315\332\031\331NM\037\264m\3451\233`\346\276\206\313\2506D\341ma\356\2751\025@\254\305\316!\340I\0363\f\363x\222\307l~\3410<:&\306S\222\241p\205 \345I\036\223/\007\236N\247\324)\343\234\312\314\034\347\214q\3228\243\316\031\371\315\t\225\347\3446y\315\2713\233\374\227\335\2345\316\246\363)\367e9\271\231\341d?\273\314\200X\306\261\016\274\303\007\356\302G\310\270\3441\233dS\262\362\203(\252\340\r<5&n\343\202\343p\031\325\b\\_\360\276\262\030\027\001\244l\3451\2338\t n\202\223!\310\234\304x\311\200\370\013\306\302eT)\360\274\340$\200X\n\036\303eT:\313S\030\346\336J\300\\\226\325|\020E\365"
+	.string	".\2620\031+'\371 \212*X\003\017S\311\200x\r\263a%\333\b\\`\230T"
+	.ascii	"q\025\334\002W\210)\033\373\270D\360\346`*\300\274g\3178h\263"
+	.ascii	"\222\307l\356\255\264>\256\254!\013!_C\032\235\323\b\371\020"
+	.ascii	"\351r\"s\3635\314i+Y\r+\223)\236n0\3652\232l\306.\363\231\347"
+	.ascii	"3\031K\246\373 \212*\002O6\230{\357|&\347}\256\204\0238xO:\210"
+	.ascii	"\020\221\317\214|\021\242\3635\f\321\267q]:X;#\013x\222\245N"
+	.ascii	"N\n3\323\345,\031\316\303\223\024\004\274\264\340\345p=\301\275"
+	.ascii	"\267\322\300\210}\ta\355\322P\260\215e\272<w\270\036\250\237"
+	.ascii	"\r\305$\214.\307u\350qRn*\364\b\022\262\261f\036\223\313\344"
+	.ascii	"\272\214\227\305\344\273L&\333\331e\246\313a\3163\263f\234\f"
+	.ascii	"\371@s\372@p\372@Z\364\201\314\364\201\306\364\201\276\364\201"
+	.ascii	"\226\350\003q\275\t\335&\276;\0347\037(G[\346b\227\331-ki\241"
+	.ascii	"\205\274\246&\351\226\331\362Z\0065g\2420E\340-h\374\314\320"
+	.ascii	"\374\fm\372\317k[t\346P\301\232\263%k\351\251\322d\212\310\315"
+	.ascii	"\317 E?\303\023\375\fI\3643\020\321\177^>\253\375\027\354\206"
+	.ascii	"\3454\016\234j3\344d\334\234\3172\332sZ6\3339\215\003\255\275"
+	.ascii	"\235r\232\017\340\336N>\326\202\260\026D\026\343j\202\005\315"
+	.ascii	"\317 D\347+C\317\313\030F\246r\334\234\201\005B\237\341J?\203"
+	.ascii	"\216LF\345\370\2657DN\025*\030\t\323Lr\354\231J\023\232,yn"
+	.ascii	"\302\262\024\260\340\227\225Z\032\2730\260`\231\261-n\242<\203"
+	.ascii	"\3416Y,,iBve\265\366%{Y(q0\220\351\333e~\342\004\352\317\n]\362"
+	.ascii	"\331\311o\242\203\273e\247\354\341\275\27193\311Mt\022GS\214"
+	.ascii	"&R^\344\346\374X\022\\C\246\316\310\022;W\304\311\226)7\037\203"
+	.ascii	"\023=\004\243AI\271G\3542#\311YB\033 \311B\262\221\034=j\\\220"
+	.ascii	"\314\355\354\031\177m\331H\227\275q\203)usf!8\267\303\352\313"
+	.ascii	"\315\307\340\244\377L\304.s\221\275\020C\274r\334\3746\231\353"
+	.ascii	"\177\360v\221\341\203ss\336\242\332h>n\036\222\356U\335Y\271"
+	.ascii	"\371?L\255\225\263\356\020\2471U7\377G\215\376\217\234\376O\027"
+	.ascii	"\r\004\325\3521e\352\346\377`\321\337 \rF\003ueK\322\222\341"
+	.ascii	"2\030\r\007R\326\304q\323\354\221\245\262\215!<r\216\254#[e\037"
+	.ascii	"\371G\336\221\257\3542\367\3107\216\351p]\230\334#\343\310U\270"
+	.ascii	"\214J\243]\251c\342\345\036\230\314\335Zs\301\024'q\3344{`\276"
+	.ascii	",\303\332])w\223\007\2605q\33441\336\030|\327\323\204ao\"Yl8"
+	.ascii	"L\017,\006\337}0\245M\204\b!6D\230^\031Bd*\245O\260L\037V\332"
+	.ascii	"\315\377)\323\377\371\322\3779\242\363T\n>\254\265\233k\\P\263"
+	.ascii	"AVv\363\177\260t\246\221g\234\241\261\367n\376O\225\376\217\r"
+	.ascii	"\375?C\345\250\034\303.\263\214\267\301o\246$\263\f\374\227\235"
+	.ascii	"\254\335\325\317\336\\a\311,\0033\261\037V&\3233\274*\314\275"
+	.ascii	"w\007\021\"D\340\035bF\376t\316N\030\316\335\272\340kM\0347\315"
+	.ascii	"\374\224wn\262\313\354\204\003\217\325\340\275\013m\220\235\360"
+	.ascii	"\234\032W\2260\263\023\216\203\345l\205\370\022\023\307\215\210"
+	.ascii	";&H\2324:\377\007J\337g\216\276]^\r\006\374^N2\307\203\312\315"
+	.ascii	"\367\371\323\367a\243\357SF\337\347N\177\003\374\006\257\301"
+	.ascii	"\023K\356\255l\332%~\203\335`+3.[9\337\347\213\276\017\234\376"
+	.ascii	"\217\373\354\022\373a67\321\301\230\211\016\260\037^c\317\254"
+	.ascii	"\335\325nb\303\001X[\0347\315\275\225B\"\254\0324_Y9\337g\211"
+	.ascii	"\276O\021}\237 \372>9\264U\332 T\310\002\241\367\251\241\361"
+	.ascii	"\231+\033]\2247\277'\216\306z8\357j<<Im\247!\004h\323\344\306"
+	.ascii	"\257i\306.\261\336\205\204\256\036\326\330]\316\357\201\323\357"
+	.ascii	"\331\242\337\203\246\337S\246K\334\331\263\213\027f\352\351\346"
+	.ascii	"\367L\321\357\001\323\247\322\211~\217\021m{\264\264\325\212"
+	.ascii	"\303]\356\016\033`\024\217\233\261\033~\263\313\303a\270 \224"
+	.ascii	"r/\217\3045\035\271\371=W\032\306\336{\333\303\241\351\341\320"
+	.ascii	"\367\304\3206i\201P\266\037o\261qv\316\2469\336\312\270\334|"
+	.ascii	"\0368\032\265@\350y\366t\026\037\035XhR7\237\347\213\376\006"
+	.ascii	"d\330\n.\243\322X\272\232\3404\214\305.\261\032\276\202\325\360"
+	.ascii	"\022\243Y\273\264\355\244\343\2027Mh"
+	.string	"\252\b\211\340\301\322\214\303\003\315f\370\314\247\306\022\031In>\017\0203\036*\375\2358J\\vs\230!\231\301\247\324\323\337\201\323Vi\201P1<\305\342\271\2013\343Ll,\n\006\303\312-_\356\230D\331z\202\275t\270\310\250%o\376\316\216';R\332\256GG\306\032W\226\233\2573G_\317\006\241\327Y\243\257C\247-\233\005B\257\263\005\033\311<\302\024ar\363u\316\364u\302p\021\037;&]\266\334|\235#\230H\220!\026J\f2(7_GJ\377\307B\354\022ka Z8\b\316\262vi{W\021@\312\0200\261\346\336[H\204\005\"\367T\227\263\216\261\202lfr|\335\214\365\265[\267&\253y\363/\240\321\277\020\247\177!M[;0}\267\022\375\013D4\206+\013\204\346\026,\020z\251,\020\372\013W:{\357\237\2353~Z\322n~\006H\3643\300:;\323icSo"
+	.ascii	"\303\362\2153j\340\240]\247\365|Q\022E\t\272\205\243\216\210"
+	.ascii	"\230\232*U\3642\214\351d\214\026\035W\256\227;1\346\326|\271"
+	.ascii	"Y\223i+i\034\273\031l\254\\\227m\355h\212zc\365$\212\215\362"
+	.ascii	"\256\261dC\332\002\343\306\306\364\026\031&Xa\342x\251A\201\242"
+	.ascii	"\305\314\222\350L\201K\242D\312\265\330\323\216\0317\353/\035"
+	.ascii	"\326\343\365\305)J\030\330\016\025)"
+	.string	"2\202\214\341\002\310c,\312\245\223\341\003\316\023\f\274\236<\321[d\216\370d\345\355Y\335|\f\212\350#\372\210N\3425\217x\260\231jr\235\334\363\2612\005\346\357f\235D3\211\233A&G3\321K\332\210\030q2\003\004\302&O+\271Q\240l\211\331\335\254\221|\315\213\025-\314\252\377A\224\016\007 \234\233\217\001\016MD\023\321]BzS1\313b\246\\\364\252\3544\013\327]{>as\262X\335\254\213\374\t\021\242\267\254\225\215c\205\362MV\330\336W!x\334\250\334\375\351!\327[y\210\236\217\256\233\265\326\327\266\224\351%Asu\245\261\204\264\232\336Tp5\265\367\326D\325\242\314\376\202\\c\255\275\301\361\360r\263\006\362\2655`\216\310\335\254\177X\2671y2\274\334\254}X\267\036,\2650\2532\255C\353\320<\264$w\326\346\320\356\254\256yX\2574X|7\353\035\2003\302\260\t"
+	.string	"I\215\327\320U\326\312\306a\257\246\316\374\b\013\262\260\267\344MS]W\355\351|\365\265)o\3268\276%L\2279Y7\277\215\276\361?\2306\345\200D\3217\264\r5va_C\202]\326\332\230\321S\030\310R\fK\036S\206\f=\303\376(\237\360\276$O\267\246]\235\226\272\236\261\327\263|\333r%O;i'\035CHo*W\3000\367\276\n!d\205L\236\206\272\216\261\347\263\231d\2327\353\247)a^\254.\250\213\023G\357)e`b:\252\211\006\026x\275\371\276\222L\3229\177f\200<\3229\251\034+[VmC\354\222ae)\340\331\243\r\0240~X\336\274I\377\204\264\232\334\370\320M\341%wZ"
+	.string	"\002\027&m>\375\213A#\306\235\020\2707(hn\376\0055\326\374k\3226\307P;\213\t:6E\026\005OY\275Ai\343\267GW\007\346\346\264O\343\375\025\221\273\371\001\350\222\262\t\200R\215\232\224OH\253\311MJ55%y\177\364\321!\331{\312waN\324\232,A\376\007K\234I\302\344\346\007`\b\336S3x)\232\364Mh?A\355\254#@q\246\300\2704\267T\220\020F,\b\231;\363\024\315\034\032h\306\266\225\346=\325\373\203i\036\0319+7\337\0023:%\363\264\314\037<\201\350@\003\345\346[0F\377\351\230?\270cd\216\216\315\315\267\200N\337\2028\375\264\316\246b\304\3303\241\335\264&\004\330\223\027\rt\246\232\220|\335|\013\226\332Z{\206\376)]Jwm\220\360\2637W\032\333\246\272\322\200\347\f\232\333\324\315\267"
+	.ascii	"\212\327S\345\005\273av\231z\245sCO\333\211\t\001\202h\240\023"
+	.ascii	"dM\221\270\233\345R\247\2742_n\276\005]\372v\254,\265\222&\275"
+	.ascii	"\202\206y\226\246Y;#\013\210R\307\304k\360\235\207')\022\306"
+	.ascii	"\3160\367V\246o)\226\264mK3}K\315B\020\323\353\222\202I\277\244"
+	.ascii	"q\251[\n\227z\261\313\364-UK\337\322\345\002\306\3140}\374\246"
+	.ascii	"\240\365\370\311i\031\tU\366\230)[\312"
+	.ascii	"\305.\323\266\247mYH\272\006\002\335\324\223.\035D\360\260\031"
+	.ascii	"\243\007\004\315\177\272\226nQv\365\335\234j\271\352!\027\343"
+	.ascii	"\346[ C\377i\026\273L[\320m\302\332\342\250\371\037\324\211C"
+	.ascii	"\302Ew\363-h\322\007\341\247S4M\206\211\265\247\017\342\214>"
+	.ascii	"\b<}\020t\372 \276\350?\265\202\357\226`\374\350n>\b8\235\216"
+	.ascii	"\245UR\262?\350#\306\306B\226\233\017B\213~J\345\177\360\004"
+	.ascii	"$uYn\316bO\247\374\301+\327$i\343\346\203H\323O\303R)\177\260"
+	.ascii	"G\217\211Z\331\315\007\241\324O\301\262\004\372\371\2709\215"
+	.ascii	"\242\243@<\311\340\002\326\026!@\240<\215\362\247_\230\311\n"
+	.ascii	"\201r\336\334\314c\201\320\013f\350)\024\035\272.L\262\254&M"
+	.ascii	"R'wo/`G\230\373\352*\304\205'e\201W\222O\235\3348n\260|\201"
+	.string	"\240\221$I\272\344n\255\275\223\351\334\327\032s_\005\t\021\234\2233\306)U\362t\311\232E;#\306mNWWz\344j\355\275\2436\f\275\2574\246\026\243$\255Gj\344\351\021\353\226\253\370\305\305\200\373\037\314VmS\302\334\374\017|i\221\264\b\032\307\325\265#\254M\314\237\335\315\377 \247S\256\224\013\305\013\356\r\367\204\205\331\204\355\346\1778\323\322J\207\334Rm7\2355e\372\350\322!^T\336\234\335\374\017^\372O\263\226i\226\235\013\261\235\234>|\341}\300\n\022\004\335q\367\336;\231z\361j2\227\260\211\301u\363?\314\270\272J\177\374\307i\357\247\275\263|\240T\236\354\220\247\033g|<\375a\347v\250\b\261rr:\261s\002\245\345\346\003\200O\377)\217\224\307\341,\225F{R\302\004\200\333\216\035\030K\350go\256$\3113\375\2479\3542\315\201\261\260\324\336U\037|qQip"
+	.string	"0\321\177J\225R]\001@\217\0337\320\2577\250\025\236\001\206\256\311\315\007\300\f}+\305\246S\351\024zdho\"ah\225\216\n"
+	.ascii	"\241\016\225\322\260?\312'2B\222{_\205\350\231cFn\2473\236\322"
+	.ascii	"X\273`\006X$"
+	.string	"\315\315i\214TJ\307\220\346Z*\225\312p\262\344F\2174m\246\354=\245QWO\315\r>\300\n\324\244NN\227\315Z\3318<PI^\2058\255\246D\235\271\371\025\204\321\351N7\272\303\356]u%\365\301\325w\346l\316\034\364\213\002\270>\2375dq\224\334\374\n\246h@@\024\217\204\255\241\317\255K\017\307\324\315\257\240G\263\211\302\251s\353\021\213c\346\345\357(\234|$\215\025\232\233\337\346n\375\017\356\320\310\341\226u\363+p\322l\330\240n\334\256h3oC\372\332\034us\3261\001\003\375N\265+\270/\277\276\236\026\334r\364Pn\271;\213q\363)\270K\2032\323\240|j\324\240|nP9/3i\266\360\366\216\362\215-\307\330\270\271M\237\002)e\3203eP3h^\036j\306\266A\301\334\316\031A\350\336P\275\243fx\320\3308\322\344\346\267\371\026']fD\271\371\024d\351{"
+	.string	"\024\203\216\021\203\342apw\207\342\0057U\bp:P(D\370\266\360\234xqM\335|\017w\372\036\312\344\320:9\224\016\335\333*\265pP\355+\252\020ss(\235n\262d:\272v\204\2059J\227\302Ay\002\327\323\365%7\347\346{H\352{\270\372\362\305C\214\270\270\t\372\364\357\226E\341\340\326\224"
+	.ascii	"\343\232\200\213\376Q7\273D\335\256\r[\265\267\323\325\007)}"
+	.ascii	"\372\354GR\354\346O\240\314\222\005m\343\240\r\027\333\321\266"
+	.ascii	"k\304O\317\355f\264\005t-\016\213K\336\032\272\245\206[\214/"
+	.ascii	"\3116+R\2267\243Z\316\033N[?\334\334\3746\366\354\177\360\344"
+	.ascii	"r\223f\355\346OpD\377\250\332\022UC\245~Bm\"a\311\275\2574\340"
+	.ascii	"q\"f\366t\363'\340BC\263g\326\312\306qA\206\016\261'\315\275"
+	.ascii	"\275h\220\345\360\2259r\363%\b43Cw\330\276(\311+\276+W\320\035"
+	.ascii	"i\027W\224\244\004T\312\312\372\272v4%hBFv8\022\266SU\t/7\252"
+	.ascii	"\255\301%\340A\205\312\335\022\332M~\037\274\360$\210\2322E\212"
+	.ascii	"\216\016n\364\217JY\242R\356V\211\224\313\323\r&\031\375\243"
+	.ascii	"`v\211\202\235d$l\247\034\027x=)5x\207.^^\350\227\335{\357\253"
+	.ascii	"\335\264\246\003\253+T!~\024\312\321\257\23618\346\337\315os"
+	.ascii	"\222\375\017\n\341\2204o~\0074}\024\t\232\344\250\222+A\235\350"
+	.ascii	"\275w\223r\343\020\232\342\326\265\243\271\257\256B\244\177["
+	.ascii	"\272xA\223G\235\364\275\311iB\2338\265\321bs3\023\264\317),\356"
+	.ascii	"N\371\001\221\363\207.\261|\231J\f$T7\277\303\023\375\337\376"
+	.ascii	"\376\350v\242\332{\3478\225\233\352i\007\375\355\355im\210\237"
+	.ascii	"\307bk\301\377\274\367;\200\244\334Q]\210\354\275\255\237\366"
+	.ascii	"Zs\002\362a\237v{Cm5-`\253\nj\253\207\324r\253\n\203\324rk7A"
+	.ascii	"1i\302@\265\267\232\244\226{c\200\202jB\241U%\265t\332\030\244"
+	.ascii	"\226\273j\307\270\253\262[\271\325\264\241\2646\206\r\265\235"
+	.ascii	"\366R\253\352\203\024\324V\225\324\322\251\n\203\324r\253j/\267"
+	.ascii	"\366\317\206r\242\232\001\265\2510\354\345\326\232\275\324\252"
+	.ascii	"\372\221ZjUI-\267\316\330#5\220\370\361\200#\262\344\210m\223"
+	.ascii	"\202\3327l\004q\242\372\261\223Rjm\275\275mZ\324\246\332v{[\260"
+	.ascii	"w\020-*=\247\036\226\355\311\356\306S\013NZV\271\367\356`\343"
+	.ascii	"\211KkC\3315\331m'\005Eko(OG\333\306\336{s\320\244\264\333G\254"
+	.ascii	"]\023\221 {*jo\t\266ro\033{7\331m\267\367n\332{\247TA\224{\377"
+	.ascii	"\370\221J\332\260\261\367\225\220\215\035\244\251-j\357\233v"
+	.ascii	"\206\255Jj\311\2455\324v\266Ln\031\312&+5\245\265\223[o\213J"
+	.ascii	"/\233\312\366\324\336\333\366\351d\225\0166\250\021\276+Xs7_"
+	.ascii	"H\216V\352\260e\251\355\270\331.Q.\264HPj\357\252\013\234\\\351"
+	.ascii	"\332\321\334TW\032\234b\334\310\260\335\214\022\221\252\301\205"
+	.ascii	"\307\315\027\222\323\027\352\242\265\320!:?|8\311C\323B\263\f"
+	.ascii	"\260\361\222U\260P \267G\215'9n\276\220\023\364\207r\271\367"
+	.ascii	"\366\3319\203\245\256\315U\023,D\314\222\037=\362\223\236\273"
+	.ascii	"4bn<P+9+VFn\276]\242V\350\0165\037F\270nFw\234wP\230\350@sx5"
+	.ascii	"{\360\335\254\307\2104\221\240U9\f0\r\357\n\025\026\013\027\212"
+	.ascii	"\304\3411\370\303\363\243\021j\022q]\205\303\025IE\241&\021W"
+	.ascii	"\035\245$\242\340\212<\"\r\213\304\024\305\b \211\024\250+N\030"
+	.ascii	"\025\325u\210\264D\2044<QA\321PUaT$\252\030\032\221\\\234G\310"
+	.ascii	"%\024\214\212D\025*\321\360\270\nI\020U\220\302qh\202J4<\262"
+	.ascii	"\370\331\200\307\004O\n\024 \020\024T$\016G\340\371\321\210\""
+	.ascii	"\242\022\t!\017\250\307\024.\\\030\327\037\025\033~4b-\252IE"
+	.ascii	"\307\241\261\305\005C\"\0054\034\207*\322\211\027j\221>B.\241"
+	.ascii	"\360B-J\211/T\024E\307aQq\270\256x\241\026i\370\321\b\020H\""
+	.ascii	"\342\212$\256\303uE\n\310!\213\243\212\264T\244\036\021!=\374"
+	.ascii	"h\004\221PM\"\256\305\245#\t\"\027\252p\250\001i4DJ\241\"\265"
+	.ascii	"\030\"\211(T\243\240\037\215 a$r@"
+	.string	"\1774\002\211\2044$:Z\207I$T0\036\217Vc1u1T\221\362\212,\032\211N\027k\221xDB\223\214E\025\205\222\321\b\201\"\"\n\352\013\342J4\314\300\244d<\341\263*\2210R\002\"*.\351\254*R=\236H\241\221\322\316*,\032)\235E#%|\264\032\025U$T]\201\210\314LJF\242|\\\225p\221\232\026\251\310\245\214L\177\024\032)\215\340a:\256H\242\221\252\002\310\002+\261H\004R\221\326\325x<bQd*\322A*\241P\327\241\nd\013\021z4\254\352\b\031\202\200X\024\rU\025\023 \217K\310\241jB\221:\344\260\301\250H\344\331I\201\204\264T\364Q\213D$U\211\210\302\005\243\"\261X\\R\221\002I\f\200\206\021\220D"
+	.string	"\214\300A\002\243\341Q}!\002\322R\322\022\021\221\b\253:\202\361\310d\004\242\203\272\252HJI\306\023\310\022\214G&\243\017?%F\254\307\241\322\bu\035\026)M@-\032O\3100\264\2420\344B\t\002\030\212\324\3658\\W \207\0250*\022\223\216\"\254\310#\321\305\207$uE2\255\020b\030!\351htqT\2256\234?\032a\264\324B-\"Q\204D\\j\241\026\031M\b\032-\265PQ\370\234h\004\222R\022Q\210\201\361\3104\302\005\036\025BL>E\242\322\n\025\206\0268\032S\370\260\3509\352\021\026S\254*RUa\244\244\341D\304\243ZT\215\3649\360\240"
+	.string	"\036|"
+	.string	"#\375\007\007(q\200\022\350?8\300\320\320\001<\030\322\367`\b\037W\024\212)N4b5\036\231\214\262*\\\213D#\nLDEu\035\"\365\250\302\242\022R@\016W\255\n\325\"\243\tGUIU[\354\240\310\235\0365\211\270*\031\215\020\350qq\002\205\bz\275\200\024\032\025\211*\212\206\352QF\"\016\327\214,.\035\217\352\013\2436*\022U\\X\215\212\304\243\020"
+	.string	"DEC\214\024j\344\004\324$\342\212\"\323\265\270d<\241S\244S\244\"\265\030\026\033\200,\252`,\3420dT$\026\211\303$U\005RE\"b\"\362A\n1$-!\361Z\024&a\244\360\205Z\264\"S\023LXQ\204d\024&\241+TP\213\302$\3648|\201\005`\204\302G\230\376h\304J\264t\\\221&\220B\030\352\272\224\204!\005\"#\222P\210\256\305%#\221P\230\036\325\242\nF\2410E\036U\344RQ(\324EEb\nB!\212\024\246E#\021IDR\205\302\340*\\\221D\244\237\037\215@\252JLk\001\212\324\343\360\bY"
+	.string	"\022\310\225\330\202\304R\321\250"
+	.ascii	"0\226\212D\244\002p\340\201\320\203\017`\220P\213\226\220\210"
+	.ascii	"\212D\022G\344\022\t\020V\030j\021iX<\252k\221(,\032\252\307"
+	.ascii	"\243UI(\344\360B=*\t\205\350\212$\"\t\205\350p\035\026\t\205"
+	.ascii	"\350qxD\224\325\025\210H\241\020M\201\310\210\224Wb\261\204\225"
+	.ascii	"X$\006\025S\024\r\325#z\\Q *.\245\030\256C\024ECU\205\361\310"
+	.ascii	"4B\207b\n\236\037\215 \2560\324\243\212TT\034\222@\\a\250@k\321"
+	.ascii	"\305E\n\211T\025'\210+\f\025\003q\205\241\346\325\304\006FG"
+	.string	"\021R \032\266@B\032\022\351 W\030\252\316*T\211\210/T\024\310\245\026:\310\245\026\030)$*\255Xa\250\272HU\225\220\347*\214@\t\271HD\241\210$BU\243\242\006\030\025\211EC\025I\207\250\204\304H\341\t\023%\2540TMd\202\210\1774\002\271\324\002)4a\205\241\362 \221\352\261\250h\230\252/\206H+\226\224\222\364\222PUbb\201\\j\021\204\301\302\205\212BUbb\261\022\213%\bE0\001\205\317\217F@\200E\t+H\254\252\321q\270~X\221\352\232a\250X\211E\"*\202\t(T\344\022\352b\211\0010\326\323\305\022\003`\034\317\027j\021V\221\206D\310\323xT/`<2\031\351\023(DX\205&6X\213\304\024\271d$\276P\217(dPa\250\342\004\212\013\352qi\035\036U\245$u\325Y\1774bI)Ih<2\031\021\021\rI \217\352\013\342\261h"
+	.ascii	"\252PE\211\016Jx\260\244\224\004T4\022\327%$#R=^@\n5\250\302"
+	.ascii	"%\245$\035tEZB\252*\212F\342\222RR\006UX4\"\"\r\205=E#\"\222"
+	.ascii	"\b\302\025Hx\200\272\016U\250B\236\022PX\241\026\031M`*\032\026"
+	.ascii	"\005](!\355\270PB\022\256p\224\202\211\r2 \225\214G\024G\265"
+	.ascii	"\210\370\202\210bI)\311g\025\032\rY\030\211\251\321\220\005q"
+	.ascii	"\205\321\200\265X\302\222R\022\217*\354!a\375\321\b\344\321:"
+	.ascii	"LJ\262H\241P\311\005\020\f\342q\035\232\260\032\217=\306#\223"
+	.ascii	"\321\217\221\252b\270\016Q\020\021\r/\244&tV\244\360\205\212"
+	.ascii	"\342\205\212b\205\n\303\343\216\006$\236\240u\003\035\023\033"
+	.ascii	"\254J=KB\b\254H\241\316\320\252\324\203aM\301\"\205:\347\220"
+	.ascii	"\272\016W$\252\256\303u\305\252\324c\002\211\034*\251`D\352\031"
+	.ascii	"\032:\256(\374\254H\241.\246`BRR\022\001h\375\321\b\022EcR\222"
+	.ascii	"\221h\202\365\310\210\250\252\200\"\205E\303%\017\020[\364\224"
+	.ascii	"hq\207Z\\\023-\356\320\360\232\030\336!\030\327\004\214;\304"
+	.ascii	"tM0]\023;+\220\240\256C\025*\222R\322p\005\021\321\320GEN\300"
+	.ascii	"\310\302xd2\n\252EF\023\212F\342J\244\256\306#\n\310!\t\306#"
+	.ascii	"\223Q\007$\243\221\001\302\323\250H4\032\001i\270\204BE.iX\205"
+	.ascii	"0\324\242\"Q\210$\"&\r\213LE\302\365\310\210\210\344\202\003"
+	.ascii	"\222\bC\004\243\245\026*\212\024;E\"\214\241\tA\243\022\214\006"
+	.ascii	"\250/\216K'\\(A\240\310T\344\223\002rh\002\222\bC\004\343\317"
+	.ascii	"\372#\tnTR\217$V\243\361HB\347\250\022\221\224\210+\322R\222"
+	.ascii	"\020\004RhDtQ4\356\260X\213j\222\372\302h\202\361\310d\364\301"
+	.ascii	"\205\022\222P=\016U(:\016\2170\034\221.\204GF\304#\241\212\\"
+	.ascii	"\022\032W\235\241\025\216\204D\304u\270\"\205&\\(!\001\r\r\231"
+	.ascii	"\020\256p\244\301\204\320\205\013\343\272D$<\"Z\215E\341\352"
+	.ascii	"\302\210\024Ra\310$\\U\244\013\027F\037\025\214H.\216\352\213"
+	.ascii	"\b\244@\244\036\021\361\f\251JL\253\320D\017\323Q}a$R\217\030"
+	.ascii	"\322\"$\343\021R=\036\255\302\"Q\t)Ta\310\224a\tE\321H\\\207"
+	.ascii	"\307\026D\244\341\t\343\221\311\210\303\nG\302\"q\025z0\264\026"
+	.ascii	"\211Kz\205#!\214a\222\006$\021\306Ph\264\324B-\022n(RW\"uUQ "
+	.ascii	"\215G&#\036\243\022\fUXd*\022\016\271PB\312\260\n?X\213\304\245"
+	.ascii	"\364CC'>L\340\204\0214\321\b\343\221\311\210\004\362hD\026U$"
+	.ascii	"\211\"q\230D\202\350\210$1\242\303Q]\221\210.\204\306#\223\221"
+	.ascii	"\260H%\272 \")%\021\221\033\376\007\231,-\230%MZK\304|\300\304"
+	.ascii	"\2611\243$yv\027%%\230Dw\335\365\305!\023D\242\267\234\302\002"
+	.ascii	"\217h,=2Y\2144\323\275\037^A\272.\231>2Q\352X\340\301\003\370"
+	.ascii	"\006\307\257\210\256\262V\250\220\274\021\331\272U\304\306\224"
+	.ascii	"A\256\340\3269\303\310\22037\250\366\303\206\234\233\261\260"
+	.ascii	"\202Z\317\340\204\025B\337\325\216\240VP\210\227*o\312\202B\202"
+	.ascii	"Yw"
+	.string	"\323\231A\273Wa\340\320\335\374\001\320\320\301\036\301\036A l\b\020W\005&\026\374\361 \220\303\235Qi\374\356n\016\3728\\\0345\26217\007\257\016'G\307%d"
+	.ascii	"[\377A\036(\237\017\221\2538jVf\314\214\220\t\271y\f\356\206"
+	.ascii	"\016\364\013\235\303\306\254-\007\232e\363\212kV\205A\300\031"
+	.ascii	"\264\247\233\2038\2028\320/ \\|\372\017\336@\217\2443\320d\335"
+	.ascii	"\331Hi\370\2640\004\007\231)5:M\336\256\330\3248\303[\374\272"
+	.ascii	"\210\321\270\201\027\322x-\261\232\241\323p\2231`_\244N\270\235"
+	.ascii	"/_\250\230\310\320oosb\177QG\333l\244AY\336\254\034\303\201#"
+	.ascii	"\211"
+	.string	"V\020\n\245\003BE\210\337\315A\247\240\023\372e;\370\n!F\377\301\246\223l\316\n`\227\2335\034\rG\007Z*\252\276\002\214\331`!\253\271\257v\204\3705\340u\240\236s\246\013\016\214\226\343\023\327F\b\333\315\0171E\3538'\331\335\234%oB8\321\277\376K\371\316\300\320\2445\333\314Y)\237\3507\1774\304\344\334\270y\373\364\300\301\303\361F\t\005-\254\214_\212\346\254\271%\207\356\323\273jM\b\027\315F\307\310z\373\342f\315\f\271\270,G\230\347\226\035\235[\233\233\365\236\336\323iHh\302\200[\327\216\260\020:\362\362t\2325%\276xi4\327i\230h\021\362vF\303q\373\372:c\206\254M\340\216$J\355\006E\271\246w\026)\342\005'\315\315\317\240\215&\243\311\240tvS\205\311`N\337\351;\215\027\334Tl>\310=i<\334%F\025#Rn~\006T\364\355R\213\301c"
+	.string	"\233\251\"vEh|\355\231\325\241N\226X\3124o\356\322E\207\021\322{\fJ\232l%.m\317]\207\311Ubg^\272\334\254\3454\027\252</\275\233u\234\006\363?\210\271\274\242\316h0\372K\225\263\266*e\302\220\t\321^N\245\237\032\264\263\f\222X\260\350\267%9\340\200i\322X\006\211\322n\327og\025?3\264\233\365\232\346b\231\350yMqi{\242\203\213\313\033\020+^e7k\266sK\215>(W7\353-'\331\0051f\330\240\264\240~matZZ\270\340\303*\206\226\233\177\273\374\232\316R\226\f\210X\250t\304OV\206\tuQ\016\306I\n\344\230s\b\025\0257"
+	.string	"\223\025"
+	.string	"@HH\"\221\212\206\325v"
+	.string	"\024"
+	.string	"\017_\276\232vD\036mJZ\032\244f\004d\020\200\200\fr"
+	.string	""
+	.string	"Yq%{``\305\367\003\356\301\242\363\\\272]\030\017\366l\300\227C\207\341\016q\021t3\036\307\217~0\b\024x_C\346\020F\006\r\001\211\211\326\357Q\260\226\257\037)\353\214\343\224\341jU\210\354\235]p]\331d\343\336Ml\245\363!\203\200\022\030\230\005\264C\bTO\340\233\353\271b\267\030zi\242DA11\365\371\n\\0\375\324\245\373\255\272ta\240"
+	.string	"\3458\334\310\377\317T\226\223\3510\214\337\223\b\022"
+	.string	"\223\357s\245\237\272X\272\364\031\220[C\327\225\355\306\245\203\305\020BH\024\203\362R\271\221A\350\020\016!\006z\255\361^I\262\030+\322\221\202\006\234\360\251\3305/l\262\024zQv\264O\377\031\273\0322\321\020\331\035\302\303\027\355\r\375\266\335\\.\234]pO\204P\fg\n\\LQ\304\177\031\363e\335\375\361\265F\322&7z\307\201\013\357\356DiD\340\272G}E0\361{\317\321\365\257U$e$\372#\334\301-\376\212\373\341P(\345\022$\221\234V\300\321\242;\352\026\351\017]\266&BZD\343!\217I?r\036x\t\242\256e.\301\350\204\035\321gQ9\217\252\362\360\364\274fJ\333\204\361\3011\263VC\004\207\304\360\311o\311\371T\247d\275\204:j+W\247j\3429LD\374x\241\211\247\217\370`["
+	.string	"\350\206\317\211\037Q\253\266\342]n\323D1X\301\013"
+	.ascii	"%"
+	.string	"t\263h\246\235\016\306\f'\375W\r\243\376-\372\005!\265 I\246\207Z\031\0169&\0366X\331Gx\202\241nX,\002\252b\361C\025diH\375\344'\263\272h~?\234\362T[m\263\022N1\363\357S\236\273\016\325\253\232\021\270_\363nl\227\333\263 {\0045E{dX\217\322\314\225s\004\2309\367\030\20276E\246S\211\017\334\f&Pk\241\317\032\227\366n\204%m\021-\277E\n\270\3711\201\226\263S?7\331|\243\007f\227N\024\325\305_\200\016\366\230\272\346\242o\3771\030F\324 \233\n\341\022\310\371{\221\323\221\002tH\232\262bTL\353\377b\225X\024fb+x}\277w\345\334\314\335\221z\274\246\226\215\003\370\006f\320\267\220\"p\235jIp\0254)95\221JD\f\"zJ\302\212\350aY\347\361\355\314\306\2649\366\321\210\365\343\b\033\275\002}\325\205\223r\270\341"
+	.ascii	"\360\274\262Z!e\031\004\270s\304\210.I\371\213^r/\314\361}\027"
+	.ascii	"\2558E0\017\334\326\361\320\214\"\034K\020\320\203A\264g\225"
+	.ascii	"E\215\024\265\364\310\205\275\217E$\241\026\313gY\317(\243\275"
+	.ascii	"x\027|\235V\201\004@O\352dnL\bU\217l@,LP/\364A\276\252Q*de<w"
+	.ascii	"\216\216-(\207\031\335-[\026\0131\350U\360\005>\247\361\375c"
+	.ascii	"\260Ldg\bW X\270\370\016\306\3040\315\2617U\330\030nD\227l\003"
+	.ascii	"\270!\224\310t\240\340\374c\325[\231\236762\314\243zF78\252N"
+	.ascii	"\037\266\344\357\345\256~\025\300\002\037j\311\317\252\327\274"
+	.ascii	"\003f\342\017\253\001_\337*\320O\030\3242\261\370\211M*\351\333"
+	.ascii	"\025\307F\275\331P`B\353\243\3673\tG\342\337Z4up\200>\224\347"
+	.ascii	"\204`\263\bq\276\026\342!\216\360\336;\266\243\312%\265\002y"
+	.ascii	"\243\264\206\350,HM\r\016,\301oA\002g\362\024\253\f\200\374O"
+	.ascii	"u\376\362\334\375P\337\221m\233\036o\356WgAB|CP;\360\374\354"
+	.ascii	"\237\272;{V\374~ 1\225\303Q\241 0\342\3613l8\213\267\376\226"
+	.ascii	"E\245 \\X\332\370\022)\024\020\035A\216>\336\230\325\341\257"
+	.ascii	"lZ\003H\\\033a"
+	.string	"\325\002EA\364F|\306\2233;\330_\035\216\312;\206\254\273\235\261\374\nfD\177\267Yi\002,\025Mr\300\266\331G\312\356d`\3403.\332\305U2\007\301\337~\tl\346\023q5\025\340\177\325\246kK\231O\034s\\f\326\314\205\030\332B\215\237\017M\371\\\244#\"\017\220\341K4\225\267x\250`\373\202_\324\027\346\201\022\016W\t+\242\3478#\034P\273\347$G,'\364\212\367\324\032p\026Z<\2420\323\350\210_\312\210\366\033\025\257\226\005\224\356\204\347\313b?7\312\235\307!\ng\006sp\003\364\205r\347\201\f\375\350\030\221>\350\2629\232in)0KrM\214\336\003 \257\327{\306\237n\340\220^\033\216\220\031\312\371\212\016\200M\025\334\262\223\374\021Bf](u\252\354\332\332=SP\373\246\002\f?\bt\264\"E\247C\002\020gqV\242\004J\263\223j\321K\b+$-\254"
+	.ascii	"D.\200(\313\216\352\203Gm\033\233\240\312\323\276:\017'\203\222"
+	.ascii	"\030\345Z'\344\357e\215\tf5\257\005\276F\343\234Ut\220\027\211"
+	.ascii	"\267\225k\222YU`\333\214\316\247\242Z^\237\036\233'D\314\310"
+	.ascii	"\227\3300'\225\bzQc\013\260\356 \016\025J\023\220\244\361\230"
+	.ascii	"\201:"
+	.string	"$\004_\256}\374\266\340\341\233F\215F\027\215)9<\264\212k\334\306\361\340\206bV\316\303\002\232\001\t\322\321\024\035\336.\236RAj>\223\277I\252P2\315\336\277W\355"
+	.ascii	"m\363\340X\217\037~\241g\217\304\365l6L\307A[\375\036\362\340"
+	.ascii	"_\023\376r\361\231J\305BUv\233\331\231\bjl\"\222\247\0058G$\230"
+	.ascii	"g\377\372 \247\277\007\013\306>G'\307\350~e\327Z\025\300\230"
+	.ascii	"\3506\34696,1\226\315\t4\226"
+	.string	"=\301J\302?n\225oD\370e\337D\336\266\220\013\332R\326\222\031\030S\201\031\320%\301\236o\316\314\350\216\326\227-*\265E\325-\276+\266\037P\347ybhws\250$\342\365\336^>\250\341\266\307\352\024U\2755%\351\3340uX\005\251\247\353\206\224\312n\300z\326\307\316,\3516\224\210\267\213\265\257bp\nw\261h\037\031et\036T\ts,\202\024\3412M ]1e\343\201\3624\n\fp\350\320.\2366\266\200\334\237E\206\227\"k\316\005\246\006\377\225\007\324\267l\261\003w\177\337\254\302\254\316|\276\335\030\200\001o\023\366Q\n\253e\204\314*<\033.\301\373\254\001=\241\226df\371\200\266)\372\350\017\364\"\227\306j\005\0201#\245/\004*5\003y\260o\" _\260\260\312GY\272\310d\246l\344d\376\023\200\356v\f2\005R8Z\255eu\305\215\003XD\353\244\306A*\025\203"
+	.ascii	"\365lG\206U0\007m\016\242\212s0\246i\304\341\321\337\345\274"
+	.ascii	"\321\316\327\347\363\364\223^P6{x\341\217\205\203mpX\265\236"
+	.ascii	"z \220\026\177'(=\212\251\304\337\207E\263^t\2775>]\032\244\231"
+	.ascii	"\235\227\036g(\360\020\001\023(6\342\247\353Nn\025p\266\260\370"
+	.ascii	"\203\364\013\347\370\207E\346N\217\273\234\032\310\007H\264\351"
+	.ascii	"\003\266Y\306~\306\177\243s\324Y\216\200T3\316`\177u\023\n\327"
+	.ascii	"\235\035\326\3208\210\356\324c\341\270\255\003\212Te\362\260"
+	.ascii	"\327\311\262\351I\021\226\346v\330\204\310\t;ni\351\366\304\016"
+	.ascii	"\027\211\360\356i\271\253\033\026\302O\276\363\270\202\204}\304"
+	.ascii	"\302\036fV\223(\031\013\226t\317\357\030xf\336h\261\342\333\257"
+	.string	"&\375C$NXg\231\335\361\235B\310M\264g\330;\3140\366T\2714\262\346\230\242\361:w\366\240\275c\262\260K\225\212 .\363\261\rZ\256\366F\247\022)\301 \030\317\311_5\365\330\247.^\200\342\300\201\231\345\360'\265og\b[3\310\317\227+m\270\253\273t)\205\210\256\234'\034H\240\216\3148\275Y\016b\327\023\340\322\t9\241\212\375\300\243\376t \315*\325P`\241\333\013\275MxE\320\340\377\307\t\343\257\343\ri\350\035\027?\364\300\226\305\377:\260\342\342\264\035\264<\274\336\210G\225\360Faf3\021\227\031\331\345\207G\204Y\177`n\033DK\036\241s5\321\026\340\310\252\2025 om\036\016\366O\332\265Sj\201\003\243X#\354 \250\027\035\205\351\007/\347[\036^l\275\314@!\223\321\232\031\353\246\207X~\026\250\222-\306@g\337\034\373?\365@\"U+\364\036\340\333r"
+	.string	"?\035\r<5t\320\341\025\035\352\255\207t?\005\ta\376\016\313c:\006\202\n*r\216\007\t\247\032\031\315\3640\210\207\331\213\277@6bqa\257 \033\324\264\302\242\277\274\242x\334h\207\032\237A2\310}d\326X\220#b\357<?\277\326@\321\236H\226\265\013\016C\276m~\251\341\004\031\351\247\b\344%\027\213|(h\240\254Hf\fj(\350(\336k\300\367\354\235\240\343#\"\241m\266i\377\332\220I\200\030H\240*\013\225qNET>L\336\256\207\311\217*\322\316\262\214\211\227\313\265\254\007\324\023\311\220{/.\025\302,M\211hP\251%iB\261VK\205\214z\305\325|\326@\361e\275\037\t\215\360i\352\022\206\271\020\001\332\353/\214l\031\344\037V\232\003\374\020\017\025Vnl\334\f\231*\241\001\271\375\177T\002Z\024\377V\022uk\300\232\017~\026[5\027\211\247R\200fb\024$"
+	.string	"B\364\222\243\216@\034\210\230i\\\233p\\|C\350OJ\3459\301\357:*\217Q\212\t\261\245+aK\327n\321\023\017\b3\336\351\301\307\246{D\324\006V\203\"?nZ\004'\030\276\202\256b\032\243\227a\312\203\252\224\260\311lB\322\312\352=^\217\002\344\354\t$\315\350\324\004\351\001\300\034\003\b\224\\Ba\301\304 8\023\2469}\314\205P\252\226\351D\226/\320\004%?Q\236 =|\265(\267\231w\204\007\006\260\276Q\226\327\326\027T\031\355\201=t\017i\"\007\346\t`\321\225\r\270}I\032\342,?kT\266\365C\r\352\200\261pRq&$\260\2071'\274\034X\245\273\315"
+	.string	"\254\017\240\002\001\330Yz\177\037D\"\205\006\320\360fto.\235\271\257)\245[i\257\030\020\232\240\353y\335\343X\215"
+	.ascii	"\235\260\257\023\317\216\265e\330M\327L\001J\"\375%\b\374\226"
+	.ascii	"iF\314\304#\243\302\350f\367\022>\2072\270\023,U\357\373(\021"
+	.ascii	"\201\\\255\243/\022`\177\177-~\303\214W\306\345\"-\336T\312\236"
+	.ascii	"\f7\254\337\365\376\253\313\325\371\370\024\r\320\325&\235\271"
+	.ascii	"M\307\2105\021\220\360<F\325E4\331uV\251\243\314\005\233\326"
+	.ascii	"Tv\311\007D\f\203J\034\013\206\007\361\3116O\235\260[\3469\273"
+	.ascii	"s\336\002L\b\210\310\211\364sR\364!\020A\270\316\203/\322\336"
+	.ascii	"\307\364jx\367\021o\361^\265\306\245\345\233\363\255\340O"
+	.string	"\237\271\273do\"\331\217\n\032RH\307T\355]NJ\324\007\202\336&\272\243\357\207B9\244\233\300\0239\\\311|\234\267?&.@\366I\236\344\357\374\310\232:\0072\236]\360\246\037#\262\374C\\'yAJ\005lc\257\356\216\362\r\220\344P\324V\256)\306\206R$$\035x\216\303\323\320GF\201\201\347\001\233\351\024\256`\375\312\366\200\311\307\344\355b\231\351\234\274\\\263\r%\327r\242t#\353\2369\023I\242Y\265\347P\242\345\377\207\256\263\n\351\362\243cs^?\240\343`\355\241\212\317\321\375\276Y\211\207&w\213\2640\301d\250\352\f}\276[3\346%\223\004\300J\375\216\215I\212\324\226H<j\303\277f\242YC@\371\332\326\364\250\316d2g\213z\261fC\245\321B\032\201\317*\332-\032\007<\225\027T]2,\374g\216\177\303g~\322\340g\210\017*''\n\203\2564\203\275#\236"
+	.string	"\r\275\232y]RML\253zI\031\3536&F$\177\254f\030\327\026\227\311\312\t\260u\261L\304\327\0272\334\357=&\255\030\001\315!\3105\334\025\321\0232\274\220\275\b\020\256\363\373v\335\246Pa\256\320\270p&.7\331Z\234d\210\275S\243\247\306\377P\354\332/\204\305\365\304\0179\267\036\352\212\t\344@\223;\213Wl\277\307WW\334b~\223\302\r\027t\366\207K\320;\025\020.\027\252XE\374\\\251u\tk\005\320q\002\242@\333nr\004\260\353t-O(\334.\242\243@\032\222H\233\336\307\311\337\231\316\200\204u2\"X@\371\237\320P#\265\263g7y\027\0313\273?\357E\301S\343^\234,\002\310z\377\311C\226Rq\231;f\373E\230%\303\201\316\203\205\032\261{8\257$"
+	.ascii	"9\212\204\361)\252!\353\337\333\321\2318\023\234\373N"
+	.string	"o!T\316\256\013K\266U\214l^_\236\271\273\201\356\215`z2\226\270\006\024\337j\242\310MQO\213A\203\"\026\271.\037_"
+	.string	"T\304\374)\f\256\202\224\367\376w:H\031\255\210E\20480\177\252\315E+\026XAH\346`\265\265q\013\026\265\317\256\035\273\3017\303,\355\261\020\222\343y\013w\364\363\370F\325\"\310\201\275\366\302a\350\331ue\214\251\276\356\005n\252A\351\356\026\027\234\232\007\027\355|Y\002\026V`?\3256\0062\035\221\254\201&sL1\020@\343\372\002\025\374\247\202E@%p\003\2351R\310\301\261\030\360\350\250f\364R\261\3420\220\274\246v\013\350i\024wd\266\3770\016\270\350E!\362R\252\311<g\n?\317\270\224\364\235U\305MA0\250\363\n1r\0378\224\256\b'\274\242\345v\331B\bI\226O\247\354\036\255~W\320\0250\265\037\331\305\314\024\301\264\344\314n\f\322\325\r(rC\263\264e\255\202+\205m\206\356\0341\310\233Af:\b\246v\361\231n\327\337 Il\";\236K\362\300\353\236"
+	.ascii	"\271\251\273q\370\257\207oa\311\372\260\367\034\367\017r.\360"
+	.ascii	"\366\221f\273\350\204\234(\323A\257\030\350\374\3145\363D\312"
+	.ascii	"\253\265\373\231\367]\363F7\257\377\327\027^\3434\276??\271\373"
+	.ascii	"\331w\3527\265\346m\361\207\240\263\324\273\300\375i\254=;p,"
+	.ascii	"\f\277\276\303\364\333g\200,\254\177U\277y\303\317\342\277B\305"
+	.ascii	"\365F\350y\254Nz\366\214q\374\322\244\343\t\271\244.^,\317\312"
+	.ascii	"\3547y\361\346\315\007\275oZ[\323#m%\320FL&\342\366\267\232X"
+	.ascii	"\2649xx\036A\006\376W\237\017\321\336z\037'\0043\205s\365\316"
+	.ascii	"j\272\232\\\210\307\376\374\025\t\327\376\237\362G\331\273"
+	.string	"m\347\233\264o{\216\372\327C\246\3333o1oIq\255&\334a\005\033\330\373\323\025xI\247\013Z{\240\344D\355\023\332\b\341\357\355g\316\016!>w\303f6\357\376\025\270\032\236\341\252yW\320\027\270=\351\205\3342l<K\373\265\365r\206+\267\b]\217\376\027\266\033\251\316:\372M\323\257F\310\245\244'\2446G|wkc\372\367\336\366\026#\347x\231\202\352\271\343$\234\031\336^\023r\305\177\006r\307\033m{&\324\270\374\237\304\324\220\233\266\315!\214\375\204\221O\361:\227\245\023\303?\260uR\226\313\226Q(}q\272E\345\263\323\335{''\310}\205'@.\205z\254\301\355\200\346\35045\017\352\357\205\370\237\276\022\272]~\037\226\3518\234\\\031:\361f<\013\272b\344\225\252\335\233\377f;\013\311}\312\016;\020\335\323u^x\017\016\376\325\236|W\357|\371\370e7\321\377y\177"
+	.string	"\243wA[\251<r\361f#Q\266\232\301\246\216\037\006\236\0274P3\226Qc\2732\340\230\365g\330=\005\303/\025.\261b;E\333GM\257%O\"{Mk\270\005c\347\365\207\354~\301\361`\224s;o\250\355*\017\256\001|\223\266B\3041\375o\342\374\274\377\211)\007\002\273E+O\246\364m\341}\327v3\3675\2552\303\271\326\316w\341\271c\224:\271\260\033\250\235\324f\363\327+\036G\372\324\271\357\374\0011o9\016\322xa\236\006zT9\351\272\222Y\227mt\r\275\206\261$&<.H~"
+	.ascii	"\317}\202_!\333v:\214oO\206E\340\206\215\370\246j\017\253\354"
+	.ascii	"G\346M[xn\261\003\370A\3777+\254\217\361\205\214\235\300D\211"
+	.ascii	"\236<\376\025{R\356\377\001"
+	.text
+	.section	.gnu.lto_.symtab.4be8279ffca50d5,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"gyroInitFilterPipeline"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"dynLpfCutoffFreq"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"pt2FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"pt2FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"pt3FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"pt3FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"latencyTraceMark"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"gyroRingPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"gyroRingRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4be8279ffca50d5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
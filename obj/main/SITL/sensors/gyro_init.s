@@ -0,0 +1,1479 @@
+	.file	"gyro_init.c"
+	.section	.gnu.lto_.profile.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\021"
+	.text
+	.section	.gnu.lto_.icf.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\240\001\335\n"
+	.string	"\224\r\224\002"
+	.string	"\025"
+	.string	"\332\213\273\272\016\002\002"
+	.string	"\002\001\002\240\376\371\224\001\032\002\002\002\003\002\004\001\002\003\004\310\232\370\330\004\n\002\005\n\315\217\365\211\003\006\002\006\002\001"
+	.string	"\002\001\f\263\201\330\330\005\r\254\346\267\326\016"
+	.string	"\016\323\321\224,\002\002\007\002\b\017\374\200\343\306\003\004\020\275\370\324c\034\t\n\003\021\211\370\275\306\001\034\t\002\b\002\004\002\013\002\f\004\003\002\002\b\002\r\002\b\b\022\233\364\343\336\006"
+	.string	"\023\245\346\360\261\007~\004\016\002\016\003\003\002\017\003\002\007\002\001\020\004\002\021\022\022\002\002\023\023\025\352\263\360\321\b\027\240\342\234\212\n\031\032\252\325\237\241\t\002\033\344\306\233\305\013\004"
+	.string	"\002\001\035\331\246\346\211\006\002\036\230\265\243\260\t\037\323\350\331\310\f\006\n\002\b \211\250\342\335\005"
+	.string	""
+	.ascii	"@\250\261\305\300\002\241\n\224Bv\003`\002cc\353\001\021pAa4"
+	.ascii	"\322\224\024\252\3657P\004\360\024\266\273\232\005\025\315\323"
+	.ascii	"\032n$pF\275*X\207\031[\341\244\347(\304\031\336$&\303\207?N"
+	.ascii	"\355\r#1\216z\307\344\261\244\317\027\027\356Y\364m\331\033\340"
+	.ascii	"}|\310\013\026\320\300Wq\336B\273|\214\212\374\352e\220I~\032"
+	.ascii	"3ey\260\273\221\205\225\305\375GRqUL\340\312\206n*\177\237"
+	.text
+	.section	.gnu.lto_.ipa_sra.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\355\003"
+	.string	"R\305\016\026\220E\351\377\377\377\377\2772B\2502}\326\276\317\355W\215\310\235R\226\376.\302\036L\301\f"
+	.string	"\346\263:\233\366fev\321\021\026\245\024~7$H\035\356nw\"\2645\313\344F\033"
+	.string	"-\002C\306\0363X&\030\313#\253\271 \365\306\266\00603\205\362\004]0\004\215\003f\315\251\365\210bf\006\225\230\026t\n&|\300\305\360\305\302U=-\013"
+	.ascii	"\327\200n@&\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\346\004M\024"
+	.string	"V[ZA"
+	.string	"q\224tp\333r\004\030\027\375{\251\214#\373iC\234\274\312\223\323\311u\237\223\177O\260\233U\335\3059\003~\300\255F,\314\377\377\336va\fq\036\025\217\306\341\273\306\216\b\261D\332\020!r\247A"
+	.string	"G"
+	.string	"N"
+	.ascii	"\263X\210\217(\260ST\177\224`uj\241\025(\374\016\276\001z\212"
+	.ascii	"\372\272\231\272\312\324\360\212\235I]2U\017\372Hj#21\024\270"
+	.ascii	"\275#\353Im%3_\361\357\024\357Xjf&\200\007\031##\270q\031,\033"
+	.ascii	"\313\212\257\375\r\341xV\272\234\320\r'*R\\\346\272R\324\022"
+	.ascii	"\035\\\334x?\222\f\211\250\363\373\205\312\"\202\205D\177n\364"
+	.ascii	"\232\371#\251\2541\363Q3\203\365\02723\365\357Sl\277\247#\210"
+	.ascii	"?R\fEl\243\251\305\310L)\230\203\036\230\377\2604hZpj\253\314"
+	.ascii	"d\360U\202\371\243\343E\255e\212cf\217\261,\200\353 l\324\360"
+	.ascii	"\240y\3636n\220\n\244\032\313\254\307\253\303-*\214\024'B\270"
+	.ascii	"\266\310\341\362\342\323\372\362B\003EdM[\217ec\331\205\021\254"
+	.ascii	"\220\242n\031\202\026OKfn\0269\320\254\025\003\256\324OH+\265"
+	.ascii	"\223\314\024g\002\242\266A\217\247\242\254fp\250J\277\235\232"
+	.ascii	"J\013\013\023\230\262\200Q\007\371\313\271\033*\226\264\017\231"
+	.ascii	"&\234T\002\207\b\241= \200\211\250QI\206\204\2044I\n\205\016"
+	.ascii	"p\"BDf\036\022 65\n)\232*\022Uj\355\261w@\330\371\206\b0d\225"
+	.ascii	"\355\034o\t\365[\023\013@\037xq\234&*\275\214x\263\006\"r\250"
+	.ascii	"\2250\360\0060\005PD\231m\f\226\236S\324\r\347\341u4\350\335"
+	.ascii	"z\302\240\340\356*sc\025\tY\036\251\202o\365\002\226\270\244"
+	.ascii	"\006\272\224\273u\033\022\301\357a\205\211\324\365\365\036W\241"
+	.ascii	"\347n\256y\365\274iR\366\231\374H\244\217\366\313W\374\276\001"
+	.ascii	"7\001\236\215\304\262_\310\206#E,\246hw]\273}\366\270\365\363"
+	.ascii	"\020\201\350\361\223\246 \017#\246\223$AP-\362\213\276L\013\315"
+	.ascii	"\323\001ik1\321\217+\314\372vY\307#\017\225\034\230\022\354\020"
+	.ascii	"\367\213\001a\006\006\345\200}f\3368\273\005g&\224\fd_/\323\270"
+	.ascii	"<\312\004`\025\350\223js\351\242\315\351\206\233\227\210\257"
+	.ascii	"\341TEM\247\027\315\2503\333H\002\375\356\026\201\017\366z\370"
+	.ascii	"\343\351'\362|\217\376\365\366\024\312T\245\0029'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\370\003\315\r"
+	.string	"f\323>6@\305(\035\303"
+	.string	"^:\220\210\343\035\024\\\f\206\247_Q\024\305Ae\016\270\274a\216"
+	.string	"|S\307:\322\256\347\023M\016\021xu\240\326\376\352G\207=\273\355\235R\n+"
+	.string	"/"
+	.string	"1"
+	.string	"\226\030c4\313\326\366\246\346\254\2629\234&9\233\344\356\346\033\254\033t\333\n\236\232\315\323\321\266[k\257yj\236\026\373\305\264\005\b#\316\363\361\337\245\265\364]\340}Of\277\322\346\335l\023\356\317\334\267\007:L)c1\332\246&\342\253\375\305uY,\274\266\204;\005%\240\005\r1\020\210\033\365\221\253RC\236\\<\361\203\2347W\0177\312\357\342\334oE\243\210\202Xk3-\346\220\241\025\370\034^k>\002h\217\377\352\350\006\255\243\255\247\245\260Ih9-B\255\203\326"
+	.string	"@\347vb8\237J:\257K\316'\022\353fmf\214R\243 \366\217\250!$Uj(\225\033\025\237T\245GK\250a\265R\320L\030\n\313\251\026\016P\202!Dh\364\022"
+	.string	"\002Y\bb\251\020Af\004c\f\005\024\316,-oc\027\001gI\025\275\377Vo\220{`\273\030N\267\342]\325T\210N\350\364n\034vG\242\220\217!\267\216\252\333\206B\304\212\257\022\t\\\027\222\243\007;%\"\337&e\217\232\022\017\006\033\214V?\262\346\224\261?\3440,\227\232"
+	.ascii	"\224!\242\360<\002\0132\240\026\260\201ZB\007I\371\347\343kB"
+	.ascii	"\313i1tO\305\232u\321a\026\364,\361\342\347\313~`\350\347\f\211"
+	.ascii	"\2032\233\354^\321\222LW\270\314\321\332 e\214\\\265'\305\271"
+	.ascii	"\373\201\027\365\257\314\027\\<"
+	.text
+	.section	.gnu.lto_.pureconst.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\204\004\002\230\004\004\232\004\n\230\004\f\230\004\r\230\004"
+	.ascii	"\016\232\004\017\230\004\020\230\004\021\232\004\022\200\004"
+	.ascii	"\023\231\004\032\204\004\033\230\004\035\204\004\036\204\004"
+	.ascii	"\037\205\004 \230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\025\007"
+	.ascii	"r\311\035'\2205I\007\217\273\322\357>\315\337\317;\275\253\273"
+	.ascii	"\273\273\023\333f\377\277}h\221\371\303X\302m\3776\037@n_\312"
+	.ascii	"\024\277\024\224E\363i\311X\274\342\033\347'ebu\267\246\271r"
+	.ascii	"w\003\r\301\374\024\0030\3573\266$I\225ZS\243\312\355\326v\244"
+	.ascii	"\335\351\251hr\310\340\320\3330cL\300\234?\312\235\3622\253@"
+	.ascii	"\200\312!\205\216\262\210\362\247\374\227\266H\375\246@0 \240"
+	.ascii	"\002\031$\363>!\224\352\\\216t\032\262\026\007\334\274\001\224"
+	.ascii	"9\207\354En\207\263\r|\033\246Z\004\225\274\326\254\343er\021"
+	.ascii	"\341?Hs^\302\256\266\302J|\234\201\335\261\231<dA\036\206\214"
+	.ascii	"v'\026K\223P\007\301W\262P;\310\027Y\307r\337\265zDf!\273\265"
+	.ascii	"i\026\272\335mair\335\017^\205\032\002"
+	.text
+	.section	.gnu.lto_.lto.824684ac80c8d7ff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateNyquistAdjustedNotchHz.38.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\214\001\365\017"
+	.string	"v^lE"
+	.string	"\261&\035@\375\232\324\374;\327"
+	.string	"5x\376\275\372\223\256\365\212H\337\313\032\204b\330.\0045\224\354\033\363\2468\266\021\304\214^\213\325\026\255\254\211"
+	.string	"F\253\277\344#\033\200\3108\232\212\177\250\033!do)S\nV"
+	.string	"S"
+	.string	"Y"
+	.ascii	"4?2v?\004.\321\036m\373+\316\202\305\251\374H\304|\210H\301z"
+	.ascii	"\361"
+	.string	"\330\3756\221\017\300\036\363#\330\243\216x\352\021j\246|\0053=/-\325\343G\353\303!H\313%5\244\265\001\222\354\356_O\230\326*3[\260\273\316\227\226\207\033\273\355\b\266%\330\337\tjc\037\356\356Zk\354\320\277_\273\353\317\256\343\272!L+L'L\377#\013a\203@\214\335\016A=\326'\3160q\235\337f\361_\0061\316sX\256\203\322T1\032\214\325\215\216\335\357\300\243\033h\217$\360#\330\227J\221uY\315\230d\336\225r\334\r\272\212j\023\322\t29X@\207\252]\016\rMU5\310\340`\001\345\356\252Tm\214i\252\205\034\036\227\374q\246\251\020dzX@\327\00284\3470L\363\006\207\233\225S\376\202\323v\327\304oq\027*~\211G{\247\374\313\243\177\302\036\257\001vj\250p\265d\220\375\2512&\217tRA=@\211J\243\223\312\250s `\345\004\005\2053\235\030"
+	.string	"X9\301 2q\245\314\242\022\023\251D\242\300u\250\013\233\327q^i\344m%R\205\224M\324y[\211\001s\031F\335f\342\270n\003\371\366p\265\306\tv\250\237\302\376z\350\004\n\036\030R\303\314\024*\214m\250!,\020>-\001\035"
+	.string	"F\305\251\325\301\2051\215\004b\213\314\254\013\252-<\263\230%\200j\246\366\264A\207\317\202!B\324\220*l.\003\336\304w\006\305\223\177\230\325\270A\206\316\257V"
+	.ascii	"\221\0012\240l#~f\204\331xU\202\256yz\273J\031"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.39.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`L\003E\030"
+	.string	"&o\240E\260\032Q:8Cn{\217\267B\2141\343\213@\241\255\035\377gt\007\331\006v\260\237\351\002h\247\326\352\203\220\205G\003j\201\202b\236A_3\306\260ob47P.\344\371\036\215\232\\\326\020!do)\223\f\210"
+	.string	"\205"
+	.string	"\216"
+	.ascii	"\237\007\344U\252;;A\341\247\356\252\336\311\237\310\256\253"
+	.ascii	"\241\263[\310\230,\335\273\007\n\024~\256>\340\373\334\013\370"
+	.ascii	">U\246\332\346\273\245\006\207\\\2719\315\351n\027\033Q\276\334"
+	.ascii	"]\347\312\376M\311+\323\203\026\230\216 \310\231\0217\373'W\335"
+	.ascii	"\335\203\263I\b\335\375(\244\235Kz\\F\310\365F\\\217\263d\300"
+	.ascii	"\323\022\347Q_\0348\233\034\220#\311x\246o\022\256\266\013Z\350"
+	.ascii	"n\335\021\267\343\n^UGU\375\240\312E\001UV\350\221|*\013q?~\352"
+	.ascii	"\305\357\223F\356i\364A\333\236\352n\266\254\244z\256\361t7\224"
+	.ascii	"\211\250"
+	.string	"\266\356t\375\271\356\312\272\356_}\367\373\034\352\232\002Wy\276\325p\256\202s\365\223\253S\256J\271\312\273\272\273z\002\340\2274\005z\3359zu\032\315\334\242\344P\277\323U\377\244\217R\025\224z\tg:\302)Mg:\204\207\242\227\242\252O}\323\243\310\356$#\234\351h%\r1\303\353\356\006\237\212!\f<\374\213\001\021\206\t\371QO\240\345M\023\035m{\314\335=\223\255\375\030dU\021#\366\343\017\213A\276\215\3671\215\234\034\033\217D\211\t]^=\\.\345\223G\316\315\273\273\231\225\024\3067\371D\023\033\244\245\243\222\231'/\234\333\217g\271\017K\226vn]j\257\361\261\2309DN\315\255Km{\312\332\363\262\252\t\241\375\310\342\0036x\246+^\376\355\216\017\237+\344\300\334\356\f\021)X\352\246}T-\272\225\027\2005\335\035\244\247\362\261W\f!\t\342\233\261\001\005\n\361\350\305\205"
+	.string	"36\244\030:\022\215@\035\002:z\031\275L\2100\031E\256\030L\214\031\021\305\\F/!\026\256!X\314\005d@\305\026D0\327\221(\302\\\252]\237\2110=|\002\203\206\306\265\217\225TuD\266x\036\341\006Oq\322\203\247x\213\\N\007Oq\213\317$\327\263\0051\260\212\345\272H\335\264\004\377\205\357\207C\006\231\207U3h\330\217*\033\b\317To\306E\217\252x\031\016\022\226\272\233B\207\223\361\260`Mw\007}\216\t9 \240\202\0312Z\007!rjtPd\361o\f\275\036g\203v\305*\212}3,\023\276\204\360\222\2006(?\301C\023\377\t\260\265\3413\030\251\340\252\313\201\"\001\036\013\024\342\252\023%V\320\n\3650\216y\007{\246\270\261\227fvxB\r\331"
+	.ascii	"K\003f\005\211I\335\3346\023\002\212\305\"\004\366\274\rrN\330"
+	.ascii	"\035'\016\357\235\024\215U\205\303\310\307-`\312\272\027\033"
+	.ascii	"\002hY\313\006\255\263\240\314\352bP"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.40.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`L\003E\030"
+	.string	"f\357\240F\260\034'\035\200_\016\017\345\227\262\262\233\224\345L\300\336\233\376\362\347\216\314\314e\031\240b%\205-\321\232i\316Wh\221 \033\364\341\312\"%\\Y\242\364\226\246\2313\306\022\274a\335\267\207\310,\"\204\354-e\222\001\210"
+	.string	"\206"
+	.string	"\216"
+	.string	"\341\347\001\371\225\352N\352'\374\324]\3253y\023\331u5tv\007\371r\245{\367@}\302O\236\017\370>\367\002\276O\225\251\252\371N\251A!inMn\272\333\305E\224/w\327\271\262\177S\362\312\364\240\205\245#P\3422\342f\377$Ow\353\340l\022Bw\377\311h\247\022\244\313\b\271\250\021\207t\226\fxX\332\374\351\213\003g\223\003r \031\277\364=\302\325vA\013\335\255;\342v\\\301\253\352\250\252\037Ty(SNe\205\376\310\247\262\020\367\343\247^\374>i"
+	.string	"\351\215=h\333S\335\315\226\223T\3175\236\356\206\362\020\325\326\233\256=\327]Y\327\375<\337\375;w\272\252\300\325\234o5\234\253\340\\\375\344\352\224\253R\256\362\256\356\256\236\200\212G\231\002Q\3359zq\232\314\314\222\344N\177\323U\037E\377\244+'\335\022\316t\204R\230\246:\204w\242\207\242\253O=\323\237\310\336$#\234\351h\035\t\221\342uw\203O\305\020\237_r\370\367\002\"\354\022\362\237\236"
+	.string	"K\357\215\216\266=\346\356\236\311\326~\f\262\252\210\021\373\261\207\305 \337\306\373\230Fn\215\215G\242\304\004\250\227\216\226C\371\344\2213\363\356n\346$\205\361M>\301\204\306h\341\250d\346\311\313\346\346\343W\276\303\222\245\324\r\252\366\032\037\213\231C\344\306\334\240j\333S\326\236\227UM"
+	.string	"\355G\026\037\260\3013\345\341\345\337\246v\370\\!g\3456\025$\244@\251\233\366Qu\350U^"
+	.string	"\316t\367\217>\261W\f \t\342\233\261\001\005\n\261\350\305\205"
+	.string	"36\244\b*\022\211@\r\362)z\021\275L\2100\031C\256\030L\214\021\t\305\\D/ \026\256 X\314\345c@\305\026B0W\221(\302\\\253]\237\207,=\224\202D\206\306\265\217\223teD\266x\032\341\006W\361\321\203\253x\211\\N\007Wq\213\277$\027e\003b`\325\312u\215\272i\t\376\013_\017\207\fr\016\253f\320\260\037U\366\017\236\251^\214\013\035U\3610\034$(u7\205O\325\016\007\343a\301\231\356\376\t8 \240\202\0312Z\007!rjtPd\361o\f\275\036g\203v\305*\212}3,\023\276\204\360\222\2006(?\301C\023\377\t\360\3261\026\bE9P-\300c\201B\\u\242\304\nZ\241\036\3061\357`\317\0247\366\322\314\016O\250!\033`i\300\254 1\251\233\333fB@\261X\204\300\236\267A\316\t\273\343\304\341\275\223\242\261\252p\030\371\270\005LY\367bC"
+	.ascii	"-k\331\240u\026\224Y]\f\n"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.41.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\275\013\2559"
+	.ascii	"Zed\026?0bR\007\257\201B\231\t\252?\366\237\242\272\2746X\261"
+	.ascii	"\365\035\316\225\345m\354\214\330\365\205\303\030\210\f\321S"
+	.ascii	"\362V\240\252@\005d'\271\333K\352\330\243\262]\254\210\202\254"
+	.ascii	"\031!{\357$S\nW\001<\001Y\001glF\265=D\n}x\033\337\013s>\036"
+	.ascii	"mNr\315mP\271k\216k\321\227/\233gQ\214\255\270\306\354Ka\316"
+	.ascii	"W\024jz@\225)\263\232\231\365J\b4=\240\312\256\331\312\t:C\253"
+	.ascii	"a\316\271\312\335\356Pl\315\374h\225\271,\312\234\2051N&\314"
+	.ascii	"\363\300\2602\227\221I\371r\276*\350\tEw\225\330\227\357\265"
+	.ascii	"\217\203\242\273\215q\267[\035L\230\207il\033s\216\213\303\227"
+	.ascii	"sV\320VEw\241\274\371\272\333\372\362u\267\001\204\260\216\372"
+	.ascii	"Un\215h&\004\255\214a\316\327\253\247bL*\273\373\275\275z/\335"
+	.ascii	"\2507\231\313%%e\022R\362\by4\026\211\257\333>\216\266\037\247"
+	.ascii	"b\336\364\261\2523\347\314\341%\235/\021\261\3468\276\033\264"
+	.ascii	"z\211k\243s\245@'X)\347I\201\336\342\331\3119\022 \023\234l\342"
+	.ascii	"G\200\336\366\325\0256q\244\337\022|l\225y\330\254\264\013\n"
+	.ascii	"daK\202\215\005\246\264\275y\361\215\267xU>\353a\\\333\233\023"
+	.ascii	"\253\300y\034\233\222\343\024\355=\342\243E\t\231\373\"M\311"
+	.ascii	"Z\250\2343rz\206]\367s\2516,\231\240\232\351\021oq\325\277\314"
+	.ascii	"\354m\316a\351\216S\262\307D\254\234sc\351\264\315\033\200w\343"
+	.ascii	"\356\356\265\356cTY\310\374\335\215N\360\254p\fg[\352\007\214"
+	.ascii	"y\342?\336)\003c\350\220\0214\203G\206\263\355v\274\2610v\016"
+	.ascii	"+\347\342q\367s\374D\f3\3629\354\334_\373T:\336Xb\230Q\273\177"
+	.ascii	"Z^\334\332?5O+h@\305\306\322l\346\344J~r\247\0234 \254W\247\337"
+	.ascii	"$\311Y\314\341\032\020\226f*w\243\336\375<\205\037\333aa\031"
+	.ascii	"n\324}\025\303O\355\366\317f\263\204\372\245tKx\300\300\312\257"
+	.ascii	"\356U\216\306\233\312\363\334\017\270\032o\003\316\306{\312\315"
+	.ascii	"\270Ky\030\367\250\306\035\300\345x?y\034o'\207\343\335\344X"
+	.ascii	"o&\347\363nz\23773\t\367\222\210{\351\210[\351\210[\211\204;"
+	.ascii	"\211\210\033\351\210;y\304}\224\304\215$\342>\036q\033\217\270"
+	.ascii	"\213G\270\211H\334/\021\267{\304\335\036q\277\02176\342\366\t"
+	.ascii	"\002\n\3011\241\016y\301k^\313.\312w\334>;\227\343\036\307\035"
+	.ascii	"\216;\326\035\215\273\032w6\356|\356}n\354\3669Qw\203\326\273"
+	.ascii	"@\030v\200\320\272\302\366\277\3667\215\3046v\n\243\312\347j"
+	.ascii	"Ew\333\356\260\3664\276\306\365\334\215\3735\262\317\3519O\215"
+	.ascii	"j\211r\261 \307\204\253\203\243\224\226\027\005\371\324\236z"
+	.ascii	"\342{\034\031:\007\236\3702\352\316\24052T\324#\247\360\360\370"
+	.ascii	"\324F\022\026%\274KH\254r\246WS\340L\217\273\270\247\345\305"
+	.ascii	"\0311&p\246\227\360n\255\3029\203\233\302T\377~w\324K\364\013"
+	.ascii	"vi7\036\333bF\301`\261\250\030\b\203\031\212\301\212\307\353"
+	.ascii	"\356\373X\257\375\346\273\357g[\020x\313y\377\333w\246\377\367"
+	.ascii	"7\356\342U\355\2405\032\303\331o>Z\336\366\212\0316T\220Cr\267"
+	.ascii	"\352\236\324m\214\220\277\310\206\205Q\323\2642DEmu\007h\330"
+	.ascii	"~\330\200\212\330\033\373\272kw\347P\261D\256\032Z\357\nu\002"
+	.ascii	"\300+\356pUo#N\341a\341\031n\364>\265\335Dm\273\240\016\177\206"
+	.ascii	"n\"\334\036\350\203\200A\020(D\020\373\3324_\215H\330\266\377"
+	.ascii	"!\201\242\205\261\357\357\216H\210\333\3738\247\344\332\004\212"
+	.ascii	"\026\"\214\370\201\263\346\234#\270\313|\265n\260\367\3007\271"
+	.ascii	"}!CX\206\023u\253`1`0\3471\227\266\013\256h\201\007\255\264;"
+	.ascii	"_w}X\261#u[\302\006\036\177w\214\031\330\245T\017e\366b}\340"
+	.ascii	"\361{\321e{\317\317\226\004z\222s_\310f\003\313r\036\223\362"
+	.ascii	"7\360X\357,\317- Ym\027\0070.//\f\314/-(\327\026\207\3473\313"
+	.ascii	"\353\207\223+\t}n\365\340\0016\002\254F\227V\017\036Z_\034\230"
+	.ascii	"P\ro\327V\026\216Vk\307\026\324\313\351\344*\006\361p\303\213"
+	.ascii	"\313\325\362\002\203\266P'\327\263\355\032V\320\255\256\255\031"
+	.ascii	"\316/0\034W\317/\347\263K\353y\325\265\225\265\343\252\306\327"
+	.ascii	"\363\312\212@;\275\264\276\256\240N\347\327\025\362\232\275\365"
+	.ascii	"\227\322G*I\320\366\230\356\321\327\375\274\303\236\352\231\275"
+	.ascii	"o\217\276\001\002<~\262n\2546\347\234\233O\365F\364\205\316 "
+	.ascii	"\346\222\325\273\204JU\376\364\264|z\253w\353] \n\230\352\227"
+	.ascii	"k\321\251\221\254\"\270"
+	.string	"H\364\210\213\245\3227\177I\371JO\257|\237\343.\336\035\242%$\321\267;A\251[\"AW\224\222\030\274K\210T\345NNJ\247g\360n\265k\200\251>\251I\324\211\031\221\032L(xH4\n\004\032\030\254\222\036\353%\277\371HG\237t\372\243\367@w\361\354\262I\324(\025\273@R7Dv\256HO\355\344\334\321\203'\316!\253\274\251\3511\237\316\213\233J\223M\377\340\375\257\016Q\025\226z\374H\272h\365,M\013\200\035F\213b\261\240\003\203\004\344\343?\306o\376\321\033y\361\215M_|\007t\267N]\326\301\033\233\301\243\200\321\250A(\004\031c\b\221\210L \243I\222\341\320\002\221)Z7\021 \245d\f\325\310hI\222\341\2070\332xq@I|\207\256\311\314\322\306\260&W\030\2228\206\357\301\370\271\220\211\336+T\311\026\335\236\210c\353y\227\005\370\240\230\226\016!\212?\261KC"
+	.string	"\240:\233\305\004\n\344"
+	.string	"\021\330\016s}\241y\200-\333\342\243\"\255\325A\260Z\304U\240G\210\343i\320\243\220\034\336\245\027b\201\371\245\336\256\265\032e\204\245a\001\330\236\f#\217p\0033\023\007\350\200\227u1\314\330+,\036\by\212\303\261\352\207\305~<\367E|\251Du0K2@\355\231\214.aqw\200\2335&\221\n>\031#H\013\305\260\222\302|\036<w\023\271\200\004\215\334\250\326\316/\326\252\256v\233Q\256\316T\002\f!x\234\t8:\334\304\274{q\310\324\236"
+	.string	"M"
+	.string	"OkOE2r\210H\022\370\006zB\217\002\307\246e\310\372u\016\361\322\0075L\343U\273\233,\021\205\026\361b\2439l\344;\020\337v\022\331S\342\263\177(\366Y\325\303T\025F\206\004\231\bVp\246e@y\364\2004k\265%\247\201\035\264\020V\016\3409c\202\303S\004p\300\242\354\2768F\366Z\207\373\223\202\242\322T\\\211\273$\255`%X\031n\277\216\016\353\220\344\002\343u\214\006(\313\263\237\300\212<z\320\037N\253H\\TK"
+	.ascii	"\003\261K9\376I\\\224\333\266t\317\326\246\3445\355iC\027.*"
+	.text
+	.section	.gnu.lto_dynLpfFilterInit.42.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`<\004E\025"
+	.string	"Vc\201I\3000'\035\372G\320\375:\352\376\3336{\330\205\271\273<\375\313\335\031\312\275\201U\245D\204\221\265DW:\302\265l\227E\f-\020|c\263\277\337yg\327%\276\251\341\310\023\242,\274\201A\342P\317\314\254%\204\220\275S\nn"
+	.string	"e"
+	.string	"p"
+	.string	"\233\341\374Z\251\260E\217\355\317\354bg\335hgG\235\035\031\244\337\356\222U\347.\227\305`\243\030\202\225\272\370\006\206`\350v/\227\201\304\224`E\243\2208\006y\bG\222\005:\035\264phl\016\312\304\\\220\355`D\232\325\217\215Apf4\204U\306L\rX`w/\342\024\303.G\351H\262\273\246\272\035\315=\273\355\021\266\021\330\240\202\273/\337`\252[\231$\237\275\331\003\"71\264\207m\225\037\225$h\035\233|^?\317\363\253\332\024_%\034\325\200\241:lSx\221\t\333\205\031\361\207NT\301\347yh\013-\364\272\207~\213\370\3605l\362\005\021\341\350i\033\345h\345\331\257\347yz\271\346\330\224\032<u\245\324\364\324\017"
+	.string	"\340\303T\002\246\r1WQQ\375J\234\306\264\203\201SRQ@L\247\365v\214\025\352\t\352\267tZ\257K\2441\234\236\200P\234\326\213\n+\3575\321>\271\257&\340jwG\374\246\273@\261\245\244\210\017G\034/~\\8z\372&\376\341$\365By\210\324,\315"
+	.string	"+o\205\317\242\016\251\360{4\204\222\237\342=>{s\302O\372"
+	.string	"\361!\217\317\256}$\333Y\260>\ta\261\255\330J\312[\013\ni\336Js\245f\222+6\023\025\362\344f\222!\004\\N\250\335H\226\262\274\2213#\334\301\2559f"
+	.ascii	"B\nWs\006\253\335\340\277Z\216\352{\360\256\222\013\254\263\034"
+	.ascii	"\226W\2556\204oi\321*G\370\r3\253\326\030\007\254 \242j\227\034"
+	.ascii	"\313\204f\303\201\320\251\333\302\321\023\334\335\225U\236\325"
+	.ascii	"i\324>\256~\254~\\\001\\\250!t\246\230\232!\005)HI*\0350\003"
+	.ascii	"\021\231\322\034\021\220,\n\025C%UZ\016\303\360N$\030\021 Q\203"
+	.ascii	"C\360B\205\202\352\375\326\270\370\264\211w\\=\235]\3079/BC\215"
+	.ascii	"\347G\266\343W\r\005\337\221\207\002\215\340\232C\201\301z\246"
+	.ascii	"\241\004%HC\007'\227\215s\177\230/\0136\212\222\321-C\013\250"
+	.ascii	"\366\261\213\263{\240>-tD\235\210H\257\311\333\357St\242\262"
+	.ascii	"\313\025\362\337\326\255\025\271\352\2537b\370\323\367K\347o"
+	.ascii	"5\226\005\006\311H&\302$\2058`v\365\376\330U5"
+	.text
+	.section	.gnu.lto_gyroInitFilters.43.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\365\004\245\034"
+	.string	"Fu\266I\240\230Q:\300\341\327\030\243\221\266\360\2003-\347\264\206lQ\006\270\261v\027Ja\0258=\331\347\273l\250\355\250yU\322\256\t\r\260E\327C\244\3531\035)\3433mV\316\205Bk\016\213?\305G\033%\237\354-\245L\001\233"
+	.string	"\222"
+	.string	"\247"
+	.ascii	"K\265[.\377\373o\360[\365\330W\310\016!\227\352Nz|\263\352\203"
+	.ascii	"j\221\243\326J4.\355\231\273S\217}\201l\020rK\025cU2\376\254"
+	.ascii	"\252|\2515\b\264\364C\343\322\331\326\304\245\274:\342\322\223"
+	.ascii	"\177\227\r\326\250kE\345G\204\253\326jk\032\357\235\301\275\310"
+	.ascii	"\344\276D:\233\311\357\213\310\307H\025 \023o_s\366\233\006\252"
+	.ascii	"V\260\250\243i\351\213\250j\013\\\t\201LM;al\313\230|\263\247"
+	.ascii	"\326\272S\313KL=\346\027Q\255\365\fdz\261\037\367\177\323\177"
+	.ascii	"\007?\305\tGHH\342R\356\013\302\331"
+	.string	"O\017\326Z\273\235\216\023\267=Pm\371\270\314\177\020{\0047\032\331\246L\306H\375\266W8[\215Z}\t\276E\326j\304\367\306\322\347J\360\002\227~K\210Ky\272\257x\351*\225x\370\007{\334O\377nm\247\337\207g\251\366\265-\367;\223\257\303|\332\344\3470\1776\3718\314\227M\376\r\363mD~l\362k(\0376\371#\363_\315\027'\237R\376\234\374n>3\177\177hO\254,\020\326\352bx\246f\321%8\002\303\037\353?\377\374\307\260Z\216\025@\253\326\252\340o\260Z\017dZK\263l\325\022\360Yqq)\361\260\273\326\312\243\375\364\335\202\246\354\355\023f\3220O\357\364R\004\361\207\260X\"\\\241X\212p\211\211\365/a\255\354l\264\262\246\023 \030\261\307\256\351\240X\303\272f\302R\3410\005\366\352\2617\306\224\220\302J\301Ey5\335Q\325UVX(O\304\206Q\r\245J"
+	.string	"\314\335M\033h\377\f\032x\201\357\3715\357\263i\327\224\303\r\313\204\303\222\3314\352LW\271\323\335\373K\323a\225\024\215\265\326\004\337$\213e\024\273\333\t\243\231\"D\321\201\017$D\344\374h\310\304-\351V\224\323\241"
+	.string	"a\333\351r\273$\244\235-\351f4\302v\244\333\331\206\004<G\002Ig3\221\313\351l\261\240\322Z\200\222\245\324\275\007A\2216\232\020\340\237\304A\352\340\005\236\346#\253\327\274\377pN\353D\321Z\207\307\n\311\320f\235\323c\305\204\2315\002'$]?|\3238\375\223?\310 +\232wY\343\264\320/\r9\265_p\243\027Y\017\200*m\372\246\205\030,\227-6\275S;\243\234\220H\275\372\351\260-\352\323\2755\201\266\326KB[\353%\263S|\320\326\332\247W\306\225\220\305\214\036\007\\\250!@$\025RJ\t\211$\221\026\244P\007\320\002\031\251b\007\020H\246\204f\n\362\225\315B.MR\037\312\363\367>\002\b,>\375\263O\032\001"
+	.ascii	"\254\215\217\311_\n\027}4C\033\251\365\256+8@\204Y\246A\214\324"
+	.ascii	"\362\215\335I\034\272R\232#\005R\035\n7\032Q\271mV\207\213j\017"
+	.ascii	"\354\205m\257\247\316\226\031\027cz\263\320\203\306a\f\034\247"
+	.ascii	"Q\216E0\210\340\032O\3457'z\210=\336\307\302\340\206f\260\343"
+	.ascii	"\003\202\350\264.a\331Z\273B\231\007\265 \254\316f{W\021\312"
+	.ascii	"\007\030L\357D\227\252\027\222\020\003\312\f\210K0\320\237\302"
+	.ascii	"\361\240\270x\243\353\017"
+	.text
+	.section	.gnu.lto_gyroInitSensor.45.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`c\005-\034"
+	.string	"&\357\246G\260ZM:"
+	.string	"}\357\016:s\304\021\251\t\203|\213\026\351\346RV\275]b\224\030A\370\322\201\241c\250\276\255\331I\033owkO\337\337P\367\fq\336\b\317{\236\362\365\016\302\320\335kLD\244\326\244\221M\344N)\212"
+	.string	"\213"
+	.string	"\235"
+	.string	"\006wz\301\351\271\323/p\035\317\252\f\206$\265\302\370\251\251Q\024\n\017\333\037mO^\013\002\001j\316\310\f\b\237\366\207<\211\374\316\305\005\324J\324\344I\255<\007\206\211\247\346\375\025\236\212\307\tOM\332R\347\031\325/i\362Q\262\252\265\306\026\307\311\207\024\334I\372\263\212\227\362\307\366\320\211R&\234\026\360E\256@\006\022\234\027&?@\337\034.|\035=\351p\375\364\354dI\250\265z\226?1n\326m\313lG\260\351Qv\206?\331\320\004^)\251v\301\275\317\232\033\207/9\t\321Al\021\236\356\216?\306 \315\265=\234\311\212\002F\366\207/\001!\326Z\037(!!\002\300\227\035.\302S\360\252\244\272\335@\370\235{\037'\234G\\\251\204Xk\356\201o\344Gr\374\035\247\326\331\231/w\302\323\357\211\033[\202\222v\267\371\263y\270\271E\366\367\367\373\371\274D\366y\277\200\357~"
+	.ascii	"\343\264\215kzlM\273\304\351\326N\213;\315bM\207\3414\2453SC"
+	.ascii	"\202T\241\332`\024\352\231kl|\212\034Z@f\200\315\266rg|;\330"
+	.ascii	"\270\036\205rk+\372\030\022\207\230q\301\036\225\235+\307\303"
+	.ascii	"\220:\300\320\247\222\252\301l\361 {\314\227\256M\220\3532\203"
+	.ascii	"\031qq\322\332\007aJR\002\211>\256\205\324e\251\002\362(,\342"
+	.ascii	"\336\034\221\362\355Xk\223H\277B\n\261\222\364*$\021\326\216"
+	.ascii	"=)\244\035\202I7\\{\002\205\371\322\tz\326f_J\212\\\205CY8\205"
+	.ascii	"\205\373\022\310\2516K\373\302\243`8\224\021\224/\321u-a)\201"
+	.ascii	"\300\r;<&d\263\234\220\203\31390\025<2\236\0213\032\213\235X"
+	.ascii	"\2156\253\311tj1\031O\211\023\261\034Z-\006C\340\031\n\035ZL"
+	.ascii	"\305lF\213\215\274\333\301\272D\246:\236o\352\2668\260\326Z\303"
+	.ascii	"-\352\371\013\237\2462\177\371\240\316M\334\022\232\277zD\371"
+	.ascii	"\246\300-:\251\013m\262\306\254"
+	.string	"\244\356\300\357uS\245d\325\273\231\343X\211\262\315\253\037=\035A\255\325\374\312R\fzA4\002\340X\335\3674\255\233)B\275W\375\314\311!r(<e\252\366\251\\\253\355A\242\206J%v\250AT\243\2244TC\013\212\nRh\f\260\002\2211\353\034\021P-CJ\225\b-(H\n\035\274\203\302\246Y\032o%\226m}I\266H9\234\243\326q\357\274vn\023\352U\271?\321\244\n\357\365h@\207$\030\354\314\365\222qI\253\360\003+\216\005\023\266c\243mf\006(\271\005:2\313DwU:\206\237LZ\221E\356\2611\006\245\306\231\205\302e\016\023\203p\r\016\247\232\245R\374\315oaty\326\256\301\tIh\332`\264j\224\245lU_\006\267\311\216\350\340\031\3332|\026\355N~\212\004\022\025/\254\006\206i\261-\252\234w:\020\274\244IA\212\376\337T\306\221\357\332\243\344\021\356\246A"
+	.string	"\333\332\203(\f}^*\t\305\007\335\252\025t\002\203"
+	.ascii	"x\025\030\037\306\314\301\004U4\374\362\374\006\035\323\377"
+	.text
+	.section	.gnu.lto_gyroDetect.46.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"M\f"
+	.string	"\346\227VB q\223\016?\244\331\237\371\260\207\177\300\001#\234\266\356\250\210\220\2430e\327"
+	.string	"\007\020uQ\252\331J\320\226\3677\020cC)\251@p\203\001X\316\037B\026PD\b\034\300`\223\212\236\204l\262\345N)E"
+	.string	"D"
+	.string	"@"
+	.string	"\030\026\021\027V\270\354N\313\300\t\304O\360\036\361\223\202\270v\250O\363?:\210\007\203\r\256\333\0169\\\341G\213\227\224\216\356\003\005\220\260\240\342\243?P\347y\217R\260\273~\\\267\341\236n\233\201\355\004\366A\002\261kq\251\321\240\264\233\241tcI\023\214\021\027\375v\307\037\031\343\213\264j\323P\271"
+	.string	"\225h\331\235\007>\371\243z\317>\212\247\350|R\370\200\335\220\312\213\335\211\300\231\352\223ge\333?\361\224\21658Q\272\036H\025\324\003\001\274\177$\332X\204w\316g\261\322\301,(!>\250\236\370&\361*G3>\357\305\361A\265%\224\274s\327\216\030*\244\217n\366\334\236\236\330\207\253!\373\242\233\372\374\241>\277\n\227\324\224\210H\315\202"
+	.string	"\023.\021uH\206d\303\3318\300\244\311\003+\223X\306\2712\213\263\321\214X!2\2632\005\214A\270\244E\202a\322\302\314=\\\r\3712p\344P\217k\361&J4\236\257EJA\266)=i%\020"
+	.ascii	"A\0230\305\320m\242\360\034\336+\251\026\254\322X\\#.\214b\233"
+	.ascii	"\351\244\331\315\t\305|\352\034\264\013H\t\264\352\246)\205\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.47.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\006\001=\r"
+	.string	"\206XZC"
+	.string	"s\224\016\230\203\002J\232\240\271#B\345\2239\333\303\031&\033\255T\310\037\304S\346\306c\332\307z=\006\203GpN@\2366\233\020\001\361\367*I_\205(\332\020\200&\3233\257N\021\023\302m\345N)D"
+	.string	"G"
+	.string	"G"
+	.string	"\003vU7h\354N\006\336d\227\236/p]f'p]\332\266\203\007\"\2174\037H<\032\244\2208i\365\330\235\233\242\370\350q\344\277\365\n\251S\b\242H\217X\310\356:\202(\021\267\336v\002\333\024\354\203\bg\335\362+\177\224\321\3174:J9X)%\264en\210\360\307\262\310\032,\316\372m\221\3372\306w\361\225\350\254\220f\232\213\312\254N,*\n.\035\222]j\027\235$\032\001kZ\251\210\020\243}\225\267\020}\245\344\001\334gx\016\244\220\021\340&Pp\370@\301\304\253\255A$\036\224\252\231\224d?F\207\005\240\335\035\006\207lw!\274\360\360I\330\261\342\322/\271.\257\006R\247\026p\204I\f\355I\212z\302\376ew\327\252\262\035\215\005\234\307\ta\3608\023"
+	.string	"x>\031@]\347\262"
+	.string	"\342\316f\344\003\372\\\350<\022\317\366y\335\007\342\276\r\364\341\210l\035\357\3336\b\334m\340\274m\244\353\274\r3\367\227U\025\246\232\211\226\354\207.\251\230fR\247\360\304F)\206\226j\007\030"
+	.ascii	"5\203y\036+L\3232\366b\2646\366\033A\301\fX\f\216(\202\312&D"
+	.ascii	"\343y)\3064\005\324\016v\315\036\232\200\361\260v\b\tW\230@."
+	.ascii	"(\f\206%@E4]\363\t"
+	.text
+	.section	.gnu.lto_gyroPreInit.49.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375 \306U\005"
+	.string	"\262I$+pm:\240l\307=,\314\rnH\235\256\374\2638\277R\264\267\237CN\331\302\360\033\307\377\317\225\t%\316\264\300\343m\374{\313\024\267*\r\313\260\305\244\221\006W:kvU\3160\306\203-Z\2712|B.\312\332\234\224\251\220[\t\0368\331\375a\027\345\345_@K\360\217\004\216\350[\n\251\273r2u(\360\321\374_\352\333?\3320\323\205\rh\342)u7K\314n\033\267\357vv\340}\222\215\002Ew?z\237e/\367?\342\177\342\277#\b"
+	.ascii	"3\003\316\2311\340\313]\303\335B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_gyroInit.52.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\312\034\035p"
+	.ascii	"J\254\250&N0\020\342\032\003\257\272\325\355\270\200\223\222"
+	.ascii	"\225\352\251\351\025\016\246\205\200\017\210zAf\207\253\3456"
+	.ascii	"\244\307I_\016S\035\"\250`\272\271\211~\240u\205\001\020\245"
+	.ascii	"\372\340\274\316\363\211*\025\034\b.\346\342\204@s\311\2300\004"
+	.ascii	"\016\366\244\221\224R\nA\002;\002d\002\316G.\316F\354\\\324:"
+	.ascii	"\023\261\363\bv\036bg!v\026\321:\207pq\016bg\240\326\371\207"
+	.ascii	"\235}Z\347\236\326\231\247u\006\321\342\274\343\342\254\343\342"
+	.ascii	"\374\241\3059\247u\306iq\276iq\266iq\256iq\246i\235gZg\231\243"
+	.ascii	"sL\213s\362\350\f\303\316/-\316\310\243\263\013;\267\2608\267"
+	.ascii	"\255\263\261u.\266\316\337:{\353\334R;\210M\2765\036\201\357"
+	.ascii	"\227\366B\263W\336<\343\\\230\321\213\336e\335g]dnN\241\331x"
+	.ascii	"\007\257N\215\037\213nK\253\214;\215\031\331F\035\274(\247\320"
+	.ascii	"i\334\204\322&\206\357\373\"\213\314+p\2335\032#\317\226,T\032"
+	.ascii	"n\006\034\333\330e.\320T\332\013m\251YyeHm\344\245c\033\231\251"
+	.ascii	"i\005v;\315\n\265\341\001\350d3|\3374\345\337h\267Q85\2350\301"
+	.ascii	"T\202\204rI)\t\351\310\250\210h\304\220\220\210\020A@?>=< vt"
+	.ascii	">\344\340\334\330\324\320\314\310\304$a^\220.-G\226\326X|w\271"
+	.ascii	"\247\032\205\013\266SS`\237(\326H\337\372z\357\n\260\230\324"
+	.ascii	"'6\205\342&\2364\323\223"
+	.string	"?/\341\244I`[\211\207\365%\274\265;Wrb\347IL\032\211\311\022?R\322FI\272\250.\211\023\325\025\201\202\\}DQ\211\244\n\332{WJ\2122\326*R\342|\b\256\205\206\274\271\bn*\270\016\021\323\264\312\225\035r\301\030\322A;\350\340@;\270\371\017Z\373\364\260\020\300\005\343\254y\314\312\034\004\332\016Z\217\253\034\\\207\354\003\331\230\347\364\270\372\3418a:\374\006\254m\300\276\274\246\367\256r\b:\215W\317x\341p\031\257\030\032\320:\250\307\225\325\223A\\0\264\032&\313_\366\256\264\212@\357\373\"\213GQ\210\364\320{W4\2127P\035\317\356qU\303]~\212-#ki\264V\200:M+;\344\2021\355\2434\332\336x\321\345h\256\253\351\263\314\350\326\310\002\022\253\312\213.X3\372\213GZLb$\261^\024o\364\250P\032\255\335\n\253\351\316B\300\373\276\354O,\030\315"
+	.string	"4\363\0072s\007\314:\037\004"
+	.string	"\264\221\275\313\253\256\324\245\341fe\265m\3544\347ri\020\300\352\332p\033.\265\215X}\313\255\2727\274\237-\337\205[U?\305F\314\306n\274|\225{Z\nZ\316\324\376\272\227m\212\247\340\331\235\321\246g\035I\0254\f\371\325\024\377SpVZ\034N\303\3151}\266\347\240\361\333og\"\230Gg\030\277kH\357\310\316\212\317\354\206\371\f\313\227\030\336\3449\310\303a8V\361;\206\324\216]1\207b@\204\365\030R|"
+	.string	"R&\207g>Z\366\247[\271>pp\311\310\3326\262L\301\345i\225A\351vDD\227\257\3625\263\003\336\202\353l\031\322#c\204\207]\324W\244\345\2379\205W-\223\376\"\246)\315>\007\003\273\203\035yS\216\330^t^F\216N\305\201:\327\250"
+	.ascii	"\354/S\"R\225\266\322W8P\207.z\203\203c\307\273\365\032\031F"
+	.ascii	"mz\250\233!\344@\235\267h\314 \007\352\300\325\265\335\323\n"
+	.ascii	"rG\341@\235\270\350\373N\265\326wO\273\302\326+\026\335\361\276"
+	.ascii	"\257Q\0032s`\267\026\007\036\255\357\325\233\366\032\025_\032"
+	.ascii	"\236\310\334\177\375d\311\375\305\356\017\327\3145k\333\370\257"
+	.ascii	"\323\226$\n\344\235\326\330\002\034\373\276T\375d>\240\375\022"
+	.ascii	"\310ic\037/\300\200\367\223]\b\017\271\303(/~\212\273\201\336"
+	.ascii	"\323k\001\362\366\245UF\330n\313\354@\337\271/vR\266\261\256"
+	.ascii	"k\346\024\275d\371\242\244\205t\315\220\260\220\205\221\034I"
+	.ascii	"4$\244\362l\3435\315\334Z\226\"s\210<8H\275\032\375\245\264="
+	.ascii	"q\"\205z\321b\261\227-\363\003\035\267Lb\337\367u\342~k\270\b"
+	.ascii	"&\250\240\202\266\215\314\350\025C\302\326\361\324Z\362_\355"
+	.ascii	"\306\240\365W\241\346\344\205Wa\346\013Z\007\f\216\357\373\302"
+	.ascii	"\211\273\255\3352\340\376j#k\260\201\367\263\215\334\033\264"
+	.ascii	"m\364o\264\036\"\322\226\247evF\345Y\346\264\246\177\225\271"
+	.ascii	"?\233\315N\341\357bn\235W\264\316\024\364Ys\212\244\263S\322"
+	.ascii	"\271\211\235O\230`\352\262\346\0220\316$`\234\225/\316KHg\245"
+	.ascii	"\3269\t\351\214\324\006\314J\337\302"
+	.string	";\325\276\312\245\341\005\373/\\\252\017\366\233\314C\246\025\357'\267\333\037\221\274\177]3D\317.Q`\023e\232\351\230\210n\245\312\241\241KMR\311i\342\240\362\224\341\205\356\224\322\372\276TS\234\220\231=\301\235\232j\233.\3055\033\201\255\362(\256SH\320\205\362\004\272\324$`\2206\216M\343\324\374\206\31082\203\222\273\021_e\037P\347U(\004\323\233x+\356y\025jv\331^\266<\337\363\017\310\202V\323\263\177Nx\376\211\030\301\332\030\362\353\303Q\263R\341a\231\344k1\025\322$.\213\007\241\2572\210g\352-\217y \336\202)\333\341\231{\001\312M\211\350\206rC\255,\304\316\335\273\3631M+\022g\f\242\026\260h\b\372*\353\374\207\177\251a\211k\345B\260J\\h'b\223\270\324&\304\326\351\274\013q\342\202\037q\255\372\316\312.\fN\347B\373\210\021\227\332o\326\"\037\2128"
+	.ascii	"1\322\005T\324)A(\206\350"
+	.string	"\274\372\024wJ<\323[1s\316\253\210\371\234Wa\272\366\203\363D\344\350\236\203q\313#\034\316\267\2344\221\354\214\312\347\253;\f\271\322\363U\267\245\r\266\r\005)\025CB*F\302c\006\034\317\315K\251\375\335<MS\213\2123\332\334\013\233\202\370\252\263\265\rY\307\274\r\007\371\233\223\356x\r\034z\315m\t\226NQ[\363^\203\232\023\257\216\371\232g\201s6\253\374n\3700\363\217u\025Sc\301*\0160g\255i\276\253\250\375}\027\2651O\363}'-T\363k\3539\234\257r\023\212\3419\2576\315\327+\304\2308\2575\215\327%\336\n\254g\324\226\307 3\377z\327/-\263\033\231O[\372X\337\367E\213y\231\317ifQq&\266\265J\0249\233\027*6\244\360m\325\274\3201f1\257\003E\032\245\362,M\362\207wQ\013\363\3111\230GA\332G\026c\346\345\243^\030\324\003\3427"
+	.ascii	"aVr\0376\364\300r\036;^\2542_\365\254n\357\0351qa\331$\362\277"
+	.ascii	"\3729\330E\255\313#\277\2351\232\236e\034.\217\202\024\3570\352"
+	.ascii	"\245\305D\006\230\257\342u\313G\275 \bd\n\237\223w\020\277\341"
+	.ascii	"\316\360l\330\016\302\234\3445\2703X\334\300\232\001\354\301"
+	.ascii	"\222\tO+\240Z|\020a\003\016\"\210\222\300\005r\305\223\024\213"
+	.ascii	"\022Fx\202\340\211\004\026R\025\204\020%\325\342\351\251\206"
+	.ascii	"9X\"\201\205\b,4\210\222J\001J\351B*\312\205\bO.\224\"\260\330"
+	.ascii	" \004%\007R.\224K?\034\325\342IJIBT\224\224\022\231F\325\305"
+	.ascii	"\367\273\030\004\037\207mW\247\346\353F\353\343\025\261$mW\232"
+	.ascii	"\306\353\023'\236\t\240\372f\361}\337\027\305W\271\234\252\272"
+	.ascii	"\005\247\nS*cL\275\266\370\202\251"
+	.ascii	"Wl\2320\355a\307\225\216&\022I\212S\305\267p\311'\222\370\236"
+	.ascii	"\233\026\036\236)\355\376\nS\317\312\333\341\375!S\357\370\206"
+	.ascii	".\227\013=~\265QYHvF\005\205Mn\312\211\2572T\273\324\003T\341"
+	.ascii	"\322\0070%<4\361U\236\002\3453\350B\225R\\\352P\224@\250$`\222"
+	.ascii	"\017LP\351\t_\223\177M\260|U\372\271P\242>\227\332\323D\351\273"
+	.ascii	"l\032H\306E\230\222^\005\337\362\270\227\364\001L\001\017\317"
+	.ascii	"\362\240x\360\\\250\322\235K\375\261\343\373%P/X%H>\260\353S"
+	.ascii	"\006\32233\233|\035__\036\211\2631\375\236\216\257JV#.t\310Z"
+	.ascii	"\304\245\346X\347\220\2146L\241\220\225P&\211a)\251\235\216\344"
+	.ascii	"\256F\177\004\367\346B\007\330a\210\021\017\207EnmN_D\242\b\221"
+	.ascii	"\0330(\211\330\326\324\202\020\241\310\023\264aiD\032\332\210"
+	.ascii	"G\352\035\331\022\362fB\312~\260=\331\217\341\220\265\341\305"
+	.ascii	"z \376\2160\035`\377\225\343\275\036G\t\356\224\367\363o|\r_"
+	.ascii	"\265\361]O]\353\n\2329\004\225\206^\205\320\213\370\241\025/"
+	.ascii	"\364\355\234kzv\305\213\370\007t\316\275\215\345qk\305\0070\265"
+	.ascii	"K\372\25233\2370\001\361\362\232?\305\202@\356\374\220L\210\230"
+	.ascii	"\242\373\301u\364U\366\"\244\3567!tZDI\335\024\342\2319\351\263"
+	.ascii	"\226<V~\032_\203)\310\224\302\234\342\375dNi\203>\304\033\233"
+	.ascii	"8\023_\352Zu[\324\205\0160\303\2456\311\b\372\266\306\224\216"
+	.ascii	"\354\354c\270I\254\fF\266\347`\323\003}\267F_-r\232\\\227\263"
+	.ascii	"\350\273~\230\205\217\265\354>\353_\271\320\276\263>4\206\237"
+	.ascii	"\357>\034\215\364\004\f#\362\371\227>\265\277\006\376\005\367"
+	.ascii	"\255|\036\251G\327\245ev\206\200\367\332\273\260\026\202Y\250"
+	.ascii	"\022\001%\221\202\2269D\"\"I\222J:\242\013\020\006\002a\024{"
+	.ascii	"\352\001\022\300\302Y\216G\241SF\325$)4\007\236&C8\026\220N\345"
+	.ascii	"^\270H\323\320\317\300\354\233\321j}\245@[\274\264jK\2726\255"
+	.ascii	"v#\027ka\204\200\321\003<d\232\373\2612\255\227\021\356\016'"
+	.ascii	"\025\226\236\353\365}XIG\257\337\371\300\006a_\205FI\310\201"
+	.ascii	"kI\024M>\367\266\233!o\376\030\335X\036cL)T&\352\321\330\366"
+	.ascii	"GAqlQ5\310\231\316\240|g\235\346\020x@\337\304\302\004\361*c"
+	.ascii	"\352\377\013\304\354 \221JB\222|W5\313\035#/ \037ml\353\233R"
+	.ascii	"\b\376 \261\334\251\277\001\340\230\304\302\335\202S\267\362"
+	.ascii	"c\305\306\264\271\373\253!p|(`~\332y~5\352\347\364\030\316I\202"
+	.ascii	"s\324\261\312\352\324\347\372p\365\254P\350\031\257\002D\322"
+	.ascii	"O\021QG\211h\366\310\303\330\332\235;\214w\215\241\370\334,\216"
+	.ascii	"\005\277D\343\353\260\036\207z\270Q\377\247\202E\261\022_p\255"
+	.ascii	"\330)\030\333\367 D\245N\345\033\034\003\350\371{_re\314\350"
+	.ascii	"<\352&)H\032\213\267!(H\244\316g\255X\322\356\342&\252#tP`\033"
+	.ascii	"\330\032I\373o\033 \b\311\311\"E\257B\n3Y\214Ed\230\321\255\244"
+	.ascii	"*-\021\360\250$\240\352LC\032\257\270\020&\274s\205Z(\306\335"
+	.ascii	"\234]\216\264\205J\277\025E\b\006E3:\255J\303\221"
+	.string	"<HD/ $MG\217\230dl;\273\216\327A\2158\206\005\005\277\202\250\026\0335\024\235\201\221oS\372\027\315\325\200\321\334\302\227+\235\234~B\345^\354\202\r\306\301AMc%\n\021\334\326\242eA\262\225\023\375\321\322\027\030\303n\302vi\302\325<\254\320\214\367\362\337\2005\245\332\r\315\013|}\021\030\362\247\212\307\211\004\022\317^\377~O\307\036D{H\021\242\323\252\314\233\034\023^Uw\331V\236\n|\206\341\225\021h \373,SD\211.SKP\360\001\252\255-:\262l@%\013A.\244\020p\225\302\260\325xT\265y&\233\307\326\346\215\211g\254{\221\334\210`\0353\307\376\r\367\365h\361\016y\332\322\252\346\234)\265~\0048\315\264\254\221\312\252\201\3261\223\002l\262 \355q\005sa\216\210\2300,\272\271-\375L\252b\352P\037\025zD\242d\377\232,\267~2Z&\3609\345"
+	.string	"\230\305t\264\354\353J\261u\227,\020\224/\233\213\337y\3671\032\261\377\227Y\246\233$\351\036\255(\337\254\211\342\344\271\3049\260\210\203\3178;6\305\201\213\337\256FT\261h\354\031k\241\312LkZEc\304U\267\223\333d\324\240\r"
+	.string	"pe\021\247\271\347|\241\257\342\355B\311\3035\302][\231\231\230P\256\324G \262W\265)(\007\033\371V\346\\{\314\234\240\306n\213E\220!\242F,\316\371S\222\205\301\253SG;\023\232\344<\0076\027\\\321mQq\001h\256\231Q\252.\347\261\2758=\326\342e\005\325X\215\334\337=\\\232\355\003\251z\033\350&}e\366L\210mK\006\024\206\225\003\023S\362\211\20784\222\n\210\025\022\354\244Be\301\252\242\024\323!`W#IzY\304\332H^\373\312\346n\224\264\367\360\266,\203\314\2149\244\246q\\\006!\331\221%S\321!\343y\255e\243q\204\254\374\322\006\n0\375\341B\251\316(\361\211\264C"
+	.string	"\261N.\034\224V\324K\340\317\242\215\201\223 \032N\321\253\341\361`w4)(\200\343\224\230\257\n\303cB\234\304\256\016/>\243*\002aOkbvY\177\227(?\325m\205\323\222\362\266\233\3767:L\363\313\377\371gH\253\312\242c\341^[\273m\221\312\240R\225\025\320\375\241\230\350\210\244$\216\363\t\217\266\231\252\177)\304\3704@\202s2\273"
+	.ascii	"(\212\234\255\363\343\367Vz'G\0010\351\023\276\240\330\241\237"
+	.ascii	"5.\2247;PyX\005H\004~\321\023D\f\024\342\270\343#\351\366\332"
+	.ascii	"i\373\031Z<\272\025\r\355po\373\013<\343Y\026+\261\340\257G\215"
+	.ascii	"\263\371\020"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.53.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"B\21504pk\322\001\0202\204\370+\\1\\\0316\200-\311\310\354N\032\340_\215X\324\373qm\364/\306\330\233N\357\207p\b\230\332\227y\034\332z\237l\"eJ\001\256P.\02351\300\210qxU\204\025e\251\03655<\274J\254\036\245\300\020\302\022\337\005\302\370$\333^=\251\223K9\366?\337,\037\303\230L\036\273\3633\322]j"
+	.string	"\305\225!{\333\244Z\330\217V=\266\323\251\002\037\220\354Z\310\356D\b\264\037\316C\263\255\261%\276\30674\266\026\"\256\016B\006H\242cdw{\223\023Hw\321\007\244;\275\270\365\264\374s\\\201\243\211`\331\346\t\220\260\273N,\353\334z\333\006\266\017lW\004\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.54.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\311\001\305\017"
+	.string	"6\236hD"
+	.string	"\221(\035;n\276#D~\275f\244\347Y\030'v\305\243fq\332wF\007\007+=\361\352\016e\337\352)\004\r\312\236\345s\334^\320U%"
+	.string	"a\004\365\355c\342_^|~U\377\332/\371do)S\nR"
+	.string	"Q"
+	.string	"X"
+	.string	"\037\333\231v\002\005\251\277\230Xw3\310\250\330}!\260({t\312\256\371\253\303\nh\251p\022\223cw5\345\360\324#\324L\371\234\220\216\353S=f)\207\236/\345\032\372Z\260\300\356>\304\323\302\307\312\344\204\354\256\323\365\241\334\330m;\260\rb\347\202\fTL\200\020\021R\177\304_&>\213'ty\327\243\337a\217'\225\030\035\030Vyc\277T\251\033\354\303\325\025\373/\177(\246A0\375\201i\017Lw2\235\3054\006\323\021\246a\246U\323\377"
+	.string	""
+	.ascii	"c\306w\227\026\273\027nx,Md\341\301\366\003\003`\\p\234\364\300"
+	.ascii	"\324\036\035\005)\024\343\304]6\242b\2524\274\027P\275\3427P"
+	.ascii	"v\327\007Z\273+\003Q\357\315\260\362\306\252P\241\013\317\346"
+	.ascii	"\252\032@\203K\215\223\036\271\273*\365\206]!\300\310h\345\016"
+	.ascii	"\333$/\261e\273\013\342\2238\214\004\237\345\321%\216\303\036"
+	.ascii	"\257\001%\316Dj\020a;e\036\211J6\323&\302\241(\220h\035\212\353"
+	.ascii	"L\244N3m#%m\204\3524\021\001s'\022J+\3418\224\366y\355\341\352"
+	.ascii	"\212\263\232\026\232\225\262`\374H\373\201H\336eU\325B\220\332"
+	.ascii	"#O!\363Q\220G?\312\211\361f:\352\321{\0372\355\350=\233L\003"
+	.ascii	"# \200\002!I\263\003\323C\243I1\\\f\373\016c\201\333Gq~\315\210"
+	.ascii	"o\177\364\032\213\004!&\231wf\226#_\261\bq\027+\3432w/D\3542"
+	.ascii	"<B\037\225\214\270\334\021\3369}\313\355\363\207\017\023\341"
+	.ascii	"\250\316\344\320%\r\330\236<~zk_\031"
+	.text
+	.section	.gnu.lto_gyroActiveDev.55.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\005\f"
+	.string	"V\026RB"
+	.string	"\2216\03587 \233\037\274\254\377]\034\254\f\314\251\270\325\202\270\022 \360\336\263\210O\375\035\032A\364\2614\037M\253\007\347\370\311\351\177\227\202.\366\0371\004\244\240\003\214\004&7\343c\333[\312\224\002>"
+	.string	">"
+	.string	"@"
+	.string	"\353M\366\316\221\0361\017 =\252\206k\207\232\232\177\226/\020y8\301u#\207&WX\340\244\205\211\246\023A\216K\206\031gy\226t$\231\034\nv\327\311u\027\356x\333\flw\3547\b\334\243\037\"=^9/!\266\374lo$U\305>\\M\261\235\206\232\316L?\002\2201\352\336\341\333\265\360\335X\027\221\305\006\333\"v\306\377p\020\"\326\264\302\204\r\305"
+	.string	"\207\023\n-56P\007l*\262oB\323p6\365\026\b%$TW\2612\312\244G\250\207\301a\330\362\203PU2W\320pA\321\177HW}A\342\205$m\330\266>\342\003\263\273\007|\021\3670\177\364\350PH>\356\360\200P \312\201ue\036\023vY\030\350\203M \352A5u\\\330\344\021`+\302\347\232@,\353\2322\336\036\256\246x\303\251\237\"C\360\tU\t6\\\372(2\002+\273\233G\250\352\304H-\261\035\025"
+	.ascii	"&\013=\205\340\001!>3\001\253!5\241\347v\303\035d\266\326\277"
+	.ascii	"W\027Kq\241\344\t+-\f4\036,t\ro\307\342\375!\310qW\254jt\212"
+	.ascii	"\246\366"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.56.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"m\f"
+	.string	"\306VTC"
+	.string	"\2216\03587H.\201s\304\265\336M\333\237\370\234*Z}\322*\201\212@$\t,\250}j\r\031\253\024\371hZ=8\307\3771\001U\265\254\315\002\246x\002R\320\001F\002\223\233\361\261\355-eJ\001?"
+	.string	"@"
+	.string	"C"
+	.string	"\273_\345\357\035\3521\363"
+	.string	"\324\243fx\351P\263\344\337\345\013L-5:\217\344\360\344\n\013\\hq\262\361L\260\003\203B\343.O\023\257$\263C\301\356:;\257\302\035o\233\201m\217\375\006\001\371\356\321\027\241\036\257\235\230\017\\\236\354\217$U\305>\\M\261\235\206\232\316L?\002\230\201\302{K\214]\n\247\034\353\"\256\330`{\304\326\370\035\356a\304%\235\020\201C1\300A\203\204\227\033\001&\373%B\233\316\026\235\304\307Y\310\260\365\027\007# \\O\261\302\262Q\217P\017\243\263\300\345\tBU\311Ta\003\006\203\036\204\272\352\013\0211%\211\3036\366\020 \231\335=\340\203\370\247\371,\217&\211\004\016}B\254\221\005\302\262\355\243\3222L\033\211\264jdy\\U(\323\252\217"
+	.string	"c\017DY\025\202aY\245\371\366p5\305\234N\375\023\033\002\020\351J\300\351\3227\261\021X\331\345<H\227'\325\3046\324\001\234\006\026"
+	.ascii	"5\013=\205\340\001!>3!e\t\24520\325:\214\323\rK\220\211Z\177"
+	.ascii	"\\]\004\305E\221'\242\264\b\320x\b\3205\274\035\213\367\207 "
+	.ascii	"\307]\261\252\321)\232\332\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.57.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`~\001}\017"
+	.string	"F\336hE\360\222(\035\262\\N<Y\241\375\317(\007\321\231\341\332\300Z\240w\256\221\375K\301\307S\2518\262Sim\257\254\344\025I\034\025\354\327\257\270)D;\224fr\352\365\343\321\223\251\350\324\355\016\261\255'{K\231RV"
+	.string	"M"
+	.string	"Y"
+	.string	"\273\n,\362<\202\240m_\366\024)\253\020h`\255B&N\244\320|\354.7\340#\333c\236\300\366\250\"\256:\324T\371\207\371\203\226\254\346\005[\035\256\\a\002\0177V\004\300Zp\304&D\316a\236*0W&"
+	.ascii	"\007\273\353|\301:\334\361\266!\330^`\277G\321\335"
+	.string	"I\376\365\350\237l\217\327\320\b\032V\356\330\263Uj\213}\270\273ke\361\347\263\337\263\245\267\230\216\232\206\232V\230NM?\200\310\216\034\330e\265]\016;@6G\244!a;e\207\330\316\264\377r\025\251\317\\\303\237]\020(fljO\240\260\375\025\025\344\322\225U\257P\257c\203\215V\205\313p\355:7.y\214\221\007\206GzN\314\345\323\353@\250-\2313<l>\350M[\252H\211\030\034W\376\260]\372\013\223\307E*\207\363b\243\316\302\265Plw\033\330\247\323,\030\270\331]\0061_a\342\273<\337\t\303\b\232$B9\241N%\235\227\301\304}^\367\241J\037\207:\215L8\222\367q\242\003\356.\224<\016\245\353<.d\266\207\253,&\221Q\237\306\367\232\b\035\3518Hd\322\237\371N\213\355\262\376\262%t\244\267\270\331T\305\366GA,m9\352G\237\022\204\225;.\2200\034"
+	.string	"X\013\3751!\001\242\003\315\255\254\030\b\261\343f\264\022\261/\260\335\023\3302\243]\316\n!(V\344`Q\022\013\240h\202\263\n"
+	.ascii	"\301\335*uA\2201\233\201t\215\242!\002\366d\342\301]@\252A\253"
+	.ascii	"D\232R(("
+	.text
+	.section	.gnu.lto_gyroReadRegister.59.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`@\001\025\016"
+	.string	"\266\232`D"
+	.string	"\223[8\373\272>l-\207\342\270\017\330\346\265\335\357,P\315\330\350*\2064/\271\377\270\251\001~\334f\226\252\t\020o]J^f[\352\372\031\003v\247\322\245\f\016\230o\003\322.\217W\343\266%R\246\024O"
+	.string	"F"
+	.string	"O"
+	.ascii	"\037\220wl\233\204\001\212A\002*\246\034#%f\254\244\310\331]"
+	.ascii	"i\ns\360\227&\350\237\346\021B\231\032\224h\372\005 T\311@\211"
+	.ascii	"\034\256\027\tK|!\"\246\\!$n"
+	.string	"F||\262\210a&\006aw\235(q\303\335\271m\t\266\037\330\377\020/\366\257\335]\253\213}\2451\247=W\375\372\231?3}\220\220\035 \304\313\324\330\325\360\243\307\266:1D\330\276\177\342c\351+\277%u\023\263\273Y\311\316\216bg\366\f\216\203\314\253@\353n\007\026\214\335\325\002\007+\266\004\241\253\340\n\330|\364\005Q7!U\223\263\273\r\336\301\224\305\266G\017\23444\226WL\355/C\036\345\321\323<@\013\307DKEM\227\276\030G\b\035-z\320\243\372\361\bL4`P\334HI\036N\275~\305\307)\177\330\25305\241\315S\n& \316\204\224\031\3649\341F\234\205\316+\205\264\317\353\276\321\366i#\256D\244\201\274O\373\030p\207a\363\264\223\256\363\264lu\372\265\352\342\324\217wA\032\320bS\300\342Fl\\\"\352*\244l\304\\@~<\013\222\210\207\335\323Q\037\rz\030"
+	.string	"\323#\360\371\241cW\360`\f!p2\223\360C\221&s\227\2339\340W;\244\352\352\272"
+	.ascii	"eX\037\270\240)\324\276\022\246M\306\026(\007\006\003#|\006\256"
+	.ascii	"\236\007i\266\224GPP"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.part.0.117.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"u\n"
+	.string	"\346\022E=0\305*\035@\020_\227\201:U\003\351\207h\211&\234\236\021\024\035\377\361\271\3641\2722\2040\252\305F#\021\"\002\244\177\34000\262\341\302\0214\001E\245\344\244E\234\025m\262wJ\0011"
+	.string	"3"
+	.string	"4"
+	.string	".eX\264e\037?\026\323\272\260\200\315v\267\236N\217\213\237r\023\375\217\037@\245L\237\004)\215K\203o\002\f\273kn\343\246\267\275\261\315\261\277\020\264]\214\032m;\350J\310_\267OR\362G_^\326lJw\221$fM\003\022N=\245\255\331\210w\221<w9b*\273\243\302\2513\334\351\345\364#v,\330\355\317SPf~\310b\177?\t\025\004\330]\216_r\223\320\0079\265\304H\036u\352\217,\247\024\252\230\210\200\223\254\311\311\362\334\276\355\\\331\233T!\004\237\317\3634@t \316\235\214\250\363:\207\017\234\210\250!\370\205\236'\254^\367\360\251\0350\254\231\003\177 \017XE\337\007\326\213m\371m\347\312\234\254\005\3404+<\347\f\027"
+	.string	"<+0\036\320\300f\224L0`\334S\034\240\335\250J@@\024\fs\205S4!\364\350\202\020\037;\343\025uC\247-\233y;-"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\351\0045\023"
+	.string	"6\335oJ\300\226M:\250\036r?\025S\275\256?t\234p\005{e\212`L7Y\201t\273\376\375\353O\0026$\257\333VT3\033\205U\021\\\004\027\301\025\211\241\t2t\013X1C\207\006W\357\3271Y[[\266;\t![n\231\002W"
+	.string	"`"
+	.string	"["
+	.string	"2\260:\216/\202\372Q@M3\177Z6}\372e\366\364\177l\213':\\\034h\227\311\323\357\261\323G\322\351\037\345\364\213\366\377\254L\365W)q:h\241\3344\314\354B\270,\313(6\035cB\200\217\367\377\253\343x\273\361\367\257t[Zk\2555\3352\377{I\002F8\364\2336\364\201h\350\007\271\225\031\032\bC\337\350B\177\207\205>\217\275U\350\373X\n\3353\241y$\364\316\214\320:\023\302u\336\203\316q\3208\0236kp\"\036\237\266\202V+1DKA\033\252\311b6+W\362\370_[\021\003\026o\301\231<\005}#\3245\tzf\2167\034\213\240\003+\256\355\233\344h\304xQql)\214*\225J1\270[\256\265\262h\t\031\264\355\272\204\274\343CN!\007P\016\260[\241\374\"wF\224\304\204"
+	.string	"e"
+	.ascii	"\344^I\r\242\245\030\345o\267S7C\227c\241L\242\177dD\337ID\177"
+	.ascii	")D\277\b\210~\322\207\376\220\322C\377"
+	.string	"t\350\007_\333R\0030\336\335R\032\025\006\241v\262RX\005\316%2\nr\357\304\350i\311\214\310'p{'\030H\236\\\"\213\271\225\310\254qgS\016\0332V\"\177HQ2\221C\235\213\202;\031\027\177d\001\027\277\310\230\026\277\306\331b\026T\252\305\253\243\260\305 \324\207\333\245-\026R\005T\250a\030\343`L\264\214\024\2462\006\340\002\031\233m\033\021\240\030\306\2141\242!\201\314\004CC\0178\215?\371#\350\267\200\037V\236\312\264\320\341J\334\306`\331\271\r\300a>\t?\f,N\306I\"@\364&\207c\250\344$\342\230\225x\351\016;\2066\002S\3537\002g\307\221\373\227\372\361\262A\b\001\0264C\031\212\215\345\357+\1772\003\fM\031\225y}\271\304\217\031Om\023\306eu 1*\300Z\352\350,_\330\036\357\2641\317\276a\261(\367\036\004\201\0172d\234\234\020\2408vX\216"
+	.ascii	"\243\n"
+	.text
+	.section	.gnu.lto_.refs.824684ac80c8d7ff,"e",@progbits
+	.string	"(\265/\375`\230\001\r\f"
+	.string	"f\227B7Pm\222\306k\333\341\n\230T\264\332h\300\332\266\236P\033UUUDffffff\026FQ@\314\330\247\317G\254\321\006\331\376x\362I#\215\210m\204\020)S\n-"
+	.string	"/"
+	.string	"1"
+	.ascii	"?\344\250\3401?.\314jbNN\303lF\2151\217\226W\343\024\300\233"
+	.ascii	"q:\275\030\257\364F/\364^\274\316{\247\237V\361u\265\007\001"
+	.ascii	"\257\345\\;Q,\nm>\223\3465\0041\3120\t\234n\234^N\251\257\234"
+	.ascii	"RN\241ur\332L\222\366\030\0269J\233\225\365\241\230\317{c\006"
+	.ascii	"\032\002R\341V\n\023$\2545\302*\204\325\301m\203\225\301\273"
+	.ascii	"\340M\260\"\270=\260\324\300\332\217\245\036\224\351\261\331"
+	.ascii	"\261\226ciE\231\325\346\345\245NWz\233\267u\024`8\356\226l\275"
+	.ascii	"z\203\361\345\200\265\005\213\025*R\224\224\2408abMK\220\030"
+	.ascii	"!\"\004\210\017\036HH\3560\"\300t\204\303\206\313\252!\003\206"
+	.ascii	"\013\253\"\224\251\310\026B\002X9 \300\0021\243\320\rBR\020\r"
+	.ascii	"`\200\3033\276\033\371w\343p\327\265\265\007+\337\303\226\311"
+	.ascii	"\225\357\361\313\300\225\273\367;\260%\355\236e\257\334{\331"
+	.ascii	"\025\367\260\354g\033\327\270\254Xx\257h\266\204{\301e.!\273"
+	.ascii	"\212\025|\353{\345\266\366\264\227u\353\230\213\263\273\371\324"
+	.ascii	"\315gn2q\255Y\366\351\r\020j3<p\321\332\216)\013\360:(\027Kr"
+	.ascii	"\326\315"
+	.text
+	.section	.gnu.lto_.decls.824684ac80c8d7ff,"e",@progbits
+	.ascii	"(\265/\375`Te\305\240\001Z\252\302\225T \fY:\215\001\324OB\035"
+	.ascii	"qd\234C\275\214\261\307\024\255\203j"
+	.string	"\272\277\223R\276p8\305G\366\317\035U1m\331\025\237\314,qT$$\324\352:8\331\355\312\n\037%\030H\236\212\231\215\036<Xk\334\276\352\212o\3366MQO\224\255r\313-\245\224)\032\b`\t\214\t\026\237\007N\237\347\2116\221m\372<h\272\362\034\321\325h\2749\254O\334\034+\031\026_\033\367FM\376\312\305\361\235*\344N\376\310\"\365\303\342\363\004\321P{\357]\177%\237\277\222\317\323\245\353\261\n\345\031W\353\312\250\347\013+kT,>\317\013:W\241|\267.\214\232\344pc\354\240\252\007F\245e\361y\254\264\n\366\256\034r\335\333\253\034\362w\342h\016\352P\316\n\332\272\301\344\312\342\357\220\321\357\200\352Z\335\265\242v\342\203\210ro\344\377\353\342\276P\223\027\353\252\270X\367\352\266\250so{jK\2037R@\334,\367F\202 \002\361\343d)GF\306+.\213\240\026BT"
+	.ascii	"\261\370;>V\354\330\320\337QqS\330\027ma+\344\334*6\372:\214"
+	.ascii	"\256\310*\224\353\330\275J\347&\316\n*u\336\342X9\027)E\213\230"
+	.ascii	"\2638C\334\3307=_d\232\034-\2766\272\3210\364\034P\217\n\270"
+	.ascii	"\257'\026_\263\320?\347\350\237\311\323?\273\350\032W\205\362"
+	.ascii	"\227u(\377\204\242m\035\226\341\205\307\020\213\177&\365O$\326"
+	.ascii	"L\320\334\020,R,\376\351\303\226\241AW\217\244P;b\361O+\375\337"
+	.ascii	"\206\251I+\306z\021c\277\330\271:\367\266\267\226\002\314\214"
+	.ascii	"o\220,\367\336D j\r.T`\360\334o\267X.\026\314N\034\232\027c\026"
+	.ascii	"\2039\234\005\243\006\307\322\342g4\372\371\212~v\323\326X\207"
+	.ascii	"\262\006U(\327\2711mw\230~\366\322\031\270\252P\306P\252P\266"
+	.ascii	"\305*\224\237eh\013\220u(\3333U(\237\307*\224\177\373\344N\356"
+	.ascii	"\033r\312\225\305Mn\230#5\262X\374\354B\277Y&\371,\217\252h\361"
+	.ascii	"\363\224\276\331F\363\024\347\364M*\232\307DC\252e88\265\242"
+	.ascii	"\305i\034z\314xeIa\361M0m\317l\017kU\347\336\260\334Ryf}X!;\362"
+	.ascii	"\354\231\255ayL\3011\263I\254\022\213V\223\366\314\016\261g\226"
+	.ascii	"\210-\003\252B\356-\036\"\306\272\263%\007\020>H\316\264a\361"
+	.ascii	"`2\"\363\352x|c\361M)\375J%\307\026\264\243\226\243\r9#pH\354"
+	.ascii	"\230=b\305j\322\032\261E^\357l\027\024\020D=J\220`\262\360\340"
+	.ascii	"\3436\372\030O\037\203\321\307Ot\020\242\r\230I\233\241\226C"
+	.ascii	"\311\361\207\275\201\006\304\206\325\244\375a\301\336v\314t\224"
+	.ascii	"Ye|,\246\217w\350\343\027zG\317\n\273\031_,>\266\322\257Wl89"
+	.ascii	"\336hr4\332\034O\224:\354\227\365\252Ik\2648niT* \210v\324\224"
+	.ascii	"]\205i|\\\245\177\227\372WO\377\332\351\337.\332\247\n\345\272"
+	.ascii	"\353P\376\215\242{\256\231\376\r\242}\214U(\333\027E&Xe\352X"
+	.ascii	"\374[C\277&\255V\261gl\315\232\270\254\333\342o\364\301\341|"
+	.ascii	"\366F\333{w\370A\373\262ue\261]a_\370\277\0234eG'\206\305\277"
+	.ascii	"}\301b\355\270Ir\235Y\354\242\207\f\215\n\f\213\177_\350\377"
+	.ascii	"5i[X\026\310M\344\243\342\007\026$\026\377\256\320os\270\377"
+	.ascii	";uL\212\231\023\213o"
+	.string	"\333\350\277\326\335\252\370\253\231z\306ZY\343\0057\210\026\035\030\213m\n\" d\021\214\033\213o\313\350W\264\277h\315\235\362N\211w\334{\377\267R\265N\235c\267\245\252r\352\236\255\252q*\235\232\264S\325\315\353\233\272<F\356]U\355\340\344\241\345\245\341\025\351\335\035\355\322|)j\203\344NI\005\357pu\356\255\036\261\340);\370\353\235\232\303\001\355\354-\227$n\357\375z\345/\262S\225\315\341:\254\330[.G\006<\242l\321Y\356\275A\200 \002\021\024\205\314G\225\005\370\226L[d\035\312\037\300\364-\017}\353\245os\350[\033\372\266K\337\312\320\267[\372\266\2501T\241|\213\245=T\241\\\233\024\275\326\t\345\"\027r\277\355\275\203n\034\026\2539\026\337n}\"\353P\376\262\n\345\237\252\324\257e\364\253\234~M\323u\316V05\314\353\\\375r\243\017\356SU\347\360\336S\265\016"
+	.string	"\250\326\001\230W\204L-\311\370\265L\277~\351\017u(\327-'\234\026c\302X\374\332B\327,U\256&\253\226\277Z\251W\216\331\214;\2717\362\347N\311\360\002g\361\353\207\034\264\267\267\267W?\344\247@{\250C\031W\241|'\375\271:\224\237\244\201\214U(_Y\207r}R\241\324\344\0065\312k\223\312\344\346\024r#\367F\006Y t\232,\261\370\"\320\257\033\344\273\267W7\310WA\333*\224/\202\306P\207r]\253l5\t\200\332v\243\017~\245\3306\332\336\310\240\237:fu\344X|\b\350\327%\307\200m\177p!\375\n\200\\\367*"
+	.string	"\362\255\006:V\241LT\207\362_\225\3745IE\373p\257\\\030\367\333\336\310\f?p\312P\225Y|d\035\312\272\n\345\264S\352\267B\360\004P\200Op\346\030\376s\312S\372\333\022\326\307_G\020\202\377\035\276B\215\361\377\202\377d\202\211\277u\300_\263\360\360\177\206\377T\023\362\266w"
+	.string	"A\354\277j\330\351\267J\252\226G\251a(\374?@\333\205\3763\005V\216\377\363\307o\311~{\201\337\252\331\264\337\256\375\266\304\001\030\320\200\313\004\013\377\272\345\277#p\371-\006\376:\246\354\307A\022\340\246\377\336Fa\246\337\226\375\337\362[5\277\035\362[2\277\025\363\337&\314\302\177\241`\005\374\270\004\300\337\036\177\033\344\267H~k\266\374\357\003V\250\350\345\340\277\334\005\001^\372\337v0\271\310\353\177\306\270B0\322\221\031\320\177\022\177\214\341\257ZN\374u\317\376?\230!\357\371O\021\374\026\204\337\256`\315\337\206`Q\300D\277\337\236`\367[\021\376Z\202\377z\3701\t~\\"
+	.string	"\337\177?\374x\004\277\315\300_\217~+\201\273\201\325\300o\237~\273\001\333\346\277\017\250\350o\363\377\003`\021\3748\004\177M\301\375\215\376S\353\277l \370\357\023\376\200}\363\3331\377\345\201=\360[8\2775\363\333\260\277\216\340\267G\354\222\337\352\375V\371[\266\377\252"
+	.ascii	"w\300\322u\330\340Q\276\200\377T\361\333\261\337\326\375\366"
+	.ascii	"\354\267w\277\375a{\374o\263y\026\315\2179\360_\026\360\006\376"
+	.ascii	"w\370\177\200\017\375\371\356\277i\360\n\177\005\341\257\r\300"
+	.ascii	"*\374W\rN\341\257\017\370\253\006X\003\377}\203Q\370k\004\256"
+	.ascii	"\326\034\234\201\277B\340\257\n\370\353\004\360\t\277m\373\261"
+	.ascii	"\211\337\242\375\225\002\277-\362[\260\377\206P5Xl\302\2171\200"
+	.ascii	"/\360\037\004\377O\300%\260\bQV\360\007\374y/\t\217\260\r\374"
+	.ascii	"\230\347\277\023(\341\257\346o\211\3745\343J\002\036\341\277"
+	.ascii	"&\300\026\250\030~+\366W\r\230\304O\300\"\334\303\177\232\370"
+	.ascii	"\255\222;\002\217\370\277\301\217+p\207\347\3713\231\037S\340"
+	.ascii	"\307\r\370\361\002~|\200\037k\360c\016?\036\372\261\320\2173"
+	.ascii	"\374\370\347\307=?\266\377\245\363\337\345\177\365\376{\367\337"
+	.ascii	"3\377\245\373/\230\377j\371/\226\377\246\375\327\312\177\247"
+	.ascii	"\374\027\356\277P\376\353\201\377:\371\357\333\177"
+	.string	"\227\374\027\371_\263\377\016\371o\330\177\301\376\333\343\277:\376\333\365_\255\377\256\370\257\324\177W\360_\250\377\242\370\357\360\377\t\377m\372\353\n~\253\377\233\200\277*\375U\303\177Y\370\357\210\377`~k\344\2677\376\013\374\255\220\377\376\376\033\202\377\202\340\277$\3745\354\267@\376\033\302o\243\376;\201\377B\340\177\333\177\037\360W-\377W\370\037\345\277 \374\327\001\377m\300\177;\370\257\321\177\213\376\033\342\277\013\370\257\002\376\233\370o\375\357\177\273\367\333:\277\245\363\3339\277\225\363\333\267\3372\371\217\366\177\004\377\271\374\027\332\333\333\333\373wJ\3705\224\360_\340H\346\322<c\3061\325\230c\3142\246\0333\215\371\246&\315<S\214E\356]u\007\247\242\305\221\312\225r\216\f\227#\024\256z7\205\t\013\245\235\023\0374\224f\034\027;\345\336\310zW\345\312\250s\334{\027\201\361\242\204\323R\245"
+	.ascii	"Ma\330U)\356\216f\236\371\005L\236\031E\215\222\350g-\306\017"
+	.ascii	"\036F\370D6\364/\220\243\177\001\032\375\013\274\350_\320D\377"
+	.ascii	"\2021\375\013\214\372\027\250\320\267@O\337\002-\372\0264\321"
+	.ascii	"\267 \211\276\005A\364-\270\241oA\013\375\241\245\376\320\234"
+	.ascii	"\376\320\023\375\270:\224?\204D\177(\207\376\220\226\376\206"
+	.ascii	":\372\033\314\350oh\323\277\331d\003]U\345\t\232\305\277\371"
+	.ascii	"f\312`\263\252a\361\365\032S\356\031\\]\224\346\231\211\304L"
+	.ascii	"b\206\231>L3S\210Y\304$3\211\230e&\232\331\303<\232GL7\323\210"
+	.ascii	"\251\304\374a\252\231C\314 f\322\004b\216\231k\246\230\tf21\331"
+	.ascii	"\314%f\232\211\254I\263\315\374\272\271\303\344\201\345`:dqh"
+	.ascii	"F!\346\020\245)\325v\327\212\027Xrfz\215\035\333\334\354\023"
+	.ascii	"\017f\310\272\263e\221\251\343n\321\002a\f\311\266\304\"\357"
+	.ascii	"Z\361\204/9\345\336\273\226\251h\254\n\016\224\034\267\232\223"
+	.ascii	"=e\032\222\207\013e\234\331V\261T.\036\250\031\311,\271S\246"
+	.ascii	"\3755\216N\002\312\272\263\262\275\221jo\325\rH\n\271\2634\260"
+	.ascii	"\353\316\312p\035s\223\035\2210d(\353\316\3146s\313\304\361\302"
+	.ascii	"\003Yq\333\031kv\353Xw\266\024\263\353\316\2260\3146\033\303"
+	.ascii	"\252\270kE\fP\235Q2\031\203\247\204b\341\314\212]\274\250\025"
+	.ascii	"\353\316\226X\316\3156<\007\307\371@\206\353\340=d\335Y\2153"
+	.ascii	"\333\352\024\2659\313\2264S\326\235\325;\263\315\314A\266\353"
+	.ascii	"\316\2265\316l\253U\342\352\316\226\265\214\331f\257\354\226"
+	.ascii	"\022c\335\031\021\t\340\360\244H\340\257A\326\241\fTV\205\362"
+	.ascii	"7\244\351o(\242\277\301K\177\303\226\376\006\0267~f8YCg\257\313"
+	.ascii	"\254a\3220\271j\322\264a\316\270\251e\2768\206\321\345\030\343"
+	.ascii	"n\341\242,\262aR\231\305:\367\206\255x1m\2302\356\226-G\020 "
+	.ascii	"z\340(\231\261\206\007_\210\215\276P\236\276P\235\276P\030}!"
+	.ascii	",\032\303\\\035\312\326\205\231\342f\361\267Y\314)3\313\226\331"
+	.ascii	"fRX\374\302y\026\027g\216\305\027jb\2660]\324\244\211e\256\300"
+	.ascii	"&\226ie^\325\2717\022hQ\224&\226\311\"\243\021\223\304\310\362"
+	.ascii	"V\001c\203.\343\013\361\320\027\342\322\246\n\237)\031R\302X"
+	.ascii	"|\241,}\241+mV\025\335L\221\353\300i\361fqP\025\312\027\332\032"
+	.ascii	"\303\256C\331\262\321\327pFc\rq\372\032\222\032#\253P\206S\205"
+	.ascii	"\317l\215\271Y|\rdo\260\233\232\304K\234\3456\212\225r\"4\274"
+	.ascii	"\304r\270\315]+b\200.\207\022/\355\025\214\005\004\253\"\tt8"
+	.ascii	"\224 lZ\026\235\220\214\331\334N\261[\314\270\270a\3615\360\320"
+	.ascii	"J\234ws|\3218*1\027\234\246K\211\225\370\316\202\001\252Bn\251"
+	.ascii	"\016v\335Y\031^\203\365\260\232\232\304J\214w;\305\022 \356\210"
+	.ascii	"\324\370\032b\350k\240\322\317\260\247q\232\037k\301[\260\235"
+	.ascii	"5rQ\343\212\263\270\216g\016\325\232\"\026?\303\033\375\016\300"
+	.ascii	"\324\370\302\202\316\005\335\257\334\265\242v\373\302R\242y1"
+	.ascii	"\203\307\3402\370\fFS\223\230\f\236;\016\203\305Ta2\270\313N"
+	.ascii	"\221T@\021\344\033$K\020'\0161rq>\370\031\326\350j\254Cy\203"
+	.ascii	"\235~\2061\372\031\274\350g\300\242\237\001N?\303\023}\347\352"
+	.ascii	"P\216@\025\312\317\240\246\237\301\210n\022\224w\346\306\016"
+	.ascii	"\213\265\220\261g^p\240\246\027V\266\274_;,\030={\227W\335\230"
+	.ascii	"|\311\261j\364\352\334\027\034\245\225S\321\266B\211\333l\027"
+	.ascii	";\346\256\025O\340q\245\304\263\3128\307\275\221Z\322\250\261"
+	.ascii	"\241\265\261K0\270\355\376\270d:P]\355\375B\0033*ae\313\n\367"
+	.ascii	"\333,\225L\225R\347\300\366\224\024\bS\274\302\312\226_\227\307"
+	.ascii	"\341\356Z\321\002+:)\312\275\367\225j\273/\256\f\b\030\t++\263"
+	.ascii	"X\214\\\201c\347\320}is\351D\300\314HX\331\022\227\3417\374\004"
+	.ascii	"O\301q\370\n6\303"
+	.string	"I,\005W\301p\230\nF\342(\230\tN\303g\270\tN\202\331\260\032\266\202\235`(\030\r\273\3415\274\004+\251I\334f\231\334V\261V\264X4\326N\215JX\331\322\016W\341\025 X\025w^\240k\242\334\033yi\324\270\306\273V$\341KK\220:\230\352K\001f^\026\317\256\261l>\250M\205\321\201\333\256\227\005s\327\212#\320\311Y\2746K\347\356\273V\324O\250\274(\367F\266a\026\030\t\bVE\f|\251\365(s\331\200`U\334iAw\245p\333\345\272]\027\031G\302\327\026e\333\235\272\305\257\017I\330\302\312*\223\337j\251b\352\034?\370m\034n\303d\325\315\203)la\265k\211\032\265\b\340g\330\032\217\021\005\355\3601E\306\342cP\352\026\370\305E\036G\240zAY\004\037\301Fj\022\213\035\213\341-\354\003\004\253b\006\250\260\224{o,\206\217\357\302A\2218_q8\200"
+	.string	"\201\335\300\264\344\320\370\030\306\364\257V\016\016u\016\254\002F\236\\\331a\246\304>0\f\214\243\003\325\225\trPt\374\n\320\316\336^o_g^\037\352\334\033\21184%\366\201y\374\nP\025\206]5\244\f\373\300F\016@S\310]\314?\302\274`,\261\020L\004\203\341 8\f\003\301C\360\217\232\304>p\017\"\323\255m)G\003~\220R?\b\215~P\030\375 -\372Aq\372AM\364\203\326\364\203\310n\020Y\251<1Y\026?\250\207\376\217i\340\0325\211m`\031Pb`\256\273#\266\201\2730\227\206;4o\312@\\)vl\3322>\020\031\375c.<\243\247\216\222\033u\360\f,\003(\215\210\213\035\026\037(\212>\220\233>\220\232>P\231\3761\326\361\213c-\022\230MVpQa1\316\302\305c-\374\302\306Z\036\030\367\236\302ZAs\366\236\n\252u"
+	.string	"\265\016"
+	.ascii	"\237}\021q\222\361\201\3044vQt\214\225\002\314\305\013\2137\250"
+	.ascii	"B\371@A\364\201|\340\253\341\030\236\016\213\017\244\245\002"
+	.ascii	"[\205)\321\034-\376q\212c+)\273'f\200X\340\251\235\261\030M\322"
+	.ascii	"\260\301Rx\357\224A\223\342f\357x\33768z\bY\252q\305\200\273"
+	.ascii	"\273s\352\0219?U\364k\362\312\271q\316*8l_\340\374\306\371\215"
+	.ascii	">\250s5\t\036\335\033\213\357\233\273\324\307,\251\024K\373\026"
+	.ascii	"$\307\245\016\r7;j\310\200\001s#\203G\021)I,\376O\233\256\273"
+	.ascii	"L\252\314,\376\177"
+	.ascii	"\365j\362\256\271f\326\3343W\315\013\240&S\354\216\370\354\025"
+	.ascii	"p\246`5\312\372\302\013\312+\213o\336N\027\0301\264X\374\037"
+	.ascii	"\031\372\277w5y\361\360>\350\020{a\361\333\3344\377w\254\017"
+	.ascii	"2yq,\376o\232_\273\342f\322eq\335\211\247%\206\315\342\377Ti"
+	.ascii	"4\327\214\32515F\313\342\377H\351\373\344\351\373\324\3511\331"
+	.ascii	"8#\211\013\213\357\363E\217\335#UK\244\034\253\035\221{\304\003"
+	.ascii	"35ii\313)\027\213\0160\227\313\355r\277\\1\227\356z\271aj\362"
+	.ascii	"\316\335,\277>.X\217\271+w\267\334\265\242f\262\004\2142\310"
+	.ascii	"\334\035R\347\324h\220\244HZ\332r\356\226\335\270:\307\205\334"
+	.ascii	"R\035\310\324\244\245-o\020!\027\b\220T\206\275w\340\210\353"
+	.ascii	"\340\277=\346n\330\005\002B\222)?z;\224b\032>\\-\310\240\235"
+	.ascii	"2kn\274Y|\237+\372>M\364}\224\350{e\204\274\033p\026[\341i\202"
+	.ascii	"\245\266f\361}\212\350[\345R\251c\261\361,\276\017\017}\037\035"
+	.ascii	"Q.\334\225R\2237\356i\027\231\344x\343.\333}R\347\2700\354\375"
+	.ascii	"Uv\334{\307]\263\253\344\"\217\247\033]\232r\357\315\001\004"
+	.ascii	"\b\020\027\306\031\030\034\215\237\334%uN\20315iiPn\223\353\244"
+	.ascii	"&\357\223\373\366\213\344\222\235\350>\271L\252\224\213\214\323"
+	.ascii	"-\226\b\251hOn\362\272y}\030\013\223\226\006\302\216\261\221"
+	.ascii	"&\215\306\367\341\322\367y\241_\223\277\273m\307\303@\272\310"
+	.ascii	"Pb\361}\260\364}"
+	.string	"\254\364{\342\350\367\270\321\310{V\335\200\2440l*\272\263\343\336\310\265\232\274\310\253vc\264Q\361\302\370=w\372=h\364\377\213V\223W\311Mr\243\017\320\214>\270J\356Yu\253s\\[J\317\003\262)ii\313\275\221D \352\235\335\030\016\214\337\263\246\337c\246\337s\324\357\351\241+\262\016e\242*\224\337\223C_1\" .,,H\213\337\223\245o\221{\374]\007\252\253=\245C\001m\244\310\320\226Fj\362\0269\021\221=s\003M\f\306\347A\243\317#F\237\207\213>\317\025\315\301\005R\335,\235\027\027T\001tX\340\332\240\3216\254\227\344\231\0233ef\314\320]DF)5\bx\341Bl\316\022\267\241\243\203\305u\335\005\204$\207\333\016\022#\306\271\244\262\355,\2426\305\272\263\245]\216/F\213O\200\030zKo\341=TtA\244bISW\344\222\225\245\265\210\214Rnx`\270"
+	.string	"\342f\331\343\206\305\232\253\342\265\026\036\235Z\2313G\215\245\261\350\350(\367\346\372\300\363cG\335\025\243\256\322U\272\005\221\336J\226\340)m\212\"bL4\213\353\026hcO\274,\326+\316,\237$[\\\013\213\365\025r\352\r\013\213\265\212\273%\tv\225\264X[\035\316\213\220-\036\026\353\024YM\257\030\273\2016\200\254\275==E\244\267\02226\224?U\224\210\201\243\245\256\247\340\260\2163]>,\326\373pR\326\316"
+	.ascii	"\031\200T\2348'\235\033=>l\224ya\316O:xAeu\236\304\260\370\224"
+	.ascii	"\263\206\r\233sI"
+	.string	"w\247\2318\261Q\343\315\317%\233\213-p,>\335\234YAYV\250\321\261\370ls8,\307\026E\351\001L^\336\251\027v\334\341Z\262\365\245\346\247\036\025\214\025\026\237\312)uu\347]\033\021\031G\226?ttrxI\363\363\016\317'E\0275Z,>\355<,9\311\234d\3163\021 \333r\334\\\\\037\364\027\227!s\314\374<S\335r\264\235\301\262\370,S\335\354\362\270P1\022&\314I\0075\206\254\254\007\206\031]\223S\314O\272+C\004-\266b\374\n\2161%\211\027\213\357\241\007\227s9\301X\343\336\333jG\261!\003\242\264e\240\274\035\001s~\t\332F\304\360\370\342%/K\271\226e\312I\362\346F\227\253\242\t\216 l,\276\207,9\271S\313kq\r\035\317\036Y\327\232\026\373\004\267emQY|\017R\372?\261`\251nDF)=\017U\214ugf\034*^f,\276"
+	.string	"\360\252T9\255\274\026\207d0K~\362\260\342\262,\266\222\361\364b`\201Y|\001\310\351\377\234\222<\247d\262\312\266\245xVl\311aS\263\350\025\371b\361\005\020\246\177F\251'\\M\236p\031\257\204=\265\345\301\030\0352\001\027\300\f\375\232\361\362\177BI\236P\252[e\333Y<*\266\336\304Y\356-\227"
+	.string	"L'\257\314\2175N\234\234Kr\215*6>\330+\2754:f\332\332\316\267\332\265\006SiC{a\361\371\346\2036$K\206\305\247\233\034\333\331\316%z\357-\205\334Y'\250r\206\245lsq}\310-\322\320`c\361\222"
+	.string	"\274%9\325\222\234\310\274wE\032\263\212\233\253\370\341D\21292\304\211\305'\332\211v\246\325]t\223\325l\315\310\022\347D\311\3174*\310\031n\377w\314/7i\340,~"
+	.string	"\214\350\007 \306\361\307\323\354\030\366\336T{\343\260\221\267\266\316\262\237fsRl\336\210Y|\0369\311\222ba\274\234d'\222\026URh\2013\205\315,9\206\263Ly\321ps\212\2350\340tas\212\235F|\204\225\031\001\202\314QEL\221\\\254\261\304\215\027\213\037\200\252 A\316!z\022\030\023\362s\210=\323\203e\205\223\030\026\277\215}\202\244\001\003NX\230\222*"
+	.string	"\030\003\006vj\315\3611\243\2743c\361\001@\345\374:\277\316\036\036\230\321\235<~\366\270\307)\030u\026\237;\224\324\250q\3520\333Q\222\314sc\374\251\343\212\351JvY|\3328s\234r\346V\350\345\300\341\005C\312\212\214'\206\021+\275\033\266HU\3231eo\310\326\326\331\025\304\312MY\341\206\353g\327\311\345\005\227+\026\2370\316\031@bZ\246\220\314\220\341\243\304L\205\215\035;T\346\310@\213aq`\025]q\214\344h\321\342\324\242\213\323\203\244\212\231)\305\237Z>WSm\224X|\2728\263\202\276\232\240\221\221\365\3029e\007\330\024\226M\3413\247\206\236\031\254\352\346\036\361:\233\003"
+	.string	"\013\252S\235+*\006$\025\231\034\307\275\271>"
+	.ascii	"\325A\303e\237W?W\360\264\315\341\221\306\342\263\352T\361\177"
+	.ascii	"\307gK\307\022\316\342\377<\213\byaF\2206I\360\250,>SX\260\273"
+	.ascii	"\027\362\346X\334A\316)uJ\331be\333Y\225\316N\306\221\345\336"
+	.ascii	"\\\037\314\030I\254\352\354\342\304\311{U\r\007S\226\324y\336"
+	.ascii	"\233\n\203\362\302\342L\007\b\317\306\230&\026\3479\277\262e"
+	.ascii	"\254\362\303\342,\247J\201\362\345\314n\313\377\235\374%kN\034"
+	.ascii	"\213\337\201\212\376\363\3625\231\2279\315\007\343~\341\301\232"
+	.ascii	"\270\272\263\275,);\220l\330d7\265\215\231\3048E\371\334\006"
+	.ascii	"O\314\0134\333\342w \222\227\227\365v\310\250\212\037\376\254"
+	.ascii	"\346YO\312\325\224\0259\213\263\222\004rt^\026\277M\225\362\177"
+	.ascii	"\007\253\211q\365\260\370\035\262\364\335N\334\321\253\215\305"
+	.ascii	"\317 \216\316v\227\313\310\332\235\305\317\340N\377\231\356\371"
+	.ascii	"\f\232*ct.\223\315<\223\311c2\320\242\377\354\245&\263\227\034"
+	.ascii	"\306\262m) \273/\"q>/\320\254$\347\236\303\374\371K\006\223\273"
+	.ascii	"T<\303\n\207\024\213\215\212\236\347r\231\025\035p,\256su(w\250"
+	.ascii	"B\371\031\240i9\027r\226M\236\255T\273\354\226\265\344-\231I"
+	.ascii	"\335/\212\305\375\225#g\021;\303\262\334\305b\002\236"
+	.ascii	"\201\230~\276\222\261<gy\316\222\345\270\266T\233|\243\312\031"
+	.ascii	"\226\345\346\342\372P\241T\231\252z\233g\271\"b_.,~\006,\364"
+	.ascii	"_o\377\274\247\212{\357\027&r\027\251|\362__\315Z?\374?\365V"
+	.ascii	"\002\374\307\367A\022\310m\2257f\357]\331h1\270\251\032\036\366"
+	.ascii	"\377\177\330[\252\356\275\213WI/\251\fW\311\251}\3256\247\225"
+	.ascii	"\341*\351\245u\205\334:.\330\311\035\373\ni\224\302F\251\275"
+	.ascii	"\267\224\335\310]\345\245\265\253\214RNW\310]\334H\243\024\206"
+	.ascii	"]\245\205\341\n9%u\225\364\322\252WI\243\326U\322\250\225aWm"
+	.ascii	"\251]5\245CW\031\265\256\272\030\2650\\%\247\264\256\252\274"
+	.ascii	"\264*\322\270k\230*H/)\253\235\234\372\331{\273@\036\245|\366"
+	.ascii	"\236*n)1\026k{)\2616\216]\347\314\220;\366\336Rog\276\214;H\252"
+	.ascii	"=wu\304\270d\265\367\231\215\345\201T\225B\356\275Ul*\251\272"
+	.ascii	"\267\025\262\2707\225\221\004\\{\357m\254cT\024\367\317\256\232"
+	.ascii	"rA\365e\364\261\2422\252\330Gt\324\275\367\326\272J~\031\213"
+	.ascii	"\246\270%\217\233\n)U\257\\\030\367q\237\361*\352\244T]\363\223"
+	.ascii	"\004\302\345\302\342\034\227\251\344*\377\216\315\221TV\261\370"
+	.ascii	"\030\250\321\317S\376\357\334\342\032+Z,\366\220\245d\270\177"
+	.ascii	"'\263u\331\241\321\317Q\376\357\360\260\251\341\303\315\342\f"
+	.ascii	"E[a\300e\203 *j\350\2708y\206\362\347'V\r\326ra\217\316\033\213"
+	.ascii	"\177\252P\2664\212\236\235\364|\301\242T\263\370\030\304\351"
+	.ascii	"?\277e&;^\320\342\360\332\236\263\333\017\224\260\264\035\026"
+	.ascii	"\333]\207rN\026=\267\375\310\371PZ,\200*\224\377\214|Mfdf\273"
+	.ascii	"W\306\255\025\201*\\\t\b\242\313a\003\212\305y\355\252\005\025"
+	.ascii	"\031\026\037\203&\372\030$s\332Uc\327\365e\3611(\222\225\240"
+	.ascii	"]2xr\306 \026#\321\262\262\200\030\317\262Y\013[[G\3140\226\261"
+	.ascii	"\027B\234\224e\262:\036RR\214=\223\375\031I\355R\335\352"
+	.string	"\213,^D,6\253P\256V\212\236\307\360\0167YF\216\\ \311-l\276\210U-F\212\260@\203\353hq.\222\217I7(R\026\037\003\033\372\317DT\2306\262\302`\r\251\223\205\344 i)\216n,\006\202\224{\343$\205\305\307`\205\376\007,\336\224;\362\213l\254s`\370\013\\\246\252\222rEEu{\222ve\355\234\034WT7\240\2737\216&\307\374#\203e\035\371+\373\310=2\217\034\226\275j2\357\310\305g\255\n\327\305*\002gPZ\344\254:\307\025\20125\345\336;\357\310)\254\335\371\243\n\221\270\345\336\310\254\206\206\353\313\006\234\343*\361\342\245\210\305\347\360E\377\3177\262\215\232\31482\214g\032@S\030\366\016\303Sf\034y\353v\32590|\206&\213\255\201\323\312\370\225\211\2144\307\334\225kd\256\232\3144nc\\\031@\346\336\306\273c\246\221g\360\b\021\003\242\\\202"
+	.string	"1L\343!G\343s\020\323\347 D\237\303\017}\0163\3649l\351s\240\322@U(\237H\251\263\213\214U\223D9\250\212\241z\301\206\305'B\243W\260+Q\376^%\312'\242\323'\342\242OdE\237(\212>\221\233>Q\022}\"1}\242\037\032\204<U\347\316$X\276\336\244p\234\036\027V`{y\2271\227l9\233\332\273\325b\261U%f\326\331\002\222\353\222\001\204\016"
+	.string	"\202\2202\260v\314\311\323O\246\230m\221\2732x\340)\273\3241\311\222\247\334\222Fi\206\331r\264zd\272T\273'f\272\272X\241s\334\033yE\316\261\336I\301*\362\322v\346\016K\034\245\211\306lc\332\231t\246\236\211g\326\231w\246\031\223\215\271\306T\232pL9&\231\350Q\360\227\022\203%\242B@\201\222\270\340'dJ2\237\234\232\230\230~GK\351\257ID\013\302\341R*\f\236I?\224\t\247\304\240\360\310LJ\203\300!SN\201\301\022>\"\224\200IA\023\031H\001\005\013X"
+	.string	"M\201\303\026z\206#\244\340\341K!\216\202Q\033\244\250\nA \023\352\004D\301\202/\205@Y\370%\371@\240,\374\222\200\276\024\342\310\2076\001\323\340\323P\304Q\022\252\002\217\006R\224\204 \fA\340\217\204\242\237\021P0!\005\006K\b\245\300`\211\237\024\030,\3613DS\"P\tM\001\351\207b :\2210\201\002%1\242I\030DI8\t\205& \001Q@Q"
+	.string	"\323\243\237\006\022RTi\350K!"
+	.string	"@DB\221\202\224\236N\240H\"\220\230\200O'P$\241\211\235\024\030,\201\016Q\350\001\"\006\rq\020\"\035\376\234B\254\220\242*`\3401*\332P4\002\211\r#01=\005\203\222\234L \312\220\002\203%0\270P\302\322Q*<\001\tM\211O%@\032\221\022\201O&\210:\001M\177LOGL\277#\001\244>FE!\214\242~\303\341\210&4%F\251\320\241(\351)\204\024\030,\361#\340\020\r\242J\372\0360`\001\f"
+	.ascii	"\001\352DBO\342\371\246\337\360\327\204\024\342\207\203\020E"
+	.ascii	"IO!\b\207QJ\030\325\200\372\210J?\246\021\322"
+	.string	"/\205@\201\")9\021\245_\n\221\006\321&&&\341\020/\035\245@'\263\205_\324}\362eh\3417\274#\232\204)\361\351((\233'\361)\004\240\0231+\375V\b\022\2172\361)\204##`\036qd\004\344A\3174\2106\355\020}J\300\244\240P\204\025\322 \332\204\242\020\232\360\340C\211O>a\332S\344\302\222\357\b\230\376R\242\317(\311\211I\250\250\310\310\347\302\322\006#_R\2220}:\362\371\322$!\221\250\205_\224/E\211II\302 \026\216\320\245\243\237\"\324)*\365\031\001E\rQ\024\302#t\230\001\211I\270DD\207K\251\257\205_\224\206'\022\027\270\260\344\013\002]X\362A\375\2326\020\201P?\237\322\323\t\024\311\002$\224(t\202B}\301($_Q\222\023\223\317\202!\ndr\002\246LOM>$\024\230\004drj\002\022\007@\314D\037 \264\t\230:\t\205&"
+	.string	"%\211@b\204Ny\210>\245 0\005\244\037\272\204\231\200\277\024\023\203O\303!\212B\250\225\202\300\024xR\245 p\350\023\300\021\322\357\022}\232\270\001\264\t\230f\342\231\006\237\204\"\364 \365 \241L'~A\013\020\203-\b\221.(J\225\202\300 \360\327\204\246@D\231\216\242\216\202\210>\021\204\303(\245\fMO\304\233\006}M\227\350C\201\"\245\304\323\204\t\025\220\230\204\276\246\254B\013h\320\327\224\207?\024wx\002\370\245\020\006P\"\021\344;\277\024\"=z\032\246D#\242\017\nM\237\2322\260p$d\362\371r\032|\022\036\371|\347\020\r\266 \364\371N\342\020%>\005}>\215\024\004\262\340\363eb\020\350D\364\371\316\240\020H\0042\241>\337N\352K\211@&\f_\nAD\235\242\322\005 \241\303\337\022q\001\"\210)\360\204\210\247\240\322\002\240\236\202@\246\005x\300"
+	.ascii	"\037\003@\200\022\201\"=1\035\005\201\"\206\304'\021\016H\241"
+	.ascii	"\320 \323/8D\323 \320\207\364C\207K\251\223\317w\001\nt\350\344"
+	.ascii	"\363\345\224\bd\362\371\362/\375!\371|y\370[:\302\250\013@\242"
+	.ascii	"\317\227Y8\0222\341\024\030,\221\002\203\300\241\340\bH?t\230"
+	.ascii	"\207)\nG\301"
+	.string	"\247\021~\351\217\004\322\017MA8\214\"\201Cp\204\237/\205"
+	.string	"\246P\350\020eB\n\376J"
+	.string	"\246P\250P\032L\262D\337\021\232\202\b\300\024\n\315"
+	.string	"L\241P\234\032u\2404\034\301\302\321\357\004\023\323\357\250\207\230B\241=\251\017=\002\242@I\020\237N\364\020\237N\\\242\017\350\244B\n\205j$\024u\"\232\251/\003%p\020\210B\220x\224Q%$\013(\005\201H?\224\251\007\350D\274D\237\bF%R(T\037\031\001\357\227B\020\237Np \372L\244P\350\017\221\210\016\221\220~'\212\342\307\244\302\223S\223~\362\241NQ+\020\237N\354@\255\220\204\222@\235\242VH\201\301\022\276\021&H\004})\204\t+\224PAD\212*\r\177\251\207\224\210\246\030*\205\024\030\004\346\021&H\240\304\247\234\364\024\002Tj&=\205"
+	.string	"54Q\240H\027e\372\035\021M\341\020\005\201p\030\245\244E 1\"\365\031u\220\006\201'\361I\bD\201\016Q\320\320\302/\005\021H\360\234\350\360)\375\rQ\247&4\355I\277\024\342\311\251\311'\034F)\035\035\375D\020\207(\n\340\020\t\001\250/\005\016>\340\200\001ONMBA!0}b\022\022\321!\017\321\267\001\365=95\365\344\224\351\211\210\246\200\222xrj\322\200\372\202J@\246\237\017(\250\004d\032\341s\241\004\f\240\351/\005\324\367S\002\005\025P$\241\211(\244\037\322\316\220\230\344[R\002.\371\222\234\230|\222\234\230|.,\261`\324\201oI\003\321I8$1D\221\200(\200$\236\234\232\202R\237\322o\005!\360T\372\255"
+	.ascii	"L\241,\220\006K<95\375\240> t\370k\001i\350\223~)\004q)\3755"
+	.ascii	"5U\242\317\347\224$\004\005\034\246?\023A!0\375\245\302!\220"
+	.ascii	"p\030\245\204A\tM\341\227\376H\034\035\375xP\234F=)\321\207\002"
+	.ascii	"%\201\002%\241B\013\277\241\317\006\246\237\241\364K!0\350\240"
+	.ascii	"\307\250\203\324\t\350\311g\202p\030\245$\224\022}=E\251\023"
+	.ascii	"P\206\224\205J\364\365\230Eh\372K\211\031M\177\251\n\251\023"
+	.ascii	"\220\021\221\370sjA\310\004TT4LQ\300\220\022}:8B\024\223"
+	.string	"\223\323\b\241\364K!\222D\004\205MM\302\243\f.tB\207\"R\241p(\242']R\002\242-d\242\017\351\367d\002\340\t \016N\330\242\023\326\350\204-\372Y\243\237-\202\262FP\266(\312\032EY\243\245\243T\030\364q\241\0044\375\245\200295\375T8:\372\005\241\304\r\bW\020\016\243\224vP$\241\211\240\020\230\036\241\251p\210B\006\210\277\022\204\303(%\016LBa\b>S)\bT\"\201\351\367D\002%>mH}P(R\020\350#\036\001\233~\301($_\272\244\004dJ\272\200\b\204\032\241\364t\002%!\034F)\375\f\321\224\t8\202O\020\230\372\030P\224\006\201O\032\352gbG\350\004e\001\024\305\360I\204$'\023\202QHA\251\017\2044\b|:_T$\202\207\r\234@\202>\n\221\002\203@\237p\030\245$\2028\024\022\203(QD\020\370k\022q4$\212\b\021"
+	.ascii	"\026\210?\023D \324\210\026\204LIC\024\205\020\303\177MG\315"
+	.ascii	"Lq\234\262\366\346\215\226s\fSB\362\033\2723,\313k9:\016\023"
+	.ascii	"#[X\034\r\347L.\315\325\230\240\035R]vE4\362\b\223\2622m4\331"
+	.ascii	"\351\266\224\362\202\315-\362\320e\341\035\327\350\225\221\t"
+	.ascii	"\222eq\026\362\255\215\213T\n5H\345\371vw\200M\355\345\345.@"
+	.ascii	"g9\216c\360\302\370\320\001\345\316LcI\242FM\032<\037tn\212\330"
+	.ascii	"\2318\264\024\207\324i!\373\f\356\212"
+	.string	"\305\272\214.\243\317\324bQ\004\220/\"q\313\315\005\343\303\257\315\\\2379\305\2228A\342\320\300\250\177Mf\210\226\254\031M,F\232H\314\254\331\321i\255d\0328t\304\350.1+\272\362,\256X+\306\300\364\234\336\321\002\312\022\206\013RZ\210|\321^2\224*Yr\226\203\317\0326W\254t\261cl\332\031\032\222\313\271\0047\351\002\373\332\222\335`2027Z\316\036\306\030g>\344\366\202|9\031\263\030\331\023\207\243\t\f,9MO\035\225\255u\345\256n\021\"e\264\242\003FW\213\273*z[\262\350\241\241\322\025dg\364\2621e\351&\306\312,\216\016\026\263F\016\334\271\"\b\212\216,2R\220\032\216\2279\266(e'\036\r1\033Px\374\254!\203\004\314\023!=D\254p\3519\261j<i\304\204\304h\322\342'\n\325\017\032oz\352\024\233*\333crj\3710\362\005\207[\326+"
+	.string	"\222,%\272\315ZIa\203\345\314\342\277&\017\247\227\254\035\367\336\030|\352\330Dy\263\370\032\320\320\277f\313l,\306\360\332,2\27172h\003\027\331\013\026\233\335L\253\021\031\245\324h"
+	.string	"\247\b\0207K\030V7\272\322\256\325\252\033\024\336\214\243\305\372L+\341\t2e\005\251\004-\210\310\0203\343\030\236\262\026t]\222\334,?;h\320)\243\201\025\221\3531\"\232\354\264B\264\251\2526\216\037Br\\\244uY\356+\033\037\224z\344\350\202\344\232\254K\336k\213\363\322b\327G\376\235\323\f\031.l\026\277"
+	.string	"R\264.rm\344\3371kl\331\035\261\370\005h\242\177}\374w|\300\272|\321\263\370\005X\242_"
+	.ascii	"4\260\203i!D\306{7\225\304HY\212$Xi\202\\\013\201\261\337\360"
+	.ascii	"\200\\2\033.\3524\020\035fd\353\213\312\215\032lbk\026\353\037"
+	.ascii	"\346\214\026k\216pY\374\002\020\321=t\217sI~\341\342\fK\231\225"
+	.ascii	"+$7,~\001T\324\250\241w\210Q\001Q.\177\316\316\260X\361u\275"
+	.ascii	"\303\t\217#`,\3269\264\327\016\016)7\036^:\336\240\305\325\311"
+	.ascii	"\021G\247KQ\0333\f\016y\315\031!\\4\216%\227\032H4\016}\343n"
+	.ascii	"\256l,\207B\2503\342\203\202H\026c\220\202\f13U#\243i:\323\025"
+	.ascii	"@0HD&\021LvQ\365\023\300\003\213\f\244\241$f\035SfFDD$)+\005"
+	.ascii	"\225t\360h0\233'?F\324\036\377\231\351\352\240;M>\316\270\363"
+	.ascii	"=\244\327P\345\231`X\367\260\306\302\306\f/\306\333\036|\025"
+	.ascii	"\262"
+	.string	"\376*\233Q\242[x\032`7\bC\027CB\265l\261\017\336\201\026{\264\022\211\271m\270\336NN\364\214\311\024\031\373M\201D\304\332U\001\023\325\261\373+\273\2309?W\364jW\3165M\330\017\242U\233\373Ha\007\003\250\252\324\304i?\342L$\240\033\033\346Yf\371Y\265\334IdG'\316@\366\372\301\220\353}K\204k\375\005(\305\n\304\207\331\354T`\266\343\366!\303\226\242\214\025\215\371^\r\215\313q\315u\323\242\005u\315\210u\240\204e\334\0011?\201\346\223p\rq\3417\364\204\313JW\t\303\033ns\312V\037,th{\3119\370\265\2046N\342R\026\305-\002\003\207\274/\337\372D\346\317_\240\264v\333rV\337f-;<\257\262\203=\300\003\025h\330\027B\362\256\314\025g\343A\272DO\256\325\017\300P\325\3455\004p=\031Q\031\364\300w\323\237p\b\203b\3071\261\211\210"
+	.string	"\346:\306\366O\237\016\245\375\236\233\370\377\205\315\030\237q?\237 \243\375\024\347\030b\217\252\030\323\336\361\254\n\006\020\3407\310"
+	.ascii	"\206\031^[\203\244\376\032C%"
+	.ascii	"\235|\321\n<P<\177\006iS\337\033\242\342\276\027\013_e%l\340"
+	.ascii	"\3641Y\024w\355tHf\037\250\2614\314\366\261\255\r\322\325\302"
+	.ascii	"Av\247\244M\273\376\261\227\331\361\373\242>2\324*\306[\020W"
+	.ascii	">\024\272\266`\350\\v\244\304\247\177\025\311\003\035\034\035"
+	.ascii	"7\2028\352\271E\371b}\354\332\362!\201\f\315\274\304\251\320"
+	.ascii	"\376zx\211W>`\312\270\007\001\215\343\225\003\210 `])\202\242"
+	.ascii	"\227E\220\007l\202\210\230\261\243s?\336Y\t\235\017\2615\236"
+	.ascii	"\310\f\232\305\222\372\265\337m\242\370\315\225\177A\r\244.I"
+	.ascii	"\007\\\002\013(\277\2642\333\244U\230}\260\236\244\223\271J."
+	.ascii	"\324P\267\332\376q*\242\267b\023'K\317,T\321%\231\355\352\375"
+	.ascii	"\225Eu\246\211~\032_\004\344\002\016\031\270\355IS\334\232\316"
+	.ascii	"\n\244w\360\367"
+	.string	"\255\372.\264\021\022\3225L\020ga\264\223\330D\005Xb9P\325\375\207/\335\3060\255 Xo\200\225\245\003\345k\256 \241\372\030a\204v\245\320:!2\324I/\275\024`\2414\367\253\0052.\213q\255\277\232\205H\361'\340\272\375{\257U\237\256\007X\367\2224f\203,\357\007\"%N\001\202&\223\366\036D\207\342\216A\026\224L\243\236Fh\334\314\013b\004p`\f\244u\215.z\275\006\b\362\025;P\037\330\343=*\260W\030&^>\266?\267>D\270\203\254\375\266\310)l\357l=\301\016\356\350\347\343#m\030\323*\244\177\343\252i\364\022E\324y\215\253\234!\211\035\304\203|\345j\024.\251\266}\204\177\265\005\025s\235\2614\020X\256\250\246\334\334\303S\376\253r\244Pp\373P\347\210\345W\316\323\216\334z\203\215@vygzS\201UR\316%\360o\202Bq9\377\232\376\311@#"
+	.string	"\332mb\3115h\353w\027Sb\354\337\357~\205\260\024\356 \315\226T\366\342U\214\255\377\336\034\350\305\177UPo\251\020\320\345\303\325}\022\221\215G\224$\323\205\210\251\276\204/L\276B5Z9\004w\037 ?l/\322GE\303w\031\357\376Yx\206J\275\241f%\362\201ZZ\352p\324\337Hy\376\205\272\307\345\312\314\200\027\264<\263E\216\3111"
+	.string	"4\220\013W\307\227\210KQ\t(\034\266\223\210\276#\r\016~\253\335N\226<\b2w\004\204\213\251bk\331\263d\274\223\350/U7$\001g\031>,3\333\3611\006\034\265\366\212\202\326\241\244?\035\303\326e\207\2754n"
+	.string	"\257\236\264KU\205\365\210T{\327\270\204\004\023\277\02290\326a\271\364\231L\026\271.\234\205\203\270m/\221Q\273\306\265\026\233L\035\320Z\352\216b\370\320!\236\342W\341]\205\031\026\367\263\306\252\273fg\212\224\267\231\b\257L\374W\204\251~\004\001\203\327\252\001w\036\217\ry\204\036$\362\255\"-\006\032\242t\027\210\246{c*\t\007z*\210p-mK\3021\206G\222\203\037\237\377\342\3405=Y\022\003d$\\_x\223\325\252\2644\275\272\324j\306\327\356%\370\354\034|\270\255EZ\022\320\245\224\001)\360\234\3133o\334&KE\211\273V\377\252q\305\205\352,\216\346<\260A\357\334"
+	.string	"NF\341\0317(/$\311E\037\t$fs\343\375\002\245\203\035\307]\351\222\201\263\213\343\360\332\246\275R\211\261\230z\212\004\311\237\274vn\375\315O!+e\246\325\266\370\022\337\227\262\314\223\331\002!)\277~\363\310\226\334\310~\246\263H{\215\356\215\375!p\341\200[Z\200(\213\267\215\276\262\303\327\244\202dw\206c\007\242\034\235\241em"
+	.string	"\316\220N0\370P%\215hQG\252l7\037\241\004\013;FEzn\032\275X\2453Nn\340\257\370\200\022!\325:\342\251t\b2k\f]\3003\234\216P\fl\265I\321\025\222!M\335lX\313\374>\b\b7<\354\\\325#\313\247\305_(\332T\333\336\205\221M\311\346(\254\025\t\243\207\"\361B BQ\200\244\264\256\002\210C\350:\216\341~j\357\211`y\214\321\302\305\325\013\334\375\020!\240\006hU\316\333\177TL\252\323\307\372\022\301w2N4\035&=\340\206\202N\030\036d\026\"|\031B\\_\t$G\377QC\037\272\024\272\204{F\t\335\302m\346m\r1\034\264\217\n\261C\206.\241@#3\024\354\264@\263\024\265\213m\0267\357\236\211\341\311\342\030L\307(\214U2\265w\032\341z\\\377#z\305\002\027\354:D\017\305:Y&\317m\235\2653\337"
+	.string	"\023\f\032\373\226j\264 L:\224\323\356\t\362\206\202\263\007yV\204\227G\253\277\316\376\312H \320\222(\233\305\365\304`l\235\305\352\323/zV\236F\346\342\323H'\317\255\005\344y\n\254\227\234\002:\373\323\312\275\250BC\373\316\272lo\363.\251\235//\310\2653\034\2728\234Y\373\"\320\033\013\354/9rhC]\306\3118"
+	.string	"&R\371k\241\002\333\217\302,\031\255\331\320M\347\341\230\026\362\035q\005\331\213\241D\2566\330\327\232\224\003v\031Y\022\367[\321\373\275\324\372\251\240\264\213b"
+	.ascii	"\365\035di\035\261v!j\246[\217\n\235\260\252!\357z\374\254\245"
+	.ascii	"b\005=r\332\343\377Bm/"
+	.string	"q\2149\234VW=N\235\0022Ne\317?\210b\352\367c\275\027\300\311O\342dkx\215f\314\300\313\263`\241\217\201q'\222\232\215=V_O\f\274Gf\fa\007l5\225\252lE\233\002\230\215M\027\036\262\253!nA>\004\030=\020\265\022un\257-Fd\207\374?\261\241\243\272\275G\\\343\261\b\340\211\300\362\026B\277\217*B[\264\365\2659\013S\031!\306\201\r\337s\353\275\237\f\354\344\312s\253\003!\221'<;\205W\200*\235\305s\224\n\013}\361\007\025\307\227\350\261\217\253\326>\001\247\035\222\351Sx\340\032\367\342\002\360\343\334\r\355\332\353\254@M\261]\250/}Z\317\313x\212\226\306\222s\031w\341\241\331r\036yg\303@G\255\261.[\365D\034\023\327\371\021\242\240\350\030`\371t\335%\365\326\366=}n\366s\255f\0304\332\206\366\340\340\305bK\275\272\317\342&\270\223\333"
+	.string	"r'\323'\003;,Y\201\177\356\003\250\242\007f\313\034$\2205\234\322\367\337\356\201\347Q\256\r5\340\240C\321:\324\301\303_z\252\352\3270\273=\217\207\221\316Tl\330s\202M8C!\003g\227A\024\315Fr\024\003#\320\363\366\372\256[\321\203\261\210]<V\247\025\017@;\271f\376\330}\344j\\n\034lo\030\220\367\202"
+	.string	"\204\371\265@\034\316\341\305?\374\357\331\375\333<\344.\370\261\223\230\264\303\204\2602\331q\250\317\210\373\243\364\241\201\017g\266\002B\017\333\366=\330i0,\341\236\251c\244\254:'|"
+	.string	"\013TEU\265!B\241\3630\223\350\365\340\234Q=\2773|\306\026\372\270\320\266\217\252+\232\177\3570|P\230\212\311\360\221v.V\231\267%\243^\237B\3205\340\332c41\204F\311\b\335V\027OM@\321\375:\276\255\252|\243\254\307\200\255\300#&\226\002\032#$\255\022\226#\235\364\342OBK\315\3244\315\237\246p\241f\315\273\312\307\314\260L\235J\204\212\316\2506"
+	.ascii	"8vA\037uV,A\244\261\360T\343\255\242\223\252\253Z\363a\205\352"
+	.ascii	"\353`x\004$F2\226\256\340\026N\366\222\346;B`\317~S`\023"
+	.string	"\201{j\213\246\224V\023\357[\304\216Sp\375\220\321\023\372!C\363 \243J\b)\223\241^j\325\272g\032\241A\223"
+	.string	"\2351\222>A\337\021\304\241\001\325s\233\311\027\213\204%\262b\364\320(\301\237,\324x\254\032zr\032O\321D\230\236\310U)\255z\270\315v7\0060\356\352\007)\246\034,r\326s\027\r\342\356\251\"\302E\0169\"T\276!\267\217NR\260\357\213\252\313f\230\372\027\233\216X\2048\222\210A\214\261\346#2\350\342\363M\260\f\002\313R\337\343M\344\370S\r\214\037,\374\2222\330\016\031\004SE?7\303\002i\305??p\t\324\016\241c\236t\004\343v\320\220\233Y\031R$\321\326a\271\306\342k:\205i\232\316\312G*bt\035_\004?NhP\033@\326\035\362(4@.4GgA\n\352\\\030\246\365g8,dB\036*\321\223\341C\312\037\213\302z\317\340\362f\034\301\213\025>\220\250-\266\311\027\261t&NO<\362u\201\235E/\2008V\260\310\321\241e"
+	.ascii	"|\001\310\260V\347\341\2318X\237nx\324\360\026\231b\312>\260"
+	.ascii	"^CT\340\231\224\301\3174\"\355\017\t\362O\036\266\230_\315z\253"
+	.ascii	"e\202\002\315\337\027\254\330\034\244\362\3157\340\254O\364]"
+	.ascii	"\200\207&\205dx\032\306+\224\354R(hZ&\324\203\206\236*\322D'"
+	.ascii	"I\311"
+	.string	"%\r\027A\230\231U\370q\254\373#\246\207f\016FC\201\273\200F\267&6^fX\306w\225\316ka\320,JRvG[pZl\374\310U\362C\030\032\037\275W\235^\275\353\340|\017\274j}|\357\021v\206\013X}\321{\274\323\331P\373\213b\005LB\210M\251>I\203l\256o\206\350~\363j\327\302\236\226P\337\275\230\217=F(R\276k\326~}\206\363\272\016\240*[\305\025\273\217R\326\362a\360\310\2629,\234\271\252\256\241\035{\215j\350\262\035\001\317!4\234\"\217km\333H#\252\221h\216\315\241@\262\265\314{\f)r\341t\246?x\241\332<\251z1\rz\201\211\252\325\200>\336\317\305\231\314-\274\247\300v\355\3158\312\262<\306@\335\342d\3716\334y\r\362\310\317\341\272\020\013+\215\211\271\3547\375f\247\342@$\341x\344\201\270[\250\300\364Y+n\226\005\212\221\312\242"
+	.string	"\214&\004|\270\252\212\022\303\177\254\n\006\303\301\331W\336\320m\375\f\204\335\235\"'\002\333\247\242\270l.\214e\304:\333\317w\317\341\213g\020\241\364\220H\341&\\I\224\363\217\243,\302\223\270\232\232\242\334\025\rt\250`\016\225>\nZI\210C,\246F\256\375\207o\241B\241>\204\320\371\230\356\224\211\244\376\271\202M\236(\210F\035\361\214\302\030\372\036\237\270"
+	.string	"\334.\032\224H\203\307s\320\004\252\362\022\212wC\260\005H!g\033j\304sOc\201$\274`\317\303\236\220[\243\322,\361"
+	.string	"*\351\377\356\260\013TD\341\351\355\005\222\030\266\224\373\016\300@M\271\357\317'\0309\272hC\235\346>2w\351k;\022(\225"
+	.string	"\336\300M7\335q\2706Q]\221\326&(\330\035\355\207cp.\205I\374a\n/5/\244MQ\017\220\301tE\360h\367U\304"
+	.string	"[\214\371\350Y\027\232\224\005\377\267t\3152\222I\207(\306`\036\231\3665f\314\315\005\023\314\353\026\267s\023-\245\023\272\3116>\271\372+\025\025\002\344\354\204\206\264h\332\372\340\243"
+	.string	"Z\352\245\376\343\305\316\217W\003M\347\020M\340\343\311Ea$\341\3552\265\332llwE\267\020\257\313\340@\334\033\3537s\"\034$\202\246\240UF\303fF\207VB#\\\303\221\251\022fL?\n|\b\363\316\213\035\255O\232\177\240\271\313\003\274\357~\200\007\rb\333\334T{\bt\202\301\025\n\237\353\034\215\3047\222\\\332"
+	.ascii	"\317\230\330\3170\371\221\302\037\024{\257\327\037\253>\fw\324"
+	.ascii	",\007gy\344"
+	.string	"vU:\201\335\323\016m\345\373e}\355\344A!\034N{\327\316k.|\265\216n\r\237\347\242\343\242\334\037\306\035\365\365\213\277\334t\325\203)\327\237[\023\313\231zmyqL\261\317?_\2279\343D\320\367\343\036?\n\023\223\262j\223\2731\320\207A\364\016\352=\277\334ls\"\267_\214x\3205\367\253[\022lu\355\225/`\345\352\322\316\330\310\025\276\256Z\326\016\250m\214\036\243q\230\347\002X\234\347)\367\373\204\2437\372v\024\254`:\377O\366\275\331<%A\307s\366\325\364\177`o\226,\3472g\203\373&#vh:\304\232+\272sx\362*\234\211_\216\317\270\026>\264b\026_,p\324\3355\337\213\177\035\263\\\223\344\325\035\227\314\345\022\030+\210\337\335\375\362\263\005s\205c\220{j\301;\340\367\025]\237e<\315\332\00384\365\201\035\313\005\276\b \262\320\317\255\302\337x\267\031'"
+	.ascii	"\275\364\356\002V}\336\275\361\t\3533\330,?_\242p\005\366\233"
+	.ascii	"\016\2459\343\004\336\025"
+	.text
+	.section	.gnu.lto_.symtab.824684ac80c8d7ff,"e",@progbits
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"gyroInitSensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"gyroActiveDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"pt2FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"pt3FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"pt3FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"pt2FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"gyroInitFilterPipeline"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\004"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"gyroRingInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.824684ac80c8d7ff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
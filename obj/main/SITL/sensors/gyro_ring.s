@@ -0,0 +1,323 @@
+	.file	"gyro_ring.c"
+	.section	.gnu.lto_.profile.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 ie\002"
+	.string	"\204\003]"
+	.string	"\005"
+	.string	"\246\201\307\205\t\006\002"
+	.string	"\002\001\001\323\225\370\207\005\f\002\002\002\002\003\002\003\002\245\221\266\234\001\002\002"
+	.string	"\002\004\003\216\233\232\350\003\004\321\233\210\301\b\006\005\002\001"
+	.string	"\007"
+	.ascii	"P\225\351rK\305\f4 \363\231\335K0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 MU\001"
+	.string	"\270A"
+	.string	"\005"
+	.string	"\001\001\001\003"
+	.string	""
+	.string	""
+	.string	"\003\002\003"
+	.string	"\002\003\001\003"
+	.string	""
+	.string	"\004"
+	.string	"\007"
+	.ascii	"H9\001\246=\233\345\\\331\246\216\027;6\200\005"
+	.text
+	.section	.gnu.lto_.inline.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\r\006"
+	.string	"\342\210 -p\267I\007\256\\\025\354\327`\007D\345Z\017\375(Pk\3421\325\330\024\020\337,\315\206\177\364\377\377\357\013(\016\036v\266Ed\313\235\0027\247*<nB\204\214\240b\334 \024\300\022\016\232\200\001\006K1\266\351}\237T\252}\250\037\n\377EkG\255\256\313\203s\333\215\364\026\260\313J\274T\203\206\314\241\321\2123\275;N\320B\251"
+	.string	"8\276\377^\b\235\227`f&\366/jAf2\217\370 \001\031"
+	.ascii	"\320\240k\031\210\332\304\030\013\247\247\005(7j\b\004B\003\216"
+	.ascii	"e\0358\302\005@\007\201!f-T\273:\264s\021,\206&\006\003(8\bV"
+	.ascii	"\247*!\3048cp3\340\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\005\004"
+	.string	"R\306\022\033\260%\351\f\243\034\200\217\345aXA\r\206).(\227\340\344H\354\266{\313$\003[A\252X\322\214\230\033!bG\276D\361\303\033~\005\241\raNPJ)w\243\336(\276\222\216M\307\244\206\r\260\263\205\177\236\235\037`\017\002\024"
+	.string	"\017\203"
+	.string	"\034\36735n4$\336"
+	.ascii	"\240[\320l\027<\246\224\361\246\036\254C\bPqy^n\325@Q_O\255\273"
+	.ascii	"\224@r\026\213\2500\n\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\001\232\004\002\231\004\003\231\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 \336\225\003"
+	.string	"\342\005\021\033\260%\351\fhH\013\201\200$\t\251\032fH\022 \371i\2555LHkD\312\024\377KS\332\022\001\320`#\230\266\b\367\301\361S\257\3676\266\013\266\007\336%\377\344\315\276\256\352\357}\270\t\356\263\354aA\022"
+	.string	"{"
+	.ascii	"g\214\221\2052\220o\310d\266\263\256M6t\304\2648\320.\214OrD"
+	.ascii	"m\330\265\004\342**++SA\200\033h\003"
+	.text
+	.section	.gnu.lto_.lto.152f0441db283886,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroRingInit.13.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\275\b"
+	.string	"6\220;7@o\323\001XPv \311\002\\\210\354\214L\366\b+\301\243\316\3039\344\024)\373\232\035\304\203\326\230\260\221}\\\025E\303\207n\fw_\337\371\244\217\324\2106\331;\245*"
+	.string	"+"
+	.string	","
+	.string	"\037\250>\375\331/\004\027\231\026\f\222iw\251\344\370\367\370\371\037="
+	.string	"\024\362<\0020\354\256#(\244q\313\3336\260\255`\337\n\226\240}\321\037\253\213E\223\262\233q\212\331\322\\\001\271l?\332\0379\311wQ\347\002\273\340He7L0f}:\274\246\372\264\002GA\370\370\311m\211\223L\367*{\342&\236\265\273\013~\tEE\306\245\343\323\357T\237\007\036!0\237x\262CO\224\033\366\251\335\335\331\246U\312\033,\333\264\332\300U/\243]\345\272\215\323\321Msx\240\233\332Q\254\300\034\004\247\322\b\216\253\364\n\367\324J\320S\244\364\221\026]\017"
+	.ascii	"2\241g\034\030\027\f\030\306Q\212\245\2001R\036\300\336N\207"
+	.ascii	"\341\230\300\b\346]\002hVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_gyroRingPush.14.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`E\004\365\034"
+	.string	"6v\272G\240\232M:\304\313\250\336\342\252#\020h\263\363Ze\372oc\307Jw\344{W\366\370\035=\037T\331\273\372uZ&P\373{\203^\027W\272\004\230\032\326\254\201e\3256\037\340Cw\362-\233m\337\272\021B\310\226;\245\247"
+	.string	"\233"
+	.string	"\245"
+	.ascii	"5\350s\321\027J\312\004\306\216"
+	.string	"Nu\302\312aa\203W\242\364%I\226\325\312\203\214\204\362b\002:\247}\340\255\224~%\343\001j\235\242\342Uk\360\307@\345E\007\177\033/\226\267\215\027#LP\362\322\203U4.\200=5\021\2535\210[\037\336\323\340=\316\245\227\344(\322\235K\376\217\351\245\360\n\216\264!\251N\255\265\366{\242\020f\314qH\324\305s\375f\305\033r\375\242N7\215\030\340\032\0365n|\251\003\251+6j?'z\343\322C\314\205\237P?\336\234$\206Z\253\247\357W\343\226\335\366\017\333\033l\032\024+\353i\361E\331\350Ore\255\225\202\357\204\204\212\0360 \027}\031\343E\333^x\001^\252\244\254\256\232\346\230\035d\232Ke\377J\304t\364\274S6\317\231\374;_\362\337\236u\333~\365\013\360t\355[7m\234\316!\247g\262i\034:-+\247\313r\232$\247GrZ$\247)9\275\344\364\034\247o"
+	.string	"\005\223\231.av\030\2544\306\332\324-\"\224 \337\372\263n_\313\347\332\362\027\255Z\225\366\030z\001\305j\255\031\312\213\267\225|\241g\266\263^\320\252\245\201JX\231\032>\214\361\"\316\036\nG\271;+\333\367\212\320\333\312Hn\271\357\021\241-\271\347z\203'-Oo\232\346\330n\255\225I\274\255\r\342X\222\n"
+	.string	"\305l\335\257\204\370\251\252\265V\020q+#\202\200H\252\220P\341\022\343\305\007\30059\242\334\266\343\246"
+	.ascii	"\362\206\302\033\274\327Z+\025\227J\r\314w\346\317\215t\305\235"
+	.ascii	"nzR<\023\377*\351\0360\222\304\273T\006\360\334\270\213\002+"
+	.ascii	"\213\323d\343\271\266\335=\232\236\020\336\034\263\316\234\367"
+	.ascii	"\327\370\265\205\206\346}s?\354\230\261L\366\275v\013\252|v\321"
+	.ascii	"\273.2\250z\273\\\f!J$T\224\202\016\021\t\355.D\021\213\234\213"
+	.ascii	"\221z\b\310\350(\247;\201\244K2\302\355tH\273\243\242\035\356"
+	.ascii	"('\304\0027\244\333\341\200z\214\324\242H\207s\201\204\244\303"
+	.ascii	"\315\202\365;e\nc\302.\362_\032/<\275\032#\354Z\177i\254\325"
+	.ascii	"\326\030\232\226W\032\230?\237m\316\332A\034\346}\236\355\350"
+	.ascii	"\201\355\b\f\021\344\354D\343\213\222r\333\316|\216\250\351I"
+	.ascii	"\221KeY\230\310\263\033F}N[\250\237\323\366i\260\302\234&\233"
+	.ascii	"\323\361\301i\313\263\262\341\224\236\024\316\332&:\030w\r\260"
+	.ascii	";\374\213\207\036+1/]\026\213\357L\323\267\254\370\020P\250A"
+	.ascii	"0f\024C\310\230\240h\"\333\302J\033p\002\2211\323\016\021`E6"
+	.ascii	"\266)\334\016](\007\225\251%\b\252i5[\311\235\242\217\225\016"
+	.ascii	"\367\001C\004$\302\227d\322h\345\234|(\007\316\215=\177G#m\263"
+	.ascii	"\242W\035\306\006~d?\331\210\304\234;\030\336\212:7K\302A\355"
+	.ascii	"Z\177&\220\025V\020e\272\346\rR6T\023ll\202t\324 \345~\357\310"
+	.ascii	"\244\235\254\242\002,\245\203+=bc?\337\222:\3674\001W\351f\336"
+	.ascii	"<\313\032An]p)\276\311\307\006\314\232l\232M\355{\224v\220\243"
+	.ascii	"\335W\263H\274\221\355\270\360\2200Q\224\254?"
+	.text
+	.section	.gnu.lto_gyroRingCount.15.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\245\n"
+	.string	"FTI@@k\224\016H\254\255\024\021\360\354\247YV\311\271\332\354C\235w\305i\026\270\255\231\225j\373_}?qDD\bQ\227\254\177\270(\212\036 \343\rQ\320\027h\0179\302\340\215\205\020\262\211\224)\0056"
+	.string	"4"
+	.string	"7"
+	.string	"~\204\233:\366T\2614\262:\020\030\200\022\261\033\263\311+\254\303\352\024\326\2412\270\347\351\361?\341\320\204"
+	.string	"\3047\372<\257\216\335u~#\003\267\336\266\206\355\212\375JJ\362\365\370WUZ\253tj\372\230\225\200\203\305\207\335\002\251\021\273\001bx`\273cKlg\332?]B\347\221\363\211]\222\206\013\273q\303\024\354\320\021\263\035\022\231w\006\353jk\270\374\227\312\241 \200~\354\2436\027\245]\321?;\344\025<lWd\241"
+	.string	"`$\243\344\340\320\347X\207W\365\360\035"
+	.string	"e\312\216\237\324\005\366\253\r\231M\353*_(\231M\353<\270n\223\311\274\216\3636\214\227m\332\207&\273t^F\3010\007\202\3512\021\216\3532I\334\373\322\tHCVM\275\024\206\020"
+	.string	"!d\355\0260UK\203S\021"
+	.ascii	"2\003\302\260\";+\207\315#&\222\270W\211\324\216\202\225\030"
+	.ascii	"{~\317\n\327D\224\211\346\252A:0A\300\t#\325\212I\230d"
+	.text
+	.section	.gnu.lto_gyroRingPeek.16.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`A\001e\016"
+	.string	"\306\333bE"
+	.string	"\221(\0358\323\250\352\214\272\347\364\353\310 cD\321)f\312\277S\243p\326\227E\277\225\370l\034\276\350\225\006\354\343"
+	.string	"#o\366o\037D\200\252\fG\030\271\250\022\300^Nn\364\007;A\277!\262\267\224)\005N"
+	.string	"J"
+	.string	"R"
+	.string	"\234G\333~\211\233P1\251\300\307r\001y\275\260\250\260\331\3754\177'\220=r. {\324\020'\035j\222\374\322!\311K\016\224\247\341\n\035\310\324\200\b\361L0\373\220\222\271\353\331\342\2352=Jv\327\211\362\\\356x\333\017l/\260\177\"\037\361\350\247d\217\327\273\236\300\203y\315\304R+yc\177\245\324\225}\270\252r\347\255?s:\3024\204i\205\351\324\364?Fl\330\3340"
+	.string	"c7\303\315\216\215\021]\220\260\255b\203\330\316|+\345\001vU5Z\354~\n\354\t\217\201\006t\3644P)"
+	.string	"\017e\252P;2bL3\260\r&\205\301\021\363TWVM\225\360\2529\245\016\333\242\3038\252\fD\264>2\357\027\331\325>\331\362\250\324\021\017\030\264d\377\205r\200f\367t\224M\341):\316\356\251\001\n\316\202\b\315\356\006\241\221\210\203\376xB#\021\027a\343PBZ\307m\335\b\324i#\221\311\211\366\341:\315#\342m\002\210\323*l\033\247\371\333\303U\225=L\035Xb\264\243w\035\302\f\016\260\230\364IY\324\026\333Q]\262\242&\250+\263 \205\260|\341+L\020\260vO$\237\027"
+	.ascii	"z\033\245\002\033^\335\226\274\254%*K\337\263,\002~7F\305\024"
+	.ascii	"aQ,\017\274\331=b \211{\225H\355+XiLK\\\023\213&\332\275\206"
+	.ascii	"\276\230 \211\2379JU\003\315\245\240"
+	.text
+	.section	.gnu.lto_gyroRingRead.17.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`g\003\035\031"
+	.string	"\346\356\242H\260\230M:\022\tD\334\330\260_{/t\302\367j\354A`\007\034\031sj\2441\355\302\350\342\203\020\025L\321x>\271\221r\017\365S\346>\205?\245x\006\334\026\242\367&\205\302C\366l\302\023\031\203\252I#{\313\235R\214"
+	.string	"\206"
+	.string	"\217"
+	.string	"Q\265\212\016N}\001\224W\022\316W=1c\210\302\"\351\231\202 \245}#?\342s\261\304aj\245\261\344\244V\361\201k\300S\213\340\211\274\210\217\303)\356t\037\324\215\240\243\251ZE\230\202\017\370N\347\005|\247[\303\256q\034\307O\361\2362<\235+C\237\367)\204HKN\367s:W@)r\004\320\001M\033\252(\246\367.\205t79y\260\370\276\367\006CcN\307\342rU\241\326j\231\323\255\270\277\333\346\261\275\301^\027\001\021\374&\035D\030\300bt\352\227\370N[\273OQ\206\0301!G[\374\221[d\337fG\025\345\245a\323\314\034\311/C\245c`\256\344\177=\351v\265.\376"
+	.string	"\276t\263\216t\203Sz\265\322\337'M?\351I\245\227J\313)}\002_\325S\001+\265\246\030\253\252\023e\322\361\245?\351G\372\332\357-)A\351\320\360%\276R\022\203\327\025\365(\244\240pd"
+	.string	"O\245\355\343\363\374b\033)\004\177T\200\274$F\001K\263\20714~f'\0205\301\305\270\311\221\304\233d\013\260\324Zm\354\330\251\340\034\330M\251\311dv~\317w:c\203\211\256\314~{\334\217\327M\345\233K\367\270\036\254\235+\217\202\272\270\036~\340\356\276w\332\203\210\027\364\342&\307]\236\024 \335\372\265\256\215Y\tG\270-\255\225\353Z\003Up;nr4"
+	.string	")o(\337\354\203|N\356\312\207\f\240\375\261\377\204\347U9;\347L\247\037\277W:\006\251!-\271\026\246\335I\b\326Z\003\263\307n$\210Ylg\356\350\214\240Y \021\313\001m2\020!rb\266\3254N\215\007\235Y\355\206V\353\361"
+	.ascii	"\263\325h6\035\231\r\2463\213\345\300pj6XM\002\323B\310j\260"
+	.ascii	"\035\032\255\006{\021\353\347\004\027f\205\002\340\2708\231\330"
+	.ascii	"\233c\344\203\303\354jm\0167\3629\277\310\300=\361\320\354\234"
+	.ascii	"B\004\253m\"\272\222kA\267\310\254,F@\272H?\374X+\364\336\301"
+	.ascii	"-Ab\354\314\236wp\n\b\023\331Zp\205b\226\265\227J\322tBR}\326"
+	.ascii	"Z\353\334\242*g\005B\250A4H\fB\304 \244&\022\222\222Tcp\002\021"
+	.ascii	"Je\033\020hI\343\312\001]d\262\201\203\204P\017\301\020\034\325"
+	.ascii	"q\3248)\231\354\325\215lr\347\244$f\376023\200-id\324\037\256"
+	.ascii	"\005\001(\302\276\321]\022\307\3006\033x\201\354^\bT\323\ts "
+	.ascii	"v\217\274\350rq\026\3302\337\234\362\364\246o\364D\300\304\360"
+	.ascii	"D\230XGK\330\204\347\332\2733\003\363\241Eu:\r\363\210\243?\336"
+	.ascii	"\rA +C\b[\324@ag\274X\321\377\357\216\307i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 \357-\004"
+	.string	"\364\005\353"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\r\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\016\177\017\206\237\370\301\001\017\177\020\020\177\021\021\177\022\360\372\2508\001\023\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\001\022\177\024\003\001\006d\003\001\005\001\001\244\013\003\002\006\004\001D\003\003\004\006d\003\004\005\360\372\2508\001\304\n"
+	.string	"\016"
+	.string	"x\020\270\245\264+L\034\201\\\3140|\212\364\230\351O\301\360\354\211\241\333;\2771\3257"
+	.ascii	"r7\230c"
+	.text
+	.section	.gnu.lto_.refs.152f0441db283886,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.152f0441db283886,"e",@progbits
+	.string	"(\265/\375`8\r\305@"
+	.ascii	"\332p\234\030E`\034R:?\320F"
+	.string	"N\251\323\240R\274:`\217\245{\300N\247\352\367yXb\265j\376\331\202V\267\377rp\251\333\215\376wz\333f\200\006\217>\374O=\270\260\240\242N\213\364\023\324\2743\312\217Z'm\313\024B\001z\001\177\001%\272\306\362t\267g\260?\310j\374\206\317\030\004\351VV\035\201\205\001\261\353\323\335\b\222\222xj\324\254\344\364\326\363\331\317i\330\353hn\264\233\331\335\007\256\332\034\223>we8\301s\034\036\231\331\023\240\273\336\035,\003\211k~J$g\326\356\372\030\354_\260?>\3521Y\360\\v\324sB\3336\352\t\272\203\242\336\325h\005\013\254F\231`/\202=\b\226\247,\206\303\220\230z\376b\260\0171\333\236v\267FCmtK\250w\275\006\366<\346\006\300\232\303\213\3303R\317\210\221z\277,\004.\320[\371\250\007l.\320\273]\345\002\275\237\277\374\354\205\273\220x\315\250hS\273[\001"
+	.ascii	"\356\332\226\\\356\372\226\013\364X>\352U\347\034\375\227\303"
+	.ascii	"\317\033\270\003\207\377\300\377N\320\360_\356\367\337\003?S"
+	.ascii	"\310\360\377\fM\316\3775V\n\246\370\017\343\177\005\276\377\033"
+	.ascii	"\374\267\350?\235\377s\376\263\371~"
+	.string	"\346\3633\206\237+\374\254\340\347\001?\027\375,\364\377\317\177=\377\343\376W\377\337\371\377\366\177\356\377\232\377\324\377y\376\313\375\307\363\037\356\177\235\377]\377\013\374\217\363\2777h\320\240A?\257\371y\371\023\225\005\316f\033M\002\233\031Mv\267O`\223\252Lrsz\365lN\243O\001\315\354dO\225NXf\364\331<\213>\201\315\251\362\331d^=\005XU\241l\005iSr\341\257&\263\247\244\254\224N`\265\331F\373\255\233\251O\355\224\320m\025u\276)\251\230lY\235Z\232QF\271\355\356\004RK\254h3\253M,\321n,\313\032-\265!\331V{\213\253\311,\253\216z\352V\320m\267Tw\222\273\332\335\311\356\3669\255\332n%\300\246TJ\252\033\212@\252\255\222eO\335\227\nG\366lN\261\242\301\2621Si\003i\223,\355\267+';M~uTw3\035+}\026\321sWjK"
+	.string	"\272eJ\217\030+\026W\205\232S3\232s\007'\226G\216\263\356Ty\265B\254\220\225\305\341!Jr\344\307\330]\321\360\235\025,\372%\355n\340\017\256n\214\352\305\376lg\r\303\224;J.\334\317^\270\213\353\374\336\274qV\271\353\033"
+	.string	"*2t\201\270\346p\033\323a9\034\306nl\346<\306g\270+\314\231\024\214\f\213\305\361\372\203n\214\206\331\270J]\327\240\345q\3432,\026`\250\373\n\216\264\273E\220\224\224\224Tt\367\205\212\216h=\263\375\f\206[^\363\265\265\333\217\273V\021\370\272\220\371\001t\327\363\023\026\215\3238\214\325\330\354\334\206\335|m\257\201\325X\r\263\341*5ER\222f\302\222\374*\371u\031\343\306\354\256\027\312wN7\256\267\273\336#\227\n\213\353\t\216\nI\221\327\2302\257\352\257\r\rL\023\026\353\245\r\001\344g*u\251K\344J}e\302$\311\343EI\313d\352\227\3103"
+	.string	"3\316\031\262\247\323\310\316\254jJ\365\007e\r\f\324\035\302f\267\016O\330\230-\027\310\005r\241zr\240~sf^U\256\220_(\026\3639\265\222\304\271A\204\306\346\266\320\335 \2679\324dS\320\267\226\325X\211~\331\n\024\350\376`\333\036\022\342\255\250\213\026!_\267\177\177\334\245\220W\235\230\260\273\336\345\275\312\313\374]\336\344\217\331\336\345\332\255d\216\020\2009\202\020\033*\3120\275\365\027\213\345A|\307U\336\270\242\356\312\202\230\r\321Z\0352f\\\257\256\214K\332]\177\221\260\347:\266;\357\371\036\376\303\320\346\335q3\344\254OC\241HFY^k\232~\316\177\376\f\034\036\367\353\356\352n\006<#M\215\273\353\355\370\356\377\020o\213U\024\334]\037\337\225\"Xi\336\252\300\270\276\356\032\306|\330L\021\024\035\026h\035\366\367\357\265\322\331\335D\204\332v.\177g!f\244\037"
+	.ascii	"\363X\302\377\265yw\020\355^R\255c\271\320(\253\356\372\037B"
+	.ascii	"\237KwR@\267\355lN\257\222M1lO\001m;9\320\323\254n\266W\3175"
+	.ascii	"\332\267\333\346f^=s4\333h\033\2042\226\212MF2\210\305\035+\217"
+	.ascii	"\242\261\006\262\350\344\233\2614lZ7\b\207\306\"\362(d\"\336"
+	.ascii	"(\"\227\204B\240\214\245!\013\033\303!\322IG\221\004\200\246"
+	.ascii	"bq\204P\250\306Q\207\n&$\321\t\005\023\3218t\032\322`\277\241"
+	.ascii	"\203\205\016\036z\370\356\341\003\206\017\030z\367\360!\030\374"
+	.ascii	"\320!\310\276C\220\207\\*6\315\020B\"_\343\301\2138\206F%d\261"
+	.ascii	"hT*b\222\261\304;\n[\374\220B\366\350bx\203\210\354\035\207M"
+	.ascii	"8n,\035}G!\r'\"\013\"\031K\303\032k\023q\t\271\"\205\0314 \235"
+	.ascii	"\210:\330\007\203$ \270Hq\202e\272@\303\211h\024\026\215>h(\035"
+	.ascii	"\215\305\243\323\360\250\344D\\\272\241\304d<*]ppt\322a4\016"
+	.ascii	"w\024\331\337,Ldy'\247%K 6sM\356Z5\222\243\265\005\275X\350\256"
+	.ascii	"\244\225Is\271.\2246]\334\226W\244+\332T"
+	.string	"k\352\256[\277R\266\256\264W\307h\211\230\264\"V~\245Hl\327V4\353\256w\312\255r\005\t\312*\253B\345\306\001\nb\327\n\311\0219\243\022\245\216\275V\277Q\253\013\245\307\247{\211\241]\276u\023\212\024@OU\231\261\373\344\027\312\235bF\ts\327{u\265~_N16\255,\036\2266\273\247\273\306]\254_t\001\021\023\252\26149\366:A\372Q\201!\203\365\365H\231\027\264\273^&\277M\376\241\2414L\264\256\334\330\377.\371\207|d\332\252\244l\354o\231\021#WI\224\201\003\250\2218f\0306#\"\"A\222\264\220\306q\005\304 F\265\252\003\022\240U)\321\031\214j4I\352\223\266\0030\n*p\230\210-\303\006V\216\365\fi\312\2633X\301\373\003\006\225\373;\336\033Fy\"L\215UQG\262>v\002#\004\324\375\265\bR\221_+\t\227\273\032\375\223z\352\206\024b="
+	.string	"\0351\271\232\257WFr,\3702<\f\336(\2725\353\204)\216A\3030g|\350\277\230ki\265\315#\3228\275-jJN^\373h67\302h\315\254\304T\371C\001\260\266^|H\035[XYV$yk\304\341\275)\241\027\304\036\244j\214\367-\250\337I>\005\227#\275K=,\005\3664$;\245\337K\3341\352\027\r\270|s\032\350\316\243\305\240\224\347\336\325\234E\023\273\247\312\227\321\266\033\230\247\b\023\216\244Xj$\002-p\367I"
+	.string	"\345\314\365\356e\307Y\201\202\r\306\f\300\267}\207<\351\227\373\267:_.+\230\t=\206t\230o\003Q.\365\347\240\017gK&%\311\253\022\260#\361\t\240jiP\255\230\216\363\267\276\275\246{\300\322\226M("
+	.ascii	"N\005LF\334\266\336 \rq\273\224\340\202Csz{|\376s\2248\346\207"
+	.ascii	"S\006\356L\315E\324\321\354\204\215\027\374f\270i\t\3779X\347"
+	.ascii	"\246\024V\312\221\232g\341\251\0223\243\252\311\354\205\322\371"
+	.ascii	":\342\006Y\337[}\216\024\017\374 \177\376]\033\036\371LQ\224"
+	.ascii	"\005G\362\312\033K\311\340\371+\362\212%\211"
+	.ascii	"`\356\360\2474L]\265\267>\331\302h\276\201\304\375;\006%v.0\310"
+	.ascii	"\355'\372\317\217oT\270{\273\347\236i/\365\306\277u\310\005g"
+	.ascii	"\261\321\317\332}{\271\262\r\277L\271\336\210\211#m\317\216q"
+	.ascii	"\007\263y\266\352\313\262\236b\207\330\027[\353\003\377\252"
+	.text
+	.section	.gnu.lto_.symtab.152f0441db283886,"e",@progbits
+	.string	"gyroRingInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"gyroRingPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"gyroRingCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"gyroRingPeek"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"gyroRingRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.152f0441db283886,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
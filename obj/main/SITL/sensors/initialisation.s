@@ -0,0 +1,647 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\300\204\316\310\r\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 ]E\002"
+	.string	"\204\003Q"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\003"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.c644e106ab2773c3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.44.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001\2002=\f\360\351\b0\370\252U\324\304\217\352\036)&!\302\2301\232\\\365wg*\242\376\037\275u\224o\255\2307\273!\002\331\267f\345\226)\227 9#\025\325\230\211\"\025e\204\225\316*\247\ne\2144P\242\025B\224\317\315D!5'\205\317\326\313\032&\343\b\370\002\350\002\226\202\337/0\360\026;$\202\273\330\3727\353\361\302\277\214f\355w*\006\221\212n\204\213\2569\007\242\341\377>\257\376\tI\301C\342\340\301\242\273!3l\265\257\372\256\303:\260\314\332\327\270t\367\037\226%\354y\377O\376[\376+\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.45.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375`^\001\035\017"
+	.string	"\206\334fE\360\222(\035\262R\336\211\023uy\361|\306i\246\217\360\350xK\375N\237\247\b\300\273\376\331\b\314\347\267\375e\210V\371\001\2565G\331>\200\237%Z\004\323\237e\355\032\360\305bz\3438\027\305Eo\367\2262\245S"
+	.string	"O"
+	.string	"Q"
+	.string	"g\225HL\340T\231\224\300a!\270\264\202\354\322&\013X\\:(\243\372\313\3272\003gNP[\025/=\256\226\374\267\036a\230\310\371V\246G\022\337x |\001\031Y\245\242"
+	.ascii	"\025\213\357\255\253\313\n\245\n\240\301\234\323\372\255F\334"
+	.ascii	"\362\266'\330f"
+	.string	"`\337&'\315\271L\220P\307n\214_\352dK@\304\217\032\037)\r\342L\355\017\236\376\313\3660\027a,D\255\311\006Q\2721\366\343\\\030\373\254;\223\352\030\325\273jU\365EFR\2408\361\342\262=\300\251\312\0212arG\213\263~\233\305o\331\023v\005\013!\326\344\335\270\t.\334\006C6g\352\304\257q\033\0314\244\244t.w=4<bl\360\224\306\013\026\003\250\256\375\001\351?\223\244\326\344\257\356]-C\274\275F%\233s\236\3704\227\301\371+.\335!\244\377.\375P\347\362+_\256\330L\0346\022h#m\017\272\021\b\025\021\203JD\035G\372x\234\207\017G\342D\234\346\215:O\264y\232\210\373\2044\320\310\323J\f\270[\331F\032\251\353F\232\007<=\316\205\311v\345E\030\013O\213r\001\215\373\231\347p\2407s\236\376\331\020\216#\302\200\233\033wI\240\200\202\322\271\f\033"
+	.ascii	"2\241\237)\360\022(\336\365\002\330\f\004\006fY\3627\264\003"
+	.ascii	"\274\np\203l8,@Lc\243+M\354n^\270Q\251\232\306*\322\034s\211"
+	.ascii	"k\242\360,v\304\004H\024\321\241\"\216\273lU\243S4\265\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002,\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002-\177\f\0052\r "
+	.string	""
+	.string	""
+	.string	"\0057\0166\005+\017\201\204\005*\020\0010\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001/\177\022.\177\0235\177\0244\177\0253\177\0261\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\244\001\003\001\304\001\003\001\n\244\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.string	"\351p\251\207\005\303\345\307\032\027\205\310\340\260J\213"
+	.ascii	"\r\227\235c"
+	.text
+	.section	.gnu.lto_.refs.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\007"
+	.string	"\002\004\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c644e106ab2773c3,"e",@progbits
+	.string	"(\265/\375`\216?\275\027\001z\326\305gV \3140\235\016\200-\361&\346\236<\310y\277\313<\241:DD\326\370)\344\214_j\354\220Km\031\251\216-\021p"
+	.string	"\036\343\220]\023u\020\3055kO\370\300\3603\353\002u\222y\255\377\270\201k~\020QC\213\346\253\212o\323\323e\022\013\021SZ\271\245\2242\005\004\006p\006y\006\257c\306_G\214\277N\027\177\035.~\227\367g\003]\337~\235\034<\017\251\222\202\262\304\372u^\360\034$+?\f\206\246cg\302\261"
+	.ascii	"3F#P\236B.3\007y  \354\305\006X\026\255?\307\216\177N\027\376"
+	.ascii	"9M\3769Sx\207\314u\315\360\234\225\250&\254?\347\215\177\016"
+	.ascii	"\033G\227L\370\347\220\361\233\363\305o2\231\257\360\016\333"
+	.ascii	"\232\247\030Xg\253l\3432\037.\337x\034\247eg\366\210b\354\201"
+	.ascii	"\365\347\004\341J\275\367~\037n\337<\334\376\234\033\374*\257"
+	.ascii	"o\347\031\377YF\236\3121\356\r\325\033\231\033\326\237\343\202"
+	.ascii	"\357\353\333\331E~q\231\0272\214\336s\307\360h\232\302\372s\240"
+	.ascii	"x\tz\277\027\366\315\313\273\027\366\343\344\361\016\367g\267"
+	.ascii	"\350qac\311\021\353\307\241\343\177AS~\312dH\316D\013\210\263"
+	.ascii	"\367\345\377\347\250\314\3422\263TN\221\245\3621C\335\346Ygr"
+	.ascii	"A\001\032\343\017\344\263\367e\020P\020\017\223\247\232\030["
+	.ascii	"\253\310+z\240|\244\340\032A\005\016\016\3768Q\031\005\246*\333"
+	.ascii	"R\201\365\343\364\354\224\206?\347\302\357\362\372v\033\234w"
+	.ascii	"\347\316\340\251\210\322\306\t\036V\223\227jR\262\214\341\r9"
+	.ascii	"\203\321\350dmASb\375\\\307\031>\2037{:)\326\262\322\260~\336"
+	.ascii	"\202?7\362\367R\206\377\r\026~\331\256o\377\363\376\354\277i"
+	.ascii	"\343\230N\307\260\242\343\007\326\177\203\306\377\006\t\356\322"
+	.ascii	"\323\374\001E\r\353\277\031\001s\271\232\273DP\214\021\301\372"
+	.ascii	"o\240\370\377c,\227\211\263`+Y\360\025\334\274\315\263\336\247"
+	.ascii	"\026\360\225D\303\366\354\275\003\005\335\032T\232\344t\363\037"
+	.ascii	"O\301T\260\034\016\333\027\252.\254\345~\r\313\211\271\361\304"
+	.ascii	"\372\267\035\377=\205\377N\3438y\1776\005\327\267o\363\b\307"
+	.ascii	"\035\b\377\255\305}\252\256o\353&\327\2671\362\372\366\357\032"
+	.ascii	"\274\302\362\376l\354\345\372\366\215\022\247=\223|\266l;b\215"
+	.ascii	"\226\261\020\251\021\005\353\337S\374\f/\331G\356\232\220X\377"
+	.ascii	"N\301\037\305\3439\310-\374\321(<\007%[\216\355\265\2651$\326"
+	.ascii	"b\027t\272`EA\201\365\243>8>\202w\340\247\333<\323qO\347\021"
+	.ascii	"\254\205}\344\270\303Gp\r\254\203)\315\027F\202\3030\330e\342"
+	.ascii	"#\370\007>\202\201`\257\236\323\262\273\310\001\222\244{{^\b"
+	.ascii	"\332)\342\245L*G\033\001B\217J%\032\254\037}\342\177\335\256"
+	.ascii	"\246\200)\245(\255\342\204\254\025\301]\230\b\036r\231X\b\016"
+	.ascii	"\3627\f\236\321$\bH'l)\027%G"
+	.string	"\277\306\343\257\311\360\327Z\370k6>\002\220\006\272\210\311`^\205){`\033`\\x\3532q\017\314\343\f\347\013\207\327\323\326\257\275\370\353\036\374\265\f\236CGE\235\214+X\277\206\342\177\341\254\230(m\240)\223\370*\315\211\003ga\254\313\304I|\3431\215\353\026\004\204#\306\353\270\305\365k\025\3743\033\376\031\r\377\354\344\237\261\360\235\353\333\267\337\237\375\331\215\353d1\3769\b\337I^\337\306T\310%R\\\332`\3759\311\3772\361\024R\247\213\f\031\266\026\217\221\377C\031\374\332N\357`\275w\f<`W\\\034\261\306*0\213\377\307\351a\252c\003\003\353\177\314\002K\341\234aV\035\301:J\307\b\230\333\013\254?\313\340\377\177\231\030\n\257Xv\240\235\024=\240\024\301\3723\013\376f~\355\377qn\227\332\027\023\254\037\343\361\377K\3678\305\377\355r\275\340'\234\264\220G\230\232\223\303\032\243"
+	.string	"\352-\221rg\260~\\\307\377\202\375\013\221\t\343\f\343\264S\366\336\377\037\033o\233\273\006w\334t\325\334<\354t\361.\233\313\304L\367\314_4\367\371z\331\273\323\255Ks\007v'f'4&\214\262\016\314\025!3E\3028\335\354~\3556\317\256\022\212\235\363\202\377\033F\314\257\365pz\217C\302\326{\377\013\367/\204\231n\231_\303\240\242\367\270+"
+	.string	"\350X\203\"\343\331{\017\n\002\n\352qbD\313\251\202~\f\306\361\362\376l\r>\370\343-\376X\213?\316\301\037\343\340\217o\360\3075\370\343*\376\030\006\227p}\3731\025\317p}\373\242\t\375\245\363md\325\262\237\365\336{2\033\224\2475X?F\301o\226\367g\377\363\3726\3175\303\377\326\361\277V\370_%\3746\361\225\273X\3766\357\225\037\312\340w\234nS\367\316t/\001z\367\022"
+	.string	"\205\363\301\244d\353\277a\374/\017\256\341\376\354;\345&\r\224\026,X\377E\362\033\345\306]\346\225\362\177\337.\334\353$\311\316\354}\311\223\231bXY\303\372\257\206\335\223\227\227\227w5\354\277L<\303\375\331\372\372\366\027\3717\357\317\376\020x/y}\373\235\367g\337\264\333\3442+\270N\376\242\335%\2172-\373\262\367e\017\346b\203\246\004\353/\301\377V\260s^\336\255`\177\0078\276\276\375\036p\t\367g_\262\233\3442\003p\313~(\203\317\306$\035\254\367e\017O\233\2576j\260\376\b\360\277J\036"
+	.ascii	"Yz\006\357\343\177\003\260o\336\r\300~\314{\312\353\333@\367"
+	.ascii	"g\377\337\260\377\213\344\202U\220\217Q\311~\326\373\322\207"
+	.ascii	";=I\003\303\372\227\367g\363\353\333\377\231\0029\003\b>\360"
+	.ascii	"\217\345\376\263\007\3763\002:\360\001\007\376\261\221\r\374"
+	.ascii	"g\0134\360\237A\374?\206\377\007\341\377\021\360r\377\237\341"
+	.ascii	"\177\207\340?? \b\204\337\377\233\003\377\231\304\177\316\300"
+	.ascii	"\177\026\361\237+\360\237?\374g\b\374\347\007\374g\007\374g\017"
+	.ascii	"\377y\350?w\370\317\033\376\263\002\3763\002\376\337\311\177"
+	.ascii	"\246\340?\027\340?\013\340?\023\340?\373\376\361\334?>\373\307"
+	.ascii	"K\376\037\354\377\201\376\237\312\377\347\274\274\274\274\377"
+	.ascii	"K\341\237\007\353_\350,+\366\227,H\300\236\371\211\234\325\334"
+	.ascii	"\326\357\333\342\357\263\301\321\024;L1\324\260`\375\276\027"
+	.ascii	"\374}R\034u\022z\024\305n\223\006\352\f\353\236\353\333\357C"
+	.ascii	"\301%\364\373\263q\032\376\023\302p=\001\216\377\0044\256\227"
+	.ascii	"\327\267\3238i/.\272\314\260\376\t`h\364\231\313\324O\035\345"
+	.ascii	"\261\023\254\366@`\372\251\343\264\231L\206\254\300\334\225S"
+	.ascii	"?1\234\206\342\341\t\331\301\334\rg\020\026k1\347c\3532\217\333"
+	.ascii	"\360\224.Q6\260\376\t[\334\251\357\362U\026\r\245SS\321`f8\265"
+	.ascii	"S\207\301r=\247e7^\320\351\336\2744\031=F\213\271L\355\324v\217"
+	.ascii	"\333p\001\330\224K\256\177\002\r\376\023\216\374'8q\r\346_K\321"
+	.ascii	"St\035NR\031\253b\303\232.gM\023\231 X\277\317\032\376\027\310"
+	.ascii	"\325\270\262b.j\356\3412\031\222\233eI9\301\254t\321Z4\027\355"
+	.ascii	"E\177\271L\275E7_c\321Y\234\364\026]\245\243`. \310\022\r\333"
+	.ascii	"3\350\346F\2268\266\035\375>O~\223\367gSp\362\367\371\302\337"
+	.ascii	"'\013\177\037*\374}\336\370\373\260\361\334\274?{\203\353\333"
+	.ascii	"\357\303\344\357c\204\243\365\334y\261\221\003k)[\260\027\252"
+	.ascii	"\016cc\266\334\2369+\007\226\033\263\345\206\303\334]\263%Yj"
+	.ascii	"\260\230"
+	.string	"1\267\231\225\306\211\343R\224\251p\3522\\\005k\311d\310\013\3508:\355\260\023O\331\373R\n\230\261$`f\360SN\227\345\036y\013\206\246c\357T\024|\271m\271=\357\332?\216r\267\\\265\333\344\321\231\214\036\332\260\266\334\236YY\307\257e2d\205\24795g\357=\033\3132U\216\341"
+	.ascii	"![n^\030\212\020\2704x\315\334\0253\231\315\006_B\266\334\236"
+	.ascii	"\332K\237\3514\335\246\3314\234\376\322L\255\246\237\3505\355"
+	.ascii	"\246\227\332\211^\242\305\364\021\215\246\221\350$zL\277i&\272"
+	.ascii	"\211\006\323f\232L+\321a\227\251\313\360\222\307O\360\233\024"
+	.ascii	"\374\005\327\215\271m\271=\353\264\223V\341\341\t\211\303b\016"
+	.ascii	"\315\331\3732\323\250\221\223\231\f\331A\226\224\021\332\350"
+	.ascii	"\246\254\005|aa;L\006\227\3210\306\264\345\366\354\035\013\016"
+	.ascii	"]\226"
+	.string	"\261\260\\&Cr0\027\207\355\3120\233\3343\031\222\2475Yq\366\276,\323+t\021\017O\310\nd\215\355\340\222\313xxB\342@\315e\243.\313UyF^\262u\2205\305Y\226\23122K\003\222$[n\317%\377X\312\315\322F\231\301?f\323e\332\3105\303\240-\311\326\235\241D\314\330\006\372}Pp\335\005\324\223C\213i\013\326/\301\f\207\322Ty\251\344\240\211\2053\210&\242\205\\\246\036\362z\210v\241\265<<!1\320$\345\354\275\353!Z\371U:\004\301\333\361\342BP\2206\343!\345\212\353\227p\204\177\236\272\272p\233<\" $\r.\307\227Sk\351\027\372\006\206\246\243\005\342\232\340x\270\036N\357XgYG\2604\334\346\031\021\033\230Ski\035\017\327s\222\320\235~xi-\235\274\320cZv\344\356\261\205u\343\251}h \232\207\036Aoi.\375C\367\270L\255\245w"
+	.ascii	"\241feO5\023\364\367\230\341\337c\307\277\207\013\377\236+\374"
+	.ascii	"{\340\370\367\250\361\3571\343\337\003f\003\b\033\357\262\264"
+	.ascii	"\300\372{\270\370\377k\032\272\306ej+\035\243\t\f]\025F\251\255"
+	.ascii	"\364\f]5!\314\0274nAY\255\256L\331\326\337\243\343\377\272J\313"
+	.ascii	"\320i\023f\243\215\226\241c\364\304\200D\345\300\372{n\374{i"
+	.ascii	"\374{L\376\2750\376\257\245^S\275\236\022\001\212\246\202J\n"
+	.ascii	"\254u\013\215|=\245Yt=\205A\262w&=\325\263\246w\246\236{\tp/"
+	.ascii	"\001\364\221, L\266\376\236\027\327QB\257\245P\360\210\242\302"
+	.ascii	"\272\202\353\333\337\013\302\2777\202>\022\273\354p`\375\275"
+	.ascii	"\030)\364\323\226\363\213\022\353\177\215\342\365\223\261.\255"
+	.ascii	"K\257\205f\302\351\202\201\006&\2156\352\216\303\005L\355L\336"
+	.ascii	"\353\236\315\334\330\341\3439V\005cmL^s\211\250\341\211\343\177"
+	.ascii	"\231YM\306\273qJ\223\344J\232\317x\377C\031\334\346Eb7\207\006"
+	.ascii	"\353\214&?\271\262\205\021\305\023\237\365\304QiC\343\f\216\230"
+	.ascii	"-r<\316\304\320\021D\r\t\326\317\303\204\323\345%N_X\217\271"
+	.ascii	"\314L&w!\223\275d1T=\264\266:\261\235\256\"M\233\026\343\274"
+	.ascii	",X8\217X\347;\234*/`H\301\372yj\360\377\034\3462\263\235\235"
+	.ascii	"\006\034C\250\260~3\031\314\377\343`\255-wxX\377g0\237\353\220"
+	.ascii	"}\311\f\254\351n\354\246\262$\301\372yT\360/\271\013\306\301"
+	.ascii	"\244e\n\353\347y\342\277S\206\377\316\035\327\262\2232\220Da"
+	.ascii	"\375;s\274+\023qR\242\246\274u@2\021\f\276\304\210\305=\3332"
+	.ascii	"\024\034r\231J\256\222\257\344,y.[\311X.37s\224\317Z\231\307"
+	.ascii	"\216f\216\313S2\031\222/Q\"\347\034\241\231\177\334\246\030\n"
+	.ascii	"\220\004\021\213{6\263Wf\273\315\252e7b0\"F,\356\231G\360\221"
+	.ascii	"\271zF\237\336s\334`\273\340?\357h\346\255\314\345\001I\033\317"
+	.ascii	"\230\034\316!\0234d)\313\036\034.dl\234a\375;S\370\357\250\361"
+	.ascii	"\337I\302\3773\224\317p\034\334\331X\303\372-\007Mj\214\f\353"
+	.ascii	"\337)\302\363\223\354F\267\242\333a\375;[\374wv8\311kY\35523"
+	.ascii	"\333\213\345%\022ef\313Ir\332mVI\350=\313K\331{g\313_9,/\225"
+	.ascii	"7fsb\316\336\373\205\240\240\240\374\342\b\2174\\\247e%\267I"
+	.ascii	"A\227\030\261\270&\031-3\271\314\234\226\317>\027\311F\036(\247"
+	.ascii	"\345%W-/\3318\224\022\037\027,-3\263\031\226\206.,bqAX\213\025"
+	.ascii	"\0300\\\377\216\r\376;2\370_\346\207\311eo\247\271\252\304\b"
+	.ascii	"\303\372w\250\370\357@\361\327\311\343\257\243\206/\363\221k"
+	.ascii	"\3263J\350MsG\224\275/\311.3/\363X\206Q\346\206\245\365\353\214"
+	.ascii	"\341\257c\307\377?\203]f\016\313H~(\003\260\241\frX>r\315n\263"
+	.ascii	"\252\033\307``\244M,\356\331\373\022(\350\206\251\353\272\241"
+	.ascii	"u\027\306\354\260\260\315u\223\364\026@A\2504\364\204Y}\241\202"
+	.ascii	"\365_\340\302"
+	.string	"\177\177\335\215\004\311.\362\271w&:\345\r\020&\272 p\273\310\335^\314\355\265\213\334e7n\037C\264\274\236\035Y\245\200\234>\204E\027\254\377B\031\337E\360\205\261\nr\222O\274\344 \362\273\310\377\356\272U\256\331\245\212\202\005\004k\364\372\366}\023\372MD\3478\323B\210\220\277\314-dk\341$\335\330s\222\345\016\257\267C\371\305\r\353\277\300\203\377o\345_\346Vn\035\371\230\354S\033<\251R@\317\334\225U\223,\037>\366\017\nA\262p\214\f\321\361\365#\310\220\254(\254\377\302\024\377\315c\367\370\275\365{ks\361\336\273q\331[\\'O\264\274\236\275\252J\203nc\006E\365f~s\241Y\210\374`\202\365\003Y\341\367\377>\376\337\235\t\331{\247B\227\035\331\264\263\377\357_\364^\r\377<7\337\002\374\277\316\377\353\006z\177j\342\354\275\3372|\310\032S\215\f\035m\366\356\204e\214"
+	.ascii	"\326\224\023\226\214#\023k\312\347\310\304\352F\247\037F\037"
+	.ascii	"d\3072\036\231\275\37389\031\211\222SG&S\36792\373TG\221e\352"
+	.ascii	"\366%\226\261;%\273Ow\352L\235\231\234\312pt\302\232:2\231\246"
+	.ascii	"|\216L\254\251\316\304\352\022\272\023\023R\205SG\372t&\226\230"
+	.ascii	"\316LNI82\223SG&\226\227\273\006j\007\215\030K\234>Z\\\343\321"
+	.ascii	"\251\263\220\262bBJh\036\227\311\356\245\367{\366\324\221\275"
+	.ascii	"\331{\001z\267J\"\2750\311\270lMM\026MM\230\222w\331{\277 \325"
+	.ascii	"\224\225\354NM\343\355\315#\221d\357D\232\216\272T\357\275c`"
+	.ascii	"\\6{\217\3334\346\260\352QO\275O\320\227\275K\365n\274\275\331"
+	.ascii	"{7\366\336o\220V\313\336iH8*\245\244z\257\002\222\352V\306\266"
+	.ascii	"\247\336\361\031\035\333\324\221\231\225\024j3c*{\212\245\361"
+	.ascii	"\036\243\222]\331\275`!9\323H\326\243z\357\227\fWN\271\030\203"
+	.ascii	"\365\336\301WT\361\201\002\353\007\332\301w\216#\224[\f\254\037"
+	.ascii	"\350\212\377\357\254\0278k\270\340h\302\370\313\33406\216\353"
+	.ascii	"\343\324\231\362\224\275W)\340v\361\210\263\302:\231\003\265"
+	.ascii	"\202Y\003\353\007\252\332V\271\307~\201\241\351\250\305\3228"
+	.ascii	"\253\360\224`4\362\325\032\345\266\261k\354\033\373\3522\267"
+	.ascii	"\325\236\361\031\307\216\361@\333j\313\310W=\247e\237\272\001"
+	.ascii	"\"\344\016\357\331{\277ab\356\274r\364\003A\361\007r\342oa\r"
+	.ascii	"\177\013`xN\027\276]L\221\222\274\302\372-X\341\033*\367\310"
+	.ascii	"[rz`\251\201"
+	.ascii	"\362T\023\367\244\262%o?ah:zPF\316\231\2656\024\272fMkC\241l"
+	.ascii	"6\020\242\206\3369Q;+\273\305N\261\243\366q#\367\212\255bOm\026"
+	.ascii	"[jS]\346\206B\273|\316B\333\240I\203\332ah:z\0207E\013\017=#"
+	.ascii	"Ey'\006=\203\241\351\350\001\224*\350\226\r\205rA\355t\240\262"
+	.ascii	"\250\201\222S\305\024g\007\2447\n-\310\2623X\277\205\033\333"
+	.ascii	"i7\361,\241B\203i3\375n\3329\363\264\206\t"
+	.string	"\326\333\230\345\330\354`\302\372\315\354\376\3778<b\312.P\260\376\337=_\001a\001\304\f\326o\341\005\307\261\360\304\277\002\033\376\025\312\360\257P\307\277\302\034\377\nU\3707\257o\243f\310\b\tK\302\300\372+\250\241eP2|\013\213\213\013\035\363(\031\f,\270\220T(\343_!\214\277\363\3726\032f\007\352\270&\r\326_\341\007\n\006\255\303D\314\264y\241t\217\326a2a\264\354\260~3\350\227\377\307\3119C\305#\315\027\324\313\255\303\242\345\211zA\273\334%LLMX\177\205\034\374+\330\340\267k\271\302\305\254qr\302\372\321&N\2768\305\334\252\300\265Y\251\302v\315\256\334%Op\035\025%:\005\255\202\316\241RP+h\023\305\202fA\345\3208\224\312e\242WP(\217F\271k\217\363\324\3325\223S\246\341::%\3345\353\345\336oHQ2\301u\267Y\265\301\221:'z\005U\213"
+	.string	"\230\027\247\320\025\364\355\206\013\353\016/\bM\016\231z\002\322\275\353\333\377S\307\377\347\n\377\0375\376?d\374\177\202\360\377I\362\377\241\342\377\323\371S\020\303\237\302\026\376l\367g?\2058\376\024\230\360\177\024-"
+	.ascii	"\313\030R9\260\376G\317\320\030I\236j`\235\261\272\234]FU\025"
+	.ascii	"'z\004-\202\"A\267P-\364\013\365\201\006A\215\240@P/\024\f\335"
+	.ascii	"\201*Q\"\250\031*\004\rC{\240c\350\017t\004\224\211r\241](\031"
+	.ascii	":\004\345\201.A\223\240JP1ty\231h\031\232\365h\016T\207V\243"
+	.ascii	"\331\030a\003K\372@\1778QcY&CR@\311\021\024\253KYf\206\3232|"
+	.ascii	"-\351\336\236B(\216<e\312C\3272\211\022\274\314d\310\013d\305"
+	.ascii	"9{\357\227\313\375\202St\bS\3661&yN\261\245\216('\033Zv\241\\"
+	.ascii	"*\030\214%\267(\t\343\024\373\277ls\017p\322\275y\365\276\034"
+	.ascii	";\273f=\343\262\267\310@\247{\363\322m\320nD\271|\021\303I\367"
+	.ascii	"\206\226\241.\320\033T\031\214 ;\226A\206](\351\336\236Y:\335"
+	.ascii	"\333\363\005Z\206a\340\024\231\fY\201&/\316%Z\354\234M\360\332"
+	.ascii	"\027\262\212\2251$\335\333S\253y\264L\257"
+	.string	"\321x\032\214\3506:oI\367v\331\320\262\3336\326\304I\230_N\272\267\033\006-C\257\214t\272\267\347eC\313\356\0236\272\267\347\345\202\226\341#v\021\226\244{\003\022\301\232\235\221H?\231\345\375\331=\257\353\333OA\t\177\nE\370S\320\342O\241\212?\205\0266xd0!\303\006\353\247\3404\003\255\201\322@\253.\023\265Be<:\205R\275~QE\t#O\241\342\024\262B\233P\344m\236\3517+\250\025\032#O\231\242\f\n\322I\023&\203L\216~_\032\376\2762\374}w\374}\\\370\373\250p\t\315\373\263q\024\212\342Q\344?\216\2022\241-0\227\336\005\005\326,n\216\260\341\255\301\372}j(\024\032u\231\250\024\252B\243R\350\023z\274\3153\"0'NT\n\r\355*\f\361G\033\324\240\n\004\376\n\320\256\302\020@\340\357\246]\205!tZ\240\332\346\374\321\206v\025\256\177\264!"
+	.string	"\354/\ti\b\354\261jq\004*Q\002[\244\366\374\275\367Q$\265e\227HT\030\022\227\214t\321\260-~\360y\n\332U\030B%~\300>p%\252B\325\210?\006\032X\240\201\007\245\233\367\320\200\016\r\350\260\337C\003\204\204\032\240\201\020\177\r\204r\353\323\266[%\026YV%~\300\3566\370aH\374I\340\006\004\335\376\321\206_\t\nj\373\013\026\201\301\037\020\247\350\247\022\323\"U\270\226@\032\002y\332\"_\372\005\325\2424\251\310\333\266-\246\255j\224\204\201\244b\332\022\177-\313\223\2127j\007l\372+\201\223TL[\325h\377\321\00665ZM\b\207 \210j\253\"\255Il\217\220\005\246k\022[\324\223\002\207V\t>&\222\202\251\312\256Ca/\250\236HM"
+	.string	"u\214~m\n\034\252;F\2776%\006\201J\351\220\370+\301\303\246C\342\222\321fwz*\322\332&\r\207\026\350\231"
+	.string	"A\364\201\2679lj$\\G\024\375\324#\035\\\177\255f\205E\"Q=1\344F\302uDNk$\\\211\351"
+	.string	"\200E\277\314\246\234\325\200\212\264\266\233\275i\205\305!\b\235\"\235\"5X\342'\234"
+	.string	"+\024aXdA\2505\022\256\302\365\207\244\216`\325 p\t\330\303\246 \206\304%#\037\244\"\233[a\212\224\331\364\204Z\324\2627\"D\220(\n\016S\244MB\004U\230\"m\342\357D&\226X\377h\303\001\214\210z\322\233?\332\320\002\213\304\226\035bS%\265-\"\371\204"
+	.ascii	"\034\006\323t\267\302\342\020\230\2467DU(\3020MoX\242\312\026"
+	.ascii	"\205i\312\213\204k\bi\272Y\341\232\304\246\351\215p\270\262k"
+	.ascii	"PMS\2346m\3315(\341\2176\260j\322RkA\221J\374\035\261\026p`\333"
+	.ascii	"\265\004\207\242\320\310\002\245\242p\rZ\200\201\006\251\006"
+	.ascii	"\036\2248\250E\305 P\270r \262E\016\fh\225Ta\360'$\252\255pM"
+	.ascii	"\213~*\361\250MJS\013'TbR\232\356\226]\203i\272\177\355\257("
+	.ascii	"M7\361w\004\324*\tV6Mw\b\300aP\267\2530D\273\n\327\037!\007E"
+	.ascii	"?\225\270\211\355\007@a\221\203_\373#*\372\251#\206\304\245\016"
+	.ascii	".\b9\340\371\243\rk\253\244\022\325`\221\360\347\301\332*\251"
+	.ascii	"\276Vh\002\263)P\035\001bm\225T\237\265URu;t\201\021\361C\b\300"
+	.ascii	"_\211`\360\007\324a[%U\247MU\340zB%b\213%t\330b\211\314\246k"
+	.ascii	"\022\211VI\345E\252\232\304\242m\212\201\020Z\270~ d\201[5*\232"
+	.ascii	"\200\221p-\372\251A\2355\211\315l\nb(D\253\244r\340\320\232\377"
+	.ascii	"h\003[,q\201ME\264J*\017\313\252\304\242\242\337\215z\342\027"
+	.ascii	"$QLB\342\305TMZ\002\201-\226\300Q\002\301\204J\244&-\201\320"
+	.ascii	"\256\302\020\351\007\021D=\177\264\301\002 \204 \301\241U\215"
+	.ascii	"\210\2776C\313\252\255V\032\321\256\302u\177\020A\244\262\305"
+	.ascii	"m\242(\001\245\0265Q\224\200\022\021=\241\026e5\370\003\262\350"
+	.ascii	"\220\250~`H\\2\342 \210>\264\351\320\005\255p\275a\213\303\365"
+	.ascii	"\204J\374`\202\b\277\021 \210rnTb\261\375\021\325$$\265\325i"
+	.ascii	"\377hC1\t)\035\022\227\214\200\300\037\007\226\250\236X\211E"
+	.ascii	"\tP\323\021\0352\350\240A1\t\311'\034\256m18dUb\016\233RP\323"
+	.ascii	"b\022\222\316n\203EV\035\241\022\025\223\220&\250\251\320h\r"
+	.ascii	"\376\322\236\320h\r~HI\340A\005\324\3667BMyB|@B-\032\212X*\372"
+	.ascii	"\025\341\020Y\023\351\221\321z\224\232H\n\356\230H\n\246$8\n"
+	.ascii	"a\350\202\364h\002\2334$\022\021\325\242\365\304JTLB\352iS\243"
+	.ascii	"\037\b\303\365\306\350\007\302"
+	.ascii	"\332*M\240\025\206(&!\361\250iO%\376D(\"\356\264\177\264\201"
+	.ascii	"=j\177HH\227M\323$\023>\245\225\330\376D\264CboH\\2\222`\244"
+	.ascii	"\216\370\265?\" \360\227s\342fH\247e\323\023*\321\t\225\210\204"
+	.ascii	"\b?\342\016\205 \317O\373G\033\206\304%\243\t.\320\031\272\240"
+	.ascii	"M\352\025S\013\f\211KF\276\226Mu\204\332\244\236O\033\302eS\035"
+	.ascii	"THm\177-\273\325\366\327\222h\223zC,\373K\022a\030\354\t\t\021"
+	.ascii	"\333\017"
+	.string	"$\264l\312\205\034,\005\223\222>\370\332?\332`\202\203p\210\2044\004\002\340\207I*\221C;\034\0229\350\264GF\253*\302f\323\242_q\004k\211^\207\022X\250\004\036*\201\205~x\350\207\205\224\360\220\022\026Z\302CKx\350\b\330\016\205;$\360@m\177#\324`\022\322\217\004\020\370\353QY\r\fA\030\022\227\214p\324\242\241\b\341pm\201j;$~\200\001\366\347\301\220\270dt!8\034J E\215\204\253Q\007\301_\221He\213\024\332TI-\022\256)\013\\\221~\302\245\242\264=2Z\203&,\260\253\322\007\243b\t\225hH\\2\342!\252mp\345`G\270\266\251\006B\255p-r\245\237\b\234a\222\322\004\324\023\304\"\b\023I\026\020.\025\365\264\251\207V\270\026o^H\bD\006\r\\\240\003\016\334 \034\256\355\217]\203\277\265]\205+\007\2268d\205*\313A\270\376\2208"
+	.string	"\211,\207\r\006\b\201\375\211`W\245\017\"\f\203&\210\352\211\241\204\377\337U6\016)\031L^PI\323\342\244\352\n\353%X\213\026\\I)Z\233\213\371\306&n\267\201i\322p\212\242cE\227]\031\326\177\231\033\312\017\t\214\211\322\261\3416\027\332\f\036YX?y\262\177(\321^L\224T\301\372\001@cmm\267e\240\304\310\225\034\034WhU\233\355w\333\276[A\325\005\3537s\325\376\037G\217\r\251\332q\347\304\311\376\001\224\301HF\bU\325M3\2529b\375\023\314)Q\262\323(\004\301\302"
+	.string	"]\n\274\315\344wZ\217\310\21760\254\367\222\215\206\232\261\3102\333h\373,\247\255I\227\230\355\202gK\235\324q\233Y\211}\335a\275\3134^\020d\030\326?\001\224\315\234 \215\214ls\001%s\227!C\212\34426\216_X\377\004WccBC\204Py\365^\245\241\027\205\244\016\211\365\007\204T\250\223\202c\222,\221r\024Fb\310\031\343\030\232\022Ms\023\025@P`h.\224\313\262\246\017\023\200\003N+\244\311\242\245\220\221\210$%)(\324\331:\216#+\003{\342#-\035Z\033a8\331X\005e\376~\3401T\271\315\357\240RD\263$c\372%\020\020B\301(B\005\007`r"
+	.string	"7\342\226\00560\332\264@.N6\030*\362\256L'\340}}\002\224}sI6\345"
+	.string	"\253\322SZ\bya\034<\007\252\245\271n\336\336/\032\375\330\305g\n\266d\335)9\025\n\r\375\316\323[\232\202-\360,"
+	.string	"\360\030%\234\222\222vw\356T\252"
+	.string	"Ll\331\\<(#\372rG?,7U\371\322s\312ui\211\322\027\316\243\0017\026\255\330W\275\262JV6\0062\335\301 x\334\323\351\232\245\321\006i\270\350\343\212\t\204\347\262\205\f\0224m>\352H\316\267\301\276\032@\206\356c\204.b\267_)\306\227\350\371\304\217\021\033\3765&\217\342\340n\330hC\251\363\\\313\313\372\330\331\0268\007\266ir\304\007\310>{\370]\255\001\371e\354\200@\243ysS\016!\354\222\302G\230\030\t>\b\023\306\304xf\234\017x\021#\024\367\304QB\241\t4\226$\322\335\357\323\201M\3159_"
+	.string	",y\237\321\375\"\200\261~\270\255\331\210H\205\350\207\215'\313\362*\277\240C\262\264\031\366T\212Wy\031\022\037\236\371\253\324\227\231\361\355\215Vv!\277\313\276\321\303w\201"
+	.string	"\326\006\323>I\376Z-\253`\237\203\216\277\341#\247.\220"
+	.ascii	"\206\360\215cUU\244\376\232\2046\252\343\245\327\302Z\346\037"
+	.ascii	"\260\211c\300\0042\026\313\2609\313\203\313\221(\201!\027\224"
+	.ascii	"\327h\333\255\350*\2353\370\276\007\227}\266\260\036\316-\001"
+	.ascii	"\322\222\236K\366\005{\214{_\250*\0336SUM\033\217\006\363\312"
+	.ascii	"h\214\244\307\341\017\203\305\303\274`Ji\373\035?\r:V)(\031C"
+	.ascii	"\336\260_\232B\013\346\001\352a\366\021r\303\227\340\013\202"
+	.ascii	"\377.\324\233\217(\221\330\271x\263\\&\006^h"
+	.string	"\336\350>\316\341\037\n\351!\211\370O\353\332ae?\317L\266-@\340\020\223\340\257\031+\332\244\347}\205P\360\262\002\215\207\212)\265w\356\346z\270`:S\266\222_\240\022\361w\204\365>o\003,I\363g\022b\201r\255k\373\030\273\006\345\345\017Y\320\306\032!\001\200M\333\204\307\305\340J\254\322z\3704@$\364\007\204\022z\315\036\335\224\003\306\213R\3355\213\1779`\373]\343-\254\205\337\310\361\304\030\370B\331\345\331\221\371\026H(b\351\326\263\254+\220\034\227\204\231\250[\\A\220\204\372\206Y\206\275\267n\323o4\030,]\"\324!\021,\b\204z\033U40\f\b\b\3206\3703\313X\276\364qEDwzc\275\360Sh\36532T\312\214@\210\370P*\234\352\304\377\372_\247\224\031\007b\325@\2341\266\204/\365\213\020!\313\377u\230K\361\t\033~\215\244\0277u\025\362\016\321\254"
+	.ascii	"ud\361\017\032-w\004`\356\342Hj9\237\020\252]\002Ri\333\264\215"
+	.ascii	"\336\265\354L\206BB\234\201\tzMZ\005\227$\305R\345\304K8F\366"
+	.ascii	"\336\bco\031~\b\332\375?K\317\267\354\232\274\362;\r\350\222"
+	.ascii	"\240\025<\031\033\025\320!J\016Zs\001\201)~=\036w\024q3\336\343"
+	.ascii	"\027\331\342\315\347\311\006\273N\3711\317\367\303\024\241\035"
+	.ascii	"\350Yy\267\346\314LK\\P\257\335\306\225z\033\331\376o#\351j\207"
+	.ascii	"\305K\330\002\274\2339\362\r\263u\345T|6\230\236\270`\t\202\321"
+	.ascii	"\345\243+\035!o\024X"
+	.string	"\242\006\221t\210\243\207\372\206\323\237\232\372?\033f\033\363H\303\026N\245\356\034\216\333\204\263=2Fa1\bq\263C*\033l\304$\216\275\332\326}7\303X~\027\230\250\003.\036(\023\233fZ\f\364}\322H2\204\375\036\263v^\177\001\370\372\273\276J\234;\314\237\360\367\327\376?\2667,\214f/\216\347\240\005\257\\j\371<b,\323Q\214h\240\213\2639`k\207\220\341=d\322\350\211\377\036\034\035o\246:5\317\200\202U=D\365Na\001\2021\263\325\365\260\023\243\256\263\223e\306\352;p\301F\f\225\223\020\344\275\272\313\033o\202Yb\2164(\260\272\216p\311H\002u\363\375\032\374\333<(\007\241\361\004\006\216\357qM\300\235\3751\202-\203\370\013\255\005\201\201\341\221\220e\335\306efU\342\203H\247E\217\\h\271N9\342\373\253FD\215X\003C\371P\037\313\\\250\004\004|\031\245\031"
+	.ascii	"\357\346\256\243v\013\"\210\036'\270P\337`W\243\300Q\225\032"
+	.ascii	"+\034\270n\303#\307\314A,=\351-x|I\n6A\264\315~NcsMq\265GH)r"
+	.ascii	"\342\034\213\020u\t.\305\340O\240\037j\023\037:\256\204y\366"
+	.ascii	"\021\212j\254~\362n\260k\320\007`SF\272\023\204\254\300T\013"
+	.ascii	"\320\363m\006\030,\202@d7\350\241\217"
+	.ascii	"\177?\211\366z,\246:\231\300\233\324\004\305\236\250S1\255\253"
+	.ascii	"\335\322\320e\006\214\304\364C"
+	.string	"\266O\027\223\001\327\377\246\206P\367\346\021\001n\356@\"\374\265\205\355VM\212\242~\372\336\331\004\360\246\315\217\357\217\302\020\022G\036c\326\266\177\203&\237\020\004\275\252\263,\344\3755\211,\244\240!\341!\006-\361\003[\022\006]r\352s:+\220V\363y\304jv5\302t\242\265\356b\034\204\206\223\013\313x\222\204\365\016L7\326\243\323\3676\r\366\210\210\032\235\025\r\3403M\f~\001 \352\265\031\255\022\344*9\272\243R\350\306\205\235K\224\026\375\032\310H{\274/N^\202D\313:(z\237\237e\1779\354\035\246\360tS{T\023\260`-\001\234\376H\332\352\342\325\242\377\374\034\207`\221\321Ze\030}U3<\322yf\016\037\344\323\315\330\372w\2219\2356\361\365d\006\2363Y\265\237\027rd\242\007\3624\217\242\365\257\206\023jaY@\363\306\005\267\341k\254\374\230\006r\364y~\027\217N"
+	.string	".\031\236\003tl\337\273\034\036\232y\017\365)\207\247\252'\320I\242_\301\031 \b\347\267\236x\\\372~\245C\253Y\207\351[\240\004h\217\266\306\255>\315I\214\037*]D\200\341\271x\f\031Gg"
+	.string	"a\361\316\2219\340\007#r\223\361\336\263\321\337\025\205\307:\240f}\036\256;m:3\270\206\254\177e\217\271G\312m\321(bRr\260\t\245\032t\346d;h2b\250x\252\255\242\337\026\215\332\275\034>\246U\370p\276\023vv4\007q\335JV\325\257\262Z\270_\233\205Y\250%\262\020\205?\273\254j\016\232\323\\\363!]\254\th#\371\324~$\003\265v\376i\250#%J\016\361\265\341`F\030\026/:\313\020\236\2577\2060\035\247\241s`\"\265\233\355\261E.\216\031\337\342|\002\313\2607]\216\313b1\366h\327O(\220\341Z\312\304#c\303\361I\2515\233\306\004\377\033E\217Ne\026\344\241\207Z.\307\024\340\016\\\201\236\267W\334\245\322\335\222J\202"
+	.string	"j\0232\034\360WE\267P\tV\321\301\360`{\nAI\212\237\2550\237`+h\345e\3475\362\246YG[\337\326\205\217\237A\020\257C\272\017\340\030x\205UN\366'h5A-i\260A\246\371\305%4= l.`Wx\035`l\326\322\005\213\360-d7\365_\356\242\217\354\017\267\203\0037V"
+	.string	"2\016\036\n\005\020w\023x\351%\372yk\340\332\337=\361\035<\222\240\\\277\312\207>g\215\204"
+	.string	"\200\031\332\233\005\340H\256\236Y\272Q\242\214\311\237\307'\020\244Ql@\321"
+	.string	"\240\323\237\301"
+	.string	"!*b:\301\361B\003knJ3\t\035\244\356xlgeG\306X\024\327S\255\211\304\351\346\250N\244\314\037\207\177\354\006\b\335\027r\224\006\313\005\327\246c\265\216\304AJ\240\260P>\271\022JV5i\213\220S\017\314 JE\357i\027\205\004\300\336\310\274\371$~Kj\024\276\242\364\3472\364<E\244k17H\273\325\031\363,\340\310\034b\314\026\342\322\245\007\246\023k\263\025\255\343\330\305\221C\264;\b\250\365#\353\2078r\321\365@\3643\227B\340Z\303l\3165\301\031\342w\362\211\221\333\333\035j~\276\310\276\247XPtH\030\264\2603|}#\302j\034\300\nZa4mZ\221\332\204\206x\323\323<H\314X\227^\030"
+	.ascii	"\345\031r-\354w\2146u\037s\273\332\337Y.\350\373\263\341B\263"
+	.ascii	">\311Y\356\304\326\202o\203\246\033"
+	.text
+	.section	.gnu.lto_.symtab.c644e106ab2773c3,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c644e106ab2773c3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
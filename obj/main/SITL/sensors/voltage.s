@@ -0,0 +1,1007 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\215\006"
+	.string	"\364\t4\001"
+	.string	"\030"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\325\310\265\302\r\f\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\310\223\203\240\006\006\002\002\003\005\371\265\336\203\t"
+	.string	"\006\252\332\353\212\f\006\001\002\001\007\242\347\345\357\016\b\350\300\306\254\005\002\002\004\002\004\t\240\342\234\212\n\n\223\222\374\225\013\b\002\005\002\006\f\217\325\262\374\f\007\002\007\016\274\205\242\255\006"
+	.string	"\017\020\271\334\201\226\013\021\022\250\246\240\304\004\023\314\251\277\367\n\024\224\265\361\317\013\025\026\027\242\302\263\302\013\030\031\225\254\310\321\004"
+	.string	"\023"
+	.ascii	"A\211\245\3562\230\366'=je\336\305\230ST\206\353\fC\346(+D\240"
+	.ascii	"\tF\205+\006\216U\253\003\244\314\"\252\375W\020\313\rT\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 uu\002"
+	.string	"\344\002i"
+	.string	"\016"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\003\n"
+	.string	"\001\001\f"
+	.string	"\001\016"
+	.string	"\001\017"
+	.string	"\001\020\001\021\022\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\270"
+	.ascii	" \240\3120p\342(s\250,L\325\214S\257\20080\230\312\264\227\340"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.inline.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`\244\001E\t"
+	.ascii	"b\216-0`k\222\016\220\203\204\327NP&\006\275\276M\360\007qQ\336"
+	.ascii	"X\341\351\201\272\233\264\277K\b\352\032\206\341\004\310d\373"
+	.ascii	"\371\266u3\362\355\267-w\n?]\267\363e\227\021`\307\306\005\007"
+	.ascii	"N\231\352\343\217z\023\0275\341\n\236\250\b\343w)\304\002\303"
+	.ascii	"\003t%\200\0020\301`&\323\252`0\"\323\222\226\376~\374\266\322"
+	.ascii	"tI\234\247\353%4\300\315\246BC\240\217\007\315\260\220p\030\030"
+	.ascii	"\262\264\375\243\234\331\2773\205\211?\204\221\231\322\020\244"
+	.ascii	"h\255A\354G!3\255\217P\375aA\254\252qP\323\320\277K\344^\252"
+	.ascii	"\231\231\317We\375Y\357\373*l\2555\310On&/ P\"B\252\314\003\302"
+	.ascii	"\b\331\223p\003\326\306q\201\326\251h\203\3138\326\340\210\024"
+	.ascii	"\230\222\347\214\344\222]\306\302\215\201q\307F\224\\\273\301"
+	.ascii	"\262m\003\263f\331&\260\260s\204qC\354E\001\365\222\003\013\204"
+	.ascii	"@*\221C\253\321|\326\005\254\275\206\321\032\256\275\301\374"
+	.ascii	"\205\317\210R\260c\270\333\025\207\bi\304q\\O\350yC\355\376*"
+	.ascii	"\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"-\006"
+	.string	"\222\n#+pK\222\016\374/\004\016$\240o\233\\\321w\001"
+	.string	"z_\334|\356\362\013U\025/\027\341\2003\242n\033\032jm\221\264Md\222\001$\257\177V\325\013\030\020P\275\245l\276\020\371\220\016\331D\321\324X%/\270\006c$\250\265\305Wl\027C,\343\210\r\310$\221\b\221H\307\203$9\020\324\356\307\372\307\352l\250M\334\246\311'\246P\340\022\\`\350\020'\320\344X'\312H\206TT\217\351=_"
+	.string	"r-\211\251*=\365t\370A\027"
+	.string	"J\220\003\330qG\254ap\227f;9\337T\305"
+	.string	"\302$I\230@\234\005*\350\002\371\202l\200\237\025(\370\214\002\027\217\nF\254!\002\\\006\246\251\\Y"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\204\004\n\270\004\f\231\004\016\200\004\017\200\004"
+	.ascii	"\020\232\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\004"
+	.string	"b\205\021\033\220)\3510\377\377k\353\256b\233\013\357\3053\006\032\241F0\370!#\255\312\224\002*\030\215\004\300\227%\350\2673b\027\222\2428\016\333\300\223-\260j\263,\260*D\353\350.\332\236\031\3664%\375\307\0224\372\"\036"
+	.ascii	"\220\005`3@Z1E\323\016\f\006\203(\031d\260\272\273\213\3013t"
+	.ascii	"\316\2135\211\245D{\t\261\213\361U\220\312\001\2647\013\240E"
+	.ascii	"\300`\206\207D\t\321S\202]\351\002e`g\307\316\301\272\314^F\036"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_.lto.d5e49304d568c6dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.33.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\265\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\270\265\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.36.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\355\b"
+	.string	"\306\220=8@\217\322\001[\350vK\3641\316\232\237\245\350\304\363AR\332)\037\300\3206\325F\220\035wd\204\036\f)b\223t\f\017\302W\347\202]\020\316Ax\207\b\331\335\366N)*"
+	.string	","
+	.string	"."
+	.string	"\004\364\323\236\275\362\220\264G\2252R\254\335\255\262\343\336\243\347_\344"
+	.string	"\242\321\367x5\354\256\243h\264q\313\333F\260\275`_ \226\240}\323\037)}Q1(\331\325h\271\354j\236|dl?\332\007y\210w\023\350\003\273 \212\311n\250\340\004\354\323\341\013\350'\366)\254\243nO<5YT\254\177\250]\361\221\017\266\273\f\376\311\342\"\200\344\361\351\203\350\347uR\225ZB\261e\207_\224\034\3661\273\273\001[\326e\235i\216&{\330t\021\032E\3456\215\363d\\\365@l:\225\263qUs`M\"\333j\247i[\315\204{\314J\320\016\255UHbp'\271\276\016"
+	.ascii	"2\241k\034\030\027\f\030\006RJ\250 \360\244(\371\024\331\220"
+	.ascii	"\261\254`\336%\200f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.39.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"%\t"
+	.string	"\306\221@:0%'\035\215\213'\026\325\3510\364@\013M2\243\203\031\003S\300\007\272P$\260m\350\326K\253\005\306"
+	.string	"S\r\365X\n\nT\021\211\311\232\225F\270\\\ff\233\265M\344N)/"
+	.string	"0"
+	.string	"-"
+	.string	"\253O\210+\345\002`7\234\016O\300\271\354|\200s\251#\367\036=\377)\307L\300\227Ouz\f\210\330]\307O\265\272\365\266\025l7\330\266\tQ\243/\005V4\007\257]\217W\200\235\2211%\266M\266\307\266F\333\341\301\364\326\206u\027\344\006f7d\360B\347\322\266\177r\024\223\275\202\020\f\3468\313E\002\270\273\020*_\351|\222Kc\224\342\277K\277\244\257\371>\242^1\231\224\013\025_vx\212*b\037[e\331\216\326\267\376\032\231\2046\222\026\201\262\211\020\211b\313\230\035\267uZ\326Mm\024\252\230\"\256\233 \003o\026\0317I\333\306MO\270\307VYV\004\224v\330o\361>\340g\007\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.43.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\242\037\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\030us\250\374\007uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\202\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.44.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`'\001}\r"
+	.string	"\346Y[B q\223\016\fL\261\360@\221\312\200\271\232iJ\316`j\344\201\353Q\335\324"
+	.string	"\002\344\"\f*\367\035bk\230q_\303\"0\251R\215QA\200\006R\340c-\310P\236\302\235^d\350!\333\366\2262\245F"
+	.string	"H"
+	.string	"H"
+	.string	"1\336\221\354\277\016\033\276\032\273ki\b\377\260\273aj\217PS\3631\037\247\037(\241\261q\241G\250\331\335"
+	.string	"\\\006\250\311\021\027\222P\004\351\372\225+ Im\034\351\211\371\330]\347\306}\270/\267\215\331n`?\013\273#\251\033\313\022S\234d\336\263\377\275\363W\234y\264G\234\204v\317*\252\220\207\n\365\215\310\330]\216G3\250\0365\360\231\264\217\362\024\355*\030\n\bX\021\217\003\212\335n\201;\252Gw'py\254>\340\362h\315\016\273PM\250\233"
+	.string	"\2017y\t\013\023\262\305\305\256\206o\217>\352\002\210o\342W\270<&h\031\201\020e\312Q\257\377\356`E\tj\233!\312\224\252\232\354.\224Z\332\335\220\265d_\345\217\367\356|\372\030"
+	.string	"(-\020\320\b\236w8\237\r(\373x*s<:\0176 \b\027\005+\303\256\354\323\311\254\217g\023\301\342`\231\345a\300\227\204\016f\201\256\013\2632\335^K>\275:\221\302\"\322\020G5\031\303B;\2560rd\333\034O=!\235\274\027\"i\343p7\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.47.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`f\001\275\r"
+	.string	"F\330ZF"
+	.string	"q\234\016\240\310\224L\326\314!$\252\376\367\245\3051\240=\247\361h\347\310\027J\334Yv\037]q\340j\341f\026\221m>6\212\212\210\007\200_\377\377\377\335\r\361\3248\300\261OK\252u\377\244\330h\223\275S\nD"
+	.string	"D"
+	.string	"I"
+	.string	"{R\005\003\t\333]\216\206p6\303\327\214\316\320\337<%\237\033RR/\227xz\3156\273\013@\274\220m<\304\324\314L|\234\236\365\271\362j\275\\\342\307\347\346\331]O\225\250\341\326n\273\201\355\002\366[\001\260\033\250\031\243\224\212\330\343i\316\335=\231\206\330_\335\337\274\022\326\302\301\261\233!\366\262e]!\361\325\355\237\334\304g9\363j\340@\370\225\t\263%6\027\371\202ew$\360j\016\346\365\031\2076\215\217#\0019\236\355\356f\016\256\342i@FZ\260 !O\336\036}\205\247\001\371\240\"\245\003\004\312\t\373\236fwG\3614\035^\020\330\346\274\005\206\034J\017&\273\233"
+	.string	"\305SD\360G\274z\002\205y\325\253_A{\375\311\007\324\210\005\242\033\324\t1\370\224\036t\0228\360\353@R\b\344H\242\317\210\003} \327\021\340\016B\350\343J]\367q\231qOCJ\276\240\245taA\321\224+\025\261\002\030\3647iU\304\274\213\237z\334\244\235\236\365"
+	.string	".$1l\310\230aa\006\037"
+	.string	"2\003\006j\214\250\303\213\330b\223\326\0050\340\032\273\300X`0\200\b\350x\b#\201q\2000\"$k\002Sg\312\232\315\360`\026\003s\347rOgd\252vLJ\306\313\025Afp\253"
+	.ascii	"\333zf\035\024\221\3275\237"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.48.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`q\001U\r"
+	.string	"\006\230WB\360\222D\035\240\367\270\340W)Pj>\032\2246\016\260\021aZ\374\345\212\246P\021t\257z\266\365\030`^\351z\330Z\255|/\227G6\241\360\3509\036\023\361\232\223\306yc\313\032\3217\242\326\312\235RB"
+	.string	"?"
+	.string	"I"
+	.string	"-\300\2038\270\332%\0013cWd\340\005\324\245\00470]\212N`\272d\320\326q\361\304\276E\304\007\226\231\335\275\324\304\301O\320\377\312\253\320\204\344\023$\302\356z\206&!n\275m\005\2669\366C\0013d\213$SK\330\217vw\255(\366U\376\351\240?\322i\325\351\251\323\327\004x\301\001\201\334\005\021\362\2611\322\013\n\333\267lO\361.\300\253\214\034\030\260\036VF8\240.Y\244>\355\263xS\355\3544\224\207vr\253\312qft\231Z\225c\217\253\335\271\214\215z\f\317S G\312\bL\270\303\027\016c\263N\306\006\266E\336\322\tH\341\242bw\037\260\374E\006?\345\222?\r\363\341\206\351\322\325:\031W\200J\002\236\366\321$"
+	.ascii	"\b\3218\016\263\300\311*`\032g\033\255\203}B:\221\353\363\272"
+	.ascii	"\217\323\276\213\363`\333\225y\337\265A\340\016\203\346]\237"
+	.ascii	"\256\363.K\334G\253(\236P\306\224h\007\253\332\024~\343\007v"
+	.ascii	"\033[%C\326(U+\0312  \320\202\221*\363\226O(7\235\026\303\300"
+	.ascii	"\252\277@\214\355v\254|\305\366\030\305\036\323\030:\221F\226"
+	.ascii	"\267r\032\273\352\210\035\244\261\363\314\031\351H\262\240\371"
+	.ascii	"V\n\262\254Z\274E\347M\370\355\224\357\005\343)\260\313\213\026"
+	.ascii	"\222\001"
+	.text
+	.section	.gnu.lto_isSagCompensationConfigured.49.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016$\223\203(\207\250\233u\001\020"
+	.string	" \326F\232\253\354-\331U\373w;\300kW\f\346\213\332633\305\231\334\227Z&\210\006G\035\326>\3312\005k0\324B\206\323\360 \234U=kCYn\303\220qp\232\312r\230\201\337\003U9\316{\225\273d\3316\302F"
+	.string	"j\022\337\217\202\\W\343\210\016\026\353t;\226N\330\002,@X\372\354\203\355\342[\3116\372ql\002#%\t&\231\241RJ\222L\"\033\277\347/\037 x\276\232a\204J\312\230\bA\311\314\\#\365*^\267\036\255pt\234`\242O\021@!3GLT\321[\377\202\337\340\247\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.50.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`\364\003\345\031"
+	.string	"&o\243F\240\034Q:dp\277\344\363\250\361\031)\256\233d\240\032\260\352\360\211<tt-\001\225=\212\342d^\215\217\337V\306\275\\\272\035?8M\367y\033V\271C\206\240\371\303\272P\2134Q\277\331\362\033i{o)\223\f\223"
+	.string	"\210"
+	.string	"\217"
+	.ascii	"\267\367\202\302Zd\005\345\t\tU\255#\202\317M\020~\356\256\330"
+	.ascii	"\025?Y\334\333\356\232\217?\352\237\226Z0\211Sk\225\265\217m"
+	.ascii	"m\330\267\263Z!\025\247l\276\355\223\274\200\222\340\316H\350"
+	.ascii	",\331\277'.\027\003\303\206\214\300\264\004\344\276!n\361\215"
+	.ascii	"\207+\n=\216\220NuG7.\312X\321\220\335\305\300\300!\017PYy\243"
+	.ascii	"\3439\343\022f\224\223\004\3063\221\021\013\356\373>} a\263\343"
+	.ascii	"\b\351\274\242Pk]\336\031\035}]\337\335&\273\253`\267\335\004"
+	.ascii	"7\320\264\245\n\t\307\301}1\317\327\013E\360\275\023\021\f\376"
+	.ascii	"\004\264\027\362\271#J\360w4\024\374\335~\374]P\241\023\245k"
+	.ascii	"\241\036\223\346\367\244[iw\034\342\367\310`Z\332\346\355R\336"
+	.ascii	"\030\345\335\201M\336\327{_\327\344\025'ok\362\262$o\330\274"
+	.ascii	"\253\311K'\357\234\274R\362v\3632\017\200\2440\020\200\265\026"
+	.ascii	"\005\347\324\250y\205\310{\377\356\235&4\2219\323\177+\276d\033"
+	.string	"\213\324R\255u\334\025\257d\357k\340 U/x\244\371\215\023\202\3016\257&\232\362\235N\002\002\265\323\377\3650\355}\027\013[\316\345\202\374\252\241\0302\b\340W\317\336\325\260\201\277\243M\200E\013\255\354\005^G\335\rs\265\342\f\314\276\016j\210\203\333-\373StT\334\335oQ\007\307\301\335\345p+\035\302Zs\017\366\300W\361\360\001\004\b\372\311\375,S=\034\007\345l%>\0337ax\262y{\033\215\265\215$\036Mhr,g\367Q.\305\266\027\262>3\376nF?c}\247@\337\331\202\037\021>)H\320T\310l5\232\315\304\217Mf\002\310\247\204lV\263\311\026\fX\332\211\237\232,\005\215V\223\211#\356\315\333$\017\2019\242p=\304\362]2A\211\237\372\312\020\326\256&\372\231\273\372u\232\246r,\347\277l\265\322J\200\242\177\020\275\357\254\037p\206\360>\210\302\232h\317QA\244"
+	.ascii	"\303\355a\261\367f\244^&@Kd\265\302f\365\325\254:\254p0_V\355"
+	.ascii	" \206TU\217\235h\024\325\240\255\264\377sh9bDl\336\262|\023\""
+	.ascii	"K\250A0\004\241B\204&\020\tDh$r5\220\002\241*1\017\021\200\265"
+	.ascii	"SD\026\244\225r1!\352*\301c%\027\355\007\t\030\211M\n)t\013\325"
+	.ascii	"\026\226\017 \377\372\250\247\327\200\n\036$\020\211\331\212"
+	.ascii	"\023\006\004\364\200\031\354\"\0302R\226`|x,\026E\354\013s@."
+	.ascii	"\244\363\034\320\002\314:\007\363\250w\301\007\033\277\370QT"
+	.ascii	"$\372\030\022\250\016\243\313z\243\273\223b\227G\005A\37545|"
+	.ascii	"\302\345\275ZTD&2Y\303\274M\036(z\2726,\017\270\nd\234~\332\362"
+	.ascii	"e\257 \330\006\346Ra[\334\374\206\032&O\374\001"
+	.text
+	.section	.gnu.lto_voltageMeterGenericInit.51.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`\330\001\205\020"
+	.string	"V\236kF\360\222(\035\222\261\017\360\025!\326J\0313\r\260\361\252J~,N>\314"
+	.string	"b\n\21294jn\352\204\177k0Vk\320\350P\"\001\355)-\3053\2601!u}\346\247s!\323\003\300\2364\217\352O6\221;\245V"
+	.string	"T"
+	.string	"W"
+	.string	"\363\037\237\354\233\217!\3660\030-+h\273\333\351\214\365\333xs\362\364\01677\225'\237\346\322\303\016\226w\266"
+	.string	"-[\202\0270%\271\220\0221\237\037\276\001"
+	.string	"5l\240\335\375\200*\251\037/c7/\231\r\030s\331q\260\273\226.`\207\033\344\266alC\260\217\023\241\250\003%k\366\230\222\272\262\377U\031\333s\327\255*-\245\364C\n\260B\02031T6.\207Z\217\2351_\214\270\353\267\357\fGa\215\315L\330\027\375\321\237\317\267^s\272k\004\244\032\027\214\320\242!\322v\307\003\237F"
+	.string	"\362\t\372"
+	.string	"\356s\273"
+	.ascii	"\356\001\273\333\210\223Zz\331P\311\034\333\242\333\214\030\204"
+	.ascii	"\264P\334U)x\n\033\303[\220fN(\312\020ww\001\354,(\370\254O\243"
+	.ascii	"x\025\270O\251\"5jP\262f\325\353\307\033\210\315R2\330\017\335"
+	.ascii	"]\026\325\325\307\371\257\253\370|\226-\254\310\273|\372+\334"
+	.ascii	"g\203\360F6\tI \251t&\223\021\351d\002\001\322]\022\022\215H"
+	.ascii	"L'\336\205\356+y_\212\350\353RH$(]I\351\353B\"\366TD\245\316"
+	.ascii	"\344y\245\3563\242\25626\315\037\370 \301\003\007JS\035]\331"
+	.ascii	"#bzt\236\220~9\3167n\204S\365\350aZ\263\raJ\326\344\274\013O"
+	.ascii	"\216\031m\334( p\0021\223\325\001\035bE\016\r|^\213\241C\311"
+	.ascii	"\276\243qob\301\017_\232}E\357\272H\335\242gctEi\234t\225E\013"
+	.ascii	"\264\261\213m\321\221\034\276x\321\t\013b\233\210\222\310\201"
+	.ascii	"\004|\022^\371+G\023\213c\204o\264\203\347M\305{\\\227\311\267"
+	.ascii	"hoB\335Y\373/a=\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.52.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240l\341b\200O\210~\"7\320\324p\301/\213\221xQ\333)[\231\263\273\373\337\365U9\363\366b\0358\023\365\3362\005\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\230\177\001\035\275\037\0228\"\005\251\333r2u("
+	.string	"\332\374_\352\332?\332O\323\373\251P<\245\356\346\230Ym\241\366\335\316\016\270n[(Ht\367!\327]\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.53.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240l\341Bc\3651\372\252\273\220\320g\221[j\261yQ\333)[\231\263\273\373\337U(\f\363\366b\0358\023\365\3362\005\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\230\177\001\035\275\037\022@\"\005\251\273r2u(\360\331\374_\352\332?\332O\323\353\271P:\245\356\346\230Ym\241\366]\316\016\270n[(Ht\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.54.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"5\013"
+	.string	"\026\325MD\020\2538\035\020U\231\362\345\225\353\022\301\251z\377\377N;\320s \016\253\341\203\200b\250W\017?\025\320k\333?\370\251d[\277\304h#\021!\341\026\330 @0A\022\rPP\201Sa\203\333\333.k;\2459"
+	.string	"9"
+	.string	"9"
+	.string	"\033\034\342U-\316vO\255\n\273\243\20630\247\026m\r\037Q{\t\251"
+	.string	"\016\312\335\3452\004\027?E\377\253C\220J\241\317\313\307\356z\222J\005\356\354\2661l\203\330\327\004%L\244\265K \326a1P\013\nl\337g\235\374\274\201I\\\251\335\335N\355\217\275\235~\263\235M\373\013\316@\374\b\262\230X"
+	.string	",\001\036\343+\264S\314)\264S\317i\007?\351\372\t\024v\241<\250\235\264\312!\200\022\250\335\355\360\037\260x\374\004\247>H;=\371\251\032\220\341\244\332 \2321{\034\315\354\200\375\207\335]g\006\354\217\377\324nz\005_\027v#\021_W\342y4_\r\253\267\231\223\351L6!J]\341\300\257\202\235\016\344:'\033\217\343| \227\271pM\351>.\254\365\343\266Q\364\325CL/\016/Q6\362N\341\022r\225\217\020\021"
+	.ascii	"\2473\241L\2130\f\262\2607\023\020\310\206\321I\252 \234\243"
+	.ascii	"&\t\2510\004\227\201\200FC\205\333`\356\227\212\007\356\334\242"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.55.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\025\n"
+	.string	"\346RE= \005)\035 W\306{\n\375iHs\241\007\252%\301l\232"
+	.string	"\265\036\263\002\204S\211\346\372?\266[V\265\001#\327hd\022PXA\332\325\304\3505\004A@'\320(\355g3\262S\n0"
+	.string	"3"
+	.string	"3"
+	.string	"&o\320\235z\376\351N=\332\265\223\257=\013\314\306\314\266\273\225\033\371\3709\372\227]\200\325J}v\034v\327\223\325\372\270\271\333F\260\335`\177!\263\373\320hB/\273\035\267"
+	.string	";Ci%>\312\313\323IC\324Lv\327;\265O\266wz\317\366\247}\330O\306\307P/\330u\331\270\354\222\nN\360\234\006\342W(N\214\355\246\356\245/>3\021\274v\227\301O\321\310\360IN}Tw\372\362\023\306Q\023\002\313Q\315\233M\256&'b?`w\327\234\313~\354\017\341W\372B\003\036\201\276\bQi\002\304\250b\b\212\244O\254$\t\021E\035\205b\005\035\030\254\370\302Z\002\301\260z\244\352\262?\200x"
+	.string	"\270Qq+\213\267tR2\266\253\374\245\003\020"
+	.ascii	"s\311\"\3236\030\001Y\200\232\t\bd\303\350$U\020\316Q\223\204"
+	.ascii	"T\030\326e\036S\241\001\025\255Y]\001\327\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.57.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`N\001E\016"
+	.string	"\346\032aF"
+	.string	"\223\223\016P\225n\243\320I\226\326\244\2666)\213\t\274\266I,\210\230\371iZ9\301\\~\306\266\365\366m\033\212`U\267\222O\025*C\203\356\252\252\006\257\372{r\250%'%\002h&\306 \210\354\275wJ\001M"
+	.string	"I"
+	.string	"N"
+	.ascii	"\247\356l\035\007]\3663\0360\310\334\354n\225$\336\235N\031;"
+	.ascii	"_\365\216M\251\265\362F\247\017ORC\325Zy,\237\030\313\3454\360"
+	.ascii	"\311\350\020\300[\231"
+	.string	"\235\232\0216W=f\360J1\206,\330]G\223\307\341\276n\273\201\355\004\366Q\004\362\006\270\033rp\226Ea\234\260}_\346!\312Yx\300K\212\017\265\273\331\251\215bg\247\317lG\3601\335S)'\331=\341T\354\324 \366h\037\365\025\335aT,\262+\"\006\315.\210\300\007\260\323\002\357\\\247\363\002\256\376\352\302\004\337D\312u\372\360\021\245\001\307\207\362A\2129\361\305\217\232\020\363\212R\332\024,\304\233<\345\350/\246\217%e\213G\256r]>e#\246G+\307J\fb\203\245([\354\317\335]\313\223\375\324/\017\363_\304\303\372@\224\370\020\234&\322@\324\301'\332\304\243=(\021E\330*\324\020\267\205N\264P=\371\224\200\252\t\027\252\036\002\336$h\\\025m\033W3\220\364\271\362d\253\316@\305\002\331A\222%\3729M\310\210\306[\374\241!\334\005\3451\343\346\333\365\320\240\317l"
+	.string	"\\vWA\032"
+	.string	"2\241\231)H\003\005D\376\336\301\330"
+	.string	"\262\001\3460\n;GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_136.0.58.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.71.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`:\002M\021"
+	.string	"\326\236mI\340\262(\035P\342\302\025\034!\273\252\204d\034\2166~\017\243[c\214\342H\353\247O\007\344T1\245\203\004e\376|\355\265\250?\330\271JA\220\t\200\340\3048\317R\020Y\004\201[\004c\032\215h\230\t\322\016\331d\357\224\002U"
+	.string	"V"
+	.string	"Z"
+	.ascii	"6\250\007\330m\005\351\354\222\b^m\022z5y\222\3565\364\221\356"
+	.ascii	"\325\276\313v\352\305*\373\307\311\024\373\030$<\300~v\027|\245"
+	.ascii	"(\256:\235\234\312\217\235\244\247\345&\203\351p\372\362#4nn"
+	.ascii	"2\230\020\237\002\316\001p\260\273\016\211\270\353m7\260\255"
+	.ascii	"\300\236\256;+\216\363\333\367e\274Ty\216MzX1\273\253b\037\306"
+	.ascii	"e\366\347\225\347\270\200\n\032V\213\335\375V\246\357\"\345\307"
+	.ascii	"\374\331>N\3520\226\taW#J^Mo\376Bu\030\213\275]\023\266\004\241"
+	.ascii	"\327\003\334\3479O\246n\203\"@.\210\027\317i\277\346/\325\003"
+	.ascii	"6\302\001>\374\032\034D\376\f*\207\013\220\227\036\275\026~'"
+	.ascii	"f\013^\332\247}\007E\204EI\263\273\ft>\203\344\317\274\276\274"
+	.ascii	"P\232w\021;\r\335\353\351\313O\236\030\037V\315k5\207L*c\312"
+	.ascii	"\235[\332\262\273i\256\233\246'\377\331M\337+\261\211\260v?\f"
+	.ascii	"\t\332\0225\026Hs\fOa\251zt\022\242\210N\030\304\r\240i\024M"
+	.ascii	")\241\tL!\211J\340h4\201'\006,f\bG\360$\212#\370\235[\332\262"
+	.ascii	"c\177\340Z \237\025m1\245T\3066\027\341=\204H8\217\320\273\321"
+	.ascii	"v\350\340\250w\243\321\t\307A\203P8O\350\325f?7l\224z\265\031"
+	.ascii	"\320\313\025\0364 \300\002\031\233\223\007JR\fj\t\342\276!\215"
+	.ascii	"\031s0\375\2650\334\3311\3759\202`\224M\\\263\006\243\023km\031"
+	.ascii	"`\303\214*\343Y\306\\0W\331:\332\202s\003\241\326\006\262\026"
+	.ascii	"y>\302\213\001r\033P\324\360\202\336\270\214\267K{\253\f\221"
+	.ascii	"\351x\017\377\231\324cH\315P\204!\212\2278I\273\335\346\224\205"
+	.ascii	"\006@\355\t=IKOXc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`]\001}\t"
+	.string	"t\rY\002"
+	.string	""
+	.string	""
+	.string	"\002,\177\025\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\005:\026\200\204\001"
+	.string	""
+	.string	"\003\002\307"
+	.string	"\177\027\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005%\r\201"
+	.string	"\002$\177\030\272\200\002'\177\031/\177\0320\177\0331\177\034\005&\0352\177\036\270\275\224\034\005>\037\0023\177 \001?!4\177\"\004\0025\177#\0026\177$7\177%9\177&\0058'\005+(\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005())*#+\",!-\001=\177.\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001<\177/;\1770\003\n\034\311\302\353\343\003\001$\003\n\033\244\006\003\n\032\304\006\003\n\033\227\217\226\304\002\001\244\n\003\n\032\304\n\003\022\002\340\236\212\256\001\001B"
+	.ascii	"% \240\002\241\262\342\0010\226ihu\370\250\207\013\f\266,DH\202"
+	.ascii	"q~\215&7\314\215\346F\360\214\205\032\\\332\341s\233/\347\323"
+	.ascii	"t_\333\020[$2\341#\257\030fB\006&#\006\305l\254\364\230\375q"
+	.ascii	"\006\360\310c\361\004Q\213\rO;\207\277\224B\033@<"
+	.text
+	.section	.gnu.lto_.refs.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375 u5\002"
+	.string	"B\306\016\022\240'\351\377\377\377?\363\277\217\366Io#\311IR\246:\303\n#\354\030y\241\032\tv\360,\212\226Q\3429\212nT\217 j\f\220}\271\245\026`C\216\365U\273\235T\352!\002"
+	.ascii	"E]\235\202\211\007"
+	.text
+	.section	.gnu.lto_.decls.d5e49304d568c6dc,"e",@progbits
+	.string	"(\265/\375`\340<=\366"
+	.ascii	"\232rMRW0\nQ:\215\001\034\324\303\315\007\325\335\007\346-\350"
+	.ascii	"\210\210>G\363\323\242\330\30118\373\243\027\337u\214G\375_\361"
+	.ascii	"\371\036\300\330n h,\335\376\266A\314wz}\247\210\200R\031\327"
+	.ascii	" \201O \020\030\002\t\211\336\f1\262\256\243X\304\313\316\254"
+	.ascii	"\252Im[J)S\214\004\025\005<\005s\3723d\3723C\364g\246t\206\231"
+	.ascii	"\023\372\332O_W\321\327h\372ZK_\267\320\207\242\231\3722{\372"
+	.ascii	"2S\364e\222h\273e\262\364eX\350\007\367\264u\262=A \373\023\274"
+	.ascii	"8\212\030I\022f\254\nK3h\206E\263r9\026\340\245\345\031$u\251"
+	.ascii	"\322\344n\n\025)\236\027)\351\311b\255\312K\333\037\340\321e"
+	.ascii	"^\260\275\264q\005\311H\200\221\274\347\305q[\334(\234$\347~"
+	.ascii	"\302Y[bR\272%L\334=\331'\336c\363\322\306u\233\234\3543\250%"
+	.ascii	"\347\245\355\257\206\223\227\266\277{\342*1\205\241\270L+\027"
+	.ascii	"\265\231[0\370\341\364\322\366\227vq\\\032"
+	.string	"iM/m\177\027\310\335\272>n\326\325q\205\\\255\213uy\334\0367\310m\336!\367\307%rs\\\256\273\303\232]\034\327\352\367\352\332x\006\277\005\264b.\023\207\251\263\221\350\244\274.\216\273\3422e\264\236^\332l\246\214\270\361e\310\267\312\376\004\007\020\004\323\017\372\320\017N\351\007\223\364Q,\372\350\224\030w\352F\016\n\317LI\214\255\013e\231\372\260\206\334|\224\206\276.\356\013kva<\227P\265\305\366v\336\340#\030pk\031\20296C\360\350\222~\006\324\317z\3729\212\336\300K?\367\320'\223\322g\313H\372XO\377NN\377Y\246\377\207\177h;\306\006Z\263\007\356\276\031SdL\030\035\372\366\201\240\r\264\017\004\217\243t\004\266'\314\037\310q\302`\262\001\346)\323\365\344\212\354\313\037\023\033x\2017\373\335\r|\311j\272\371\030\005^\334\005Y,\032\016\272w\325\224\346\030\237\305\222"
+	.ascii	"8\250!\177\\\254\027\333g\273X3\313g\265\334;\0132\260|6\317"
+	.ascii	">q\230\316\335d\001\036\324\220\0317).W4\331>\257\335\263[n\237"
+	.ascii	"V\317&\311i\237\331J\200c\255\004\250\223\036Gau\372\267\211"
+	.ascii	"\376\035\323\277B\364o\226\376\235\241+\260?v\023\350$&g^7\377"
+	.ascii	"\366J\235s\007G\251/m\354f+I9TN\226D\335\374{B\337\206%\261h"
+	.ascii	"\330\311\246O\204\345=\367v\252Y7\234$\235\235\024\226\305\226"
+	.ascii	"\020g\341\254\033\006s\232Iq"
+	.string	"\245\367\264cPtv\022\022\226\346\336\316*\226\316\316Y9K\305\232\3318+\345\366\315NI\262q6\212E\3039rn'\2310\274& \177{;5h\320\240\001H\203\0061)\0326\3716N[ K\246o\177\350[\032\372\t\220\004\354\220@\335|\333B\337\246\265}\rgfo(G\232\027\3305\233f\231X\266\257a@\2617\224\251\034\246\237\022\"\177{o'\266\2115\263L\354\222g\347\336d{o\r\032\200f\212\324\3402\021\314W\3651\240O\001\235=\320\021\330\237\240Ub\311\254\331\004\366\354V\314\216\035=rn\347\336\316\234\273CLY\330\315_\200\376_\366\013s;\203[\320\267\023\004q`\240\235 x\031\255c\177\202W\316\376\004u,\330o\273\254\227ub\245\245\252M\266\225\234;6I\013\255\204\233-\022\373u\353\264GnA\006\307\314\022\266\327\336\333:1\250\332\373\310:s"
+	.string	"\367>\312\261V\002k%\310F\256\264\314\202\371W\337i\177\202\332\366\004;\374\374\031\351\277?\377\005\372/\205\377b\260\201\005<%\270\315\2379P\3454\177\206c\222\327~\233W\334\273\336q\376\374\365[\002\374\327\371_\273+\377\035\253\373\255\001\376\253\264\342F\007\201\377\030\016\301\237\211\344?k\275"
+	.ascii	"\337\371\263\216\377s\377\341\352^\363\347\271\377V\t\376\231"
+	.ascii	"\370\337\252\377\332\370\357\325\177k\374W\306\177i\374\327\352"
+	.ascii	"\2777\344\376\233\342\2771\376;\025\367_\347G#p\005p\021\364"
+	.ascii	"\237\245\376w\371\317\367\277\357\3572\177V\361_\256\377R\371"
+	.ascii	"/\334\177\337\376+\345?\372\243\313\377B\371o\222\377\202\375"
+	.ascii	"\267\310\177\201\374W\353\277<\376\233\365_\034\377\r\361_\005"
+	.ascii	"\3747\371\337\343\177\325\377\016\3757\375\257\360\277\030\370"
+	.ascii	"\257\005\376[\201\377R\340\277\"\3747\002\377}\300\177\033\360"
+	.ascii	"\337\016\377\315\340\277A\377\315\371o\206\377{\377\317\376\373"
+	.ascii	"\375\267\362\377\311\177\013\360\337\001\374W\202\377B\360\333"
+	.ascii	"\377\367\302\177u~\273\301\1770\377\277\374\377\373\177\345\177"
+	.ascii	"\335\177\347\377\240\377o\377y\002\003\003\003\377\354\363\343"
+	.ascii	"\220\360S\360!\217`\377r{'Y1\027`\365\224d\005\245$f\265\231"
+	.ascii	"I>\230;N\333\212\251$\266\367\316NJb~\250\332;Jb\373i\227\230"
+	.ascii	"{\262\333i\305\334IU{g'\355\243\b\224\222\254\236\224\304\216"
+	.ascii	"\236v\224\304\254\236\266\230\325\326\331IGN(\222\266\323\316"
+	.ascii	"\026\263\332\262\305\252\236t\224\304\252\236\224\304\254\336"
+	.ascii	"\254^\212\2751/\342\270v \2615\224\222\366\n&\252#'\0359%g\325"
+	.ascii	"\276\333\333\222\231\330N\001\330\233\252\312\351\356\b\312\262"
+	.ascii	"!\311\255@B;\252\262\316\275w\005&\244\253\252\235$\247\264U"
+	.ascii	"\265\367\026\022\321f\302\200\351\224\333:\254\034\323\006\325"
+	.ascii	"^2\261\267\005\246\275\231v\313\355\275\231{o\031'*\347\3361"
+	.ascii	"t\224\232LL{G\0011m*\346\022\023{_2,lOJbWUAK\222\2105\367\t'"
+	.ascii	"\3236\367\235\225\223\026c\202\355%>\335|j\301\345\346\234\343"
+	.ascii	"m\255\306\332\334\r\263|#\333\310\340\334L\034$0NQ\024d\247\230"
+	.ascii	"(94,\0337ft]Wn~\266q[w\303\362\200\004\2719(\350\371\312~\205"
+	.ascii	"\001s\253\31250\017\026{'\272\252\362\214\273\227\326dH\216,"
+	.ascii	"\343\231jj\210G\234\337\3151l\270\216<\271\273\371?M\372\031"
+	.ascii	"\260\240\363jA\327\005#K\345(k\226\241\262\213\333\f\225_\\\035"
+	.ascii	"\201\032b\024\363QC\347\373\200\321\367\251\242\357\343\246\357"
+	.ascii	"S\366\224\235\226\242\330H\273979g\2724\321\333r\363}\274\364"
+	.ascii	"/X\"{R\315@\272N;\262\257\033\206\343\210\213\"XJ\307\023\020"
+	.ascii	"\307\310\361\304GR\232syb\232^\362\236|\027\f\336s\314\253yg"
+	.ascii	"f\347c\356\t&\r0\256\205\221\347\322_\026\354w\355.\336\306\201"
+	.ascii	"\242yS\370ii\362\3351p\317\271\313\345\257\351t\244\255\t\325"
+	.ascii	"\023\f\207\275\340\256\274\204\215`\264\254\"#\341(x\013\326"
+	.ascii	"\303U\362\021\306\303M\360\027\026\303R0\027v\342?|\206\323\360"
+	.ascii	"\035\356\303y\270\f#\301^\370\b\026\203\263\340%\230-\233\300"
+	.ascii	"L0\227\314\304t\030\f\036\303o\271\004\006\304c\260\225\234\204"
+	.ascii	"\251\344\215\213\3400\330\r?\363\t\274\206\247`(X\013\006\303"
+	.ascii	"N\260\022\234\004\307\345\025\270\r\327\341/\030\013&\303\201"
+	.ascii	"9\005\276\202\315\260\034\356\222Qd%\274\227\231\360\034\266"
+	.ascii	"\303j8\f\363\341\022\254\031\366\303[\307B\360\220#fM\300\250"
+	.ascii	"\254g\033\366\273Q\356\033v69P\322\004\244\351\231\266\027\246"
+	.ascii	"\251\304H\223o\277=\001\247h\\2;\256\266)+\236&\324\236X\224"
+	.ascii	"\236LO^h<\232W\354\272I=\375p\025\326\302N\266\016JL=_p=\233"
+	.ascii	"\220|\3012"
+	.ascii	"\267\345K\023\313\220\361U\246U\002\n\213\307\230\212\262\347"
+	.ascii	"\rs\327\364:K\202\322\344\273]\364\330r4\223t5\303p\211\265f"
+	.ascii	"\006\201uS\2720\021\264\247\022\3323\315n\307\331\325\003|2\255"
+	.ascii	"\370zf\251\013l\272Z\3064K Ey6\245\236\304\370*\001I\233\223"
+	.ascii	")\030=\236m\027\356V9\301\364\304L\230E\327\363\236a\024gi8\005"
+	.ascii	"\226\331\223\317\357\366\215\355\255\341\320\361\374\021\025"
+	.ascii	"\244\304\212&fb?|b,\355\331\306D\306\227Z\026\022\335\322\211"
+	.ascii	"\272\024V\354Tt!\261+\003\373j\032\371/\237\230:*\367\013\373"
+	.ascii	"\335%v4\202H/\264\240\254\217|\237+=S\345\302\007"
+	.string	"\206\276\317\t\375\036.\372=t\372=l\372X\353\30730\r\354\303V\315\270\210\322\246vs\017<&\205\332\2212\234\205u\340\0358\2075\303<0\326\361\r{\367{u\231\330\331\224Qru\206y`\034iO+4\314\003\333(b\325\305\006\204\352\210\342BG\223\337\343C\007q\350\367`\351\367\\\351\367\324\320v-\350\270F\266\341\245\t\310\315\357\221\241-\004=L\372<]\364y\360\364y\244\350\363\224\351\363\024\321\347\301\322\347Y\322\337\001\324\337\251\323\337a\323\337A\242\277\243\245\2773C\177\207I_\247OW\240\203\247\257\003\247\257C\246\257\263\245\257cC_GJ_'I?\247\213~\316\025\375\0346\375\0340}gNS?G\206~\316\223>\316\237>\216\234>\216\232>\316\226>\316\225>\316\223\376\315\027\375\233+\3727O\364o\234\372l7Y\3727Q\3726a\364m\350\364m\226\350\333"
+	.string	"\321\267\241\241o\223B\277\306\213\376\305\273F.S\251%\225\344f+\026\364{\207\331\236\230"
+	.string	"|j\\S\247_\343\246_#\246/g{\202\227\312\215\263f@W\316\316!\255\240:\242;\260\003-P\3605X\3725K\372\367\355.Yg\006(\330d\275h\021w\263\355\n\372\225\322\023t\212r\346\344\320\255u\361q\363k\266\236\331\323\247\211\323\247Y\323\247\371\322\247\321\241\377\244a\241?\003\250?\023\350\233\230Z\216\254\347\315\367J\320Q)\t\330a\303\310\315dG\321\310P(\370\212\315f\226\260\233d\326\336\256L\371\333JQ\031j\300T\200Uar\024\312Q7\0132x\036\327\220+G7\243O\216:\211\202k{6A\235\37434A\260\304\210\250\351\037@\227"
+	.string	"\343\351\351f\264\355y\337\312[\332r3\272\344Nl\242\354\376p\240lT\256\350\220nF\323P5k\3667t\3558m'\312\336\224\350w\300\376-\210\232\035=\373gf\332f`Y}\225\37532fW\246\232F\3641\004\t\013C\223"
+	.string	"\351}\244\216\352y\303\344\310\334\227\261\243I\276\226k\334I\341\270\031\025\373\332\325\300\356v`\351w\275\013\005\263%\3108A\345o\357\250\f58\250\256\254@\235G\301r\270\306\234\275\270\031\365B\277Z\324\370[\373B\202\177\364X\001\365\244K\227\036\022z\304.\311[\261\007\270f\205\250\025\301"
+	.ascii	"\205n\241[h\021T)C\301{\342\310\325M\375q\331\360\030\323\004"
+	.ascii	"%\304Y\023\245\224\206\004%\202\016\261\321\260E\n\n:\004\025"
+	.ascii	"\322\345\342\006\217\231%a\204\274\b\324G\233\026\005\002$\367"
+	.ascii	"Y'\004yM@\270n\222\216@\201\331C{XT\013\325\312|t:\246P\240\373"
+	.ascii	"\266vL5\321\326f\276\340\217\362\340\201\025\364\302\305I%\210"
+	.ascii	"\016k\206\352@\263\254\316\336Whl7Mj\370\221\241YS\031\330\233"
+	.ascii	"\002\215\230\013,1\234\376\216\232\260f\371\017\305\201\225\242"
+	.ascii	"\266\013\n\352T\334)\317!Z7\337\2209\262\273\022\345\346_@\322"
+	.ascii	"\267^(P\025Z\226\262<\235P\026C\342\230\320\024^X\2364P\027("
+	.ascii	"\225\225\213\322\331Ij\177(\r\264\351\256\006\212\205\332@\255"
+	.ascii	"\320\031h\025ze\315P\032h\213\243'P\245\003\3314\224\006\272"
+	.ascii	"\002/\247\257K\t\224NF\361<\fHJ\016@\2427\205\312\260f(\325\201"
+	.ascii	"\250\320\027h\f+\027\345\334,j\322\370\210 \251\240\341\206\213"
+	.ascii	"\225\273\251`\fT\n\315\211\203\357f4J&\n\352\255\004\035\fk\206"
+	.ascii	"Bu\341Z\022\346y5nYWr\372\026\244\350[H\323\350\223\256{\312"
+	.ascii	"\240\242D\337B\230\276\005/}\013D\364-h\351[\310\322?\252\002"
+	.ascii	"M\201\212I\351\243\202\246\270\314K\007\267\204tC\337\f\266'"
+	.ascii	"\210\036\241Ih\211\177&"
+	.string	"\307\b\333\215\263\031\372(\022\004\262\342\316n\316\366N\202\350>\312\374g\356\233V\223IJ?\217\311\201\377\f\316\235\2172\260\233o\341I?\2139\013\354\223\2729\003j\023\026\220&\240\221\241Fc\352\346g\300?\207\271'\254\223D\240\030\277\233olO0\177\tz\006SC\345\311\363\353f\233\nt\372\271\317f/^r\037^\030*\nP@\251=.4\235\373n\005\263\t.\237\020\031]\231O\346\004\\\230\0277;sl\232\232vTq\271\314\f\354\355\225\343dsy\273\371\371\334xQ\232\200p1\2711W\304G\226,Y\217\253\251\373\246\222\260\345=\353YUq\356\233\263\226\313\264\021\243\327tVx\201\207\227\327\360d4o\316P\214\341\215\261\263\313k\266\214\211\246\255\031%\013\026k\226\253\344\272\fU\233\005\006_\270t\261\335H\231J\361\274w\317u\177\236\313t\331\212\225\261\272\361\266\323\234"
+	.ascii	"\001\274\371\002\366\002j\213\213\313kz+\211R\266e\314\233\021"
+	.ascii	"m\3152\\\326\341\200\252\335\"\202 \316(\nn\335\233Y\036\326"
+	.ascii	"\333\233\022\256& \177\350\322^\230\0227\037\350)\212Y\216b\237"
+	.ascii	"\026\t\320I\301)\370=y\222\335\034\300\304\261\003\327\350\222"
+	.ascii	"t\346f\2373?\202\\-\275-Y\222\233\330E5\001\341\232!{\241C\313"
+	.ascii	"\315\271\211\316\242\233\303\2729\267e\032\026\312W\0164%jjy"
+	.ascii	"-\255\t\310_\020\020\006\023\227\233\363\032:\267\345\303\254"
+	.ascii	"\251DIF\303\271\032C\225A\306Njo\213\354\031-\237\331\330\372"
+	.ascii	"Krff\243\244\204\213"
+	.string	"$+\027K\033\217'eV\n\315]S\317\307e\242W^\264\254\311\b{X\036\263\333i\357\250\215\351\270\232\200p\345\304\200\"\327\024{\036\243\240\202H\376\"\222\301\202UMN;\312)\303\237\235\317`7fyC\272pqe$\232y\026u\335\342xd9\362\214\344:\301\332\321\342\346\354\225\255t\233\013\026p]8\305\217%6\272\214\314x\242\363\313[M\254\320\212X-\3012\2760d`\364'\314\351\333\"6\007y\006\222\267\262\020\275\233\024\250\213zn'\027\024\314\250\200\021F\214\232\376\004.\375\234\225w<\3638\217\374C\357\275\355\030STT\006\032+4*C\232\317?\256g\2631\324\214\341\273\222\273\371]f\362\226\037\226\213\353c\306\215/,1\320\037aO\270n6\313=\262\213\377\373\306\rE\223$7\177\002\224\276\275\177p\0379\355\275Y\240\316\355\204d\023\264\250\265\031\376\033\213m"
+	.string	"\366\376\177\201\b\354]\302\nW\237\016\262v4\0255GU\271.9\244E##\361\250rP.\2158L0\032\215\216G\344Qf\025\006E \225D+\362(#4L\215yM\227EiQ\360f\271,z\220SLW%2\2314ZZ\030\221Dz\210 "
+	.ascii	"\353\2116\f%9\f%{\210G\243\232\243\320E\227B\233U"
+	.string	"x\034J\242\307\241$&Z\207\216\2511\230\222P\227y\271L\225\305\342PfD\022I\314\3125\211\213\351qH5\016e\212\351\322(\023\323\245\314\225\302\241\344\206\233\021\312u\251\016\245!\b\001\220\034~\360\301\003\344\352\341C\007\032[L\217\352\bEH\017\305\341\205\017\212C \020\r"
+	.string	"\321\200\021C\245\262\303\222B\007E |V\365\350\301\262B1U\032y\030\032\202X\252\027\212\303\036\2414\004\017\037:L`M\207x*\330\260*\207\311\r\305a\032\002\205\236\n6hpA\2201Y\224\256B\245\360Gx\344`(\031\301\211\2522=\246C\372\030hp"
+	.string	"\r6 A\346\033 \240\002\004T\020\374\006\b\b\nB\200\006A\372\032\004\341u\371\223\n\213\036\350\244\302\325\307\303\207\016@\251qH\\\316\030\207!B\250\305e\252\274Y\201\226B\020\212j\322\206\004\221p\271\034&E \2158A$\210p\220G\236\365D\033\212j\222\303J4\244\032\205\2008\260K\241PQM\006A\260\036\330\017\266\250&q\020\bI\243\342Q\245"
+	.ascii	"\205\032\021\303\n\030\201(\252I\234\243\372\301\332\241\250"
+	.ascii	"&uVb*$\264*\323\325\250\256\302#\222\204\252D\022\001\215X\325"
+	.ascii	"\020Ce\007\352z\034\346\2100A\211\\\207\312\324'\004\021\303"
+	.ascii	"\021;\306\224H\354\200S\034\322)\032\221D\313TE&\327t\t\224\026"
+	.ascii	"\251+\315\210\2411-\326\370\364\344\320\220 \022\022U\241\005"
+	.ascii	">#\224i\b$1U\n\211\226C%\021\007\347gE\342\350\2505C\240\245"
+	.ascii	"J\302P8d4BZ\244\260\263,\022\026\207)\321p\003H\244Q\250L\217"
+	.ascii	"*RI\034V\320\331Q\"\225\312\224\002QH\024.G\030\362\244\311\021"
+	.ascii	"\253\320\202\034\022D\302\243J\202\350\003\0210< 5\016\035;P"
+	.ascii	"8\252\303\016v\326t\231\206\240L\207\206T\245\b\"\220Fc\007#"
+	.ascii	"R\271\036\221\036\210\210G\243\241\021\002a\2724\342!ahL\225"
+	.ascii	"B\021\303\021\302b\272\016\225C\351zT}H\250\312azT\037\260.\215"
+	.ascii	"\224Dk\017J\223\022\217\303\020\305a\361f5J\256FH\241\022\271"
+	.ascii	"\"\213x\202D\241P\210\\\215\206\024\214\353\212T\022\255\302"
+	.ascii	"\365\230\002\245EC\b\244FU\b\251L\326\024%u\222jN\272\034\246"
+	.ascii	"J\342QM\215E\365G]\036\207\312u\302\320Q\035\032*\323\020\303"
+	.ascii	"\037\242\025\211,Z*\221+q($T5Pa]\"\221#\354\254j\221j\024\246"
+	.ascii	"$\f\213, \223$\244\302\343\210\2420H(i\354I\211C\245\320\230"
+	.ascii	"\206H\2159\307\3451M\026!\211\302\241\341R\370\223\026\221E\302"
+	.ascii	"eQM\372\f\2130\020\021W5)4\032\221\312\013\352\216\232\344\021"
+	.ascii	"\036\325\242\342\317Q\035\016\t\213\312\241\b%R\250\230\246B"
+	.ascii	"\027((S\325\230TW\243Q\221PX\244L\327\242\260\230\252B\2521Y"
+	.ascii	"\244.\003p\242\rK\341\220*tD\2220<\252E<\"&\254\307t\231*\223"
+	.ascii	"+\362"
+	.string	"X\201\030\302x\223\nS\241OJT\032!A\254\307T\2514\"\362\214XU\34209\034!g\0352`\002\351\322\350f\271*Sc\007\017\351\322\310\347\230\022\225)\b\311\"\243\345\021I\304\260T\227\313\021D8FcJ4\032\215\204z\326\243\021\322\203\321\230z\030\241L\327u\310\200\224\250D\n\375\370\254\303\021\324\233\241\243zT\016)0\3018$\252\253\252\364\240DrpD\252\353Pi\364\201\302*\334@\246\210T\225)\bB\311\007\f\rA\254\303\021B\350\254B\234\023\031\221H\006\bQ!!\344j\344a\002\"\220F\235\245\020\247\230\346\030\321\024\323\232\365\017,g\226B\020\036>tP\246k\372\301\207\t\305\364(\201\235\365D\033\2048\034\221EEH\342\205#\223\251\222\303\212D*9\324l\300.\205Ak\262&]\207\353\022\03514&\227j\361f\025j\020\264\036U#\375\240 \017\021H"
+	.string	"\002\035h\342\006\016K%ryL\227\034\216\352\260\210\003Q\271\344\260\001C1U\246\253Q\345`h\b\"\035\032\256Fd\b\036\345\220\210\230\267d\033\273/`\300\236\271\016p\307\0216\024\357\307C\365\316s\2647\322\3363r\f\340\013\227(\027\031~\024\313Q=4\357\005_\331U\036\252\345\356\305\n\037\271\311\203\274#nY\360\026\226\322\003\n\337\235\274X\322\005\227wg\335j\264\232Dq\261C\301\346\370\302\324]I\"\023\344\210+\260.\353H\013\353\301\342Z\201\"\367\025\250\203.o\264\204\027\227\273\271\007,\260%jH\0254KO\307\223\225\233\363\217\314\354;\302\022G\245\306.\311\224\262\233Q*?\nw\317\324\340\306n\334\214\332\236)o1j`\245\270\371\001\205\024\250CcDj\034\n1\204\230R\312\f\ri\222\244\003\243\024@0\210T*\034\216\243\034\037\023"
+	.ascii	"Q\247\023\362@KC\207hF$I\212\n\365\0316\003\036rAm]\234\330\210"
+	.ascii	"J\345\303\247Z\263\303\236m\004\r\273\245Cd|\232\340\222\275"
+	.ascii	"\355\b\304\356\332\016\177\nr7S\207 \007P5g\270\360\330\237X"
+	.ascii	"\b\t\365\230C\252\034\004\315\377\374\301\210B\310>\312\232\322"
+	.ascii	"G'w\242\341\\R\252f\216\231\350\355\334\344B9-\031\242\303\234"
+	.ascii	"\035\303\266\301\002\335\210\215N\264\341\271\264\323\371\f\216"
+	.ascii	"\274\335\251J\001TF\232U\f\217\336\002\350\264\341\351\273\250"
+	.ascii	"o\241@\210z\246\264B\306gS\230\304\0232\214y\341\021L\022\r\221"
+	.ascii	"H\357\332\201h\212\272\247\367wT\352\335\217\204\307s\214$\201"
+	.ascii	"\266\007\313\241\031\t\276u\251'\343\262^\261&\037\241\024\332"
+	.ascii	"\326GI_\214\023|\375C\f\216G\245Ej\247g[\027\317X\264\250n\304"
+	.ascii	",oB\3271\276\3363\300N\204\246\270|Q\355\240\252\215\006\353"
+	.ascii	"\305\b\bw\\(\3751\344\253\312\210@\005\224\021\2148\027\212]"
+	.ascii	"\302t\314\245\374\325YF\305\302\b\252\271LBx4.\007\365\036\n"
+	.ascii	"\345W\233\347~\333\f\036\302\322C(\004\311\362\231\265\315\267"
+	.ascii	"\261\335-\221\216\356*o\362\330\032\365\3678\234\274\236\226"
+	.ascii	"\336\237XF\235C\354\036\201\205}Yb\024\306\342\245\361Xx\225"
+	.ascii	"\031z\217\007\362\243\203\325s`\t\254W=\2056\376/\02385\201e"
+	.ascii	"\352Y\251p\241&ZLTO)O[\266.uk\376\t3\326l\024\b\304\271d\263"
+	.ascii	"h\331\036\366\022\306`\370\220\334\021\022\017\026p\236\276N"
+	.ascii	"j\265\206y\362 (\326\237:\237\021\274\315\001:\n\327\313\253"
+	.ascii	"8\266\232\f\310\3518&\372\241 \303\332=\327\242.\322\201\023"
+	.ascii	"^8\243\246\317\202\300\372\244&\312\177\364\234\234\367\3341"
+	.ascii	"\2108\222\326\b\257\331\225\274\264\254\337l^\004\251\367/\261"
+	.ascii	"\032\267\232\357y\333\307\032\217\317t\210HWy%\306D\242\0313"
+	.ascii	".\242\325\256\201\001\212\202\207\230p\257#X\004\336\331\b?\316"
+	.ascii	"\361\266\223bH\f\354\372\261\312jh\304\031\321y\"\311\270gu\\"
+	.ascii	"B\251\236\304\210\252C\340e\255\237\271@\330*Y\375f\001\203M"
+	.ascii	"\240Z \335\233\b\207\2700\2360\264R\312\324\242P\251r\220\255"
+	.ascii	"N\243\f\273rB\344\250=E\376z\366\371'\350i\243tF\b.2\311\n\345"
+	.ascii	"\315W]\360\200\306\313e\021G\236A2\256\255\2029E\362\021t\327"
+	.ascii	"\346\372D\374Qq\230\t(\365|S\241\237,/\310mxo?\350\333?\371\305"
+	.ascii	"\026#\315\277\312\256"
+	.string	"o\315z\375'\002\230\235\026_#\0038\331\377DP~G\327\2058"
+	.string	"\343\364\341\022\270|\277\037$\b\262\255x\341\031+\320b\334\331X\355\246F\013\335\210\213i\003\0354*\220\215\251+\237\027\217\267\217D\355\245\236,\247\333\210|X\363\210x\363\334\037\372 \366\272Q\021\251\220\212|\305!\225\007-\300\020\\\322SG\326\331\350\360\243\260f\363\372\225Q\354d\250;p\257\223hN\r*z\214\226)\243\354T:\r}P\003G\220@\206\267\233k\340YR3\311t8@f\314\354\301\330z\204\3503 -C\367\221|\223\351m\036\002U\374\372\344\341\356\210\033V-D\332.\217,y\375\003\034M\307g\267U\275\231\2653!Y\r\030\346\221\217\004;\353"
+	.string	"\360\004=(n\b\026\322\2114;\237\347d\232\203\r\254\203\fk\320\374v|\252D\001\314=4\232w\353\277\211e*\337\316\365v\243L\227\361U\267\200)\321\237K\255s(\310w3=RX\007"
+	.string	"\205c\016\342Tl\260\366\366\272\235\335\013\226\fK\343\300\3261\326\372&U|\220zE\035\231U)X\301E.D\177\215\351ZP\256\235\206\240\247\351.\273\334,Y\233\255\344<\226F\3741?\374j+\207\260\275V%\264\216\025\301\322\300W\203k|\265\020h\323\200\t\177P\377\303\215\270\210\025\212A\221\337\350\304\004\022\r\240\300a\231&W\f\225\372#4y["
+	.ascii	"/\016\252\226uY\335:\231\206@\030\366>l\206\002\274\fl\002\016"
+	.ascii	"\353\302!\\\330\300\351p,\336g\356\031\255\226\330\216$\230:"
+	.ascii	"\362\002\316\222\305\277Gc\322#{zTKh\362\226zO\316\361x\367\367"
+	.ascii	"\241\273\265\330\006'\355\364\272\227\245A\004\335\245\252\252"
+	.ascii	"\210\031qG\200\023\214\362\341\346\223\250\264\007\310\261\240"
+	.ascii	"\271\234\024\f\025%\022\310\335\262\032\316EBcE\352\3776\267"
+	.ascii	"\312y+g\357ey\207y\230\332\366\202\275\016\213\247\247\t\300"
+	.ascii	"\n\336/\241\257\317\007\226\005\016\240a\276S\335\220*\203\230"
+	.ascii	"\231\r\246\001\206\237\225\353\330\324\033\260]\374\257t\233"
+	.ascii	"\275\343\234\354\350X\255u L\224\213\364\217\215\354[k\027\253"
+	.ascii	"\204)\376\207gF,\212qR_\274\031\273\215\350T R\002\355W\324\275"
+	.ascii	"Wkc\240*U\306\013\004:\251\271W\021TM\017\310+\005\034\301m\204"
+	.ascii	"\"?3\244\006\222\2269K1T;\022\027K\234\313;\315\3040\020a\364"
+	.ascii	"\206\313\216\013R\323\240\034N\323\006[\216$Z`;\311s\356\204"
+	.ascii	"\177\366\307t\n\261\373\214\266u\361\210\006Yb\225U=$\372s\372"
+	.ascii	"\213\245\2744\311:\033\277\212\211\212?\215j_\315\031\227\246"
+	.ascii	"\374\270\231\350\211\335Tg\025\217\201\260\030\307\036\006\300"
+	.ascii	"\346\225\027\261\341\203\2312,n\202\3246\364\211\317\036\363"
+	.ascii	"\372\244?\033Y\217\234\371\310|\236\306\177\244\270\005\353\332"
+	.ascii	"Q\311%\007\227\354\"\227\321\206K\027\307\247-\035\264>\353\037"
+	.ascii	"\322\204H\027\327\264khF1,5\374\255r\032\232\r\3129Y\232U\374"
+	.ascii	"RVa\250d\331r\326b\326\246.\273\332\264\266I\017\332\346\371"
+	.ascii	"\034\247\377\234\230\362\343\322\250\363G\351\220\251\030|.\334"
+	.ascii	"\353\370\257\213\236~\235TmZ\357\006_?\207\367\344"
+	.string	"\316\231\356\350r\204p\007v\215\004\251\272\313\330\317\325\307\021JG^\013\255Ku\317N\344=D\270\002s\316q\366f\357nG1\272\027.\222|g3G\277\242\233qRp\234\371T\316\306fj\375Z,C\344\024#\337T\357\224\004Y\216S\342]\033!\030\005\376\004\231\221Wd\023\030\033yB\3561\007\355\301\341X\033\260u\224\324T\253\304Z\320\n\203\037\233\210\302P\343\003\333k$\237\264~\\\3169\365\234\303\351G\355\235\035(*K\207+\253h\315Ff\331\366E\244f\214:\331%\246\226t\375\016e\360\227\002\240c\377\334\343\337v\272!M\247\265/\267 -\262\001\314S~\353Qsd\376m~\257s\257\033\217\232\261%\034\177\262\330\335\333\215\333\033\337\213\220\365~^\354Z\204\333\361\303\275\325H^q\264\320\001a\005\006z\333\365'\241\004\321\253\254M\234\275A\307\003D\230z\222\324\031s"
+	.string	"\304}H^\2723\314b\037w\315EYZ\033j]C\2229nD\337 w\321\377\004\036vp\f\2503\312\347E\220%\016\245\021a\2554\224\277\363Z\303\177>Xe\344/\264\236u\200U\370\027\255\210<a\302\263m\004\365t!\313\314\276d\267\307\236Mb1\231~\212\240$k\221H \250\b\302\242Jr\270\322>\255s(\005\213\036X\266\316\311)\267\243\024\330\027\360\225*\227\234P\212.\356\177\b\233\252\023+=\376\325\265\216o\260\002_\r!\243\343\217\303\252\023C\325j>MdH\201\312UY\316EZ}\177PhP\321\373A\177\001\310\344\247\013\261\333=\254\350b\225SH\231~\223\204\334\321\f\211\237\265o~(4/\375\016P\t\030\276\221"
+	.string	"\217\244\340\362>\350\223\345\357\311K\305\221\023\252\300\021/J\305\350\3424\035U\330BiD\315\225B\\\213\322\304\363}DBi\025\375\013U\227\r\201\306%\325K\243\022\206\241\310\263\273\016b\303\354\237(\243\003\022\275\321\2264bP\306\310\364k\225\013\315\367\037\243Q2\346\202\002\314\033\315\21207\322\r\3160\006\376\3231\272o\350\247\212\306\236\203\374\210FzpMP\242F>\271UN\211\307\2547*\242D[\026*lN\200\364\213\216\267\017\253\205b}\233\270\226\330\373+\267\267\223\327MW\333\\\261\3472h%Xg\216\272\243\0017j\032\b\036PE\344\2561\201\316\034\232i\016\264\317\306\231\n0.\004\2736\340G\345B\330y"
+	.string	"\323\344\346\220\223\250\2322\213\270\341"
+	.string	"\016\316\320\007\207\fb\006\276'\002\363\337\354\366\037J%\032d\031\253\2258 \262\313\322=\255\203p\231\263APB\032M\354\"ozK\375k\320\344\245\362j\221\262\215y/\246\205\271\305mF\270I=N\330\244$\224\334\\\251\004\305)\221q\352\373Z`\021\2620\252\216\337iFz\224\345@{\350\222v\031A\202\307\3447\203Lul\212l\340!(\377\020=%H\306\226\203Y\0137\312\247~\250|\022z\361"
+	.string	"\025Id\026!Z^\002]\234\225b\350,O\262W\350\272a\235\305\177\017\027g<\3767\347e\366\317+r\233\3733NP\203+\305\230\371\261\204\317[\317\b\307\313\261\212\r\243\031\274\307\251\377\372\r-\377\213\357\237\330;\356\274\2437\310\266\3519\201o\253W\264o\351BF\003\007\351\224v\204\033\352\231[\307GiZbF\352?w\227\355\220\364D\307\217\374\313\023&\361\035~"
+	.ascii	"\356\006\376\246oa.xfgw}\237\260-\324\036 G\377\202\337\257\301"
+	.ascii	"\350\213\337\374\327\3759[|\324\357\214\331\367\330\325\315\260"
+	.ascii	"}Y\354\276\3146va:h}\245\366\t\265\235\247\344\3606\316\251_"
+	.ascii	"\271va\331Yo&\260(\346\351\n"
+	.text
+	.section	.gnu.lto_.symtab.d5e49304d568c6dc,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d5e49304d568c6dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
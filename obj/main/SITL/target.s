@@ -0,0 +1,2955 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`@\003\245\024"
+	.string	"d\0364\004"
+	.string	"W"
+	.string	"\226\342\223\316\016"
+	.string	"\001\327\346\357\377\002"
+	.string	"\002\336\327\276\377\017\002\002"
+	.string	"\002\001\003\257\231\321\314\002\004\337\313\242\204\n\005\202\321\322\374\007\004\002\003\006\240\342\234\212\n\007\b\232\246\323\206\017\t\n\261\263\351\341\005\004\013\f\315\320\247q"
+	.string	"\r\242\302\263\302\013\016\256\234\262\364\013"
+	.string	"\017\020\021\374\355\374\304\013\020\002\002\002\003\002\005\002\006\022\023\222\221\202%\b\002"
+	.string	"\002\004\002\007\002\001\024\342\246\207\300\013\022\002\b\t\002\t\025\352\263\360\321\b\030\310\373\201\350\r\002\031\305\374\200\211\r"
+	.string	"\032\331\304\230\327\017\004\002\n\033\234\362\341N"
+	.string	"\034\035\251\306\315\231\b"
+	.string	"\036\243\274\243\342\f\002\002\013\002\013\037 !\"#$\247\333\250\364"
+	.string	"%&\246\271\350\260\016\006\002\013\002\f\002\r\002\r'\350\210\264\365\f"
+	.string	"\002\016(\367\207\224\353\001)\301\325\215\205\016"
+	.string	"*\274\205\242\255\006"
+	.string	"+\225\221\315\200\006"
+	.string	",\210\377\206\247\006"
+	.string	"-\271\303\275\241\r\n\002\017\002\020\020\002\020.\230\336\335\312\001/\272\302\257\305\007@\r\002\021\021\002\022\002\022\023\002\0230145\315\343\301\244\01367\263\330\307\3138\200\270\313\205\n\n\016\002\0169\316\341\231\365\002:;<\264\251\257\307\f=>?\367\267\311\301\004"
+	.string	"@A\370\216\225\261\004"
+	.string	"BCDE\222\321\201\352\t\b\t\002\tF\211\307\340\277\f\002G\314\345\244\232\005"
+	.string	"H\362\357\204\233\017"
+	.string	"J\202\220\306\317\004K\333\217\352\217\004\002LM\313\322\375\213\007"
+	.string	"N\310\342\324\f\003OP\303\272\266\211\013\002Q\317\253\250\341\002"
+	.string	"R\351\361\317\236\016\004S\227\227\247\303\tT\324\325\222\354\f"
+	.string	"U\265\300\331\214\001"
+	.string	"V\351\377\201\334\001"
+	.string	"W\346\361\327\375\t"
+	.string	"X\324\365\343\372\002"
+	.string	"YZ]\240\342\234\212\n"
+	.ascii	"N\250\3014\304\004\31094\022D\242\244<`\002b\216\210\033\021"
+	.ascii	"\360XG\206&\230Q\330\202\302\fk\261\304b\t\364a\"\006X\220\222"
+	.ascii	"\365\354\340\346$ \037.\304n~\240\200\023ba\264\317\234?\277"
+	.ascii	"L\252EK\244?\231.$\211\023]@MW\301\033C\277?\306\222B\030I-i"
+	.ascii	"<\252\277aV\177\320\204s}\226\334\272.;\004\377O\363d\347\020"
+	.ascii	"O\272\177\261\272i\rf\366eg\314\230H0\335\002\006j\367\362\016"
+	.ascii	"pT>\355}b\252\344E\300\373\204\033o\360\220\007\326\314TWb\300"
+	.ascii	"R\242B\177H\023Pm\332\254\007$\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\240\001\245\b"
+	.string	"\242J !"
+	.ascii	"Y\222\016\374\377\377\377\377\377\377\257\025\375\026\306X\242"
+	.ascii	"\302e\2145\345v\021\315\032UK#r\247\024\356\312l\314\356\300"
+	.ascii	"\254\265\373\305eo\231e+5\244\2222Q\006\260\300O\206\364\224"
+	.ascii	"\236B\250\223Oi\252LJH\366GDB@>\246G\007\207\316\215\215\306"
+	.ascii	"(\003c\347\305eQ\025K1\261D\304\020>\354\320PN\206u\267\360V"
+	.ascii	"Hp\315\016\f\bv\316\300\026\330\200\2643\321\326\333\2155\023"
+	.ascii	"O\250\341l\253hS\0316\003p\00299\354\021\260\251#\310j\353\214"
+	.ascii	"\001?<hY\266\214# P\357\267\300\177\243v\325\024\200M\276z\202"
+	.ascii	"#P\351\247\244*\320\037\271i\032\322@NE\007\270\t\325\377.T\320"
+	.ascii	"p\272\266G\016\366\271\234\252\240vn\343\235\347\224\313\252"
+	.ascii	"\242%\3476gL\221\02326\002\356\341\360\017\203\272E\204\212\037"
+	.ascii	"k{s!\334\016\031\276HmhX\006.[\306\024\004\025AL\317\246\nI\016"
+	.ascii	"\023BDF\251\315\214\b\230\001"
+	.text
+	.section	.gnu.lto_.inline.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\351\f\255\""
+	.string	"\246d\203I\260\326M:\r\235"
+	.string	"Z\036\0303\377Q\371\r\033H\377h>\\\177\353u"
+	.string	"\230M@\326\321\353T\302\227w\344s\372S\342\271\356\326\324\247\177q\234\t8\341\231\312\211\277x\006\n=y\310\214\302\210\260EN \022\266\267\224)d"
+	.string	"o"
+	.string	"u"
+	.ascii	"\275\255\221msG\257\267\325r\030q\3766q\370\2378V\302t\204\212"
+	.ascii	"\315_fm^u7\200\3076\334p\337\302\266\331\303h\t\312\227b\362"
+	.ascii	"b\330\360\032/n"
+	.string	"\271\362\220\005\244\313\273\203%'uw8\2531\313W\350\177\376\227g\226\236\207\317g\032\177\377\212\356\316\375\363\277\f\357\367\2236\273\273\351\237sXU\335\rs\004\213\233\274\237'@\262\036\236\272\021D\312\314\017\374\354\362\375-\f\364\3758\306\212\002R\024\366\260\226\316\247\003\334\300\317_\236\371UEGdeEt$\303TK\212v\227\272\315O I\300\311J\233\266\232\237\206\306\306uv\262\222\225\037[9Y\177\227\357d%+Y9\367\3755\256\315\244\013\340\330\352+J\323\211\\v\272/z\001\364\364\274\263e(\262\214w\371:\3631\274Ke\316\301i\211\207%~\203\206\223\225\3562\354\027F[|S\234\206\246b5.\264\214\202^F\f\027,T\240\240\363\t\347!\341\267\371\323\3353\317\211\260'k\311JN\\B0\377\215\217\204\276\274\266\306\f\312\r\351:\327\370\300\006\252\273cF\007\373\332"
+	.ascii	"\233ll\300\340d\355\005\264y\005\273\004"
+	.string	"8%x\233Y\001Gq\3427q\262\322\246\016\245&*\020\306\217\"*\260\227(\271\243\266\260\302\334\234a\004\211\017\330I\354\227\tIF\021\221\327\004\211\306\354#rKY,p\200\374!)\237\037\330E\204\240Kwf\216\234\223.>x\032S\272\037\276\031\253\3409E%$\t\313AP\220\356,9\211\364\300P\272\247\252\220\257tOU\340;@\270\2719\217\343Y|\311\261\203\3409\201\005\250\201AS$B\232\0242l\006\301\004D!\006\241\224v\022\200bA\214H9\243\fB\306\220`\002\221@fdD\202\210\264\331\f@\213\274ho\352RI\203\024e\016\023\226\244\257\337A\204\377?y\240\327\336\310\205\026\365\245\246:\264\305G\322b\242\020\317\216m\222\036\323\307\203\245\312BUA\250\003\314UH\327\333\370\273 \327\305\362\025I\367.%o\2211\214\351\231cx\262i$\222b\304\034\005h\317"
+	.ascii	"\225\305\361\210\006 \303\241\225\315\221,\302j\267\213x\325"
+	.ascii	"n\002\356S\036\334?\244`\357\311\264i\351\304\0310\312e\335!"
+	.ascii	"nm\240\204\"4\235\314\312f\240\b\367\020\242L\r\027d\256[\261"
+	.ascii	" \017\017K\030\275L\357G\374\370\207\231!8\204\210\013\257\215"
+	.ascii	"\242\032\252\304\237\361|\230\300Q \230\232\\!\272\216\030\274"
+	.ascii	"L\316\"\350\244\256\311\n\247\225\226%\254d4\025\005%5O\341\344"
+	.ascii	"\301\022\340\304T\350\315d\304M6\316\305\207\336eH\230\313r\224"
+	.ascii	"/\356\265\271^\361\345\037\307SK\245\310\017\257\211\327\234"
+	.ascii	"\265O\205\223D\2678\276\027\237rg\352;\260>E\344\211\3029G\200"
+	.ascii	"0\246[\225\306?07\376/\334\201\0019u\343\321+g\016\303\312\305"
+	.ascii	"\302\rn$F7\274H\206\375i\240 \270\231\337\253O)0\023\316U\302"
+	.ascii	"\3315\005czX\315\366\317\216\037X\330=%3\023\276\362@O1\363\003"
+	.ascii	"\311L\241\177\005r\017\315\3566o\342R\346$0+\326h\231\230\275"
+	.ascii	"\376\326\361\315,\001\202w\236\006\203\237\310c\361\004\351V"
+	.ascii	"L\263\223\016\343}N\306\220\310HE\007\203c\032lZC\220\0223\204"
+	.ascii	"\326\252!q\200\b\365\035\2355i4 S\007\352i\206\255\200\247z\220"
+	.ascii	"\262 \325\356\251\265yA\326\301\254\240+\2243\r\245\316\260C"
+	.ascii	"G\032D\373\302\243\272\t\273\004\3168\006\3651\007 \300-\255"
+	.ascii	"\335r\311\027\221{\325\326\031\206\034D\366\331\bZ\356\3779\213"
+	.ascii	"\3049\3073\036\242$\313{f\371aQOci\230~\016\277\247\026H\246"
+	.ascii	"N\3748\324LU$\323\200\323\026\007\2577\264+i\337V\024 \003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\214\022M5"
+	.string	"ZF@\017D\200li\016\372\312eT\253\267\330w\354~\331\267K\376\233n\276Z\033e\245\310\325\242v\270{/[\233\004a\377\330W\342\035b\203\210\031\347\037\241\313\271\025i\036\342\330\td|\007\217`[\311\333\266L)\005\323"
+	.string	"\343"
+	.string	"\344"
+	.string	"\237gE}uW\347\271\312n7\233\035\035y\202\357\225\374\231\334\325\357\0205\271\253\207\311\356\305\377\311]=\th\375H\224\273\316"
+	.string	"\355'\345\256*@\353_\374\275\246\334\365\001h\257N\247\323\265{\256\362}\355\355\315\377\375\357]\346\363N\363}\177V\356\332"
+	.string	"\2649_\271\353\001\320z\335\t\0204\326\351<g\371\036\006\355\255\201\226\311\274\321|\217\303o}\213\273\026\177o\030\016\336~\335\005ZL\234*G\004\365\030\317\321\243\b\033]w\210\335\016\217\016\235\016\007\204\377\356\316\336\364\2717}\357\235\337\343\322\356q\361$\317\342\324KPwu\320a\366\215\276\333}"
+	.ascii	"Q\254;\300\202;\364\231\350\263\220\373\303\272\275\356\037\362"
+	.ascii	"\005\237\255{/\265\255\352\226M\b\276\363\335\316g\337\227\356"
+	.ascii	"\206\317\276\367\354\371\366\3557\360m\335-\204\025\274\350\334"
+	.ascii	"\325\003\004Z\317\304\367'e\357\353\316]=7\240\365J\274\277;"
+	.ascii	"R7\005Ad@\207M\b\344Y\201\222\360G\317]=&}\234\317\347\201_~"
+	.ascii	"\276\377\336\343\324K_\200\356\352\t\211\360\346\215\237\340"
+	.ascii	"\301\203\351\355\347\361t\034\215x\353\341\261z\352"
+	.string	"\270g\307\232\371\332}\357\321\271qW\273\005\304\00796I#9q\262\343\256\226\bh\035\364\270\353\017\002\255\327^\236xy\342\003\006\207\354@\356\372p@\353\271\032\3674\276\341\255\243q\rk\204\334\365\305\340,\370g\367<\344{\357\257\fo\273q\237\213|\257\364\366\236q\352\245l\344\256O%\311\3373\222\357\275\356\006\316\305\031\204F-\264\333\355v\236\225\334\365\203\200\366+\nX=M\234\226\330V\353XZ\303\035H\265Di\320:\026\241\221h\330\216\251\"\211bM\350\330\251\342\221\344*\305\254\243\216Y\300#W\r\177\300\244\2152\305I`Z\003\361H\216\342\311\205\257\266\260N.\223\352E\t\026#lOVa#\241\266\3152F\330u\2428\222\024\3204\332h\222x\024IT\306\024\016K\225\365\377\370\300\200\016s\341\003K\213\252\357Q\346\256\037\224\251o\026\337\302\363\276\025\264^\321\373\354\263"
+	.string	"\367\247\362BsWX\033\320z\263\251F\352\342\355%\253\271+\fL\263\300\030\266\244W\020\251\350|\373&\372\274\340\263\324\267\007ww\3576\224\242\033E\212\023-\373\034\302\335\255\211n"
+	.string	"s"
+	.ascii	"\314\361\023%\276\b\352\251\310\251\273I\02451\241\030\321\335"
+	.ascii	"\"\272;Dw{\260\375\322\006\235\007\255\226fTj\226\267\221Lsf"
+	.ascii	"N\250G\263d\352\312\241\352\026\211K\t\264T\324\rJ\253\3142\317"
+	.ascii	"&\251(\0024R\313\024Q\234ub5w\222Z\342\215LE\324\tB\307f\210"
+	.ascii	"\351\254c6\033U\n\374\201\206\307'\334\001=\263\260\214T\344"
+	.ascii	"\312\302$\234l\370)\t\323h\264+r<Q\220h\316J\001Jv\225\252\225"
+	.ascii	"P\323P\365<\231\316)\243\246\251dJ\256\020"
+	.string	"20\346d\035\206\241Z\232QW]\244\232\326H\255d\244*\216\270\031\356<mf)v\031a\251J\341\205\360B\270\001\203Rl\313,\271rR]4nX-\315\322\250cc-\fC\224\234\201\222)\276\221\240\302**\252\351\020n\314\0215\r=Q\224\304(\271\205\236U'ZC\0137\315:\346\265t\001W\273\032\321\263\252KD\265N\364\326\240c#\231\013\201C\250\321H\250L\315\210\210$I\222e\r\321\004\2048\351\250C;\022\3001a\016cA\020\202\206\031c\f\"3%\"\222\242\264\2321\351\201=\311\342\300\335C#\242\201t\224\034\343\235\\_\030{\247i\2013GE\031#D\213\203\"\215sH\353\003\350\025\243\024\277\030y\f\004QC-\b\371\\\333\t9\302_\270\221\360w\343\0137\224\205\242N)l\201\322\231\230zR\354\265\346f\362zA\004\b\177\205\241\021mt-L\210\335"
+	.ascii	"+{$\243\265\214KC\312\324,9\320\020P\230\002\262\213\273v1\212"
+	.ascii	"B\021n\337\355Cg\232\265 \302\371\344+k \237\n\"\367\363\314"
+	.ascii	"\300\260P\204X\250^\357\022\033y#\244\020Z\207\205\016\230\365"
+	.ascii	"\307\261\203\021\324\321i`\251\260\275A,XN\347\212\235\322\004"
+	.ascii	"\346\024\230\247\207?\252\3042\314\251\210#\335\202\367\"\301"
+	.ascii	"@\242m\361\354s\206HK\030\214\270!\336\332 G{\345D2a\377\271"
+	.ascii	"\024:\213g\3619sm\374Y\332KCO"
+	.string	"\005#u]\350\307\200\262H\214\r\006\326\004GOrGp\307n'\310\"\344\205\235\0200\353\266R\352\f\237)I\276S\354.\215\240\313(V\254\024GD'\177\223\332\231e\023\037|E7\257)k\253O\267j\236\306\023;\b\t\325\211\227Q\2049\232|RO\323\335\3628\344\244\3573f\336<^\213[!\325\313r\217\206\2545\317@\225\034\355\222\021\354J\303\347S*\300&\261\323Qa+\330\220\251(\302\376\030\274\364\006X*ig\006\300x\315\344K\020o\337P\030\007YT\217\275\302+4|\307\374\f,Y\332\030\002\003\b\267l\364\225H\265\371\313\340\277\365eq_\0206\370%\343+=YHRh\032.\246\211\355\">/>\t\300=7X\002\277\303]\273\005\342u`\211\304\371\347$\264\016\n\213\266p\204)\370J\f\21740\370\215%Fr\341\242nz\303\210\237(E\230_0\253\307"
+	.string	"\031\2541g@7hnC\271\200\263\r\\\265Nf\243E\001N\252\003\240\031\022\253\365\006\b\272G\004\0021\b\005/F\305\225B\315\361T\f_\213[\205\261\277\3247\2748\243\316\200\375{P\342\235\254Z\301\030\267U\301\364\027\353\224\030\260\357 \261\025Z\250\335\bz\251\336aj\005\026\231\333\270\364~\354!\366\340\030e+\300\003\235\224@\264\003\266\3458\240i\272v6\217\\\036,\300\t\002\310\305\272\002cV\254j\327\246(W_\005t\363N\2358\236;\231\255\001+\0058\220\337\325"
+	.ascii	"0\230kV\275\270\004\354\267eX\332\304/\270\027Z-\235\237\270"
+	.ascii	"\313\373U\252\033\353\001\024"
+	.text
+	.section	.gnu.lto_.pureconst.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \254m\004"
+	.string	"\302J\"& U\222\016\025\020\tpg]Z\001\270k\001\001\001A#\275i\032\351\202\314\213\344\335\202\306~\251\310[8\275cI;f\303\354\227\355\262[6\213\257X*P\212\243X'n\342\247\304\210\304G\\\304\232\020\007\261>,\017\253\3039|\3035\234\343\031z0\374\302-v\305h(\254\211-\261N\304:\020\213\036\0269\354\006g\360\205}\024<\301\241y\020\374\300\r\274`\021\2012\003.\340\001>\327\001\254\215\2258)\245\231"
+	.text
+	.section	.gnu.lto_.ipa_modref.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`;\003\025\r"
+	.string	"\026\32142Po2\0340333S\223\215pUU\325|f\246\307l\233o\372#3\302\021\236\001a\232* \256C\235GgLQOf\342\210\267\226l\"e\n&"
+	.string	"*"
+	.string	"%"
+	.string	"\203\332\247\265\006\007\345+e\301\004\305J\016\274\312f\243@"
+	.ascii	"\300)\345\363S\232Z\355~b\345Zy=k\336u\002.\345D\257D\304\035"
+	.ascii	"\210\226\362a\206\312C\235,\245\034\032\236\341\205\025&\247"
+	.ascii	"\344\270\231\023L\214\214\211\t#\374W\371\325\t*\003\263c\216"
+	.ascii	"742\212q"
+	.string	"A=\255Y*/u\222\312I\325\366\366\234\217\312_:E\345\242jXAA\253\363\265\007[\214\214<\325\177\264\277-\312'g&%$\371\353\260+\022\362V\177\257o\223\335\312\262\315\211\272\n\362\361{\364f\250\021I(\235\266\244\220a3p\202!#c\007\021\360\254B\030\242\231\224\244Zk3\300B\332\216\274\210\013\317\372>?'\323j:p\315\273\035\016\316\271\355\236\372\316\367\021\203b\257b\237\377`h\335\371\231\343f\352\343\347%\3262\207\344\nI\242\371\033N-\240\020\036\206\260I\370\033*/\233\301\352P\372Qr_3v>\224>Q\262\"\001\222\374\003\256j7\273C\330\306\216\360J\371@\fK\005V.\007Z\177\253\217ph\201\350\337\260\217u\241+R\323\341v|\307yP\255\270^\244\253@L]\207A\365\211\032\372\237Sg\311r\326\327s\304l\023\332\322'\340\363\260S\216\207\376"
+	.ascii	"W\253&\016\230\200\326t\317c\032q}"
+	.text
+	.section	.gnu.lto_.lto.25140533fc523dd3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timeLock.87.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 T]\002"
+	.string	"\324\003G"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001?\202\210\200\020}{\273\001y\273\001\005\001\006\031\006(\300\001wu,s\276\001q,o\276\001m,k\275\001i\275\001g\274\bec\277\001"
+	.string	"\004"
+	.string	"\263\022\255'an\2061"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_lockMainPID.88.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"-\007"
+	.string	"BN23`M\323\001H\001\220\274\254\203\365\332\016\034\002\301"
+	.string	"\352`OhEZ\372m{\034\3407\364|\327\226E`\033\017!;\260\235\305\350f\201\006i{K\231R\316L\007\t\006\b\320\322(T\030\0136,`\030`\246\332\300I2\345\240\251\240EQ\025\274l{\267\332Q\2258*\341(\037\362\221\013`\227\363\350o\027\331\370\236??\\\371\370\347_\320\237\r\021\221\217\252\322\204f\366\226\245f\330w\253\035\373iu\003\236\247\260\354V\264\254,\312+\371\330\306\354\213\357\361\017\3146q\333\206v\f\016\n\022\225\335\205\322\005\240?\367"
+	.string	"\350O5\216=1\377 w\035\027'Q\313\236Q\301\356:\243fq\353m\023\330\236l\177\002\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.89.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\225\007"
+	.string	"2\31636Po\322\001\240d\361Ta\212\213`\264\"\021\242g\305\315PL\246\257^\206Y\202\030\211\037\004bH\031\255w\265\001\3245c\372\301\3645\f\032<\006\355&eJ\001\356P\b\n\007\t\020\363,X\034\f:0p\032`\307\272 E\340\352\301cA\254\252,\250\341\366\230\325\220\001K\367\321\ngR\340>\231>\372\3105\220\"rR\005q]\323\337G\347\262\200\335\317\243\017\362\220\b\277\343\317\022Y>\376\371\331\364gOP\344\243\223d\245\263\320\315\346\266T\r\373\230\325\220\255\033\321QJ\273\030/.\333=\023\017\333\327X\263U\316q\354I\037\027\245\226\335\205\272q\355\251\371\027=\023A\333\023\240`w\235\021\224q\353molS\266K\002\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateState.90.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`4\0205O"
+	.ascii	"\252\212 \036Q0T\312I\007G\360\257\240zp\375V\246<vP+k\200B~"
+	.ascii	"\227\307\t\243C\237m\022\256fZ\235\262\237\310\354\363\3771\001"
+	.ascii	"\020LPpv\330\201\2048\341\336\364p\240v\225\321\013\030\306\267"
+	.ascii	"Nb%O[\312\317_\251q\362\2425K\244I)S\270\001\234\001\352\001"
+	.ascii	"\374\022\224?D\371>\312\0272\371A\224\017D\371?\224o\232|\037"
+	.ascii	"\223O)\277\207\362{\224\317\243\374\035\345\227\224OR\276\216"
+	.ascii	"\362\333\207\317\224\277Q>;@c\017Y\300\332X\254Z\307<\025\016"
+	.ascii	"\211\326\302\256\355\252\355\032w\213\273fv\321l\017\367\230"
+	.ascii	"\307\275\177\277B\254\361\313v\032\304"
+	.string	"\271oV\355\273\266D\234\2729\333\234\035\354\020/2!\006\"\330\226\375t\337|\203\200s\036xV[<\262/no\265\326%^\007\3376\353\3464\r\311\b+\250b}\221\003\006\210\017\373C\007\013\004\222\021V\261r\375pcS\254\200\267\244\221n\207\312\036v\215\324\226\375\007\016\221\212\324\277\003\033\032\220\032\221\312Y\036\034\342\274\322l\0356[\303\332\360\323{\260e/\322\342B\004[\362\367\340\247K\362\266\314\216-\331)\r{\346\\4N\244\004\241R\266\305\203\267\344\326\240\035*\315|\2605\270\325\203\002L\363Vk\261\201\"\225\256z\025\353\227\037U\340\200\301X\3624x\313\377\202m\330\271b \254P\255Z\322\234\325Z\224\361\037o\311\027\327D\271$o\207\312%\177\376n[\344Rw\fLx\346N\255\365\327*\354\271\264\247\307\333\225\244\256\371\374\366pY-\355![\026X\272\246lo\367"
+	.ascii	"\226.\024\226\307\002K\227\327\356\274\210\020r\271Bl\241\240"
+	.ascii	"3\252\265R\256 \223\272#\341\034\013?\\Y\272\024w\254\3206\314"
+	.ascii	"V\n\254\233Q\245\fL\016KW\n\333:\032Yw\250\374pa\351|\220\020"
+	.ascii	"\252-\3312\024. \363\356\201Z\353y\310\325\265\367\331\377d\376"
+	.ascii	"\327\037\250-\233\347$\303\253\365\n\211\305s\216\371\371u\222"
+	.ascii	"\341\035\236d\3125g\3309\303\232\3751\346\212\334[\260\255\216"
+	.ascii	"\243\355\220G\030\345\274\310\376\322\331:W\003\3653\336\341"
+	.ascii	"\317\312"
+	.string	"%\373\314\020\356\020,\034\025\257V\254\032\337#\252\356D\340\005\204rI\262wj\214_bW|\274\361L\354J\367\226\353z\333\310\230\033,F\342W\263t\272j\255w\201U\353U\213n]o\220\b\344\343\271\2737\370\366m[7\035_/w\332\301;\334Q.\311\375\242\213\027\216\336\026BeN\360\355\212\217W\301\277\017\nx\2078\232\275|\025\345\336\200mu\024\274eKf\001o\030c\377\0130\340\035~\311\366\307\327\025\271\267\254\266\372\213@\356-\377\352jk\371M~\023\223\017e\362\237L\276\223\311g\342\343/\361\3619X\265\275\022\037?\211\217\217\304\307\337`\327\366M>\376\021\037\237\311\3077R\202\277d\3625X\343\276\310\020\237\310\020\177\210\217/\304\307\317\300\307\017\342\343\0031\371>L~\017\223\317\303\344\3570\371\022\230|\035[\334\347X\261\335\b\326\314\036\207\217\177\303\307g\300\207\277"
+	.string	"\345\333\240|\005(\277\006\345'@\371J\224OC\210?C\210\217\200\020\377\200 \376\217\362\223\202\3702(?F\020\037\006\345\033\020\304/\200\362\221\200\370/L\276\013\223\177d\362\t0\371-(\177"
+	.string	"\312gA\371F&_"
+	.string	"\312\017\200\362WP>"
+	.string	"&_\005\345\247\240\374\242\037>\n\223Od\362O\230|\023ffB/ \037\021h]\233\020\214j\263\024a\206lM\226\026\230\372;p<\306\345\350\003\232\304\2626f$\213\201\001.\240\177#\234ZI\375\023C\245\004\303\212\244V\212\3212\302Pm\016.4\020\2437\007\003\032F\013T\353\306\302\032\003z\335\342 u\001-C8\227\304^\250\330\214\215\213W8\245l\034R\223SJP#\206%\300\004\364Q\273\350\027'\234(\250\300\\\226\246\234U\252\224K\276\360\321.x\364\221\004M@\022:Z\202\026\255\243w\207\001\272\005\213\036\240wu\214\232\205\226,Fl;\232\207"
+	.string	"\275\243\027-\200\026`E\007\320\273:"
+	.string	"\364\212+TJlV"
+	.ascii	"\210\243\245F\fC\353\321>Tt\217\336\263\024\255B\016\23588X\211"
+	.ascii	"+\026\353_\242\250S\364\256-\030\006H\205J\311\nO\341R\324\246"
+	.ascii	"U\236/\264\037\233\350\023M\324(\372?\263\234[\214\204|\002{"
+	.ascii	"1\235*\234]\272\224K\242\350\236\227S\023\371\364\211\336!\034"
+	.ascii	"T\233P\0237f\264\001\356\251\241J\364S/\016C]\302\327CB\355\343"
+	.ascii	".&A\n/)\004F\204m\322>\fe\203\272Io\032\240\016\372i \263\177"
+	.ascii	"d\260V\024\323\b-/\3040\264\252j\305\244\235\372\034\214\333"
+	.ascii	"\343q\317CI\233I\257\r\253\223a\005\266/#\032:=M{\315\202n\256"
+	.ascii	"\370xV\204\0259i\202WW\352\337\323\353\236\336\235\t\206\341"
+	.ascii	"u\2579-\030\203\237P\325\340R+\226\215\377\\\201C8\277,I\304"
+	.ascii	"\306k\263L\235/\2645Bl\214\030\331[\256\346?\267\310\321(\242"
+	.ascii	"\330\031k\263\353\262s4\363\020\004\003\244\303Y\273N\352\342"
+	.ascii	"\305\300\262\313\242\274\021\303\332\253\2052A\350\2208h\017"
+	.ascii	"D\271l\270\236b\210\330\346\366x\272\360\302)FL\271\344\262\t"
+	.ascii	"O\222$\225dj\311\351\367\004\345\344\004\305\224\202\251I\352"
+	.ascii	"I\267\373 *j\211\251\210\324\023Oj\252\210\023\250\247\322\t"
+	.ascii	"\324S\221&'%SL\226\232\242|\234\224\\\2604\305\244\351\bojI\223"
+	.ascii	">S\322\004?x\\\360\233jB\022\2654\365{R\262\344\364c\212\222"
+	.ascii	"\372%\031\035\252IS\324o\n\n*\352G\213W\253\253\255\345\017\\"
+	.ascii	"5\220iQ\0245b\330\262\2242ec=Nt\265bq`\321\354\276\231\341\343"
+	.ascii	"u\360\226qZ\025\036 \270M\225\235*\271*<Ux\312\252$\252\216\274"
+	.ascii	"\303\363\r:\300\301j\253\337\350\2639\237\254i\273\321;\2649"
+	.ascii	"rbW\375\035\316\254\037.:0\320;3s\276\304\026\3403N\033\302-"
+	.ascii	"\320'n\370\202c\203\315\326\206p7\330\3702\301\bb\330\366z\313"
+	.ascii	"\323\342vK\275.ib%\327\260J\032\312\262mo\313\233(;\"=\314\344"
+	.ascii	"\bs(\277HeSC\371\025\350\262\253\261\372\031\233\r\341jt\216"
+	.ascii	"V\240{-\370\003\260it\215&\333\236\304p\002\233\0241hgh\224:"
+	.ascii	"\201\336`\230%\255\324eZ\020I\323\350\025ba\240\031\307\214h"
+	.ascii	"\3368\350$\275DIs\320d\022IzI\2303g\203>\322Hz\233z\203&\327"
+	.ascii	"\204sLm\244\217\264\356\f\220\317\234Y40\365\021p\311\316,#\275"
+	.ascii	"D\354Q\334\334\027O\203^\352-\322\032\364n\271\035\203a\210t"
+	.ascii	"\221\3366\341\334\002)\2074\021!=\244wi\302\271nS\004\tu\317"
+	.ascii	"'e\006-\244\311:A\031\200t\220\316\240\227m\311-7;A0\300\033"
+	.ascii	"Zfo\273 \r\244\215\260\330\031\214\303\234,\261\300\202r\311"
+	.ascii	" M\024G\354J\355\247p\311\316'\274Zk\r \235\302\030\030\210a"
+	.ascii	"b\217\2632\345M\271C\312\031mdL\016\002}@\317\350\016\201(\250"
+	.ascii	"a$d\221c\210FDD4I\ni\ra\005\204(\346\2503\036\021P\261b\f\215"
+	.ascii	"\320$)d\332\f\333b\214'\367\337e\312\244\342*\371U\332\224{\275"
+	.ascii	"\313\243\320\270"
+	.string	"bT\323\373\363:\335*\341\220\310^\336\321\002\347\334\005\335C\303x\271\273\377\352jx6\216\036\245\027\323\330\204@\020\357U\211\310\036_~\214\217\312\003i-\267j9\247 \207\344\021\361O\022\310o\366\234\004\032\315\335\211\035\346\214P\001\370)\033\033\261\2364\321\256:\rY\030E\302\003\003"
+	.ascii	"\re\355\024f\206\303\226]{S\206\200k\350\035\335\177\347\224"
+	.ascii	"\\\374\253\237,XM\213+\335\217\262\013\b\232X\020\264\264\242"
+	.ascii	"\340eF~D@\r\"Ij\357Vb[Hr\255=(\211\006\246\223\036\317J\323\302"
+	.ascii	"w\320[\344\03497\347f\347\177\274#\022\2769,z$\206\322\332\361"
+	.ascii	"\326\360\321\366S\275`X\271\363\270\177\300`\320\263L\300\003"
+	.ascii	"\r\237\003zaH\267\337\200\267\200\354\260\317\256\302\370c\016"
+	.ascii	"\330\322\031\002\bq]\224H \335f\nN\033<;Y\213e\360\244\036\234"
+	.ascii	"\304dY\346\201i>\3505\206\310\243\036\233\3423/\263\004P\036"
+	.ascii	"\363\314\220D\344\213\266\370\2053M\013d\345\350\226\337.z7$"
+	.ascii	"A'\201\350\n\356\327\274P^9\316ia\323\f\212/F\342\227\250^\035"
+	.ascii	"\207D\200\237P\224\306\270\275\031\021\263\377\371\272\204\322"
+	.ascii	"\232\343\3445\232\373\222\002\204\347\323\360\243\261\377\262"
+	.ascii	"\177&|\277M\347\315\f\030\013\201Y\227\027@i+\036Kt\261%\342"
+	.ascii	"\312\303[W3h\321\024\373W\243\251\245\260-\0374'3\202\325\013"
+	.ascii	"\204G%g\341\026\f\007\307\230\366#*Jo\253,f\266\253v\327\224"
+	.ascii	"\273\244\036\350\214\246\361t\224\247\307\251\013\374o\"\376"
+	.ascii	"&K\036\332(H]\222\211\260\030\332\013\213d#\201\202\202'\"\377"
+	.ascii	"J\025\275*@\370yt\212\346&G\2023\341sG\270O\373>+%\263'zo\377"
+	.ascii	"\304\235\032d\327\223\315}gH\266\317\355R\021\3313\344y<:\352"
+	.ascii	"&f\246\204$\017\334d\001\252\314a\232\274\372\277\334\334\341"
+	.ascii	"\n\331\375D8\320R\305\267\350$b\274\303\300\beJ\221\367\251\001"
+	.text
+	.section	.gnu.lto_udpThread.91.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\027\002\365\022"
+	.string	"6\342}I\320\324Mc9\360Wti^\242c?\234\361q\002\035\021\333\344\215\220\031)#\300e\002\344\2720\375\001\003\212\337\262)|4\325\213+\360FI\214\r\265\202\322\316\204>q\340\002\220u\212\305\265\022\201O\374\275\267\334R\246\024h"
+	.string	"f"
+	.string	"g"
+	.string	"\246\013\235\260\310\312\246\310\352^s\264\371\002\340\255x\002\340mma\320\266\336\036\202\366\023+\275\371\325hj*\251\304=4)mz\247&\312\032\n\226<\267"
+	.string	"\200v\376\235"
+	.ascii	"\361\\\374$\b\005\275\270TN\317W\317\243\035\2552G\353{O #\253"
+	.ascii	"\006HR\271s\032N\270\367\232\352J\235\273\344\266U\330\256`S"
+	.ascii	"\006\001#H\320\353\302Z\363\301tUeSqu\212\310\211T+\3176q\324"
+	.ascii	"uBh\206\353\316\376y\207\224\372%\030V\340\260P\032\217\356\305"
+	.ascii	"I\202\344F\331\246\030?\177\373\346\367\334\262\315\337\270\375"
+	.ascii	"\264\223\210\313\021\215xXU\367\336\006\267\206 \336\276>\372"
+	.ascii	"!S}\300\275\273!\246{\315\007\036\305\333\327\270\215\233Mu "
+	.ascii	"=44\211\377\357\336{A\025)(\030\326\002\350\211\256\203t596\243"
+	.ascii	"\327\331d\251\214\312!X\3621\362U\236\377\212\344\263{\022\353"
+	.ascii	"\356\346v\002\303\352Bq\244'$G\261\034\200\372\307]\300\337\334"
+	.ascii	"P\340\211\256D*\b\222\364\034 ^H\022\274=\321q\330\304{i\256"
+	.ascii	"\363\215~$\302\377\271\265\214\215^w\353\333\002FA\221\301\314"
+	.ascii	"^2\330\214\366\201%Ff;\2019\254\006\223}\216\245\\`\261\2602"
+	.ascii	"\326f\036h\260\332\b\343\002{\031c4\2311\345e2fF\033k$I\033["
+	.ascii	"\367u7>D\021\036WU4\265\306\006\250\017\265b;x\217\f\216p\253"
+	.ascii	"A,\241\262`\003\007\272\224\"*WqAa\345y\006|\2450\304w\372\323"
+	.ascii	"\214\377\343\016--\265\236Y4\002* p\002\031:\353\001{\371\023"
+	.ascii	"\264\213,c\242\261\260Q\217\326\330\260]$\372\262)\035B\236\027"
+	.ascii	"n-B\263\202[_Y7\370\256\364\344b\016\204~\220r\336\300=\346\023"
+	.ascii	"A\253P\241uB\215.\035m\304qeD\024\035\220\355\005\220\254Q\373"
+	.ascii	"\334\306pkd\223\001\302\301\034\261\230\274\276\232\t3^\227!"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_gyroThread.92.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\351\002\215\030"
+	.string	"&n\244I\260\226Q:\344d\025\034`\025\276'W\017sX\232ZK\221Z\032C\336\373\377\202\027\374\2101\206\336\372G\212\376\274\023\246<\230t!\017?\2055\353\325\1773\362\214\340:\253\341\214\005\356\273\023E\343\306'\215l\262eJ\001\220"
+	.string	"\207"
+	.string	"\217"
+	.ascii	"^nS\353\322N\252V\362\201G\361\364D^\304f{)@6\035\261z4\212x"
+	.ascii	"U\265\222\243\311\017\bO\305\007\bO\247\016\267\326v\261\305"
+	.ascii	"\242\340\\\233?\177P\3111\345\323\335.\202\254!#\036\307\342"
+	.ascii	"\002\t\304\271*\235|\207\333\026\321\321\214\263|\337\030\277"
+	.ascii	"\247)\237N\306)\205!\277\234N\306A\220A\331\204\352\245\033\002"
+	.ascii	"\007\030\361\310\235\367e\241\023\332\371\335A B\312\"V8\216"
+	.ascii	"f|Y\025j\255\336\234\356\350\236\271\355\033\266C\330\253%&d"
+	.ascii	"\373\234,<\r\347y\337 Ib\224\234\214\004m\231\331\2132\244\233"
+	.ascii	"\223\311&q{\234\246\253\322s\311f\255_\342\272\206\265\246\t"
+	.ascii	"\327\256p=\023\256[\207\272C\272"
+	.string	"\276\r\007*#%&\023~\265\032\225\021S\255P'=\016\365\333\367\225\334\247\"\n\222\n\377\310{+\236\304\363\005\224\252Z\353I\237g\027\222?\331\016\005$\336\\\210QE6\312Z\311\006\247\216 \236\336\200\017\020\256\260]\247k\333l\327\336\210\003\2635]\363DSp[\306\376\223Cq\023\177\207;X\312R\341\351\314l!\205\2635\357\273\002 ?\334T\222\222\300\276\246\355\001\304y\027\263\200\221\262*\205\346\3155\3635wL\021\031\001\353\367D\214\330\347j\346{\247;\262\252\304\315\333\372\320\321b\f\235LW\272$)\325\211\3036\373\223\bm\230\316>\347W\324\023+B\363\366\307\350A\005\003\234L\006\n\303y\240F\216'.B{e;\366(\236qK\255U\202\277\344Lz\374\035\247\016F\200`\007E\354f\007\026\243\225\3700\243\001\361\330\374\200\210\311zj>\263\231\206\330\t\037\031\354\007"
+	.string	"\254\006\333\001\255\003A\303\207\034\017c-\306C\203\325F\024=0\331\250C\373\031!\334x\346\023\243\215\265\331\2146\272\310\240\317\245\361'\3024Y\225A\023\347\004\353\377lN\266\203W\261\355\214sjA$\302\260\340\324\276\200a\243\276\210)\302\317\013].\345SRd\310\311\tO?\277\373&%U)9!\375`\255\265\266X\006\226f\372\276\r:7\256I3\037\020U\231\t4 0\002B\220\205v{\363\305\206\025\365\260\274\301\303V\334zJ\226-\256f*)\330\262{\357\266\201'\320\265\241\353X0\033\321\352\016\314.\252\231%\354p\"\345\302\024\302xM\306zjm\242\2714\353\260\327Q\332XV`\026\270\321+\222\264\302\b\021\bXL\270t\004;\346\275\355\265`\376\032Y\222\311\343\311\300"
+	.ascii	"\362\026.K\342V\223\215\211\227\273p\017C\252\301\226a\202\322"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_tcpThread.93.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`q\0015\017"
+	.string	"V\232cH\360\260(\035`\227\365\371\205tz/G\335\256Q\353\355\324\230S\353\213Ph\303ma\017{\021\345\270\374\315\330\35464%\0215\337\254\264d\033P\023\357\352\032(;\344\025-;b\226\371\222:\234\254\3477\262\311\226)\005K"
+	.string	"L"
+	.string	"S"
+	.string	"<j%;\223/\300\235~N\200;\235$\274\355\351t\233{\362\247\016\016\216\315\210:\335<+\026\023"
+	.ascii	"\306\325\026\242\311nN\363\3750\212\273\245h}\236\346#111f3\266"
+	.ascii	"\276\036\006\265V/kl\271\271\333\266`\333\201}\231(\323\2657"
+	.ascii	"\230\366,\203\314@\314d\342D\331$j\347\213\375\020\fM\346\351"
+	.ascii	"\262w}\320\266\220\315|\007\216ZYj;\265\2447'l\237l\320\376\345"
+	.ascii	"\234\017\250\325\365\242Q+\231\300\335\347\3642\2379\3319\006"
+	.ascii	"H\230\026O\315\253\303\213*J\272\302}6\320\241Z\232}\030\217"
+	.ascii	"\261\342\227\360G\332\263N}\022w\3729]\304X\270\244\266\266m"
+	.ascii	"&&\024\245\210\301\364\001\023Q\316\032\033\253q\316\027[\364"
+	.ascii	"\020\242\3249q\371\254k\\F\216\230\021\265zA\255\266\243\252"
+	.ascii	"55bkP\t\320*U3\026\021\031\241|!#\357\003/\224\244\210B\001^"
+	.ascii	"\350\2156\213H \224<\210\320\205\037\t\364\302\016\305\304;\351"
+	.ascii	"D\240JG\022\342R\312\007va\251\004v \262~\272\272g\350qc&KM\321"
+	.ascii	" \353\303$\330\b>c\202C\247\024>\034\024\034\250\340\255\020"
+	.ascii	"-,% \200\002\221J\353;\362E\r\323c\246]\270\267z\271\332E\310"
+	.ascii	"\006\360\256\230\226\312\346\023\260\303\bZ\245N\004>\256*\002"
+	.ascii	"yXm\320;\336.R\353!0\265\317\314\034\261x\036\274\246\242g\016"
+	.ascii	"E\227\334\233\244\305\200\374\026\346E\b\322\247\"\007Q~]\346"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_systemInit.94.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`a\006}!"
+	.string	"\266\270\317J\200\334Q\0075$\375\n$\272\342\312\332\304i\fk\364\r\251aGHe\216\210\241\215\031\343\257}\321\033\303j\321\270r;\316D\r\243;\215p\214\225I!\n\024\016\206\204g\003\334\036M\220\303]@Y\261\261\311n\"eJ\001\255"
+	.string	"\274"
+	.string	"\276"
+	.string	"\356o\020\347\253\275\367\366\334\303]'\007G\367^\357\270\307\216\037\373\363@\264y\322\2415Al\357\247\265\264\215,\217Z\357\365\357\376o\364\234\177\222\357\322\357\345dg\020\352\004\303*K\356\275{\276\364\364\374\222\367\003\314/m/\300\374\322\265;\231\177\263\3667\021\323\304\344l\357\235f\254\327\257\313\341n\316\233Y\3322\326\376\357\022\203\257\363\034\216*\214\363\033*!P7\360\351\267\347\002e\243\t\233^\016sD&l\363l\243\220v\345\t"
+	.string	"\242\320\226\255\210\274\3611\f\342\022\306\267\n{o\307.1\352}\367\356\036\345\3766\367\322\030f\016\224\226,\031\316\341\211$U\214\022\377\361\377}+U4"
+	.string	"\341wq\306IC\346\265/^\236\330v0\207\0168i\220\302\034\244B\346\341\034b\bZ\343\201\226\024\036\250*\222\363U\317\177N\241\244L\210\3278\001\354\037\302\374\367\243"
+	.string	"\211\375\330\b\022@@f\t\023Y'f\206|2\\a\373Q\230\376a\017\005\205?\020\357\371|\346\227\245\0245gh\224\360\232\357\260\277\023!w\237o\362s\t_\016\235\303\007<_\272\023\255.\306\316\222\302\034\364\033\376\367\227 \235{+\275\353\377\365J\200\376@\276\364#$\374\356\227\376H\346\227>\357\236\324\002\277\353:j/Z\222)\007\003/\376(e\212\353&'\377\327\017\031\017\346\377\305B\274\364\244\215\370\335\234\274;\032q\362\277xk\242\3249\374#c>\357`E\177!6kh\350\"~\027'\357\216F\220M9\350\020\260.\377\373j\364\r"
+	.string	"YU\347\360u\360\344\320;\006H\361@K\246\270\347\035\354\307;\231\231\266B\020f\357\341\273\372\352\034\276\024\317\227\377\276\031],\363I\215\345C\027\213:\210\326\302\357\352\362\3568dk\013\313\211\003)\314\3011ez\353\034\262\320\035\253\2206\2207\\\376/\253\240Y\227\0058\375\1775\227&\242\215|\321\306.\357E#\321]\332\250\215\026.\340wqyw\234B6A\t\353\n+\233$\024t\304\252+X\025\310\366Z \001\307\005)@Qt\250\350\247\202\367\001\303\b^{\344\201\b\351\003\257\375\025\375v\274\001\312"
+	.string	"e\200Fp\320"
+	.string	"\307\252C\354J\302\310\327\0260Z\327\237\035O\300\256,\253\362\206|\353\217\332\366\202\214\216xj\333S\331\013\006\034E\321\366W\264\301\004\221\332\002\223\200%\002\264*\233\335\207\376\210\330\020\"mU!\266\327\246E\277\036Q\352c\201)\312\363\325He\323v]\3314\367\356\317=@\254!\225\362\222S\300>\177\276^2\3355\223n\302G\2656j\302\035\272\2343X\nG\375\03035\234r:\371\277\212[\234f\310\200\241\223wG,STY\270)\330\t\007}\25010\352\234d3\"A\031i\n\323\001\360\002\221\0312\017\020(e\312J\223d8=J\265'\203\033c\367\350a\036~\0341\355\007+j\fL\237\251=\227\201\232\365\237\304E\210U \226\342\0043w\270\006\031*\023\223\331\257\263!B\020\021\tc\351i\220\255\327\b\354"
+	.ascii	"\334\262\242\344\022\326\20503\202\236\201\225\3141\264\262\006"
+	.ascii	">\336\302\301\351\227\275\230%\346\263\312\214\032\221\001\317"
+	.ascii	"\375\3137\0251' J\254\001 \312\022M]\213t\275\221\200g\262\250"
+	.ascii	"\007\204H\2653y\264(\212\315y\235(Y\360\f\366~Z\227\240\223Y"
+	.ascii	"\360\331\344 \277\267\031\231\023\305b\024I\016\0236B\245\032"
+	.ascii	"\210f5\327N\237\026=\320~\247\2262\240'\266\207:/\313h\320\230"
+	.ascii	"\342\036\tzC'\340\0339\331\332\030\033\004\b\357\203r\030\257"
+	.ascii	"\022f\367\250\001"
+	.text
+	.section	.gnu.lto_systemReset.95.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\325\n"
+	.string	"f\023H@ \005)\035`\241\314\343\254\310\b\f t\004\f\223\307\217*U\227\021\207\271\214$\202f\221\307z\273c3\236 \300\246a\213,q\211_\351\254\022\241\244pght\025\t\026`Fc\263-S\n5"
+	.string	"4"
+	.string	"5"
+	.string	"k\003 {\201\004\265\222\344\020T\0013\300\214\355\203\314\262\t|\026S_\253\215\320p\265V*a\316\372\262|\357'\242\326\352}\231\234\334\362\266\025lC\330\377\002\003p\006@6\347\317\3728\242\355\360\233\016?|z\030\210P\206O{\365\261\177\3715'\245\260\034\270\271d\313\236\265V\272\330/\250\262\305\376Z~\275_\037\024R\212d\347\371\366\224V\212b\260\025\204\3655\272K\333t\n\205\234\366\035\017\365}\335\347\345|\241\201\331\240\370\251\316\317\271N\312\227\261\n\334\277>}\260\373\234\261^\030=\321\243\310Py\243\270\022K\007>\215&,$*\350\350\241B\323H7>\223\212\236B\221\216B\0069\274\220\216 \030R\320\307w\3026\334&]\250\224\340n.\331\2226\214\027"
+	.ascii	"{\345\233Z\033\035kgm\232\001\354\2003\320\004\300d\252\202\200"
+	.ascii	"\037h\214*\204[\233f\261-\017\373\300jJ9\325Q\253\301si\027F"
+	.ascii	"o\301\222\227!0\003P"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.96.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\n\001u\f"
+	.string	"\206\027UB Q\224\016\244\032\343\006\202\341\002\320#2Q\342k\265\205"
+	.string	"\267\007\275\037\2033\250d\301*\030\r\225\033\260\204\264\022\223\257a7\320mY\337P\244\020\370\316h\356T\314\201\370\243\"\031\376\347\266[\246\024>"
+	.string	"A"
+	.string	"E"
+	.ascii	"\366W\234\344;\013\016\376\3305\301:"
+	.string	"\331])\260\274<b.\340z\254<\300\365\350\317f}\205bor\343T\322\332]\tE\376]?\337ji\260\273VTJ\304\ro{\200m\t\366S\001\1771\262\023\334E\347\005\217\244\013\b\006\231G{CI\217\362[\274C\002\205\207\016\017\320d\257L\nO\330\257\354\356\032\252lUCU\253\252\217\035`\235h\020\300\261\033\"\245\307\242D\033)0\333\327 '-Xc\002\204\231\221\313\270\316\240\2400\243\n\001\001\240\276\347:\264-d\230\0177y\214\317\004\201\256\307\303(R\"\204d\204\037\272\374\222\303\b\371#\306\240\351Q\217\276v=F\0259Z;:h\212/\3526\300\315\013\331\226\301\3336\007\033\307\233\335\214\340\321\246\327\225\272\n\005\246\250\304\361\272I\032M\016\363G\003\201\363`#\275\t\3422Oj\be\232\374p\235\324`\274\211&'\275m\343$f\333\026\037\252\024\301\355M'\027"
+	.string	"|e\031]\333k\353q\233\005"
+	.string	";\340\f4\0010\231\252 \340\007\032\243\n\341\326\246Yl\313\303>\260\232RNu\324j\360\\\272"
+	.ascii	"\325\305.b5\032/\260\007"
+	.text
+	.section	.gnu.lto_timerInit.97.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21405`O\322\030\304\210{\204Y\201\030*\305 4\202\351g\223\222!\1773\006\201?\303\354UD\016\261\311V1\370\231\327\275\021,\247Q\007\244O_\b\021\262\267L\001C\bg\365\321@H\312S\315\007\202;\260\301A\263\211\223\212\220\234\031?\025\307\023;r\"\302\202-\tJ\306iY2f\264Ui_h#\3322\236\306"
+	.string	"n=\241\370\0045\251XA'\013\001\216x\240\323_`8\315v+.\333\306\303^\303\334\013y\225\366\205\376!\274(\213h\327#\006f\267I\205\344\327\314\327\267\2506\262\2322\352@\031\355n|\"z\251\273V-\321\201\f\204\251\013`\330\335]\006\372\320\237\376\006\377\302\017\022\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.98.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \305%\005"
+	.string	"2\t\")\200k:p\n$\220e\264\334kP\007\214\354\325\002\340\377\366f\2738\203\377\215\334\232R\204\301\201\337\033\031Ul\033\367N)\266(\204\342\220\320\354Z\314*\323G\243r\2505#JM\306 \327\324\f\303\246J\337^z\223DN\354o\213\362b\037\260\322\263c!<(\334\255\214\300\375\004<\032\333\227\254\331\241\177\231}\007\244pD\273\253\022s\355Q\363\277\371\200\353\266G\201aw\035\271\316r\313\333&\330\246l3\002\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.99.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"=\t"
+	.string	"\346\321A;0\345(\035\200\213\367b\240GX\310\210\225c\326\303\t\245\0374\022\333\307\201q\034,\346P\250a\206s\017\221\355\316h\276\354\325u\300\340E\013*?\210\251\306\234\265d\357\275S\n-"
+	.string	"1"
+	.string	"/"
+	.string	"\247\366\354\227\207\255\375+\266\221\002`w\253\024\261\214\336\247\214\236\217\300\372\374\270\324V\254\307\fhw\035\277\225\307Mo\033d;d\373\025\224\003\006\305\022\264\357\372\3434\370\356\022\263\333\021\013\2600\3122\262\261\375h\237\344%\336]\031\016\330\005QY\331\r\017\\5\247\235s\262\323\371\201,\276\004\375)\301\317\335])A\333Y\214\362\341OP\002\255]\325?\013\215*\241\340\324\276\300\210\377|\223k-+\230\206L\331a*\312\020\373\001\326H\004\035\217\307\363\260\221\270\205\255CI\224D\020\016\234\215\304\231\246G\037\205\206\020C=m\021\235\350T'J\"S\035u\025\365\3231G\261u\365\304q]\335\330v&\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.100.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"u\n"
+	.string	"\266\023KC \307*\035\220\b\026\023\b\206\231\030\310V\272\001\350\342S0@P\bRP\252L\221\021$\3304B\217\006@R\201\265\302\006\030!EA\307\230\trP\302\023\334\217i\005<TA\005\260m\215\220\275S\n3"
+	.string	"5"
+	.string	"9"
+	.string	"\225s\256;\203\346\334\366\005\3159\217v\203\227\262}\201\024\024\002\017v\267\322\227\217\237\243\377"
+	.string	"\357\2200\327\347F\264\273\236$l\345\246\267\355`\033e[A\333\356\256i\314\376\354\237[C\f\203\016\007\273*\021 l\215;"
+	.string	"c\373\036\333\2634\202\005\264\335\005Y\202s\316\237\366g\016`\374\214\304\235\335\026\003\264\335\022\344\254\032\352\f\256\276\260\212 \030VO\271\337\226\306\314!S+\241&\336\314I/\340\003X\n\262\335\327\311\026\347%\2028g\213\214\314\223\236\tXj'\324e\227\256I]\354\007N(=t\237\317\347\343+\201\031&\217n\"\004M]\b\313C\231\272\n\213Q\367\205-\324\311\273\210\020U-\220B\364\276\325\027z\276\022\230\332L\n\215604\252\370\201\204\236XU'/UIa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.101.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\227\0015\017"
+	.string	"\006\235eE"
+	.string	"\221(\035\260\027\244\333}E\216\364\336l\034\360\304(\246\335&\273\214\233L0\266"
+	.string	"\034\001\373"
+	.string	"\222\370\257~\030e\355\253\267\026?Z;\013\377\013\304\202\213\253Q\201\327W^\243Ue\373\266O\b\331[\312\224\002Q"
+	.string	"K"
+	.string	"Q"
+	.ascii	"\217\271\003;\n\325\277\324\327K\331\310|\320 \333M\031\360\350"
+	.ascii	"\216{\374\202\374\0227\241\362\n\344\363\260\242\311d\300\220"
+	.ascii	"B\307\356\327\371\373\207\366\310\035\200\366\250\035\276z\256"
+	.ascii	"\374\307\036_d\314\\*\254\347\266`w\235.\225\225[o["
+	.string	"\200\355\002v\032\b\004n\237*\344]\376\020A\263CvAY\366\307J\345`\037\256\262\330N\203`\372\003\323\036\230\356h\232\003\323\033\230\3464\275\301\264\006\323Q\323\020\246\025\246S\323\367\200\340\002\345E\"B\215]\224Y\315\322D\030 \376\375\266\312\001_\221\362]\036\035*\345]\217~I{\334\024A\013,\252\252\246\367^P\243\352\f\223\307DPCl\300^\034\307\210\230]'\260\260\333\n\220\252z\357\345$g\276\246f\016OfKxl\304\355\356\201k\210K\315\353\004\254\2253sy\230\307J\234+'T\272d\244\301\003\006\016:T\310\304D\202\352&\210HF]\211\351\324\215\210\230D!d\352P$\222\251\353|{\270\312\002R\221\226\2368\005w7(\220\301\344\314\037\005\351=\032\036\325\364\243q\306\013\321\321\215z8\332Q\220\030,D3\034}\213\026N7\233r\272\335\210\031\371*\002\037"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\341\302H]\315\242\302\330\222T\343\340"
+	.ascii	"n\251\026\210\223b\272&\031"
+	.text
+	.section	.gnu.lto_micros64_real.102.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\304\001E\020"
+	.string	"\306^lF\340\262(\035\240C\201\256\347\341\271\367\031\217\3466\313D\331\231\330\003\243\025\001\243\340\334\240\240\235\002\361eE\251bnk\230\246\323\0057h\034\003\206\341s9\034a\032\026B\2012\r\360\327\254\375O\032\331[\312\224\002V"
+	.string	"Q"
+	.string	"["
+	.string	"\336o\263\3702\217r\316\202\345\336\312\267\213\t\361\330\330\314vc\016<\232\333\036\277"
+	.string	"\374\024W\301\342\226"
+	.ascii	"\336\207\031\215'\004\206\035 \273\036g\357#\332\343v\021\355"
+	.ascii	"Q=\274\345\331\342_v\350S\243GL\306\345\tZ\260\273\316\230\314"
+	.ascii	"\314\255\267]\300v\002;S\001\336\362:\227\245l1\004\267U*\344"
+	.ascii	"c\036\301\361\202\314.\250\213\355\271\244v\260\017Wkl\247O0"
+	.ascii	"m\202\351\022L\223`z\004\323\"M\207`z\3234\b\2465\230\2160\r"
+	.ascii	"5\2550\235\232\276\b\004\03304(\"\320\330\205\371\204l\216\350"
+	.ascii	"C\342\001 \335\224\344"
+	.string	"\007\006\313w\361\027+\276\210G\253R\362\261G?E{\004\351w@DM\325h^f<\303\211\r:4\340\370\310X\333\344\373ZX\330\205\r\200\032\365\335\315K~V\205\032o\240\\\266R%\260#\347\232\252?\272\231-\3412\326\266\273\n\256\250\021&hV\344\300\362\013*\257\364\t\252\301\003\006\016\270\227\n\305\225zq\023V)\026w\342R\341P%nQP\271\270W\253\345\342F\336\036\256\326\234\264\004\246/^\201\273\034Lf:\371\331\244'}\207\003\346cfwm\240\244&\315\236\356\206\244\232\226T\343\321\225\030\351\246$%\371\021\351(\244\"\0250\244g\025#\244\247\021\" p\002\2312\332\003{\362\211M\327\3210\177\332\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267mn\030\333\022G\221"
+	.ascii	"\223O\336\311:\r\020I1]\217\f"
+	.text
+	.section	.gnu.lto_millis64_real.103.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\304\001E\020"
+	.string	"\206\336kF\360\222(\035P\355I\307\243>fhk\307@\315\304\216\323D\220\244\364\355v\324\f\204v\021@lF\255\366\257\337P\266\277\365\276t)\217b\316\023>\\\233\023<\350l\260\202\362\033\365\037k\377\227|\262\267\224)\005U"
+	.string	"Q"
+	.string	"Z"
+	.string	"\277\r\363m\006\311\334\005\354\340\353\363[\361\324\210Hq\233s\345\300\245\275\356\362\023\200\277\342,`\216\t"
+	.ascii	"A\264p51\030hr\346\004=\203'\341.\273\217p\227\373\341\261k\314"
+	.ascii	"\277\355\361\006\307\216\032\213\354\332Y0\347\264\326XZ\356"
+	.ascii	"\275m\003\266\023\330j\n\372\231\333V]\r\301\355V\005}\315$("
+	.ascii	"8\b\271]X\231\r\312t=\330\217s_l\253IQ=\212jQT\207\242\032\024"
+	.ascii	"\325\237U{\242\272[u'\252\271\250\226Q\035W\275Q\255\253\376"
+	.ascii	"\b\204\034\025\027\025\021`\314\251\022\022\231<\344M\211\203"
+	.ascii	"\001[\2023#\345\307\270\214\227?\342\322\247\225\276v\351\257"
+	.ascii	"\270\313\316\236&\204\\]\316\205f\343\031b6\364\320p\342\246"
+	.ascii	"\306\264O\302\360\205\2059g\004\342\312\375\007C\323\320\273"
+	.ascii	"qe\216\224\333P\273\005|\310|u7\310w\263%\334\226\352\346\234"
+	.ascii	"\n\276%\022?\\Z\310\3144t\027-\227\032\245\324\340\001\003\007"
+	.ascii	"\236\353\224\3022\271\274\t(S\312Ca\265\274\222\211U\024N,\317"
+	.ascii	"\245R\261<\0208\037\347\276\220\326d\2664\277\342\234\035Nn3"
+	.ascii	"\032z\264\244\375\247c6\304\001D;Z\265\371`B\313\255h9 \237\t"
+	.ascii	"\320v\033\332\022\234\317\202<\373\331\001ElP4<\373\033\235\355"
+	.ascii	"\002# `\2021e\264\007{\362\211M\327\3210\177\332\327\215\375"
+	.ascii	"n\017\243\260j\035\006\247y\260(\372\225\373\016^\t\001\"\032"
+	.ascii	"\273\2209\\\032]l\353\315M\024\0359\360\343\302\203\310\200\323"
+	.ascii	"\207\361\265\346\316\30767\214m\211\243H\200\311'\363dm\003D"
+	.ascii	"RL\327#\003"
+	.text
+	.section	.gnu.lto_micros64.104.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\377\001]\021"
+	.string	"\206\240qG\360\260(\035\330\bp:\005-\252\004\362\327\225\252\334,\306bls\272r\230(\007\300^z\311{[\200\312[\355_D\212\324\177\331\355\246\362*\032\366\231\332\232t\260\231V\371\306^\350\304\342v^\373\244\355M\244L)["
+	.string	"S"
+	.string	"\\"
+	.string	"\347t\225\263Q\374\231\323\230\024\266Tln\024t\217\237i\370\374XD++<\2669\303\004\217\366\272G\237\305eP\334*\020\216p\22163\225\232\2409C\317\341\007\310\307\356\002\344\343\212x\353\332\362OsNE\217\r\260\305u\r5\230sZ\301\026\227{o\033\201\355\005\266v\b.^C\342\307<\232BJ\017>\372)\371h\253.\350A\353N\254\226\262.;t\351\302\330\347\346\276\330\237\335\246\207wI\252IR=\212j\221TwR\035\222j)\3251\252\271\250^\251\326\250\376\307\bH\206D\b\320\234\034n=f-\352\224\370\354\017\003\241\325\355\3668_\b\271qC\373\357\004l\306i\230&\3019\316\221\217rE2n\343.\316g\333--\267\377L\300n2\354~\340\220}u\377\331\374\030\227\321\362c|\"\"\"\037\277\353\341g\205\354\2457\227\324>\241\364`i\t\304>\324`\3532"
+	.string	"}\213\277Hus\276\016\372\001'\252\222eU\300`\202ZI\237@\036Dp"
+	.ascii	"\301c\241&\254FX^\t\311H\312;\255L<\020\003VY@\255<\226J\265"
+	.ascii	"\362H\341<7\367\305\264\001b)j\257\205\361\354\204\240 \255i"
+	.ascii	"\365\306\347C;l\003\b\235\240\0343\341\264\031\334n:R\346|\035"
+	.ascii	"\030-i\264g\351\201\361\331J[\003\346\207\207L\264\264\203;\272"
+	.ascii	"\025\355?\237* p\002\2412\353\006{\362\211\231\306\224\206\301"
+	.ascii	"d\357\343\300`0\330f\031\2440c\343\275!\323~\266\245\371w\261"
+	.ascii	"+\303\340r\037\370\200\205\214\235\263\r\324\020\320\320\310"
+	.ascii	"\326\342k\204\345\347-WY\230\273\t\206>\317\217]\f\271\035\225"
+	.ascii	"\2153\021\213#\"\250\300i\270;\210\tY\3406\242VL\302\"\003"
+	.text
+	.section	.gnu.lto_millis64.105.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`f\001\225\016"
+	.string	"v\033`C\020\221\223\016\363p5\266\032\230\247\225\232\352\277m\276Oh_B\376\343\202\253\267\245,:\rz\245\331\232\265\200\304X\252\033\371>@U\200\247\331\204\233 \340\272\264\261Q\370\371Z-iD\032\331;\311\224\002L"
+	.string	"F"
+	.string	"J"
+	.string	"uK3\247F\216\033\007\354\344\305\306*F\016\201a\265\313\260^a\026\223\216\np#R\254\027\032'.9b\344\264r\036`\031^\016`\031^\204G\316Q\355\026\277\324LwB!97\fb\214\315\023J\212{\267=\3206A\233\031%\351S\347\004<\314\2401\235\324r\244\374J\353\027\257\3226\353q\312\355\300l\006\263\234\227\305`\366\202\331\r\314Z0\013_\366\275\354a6_\326"
+	.ascii	"8=XJD\350b\334\320\361\2104P\206\t\247\374\314|k\022\333\314"
+	.ascii	"\346\371\353\206\331@X\207\337\334[\n\223\013\277h\f\205\252"
+	.ascii	"\252\262\f\255c\250w\370\303l\253\277\363wo'L.\031~\0015P~\336"
+	.ascii	"\333\252f\341\026\243\232D1|\322'\303\372c\031\372\357P\243\002"
+	.ascii	"U\312\256W\266\026\002\027@$\257\b\210\003\b\r\036h\242\021\t"
+	.ascii	"\241\020\221F2!\344\243\211\204J4\220\217\202*\214\2044\021\b"
+	.ascii	"\024\3222.\372\305\253x\376Q\272\251\331=\215\361\366\341F\b"
+	.ascii	"\231\035(T\261]\320u2\032b,\031\340<\343\\\301L\267\255:\217"
+	.ascii	"\261R\243\003\205\035\206O8\216\335\001  P\002A\352\262\016{"
+	.ascii	"\362\2111m \031v\326\"\347hX\235eo\363^\304\3120\\F\bt\300Be"
+	.ascii	"\267\252!\220\355\300B\243\242\305\303\b?\3173\256f\261y4\206"
+	.ascii	"\206\317\263\215E\026Z\303\224\2628}\002\\\304\n\302\246MB'\003"
+	.text
+	.section	.gnu.lto_micros.106.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001`\360\377\203X\266\001\341\t\003\204n\244\017 \266\234\240\266F\220QCr\314L@Z\023\361\311\203_\234S6\210~7Y\"\331[\312\224\002\266H\b\n\007\t\217\272,\300\n\365\034\030*\r\317\002!\236\024yz\270\300GM\023|P\334+\247i\224Q\215\257M3\333\244d\262c\227v\204D\376\272\026Xh\324\262\243\225za\277\255rl\247[\246\357\b\262\223d\273\023\035\224\035q \032\26616\344o\234\003\343\252\305\f\354\3718\331x\230\354\306\027]\340\271k\017x\356\024\343\325\263\362\337\361\026\"Rra\326\023\300`w\235\027Fq\353m\017\330\226lW\004\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_millis.107.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\"M/2pM\322\001\030~\027\365\252/\\P\31120\230\341\201\200-\264\240\266F\220QCr\314L@Z\023\361\311\203_\2343v\330}7Y\"\331[\312\224\002\266H\b\n\007\t\217\272,\300\n\365\034\030*\r\317\002!\236\024yz\270\300GM\023|P\334+\247i\224Q\215\257M\263\263I\311df\227v\204D\376\272\026\\h\324\262\243\225\212a\277\355\356Z9\266\323-\323w\004\023/\351\354Rd(K\342D6lcl\310\347x\007\306U\213\032\330\023\222m>Nv\343\213.\360\334\265\007<w\232\361\352Y\371\367x\0331\001\2710\353\t`\260\273\316\013\253\270\365\266\007lK\266-\002\b"
+	.ascii	"{\311'\323\342\2533\216\206\360\3402%f\354\341\256\230\332I\006"
+	.text
+	.section	.gnu.lto_clockCyclesToMicros.108.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\r\007"
+	.string	"\"\21503pO\032\003\344&:8"
+	.string	"0\351\260\211r\263\263!\227\304'\256\332\210\310F\202\263G\333\357\354\337\022E\331;\216k\260\254N\025Z\267\333'[J)S\n\236\2523+\022\"\246\325\231S\347f\241A\201Ab\225\303\305\301\344\004\004GB\316\313#7T-\212\352\222\230e]r\273\341\237\250\217\262x\027\355\006r\357\2435\374\023\265\036\331~\004\035-\017.\277\306\214\314Y\342\312H\333O;9\217\262\006\374\036)*\377\r*\001\034\333\326%6\3714\203[\210&\211d`\240\304\374\227\224\007$Gh\001\311\361\2018\263\313j\237\030\222\274\300\2044\220\235\006\341\177]H\333p\237\333\026\264=h\313\021\n"
+	.ascii	"z\345\263\2425\307\354\330j\035\027r\026f\316\016FB\331\013~"
+	.ascii	"\3461\265\223\f"
+	.text
+	.section	.gnu.lto_clockCyclesTo10thMicros.109.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\005\007"
+	.string	"b\31503`o\032\003\024\302a\213\321\332\260\316]\355\002`\351\216\223\316\034=\315\266u\035\334\027\230R\373wY\2079\214T\203\262."
+	.string	"Iz\226\215\232l)\245L)\235\2123'\022\036\246\305\231Sgf\241A\201Ab\225\303\245\301d\304F\003!\347\325\221\031\252\226DuI\314\262.\271\335\360O\324GQ\274\212v\373\270\247\321\032\376\177\237\250\365\310\366#\370X\331\224\374\027/.W\211'\036m=\355\344<\312\032\360g\244\230\3747\250\004pl[\207X\304\323\fn\034\232\324\021\262 i\371/)\017H\216\320\002\222\343\333pf\227\325\0361\004aA\001i\037;\f\302\377:\220\206\341>\267-h{\3206\024\t"
+	.ascii	"z\345\263\2425\307\354\330j\035\270\260\330\301R(\313\202\237"
+	.ascii	"\031M\355|\002"
+	.text
+	.section	.gnu.lto_clockMicrosToCycles.110.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \377\335\006"
+	.string	"\262\f/4`M\222\016\300\016,rBq\206\031\270\271\035/\030\305S\332\260s4|d7\224K\203zK\351a5\004\266\361\020\362\017D!\247i\303\300\265n\255\021\"S\232+VVf\272\26208,4@\f\363\020/\030\204\260.\031XE\r\264P_\021\230\b\261\353\212p\313>\317\217\222x\023\277q\334\323\370F\371<\337O\333g"
+	.string	":\261R2+B+i\"\225t\374\233\037p\375d\013df\220\20027\204a@\245\377~\024ds\026m\034\3324\202A!\242\222\271A\252\005S\245\250\004S\245\267\321\254.\273\ri\344\201\022\352h\234:"
+	.string	"\205\314\334u4\213\376\372\037\374\t\377E\n"
+	.ascii	"z\345\263B\303:\221le\217kx\013\023\303\251X\241\002\013~f4\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_getCycleCounter.111.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\"\315/3`O\322\001\027\302\301\272`-\001\303\204v\221>E-Q\001 \\"
+	.string	"\255\021\344\006\226\274\b`EMK\223q*$0\257\034+\221\347^\006\331[\312\224\002\306L\007\t\006\b\257\312(\300K\365\034\026.\r\017\003#\336$\231z\310\300WQ\024|Q\334\253\247\251\264Q\216\257M\237\322i\331\344\307.m\211\211<v\205\270\340\350e\307+\025\303~\333\335\265zl\247[\246\357\006JP\030Hv)>,{\342F8lk\354\310\367\370\207\306V\213\032\031$\262\321\tY\331\215O\272"
+	.string	"t\327\036"
+	.string	"\335i\306\255\247\345\037\344\255C\305\004\313\256'@\301\356:\261\254\342\326\333&\260=\331\266\b\b"
+	.ascii	"{\311'\323\342\2533\216\206\360\346\232\222\205\310\303]1\265"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_microsleep.112.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\266\001\305\020"
+	.string	"F\340qF\340\360&\035\302r\264\260\016\341Z\370\370\303\313\207\240\031\205\036\217\312\236z\346\300\353x\216x\b\357T\363\317\364o\325\025\340&\315\336\303\310\203x@\017\355\020_h@xqD\234\314\210\247=\t\363g{o)S\n]"
+	.string	"X"
+	.string	"_"
+	.ascii	"k+`\356\343\220\344\001\342\341\373H<4\314\246q\333\316\276H"
+	.ascii	"\304\314P\216\335\345\224\2035a\207\361i\302\374\324\220\324"
+	.ascii	"1\021\321b\207\"#l\036e\362=\275\2458Z\321b\336\001\240\023\035"
+	.ascii	"T4\230\324w\037`\"I\306DD\263yz$\330]\347\214\226\341\366\270"
+	.ascii	"m\013\266M\354K\005\266-\226\252c\337D\006\222\007k\315~\320"
+	.ascii	"\037\002\3231\246!L\277\227VM\247\246\277rp"
+	.string	"\203\006GE\004\034\2734SR\253\004_\360\374\366\333\177g\225m\273\020\3547\227\257L\r\b\213\020<O\2735\004\016m\340\343\360+\362\264\377s \330\203.\030d7\307\307\305\006Q=2\215]\227\234nDOu\\\362\247\351\323\315\200I\035^\345Q\274c}\314\354\024\225\374\354\351\352\306\206R\214\306\362\355\356\252\352\250-\341\335J\016\315\240RU?\263\303\243\351F\212\327\324\313\220\220\345\224C\364\372\300\251\305\314\216\263D\273\365\216E\233v\327D@\t%\234\237\032/9\025-\257Da\265TxF)Y\320@\001\003\356\305Jq\235\274\270\t*'+\034\212\253\205+!q\213\002\313\305\275Z-\027\247\262\355\265fx\324\023\365\364\2422\273\274\335\034\004O\267\017Pu\374\353\212\r\265\030Qk~\267Q\214:\"\004\265\344\027\275l\004\3027\214x\030\025\026a\270\001\2206\204\223\370\031T\325N\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds.113.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\035\t"
+	.string	"v\022@8@\305(\035\340\345\r\032\342\356\344.\004\373\204\006\337a\311H\250\311\306\247\002\325\345\325~\340\325\265!\025\321ZO\276\204t\022\027}x\227k\342\333\235\006ZK\366\2262\245-"
+	.string	"."
+	.string	"/"
+	.string	"\027\300\016\337\003\260Co\366\312\273\215\375\210\212\"\004\300\356F\325\370\366\334\374\263\236q(\322\363R\260\273N\016eq\353m\017\330&\260\357\232\262\277\372\241\246_\2465\323\231\351c6\254\243\250\354V\274\002\254\013\226tdl?\355{\\\265}%\341l\027C\244\265\333m\0341\207\232\252O7\247\223\324\253\352O&\246\177\034\304$>\207#\334\312s\207\276[\330ajv\001\365\252\220\322rb)\345\313\356H\251\031\366\337\356\256\003\241Q\332\3039H0@\210\242\017\203\326\021\305\207\206\216C\364h\241\310\321\030\004\361\321\242\b\004\322b\246\333\277\325\224\027^\256\222\232|\311\247vh\224\347\254\231P\222\003\f"
+	.ascii	"{\311'c\232\200\032\006\316\0360\224T\346\300\264\253\300\200"
+	.ascii	"K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.114.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001 [\256\225\200:\033*\252\323y\313\202"
+	.string	"\035\013\373\26489C$1V&\021!e\264\336\303\036T\020\321\b\226\247*\225\314,\263A\366\3362\245\242\210,\310\203\240p\220\020\255\020C\365\261\342C\303\307!\202*Q\364pJA\204\252hQT\0257\332\375\356H]\340\330*\234E_\246k%&\322Y\323ec\273pX\253a\351<Z\277\377\257#\265.\331\371:(~i\3713fd\276A\026\221M[g\353\021\223\\.QT\363w\250\254\374Z\2471\300\220\343\201\311\360Y`2\354\325\302X\003\271SN0Lb\376G\367\341\313y\325.\261&\033aN"
+	.string	"\203\377\315l\244\341:\267%h[\3206$\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.115.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\020\001\r\r"
+	.string	"\346\230YC\020\2176\035\023\256\b\314\006\241\320z\024\231\035\003\365\333&o]\020\367E\236\026N >\275\322\372x\2646\255\0273m\0066\0363\"\272B\032pP\007\004\206\036X"
+	.string	"A\b+D0k#mo)S\nE"
+	.string	"E"
+	.string	"D"
+	.string	"\367T\366$R\310\005\306\356^\332\3010\265G\250\251\371)\303\202\353>\217\260\002\231|\320\350@\260\303T\202\371\350y\241\333\022\256\234\\?:d\221y\341\272\223gu`w\235\\\227\341\246n\333\201m\003\366A\002\020^\354\232\234f\366\2130 .\372\355\177\344\215\355\375\204v\221\205o\t\006+DBQ\332\365\006<\272\200\346\321\236\346i\277\304Mho\021\261\265\313\301C\212]\217\200/\315\343\306\003P\217\360"
+	.string	"\250Gk\266\213+\337\006ww\241\225U\213\213PvgB\236sF\214\210\217D_T\200:5\2256\205\ny\256R\001\0326|\233~l\357\223\232b\277C\305T\262\242\330o\371\255\213\356J\323\252\351\324\3647\033\226\031\022\001\031\306\311<\321\023\222\366\340P\300 \301\202+\373x\200q\262+\002\b'\344\362\300<\027\307\206;\022>\260+\353t\260k\343\355\025\305\rF|#\272EMQ\004+H\322dKU!)\024c$O\256\364\232\252.%!\266<]5b\002\026"
+	.string	"{\311'\323\260\316&9\253H\236\016n"
+	.ascii	"&\263o\t\333\200,\222j\254(/\211Z\255[\002\321p\245\247\314A"
+	.ascii	"\273p\352\225@\\\334R\245j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_timeval_sub.116.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\263\003}\030"
+	.string	"\266-\234G\260\326M:\025<_\366\035'\350U\256\337b\006\035\024\350\032*\3375\242W\374\212\1774\003oo\377\261\337\376\237\243\201v\341\347\203\371Oz`<w\316W\320f\217\337}\224Q`\311C?|\243&\215\020\222dJ\001\213"
+	.string	"t"
+	.string	"\212"
+	.ascii	"S\215I\331\320\204fQh\t\tS\003C\331\204@F!\325\215$Lb\334\031"
+	.ascii	"\360\327\005\341\323O\200Y\024r*\241\240\306\224\004\316\326"
+	.ascii	"M\246\201\363\356\307/1&Q\351\210qw\240\265\320_wa\333Z\206g"
+	.ascii	"\340\332+o\207\342\310KG\206l@\2111\326h\236\001\375y\216\001"
+	.ascii	"\375\375\204q\366\236\270\372\305\300\303\202\022Et\004d\017"
+	.ascii	"\311\227\035\ty\264\030\243\247\234EG\271\314\027\203\030c\223"
+	.ascii	"\350h\204\373\271\355\203\266\023ZO\026Wj\355\305\030c\237\324"
+	.ascii	"z\331\032\357l\001\256ri\374d\007p\r\033\200\241\334\031K\271"
+	.ascii	"2`6&\2630\231}\311\354,\263.\231\225e\266%\263,\231\215ev%\263"
+	.ascii	"\260/\033z\331\327\263\340\263_f\275\314>\263\231Y\023\360\214"
+	.ascii	"\023N*vr\304(\242\213J\034\362\361h\341*\033\312\226\362[\267"
+	.ascii	"\246\252\255\032\253\352U\324\222\026\223\030#\204\320\270:\312"
+	.ascii	"\001:&\231\263\374+2\304\265r\330c\367l\350\230r?tV^@\203{\350"
+	.ascii	"P\200\335S.\260\305\005\303{=\274{\005\322\374u\033iu\351\\\200"
+	.ascii	"\247\271\225\fq\005\331\007\374\016\336:\022\336\277\277\262"
+	.ascii	"\206\270\216\225\004)\332\006\376\336?'\272\030\271\354\252\237"
+	.ascii	"\377m\345\317H\353\211\216)\2271F\240_\251y\037\203\023\226P"
+	.ascii	"J\331!!\017\340H98\207-A\215\203\202\2070\306\350\025?\240?\377"
+	.ascii	"&\266\2424\005eW\273\003\31289<;\336\313\347v\273\301\271\300"
+	.ascii	"\263\023\372\030\204{6|\340\311\271\201\305A\020\301\202\203"
+	.string	"\n\265\236\234\f\267\233\236\332\216\206\033\0165\234\033O\r\001\255\266\0169\267Z\217\315v\253\305v\321Oj\326\326CX\212\254\2464\021\317\274\310V\206)\t\t\221\"\213E\3266\240\314\213\332\326\234\026\364\\c^s\303\374\3451O'C/\206\300|@\220\227\337\307\023\214\246\331\261lJ\210\232\270\\\366\331\314]\376U\221\335HK\226\264\034\210\316\003\017-F\212\0205ay\354-wD\250Q,\347\0302F\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/!D\020H7_\311\227Jb\206\221M\263\237\234\321\32543M^\361\234\310\016\374[>\302\261\245\2111k\027S\235\224ai5\313+\337\310/$\007N(s\246H\274\021\035\177\002(K\300\236\373%\207!A\2100S\377n\005I\215I\242l\201}\334\032\2557\371\333\207H\207\347\032K\274\2661\212|."
+	.ascii	"\2211\255l\310\212n\177\n\002h\235M*\025m/i\335\226\340?"
+	.text
+	.section	.gnu.lto_servoDevInit.122.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`C\001\305\016"
+	.string	"6\033dG\360\262&\035\262d\303'/U\213\335\315\211\317.\341\022Pk<t\346\2175\366\247\031\344\264 h\264\253\002-\0026]\340\265`\303\232\240\232\374\033\320\327\377\244\310\177s\3708u\037\203s\t\235@M,\331d\313\224\002N"
+	.string	"M"
+	.string	"N"
+	.string	"\336q\361f\357\032\341a\007\266\273\2344\341\355\231xg\372}fR??\347\032\202\006\370j\205.\237\031H\346\003\016"
+	.string	"a\207l\364\323#\"&\0045SAs\371\325\265\206K\347\325\ni\256 \007\273k\205\tA\334\332m\253\330\036\261\337\022R}\320\004\236\231\032\230\206\236\335\231\021\310\336\2303R\\u\373\242\277r\310\n\026|W\261l\213\003j\271H\370\354\212\b>\335`\373|\310\366\325>\213\267\370\356b\303\003\354\332\330\210\261+&0\267}Z\374"
+	.string	"\355s\273"
+	.string	"\355\323\237\003\261\361\245\006\324\321\177\247\331)gu\004\030\330n9\214\013\242\034\273;z\361\035\223\217\342\323\030V\3640\237\376\212\366i\340\206\007JG\253\274\374\352\007V\360\200/V\020\224\216R\262db2\244L\331\242\213\216~^p,m\354\253T\267\006\031H\024J$!'(\025J\335\203N\305#\231B6\021\201 \201$\002w\"\235x%'\256\204R\222\302\231x&N\244\200;\013$\217;u\235\307\205\304}\316Gz\224\210\371\240$8e\312\242\226\324\344<\241\216Q\037::8\350\217g\273\273\231L\235ES\251\311\303\002\034"
+	.ascii	"\200X{\311\027\323\020\232\253\266v\211\205\274\214\276\253q"
+	.ascii	"\322\022\013\364x\035\306\021\033s`\232\002\233\006aZ\202v[\342"
+	.ascii	"sX\341tq\306\305hV\247\203vqXD\331\253\253f\364\f/(\312\257k"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_motorPwmDevice.123.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"U\006"
+	.string	"\224\n\321"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\203\354\230\032\002\177}\370\347\230v\177{\270\347\230Zyw\370\346\230Tus\270\346\230pqo\370\345\230vmk\270\345\230X\177i\370\344\230Vqg\270\344\230\226\001ec\330\337\030a_\270\337\230Z]["
+	.string	"\005\001?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\bA\277\177\306\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\r"
+	.ascii	"z\311\002K\265\r\363\236\211\337\006\257\200W\300+\340\025\360"
+	.ascii	"\nx%\346+h\276\205\201\""
+	.text
+	.section	.gnu.lto_pwmGetMotors.124.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\262\314.4Pm\222\016\004\210\022z\"j\3204bVl\345\235\27757|\376\305\262\265\273\25556}7\322\330w\206QS *\254;x.\n\257\314\354hb\t\221)o&\004\205\203\004hq\026*\215\005\035\0304\rpSA\300)3\365\300\251\240EQ\025\304\304\254\023}\310u\311\3744\273 \215\021W\243o\211\2535\353\273\227\324\227\371\270\211\217\236\346.\276\226t\242opT\223\223\314\212\025\225,y$\034\177\3471\267\243\036\2351\202\230\021\n\030\331\240\020A\311\214\360\330\001\251\357R\001\251\317a\024k\303n?j\031\245\254d O\033\200Af\3362P\250\273\376\005\377\364[\004\t"
+	.ascii	"{\311'\323\342\255\243c\205P\\\023\253\021B\013\221\211\273b"
+	.ascii	"j'\031"
+	.text
+	.section	.gnu.lto_pwmConvertFromExternal.125.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\275\007"
+	.string	"\242O770q\222\016\200\250Re\300\034\250\254Yx\322F\f\034\237\243\017eW\257\316\326n\325\246\246\253\377>\332v\f\016\210~\224\221J\352!J\215\341\\\317\326\266F\210L\001\031\205\bs\020a#-\333*\262\200C\240\205\006\005\206\270e\017\032\266\305\021\004\026\021C\332D\004}&IdZ\334H$-z\376\273\254\22505\374\230 \306\205\0176c\306\364V\337\225\036\364\370Z\231\231\303\324\303\367k\327\326*\250\211\261x\311\334X\335$\314\325\"\362s\357\371\337\373\2424\205kw\361\225\331\341\302\222\331\035\034\001z\t\274\377\232\364\204{\225\325\201\204tT%\032+4\231\031?%\340\364\262:\300\351\005?\312\365q\267*\265HldN\250R_'!3\177'\024G\207\375\r~\204\177$\b"
+	.ascii	"|e\301\2319U\260\227\256\321\034\230 \340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_pwmConvertToExternal.126.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"\362\21656Po\322\001\220\354L;\034| =\006^\344W\021:\362j)y\265 \334\032\362\006C\206Y\261 \324*\3017\246\206\251\201Q\3514`u\222q4B\366\226)\005\230\205\304\365 c\026;\032s6\f\016\013\r0\303 \344\225\301\211\210\253\0039\262\002n,G\nL\302,F\t=\367o\235\310\316\3728\f\337\251{\206\313GO\366\364\250\373\260\377vw\355D\326\317\377\317\300\003\346\"ew\343d\332\027jed[\263\005l\253\33279I\373t\311\001\273,-*\273\213`\bp\312z\266}\222\227h\336t\206phF$\r\224\230\335\t\007^P\235\322\023T\247\034\310\267\353\346\377\344o\304T\002\205<\327\214\302\356ZA\241\216\333\335\366\201\355\004\333\"\001\n"
+	.ascii	"z\345+\303\n\316\330\360\224e\\F\2314F\007&\b8a\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_pwmDisableMotors.127.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\302\f06@o\222\016\270\225\020\036\354\237\361\360\271\206\306B\022"
+	.string	"\221\003t\253uw\233\352\377\r\217[\335T\024pf?\256\376K&\321p\3371Bz\"m\314Z\373\204\310\024s*\004\205\203\204\210u\026\256\r\026\035\0306\r\221sA\304J`\353\241sE\314\262\256\250\331\262pDu\\\307\205`\305\327\203\371\210\216x\002P2\223\340\212\264$q=J=\361y\325J\335\017\246TA\351##\204%\364N\277\201\036\334\370^\022\216\036\266\343L+\024*\231\027\247\226<\241LH\1775g\237\322\255#3\244\022\013\022SfF\310\321\254/\273\005)\200&\002\365e\f2\363\247\2110:\354?\360W\277F\t"
+	.string	"{\3117c\361\2063^\307\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.128.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"U\007"
+	.string	"\202M37Po\322\001\200\344\2628\b\333o\274\206\226w\261"
+	.string	"\255A\210\036\004mY\266\033\315\332\244\307\213\030\200,\236\331\212\252\342\342\272"
+	.string	"N\034\001_3p\206\204l\262wJ\001\326`\n\f\t\013r\3334\314l\223\017\016\031Gjf\204\304\002\254Al\246\3344m\312\253\356\251\205\"\327sL(2/\037X\341\237V\266\304G("
+	.string	"\313\356\032\370\"\037M\370\035\217\246\350\274\203\036\375N\365x0j\301\b\211\371\274\223]=\017j\330\247\026\212lx\023\251\004\303\235\354v\247\231%E\023\017\333\234}\231\240\2003}\345\350\254.\305\202\244\264[%\3348\375\243\376A.\360\341\242\262R\022\362\374Y\b\273\353\007\n]\334\360\266\007lc\2663\002\t"
+	.ascii	"{\345c\230i\223\331\004p\260\30651/\0023!r\270s\257v>\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.129.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"E\013"
+	.string	"\006\027P?\020Q\225\016+\220(\007x\272e\360\303\302W\262\177\200\224\004\3517~\317\244"
+	.string	"H\216\325\\\324\204aB[id\004y\b\023\2004\206\013\"\005\242%\323H\221f\214q\320\330H\320&R\246\024;"
+	.string	"<"
+	.string	"<"
+	.string	"\207\316\264\013X\272\257*Xw5\240\350\330\375(\216\331\241;\033\306?\324b\252\217\022\211\031\273\033\225\303\273g\347?\304#\236)\364\304\020\354\256\3233a\270\365\266\t\330>`\177A\253?\373\367cW\032f\372\322\264j:\257\3647\006\250pa\201c\367B\213\306z\300\024*\333\227\330\326\264\377\341 \272\177\346pd\227\305G\307\356Rl\311\016'\027"
+	.string	"9\274\036"
+	.string	"\022\233'C\025j\262H-2\275\364\254R\215TLUO\3520\312\226\257\251'\305\270\210\217\340\370)w>y\357\320\377@\016\257\330\013\226\207\f\242l\331_(u\203\375kw\327z\262\037\332G\302\005\004)h\0176\031hLEA\203\004\f\242G\203\300]<q\223\271h\"\206\353\304\312\304\333\004\215\213\236m\343\242\344\333\353\311\016Vx\210td\250\266A?\301\001\200\332]\003~\211\233\210\340\247\016\255\331\002\016"
+	.ascii	"{\311'c1\347\315(.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\202\013\033\204\n\023\301\235[\264\363\t"
+	.text
+	.section	.gnu.lto_pwmWriteMotorInt.130.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"\205\f"
+	.string	"\366\330VA \221\222\016$\206\246\202\203\304\213\300\"\245\366s\254's0\345\263n\226P\351\022\013\312\242jUX\307\234\232\206\212\320_\177\311\n \032\300K`\024\376\340\206\"\034\300\356\304$\022B\266$R\246\024B"
+	.string	"@"
+	.string	"C"
+	.string	"\004\334\025?\300]\215h+\370\320\316\302\301\271+B\306\214\335-\201_u\265f\277|KYj%\207\t\013\036\273\373\262\304\265\243\346\277\345\326\350\304\303\221j\260\273\306\321\t\210;o\373\200m\006\366C\001\016m)\272R4\345\320\356,\377\364\355OD\243\242\177\025\200\271\321Af\367C\251\307\272(\215\025\333\367W\234Tr\025\226 s]\355\022\373\272\376\262\217\342)\264o\032\254\273#^>\252\253\200\007\"\356\372\321\216*\255\304\030Q\r*\237U^d\"\204%\273\244\362oq\027\035_\305\031\t~t\365I\334\325\345IG\200#\346D\210)1o2\223\371\0040S\022\301\200\260do!L\022\366\247M\024;\330\005\n\033\f\232\001\2330\302Q\203h\036Dp"
+	.string	"\341}\260\020\317\346\363F8\233\316\003\361Xx\032\003\316*`\236\367\3112\317\2736\320\247M\024\277\345\225\r\035.\240\f\331\312\223\354\r\217\321\t\220\262\273\013\374\027\207\021\342\253\\\315\021\t\023"
+	.string	"{\311'c\372\220\032\026nK\021\271\231`\034\330"
+	.ascii	" $q\261\r\246]\256\341\3375\001\201F\221#\322\024n`\252\251)"
+	.ascii	"\205\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.131.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \376\335\006"
+	.string	"\302\314/5@o\222\016p\215\345/\342\302\243\230>`\272\260\265\004\200\205\335k\335\335\246\372\177\363\271\335ME\001g\366\343\352\277d\022\r\367\035#\244'\322\306\254\311 D\246o\250\204\005\004\205xq\030,\315\025\037\0324\016qcEDj\340\n\202c\305\253\252\254\230\321\262O\004\267\322\212\t\364*\276\235\313K\224\324\0218\311\314\202\033R\221\211\353Q8\205\3075+\274\236K\241\001\311\224\001\242\002r\333k\037\3676\276"
+	.string	"\371D\377\272\225N)XI\346\305\326\222&\220d\36473\366(\325:\0223b\261\0309ef|\034\305\352\260\333\217\006d\241O\035\346 3wY\b\243\277\376\004?\365k\004\t"
+	.string	"{\3117c\361\2063^\307\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmIsMotorEnabled.132.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"\225\b"
+	.string	"\266P<70\221\322\001#F\211U\2468QQc\255\345C\r\307\347\236\f\330\225\200\216\333\206\2337U$*\251\333G\026&\t'=@3r\355M\311\026\303\013?\320\336r\247\024,"
+	.string	"*"
+	.string	"+"
+	.string	"FP \231\373\\\241\316z\235Tfv\247\324\221s\177\234\177\223C\204t\254t\251\322_@\303\356\372u\251\217[o\333\300v\202m\227*\333\317\360\255\377\351\363#,\3618\214\314.\352E\263/\261\205e\233dol\353{K\303\272\013\342b\331\235\007\226\002\217\266\003\273\273`{\343(\027\004\253\335ep}\212|\222Gc\214\336\273G\177\004\360\bu\340\344\351\365\247\032\323{\331\263\364T\304>\\\r\031\330D\b\024\375\351<H8D\310\r\243\320<\233\f\201<\025\362\243\211d\207\343\314\002\323\344\226e\232\334\314=\\UA\345\230\224\303v\366\024\256 &\013"
+	.ascii	"{\311'c\232\373\206A3\366\266i#\260\3125\274\004\213g\2068\323"
+	.ascii	"\363\240\251\235O"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.133.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\267\003u\026"
+	.string	"\026(\212I\300TU:\330\222\016\006\253^\036$ \261\030\307I\310\022+\300D\030I\256ug\333\325\334SO\272\263\357\373\260\005A`\335)G4'"
+	.string	"\200\244\360\322\351ZPl$w\301\\\302f~\313\366}\337\367\2274\262\267\2242\005s"
+	.string	"h"
+	.string	"|"
+	.ascii	"3\310ByT\177\325\236\237\256.\364\005Ny"
+	.string	"\036\304\352\241^\242\"\235\233\242\356N\321\371\330\250\363?=\021u\216\372\022u\036\367'A\231\351\034\002\235\032\032\237%\335\035c\024\212SqJ^\334\325\344\313\2518\222\320)\t\340\2300R\371f$\354\207\220\206\267r\204\262\312\267\223\260\356\326\036\335\032\237\314.i\245\273\277=\237\b=I\377\323\376+\370\345*\272\035J\316\331\356\3161\343\334\203\250|\001\006\222\335\036\275\264\260\326\232\370s\210Y\355)k\217\266\200C-\204;\316\375\277\334r\316\257\262\031\347W\036\375k\356]r\337\342=\213\367\253\335\253\344>\305{\024\357O\2737\311}\211\367#\357I\273\027\345~\362^\362\236w\277\272\327\001\250\0246|\372\341Hw\210!\223\026\006A\200\250r\354\004S\354\243\007\017\024\247N\2142\361)\207\352\020Z\275\220\250\323dT\342`\020\216\221K$\036E&\035\320\237\033\"\320Np\362\177\025\255q\240"
+	.string	"D\247\2404*\244\210\272;\001PgX\220\315f\242N\016\322S\"y\262\3224y1\263d\345\371\220\331\341\227\231\247\020\257H\267C\003*\2036v\367\202k\f\365q\271\252\320\371\027\230y\205\021u.k\211\233\037\243`4\f\262\031\313\255Cm\374L\305A\004\006,\261\033\315\305&\273\3054\274\3102\304f\266\230\230\n\354\265\r4[\354V\253\331b\247_\253\354\025\035\313\210\027\260\177\203\007\253\2753\347\364\350\304\02089\347'<\233\025\354R\361l@\354\203\364\350"
+	.string	"v\335\272\002/\256IQ\027\312\352O\215\264\214\335:\355]\211h\021\b,-\253\275\026\t\023V{.V\340\320\216\026\017\021\naqk\305,\025\257\002K\250a<\344\021\n\204FF\302\004-HA\216\001\300\002\221\221\272y\021\0209g\230\311`t\317;\221d\335*\002&\360c\2577\361q\3068\032\274,\272\240\034q\n\375\233\350P{\237v\275I7\363\007~\316\212rJ7\242\311\202\025\251\006\221\001N^"
+	.string	"\335n\211\236\323Izj"
+	.ascii	"\355\220\006nA\300$\034p\013\230\275\004\305\351\202&\025\334"
+	.ascii	"V\333F\206\013[\004\024\305\312X1?S\236\334\264\003\307O&\310"
+	.ascii	"@\361\327\236j\341\220\221y\256vg\005\273\274\202\002%=n\263"
+	.ascii	"\320T\353\222\225[G\251"
+	.text
+	.section	.gnu.lto_pwmWriteServo.134.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\355\t"
+	.string	"\006\324F=0\305*\035\236\213~\334\364\341\262_\374\370/"
+	.string	"_\235S>\242\245\352?o\r\274\005\224o\266\206\331)\321\312\020w\234\301\260\241\370\342\306\250\302z\233\177\312FyC\335\307o\233l\231R3"
+	.string	"4"
+	.string	"3"
+	.string	"\034\216\273\".\331n\330\361\314\\\372\263\013<dmB\353$\005;\260\2733\222\374\273~\376W\256\001U\247+\306aw\255\240*\344\216\267\255`\273\301~A\252>fk\241\234"
+	.string	"l\027\244\206`g\262\305\304\3667\266\243\332O\271\312\367\3201kv\001\004\220\355n\307\237\314%\347\b\227\313\355\007\227K\253\332\013\237\357\256\f\376\353,\030~\311\245I&=x\351\233.\227\007\rlQ\243\322<\004\304\370\210y}\304R\tPZ\263\303\223\306\021\373\333\306\225\375\360\337\356\372\343\246\326\234\251\002\224!5\270\211\221H:\344\201\220x\210\230%\216\302\003\225\346H\004\262\230!\2174=\034w\027\2347K]\347\315M\270\3376\256\234\031@\233\241b\2075\332\3368\2543`\355n\013"
+	.ascii	"{\311'c\032\202\032&\234\301\027\343c\332\345\032\276\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.135.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`c\001e\017"
+	.string	"V\034hG\360\222(\035\260\361\341\272\246\366\315j\346\315\274\033\252#8\346\017\2259T\222\334\230\302\224\035\004\203\006\332\377\327\035O\326Og\265\264?\266\310\346\020\246 4\325a\246]\346zx\307P\262\215\001\"\214\020B\266\224)\005Q"
+	.string	"T"
+	.string	"R"
+	.string	"\005\fz\337l\373,.\243\362j5dh\215\030\211\231\261\362\2426\347\bz\374"
+	.string	"\356\233w\001\334\267-\261\322\325\345\352\312\377d\254K\357\303W\036\330\021\242\205\210\314%=1\0334\237]Yd/\325\0164\347\264\302d\036\356\355\266\027\3306\261\237\"\237\371=\251\356^\363\313\333\374k\265v\352\207\204tb\035d\347\240c\316\330N\220Yc\213q\302\266\312\366\3307\247\217\004\\h22 \030@\240\272M\352\237\351\312\301i \307\323\250^\243\242\237\371r\271$\360\276}\324\252\237\301\360"
+	.string	"s\276\324hs\216\001\242\221\036\366\355g\007\275\226\345\335n\255+:_\037\3470*\370&L\022\365\260o\276\310};\214\207\334\257\202\026\037.p\314tZ\272s\003\005\b\332.\214\345S\334n\313\206\025\"z\344\320x\351\017{d\351\302"
+	.string	"\251\251 \341}\261\255\376~\363\003\b\244\013%(a\250\244r*M\bO)\021T)\365\205\247\224TI\230\20222\371D#\n%\221\201ID\211$\217C$\017$8\210"
+	.string	"\242B\221\351\004\005\226F'$0d:\201$#\026-\204&\020%\212&\3203\316\313\22519f3\365W\234.\313\032\324Z\227\f\321n\355\035"
+	.string	"\353\314c\257$\037c\033\214"
+	.ascii	"\232\300\264\336W\231-\204\355M\f\355\030j\035\231K%E^7+~\226"
+	.ascii	"U\256\231\001\2110s\023 (\t\256\360I\022\346\222\020,\b\237\251"
+	.ascii	"Q8v\204\346\214\237.6%4\215AA\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.136.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375 \374\375\006"
+	.string	"B\21516@o\222\016\230\016K\\\252\2258\b\034\005IFW\334I\271cMPx\3737\267\263m\351\002\230i\233\345C\356\264>\001\236\331u\314\364\007H\322\370\335,!2\005\022\027\206U\020\226f\313\303\340\260\320\020\267\353A\253\266\210ET\023\321\322*\242\207sFqiq\3132-n\272,GqBP\364\035\350A\220o&3s\370\361/S\312hKJ\246F\fL\262L+\"\377\3477?|op\360i\211\3050\323\003E%\263+8\002t\372\357HI>s\235\213\020\250S\032a\234\274dv1\240\003T\247W\001\252\023\f)\327\307\335\232TA\324\3412\"\201\3724\t\231\371\033\2216:\354O\360#\374\034\001\b"
+	.ascii	"{\311'\323\"\030>*,V\001\305e^b*\214\351\232d"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.140.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\205\f"
+	.string	"\206\226VE\360\2624\035\302\023\214\016\277#\327\342\307\331Q\202\315\006\025U\237\216q\210\215d\037s.FR\375o\214\\>\333\365\324$w\333\2566h\220.I\247\311Y\213\2360\355\275`\342\214J/B[\315\272\021)S\nB"
+	.string	">"
+	.string	"C"
+	.string	"K\340E\nE\203gw\243\256\370\351V\245y\362C_w\013\024\363j\201\211\03378j|1\327\252"
+	.string	"\352G\013\001\337Ke\200\247\3139\315\363\303\347\222\371\001\331]\247\367\215\270\257\333\226`;\202}R\237\261\207\225\274w\313_\271n]Os\004)l\364\244lJ\264dh\203]\252\n\373\032\206ah\225\261\237\316\247\3779pb\247\346=pvC\204=\253c\345\270\260}\221O\266\216\203,\002i\227\230\250v\337\211\301cG\005 S\261\017\270\024\3745\237\261]'5\263\013so\003\b&&\270e\253p\310{\306P\332\311\350\220\252\037\016\212$\001\202\020\241f\271\256\027nr\274\244\017\3736\207\301\342\016e\331\b\004\214\301\b\303\020r\262q)\232\206U0)m\032PF,8\020i\220\205P\030\271D\312&<\020\211&-\003Gb\212(%$'\261\304\251D\022\346-E\343\242i\333\270(\002\367*c\220\026uy\265\273k\005\b\025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.141.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\227\001\025\020"
+	.string	"\326\234jH\340\222*\035P\032O\n\243\313\261\263\016\362\251n\353\227\354\n\225\215F|F~\255\0019+\315&p\205\216\306Q]\214\316\2571\3207`b\210\232\205\326\271\374\022  \306\315%\237\032l!] j\270P%\233\310\235RV"
+	.string	"Q"
+	.string	"U"
+	.string	"\266\363"
+	.string	"R\253\210 ?j\016\305Ya\373\037\267\354\035\307\315T\004\265\033//vj\255\341\252x\353\364\333\331\362O\363"
+	.string	"e\214<\365\300\374\013\211\301|\277\002\262\334n@\354\3659\330\325J\234\3463D\314eN"
+	.string	"\020j\255\236el\304\r\336v\005\333%\3738\002\264\030\023\340lp\3376\300\257\315\301\303|i\221\233\233L\217\007[r\356j\262\031\353\026\360{b\243\3435}\330\277\335E\213O\363\007\226\371\362\324g\001O\277\024\205n\026s#\341\232Al\03497\205\375\257\356\314\376\364\367\351\375\364E\026\234\220\021\026<0\222\320\351m\307\271"
+	.string	"{\211\301\003\013C\247v\211IN\217\007bI\277\346\272\222Lg\247\007\201\371\255m:\275\226\314=\220\351\264\0200wg\255w\r\360G\001o{\214\224\201\231Z]/\375\233\303@\371\264S\247\244R\340\251=n"
+	.ascii	"\275,i\263{]VA\235\210R\243jE\024?\016\t\255\030\204@\032\304"
+	.ascii	"\016\246\025\310$\3454\2162H E\030\215\224$\360I4*\221\220B\226"
+	.ascii	"\210\2422\261B\025\224)\025\236T\253P\004\362\270\"\252B\326"
+	.ascii	"8\252\302\017\256~g\036\251\221\351\361\\\353B\025L{\002\205"
+	.ascii	"\275,\267c\361\035\230\267\235\006I\224## `\2021e\311\003{\362"
+	.ascii	"\211-n\233\201\302\301m/\270+\347\272p%Br\214.\t\320*d\023\261"
+	.ascii	"\256\003k\270q\020m \016\327\r-\033Ih+\377=\342\255D`\333\274"
+	.ascii	"\021on\251\302\270\322z\200f\270U\017\177\034w\226n\331N\033"
+	.ascii	"I\2156C\001"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.142.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\252\001\r\021"
+	.string	"f\240sG\320\224M:\023"
+	.string	"`\372f\302i\257e\250\270\f\3158\221\342\004\020e\225\354h*\263\303\367\340\317\255m\333\232\374\337-\366-\013P\340\333\002\350\305\214\304$\255\201+\2301\311\0025\364\201\342r\313\310j\262\267\334)\005^"
+	.string	"V"
+	.string	"`"
+	.string	"\006M\266}\025_\221\343W\313,\366\255\240P\342!2\262\013n\250\247h\237\362"
+	.ascii	"\264O\035\361\327\265)5\276\374\013\375\201,\210\207\367\301"
+	.ascii	"\256\225|>\237&\237\313\223ov\372t\242\312\224\236\022\336\311"
+	.ascii	"7\223\t\202\324 r\241G\f\237,F\022\006\273\353\350}\033n\222"
+	.ascii	"\333\226\261\235\262\257#C\177q\301'\361i\226+\336\373\364]\332"
+	.ascii	"\347\365\204\004\242\b\317R,\2066\b\213\nd_\3030\f\255?\366\301"
+	.ascii	"\177\312h\251\321\252\321Q\243_\"Sdx\217!\273=\241\322\036M\033"
+	.ascii	"&l\347\330'\3331\332g\361\0269\007q\216\262\373\223\203\306."
+	.ascii	"\250\300\233\3513\b>m\030\0165S\230\247J\325B\004\025\251\206"
+	.ascii	"\244%\244i\022\247\3324\026\342"
+	.string	"=K\205\331B:\300<H\005R\0251\243\346F0.cu A\273\273\362\031#\356\336;t@\222i\217\243M\215*\340\306\316\007Y\f\037q\314zN\250\002y\352\265\302\220\221N<b\237\310u\300\307n\354\236\037.!\300\315\330\250:\224\314\n\325r\255P7\006(p,U\327 \325\362\302\342\342`B\001\026\213\353bbXR\334\214*\202\211aT\\$@x\331Z\334L\247jm64\252\232\r\246cm*(\257n\270nk\255V\335v\002\367r\365G\376\245\375\350\007\207\243\230\312\344\356\256\206\022\245\336\305\213R\001\202vw\356\251L;\013\002  P\202A\310\322\003\261\203\333\225O\332t\270\f\003j\251V&\2261&\376\353\013n\205P\026=\301,\002\2650f\b\311\034\300\312x\002\026\216\300\202\230\013\202\340A\213\317\330\235nv\207\013\362\023\202\326 U\322\307\325uC\272oT\333"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.143.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\270\001%\021"
+	.string	"\366\240uG\320\224M:i\0032\211b\205\277\322%\n\026\265\242F\b\302\002\021\2113\t\n(\036\200\257\303\237\253c\333J*\321&\360\264\202\366\333"
+	.string	"\327 \302[\253\033+s\004\375N\032\355\215"
+	.string	"\177uXH\331\266\275\311\226)\005_"
+	.string	"Z"
+	.string	"a"
+	.ascii	"\227\016Q\266\375\024W\241cWK\f\006\256\240"
+	.string	"\370\361A2\262\033n\251\243\314K\355\004\346e\034q\327\247\324\242\272\374\313\016a\247\250\310\007\276>K\300\240KT\320\265\0230f\002\362h\324P\200J|'`LS \244\006\221\313\256\035\300\035\325\223\203\335\265~\240\207\373t\3334\266c\3543\005\322\031X\372\357\322g\315\313\307\323\022\321\314\247\t\2463;|i\034\262\037g\263\331\314Q\310\276\321\217z\370O\251\226\232Z5\365KXn4\031@\332\005\232%Y%i\303\204m\035\333\304v\324\033m0\200\335\020G\030\250\332g\361\026:\0179\\\300\256\220\216\244\335p\2017T\r\022\\\332\234L*\026_\236Q\306\223\210\"&\307\037\037MK2\200\242\342\214\366\252F\377Y\306\227=\344\303\013\204\246Q\177\310z\314\270\360#\"\030\227as\032@vw\3452\206\356\336;\346\245\306\211\343\232#\006t\"\306!\317\370hA\306\203G\221\330\177\301:"
+	.ascii	"d\027\366\317G\272\213\316'\361.A\240Z\335p^\212\246K\265r\272"
+	.ascii	"\024N\n\314\214\327Q\260\341\274U\347I\210iyy\340\302R!E\225"
+	.ascii	"\203\201\323 \275\231\031N\263\214\212\313\204\b/[K\265\362\270"
+	.ascii	"\326vS\303\331l2\036kSI\271\303Qy[\253\353\274\315$\334k\033"
+	.ascii	"\205\264\273\346\225\202\254P\202\305\035mww\016P\031\177\364"
+	.ascii	"$\230\002D\273=\377bP=\001  \240\002\0312\365\273\363\3112\375"
+	.ascii	"\036\303\203,\325\312\004e\234\307;\006\203\b\267}\301Q\032\212"
+	.ascii	"\317\2078\253\230}\026\013!?a\017\213\370|\330i\317\006\023d"
+	.ascii	"B\226\215\020\030\376\273\202\240AR\322\317\325\265\206\264\334"
+	.ascii	"\250\266\006\n"
+	.text
+	.section	.gnu.lto_IOConfigGPIO.144.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\025\t"
+	.string	"fQ@90\221\322\001 B\371*\241\235n\346P\032s(\202g\216\366\321\240\256\2654\306GV\340-*w\357_\313\316P\245=`\256\261\212\362}q\274\013\031j\315\347p\373\275S\n-"
+	.string	"."
+	.string	"1"
+	.string	"r\373\200\347\322\237\215\363j\262\005+' \262\234\335\235\261\344\337\341\347\037\346\237\027\314u\030\360\260\273\206/\230\310\035o\373\3006\311\366,6\273!;:K\2235*\266\017\262\035\241=b\370^5\034wGfF\207\366[\356\362\375e\343\002\2731\026\232\335\272\340\271]\272\236\300\3634\216\330\341\017\364e\324Vx\314\205\035.Y\333G\003\302\245\215\221\001\377rB\355\206\346\021]vu\301Hb\037`w\3271f\307P\212\f\354(\001.q\022\020)\025jEI%.\224Bu\221\252\240;Q\004\00571[\247\224gj\315\225\312T1;\2175E\006\246\026'o\266(\365&\250\356c\314[m\026\013"
+	.ascii	"{\311'c\361\201g\300E%\317@\354\032\004\025\306\005#\002T\024"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_spektrumBind.145.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\245\b"
+	.string	"6\220=90\221\322\001\200\003\332\327\241Fi\207A\023b\237\222M\231?\f\210\327K\263A\220a\023\226X\320H\217X\321\306\"Zp\241\322\327\222\351\360\256I\231\262\301bs\373\275S\n*"
+	.string	"-"
+	.string	"-"
+	.string	"\237\376l\231\207&[\200\222\002\342B\263\273T\226\374{\374\374\263\036\200J\201\217\035\206\335uD\245Fny\333\007\266\037l\267\002Re\313\317*$\365\223\227]\221\033\233u\315\230\225\307\366\243}\225\257|g\331\270\300\256\212\005\263\033.\230b\237\016O\300\371\304>\300\tRe\354U\343\342\220\035\356D\277\245\263\025\336:9\364y\201}\204\020>\355\f\215x\224\023^3.\017\t\332!\030%\211}\200\335]\007\246\330\264\206\322\251z\026\231\251\373\220\264\212\215s\300\250\230G\240\210\t\b\t\352e\244*\362\350\246\211JtT;\n20g\312*\3658\256RO\270\017\n"
+	.ascii	"{\311'c\261\204g\300E%\317@\004\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_unusedPinsInit.146.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\007"
+	.string	"\022\21515PO\323\030 [\312\247\023n\226\266\265j\375\206\002(\022\037T\021 D\2048\357\335d\354\223G\263(- \356k=*\357 \2403R\021\207\315\203\330\275e\nc\324\354\\\223z\220\230\256lf\004\1778\016\021\035\b\211M\023\226\007\223\223\362P\310\217uI\216\301U\305dI\254\252,\271\361V3\033A\032Q\310\247\0217\006\200+K\366\n\032\262xA\245\013M\207DP\35112\240r'\210\272\217#n\357m0\216\274f6\202>\016\244\234tj2\332\375\030\305\354'\271\240\374\272Y\373\027\365J\266@%\344\321\002\263\2732\222\250\246P[uE\005\270nS\030\320\260\273C\256\003\321\243\376\007?\303/\022\n"
+	.ascii	"{\3117c\232\363\206\305\241\025y\256\347B\356\026\354x\031\002"
+	.ascii	"\\\272E;\237"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.200.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\r\013"
+	.string	"v\323G@ \307*\035\220\b|%\272\266\330\023dF\340<\355\371?\301\0272\27192\207%\fh\022\242_k1\256\fL\214\025C$lT\022\360\213\b\250D\245\375\321@2\361-\356\233\310 \233\354\235R2"
+	.string	"4"
+	.string	"7"
+	.string	"\366\311\266}t\355\312\242m\323p,\312\341\365\3411[\260\273\365t\232\\\374\224\234\350\243>/!\"\227\b\347\016:\273ko\344\246\267\335`\373\301\276DKB\r\244\034v\373\260\223\0373f<I\315\270(\253\217\306\234z\345,\342[\\ \263\264\225\265\333\213u\333\335\315\251\253w\352\361\n\335\251\367\204\356\364*\016\037 \372F\243\356\364\262\0070y\273\251\331\001\220\374\223S\227L\362\252S\337\224\241!\257\362c\277\213v@A\307D\311\331\362\344\316\355,\261\247dm\022\354\2024`\020!\213\017\310\023\226>\317 N\304\004\204\247\206!\n\360\023\326\213\212\217\250\202@R\3450\370\303\b\2015\374>\260bl\313wRsc\316\226\355\213\314\334\b\272\313N`\264P\023\020\033"
+	.string	"\177\311\017s\024\213@\266@\320\2010\220\t\030\330Q\371\r5\326e\332\002O\0012\2279YcBg\255\2241\320\342\250UK\021\\\301\214\244\352\022\254\356\\"
+	.ascii	"8\361@\216\226\246\237P\306"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.part.0.210.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`A\003=\030"
+	.string	"f+\231G\300\030Uc\360\241MAQ1\262\364\304^\213\325\323i\231\267H\027\252\373v-Wgf\356\002Q\037#\222\t\307B\022Km\006\345<\0060@\360\214=\234\212`\3271*A\326\344\301U\352"
+	.string	"\350Pk[n)S\n\201"
+	.string	"\205"
+	.string	"}"
+	.string	"\367Gg\222\33289\264\363\360\371\314\275\031\r)\336{\"\2705\252tk\177\307\3145\001g\r\025\272\3538\220\346Z=A\3026\343\364+2\361\303x\357\211\272\365\371\232\362\266t\232\362\266\3220y\362\274+\255\335\222\225\2265\237\346v#nO\374\203\333O\226\334\216\305I\022\346\b\307\213\230\035\216L"
+	.ascii	"4<\372\320)\212\235\215\326\227\337\212S\232\227$\235{\257K-"
+	.ascii	"n\322m\177\260\315\301\256\027\002?\307-7\206Er\343B\277\217"
+	.ascii	"_\310?<i\3377\362\"\376\220MB3\353\212?B;\022'9\341\316\273#"
+	.ascii	"\005S\030\201\306{\257\206\322\355\211<M\331\343~\217\231\377"
+	.ascii	"\343CN\264iH\304E^\027\267r\002\211\210\270~\022\340\025\201"
+	.ascii	"D\023JBf\017\002;\331{c\220@.\244=\b\214\316\\\334\215\347\240"
+	.ascii	"t;C}<(;\215\250askK\037\224\035\300\275=#\203\022\3156\335\322"
+	.ascii	"\237\306\311\231\235\001\256TJ\233\347\344\240\264\276\242p}"
+	.ascii	"\245X\202E8\252\305\265\222\225\344\304D\027\362\336{k\365\331"
+	.ascii	">\360WZ9\030\2458\226\340\335\350\321\277\253\264{\316\3045@"
+	.ascii	"\201m\021'R\311L\271\367.P\362%\035|\033\267^\265\350s\267~\253"
+	.ascii	"\274\375\320\r\004\t\241\360\200Wl\364\350\372\n4<\372\321\352"
+	.ascii	"s-k\357\b\007P\321\265g\233\332\222\324\344\317\277\322\013\335"
+	.ascii	"\207!\177G\031\336\275\001!L\036\026\204\025\b\t<f\212\345\003"
+	.ascii	"cY0a\262\030\023\346A&\301\364\300\243\312\360\322\243\332\300"
+	.ascii	"2\305X\262V\203W+\326Z\2758u\023\241\002\004\n\250\230\331\363"
+	.ascii	"\332\211\241X\252\235\025*\365\202\241nNn}0_\250X\253\365B\231"
+	.ascii	"^{>\361\001H\233\265\032$4\362\200\367\332\236\263\266Z\307V"
+	.ascii	"o\266\3720\\\212\021)HX\245\311\355\f\217\342\202r\235\013.\306"
+	.ascii	"j\357\374\211O\315\213\356$e\326j\304\027\220!\234\302\333\001"
+	.ascii	"\303F\217d\365\005G\250\2210\204\020C\006!\tDF\002\n35\006P\002"
+	.ascii	"Q\314\3146\020`h\234\264\006Rmrb\367\360B\241\361\256\013\337"
+	.ascii	"\367\323bU\305\030\253\311\201\356}\261\032\r\330p\301\212\235"
+	.ascii	">Y\026\327\277b\206\006|\245\257y \205\315M@%lTV\b\261\022\320"
+	.ascii	"\205\204\327\267\332&\f\201\002 \223\242\250L\253\035\366\210"
+	.ascii	"6Z\276E\313\275>\340\231;rB\264M\003\030\243J\205K\034\200\374"
+	.ascii	"\231\247\2757\033Vn\370\277\274Z\276\337\333L*]A\177\377\211"
+	.ascii	"1\004\001\340HX\251CM\325\023\001\r"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.211.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\235\006%&"
+	.string	"\272C\270\016F\200\334\321p%\024\210\212\252\237\216\023\316\331\306\215\025\310\214\307[k\355\273/d\b\002\305U\270\343<\32666u\310\013\2370\346\330\366\317\376Odh\315\336\022\376gN\212yu)+K\246\225\244\333\356\275\245L2\325"
+	.string	"\303"
+	.string	"\341"
+	.ascii	"G.\366\033\317\273\337;9q\037\345c\213\023\013\013k\022z\232"
+	.ascii	"\321\241\313\013\t\004\364\246Q\306\24141\202\342\232C\252\370"
+	.ascii	"'\352\2414\225+Uq\315q{\272B\202\235\255k\021\350\346\352\320"
+	.ascii	"\233[|\201\363&\372\001\347\207\337\017e\354\342p7\377\265\273"
+	.ascii	"2\244V\335m\363\342\326\212\240\013+\030v\266\256\253\356f\023"
+	.ascii	"\271\372\233\r\255\235f\331\214S\367\267\251\337o>\2662\375\202"
+	.ascii	"\f\276\214\224U\271`\310\017\264+\221\252b\264{\234\201y\325"
+	.ascii	"\312HQ}\030\344\263&\304!\253\307\021\f\315\254\t\r\357#$\207"
+	.ascii	"\325K\236\251\2502]\327\365cP\334eg1\341\231\002\226\030\322"
+	.ascii	"\300H\371\360Lc\352\211Y\300q5\241u]\367NW\337\235\357nq\367"
+	.ascii	"\001v\315b]6\207\005\353\034`\356]\242\021|aw\n\325\277\355\302"
+	.ascii	"]\373Y1\2035\244\"\300\374\355r\356\027\314\371\336-a\202/\334"
+	.ascii	"\217\3755\304\230\254he\300\376m\277\223g\314\214uk\355.\214"
+	.ascii	"\363\335?+_\3065P<g\337\373+\307\002c\317\265'P\230{\024\347"
+	.ascii	"\315\303\021\2329qr{\370\304W1\332\241@\r\271\233'~\n\022\272"
+	.ascii	"\256\300\013y(pBn\005\013\276\360\375\341\277\003\270$\013ZY"
+	.ascii	"T\377\270\265\266q\357d2\231\334\036\262\333\274=(/O\215\027"
+	.ascii	"\300\311\273c\362\342\232\367\326\274\266\346Eo\374\326\232\367"
+	.ascii	"l^\363b\337\262\344\355\346\345\346\275O\331\025\246\007k]q$"
+	.ascii	"\323V \346\226\027\342\032I\t2hU\003}\223F\344_R\r\222\205\002"
+	.ascii	"/%w\363\226v\353\326r\245\t\326\220\253\326ZYnk\237\255\347\320"
+	.ascii	"9{X\034[\367\221\354\n\031\325\277\023\377\006\351B\0327\252"
+	.ascii	"\026\201-\"(\360W\303\0078\222U!\201\t\256\232\234\nj\230\201"
+	.ascii	"\035\327\026\262@\374\343\333 ]\214\215Z\344eX\\FP\240\213\334"
+	.ascii	"\256zDM\242F\355B\273B\225\031\363\207_\346e\377x2\244\217m\375"
+	.ascii	"\3703*\023\003[\252\027\n\344\220S\277\324!\247AC\007\031|\322"
+	.ascii	"\314,\253l\255\255u\331\375\304\212\034\243\032(\236\263)\237"
+	.ascii	"\315\353\372\375r\376M\347\217G\016)\330ZW'1\037\223a\317us5"
+	.ascii	"\f\r\235\034<\360\205\265N\203_\316&Q%&\001\233\275\013\"\204"
+	.ascii	"\027\263#T\205\361\242\352{[\372I+\354\230x\276\027>{k\260@/"
+	.ascii	"zoLE;\237\221\203\275\365\230\322\243]\022\257H\005\203\275\351"
+	.ascii	"\322\243\244\237\324B\272\213\301[J\037\344\226~r\351\321\356"
+	.ascii	"\250\250\227\224\236Xa\324KR\032\201\242\003Q\206\017\033L\004"
+	.ascii	"-\220\257W\211\227\"\210E\317\327b\267\303\355b\360\210\222L"
+	.ascii	"\245\257Q\320\007\021\036\210tL;$_\021\223N\211W\304Bg\344[\322"
+	.ascii	"\005\245\333k\261\363\351\230z=\237\016\267\273\374r\355!+\344"
+	.ascii	"\324O\333/W \346\351\023\371\206J\303\006\n|Y\356f\017\323\350"
+	.ascii	"i\033\025\005\0060\245\352\340\013y:\205\342\031*\266\313\227"
+	.ascii	"\313y\023@"
+	.string	"\363\030\317P\261\222\300\273*\017\265\352\274p\247\177\005\370\265\205V\366\264CF\264\2219\256}\3065\021\330\326's\216\032B\031jU\037\352\017\016{\250\201\034\346\0204H)\nDDA\223$\035P\0021\350\214l\003\021P\265T$#3\242JZ\003P\217\032\325\301\267\314\226\301\242\376a\246 ]M\217\353$W\203\210j\245\253\337\303p0\335u\313%\202x\031\312\350*\334\221:\377\337\243\373q\f\226\310B\243\025G\305\026\245^_\004\021\330\362\360\227\274%\033\363\324\344\222B\324\037\222_\221\0269\242\375Hp\207T\304=H\232\033<\244\325o4$\332\303\021\311E*%\2136\b\267\270\2660zhz\002\237sm2&\3744<\344\266\314\343G9\367@\330Tu\231h\024\242\235>\005\332\005\360\\\201)b\254\311GA\234\344\261\250\220\327&\246\nv\342>qS\304j\263\344qR\025\031\244"
+	.ascii	"\337\264\342\224\r\301\254\212x--7\370\360\353E\356\017\216o"
+	.ascii	"\210\316\n\003\237\323\235qi\273f\302n\213\023\034\306f\237\023"
+	.ascii	"\\#M\2670\227\253\345\340\351\0320\2678\227xo.\301\330g\263J"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.212.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"-\n"
+	.string	"\346\022F;0\345\2521\3003&\025\307\006\022\201\302\301\207\205wppY\353\0064\362;8[uu\200\335M_7\333\340\336C\017\266\t\220n\017\230\201\001\355\276\344\"2Kc\333R\312\224\0023"
+	.string	"4"
+	.string	"4"
+	.string	"Vmxe\263\374\026r\013j*\257\223\227{o}7A\276\372\224t\345\337v\315\bc}n`\034\227\003\247\001\013\367^g:\356\356\266\025l\203l\267\004\247\371\"%?\276\363S\230w\237\023\206\202\213\331<Z2'\347\314\223\236\336)\263\245\364)\255\001\020\210\335\253\221\013p?\272\024\021\3736\225\315\341\274\373\210\035\225c[\236\336)sf\305\005\327\232\031s\316lk\344\247\301\t0\t?\311M\354q1\332\275\256\217\026\031WExg\237P\362\243\275\327d\331/\371\r\303\001\336L\200\243\317V\224P\236hK\336I\344\221lh\002A/b\364Y\217\204\303\207\301\323"
+	.string	"q\340\257\343\001=|\252\bR\204!\261\226D!R\375\302S\355x\266&0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.part.0.213.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\005\013"
+	.string	"\246\224J@ \307*\035\247\004\021\201\020\210\243VB\213/\300\306\001\221\230A\353\270\233\013c\266\276\320\323X\213\261\022\006\002\351\363A\"\354\200\021\002(n\345\323\001\260\t\270\301 KJ\372=\211d\223\275S\n7"
+	.string	"7"
+	.string	"8"
+	.string	"g\330N\271/l\247\016\355\005\231]\323f\300\f\025c\260\273u\002x\370)\265\3207}\036\366\211\026\2251\265*\271T\270v\300\331]s&7\275\355\215\355\b\373\020\001+\325\256\350`\003?@\362\350\2622\226\224z\332i\366a\241\215\261I6\346\362\257\360\256RF\\\022\225/\355\023x\001\322]\245'\354\262\024\310v\305\207SW\356\324b\343\235`\223\323\006?\344S\356D\246\311\237r\036\366\013\252\301I\216r\266<\265k\273\273\236,[\223\226\177\375\247\362\244\001ewd\234\355\nE  \026z\344.D\f\020 \350}\237\217D\206\007\352X \330\243\251\300\240\270\250\"\017\364uD\225C\243\263Q=\037X5\235C\035\336WE\241\320W1\266\345\265\235,sN\023\304s\316\226mNr{\217\355\001\025"
+	.string	"zeAZ\326\360\266\017\005\\"
+	.ascii	"y`\304\\\342y\306\225\363jV\233V\260\204\306\\\020K\017\205\204"
+	.ascii	"#9\373p\347*\342D6*\035\315F\237P\360"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.214.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`[\001\305\016"
+	.string	"F\\dF\360\262&\035\"3\003:7\304\230\207\312w\335\223|\f'@\226\031\177\270\033\300\367[\370z\303\366\265E\220\266Fl1C\027\034\357:\314\364\335\032[\331eXY\365\204a\260T\332\365\001\0163!\251do\271S\nL"
+	.string	"O"
+	.string	"L"
+	.string	"\366a<\006\3528.\027\260\353\332\301\263\033*\3704\247}:\274\201\354S;\201\354\323\240\375#\264\233\022\335\220X\321\b\262\273\234\2668x\215\022\364S\327\303n\302\302F\007\253u\342q\300%\200\222\335\265\206\342\236\267-\262]\301\376+\361\257\377\237(3\322\263[\"\326\263+f\216\027\266\277\343\026o\"\302\232V\314n\230\300v\313gyfTp\237\366a\240\r\262Q6H\343u\300\347\234d\270-\225\361\031\250\347\234\374\331\235\021\302@\373\334\344\343_\340q\\B\341\232\210\361c\252\263J\232\252\301\310\247\355u\210g\371;>nx\2504\345\251g\001\221\252:U{\254R\300\304\230}\033!N\276\013\237%\373T\375\b\231k\324\303\216\300\346\306j\310K\214E\245\261\312\313\335]\253\313\316\242\347u~\231E\353\214\016\016"
+	.string	"B\264@ds\260\255\210\\\030}\036\205R\367\251x\237\004\f\020P\036\234\230X8@b\331\320}\230\337h\324I\247\220\234L\210\200\302\231H*_g\3428d\350J\\\312\347\201#\331\354\255\220>\316\344y\037\007\262\035/W].yQ\030\253*\215mP\2345\216CC\201\232\335\034"
+	.ascii	"ze\211^\326\360\266-\206\247a\260\017(\032A*\236\231\241\002"
+	.ascii	"\362\300\210r\t\020\214\212Dn\206\261A7\2450\215\344\024\f\206"
+	.ascii	"\205\360\213@\n\227\031ar\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\260\017%/"
+	.string	"\372J\f\020@p\350\312p\253\347\370\fx\3044Y\016\251)\225auM\261k=2\272\360\005\307\205<\303\0309\t!\t\355\016J\326\006Jv3\241\231\255\2775{\036\212@\n\373\344Y\234\303k\355#wJ\001\350"
+	.string	"\347"
+	.string	"\370"
+	.string	"\2572r\252\362E\336\204\310\245>\344Q\245\2205\234 \3539 k9\362\307\332X\n\261+\376\\\307\371X\337!\233\326v\230\326u\310\233k:\344\205\265\034\013n\223"
+	.ascii	"\n\214+\303:\016\211\301i\245\232\032\274\306\301l\312\365Y\371"
+	.ascii	"\301k\312\036k8\222\307\372\r\251f\222\335\314\257\035k7:\366"
+	.ascii	"n9\366m$\216=\033y\343_\017^\246\264\361\"\245\036\217\307c\215"
+	.ascii	"\375\032yzynk*\215\306^\255\201\333\312\031\373\037$\003\253"
+	.ascii	")\325\\`6\006fS\223\351%co\026\303j\245\322\025\337]\207\365"
+	.ascii	"\034\322L0\254W\332&\233\304\276^\354O\322\305\336G\213}\023"
+	.ascii	"\311\302\201\312\025\336+U\354\231R\354MR\355\237&\n\017*O\254"
+	.ascii	"\217&\326\205~fS\223X\227\2756\332\323\001\230\246i\226X\367"
+	.ascii	"\221\266\007`\005{)h{*k\366Vj\366S\322\354\253\234\355\317\240"
+	.ascii	"\331\2131\333\027\313\366a\316\354\315\220\355\307\212{\242\231"
+	.ascii	"\275\330\330\236L\231}\230\330\036\214\314~L\330\336\013l\277"
+	.ascii	"d\314\036J\314\036\313\327>\213\327^K\327"
+	.string	"\036\213k\277%\314\236\213\tf\037\345\013\205rk\337uS\314\264\027x\331s]\353C\236u\"e\227\275\022.\373$[\366OX{$Z\366Nd\226\375\221c\331\033!\257\366B<HP\227\225_\331\007\261bAe\225=\020\222\270&D\305\200\360\200d\335j\3157e\375\207\224r+\217\262\366\003e\235W\265\306#1\334\211\223\345O\326wN\326vT\353>S\353\272&k>\244\324z\017\031\265\326\303\344_\240\276\265d\235\207Tr/I\256U\206\360[\371\264\306C\"Y\323\221 \234\306\311hG\002B-\324wF\361\237\240\032\031\365\202GQC\214\244\250\256\002\030\365\202GR`\002\234D\306\"\021\261.\250DZZs\034(\250C\306\241\342\217\232\324\031Js\006f@A\375\031\177\305\337\211\346F\275\240\376\247\240\240.\301\005\367\202\nT\210@O\254;\322%?\007t)\317\200\n\257?\363"
+	.string	"\365E=@\375\021\367"
+	.string	"\365g\274\036\345\214e\346\003\324!\342\220\361?\346\345Q!\"\326\001\225\250\370#']\306\003\324"
+	.string	"\305\037\313}\200GTFl\007T\243\342\035P\005\234x@\025P|\021]\230\373"
+	.ascii	"\325h\354\347\233r43\"\240F\347\034\035\001\025Z\316H\177D\270"
+	.ascii	"\"\375\235t\212\364\304:E\372\363Z\366\366#\211\355\024)\211"
+	.ascii	";E\272\024W\244B\033\213\024\316\236\354\315\036\214\233}\326"
+	.ascii	"\333~\312m\357\244m\377\204m\017em\337Em\177\245\315\376*m\317"
+	.ascii	"\204Mv\363f7\275\261Mou\3446'\271Bq\2563\233~\354\306\243b\252"
+	.ascii	":`6\375\215\375Sj\346\262\fxM\177D\327\031\357\203h\3475%qr"
+	.string	"nk\252\215\363x\355x\310\344\335\001\255FJ\211\035yr\236\325\364V\005\234\246\"@\220m\260\231:(\323[\221\371\214\376\3163\337\231L_4\231\222\213\033,\246\344A\035lP\242>\245\nJ*T\312\2406\372\206*c,i\250#\210\205\206\272\340\364q\250\005\212?\2370\256\260\233C\323\245\205I\261\334PA$\rU\2707T\341^R\005\025RP\241\353&\250\020N\202\376\210z\021\364w\026\177FP!\\\004\375\021\365 \350\357,\376$\004\001\016\202\016\031\221t\250\211\fIo\364 $\275\325I\255+N}JH*\342\217\352\002\b\312fH\372b\227\341\204*\342GhU~\206\302\270=ch\314\027\201\f\250a\024\307\231\324\210\214$\005)\024:\241\005\0042\006\353\264\001\021\300\224\223\316\030\"\023\211H c\322\003\020\345jZ'J\b[\031\323\301z\016\002\334\263\001{\366\371\020\361M"
+	.string	"\237;Z*\221l\202\200V\013\3679\031\030=E\b\035K\214#\337gu\355\006\313\333\274D[-\007\\,\300W\027\343\3258\350\370\304'\316lK\357\236\361\226\320\237T\276\245>\036\370\326\227L\242\305!\315\246\247\360\267\210\022\360\360\360\232\252\327\312\204\323\233\261\363\356\305HY\377\f\243\302\232x9b\016n;\005L\233\326\324\3435\340\036\030\330;\374\325\235\321\346=\306hOV\350#\250\004D#J\264\351v\031\373\272I\352\311\004\025\275g"
+	.string	"\211\206/\305\377\315?\377\013r\004\340\271\233P\013\2744Z\374\234\f\004<\364\2353<\f\356'\370\202E\3063\364\317\365\034\247\367]\257\343x\277\3539N\357\273^\307\361~\327s\234\336w\275\216\003\215C\034\372\016"
+	.string	"\t\332\317\2475\275\0241\260"
+	.string	"\223\234^$\036\003\266E\321\243\276\340U\314\326\300\005\2772`\036+\345\247BW6a\005\370\260\370\273\005\360\242\214\366\330\262\322\263YJ\201\027\354\263\343\001f\247g\037g\350\2316\224\024.\316\201t\273l\267\322\fn\324\007W\036\003\020j\332\200 \322\025\202\250\357\374\370*\372!.\301\334-\030$\225\304T\003<\203\216\320\363\344\024\204\306e\2165\365\374\344\002\036\352\371\243\343)\314\361\035\317'5\242\226s4\371a\333\371\322nR\261\230q\325K\206\0201T\204s\260\227HWp"
+	.string	"h\374P\2119\257]\030A\214\013;\200!\007\200P2Y@f\306\273I\335"
+	.ascii	"\003\216\375\366\210\242\3370o\0315"
+	.text
+	.section	.gnu.lto_.refs.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`>\001\325\013"
+	.string	"\326\237V7@M\233\3417\355N\307\354\354\3130\f\3030\f\3030\f\303\0205\317\026}3p\254\301\031\233\331&^dd\021\002n+\004[?\275\375\367[7\021\241%mo)SB"
+	.string	"I"
+	.string	"J"
+	.string	"\215\223\242\344\271\022\351\331\305%\357#\027w\274\267..\275\217.\356\336\020i^\235\217::d]\361RO\224\370{\274AG\035z\234\320O\035\245B\032\365\351\035:\265ue\357\034\332\250\331X~9\001\n:+z\341\256`\364\312\245O.\372\304\242G*\372\365\350U\325+\212\036It\027\351M"
+	.string	"\247\245\001\252\211N\211\002\340\314\256\360\211\354+\224\216e/\301\270#{\212\322'\354#\354\037\354\213q2-\265\0365\376\032\207\002oA\177D\244/\"\204\206\017\002\303\377\220\341{\330\3607h~\f\232\357$\370\013\202\2672O]\235z\364\t\303\245\fw\230\017\\O\006:e\371\310r\201\022p\277\313?\026\337(\276\026\007\270-\353\245\315\363\013c\264\235\365-\337,tG\351\244\264B\2170\016a\377P\272\303(<\267\354\211=\2417\210\022x[\003#pR\205\300{\006>\340\335\354\200W\033\234\322\340o\363n\343\253q\203gHF\267:\274\342\360h\363O\347\033\347\231Q\006\001\n"
+	.ascii	"\203\031`\353\306+\020\002(\301\264\f45Q\353\036\266\342\017"
+	.ascii	"\204\364\f\341\021(2"
+	.text
+	.section	.gnu.lto_.decls.25140533fc523dd3,"e",@progbits
+	.string	"(\265/\375`\215\270\r\007\003\276\341\204M\021T\0200E\3514\006=\364\214"
+	.string	"\037E\017\363\271\016#iZp\353\352\321\3465\230\341x`\\\336\361\210D\314\372\327l\370\377\314\022s\004\007\210:{\307\231\211\257\t\307<\005\363M\034\177c\035)\t\303\2326_Ey\226\317\002\2000MD\204\310\275\267\334R\246k\017L\021\314\021\277\376\322`:\312\217\354\013\023V\326Q>\226\333\354r\344e}\342\323>\361\305\376\320\314\316Q\370f\375"
+	.ascii	"\333\254\330-n\347wm\177h\26678a\233UK\3016k\206\262-x\342\233"
+	.ascii	"5\313a\233\225uj,}$\354Y6\224\365U\272\345\310\r,Y\177\310dk"
+	.ascii	"#\272\310\252\244.H)\353\017\257\366\207=6p\270\264?\f\332@\241"
+	.ascii	"\030\375C[\255cc\\JYWq\bz\221\302\342\"\353\013\323\366Ch*\255"
+	.string	"\224\332a\2670\215\226\027\325TzI\327\240\252\323T\332\205N\002:3\245yh\037\272\007\206j*\355\244\251\264\r-E\024z\276M@\";\340\366\3628x\020\"\221\003;\002\352\035Z\035r:\315d}\241\221}\354$\206\332\222\2474\347\0134\250\261(\255C\347\32080TC\351\033A&\3176,@}a\217}\241\216}\241\322~po\323\300\261\200\227&5\2421\2304-q\316\32020T7i\2460\234_\222\035Z/V\375 \227\375\340\331~\320k#\005c\204\251\241%\353\007\263\3661\330\213\217\241AaDqj\"\035CL\027\351#m\204\241\232H\017]\013a'\3278?;\255\241\037[?\210\265\037\264\332\017N\355\007\241\366\203G[\310\267\203@0\373@\266-\214\3026k\232F\017\312Q\034_\326\007J\331K\365\202Xwwd)\232\247zK\2644\re\235\222I\317\374\377\325"
+	.ascii	"\205I3\343L\336\257\314\227\223\222\254\315d-\251\"#\353\003"
+	.ascii	"\275v\231\024O\b\303\352\n\222\254\017T\262\201=\366\237\246"
+	.ascii	"]I\261\244v9\r\262\004\327\226u\224\370Tj+\223\365\2015v\216"
+	.ascii	"\233\230\250\0316:\347\\\372%\365\222\206I\351\322\270\024LZ"
+	.ascii	"\227vI\34504\025\223\302\351\347\373\na;.uK\2624\241\313i\023"
+	.ascii	"\343\264S\323B\027}\023\343d\355\n\235\226\217\021\177\357\213"
+	.ascii	"\266E\366\276oN*"
+	.string	"&\335\302\212)#R&\357}\337\232)Y>\204,\320\377\221\331\377u\331\377\275\355\377\332\366\177Y\366\177i\373\277+\373?\263\375\037\331\376o\312\376\017\272\361\226\234\247i)\331\225\027{Y\377\307d\263y\330f\035\376\204\354\377\246\366\1773\366\267\336\376\216\333\035\360\315\232Na\317\024q\331\222\3657\225\235J\271v\0225L\201h\260\215e\375\375\334\337W\373\333j\023\243\260\315\372(\276Y\277u\354\357\244}\226o\023\235\251\223\016g\342\202\264\272\236Q\350\334\212\262N\271~qw8\302\262>\213\267\377\264\t\223\240\037\240\247\254\377\224I\272dX\303m\357*\353t\013\270\364\026\275\222\365\331\350f{\313]Nx\241\364C\232ZR%\237\375\214(\244\341\025\232\ns\322\370\031\361\367\276Ra\234BN\321%DD}\351\233\002\301=E\225\364\342\274d0p[Q;\2463}\2513\r\372\031v\013\203"
+	.ascii	"\234\215h\212#M\222R\245AR\253TIz\225\366H\253\322\250\324G:"
+	.ascii	"$\305J\213\244Y)\220t*E\222\356H\205\2449\322\037\351\221\224"
+	.ascii	"Hj$\225Ju\244<R-\fM\235\271\355i\215\324\311n\tM\352\314| \244"
+	.ascii	"O\262M\344\205#-=J\213\206\362\225\234\345b\2324\245.\220\242"
+	.ascii	"I{lYK\336\022\304$j\227\311`7'\r\257\220\227\225\023\277\245"
+	.ascii	"\301\201\002\227#\307\205\311u'\274P\372\301\230J\022\315\231"
+	.ascii	"A\227\257d,y\315\213+7\275Hc\234\360B\351W\344e\024mJ\213\274"
+	.ascii	"\214\322\242\023^(\375^L\305\310x D\244\316\\&\357\245O'\373"
+	.ascii	"$HG\364}_32\322\242:\2473EJ\2134\b\032b\301H\232h\256\222:S\033"
+	.ascii	")\024vsz\337\245\016\222T\351E\363\336\367\365\340\001\207K\020"
+	.ascii	"4f(\350?\275\361\024\352\317f\331J\326\233\201\250\306\003\013"
+	.ascii	"R\326\351S\316\323\033\267\t\212\255\245!\222\265\r\221=|\342"
+	.ascii	"\233\025\243a\233\365l\325>{c\237E\332g\337\375\325n\177\205"
+	.ascii	"\333_\317\366\327\260\375u\311\376:d\177\315\261\217\241i\221"
+	.ascii	"\036\004\220\334\b\223\365\327\245\375\2471\322\241\r4\305J["
+	.ascii	":\224\302\340\nrZ\312\372\353\213}5\315\276Zf_\245\333W\343v"
+	.ascii	"\372\363\032\266\036a\\d}U\313\276Ze?\212m\326\253O\366\325\254"
+	.ascii	"\375g3\317{z3\274\027\260\020\n\352\313:\237\311h\236\365r\336"
+	.ascii	"\233\365J\210z_\240\254W\263\367\276@5\030{\200\261\007Z\311"
+	.ascii	"\024\021\350\252\257\032\33199\317fn\203\271\364\272\260d}\265"
+	.ascii	"j\343\340\233\365\317d\362\035\256r\205f\005=]\036\363\377\302"
+	.ascii	"\f\206_4hxe}\025\307\276Zc\343\027\333\254y.\213\301\320g\311"
+	.ascii	"t_\245"
+	.string	"\210)\021\312\372\352\321>\301\373,\353U\027\373\317`\276\324\224i\353\362\374\222\345X.\321)DY_\237\331\327\321\215\225\272pI\211\216hx\341\222\341\210c9\316\256d}\375\266\257\261\354?oq\013J\311\021G\344\226\333j\202\270\251ie}Me_?7\216\272\332\031-\247a\350\327\262\332\2375\304*0\242\254e}\035d\037\177m=\001\376\332z\315cc'\266Y\257ul\034\205o\326\n\260\315\212\3136x\3228\242\312:S!\232\241\341$\2275\225\f\315S\260[\330\253\277 \351\330\323\032\303\320L\345\332\003\216\210*\"0Z\312\363\224\217\345\035\003/\r\232\254\263X\316\263\024\024\200P)\311:\3056\353\3231\373\317Q\302\200x@\216\310\205\375\271G\366\221\241\b\243.\300J4\356\216d\235\237\3503\321\030c\262~\372\266\037\342\307\307\260[\030v\"\t\023}\337\327+\003\311I\2322"
+	.ascii	"\346\317NrW\346\312\317\f\226\27704{\375YI\336\362\312Kr\023"
+	.ascii	"\r\202\206X8R\027\305T\350n\034\001\373\261\031\257l\3651\242"
+	.ascii	"\320\363\rb\302\334\353\225\253@\210\271q\304\003\216\007\017"
+	.ascii	"\036<\340\26613\306\020\3651\364b2\223\323\001\311B\203I\326"
+	.ascii	"O\331\366S\265\235\237\370f\355\200m\326\254\205\223\317\352"
+	.ascii	"\202\304e\375Tl\377\317X\031\t\206\346\254\343<\037\"H&\022e"
+	.ascii	"\313\312\316|\244\204\226\033G\362\336\367\211\343\301\003\020"
+	.ascii	"\215\332Z\331\252\377|\344j\214K\306Y\326\331H\320\250\210\331"
+	.ascii	"R\326Os\354\377\030\232\213<_\034\214T\304\305Z\326O\237\210"
+	.ascii	"\344!bN{EYg!n5*\017\260\035yY?]\332O\217\366S\027\373\031\315"
+	.ascii	"~\246\333\317n\273\202'\017*\274\245\217I,\3073\325\217\315d"
+	.ascii	"\035y\nG\275\257\224\367}/\250\301\373\t\213\313:G\345\035\030"
+	.ascii	"\312!K\2755xLU\320R\326\317h\333\004\357\2139\254\270\257\017"
+	.ascii	"sX\361\213o\326\214#\3479\207\315\252\344\364|\303\336\367\255"
+	.ascii	"\341`\312YY\326l\206\342\220U\246\243G\326\177\276\221g\324\024"
+	.ascii	"\341\355\021e}\354$\317\300O\260\024\242\320\363]b\275\214\306"
+	.ascii	"\310\210r\236g`\264\274\364\003\204\033z\217\247P\301\\\304\237"
+	.ascii	"\347\233\004\364*jR\312\003!\""
+	.ascii	"\317\300e\370,}:Y(S1\242O\271F\266\221id'\f\31532\323sS\226\201"
+	.ascii	"\243~\001\263\245\214P\257/\276Y\357\206m\326g\350V\302\251"
+	.string	"\3313\022\022\227\365\363\222\235\246\206\263\020\1776\274/U\236\363}\237\377\363QN\312.rQ\206\221\215\262P~\221\211\362P\216\201\241\031)\003\035_\301X\216\363|_\241\367}\275r\020\316r\246I)\317n\f\306\233kR\312\223\373\202\305\234@\327\244\224w\006\357i\0204\304\002\331\227h\376\301Y4\b\032bA\253-\232\223&\277\t\220\223\243\303Q1\330L\036\216b7\247\347\313d\002\230&\245\27446\354\005\2739=?\250kR\322z\337\347C\374\330.#\34128K\372,\362\276TP\030p\341\302\224\226\367\276O\0178\036\324\255\247.\0368\372\271h\037\247\331\307d\366\237\337\276\262\267\0271\370\216\373>\026LK\033\023r\314\266\247\007\200\033Wfh\216\3650\234\231\333\\\333\223}\314\2655d\355\037\343\221\t\262\305E\241\370\356\230\314\360\314\006\222\033Y\037O\235*37\226\365q\325\356"
+	.ascii	"\212\243u\017\030c\304\343\270\016s\375\212\\M\031e}\f\265\177"
+	.ascii	",f\016\253\357i\024\346x\016\343\275X2\2265\006\223m<cD\263>"
+	.ascii	"\336\307\376\3770\026\225$\320\254\217il\022\260\315\372c/q\271"
+	.ascii	".\306\022\244\254\177\334\3458\016\b\306\307\022\232\2541\027"
+	.ascii	"|\366\377\227&\221\351\035\311\372x\030\356\377Os"
+	.string	"]9\365\310\032k\301m\030\n\002v;\336\202\337\256\002=\337\347\373>k2\2204Q\274\262\326\200o\326\214m\326\343\243}\f\302\232\366\365a\020\326c\241\375\343,k:\212\215\252\251\254\377\343a(^\373A\2108\235\360}\227\274\357\253\201\372vd\b4\353\373\354?\261\315z\345V\237\370f=\032\266Yq\025l\206\241\033`+\007!\342\351\217\223\232!_\022>\275\254\277\263\2177Xq\037\336`\375\f\373%\366\303\360\315\372\026\366\311\360\315\212\241\3400\f\355\200\305\216\2770\330\177B\317\367\353}\2375G\036P\254d}\025\366q\224s\340\344\025q\f\366q\207\265\246\257\257\257\017wX\277w\007\370f\325\330f=\031\266Y\357\206o\326-\274\004s\245CFQo\330\373>7\260[W\246\302\262\306\\\0317\301\317c.\314\344 D\\(\364.y\337'\346\322\357\013\204\261\007D\214=P\317\204"
+	.string	"y\255\372y\377\211o\326\215mV;\020\324\236\021\234"
+	.string	"\330\367\257r?\336"
+	.string	"\373\343\177Re\372\204Q\221\300\2633\326j\205\302V\261>\326&?\333\343\327&\260<~u\207\352\327!\252\330\251\177\325\301J\375\353\rv\307\272\364\263Q\277\006ae\372Y\035?&\372_b\003x\211j\274\002~\240\027\306\371\361M\023\017l\251\023\260\261V \304\262R \034"
+	.string	"\226\022kPxA\216_\257`\002\026G\017\320\f\324\257\253\270\354\215?\023\375\267\362d\n\246\007\330\345\277\332\327\236X\033\277\246\262\0229\375+\024\021\330\032,\215\177\255\301\316@\376\317\340\007\232\251\306\225\355ge\374Z\005\266\t3Qg\350\372\233p\370\253\035`\231nE\335\300\317*\001\261\260"
+	.string	"\360\007\353\205\370\277\332\327:\300\024\370q\0138"
+	.string	"\253\007~\355\001\273\364\277\004\fM\256\301\017\254\201W\030\361\373\2011\036\340\342m\370\003\177T\006\004 \223\235\002j\002\200>?\266\340MB\360c\013\324\016\254\322\257\226"
+	.string	"D\252 \236\376\300\366?\005\336\364\0174\256\240\362\375lR\232\037_\200\205?&\376X\377\030\370\343\365\307\301\037\247?V\177\374\3731\373\343\375c\r,\322\373\256W\302\311\374\253\006\377\353>\367\270\007x\360\003y~\354"
+	.string	"\274\302\217#\200Y\260\242\226\021\363&%R\253\013\377`\033\024\003\304M\341\362_\375\203Q\324\2557\260\237=b\215~6\003\177jU\364\022\337"
+	.string	"\346:\005\177\260\213+\313\217\271\222`.\254_\275\"\344W\255<\377A+(\027\333\361\r\244\035x\020\207\330\257B\t\376\301$u\213M\301v\200\003\033"
+	.string	"\343\262\371\203'`2\002)\b\374z\210\003j\324\211\1770\005\242_K\275\004\016\005\304\3705\016\325)\347We\374\307\177\260"
+	.string	"g\377\340"
+	.string	"N\240*\005=\220\301\204_+\r\275\211n\372\006~\301\037\344\360\257u\277\236"
+	.ascii	"\013C\006\366\305\257\227.~6\350\327+X\240\237\255\371\331\237"
+	.ascii	"_\213\340e\3671\0066\263'\370\365\tL\300\226\200\315\340\327"
+	.ascii	"/H\360c.\374d\t\240\207J\334\001\177p\303\212\200\0058\340_U"
+	.ascii	"\370\331\021\374W\373W\b4\371\315\277\323\350\244\266_ucsD\300"
+	.ascii	"\325\342\277\030\273\342Ok\250\036X\025 \274\211\366\340\311"
+	.ascii	"\013\340\337P\376\325\204_3Y\237_eA\255b\335\237\025A\023\261"
+	.ascii	"\315_s`?\300L\036\347\337X\330\016p \255\352\301: \004\177\232"
+	.ascii	"\344g{~6\002?\313\302\317.\177\025\013\311\317R@\371\253WY?\313"
+	.ascii	"\223j\261\311_\325\301\246\370Y\002\374\251\025\b\376\203\360"
+	.ascii	"\263'\376s\340\024\370\006\376\303 \244\216\335agh\362\025\376"
+	.ascii	"\240\f\377\352\302\2577`\213\277\346\300~\340_)\360\263\0368"
+	.ascii	"\360\017\016\3775\003\177*d;\300r\340\177\211\357?\250\376\351"
+	.ascii	"\376S\341\237\246\177\252\376\231\357O\363\237\376O\361\237\352"
+	.ascii	"?\367\3759\315\237\243\177\266\3733\231\237\335\300\377\232\377"
+	.ascii	"G\342_\213~V\003?\033\303\317\276\360\263,\374l\n?\233\200\237"
+	.ascii	"=\300\317\202\370\331\017?\013\302\317j\360\263\032~\366\367"
+	.ascii	"\257y\377\032\375\327/\377\252\345_\257\374+\331\277\206\375"
+	.ascii	"+\327\277b\375\253\325"
+	.string	"\277F\375+\324\277:\375+\323\277~\340_5\360\257\024\370W\b\374\253\n\377\232\302\277.\340_\025\360\257\b\370\327\003\374+\t\377\252\301\277b\360\2578\377j\301\277V\360\257\024\374k\360WG\360\253\314_E\376\352\f\377\272\376\352\006\3765\377\353\177\225\357W\363~\265\314\257\326\375\252\227_\215\373U.\277\372\366\253n\277\232\345W\325~\365\312\257Z\371U\262_\245\362\253b\277\032\345W\241\374*\330\257:\371U\256_e\362\253[\277\252\365\253X\277z\365\253E~U\310\257Z\375\252\324\257F\375*\216_u\372U\031\277\312\364\253J\277j\364\253D\277:\364\253/~\025\350WO\360\253>\277\n\202_\335\371\325\343\257\032\177\325\003\277:\201_m\341WY\370\325\025~u\304\257>\340W\035\360\253\f\370U\024~5\001\277z\302\257\232\360\253%\374*\210_%\341O\275\374i\227_\375\360\247L~\325"
+	.ascii	"\177\352\343\3271\374\207\341W=\374x\311\2577\370q\004~,\200"
+	.ascii	"\037\007\340W;\374*\001~\215\345\327V~\274\200_W\3715\225\377"
+	.ascii	"M~=\345\327\316?\003\375\232\352\327R\377K\374\032\307\257m\374"
+	.ascii	"\232\306\257\233~\255\364_\354\327I\277.\372\365\320\257_\374"
+	.ascii	"\372\004\2776\301\257I\360k\021\374z\305\257\231\277\016\301"
+	.ascii	"\257\227\277N\361k\344\257O\374\372\370k\235_{\340\3272\374\372"
+	.ascii	"\205_O\340\327,\374\251\335\257W\370\265\n\277n\300\257\023\360"
+	.ascii	"k\023~\035\342\307\033\370\365\207_\203\360k\002\374\332\203"
+	.ascii	"_w\360k\016~\215\301\237\216\371\3230\177:\367?\371c\256?\005"
+	.ascii	"\363\337\312\177\n\374\177\373\323\035\177J\365\247r\177\032"
+	.ascii	"\367\247M\376\324\352Os\374)"
+	.ascii	"\216\377/\374)\324\217\273~\374\374/\303\217\231\374\030\206"
+	.ascii	"\037\277\360\337\205\037\263\360\343\017~\234\301\2171\370\377"
+	.ascii	"\\\373\257\200\276\276\276\276\237\202\241\237\003\n\374C>\002"
+	.ascii	"\372\036\244\331+\214\237\320\017\bC\177A\377\005\251q\277\037"
+	.ascii	"\342\317\363]Zc\374\020Bs\300\200\261\352\337\317\277\250T\375"
+	.ascii	"\210f\375{\331\271\375\345k\212H\326|"
+	.string	"|f\340\356\366\277\367\366\266\031\316\363e\312\201\353S\323\372\262\377\215\346[\357\337SxJ\037\0212FY\35739\337h\202B2\240C\262\376\341}\347\375\273\3146\363\333A\366\234\2225F\3037k\006\330f\335dr\276\361\204wr_I\262\306\340\216\235{k\266d\364\bb\267\355\366\323\357\352\312\203\266\375o\272\357\350\277\343v]\326\233\341\207\f*f\262\306Z\370f\335br\276\351\252\202 \031\313\332\002l\263\206\t\323\026\344\301\331\376\367\227/S%\024\201\273\007b\373\337^\276\345\346\322\244\021;\313z\307\345|{\331QH\262\246\262\276\240\313\206\303\373\341F\227\365w\333v\373\336\362\275e\303\341\367}_\247\367\307\356\204;'\245\016\377~\373\206\023\023%H\220!Y\037\357b\376\377\202X~Li\311\372\036<\367\217\237\377\365\005Rz\337\227I}\276JA\302\365\307\307*\306\035\376!Nq"
+	.string	"\376\353\367\315\031\302\342}\235\256\354\275\357\213\311\354\2531\240\033\035\274\027\274\357\2734$\364\376\340\241/\251\245\241/)\245\rCY\244\226^\241%-!\251(<$$\245\244$\364\376lx\277\244\224\206^\251%\r\357\327[c\350\013\350\007\017\t\275K\357+\365jx\207\200\226\336\257\247\322\206\241/)\245\241/\251\245\rC_@KCo\324\253a\350I\245\364>\245~6\024}\001-\275_QK\033\336/\251\245\2417,v8W\334\246\210\332\276\212"
+	.string	"\301E\206\204^\244#( %\rnC\317\250W\356}q\330\213W\351u{\337"
+	.string	"\274/T\224\222\034P\rL\026\344\206\024$\005(\n?\337\367\345p\0244\025\365\n\271\375\340\327m\350H\324\373\036\tB\361\036\275\357\373\226\360\363t{\255\260\333\017\025\324k\364\342}1x\237\357{\364\276?\370u{\337\367\347}_V\t\352\371\276O\032\206\234GG\357\353\204s\364B\375\224\275x\337\034\006\206li\350k**\247\354\311\227\363\205\361\374\301CFQ\257\363\225\223R\332_?]\257\321\373\276\370n;\227\232\306(\345\200\203\221\205\355;\213^\016\251(Ys`\311\f\231\301\310z\253\251q\033\013vs\322N4i{\rC\267\332F\333jl\222\022\\E$\003\314\252\357\201\321\376\367\225o,Yo\206w\313\220\224\254\367Y\316\367\225\365k\310P\222\254\017P\006\335e\333,\275\n\"\013aW\261\300\224RZ\326\367"
+	.string	"h\277\0033\373\337S\276\311\376Me\217\261s^/\225\036Y\3430|\263r\3006\253:#\347{\312m\314\230\234`\311z\213\035\340\205sf\375\016\35064,\314l\313\3767\330^\262\237\370t5\351\313:W\341\233U\177\345|\203\001\207\210\206\202t}\177\375\333\311\366b]\344E\373\262\316C\370f\365"
+	.string	"\333\254\330.\347\273kwe1\023b\362\375\374w\223\315\225\365f\230b\306I$\353\354\3047+\001\260\315\272\227\344|3\311lC\200td="
+	.string	"\255\357\255\177'\331J\200g\260\254de\235\303\360\315Z"
+	.ascii	"l\263f%9\337Z"
+	.string	"H\306\270d!\371\316\312z3\314x+\223\227\365\306\312\371F\362\2031\204F)k\001\024\371>\362o#\373*\353\005\241\252\322\350\310:G\361\315\372\001\333\254\333\231\363]dx\005\246\350+k\021\266\025t[\355!\251\320\013Tu\001\032\243\036Jy\357\353\024\202Pl\315NO\310\367\220\177\377\330@\360\231\2213K\234Y\357 9\337B~Uc1\336\262\306}}\330f\325\360\276/\266Y\337\001\326\336U\177\026\313x\232G\0160:6\325\267\217\177\363\330=@\030Y\371\310\372h\370f\rb\233uO\345|S\r\351)\311\032\210m\326\224\353Y\201S\026R\326\377\216:\206\356\250\365\250\203+\257\016~\354\177C\035C7\324\316\241\016\275@FJ(2\265qh\"\021\214%2Y\277\003\034\373\035\320\330?K\346\030\312\222\331O\277\241\367m*\341\352\252O-\357UR\na\333\370\215\315\321\005e}"
+	.string	"\204\331{\306^\302\\\253\017/>#{\006k\006\311V\316V\"\022\335N\273\306n\33226\323\246\201\241{\306\317\342\261e\3303\373\b\273\205\265\020M\022\3353\330\274\021F\224\354\031;i\037\021a\004\361\031\311#\216i\221\301E\324\007\300s\037"
+	.string	"L\366\001\240d?\304\213=\344\243.\272\215v\321&\332H\030\272\217v\214}\304\242a\365\322\247\363G\344e\357\210\335\333@i\227\322\026\203q&g\037\355\240\355\342\004Ef\214h\275\3573\035\342\365\305\bP\037"
+	.string	"C`\260Dk]\202d}"
+	.string	"H\355\003\240\306\336B\251[\232\220V\326\007\300\321>"
+	.string	"\204\366\377\375\203\241\033h\277_\033\210M\303\366}\271a\306\b\360F\026\0370\264>\007[X\276!\032[\231Y\326\347"
+	.string	"\313>\007d\373\034@\331\254\336\f\357\033\206\026\206\t\231\254\317A\223}\016\222\354spd\237\003\";}\342\233\365\004l\263\236\003\037\373g\357\306\364\220a\002\246\356\354\230\237\215\262vYo\0061OM~d\215\243\370f\345"
+	.ascii	"\333\254,]\316\331:b\222\037\034C\262\336\200\025svn\206\367"
+	.ascii	"\225\202g$m\357\271\344}\337\232_\231\036\326\214\254Y0/2\203"
+	.ascii	"\225%\353s\200c\377\354\027Vn\350\342\305\r.\342\221$em^\342"
+	.ascii	"\330\367\306\217V\034\333]\320\023S\3268\215ec\241h>\354V\365"
+	.ascii	"\276K%\230\335I1\345yi\266))\2466\366\254\203\231\227\024S^n"
+	.ascii	"z\262N\260\233\323\013\364S\302\031\\\232\016\243\317\244]J?"
+	.ascii	"$\260\252\350\225.\003\230]I1\345\261\261`gWRLy,\033\373D\203"
+	.ascii	"9kb\261\260o,\032\233\205mc\271\260Z\330-l\0276\215Uc\341X7v"
+	.ascii	"\rCY66J\210\2573/)\246<\226\215\207\215(\313\246\246\261d`"
+	.string	"8\242ll\230\031\234\024S^nb\331X\257\254\007&$7\261l\372\211\246\322\364\301\331\235\024S\236\207\274\255\227\007\007\372\0340m3\326J\225-\244\013\224\2254fl\225\260W\216-;[e\005\363s\005\r;F\334\243QF$\353o \307Ra\247\344)GbHa\245\234\235\"D\223E\213\214\254\217\307\212\375\377\021\343\232\214\231\211\261P\342\321\333+\305B\331(\2772ri\266\262\376\006m\373\033\240\355oP\266\277A\330\376\006^\373\033 \331\337\240\353\254\223\343\263\031\336\0136\250)\351\310\032D\316\331\256\333hY\331q&\353o \265\177\226\213m2\366\304\252\2215\313\344)Tt\244\n*\353oPc\347>\254\"\347\022\026\t\253\204\325b\263\330$\030\312n\375\354\025{\204\335b\207\260Db8\331-\326\310\313\212|\3609\255\206\234E\330 \257\217>/v\213\005\302\006\321 h\350-"
+	.ascii	"\221\216=\255\365\350\b\230\021Q\177\003\242\275\237\370f\305"
+	.ascii	"C\330f\375\006\357\276\006^\3665\020\333\177\226r\226\310\217"
+	.ascii	"\355X!\303/R\200\364\262\276"
+	.ascii	"\006Hv~\361\315\312\006y\231\320\n\207\024*Y_\003\253\375\263"
+	.ascii	"?\314\216\220(\311\372!\246X\036\032\004\r\261\240U\345\203\265"
+	.ascii	"\302P\266\212\355\301V\261Q\254T\220\307\032\227\222<\017X\251"
+	.ascii	"\316F\332\252\237\001\027\252#Y\025\re\375\f\326\3663\260\302"
+	.ascii	"\356\270\220\t\021\336Z\326\317\300\311~\006J\366\317\352\310"
+	.ascii	"\202\005\253\353\207\315\3615#gB;\262\376Y\034*\r'/nd\255\272"
+	.ascii	"\300\262{\201\202\262D\331$\266\210UZ\373\326=\026\211\005b_"
+	.ascii	"\260F\254\020{\304.\255z\254\0136\006{\203\205\3012\255|\254"
+	.ascii	"\f6\210\375am\260/K\304\322`\207\3264,\024[\203ub\233\330\031"
+	.ascii	"\030\312>\255y_\317\254hV\262\265JV\331\022<!Q'C\242\353\025"
+	.ascii	"\366)\355R\222\200\227\222\325\fV\021\"N\215\325A\222.\270\275"
+	.ascii	"\274\234\265L\372\\:\001\253K\007\021\242\177\244]J\024\230B"
+	.ascii	"\213\276\357{\226\242\245cH`R\344\365z\322\347\365\305\303(\032"
+	.ascii	"\306>\245b)\225\022\270vX\361\022\223\206UY\200\035\334\236\326"
+	.ascii	"\373>\275\300\360Y\005~\340\366\264V\263\365,\253\3103\355\373"
+	.ascii	"\261\203\333c\237V\271\365\216\251\203\254\245\027\b\310V\021"
+	.ascii	"\270\275\274\262\237\264\217}\322o:&\355R\232@\220\\\324\214"
+	.ascii	".\212D'I\262\224\216\221q-\301\355\345\255dg\237\326\262u\254"
+	.ascii	"C\326jf\245\013n/\rc\237\322(\\[t\020=$\211\035\334\0366\303"
+	.ascii	">\255d\262~\340\366\362\3220\366)\205\226\301\355\345\245g\354"
+	.ascii	"Sz\227\3621\331\001\2677\303\030\335\317"
+	.string	"\b\375\273'\276Y\211Z\330f}\006W\373\031\364\330\317\240\306~\006C\373\030\364\215\031\326\200\336\245!C\267F\327\272U\f\206\256v\353\334\327\270\325\313\365\227,N0\351s-\232c\267\242\255]\260[\230\266\302\266\332\255a\322\247\232\363}\237\3013Lj\334\001\3651\370\262\217\001\227}\f\332\3661\270\262\217\201\330\326\340\206o\326l\264\252}\355\362\353\256\025\313\312%\307\275^\\d\r\307*!C\263\227\3651h\342\266n\301\320\365m\325rl&\353x[\327V6\354\0266b\311\224\350\333\332\266~\2013\262\227\227\232\265A\301\255\372\030<\355cp\264\327,B \032T\266d}\f\204\3669\244\331kZ\316W\265\333\360\235)\n\313\272\006ok\370\262\317\201mk\016`\373\034\222l\375\3046+\025\271&\254'Y\237C\220\375\177\225\262\212a\350:e\035r\235\245\265\326)+\221\025\232v)M"
+	.string	"NGt\235\242\271V!'\274P\212"
+	.ascii	"\\\216\250\207\334$\tN\310\252\243\004\325\274\030\341\310\372"
+	.ascii	"\034\236V\260\365K\rzr\202\255F\326.\033\321\025lu\242\243\020"
+	.ascii	"\205\236\357O\210\037\270=\2555l\205\262>\301\320\025l\365\272"
+	.ascii	"\336\322K\002@\346|n}\016D\3738y\3738d\326\256\177u\256E\326"
+	.ascii	"g\216Z\343r\"\313\232k/\350\256H\326\307\231\333\017\201\344"
+	.ascii	"\006\026\021\234\221\326\317\322.\245\375d\352(\272\344\310\222"
+	.ascii	"5\311\272\2652Y\233`\350\252d\315\022Z\225\254W\257\213/\003"
+	.ascii	"\024\351\032\223\227\347\201\315\361\206F&\324\307\221\333\307"
+	.ascii	"q\333\307I\333\307\251\262\217#\266\217\363\265\217\363\334\251"
+	.ascii	"\033\276YQ\3006\353q\216\354\343\370\330Wur8\250\262\366\032"
+	.ascii	"\323U\230H\340\272\223b\312\313q/t\224;)\246<,izz-\013\346\232"
+	.ascii	":\023\355r\002\003,Ft\205\322O4\225\264K\211\002<\206\242hZ\r"
+	.ascii	"\215\363}\237^W\270\274\226\264\351\267\266\025J\215\241>5\b"
+	.ascii	"\032z_\246\017\222\230I1\345\245P~\335\225Z\301p\330\255\352"
+	.ascii	"\005\3729\241lJ\212)O\205\361\261\264K\311\202\027pT4\232?WY"
+	.ascii	"\241\264^\236R\300\225\024\223\226~^\201\301\35188-Q2\025\r\205"
+	.ascii	"$WRLyk\322\252c\225Z\253V\037k\220Ui\275\261\362X\177\254=V\253"
+	.ascii	"\265\306J\265\346Xg\254Kk\324\312\264\332Xi\254@\326\035\353"
+	.ascii	"\324\332\264\342X\235\326\247U\006\206\256P\272\3105\023\335"
+	.ascii	"\304K\233i.3)\2466\225\013\\\224+\272O\025J\273\224\"0\225&\227"
+	.ascii	"\246j\2312@\222)\215\246\331\264\2261\035\270\202\266\254P\252"
+	.ascii	"\013\035%\355RZ\001\016M\243\255P\332\213\006\223v)m"
+	.string	"\261 \266\350\373>\241\324.\353\321\t/\224&0\305\025}\337W\355R\307\244TY\241t\032\315\227>\311\"0\245\026\315U\240t\030}f\252\303\226\227\024S\336\333\257\275\3222>\247\210_+Y\241V$|VB\231\227\024S\336\373>\261\r/;.\024\364/\300\333\253\021N\r\225\017\240.Y\377\202.;N\375\222>\235+\004!E\207\326\2425\006\206\256D_\211T0*\337\t/\224^\b:\212\256D+\214g\331AB\0214zV8x\360\240\237T\245\351\330\372\027\374\330\327h\312p\300nU\0160\"\006\246\227D\345S\303\250x\032\004\r\265\200&%\357gRah\224\234\351\200\335\302F\220-\211\252|\352\336\020->\325\f\007\"\320\363UZ\255~\230\321\222\267\n\255/\324\2765h\375Y\201V\027\353\213\241*\237\232F}\002\226\247G\201\276\005]\366-\320\262o\301\225}\013\250\354["
+	.ascii	"\266oA\223}\013\220\354[\020\204\314O\335[R\326\267\340\206\235"
+	.ascii	":\006C\325;U\314\234Z'\306y\247F\325:\n\304\200\251cJ\251\204"
+	.ascii	"!\003\266\352\337\250\355_\255S\351\202|Lp\360\251t\252\230&"
+	.ascii	"D\214\250\262\376\215\223\375\233\255\375\233#\3737B\366\257"
+	.ascii	"\312]\375\242F\211\261\006#k\325K\316U9\027UFLY\203\200m\326"
+	.ascii	"\337\364\330\277\331\241\3021\261\350vd\375\233\2427u\313\217"
+	.ascii	"\350\027g\326\352\226\377\204\021\363r#\224Ee[\373a\315\2102"
+	.ascii	"G\227e\355\027\267\204J\031\265\253k)^\216\036BT3.\247\031c^"
+	.ascii	"T,\370\210^\005S\3661T\275\242\236\261Bg\234hQ\255\\=\303\\["
+	.ascii	"tpf\262V\253\250f\333\231\364\343\302L\033A[\343{*\373\331ui"
+	.ascii	"\253*\313S<\212P\331\312\372\025pm\260\024\212P\222\254\247`"
+	.ascii	"\250JEuBE\365R\245\020\243T\201s\022\2761\316\224i\375\253RT"
+	.ascii	"1$\244\350P\326*4\213\214\031iY\277\002\245\375\253a\030\252"
+	.ascii	"F\241\353\260\343\212)\353\343\251P|t\251C\223\265\372D\351\205"
+	.ascii	"b#k0\272\2457'Y\337\206o\177\251N\362\016 .KY\337Fo\337\346\313"
+	.ascii	"\276\r\227\315\265F\325\3302\312\3726h[\206\332D\305\211\244"
+	.ascii	"6\225\220d\f\022-yC\324+)%*\0225KM\2422Q\233\250Z\352\022\fU"
+	.ascii	"\267\324#\307^\352P\232\272\245b\245\317\264KiC\361j\213n\251"
+	.ascii	"G\230\313\356\203-#H\264\344m\2515T!\032d\215A\242E\316H\315"
+	.ascii	"A\266\245\022\251E'lUA\242e8\206*zE\201\276\215\224}\233\347"
+	.ascii	"\225jd\205:\034cY\027\001F9\342\352\312\3726G\266\352T\211\200"
+	.ascii	"!z\351\262\276M\325\276\r\325\0175\210\n\004CU!\307\241\352\330"
+	.ascii	"r\252B\324\035j\325;\245\345T\205\250N*\024\\\223\350\373\276"
+	.ascii	"\034<x\360\220\312PRuf\353*U\ns}\2005\006\211\026+\265\207\352"
+	.ascii	"\003C\325*\225\307\325\031*\r\265J\245\302p\351\223l\027y\tQ"
+	.ascii	"\253\324\251\027H\252"
+	.string	"\003\326\033\022-\231\013\324\334\334\326\267\271\261o3c\337\006i\337\006h\237\002\276\255C\265\201\317\210?\032\336 8%\316\367}Fa\250\252C\315\221\316"
+	.string	"\253\"\245\365)\300\333\247\300n\377Wo`\250\n\245>\035\204\210% D\250P\252\r|\206\335\234\336\2371%dUA\242\005\213\t\203\225C\353S\020e\237\202\256}\n\264\366)\030\262\361\023\337\2548\330f=\005>\266\312\344tt\345\231\365)\250\261\037BUR\223.f\365R\245c/O]\302PU\35188Y\016\307\2227\255O\001\323>\005E\373\024\b\355o\340\333\277Zt\006\307f\024\224\3657\344\355o \263\325\rt\373\033\272\354o`S\205\324\240,$\333{A#k\365U\1770\364g*\220\025\226\037\253\254\277\341l\2638[\331\263\365\033\234l\276_\357i4y\n\263LV\272\252d\375\rY{\3056\3537"
+	.string	"\331$\340\2335\257\246\t\007\224\241\254\277\201\306~\2109]\227v)m\250\017\"\321\367}\342i3\030\252\313\350(X\031m\247\311`\267\260\027\250\351\0033@>\264\206\320<=\032\253\036\243\357j\212\204\300"
+	.string	"\2026f\312\276\006-1\232.3\201\375\b\"F\003\217}\rLr\372\013\206+\203&F\326\327\020$w\206\213\356\222>\251\244\275\205\341\322\346\246\267\004\247\272Dqf\375\2322\267\032\260\355F\f\302\030\233\022\313\3725[\3735B\366\345\360\315\372\232\250\375\232\243\215\363\360\315zb\232\2555\r6\036C\262>\021o\237\350E\227\325\270\r\271B%\353\023\3214\231\330\024|\304\005\327\221\254O\314\332\377\265\030\206j)\032\212\024\035\246\241\330-\354}\227\f\220d\307\230\274\274\367}q<\340\033kAm\032\032;\250\f\3716\332/\fL\312[\326\303\275\335\345\377\357\202 |P|p\211\233\022:\033\363a\2311\303\274\254\244\f\004\275\244\253\275\274wH\253\003\353F\204\326f\346\303\274\254W\006\212E\346C\274\377'\244\223\022\204H\326O"
+	.string	"\326\036\336%\300\031\346\0173\214\342D\375\224\251!K2\262$\257\006\r\335\022\242\272\017\243qy<\364\262\036\322m)\254\r \253\0371XT@\216\f\347j\260\340\351 \313\372\t"
+	.ascii	"\332G\300\235\333\207on\303/i\234\360\375q\362&a\275\244!NZ\301"
+	.ascii	"\256\242\256-]>\374\362\241\034\b\021\027\243\205$\016(\353\241"
+	.string	"\027\242\023[\225h\326\037\306\r\271\\\314\0211FvY\017\341~&t\362\222\347c\270\345W%\007\017\251\254\317B\343n8\347\206hC-\332\305\257+\352\305\b\333\207Z\276\006\246I\020\251\254\207Y^7\006\b\227,Y\017\327\276v\327fe(\353\241\332\327\202jD\200\354\245\375\377\035\201\314x\244\375\004ae}\004\254\r\253|heXex\345\251\320\233#G\0065\222\2068\261_h\206\314\f\317>\274\222\026\225M)k24\333\202~8\006\035\222\341D\375\330\211\270\221\004\344)\357\035\202\352 \214S\022\245\310\220\354Vz\f\215\261e=\234\362!\225\377\227\313\362\236\236d}\004\350\330C\261\017\245\374\277\037\023\f\"dY\037\001O;FW\3270,\003=\323\367u^\341\273.sSO>\f\373\020\n\b\021y\355\206\320\233\331\360k\b\366\033\343\244\212\254.\232w$\017L\326C/'\b"
+	.ascii	"\312\312\032r\245{\302\367G\3033(L\023'\021M\306\213\260$\037"
+	.ascii	"r}\330\204\235z2\331\313z\310dHD\r\002\265\347b\3110,\211JQ\326"
+	.ascii	"\303\255!\020\032_\\\370\262\036*\031\n\0012\262\372\312\372"
+	.ascii	"\037\322TIi\312z\2505\234r\333\221\347\"\353\017\223\330\035"
+	.ascii	"A\2100\241\001\362\017\201\f\2614@\341\\`#\027A\347f\004\371"
+	.ascii	"\020\353\303# D\374\214\255Ji.\353\241\221\341\225\020\313\213"
+	.ascii	"\022*Y\017\235\303\"\377\0173y\022s\221\365O\270\333C\"C Tzh"
+	.ascii	";\262\036\016\021\001\007\232\035{Y\177(\244\352M\bV\326y\337"
+	.ascii	"-!\342E\313\234\324?\224\032Z\331\205P\343\250\316)\325\343\242"
+	.ascii	"GeX\365\241U^[{b\302\226\365\260\307\320\007\r\240\241\270|\272"
+	.ascii	"\232\253\271*M\262\036\362\310kud[BY\017\251\362\232\230\260"
+	.ascii	"!PSm[\230\364\202eD\306\302d\375\023\342\2069\2069\206Q\353\020"
+	.ascii	"\0132Y@\242?\245&\031\357P\307\207Q}t{J\332\236\236\206P\353"
+	.ascii	"P\013\252\254\034Q\240\024\224\026\244\033\037Bea\221\205\310"
+	.ascii	"H\332P\306?\2241t\372p\365\003\212\023\032\252\361\241\223~\002"
+	.ascii	"]\243\313zHc\030C\307\225\023^\326\303\031\317\222\241Y\210\250"
+	.ascii	"N0\333n\037\"\271\r\231\276!\007\0053\216\352\2344\033\2279\246"
+	.ascii	"\341\322\207L\303\030\300\270.A<\262\036*\r\223\240mjc\222x "
+	.ascii	"Q\033\2225P\356\t\206\231\254\205\\\206G\033\251jK[\326\302."
+	.string	"C#.\257=\265\254\343>\204\0217,:~\337 \2417\007T\360\354\250\316)\257f\311\250-\313\220\350\303\242\263\325m\017\215\217a\214\250\243=-Y\377\303\030\303!\265\214\252\210\213[\272\205\345\211#M\326\303\240\341\013\240\027\331\030\256\254\207BC\027D4If|}\365\r\201\254\254\246\364e=|\207?\304\034QB\240[zB\276\343^\234W\326\302=a\232\334ef\244\f\0213B4B3\\vQ\262\026\346\t\317\374\270\200\242J\252\356\204ej\270 !\233\313ZHF\210WD5\226$\353\237\020\265\243\3021l\332\221\240\027Y\013\355\204natL\031\312zNX\207\323`Y\013\222\265P\214\220\016\2079aD\311\372'\320\bS\363c\b.*\353\013\277\b\301\374\277\225\215\213\2137\353\237p\264\205^\204r>\304\312\224e\375\023\\\354\003\360m\341\333\205p\377/\350%\006T#\353\037"
+	.string	"o\377\302-\377o\210$\311\233&\353\037\200n\377"
+	.string	"rk\377\232P\013N\324\017\336*\003\211\017I\236\220\013\315\033\023\266\013\265`.0\267&\302,\007PBva\0252a\332Ix\006\301u\201`C\322\223\221\367\0169u"
+	.string	"\2369\031\322t\345\302\264\013\321@\210\370YZW\321\215\254/\304\002\274\342\361\225\225\365EpBci\351L\351\314\322\334\231\320J\016\036H\253\221\352U\306\016\316\354\034\206qv`a\312\376_\2324\345\202,\353\037\340i\377"
+	.string	"BP\240\b\251X5\361\031\301Zk2\350\204S.\244rV\003-\312\225\2650\212PJ\031\223\037?R.\024Cs\221$\265m\260mdTQ\204Pa\330\353\376\377\206R\272\360\362\232\226)\270\240=00\274f\244:y\225\2611\306\313\353\311\231\363\260\\\\\261qq\t\273\260\206g\020\334\r\347\373:uP\373\310\234I\022>/\354\242\3033{\223R\226e\2646\005\n\023&\353\023R\035\232pH\334\020\217\254o\302\326\326\026^\253\2024\206\214\326\357\314\336\024R\3267\301(I\022\274\206\023\365Sf\205B\252C\313\313A\206\313\231\254/\"\316\310\2250K\027\275o\020\t\317 \271\367u\352`A\225<'G.\314\272\020\t\b\021?s"
+	.string	"\237\023%X\377/Ga\303c\222\365Eh\331\307\333wYzEqY_\304\330\276\b\350\376\20590T\230C\350\354\360|\177\202a\274\240B \232\335"
+	.ascii	"\202FD\313\311H\242C\214"
+	.ascii	"^\224\231\254\205C.\024\"\214\312\201\345B-\353 NDtyY_\204\222"
+	.ascii	"}<\226\201l\361`\022\025\366\020\352\020Jy-\021\366\310\316|"
+	.ascii	"\344\204\027J?\"\257$Qa\017\341\224>\323\200\f\022\230\275<\341"
+	.ascii	"\017\241\225\020\210\320\207\260\nC\205=\204T\277\265\251-xB"
+	.ascii	"}\0215\366E\300\330\027\021$\334\221\223,\031\262\226\365K\030"
+	.ascii	"#\214*\301\313~\tiPP\270\016;y\223\360\224\215&\245\274\367u"
+	.ascii	"\352"
+	.string	"\260\"\371\022\225\224\365K\370\332OOA\0278Q)\\R\223\222\326\373:u\030\336%\221\372b\304\311)\353\341\240p\345\344\204\"D\246G\326/\341\307\376\2054\2044\262\036~\276I\353\225\222S\bA\244\2707\350I\206\f\274\326\304i\246\207PZ\326/\241h\013\217\204GB&\374\276Z\316\246+V\202\b\227.dB\262\344\034\312\372xB\245\377?\226\t\024%RB%a\222\023\0272#@\036\332y\226\305\226\265\020\351\327\027%GF.\353\207\340\033\032\022\026\2355\365\251\345\r\251\312\210\261\t\211.,Z\275\340uMe-\214\221\233\004\261\322pU\375\216\2148i\312\372!\354\266PH($|q\r\357\323Zd\212\275\302\027\345B\350\342\302\027p,\321\333\263F\b\270\375\013\201\204@\231\312\203\273\251\020i[\370\n_<\207\337\267FP\237Z\336\266\342\345')\353\207\020C\203&\3107\246"
+	.string	"xp}jyP\250%(\276`\032\033\"$\031i\3666\236\027!kz\371\311;\274B\243\251K/D\223\375\007\363\202y9\214\002%\n$!ECd\331\331\005\313\214\341\210\226q\322E\204\367`\231\265\206\336\024\0162\377\177\301\273\240\254*2\301\273#c\276\004!2\364J:\003c\314\257\nN\255KX\326\017\361#\370%\370%X\267\177\330\232d@]\270\321=Xw\226\025\3651\225uPL0L\332\345J\031\214\254\203s\3010K\220\276p\t\243\226\0212\003$\f\030\0163\302`\005\301\260=T\250\016)5\262~\210\034\373g\301\216\241,\030\020H:\024\365.\241`\266\004\267W\003\247\003JJ\326qqS\234;\220\324\220\262~\b'.\\\202nQ\212\226\204\375\310\372!~\336\336\202n\373\007\213Y\237\232V\337[\346#\353\203\250\333A-A-A\267\005L\031\022U\257\004\325"
+	.ascii	"k{\320M\303q\305\311q\311\222%H\305\312\351B\356\213\315\n\032"
+	.ascii	"ZPm\n\216(\022\324\035\221`\332\203j9\212\21522@<\257\\\tZ\021"
+	.ascii	"\343T\003\206\210\f\032Y\037DU\225*A+B\212\242\257\023T\007\265"
+	.ascii	"\212s\007"
+	.string	"\224\331\203V\324\240\255%\350\235\032\364\345\310\016\030Y\037\204\f2\262 \225>\347\220\256\211F\231\254\017\342h\312\224 \225\374F\351i,hM\276\250\244O0YnD\262>\210\027br\316\276(a_\242g\240@i\023\276\200\212\"\226\365s\242_`@!\372u\322\360\n\211q9\303\354\347p\331]\317\240\023 a9n\3739j\233\213+\030\205\263\340\372\324\264\310(A\203\262~N\331\0162\t2\tF\025 +\210(\345\305\227\265\254\237\343\265\037L\202\203[[/K\207^\027e(\0241\353S\313\313\331\332/\303Y\350}\201\004\240\376\200Q9\311\n\376\bj\261U\016p1\364\002]\221\220u\227s\265\237c\205\205\305\312u\340\323h1\304@e\375\034\034\373\017^\005\257\330\270t(\nh\352\0032H>\254\344\275/Z\b\230\007X\031\271\254O\202\227\375\340\020\034t\026y\031~_(Y"
+	.string	"\205c\022%\001m\237\004(\373e\377\263"
+	.ascii	"\210B\266r\004\311\372\301\0378\030\344GP\bP\b~_(\375\212\246"
+	.ascii	"\232D_\245g\b'!\311>\tV\373\030(d\245\242\nZ\341dy\365\251\345"
+	.ascii	"\255;\306Xa\251z\320\212\255N+/\353\343\005}\374\377\001\323"
+	.ascii	"\3600\363\364\021\354\361D\345"
+	.string	"\326\203e\362tr\006,\353 \017\022pHI\005\243\260\246\362\224-UMY\237\204\244\240\216\240\216`\324\0231\250\350\026\223\021\344\025\005\024\302E\254K\230\254O\002\320\323S\020G\030#\347\353\344\324A\343\b\212\212A=\210C\233]\231\"#\353\340\215\337S\031\274\250\325\317\364\214\262-\26614h\004\235\372\234C%\031Ft\324x\320)\210\005,\311\311\223\227\245 [Y\177\204\270\240\214\240\214/{\316\327\t\252Cn\203\232[Zcb\302kXGP\237\232\026\032\337\226*eHHA%|\343\252OM\353u\322\352\200\335\246\230\t\311:\250$\245\354\251\226\365\361~5\376\377<\320\003\253,\211\221\021^\343`\243I\253\003P\314\231\204\224\365G\020\262\377 \021\206\006\211\322\247~\276K\353\330\035Z\b\251\236Z\017+8\206\206\360Z\t\232\372\324\264\254\210\234\374d\375\021\230vP((\024|\261"
+	.string	"\257$A144\256\250[Qe\321\254\377?\350\342\215\351\313\233\365G"
+	.string	"\n\376\004\177\202@\273\002\254\251\337X\f\252\251 \320\3174\026\030&E\262\376\2072f\200{f\200}|\007\366\245ZP\316.Y\003\323\344\345\001\365P\300Br\002\347\300\346\364\320\034\2507\003\332\345\2245\360\f\033f\310\325\215\265\254\217\227\256Z\222\366\320d\375\017\\\366?\210\315\001\357\346\200xd\016\304;]\215\214\034sL\304\210\001\216\311\261ry\365\251\345\251=\354\312\030\321\0358\306n;\311\345\361\310\032\030]\235\236\252\314d\375\017M\200ul\230\2710\246\264\254\377a\310\376\207\032[\016\bF\356\313\227\255\2323\036^4\262\376\007\243}\021\320\354\037\030\027\2272\301q\3622\001\315\216\352\234\264\336\027-\004`\232\215&\276\254/\002\333>\360\r\003\271"
+	.string	"\271\244Lr\336\227*\307z\345%\202\225}\2342Y\333\200[\332\360\232\233\033^+\263^\301\r\217\244\210q\201\262/\302\025\025\340\032\025 \0330\313\201l\277\255\256\2600\340\330\307\200j\035\b\275\357\213\267ET\221,\321\327\311\251\003\266\341\3542\004x\345@5`\332\026\2228g\032\020\355\315\311\265\004XuE\204\013\024\020KfZ\303\343R\2225\260\n0}\322\206f(\353\037x\006\264b\245\212V\220\224\347\213\303\356\212\013h\366[\222\344\274\221\2275\260\f\303\265=\221\343\2225\220\f\237\361!\331\020\342\372\377\023\0221\231\345\310\372\"L\355\213`\004\005J\201\342\265\365}\3613*I\351uR\352 &\206\327\256\001\350}\203\3367\007\216u\351\no\337"
+	.string	"X\3661\023\f\f\203\002\3030\027\316\373cG\302\325\3243\204\033 \312\376\201O0\024\370$\207\375\206\336\227i"
+	.string	"vfJN!\260`\200\324\330r\362\365\205\311\260\360\276\357\317\363M\272\351\273s\352\300\032\351\030\252\222\365\r\340t\342\004\257\355\367}\1774\274Auh\234L\317'\216\303\357kf\200\237\375\003\233"
+	.ascii	"\233d\252\016\032^\241:\033N3\373\007.\201\002\227\344\251\016"
+	.ascii	"/\020\220\007wWJo\b\017A\214\022%x\016\277J\"\322\004\265m\240"
+	.ascii	"\026P\013\327\345\3505\2050\006Dr\f\005\"\001Z\341\245\367\005"
+	.ascii	"\032\262\326\360\n\341y\344\b^\203BDJ4\004\"F\214`\275\374\276"
+	.ascii	"\357\353d\241D\270\242O\033\350\004:q\037\002\314L\311\350\360"
+	.ascii	"\020\202\366\217\241/\003\016I\207\214\242\272\216\274\357\253"
+	.ascii	"\001\347"
+	.string	"\270R\243*\353{\330\333\300 @*5+wY\337\303\335\006\376\030*\252B#\353{\230\333\300*\245(PXY\337\203\226\375\003}"
+	.string	"{"
+	.string	"Q\252\001&k \217+Ox\\\262\276\007\263\215\355\332\3208\353\354\336\352\346\334\316l\311[\343sr\021\243\326\347\214\262\205\001Sf,D\334\017\fvsBA+L\324.\013N\343\324\2427\205\016\303\021\325\367\215js\202\215Y\213N\321\203\002_"
+	.string	"\217\200P\300\034\300\032@\027@\032@*`\024P\007P\n\b\004\304\001\374\001:\001\237\200;\200A\300\031\300)\340\r \f\240\f \021p\t\230\004\264\001,\002\306"
+	.string	"\016\001\225\200M@#\240\020\020\tC\201L\277>28m\367\370s\320h1\247\031<4'\220\351\307\307\005d\372\245\rE\367\242\244P\314`*\321;\265\234\274)N\316h)Q\273,Q9\340\033\303\311\266\347L\203\317\260\233\023\nJ\302\200L?1\030\016\273U9`\211\034\034\235\035\220\351\327\005\237a\264\243+>\255\367}\022\305\200\031C\206\005}\017=\366=\334\330\3670c\337C\320~\001\354\366\013\020\267_"
+	.string	"\260\375\002\004\331/\300\323~\007\276\375\016v\373\035\342\366;\250\355w\260\262\337Al\277\203\223\375\016D\366;\320\330\357@\264\017\002\337>\bt\373 \240\355\237\227\237\034\206\342\374\276\324\340\267 $\250\254\017B\331>\301\213q\326\367a\234\365 \200\355\203p\265\017\002\215}\002\224\331'@\332>\001\272\366\t@\265O"
+	.string	"\240\375\001\310\355\017@m\177"
+	.string	"\320\375\001l\355\017"
+	.string	"\310\376"
+	.string	"\224\256\374\207\366\377\260\3505v\356\215KTT\326Cl\263j\241\234\377\256h\271\022\345\312\372W#\346\312\214\273\254?"
+	.string	"\027\373\377\225\375g\366o\254_\225\254\367S\004\313\222\254\263\023\276Y\177d9\377\225\261`vlo\326\001\3006\353o,\353\275\001\375\370A\3457\245\ftL(k)\352\020\0355\310\262\376\007d\366\325\027\247V\026,G\344\234\277\256\237\327O\354\027\345\007\345\347\344\367\365\203\376\236\374\300~O\f\375\205\375\226|\223\3711y\376a\3759V\277\037\304\364}\251\3322^\2225\247\022\265t\354\317\311b\303f\214\200q\242\371\205\375\220\3403b\372\2769\2648\261\231\260_\223\037\027vsbAI\230h\330o\013\0331\212C\243\345\001G\033\351\270\202\201\303\205\331\253>\2441Y\377\003(\033\223\341\233\365\037 \331\377\300j\377\003\247\375\017^\354\013\300\314\276"
+	.string	"\276\354\013"
+	.string	"\313>\001\337\254\027\300s_"
+	.string	"\316}\001\330\330\377\257\310\317)v\324\343E\326D\266Z\020\247\034Y_"
+	.string	"C\373!|\304\210\376\202\374\254~?\322\247\363\007c\252H\310\017\310o\b\206\376\202\374\252\362\363}\205~A~=0\034\353E\244*\341\350\242e\353\337\217\263\355$dD#\353\013\340g?"
+	.string	"\321\375"
+	.string	"\264\355\007\240\312>N\202\177T?*\270(\373\377E\3757\365\377v\374\244\262\336\f/[\220\262\254\263\033\276Y\r\200m\326\237\216\234\377\242\364\022/f\356\262\016\341\306\1779\376\037\324\017G\326\233\341\t\030\020\227\254q\025\276Yo\260\315\232\315r\376\273\301w\005\311\312\351g\003\b\365\"\243I\326\017\300\326\317\351Gc\035\363\326\200\312\372\001\230\372\315\3705\375'\343_\3234\226\\E\224\246\226\365\217)\347\277\246\276>3\253\254\211\277\245\213\371\351\312J;\372O\351\377!\375\222\3309\261'M>\262\306C\370f\335\200mVl&\347\277#*\321\255\244\254\377\037\3211\364G\364+\242@I\002p1\242\257\222R\bi\037\023\021\254\254\037"
+	.string	"\250\375\377\206~Cl\225:\364\002]uP\304+"
+	.ascii	"K\373\377\301\370\275X\247\\\241\342\221\365\317\305\363\353"
+	.ascii	"}_\016\230\016\207\336Y\016J\244\221\371\353i\333\344/\205\316"
+	.ascii	"2\331\312\340\2662\370\360 G\300q\215>\025h\217>.\322uSp[\031"
+	.ascii	"|x\220\024\370T\240D.A $\252\320ic\3509\372\260GQ\201[<\"\177"
+	.ascii	"-\017\322u\333\023\305!\005.RI\242\347\350\303\266\256\261e\352"
+	.ascii	"\034\305\007\023\310\344Q\311\364q[\346R\271]$\213V\037\305\007"
+	.ascii	"\246[4\272\311vD\212\246\261D\233\3649\266(t\232-\223\350\266"
+	.ascii	"M\236\226g\325\3406-`\272nS\271\324Qw\214mR\353,\223\305\245"
+	.ascii	"\222\311l\213E\r;\254k\344a.w\326\035W\211d\366\254Gc\313\334"
+	.ascii	"Q\217J\344\212\226\271&\223\255\273\243\246h\333\346\216\312"
+	.ascii	"cl\231n\223\247\345)*\333\236%\221\247\345\331\331-2\305r\251"
+	.ascii	"\023T\266=\313\343\316Z\202\tl\t&\374\332\243\207\335&\221;="
+	.ascii	"<.\3336\227I\235\235\265U\"\223J\344R\271u\226\311\244\221gU"
+	.ascii	"\266=\313\035\365(>\214\240\243\301\261I\242\335\321p\024\037"
+	.ascii	".X\261d\242p\227J6\205\3162\331\202\351\026o\216\312V\206\236"
+	.ascii	"\243\017\353\"\225\310_\322\250\202\331\272J\022)t\220%*p}\226"
+	.ascii	"-\017\262\204\3336o\202G\361\241G\307-&\223)\270>/\030]\343\210"
+	.ascii	"\036\235\243\261\305\321\00429\302\207\013\212Gc\213\3430\231"
+	.ascii	"\364Q*\227J\266\351\372\364\024\225H7\211\3641Q,\022\233\256"
+	.ascii	"O\217v\217\342\303\332,\326\2340\272i[\264\200\206\346\tcr\205"
+	.ascii	"\366\204\261\351\003\034&\223>\024\340\251 \231\364\241@\n\035"
+	.ascii	"\243\333l\213l+\002\244\f\305\024:FW\206\242\022\351B\261\251"
+	.ascii	"D\302@<*\221\017\020\276@\002\206\b\274@B\350\266\021\3209\032"
+	.ascii	"\207<+`\370-"
+	.string	"U0[\031\3346\002<+z\204\315\325E*I\bM\3704\213I\243\212\226\007\351\006U\013\232G\345R\247maL\266\307\r=m\233\0042[\267=Q\263,a\203\302%!\347\002\027\226%TH\241\263L\352\330\254+\t9[\203\370\3406\215\311\325\365Y\246!>\270>Ku#\223I$\317\260u\2151\360 \233,[\302\207\346OE\233\302\270\023<\212\017m\n\343N\321C\nm\n\343\016\220(\342\203\206\241\t\037Z\036\244\3536\215\311\232\326e\352 y\206Ic\313,\226`Bs\2514*\205+\264\256Q\007yT\"k\202@\027\251$\301|\300\262\304\005n\333lc\b\246\320Y&Uh\231K\025d\250q\221J\022<\255\333l\321\004\036\225m\263f\004\t\030\224H\243\013)t\226\311\340\206#s\211\001\036#\363\304\222\t\003N\323\3075\2722\264'\2140\264M#\023\002\026\244\320Y\266"
+	.ascii	"la\303Q|X\"\217n\363\206\311l\217ns=\256\260\205)t\226I\245\005"
+	.ascii	"\212,\310\220B\013+\330\324\270H%\t\013, \341\203\3134\366|\260"
+	.ascii	"\300\006'\224H\245\322'\206\025\303\225\004\317\212\236\r\311"
+	.ascii	"d\n\314\345\nM\031xV\364l\340*Ih\340Y\001C\363\327&\217\310\237"
+	.ascii	"\213db\200gE\317\220gEO\r\2619\202gE\217\206\nx\226\314\025\226"
+	.ascii	"*\360\254\350\261\240M\232\360Y\036W\267X\202\t\356Q|`\301\264"
+	.ascii	"9\266\256\021\351.O\264J\034\026L`\217\221G\207\251.\231=\307"
+	.ascii	"\226\0053iD2\333\346\006\026m\262\307g\304N\322\210\002\250D"
+	.ascii	"vP<\341\223\354\301\331\340\266\315\226yT\"M\024]c\263\310\343"
+	.ascii	"\303tS\264=\315\f\204m\322\250\003D\3520\217H\036U\211\344\331"
+	.ascii	")tZ"
+	.string	"\024:,\214<\273\331\266\314\023\355\2106yB\231\002\217Q\005\025=;\024\034\223K\024\315\226\211\242D\353\032U ]\235\024\332\343\322\005&\322\210\243D\352\264M\237\"\013#O\221\0053\310\302\307Xda\344\251i2\227Lf{\263\006\333\343\222g\203\253D.{\334\266\251\301\221i\\\301\\\356\034\333v\007"
+	.ascii	";;K\327G\247\330D\2620\026O\370\230h\217\027\264\350aj\320&]"
+	.ascii	"w\311D\341\026\231KW\307\270S\\\272>\306\342\t%\022\205\273\\"
+	.ascii	"\3624\213:L\017\216K$\263\355)\356\364$\213-\217\221\271S\324"
+	.ascii	"a6\213\310f\223\311\341\210,\272H\245\317\020D\222\005\263Y\343"
+	.ascii	"6\215;\305\243"
+	.string	"\217\321D\261\351c\242Id*\233E\026\314b\333\364)\3564\231:5)\232F\236b\263\330\036\221\305\236&\017\006\356\022\tt5\234\350\261\340\204\022\311l\217\314e\033\303\215P\203r\211l2[\025J\022<+`\330\300\263\002\206c\253\243l\321TZ\240m\372\020\335&\323\347\001m\323g\330\202\351\266<m\262-\261!\271\324Y\272K&\f.s\331\323T\032\231%,\250a\266<\310\022\307\366\204\322h\302E>\300]\242h\216h\233>\026\270\315\265Y<\201\334Q.UP\321\216h&}``\266\256\262UAC\353\032c\340Y\001C\n\235e\013m\261=.]h\231>I\244qg\330\026\233\255O\b\332\030\230\355\321\270L\272\313\245\211\013\334\0240\360\034wV\246\321m\002mt\\\035\367\227B\211l\241\347\350\323s\364\371\225\270\016\222\331*\333\023\373%\230 \202\t'\260`\177B\002HH"
+	.string	"\t\353OH@NN\002L\310\3317!'u\213L\3275\022\335\037\263M\301\\b\240x$\221\242itw\n\235e\013=\313e\013J\244\221Gx\024\037\334\346\262\247ht\215#x\226\314\236\266\005\246\320Y\266"
+	.ascii	"\\\252`\266M\241\233\002\006\236\025=\353u\334b\n%\262\205\236"
+	.ascii	"\243\317\357(>\244P\"\223=G\037\017\230\255\nf+C\023\271\217"
+	.ascii	";\031\331\314Jd\221y<\032S\350,\233A\267hl\006[$\221<\306\235"
+	.ascii	"\242\022\331\004\272\305\237\313\\\366\034\305\007%r\004\267"
+	.ascii	"U\"\335V\211\001\353\026\177\315\225y<\032\227\314V"
+	.string	"\004E%\262\271U\350\264L\3552\227=\232y<\032u\n%\262\005\236\025=\254[d\272=\256\022\351\363\323i\231E\240\216N\n\025\350\350\030w\004r\212::\306u\325\3211\356%\263\305\t\255\243c\024\266\307\245\n*Z\246\220\331&\223\310\235\325mS\350\030{\212<\307\035 \262\271\354\021\366\360\030\335_\213\036f\221iL\372\234P\032\213><H\034\021\264`Ql\223\255\216\216\261\3104\266Jd\262\350\303\203\314\3005\372\204\240\250l\221\314e\321\207\007Y\201\bZ\260(\266p\221:\313d\253Bx\024\037\024\240\323\3664\335b\313\203t\213\305\255\3236\213*\334\325-\236P.\223\315b2i\324i\266h\026\213\033t\332\246\262\250\302e\233\305%\263\305\211\265)$\266<H\267g\271l\201\270\243\302\210\024\266\013l\026O(\2211\034\215-\n\235D\032]\335T\3720\231\255\212\345>\241D\306"
+	.ascii	"tO(\221\314\242\316\321\2306\213M\0134-\320\362 \335\265\311"
+	.ascii	"\272J\237\245\n\301c\360\330T\256X\036/\310qO(\221J\244\221\247"
+	.ascii	"\215\241\331&uZ\350\3244\213*,\231-Nl\340\361i\246\256\262\310"
+	.ascii	"\2236\213*\332\243\333d]pA\206crY\344YeX\321*\213<+\323\250\""
+	.ascii	"e\232@\036\305\207\001\234\030QSd\217\342\003\210f\221E\353\372"
+	.ascii	"\360l(\256\305\"\313l\225+\226\305\"\333d\266M\037e\261\270\217"
+	.ascii	"Jd\212bqm*\221=\315b\221U.\221Md\262-\026\177n\321m\"\223\032"
+	.ascii	"\216\342\203\b\307\226iD\321\024\001\001.\213V\251D\242p{\212"
+	.ascii	"\305\013T\264\314\236bq-\256\305\265\025\001\262Y,\256)t\226"
+	.ascii	"I\355\"\225$\\\244\022y\243\\\341hl\231+\323\205AG\351\263\202"
+	.ascii	"\3215\2168\032\333\030\226\314\026\021\340\240\\ax\024\037\220"
+	.ascii	".\213\226\331&\217J#\013H\227Ek\343*wr\263\250\323\306\240\002"
+	.ascii	"\322e\321n@\272,Z\355\236`\246\220B\307h\"\2314\352\004\233."
+	.ascii	"\2136\3506}L\004\233>&\322f\021\331#\203\313\242\335\252\022"
+	.ascii	"\t\203\262\251\263\266'\216\0208\241D\036\215m2\210\354i\246"
+	.ascii	"\315\242\n H\270,\332\255\003\002\231\036\305\207\246\217\t\016"
+	.ascii	"\315\242\013.\213v\330l\266\314\343\321\310\266*\214I\031|zx"
+	.ascii	"\266O\261\355iQ\242\351c\342\307\242\204\213T\222(\246\340\302"
+	.ascii	"\210\032\267\331\272\232E\f.R\211\\SpaD\333\364Yw|\036\300\302"
+	.ascii	"Uw|\036\300\202\251\252h\217i\2334\3524\325%\263\335\300\222"
+	.ascii	"\331\342\304VaD\nn\021D\b\237%RE\313\204\201\202\025\306\030"
+	.ascii	"T\030\001l\231>\256\221\331\366\360\264n\320=\212\017>=<\305"
+	.ascii	"%\263\305\t\035\035c\001\332b\f$\210 \301\004\237\036\036\033"
+	.ascii	"\345\022\351\372$\227\315\226\tl\026+h\213>=<\301\325M\3724\333"
+	.ascii	"\030\332\021>=<\024\264E\345\td\322X$*O \223)\024E\300\302\004"
+	.ascii	"Z\327\030C["
+	.string	"\034\222\200A\206\366\270t\241\305\321x\3741\233;E\024'\220(\212;=I\341NO\262(\002\024)@\204(\242\240\240\331\263d\216`\266G\244\n\344\b\237\036\236\032\267x\302Xb\211dO\030K ]\026\020p\225$|zx\206m\221\3302\215+\216L\241{\024\037\232(\\#\017\017n\026\213=;6,\220L\327\350\202r\211t\215\356\222I\\2[\234\320p\242\215\301\350\032G\350\350\030\201*X\020A\267YT\321\216P\321\216\220a\205\221)\254 9\274q\217\342\303\222\331\342\304\bM\346\262\251l\233\030\204\b\202\b\341\366\020}\212-,\231-N\330\270\315b0\307\355!npS\340f1\250\346\264\256\321m\256\255ktep{\210 \232Mc\317\212e\222\230\223\303ta\320\3406\213[\271B\213dOO\n6\356Q|\330\031A\271\344\341Y\352\270(N \333\025k\263x4\372\204"
+	.string	"i\202H\202\211\234c\"\2030\221s\214\031\2041\347\260\310 X\344\234\026\031D\213\f\002\205\216\273T\nE\300B\353\032ch\223=<F\031tt\2145m\323\002\313\022Kf\213\023\277\366\270tA\271D\272:\255\273d\302\3204\262\260d\2668\301\341\204\022y\"\002I\243\317\210\266\351S\201[d\321\036\225\310bS\007\311cT\2668\026]\024'\220\311\235\013\232H\026)\234\3601\321\216X2[\234\0302[7\211\\A\250D\2620\272\360[\366\260\200@\253\202\351\243\302NO\013\312\026\307\232\024M\243\013M$\213\024\226\032\334\"\210\020\020h\201\304\n\372(>\270:>L\2679B\263\355i\341\216\320t\221&F\360Q\236\020\201\205\217\022\231\024\241\004\023\212&\234\300b\204\366\350\223\324Q\"G`6}F8"
+	.ascii	"\210c\333\364Q\372\024\367\312t{\204Gc\313$2\335\236\243\262"
+	.ascii	"-\n\217\312\266\270\343c\242m\032M\f\333\246\321D\261\307'\205"
+	.ascii	"\216\321D\361\005\022\305\232\243\262-\266*\214\315\342\013$"
+	.ascii	"\212\302&\263M\3014\362\024\267\022iD\241S\\\227\312"
+	.ascii	"6\211\334)\262 \232'\214\311\235\"\353\026\331crY\f*y|\222K\235"
+	.ascii	"\"\323G\247\030l\223&\214\256\212\"\221iD\241\243w|L\270\314"
+	.ascii	"%\212f\361\347\026_ Q\004\246\320Y&\213\252[,\301\204\235\235"
+	.ascii	"e\261\370[\026\331\027H\024\203\256\n\235\366\270\324)\356\027"
+	.ascii	"H\024\207F\327x,\266G\344\212\"\020\002-\220X\241\370\002\211"
+	.ascii	"\342v\233\310\344p\307\307D\261\3312\333\226\271S\024\272\305"
+	.ascii	"V\004\310\346*\342h\354)\026\327\366\270\344)\252Gql\333\236"
+	.ascii	"f1\350\026]\346\022\206\027xV\364\324\270\305\027H\350%2\273"
+	.ascii	"E\025\230-\017\322%\036\305\007\327\247\307\365Y\026"
+	.string	"yV\364t\260\323\216h{Z\224(\272@\242D\220\007\351\246n1\006\025T\340A\272\233\251\243\223&[\245\322\210B\207m\223F\035\031\200n\333\334\331y\241m&}z\202+\226\311\035f\253\342\205V\207\271\334\031\262\315b\253\203T\321\2168\212\017#4\231\255\n$\363\230\301\227=-s\004w\271d\216\020T\256X\036]\037\024\315\335,\226\270\300\320E*I\270\315e\317^\226H\032\225\314\326e\001\201e\t\227\331\252P.u,X\333\244\tc\023yd\217.4\221D\227ite\b\252n\321\204\034W\211\364\331\256\222D\353\"\231+v\353\266\311\036\236\245\n\255k<\366\370\020\333\244\tc\t\025\253[<\301U\"}XW\351\263\324Q\217\255\b\220I#\322E*\221\301c\313\272Ew?'G\205\016,@\201\bl\235\017-\224 !\303\bn{\202itGP\"\215<#\3500\233#|"
+	.ascii	"@\323\205\226\007Y\242M\2320*!\300\\\272K\236\r\311\345\362\001"
+	.ascii	"E\365\177\r\220/D7\256>\253\232\037\303+SG\257\325\023\323\030"
+	.ascii	"\002\247\243jKK\031\022V\347cg\325h\361\350BR\323c\310%EO\213"
+	.ascii	"\307>\022\214\n\022\342\205jh\025\374\262\347dhj\030\265\004"
+	.ascii	"\r\0271RP\370\250N\307\317\216]\225\325E\365\"j\310\224\366x"
+	.ascii	"\"\366\324\261\241\b\201\242hI\223\003\330w\303#\311\025\216"
+	.ascii	"\237\231vz\236\031\002\005\304[\223\334\200sqc\373\350Jj:\362"
+	.ascii	"\364\033\323QQ:\274\330(\022\246\311\001%q\332C\202BfB5j\f\303"
+	.ascii	"~V\302\262\366h8i+,Jbf\354\257\325hN\212\013\031C\240\026\024"
+	.ascii	"\017,Ml,T\02284&\241\026\271(\036F5K@\253!7\322\2242\224\270"
+	.ascii	"\246>hMR\320E\232!Z\362\236N^\370\354\216\206d\033\314\235X\220"
+	.ascii	"\0211-\377\210\352\261\245hJ\030\345\252H\226\032\242_\016\255"
+	.ascii	"\032ga1\210Y\352\332\2144KCQ\032qE\352`D\323\2470X\216\270x"
+	.string	"\315\213\017\217|\371\031\032#\264\363\262\213\272>%AX5R\226@\005\251\001\332zA\027JY\\\324\374\020\225\302X\031\323\253y\2111\232\202D\251\022\245\301\n\204L\2113\353c(\221o\2307$\002EG[\032\"\324\2149+Z\366\204]\257&#\005H\231\036\321\b\337\030\260\2623'\242\001\343\"J\030\226\242\326\265\304%/\350\246\277\346\316\2441\003\004B\204E\007VF\2305|B]\251\202g\265\227\312T\001!\363+\322+\203\312\335\r\2511\003V\305\307\030b\227\222)T<\262\006\022\021F\275%\2712\026\r\253RD\207\021b\035q\254\212S\035\221\254\201D\204Qbs4\206\210\001\nqq\243\316\2168\027\214\322a\004\343-\f\321\007T\220\252\035Y\023\345\322\023\364\365\365\365\355\275/\020Q.\023\301\020\277\234(w\214=\300\330\203\032VNk\bh\325\3047\342\0331\016+)\2151"
+	.string	"\226\2451y'v91N}1G\346-k\"\227\237m\275(\\\\\262&\302\375\214]\3232\245\003\005\260\347\0327%\367\305m\347"
+	.ascii	"f\235isj\333O'\220\342\004N\213\220\312\317\314\333\031\024\333"
+	.ascii	"z\224{\3501\t\"f\021\246\031\021}e\255\265\375\370\351\312\232"
+	.ascii	"h\205h\205\230F\301]\222\022-%\3301\244FD;1\355\214%\022DcK\326"
+	.ascii	"\3043\"\026v\252\307\213'\"\026\342\225\035>\320\334\330[w@\370"
+	.ascii	"\262>\n[\304\262\023\211exHz2\362j\204\254}\301Q\005\205\022"
+	.ascii	"\307\260\2237\211E0F\037\0208*'\216\255So\\ZY\023\247\260b*\325"
+	.ascii	"\035\226!Y\023\245\210\341\360\362\"\2061!\371\260\242\005Lz"
+	.ascii	"\021\325\003\312\211aqz|e\262&>Q\315\314\330\231Y\2225\021,O"
+	.ascii	"}\315`\303\2215\361+O\375\272\332llM9\311\004\371\311\372(,\021"
+	.ascii	"\227\020\227\020\273\232$qE\327:#21\317\023\273\326\250\340\341"
+	.ascii	"eM\344\372\230\326\027\2514Y\023\233|\254\213G\331[\326D&\037"
+	.ascii	"\253\241\322%\007\244K\222\023\225$"
+	.string	"\021\246\341D\375\330\231P\003IO\206\326;\344\324!\343m\021=\311\232\354\310O<B\3142\203\244'#{\231K2Crb\326\031\211\036CBY\023\261\266\331W\2275\272\245 0\220\030y9\235D#\034h \371\260\022\\\0225\347\244\310\211F\350\210K\316\242g\262>\336\312\366\377W<\373\221\227\365\025p\204hE\264\"\016\t\3423\302\204cm\210(\344\304!gGH\\MY\023\203\b\245\274L0\216\262&\002\271\030\fD\354G^Cc\373R@\220\034'F\345 \372\300N\336$\233\245$%Z\264v\214\347\332\022\325\211>N\354!\234\243+\343\306c\233\225]u!\356 N\351554WD\251]\006u&-\353+\340h\023u\364\021\231N\224Ad\"Bm\251\365\220\322g\343D\250\023o\200\020\3613,?H\320\254O|\":\t\317\240\322\366n\020kl\345p\212!\326 \322"
+	.string	"\332\302$\311\317\305\223\345\302Q\364\022g\020\233\346\210E\304\"\242\222\217;>#[\311\205\231\024b\322\211Jg+\350\206\254eMD\022J\251\322D\211P\326\304\243}\267\022A\3111eM4\372Y\331\217\271\004pA\363\241\036\032b\f(\"\026\222\236\214\274\032..\036mD\027'\3068q\b\204\210\237\ri\350\030\322\225\365\2110j\244\200d\250eM|!BZ\005d\025\204\bD\024\322\2132\211\035A\"\204\215\030\264\315\240\234\t\002\226\3650\r\361'\315]\f.B(`\364\342\262\376\211\357\260\017\212\2164w\034V\033A\002\215r\250$\004\216\024\210\211*\263H\224\211I\022T\320)UD\333\002\243\025"
+	.string	"@@H\"\022\250\272\254\312\007\024"
+	.string	"\020e\306\212lN\240\254QV\"\205\006\004"
+	.string	"\200"
+	.string	""
+	.string	"\b\200\006"
+	.ascii	"\251><\036c?\315\313-n\357j\213\233\002R\332[\2245;i\030\200"
+	.ascii	"\321F\354\203Bk\324\275\256<\233\0338aV\213P\003\003\344\230"
+	.ascii	"\335\243\215\302L\345\332\356\307\257\273\234\252/R\005*g\377"
+	.ascii	"\315]\036\b\006}&\022im\230\324i\224\n\303%N\261vA\302\217,A"
+	.ascii	"H\257\323\227)7S\244A\2214c*\206I(\332\f}<\3470Z\271\263\312"
+	.ascii	"`\202P\212\262n\250\355\2260\327\241\371mf\254\3750:~|\340\317"
+	.ascii	"nw\213\0314\234C\270\336\255\334\326\215g!\310\346\332 /v\233"
+	.ascii	"iI\232\215K\2651\3271UL\177\211\021;\220\257\234l\017\266\245"
+	.ascii	"QJ\312_\240\t\220\234^\206W\236Re3\213\034\210\316b\016\363\276"
+	.ascii	",%"
+	.string	"\354~\t\254V-h7\366.X\220:\207\253p\0041upq\376\363+\326,\034\261\025\350G\222\n \013\016\334m\212\327P\304\364Z\314\357\267@\245\356\250\250vC\025JG\277\242\254\217M@\037cM\223\312\237\003!(\352\317|\036\246\020\336\354L\220R\330\220\\\255\025t\351>a\254\2502PS;\312w^\35759\n\371\304\245\361\342\n\240D\004.\351\377\220\322\260#\320`\003\016\331[;\327\371\375H\324\030\275Kq\002j5:\276\374\271_\331\020\276\276\252\362\024\342\005\006@X\260\302tB\302\261\37235\342\351PC\001\232\322A\227V$U\025\303\342\"\200\364\003!\366\232_q&\007\177\272c5\341H\025"
+	.string	"K\021=\004G:\311\342]).\350F\233~\312\265\251\315q?\221T\\\341\220]\2062\272x\004#\321\032\311\205\030n\320\030\215X\n4\374M\006\204\023s\307\200]\"\333n\216\305\030F\353\344\370\215\377\002\340J\325\363\327m3\364(6"
+	.string	";z9\300\320\255\036\251%\230\243CW\341\005\037\264\306]\242\264\266\235l.\261\021V\007\325\bs\210\003\246\025;A\317\200\220\244\006\270IYIx\337!\275VE\"Yu\357\326\024J\254 \230\245\246\030\243?\232V\332\225\260\364\374 \361\242\266.R\024\016\242@\333\201\300"
+	.string	"\001\375f\346E\317\272\232\306\t\263 \352g(r\023Z\3265ccO-\332`\006\312\313\243\341\303]b\256\021\2476\362:\356\242\250r\320\357l;\327\007\246\253\366\234\306\021s+ \246\377\004\211\272 \275QqB\231\276\035S:\230\002\004\031\037d\302O\334\005\320\031*%\332\276h\341\234\367W\354L\242M\013qc\201\232\350*\2759\024\236w8\002\007\315\207\2555\306\224\177e\220\002\330\2646\007\270\333\213\237\344x\326R2+\211rG#\303\306=E\017:\316\"\214\\+1\233\263\367\032\330\266f,\223\376\327\306\340\200^\3257D\304\345h\205E^\\^\357\\\016\002\274\241\350\255\341RX\\\337\364\027\346\n\f\270\310 \340c*o\201t\233Qb\320\243\376\026\245\357V\301\274\037\300VF'M\002a\220\307\331\227\375\271\372\241\363A\001Qi\226c*\222\327\003\344+\303\301\201w\253"
+	.string	"\f\032\336\201\353\356\223wV|\301\227e\337\255\351\302\314\027\267\234\212"
+	.string	"\204(/\355)o\177\013\376\205\036\345@\377\024w\313\317u\375=\245\303\001\317\324@\344"
+	.string	"w\211:\260\202\016\t\016\271\017\317\325\323\204d\312\031I\235\307\245\220g\355\244\204\263q(\354\265eu\311\225hk\265\233\355\266\200\353\001{e#\211`#\032\005\306\345"
+	.ascii	"lZ\354|\224t\022}wX6bu\232\356an)\371r^\t\032\225\t\213\217\267"
+	.ascii	"\032/\031Tn\210\200%\320\313\323'\001\336iD0\245\210|\366b\230"
+	.ascii	"B\237]\306\201BS}!E\235\013\037\274\003_8|\f\344A\246ZM\353\347"
+	.ascii	"\236\316\365G\3451\372~\004\267\207K\024\326\235=\365\252\373"
+	.ascii	"\\\007\333\336\341\340\261\204N\206Y\301\310\023\310\r\246\202"
+	.ascii	"~\006\271K\274Fa\234\250r\355\373\237\231\304\027\271w\013\255"
+	.ascii	"v\301\307\025\\'\271b\342\230\2411K\250\034\306Wi\304\271\004"
+	.ascii	"~\371\330)\226\006E\227\270\360q\\i\202\353\260H\342\272\243"
+	.ascii	"S\242\377\207@\200;\307\333/S\256\236\355S.97\262\277F@\356\357"
+	.ascii	"\262\232\353 \345P\320t9dAB\361\233\370\344\211g\206\026\353"
+	.ascii	"\2103\314\332NV\tQy1\023E\251p\016\323g\b\275\343qw\352o\030"
+	.ascii	"\322\361Y"
+	.string	"uldZ`,\234MLn\3272\206\301\203I\363\206\227(\353\275a\026D4\0318&\2624\305\226\376H&\211\262\203?\235\025k@MO\205-?Q\227\035\251E\251\036\236\035\031\221\350\361ix\331@\321b\200.\207.\202\250\372\244\217h\023\3275\300q\2126\317\211\313o\032D\344](\005\310\231C\351\024,\237sk\240`B9\230}\220\002ZK\335\354R\336\310\213.)\004\026\317\345\034\200\360\"{\233\005\345\036\212R\231t\357\007\236\310\246\315,\367!\3212\250\346\207{+\363\330\034\231\366(\026a\313!I\276\213\373q<\214\221\236):\312\327s\013\265\2406t\0263\354o\330A\270\037C\260\261\242\225\331\227k\255\320\335\200\001u\232T\r\211\033O\fv\227k\215\b\346\305\233gi*\314\024;C\374\303;3\177\213\257D\\\277\240;\005^\340\304\334K\260\203\304w\263\020h.\206\377"
+	.string	"\350\260\207\227\361\341\277.3`q\305\"u\375\"\214\203j\355\336\362\340\363v\022\2502\243\202T\374\374\037M\016\217\017\304\343\313\306\004\204\3518Q\335\003\326\273b"
+	.string	"k\007\27591G\022\244\020.$)2\233\254\"<\036\271\273\260\026>>\001\234\363dB\241\222\007a\265\310\307t_Q\271\273\016\227s\317$\220c\263"
+	.string	"D\345\215w\214\032\037a\247w\301\211\354h\200V\234\036\320sZ\347\230\315\272V\356y\307\313D\023\374e'o\304\035|\023\342\215\373n\261\266\r\312u\177s4\365Wfza\227\365zD\336\244^\n\323\020\335\243\004\367\032\351u\367L\035R\037|\334T\310Q)?\210\260\201*N\003\237\027\236Hw\263$\237g\005\332\310\""
+	.string	"\326\fz\300\356FPf\203\024,\f\374\177\370]\b\004p\240Ty\261\352U\036!\305\372\016\007\211\225\201]\036\236,\251u\2509x\017\213\230\330\360\373\255\367\354\334\333lE\202\030ST\236\331|/B\0062\361\272D\270\004\374\004\231I\030\027"
+	.ascii	"\305\256\201\272\242l'\200\311|y:\f\177N\256\f\200)8\354\021"
+	.ascii	"\300\303v\004\nk\322\372\260e\362\336\033\214\035.\033S\204\332"
+	.ascii	"B\323<y\326\362\351\236\316\353E\333`\217\315\235\237\2444\315"
+	.ascii	"\204\275e!9\321\377\242\377\236\271\266Z\364\314et\261\321\270"
+	.ascii	"x\034\030\017QU\263\232\023\247\317\002\333\217J\252G\027O\276"
+	.ascii	"\376%1:\306\246N\312\253\216\234\267\246,+\001\370_\205\3250"
+	.ascii	"@\240f%(\026|L-e\020!\364yE\335\333\372\rp\360\271\301\232\026"
+	.ascii	"\216"
+	.string	"N\334\314\340M]07J\206\\\2162\266\026\251\\H\271A\337\202X8U\t\240\263\322\2020<\306\024\271\377\334\276\250\231?)\314\366\341\305GI\265\025wA*\211\227\355\274Ks\213I\034\371\234\265;\316\203\263\307:\244\2034R\325N\326\340\277\201\013\326\2652\312\220\301&\017\013e&\rEg\374.\275\316\3703\340{\252ajjTAD\016&|\270\340ap\201'Z\257\225P\t\313\211x!&\371ldZ\223\220!\026[.r\273\363n\r\301\215\347B\302\212\303\341\356c\245\223\246\251Hi\024*\320#Yu\307\311\035\365\376\313^Xi6E\260\0265\241\343\0363\263\302\b\272\b\207Z\004K\026\230)\022\226P\321\230\305\343\350\326\345\242JI\321\334\236\363\247\362\312bI\202X\321[\004\330\317\213y\240\036\240(\265&^\b\300\352\255\361.\255?\33610^\2604\363\245\225\326\020\\\004"
+	.string	"#\322G"
+	.string	""
+	.string	"\036v\353\334\234'\327\314\0301'\2051e#=\367Mi\033\305FH\013\273\250\267\322\214\327\255\n\232\032\230\345\311u\003\254cc\310\030\332"
+	.ascii	"n\372\035\024\r\322\021k\340W\275\330\247\027`M>\253-\247\024"
+	.ascii	"\250"
+	.string	"\244\264h0u\222\264"
+	.string	"\306\355dc\210\351\222\323S\333>o\304\2357\332*\370D)%\352Z2f\223\227x\227\002[\371\354L?\022\230\363\335L\363l\356p>\023\331+8$\226\311Cu\221\356\306\261\177\303\373;\353q\341\276\271Uw\275\022\261/\344\363\007]-\227\263\214e&v\247P3\274\341;\363\204\257\226\026\312\362F\236\366.\3738\303\333\253\273\261`\367\254\366\237Q\033\026C\337B/\364\236\306\321V\267\225\273\350!%0vg\351/\\\312\300?\366sV1M\205\254\331\221\266\022\206\253:\327!\003\001\334Q\367\022\b|Q\013\231\270R\364\005%\305"
+	.string	"p\262;rW\266\2740-\340\"N\342-L\270\325\260\345M\017k\277\004\272\236H Jm\255\324d\323w\333sY\201\212S\021C\300?^\274F,i\200U\273\206Fd^+B:\256@Y\322\240\240P\356.\354\330\205\214E\341\374o\024\273\210uk?\202}\340\177\265\267\212\320\205\237L{\n+4\356 \007\336\375;\013\336C\341\204\226 \326\260{\220t\036R:\032\244\365\r\240;\300oVp\367\303\t\305A\032\312\363\006\343\\\260\344)O\034=\375\351\214\326\3372\312\035\t\214(\257\273Hz\362S\213\306)\214\250&OJ\030q\213\024H\0257\266`\323\234\t|\035\033\r\364{\203\326\341\224"
+	.ascii	"\27514D\240\261|yB\035\206\326\331\365\241\353\016\203\032y\244"
+	.ascii	"\017g\n!9\3703\025X\243\235\201e\nh\347\233\302\224s\373\303"
+	.ascii	"\254miVd\t\326\257V5\211\266\016\2718\351\360U\215MU\026E^\365"
+	.ascii	"%5\373\320+N\357\233\312}\n\377\226#JnF\246uf,\232\\\266\367"
+	.ascii	"\352\363Bh\312\327\346\357\241\007\352}\"\313\020\004f\232\277"
+	.ascii	"H-\305V\034\023+\006\222\371\200M\r\234YU-\253O\024\372o"
+	.string	"\f\276(<\260\2162\001\333S0\235\350\241\205\364\322\271&\371\265\261\307\007\346rt\320\232\251\007\275\270\234\310\253\226\244\212x\020;A\342\316\277\213\025\2236\204\335Ii8o\225\371\200S\230\304\316U\307\316V\323<\\]\rrJ\030a\305<\215!\255e\313 \"\272\357\243B\314V]\217\037\224\253{\255R\342\326(\311\234\363cLE\320\242\350:\343\3656\033c\231\233\236\346\353\241\235vh\005e&}\200F\274\223]\214_\f\311\26149p\353\333\003\226)\320\274\200jq\361X\255c\363\257c\257|a\272\220\013\330\346\205\307r\365\222|\246\242\031)!y\t\216\037\271\355\r\367\337\357\304P\257\227\302\020\261\374:E\340\327K\244\311-\227\262\021\037\224h\352z%\213\232$O\2077?\251\003\253\220\374\340\206+\206\270\265\300~\350\262\016I\fw\365\026\351v\225tV\335H\365\211]D\223a\030"
+	.string	"\350\341\001asq\315V{k\2422=\005\n\016\013u\360\2139\0274\353\237\220n\0255I\212N\364\245:\330\240\211\024\\\204\323\277\217\320\251D@\327\322\234\313\260\215$\234%\037\274\324\363\204\307\220\334a1\363\340v\372\336n\330\256\260\322\301\177\213nO\220\201\237V\354\255\236%\216\203\341\377\225\266\255\352\353+o\273\311Q\223\215\2172\035\261`\035\333\002\271j\367#?\347\306m5;Bf\331\374\340"
+	.string	"u1@\272\353\r6O\267\233\317,@\320%e2\235\177\312\361\323\211H#Er\353\024\312\252#G\233/'9S|e\226\356\blO\334u\346>\313\nF\326\222&\233\355\364;\263z\306!\222\002\003\001"
+	.string	"\346H7\002\001oW\257\312\352\264\304!x\034\322H\262\2308\341$\004\262\316\244\032\030\b\303\361$\205%Hha\020\2376\352\016m\366\340\031c\3720\272\252\025o\026\204o\021\360X\027b\373h\324I]P\004\242,\005"
+	.ascii	"?\361kD\224\211\232\244\031\016\006S~:\002\250\251\344vE\247"
+	.ascii	"t\361.pxA,.~`\\1\f\2611\243?\316,X'/E\246{\250\254\252\334\250"
+	.ascii	"i\257\242\244\334\365cXV\261\243\204A\353\351m\346\006\203\316"
+	.ascii	"\232\f"
+	.string	"\226\2208\251\255\315\351}\333\242@7\257\267Q\030j\3375 \341\240s\026\213;\266\200\"[m\020\261\261\262\340\354\377p\265\204\220\t/\240D\343\366\2558i\bt:H[\242\333z\003\262\304\335\251\360\320\254h\206|\355z\234\006\0225V\337,e\271m\002\345\"\256\020\211n:(\225&z\272\307y\020c\001\035\2022\004\217Di\372P\243\320\327\022\213\236\315\305\235\232\001:\260\004[o\307\216U\316u$AO\343@\"\003v\312\t\007\303\212\nR\224\334\021\243P\211\341a)\305\240O\333Y\006\241\345a\331\276M\035\335\270U\211\007\365\223\301\265\337\2668\370\255t\004}[\201~\201fTo\313\351\247\376\2412d\357\352\n v\367\212@bv\352\243|p\221\271\322H\252\362r\207\237\206\022\357\033NB7\243\351(\013!\315\374\251\327I\225133\220\316\"\025\344\027\275\022\013\225\236\f\013\345"
+	.ascii	"\316\264\210\213\313[p\347\306\373\350U5\363 \311\324\357*g\255"
+	.ascii	"\313\361"
+	.string	"c\331\331\362\030\315\220\211\256'\013\254\006\322\0161}r\fFG4\205U\016v\021YV\372#-\254\006KM\217\234A\345\001V\304Q\310\r&V\020SC\353~\205>p\271\022\227\t\371Y\245;!j\264\243\207H>.\035\016\371\243ZVZ}t\362\327r\200B\252nE!\2424\2417Gm\220\304`qPn\243\350\016c\340\212\017\007\240\246\006\321}k\235F\336hS\017\211$xVZ\222\317X\325\205)\\\362`\032\326BL\301J\b\204M\340_\241_\bY\367\272\003~\232\234>\346\222\261\036`\252_\031\337\233\335O\303\257\020\377Y\232,\n\353\213P\016\236\343{\204Hs\022\331^,\310:#\363Ze\310\b\037[\004\257\0052?\025epd\240\216>h\001B\277\007,gd\231\344y\034\351\364Q\324o\261,\233W?\327\262J\217=\204dGs\326\343`\0018\250r\343x\201K"
+	.string	"\331\345\004\375\036\373\202F\273\262\307H6\032}\241+\251\252\340\265\224s\b\224\320\004\004\313\007R\023\033*/l\316f%\354\207A2\260/\341\3528\332b\342\353\n\362\247\321\"\206\235\225+\016\210\n\223\244\241\346T\345,\213#\030!\0011H}\315\360\034\311&N\312\023\267f\336eq\024\021\231s\267n\250V\r<$Nl\034\017\367v-.\245\024\200\002uu\313s\3074h \363^1\271T[\372.\351\232\201\177\207#\362\\EbF\242\226\177*x\f\373H\322\344\243\3207\201\247\300\to\225\222\274\311\264\302\226C\341w\317\035\370\326\024ID\245\247E\265\030\246\007\033\036\312T\307C\270a\220\036\231\236\315S\263/\373\231\232)\2041\274\247w\227\332X#"
+	.string	"\251\371\306(\244\250\336\003\006Tf\256\2459\004\021%\3733\006M\314M\312\235D\"\251\246{i\236\242\366\367\224FA\332?\306\3751-\337{\314l\336\351]\220\335P\336\024F\325\221\341L\255\315\307k\200!\342\314\020v%a\241-q\215\210}\033\256jc\002\"\265T\246\027\030\032~\326\306\361Q\372\270q\336\220L\006%\177Wq\367aO\027\3059rC\005\036-B\322\022oFg\370\275N\373\271C\021r."
+	.ascii	"q\266\177\207\266"
+	.string	"\234\020\352\237\244\216\t\253\3640\377\367\3233d1\246\324G\343\277\220\235\217\365d7'\030\213Y\r\003\016\273A\016\362\0377\024&\214\241j_\223\261\252\245\2167T\344Z\313|\002i\245\355\240\236\302Z\341\344\035\206\264\020\215\211h\b\323\022\334\1776\2160\311\205[\207\265[/\212\203\204\213N\\\375\272\242\016\002\277\025\326G\221O\242 <K@\212\016\353nQ\307~\005\325\251B\323\f\273A<.-~P\221\327\2303\207\321d\027\374\335\035\320\370f?\224X\335\b\307N\275\352d"
+	.string	"\340\026/\316/\020\320\371v\006K\302E\023\231\357\276\3554^\273\237W\243\367k\262\255RD6?\241Y\246y\300\377\306A\177h/\222/\006\013\341\204\342\371\217\250}\037\324\370*\247_\332\3000.\311'r\323\360\316Y\374@BL\202\r\215\\\364B\373\264\224\317\314\352a\022\200z\250_U\330\314\027\374\2151\367{\013\376j\3321;;\020{\224\222\353\365,\321\b\360z\356\n\205^\312\334\257\267\241\315\004\260>\235\336\024?\334\203o\201`o \364\240\352?\214\307`3\316\256\311\033\025\023P\221\376\341?\254\202\371\177LW"
+	.string	"\216\361\006\236-g4\276|,$)N=\334\\\005\272\370_\344$\212$\236s"
+	.string	"'\017\330$V\372.\222(\244\371\344\312X\016\001\002o@5r\t7\f,J\021\235c;\342\003\372|N\335v\250\322\021QM\212\263\300\251g\254\002\315\214j,\372\244\034Ux"
+	.string	"\301\202P\3167\177\b\231\277\"n\272S\347b\261 \214\221\330I\257Qv'\316\033\377\216\226 \f\235\231!\234(\265r\350\231\243\315\244\207`\205A\324"
+	.string	"\020\201\007\030\037\201/\272qs5\264\337\224\347\274U\256ZP\335\323I\210\245U\272\224\213\017\244\211\"\357e \224\321&[\267-w\311\347\353\260.Q\024cNoFc\021\334\353\234vK\341\004$r0o\225\362\220l\260\356\213\354\003\302\374\001\353\331"
+	.string	"\302\005\"\\|\302\3620\325\214\313U\266m,Cw\00234\200\216\f'\031\2654\274\207d\215\212v\r6\037\304\216\245\260\322\031\213\306\235\312\355)\370,\2325\3503\r\362\0045\023\311Fh\240CR\275\336!\261\242C\3628g\"\221\016\355\360\222\227b\244\301\335\001@%\347Cl\254\035\001\t?76\210\364\370\200:v\322\363j\223G\202\257\310\215*&\200\315gS0\210\332ss+\302\303\245\370\311\353\031\252\337\027\375\b\313\303\374 \3561\327\037.\355\343&\215\213\2056\nZ\375\253.?\344o.[{%\360\330v\254K\357w\202\220\367f8\353\227%\362\265\236\252\216i\273&6J\024\203z\210\236"
+	.ascii	"\034\363s\032\272e,\214s\367\245\347\243\n\022:\021\261q\037"
+	.ascii	" \227+QL\270\2068\227\341\362o\335\274\200\216\234\203n\b\373"
+	.ascii	":)\225\344\266\346\252\235r\301N:\021$a\2663r\235WoF\221\222"
+	.ascii	"%H\006\216"
+	.string	"\275\243\210\257\036#\\~\270W\375L\342\324\345%g\333\320\277\3729vf\273!5\236\301\265\204\226\r\371b-\033\3377=\363\004t\3048\376\320v\275?L\310$\007p\001F\034\241\005-O\201\222\031\360\001\205\336j\320\245d\235\375(,\222\2720\003P\203\250-\373d\0048\027$\301\210\366\233\177\020\006\274\322\216O6\274}\275!-\370\207\321\201\242uO\301\002q(\223-\210zg\020r\t\025\252\0032zdb\317g\023*\254\346q\321\333\231/\216\206\214\211\003\351\001\211n\264\325\267\004\236\006\320\315p'\252f\335\002\355\316\360 \212\203G=\"){;\341\267\266\006+UU\222\332\350\363\372\263\373Z\033\222l\321\217?\335\244\320\221[*\344\214Oc\364\034\013\347\205\027M\025\216S\003\253\323\031t?\333\347\305\230\213\307\266\310\302\371q8\313\311\306\034@r\345d,j\023U-}\bD\016"
+	.string	"^\227f\253\001\262Y\326H\314z@\026\327\332\337\353\272\020\346\315U\327\3219\314\241J\217\021\303Lpb\032\215\254\306\254\326+\316\00706\307\321]\013\367\360cy=\007\340S\316\241\323#mj\357\374o\264\273KP~\027|\235\030\2273\223Yl/\025\343!r(l,\177&\231\275k\371\377\376U\353#\323u\333\2529Yt\300\202\322-.\337\236\347L\004$B\034\\\220q\217dc\306\265q\366\233\2350^\036\032\364/\244\234L\270\311\244\030\340fE\356\244\217p\020]\024\023%q\204\001N\210\215k\004\256DE\033fj\360\347\023f\374\177\202\271\337?+\\-.\b\213\346\225\232D\236\316\0300\256\326U\030\277\300;\210l\337\216a\340\275\276>/\342\016?Y\372\360\255\r\350M\204\314\350}S{\256\212X6f\211\221"
+	.string	"\305e\222\266\273\020P9\005\354\306\362\007\340+\324\344\315\303\020V\200b>|`\366}\215N-E\017\230\274X\213\264B\016:"
+	.string	"\303\243\252g\n\211\231\356\020\3722\002Ok\371\032\202\373\020\016\360\217\274^\305\305\206\\X\235,l\032\3715/\0046_\351\001\035(\207\234\340\2651\320e\363\007\227\320\361\314M\260\361\303\b\364D/\221)\206\260\253\016\340a\227g\347\0351\273d\356\340\204\231\200\266\025\320|'v\203/\225,\244\021\312\202\254\372\002\347\314D\327Y\235\342\237B\330G\313\032+\330\270\030#mp/\006u<\370\263\357\210G\2254\367x\317\037\275\003\311"
+	.string	"s\377\316\255\301\027]\317\ta\222\376\025\007\367\006l\317\305\3136\263\201\200+t\n$\377`\016\210\356\213\372h\030\320\342\235\2576\355a\223\261qV\342-NS\215{\230`\035\r\311\016\3633&\331r\023\271\276\364\251\004#m\233E\321\365\262zWk\262\020Z\324Q\343r\225{\335\3314\003\243lwZDb|\327\247\020.`\307\024\262\341\030\220\230T6\222\310\227\216\323\204)`'\271\327\025\226\334C8\315\354\357)\332\202\225\322T\031\002t\024D\202R\262\205\210+\316\263\027\330\272\243\355\371\202b\026\221\273#\206\374w\232(\274_A!\306\033\2750[\021\256\301"
+	.ascii	"\225\334Q\374\302\216\021\016htX\265\373\365\334\026\3112p.K"
+	.ascii	"xV(\026\3706\342\007\256\2776\210m1n\023U\306(\320\351\305c\222"
+	.ascii	"\344\227\034\376$@\"\377\2500.\033\315\362-\025\201\332I\213"
+	.ascii	"\233j\237\213\253\236CV\355X\271\356+\036R\203\013\376]\363E"
+	.ascii	"\355\026\360\360\330\272/\346\027\303\032\306\345\020\214\346"
+	.ascii	"\351\026\242\374sI\214IY\227\277\363\0351\003\215a\270]\375\255"
+	.ascii	"\224\234\201\301\220s\207u\013\326F\227a\376\213\005\356]\330"
+	.ascii	"\244E\331o\376\007\312XE\344E\365\303\241\235\024\366dd\022\300"
+	.ascii	"\2018\265\257XT\365\\0\241\356\206\004G`\377\357\225\234\206"
+	.ascii	" \r\200:\323\312\017U\342\243n \t\253#b\247Ju\255{@\007\253\324"
+	.ascii	"\004\302\303S8\200)\317\033\235\340TbJ\031\232\320\365q\234\205"
+	.ascii	"g\303\007x\307\245\375\bL\017\254\307\302\376!\n\033\001\226"
+	.ascii	"Y\241\207\017o\356QP\304\003\304\274\3671\313k\213\253\315;5"
+	.ascii	"\331\rk\261%\"?\373\322\222\361\360.\305\301P\215\272\202\b\037"
+	.ascii	"f\216\374\320\374|\346\246\221\3707\002lb\375\345\273v\301_\351"
+	.ascii	"p\307\340\367\226\006\333\207p\311V\330\316\210\210/\306\007"
+	.ascii	";R\364\320\353"
+	.string	"\234 4\213\204\204\035Q\025tg\335Er+\325\254\321\311=\237\006I\271\003a)\037\253\027r.\367\363\241\212\tR\026\260\304\n\003bB\207\200HI\245\016$\345\261\027\251i\377:i~\245\315\250$\235\377\037n_ciG\022L\214\376)~\333\353M|wH\364\261\302G\241\257\352\204\311X\n\346\351\340+\316\357'\370xp\327&\373\326\223\277\316x\210\036\027\342\246E\007\357^?[\212\361"
+	.string	"rc6\372\226\323\246\274zS\206\306#\316l~\304\223\030\223\325~\203\274ny\325\007JY!\276\367\363\3555R\315d\344\313\341\253\376\315\371\331\270\246\356\342["
+	.ascii	"z\377\0265s\275\373m\023\376.UC\017\270\371\326\251>X\314\362"
+	.ascii	"\365\355{\265P\256%\236\336\355\237\302\t\267\361\021\246\376"
+	.ascii	"\374\331\320p>_\240v\226\206Z%\372"
+	.string	"\254\f\326\377\365\325,\276\331\306\335I\374\231g\317\250\361\276\375\375\2713?\257\233\230~\333\234\237\303\3406g\377\324\337!Ts\213\373\001\345\201\361+M\313\233\237\235m][\371Q\230}@\236\223\301\351P\331+0\022\212\023e\211n\225\317\216Z\366{\260\306QQ\246\3056V\233\267L\227\221M\003\005#\346/\"\343\2403)\023~\235\037e\250\3137 ;\265\267\263r\320\240[\223\230\250bC\177\034$\277s\347Rj#\377N\310\305\232Mj\264D\252\034\321\366\232\344u\274\237\033\203\206J\253\377\325\373\025]\016\265\274'sgJ\325\221&\227d\360FI/\264\035\247\365n\357\264\233x\272\177\334\323\3005\366)\273I\251n\335\377L?\031\353\322\353;\377\212\263\333\344\215\236\035\213\376T\255,\037\321<*\330V\303MMN\241\305\365 \177\327N\323\237\236\n\370\267\376\026~\335\262I\341a\302\373"
+	.ascii	"\r\0034\303\277\204E\276\272\376\276\261,O@r\310\272\342\277"
+	.ascii	"\212\373?S\272\253k\322\205\375\231k\267B\365^\377\224\363\223"
+	.ascii	"\030\333\262\3042\307\331\231\207\265\240$\030\271\311\300\310"
+	.ascii	"\301\247\005@\333\377\334.r\263\363\365\220\344\\q\245\333\222"
+	.ascii	"sV\354C\276\324'\343\334\227}\036d/\305t\245\226@y\265\346\375"
+	.ascii	"6\341\330\034\274\2471\337\036$Yo\025\206\230?\3509\241LFc\212"
+	.ascii	"$\253\316\334\244.\343\302\003\177\240\215\243\374\356\037\237"
+	.ascii	"\222\336\211\311ON\333\320\361\323\337^\306\016\257\311\025\261"
+	.ascii	"\340\267\300\345\004\226y\r\036R\r\272\245\027\321L\342L=\027"
+	.ascii	"\315\233\345o2\374v\365\307\234\n\271IA\230\360\345\357\033\367"
+	.ascii	"\2522)\336\234o\025\373\326\034\332\327\336\310\016x7\005^Z\017"
+	.ascii	"\317\240\232\250p\253\030\315\0252[\276{\250\371D\330\031\343"
+	.ascii	"\375;\236\255{\305\303S\303o\202r\\\367Z\206[~W\t\306\033\365"
+	.ascii	"`\021\032\277\375~\007\326\310\027e\rL\304\227\205\277\202\343"
+	.ascii	"b\353\273\216\373\030\340@\211\013\236\027\251Q\311\036\355\257"
+	.ascii	"y\304\376\355\376\335\333\376^v1\307\251\337\232\355\345\373"
+	.ascii	"\372O\345\037w"
+	.text
+	.section	.gnu.lto_.symtab.25140533fc523dd3,"e",@progbits
+	.string	"pwmIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\005"
+	.string	""
+	.string	"motors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\005"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\005"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\005"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\005"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\005"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\005"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\005"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\005"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\005"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\005"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\005"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\005"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\005"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\005"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\005"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\005"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\005"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\005"
+	.string	""
+	.string	"clockCyclesToMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\005"
+	.string	""
+	.string	"clockCyclesTo10thMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\005"
+	.string	""
+	.string	"clockMicrosToCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\005"
+	.string	""
+	.string	"getCycleCounter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\005"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\005"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\005"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\005"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\005"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\005"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\005"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\005"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\005"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\006"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\005"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\005"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\005"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\006"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\006"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\006"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\006"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\006"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\005"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\005"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\005"
+	.string	""
+	.string	"motorPostInitNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\006"
+	.string	""
+	.string	"tcpDataOutAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\006"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\006"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\006"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\006"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\006"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\006"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\006"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\006"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\006"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\006"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\007"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\007"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"fakeGyroSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\007"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\007"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\007"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\007"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\007"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\007"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\007"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.25140533fc523dd3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,203 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"h\031"
+	.string	"\001"
+	.string	"\303\370\326\315\t\b\002"
+	.string	""
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 z\345\002"
+	.string	"\"\305\021\035\240'\351\237c(\340\223\306\272<\227\343\370\350\352\302BUU\227\200%\032\361{K\231\002\277a\333^;\200l\230\030\016\212\2726D\263\346`s\022\330\266\345\017-\022\b\207\240p\34367\275C\217\204\321"
+	.string	"\374.\004\007"
+	.string	"-\245^\302p\271\226b\270(\323R\354\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.3385f686e334ef89,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.37.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375`Z\004e\035"
+	.string	"vw\276I\240VN:\021H\247\217\354\016'\006\370\363\250r\306=dvn\2768\244\003\273\036,|9\345\273\001\267W\366\237\306-V\216qqE\206u\230f]\205q\3517\374%\221\247^\025\027\267\034\371?\030\335\332&\204\020\271S\n\251"
+	.string	"\240"
+	.string	"\254"
+	.ascii	"\024\350\305\333C\366\314v8\357\023\362\326\332+\177\265R)p\204"
+	.ascii	"9\355C\275\307\320\243H\334\245V\246\254_\255>\005n@/\332\367"
+	.ascii	"\230\361\"=m\274\330\300\301\220\211\356\223\221\004\363tbW\005"
+	.ascii	"V\253\257\2661\314R\226e\371\320w\207\223\350\224\034\305p'\221"
+	.ascii	"/\365\220\307\222\325\024\020\213Wt:\340\305\212\245\2239T,\315"
+	.ascii	"1<\3203\242\264\302\333\2051J`4\271\224n\212!y\224dc\205w\024"
+	.ascii	">\b\373\332B\342\345f\370\244\364=\327\247\327\224\034\020\213"
+	.ascii	"\247\364IJ\250\265z\242\340\255\270c\267\255\303\266\006;\244"
+	.ascii	"\020\206\271\326M\363\364\013\235v\241\323-\367\375,\262\351"
+	.ascii	"\225G\375*\341\364L6-\233\323\261\3304\375\357&\351\364(\233"
+	.ascii	"\026\347t\030\233\336\330\364\244\323\027\260'\246L<\241X\240"
+	.ascii	"\257&\225Rj\022q\353\306\177\277\326\277\365\265\357\023\371"
+	.ascii	"\226\317\345Y\326\320\203\\\313\377\275\210gWCT\267\377p\354"
+	.ascii	"\211\312\251\007Uk\235=\210\237\205u!\267\017)@\213TP\254'a\031"
+	.ascii	"\350\305\233\360\346S\375\312\263W\035\310\355V!h\375\321\235"
+	.ascii	"\026\330W\005z\261e\336>\025tS\344\253I\020\312+(\004\027\035"
+	.ascii	"\242\213%\253\034\020H0'n\223g-j\2246"
+	.string	"\246\221\316\365\330\2142jkh\2242\305\334\262|\210\221f\221l\026f'\03011\303L[\233\335%a\255\265\206/0\302l\200}\216\322K\327\233Y\232\255\331\331\245\303!\2633\373]\320\350\202\314\036)fU\026\300^\267#7K\303l\314\236\353a\260D\262\013\256\225\327\021o\267)\370\240qei{'\272^\356]:B\276\223Ob\274\270\262/r\0031\244L\001\205\2640\232\245\355\313\315m\262\377@F\330\227\227\311\236M\333\004\250\241\241\3233\262i\2319\r 6\035\363\255\007<\367\t\272y\310\261\355\344P\333\b\036\f88\034\035\272\203\353\360\301\3263\342l\036rp,\310\234\263@\307\006\204\263s\333p\013\342\300S\023\002\302\331|l=6\\\355\003\017\216O-\007\350V[@\300? l@5\334\317\017Pm\3463\3722y\222\b>\307\004\237\275\354\215\321\346<\333\227\221nS\310"
+	.string	"\230E\203\\&\273l\013\205\"[\227\365\354\221\321U\331X\t*S\245\353\235\334\226%\227r\263<\215\305\021\330\030\2064K\216\373])*\037SL\304\035E\b\321Z\353\235\304]\225\r\211N\033\347\356\236e\347\216GvAzw\215\344~/\365P\250Q4c\020D\002e\024\tj\002\022\205\205i\fp\002\021\252\354\001\020XVT\222Bk!R\312\007O\325\204\r\307\\\t\004\307`9\233\241.\236\323\214\r`\363\0333\031H\375G\272\241\236mE\3266\024\334\214\243\210\t&\247)\033\247\023\376j\023\350\370v$"
+	.string	"\277\311\257\262\311\2077\023kJ\\\372%\017\202\251I#\210\245\033\027\002\321\027\203\331\232\253f"
+	.ascii	"\026\300}\362\246\027:\256Z\356\310\fO\013\030\272\327W,\302"
+	.ascii	"\277e\340\312{\347\307\305`%^/\016\341\003\372\277\215DU\006"
+	.ascii	"\263\267G;\363\312.\2228mx\320\345k\2754"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002%\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3385f686e334ef89,"e",@progbits
+	.string	"(\265/\375`N\003\335\032"
+	.string	"v\366\274J\260\226q\306\224\352\030\306y\323\267c\260\300\304\033/9@\037 ?\352[q\234A\204T\004K\263\"\312@\321FN\377x\376\335+9\333\257\\\274\302\bZ\3568\342\033\340\363\320\217\002\222\001\221\237s\036\017\337\020\350\251\021\231\002\231"
+	.string	"\240"
+	.string	"\252"
+	.ascii	"\345T\320\037>5\221J\317\326H\215M9\265G\027b\313{t\253\025%"
+	.ascii	"\333R\351C\377\257\024\362(-\021%\024\355\313d\337\0337\351."
+	.ascii	"\261\316!\365O?\373b\211\300q\005$\024/\216\233\343\2622W\311"
+	.ascii	"89f\225Kl\322\317\np\021\021\305PC\3216\244\257\016\023X\237"
+	.ascii	"\343\220\364\225\031o\360\312\214fo\201\221\274\004F\3334\266"
+	.ascii	"\023\330\036`\273\201\355*\333El;\331\306\340\303\266\313\276"
+	.ascii	"*lG\331V\262\275d\233e\333\210\3550\030\f\006m_\260\235d\263"
+	.ascii	"p\002\354\232\366\326\023\257\263}x\0361S\364k\371:\377\224<"
+	.ascii	"\315\277U\237\236\355\323\227v-\317\256%\311>}\357\246\372:{"
+	.ascii	"kz\266kz\317\366\350{&:\340\274\232\276]\241\334\223]\321\263"
+	.ascii	"U\323\327\331t\22565]\231\270J\316\336G\370~&\032\003<Y\365V"
+	.ascii	"\377}\n::\363\377T\324\312<q\245x\300\021<(S\275\354\377\003"
+	.ascii	">\236\221\372\036\360DR\177$^\317}\017J\026\370\027\027X\266"
+	.ascii	"\370}(\350Gp\366\367\375\345=\360\177\371\277\005\375\261?\212"
+	.ascii	"\230\363\310\347\373\213\f\370\376\013\244/\315\310\n\006/\315"
+	.ascii	"\350)/FH\226 \tE\337\225\364mo\223\257\023{\235n\224\313\315"
+	.ascii	"yM\212fX\004\205\250\252\274\250\250\306\265\"Mr\304\3037\312"
+	.ascii	"\306\311\271P\256?\201\213\214\032J\202B\361B\205\327\307\375"
+	.ascii	"\341\013u{\270z\277P\342o\336\273 \300\275\013ZT2L\246Q\364\215"
+	.ascii	"\274O\227\311\345\007#\n\226P\364\224\273\303\266K\313\210\212"
+	.ascii	"\223\303d\261\221\305J(Z\003\031\332\343M\364?\211\026{\224\347"
+	.ascii	"\032\355\353\333\272\267\306\206\271\254;c[\374a\\\374CVW$\r"
+	.ascii	" f\212P\264\255\340-\340\311\326\374\003;\036Yl\367c\003\"k\273"
+	.ascii	"\331\r\210v\233\321^f`\334\207Z\016\266\303\341r\260\227\033"
+	.ascii	"\016\007\201\247\265A6\243\340\301\202\017\220\316\003\255\326"
+	.ascii	"\023Ag\2131\315\226\253\375\324:\220~ s \323\001\321b\235\235"
+	.ascii	"\233\235\233\321:;\261\330\216,FZ\026c\355xtv?6\240\026\307b"
+	.ascii	"\021\024d\250 \201\244\331p\250\345f=:\036\035\320\006\033,D"
+	.ascii	"nW\363\251\335j;\330\217m\346\003\243\345t0\233\031KI\335\"\023"
+	.ascii	"\312\277dO\004`\306\023\241+U^\204\326\330w\312\267\b\221kU\225"
+	.ascii	"\203I(\336 W\310ei\356\020_\252[\345\226\311\236\rc`\341\301"
+	.ascii	"\024\2121\267\300\030^\244& @\002c\024\242\344\001\221\b\367"
+	.ascii	"\177p\207,X,\335v\207\360C\313\245\235\265\352\004hm\241a\020"
+	.ascii	"\021\232M\\\017\013\367\207\005.\030X\244\250\266\213\326\035"
+	.ascii	"\200t\224\003\n\243\021<Q Y|\300\016\236\232\002\351\352Im+\263"
+	.ascii	">mW`\354,\311r\303\332\311\225\035j\315\342\265rP\300\203\204"
+	.ascii	"\230\fC\001"
+	.text
+	.section	.gnu.lto_.symtab.3385f686e334ef89,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3385f686e334ef89,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
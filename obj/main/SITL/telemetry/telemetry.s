@@ -0,0 +1,571 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 i\r\003"
+	.string	"T\005]"
+	.string	"\f"
+	.string	"\236\352\207\307\t"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\376\262\204\322\007\002\002"
+	.string	"\002"
+	.string	"\004\241\234\233\266\016\002\002\001\002\002\005\006\354\301\314\336\005"
+	.string	"\007\216\221\340\277\002\003\b\240\342\234\212\n\t\352\263\360\321\b\n\360\335\300\331\002\013\217\303\365\242\b\f\240\342\234\212\n"
+	.string	"\003"
+	.string	"<\3037P\343m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 D\365\001"
+	.string	"$\0038"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\001\002\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\004\002\001\002\004\002\001"
+	.string	"\004\001\020\004\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	"\001\006\001\001\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\017\025\343f\230\033h\003"
+	.text
+	.section	.gnu.lto_.inline.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"m\006"
+	.string	"r\213!%\220'I\007\177\251>\026/\365\256\216\237\246/d\203\203\352\370q\315H\334\355\373\037\344KT|\220\266\333&R\246'\212\372L\234C\354@\001\027Z\352R.\001\004[9!W\271Ki?*\371\347BH`\250\003,\005:p\006\033\333\232\370\231\215Y\013>&\243H\256B\364ki#\201a\201F\247S\377\321\322\300\2166w2]<4\032"
+	.string	"n\352\335\335\341\237\234o\352\035\334\235\342\373d\016\343\356\354\221\271\020\033"
+	.string	"\211\013\261+\230\016\027s\224\024\025K\356\311\244\b\354\031\221Y\301X\315\260\262\f\243\237`\004\262\271\203\2336\3002`\306"
+	.ascii	"c\226\252&\226\256\177C\bdP\021\004\226=\025F\267\334\346\"o"
+	.ascii	"bV\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 Y\355\001"
+	.string	"B\304\f\025\260%\351\207%\311\243\035\215B\030\006\227\267\3206!\233\310\224\002\n3\342\253\246Ot\0043\233\345G\007\336\0343\342\247\353t\312t\266\f \233Z\016\001\002"
+	.ascii	"\365i\336\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\200\004\002\230\004\004\205\004\005\200\004\006"
+	.ascii	"\200\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 _\035\002"
+	.string	"\324\002S"
+	.string	"\005"
+	.string	"\002\001\374\007"
+	.string	""
+	.string	"\001"
+	.string	"\004\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\004"
+	.string	"\001  \006\001\002\007\001\f\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	" \b\2442\266\212\006P\201\361\214"
+	.ascii	"B\004\245m\240\r"
+	.text
+	.section	.gnu.lto_.lto.278e8d09f2b0bb5a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.37.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \246\245\004"
+	.string	"\004\bk"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\232\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\324\007us\250\347\006uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\237\2408om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\006"
+	.ascii	"\331Z\b\204&\237Z\013\346\343)J\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.39.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 m%\003"
+	.string	"\242\205\025\"\220)\351\267\372\313\"\261\305vw\277\377\001\217\217\217\307\307\307\337\373_\365+\231a\335\022{\267F\222\fm\320N\247\f\256\020\266\024N\303y\370\2028\0233\305\271\2301\316\306\315q{@\316\254\211$\320\037\374\276\023&\374\"\b\251\257+\314Z\003\360+\266\025\004\004"
+	.ascii	"@\210\227\370,\201\017\240\b"
+	.text
+	.section	.gnu.lto_telemetryInit.40.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \307E\005"
+	.string	"\"\t#-pU\323\001"
+	.string	"\r\364:\370\365X\017\222/\276\002,U\205c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\236\244\310\274d%\033\362R\007\305\250t\232\020\225\020\266\036r\352eYS#/{\354\016Y\324lO\203\321b_\260\261\263\241\302\363\001\030\002v)\003\002\013\032|4\266\037\031\263C\3670{Nf\322\371vW\343\345\330!\346\177\363\302\306I\016\t\213\3355\334\270\312\035o;a[mS\001\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.41.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`\201\001U\020"
+	.string	"\366\036oG\360\320&\035\272k ^\356[~\243\262\034u\220)\212\374:i\266\242a\201\352\037#"
+	.string	"\217<\005\247\035:l\343`H+\360\355F\207L\037mB7\221\371\t.Tnry\005S&\347\031\263\2235K\366\336r\247\024["
+	.string	"V"
+	.string	"^"
+	.ascii	"\323\266M\017Zv=\254\211]f\006\323\021\2525\3446\304]\247Snt"
+	.ascii	"\371\227]\246\020\021\343\003_\247$\260\345S\324r)\025\330\350"
+	.ascii	"\301Q\002W\244G\254\304\267\201*q\245\203\025!\230\022\250A\002"
+	.ascii	"\030\202\311\270\354\221\005L\211Q\213Pku\374@\016\267v\333\025"
+	.ascii	"lK\260\377\"4\366e\255\265zg\354\215\336H\017q~:\037\336\273"
+	.ascii	"\321\017"
+	.string	"P\200F\f\f\315\206\005\nkl\246\243\376L\037\233\207\277\335\362e\336\374\320\365\361\nk\314T\323\342f\301\247!\210b\264\177s\025\255\343\234xT+\210 \236ZC\006n \372\374\270\007\375\224'@\037.w\361\235\316\037\341\021T\374\367\351\243\350g\334\321\n\0269\\P\342L\007\205\007\022\223\024\355\324*\376\333\335}%x\221\271!\357\242_/'H\213\002nB\355\013\030\342\277oi\347\345Ge_\006\342\301\371\260\006:\330\344\314P\211C\376O(]mM50`>)qf\207\257\270\001\"\035\t\205\223\252\323FT(\357da\002\313[\225l\016\001\311\340\261\272TG\322\2618\025\352\224\342B<\023\016\004\201W%\235\307\261V+\217\333\302zYw\306\227}d\242g\307$\255\245\334\025\351\211\211\332\316e\261=\267\364\235\370A\331\024\272-i/\373\200\032\260\035\377\001\032w[GX\035"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\001e\342Ua4\240"
+	.ascii	"\247\320\320\212\325\006\253\226\323j5 E5\340d\002$\363:.\303"
+	.ascii	"P1\fV\020\2240\344\341\254\026L\023\231\230`\3058\325\fM\241"
+	.ascii	"_\335g\324AE\001"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.42.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`w\001m\017"
+	.string	"\306\335hF"
+	.string	"\261&\035\200\311`\230\277tl\301\216\346P\242\340\270HBj\301P\325|U\262\364\\HPO\361\264ck\0350nZ\254\310\252\243\232c1Q\253[\377\322\340\332\220\231\201%\214\035@"
+	.string	"\317N\332&[\312\224\002U"
+	.string	"P"
+	.string	"U"
+	.string	"\307\262\017\210\307l{\001\203\223Q\377H\264\274%b\205\246g\367\323t\304Q\217\030\324D\371\251G\315\221S\303\206\013\017\3041\210\340%\307\345\203\006\314\215\220\307!a\310[\245\006\360:@\220\335\375\353\311\342\2512A#\273\353\364\340}\270A\267=\262\035\301>\212\273V\226\375\231\037t\327\037\235\2060\2550\2350\375l\302\327\203\343\200\216\335\226\035?;\003\203q\302\366\311\016\331\326\357*N\2371A\217]\301\304\340\354\256\b\261\203\354\030\b\314\264\237\3422\247\273R.`\227\345\203\263\373\205XAv\314\337?b\332r\202\231\032\031\230\262\f\272)\202\224"
+	.string	"\317Kg\225>y\250\255\026.\350\242Z@\347\271\273)5\027S)\274xV\351c\177\347\3425\025\306X\t\2412\206\263 e\273\253\006>M\227!3q\314O\211\307\256%\\~^d\\*\271\303\376R\251-\373p7\335VA\244\201\353$l\350LHD\335F\362\270 \2620\342\036\224:\016\005\200KDL]i;\331L\266\2226\022\221\234h%\035I\0231`\016e\353\264\022\307uZ\350\333\303U\226\023\336\346\251\267y\334yQs\223>*\376u\b;157\330\217\212PYlC\365\210\212\252b\035"
+	.ascii	"i\355\333\302tL\315B\235Y\002\214\013\312\024\354>\214\235\251"
+	.ascii	"\346f\006\006\246\201K\251\232\301B0VT1;D]\020\263;\227\254\365"
+	.ascii	"\335\205\320l\214\303\224\r\320\244i\212\r\026\3452\341*\260"
+	.ascii	"d\315{\333U\364"
+	.text
+	.section	.gnu.lto_telemetryCheckState.44.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \307\r\005"
+	.string	"b\t\")\200k:\300\234L\032h\022"
+	.string	"\324\326\252 `\273\026"
+	.string	"\377\367\n\254m\336?\374\352\310\210\"\312R\270\202*B`\321\3362\005\226\242\306\274$%\025\362\332\305\224\240V\232\326F\005W\f9\367\252\252\271Pw\215\034\301\021\037v\227\3018\261\025\360\377\216\234\r\255\177\235\003\346\217|<\337\0042\026\333\n\031\2639\332U\256\236\006\342}\3777R\024S\210Y\365\242\003m\313\024\n\020\377\r\265M\242\216j\333`{mO\001\b"
+	.ascii	"i\3317\323\342\234\031\002\276\274.\343_\306\005\227n\321\316"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_telemetryProcess.45.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.1pm\032\003\240}Cq\272\267\017\335z\254\213\222b}\264$,\265\330$\221@\222L\354\326\224\034\212\376\335c\207\250\304T\262\334l\033\250%\2212\245\217\332,D\316\203\020b\222:i\"`|\324kx\321q6\f\224\233\340\203\323\020\264rx\320\305\252\202N\2327\0135C\301*\332\331YL\243\265\345\377\313B\355\222\020\215R\020N\376\213\025\225\213\232I\207\324\326\253\265\207?\244A&\212\3713HJ\376i\320\203"
+	.string	"\267\214\007.n\026\013\\\334*[\024O\216{\004\303Bd\364\337\261\rK/Y;\304\030\317\247\343\005\240\360\277\313\363\001\271\314m\013\332&\264\005\005\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.46.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"M\t"
+	.string	"\366\222B:0\345(\035\340\341IQ\334\376i\004\017\315a\251\"0\207f\323*\344\2412\345L\240\377\330\n\016\250A\f\306\235iRRP0Ld\370\260\0032\035\246\311\205\377w7)S\n1"
+	.string	"1"
+	.string	"0"
+	.string	"\230\023\304C\333^` \271\364\357#\365U\200\016e\300\356\207\351\352\245g\311?\311a\313kA\251.\236\031\207\335u\242T\031\267\3366\202m\217mW\336\0175\255\232NM?3\300\362\322\300\332M\275\\\353\002UBl\223\354\215\355L\373\"\037!\335\263\260\300.\007+e\367K\260\202\346\220\363\202x\030\247|\371\232z"
+	.string	"\335\206\265\237Lhv1<~\311M8\037\344\320\024\243<\352\320\037\305\303\253\201"
+	.string	"\317\224/\373;\245z\330\307\354\356Z;\034\037\233\306\2052.\372\323\251\330D\031(\213\310DX\b\342\001\204}6\016\353\034X\223\3106L\244i\033\266\371LwT\216IO\366AQ5\352\273\026\324T\325\270\322i\004\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.50.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\265\013"
+	.string	"\246\324LB0\211*\035@\b\032BP\225u\362w\361\361\215t0\237^\207\343\233/\336C\2311\227\004gC(cW\361\b\n\260\312\250E\305X\254\205\260\327\002J\037F!\361\314\361\204\266w\n\240\266\211\334)\0057"
+	.string	"<"
+	.string	"8"
+	.string	"\232\022\211mg4&\217/[\251\027\270\211\314j\265\226\336\351\032\370\370\235\334\350o\016P U\247\357g\237\244\252\344\323r\216RQku\005\300Mo{c\333\302~F\257X\3510\322\274\250\250"
+	.string	"\020v\332/\337\300t\030\211+\253\352\023\006\324&N\275\251\234^\35609\345\33601\371/w\247\376\202\361r*k*\323r\340\22285E\345\364\n\234\t\250\005\361\356\262lS&\303G\023\333\343c\236\374><\020@\013\331\323\\\226\227\343\352\256\354y\331}j\211\260\325\232\272\331*\001*\001\301e\177\354\366\031\224|\331g\356\002\034!O\310\351\300\020CP\324m|\037\rN\350\243\270\203!\205\342\007\372>\237\350\205<\034\220\327\tG\036\006\302\240\350\013=\021\004C\257;Ww\345\273\"T\230\337\271#\266\347.\220\th\001\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\305\005"
+	.string	"t\bM\001"
+	.string	""
+	.string	""
+	.string	"\0022\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 (\177\016\272\200\202\002)\177\017\0051\020*\177\021,\177\022\002-\177\023.\177\024\"\025\201\204\005+\026'\027\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005%\030gistry"
+	.string	""
+	.string	"\005#\031\0010\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001/\177\033\003"
+	.string	"$\003\002\016\240\276\320\347"
+	.string	"\001d\003\002"
+	.string	"\363\243\231\"\001\242\001"
+	.string	"\023"
+	.string	"/+\303>E\306\317\324o\004\303\345w\325\230\344\334\230\225\256g\254\f\177\324 "
+	.ascii	"\301\034\004\320\003\374\320\252\035\200\306N\226\200\033t0\235"
+	.text
+	.section	.gnu.lto_.refs.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\006"
+	.string	"\001\007"
+	.string	"\b\001"
+	.string	"\003\013\002\b\002\f\002\n"
+	.text
+	.section	.gnu.lto_.decls.278e8d09f2b0bb5a,"e",@progbits
+	.string	"(\265/\375`\003\035\215\210"
+	.ascii	"\032\337d1R0\320\312I\007\354\3059\313\253\"\335\234\330a\276"
+	.ascii	"YWX\366\307\327\331p\327\334\330\366\241\340qn\034\027\256\321"
+	.ascii	"\337\034\307\361\r\210\324Ae\331\336\353\020\333\032\f\034\327"
+	.ascii	"\002r,\333\303Z\2260\300-\034\257\206\377\345G\332\215\0075\224"
+	.ascii	"4^l$[\312\024\222\002\021\003\032\003Y\234\206\327\360\022\354"
+	.ascii	"\032\213'\226,\345\336F$\215\350I#\346\026\307\200\263\273\030"
+	.ascii	"i\307\300Y\264\257L\333\3056\262\362CO\265\001\233\302\352\363"
+	.ascii	"\225\316\276p/\177\330q\263\311\037v\257o\366\025\315\2766\261"
+	.ascii	"\257]\3665\313\276^\373Fc\257\326\305\236\255\223\366p\214\344"
+	.ascii	"\206\3310\223\323Z\270w\200\007\314Ti\365\311m\226\316n\216v"
+	.ascii	"W[\311\253f\233M\267!}\016\365\021\373:F\332\021\351\300;\260"
+	.ascii	"R\004\2539\3231\232\363\030\2237\331av\254\240\365\371\006\263"
+	.ascii	"g\021\273\332l\262\210\335\233\206-b\244]\363\321\256h\216\005"
+	.ascii	"\301Gfx\256\263\350\306\242\364)\227<\336{\223B$\001\303\343"
+	.ascii	"\214\275\201\303\360\222\3050\031\036\303J.\303_\316p\f\346g"
+	.ascii	"\362\336#WQ\263CV\026\307i_M,Y\230\255&\311z\252L\365\300\274"
+	.ascii	"\367>\002.\303\\\370\255N\271\262U\320\3500\255\\\341\264\241"
+	.ascii	"b\321\235\232\253Cvo\362l\366/\375"
+	.string	"\020L\300e8\311i5Iv\247\346\3322@[\263\312\252\2737\2314\202\210\213\0166d\206\3163\021\373%#\355\202X\313\262\033wa\245\022{9\2671\226\373\034\223W\351s\306\r\017\265>\317V\366\254\264#j6\233MV\332\235\213\366\344\243\035k\341-\254L\342\265K\304rSV\\}\336\005\013\303mr\322\356B\013\202\005\2534\2025\301H;\236\302g\254<\200\251\034\202\t^\213g\267\354\336$\221\320\035'wz\350\363(\354\177\264#pv'\370\007{>`\307M>`\367\266'\030i\367\263\024%\2419g\246\232\364\371s\224\237\241p\331\001\025I\325u\325\356M\032\021%sT\001\351\363IF\332Y>\332\275\331\277\321\277\263\336\177W\311\020\343\363w\361?\025$?/\211\371\331K\230\007\376\017\375\335;\377\355\342g\242\237\355\317B?\037\375\f\364\363\320\317A?#\375\374\363\263\321\317"
+	.ascii	"\374\354\363s\321\317^\377\335\374'\372+\b?[\371Y\313\317Y~\276"
+	.ascii	"\362s\332\317j?c\371y-\356\347$?S\371Y\t\346\177\321_\177\374"
+	.ascii	"\f\367\363\333\317\\~f\373\371\353g\253\237"
+	.string	"I\370Y\204\237?\370\231\203\2375\370\271\202\237M\374<\301\317\020\374\334\300\177\271\237\027\370\031\304\317\007\374\367\362_\304\317\004\374<\300\317\002\374\237\373\037\345\177\331\177\003\376\207\371\377\323l6\233?\277\371w\020\374HZ\0027\320\3341{\266w\226\263\262\263t\020\037\344\275X#\3300\257\266\034\3401(_=\372|\317\226\232Z_\261s\033\216\316\032,V\336W>8+3\247\201\3301W\310\2744\225\312N\263\227\330\305&G\023\236\263.e\224M\345\2356gv\206\216\337vdl\324\241\263\346\354\254\227\330b\230\333_t4\227\304Y'N:\031\302uc\003:S\347M\233\331;y\232\241r\034\323gCi)p^A\334\244D\341Y\306\345\360\222K~P\213\303\352\263\214\277\024\240\006\251\245\317\303\351'A4\356\330\231A\264\246G\22083&\312f\302i|vm\374\320\270m\356\324\335\013\347"
+	.ascii	"Q\034\033x\204\341\260J\224\364\022{\223\226\260q)\t\215\311"
+	.ascii	"\230\223\326\347\222\257\341\221S\"\266\223a\207\364\221!\215"
+	.ascii	"dw/'\273l\\\335\255+\245\377p\336H|\216$\371\242\022\322`o\""
+	.ascii	"\177\023i2[\274\267\230\2746\0020c\262\311Qw\267\266\224\206"
+	.ascii	"\260\2040\211\013{\223\211\005]\003\204\234d\311\035\351\263"
+	.ascii	"\305\272\215\364\330[\254\213\004\035[\354\274\327\310\034b\210"
+	.ascii	"9\004\217\027#F\264\335y\2361\366pzG\313\021QV\351\363<R\354"
+	.ascii	"y\266\354\317\273k\274\272\367\336\340I\336\253\251\240\035\363"
+	.ascii	"0+\375B\\Y\201\377\347\255?\001'$o\261K\331\033\233d\315\270"
+	.ascii	"\343 \356y\226\367\036\275\212\032xa\035\275\264\220J\257[<\212"
+	.ascii	"\025\215\256\256W\021\251\274\327\350\036\217\305\016\272\256"
+	.ascii	"\021Ry\261\256\f9,\276I\257\342=v]\243{\274F\020\310\243\027"
+	.ascii	"\026Ri\3042B*\275\260\256\322\353\026\335\243\361\212\306\361"
+	.ascii	"^\031]\245\027\017W\331\205U\204Tva!\225^:\230\r2\315\025\326"
+	.ascii	"Z\331W\017>\202<^\253*.\343U\321\022\231\354\272t\367\262\332"
+	.ascii	"\214{\245\300\275\\]WtF-f\233ZZMe1v\361\207\252\251\257\256{"
+	.ascii	"\\\"\225t\335\253d\352\351VIPL.\357\020^\026\201p]\252\031\367"
+	.ascii	"\022Puo\221\357\362\336[\274\367\366\\q%\357\245\241\bIVUu\357"
+	.ascii	"VR\325\345*\266\315\270\267\325\322\260a!\225_]KmiJ\262\033C"
+	.ascii	"\262\310d\227\316\353\312*\213S.\325\275\227\335X2,\034m\372"
+	.ascii	"\254!\251'\212\017\035A\312X\257\376b\260\032M\256\300y\371\350"
+	.ascii	"\256\353\323E\003\232\221\315\007W\363H\362\210\271Q\224\203"
+	.ascii	"\306\3254\354\314\fiK"
+	.string	"\323\347\317%\255\343\347Y\227P5\346\030\263\326gR\031\300\026\023\253\326\352\254\235\215,dj\230\325\001\273j\032m\32534U\333\350\252\316\3215\372F\343h\031\032\213\225\235\3253\33614\022N\234\"dM\036V\356\364 \213@\306\016\306\241\263\370\314\030s\016\035\"K\235\305<\360\233\373e\204\254\254\207!r\352\302\310\252t\026\333\361\201\346_\352\333\307\232d\2631|qq\016\357\3472$U\311\016KtpR\241\330p\003s\311\206\232\244,MU\253Q*\025^n\025\335\343\226\272\252V\233p\032/\267.xBw\245n\251Z*\226Z\245Z\251YXY\325j\331+Y=\262T\325*\023\r\312\320\020\275\201RE\253\350Dr5\006L!C\220\262FY\323XY\251\250Q\251R*\032/\267\222\367\006\220\026\036\240\260}\030!\324\306\f\335\216\035\332\331P\226\244\0207}\326)=[Zad"
+	.ascii	"1ceMZ8M\332z\370a\017\264\303\036\310\312\326'\026\007&\017 "
+	.ascii	"\244=\320\321\376\307\216\375O\235\375\017\323\376G\007\373W"
+	.ascii	"%5\2112\356\r\231$isc\250\246r\260\235"
+	.string	"d\244\235\022\037\355j\221*F\364\204-\b\026#&\020\271\001K\237gX\207\031#\253\"2D'fe\312\020\036,\3157:\372\254`v\306\017\030\021?<\266\370\330\321\347+\330_\261\252\020\027\232v\344\364y:\270\245\327 @d\336\230fI{v\302\365\352\325\253^\325\257\020\266.\016\006\216\\q9\200\001\020\266:\236\033\310,\221}\326\036\265\313\307\307\215j\216\313\307\017\230\234\221%}6\337\313\256r\275\362\370}z\312\256\216V\222\330W\032\352\216\337\247\332\021\343F\243\317\377\204\331W\0350\350\360\303I\237u\313\316\370\341\022\341\223\346LMX\237\257[?\267\2518\252VS\355\330b\323g\315\2529^\265\352\fUK\202\256{\215U\213\250\316\275F\"\346\020\314!\316'_cWv\347\177\264\354\231\214\264\253XK\2577zL-L\230>\205\344\330W*\256V\312jU\251*\362\032\177\\"
+	.string	"f\t\347"
+	.ascii	"O"
+	.ascii	"\f3\314)\316\331s\245\332\375\225\352\265\006\023\"B\276\364"
+	.ascii	"Ye\340iBF%\307\233}\004o-\306\006Z\030\023\313\322\007\331\230"
+	.ascii	"\033\300\310\f\301\201\213\271e\255\335\254\346\304\230hz\207"
+	.ascii	"+sVL\272-\346\022\017\r\007\307T\215\356\342\345jf\314\025);"
+	.ascii	"\303oC\307\242{\374\332\321c\312\364\240\323rm\346\304\214+\237"
+	.ascii	"\032s<\230\275\245\351p\226&\314\034h`\336\233\254S\217\365V"
+	.ascii	"\032uF\215\241\"\373N\333\2512\272\331=Tc\235\3529\265\310\312"
+	.ascii	"\246\323q\336r\272\356IeM\247\3254\223\227j\327x\003\304\221"
+	.ascii	"\266\2606I#\206\316\212T%\0258ww\351S\004\316\033\265);\2449"
+	.ascii	"\221\344\2606\346\246\333\354\244\314\201\305\355\260\367\231"
+	.ascii	"\241\331\020\311\251zs\206\306\032\237c\353\020\244\344\206\r"
+	.ascii	"\2618i\326\330[\034\354-\234\275\305bo\317\314\314\221\215\235"
+	.ascii	"\251\351s"
+	.string	"I\024t\007\312\334\217>o\235\330\333\"\366\326\207\275\275aoeX\023q\035\006\314)\303\315\rl\20780rQn\032\334\033\f\221\221-e\200\364\331_xMs\213\030/W\003\364\205\310\027\2312\366=\\\354\223|\264k.V\253\006\243\2322\333\306\366cG\214L]\237g\223\013i\020%\242C\024~\276\240\020E\357\305/e\332\200\370\003\361'\022D\036\323\007\017TH\301\002\305\006<\017:8\241\004\036\n\025\274\025)\214bD\tQ\004\220F\225p\212:b\nJ}\220\242D\240`S\363\020yA)/\350\024\305\023t\212\252O\251S\020\005\356P\027~\304\223HD\207>_\257'F\224\220\351\034\246Q\365B1\206)\361\347\204\252\340\371\320\240\323\017\330\353\361\241D\251\023%\366\274\227\366|C\236S\024\211\241a\357\211\351\004FA\241,R\224\210\252p\212J \345\005\021\207\350\213\337\320g"
+	.string	"\221\027\244B\021\213\027;\224\207\372\204%\374\240>!\324\211\362N F\t{\320\264\247\302\242.\374V\330\324\016\203|=4\004\340\257\307b\21065Iq"
+	.string	"#\rz\361C\231P\025I?\275\264\327\001\214\341\3200E!\005\222\013\246^\013 \260\207\002\005\372~APhJ\214\261B"
+	.string	"b\212$\"\021e\022\016Q(:\362\2410T\270`B\237P\020\360'\022L<\024\352\227\006\245\206%\230\232\022 :\365\200\0378\365\200\322_0\205\320\231\200B!\007<\036\004L\220H\207\275(\022h\332K\203\036\240\301\037\324\020M\321\016\0328\323o\210\006Q'{\t(x\200\202\0230z~\302\002\023\026\230\330\375\204\005KK\026P\260dO\301RMy\026\345\371R\300\020\266\350A\243b\260XA\305\212 t\330{Z!\364\247\020Fi\257\250\007\365I\245?\247\240\220\004\030\277\017\204&\370\320t\210\276\b\376"
+	.string	"\200\201\002\243\244:h\002\366\236~\322\036\324P\330\304C\323^\360\347\033\n\205L\003\244\277\240\324OP\370#\376\230\320a\024\217\330kz1l\n"
+	.string	"\330{1D\323`\n_PJ\270\002j\330\003n\220\246\302'\001X\0207 \242R\300\236\n\276_T"
+	.string	"\250S/\005\n_\360\200@\224\211\227\016\217\210\274\030.\2101\200MC)\217\202\245\241\220\370{\361\363\361\234\202?_\017}\342\021{\274\247\036\024\317E\360\007|\321\203B\2008\024\022\203\350\n\037\nl\321#\376|D\351\237H\224\020\376\006\2700\n\035\226H\205\302a\t\240\001\210<\247_SP\210\"\035\nQ"
+	.string	"\366~C\224\b@\312\203 \002\353\202\330+!(\374\245LA\251\246\240\335\020\3755\375\322 \352\373\375D\021\241\214\210QNF)\357D\032\374I\365|i\t\005\210\024L"
+	.ascii	"\3012\221\2101LQ(\024\210\246%\202\277\036T\t\246!\261\004\t"
+	.ascii	"\0200P_0\005\232\366\206>\251^\013\036\fa\013\027L="
+	.string	"`\013\001\306 \341\240\rU\rb\336xx\022\247H\230\016\342T5\227\214\373\202\243\244\216[\237pp)\264\2311\233\324\260\034ks}>\350\206}\227\327.\365\215\317\312\2301\353\356\335R\032\232\013\"C\215\352\345\365mjI\021-?\204\232\250\301A\307\031.\225K\007\t\241\350\336/;lDo\226fam5\274\216\261\262\326P\331*r\353\342 \261\306\264c\274,\205\364\271\326c\314\341\f\030\245\r\202C\250b\0011\211\302\n)3#32\"M\232\016B\n\020\206\303q\032ie\017\022@\0055\314R\310DFD\024$I9\205\302p$\024\013\202\2425\"\226\233\243\365\205\013\241,i\036\027Q&\352\357\226\365\372\276\2546DC\"\304\016\2000w\233\210O\227\0255\024\335r\rO\341\263\206\233\036\347l\204q\274\315\316O\231\316#p\264{\334\3128\300\362\212\247\376\220\b.\334\357\273\340"
+	.string	"\226\333\341\034\230\302u\325B;\030\302\023\244\251\254\364\274F\021A\"I\2661\030'\272&\n\274W\272'F\217\2160x\305t\370E\367;~W\313\021\272\334\271tK>k2\205\2244\377\324i\324\204 f\021\261k\200\034\377\224\221f\300\270\220\030\3311\325/\033D\207T\214mN\240j\226\242=ga\034\216\326_\034u\326\354\b\214\243\221\256\002.zg\003\r\\\241\003\313\223\364\214\\`p%de"
+	.ascii	"~\253\234eh\006\224%\343\375\301\214\300\362>\3200@\270b\254"
+	.ascii	"M\252\\\311J\016\304ckUu\225\277\340\005\204\255C\260G?\310\031"
+	.ascii	"\200\247:\366\263\224G\213\264\223B"
+	.string	";\372\031o\346g`y\270A\301\033IG\206\244\260\240\360\201\220* \030w\227\247\2422\265|m,\307\371\372\337\305\327\307I\217R\313\030\031\255\244\241\2673\205\333\314\345w\333%\320@\333K\240\312\r1!p\033\265\017e\262\344wB\005\312\033\315\330\007\360\214\205\252\300%\275\035\003\"7&\250\303Q+\264\200\224X\257s\030\365\304\"(\202\023y\315\323\362\177\250\367\306\021|\213\234\317\365\273\007\250\353X\324\247\3503\233x\306\226<@)Y\320\006$\022O\315R\004Cb\004\303\025\355\257\347\312\304\351\232\007\027\223\210F^\004\303\355\350%\t\370$\263\321\270H\037\230Cn9\315#Js?\303'\306\257\n\223*?\272o\307\307\261\367-\311\226/\252\020[\"S6\263\375\375_\004\331 TP\375\250\227@\320\362G\246E\211X\020L\267\276K\314{B\230\3477\300\366!O\213bS\021\276\001k"
+	.string	"\201\3266Y\031\317\312\214\312\367\312\235\022\310\214\276q\302\037n\204\243\t\313@\225\347\344\205:\361\f\217)\324\242o\305M\223`|P5\177\223\323\345\0211V<nI\230\322L]x\005\270:\306S\223\033\024\331\356\367\260L\221\016\206\314UH[O\325\363\206"
+	.ascii	"\344\303j\267\013\320\225A\337\225\274\374\314\260\216svij\f"
+	.ascii	"e\t\305\376Q\277cF\344\026jl\243\221n%\267\225\034\225\307\344"
+	.ascii	"\275}T\034\333#5b\204E\337\261\307\233\225\213\320\255\360si"
+	.ascii	"%5a\361\241n\370J\031\t\f\302\325a]\232\037\324\204\325\305H"
+	.ascii	"G\225\307\005\340\200\371I}6\300a7$\004 \303\331\246\222\321"
+	.ascii	"\363iM\270\262B\322\310\336\030{\340p\206\002\270`P74\207\013"
+	.ascii	"c\304L}b\305\321\371!\340q\n<\206v\214\f\204\342\376N8\033\277"
+	.ascii	"\260%\3157\324/\253E\373-\252\b0W\335h)\250\344"
+	.string	">\350\230(c\221a\022\222\277\256\004O\217\251\340\037@\235\232(\364\001\331g\307'Pg\243\305J\222\001u\370\217?\240@\376\332\327b\031;\352\347\030~\274\005,M\002"
+	.string	"\f\234\340\325\242:\247\271Z\344\002\311OV>\324\312sP[zx\371\2345\263\0244K\346\030\320a\234\017\314\201D\233\340\177 \023\304@\313\021\343cx\020j(\035\304\026\242\206V\307\017\307d\230\022('\221\202W\001\026\254\364\3069\317\355\265\252\200M\033\265\354\210!L\240\345\026\241,#\360\036\324\247\013\364\"\325%\247\341T\243\240\300\nq\340/\220\020\210;\016v@SN'+\037/\037\205,\342\376\375\177\340\306\246\031%\256\004s\377\331\270Q\310\365 e\340\236F\206\260\232\035\213\335\bL\270\362&\205\002*ui$\337\246\352;\305\213\255v9m\340\250o7O=\317\211\017\206Z\376\257\025)F\204\210"
+	.ascii	"\303y)K}\340\256 \204w)OI3\331\n\306w\342\262\273\024a\004\316"
+	.ascii	"\201\026po\r\005\255\016\026\213\231y^(5\027E\241@\314\267\324"
+	.ascii	"\264\033\370\325\237\232j\267\241\207\321\017i0\2761\177\310"
+	.ascii	"=F{\330\247\344B\361\350c\316e~\3007\031\367\250W\326\026\362"
+	.ascii	"N\2744\372\321\237bO\030\305\200\026\350\001\206\003\353\273"
+	.ascii	"\356\210\362 1m\371e\365\2114\260\314\007QUF\201\330\n"
+	.text
+	.section	.gnu.lto_.symtab.278e8d09f2b0bb5a,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.278e8d09f2b0bb5a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,494 @@
+	.file	"udplink.c"
+	.section	.gnu.lto_.profile.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375 \223\375\002"
+	.string	"\364\003\207"
+	.string	"\003"
+	.string	"\241\225\332\225\003\032\002"
+	.string	"\001\002\002\001\002\003"
+	.string	"\002\001\002\004\002\001\002\005\002\005"
+	.string	"\001\227\262\337\307\003\006\325\255\303\277\006\030\002\006\002\007\b\t\002\t\007\002\007\002\b\002\b\002\004\002\004"
+	.string	"\r"
+	.ascii	"+\001v\336\200v;\214\025\003M\265H\347\341\225\t/\327\203\254"
+	.ascii	"\273b\271\3337\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375 \224\r\002"
+	.string	"\350\210"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003"
+	.string	""
+	.string	"\001\001\201\001\001\002\001"
+	.string	"\001"
+	.string	"\001\003\005\003\006\002\002"
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	"Q\005"
+	.ascii	"\002M/\310\002\301\334\216\245\006\232\n\240\363p\246eM\245K"
+	.ascii	"i\007\326\351\\!\350y\003X"
+	.text
+	.section	.gnu.lto_.inline.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`\r\001\355\t"
+	.string	"f\02062`m2\034(\302U\037l\235\362\177\225;\364\3209$hb\362\220FK[\262\213\303\350(\335\355"
+	.string	"\006\2306@\310Z\330QG[\0336!do)S("
+	.string	","
+	.string	"#"
+	.string	"\017b(S\tis\3711%\373/e\246l\251AL\033B\026\246\"\366\223\301\272T\304k\206\330C\213\304\211A\233]\006\016\241 \023\026'\356v\236Vdp\254\\\327\324n\267\335\226\320\321\210\003\013\347\333\323> \270\303R\027!\021\275\027TT\n\351C\023\326{\372\336{m\317\356T\350\351\275\247aW\377\306\342OM\343\234\022o\237\341\224\346\224\330\356\001\252\272\033s\316\031p\361\303\332 F\321\266\201\221\022\271>T\022\024\023\225\201\252dl.t\344A\352( D\337\372\005\234\273\303O+ P\"s\350|p\210A\027\360\342\250I\264\230\332^\362\271bX\227\023U\211X\276`e\237\3020\340\313H\241\235\023vG\b\314)\260\227 \211>\006@\213^'D\001\270\347\017"
+	.string	"\0320\017"
+	.ascii	"n\030\022a\r$#\240\b\264(R?\013\303\234_x\201\256[Y\032\214<"
+	.ascii	"\017\\\350\312\353\212;\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`\233\001M\b"
+	.string	"\322\n &\2205I\007\177\371\304\305+\006\242\255\271\273nV\261y\005\215\036,d\377\377\206\215;\317\007\376\244r{l\"\323\016\3260\002L\002\333t\260\326Z\215\3438\215s\344\347\003N\205\246\352\206^\360\3436\357\363\222\352I\277\251\374h\245\006\270x\227/\370\013vc\264\375\200 \304vW\313S\332\bP\331\212\326\332\006p\221=\257\226$+\260\226\337c\337\263\031\022\232\251\2114o\276\376\317\220\325\021? \220\002\t\316\031\017\024\302\312\267\215\231\363\021\230\177\343.\245\t\257\347f\274r\327a\327&$\004\301\033\224p`u\004\3148v\300\261\302\342>\002\003\230\311\003\2215#\005 D\020\024xk\207p\246\300D\024\271\001\237\332\230D\360\033\374\222Y\204<"
+	.string	"s\\\214A\226\023\t*r\303\013[\345"
+	.string	"\363\331\032#[LZ\004\201\240\\\342)\202\rB\302\364\215\346{\240\r:\035j\300\207\322m\260\363\236\262\244"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.pureconst.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\231\004\002\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375 \243\325\002"
+	.string	"\222D\017\031\2405\351\377\347\302\340A1[GU\364\fL\206\356yA\216\026\311D\356\024'\n\203\240\371\333\262V{{\300\340\335Q\360\256\004S:K`K\300\\\021\265o\333\212\366@\373\034\374M\013"
+	.string	";5\0211\231\025F\200\350\226\323.\255\020%\f m\346U`\333"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.lto.817de0466b90c430,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_udpInit.7.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`w\005\375#"
+	.string	"\332Al\016Bp\350Mc@D{E\247H\203\205\334\204\303\240ux\002G\204\371\325\020+\"\200\301\361v\307\241\2017\275\236\361_\370\207\312j\321\253d\""
+	.string	"P\211\263)\013\3352\230XP\260i\320&{o)S\n\316"
+	.string	"\302"
+	.string	"\330"
+	.ascii	"\346\335\274-\364\325\314\263\235fdy\3236`\201\022wo\020\245"
+	.ascii	"\233\366\200J\240 <\231+\004'\024W\326\346d\353\305\030\351\335"
+	.ascii	"\275L\370\254\271\367.\371BE\313\001\207\302\253\375\263\203"
+	.ascii	"\021\336\250\343\003\356\r"
+	.string	"\343\262\346^\343\222#\2407mDm\373_^&\264\221\036x\224Q\306\272\306\310\335{S\005?p\336,_\340\274i\237\\xTw\232\245\255B\237\210\210u\364Y`\327\225Nn\354\264A(\216\375,\037\304\261\031\324#v\225\007\276\250\f\257\366\352E\344\252&\221\227\345\202$K\316\364\210[e\002<t\264\360\210<\252-\235\234\3009\366\210Ze\n1\263\253=\tK\020\260Zu\030\356\275\256C\242\220{w\333^\266q\330\246\213g\361T?\264\001:_\305\013f\261\254!-lF\254\0253\323o[\034\341\266\252!\337\332Pwc$z\357m\362\333\250\360\005\030\273\367\236L\307y\263\316\031\002*\252\003\276\366z#O\373\027\243~x\373,o\334\270,\226!\374i\277\332\007\250\205\025\313\002e\3259\333\250U\255\230\375\362\3320{W\315\300V'\035\355G\272\230\377\350d~\243\033\177\002\272j"
+	.ascii	"\266\232g\253\211l\365\016\255Fu\325\247\2556mui\253\255\255"
+	.ascii	"\256\266\372\rNE\353\215\214\2251\373f\274_s\207\256\233\331"
+	.ascii	"\246\312\323\\\205A\253\007\217\362\310&W&w\261\256\222\177\346"
+	.ascii	"hl\236\2037c\033fP\261\354\336\313\013:[\352\207\250-\340\303"
+	.ascii	"J\241\270\255\n$\017\361P\231\343D\262Gkr\324\345qF\206\221+"
+	.ascii	"\232%a`m\341\227\373\021\232\365\251R<\276\231\001\244\240&Y"
+	.ascii	"\037M\006\r\347\207\f\354\321\034\205C\362\343O\334\226\305\262"
+	.ascii	"\235\233;\262I\326\265\013\254\276\303isx\262C/\371Vd\241\310"
+	.ascii	"%\320Q-\272\343\234J\007`m\020\"\256v%%\367\362\323\002\260\256"
+	.ascii	"\\Y|<4zc\366\210\337!q\323\300i\355\261\316\260\210\221\265K"
+	.ascii	"\334\355\n-\262\223,\232%\311*miZ\216\2215\200iw\002\256\265"
+	.ascii	"\245\255G=e\206h\3259\037\250J_z\265\366\211\024\365Ck\025pY"
+	.ascii	",\267\031\211\224t\220\254\326\302\271\025\315\316\b\324\362"
+	.ascii	"+\316\233\271\232\331,Y\221l\370\265C\b\206"
+	.string	"\301D\365tU\345\263\272\321\"\255\262\372\265H\203R/\226l\004\245~2\226&4\261h\252`#\365E\005e@I\375R`U0e\362IMY\240\257\006\320W\242\352\207Z\001\247\250J`T\324SY\032\212)\206\324O\006UT0\ra\342C\211\324\312\367\002\370d\225J\375\236f\244P\300\252\224)\311ST>`j55\005Ly\306\254\227\327\206Y\347u\246S:\212\266\256\265\223\251\\C\326\265Vw\360\254\227m\2365\206,\253\345\313\304)\016\r\265b\267\205\320\204\260\321\021Y\340\021.\255\002\322|\327D(V?$2dd/i\264\263\273\263\363\311\325\b\241\270\311\262\315\375\311\227\220\344yu\032\331\243}9\356\331\252\206\216\230\250\224\017\022NI0f\013\253\\\220\360\212\201d\240^\211\034\002jP\221\264\b\003g\250a4\305\020S\n\t\311\204\321\024\024$\035p\"\031\303\232\007\021"
+	.ascii	".\"\273\205l\215\001\237\336\304o\213\212n)\222\177\266#\233"
+	.ascii	"r\203\335\\'\200k1\312\256n\246\207\027\272\250,\205\370-\021"
+	.ascii	"\341aPoX\260F\024\207\344m<\"G\204\002\024\237\253r\241\007\236"
+	.ascii	"D\352\331xk\035\204\235\327U\006\221Z\004<l\371\254\373R}\325"
+	.ascii	"\217-P\023S]\3508\317\256y\307=\031!\244\302\314=\005\347\016"
+	.ascii	"\256\344HB\251\033t&*C\212\310l\234c{\311\316|\222\233\324\330"
+	.ascii	"qTO\375\030\235\204\255\216~e\347w}j\236\224\347Y\227\316S\356"
+	.ascii	"[9b\244)\316\027@\022TJ|\364;\3756\204\tt\317\333\313\374\t\220"
+	.ascii	"\246\271\205\257\200\r\fs\200\316\026\233\212RI2\327'\354\331"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_udpSend.8.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`\031\001U\r"
+	.string	"\206\030XB"
+	.string	"\2614\035OeY\234a\206Q\f\342t\213\352\335\263s\032\265<\336\024\\\2514\370q\262\243h\352\033v\240\034\264T*\322\230\276t\306\024\251\247\0139\231\317\350\231-jP3\334i\336M\310\2262\245B"
+	.string	"D"
+	.string	"F"
+	.string	"+\222a\261\373%\260\002\353\223?\313\266_\342&:\233\364@\003\214\201\3412\302\261\273\321\343\004\250O\360\003\250O*\342\335\263\363?\372\201Q\311{\t=+\221\335uz/\035n\275m\004\266\033\330\217\t\257\371\255\323\374\325\277\037Vi\245\3229\245\357\231Z\3208\351\306.\207R\216\2251\271 a\333\027DZ6\034\304\215L\214\032\033\332\217\333\235\355\261\2555\030r\030$\215s^,x\332\237\371\211\356\337\312?\033\240\274\247\n\367\203\206lc_aR"
+	.string	"\230\0028\251"
+	.string	"f\2566\311Qd\016\371\f\317\306U\2508\300\361\354\222\2470\261v7\344\306\202v\033\230\021+\324\247k\245\303\363\300\222%\373\013\245\206\260\017WE6\225\356\004X\206,\005^\3345\002\241A %'Y\005\224\021\225\030a\002\004\t\221\303H\266\213\213'\331e\022A[J\0041`\r\005\333\"\247i[\364|{\270*\352\250\007\213\266X\265\243w\331\361I\001\247@\335\346\037\267\264\322T\373\n\035"
+	.ascii	"_\211\"\023O\307h\335\037*FD\005\021v\210\213\211H\202\t\246"
+	.ascii	"\264j\335s\223\314V\007\355\335{k\271\220_\301Z\210\214\f<c#"
+	.ascii	"P\325\300\0250\007\002\013\252\034\270\002\346\nT8\270\333\243"
+	.ascii	"Z\351\b\223\f"
+	.text
+	.section	.gnu.lto_udpRecv.9.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`|\005E$"
+	.string	"\332Ax\016K\200\026V:\243\315\346`^\031\332\205L\364\260\f\203b\317}J3\233\232\360sgkT\022\002\334\341|\355\336}\274\277\022\031\224\016\344\346\307\341\370\317\017?\214\354:\300\345yX\320x\242\005\270%\360\337\335\370%\215\020\262w\222\001\323"
+	.string	"\307"
+	.string	"\322"
+	.ascii	"k\313\344d\303\227\005\207\212QYes\256I\201h\277>\363"
+	.string	"~\303>\233Z\242T\253\344JT\227\234\3178\210ut\347\251\231\223\r\252\304\230?_\033C\253\336;c\250\274\374t\025%\204\301dd\201p\275z\013\023\007\277\335\357:\222\341\2334\336\313\031K\353,\347\246\202^\320~\355f\373#g\016\273\243\026\240\324\037m\307\26009g\337\316\005\260_\325\337\260_\261\217\346]m\276\325;<\216]U|\207\375$\3618\234$\354K\372L\3528\253J0\"F\255&iT\257\023\352\307\321\216wUq\225'V5I(5\202\322\307\224\253\375\332H\026\257:\204\352\370j'P\344J\372LR\375\342\206r\316}\221\311\251w\373\356\316\321\335(\272\327\032\0019?\350&:Z\321\323\2269\347\240\257=\306\266\224\314/N\367\r\343*n\\^0\316\352n\022o\201\033^R\215\261\272{.\366\3469\330\277s\257\337\300\235\177N\3566\316\233?\201\334\355\233G\337"
+	.ascii	"t\267{\271\333<\232\3336\271\3335\271\3334\272\3333\273\333\273"
+	.ascii	"\335m\335\314\355\234\356v;s\033\247\273\315\352n\257\273\333"
+	.ascii	"j\3566\326\335\276\271\333\367\3519\213R\247V\033\22663\216\267"
+	.ascii	"1ym\205\n"
+	.string	"y\364\027\373\237\177\331\017m%5W5\227SAUg\3140\231\230\177\330\356w?\255\257\326\273\250\217\232\305\262\232\205\345K\263D\367\260\277\344c7;Z\357\316\336dx\350\213\241b\224\252\245\245\313\210\366\001\271\n\023;\301\217i0\326!5*gpw\210\233\215\270a;<\243\303;\254\2021\022\311a\335\247\317\3019\214\223:1B[\334M\342f%\360\224\f\322\r\267\370\3072\270\351c\2609\030\207#0\277\244\316-\026K\177\001\226\003\224@\220n+\276\230\305+\331\221J\305+^\267\034\313`\374w\024V\3057\216\021\302X\350\212MIU\361\276q\370\225_\200\345\235^|+e\020\250S\363\035e\217q0\276bsn\365\211\257u\264\3159\007\365\251xH\321\002\241\301~=>\332{_L%W\227\323}[qV3\340\201{\360\212\274m\343X\276\332\236\256\230\2539\347\254\342\254\373\260"
+	.string	"p\017\306!3*\213\367\255\373?\266\273M\034\312\357R\2469G\277\037\016\032\255\3000\2047\t\350\002\013\201L8\210\364\0236)\001\221\216\204:\340\214\243\240J$$2R\325.\002j\221t\344b\311\250\311\247A\304\205\020>!\220\005\023\221\320\227tD\204\344+b\n\372\200\016\264\322\022\220\311'TRb\362\355\232\371\030\253\227\206t\261<\030pLY\201~s\203{\310\t\027\273\351\031,{\241\346l%t\350\337\305\013\327\303<\370d\3072\b\306\206F\234\374\347;\330"
+	.string	"\346\035\031r\335#{X\315;0\021LGi\246:K\036\316u\331\340\356!\222?\231\320A\227\202tsr\003\036l\331M\341^*\264wNm0\003bXQ\372\314\241\363e\312\n\213\263:\301k\260\212\326\271O\273\331\205sy?\003\373\264\243m@\322\340\356\016\037\356\2215X\rn\250q8\246\2201\204!\nhFR\322\2441p\002\021\272\252\036\020hY\2244\006_\374\005\355\354\363FBHU\274\006j\212\340\317J\004\031\020\342\237A.\343\234\243!\377\251\361\263\r\227f\256\243\2205U\305\235\207P\013?\355\370\rj\2733\246r-\242,\314\212r-\023\217\211xHx\2167\351\341\006-\274\323io\020\253O\234\3766\032F\266\377?f"
+	.ascii	"\005(\237\232\263\305vX\363 3t\356}\327f\302\246\001\264\320"
+	.ascii	"\350\f\276t\200^\364E\260\"\265L<H3\330r\032\tvG\276\254\352"
+	.ascii	"\367\020\374\202\026\016\016\251\0345q\230\342\374^\361\323\364"
+	.ascii	"\304\326\215\377#\3532\214\f)4\215\035\346\2220T\344\r\206\337"
+	.ascii	"TW\241\320\331&P\013O\261\224V@\215-\332\310))d*\001\006,\332"
+	.ascii	"\0041\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\025\006"
+	.string	"B\t#*pm:\210_UY\317\336\256\002\350\377E\354%\341\021Y\310\377\377\377\357\352\377!\030\226"
+	.string	"\256\277\031hDK\215F\226\310-S\317B\325D\036h\306\235 \026W'\227n\006\252f,^h\277\363\323X\t/\244\351{}\200\257\244\276\024\030\312\257~\272#\315\007S}#\326\027\302\205\007\033\034Lh\360\305\340\3111\266q`\301\003\2153\355\356\237+)X\240\033\205\323%\330Bp\025%\275\371\371\367t:uw\037X\306\377\332\t\026"
+	.ascii	"\211+\364Z\030\003\214\f\262\202\315\272F\275Z\203\003\265\003"
+	.ascii	"\240\003\240\003\240\003\240\003\240\003\240\003\240\363\201"
+	.ascii	"\334\340\245?\005\303eO\252n\203\037\2565\307"
+	.text
+	.section	.gnu.lto_.refs.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.817de0466b90c430,"e",@progbits
+	.string	"(\265/\375`\372+E\257"
+	.ascii	"J\022-=U0\314\034\246\016\024\020 \fQp\336\260q\311T\302x\332"
+	.ascii	"\352\002\315n\001\243p*\005\026-;\024+lF4\023\352:B?\253\207"
+	.ascii	"%v#\265r\375\304ut\271)\204\253\245\003\255\215\256\263P\320"
+	.ascii	"E\373\232k\251\n,dS\357!\334\376\242\323\225 )\223L\001q\003"
+	.ascii	"\325\003\254\003%3\372\274\310B\276\254^h\375\274\n\223(\214"
+	.ascii	"\263g\240\353?\347J5\317R\025\340K\277g\005\322\326\341\030\342"
+	.ascii	"\317\032\317\357\234\220\240X<tRs\375\261\256\361\206\254\307"
+	.ascii	"V\016\n\275\245\361\223\246\233\300\336\276\242\217\323\200\033"
+	.ascii	"\207pS\256\377\221+-\321\342\233*{\350\327\334!\236\311]s\n\032"
+	.ascii	"b\377|\247\373\336\333$\350\256\307\340k\377 \327\037\305\"\n"
+	.ascii	"\311a^\rU\020\r.tm\354\n\210\340\321\nG\021\330kw\254\230x\002"
+	.ascii	"\331\326\216\327\030\361\004y\326\343\257f\321\305X\356\035<"
+	.ascii	"`C\374\207\005K\234\327\335\323\341\212\007q\213\257\f\261\026"
+	.ascii	"\366\302P\023\265@\r\253\276'\274\305>p!&\304?0\026\033\272\343"
+	.ascii	"\036\330\317O\256{C\305\310\360\036\246\003\003!\360\206!\016"
+	.ascii	"s-\246\003\363@\252*\360\013\033b>\274\207\001\305\336HT%5rf"
+	.ascii	"k\333\275wJJ\311\231\334\217V\211\306\202\217\003"
+	.string	"\361\240cA\f8\002\275bA\2151(\301\030\203\020\255\214'\227Q;\036s\035o\271\371\003\326r\035_\271\256A\035\336\221\257hnN\022`\340\336W=\234\207\3610\017\214\305{\370\316\261\030\036#\333{\257\354\3412\214\226\257P\310\034=\305\257=\234\206\3352V\352\216\341\034\006b\035x\017\303a:L\247\2645\316\366\253\006\325\336\327\224\223\224\224\224\354\304\305CJD;\206\262;\346\274\3415\031\271\216\203\\\034\207\3450V\003\236s\374\206ux\310\363\272\257\231\316\rJ\365\332q\217\353X\2031/.b\rF\3077\356\343\013\306\n\030\213\335p\016}\335\3335p_q\354\206\3250\216\022\350uO!\020\366Uc\273\367\365$ED\b.\tGkwq\361\032f\303X\024\254u\f\206\277\034\t\275\356\354\336W\023\222\266\270\264\265\327\356\001\3271\212\321\004\243\030\035\204\353\037\270\216\321\n0\202-"
+	.string	"d[\037\226\217\327\330l\305\361\331\005\243\024\350\272M\fP\246M{}\214\200\353\016p\361\306\026\030+\260\270\032_0f\300\026\030\035c\255\360\025\356\312Q\235\352\006\333\373j\201\0025\204\372^c.\234u\334\205\267\274\203\007\317\316\255}\265\367\306]\033T\367~\342.\023\305\275\237&\030c\2001\006\272\252\350I\314\250}\305\r\300s{\360\243\353\357f\300\027\214\034\256\330\002\243\213/\030\335\177\003\367W@\322\0353\271\377\213\273\373\370\016D\270\343\024\270c\023\334\361v\307(\3003\356\270\351\216\231\376\001,\303\035_\335\361\tY\313\375\023\320\342 \360\n\334s\224;\346\373\021\270\343\020\270\377\353\3569\360\334=\360A\270;\241\273\337\375\006^\003\356\276\367\372Ep\367Aw\327s\367\255\373#Cp\377\013\031pw\303'"
+	.string	"\b\356\236"
+	.ascii	"w\307\200;~q\377\013pp\317G\356\357\201\373{p\177\r\356\217\301"
+	.ascii	"\375\001\340\376\"\356\037\342\216\017\335\261\240;\356s\307"
+	.ascii	"s\356\270\315\035\253\271\273\326\335\347\334\335\316\335\021"
+	.ascii	"\335\261\227\273\303\270\343.w_\272c\254;\316r\307W\356>\202"
+	.ascii	"\273\007\272\343*wL\345\216\235\356\330\204;V\272c\022\356\036"
+	.ascii	"\304\335\201\270\273\242\273'\272{\bwG\200\273\277\271\273^\\"
+	.ascii	"\\\\t\377\021\334C4pG\200K\376\226\273\274D\r'\354\r\317\365"
+	.ascii	"\023\260\277\031\335\363V\306*I1\335\344+\246\372\211{\312e\275"
+	.ascii	"\321\016\217\315\226\257\220y\204/\214c\256{\266\2522\261\372"
+	.ascii	"Aj\272^!\323\022\247V\334p2\036\205Q\257c8-)%!9\0359\0319\025"
+	.ascii	"Ya8\345\247<#Se\033\031*Ge\031\231F\236\3125\262Tf\312M\030\233"
+	.ascii	"\235r\325\211\310)\277p\342\252JI!\321\341\263\223\201A\337\344"
+	.ascii	"\233+\235\034}{\312?A\226\262\317\327\234Q\226\206\201\355\f"
+	.ascii	"\235\312,\272\250@Yg\307'\347\034~e*\220\241\314\263\204\315"
+	.ascii	".\3422\214|\224c\344\245l\315E\271\232\221rRV\312F\371E&\302"
+	.ascii	"\330<\224\207\336*\003\t\241\314\330\272t\212uR\fBa\306\252\325"
+	.ascii	"PT(,\363\031\035\022\005q\231d\225\354\364\202\270\262U\326\241"
+	.ascii	"\213\026X\310\024\213^Q-\2602P\222\340\f\033\035\350\312\362"
+	.ascii	"Yack\273\265\3032\351\210\331\324\017$\025Q\373\030"
+	.string	"\227\204]\223\272Hl?\304\246L\033[\375\002\217\244#S\262\033<=G\373wT\020\031IK\272\2449\201;\325\355\356\364`\231I\217Om\325+\205\213\0352\307\2647\205\365\374\216\224P\374\204l\021I\201>\273\265\367\206\303C\202\254\242\255t\304.\356p\316&\272E\216\262l\340\244x\332\324\326\224k\236Q\247\366/?\007Y\304(z\355\032$>\020\252\241\300\275\367bvbl\336\037\344$\357\337>\"\246\003\272n\037\221\242\355 \332I\nr-\316-\312\250\335\030U4\362,\245\210.\272\036\262u\017?\353l\005\"\237\353!v\256\373\3770,AU\221\212\327\205\030\373\206\206\357\367>0\324D\367\236> *\332\007\267M1\022R\225\370\264\366\367\341\376}\337\343\tG\252{CIn\260}8\257?\360\0051\326\341~\320\261\031U\321\357\265\2074\271'lw8\343\377\255\370\003\032\203\034\246"
+	.string	"{m\022R\344\272x\3639\334\3269\246\260N\036x\310\301\243\247\326k\035xnmx{\237\367v_\367w?\367rO\367p\257\367;\376\355\3430\366\361\2369p\340i\361\330\360\326\324\322\360\320\360\316\360\276\f\217\313\314\375\352\231\003\304\240\277\236\314\206\320\323\323\370r\332o3\325\344\363-\316\346\246\276\252\353\346S\314\310\322\371i\324\231\321+\215\351"
+	.ascii	"\375\2132\277\241/\032K\304\276W\211\323\302\336F}K\357\204\351"
+	.ascii	"\200*lh\330\013\264\327\361m\257}\266\317\361j\237\366k\177\366"
+	.ascii	"n\217\343\313\036\rc\337\f\354\315\336\352\257\371\032\265\267"
+	.ascii	"\021\365\303\024\225\236\\\312\005)\310 (\354\256\030\334?5\303"
+	.ascii	"\24411\214#\365\204\204|\242\261\365\205=X\311\n;\244-\237\353"
+	.ascii	"\332\315uS\243\301\324\225\025\223\032\325\034\023\363j\274\270"
+	.ascii	"~\353\310\003O\357\013\315u\315\345\212@\351\262?\264\262V\246"
+	.ascii	"\316\200<\240\266\212\204\365W!ek\206y6\\\327I\256\211Sa5\353"
+	.ascii	"\006\325R\324\353\006\0317\324ck\343k\270\275\310\363\361\332"
+	.ascii	"u\220\353\032\307\305\211A5\016gH\211 \313\355+\327\310h\273"
+	.ascii	"\021\365P\024\244p\254\340It=\367\271&~=\204}2\232F\344\202\242"
+	.ascii	"6D\246\324\256\032\246\217\221\247\254\b\257\344\\\317eIH\031"
+	.ascii	"\3075J(\t\251\254i\356\252dj\312\r\352\b\337Q\310qQ\270\205e"
+	.ascii	"\205\2416\026F\265\302\240\340L2:3\376 Y\021\253Ot\264\271\233"
+	.ascii	"A\005\345z&\242\n\201\200\007\210\016\252\020\027\326\036\323"
+	.ascii	"c\251ky.>hGj\367\365\332\263\324\365\007\342\032\267P}N\026+"
+	.ascii	"\002N\257\265\325\001\027eX\237^k\030\331\253:T&\364ZW5\221#"
+	.ascii	"\237,\\\003\261\320\324\006\354"
+	.ascii	"\2310}\325\261\020rM\275\351\341\303\356\265v\341&\206i\335\275"
+	.ascii	"\326A\256=\276\311\025\021\271V\257H\263\212{\255[$j\035\327"
+	.ascii	"<ZG\377\340\025mzrT\307!)\026Z*\\\377 \263<\326\236\327\332\307"
+	.ascii	"\265\336Cj\353\343\265\236\202\340r\243{\255\245\256E\272\025"
+	.ascii	"\371\004\276\326=\016\310\366Ww\370Z\357\270\201\256\343\270"
+	.ascii	"k\034\235\243uC\362\261\335\033\b\3058\246\303\312\245Q\270\316"
+	.ascii	"\t\321)#\344\361ZG]\353+\n\2636Z\n\326\035\236\027l\211\236\201"
+	.ascii	"$j\233\2347\262\235[\273\347x\346V\204H\001\233\002[\367\332"
+	.ascii	"\265\215kh\007\017\356\347R\325\310{\276\3265\256\237@qj\201"
+	.ascii	"N\375tG\212\3148\312\332\230r=\003w\213\305\242\373=\r?\035\301"
+	.ascii	"\3279\210kG\200\364\266IY\321\263\235\332\320\221\365N,O\b\312"
+	.ascii	"\211\320\363\017\302|\250\331\366\256\341p\255\331\333Q*\212"
+	.ascii	"I\335\226\242t\353\371P\303Q\306\223\342VC\316:\305\231\275\316"
+	.ascii	"\206G=\274\267\255\327\2710DHE\037\r\037Jpr\256\222\353.\013"
+	.ascii	"?\317\200~Y\020o\355\036\2210\245\305\355I\334\031R\240gA\214"
+	.ascii	"#c\005\351\310aeb#1E\336\353\3747\350z\235g\274\272\334wRu\n"
+	.ascii	"r\300\212F\201P\334\271',+>\317}\":IsC\2573\017\327>\305\262"
+	.ascii	"b\257s^\3363\301\023[\322\276\316z\027\344/\277,Q\234\353"
+	.string	"\205Y\253dg\032c\352u\336\341\371\316\035\211\364\301yj\263\353)\262ACs\3758\246CG\236\313{\017\361A\035\375\022\373\006\345<\317\375\016\217\226\212\3279.\243m\037\234\235\327\031\316\3750\323\330t\372:\277e/\026mqY,\243\\\217\"\"\027\033[n\303@;\367\321!\016R\231\004\375\354\364\345\360\334\246[\264\005j\275\31682\232\233\206\025\303\371:k\035\220\204\f\253D\315^Y\256hG\215\225\353\031,\207y\026s\261\254\346\356\275\361\321F\034\334n  \024#\242\325\215\3044\317j\256\035\331\030L\360\347T\226\321\262ZV\025\024-\237\265\331\364X1\342\034\232Q\330kl6s\314\023e\363\366:\223e+c\016u\317\347u\036s-\236J\213\321\343\265\027:r$\307gm\350\265\037\247\256\277\273q?\245{o\237\220\353\226\326\214\030\335\261\343\020\214Q\334Ip\306\007\330\333\335"
+	.string	" \354\355\364Q\365\341\3168{\ne\330\036B\2677\324\352\214\200u\n\265\266\210f\255\333\turZ\220n\2533\232\335\333\302\206B\235\036T\267\205hvO\267\215\335\024\357\253\325\271\241\325maC\3673C\024j\235F\263\317\251\205h\326:\335Y\353\256\260\241O)\n\350\226Z\330Y\253\340\316V\247\025\242\331\3524\232\265\276\300{\321\037\203S\300jQ\034\306F\241\233g\207\372\224V\240\213^\253{oo\fv\263\245\007\330\233Z\225\356=[`\264\032:\236\032\262g\025_\260SST\335P\272(\215\352\3364jH\354\235\r\234W\272\275\204\351\234F\324\255s\263\367"
+	.string	"v\366v\342M\267\367v\356\275\217R\352uo\027\025\242P;;{\003\235\354l\2523\355f\357\007\343C\233F\263E\325\2254\257,\324\306\271:1\324\336\263J\335\254\023\273u\b]\250\251\212\301\327M/\200\320^g\256\234\305\330\fhi\266\274\274-\314c\262i\202\210\r\315\227e\345}EXV\336W\304\370\226\224\210\231\031\3412\2171\315\227e\322\330\224\211i&\231\"Nb\203\0050\315\245\313\210\020'\261\201\204\245r\246\311\f"
+	.string	"\f\f\315r\031\263<6\223\314\022\311\022\306&s\031\343\022\302\262\"\323b\002\246\210w\251l\302(iD\274\257\005'\261A\245Ef\246\345\002d\005@H\340\005\341\201\007\022\300@\007\"\204xG\b\021\202\b\035\274/"
+	.string	"F\264$a\264\tbfH4c\226\307\227\245R\2046\341\222\004\361\262L\206h*\227\037\310\274\320\034\335E9\223\\&Ip}\003\226\fX>\2348\372\007\0168p\300\301\350\0378XY\341\200e\305u\226\225\334|\223'P2\215\315$\363}\031al\276\313$\f\262\371v\320\240\271T\322\300\264\230h\272\320\3144\231*\314\244\214\tM\025\016`ZL\034\233o\262\204\262\371\276\256K\222\371\232h\032\233/\363e\031\303|_\022\227$\223\3465\321<\272$a\222%0[J\274/#\336\027\311l*E\274\314\227\021\315\244\n\323\004\246\n\315\222\204\fN\320,\2250\031l\300\362\262|8\261"
+	.string	"\017\035N\270\357H\263\245\331B\362\276\036:\234h\261"
+	.string	"\363\002\363\262\214I.c\222\357k\302\262dY\226\274\257\314L\313\262\202\0232'db\230\312\221\367\215a*+0\227\314\345\222\346}\2274\357k\322|KX*A\220y\241A:\t\f<F&9\243\322\214\211\231Q\241"
+	.ascii	"\023\0233\2017d&ib&\031\202\251t_F\274\222\371K\345[\202K\f\223"
+	.ascii	"B\363maR0\001FY\242e\204H\363u\022\033\226J\225fr\251l&\227*"
+	.ascii	"\311\027\032\030\227\245Re\206I\2432\200c\363E2\21513\311\023"
+	.ascii	"\274K%\3235\341\222\234\321\315\231\030\031=\323B\302E\373\312"
+	.ascii	"J\007\0318\020B\005\\\227\r%,\22502/4* \214\360A\b\225f\222\204"
+	.ascii	"\231\226\246\312R\331RB\305e\206\251\262!\303\314\313K\213\316"
+	.ascii	"\323S\317$x\006\206\303\320\356\306\335\033\312\365OmG\026\372"
+	.ascii	"t\363\245\355t\322b\fD\267\272\334W\246\244x5'gbFg\3303''\025"
+	.ascii	"\204\212z}\035)\254[\254z\255\3374\216\243\253~\3239\264\016"
+	.ascii	"L\007\264\367\024enIj\bN\307a\254~\373\255?9\346@E\337\214\332"
+	.ascii	"\265\016w\315\246\265\270k\004\257#\004\004\370Z\267\255\270"
+	.ascii	"v\373'\260\267\267\327$\310E\327\221\205\256\007b\013\214%zM"
+	.ascii	"\360\213\276\360\022\257,|9fi\371\360*H\b\315\246\204Nkq\351"
+	.ascii	",\007\004\333\225\fm\246\177v\020\265m\313\250;/-\262\021\222"
+	.ascii	"\321T\r\006\275\326^\332K\213!\235\nXr\242n7\320\017\212\273"
+	.ascii	"\016s-\246\301\300x\024j\201)\201m\377^\353/l%\322\211a\345:"
+	.ascii	"\022\312\206\r\235\275\261\327\007G\302\204\227\245\303\345:"
+	.ascii	"{\3644\266\345Z<\355_\324k\215\325Z9\260nm\257\365Uk5\215%\311"
+	.ascii	"x\255\255\264\326\221i\221\357/\013\313\230\002\017\254/\013"
+	.ascii	"\213Kk-_)@\231%\362\351+]\365\343\325\003v\327\204X\245oh*#\025"
+	.ascii	"\214\253\033\232\352\203\230h\307\236\336\226\226\334\227\364"
+	.ascii	"\224\007\250\364\344\250\360\324`V\023\r\327SrR\033\310k=#\204"
+	.ascii	"\2405\260\327:JK9\221\327\241\365\265\237\377\315\350\241\226"
+	.ascii	"\365ZCe\257 \352\026\307k\375\204\244^\315\232\264\223\0379\251"
+	.ascii	"\212\257\265\214\0213!33\027\256\027j&\256\275m\242V\005AXHu"
+	.ascii	"\214\254e\363b\317p:4\244\223N\252\316\301\f9\242zr$yi-\374\214"
+	.ascii	"\\'i$\nhy-\352\364\221\311U\320FC\341\352\242\207[j\013\203\233"
+	.ascii	"\250b\3214\n\003\2311\b\321\210\310H\222$\035\262\013\020\006"
+	.ascii	"\"i\226;3\017\022`c=\215!\353\030C\"RRPT\220$\215\001\224\330"
+	.ascii	"\001\210\321@\305\300\374\307t\230\334I\241\024A\277\340\250"
+	.ascii	"\013^\021\223Z"
+	.string	"\203t\033e1\022Qj \372;j\025\311\315.\254@\344=\030\266|J\272\224/7\352%F\013\324\006\302\004~\301\232\357\224U0\021\306\025/f\247DV\264\350\260\315\224)\214\004\004'\310\f\350\003\216X*\214\217c\326\343J\330\037\243\215\354\2506\031:\267\255\374\267\214\236\212L\225\333\342@(5E\201\232r[:$\016\034\204@Y\326k\302\"\217z\205'\233\025B\225l\243A\270\264G7\033\2758\177 \365-\275D\303+\353\244/\036\244\2644\324B\257\0162\331\b\031\257N}I\245M'D\3418\206\3230\314f\006\035_\351\\\270&\322\002\210\261{\002\2132"
+	.string	"x\020\241oA\023\305]\201\003`\350\345\225WV>\264\022T4cY\350\3431w\r\253\307\221\342'Z\007\226:.\275\324r\350\304\\r\217\274\036W\222\326\033\tX\355*|\373@\367\f1\2152\222\206`A\304i\320e.p\302\323\247u\220\226\257\344\214\024\0209\2218\253@hP\025\346a\366{\230\334\316\021\016\260\321\242\035H8\215\317k\253\212y\342\327.y-Xx\303\246}\263\300\356\332\237\024\003\364!(\025\262\347\f\230\3643\370c\216\225\227\351\353\003\350\2409\324\340\312?}\341\257\371\302\\\225\372\r\336\365Lpd\320\342-e\330\212[|\300\376\3203\321\373\001\317J\313\202L\361\354\333\346e\336\235\276\237`X\0365"
+	.string	" \245\003\003\322=\300\363\274\335\343\rB|!\264\025^\341\253X\364(H\006ay7[$\016\251\221\004\202\tk\335\305\017}\375v)a\300\032\221e\306Ba\201\006\357\277P\037\217f]\270\016\005\032\272\221\216T\314!N\362\240\330o\2071\267\342\013\n\024wWo\377|\306e\246\370\034\355[\344e\240\021\226\035j\013\304e\302\363\214,\325\323'\205\246\212\003\360\360(@\223l\0340\355\357\355-\022\226\021h\340\335g\b\004Y\232\275(b\234\220\302Q/#L\3643%\320D\335\031\352[\357uQ\b\315\242\251\334\373\3263\256\354\330$\366<KvQ^\345=\030`\324-M\246\213\314\3626s\016\254&\274\230\272\027\020\343\205j\277z\231\316\t\3715\250\205\252G1\217\361\372"
+	.ascii	"S\237\206\307r\207\253\004\306?\377\306W\202\327\230fD\2726\251"
+	.ascii	"\034V\036\242S\272\021\357\025n\200\037\202\202\371\372\205K"
+	.ascii	"V\334\306pBUr(\253\250\246\275G\343\246\324\215\223=\320;\334"
+	.ascii	"\003\221N\345\332G!\023\220\302,\251\263d9\353p\272\273\347t"
+	.ascii	"mi,\260"
+	.string	"\216\3066\320\345`*\234\204\262\363|\366\246\226d\361\307O\005\274\241\343&M\020[^\231\310\200\271\372\362\211\004\210\032\301.\244\r`\032\3562\343\355_)\266\202\271\230\374\262\350f\220\206\205\002\200\235\313\311d\3015\213\375\227\263\366\0317\b4\024\233\341\323F\314\340\017d\270\236\360a\220p\316?\3072x\303\216\005D`A\266\341o\315F\360W\177\337}\255\037\302^\310+\262\235s\032\211z\3161\002\01769-\266p|\253[\272e\\QA\023\260\361\305\365O\004K0\335\030\005\214\322\313\345\276~a\271\277\206\017\277Dgw\036pr\006\241\240+\276\337\342\001\366F>\036\365\231\220\202\3268\234%\220i(\345\344\201\256\277\331%\316\220)}hR\027\313K\353\367\205\t\177\003\006S\372\227\276`\302.a\265\005>N\027\024VB\204\201\006\223\306$\022\216-p32\0018\233\003|\250BZ|"
+	.string	"\332X\"y`\366\205\023\340n\220\3253\376X\347\370\017\345\001\336\tx\235\2028\013v\266A\247\265\006\362;\266w\227\243y\242:v\203\362)\205\262\367f\203\210\021\354\026\226I\232G\3710\242N\302\343\342p\245:\231\334|i\013\322\006\034\027\232\205\2632k\351p\304\242\370P\232X\364\033\3740,H(\002\213\033\\\007TK\274I)(\2461,[\333\037B\030br;IX\241\f\371HKa\236\"\244~y4\364Gg\266\007CG k\230\215\030\305\030\030\305\026\370!,Z"
+	.string	"\023\024\025\365\030\300\017L\314EC\270\021p\341@\351\234\324\024\237\001\267\300)\006!Z\026\254e\037\244i\007\300\236'\302:\270\242jL_`\201\231\321k\001\0233\217\347'\276\017xd\200\232P\033\2010%0\345l^A\222U\037v\332\212\243D\004\270\360,$~_\247W]\034\365#gx\332\177\235\032\017\250\211\3672\355O\304\314+<\371\213\003\267\374\306\270\177\002KV\263\221r5\004\363\301\325\326\277\376?\241\232}\305\001[w%\372\227\210\231Sh\372]\030"
+	.string	"x\341\022\310\217\244\227\337\037\260\017\332\275\001\206\371\275^\313^1/\260\363|\"\372\232\004\001m\276\036\346\n'\371\r\260\023\362\232\304z\354\242\357_\373\237\240\236\377\"@\334\270\005\360OZ.D$H\213\364\013\2408q\217z\3360\360\005&\263\f@>\331\300f\342\363\362\217\377/\031\224\252\271d|'\372\0077\301\003}o\310\260\202(9\315\351\263\320\220\257\214\265'\335\216\007\001\372\f\332(-s\340\027\031"
+	.string	"\334Q.\"\r\002\013:\327\021u\022t\251@@\213\317\257\260f\252\004\337\001\3031\257\n\352\006\361e\252\211p\261g\315\241\243\237o\241q\255\032D\216\215\030X\272M\234\212\313\261v\016X)s\260\324\3275\023"
+	.ascii	"\344\306\221\334\352FU0i\273D\347\256E\365\357\374K\245b\273"
+	.ascii	"\202\257\325\b'c@\263fS31g\177\017\205\264u!x\t\226\366\365'"
+	.ascii	"F\t\351j\314\241\222\213\363\210t\316ll3F\016\340N#~\267\374"
+	.ascii	"\207*\276\222d\306\331\312\340\373\206\236\364\3737xGs>i\346"
+	.ascii	"m\214\3479{\344gq\357IE7\320W\302\207\367}\351\264<\272\001\304"
+	.ascii	"b\r\330\231\356\365v\016\203-\031\366\204bG\345z\2344\247Z\331"
+	.ascii	"\370\240;\250\252\343d\257\331\201\351\016\373o\374D\371j_Sh"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.symtab.817de0466b90c430,"e",@progbits
+	.string	"udpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"inet_addr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"sendto"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"recvfrom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.817de0466b90c430,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fmerge-all-constants' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -28,9 +28,12 @@
 #ifdef USE_BLACKBOX
 
 #include "blackbox.h"
+#include "blackbox_block.h"
 #include "blackbox_encoding.h"
 #include "blackbox_fielddefs.h"
+#include "blackbox_gyro_capture.h"
 #include "blackbox_io.h"
+#include "blackbox_predictor.h"
 
 #include "build/build_config.h"
 #include "build/debug.h"
@@ -89,13 +92,18 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 2);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 3);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .sample_rate = BLACKBOX_RATE_QUARTER,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .fields_disabled_mask = 0, // default log all fields
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .block_frames = 0,
+    .block_huffman = false,
+    .adaptive_predictors = false,
+    .gyro_capture_ms = 2000,
+    .gyro_capture_erpm = false,
 );
 
 STATIC_ASSERT((sizeof(blackboxConfig()->fields_disabled_mask) * 8) >= FLIGHT_LOG_FIELD_SELECT_COUNT, too_many_flight_log_fields_selections);
@@ -111,10 +119,18 @@ STATIC_ASSERT((sizeof(blackboxConfig()->fields_disabled_mask) * 8) >= FLIGHT_LOG
 #define UNSIGNED FLIGHT_LOG_FIELD_UNSIGNED
 #define SIGNED FLIGHT_LOG_FIELD_SIGNED
 
-static const char blackboxHeader[] =
+static const char blackboxHeaderV2[] =
     "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
     "H Data version:2\n";
 
+// P-frames with adaptive predictors don't decode with the field predictors the header lists, and older decoders don't
+// know 'B' or 'R' frames, so they must reject the log
+static const char blackboxHeaderV3[] =
+    "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
+    "H Data version:3\n";
+
+static const char *blackboxHeader = blackboxHeaderV2;
+
 static const char* const blackboxFieldHeaderNames[] = {
     "name",
     "signed",
@@ -276,19 +292,47 @@ static const blackboxSimpleFieldDefinition_t blackboxSlowFields[] = {
     {"rxFlightChannelsValid", -1, UNSIGNED, PREDICT(0),      ENCODING(TAG2_3S32)}
 };
 
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+// Gyro capture frames, the eRPM fields are only sent when captured
+static const blackboxSimpleFieldDefinition_t blackboxGyroCaptureFields[] = {
+    {"time",        -1, UNSIGNED, PREDICT(PREVIOUS), ENCODING(UNSIGNED_VB)},
+    {"gyroUnfilt",   0, SIGNED,   PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"gyroUnfilt",   1, SIGNED,   PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"gyroUnfilt",   2, SIGNED,   PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"gyroADC",      0, SIGNED,   PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"gyroADC",      1, SIGNED,   PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"gyroADC",      2, SIGNED,   PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         0, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         1, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         2, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         3, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         4, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         5, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         6, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+    {"eRPM",         7, UNSIGNED, PREDICT(PREVIOUS), ENCODING(TAG8_8SVB)},
+};
+
+#define BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS (2 * XYZ_AXIS_COUNT)
+STATIC_ASSERT(ARRAYLEN(blackboxGyroCaptureFields) == 1 + BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS + BLACKBOX_GYRO_CAPTURE_MAX_ERPM, gyro_capture_fields_mismatch);
+#endif
+
 typedef enum BlackboxState {
     BLACKBOX_STATE_DISABLED = 0,
     BLACKBOX_STATE_STOPPED,
     BLACKBOX_STATE_PREPARE_LOG_FILE,
     BLACKBOX_STATE_SEND_HEADER,
+    BLACKBOX_STATE_SEND_HEADER_IMAGE,
     BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER,
     BLACKBOX_STATE_SEND_GPS_H_HEADER,
     BLACKBOX_STATE_SEND_GPS_G_HEADER,
     BLACKBOX_STATE_SEND_SLOW_HEADER,
+    BLACKBOX_STATE_SEND_GYRO_CAPTURE_HEADER,
     BLACKBOX_STATE_SEND_SYSINFO,
+    BLACKBOX_STATE_SEND_RUNTIME_SYSINFO,
     BLACKBOX_STATE_CACHE_FLUSH,
     BLACKBOX_STATE_PAUSED,
     BLACKBOX_STATE_RUNNING,
+    BLACKBOX_STATE_GYRO_CAPTURE,
     BLACKBOX_STATE_SHUTTING_DOWN,
     BLACKBOX_STATE_START_ERASE,
     BLACKBOX_STATE_ERASING,
@@ -379,6 +423,13 @@ STATIC_UNIT_TESTED int8_t blackboxPInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSlowFrameIterationTimer;
 static bool blackboxLoggedAnyFrames;
+#ifdef USE_BLACKBOX_BLOCK
+// number of P-frames coded together as one 'B' frame, 0 when P-frames are written one by one
+static uint8_t blackboxBlockFrames;
+
+// time, PID P/I/D/F, rcCommand, setpoint, the optional fields, gyro, acc, debug, motors and the tricopter servo
+STATIC_ASSERT(1 + 4 * XYZ_AXIS_COUNT + 4 + 4 + 8 + 2 * XYZ_AXIS_COUNT + DEBUG16_VALUE_COUNT + MAX_SUPPORTED_MOTORS + 1 <= BLACKBOX_BLOCK_MAX_FIELDS, too_many_blackbox_block_fields);
+#endif
 
 /*
  * We store voltages in I-frames relative to this, which was the voltage when the blackbox was activated.
@@ -390,11 +441,51 @@ static uint16_t vbatReference;
 static blackboxGpsState_t gpsHistory;
 static blackboxSlowState_t slowHistory;
 
-// Keep a history of length 2, plus a buffer for MW to store the new values into
-static blackboxMainState_t blackboxHistoryRing[3];
+// Keep a history of length 3, plus a buffer for MW to store the new values into
+static blackboxMainState_t blackboxHistoryRing[4];
 
-// These point into blackboxHistoryRing, use them to know where to store history of a given age (0, 1 or 2 generations old)
-static blackboxMainState_t* blackboxHistory[3];
+// These point into blackboxHistoryRing, use them to know where to store history of a given age (0 to 3 generations old)
+static blackboxMainState_t* blackboxHistory[4];
+
+static bool blackboxAdaptivePredictors;
+static blackboxPredictorSelector_t blackboxPredictorSelectors[BLACKBOX_PREDICTOR_GROUP_COUNT];
+
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+static bool blackboxGyroCaptureEnabled;     // a GYRO CAPTURE switch is configured, 'R' frames may appear in the log
+static bool blackboxGyroCaptureSwitch;      // switch state, a capture starts when it is turned on
+static uint8_t blackboxGyroCaptureErpmCount;
+static blackboxGyroCaptureSample_t blackboxGyroCaptureLast; // previous 'R' frame, the base for the next one
+#endif
+
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+#ifndef BLACKBOX_HEADER_IMAGE_SIZE
+#define BLACKBOX_HEADER_IMAGE_SIZE 8192
+#endif
+
+typedef enum {
+    HEADER_IMAGE_HEADER,
+    HEADER_IMAGE_MAIN_FIELDS,
+    HEADER_IMAGE_GPS_H_FIELDS,
+    HEADER_IMAGE_GPS_G_FIELDS,
+    HEADER_IMAGE_SLOW_FIELDS,
+    HEADER_IMAGE_GYRO_CAPTURE_FIELDS,
+    HEADER_IMAGE_SYSINFO,
+    HEADER_IMAGE_READY,
+    HEADER_IMAGE_FAILED,
+} blackboxHeaderImageStep_e;
+
+/*
+ * Everything up to the arm time header lines, rendered a line at a time while disarmed so that arming doesn't have to
+ * wait for hundreds of formatted lines to be paced out. It is only sent if the configuration and the field conditions
+ * are still those it was rendered from.
+ */
+static uint8_t blackboxHeaderImage[BLACKBOX_HEADER_IMAGE_SIZE];
+static int32_t blackboxHeaderImageLength;       // rendered so far
+static blackboxHeaderImageStep_e blackboxHeaderImageStep;
+static uint32_t blackboxHeaderImageConfigChangeCount;
+static uint32_t blackboxHeaderImageConditions;
+static bool blackboxHeaderImageValid;           // the image matches the log being started
+#endif
 
 static bool blackboxModeActivationConditionPresent = false;
 
@@ -516,12 +607,20 @@ static bool testBlackboxCondition(FlightLogFieldCondition condition)
 
 static void blackboxSetState(BlackboxState newState)
 {
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    // Leaving the capture, whether it ran its course or logging stopped under it
+    if (blackboxState == BLACKBOX_STATE_GYRO_CAPTURE) {
+        blackboxGyroCaptureStop();
+    }
+#endif
+
     //Perform initial setup required for the new state
     switch (newState) {
     case BLACKBOX_STATE_PREPARE_LOG_FILE:
         blackboxLoggedAnyFrames = false;
         break;
     case BLACKBOX_STATE_SEND_HEADER:
+    case BLACKBOX_STATE_SEND_HEADER_IMAGE:
         blackboxHeaderBudget = 0;
         xmitState.headerIndex = 0;
         xmitState.u.startTime = millis();
@@ -530,15 +629,22 @@ static void blackboxSetState(BlackboxState newState)
     case BLACKBOX_STATE_SEND_GPS_G_HEADER:
     case BLACKBOX_STATE_SEND_GPS_H_HEADER:
     case BLACKBOX_STATE_SEND_SLOW_HEADER:
+    case BLACKBOX_STATE_SEND_GYRO_CAPTURE_HEADER:
         xmitState.headerIndex = 0;
         xmitState.u.fieldIndex = -1;
         break;
     case BLACKBOX_STATE_SEND_SYSINFO:
+    case BLACKBOX_STATE_SEND_RUNTIME_SYSINFO:
         xmitState.headerIndex = 0;
         break;
     case BLACKBOX_STATE_RUNNING:
         blackboxSlowFrameIterationTimer = blackboxSInterval; //Force a slow frame to be written on the first iteration
         break;
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    case BLACKBOX_STATE_GYRO_CAPTURE:
+        blackboxGyroCaptureStart(blackboxConfig()->gyro_capture_ms * 1000, blackboxGyroCaptureErpmCount);
+        break;
+#endif
     case BLACKBOX_STATE_SHUTTING_DOWN:
         xmitState.u.startTime = millis();
         break;
@@ -548,8 +654,21 @@ static void blackboxSetState(BlackboxState newState)
     blackboxState = newState;
 }
 
+// Frames are written in order, so the pending block goes out ahead of any other frame
+static void flushInterframeBlock(void)
+{
+#ifdef USE_BLACKBOX_BLOCK
+    blackboxBlockFlush();
+#endif
+}
+
 static void writeIntraframe(void)
 {
+    flushInterframeBlock();
+#ifdef USE_BLACKBOX_BLOCK
+    blackboxBlockResync();
+#endif
+
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
     blackboxWrite('I');
@@ -656,25 +775,69 @@ static void writeIntraframe(void)
 
     //The current state becomes the new "before" state
     blackboxHistory[1] = blackboxHistory[0];
-    //And since we have no other history, we also use it for the "before, before" state
+    //And since we have no other history, we also use it for the older states
     blackboxHistory[2] = blackboxHistory[0];
+    blackboxHistory[3] = blackboxHistory[0];
     //And advance the current state over to a blank space ready to be filled
-    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 3) + blackboxHistoryRing;
+    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 4) + blackboxHistoryRing;
 
     blackboxLoggedAnyFrames = true;
 }
 
-static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHistory, int count)
+/*
+ * Write a group of P-frame residuals using the given encoding, or add them to the current block instead when
+ * P-frames are block coded.
+ */
+static void writeInterframeFields(int32_t *values, int count, FlightLogFieldEncoding encoding)
+{
+#ifdef USE_BLACKBOX_BLOCK
+    if (blackboxBlockFrames) {
+        blackboxBlockAddFields(values, count);
+        return;
+    }
+#endif
+
+    switch (encoding) {
+    case ENCODING(TAG2_3S32):
+        blackboxWriteTag2_3S32(values);
+        break;
+    case ENCODING(TAG8_4S16):
+        blackboxWriteTag8_4S16(values);
+        break;
+    case ENCODING(TAG8_8SVB):
+        blackboxWriteTag8_8SVB(values, count);
+        break;
+    default:
+        blackboxWriteSignedVBArray(values, count);
+        break;
+    }
+}
+
+static void writeInterframeField(int32_t value)
+{
+    writeInterframeFields(&value, 1, ENCODING(SIGNED_VB));
+}
+
+static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHistory, int count, blackboxPredictorGroup_e group)
 {
     int16_t *curr  = (int16_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
     int16_t *prev1 = (int16_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
     int16_t *prev2 = (int16_t*) ((char*) (blackboxHistory[2]) + arrOffsetInHistory);
 
+    if (blackboxAdaptivePredictors) {
+        // The average predictor is where the group starts, it may have switched to another one since
+        int16_t *prev3 = (int16_t*) ((char*) (blackboxHistory[3]) + arrOffsetInHistory);
+        for (int i = 0; i < count; i++) {
+            writeInterframeField(blackboxPredictorResidual(&blackboxPredictorSelectors[group], curr[i], prev1[i], prev2[i], prev3[i]));
+        }
+        return;
+    }
+
     for (int i = 0; i < count; i++) {
         // Predictor is the average of the previous two history states
         int32_t predictor = (prev1[i] + prev2[i]) / 2;
 
-        blackboxWriteSignedVB(curr[i] - predictor);
+        writeInterframeField(curr[i] - predictor);
     }
 }
 
@@ -683,7 +846,13 @@ static void writeInterframe(void)
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
 
+#ifdef USE_BLACKBOX_BLOCK
+    if (!blackboxBlockFrames) {
+        blackboxWrite('P');
+    }
+#else
     blackboxWrite('P');
+#endif
 
     //No need to store iteration count since its delta is always 1
 
@@ -691,21 +860,21 @@ static void writeInterframe(void)
      * Since the difference between the difference between successive times will be nearly zero (due to consistent
      * looptime spacing), use second-order differences.
      */
-    blackboxWriteSignedVB((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
+    writeInterframeField((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
 
     int32_t deltas[8];
     int32_t setpointDeltas[4];
 
     if (testBlackboxCondition(CONDITION(PID))) {
         arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
-        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+        writeInterframeFields(deltas, XYZ_AXIS_COUNT, ENCODING(SIGNED_VB));
 
         /*
          * The PID I field changes very slowly, most of the time +-2, so use an encoding
          * that can pack all three fields into one byte in that situation.
          */
         arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
-        blackboxWriteTag2_3S32(deltas);
+        writeInterframeFields(deltas, XYZ_AXIS_COUNT, ENCODING(TAG2_3S32));
 
         /*
          * The PID D term is frequently set to zero for yaw, which makes the result from the calculation
@@ -713,12 +882,12 @@ static void writeInterframe(void)
          */
         for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
             if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-                blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+                writeInterframeField(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
             }
         }
 
         arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
-        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+        writeInterframeFields(deltas, XYZ_AXIS_COUNT, ENCODING(SIGNED_VB));
     }
 
     /*
@@ -727,14 +896,19 @@ static void writeInterframe(void)
      */
     for (int x = 0; x < 4; x++) {
         deltas[x] = blackboxCurrent->rcCommand[x] - blackboxLast->rcCommand[x];
-        setpointDeltas[x] = blackboxCurrent->setpoint[x] - blackboxLast->setpoint[x];
+        if (blackboxAdaptivePredictors) {
+            setpointDeltas[x] = blackboxPredictorResidual(&blackboxPredictorSelectors[BLACKBOX_PREDICTOR_GROUP_SETPOINT], blackboxCurrent->setpoint[x],
+                blackboxLast->setpoint[x], blackboxHistory[2]->setpoint[x], blackboxHistory[3]->setpoint[x]);
+        } else {
+            setpointDeltas[x] = blackboxCurrent->setpoint[x] - blackboxLast->setpoint[x];
+        }
     }
 
     if (testBlackboxCondition(CONDITION(RC_COMMANDS))) {
-        blackboxWriteTag8_4S16(deltas);
+        writeInterframeFields(deltas, 4, ENCODING(TAG8_4S16));
     }
     if (testBlackboxCondition(CONDITION(SETPOINT))) {
-        blackboxWriteTag8_4S16(setpointDeltas);
+        writeInterframeFields(setpointDeltas, 4, ENCODING(TAG8_4S16));
     }
 
     //Check for sensors that are updated periodically (so deltas are normally zero)
@@ -772,31 +946,38 @@ static void writeInterframe(void)
         deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
     }
 
-    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+    writeInterframeFields(deltas, optionalFieldCount, ENCODING(TAG8_8SVB));
 
     //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
     if (testBlackboxCondition(CONDITION(GYRO))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT, BLACKBOX_PREDICTOR_GROUP_GYRO);
     }
     if (testBlackboxCondition(CONDITION(ACC))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT, BLACKBOX_PREDICTOR_GROUP_ACC);
     }
     if (testBlackboxCondition(CONDITION(DEBUG_LOG))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT, BLACKBOX_PREDICTOR_GROUP_DEBUG);
     }
 
     if (isFieldEnabled(FIELD_SELECT(MOTOR))) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount(), BLACKBOX_PREDICTOR_GROUP_MOTOR);
 
         if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
-            blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
+            writeInterframeField(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
         }
     }
 
+#ifdef USE_BLACKBOX_BLOCK
+    if (blackboxBlockFrames) {
+        blackboxBlockEndFrame();
+    }
+#endif
+
     //Rotate our history buffers
+    blackboxHistory[3] = blackboxHistory[2];
     blackboxHistory[2] = blackboxHistory[1];
     blackboxHistory[1] = blackboxHistory[0];
-    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 3) + blackboxHistoryRing;
+    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 4) + blackboxHistoryRing;
 
     blackboxLoggedAnyFrames = true;
 }
@@ -807,6 +988,8 @@ static void writeSlowFrame(void)
 {
     int32_t values[3];
 
+    flushInterframeBlock();
+
     blackboxWrite('S');
 
     blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
@@ -823,6 +1006,46 @@ static void writeSlowFrame(void)
     blackboxSlowFrameIterationTimer = 0;
 }
 
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+/* Write the captured gyro samples queued since the last call as "R" frames, each one the difference from the
+ * frame before it. The tag8_8SVB fields are written in groups of up to 8, as decoders read them. */
+static void writeGyroCaptureFrames(void)
+{
+    blackboxGyroCaptureSample_t sample;
+    int32_t values[BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS + BLACKBOX_GYRO_CAPTURE_MAX_ERPM];
+    const int valueCount = BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS + blackboxGyroCaptureErpmCount;
+
+    flushInterframeBlock();
+
+    while (blackboxGyroCaptureRead(&sample)) {
+        blackboxWrite('R');
+        blackboxWriteUnsignedVB(sample.timeUs - blackboxGyroCaptureLast.timeUs);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            values[axis] = sample.gyroUnfilt[axis] - blackboxGyroCaptureLast.gyroUnfilt[axis];
+            values[XYZ_AXIS_COUNT + axis] = sample.gyroADC[axis] - blackboxGyroCaptureLast.gyroADC[axis];
+        }
+        for (int motor = 0; motor < blackboxGyroCaptureErpmCount; motor++) {
+            values[BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS + motor] = sample.erpm[motor] - blackboxGyroCaptureLast.erpm[motor];
+        }
+        for (int i = 0; i < valueCount; i += 8) {
+            blackboxWriteTag8_8SVB(values + i, MIN(valueCount - i, 8));
+        }
+
+        blackboxGyroCaptureLast = sample;
+    }
+}
+
+// A capture starts each time the switch is turned on
+static bool blackboxGyroCaptureRequested(void)
+{
+    const bool switchOn = IS_RC_MODE_ACTIVE(BOXGYROCAPTURE);
+    const bool requested = switchOn && !blackboxGyroCaptureSwitch;
+    blackboxGyroCaptureSwitch = switchOn;
+    return requested && blackboxGyroCaptureEnabled;
+}
+#endif
+
 /**
  * Load rarely-changing values from the FC into the given structure
  */
@@ -876,6 +1099,9 @@ void blackboxValidateConfig(void)
 #endif
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
+#endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
 #endif
     case BLACKBOX_DEVICE_SERIAL:
         // Device supported, leave the setting alone
@@ -895,6 +1121,49 @@ static void blackboxResetIterationTimers(void)
     blackboxSlowFrameIterationTimer = 0;
 }
 
+/**
+ * Settle everything the header describes. A log's header is written from this state, and so is the header image.
+ */
+static void blackboxLoadHeaderState(void)
+{
+    /*
+     * We use conditional tests to decide whether or not certain fields should be logged. Since our headers
+     * must always agree with the logged data, the results of these tests must not change during logging. So
+     * cache those now.
+     */
+    blackboxBuildConditionCache();
+
+#ifdef USE_BLACKBOX_BLOCK
+    blackboxBlockFrames = MIN(blackboxConfig()->block_frames, BLACKBOX_BLOCK_MAX_FRAMES);
+#endif
+
+    blackboxAdaptivePredictors = blackboxConfig()->adaptive_predictors;
+#ifdef USE_BLACKBOX_BLOCK
+    // Blocks pack each field at the width of its widest residual, which the per residual costs don't model, so
+    // block coded logs keep the fixed predictors
+    blackboxAdaptivePredictors = blackboxAdaptivePredictors && !blackboxBlockFrames;
+#endif
+
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    blackboxGyroCaptureEnabled = isModeActivationConditionPresent(BOXGYROCAPTURE);
+    blackboxGyroCaptureErpmCount = 0;
+#ifdef USE_DSHOT_TELEMETRY
+    if (blackboxConfig()->gyro_capture_erpm && motorConfig()->dev.useDshotTelemetry) {
+        blackboxGyroCaptureErpmCount = MIN(getMotorCount(), BLACKBOX_GYRO_CAPTURE_MAX_ERPM);
+    }
+#endif
+#endif
+
+    bool olderDecodersFail = blackboxAdaptivePredictors;
+#ifdef USE_BLACKBOX_BLOCK
+    olderDecodersFail = olderDecodersFail || blackboxBlockFrames;
+#endif
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    olderDecodersFail = olderDecodersFail || blackboxGyroCaptureEnabled;
+#endif
+    blackboxHeader = olderDecodersFail ? blackboxHeaderV3 : blackboxHeaderV2;
+}
+
 /**
  * Start Blackbox logging if it is not already running. Intended to be called upon arming.
  */
@@ -912,20 +1181,40 @@ static void blackboxStart(void)
     blackboxHistory[0] = &blackboxHistoryRing[0];
     blackboxHistory[1] = &blackboxHistoryRing[1];
     blackboxHistory[2] = &blackboxHistoryRing[2];
+    blackboxHistory[3] = &blackboxHistoryRing[3];
 
     vbatReference = getBatteryVoltageLatest();
 
     //No need to clear the content of blackboxHistoryRing since our first frame will be an intra which overwrites it
 
-    /*
-     * We use conditional tests to decide whether or not certain fields should be logged. Since our headers
-     * must always agree with the logged data, the results of these tests must not change during logging. So
-     * cache those now.
-     */
-    blackboxBuildConditionCache();
+    blackboxLoadHeaderState();
+
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+    blackboxHeaderImageValid = blackboxHeaderImageStep == HEADER_IMAGE_READY
+        && blackboxHeaderImageConditions == blackboxConditionCache
+        && blackboxHeaderImageConfigChangeCount == getConfigChangeCount();
+    if (blackboxHeaderImageStep < HEADER_IMAGE_READY) {
+        // The log's header states take over xmitState, so an unfinished image starts again once disarmed
+        blackboxHeaderImageStep = HEADER_IMAGE_HEADER;
+    }
+#endif
+
+#ifdef USE_BLACKBOX_BLOCK
+    blackboxBlockInit(blackboxBlockFrames, blackboxConfig()->block_huffman);
+#endif
+
+    blackboxPredictorSelectorInit(&blackboxPredictorSelectors[BLACKBOX_PREDICTOR_GROUP_SETPOINT], PREDICT(PREVIOUS), ENCODING(TAG8_4S16));
+    for (int group = BLACKBOX_PREDICTOR_GROUP_GYRO; group < BLACKBOX_PREDICTOR_GROUP_COUNT; group++) {
+        blackboxPredictorSelectorInit(&blackboxPredictorSelectors[group], PREDICT(AVERAGE_2), ENCODING(SIGNED_VB));
+    }
 
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
 
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    blackboxGyroCaptureSwitch = false;
+    memset(&blackboxGyroCaptureLast, 0, sizeof(blackboxGyroCaptureLast));
+#endif
+
     blackboxResetIterationTimers();
 
     /*
@@ -951,6 +1240,7 @@ void blackboxFinish(void)
         break;
     case BLACKBOX_STATE_RUNNING:
     case BLACKBOX_STATE_PAUSED:
+    case BLACKBOX_STATE_GYRO_CAPTURE:
         blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, NULL);
         FALLTHROUGH;
     default:
@@ -1010,6 +1300,8 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
+    flushInterframeBlock();
+
     blackboxWrite('H');
 
     blackboxWriteSignedVB(GPS_home[0]);
@@ -1022,6 +1314,8 @@ static void writeGPSHomeFrame(void)
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
+    flushInterframeBlock();
+
     blackboxWrite('G');
 
     /*
@@ -1259,6 +1553,9 @@ STATIC_UNIT_TESTED char *blackboxGetStartDateTime(char *buf)
 /**
  * Transmit a portion of the system information headers. Call the first time with xmitState.headerIndex == 0. Returns
  * true iff transmission is complete, otherwise call again later to continue transmission.
+ *
+ * These lines only depend on the configuration, so they can be part of the header image. The ones which describe the
+ * moment the log was started are in blackboxWriteRuntimeSysinfo().
  */
 static bool blackboxWriteSysinfo(void)
 {
@@ -1271,8 +1568,6 @@ static bool blackboxWriteSysinfo(void)
         return false;
     }
 
-    char buf[FORMATTED_DATE_TIME_BUFSIZE];
-
 #ifdef USE_RC_SMOOTHING_FILTER
     rcSmoothingFilter_t *rcSmoothingData = getRcSmoothingData();
 #endif
@@ -1285,11 +1580,19 @@ static bool blackboxWriteSysinfo(void)
 #ifdef USE_BOARD_INFO
         BLACKBOX_PRINT_HEADER_LINE("Board information", "%s %s",            getManufacturerId(), getBoardName());
 #endif
-        BLACKBOX_PRINT_HEADER_LINE("Log start datetime", "%s",              blackboxGetStartDateTime(buf));
         BLACKBOX_PRINT_HEADER_LINE("Craft name", "%s",                      pilotConfig()->name);
         BLACKBOX_PRINT_HEADER_LINE("I interval", "%d",                      blackboxIInterval);
         BLACKBOX_PRINT_HEADER_LINE("P interval", "%d",                      blackboxPInterval);
         BLACKBOX_PRINT_HEADER_LINE("P ratio", "%d",                         (uint16_t)(blackboxIInterval / blackboxPInterval));
+#ifdef USE_BLACKBOX_BLOCK
+        BLACKBOX_PRINT_HEADER_LINE("P block frames", "%d",                  blackboxBlockFrames);
+#endif
+        BLACKBOX_PRINT_HEADER_LINE_CUSTOM(
+            if (blackboxAdaptivePredictors) {
+                blackboxPrintfHeaderLine("P adaptive predictors", "%d,%d,%d,%d", PREDICT(PREVIOUS), PREDICT(AVERAGE_2),
+                    PREDICT(STRAIGHT_LINE), PREDICT(SECOND_ORDER));
+            }
+            );
         BLACKBOX_PRINT_HEADER_LINE("minthrottle", "%d",                     motorConfig()->minthrottle);
         BLACKBOX_PRINT_HEADER_LINE("maxthrottle", "%d",                     motorConfig()->maxthrottle);
         BLACKBOX_PRINT_HEADER_LINE("gyro_scale","0x%x",                     castFloatBytesToInt(1.0f));
@@ -1302,14 +1605,13 @@ static bool blackboxWriteSysinfo(void)
             if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
                 blackboxPrintfHeaderLine("vbat_scale", "%u", voltageSensorADCConfig(VOLTAGE_SENSOR_ADC_VBAT)->vbatscale);
             } else {
-                xmitState.headerIndex += 2; // Skip the next two vbat fields too
+                xmitState.headerIndex += 1; // Skip the next vbat field too
             }
             );
 
         BLACKBOX_PRINT_HEADER_LINE("vbatcellvoltage", "%u,%u,%u",           batteryConfig()->vbatmincellvoltage,
                                                                             batteryConfig()->vbatwarningcellvoltage,
                                                                             batteryConfig()->vbatmaxcellvoltage);
-        BLACKBOX_PRINT_HEADER_LINE("vbatref", "%u",                         vbatReference);
 
         BLACKBOX_PRINT_HEADER_LINE_CUSTOM(
             if (batteryConfig()->currentMeterSource == CURRENT_METER_ADC) {
@@ -1466,10 +1768,6 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_RC_SMOOTHING_SETPOINT_CUTOFF, "%d",    rcSmoothingData->setpointCutoffSetting);
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_RC_SMOOTHING_THROTTLE_CUTOFF, "%d",    rcSmoothingData->throttleCutoffSetting);
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_RC_SMOOTHING_DEBUG_AXIS, "%d",         rcSmoothingData->debugAxis);
-        BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_RC_SMOOTHING_ACTIVE_CUTOFFS, "%d,%d,%d", rcSmoothingData->feedforwardCutoffFrequency,
-                                                                            rcSmoothingData->setpointCutoffFrequency,
-                                                                            rcSmoothingData->throttleCutoffFrequency);
-        BLACKBOX_PRINT_HEADER_LINE("rc_smoothing_rx_average", "%d",         rcSmoothingData->averageFrameTimeUs);
 #endif // USE_RC_SMOOTHING_FILTER
         BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_RATES_TYPE, "%d",             currentControlRateProfile->rates_type);
 
@@ -1514,9 +1812,149 @@ static bool blackboxWriteSysinfo(void)
     }
 
     xmitState.headerIndex++;
+    return false;
+#else
+    return true;
 #endif // UNIT_TEST
+}
+
+#ifndef UNIT_TEST
+// The case labels below carry on counting from the ones above, so number the lines relative to this
+enum { BLACKBOX_RUNTIME_SYSINFO_FIRST = __COUNTER__ + 1 };
+#endif
+
+/**
+ * Transmit a portion of the system information headers that describe the state at the start of the log, like
+ * blackboxWriteSysinfo(). These are never part of the header image.
+ */
+static bool blackboxWriteRuntimeSysinfo(void)
+{
+#ifndef UNIT_TEST
+    if (blackboxDeviceReserveBufferSpace(64) != BLACKBOX_RESERVE_SUCCESS) {
+        return false;
+    }
+
+    char buf[FORMATTED_DATE_TIME_BUFSIZE];
+
+#ifdef USE_RC_SMOOTHING_FILTER
+    rcSmoothingFilter_t *rcSmoothingData = getRcSmoothingData();
+#endif
+
+    switch (BLACKBOX_RUNTIME_SYSINFO_FIRST + xmitState.headerIndex) {
+        BLACKBOX_PRINT_HEADER_LINE("Log start datetime", "%s",              blackboxGetStartDateTime(buf));
+
+        BLACKBOX_PRINT_HEADER_LINE_CUSTOM(
+            if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+                blackboxPrintfHeaderLine("vbatref", "%u", vbatReference);
+            }
+            );
+
+#ifdef USE_RC_SMOOTHING_FILTER
+        BLACKBOX_PRINT_HEADER_LINE(PARAM_NAME_RC_SMOOTHING_ACTIVE_CUTOFFS, "%d,%d,%d", rcSmoothingData->feedforwardCutoffFrequency,
+                                                                            rcSmoothingData->setpointCutoffFrequency,
+                                                                            rcSmoothingData->throttleCutoffFrequency);
+        BLACKBOX_PRINT_HEADER_LINE("rc_smoothing_rx_average", "%d",         rcSmoothingData->averageFrameTimeUs);
+#endif // USE_RC_SMOOTHING_FILTER
+
+        default:
+            return true;
+    }
+
+    xmitState.headerIndex++;
     return false;
+#else
+    return true;
+#endif // UNIT_TEST
+}
+
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+/*
+ * Render the next line of what blackboxWriteSysinfo() and the header states before it would send into the header
+ * image. Returns true once the current step has rendered all of its lines.
+ */
+static bool blackboxRenderHeaderImageLine(void)
+{
+    switch (blackboxHeaderImageStep) {
+    case HEADER_IMAGE_HEADER:
+        blackboxLoadHeaderState();
+        blackboxHeaderImageConditions = blackboxConditionCache;
+        blackboxWriteString(blackboxHeader);
+        return true;
+    case HEADER_IMAGE_MAIN_FIELDS:
+        return !sendFieldDefinition('I', 'P', blackboxMainFields, blackboxMainFields + 1, ARRAYLEN(blackboxMainFields),
+            &blackboxMainFields[0].condition, &blackboxMainFields[1].condition);
+#ifdef USE_GPS
+    case HEADER_IMAGE_GPS_H_FIELDS:
+        if (featureIsEnabled(FEATURE_GPS) && isFieldEnabled(FIELD_SELECT(GPS))) {
+            return !sendFieldDefinition('H', 0, blackboxGpsHFields, blackboxGpsHFields + 1, ARRAYLEN(blackboxGpsHFields),
+                NULL, NULL);
+        }
+        return true;
+    case HEADER_IMAGE_GPS_G_FIELDS:
+        if (featureIsEnabled(FEATURE_GPS) && isFieldEnabled(FIELD_SELECT(GPS))) {
+            return !sendFieldDefinition('G', 0, blackboxGpsGFields, blackboxGpsGFields + 1, ARRAYLEN(blackboxGpsGFields),
+                &blackboxGpsGFields[0].condition, &blackboxGpsGFields[1].condition);
+        }
+        return true;
+#endif
+    case HEADER_IMAGE_SLOW_FIELDS:
+        return !sendFieldDefinition('S', 0, blackboxSlowFields, blackboxSlowFields + 1, ARRAYLEN(blackboxSlowFields),
+            NULL, NULL);
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    case HEADER_IMAGE_GYRO_CAPTURE_FIELDS:
+        if (blackboxGyroCaptureEnabled) {
+            return !sendFieldDefinition('R', 0, blackboxGyroCaptureFields, blackboxGyroCaptureFields + 1,
+                1 + BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS + blackboxGyroCaptureErpmCount, NULL, NULL);
+        }
+        return true;
+#endif
+    case HEADER_IMAGE_SYSINFO:
+        return blackboxWriteSysinfo();
+    default:
+        return true;
+    }
+}
+
+/*
+ * Called while disarmed. Renders one line of the header image per call, starting again whenever the configuration
+ * has changed since the image was started, so that it is ready by the time the craft is armed.
+ */
+static void blackboxUpdateHeaderImage(void)
+{
+    if (blackboxHeaderImageConfigChangeCount != getConfigChangeCount()) {
+        blackboxHeaderImageConfigChangeCount = getConfigChangeCount();
+        blackboxHeaderImageStep = HEADER_IMAGE_HEADER;
+    }
+
+    // A header which didn't fit is not tried again until the configuration changes
+    if (blackboxHeaderImageStep >= HEADER_IMAGE_READY) {
+        return;
+    }
+
+    if (blackboxHeaderImageStep == HEADER_IMAGE_HEADER) {
+        blackboxHeaderImageLength = 0;
+        xmitState.headerIndex = 0;
+        xmitState.u.fieldIndex = -1;
+    }
+
+    blackboxImageBegin(blackboxHeaderImage + blackboxHeaderImageLength, sizeof(blackboxHeaderImage) - blackboxHeaderImageLength);
+    const bool stepDone = blackboxRenderHeaderImageLine();
+    const int32_t length = blackboxImageEnd();
+    blackboxHeaderBudget = 0;
+
+    if (length < 0) {
+        blackboxHeaderImageStep = HEADER_IMAGE_FAILED;
+        return;
+    }
+    blackboxHeaderImageLength += length;
+
+    if (stepDone) {
+        blackboxHeaderImageStep++;
+        xmitState.headerIndex = 0;
+        xmitState.u.fieldIndex = -1;
+    }
 }
+#endif
 
 /**
  * Write the given event to the log immediately
@@ -1524,10 +1962,12 @@ static bool blackboxWriteSysinfo(void)
 void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
 {
     // Only allow events to be logged after headers have been written
-    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
+    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED || blackboxState == BLACKBOX_STATE_GYRO_CAPTURE)) {
         return;
     }
 
+    flushInterframeBlock();
+
     //Shared header for event frames
     blackboxWrite('E');
     blackboxWrite(event);
@@ -1557,6 +1997,12 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
         blackboxWriteUnsignedVB(data->loggingResume.logIteration);
         blackboxWriteUnsignedVB(data->loggingResume.currentTime);
         break;
+    case FLIGHT_LOG_EVENT_PREDICTORS:
+        blackboxWrite(BLACKBOX_PREDICTOR_GROUP_COUNT);
+        for (int group = 0; group < BLACKBOX_PREDICTOR_GROUP_COUNT; group++) {
+            blackboxWrite(data->predictors.predictor[group]);
+        }
+        break;
     case FLIGHT_LOG_EVENT_LOG_END:
         blackboxWriteString("End of log");
         blackboxWrite(0);
@@ -1566,6 +2012,17 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
     }
 }
 
+/* Switch each adaptive field group to the predictor that did best over the last I-frame interval, and log the
+ * choice so that the P-frames up to the next I-frame can be decoded */
+static void blackboxLogPredictors(void)
+{
+    flightLogEvent_predictors_t eventData;
+    for (int group = 0; group < BLACKBOX_PREDICTOR_GROUP_COUNT; group++) {
+        eventData.predictor[group] = blackboxPredictorSelect(&blackboxPredictorSelectors[group]);
+    }
+    blackboxLogEvent(FLIGHT_LOG_EVENT_PREDICTORS, (flightLogEventData_t *)&eventData);
+}
+
 /* If an arming beep has played since it was last logged, write the time of the arming beep to the log as a synchronization point */
 static void blackboxCheckAndLogArmingBeep(void)
 {
@@ -1649,6 +2106,10 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 
         loadMainState(currentTimeUs);
         writeIntraframe();
+
+        if (blackboxAdaptivePredictors) {
+            blackboxLogPredictors();
+        }
     } else {
         blackboxCheckAndLogArmingBeep();
         blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
@@ -1695,6 +2156,11 @@ void blackboxUpdate(timeUs_t currentTimeUs)
             blackboxOpen();
             blackboxStart();
         }
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+        else {
+            blackboxUpdateHeaderImage();
+        }
+#endif
 #ifdef USE_FLASHFS
         if (IS_RC_MODE_ACTIVE(BOXBLACKBOXERASE)) {
             blackboxSetState(BLACKBOX_STATE_START_ERASE);
@@ -1703,6 +2169,12 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         break;
     case BLACKBOX_STATE_PREPARE_LOG_FILE:
         if (blackboxDeviceBeginLog()) {
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+            if (blackboxHeaderImageValid) {
+                blackboxSetState(BLACKBOX_STATE_SEND_HEADER_IMAGE);
+                break;
+            }
+#endif
             blackboxSetState(BLACKBOX_STATE_SEND_HEADER);
         }
         break;
@@ -1726,6 +2198,21 @@ void blackboxUpdate(timeUs_t currentTimeUs)
             }
         }
         break;
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+    case BLACKBOX_STATE_SEND_HEADER_IMAGE:
+        blackboxReplenishHeaderBudget();
+        //On entry of this state, xmitState.headerIndex is 0 and startTime is intialised
+
+        // Only the UART needs time to init, the storage devices take the image as fast as they can buffer it
+        if (blackboxConfig()->device != BLACKBOX_DEVICE_SERIAL || millis() > xmitState.u.startTime + 100) {
+            xmitState.headerIndex += blackboxDeviceWriteHeader(blackboxHeaderImage + xmitState.headerIndex,
+                blackboxHeaderImageLength - xmitState.headerIndex);
+            if (xmitState.headerIndex == (uint32_t)blackboxHeaderImageLength) {
+                blackboxSetState(BLACKBOX_STATE_SEND_RUNTIME_SYSINFO);
+            }
+        }
+        break;
+#endif
     case BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER:
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
@@ -1762,16 +2249,41 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
         if (!sendFieldDefinition('S', 0, blackboxSlowFields, blackboxSlowFields + 1, ARRAYLEN(blackboxSlowFields),
                 NULL, NULL)) {
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+            if (blackboxGyroCaptureEnabled) {
+                blackboxSetState(BLACKBOX_STATE_SEND_GYRO_CAPTURE_HEADER);
+                break;
+            }
+#endif
             cacheFlushNextState = BLACKBOX_STATE_SEND_SYSINFO;
             blackboxSetState(BLACKBOX_STATE_CACHE_FLUSH);
         }
         break;
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    case BLACKBOX_STATE_SEND_GYRO_CAPTURE_HEADER:
+        blackboxReplenishHeaderBudget();
+        //On entry of this state, xmitState.headerIndex is 0 and xmitState.u.fieldIndex is -1
+        if (!sendFieldDefinition('R', 0, blackboxGyroCaptureFields, blackboxGyroCaptureFields + 1,
+                1 + BLACKBOX_GYRO_CAPTURE_GYRO_FIELDS + blackboxGyroCaptureErpmCount, NULL, NULL)) {
+            cacheFlushNextState = BLACKBOX_STATE_SEND_SYSINFO;
+            blackboxSetState(BLACKBOX_STATE_CACHE_FLUSH);
+        }
+        break;
+#endif
     case BLACKBOX_STATE_SEND_SYSINFO:
         blackboxReplenishHeaderBudget();
         //On entry of this state, xmitState.headerIndex is 0
 
         //Keep writing chunks of the system info headers until it returns true to signal completion
         if (blackboxWriteSysinfo()) {
+            blackboxSetState(BLACKBOX_STATE_SEND_RUNTIME_SYSINFO);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_RUNTIME_SYSINFO:
+        blackboxReplenishHeaderBudget();
+        //On entry of this state, xmitState.headerIndex is 0
+
+        if (blackboxWriteRuntimeSysinfo()) {
             /*
              * Wait for header buffers to drain completely before data logging begins to ensure reliable header delivery
              * (overflowing circular buffers causes all data to be discarded, so the first few logged iterations
@@ -1809,11 +2321,40 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
         if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
             blackboxSetState(BLACKBOX_STATE_PAUSED);
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+        } else if (blackboxGyroCaptureRequested()) {
+            // Main frames stop for the capture, the gyro task feeds it from the next sample on
+            blackboxSetState(BLACKBOX_STATE_GYRO_CAPTURE);
+#endif
         } else {
             blackboxLogIteration(currentTimeUs);
         }
         blackboxAdvanceIterationTimers();
         break;
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    case BLACKBOX_STATE_GYRO_CAPTURE:
+        // Turning the switch off ends the capture early
+        blackboxGyroCaptureSwitch = IS_RC_MODE_ACTIVE(BOXGYROCAPTURE);
+        if (!blackboxGyroCaptureSwitch) {
+            blackboxGyroCaptureStop();
+        }
+        writeGyroCaptureFrames();
+
+        // Once the capture is over, resume main frames with an I-frame, like after a pause
+        if (!blackboxGyroCaptureIsActive() && blackboxShouldLogIFrame()) {
+            flightLogEvent_loggingResume_t resume;
+
+            resume.logIteration = blackboxIteration;
+            resume.currentTime = currentTimeUs;
+
+            blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+            blackboxSetState(BLACKBOX_STATE_RUNNING);
+
+            blackboxLogIteration(currentTimeUs);
+        }
+        blackboxAdvanceIterationTimers();
+        break;
+#endif
     case BLACKBOX_STATE_SHUTTING_DOWN:
         //On entry of this state, startTime is set
         /*
@@ -1850,6 +2391,9 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         break;
     }
 
+    // Header chunks and events are staged like frames, hand them to the device now
+    blackboxDeviceCommit();
+
     // Did we run out of room on the device? Stop!
     if (isBlackboxDeviceFull()) {
 #ifdef USE_FLASHFS
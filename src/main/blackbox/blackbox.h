@@ -29,7 +29,8 @@ typedef enum BlackboxDevice {
     BLACKBOX_DEVICE_NONE = 0,
     BLACKBOX_DEVICE_FLASH = 1,
     BLACKBOX_DEVICE_SDCARD = 2,
-    BLACKBOX_DEVICE_SERIAL = 3
+    BLACKBOX_DEVICE_SERIAL = 3,
+    BLACKBOX_DEVICE_FILE = 4
 } BlackboxDevice_e;
 
 typedef enum BlackboxMode {
@@ -54,6 +55,7 @@ typedef enum FlightLogEvent {
     FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
     FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
     FLIGHT_LOG_EVENT_DISARM = 15,
+    FLIGHT_LOG_EVENT_PREDICTORS = 16,
     FLIGHT_LOG_EVENT_FLIGHTMODE = 30, // Add new event type for flight mode status.
     FLIGHT_LOG_EVENT_LOG_END = 255
 } FlightLogEvent;
@@ -63,6 +65,11 @@ typedef struct blackboxConfig_s {
     uint8_t device;
     uint32_t fields_disabled_mask;
     uint8_t mode;
+    uint8_t block_frames;           // P-frames per 'B' frame, 0 to write P-frames individually
+    uint8_t block_huffman;          // Huffman code block fields where that makes them smaller
+    uint8_t adaptive_predictors;    // pick the P-frame predictor of each field group at every I-frame
+    uint16_t gyro_capture_ms;       // length of a full rate gyro capture started by the GYRO CAPTURE switch
+    uint8_t gyro_capture_erpm;      // capture the DShot telemetry eRPM along with the gyro
 } blackboxConfig_t;
 
 PG_DECLARE(blackboxConfig_t, blackboxConfig);
@@ -0,0 +1,187 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_BLOCK
+
+#include "blackbox/blackbox_block.h"
+#include "blackbox/blackbox_encoding.h"
+#include "blackbox/blackbox_io.h"
+
+#include "common/huffman.h"
+#include "common/maths.h"
+
+#define BLACKBOX_BLOCK_MAX_PAYLOAD (BLACKBOX_BLOCK_MAX_FRAMES * sizeof(uint32_t))
+
+typedef struct blackboxBlock_s {
+    uint32_t values[BLACKBOX_BLOCK_MAX_FIELDS][BLACKBOX_BLOCK_MAX_FRAMES]; // zig-zag encoded residuals
+    uint32_t fieldBits[BLACKBOX_BLOCK_MAX_FIELDS];  // all residuals of a field OR'ed, gives the field width
+    uint8_t frameLimit;
+    uint8_t frameCount;
+    uint8_t fieldCount;
+    uint8_t fieldIndex;
+    bool huffman;
+    bool dropping;                                  // a block was dropped, drop the rest until the next I-frame
+} blackboxBlock_t;
+
+static blackboxBlock_t block;
+
+void blackboxBlockInit(uint8_t frameCount, bool huffman)
+{
+    block.frameLimit = MIN(frameCount, BLACKBOX_BLOCK_MAX_FRAMES);
+    block.frameCount = 0;
+    block.fieldCount = 0;
+    block.fieldIndex = 0;
+    block.huffman = huffman;
+    block.dropping = false;
+    for (int i = 0; i < BLACKBOX_BLOCK_MAX_FIELDS; i++) {
+        block.fieldBits[i] = 0;
+    }
+}
+
+void blackboxBlockAddFields(const int32_t *values, int count)
+{
+    for (int i = 0; i < count; i++) {
+        const uint32_t value = ((uint32_t)values[i] << 1) ^ (uint32_t)(values[i] >> 31);
+        block.values[block.fieldIndex][block.frameCount] = value;
+        block.fieldBits[block.fieldIndex] |= value;
+        block.fieldIndex++;
+    }
+}
+
+static int fieldWidth(int field)
+{
+    const uint32_t bits = block.fieldBits[field];
+    return bits ? 32 - __builtin_clz(bits) : 0;
+}
+
+// Length of the block with frameCount frames at the current field widths. Huffman coding is only used where it is
+// shorter, so this is the most that will be written.
+static int blockLength(int frameCount)
+{
+    int length = 1 + (frameCount < 128 ? 1 : 2);
+    for (int field = 0; field < block.fieldCount; field++) {
+        length += 1 + (frameCount * fieldWidth(field) + 7) / 8;
+    }
+    return length;
+}
+
+void blackboxBlockEndFrame(void)
+{
+    block.fieldCount = block.fieldIndex;
+    block.fieldIndex = 0;
+    block.frameCount++;
+
+    // Flush early if the device couldn't take the block with another frame in it
+    if (block.frameCount >= block.frameLimit || blockLength(block.frameCount + 1) > blackboxDeviceBytesFree()) {
+        blackboxBlockFlush();
+    }
+}
+
+static int packField(uint8_t *packed, const uint32_t *values, int count, int width)
+{
+    uint64_t bits = 0;
+    int bitCount = 0;
+    int length = 0;
+
+    for (int i = 0; i < count; i++) {
+        bits |= (uint64_t)values[i] << bitCount;
+        bitCount += width;
+        while (bitCount >= 8) {
+            packed[length++] = bits;
+            bits >>= 8;
+            bitCount -= 8;
+        }
+    }
+    if (bitCount > 0) {
+        packed[length++] = bits;
+    }
+
+    return length;
+}
+
+static void writeBytes(const uint8_t *data, int length)
+{
+    for (int i = 0; i < length; i++) {
+        blackboxWrite(data[i]);
+    }
+}
+
+/*
+ * Write the frames gathered so far as a 'B' frame. Called when the block is full, and before any other
+ * frame is written so that frames stay in order in the log.
+ */
+void blackboxBlockFlush(void)
+{
+    if (block.frameCount == 0) {
+        return;
+    }
+
+    // A device drops what it can't take, and a clipped block would garble the frames after it
+    if (block.dropping || blockLength(block.frameCount) > blackboxDeviceBytesFree()) {
+        block.dropping = true;
+        for (int field = 0; field < block.fieldCount; field++) {
+            block.fieldBits[field] = 0;
+        }
+        block.frameCount = 0;
+        return;
+    }
+
+    blackboxWrite('B');
+    blackboxWriteUnsignedVB(block.frameCount);
+
+    for (int field = 0; field < block.fieldCount; field++) {
+        const int width = fieldWidth(field);
+        block.fieldBits[field] = 0;
+
+        uint8_t packed[BLACKBOX_BLOCK_MAX_PAYLOAD];
+        const int length = packField(packed, block.values[field], block.frameCount, width);
+
+#ifdef USE_HUFFMAN
+        if (block.huffman && length > 1) {
+            // the longest code is 12 bits, and the encoder zeroes the byte after the last one it fills
+            uint8_t coded[BLACKBOX_BLOCK_MAX_PAYLOAD * 3 / 2 + 2];
+            const int codedLength = huffmanEncodeBuf(coded, length, packed, length, huffmanTable);
+            if (codedLength > 0 && codedLength < length) {
+                blackboxWrite(width | BLACKBOX_BLOCK_HUFFMAN);
+                writeBytes(coded, codedLength);
+                continue;
+            }
+        }
+#endif
+
+        blackboxWrite(width);
+        writeBytes(packed, length);
+    }
+
+    block.frameCount = 0;
+}
+
+// The next frame is an I-frame, which the frames after it are predicted from, so blocks can be written again
+void blackboxBlockResync(void)
+{
+    block.dropping = false;
+}
+
+#endif // USE_BLACKBOX_BLOCK
@@ -0,0 +1,60 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Block coded P-frames.
+ *
+ * Instead of coding each P-frame on its own, up to blackbox_block_frames consecutive P-frames are gathered
+ * and written together as one 'B' frame. The residuals are the same ones a P-frame would carry (same
+ * predictors, same field order), but each field is bit-packed across the block at the width of its largest
+ * zig-zag encoded residual, so quiet fields cost next to nothing:
+ *
+ *   'B' <unsigned VB frame count>
+ *   for each P-frame field:
+ *       <width byte: bits per residual, 0-32, BLACKBOX_BLOCK_HUFFMAN set if the payload is Huffman coded>
+ *       <frame count * width bits, LSB first, padded to a whole byte>
+ *
+ * A Huffman coded payload is the packed payload run through the static table in common/huffman_table.c,
+ * and is only used for a field where that is shorter. The "P block frames" header announces the format.
+ *
+ * A block is written whole or not at all. It is flushed early when another frame might not fit in the device,
+ * and one which still doesn't fit is dropped along with every block after it until the next I-frame.
+ */
+
+// The residuals of a block take BLACKBOX_BLOCK_MAX_FIELDS * BLACKBOX_BLOCK_MAX_FRAMES * 4 bytes of RAM
+#if defined(STM32F7) || defined(STM32H7) || defined(SIMULATOR_BUILD)
+#define BLACKBOX_BLOCK_MAX_FRAMES 16
+#else
+#define BLACKBOX_BLOCK_MAX_FRAMES 8
+#endif
+#define BLACKBOX_BLOCK_MAX_FIELDS 64
+
+#define BLACKBOX_BLOCK_HUFFMAN 0x80
+
+void blackboxBlockInit(uint8_t frameCount, bool huffman);
+void blackboxBlockAddFields(const int32_t *values, int count);
+void blackboxBlockEndFrame(void);
+void blackboxBlockFlush(void);
+void blackboxBlockResync(void);
@@ -85,17 +85,43 @@ void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...)
     blackboxHeaderBudget -= written + 3;
 }
 
+/*
+ * The field width selectors below are computed from the magnitude of each value rather than by comparing it against
+ * each width in turn. For a signed value v, magnitude(v) = v ^ (v >> 31) is v for v >= 0 and -v - 1 otherwise, so v
+ * fits in an n bit signed field exactly when magnitude(v) < 2^(n - 1). OR-ing the magnitudes of several values gives
+ * the number of bits needed by the widest of them.
+ */
+static inline uint32_t magnitude(int32_t value)
+{
+    return value ^ (value >> 31);
+}
+
+// Number of significant bits in value, at least 1
+static inline int bitLength(uint32_t value)
+{
+    return 32 - __builtin_clz(value | 1);
+}
+
 /**
  * Write an unsigned integer to the blackbox serial port using variable byte encoding.
  */
 void blackboxWriteUnsignedVB(uint32_t value)
 {
-    //While this isn't the final byte (we can only write 7 bits at a time)
-    while (value > 127) {
-        blackboxWrite((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
-        value >>= 7;
+    if (value < 0x80) {
+        blackboxWrite(value);
+        return;
     }
-    blackboxWrite(value);
+
+    // 7 bits per byte, low bits first, with the high bit set on every byte but the last to mean "more bytes follow"
+    const int byteCount = (bitLength(value) + 6) / 7;
+    const uint64_t spread = (value & 0x7F)
+        | ((value << 1) & 0x7F00)
+        | ((value << 2) & 0x7F0000)
+        | ((value << 3) & 0x7F000000)
+        | ((uint64_t)(value >> 28) << 32);
+    const uint64_t continuation = 0x80808080ULL & ((1ULL << ((byteCount - 1) * 8)) - 1);
+
+    blackboxWriteLE(spread | continuation, byteCount);
 }
 
 /**
@@ -127,13 +153,29 @@ void blackboxWriteS16(int16_t value)
     blackboxWrite((value >> 8) & 0xFF);
 }
 
+/*
+ * Write each of the fields in the low bytes first, using the fewest of 1, 2, 3 or 4 bytes which holds it, after a
+ * byte holding `selector` in its top 2 bits and the 2 bit byte count - 1 of each field, first field in the low bits.
+ */
+static void writeTag2_3S32Bytes(int selector, const int32_t *values)
+{
+    int byteSelectors = 0;
+    for (int x = 2; x >= 0; x--) {
+        byteSelectors = (byteSelectors << 2) | (bitLength(magnitude(values[x])) >> 3);
+    }
+
+    blackboxWrite((selector << 6) | byteSelectors);
+
+    for (int x = 0; x < 3; x++, byteSelectors >>= 2) {
+        blackboxWriteLE((uint32_t)values[x], (byteSelectors & 0x03) + 1);
+    }
+}
+
 /**
  * Write a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
  */
 void blackboxWriteTag2_3S32(int32_t *values)
 {
-    static const int NUM_FIELDS = 3;
-
     //Need to be enums rather than const ints if we want to switch on them (due to being C)
     enum {
         BITS_2  = 0,
@@ -142,15 +184,6 @@ void blackboxWriteTag2_3S32(int32_t *values)
         BITS_32 = 3
     };
 
-    enum {
-        BYTES_1  = 0,
-        BYTES_2  = 1,
-        BYTES_3  = 2,
-        BYTES_4  = 3
-    };
-
-    int selector = BITS_2, selector2;
-
     /*
      * Find out how many bits the largest value requires to encode, and use it to choose one of the packing schemes
      * below:
@@ -162,91 +195,24 @@ void blackboxWriteTag2_3S32(int32_t *values)
      * 6 bits per field  ss11 1111 0022 2222 0033 3333
      * 32 bits per field sstt tttt followed by fields of various byte counts
      */
-    for (int x = 0; x < NUM_FIELDS; x++) {
-        //Require more than 6 bits?
-        if (values[x] >= 32 || values[x] < -32) {
-            selector = BITS_32;
-            break;
-        }
-
-        //Require more than 4 bits?
-        if (values[x] >= 8 || values[x] < -8) {
-             if (selector < BITS_6) {
-                 selector = BITS_6;
-             }
-        } else if (values[x] >= 2 || values[x] < -2) { //Require more than 2 bits?
-            if (selector < BITS_4) {
-                selector = BITS_4;
-            }
-        }
-    }
+    const uint32_t widest = magnitude(values[0]) | magnitude(values[1]) | magnitude(values[2]);
+    const int selector = (widest >= 2) + (widest >= 8) + (widest >= 32);
 
     switch (selector) {
     case BITS_2:
         blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
         break;
     case BITS_4:
-        blackboxWrite((selector << 6) | (values[0] & 0x0F));
-        blackboxWrite((values[1] << 4) | (values[2] & 0x0F));
+        blackboxWriteLE((selector << 6) | (values[0] & 0x0F)
+            | (((values[1] << 4) | (values[2] & 0x0F)) & 0xFF) << 8, 2);
         break;
     case BITS_6:
-        blackboxWrite((selector << 6) | (values[0] & 0x3F));
-        blackboxWrite((uint8_t)values[1]);
-        blackboxWrite((uint8_t)values[2]);
+        blackboxWriteLE((selector << 6) | (values[0] & 0x3F)
+            | (values[1] & 0xFF) << 8
+            | (values[2] & 0xFF) << 16, 3);
         break;
     case BITS_32:
-        /*
-         * Do another round to compute a selector for each field, assuming that they are at least 8 bits each
-         *
-         * Selector2 field possibilities
-         * 0 - 8 bits
-         * 1 - 16 bits
-         * 2 - 24 bits
-         * 3 - 32 bits
-         */
-        selector2 = 0;
-
-        //Encode in reverse order so the first field is in the low bits:
-        for (int x = NUM_FIELDS - 1; x >= 0; x--) {
-            selector2 <<= 2;
-
-            if (values[x] < 128 && values[x] >= -128) {
-                selector2 |= BYTES_1;
-            } else if (values[x] < 32768 && values[x] >= -32768) {
-                selector2 |= BYTES_2;
-            } else if (values[x] < 8388608 && values[x] >= -8388608) {
-                selector2 |= BYTES_3;
-            } else {
-                selector2 |= BYTES_4;
-            }
-        }
-
-        //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
-
-        //And now the values according to the selectors we picked for them
-        for (int x = 0; x < NUM_FIELDS; x++, selector2 >>= 2) {
-            switch (selector2 & 0x03) {
-            case BYTES_1:
-                blackboxWrite(values[x]);
-                break;
-            case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                break;
-            case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                break;
-            case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
-                break;
-            }
-        }
+        writeTag2_3S32Bytes(selector, values);
         break;
     }
 }
@@ -256,7 +222,6 @@ void blackboxWriteTag2_3S32(int32_t *values)
  */
 int blackboxWriteTag2_3SVariable(int32_t *values)
 {
-    static const int FIELD_COUNT = 3;
     enum {
         BITS_2  = 0,
         BITS_554  = 1,
@@ -264,14 +229,6 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
         BITS_32 = 3
     };
 
-    enum {
-        BYTES_1  = 0,
-        BYTES_2  = 1,
-        BYTES_3  = 2,
-        BYTES_4  = 3
-    };
-
-
     /*
      * Find out how many bits the largest value requires to encode, and use it to choose one of the packing schemes
      * below:
@@ -282,25 +239,16 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
      * 554 bits per field  ss11 1112 2222 3333
      * 877 bits per field  ss11 1111 1122 2222 2333 3333
      * 32 bits per field sstt tttt followed by fields of various byte counts
+     *
+     * Each scheme is only chosen when the previous one doesn't fit, and a field which doesn't fit a scheme doesn't fit
+     * the narrower ones either, so the selector is the number of schemes which don't fit.
      */
-    int selector = BITS_2;
-    int selector2 = 0;
-    // Require more than 877 bits?
-    if (values[0] >= 256 || values[0] < -256
-            || values[1] >= 128 || values[1] < -128
-            || values[2] >= 128 || values[2] < -128) {
-        selector = BITS_32;
-   // Require more than 554 bits?
-    } else if (values[0] >= 16 || values[0] < -16
-            || values[1] >= 16 || values[1] < -16
-            || values[2] >= 8 || values[2] < -8) {
-        selector = BITS_877;
-        // Require more than 2 bits?
-    } else if (values[0] >= 2 || values[0] < -2
-            || values[1] >= 2 || values[1] < -2
-            || values[2] >= 2 || values[2] < -2) {
-        selector = BITS_554;
-    }
+    const uint32_t magnitude0 = magnitude(values[0]);
+    const uint32_t magnitude1 = magnitude(values[1]);
+    const uint32_t magnitude2 = magnitude(values[2]);
+    const int selector = ((magnitude0 | magnitude1 | magnitude2) >= 2)
+        + ((magnitude0 >= 16) | (magnitude1 >= 16) | (magnitude2 >= 8))
+        + ((magnitude0 >= 256) | (magnitude1 >= 128) | (magnitude2 >= 128));
 
     switch (selector) {
     case BITS_2:
@@ -308,68 +256,18 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
         break;
     case BITS_554:
         // 554 bits per field  ss11 1112 2222 3333
-        blackboxWrite((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
-        blackboxWrite(((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
+        blackboxWriteLE((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4)
+            | (((values[1] & 0x0F) << 4) | (values[2] & 0x0F)) << 8, 2);
         break;
     case BITS_877:
         // 877 bits per field  ss11 1111 1122 2222 2333 3333
-        blackboxWrite((selector << 6) | ((values[0] & 0xFF) >> 2));
-        blackboxWrite(((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
-        blackboxWrite(((values[1] & 0x01) << 7) | (values[2] & 0x7F));
+        blackboxWriteLE((selector << 6) | ((values[0] & 0xFF) >> 2)
+            | (((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1)) << 8
+            | (((values[1] & 0x01) << 7) | (values[2] & 0x7F)) << 16, 3);
         break;
     case BITS_32:
-        /*
-         * Do another round to compute a selector for each field, assuming that they are at least 8 bits each
-         *
-         * Selector2 field possibilities
-         * 0 - 8 bits
-         * 1 - 16 bits
-         * 2 - 24 bits
-         * 3 - 32 bits
-         */
-        selector2 = 0;
-        //Encode in reverse order so the first field is in the low bits:
-        for (int x = FIELD_COUNT - 1; x >= 0; x--) {
-            selector2 <<= 2;
-
-            if (values[x] < 128 && values[x] >= -128) {
-                selector2 |= BYTES_1;
-            } else if (values[x] < 32768 && values[x] >= -32768) {
-                selector2 |= BYTES_2;
-            } else if (values[x] < 8388608 && values[x] >= -8388608) {
-                selector2 |= BYTES_3;
-            } else {
-                selector2 |= BYTES_4;
-            }
-        }
-
-        //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
-
-        //And now the values according to the selectors we picked for them
-        for (int x = 0; x < FIELD_COUNT; x++, selector2 >>= 2) {
-            switch (selector2 & 0x03) {
-            case BYTES_1:
-                blackboxWrite(values[x]);
-                break;
-            case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                break;
-            case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                break;
-            case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
-                break;
-            }
-        }
-    break;
+        writeTag2_3S32Bytes(selector, values);
+        break;
     }
     return selector;
 }
@@ -379,79 +277,36 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
  */
 void blackboxWriteTag8_4S16(int32_t *values)
 {
+    /*
+     * Field selectors, first field in the low bits:
+     * 0 - zero, not written
+     * 1 - 4 bits
+     * 2 - 8 bits
+     * 3 - 16 bits
+     *
+     * The fields are packed high nibble first in the order they appear, so they're gathered as a string of nibbles in
+     * an accumulator and written out once at the end, padded to a whole byte.
+     */
+    uint8_t selector = 0;
+    uint64_t nibbles = 0;
+    int nibbleCount = 0;
 
-    //Need to be enums rather than const ints if we want to switch on them (due to being C)
-    enum {
-        FIELD_ZERO  = 0,
-        FIELD_4BIT  = 1,
-        FIELD_8BIT  = 2,
-        FIELD_16BIT = 3
-    };
+    for (int x = 0; x < 4; x++) {
+        const uint32_t fieldMagnitude = magnitude(values[x]);
+        const int fieldSelector = (values[x] != 0) + (fieldMagnitude >= 8) + (fieldMagnitude >= 128);
+        const int fieldNibbles = (1 << fieldSelector) >> 1;
 
-    uint8_t selector = 0;
-    //Encode in reverse order so the first field is in the low bits:
-    for (int x = 3; x >= 0; x--) {
-        selector <<= 2;
-
-        if (values[x] == 0) {
-            selector |= FIELD_ZERO;
-        } else if (values[x] < 8 && values[x] >= -8) {
-            selector |= FIELD_4BIT;
-        } else if (values[x] < 128 && values[x] >= -128) {
-            selector |= FIELD_8BIT;
-        } else {
-            selector |= FIELD_16BIT;
-        }
+        selector |= fieldSelector << (x * 2);
+        nibbles = (nibbles << (fieldNibbles * 4)) | (values[x] & ((1 << (fieldNibbles * 4)) - 1));
+        nibbleCount += fieldNibbles;
     }
 
     blackboxWrite(selector);
 
-    int nibbleIndex = 0;
-    uint8_t buffer = 0;
-    for (int x = 0; x < 4; x++, selector >>= 2) {
-        switch (selector & 0x03) {
-        case FIELD_ZERO:
-            //No-op
-            break;
-        case FIELD_4BIT:
-            if (nibbleIndex == 0) {
-                //We fill high-bits first
-                buffer = values[x] << 4;
-                nibbleIndex = 1;
-            } else {
-                blackboxWrite(buffer | (values[x] & 0x0F));
-                nibbleIndex = 0;
-            }
-            break;
-        case FIELD_8BIT:
-            if (nibbleIndex == 0) {
-                blackboxWrite(values[x]);
-            } else {
-                //Write the high bits of the value first (mask to avoid sign extension)
-                blackboxWrite(buffer | ((values[x] >> 4) & 0x0F));
-                //Now put the leftover low bits into the top of the next buffer entry
-                buffer = values[x] << 4;
-            }
-            break;
-        case FIELD_16BIT:
-            if (nibbleIndex == 0) {
-                //Write high byte first
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x]);
-            } else {
-                //First write the highest 4 bits
-                blackboxWrite(buffer | ((values[x] >> 12) & 0x0F));
-                // Then the middle 8
-                blackboxWrite(values[x] >> 4);
-                //Only the smallest 4 bits are still left to write
-                buffer = values[x] << 4;
-            }
-            break;
-        }
-    }
-    //Anything left over to write?
-    if (nibbleIndex == 1) {
-        blackboxWrite(buffer);
+    if (nibbleCount) {
+        // Move the first nibble to the top of the accumulator, then byte swap so it's written first
+        nibbles = __builtin_bswap64(nibbles << (64 - nibbleCount * 4));
+        blackboxWriteLE(nibbles, (nibbleCount + 1) / 2);
     }
 }
 
@@ -463,23 +318,15 @@ void blackboxWriteTag8_4S16(int32_t *values)
  */
 void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
 {
-    uint8_t header;
-
     if (valueCount > 0) {
         //If we're only writing one field then we can skip the header
         if (valueCount == 1) {
             blackboxWriteSignedVB(values[0]);
         } else {
-            //First write a one-byte header that marks which fields are non-zero
-            header = 0;
-
-            // First field should be in low bits of header
-            for (int i = valueCount - 1; i >= 0; i--) {
-                header <<= 1;
-
-                if (values[i] != 0) {
-                    header |= 0x01;
-                }
+            //First write a one-byte header that marks which fields are non-zero, first field in the low bit
+            uint8_t header = 0;
+            for (int i = 0; i < valueCount; i++) {
+                header |= (values[i] != 0) << i;
             }
 
             blackboxWrite(header);
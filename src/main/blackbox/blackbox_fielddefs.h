@@ -110,10 +110,23 @@ typedef enum FlightLogFieldPredictor {
     FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10,
 
     //Predict that this field is the minimum motor output
-    FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR       = 11
+    FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR       = 11,
+
+    //Predict that the change in slope is the same as that between the past three history items:
+    FLIGHT_LOG_FIELD_PREDICTOR_SECOND_ORDER   = 12
 
 } FlightLogFieldPredictor;
 
+// Field groups whose P-frame predictor is chosen by blackbox_adaptive_predictors
+typedef enum {
+    BLACKBOX_PREDICTOR_GROUP_SETPOINT = 0,
+    BLACKBOX_PREDICTOR_GROUP_GYRO,
+    BLACKBOX_PREDICTOR_GROUP_ACC,
+    BLACKBOX_PREDICTOR_GROUP_DEBUG,
+    BLACKBOX_PREDICTOR_GROUP_MOTOR,
+    BLACKBOX_PREDICTOR_GROUP_COUNT
+} blackboxPredictorGroup_e;
+
 typedef enum FlightLogFieldEncoding {
     FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB       = 0, // Signed variable-byte
     FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB     = 1, // Unsigned variable-byte
@@ -150,6 +163,11 @@ typedef struct flightLogEvent_inflightAdjustment_s {
     bool floatFlag;
 } flightLogEvent_inflightAdjustment_t;
 
+// Predictor chosen for each blackboxPredictorGroup_e, applying to the P-frames after the preceding I-frame
+typedef struct flightLogEvent_predictors_s {
+    uint8_t predictor[BLACKBOX_PREDICTOR_GROUP_COUNT];
+} flightLogEvent_predictors_t;
+
 typedef struct flightLogEvent_loggingResume_s {
     uint32_t logIteration;
     uint32_t currentTime;
@@ -163,6 +181,7 @@ typedef union flightLogEventData_u {
     flightLogEvent_disarm_t disarm;
     flightLogEvent_inflightAdjustment_t inflightAdjustment;
     flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_predictors_t predictors;
 } flightLogEventData_t;
 
 typedef struct flightLogEvent_s {
@@ -0,0 +1,287 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_FILE
+
+#include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "blackbox/blackbox_file.h"
+
+#define LOGFILE_PREFIX "LOG"
+#define LOGFILE_SUFFIX "BFL"
+
+#define BLACKBOX_FILE_IDLE_SLEEP_NS (1000 * 1000)
+
+// head and tail are free running, the byte is at the index modulo BLACKBOX_FILE_RING_SIZE.
+// Only the flight loop writes head and only the writer thread writes tail.
+#define RING_LOAD(var)          __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define RING_STORE(var, val)    __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+
+STATIC_ASSERT((BLACKBOX_FILE_RING_SIZE & (BLACKBOX_FILE_RING_SIZE - 1)) == 0, blackbox_file_ring_size_not_power_of_2);
+
+/*
+ * The flight loop requests a change by storing one of the *_REQUESTED states, the writer thread carries it out and
+ * stores the resulting state. Each side only stores while the state is its to change, so no lock is needed.
+ */
+typedef enum {
+    BLACKBOX_FILE_IDLE = 0,
+    BLACKBOX_FILE_OPEN_REQUESTED,
+    BLACKBOX_FILE_LOGGING,
+    BLACKBOX_FILE_CLOSE_REQUESTED,
+    BLACKBOX_FILE_DISCARD_REQUESTED,
+    BLACKBOX_FILE_ERROR,
+} blackboxFileState_e;
+
+static struct {
+    uint8_t ring[BLACKBOX_FILE_RING_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t droppedBytes;
+
+    blackboxFileState_e state;
+    int32_t logNumber;              // of the current log, or the last one written
+
+    bool threadStarted;
+    pthread_t thread;
+
+    // Only touched by the writer thread
+    FILE *file;
+    char filename[32];
+} blackboxFile;
+
+static int32_t largestLogNumber(void)
+{
+    int32_t largest = 0;
+    DIR *dir = opendir(BLACKBOX_FILE_DIRECTORY);
+
+    if (dir) {
+        struct dirent *entry;
+        while ((entry = readdir(dir))) {
+            // LOGnnnnn.BFL, as on an SD card
+            if (strlen(entry->d_name) == 12
+                && strncmp(entry->d_name, LOGFILE_PREFIX, strlen(LOGFILE_PREFIX)) == 0
+                && strncmp(entry->d_name + 8, "." LOGFILE_SUFFIX, strlen(LOGFILE_SUFFIX) + 1) == 0) {
+                largest = MAX((int32_t)atoi(entry->d_name + 3), largest);
+            }
+        }
+        closedir(dir);
+    }
+
+    return largest;
+}
+
+static bool openLogFile(void)
+{
+    if (mkdir(BLACKBOX_FILE_DIRECTORY, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "[BLACKBOX] failed to create '%s': %s\n", BLACKBOX_FILE_DIRECTORY, strerror(errno));
+        return false;
+    }
+
+    const int32_t logNumber = largestLogNumber() + 1;
+    snprintf(blackboxFile.filename, sizeof(blackboxFile.filename), BLACKBOX_FILE_DIRECTORY "/" LOGFILE_PREFIX "%05d." LOGFILE_SUFFIX, (int)logNumber);
+
+    blackboxFile.file = fopen(blackboxFile.filename, "wb");
+    if (!blackboxFile.file) {
+        fprintf(stderr, "[BLACKBOX] failed to create '%s': %s\n", blackboxFile.filename, strerror(errno));
+        return false;
+    }
+
+    blackboxFile.logNumber = logNumber;
+    printf("[BLACKBOX] logging to '%s'\n", blackboxFile.filename);
+    return true;
+}
+
+// Write out everything queued, returns the number of bytes written
+static uint32_t drainRing(void)
+{
+    uint32_t tail = blackboxFile.tail;
+    const uint32_t available = RING_LOAD(blackboxFile.head) - tail;
+    uint32_t remaining = available;
+
+    while (remaining) {
+        const uint32_t offset = tail % BLACKBOX_FILE_RING_SIZE;
+        const uint32_t length = MIN(remaining, BLACKBOX_FILE_RING_SIZE - offset);
+
+        if (blackboxFile.file && fwrite(&blackboxFile.ring[offset], 1, length, blackboxFile.file) != length) {
+            fprintf(stderr, "[BLACKBOX] write to '%s' failed: %s\n", blackboxFile.filename, strerror(errno));
+        }
+        tail += length;
+        remaining -= length;
+    }
+
+    RING_STORE(blackboxFile.tail, tail);
+    return available;
+}
+
+static void *blackboxFileThread(void *data)
+{
+    UNUSED(data);
+
+    while (true) {
+        const uint32_t written = drainRing();
+
+        switch (RING_LOAD(blackboxFile.state)) {
+        case BLACKBOX_FILE_OPEN_REQUESTED:
+            RING_STORE(blackboxFile.state, openLogFile() ? BLACKBOX_FILE_LOGGING : BLACKBOX_FILE_ERROR);
+            break;
+
+        case BLACKBOX_FILE_CLOSE_REQUESTED:
+        case BLACKBOX_FILE_DISCARD_REQUESTED:
+            // The flight loop stops writing before asking, so once the ring is empty the log is complete
+            if (RING_LOAD(blackboxFile.head) == blackboxFile.tail) {
+                if (blackboxFile.file) {
+                    fclose(blackboxFile.file);
+                    blackboxFile.file = NULL;
+                    if (RING_LOAD(blackboxFile.state) == BLACKBOX_FILE_DISCARD_REQUESTED) {
+                        remove(blackboxFile.filename);
+                    }
+                }
+                RING_STORE(blackboxFile.state, BLACKBOX_FILE_IDLE);
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (written == 0) {
+            const struct timespec idle = { .tv_sec = 0, .tv_nsec = BLACKBOX_FILE_IDLE_SLEEP_NS };
+            nanosleep(&idle, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+bool blackboxFileInit(void)
+{
+    if (!blackboxFile.threadStarted) {
+        if (pthread_create(&blackboxFile.thread, NULL, blackboxFileThread, NULL) != 0) {
+            fprintf(stderr, "[BLACKBOX] failed to start writer thread\n");
+            return false;
+        }
+        blackboxFile.threadStarted = true;
+    }
+
+    return true;
+}
+
+/**
+ * Begin a new log file. Keep calling until the function returns true (open is complete).
+ */
+bool blackboxFileBeginLog(void)
+{
+    switch (RING_LOAD(blackboxFile.state)) {
+    case BLACKBOX_FILE_IDLE:
+    case BLACKBOX_FILE_ERROR:
+        // Retry after an error, the directory may have become writable
+        RING_STORE(blackboxFile.state, BLACKBOX_FILE_OPEN_REQUESTED);
+        return false;
+
+    case BLACKBOX_FILE_LOGGING:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * Close the current log file once everything written has reached it, deleting it unless retainLog.
+ *
+ * Keep calling until this returns true.
+ */
+bool blackboxFileEndLog(bool retainLog)
+{
+    switch (RING_LOAD(blackboxFile.state)) {
+    case BLACKBOX_FILE_LOGGING:
+        RING_STORE(blackboxFile.state, retainLog ? BLACKBOX_FILE_CLOSE_REQUESTED : BLACKBOX_FILE_DISCARD_REQUESTED);
+        return false;
+
+    case BLACKBOX_FILE_IDLE:
+    case BLACKBOX_FILE_ERROR:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * Queue bytes for the writer thread. Never blocks, returns the number queued, the rest are dropped if the ring is full.
+ */
+uint32_t blackboxFileWrite(const uint8_t *data, uint32_t length)
+{
+    const uint32_t head = blackboxFile.head;
+    const uint32_t queued = MIN(length, BLACKBOX_FILE_RING_SIZE - (head - RING_LOAD(blackboxFile.tail)));
+    const uint32_t offset = head % BLACKBOX_FILE_RING_SIZE;
+    const uint32_t firstLength = MIN(queued, BLACKBOX_FILE_RING_SIZE - offset);
+
+    memcpy(&blackboxFile.ring[offset], data, firstLength);
+    memcpy(&blackboxFile.ring[0], data + firstLength, queued - firstLength);
+
+    blackboxFile.droppedBytes += length - queued;
+    RING_STORE(blackboxFile.head, head + queued);
+
+    return queued;
+}
+
+uint32_t blackboxFileBytesFree(void)
+{
+    return BLACKBOX_FILE_RING_SIZE - (blackboxFile.head - RING_LOAD(blackboxFile.tail));
+}
+
+// Returns true once everything queued has been handed to the file
+bool blackboxFileFlush(void)
+{
+    return RING_LOAD(blackboxFile.tail) == blackboxFile.head;
+}
+
+bool blackboxFileIsWorking(void)
+{
+    return RING_LOAD(blackboxFile.state) != BLACKBOX_FILE_ERROR;
+}
+
+int32_t blackboxFileGetLogNumber(void)
+{
+    return RING_LOAD(blackboxFile.state) == BLACKBOX_FILE_LOGGING ? blackboxFile.logNumber : -1;
+}
+
+uint32_t blackboxFileDroppedBytes(void)
+{
+    return blackboxFile.droppedBytes;
+}
+
+#endif // USE_BLACKBOX_FILE
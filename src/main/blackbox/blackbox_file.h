@@ -0,0 +1,43 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Blackbox device writing logs to files on the host, for SITL.
+// Logs are written as logs/LOGnnnnn.BFL, numbered on from the largest already there like on an SD card, and hold
+// the same byte stream as the other devices so blackbox-tools reads them directly.
+// The flight loop only copies into a lock-free ring, a writer thread drains it to the file and does all the file
+// system work, so logging never waits on the disk.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BLACKBOX_FILE_DIRECTORY     "logs"
+#define BLACKBOX_FILE_RING_SIZE     (256 * 1024) // power of 2, about a second of logging at 8kHz
+
+bool blackboxFileInit(void);
+bool blackboxFileBeginLog(void);
+bool blackboxFileEndLog(bool retainLog);
+uint32_t blackboxFileWrite(const uint8_t *data, uint32_t length);
+uint32_t blackboxFileBytesFree(void);
+bool blackboxFileFlush(void);
+bool blackboxFileIsWorking(void);
+int32_t blackboxFileGetLogNumber(void);
+uint32_t blackboxFileDroppedBytes(void);
@@ -0,0 +1,130 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+
+#include "blackbox/blackbox_gyro_capture.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/dshot.h"
+
+STATIC_ASSERT((BLACKBOX_GYRO_CAPTURE_RING_SIZE & (BLACKBOX_GYRO_CAPTURE_RING_SIZE - 1)) == 0, gyro_capture_ring_size_not_power_of_2);
+
+// Pushed by the filter task and read by the blackbox, both from the main loop, so no ordering is needed.
+// head and tail are free running like in the gyro ring.
+typedef struct blackboxGyroCapture_s {
+    bool active;
+    bool started;                   // the first sample has been taken, endUs is valid
+    uint8_t erpmCount;
+    timeUs_t durationUs;
+    timeUs_t endUs;
+    uint32_t head;
+    uint32_t tail;
+    blackboxGyroCaptureSample_t samples[BLACKBOX_GYRO_CAPTURE_RING_SIZE];
+} blackboxGyroCapture_t;
+
+static blackboxGyroCapture_t capture;
+
+void blackboxGyroCaptureStart(timeUs_t durationUs, uint8_t erpmCount)
+{
+    capture.head = 0;
+    capture.tail = 0;
+    capture.durationUs = durationUs;
+    capture.erpmCount = MIN(erpmCount, BLACKBOX_GYRO_CAPTURE_MAX_ERPM);
+    capture.started = false;
+    capture.active = true;
+}
+
+// Samples already queued stay readable
+void blackboxGyroCaptureStop(void)
+{
+    capture.active = false;
+}
+
+bool blackboxGyroCaptureIsActive(void)
+{
+    return capture.active;
+}
+
+/*
+ * Queue a batch of samples drained from the gyro ring. The filters only produce one value per batch, so
+ * every sample of the batch carries it. Does nothing unless a capture is running.
+ */
+FAST_CODE void blackboxGyroCapturePush(const gyroSample_t *samples, int count, const float *gyroADCf)
+{
+    if (!capture.active) {
+        return;
+    }
+
+    int16_t filtered[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        filtered[axis] = lrintf(gyroADCf[axis]);
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (!capture.started) {
+            capture.endUs = samples[i].timeUs + capture.durationUs;
+            capture.started = true;
+        } else if (cmpTimeUs(samples[i].timeUs, capture.endUs) >= 0) {
+            capture.active = false;
+            return;
+        }
+
+        if (capture.head - capture.tail >= BLACKBOX_GYRO_CAPTURE_RING_SIZE) {
+            // the blackbox fell behind, the gap shows in the logged sample times
+            continue;
+        }
+
+        blackboxGyroCaptureSample_t *sample = &capture.samples[capture.head % BLACKBOX_GYRO_CAPTURE_RING_SIZE];
+        sample->timeUs = samples[i].timeUs;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sample->gyroUnfilt[axis] = lrintf(samples[i].adc[axis]);
+            sample->gyroADC[axis] = filtered[axis];
+        }
+#ifdef USE_DSHOT_TELEMETRY
+        for (int motor = 0; motor < capture.erpmCount; motor++) {
+            sample->erpm[motor] = getDshotTelemetry(motor);
+        }
+#endif
+        capture.head++;
+    }
+}
+
+// Take the oldest queued sample, returns false when there is none
+bool blackboxGyroCaptureRead(blackboxGyroCaptureSample_t *sample)
+{
+    if (capture.tail == capture.head) {
+        return false;
+    }
+
+    *sample = capture.samples[capture.tail % BLACKBOX_GYRO_CAPTURE_RING_SIZE];
+    capture.tail++;
+    return true;
+}
+
+#endif // USE_BLACKBOX_GYRO_CAPTURE
@@ -0,0 +1,54 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/axis.h"
+#include "common/time.h"
+
+#include "sensors/gyro_ring.h"
+
+/*
+ * Full rate gyro capture.
+ *
+ * While a capture runs, every gyro sample the filter task consumes is queued here, unfiltered and with the
+ * filtered value of its batch (and optionally the DShot telemetry eRPM of each motor), and the blackbox
+ * drains the queue into lean 'R' frames in place of its main frames. A capture lasts until it is stopped or
+ * until durationUs has passed since its first sample.
+ */
+
+#define BLACKBOX_GYRO_CAPTURE_RING_SIZE 32 // power of 2, holds two pid loops at the largest pid_process_denom
+#define BLACKBOX_GYRO_CAPTURE_MAX_ERPM 8
+
+typedef struct blackboxGyroCaptureSample_s {
+    timeUs_t timeUs;
+    int16_t gyroUnfilt[XYZ_AXIS_COUNT];
+    int16_t gyroADC[XYZ_AXIS_COUNT];
+    uint16_t erpm[BLACKBOX_GYRO_CAPTURE_MAX_ERPM]; // eRPM / 100
+} blackboxGyroCaptureSample_t;
+
+void blackboxGyroCaptureStart(timeUs_t durationUs, uint8_t erpmCount);
+void blackboxGyroCaptureStop(void);
+bool blackboxGyroCaptureIsActive(void);
+void blackboxGyroCapturePush(const gyroSample_t *samples, int count, const float *gyroADCf);
+bool blackboxGyroCaptureRead(blackboxGyroCaptureSample_t *sample);
@@ -43,6 +43,7 @@
 #define DEBUG_BB_OUTPUT
 
 #include "blackbox.h"
+#include "blackbox_file.h"
 #include "blackbox_io.h"
 
 #include "common/maths.h"
@@ -108,41 +109,139 @@ static uint16_t bbRateMax;
 static uint32_t bbDrops;
 #endif
 
+// Encoded bytes are staged here and handed to the device in one bulk write per frame, rather than one device call per byte
+static uint8_t blackboxFrameBuffer[BLACKBOX_FRAME_BUFFER_SIZE];
+static int blackboxFrameBufferLength;
+
 void blackboxWrite(uint8_t value)
+{
+    blackboxFrameBuffer[blackboxFrameBufferLength++] = value;
+
+    if (blackboxFrameBufferLength >= BLACKBOX_FRAME_BUFFER_SIZE) {
+        blackboxDeviceCommit();
+    }
+}
+
+/**
+ * Write the low `count` bytes (at most 8) of `value`, least significant first.
+ *
+ * The encoders assemble a field in a register and write it with this, rather than calling blackboxWrite() per byte.
+ */
+void blackboxWriteLE(uint64_t value, int count)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    if (blackboxFrameBufferLength + (int)sizeof(value) <= BLACKBOX_FRAME_BUFFER_SIZE) {
+        // Store all 8 bytes, the ones past `count` are overwritten by the next write
+        memcpy(&blackboxFrameBuffer[blackboxFrameBufferLength], &value, sizeof(value));
+        blackboxFrameBufferLength += count;
+
+        if (blackboxFrameBufferLength >= BLACKBOX_FRAME_BUFFER_SIZE) {
+            blackboxDeviceCommit();
+        }
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        blackboxWrite(value >> (i * 8));
+    }
+}
+
+// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
+int blackboxWriteString(const char *s)
+{
+    const uint8_t *pos = (const uint8_t *)s;
+
+    while (*pos) {
+        blackboxWrite(*pos);
+        pos++;
+    }
+
+    return pos - (const uint8_t *)s;
+}
+
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+// While an image is being captured, committed bytes are appended to it instead of going to the device
+static struct {
+    uint8_t *data;
+    int32_t size;
+    int32_t length; // -1 once the image has overflowed
+} blackboxImage;
+
+/**
+ * Redirect everything written from now on into the given buffer, until blackboxImageEnd(). Header reservations
+ * always succeed meanwhile, so header writers run to completion in one call.
+ */
+void blackboxImageBegin(uint8_t *data, int32_t size)
+{
+    blackboxImage.data = data;
+    blackboxImage.size = size;
+    blackboxImage.length = 0;
+}
+
+// Stop capturing and return the length of the image, or -1 if it didn't fit in the buffer
+int32_t blackboxImageEnd(void)
+{
+    blackboxDeviceCommit();
+    blackboxImage.data = NULL;
+
+    return blackboxImage.length;
+}
+
+static void blackboxImageAppend(const uint8_t *data, int length)
+{
+    if (blackboxImage.length < 0 || length > blackboxImage.size - blackboxImage.length) {
+        blackboxImage.length = -1;
+        return;
+    }
+    memcpy(blackboxImage.data + blackboxImage.length, data, length);
+    blackboxImage.length += length;
+}
+#endif
+
+static void blackboxDeviceWrite(const uint8_t *data, int length)
 {
 #ifdef DEBUG_BB_OUTPUT
-    bbBits += 8;
+    bbBits += length * 8;
 #endif
 
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        flashfsWriteByte(value); // Write byte asynchronously
+        flashfsWrite(data, length, false); // Write asynchronously
         break;
 #endif
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
-        afatfs_fputc(blackboxSDCard.logFile, value);
+        afatfs_fwrite(blackboxSDCard.logFile, data, length); // Ignore failures due to buffers filling up
+        break;
+#endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        blackboxFileWrite(data, length); // Dropped if the writer thread has fallen behind
         break;
 #endif
     case BLACKBOX_DEVICE_SERIAL:
     default:
         {
-            int txBytesFree = serialTxBytesFree(blackboxPort);
+            // Bytes which don't fit in the Tx buffer are dropped rather than waiting for it to drain,
+            // so serialWriteBuf() never has to wait for room
+            const int txBytesFree = serialTxBytesFree(blackboxPort);
+            const int txLength = MIN(length, txBytesFree);
 
 #ifdef DEBUG_BB_OUTPUT
-            bbBits += 2;
+            bbBits += length * 2;
             DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 3, txBytesFree);
-#endif
 
-            if (txBytesFree == 0) {
-#ifdef DEBUG_BB_OUTPUT
-                ++bbDrops;
+            if (txLength < length) {
+                bbDrops += length - txLength;
                 DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 2, bbDrops);
+            }
 #endif
-                return;
+
+            if (txLength > 0) {
+                serialWriteBuf(blackboxPort, data, txLength);
             }
-            serialWrite(blackboxPort, value);
         }
         break;
     }
@@ -163,41 +262,28 @@ void blackboxWrite(uint8_t value)
 #endif
 }
 
-// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
-int blackboxWriteString(const char *s)
+/**
+ * Write the bytes staged since the last commit to the blackbox device.
+ *
+ * Called once a frame has been encoded, and before any flush, so the device sees the frame as a single write.
+ */
+void blackboxDeviceCommit(void)
 {
-    int length;
-    const uint8_t *pos;
-
-    switch (blackboxConfig()->device) {
-
-#ifdef USE_FLASHFS
-    case BLACKBOX_DEVICE_FLASH:
-        length = strlen(s);
-        flashfsWrite((const uint8_t*) s, length, false); // Write asynchronously
-        break;
-#endif // USE_FLASHFS
-
-#ifdef USE_SDCARD
-    case BLACKBOX_DEVICE_SDCARD:
-        length = strlen(s);
-        afatfs_fwrite(blackboxSDCard.logFile, (const uint8_t*) s, length); // Ignore failures due to buffers filling up
-        break;
-#endif // USE_SDCARD
+    const int length = blackboxFrameBufferLength;
 
-    case BLACKBOX_DEVICE_SERIAL:
-    default:
-        pos = (uint8_t*) s;
-        while (*pos) {
-            blackboxWrite(*pos);
-            pos++;
-        }
+    if (length == 0) {
+        return;
+    }
+    blackboxFrameBufferLength = 0;
 
-        length = pos - (uint8_t*) s;
-        break;
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+    if (blackboxImage.data) {
+        blackboxImageAppend(blackboxFrameBuffer, length);
+        return;
     }
+#endif
 
-    return length;
+    blackboxDeviceWrite(blackboxFrameBuffer, length);
 }
 
 /**
@@ -207,6 +293,8 @@ int blackboxWriteString(const char *s)
  */
 void blackboxDeviceFlush(void)
 {
+    blackboxDeviceCommit();
+
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
         /*
@@ -214,7 +302,7 @@ void blackboxDeviceFlush(void)
          * devices will progressively write in the background without Blackbox calling anything.
          */
     case BLACKBOX_DEVICE_FLASH:
-        flashfsFlushAsync();
+        flashfsFlushAsync(false);
         break;
 #endif // USE_FLASHFS
 
@@ -230,6 +318,8 @@ void blackboxDeviceFlush(void)
  */
 bool blackboxDeviceFlushForce(void)
 {
+    blackboxDeviceCommit();
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         // Nothing to speed up flushing on serial, as serial is continuously being drained out of its buffer
@@ -237,7 +327,7 @@ bool blackboxDeviceFlushForce(void)
 
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        return flashfsFlushAsync();
+        return flashfsFlushAsync(true);
 #endif // USE_FLASHFS
 
 #ifdef USE_SDCARD
@@ -250,6 +340,11 @@ bool blackboxDeviceFlushForce(void)
         return afatfs_flush();
 #endif // USE_SDCARD
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileFlush();
+#endif
+
     default:
         return false;
     }
@@ -280,6 +375,8 @@ bool blackboxDeviceFlushForceComplete(void)
  */
 bool blackboxDeviceOpen(void)
 {
+    blackboxFrameBufferLength = 0;
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         {
@@ -361,6 +458,16 @@ bool blackboxDeviceOpen(void)
         return true;
         break;
 #endif // USE_SDCARD
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        if (!blackboxFileInit()) {
+            return false;
+        }
+
+        blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+
+        return true;
+#endif
     default:
         return false;
     }
@@ -409,6 +516,9 @@ bool isBlackboxErased(void)
  */
 void blackboxDeviceClose(void)
 {
+    // Anything still staged has nowhere to go
+    blackboxFrameBufferLength = 0;
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         // Can immediately close without attempting to flush any remaining data.
@@ -565,6 +675,10 @@ bool blackboxDeviceBeginLog(void)
     case BLACKBOX_DEVICE_SDCARD:
         return blackboxSDCardBeginLog();
 #endif // USE_SDCARD
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileBeginLog();
+#endif
     default:
         return true;
     }
@@ -580,7 +694,7 @@ bool blackboxDeviceBeginLog(void)
  */
 bool blackboxDeviceEndLog(bool retainLog)
 {
-#ifndef USE_SDCARD
+#if !defined(USE_SDCARD) && !defined(USE_BLACKBOX_FILE)
     UNUSED(retainLog);
 #endif
 
@@ -599,6 +713,12 @@ bool blackboxDeviceEndLog(bool retainLog)
         }
         return false;
 #endif // USE_SDCARD
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        // Everything staged has to be queued before the writer thread is asked to close the file
+        blackboxDeviceCommit();
+        return blackboxFileEndLog(retainLog);
+#endif
     default:
         return true;
     }
@@ -641,6 +761,11 @@ bool isBlackboxDeviceWorking(void)
         return flashfsIsReady();
 #endif
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileIsWorking();
+#endif
+
     default:
         return false;
     }
@@ -653,17 +778,18 @@ int32_t blackboxGetLogNumber(void)
     case BLACKBOX_DEVICE_SDCARD:
         return blackboxSDCard.largestLogFileNumber;
 #endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileGetLogNumber();
+#endif
 
     default:
         return -1;
     }
 }
 
-/**
- * Call once every loop iteration in order to maintain the global blackboxHeaderBudget with the number of bytes we can
- * transmit this iteration.
- */
-void blackboxReplenishHeaderBudget(void)
+// Bytes the device can accept right now without dropping any
+static int32_t blackboxDeviceFreeSpace(void)
 {
     int32_t freeSpace;
 
@@ -680,13 +806,70 @@ void blackboxReplenishHeaderBudget(void)
     case BLACKBOX_DEVICE_SDCARD:
         freeSpace = afatfs_getFreeBufferSpace();
         break;
+#endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        freeSpace = blackboxFileBytesFree();
+        break;
 #endif
     default:
         freeSpace = 0;
     }
+
+    return freeSpace;
+}
+
+// Bytes which can still be written this iteration without the device dropping any, less those already staged
+int32_t blackboxDeviceBytesFree(void)
+{
+    return blackboxDeviceFreeSpace() - blackboxFrameBufferLength;
+}
+
+/**
+ * Call once every loop iteration in order to maintain the global blackboxHeaderBudget with the number of bytes we can
+ * transmit this iteration.
+ */
+void blackboxReplenishHeaderBudget(void)
+{
+    const int32_t freeSpace = blackboxDeviceFreeSpace();
+
     blackboxHeaderBudget = MIN(MIN(freeSpace, blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration), BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET);
 }
 
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+/**
+ * Write up to `length` bytes of a prepared header to the device and return how many were taken.
+ *
+ * Serial ports stay paced by the header budget just like streamed header lines, so keep replenishing it every
+ * iteration. The storage devices take as much as their buffers have room for, so a header image reaches them in a few
+ * large writes.
+ */
+int32_t blackboxDeviceWriteHeader(const uint8_t *data, int32_t length)
+{
+    int32_t space;
+
+    if (blackboxConfig()->device == BLACKBOX_DEVICE_SERIAL) {
+        space = blackboxHeaderBudget;
+    } else {
+        space = blackboxDeviceFreeSpace();
+    }
+
+    const int32_t count = MIN(length, MAX(space, 0));
+    if (count > 0) {
+        blackboxDeviceCommit();
+        blackboxDeviceWrite(data, count);
+        if (blackboxConfig()->device == BLACKBOX_DEVICE_SERIAL) {
+            blackboxHeaderBudget -= count;
+        }
+    }
+
+    // Flash only writes its buffer out when asked to
+    blackboxDeviceFlush();
+
+    return count;
+}
+#endif
+
 /**
  * You must call this function before attempting to write Blackbox header bytes to ensure that the write will not
  * cause buffers to overflow. The number of bytes you can write is capped by the blackboxHeaderBudget. Calling this
@@ -707,6 +890,12 @@ void blackboxReplenishHeaderBudget(void)
  */
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
 {
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+    if (blackboxImage.data) {
+        return BLACKBOX_RESERVE_SUCCESS;
+    }
+#endif
+
     if (bytes <= blackboxHeaderBudget) {
         return BLACKBOX_RESERVE_SUCCESS;
     }
@@ -735,7 +924,7 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
              * that the Blackbox header writing code doesn't have to guess about the best time to ask flashfs to
              * flush, and doesn't stall waiting for a flush that would otherwise not automatically be called.
              */
-            flashfsFlushAsync();
+            flashfsFlushAsync(true);
         }
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_FLASHFS
@@ -746,6 +935,12 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_SDCARD
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        // The writer thread is draining the ring
+        return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
+#endif
+
     default:
         return BLACKBOX_RESERVE_PERMANENT_FAILURE;
     }
@@ -38,11 +38,19 @@ typedef enum {
  */
 #define BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64
 
+/*
+ * Bytes are staged in a buffer of this size and written to the device once per frame. A frame larger than this is
+ * written in several pieces:
+ */
+#define BLACKBOX_FRAME_BUFFER_SIZE 256
+
 extern int32_t blackboxHeaderBudget;
 
 void blackboxOpen(void);
 void blackboxWrite(uint8_t value);
+void blackboxWriteLE(uint64_t value, int count);
 int blackboxWriteString(const char *s);
+void blackboxDeviceCommit(void);
 
 void blackboxDeviceFlush(void);
 bool blackboxDeviceFlushForce(void);
@@ -62,5 +70,12 @@ bool isBlackboxDeviceWorking(void);
 int32_t blackboxGetLogNumber(void);
 
 void blackboxReplenishHeaderBudget(void);
+int32_t blackboxDeviceBytesFree(void);
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
+
+#ifdef USE_BLACKBOX_HEADER_IMAGE
+void blackboxImageBegin(uint8_t *data, int32_t size);
+int32_t blackboxImageEnd(void);
+int32_t blackboxDeviceWriteHeader(const uint8_t *data, int32_t length);
+#endif
 int8_t blackboxGetLogFileNo(void);
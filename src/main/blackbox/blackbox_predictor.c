@@ -0,0 +1,136 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX
+
+#include "blackbox/blackbox_predictor.h"
+
+static const uint8_t adaptivePredictors[BLACKBOX_ADAPTIVE_PREDICTOR_COUNT] = {
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS,
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2,
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE,
+    FLIGHT_LOG_FIELD_PREDICTOR_SECOND_ORDER,
+};
+
+/*
+ * prev1 is the previous value of the field, prev2 and prev3 the ones before that. Right after an I-frame the
+ * missing history is taken to be the I-frame value.
+ */
+int32_t blackboxPredict(FlightLogFieldPredictor predictor, int32_t prev1, int32_t prev2, int32_t prev3)
+{
+    switch (predictor) {
+    case FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2:
+        return (prev1 + prev2) / 2;
+    case FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE:
+        return 2 * prev1 - prev2;
+    case FLIGHT_LOG_FIELD_PREDICTOR_SECOND_ORDER:
+        return 3 * (prev1 - prev2) + prev3;
+    default:
+        return prev1;
+    }
+}
+
+// Signed VB writes 7 bits per byte
+static const uint16_t signedVBCost[33] = {
+    8, 8, 8, 8, 8, 8, 8, 8,
+    16, 16, 16, 16, 16, 16, 16,
+    24, 24, 24, 24, 24, 24, 24,
+    32, 32, 32, 32, 32, 32, 32,
+    40, 40, 40, 40,
+};
+
+// Tag8_4S16 writes zero in no bits, then a nibble, a byte or 16 bits, and two bits of tag for every field
+static const uint16_t tag8_4S16Cost[33] = {
+    2, 6, 6, 6, 6, 10, 10, 10, 10,
+    18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+};
+
+void blackboxPredictorSelectorInit(blackboxPredictorSelector_t *selector, FlightLogFieldPredictor predictor, FlightLogFieldEncoding encoding)
+{
+    selector->residualCost = encoding == FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 ? tag8_4S16Cost : signedVBCost;
+    selector->predictor = 0;
+    for (int i = 0; i < BLACKBOX_ADAPTIVE_PREDICTOR_COUNT; i++) {
+        selector->cost[i] = 0;
+        if (adaptivePredictors[i] == predictor) {
+            selector->predictor = i;
+        }
+    }
+}
+
+// Number of bits in the zig-zag encoded residual, 0 for a zero residual
+static int residualBits(int32_t residual)
+{
+    const uint32_t zigzag = ((uint32_t)residual << 1) ^ (uint32_t)(residual >> 31);
+    return zigzag ? 32 - __builtin_clz(zigzag) : 0;
+}
+
+/*
+ * Return the residual of value for the predictor in use, and add what every candidate would have cost.
+ * The candidates are unrolled, this runs for every adaptive field of every P-frame.
+ */
+int32_t blackboxPredictorResidual(blackboxPredictorSelector_t *selector, int32_t value, int32_t prev1, int32_t prev2, int32_t prev3)
+{
+    int32_t residual[BLACKBOX_ADAPTIVE_PREDICTOR_COUNT];
+    residual[0] = value - prev1;
+    residual[1] = value - (prev1 + prev2) / 2;
+    residual[2] = value - (2 * prev1 - prev2);
+    residual[3] = value - (3 * (prev1 - prev2) + prev3);
+
+    selector->cost[0] += selector->residualCost[residualBits(residual[0])];
+    selector->cost[1] += selector->residualCost[residualBits(residual[1])];
+    selector->cost[2] += selector->residualCost[residualBits(residual[2])];
+    selector->cost[3] += selector->residualCost[residualBits(residual[3])];
+
+    return residual[selector->predictor];
+}
+
+/*
+ * Switch to the candidate that was cheapest since the last call, staying with the current one on a tie,
+ * and start costing afresh.
+ */
+FlightLogFieldPredictor blackboxPredictorSelect(blackboxPredictorSelector_t *selector)
+{
+    int best = selector->predictor;
+    for (int i = 0; i < BLACKBOX_ADAPTIVE_PREDICTOR_COUNT; i++) {
+        if (selector->cost[i] < selector->cost[best]) {
+            best = i;
+        }
+    }
+    selector->predictor = best;
+
+    for (int i = 0; i < BLACKBOX_ADAPTIVE_PREDICTOR_COUNT; i++) {
+        selector->cost[i] = 0;
+    }
+
+    return adaptivePredictors[best];
+}
+
+FlightLogFieldPredictor blackboxPredictorCurrent(const blackboxPredictorSelector_t *selector)
+{
+    return adaptivePredictors[selector->predictor];
+}
+
+#endif // BLACKBOX
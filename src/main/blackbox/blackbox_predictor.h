@@ -0,0 +1,50 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "blackbox/blackbox.h"
+#include "blackbox/blackbox_fielddefs.h"
+
+/*
+ * Adaptive P-frame predictors.
+ *
+ * While a predictor is in use for a field group, the residuals every candidate predictor would have given
+ * are costed as well, by what the group's encoding would take to write them. At each I-frame the group switches to the cheapest candidate, and the choice is
+ * logged as a FLIGHT_LOG_EVENT_PREDICTORS event so that decoders apply the same predictor.
+ */
+
+#define BLACKBOX_ADAPTIVE_PREDICTOR_COUNT 4
+
+typedef struct blackboxPredictorSelector_s {
+    uint32_t cost[BLACKBOX_ADAPTIVE_PREDICTOR_COUNT];   // what the residuals of each candidate would have cost to write
+    const uint16_t *residualCost;                        // cost of a residual, by bit length of its zig-zag encoding
+    uint8_t predictor;                                  // index of the candidate in use
+} blackboxPredictorSelector_t;
+
+int32_t blackboxPredict(FlightLogFieldPredictor predictor, int32_t prev1, int32_t prev2, int32_t prev3);
+
+void blackboxPredictorSelectorInit(blackboxPredictorSelector_t *selector, FlightLogFieldPredictor predictor, FlightLogFieldEncoding encoding);
+int32_t blackboxPredictorResidual(blackboxPredictorSelector_t *selector, int32_t value, int32_t prev1, int32_t prev2, int32_t prev3);
+FlightLogFieldPredictor blackboxPredictorSelect(blackboxPredictorSelector_t *selector);
+FlightLogFieldPredictor blackboxPredictorCurrent(const blackboxPredictorSelector_t *selector);
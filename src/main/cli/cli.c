@@ -35,6 +35,7 @@ bool cliMode = false;
 #ifdef USE_CLI
 
 #include "blackbox/blackbox.h"
+#include "blackbox/blackbox_file.h"
 
 #include "build/build_config.h"
 #include "build/debug.h"
@@ -99,6 +100,7 @@ bool cliMode = false;
 #include "fc/board_info.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/latency_trace.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -158,6 +160,7 @@ bool cliMode = false;
 #include "rx/rx_spi.h"
 
 #include "scheduler/scheduler.h"
+#include "scheduler/scheduler_trace.h"
 
 #include "sensors/acceleration.h"
 #include "sensors/adcinternal.h"
@@ -194,6 +197,10 @@ static uint32_t bufferIndex = 0;
 
 static bool configIsInCopy = false;
 
+#ifdef USE_CLI_SETTING_NAME_INDEX
+static bool settingNameIndexBuilt = false;
+#endif
+
 #define CURRENT_PROFILE_INDEX -1
 static int8_t pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
 static int8_t rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
@@ -2453,6 +2460,15 @@ static void cliSdInfo(const char *cmdName, char *cmdline)
         break;
     }
     cliPrintLinefeed();
+
+    const afatfsCacheStats_t *cacheStats = afatfs_getCacheStats();
+
+    cliPrintLinef("Cache: %u hits, %u misses, %u flushes, %u coalesced writes",
+        cacheStats->hits,
+        cacheStats->misses,
+        cacheStats->flushes,
+        cacheStats->coalescedWrites
+    );
 }
 
 #endif
@@ -4523,6 +4539,70 @@ static uint8_t getWordLength(char *bufBegin, char *bufEnd)
     return bufEnd - bufBegin;
 }
 
+#ifdef USE_CLI_SETTING_NAME_INDEX
+static int settingNameCompare(uint16_t a, uint16_t b)
+{
+    return strcasecmp(valueTable[a].name, valueTable[b].name);
+}
+
+static void buildSettingNameIndex(void)
+{
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        valueTableNameIndex[i] = i;
+    }
+
+    // shell sort in place, with the gaps 1, 4, 13, 40... it is much smaller than qsort() and quick enough for a few hundred names
+    unsigned gap = 1;
+    while (gap < valueTableEntryCount / 3) {
+        gap = gap * 3 + 1;
+    }
+
+    for (; gap > 0; gap /= 3) {
+        for (unsigned i = gap; i < valueTableEntryCount; i++) {
+            const uint16_t index = valueTableNameIndex[i];
+            unsigned j = i;
+
+            while (j >= gap && settingNameCompare(valueTableNameIndex[j - gap], index) > 0) {
+                valueTableNameIndex[j] = valueTableNameIndex[j - gap];
+                j -= gap;
+            }
+            valueTableNameIndex[j] = index;
+        }
+    }
+
+    settingNameIndexBuilt = true;
+}
+
+uint16_t cliGetSettingIndex(char *name, uint8_t length)
+{
+    // pasting a diff looks up every line, so binary search the settings by name rather than scanning them all
+    if (!settingNameIndexBuilt) {
+        buildSettingNameIndex();
+    }
+
+    int lo = 0;
+    int hi = valueTableEntryCount - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const char *settingName = valueTable[valueTableNameIndex[mid]].name;
+
+        // ensure exact match when setting to prevent setting variables with shorter names
+        int result = strncasecmp(name, settingName, length);
+        if (result == 0 && settingName[length] != '\0') {
+            result = -1;
+        }
+
+        if (result == 0) {
+            return valueTableNameIndex[mid];
+        } else if (result < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return valueTableEntryCount;
+}
+#else
 uint16_t cliGetSettingIndex(char *name, uint8_t length)
 {
     for (uint32_t i = 0; i < valueTableEntryCount; i++) {
@@ -4535,6 +4615,7 @@ uint16_t cliGetSettingIndex(char *name, uint8_t length)
     }
     return valueTableEntryCount;
 }
+#endif
 
 STATIC_UNIT_TESTED void cliSet(const char *cmdName, char *cmdline)
 {
@@ -4895,6 +4976,13 @@ static void cliStatus(const char *cmdName, char *cmdline)
     cliSdInfo(cmdName, "");
 #endif
 
+#ifdef USE_BLACKBOX_FILE
+    if (blackboxConfig()->device == BLACKBOX_DEVICE_FILE) {
+        // bytes the writer thread could not keep up with, since boot
+        cliPrintLinef("Blackbox file: %u bytes dropped", blackboxFileDroppedBytes());
+    }
+#endif
+
     cliPrint("Arming disable flags:");
     armingDisableFlags_e flags = getArmingDisableFlags();
     while (flags) {
@@ -4905,12 +4993,70 @@ static void cliStatus(const char *cmdName, char *cmdline)
     cliPrintLinefeed();
 }
 
+#ifdef USE_TASK_HISTOGRAMS
+static void cliPrintTaskHistogram(const char *prefix, const taskHistogramInfo_t *histogramInfo)
+{
+    cliPrintf("%s %8u", prefix, histogramInfo->count);
+    for (int i = 0; i < TASK_HISTOGRAM_PERCENTILE_COUNT; i++) {
+        cliPrintf(" %6u", histogramInfo->percentileUs[i]);
+    }
+    cliPrintLinef(" %6u %6u", histogramInfo->maxUs, histogramInfo->lateGyroCycles);
+}
+
+static void cliTaskHistograms(const char *cmdName, char *cmdline)
+{
+    if (strcasecmp(cmdline, "on") == 0) {
+        schedulerSetTaskHistograms(true);
+        return;
+    } else if (strcasecmp(cmdline, "off") == 0) {
+        schedulerSetTaskHistograms(false);
+        return;
+    } else if (strcasecmp(cmdline, "reset") == 0) {
+        schedulerResetTaskHistograms();
+        return;
+    } else if (!isEmpty(cmdline)) {
+        cliShowParseError(cmdName);
+        return;
+    }
+
+    if (!schedulerGetTaskHistograms()) {
+        cliPrintLine("Task histograms are off, enable with 'tasks hist on'");
+        return;
+    }
+
+    cliPrintLine("Task histograms/us         count    p50    p90    p99  p99.9    max   late");
+    for (taskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        taskInfo_t taskInfo;
+        getTaskInfo(taskId, &taskInfo);
+        if (taskInfo.isEnabled) {
+            char prefix[32];
+            taskHistogramInfo_t histogramInfo;
+            getTaskHistogramInfo(taskId, false, &histogramInfo);
+            tfp_sprintf(prefix, "%02d - (%15s)", taskId, taskInfo.taskName);
+            cliPrintTaskHistogram(prefix, &histogramInfo);
+            if (getTaskHistogramInfo(taskId, true, &histogramInfo)) {
+                cliPrintTaskHistogram("     (          check)", &histogramInfo);
+            }
+        }
+    }
+}
+#endif
+
 static void cliTasks(const char *cmdName, char *cmdline)
 {
-    UNUSED(cmdName);
-    UNUSED(cmdline);
     int averageLoadSum = 0;
 
+#ifdef USE_TASK_HISTOGRAMS
+    if (strncasecmp(cmdline, "hist", 4) == 0) {
+        cliTaskHistograms(cmdName, skipSpace(cmdline + 4));
+        return;
+    }
+#endif
+    if (!isEmpty(cmdline)) {
+        cliShowParseError(cmdName);
+        return;
+    }
+
 #ifndef MINIMAL_CLI
     if (systemConfig()->task_statistics) {
 #if defined(USE_LATE_TASK_STATISTICS)
@@ -4967,6 +5113,85 @@ static void cliTasks(const char *cmdName, char *cmdline)
     }
 }
 
+#ifdef USE_LATENCY_TRACE
+static void cliLatency(const char *cmdName, char *cmdline)
+{
+    if (strcasecmp(cmdline, "reset") == 0) {
+        latencyTraceReset();
+        return;
+    } else if (!isEmpty(cmdline)) {
+        cliShowParseError(cmdName);
+        return;
+    }
+
+    cliPrintLine("Latency/us     count     p50     p99     max    mean");
+    for (latencyStage_e stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        const histogram_t *histogram = latencyTraceHistogram(stage);
+        const uint32_t p50 = histogramPercentile(histogram, 50);
+        const uint32_t p99 = histogramPercentile(histogram, 99);
+        const uint32_t mean = histogramMean(histogram);
+        cliPrintLinef("%6s %13u %5u.%1u %5u.%1u %5u.%1u %5u.%1u", latencyTraceStageName(stage), histogram->count,
+            p50 / 10, p50 % 10, p99 / 10, p99 % 10, histogram->max / 10, histogram->max % 10, mean / 10, mean % 10);
+    }
+}
+#endif
+
+#ifdef USE_SCHEDULER_TRACE
+#define CLI_TRACE_LINE_BYTES 32
+
+static uint8_t traceLine[CLI_TRACE_LINE_BYTES];
+static int traceLineLength;
+
+// Dumped as hex lines prefixed "trace:", which src/utils/scheduler_trace.py reads back
+static void cliTraceFlush(void)
+{
+    if (traceLineLength) {
+        cliPrint("trace:");
+        for (int i = 0; i < traceLineLength; i++) {
+            cliPrintf("%02x", traceLine[i]);
+        }
+        cliPrintLinefeed();
+        traceLineLength = 0;
+    }
+}
+
+static void cliTraceWrite(const uint8_t *data, int length)
+{
+    while (length--) {
+        traceLine[traceLineLength++] = *data++;
+        if (traceLineLength == CLI_TRACE_LINE_BYTES) {
+            cliTraceFlush();
+        }
+    }
+}
+
+static void cliTrace(const char *cmdName, char *cmdline)
+{
+    static const char * const traceStateNames[] = { "STOPPED", "RUNNING", "ARMED", "TRIGGERED" };
+
+    if (strcasecmp(cmdline, "start") == 0) {
+        schedulerTraceStart(false);
+    } else if (strcasecmp(cmdline, "start late") == 0) {
+        schedulerTraceStart(true);
+    } else if (strcasecmp(cmdline, "stop") == 0) {
+        schedulerTraceStop();
+    } else if (strcasecmp(cmdline, "dump") == 0) {
+        schedulerTraceStop();
+        schedulerTraceWriteHeader(cliTraceWrite);
+        for (int i = 0; i < schedulerTraceEventCount(); i++) {
+            schedulerTraceWriteEvent(cliTraceWrite, schedulerTraceGetEvent(i));
+        }
+        cliTraceFlush();
+        return;
+    } else if (!isEmpty(cmdline)) {
+        cliShowParseError(cmdName);
+        return;
+    }
+
+    cliPrintLinef("Scheduler trace %s, %d events", traceStateNames[schedulerTraceGetState()], schedulerTraceEventCount());
+}
+#endif
+
 static void printVersion(const char *cmdName, bool printBoardInfo)
 {
 #if !(defined(USE_CUSTOM_DEFAULTS) && defined(USE_UNIFIED_TARGET))
@@ -6565,6 +6790,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("gyroregisters", "dump gyro config registers contents", NULL, cliDumpGyroRegisters),
 #endif
     CLI_COMMAND_DEF("help", "display command help", "[search string]", cliHelp),
+#ifdef USE_LATENCY_TRACE
+    CLI_COMMAND_DEF("latency", "show gyro to motor latency", "[reset]", cliLatency),
+#endif
 #ifdef USE_LED_STRIP_STATUS_MODE
         CLI_COMMAND_DEF("led", "configure leds", NULL, cliLed),
 #endif
@@ -6630,7 +6858,14 @@ const clicmd_t cmdTable[] = {
         "\treverse <servo> <source> r|n", cliServoMix),
 #endif
     CLI_COMMAND_DEF("status", "show status", NULL, cliStatus),
+#ifdef USE_TASK_HISTOGRAMS
+    CLI_COMMAND_DEF("tasks", "show task stats", "[hist [on|off|reset]]", cliTasks),
+#else
     CLI_COMMAND_DEF("tasks", "show task stats", NULL, cliTasks),
+#endif
+#ifdef USE_SCHEDULER_TRACE
+    CLI_COMMAND_DEF("trace", "record scheduler events", "[start [late]|stop|dump]", cliTrace),
+#endif
 #ifdef USE_TIMER_MGMT
     CLI_COMMAND_DEF("timer", "show/set timers", "<> | <pin> list | <pin> [af<alternate function>|none|<option(deprecated)>] | list | show", cliTimer),
 #endif
@@ -26,6 +26,7 @@
 #include "build/debug.h"
 
 #include "blackbox/blackbox.h"
+#include "blackbox/blackbox_block.h"
 #include "blackbox/blackbox_fielddefs.h"
 
 #include "cms/cms.h"
@@ -217,7 +218,10 @@ static const char * const lookupTableGimbalMode[] = {
 
 #ifdef USE_BLACKBOX
 static const char * const lookupTableBlackboxDevice[] = {
-    "NONE", "SPIFLASH", "SDCARD", "SERIAL"
+    "NONE", "SPIFLASH", "SDCARD", "SERIAL",
+#ifdef USE_BLACKBOX_FILE
+    "FILE",
+#endif
 };
 
 static const char * const lookupTableBlackboxMode[] = {
@@ -491,6 +495,10 @@ const char * const lookupTableOsdDisplayPortDevice[] = {
     "NONE", "AUTO", "MAX7456", "MSP", "FRSKYOSD"
 };
 
+static const char * const lookupTableSchedulerMode[] = {
+    "PRIORITY", "DEADLINE",
+};
+
 #ifdef USE_OSD
 static const char * const lookupTableOsdLogoOnArming[] = {
     "OFF", "ON", "FIRST_ARMING",
@@ -640,6 +648,7 @@ const lookupTableEntry_t lookupTables[] = {
     LOOKUP_TABLE_ENTRY(lookupTableFeedforwardAveraging),
     LOOKUP_TABLE_ENTRY(lookupTableDshotBitbangedTimer),
     LOOKUP_TABLE_ENTRY(lookupTableOsdDisplayPortDevice),
+    LOOKUP_TABLE_ENTRY(lookupTableSchedulerMode),
 
 #ifdef USE_OSD
     LOOKUP_TABLE_ENTRY(lookupTableOsdLogoOnArming),
@@ -838,6 +847,19 @@ const clivalue_t valueTable[] = {
     { "blackbox_disable_gps",       VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = FLIGHT_LOG_FIELD_SELECT_GPS,   PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, fields_disabled_mask) },
 #endif
     { "blackbox_mode",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, mode) },
+    { "blackbox_adaptive_predictors", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, adaptive_predictors) },
+#ifdef USE_BLACKBOX_BLOCK
+    { "blackbox_block_frames",      VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, BLACKBOX_BLOCK_MAX_FRAMES }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, block_frames) },
+#ifdef USE_HUFFMAN
+    { "blackbox_block_huffman",     VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, block_huffman) },
+#endif
+#endif
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    { "blackbox_gyro_capture_ms",   VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 10000 }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, gyro_capture_ms) },
+#ifdef USE_DSHOT_TELEMETRY
+    { "blackbox_gyro_capture_erpm", VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, gyro_capture_erpm) },
+#endif
+#endif
 #endif
 
 // PG_MOTOR_CONFIG
@@ -1691,6 +1713,7 @@ const clivalue_t valueTable[] = {
 
     { "scheduler_relax_rx",  VAR_UINT16  | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 500 }, PG_SCHEDULER_CONFIG, PG_ARRAY_ELEMENT_OFFSET(schedulerConfig_t, 0, rxRelaxDeterminism) },
     { "scheduler_relax_osd", VAR_UINT16  | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 500 }, PG_SCHEDULER_CONFIG, PG_ARRAY_ELEMENT_OFFSET(schedulerConfig_t, 0, osdRelaxDeterminism) },
+    { "scheduler_mode",      VAR_UINT8   | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SCHEDULER_MODE }, PG_SCHEDULER_CONFIG, PG_ARRAY_ELEMENT_OFFSET(schedulerConfig_t, 0, schedulerMode) },
 
 // PG_TIMECONFIG
 #ifdef USE_RTC_TIME
@@ -1737,4 +1760,9 @@ const clivalue_t valueTable[] = {
 
 const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
 
+#ifdef USE_CLI_SETTING_NAME_INDEX
+// valueTable indices sorted by setting name, filled in by the CLI the first time it looks a setting up
+uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
+#endif
+
 STATIC_ASSERT(LOOKUP_TABLE_COUNT == ARRAYLEN(lookupTables), LOOKUP_TABLE_COUNT_incorrect);
@@ -133,6 +133,7 @@ typedef enum {
     TABLE_FEEDFORWARD_AVERAGING,
     TABLE_DSHOT_BITBANGED_TIMER,
     TABLE_OSD_DISPLAYPORT_DEVICE,
+    TABLE_SCHEDULER_MODE,
 #ifdef USE_OSD
     TABLE_OSD_LOGO_ON_ARMING,
 #endif
@@ -236,6 +237,9 @@ extern const lookupTableEntry_t lookupTables[];
 extern const uint16_t valueTableEntryCount;
 
 extern const clivalue_t valueTable[];
+#ifdef USE_CLI_SETTING_NAME_INDEX
+extern uint16_t valueTableNameIndex[];
+#endif
 //extern const uint8_t lookupTablesEntryCount;
 
 extern const char * const lookupTableGyroHardware[];
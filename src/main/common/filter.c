@@ -25,12 +25,19 @@
 
 #include "platform.h"
 
+#include "common/axis.h"
 #include "common/filter.h"
 #include "common/maths.h"
 #include "common/utils.h"
 
 #define BIQUAD_Q 1.0f / sqrtf(2.0f)     /* quality factor - 2nd order butterworth*/
 
+// Use compiler vector extensions for the biquad bank where the FPU has SIMD lanes (SITL on x86, NEON),
+// USE_BIQUAD_BANK_SCALAR forces the path Cortex-M runs so it can be tested on the host
+#if defined(__GNUC__) && (defined(__SSE__) || defined(__ARM_NEON)) && !defined(USE_BIQUAD_BANK_SCALAR)
+#define USE_BIQUAD_BANK_VECTOR
+#endif
+
 // NULL filter
 
 FAST_CODE float nullFilterApply(filter_t *filter, float input)
@@ -267,6 +274,180 @@ FAST_CODE float biquadFilterApply(biquadFilter_t *filter, float input)
     return result;
 }
 
+// Notch coefficient table, replaces the sin/cos of biquadFilterUpdate() by a linear interpolation
+
+void biquadNotchTableInit(biquadNotchTable_t *table, float minHz, float maxHz, uint32_t refreshRate, float Q)
+{
+    table->minHz = minHz;
+    table->maxHz = MAX(maxHz, minHz + 1.0f);
+    table->stepsPerHz = (BIQUAD_NOTCH_TABLE_SIZE - 1) / (table->maxHz - table->minHz);
+
+    for (int i = 0; i < BIQUAD_NOTCH_TABLE_SIZE; i++) {
+        biquadFilter_t notch;
+        biquadFilterUpdate(&notch, table->minHz + i / table->stepsPerHz, refreshRate, Q, FILTER_NOTCH, 1.0f);
+        table->coeffs[i].b0 = notch.b0;
+        table->coeffs[i].b1 = notch.b1;
+        table->coeffs[i].a2 = notch.a2;
+    }
+}
+
+FAST_CODE void biquadNotchTableLookup(const biquadNotchTable_t *table, float filterFreq, biquadNotchCoeffs_t *coeffs)
+{
+    const float position = (constrainf(filterFreq, table->minHz, table->maxHz) - table->minHz) * table->stepsPerHz;
+    const int index = MIN((int)position, BIQUAD_NOTCH_TABLE_SIZE - 2);
+    const float fraction = position - index;
+
+    const biquadNotchCoeffs_t *lower = &table->coeffs[index];
+    const biquadNotchCoeffs_t *upper = &table->coeffs[index + 1];
+
+    coeffs->b0 = lower->b0 + (upper->b0 - lower->b0) * fraction;
+    coeffs->b1 = lower->b1 + (upper->b1 - lower->b1) * fraction;
+    coeffs->a2 = lower->a2 + (upper->a2 - lower->a2) * fraction;
+}
+
+// Biquad bank, one set of coefficients per section shared by all three axes
+
+void biquadBankInit(biquadBank_t *bank, biquadBankSection_t *sections, int count)
+{
+    bank->count = count;
+    bank->sections = sections;
+}
+
+void biquadBankSectionInit(biquadBankSection_t *section, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight)
+{
+    biquadBankSectionUpdate(section, filterFreq, refreshRate, Q, filterType, weight);
+
+    // zero initial samples
+    for (int lane = 0; lane < BIQUAD_BANK_LANES; lane++) {
+        section->x1[lane] = section->x2[lane] = 0;
+        section->y1[lane] = section->y2[lane] = 0;
+    }
+}
+
+FAST_CODE void biquadBankSectionUpdate(biquadBankSection_t *section, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight)
+{
+    biquadFilter_t coeffs;
+    biquadFilterUpdate(&coeffs, filterFreq, refreshRate, Q, filterType, weight);
+
+    section->b0 = coeffs.b0;
+    section->b1 = coeffs.b1;
+    section->b2 = coeffs.b2;
+    section->a1 = coeffs.a1;
+    section->a2 = coeffs.a2;
+    section->weight = coeffs.weight;
+}
+
+FAST_CODE void biquadBankSectionUpdateNotch(biquadBankSection_t *section, const biquadNotchTable_t *table, float filterFreq, float weight)
+{
+    biquadNotchCoeffs_t coeffs;
+    biquadNotchTableLookup(table, filterFreq, &coeffs);
+
+    section->b0 = coeffs.b0;
+    section->b1 = coeffs.b1;
+    section->b2 = coeffs.b0;
+    section->a1 = coeffs.b1;
+    section->a2 = coeffs.a2;
+    section->weight = weight;
+}
+
+/* Applies every section of the bank in series to xyz[], axis by axis. Same arithmetic as biquadFilterApplyDF1Weighted() */
+void biquadBankApplyDF1WeightedReference(biquadBank_t *bank, float *xyz)
+{
+    for (int i = 0; i < bank->count; i++) {
+        biquadBankSection_t *section = &bank->sections[i];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float input = xyz[axis];
+            const float result = section->b0 * input + section->b1 * section->x1[axis] + section->b2 * section->x2[axis]
+                - section->a1 * section->y1[axis] - section->a2 * section->y2[axis];
+
+            section->x2[axis] = section->x1[axis];
+            section->x1[axis] = input;
+
+            section->y2[axis] = section->y1[axis];
+            section->y1[axis] = result;
+
+            xyz[axis] = section->weight * result + (1 - section->weight) * input;
+        }
+    }
+}
+
+#ifdef USE_BIQUAD_BANK_VECTOR
+typedef float biquadBankVector_t __attribute__((vector_size(BIQUAD_BANK_LANES * sizeof(float)), aligned(4)));
+
+/* Applies the bank with all axes in one vector, the unused fourth lane stays at zero */
+FAST_CODE void biquadBankApplyDF1Weighted(biquadBank_t *bank, float *xyz)
+{
+    biquadBankVector_t value = { xyz[X], xyz[Y], xyz[Z], 0.0f };
+
+    for (int i = 0; i < bank->count; i++) {
+        biquadBankSection_t *section = &bank->sections[i];
+        biquadBankVector_t *x1 = (biquadBankVector_t *)section->x1;
+        biquadBankVector_t *x2 = (biquadBankVector_t *)section->x2;
+        biquadBankVector_t *y1 = (biquadBankVector_t *)section->y1;
+        biquadBankVector_t *y2 = (biquadBankVector_t *)section->y2;
+
+        const biquadBankVector_t result = section->b0 * value + section->b1 * *x1 + section->b2 * *x2 - section->a1 * *y1 - section->a2 * *y2;
+
+        *x2 = *x1;
+        *x1 = value;
+
+        *y2 = *y1;
+        *y1 = result;
+
+        value = section->weight * result + (1 - section->weight) * value;
+    }
+
+    xyz[X] = value[X];
+    xyz[Y] = value[Y];
+    xyz[Z] = value[Z];
+}
+#else
+/* Applies the bank with the coefficients of each section loaded once for all three axes */
+FAST_CODE void biquadBankApplyDF1Weighted(biquadBank_t *bank, float *xyz)
+{
+    float x = xyz[X];
+    float y = xyz[Y];
+    float z = xyz[Z];
+
+    for (int i = 0; i < bank->count; i++) {
+        biquadBankSection_t *section = &bank->sections[i];
+        const float b0 = section->b0;
+        const float b1 = section->b1;
+        const float b2 = section->b2;
+        const float a1 = section->a1;
+        const float a2 = section->a2;
+        const float weight = section->weight;
+
+        // three independent dependency chains, lets the FPU pipeline overlap the axes
+        const float resultX = b0 * x + b1 * section->x1[X] + b2 * section->x2[X] - a1 * section->y1[X] - a2 * section->y2[X];
+        const float resultY = b0 * y + b1 * section->x1[Y] + b2 * section->x2[Y] - a1 * section->y1[Y] - a2 * section->y2[Y];
+        const float resultZ = b0 * z + b1 * section->x1[Z] + b2 * section->x2[Z] - a1 * section->y1[Z] - a2 * section->y2[Z];
+
+        section->x2[X] = section->x1[X];
+        section->x2[Y] = section->x1[Y];
+        section->x2[Z] = section->x1[Z];
+        section->x1[X] = x;
+        section->x1[Y] = y;
+        section->x1[Z] = z;
+
+        section->y2[X] = section->y1[X];
+        section->y2[Y] = section->y1[Y];
+        section->y2[Z] = section->y1[Z];
+        section->y1[X] = resultX;
+        section->y1[Y] = resultY;
+        section->y1[Z] = resultZ;
+
+        x = weight * resultX + (1 - weight) * x;
+        y = weight * resultY + (1 - weight) * y;
+        z = weight * resultZ + (1 - weight) * z;
+    }
+
+    xyz[X] = x;
+    xyz[Y] = y;
+    xyz[Z] = z;
+}
+#endif
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf)
 {
     filter->movingWindowIndex = 0;
@@ -55,6 +55,40 @@ typedef struct biquadFilter_s {
     float weight;
 } biquadFilter_t;
 
+/* bank of biquad sections applied in series to all three gyro axes at once.
+ * Coefficients are stored once per section, the DF1 state of each axis is kept
+ * side by side (padded to a vector of four lanes) so one pass filters all axes */
+#define BIQUAD_BANK_LANES 4
+
+typedef struct biquadBankSection_s {
+    float x1[BIQUAD_BANK_LANES];
+    float x2[BIQUAD_BANK_LANES];
+    float y1[BIQUAD_BANK_LANES];
+    float y2[BIQUAD_BANK_LANES];
+    float b0, b1, b2, a1, a2;
+    float weight;
+} biquadBankSection_t;
+
+typedef struct biquadBank_s {
+    int count;
+    biquadBankSection_t *sections;
+} biquadBank_t;
+
+/* notch coefficients precomputed over a frequency range for a fixed refresh rate and Q,
+ * for a notch b2 == b0 and a1 == b1 so three values per entry are enough */
+#define BIQUAD_NOTCH_TABLE_SIZE 128
+
+typedef struct biquadNotchCoeffs_s {
+    float b0, b1, a2;
+} biquadNotchCoeffs_t;
+
+typedef struct biquadNotchTable_s {
+    float minHz;
+    float maxHz;
+    float stepsPerHz;
+    biquadNotchCoeffs_t coeffs[BIQUAD_NOTCH_TABLE_SIZE];
+} biquadNotchTable_t;
+
 typedef struct laggedMovingAverage_s {
     uint16_t movingWindowIndex;
     uint16_t windowSize;
@@ -90,6 +124,16 @@ float biquadFilterApplyDF1Weighted(biquadFilter_t *filter, float input);
 float biquadFilterApply(biquadFilter_t *filter, float input);
 float filterGetNotchQ(float centerFreq, float cutoffFreq);
 
+void biquadNotchTableInit(biquadNotchTable_t *table, float minHz, float maxHz, uint32_t refreshRate, float Q);
+void biquadNotchTableLookup(const biquadNotchTable_t *table, float filterFreq, biquadNotchCoeffs_t *coeffs);
+
+void biquadBankInit(biquadBank_t *bank, biquadBankSection_t *sections, int count);
+void biquadBankSectionInit(biquadBankSection_t *section, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight);
+void biquadBankSectionUpdate(biquadBankSection_t *section, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType, float weight);
+void biquadBankSectionUpdateNotch(biquadBankSection_t *section, const biquadNotchTable_t *table, float filterFreq, float weight);
+void biquadBankApplyDF1Weighted(biquadBank_t *bank, float *xyz);
+void biquadBankApplyDF1WeightedReference(biquadBank_t *bank, float *xyz);
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
 float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
 
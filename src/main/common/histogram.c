@@ -0,0 +1,161 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/histogram.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#define HISTOGRAM_LINEAR_BITS   4   // log2(HISTOGRAM_LINEAR_BUCKETS)
+#define HISTOGRAM_SUB_BITS      3   // log2(HISTOGRAM_SUB_BUCKETS)
+
+STATIC_ASSERT((1 << HISTOGRAM_LINEAR_BITS) == HISTOGRAM_LINEAR_BUCKETS, histogram_linear_bits);
+STATIC_ASSERT((1 << HISTOGRAM_SUB_BITS) == HISTOGRAM_SUB_BUCKETS, histogram_sub_bits);
+
+void histogramReset(histogram_t *histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+int histogramBucket(uint32_t value)
+{
+    if (value < HISTOGRAM_LINEAR_BUCKETS) {
+        return value;
+    }
+    if (value > HISTOGRAM_MAX_VALUE) {
+        return HISTOGRAM_BUCKET_COUNT - 1;
+    }
+
+    // position of the top bit selects the octave, the next HISTOGRAM_SUB_BITS bits the bucket within it
+    const int msb = 31 - __builtin_clz(value);
+    const int subBucket = (value >> (msb - HISTOGRAM_SUB_BITS)) & (HISTOGRAM_SUB_BUCKETS - 1);
+    return HISTOGRAM_LINEAR_BUCKETS + (msb - HISTOGRAM_LINEAR_BITS) * HISTOGRAM_SUB_BUCKETS + subBucket;
+}
+
+// Largest value counted in the bucket
+uint32_t histogramBucketUpperBound(int bucket)
+{
+    if (bucket < HISTOGRAM_LINEAR_BUCKETS) {
+        return bucket;
+    }
+
+    const int octave = (bucket - HISTOGRAM_LINEAR_BUCKETS) / HISTOGRAM_SUB_BUCKETS;
+    const int subBucket = (bucket - HISTOGRAM_LINEAR_BUCKETS) % HISTOGRAM_SUB_BUCKETS;
+    const int shift = octave + HISTOGRAM_LINEAR_BITS - HISTOGRAM_SUB_BITS;
+    return ((uint32_t)(HISTOGRAM_SUB_BUCKETS + subBucket + 1) << shift) - 1;
+}
+
+FAST_CODE void histogramAdd(histogram_t *histogram, uint32_t value)
+{
+    histogram->buckets[histogramBucket(value)]++;
+    histogram->count++;
+    histogram->sum += value;
+    if (value > histogram->max) {
+        histogram->max = value;
+    }
+}
+
+// Rank of the sample at the given fraction of count, rounded up so p100 is the largest sample
+static uint32_t histogramRank(uint32_t count, uint16_t permille)
+{
+    const uint32_t rank = ((uint64_t)count * permille + 999) / 1000;
+    return rank ? rank : 1;
+}
+
+// The last bucket also holds values out of range, its bound means nothing there
+static uint32_t histogramBucketValue(int bucket, uint32_t max)
+{
+    if (bucket == HISTOGRAM_BUCKET_COUNT - 1) {
+        return max;
+    }
+    return MIN(histogramBucketUpperBound(bucket), max);
+}
+
+// Upper bound of the bucket holding the given fraction (in 1/1000) of samples, never more than the largest value seen
+uint32_t histogramPermille(const histogram_t *histogram, uint16_t permille)
+{
+    if (histogram->count == 0) {
+        return 0;
+    }
+
+    const uint32_t rank = histogramRank(histogram->count, permille);
+    uint32_t seen = 0;
+    for (int bucket = 0; bucket < HISTOGRAM_BUCKET_COUNT; bucket++) {
+        seen += histogram->buckets[bucket];
+        if (seen >= rank) {
+            return histogramBucketValue(bucket, histogram->max);
+        }
+    }
+    return histogram->max;
+}
+
+uint32_t histogramPercentile(const histogram_t *histogram, uint8_t percent)
+{
+    return histogramPermille(histogram, percent * 10);
+}
+
+uint32_t histogramMean(const histogram_t *histogram)
+{
+    return histogram->count ? histogram->sum / histogram->count : 0;
+}
+
+void histogramCompactReset(histogramCompact_t *histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+FAST_CODE void histogramCompactAdd(histogramCompact_t *histogram, uint32_t value)
+{
+    const int bucket = histogramBucket(value);
+    if (histogram->buckets[bucket] == UINT16_MAX) {
+        // Round up so buckets holding only a rare outlier keep it
+        histogram->count = 0;
+        for (int ii = 0; ii < HISTOGRAM_BUCKET_COUNT; ii++) {
+            histogram->buckets[ii] = (histogram->buckets[ii] + 1) / 2;
+            histogram->count += histogram->buckets[ii];
+        }
+    }
+    histogram->buckets[bucket]++;
+    histogram->count++;
+    if (value > histogram->max) {
+        histogram->max = value;
+    }
+}
+
+uint32_t histogramCompactPermille(const histogramCompact_t *histogram, uint16_t permille)
+{
+    if (histogram->count == 0) {
+        return 0;
+    }
+
+    const uint32_t rank = histogramRank(histogram->count, permille);
+    uint32_t seen = 0;
+    for (int bucket = 0; bucket < HISTOGRAM_BUCKET_COUNT; bucket++) {
+        seen += histogram->buckets[bucket];
+        if (seen >= rank) {
+            return histogramBucketValue(bucket, histogram->max);
+        }
+    }
+    return histogram->max;
+}
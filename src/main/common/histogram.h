@@ -0,0 +1,62 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Log-linear histogram for timing statistics.
+// Values below HISTOGRAM_LINEAR_BUCKETS get a bucket each, above that every power of two is split into
+// HISTOGRAM_SUB_BUCKETS buckets, so percentiles are reported to within 1/HISTOGRAM_SUB_BUCKETS of the value.
+// Values above HISTOGRAM_MAX_VALUE are counted in the last bucket, max is always exact.
+
+#pragma once
+
+#include <stdint.h>
+
+#define HISTOGRAM_LINEAR_BUCKETS    16
+#define HISTOGRAM_SUB_BUCKETS       8
+#define HISTOGRAM_OCTAVES           12
+#define HISTOGRAM_BUCKET_COUNT      (HISTOGRAM_LINEAR_BUCKETS + HISTOGRAM_OCTAVES * HISTOGRAM_SUB_BUCKETS)
+#define HISTOGRAM_MAX_VALUE         ((HISTOGRAM_LINEAR_BUCKETS << HISTOGRAM_OCTAVES) - 1)
+
+typedef struct histogram_s {
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[HISTOGRAM_BUCKET_COUNT];
+} histogram_t;
+
+// Same bucket layout with 16 bit counts, for when many histograms are kept.
+// Rather than saturate, all buckets are halved when one is full, so the distribution of recent samples is kept.
+typedef struct histogramCompact_s {
+    uint32_t count;
+    uint32_t max;
+    uint16_t buckets[HISTOGRAM_BUCKET_COUNT];
+} histogramCompact_t;
+
+void histogramReset(histogram_t *histogram);
+void histogramAdd(histogram_t *histogram, uint32_t value);
+uint32_t histogramPercentile(const histogram_t *histogram, uint8_t percent);
+uint32_t histogramPermille(const histogram_t *histogram, uint16_t permille);
+uint32_t histogramMean(const histogram_t *histogram);
+
+void histogramCompactReset(histogramCompact_t *histogram);
+void histogramCompactAdd(histogramCompact_t *histogram, uint32_t value);
+uint32_t histogramCompactPermille(const histogramCompact_t *histogram, uint16_t permille);
+
+int histogramBucket(uint32_t value);
+uint32_t histogramBucketUpperBound(int bucket);
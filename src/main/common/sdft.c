@@ -32,10 +32,7 @@ static FAST_DATA_ZERO_INIT float     rPowerN;  // SDFT_R to the power of SDFT_SA
 static FAST_DATA_ZERO_INIT bool      isInitialized;
 static FAST_DATA_ZERO_INIT complex_t twiddle[SDFT_BIN_COUNT];
 
-static void applySqrt(const sdft_t *sdft, float *data);
-
-
-void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numBatches)
+static void initTwiddle(void)
 {
     if (!isInitialized) {
         rPowerN = powf(SDFT_R, SDFT_SAMPLE_SIZE);
@@ -47,6 +44,12 @@ void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numB
         }
         isInitialized = true;
     }
+}
+
+
+void sdftXYZInit(sdftXYZ_t *sdft, const int startBin, const int endBin, const int numBatches)
+{
+    initTwiddle();
 
     sdft->idx = 0;
 
@@ -58,102 +61,88 @@ void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numB
     sdft->batchSize = (sdft->endBin - sdft->startBin) / sdft->numBatches + 1;  // batchSize = ceil(numBins / numBatches)
 
     for (int i = 0; i < SDFT_SAMPLE_SIZE; i++) {
-        sdft->samples[i] = 0.0f;
+        for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+            sdft->samples[i][axis] = 0.0f;
+        }
     }
 
     for (int i = 0; i < SDFT_BIN_COUNT; i++) {
-        sdft->data[i] = 0.0f;
+        for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+            sdft->data[i][axis] = 0.0f;
+        }
     }
 }
 
 
-// Add new sample to frequency spectrum
-FAST_CODE void sdftPush(sdft_t *sdft, const float sample)
+// Rotate bins [binStart, binEnd) of all axes, one twiddle load serves the three axes
+static FAST_CODE void sdftXYZUpdateBins(sdftXYZ_t *sdft, const float *delta, const int binStart, const int binEnd)
 {
-    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
-    
-    sdft->samples[sdft->idx] = sample;
-    sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
+    const float delta0 = delta[0];
+    const float delta1 = delta[1];
+    const float delta2 = delta[2];
+
+    for (int i = binStart; i < binEnd; i++) {
+        const complex_t t = twiddle[i];
+        complex_t *bin = sdft->data[i];
+        bin[0] = t * (bin[0] + delta0);
+        bin[1] = t * (bin[1] + delta1);
+        bin[2] = t * (bin[2] + delta2);
+    }
+}
 
-    for (int i = sdft->startBin; i <= sdft->endBin; i++) {
-        sdft->data[i] = twiddle[i] * (sdft->data[i] + delta);
+
+// Add new sample of all axes to frequency spectrum
+FAST_CODE void sdftXYZPush(sdftXYZ_t *sdft, const float *sample)
+{
+    float delta[SDFT_AXIS_COUNT];
+
+    for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+        delta[axis] = sample[axis] - rPowerN * sdft->samples[sdft->idx][axis];
+        sdft->samples[sdft->idx][axis] = sample[axis];
     }
+    sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
+
+    sdftXYZUpdateBins(sdft, delta, sdft->startBin, sdft->endBin + 1);
 }
 
 
-// Add new sample to frequency spectrum in parts
-FAST_CODE void sdftPushBatch(sdft_t* sdft, const float sample, const int batchIdx)
+// Add new sample of all axes to frequency spectrum in parts
+FAST_CODE void sdftXYZPushBatch(sdftXYZ_t *sdft, const float *sample, const int batchIdx)
 {
     const int batchStart = sdft->batchSize * batchIdx;
     int batchEnd = batchStart;
 
-    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
+    float delta[SDFT_AXIS_COUNT];
+    for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+        delta[axis] = sample[axis] - rPowerN * sdft->samples[sdft->idx][axis];
+    }
 
     if (batchIdx == sdft->numBatches - 1) {
-        sdft->samples[sdft->idx] = sample;
+        for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+            sdft->samples[sdft->idx][axis] = sample[axis];
+        }
         sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
         batchEnd += sdft->endBin - batchStart + 1;
     } else {
         batchEnd += sdft->batchSize;
     }
 
-    for (int i = batchStart; i < batchEnd; i++) {
-        sdft->data[i] = twiddle[i] * (sdft->data[i] + delta);
-    }
+    sdftXYZUpdateBins(sdft, delta, batchStart, batchEnd);
 }
 
 
-// Get squared magnitude of frequency spectrum
-FAST_CODE void sdftMagSq(const sdft_t *sdft, float *output)
-{
-    float re;
-    float im;
-
-    for (int i = sdft->startBin; i <= sdft->endBin; i++) {
-        re = crealf(sdft->data[i]);
-        im = cimagf(sdft->data[i]);
-        output[i] = re * re + im * im;
-    }
-}
-
-
-// Get magnitude of frequency spectrum (slower)
-FAST_CODE void sdftMagnitude(const sdft_t *sdft, float *output)
-{
-    sdftMagSq(sdft, output);
-    applySqrt(sdft, output);
-}
-
-
-// Get squared magnitude of frequency spectrum with Hann window applied
+// Get squared magnitude of frequency spectrum with Hann window applied for one axis
 // Hann window in frequency domain: X[k] = -0.25 * X[k-1] +0.5 * X[k] -0.25 * X[k+1]
-FAST_CODE void sdftWinSq(const sdft_t *sdft, float *output)
+FAST_CODE void sdftXYZWinSq(const sdftXYZ_t *sdft, const int axis, float *output)
 {
     complex_t val;
     float re;
     float im;
 
     for (int i = (sdft->startBin + 1); i < sdft->endBin; i++) {
-        val = sdft->data[i] - 0.5f * (sdft->data[i - 1] + sdft->data[i + 1]); // multiply by 2 to save one multiplication
+        val = sdft->data[i][axis] - 0.5f * (sdft->data[i - 1][axis] + sdft->data[i + 1][axis]); // multiply by 2 to save one multiplication
         re = crealf(val);
         im = cimagf(val);
         output[i] = re * re + im * im;
     }
 }
-
-
-// Get magnitude of frequency spectrum with Hann window applied (slower)
-FAST_CODE void sdftWindow(const sdft_t *sdft, float *output)
-{
-    sdftWinSq(sdft, output);
-    applySqrt(sdft, output);
-}
-
-
-// Apply square root to the whole sdft range
-static FAST_CODE void applySqrt(const sdft_t *sdft, float *data)
-{
-    for (int i = sdft->startBin; i <= sdft->endBin; i++) {
-        data[i] = sqrtf(data[i]);
-    }
-}
@@ -28,25 +28,26 @@
 #undef I  // avoid collision of imaginary unit I with variable I in pid.h
 typedef float complex complex_t; // Better readability for type "float complex"
 
+#ifndef SDFT_SAMPLE_SIZE
 #define SDFT_SAMPLE_SIZE 72
+#endif
 #define SDFT_BIN_COUNT   (SDFT_SAMPLE_SIZE / 2)
+#define SDFT_AXIS_COUNT  3
 
-typedef struct sdft_s {
+// SDFT of all three gyro axes, with samples and bins interleaved so each twiddle factor is loaded once for all axes
+typedef struct sdftXYZ_s {
 
-    int idx;                           // circular buffer index
+    int idx;                                               // circular buffer index
     int startBin;
     int endBin;
     int batchSize;
     int numBatches;
-    float samples[SDFT_SAMPLE_SIZE];   // circular buffer
-    complex_t data[SDFT_BIN_COUNT];    // complex frequency spectrum
-
-} sdft_t;
-
-void sdftInit(sdft_t *sdft, const int startBin, const int endBin, const int numBatches);
-void sdftPush(sdft_t *sdft, const float sample);
-void sdftPushBatch(sdft_t *sdft, const float sample, const int batchIdx);
-void sdftMagSq(const sdft_t *sdft, float *output);
-void sdftMagnitude(const sdft_t *sdft, float *output);
-void sdftWinSq(const sdft_t *sdft, float *output);
-void sdftWindow(const sdft_t *sdft, float *output);
+    float samples[SDFT_SAMPLE_SIZE][SDFT_AXIS_COUNT];       // circular buffer
+    complex_t data[SDFT_BIN_COUNT][SDFT_AXIS_COUNT];        // complex frequency spectrum
+
+} sdftXYZ_t;
+
+void sdftXYZInit(sdftXYZ_t *sdft, const int startBin, const int endBin, const int numBatches);
+void sdftXYZPush(sdftXYZ_t *sdft, const float *sample);
+void sdftXYZPushBatch(sdftXYZ_t *sdft, const float *sample, const int batchIdx);
+void sdftXYZWinSq(const sdftXYZ_t *sdft, const int axis, float *output);
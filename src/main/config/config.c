@@ -95,6 +95,8 @@
 
 static bool configIsDirty; /* someone indicated that the config is modified and it is not yet saved */
 
+static uint32_t configChangeCount; /* bumped whenever the config is loaded, reset, saved, adjusted or switched to another profile */
+
 static bool rebootRequired = false;  // set if a config change requires a reboot to take effect
 
 static bool eepromWriteInProgress = false;
@@ -156,6 +158,7 @@ uint16_t getCurrentMinthrottle(void)
 void resetConfig(void)
 {
     pgResetAll();
+    setConfigChanged();
 
 #if defined(USE_TARGET_CONFIG)
     targetConfiguration();
@@ -734,6 +737,7 @@ bool readEEPROM(void)
     validateAndFixConfig();
 
     activateConfig();
+    setConfigChanged();
 
     resumeRxSignal();
 
@@ -750,6 +754,7 @@ void writeUnmodifiedConfigToEEPROM(void)
     eepromWriteInProgress = false;
     resumeRxSignal();
     configIsDirty = false;
+    setConfigChanged();
 }
 
 void writeEEPROM(void)
@@ -803,6 +808,7 @@ void saveConfigAndNotify(void)
 void setConfigDirty(void)
 {
     configIsDirty = true;
+    setConfigChanged();
 }
 
 bool isConfigDirty(void)
@@ -810,6 +816,17 @@ bool isConfigDirty(void)
     return configIsDirty;
 }
 
+// Anything which keeps state derived from the config can compare the count with the one it was derived at
+void setConfigChanged(void)
+{
+    configChangeCount++;
+}
+
+uint32_t getConfigChangeCount(void)
+{
+    return configChangeCount;
+}
+
 void changePidProfileFromCellCount(uint8_t cellCount)
 {
     if (currentPidProfile->auto_profile_cell_count == cellCount || currentPidProfile->auto_profile_cell_count == AUTO_PROFILE_CELL_COUNT_STAY) {
@@ -847,6 +864,7 @@ void changePidProfile(uint8_t pidProfileIndex)
         pidInit(currentPidProfile);
         initEscEndpoints();
         mixerInitProfile();
+        setConfigChanged();
     }
 
     beeperConfirmationBeeps(pidProfileIndex + 1);
@@ -71,6 +71,8 @@ void validateAndFixGyroConfig(void);
 
 void setConfigDirty(void);
 bool isConfigDirty(void);
+void setConfigChanged(void);
+uint32_t getConfigChangeCount(void);
 
 uint8_t getCurrentPidProfileIndex(void);
 void changePidProfile(uint8_t pidProfileIndex);
@@ -41,7 +41,7 @@
 #include "drivers/flash.h"
 #include "drivers/system.h"
 
-static uint16_t eepromConfigSize;
+static size_t eepromConfigSize;
 
 typedef enum {
     CR_CLASSICATION_SYSTEM   = 0,
@@ -52,10 +52,25 @@ typedef enum {
 #define CRC_START_VALUE         0xFFFF
 #define CRC_CHECK_VALUE         0x1D0F  // pre-calculated value of CRC that includes the CRC itself
 
+#define CONFIG_HEADER_MAGIC             0xBE
+#define CONFIG_CHANGES_HEADER_MAGIC     0xDE
+
+/*
+ * The EEPROM holds a block with all of the PGs, followed by a block for each save since then with just the PGs that
+ * changed in that save. When the EEPROM fills up, the PGs are all written out again in one block and the rest of it
+ * is erased. Each block has the same layout, header, records, footer and CRC, padded to the flash word size.
+ *
+ * Only flash can have the changes appended, other storage is rewritten on every save.
+ */
+#if defined(CONFIG_IN_FLASH) || defined(CONFIG_IN_FILE)
+#define CONFIG_APPEND_CHANGES
+#define CONFIG_ERASED_BYTE      0xFF
+#endif
+
 // Header for the saved copy.
 typedef struct {
     uint8_t eepromConfigVersion;
-    uint8_t magic_be;           // magic number, should be 0xBE
+    uint8_t magic_be;           // magic number, CONFIG_HEADER_MAGIC, or CONFIG_CHANGES_HEADER_MAGIC for a block of changes
 } PG_PACKED configHeader_t;
 
 // Header for each stored PG.
@@ -281,14 +296,21 @@ bool isEEPROMVersionValid(void)
     return true;
 }
 
-// Scan the EEPROM config. Returns true if the config is valid.
-bool isEEPROMStructureValid(void)
+// The size of a block in the EEPROM, including its padding to the flash word size
+static size_t paddedBlockSize(size_t size)
 {
-    const uint8_t *p = &__config_start;
+    return (size + CONFIG_STREAMER_BUFFER_SIZE - 1) / CONFIG_STREAMER_BUFFER_SIZE * CONFIG_STREAMER_BUFFER_SIZE;
+}
+
+// Scan the block of records starting at p, whose header should have the given magic number. Returns the size of the
+// block including its padding, or 0 if it is not valid.
+static size_t scanEEPROMBlock(const uint8_t *p, uint8_t magic)
+{
+    const uint8_t *blockStart = p;
     const configHeader_t *header = (const configHeader_t *)p;
 
-    if (header->magic_be != 0xBE) {
-        return false;
+    if (p + sizeof(*header) >= &__config_end || header->magic_be != magic) {
+        return 0;
     }
 
     uint16_t crc = CRC_START_VALUE;
@@ -298,6 +320,10 @@ bool isEEPROMStructureValid(void)
     for (;;) {
         const configRecord_t *record = (const configRecord_t *)p;
 
+        if (p + sizeof(configFooter_t) + sizeof(uint16_t) > &__config_end) {
+            // No room for the footer.
+            return 0;
+        }
         if (record->size == 0) {
             // Found the end.  Stop scanning.
             break;
@@ -305,7 +331,7 @@ bool isEEPROMStructureValid(void)
         if (p + record->size >= &__config_end
             || record->size < sizeof(*record)) {
             // Too big or too small.
-            return false;
+            return 0;
         }
 
         crc = crc16_ccitt_update(crc, p, record->size);
@@ -320,15 +346,39 @@ bool isEEPROMStructureValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
+    p += sizeof(*storedCrc);
+
+    // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
+    if (crc != CRC_CHECK_VALUE) {
+        return 0;
+    }
+
+    return paddedBlockSize(p - blockStart);
+}
+
+// Scan the EEPROM config. Returns true if the config is valid.
+bool isEEPROMStructureValid(void)
+{
+    const uint8_t *p = &__config_start;
+
+    size_t blockSize = scanEEPROMBlock(p, CONFIG_HEADER_MAGIC);
+    if (blockSize == 0) {
+        return false;
+    }
+
+    // The blocks of changes run up to the first block that is not valid, normally the erased flash after the last one.
+    // A block that was only partly written when the power went is ignored, along with the changes in it.
+    do {
+        p += blockSize;
+        blockSize = scanEEPROMBlock(p, CONFIG_CHANGES_HEADER_MAGIC);
+    } while (blockSize > 0);
 
     eepromConfigSize = p - &__config_start;
 
-    // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+    return true;
 }
 
-uint16_t getEEPROMConfigSize(void)
+size_t getEEPROMConfigSize(void)
 {
     return eepromConfigSize;
 }
@@ -347,26 +397,34 @@ size_t getEEPROMStorageSize(void)
 #endif
 }
 
-// find config record for reg + classification (profile info) in EEPROM
+// find the newest config record for reg + classification (profile info) in EEPROM
 // return NULL when record is not found
-// this function assumes that EEPROM content is valid
+// this function assumes that EEPROM content is valid, and has been scanned by isEEPROMStructureValid()
 static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
 {
-    const uint8_t *p = &__config_start;
-    p += sizeof(configHeader_t);             // skip header
-    while (true) {
-        const configRecord_t *record = (const configRecord_t *)p;
-        if (record->size == 0
-            || p + record->size >= &__config_end
-            || record->size < sizeof(*record))
-            break;
-        if (pgN(reg) == record->pgn
-            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
-            return record;
-        p += record->size;
+    const configRecord_t *found = NULL;
+    const uint8_t *blockStart = &__config_start;
+
+    // Each block has newer copies of the records in it than the blocks before it
+    while (blockStart < &__config_start + eepromConfigSize) {
+        const uint8_t *p = blockStart + sizeof(configHeader_t);  // skip header
+        while (true) {
+            const configRecord_t *record = (const configRecord_t *)p;
+            if (record->size == 0
+                || p + record->size >= &__config_end
+                || record->size < sizeof(*record))
+                break;
+            if (pgN(reg) == record->pgn
+                && (record->flags & CR_CLASSIFICATION_MASK) == classification)
+                found = record;
+            p += record->size;
+        }
+        p += sizeof(configFooter_t) + sizeof(uint16_t);  // skip footer and CRC
+
+        blockStart += paddedBlockSize(p - blockStart);
     }
-    // record not found
-    return NULL;
+
+    return found;
 }
 
 // Initialize all PG records from EEPROM.
@@ -393,22 +451,87 @@ bool loadEEPROM(void)
     return success;
 }
 
-static bool writeSettingsToEEPROM(void)
+// More PGs than any target registers, a registry larger than this has its config rewritten in full on every save
+#define CONFIG_MAX_CHANGED_PGS 256
+
+// One bit per PG, in registry order
+typedef struct changedPGs_s {
+    uint32_t bits[CONFIG_MAX_CHANGED_PGS / 32];
+} changedPGs_t;
+
+#ifdef CONFIG_APPEND_CHANGES
+static bool isPGInSet(const changedPGs_t *changed, const pgRegistry_t *reg)
 {
-    config_streamer_t streamer;
-    config_streamer_init(&streamer);
+    const unsigned index = reg - __pg_registry_start;
 
-    config_streamer_start(&streamer, (uintptr_t)&__config_start, &__config_end - &__config_start);
+    return changed->bits[index / 32] & (1U << (index % 32));
+}
+
+// Does the PG in RAM differ from its newest copy in the EEPROM?
+static bool isPGChanged(const pgRegistry_t *reg)
+{
+    const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+
+    return !rec
+        || rec->version != pgVersion(reg)
+        || rec->size != sizeof(configRecord_t) + pgSize(reg)
+        || memcmp(rec->pg, reg->address, pgSize(reg)) != 0;
+}
+
+// Find the PGs which have changed, each takes a search of the whole EEPROM. Returns the size of the block they need,
+// or 0 if none have.
+static size_t findChangedPGs(changedPGs_t *changed)
+{
+    size_t recordsSize = 0;
+
+    memset(changed, 0, sizeof(*changed));
+    PG_FOREACH(reg) {
+        if (isPGChanged(reg)) {
+            const unsigned index = reg - __pg_registry_start;
+            changed->bits[index / 32] |= 1U << (index % 32);
+            recordsSize += sizeof(configRecord_t) + pgSize(reg);
+        }
+    }
 
+    if (recordsSize == 0) {
+        return 0;
+    }
+
+    return paddedBlockSize(sizeof(configHeader_t) + recordsSize + sizeof(configFooter_t) + sizeof(uint16_t));
+}
+
+static bool isEEPROMErased(const uint8_t *p, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        if (p[i] != CONFIG_ERASED_BYTE) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+// Write a block with all of the PGs to the streamer, or if changedOnly is given, just the PGs in it
+static void writeEEPROMBlock(config_streamer_t *streamer, uint8_t magic, const changedPGs_t *changedOnly)
+{
     configHeader_t header = {
         .eepromConfigVersion =  EEPROM_CONF_VERSION,
-        .magic_be =             0xBE,
+        .magic_be =             magic,
     };
 
-    config_streamer_write(&streamer, (uint8_t *)&header, sizeof(header));
+    config_streamer_write(streamer, (uint8_t *)&header, sizeof(header));
     uint16_t crc = CRC_START_VALUE;
     crc = crc16_ccitt_update(crc, (uint8_t *)&header, sizeof(header));
     PG_FOREACH(reg) {
+#ifdef CONFIG_APPEND_CHANGES
+        if (changedOnly && !isPGInSet(changedOnly, reg)) {
+            continue;
+        }
+#else
+        UNUSED(changedOnly);
+#endif
+
         const uint16_t regSize = pgSize(reg);
         configRecord_t record = {
             .size = sizeof(configRecord_t) + regSize,
@@ -418,9 +541,9 @@ static bool writeSettingsToEEPROM(void)
         };
 
         record.flags |= CR_CLASSICATION_SYSTEM;
-        config_streamer_write(&streamer, (uint8_t *)&record, sizeof(record));
+        config_streamer_write(streamer, (uint8_t *)&record, sizeof(record));
         crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
-        config_streamer_write(&streamer, reg->address, regSize);
+        config_streamer_write(streamer, reg->address, regSize);
         crc = crc16_ccitt_update(crc, reg->address, regSize);
     }
 
@@ -428,14 +551,46 @@ static bool writeSettingsToEEPROM(void)
         .terminator = 0,
     };
 
-    config_streamer_write(&streamer, (uint8_t *)&footer, sizeof(footer));
+    config_streamer_write(streamer, (uint8_t *)&footer, sizeof(footer));
     crc = crc16_ccitt_update(crc, (uint8_t *)&footer, sizeof(footer));
 
     // include inverted CRC in big endian format in the CRC
     const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
-    config_streamer_write(&streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
+    config_streamer_write(streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
+
+    config_streamer_flush(streamer);
+}
+
+static bool writeSettingsToEEPROM(void)
+{
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+#ifdef CONFIG_APPEND_CHANGES
+    changedPGs_t changed;
+    if (PG_REGISTRY_SIZE <= CONFIG_MAX_CHANGED_PGS && isEEPROMVersionValid() && isEEPROMStructureValid()) {
+        const size_t changesSize = findChangedPGs(&changed);
+        if (changesSize == 0) {
+            // Nothing has changed since the last save
+            return true;
+        }
+
+        // Append the changes if they fit in the erased flash after the last block, saving an erase
+        const uint8_t *changesStart = &__config_start + eepromConfigSize;
+        if (changesStart + changesSize <= &__config_end && isEEPROMErased(changesStart, changesSize)) {
+            config_streamer_start_append(&streamer, (uintptr_t)changesStart, &__config_end - changesStart);
+            writeEEPROMBlock(&streamer, CONFIG_CHANGES_HEADER_MAGIC, &changed);
 
-    config_streamer_flush(&streamer);
+            return config_streamer_finish(&streamer) == 0;
+        }
+    }
+#endif
+
+    config_streamer_start(&streamer, (uintptr_t)&__config_start, &__config_end - &__config_start);
+    writeEEPROMBlock(&streamer, CONFIG_HEADER_MAGIC, NULL);
+#ifdef CONFIG_APPEND_CHANGES
+    config_streamer_erase_remaining(&streamer);
+#endif
 
     const bool success = config_streamer_finish(&streamer) == 0;
 
@@ -30,5 +30,5 @@ bool isEEPROMStructureValid(void);
 bool loadEEPROM(void);
 void writeConfigToEEPROM(void);
 
-uint16_t getEEPROMConfigSize(void);
+size_t getEEPROMConfigSize(void);
 size_t getEEPROMStorageSize(void);
@@ -27,15 +27,6 @@
 
 #include "config/config_streamer.h"
 
-#if !defined(CONFIG_IN_FLASH)
-#if defined(CONFIG_IN_RAM) && defined(PERSISTENT)
-PERSISTENT uint8_t eepromData[EEPROM_SIZE];
-#else
-uint8_t eepromData[EEPROM_SIZE];
-#endif
-#endif
-
-
 #if (defined(STM32H750xx) || defined(STM32H730xx)) && !(defined(CONFIG_IN_EXTERNAL_FLASH) || defined(CONFIG_IN_RAM) || defined(CONFIG_IN_SDCARD))
 #error "The configured MCU only has one flash page which contains the bootloader, no spare flash pages available, use external storage for persistent config or ram for target testing"
 #endif
@@ -85,6 +76,17 @@ uint8_t eepromData[EEPROM_SIZE];
 # endif
 #endif
 
+#if !defined(CONFIG_IN_FLASH)
+#if defined(CONFIG_IN_RAM) && defined(PERSISTENT)
+PERSISTENT uint8_t eepromData[EEPROM_SIZE];
+#elif defined(CONFIG_IN_FILE)
+// Aligned to the flash pages it stands in for, so that they are erased where they would be in flash
+uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(FLASH_PAGE_SIZE)));
+#else
+uint8_t eepromData[EEPROM_SIZE];
+#endif
+#endif
+
 void config_streamer_init(config_streamer_t *c)
 {
     memset(c, 0, sizeof(*c));
@@ -95,6 +97,8 @@ void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
     // base must start at FLASH_PAGE_SIZE boundary when using embedded flash.
     c->address = base;
     c->size = size;
+    c->end = base + size;
+    c->append = false;
     if (!c->unlocked) {
 #if defined(CONFIG_IN_RAM) || defined(CONFIG_IN_EXTERNAL_FLASH) || defined(CONFIG_IN_SDCARD)
         // NOP
@@ -132,6 +136,16 @@ void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
     c->err = 0;
 }
 
+/*
+ * Like config_streamer_start(), but for writing after data that is already in the flash. The flash from base to
+ * base + size must already be erased, see config_streamer_erase_remaining().
+ */
+void config_streamer_start_append(config_streamer_t *c, uintptr_t base, int size)
+{
+    config_streamer_start(c, base, size);
+    c->append = true;
+}
+
 #if defined(CONFIG_IN_RAM) || defined(CONFIG_IN_EXTERNAL_FLASH) || defined(CONFIG_IN_SDCARD)
 // No flash sector method required.
 #elif defined(CONFIG_IN_FLASH)
@@ -366,6 +380,70 @@ static void getFLASHSectorForEEPROM(uint32_t *bank, uint32_t *sector)
 #endif
 #endif // CONFIG_IN_FLASH
 
+#if defined(CONFIG_IN_FILE) || defined(CONFIG_IN_FLASH)
+// Erase the flash page (or sector) that starts at the given address
+static int erase_page(uintptr_t address)
+{
+#if defined(CONFIG_IN_FILE)
+    const FLASH_Status status = FLASH_ErasePage(address);
+    if (status != FLASH_COMPLETE) {
+        return -1;
+    }
+#elif defined(STM32H7)
+    FLASH_EraseInitTypeDef EraseInitStruct = {
+        .TypeErase     = FLASH_TYPEERASE_SECTORS,
+#if !(defined(STM32H7A3xx) || defined(STM32H7A3xxQ))
+        .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
+#endif
+        .NbSectors     = 1
+    };
+    getFLASHSectorForEEPROM(address, &EraseInitStruct.Banks, &EraseInitStruct.Sector);
+    uint32_t SECTORError;
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
+    if (status != HAL_OK) {
+        return -1;
+    }
+#elif defined(STM32F7)
+    UNUSED(address);
+
+    FLASH_EraseInitTypeDef EraseInitStruct = {
+        .TypeErase     = FLASH_TYPEERASE_SECTORS,
+        .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
+        .NbSectors     = 1
+    };
+    EraseInitStruct.Sector = getFLASHSectorForEEPROM();
+    uint32_t SECTORError;
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
+    if (status != HAL_OK) {
+        return -1;
+    }
+#elif defined(STM32G4)
+    FLASH_EraseInitTypeDef EraseInitStruct = {
+        .TypeErase     = FLASH_TYPEERASE_PAGES,
+        .NbPages       = 1
+    };
+    getFLASHSectorForEEPROM(address, &EraseInitStruct.Banks, &EraseInitStruct.Page);
+    uint32_t SECTORError;
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
+    if (status != HAL_OK) {
+        return -1;
+    }
+#else // !STM32H7 && !STM32F7 && !STM32G4
+#if defined(STM32F4)
+    UNUSED(address);
+
+    const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(), VoltageRange_3); //0x08080000 to 0x080A0000
+#else // STM32F3, STM32F1
+    const FLASH_Status status = FLASH_ErasePage(address);
+#endif
+    if (status != FLASH_COMPLETE) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+#endif
+
 // FIXME the return values are currently magic numbers
 static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t *buffer)
 {
@@ -426,38 +504,17 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
       *dest_addr++ = *src_addr++;
     } while (--row_index != 0);
 
-#elif defined(CONFIG_IN_FILE)
+#elif defined(CONFIG_IN_FILE) || defined(CONFIG_IN_FLASH)
 
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-        const FLASH_Status status = FLASH_ErasePage(c->address);
-        if (status != FLASH_COMPLETE) {
-            return -1;
+    // When appending, the flash after the end of the data is already erased
+    if (c->address % FLASH_PAGE_SIZE == 0 && !c->append) {
+        const int err = erase_page(c->address);
+        if (err != 0) {
+            return err;
         }
     }
-    const FLASH_Status status = FLASH_ProgramWord(c->address, *buffer);
-    if (status != FLASH_COMPLETE) {
-        return -2;
-    }
-
-#elif defined(CONFIG_IN_FLASH)
 
 #if defined(STM32H7)
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-        FLASH_EraseInitTypeDef EraseInitStruct = {
-            .TypeErase     = FLASH_TYPEERASE_SECTORS,
-#if !(defined(STM32H7A3xx) || defined(STM32H7A3xxQ))
-            .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
-#endif
-            .NbSectors     = 1
-        };
-        getFLASHSectorForEEPROM(c->address, &EraseInitStruct.Banks, &EraseInitStruct.Sector);
-        uint32_t SECTORError;
-        const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
-        if (status != HAL_OK) {
-            return -1;
-        }
-    }
-
     // For H7
     // HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t DataAddress);
     const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, c->address, (uint64_t)(uint32_t)buffer);
@@ -465,20 +522,6 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
         return -2;
     }
 #elif defined(STM32F7)
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-        FLASH_EraseInitTypeDef EraseInitStruct = {
-            .TypeErase     = FLASH_TYPEERASE_SECTORS,
-            .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
-            .NbSectors     = 1
-        };
-        EraseInitStruct.Sector = getFLASHSectorForEEPROM();
-        uint32_t SECTORError;
-        const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
-        if (status != HAL_OK) {
-            return -1;
-        }
-    }
-
     // For F7
     // HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
     const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, c->address, (uint64_t)*buffer);
@@ -486,35 +529,11 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
         return -2;
     }
 #elif defined(STM32G4)
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-
-        FLASH_EraseInitTypeDef EraseInitStruct = {
-            .TypeErase     = FLASH_TYPEERASE_PAGES,
-            .NbPages       = 1
-        };
-        getFLASHSectorForEEPROM(c->address, &EraseInitStruct.Banks, &EraseInitStruct.Page);
-        uint32_t SECTORError;
-        const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SECTORError);
-        if (status != HAL_OK) {
-            return -1;
-        }
-    }
-
     const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, c->address, (uint64_t)*buffer);
     if (status != HAL_OK) {
         return -2;
     }
-#else // !STM32H7 && !STM32F7 && !STM32G4
-    if (c->address % FLASH_PAGE_SIZE == 0) {
-#if defined(STM32F4)
-        const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(), VoltageRange_3); //0x08080000 to 0x080A0000
-#else // STM32F3, STM32F1
-        const FLASH_Status status = FLASH_ErasePage(c->address);
-#endif
-        if (status != FLASH_COMPLETE) {
-            return -1;
-        }
-    }
+#else // !STM32H7 && !STM32F7 && !STM32G4, or CONFIG_IN_FILE
     const FLASH_Status status = FLASH_ProgramWord(c->address, *buffer);
     if (status != FLASH_COMPLETE) {
         return -2;
@@ -553,6 +572,26 @@ int config_streamer_flush(config_streamer_t *c)
     return c-> err;
 }
 
+/*
+ * Erase the pages after the one that the last write went to, up to the end of the area given to
+ * config_streamer_start(), so that later writes can be appended there.
+ */
+int config_streamer_erase_remaining(config_streamer_t *c)
+{
+#if defined(CONFIG_IN_FILE) || defined(CONFIG_IN_FLASH)
+    // The page that the last write went to was erased when the write reached its start
+    uintptr_t address = c->address;
+    if (address % FLASH_PAGE_SIZE != 0) {
+        address += FLASH_PAGE_SIZE - address % FLASH_PAGE_SIZE;
+    }
+
+    for (; c->err == 0 && address + FLASH_PAGE_SIZE <= c->end; address += FLASH_PAGE_SIZE) {
+        c->err = erase_page(address);
+    }
+#endif
+    return c->err;
+}
+
 int config_streamer_finish(config_streamer_t *c)
 {
     if (c->unlocked) {
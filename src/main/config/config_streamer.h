@@ -46,6 +46,8 @@ typedef uint32_t config_streamer_buffer_align_type_t;
 typedef struct config_streamer_s {
     uintptr_t address;
     int size;
+    uintptr_t end;
+    bool append; // Writing to flash that has already been erased
     union {
         uint8_t b[CONFIG_STREAMER_BUFFER_SIZE];
         config_streamer_buffer_align_type_t w;
@@ -58,8 +60,10 @@ typedef struct config_streamer_s {
 void config_streamer_init(config_streamer_t *c);
 
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size);
+void config_streamer_start_append(config_streamer_t *c, uintptr_t base, int size);
 int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size);
 int config_streamer_flush(config_streamer_t *c);
+int config_streamer_erase_remaining(config_streamer_t *c);
 
 int config_streamer_finish(config_streamer_t *c);
 int config_streamer_status(config_streamer_t *c);
@@ -38,9 +38,19 @@
 #include "drivers/accgyro/accgyro.h"
 #include "drivers/accgyro/accgyro_fake.h"
 
+#if defined(SIMULATOR_GYRO_THREAD)
+#include "sensors/gyro_ring.h"
+#endif
+
 static int16_t fakeGyroADC[XYZ_AXIS_COUNT];
 gyroDev_t *fakeGyroDev;
 
+#if defined(SIMULATOR_GYRO_THREAD)
+// Raw samples taken by the gyro thread, read back one at a time by fakeGyroRead() on the main thread.
+// Zero initialised is empty, so it is never reset under the running producer.
+static gyroRing_t fakeGyroRing;
+#endif
+
 static void fakeGyroInit(gyroDev_t *gyro)
 {
     fakeGyroDev = gyro;
@@ -64,6 +74,47 @@ void fakeGyroSet(gyroDev_t *gyro, int16_t x, int16_t y, int16_t z)
     gyroDevUnLock(gyro);
 }
 
+#if defined(SIMULATOR_GYRO_THREAD)
+// Producer side, called from the gyro thread. Only queues the last value set, like a gyro sampling at its own rate,
+// everything in gyroDev_t is left to the consumer.
+void fakeGyroSample(timeUs_t timeUs)
+{
+    float adc[XYZ_AXIS_COUNT];
+
+    gyroDevLock(fakeGyroDev);
+    adc[X] = fakeGyroADC[X];
+    adc[Y] = fakeGyroADC[Y];
+    adc[Z] = fakeGyroADC[Z];
+    gyroDevUnLock(fakeGyroDev);
+
+    gyroRingPush(&fakeGyroRing, timeUs, adc);
+}
+
+// Consumer side, the time of the oldest queued sample. Returns false if none is queued.
+bool fakeGyroSampleQueued(timeUs_t *timeUs)
+{
+    const gyroSample_t *sample = gyroRingPeek(&fakeGyroRing);
+    if (!sample) {
+        return false;
+    }
+    *timeUs = sample->timeUs;
+    return true;
+}
+
+STATIC_UNIT_TESTED bool fakeGyroRead(gyroDev_t *gyro)
+{
+    gyroSample_t sample;
+    if (!gyroRingRead(&fakeGyroRing, &sample, 1)) {
+        return false;
+    }
+
+    gyro->gyroADCRaw[X] = sample.adc[X];
+    gyro->gyroADCRaw[Y] = sample.adc[Y];
+    gyro->gyroADCRaw[Z] = sample.adc[Z];
+
+    return true;
+}
+#else
 STATIC_UNIT_TESTED bool fakeGyroRead(gyroDev_t *gyro)
 {
     gyroDevLock(gyro);
@@ -80,6 +131,7 @@ STATIC_UNIT_TESTED bool fakeGyroRead(gyroDev_t *gyro)
     gyroDevUnLock(gyro);
     return true;
 }
+#endif
 
 static bool fakeGyroReadTemperature(gyroDev_t *gyro, int16_t *temperatureData)
 {
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "common/time.h"
+
 struct accDev_s;
 extern struct accDev_s *fakeAccDev;
 bool fakeAccDetect(struct accDev_s *acc);
@@ -29,3 +31,7 @@ struct gyroDev_s;
 extern struct gyroDev_s *fakeGyroDev;
 bool fakeGyroDetect(struct gyroDev_s *gyro);
 void fakeGyroSet(struct gyroDev_s *gyro, int16_t x, int16_t y, int16_t z);
+#if defined(SIMULATOR_GYRO_THREAD)
+void fakeGyroSample(timeUs_t timeUs);
+bool fakeGyroSampleQueued(timeUs_t *timeUs);
+#endif
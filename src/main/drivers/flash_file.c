@@ -0,0 +1,199 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * A NOR flash chip kept in a file, for SITL. It has the geometry of a W25Q128, and like a real chip programming can
+ * only clear bits and erasing sets them again. Operations complete immediately so the chip is never busy.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "platform.h"
+
+#ifdef USE_FLASH_FILE
+
+#include "common/maths.h"
+
+#include "drivers/flash.h"
+#include "drivers/flash_impl.h"
+
+#include "flash_file.h"
+
+#define FLASH_FILE_PAGE_SIZE 256
+#define FLASH_FILE_PAGES_PER_SECTOR 256
+#define FLASH_FILE_SECTORS 256
+
+static uint8_t *flashFileData = NULL;
+
+const flashVTable_t flashFile_vTable;
+
+static bool flashFile_isReady(flashDevice_t *fdevice)
+{
+    UNUSED(fdevice);
+
+    return true;
+}
+
+static bool flashFile_waitForReady(flashDevice_t *fdevice)
+{
+    UNUSED(fdevice);
+
+    return true;
+}
+
+static void flashFile_eraseSector(flashDevice_t *fdevice, uint32_t address)
+{
+    const uint32_t sectorSize = fdevice->geometry.sectorSize;
+
+    address -= address % sectorSize;
+    if (address < fdevice->geometry.totalSize) {
+        memset(flashFileData + address, 0xFF, sectorSize);
+    }
+}
+
+static void flashFile_eraseCompletely(flashDevice_t *fdevice)
+{
+    memset(flashFileData, 0xFF, fdevice->geometry.totalSize);
+}
+
+static void flashFile_pageProgramBegin(flashDevice_t *fdevice, uint32_t address, void (*callback)(uint32_t length))
+{
+    fdevice->callback = callback;
+    fdevice->currentWriteAddress = address;
+}
+
+static uint32_t flashFile_pageProgramContinue(flashDevice_t *fdevice, uint8_t const **buffers, uint32_t *bufferSizes, uint32_t bufferCount)
+{
+    uint32_t written = 0;
+
+    for (uint32_t i = 0; i < bufferCount; i++) {
+        for (uint32_t j = 0; j < bufferSizes[i] && fdevice->currentWriteAddress < fdevice->geometry.totalSize; j++) {
+            // Programming can only clear bits
+            flashFileData[fdevice->currentWriteAddress++] &= buffers[i][j];
+            written++;
+        }
+    }
+
+    if (fdevice->callback) {
+        fdevice->callback(written);
+    }
+
+    return written;
+}
+
+static void flashFile_pageProgramFinish(flashDevice_t *fdevice)
+{
+    UNUSED(fdevice);
+}
+
+static void flashFile_pageProgram(flashDevice_t *fdevice, uint32_t address, const uint8_t *data, uint32_t length, void (*callback)(uint32_t length))
+{
+    flashFile_pageProgramBegin(fdevice, address, callback);
+    flashFile_pageProgramContinue(fdevice, &data, &length, 1);
+    flashFile_pageProgramFinish(fdevice);
+}
+
+static int flashFile_readBytes(flashDevice_t *fdevice, uint32_t address, uint8_t *buffer, uint32_t length)
+{
+    if (address >= fdevice->geometry.totalSize) {
+        return 0;
+    }
+
+    length = MIN(length, fdevice->geometry.totalSize - address);
+    memcpy(buffer, flashFileData + address, length);
+
+    return length;
+}
+
+static const flashGeometry_t *flashFile_getGeometry(flashDevice_t *fdevice)
+{
+    return &fdevice->geometry;
+}
+
+bool flashFile_detect(flashDevice_t *fdevice)
+{
+    flashGeometry_t *geometry = &fdevice->geometry;
+
+    geometry->sectors = FLASH_FILE_SECTORS;
+    geometry->pagesPerSector = FLASH_FILE_PAGES_PER_SECTOR;
+    geometry->pageSize = FLASH_FILE_PAGE_SIZE;
+    geometry->sectorSize = FLASH_FILE_PAGE_SIZE * FLASH_FILE_PAGES_PER_SECTOR;
+    geometry->totalSize = geometry->sectorSize * FLASH_FILE_SECTORS;
+    geometry->flashType = FLASH_TYPE_NOR;
+
+    const int fd = open(FLASH_FILENAME, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        printf("[flash] failed to open '%s'\n", FLASH_FILENAME);
+        geometry->sectors = 0;
+        geometry->totalSize = 0;
+        return false;
+    }
+
+    const off_t fileSize = lseek(fd, 0, SEEK_END);
+
+    if (fileSize < (off_t)geometry->totalSize && ftruncate(fd, geometry->totalSize) != 0) {
+        close(fd);
+        geometry->sectors = 0;
+        geometry->totalSize = 0;
+        return false;
+    }
+
+    flashFileData = mmap(NULL, geometry->totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (flashFileData == MAP_FAILED) {
+        flashFileData = NULL;
+        geometry->sectors = 0;
+        geometry->totalSize = 0;
+        return false;
+    }
+
+    // A new file reads as zeros, make the part that wasn't there before look erased
+    if (fileSize < (off_t)geometry->totalSize) {
+        memset(flashFileData + fileSize, 0xFF, geometry->totalSize - fileSize);
+    }
+
+    printf("[flash] '%s', %u kB\n", FLASH_FILENAME, (unsigned)(geometry->totalSize / 1024));
+
+    fdevice->vTable = &flashFile_vTable;
+
+    return true;
+}
+
+const flashVTable_t flashFile_vTable = {
+    .isReady = flashFile_isReady,
+    .waitForReady = flashFile_waitForReady,
+    .eraseSector = flashFile_eraseSector,
+    .eraseCompletely = flashFile_eraseCompletely,
+    .pageProgramBegin = flashFile_pageProgramBegin,
+    .pageProgramContinue = flashFile_pageProgramContinue,
+    .pageProgramFinish = flashFile_pageProgramFinish,
+    .pageProgram = flashFile_pageProgram,
+    .readBytes = flashFile_readBytes,
+    .getGeometry = flashFile_getGeometry,
+};
+#endif
@@ -216,16 +216,21 @@ void tcpWrite(serialPort_t *instance, uint8_t ch)
         s->port.txBufferHead++;
     }
     pthread_mutex_unlock(&s->txLock);
-
-    tcpDataOut(s);
 }
 
+// dyad isn't thread safe, so this is only called from the thread running dyad_update()
 void tcpDataOut(tcpPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
-    if (s->conn == NULL) return;
     pthread_mutex_lock(&s->txLock);
 
+    if (s->conn == NULL) {
+        // Nobody to send it to
+        s->port.txBufferTail = s->port.txBufferHead;
+        pthread_mutex_unlock(&s->txLock);
+        return;
+    }
+
     if (s->port.txBufferHead < s->port.txBufferTail) {
         // send data till end of buffer
         int chunk = s->port.txBufferSize - s->port.txBufferTail;
@@ -240,6 +245,15 @@ void tcpDataOut(tcpPort_t *instance)
     pthread_mutex_unlock(&s->txLock);
 }
 
+void tcpDataOutAll(void)
+{
+    for (int id = 0; id < SERIAL_PORT_COUNT; id++) {
+        if (tcpPortInitialized[id]) {
+            tcpDataOut(&tcpSerialPorts[id]);
+        }
+    }
+}
+
 void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
@@ -92,6 +92,7 @@ void changeControlRateProfile(uint8_t controlRateProfileIndex)
 
     loadControlRateProfile();
     initRcProcessing();
+    setConfigChanged();
 }
 
 void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint8_t srcControlRateProfileIndex) {
@@ -26,6 +26,7 @@
 #include "platform.h"
 
 #include "blackbox/blackbox.h"
+#include "blackbox/blackbox_gyro_capture.h"
 #include "blackbox/blackbox_fielddefs.h"
 
 #include "build/debug.h"
@@ -42,6 +43,9 @@
 #include "config/config.h"
 #include "config/feature.h"
 
+#if defined(SIMULATOR_GYRO_THREAD)
+#include "drivers/accgyro/accgyro_fake.h"
+#endif
 #include "drivers/dshot.h"
 #include "drivers/dshot_command.h"
 #include "drivers/light_led.h"
@@ -52,6 +56,7 @@
 #include "drivers/transponder_ir.h"
 
 #include "fc/controlrate_profile.h"
+#include "fc/latency_trace.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -144,7 +149,8 @@ enum {
 int16_t magHold;
 #endif
 
-static FAST_DATA_ZERO_INIT uint8_t pidUpdateCounter;
+// A batch of gyro samples has been filtered which the pid loop has yet to run on
+static FAST_DATA_ZERO_INIT bool pidLoopPending;
 
 static bool flipOverAfterCrashActive = false;
 
@@ -554,6 +560,10 @@ void tryArm(void)
         resetMaxFFT();
 #endif
 
+#ifdef USE_LATENCY_TRACE
+        latencyTraceReset();
+#endif
+
         disarmAt = currentTimeUs + armingConfig()->auto_disarm_delay * 1e6;   // start disarm timeout, will be extended when throttle is nonzero
 
         lastArmingDisabledReason = 0;
@@ -1090,6 +1100,9 @@ static FAST_CODE void subTaskPidController(timeUs_t currentTimeUs)
     // PID - note this is function pointer set by setPIDController()
     pidController(currentPidProfile, currentTimeUs);
     DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
+#ifdef USE_LATENCY_TRACE
+    latencyTraceMark(LATENCY_POINT_PID);
+#endif
 
 #ifdef USE_RUNAWAY_TAKEOFF
     // Check to see if runaway takeoff detection is active (anti-taz), the pidSum is over the threshold,
@@ -1199,6 +1212,9 @@ static FAST_CODE void subTaskMotorUpdate(timeUs_t currentTimeUs)
 #endif
 
     writeMotors();
+#ifdef USE_LATENCY_TRACE
+    latencyTraceMark(LATENCY_POINT_MOTOR_WRITE);
+#endif
 
 #ifdef USE_DSHOT_TELEMETRY_STATS
     if (debugMode == DEBUG_DSHOT_RPM_ERRORS && useDshotTelemetry) {
@@ -1237,35 +1253,46 @@ static FAST_CODE_NOINLINE void subTaskRcCommand(timeUs_t currentTimeUs)
 
 FAST_CODE void taskGyroSample(timeUs_t currentTimeUs)
 {
+#if defined(SIMULATOR_GYRO_THREAD)
+    // the gyro thread only queues raw samples, process each of them here as if it had just been read
     UNUSED(currentTimeUs);
-    gyroUpdate();
-    if (pidUpdateCounter % activePidLoopDenom == 0) {
-        pidUpdateCounter = 0;
+    timeUs_t sampleTimeUs;
+    while (fakeGyroSampleQueued(&sampleTimeUs)) {
+        gyroUpdate(sampleTimeUs);
     }
-    pidUpdateCounter++;
+#else
+    gyroUpdate(currentTimeUs);
+#endif
 }
 
+// gyroFilterReady() waits for a whole pid loop of samples, which the gyro ring must be able to hold
+STATIC_ASSERT(GYRO_RING_SIZE >= MAX_PID_PROCESS_DENOM, gyro_ring_smaller_than_pid_loop);
+
 FAST_CODE bool gyroFilterReady(void)
 {
-    if (pidUpdateCounter % activePidLoopDenom == 0) {
-        return true;
-    } else {
-        return false;
-    }
+    // filter once a pid loop worth of samples is queued, independent of which context produced them, and the pid
+    // loop has run on the last batch
+    return !pidLoopPending && gyroRingCount(&gyro.sampleRing) >= activePidLoopDenom;
 }
 
 FAST_CODE bool pidLoopReady(void)
 {
-    if ((pidUpdateCounter % activePidLoopDenom) == (activePidLoopDenom / 2)) {
-        return true;
-    }
-    return false;
+    // once per filtered batch, half a pid loop of samples after it to spread the load over the gyro loops. Both count
+    // the samples drained from the ring, so they stay in step however many arrive between runs of the gyro task
+    return pidLoopPending && gyroRingCount(&gyro.sampleRing) >= activePidLoopDenom / 2;
 }
 
 FAST_CODE void taskFiltering(timeUs_t currentTimeUs)
 {
     gyroFiltering(currentTimeUs);
-
+    pidLoopPending = true;
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    // every sample of the batch just filtered, at the full gyro rate
+    blackboxGyroCapturePush(gyro.samples, gyro.sampleCount, gyro.gyroADCf);
+#endif
+#ifdef USE_LATENCY_TRACE
+    latencyTraceMark(LATENCY_POINT_GYRO_FILTERED);
+#endif
 }
 
 // Function for loop trigger
@@ -1276,6 +1303,8 @@ FAST_CODE void taskMainPidLoop(timeUs_t currentTimeUs)
     if (lockMainPID() != 0) return;
 #endif
 
+    pidLoopPending = false;
+
     // DEBUG_PIDLOOP, timings for:
     // 0 - gyroUpdate()
     // 1 - subTaskPidController()
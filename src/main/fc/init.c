@@ -259,12 +259,13 @@ void init(void)
     printfSerialInit();
 #endif
 
-    systemInit();
-
     // Initialize task data as soon as possible. Has to be done before tasksInit(),
-    // and any init code that may try to modify task behaviour before tasksInit().
+    // and any init code that may try to modify task behaviour before tasksInit(),
+    // such as the SITL systemInit() which speeds up the serial task.
     tasksInitData();
 
+    systemInit();
+
     // initialize IO (needed for all IO operations)
     IOInitGlobal();
 
@@ -0,0 +1,103 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_LATENCY_TRACE
+
+#include "drivers/system.h"
+
+#include "fc/latency_trace.h"
+
+typedef struct latencyTrace_s {
+    uint32_t sampleCycles;          // newest gyro sample, may be written from the gyro sampling context
+    uint32_t cycles[LATENCY_POINT_COUNT];
+    latencyPoint_e lastPoint;       // last point reached by the loop being traced
+    histogram_t histograms[LATENCY_STAGE_COUNT];
+} latencyTrace_t;
+
+static latencyTrace_t latencyTrace;
+
+static const char * const latencyStageNames[LATENCY_STAGE_COUNT] = {
+    "FILTER", "PID", "MOTOR", "TOTAL"
+};
+
+static void latencyTraceAdd(latencyStage_e stage, latencyPoint_e from, latencyPoint_e to)
+{
+    const int32_t delta10thUs = clockCyclesTo10thMicros((int32_t)(latencyTrace.cycles[to] - latencyTrace.cycles[from]));
+    histogramAdd(&latencyTrace.histograms[stage], delta10thUs > 0 ? delta10thUs : 0);
+}
+
+// The gyro may be sampled several times per pid loop, the loop traced starts from the newest sample
+// consumed by the filter. A point reached out of order, e.g. while arming resets the pid loop, drops the
+// loop being traced.
+FAST_CODE void latencyTraceMark(latencyPoint_e point)
+{
+    const uint32_t nowCycles = getCycleCounter();
+
+    switch (point) {
+    case LATENCY_POINT_GYRO_SAMPLE:
+        latencyTrace.sampleCycles = nowCycles;
+        return;
+
+    case LATENCY_POINT_GYRO_FILTERED:
+        latencyTrace.cycles[LATENCY_POINT_GYRO_SAMPLE] = latencyTrace.sampleCycles;
+        break;
+
+    default:
+        if (latencyTrace.lastPoint != point - 1) {
+            return;
+        }
+        break;
+    }
+
+    latencyTrace.cycles[point] = nowCycles;
+    latencyTrace.lastPoint = point;
+
+    if (point == LATENCY_POINT_MOTOR_WRITE) {
+        latencyTraceAdd(LATENCY_STAGE_FILTER, LATENCY_POINT_GYRO_SAMPLE, LATENCY_POINT_GYRO_FILTERED);
+        latencyTraceAdd(LATENCY_STAGE_PID, LATENCY_POINT_GYRO_FILTERED, LATENCY_POINT_PID);
+        latencyTraceAdd(LATENCY_STAGE_MOTOR, LATENCY_POINT_PID, LATENCY_POINT_MOTOR_WRITE);
+        latencyTraceAdd(LATENCY_STAGE_TOTAL, LATENCY_POINT_GYRO_SAMPLE, LATENCY_POINT_MOTOR_WRITE);
+        latencyTrace.lastPoint = LATENCY_POINT_GYRO_SAMPLE;
+    }
+}
+
+void latencyTraceReset(void)
+{
+    for (int stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        histogramReset(&latencyTrace.histograms[stage]);
+    }
+    latencyTrace.lastPoint = LATENCY_POINT_GYRO_SAMPLE;
+}
+
+const histogram_t *latencyTraceHistogram(latencyStage_e stage)
+{
+    return &latencyTrace.histograms[stage];
+}
+
+const char *latencyTraceStageName(latencyStage_e stage)
+{
+    return latencyStageNames[stage];
+}
+
+#endif // USE_LATENCY_TRACE
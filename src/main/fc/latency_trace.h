@@ -0,0 +1,49 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Gyro to motor latency tracer.
+// Each pid loop is timestamped with the cycle counter when the newest gyro sample was read, after
+// filtering, after the pid controller and after the motor write. The stage latencies and the end to end
+// latency are collected in histograms, in 1/10 us.
+
+#pragma once
+
+#include "common/histogram.h"
+
+typedef enum {
+    LATENCY_POINT_GYRO_SAMPLE = 0,  // gyroUpdate() has read a sample
+    LATENCY_POINT_GYRO_FILTERED,    // gyroFiltering() done
+    LATENCY_POINT_PID,              // pidController() done
+    LATENCY_POINT_MOTOR_WRITE,      // writeMotors() done
+    LATENCY_POINT_COUNT
+} latencyPoint_e;
+
+typedef enum {
+    LATENCY_STAGE_FILTER = 0,       // gyro sample to filtered
+    LATENCY_STAGE_PID,              // filtered to pid controller output
+    LATENCY_STAGE_MOTOR,            // pid controller output to motor write
+    LATENCY_STAGE_TOTAL,            // gyro sample to motor write
+    LATENCY_STAGE_COUNT
+} latencyStage_e;
+
+void latencyTraceMark(latencyPoint_e point);
+void latencyTraceReset(void);
+const histogram_t *latencyTraceHistogram(latencyStage_e stage);
+const char *latencyTraceStageName(latencyStage_e stage);
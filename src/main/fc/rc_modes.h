@@ -77,6 +77,7 @@ typedef enum {
     BOXMSPOVERRIDE,
     BOXSTICKCOMMANDDISABLE,
     BOXBEEPERMUTE,
+    BOXGYROCAPTURE,
     CHECKBOX_ITEM_COUNT
 } boxId_e;
 
@@ -145,7 +145,7 @@ static void taskHandleSerial(timeUs_t currentTimeUs)
     }
 #endif
     bool evaluateMspData = ARMING_FLAG(ARMED) ? MSP_SKIP_NON_MSP_DATA : MSP_EVALUATE_NON_MSP_DATA;
-    mspSerialProcess(evaluateMspData, mspFcProcessCommand, mspFcProcessReply);
+    mspSerialProcess(evaluateMspData, mspFcProcessCommand, mspFcProcessReply, mspFcProcessStream);
 }
 
 static void taskBatteryAlerts(timeUs_t currentTimeUs)
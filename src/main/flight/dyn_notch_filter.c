@@ -143,7 +143,7 @@ static FAST_DATA_ZERO_INIT float sampleAvg[XYZ_AXIS_COUNT];
 
 // parameters for peak detection and frequency analysis
 static FAST_DATA_ZERO_INIT state_t state;
-static FAST_DATA_ZERO_INIT sdft_t  sdft[XYZ_AXIS_COUNT];
+static FAST_DATA_ZERO_INIT sdftXYZ_t sdft;
 static FAST_DATA_ZERO_INIT peak_t  peaks[DYN_NOTCH_COUNT_MAX];
 static FAST_DATA_ZERO_INIT float   sdftData[SDFT_BIN_COUNT];
 static FAST_DATA_ZERO_INIT float   sdftSampleRateHz;
@@ -188,9 +188,17 @@ void dynNotchInit(const dynNotchConfig_t *config, const timeUs_t targetLooptimeU
     sdftEndBin = MIN(SDFT_BIN_COUNT - 1, dynNotch.maxHz / sdftResolutionHz + 0.5f); // can't use more than SDFT_BIN_COUNT bins.
     pt1LooptimeS = DYN_NOTCH_CALC_TICKS / looprateHz;
 
+    sdftXYZInit(&sdft, sdftStartBin, sdftEndBin, sampleCount);
+
+    // restart the analysis from an empty accumulator, so reinitialising gives the same result as a cold start
+    sampleIndex = 0;
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        sdftInit(&sdft[axis], sdftStartBin, sdftEndBin, sampleCount);
+        sampleAccumulator[axis] = 0.0f;
+        sampleAvg[axis] = 0.0f;
     }
+    state.tick = 0;
+    state.step = STEP_WINDOW;
+    state.axis = 0;
 
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         for (int p = 0; p < dynNotch.count; p++) {
@@ -233,11 +241,9 @@ FAST_CODE void dynNotchUpdate(void)
         state.tick = DYN_NOTCH_CALC_TICKS;
     }
 
-    // 2us @ F722
     // SDFT processing in batches to synchronize with incoming downsampled data
-    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        sdftPushBatch(&sdft[axis], sampleAvg[axis], sampleIndex);
-    }
+    // all axes are processed in one pass over the bins
+    sdftXYZPushBatch(&sdft, sampleAvg, sampleIndex);
     sampleIndex++;
 
     // Find frequency peaks and update filters
@@ -261,8 +267,8 @@ static FAST_CODE_NOINLINE void dynNotchProcess(void)
     
         case STEP_WINDOW: // 4.1us (3-6us) @ F722
         {
-            sdftWinSq(&sdft[state.axis], sdftData);
-            
+            sdftXYZWinSq(&sdft, state.axis, sdftData);
+
             // Get total vibrational power in dyn notch range for noise floor estimate in STEP_CALC_FREQUENCIES
             sdftNoiseThreshold = 0.0f;
             for (int bin = (sdftStartBin + 1); bin < sdftEndBin; bin++) {   // don't use startBin or endBin because they are not windowed properly
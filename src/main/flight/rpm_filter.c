@@ -48,7 +48,6 @@
 #define RPM_FILTER_MAXHARMONICS 3
 #define SECONDS_PER_MINUTE      60.0f
 #define ERPM_PER_LSB            100.0f
-#define MIN_UPDATE_T            0.001f
 
 
 static pt1Filter_t rpmFilters[MAX_SUPPORTED_MOTORS];
@@ -62,7 +61,9 @@ typedef struct rpmNotchFilter_s {
     float    q;
     timeUs_t looptimeUs;
 
-    biquadFilter_t notch[XYZ_AXIS_COUNT][MAX_SUPPORTED_MOTORS][RPM_FILTER_MAXHARMONICS];
+    biquadNotchTable_t notchTable; // coefficients over [minHz, maxHz] for looptimeUs and q
+    biquadBank_t notchBank;
+    biquadBankSection_t notch[MAX_SUPPORTED_MOTORS * RPM_FILTER_MAXHARMONICS]; // [motor * harmonics + harmonic]
 
 } rpmNotchFilter_t;
 
@@ -70,18 +71,10 @@ FAST_DATA_ZERO_INIT static float   erpmToHz;
 FAST_DATA_ZERO_INIT static float   filteredMotorErpm[MAX_SUPPORTED_MOTORS];
 FAST_DATA_ZERO_INIT static float   motorFrequency[MAX_SUPPORTED_MOTORS];
 FAST_DATA_ZERO_INIT static float   minMotorFrequency;
-FAST_DATA_ZERO_INIT static uint8_t numberFilters;
-FAST_DATA_ZERO_INIT static uint8_t numberRpmNotchFilters;
-FAST_DATA_ZERO_INIT static uint8_t filterUpdatesPerIteration;
 FAST_DATA_ZERO_INIT static float   pidLooptime;
-FAST_DATA_ZERO_INIT static rpmNotchFilter_t filters[2];
+FAST_DATA_ZERO_INIT static rpmNotchFilter_t rpmNotchFilter;
 FAST_DATA_ZERO_INIT static rpmNotchFilter_t *gyroFilter;
 
-FAST_DATA_ZERO_INIT static uint8_t currentMotor;
-FAST_DATA_ZERO_INIT static uint8_t currentHarmonic;
-FAST_DATA_ZERO_INIT static uint8_t currentFilterNumber;
-FAST_DATA static rpmNotchFilter_t *currentFilter = &filters[0];
-
 
 
 PG_REGISTER_WITH_RESET_FN(rpmFilterConfig_t, rpmFilterConfig, PG_RPM_FILTER_CONFIG, 5);
@@ -105,22 +98,20 @@ static void rpmNotchFilterInit(rpmNotchFilter_t *filter, const rpmFilterConfig_t
     filter->q = config->rpm_filter_q / 100.0f;
     filter->looptimeUs = looptimeUs;
 
-    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        for (int motor = 0; motor < getMotorCount(); motor++) {
-            for (int i = 0; i < filter->harmonics; i++) {
-                biquadFilterInit(
-                    &filter->notch[axis][motor][i], filter->minHz * i, filter->looptimeUs, filter->q, FILTER_NOTCH, 0.0f);
-            }
+    // looptime and q are fixed, so the notch coefficients only depend on frequency
+    biquadNotchTableInit(&filter->notchTable, filter->minHz, filter->maxHz, filter->looptimeUs, filter->q);
+
+    for (int motor = 0; motor < getMotorCount(); motor++) {
+        for (int i = 0; i < filter->harmonics; i++) {
+            biquadBankSectionInit(
+                &filter->notch[motor * filter->harmonics + i], filter->minHz * i, filter->looptimeUs, filter->q, FILTER_NOTCH, 0.0f);
         }
     }
+    biquadBankInit(&filter->notchBank, filter->notch, getMotorCount() * filter->harmonics);
 }
 
 void rpmFilterInit(const rpmFilterConfig_t *config)
 {
-    currentFilter = &filters[0];
-    currentMotor = currentHarmonic = currentFilterNumber = 0;
-
-    numberRpmNotchFilters = 0;
     if (!motorConfig()->dev.useDshotTelemetry) {
         gyroFilter = NULL;
         return;
@@ -128,7 +119,7 @@ void rpmFilterInit(const rpmFilterConfig_t *config)
 
     pidLooptime = gyro.targetLooptime;
     if (config->rpm_filter_harmonics) {
-        gyroFilter = &filters[numberRpmNotchFilters++];
+        gyroFilter = &rpmNotchFilter;
         rpmNotchFilterInit(gyroFilter, config, pidLooptime);
     } else {
         gyroFilter = NULL;
@@ -139,29 +130,20 @@ void rpmFilterInit(const rpmFilterConfig_t *config)
     }
 
     erpmToHz = ERPM_PER_LSB / SECONDS_PER_MINUTE  / (motorConfig()->motorPoleCount / 2.0f);
-
-    const float loopIterationsPerUpdate = MIN_UPDATE_T / (pidLooptime * 1e-6f);
-    numberFilters = getMotorCount() * (filters[0].harmonics + filters[1].harmonics);
-    const float filtersPerLoopIteration = numberFilters / loopIterationsPerUpdate;
-    filterUpdatesPerIteration = rintf(filtersPerLoopIteration + 0.49f);
 }
 
-static float applyFilter(rpmNotchFilter_t *filter, const int axis, float value)
+static void applyFilter(rpmNotchFilter_t *filter, float *xyz)
 {
     if (filter == NULL) {
-        return value;
-    }
-    for (int motor = 0; motor < getMotorCount(); motor++) {
-        for (int i = 0; i < filter->harmonics; i++) {
-            value = biquadFilterApplyDF1Weighted(&filter->notch[axis][motor][i], value);
-        }
+        return;
     }
-    return value;
+    biquadBankApplyDF1Weighted(&filter->notchBank, xyz);
 }
 
-float rpmFilterGyro(const int axis, float value)
+// filters all three axes of xyz in place
+void rpmFilterGyro(float *xyz)
 {
-    return applyFilter(gyroFilter, axis, value);
+    applyFilter(gyroFilter, xyz);
 }
 
 FAST_CODE_NOINLINE void rpmFilterUpdate(void)
@@ -174,51 +156,28 @@ FAST_CODE_NOINLINE void rpmFilterUpdate(void)
         motorFrequency[motor] = erpmToHz * filteredMotorErpm[motor];
     }
 
+    minMotorFrequency = 0.0f;
+
     if (gyroFilter == NULL) {
-        minMotorFrequency = 0.0f;
         return;
     }
 
-    for (int i = 0; i < filterUpdatesPerIteration; i++) {
-
-        float frequency = constrainf(
-            (currentHarmonic + 1) * motorFrequency[currentMotor], currentFilter->minHz, currentFilter->maxHz);
-        biquadFilter_t *template = &currentFilter->notch[0][currentMotor][currentHarmonic];
-        // uncomment below to debug filter stepping. Need to also comment out motor rpm DEBUG_SET above
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 0, harmonic); */
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 1, motor); */
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 2, currentFilter == &gyroFilter); */
-        /* DEBUG_SET(DEBUG_RPM_FILTER, 3, frequency) */
-        
-        // fade out notch when approaching minHz (turn it off)
-        float weight = 1.0f;
-        if (frequency < currentFilter->minHz + currentFilter->fadeRangeHz) {
-            weight = (frequency - currentFilter->minHz) / currentFilter->fadeRangeHz;
-        }
+    // table lookups are cheap enough to move every notch of every motor each loop
+    for (int motor = 0; motor < getMotorCount(); motor++) {
+        for (int harmonic = 0; harmonic < gyroFilter->harmonics; harmonic++) {
 
-        biquadFilterUpdate(
-            template, frequency, currentFilter->looptimeUs, currentFilter->q, FILTER_NOTCH, weight);
-
-        for (int axis = 1; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilter_t *clone = &currentFilter->notch[axis][currentMotor][currentHarmonic];
-            clone->b0 = template->b0;
-            clone->b1 = template->b1;
-            clone->b2 = template->b2;
-            clone->a1 = template->a1;
-            clone->a2 = template->a2;
-            clone->weight = template->weight;
-        }
+            const float frequency = constrainf(
+                (harmonic + 1) * motorFrequency[motor], gyroFilter->minHz, gyroFilter->maxHz);
 
-        if (++currentHarmonic == currentFilter->harmonics) {
-            currentHarmonic = 0;
-            if (++currentFilterNumber == numberRpmNotchFilters) {
-                currentFilterNumber = 0;
-                if (++currentMotor == getMotorCount()) {
-                    currentMotor = 0;
-                }
-                minMotorFrequency = 0.0f;
+            // fade out notch when approaching minHz (turn it off)
+            float weight = 1.0f;
+            if (frequency < gyroFilter->minHz + gyroFilter->fadeRangeHz) {
+                weight = (frequency - gyroFilter->minHz) / gyroFilter->fadeRangeHz;
             }
-            currentFilter = &filters[currentFilterNumber];
+
+            // coefficients are shared by all axes, so a single update covers roll, pitch and yaw
+            biquadBankSectionUpdateNotch(
+                &gyroFilter->notch[motor * gyroFilter->harmonics + harmonic], &gyroFilter->notchTable, frequency, weight);
         }
     }
 }
@@ -31,6 +31,10 @@
  * to allocate a file on disk, we can carve it out of the freefile, and know that the clusters will be contiguous
  * without needing to read the FAT at all (the freefile's FAT is completely determined from its start cluster and file
  * size, which we get from the directory entry). This allows for extremely fast append-only logging.
+ *
+ * An append-only file keeps its next supercluster allocated ahead of the write cursor, and the FAT and directory
+ * updates that extend files are held back in the cache until a periodic commit. Runs of consecutive dirty sectors
+ * are sent to the card as multiple block writes, which those metadata updates would otherwise keep interrupting.
  */
 
 #include <stdint.h>
@@ -49,6 +53,7 @@
 #include "common/utils.h"
 
 #include "drivers/sdcard.h"
+#include "drivers/time.h"
 
 #include "fat_standard.h"
 
@@ -62,6 +67,12 @@
 
 #define AFATFS_NUM_CACHE_SECTORS 11
 
+/*
+ * This many of the cache sectors are set aside for the FAT and directories. Sectors of file data can't evict those, so
+ * streaming a long file through the cache doesn't push out the FAT sectors we need each time we extend the file.
+ */
+#define AFATFS_NUM_METADATA_CACHE_SECTORS 3
+
 // FAT filesystems are allowed to differ from these parameters, but we choose not to support those weird filesystems:
 #define AFATFS_SECTOR_SIZE  512
 #define AFATFS_NUM_FATS     2
@@ -77,6 +88,13 @@
  */
 #define AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT 4
 
+/*
+ * FAT and directory updates made while extending a file are held in the cache for this long, and after that until
+ * the card is between multiple block writes, so that they don't break up the writes of the file's data. afatfs_flush()
+ * writes them immediately, and closing a file brings the commit forward.
+ */
+#define AFATFS_METADATA_COMMIT_INTERVAL_MS 1000
+
 #define AFATFS_FILES_PER_DIRECTORY_SECTOR (AFATFS_SECTOR_SIZE / sizeof(fatDirectoryEntry_t))
 
 #define AFATFS_FAT32_FAT_ENTRIES_PER_SECTOR  (AFATFS_SECTOR_SIZE / sizeof(uint32_t))
@@ -105,6 +123,8 @@
 #define AFATFS_CACHE_DISCARDABLE  8
 // Increase the retain counter of the cache sector to prevent it from being discarded when in the in-sync state
 #define AFATFS_CACHE_RETAIN       16
+// The write is a FAT or directory update which may be held back until the next metadata commit
+#define AFATFS_CACHE_DEFER        32
 
 // Turn the largest free block on the disk into one contiguous file for efficient fragment-free allocation
 #define AFATFS_USE_FREEFILE
@@ -213,6 +233,24 @@ typedef struct afatfsCacheBlockDescriptor_t {
      * is overridden by the locked and retainCount flags.
      */
     unsigned discardable:1;
+
+    /*
+     * This block is dirty only with deferred metadata updates (AFATFS_CACHE_DEFER), so it will not be flushed until
+     * the next metadata commit. Any write to the block without that flag clears this.
+     */
+    unsigned deferred:1;
+
+    /*
+     * This block holds part of the FAT or a directory, so it lives in the metadata segment of the cache and is
+     * protected from eviction by file data.
+     */
+    unsigned metadata:1;
+
+    /*
+     * A lookup has already found this block since it was cached. Callers look the same sector up again on every poll
+     * until their operation completes, so only the first one counts as a cache hit.
+     */
+    unsigned hitCounted:1;
 } afatfsCacheBlockDescriptor_t;
 
 typedef enum {
@@ -264,6 +302,7 @@ typedef struct afatfsAppendSupercluster_t {
     uint32_t fatRewriteStartCluster;
     uint32_t fatRewriteEndCluster;
     afatfsAppendSuperclusterPhase_e phase;
+    bool preallocate; // Extend the file ahead of the cursor instead of moving the cursor into the new supercluster
 } afatfsAppendSupercluster_t;
 
 typedef enum {
@@ -329,8 +368,21 @@ typedef struct afatfsDeleteFile_t {
     afatfsCallback_t callback;
 } afatfsUnlinkFile_t;
 
+typedef enum {
+    AFATFS_CLOSE_FILE_PHASE_SAVE_DIRECTORY = 0,
+#ifdef AFATFS_USE_FREEFILE
+    AFATFS_CLOSE_FILE_PHASE_TERMINATE_CHAIN,
+    AFATFS_CLOSE_FILE_PHASE_RELEASE_SUPERCLUSTERS,
+#endif
+} afatfsCloseFilePhase_e;
+
 typedef struct afatfsCloseFile_t {
+#ifdef AFATFS_USE_FREEFILE
+    // Unused superclusters are given back to the freefile by a truncate sub-operation, so it must be our first member
+    afatfsTruncateFile_t releaseSuperclusters;
+#endif
     afatfsCallback_t callback;
+    afatfsCloseFilePhase_e phase;
 } afatfsCloseFile_t;
 
 typedef enum {
@@ -470,6 +522,17 @@ typedef struct afatfs_t {
     int cacheDirtyEntries; // The number of cache entries in the AFATFS_CACHE_STATE_DIRTY state
     bool cacheFlushInProgress;
 
+    afatfsCacheStats_t cacheStats;
+
+    bool metadataCommitPending; // The cache holds deferred sectors which are due to be written at metadataCommitDeadline
+    timeMs_t metadataCommitDeadline;
+
+#ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
+    // The sector which continues the last multiple block write we started, and how many more it expects
+    uint32_t multipleWriteNextSector;
+    uint32_t multipleWriteSectorsRemain;
+#endif
+
     afatfsFile_t openFiles[AFATFS_MAX_OPEN_FILES];
 
 #ifdef AFATFS_USE_FREEFILE
@@ -630,6 +693,22 @@ static void afatfs_cacheSectorMarkDirty(afatfsCacheBlockDescriptor_t *descriptor
         descriptor->state = AFATFS_CACHE_STATE_DIRTY;
         afatfs.cacheDirtyEntries++;
     }
+
+    descriptor->deferred = 0;
+}
+
+/**
+ * Mark a sector that has just become dirty as holding only deferred metadata, which will be written by the next
+ * metadata commit.
+ */
+static void afatfs_cacheSectorMarkDeferred(afatfsCacheBlockDescriptor_t *descriptor)
+{
+    descriptor->deferred = 1;
+
+    if (!afatfs.metadataCommitPending) {
+        afatfs.metadataCommitPending = true;
+        afatfs.metadataCommitDeadline = millis() + AFATFS_METADATA_COMMIT_INTERVAL_MS;
+    }
 }
 
 static void afatfs_cacheSectorInit(afatfsCacheBlockDescriptor_t *descriptor, uint32_t sectorIndex, bool locked)
@@ -645,6 +724,9 @@ static void afatfs_cacheSectorInit(afatfsCacheBlockDescriptor_t *descriptor, uin
     descriptor->locked = locked;
     descriptor->retainCount = 0;
     descriptor->discardable = 0;
+    descriptor->deferred = 0;
+    descriptor->metadata = 0;
+    descriptor->hitCounted = 0;
 }
 
 /**
@@ -704,17 +786,65 @@ static void afatfs_sdcardWriteComplete(sdcardBlockOperation_e operation, uint32_
     }
 }
 
+static bool afatfs_cacheSectorIsFlushable(const afatfsCacheBlockDescriptor_t *descriptor, bool commitMetadata)
+{
+    return descriptor->state == AFATFS_CACHE_STATE_DIRTY && !descriptor->locked && (commitMetadata || !descriptor->deferred);
+}
+
+#ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
+
+/**
+ * Count the run of dirty sectors in the cache which are ready to be flushed and lie on the disk consecutively,
+ * starting from (and including) the given sector.
+ */
+static uint32_t afatfs_cacheCountConsecutiveFlushableSectors(uint32_t sectorIndex, bool commitMetadata)
+{
+    uint32_t count = 0;
+    bool found;
+
+    do {
+        found = false;
+
+        for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
+            if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex + count
+                && afatfs_cacheSectorIsFlushable(&afatfs.cacheDescriptor[i], commitMetadata)) {
+                count++;
+                found = true;
+                break;
+            }
+        }
+    } while (found);
+
+    return count;
+}
+
+#endif
+
 /**
  * Attempt to flush the dirty cache entry with the given index to the SDcard.
  */
-static void afatfs_cacheFlushSector(int cacheIndex)
+static void afatfs_cacheFlushSector(int cacheIndex, bool commitMetadata)
 {
     afatfsCacheBlockDescriptor_t *cacheDescriptor = &afatfs.cacheDescriptor[cacheIndex];
+    bool written = false;
 
 #ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
-    if (cacheDescriptor->consecutiveEraseBlockCount) {
-        sdcard_beginWriteBlocks(cacheDescriptor->sectorIndex, cacheDescriptor->consecutiveEraseBlockCount);
+    bool continuesMultipleWrite = afatfs.multipleWriteSectorsRemain > 0 && cacheDescriptor->sectorIndex == afatfs.multipleWriteNextSector;
+    uint32_t blockCount = cacheDescriptor->consecutiveEraseBlockCount;
+
+    /*
+     * Even if nobody told us to expect a consecutive series of writes, a slow card leaves a backlog of dirty sectors
+     * behind, and if those are consecutive we can send them in one multiple block write.
+     */
+    if (blockCount == 0) {
+        blockCount = afatfs_cacheCountConsecutiveFlushableSectors(cacheDescriptor->sectorIndex, commitMetadata);
+    }
+
+    if (blockCount >= AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT) {
+        sdcard_beginWriteBlocks(cacheDescriptor->sectorIndex, blockCount);
     }
+#else
+    (void) commitMetadata;
 #endif
 
     switch (sdcard_writeBlock(cacheDescriptor->sectorIndex, afatfs_cacheSectorGetMemory(cacheIndex), afatfs_sdcardWriteComplete, 0)) {
@@ -723,12 +853,16 @@ static void afatfs_cacheFlushSector(int cacheIndex)
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_WRITING;
             afatfs.cacheFlushInProgress = true;
+            afatfs.cacheStats.flushes++;
+            written = true;
             break;
 
         case SDCARD_OPERATION_SUCCESS:
             // Buffer is already transmitted
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_IN_SYNC;
+            afatfs.cacheStats.flushes++;
+            written = true;
             break;
 
         case SDCARD_OPERATION_BUSY:
@@ -736,6 +870,22 @@ static void afatfs_cacheFlushSector(int cacheIndex)
         default:
             ;
     }
+
+#ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
+    if (written) {
+        if (continuesMultipleWrite) {
+            afatfs.multipleWriteNextSector++;
+            afatfs.multipleWriteSectorsRemain--;
+        } else if (blockCount >= AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT) {
+            afatfs.multipleWriteNextSector = cacheDescriptor->sectorIndex + 1;
+            afatfs.multipleWriteSectorsRemain = blockCount - 1;
+        } else {
+            afatfs.multipleWriteSectorsRemain = 0;
+        }
+    }
+#else
+    (void) written;
+#endif
 }
 
 // Check whether every sector in the cache that can be flushed has been synchronized
@@ -772,11 +922,13 @@ static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex
  * - The requested sector that already exists in the cache
  * - The index of an empty sector
  * - The index of a synced discardable sector
- * - The index of the oldest synced sector
+ * - The index of the oldest synced sector (for file data, the oldest synced sector that isn't in the metadata segment)
  *
  * Otherwise it returns -1 to signal failure (cache is full!)
+ *
+ * metadata - True if the sector holds part of the FAT or a directory, see AFATFS_NUM_METADATA_CACHE_SECTORS
  */
-static int afatfs_allocateCacheSector(uint32_t sectorIndex)
+static int afatfs_allocateCacheSector(uint32_t sectorIndex, bool metadata)
 {
     int allocateIndex;
     int emptyIndex = -1, discardableIndex = -1;
@@ -784,6 +936,11 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
     uint32_t oldestSyncedSectorLastUse = 0xFFFFFFFF;
     int oldestSyncedSectorIndex = -1;
 
+    // The least recently used synced sector outside of the metadata segment, and how full that segment is
+    uint32_t oldestSyncedDataSectorLastUse = 0xFFFFFFFF;
+    int oldestSyncedDataSectorIndex = -1;
+    int metadataSectors = 0;
+
     if (
         !afatfs_assert(
             afatfs.numClusters == 0 // We're unable to check sector bounds during startup since we haven't read volume label yet
@@ -809,6 +966,10 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
             return i;
         }
 
+        if (afatfs.cacheDescriptor[i].state != AFATFS_CACHE_STATE_EMPTY && afatfs.cacheDescriptor[i].metadata) {
+            metadataSectors++;
+        }
+
         switch (afatfs.cacheDescriptor[i].state) {
             case AFATFS_CACHE_STATE_EMPTY:
                 emptyIndex = i;
@@ -818,10 +979,16 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
                 if (!afatfs.cacheDescriptor[i].locked && afatfs.cacheDescriptor[i].retainCount == 0) {
                     if (afatfs.cacheDescriptor[i].discardable) {
                         discardableIndex = i;
-                    } else if (afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedSectorLastUse) {
-                        // This is older than last block we decided to evict, so evict this one in preference
-                        oldestSyncedSectorLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
-                        oldestSyncedSectorIndex = i;
+                    } else {
+                        if (afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedSectorLastUse) {
+                            // This is older than last block we decided to evict, so evict this one in preference
+                            oldestSyncedSectorLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
+                            oldestSyncedSectorIndex = i;
+                        }
+                        if (!afatfs.cacheDescriptor[i].metadata && afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedDataSectorLastUse) {
+                            oldestSyncedDataSectorLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
+                            oldestSyncedDataSectorIndex = i;
+                        }
                     }
                 }
             break;
@@ -830,6 +997,11 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
         }
     }
 
+    if (!metadata && metadataSectors <= AFATFS_NUM_METADATA_CACHE_SECTORS) {
+        // File data may only evict metadata which has overflowed its segment
+        oldestSyncedSectorIndex = oldestSyncedDataSectorIndex;
+    }
+
     if (emptyIndex > -1) {
         allocateIndex = emptyIndex;
     } else if (discardableIndex > -1) {
@@ -842,23 +1014,71 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
 
     if (allocateIndex > -1) {
         afatfs_cacheSectorInit(&afatfs.cacheDescriptor[allocateIndex], sectorIndex, false);
+        afatfs.cacheDescriptor[allocateIndex].metadata = metadata;
     }
 
     return allocateIndex;
 }
 
 /**
- * Attempt to flush dirty cache pages out to the sdcard, returning true if all flushable data has been flushed.
+ * Is the card part-way through a multiple block write which a dirty sector in the cache will continue? (Usually the
+ * sector that a file is currently appending to.)
  */
-bool afatfs_flush(void)
+static bool afatfs_multipleWriteInProgress(void)
 {
+#ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
+    if (afatfs.multipleWriteSectorsRemain > 0) {
+        afatfsCacheBlockDescriptor_t *descriptor = afatfs_findCacheSector(afatfs.multipleWriteNextSector);
+
+        return descriptor && descriptor->state == AFATFS_CACHE_STATE_DIRTY && !descriptor->deferred;
+    }
+#endif
+
+    return false;
+}
+
+/**
+ * Should the deferred FAT and directory updates in the cache be written now? That's the case once their commit
+ * deadline has passed, or when so much of the cache is dirty that holding them back would starve writers of space.
+ *
+ * Either way we wait for the card to finish any multiple block write it is in the middle of, since that drains the
+ * cache quickly and breaking it up would cost far more than the wait. A writer that keeps that write going, or leaves
+ * its last sector half-full, could hold it open indefinitely though, so we only wait for one further commit interval.
+ */
+static bool afatfs_metadataCommitDue(void)
+{
+    if (!afatfs.metadataCommitPending) {
+        return false;
+    }
+
+    const int32_t overdueMs = cmp32(millis(), afatfs.metadataCommitDeadline);
+
+    if (overdueMs < 0 && afatfs.cacheDirtyEntries <= AFATFS_NUM_CACHE_SECTORS / 2) {
+        return false;
+    }
+
+    return overdueMs >= AFATFS_METADATA_COMMIT_INTERVAL_MS || !afatfs_multipleWriteInProgress();
+}
+
+/**
+ * Flush the oldest flushable dirty sector to the sdcard, returning true if there was nothing left to flush. Sectors
+ * holding only deferred metadata are left alone unless commitMetadata is set.
+ */
+static bool afatfs_flushSectors(bool commitMetadata)
+{
+    bool deferredDirty = false;
+
     if (afatfs.cacheDirtyEntries > 0) {
         // Flush the oldest flushable sector
         uint32_t earliestSectorTime = 0xFFFFFFFF;
         int earliestSectorIndex = -1;
 
         for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked
+            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && afatfs.cacheDescriptor[i].deferred) {
+                deferredDirty = true;
+            }
+
+            if (afatfs_cacheSectorIsFlushable(&afatfs.cacheDescriptor[i], commitMetadata)
                 && (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime)
             ) {
                 earliestSectorIndex = i;
@@ -866,17 +1086,37 @@ bool afatfs_flush(void)
             }
         }
 
+        if (deferredDirty && !afatfs.metadataCommitPending) {
+            // A deferred sector failed to write during a commit, so the retry is already overdue
+            afatfs.metadataCommitPending = true;
+            afatfs.metadataCommitDeadline = millis();
+        }
+
         if (earliestSectorIndex > -1) {
-            afatfs_cacheFlushSector(earliestSectorIndex);
+            afatfs_cacheFlushSector(earliestSectorIndex, commitMetadata);
 
             // That flush will take time to complete so we may as well tell caller to come back later
             return false;
         }
     }
 
+    if (!deferredDirty) {
+        afatfs.metadataCommitPending = false;
+    }
+
     return true;
 }
 
+/**
+ * Attempt to flush dirty cache pages out to the sdcard, returning true if all flushable data has been flushed.
+ *
+ * This includes any FAT and directory updates that are waiting for the next metadata commit.
+ */
+bool afatfs_flush(void)
+{
+    return afatfs_flushSectors(true);
+}
+
 /**
  * Returns true if either the freefile or the regular cluster pool has been exhausted during a previous write operation.
  */
@@ -944,14 +1184,32 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
         return AFATFS_OPERATION_FAILURE;
     }
 
-    int cacheSectorIndex = afatfs_allocateCacheSector(physicalSectorIndex);
+    // Directory entries are written with AFATFS_CACHE_DEFER, which catches directories outside the FAT16 root too
+    const bool metadata = physicalSectorIndex < afatfs.clusterStartSector || (sectorFlags & AFATFS_CACHE_DEFER) != 0;
+    int cacheSectorIndex = afatfs_allocateCacheSector(physicalSectorIndex, metadata);
 
     if (cacheSectorIndex == -1) {
         // We don't have enough free cache to service this request right now, try again later
         return AFATFS_OPERATION_IN_PROGRESS;
     }
 
-    switch (afatfs.cacheDescriptor[cacheSectorIndex].state) {
+    afatfsCacheBlockDescriptor_t *descriptor = &afatfs.cacheDescriptor[cacheSectorIndex];
+
+    if (descriptor->state != AFATFS_CACHE_STATE_EMPTY && descriptor->state != AFATFS_CACHE_STATE_READING && !descriptor->hitCounted) {
+        descriptor->hitCounted = 1;
+        afatfs.cacheStats.hits++;
+    }
+
+    if (descriptor->state == AFATFS_CACHE_STATE_DIRTY && descriptor->metadata && (sectorFlags & AFATFS_CACHE_WRITE) != 0) {
+        // This update will go out in the same write as the ones already waiting in the sector
+        afatfs.cacheStats.coalescedWrites++;
+    }
+
+    if (metadata) {
+        descriptor->metadata = 1;
+    }
+
+    switch (descriptor->state) {
         case AFATFS_CACHE_STATE_READING:
             return AFATFS_OPERATION_IN_PROGRESS;
         break;
@@ -960,6 +1218,9 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
             if ((sectorFlags & AFATFS_CACHE_READ) != 0) {
                 if (sdcard_readBlock(physicalSectorIndex, afatfs_cacheSectorGetMemory(cacheSectorIndex), afatfs_sdcardReadComplete, 0)) {
                     afatfs.cacheDescriptor[cacheSectorIndex].state = AFATFS_CACHE_STATE_READING;
+                    // Finding the sector once the read completes is part of this miss
+                    afatfs.cacheDescriptor[cacheSectorIndex].hitCounted = 1;
+                    afatfs.cacheStats.misses++;
                 }
                 return AFATFS_OPERATION_IN_PROGRESS;
             }
@@ -984,10 +1245,18 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
         case AFATFS_CACHE_STATE_IN_SYNC:
             if ((sectorFlags & AFATFS_CACHE_WRITE) != 0) {
                 afatfs_cacheSectorMarkDirty(&afatfs.cacheDescriptor[cacheSectorIndex]);
+
+                if ((sectorFlags & AFATFS_CACHE_DEFER) != 0) {
+                    afatfs_cacheSectorMarkDeferred(&afatfs.cacheDescriptor[cacheSectorIndex]);
+                }
             }
             FALLTHROUGH;
 
         case AFATFS_CACHE_STATE_DIRTY:
+            if ((sectorFlags & (AFATFS_CACHE_WRITE | AFATFS_CACHE_DEFER)) == AFATFS_CACHE_WRITE) {
+                // This write can't wait for the next metadata commit, and neither can anything already in the sector
+                afatfs.cacheDescriptor[cacheSectorIndex].deferred = 0;
+            }
             if ((sectorFlags & AFATFS_CACHE_LOCK) != 0) {
                 afatfs.cacheDescriptor[cacheSectorIndex].locked = 1;
             }
@@ -1172,7 +1441,7 @@ static afatfsOperationStatus_e afatfs_FATSetNextCluster(uint32_t startCluster, u
 
     fatPhysicalSector = afatfs_fatSectorToPhysical(0, fatSectorIndex);
 
-    result = afatfs_cacheSector(fatPhysicalSector, &sector.bytes, AFATFS_CACHE_READ | AFATFS_CACHE_WRITE, 0);
+    result = afatfs_cacheSector(fatPhysicalSector, &sector.bytes, AFATFS_CACHE_READ | AFATFS_CACHE_WRITE | AFATFS_CACHE_DEFER, 0);
 
     if (result == AFATFS_OPERATION_SUCCESS) {
         if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16) {
@@ -1389,7 +1658,7 @@ static afatfsOperationStatus_e afatfs_FATFillWithPattern(afatfsFATPattern_e patt
         // The last entry we will fill inside this sector (exclusive):
         uint32_t lastEntryIndex = MIN(firstEntryIndex + (endCluster - *startCluster), afatfs_fatEntriesPerSector());
 
-        uint8_t cacheFlags = AFATFS_CACHE_WRITE | AFATFS_CACHE_DISCARDABLE;
+        uint8_t cacheFlags = AFATFS_CACHE_WRITE | AFATFS_CACHE_DISCARDABLE | AFATFS_CACHE_DEFER;
 
         if (firstEntryIndex > 0 || lastEntryIndex < afatfs_fatEntriesPerSector()) {
             // We're not overwriting the entire FAT sector so we must read the existing contents
@@ -1473,12 +1742,18 @@ static afatfsOperationStatus_e afatfs_saveDirectoryEntry(afatfsFilePtr_t file, a
 {
     uint8_t *sector;
     afatfsOperationStatus_e result;
+    uint8_t cacheFlags = AFATFS_CACHE_READ | AFATFS_CACHE_WRITE;
 
     if (file->directoryEntryPos.sectorNumberPhysical == 0) {
         return AFATFS_OPERATION_SUCCESS; // Root directories don't have a directory entry
     }
 
-    result = afatfs_cacheSector(file->directoryEntryPos.sectorNumberPhysical, &sector, AFATFS_CACHE_READ | AFATFS_CACHE_WRITE, 0);
+    // The exaggerated size we store while the file is growing can wait for the next metadata commit
+    if (mode == AFATFS_SAVE_DIRECTORY_NORMAL) {
+        cacheFlags |= AFATFS_CACHE_DEFER;
+    }
+
+    result = afatfs_cacheSector(file->directoryEntryPos.sectorNumberPhysical, &sector, cacheFlags, 0);
 
 #ifdef AFATFS_DEBUG_VERBOSE
     fprintf(stderr, "Saving directory entry to sector %u...\n", file->directoryEntryPos.sectorNumberPhysical);
@@ -1682,14 +1957,18 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
     afatfsAppendSupercluster_t *opState = &file->operation.state.appendSupercluster;
 
     afatfsOperationStatus_e status = AFATFS_OPERATION_FAILURE;
+    uint32_t newCluster;
 
     doMore:
     switch (opState->phase) {
         case AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT:
             // Our file steals the first cluster of the freefile
+            newCluster = afatfs.freeFile.firstCluster;
 
             // We can go ahead and write to that space before the FAT and directory are updated
-            file->cursorCluster = afatfs.freeFile.firstCluster;
+            if (!opState->preallocate) {
+                file->cursorCluster = newCluster;
+            }
             file->physicalSize += afatfs_superClusterSize();
 
             /* Remove the first supercluster from the freefile
@@ -1705,12 +1984,12 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
             afatfs.freeFile.physicalSize -= afatfs_superClusterSize();
 
             // The new supercluster needs to have its clusters chained contiguously and marked with a terminator at the end
-            opState->fatRewriteStartCluster = file->cursorCluster;
+            opState->fatRewriteStartCluster = newCluster;
             opState->fatRewriteEndCluster = opState->fatRewriteStartCluster + afatfs_fatEntriesPerSector();
 
             if (opState->previousCluster == 0) {
                 // This is the new first cluster in the file so we need to update the directory entry
-                file->firstCluster = file->cursorCluster;
+                file->firstCluster = newCluster;
             } else {
                 /*
                  * We also need to update the FAT of the supercluster that used to end the file so that it no longer
@@ -1786,6 +2065,7 @@ static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file)
     file->operation.operation = AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER;
     opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT;
     opState->previousCluster = file->cursorPreviousCluster;
+    opState->preallocate = false;
 
     return afatfs_appendSuperclusterContinue(file);
 }
@@ -2869,6 +3149,30 @@ static void afatfs_fcloseContinue(afatfsFilePtr_t file)
     afatfsCacheBlockDescriptor_t *descriptor;
     afatfsCloseFile_t *opState = &file->operation.state.closeFile;
 
+#ifdef AFATFS_USE_FREEFILE
+    switch (opState->phase) {
+        case AFATFS_CLOSE_FILE_PHASE_TERMINATE_CHAIN:
+            // The file now ends at the last supercluster we keep
+            if (afatfs_FATSetNextCluster(opState->releaseSuperclusters.startCluster - 1, 0xFFFFFFFF) != AFATFS_OPERATION_SUCCESS) {
+                return;
+            }
+
+            opState->phase = AFATFS_CLOSE_FILE_PHASE_RELEASE_SUPERCLUSTERS;
+            FALLTHROUGH;
+        case AFATFS_CLOSE_FILE_PHASE_RELEASE_SUPERCLUSTERS:
+            // Chain the rest onto the front of the freefile
+            if (afatfs_ftruncateContinue(file, false) != AFATFS_OPERATION_SUCCESS) {
+                return;
+            }
+
+            opState->phase = AFATFS_CLOSE_FILE_PHASE_SAVE_DIRECTORY;
+        break;
+        case AFATFS_CLOSE_FILE_PHASE_SAVE_DIRECTORY:
+            ;
+        break;
+    }
+#endif
+
     /*
      * Directories don't update their parent directory entries over time, because their fileSize field in the directory
      * never changes (when we add the first cluster to the directory we save the directory entry at that point and it
@@ -2906,11 +3210,53 @@ static void afatfs_fcloseContinue(afatfsFilePtr_t file)
     file->type = AFATFS_FILE_TYPE_NONE;
     file->operation.operation = AFATFS_FILE_OPERATION_NONE;
 
+    // Don't leave the file's FAT and directory updates waiting in the cache after it has been closed
+    if (afatfs.metadataCommitPending) {
+        afatfs.metadataCommitDeadline = millis();
+    }
+
     if (opState->callback) {
         opState->callback();
     }
 }
 
+#ifdef AFATFS_USE_FREEFILE
+
+/**
+ * Queue up the release of the superclusters of a contiguous file which were preallocated but never written to, so
+ * that they go back to the freefile when the file is closed.
+ */
+static void afatfs_fcloseReleaseUnusedSuperclusters(afatfsFilePtr_t file)
+{
+    afatfsCloseFile_t *opState = &file->operation.state.closeFile;
+    uint32_t superClusterSize = afatfs_superClusterSize();
+
+    if ((file->mode & AFATFS_FILE_MODE_CONTIGUOUS) == 0 || file->firstCluster == 0) {
+        return;
+    }
+
+    uint32_t keepSize = MAX(roundUpTo(file->logicalSize, superClusterSize), superClusterSize);
+
+    if (file->physicalSize <= keepSize
+        || !afatfs_assert(file->firstCluster + file->physicalSize / afatfs_clusterSize() == afatfs.freeFile.firstCluster)) {
+        return;
+    }
+
+    afatfsTruncateFile_t *release = &opState->releaseSuperclusters;
+
+    release->startCluster = file->firstCluster + keepSize / afatfs_clusterSize();
+    release->currentCluster = release->startCluster;
+    release->endCluster = afatfs.freeFile.firstCluster;
+    release->callback = NULL;
+    release->phase = AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_CONTIGUOUS;
+
+    file->physicalSize = keepSize;
+
+    opState->phase = AFATFS_CLOSE_FILE_PHASE_TERMINATE_CHAIN;
+}
+
+#endif
+
 /**
  * Returns true if an operation was successfully queued to close the file and destroy the file handle. If the file is
  * currently busy, false is returned and you should retry later.
@@ -2931,6 +3277,10 @@ bool afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback)
 
         file->operation.operation = AFATFS_FILE_OPERATION_CLOSE;
         file->operation.state.closeFile.callback = callback;
+        file->operation.state.closeFile.phase = AFATFS_CLOSE_FILE_PHASE_SAVE_DIRECTORY;
+#ifdef AFATFS_USE_FREEFILE
+        afatfs_fcloseReleaseUnusedSuperclusters(file);
+#endif
         afatfs_fcloseContinue(file);
         return true;
     }
@@ -3067,6 +3417,46 @@ bool afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t c
     return file != NULL;
 }
 
+#ifdef AFATFS_USE_FREEFILE
+
+static bool afatfs_fileIsPreallocating(afatfsFilePtr_t file)
+{
+    return file->operation.operation == AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER && file->operation.state.appendSupercluster.preallocate;
+}
+
+/**
+ * A contiguous append-mode file keeps the next supercluster allocated ahead of its cursor, so that writes don't have
+ * to stop for the FAT and directory updates of a new supercluster when the cursor reaches the end of the current one.
+ *
+ * Call after writing to the file. Once the cursor passes the middle of the file's last supercluster, this queues the
+ * append of the next supercluster. Writes to the file may continue while that operation runs, since the cursor stays
+ * within clusters that are already allocated. Superclusters left unused are given back to the freefile by fclose().
+ */
+static void afatfs_preallocateSupercluster(afatfsFilePtr_t file)
+{
+    uint32_t superClusterSize = afatfs_superClusterSize();
+
+    if ((file->mode & (AFATFS_FILE_MODE_APPEND | AFATFS_FILE_MODE_CONTIGUOUS)) != (AFATFS_FILE_MODE_APPEND | AFATFS_FILE_MODE_CONTIGUOUS)
+        || afatfs_fileIsBusy(file)
+        || afatfs_isEndOfAllocatedFile(file)
+        || file->physicalSize - file->cursorOffset > superClusterSize / 2
+        || afatfs.freeFile.logicalSize < superClusterSize) {
+        return;
+    }
+
+    afatfsAppendSupercluster_t *opState = &file->operation.state.appendSupercluster;
+
+    file->operation.operation = AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER;
+    opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT;
+    // The file's final cluster is the one just before the start of the freefile
+    opState->previousCluster = afatfs.freeFile.firstCluster - 1;
+    opState->preallocate = true;
+
+    afatfs_appendSuperclusterContinue(file);
+}
+
+#endif
+
 /**
  * Write a single character to the file at the current cursor position. If the cache is too busy to accept the write,
  * it is silently dropped.
@@ -3107,8 +3497,12 @@ uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len
         return 0;
     }
 
-    if (afatfs_fileIsBusy(file)) {
-        // There might be a seek pending
+    // There might be a seek pending, but preallocation of the next supercluster doesn't stop us writing
+    if (afatfs_fileIsBusy(file)
+#ifdef AFATFS_USE_FREEFILE
+        && !afatfs_fileIsPreallocating(file)
+#endif
+    ) {
         return 0;
     }
 
@@ -3153,6 +3547,10 @@ uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len
         cursorOffsetInSector = 0;
     }
 
+#ifdef AFATFS_USE_FREEFILE
+    afatfs_preallocateSupercluster(file);
+#endif
+
     return writtenBytes;
 }
 
@@ -3565,7 +3963,7 @@ void afatfs_poll(void)
 {
     // Only attempt to continue FS operations if the card is present & ready, otherwise we would just be wasting time
     if (sdcard_poll()) {
-        afatfs_flush();
+        afatfs_flushSectors(afatfs_metadataCommitDue());
 
         switch (afatfs.filesystemState) {
             case AFATFS_FILESYSTEM_STATE_INITIALIZATION:
@@ -3634,6 +4032,14 @@ afatfsError_e afatfs_getLastError(void)
     return afatfs.lastError;
 }
 
+/**
+ * Get the sector cache's hit, miss and flush counters, which count from when the filesystem was initialised.
+ */
+const afatfsCacheStats_t *afatfs_getCacheStats(void)
+{
+    return &afatfs.cacheStats;
+}
+
 void afatfs_init(void)
 {
 #ifdef STM32H7
@@ -60,6 +60,13 @@ typedef enum {
     AFATFS_SEEK_END
 } afatfsSeek_e;
 
+typedef struct afatfsCacheStats_t {
+    uint32_t hits;            // Sectors found already in the cache, each counted once while it stays cached
+    uint32_t misses;          // Sectors we had to read from the card
+    uint32_t flushes;         // Sectors written to the card
+    uint32_t coalescedWrites; // FAT and directory updates to a sector which was already waiting to be flushed
+} afatfsCacheStats_t;
+
 typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
 typedef void (*afatfsCallback_t)(void);
 
@@ -94,3 +101,4 @@ bool afatfs_isFull(void);
 afatfsFilesystemState_e afatfs_getFilesystemState(void);
 afatfsError_e afatfs_getLastError(void);
 bool afatfs_sectorCacheInSync(void);
+const afatfsCacheStats_t *afatfs_getCacheStats(void);
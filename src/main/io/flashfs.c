@@ -22,8 +22,8 @@
  * This provides a stream interface to a flash chip if one is present.
  *
  * On statup, call flashfsInit() after initialising the flash chip in order to init the filesystem. This will
- * result in the file pointer being pointed at the first free block found, or at the end of the device if the
- * flash chip is full.
+ * result in the file pointer being pointed at the end of the last log recorded in the volume's index (or failing
+ * that, the first free block found), or at the end of the device if the flash chip is full.
  *
  * Note that bits can only be set to 0 when writing, not back to 1 from 0. You must erase sectors in order
  * to bring bits back to 1 again.
@@ -38,17 +38,80 @@
 
 #include "platform.h"
 
+#include "common/crc.h"
+#include "common/maths.h"
 #include "common/printf.h"
+#include "common/utils.h"
 #include "drivers/flash.h"
+#include "drivers/time.h"
 
 #include "io/flashfs.h"
 
+enum {
+    /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
+     * at the end of the last written data. But smaller blocksizes will require more searching.
+     */
+    FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
+
+    /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
+    FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
+    FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
+};
+
+/*
+ * Unless the volume is very small, its last sector is given over to an index of the logs written to it, so that we
+ * can find the end of the data and list the logs without searching the flash.
+ *
+ * A record of each log's extent is written when the log is closed, in a page of its own since NAND flash can only
+ * program part of a page a few times. Records are written in order, so the last one is found with a binary search
+ * for the first erased page. Once every page has been used the sector is erased and the index starts over, the logs
+ * it forgets about can still be found by searching the flash.
+ *
+ * A log is closed from the PID loop, which can't wait for the flash, so the rest of its data and then the record are
+ * written a step at a time as the flash becomes ready. Until they have been written flashfsIsReady() returns false,
+ * which holds off the next log.
+ */
+#define FLASHFS_INDEX_MAGIC 0x1D5F
+#define FLASHFS_INDEX_MIN_VOLUME_SECTORS 8
+
+typedef struct flashfsIndexRecord_s {
+    uint16_t magic;
+    uint16_t crc; // Of start and end
+    uint32_t start;
+    uint32_t end;
+} flashfsIndexRecord_t;
+
+typedef enum {
+    FLASHFS_INDEX_IDLE,
+    FLASHFS_INDEX_DRAIN, // The end of the log is still in the write buffer
+    FLASHFS_INDEX_ERASE, // The index is full, erase its sector before writing the record
+    FLASHFS_INDEX_PROGRAM,
+    FLASHFS_INDEX_FLUSH,
+} flashfsIndexState_e;
+
 static const flashPartition_t *flashPartition = NULL;
 static const flashGeometry_t *flashGeometry = NULL;
 static uint32_t flashfsSize = 0;
 
+// The number of records the index sector can hold, or zero if the volume doesn't have an index
+static uint16_t indexSlotCount = 0;
+// The index sector doesn't hold an index (e.g. a log from before we had one ran into it), until the volume is erased
+static bool indexDisabled = false;
+// The slot that the next record will be written to, which is also the number of records in the index
+static uint16_t indexNextSlot = 0;
+// How far the record of the last log closed has got on its way to the flash
+static flashfsIndexState_e indexState = FLASHFS_INDEX_IDLE;
+// Must stay valid until the flash has been programmed
+static DMA_DATA_ZERO_INIT flashfsIndexRecord_t indexWriteBuffer;
+// Where the log being written began, the extent recorded in the index when it is closed runs from here to the tail
+static uint32_t logStartAddress = 0;
+
 static DMA_DATA_ZERO_INIT uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
 
+// The size of each page buffer, and of the circular write buffer they make up, to suit the flash's page size
+static uint16_t pageBufferSize = FLASHFS_MAX_PAGE_BUFFER_SIZE;
+static uint16_t writeBufferSize = FLASHFS_WRITE_BUFFER_SIZE;
+
 /* The position of our head and tail in the circular flash write buffer.
  *
  * The head is the index that a byte would be inserted into on writing, while the tail is the index of the
@@ -59,8 +122,8 @@ static DMA_DATA_ZERO_INIT uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
  * The tail is advanced once a write is complete up to the location behind head. The tail is advanced
  * by a callback from the FLASH write routine. This prevents data being overwritten whilst a write is in progress.
  */
-static uint8_t bufferHead = 0;
-static volatile uint8_t bufferTail = 0;
+static uint16_t bufferHead = 0;
+static volatile uint16_t bufferTail = 0;
 
 /* Track if there is new data to write. Until the contents of the buffer have been completely
  * written flashfsFlushAsync() will be repeatedly called. The tail pointer is only updated
@@ -71,6 +134,9 @@ static volatile uint8_t bufferTail = 0;
   */
 static volatile bool dataWritten = true;
 
+// Far longer than the transfer of a page program takes, flashfsFlushSync() gives up waiting for one after this
+#define FLASHFS_PROGRAM_TIMEOUT_MS 100
+
 //#define CHECK_FLASH
 
 #ifdef CHECK_FLASH
@@ -86,6 +152,9 @@ uint32_t checkFlashErrors = 0;
 // The position of the buffer's tail in the overall flash address space:
 static uint32_t tailAddress = 0;
 
+static bool flashfsUpdateIndex(void);
+static void flashfsFinishLog(void);
+
 static void flashfsClearBuffer(void)
 {
     bufferTail = bufferHead = 0;
@@ -126,6 +195,11 @@ void flashfsEraseCompletely(void)
     flashfsClearBuffer();
 
     flashfsSetTailAddress(0);
+
+    indexDisabled = false;
+    indexNextSlot = 0;
+    indexState = FLASHFS_INDEX_IDLE;
+    logStartAddress = 0;
 }
 
 /**
@@ -154,14 +228,23 @@ void flashfsEraseRange(uint32_t start, uint32_t end)
     }
 }
 
+/**
+ * Data can be programmed unless the record of a closed log is on its way to the index, which this carries on with.
+ * The end of a log being closed is itself programmed through here, so doesn't wait.
+ */
+static bool flashfsIndexAllowsData(void)
+{
+    return indexState == FLASHFS_INDEX_DRAIN || flashfsUpdateIndex();
+}
+
 /**
  * Return true if the flash is not currently occupied with an operation.
  */
 bool flashfsIsReady(void)
 {
-    // Check for flash chip existence first, then check if ready.
+    // Check for flash chip existence first, then check if ready, with the record of the last log written.
 
-    return (flashfsIsSupported() && flashIsReady());
+    return (flashfsIsSupported() && flashfsUpdateIndex() && flashIsReady());
 }
 
 bool flashfsIsSupported(void)
@@ -179,7 +262,7 @@ static uint32_t flashfsTransmitBufferUsed(void)
     if (bufferHead >= bufferTail)
         return bufferHead - bufferTail;
 
-    return FLASHFS_WRITE_BUFFER_SIZE - bufferTail + bufferHead;
+    return writeBufferSize - bufferTail + bufferHead;
 }
 
 /**
@@ -187,7 +270,8 @@ static uint32_t flashfsTransmitBufferUsed(void)
  */
 uint32_t flashfsGetWriteBufferSize(void)
 {
-    return FLASHFS_WRITE_BUFFER_USABLE;
+    // One byte of the circular buffer is never used, so that a full buffer can be told apart from an empty one
+    return writeBufferSize - 1;
 }
 
 /**
@@ -198,6 +282,26 @@ uint32_t flashfsGetWriteBufferFreeSpace(void)
     return flashfsGetWriteBufferSize() - flashfsTransmitBufferUsed();
 }
 
+/**
+ * Get the number of bytes from the tail to the end of the page buffer that it lies in.
+ */
+static uint32_t flashfsTailBytesToPageBoundary(void)
+{
+    return pageBufferSize - tailAddress % pageBufferSize;
+}
+
+/**
+ * Is the page buffer at the tail full, so that it can be programmed in one go?
+ *
+ * Programming a whole page takes the flash barely longer than programming a few bytes of it, and we can only start
+ * one program each time we find the flash ready, so we hold data back until a page is full rather than programming
+ * whatever has trickled in. Meanwhile the next page buffer fills up.
+ */
+static bool flashfsPageBufferIsFull(void)
+{
+    return flashfsTransmitBufferUsed() >= flashfsTailBytesToPageBoundary();
+}
+
 /**
  * Called after bytes have been written from the buffer to advance the position of the tail by the given amount.
  */
@@ -206,8 +310,8 @@ static void flashfsAdvanceTailInBuffer(uint32_t delta)
     bufferTail += delta;
 
     // Wrap tail around the end of the buffer
-    if (bufferTail >= FLASHFS_WRITE_BUFFER_SIZE) {
-        bufferTail -= FLASHFS_WRITE_BUFFER_SIZE;
+    if (bufferTail >= writeBufferSize) {
+        bufferTail -= writeBufferSize;
     }
 }
 
@@ -248,11 +352,12 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
 
     // It's OK to overwrite the buffer addresses/lengths being passed in
 
-    // If sync is true, block until the FLASH device is ready, otherwise return 0 if the device isn't ready
+    // If sync is true, block until the FLASH device is ready, otherwise return 0 if the device isn't ready. Either way
+    // the record of the last log goes first.
     if (sync) {
-        while (!flashIsReady());
+        while (!flashfsIndexAllowsData() || !flashIsReady());
     } else {
-        if (!flashIsReady()) {
+        if (!flashfsIndexAllowsData() || !flashIsReady()) {
             return 0;
         }
     }
@@ -300,7 +405,7 @@ static int flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t bufferS
         bufferSizes[1] = 0;
         return 1;
     } else if (bufferHead < bufferTail) {
-        bufferSizes[0] = FLASHFS_WRITE_BUFFER_SIZE - bufferTail;
+        bufferSizes[0] = writeBufferSize - bufferTail;
         bufferSizes[1] = bufferHead;
         if (bufferSizes[1] == 0) {
             return 1;
@@ -315,6 +420,26 @@ static int flashfsGetDirtyDataBuffers(uint8_t const *buffers[], uint32_t bufferS
     return 0;
 }
 
+/*
+ * Like flashfsGetDirtyDataBuffers(), but stops at the end of the page buffer at the tail so that the data can be
+ * programmed in one go.
+ */
+static int flashfsGetDirtyPageBuffers(uint8_t const *buffers[], uint32_t bufferSizes[])
+{
+    const int bufCount = flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+    const uint32_t pageRemaining = flashfsTailBytesToPageBoundary();
+
+    if (bufferSizes[0] >= pageRemaining) {
+        bufferSizes[0] = pageRemaining;
+        bufferSizes[1] = 0;
+        return 1;
+    }
+
+    bufferSizes[1] = MIN(bufferSizes[1], pageRemaining - bufferSizes[0]);
+
+    return bufCount;
+}
+
 
 static bool flashfsNewData()
 {
@@ -340,10 +465,13 @@ uint32_t flashfsGetOffset(void)
 /**
  * If the flash is ready to accept writes, flush the buffer to it.
  *
+ * Unless force is set, a page buffer is only flushed once it is full, see flashfsPageBufferIsFull(). Set force to
+ * flush out the last partial page when you are done writing.
+ *
  * Returns true if all data in the buffer has been flushed to the device, or false if
  * there is still data to be written (call flush again later).
  */
-bool flashfsFlushAsync(void)
+bool flashfsFlushAsync(bool force)
 {
     uint8_t const * buffers[2];
     uint32_t bufferSizes[2];
@@ -353,6 +481,10 @@ bool flashfsFlushAsync(void)
         return true; // Nothing to flush
     }
 
+    if (!force && !flashfsPageBufferIsFull()) {
+        return false;
+    }
+
     if (!flashfsNewData()) {
         // The previous write has yet to complete
         return false;
@@ -372,7 +504,7 @@ bool flashfsFlushAsync(void)
     }
 #endif
 
-    bufCount = flashfsGetDirtyDataBuffers(buffers, bufferSizes);
+    bufCount = flashfsGetDirtyPageBuffers(buffers, bufferSizes);
     if (bufCount) {
         flashfsWriteBuffers(buffers, bufferSizes, bufCount, false);
     }
@@ -392,13 +524,26 @@ void flashfsFlushSync(void)
     uint32_t bufferSizes[2];
     int bufCount;
 
-    if (flashfsBufferIsEmpty()) {
-        return; // Nothing to flush
+    // The buffer may span more than one page, which each need a program of their own
+    while (!flashfsBufferIsEmpty()) {
+        // Wait for the tail to advance past the last write so that we don't send the same data twice. If the transfer
+        // never completes the rest of the buffer stays unflushed, rather than the caller hanging.
+        const timeMs_t startMs = millis();
+        while (!flashfsNewData()) {
+            if (cmp32(millis(), startMs) >= FLASHFS_PROGRAM_TIMEOUT_MS) {
+                return;
+            }
+        }
+
+        bufCount = flashfsGetDirtyPageBuffers(buffers, bufferSizes);
+        if (bufCount == 0 || flashfsWriteBuffers(buffers, bufferSizes, bufCount, true) == 0) {
+            break;
+        }
     }
 
-    bufCount = flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    if (bufCount) {
-        flashfsWriteBuffers(buffers, bufferSizes, bufCount, true);
+    // Then finish off a log being closed, now that its end is on the flash
+    if (flashfsBufferIsEmpty() || flashfsIsEOF()) {
+        while (!flashfsUpdateIndex());
     }
 
     while (!flashIsReady());
@@ -422,12 +567,12 @@ void flashfsWriteByte(uint8_t byte)
 
     flashWriteBuffer[bufferHead++] = byte;
 
-    if (bufferHead >= FLASHFS_WRITE_BUFFER_SIZE) {
+    if (bufferHead >= writeBufferSize) {
         bufferHead = 0;
     }
 
-    if (flashfsTransmitBufferUsed() >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
-        flashfsFlushAsync();
+    if (flashfsPageBufferIsFull()) {
+        flashfsFlushAsync(false);
     }
 }
 
@@ -442,23 +587,49 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync)
     uint8_t const * buffers[2];
     uint32_t bufferSizes[2];
     int bufCount;
-    uint32_t totalBufSize;
 
     // Buffer up the data the user supplied instead of writing it right away
+#ifdef CHECK_FLASH
     for (unsigned int i = 0; i < len; i++) {
         flashfsWriteByte(data[i]);
     }
+#else
+    while (len > 0) {
+        /*
+         * Copy in runs which stop at the end of the ring and where the page buffer at the tail fills up, so a flush is
+         * started at the same points as it would be for byte by byte writes.
+         */
+        const uint32_t used = flashfsTransmitBufferUsed();
+        const uint32_t pageRemaining = flashfsTailBytesToPageBoundary();
+        uint32_t runLength = MIN(len, (uint32_t)(writeBufferSize - bufferHead));
+        if (used < pageRemaining) {
+            runLength = MIN(runLength, pageRemaining - used);
+        }
 
-    // There could be two dirty buffers to write out already:
-    bufCount = flashfsGetDirtyDataBuffers(buffers, bufferSizes);
-    totalBufSize = bufferSizes[0] + bufferSizes[1];
+        memcpy(&flashWriteBuffer[bufferHead], data, runLength);
+
+        bufferHead += runLength;
+        if (bufferHead >= writeBufferSize) {
+            bufferHead = 0;
+        }
+        data += runLength;
+        len -= runLength;
+
+        if (flashfsPageBufferIsFull()) {
+            flashfsFlushAsync(false);
+        }
+    }
+#endif
 
     /*
-     * Would writing this data to our buffer cause our buffer to reach the flush threshold? If so try to write through
-     * to the flash now
+     * Is a page buffer full and waiting for the flash? If so try to write it through to the flash now (waiting for the
+     * flash to become ready if the write is synchronous)
      */
-    if (bufCount && (totalBufSize >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN)) {
-        flashfsWriteBuffers(buffers, bufferSizes, bufCount, sync);
+    if (flashfsPageBufferIsFull()) {
+        bufCount = flashfsGetDirtyPageBuffers(buffers, bufferSizes);
+        if (bufCount) {
+            flashfsWriteBuffers(buffers, bufferSizes, bufCount, sync);
+        }
     }
 }
 
@@ -486,30 +657,19 @@ int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
 }
 
 /**
- * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ * Find the offset of the start of the free space on the device at or after the given offset (or the size of the device
+ * if it is full).
  */
-int flashfsIdentifyStartOfFreeSpace(void)
+static uint32_t flashfsFindStartOfFreeSpace(uint32_t start)
 {
     /* Find the start of the free space on the device by examining the beginning of blocks with a binary search,
      * looking for ones that appear to be erased. We can achieve this with good accuracy because an erased block
      * is all bits set to 1, which pretty much never appears in reasonable size substrings of blackbox logs.
      *
-     * To do better we might write a volume header instead, which would mark how much free space remains. But keeping
-     * a header up to date while logging would incur more writes to the flash, which would consume precious write
-     * bandwidth and block more often.
+     * The index at the end of the volume lets us skip this search at startup, but we still fall back on it if the
+     * index is missing or something was written after its last record.
      */
 
-    enum {
-        /* We can choose whatever power of 2 size we like, which determines how much wastage of free space we'll have
-         * at the end of the last written data. But smaller blocksizes will require more searching.
-         */
-        FREE_BLOCK_SIZE = 2048, // XXX This can't be smaller than page size for underlying flash device.
-
-        /* We don't expect valid data to ever contain this many consecutive uint32_t's of all 1 bits: */
-        FREE_BLOCK_TEST_SIZE_INTS = 4, // i.e. 16 bytes
-        FREE_BLOCK_TEST_SIZE_BYTES = FREE_BLOCK_TEST_SIZE_INTS * sizeof(uint32_t)
-    };
-
     STATIC_ASSERT(FREE_BLOCK_SIZE >= FLASH_MAX_PAGE_SIZE, FREE_BLOCK_SIZE_too_small);
 
     STATIC_DMA_DATA_AUTO union {
@@ -517,7 +677,7 @@ int flashfsIdentifyStartOfFreeSpace(void)
         uint32_t ints[FREE_BLOCK_TEST_SIZE_INTS];
     } testBuffer;
 
-    int left = 0; // Smallest block index in the search region
+    int left = (start + FREE_BLOCK_SIZE - 1) / FREE_BLOCK_SIZE; // Smallest block index in the search region
     int right = flashfsSize / FREE_BLOCK_SIZE; // One past the largest block index in the search region
     int mid;
     int result = right;
@@ -556,6 +716,288 @@ int flashfsIdentifyStartOfFreeSpace(void)
     return result * FREE_BLOCK_SIZE;
 }
 
+/**
+ * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ */
+int flashfsIdentifyStartOfFreeSpace(void)
+{
+    return flashfsFindStartOfFreeSpace(0);
+}
+
+/**
+ * Does the flash at the given offset look like it has been erased?
+ */
+static bool flashfsIsErasedAt(uint32_t address)
+{
+    STATIC_DMA_DATA_AUTO uint8_t testBuffer[FREE_BLOCK_TEST_SIZE_BYTES];
+
+    if (flashReadBytes(address, testBuffer, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+        return false;
+    }
+
+    for (int i = 0; i < FREE_BLOCK_TEST_SIZE_BYTES; i++) {
+        if (testBuffer[i] != 0xFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static uint32_t flashfsIndexSlotAddress(uint16_t slot)
+{
+    // The index occupies the sector after the end of the volume
+    return flashfsSize + slot * flashGeometry->pageSize;
+}
+
+static bool flashfsReadIndexRecord(uint16_t slot, flashfsIndexRecord_t *record)
+{
+    STATIC_DMA_DATA_AUTO flashfsIndexRecord_t readBuffer;
+
+    if (flashReadBytes(flashfsIndexSlotAddress(slot), (uint8_t *)&readBuffer, sizeof(readBuffer)) < (int)sizeof(readBuffer)) {
+        return false;
+    }
+
+    *record = readBuffer;
+
+    return true;
+}
+
+static uint16_t flashfsIndexRecordCrc(const flashfsIndexRecord_t *record)
+{
+    return crc16_ccitt_update(0, &record->start, sizeof(record->start) + sizeof(record->end));
+}
+
+static bool flashfsIndexRecordIsValid(const flashfsIndexRecord_t *record)
+{
+    return record->magic == FLASHFS_INDEX_MAGIC && record->crc == flashfsIndexRecordCrc(record)
+        && record->start <= record->end && record->end <= flashfsSize;
+}
+
+static bool flashfsIndexIsUsable(void)
+{
+    return indexSlotCount > 0 && !indexDisabled;
+}
+
+/**
+ * Find the number of records in the index with a binary search for the first erased slot.
+ *
+ * Returns true and the last record if there is one and it is valid.
+ */
+static bool flashfsLoadIndex(flashfsIndexRecord_t *lastRecord)
+{
+    flashfsIndexRecord_t record;
+    int left = 0; // Smallest slot in the search region
+    int right = indexSlotCount; // One past the largest slot in the search region
+    int lastRecordSlot = -1;
+
+    indexNextSlot = 0;
+
+    if (!flashfsIndexIsUsable()) {
+        return false;
+    }
+
+    while (left < right) {
+        const int mid = (left + right) / 2;
+
+        if (!flashfsReadIndexRecord(mid, &record)) {
+            indexDisabled = true;
+            return false;
+        }
+
+        if (record.magic == 0xFFFF) {
+            right = mid;
+        } else {
+            // Save a read later if this turns out to be the last record
+            lastRecordSlot = mid;
+            *lastRecord = record;
+
+            left = mid + 1;
+        }
+    }
+
+    indexNextSlot = left;
+
+    if (indexNextSlot == 0) {
+        return false;
+    }
+
+    if (lastRecordSlot != indexNextSlot - 1 && !flashfsReadIndexRecord(indexNextSlot - 1, lastRecord)) {
+        indexDisabled = true;
+        return false;
+    }
+
+    if (lastRecord->magic != FLASHFS_INDEX_MAGIC) {
+        // This isn't an index at all
+        indexDisabled = true;
+        indexNextSlot = 0;
+        return false;
+    }
+
+    // A record that fails its CRC was cut short by a power loss, we can carry on after it
+    return flashfsIndexRecordIsValid(lastRecord);
+}
+
+/**
+ * Take the next step in writing out the record of a log, if the flash is ready for it.
+ *
+ * Returns true if the record has been written (or there is none).
+ */
+static bool flashfsUpdateIndex(void)
+{
+    if (indexState == FLASHFS_INDEX_IDLE) {
+        return true;
+    }
+
+    if (indexState == FLASHFS_INDEX_DRAIN) {
+        // The rest of the log goes out a page at a time first, unless it has run into the end of the volume
+        if (!flashfsFlushAsync(true) && !flashfsIsEOF()) {
+            return false;
+        }
+        if (!flashIsReady()) {
+            return false;
+        }
+        flashfsFinishLog();
+    }
+
+    if (!flashIsReady()) {
+        return false;
+    }
+
+    switch (indexState) {
+    case FLASHFS_INDEX_ERASE:
+        flashEraseSector(flashfsIndexSlotAddress(0));
+        indexNextSlot = 0;
+        indexState = FLASHFS_INDEX_PROGRAM;
+        break;
+
+    case FLASHFS_INDEX_PROGRAM:
+        flashPageProgram(flashfsIndexSlotAddress(indexNextSlot), (const uint8_t *)&indexWriteBuffer, sizeof(indexWriteBuffer), NULL);
+        indexState = FLASHFS_INDEX_FLUSH;
+        break;
+
+    case FLASHFS_INDEX_FLUSH:
+        flashFlush();
+        indexNextSlot++;
+        indexState = FLASHFS_INDEX_IDLE;
+        break;
+
+    default:
+        break;
+    }
+
+    return indexState == FLASHFS_INDEX_IDLE;
+}
+
+/**
+ * Record the extent of a log in the index, starting the index over if it is full. This only sets the record up,
+ * flashfsUpdateIndex() writes it out without waiting for the flash.
+ */
+static void flashfsAppendIndexRecord(uint32_t start, uint32_t end)
+{
+    if (!flashfsIndexIsUsable()) {
+        return;
+    }
+
+    indexWriteBuffer.magic = FLASHFS_INDEX_MAGIC;
+    indexWriteBuffer.start = start;
+    indexWriteBuffer.end = end;
+    indexWriteBuffer.crc = flashfsIndexRecordCrc(&indexWriteBuffer);
+
+    indexState = indexNextSlot >= indexSlotCount ? FLASHFS_INDEX_ERASE : FLASHFS_INDEX_PROGRAM;
+}
+
+/**
+ * Get the number of logs recorded in the index, the oldest first. Zero if there is no index, in which case the logs
+ * can only be found by searching the flash.
+ */
+int flashfsGetLogCount(void)
+{
+    return flashfsIndexIsUsable() ? indexNextSlot : 0;
+}
+
+/**
+ * Get the extent [start...end) of a log recorded in the index.
+ *
+ * Returns false if the record is damaged.
+ */
+bool flashfsGetLog(int index, uint32_t *start, uint32_t *end)
+{
+    flashfsIndexRecord_t record;
+
+    if (index < 0 || index >= flashfsGetLogCount()) {
+        return false;
+    }
+
+    // As for flashfsReadAbs(), get any buffered data out to the flash first
+    flashfsFlushSync();
+
+    if (!flashfsReadIndexRecord(index, &record) || !flashfsIndexRecordIsValid(&record)) {
+        return false;
+    }
+
+    *start = record.start;
+    *end = record.end;
+
+    return true;
+}
+
+/**
+ * NAND flash pages can't be programmed again once they have been written out, so after a log is closed the next one
+ * has to start on a fresh page.
+ */
+static uint32_t flashfsNextWritableAddress(uint32_t address)
+{
+    switch(flashGeometry->flashType) {
+    case FLASH_TYPE_NOR:
+        break;
+
+    case FLASH_TYPE_NAND:
+        {
+            const uint32_t pageSize = flashGeometry->pageSize;
+            address = (address + pageSize - 1) & ~(pageSize - 1);
+        }
+        break;
+    }
+
+    return address;
+}
+
+/**
+ * Find the end of the data on the volume, using the index if possible.
+ */
+static uint32_t flashfsFindTail(void)
+{
+    flashfsIndexRecord_t lastRecord;
+    uint32_t tail = 0;
+
+    if (flashfsLoadIndex(&lastRecord)) {
+        tail = flashfsNextWritableAddress(lastRecord.end);
+    } else if (!flashfsIndexIsUsable() || indexNextSlot > 0) {
+        // Nothing we can trust in the index
+        return flashfsFindStartOfFreeSpace(0);
+    }
+
+    if (tail >= flashfsSize || flashfsIsErasedAt(tail)) {
+        return tail;
+    }
+
+    /*
+     * Something was written after the last record, a log that wasn't closed before the power was cut (or if the index
+     * is empty, logs from before it existed). Search for its end and record it so that it can be found next time.
+     */
+    const uint32_t freeSpace = flashfsFindStartOfFreeSpace(tail);
+
+    if (indexNextSlot > 0) {
+        flashfsAppendIndexRecord(tail, freeSpace);
+
+        // We're still booting, so can afford to wait for the record (and any erase of the index) here
+        while (!flashfsUpdateIndex());
+    }
+
+    return freeSpace;
+}
+
 /**
  * Returns true if the file pointer is at the end of the device.
  */
@@ -564,7 +1006,11 @@ bool flashfsIsEOF(void)
     return tailAddress >= flashfsSize;
 }
 
-void flashfsClose(void)
+/**
+ * Once the end of the log being closed is on the flash, record it in the index and move on to where the next log can
+ * start.
+ */
+static void flashfsFinishLog(void)
 {
     switch(flashGeometry->flashType) {
     case FLASH_TYPE_NOR:
@@ -572,12 +1018,32 @@ void flashfsClose(void)
 
     case FLASH_TYPE_NAND:
         flashFlush();
+        break;
+    }
 
-        // Advance tailAddress to next page boundary.
-        uint32_t pageSize = flashGeometry->pageSize;
-        flashfsSetTailAddress((tailAddress + pageSize - 1) & ~(pageSize - 1));
+    indexState = FLASHFS_INDEX_IDLE;
+    if (tailAddress > logStartAddress) {
+        flashfsAppendIndexRecord(logStartAddress, tailAddress);
+    }
 
-        break;
+    flashfsSetTailAddress(flashfsNextWritableAddress(tailAddress));
+
+    logStartAddress = tailAddress;
+}
+
+/**
+ * Close the log without waiting for the flash. flashfsIsReady() returns false until the rest of it and its record
+ * have been written out.
+ */
+void flashfsClose(void)
+{
+    if (indexState != FLASHFS_INDEX_DRAIN) {
+        // Only if closed again before the last record has been written, which callers avoid by waiting for
+        // flashfsIsReady()
+        while (!flashfsUpdateIndex());
+
+        flashfsFlushAsync(true);
+        indexState = FLASHFS_INDEX_DRAIN;
     }
 }
 
@@ -591,14 +1057,31 @@ void flashfsInit(void)
     flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_FLASHFS);
     flashGeometry = flashGetGeometry();
 
+    if (flashGeometry->pageSize > 0) {
+        // Chips with bigger pages than our page buffers are programmed a piece of a page at a time
+        pageBufferSize = MIN(flashGeometry->pageSize, FLASHFS_MAX_PAGE_BUFFER_SIZE);
+        writeBufferSize = pageBufferSize * FLASHFS_WRITE_BUFFER_PAGES;
+        flashfsClearBuffer();
+    }
+
     if (!flashPartition) {
         return;
     }
 
     flashfsSize = FLASH_PARTITION_SECTOR_COUNT(flashPartition) * flashGeometry->sectorSize;
 
+    indexSlotCount = 0;
+    indexDisabled = false;
+    indexState = FLASHFS_INDEX_IDLE;
+    if (FLASH_PARTITION_SECTOR_COUNT(flashPartition) >= FLASHFS_INDEX_MIN_VOLUME_SECTORS && flashGeometry->pageSize > 0) {
+        flashfsSize -= flashGeometry->sectorSize;
+        indexSlotCount = flashGeometry->sectorSize / flashGeometry->pageSize;
+    }
+
     // Start the file pointer off at the beginning of free space so caller can start writing immediately
-    flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
+    flashfsSeekAbs(flashfsFindTail());
+
+    logStartAddress = tailAddress;
 }
 
 #ifdef USE_FLASH_TOOLS
@@ -20,11 +20,13 @@
 
 #pragma once
 
-#define FLASHFS_WRITE_BUFFER_SIZE 128
-#define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
-
-// Automatically trigger a flush when this much data is in the buffer
-#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+/*
+ * The write buffer is split into page buffers sized to the flash's page (but no bigger than this), so that we can fill
+ * one page buffer while the flash programs the previous one.
+ */
+#define FLASHFS_MAX_PAGE_BUFFER_SIZE 256
+#define FLASHFS_WRITE_BUFFER_PAGES 2
+#define FLASHFS_WRITE_BUFFER_SIZE (FLASHFS_MAX_PAGE_BUFFER_SIZE * FLASHFS_WRITE_BUFFER_PAGES)
 
 void flashfsEraseCompletely(void);
 void flashfsEraseRange(uint32_t start, uint32_t end);
@@ -34,6 +36,8 @@ uint32_t flashfsGetOffset(void);
 uint32_t flashfsGetWriteBufferFreeSpace(void);
 uint32_t flashfsGetWriteBufferSize(void);
 int flashfsIdentifyStartOfFreeSpace(void);
+int flashfsGetLogCount(void);
+bool flashfsGetLog(int index, uint32_t *start, uint32_t *end);
 struct flashGeometry_s;
 const struct flashGeometry_s* flashfsGetGeometry(void);
 
@@ -44,7 +48,7 @@ void flashfsWrite(const uint8_t *data, unsigned int len, bool sync);
 
 int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 
-bool flashfsFlushAsync(void);
+bool flashfsFlushAsync(bool force);
 void flashfsFlushSync(void);
 
 void flashfsClose(void);
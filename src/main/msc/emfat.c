@@ -266,6 +266,25 @@ bool emfat_init_entries(emfat_entry_t *entries)
     return true;
 }
 
+// Index the first entry listed in each sector of the root directory, after the volume label
+static void init_root_sect_entries(emfat_t *emfat)
+{
+    emfat_entry_t *e;
+    int n;
+
+    memset(emfat->priv.root_sect_entry, 0, sizeof(emfat->priv.root_sect_entry));
+
+    n = 1;
+    for (e = emfat->priv.entries[0].priv.sub; e != NULL; e = e->priv.next) {
+        if (n % (SECT / sizeof(dir_entry)) == 0) {
+            if (n / (SECT / sizeof(dir_entry)) >= EMFAT_ROOT_SECT_ENTRIES)
+                break;
+            emfat->priv.root_sect_entry[n / (SECT / sizeof(dir_entry))] = e;
+        }
+        n++;
+    }
+}
+
 static void lba_to_chs(int lba, uint8_t *cl, uint8_t *ch, uint8_t *dh)
 {
     int cylinder, head, sector;
@@ -331,6 +350,7 @@ bool emfat_init(emfat_t *emfat, const char *label, emfat_entry_t *entries)
     emfat->priv.root_lba = emfat->priv.fat2_lba + sect_per_fat;
     emfat->priv.entries = entries;
     emfat->priv.last_entry = entries;
+    init_root_sect_entries(emfat);
     emfat->disk_sectors = clust * SECT_PER_CLUST + emfat->priv.root_lba;
     emfat->vol_size = (uint64_t)emfat->disk_sectors * SECT;
     /* calc cyl number */
@@ -400,23 +420,33 @@ void read_boot_sector(const emfat_t *emfat, uint8_t *sect)
 
 emfat_entry_t *find_entry(const emfat_t *emfat, uint32_t clust, emfat_entry_t *nearest)
 {
-    if (nearest == NULL) {
-        nearest = emfat->priv.entries;
+    emfat_entry_t *entries = emfat->priv.entries;
+    int lo, hi, mid;
+
+    // Reads are mostly sequential, so try the entry we used last and the one after it first
+    if (nearest != NULL) {
+        if (IS_CLUST_OF(clust, nearest))
+            return nearest;
+        nearest++;
+        if (nearest->name != NULL && IS_CLUST_OF(clust, nearest))
+            return nearest;
     }
 
-    if (nearest->priv.first_clust > clust) {
-        while (nearest >= emfat->priv.entries) { // backward finding
-            if (IS_CLUST_OF(clust, nearest))
-                return nearest;
-            nearest--;
-        }
-    } else {
-        while (nearest->name != NULL) { // forward finding
-            if (IS_CLUST_OF(clust, nearest))
-                return nearest;
-            nearest++;
+    // The entries are allocated clusters in order, so they're a map from cluster to entry we can binary search
+    lo = 0;
+    hi = emfat->priv.num_entries - 1;
+    while (lo < hi) {
+        mid = (lo + hi + 1) / 2;
+        if (entries[mid].priv.first_clust <= clust) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
         }
     }
+
+    if (IS_CLUST_OF(clust, &entries[lo]))
+        return &entries[lo];
+
     return NULL;
 }
 
@@ -454,37 +484,34 @@ void read_fat_sector(emfat_t *emfat, uint8_t *sect, uint32_t index)
         curr += 2;
     }
 
+    // Each entry owns a run of clusters, so look it up once and fill in its whole run
     le = emfat->priv.last_entry;
     while (count != 0) {
-        if (!IS_CLUST_OF(curr, le)) {
-            le = find_entry(emfat, curr, le);
-            if (le == NULL) {
-                le = emfat->priv.last_entry;
-                *values = CLUST_RESERVED;
-                values++;
-                count--;
-                curr++;
-                continue;
-            }
+        uint32_t end;
+
+        le = find_entry(emfat, curr, le);
+        if (le == NULL) {
+            le = emfat->priv.last_entry;
+            *values = CLUST_RESERVED;
+            values++;
+            count--;
+            curr++;
+            continue;
         }
-        if (le->dir) {
-            if (curr == le->priv.last_clust) {
-                *values = CLUST_EOF;
-            } else {
-                *values = curr + 1;
-            }
-        } else {
-            if (curr == le->priv.last_clust) {
-                *values = CLUST_EOF;
-            } else if (curr > le->priv.last_clust) {
-                *values = CLUST_FREE;
-            } else {
-                *values = curr + 1;
-            }
+
+        end = le->priv.last_reserved + 1;
+        if (end > curr + count)
+            end = curr + count;
+        count -= end - curr;
+
+        for (; curr < end && curr < le->priv.last_clust; curr++)
+            *values++ = curr + 1;
+        if (curr < end && curr == le->priv.last_clust) {
+            *values++ = CLUST_EOF;
+            curr++;
         }
-        values++;
-        count--;
-        curr++;
+        for (; curr < end; curr++)
+            *values++ = le->dir ? curr + 1 : CLUST_FREE;
     }
     emfat->priv.last_entry = le;
 }
@@ -576,7 +603,9 @@ void fill_dir_sector(emfat_t *emfat, uint8_t *data, emfat_entry_t *entry, uint32
             avail -= sizeof(dir_entry) * 2;
         }
         entry = entry->priv.sub;
-    } else { // 2. not a first sector
+    } else if (entry->priv.top == NULL && rel_sect < EMFAT_ROOT_SECT_ENTRIES) { // 2. not a first sector, of the root
+        entry = emfat->priv.root_sect_entry[rel_sect];
+    } else { // 3. not a first sector
         int n;
         n = rel_sect * (SECT / sizeof(dir_entry));
         n -= entry->priv.top == NULL ? 1 : 2;
@@ -600,46 +629,54 @@ void fill_dir_sector(emfat_t *emfat, uint8_t *data, emfat_entry_t *entry, uint32
     }
 }
 
-void read_data_sector(emfat_t *emfat, uint8_t *data, uint32_t rel_sect)
+// Read up to num_sectors sectors, as many as belong to the same entry, returning how many were read
+int read_data_sectors(emfat_t *emfat, uint8_t *data, uint32_t rel_sect, int num_sectors)
 {
     emfat_entry_t *le;
     uint32_t cluster;
+    uint32_t offset;
+    int n;
     cluster = rel_sect / 8 + 2;
     rel_sect = rel_sect % 8;
 
-    le = emfat->priv.last_entry;
-    if (!IS_CLUST_OF(cluster, le)) {
-        le = find_entry(emfat, cluster, le);
-        if (le == NULL) {
-            int i;
-            for (i = 0; i < SECT / 4; i++)
-                ((uint32_t *)data)[i] = 0xEFBEADDE;
-            return;
-        }
-        emfat->priv.last_entry = le;
+    le = find_entry(emfat, cluster, emfat->priv.last_entry);
+    if (le == NULL) {
+        int i;
+        for (i = 0; i < SECT / 4; i++)
+            ((uint32_t *)data)[i] = 0xEFBEADDE;
+        return 1;
     }
+    emfat->priv.last_entry = le;
+
+    offset = (cluster - le->priv.first_clust) * CLUST + rel_sect * SECT;
 
     if (le->dir) {
-        fill_dir_sector(emfat, data, le, rel_sect);
-        return;
+        fill_dir_sector(emfat, data, le, offset / SECT);
+        return 1;
     }
 
+    // A file's clusters are contiguous, so read as much of it as we've been asked for at once
+    n = (le->priv.last_reserved - cluster + 1) * SECT_PER_CLUST - rel_sect;
+    if (n > num_sectors)
+        n = num_sectors;
+
     if (le->readcb == NULL) {
-        memset(data, 0, SECT);
+        memset(data, 0, n * SECT);
     } else {
-        uint32_t offset = cluster - le->priv.first_clust;
-        offset = offset * CLUST + rel_sect * SECT;
-        le->readcb(data, SECT, offset + le->offset, le);
+        le->readcb(data, n * SECT, offset + le->offset, le);
     }
 
-    return;
+    return n;
 }
 
 void emfat_read(emfat_t *emfat, uint8_t *data, uint32_t sector, int num_sectors)
 {
+    int n;
+
     while (num_sectors > 0) {
+        n = 1;
         if (sector >= emfat->priv.root_lba) {
-            read_data_sector(emfat, data, sector - emfat->priv.root_lba);
+            n = read_data_sectors(emfat, data, sector - emfat->priv.root_lba, num_sectors);
         } else if (sector == 0) {
             read_mbr_sector(emfat, data);
         } else if (sector == emfat->priv.fsinfo_lba) {
@@ -653,9 +690,9 @@ void emfat_read(emfat_t *emfat, uint8_t *data, uint32_t sector, int num_sectors)
         } else {
             memset(data, 0, SECT);
         }
-        data += SECT;
-        num_sectors--;
-        sector++;
+        data += n * SECT;
+        num_sectors -= n;
+        sector += n;
     }
 }
 
@@ -67,6 +67,9 @@ typedef struct emfat_entry_s {
     } priv;
 } emfat_entry_t;
 
+// Sectors of the root directory whose first entry is indexed, enough for a cluster
+#define EMFAT_ROOT_SECT_ENTRIES 8
+
 typedef struct emfat_s {
     uint64_t    vol_size;
     uint32_t    disk_sectors;
@@ -82,6 +85,7 @@ typedef struct emfat_s {
         emfat_entry_t *entries;
         emfat_entry_t *last_entry;
         int            num_entries;
+        emfat_entry_t *root_sect_entry[EMFAT_ROOT_SECT_ENTRIES];
     } priv;
 } emfat_t;
 
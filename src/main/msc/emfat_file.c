@@ -26,6 +26,7 @@
 #include "emfat.h"
 #include "emfat_file.h"
 
+#include "common/maths.h"
 #include "common/printf.h"
 #include "common/strtol.h"
 #include "common/time.h"
@@ -250,7 +251,18 @@ static void bblog_read_proc(uint8_t *dest, int size, uint32_t offset, emfat_entr
 {
     UNUSED(entry);
 
-    flashfsReadAbs(offset, dest, size);
+    // We're asked for all the sectors of a request in one go, which can span flash pages that have to be read separately
+    while (size > 0) {
+        const int bytesRead = flashfsReadAbs(offset, dest, size);
+        if (bytesRead <= 0) {
+            memset(dest, 0, size);
+            break;
+        }
+
+        dest += bytesRead;
+        offset += bytesRead;
+        size -= bytesRead;
+    }
 }
 
 static const emfat_entry_t entriesPredefined[] =
@@ -307,20 +319,69 @@ static void emfat_add_log(emfat_entry_t *entry, int number, uint32_t offset, uin
     entry->cma_time[2] = entry->cma_time[0];
 }
 
-static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpace)
+// Find the "Log start datetime" entry in the log header which begins in buffer, read from the flash at hdrOffset
+static void emfat_set_log_time(emfat_entry_t *entry, uint8_t *buffer, int hdrOffset, int buffOffset, int flashfsUsedSpace)
+{
+    char *timeHeader = "H Log start datetime:";
+    int lenTimeHeader = strlen(timeHeader);
+    int timeHeaderMatched = 0;
+
+    // Set the default timestamp for this log entry in case the timestamp is not found
+    entry->cma_time[0] = cmaTime;
+
+    // Search for the timestamp record, example encoding "H Log start datetime:2019-08-15T13:18:22.199+00:00"
+    while (true) {
+        if (buffer[buffOffset++] == timeHeader[timeHeaderMatched]) {
+            // This matches the header we're looking for so far
+            if (++timeHeaderMatched == lenTimeHeader) {
+                // Complete match so read date/time into buffer
+                flashfsReadAbs(hdrOffset + buffOffset, buffer, HDR_BUF_SIZE);
+
+                // Extract the time values to create the CMA time
+                char *nextToken = (char *)buffer;
+                int year = strtoul(nextToken, &nextToken, 10);
+                int month = strtoul(++nextToken, &nextToken, 10);
+                int day = strtoul(++nextToken, &nextToken, 10);
+                int hour = strtoul(++nextToken, &nextToken, 10);
+                int min = strtoul(++nextToken, &nextToken, 10);
+                int sec = strtoul(++nextToken, NULL, 10);
+
+                // Set the file creation time
+                if (year) {
+                    entry->cma_time[0] = EMFAT_ENCODE_CMA_TIME(day, month, year, hour, min, sec);
+                }
+
+                break;
+            }
+        } else {
+            timeHeaderMatched = 0;
+        }
+
+        if (buffOffset == HDR_BUF_SIZE) {
+            // Read the next portion of the header
+            hdrOffset += HDR_BUF_SIZE;
+
+            // Check for flash overflow
+            if (hdrOffset > flashfsUsedSpace) {
+                break;
+            }
+
+            flashfsReadAbs(hdrOffset, buffer, HDR_BUF_SIZE);
+            buffOffset = 0;
+        }
+    }
+}
+
+// Search the flash below flashfsUsedSpace for logs, which start at the beginning of a block
+static int emfat_search_logs(emfat_entry_t *entry, int maxCount, int flashfsUsedSpace)
 {
     static uint8_t buffer[HDR_BUF_SIZE];
     int lastOffset = 0;
     int currOffset = 0;
-    int buffOffset;
-    int hdrOffset;
     int fileNumber = 0;
     int logCount = 0;
     char *logHeader = "H Product:Blackbox";
     int lenLogHeader = strlen(logHeader);
-    char *timeHeader = "H Log start datetime:";
-    int lenTimeHeader = strlen(timeHeader);
-    int timeHeaderMatched = 0;
 
     for ( ; currOffset < flashfsUsedSpace ; currOffset += 2048) { // XXX 2048 = FREE_BLOCK_SIZE in io/flashfs.c
 
@@ -341,55 +402,7 @@ static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpa
             logCount++;
         }
 
-        // Find the "Log start datetime" entry, example encoding "H Log start datetime:2019-08-15T13:18:22.199+00:00"
-
-        buffOffset = lenLogHeader;
-        hdrOffset = currOffset;
-
-        // Set the default timestamp for this log entry in case the timestamp is not found
-        entry->cma_time[0] = cmaTime;
-
-        // Search for the timestamp record
-        while (true) {
-            if (buffer[buffOffset++] == timeHeader[timeHeaderMatched]) {
-                // This matches the header we're looking for so far
-                if (++timeHeaderMatched == lenTimeHeader) {
-                    // Complete match so read date/time into buffer
-                    flashfsReadAbs(hdrOffset + buffOffset, buffer, HDR_BUF_SIZE);
-
-                    // Extract the time values to create the CMA time
-                    char *nextToken = (char *)buffer;
-                    int year = strtoul(nextToken, &nextToken, 10);
-                    int month = strtoul(++nextToken, &nextToken, 10);
-                    int day = strtoul(++nextToken, &nextToken, 10);
-                    int hour = strtoul(++nextToken, &nextToken, 10);
-                    int min = strtoul(++nextToken, &nextToken, 10);
-                    int sec = strtoul(++nextToken, NULL, 10);
-
-                    // Set the file creation time
-                    if (year) {
-                        entry->cma_time[0] = EMFAT_ENCODE_CMA_TIME(day, month, year, hour, min, sec);
-                    }
-
-                    break;
-                }
-            } else {
-                timeHeaderMatched = 0;
-            }
-
-            if (buffOffset == HDR_BUF_SIZE) {
-                // Read the next portion of the header
-                hdrOffset += HDR_BUF_SIZE;
-
-                // Check for flash overflow
-                if (hdrOffset > flashfsUsedSpace) {
-                    break;
-                }
-
-                flashfsReadAbs(hdrOffset, buffer, HDR_BUF_SIZE);
-                buffOffset = 0;
-            }
-        }
+        emfat_set_log_time(entry, buffer, currOffset, lenLogHeader, flashfsUsedSpace);
 
         if (fileNumber == maxCount) {
             break;
@@ -399,13 +412,52 @@ static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpa
     }
 
     // Now add the final entry
-    if (fileNumber != maxCount && lastOffset != currOffset) {
-        emfat_add_log(entry, fileNumber, lastOffset, currOffset - lastOffset);
+    if (fileNumber != maxCount && lastOffset < flashfsUsedSpace) {
+        emfat_add_log(entry, fileNumber, lastOffset, MIN(currOffset, flashfsUsedSpace) - lastOffset);
         ++logCount;
     }
 
     return logCount;
 }
+
+static int emfat_find_log(emfat_entry_t *entry, int maxCount, int flashfsUsedSpace)
+{
+    static uint8_t buffer[HDR_BUF_SIZE];
+    char *logHeader = "H Product:Blackbox";
+    int lenLogHeader = strlen(logHeader);
+    uint32_t start;
+    uint32_t end;
+
+    // The flashfs index lists the most recent logs, we only need to search the flash for any older ones
+    const int indexedLogCount = flashfsGetLogCount();
+    if (indexedLogCount == 0 || !flashfsGetLog(0, &start, &end)) {
+        return emfat_search_logs(entry, maxCount, flashfsUsedSpace);
+    }
+
+    int logCount = emfat_search_logs(entry, maxCount, start);
+
+    for (int i = 0; i < indexedLogCount && logCount < maxCount; i++) {
+        if (!flashfsGetLog(i, &start, &end) || start == end) {
+            continue;
+        }
+
+        mscSetActive();
+        mscActivityLed();
+
+        flashfsReadAbs(start, buffer, HDR_BUF_SIZE);
+
+        if (strncmp((char *)buffer, logHeader, lenLogHeader)) {
+            entry[logCount].cma_time[0] = cmaTime;
+        } else {
+            emfat_set_log_time(&entry[logCount], buffer, start, lenLogHeader, end);
+        }
+
+        emfat_add_log(&entry[logCount], logCount, start, end - start);
+        logCount++;
+    }
+
+    return logCount;
+}
 #endif  // USE_FLASHFS
 
 void emfat_init_files(void)
@@ -435,7 +487,7 @@ void emfat_init_files(void)
     flashfsInit();
     LED0_OFF;
 
-    flashfsUsedSpace = flashfsIdentifyStartOfFreeSpace();
+    flashfsUsedSpace = flashfsGetOffset();
 
     // Detect and create entries for each individual log
     const int logCount = emfat_find_log(&entries[PREDEFINED_ENTRY_COUNT], EMFAT_MAX_LOG_ENTRY, flashfsUsedSpace);
@@ -75,6 +75,7 @@
 #include "fc/board_info.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/latency_trace.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -131,6 +132,7 @@
 #include "rx/msp.h"
 
 #include "scheduler/scheduler.h"
+#include "scheduler/scheduler_trace.h"
 
 #include "sensors/acceleration.h"
 #include "sensors/barometer.h"
@@ -470,7 +472,11 @@ enum compressionType_e {
     HUFFMAN
 };
 
-static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
+/*
+ * Reads from the flash up to endAddress, returning how many bytes of the flash the reply covers (which with compression
+ * can be more than the size of the data in the reply).
+ */
+static uint32_t serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, uint32_t endAddress, bool useLegacyFormat, bool allowCompression)
 {
     STATIC_ASSERT(MSP_PORT_DATAFLASH_INFO_SIZE >= 16, MSP_PORT_DATAFLASH_INFO_SIZE_invalid);
 
@@ -479,11 +485,12 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
     if (readLen > bytesRemainingInBuf) {
         readLen = bytesRemainingInBuf;
     }
+    // Compressed data may take more space than what it came from, but stops at the end of the volume anyway
+    const uint16_t compressedLen = readLen;
     // size will be lower than that requested if we reach end of volume
-    const uint32_t flashfsSize = flashfsGetSize();
-    if (readLen > flashfsSize - address) {
+    if (readLen > endAddress - address) {
         // truncate the request
-        readLen = flashfsSize - address;
+        readLen = endAddress - address;
     }
     sbufWriteU32(dst, address);
 
@@ -519,6 +526,8 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
                 sbufWriteU8(dst, 0);
             }
         }
+
+        return bytesRead;
     } else {
 #ifdef USE_HUFFMAN
         // compress in 256-byte chunks
@@ -529,16 +538,16 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
         huffmanState_t state = {
             .bytesWritten = 0,
             .outByte = sbufPtr(dst) + sizeof(uint16_t) + sizeof(uint8_t) + HUFFMAN_INFO_SIZE,
-            .outBufLen = readLen,
+            .outBufLen = compressedLen,
             .outBit = 0x80,
         };
         *state.outByte = 0;
 
         uint16_t bytesReadTotal = 0;
         // read until output buffer overflows or flash is exhausted
-        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < flashfsSize) {
+        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < endAddress) {
             const int bytesRead = flashfsReadAbs(address + bytesReadTotal, readBuffer,
-                MIN(sizeof(readBuffer), flashfsSize - address - bytesReadTotal));
+                MIN(sizeof(readBuffer), endAddress - address - bytesReadTotal));
 
             const int status = huffmanEncodeBufStreaming(&state, readBuffer, bytesRead, huffmanTable);
             if (status == -1) {
@@ -559,11 +568,218 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
         // payload
         sbufWriteU16(dst, bytesReadTotal);
         sbufAdvance(dst, state.bytesWritten);
+
+        return bytesReadTotal;
 #endif
     }
+
+    return 0;
+}
+
+/*
+ * A download of the flash which, rather than waiting for a request for each chunk, pushes chunks to the host as fast
+ * as the port will take them. Up to a window of chunks may be waiting for the host to acknowledge them. The next chunk
+ * is read from the flash while the port is busy sending the last one.
+ *
+ * Each chunk has a sequence number then the same layout as an MSP_DATAFLASH_READ reply. The host acknowledges the
+ * sequence number of the next chunk it expects, and can ask for everything from there to be sent again if it missed
+ * a chunk. We also start again from the oldest unacknowledged chunk if the host has gone quiet, and stop if it stays
+ * quiet.
+ */
+#define DATAFLASH_STREAM_MAX_WINDOW 16
+#define DATAFLASH_STREAM_RESEND_MS 1000
+#define DATAFLASH_STREAM_TIMEOUT_MS 5000 // Give up if the host has gone away
+
+typedef enum {
+    DATAFLASH_STREAM_START = 0,
+    DATAFLASH_STREAM_ACK,
+    DATAFLASH_STREAM_STOP
+} dataflashStreamAction_e;
+
+#define DATAFLASH_STREAM_ACK_FLAG_RESEND (1 << 0)
+
+typedef struct dataflashStream_s {
+    bool active;
+    mspDescriptor_t descriptor;
+    uint32_t endAddress;
+    uint16_t chunkSize;
+    uint8_t window;
+    bool allowCompression;
+
+    uint16_t ackedSeq; // The oldest chunk the host hasn't acknowledged
+    uint16_t nextSeq; // The next chunk to send
+    uint32_t nextAddress; // Where the next chunk starts
+    uint32_t chunkAddress[DATAFLASH_STREAM_MAX_WINDOW]; // Where each chunk in the window starts, to send them again
+    timeMs_t lastAckMs;
+    timeMs_t resendMs; // When we last went back to the oldest unacknowledged chunk
+} dataflashStream_t;
+
+static dataflashStream_t dataflashStream;
+
+static void dataflashStreamRewind(dataflashStream_t *stream)
+{
+    stream->resendMs = millis();
+    stream->nextSeq = stream->ackedSeq;
+    stream->nextAddress = stream->chunkAddress[stream->ackedSeq % DATAFLASH_STREAM_MAX_WINDOW];
+}
+
+static void dataflashStreamSerializeChunk(dataflashStream_t *stream, sbuf_t *dst)
+{
+    uint8_t * const chunkStart = sbufPtr(dst);
+
+    sbufWriteU16(dst, stream->nextSeq);
+    uint32_t bytesRead = serializeDataflashReadReply(dst, stream->nextAddress, stream->chunkSize, stream->endAddress, false, stream->allowCompression);
+    if (!bytesRead && stream->allowCompression) {
+        // The chunk is too small for the first block to compress into, send it as it is
+        dst->ptr = chunkStart + sizeof(uint16_t);
+        bytesRead = serializeDataflashReadReply(dst, stream->nextAddress, stream->chunkSize, stream->endAddress, false, false);
+    }
+
+    stream->chunkAddress[stream->nextSeq % DATAFLASH_STREAM_MAX_WINDOW] = stream->nextAddress;
+    stream->nextSeq++;
+    // A failed read finishes the stream, the host will find it is short
+    stream->nextAddress = bytesRead ? stream->nextAddress + bytesRead : stream->endAddress;
+}
+
+static bool dataflashStreamIsComplete(const dataflashStream_t *stream)
+{
+    return stream->nextAddress >= stream->endAddress && stream->ackedSeq == stream->nextSeq;
+}
+
+static mspResult_e mspFcDataFlashStreamCommand(mspDescriptor_t srcDesc, sbuf_t *dst, sbuf_t *src)
+{
+    dataflashStream_t *stream = &dataflashStream;
+
+    switch (sbufReadU8(src)) {
+    case DATAFLASH_STREAM_START:
+        {
+            if (sbufBytesRemaining(src) < 12 || ARMING_FLAG(ARMED)) {
+                return MSP_RESULT_ERROR;
+            }
+
+            const uint32_t flashfsSize = flashfsGetSize();
+            const uint32_t address = MIN(sbufReadU32(src), flashfsSize);
+            const uint32_t length = MIN(sbufReadU32(src), flashfsSize - address);
+            const uint16_t chunkSize = sbufReadU16(src);
+            const uint8_t window = sbufReadU8(src);
+            const bool allowCompression = sbufReadU8(src);
+
+            memset(stream, 0, sizeof(*stream));
+            stream->descriptor = srcDesc;
+            stream->endAddress = address + length;
+            // Chunks are serialized into the port's reply buffer, after their sequence number
+            stream->chunkSize = constrain(chunkSize, 1, MSP_PORT_DATAFLASH_BUFFER_SIZE - sizeof(uint16_t));
+            stream->window = constrain(window, 1, DATAFLASH_STREAM_MAX_WINDOW);
+#ifdef USE_HUFFMAN
+            stream->allowCompression = allowCompression;
+#else
+            UNUSED(allowCompression);
+#endif
+            stream->nextAddress = address;
+            stream->chunkAddress[0] = address;
+            stream->lastAckMs = millis();
+            stream->resendMs = stream->lastAckMs;
+            stream->active = length > 0;
+
+            sbufWriteU32(dst, address);
+            sbufWriteU32(dst, length);
+            sbufWriteU16(dst, stream->chunkSize);
+            sbufWriteU8(dst, stream->window);
+            sbufWriteU8(dst, stream->allowCompression ? HUFFMAN : NO_COMPRESSION);
+        }
+
+        return MSP_RESULT_ACK;
+
+    case DATAFLASH_STREAM_ACK:
+        if (stream->active && stream->descriptor == srcDesc && sbufBytesRemaining(src) >= 3) {
+            const uint16_t seq = sbufReadU16(src);
+            const uint8_t flags = sbufReadU8(src);
+
+            // Ignore acknowledgements for chunks we haven't sent, or that are out of date
+            if ((uint16_t)(seq - stream->ackedSeq) <= (uint16_t)(stream->nextSeq - stream->ackedSeq)) {
+                stream->ackedSeq = seq;
+                stream->lastAckMs = millis();
+                stream->resendMs = stream->lastAckMs;
+
+                if (flags & DATAFLASH_STREAM_ACK_FLAG_RESEND) {
+                    dataflashStreamRewind(stream);
+                }
+
+                if (dataflashStreamIsComplete(stream)) {
+                    stream->active = false;
+                }
+            }
+        }
+
+        // Replies would hold up the chunks
+        return MSP_RESULT_NO_REPLY;
+
+    case DATAFLASH_STREAM_STOP:
+        stream->active = false;
+
+        return MSP_RESULT_ACK;
+
+    default:
+        return MSP_RESULT_ERROR;
+    }
 }
 #endif // USE_FLASHFS
 
+/*
+ * Serialize the next frame of a stream to push to the host into the packet's buffer, if it is ready and can't be
+ * longer than maxLength.
+ */
+bool mspFcProcessStream(mspDescriptor_t srcDesc, mspPacket_t *packet, uint32_t maxLength)
+{
+#ifdef USE_FLASHFS
+    dataflashStream_t *stream = &dataflashStream;
+
+    if (!stream->active || stream->descriptor != srcDesc) {
+        return false;
+    }
+
+    // Reading the flash would hold up the PID loop, the host will have to start again once we're disarmed
+    if (ARMING_FLAG(ARMED)) {
+        stream->active = false;
+
+        return false;
+    }
+
+    const timeMs_t currentTimeMs = millis();
+    if (cmp32(currentTimeMs, stream->lastAckMs) > DATAFLASH_STREAM_TIMEOUT_MS) {
+        stream->active = false;
+
+        return false;
+    }
+
+    if (stream->ackedSeq != stream->nextSeq && cmp32(currentTimeMs, stream->resendMs) > DATAFLASH_STREAM_RESEND_MS) {
+        dataflashStreamRewind(stream);
+    }
+
+    if (stream->nextAddress >= stream->endAddress || (uint16_t)(stream->nextSeq - stream->ackedSeq) >= stream->window) {
+        return false;
+    }
+
+    // A compressed chunk is no longer than an uncompressed one, and we can't tell how long it is until it's read
+    if (sizeof(uint16_t) + MSP_PORT_DATAFLASH_INFO_SIZE + stream->chunkSize > maxLength) {
+        return false;
+    }
+
+    dataflashStreamSerializeChunk(stream, &packet->buf);
+
+    packet->cmd = MSP2_DATAFLASH_STREAM;
+    packet->result = MSP_RESULT_ACK;
+
+    return true;
+#else
+    UNUSED(srcDesc);
+    UNUSED(packet);
+    UNUSED(maxLength);
+
+    return false;
+#endif
+}
+
 /*
  * Returns true if the command was processd, false otherwise.
  * May set mspPostProcessFunc to a function to be called once the command has been processed
@@ -1206,6 +1422,21 @@ static bool mspProcessOutCommand(int16_t cmdMSP, sbuf_t *dst)
         }
         break;
 
+#ifdef USE_LATENCY_TRACE
+    case MSP2_GET_LATENCY_STATS:
+        // all times in 1/10 us
+        sbufWriteU8(dst, LATENCY_STAGE_COUNT);
+        for (latencyStage_e stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+            const histogram_t *histogram = latencyTraceHistogram(stage);
+            sbufWriteU32(dst, histogram->count);
+            sbufWriteU16(dst, MIN(histogramPercentile(histogram, 50), (uint32_t)UINT16_MAX));
+            sbufWriteU16(dst, MIN(histogramPercentile(histogram, 99), (uint32_t)UINT16_MAX));
+            sbufWriteU16(dst, MIN(histogram->max, (uint32_t)UINT16_MAX));
+            sbufWriteU16(dst, MIN(histogramMean(histogram), (uint32_t)UINT16_MAX));
+        }
+        break;
+#endif
+
 #ifdef USE_VTX_COMMON
     case MSP2_GET_VTX_DEVICE_STATUS:
         {
@@ -2389,6 +2620,68 @@ static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, int16_
         }
 
         break;
+
+#ifdef USE_SCHEDULER_TRACE
+    case MSP2_GET_SCHEDULER_TRACE:
+        {
+            // Events from the given index, oldest first, as many as fit. Same layout as the trace stream.
+            int index = sbufBytesRemaining(src) >= 2 ? sbufReadU16(src) : 0;
+            const int eventCount = schedulerTraceEventCount();
+
+            sbufWriteU8(dst, schedulerTraceGetState());
+            sbufWriteU32(dst, clockMicrosToCycles(1));
+            sbufWriteU16(dst, eventCount);
+            sbufWriteU16(dst, index);
+            for (; (index < eventCount) && (sbufBytesRemaining(dst) >= SCHEDULER_TRACE_EVENT_SIZE); index++) {
+                const schedulerTraceEvent_t *event = schedulerTraceGetEvent(index);
+                sbufWriteU32(dst, event->startCycles);
+                sbufWriteU32(dst, event->endCycles);
+                sbufWriteU8(dst, event->id);
+                sbufWriteU8(dst, event->reason);
+            }
+        }
+        break;
+#endif
+
+#ifdef USE_TASK_HISTOGRAMS
+    case MSP2_GET_TASK_HISTOGRAMS:
+        {
+            // The list doesn't fit one reply, so it is requested from a given task id and the reply holds the id
+            // to continue from, TASK_COUNT once complete. All times in us.
+            const int entrySize = 20;
+            taskId_e taskId = sbufBytesRemaining(src) ? sbufReadU8(src) : 0;
+
+            sbufWriteU8(dst, schedulerGetTaskHistograms());
+            uint8_t *nextTaskId = sbufPtr(dst);
+            sbufWriteU8(dst, TASK_COUNT);
+            for (; taskId < TASK_COUNT; taskId++) {
+                // room for the task and its check function
+                if (sbufBytesRemaining(dst) < 2 * entrySize) {
+                    *nextTaskId = taskId;
+                    break;
+                }
+                taskInfo_t taskInfo;
+                getTaskInfo(taskId, &taskInfo);
+                if (!taskInfo.isEnabled) {
+                    continue;
+                }
+                for (int checkFunc = 0; checkFunc <= 1; checkFunc++) {
+                    taskHistogramInfo_t histogramInfo;
+                    if (getTaskHistogramInfo(taskId, checkFunc, &histogramInfo)) {
+                        sbufWriteU8(dst, taskId);
+                        sbufWriteU8(dst, checkFunc);
+                        sbufWriteU32(dst, histogramInfo.count);
+                        for (int i = 0; i < TASK_HISTOGRAM_PERCENTILE_COUNT; i++) {
+                            sbufWriteU16(dst, MIN(histogramInfo.percentileUs[i], (uint32_t)UINT16_MAX));
+                        }
+                        sbufWriteU16(dst, MIN(histogramInfo.maxUs, (uint32_t)UINT16_MAX));
+                        sbufWriteU32(dst, histogramInfo.lateGyroCycles);
+                    }
+                }
+            }
+        }
+        break;
+#endif
     default:
         return MSP_RESULT_CMD_UNKNOWN;
     }
@@ -2414,7 +2707,7 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
         useLegacyFormat = true;
     }
 
-    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowCompression);
+    serializeDataflashReadReply(dst, readAddress, readLength, flashfsGetSize(), useLegacyFormat, allowCompression);
 }
 #endif
 
@@ -3297,6 +3590,26 @@ static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, int16_t cmdMSP,
         }
         break;
 
+#ifdef USE_SCHEDULER_TRACE
+    case MSP2_SET_SCHEDULER_TRACE:
+        {
+            // 0 to stop, 1 to record until stopped, 2 to stop after a late gyro cycle
+            const uint8_t traceMode = sbufReadU8(src);
+            if (traceMode) {
+                schedulerTraceStart(traceMode == 2);
+            } else {
+                schedulerTraceStop();
+            }
+        }
+        break;
+#endif
+
+#ifdef USE_TASK_HISTOGRAMS
+    case MSP2_SET_TASK_HISTOGRAMS:
+        schedulerSetTaskHistograms(sbufReadU8(src));
+        break;
+#endif
+
 #ifdef USE_DSHOT
     case MSP2_SEND_DSHOT_COMMAND:
         {
@@ -3981,6 +4294,26 @@ static mspResult_e mspCommonProcessInCommand(mspDescriptor_t srcDesc, int16_t cm
 /*
  * Returns MSP_RESULT_ACK, MSP_RESULT_ERROR or MSP_RESULT_NO_REPLY
  */
+// Commands which only drive the flight controller and leave the configuration alone. Some of them are sent many
+// times a second, and must not invalidate what is derived from the configuration, such as the blackbox header image.
+static bool mspInCommandChangesConfig(int16_t cmdMSP)
+{
+    switch (cmdMSP) {
+    case MSP_SET_RAW_RC:
+    case MSP_SET_RAW_GPS:
+    case MSP_SET_HEADING:
+    case MSP_SET_MOTOR:
+    case MSP_SET_RTC:
+    case MSP_SET_TX_INFO:
+    case MSP_SET_ARMING_DISABLED:
+    case MSP2_SEND_DSHOT_COMMAND:
+    case MSP_CAMERA_CONTROL:
+        return false;
+    default:
+        return true;
+    }
+}
+
 mspResult_e mspFcProcessCommand(mspDescriptor_t srcDesc, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
 {
     int ret = MSP_RESULT_ACK;
@@ -4003,9 +4336,15 @@ mspResult_e mspFcProcessCommand(mspDescriptor_t srcDesc, mspPacket_t *cmd, mspPa
     } else if (cmdMSP == MSP_DATAFLASH_READ) {
         mspFcDataFlashReadCommand(dst, src);
         ret = MSP_RESULT_ACK;
+    } else if (cmdMSP == MSP2_DATAFLASH_STREAM) {
+        ret = mspFcDataFlashStreamCommand(srcDesc, dst, src);
 #endif
     } else {
         ret = mspCommonProcessInCommand(srcDesc, cmdMSP, src, mspPostProcessFn);
+        // Set commands write the PGs directly, without going through the config code
+        if (ret == MSP_RESULT_ACK && mspInCommandChangesConfig(cmdMSP)) {
+            setConfigChanged();
+        }
     }
     reply->result = ret;
     return ret;
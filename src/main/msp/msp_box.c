@@ -100,6 +100,7 @@ static const box_t boxes[CHECKBOX_ITEM_COUNT] = {
     { BOXMSPOVERRIDE, "MSP OVERRIDE", 50},
     { BOXSTICKCOMMANDDISABLE, "STICK COMMANDS DISABLE", 51},
     { BOXBEEPERMUTE, "BEEPER MUTE", 52},
+    { BOXGYROCAPTURE, "GYRO CAPTURE", 53},
 };
 
 // mask of enabled IDs, calculated on startup based on enabled features. boxId_e is used as bit index
@@ -244,6 +245,9 @@ void initActiveBoxIds(void)
 #ifdef USE_FLASHFS
     BME(BOXBLACKBOXERASE);
 #endif
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    BME(BOXGYROCAPTURE);
+#endif
 #endif
 
     BME(BOXFPVANGLEMIX);
@@ -24,3 +24,9 @@
 #define MSP2_SEND_DSHOT_COMMAND             0x3003
 #define MSP2_GET_VTX_DEVICE_STATUS          0x3004
 #define MSP2_GET_OSD_WARNINGS               0x3005  // returns active OSD warning message text
+#define MSP2_GET_LATENCY_STATS              0x3006  // gyro to motor latency histograms, p50/p99/max/mean per stage
+#define MSP2_GET_TASK_HISTOGRAMS            0x3007  // per task execution time percentiles and late gyro cycles, paged by task id
+#define MSP2_SET_TASK_HISTOGRAMS            0x3008  // enable or disable task execution time histograms
+#define MSP2_GET_SCHEDULER_TRACE            0x3009  // recorded scheduler events, paged by event index
+#define MSP2_SET_SCHEDULER_TRACE            0x300A  // start or stop recording scheduler events
+#define MSP2_DATAFLASH_STREAM               0x300B  // start, acknowledge or stop a dataflash download, whose chunks are pushed with this command
@@ -391,10 +391,11 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
     return mspSerialSendFrame(msp, hdrBuf, hdrLen, sbufPtr(&packet->buf), dataLen, crcBuf, crcLen);
 }
 
+// Replies, and frames of a stream, are serialized here before they're encoded to the port
+static uint8_t mspSerialOutBuf[MSP_PORT_OUTBUF_SIZE];
+
 static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
 {
-    static uint8_t mspSerialOutBuf[MSP_PORT_OUTBUF_SIZE];
-
     mspPacket_t reply = {
         .buf = { .ptr = mspSerialOutBuf, .end = ARRAYEND(mspSerialOutBuf), },
         .cmd = -1,
@@ -483,12 +484,58 @@ static void mspSerialProcessReceivedReply(mspPort_t *msp, mspProcessReplyFnPtr m
     msp->c_state = MSP_IDLE;
 }
 
+// The most that mspSerialEncode() adds to a payload
+#define MSP_MAX_FRAME_OVERHEAD 18
+// Limit how long we can block writing streamed frames to a port, each time we're called
+#define MSP_STREAM_MAX_BYTES_PER_CALL (2 * MSP_PORT_OUTBUF_SIZE)
+
+/*
+ * Send frames that the port's stream has ready, for as long as they fit in the transmit buffer. The first frame is
+ * also sent if the transmit buffer is empty, though it may block, just as for a reply.
+ */
+static void mspSerialProcessStream(mspPort_t *msp, mspProcessStreamFnPtr mspProcessStreamFn)
+{
+    int bytesSent = 0;
+
+    while (bytesSent < MSP_STREAM_MAX_BYTES_PER_CALL) {
+        uint32_t maxLength = UINT32_MAX;
+        if (!isSerialTransmitBufferEmpty(msp->port)) {
+            const uint32_t txBytesFree = serialTxBytesFree(msp->port);
+            maxLength = txBytesFree > MSP_MAX_FRAME_OVERHEAD ? txBytesFree - MSP_MAX_FRAME_OVERHEAD : 0;
+        } else if (bytesSent > 0) {
+            maxLength = MSP_STREAM_MAX_BYTES_PER_CALL - bytesSent;
+        }
+
+        mspPacket_t packet = {
+            .buf = { .ptr = mspSerialOutBuf, .end = ARRAYEND(mspSerialOutBuf), },
+            .cmd = -1,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+        uint8_t *outBufHead = packet.buf.ptr;
+
+        if (!mspProcessStreamFn(msp->descriptor, &packet, maxLength)) {
+            break;
+        }
+
+        sbufSwitchToReader(&packet.buf, outBufHead);
+
+        const int frameLength = mspSerialEncode(msp, &packet, msp->mspVersion);
+        if (frameLength == 0) {
+            // Dropped, the other end will ask for it again
+            break;
+        }
+        bytesSent += frameLength;
+    }
+}
+
 /*
  * Process MSP commands from serial ports configured as MSP ports.
  *
  * Called periodically by the scheduler.
  */
-void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn, mspProcessReplyFnPtr mspProcessReplyFn)
+void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn, mspProcessReplyFnPtr mspProcessReplyFn, mspProcessStreamFnPtr mspProcessStreamFn)
 {
     for (uint8_t portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
         mspPort_t * const mspPort = &mspPorts[portIndex];
@@ -530,6 +577,10 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         } else {
             mspProcessPendingRequest(mspPort);
         }
+
+        if (mspProcessStreamFn) {
+            mspSerialProcessStream(mspPort, mspProcessStreamFn);
+        }
     }
 }
 
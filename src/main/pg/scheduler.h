@@ -31,9 +31,15 @@
 #define SCHEDULER_RELAX_OSD 25
 #endif
 
+typedef enum {
+    SCHEDULER_MODE_PRIORITY = 0,    // Scan every enabled task each pass
+    SCHEDULER_MODE_DEADLINE,        // Only consider tasks which are due, waiting tasks are held in a deadline ordered heap
+} schedulerMode_e;
+
 typedef struct schedulerConfig_s {
     uint16_t rxRelaxDeterminism;
     uint16_t osdRelaxDeterminism;
+    uint8_t schedulerMode;
 } schedulerConfig_t;
 
 PG_DECLARE(schedulerConfig_t, schedulerConfig);
@@ -46,6 +46,7 @@
 #include "flight/failsafe.h"
 
 #include "scheduler.h"
+#include "scheduler_trace.h"
 
 #include "sensors/gyro_init.h"
 
@@ -108,15 +109,200 @@ static uint32_t nextTimingCycles;
 
 static timeMs_t lastFailsafeCheckMs = 0;
 
+#ifdef USE_TASK_HISTOGRAMS
+#define TASK_CHECK_HISTOGRAM_COUNT  2   // RX and OSD are the only event driven tasks
+
+const uint16_t taskHistogramPermille[TASK_HISTOGRAM_PERCENTILE_COUNT] = { 500, 900, 990, 999 };
+
+static FAST_DATA_ZERO_INIT bool taskHistogramsEnabled;
+static histogramCompact_t taskHistograms[TASK_COUNT];
+static histogramCompact_t checkFuncHistograms[TASK_CHECK_HISTOGRAM_COUNT];
+static uint8_t checkFuncHistogramSlot[TASK_COUNT];  // 1-based index into checkFuncHistograms, 0 if none
+static uint32_t taskLateGyroCycles[TASK_COUNT];
+#endif
+
 // No need for a linked list for the queue, since items are only inserted at startup
 
 STATIC_UNIT_TESTED FAST_DATA_ZERO_INIT task_t* taskQueueArray[TASK_COUNT + 1]; // extra item for NULL pointer at end of queue
 
+// Deadline scheduling. Time-driven tasks wait in a min-heap ordered on the time they next become due
+// and are moved to the run list once that time has passed. Event-driven tasks stay on the run list
+// so their check functions are polled every pass. Only the run list is then prioritised.
+
+STATIC_UNIT_TESTED FAST_DATA_ZERO_INIT task_t* taskHeap[TASK_COUNT];
+STATIC_UNIT_TESTED FAST_DATA_ZERO_INIT int taskHeapSize = 0;
+STATIC_UNIT_TESTED FAST_DATA_ZERO_INIT task_t* taskRunList[TASK_COUNT + 1]; // extra item for NULL pointer at end of list
+STATIC_UNIT_TESTED FAST_DATA_ZERO_INIT int taskRunListSize = 0;
+
+static FAST_DATA_ZERO_INIT bool deadlineScheduling;
+
+static FAST_CODE void heapSet(int pos, task_t *task)
+{
+    taskHeap[pos] = task;
+    task->heapPosition = pos + 1;
+}
+
+static FAST_CODE bool heapBefore(const task_t *a, const task_t *b)
+{
+    return cmpTimeUs(a->deadlineAtUs, b->deadlineAtUs) < 0;
+}
+
+static FAST_CODE void heapSiftUp(int pos)
+{
+    task_t *task = taskHeap[pos];
+    while (pos > 0) {
+        const int parent = (pos - 1) / 2;
+        if (!heapBefore(task, taskHeap[parent])) {
+            break;
+        }
+        heapSet(pos, taskHeap[parent]);
+        pos = parent;
+    }
+    heapSet(pos, task);
+}
+
+static FAST_CODE void heapSiftDown(int pos)
+{
+    task_t *task = taskHeap[pos];
+    while (true) {
+        int child = 2 * pos + 1;
+        if (child >= taskHeapSize) {
+            break;
+        }
+        if ((child + 1 < taskHeapSize) && heapBefore(taskHeap[child + 1], taskHeap[child])) {
+            child++;
+        }
+        if (!heapBefore(taskHeap[child], task)) {
+            break;
+        }
+        heapSet(pos, taskHeap[child]);
+        pos = child;
+    }
+    heapSet(pos, task);
+}
+
+static FAST_CODE void heapPush(task_t *task)
+{
+    // Mirror the age calculation of the priority scheduler, which makes a task due a full period after it last ran
+    task->deadlineAtUs = task->lastExecutedAtUs + task->attribute->desiredPeriodUs;
+    taskHeap[taskHeapSize] = task;
+    heapSiftUp(taskHeapSize++);
+}
+
+static FAST_CODE void heapRemove(task_t *task)
+{
+    const int pos = task->heapPosition - 1;
+    task->heapPosition = 0;
+    if (pos != --taskHeapSize) {
+        heapSet(pos, taskHeap[taskHeapSize]);
+        if ((pos > 0) && heapBefore(taskHeap[pos], taskHeap[(pos - 1) / 2])) {
+            heapSiftUp(pos);
+        } else {
+            heapSiftDown(pos);
+        }
+    }
+    taskHeap[taskHeapSize] = NULL;
+}
+
+// Keep the run list in the same static priority order as the task queue so both modes break ties alike
+static FAST_CODE void runListAdd(task_t *task)
+{
+    int ii = taskRunListSize;
+    while ((ii > 0) && (taskRunList[ii - 1]->attribute->staticPriority < task->attribute->staticPriority)) {
+        taskRunList[ii] = taskRunList[ii - 1];
+        --ii;
+    }
+    taskRunList[ii] = task;
+    taskRunList[++taskRunListSize] = NULL;
+}
+
+static FAST_CODE bool runListRemove(task_t *task)
+{
+    for (int ii = 0; ii < taskRunListSize; ++ii) {
+        if (taskRunList[ii] == task) {
+            memmove(&taskRunList[ii], &taskRunList[ii+1], sizeof(task) * (taskRunListSize - ii));
+            --taskRunListSize;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The heap and run list are only kept up to date in deadline mode
+static void deadlineAdd(task_t *task)
+{
+    if (!deadlineScheduling || task->attribute->staticPriority == TASK_PRIORITY_REALTIME) {
+        return;
+    }
+    if (task->attribute->checkFunc) {
+        runListAdd(task);
+    } else {
+        heapPush(task);
+    }
+}
+
+static void deadlineRemove(task_t *task)
+{
+    if (!deadlineScheduling) {
+        return;
+    }
+    if (task->heapPosition) {
+        heapRemove(task);
+    } else {
+        runListRemove(task);
+    }
+}
+
+// Move time-driven tasks which have become due onto the run list
+static FAST_CODE void deadlinePromote(timeUs_t currentTimeUs)
+{
+    while ((taskHeapSize > 0) && (cmpTimeUs(currentTimeUs, taskHeap[0]->deadlineAtUs) >= 0)) {
+        task_t *task = taskHeap[0];
+        heapRemove(task);
+        runListAdd(task);
+    }
+}
+
+// Return a time-driven task to the heap once it has run
+static FAST_CODE void deadlineRequeue(task_t *task)
+{
+    if (!task->attribute->checkFunc && runListRemove(task)) {
+        task->taskAgePeriods = 0;
+        heapPush(task);
+    }
+}
+
+static void deadlineClear(void)
+{
+    for (int ii = 0; ii < taskHeapSize; ++ii) {
+        taskHeap[ii]->heapPosition = 0;
+    }
+    memset(taskHeap, 0, sizeof(taskHeap));
+    taskHeapSize = 0;
+    memset(taskRunList, 0, sizeof(taskRunList));
+    taskRunListSize = 0;
+}
+
+// Rebuild the heap and run list from the task queue when switching to deadline mode, drop them when leaving it
+static void deadlineSetScheduling(bool enabled)
+{
+    if (enabled == deadlineScheduling) {
+        return;
+    }
+    deadlineClear();
+    deadlineScheduling = enabled;
+    for (int ii = 0; ii < taskQueueSize; ++ii) {
+        deadlineAdd(taskQueueArray[ii]);
+    }
+}
+
 void queueClear(void)
 {
     memset(taskQueueArray, 0, sizeof(taskQueueArray));
     taskQueuePos = 0;
     taskQueueSize = 0;
+
+    deadlineClear();
 }
 
 bool queueContains(task_t *task)
@@ -139,6 +325,7 @@ bool queueAdd(task_t *task)
             memmove(&taskQueueArray[ii+1], &taskQueueArray[ii], sizeof(task) * (taskQueueSize - ii));
             taskQueueArray[ii] = task;
             ++taskQueueSize;
+            deadlineAdd(task);
             return true;
         }
     }
@@ -151,6 +338,7 @@ bool queueRemove(task_t *task)
         if (taskQueueArray[ii] == task) {
             memmove(&taskQueueArray[ii], &taskQueueArray[ii+1], sizeof(task) * (taskQueueSize - ii));
             --taskQueueSize;
+            deadlineRemove(task);
             return true;
         }
     }
@@ -241,6 +429,12 @@ void rescheduleTask(taskId_e taskId, timeDelta_t newPeriodUs)
     }
     task->attribute->desiredPeriodUs = MAX(SCHEDULER_DELAY_LIMIT, newPeriodUs);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
 
+    // Re-key a waiting task on its new period
+    if (task->heapPosition) {
+        heapRemove(task);
+        heapPush(task);
+    }
+
     // Catch the case where the gyro loop is adjusted
     if (taskId == TASK_GYRO) {
         desiredPeriodCycles = (int32_t)clockMicrosToCycles((uint32_t)getTask(TASK_GYRO)->attribute->desiredPeriodUs);
@@ -328,8 +522,84 @@ void schedulerResetCheckFunctionMaxExecutionTime(void)
     checkFuncMaxExecutionTimeUs = 0;
 }
 
+#ifdef USE_TASK_HISTOGRAMS
+void schedulerResetTaskHistograms(void)
+{
+    for (int ii = 0; ii < TASK_COUNT; ii++) {
+        histogramCompactReset(&taskHistograms[ii]);
+        taskLateGyroCycles[ii] = 0;
+    }
+    for (int ii = 0; ii < TASK_CHECK_HISTOGRAM_COUNT; ii++) {
+        histogramCompactReset(&checkFuncHistograms[ii]);
+    }
+}
+
+// Histograms are collected only when enabled, and start afresh each time they are
+void schedulerSetTaskHistograms(bool enabled)
+{
+    if (enabled && !taskHistogramsEnabled) {
+        schedulerResetTaskHistograms();
+    }
+    taskHistogramsEnabled = enabled;
+}
+
+bool schedulerGetTaskHistograms(void)
+{
+    return taskHistogramsEnabled;
+}
+
+// Returns false if asked for the check function of a task without one
+bool getTaskHistogramInfo(taskId_e taskId, bool checkFunc, taskHistogramInfo_t *histogramInfo)
+{
+    const histogramCompact_t *histogram;
+
+    if (taskId >= TASK_COUNT) {
+        return false;
+    }
+    if (checkFunc) {
+        if (!checkFuncHistogramSlot[taskId]) {
+            return false;
+        }
+        histogram = &checkFuncHistograms[checkFuncHistogramSlot[taskId] - 1];
+        histogramInfo->lateGyroCycles = 0;
+    } else {
+        histogram = &taskHistograms[taskId];
+        histogramInfo->lateGyroCycles = taskLateGyroCycles[taskId];
+    }
+
+    histogramInfo->count = histogram->count;
+    histogramInfo->maxUs = histogram->max;
+    for (int ii = 0; ii < TASK_HISTOGRAM_PERCENTILE_COUNT; ii++) {
+        histogramInfo->percentileUs[ii] = histogramCompactPermille(histogram, taskHistogramPermille[ii]);
+    }
+    return true;
+}
+#endif
+
+static FAST_CODE bool schedulerCheckTask(task_t *task, timeUs_t currentTimeUs)
+{
+#ifdef USE_TASK_HISTOGRAMS
+    const int slot = checkFuncHistogramSlot[task - tasks];
+    const bool timeCheck = taskHistogramsEnabled && slot;
+    const timeUs_t checkStartUs = timeCheck ? micros() : 0;
+#endif
+    SCHEDULER_TRACE_BEGIN(traceStartCycles);
+
+    const bool signalled = task->attribute->checkFunc(currentTimeUs, cmpTimeUs(currentTimeUs, task->lastExecutedAtUs));
+
+    SCHEDULER_TRACE_END(task - tasks, signalled ? SCHEDULER_TRACE_CHECK_SIGNALLED : SCHEDULER_TRACE_CHECK, traceStartCycles);
+#ifdef USE_TASK_HISTOGRAMS
+    if (timeCheck) {
+        histogramCompactAdd(&checkFuncHistograms[slot - 1], cmpTimeUs(micros(), checkStartUs));
+    }
+#endif
+    return signalled;
+}
+
 void schedulerInit(void)
 {
+    deadlineSetScheduling(schedulerConfig()->schedulerMode == SCHEDULER_MODE_DEADLINE);
+
     queueClear();
     queueAdd(getTask(TASK_SYSTEM));
 
@@ -356,6 +626,17 @@ void schedulerInit(void)
     for (taskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
         schedulerResetTaskStatistics(taskId);
     }
+
+#ifdef USE_TASK_HISTOGRAMS
+    int checkFuncCount = 0;
+    for (taskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        checkFuncHistogramSlot[taskId] = 0;
+        if (getTask(taskId)->attribute->checkFunc && (checkFuncCount < TASK_CHECK_HISTOGRAM_COUNT)) {
+            checkFuncHistogramSlot[taskId] = ++checkFuncCount;
+        }
+    }
+    schedulerResetTaskHistograms();
+#endif
 }
 
 static timeDelta_t taskNextStateTime;
@@ -386,9 +667,16 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
 
         // Execute task
         const timeUs_t currentTimeBeforeTaskCallUs = micros();
+        SCHEDULER_TRACE_BEGIN(traceStartCycles);
         selectedTask->attribute->taskFunc(currentTimeBeforeTaskCallUs);
+        SCHEDULER_TRACE_END(selectedTask - tasks, SCHEDULER_TRACE_TASK, traceStartCycles);
         taskExecutionTimeUs = micros() - currentTimeBeforeTaskCallUs;
         taskTotalExecutionTime += taskExecutionTimeUs;
+#ifdef USE_TASK_HISTOGRAMS
+        if (taskHistogramsEnabled) {
+            histogramCompactAdd(&taskHistograms[selectedTask - tasks], taskExecutionTimeUs);
+        }
+#endif
         selectedTask->movingSumExecutionTime10thUs += (taskExecutionTimeUs * 10) - selectedTask->movingSumExecutionTime10thUs / TASK_STATS_MOVING_SUM_COUNT;
         if (!ignoreCurrentTaskExecRate) {
             // Record task execution rate and max execution time
@@ -595,7 +883,15 @@ FAST_CODE void scheduler(void)
         currentTimeUs = micros();
 
         // Update task dynamic priorities
-        for (task_t *task = queueFirst(); task != NULL; task = queueNext()) {
+        task_t **taskList = taskQueueArray;
+        if (deadlineScheduling) {
+            // Only tasks on the run list can have a non-zero dynamic priority
+            deadlinePromote(currentTimeUs);
+            taskList = taskRunList;
+        }
+
+        for (task_t **taskEntry = taskList; *taskEntry != NULL; taskEntry++) {
+            task_t *task = *taskEntry;
             if (task->attribute->staticPriority != TASK_PRIORITY_REALTIME) {
                 // Task has checkFunc - event driven
                 if (task->attribute->checkFunc) {
@@ -603,7 +899,7 @@ FAST_CODE void scheduler(void)
                     if (task->dynamicPriority > 0) {
                         task->taskAgePeriods = 1 + (cmpTimeUs(currentTimeUs, task->lastSignaledAtUs) / task->attribute->desiredPeriodUs);
                         task->dynamicPriority = 1 + task->attribute->staticPriority * task->taskAgePeriods;
-                    } else if (task->attribute->checkFunc(currentTimeUs, cmpTimeUs(currentTimeUs, task->lastExecutedAtUs))) {
+                    } else if (schedulerCheckTask(task, currentTimeUs)) {
                         const uint32_t checkFuncExecutionTimeUs = cmpTimeUs(micros(), currentTimeUs);
                         checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
                         checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
@@ -664,9 +960,24 @@ FAST_CODE void scheduler(void)
             if (!gyroEnabled || (taskRequiredTimeCycles < schedLoopRemainingCycles)) {
                 uint32_t antipatedEndCycles = nowCycles + taskRequiredTimeCycles;
                 taskExecutionTimeUs += schedulerExecuteTask(selectedTask, currentTimeUs);
+                if (deadlineScheduling) {
+                    deadlineRequeue(selectedTask);
+                }
                 nowCycles = getCycleCounter();
                 int32_t cyclesOverdue = cmpTimeCycles(nowCycles, antipatedEndCycles);
 
+#if defined(USE_TASK_HISTOGRAMS) || defined(USE_SCHEDULER_TRACE)
+                // The task ran into the next gyro cycle
+                if (gyroEnabled && (cmpTimeCycles(nowCycles, nextTargetCycles) > 0)) {
+#ifdef USE_TASK_HISTOGRAMS
+                    if (taskHistogramsEnabled) {
+                        taskLateGyroCycles[currentTask - tasks]++;
+                    }
+#endif
+                    SCHEDULER_TRACE_LATE(currentTask - tasks);
+                }
+#endif
+
 #if defined(USE_LATE_TASK_STATISTICS)
                 if (cyclesOverdue > 0) {
                     if ((currentTask - tasks) != TASK_SERIAL) {
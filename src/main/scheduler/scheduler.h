@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "common/histogram.h"
 #include "common/time.h"
 #include "config/config.h"
 #include "pg/scheduler.h"
@@ -76,6 +77,15 @@ typedef struct {
     timeUs_t     averageDeltaTimeUs;
 } cfCheckFuncInfo_t;
 
+#define TASK_HISTOGRAM_PERCENTILE_COUNT 4   // p50, p90, p99 and p99.9
+
+typedef struct {
+    uint32_t     count;
+    uint32_t     lateGyroCycles;                                // runs which delayed the start of a gyro cycle
+    timeUs_t     maxUs;
+    timeUs_t     percentileUs[TASK_HISTOGRAM_PERCENTILE_COUNT];
+} taskHistogramInfo_t;
+
 typedef struct {
     const char * taskName;
     const char * subTaskName;
@@ -207,6 +217,8 @@ typedef struct {
     timeUs_t lastExecutedAtUs;          // last time of invocation
     timeUs_t lastSignaledAtUs;          // time of invocation event for event-driven tasks
     timeUs_t lastDesiredAt;             // time of last desired execution
+    timeUs_t deadlineAtUs;              // time at which a time-driven task next becomes due, used by the deadline scheduler
+    uint8_t heapPosition;               // 1-based index in the deadline heap, 0 if not waiting there
 
     // Statistics
     float    movingAverageCycleTimeUs;
@@ -241,6 +253,14 @@ void schedulerInit(void);
 void scheduler(void);
 timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTimeUs);
 void taskSystemLoad(timeUs_t currentTimeUs);
+#ifdef USE_TASK_HISTOGRAMS
+extern const uint16_t taskHistogramPermille[TASK_HISTOGRAM_PERCENTILE_COUNT];
+
+bool getTaskHistogramInfo(taskId_e taskId, bool checkFunc, taskHistogramInfo_t *histogramInfo);
+void schedulerSetTaskHistograms(bool enabled);
+bool schedulerGetTaskHistograms(void);
+void schedulerResetTaskHistograms(void);
+#endif
 void schedulerEnableGyro(void);
 uint16_t getAverageSystemLoadPercent(void);
 float schedulerGetCycleTimeMultiplier(void);
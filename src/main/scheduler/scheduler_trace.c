@@ -0,0 +1,306 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_SCHEDULER_TRACE
+
+#if defined(SIMULATOR_BUILD)
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#endif
+
+#include "common/maths.h"
+#include "common/streambuf.h"
+#include "common/utils.h"
+
+#include "drivers/system.h"
+
+#include "fc/tasks.h"
+
+#include "scheduler/scheduler.h"
+#include "scheduler/scheduler_trace.h"
+
+#define SCHEDULER_TRACE_MAGIC           "BFST"
+#define SCHEDULER_TRACE_HEADER_SIZE     10
+
+STATIC_ASSERT((SCHEDULER_TRACE_EVENT_COUNT & (SCHEDULER_TRACE_EVENT_COUNT - 1)) == 0, scheduler_trace_event_count_not_power_of_2);
+STATIC_ASSERT(TASK_COUNT <= UINT8_MAX, scheduler_trace_task_id_too_large);
+
+static schedulerTraceEvent_t traceEvents[SCHEDULER_TRACE_EVENT_COUNT];
+static uint32_t traceHead;              // events recorded since the trace was started
+static int traceRemaining;              // events still to capture once triggered
+static schedulerTraceState_e traceState;
+
+#if defined(SIMULATOR_BUILD)
+// Events are also streamed to a file, so a trace isn't limited to the size of the ring.
+// The scheduler only queues them, a writer thread does the file I/O, as for the blackbox file device.
+#define SCHEDULER_TRACE_FILENAME            "scheduler_trace.bin"
+#define SCHEDULER_TRACE_FILE_QUEUE_SIZE     4096 // events, power of 2
+#define SCHEDULER_TRACE_FILE_IDLE_SLEEP_NS  (1000 * 1000)
+
+// Queued in place of an event to open a new file, or to close it with startCycles the number of events dropped
+#define SCHEDULER_TRACE_FILE_OPEN           0xFE
+#define SCHEDULER_TRACE_FILE_CLOSE          0xFF
+
+// Room kept for a close and an open after any number of events, so those are never dropped
+#define SCHEDULER_TRACE_FILE_RESERVE        2
+
+// head and tail are free running, the event is at the index modulo SCHEDULER_TRACE_FILE_QUEUE_SIZE.
+// Only the scheduler writes head and only the writer thread writes tail.
+#define QUEUE_LOAD(var)                     __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define QUEUE_STORE(var, val)               __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+
+STATIC_ASSERT((SCHEDULER_TRACE_FILE_QUEUE_SIZE & (SCHEDULER_TRACE_FILE_QUEUE_SIZE - 1)) == 0, scheduler_trace_file_queue_size_not_power_of_2);
+
+static struct {
+    schedulerTraceEvent_t queue[SCHEDULER_TRACE_FILE_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+
+    // Only touched by the scheduler
+    bool open;                          // an open has been queued and no close since
+    uint32_t droppedEvents;
+    bool threadStarted;
+    pthread_t thread;
+
+    // Only touched by the writer thread
+    FILE *file;
+} traceFile;
+
+static bool traceFileQueue(uint8_t id, uint8_t reason, uint32_t startCycles, uint32_t endCycles, uint32_t reserve)
+{
+    const uint32_t head = traceFile.head;
+    if (SCHEDULER_TRACE_FILE_QUEUE_SIZE - (head - QUEUE_LOAD(traceFile.tail)) <= reserve) {
+        return false;
+    }
+
+    schedulerTraceEvent_t *event = &traceFile.queue[head % SCHEDULER_TRACE_FILE_QUEUE_SIZE];
+    event->startCycles = startCycles;
+    event->endCycles = endCycles;
+    event->id = id;
+    event->reason = reason;
+    QUEUE_STORE(traceFile.head, head + 1);
+    return true;
+}
+
+static void traceFileWrite(const uint8_t *data, int length)
+{
+    fwrite(data, 1, length, traceFile.file);
+}
+
+static void *traceFileThread(void *data)
+{
+    UNUSED(data);
+
+    while (true) {
+        uint32_t tail = traceFile.tail;
+        const uint32_t head = QUEUE_LOAD(traceFile.head);
+
+        for (; tail != head; tail++) {
+            const schedulerTraceEvent_t *event = &traceFile.queue[tail % SCHEDULER_TRACE_FILE_QUEUE_SIZE];
+
+            switch (event->reason) {
+            case SCHEDULER_TRACE_FILE_OPEN:
+                traceFile.file = fopen(SCHEDULER_TRACE_FILENAME, "wb");
+                if (traceFile.file) {
+                    schedulerTraceWriteHeader(traceFileWrite);
+                } else {
+                    fprintf(stderr, "[TRACE] failed to create '%s'\n", SCHEDULER_TRACE_FILENAME);
+                }
+                break;
+
+            case SCHEDULER_TRACE_FILE_CLOSE:
+                if (traceFile.file) {
+                    fclose(traceFile.file);
+                    traceFile.file = NULL;
+                    if (event->startCycles) {
+                        fprintf(stderr, "[TRACE] '%s' is missing %u events, the writer fell behind\n", SCHEDULER_TRACE_FILENAME, (unsigned)event->startCycles);
+                    }
+                }
+                break;
+
+            default:
+                if (traceFile.file) {
+                    schedulerTraceWriteEvent(traceFileWrite, event);
+                }
+                break;
+            }
+        }
+
+        const bool written = tail != traceFile.tail;
+        QUEUE_STORE(traceFile.tail, tail);
+
+        if (!written) {
+            const struct timespec idle = { .tv_sec = 0, .tv_nsec = SCHEDULER_TRACE_FILE_IDLE_SLEEP_NS };
+            nanosleep(&idle, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+static void traceFileOpen(void)
+{
+    if (!traceFile.threadStarted) {
+        if (pthread_create(&traceFile.thread, NULL, traceFileThread, NULL) != 0) {
+            fprintf(stderr, "[TRACE] failed to start writer thread\n");
+            return;
+        }
+        traceFile.threadStarted = true;
+    }
+
+    traceFile.droppedEvents = 0;
+    traceFile.open = traceFileQueue(0, SCHEDULER_TRACE_FILE_OPEN, 0, 0, 0);
+}
+
+static void traceFileClose(void)
+{
+    if (traceFile.open) {
+        traceFileQueue(0, SCHEDULER_TRACE_FILE_CLOSE, traceFile.droppedEvents, 0, 0);
+        traceFile.open = false;
+    }
+}
+#endif
+
+void schedulerTraceStop(void)
+{
+    traceState = SCHEDULER_TRACE_STOPPED;
+
+#if defined(SIMULATOR_BUILD)
+    traceFileClose();
+#endif
+}
+
+void schedulerTraceStart(bool stopAfterLateCycle)
+{
+    schedulerTraceStop();
+    traceHead = 0;
+
+#if defined(SIMULATOR_BUILD)
+    traceFileOpen();
+#endif
+
+    traceState = stopAfterLateCycle ? SCHEDULER_TRACE_ARMED : SCHEDULER_TRACE_RUNNING;
+}
+
+schedulerTraceState_e schedulerTraceGetState(void)
+{
+    return traceState;
+}
+
+int schedulerTraceEventCount(void)
+{
+    return MIN(traceHead, (uint32_t)SCHEDULER_TRACE_EVENT_COUNT);
+}
+
+// Events are indexed oldest first
+const schedulerTraceEvent_t *schedulerTraceGetEvent(int index)
+{
+    const uint32_t oldest = traceHead > SCHEDULER_TRACE_EVENT_COUNT ? traceHead - SCHEDULER_TRACE_EVENT_COUNT : 0;
+    return &traceEvents[(oldest + index) & (SCHEDULER_TRACE_EVENT_COUNT - 1)];
+}
+
+FAST_CODE void schedulerTraceRecord(uint8_t id, schedulerTraceReason_e reason, uint32_t startCycles, uint32_t endCycles)
+{
+    if (traceState == SCHEDULER_TRACE_STOPPED) {
+        return;
+    }
+
+    schedulerTraceEvent_t *event = &traceEvents[traceHead++ & (SCHEDULER_TRACE_EVENT_COUNT - 1)];
+    event->startCycles = startCycles;
+    event->endCycles = endCycles;
+    event->id = id;
+    event->reason = reason;
+
+#if defined(SIMULATOR_BUILD)
+    if (traceFile.open && !traceFileQueue(id, reason, startCycles, endCycles, SCHEDULER_TRACE_FILE_RESERVE)) {
+        traceFile.droppedEvents++;
+    }
+#endif
+
+    if ((traceState == SCHEDULER_TRACE_TRIGGERED) && (--traceRemaining <= 0)) {
+        schedulerTraceStop();
+    }
+}
+
+void schedulerTraceLateCycle(uint8_t taskId)
+{
+    const uint32_t nowCycles = getCycleCounter();
+    schedulerTraceRecord(taskId, SCHEDULER_TRACE_LATE, nowCycles, nowCycles);
+
+    // Keep the events leading up to the late cycle and as many again after it
+    if (traceState == SCHEDULER_TRACE_ARMED) {
+        traceState = SCHEDULER_TRACE_TRIGGERED;
+        traceRemaining = SCHEDULER_TRACE_EVENT_COUNT / 2;
+    }
+}
+
+// Marks a point of interest, such as the start of a code path being timed, in the trace
+void schedulerTraceMarker(uint8_t markerId)
+{
+    const uint32_t nowCycles = getCycleCounter();
+    schedulerTraceRecord(markerId, SCHEDULER_TRACE_MARKER, nowCycles, nowCycles);
+}
+
+// The stream starts with a header giving the cycle counter rate and the task names:
+//   "BFST", u8 version, u32 cycles per us, u8 task count, then for each task u8 id, u8 name length, name
+// followed by any number of events:
+//   u32 start cycles, u32 end cycles, u8 id, u8 reason
+// All values little endian.
+void schedulerTraceWriteHeader(schedulerTraceWriteFn *write)
+{
+    uint8_t buffer[SCHEDULER_TRACE_HEADER_SIZE];
+    sbuf_t sbuf;
+    sbuf_t *dst = sbufInit(&sbuf, buffer, buffer + sizeof(buffer));
+
+    sbufWriteData(dst, SCHEDULER_TRACE_MAGIC, strlen(SCHEDULER_TRACE_MAGIC));
+    sbufWriteU8(dst, SCHEDULER_TRACE_VERSION);
+    sbufWriteU32(dst, clockMicrosToCycles(1));
+    sbufWriteU8(dst, TASK_COUNT);
+    write(buffer, sizeof(buffer));
+
+    for (unsigned taskId = 0; taskId < TASK_COUNT; taskId++) {
+        const char *taskName = getTask(taskId)->attribute->taskName;
+        const uint8_t nameHeader[2] = { taskId, taskName ? strlen(taskName) : 0 };
+        write(nameHeader, sizeof(nameHeader));
+        write((const uint8_t *)taskName, nameHeader[1]);
+    }
+}
+
+void schedulerTraceWriteEvent(schedulerTraceWriteFn *write, const schedulerTraceEvent_t *event)
+{
+    uint8_t buffer[SCHEDULER_TRACE_EVENT_SIZE];
+    sbuf_t sbuf;
+    sbuf_t *dst = sbufInit(&sbuf, buffer, buffer + sizeof(buffer));
+
+    sbufWriteU32(dst, event->startCycles);
+    sbufWriteU32(dst, event->endCycles);
+    sbufWriteU8(dst, event->id);
+    sbufWriteU8(dst, event->reason);
+    write(buffer, sizeof(buffer));
+}
+
+#endif // USE_SCHEDULER_TRACE
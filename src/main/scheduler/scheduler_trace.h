@@ -0,0 +1,81 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Scheduler event trace.
+// Records when each task and check function ran, in CPU cycles, to a ring so the interleaving of tasks
+// around a late gyro cycle can be seen. The ring is serialized as a byte stream (see
+// schedulerTraceWriteHeader) which src/utils/scheduler_trace.py turns into Chrome trace_event JSON.
+// Without USE_SCHEDULER_TRACE the hooks compile to nothing.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCHEDULER_TRACE_EVENT_COUNT     256 // power of 2
+#define SCHEDULER_TRACE_EVENT_SIZE      10  // serialized size
+#define SCHEDULER_TRACE_VERSION         1
+
+typedef enum {
+    SCHEDULER_TRACE_TASK = 0,           // task function ran
+    SCHEDULER_TRACE_CHECK,              // check function ran and found nothing to do
+    SCHEDULER_TRACE_CHECK_SIGNALLED,    // check function ran and signalled its task
+    SCHEDULER_TRACE_LATE,               // the task ran into the next gyro cycle
+    SCHEDULER_TRACE_MARKER,             // user marker, id is the marker number
+} schedulerTraceReason_e;
+
+typedef enum {
+    SCHEDULER_TRACE_STOPPED = 0,
+    SCHEDULER_TRACE_RUNNING,            // record until stopped, overwriting the oldest events
+    SCHEDULER_TRACE_ARMED,              // as running, but stop half a buffer after a late gyro cycle
+    SCHEDULER_TRACE_TRIGGERED,          // a late gyro cycle was seen, finishing the capture
+} schedulerTraceState_e;
+
+typedef struct schedulerTraceEvent_s {
+    uint32_t startCycles;
+    uint32_t endCycles;
+    uint8_t id;                         // task id, or marker number
+    uint8_t reason;                     // schedulerTraceReason_e
+} schedulerTraceEvent_t;
+
+typedef void schedulerTraceWriteFn(const uint8_t *data, int length);
+
+void schedulerTraceStart(bool stopAfterLateCycle);
+void schedulerTraceStop(void);
+schedulerTraceState_e schedulerTraceGetState(void);
+int schedulerTraceEventCount(void);
+const schedulerTraceEvent_t *schedulerTraceGetEvent(int index);
+void schedulerTraceRecord(uint8_t id, schedulerTraceReason_e reason, uint32_t startCycles, uint32_t endCycles);
+void schedulerTraceLateCycle(uint8_t taskId);
+void schedulerTraceMarker(uint8_t markerId);
+void schedulerTraceWriteHeader(schedulerTraceWriteFn *write);
+void schedulerTraceWriteEvent(schedulerTraceWriteFn *write, const schedulerTraceEvent_t *event);
+
+#ifdef USE_SCHEDULER_TRACE
+#define SCHEDULER_TRACE_BEGIN(startCycles)              const uint32_t startCycles = getCycleCounter()
+#define SCHEDULER_TRACE_END(id, reason, startCycles)    schedulerTraceRecord((id), (reason), (startCycles), getCycleCounter())
+#define SCHEDULER_TRACE_LATE(taskId)                    schedulerTraceLateCycle(taskId)
+#define SCHEDULER_TRACE_MARKER(markerId)                schedulerTraceMarker(markerId)
+#else
+#define SCHEDULER_TRACE_BEGIN(startCycles)
+#define SCHEDULER_TRACE_END(id, reason, startCycles)
+#define SCHEDULER_TRACE_LATE(taskId)
+#define SCHEDULER_TRACE_MARKER(markerId)
+#endif
@@ -26,6 +26,7 @@
 
 #include "platform.h"
 
+#include "build/build_config.h"
 #include "build/debug.h"
 
 #include "common/axis.h"
@@ -43,6 +44,7 @@
 #include "drivers/io.h"
 
 #include "config/config.h"
+#include "fc/latency_trace.h"
 #include "fc/runtime_config.h"
 
 #ifdef USE_DYN_NOTCH_FILTER
@@ -402,7 +404,7 @@ static FAST_CODE void gyroUpdateSensor(gyroSensor_t *gyroSensor)
     }
 }
 
-FAST_CODE void gyroUpdate(void)
+FAST_CODE void gyroUpdate(timeUs_t currentTimeUs)
 {
     switch (gyro.gyroToUse) {
     case GYRO_CONFIG_USE_GYRO_1:
@@ -434,28 +436,65 @@ FAST_CODE void gyroUpdate(void)
 #endif
     }
 
-    if (gyro.downsampleFilterEnabled) {
-        // using gyro lowpass 2 filter for downsampling
-        gyro.sampleSum[X] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[X], gyro.gyroADC[X]);
-        gyro.sampleSum[Y] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Y], gyro.gyroADC[Y]);
-        gyro.sampleSum[Z] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Z], gyro.gyroADC[Z]);
-    } else {
-        // using simple averaging for downsampling
-        gyro.sampleSum[X] += gyro.gyroADC[X];
-        gyro.sampleSum[Y] += gyro.gyroADC[Y];
-        gyro.sampleSum[Z] += gyro.gyroADC[Z];
-        gyro.sampleCount++;
-    }
+    // queue the sample for the filter task, which downsamples whatever has arrived since its last run
+    gyroRingPush(&gyro.sampleRing, currentTimeUs, gyro.gyroADC);
+
+#ifdef USE_LATENCY_TRACE
+    latencyTraceMark(LATENCY_POINT_GYRO_SAMPLE);
+#endif
 }
 
+// Stage expansions for the filter pipeline variants in gyro_filter_impl.c
+#define GYRO_FILTER_STAGE_FN(fn, filter, axis, value)   fn((filter_t *)&(filter)[axis], value)
+#define GYRO_FILTER_STAGE_NONE(axis, value)             (UNUSED(axis), (value))
+
+#define GYRO_FILTER_NOTCH1(axis, value) GYRO_FILTER_STAGE_FN(gyro.notchFilter1ApplyFn, gyro.notchFilter1, axis, value)
+#define GYRO_FILTER_NOTCH2(axis, value) GYRO_FILTER_STAGE_FN(gyro.notchFilter2ApplyFn, gyro.notchFilter2, axis, value)
+#define GYRO_FILTER_LPF1(axis, value)   GYRO_FILTER_STAGE_FN(gyro.lowpassFilterApplyFn, gyro.lowpassFilter, axis, value)
+#define GYRO_FILTER_LPF2(axis, value)   GYRO_FILTER_STAGE_FN(gyro.lowpass2FilterApplyFn, gyro.lowpass2Filter, axis, value)
+
+// Generic pipeline, any combination of stages through function pointers
 #define GYRO_FILTER_FUNCTION_NAME filterGyro
 #define GYRO_FILTER_DEBUG_SET(mode, index, value) do { UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) do { UNUSED(axis); UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
 #include "gyro_filter_impl.c"
 #undef GYRO_FILTER_FUNCTION_NAME
+
+#undef GYRO_FILTER_NOTCH1
+#undef GYRO_FILTER_NOTCH2
+#undef GYRO_FILTER_LPF1
+#undef GYRO_FILTER_LPF2
+
+// Specialised pipelines for the common configurations: static notches off, LPF2 PT1 or off and LPF1 off or PT1, called directly
+// Each variant costs a copy of the filter loop in fast code memory, so only the most used ones are generated
+#define GYRO_FILTER_NOTCH1(axis, value) GYRO_FILTER_STAGE_NONE(axis, value)
+#define GYRO_FILTER_NOTCH2(axis, value) GYRO_FILTER_STAGE_NONE(axis, value)
+#define GYRO_FILTER_LPF2(axis, value)   pt1FilterApply(&gyro.lowpass2Filter[axis].pt1FilterState, value)
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroLpf1None
+#define GYRO_FILTER_LPF1(axis, value) GYRO_FILTER_STAGE_NONE(axis, value)
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_LPF1
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroLpf1Pt1
+#define GYRO_FILTER_LPF1(axis, value) pt1FilterApply(&gyro.lowpassFilter[axis].pt1FilterState, value)
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_LPF1
+
+#undef GYRO_FILTER_NOTCH1
+#undef GYRO_FILTER_NOTCH2
+#undef GYRO_FILTER_LPF2
 #undef GYRO_FILTER_DEBUG_SET
 #undef GYRO_FILTER_AXIS_DEBUG_SET
 
+// Debug pipeline, generic
+#define GYRO_FILTER_NOTCH1(axis, value) GYRO_FILTER_STAGE_FN(gyro.notchFilter1ApplyFn, gyro.notchFilter1, axis, value)
+#define GYRO_FILTER_NOTCH2(axis, value) GYRO_FILTER_STAGE_FN(gyro.notchFilter2ApplyFn, gyro.notchFilter2, axis, value)
+#define GYRO_FILTER_LPF1(axis, value)   GYRO_FILTER_STAGE_FN(gyro.lowpassFilterApplyFn, gyro.lowpassFilter, axis, value)
+#define GYRO_FILTER_LPF2(axis, value)   GYRO_FILTER_STAGE_FN(gyro.lowpass2FilterApplyFn, gyro.lowpass2Filter, axis, value)
+
 #define GYRO_FILTER_FUNCTION_NAME filterGyroDebug
 #define GYRO_FILTER_DEBUG_SET DEBUG_SET
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) if (axis == (int)gyro.gyroDebugAxis) DEBUG_SET(mode, index, value)
@@ -464,13 +503,38 @@ FAST_CODE void gyroUpdate(void)
 #undef GYRO_FILTER_DEBUG_SET
 #undef GYRO_FILTER_AXIS_DEBUG_SET
 
-FAST_CODE void gyroFiltering(timeUs_t currentTimeUs)
+#undef GYRO_FILTER_NOTCH1
+#undef GYRO_FILTER_NOTCH2
+#undef GYRO_FILTER_LPF1
+#undef GYRO_FILTER_LPF2
+
+typedef void (*gyroFilterFnPtr)(void);
+
+static FAST_DATA gyroFilterFnPtr gyroFilterFn = filterGyro;
+
+// Picks the pipeline variant matching the filters set up by gyroInitFilters()
+void gyroInitFilterPipeline(void)
 {
-    if (gyro.gyroDebugMode == DEBUG_NONE) {
-        filterGyro();
+    // LPF2 is only applied when downsampling through it
+    const bool specialisable = gyro.notchFilter1ApplyFn == nullFilterApply && gyro.notchFilter2ApplyFn == nullFilterApply
+        && (!gyro.downsampleFilterEnabled || gyro.lowpass2FilterApplyFn == (filterApplyFnPtr)pt1FilterApply);
+
+    if (gyro.gyroDebugMode != DEBUG_NONE) {
+        gyroFilterFn = filterGyroDebug;
+    } else if (specialisable && gyro.lowpassFilterApplyFn == nullFilterApply) {
+        gyroFilterFn = filterGyroLpf1None;
+    } else if (specialisable && gyro.lowpassFilterApplyFn == (filterApplyFnPtr)pt1FilterApply) {
+        gyroFilterFn = filterGyroLpf1Pt1;
     } else {
-        filterGyroDebug();
+        gyroFilterFn = filterGyro;
     }
+}
+
+FAST_CODE void gyroFiltering(timeUs_t currentTimeUs)
+{
+    gyro.sampleCount = gyroRingRead(&gyro.sampleRing, gyro.samples, ARRAYLEN(gyro.samples));
+
+    gyroFilterFn();
 
 #ifdef USE_DYN_NOTCH_FILTER
     if (isDynNotchActive()) {
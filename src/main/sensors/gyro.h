@@ -37,6 +37,8 @@
 
 #include "pg/pg.h"
 
+#include "sensors/gyro_ring.h"
+
 #define LPF_MAX_HZ 1000 // so little filtering above 1000hz that if the user wants less delay, they must disable the filter
 #define DYN_LPF_MAX_HZ 1000
 
@@ -84,8 +86,10 @@ typedef struct gyro_s {
     float scale;
     float gyroADC[XYZ_AXIS_COUNT];     // aligned, calibrated, scaled, but unfiltered data from the sensor(s)
     float gyroADCf[XYZ_AXIS_COUNT];    // filtered gyro data
-    uint8_t sampleCount;               // gyro sensor sample counter
-    float sampleSum[XYZ_AXIS_COUNT];   // summed samples used for downsampling
+    gyroRing_t sampleRing;             // samples queued by gyroUpdate() for the filter task
+    gyroSample_t samples[GYRO_RING_SIZE]; // batch drained from sampleRing by gyroFiltering(), oldest first
+    uint8_t sampleCount;               // number of samples in the batch
+    float downsampled[XYZ_AXIS_COUNT]; // last downsampled value, held while no new samples arrive
     bool downsampleFilterEnabled;      // if true then downsample using gyro lowpass 2, otherwise use averaging
 
     gyroSensor_t gyroSensor1;
@@ -200,8 +204,9 @@ typedef struct gyroConfig_s {
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
 
-void gyroUpdate(void);
+void gyroUpdate(timeUs_t currentTimeUs);
 void gyroFiltering(timeUs_t currentTimeUs);
+void gyroInitFilterPipeline(void);
 bool gyroGetAccumulationAverage(float *accumulation);
 void gyroStartCalibration(bool isFirstArmingCalibration);
 bool isFirstArmingGyroCalibrationRunning(void);
@@ -20,8 +20,13 @@
 
 #include "platform.h"
 
-static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
+// Instantiated by gyro.c for each filter pipeline variant.
+// GYRO_FILTER_NOTCH1/NOTCH2/LPF1/LPF2(axis, value) expand to the stage filter, either called through the
+// function pointer set up by gyroInitFilters(), called directly or left out when the stage is disabled.
+STATIC_UNIT_TESTED FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
 {
+    float downsampled[XYZ_AXIS_COUNT];
+
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         // DEBUG_GYRO_RAW records the raw value read from the sensor (not zero offset, not scaled)
         GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_RAW, axis, gyro.rawSensorDev->gyroADCRaw[axis]);
@@ -33,33 +38,44 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
         // DEBUG_GYRO_SAMPLE(0) Record the pre-downsample value for the selected debug axis (same as DEBUG_GYRO_SCALED)
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 0, lrintf(gyro.gyroADC[axis]));
 
-        // downsample the individual gyro samples
-        float gyroADCf = 0;
-        if (gyro.downsampleFilterEnabled) {
-            // using gyro lowpass 2 filter for downsampling
-            gyroADCf = gyro.sampleSum[axis];
-        } else {
-            // using simple average for downsampling
-            if (gyro.sampleCount) {
-                gyroADCf = gyro.sampleSum[axis] / gyro.sampleCount;
+        // downsample the batch of samples drained from the gyro ring, hold the last value if there are none
+        if (gyro.sampleCount) {
+            float value = 0.0f;
+            if (gyro.downsampleFilterEnabled) {
+                // using gyro lowpass 2 filter for downsampling
+                for (int i = 0; i < gyro.sampleCount; i++) {
+                    value = GYRO_FILTER_LPF2(axis, gyro.samples[i].adc[axis]);
+                }
+            } else {
+                // using simple average for downsampling
+                for (int i = 0; i < gyro.sampleCount; i++) {
+                    value += gyro.samples[i].adc[axis];
+                }
+                value /= gyro.sampleCount;
             }
-            gyro.sampleSum[axis] = 0;
+            gyro.downsampled[axis] = value;
         }
+        downsampled[axis] = gyro.downsampled[axis];
 
         // DEBUG_GYRO_SAMPLE(1) Record the post-downsample value for the selected debug axis
-        GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 1, lrintf(gyroADCf));
+        GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 1, lrintf(downsampled[axis]));
+    }
 
 #ifdef USE_RPM_FILTER
-        gyroADCf = rpmFilterGyro(axis, gyroADCf);
+    // the RPM notch bank filters all axes in one pass
+    rpmFilterGyro(downsampled);
 #endif
 
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        float gyroADCf = downsampled[axis];
+
         // DEBUG_GYRO_SAMPLE(2) Record the post-RPM Filter value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 2, lrintf(gyroADCf));
 
         // apply static notch filters and software lowpass filters
-        gyroADCf = gyro.notchFilter1ApplyFn((filter_t *)&gyro.notchFilter1[axis], gyroADCf);
-        gyroADCf = gyro.notchFilter2ApplyFn((filter_t *)&gyro.notchFilter2[axis], gyroADCf);
-        gyroADCf = gyro.lowpassFilterApplyFn((filter_t *)&gyro.lowpassFilter[axis], gyroADCf);
+        gyroADCf = GYRO_FILTER_NOTCH1(axis, gyroADCf);
+        gyroADCf = GYRO_FILTER_NOTCH2(axis, gyroADCf);
+        gyroADCf = GYRO_FILTER_LPF1(axis, gyroADCf);
 
         // DEBUG_GYRO_SAMPLE(3) Record the post-static notch and lowpass filter value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 3, lrintf(gyroADCf));
@@ -87,5 +103,4 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
 
         gyro.gyroADCf[axis] = gyroADCf;
     }
-    gyro.sampleCount = 0;
 }
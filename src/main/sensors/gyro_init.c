@@ -258,6 +258,11 @@ void gyroInitFilters(void)
       gyro.sampleLooptime
     );
 
+    gyro.sampleCount = 0;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyro.downsampled[axis] = 0.0f;
+    }
+
     gyroInitFilterNotch1(gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
     gyroInitFilterNotch2(gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
 #ifdef USE_DYN_LPF
@@ -266,6 +271,7 @@ void gyroInitFilters(void)
 #ifdef USE_DYN_NOTCH_FILTER
     dynNotchInit(dynNotchConfig(), gyro.targetLooptime);
 #endif
+    gyroInitFilterPipeline();
 }
 
 #if defined(USE_GYRO_SLEW_LIMITER)
@@ -572,6 +578,8 @@ bool gyroInit(void)
     gyro.useDualGyroDebugging = false;
     gyro.gyroHasOverflowProtection = true;
 
+    gyroRingInit(&gyro.sampleRing);
+
     switch (debugMode) {
     case DEBUG_FFT:
     case DEBUG_FFT_FREQ:
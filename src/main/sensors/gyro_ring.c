@@ -0,0 +1,94 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "sensors/gyro_ring.h"
+
+// head and tail are free running, the slot is the index modulo GYRO_RING_SIZE.
+// Acquire/release ordering publishes the sample before head moves (and frees the slot before tail moves),
+// which is what the SITL gyro thread needs for the raw samples it queues in the fake gyro. On a single core MCU it costs no more than a barrier.
+#define GYRO_RING_LOAD(var)         __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define GYRO_RING_STORE(var, val)   __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+
+STATIC_ASSERT((GYRO_RING_SIZE & (GYRO_RING_SIZE - 1)) == 0, gyro_ring_size_not_power_of_2);
+
+void gyroRingInit(gyroRing_t *ring)
+{
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overruns = 0;
+}
+
+// Producer side. When the ring is full the new sample is dropped, only the consumer may move tail.
+FAST_CODE bool gyroRingPush(gyroRing_t *ring, timeUs_t timeUs, const float *adc)
+{
+    const uint32_t head = ring->head;
+    if (head - GYRO_RING_LOAD(ring->tail) >= GYRO_RING_SIZE) {
+        ring->overruns++;
+        return false;
+    }
+
+    gyroSample_t *sample = &ring->samples[head % GYRO_RING_SIZE];
+    sample->timeUs = timeUs;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        sample->adc[axis] = adc[axis];
+    }
+
+    GYRO_RING_STORE(ring->head, head + 1);
+    return true;
+}
+
+// Consumer side
+FAST_CODE uint32_t gyroRingCount(const gyroRing_t *ring)
+{
+    return GYRO_RING_LOAD(ring->head) - ring->tail;
+}
+
+// Consumer side. The oldest sample, left in the ring, or NULL if it is empty.
+FAST_CODE const gyroSample_t *gyroRingPeek(const gyroRing_t *ring)
+{
+    if (GYRO_RING_LOAD(ring->head) == ring->tail) {
+        return NULL;
+    }
+    return &ring->samples[ring->tail % GYRO_RING_SIZE];
+}
+
+// Consumer side. Copies out up to maxCount samples, oldest first, and returns how many were read.
+FAST_CODE uint32_t gyroRingRead(gyroRing_t *ring, gyroSample_t *samples, uint32_t maxCount)
+{
+    uint32_t tail = ring->tail;
+    const uint32_t count = MIN(GYRO_RING_LOAD(ring->head) - tail, maxCount);
+
+    for (uint32_t i = 0; i < count; i++) {
+        samples[i] = ring->samples[tail % GYRO_RING_SIZE];
+        tail++;
+    }
+
+    GYRO_RING_STORE(ring->tail, tail);
+    return count;
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Single producer, single consumer ring of timestamped gyro samples.
+// The gyro sampler pushes every sample, the filter task drains them in batches. Neither side blocks and
+// no critical section is needed as long as there is only one of each: the producer only writes head and
+// the consumer only writes tail.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/axis.h"
+#include "common/time.h"
+
+#define GYRO_RING_SIZE 16 // power of 2, holds a pid loop at the largest pid_process_denom, both ends run in the gyro task
+
+typedef struct gyroSample_s {
+    timeUs_t timeUs;
+    float adc[XYZ_AXIS_COUNT];  // aligned, calibrated, scaled, but unfiltered
+} gyroSample_t;
+
+typedef struct gyroRing_s {
+    uint32_t head;              // next slot to write, only written by the producer
+    uint32_t tail;              // next slot to read, only written by the consumer
+    uint32_t overruns;          // samples dropped because the consumer fell behind
+    gyroSample_t samples[GYRO_RING_SIZE];
+} gyroRing_t;
+
+void gyroRingInit(gyroRing_t *ring);
+bool gyroRingPush(gyroRing_t *ring, timeUs_t timeUs, const float *adc);
+uint32_t gyroRingCount(const gyroRing_t *ring);
+const gyroSample_t *gyroRingPeek(const gyroRing_t *ring);
+uint32_t gyroRingRead(gyroRing_t *ring, gyroSample_t *samples, uint32_t maxCount);
@@ -35,6 +35,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_tcp.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 #include "drivers/pwm_output.h"
 #include "drivers/light_led.h"
 
@@ -54,6 +55,8 @@ const timerHardware_t timerHardware[1]; // unused
 
 #include "rx/rx.h"
 
+#include "sensors/gyro.h"
+
 #include "dyad.h"
 #include "target/SITL/udplink.h"
 
@@ -65,10 +68,14 @@ static servo_packet pwmPkt;
 static struct timespec start_time;
 static double simRate = 1.0;
 static pthread_t tcpWorker, udpWorker;
+#if defined(SIMULATOR_GYRO_THREAD)
+static pthread_t gyroWorker;
+#endif
 static bool workerRunning = true;
 static udpLink_t stateLink, pwmLink;
 static pthread_mutex_t updateLock;
 static pthread_mutex_t mainLoopLock;
+static pthread_mutex_t timeLock = PTHREAD_MUTEX_INITIALIZER;
 
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
 
@@ -190,15 +197,39 @@ static void* udpThread(void* data) {
     return NULL;
 }
 
+#if defined(SIMULATOR_GYRO_THREAD)
+// Samples the fake gyro at the gyro rate. It only queues raw samples, calibration, scaling and everything
+// else gyroUpdate() does stays with taskGyroSample() on the main thread.
+static void* gyroThread(void* data) {
+    UNUSED(data);
+
+    while (workerRunning) {
+        const uint32_t sampleLooptimeUs = gyro.sampleLooptime;
+        if (sampleLooptimeUs == 0) {
+            // gyro not initialised yet
+            delay(1);
+            continue;
+        }
+        fakeGyroSample(micros());
+        delayMicroseconds(sampleLooptimeUs);
+    }
+
+    printf("gyroThread end!!\n");
+    return NULL;
+}
+#endif
+
 static void* tcpThread(void* data) {
     UNUSED(data);
 
     dyad_init();
     dyad_setTickInterval(0.2f);
-    dyad_setUpdateTimeout(0.5f);
+    // What the other threads write to the serial ports is sent after each update, so keep them short
+    dyad_setUpdateTimeout(0.001f);
 
     while (workerRunning) {
         dyad_update();
+        tcpDataOutAll();
     }
 
     dyad_shutdown();
@@ -243,6 +274,14 @@ void systemInit(void) {
         exit(1);
     }
 
+#if defined(SIMULATOR_GYRO_THREAD)
+    ret = pthread_create(&gyroWorker, NULL, gyroThread, NULL);
+    if (ret != 0) {
+        printf("Create gyroWorker error!\n");
+        exit(1);
+    }
+#endif
+
     // serial can't been slow down
     rescheduleTask(TASK_SERIAL, 1);
 }
@@ -252,6 +291,9 @@ void systemReset(void){
     workerRunning = false;
     pthread_join(tcpWorker, NULL);
     pthread_join(udpWorker, NULL);
+#if defined(SIMULATOR_GYRO_THREAD)
+    pthread_join(gyroWorker, NULL);
+#endif
     exit(0);
 }
 void systemResetToBootloader(bootloaderRequestType_e requestType) {
@@ -261,6 +303,9 @@ void systemResetToBootloader(bootloaderRequestType_e requestType) {
     workerRunning = false;
     pthread_join(tcpWorker, NULL);
     pthread_join(udpWorker, NULL);
+#if defined(SIMULATOR_GYRO_THREAD)
+    pthread_join(gyroWorker, NULL);
+#endif
     exit(0);
 }
 
@@ -305,12 +350,17 @@ uint64_t millis64_real() {
 uint64_t micros64() {
     static uint64_t last = 0;
     static uint64_t out = 0;
+
+    // also called from the gyro thread
+    pthread_mutex_lock(&timeLock);
     uint64_t now = nanos64_real();
 
     out += (now - last) * simRate;
     last = now;
+    const uint64_t result = out*1e-3;
+    pthread_mutex_unlock(&timeLock);
 
-    return out*1e-3;
+    return result;
 //    return micros64_real();
 }
 
@@ -584,14 +634,19 @@ void FLASH_Lock(void) {
 }
 
 FLASH_Status FLASH_ErasePage(uintptr_t Page_Address) {
-    UNUSED(Page_Address);
-//    printf("[FLASH_ErasePage]%x\n", Page_Address);
+    // Erased flash reads as all ones
+    if ((Page_Address >= (uintptr_t)eepromData) && (Page_Address + FLASH_PAGE_SIZE <= (uintptr_t)ARRAYEND(eepromData))) {
+        memset((void*)Page_Address, 0xFF, FLASH_PAGE_SIZE);
+    } else {
+        printf("[FLASH_ErasePage]%p out of range!\n", (void*)Page_Address);
+    }
     return FLASH_COMPLETE;
 }
 
 FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t value) {
     if ((addr >= (uintptr_t)eepromData) && (addr < (uintptr_t)ARRAYEND(eepromData))) {
-        *((uint32_t*)addr) = value;
+        // Programming can only clear bits, the word must have been erased to write any value to it
+        *((uint32_t*)addr) &= value;
         printf("[FLASH_ProgramWord]%p = %08x\n", (void*)addr, *((uint32_t*)addr));
     } else {
             printf("[FLASH_ProgramWord]%p out of range!\n", (void*)addr);
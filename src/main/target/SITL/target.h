@@ -40,10 +40,25 @@
 //#define SIMULATOR_IMU_SYNC
 //#define SIMULATOR_GYROPID_SYNC
 
+// sample the fake gyro from its own thread at the gyro rate, the main thread processes the queued raw samples
+#define SIMULATOR_GYRO_THREAD
+
+// record scheduler events, streamed to scheduler_trace.bin while a trace is running
+#define USE_SCHEDULER_TRACE
+
+// blackbox_device = FILE writes logs to the logs directory on the host
+#define USE_BLACKBOX_FILE
+
+// blackbox_device = SPIFLASH writes logs to a flash chip kept in flash.bin
+#define USE_FLASHFS
+#define USE_FLASH_FILE
+#define FLASH_FILENAME "flash.bin"
+
 // file name to save config
 #define EEPROM_FILENAME "eeprom.bin"
 #define CONFIG_IN_FILE
 #define EEPROM_SIZE     32768
+#define FLASH_PAGE_SIZE (0x400)
 
 #define U_ID_0 0
 #define U_ID_1 1
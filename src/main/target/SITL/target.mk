@@ -5,4 +5,8 @@ TARGET_SRC = \
             drivers/accgyro/accgyro_fake.c \
             drivers/barometer/barometer_fake.c \
             drivers/compass/compass_fake.c \
-            drivers/serial_tcp.c
+            drivers/serial_tcp.c \
+            drivers/flash.c \
+            drivers/flash_file.c \
+            io/flashfs.c \
+            blackbox/blackbox_file.c
@@ -340,6 +340,8 @@ extern uint8_t _dmaram_end__;
 
 #if ((TARGET_FLASH_SIZE > 256) || (FEATURE_CUT_LEVEL < 4))
 #define USE_HUFFMAN
+#define USE_BLACKBOX_BLOCK
+#define USE_BLACKBOX_GYRO_CAPTURE
 #define USE_PINIO
 #define USE_PINIOBOX
 #endif
@@ -365,6 +367,14 @@ extern uint8_t _dmaram_end__;
 #define USE_SERIALRX_XBUS       // JR
 #endif
 
+// Features which need more RAM than F405/F411 class targets can spare
+#if defined(STM32F7) || defined(STM32H7) || defined(SIMULATOR_BUILD)
+#define USE_TASK_HISTOGRAMS     // about 8K
+#define USE_BLACKBOX_HEADER_IMAGE   // about 8K
+#define USE_LATENCY_TRACE       // about 2K, and marks in the gyro, pid and motor paths
+#define USE_CLI_SETTING_NAME_INDEX  // 2 bytes per setting, about 1.2K
+#endif
+
 #if ((TARGET_FLASH_SIZE > 256) || (FEATURE_CUT_LEVEL < 1))
 #define USE_BOARD_INFO
 #define USE_EXTENDED_CMS_MENUS
@@ -0,0 +1,626 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "drivers/sdcard.h"
+    #include "drivers/time.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+    #include "io/asyncfatfs/fat_standard.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SECTOR_SIZE 512
+
+// A FAT16 volume with one sector per cluster, so that a supercluster is 256 clusters (128kB)
+#define PARTITION_START 1
+#define RESERVED_SECTORS 1
+#define FAT_SECTORS 129
+#define ROOT_ENTRIES 512
+#define ROOT_SECTORS (ROOT_ENTRIES * FAT_DIRECTORY_ENTRY_SIZE / SECTOR_SIZE)
+#define DATA_CLUSTERS 32768
+#define PARTITION_SECTORS (RESERVED_SECTORS + 2 * FAT_SECTORS + ROOT_SECTORS + DATA_CLUSTERS)
+
+#define FAT_START (PARTITION_START + RESERVED_SECTORS)
+#define ROOT_START (FAT_START + 2 * FAT_SECTORS)
+#define DATA_START (ROOT_START + ROOT_SECTORS)
+
+#define SUPERCLUSTER_SIZE (256 * SECTOR_SIZE)
+
+/*
+ * Card latency, in calls to sdcard_poll() that the card stays busy for. A block written on its own costs as much
+ * as starting a multiple block write, and blocks which continue a multiple block write are cheap.
+ */
+#define CARD_READ_POLLS 2
+#define CARD_SINGLE_WRITE_POLLS 24
+#define CARD_MULTIPLE_WRITE_POLLS 3
+
+typedef struct cardStats_s {
+    int reads;
+    int singleWrites;
+    int multipleWrites; // Number of multiple block writes started
+    int multipleWriteBlocks;
+    int busyPolls;
+} cardStats_t;
+
+// A RAM-backed sdcard which completes operations after a simulated busy period, like the SPI driver
+static struct {
+    std::vector<uint8_t> image;
+
+    int busyPolls;
+    sdcardBlockOperation_e operation;
+    uint32_t blockIndex;
+    uint8_t *buffer;
+    sdcard_operationCompleteCallback_c callback;
+    uint32_t callbackData;
+
+    bool multipleWrite;
+    bool multipleWriteStarting;
+    uint32_t multipleWriteNextBlock;
+    uint32_t multipleWriteBlocksRemain;
+
+    cardStats_t stats;
+} card;
+
+static timeMs_t testTimeMs;
+
+static uint8_t *cardSector(uint32_t blockIndex)
+{
+    return &card.image[blockIndex * SECTOR_SIZE];
+}
+
+static uint16_t cardFAT(uint32_t cluster)
+{
+    return ((uint16_t *) cardSector(FAT_START))[cluster];
+}
+
+static void buildVolume(void)
+{
+    card.image.assign((PARTITION_START + PARTITION_SECTORS) * SECTOR_SIZE, 0);
+
+    uint8_t *mbr = cardSector(0);
+    mbrPartitionEntry_t *partition = (mbrPartitionEntry_t *) (mbr + 446);
+    partition->type = MBR_PARTITION_TYPE_FAT16_LBA;
+    partition->lbaBegin = PARTITION_START;
+    partition->numSectors = PARTITION_SECTORS;
+    mbr[510] = 0x55;
+    mbr[511] = 0xAA;
+
+    uint8_t *sector = cardSector(PARTITION_START);
+    fatVolumeID_t *volume = (fatVolumeID_t *) sector;
+    volume->bytesPerSector = SECTOR_SIZE;
+    volume->sectorsPerCluster = 1;
+    volume->reservedSectorCount = RESERVED_SECTORS;
+    volume->numFATs = 2;
+    volume->rootEntryCount = ROOT_ENTRIES;
+    volume->totalSectors16 = PARTITION_SECTORS;
+    volume->media = 0xF8;
+    volume->FATSize16 = FAT_SECTORS;
+    sector[510] = FAT_VOLUME_ID_SIGNATURE_1;
+    sector[511] = FAT_VOLUME_ID_SIGNATURE_2;
+
+    for (int fat = 0; fat < 2; fat++) {
+        uint16_t *entries = (uint16_t *) cardSector(FAT_START + fat * FAT_SECTORS);
+        entries[0] = 0xFFF8;
+        entries[1] = 0xFFFF;
+    }
+}
+
+static void completeOperation(void)
+{
+    sdcard_operationCompleteCallback_c callback = card.callback;
+
+    card.callback = NULL;
+    if (card.operation == SDCARD_BLOCK_OPERATION_READ) {
+        memcpy(card.buffer, cardSector(card.blockIndex), SECTOR_SIZE);
+    }
+    if (callback) {
+        callback(card.operation, card.blockIndex, card.buffer, card.callbackData);
+    }
+}
+
+static void startOperation(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData, int busyPolls)
+{
+    EXPECT_LT(blockIndex, card.image.size() / SECTOR_SIZE);
+
+    card.operation = operation;
+    card.blockIndex = blockIndex;
+    card.buffer = buffer;
+    card.callback = callback;
+    card.callbackData = callbackData;
+    card.busyPolls = busyPolls;
+
+    if (operation == SDCARD_BLOCK_OPERATION_WRITE) {
+        // The buffer is sent to the card right away, it is only programming the flash that keeps the card busy
+        memcpy(cardSector(blockIndex), buffer, SECTOR_SIZE);
+    }
+}
+
+extern "C" {
+
+timeMs_t millis(void)
+{
+    return testTimeMs;
+}
+
+bool sdcard_poll(void)
+{
+    if (card.busyPolls > 0) {
+        card.stats.busyPolls++;
+        if (--card.busyPolls > 0) {
+            return false;
+        }
+        completeOperation();
+    }
+    return true;
+}
+
+bool sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (card.busyPolls > 0) {
+        return false;
+    }
+
+    card.multipleWrite = false;
+    card.stats.reads++;
+    startOperation(SDCARD_BLOCK_OPERATION_READ, blockIndex, buffer, callback, callbackData, CARD_READ_POLLS);
+    return true;
+}
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    if (card.busyPolls > 0) {
+        return SDCARD_OPERATION_BUSY;
+    }
+    if (card.multipleWrite && blockIndex == card.multipleWriteNextBlock) {
+        // Carry on with the write already in progress
+        return SDCARD_OPERATION_SUCCESS;
+    }
+
+    card.multipleWrite = true;
+    card.multipleWriteStarting = true;
+    card.multipleWriteNextBlock = blockIndex;
+    card.multipleWriteBlocksRemain = blockCount;
+    card.stats.multipleWrites++;
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (card.busyPolls > 0) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    int busyPolls;
+
+    if (card.multipleWrite && blockIndex == card.multipleWriteNextBlock) {
+        busyPolls = card.multipleWriteStarting ? CARD_SINGLE_WRITE_POLLS : CARD_MULTIPLE_WRITE_POLLS;
+        card.multipleWriteStarting = false;
+        card.multipleWriteNextBlock++;
+        card.stats.multipleWriteBlocks++;
+        if (--card.multipleWriteBlocksRemain == 0) {
+            card.multipleWrite = false;
+        }
+    } else {
+        // Writing anywhere else ends the multiple block write
+        card.multipleWrite = false;
+        busyPolls = CARD_SINGLE_WRITE_POLLS;
+        card.stats.singleWrites++;
+    }
+
+    startOperation(SDCARD_BLOCK_OPERATION_WRITE, blockIndex, buffer, callback, callbackData, busyPolls);
+    return SDCARD_OPERATION_IN_PROGRESS;
+}
+
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback)
+{
+    UNUSED(callback);
+}
+
+}
+
+static afatfsFilePtr_t openedFile;
+static bool fileClosed;
+
+static void fileOpened(afatfsFilePtr_t file)
+{
+    openedFile = file;
+}
+
+static void fileClosedCallback(void)
+{
+    fileClosed = true;
+}
+
+static void poll(void)
+{
+    testTimeMs++;
+    afatfs_poll();
+}
+
+static void mountVolume(void)
+{
+    buildVolume();
+    memset(&card.stats, 0, sizeof(card.stats));
+    card.busyPolls = 0;
+    card.multipleWrite = false;
+    testTimeMs = 0;
+
+    afatfs_init();
+    for (int i = 0; i < 1000000 && afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_INITIALIZATION; i++) {
+        poll();
+    }
+    ASSERT_EQ(AFATFS_FILESYSTEM_STATE_READY, afatfs_getFilesystemState());
+
+    // Wait out the freefile's directory entry commit so it doesn't count towards the writes we measure
+    testTimeMs += 1000;
+    while (!afatfs_flush()) {
+        poll();
+    }
+    memset(&card.stats, 0, sizeof(card.stats));
+}
+
+static void unmountVolume(void)
+{
+    int i;
+    for (i = 0; i < 1000000 && !afatfs_destroy(false); i++) {
+        poll();
+    }
+    EXPECT_LT(i, 1000000);
+    while (card.busyPolls > 0) {
+        sdcard_poll();
+    }
+}
+
+static afatfsFilePtr_t openFile(const char *filename, const char *mode)
+{
+    openedFile = NULL;
+    EXPECT_TRUE(afatfs_fopen(filename, mode, fileOpened));
+    for (int i = 0; i < 100000 && !openedFile; i++) {
+        poll();
+    }
+    return openedFile;
+}
+
+static void closeFile(afatfsFilePtr_t file)
+{
+    fileClosed = false;
+    int i;
+    for (i = 0; i < 100000 && !afatfs_fclose(file, fileClosedCallback); i++) {
+        poll();
+    }
+    for (; i < 100000 && !fileClosed; i++) {
+        poll();
+    }
+    EXPECT_TRUE(fileClosed);
+}
+
+static uint8_t patternByte(uint32_t offset)
+{
+    return (offset * 7 + (offset >> 9)) & 0xFF;
+}
+
+/*
+ * Write the pattern from `start` to `end` into the file a few bytes per poll, like the blackbox does. Returns the
+ * number of polls it took, and the longest run of polls where the file refused to accept anything.
+ */
+static int writePattern(afatfsFilePtr_t file, uint32_t start, uint32_t end, uint32_t bytesPerPoll, int *longestStall)
+{
+    uint8_t buffer[256];
+    uint32_t written = start;
+    int polls = 0;
+    int stall = 0;
+
+    *longestStall = 0;
+
+    while (written < end && polls < 10000000) {
+        uint32_t chunk = MIN(MIN(bytesPerPoll, (uint32_t) sizeof(buffer)), end - written);
+        for (uint32_t i = 0; i < chunk; i++) {
+            buffer[i] = patternByte(written + i);
+        }
+
+        uint32_t accepted = afatfs_fwrite(file, buffer, chunk);
+        written += accepted;
+
+        if (accepted == 0) {
+            stall++;
+            *longestStall = MAX(*longestStall, stall);
+        } else {
+            stall = 0;
+        }
+
+        poll();
+        polls++;
+    }
+
+    EXPECT_EQ(end, written);
+    return polls;
+}
+
+/*
+ * Replay the writes of a blackbox log at a 1kHz logging rate for the given number of seconds: a P-frame every loop,
+ * an I-frame every 32 loops and a slow frame ten times a second. Like the blackbox, we drop frames which don't fit in
+ * the free buffer space. Returns the number of bytes logged.
+ */
+static uint32_t replayBlackboxLog(afatfsFilePtr_t file, int seconds, int *droppedFrames)
+{
+    uint8_t buffer[64];
+    uint32_t logged = 0;
+
+    *droppedFrames = 0;
+
+    for (int loop = 0; loop < seconds * 1000; loop++) {
+        uint32_t frameSize = (loop % 32 == 0) ? 60 : 14 + loop % 5;
+        if (loop % 100 == 50) {
+            frameSize += 12;
+        }
+
+        if (afatfs_getFreeBufferSpace() < frameSize) {
+            (*droppedFrames)++;
+        } else {
+            for (uint32_t i = 0; i < frameSize; i++) {
+                buffer[i] = patternByte(logged + i);
+            }
+            logged += afatfs_fwrite(file, buffer, frameSize);
+        }
+
+        poll();
+    }
+
+    return logged;
+}
+
+static fatDirectoryEntry_t *findDirectoryEntryIn(uint32_t directorySector, int numEntries, const char *filename)
+{
+    uint8_t fatFilename[FAT_FILENAME_LENGTH];
+    fat_convertFilenameToFATStyle(filename, fatFilename);
+
+    fatDirectoryEntry_t *entries = (fatDirectoryEntry_t *) cardSector(directorySector);
+    for (int i = 0; i < numEntries; i++) {
+        if (memcmp(entries[i].filename, fatFilename, FAT_FILENAME_LENGTH) == 0) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+static fatDirectoryEntry_t *findDirectoryEntry(const char *filename)
+{
+    return findDirectoryEntryIn(ROOT_START, ROOT_ENTRIES, filename);
+}
+
+/*
+ * Follow the file's cluster chain in the first FAT on the card and return its length in clusters. Pass checkPattern
+ * to check that the file holds the pattern.
+ */
+static uint32_t verifyFileEntry(const fatDirectoryEntry_t *entry, uint32_t length, bool checkPattern)
+{
+    EXPECT_NE(nullptr, entry);
+    if (!entry) {
+        return 0;
+    }
+    EXPECT_EQ(length, entry->fileSize);
+
+    uint32_t cluster = entry->firstClusterLow;
+    uint32_t clusters = 0;
+    uint32_t offset = 0;
+    int mismatches = 0;
+
+    while (cluster >= FAT_SMALLEST_LEGAL_CLUSTER_NUMBER && !fat16_isEndOfChainMarker(cluster) && clusters <= DATA_CLUSTERS) {
+        const uint8_t *data = cardSector(DATA_START + cluster - FAT_SMALLEST_LEGAL_CLUSTER_NUMBER);
+        for (uint32_t i = 0; i < SECTOR_SIZE && offset < length; i++, offset++) {
+            if (checkPattern && data[i] != patternByte(offset)) {
+                mismatches++;
+            }
+        }
+        clusters++;
+        cluster = cardFAT(cluster);
+    }
+
+    EXPECT_EQ(length, offset);
+    EXPECT_EQ(0, mismatches);
+    EXPECT_TRUE(fat16_isEndOfChainMarker(cluster));
+
+    return clusters;
+}
+
+static uint32_t verifyFile(const char *filename, uint32_t length, bool checkPattern)
+{
+    return verifyFileEntry(findDirectoryEntry(filename), length, checkPattern);
+}
+
+TEST(AsyncFatFsTest, ContiguousLogIsWrittenInMultipleBlockRuns)
+{
+    const uint32_t length = 5 * SUPERCLUSTER_SIZE + 1000;
+    int longestStall;
+
+    mountVolume();
+
+    afatfsFilePtr_t file = openFile("LOG00001.BFL", "as");
+    ASSERT_NE(nullptr, file);
+
+    int polls = writePattern(file, 0, length, 128, &longestStall);
+    closeFile(file);
+    unmountVolume();
+
+    // Whole superclusters are kept, the preallocated one that was never written to went back to the freefile
+    EXPECT_EQ(6 * SUPERCLUSTER_SIZE / SECTOR_SIZE, verifyFile("LOG00001.BFL", length, true));
+
+    fatDirectoryEntry_t *log = findDirectoryEntry("LOG00001.BFL");
+    fatDirectoryEntry_t *freeFile = findDirectoryEntry("FREESPAC.E");
+    ASSERT_NE(nullptr, freeFile);
+    EXPECT_EQ(log->firstClusterLow + 6 * SUPERCLUSTER_SIZE / SECTOR_SIZE, freeFile->firstClusterLow);
+    EXPECT_EQ(freeFile->fileSize, verifyFile("FREESPAC.E", freeFile->fileSize, false) * SECTOR_SIZE);
+
+    // Nearly every data sector goes out as part of a multiple block write, and metadata only breaks those up rarely
+    const int dataSectors = length / SECTOR_SIZE;
+    EXPECT_GE(card.stats.multipleWriteBlocks, dataSectors);
+    EXPECT_LE(card.stats.multipleWrites, 8);
+    EXPECT_LE(card.stats.singleWrites, 14);
+
+    // The card keeps up with the writer, which is only held up briefly while a metadata commit goes out
+    EXPECT_LT(polls, (int) (length / 128) * 21 / 20);
+    EXPECT_LE(longestStall, 40);
+}
+
+TEST(AsyncFatFsTest, FileMetadataIsDeferredUntilCommit)
+{
+    int longestStall;
+
+    mountVolume();
+
+    afatfsFilePtr_t file = openFile("LOG00002.BFL", "as");
+    ASSERT_NE(nullptr, file);
+
+    // The new directory entry itself is written right away
+    for (int i = 0; i < 100; i++) {
+        poll();
+    }
+    fatDirectoryEntry_t *entry = findDirectoryEntry("LOG00002.BFL");
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(0, entry->firstClusterLow);
+
+    // Writing into the first supercluster allocates it, but the directory entry and FAT wait for the commit
+    const timeMs_t writeStartMs = testTimeMs;
+    writePattern(file, 0, SUPERCLUSTER_SIZE / 4, 100, &longestStall);
+    for (int i = 0; i < 100; i++) {
+        poll();
+    }
+    EXPECT_LT(testTimeMs - writeStartMs, 1000u);
+    EXPECT_EQ(0, entry->firstClusterLow);
+    EXPECT_EQ(0u, entry->fileSize);
+
+    testTimeMs += 1000;
+    for (int i = 0; i < 200; i++) {
+        poll();
+    }
+    EXPECT_NE(0, entry->firstClusterLow);
+    EXPECT_EQ((uint32_t) SUPERCLUSTER_SIZE, entry->fileSize);
+    EXPECT_TRUE(fat16_isEndOfChainMarker(cardFAT(entry->firstClusterLow + SUPERCLUSTER_SIZE / SECTOR_SIZE - 1)));
+
+    // An explicit flush commits straight away
+    writePattern(file, SUPERCLUSTER_SIZE / 4, 3 * SUPERCLUSTER_SIZE / 4, 100, &longestStall);
+    while (!afatfs_flush()) {
+        poll();
+    }
+    while (card.busyPolls > 0) {
+        sdcard_poll();
+    }
+    EXPECT_EQ((uint32_t) 2 * SUPERCLUSTER_SIZE, entry->fileSize);
+
+    closeFile(file);
+    unmountVolume();
+
+    EXPECT_EQ(SUPERCLUSTER_SIZE / SECTOR_SIZE, verifyFile("LOG00002.BFL", 3 * SUPERCLUSTER_SIZE / 4, true));
+}
+
+TEST(AsyncFatFsTest, RegularFileBacklogIsWrittenInMultipleBlockRuns)
+{
+    const uint32_t length = 64 * 1024;
+    int longestStall;
+
+    mountVolume();
+
+    afatfsFilePtr_t file = openFile("DATA.BIN", "a");
+    ASSERT_NE(nullptr, file);
+
+    // Faster than the card can keep up with one block at a time, so dirty sectors pile up in the cache
+    writePattern(file, 0, length, 256, &longestStall);
+    closeFile(file);
+    unmountVolume();
+
+    EXPECT_EQ(length / SECTOR_SIZE, verifyFile("DATA.BIN", length, true));
+
+    // The FAT sectors we extend the file's chain in stay in the cache while the file data streams past them
+    EXPECT_LE(card.stats.reads, 2);
+
+    // Most of the backlog drains in runs, and FAT updates for each new cluster don't each cost a write of their own
+    EXPECT_GE(card.stats.multipleWriteBlocks, (int) (length / SECTOR_SIZE) / 2);
+    EXPECT_LE(card.stats.singleWrites, (int) (length / SECTOR_SIZE) / 2);
+}
+
+TEST(AsyncFatFsTest, BlackboxLogReplay)
+{
+    int droppedFrames;
+
+    mountVolume();
+
+    openedFile = NULL;
+    ASSERT_TRUE(afatfs_mkdir("logs", fileOpened));
+    for (int i = 0; i < 100000 && !openedFile; i++) {
+        poll();
+    }
+    afatfsFilePtr_t logDirectory = openedFile;
+    ASSERT_NE(nullptr, logDirectory);
+    ASSERT_TRUE(afatfs_chdir(logDirectory));
+    closeFile(logDirectory);
+
+    afatfsFilePtr_t file = openFile("LOG00001.BFL", "as");
+    ASSERT_NE(nullptr, file);
+
+    memset(&card.stats, 0, sizeof(card.stats));
+    const afatfsCacheStats_t statsBefore = *afatfs_getCacheStats();
+
+    // Ten minutes of logging
+    const uint32_t length = replayBlackboxLog(file, 600, &droppedFrames);
+    closeFile(file);
+
+    const afatfsCacheStats_t *stats = afatfs_getCacheStats();
+    const uint32_t misses = stats->misses - statsBefore.misses;
+    const uint32_t coalescedWrites = stats->coalescedWrites - statsBefore.coalescedWrites;
+
+    unmountVolume();
+
+    const int superclusters = (length + SUPERCLUSTER_SIZE - 1) / SUPERCLUSTER_SIZE;
+
+    fatDirectoryEntry_t *logDirectoryEntry = findDirectoryEntry("LOGS");
+    ASSERT_NE(nullptr, logDirectoryEntry);
+    const uint32_t logDirectorySector = DATA_START + logDirectoryEntry->firstClusterLow - FAT_SMALLEST_LEGAL_CLUSTER_NUMBER;
+    verifyFileEntry(findDirectoryEntryIn(logDirectorySector, SECTOR_SIZE / FAT_DIRECTORY_ENTRY_SIZE, "LOG00001.BFL"), length, true);
+
+    EXPECT_EQ(0, droppedFrames);
+
+    // The FAT and directory sectors the log needs are never evicted and read back in
+    EXPECT_EQ(0u, misses);
+    EXPECT_EQ(0, card.stats.reads);
+
+    /*
+     * Each supercluster is written in multiple block writes which the metadata commit for extending the log into it
+     * breaks once, when it can't wait any longer. That metadata costs four more writes (a FAT sector for the old
+     * supercluster and the new one, and the freefile and log directory entries). Everything else that updates those
+     * is coalesced.
+     */
+    EXPECT_LE(card.stats.multipleWrites, 2 * superclusters + 1);
+    EXPECT_LE(card.stats.singleWrites, 4 * superclusters + 4);
+    EXPECT_GT(coalescedWrites, 0u);
+}
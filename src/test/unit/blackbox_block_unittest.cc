@@ -0,0 +1,375 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_block.h"
+    #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_io.h"
+    #include "common/huffman.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static std::vector<uint8_t> output;
+static int32_t deviceBytesFree = INT32_MAX;
+
+typedef std::vector<std::vector<int32_t>> frames_t;
+
+/*
+ * Reference decoder for 'B' frames, as a log viewer would implement it.
+ */
+class BlockReader {
+public:
+    BlockReader(const std::vector<uint8_t> &data, int fieldCount) : data(data), fieldCount(fieldCount), pos(0) {}
+
+    bool atEnd() const
+    {
+        return pos >= data.size();
+    }
+
+    frames_t readBlock()
+    {
+        EXPECT_EQ('B', data[pos]);
+        pos++;
+
+        const uint32_t frameCount = readUnsignedVB();
+        frames_t frames(frameCount, std::vector<int32_t>(fieldCount));
+
+        for (int field = 0; field < fieldCount; field++) {
+            const uint8_t header = data[pos++];
+            const int width = header & ~BLACKBOX_BLOCK_HUFFMAN;
+            EXPECT_LE(width, 32);
+
+            const size_t length = (frameCount * width + 7) / 8;
+            std::vector<uint8_t> packed = (header & BLACKBOX_BLOCK_HUFFMAN) ? readHuffman(length) : readBytes(length);
+
+            uint64_t bits = 0;
+            int bitCount = 0;
+            size_t byte = 0;
+            for (uint32_t frame = 0; frame < frameCount; frame++) {
+                while (bitCount < width) {
+                    bits |= (uint64_t)packed[byte++] << bitCount;
+                    bitCount += 8;
+                }
+                const uint32_t value = width ? bits & (0xffffffffu >> (32 - width)) : 0;
+                bits = width < 64 ? bits >> width : 0;
+                bitCount -= width;
+                frames[frame][field] = (int32_t)((value >> 1) ^ -(value & 1));
+            }
+        }
+
+        return frames;
+    }
+
+private:
+    uint32_t readUnsignedVB()
+    {
+        uint32_t value = 0;
+        for (int shift = 0; ; shift += 7) {
+            const uint8_t byte = data[pos++];
+            value |= (uint32_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+    }
+
+    std::vector<uint8_t> readBytes(size_t length)
+    {
+        std::vector<uint8_t> bytes(data.begin() + pos, data.begin() + pos + length);
+        pos += length;
+        return bytes;
+    }
+
+    // Codes are stored MSB first, the payload ends at the next byte boundary after the last symbol
+    std::vector<uint8_t> readHuffman(size_t length)
+    {
+        std::vector<uint8_t> bytes;
+        size_t bit = 0;
+        while (bytes.size() < length) {
+            uint16_t code = 0;
+            int codeLen = 0;
+            int symbol = -1;
+            while (symbol < 0) {
+                EXPECT_LT(codeLen, 16);
+                code = (code << 1) | ((data[pos + bit / 8] >> (7 - bit % 8)) & 1);
+                codeLen++;
+                bit++;
+                for (int i = 0; i < 256; i++) {
+                    if (huffmanTable[i].codeLen == codeLen && (huffmanTable[i].code >> (16 - codeLen)) == code) {
+                        symbol = i;
+                        break;
+                    }
+                }
+            }
+            bytes.push_back(symbol);
+        }
+        pos += (bit + 7) / 8;
+        return bytes;
+    }
+
+    const std::vector<uint8_t> &data;
+    const int fieldCount;
+    size_t pos;
+};
+
+static int32_t randomValue(int width)
+{
+    if (width == 0) {
+        return 0;
+    }
+    const uint32_t value = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+    return (int32_t)value >> (32 - width);
+}
+
+static frames_t writeFrames(int frameCount, int fieldCount, int32_t (*value)(int frame, int field))
+{
+    frames_t frames;
+    for (int frame = 0; frame < frameCount; frame++) {
+        std::vector<int32_t> values;
+        for (int field = 0; field < fieldCount; field++) {
+            values.push_back(value(frame, field));
+        }
+        // the logger adds fields in groups
+        blackboxBlockAddFields(values.data(), 1);
+        blackboxBlockAddFields(values.data() + 1, fieldCount - 1);
+        blackboxBlockEndFrame();
+        frames.push_back(values);
+    }
+    return frames;
+}
+
+static frames_t readFrames(int fieldCount)
+{
+    frames_t frames;
+    BlockReader reader(output, fieldCount);
+    while (!reader.atEnd()) {
+        frames_t block = reader.readBlock();
+        EXPECT_LE(block.size(), (size_t)BLACKBOX_BLOCK_MAX_FRAMES);
+        frames.insert(frames.end(), block.begin(), block.end());
+    }
+    return frames;
+}
+
+TEST(BlackboxBlockTest, RoundTrip)
+{
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, false);
+
+    // every width from 0 to 32, with a final partial block
+    const frames_t frames = writeFrames(BLACKBOX_BLOCK_MAX_FRAMES * 5 + 7, 33, [](int frame, int field) {
+        if (frame == 3) {
+            return field ? (int32_t)(INT32_MIN >> (32 - field)) : 0;
+        }
+        return randomValue(field);
+    });
+    blackboxBlockFlush();
+
+    EXPECT_EQ(frames, readFrames(33));
+}
+
+TEST(BlackboxBlockTest, QuietFieldsCostOneByte)
+{
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, false);
+
+    writeFrames(BLACKBOX_BLOCK_MAX_FRAMES, 10, [](int, int) { return 0; });
+    EXPECT_EQ(1u + 1 + 10, output.size());
+
+    // nothing pending, nothing written
+    blackboxBlockFlush();
+    EXPECT_EQ(1u + 1 + 10, output.size());
+}
+
+TEST(BlackboxBlockTest, HuffmanRoundTrip)
+{
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, true);
+
+    // mostly small residuals with the odd spike, which packs into bytes the static table codes well
+    const frames_t frames = writeFrames(BLACKBOX_BLOCK_MAX_FRAMES * 8, 12, [](int frame, int field) {
+        if ((frame + field) % 13 == 0) {
+            return (int32_t)(rand() % 1000) - 500;
+        }
+        return (int32_t)(rand() % 3) - 1;
+    });
+    const size_t huffmanSize = output.size();
+
+    EXPECT_EQ(frames, readFrames(12));
+
+    // the same frames without Huffman coding are larger
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, false);
+    for (const auto &frame : frames) {
+        blackboxBlockAddFields(frame.data(), frame.size());
+        blackboxBlockEndFrame();
+    }
+    EXPECT_LT(huffmanSize, output.size());
+}
+
+// Residuals shaped like those of a 4kHz log of a quad in flight
+static int32_t flightResidual(int, int field)
+{
+    const int noise = (rand() % 64 + rand() % 64) / 2 - 32;
+    switch (field) {
+    case 0:                     // time, second order difference
+        return rand() % 16 == 0 ? rand() % 3 - 1 : 0;
+    case 1: case 2: case 3:     // PID P
+        return noise;
+    case 4: case 5: case 6:     // PID I
+        return noise / 16;
+    case 7: case 8: case 9:     // PID D
+        return noise * 2;
+    case 10: case 11: case 12:  // PID F
+        return noise / 8;
+    case 13: case 14: case 15: case 16:  // rcCommand
+    case 17: case 18: case 19: case 20:  // setpoint
+        return rand() % 8 == 0 ? rand() % 5 - 2 : 0;
+    case 21: case 22:           // vbat, rssi
+        return 0;
+    case 23: case 24: case 25:  // gyro
+        return noise;
+    case 26: case 27: case 28:  // acc
+        return noise / 2;
+    default:                    // motors
+        return noise;
+    }
+}
+
+#define FLIGHT_FIELD_COUNT 33
+
+static void writePFrame(const std::vector<int32_t> &frame)
+{
+    std::vector<int32_t> values = frame;
+    int32_t *v = values.data();
+
+    blackboxWrite('P');
+    blackboxWriteSignedVB(v[0]);
+    blackboxWriteSignedVBArray(v + 1, 3);
+    blackboxWriteTag2_3S32(v + 4);
+    blackboxWriteSignedVBArray(v + 7, 3);
+    blackboxWriteSignedVBArray(v + 10, 3);
+    blackboxWriteTag8_4S16(v + 13);
+    blackboxWriteTag8_4S16(v + 17);
+    blackboxWriteTag8_8SVB(v + 21, 2);
+    blackboxWriteSignedVBArray(v + 23, FLIGHT_FIELD_COUNT - 23);
+}
+
+TEST(BlackboxBlockTest, SmallerThanPFrames)
+{
+    srand(1);
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, false);
+    const frames_t frames = writeFrames(4096, FLIGHT_FIELD_COUNT, flightResidual);
+    const size_t blockSize = output.size();
+
+    output.clear();
+    for (const auto &frame : frames) {
+        writePFrame(frame);
+    }
+    const size_t pFrameSize = output.size();
+
+    EXPECT_LT(blockSize, pFrameSize * 3 / 4);
+}
+
+TEST(BlackboxBlockTest, FlushedEarlyToFitTheDevice)
+{
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, false);
+
+    // room for about two frames of 16 full width fields at a time
+    deviceBytesFree = 1 + 1 + 16 * (1 + 8);
+    size_t flushed = 0;
+    frames_t frames;
+    for (int i = 0; i < BLACKBOX_BLOCK_MAX_FRAMES * 3; i++) {
+        const frames_t frame = writeFrames(1, 16, [](int, int) { return (int32_t)0x7FFFFFFF; });
+        frames.insert(frames.end(), frame.begin(), frame.end());
+        EXPECT_LE(output.size() - flushed, (size_t)deviceBytesFree);
+        flushed = output.size();
+    }
+    blackboxBlockFlush();
+    deviceBytesFree = INT32_MAX;
+
+    EXPECT_EQ(frames, readFrames(16));
+}
+
+TEST(BlackboxBlockTest, BlocksWhichDontFitAreDroppedWhole)
+{
+    output.clear();
+    blackboxBlockInit(BLACKBOX_BLOCK_MAX_FRAMES, false);
+
+    writeFrames(1, 16, [](int, int) { return (int32_t)0x7FFFFFFF; });
+    deviceBytesFree = 10;
+    blackboxBlockFlush();
+    EXPECT_EQ(0u, output.size());
+
+    // the frames after it are dropped too, even once there is room, as they can't be decoded without it
+    deviceBytesFree = INT32_MAX;
+    writeFrames(BLACKBOX_BLOCK_MAX_FRAMES, 16, [](int, int) { return (int32_t)1; });
+    blackboxBlockFlush();
+    EXPECT_EQ(0u, output.size());
+
+    // until the next I-frame
+    blackboxBlockResync();
+    const frames_t frames = writeFrames(BLACKBOX_BLOCK_MAX_FRAMES, 16, [](int, int) { return (int32_t)1; });
+    EXPECT_EQ(frames, readFrames(16));
+}
+
+// STUBS
+extern "C" {
+PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
+int32_t blackboxHeaderBudget;
+int32_t blackboxDeviceBytesFree(void)
+{
+    return deviceBytesFree;
+}
+void blackboxWrite(uint8_t value)
+{
+    output.push_back(value);
+}
+void blackboxWriteLE(uint64_t value, int count)
+{
+    for (int i = 0; i < count; i++) {
+        output.push_back(value >> (i * 8));
+    }
+}
+int blackboxWriteString(const char *s)
+{
+    const uint8_t *pos = (const uint8_t *)s;
+    while (*pos) {
+        output.push_back(*pos++);
+    }
+    return pos - (const uint8_t *)s;
+}
+}
@@ -15,13 +15,17 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include <vector>
+
 extern "C" {
     #include "platform.h"
 
     #include "blackbox/blackbox.h"
     #include "blackbox/blackbox_encoding.h"
+    #include "common/maths.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -240,12 +244,467 @@ TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS887)
     EXPECT_EQ(0, buf[3]); // ensure next byte has not been written
     buf += 3;
 }
+/*
+ * The encoders have been rewritten to choose field widths with bit tricks, the output must stay byte-identical to the
+ * original encoders below, and decode with the reference decoder (as in blackbox-tools) to the values written.
+ */
+typedef std::vector<uint8_t> bytes_t;
+
+static void referenceWriteUnsignedVB(bytes_t &out, uint32_t value)
+{
+    while (value > 127) {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(value);
+}
+
+static void referenceWriteSignedVB(bytes_t &out, int32_t value)
+{
+    referenceWriteUnsignedVB(out, (uint32_t)((value << 1) ^ (value >> 31)));
+}
+
+static void referenceWriteTag2_3S32(bytes_t &out, const int32_t *values)
+{
+    int selector = 0;
+    for (int x = 0; x < 3; x++) {
+        if (values[x] >= 32 || values[x] < -32) {
+            selector = 3;
+            break;
+        }
+        if (values[x] >= 8 || values[x] < -8) {
+            selector = MAX(selector, 2);
+        } else if (values[x] >= 2 || values[x] < -2) {
+            selector = MAX(selector, 1);
+        }
+    }
+
+    switch (selector) {
+    case 0:
+        out.push_back((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        break;
+    case 1:
+        out.push_back((selector << 6) | (values[0] & 0x0F));
+        out.push_back((values[1] << 4) | (values[2] & 0x0F));
+        break;
+    case 2:
+        out.push_back((selector << 6) | (values[0] & 0x3F));
+        out.push_back((uint8_t)values[1]);
+        out.push_back((uint8_t)values[2]);
+        break;
+    case 3:
+        int selector2 = 0;
+        for (int x = 2; x >= 0; x--) {
+            selector2 <<= 2;
+            if (values[x] < 128 && values[x] >= -128) {
+                selector2 |= 0;
+            } else if (values[x] < 32768 && values[x] >= -32768) {
+                selector2 |= 1;
+            } else if (values[x] < 8388608 && values[x] >= -8388608) {
+                selector2 |= 2;
+            } else {
+                selector2 |= 3;
+            }
+        }
+        out.push_back((selector << 6) | selector2);
+        for (int x = 0; x < 3; x++, selector2 >>= 2) {
+            for (int i = 0; i <= (selector2 & 0x03); i++) {
+                out.push_back(values[x] >> (i * 8));
+            }
+        }
+        break;
+    }
+}
+
+static void referenceWriteTag2_3SVariable(bytes_t &out, const int32_t *values)
+{
+    int selector = 0;
+    if (values[0] >= 256 || values[0] < -256 || values[1] >= 128 || values[1] < -128 || values[2] >= 128 || values[2] < -128) {
+        selector = 3;
+    } else if (values[0] >= 16 || values[0] < -16 || values[1] >= 16 || values[1] < -16 || values[2] >= 8 || values[2] < -8) {
+        selector = 2;
+    } else if (values[0] >= 2 || values[0] < -2 || values[1] >= 2 || values[1] < -2 || values[2] >= 2 || values[2] < -2) {
+        selector = 1;
+    }
+
+    switch (selector) {
+    case 0:
+        out.push_back((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        break;
+    case 1:
+        out.push_back((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
+        out.push_back(((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
+        break;
+    case 2:
+        out.push_back((selector << 6) | ((values[0] & 0xFF) >> 2));
+        out.push_back(((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
+        out.push_back(((values[1] & 0x01) << 7) | (values[2] & 0x7F));
+        break;
+    case 3:
+        // same trailing layout as blackboxWriteTag2_3S32()
+        bytes_t tail;
+        referenceWriteTag2_3S32(tail, values);
+        out.push_back((selector << 6) | (tail[0] & 0x3F));
+        out.insert(out.end(), tail.begin() + 1, tail.end());
+        break;
+    }
+}
+
+static void referenceWriteTag8_4S16(bytes_t &out, const int32_t *values)
+{
+    uint8_t selector = 0;
+    for (int x = 3; x >= 0; x--) {
+        selector <<= 2;
+        if (values[x] == 0) {
+            selector |= 0;
+        } else if (values[x] < 8 && values[x] >= -8) {
+            selector |= 1;
+        } else if (values[x] < 128 && values[x] >= -128) {
+            selector |= 2;
+        } else {
+            selector |= 3;
+        }
+    }
+    out.push_back(selector);
+
+    int nibbleIndex = 0;
+    uint8_t buffer = 0;
+    for (int x = 0; x < 4; x++, selector >>= 2) {
+        switch (selector & 0x03) {
+        case 1:
+            if (nibbleIndex == 0) {
+                buffer = values[x] << 4;
+                nibbleIndex = 1;
+            } else {
+                out.push_back(buffer | (values[x] & 0x0F));
+                nibbleIndex = 0;
+            }
+            break;
+        case 2:
+            if (nibbleIndex == 0) {
+                out.push_back(values[x]);
+            } else {
+                out.push_back(buffer | ((values[x] >> 4) & 0x0F));
+                buffer = values[x] << 4;
+            }
+            break;
+        case 3:
+            if (nibbleIndex == 0) {
+                out.push_back(values[x] >> 8);
+                out.push_back(values[x]);
+            } else {
+                out.push_back(buffer | ((values[x] >> 12) & 0x0F));
+                out.push_back(values[x] >> 4);
+                buffer = values[x] << 4;
+            }
+            break;
+        }
+    }
+    if (nibbleIndex == 1) {
+        out.push_back(buffer);
+    }
+}
+
+static void referenceWriteTag8_8SVB(bytes_t &out, const int32_t *values, int valueCount)
+{
+    if (valueCount == 1) {
+        referenceWriteSignedVB(out, values[0]);
+    } else if (valueCount > 1) {
+        uint8_t header = 0;
+        for (int i = valueCount - 1; i >= 0; i--) {
+            header = (header << 1) | (values[i] != 0);
+        }
+        out.push_back(header);
+        for (int i = 0; i < valueCount; i++) {
+            if (values[i] != 0) {
+                referenceWriteSignedVB(out, values[i]);
+            }
+        }
+    }
+}
+
+// Reference decoder
+struct reader_t {
+    const uint8_t *pos;
+    uint8_t readByte() { return *pos++; }
+};
+
+static int32_t signExtend(uint32_t value, int bits)
+{
+    return (int32_t)(value << (32 - bits)) >> (32 - bits);
+}
+
+static uint32_t readUnsignedVB(reader_t &in)
+{
+    uint32_t result = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        const uint8_t c = in.readByte();
+        result |= (uint32_t)(c & 0x7F) << shift;
+        if (c < 0x80) {
+            break;
+        }
+    }
+    return result;
+}
+
+static int32_t readSignedVB(reader_t &in)
+{
+    const uint32_t value = readUnsignedVB(in);
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static void readTag2_3S32(reader_t &in, int32_t *values)
+{
+    uint8_t leadByte = in.readByte();
+    uint8_t byte1;
+
+    switch (leadByte >> 6) {
+    case 0:
+        values[0] = signExtend((leadByte >> 4) & 0x03, 2);
+        values[1] = signExtend((leadByte >> 2) & 0x03, 2);
+        values[2] = signExtend(leadByte & 0x03, 2);
+        break;
+    case 1:
+        values[0] = signExtend(leadByte & 0x0F, 4);
+        byte1 = in.readByte();
+        values[1] = signExtend(byte1 >> 4, 4);
+        values[2] = signExtend(byte1 & 0x0F, 4);
+        break;
+    case 2:
+        values[0] = signExtend(leadByte & 0x3F, 6);
+        values[1] = signExtend(in.readByte() & 0x3F, 6);
+        values[2] = signExtend(in.readByte() & 0x3F, 6);
+        break;
+    case 3:
+        for (int i = 0; i < 3; i++, leadByte >>= 2) {
+            uint32_t value = 0;
+            const int byteCount = (leadByte & 0x03) + 1;
+            for (int b = 0; b < byteCount; b++) {
+                value |= (uint32_t)in.readByte() << (b * 8);
+            }
+            values[i] = signExtend(value, byteCount * 8);
+        }
+        break;
+    }
+}
+
+static void readTag8_4S16(reader_t &in, int32_t *values)
+{
+    uint8_t selector = in.readByte();
+    int nibbleIndex = 0;
+    uint8_t buffer = 0;
+
+    for (int i = 0; i < 4; i++, selector >>= 2) {
+        switch (selector & 0x03) {
+        case 0:
+            values[i] = 0;
+            break;
+        case 1:
+            if (nibbleIndex == 0) {
+                buffer = in.readByte();
+                values[i] = signExtend(buffer >> 4, 4);
+                nibbleIndex = 1;
+            } else {
+                values[i] = signExtend(buffer & 0x0F, 4);
+                nibbleIndex = 0;
+            }
+            break;
+        case 2:
+            if (nibbleIndex == 0) {
+                values[i] = (int8_t)in.readByte();
+            } else {
+                uint8_t value = buffer << 4;
+                buffer = in.readByte();
+                values[i] = (int8_t)(value | (buffer >> 4));
+            }
+            break;
+        case 3:
+            if (nibbleIndex == 0) {
+                const uint8_t high = in.readByte();
+                values[i] = (int16_t)((high << 8) | in.readByte());
+            } else {
+                const uint8_t middle = in.readByte();
+                const uint8_t low = in.readByte();
+                values[i] = (int16_t)(((buffer & 0x0F) << 12) | (middle << 4) | (low >> 4));
+                buffer = low;
+            }
+            break;
+        }
+    }
+}
+
+static void readTag8_8SVB(reader_t &in, int32_t *values, int valueCount)
+{
+    if (valueCount == 1) {
+        values[0] = readSignedVB(in);
+    } else {
+        uint8_t header = in.readByte();
+        for (int i = 0; i < valueCount; i++, header >>= 1) {
+            values[i] = (header & 0x01) ? readSignedVB(in) : 0;
+        }
+    }
+}
+
+// Values either side of every field width boundary
+static const int32_t boundaryValues[] = {
+    0, 1, -1, 2, -2, -3, 7, -8, 8, -9, 15, -16, 16, -17, 31, -32, 32, -33, 127, -128, 128, -129, 255, -256, 256, -257,
+    2047, -2048, 32767, -32768, 32768, -32769, 8388607, -8388608, 8388608, -8388609, INT32_MAX, INT32_MIN
+};
+
+// A random value with a random number of significant bits, so every width is well covered
+static int32_t randomValue(int maxBits)
+{
+    const int bits = rand() % (maxBits + 1);
+    const uint32_t value = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+    return bits == 0 ? 0 : signExtend(value & (0xFFFFFFFFu >> (32 - bits)), bits);
+}
+
+static bytes_t written(void)
+{
+    return bytes_t(serialWriteBuffer, serialWriteBuffer + serialWritePos);
+}
+
+TEST(BlackboxEncodingTest, TestUnsignedVBMatchesReference)
+{
+    std::vector<uint32_t> values;
+    for (int bit = 0; bit < 32; bit++) {
+        values.push_back(1u << bit);
+        values.push_back((1u << bit) - 1);
+        values.push_back((1u << bit) + 1);
+    }
+    values.push_back(UINT32_MAX);
+    for (int i = 0; i < 20000; i++) {
+        values.push_back((uint32_t)randomValue(32));
+    }
+
+    for (uint32_t value : values) {
+        serialTestResetBuffers();
+        blackboxWriteUnsignedVB(value);
+        bytes_t expected;
+        referenceWriteUnsignedVB(expected, value);
+        ASSERT_EQ(expected, written()) << "value " << value;
+
+        reader_t in = { serialWriteBuffer };
+        EXPECT_EQ(value, readUnsignedVB(in));
+        EXPECT_EQ(serialWritePos, in.pos - serialWriteBuffer);
+
+        serialTestResetBuffers();
+        blackboxWriteSignedVB((int32_t)value);
+        expected.clear();
+        referenceWriteSignedVB(expected, (int32_t)value);
+        ASSERT_EQ(expected, written()) << "value " << (int32_t)value;
+    }
+}
+
+TEST(BlackboxEncodingTest, TestTag2_3S32MatchesReference)
+{
+    std::vector<std::vector<int32_t>> cases;
+    for (int32_t a : boundaryValues) {
+        for (int32_t b : boundaryValues) {
+            for (int32_t c : boundaryValues) {
+                cases.push_back({ a, b, c });
+            }
+        }
+    }
+    for (int i = 0; i < 20000; i++) {
+        cases.push_back({ randomValue(32), randomValue(32), randomValue(32) });
+    }
+
+    for (auto &values : cases) {
+        serialTestResetBuffers();
+        blackboxWriteTag2_3S32(values.data());
+        bytes_t expected;
+        referenceWriteTag2_3S32(expected, values.data());
+        ASSERT_EQ(expected, written()) << values[0] << " " << values[1] << " " << values[2];
+
+        int32_t decoded[3];
+        reader_t in = { serialWriteBuffer };
+        readTag2_3S32(in, decoded);
+        EXPECT_EQ(serialWritePos, in.pos - serialWriteBuffer);
+        for (int x = 0; x < 3; x++) {
+            ASSERT_EQ(values[x], decoded[x]);
+        }
+
+        serialTestResetBuffers();
+        const int selector = blackboxWriteTag2_3SVariable(values.data());
+        expected.clear();
+        referenceWriteTag2_3SVariable(expected, values.data());
+        ASSERT_EQ(expected, written()) << values[0] << " " << values[1] << " " << values[2];
+        EXPECT_EQ(expected[0] >> 6, selector);
+    }
+}
+
+TEST(BlackboxEncodingTest, TestTag8_4S16MatchesReference)
+{
+    std::vector<std::vector<int32_t>> cases;
+    for (int32_t a : boundaryValues) {
+        for (int32_t b : boundaryValues) {
+            for (int32_t c : boundaryValues) {
+                if (a == (int16_t)a && b == (int16_t)b && c == (int16_t)c) {
+                    cases.push_back({ a, b, c, a });
+                    cases.push_back({ 0, a, b, c });
+                }
+            }
+        }
+    }
+    for (int i = 0; i < 20000; i++) {
+        cases.push_back({ randomValue(16), randomValue(16), randomValue(16), randomValue(16) });
+    }
+
+    for (auto &values : cases) {
+        serialTestResetBuffers();
+        blackboxWriteTag8_4S16(values.data());
+        bytes_t expected;
+        referenceWriteTag8_4S16(expected, values.data());
+        ASSERT_EQ(expected, written()) << values[0] << " " << values[1] << " " << values[2] << " " << values[3];
+
+        int32_t decoded[4];
+        reader_t in = { serialWriteBuffer };
+        readTag8_4S16(in, decoded);
+        EXPECT_EQ(serialWritePos, in.pos - serialWriteBuffer);
+        for (int x = 0; x < 4; x++) {
+            ASSERT_EQ(values[x], decoded[x]);
+        }
+    }
+}
+
+TEST(BlackboxEncodingTest, TestTag8_8SVBMatchesReference)
+{
+    for (int i = 0; i < 20000; i++) {
+        const int valueCount = 1 + rand() % 8;
+        int32_t values[8];
+        for (int x = 0; x < valueCount; x++) {
+            values[x] = (rand() % 3 == 0) ? 0 : randomValue(32);
+        }
+
+        serialTestResetBuffers();
+        blackboxWriteTag8_8SVB(values, valueCount);
+        bytes_t expected;
+        referenceWriteTag8_8SVB(expected, values, valueCount);
+        ASSERT_EQ(expected, written());
+
+        int32_t decoded[8];
+        reader_t in = { serialWriteBuffer };
+        readTag8_8SVB(in, decoded, valueCount);
+        EXPECT_EQ(serialWritePos, in.pos - serialWriteBuffer);
+        for (int x = 0; x < valueCount; x++) {
+            ASSERT_EQ(values[x], decoded[x]);
+        }
+    }
+}
+
 // STUBS
 extern "C" {
 PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
 int32_t blackboxHeaderBudget;
 void mspSerialAllocatePorts(void) {}
 void blackboxWrite(uint8_t value) {serialWrite(blackboxPort, value);}
+void blackboxWriteLE(uint64_t value, int count)
+{
+    for (int i = 0; i < count; i++) {
+        serialWrite(blackboxPort, value >> (i * 8));
+    }
+}
 int blackboxWriteString(const char *s)
 {
     const uint8_t *pos = (uint8_t*)s;
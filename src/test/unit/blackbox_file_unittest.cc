@@ -0,0 +1,154 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_file.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// The file operations complete on the writer thread, keep calling until they do
+static bool waitFor(bool (*done)(bool), bool arg)
+{
+    for (int i = 0; i < 5000; i++) {
+        if (done(arg)) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static bool beginLog(bool)
+{
+    return blackboxFileBeginLog();
+}
+
+static bool flush(bool)
+{
+    return blackboxFileFlush();
+}
+
+static std::vector<uint8_t> readFile(const char *filename)
+{
+    std::vector<uint8_t> data;
+    FILE *file = fopen(filename, "rb");
+    if (file) {
+        int c;
+        while ((c = fgetc(file)) != EOF) {
+            data.push_back(c);
+        }
+        fclose(file);
+    }
+    return data;
+}
+
+static bool fileExists(const char *filename)
+{
+    struct stat st;
+    return stat(filename, &st) == 0;
+}
+
+class BlackboxFileTest : public ::testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        char directory[] = "/tmp/blackbox_file_unittest_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(directory));
+        ASSERT_EQ(0, chdir(directory));
+        ASSERT_TRUE(blackboxFileInit());
+    }
+};
+
+TEST_F(BlackboxFileTest, WritesNumberedLogs)
+{
+    ASSERT_TRUE(waitFor(beginLog, false));
+    EXPECT_EQ(1, blackboxFileGetLogNumber());
+
+    // more than the ring holds, in frame sized pieces, as the logger would write it
+    std::vector<uint8_t> expected;
+    for (int i = 0; i < 3 * BLACKBOX_FILE_RING_SIZE / 2; i++) {
+        expected.push_back(rand());
+    }
+    for (size_t offset = 0; offset < expected.size(); ) {
+        const uint32_t length = std::min<size_t>(200, expected.size() - offset);
+        offset += blackboxFileWrite(&expected[offset], length);
+        if (blackboxFileBytesFree() < length) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    ASSERT_TRUE(waitFor(flush, false));
+    ASSERT_TRUE(waitFor(blackboxFileEndLog, true));
+
+    EXPECT_EQ(expected, readFile(BLACKBOX_FILE_DIRECTORY "/LOG00001.BFL"));
+
+    // the next log takes the next number, a discarded log is deleted
+    ASSERT_TRUE(waitFor(beginLog, false));
+    EXPECT_EQ(2, blackboxFileGetLogNumber());
+    const uint8_t data[] = "H Product:Blackbox flight data recorder by Nicholas Sherlock\n";
+    EXPECT_EQ(sizeof(data), blackboxFileWrite(data, sizeof(data)));
+    ASSERT_TRUE(waitFor(blackboxFileEndLog, false));
+    EXPECT_FALSE(fileExists(BLACKBOX_FILE_DIRECTORY "/LOG00002.BFL"));
+    EXPECT_TRUE(fileExists(BLACKBOX_FILE_DIRECTORY "/LOG00001.BFL"));
+}
+
+TEST_F(BlackboxFileTest, NumbersOnFromLargestLog)
+{
+    FILE *file = fopen(BLACKBOX_FILE_DIRECTORY "/LOG00041.BFL", "wb");
+    ASSERT_NE(nullptr, file);
+    fclose(file);
+
+    ASSERT_TRUE(waitFor(beginLog, false));
+    EXPECT_EQ(42, blackboxFileGetLogNumber());
+    ASSERT_TRUE(waitFor(blackboxFileEndLog, true));
+    EXPECT_TRUE(fileExists(BLACKBOX_FILE_DIRECTORY "/LOG00042.BFL"));
+}
+
+TEST_F(BlackboxFileTest, DropsWhenFull)
+{
+    ASSERT_TRUE(waitFor(beginLog, false));
+
+    // a single write larger than the ring can only be partly queued, and never blocks
+    std::vector<uint8_t> data(2 * BLACKBOX_FILE_RING_SIZE, 0x55);
+    const uint32_t droppedBefore = blackboxFileDroppedBytes();
+    const uint32_t queued = blackboxFileWrite(data.data(), data.size());
+    EXPECT_LE(queued, (uint32_t)BLACKBOX_FILE_RING_SIZE);
+    EXPECT_EQ(data.size() - queued, blackboxFileDroppedBytes() - droppedBefore);
+
+    ASSERT_TRUE(waitFor(flush, false));
+    ASSERT_TRUE(waitFor(blackboxFileEndLog, true));
+    EXPECT_EQ(queued, readFile(BLACKBOX_FILE_DIRECTORY "/LOG00043.BFL").size());
+}
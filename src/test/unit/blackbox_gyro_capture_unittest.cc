@@ -0,0 +1,171 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_gyro_capture.h"
+
+    #include "common/utils.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SAMPLE_PERIOD_US 125 // 8kHz gyro
+
+static timeUs_t sampleTimeUs;
+static uint16_t motorErpm[BLACKBOX_GYRO_CAPTURE_MAX_ERPM];
+
+// Push a batch of count samples the way the filter task does, sample i of the batch reads base + i on every axis
+static void pushBatch(int count, float base, float filtered)
+{
+    gyroSample_t samples[GYRO_RING_SIZE];
+    for (int i = 0; i < count; i++) {
+        samples[i].timeUs = sampleTimeUs;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            samples[i].adc[axis] = base + i + axis * 0.2f;
+        }
+        sampleTimeUs += SAMPLE_PERIOD_US;
+    }
+    const float gyroADCf[XYZ_AXIS_COUNT] = { filtered, -filtered, 2 * filtered };
+    blackboxGyroCapturePush(samples, count, gyroADCf);
+}
+
+static int readAll(void)
+{
+    blackboxGyroCaptureSample_t sample;
+    int count = 0;
+    while (blackboxGyroCaptureRead(&sample)) {
+        count++;
+    }
+    return count;
+}
+
+class BlackboxGyroCaptureTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        sampleTimeUs = 1000000;
+        blackboxGyroCaptureStop();
+        readAll();
+    }
+};
+
+TEST_F(BlackboxGyroCaptureTest, IgnoresSamplesWhenNotCapturing)
+{
+    pushBatch(4, 10, 10);
+
+    EXPECT_FALSE(blackboxGyroCaptureIsActive());
+    EXPECT_EQ(0, readAll());
+}
+
+TEST_F(BlackboxGyroCaptureTest, CapturesEverySampleOfTheBatch)
+{
+    blackboxGyroCaptureStart(1000000, 0);
+    pushBatch(4, 10, 7.6f);
+
+    blackboxGyroCaptureSample_t sample;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(blackboxGyroCaptureRead(&sample));
+        EXPECT_EQ(1000000U + i * SAMPLE_PERIOD_US, sample.timeUs);
+        EXPECT_EQ(10 + i, sample.gyroUnfilt[FD_ROLL]);
+        EXPECT_EQ(10 + i, sample.gyroUnfilt[FD_YAW]);
+        // the filtered value of the batch, rounded
+        EXPECT_EQ(8, sample.gyroADC[FD_ROLL]);
+        EXPECT_EQ(-8, sample.gyroADC[FD_PITCH]);
+        EXPECT_EQ(15, sample.gyroADC[FD_YAW]);
+    }
+    EXPECT_FALSE(blackboxGyroCaptureRead(&sample));
+}
+
+TEST_F(BlackboxGyroCaptureTest, EndsAfterDuration)
+{
+    // 10ms at 8kHz is 80 samples, counted from the first one
+    blackboxGyroCaptureStart(10000, 0);
+
+    int captured = 0;
+    for (int batch = 0; batch < 50; batch++) {
+        pushBatch(2, 0, 0);
+        captured += readAll();
+    }
+
+    EXPECT_FALSE(blackboxGyroCaptureIsActive());
+    EXPECT_EQ(80, captured);
+}
+
+TEST_F(BlackboxGyroCaptureTest, StopKeepsQueuedSamples)
+{
+    blackboxGyroCaptureStart(1000000, 0);
+    pushBatch(3, 0, 0);
+    blackboxGyroCaptureStop();
+    pushBatch(3, 0, 0);
+
+    EXPECT_EQ(3, readAll());
+}
+
+TEST_F(BlackboxGyroCaptureTest, DropsSamplesWhenFull)
+{
+    blackboxGyroCaptureStart(1000000, 0);
+    for (int i = 0; i < BLACKBOX_GYRO_CAPTURE_RING_SIZE / 8 + 1; i++) {
+        pushBatch(8, i * 8, 0);
+    }
+
+    // the oldest samples are kept, the time stamps show where the gap is
+    blackboxGyroCaptureSample_t sample;
+    for (int i = 0; i < BLACKBOX_GYRO_CAPTURE_RING_SIZE; i++) {
+        ASSERT_TRUE(blackboxGyroCaptureRead(&sample));
+        EXPECT_EQ(i, sample.gyroUnfilt[FD_ROLL]);
+    }
+    EXPECT_FALSE(blackboxGyroCaptureRead(&sample));
+
+    pushBatch(1, 100, 0);
+    ASSERT_TRUE(blackboxGyroCaptureRead(&sample));
+    EXPECT_EQ(100, sample.gyroUnfilt[FD_ROLL]);
+    EXPECT_EQ(1000000U + (BLACKBOX_GYRO_CAPTURE_RING_SIZE + 8) * SAMPLE_PERIOD_US, sample.timeUs);
+}
+
+TEST_F(BlackboxGyroCaptureTest, CapturesErpmOfConfiguredMotors)
+{
+    for (int motor = 0; motor < BLACKBOX_GYRO_CAPTURE_MAX_ERPM; motor++) {
+        motorErpm[motor] = 100 + motor;
+    }
+
+    blackboxGyroCaptureStart(1000000, 4);
+    pushBatch(1, 0, 0);
+
+    blackboxGyroCaptureSample_t sample;
+    memset(&sample, 0, sizeof(sample));
+    ASSERT_TRUE(blackboxGyroCaptureRead(&sample));
+    for (int motor = 0; motor < 4; motor++) {
+        EXPECT_EQ(100 + motor, sample.erpm[motor]);
+    }
+}
+
+// STUBS
+extern "C" {
+uint16_t getDshotTelemetry(uint8_t index)
+{
+    return motorErpm[index];
+}
+}
@@ -0,0 +1,402 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Adaptive P-frame predictors.
+//
+// Besides checking the predictors and how they are chosen, this measures the logged size of the gyro,
+// setpoint and motor fields with the fixed predictors and with adaptive predictors chosen every I-frame
+// interval, as P-frames at two logging rates. The trace is read from the CSV named by BLACKBOX_PREDICTOR_CSV,
+// as written by blackbox_decode ("gyroADC[0..2]", "setpoint[0..3]" and "motor[0..3]" columns). Without a CSV a synthetic flight (smooth
+// stick input, gyro following it with motor noise on top, noisy motor outputs) is used.
+//
+//   BLACKBOX_PREDICTOR_CSV=flight.csv make test_blackbox_predictor_unittest
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_io.h"
+    #include "blackbox/blackbox_predictor.h"
+    #include "common/maths.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static uint32_t outputBytes;
+
+static const FlightLogFieldPredictor candidates[] = {
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS,
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2,
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE,
+    FLIGHT_LOG_FIELD_PREDICTOR_SECOND_ORDER,
+};
+
+TEST(BlackboxPredictorTest, Predict)
+{
+    EXPECT_EQ(7, blackboxPredict(FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, 7, 4, 0));
+    EXPECT_EQ(5, blackboxPredict(FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, 7, 4, 0));
+    EXPECT_EQ(-5, blackboxPredict(FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, -7, -4, 0));
+    EXPECT_EQ(10, blackboxPredict(FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE, 7, 4, 0));
+    // 0, 4, 7: the slope drops by one each frame
+    EXPECT_EQ(9, blackboxPredict(FLIGHT_LOG_FIELD_PREDICTOR_SECOND_ORDER, 7, 4, 0));
+}
+
+TEST(BlackboxPredictorTest, ResidualUsesPredictorInUse)
+{
+    blackboxPredictorSelector_t selector;
+    for (const FlightLogFieldPredictor predictor : candidates) {
+        blackboxPredictorSelectorInit(&selector, predictor, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB);
+        EXPECT_EQ(predictor, blackboxPredictorCurrent(&selector));
+        for (int i = 0; i < 1000; i++) {
+            const int32_t value = rand() % 65536 - 32768;
+            const int32_t prev1 = rand() % 65536 - 32768;
+            const int32_t prev2 = rand() % 65536 - 32768;
+            const int32_t prev3 = rand() % 65536 - 32768;
+            EXPECT_EQ(value - blackboxPredict(predictor, prev1, prev2, prev3), blackboxPredictorResidual(&selector, value, prev1, prev2, prev3));
+        }
+    }
+}
+
+// The residuals of the best predictor need fewer bytes than the others
+static FlightLogFieldPredictor selectFor(FlightLogFieldEncoding encoding, int32_t (*signal)(int frame))
+{
+    blackboxPredictorSelector_t selector;
+    blackboxPredictorSelectorInit(&selector, FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, encoding);
+    for (int frame = 3; frame < 64; frame++) {
+        blackboxPredictorResidual(&selector, signal(frame), signal(frame - 1), signal(frame - 2), signal(frame - 3));
+    }
+    const FlightLogFieldPredictor predictor = blackboxPredictorSelect(&selector);
+    EXPECT_EQ(predictor, blackboxPredictorCurrent(&selector));
+    return predictor;
+}
+
+TEST(BlackboxPredictorTest, SelectsPredictorForSignal)
+{
+    // a zero residual only saves space with the tag encodings, VB always writes a byte
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, selectFor(FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, [](int frame) { return (frame / 16) * 100; }));
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, selectFor(FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, [](int frame) { return frame % 2 ? 50 : -50; }));
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE, selectFor(FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, [](int frame) { return frame * 100; }));
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_SECOND_ORDER, selectFor(FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, [](int frame) { return frame * frame * 50; }));
+
+    // with nothing measured the predictor stays as it is
+    blackboxPredictorSelector_t selector;
+    blackboxPredictorSelectorInit(&selector, FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB);
+    EXPECT_EQ(FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, blackboxPredictorSelect(&selector));
+}
+
+#define GYRO_FIELDS 3
+#define SETPOINT_FIELDS 4
+#define MOTOR_FIELDS 4
+#define I_INTERVAL 64
+#define SYNTHETIC_RATE_HZ 2000
+#define SYNTHETIC_FRAMES (SYNTHETIC_RATE_HZ * 30)
+
+typedef struct traceFrame_s {
+    int32_t gyro[GYRO_FIELDS];
+    int32_t setpoint[SETPOINT_FIELDS];
+    int32_t motor[MOTOR_FIELDS];
+} traceFrame_t;
+
+static std::vector<std::string> splitCsvLine(const std::string &line)
+{
+    std::vector<std::string> fields;
+    size_t start = 0;
+    while (start <= line.size()) {
+        size_t end = line.find(',', start);
+        if (end == std::string::npos) {
+            end = line.size();
+        }
+        std::string field = line.substr(start, end - start);
+        field.erase(0, field.find_first_not_of(" \r\n"));
+        field.erase(field.find_last_not_of(" \r\n") + 1);
+        fields.push_back(field);
+        start = end + 1;
+    }
+    return fields;
+}
+
+static int findCsvColumn(const std::vector<std::string> &header, const char *name, int index)
+{
+    const std::string wanted = std::string(name) + "[" + std::to_string(index) + "]";
+    for (size_t i = 0; i < header.size(); i++) {
+        if (header[i] == wanted || header[i].rfind(wanted + " ", 0) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool loadTraceCsv(const char *path, std::vector<traceFrame_t> *trace)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    char buf[4096];
+    while (fgets(buf, sizeof(buf), fp)) {
+        lines.push_back(buf);
+    }
+    fclose(fp);
+    if (lines.size() < 2) {
+        return false;
+    }
+
+    const std::vector<std::string> header = splitCsvLine(lines[0]);
+    int gyroColumn[GYRO_FIELDS];
+    int setpointColumn[SETPOINT_FIELDS];
+    int motorColumn[MOTOR_FIELDS];
+    for (int i = 0; i < GYRO_FIELDS; i++) {
+        gyroColumn[i] = findCsvColumn(header, "gyroADC", i);
+    }
+    for (int i = 0; i < SETPOINT_FIELDS; i++) {
+        setpointColumn[i] = findCsvColumn(header, "setpoint", i);
+    }
+    for (int i = 0; i < MOTOR_FIELDS; i++) {
+        motorColumn[i] = findCsvColumn(header, "motor", i);
+    }
+
+    for (size_t line = 1; line < lines.size(); line++) {
+        const std::vector<std::string> row = splitCsvLine(lines[line]);
+        if (row.size() < header.size()) {
+            continue;
+        }
+        traceFrame_t frame = {};
+        for (int i = 0; i < GYRO_FIELDS; i++) {
+            frame.gyro[i] = gyroColumn[i] >= 0 ? atoi(row[gyroColumn[i]].c_str()) : 0;
+        }
+        for (int i = 0; i < SETPOINT_FIELDS; i++) {
+            frame.setpoint[i] = setpointColumn[i] >= 0 ? atoi(row[setpointColumn[i]].c_str()) : 0;
+        }
+        for (int i = 0; i < MOTOR_FIELDS; i++) {
+            frame.motor[i] = motorColumn[i] >= 0 ? atoi(row[motorColumn[i]].c_str()) : 0;
+        }
+        trace->push_back(frame);
+    }
+
+    return trace->size() > I_INTERVAL;
+}
+
+static uint32_t syntheticNoiseSeed = 1;
+
+static float syntheticNoise(void)
+{
+    syntheticNoiseSeed = syntheticNoiseSeed * 1664525 + 1013904223;
+    return (syntheticNoiseSeed >> 8) / (float)(1 << 24) - 0.5f;
+}
+
+// A raised cosine pulse of the given width starting every period seconds
+static float pulse(float seconds, float period, float width)
+{
+    const float t = fmodf(seconds, period);
+    return t < width ? 0.5f - 0.5f * cosf(2 * M_PI * t / width) : 0.0f;
+}
+
+// Freestyle: a roll flip every 1.5s, slower pitch and yaw moves, throttle punches, gyro following the sticks
+// with the residual motor noise after filtering, motor outputs with the noise coming through the D term.
+// The noise grows with throttle.
+static void generateSyntheticTrace(std::vector<traceFrame_t> *trace)
+{
+    float gyro[GYRO_FIELDS] = {};
+
+    syntheticNoiseSeed = 1;
+    for (int i = 0; i < SYNTHETIC_FRAMES; i++) {
+        const float seconds = (float)i / SYNTHETIC_RATE_HZ;
+        const float stick[GYRO_FIELDS] = {
+            900.0f * pulse(seconds, 1.5f, 0.4f) - 900.0f * pulse(seconds + 0.75f, 1.5f, 0.4f),
+            200.0f * sinf(2 * M_PI * 0.4f * seconds) + 100.0f * sinf(2 * M_PI * 1.3f * seconds),
+            150.0f * sinf(2 * M_PI * 0.25f * seconds),
+        };
+        const float throttle = 0.35f + 0.1f * sinf(2 * M_PI * 0.3f * seconds) + 0.5f * pulse(seconds, 5.0f, 0.8f);
+        const float motorHz = 100.0f + 300.0f * throttle;
+        const float noise = 0.5f + 8.0f * throttle * throttle;
+
+        traceFrame_t frame;
+        for (int axis = 0; axis < GYRO_FIELDS; axis++) {
+            gyro[axis] += (stick[axis] - gyro[axis]) * 0.05f;
+            frame.setpoint[axis] = lrintf(stick[axis]);
+            frame.gyro[axis] = lrintf(gyro[axis] + noise * (sinf(2 * M_PI * motorHz * seconds + axis) + syntheticNoise()));
+        }
+        frame.setpoint[SETPOINT_FIELDS - 1] = lrintf(1000.0f * throttle);
+        for (int motor = 0; motor < MOTOR_FIELDS; motor++) {
+            const float mix = (motor & 1 ? 1 : -1) * (stick[0] - gyro[0]) + (motor & 2 ? 1 : -1) * (stick[1] - gyro[1]);
+            frame.motor[motor] = constrain(lrintf(100.0f + 1900.0f * throttle + 2.0f * mix + 4.0f * noise * syntheticNoise()), 48, 2047);
+        }
+        trace->push_back(frame);
+    }
+}
+
+static const std::vector<traceFrame_t> &getTrace(void)
+{
+    static std::vector<traceFrame_t> trace;
+    if (trace.empty()) {
+        const char *path = getenv("BLACKBOX_PREDICTOR_CSV");
+        const char *source = "synthetic";
+        if (path && loadTraceCsv(path, &trace)) {
+            source = path;
+        } else {
+            if (path) {
+                printf("could not read %s, using synthetic data\n", path);
+            }
+            trace.clear();
+            generateSyntheticTrace(&trace);
+        }
+        printf("%s: %u frames\n", source, (unsigned)trace.size());
+    }
+    return trace;
+}
+
+typedef struct fieldGroup_s {
+    blackboxPredictorGroup_e group;
+    size_t offset;
+    int count;
+    FlightLogFieldPredictor defaultPredictor;
+    FlightLogFieldEncoding encoding;
+} fieldGroup_t;
+
+static const fieldGroup_t fieldGroups[] = {
+    { BLACKBOX_PREDICTOR_GROUP_SETPOINT, offsetof(traceFrame_t, setpoint), SETPOINT_FIELDS, FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 },
+    { BLACKBOX_PREDICTOR_GROUP_GYRO, offsetof(traceFrame_t, gyro), GYRO_FIELDS, FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB },
+    { BLACKBOX_PREDICTOR_GROUP_MOTOR, offsetof(traceFrame_t, motor), MOTOR_FIELDS, FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB },
+};
+
+#define FIELD_GROUP_COUNT (sizeof(fieldGroups) / sizeof(fieldGroups[0]))
+
+static const int32_t *groupValues(const traceFrame_t &frame, const fieldGroup_t &group)
+{
+    return (const int32_t *)((const char *)&frame + group.offset);
+}
+
+/*
+ * Log one field group of every step'th frame of the trace the way writeInterframe() does, with an I-frame every
+ * I_INTERVAL frames (not counted, it is the same either way) and P-frames in between, and
+ * return the bytes written.
+ */
+static uint32_t logGroup(const std::vector<traceFrame_t> &trace, const fieldGroup_t &group, int step, bool adaptive)
+{
+    blackboxPredictorSelector_t selector;
+    blackboxPredictorSelectorInit(&selector, group.defaultPredictor, group.encoding);
+    outputBytes = 0;
+
+    const traceFrame_t *history[4];
+    for (size_t i = 0, frame = 0; i < trace.size(); i += step, frame++) {
+        if (frame % I_INTERVAL == 0) {
+            history[1] = history[2] = history[3] = &trace[i];
+            if (adaptive) {
+                blackboxPredictorSelect(&selector);
+            }
+            continue;
+        }
+        history[0] = &trace[i];
+
+        int32_t residuals[MOTOR_FIELDS];
+        for (int field = 0; field < group.count; field++) {
+            const int32_t value = groupValues(*history[0], group)[field];
+            const int32_t prev1 = groupValues(*history[1], group)[field];
+            const int32_t prev2 = groupValues(*history[2], group)[field];
+            const int32_t prev3 = groupValues(*history[3], group)[field];
+            if (adaptive) {
+                residuals[field] = blackboxPredictorResidual(&selector, value, prev1, prev2, prev3);
+            } else {
+                residuals[field] = value - blackboxPredict(group.defaultPredictor, prev1, prev2, prev3);
+            }
+        }
+
+        if (group.encoding == FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16) {
+            blackboxWriteTag8_4S16(residuals);
+        } else {
+            blackboxWriteSignedVBArray(residuals, group.count);
+        }
+
+        history[3] = history[2];
+        history[2] = history[1];
+        history[1] = history[0];
+    }
+
+    return outputBytes;
+}
+
+TEST(BlackboxPredictorTest, AdaptiveLogIsSmaller)
+{
+    static const struct {
+        const char *name;
+        int step;
+    } configs[] = {
+        { "every frame", 1 },
+        { "every 4th frame", 4 },
+    };
+    static const char *groupNames[] = { "setpoint", "gyro", "motor" };
+    const std::vector<traceFrame_t> &trace = getTrace();
+
+    for (const auto &config : configs) {
+        uint32_t fixedTotal = 0;
+        uint32_t adaptiveTotal = 0;
+        printf("%s\n", config.name);
+        for (size_t g = 0; g < FIELD_GROUP_COUNT; g++) {
+            const uint32_t fixedBytes = logGroup(trace, fieldGroups[g], config.step, false);
+            const uint32_t adaptiveBytes = logGroup(trace, fieldGroups[g], config.step, true);
+            printf("  %-8s fixed %8u bytes, adaptive %8u bytes (%.0f%%)\n", groupNames[g], fixedBytes, adaptiveBytes,
+                100.0 * adaptiveBytes / fixedBytes);
+            // adapting costs at most a little, while a worse predictor is in use after the signal changes
+            EXPECT_LE(adaptiveBytes, fixedBytes + fixedBytes / 50);
+            fixedTotal += fixedBytes;
+            adaptiveTotal += adaptiveBytes;
+        }
+        printf("  total    fixed %8u bytes, adaptive %8u bytes (%.0f%%)\n", fixedTotal, adaptiveTotal, 100.0 * adaptiveTotal / fixedTotal);
+        EXPECT_LT(adaptiveTotal, fixedTotal);
+    }
+}
+
+// STUBS
+extern "C" {
+PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
+int32_t blackboxHeaderBudget;
+void blackboxWrite(uint8_t)
+{
+    outputBytes++;
+}
+void blackboxWriteLE(uint64_t, int count)
+{
+    outputBytes += count;
+}
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
+    outputBytes += length;
+    return length;
+}
+}
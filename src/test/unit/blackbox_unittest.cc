@@ -15,14 +15,18 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
+#include <string>
+
 extern "C" {
     #include "platform.h"
 
     #include "build/debug.h"
 
     #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_fielddefs.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -40,6 +44,7 @@ extern "C" {
 
     #include "fc/rc_controls.h"
     #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
 
     #include "io/gps.h"
     #include "io/serial.h"
@@ -51,6 +56,7 @@ extern "C" {
 
     extern int16_t blackboxIInterval;
     extern int16_t blackboxPInterval;
+    extern pidProfile_t *currentPidProfile;
 }
 
 #include "unittest_macros.h"
@@ -330,6 +336,185 @@ TEST(BlackboxTest, Test_CalculateRates)
 }
 
 
+static uint32_t serialTxFree;
+static uint32_t serialBytesWritten;
+static int serialWriteCount;
+static uint32_t testMillis;
+static uint32_t configChangeCount;
+static bool gyroCaptureSwitchPresent;
+
+// Bytes written to the serial port, while a test is capturing them
+static uint8_t *serialCapture;
+static int serialCaptureLength;
+
+TEST(BlackboxTest, Test_FramesWrittenWhole)
+{
+    // 4kHz logging from an 8kHz PID loop, to a serial port which never fills up
+    targetPidLooptime = 125;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->sample_rate = 1;
+    blackboxInit();
+
+    static pidProfile_t pidProfile;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pidProfile.pid[axis].D = 30;
+    }
+    currentPidProfile = &pidProfile;
+
+    ENABLE_ARMING_FLAG(ARMED);
+    blackboxUpdate(0);
+    DISABLE_ARMING_FLAG(ARMED);
+    serialTxFree = 0x10000;
+
+    const int iterations = 20000;
+    uint32_t frameBytes[2] = { 0, 0 };
+    int frameCount[2] = { 0, 0 };
+
+    for (int i = 0; i < iterations; i++) {
+        const int frameType = blackboxShouldLogIFrame() ? 0 : 1;
+        const bool logged = frameType == 0 || blackboxShouldLogPFrame();
+        const uint32_t bytesBefore = serialBytesWritten;
+        const int writesBefore = serialWriteCount;
+
+        blackboxLogIteration(i * targetPidLooptime);
+        blackboxAdvanceIterationTimers();
+
+        if (logged) {
+            // each frame reaches the device in a single write
+            EXPECT_EQ(writesBefore + 1, serialWriteCount);
+            frameBytes[frameType] += serialBytesWritten - bytesBefore;
+            frameCount[frameType]++;
+        }
+    }
+
+    for (int frameType = 0; frameType < 2; frameType++) {
+        ASSERT_GT(frameCount[frameType], 0);
+        EXPECT_GT(frameBytes[frameType], 0u);
+    }
+    // P-frames only carry the change from the prediction, so they are smaller on average
+    EXPECT_LT(frameBytes[1] / frameCount[1], frameBytes[0] / frameCount[0]);
+}
+
+// Arm and run the blackbox until the header has been written, returns the number of iterations it took
+static int captureHeader(uint8_t *buffer, int *length, bool renderImage)
+{
+    serialCapture = buffer;
+    serialCaptureLength = 0;
+    testMillis = 0;
+
+    // As if the configuration had just been loaded
+    configChangeCount++;
+    blackboxInit();
+    if (renderImage) {
+        // The header image is rendered a line at a time while disarmed
+        for (int i = 0; i < 1000; i++) {
+            blackboxUpdate(1);
+        }
+    }
+
+    ENABLE_ARMING_FLAG(ARMED);
+    int lastWrite = 0;
+    for (int i = 0; i < 5000; i++) {
+        const int lengthBefore = serialCaptureLength;
+        blackboxUpdate(i * 125);
+        testMillis = i / 8;
+        if (serialCaptureLength != lengthBefore) {
+            lastWrite = i;
+        }
+    }
+    DISABLE_ARMING_FLAG(ARMED);
+
+    // The serial port never drains in these tests, so both ways of starting a log wait at the cache flush that
+    // follows the header
+    *length = serialCaptureLength;
+    serialCapture = NULL;
+
+    return lastWrite;
+}
+
+TEST(BlackboxTest, Test_HeaderImage)
+{
+    targetPidLooptime = 125;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->sample_rate = 1;
+    serialTxFree = 0x10000;
+
+    static uint8_t streamed[16384];
+    int streamedLength;
+    // Without a chance to render the image while disarmed, the header lines are streamed at arm
+    const int streamedIterations = captureHeader(streamed, &streamedLength, false);
+
+    static uint8_t image[16384];
+    int imageLength;
+    const int imageIterations = captureHeader(image, &imageLength, true);
+
+    ASSERT_GT(streamedLength, 0);
+    EXPECT_EQ(streamedLength, imageLength);
+    EXPECT_EQ(0, memcmp(streamed, image, streamedLength));
+    EXPECT_LT(imageIterations, streamedIterations);
+
+    // A configuration change the image hasn't caught up with yet falls back to streaming the header
+    blackboxConfigMutable()->fields_disabled_mask = 1 << FLIGHT_LOG_FIELD_SELECT_PID;
+    configChangeCount++;
+    serialCapture = image;
+    serialCaptureLength = 0;
+    blackboxInit();
+    for (int i = 0; i < 1000; i++) {
+        blackboxUpdate(1);
+    }
+    blackboxConfigMutable()->fields_disabled_mask = 0;
+    configChangeCount++;
+    blackboxUpdate(1);
+    ENABLE_ARMING_FLAG(ARMED);
+    for (int i = 0; i < 5000; i++) {
+        blackboxUpdate(i * 125);
+        testMillis = i / 8;
+    }
+    DISABLE_ARMING_FLAG(ARMED);
+    serialCapture = NULL;
+
+    EXPECT_EQ(streamedLength, serialCaptureLength);
+    EXPECT_EQ(0, memcmp(streamed, image, streamedLength));
+}
+
+static bool headerHasDataVersion(const uint8_t *header, int length, int version)
+{
+    const std::string line = "H Data version:" + std::to_string(version) + "\n";
+    const std::string text((const char *)header, length);
+    return text.find(line) != std::string::npos;
+}
+
+TEST(BlackboxTest, Test_DataVersion)
+{
+    targetPidLooptime = 125;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->sample_rate = 1;
+    serialTxFree = 0x10000;
+
+    static uint8_t header[16384];
+    int headerLength;
+
+    captureHeader(header, &headerLength, false);
+    EXPECT_TRUE(headerHasDataVersion(header, headerLength, 2));
+
+    // Older decoders don't know 'B' frames and must reject the log
+    blackboxConfigMutable()->block_frames = 8;
+    captureHeader(header, &headerLength, false);
+    EXPECT_TRUE(headerHasDataVersion(header, headerLength, 3));
+    blackboxConfigMutable()->block_frames = 0;
+
+    blackboxConfigMutable()->adaptive_predictors = true;
+    captureHeader(header, &headerLength, false);
+    EXPECT_TRUE(headerHasDataVersion(header, headerLength, 3));
+    blackboxConfigMutable()->adaptive_predictors = false;
+
+    // Nor 'R' frames, which may appear whenever a GYRO CAPTURE switch is configured
+    gyroCaptureSwitchPresent = true;
+    captureHeader(header, &headerLength, false);
+    EXPECT_TRUE(headerHasDataVersion(header, headerLength, 3));
+    gyroCaptureSwitchPresent = false;
+}
+
 // STUBS
 extern "C" {
 
@@ -365,17 +550,29 @@ uint16_t getBatteryVoltageLatest(void) {return 0;}
 uint8_t getMotorCount(void) {return 4;}
 bool areMotorsRunning(void) { return false; }
 bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
-bool isModeActivationConditionPresent(boxId_e) {return false;}
-uint32_t millis(void) {return 0;}
+bool isModeActivationConditionPresent(boxId_e boxId) {return boxId == BOXGYROCAPTURE && gyroCaptureSwitchPresent;}
+uint32_t millis(void) {return testMillis;}
+uint32_t getConfigChangeCount(void) {return configChangeCount;}
 bool sensors(uint32_t) {return false;}
 void serialWrite(serialPort_t *, uint8_t) {}
-uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    if (serialCapture) {
+        memcpy(serialCapture + serialCaptureLength, data, count);
+        serialCaptureLength += count;
+    }
+    serialBytesWritten += count;
+    serialWriteCount++;
+}
+uint32_t serialTxBytesFree(const serialPort_t *) {return serialTxFree;}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
 bool featureIsEnabled(uint32_t) {return false;}
 void mspSerialReleasePortIfAllocated(serialPort_t *) {}
-const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
+static serialPortConfig_t serialPortConfig;
+static serialPort_t serialPort;
+const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return &serialPortConfig;}
 serialPort_t *findSharedSerialPort(uint16_t , serialPortFunction_e ) {return NULL;}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &serialPort;}
 void closeSerialPort(serialPort_t *) {}
 portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e ) {return PORTSHARING_UNUSED;}
 failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
@@ -0,0 +1,311 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include <string>
+
+// the firmware headers use C11 static assertions, which g++ only knows by their C++ name
+#define _Static_assert static_assert
+
+extern "C" {
+    #include "platform.h"
+    #include "target.h"
+    #include "build/version.h"
+    #include "cli/cli.h"
+    #include "cli/settings.h"
+    #include "common/printf.h"
+    #include "config/feature.h"
+    #include "drivers/buf_writer.h"
+    #include "drivers/vtx_common.h"
+    #include "config/config.h"
+    #include "fc/rc_adjustments.h"
+    #include "fc/runtime_config.h"
+    #include "flight/mixer.h"
+    #include "flight/pid.h"
+    #include "flight/servos.h"
+    #include "io/beeper.h"
+    #include "io/ledstrip.h"
+    #include "io/serial.h"
+    #include "io/vtx.h"
+    #include "msp/msp.h"
+    #include "msp/msp_box.h"
+    #include "osd/osd.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/beeper.h"
+    #include "pg/rx.h"
+    #include "rx/rx.h"
+    #include "scheduler/scheduler.h"
+    #include "sensors/battery.h"
+    #include "sensors/gyro.h"
+
+    uint16_t cliGetSettingIndex(char *name, uint8_t length);
+
+    PG_REGISTER(osdConfig_t, osdConfig, PG_OSD_CONFIG, 0);
+    PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+    PG_REGISTER(ledStripConfig_t, ledStripConfig, PG_LED_STRIP_CONFIG, 0);
+    PG_REGISTER(ledStripStatusModeConfig_t, ledStripStatusModeConfig, PG_LED_STRIP_STATUS_MODE_CONFIG, 0);
+    PG_REGISTER(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 0);
+    PG_REGISTER(pilotConfig_t, pilotConfig, PG_PILOT_CONFIG, 0);
+    PG_REGISTER_ARRAY(adjustmentRange_t, MAX_ADJUSTMENT_RANGE_COUNT, adjustmentRanges, PG_ADJUSTMENT_RANGE_CONFIG, 0);
+    PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
+    PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+    PG_REGISTER_ARRAY(motorMixer_t, MAX_SUPPORTED_MOTORS, customMotorMixer, PG_MOTOR_MIXER, 0);
+    PG_REGISTER_ARRAY(servoParam_t, MAX_SUPPORTED_SERVOS, servoParams, PG_SERVO_PARAMS, 0);
+    PG_REGISTER_ARRAY(servoMixer_t, MAX_SERVO_RULES, customServoMixers, PG_SERVO_MIXER, 0);
+    PG_REGISTER(beeperConfig_t, beeperConfig, PG_BEEPER_CONFIG, 0);
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+    PG_REGISTER(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
+    PG_REGISTER_ARRAY(rxChannelRangeConfig_t, NON_AUX_CHANNEL_COUNT, rxChannelRangeConfigs, PG_RX_CHANNEL_RANGE_CONFIG, 0);
+    PG_REGISTER_ARRAY(rxFailsafeChannelConfig_t, MAX_SUPPORTED_RC_CHANNEL_COUNT, rxFailsafeChannelConfigs, PG_RX_FAILSAFE_CHANNEL_CONFIG, 0);
+    PG_REGISTER(pidConfig_t, pidConfig, PG_PID_CONFIG, 0);
+    PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * These tests look settings up by name in the real settings table, rather than the one made up for cli_unittest.
+ */
+
+// How cliGetSettingIndex() found a setting before it kept an index, for comparison
+static uint16_t linearGetSettingIndex(char *name, uint8_t length)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const char *settingName = valueTable[i].name;
+
+        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
+            return i;
+        }
+    }
+    return valueTableEntryCount;
+}
+
+TEST(CliSettingsUnittest, EverySettingResolves)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        std::string name = valueTable[i].name;
+
+        EXPECT_EQ(i, cliGetSettingIndex(&name[0], name.size())) << name;
+
+        for (char &c : name) {
+            c = toupper(c);
+        }
+        EXPECT_EQ(i, cliGetSettingIndex(&name[0], name.size())) << name;
+
+        // as cliSet() passes it, with the rest of the line following the name
+        std::string line = std::string(valueTable[i].name) + " = 1";
+        EXPECT_EQ(i, cliGetSettingIndex(&line[0], name.size())) << line;
+    }
+}
+
+TEST(CliSettingsUnittest, OnlyExactNamesResolve)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        std::string name = valueTable[i].name;
+
+        std::string shorter = name.substr(0, name.size() - 1);
+        EXPECT_EQ(linearGetSettingIndex(&shorter[0], shorter.size()), cliGetSettingIndex(&shorter[0], shorter.size())) << shorter;
+
+        std::string longer = name + "_x";
+        EXPECT_EQ(linearGetSettingIndex(&longer[0], longer.size()), cliGetSettingIndex(&longer[0], longer.size())) << longer;
+    }
+
+    char empty[] = "";
+    EXPECT_EQ(valueTableEntryCount, cliGetSettingIndex(empty, 0));
+    char unknown[] = "not_a_setting";
+    EXPECT_EQ(valueTableEntryCount, cliGetSettingIndex(unknown, strlen(unknown)));
+}
+
+// STUBS
+extern "C" {
+
+float motor_disarmed[MAX_SUPPORTED_MOTORS];
+
+uint16_t batteryWarningVoltage;
+uint8_t useHottAlarmSoundPeriod (void) { return 0; }
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000}; // see baudRate_e
+
+const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { "NONE" };
+const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { "NONE" };
+int32_t schedLoopStartCycles;
+int32_t taskGuardCycles;
+
+uint32_t micros(void) {return 0;}
+
+int32_t getAmperage(void) {
+    return 100;
+}
+
+uint16_t getBatteryVoltage(void) {
+    return 42;
+}
+
+batteryState_e getBatteryState(void) {
+    return BATTERY_OK;
+}
+
+uint8_t calculateBatteryPercentageRemaining(void) {
+    return 67;
+}
+
+uint8_t getMotorCount() {
+    return 4;
+}
+
+size_t getEEPROMStorageSize() {
+    return 0;
+}
+
+
+void setPrintfSerialPort(struct serialPort_s) {}
+
+static const box_t boxes[] = { { 0, "DUMMYBOX", 0 } };
+const box_t *findBoxByPermanentId(uint8_t) { return &boxes[0]; }
+const box_t *findBoxByBoxId(boxId_e) { return &boxes[0]; }
+
+uint32_t getBeeperOffMask(void) { return 0; }
+uint32_t getPreferredBeeperOffMask(void) { return 0; }
+
+void beeper(beeperMode_e) {}
+void beeperSilence(void) {}
+void beeperConfirmationBeeps(uint8_t) {}
+void beeperWarningBeeps(uint8_t) {}
+void beeperUpdate(timeUs_t) {}
+uint32_t getArmingBeepTimeMicros(void) {return 0;}
+beeperMode_e beeperModeForTableIndex(int) {return BEEPER_SILENCE;}
+uint32_t beeperModeMaskForTableIndex(int idx) {UNUSED(idx); return 0;}
+const char *beeperNameForTableIndex(int) {return NULL;}
+int beeperTableEntryCount(void) {return 0;}
+bool isBeeperOn(void) {return false;}
+void beeperOffSetAll(uint8_t) {}
+void setBeeperOffMask(uint32_t) {}
+void setPreferredBeeperOffMask(uint32_t) {}
+
+void beeperOffSet(uint32_t) {}
+void beeperOffClear(uint32_t) {}
+void beeperOffClearAll(void) {}
+bool parseColor(int, const char *) {return false; }
+bool resetEEPROM(bool) { return true; }
+void bufWriterFlush(bufWriter_t *) {}
+void mixerResetDisarmedMotors(void) {}
+void gpsEnablePassthrough(struct serialPort_s *) {}
+bool parseLedStripConfig(int, const char *){return false; }
+const char rcChannelLetters[] = "AERT12345678abcdefgh";
+
+void parseRcChannels(const char *, rxConfig_t *){}
+void mixerLoadMix(int, motorMixer_t *) {}
+bool setModeColor(ledModeIndex_e, int, int) { return false; }
+float motorConvertFromExternal(uint16_t) { return 1.0; }
+void motorShutdown(void) { }
+uint8_t getCurrentPidProfileIndex(void){ return 1; }
+uint8_t getCurrentControlRateProfileIndex(void){ return 1; }
+void changeControlRateProfile(uint8_t) {}
+void resetAllRxChannelRangeConfigurations(rxChannelRangeConfig_t *) {}
+void writeEEPROM() {}
+serialPortConfig_t *serialFindPortConfigurationMutable(serialPortIdentifier_e) {return NULL; }
+baudRate_e lookupBaudRateIndex(uint32_t){return BAUD_9600; }
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e){ return NULL; }
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) { return NULL; }
+void serialSetBaudRate(serialPort_t *, uint32_t) {}
+void serialSetMode(serialPort_t *, portMode_e) {}
+void serialPassthrough(serialPort_t *, serialPort_t *, serialConsumer *, serialConsumer *) {}
+uint32_t millis(void) { return 0; }
+uint8_t getBatteryCellCount(void) { return 1; }
+void servoMixerLoadMix(int) {}
+const char * getBatteryStateString(void){ return "_getBatteryStateString_"; }
+
+uint32_t stackTotalSize(void) { return 0x4000; }
+uint32_t stackHighMem(void) { return 0x80000000; }
+uint16_t getEEPROMConfigSize(void) { return 1024; }
+
+uint8_t __config_start = 0x00;
+uint8_t __config_end = 0x10;
+uint16_t averageSystemLoadPercent = 0;
+
+timeDelta_t getTaskDeltaTimeUs(taskId_e){ return 0; }
+uint16_t currentRxRefreshRate = 9000;
+armingDisableFlags_e getArmingDisableFlags(void) { return ARMING_DISABLED_NO_GYRO; }
+
+const char *armingDisableFlagNames[]= {
+"DUMMYDISABLEFLAGNAME"
+};
+
+void getTaskInfo(taskId_e, taskInfo_t *) {}
+void getCheckFuncInfo(cfCheckFuncInfo_t *) {}
+void schedulerResetTaskMaxExecutionTime(taskId_e) {}
+void schedulerResetCheckFunctionMaxExecutionTime(void) {}
+
+const char * const targetName = "UNITTEST";
+const char* const buildDate = "Jan 01 2017";
+const char * const buildTime = "00:00:00";
+const char * const shortGitRevision = "MASTER";
+
+uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
+uint8_t serialRead(serialPort_t *){return 0;}
+
+void bufWriterAppend(bufWriter_t *, uint8_t ch){ printf("%c", ch); }
+void serialWriteBufShim(void *, const uint8_t *, int) {}
+bufWriter_t *bufWriterInit(uint8_t *, int, bufWrite_t, void *) {return NULL;}
+void setArmingDisabled(armingDisableFlags_e) {}
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *) {}
+void systemResetToBootloader(void) {}
+void resetConfig(void) {}
+void systemReset(void) {}
+void writeUnmodifiedConfigToEEPROM(void) {}
+
+void changePidProfile(uint8_t) {}
+bool serialIsPortAvailable(serialPortIdentifier_e) { return false; }
+void generateLedConfig(ledConfig_t *, char *, size_t) {}
+bool isSerialTransmitBufferEmpty(const serialPort_t *) {return true; }
+void serialWrite(serialPort_t *, uint8_t ch) { printf("%c", ch);}
+
+void serialSetCtrlLineStateCb(serialPort_t *, void (*)(void *, uint16_t ), void *) {}
+void serialSetCtrlLineStateDtrPin(serialPort_t *, ioTag_t ) {}
+void serialSetCtrlLineState(serialPort_t *, uint16_t ) {}
+
+void serialSetBaudRateCb(serialPort_t *, void (*)(serialPort_t *context, uint32_t baud), serialPort_t *) {}
+
+char *getBoardName(void) { return NULL; }
+char *getManufacturerId(void) { return NULL; }
+bool boardInformationIsSet(void) { return true; }
+
+bool setBoardName(char *newBoardName) { UNUSED(newBoardName); return true; };
+bool setManufacturerId(char *newManufacturerId) { UNUSED(newManufacturerId); return true; };
+bool persistBoardInformation(void) { return true; };
+
+void activeAdjustmentRangeReset(void) {}
+void analyzeModeActivationConditions(void) {}
+bool isModeActivationConditionConfigured(const modeActivationCondition_t *, const modeActivationCondition_t *) { return false; }
+
+void delay(uint32_t) {}
+displayPort_t *osdGetDisplayPort(osdDisplayPortDevice_e *) { return NULL; }
+mcuTypeId_e getMcuTypeId(void) { return MCU_TYPE_UNKNOWN; }
+uint16_t getCurrentRxRefreshRate(void) { return 0; }
+uint16_t getAverageSystemLoadPercent(void) { return 0; }
+}
@@ -114,3 +114,117 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+// RPM filter sized bank: 4 motors with 3 harmonics each, 8kHz loop
+#define BANK_SECTIONS   12
+#define BANK_LOOPTIME   125
+#define BANK_Q          5.0f
+
+static float bankTestSample(int axis, int n)
+{
+    // mix of motor noise and stick input, different per axis
+    return 200.0f * sinf(0.05f * n * (axis + 1)) + 50.0f * sinf(0.9f * n + axis) + 10.0f * axis;
+}
+
+static void bankTestUpdate(biquadBankSection_t *sections, biquadBankSection_t *referenceSections, biquadFilter_t notch[3][BANK_SECTIONS], int n)
+{
+    for (int i = 0; i < BANK_SECTIONS; i++) {
+        const float frequency = 150.0f + 40.0f * i + 0.01f * n;
+        const float weight = (i % 3) ? 1.0f : 0.5f;
+        biquadBankSectionUpdate(&sections[i], frequency, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, weight);
+        if (referenceSections) {
+            biquadBankSectionUpdate(&referenceSections[i], frequency, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, weight);
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            biquadFilterUpdate(&notch[axis][i], frequency, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, weight);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadBankMatchesBiquadFilter)
+{
+    biquadBankSection_t sections[BANK_SECTIONS];
+    biquadBankSection_t referenceSections[BANK_SECTIONS];
+    biquadFilter_t notch[3][BANK_SECTIONS];
+    biquadBank_t bank;
+    biquadBank_t referenceBank;
+
+    for (int i = 0; i < BANK_SECTIONS; i++) {
+        biquadBankSectionInit(&sections[i], 100.0f, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, 0.0f);
+        biquadBankSectionInit(&referenceSections[i], 100.0f, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, 0.0f);
+        for (int axis = 0; axis < 3; axis++) {
+            biquadFilterInit(&notch[axis][i], 100.0f, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, 0.0f);
+        }
+    }
+    biquadBankInit(&bank, sections, BANK_SECTIONS);
+    biquadBankInit(&referenceBank, referenceSections, BANK_SECTIONS);
+
+    for (int n = 0; n < 2000; n++) {
+        if (n % 8 == 0) {
+            // moving notches, as done by the RPM filter
+            bankTestUpdate(sections, referenceSections, notch, n);
+        }
+
+        float xyz[3];
+        float referenceXyz[3];
+        float expected[3];
+        for (int axis = 0; axis < 3; axis++) {
+            xyz[axis] = referenceXyz[axis] = expected[axis] = bankTestSample(axis, n);
+            for (int i = 0; i < BANK_SECTIONS; i++) {
+                expected[axis] = biquadFilterApplyDF1Weighted(&notch[axis][i], expected[axis]);
+            }
+        }
+
+        biquadBankApplyDF1Weighted(&bank, xyz);
+        biquadBankApplyDF1WeightedReference(&referenceBank, referenceXyz);
+
+        for (int axis = 0; axis < 3; axis++) {
+            EXPECT_FLOAT_EQ(expected[axis], referenceXyz[axis]);
+            EXPECT_FLOAT_EQ(expected[axis], xyz[axis]);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadNotchTableMatchesBiquadFilterUpdate)
+{
+    biquadNotchTable_t table;
+    const float minHz = 100.0f;
+    const float maxHz = 0.48f * 1e6f / BANK_LOOPTIME;
+    biquadNotchTableInit(&table, minHz, maxHz, BANK_LOOPTIME, BANK_Q);
+
+    float maxError = 0.0f;
+    float maxCenterErrorHz = 0.0f;
+    for (float frequency = minHz; frequency <= maxHz; frequency += 0.7f) {
+        biquadFilter_t expected;
+        biquadFilterUpdate(&expected, frequency, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, 1.0f);
+
+        biquadNotchCoeffs_t coeffs;
+        biquadNotchTableLookup(&table, frequency, &coeffs);
+
+        maxError = fmaxf(maxError, fabsf(coeffs.b0 - expected.b0));
+        maxError = fmaxf(maxError, fabsf(coeffs.b1 - expected.b1));
+        maxError = fmaxf(maxError, fabsf(coeffs.a2 - expected.a2));
+
+        // the notch sits where b0 + b1 * cos(omega) + b2 * cos(2 * omega) has its zero, i.e. cos(omega) = -b1 / (2 * b0)
+        const float centerHz = acosf(-coeffs.b1 / (2.0f * coeffs.b0)) / (2.0f * M_PI * BANK_LOOPTIME * 1e-6f);
+        const float expectedCenterHz = acosf(-expected.b1 / (2.0f * expected.b0)) / (2.0f * M_PI * BANK_LOOPTIME * 1e-6f);
+        maxCenterErrorHz = fmaxf(maxCenterErrorHz, fabsf(centerHz - expectedCenterHz));
+    }
+    EXPECT_LT(maxError, 1e-3f);
+    EXPECT_LT(maxCenterErrorHz, 1.0f);
+
+    // grid points are exact and frequencies are clamped to the table range
+    biquadFilter_t expected;
+    biquadNotchCoeffs_t coeffs;
+    biquadFilterUpdate(&expected, minHz, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, 1.0f);
+    biquadNotchTableLookup(&table, minHz - 50.0f, &coeffs);
+    EXPECT_FLOAT_EQ(expected.b0, coeffs.b0);
+    EXPECT_FLOAT_EQ(expected.b1, coeffs.b1);
+    EXPECT_FLOAT_EQ(expected.a2, coeffs.a2);
+
+    biquadFilterUpdate(&expected, maxHz, BANK_LOOPTIME, BANK_Q, FILTER_NOTCH, 1.0f);
+    biquadNotchTableLookup(&table, maxHz + 500.0f, &coeffs);
+    EXPECT_NEAR(expected.b0, coeffs.b0, 1e-5f);
+    EXPECT_NEAR(expected.b1, coeffs.b1, 1e-5f);
+    EXPECT_NEAR(expected.a2, coeffs.a2, 1e-5f);
+}
@@ -0,0 +1,128 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern "C" {
+    #include "common/histogram.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(HistogramUnittest, BucketBounds)
+{
+    // every value lands in a bucket whose upper bound is at least the value and within 1/8 of it
+    int previousBucket = 0;
+    for (uint32_t value = 0; value <= HISTOGRAM_MAX_VALUE; value++) {
+        const int bucket = histogramBucket(value);
+        ASSERT_GE(bucket, previousBucket);
+        ASSERT_LE(bucket, previousBucket + 1);
+        ASSERT_LT(bucket, HISTOGRAM_BUCKET_COUNT);
+        const uint32_t upperBound = histogramBucketUpperBound(bucket);
+        ASSERT_GE(upperBound, value);
+        ASSERT_LE(upperBound - value, value / HISTOGRAM_SUB_BUCKETS);
+        previousBucket = bucket;
+    }
+    EXPECT_EQ(HISTOGRAM_BUCKET_COUNT - 1, previousBucket);
+    EXPECT_EQ((uint32_t)HISTOGRAM_MAX_VALUE, histogramBucketUpperBound(HISTOGRAM_BUCKET_COUNT - 1));
+
+    // out of range values are counted in the last bucket
+    EXPECT_EQ(HISTOGRAM_BUCKET_COUNT - 1, histogramBucket(HISTOGRAM_MAX_VALUE + 1));
+    EXPECT_EQ(HISTOGRAM_BUCKET_COUNT - 1, histogramBucket(UINT32_MAX));
+}
+
+TEST(HistogramUnittest, Percentiles)
+{
+    histogram_t histogram;
+    histogramReset(&histogram);
+
+    EXPECT_EQ(0u, histogramPercentile(&histogram, 50));
+    EXPECT_EQ(0u, histogramMean(&histogram));
+
+    // 1..100, exact in the linear range, within a bucket above it
+    for (uint32_t value = 1; value <= 100; value++) {
+        histogramAdd(&histogram, value);
+    }
+    EXPECT_EQ(100u, histogram.count);
+    EXPECT_EQ(100u, histogram.max);
+    EXPECT_EQ(50u, histogramMean(&histogram));
+    EXPECT_EQ(10u, histogramPercentile(&histogram, 10));
+    EXPECT_GE(histogramPercentile(&histogram, 50), 50u);
+    EXPECT_LE(histogramPercentile(&histogram, 50), 50u + 50 / HISTOGRAM_SUB_BUCKETS);
+    EXPECT_GE(histogramPercentile(&histogram, 99), 99u);
+    EXPECT_EQ(100u, histogramPercentile(&histogram, 100));
+
+    // a single outlier moves max but not the median
+    histogramAdd(&histogram, 100000);
+    EXPECT_EQ(100000u, histogram.max);
+    EXPECT_EQ(100000u, histogramPercentile(&histogram, 100));
+    EXPECT_LE(histogramPercentile(&histogram, 50), 60u);
+
+    histogramReset(&histogram);
+    EXPECT_EQ(0u, histogram.count);
+    EXPECT_EQ(0u, histogram.max);
+}
+
+TEST(HistogramUnittest, Permille)
+{
+    histogram_t histogram;
+    histogramReset(&histogram);
+
+    // 999 fast samples and one slow one, only p99.9 and above see the tail
+    for (int ii = 0; ii < 999; ii++) {
+        histogramAdd(&histogram, 10);
+    }
+    histogramAdd(&histogram, 1000);
+    EXPECT_EQ(10u, histogramPermille(&histogram, 990));
+    EXPECT_EQ(10u, histogramPermille(&histogram, 999));
+    EXPECT_EQ(1000u, histogramPermille(&histogram, 1000));
+
+    histogramAdd(&histogram, 1000);
+    EXPECT_GE(histogramPermille(&histogram, 999), 1000u);
+    EXPECT_EQ(histogramPercentile(&histogram, 99), histogramPermille(&histogram, 990));
+}
+
+TEST(HistogramUnittest, CompactHalvesWhenFull)
+{
+    histogramCompact_t histogram;
+    histogramCompactReset(&histogram);
+
+    EXPECT_EQ(0u, histogramCompactPermille(&histogram, 500));
+
+    histogramCompactAdd(&histogram, 2000);
+    for (int ii = 0; ii < UINT16_MAX; ii++) {
+        histogramCompactAdd(&histogram, 12);
+    }
+    EXPECT_EQ((uint32_t)UINT16_MAX + 1, histogram.count);
+    EXPECT_EQ(UINT16_MAX, histogram.buckets[histogramBucket(12)]);
+
+    // the next sample halves the counts, keeping the rare outlier
+    histogramCompactAdd(&histogram, 12);
+    EXPECT_EQ(UINT16_MAX / 2 + 2, histogram.buckets[histogramBucket(12)]);
+    EXPECT_EQ(1, histogram.buckets[histogramBucket(2000)]);
+    EXPECT_EQ((uint32_t)UINT16_MAX / 2 + 3, histogram.count);
+    EXPECT_EQ(2000u, histogram.max);
+
+    EXPECT_EQ(12u, histogramCompactPermille(&histogram, 500));
+    EXPECT_EQ(12u, histogramCompactPermille(&histogram, 999));
+    EXPECT_EQ(2000u, histogramCompactPermille(&histogram, 1000));
+}
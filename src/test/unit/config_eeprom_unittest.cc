@@ -0,0 +1,412 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "config/config_eeprom.h"
+
+    #include "drivers/system.h"
+
+    #include "pg/pg.h"
+
+// Parameter groups with the sizes of some of the bigger ones in a full build, and a few small ones
+#define TEST_PG(_pgn, _size) \
+    typedef struct { uint8_t data[_size]; } testPg ## _pgn ## _t; \
+    PG_DECLARE(testPg ## _pgn ## _t, testPg ## _pgn); \
+    PG_REGISTER(testPg ## _pgn ## _t, testPg ## _pgn, _pgn, 0)
+
+    TEST_PG(1, 444);     // PID profiles
+    TEST_PG(2, 320);     // mode activation conditions
+    TEST_PG(3, 300);     // adjustment ranges
+    TEST_PG(4, 228);     // rate profiles
+    TEST_PG(5, 128);
+    TEST_PG(6, 112);
+    TEST_PG(7, 100);
+    TEST_PG(8, 96);
+    TEST_PG(9, 64);
+    TEST_PG(10, 60);
+    TEST_PG(11, 56);
+    TEST_PG(12, 36);
+    TEST_PG(13, 32);
+    TEST_PG(14, 24);
+    TEST_PG(15, 20);
+    TEST_PG(16, 16);
+    TEST_PG(17, 12);
+    TEST_PG(18, 8);
+    TEST_PG(19, 6);
+    TEST_PG(20, 3);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * Flash timings of the STM32F405, which keeps its config in a 16K sector: typical sector erase and word program times
+ * from the datasheet, for 32 bit parallelism.
+ */
+#define SECTOR_ERASE_US     250000
+#define WORD_PROGRAM_US     16
+
+// The flash that the config is kept in, as emulated on SITL, with erase and program counts
+static struct {
+    bool unlocked;
+    int erases;
+    int programs;
+    int overwrites;         // Programs of words that were not erased
+    int programsUntilPowerFails;
+} flash;
+
+static bool failed;
+
+static void flashReset(void)
+{
+    // A new SITL eeprom.bin
+    memset(eepromData, 0, sizeof(eepromData));
+
+    memset(&flash, 0, sizeof(flash));
+    flash.programsUntilPowerFails = -1;
+    failed = false;
+}
+
+static uint32_t flashTimeUs(int erases, int programs)
+{
+    return erases * SECTOR_ERASE_US + programs * WORD_PROGRAM_US;
+}
+
+extern "C" {
+
+void FLASH_Unlock(void)
+{
+    flash.unlocked = true;
+}
+
+void FLASH_Lock(void)
+{
+    flash.unlocked = false;
+}
+
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address)
+{
+    EXPECT_TRUE(flash.unlocked);
+    EXPECT_EQ(0u, Page_Address % FLASH_PAGE_SIZE);
+    EXPECT_GE(Page_Address, (uintptr_t)eepromData);
+    EXPECT_LE(Page_Address + FLASH_PAGE_SIZE, (uintptr_t)ARRAYEND(eepromData));
+
+    memset((void *)Page_Address, 0xFF, FLASH_PAGE_SIZE);
+    flash.erases++;
+
+    return FLASH_COMPLETE;
+}
+
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data)
+{
+    EXPECT_TRUE(flash.unlocked);
+    EXPECT_GE(addr, (uintptr_t)eepromData);
+    EXPECT_LT(addr, (uintptr_t)ARRAYEND(eepromData));
+
+    if (flash.programsUntilPowerFails == 0) {
+        // The power has gone, nothing more is written
+        return FLASH_COMPLETE;
+    }
+    if (flash.programsUntilPowerFails > 0) {
+        flash.programsUntilPowerFails--;
+    }
+
+    uint32_t *word = (uint32_t *)addr;
+    if (*word != 0xFFFFFFFF) {
+        flash.overwrites++;
+    }
+    // Programming can only clear bits
+    *word &= Data;
+    flash.programs++;
+
+    return FLASH_COMPLETE;
+}
+
+void failureMode(failureMode_e mode)
+{
+    UNUSED(mode);
+    failed = true;
+}
+
+}
+
+// Give every PG a pattern that depends on the seed
+static void fillPgs(uint8_t seed)
+{
+    PG_FOREACH(reg) {
+        for (int i = 0; i < pgSize(reg); i++) {
+            reg->address[i] = seed + pgN(reg) * 31 + i;
+        }
+    }
+}
+
+static void expectPgsMatch(uint8_t seed)
+{
+    PG_FOREACH(reg) {
+        int mismatches = 0;
+        for (int i = 0; i < pgSize(reg); i++) {
+            if (reg->address[i] != (uint8_t)(seed + pgN(reg) * 31 + i)) {
+                mismatches++;
+            }
+        }
+        EXPECT_EQ(0, mismatches) << "PG " << pgN(reg);
+    }
+}
+
+// Reboot: forget the PGs in RAM and load them again from the EEPROM
+static void reloadPgs(void)
+{
+    PG_FOREACH(reg) {
+        memset(reg->address, 0, pgSize(reg));
+    }
+
+    ASSERT_TRUE(isEEPROMVersionValid());
+    ASSERT_TRUE(isEEPROMStructureValid());
+    EXPECT_TRUE(loadEEPROM());
+}
+
+static size_t fullConfigSize(void)
+{
+    // Header, records, footer and CRC
+    size_t size = 2 + 2 + 2;
+    PG_FOREACH(reg) {
+        size += 6 + pgSize(reg);
+    }
+    return size;
+}
+
+TEST(ConfigEepromTest, SaveAndLoad)
+{
+    flashReset();
+    EXPECT_FALSE(isEEPROMStructureValid());
+
+    fillPgs(1);
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failed);
+
+    // The first save writes out everything
+    EXPECT_EQ(1, flash.erases);
+    EXPECT_EQ((int)((fullConfigSize() + 3) / 4), flash.programs);
+    EXPECT_EQ(0, flash.overwrites);
+
+    reloadPgs();
+    expectPgsMatch(1);
+    EXPECT_EQ((fullConfigSize() + 3) / 4 * 4, getEEPROMConfigSize());
+}
+
+TEST(ConfigEepromTest, ChangesAreAppended)
+{
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+    const size_t fullSize = getEEPROMConfigSize();
+
+    // Change one byte of a PG
+    const pgRegistry_t *rateProfiles = pgFind(4);
+    rateProfiles->address[10] ^= 0x55;
+    const uint8_t changed = rateProfiles->address[10];
+
+    flash.erases = 0;
+    flash.programs = 0;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failed);
+
+    // Only the changed PG is written, after the last save, without an erase
+    EXPECT_EQ(0, flash.erases);
+    EXPECT_EQ((2 + 6 + 228 + 2 + 2) / 4, flash.programs);
+    EXPECT_EQ(0, flash.overwrites);
+    EXPECT_EQ(fullSize + 240, getEEPROMConfigSize());
+
+    reloadPgs();
+    EXPECT_EQ(changed, rateProfiles->address[10]);
+    rateProfiles->address[10] ^= 0x55;
+    expectPgsMatch(1);
+}
+
+TEST(ConfigEepromTest, UnchangedConfigIsNotWritten)
+{
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+
+    flash.erases = 0;
+    flash.programs = 0;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failed);
+
+    EXPECT_EQ(0, flash.erases);
+    EXPECT_EQ(0, flash.programs);
+}
+
+TEST(ConfigEepromTest, NewestChangeWins)
+{
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+
+    const pgRegistry_t *small = pgFind(17);
+    for (int i = 0; i < 10; i++) {
+        small->address[0] = 100 + i;
+        writeConfigToEEPROM();
+    }
+    EXPECT_EQ(1, flash.erases);
+
+    reloadPgs();
+    EXPECT_EQ(109, small->address[0]);
+}
+
+TEST(ConfigEepromTest, FullConfigIsRewrittenWhenOutOfRoom)
+{
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+    const size_t fullSize = getEEPROMConfigSize();
+
+    // Keep changing the PID profiles until they no longer fit
+    const pgRegistry_t *pidProfiles = pgFind(1);
+    int saves = 0;
+    while (flash.erases == 1) {
+        pidProfiles->address[0]++;
+        writeConfigToEEPROM();
+        saves++;
+        EXPECT_FALSE(failed);
+    }
+
+    const int pidProfilesBlockSize = 2 + 6 + 444 + 2 + 2;
+    EXPECT_EQ((int)((EEPROM_SIZE - fullSize) / pidProfilesBlockSize + 1), saves);
+    EXPECT_EQ(2, flash.erases);
+    EXPECT_EQ(0, flash.overwrites);
+
+    // The rewrite holds the newest copy of each PG
+    EXPECT_EQ(fullSize, getEEPROMConfigSize());
+    const uint8_t newest = pidProfiles->address[0];
+    reloadPgs();
+    EXPECT_EQ(newest, pidProfiles->address[0]);
+
+    // and changes can be appended to it again
+    pidProfiles->address[0]++;
+    writeConfigToEEPROM();
+    EXPECT_EQ(2, flash.erases);
+    EXPECT_EQ(0, flash.overwrites);
+}
+
+TEST(ConfigEepromTest, PartlyWrittenChangesAreIgnored)
+{
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+
+    const pgRegistry_t *rateProfiles = pgFind(4);
+    rateProfiles->address[0] = 0xAA;
+    writeConfigToEEPROM();
+
+    // The power fails part way through the next save
+    rateProfiles->address[0] = 0xBB;
+    flash.programsUntilPowerFails = 20;
+    writeConfigToEEPROM();
+    flash.programsUntilPowerFails = -1;
+
+    // On the next boot the last complete save is loaded
+    reloadPgs();
+    EXPECT_EQ(0xAA, rateProfiles->address[0]);
+
+    // The next save can't go over the partly written block, so it rewrites the config
+    const int erasesBefore = flash.erases;
+    const int overwritesBefore = flash.overwrites;
+    rateProfiles->address[0] = 0xCC;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(erasesBefore + 1, flash.erases);
+    EXPECT_EQ(overwritesBefore, flash.overwrites);
+
+    reloadPgs();
+    EXPECT_EQ(0xCC, rateProfiles->address[0]);
+}
+
+TEST(ConfigEepromTest, ChangedPgVersionIsSaved)
+{
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+
+    // Load the config into a firmware where a PG has a new version, which resets the PG
+    pgRegistry_t *reg = (pgRegistry_t *)pgFind(9);
+    const pgn_t pgn = reg->pgn;
+    reg->pgn = pgN(reg) | (1 << 12);
+    ASSERT_TRUE(isEEPROMStructureValid());
+    EXPECT_FALSE(loadEEPROM());
+    for (int i = 0; i < pgSize(reg); i++) {
+        EXPECT_EQ(0, reg->address[i]);
+    }
+
+    // The reset PG is saved even though it is all zero, as the saved copy is for the old version
+    flash.programs = 0;
+    writeConfigToEEPROM();
+    EXPECT_EQ((2 + 6 + 64 + 2 + 2) / 4, flash.programs);
+
+    reloadPgs();
+    EXPECT_EQ(0, reg->address[5]);
+
+    reg->pgn = pgn;
+}
+
+/*
+ * Save the config after tuning a parameter at a time, as with in-field adjustments or the OSD menus, counting the
+ * sector erases and estimating the time the flash takes for each save.
+ */
+TEST(ConfigEepromTest, SaveWearAndLatency)
+{
+    const int saves = 200;
+    const pgn_t tuned[] = { 1, 4, 1, 17, 1, 4, 3, 1 };
+
+    flashReset();
+    fillPgs(1);
+    writeConfigToEEPROM();
+    const int fullSavePrograms = flash.programs;
+
+    flash.erases = 0;
+    flash.programs = 0;
+
+    for (int i = 0; i < saves; i++) {
+        const pgRegistry_t *reg = pgFind(tuned[i % ARRAYLEN(tuned)]);
+        reg->address[i % pgSize(reg)]++;
+
+        writeConfigToEEPROM();
+        EXPECT_FALSE(failed);
+    }
+
+    const uint32_t averageSaveUs = flashTimeUs(flash.erases, flash.programs) / saves;
+    const uint32_t fullSaveUs = flashTimeUs(1, fullSavePrograms);
+
+    EXPECT_EQ(0, flash.overwrites);
+    EXPECT_LE(flash.erases, saves / 20);
+    EXPECT_LT(averageSaveUs, fullSaveUs / 10);
+
+    reloadPgs();
+}
@@ -0,0 +1,299 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "msc/emfat.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * These tests read the emulated volume back the way a host would, as a block device, and check the FAT, directory and
+ * files they find through it against the logs it was made from.
+ */
+
+#define SECTOR_SIZE 512
+#define LOG_COUNT 100
+#define MAX_ENTRIES (LOG_COUNT + 4)
+
+static std::vector<uint8_t> flash;
+static int readCallCount;
+
+static void flashReadProc(uint8_t *dest, int size, uint32_t offset, emfat_entry_t *entry)
+{
+    UNUSED(entry);
+
+    readCallCount++;
+    for (int i = 0; i < size; i++) {
+        dest[i] = offset + i < flash.size() ? flash[offset + i] : 0xFF;
+    }
+}
+
+static emfat_t emfat;
+static emfat_entry_t entries[MAX_ENTRIES];
+static char logNames[LOG_COUNT][24];
+
+// A volume like the one emfat_init_files() makes, with logs of different lengths starting on flash blocks
+static void initVolume(int logCount)
+{
+    std::mt19937 rng(1);
+
+    memset(entries, 0, sizeof(entries));
+    flash.clear();
+
+    entries[0].name = "";
+    entries[0].dir = true;
+
+    for (int i = 0; i < logCount; i++) {
+        const uint32_t size = 2048 * (1 + rng() % 40) - rng() % 2048;
+        const uint32_t offset = flash.size();
+
+        for (uint32_t j = 0; j < size; j++) {
+            flash.push_back(rng());
+        }
+        flash.resize((flash.size() + 2047) & ~2047, 0xFF);
+
+        emfat_entry_t *entry = &entries[1 + i];
+        snprintf(logNames[i], sizeof(logNames[i]), "BTFL_%03d.BBL", i + 1);
+        entry->name = logNames[i];
+        entry->level = 1;
+        entry->offset = offset;
+        entry->curr_size = size;
+        entry->max_size = size;
+        entry->readcb = flashReadProc;
+    }
+
+    emfat_entry_t *all = &entries[1 + logCount];
+    all->name = "BTFL_ALL.BBL";
+    all->level = 1;
+    all->curr_size = flash.size();
+    all->max_size = flash.size();
+    all->readcb = flashReadProc;
+
+    emfat_entry_t *padding = &entries[2 + logCount];
+    padding->name = "PADDING.TXT";
+    padding->attr = ATTR_HIDDEN;
+    padding->level = 1;
+    padding->curr_size = 64 * 1024 * 1024 - flash.size() * 2;
+    padding->max_size = padding->curr_size;
+
+    ASSERT_TRUE(emfat_init(&emfat, "BETAFLT", entries));
+}
+
+static std::vector<uint8_t> readSectors(uint32_t sector, int count)
+{
+    std::vector<uint8_t> data(count * SECTOR_SIZE);
+    emfat_read(&emfat, data.data(), sector, count);
+    return data;
+}
+
+static uint32_t u16At(const std::vector<uint8_t> &data, int offset)
+{
+    return data[offset] | data[offset + 1] << 8;
+}
+
+static uint32_t u32At(const std::vector<uint8_t> &data, int offset)
+{
+    return u16At(data, offset) | u16At(data, offset + 2) << 16;
+}
+
+typedef struct {
+    std::string name;
+    uint8_t attr;
+    uint32_t cluster;
+    uint32_t size;
+} dirEntry_t;
+
+// What a host sees when it mounts the volume
+class HostView {
+public:
+    uint32_t partitionLba;
+    uint32_t sectorsPerCluster;
+    uint32_t fatLba;
+    uint32_t sectorsPerFat;
+    uint32_t dataLba;
+    uint32_t rootCluster;
+    std::vector<uint32_t> fat;
+
+    void mount()
+    {
+        const std::vector<uint8_t> mbr = readSectors(0, 1);
+        ASSERT_EQ(0x55, mbr[510]);
+        ASSERT_EQ(0xAA, mbr[511]);
+        partitionLba = u32At(mbr, 446 + 8);
+
+        const std::vector<uint8_t> boot = readSectors(partitionLba, 1);
+        ASSERT_EQ(SECTOR_SIZE, u16At(boot, 11));
+        ASSERT_EQ(0, memcmp(&boot[82], "FAT32   ", 8));
+        sectorsPerCluster = boot[13];
+        fatLba = partitionLba + u16At(boot, 14);
+        sectorsPerFat = u32At(boot, 36);
+        dataLba = fatLba + boot[16] * sectorsPerFat;
+        rootCluster = u32At(boot, 44);
+
+        const std::vector<uint8_t> fatData = readSectors(fatLba, sectorsPerFat);
+        fat.resize(fatData.size() / 4);
+        for (size_t i = 0; i < fat.size(); i++) {
+            fat[i] = u32At(fatData, i * 4);
+        }
+
+        // Both copies of the FAT are the same
+        EXPECT_EQ(fatData, readSectors(fatLba + sectorsPerFat, sectorsPerFat));
+    }
+
+    std::vector<uint32_t> chain(uint32_t cluster)
+    {
+        std::vector<uint32_t> clusters;
+        while (cluster >= 2 && cluster < 0x0FFFFFF8 && clusters.size() <= fat.size()) {
+            clusters.push_back(cluster);
+            cluster = fat[cluster];
+        }
+        EXPECT_EQ(0x0FFFFFFFu, cluster);
+        return clusters;
+    }
+
+    std::vector<uint8_t> readChain(uint32_t cluster)
+    {
+        std::vector<uint8_t> data;
+        for (uint32_t c : chain(cluster)) {
+            const std::vector<uint8_t> clusterData = readSectors(dataLba + (c - 2) * sectorsPerCluster, sectorsPerCluster);
+            data.insert(data.end(), clusterData.begin(), clusterData.end());
+        }
+        return data;
+    }
+
+    std::vector<dirEntry_t> listRoot()
+    {
+        const std::vector<uint8_t> dir = readChain(rootCluster);
+        std::vector<dirEntry_t> list;
+        for (size_t offset = 0; offset < dir.size() && dir[offset]; offset += 32) {
+            dirEntry_t entry;
+            std::string name((const char *)&dir[offset], 8);
+            std::string extn((const char *)&dir[offset + 8], 3);
+            name.erase(name.find_last_not_of(' ') + 1);
+            extn.erase(extn.find_last_not_of(' ') + 1);
+            entry.name = extn.empty() ? name : name + "." + extn;
+            entry.attr = dir[offset + 11];
+            entry.cluster = u16At(dir, offset + 26) | u16At(dir, offset + 20) << 16;
+            entry.size = u32At(dir, offset + 28);
+            list.push_back(entry);
+        }
+        return list;
+    }
+};
+
+TEST(EmfatTest, HostSeesEveryLog)
+{
+    initVolume(LOG_COUNT);
+
+    HostView host;
+    host.mount();
+
+    const std::vector<dirEntry_t> list = host.listRoot();
+    ASSERT_EQ(1u + LOG_COUNT + 2, list.size());
+    EXPECT_EQ(ATTR_VOL_LABEL, list[0].attr);
+
+    for (int i = 0; i < LOG_COUNT + 1; i++) {
+        const emfat_entry_t *entry = &entries[1 + i];
+        const dirEntry_t &dirEntry = list[1 + i];
+
+        EXPECT_EQ(entry->name, dirEntry.name);
+        ASSERT_EQ(entry->curr_size, dirEntry.size);
+
+        std::vector<uint8_t> data = host.readChain(dirEntry.cluster);
+        ASSERT_EQ((entry->curr_size + 4095) / 4096 * 4096, data.size());
+        data.resize(entry->curr_size);
+
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), flash.begin() + entry->offset)) << entry->name;
+    }
+
+    EXPECT_EQ("PADDING.TXT", list[LOG_COUNT + 2].name);
+    EXPECT_EQ(entries[LOG_COUNT + 2].curr_size, list[LOG_COUNT + 2].size);
+}
+
+TEST(EmfatTest, SectorsReadTheSameInAnyOrder)
+{
+    initVolume(LOG_COUNT);
+
+    HostView host;
+    host.mount();
+
+    // Everything but the padding, which is most of the volume and all zeros
+    const uint32_t sectorCount = host.dataLba + (entries[LOG_COUNT + 2].priv.first_clust - 2) * host.sectorsPerCluster;
+
+    std::vector<std::vector<uint8_t>> sequential;
+    for (uint32_t sector = 0; sector < sectorCount; sector++) {
+        sequential.push_back(readSectors(sector, 1));
+    }
+
+    std::vector<uint32_t> order(sectorCount);
+    for (uint32_t i = 0; i < sectorCount; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(2));
+
+    for (uint32_t sector : order) {
+        ASSERT_EQ(sequential[sector], readSectors(sector, 1)) << "sector " << sector;
+    }
+
+    // And in multi-sector requests, which may span entries and regions of the volume
+    for (uint32_t sector = 0; sector < sectorCount; sector += 5) {
+        const int count = std::min<uint32_t>(8, sectorCount - sector);
+        const std::vector<uint8_t> data = readSectors(sector, count);
+        for (int i = 0; i < count; i++) {
+            ASSERT_TRUE(std::equal(sequential[sector + i].begin(), sequential[sector + i].end(), data.begin() + i * SECTOR_SIZE)) << "sector " << sector + i;
+        }
+    }
+}
+
+TEST(EmfatTest, MultiSectorReadsOfAFileReadTheFlashOnce)
+{
+    initVolume(LOG_COUNT);
+
+    HostView host;
+    host.mount();
+
+    const std::vector<dirEntry_t> list = host.listRoot();
+    const uint32_t firstSector = host.dataLba + (list[1].cluster - 2) * host.sectorsPerCluster;
+
+    readCallCount = 0;
+    const std::vector<uint8_t> data = readSectors(firstSector, 8);
+    EXPECT_EQ(1, readCallCount);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), flash.begin() + entries[1].offset));
+
+    // A request that runs into the next file is split between them
+    const uint32_t lastSector = host.dataLba + (entries[1].priv.last_reserved - 2 + 1) * host.sectorsPerCluster - 4;
+    readCallCount = 0;
+    readSectors(lastSector, 8);
+    EXPECT_EQ(2, readCallCount);
+}
@@ -0,0 +1,675 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/flash.h"
+
+    #include "io/flashfs.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * Timings of a flash chip, typical figures from the datasheets. Programming n bytes of a page takes
+ * pageProgramFirstByteUs + (n - 1) * pageProgramByteUs once they have been clocked in over SPI. NAND flash has to load
+ * a page into its cache before it can be read, which takes pageReadUs.
+ */
+typedef struct flashTimings_s {
+    const char *name;
+    int spiClockMHz;
+    double pageProgramFirstByteUs;
+    double pageProgramByteUs;
+    double sectorEraseUs;
+    double pageReadUs;
+} flashTimings_t;
+
+static const flashTimings_t m25p16Timings = { "M25P16", 25, 40, 2.35, 600000, 0 };
+static const flashTimings_t w25q128Timings = { "W25Q128", 104, 30, 2.5, 150000, 0 };
+static const flashTimings_t w25n01gTimings = { "W25N01G", 50, 250, 0, 2000, 25 };
+
+// Reading the status register to see if the flash is ready takes a couple of bytes on the bus
+#define FLASH_STATUS_POLL_US 1
+
+#define FLASH_PAGE_SIZE 256
+#define FLASH_PAGES_PER_SECTOR 256
+#define FLASH_SECTORS 32
+
+// The W25N01G has 1024 blocks of 64 2kB pages
+#define NAND_PAGE_SIZE 2048
+#define NAND_PAGES_PER_BLOCK 64
+#define NAND_BLOCKS 1024
+
+// A simulated flash chip, which keeps time in microseconds and is busy while it programs or erases
+static struct {
+    const flashTimings_t *timings;
+    flashGeometry_t geometry;
+    flashPartition_t partition;
+    std::vector<uint8_t> memory;
+
+    double timeUs;
+    double busyUntilUs;
+
+    uint32_t programAddress;
+    void (*programCallback)(uint32_t length);
+    bool holdPrograms;          // don't report programs as transferred until flashSimReleaseProgram()
+    uint32_t heldProgramBytes;
+
+    int programs;
+    int fullPagePrograms;
+    int pageCrossings;
+    int reads;
+} flash;
+
+static void flashSimInitGeometry(const flashTimings_t *timings, flashType_e flashType, uint16_t pageSize, uint32_t pagesPerSector, uint32_t sectors)
+{
+    flash.timings = timings;
+    flash.geometry.sectors = sectors;
+    flash.geometry.pageSize = pageSize;
+    flash.geometry.pagesPerSector = pagesPerSector;
+    flash.geometry.sectorSize = pageSize * pagesPerSector;
+    flash.geometry.totalSize = flash.geometry.sectorSize * sectors;
+    flash.geometry.flashType = flashType;
+
+    flash.partition.type = FLASH_PARTITION_TYPE_FLASHFS;
+    flash.partition.startSector = 0;
+    flash.partition.endSector = sectors - 1;
+
+    flash.memory.assign(flash.geometry.totalSize, 0xFF);
+
+    flash.timeUs = 0;
+    flash.busyUntilUs = 0;
+    flash.holdPrograms = false;
+    flash.heldProgramBytes = 0;
+    flash.programs = 0;
+    flash.fullPagePrograms = 0;
+    flash.pageCrossings = 0;
+    flash.reads = 0;
+}
+
+static void flashSimInit(const flashTimings_t *timings)
+{
+    flashSimInitGeometry(timings, FLASH_TYPE_NOR, FLASH_PAGE_SIZE, FLASH_PAGES_PER_SECTOR, FLASH_SECTORS);
+}
+
+static void flashSimInitNand(void)
+{
+    flashSimInitGeometry(&w25n01gTimings, FLASH_TYPE_NAND, NAND_PAGE_SIZE, NAND_PAGES_PER_BLOCK, NAND_BLOCKS);
+}
+
+// Start the clock again, as if the board had just been powered up
+static void flashSimPowerCycle(void)
+{
+    flash.timeUs = 0;
+    flash.busyUntilUs = 0;
+    flash.reads = 0;
+}
+
+static double flashTransferUs(uint32_t bytes)
+{
+    return bytes * 8.0 / flash.timings->spiClockMHz;
+}
+
+extern "C" {
+
+bool flashIsReady(void)
+{
+    flash.timeUs += FLASH_STATUS_POLL_US;
+    return flash.timeUs >= flash.busyUntilUs;
+}
+
+bool flashWaitForReady(void)
+{
+    while (!flashIsReady());
+    return true;
+}
+
+void flashEraseSector(uint32_t address)
+{
+    flashWaitForReady();
+
+    const uint32_t sectorStart = address - address % flash.geometry.sectorSize;
+    memset(&flash.memory[sectorStart], 0xFF, flash.geometry.sectorSize);
+    flash.busyUntilUs = flash.timeUs + flashTransferUs(4) + flash.timings->sectorEraseUs;
+}
+
+void flashEraseCompletely(void)
+{
+    for (uint32_t sector = 0; sector < flash.geometry.sectors; sector++) {
+        flashEraseSector(sector * flash.geometry.sectorSize);
+    }
+}
+
+void flashPageProgramBegin(uint32_t address, void (*callback)(uint32_t length))
+{
+    flash.programAddress = address;
+    flash.programCallback = callback;
+}
+
+uint32_t flashPageProgramContinue(const uint8_t **buffers, uint32_t *bufferSizes, uint32_t bufferCount)
+{
+    EXPECT_TRUE(flashIsReady());
+
+    // The real driver clips the program to the end of the page, since the flash would wrap around within the page
+    uint32_t bytes = 0;
+    for (uint32_t i = 0; i < bufferCount; i++) {
+        bytes += bufferSizes[i];
+    }
+    const uint32_t pageSize = flash.geometry.pageSize;
+    const uint32_t pageRemaining = pageSize - flash.programAddress % pageSize;
+    if (bytes > pageRemaining) {
+        flash.pageCrossings++;
+        bytes = pageRemaining;
+    }
+
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < bufferCount && offset < bytes; i++) {
+        for (uint32_t j = 0; j < bufferSizes[i] && offset < bytes; j++, offset++) {
+            // Programming can only clear bits
+            flash.memory[flash.programAddress + offset] &= buffers[i][j];
+        }
+    }
+
+    flash.programs++;
+    if (bytes == pageSize) {
+        flash.fullPagePrograms++;
+    }
+
+    const double transferUs = flashTransferUs(4 + bytes);
+    flash.timeUs += transferUs;
+    flash.busyUntilUs = flash.timeUs + flash.timings->pageProgramFirstByteUs + (bytes - 1) * flash.timings->pageProgramByteUs;
+
+    flash.programAddress += bytes;
+
+    // The transfer has completed
+    if (flash.holdPrograms) {
+        flash.heldProgramBytes = bytes;
+    } else if (flash.programCallback) {
+        flash.programCallback(bytes);
+    }
+
+    return bytes;
+}
+
+void flashPageProgramFinish(void)
+{
+}
+
+void flashPageProgram(uint32_t address, const uint8_t *data, uint32_t length, void (*callback)(uint32_t length))
+{
+    flashPageProgramBegin(address, callback);
+    flashPageProgramContinue(&data, &length, 1);
+    flashPageProgramFinish();
+}
+
+int flashReadBytes(uint32_t address, uint8_t *buffer, uint32_t length)
+{
+    flashWaitForReady();
+
+    memcpy(buffer, &flash.memory[address], length);
+    flash.timeUs += flash.timings->pageReadUs + flashTransferUs(4 + length);
+    flash.reads++;
+    return length;
+}
+
+void flashFlush(void)
+{
+}
+
+// Time passes while flashfs polls the clock, as it does while it polls the flash
+uint32_t millis(void)
+{
+    flash.timeUs += FLASH_STATUS_POLL_US;
+    return flash.timeUs / 1000;
+}
+
+const flashGeometry_t *flashGetGeometry(void)
+{
+    return &flash.geometry;
+}
+
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type)
+{
+    return type == FLASH_PARTITION_TYPE_FLASHFS ? &flash.partition : NULL;
+}
+
+int flashPartitionCount(void)
+{
+    return 1;
+}
+
+}
+
+// Report the transfer of a held program as complete
+static void flashSimReleaseProgram(void)
+{
+    flash.holdPrograms = false;
+    if (flash.heldProgramBytes && flash.programCallback) {
+        flash.programCallback(flash.heldProgramBytes);
+    }
+    flash.heldProgramBytes = 0;
+}
+
+static uint8_t patternByte(uint32_t offset)
+{
+    return (offset * 7 + (offset >> 8)) & 0xFF;
+}
+
+/*
+ * Log for the given time like the blackbox does: each loop, write a frame if it fits in the buffer (dropping it if
+ * not) and call flashfsFlushAsync(). Returns the number of bytes logged.
+ */
+static uint32_t logFrames(double durationUs, double loopUs, uint32_t frameSize, int *droppedFrames)
+{
+    uint8_t frame[FLASHFS_WRITE_BUFFER_SIZE];
+    uint32_t logged = 0;
+    const double startUs = flash.timeUs;
+
+    *droppedFrames = 0;
+
+    for (double loopStartUs = startUs; loopStartUs < startUs + durationUs; loopStartUs += loopUs) {
+        if (flash.timeUs < loopStartUs) {
+            flash.timeUs = loopStartUs;
+        }
+
+        if (flashfsGetWriteBufferFreeSpace() < frameSize) {
+            (*droppedFrames)++;
+        } else {
+            for (uint32_t i = 0; i < frameSize; i++) {
+                frame[i] = patternByte(logged + i);
+            }
+            flashfsWrite(frame, frameSize, false);
+            logged += frameSize;
+        }
+
+        flashfsFlushAsync(false);
+    }
+
+    return logged;
+}
+
+static void finishLog(void)
+{
+    for (int i = 0; i < 100000 && !flashfsFlushAsync(true); i++) {
+        flash.timeUs += 10;
+    }
+    flashWaitForReady();
+}
+
+static void verifyLog(uint32_t start, uint32_t length)
+{
+    int mismatches = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        if (flash.memory[start + i] != patternByte(i)) {
+            mismatches++;
+        }
+    }
+    EXPECT_EQ(0, mismatches);
+    EXPECT_EQ(0xFF, flash.memory[start + length]);
+}
+
+// Close the log, and wait for its record to be written to the index like the blackbox does before the next log
+static void closeLog(void)
+{
+    flashfsClose();
+    while (!flashfsIsReady());
+}
+
+/*
+ * Write a log of the given length synchronously, and close it if asked to. Returns where the log starts.
+ */
+static uint32_t writeLog(uint32_t length, bool close)
+{
+    uint8_t data[FLASH_PAGE_SIZE];
+    const uint32_t start = flashfsGetOffset();
+
+    for (uint32_t written = 0; written < length; ) {
+        const uint32_t chunk = std::min<uint32_t>(length - written, sizeof(data));
+        for (uint32_t i = 0; i < chunk; i++) {
+            data[i] = patternByte(written + i);
+        }
+        flashfsWrite(data, chunk, true);
+        written += chunk;
+    }
+    flashfsFlushSync();
+
+    if (close) {
+        closeLog();
+    }
+
+    return start;
+}
+
+static void expectLog(int index, uint32_t start, uint32_t end)
+{
+    uint32_t logStart = 0;
+    uint32_t logEnd = 0;
+
+    EXPECT_TRUE(flashfsGetLog(index, &logStart, &logEnd));
+    EXPECT_EQ(start, logStart);
+    EXPECT_EQ(end, logEnd);
+}
+
+TEST(FlashfsTest, LogIsProgrammedInWholePages)
+{
+    int droppedFrames;
+
+    flashSimInit(&m25p16Timings);
+    flashfsInit();
+    EXPECT_EQ(0u, flashfsGetOffset());
+    EXPECT_EQ((uint32_t) FLASHFS_WRITE_BUFFER_SIZE - 1, flashfsGetWriteBufferSize());
+
+    // 2kHz logging of 40 byte frames
+    const uint32_t length = logFrames(200000, 500, 40, &droppedFrames);
+    finishLog();
+
+    EXPECT_EQ(0, droppedFrames);
+    EXPECT_EQ(length, flashfsGetOffset());
+    verifyLog(0, length);
+
+    // Every page but the last, partial one was programmed in one go
+    EXPECT_EQ((int) (length / FLASH_PAGE_SIZE), flash.fullPagePrograms);
+    EXPECT_EQ(flash.fullPagePrograms + 1, flash.programs);
+    EXPECT_EQ(0, flash.pageCrossings);
+}
+
+TEST(FlashfsTest, LogResumesMidPage)
+{
+    int droppedFrames;
+
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+
+    const uint32_t firstLength = logFrames(10000, 500, 30, &droppedFrames);
+    finishLog();
+    ASSERT_NE(0u, firstLength % FLASH_PAGE_SIZE);
+    verifyLog(0, firstLength);
+
+    // The next log starts part way through a page, and fills the rest of that page before carrying on in whole pages
+    const int programsBefore = flash.programs;
+    const int fullPageProgramsBefore = flash.fullPagePrograms;
+    const uint32_t secondLength = logFrames(100000, 500, 30, &droppedFrames);
+    finishLog();
+
+    EXPECT_EQ(0, droppedFrames);
+    EXPECT_EQ(firstLength + secondLength, flashfsGetOffset());
+    verifyLog(firstLength, secondLength);
+
+    const int secondFullPages = (firstLength + secondLength) / FLASH_PAGE_SIZE - firstLength / FLASH_PAGE_SIZE - 1;
+    EXPECT_EQ(secondFullPages, flash.fullPagePrograms - fullPageProgramsBefore);
+    EXPECT_EQ(secondFullPages + 2, flash.programs - programsBefore);
+    EXPECT_EQ(0, flash.pageCrossings);
+}
+
+TEST(FlashfsTest, SynchronousWritesWaitForEraseToComplete)
+{
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+
+    flashfsEraseRange(0, 1);
+
+    uint8_t data[600];
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = patternByte(i);
+    }
+    flashfsWrite(data, 300, true);
+    flashfsWrite(data + 300, 300, true);
+    flashfsFlushSync();
+
+    EXPECT_GE(flash.timeUs, w25q128Timings.sectorEraseUs);
+    EXPECT_EQ(sizeof(data), flashfsGetOffset());
+    verifyLog(0, sizeof(data));
+    EXPECT_EQ(0, flash.pageCrossings);
+}
+
+TEST(FlashfsTest, SynchronousFlushGivesUpOnATransferWhichNeverCompletes)
+{
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+
+    uint8_t data[300];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = patternByte(i);
+    }
+
+    // The first page is programmed, but its transfer is never reported as complete
+    flash.holdPrograms = true;
+    flashfsWrite(data, sizeof(data), false);
+    flashfsFlushSync();
+    EXPECT_EQ(1, flash.programs);
+    EXPECT_GE(flash.timeUs, 100000);
+
+    // Once it is, the rest of the buffer is flushed
+    flashSimReleaseProgram();
+    flashfsFlushSync();
+    EXPECT_EQ(sizeof(data), flashfsGetOffset());
+    verifyLog(0, sizeof(data));
+}
+
+TEST(FlashfsTest, TailIsFoundFromTheIndex)
+{
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+    EXPECT_EQ(0, flashfsGetLogCount());
+
+    // The last sector holds the index
+    EXPECT_EQ((uint32_t) (FLASH_SECTORS - 1) * FLASH_PAGE_SIZE * FLASH_PAGES_PER_SECTOR, flashfsGetSize());
+
+    const uint32_t lengths[] = { 1000, 70000, 333 };
+    uint32_t starts[3];
+    for (int i = 0; i < 3; i++) {
+        starts[i] = writeLog(lengths[i], true);
+    }
+    const uint32_t end = starts[2] + lengths[2];
+    EXPECT_EQ(end, flashfsGetOffset());
+    EXPECT_EQ(3, flashfsGetLogCount());
+
+    flashSimPowerCycle();
+    flashfsInit();
+
+    // A binary search of the 256 index pages, and a check that nothing follows the last log
+    EXPECT_LE(flash.reads, 9);
+
+    EXPECT_EQ(end, flashfsGetOffset());
+    ASSERT_EQ(3, flashfsGetLogCount());
+    for (int i = 0; i < 3; i++) {
+        expectLog(i, starts[i], starts[i] + lengths[i]);
+    }
+    verifyLog(starts[2], lengths[2]);
+
+    // The next log carries on straight after the last one
+    EXPECT_EQ(end, writeLog(500, true));
+    expectLog(3, end, end + 500);
+}
+
+TEST(FlashfsTest, ErasedLookingDataDoesNotEndTheLog)
+{
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+
+    // A long run of data that looks erased, where searching the flash for free space would land
+    const uint32_t length = 1536 * 1024;
+    writeLog(length, false);
+    for (uint32_t address = 768 * 1024; address < 1280 * 1024; address++) {
+        flash.memory[address] = 0xFF;
+    }
+    closeLog();
+
+    EXPECT_EQ(768u * 1024, (uint32_t) flashfsIdentifyStartOfFreeSpace());
+
+    flashSimPowerCycle();
+    flashfsInit();
+
+    EXPECT_EQ(length, flashfsGetOffset());
+}
+
+TEST(FlashfsTest, UnclosedLogIsRecovered)
+{
+    flashSimInit(&m25p16Timings);
+    flashfsInit();
+
+    const uint32_t firstLength = 5000;
+    writeLog(firstLength, true);
+
+    // The power is cut before the second log is closed
+    writeLog(10000, false);
+
+    flashSimPowerCycle();
+    flashfsInit();
+
+    // The end of the second log is found by searching the flash after the first, and recorded in the index
+    const uint32_t end = 16384;
+    EXPECT_EQ(end, flashfsGetOffset());
+    ASSERT_EQ(2, flashfsGetLogCount());
+    expectLog(0, 0, firstLength);
+    expectLog(1, firstLength, end);
+
+    flashSimPowerCycle();
+    flashfsInit();
+    EXPECT_EQ(end, flashfsGetOffset());
+    EXPECT_EQ(2, flashfsGetLogCount());
+}
+
+TEST(FlashfsTest, LogsFromBeforeTheIndexAreFoundBySearching)
+{
+    flashSimInit(&m25p16Timings);
+    for (uint32_t address = 0; address < 5000; address++) {
+        flash.memory[address] = patternByte(address);
+    }
+
+    flashfsInit();
+
+    EXPECT_EQ(6144u, flashfsGetOffset());
+    EXPECT_EQ(0, flashfsGetLogCount());
+
+    writeLog(100, true);
+    ASSERT_EQ(1, flashfsGetLogCount());
+    expectLog(0, 6144, 6244);
+}
+
+TEST(FlashfsTest, IndexIsDisabledWhenLogsFillTheVolume)
+{
+    flashSimInit(&m25p16Timings);
+    for (uint32_t address = 0; address < flash.geometry.totalSize; address++) {
+        flash.memory[address] = patternByte(address);
+    }
+
+    flashfsInit();
+
+    EXPECT_EQ(flashfsGetSize(), flashfsGetOffset());
+    EXPECT_TRUE(flashfsIsEOF());
+    EXPECT_EQ(0, flashfsGetLogCount());
+
+    // Erasing the volume brings the index back
+    flashfsEraseCompletely();
+    flashfsInit();
+    EXPECT_EQ(0u, flashfsGetOffset());
+
+    writeLog(100, true);
+    EXPECT_EQ(1, flashfsGetLogCount());
+}
+
+TEST(FlashfsTest, IndexStartsOverWhenFull)
+{
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+
+    const int slots = FLASH_PAGES_PER_SECTOR;
+    for (int i = 0; i < slots; i++) {
+        writeLog(100, true);
+    }
+    EXPECT_EQ(slots, flashfsGetLogCount());
+
+    // Closing the log starts the erase of the index sector, but doesn't wait for it
+    const uint32_t start = writeLog(100, false);
+    const double closeStartUs = flash.timeUs;
+    flashfsClose();
+    EXPECT_LT(flash.timeUs - closeStartUs, 1000);
+    EXPECT_FALSE(flashfsIsReady());
+
+    while (!flashfsIsReady());
+    EXPECT_GE(flash.timeUs - closeStartUs, w25q128Timings.sectorEraseUs);
+    ASSERT_EQ(1, flashfsGetLogCount());
+    expectLog(0, start, start + 100);
+
+    flashSimPowerCycle();
+    flashfsInit();
+    EXPECT_EQ(start + 100, flashfsGetOffset());
+    EXPECT_EQ(1, flashfsGetLogCount());
+}
+
+TEST(FlashfsTest, ClosingDoesNotWaitForTheEndOfTheLog)
+{
+    int droppedFrames;
+
+    flashSimInit(&w25q128Timings);
+    flashfsInit();
+
+    // The log ends with a partial page, and a full one still waiting for the flash
+    const uint32_t length = logFrames(20000, 500, 40, &droppedFrames);
+    uint8_t frame[FLASH_PAGE_SIZE];
+    for (uint32_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = patternByte(length + i);
+    }
+    flashfsWrite(frame, sizeof(frame), false);
+    ASSERT_NE(0u, (length + sizeof(frame)) % FLASH_PAGE_SIZE);
+
+    const double closeStartUs = flash.timeUs;
+    flashfsClose();
+    EXPECT_LT(flash.timeUs - closeStartUs, 100);
+    EXPECT_FALSE(flashfsIsReady());
+
+    while (!flashfsIsReady());
+    verifyLog(0, length + sizeof(frame));
+    ASSERT_EQ(1, flashfsGetLogCount());
+    expectLog(0, 0, length + sizeof(frame));
+
+    // The next log carries on after it
+    EXPECT_EQ(length + sizeof(frame), writeLog(100, true));
+    expectLog(1, length + sizeof(frame), length + sizeof(frame) + 100);
+}
+
+TEST(FlashfsTest, NandLogsStartOnFreshPages)
+{
+    flashSimInitNand();
+    flashfsInit();
+
+    writeLog(3000, true);
+    EXPECT_EQ(2u * NAND_PAGE_SIZE, flashfsGetOffset());
+    writeLog(100, true);
+
+    flashSimPowerCycle();
+    flashfsInit();
+
+    EXPECT_EQ(3u * NAND_PAGE_SIZE, flashfsGetOffset());
+    ASSERT_EQ(2, flashfsGetLogCount());
+    expectLog(0, 0, 3000);
+    expectLog(1, 2 * NAND_PAGE_SIZE, 2 * NAND_PAGE_SIZE + 100);
+}
@@ -0,0 +1,121 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/histogram.h"
+
+    #include "fc/latency_trace.h"
+
+    static uint32_t cycleCounter;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// one clock cycle per 1/10 us keeps the expected values readable
+static void markAt(latencyPoint_e point, uint32_t cycles)
+{
+    cycleCounter = cycles;
+    latencyTraceMark(point);
+}
+
+TEST(LatencyTraceUnittest, StagesAndTotal)
+{
+    latencyTraceReset();
+
+    markAt(LATENCY_POINT_GYRO_SAMPLE, 1000);
+    markAt(LATENCY_POINT_GYRO_FILTERED, 1040);
+    markAt(LATENCY_POINT_PID, 1100);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 1130);
+
+    EXPECT_EQ(1u, latencyTraceHistogram(LATENCY_STAGE_FILTER)->count);
+    EXPECT_EQ(40u, latencyTraceHistogram(LATENCY_STAGE_FILTER)->max);
+    EXPECT_EQ(60u, latencyTraceHistogram(LATENCY_STAGE_PID)->max);
+    EXPECT_EQ(30u, latencyTraceHistogram(LATENCY_STAGE_MOTOR)->max);
+    EXPECT_EQ(130u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->max);
+}
+
+TEST(LatencyTraceUnittest, NewestSampleBeforeFilteringIsTraced)
+{
+    latencyTraceReset();
+
+    // pid denominator 2: two samples per filter run, the next sample is read before the pid runs
+    markAt(LATENCY_POINT_GYRO_SAMPLE, 1000);
+    markAt(LATENCY_POINT_GYRO_SAMPLE, 1125);
+    markAt(LATENCY_POINT_GYRO_FILTERED, 1150);
+    markAt(LATENCY_POINT_GYRO_SAMPLE, 1250);
+    markAt(LATENCY_POINT_PID, 1300);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 1320);
+
+    EXPECT_EQ(25u, latencyTraceHistogram(LATENCY_STAGE_FILTER)->max);
+    EXPECT_EQ(195u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->max);
+}
+
+TEST(LatencyTraceUnittest, OutOfOrderLoopIsDropped)
+{
+    latencyTraceReset();
+
+    // pid and motor write without a filtered sample
+    markAt(LATENCY_POINT_PID, 100);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 120);
+    EXPECT_EQ(0u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->count);
+
+    // motor write without a pid update
+    markAt(LATENCY_POINT_GYRO_SAMPLE, 200);
+    markAt(LATENCY_POINT_GYRO_FILTERED, 220);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 240);
+    EXPECT_EQ(0u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->count);
+
+    // a repeated motor write is not counted twice
+    markAt(LATENCY_POINT_GYRO_FILTERED, 300);
+    markAt(LATENCY_POINT_PID, 310);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 320);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 330);
+    EXPECT_EQ(1u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->count);
+    EXPECT_EQ(120u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->max);
+}
+
+TEST(LatencyTraceUnittest, ResetClearsHistograms)
+{
+    markAt(LATENCY_POINT_GYRO_SAMPLE, 0);
+    markAt(LATENCY_POINT_GYRO_FILTERED, 10);
+    markAt(LATENCY_POINT_PID, 20);
+    markAt(LATENCY_POINT_MOTOR_WRITE, 30);
+    EXPECT_NE(0u, latencyTraceHistogram(LATENCY_STAGE_TOTAL)->count);
+
+    latencyTraceReset();
+    for (int stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        EXPECT_EQ(0u, latencyTraceHistogram((latencyStage_e)stage)->count);
+        EXPECT_EQ(0u, latencyTraceHistogram((latencyStage_e)stage)->max);
+    }
+    EXPECT_STREQ("TOTAL", latencyTraceStageName(LATENCY_STAGE_TOTAL));
+}
+
+// STUBS
+
+extern "C" {
+uint32_t getCycleCounter(void) { return cycleCounter; }
+int32_t clockCyclesTo10thMicros(int32_t clockCycles) { return clockCycles; }
+}
@@ -111,6 +111,7 @@ extern "C" {
     }
     bool getShouldUpdateFeedforward() { return true; }
     void initRcProcessing(void) { }
+    void setConfigChanged(void) { }
 }
 
 pidProfile_t *pidProfile;
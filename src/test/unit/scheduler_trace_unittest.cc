@@ -0,0 +1,163 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "fc/tasks.h"
+
+    #include "scheduler/scheduler.h"
+    #include "scheduler/scheduler_trace.h"
+
+    uint32_t cycleCounter;
+
+    uint32_t getCycleCounter(void) { return cycleCounter; }
+    uint32_t clockMicrosToCycles(uint32_t micros) { return micros * 72; }
+
+    static task_attribute_t taskAttribute = { .taskName = "TEST" };
+    static task_t task = { .attribute = &taskAttribute };
+    task_t *getTask(unsigned) { return &task; }
+
+    int schedulerTraceMarkerDisabled(void);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static std::vector<uint8_t> stream;
+
+static void streamWrite(const uint8_t *data, int length)
+{
+    stream.insert(stream.end(), data, data + length);
+}
+
+TEST(SchedulerTraceUnittest, RecordsOnlyWhileRunning)
+{
+    schedulerTraceStop();
+    schedulerTraceStart(false);
+    EXPECT_EQ(SCHEDULER_TRACE_RUNNING, schedulerTraceGetState());
+    EXPECT_EQ(0, schedulerTraceEventCount());
+
+    schedulerTraceRecord(3, SCHEDULER_TRACE_TASK, 100, 200);
+    schedulerTraceStop();
+    schedulerTraceRecord(4, SCHEDULER_TRACE_TASK, 300, 400);
+
+    EXPECT_EQ(SCHEDULER_TRACE_STOPPED, schedulerTraceGetState());
+    ASSERT_EQ(1, schedulerTraceEventCount());
+    const schedulerTraceEvent_t *event = schedulerTraceGetEvent(0);
+    EXPECT_EQ(100u, event->startCycles);
+    EXPECT_EQ(200u, event->endCycles);
+    EXPECT_EQ(3, event->id);
+    EXPECT_EQ(SCHEDULER_TRACE_TASK, event->reason);
+}
+
+TEST(SchedulerTraceUnittest, RingKeepsNewestEvents)
+{
+    schedulerTraceStart(false);
+    const int recorded = SCHEDULER_TRACE_EVENT_COUNT + 10;
+    for (int i = 0; i < recorded; i++) {
+        schedulerTraceRecord(i & 0xff, SCHEDULER_TRACE_CHECK, i, i + 1);
+    }
+
+    // oldest first, the first 10 events have been overwritten
+    ASSERT_EQ(SCHEDULER_TRACE_EVENT_COUNT, schedulerTraceEventCount());
+    for (int i = 0; i < SCHEDULER_TRACE_EVENT_COUNT; i++) {
+        EXPECT_EQ((uint32_t)(i + 10), schedulerTraceGetEvent(i)->startCycles);
+    }
+    schedulerTraceStop();
+}
+
+TEST(SchedulerTraceUnittest, StopsHalfABufferAfterLateCycle)
+{
+    schedulerTraceStart(true);
+    for (int i = 0; i < SCHEDULER_TRACE_EVENT_COUNT; i++) {
+        schedulerTraceRecord(1, SCHEDULER_TRACE_TASK, i, i);
+    }
+    EXPECT_EQ(SCHEDULER_TRACE_ARMED, schedulerTraceGetState());
+
+    cycleCounter = 5000;
+    schedulerTraceLateCycle(7);
+    EXPECT_EQ(SCHEDULER_TRACE_TRIGGERED, schedulerTraceGetState());
+
+    for (int i = 0; i < SCHEDULER_TRACE_EVENT_COUNT; i++) {
+        schedulerTraceRecord(2, SCHEDULER_TRACE_TASK, 10000 + i, 10000 + i);
+    }
+    EXPECT_EQ(SCHEDULER_TRACE_STOPPED, schedulerTraceGetState());
+
+    // the late cycle event sits just before the middle of the ring
+    const schedulerTraceEvent_t *late = schedulerTraceGetEvent(SCHEDULER_TRACE_EVENT_COUNT / 2 - 1);
+    EXPECT_EQ(SCHEDULER_TRACE_LATE, late->reason);
+    EXPECT_EQ(7, late->id);
+    EXPECT_EQ(5000u, late->startCycles);
+    EXPECT_EQ(10000u + SCHEDULER_TRACE_EVENT_COUNT / 2 - 1, schedulerTraceGetEvent(SCHEDULER_TRACE_EVENT_COUNT - 1)->startCycles);
+}
+
+TEST(SchedulerTraceUnittest, Serialization)
+{
+    stream.clear();
+    schedulerTraceWriteHeader(streamWrite);
+
+    // magic, version, cycles per us, task count, then every task name
+    ASSERT_EQ((size_t)10 + TASK_COUNT * (2 + strlen("TEST")), stream.size());
+    EXPECT_EQ(0, memcmp(stream.data(), "BFST", 4));
+    EXPECT_EQ(SCHEDULER_TRACE_VERSION, stream[4]);
+    EXPECT_EQ(72, stream[5]);
+    EXPECT_EQ(0, stream[6] | stream[7] | stream[8]);
+    EXPECT_EQ(TASK_COUNT, stream[9]);
+    EXPECT_EQ(1, stream[10 + 6]);
+    EXPECT_EQ(4, stream[10 + 6 + 1]);
+
+    stream.clear();
+    const schedulerTraceEvent_t event = { .startCycles = 0x12345678, .endCycles = 0x9abcdef0, .id = 5, .reason = SCHEDULER_TRACE_LATE };
+    schedulerTraceWriteEvent(streamWrite, &event);
+    const uint8_t expected[SCHEDULER_TRACE_EVENT_SIZE] = { 0x78, 0x56, 0x34, 0x12, 0xf0, 0xde, 0xbc, 0x9a, 5, SCHEDULER_TRACE_LATE };
+    ASSERT_EQ(sizeof(expected), stream.size());
+    EXPECT_EQ(0, memcmp(expected, stream.data(), sizeof(expected)));
+}
+
+TEST(SchedulerTraceUnittest, Marker)
+{
+    schedulerTraceStart(false);
+    cycleCounter = 1234;
+    SCHEDULER_TRACE_MARKER(9);
+    schedulerTraceStop();
+
+    ASSERT_EQ(1, schedulerTraceEventCount());
+    const schedulerTraceEvent_t *event = schedulerTraceGetEvent(0);
+    EXPECT_EQ(SCHEDULER_TRACE_MARKER, event->reason);
+    EXPECT_EQ(9, event->id);
+    EXPECT_EQ(1234u, event->startCycles);
+    EXPECT_EQ(1234u, event->endCycles);
+}
+
+TEST(SchedulerTraceUnittest, HooksCompileOutWithoutTrace)
+{
+    // nothing is recorded and the arguments aren't even evaluated
+    schedulerTraceStart(false);
+    EXPECT_EQ(0, schedulerTraceMarkerDisabled());
+    EXPECT_EQ(0, schedulerTraceEventCount());
+    schedulerTraceStop();
+}
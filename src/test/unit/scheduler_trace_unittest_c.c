@@ -0,0 +1,51 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// The hooks as a build without USE_SCHEDULER_TRACE sees them, the test itself is built with it
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#undef USE_SCHEDULER_TRACE
+#include "scheduler/scheduler_trace.h"
+
+static int markerArgumentEvaluations;
+
+// Only referenced from hooks that compile out
+static __attribute__((unused)) uint8_t markerId(void)
+{
+    markerArgumentEvaluations++;
+    return 1;
+}
+
+// Returns how many times the marker's argument was evaluated, none if the hooks compiled out
+int schedulerTraceMarkerDisabled(void)
+{
+    markerArgumentEvaluations = 0;
+
+    SCHEDULER_TRACE_BEGIN(startCycles);
+    SCHEDULER_TRACE_MARKER(markerId());
+    SCHEDULER_TRACE_END(markerId(), SCHEDULER_TRACE_TASK, startCycles);
+    SCHEDULER_TRACE_LATE(markerId());
+
+    return markerArgumentEvaluations;
+}
@@ -19,6 +19,7 @@
 
 extern "C" {
     #include "platform.h"
+    #include "common/utils.h"
     #include "pg/pg.h"
     #include "pg/pg_ids.h"
     #include "pg/scheduler.h"
@@ -29,6 +30,7 @@ extern "C" {
     PG_RESET_TEMPLATE(schedulerConfig_t, schedulerConfig,
         .rxRelaxDeterminism = 25,
         .osdRelaxDeterminism = 25,
+        .schedulerMode = SCHEDULER_MODE_PRIORITY,
     );
 }
 
@@ -114,6 +116,26 @@ extern "C" {
     extern task_t *queueFirst(void);
     extern task_t *queueNext(void);
 
+    extern task_t* taskHeap[];
+    extern int taskHeapSize;
+    extern task_t* taskRunList[];
+    extern int taskRunListSize;
+
+    // Tasks for the throughput benchmarks, a representative mix of rates and priorities
+    void taskBench(timeUs_t) { simulatedTime += 2; }
+    bool benchUpdateCheck(timeUs_t, timeDelta_t currentDeltaTimeUs) { return currentDeltaTimeUs >= 5000; }
+
+    task_attribute_t bench_task_attributes[] = {
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(1000), TASK_PRIORITY_MEDIUM_HIGH },
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(500), TASK_PRIORITY_MEDIUM },
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW },
+        { "BENCH", NULL, benchUpdateCheck, taskBench, TASK_PERIOD_HZ(33), TASK_PRIORITY_HIGH },
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(100), TASK_PRIORITY_MEDIUM },
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(50), TASK_PRIORITY_MEDIUM },
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(10), TASK_PRIORITY_LOWEST },
+        { "BENCH", NULL, NULL, taskBench, TASK_PERIOD_HZ(5), TASK_PRIORITY_MEDIUM },
+    };
+
     task_attribute_t task_attributes[TASK_COUNT] = {
         [TASK_SYSTEM] = {
             .taskName = "SYSTEM",
@@ -386,16 +408,18 @@ TEST(SchedulerUnittest, TestScheduleEmptyQueue)
     EXPECT_EQ(NULL, unittest_scheduler_selectedTask);
 }
 
-TEST(SchedulerUnittest, TestSingleTask)
+// Run with the scheduler mode configured, the other tests leave it at SCHEDULER_MODE_PRIORITY
+static void testSingleTask(void)
 {
     schedulerInit();
     // disable all tasks except TASK_ACCEL
     for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
         setTaskEnabled(static_cast<taskId_e>(taskId), false);
     }
-    setTaskEnabled(TASK_ACCEL, true);
+    // in deadline mode the task's place in the heap is set from when it last ran as it is enabled
     tasks[TASK_ACCEL].lastExecutedAtUs = 1000;
     tasks[TASK_ACCEL].lastStatsAtUs = 1000;
+    setTaskEnabled(TASK_ACCEL, true);
     simulatedTime = 2050;
     // run the scheduler and check the task has executed
     scheduler();
@@ -408,6 +432,11 @@ TEST(SchedulerUnittest, TestSingleTask)
     EXPECT_EQ(0, tasks[TASK_GYRO].dynamicPriority);
 }
 
+TEST(SchedulerUnittest, TestSingleTask)
+{
+    testSingleTask();
+}
+
 TEST(SchedulerUnittest, TestTwoTasks)
 {
     // disable all tasks except TASK_ACCEL and TASK_ATTITUDE
@@ -543,7 +572,223 @@ TEST(SchedulerUnittest, TestPriorityBump)
     EXPECT_EQ(11000 + TEST_UPDATE_ACCEL_TIME, simulatedTime);
 }
 
-TEST(SchedulerUnittest, TestGyroTask)
+void setDeadlineScheduling(bool enabled)
+{
+    schedulerConfigMutable()->schedulerMode = enabled ? SCHEDULER_MODE_DEADLINE : SCHEDULER_MODE_PRIORITY;
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), false);
+    }
+}
+
+TEST(SchedulerUnittest, TestDeadlineHeap)
+{
+    setDeadlineScheduling(true);
+    EXPECT_EQ(0, taskHeapSize);
+    EXPECT_EQ(0, taskRunListSize);
+
+    // time-driven tasks wait in the heap until due
+    simulatedTime = 1000;
+    const taskId_e timedTasks[] = { TASK_ACCEL, TASK_ATTITUDE, TASK_SERIAL, TASK_DISPATCH, TASK_BATTERY_VOLTAGE };
+    for (const taskId_e taskId : timedTasks) {
+        tasks[taskId].lastExecutedAtUs = simulatedTime;
+        setTaskEnabled(taskId, true);
+    }
+    EXPECT_EQ(5, taskHeapSize);
+    EXPECT_EQ(0, taskRunListSize);
+    EXPECT_EQ(2000, taskHeap[0]->deadlineAtUs);
+    for (int ii = 0; ii < taskHeapSize; ++ii) {
+        EXPECT_EQ(ii + 1, taskHeap[ii]->heapPosition);
+        if (ii > 0) {
+            EXPECT_LE(taskHeap[(ii - 1) / 2]->deadlineAtUs, taskHeap[ii]->deadlineAtUs);
+        }
+    }
+
+    // rescheduling a waiting task moves it in the heap
+    rescheduleTask(TASK_BATTERY_VOLTAGE, TASK_PERIOD_HZ(2000));
+    EXPECT_EQ(&tasks[TASK_BATTERY_VOLTAGE], taskHeap[0]);
+    EXPECT_EQ(1500, tasks[TASK_BATTERY_VOLTAGE].deadlineAtUs);
+
+    // event driven tasks are always on the run list so their check function is polled
+    setTaskEnabled(TASK_RX, true);
+    EXPECT_EQ(5, taskHeapSize);
+    EXPECT_EQ(1, taskRunListSize);
+    EXPECT_EQ(&tasks[TASK_RX], taskRunList[0]);
+    EXPECT_EQ(NULL, taskRunList[1]);
+
+    // and realtime tasks are never queued
+    setTaskEnabled(TASK_GYRO, true);
+    EXPECT_EQ(5, taskHeapSize);
+    EXPECT_EQ(1, taskRunListSize);
+
+    // disabled tasks leave the heap
+    setTaskEnabled(TASK_BATTERY_VOLTAGE, false);
+    EXPECT_EQ(0, tasks[TASK_BATTERY_VOLTAGE].heapPosition);
+    EXPECT_EQ(4, taskHeapSize);
+    EXPECT_EQ(2000, taskHeap[0]->deadlineAtUs);
+    rescheduleTask(TASK_BATTERY_VOLTAGE, TASK_PERIOD_HZ(50));
+
+    setTaskEnabled(TASK_RX, false);
+    EXPECT_EQ(0, taskRunListSize);
+
+    setDeadlineScheduling(false);
+}
+
+TEST(SchedulerUnittest, TestDeadlineTwoTasks)
+{
+    setDeadlineScheduling(true);
+
+    // set it up so that TASK_ACCEL ran just before TASK_ATTITUDE
+    static const uint32_t startTime = 4000;
+    simulatedTime = startTime;
+    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime;
+    tasks[TASK_ATTITUDE].lastExecutedAtUs = tasks[TASK_ACCEL].lastExecutedAtUs - TEST_UPDATE_ATTITUDE_TIME;
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_ATTITUDE, true);
+
+    // no tasks should run, since neither task's desired time has elapsed
+    scheduler();
+    EXPECT_EQ(static_cast<task_t*>(0), unittest_scheduler_selectedTask);
+    simulatedTime += 500;
+    scheduler();
+    EXPECT_EQ(static_cast<task_t*>(0), unittest_scheduler_selectedTask);
+    EXPECT_EQ(0, taskRunListSize);
+
+    // 500 microseconds later, TASK_ACCEL desiredPeriodUs has elapsed
+    simulatedTime += 500;
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+    EXPECT_EQ(5000 + TEST_UPDATE_ACCEL_TIME, simulatedTime);
+    // and once run it waits in the heap again
+    EXPECT_EQ(0, taskRunListSize);
+    EXPECT_EQ(&tasks[TASK_ACCEL], taskHeap[0]);
+    EXPECT_EQ(6000, tasks[TASK_ACCEL].deadlineAtUs);
+
+    simulatedTime += 1000 - TEST_UPDATE_ACCEL_TIME;
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+
+    scheduler();
+    EXPECT_EQ(static_cast<task_t*>(0), unittest_scheduler_selectedTask);
+
+    simulatedTime = startTime + 10500; // TASK_ACCEL and TASK_ATTITUDE desiredPeriodUss have elapsed
+    // of the two TASK_ACCEL should run first
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+    EXPECT_EQ(1, taskRunListSize);
+    // and finally TASK_ATTITUDE should now run
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ATTITUDE], unittest_scheduler_selectedTask);
+    EXPECT_EQ(0, taskRunListSize);
+
+    setDeadlineScheduling(false);
+}
+
+TEST(SchedulerUnittest, TestDeadlineAgePromotion)
+{
+    setDeadlineScheduling(true);
+
+    // Both tasks have an update rate of 1kHz, but TASK_DISPATCH needs more time than is available
+    simulatedTime = 4000;
+    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime;
+    tasks[TASK_DISPATCH].lastExecutedAtUs = simulatedTime;
+    tasks[TASK_DISPATCH].anticipatedExecutionTime = TEST_DISPATCH_TIME << TASK_EXEC_TIME_SHIFT;
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_DISPATCH, true);
+
+    // TASK_DISPATCH stays on the run list and ages until the scheduler forces it to run
+    int accelRuns = 0;
+    uint16_t dispatchAge = 0;
+    for (int ii = 0; ii <= SCHED_TASK_DEFER_MASK + 1; ++ii) {
+        simulatedTime += 1000;
+        scheduler();
+        if (unittest_scheduler_selectedTask != &tasks[TASK_ACCEL]) {
+            break;
+        }
+        accelRuns++;
+        dispatchAge = tasks[TASK_DISPATCH].taskAgePeriods;
+        EXPECT_EQ(0, tasks[TASK_DISPATCH].heapPosition);
+    }
+    EXPECT_EQ(&tasks[TASK_DISPATCH], unittest_scheduler_selectedTask);
+    EXPECT_LE(accelRuns, SCHED_TASK_DEFER_MASK);
+    EXPECT_EQ(accelRuns, dispatchAge);
+    EXPECT_NE(0, tasks[TASK_DISPATCH].heapPosition);
+
+    setDeadlineScheduling(false);
+}
+
+TEST(SchedulerUnittest, TestDeadlineSingleTask)
+{
+    schedulerConfigMutable()->schedulerMode = SCHEDULER_MODE_DEADLINE;
+    testSingleTask();
+    // once run, the task waits in the heap for its next period
+    EXPECT_EQ(&tasks[TASK_ACCEL], taskHeap[0]);
+    EXPECT_EQ(0, taskRunListSize);
+    setDeadlineScheduling(false);
+}
+
+static void runScheduler(bool deadline, int passes, uint32_t *runCounts)
+{
+    setDeadlineScheduling(deadline);
+
+    int taskCount = 0;
+    simulatedTime = 0;
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        if ((taskId == TASK_GYRO) || (taskId == TASK_FILTER) || (taskId == TASK_PID)) {
+            continue;
+        }
+        task_t *task = &tasks[taskId];
+        task->attribute = &bench_task_attributes[taskId % ARRAYLEN(bench_task_attributes)];
+        task->dynamicPriority = 0;
+        task->taskAgePeriods = 0;
+        task->lastExecutedAtUs = 0;
+        task->lastSignaledAtUs = 0;
+        task->anticipatedExecutionTime = 0;
+        setTaskEnabled(static_cast<taskId_e>(taskId), true);
+        taskCount++;
+    }
+    EXPECT_GE(taskCount, 20);
+    if (deadline) {
+        EXPECT_EQ(taskCount, taskHeapSize + taskRunListSize);
+    } else {
+        // the heap and run list are left alone in priority mode
+        EXPECT_EQ(0, taskHeapSize);
+        EXPECT_EQ(0, taskRunListSize);
+    }
+
+    for (int ii = 0; ii < passes; ++ii) {
+        simulatedTime += 10;
+        scheduler();
+        if (unittest_scheduler_selectedTask) {
+            runCounts[unittest_scheduler_selectedTask - tasks]++;
+        }
+    }
+
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        tasks[taskId].attribute = &task_attributes[taskId];
+    }
+    setDeadlineScheduling(false);
+}
+
+TEST(SchedulerUnittest, TestDeadlineMatchesPriority)
+{
+    // Both modes should make the same scheduling decisions, the deadline mode just examines fewer tasks.
+    // Tasks of equal priority may be picked in a different order, so allow for a run in flight at the end.
+    const int passes = 200000;
+    uint32_t priorityRuns[TASK_COUNT] = { 0 };
+    uint32_t deadlineRuns[TASK_COUNT] = { 0 };
+
+    runScheduler(false, passes, priorityRuns);
+    runScheduler(true, passes, deadlineRuns);
+
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        EXPECT_NEAR(priorityRuns[taskId], deadlineRuns[taskId], 1);
+    }
+    // the 1kHz tasks ran at their desired rate
+    EXPECT_NEAR(passes * 10 / 1000, priorityRuns[TASK_SYSTEM], passes * 10 / 1000 / 20);
+}
+
+static void testGyroTask(void)
 {
     static const uint32_t startTime = 4000;
 
@@ -628,3 +873,108 @@ TEST(SchedulerUnittest, TestGyroTask)
     EXPECT_EQ(static_cast<task_t*>(0), unittest_scheduler_selectedTask);
 }
 
+TEST(SchedulerUnittest, TestGyroTask)
+{
+    testGyroTask();
+}
+
+TEST(SchedulerUnittest, TestDeadlineGyroTask)
+{
+    // the realtime tasks are run from the gyro loop, outside the heap and run list
+    setDeadlineScheduling(true);
+    testGyroTask();
+    EXPECT_EQ(0, taskHeapSize);
+    EXPECT_EQ(0, taskRunListSize);
+    setDeadlineScheduling(false);
+}
+
+
+static void testTaskHistograms(void)
+{
+    // the gyro is enabled by the earlier tests, keep it from running by marking it as just run before each pass
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), false);
+    }
+    simulatedTime = 100000;
+    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - 1000;
+    setTaskEnabled(TASK_ACCEL, true);
+
+    // nothing is recorded until enabled
+    EXPECT_FALSE(schedulerGetTaskHistograms());
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+
+    taskHistogramInfo_t histogramInfo;
+    EXPECT_TRUE(getTaskHistogramInfo(TASK_ACCEL, false, &histogramInfo));
+    EXPECT_EQ(0u, histogramInfo.count);
+    EXPECT_FALSE(getTaskHistogramInfo(TASK_ACCEL, true, &histogramInfo));
+
+    schedulerSetTaskHistograms(true);
+    for (int ii = 0; ii < 10; ++ii) {
+        simulatedTime += 1000;
+        tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+        scheduler();
+        EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
+    }
+    getTaskHistogramInfo(TASK_ACCEL, false, &histogramInfo);
+    EXPECT_EQ(10u, histogramInfo.count);
+    EXPECT_EQ((timeUs_t)TEST_UPDATE_ACCEL_TIME, histogramInfo.maxUs);
+    for (int ii = 0; ii < TASK_HISTOGRAM_PERCENTILE_COUNT; ++ii) {
+        EXPECT_EQ((timeUs_t)TEST_UPDATE_ACCEL_TIME, histogramInfo.percentileUs[ii]);
+    }
+    // ACCEL completes well within the gyro cycle
+    EXPECT_EQ(0u, histogramInfo.lateGyroCycles);
+
+    // TASK_DISPATCH isn't expected to take long, so is run, but overruns into the next gyro cycle
+    setTaskEnabled(TASK_ACCEL, false);
+    simulatedTime += 1000;
+    tasks[TASK_DISPATCH].lastExecutedAtUs = simulatedTime - 1000;
+    tasks[TASK_DISPATCH].anticipatedExecutionTime = 0;
+    setTaskEnabled(TASK_DISPATCH, true);
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+    scheduler();
+    EXPECT_EQ(&tasks[TASK_DISPATCH], unittest_scheduler_selectedTask);
+    getTaskHistogramInfo(TASK_DISPATCH, false, &histogramInfo);
+    EXPECT_EQ(1u, histogramInfo.count);
+    EXPECT_EQ((timeUs_t)TEST_DISPATCH_TIME, histogramInfo.maxUs);
+    EXPECT_EQ(1u, histogramInfo.lateGyroCycles);
+    setTaskEnabled(TASK_DISPATCH, false);
+
+    // check functions are timed separately
+    tasks[TASK_RX].dynamicPriority = 0;
+    setTaskEnabled(TASK_RX, true);
+    for (int ii = 0; ii < 5; ++ii) {
+        simulatedTime += 1000;
+        tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+        scheduler();
+    }
+    EXPECT_TRUE(getTaskHistogramInfo(TASK_RX, true, &histogramInfo));
+    EXPECT_EQ(5u, histogramInfo.count);
+    EXPECT_EQ((timeUs_t)TEST_UPDATE_RX_CHECK_TIME, histogramInfo.percentileUs[0]);
+    getTaskHistogramInfo(TASK_RX, false, &histogramInfo);
+    EXPECT_EQ(0u, histogramInfo.count);
+
+    // and recording stops when disabled
+    schedulerSetTaskHistograms(false);
+    simulatedTime += 1000;
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
+    scheduler();
+    getTaskHistogramInfo(TASK_RX, true, &histogramInfo);
+    EXPECT_EQ(5u, histogramInfo.count);
+    setTaskEnabled(TASK_RX, false);
+}
+
+TEST(SchedulerUnittest, TestTaskHistograms)
+{
+    testTaskHistograms();
+}
+
+TEST(SchedulerUnittest, TestDeadlineTaskHistograms)
+{
+    schedulerConfigMutable()->schedulerMode = SCHEDULER_MODE_DEADLINE;
+    schedulerSetTaskHistograms(false);
+    testTaskHistograms();
+    setDeadlineScheduling(false);
+}
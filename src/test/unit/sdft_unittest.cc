@@ -0,0 +1,126 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+
+extern "C" {
+    void sdftTestInit(int startBin, int endBin, int numBatches);
+    int sdftTestBinCount(void);
+    int sdftTestSampleSize(void);
+    void sdftTestPushBatch(const float *sample, int batchIdx);
+    void sdftTestPush(const float *sample);
+    void sdftTestBins(int axis, float *re, float *im, float *referenceRe, float *referenceIm);
+    void sdftTestWinSq(int axis, float *output, float *referenceOutput);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define MAX_BINS 256
+
+// A different mix of tones on each axis, so a mix up of the interleaved axes shows
+static void sample(int n, float *xyz)
+{
+    for (int axis = 0; axis < 3; axis++) {
+        const float frequency = 0.05f + 0.07f * axis;
+        xyz[axis] = 100.0f * sinf(2.0f * M_PI * frequency * n) + 30.0f * (axis + 1) * cosf(2.0f * M_PI * 0.31f * n) + 5.0f * axis;
+    }
+}
+
+static void expectSameSpectra(void)
+{
+    const int binCount = sdftTestBinCount();
+    ASSERT_LE(binCount, MAX_BINS);
+
+    for (int axis = 0; axis < 3; axis++) {
+        float re[MAX_BINS], im[MAX_BINS], referenceRe[MAX_BINS], referenceIm[MAX_BINS];
+        sdftTestBins(axis, re, im, referenceRe, referenceIm);
+        for (int i = 0; i < binCount; i++) {
+            EXPECT_FLOAT_EQ(referenceRe[i], re[i]) << "axis " << axis << " bin " << i;
+            EXPECT_FLOAT_EQ(referenceIm[i], im[i]) << "axis " << axis << " bin " << i;
+        }
+
+        float winSq[MAX_BINS] = { 0 };
+        float referenceWinSq[MAX_BINS] = { 0 };
+        sdftTestWinSq(axis, winSq, referenceWinSq);
+        for (int i = 0; i < binCount; i++) {
+            EXPECT_FLOAT_EQ(referenceWinSq[i], winSq[i]) << "axis " << axis << " bin " << i;
+        }
+    }
+}
+
+TEST(SdftUnittest, PushBatchMatchesScalarSdft)
+{
+    // the batches as the dynamic notch pushes them, one per downsampled gyro sample
+    const int numBatches = 6;
+    sdftTestInit(3, sdftTestBinCount() - 4, numBatches);
+
+    float xyz[3] = { 0 };
+    for (int n = 0; n < 4 * sdftTestSampleSize() * numBatches; n++) {
+        if (n % numBatches == 0) {
+            sample(n / numBatches, xyz);
+        }
+        sdftTestPushBatch(xyz, n % numBatches);
+    }
+
+    expectSameSpectra();
+}
+
+TEST(SdftUnittest, PushMatchesScalarSdft)
+{
+    sdftTestInit(0, sdftTestBinCount() - 1, 1);
+
+    float xyz[3];
+    for (int n = 0; n < 3 * sdftTestSampleSize() + 5; n++) {
+        sample(n, xyz);
+        sdftTestPush(xyz);
+    }
+
+    expectSameSpectra();
+}
+
+TEST(SdftUnittest, PeakIsInTheToneBin)
+{
+    sdftTestInit(1, sdftTestBinCount() - 2, 1);
+
+    // a tone in the middle of bin 10 on the yaw axis only
+    const int sampleSize = sdftTestSampleSize();
+    for (int n = 0; n < 4 * sampleSize; n++) {
+        float xyz[3] = { 0.0f, 0.0f, sinf(2.0f * M_PI * 10 * n / sampleSize) };
+        sdftTestPush(xyz);
+    }
+
+    float winSq[MAX_BINS] = { 0 };
+    float referenceWinSq[MAX_BINS] = { 0 };
+    sdftTestWinSq(2, winSq, referenceWinSq);
+    for (int i = 2; i < sdftTestBinCount() - 2; i++) {
+        if (i != 10) {
+            EXPECT_LT(winSq[i], winSq[10]) << "bin " << i;
+        }
+    }
+
+    sdftTestWinSq(0, winSq, referenceWinSq);
+    for (int i = 2; i < sdftTestBinCount() - 2; i++) {
+        EXPECT_FLOAT_EQ(0.0f, winSq[i]);
+    }
+}
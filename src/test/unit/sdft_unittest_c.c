@@ -0,0 +1,153 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// sdft.h uses C99 complex numbers, which C++ can't include, so the SDFTs are driven from here
+
+#include <math.h>
+#include <stdbool.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/sdft.h"
+
+#define SDFT_R 0.9999f
+
+// The single axis SDFT the dynamic notch ran per axis before sdftXYZ_t, as the reference
+typedef struct sdftScalar_s {
+    int idx;
+    int startBin;
+    int endBin;
+    int batchSize;
+    int numBatches;
+    float samples[SDFT_SAMPLE_SIZE];
+    complex_t data[SDFT_BIN_COUNT];
+} sdftScalar_t;
+
+static float rPowerN;
+static complex_t twiddle[SDFT_BIN_COUNT];
+
+static sdftXYZ_t sdft;
+static sdftScalar_t reference[SDFT_AXIS_COUNT];
+
+static void sdftScalarInit(sdftScalar_t *sdft, const int startBin, const int endBin, const int numBatches)
+{
+    sdft->idx = 0;
+    sdft->startBin = constrain(startBin - 1, 0, SDFT_BIN_COUNT - 1);
+    sdft->endBin = constrain(endBin + 1, sdft->startBin, SDFT_BIN_COUNT - 1);
+    sdft->numBatches = MAX(numBatches, 1);
+    sdft->batchSize = (sdft->endBin - sdft->startBin) / sdft->numBatches + 1;
+
+    for (int i = 0; i < SDFT_SAMPLE_SIZE; i++) {
+        sdft->samples[i] = 0.0f;
+    }
+    for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+        sdft->data[i] = 0.0f;
+    }
+}
+
+static void sdftScalarPushBatch(sdftScalar_t *sdft, const float sample, const int batchIdx)
+{
+    const int batchStart = sdft->batchSize * batchIdx;
+    int batchEnd = batchStart;
+
+    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
+
+    if (batchIdx == sdft->numBatches - 1) {
+        sdft->samples[sdft->idx] = sample;
+        sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
+        batchEnd += sdft->endBin - batchStart + 1;
+    } else {
+        batchEnd += sdft->batchSize;
+    }
+
+    for (int i = batchStart; i < batchEnd; i++) {
+        sdft->data[i] = twiddle[i] * (sdft->data[i] + delta);
+    }
+}
+
+static void sdftScalarWinSq(const sdftScalar_t *sdft, float *output)
+{
+    for (int i = (sdft->startBin + 1); i < sdft->endBin; i++) {
+        const complex_t val = sdft->data[i] - 0.5f * (sdft->data[i - 1] + sdft->data[i + 1]);
+        const float re = crealf(val);
+        const float im = cimagf(val);
+        output[i] = re * re + im * im;
+    }
+}
+
+void sdftTestInit(int startBin, int endBin, int numBatches)
+{
+    rPowerN = powf(SDFT_R, SDFT_SAMPLE_SIZE);
+    for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+        const float phi = 2.0f * M_PIf / (float)SDFT_SAMPLE_SIZE * i;
+        twiddle[i] = SDFT_R * (cos_approx(phi) + _Complex_I * sin_approx(phi));
+    }
+
+    sdftXYZInit(&sdft, startBin, endBin, numBatches);
+    for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+        sdftScalarInit(&reference[axis], startBin, endBin, numBatches);
+    }
+}
+
+int sdftTestBinCount(void)
+{
+    return SDFT_BIN_COUNT;
+}
+
+int sdftTestSampleSize(void)
+{
+    return SDFT_SAMPLE_SIZE;
+}
+
+void sdftTestPushBatch(const float *sample, int batchIdx)
+{
+    sdftXYZPushBatch(&sdft, sample, batchIdx);
+    for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+        sdftScalarPushBatch(&reference[axis], sample[axis], batchIdx);
+    }
+}
+
+// sdftXYZPush() is a push of all batches at once
+void sdftTestPush(const float *sample)
+{
+    sdftXYZPush(&sdft, sample);
+    for (int axis = 0; axis < SDFT_AXIS_COUNT; axis++) {
+        for (int batchIdx = 0; batchIdx < reference[axis].numBatches; batchIdx++) {
+            sdftScalarPushBatch(&reference[axis], sample[axis], batchIdx);
+        }
+    }
+}
+
+void sdftTestBins(int axis, float *re, float *im, float *referenceRe, float *referenceIm)
+{
+    for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+        re[i] = crealf(sdft.data[i][axis]);
+        im[i] = cimagf(sdft.data[i][axis]);
+        referenceRe[i] = crealf(reference[axis].data[i]);
+        referenceIm[i] = cimagf(reference[axis].data[i]);
+    }
+}
+
+void sdftTestWinSq(int axis, float *output, float *referenceOutput)
+{
+    sdftXYZWinSq(&sdft, axis, output);
+    sdftScalarWinSq(&reference[axis], referenceOutput);
+}
@@ -0,0 +1,608 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Offline replay of the gyro filter pipeline.
+//
+// Feeds a recorded gyro trace through the firmware filter code (RPM notches, static notches, LPF1,
+// dynamic notch and dynamic LPF) and reports per stage cost, delay and attenuation at a set of test
+// frequencies and the input/output spectrum.
+//
+// The trace is read from the CSV named by GYRO_REPLAY_CSV, as written by blackbox_decode. Columns are
+// matched by name: "time" for the loop time, "gyroUnfilt[0..2]" for the unfiltered gyro (or the field
+// named by GYRO_REPLAY_FIELD, e.g. "debug" for a log recorded with debug_mode = GYRO_SCALED),
+// "eRPM[0..3]" for the motor telemetry and "rcCommand[3]" for the throttle.
+// The filters run at the logged sample rate, so logs should be recorded with blackbox_sample_rate = 1/1.
+// Without a CSV a synthetic punch out (stick input, motor noise following a throttle ramp, a frame
+// resonance and white noise) is used.
+// If GYRO_REPLAY_SPECTRUM names a file the full spectrum is written to it as CSV.
+// The report is printed when a CSV is replayed, or for the synthetic trace if GYRO_REPLAY_REPORT is set.
+//
+//   GYRO_REPLAY_CSV=flight.csv GYRO_REPLAY_SPECTRUM=spectrum.csv make test_sensor_gyro_replay_unittest
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include <platform.h>
+
+    #include "build/build_config.h"
+    #include "build/debug.h"
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/time.h"
+    #include "drivers/accgyro/accgyro_fake.h"
+    #include "drivers/dshot.h"
+    #include "drivers/sensor.h"
+    #include "fc/core.h"
+    #include "flight/dyn_notch_filter.h"
+    #include "flight/mixer.h"
+    #include "flight/rpm_filter.h"
+    #include "io/beeper.h"
+    #include "pg/motor.h"
+    #include "pg/pg.h"
+    #include "scheduler/scheduler.h"
+    #include "sensors/gyro.h"
+    #include "sensors/gyro_init.h"
+    #include "sensors/sensors.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define REPLAY_MOTOR_COUNT          4
+#define REPLAY_MOTOR_POLES          14
+#define REPLAY_SETTLE_US            250000
+#define REPLAY_TONE_AMPLITUDE       50.0f
+#define REPLAY_SPECTRUM_STEP_HZ     10
+
+// as in mixer.c, the dynamic lowpass cutoffs follow the throttle in 1% steps at most every 5ms
+#define REPLAY_DYN_LPF_THROTTLE_STEPS   100
+#define REPLAY_DYN_LPF_UPDATE_DELAY_US  5000
+
+#define SYNTHETIC_LOOPTIME_US       125
+#define SYNTHETIC_DURATION_US       2000000
+
+typedef struct replaySample_s {
+    timeUs_t timeUs;
+    float gyro[XYZ_AXIS_COUNT];
+    uint16_t erpm[REPLAY_MOTOR_COUNT];  // eRPM / 100, as reported by getDshotTelemetry()
+    float throttle;                     // 0..1
+} replaySample_t;
+
+typedef struct replay_s {
+    std::string source;
+    timeDelta_t looptimeUs;
+    std::vector<replaySample_t> samples;
+} replay_t;
+
+static const replaySample_t *currentSample;
+
+static std::vector<std::string> splitCsvLine(const std::string &line)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    for (const char c : line) {
+        if (c == ',') {
+            fields.push_back(field);
+            field.clear();
+        } else if (c != '"' && c != '\r' && c != '\n') {
+            field += c;
+        }
+    }
+    fields.push_back(field);
+
+    for (std::string &f : fields) {
+        const size_t first = f.find_first_not_of(' ');
+        const size_t last = f.find_last_not_of(' ');
+        f = (first == std::string::npos) ? "" : f.substr(first, last - first + 1);
+    }
+    return fields;
+}
+
+// Column whose name starts with prefix and, if index >= 0, ends with "[index]"
+static int findCsvColumn(const std::vector<std::string> &header, const char *prefix, int index)
+{
+    const std::string suffix = index >= 0 ? "[" + std::to_string(index) + "]" : "";
+    for (size_t i = 0; i < header.size(); i++) {
+        const std::string &name = header[i];
+        if (name.compare(0, strlen(prefix), prefix) == 0
+            && name.size() >= suffix.size()
+            && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool loadReplayCsv(const char *path, replay_t *replay)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    char buf[4096];
+    while (fgets(buf, sizeof(buf), fp)) {
+        lines.push_back(buf);
+    }
+    fclose(fp);
+    if (lines.size() < 2) {
+        return false;
+    }
+
+    const std::vector<std::string> header = splitCsvLine(lines[0]);
+    const char *gyroField = getenv("GYRO_REPLAY_FIELD") ? getenv("GYRO_REPLAY_FIELD") : "gyroUnfilt";
+    const int timeColumn = findCsvColumn(header, "time", -1);
+    const int throttleColumn = findCsvColumn(header, "rcCommand", 3);
+    int gyroColumn[XYZ_AXIS_COUNT];
+    int erpmColumn[REPLAY_MOTOR_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroColumn[axis] = findCsvColumn(header, gyroField, axis);
+        if (gyroColumn[axis] < 0) {
+            return false;
+        }
+    }
+    for (int motor = 0; motor < REPLAY_MOTOR_COUNT; motor++) {
+        erpmColumn[motor] = findCsvColumn(header, "eRPM", motor);
+    }
+    if (timeColumn < 0) {
+        return false;
+    }
+
+    for (size_t i = 1; i < lines.size(); i++) {
+        const std::vector<std::string> row = splitCsvLine(lines[i]);
+        if (row.size() < header.size()) {
+            continue;
+        }
+        replaySample_t sample = {};
+        sample.timeUs = strtoul(row[timeColumn].c_str(), NULL, 10);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sample.gyro[axis] = strtof(row[gyroColumn[axis]].c_str(), NULL);
+        }
+        for (int motor = 0; motor < REPLAY_MOTOR_COUNT; motor++) {
+            sample.erpm[motor] = erpmColumn[motor] >= 0 ? strtoul(row[erpmColumn[motor]].c_str(), NULL, 10) : 0;
+        }
+        if (throttleColumn >= 0) {
+            sample.throttle = constrainf((strtof(row[throttleColumn].c_str(), NULL) - 1000.0f) / 1000.0f, 0.0f, 1.0f);
+        }
+        replay->samples.push_back(sample);
+    }
+    if (replay->samples.size() < 2) {
+        return false;
+    }
+
+    // the filters run at the logged rate, taken from the median sample interval
+    std::vector<timeDelta_t> intervals;
+    for (size_t i = 1; i < replay->samples.size(); i++) {
+        intervals.push_back(replay->samples[i].timeUs - replay->samples[i - 1].timeUs);
+    }
+    std::nth_element(intervals.begin(), intervals.begin() + intervals.size() / 2, intervals.end());
+    replay->looptimeUs = intervals[intervals.size() / 2];
+    replay->source = path;
+
+    return replay->looptimeUs > 0;
+}
+
+static uint32_t syntheticNoiseSeed = 1;
+
+static float syntheticNoise(void)
+{
+    syntheticNoiseSeed = syntheticNoiseSeed * 1664525 + 1013904223;
+    return (syntheticNoiseSeed >> 8) / (float)(1 << 24) - 0.5f;
+}
+
+// Punch out from 20% to 80% throttle: stick input, motor fundamentals and second harmonics following
+// the throttle, a fixed frame resonance and white noise.
+static void generateSyntheticReplay(replay_t *replay)
+{
+    float motorPhase[REPLAY_MOTOR_COUNT] = {};
+
+    replay->source = "synthetic";
+    replay->looptimeUs = SYNTHETIC_LOOPTIME_US;
+    syntheticNoiseSeed = 1;
+
+    for (timeUs_t t = 0; t < SYNTHETIC_DURATION_US; t += SYNTHETIC_LOOPTIME_US) {
+        const float seconds = t * 1e-6f;
+        replaySample_t sample = {};
+        sample.timeUs = t;
+        sample.throttle = 0.2f + 0.6f * seconds * 1e6f / SYNTHETIC_DURATION_US;
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sample.gyro[axis] = 150.0f * sin_approx(2 * M_PIf * 3.0f * seconds + axis)
+                + 15.0f * sin_approx(fmodf(2 * M_PIf * 180.0f * seconds, 2 * M_PIf) - M_PIf)
+                + 10.0f * syntheticNoise();
+        }
+        for (int motor = 0; motor < REPLAY_MOTOR_COUNT; motor++) {
+            const float motorHz = 80.0f + 300.0f * sample.throttle + 3.0f * motor;
+            motorPhase[motor] = fmodf(motorPhase[motor] + 2 * M_PIf * motorHz * SYNTHETIC_LOOPTIME_US * 1e-6f, 2 * M_PIf);
+            sample.erpm[motor] = lrintf(motorHz * 60.0f * (REPLAY_MOTOR_POLES / 2) / 100.0f);
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                const float phase = motorPhase[motor] + motor + axis;
+                sample.gyro[axis] += 20.0f * cosf(phase) + 10.0f * cosf(2 * phase);
+            }
+        }
+        replay->samples.push_back(sample);
+    }
+}
+
+// Quiet in a normal test run, see above
+#define REPLAY_REPORT(...) do { if (getenv("GYRO_REPLAY_CSV") || getenv("GYRO_REPLAY_REPORT")) { printf(__VA_ARGS__); } } while (0)
+
+static const replay_t &getReplay(void)
+{
+    static replay_t replay;
+    if (replay.samples.empty()) {
+        const char *path = getenv("GYRO_REPLAY_CSV");
+        if (path && !loadReplayCsv(path, &replay)) {
+            printf("[  REPLAY  ] could not read %s, using synthetic data\n", path);
+            replay = replay_t();
+        }
+        if (replay.samples.empty()) {
+            generateSyntheticReplay(&replay);
+        }
+        REPLAY_REPORT("[  REPLAY  ] %s: %u samples at %dus\n", replay.source.c_str(), (unsigned)replay.samples.size(), replay.looptimeUs);
+    }
+    return replay;
+}
+
+static int dynLpfPreviousQuantizedThrottle;
+static timeUs_t dynLpfLastUpdateUs;
+
+static void replayInitFilters(timeDelta_t looptimeUs)
+{
+    pgResetAll();
+    motorConfigMutable()->dev.useDshotTelemetry = true;
+    motorConfigMutable()->motorPoleCount = REPLAY_MOTOR_POLES;
+
+    gyroInit();
+    gyro.sampleRateHz = 1e6f / looptimeUs;
+    gyroSetTargetLooptime(1);
+    gyroInitFilters();
+    rpmFilterInit(rpmFilterConfig());
+
+    dynLpfPreviousQuantizedThrottle = -1;
+    dynLpfLastUpdateUs = 0;
+}
+
+static void replayUpdateDynLpf(const replaySample_t *sample)
+{
+    if (cmpTimeUs(sample->timeUs, dynLpfLastUpdateUs) >= REPLAY_DYN_LPF_UPDATE_DELAY_US) {
+        const int quantizedThrottle = lrintf(sample->throttle * REPLAY_DYN_LPF_THROTTLE_STEPS);
+        if (quantizedThrottle != dynLpfPreviousQuantizedThrottle) {
+            dynLpfGyroUpdate((float)quantizedThrottle / REPLAY_DYN_LPF_THROTTLE_STEPS);
+            dynLpfPreviousQuantizedThrottle = quantizedThrottle;
+            dynLpfLastUpdateUs = sample->timeUs;
+        }
+    }
+}
+
+// One pid loop with the gyro sampled at the pid rate: the sample queued as gyroUpdate() would, then gyroFiltering()
+static void replayLoop(const replaySample_t *sample, const float *input, float *output)
+{
+    currentSample = sample;
+    replayUpdateDynLpf(sample);
+    rpmFilterUpdate();
+
+    gyroRingPush(&gyro.sampleRing, sample->timeUs, input);
+    gyroFiltering(sample->timeUs);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        output[axis] = gyro.gyroADCf[axis];
+    }
+}
+
+static std::vector<float> replayInput(const replay_t &replay, float toneHz)
+{
+    std::vector<float> input(replay.samples.size() * XYZ_AXIS_COUNT);
+    for (size_t i = 0; i < replay.samples.size(); i++) {
+        const float tone = toneHz > 0 ? REPLAY_TONE_AMPLITUDE * sinf(2 * M_PIf * toneHz * i * replay.looptimeUs * 1e-6f) : 0.0f;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            input[i * XYZ_AXIS_COUNT + axis] = replay.samples[i].gyro[axis] + tone;
+        }
+    }
+    return input;
+}
+
+static std::vector<float> replayRun(const replay_t &replay, const std::vector<float> &input, double *nsPerLoop)
+{
+    std::vector<float> output(input.size());
+
+    replayInitFilters(replay.looptimeUs);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < replay.samples.size(); i++) {
+        replayLoop(&replay.samples[i], &input[i * XYZ_AXIS_COUNT], &output[i * XYZ_AXIS_COUNT]);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    if (nsPerLoop) {
+        *nsPerLoop = std::chrono::duration<double, std::nano>(end - start).count() / replay.samples.size();
+    }
+
+    return output;
+}
+
+typedef enum {
+    REPLAY_STAGE_DOWNSAMPLE = 0,
+    REPLAY_STAGE_RPM,
+    REPLAY_STAGE_NOTCH1,
+    REPLAY_STAGE_NOTCH2,
+    REPLAY_STAGE_LPF1,
+    REPLAY_STAGE_DYN_NOTCH,
+    REPLAY_STAGE_COUNT
+} replayStage_e;
+
+static const char * const replayStageNames[REPLAY_STAGE_COUNT] = {
+    "downsample", "rpm filter", "notch1", "notch2", "lpf1 + dyn lpf", "dyn notch",
+};
+
+// Runs each stage of the pipeline over the whole trace in turn, in place, timing it separately.
+// The stages keep no state between each other, so the result is the same as running the pipeline
+// sample by sample.
+static void replayRunStages(const replay_t &replay, float *data, double *nsPerSample)
+{
+    const size_t count = replay.samples.size();
+
+    replayInitFilters(replay.looptimeUs);
+
+    for (int stage = 0; stage < REPLAY_STAGE_COUNT; stage++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++) {
+            float *xyz = &data[i * XYZ_AXIS_COUNT];
+            currentSample = &replay.samples[i];
+
+            switch (stage) {
+            case REPLAY_STAGE_DOWNSAMPLE:
+                if (gyro.downsampleFilterEnabled) {
+                    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                        xyz[axis] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[axis], xyz[axis]);
+                    }
+                }
+                break;
+            case REPLAY_STAGE_RPM:
+                rpmFilterUpdate();
+                rpmFilterGyro(xyz);
+                break;
+            case REPLAY_STAGE_NOTCH1:
+                for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                    xyz[axis] = gyro.notchFilter1ApplyFn((filter_t *)&gyro.notchFilter1[axis], xyz[axis]);
+                }
+                break;
+            case REPLAY_STAGE_NOTCH2:
+                for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                    xyz[axis] = gyro.notchFilter2ApplyFn((filter_t *)&gyro.notchFilter2[axis], xyz[axis]);
+                }
+                break;
+            case REPLAY_STAGE_LPF1:
+                replayUpdateDynLpf(currentSample);
+                for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                    xyz[axis] = gyro.lowpassFilterApplyFn((filter_t *)&gyro.lowpassFilter[axis], xyz[axis]);
+                }
+                break;
+            case REPLAY_STAGE_DYN_NOTCH:
+                if (isDynNotchActive()) {
+                    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                        dynNotchPush(axis, xyz[axis]);
+                        xyz[axis] = dynNotchFilter(axis, xyz[axis]);
+                    }
+                    dynNotchUpdate();
+                }
+                break;
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        nsPerSample[stage] = std::chrono::duration<double, std::nano>(end - start).count() / count;
+    }
+}
+
+typedef struct toneResponse_s {
+    float gainDb;
+    float delayMs;
+} toneResponse_t;
+
+// Gain and delay at toneHz from the I/Q demodulation of the output against the injected tone,
+// the replayed signal is uncorrelated with the tone and averages out
+static toneResponse_t measureToneResponse(const replay_t &replay, float toneHz, int axis)
+{
+    const std::vector<float> input = replayInput(replay, toneHz);
+    const std::vector<float> baseline = replayRun(replay, replayInput(replay, 0), NULL);
+    const std::vector<float> output = replayRun(replay, input, NULL);
+
+    const size_t settle = std::min<size_t>(REPLAY_SETTLE_US / replay.looptimeUs, replay.samples.size() / 2);
+    const float dT = replay.looptimeUs * 1e-6f;
+    const size_t periodSamples = lrintf(1.0f / (toneHz * dT));
+    const size_t count = (replay.samples.size() - settle) / periodSamples * periodSamples;
+
+    double i = 0, q = 0;
+    for (size_t n = settle; n < settle + count; n++) {
+        // remove the response to the replayed signal so only the tone is left
+        const double y = output[n * XYZ_AXIS_COUNT + axis] - baseline[n * XYZ_AXIS_COUNT + axis];
+        const double phase = 2 * M_PI * toneHz * n * dT;
+        i += y * sin(phase);
+        q += y * cos(phase);
+    }
+    const double gain = 2 * sqrt(i * i + q * q) / count / REPLAY_TONE_AMPLITUDE;
+    double lag = atan2(-q, i);
+    if (lag < 0) {
+        lag += 2 * M_PI;
+    }
+
+    toneResponse_t response;
+    response.gainDb = 20 * log10(gain);
+    response.delayMs = 1000 * lag / (2 * M_PI * toneHz);
+    return response;
+}
+
+// Hann windowed amplitude at freqHz, Goertzel
+static float spectrumAmplitude(const std::vector<float> &data, int axis, size_t start, size_t count, float freqHz, float dT)
+{
+    const double coeff = 2 * cos(2 * M_PI * freqHz * dT);
+    double s1 = 0, s2 = 0;
+    for (size_t n = 0; n < count; n++) {
+        const double window = 0.5 - 0.5 * cos(2 * M_PI * n / count);
+        const double s0 = window * data[(start + n) * XYZ_AXIS_COUNT + axis] + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    const double power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+    return 4 * sqrt(fmax(power, 0)) / count;
+}
+
+static float amplitudeDb(float amplitude)
+{
+    return 20 * log10f(fmaxf(amplitude, 1e-6f));
+}
+
+TEST(SensorGyroReplay, StagesMatchGyroFiltering)
+{
+    const replay_t &replay = getReplay();
+    const std::vector<float> input = replayInput(replay, 0);
+
+    double nsPerLoop;
+    const std::vector<float> output = replayRun(replay, input, &nsPerLoop);
+
+    std::vector<float> staged = input;
+    double nsPerStage[REPLAY_STAGE_COUNT];
+    replayRunStages(replay, staged.data(), nsPerStage);
+
+    for (size_t i = 0; i < output.size(); i++) {
+        ASSERT_FLOAT_EQ(output[i], staged[i]) << "sample " << i / XYZ_AXIS_COUNT << " axis " << i % XYZ_AXIS_COUNT;
+    }
+
+    REPLAY_REPORT("[  REPLAY  ] gyroFiltering + rpmFilterUpdate: %.1fns/loop\n", nsPerLoop);
+    for (int stage = 0; stage < REPLAY_STAGE_COUNT; stage++) {
+        REPLAY_REPORT("[  REPLAY  ]   %-16s %8.1fns/loop\n", replayStageNames[stage], nsPerStage[stage]);
+    }
+}
+
+TEST(SensorGyroReplay, DelayAndAttenuation)
+{
+    const replay_t &replay = getReplay();
+    const float nyquistHz = 0.5e6f / replay.looptimeUs;
+    static const float toneHz[] = { 20, 50, 80, 100, 150, 200, 300 };
+
+    REPLAY_REPORT("[  REPLAY  ] %8s %10s %10s\n", "Hz", "gain dB", "delay ms");
+    for (unsigned i = 0; i < ARRAYLEN(toneHz); i++) {
+        if (toneHz[i] >= nyquistHz) {
+            break;
+        }
+        const toneResponse_t response = measureToneResponse(replay, toneHz[i], FD_ROLL);
+        REPLAY_REPORT("[  REPLAY  ] %8.0f %10.2f %10.3f\n", toneHz[i], response.gainDb, response.delayMs);
+
+        if (toneHz[i] == 20) {
+            // well below every filter cutoff: passed with a small delay
+            EXPECT_GT(response.gainDb, -3.0f);
+            EXPECT_LT(response.gainDb, 1.0f);
+            EXPECT_GT(response.delayMs, 0.0f);
+            EXPECT_LT(response.delayMs, 5.0f);
+        }
+    }
+}
+
+TEST(SensorGyroReplay, Spectrum)
+{
+    const replay_t &replay = getReplay();
+    const std::vector<float> input = replayInput(replay, 0);
+    const std::vector<float> output = replayRun(replay, input, NULL);
+
+    const float dT = replay.looptimeUs * 1e-6f;
+    const float nyquistHz = 0.5f / dT;
+    const size_t settle = std::min<size_t>(REPLAY_SETTLE_US / replay.looptimeUs, replay.samples.size() / 2);
+    const size_t count = replay.samples.size() - settle;
+
+    const char *spectrumPath = getenv("GYRO_REPLAY_SPECTRUM");
+    FILE *fp = spectrumPath ? fopen(spectrumPath, "w") : NULL;
+    if (fp) {
+        fprintf(fp, "freq,inRoll,inPitch,inYaw,outRoll,outPitch,outYaw\n");
+    }
+
+    double inputNoise = 0;
+    double outputNoise = 0;
+    REPLAY_REPORT("[  REPLAY  ] %8s %10s %10s  (roll, dB)\n", "Hz", "input", "output");
+    for (int freqHz = REPLAY_SPECTRUM_STEP_HZ; freqHz < nyquistHz; freqHz += REPLAY_SPECTRUM_STEP_HZ) {
+        float in[XYZ_AXIS_COUNT];
+        float out[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            in[axis] = spectrumAmplitude(input, axis, settle, count, freqHz, dT);
+            out[axis] = spectrumAmplitude(output, axis, settle, count, freqHz, dT);
+            if (freqHz >= 100) {
+                inputNoise += sq(in[axis]);
+                outputNoise += sq(out[axis]);
+            }
+        }
+        if (fp) {
+            fprintf(fp, "%d,%f,%f,%f,%f,%f,%f\n", freqHz,
+                amplitudeDb(in[FD_ROLL]), amplitudeDb(in[FD_PITCH]), amplitudeDb(in[FD_YAW]),
+                amplitudeDb(out[FD_ROLL]), amplitudeDb(out[FD_PITCH]), amplitudeDb(out[FD_YAW]));
+        }
+        if (freqHz % 50 == 0 && freqHz <= 1000) {
+            REPLAY_REPORT("[  REPLAY  ] %8d %10.1f %10.1f\n", freqHz, amplitudeDb(in[FD_ROLL]), amplitudeDb(out[FD_ROLL]));
+        }
+    }
+    if (fp) {
+        fclose(fp);
+    }
+
+    const float noiseReductionDb = 10 * log10(inputNoise / fmax(outputNoise, 1e-12));
+    REPLAY_REPORT("[  REPLAY  ] noise above 100Hz reduced by %.1fdB\n", noiseReductionDb);
+
+    if (replay.source == "synthetic") {
+        // the motor noise and the resonance are well inside the reach of the rpm and dynamic notches
+        EXPECT_GT(noiseReductionDb, 10.0f);
+    }
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) {return 0;}
+void beeper(beeperMode_e) {}
+uint8_t detectedSensors[] = { GYRO_NONE, ACC_NONE };
+timeDelta_t getGyroUpdateRate(void) {return gyro.targetLooptime;}
+void sensorsSet(uint32_t) {}
+void schedulerResetTaskStatistics(taskId_e) {}
+int getArmingDisableFlags(void) {return 0;}
+void writeEEPROM(void) {}
+uint8_t getMotorCount(void) {return REPLAY_MOTOR_COUNT;}
+uint16_t getDshotTelemetry(uint8_t index) {return currentSample ? currentSample->erpm[index] : 0;}
+uint8_t calculateThrottlePercentAbs(void) {return currentSample ? lrintf(currentSample->throttle * 100) : 0;}
+
+// as in pid.c
+float dynLpfCutoffFreq(float throttle, uint16_t dynLpfMin, uint16_t dynLpfMax, uint8_t expo)
+{
+    const float expof = expo / 10.0f;
+    const float curve = throttle * (1 - throttle) * expof + throttle;
+    return (dynLpfMax - dynLpfMin) * curve + dynLpfMin;
+}
+}
@@ -20,6 +20,7 @@
 
 #include <limits.h>
 #include <algorithm>
+#include <thread>
 
 extern "C" {
     #include <platform.h>
@@ -38,6 +39,7 @@ extern "C" {
     #include "scheduler/scheduler.h"
     #include "sensors/gyro.h"
     #include "sensors/gyro_init.h"
+    #include "sensors/gyro_ring.h"
     #include "sensors/acceleration.h"
     #include "sensors/sensors.h"
 
@@ -45,6 +47,9 @@ extern "C" {
     struct gyroSensor_s;
     STATIC_UNIT_TESTED void performGyroCalibration(struct gyroSensor_s *gyroSensor, uint8_t gyroMovementCalibrationThreshold);
     STATIC_UNIT_TESTED bool fakeGyroRead(gyroDev_t *gyro);
+    STATIC_UNIT_TESTED void filterGyro(void);
+    STATIC_UNIT_TESTED void filterGyroLpf1None(void);
+    STATIC_UNIT_TESTED void filterGyroLpf1Pt1(void);
 
     uint8_t debugMode;
     int16_t debug[DEBUG16_VALUE_COUNT];
@@ -127,10 +132,10 @@ TEST(SensorGyro, Update)
     EXPECT_FALSE(gyroIsCalibrationComplete());
 
     fakeGyroSet(gyroDevPtr, 5, 6, 7);
-    gyroUpdate();
+    gyroUpdate(0);
     while (!gyroIsCalibrationComplete()) {
         fakeGyroSet(gyroDevPtr, 5, 6, 7);
-        gyroUpdate();
+        gyroUpdate(0);
     }
     EXPECT_TRUE(gyroIsCalibrationComplete());
     EXPECT_EQ(5, gyroDevPtr->gyroZero[X]);
@@ -139,18 +144,187 @@ TEST(SensorGyro, Update)
     EXPECT_FLOAT_EQ(0, gyro.gyroADCf[X]);
     EXPECT_FLOAT_EQ(0, gyro.gyroADCf[Y]);
     EXPECT_FLOAT_EQ(0, gyro.gyroADCf[Z]);
-    gyroUpdate();
+    gyroUpdate(0);
     // expect zero values since gyro is calibrated
     EXPECT_FLOAT_EQ(0, gyro.gyroADCf[X]);
     EXPECT_FLOAT_EQ(0, gyro.gyroADCf[Y]);
     EXPECT_FLOAT_EQ(0, gyro.gyroADCf[Z]);
     fakeGyroSet(gyroDevPtr, 15, 26, 97);
-    gyroUpdate();
+    gyroUpdate(0);
     EXPECT_NEAR(10 * gyroDevPtr->scale, gyro.gyroADC[X], 1e-3); // gyro.gyroADC values are scaled
     EXPECT_NEAR(20 * gyroDevPtr->scale, gyro.gyroADC[Y], 1e-3);
     EXPECT_NEAR(90 * gyroDevPtr->scale, gyro.gyroADC[Z], 1e-3);
 }
 
+typedef void (*filterGyroFn)(void);
+
+static void initFilterPipeline(uint16_t lpf1Hz, uint16_t lpf2Hz, uint16_t notch1Hz)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lpf1_type = FILTER_PT1;
+    gyroConfigMutable()->gyro_lpf1_static_hz = lpf1Hz;
+    gyroConfigMutable()->gyro_lpf1_dyn_min_hz = 0;
+    gyroConfigMutable()->gyro_lpf2_type = FILTER_PT1;
+    gyroConfigMutable()->gyro_lpf2_static_hz = lpf2Hz;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = notch1Hz;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_1 = notch1Hz / 2;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    gyroInit();
+    gyroSetTargetLooptime(1);
+    gyroInitFilters();
+}
+
+// runs the given pipeline over a fixed input, two samples per loop, and returns the sum of the filtered output
+static float runFilterPipeline(filterGyroFn fn, int iterations)
+{
+    const gyro_t initialState = gyro;
+    float sum = 0.0f;
+
+    for (int n = 0; n < iterations; n++) {
+        for (int i = 0; i < 2; i++) {
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                gyro.samples[i].adc[axis] = 100.0f * (((2 * n + i) * (axis + 3)) % 17) - 800.0f;
+            }
+        }
+        gyro.sampleCount = 2;
+        fn();
+        sum += gyro.gyroADCf[X] + gyro.gyroADCf[Y] + gyro.gyroADCf[Z];
+    }
+
+    gyro = initialState;
+    return sum;
+}
+
+TEST(SensorGyro, FilterPipelineMatchesGeneric)
+{
+    const int iterations = 2000;
+
+    // LPF1 PT1, LPF2 PT1 downsampling, static notches off (defaults with RPM filtering)
+    initFilterPipeline(250, 500, 0);
+    EXPECT_TRUE(gyro.downsampleFilterEnabled);
+    EXPECT_FLOAT_EQ(runFilterPipeline(filterGyro, iterations), runFilterPipeline(filterGyroLpf1Pt1, iterations));
+
+    // LPF1 PT1, downsampling by averaging
+    initFilterPipeline(250, 0, 0);
+    EXPECT_FALSE(gyro.downsampleFilterEnabled);
+    EXPECT_FLOAT_EQ(runFilterPipeline(filterGyro, iterations), runFilterPipeline(filterGyroLpf1Pt1, iterations));
+
+    // LPF1 off, LPF2 PT1 downsampling
+    initFilterPipeline(0, 500, 0);
+    EXPECT_FLOAT_EQ(runFilterPipeline(filterGyro, iterations), runFilterPipeline(filterGyroLpf1None, iterations));
+
+    // all static filters off
+    initFilterPipeline(0, 0, 0);
+    EXPECT_FLOAT_EQ(runFilterPipeline(filterGyro, iterations), runFilterPipeline(filterGyroLpf1None, iterations));
+}
+
+TEST(SensorGyro, UpdateQueuesSamplesForFiltering)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lpf1_static_hz = 0;
+    gyroConfigMutable()->gyro_lpf1_dyn_min_hz = 0;
+    gyroConfigMutable()->gyro_lpf2_static_hz = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    gyroInit();
+    gyroSetTargetLooptime(2);
+    gyroInitFilters();
+    gyroDevPtr->readFn = fakeGyroRead;
+    gyroDevPtr->gyroZero[X] = gyroDevPtr->gyroZero[Y] = gyroDevPtr->gyroZero[Z] = 0;
+    gyroSensorPtr->calibration.cyclesRemaining = 0;
+
+    fakeGyroSet(gyroDevPtr, 10, 20, 30);
+    gyroUpdate(100);
+    fakeGyroSet(gyroDevPtr, 30, 40, 50);
+    gyroUpdate(225);
+    EXPECT_EQ(2u, gyroRingCount(&gyro.sampleRing));
+
+    // both samples are averaged by the filter task
+    gyroFiltering(250);
+    EXPECT_EQ(0u, gyroRingCount(&gyro.sampleRing));
+    EXPECT_EQ(2, gyro.sampleCount);
+    EXPECT_EQ(100u, gyro.samples[0].timeUs);
+    EXPECT_EQ(225u, gyro.samples[1].timeUs);
+    EXPECT_NEAR(20 * gyroDevPtr->scale, gyro.gyroADCf[X], 1e-3);
+    EXPECT_NEAR(30 * gyroDevPtr->scale, gyro.gyroADCf[Y], 1e-3);
+    EXPECT_NEAR(40 * gyroDevPtr->scale, gyro.gyroADCf[Z], 1e-3);
+
+    // nothing new queued, the last value is held
+    gyroFiltering(375);
+    EXPECT_EQ(0, gyro.sampleCount);
+    EXPECT_NEAR(20 * gyroDevPtr->scale, gyro.gyroADCf[X], 1e-3);
+}
+
+TEST(SensorGyro, RingWrapsAndDropsWhenFull)
+{
+    gyroRing_t ring;
+    gyroSample_t samples[GYRO_RING_SIZE];
+    gyroRingInit(&ring);
+
+    // offset the indices so the ring wraps part way through
+    for (int n = 0; n < GYRO_RING_SIZE / 2 + 3; n++) {
+        const float adc[XYZ_AXIS_COUNT] = { (float)n, 0, 0 };
+        EXPECT_TRUE(gyroRingPush(&ring, n, adc));
+    }
+    EXPECT_EQ(GYRO_RING_SIZE / 2 + 3u, gyroRingRead(&ring, samples, GYRO_RING_SIZE));
+
+    for (int n = 0; n < GYRO_RING_SIZE + 2; n++) {
+        const float adc[XYZ_AXIS_COUNT] = { (float)n, (float)-n, (float)(2 * n) };
+        EXPECT_EQ(n < GYRO_RING_SIZE, gyroRingPush(&ring, 1000 + n, adc));
+    }
+    EXPECT_EQ((uint32_t)GYRO_RING_SIZE, gyroRingCount(&ring));
+    EXPECT_EQ(2u, ring.overruns);
+
+    // read in two batches, oldest first
+    EXPECT_EQ(5u, gyroRingRead(&ring, samples, 5));
+    EXPECT_EQ(1000u, samples[0].timeUs);
+    EXPECT_EQ(1004u, samples[4].timeUs);
+    EXPECT_EQ(GYRO_RING_SIZE - 5u, gyroRingRead(&ring, samples, GYRO_RING_SIZE));
+    for (int n = 0; n < GYRO_RING_SIZE - 5; n++) {
+        EXPECT_EQ(1005u + n, samples[n].timeUs);
+        EXPECT_FLOAT_EQ(5.0f + n, samples[n].adc[X]);
+        EXPECT_FLOAT_EQ(-5.0f - n, samples[n].adc[Y]);
+        EXPECT_FLOAT_EQ(10.0f + 2 * n, samples[n].adc[Z]);
+    }
+    EXPECT_EQ(0u, gyroRingRead(&ring, samples, GYRO_RING_SIZE));
+}
+
+TEST(SensorGyro, RingProducerThread)
+{
+    // as in SITL, samples pushed from another thread arrive complete and in order
+    static gyroRing_t ring;
+    const uint32_t count = 20000;
+    gyroRingInit(&ring);
+
+    std::thread producer([&]() {
+        for (uint32_t n = 0; n < count; n++) {
+            const float adc[XYZ_AXIS_COUNT] = { (float)n, (float)n, (float)n };
+            while (!gyroRingPush(&ring, n, adc)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    gyroSample_t samples[GYRO_RING_SIZE];
+    uint32_t expected = 0;
+    bool consistent = true;
+    while (expected < count) {
+        const uint32_t read = gyroRingRead(&ring, samples, GYRO_RING_SIZE);
+        if (read == 0) {
+            std::this_thread::yield();
+        }
+        for (uint32_t i = 0; i < read; i++) {
+            consistent &= samples[i].timeUs == expected;
+            consistent &= samples[i].adc[X] == (float)expected && samples[i].adc[Z] == (float)expected;
+            expected++;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(count, expected);
+}
+
 // STUBS
 
 extern "C" {
@@ -145,7 +145,9 @@ extern "C" {
     void writeServos(void) {};
     bool calculateRxChannelsAndUpdateFailsafe(timeUs_t) { return true; }
     bool isMixerUsingServos(void) { return false; }
-    void gyroUpdate() {}
+    void gyroUpdate(timeUs_t) {}
+    uint32_t gyroRingCount(const gyroRing_t *) { return 0; }
+    gyro_t gyro;
     timeDelta_t getTaskDeltaTimeUs(taskId_e) { return 0; }
     void updateRSSI(timeUs_t) {}
     bool failsafeIsMonitoring(void) { return false; }
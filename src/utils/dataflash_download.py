@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+#
+# Download the contents of the dataflash using MSP2_DATAFLASH_STREAM, and report how fast it went.
+#
+# The flight controller pushes chunks, each with a sequence number, up to a window ahead of the last one
+# acknowledged. We acknowledge the next chunk we expect every half window, as the flight controller only handles
+# one command each time its serial task runs, and if we see a gap ask for everything from there to be sent again.
+#
+# By default this talks to SITL, where UART1 is on TCP port 5761 and the flash is kept in flash.bin.
+# With --compare the same range is also downloaded with MSP_DATAFLASH_READ, one chunk per request, for comparison.
+#
+# Usage: dataflash_download.py [options] <output>
+
+import argparse
+import os
+import re
+import socket
+import struct
+import sys
+import time
+
+MSP_DATAFLASH_SUMMARY = 70
+MSP_DATAFLASH_READ = 71
+MSP2_DATAFLASH_STREAM = 0x300B
+
+STREAM_START = 0
+STREAM_ACK = 1
+STREAM_STOP = 2
+
+ACK_FLAG_RESEND = 1 << 0
+
+NO_COMPRESSION = 0
+HUFFMAN = 1
+
+RESEND_TIMEOUT_S = 2
+
+HUFFMAN_TABLE_C = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'main', 'common', 'huffman_table.c')
+
+
+def crc8_dvb_s2_table():
+    table = []
+    for crc in range(256):
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0xD5) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+        table.append(crc)
+    return table
+
+
+CRC8_DVB_S2_TABLE = crc8_dvb_s2_table()
+
+
+def crc8_dvb_s2(crc, data):
+    for byte in data:
+        crc = CRC8_DVB_S2_TABLE[crc ^ byte]
+    return crc
+
+
+class MspError(Exception):
+    pass
+
+
+class Msp:
+    def __init__(self, host, port):
+        self.sock = socket.create_connection((host, port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.buf = bytearray()
+
+    def send(self, cmd, payload=b''):
+        frame = struct.pack('<BHH', 0, cmd, len(payload)) + payload
+        self.sock.sendall(b'$X<' + frame + bytes([crc8_dvb_s2(0, frame)]))
+
+    def receive(self, timeout=None):
+        """Returns (cmd, payload) of the next MSPv2 frame, or None if nothing arrives within timeout."""
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            start = self.buf.find(b'$X')
+            if start < 0:
+                del self.buf[:max(len(self.buf) - 1, 0)]
+            else:
+                del self.buf[:start]
+                if len(self.buf) >= 8:
+                    direction = self.buf[2:3]
+                    _, cmd, length = struct.unpack_from('<BHH', self.buf, 3)
+                    if len(self.buf) >= 9 + length:
+                        frame = bytes(self.buf[3:8 + length])
+                        crc = self.buf[8 + length]
+                        del self.buf[:9 + length]
+                        if crc != crc8_dvb_s2(0, frame):
+                            continue
+                        if direction == b'!':
+                            raise MspError('command %d failed' % cmd)
+                        return cmd, frame[5:]
+
+            if deadline is None:
+                self.sock.settimeout(None)
+            else:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    return None
+                self.sock.settimeout(remaining)
+            try:
+                data = self.sock.recv(65536)
+            except socket.timeout:
+                return None
+            if not data:
+                raise MspError('connection closed')
+            self.buf += data
+
+    def request(self, cmd, payload=b''):
+        self.send(cmd, payload)
+        while True:
+            reply = self.receive(timeout=2)
+            if reply is None:
+                raise MspError('no reply to command %d' % cmd)
+            if reply[0] == cmd:
+                return reply[1]
+
+
+class HuffmanDecoder:
+    def __init__(self, path=HUFFMAN_TABLE_C):
+        entries = re.findall(r'\{\s*(\d+),\s*0x([0-9A-Fa-f]+)\s*\}', open(path).read())
+        # The last entry is EOF, which the flight controller never sends
+        self.codes = {(int(length), int(code, 16) >> (16 - int(length))): char
+                      for char, (length, code) in enumerate(entries[:256])}
+
+    def decode(self, data, count):
+        out = bytearray()
+        if not count:
+            return bytes(out)
+        code = 0
+        length = 0
+        for byte in data:
+            for bit in range(7, -1, -1):
+                code = (code << 1) | ((byte >> bit) & 1)
+                length += 1
+                char = self.codes.get((length, code))
+                if char is not None:
+                    out.append(char)
+                    if len(out) == count:
+                        return bytes(out)
+                    code = 0
+                    length = 0
+        raise ValueError('compressed chunk is short')
+
+
+def decode_chunk(payload, huffman):
+    """Decodes the body of an MSP_DATAFLASH_READ reply, returning (address, data)."""
+    address, size, compression = struct.unpack_from('<IHB', payload)
+    body = payload[7:7 + size]
+    if compression == NO_COMPRESSION:
+        return address, body
+    if compression == HUFFMAN:
+        count, = struct.unpack_from('<H', body)
+        return address, huffman.decode(body[2:], count)
+    raise MspError('unknown compression %d' % compression)
+
+
+def summary(msp):
+    flags, sectors, total_size, used_size = struct.unpack('<BIII', msp.request(MSP_DATAFLASH_SUMMARY))
+    if not flags & 2:
+        raise MspError('no dataflash')
+    return total_size, used_size
+
+
+def stream(msp, address, length, chunk_size, window, compress, huffman):
+    # Get rid of anything left over from an earlier download, the reply to STOP is the only empty one
+    msp.send(MSP2_DATAFLASH_STREAM, struct.pack('<B', STREAM_STOP))
+    while True:
+        reply = msp.receive(timeout=2)
+        if reply is None:
+            raise MspError('no reply to stop')
+        if reply == (MSP2_DATAFLASH_STREAM, b''):
+            break
+
+    reply = msp.request(MSP2_DATAFLASH_STREAM,
+                        struct.pack('<BIIHBB', STREAM_START, address, length, chunk_size, window, int(compress)))
+    address, length, chunk_size, window, compression = struct.unpack('<IIHBB', reply)
+
+    data = bytearray()
+    expected_seq = 0
+    acked_seq = 0
+    resends = 0
+    resend_requested = False
+    while len(data) < length:
+        frame = msp.receive(timeout=RESEND_TIMEOUT_S)
+        if frame is None or frame[0] != MSP2_DATAFLASH_STREAM:
+            if frame is None:
+                # Lost the end of the window
+                msp.send(MSP2_DATAFLASH_STREAM, struct.pack('<BHB', STREAM_ACK, expected_seq, ACK_FLAG_RESEND))
+                resends += 1
+            continue
+
+        seq, = struct.unpack_from('<H', frame[1])
+        if seq != expected_seq:
+            # A chunk went missing, wait for the stale ones to go past after asking for it again
+            if not resend_requested:
+                msp.send(MSP2_DATAFLASH_STREAM, struct.pack('<BHB', STREAM_ACK, expected_seq, ACK_FLAG_RESEND))
+                resend_requested = True
+                resends += 1
+            continue
+
+        chunk_address, chunk = decode_chunk(frame[1][2:], huffman)
+        if chunk_address != address + len(data):
+            raise MspError('chunk %d is at 0x%x, expected 0x%x' % (seq, chunk_address, address + len(data)))
+        if not chunk:
+            break
+        data += chunk
+        expected_seq = (expected_seq + 1) & 0xFFFF
+        resend_requested = False
+        if (expected_seq - acked_seq) & 0xFFFF >= max(window // 2, 1) or len(data) >= length:
+            msp.send(MSP2_DATAFLASH_STREAM, struct.pack('<BHB', STREAM_ACK, expected_seq, 0))
+            acked_seq = expected_seq
+
+    return bytes(data), compression, window, resends
+
+
+def read(msp, address, length, chunk_size, compress, huffman):
+    data = bytearray()
+    while len(data) < length:
+        reply = msp.request(MSP_DATAFLASH_READ, struct.pack('<IHB', address + len(data), chunk_size, int(compress)))
+        _, chunk = decode_chunk(reply, huffman)
+        if not chunk and compress:
+            # Too small a chunk for the first block to compress into
+            reply = msp.request(MSP_DATAFLASH_READ, struct.pack('<IHB', address + len(data), chunk_size, 0))
+            _, chunk = decode_chunk(reply, huffman)
+        if not chunk:
+            break
+        data += chunk[:length - len(data)]
+    return bytes(data)
+
+
+def report(name, length, elapsed):
+    print('%s: %d bytes in %.2f s, %.3f MB/s' % (name, length, elapsed, length / elapsed / 1e6 if elapsed else 0))
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Download the dataflash with MSP2_DATAFLASH_STREAM')
+    parser.add_argument('output', help='file to write the flash contents to')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=5761)
+    parser.add_argument('--address', type=lambda x: int(x, 0), default=0)
+    parser.add_argument('--length', type=lambda x: int(x, 0),
+                        help='bytes to download, by default everything used on the volume')
+    parser.add_argument('--chunk', type=int, default=4096, help='largest chunk to ask for')
+    parser.add_argument('--window', type=int, default=16, help='chunks in flight before waiting for an ack')
+    parser.add_argument('--compress', action='store_true', help='Huffman compress the chunks')
+    parser.add_argument('--compare', action='store_true', help='also time MSP_DATAFLASH_READ for the same range')
+    args = parser.parse_args(argv[1:])
+
+    msp = Msp(args.host, args.port)
+    huffman = HuffmanDecoder()
+
+    total_size, used_size = summary(msp)
+    length = args.length if args.length is not None else used_size - args.address
+    print('flash: %d bytes, %d used' % (total_size, used_size))
+
+    start = time.monotonic()
+    data, compression, window, resends = stream(msp, args.address, length, args.chunk, args.window, args.compress,
+                                                huffman)
+    report('stream (window %d, %s, %d resends)' % (window, 'huffman' if compression == HUFFMAN else 'uncompressed',
+                                                  resends), len(data), time.monotonic() - start)
+    with open(args.output, 'wb') as f:
+        f.write(data)
+
+    if args.compare:
+        start = time.monotonic()
+        read_data = read(msp, args.address, len(data), args.chunk, args.compress, huffman)
+        report('MSP_DATAFLASH_READ', len(read_data), time.monotonic() - start)
+        if read_data != data:
+            print('MSP_DATAFLASH_READ returned different data')
+            return 1
+
+    return 0 if len(data) == length else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
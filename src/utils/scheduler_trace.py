@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# Convert a Betaflight scheduler trace to Chrome trace_event JSON, for viewing in
+# chrome://tracing or https://ui.perfetto.dev
+#
+# The input is either the binary stream written by SITL (scheduler_trace.bin) or the
+# output of the CLI "trace dump" command, of which only the lines starting "trace:" are used.
+#
+# Usage: scheduler_trace.py <input> [<output.json>]
+
+import json
+import struct
+import sys
+
+MAGIC = b'BFST'
+VERSION = 1
+EVENT_FORMAT = '<IIBB'
+EVENT_SIZE = struct.calcsize(EVENT_FORMAT)
+
+REASON_TASK = 0
+REASON_CHECK = 1
+REASON_CHECK_SIGNALLED = 2
+REASON_LATE = 3
+REASON_MARKER = 4
+
+
+def read_input(path):
+    data = open(path, 'rb').read()
+    if data.startswith(MAGIC):
+        return data
+    # CLI dump, hex encoded
+    lines = data.decode('ascii', 'ignore').splitlines()
+    return bytes.fromhex(''.join(line.strip()[6:] for line in lines if line.strip().startswith('trace:')))
+
+
+def parse(data):
+    if not data.startswith(MAGIC):
+        raise ValueError('not a scheduler trace')
+    version, cycles_per_us, task_count = struct.unpack_from('<BIB', data, 4)
+    if version != VERSION:
+        raise ValueError('unsupported trace version %d' % version)
+    offset = 10
+
+    task_names = {}
+    for _ in range(task_count):
+        task_id, length = struct.unpack_from('<BB', data, offset)
+        offset += 2
+        task_names[task_id] = data[offset:offset + length].decode('ascii', 'replace')
+        offset += length
+
+    events = []
+    while offset + EVENT_SIZE <= len(data):
+        events.append(struct.unpack_from(EVENT_FORMAT, data, offset))
+        offset += EVENT_SIZE
+
+    return max(cycles_per_us, 1), task_names, events
+
+
+def to_trace_events(cycles_per_us, task_names, events):
+    trace = []
+    for task_id, name in sorted(task_names.items()):
+        trace.append({'ph': 'M', 'name': 'thread_name', 'pid': 0, 'tid': task_id, 'args': {'name': name}})
+        trace.append({'ph': 'M', 'name': 'thread_sort_index', 'pid': 0, 'tid': task_id, 'args': {'sort_index': task_id}})
+
+    # The cycle counter is 32 bits, unwrap it so time keeps increasing from the first event
+    base = -events[0][0] if events else 0
+    previous = None
+    for start, end, event_id, reason in events:
+        if previous is not None and start < previous and previous - start > 0x80000000:
+            base += 1 << 32
+        previous = start
+        start_us = (base + start) / cycles_per_us
+        duration_us = ((end - start) & 0xffffffff) / cycles_per_us
+
+        if reason == REASON_TASK:
+            trace.append({'ph': 'X', 'cat': 'task', 'name': task_names.get(event_id, str(event_id)),
+                          'pid': 0, 'tid': event_id, 'ts': start_us, 'dur': duration_us})
+        elif reason in (REASON_CHECK, REASON_CHECK_SIGNALLED):
+            trace.append({'ph': 'X', 'cat': 'check', 'name': 'check' if reason == REASON_CHECK else 'check signalled',
+                          'pid': 0, 'tid': event_id, 'ts': start_us, 'dur': duration_us})
+        elif reason == REASON_LATE:
+            trace.append({'ph': 'i', 'cat': 'late', 'name': 'late gyro cycle', 's': 'g',
+                          'pid': 0, 'tid': event_id, 'ts': start_us})
+        elif reason == REASON_MARKER:
+            trace.append({'ph': 'i', 'cat': 'marker', 'name': 'marker %d' % event_id, 's': 'g',
+                          'pid': 0, 'tid': 0, 'ts': start_us})
+
+    return {'traceEvents': trace, 'displayTimeUnit': 'ns'}
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write('usage: %s <scheduler_trace.bin|cli dump> [output.json]\n' % argv[0])
+        return 1
+
+    cycles_per_us, task_names, events = parse(read_input(argv[1]))
+    output = json.dumps(to_trace_events(cycles_per_us, task_names, events))
+    if len(argv) > 2:
+        with open(argv[2], 'w') as f:
+            f.write(output)
+    else:
+        print(output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))